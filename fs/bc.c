@@ -1,13 +1,42 @@
 
 #include "fs.h"
 
+// The block cache keeps at most bc_budget disk blocks mapped in the
+// DISKMAP window.  Resident blocks are kept on a CLOCK ring; the hand
+// gives a second chance to any block whose PTE_A bit is set, writes a
+// dirty block back before letting it go, and never evicts the super
+// block or the bitmap blocks.
+static uint32_t bc_ring[BC_MAXBLOCKS];
+static uint32_t bc_nring;
+static uint32_t bc_hand;
+static uint32_t bc_budget = BC_NBLOCKS;
+struct BcStat bc_stat;
+
+// Blocks [bc_busy_lo, bc_busy_hi) are being filled by bc_read and
+// must not be picked as victims.
+static uint32_t bc_busy_lo, bc_busy_hi;
+
+// Clean blocks are mapped read-only.  The first write to one faults,
+// and bc_pgfault maps it writable and adds it to bc_dirty, which is
+// kept sorted by block number so that write-back can merge adjacent
+// blocks into one ide_write and never has to look at clean blocks.
+static uint32_t bc_dirty[BC_MAXBLOCKS];
+static uint32_t bc_dirty_time[BC_MAXBLOCKS];	// when bc_dirty[i] got dirty
+static uint32_t bc_ndirty;
+
+static void*
+bc_va(uint32_t blockno)
+{
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+}
+
 // Return the virtual address of this disk block.
 void*
 diskaddr(uint32_t blockno)
 {
 	if (blockno == 0 || (super && blockno >= super->s_nblocks))
 		panic("bad block number %08x in diskaddr", blockno);
-	return (char*) (DISKMAP + blockno * BLKSIZE);
+	return bc_va(blockno);
 }
 
 // Is this virtual address mapped?
@@ -24,6 +53,454 @@ va_is_dirty(void *va)
 	return (uvpt[PGNUM(va)] & PTE_D) != 0;
 }
 
+// Return the index of the first entry in bc_dirty that is >= blockno.
+static uint32_t
+dirty_search(uint32_t blockno)
+{
+	uint32_t lo = 0, hi = bc_ndirty, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (bc_dirty[mid] < blockno)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static bool
+block_is_dirty(uint32_t blockno)
+{
+	uint32_t i = dirty_search(blockno);
+
+	return i < bc_ndirty && bc_dirty[i] == blockno;
+}
+
+// Add 'blockno' to bc_dirty, dirtied at time 'stamp', unless it is
+// already there.
+static void
+dirty_insert(uint32_t blockno, uint32_t stamp)
+{
+	uint32_t i;
+
+	i = dirty_search(blockno);
+	if (i < bc_ndirty && bc_dirty[i] == blockno)
+		return;
+	memmove(&bc_dirty[i + 1], &bc_dirty[i],
+		(bc_ndirty - i) * sizeof bc_dirty[0]);
+	memmove(&bc_dirty_time[i + 1], &bc_dirty_time[i],
+		(bc_ndirty - i) * sizeof bc_dirty_time[0]);
+	bc_dirty[i] = blockno;
+	bc_dirty_time[i] = stamp;
+	bc_ndirty++;
+}
+
+// Make the resident block 'blockno' writable and remember that it
+// needs to be written back.
+static void
+bc_mark_dirty(uint32_t blockno)
+{
+	void *va = bc_va(blockno);
+	int r;
+
+	dirty_insert(blockno, sys_time_msec());
+	if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_W | PTE_P)) < 0)
+		panic("in bc_mark_dirty, sys_page_map: %e", r);
+}
+
+// Wait for the n write-back requests in reqs, then map their blocks
+// read-only again, which also clears PTE_D.
+static void
+bc_write_wait(struct IoReq *reqs, uint32_t n)
+{
+	uint32_t i, j;
+	void *va;
+	int r;
+
+	for (i = 0; i < n; i++) {
+		if ((r = ioq_wait(&reqs[i])) < 0)
+			panic("bdev write block: %d, nblocks: %d failed, %e",
+			      reqs[i].io_blockno, reqs[i].io_nblocks, r);
+		for (j = 0; j < reqs[i].io_nblocks; j++) {
+			va = bc_va(reqs[i].io_blockno + j);
+			if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_P)) < 0)
+				panic("in bc_write, sys_page_map: %e", r);
+		}
+		bc_stat.bs_writes++;
+		bc_stat.bs_writebacks += reqs[i].io_nblocks;
+	}
+}
+
+// Write back the dirty blocks bc_dirty[i, i+n), which must be
+// consecutive block numbers, with one request.  Each block is mapped
+// read-only again, but stays in bc_dirty until the caller removes it.
+static void
+bc_write(uint32_t i, uint32_t n)
+{
+	struct IoReq q;
+
+	ioq_submit(&q, bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+	bc_write_wait(&q, 1);
+}
+
+// Length of the run of consecutive dirty blocks starting at bc_dirty[i],
+// capped at what one ide_write can carry.
+static uint32_t
+dirty_run(uint32_t i)
+{
+	uint32_t n;
+
+	for (n = 1; i + n < bc_ndirty && n < BC_MAXIO; n++)
+		if (bc_dirty[i + n] != bc_dirty[i] + n)
+			break;
+	return n;
+}
+
+// Has this virtual address been referenced since we last looked?
+static bool
+va_is_accessed(void *va)
+{
+	return (uvpt[PGNUM(va)] & PTE_A) != 0;
+}
+
+// The super block and the bitmap are referenced by pointer all over
+// fs.c, so keep them resident.
+static bool
+bc_pinned(uint32_t blockno)
+{
+	if (blockno < 2)
+		return 1;
+	return super && blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
+}
+
+// Advance the CLOCK hand until it finds a slot that can be reused,
+// evicting the block in it if necessary.  Returns the slot index.
+static uint32_t
+bc_evict(void)
+{
+	uint32_t i, slot, blockno;
+	void *va;
+	int r;
+
+	// Two full sweeps clear every PTE_A bit, so a third can only
+	// fail if every resident block is pinned.
+	for (i = 0; i < 3 * bc_nring; i++) {
+		slot = bc_hand++ % bc_nring;
+		blockno = bc_ring[slot];
+		va = bc_va(blockno);
+
+		if (blockno >= bc_busy_lo && blockno < bc_busy_hi)
+			continue;
+		// Slot left behind by someone unmapping the block directly.
+		if (!va_is_mapped(va))
+			return slot;
+		if (bc_pinned(blockno))
+			continue;
+		if (va_is_accessed(va)) {
+			// Second chance.  Remapping clears PTE_D as well as
+			// PTE_A, so a dirty block is written back here.
+			if (block_is_dirty(blockno))
+				flush_block(va);
+			else if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+				panic("in bc_evict, sys_page_map: %e", r);
+			continue;
+		}
+		flush_block(va);
+		if ((r = sys_page_unmap(0, va)) < 0)
+			panic("in bc_evict, sys_page_unmap: %e", r);
+		bc_stat.bs_evictions++;
+		return slot;
+	}
+	panic("bc_evict: every cached block is pinned");
+}
+
+// Record that 'blockno' is now resident, evicting another block first
+// if the cache is over budget.
+static void
+bc_insert(uint32_t blockno)
+{
+	uint32_t slot;
+
+	// Reuse the slot if the block was unmapped behind our back.
+	for (slot = 0; slot < bc_nring; slot++)
+		if (bc_ring[slot] == blockno)
+			return;
+	if (bc_nring < bc_budget)
+		slot = bc_nring++;
+	else
+		slot = bc_evict();
+	bc_ring[slot] = blockno;
+}
+
+// Change the number of blocks the cache may keep resident.
+// Returns 0 on success, -E_INVAL if nblocks is out of range.
+int
+bc_set_budget(uint32_t nblocks)
+{
+	uint32_t slot;
+
+	if (nblocks < BC_MINBLOCKS || nblocks > BC_MAXBLOCKS)
+		return -E_INVAL;
+	bc_budget = nblocks;
+	while (bc_nring > bc_budget) {
+		slot = bc_evict();
+		bc_ring[slot] = bc_ring[--bc_nring];
+	}
+	return 0;
+}
+
+// Write back every run of adjacent dirty blocks that holds a block
+// dirtied at least 'age' msec ago, one request per run, all queued
+// together so the I/O queue can order them.  An age of 0 writes back
+// everything.  Returns the number of blocks written.
+uint32_t
+bc_writeback(uint32_t age)
+{
+	// Callers hold fs_mu, so one array will do.
+	static struct IoReq reqs[IOQ_MAX];
+	uint32_t i, j, k, n, now, written, nreq;
+
+	now = sys_time_msec();
+	written = nreq = 0;
+	for (i = j = 0; i < bc_ndirty; i += n) {
+		n = dirty_run(i);
+		for (k = i; k < i + n; k++)
+			if (age == 0 || now - bc_dirty_time[k] >= age)
+				break;
+		if (k < i + n) {
+			if (nreq == IOQ_MAX) {
+				bc_write_wait(reqs, nreq);
+				nreq = 0;
+			}
+			ioq_submit(&reqs[nreq++], bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+			written += n;
+			continue;
+		}
+		// Too young; keep the run.
+		for (k = i; k < i + n; k++, j++) {
+			bc_dirty[j] = bc_dirty[k];
+			bc_dirty_time[j] = bc_dirty_time[k];
+		}
+	}
+	bc_ndirty = j;
+	bc_write_wait(reqs, nreq);
+	return written;
+}
+
+// Write back every dirty block in the cache.
+void
+bc_sync(void)
+{
+	bc_writeback(0);
+}
+
+// Return the number of dirty blocks in the cache.
+uint32_t
+bc_ndirty_blocks(void)
+{
+	return bc_ndirty;
+}
+
+// Fill in the cache counters.
+void
+bc_get_stat(struct BcStat *st)
+{
+	uint32_t i;
+
+	*st = bc_stat;
+	ioq_get_stat(st);
+	st->bs_budget = bc_budget;
+	st->bs_dirty = bc_ndirty;
+	st->bs_resident = 0;
+	for (i = 0; i < bc_nring; i++)
+		if (va_is_mapped(bc_va(bc_ring[i])))
+			st->bs_resident++;
+}
+
+// Map fresh pages for the 'nblocks' unmapped blocks starting at
+// 'blockno' and fill them with a single read.
+static void
+bc_read(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t i;
+	void *va;
+	int r;
+
+	bc_busy_lo = blockno;
+	bc_busy_hi = blockno + nblocks;
+	for (i = 0; i < nblocks; i++) {
+		va = bc_va(blockno + i);
+		bc_insert(blockno + i);
+		if ((r = sys_page_alloc(0, va, PTE_U | PTE_W | PTE_P)) < 0)
+			panic("allocate page 0x%p failed: %e", va, r);
+	}
+	if ((r = ioq_read(blockno, bc_va(blockno), nblocks)) < 0)
+		panic("bdev read block: %d, nblocks: %d failed, %e", blockno, nblocks, r);
+
+	// Map the blocks read-only, which also clears the dirty bit, since
+	// we just read them from disk
+	for (i = 0; i < nblocks; i++) {
+		va = bc_va(blockno + i);
+		if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_P)) < 0)
+			panic("in bc_read, sys_page_map: %e", r);
+	}
+	bc_busy_lo = bc_busy_hi = 0;
+}
+
+// Bring the physically contiguous blocks [blockno, blockno+nblocks)
+// into the cache ahead of use.  Blocks already cached are skipped;
+// each run of missing blocks costs one ide_read.  The caller must
+// only pass blocks that are in use.
+void
+bc_readahead(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t i, n;
+
+	if (super && blockno + nblocks > super->s_nblocks)
+		nblocks = super->s_nblocks - blockno;
+	// Leave room in the cache for the blocks being read to be reused.
+	nblocks = MIN(nblocks, MIN(bc_budget / 2, BC_MAXIO));
+	for (i = 0; i < nblocks; i += n) {
+		for (n = 0; i + n < nblocks; n++)
+			if (va_is_mapped(bc_va(blockno + i + n)))
+				break;
+		if (n == 0) {
+			bc_stat.bs_hits++;
+			n = 1;
+			continue;
+		}
+		bc_read(blockno + i, n);
+		bc_stat.bs_readahead += n;
+	}
+}
+
+// Scratch slots for bc_fill: bit i of bc_fill_busy is set while slot i
+// is in use.
+static uint32_t bc_fill_busy;
+
+// Read the unmapped blocks [blockno, blockno+nblocks) into the scratch
+// pages at 'scratch' with fs_mu released, then move them into the
+// cache.  If anything was written to the disk meanwhile the pages may
+// be stale, so they are dropped; so is any block that got cached by
+// someone else.
+static void
+bc_fill_run(uint32_t blockno, uint32_t nblocks, char *scratch)
+{
+	uint32_t i, writes;
+	bool stale;
+	void *va;
+	int r;
+
+	for (i = 0; i < nblocks; i++)
+		if ((r = sys_page_alloc(0, scratch + i * BLKSIZE, PTE_U | PTE_W | PTE_P)) < 0)
+			panic("in bc_fill_run, sys_page_alloc: %e", r);
+	writes = bc_stat.bs_writes;
+	mutex_unlock(&fs_mu);
+	r = ioq_read(blockno, scratch, nblocks);
+	mutex_lock(&fs_mu);
+	if (r < 0)
+		panic("bdev read block: %d, nblocks: %d failed, %e", blockno, nblocks, r);
+
+	stale = writes != bc_stat.bs_writes;
+	for (i = 0; i < nblocks; i++) {
+		va = bc_va(blockno + i);
+		if (!stale && !va_is_mapped(va)) {
+			bc_insert(blockno + i);
+			if ((r = sys_page_map(0, scratch + i * BLKSIZE, 0, va, PTE_U | PTE_P)) < 0)
+				panic("in bc_fill_run, sys_page_map: %e", r);
+			bc_stat.bs_readahead++;
+		}
+		sys_page_unmap(0, scratch + i * BLKSIZE);
+	}
+}
+
+// Like bc_readahead, but let other requests run during the disk
+// transfers by releasing fs_mu, which the caller holds.  Anything the
+// caller looked up before calling may have changed on return.
+void
+bc_fill(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t i, n, slot;
+
+	if (super && blockno + nblocks > super->s_nblocks)
+		nblocks = super->s_nblocks - blockno;
+	nblocks = MIN(nblocks, MIN(bc_budget / 2, BC_MAXIO));
+	for (slot = 0; slot < NWORKERS; slot++)
+		if (!(bc_fill_busy & (1 << slot)))
+			break;
+	if (slot == NWORKERS) {
+		bc_readahead(blockno, nblocks);
+		return;
+	}
+	bc_fill_busy |= 1 << slot;
+	for (i = 0; i < nblocks; i += n) {
+		for (n = 0; i + n < nblocks; n++)
+			if (va_is_mapped(bc_va(blockno + i + n)))
+				break;
+		if (n == 0) {
+			bc_stat.bs_hits++;
+			n = 1;
+			continue;
+		}
+		bc_fill_run(blockno + i, n, (char*) FILLMAP + slot * BC_MAXIO * BLKSIZE);
+	}
+	bc_fill_busy &= ~(1 << slot);
+}
+
+// Make the page at 'va' the cached copy of the newly allocated block
+// 'blockno', without reading the disk, and leave it to be written
+// back as if it had been dirtied at time 'stamp'.  Any stale page
+// left over from the block's previous life is replaced.
+void
+bc_adopt(uint32_t blockno, void *va, uint32_t stamp)
+{
+	int r;
+
+	bc_insert(blockno);
+	if ((r = sys_page_map(0, va, 0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+		panic("in bc_adopt, sys_page_map: %e", r);
+	dirty_insert(blockno, stamp);
+}
+
+// Cache a zero-filled page for the newly allocated block 'blockno'
+// without reading the disk, and mark it dirty.
+void
+bc_new_block(uint32_t blockno)
+{
+	int r;
+
+	bc_insert(blockno);
+	if ((r = sys_page_alloc(0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+		panic("in bc_new_block, sys_page_alloc: %e", r);
+	dirty_insert(blockno, sys_time_msec());
+}
+
+// Forget the cached copies of blocks [blockno, blockno+n), which have
+// just been freed: dirty ones are dropped without being written back,
+// and the pages are unmapped, leaving their ring slots to be reused.
+void
+bc_discard(uint32_t blockno, uint32_t n)
+{
+	uint32_t i, j, b;
+	int r;
+
+	i = dirty_search(blockno);
+	j = dirty_search(blockno + n);
+	memmove(&bc_dirty[i], &bc_dirty[j], (bc_ndirty - j) * sizeof bc_dirty[0]);
+	memmove(&bc_dirty_time[i], &bc_dirty_time[j],
+		(bc_ndirty - j) * sizeof bc_dirty_time[0]);
+	bc_ndirty -= j - i;
+
+	for (b = blockno; b < blockno + n; b++) {
+		if (b >= bc_busy_lo && b < bc_busy_hi)
+			continue;
+		if (va_is_mapped(bc_va(b))
+		    && (r = sys_page_unmap(0, bc_va(b))) < 0)
+			panic("in bc_discard, sys_page_unmap: %e", r);
+	}
+}
+
 // Fault any disk block that is read in to memory by
 // loading it from disk.
 static void
@@ -31,7 +508,6 @@ bc_pgfault(struct UTrapframe *utf)
 {
 	void *addr = (void *) utf->utf_fault_va;
 	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
-	int r;
 
 	// Check that the fault was within the block cache region
 	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
@@ -42,26 +518,19 @@ bc_pgfault(struct UTrapframe *utf)
 	if (super && blockno >= super->s_nblocks)
 		panic("reading non-existent block %08x\n", blockno);
 
-	// Allocate a page in the disk map region, read the contents
-	// of the block from the disk into that page.
-	// Hint: first round addr to page boundary. fs/ide.c has code to read
-	// the disk.
-	//
-	// LAB 5: you code here:
-	addr = ROUNDDOWN(addr, PGSIZE);
-	if ((r = sys_page_alloc(0, addr, PTE_U | PTE_W | PTE_P)) < 0) {
-		panic("allocate page 0x%p failed: %e", addr, r);
-		return;
-	}
-	if ((r = ide_read(blockno * BLKSECTS, addr, BLKSECTS)) < 0) {
-		panic("ide read sec: %d, secnum: %d failed, %e", blockno * BLKSECTS, BLKSECTS, r);
+	// First write to a clean resident block.
+	if ((utf->utf_err & FEC_WR) && va_is_mapped(addr)) {
+		bc_stat.bs_hits++;
+		bc_mark_dirty(blockno);
 		return;
 	}
 
-	// Clear the dirty bit for the disk block page since we just read the
-	// block from disk
-	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
-		panic("in bc_pgfault, sys_page_map: %e", r);
+	// Allocate a page in the disk map region, read the contents
+	// of the block from the disk into that page.
+	bc_stat.bs_misses++;
+	bc_read(blockno, 1);
+	if (utf->utf_err & FEC_WR)
+		bc_mark_dirty(blockno);
 
 	// Check that the block we read was allocated. (exercise for
 	// the reader: why do we do this *after* reading the block
@@ -71,33 +540,39 @@ bc_pgfault(struct UTrapframe *utf)
 }
 
 // Flush the contents of the block containing VA out to disk if
-// necessary, then clear the PTE_D bit using sys_page_map.
+// necessary, then map it read-only again, which clears PTE_D.
+// Dirty neighbours of the block go out in the same ide_write.
 // If the block is not in the block cache or is not dirty, does
 // nothing.
-// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
-// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
-// Hint: Don't forget to round addr down.
 void
 flush_block(void *addr)
 {
 	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
-	int r;
+	uint32_t i, n;
 
 	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
 		panic("flush_block of bad va %08x", addr);
 
-	// LAB 5: Your code here.
-	addr = ROUNDDOWN(addr, PGSIZE);
-	if (!va_is_mapped(addr) || !va_is_dirty(addr))
-		return;
-	if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0) {
-		cprintf("ide write failed, %e\n", r);
-		return;
-	}
-	if ((r = sys_page_map(0, addr, 0, addr, PTE_SYSCALL)) < 0) {
-		cprintf("change pte permission failed, %e\n", r);
+	i = dirty_search(blockno);
+	if (i == bc_ndirty || bc_dirty[i] != blockno)
 		return;
+	if (!va_is_mapped(bc_va(blockno))) {
+		// Unmapped behind our back; nothing left to write.
+		n = 1;
+		goto out;
 	}
+	// Back up to the start of the run of dirty blocks.
+	while (i > 0 && bc_dirty[i - 1] == bc_dirty[i] - 1
+	       && blockno - bc_dirty[i - 1] < BC_MAXIO)
+		i--;
+	n = dirty_run(i);
+	bc_write(i, n);
+out:
+	memmove(&bc_dirty[i], &bc_dirty[i + n],
+		(bc_ndirty - i - n) * sizeof bc_dirty[0]);
+	memmove(&bc_dirty_time[i], &bc_dirty_time[i + n],
+		(bc_ndirty - i - n) * sizeof bc_dirty_time[0]);
+	bc_ndirty -= n;
 }
 
 // Test that the block cache works, by smashing the superblock and
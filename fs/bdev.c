@@ -0,0 +1,90 @@
+/*
+ * Block device: maps file system block numbers onto the disks of one
+ * driver, IDE or virtio-blk.
+ *
+ * A file system may be striped RAID-0 style across several disks in
+ * units of s_stripe blocks: unit u lives on disk u % ndisks, as that
+ * disk's (u / ndisks)'th unit.  A transfer that covers units on several
+ * disks keeps all of them busy at once.
+ */
+
+#include "fs.h"
+
+static struct DiskDriver *bdev_drv;
+static int bdev_disks[FS_MAXDISKS];	// disk numbers, in stripe order
+static uint32_t bdev_ndisks = 1;
+static uint32_t bdev_unit = ~0;		// blocks per stripe unit
+
+// Use drv's disk 'disk' alone until bdev_stripe says otherwise.
+void
+bdev_init(struct DiskDriver *drv, int disk)
+{
+	bdev_drv = drv;
+	bdev_disks[0] = disk;
+	cprintf("FS is on %s disk %d\n", drv->dd_name, disk);
+}
+
+// Stripe across the disks super block s asks for, numbered on from the
+// one given to bdev_init.  The super block sits in the first unit,
+// where it reads the same whether or not the disk is striped.
+void
+bdev_stripe(const struct Super *s)
+{
+	uint32_t i;
+
+	if (s->s_ndisks <= 1)
+		return;
+	if (s->s_ndisks > FS_MAXDISKS || s->s_stripe < 2)
+		panic("bad stripe: %d disks, %d blocks per unit",
+		      s->s_ndisks, s->s_stripe);
+	for (i = 1; i < s->s_ndisks; i++) {
+		bdev_disks[i] = bdev_disks[0] + i;
+		if (!bdev_drv->dd_probe(bdev_disks[i]))
+			panic("striped disk %d is missing", bdev_disks[i]);
+	}
+	bdev_ndisks = s->s_ndisks;
+	bdev_unit = s->s_stripe;
+}
+
+// Transfer blocks [blockno, blockno+nblocks) in rounds, each taking
+// the next stripe unit from every disk and running them side by side.
+static int
+bdev_rw(uint32_t blockno, void *buf, uint32_t nblocks, bool write)
+{
+	struct DiskReq reqs[FS_MAXDISKS];
+	uint32_t unit, off, n;
+	int nreq, r;
+
+	while (nblocks > 0) {
+		for (nreq = 0; nreq < bdev_ndisks && nblocks > 0; nreq++) {
+			unit = blockno / bdev_unit;
+			off = blockno % bdev_unit;
+			n = MIN(bdev_unit - off, nblocks);
+			reqs[nreq].dr_disk = bdev_disks[unit % bdev_ndisks];
+			reqs[nreq].dr_secno = ((unit / bdev_ndisks) * bdev_unit + off) * BLKSECTS;
+			reqs[nreq].dr_buf = buf;
+			reqs[nreq].dr_nsecs = n * BLKSECTS;
+			reqs[nreq].dr_write = write;
+			blockno += n;
+			buf += n * BLKSIZE;
+			nblocks -= n;
+		}
+		if ((r = bdev_drv->dd_rw(reqs, nreq)) < 0)
+			return r;
+	}
+	return 0;
+}
+
+int
+bdev_read(uint32_t blockno, void *dst, uint32_t nblocks)
+{
+	assert(nblocks <= BC_MAXIO);
+	return bdev_rw(blockno, dst, nblocks, 0);
+}
+
+int
+bdev_write(uint32_t blockno, const void *src, uint32_t nblocks)
+{
+	assert(nblocks <= BC_MAXIO);
+	return bdev_rw(blockno, (void*) src, nblocks, 1);
+}
@@ -0,0 +1,64 @@
+/*
+ * Directory entry cache: remembers which struct File, if any, a name
+ * resolves to in a directory, so that walk_path can skip directory
+ * scans for paths it has seen before.
+ */
+
+#include <inc/string.h>
+
+#include "fs.h"
+
+// The cache is direct-mapped on (directory, name).  A newer entry
+// simply replaces whatever was in its slot.  Entries with d_file == 0
+// are negative: the name is known not to exist.
+struct Dentry {
+	struct File *d_dir;		// directory, or 0 if the slot is unused
+	struct File *d_file;		// what d_name names in d_dir, or 0
+	char d_name[MAXNAMELEN];
+};
+
+static struct Dentry dcache[NDCACHE];
+
+static struct Dentry*
+dcache_slot(struct File *dir, const char *name)
+{
+	uint32_t h = dir_hash(name) + (uintptr_t) dir / sizeof(struct File);
+
+	return &dcache[h % NDCACHE];
+}
+
+// Look name up in dir through the cache.  Returns 1 and sets *pf if
+// the cache knows the answer (*pf is 0 if name does not exist),
+// otherwise returns 0.
+bool
+dcache_lookup(struct File *dir, const char *name, struct File **pf)
+{
+	struct Dentry *d = dcache_slot(dir, name);
+
+	if (d->d_dir != dir || strcmp(d->d_name, name) != 0)
+		return 0;
+	*pf = d->d_file;
+	return 1;
+}
+
+// Remember that name in dir is f, or does not exist if f is 0.
+void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+	struct Dentry *d = dcache_slot(dir, name);
+
+	d->d_dir = dir;
+	d->d_file = f;
+	strcpy(d->d_name, name);
+}
+
+// Forget whatever is cached about name in dir.  Call whenever name is
+// created, removed or renamed.
+void
+dcache_invalidate(struct File *dir, const char *name)
+{
+	struct Dentry *d = dcache_slot(dir, name);
+
+	if (d->d_dir == dir && strcmp(d->d_name, name) == 0)
+		d->d_dir = 0;
+}
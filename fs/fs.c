@@ -24,6 +24,15 @@ check_super(void)
 // Free block bitmap
 // --------------------------------------------------------------
 
+// Number of free blocks in the bitmap
+static uint32_t nfree_blocks;
+
+static uint32_t delayed_reserve(uint32_t n);
+static void delalloc_init(void);
+static void file_truncate_blocks(struct File *f, off_t newsize);
+static uint32_t ndelayed;
+static bool delalloc_flushing;
+
 // Check to see if the block bitmap indicates that block 'blockno' is free.
 // Return 1 if the block is free, 0 if not.
 bool
@@ -43,37 +52,193 @@ free_block(uint32_t blockno)
 	// Blockno zero is the null pointer of block numbers.
 	if (blockno == 0)
 		panic("attempt to free zero block");
+	if (!block_is_free(blockno))
+		nfree_blocks++;
 	bitmap[blockno/32] |= 1<<(blockno%32);
 }
 
-// Search the bitmap for a free block and allocate it.  When you
-// allocate a block, immediately flush the changed bitmap block
-// to disk.
+// Mark blocks [blockno, blockno+n) free, a bitmap word at a time.
+static void
+free_run(uint32_t blockno, uint32_t n)
+{
+	uint32_t end = blockno + n, w, lo, hi, mask, newly;
+
+	if (blockno == 0)
+		panic("attempt to free zero block");
+	while (blockno < end) {
+		w = blockno / 32;
+		lo = blockno % 32;
+		hi = MIN(end - w * 32, 32);
+		mask = (hi == 32 ? ~0U : (1U << hi) - 1) & ~((1U << lo) - 1);
+		for (newly = mask & ~bitmap[w]; newly; newly &= newly - 1)
+			nfree_blocks++;
+		bitmap[w] |= mask;
+		blockno = w * 32 + hi;
+	}
+}
+
+// Blocks being freed by a truncate or remove, gathered into runs of
+// consecutive block numbers.  free_runs_flush applies them to the
+// bitmap together and writes each bitmap block it touched once,
+// instead of a bitmap update per block.
+#define NFREERUNS	64
+
+struct FreeRun {
+	uint32_t fr_start;
+	uint32_t fr_len;
+};
+
+static struct FreeRun freeruns[NFREERUNS];
+static uint32_t nfreeruns;
+static uint32_t freed_lo = ~0, freed_hi;	// blocks freed since the last flush
+
+// Apply the gathered runs to the bitmap, dropping any cached copies of
+// the blocks so that write-back does not write them.
+static void
+free_runs_apply(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < nfreeruns; i++) {
+		bc_discard(freeruns[i].fr_start, freeruns[i].fr_len);
+		free_run(freeruns[i].fr_start, freeruns[i].fr_len);
+		freed_lo = MIN(freed_lo, freeruns[i].fr_start);
+		freed_hi = MAX(freed_hi, freeruns[i].fr_start + freeruns[i].fr_len);
+	}
+	nfreeruns = 0;
+}
+
+// Queue block 'blockno' to be freed.
+static void
+free_runs_add(uint32_t blockno)
+{
+	if (nfreeruns > 0
+	    && freeruns[nfreeruns - 1].fr_start + freeruns[nfreeruns - 1].fr_len == blockno) {
+		freeruns[nfreeruns - 1].fr_len++;
+		return;
+	}
+	if (nfreeruns == NFREERUNS)
+		free_runs_apply();
+	freeruns[nfreeruns].fr_start = blockno;
+	freeruns[nfreeruns++].fr_len = 1;
+}
+
+// Free everything queued and write out the bitmap blocks that changed.
+static void
+free_runs_flush(void)
+{
+	uint32_t b;
+
+	free_runs_apply();
+	if (freed_lo >= freed_hi)
+		return;
+	for (b = freed_lo / BLKBITSIZE; b <= (freed_hi - 1) / BLKBITSIZE; b++)
+		flush_block(diskaddr(2 + b));
+	freed_lo = ~0;
+	freed_hi = 0;
+}
+
+// Next-fit cursor: allocation resumes where the last one left off
+// instead of rescanning the start of the bitmap every time.
+static uint32_t alloc_cursor;
+
+// Return the first free block at or after 'start', wrapping around at
+// the end of the disk, or -E_NO_DISK if there is none.  Words with no
+// free blocks are skipped whole.
+static int
+find_free_block(uint32_t start)
+{
+	uint32_t i, n, nwords, bits, blockno;
+
+	nwords = (super->s_nblocks + 31) / 32;
+	if (start >= super->s_nblocks)
+		start = 0;
+	i = start / 32;
+	bits = bitmap[i] & (~0U << (start % 32));
+	// nwords + 1 words so that the first word is seen in full too.
+	for (n = 0; n <= nwords; n++) {
+		if (bits) {
+			blockno = i * 32 + bsf(bits);
+			if (blockno < super->s_nblocks)
+				return blockno;
+		}
+		i = (i + 1) % nwords;
+		bits = bitmap[i];
+	}
+	return -E_NO_DISK;
+}
+
+// Allocate a free block, preferring 'hint' or the first free block
+// after it.  The changed bitmap block is left for the write-back
+// daemon.
 //
 // Return block number allocated on success,
 // -E_NO_DISK if we are out of blocks.
-//
-// Hint: use free_block as an example for manipulating the bitmap.
-int
-alloc_block(void)
+static int
+alloc_block_near(uint32_t hint)
 {
-	// The bitmap consists of one or more blocks.  A single bitmap block
-	// contains the in-use bits for BLKBITSIZE blocks.  There are
-	// super->s_nblocks blocks in the disk altogether.
+	int r;
 
-	// LAB 5: Your code here.
 	if (super == 0) {
 		cprintf("Thereis no super block.\n");
 		return -E_NO_DISK;
 	}
-	for (int i = 0; i < super->s_nblocks; i++) {
-		if (bitmap[i / 32] & (1 << (i % 32))) {
-			bitmap[i / 32] &= ~(1 << (i % 32));
-			flush_block(bitmap);
-			return i;
+	// Blocks set aside for pending delayed blocks are only for
+	// delalloc_flush.
+	if (!delalloc_flushing && nfree_blocks < delayed_reserve(ndelayed) + 1)
+		return -E_NO_DISK;
+	if ((r = find_free_block(hint)) < 0)
+		return r;
+	bitmap[r / 32] &= ~(1 << (r % 32));
+	nfree_blocks--;
+	alloc_cursor = r + 1;
+	return r;
+}
+
+// Allocate up to 'want' consecutive free blocks, preferring the first
+// long enough run at or after 'hint' and otherwise the longest run
+// there is.  Sets *got to the number of blocks allocated.
+//
+// Return the first block number allocated on success,
+// -E_NO_DISK if we are out of blocks.
+static int
+alloc_run(uint32_t hint, uint32_t want, uint32_t *got)
+{
+	uint32_t n, start, scanned, best, bestn;
+	int r;
+
+	best = bestn = 0;
+	start = hint;
+	for (scanned = 0; scanned < super->s_nblocks; scanned += n) {
+		if ((r = find_free_block(start)) < 0)
+			return r;
+		scanned += r >= start ? r - start : super->s_nblocks - start + r;
+		for (n = 1; n < want && block_is_free(r + n); n++)
+			;
+		if (n > bestn) {
+			best = r;
+			bestn = n;
 		}
+		if (n == want)
+			break;
+		start = r + n;
 	}
-	return -E_NO_DISK;
+	for (n = 0; n < bestn; n++)
+		bitmap[(best + n) / 32] &= ~(1 << ((best + n) % 32));
+	nfree_blocks -= bestn;
+	alloc_cursor = best + bestn;
+	*got = bestn;
+	return best;
+}
+
+// Search the bitmap for a free block and allocate it.
+//
+// Return block number allocated on success,
+// -E_NO_DISK if we are out of blocks.
+int
+alloc_block(void)
+{
+	return alloc_block_near(alloc_cursor);
 }
 
 // Validate the file system bitmap.
@@ -106,30 +271,65 @@ check_bitmap(void)
 void
 fs_init(void)
 {
+	uint32_t i;
+
 	static_assert(sizeof(struct File) == 256);
 
-	// Find a JOS disk.  Use the second IDE disk (number 1) if available
-	if (ide_probe_disk1())
-		ide_set_disk(1);
+	// Find a JOS disk: the first virtio-blk device if there is one,
+	// else the second IDE disk (number 1) if available.
+	ide_init();
+	if (virtio_init() > 0)
+		bdev_init(&virtio_driver, 0);
+	else if (ide_probe_disk(1))
+		bdev_init(&ide_driver, 1);
 	else
-		ide_set_disk(0);
+		bdev_init(&ide_driver, 0);
 	bc_init();
 
-	// Set "super" to point to the super block.
+	// Set "super" to point to the super block, then bring in the
+	// rest of the disks if the file system is striped.
 	super = diskaddr(1);
 	check_super();
+	bdev_stripe(super);
 
 	// Set "bitmap" to the beginning of the first bitmap block.
 	bitmap = diskaddr(2);
 	check_bitmap();
-	
+
+	for (i = 0; i < super->s_nblocks; i++)
+		if (block_is_free(i))
+			nfree_blocks++;
+	delalloc_init();
+}
+
+// Set *pblk to the indirect block whose number is stored in *slot.
+// If *slot is 0 and 'alloc' is set, allocate and clear a new one.
+//
+// Returns 0 on success, -E_NOT_FOUND if *slot is 0 and alloc is 0,
+// or -E_NO_DISK if there's no space on the disk.
+static int
+indirect_block(uint32_t *slot, bool alloc, uint32_t **pblk)
+{
+	int r;
+
+	if (*slot == 0) {
+		if (!alloc)
+			return -E_NOT_FOUND;
+		if ((r = alloc_block()) < 0)
+			return r;
+		*slot = r;
+		bc_new_block(r);
+	}
+	*pblk = diskaddr(*slot);
+	return 0;
 }
 
 // Find the disk block number slot for the 'filebno'th block in file 'f'.
 // Set '*ppdiskbno' to point to that slot.
-// The slot will be one of the f->f_direct[] entries,
-// or an entry in the indirect block.
-// When 'alloc' is set, this function will allocate an indirect block
+// The slot will be one of the f->f_direct[] entries, an entry in the
+// indirect block, or an entry in one of the indirect blocks hanging
+// off the double-indirect block.
+// When 'alloc' is set, this function will allocate indirect blocks
 // if necessary.
 //
 // Returns:
@@ -137,18 +337,18 @@ fs_init(void)
 //	-E_NOT_FOUND if the function needed to allocate an indirect block, but
 //		alloc was 0.
 //	-E_NO_DISK if there's no space on the disk for an indirect block.
-//	-E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+//	-E_INVAL if filebno is out of range (it's >= MAXFILEBLOCKS or
+//		past the end of the file).
 //
 // Analogy: This is like pgdir_walk for files.
-// Hint: Don't forget to clear any block you allocate.
 static int
 file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
 {
-       // LAB 5: Your code here.
 	int nblock, r;
+	uint32_t bno, *indirect;
 
 	nblock = (f->f_size + BLKSIZE - 1) / BLKSIZE;
-	if (filebno >= nblock || filebno >= NDIRECT + NINDIRECT) {
+	if (filebno >= nblock || filebno >= MAXFILEBLOCKS) {
 		return -E_INVAL;
 	}
 	// filebno is in direct blocks
@@ -158,26 +358,269 @@ file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool all
 		}
 		return 0;
 	}
-	// filebno is in indirect blocks
-	if (f->f_indirect == 0) {
-		if (!alloc) {
-			return -E_NOT_FOUND;
-		}
-		if ((r = alloc_block()) < 0) {
+	// struct File is packed, so its indirect block numbers go through
+	// an aligned copy, stored back only if a block was allocated.
+	filebno -= NDIRECT;
+	if (filebno < NINDIRECT) {
+		// filebno is in the indirect block
+		bno = f->f_indirect;
+		if ((r = indirect_block(&bno, alloc, &indirect)) < 0)
+			return r;
+		if (f->f_indirect != bno)
+			f->f_indirect = bno;
+	} else {
+		// filebno is under the double-indirect block
+		filebno -= NINDIRECT;
+		bno = f->f_dindirect;
+		if ((r = indirect_block(&bno, alloc, &indirect)) < 0)
+			return r;
+		if (f->f_dindirect != bno)
+			f->f_dindirect = bno;
+		if ((r = indirect_block(&indirect[filebno / NINDIRECT], alloc, &indirect)) < 0)
+			return r;
+		filebno %= NINDIRECT;
+	}
+	if (ppdiskbno) {
+		*ppdiskbno = indirect + filebno;
+	}
+	return 0;
+}
+
+// Where to look for a disk block for the filebno'th block of f: just
+// past the disk block holding the block before it, if there is one.
+static uint32_t
+file_alloc_hint(struct File *f, uint32_t filebno)
+{
+	uint32_t *pdiskbno;
+
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+	    && *pdiskbno != 0)
+		return *pdiskbno + 1;
+	return alloc_cursor;
+}
+
+// --------------------------------------------------------------
+// Delayed allocation
+// --------------------------------------------------------------
+
+// A block written into a hole or past the end of a file does not get a
+// disk block right away.  Its data lives in a page at DELAYMAP and the
+// file's block pointer stays 0 until delalloc_flush, at write-back
+// time, hands out disk blocks to everything pending at once, giving
+// each file's consecutive blocks one contiguous run where it can.
+// Since the pointer stays 0 until then, nothing on disk ever refers to
+// a block that is not allocated.
+
+struct Delayed {
+	struct File *d_file;	// owning file, 0 if the entry is free
+	uint32_t d_filebno;	// block number within d_file
+	int d_next;		// next entry on hash chain or free list, or -1
+};
+
+#define DHASHSIZE	256
+#define DHASH(f, bno)	((((uintptr_t) (f) / sizeof(struct File)) + (bno)) % DHASHSIZE)
+
+static struct Delayed delayed[NDELAYED];
+static int delayed_hash[DHASHSIZE];
+static int delayed_free;
+static uint32_t delayed_since;		// when the oldest pending block was written
+
+static void
+delalloc_init(void)
+{
+	int i;
+
+	for (i = 0; i < DHASHSIZE; i++)
+		delayed_hash[i] = -1;
+	for (i = 0; i < NDELAYED; i++)
+		delayed[i].d_next = i + 1 < NDELAYED ? i + 1 : -1;
+	delayed_free = 0;
+}
+
+static void*
+delayed_va(int i)
+{
+	return (char*) (DELAYMAP + i * BLKSIZE);
+}
+
+// Return the index of the pending block for filebno of f, or -1.
+static int
+delayed_lookup(struct File *f, uint32_t filebno)
+{
+	int i;
+
+	for (i = delayed_hash[DHASH(f, filebno)]; i >= 0; i = delayed[i].d_next)
+		if (delayed[i].d_file == f && delayed[i].d_filebno == filebno)
+			return i;
+	return -1;
+}
+
+// Forget pending block i.  Its page is unmapped from DELAYMAP.
+static void
+delayed_remove(int i)
+{
+	int *pp;
+
+	for (pp = &delayed_hash[DHASH(delayed[i].d_file, delayed[i].d_filebno)];
+	     *pp != i; pp = &delayed[*pp].d_next)
+		;
+	*pp = delayed[i].d_next;
+	sys_page_unmap(0, delayed_va(i));
+	delayed[i].d_file = 0;
+	delayed[i].d_next = delayed_free;
+	delayed_free = i;
+	ndelayed--;
+}
+
+// Blocks that n pending ones may still need, counting an indirect
+// block per NINDIRECT of them and a double-indirect block.
+static uint32_t
+delayed_reserve(uint32_t n)
+{
+	if (n == 0)
+		return 0;
+	return n + (n + NINDIRECT - 1) / NINDIRECT + 1;
+}
+
+// Set *blk to a page for the filebno'th block of f that does not have
+// a disk block yet, creating it zero-filled if needed.
+// Returns 0 on success, -E_NO_DISK if the disk can't hold it.
+static int
+delayed_get(struct File *f, uint32_t filebno, char **blk)
+{
+	int i, r;
+
+	if ((i = delayed_lookup(f, filebno)) < 0) {
+		if (ndelayed == NDELAYED)
+			delalloc_flush();
+		if (nfree_blocks < delayed_reserve(ndelayed + 1))
+			return -E_NO_DISK;
+		i = delayed_free;
+		if ((r = sys_page_alloc(0, delayed_va(i), PTE_P|PTE_U|PTE_W)) < 0)
 			return r;
+		delayed_free = delayed[i].d_next;
+		delayed[i].d_file = f;
+		delayed[i].d_filebno = filebno;
+		delayed[i].d_next = delayed_hash[DHASH(f, filebno)];
+		delayed_hash[DHASH(f, filebno)] = i;
+		if (ndelayed++ == 0)
+			delayed_since = sys_time_msec();
+	}
+	*blk = delayed_va(i);
+	return 0;
+}
+
+// Drop the pending blocks of f at or beyond file block 'from'.
+static void
+delalloc_drop(struct File *f, uint32_t from)
+{
+	int i;
+
+	for (i = 0; i < NDELAYED && ndelayed > 0; i++)
+		if (delayed[i].d_file == f && delayed[i].d_filebno >= from)
+			delayed_remove(i);
+}
+
+static bool
+delayed_before(int a, int b)
+{
+	if (delayed[a].d_file != delayed[b].d_file)
+		return delayed[a].d_file < delayed[b].d_file;
+	return delayed[a].d_filebno < delayed[b].d_filebno;
+}
+
+// Give every pending block a disk block and move its page into the
+// block cache, dirty.  Consecutive blocks of one file are allocated
+// as one run.
+void
+delalloc_flush(void)
+{
+	static int order[NDELAYED];
+	uint32_t i, j, k, n, got, *pdiskbno;
+	uint32_t gap;
+	int blockno, t, r;
+	struct File *f;
+
+	if (ndelayed == 0)
+		return;
+	delalloc_flushing = 1;
+	for (i = j = 0; i < NDELAYED; i++)
+		if (delayed[i].d_file)
+			order[j++] = i;
+	for (gap = n = j; (gap /= 2) > 0; )
+		for (i = gap; i < n; i++)
+			for (k = i; k >= gap && delayed_before(order[k], order[k - gap]); k -= gap) {
+				t = order[k];
+				order[k] = order[k - gap];
+				order[k - gap] = t;
+			}
+
+	for (i = 0; i < n; i += j) {
+		f = delayed[order[i]].d_file;
+		for (j = 1; i + j < n && delayed[order[i + j]].d_file == f
+			     && delayed[order[i + j]].d_filebno == delayed[order[i]].d_filebno + j; j++)
+			;
+		// Blocks order[i, i+j) are consecutive blocks of f.
+		blockno = alloc_run(file_alloc_hint(f, delayed[order[i]].d_filebno), j, &got);
+		if (blockno < 0)
+			panic("delalloc_flush: %e", blockno);
+		j = got;
+		for (k = i; k < i + j; k++, blockno++) {
+			if ((r = file_block_walk(f, delayed[order[k]].d_filebno, &pdiskbno, 1)) < 0)
+				panic("delalloc_flush: %e", r);
+			*pdiskbno = blockno;
+			bc_adopt(blockno, delayed_va(order[k]), delayed_since);
+			delayed_remove(order[k]);
 		}
-		f->f_indirect = r;
 	}
+	delalloc_flushing = 0;
+}
 
-	uint32_t *indirect = diskaddr(f->f_indirect);
-	if (ppdiskbno) {
-		*ppdiskbno = indirect + filebno - NDIRECT;
+// Like file_get_block, but for a block about to be written: a block
+// without a disk block yet is not given one until write-back.
+static int
+file_write_block(struct File *f, uint32_t filebno, char **blk)
+{
+	int r;
+	uint32_t *ppdiskbno;
+
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 0)) < 0
+	    && r != -E_NOT_FOUND)
+		return r;
+	if (r == 0 && *ppdiskbno) {
+		*blk = diskaddr(*ppdiskbno);
+		return 0;
 	}
+	return delayed_get(f, filebno, blk);
+}
+
+// Move the data of an inline file out to its block 0, so that f can
+// grow past FINLINE bytes or be accessed by block.
+static int
+file_spill(struct File *f)
+{
+	char data[FINLINE], *blk;
+	int r;
+
+	if (!(f->f_flags & FFLAG_INLINE))
+		return 0;
+	memmove(data, f->f_inline, FINLINE);
+	f->f_flags &= ~FFLAG_INLINE;
+	memset(f->f_inline, 0, FINLINE);
+	if (f->f_size == 0)
+		return 0;
+	if ((r = file_get_block(f, 0, &blk)) < 0) {
+		memmove(f->f_inline, data, FINLINE);
+		f->f_flags |= FFLAG_INLINE;
+		return r;
+	}
+	memmove(blk, data, f->f_size);
 	return 0;
 }
 
 // Set *blk to the address in memory where the filebno'th
-// block of file 'f' would be mapped.
+// block of file 'f' would be mapped.  An inline file is moved out to
+// blocks first.
 //
 // Returns 0 on success, < 0 on error.  Errors are:
 //	-E_NO_DISK if a block needed to be allocated but the disk is full.
@@ -187,25 +630,129 @@ file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool all
 int
 file_get_block(struct File *f, uint32_t filebno, char **blk)
 {
-       // LAB 5: Your code here.
-	int nblock, r;
-	uint32_t *ppdiskbno = 0;
-	
-	if ((r = file_block_walk(f, filebno, &ppdiskbno, 1) || ppdiskbno == 0) < 0) {
+	int r;
+	uint32_t *ppdiskbno;
+
+	if ((r = file_spill(f)) < 0)
+		return r;
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 0)) < 0
+	    && r != -E_NOT_FOUND)
 		return r;
+	if (r == 0 && *ppdiskbno) {
+		if (blk)
+			*blk = diskaddr(*ppdiskbno);
+		return 0;
+	}
+	// A block written but not yet given a disk address
+	if ((r = delayed_lookup(f, filebno)) >= 0) {
+		if (blk)
+			*blk = delayed_va(r);
+		return 0;
 	}
-	// if blockno entry is null, allocate a disk block
-	if (*ppdiskbno == 0) {
-		if ((r = alloc_block()) < 0) {
+	// Otherwise allocate a disk block now, preferably right after
+	// the file's previous block
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 1)) < 0)
+		return r;
+	if ((r = alloc_block_near(file_alloc_hint(f, filebno))) < 0)
+		return r;
+	*ppdiskbno = r;
+	bc_new_block(r);
+	if (blk)
+		*blk = diskaddr(r);
+	return 0;
+}
+
+// --------------------------------------------------------------
+// Directories
+// --------------------------------------------------------------
+
+// Directories with at least this many blocks get a hash index the
+// next time an entry is added to them.
+#define DIRINDEX_MINBLOCKS	2
+
+// Set *pf to entry 'entno' of dir.
+static int
+dir_entry(struct File *dir, uint32_t entno, struct File **pf)
+{
+	int r;
+	char *blk;
+
+	if ((r = file_get_block(dir, entno / BLKFILES, &blk)) < 0)
+		return r;
+	*pf = (struct File*) blk + entno % BLKFILES;
+	return 0;
+}
+
+// Return dir's hash index, or 0 if it does not have a valid one.
+static struct DirIndex*
+dir_index(struct File *dir)
+{
+	struct DirIndex *di;
+
+	if (dir->f_dirindex == 0)
+		return 0;
+	di = diskaddr(dir->f_dirindex);
+	return di->di_magic == DIRINDEX_MAGIC ? di : 0;
+}
+
+// Put entry 'entno' of dir, which is f, on the hash chain for its name.
+static void
+dir_index_insert(struct DirIndex *di, uint32_t entno, struct File *f)
+{
+	uint32_t h = dir_hash(f->f_name);
+
+	f->f_hnext = di->di_bucket[h];
+	di->di_bucket[h] = entno + 1;
+}
+
+// Take f, an entry of dir, off its hash chain.
+// Returns f's entry number, or < 0 if it is not on the chain.
+static int
+dir_index_remove(struct File *dir, struct DirIndex *di, struct File *f)
+{
+	uint32_t h = dir_hash(f->f_name), e;
+	struct File *g, *prev = 0;
+	int r;
+
+	for (e = di->di_bucket[h]; e != 0; e = g->f_hnext, prev = g) {
+		if ((r = dir_entry(dir, e - 1, &g)) < 0)
 			return r;
-		}
-		*ppdiskbno = r;
+		if (g != f)
+			continue;
+		if (prev)
+			prev->f_hnext = f->f_hnext;
+		else
+			di->di_bucket[h] = f->f_hnext;
+		return e - 1;
 	}
-	// set *blk address of the block in memory
-	if (blk) {
-		*blk = diskaddr(*ppdiskbno);
+	return -E_NOT_FOUND;
+}
+
+// Give dir a hash index covering all its current entries.
+static int
+dir_build_index(struct File *dir)
+{
+	int r, blockno;
+	uint32_t entno;
+	struct DirIndex *di;
+	struct File *f;
+
+	if ((blockno = alloc_block()) < 0)
+		return blockno;
+	bc_new_block(blockno);
+	di = diskaddr(blockno);
+	di->di_magic = DIRINDEX_MAGIC;
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+			goto fail;
+		if (f->f_name[0] != '\0')
+			dir_index_insert(di, entno, f);
 	}
+	dir->f_dirindex = blockno;
 	return 0;
+fail:
+	free_block(blockno);
+	return r;
 }
 
 // Try to find a file named "name" in dir.  If so, set *file to it.
@@ -216,14 +763,29 @@ static int
 dir_lookup(struct File *dir, const char *name, struct File **file)
 {
 	int r;
-	uint32_t i, j, nblock;
+	uint32_t i, j, nblock, e;
 	char *blk;
 	struct File *f;
+	struct DirIndex *di;
 
-	// Search dir for name.
 	// We maintain the invariant that the size of a directory-file
 	// is always a multiple of the file system's block size.
 	assert((dir->f_size % BLKSIZE) == 0);
+
+	// Follow the hash chain for name.
+	if ((di = dir_index(dir)) != 0) {
+		for (e = di->di_bucket[dir_hash(name)]; e; e = f->f_hnext) {
+			if ((r = dir_entry(dir, e - 1, &f)) < 0)
+				return r;
+			if (strcmp(f->f_name, name) == 0) {
+				*file = f;
+				return 0;
+			}
+		}
+		return -E_NOT_FOUND;
+	}
+
+	// No index: search every entry of dir for name.
 	nblock = dir->f_size / BLKSIZE;
 	for (i = 0; i < nblock; i++) {
 		if ((r = file_get_block(dir, i, &blk)) < 0)
@@ -238,33 +800,46 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	return -E_NOT_FOUND;
 }
 
-// Set *file to point at a free File structure in dir.  The caller is
-// responsible for filling in the File fields.
+// Add an entry named 'name' to dir and set *file to it, zeroed apart
+// from the name.  The caller is responsible for filling in the other
+// File fields.
 static int
-dir_alloc_file(struct File *dir, struct File **file)
+dir_add_file(struct File *dir, const char *name, struct File **file)
 {
 	int r;
-	uint32_t nblock, i, j;
-	char *blk;
+	uint32_t entno, nent;
+	struct DirIndex *di;
 	struct File *f;
 
 	assert((dir->f_size % BLKSIZE) == 0);
-	nblock = dir->f_size / BLKSIZE;
-	for (i = 0; i < nblock; i++) {
-		if ((r = file_get_block(dir, i, &blk)) < 0)
+	if (!dir_index(dir) && dir->f_size / BLKSIZE >= DIRINDEX_MINBLOCKS
+	    && (r = dir_build_index(dir)) < 0)
+		cprintf("warning: dir_build_index: %e\n", r);
+	di = dir_index(dir);
+
+	// Find a free entry, starting from the index's hint if there is one.
+	nent = dir->f_size / BLKSIZE * BLKFILES;
+	for (entno = di ? di->di_free : 0; entno < nent; entno++) {
+		if ((r = dir_entry(dir, entno, &f)) < 0)
 			return r;
-		f = (struct File*) blk;
-		for (j = 0; j < BLKFILES; j++)
-			if (f[j].f_name[0] == '\0') {
-				*file = &f[j];
-				return 0;
-			}
+		if (f->f_name[0] == '\0')
+			break;
 	}
-	dir->f_size += BLKSIZE;
-	if ((r = file_get_block(dir, i, &blk)) < 0)
-		return r;
-	f = (struct File*) blk;
-	*file = &f[0];
+	if (entno == nent) {
+		dir->f_size += BLKSIZE;
+		if ((r = dir_entry(dir, entno, &f)) < 0) {
+			dir->f_size -= BLKSIZE;
+			return r;
+		}
+	}
+
+	memset(f, 0, sizeof *f);
+	strcpy(f->f_name, name);
+	if (di) {
+		dir_index_insert(di, entno, f);
+		di->di_free = entno + 1;
+	}
+	*file = f;
 	return 0;
 }
 
@@ -315,15 +890,23 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 		if (dir->f_type != FTYPE_DIR)
 			return -E_NOT_FOUND;
 
-		if ((r = dir_lookup(dir, name, &f)) < 0) {
-			if (r == -E_NOT_FOUND && *path == '\0') {
+		if (!dcache_lookup(dir, name, &f)) {
+			if ((r = dir_lookup(dir, name, &f)) < 0) {
+				if (r != -E_NOT_FOUND)
+					return r;
+				f = 0;
+			}
+			dcache_enter(dir, name, f);
+		}
+		if (f == 0) {
+			if (*path == '\0') {
 				if (pdir)
 					*pdir = dir;
 				if (lastelem)
 					strcpy(lastelem, name);
 				*pf = 0;
 			}
-			return r;
+			return -E_NOT_FOUND;
 		}
 	}
 
@@ -350,12 +933,12 @@ file_create(const char *path, struct File **pf)
 		return -E_FILE_EXISTS;
 	if (r != -E_NOT_FOUND || dir == 0)
 		return r;
-	if ((r = dir_alloc_file(dir, &f)) < 0)
+	if ((r = dir_add_file(dir, name, &f)) < 0)
 		return r;
+	f->f_flags = FFLAG_INLINE;
+	dcache_enter(dir, name, f);
 
-	strcpy(f->f_name, name);
 	*pf = f;
-	file_flush(dir);
 	return 0;
 }
 
@@ -367,6 +950,84 @@ file_open(const char *path, struct File **pf)
 	return walk_path(path, 0, pf, 0);
 }
 
+// Sequential read detection.  Each recently read file remembers where
+// its last read ended.  A read that starts there is sequential and
+// doubles the read-ahead window, up to one full ide_read; any other
+// read closes the window again.
+#define NREADAHEAD	8
+#define RA_MINBLOCKS	2
+
+struct Readahead {
+	struct File *ra_file;
+	off_t ra_pos;		// where a sequential read would start
+	uint32_t ra_window;	// blocks to read past the request
+	uint32_t ra_stamp;	// last use, for replacement
+};
+
+static struct Readahead ratab[NREADAHEAD];
+static uint32_t ra_clock;
+
+// Find the read-ahead state of f, recycling the least recently used
+// entry if f has none.
+static struct Readahead*
+readahead_lookup(struct File *f)
+{
+	struct Readahead *ra, *lru;
+
+	lru = &ratab[0];
+	for (ra = ratab; ra < ratab + NREADAHEAD; ra++) {
+		if (ra->ra_file == f)
+			goto out;
+		if (ra->ra_stamp < lru->ra_stamp)
+			lru = ra;
+	}
+	ra = lru;
+	ra->ra_file = f;
+	ra->ra_pos = 0;
+	ra->ra_window = 0;
+out:
+	ra->ra_stamp = ++ra_clock;
+	return ra;
+}
+
+// The read-ahead window a read of f at offset would get.
+static uint32_t
+readahead_window(struct Readahead *ra, off_t offset)
+{
+	if (offset == ra->ra_pos)
+		return MIN(MAX(ra->ra_window * 2, RA_MINBLOCKS), BC_MAXIO);
+	return 0;
+}
+
+// Start reading file blocks [filebno, filebno+n) into the block cache,
+// one call to 'fill' per physically contiguous run.
+static void
+file_readahead(struct File *f, uint32_t filebno, uint32_t n,
+	       void (*fill)(uint32_t, uint32_t))
+{
+	uint32_t i, nblock, start, run, *pdiskbno;
+
+	nblock = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	if (filebno >= nblock)
+		return;
+	n = MIN(n, nblock - filebno);
+	start = run = 0;
+	for (i = 0; i < n; i++) {
+		if (file_block_walk(f, filebno + i, &pdiskbno, 0) < 0)
+			break;
+		if (run && *pdiskbno == start + run && run < BC_MAXIO) {
+			run++;
+			continue;
+		}
+		if (run)
+			fill(start, run);
+		start = *pdiskbno;
+		run = start != 0;
+	}
+	if (run)
+		fill(start, run);
+}
+
 // Read count bytes from f into buf, starting from seek position
 // offset.  This meant to mimic the standard pread function.
 // Returns the number of bytes read, < 0 on error.
@@ -376,11 +1037,24 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	int r, bn;
 	off_t pos;
 	char *blk;
+	uint32_t first;
+	struct Readahead *ra;
 
 	if (offset >= f->f_size)
 		return 0;
 
 	count = MIN(count, f->f_size - offset);
+	if (f->f_flags & FFLAG_INLINE) {
+		memmove(buf, f->f_inline + offset, count);
+		return count;
+	}
+
+	ra = readahead_lookup(f);
+	ra->ra_window = readahead_window(ra, offset);
+	ra->ra_pos = offset + count;
+	first = offset / BLKSIZE;
+	file_readahead(f, first, (offset + count - 1) / BLKSIZE - first + 1 + ra->ra_window,
+		       bc_readahead);
 
 	for (pos = offset; pos < offset + count; ) {
 		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
@@ -395,6 +1069,24 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 }
 
 
+// Bring in the blocks that file_read(f, buf, count, offset) would read,
+// read-ahead included, releasing fs_mu during the disk transfers so
+// that requests for cached data are not held up behind them.  f may
+// have changed by the time this returns, so callers must look up
+// anything they need again.
+void
+file_prefetch(struct File *f, off_t offset, size_t count)
+{
+	uint32_t first;
+
+	if (offset < 0 || offset >= f->f_size || count == 0)
+		return;
+	count = MIN(count, f->f_size - offset);
+	first = offset / BLKSIZE;
+	file_readahead(f, first, (offset + count - 1) / BLKSIZE - first + 1
+		       + readahead_window(readahead_lookup(f), offset), bc_fill);
+}
+
 // Write count bytes from buf into f, starting at seek position
 // offset.  This is meant to mimic the standard pwrite function.
 // Extends the file if necessary.
@@ -406,13 +1098,22 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset)
 	off_t pos;
 	char *blk;
 
-	// Extend file if necessary
+	// Extend file if necessary.  Unlike file_set_size this leaves f
+	// for the write-back daemon to flush.
+	if (offset < 0 || offset > MAXFILESIZE || count > MAXFILESIZE - offset)
+		return -E_INVAL;
+	if ((f->f_flags & FFLAG_INLINE) && offset + count <= FINLINE) {
+		memmove(f->f_inline + offset, buf, count);
+		f->f_size = MAX(f->f_size, offset + count);
+		return count;
+	}
+	if ((r = file_spill(f)) < 0)
+		return r;
 	if (offset + count > f->f_size)
-		if ((r = file_set_size(f, offset + count)) < 0)
-			return r;
+		f->f_size = offset + count;
 
 	for (pos = offset; pos < offset + count; ) {
-		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+		if ((r = file_write_block(f, pos / BLKSIZE, &blk)) < 0)
 			return r;
 		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
 		memmove(blk + pos % BLKSIZE, buf, bn);
@@ -423,80 +1124,230 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset)
 	return count;
 }
 
-// Remove a block from file f.  If it's not there, just silently succeed.
-// Returns 0 on success, < 0 on error.
-static int
-file_free_block(struct File *f, uint32_t filebno)
+// Make sure every block of f overlapping [offset, offset+len) has a
+// disk block, extending f if necessary.  Holes are filled with runs of
+// consecutive zero-filled blocks.
+// Returns 0 on success, < 0 on error.  On error f keeps its old size.
+int
+file_allocate(struct File *f, off_t offset, off_t len)
 {
-	int r;
-	uint32_t *ptr;
+	int r, blockno;
+	uint32_t bno, last, n, got, j, *pdiskbno;
+	off_t oldsize;
 
-	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+	if (offset < 0 || len <= 0 || offset > MAXFILESIZE || len > MAXFILESIZE - offset)
+		return -E_INVAL;
+	if ((r = file_spill(f)) < 0)
 		return r;
-	if (*ptr) {
-		free_block(*ptr);
-		*ptr = 0;
+	oldsize = f->f_size;
+	if (offset + len > f->f_size)
+		f->f_size = offset + len;
+
+	// Pending blocks in the range need disk blocks too.
+	delalloc_flush();
+	last = (offset + len - 1) / BLKSIZE + 1;
+	for (bno = offset / BLKSIZE; bno < last; bno += n) {
+		n = 1;
+		if ((r = file_block_walk(f, bno, &pdiskbno, 0)) == 0 && *pdiskbno)
+			continue;
+		if (r < 0 && r != -E_NOT_FOUND)
+			goto fail;
+		// Measure the hole starting at bno.
+		while (bno + n < last
+		       && ((r = file_block_walk(f, bno + n, &pdiskbno, 0)) == -E_NOT_FOUND
+			   || (r == 0 && *pdiskbno == 0)))
+			n++;
+		if ((r = blockno = alloc_run(file_alloc_hint(f, bno), n, &got)) < 0)
+			goto fail;
+		for (j = 0; j < got; j++) {
+			if ((r = file_block_walk(f, bno + j, &pdiskbno, 1)) < 0) {
+				free_run(blockno + j, got - j);
+				goto fail;
+			}
+			*pdiskbno = blockno + j;
+			bc_new_block(blockno + j);
+		}
+		n = got;
 	}
 	return 0;
+
+fail:
+	// Give back the blocks allocated past the old end of the file.
+	if (f->f_size > oldsize) {
+		file_truncate_blocks(f, oldsize);
+		f->f_size = oldsize;
+		free_runs_flush();
+	}
+	return r;
 }
 
-// Remove any blocks currently used by file 'f',
-// but not necessary for a file of size 'newsize'.
-// For both the old and new sizes, figure out the number of blocks required,
-// and then clear the blocks from new_nblocks to old_nblocks.
-// If the new_nblocks is no more than NDIRECT, and the indirect block has
-// been allocated (f->f_indirect != 0), then free the indirect block too.
-// (Remember to clear the f->f_indirect pointer so you'll know
-// whether it's valid!)
+// Queue the blocks ptrs[from, to) of an indirect block that are set
+// to be freed, clearing the pointers if the block itself is being kept.
+static void
+free_ptrs(uint32_t *ptrs, uint32_t from, uint32_t to, bool clear)
+{
+	for (; from < to; from++)
+		if (ptrs[from]) {
+			free_runs_add(ptrs[from]);
+			if (clear)
+				ptrs[from] = 0;
+		}
+}
+
+// Where n falls among the NINDIRECT file blocks from 'base' on,
+// as an index into the indirect block that maps them.
+static uint32_t
+indirect_span(uint32_t n, uint32_t base)
+{
+	return MIN(MAX(n, base), base + NINDIRECT) - base;
+}
+
+// Queue to be freed any blocks currently used by file 'f', but not
+// necessary for a file of size 'newsize'.  Each indirect block is read
+// once, and pointers are cleared only in blocks that stay.  Indirect
+// blocks that no longer map any block below new_nblocks are freed as
+// well.  The caller applies the result with free_runs_flush.
 // Do not change f->f_size.
 static void
 file_truncate_blocks(struct File *f, off_t newsize)
 {
-	int r;
-	uint32_t bno, old_nblocks, new_nblocks;
+	uint32_t i, base, old_nblocks, new_nblocks, *dindirect;
+	bool keep;
 
 	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
 	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
-	for (bno = new_nblocks; bno < old_nblocks; bno++)
-		if ((r = file_free_block(f, bno)) < 0)
-			cprintf("warning: file_free_block: %e", r);
+	delalloc_drop(f, new_nblocks);
+	// struct File is packed, so f_direct is indexed in place rather
+	// than handed to free_ptrs.
+	for (i = new_nblocks; i < MIN(old_nblocks, NDIRECT); i++)
+		if (f->f_direct[i]) {
+			free_runs_add(f->f_direct[i]);
+			f->f_direct[i] = 0;
+		}
 
-	if (new_nblocks <= NDIRECT && f->f_indirect) {
-		free_block(f->f_indirect);
-		f->f_indirect = 0;
+	if (f->f_indirect) {
+		keep = new_nblocks > NDIRECT;
+		if (old_nblocks > NDIRECT && new_nblocks < NDIRECT + NINDIRECT)
+			free_ptrs(diskaddr(f->f_indirect),
+				  indirect_span(new_nblocks, NDIRECT),
+				  indirect_span(old_nblocks, NDIRECT), keep);
+		if (!keep) {
+			free_runs_add(f->f_indirect);
+			f->f_indirect = 0;
+		}
+	}
+	if (!f->f_dindirect)
+		return;
+	// Indirect block i under f_dindirect maps file blocks from
+	// NDIRECT + NINDIRECT + i * NINDIRECT on.
+	dindirect = diskaddr(f->f_dindirect);
+	for (i = 0; i < NINDIRECT; i++) {
+		base = NDIRECT + NINDIRECT + i * NINDIRECT;
+		if (!dindirect[i])
+			continue;
+		keep = new_nblocks > base;
+		if (old_nblocks > base && new_nblocks < base + NINDIRECT)
+			free_ptrs(diskaddr(dindirect[i]), indirect_span(new_nblocks, base),
+				  indirect_span(old_nblocks, base), keep);
+		if (!keep) {
+			free_runs_add(dindirect[i]);
+			if (new_nblocks > NDIRECT + NINDIRECT)
+				dindirect[i] = 0;
+		}
+	}
+	if (new_nblocks <= NDIRECT + NINDIRECT) {
+		free_runs_add(f->f_dindirect);
+		f->f_dindirect = 0;
 	}
 }
 
 // Set the size of file f, truncating or extending as necessary.
+// A regular file truncated to nothing keeps its data inline again.
 int
 file_set_size(struct File *f, off_t newsize)
 {
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+		return -E_INVAL;
+	if (f->f_flags & FFLAG_INLINE) {
+		if (newsize > FINLINE && (r = file_spill(f)) < 0)
+			return r;
+		if (newsize < f->f_size)
+			memset(f->f_inline + newsize, 0, f->f_size - newsize);
+	}
 	if (f->f_size > newsize)
 		file_truncate_blocks(f, newsize);
 	f->f_size = newsize;
+	if (newsize == 0 && f->f_type == FTYPE_REG)
+		f->f_flags |= FFLAG_INLINE;
+	// The file stops pointing at its old blocks on disk before the
+	// bitmap says they are free.
 	flush_block(f);
+	free_runs_flush();
 	return 0;
 }
 
-// Flush the contents and metadata of file f out to disk.
-// Loop over all the blocks in file.
-// Translate the file block number into a disk block number
-// and then check whether that disk block is dirty.  If so, write it out.
-void
-file_flush(struct File *f)
+// Is directory dir free of entries?  Returns 1 if so, 0 if not,
+// < 0 on error.
+static int
+dir_is_empty(struct File *dir)
 {
-	int i;
-	uint32_t *pdiskbno;
+	uint32_t entno;
+	struct File *f;
+	int r;
 
-	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
-		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-		    pdiskbno == NULL || *pdiskbno == 0)
-			continue;
-		flush_block(diskaddr(*pdiskbno));
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+			return r;
+		if (f->f_name[0] != '\0')
+			return 0;
 	}
+	return 1;
+}
+
+// Remove "path", freeing its blocks in one batch as truncation does.
+// A directory must be empty.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if path does not exist.
+//	-E_BAD_PATH if path is the root.
+//	-E_NOT_SUPP if path is a directory with entries in it.
+int
+file_remove(const char *path)
+{
+	struct File *dir, *f;
+	struct DirIndex *di;
+	int r;
+
+	if ((r = walk_path(path, &dir, &f, 0)) < 0)
+		return r;
+	if (!dir)
+		return -E_BAD_PATH;
+	if (f->f_type == FTYPE_DIR && (r = dir_is_empty(f)) <= 0)
+		return r < 0 ? r : -E_NOT_SUPP;
+
+	dcache_invalidate(dir, f->f_name);
+	if ((di = dir_index(dir)) != 0
+	    && (r = dir_index_remove(dir, di, f)) >= 0)
+		di->di_free = MIN(di->di_free, (uint32_t) r);
+	file_truncate_blocks(f, 0);
+	if (f->f_dirindex)
+		free_runs_add(f->f_dirindex);
+	memset(f, 0, sizeof *f);
 	flush_block(f);
-	if (f->f_indirect)
-		flush_block(diskaddr(f->f_indirect));
+	free_runs_flush();
+	return 0;
+}
+
+// Flush the contents and metadata of file f out to disk.
+// The block cache tracks dirty blocks itself, so rather than walking
+// every block of f this writes back everything that is dirty, which
+// costs O(dirty) and lets f's blocks be clustered with their
+// neighbours.
+void
+file_flush(struct File *f)
+{
+	fs_sync();
 }
 
 
@@ -504,8 +1355,27 @@ file_flush(struct File *f)
 void
 fs_sync(void)
 {
-	int i;
-	for (i = 1; i < super->s_nblocks; i++)
-		flush_block(diskaddr(i));
+	delalloc_flush();
+	bc_sync();
+}
+
+// Write back whatever has been dirty for at least 'age' msec, or
+// everything if age is 0.  Delayed blocks get their disk blocks first
+// so that they are written back along with the rest.
+// Returns the number of blocks written.
+uint32_t
+fs_writeback(uint32_t age)
+{
+	if (ndelayed > 0 && (age == 0 || ndelayed > NDELAYED / 2
+			     || sys_time_msec() - delayed_since >= age))
+		delalloc_flush();
+	return bc_writeback(age);
+}
+
+// Return the number of blocks waiting to be written back.
+uint32_t
+fs_ndirty_blocks(void)
+{
+	return bc_ndirty_blocks() + ndelayed;
 }
 
@@ -11,21 +11,127 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE	0xC0000000
 
+/* Block cache budget, in blocks: the default, and the range accepted by
+ * bc_set_budget.  The minimum leaves room for the pinned super block and
+ * bitmap of a full-size disk. */
+#define BC_NBLOCKS	256
+#define BC_MINBLOCKS	32
+#define BC_MAXBLOCKS	4096
+
+/* Blocks written without a disk block yet are kept in pages from
+ * DELAYMAP on until write-back; at most NDELAYED of them. */
+#define DELAYMAP	0xE0000000
+#define NDELAYED	1024
+
+/* bc_fill reads disk blocks into NWORKERS slots of BC_MAXIO scratch
+ * pages from FILLMAP on before moving them into the cache. */
+#define FILLMAP		(DELAYMAP + NDELAYED * BLKSIZE)
+
+/* Threads serving client requests */
+#define NWORKERS	4
+
+/* Large reads and writes map the client's buffer into one of NWORKERS
+ * windows of BULKSLOT bytes from BULKMAP on. */
+#define BULKMAP		(FILLMAP + NWORKERS * BC_MAXIO * BLKSIZE)
+#define BULKSLOT	(FSBULK_MAX + PGSIZE)
+
+/* Each virtio-blk device's queue sits in up to VRINGSLOT bytes of
+ * physically contiguous pages from VRINGMAP on. */
+#define VRINGMAP	(BULKMAP + NWORKERS * BULKSLOT)
+#define VRINGSLOT	(8 * PGSIZE)
+
+/* Number of directory entry cache slots */
+#define NDCACHE		256
+
+/* The write-back daemon wakes up every WB_INTERVAL msec and writes back
+ * blocks that have been dirty for WB_AGE msec, or everything once more
+ * than WB_HIWAT blocks are dirty. */
+#define WB_INTERVAL	1000
+#define WB_AGE		3000
+#define WB_HIWAT	(BC_NBLOCKS / 4)
+
+/* Most blocks one bdev_read or bdev_write can transfer */
+#define BC_MAXIO	(256 / BLKSECTS)
+
+/* The I/O queue holds up to IOQ_MAX requests.  Each should be
+ * dispatched within its deadline, in msec, and writes wait behind at
+ * most IOQ_WRITE_STARVE read transfers in a row. */
+#define IOQ_MAX			64
+#define IOQ_READ_EXPIRE		50
+#define IOQ_WRITE_EXPIRE	500
+#define IOQ_WRITE_STARVE	2
+
 struct Super *super;		// superblock
 uint32_t *bitmap;		// bitmap blocks mapped in memory
 
+/* A transfer to or from one disk */
+struct DiskReq {
+	int dr_disk;		// disk number, within its driver
+	uint32_t dr_secno;	// first sector
+	void *dr_buf;
+	size_t dr_nsecs;	// at most 256
+	bool dr_write;
+};
+
+/* A disk driver, for bdev.c */
+struct DiskDriver {
+	const char *dd_name;
+	bool (*dd_probe)(int d);
+	// Run the n transfers in reqs, consuming dr_buf and dr_nsecs.
+	// Returns 0 on success, -1 if any transfer failed.
+	int (*dd_rw)(struct DiskReq *reqs, int n);
+};
+
 /* ide.c */
-bool	ide_probe_disk1(void);
-void	ide_set_disk(int diskno);
-void	ide_set_partition(uint32_t first_sect, uint32_t nsect);
-int	ide_read(uint32_t secno, void *dst, size_t nsecs);
-int	ide_write(uint32_t secno, const void *src, size_t nsecs);
+extern struct DiskDriver ide_driver;
+void	ide_init(void);
+bool	ide_probe_disk(int d);
+int	ide_rw(struct DiskReq *reqs, int n);
+int	ide_read(int d, uint32_t secno, void *dst, size_t nsecs);
+int	ide_write(int d, uint32_t secno, const void *src, size_t nsecs);
+
+/* virtio.c */
+extern struct DiskDriver virtio_driver;
+int	virtio_init(void);
+
+/* bdev.c */
+void	bdev_init(struct DiskDriver *drv, int disk);
+void	bdev_stripe(const struct Super *s);
+int	bdev_read(uint32_t blockno, void *dst, uint32_t nblocks);
+int	bdev_write(uint32_t blockno, const void *src, uint32_t nblocks);
+
+/* ioq.c */
+struct IoReq {
+	uint32_t io_blockno;
+	uint32_t io_nblocks;		// at most BC_MAXIO
+	void *io_buf;
+	bool io_write;
+	uint32_t io_deadline;		// sys_time_msec to dispatch by
+	bool io_done;
+	int io_result;			// once io_done
+};
+void	ioq_submit(struct IoReq *q, uint32_t blockno, void *buf,
+		   uint32_t nblocks, bool write);
+int	ioq_wait(struct IoReq *q);
+int	ioq_read(uint32_t blockno, void *dst, uint32_t nblocks);
+int	ioq_write(uint32_t blockno, const void *src, uint32_t nblocks);
+void	ioq_get_stat(struct BcStat *st);
 
 /* bc.c */
 void*	diskaddr(uint32_t blockno);
 bool	va_is_mapped(void *va);
 bool	va_is_dirty(void *va);
 void	flush_block(void *addr);
+int	bc_set_budget(uint32_t nblocks);
+void	bc_readahead(uint32_t blockno, uint32_t nblocks);
+void	bc_fill(uint32_t blockno, uint32_t nblocks);
+void	bc_adopt(uint32_t blockno, void *va, uint32_t stamp);
+void	bc_new_block(uint32_t blockno);
+void	bc_discard(uint32_t blockno, uint32_t n);
+uint32_t bc_writeback(uint32_t age);
+void	bc_sync(void);
+uint32_t bc_ndirty_blocks(void);
+void	bc_get_stat(struct BcStat *st);
 void	bc_init(void);
 
 /* fs.c */
@@ -34,16 +140,31 @@ int	file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
 int	file_create(const char *path, struct File **f);
 int	file_open(const char *path, struct File **f);
 ssize_t	file_read(struct File *f, void *buf, size_t count, off_t offset);
+void	file_prefetch(struct File *f, off_t offset, size_t count);
 int	file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int	file_set_size(struct File *f, off_t newsize);
 void	file_flush(struct File *f);
+int	file_allocate(struct File *f, off_t offset, off_t len);
 int	file_remove(const char *path);
 void	fs_sync(void);
+uint32_t fs_writeback(uint32_t age);
+uint32_t fs_ndirty_blocks(void);
+void	delalloc_flush(void);
 
 /* int	map_block(uint32_t); */
 bool	block_is_free(uint32_t blockno);
 int	alloc_block(void);
 
+/* dcache.c */
+bool	dcache_lookup(struct File *dir, const char *name, struct File **pf);
+void	dcache_enter(struct File *dir, const char *name, struct File *f);
+void	dcache_invalidate(struct File *dir, const char *name);
+
+/* writeback.c */
+extern struct mutex fs_mu;
+void	wb_init(void);
+void	wb_kick(void);
+
 /* test.c */
 void	fs_test(void);
 
@@ -32,6 +32,8 @@ typedef int bool;
 #include <inc/fs.h>
 
 #define ROUNDUP(n, v) ((n) - 1 + (v) - ((n) - 1) % (v))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define DISKSIZE 0xC0000000	// as in fs/fs.h
 #define MAX_DIR_ENTS 128
 
 struct Dir
@@ -42,6 +44,8 @@ struct Dir
 };
 
 uint32_t nblocks;
+const char *disknames[FS_MAXDISKS];	// images, in stripe order
+uint32_t ndisks, stripe;
 char *diskmap, *diskpos;
 struct Super *super;
 uint32_t *bitmap;
@@ -88,23 +92,16 @@ alloc(uint32_t bytes)
 	return start;
 }
 
+// Build the file system in memory; finishdisk splits it among the
+// images.
 void
-opendisk(const char *name)
+opendisk(void)
 {
-	int r, diskfd, nbitblocks;
-
-	if ((diskfd = open(name, O_RDWR | O_CREAT, 0666)) < 0)
-		panic("open %s: %s", name, strerror(errno));
-
-	if ((r = ftruncate(diskfd, 0)) < 0
-	    || (r = ftruncate(diskfd, nblocks * BLKSIZE)) < 0)
-		panic("truncate %s: %s", name, strerror(errno));
+	int nbitblocks;
 
 	if ((diskmap = mmap(NULL, nblocks * BLKSIZE, PROT_READ|PROT_WRITE,
-			    MAP_SHARED, diskfd, 0)) == MAP_FAILED)
-		panic("mmap %s: %s", name, strerror(errno));
-
-	close(diskfd);
+			    MAP_PRIVATE|MAP_ANONYMOUS, -1, 0)) == MAP_FAILED)
+		panic("mmap: %s", strerror(errno));
 
 	diskpos = diskmap;
 	alloc(BLKSIZE);
@@ -113,45 +110,79 @@ opendisk(const char *name)
 	super->s_nblocks = nblocks;
 	super->s_root.f_type = FTYPE_DIR;
 	strcpy(super->s_root.f_name, "/");
+	if (ndisks > 1) {
+		super->s_ndisks = ndisks;
+		super->s_stripe = stripe;
+	}
 
 	nbitblocks = (nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
 	bitmap = alloc(nbitblocks * BLKSIZE);
 	memset(bitmap, 0xFF, nbitblocks * BLKSIZE);
 }
 
+// Write stripe unit u of the file system to each image in turn, as
+// unit u / ndisks of image u % ndisks.
 void
 finishdisk(void)
 {
-	int r, i;
+	int i, diskfd;
+	uint32_t d, u, nunits, n;
+	off_t size;
 
 	for (i = 0; i < blockof(diskpos); ++i)
 		bitmap[i/32] &= ~(1<<(i%32));
 
-	if ((r = msync(diskmap, nblocks * BLKSIZE, MS_SYNC)) < 0)
-		panic("msync: %s", strerror(errno));
+	nunits = (nblocks + stripe - 1) / stripe;
+	for (d = 0; d < ndisks; d++) {
+		if ((diskfd = open(disknames[d], O_RDWR | O_CREAT, 0666)) < 0)
+			panic("open %s: %s", disknames[d], strerror(errno));
+		size = MIN(nblocks, (nunits + ndisks - 1) / ndisks * stripe) * BLKSIZE;
+		if (ftruncate(diskfd, 0) < 0 || ftruncate(diskfd, size) < 0)
+			panic("truncate %s: %s", disknames[d], strerror(errno));
+		for (u = d; u < nunits; u += ndisks) {
+			n = MIN(stripe, nblocks - u * stripe) * BLKSIZE;
+			if (pwrite(diskfd, diskmap + u * stripe * BLKSIZE, n,
+				   u / ndisks * stripe * BLKSIZE) != (ssize_t) n)
+				panic("write %s: %s", disknames[d], strerror(errno));
+		}
+		close(diskfd);
+	}
 }
 
 void
 finishfile(struct File *f, uint32_t start, uint32_t len)
 {
-	int i;
+	int i, j;
+	uint32_t *ind, *dind;
+
 	f->f_size = len;
 	len = ROUNDUP(len, BLKSIZE);
 	for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
 		f->f_direct[i] = start + i;
-	if (i == NDIRECT) {
-		uint32_t *ind = alloc(BLKSIZE);
+	if (i < len / BLKSIZE) {
+		ind = alloc(BLKSIZE);
 		f->f_indirect = blockof(ind);
-		for (; i < len / BLKSIZE; ++i)
+		for (; i < len / BLKSIZE && i < NDIRECT + NINDIRECT; ++i)
 			ind[i - NDIRECT] = start + i;
 	}
+	if (i < len / BLKSIZE) {
+		dind = alloc(BLKSIZE);
+		f->f_dindirect = blockof(dind);
+		for (j = 0; i < len / BLKSIZE; ++i, ++j) {
+			if (j % NINDIRECT == 0) {
+				ind = alloc(BLKSIZE);
+				dind[j / NINDIRECT] = blockof(ind);
+			}
+			ind[j % NINDIRECT] = start + i;
+		}
+	}
 }
 
 void
 startdir(struct File *f, struct Dir *dout)
 {
 	dout->f = f;
-	dout->ents = malloc(MAX_DIR_ENTS * sizeof *dout->ents);
+	dout->ents = calloc(MAX_DIR_ENTS, sizeof *dout->ents);
 	dout->n = 0;
 }
 
@@ -169,10 +200,25 @@ diradd(struct Dir *d, uint32_t type, const char *name)
 void
 finishdir(struct Dir *d)
 {
-	int size = d->n * sizeof(struct File);
+	int i, size = d->n * sizeof(struct File);
 	struct File *start = alloc(size);
+	struct DirIndex *di = alloc(BLKSIZE);
+	uint32_t h;
+
 	memmove(start, d->ents, size);
 	finishfile(d->f, blockof(start), ROUNDUP(size, BLKSIZE));
+
+	// Chain every entry into a fresh hash index
+	memset(di, 0, BLKSIZE);
+	di->di_magic = DIRINDEX_MAGIC;
+	di->di_free = d->n;
+	for (i = 0; i < d->n; i++) {
+		h = dir_hash(start[i].f_name);
+		start[i].f_hnext = di->di_bucket[h];
+		di->di_bucket[h] = i + 1;
+	}
+	d->f->f_dirindex = blockof(di);
+
 	free(d->ents);
 	d->ents = NULL;
 }
@@ -202,16 +248,24 @@ writefile(struct Dir *dir, const char *name)
 		last = name;
 
 	f = diradd(dir, FTYPE_REG, last);
-	start = alloc(st.st_size);
-	readn(fd, start, st.st_size);
-	finishfile(f, blockof(start), st.st_size);
+	if (st.st_size <= FINLINE) {
+		// Small enough to live in the File itself
+		readn(fd, f->f_inline, st.st_size);
+		f->f_size = st.st_size;
+		f->f_flags = FFLAG_INLINE;
+	} else {
+		start = alloc(st.st_size);
+		readn(fd, start, st.st_size);
+		finishfile(f, blockof(start), st.st_size);
+	}
 	close(fd);
 }
 
 void
 usage(void)
 {
-	fprintf(stderr, "Usage: fsformat fs.img NBLOCKS files...\n");
+	fprintf(stderr, "Usage: fsformat [-s STRIPE] [-d disk.img]... fs.img NBLOCKS files...\n"
+		"  -d adds an image to stripe across, STRIPE blocks at a time\n");
 	exit(2);
 }
 
@@ -224,14 +278,29 @@ main(int argc, char **argv)
 
 	assert(BLKSIZE % sizeof(struct File) == 0);
 
+	ndisks = 1;
+	stripe = 8;
+	for (; argc > 2 && argv[1][0] == '-'; argc -= 2, argv += 2) {
+		if (strcmp(argv[1], "-s") == 0) {
+			stripe = strtol(argv[2], &s, 0);
+			if (*s || s == argv[2] || stripe < 2)
+				usage();
+		} else if (strcmp(argv[1], "-d") == 0 && ndisks < FS_MAXDISKS)
+			disknames[ndisks++] = argv[2];
+		else
+			usage();
+	}
 	if (argc < 3)
 		usage();
+	disknames[0] = argv[1];
 
 	nblocks = strtol(argv[2], &s, 0);
-	if (*s || s == argv[2] || nblocks < 2 || nblocks > 1024)
+	if (*s || s == argv[2] || nblocks < 2 || nblocks > DISKSIZE / BLKSIZE)
 		usage();
+	if (ndisks == 1)
+		stripe = nblocks;
 
-	opendisk(argv[1]);
+	opendisk();
 
 	startdir(&super->s_root, &root);
 	for (i = 3; i < argc; i++)
@@ -1,7 +1,16 @@
 /*
- * Minimal PIO-based (non-interrupt-driven) IDE driver code.
+ * IDE driver code.
  * For information about what all this IDE/ATA magic means,
  * see the materials available on the class references page.
+ *
+ * When the kernel found a PCI bus-master IDE controller (a PIIX), the
+ * drives move data by DMA and the file server sleeps until the transfer
+ * completes, woken by the kernel at each disk interrupt.  Otherwise, or
+ * for a buffer DMA cannot reach, the driver falls back on polled PIO.
+ *
+ * Disks are numbered like QEMU's drive indexes: disks 0 and 1 are the
+ * master and slave on the primary channel, disks 2 and 3 on the
+ * secondary channel.
  */
 
 #include "fs.h"
@@ -10,16 +19,90 @@
 #define IDE_BSY		0x80
 #define IDE_DRDY	0x40
 #define IDE_DF		0x20
+#define IDE_DRQ		0x08
 #define IDE_ERR		0x01
 
-static int diskno = 1;
+// Bus-master registers, from a channel's ic_bmbase
+#define BM_CMD		0
+#define BM_STATUS	2
+#define BM_PRDT		4
+#define BM_CMD_START	0x01
+#define BM_CMD_READ	0x08	// device to memory
+#define BM_STATUS_ERR	0x02
+#define BM_STATUS_INTR	0x04
+
+#define NCHANNELS	2
+#define NPRD		64
+#define IDE_TIMEOUT	100	// ms to sleep before polling anyway
+
+// Physical region descriptor: one piece of a DMA transfer.
+struct Prd {
+	uint32_t prd_addr;
+	uint16_t prd_len;	// bytes; must not cross 64KB
+	uint16_t prd_flags;
+};
+#define PRD_EOT		0x8000	// last descriptor
+
+struct IdeChannel {
+	uint16_t ic_base;	// command block registers
+	uint16_t ic_bmbase;	// bus-master registers, or 0 for PIO only
+	bool ic_dma;		// the running request uses DMA
+	// File server threads may use the disks without holding fs_mu;
+	// this keeps their commands from interleaving on the channel.
+	struct mutex ic_mu;
+};
+
+static struct IdeChannel channels[NCHANNELS] = {
+	{ .ic_base = 0x1F0 },
+	{ .ic_base = 0x170 },
+};
+
+static struct Prd prdt[NCHANNELS][NPRD] __attribute__((aligned(NPRD * sizeof(struct Prd))));
+
+// Bumped by the kernel at each interrupt from either channel.
+static volatile uint32_t ide_nintr;
+
+static struct IdeChannel*
+disk_channel(int d)
+{
+	return &channels[d / 2];
+}
+
+static physaddr_t
+va2pa(const void *va)
+{
+	return PTE_ADDR(uvpt[PGNUM(va)]) | PGOFF(va);
+}
+
+// Look for a bus-master IDE controller and, if there is one, ask for
+// its interrupts and switch both channels to DMA.
+void
+ide_init(void)
+{
+	struct PciDev pd;
+	int i;
+
+	for (i = 0; sys_pci_storage(i, &pd) == 0; i++)
+		if (PCIDEV_CLASS(&pd) == PCIDEV_CLASS_STORAGE
+		    && PCIDEV_SUBCLASS(&pd) == PCIDEV_SUBCLASS_IDE
+		    && pd.pd_base[4] && pd.pd_size[4] >= 16)
+			break;
+	if (sys_pci_storage(i, &pd) < 0)
+		return;
+	if (sys_irq_listen(IRQ_IDE, &ide_nintr) < 0
+	    || sys_irq_listen(IRQ_IDE2, &ide_nintr) < 0)
+		return;
+	channels[0].ic_bmbase = pd.pd_base[4];
+	channels[1].ic_bmbase = pd.pd_base[4] + 8;
+	cprintf("IDE: bus-master DMA at 0x%x\n", pd.pd_base[4]);
+}
 
 static int
-ide_wait_ready(bool check_error)
+ide_wait_ready(struct IdeChannel *c, bool check_error)
 {
 	int r;
 
-	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+	while (((r = inb(c->ic_base + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
 		/* do nothing */;
 
 	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
@@ -28,85 +111,226 @@ ide_wait_ready(bool check_error)
 }
 
 bool
-ide_probe_disk1(void)
+ide_probe_disk(int d)
 {
+	struct IdeChannel *c;
 	int r, x;
 
-	// wait for Device 0 to be ready
-	ide_wait_ready(0);
+	if (d < 0 || d >= 2 * NCHANNELS)
+		return 0;
+	c = disk_channel(d);
 
-	// switch to Device 1
-	outb(0x1F6, 0xE0 | (1<<4));
+	// switch to Device d
+	outb(c->ic_base + 6, 0xE0 | ((d&1)<<4));
 
-	// check for Device 1 to be ready for a while
+	// check for Device d to be ready for a while.  A missing device
+	// never shows DRDY, and an empty channel floats to 0xFF.
 	for (x = 0;
-	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+	     x < 1000 && ((r = inb(c->ic_base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
 	     x++)
 		/* do nothing */;
 
 	// switch back to Device 0
-	outb(0x1F6, 0xE0 | (0<<4));
+	outb(c->ic_base + 6, 0xE0 | (0<<4));
 
-	cprintf("Device 1 presence: %d\n", (x < 1000));
+	cprintf("Device %d presence: %d\n", d, (x < 1000));
 	return (x < 1000);
 }
 
-void
-ide_set_disk(int d)
+// Describe q's buffer in c's PRD table, one descriptor per page.
+// Returns 0 if DMA can't reach the buffer: it is misaligned, or a
+// page is missing or (for a read) not writable, say copy-on-write.
+static bool
+ide_dma_prepare(struct IdeChannel *c, struct DiskReq *q)
 {
-	if (d != 0 && d != 1)
-		panic("bad disk number");
-	diskno = d;
-}
+	struct Prd *prd = prdt[c - channels];
+	uintptr_t va = (uintptr_t) q->dr_buf;
+	size_t left = q->dr_nsecs * SECTSIZE, n;
+	pte_t pte;
+	int i;
 
+	if (!c->ic_bmbase || va % 2)
+		return 0;
+	for (i = 0; left > 0; i++) {
+		assert(i < NPRD);
+		if (!(uvpd[PDX(va)] & PTE_P))
+			return 0;
+		pte = uvpt[PGNUM(va)];
+		if (!(pte & PTE_P) || (!q->dr_write && !(pte & PTE_W)))
+			return 0;
+		n = MIN(PGSIZE - PGOFF(va), left);
+		prd[i].prd_addr = PTE_ADDR(pte) | PGOFF(va);
+		prd[i].prd_len = n;
+		prd[i].prd_flags = 0;
+		va += n;
+		left -= n;
+	}
+	prd[i - 1].prd_flags = PRD_EOT;
+	return 1;
+}
 
-int
-ide_read(uint32_t secno, void *dst, size_t nsecs)
+static void
+ide_start(struct DiskReq *q)
 {
-	int r;
+	struct IdeChannel *c = disk_channel(q->dr_disk);
+	int cmd;
 
-	assert(nsecs <= 256);
+	assert(q->dr_nsecs <= 256);
+	c->ic_dma = ide_dma_prepare(c, q);
+	ide_wait_ready(c, 0);
 
-	ide_wait_ready(0);
+	if (c->ic_dma) {
+		outb(c->ic_bmbase + BM_CMD, 0);
+		outl(c->ic_bmbase + BM_PRDT, va2pa(prdt[c - channels]));
+		outb(c->ic_bmbase + BM_STATUS,
+		     inb(c->ic_bmbase + BM_STATUS) | BM_STATUS_INTR | BM_STATUS_ERR);
+	}
 
-	outb(0x1F2, nsecs);
-	outb(0x1F3, secno & 0xFF);
-	outb(0x1F4, (secno >> 8) & 0xFF);
-	outb(0x1F5, (secno >> 16) & 0xFF);
-	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+	outb(c->ic_base + 2, q->dr_nsecs);
+	outb(c->ic_base + 3, q->dr_secno & 0xFF);
+	outb(c->ic_base + 4, (q->dr_secno >> 8) & 0xFF);
+	outb(c->ic_base + 5, (q->dr_secno >> 16) & 0xFF);
+	outb(c->ic_base + 6, 0xE0 | ((q->dr_disk&1)<<4) | ((q->dr_secno>>24)&0x0F));
+	// CMD 0x30 means write sector, 0x20 read sector;
+	// 0xCA and 0xC8 are their DMA forms.
+	if (c->ic_dma)
+		cmd = q->dr_write ? 0xCA : 0xC8;
+	else
+		cmd = q->dr_write ? 0x30 : 0x20;
+	outb(c->ic_base + 7, cmd);
+	if (c->ic_dma)
+		outb(c->ic_bmbase + BM_CMD,
+		     BM_CMD_START | (q->dr_write ? 0 : BM_CMD_READ));
+}
 
-	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
-		if ((r = ide_wait_ready(1)) < 0)
-			return r;
-		insl(0x1F0, dst, SECTSIZE/4);
-	}
+// Finish q's DMA transfer if the controller says it is done.
+static int
+ide_dma_step(struct IdeChannel *c, struct DiskReq *q)
+{
+	int s, bs;
+
+	bs = inb(c->ic_bmbase + BM_STATUS);
+	if (!(bs & BM_STATUS_INTR))
+		return 0;
+	// Reading the drive's status also acknowledges its interrupt.
+	s = inb(c->ic_base + 7);
+	if (s & IDE_BSY)
+		return 0;
+	outb(c->ic_bmbase + BM_CMD, 0);
+	outb(c->ic_bmbase + BM_STATUS, bs | BM_STATUS_INTR | BM_STATUS_ERR);
+	if ((bs & BM_STATUS_ERR) || (s & (IDE_DF|IDE_ERR)))
+		return -1;
+	q->dr_buf += q->dr_nsecs * SECTSIZE;
+	q->dr_nsecs = 0;
+	return 1;
+}
+
+// Move the next sector of q if the drive is ready for it, or for a
+// DMA request, finish it if it is done.
+// Returns 1 if data moved, 0 if the drive is still busy,
+// -1 if the command failed.
+static int
+ide_step(struct DiskReq *q)
+{
+	struct IdeChannel *c = disk_channel(q->dr_disk);
+	int s;
+
+	if (c->ic_dma)
+		return ide_dma_step(c, q);
+	s = inb(c->ic_base + 7);
+	if (s & IDE_BSY)
+		return 0;
+	if (s & (IDE_DF|IDE_ERR))
+		return -1;
+	if (!(s & IDE_DRQ))
+		return 0;
+	if (q->dr_write)
+		outsl(c->ic_base, q->dr_buf, SECTSIZE/4);
+	else
+		insl(c->ic_base, q->dr_buf, SECTSIZE/4);
+	q->dr_buf += SECTSIZE;
+	q->dr_nsecs--;
+	return 1;
+}
 
+// The first unfinished request in [q, end) on channel c.
+static struct DiskReq*
+ide_next(struct DiskReq *q, struct DiskReq *end, struct IdeChannel *c)
+{
+	for (; q < end; q++)
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+			return q;
 	return 0;
 }
 
+// Run the n transfers in reqs.  Requests on different channels run
+// side by side: each channel's command is started before any data
+// moves, so the drives seek and transfer at the same time.  Requests
+// on one channel run in order, so each channel's mutex queues the
+// threads that want it.  While only DMA transfers are in flight the
+// thread sleeps until the next disk interrupt.  Consumes dr_buf and
+// dr_nsecs.  Returns 0 on success, -1 if any transfer failed.
 int
-ide_write(uint32_t secno, const void *src, size_t nsecs)
+ide_rw(struct DiskReq *reqs, int n)
 {
-	int r;
+	struct DiskReq *cur[NCHANNELS] = { 0 };
+	bool used[NCHANNELS], busy, progress, polled;
+	uint32_t seen;
+	int i, r, s;
 
-	assert(nsecs <= 256);
+	for (i = 0; i < NCHANNELS; i++)
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+			mutex_lock(&channels[i].ic_mu);
 
-	ide_wait_ready(0);
+	r = 0;
+	do {
+		seen = ide_nintr;
+		busy = progress = polled = 0;
+		for (i = 0; i < NCHANNELS; i++) {
+			if (!cur[i]) {
+				if (!(cur[i] = ide_next(reqs, reqs + n, &channels[i])))
+					continue;
+				ide_start(cur[i]);
+			}
+			busy = 1;
+			polled |= !channels[i].ic_dma;
+			if ((s = ide_step(cur[i])) < 0) {
+				r = -1;
+				cur[i]->dr_nsecs = 0;
+			}
+			progress |= s != 0;
+			if (cur[i]->dr_nsecs == 0)
+				cur[i] = 0;
+		}
+		// An interrupt after 'seen' was read makes this return at once.
+		if (busy && !progress && !polled)
+			sys_futex_wait(&ide_nintr, seen, IDE_TIMEOUT);
+	} while (busy);
 
-	outb(0x1F2, nsecs);
-	outb(0x1F3, secno & 0xFF);
-	outb(0x1F4, (secno >> 8) & 0xFF);
-	outb(0x1F5, (secno >> 16) & 0xFF);
-	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+	for (i = 0; i < NCHANNELS; i++)
+		if (used[i])
+			mutex_unlock(&channels[i].ic_mu);
+	return r;
+}
 
-	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
-		if ((r = ide_wait_ready(1)) < 0)
-			return r;
-		outsl(0x1F0, src, SECTSIZE/4);
-	}
+struct DiskDriver ide_driver = {
+	.dd_name = "IDE",
+	.dd_probe = ide_probe_disk,
+	.dd_rw = ide_rw,
+};
 
-	return 0;
+int
+ide_read(int d, uint32_t secno, void *dst, size_t nsecs)
+{
+	struct DiskReq q = { d, secno, dst, nsecs, 0 };
+
+	return ide_rw(&q, 1);
 }
 
+int
+ide_write(int d, uint32_t secno, const void *src, size_t nsecs)
+{
+	struct DiskReq q = { d, secno, (void*) src, nsecs, 1 };
+
+	return ide_rw(&q, 1);
+}
@@ -0,0 +1,226 @@
+/*
+ * Block request queue: an elevator between the block cache and bdev.
+ *
+ * Callers queue requests and wait for them later, so that write-back
+ * can hand over all its runs at once and file server threads can read
+ * side by side.  Whichever waiter finds the disks idle dispatches for
+ * everyone.  It takes requests in ascending block order from where the
+ * last transfer ended, wrapping around at the end (C-LOOK).  Queued
+ * requests that continue one on the disk and in memory go out with it
+ * as one transfer.  Reads go before writes, but writes are passed over
+ * at most IOQ_WRITE_STARVE times in a row, and a request that has
+ * waited past its deadline goes next whatever its position.
+ */
+
+#include "fs.h"
+
+static struct mutex ioq_mu;
+static struct cond ioq_cond;		// a transfer finished
+static struct IoReq *ioq[IOQ_MAX];	// queued requests, in no order
+static uint32_t ioq_n;
+static bool ioq_busy;			// a transfer is in flight
+static uint32_t ioq_head;		// block after the last transfer
+static uint32_t ioq_write_skips;	// reads dispatched over queued writes
+static struct BcStat ioq_stat;
+
+static void ioq_step(void);
+
+// Queue q to transfer blocks [blockno, blockno+nblocks) to or from buf.
+// Returns at once unless the queue is full; ioq_wait waits for q.
+void
+ioq_submit(struct IoReq *q, uint32_t blockno, void *buf,
+	   uint32_t nblocks, bool write)
+{
+	assert(nblocks > 0 && nblocks <= BC_MAXIO);
+	q->io_blockno = blockno;
+	q->io_nblocks = nblocks;
+	q->io_buf = buf;
+	q->io_write = write;
+	q->io_deadline = sys_time_msec()
+		+ (write ? IOQ_WRITE_EXPIRE : IOQ_READ_EXPIRE);
+	q->io_done = 0;
+
+	mutex_lock(&ioq_mu);
+	while (ioq_n == IOQ_MAX)
+		ioq_step();
+	ioq[ioq_n++] = q;
+	ioq_stat.bs_ioqueued++;
+	ioq_stat.bs_iomaxdepth = MAX(ioq_stat.bs_iomaxdepth, ioq_n);
+	mutex_unlock(&ioq_mu);
+}
+
+// Choose the queued request to dispatch next.
+static uint32_t
+ioq_pick(void)
+{
+	uint32_t now, i, best;
+	bool reads, writes, write;
+
+	now = sys_time_msec();
+	best = ~0;
+	reads = writes = 0;
+	for (i = 0; i < ioq_n; i++) {
+		if ((int32_t) (now - ioq[i]->io_deadline) >= 0
+		    && (best == ~0
+			|| (int32_t) (ioq[i]->io_deadline - ioq[best]->io_deadline) < 0))
+			best = i;
+		if (ioq[i]->io_write)
+			writes = 1;
+		else
+			reads = 1;
+	}
+	if (best != ~0) {
+		ioq_stat.bs_ioexpired++;
+		if (ioq[best]->io_write)
+			ioq_write_skips = 0;
+		return best;
+	}
+
+	write = writes && (!reads || ioq_write_skips >= IOQ_WRITE_STARVE);
+	if (write)
+		ioq_write_skips = 0;
+	else if (writes)
+		ioq_write_skips++;
+	// Block numbers behind the head come out huge, and ascending.
+	for (i = 0; i < ioq_n; i++)
+		if (ioq[i]->io_write == write
+		    && (best == ~0
+			|| ioq[i]->io_blockno - ioq_head < ioq[best]->io_blockno - ioq_head))
+			best = i;
+	return best;
+}
+
+// Remove and return ioq[i].
+static struct IoReq*
+ioq_take(uint32_t i)
+{
+	struct IoReq *q = ioq[i];
+
+	ioq[i] = ioq[--ioq_n];
+	return q;
+}
+
+// Find a queued request that could join the transfer of 'nblocks'
+// blocks at 'blockno' from or to 'buf', just before it (front) or just
+// after it.  Returns its index, or ~0.
+static uint32_t
+ioq_find_merge(uint32_t blockno, char *buf, uint32_t nblocks,
+	       bool write, bool front)
+{
+	struct IoReq *q;
+	uint32_t i;
+
+	for (i = 0; i < ioq_n; i++) {
+		q = ioq[i];
+		if (q->io_write != write || nblocks + q->io_nblocks > BC_MAXIO)
+			continue;
+		if (front ? q->io_blockno + q->io_nblocks == blockno
+			    && (char *) q->io_buf + q->io_nblocks * BLKSIZE == buf
+			  : q->io_blockno == blockno + nblocks
+			    && q->io_buf == buf + nblocks * BLKSIZE)
+			return i;
+	}
+	return ~0;
+}
+
+// Dispatch the next transfer, releasing ioq_mu while the disks work.
+static void
+ioq_dispatch(void)
+{
+	struct IoReq *batch[BC_MAXIO], *q;
+	uint32_t i, nb, blockno, nblocks;
+	char *buf;
+	bool write;
+	int r;
+
+	q = ioq_take(ioq_pick());
+	batch[0] = q;
+	nb = 1;
+	blockno = q->io_blockno;
+	nblocks = q->io_nblocks;
+	buf = q->io_buf;
+	write = q->io_write;
+	while ((i = ioq_find_merge(blockno, buf, nblocks, write, 0)) != ~0) {
+		batch[nb++] = q = ioq_take(i);
+		nblocks += q->io_nblocks;
+		ioq_stat.bs_iomerged++;
+	}
+	while ((i = ioq_find_merge(blockno, buf, nblocks, write, 1)) != ~0) {
+		batch[nb++] = q = ioq_take(i);
+		blockno = q->io_blockno;
+		buf = q->io_buf;
+		nblocks += q->io_nblocks;
+		ioq_stat.bs_iomerged++;
+	}
+	ioq_stat.bs_iodispatched++;
+	ioq_head = blockno + nblocks;
+	ioq_busy = 1;
+
+	mutex_unlock(&ioq_mu);
+	if (write)
+		r = bdev_write(blockno, buf, nblocks);
+	else
+		r = bdev_read(blockno, buf, nblocks);
+	mutex_lock(&ioq_mu);
+
+	ioq_busy = 0;
+	for (i = 0; i < nb; i++) {
+		batch[i]->io_result = r;
+		batch[i]->io_done = 1;
+	}
+	cond_broadcast(&ioq_cond);
+}
+
+// Make progress, with ioq_mu held: dispatch the next transfer if the
+// disks are idle, else wait for the running one to finish.
+static void
+ioq_step(void)
+{
+	if (ioq_busy || ioq_n == 0)
+		cond_wait(&ioq_cond, &ioq_mu);
+	else
+		ioq_dispatch();
+}
+
+// Wait for q to finish.  Returns 0 on success, < 0 on error.
+int
+ioq_wait(struct IoReq *q)
+{
+	mutex_lock(&ioq_mu);
+	while (!q->io_done)
+		ioq_step();
+	mutex_unlock(&ioq_mu);
+	return q->io_result;
+}
+
+int
+ioq_read(uint32_t blockno, void *dst, uint32_t nblocks)
+{
+	struct IoReq q;
+
+	ioq_submit(&q, blockno, dst, nblocks, 0);
+	return ioq_wait(&q);
+}
+
+int
+ioq_write(uint32_t blockno, const void *src, uint32_t nblocks)
+{
+	struct IoReq q;
+
+	ioq_submit(&q, blockno, (void *) src, nblocks, 1);
+	return ioq_wait(&q);
+}
+
+// Fill in the queue counters of st.
+void
+ioq_get_stat(struct BcStat *st)
+{
+	mutex_lock(&ioq_mu);
+	st->bs_ioqueued = ioq_stat.bs_ioqueued;
+	st->bs_iomerged = ioq_stat.bs_iomerged;
+	st->bs_iodispatched = ioq_stat.bs_iodispatched;
+	st->bs_ioexpired = ioq_stat.bs_ioexpired;
+	st->bs_iodepth = ioq_n;
+	st->bs_iomaxdepth = ioq_stat.bs_iomaxdepth;
+	mutex_unlock(&ioq_mu);
+}
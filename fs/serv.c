@@ -51,9 +51,27 @@ struct OpenFile opentab[MAXOPEN] = {
 	{ 0, 0, 1, 0 }
 };
 
-// Virtual address at which to receive page mappings containing client requests.
+// Virtual address at which to receive page mappings containing client
+// requests.  Worker i receives its requests at fsreq - i.
 union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
 
+// Requests are received by the main thread and handed to NWORKERS
+// worker threads.  Handlers run under fs_mu, but a request that has to
+// wait for the disk lets go of it, so other workers can answer requests
+// from the cache meanwhile.
+struct Worker {
+	bool w_busy;		// has a request to serve
+	uint32_t w_req;
+	envid_t w_whom;
+	int w_perm;
+	union Fsipc *w_ipc;
+	struct cond w_cond;
+};
+
+static struct Worker workers[NWORKERS];
+static struct mutex workers_mu;
+static struct cond workers_idle;
+
 void
 serve_init(void)
 {
@@ -156,12 +174,6 @@ try_open:
 			return r;
 		}
 	}
-	if ((r = file_open(path, &f)) < 0) {
-		if (debug)
-			cprintf("file_open failed: %e", r);
-		return r;
-	}
-
 	// Save the file pointer
 	o->o_file = f;
 
@@ -206,50 +218,174 @@ serve_set_size(envid_t envid, struct Fsreq_set_size *req)
 	return file_set_size(o->o_file, req->req_size);
 }
 
+// Read at most n bytes of fileid into buf, starting at offset, or at
+// the seek position if offset is -1, in which case the seek position
+// is advanced past them.  Returns the number of bytes read, or < 0 on
+// error.
+static int
+serve_read_at(envid_t envid, int fileid, char *buf, size_t n, off_t offset)
+{
+	struct OpenFile *o;
+	size_t done, chunk;
+	int r;
+
+	// A read-ahead run at a time, so that a large read does not evict
+	// its own blocks before it gets to copy them.
+	for (done = 0; done < n; done += r) {
+		chunk = MIN(n - done, BC_MAXIO * BLKSIZE);
+		if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+			return r;
+		// Read any missing blocks without holding up other requests,
+		// then start over, since the file may have been closed or
+		// changed.
+		file_prefetch(o->o_file, offset < 0 ? o->o_fd->fd_offset : offset + done, chunk);
+		if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+			return r;
+		if ((r = file_read(o->o_file, buf + done, chunk,
+				   offset < 0 ? o->o_fd->fd_offset : offset + done)) < 0)
+			return r;
+		if (offset < 0)
+			o->o_fd->fd_offset += r;
+		if (r < chunk) {
+			done += r;
+			break;
+		}
+	}
+	return done;
+}
+
+// Write n bytes from buf to fileid, starting at offset, or at the seek
+// position if offset is -1, in which case the seek position is
+// advanced past them.  Extend the file if necessary.  Returns the
+// number of bytes written, or < 0 on error.
+static int
+serve_write_at(envid_t envid, int fileid, const void *buf, size_t n, off_t offset)
+{
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+		return r;
+	if ((r = file_write(o->o_file, buf, n, offset < 0 ? o->o_fd->fd_offset : offset)) < 0)
+		return r;
+	if (offset < 0)
+		o->o_fd->fd_offset += r;
+	return r;
+}
+
+// Windows for serve_bulk: bit i of bulk_busy is set while window i is
+// in use.  Only NWORKERS requests run at once, so one is always free.
+static uint32_t bulk_busy;
+
+// Read or write at most FSBULK_MAX bytes of fileid straight into or
+// out of envid's buffer at va, by mapping the buffer into a window,
+// as serve_read_at or serve_write_at would at 'offset'.  A buffer to
+// read into must be mapped writable, not copy-on-write.
+static int
+serve_bulk(envid_t envid, int fileid, uintptr_t va, size_t n, off_t offset,
+	   bool write)
+{
+	uint32_t slot, i, npages;
+	char *win;
+	int r;
+
+	n = MIN(n, FSBULK_MAX);
+	if (va >= UTOP || n > UTOP - va)
+		return -E_INVAL;
+	for (slot = 0; slot < NWORKERS; slot++)
+		if (!(bulk_busy & (1 << slot)))
+			break;
+	assert(slot < NWORKERS);
+	bulk_busy |= 1 << slot;
+	win = (char*) BULKMAP + slot * BULKSLOT;
+
+	npages = ROUNDUP(PGOFF(va) + n, PGSIZE) / PGSIZE;
+	for (i = 0; i < npages; i++)
+		if ((r = sys_page_map(envid, (void*) (ROUNDDOWN(va, PGSIZE) + i * PGSIZE),
+				      0, win + i * PGSIZE,
+				      write ? PTE_P|PTE_U : PTE_P|PTE_U|PTE_W)) < 0)
+			goto out;
+	if (write)
+		r = serve_write_at(envid, fileid, win + PGOFF(va), n, offset);
+	else
+		r = serve_read_at(envid, fileid, win + PGOFF(va), n, offset);
+out:
+	while (i-- > 0)
+		sys_page_unmap(0, win + i * PGSIZE);
+	bulk_busy &= ~(1 << slot);
+	return r;
+}
+
 // Read at most ipc->read.req_n bytes from the current seek position
 // in ipc->read.req_fileid.  Return the bytes read from the file to
-// the caller in ipc->readRet, then update the seek position.  Returns
-// the number of bytes successfully read, or < 0 on error.
+// the caller in ipc->readRet, or in its buffer at req_va if that is
+// not 0, then update the seek position.  Returns the number of bytes
+// successfully read, or < 0 on error.
 int
 serve_read(envid_t envid, union Fsipc *ipc)
 {
 	struct Fsreq_read *req = &ipc->read;
 	struct Fsret_read *ret = &ipc->readRet;
-	struct OpenFile *o;
-	int r;
 
 	if (debug)
-		cprintf("serve_read %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+		cprintf("serve_read %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, req->req_va);
 
-	// Lab 5: Your code here:
-	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
-		return r;
-	if ((r = file_read(o->o_file, ret->ret_buf, MIN(sizeof(ret->ret_buf), req->req_n), o->o_fd->fd_offset)) < 0)
-		return r;
-	o->o_fd->fd_offset += r;
-	return r;
+	if (req->req_va)
+		return serve_bulk(envid, req->req_fileid, req->req_va, req->req_n, -1, 0);
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+			     MIN(sizeof(ret->ret_buf), req->req_n), -1);
 }
 
+// Like serve_read, but read from ipc->pread.req_offset and leave the
+// seek position alone.
+int
+serve_pread(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_pread *req = &ipc->pread;
+	struct Fsret_read *ret = &ipc->readRet;
+
+	if (debug)
+		cprintf("serve_pread %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, req->req_offset);
 
-// Write req->req_n bytes from req->req_buf to req_fileid, starting at
-// the current seek position, and update the seek position
-// accordingly.  Extend the file if necessary.  Returns the number of
-// bytes written, or < 0 on error.
+	if (req->req_offset < 0)
+		return -E_INVAL;
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+			     MIN(sizeof(ret->ret_buf), req->req_n), req->req_offset);
+}
+
+// Write req->req_n bytes from req->req_buf, or from the client's
+// buffer at req_va if that is not 0, to req_fileid, starting at the
+// current seek position, and update the seek position accordingly.
+// Extend the file if necessary.  Returns the number of bytes written,
+// or < 0 on error.
 int
 serve_write(envid_t envid, struct Fsreq_write *req)
 {
-	struct OpenFile *o;
-	int r;
 	if (debug)
-		cprintf("serve_write %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+		cprintf("serve_write %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, req->req_va);
 
-	// LAB 5: Your code here.
-	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
-		return r;
-	if ((r = file_write(o->o_file, req->req_buf, MIN(sizeof(req->req_buf), req->req_n), o->o_fd->fd_offset)) < 0)
-		return r;
-	o->o_fd->fd_offset += r;
-	return r;
+	if (req->req_va)
+		return serve_bulk(envid, req->req_fileid, req->req_va, req->req_n, -1, 1);
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+			      MIN(sizeof(req->req_buf), req->req_n), -1);
+}
+
+// Like serve_write, but write at req->req_offset and leave the seek
+// position alone.
+int
+serve_pwrite(envid_t envid, struct Fsreq_pwrite *req)
+{
+	if (debug)
+		cprintf("serve_pwrite %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, req->req_offset);
+
+	if (req->req_offset < 0)
+		return -E_INVAL;
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+			      MIN(sizeof(req->req_buf), req->req_n), req->req_offset);
 }
 
 // Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
@@ -298,6 +434,190 @@ serve_sync(envid_t envid, union Fsipc *req)
 	return 0;
 }
 
+// Remove req->req_path.  A file that is still open somewhere is
+// refused, since freeing its directory entry would leave the open
+// file pointing at whatever gets created there next.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+	char path[MAXPATHLEN];
+	struct File *f;
+	int i, r;
+
+	if (debug)
+		cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+
+	if ((r = file_open(path, &f)) < 0)
+		return r;
+	for (i = 0; i < MAXOPEN; i++)
+		if (opentab[i].o_file == f && pageref(opentab[i].o_fd) > 1)
+			return -E_INVAL;
+	return file_remove(path);
+}
+
+// Give req->req_fileid disk blocks for bytes [req_offset,
+// req_offset + req_len), extending it if necessary.
+int
+serve_allocate(envid_t envid, struct Fsreq_allocate *req)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_allocate %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_offset, req->req_len);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	return file_allocate(o->o_file, req->req_offset, req->req_len);
+}
+
+// Map the pages of req->req_fileid covering [req_offset, req_offset +
+// req_len) into envid at req_va, straight from the block cache.
+// Read-only mappings share the cache pages, so they see later writes
+// to the file for as long as the blocks stay cached; PROT_WRITE
+// mappings are copy-on-write.  Returns the number of bytes mapped.
+int
+serve_map(envid_t envid, struct Fsreq_map *req)
+{
+	struct OpenFile *o;
+	struct File *f;
+	size_t i, n;
+	char *blk;
+	int perm, r;
+
+	if (debug)
+		cprintf("serve_map %08x %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_offset, req->req_len, req->req_va);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	f = o->o_file;
+	if ((o->o_mode & O_ACCMODE) == O_WRONLY || f->f_type == FTYPE_DIR)
+		return -E_INVAL;
+	if (PGOFF(req->req_offset) || PGOFF(req->req_va)
+	    || req->req_offset < 0 || req->req_offset >= f->f_size)
+		return -E_INVAL;
+	n = MIN(req->req_len, f->f_size - req->req_offset);
+	if (req->req_va >= UTOP || UTOP - req->req_va < ROUNDUP(n, PGSIZE))
+		return -E_INVAL;
+
+	perm = PTE_P|PTE_U;
+	if (req->req_prot & PROT_WRITE)
+		perm |= PTE_COW;
+	for (i = 0; i < n; i += BLKSIZE) {
+		if ((r = file_get_block(f, (req->req_offset + i) / BLKSIZE, &blk)) < 0)
+			return r;
+		// Fault the block in so there is a page to share.
+		(void) *(volatile char*) blk;
+		if ((r = sys_page_map(0, blk, envid, (void*) (req->req_va + i), perm)) < 0)
+			return r;
+	}
+	return n;
+}
+
+// Set the block cache budget to ipc->bcstat.req_budget blocks unless
+// it is 0, then return the cache counters in ipc->bcstatRet.
+int
+serve_bcstat(envid_t envid, union Fsipc *ipc)
+{
+	int r;
+
+	if (ipc->bcstat.req_budget
+	    && (r = bc_set_budget(ipc->bcstat.req_budget)) < 0)
+		return r;
+	bc_get_stat(&ipc->bcstatRet);
+	return 0;
+}
+
+// Completion queues of clients that use asynchronous requests.
+// Client i's queue is mapped at AIOCQVA + i * PGSIZE.  Clients are told
+// apart by page directory, so that all threads of one share a queue.
+#define NAIOCLIENTS	64
+#define AIOCQVA		(FILEVA + MAXOPEN * PGSIZE)
+
+struct AioClient {
+	envid_t ac_env;		// env that registered the queue
+	pde_t *ac_pgdir;	// its address space
+};
+
+static struct AioClient aioclients[NAIOCLIENTS];
+
+// Is the env that registered ac still running?
+static bool
+aioclient_live(struct AioClient *ac)
+{
+	const volatile struct Env *e = &envs[ENVX(ac->ac_env)];
+
+	return ac->ac_env && e->env_id == ac->ac_env
+		&& e->env_status != ENV_FREE && e->env_pgdir == ac->ac_pgdir;
+}
+
+static struct FsaioCq*
+aioclient_cq(struct AioClient *ac)
+{
+	return (struct FsaioCq*) (AIOCQVA + (ac - aioclients) * PGSIZE);
+}
+
+// Find the registered client whose address space envid runs in.
+static struct AioClient*
+aioclient_lookup(envid_t envid)
+{
+	struct AioClient *ac;
+
+	for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+		if (aioclient_live(ac) && ac->ac_pgdir == envs[ENVX(envid)].env_pgdir)
+			return ac;
+	return NULL;
+}
+
+// Keep the request page as envid's completion queue, replacing any
+// queue it had before.
+int
+serve_aio_setup(envid_t envid, union Fsipc *ipc)
+{
+	struct AioClient *ac;
+	int r;
+
+	if (debug)
+		cprintf("serve_aio_setup %08x\n", envid);
+
+	if ((ac = aioclient_lookup(envid)) == NULL)
+		for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+			if (!aioclient_live(ac))
+				break;
+	if (ac == aioclients + NAIOCLIENTS)
+		return -E_MAX_OPEN;
+	if ((r = sys_page_map(0, ipc, 0, aioclient_cq(ac), PTE_P|PTE_U|PTE_W)) < 0)
+		return r;
+	ac->ac_env = envid;
+	ac->ac_pgdir = envs[ENVX(envid)].env_pgdir;
+	return 0;
+}
+
+// Post the result r of envid's asynchronous request 'tag'.
+static void
+aio_complete(envid_t envid, uint32_t tag, int r)
+{
+	struct AioClient *ac;
+	struct FsaioCq *cq;
+
+	// The client may have exited meanwhile.
+	if ((ac = aioclient_lookup(envid)) == NULL)
+		return;
+	cq = aioclient_cq(ac);
+	cq->cq[cq->cq_tail % FSAIO_NCQE].cqe_tag = tag;
+	cq->cq[cq->cq_tail % FSAIO_NCQE].cqe_res = r;
+	// The entry must be in place before the client sees the tail move.
+	asm volatile("" ::: "memory");
+	cq->cq_tail++;
+	sys_futex_wake(&cq->cq_tail, PTHREAD_MAX);
+}
+
 int
 serve_load(envid_t envid, union Fsipc *ipc)
 {
@@ -386,46 +706,110 @@ fshandler handlers[] = {
 	[FSREQ_WRITE] =		(fshandler)serve_write,
 	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
 	[FSREQ_SYNC] =		serve_sync,
+	[FSREQ_REMOVE] =	(fshandler)serve_remove,
 	[FSREQ_LOAD] =		serve_load,
+	[FSREQ_BCSTAT] =	serve_bcstat,
+	[FSREQ_ALLOCATE] =	(fshandler)serve_allocate,
+	[FSREQ_MAP] =		(fshandler)serve_map,
+	[FSREQ_PREAD] =		serve_pread,
+	[FSREQ_PWRITE] =	(fshandler)serve_pwrite,
+	[FSREQ_AIO_SETUP] =	serve_aio_setup,
 };
 
+// Handle request 'req' from 'whom', whose argument page is at 'ipc',
+// and reply to it, or post its completion if it is asynchronous.
+static void
+serve_request(uint32_t req, envid_t whom, union Fsipc *ipc, int perm)
+{
+	uint32_t tag;
+	void *pg;
+	int r;
+
+	tag = req >> FSAIO_TAGSHIFT;
+	req &= (1 << FSAIO_TAGSHIFT) - 1;
+	pg = NULL;
+	mutex_lock(&fs_mu);
+	if (tag && (req == FSREQ_OPEN || req == FSREQ_LOAD)) {
+		// These reply with a page, or not at all.
+		r = -E_INVAL;
+	} else if (req == FSREQ_OPEN) {
+		r = serve_open(whom, (struct Fsreq_open*)ipc, &pg, &perm);
+	} else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
+		r = handlers[req](whom, ipc);
+	} else {
+		cprintf("Invalid request code %d from %08x\n", req, whom);
+		r = -E_INVAL;
+	}
+	if (tag)
+		aio_complete(whom, tag - 1, r);
+	wb_kick();
+	mutex_unlock(&fs_mu);
+	// do not need to send back
+	if (!tag && req != FSREQ_LOAD) {
+		ipc_send(whom, r, pg, perm);
+	}
+	sys_page_unmap(0, ipc);
+}
+
+static void*
+serve_worker(void *arg)
+{
+	struct Worker *w = arg;
+
+	mutex_lock(&workers_mu);
+	while (1) {
+		while (!w->w_busy)
+			cond_wait(&w->w_cond, &workers_mu);
+		mutex_unlock(&workers_mu);
+		serve_request(w->w_req, w->w_whom, w->w_ipc, w->w_perm);
+		mutex_lock(&workers_mu);
+		w->w_busy = 0;
+		cond_signal(&workers_idle);
+	}
+	return 0;
+}
+
 void
 serve(void)
 {
-	uint32_t req, whom;
-	int perm, r;
-	void *pg;
+	struct Worker *w;
+	pthread_t t;
+	int i, r;
+
+	for (i = 0; i < NWORKERS; i++) {
+		workers[i].w_ipc = fsreq - i;
+		if ((r = pthread_create(&t, serve_worker, &workers[i])) < 0)
+			panic("serve: pthread_create: %e", r);
+	}
 
+	mutex_lock(&workers_mu);
 	while (1) {
-		perm = 0;
+		// Wait for an idle worker to receive the next request into.
+		for (w = workers; w < workers + NWORKERS && w->w_busy; w++)
+			;
+		if (w == workers + NWORKERS) {
+			cond_wait(&workers_idle, &workers_mu);
+			continue;
+		}
+		mutex_unlock(&workers_mu);
+
+		w->w_perm = 0;
 		if (debug)
 			cprintf("recving...\n");
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+		w->w_req = ipc_recv((int32_t *) &w->w_whom, w->w_ipc, &w->w_perm);
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
-				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+				w->w_req, w->w_whom, uvpt[PGNUM(w->w_ipc)], w->w_ipc);
 
+		mutex_lock(&workers_mu);
 		// All requests must contain an argument page
-		if (!(perm & PTE_P)) {
+		if (!(w->w_perm & PTE_P)) {
 			cprintf("Invalid request from %08x: no argument page\n",
-				whom);
+				w->w_whom);
 			continue; // just leave it hanging...
 		}
-
-		pg = NULL;
-		if (req == FSREQ_OPEN) {
-			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
-		} else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
-			r = handlers[req](whom, fsreq);
-		} else {
-			cprintf("Invalid request code %d from %08x\n", req, whom);
-			r = -E_INVAL;
-		}
-		// do not need to send back
-		if (req != FSREQ_LOAD) {
-			ipc_send(whom, r, pg, perm);
-		}
-		sys_page_unmap(0, fsreq);
+		w->w_busy = 1;
+		cond_signal(&w->w_cond);
 	}
 }
 
@@ -443,6 +827,7 @@ umain(int argc, char **argv)
 	serve_init();
 	fs_init();
 	fs_test();
+	wb_init();
 	serve();
 }
 
@@ -12,6 +12,8 @@ fs_test(void)
 	int r;
 	char *blk;
 	uint32_t *bits;
+	uint32_t bno, n, evictions;
+	struct BcStat st;
 
 	// back up bitmap
 	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
@@ -35,10 +37,13 @@ fs_test(void)
 		panic("file_open /newmotd: %e", r);
 	cprintf("file_open is good\n");
 
+	// newmotd is small enough to be inline until asked for a block
+	assert(f->f_flags & FFLAG_INLINE);
 	if ((r = file_get_block(f, 0, &blk)) < 0)
 		panic("file_get_block: %e", r);
 	if (strcmp(blk, msg) != 0)
 		panic("file_get_block returned wrong data");
+	assert(!(f->f_flags & FFLAG_INLINE) && f->f_direct[0] != 0);
 	cprintf("file_get_block is good\n");
 
 	*(volatile char*)blk = *(volatile char*)blk;
@@ -49,7 +54,7 @@ fs_test(void)
 
 	if ((r = file_set_size(f, 0)) < 0)
 		panic("file_set_size: %e", r);
-	assert(f->f_direct[0] == 0);
+	assert(f->f_direct[0] == 0 && (f->f_flags & FFLAG_INLINE));
 	assert(!(uvpt[PGNUM(f)] & PTE_D));
 	cprintf("file_truncate is good\n");
 
@@ -64,4 +69,59 @@ fs_test(void)
 	assert(!(uvpt[PGNUM(blk)] & PTE_D));
 	assert(!(uvpt[PGNUM(f)] & PTE_D));
 	cprintf("file rewrite is good\n");
+
+	// Reach a block under the double-indirect block, then drop it
+	if ((r = file_set_size(f, (NDIRECT + 2 * NINDIRECT + 1) * BLKSIZE)) < 0)
+		panic("file_set_size 3: %e", r);
+	if ((r = file_get_block(f, NDIRECT + 2 * NINDIRECT, &blk)) < 0)
+		panic("file_get_block 3: %e", r);
+	strcpy(blk, msg);
+	assert(f->f_indirect == 0 && f->f_dindirect != 0);
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+		panic("file_set_size 4: %e", r);
+	assert(f->f_indirect == 0 && f->f_dindirect == 0);
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+		panic("file_get_block 4: %e", r);
+	assert(strcmp(blk, msg) == 0);
+	cprintf("file double indirect is good\n");
+
+	// Removing a file frees its data and indirect blocks at once
+	if ((r = file_create("/rmtest", &f)) < 0)
+		panic("file_create /rmtest: %e", r);
+	if ((r = file_set_size(f, (NDIRECT + 2) * BLKSIZE)) < 0)
+		panic("file_set_size 5: %e", r);
+	for (n = 0; n < NDIRECT + 2; n++)
+		if ((r = file_get_block(f, n, &blk)) < 0)
+			panic("file_get_block 5: %e", r);
+		else
+			strcpy(blk, msg);
+	file_flush(f);
+	bno = f->f_indirect;
+	assert(bno != 0 && !block_is_free(bno) && !block_is_free(f->f_direct[0]));
+	n = f->f_direct[0];
+	if ((r = file_remove("/rmtest")) < 0)
+		panic("file_remove: %e", r);
+	assert(block_is_free(bno) && block_is_free(n));
+	assert(!(uvpt[PGNUM(bitmap)] & PTE_D));
+	if ((r = file_open("/rmtest", &f)) != -E_NOT_FOUND)
+		panic("file_open /rmtest after remove: %e", r);
+	cprintf("file_remove is good\n");
+
+	// Touch more in-use blocks than a minimal cache can hold
+	if ((r = bc_set_budget(BC_MINBLOCKS)) < 0)
+		panic("bc_set_budget: %e", r);
+	bc_get_stat(&st);
+	evictions = st.bs_evictions;
+	for (bno = 2, n = 0; bno < super->s_nblocks; bno++)
+		if (!block_is_free(bno)) {
+			(void) *(volatile char*)diskaddr(bno);
+			n++;
+		}
+	bc_get_stat(&st);
+	assert(st.bs_resident <= BC_MINBLOCKS);
+	assert(n <= BC_MINBLOCKS || st.bs_evictions > evictions);
+	assert(strcmp(blk, msg) == 0);
+	if ((r = bc_set_budget(BC_NBLOCKS)) < 0)
+		panic("bc_set_budget 2: %e", r);
+	cprintf("block cache eviction is good\n");
 }
@@ -0,0 +1,353 @@
+/*
+ * Legacy virtio-blk driver.
+ *
+ * Each device has one virtqueue, in physically contiguous pages the
+ * kernel lends us.  A request is a chain of descriptors: the request
+ * header, the data, and a status byte for the device to fill in.  Any
+ * number of requests may be outstanding at once.  A thread with nothing
+ * left to do sleeps until a device interrupts.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+// Legacy virtio PCI registers, in I/O space from BAR 0
+#define VIRTIO_HOST_FEATURES	0x00
+#define VIRTIO_GUEST_FEATURES	0x04
+#define VIRTIO_QUEUE_PFN	0x08
+#define VIRTIO_QUEUE_NUM	0x0C
+#define VIRTIO_QUEUE_SEL	0x0E
+#define VIRTIO_QUEUE_NOTIFY	0x10
+#define VIRTIO_STATUS		0x12
+#define VIRTIO_ISR		0x13
+#define VIRTIO_BLK_CAPACITY	0x14	// in sectors; low word
+
+#define VIRTIO_STATUS_ACK	0x01
+#define VIRTIO_STATUS_DRIVER	0x02
+#define VIRTIO_STATUS_DRIVER_OK	0x04
+#define VIRTIO_STATUS_FAILED	0x80
+
+#define VIRTIO_BLK_T_IN		0
+#define VIRTIO_BLK_T_OUT	1
+
+#define VQ_MAXNUM	1024
+#define VIRTIO_TIMEOUT	100	// ms to sleep before polling anyway
+
+struct VringDesc {
+	uint64_t vd_addr;
+	uint32_t vd_len;
+	uint16_t vd_flags;
+	uint16_t vd_next;
+};
+#define VRING_DESC_F_NEXT	1
+#define VRING_DESC_F_WRITE	2	// the device writes the buffer
+
+struct VringUsedElem {
+	uint32_t vu_id;		// head of the finished chain
+	uint32_t vu_len;
+};
+
+// What the device reads ahead of the data
+struct VirtioBlkHdr {
+	uint32_t vh_type;
+	uint32_t vh_ioprio;
+	uint64_t vh_sector;
+};
+
+// A request, kept by the index of its chain's head descriptor.
+// Aligned so that the header never straddles a page.
+struct VirtioSlot {
+	struct VirtioBlkHdr vs_hdr;
+	volatile uint8_t vs_status;	// written by the device
+	bool vs_done;			// found on the used ring
+} __attribute__((aligned(32)));
+
+struct VirtioBlk {
+	uint16_t vb_base;		// I/O registers
+	uint8_t vb_irq;
+	uint16_t vb_num;		// descriptors in the queue
+	volatile struct VringDesc *vb_desc;
+	volatile uint16_t *vb_avail;	// flags, idx, ring[vb_num]
+	volatile uint16_t *vb_used;	// flags, idx, then the elements
+	volatile struct VringUsedElem *vb_used_ring;
+	uint16_t vb_free;		// free descriptors, linked by vd_next
+	uint16_t vb_nfree;
+	uint16_t vb_used_idx;		// next used element to look at
+	struct mutex vb_mu;
+};
+
+static struct VirtioBlk vblk[FS_MAXDISKS];
+static struct VirtioSlot vslots[FS_MAXDISKS][VQ_MAXNUM];
+static int nvblk;
+
+// Bumped by the kernel at each interrupt from any of the devices.
+static volatile uint32_t virtio_nintr;
+// virtio_nintr when the lines were last unmasked.
+static uint32_t virtio_armed;
+
+static physaddr_t
+va2pa(const volatile void *va)
+{
+	return PTE_ADDR(uvpt[PGNUM(va)]) | PGOFF(va);
+}
+
+// Set up the queue of device vb; d is its index.
+static int
+virtio_setup(struct VirtioBlk *vb, int d, const struct PciDev *pd)
+{
+	uint8_t *ring = (uint8_t *) (VRINGMAP + d * VRINGSLOT);
+	size_t availsz, size;
+	int i, r;
+
+	vb->vb_base = pd->pd_base[0];
+	vb->vb_irq = pd->pd_irq;
+	outb(vb->vb_base + VIRTIO_STATUS, 0);
+	outb(vb->vb_base + VIRTIO_STATUS, VIRTIO_STATUS_ACK);
+	outb(vb->vb_base + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER);
+	// We need none of the optional features.
+	outl(vb->vb_base + VIRTIO_GUEST_FEATURES, 0);
+
+	outw(vb->vb_base + VIRTIO_QUEUE_SEL, 0);
+	vb->vb_num = inw(vb->vb_base + VIRTIO_QUEUE_NUM);
+	availsz = vb->vb_num * sizeof(struct VringDesc) + (3 + vb->vb_num) * sizeof(uint16_t);
+	size = ROUNDUP(availsz, PGSIZE)
+		+ ROUNDUP(3 * sizeof(uint16_t) + vb->vb_num * sizeof(struct VringUsedElem), PGSIZE);
+	if (vb->vb_num == 0 || vb->vb_num > VQ_MAXNUM || size > VRINGSLOT) {
+		r = -E_INVAL;
+		goto fail;
+	}
+	if ((r = sys_dma_map(ring, size / PGSIZE)) < 0)
+		goto fail;
+
+	vb->vb_desc = (volatile struct VringDesc *) ring;
+	vb->vb_avail = (volatile uint16_t *) (ring + vb->vb_num * sizeof(struct VringDesc));
+	vb->vb_used = (volatile uint16_t *) (ring + ROUNDUP(availsz, PGSIZE));
+	vb->vb_used_ring = (volatile struct VringUsedElem *) (vb->vb_used + 2);
+	for (i = 0; i < vb->vb_num; i++)
+		vb->vb_desc[i].vd_next = i + 1;
+	vb->vb_free = 0;
+	vb->vb_nfree = vb->vb_num;
+	vb->vb_used_idx = 0;
+	outl(vb->vb_base + VIRTIO_QUEUE_PFN, va2pa(ring) >> PGSHIFT);
+
+	if ((r = sys_irq_listen(vb->vb_irq, &virtio_nintr)) < 0)
+		goto fail;
+	outb(vb->vb_base + VIRTIO_STATUS,
+	     VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
+	cprintf("virtio-blk %d: %d sectors, %d descriptors, irq %d\n", d,
+		inl(vb->vb_base + VIRTIO_BLK_CAPACITY), vb->vb_num, vb->vb_irq);
+	return 0;
+
+fail:
+	outb(vb->vb_base + VIRTIO_STATUS, VIRTIO_STATUS_FAILED);
+	return r;
+}
+
+// Find and set up the virtio-blk devices the kernel found.
+// Returns how many there are.
+int
+virtio_init(void)
+{
+	struct PciDev pd;
+	int i, r;
+
+	for (i = 0; nvblk < FS_MAXDISKS && sys_pci_storage(i, &pd) == 0; i++) {
+		if (PCIDEV_VENDOR(&pd) != PCIDEV_VENDOR_VIRTIO
+		    || PCIDEV_PRODUCT(&pd) != PCIDEV_PRODUCT_VIRTIO_BLK)
+			continue;
+		if ((r = virtio_setup(&vblk[nvblk], nvblk, &pd)) < 0)
+			cprintf("virtio-blk %d: %e\n", nvblk, r);
+		else
+			nvblk++;
+	}
+	return nvblk;
+}
+
+static bool
+virtio_probe(int d)
+{
+	return d >= 0 && d < nvblk;
+}
+
+// Physical address of va, faulting the page in first if the device
+// could not use it: not mapped, or not writable for a read.
+static physaddr_t
+virtio_pa(void *va, bool devwrite)
+{
+	if (!(uvpd[PDX(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_P)
+	    || (devwrite && !(uvpt[PGNUM(va)] & PTE_W))) {
+		if (devwrite)
+			*(volatile char *) va = *(volatile char *) va;
+		else
+			(void) *(volatile char *) va;
+	}
+	return va2pa(va);
+}
+
+// Put q on vb's available ring, without telling the device.
+// Returns the chain's head descriptor, or -1 if too few descriptors
+// are free.  Call with vb_mu held.
+static int
+virtio_submit(struct VirtioBlk *vb, struct DiskReq *q)
+{
+	struct { physaddr_t pa; uint32_t len; } seg[BC_MAXIO * BLKSECTS * SECTSIZE / PGSIZE + 1];
+	char *va = q->dr_buf, *end = va + q->dr_nsecs * SECTSIZE;
+	int nseg, head, i, d;
+	physaddr_t pa;
+	uint32_t n;
+
+	// Gather the buffer into physically contiguous pieces.
+	for (nseg = 0; va < end; va += n) {
+		n = MIN(PGSIZE - PGOFF(va), end - va);
+		pa = virtio_pa(va, !q->dr_write);
+		if (nseg > 0 && seg[nseg - 1].pa + seg[nseg - 1].len == pa)
+			seg[nseg - 1].len += n;
+		else {
+			assert(nseg < ARRAY_SIZE(seg));
+			seg[nseg].pa = pa;
+			seg[nseg++].len = n;
+		}
+	}
+	assert(nseg + 2 <= vb->vb_num);
+	if (nseg + 2 > vb->vb_nfree)
+		return -1;
+
+	head = d = vb->vb_free;
+	vslots[vb - vblk][head].vs_hdr.vh_type =
+		q->dr_write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+	vslots[vb - vblk][head].vs_hdr.vh_ioprio = 0;
+	vslots[vb - vblk][head].vs_hdr.vh_sector = q->dr_secno;
+	vslots[vb - vblk][head].vs_status = 0xFF;
+	vslots[vb - vblk][head].vs_done = 0;
+
+	vb->vb_desc[d].vd_addr = va2pa(&vslots[vb - vblk][head].vs_hdr);
+	vb->vb_desc[d].vd_len = sizeof(struct VirtioBlkHdr);
+	vb->vb_desc[d].vd_flags = VRING_DESC_F_NEXT;
+	for (i = 0; i < nseg; i++) {
+		d = vb->vb_desc[d].vd_next;
+		vb->vb_desc[d].vd_addr = seg[i].pa;
+		vb->vb_desc[d].vd_len = seg[i].len;
+		vb->vb_desc[d].vd_flags = VRING_DESC_F_NEXT
+			| (q->dr_write ? 0 : VRING_DESC_F_WRITE);
+	}
+	d = vb->vb_desc[d].vd_next;
+	vb->vb_desc[d].vd_addr = va2pa(&vslots[vb - vblk][head].vs_status);
+	vb->vb_desc[d].vd_len = 1;
+	vb->vb_desc[d].vd_flags = VRING_DESC_F_WRITE;
+	vb->vb_free = vb->vb_desc[d].vd_next;
+	vb->vb_nfree -= nseg + 2;
+
+	// The ring entry must be visible before the index moves past it.
+	vb->vb_avail[2 + vb->vb_avail[1] % vb->vb_num] = head;
+	asm volatile("" ::: "memory");
+	vb->vb_avail[1]++;
+	return head;
+}
+
+// If the request with chain head 'head' is done, free its descriptors
+// and return 1 if it succeeded, -1 if it failed.  Otherwise return 0.
+// Call with vb_mu held.
+static int
+virtio_collect(struct VirtioBlk *vb, int head)
+{
+	struct VirtioSlot *slots = vslots[vb - vblk];
+	int d, n;
+
+	while (vb->vb_used_idx != vb->vb_used[1]) {
+		slots[vb->vb_used_ring[vb->vb_used_idx % vb->vb_num].vu_id].vs_done = 1;
+		vb->vb_used_idx++;
+	}
+	if (!slots[head].vs_done)
+		return 0;
+
+	for (d = head, n = 1; vb->vb_desc[d].vd_flags & VRING_DESC_F_NEXT; n++)
+		d = vb->vb_desc[d].vd_next;
+	vb->vb_desc[d].vd_next = vb->vb_free;
+	vb->vb_free = head;
+	vb->vb_nfree += n;
+	return slots[head].vs_status == 0 ? 1 : -1;
+}
+
+// Quiet the devices and unmask their lines, which the kernel masks at
+// each interrupt, unless that was done since the last interrupt.
+// Returns 1 if it did anything.
+static bool
+virtio_rearm(void)
+{
+	uint32_t n = virtio_nintr;
+	int d;
+
+	if (n == virtio_armed)
+		return 0;
+	virtio_armed = n;
+	for (d = 0; d < nvblk; d++)
+		inb(vblk[d].vb_base + VIRTIO_ISR);
+	for (d = 0; d < nvblk; d++)
+		sys_irq_listen(vblk[d].vb_irq, &virtio_nintr);
+	return 1;
+}
+
+// Run the n transfers in reqs, all outstanding at once: each device
+// is told about its new requests together, and the requests finish in
+// whatever order the devices like.
+static int
+virtio_rw(struct DiskReq *reqs, int n)
+{
+	int head[FS_MAXDISKS];
+	bool done[FS_MAXDISKS], progress;
+	int i, nsub, ndone, r, s;
+	uint32_t seen, kick;
+	struct VirtioBlk *vb;
+
+	assert(n <= FS_MAXDISKS);
+	nsub = ndone = r = 0;
+	while (ndone < n) {
+		seen = virtio_nintr;
+		progress = 0;
+
+		kick = 0;
+		for (; nsub < n; nsub++) {
+			vb = &vblk[reqs[nsub].dr_disk];
+			mutex_lock(&vb->vb_mu);
+			head[nsub] = virtio_submit(vb, &reqs[nsub]);
+			mutex_unlock(&vb->vb_mu);
+			if (head[nsub] < 0)
+				break;
+			done[nsub] = 0;
+			kick |= 1 << reqs[nsub].dr_disk;
+			progress = 1;
+		}
+		for (i = 0; i < nvblk; i++)
+			if (kick & (1 << i))
+				outw(vblk[i].vb_base + VIRTIO_QUEUE_NOTIFY, 0);
+
+		for (i = 0; i < nsub; i++) {
+			if (done[i])
+				continue;
+			vb = &vblk[reqs[i].dr_disk];
+			mutex_lock(&vb->vb_mu);
+			s = virtio_collect(vb, head[i]);
+			mutex_unlock(&vb->vb_mu);
+			if (s == 0)
+				continue;
+			if (s < 0)
+				r = -1;
+			reqs[i].dr_buf += reqs[i].dr_nsecs * SECTSIZE;
+			reqs[i].dr_nsecs = 0;
+			done[i] = 1;
+			ndone++;
+			progress = 1;
+		}
+
+		// An interrupt after 'seen' was read makes this return at once.
+		if (ndone < n && !progress && !virtio_rearm())
+			sys_futex_wait(&virtio_nintr, seen, VIRTIO_TIMEOUT);
+	}
+	return r;
+}
+
+struct DiskDriver virtio_driver = {
+	.dd_name = "virtio-blk",
+	.dd_probe = virtio_probe,
+	.dd_rw = virtio_rw,
+};
@@ -0,0 +1,52 @@
+/*
+ * Write-back daemon: a second thread of the file server that writes
+ * dirty blocks to disk in the background, so that requests only touch
+ * the block cache.
+ */
+
+#include "fs.h"
+
+#define debug 0
+
+// Serializes the request loop and the daemon.  Held by whichever
+// thread is touching the block cache or file system structures.
+struct mutex fs_mu;
+
+static struct cond wb_cond;
+
+static void*
+wb_main(void *arg)
+{
+	uint32_t n;
+
+	mutex_lock(&fs_mu);
+	while (1) {
+		cond_timedwait(&wb_cond, &fs_mu, WB_INTERVAL);
+		if (fs_ndirty_blocks() > WB_HIWAT)
+			n = fs_writeback(0);
+		else
+			n = fs_writeback(WB_AGE);
+		if (debug && n)
+			cprintf("writeback: %d blocks\n", n);
+	}
+	return 0;
+}
+
+// Wake the daemon early if too many blocks are dirty.
+// Call with fs_mu held.
+void
+wb_kick(void)
+{
+	if (fs_ndirty_blocks() > WB_HIWAT)
+		cond_signal(&wb_cond);
+}
+
+void
+wb_init(void)
+{
+	pthread_t t;
+	int r;
+
+	if ((r = pthread_create(&t, wb_main, 0)) < 0)
+		panic("wb_init: pthread_create: %e", r);
+}
@@ -60,6 +60,7 @@ struct Env {
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	uintptr_t env_uxstacktop;	// Top of the user exception stack
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
@@ -67,6 +68,14 @@ struct Env {
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+
+	// Futex wait state
+	bool env_futex_waiting;		// Env is blocked in sys_futex_wait
+	physaddr_t env_futex_key;	// Physical address waited on
+	uint32_t env_futex_deadline;	// time_msec() to time out at, 0 if none
+
+	// Asynchronous system calls
+	void *env_uring;		// User VA of the struct Uring, or NULL
 };
 
 #endif // !JOS_INC_ENV_H
@@ -29,6 +29,9 @@ enum {
 	E_OVER_LENGTH	,	// Length is not permitted
 	E_FULL_BUFFER	,	// Buffer is full
 	E_BUFFER_TOO_SMALL, // receive buffer is too small
+
+	E_AGAIN		,	// Futex value changed, try again
+	E_TIMEOUT	,	// Wait timed out
 	MAXERROR
 };
 
@@ -24,8 +24,15 @@
 #define NDIRECT		10
 // Number of direct block pointers in an indirect block
 #define NINDIRECT	(BLKSIZE / 4)
+// Number of blocks reachable through the double-indirect block
+#define NDINDIRECT	(NINDIRECT * NINDIRECT)
 
-#define MAXFILESIZE	((NDIRECT + NINDIRECT) * BLKSIZE)
+#define MAXFILEBLOCKS	(NDIRECT + NINDIRECT + NDINDIRECT)
+// The block pointers reach 4GB, but sizes must fit in an off_t
+#define MAXFILESIZE	0x7FFFF000
+
+// Bytes of data a struct File can hold itself
+#define FINLINE		(256 - MAXNAMELEN - 8 - 4*NDIRECT - 20)
 
 struct File {
 	char f_name[MAXNAMELEN];	// filename
@@ -36,10 +43,19 @@ struct File {
 	// A block is allocated iff its value is != 0.
 	uint32_t f_direct[NDIRECT];	// direct blocks
 	uint32_t f_indirect;		// indirect block
+	uint32_t f_dindirect;		// double-indirect block: NINDIRECT
+					// pointers to indirect blocks
+
+	// Directory hash index (see struct DirIndex)
+	uint32_t f_dirindex;		// directories: index block, or 0
+	uint32_t f_hnext;		// next entry + 1 on our hash chain
+
+	uint32_t f_flags;		// FFLAG_*
 
-	// Pad out to 256 bytes; must do arithmetic in case we're compiling
+	// Data of inline files, zero past f_size.  Fills the struct out
+	// to 256 bytes; must do arithmetic in case we're compiling
 	// fsformat on a 64-bit machine.
-	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4];
+	uint8_t f_inline[FINLINE];
 } __attribute__((packed));	// required only on some 64-bit machines
 
 // An inode block contains exactly BLKFILES 'struct File's
@@ -49,6 +65,34 @@ struct File {
 #define FTYPE_REG	0	// Regular file
 #define FTYPE_DIR	1	// Directory
 
+// File flags
+#define FFLAG_INLINE	0x1	// data is in f_inline, not in blocks
+
+// A directory's hash index.  Entry e of a directory is the
+// (e % BLKFILES)'th struct File in its (e / BLKFILES)'th block.  Bucket
+// h holds e + 1 for the first entry whose name hashes to h, and each
+// entry's f_hnext holds the next one, 0 ending the chain.  Directories
+// without an index are scanned linearly.
+#define DIRINDEX_MAGIC		0x48545245	// 'HTRE'
+#define DIRINDEX_NBUCKETS	(BLKSIZE / 4 - 2)
+
+struct DirIndex {
+	uint32_t di_magic;		// DIRINDEX_MAGIC
+	uint32_t di_free;		// no free entry comes before this one
+	uint32_t di_bucket[DIRINDEX_NBUCKETS];
+};
+
+// Hash a file name for a directory index (FNV-1a)
+static inline uint32_t
+dir_hash(const char *name)
+{
+	uint32_t h = 2166136261U;
+
+	while (*name)
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+	return h % DIRINDEX_NBUCKETS;
+}
+
 
 // File system super-block (both in-memory and on-disk)
 
@@ -58,6 +102,30 @@ struct Super {
 	uint32_t s_magic;		// Magic number: FS_MAGIC
 	uint32_t s_nblocks;		// Total number of blocks on disk
 	struct File s_root;		// Root directory node
+	uint32_t s_ndisks;		// Disks striped across; 0 means 1
+	uint32_t s_stripe;		// Blocks per stripe unit, at least 2
+};
+
+// Most disks a file system can be striped across
+#define FS_MAXDISKS	4
+
+// File server block cache counters
+struct BcStat {
+	uint32_t bs_hits;		// reads and faults that found the block resident
+	uint32_t bs_misses;		// faults on a non-resident block
+	uint32_t bs_readahead;		// blocks read in ahead of a fault
+	uint32_t bs_evictions;		// blocks dropped to stay in budget
+	uint32_t bs_writebacks;		// dirty blocks written to disk
+	uint32_t bs_writes;		// ide_writes used to write them
+	uint32_t bs_dirty;		// blocks currently dirty
+	uint32_t bs_resident;		// blocks currently cached
+	uint32_t bs_budget;		// maximum blocks cached
+	uint32_t bs_ioqueued;		// requests through the I/O queue
+	uint32_t bs_iomerged;		// of those, joined to another's transfer
+	uint32_t bs_iodispatched;	// transfers handed to the disks
+	uint32_t bs_ioexpired;		// transfers sent early for a deadline
+	uint32_t bs_iodepth;		// requests queued right now
+	uint32_t bs_iomaxdepth;		// most requests ever queued at once
 };
 
 // Definitions for requests from clients to file system
@@ -73,8 +141,48 @@ enum {
 	FSREQ_REMOVE,
 	FSREQ_SYNC,
 	FSREQ_LOAD,
+	// Bcstat optionally sets the block cache budget, then
+	// returns a struct BcStat on the request page
+	FSREQ_BCSTAT,
+	FSREQ_ALLOCATE,
+	// Map maps file pages into the caller at req_va
+	FSREQ_MAP,
+	// Pread and pwrite are read and write at req_offset, leaving the
+	// seek position alone; pread returns a Fsret_read
+	FSREQ_PREAD,
+	FSREQ_PWRITE,
+	// Aio_setup registers the request page as the caller's struct FsaioCq
+	FSREQ_AIO_SETUP,
 };
 
+// Asynchronous requests.  Once a client has registered a completion
+// queue with FSREQ_AIO_SETUP, it may send FSAIO(req, tag) instead of
+// req as the IPC value.  The server does not reply to such a request;
+// when it is done it leaves any returned data in the request page as
+// usual, posts { tag, result } on the completion queue and wakes the
+// futex on cq_tail.  Completions arrive in any order.  A client must
+// not have more than FSAIO_NCQE requests outstanding.
+#define FSAIO_TAGSHIFT	16
+#define FSAIO_MAXTAG	0x7FFF
+#define FSAIO(req, tag)	((req) | ((tag) + 1) << FSAIO_TAGSHIFT)
+#define FSAIO_NCQE	256		// power of two
+
+struct FsaioCqe {
+	uint32_t cqe_tag;
+	int32_t cqe_res;
+};
+
+struct FsaioCq {
+	volatile uint32_t cq_head;	// advanced by the client
+	volatile uint32_t cq_tail;	// advanced by the server
+	struct FsaioCqe cq[FSAIO_NCQE];
+};
+
+// Read and write requests with a nonzero req_va move up to FSBULK_MAX
+// bytes straight between the file and the client's buffer at req_va,
+// which the server maps for the duration of the request.
+#define FSBULK_MAX	(256 * PGSIZE)
+
 union Fsipc {
 	struct Fsreq_open {
 		char req_path[MAXPATHLEN];
@@ -87,6 +195,7 @@ union Fsipc {
 	struct Fsreq_read {
 		int req_fileid;
 		size_t req_n;
+		uintptr_t req_va;	// client buffer, or 0 to use readRet
 	} read;
 	struct Fsret_read {
 		char ret_buf[PGSIZE];
@@ -94,8 +203,20 @@ union Fsipc {
 	struct Fsreq_write {
 		int req_fileid;
 		size_t req_n;
-		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t))];
+		uintptr_t req_va;	// client buffer, or 0 to use req_buf
+		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t) + sizeof(uintptr_t))];
 	} write;
+	struct Fsreq_pread {
+		int req_fileid;
+		size_t req_n;
+		off_t req_offset;
+	} pread;
+	struct Fsreq_pwrite {
+		int req_fileid;
+		size_t req_n;
+		off_t req_offset;
+		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t) + sizeof(off_t))];
+	} pwrite;
 	struct Fsreq_stat {
 		int req_fileid;
 	} stat;
@@ -114,6 +235,22 @@ union Fsipc {
 	struct Fsreq_load {
 		char req_path[MAXPATHLEN];
 	} load;
+	struct Fsreq_allocate {
+		int req_fileid;
+		off_t req_offset;
+		off_t req_len;
+	} allocate;
+	struct Fsreq_map {
+		int req_fileid;
+		off_t req_offset;	// page-aligned
+		size_t req_len;
+		uintptr_t req_va;	// page-aligned
+		int req_prot;
+	} map;
+	struct Fsreq_bcstat {
+		uint32_t req_budget;	// new budget in blocks, or 0
+	} bcstat;
+	struct BcStat bcstatRet;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
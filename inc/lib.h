@@ -22,6 +22,11 @@
 #include <inc/args.h>
 #include <inc/malloc.h>
 #include <inc/ns.h>
+#include <inc/sync.h>
+#include <inc/ring.h>
+#include <inc/uring.h>
+#include <inc/pthread.h>
+#include <inc/pci.h>
 
 #define USED(x)		(void)(x)
 
@@ -30,12 +35,7 @@ void	umain(int argc, char **argv);
 
 // libmain.c or entry.S
 extern const char *binaryname;
-#ifdef SFORK
-extern const volatile struct Env **env;
-#define thisenv (*env)
-#else
-extern const volatile struct Env *thisenv;
-#endif
+#define thisenv (pthread_tls(pthread_self())->tls_env)
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
 
@@ -68,8 +68,21 @@ int	sys_exec(const char *pathname, const char *argv[]);
 unsigned int sys_time_msec(void);
 int	sys_net_try_send(const uint8_t* buf, size_t length);
 int	sys_net_try_recv(uint8_t* buf, size_t length);
+int	sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout);
+int	sys_futex_wake(volatile uint32_t *addr, int n);
+int	sys_uring_setup(struct Uring *u);
+int	sys_uring_enter(void);
+envid_t	sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop);
+int	sys_irq_listen(int irq, volatile uint32_t *counter);
+int	sys_pci_storage(int i, struct PciDev *pd);
+int	sys_dma_map(void *va, size_t npages);
 
 // This must be inlined.  Exercise for reader: why?
+// It is also the one call that still enters through int 0x30 rather
+// than sysenter.  The child resumes from a copy of the trapframe, but
+// the sysenter stub keeps its return state on the user stack below
+// the caller's esp, where the parent's next function calls overwrite
+// it before the child gets to pop it.
 static inline envid_t __attribute__((always_inline))
 sys_exofork(void)
 {
@@ -80,6 +93,17 @@ sys_exofork(void)
 	return ret;
 }
 
+// uring.c
+int	uring_init(struct Uring *u);
+int	uring_queue(struct Uring *u, uint32_t op, uint32_t data,
+		    uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+int	uring_submit(struct Uring *u);
+int	uring_reap(struct Uring *u, struct UringCqe *cqe);
+
+// pthread.c
+void	pthread_fork_child(void);
+void	pthread_kill_others(void);
+
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
@@ -87,8 +111,12 @@ envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
 #define	PTE_SHARE	0x400
+// PTE_COW marks copy-on-write page table entries.
+// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
+#define	PTE_COW		0x800
 envid_t	fork(void);
-envid_t	sfork(void);	// Challenge!
+envid_t	sfork(void);
+void	cow_enable(void);
 
 // fd.c
 int	close(int fd);
@@ -104,8 +132,44 @@ int	stat(const char *path, struct Stat *statbuf);
 // file.c
 int	open(const char *path, int mode);
 int	ftruncate(int fd, off_t size);
+int	fallocate(int fd, off_t offset, off_t len);
 int	remove(const char *path);
 int	sync(void);
+int	fs_bcstat(uint32_t budget, struct BcStat *st);
+void*	mmap(int fd, off_t offset, size_t len, int prot);
+int	munmap(void *addr, size_t len);
+
+// aio.c
+#define	AIO_MAX		32	/* most requests in flight at once */
+int	aio_read(int fd, void *buf, size_t n, off_t offset);
+int	aio_write(int fd, const void *buf, size_t n, off_t offset);
+int	aio_wait(int id);
+int	aio_reap(int *id_store);
+
+// stdio.c
+#define	EOF		(-1)
+#define	FOPEN_MAX	16	/* most streams open at once */
+#define	_IOFBF		1	/* flush when the buffer fills */
+#define	_IOLBF		2	/* also flush at each newline */
+#define	_IONBF		3	/* write every byte through */
+typedef struct FILE FILE;
+extern FILE *const stdin;
+extern FILE *const stdout;
+FILE*	fopen(const char *path, const char *mode);
+FILE*	fdopen(int fd, const char *mode);
+int	fclose(FILE *f);
+int	fflush(FILE *f);
+int	setvbuf(FILE *f, char *buf, int mode, size_t size);
+int	fileno(FILE *f);
+int	feof(FILE *f);
+int	ferror(FILE *f);
+int	fgetc(FILE *f);
+char*	fgets(char *s, int n, FILE *f);
+size_t	fread(void *buf, size_t size, size_t n, FILE *f);
+int	fputc(int c, FILE *f);
+int	fputs(const char *s, FILE *f);
+size_t	fwrite(const void *buf, size_t size, size_t n, FILE *f);
+int	sfprintf(FILE *f, const char *fmt, ...);
 
 // pageref.c
 int	pageref(void *addr);
@@ -161,4 +225,8 @@ void	wait(envid_t env);
 #define	O_EXCL		0x0400		/* error if already exists */
 #define O_MKDIR		0x0800		/* create directory, not regular file */
 
+/* mmap protections */
+#define	PROT_READ	0x1		/* pages may be read */
+#define	PROT_WRITE	0x2		/* pages may be written (privately) */
+
 #endif	// !JOS_INC_LIB_H
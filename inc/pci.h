@@ -0,0 +1,28 @@
+#ifndef JOS_INC_PCI_H
+#define JOS_INC_PCI_H
+
+#include <inc/types.h>
+
+// A PCI mass storage function the kernel found and enabled at boot,
+// as handed to the file server by sys_pci_storage.
+struct PciDev {
+	uint32_t pd_id;			// device ID << 16 | vendor ID
+	uint32_t pd_class;		// class code register
+	uint32_t pd_base[6];		// BAR addresses
+	uint32_t pd_size[6];		// BAR sizes
+	uint8_t pd_irq;			// interrupt line
+};
+
+#define PCIDEV_VENDOR(pd)	((pd)->pd_id & 0xffff)
+#define PCIDEV_PRODUCT(pd)	((pd)->pd_id >> 16)
+#define PCIDEV_CLASS(pd)	(((pd)->pd_class >> 24) & 0xff)
+#define PCIDEV_SUBCLASS(pd)	(((pd)->pd_class >> 16) & 0xff)
+
+#define PCIDEV_CLASS_STORAGE	0x01
+#define PCIDEV_SUBCLASS_IDE	0x01
+
+// Legacy (transitional) virtio block device
+#define PCIDEV_VENDOR_VIRTIO	0x1AF4
+#define PCIDEV_PRODUCT_VIRTIO_BLK 0x1001
+
+#endif /* !JOS_INC_PCI_H */
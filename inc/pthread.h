@@ -0,0 +1,62 @@
+#ifndef JOS_INC_PTHREAD_H
+#define JOS_INC_PTHREAD_H
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <inc/x86.h>
+
+// Kernel-scheduled threads: environments created with sys_thread_create
+// that share one page directory, so they can run on several CPUs at once.
+//
+// Thread t owns PTHREAD_SLOT bytes of address space just below
+// USTACKTOP - t * PTHREAD_SLOT.  Slot 0 is the main thread's stack.
+// For t > 0 the slot holds, from the top down, the thread's exception
+// stack page, an empty page, and PTHREAD_STKPAGES pages of regular
+// stack topped by its struct pthread_tls.  A thread finds its own slot,
+// and so its thread-local data, from its stack pointer.
+
+#define PTHREAD_MAX		32		// threads per address space
+#define PTHREAD_SLOT		(16 * PGSIZE)
+#define PTHREAD_STKPAGES	8
+#define PTHREAD_BASE		(USTACKTOP - PTHREAD_MAX * PTHREAD_SLOT)
+
+// Top of thread t's slot, which is also the top of its exception stack
+#define PTHREAD_TOP(t)		(USTACKTOP - (t) * PTHREAD_SLOT)
+
+typedef int pthread_t;
+
+// Thread-local data
+struct pthread_tls {
+	const volatile struct Env *tls_env;	// thisenv
+};
+
+// The main thread's pthread_tls lives in libmain's stack frame.
+// Environments created with sfork see the same address, but in
+// their own copy of the stack.
+extern struct pthread_tls *pthread_main_tls;
+
+// Return the calling thread's id: 0 for the main thread, and for any
+// code running on a stack outside the thread slots.
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+}
+
+int	pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg);
+int	pthread_join(pthread_t t, void **ret_store);
+void	pthread_exit(void *ret) __attribute__((noreturn));
+
+#endif	// !JOS_INC_PTHREAD_H
@@ -0,0 +1,74 @@
+#ifndef JOS_INC_RING_H
+#define JOS_INC_RING_H
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+#include <inc/env.h>
+
+// Single-producer/single-consumer ring channels over shared memory.
+//
+// A ring is a header page followed by data pages, all mapped PTE_SHARE
+// in both environments.  The data pages hold nslots fixed-size slots.
+// The producer fills slots and publishes them in batches by advancing
+// rh_head; the consumer drains them and gives them back in batches by
+// advancing rh_tail.  Neither side enters the kernel while the ring is
+// neither empty nor full: a futex doorbell is rung only when the other
+// side has gone to sleep.
+
+#define RING_MAGIC	0x52494E47	// 'RING'
+#define RING_CACHELINE	64
+
+struct RingHdr {
+	// Written by the producer
+	volatile uint32_t rh_head;	// slots published so far
+	volatile uint32_t rh_prod_idle;	// producer sleeps waiting for room
+	uint8_t rh_pad0[RING_CACHELINE - 8];
+
+	// Written by the consumer
+	volatile uint32_t rh_tail;	// slots consumed so far
+	volatile uint32_t rh_cons_idle;	// consumer sleeps waiting for data
+	uint8_t rh_pad1[RING_CACHELINE - 8];
+
+	// Fixed at creation
+	uint32_t rh_magic;
+	uint32_t rh_slotsize;		// bytes per slot
+	uint32_t rh_nslots;		// power of two
+	uint32_t rh_npages;		// header page included
+};
+
+enum {
+	RING_PRODUCER = 0,
+	RING_CONSUMER,
+};
+
+// Per-environment handle on one end of a ring.
+struct Ring {
+	struct RingHdr *r_hdr;
+	uint8_t *r_data;
+	int r_role;		// RING_PRODUCER or RING_CONSUMER
+	uint32_t r_batch;	// slots to accumulate before publishing
+	uint32_t r_next;	// our private head (producer) or tail (consumer)
+	uint32_t r_peer;	// last seen value of the other side's index
+	uint32_t r_pub;		// last value of r_next made visible
+};
+
+// Largest ring we support: header page plus this many data pages
+#define RING_MAXPAGES	256
+
+int	ring_create(struct Ring *r, void *va, uint32_t slotsize, uint32_t nslots, int role);
+int	ring_attach(struct Ring *r, void *va, int role);
+int	ring_grant(struct Ring *r, envid_t to);
+int	ring_accept(struct Ring *r, void *va, int role, envid_t *from_store);
+void	ring_set_batch(struct Ring *r, uint32_t batch);
+
+void	*ring_try_alloc(struct Ring *r);
+void	*ring_alloc(struct Ring *r);
+void	ring_push(struct Ring *r);
+
+void	*ring_try_front(struct Ring *r);
+void	*ring_front(struct Ring *r);
+void	ring_pop(struct Ring *r);
+
+void	ring_flush(struct Ring *r);
+
+#endif	// !JOS_INC_RING_H
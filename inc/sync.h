@@ -0,0 +1,48 @@
+#ifndef JOS_INC_SYNC_H
+#define JOS_INC_SYNC_H
+
+#include <inc/types.h>
+
+// Blocking synchronization primitives built on sys_futex_wait and
+// sys_futex_wake.  To synchronize several environments, place the
+// objects in a page they all map with PTE_SHARE; within one environment
+// any memory will do.  All objects start out zero-initialized.
+
+// Mutex states: 0 unlocked, 1 locked, 2 locked with (possible) waiters.
+struct mutex {
+	volatile uint32_t m_state;
+};
+
+// Condition variable: waiters sleep on a sequence number that every
+// signal or broadcast bumps.
+struct cond {
+	volatile uint32_t c_seq;
+};
+
+struct semaphore {
+	volatile uint32_t s_count;	// available units
+	volatile uint32_t s_waiters;	// envs sleeping in sem_wait
+};
+
+#define MUTEX_INITIALIZER	{ 0 }
+#define COND_INITIALIZER	{ 0 }
+#define SEMAPHORE_INITIALIZER(n) { (n), 0 }
+
+void	mutex_init(struct mutex *m);
+void	mutex_lock(struct mutex *m);
+int	mutex_trylock(struct mutex *m);
+void	mutex_unlock(struct mutex *m);
+
+void	cond_init(struct cond *c);
+void	cond_wait(struct cond *c, struct mutex *m);
+int	cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec);
+void	cond_signal(struct cond *c);
+void	cond_broadcast(struct cond *c);
+
+void	sem_init(struct semaphore *s, uint32_t count);
+void	sem_wait(struct semaphore *s);
+int	sem_trywait(struct semaphore *s);
+int	sem_timedwait(struct semaphore *s, uint32_t msec);
+void	sem_post(struct semaphore *s);
+
+#endif	// !JOS_INC_SYNC_H
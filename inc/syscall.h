@@ -20,6 +20,14 @@ enum {
 	SYS_time_msec,
 	SYS_net_try_send,
 	SYS_net_try_recv,
+	SYS_futex_wait,
+	SYS_futex_wake,
+	SYS_uring_setup,
+	SYS_uring_enter,
+	SYS_thread_create,
+	SYS_irq_listen,
+	SYS_pci_storage,
+	SYS_dma_map,
 	NSYSCALLS
 };
 
@@ -27,6 +27,7 @@
 // These are arbitrarily chosen, but with care not to overlap
 // processor defined exceptions or interrupt vectors.
 #define T_SYSCALL   48		// system call
+#define T_TLBFLUSH  49		// TLB shootdown IPI between CPUs
 #define T_DEFAULT   500		// catchall
 
 #define IRQ_OFFSET	32	// IRQ 0 corresponds to int IRQ_OFFSET
@@ -35,8 +36,12 @@
 #define IRQ_TIMER        0
 #define IRQ_KBD          1
 #define IRQ_SERIAL       4
+#define IRQ_PCI9         9	// lines the BIOS routes PCI interrupts to
+#define IRQ_PCI10       10
+#define IRQ_PCI11       11
 #define IRQ_SPURIOUS     7
 #define IRQ_IDE         14
+#define IRQ_IDE2        15
 #define IRQ_ERROR       19
 
 #ifndef __ASSEMBLER__
@@ -0,0 +1,45 @@
+#ifndef JOS_INC_URING_H
+#define JOS_INC_URING_H
+
+#include <inc/types.h>
+
+// Asynchronous system call ring.
+//
+// An environment registers one page laid out as a struct Uring with
+// sys_uring_setup.  It queues system calls on the submission queue by
+// filling sq[sq_tail % URING_NSQE] and advancing sq_tail; the kernel
+// consumes them whenever it is entered anyway (any system call, each
+// clock tick while the env runs) or on an explicit sys_uring_enter,
+// and posts each result on the completion queue.  Many calls can thus
+// be issued with one kernel entry, or none at all.
+//
+// Only calls that never block or switch environments can be queued;
+// the others complete with -E_INVAL.  Queued calls run in order, with
+// the same semantics as when issued directly.
+
+#define URING_NSQE	64	// submission queue entries, power of two
+#define URING_NCQE	128	// completion queue entries, power of two
+
+struct UringSqe {
+	uint32_t sqe_op;		// SYS_* number
+	uint32_t sqe_arg[5];		// arguments, as for syscall()
+	uint32_t sqe_data;		// copied to the completion
+	uint32_t sqe_pad;
+};
+
+struct UringCqe {
+	uint32_t cqe_data;		// sqe_data of the submission
+	int32_t cqe_res;		// return value of the system call
+};
+
+struct Uring {
+	volatile uint32_t sq_head;	// advanced by the kernel
+	volatile uint32_t sq_tail;	// advanced by the user
+	volatile uint32_t cq_head;	// advanced by the user
+	volatile uint32_t cq_tail;	// advanced by the kernel
+	uint32_t u_pad[12];
+	struct UringSqe sq[URING_NSQE];
+	struct UringCqe cq[URING_NCQE];
+};
+
+#endif	// !JOS_INC_URING_H
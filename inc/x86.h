@@ -248,6 +248,15 @@ read_tsc(void)
 	return tsc;
 }
 
+// Index of the lowest set bit in x, which must not be 0.
+static inline uint32_t
+bsf(uint32_t x)
+{
+	uint32_t r;
+	asm("bsfl %1, %0" : "=r" (r) : "rm" (x) : "cc");
+	return r;
+}
+
 static inline uint32_t
 xchg(volatile uint32_t *addr, uint32_t newval)
 {
@@ -261,6 +270,32 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically replace *addr with newval if it equals oldval.
+// Returns the value *addr held before the operation.
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1"
+		     : "=a" (result), "+m" (*addr)
+		     : "r" (newval), "0" (oldval)
+		     : "cc", "memory");
+	return result;
+}
+
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+		     : "+r" (inc), "+m" (*addr)
+		     :
+		     : "cc", "memory");
+	return inc;
+}
+
 static inline void
 rdmsr(uint32_t msr, uint32_t* lo, uint32_t* hi)
 {
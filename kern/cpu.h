@@ -23,6 +23,8 @@ struct CpuInfo {
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+	volatile bool cpu_in_user;      // Running cpu_env in user mode
+	volatile uint32_t cpu_tlb_gen;  // tlb_gen as of our last TLB flush
 };
 
 // Initialized in mpconfig.c
@@ -97,9 +97,11 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	// Check that the calling environment has legitimate permission
 	// to manipulate the specified environment.
 	// If checkperm is set, the specified environment
-	// must be either the current environment
-	// or an immediate child of the current environment.
-	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+	// must be either the current environment,
+	// an immediate child of the current environment,
+	// or another thread sharing its address space.
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+	    && e->env_pgdir != curenv->env_pgdir) {
 		*env_store = 0;
 		return -E_BAD_ENV;
 	}
@@ -267,10 +269,17 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_uxstacktop = UXSTACKTOP;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
 
+	// And the futex waiting flag.
+	e->env_futex_waiting = 0;
+
+	// And the system call ring.
+	e->env_uring = NULL;
+
 	// commit the allocation
 	env_free_list = e->env_link;
 	*newenv_store = e;
@@ -472,6 +481,12 @@ env_free(struct Env *e)
 	// Note the environment's demise.
 	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
+	// Threads share their page directory; only the last one out
+	// tears down the address space.
+	pa = PADDR(e->env_pgdir);
+	if (pa2page(pa)->pp_ref > 1)
+		goto free_pgdir;
+
 	// Flush all mapped pages in the user portion of the address space
 	static_assert(UTOP % PTSIZE == 0);
 	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
@@ -497,6 +512,7 @@ env_free(struct Env *e)
 
 	// free the page directory
 	pa = PADDR(e->env_pgdir);
+free_pgdir:
 	e->env_pgdir = 0;
 	page_decref(pa2page(pa));
 
@@ -580,6 +596,8 @@ env_run(struct Env *e)
 	e->env_status = ENV_RUNNING;
 	e->env_runs++;
 	lcr3(PADDR(e->env_pgdir));
+	thiscpu->cpu_tlb_gen = tlb_gen;
+	thiscpu->cpu_in_user = 1;
 
 	// Step 2: Use env_pop_tf() to restore the environment's
 	//	   registers and drop into user mode in the
@@ -0,0 +1,226 @@
+// Futex-style wait queues for user-level synchronization.
+//
+// A futex is just a 32-bit word in user memory.  Waiters are keyed on the
+// physical address of that word rather than on its virtual address, so
+// environments that share a page (e.g. through PTE_SHARE) can wait on and
+// wake each other no matter where each of them has the page mapped.
+//
+// A futex word can also listen for a device interrupt: each time the IRQ
+// fires, the kernel bumps the word and wakes everyone waiting on it.
+// This is how the file server sleeps until its disks finish a transfer.
+// A level-triggered line stays masked after an interrupt, until the
+// listener has quieted the device and listens again.
+
+#include <inc/error.h>
+#include <inc/assert.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/time.h>
+#include <kern/futex.h>
+#include <kern/picirq.h>
+
+// Upper bound of envs sleeping with a deadline, so futex_tick can skip
+// the envs[] scan when nobody is.  Recomputed on every scan, which also
+// forgets waiters that were destroyed while asleep.
+static int nfutex_timed;
+
+// The futex word, if any, that counts each IRQ.
+static struct IrqListener {
+	envid_t il_env;			// who asked; 0 if nobody
+	struct PageInfo *il_page;	// the word's page, pinned
+	physaddr_t il_key;
+} irq_listeners[MAX_IRQS];
+
+// Translate the user address 'va' in env e into its futex key.
+// The word must be 4-byte aligned, below UTOP and mapped user-accessible.
+static int
+futex_key(struct Env *e, const volatile uint32_t *va, physaddr_t *key)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if ((uintptr_t) va % sizeof(uint32_t) || (uintptr_t) va >= UTOP)
+		return -E_INVAL;
+	pp = page_lookup(e->env_pgdir, (void *) va, &pte);
+	if (!pp || !(*pte & PTE_U))
+		return -E_INVAL;
+	*key = page2pa(pp) + PGOFF(va);
+	return 0;
+}
+
+// Make the sleeping env e runnable again, returning 'ret' from its
+// sys_futex_wait.
+static void
+futex_wakeup(struct Env *e, int32_t ret)
+{
+	e->env_futex_waiting = 0;
+	e->env_futex_deadline = 0;
+	e->env_tf.tf_regs.reg_eax = ret;
+	e->env_status = ENV_RUNNABLE;
+}
+
+// Block curenv until another env calls futex_wake on the same word,
+// or 'timeout' milliseconds pass (0 means wait forever).
+//
+// Only returns on error:
+//	-E_INVAL if va is misaligned, above UTOP or not mapped.
+//	-E_AGAIN if *va != val.
+// Otherwise the env sleeps, and the system call later returns 0 when
+// woken or -E_TIMEOUT when the deadline passes.
+int
+futex_wait(const volatile uint32_t *va, uint32_t val, uint32_t timeout)
+{
+	struct Env *e = curenv;
+	physaddr_t key;
+	int r;
+
+	if ((r = futex_key(e, va, &key)) < 0)
+		return r;
+
+	// We hold the kernel lock, and a waker must store the new value
+	// before calling futex_wake, so no wakeup can slip in between this
+	// check and us going to sleep.
+	if (*va != val)
+		return -E_AGAIN;
+
+	e->env_futex_waiting = 1;
+	e->env_futex_key = key;
+	e->env_futex_deadline = 0;
+	if (timeout) {
+		e->env_futex_deadline = time_msec() + timeout;
+		if (e->env_futex_deadline == 0)
+			e->env_futex_deadline = 1;
+		nfutex_timed++;
+	}
+	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_tf.tf_regs.reg_eax = 0;
+	sched_yield();
+}
+
+// Wake up to n envs sleeping on the word with key 'key'.
+static int
+futex_wake_key(physaddr_t key, int n)
+{
+	int i, woken;
+
+	woken = 0;
+	for (i = 0; i < NENV && woken < n; i++) {
+		if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+		    envs[i].env_futex_waiting &&
+		    envs[i].env_futex_key == key) {
+			futex_wakeup(&envs[i], 0);
+			woken++;
+		}
+	}
+	return woken;
+}
+
+// Wake up to n envs sleeping on the word at va.
+// Returns the number of envs woken, or -E_INVAL for a bad va.
+int
+futex_wake(const volatile uint32_t *va, int n)
+{
+	physaddr_t key;
+	int r;
+
+	if ((r = futex_key(curenv, va, &key)) < 0)
+		return r;
+	return futex_wake_key(key, n);
+}
+
+// Count each interrupt on 'irq' in the word at va, waking its waiters,
+// for as long as curenv lives.  Only the file server may listen, and
+// only to the disk controller and PCI lines (8 and up).  Listening
+// again from the same address space unmasks a level-triggered line.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if irq is out of range or va is bad.
+//	-E_BAD_ENV if curenv is not the file server, or another live
+//		address space already listens to irq.
+int
+futex_irq_listen(int irq, volatile uint32_t *va)
+{
+	struct IrqListener *l;
+	struct PageInfo *pp;
+	physaddr_t key;
+	int r;
+
+	if (irq < 8 || irq >= MAX_IRQS)
+		return -E_INVAL;
+	if (curenv->env_type != ENV_TYPE_FS)
+		return -E_BAD_ENV;
+	if ((r = futex_key(curenv, va, &key)) < 0)
+		return r;
+	l = &irq_listeners[irq];
+	if (l->il_env && envs[ENVX(l->il_env)].env_id == l->il_env
+	    && envs[ENVX(l->il_env)].env_status != ENV_FREE) {
+		if (envs[ENVX(l->il_env)].env_pgdir != curenv->env_pgdir)
+			return -E_BAD_ENV;
+		if (l->il_key == key) {
+			irq_mask_line(irq, 0);
+			return 0;
+		}
+	}
+
+	// Pin the page so the word outlives any unmapping.
+	pp = pa2page(key);
+	pp->pp_ref++;
+	if (l->il_env)
+		page_decref(l->il_page);
+	l->il_env = curenv->env_id;
+	l->il_page = pp;
+	l->il_key = key;
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << irq) & ~(1 << IRQ_SLAVE));
+	return 0;
+}
+
+// Deliver interrupt 'irq' to its listener.
+// Returns 1 if someone listens to irq, 0 otherwise.
+bool
+futex_irq(int irq)
+{
+	struct IrqListener *l;
+	struct Env *e;
+
+	if (irq < 0 || irq >= MAX_IRQS || !(l = &irq_listeners[irq])->il_env)
+		return 0;
+	e = &envs[ENVX(l->il_env)];
+	if (e->env_id != l->il_env || e->env_status == ENV_FREE) {
+		// The listener died; leave the line to the default handler.
+		page_decref(l->il_page);
+		l->il_env = 0;
+		return 0;
+	}
+	if (irq_is_level(irq))
+		irq_mask_line(irq, 1);
+	(*(volatile uint32_t *) KADDR(l->il_key))++;
+	futex_wake_key(l->il_key, NENV);
+	return 1;
+}
+
+// Time out sleepers whose deadline has passed.
+// Called once per timer tick with the current time_msec().
+void
+futex_tick(unsigned int now)
+{
+	int i, timed;
+
+	if (nfutex_timed == 0)
+		return;
+
+	timed = 0;
+	for (i = 0; i < NENV; i++) {
+		struct Env *e = &envs[i];
+
+		if (e->env_status != ENV_NOT_RUNNABLE ||
+		    !e->env_futex_waiting || !e->env_futex_deadline)
+			continue;
+		if ((int32_t) (now - e->env_futex_deadline) >= 0)
+			futex_wakeup(e, -E_TIMEOUT);
+		else
+			timed++;
+	}
+	nfutex_timed = timed;
+}
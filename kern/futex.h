@@ -0,0 +1,15 @@
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+int futex_wait(const volatile uint32_t *va, uint32_t val, uint32_t timeout);
+int futex_wake(const volatile uint32_t *va, int n);
+void futex_tick(unsigned int now);
+int futex_irq_listen(int irq, volatile uint32_t *va);
+bool futex_irq(int irq);
+
+#endif /* !JOS_KERN_FUTEX_H */
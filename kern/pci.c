@@ -1,7 +1,9 @@
 #include <inc/x86.h>
 #include <inc/assert.h>
 #include <inc/string.h>
+#include <inc/mmu.h>
 #include <kern/pci.h>
+#include <kern/pmap.h>
 #include <kern/pcireg.h>
 #include <kern/e1000.h>
 
@@ -15,6 +17,18 @@ static uint32_t pci_conf1_data_ioport = 0x0cfc;
 
 // Forward declarations
 static int pci_bridge_attach(struct pci_func *pcif);
+static int pci_storage_attach(struct pci_func *pcif);
+
+// Mass storage functions, handed to the file server by sys_pci_storage.
+#define NPCISTORAGE	4
+static struct pci_func pci_storage[NPCISTORAGE];
+static int npci_storage;
+
+// Physically contiguous pages for device rings, carved out of the
+// kernel image, whose pages are never freed.
+#define NPCIDMA		32
+static uint8_t pci_dma_pool[NPCIDMA * PGSIZE] __attribute__((aligned(PGSIZE)));
+static int npci_dma;
 
 // PCI driver table
 struct pci_driver {
@@ -25,6 +39,7 @@ struct pci_driver {
 // pci_attach_class matches the class and subclass of a PCI device
 struct pci_driver pci_attach_class[] = {
 	{ PCI_CLASS_BRIDGE, PCI_SUBCLASS_BRIDGE_PCI, &pci_bridge_attach },
+	{ PCI_CLASS_MASS_STORAGE, PCI_SUBCLASS_MASS_STORAGE_IDE, &pci_storage_attach },
 	{ 0, 0, 0 },
 };
 
@@ -32,6 +47,7 @@ struct pci_driver pci_attach_class[] = {
 // and key2 should be the vendor ID and device ID respectively
 struct pci_driver pci_attach_vendor[] = {
 	{ PCI_VENDOR_INTEL, PCI_DEVICE_E1000, &e1000_attach },
+	{ PCIDEV_VENDOR_VIRTIO, PCIDEV_PRODUCT_VIRTIO_BLK, &pci_storage_attach },
 	{ 0, 0, 0 },
 };
 
@@ -187,8 +203,53 @@ pci_bridge_attach(struct pci_func *pcif)
 	return 1;
 }
 
+// Enable a disk controller and remember it for the file server,
+// which drives the disks itself.
+static int
+pci_storage_attach(struct pci_func *pcif)
+{
+	if (npci_storage == NPCISTORAGE)
+		return 0;
+	pci_func_enable(pcif);
+	pci_storage[npci_storage++] = *pcif;
+	return 1;
+}
+
 // External PCI subsystem interface
 
+// Fill *pd with the i'th mass storage function found at boot.
+// Returns 0, or -1 if there are not that many.
+int
+pci_storage_get(int i, struct PciDev *pd)
+{
+	struct pci_func *f;
+
+	if (i < 0 || i >= npci_storage)
+		return -1;
+	f = &pci_storage[i];
+	pd->pd_id = f->dev_id;
+	pd->pd_class = f->dev_class;
+	memmove(pd->pd_base, f->reg_base, sizeof pd->pd_base);
+	memmove(pd->pd_size, f->reg_size, sizeof pd->pd_size);
+	pd->pd_irq = f->irq_line;
+	return 0;
+}
+
+// Take npages physically contiguous, zeroed pages from the DMA pool.
+// Returns the first page, or NULL if the pool is used up.
+struct PageInfo*
+pci_dma_alloc(size_t npages)
+{
+	uint8_t *va;
+
+	if (npages > NPCIDMA - npci_dma)
+		return NULL;
+	va = pci_dma_pool + npci_dma * PGSIZE;
+	npci_dma += npages;
+	memset(va, 0, npages * PGSIZE);
+	return pa2page(PADDR(va));
+}
+
 void
 pci_func_enable(struct pci_func *f)
 {
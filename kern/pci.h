@@ -2,6 +2,7 @@
 #define JOS_KERN_PCI_H
 
 #include <inc/types.h>
+#include <inc/pci.h>
 
 // PCI subsystem interface
 enum { pci_res_bus, pci_res_mem, pci_res_io, pci_res_max };
@@ -29,5 +30,7 @@ struct pci_bus {
 
 int  pci_init(void);
 void pci_func_enable(struct pci_func *f);
+int  pci_storage_get(int i, struct PciDev *pd);
+struct PageInfo *pci_dma_alloc(size_t npages);
 
 #endif
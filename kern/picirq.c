@@ -84,6 +84,28 @@ irq_setmask_8259A(uint16_t mask)
 	cprintf("\n");
 }
 
+// Mask or unmask one line, without irq_setmask_8259A's chatter.
+void
+irq_mask_line(int irq, bool masked)
+{
+	if (masked)
+		irq_mask_8259A |= 1 << irq;
+	else
+		irq_mask_8259A &= ~(1 << irq);
+	if (!didinit)
+		return;
+	outb(IO_PIC1+1, (char)irq_mask_8259A);
+	outb(IO_PIC2+1, (char)(irq_mask_8259A >> 8));
+}
+
+// Is 'irq' level-triggered?  The BIOS sets PCI interrupt lines so in
+// the edge/level control registers (ELCR) at 0x4d0 and 0x4d1.
+bool
+irq_is_level(int irq)
+{
+	return (inb(0x4d0 + irq / 8) >> (irq % 8)) & 1;
+}
+
 void
 irq_eoi(void)
 {
@@ -24,6 +24,8 @@ extern uint16_t irq_mask_8259A;
 void pic_init(void);
 void irq_setmask_8259A(uint16_t mask);
 void irq_eoi(void);
+void irq_mask_line(int irq, bool masked);
+bool irq_is_level(int irq);
 #endif // !__ASSEMBLER__
 
 #endif // !JOS_KERN_PICIRQ_H
@@ -603,9 +603,54 @@ page_remove(pde_t *pgdir, void *va)
 	}
 }
 
+// Bumped whenever a page directory shared by several envs changes.
+// Each CPU records the value as of its last full TLB flush.
+volatile uint32_t tlb_gen;
+
+// Make every other CPU that is running pgdir in user mode flush its TLB,
+// and wait until it has.  pgdir only needs this if several envs (threads)
+// share it.  CPUs in the kernel are left alone: they catch up in tlb_sync
+// once they get the kernel lock, which we hold, and in env_run.
+static void
+tlb_shootdown(pde_t *pgdir)
+{
+	struct CpuInfo *c;
+	uint32_t gen;
+	bool sent = 0;
+
+	if (pa2page(PADDR(pgdir))->pp_ref < 2)
+		return;
+	gen = ++tlb_gen;
+	thiscpu->cpu_tlb_gen = gen;
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == thiscpu || !c->cpu_env || c->cpu_env->env_pgdir != pgdir)
+			continue;
+		while (c->cpu_in_user && c->cpu_tlb_gen != gen) {
+			if (!sent) {
+				lapic_ipi(T_TLBFLUSH);
+				sent = 1;
+			}
+			asm volatile("pause");
+		}
+	}
+}
+
+// Flush this CPU's TLB if a shared page directory changed since it last
+// did.  Call after acquiring the kernel lock, before touching user memory.
+void
+tlb_sync(void)
+{
+	if (thiscpu->cpu_tlb_gen != tlb_gen) {
+		thiscpu->cpu_tlb_gen = tlb_gen;
+		lcr3(rcr3());
+	}
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
+// Other CPUs running threads that share the page tables are
+// told to flush too.
 //
 void
 tlb_invalidate(pde_t *pgdir, void *va)
@@ -613,6 +658,7 @@ tlb_invalidate(pde_t *pgdir, void *va)
 	// Flush the entry only if we're modifying the current address space.
 	if (!curenv || curenv->env_pgdir == pgdir)
 		invlpg(va);
+	tlb_shootdown(pgdir);
 }
 
 //
@@ -15,6 +15,9 @@
 #include <kern/time.h>
 #include <kern/e1000.h>
 #include <kern/spinlock.h>
+#include <kern/futex.h>
+#include <kern/uring.h>
+#include <kern/pci.h>
 
 #define debug 0
 #define FSIPCBUF2USTACK(addr)	((void*) (addr)  - (void*)fsipcbuf + (USTACKTOP - PGSIZE))
@@ -73,37 +76,10 @@ envid2pgdirWithCheck(envid_t envid, bool perm)
 	return e->env_pgdir;
 }
 
-// Convert syscall description from number
-static const char*
-syscallname(int no)
-{
-#define RET_SYSCALL_NAME(no) \
-case no: \
-	return #no;
-	switch (no)
-	{
-		RET_SYSCALL_NAME(SYS_cputs);
-		RET_SYSCALL_NAME(SYS_cgetc);
-		RET_SYSCALL_NAME(SYS_getenvid);
-		RET_SYSCALL_NAME(SYS_env_destroy);
-		RET_SYSCALL_NAME(SYS_page_alloc);
-		RET_SYSCALL_NAME(SYS_page_map);
-		RET_SYSCALL_NAME(SYS_page_unmap);
-		RET_SYSCALL_NAME(SYS_exofork);
-		RET_SYSCALL_NAME(SYS_env_set_status);
-		RET_SYSCALL_NAME(SYS_env_set_pgfault_upcall);
-		RET_SYSCALL_NAME(SYS_yield);
-		RET_SYSCALL_NAME(SYS_ipc_try_send);
-		RET_SYSCALL_NAME(SYS_ipc_recv);
-		default:
-			return "Unknown";
-	}
-}
-
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
-// Destroys the environment on memory errors.
-static void
+// Destroys the environment on memory errors.  Returns 0.
+static int
 sys_cputs(const char *s, size_t len)
 {
 	// Check that the user has permission to read memory [s, s+len).
@@ -112,6 +88,7 @@ sys_cputs(const char *s, size_t len)
 
 	// Print the string supplied by the user.
 	cprintf("%.*s", len, s);
+	return 0;
 }
 
 // Read a character from the system console without blocking.
@@ -181,6 +158,92 @@ sys_exofork(void)
 	return e->env_id;
 }
 
+// Allocate a new environment that shares the caller's address space:
+// a thread.  It starts running at 'eip' with stack pointer 'esp', and
+// takes page faults on the exception stack page just below 'uxstacktop'
+// using the caller's page fault upcall.  The new env is runnable at once.
+// It has the caller's env_type, so the file server's threads may act on
+// their clients; ipc_find_env still finds the caller, which comes first
+// in envs[] because special environments are created at boot.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_INVAL if eip, esp or uxstacktop is above UTOP, or uxstacktop
+//		is not page-aligned.
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_thread_create(uintptr_t eip, uintptr_t esp, uintptr_t uxstacktop)
+{
+	struct Env *e;
+	int err;
+
+	if (eip >= UTOP || esp > UTOP || uxstacktop > UTOP || PGOFF(uxstacktop))
+		return -E_INVAL;
+	if ((err = env_alloc(&e, curenv->env_id)) < 0)
+		return err;
+
+	// Trade the fresh page directory for the caller's.
+	page_decref(pa2page(PADDR(e->env_pgdir)));
+	e->env_pgdir = curenv->env_pgdir;
+	pa2page(PADDR(e->env_pgdir))->pp_ref++;
+
+	e->env_tf.tf_eip = eip;
+	e->env_tf.tf_esp = esp;
+	e->env_tf.tf_eflags = curenv->env_tf.tf_eflags | FL_IF;
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_uxstacktop = uxstacktop;
+	e->env_type = curenv->env_type;
+	e->env_status = ENV_RUNNABLE;
+	return e->env_id;
+}
+
+// Count interrupts on irq in the word at counter, waking its waiters
+// each time (see futex_irq_listen).
+static int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+	return futex_irq_listen(irq, counter);
+}
+
+// Copy the i'th PCI mass storage function found at boot into *pd.
+// Returns 0 on success, -E_INVAL if there is no such function.
+static int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+	user_mem_assert(curenv, pd, sizeof *pd, PTE_U|PTE_W);
+	if (pci_storage_get(i, pd) < 0)
+		return -E_INVAL;
+	return 0;
+}
+
+// Map npages physically contiguous pages at va, read-write, for the
+// file server to share with a device.  The pages are
+// never given back.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if curenv is not the file server.
+//	-E_INVAL if va is not page-aligned or the range reaches UTOP.
+//	-E_NO_MEM if the pool or page table memory runs out.
+static int
+sys_dma_map(void *va, size_t npages)
+{
+	struct PageInfo *pp;
+	size_t i;
+	int r;
+
+	if (curenv->env_type != ENV_TYPE_FS)
+		return -E_BAD_ENV;
+	if (PGOFF(va) || npages > (UTOP - (uintptr_t) va) / PGSIZE)
+		return -E_INVAL;
+	if (!(pp = pci_dma_alloc(npages)))
+		return -E_NO_MEM;
+	for (i = 0; i < npages; i++)
+		if ((r = page_insert(curenv->env_pgdir, pp + i,
+				     (uint8_t *) va + i * PGSIZE, PTE_U|PTE_W|PTE_P)) < 0)
+			return r;
+	return 0;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -377,13 +440,14 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	// check perm
 	CHECK_ARG_PERM(perm);
 
-	if ((r = envid2env(srcenvid, &env, 1)) < 0) {
+	// allow FS to map pages between any envs, so that it can map its
+	// clients' buffers as well as hand them its own pages
+	if ((r = envid2env(srcenvid, &env, curenv->env_type != ENV_TYPE_FS)) < 0) {
 		log("Envid invalid, eid: 0x%x, err: %e", srcenvid, r);
 		return r;
 	}
 	srcpgdir = env->env_pgdir;
-	// allow FS map pages to any env
-	if (env->env_type == ENV_TYPE_FS && dstenvid != env->env_id) {
+	if (curenv->env_type == ENV_TYPE_FS) {
 		checkDstEnv = 0;
 	}
 
@@ -771,9 +835,13 @@ sys_exec(const char* pathname, const char*argv[])
 	int r;
 	struct Env *e;
 	union Fsipc *fsipcbuf;
+	// other threads still live in this address space
+	if (pa2page(PADDR(curenv->env_pgdir))->pp_ref > 1)
+		return -E_INVAL;
 	// if FS env is not recving, just back and try again
 	if (!envs[0].env_ipc_recving) {
-		// machine code `int 48` is 2 byte
+		// `int 48` and `sysenter` are both 2 bytes, and both entry
+		// paths leave a complete trapframe for this call.
 		curenv->env_tf.tf_eip -= 2;
 		sys_yield();
 	}
@@ -799,6 +867,8 @@ sys_exec(const char* pathname, const char*argv[])
 		goto error;
 	}
 	free_user_vm(e);
+	e->env_uring = NULL;
+	e->env_uxstacktop = UXSTACKTOP;
 	if (debug)
 		Debug("Finish stack init\n");
 	// load elf
@@ -840,132 +910,198 @@ sys_net_try_recv(uint8_t* buf, size_t length)
 	return e1000_recv(buf, length);
 }
 
+// Block until the 32-bit word at 'addr' is woken by sys_futex_wake,
+// provided it still holds 'val'.  The word is identified by its physical
+// address, so envs sharing the page can synchronize on it.
+// 'timeout' is in milliseconds; 0 means wait forever.
+//
+// Returns 0 once woken, < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned, >= UTOP, or not mapped.
+//	-E_AGAIN if *addr != val.
+//	-E_TIMEOUT if the timeout expired before a wakeup.
+static int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+	return futex_wait(addr, val, timeout);
+}
+
+// Wake up to 'n' environments blocked in sys_futex_wait on 'addr'.
+//
+// Returns the number of environments woken, < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned, >= UTOP, or not mapped.
+static int
+sys_futex_wake(const volatile uint32_t *addr, int n)
+{
+	return futex_wake(addr, n);
+}
+
+// Register the zeroed page at 'va' as the calling environment's system
+// call ring (see inc/uring.h), or unregister it if va is 0.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va is not page-aligned, >= UTOP, or not mapped
+//		user-writable.
+static int
+sys_uring_setup(void *va)
+{
+	return uring_setup(va);
+}
+
+// Ring the doorbell: run the calls queued on the environment's ring now
+// instead of waiting for its next kernel entry.
+//
+// Returns the number of calls run, < 0 on error.  Errors are:
+//	-E_INVAL if the ring's indices are corrupt.
+static int
+sys_uring_enter(void)
+{
+	return uring_drain(curenv);
+}
+
+typedef int32_t (*syscall_fn)(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t);
+
+// Flags for struct Syscall
+#define SC_TF		0x1	// Reads or writes the caller's trapframe, or
+				// may give up the CPU, so sysenter must save
+				// a complete trapframe and return via env_run.
+
+struct Syscall {
+	syscall_fn sc_fn;
+	const char *sc_name;
+	int sc_nargs;
+	int sc_flags;
+};
+
+#define SYSCALL(no, fn, nargs, flags) \
+	[no] = { (syscall_fn) (fn), #no, (nargs), (flags) }
+
+// Every system call, indexed by number.  Both the int 0x30 trap and
+// the sysenter fast path dispatch through this table.
+static const struct Syscall syscalls[] = {
+	SYSCALL(SYS_cputs, sys_cputs, 2, 0),
+	SYSCALL(SYS_cgetc, sys_cgetc, 0, 0),
+	SYSCALL(SYS_getenvid, sys_getenvid, 0, 0),
+	SYSCALL(SYS_env_destroy, sys_env_destroy, 1, 0),
+	SYSCALL(SYS_page_alloc, sys_page_alloc, 3, 0),
+	SYSCALL(SYS_page_map, sys_page_map, 5, 0),
+	SYSCALL(SYS_page_unmap, sys_page_unmap, 2, 0),
+	SYSCALL(SYS_exofork, sys_exofork, 0, SC_TF),
+	SYSCALL(SYS_env_set_status, sys_env_set_status, 2, 0),
+	SYSCALL(SYS_env_set_trapframe, sys_env_set_trapframe, 2, SC_TF),
+	SYSCALL(SYS_env_set_pgfault_upcall, sys_env_set_pgfault_upcall, 2, 0),
+	SYSCALL(SYS_yield, sys_yield, 0, SC_TF),
+	SYSCALL(SYS_ipc_try_send, sys_ipc_try_send, 4, 0),
+	SYSCALL(SYS_ipc_recv, sys_ipc_recv, 1, SC_TF),
+	SYSCALL(SYS_time_msec, sys_time_msec, 0, 0),
+	SYSCALL(SYS_net_try_send, sys_net_try_send, 2, 0),
+	SYSCALL(SYS_net_try_recv, sys_net_try_recv, 2, 0),
+	SYSCALL(SYS_futex_wait, sys_futex_wait, 3, SC_TF),
+	SYSCALL(SYS_futex_wake, sys_futex_wake, 2, 0),
+	SYSCALL(SYS_uring_setup, sys_uring_setup, 1, 0),
+	SYSCALL(SYS_uring_enter, sys_uring_enter, 0, 0),
+	SYSCALL(SYS_thread_create, sys_thread_create, 3, 0),
+	SYSCALL(SYS_irq_listen, sys_irq_listen, 2, 0),
+	SYSCALL(SYS_pci_storage, sys_pci_storage, 2, 0),
+	SYSCALL(SYS_dma_map, sys_dma_map, 2, 0),
+	SYSCALL(SYS_exec, sys_exec, 2, SC_TF),
+};
+
+static const struct Syscall *
+syscall_lookup(uint32_t syscallno)
+{
+	if (syscallno >= ARRAY_SIZE(syscalls) || !syscalls[syscallno].sc_fn)
+		return NULL;
+	return &syscalls[syscallno];
+}
+
+// Convert syscall description from number
+static const char*
+syscallname(uint32_t syscallno)
+{
+	const struct Syscall *sc = syscall_lookup(syscallno);
+
+	return sc ? sc->sc_name : "Unknown";
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 int32_t
 syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
+	const struct Syscall *sc = syscall_lookup(syscallno);
+
 	// log("syscall %s", syscallname(syscallno));
-	// Call the function corresponding to the 'syscallno' parameter.
-	// Return any appropriate return value.
-	switch (syscallno) {
-	case SYS_cputs:
-		sys_cputs((const char*)a1, (size_t)a2);
-		return 0;
-	case SYS_cgetc:
-		return sys_cgetc();
-	case SYS_getenvid:
-		return sys_getenvid();
-	case SYS_env_destroy:
-		return sys_env_destroy((envid_t)a1);
-	case SYS_yield:
-		sys_yield();
-		return 0;
-	case SYS_exofork:
-		return sys_exofork();
-	case SYS_env_set_status:
-		return sys_env_set_status((envid_t)a1, a2);
-	case SYS_page_alloc:
-		return sys_page_alloc((envid_t)a1, (void*)a2, a3);
-	case SYS_page_map:
-		return sys_page_map((envid_t)a1, (void*)a2, (envid_t)a3, (void*)a4, a5);
-	case SYS_page_unmap:
-		return sys_page_unmap((envid_t)a1, (void*)a2);
-	case SYS_env_set_pgfault_upcall:
-		return sys_env_set_pgfault_upcall((envid_t)a1, (void*)a2);
-	case SYS_ipc_try_send:
-		return sys_ipc_try_send((envid_t)a1, a2, (void*)a3, a4);
-	case SYS_ipc_recv:
-		return sys_ipc_recv((void*)a1);
-	case SYS_env_set_trapframe:
-		return sys_env_set_trapframe((envid_t)a1, (struct Trapframe*)a2);
-	case SYS_exec:
-		return sys_exec((const char*)a1, (const char**)a2);
-	case SYS_time_msec:
-		return sys_time_msec();
-	case SYS_net_try_send:
-		return sys_net_try_send((uint8_t*)a1, (size_t)a2);
-	case SYS_net_try_recv:
-		return sys_net_try_recv((uint8_t*)a1, (size_t)a2);
-	default:
+	if (!sc)
 		return -E_INVAL;
-	}
+	return sc->sc_fn(a1, a2, a3, a4, a5);
 }
 
+// Fast system call entry, from sysenter_handler in trapentry.S.
+// The user stub (lib/syscall.c) passes the number in eax, the first
+// four arguments in edx, ecx, ebx and edi, its return address in esi
+// and its stack pointer in ebp, and pushes the fifth argument just
+// above the saved esi and ebp on its stack.
+//
+// Calls that do not touch the trapframe return straight back through
+// sysexit.  The others get a complete trapframe, as if they had come
+// in through int 0x30, and leave through env_run or sched_yield.
 int32_t
 sysenter_wrapper(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t eip, uint32_t esp)
 {
-#define STORE_TF \
-curenv->env_tf.tf_cs = GD_UT | 3; \
-curenv->env_tf.tf_eip = eip; \
-curenv->env_tf.tf_ss = GD_UD | 3; \
-curenv->env_tf.tf_esp = esp; \
-curenv->env_tf.tf_eflags = read_eflags() | FL_IF;
-	log("sysenter %s, eip: %p, esp: %p", syscallname(syscallno), eip, esp);
-	int r;
+	const struct Syscall *sc;
+	struct Trapframe *tf;
+	uint32_t eflags = read_eflags();
+	uint32_t a5 = 0;
+	int32_t r;
+
 	asm volatile("cld" ::: "cc");
+	thiscpu->cpu_in_user = 0;
 	lock_kernel();
+	tlb_sync();
 	assert(curenv);
-	switch(syscallno) {
-	case SYS_cputs:
-		sys_cputs((const char*)a1, (size_t)a2);
-		r = 0;
-		break;
-	case SYS_cgetc:
-		r = sys_cgetc();
-		break;
-	case SYS_getenvid:
-		r = sys_getenvid();
-		break;
-	case SYS_env_destroy:
-		r = sys_env_destroy((envid_t)a1);
-		break;
-	case SYS_exofork:
-		r = sys_exofork();
-		break;
-	case SYS_env_set_status:
-		r = sys_env_set_status((envid_t)a1, a2);
-		break;
-	case SYS_page_alloc:
-		r = sys_page_alloc((envid_t)a1, (void*)a2, a3);
-		break;
-	case SYS_page_unmap:
-		r = sys_page_unmap((envid_t)a1, (void*)a2);
-		break;
-	case SYS_env_set_pgfault_upcall:
-		r = sys_env_set_pgfault_upcall((envid_t)a1, (void*)a2);
-		break;
-	case SYS_ipc_try_send:
-		r = sys_ipc_try_send((envid_t)a1, a2, (void*)a3, a4);
-		break;
-	case SYS_yield:
-		STORE_TF;
-		sys_yield();
-		return 0;
-	case SYS_ipc_recv:
-		STORE_TF;
-		r = sys_ipc_recv((void*)a1);
-		break;
-	case SYS_env_set_trapframe:
-		STORE_TF;
-		r = sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
-		break;
-	case SYS_exec:
-		STORE_TF;
-		r = sys_exec((const char*)a1, (const char**)a2);
-	case SYS_time_msec:
-		STORE_TF;
-		r = sys_time_msec();
-	case SYS_net_try_send:
-		STORE_TF;
-		r = sys_net_try_send((uint8_t*)a1, (size_t)a2);
-	case SYS_net_try_recv:
-		STORE_TF;
-		return sys_net_try_recv((uint8_t*)a1, (size_t)a2);
-	default:
-		r = -E_INVAL;
+	log("sysenter %s, eip: %p, esp: %p", syscallname(syscallno), eip, esp);
+
+	// Calls queued earlier go first.
+	if (curenv->env_uring)
+		uring_drain(curenv);
+
+	sc = syscall_lookup(syscallno);
+	if (sc && sc->sc_nargs > 4) {
+		if (user_mem_check(curenv, (void *) esp + 8, 4, PTE_U) < 0) {
+			r = -E_FAULT;
+			goto out;
+		}
+		a5 = *(uint32_t *) (esp + 8);
 	}
 
+	if (!sc || !(sc->sc_flags & SC_TF)) {
+		r = syscall(syscallno, a1, a2, a3, a4, a5);
+		goto out;
+	}
+
+	// Build the trapframe the user stub would have produced with
+	// int 0x30 just before its sysenter instruction.  sysenter itself
+	// leaves eflags alone apart from IF, so IOPL and friends survive.
+	tf = &curenv->env_tf;
+	tf->tf_regs.reg_eax = syscallno;
+	tf->tf_regs.reg_edx = a1;
+	tf->tf_regs.reg_ecx = a2;
+	tf->tf_regs.reg_ebx = a3;
+	tf->tf_regs.reg_edi = a4;
+	tf->tf_regs.reg_esi = eip;
+	tf->tf_regs.reg_ebp = esp;
+	tf->tf_cs = GD_UT | 3;
+	tf->tf_eip = eip;
+	tf->tf_ss = GD_UD | 3;
+	tf->tf_esp = esp;
+	tf->tf_eflags = eflags | FL_IF;
+
+	tf->tf_regs.reg_eax = syscall(syscallno, a1, a2, a3, a4, a5);
+	if (curenv->env_status == ENV_RUNNING)
+		env_run(curenv);
+	sched_yield();
+
+out:
+	thiscpu->cpu_in_user = 1;
 	unlock_kernel();
 	return r;
 }
-
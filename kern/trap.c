@@ -14,6 +14,8 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/futex.h>
+#include <kern/uring.h>
 
 #define IA32_SYSENTER_CS  0x174
 #define IA32_SYSENTER_EIP 0x176
@@ -74,7 +76,11 @@ case IRQ_OFFSET + IRQ_##name: \
 			RETURN_IRQ_DESC(KBD);
 			RETURN_IRQ_DESC(SERIAL);
 			RETURN_IRQ_DESC(SPURIOUS);
+			RETURN_IRQ_DESC(PCI9);
+			RETURN_IRQ_DESC(PCI10);
+			RETURN_IRQ_DESC(PCI11);
 			RETURN_IRQ_DESC(IDE);
+			RETURN_IRQ_DESC(IDE2);
 			RETURN_IRQ_DESC(ERROR);
 
 #undef RETURN_IRQ_DESC
@@ -138,10 +144,15 @@ trap_init(void)
 	IDT_SET_EXTERNAL_INTR_MEMBER(KBD);
 	IDT_SET_EXTERNAL_INTR_MEMBER(SERIAL);
 	IDT_SET_EXTERNAL_INTR_MEMBER(SPURIOUS);
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI9);
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI10);
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI11);
 	IDT_SET_EXTERNAL_INTR_MEMBER(IDE);
+	IDT_SET_EXTERNAL_INTR_MEMBER(IDE2);
 	IDT_SET_EXTERNAL_INTR_MEMBER(ERROR);
 
 	IDT_SET_INTR_MEMBER_USER(SYSCALL);
+	IDT_SET_INTR_MEMBER(TLBFLUSH);
 
 	// Per-CPU setup 
 	trap_init_percpu();
@@ -263,6 +274,9 @@ trap_dispatch(struct Trapframe *tf)
 		page_fault_handler(tf);
 		break;
 	case T_SYSCALL:
+		// Calls queued earlier go first.
+		if (curenv->env_uring)
+			uring_drain(curenv);
 		tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx, tf->tf_regs.reg_ecx, tf->tf_regs.reg_ebx, tf->tf_regs.reg_edi, tf->tf_regs.reg_esi);
 		return;
 	// Handle clock interrupts.
@@ -272,10 +286,15 @@ trap_dispatch(struct Trapframe *tf)
 		// triggered on every CPU.
 		if (thiscpu->cpu_id == 0) {
 			time_tick();
+			futex_tick(time_msec());
 		}
 		//Don't forget to acknowledge the interrupt using lapic_eoi() 
 		// before calling the scheduler!
 		lapic_eoi();
+		// Make progress on the interrupted env's queued calls.
+		if (curenv && curenv->env_status == ENV_RUNNING
+		    && curenv->env_uring)
+			uring_drain(curenv);
 		sched_yield();
 		return;
 	// Handle keyboard and serial interrupts.
@@ -285,6 +304,16 @@ trap_dispatch(struct Trapframe *tf)
 	case IRQ_OFFSET + IRQ_SERIAL:
 		serial_intr();
 		return;
+	// Disk interrupts just wake the file server, which asked for them.
+	case IRQ_OFFSET + IRQ_PCI9:
+	case IRQ_OFFSET + IRQ_PCI10:
+	case IRQ_OFFSET + IRQ_PCI11:
+	case IRQ_OFFSET + IRQ_IDE:
+	case IRQ_OFFSET + IRQ_IDE2:
+		futex_irq(tf->tf_trapno - IRQ_OFFSET);
+		// The slave 8259A is not in automatic EOI mode.
+		irq_eoi();
+		return;
 	// Handle spurious interrupts
 	// The hardware sometimes raises these because of noise on the
 	// IRQ line or other reasons. We don't care.
@@ -311,6 +340,16 @@ trap(struct Trapframe *tf)
 	// of GCC rely on DF being clear
 	asm volatile("cld" ::: "cc");
 
+	// Answer TLB shootdowns without taking the kernel lock: the
+	// CPU asking for one holds it while it waits for us.
+	if (tf->tf_trapno == T_TLBFLUSH) {
+		lcr3(rcr3());
+		thiscpu->cpu_tlb_gen = tlb_gen;
+		lapic_eoi();
+		env_pop_tf(tf);
+	}
+	thiscpu->cpu_in_user = 0;
+
 	// Halt the CPU if some other CPU has called panic()
 	extern char *panicstr;
 	if (panicstr)
@@ -318,8 +357,10 @@ trap(struct Trapframe *tf)
 
 	// Re-acqurie the big kernel lock if we were halted in
 	// sched_yield()
-	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
 		lock_kernel();
+		tlb_sync();
+	}
 	// Check that interrupts are disabled.  If this assertion
 	// fails, DO NOT be tempted to fix it by inserting a "cli" in
 	// the interrupt path.
@@ -341,6 +382,7 @@ trap(struct Trapframe *tf)
 		// Acquire the big kernel lock before doing any
 		// serious kernel work.
 		lock_kernel();
+		tlb_sync();
 		assert(curenv);
 
 		// Garbage collect if current enviroment is a zombie
@@ -421,6 +463,7 @@ page_fault_handler(struct Trapframe *tf)
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
 	struct UTrapframe *utf;
+	uintptr_t uxstacktop = curenv->env_uxstacktop;
 	int r;
 
 	// If there's no page fault upcall, destroy env
@@ -430,22 +473,23 @@ page_fault_handler(struct Trapframe *tf)
 	}
 	// if the environment didn't allocate a page for its exception stack or 
 	// can't write to it, destroy env
-	if ((r = user_mem_check2(curenv, (void*)(UXSTACKTOP - PGSIZE), PGSIZE, PTE_P | PTE_U | PTE_W, NULL)) < 0) {
+	if ((r = user_mem_check2(curenv, (void*)(uxstacktop - PGSIZE), PGSIZE, PTE_P | PTE_U | PTE_W, NULL)) < 0) {
 		log("there's no mapped user exception stack");
 		goto destroy_env;
 	}
-	// if the exception stack overflows, destroy env
-	if (tf->tf_esp < UXSTACKTOP-PGSIZE && tf->tf_esp >= USTACKTOP) {
+	// if the exception stack overflows into the empty page below it,
+	// destroy env
+	if (tf->tf_esp < uxstacktop-PGSIZE && tf->tf_esp >= uxstacktop-2*PGSIZE) {
 		log("user exception stack overflow, %p", tf->tf_esp);
 		goto destroy_env;
 	}
 	
 	// set user exception stack
 	// recursive case, 
-	if (tf->tf_esp >= UXSTACKTOP-PGSIZE && tf->tf_esp < UXSTACKTOP) {
+	if (tf->tf_esp >= uxstacktop-PGSIZE && tf->tf_esp < uxstacktop) {
 		utf = (void*)tf->tf_esp - 4 - sizeof(struct UTrapframe);
 	} else {
-		utf = (void*)UXSTACKTOP - sizeof(struct UTrapframe);
+		utf = (void*)uxstacktop - sizeof(struct UTrapframe);
 	}
 	utf->utf_eflags = tf->tf_eflags;
 	utf->utf_eip = tf->tf_eip;
@@ -0,0 +1,128 @@
+// Asynchronous system call rings.  See inc/uring.h for the layout.
+//
+// The ring page is looked up in the env's page table every time it is
+// used, rather than pinned at setup, so that the copy-on-write fault the
+// env takes on it after a fork moves the ring along with the mapping.
+
+#include <inc/error.h>
+#include <inc/assert.h>
+#include <inc/uring.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/syscall.h>
+#include <kern/uring.h>
+
+// Return the kernel address of e's ring, or NULL if it has none or the
+// page is not mapped user-writable right now.  The latter happens while
+// the page is still shared copy-on-write after a fork; the env's next
+// write to it, such as queueing a call, fixes that.
+static struct Uring *
+uring_map(struct Env *e)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if (!e->env_uring)
+		return NULL;
+	pp = page_lookup(e->env_pgdir, e->env_uring, &pte);
+	if (!pp || (*pte & (PTE_U|PTE_W)) != (PTE_U|PTE_W))
+		return NULL;
+	return page2kva(pp);
+}
+
+// Can system call 'op' be issued through the ring?  It must neither
+// block nor switch away from the calling env.
+static bool
+uring_allowed(uint32_t op)
+{
+	switch (op) {
+	case SYS_cputs:
+	case SYS_cgetc:
+	case SYS_getenvid:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_env_set_status:
+	case SYS_env_set_pgfault_upcall:
+	case SYS_ipc_try_send:
+	case SYS_time_msec:
+	case SYS_net_try_send:
+	case SYS_net_try_recv:
+	case SYS_futex_wake:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// Register the page at va as curenv's ring, replacing any previous one.
+// The page must be zeroed by the caller before the first call is queued.
+// A null va unregisters the ring.
+//
+// Returns 0 on success, -E_INVAL if va is not page-aligned, is above
+// UTOP, or is not mapped user-writable.
+int
+uring_setup(void *va)
+{
+	void *old = curenv->env_uring;
+
+	if (va == NULL) {
+		curenv->env_uring = NULL;
+		return 0;
+	}
+	if (PGOFF(va) || (uintptr_t) va >= UTOP)
+		return -E_INVAL;
+	curenv->env_uring = va;
+	if (!uring_map(curenv)) {
+		curenv->env_uring = old;
+		return -E_INVAL;
+	}
+	return 0;
+}
+
+// Run the calls queued on e's ring and post their results, stopping
+// when the submission queue is empty, the completion queue is full, or
+// URING_NSQE calls have run, whichever comes first.  e must be curenv.
+// A queued call may destroy e, in which case this does not return.
+//
+// Returns the number of calls run, or -E_INVAL if the queue indices
+// are corrupt.
+int
+uring_drain(struct Env *e)
+{
+	struct Uring *u;
+	struct UringSqe sqe;
+	struct UringCqe *cqe;
+	int32_t res;
+	int n;
+
+	assert(e == curenv);
+	for (n = 0; n < URING_NSQE; n++) {
+		if (!(u = uring_map(e)))
+			break;
+		if (u->sq_tail - u->sq_head > URING_NSQE)
+			return -E_INVAL;
+		if (u->sq_head == u->sq_tail
+		    || u->cq_tail - u->cq_head >= URING_NCQE)
+			break;
+
+		// Copy the entry out first: the env can scribble on it,
+		// and the call itself can unmap the ring.
+		sqe = u->sq[u->sq_head % URING_NSQE];
+		u->sq_head++;
+		if (uring_allowed(sqe.sqe_op))
+			res = syscall(sqe.sqe_op, sqe.sqe_arg[0], sqe.sqe_arg[1],
+				      sqe.sqe_arg[2], sqe.sqe_arg[3], sqe.sqe_arg[4]);
+		else
+			res = -E_INVAL;
+
+		if (!(u = uring_map(e)))
+			break;
+		cqe = &u->cq[u->cq_tail % URING_NCQE];
+		cqe->cqe_data = sqe.sqe_data;
+		cqe->cqe_res = res;
+		u->cq_tail++;
+	}
+	return n;
+}
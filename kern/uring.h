@@ -0,0 +1,12 @@
+#ifndef JOS_KERN_URING_H
+#define JOS_KERN_URING_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/env.h>
+
+int uring_setup(void *va);
+int uring_drain(struct Env *e);
+
+#endif /* !JOS_KERN_URING_H */
@@ -0,0 +1,235 @@
+// Asynchronous file reads and writes: up to AIO_MAX requests to the
+// file server in flight at once, completed in any order.  Each request
+// slot has its own request page, and the server posts completions on a
+// queue page registered with FSREQ_AIO_SETUP (see inc/fs.h).
+
+#include <inc/fs.h>
+#include <inc/lib.h>
+
+#define debug 0
+
+// The completion queue page, followed by one request page per slot.
+// They are PTE_SHARE so that a fork does not make them copy-on-write
+// under the server's feet; the child sets up its own.
+#define AIOVA		0xCF000000
+#define AIO_PERM	(PTE_P | PTE_U | PTE_W | PTE_SHARE)
+
+enum {
+	AIO_FREE = 0,
+	AIO_PENDING,
+	AIO_DONE,
+};
+
+struct Aio {
+	int a_state;
+	int a_res;		// result, once AIO_DONE
+	void *a_buf;		// where read data goes, NULL for writes
+};
+
+static struct Aio aios[AIO_MAX];
+static struct FsaioCq *aio_cq = (struct FsaioCq*) AIOVA;
+static pde_t *aio_pgdir;	// address space that registered aio_cq
+static envid_t aio_fsenv;
+static struct mutex aio_mu;
+
+static union Fsipc*
+aio_page(int id)
+{
+	return (union Fsipc*) (AIOVA + (id + 1) * PGSIZE);
+}
+
+// Map the queue and request pages and register the queue with the
+// file server, unless this address space has done so already.
+// Call with aio_mu held.
+static int
+aio_init(void)
+{
+	int i, r;
+
+	if (aio_pgdir == thisenv->env_pgdir)
+		return 0;
+	memset(aios, 0, sizeof aios);
+	for (i = 0; i <= AIO_MAX; i++)
+		if ((r = sys_page_alloc(0, (void*) (AIOVA + i * PGSIZE), AIO_PERM)) < 0)
+			return r;
+	aio_fsenv = ipc_find_env(ENV_TYPE_FS);
+	ipc_send(aio_fsenv, FSREQ_AIO_SETUP, aio_cq, PTE_P | PTE_W | PTE_U);
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+		return r;
+	aio_pgdir = thisenv->env_pgdir;
+	return 0;
+}
+
+// Set up the aio state if needed and claim a free slot for a request
+// whose data goes to buf.  Returns the slot, or < 0 on error.
+static int
+aio_alloc(void *buf)
+{
+	int id, r;
+
+	mutex_lock(&aio_mu);
+	if ((r = aio_init()) < 0)
+		goto out;
+	r = -E_AGAIN;
+	for (id = 0; id < AIO_MAX; id++)
+		if (aios[id].a_state == AIO_FREE) {
+			aios[id].a_state = AIO_PENDING;
+			aios[id].a_buf = buf;
+			r = id;
+			break;
+		}
+out:
+	mutex_unlock(&aio_mu);
+	return r;
+}
+
+static int
+aio_fileid(int fdnum, int *fileid)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	*fileid = fd->fd_file.id;
+	return 0;
+}
+
+// Start reading at most n bytes of fdnum at offset into buf, which
+// must stay valid until the request is reaped.  At most PGSIZE bytes
+// are read per request.  The seek position is not used or changed.
+// Returns the request id, or < 0 on error: -E_AGAIN if AIO_MAX
+// requests are outstanding or not yet reaped.
+int
+aio_read(int fdnum, void *buf, size_t n, off_t offset)
+{
+	union Fsipc *ipc;
+	int fileid, id, r;
+
+	if ((r = aio_fileid(fdnum, &fileid)) < 0)
+		return r;
+	if (offset < 0)
+		return -E_INVAL;
+	if ((id = aio_alloc(buf)) < 0)
+		return id;
+	ipc = aio_page(id);
+	ipc->pread.req_fileid = fileid;
+	ipc->pread.req_n = MIN(n, sizeof(ipc->readRet.ret_buf));
+	ipc->pread.req_offset = offset;
+	ipc_send(aio_fsenv, FSAIO(FSREQ_PREAD, id), ipc, PTE_P | PTE_W | PTE_U);
+	return id;
+}
+
+// Start writing at most n bytes from buf to fdnum at offset.  buf is
+// copied before this returns; fewer than PGSIZE bytes are written per
+// request.  Returns the request id, or < 0 on error as for aio_read.
+int
+aio_write(int fdnum, const void *buf, size_t n, off_t offset)
+{
+	union Fsipc *ipc;
+	int fileid, id, r;
+
+	if ((r = aio_fileid(fdnum, &fileid)) < 0)
+		return r;
+	if (offset < 0)
+		return -E_INVAL;
+	if ((id = aio_alloc(NULL)) < 0)
+		return id;
+	ipc = aio_page(id);
+	ipc->pwrite.req_fileid = fileid;
+	ipc->pwrite.req_n = MIN(n, sizeof(ipc->pwrite.req_buf));
+	ipc->pwrite.req_offset = offset;
+	memmove(ipc->pwrite.req_buf, buf, ipc->pwrite.req_n);
+	ipc_send(aio_fsenv, FSAIO(FSREQ_PWRITE, id), ipc, PTE_P | PTE_W | PTE_U);
+	return id;
+}
+
+// Move posted completions from the queue to their slots, copying read
+// data out.  Call with aio_mu held.
+static void
+aio_drain(void)
+{
+	struct FsaioCqe *cqe;
+	struct Aio *a;
+
+	while (aio_cq->cq_head != aio_cq->cq_tail) {
+		// Read the entry only after seeing the tail move past it,
+		// and finish with it before giving the slot back.
+		asm volatile("" ::: "memory");
+		cqe = &aio_cq->cq[aio_cq->cq_head % FSAIO_NCQE];
+		if (cqe->cqe_tag < AIO_MAX
+		    && aios[cqe->cqe_tag].a_state == AIO_PENDING) {
+			a = &aios[cqe->cqe_tag];
+			a->a_res = cqe->cqe_res;
+			if (a->a_buf && a->a_res > 0)
+				memmove(a->a_buf, aio_page(cqe->cqe_tag)->readRet.ret_buf, a->a_res);
+			a->a_state = AIO_DONE;
+		} else if (debug)
+			cprintf("aio: stray completion %d\n", cqe->cqe_tag);
+		asm volatile("" ::: "memory");
+		aio_cq->cq_head++;
+	}
+}
+
+// Wait until request id is done, or any request if id is -1, then
+// free its slot and return its result, storing its id in *id_store.
+static int
+aio_complete(int id, int *id_store)
+{
+	uint32_t tail;
+	int i, r;
+
+	mutex_lock(&aio_mu);
+	if ((r = aio_init()) < 0)
+		goto out;
+	while (1) {
+		aio_drain();
+		r = -E_INVAL;
+		for (i = 0; i < AIO_MAX; i++) {
+			if (id >= 0 && i != id)
+				continue;
+			if (aios[i].a_state == AIO_DONE)
+				goto done;
+			if (aios[i].a_state == AIO_PENDING)
+				r = 0;
+		}
+		// Nothing to wait for?
+		if (r < 0)
+			goto out;
+		tail = aio_cq->cq_tail;
+		if (tail != aio_cq->cq_head)
+			continue;
+		mutex_unlock(&aio_mu);
+		sys_futex_wait(&aio_cq->cq_tail, tail, 0);
+		mutex_lock(&aio_mu);
+	}
+done:
+	aios[i].a_state = AIO_FREE;
+	r = aios[i].a_res;
+	if (id_store)
+		*id_store = i;
+out:
+	mutex_unlock(&aio_mu);
+	return r;
+}
+
+// Wait for request id to finish and return its result: the number of
+// bytes read or written, or < 0 on error.  -E_INVAL if id is not an
+// outstanding request.
+int
+aio_wait(int id)
+{
+	if (id < 0 || id >= AIO_MAX)
+		return -E_INVAL;
+	return aio_complete(id, NULL);
+}
+
+// Wait for any outstanding request to finish, store its id in
+// *id_store and return its result as for aio_wait.
+int
+aio_reap(int *id_store)
+{
+	return aio_complete(-1, id_store);
+}
@@ -4,6 +4,8 @@
 void
 exit(void)
 {
+	fflush(0);
+	pthread_kill_others();
 	close_all();
 	sys_env_destroy(0);
 }
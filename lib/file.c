@@ -5,6 +5,9 @@
 #define debug 0
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
+// Threads share fsipcbuf; one request at a time.  Callers that fill in
+// fsipcbuf before calling fsipc must hold it too.
+static struct mutex fsipc_mu;
 
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
@@ -77,10 +80,12 @@ open(const char *path, int mode)
 	if ((r = fd_alloc(&fd)) < 0)
 		return r;
 
+	mutex_lock(&fsipc_mu);
 	strcpy(fsipcbuf.open.req_path, path);
 	fsipcbuf.open.req_omode = mode;
-
-	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+	r = fsipc(FSREQ_OPEN, fd);
+	mutex_unlock(&fsipc_mu);
+	if (r < 0) {
 		fd_close(fd, 0);
 		return r;
 	}
@@ -99,8 +104,13 @@ open(const char *path, int mode)
 static int
 devfile_flush(struct Fd *fd)
 {
+	int r;
+
+	mutex_lock(&fsipc_mu);
 	fsipcbuf.flush.req_fileid = fd->fd_file.id;
-	return fsipc(FSREQ_FLUSH, NULL);
+	r = fsipc(FSREQ_FLUSH, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
 }
 
 // Read at most 'n' bytes from 'fd' at the current position into 'buf'.
@@ -114,16 +124,37 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 	// Make an FSREQ_READ request to the file system server after
 	// filling fsipcbuf.read with the request arguments.  The
 	// bytes read will be written back to fsipcbuf by the file
-	// system server.
+	// system server, or straight into buf for large reads.
+	uintptr_t va;
 	int r;
 
+	if (n > PGSIZE) {
+		n = MIN(n, FSBULK_MAX);
+		// The server maps buf writable, so make sure none of it is
+		// copy-on-write.
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+			*(volatile char*) va = *(volatile char*) va;
+		mutex_lock(&fsipc_mu);
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+		fsipcbuf.read.req_n = n;
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+		r = fsipc(FSREQ_READ, NULL);
+		mutex_unlock(&fsipc_mu);
+		assert(r <= (int) n);
+		return r;
+	}
+
+	mutex_lock(&fsipc_mu);
 	fsipcbuf.read.req_fileid = fd->fd_file.id;
 	fsipcbuf.read.req_n = n;
-	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
-		return r;
-	assert(r <= n);
-	assert(r <= PGSIZE);
-	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+	fsipcbuf.read.req_va = 0;
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+		assert(r <= n);
+		assert(r <= PGSIZE);
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+	}
+	mutex_unlock(&fsipc_mu);
 	return r;
 }
 
@@ -139,17 +170,24 @@ devfile_write(struct Fd *fd, const void *buf, size_t n)
 	// Make an FSREQ_WRITE request to the file system server.  Be
 	// careful: fsipcbuf.write.req_buf is only so large, but
 	// remember that write is always allowed to write *fewer*
-	// bytes than requested.
+	// bytes than requested.  Writes too large for req_buf have
+	// the server map buf instead.
 	// LAB 5: Your code here
 	int r;
 
-	if (n >= sizeof(fsipcbuf.write.req_buf)) {
-		n = sizeof(fsipcbuf.write.req_buf);
-	}
+	mutex_lock(&fsipc_mu);
 	fsipcbuf.write.req_fileid = fd->fd_file.id;
-	memmove(fsipcbuf.write.req_buf, buf, n);
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+		n = MIN(n, FSBULK_MAX);
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+	} else {
+		memmove(fsipcbuf.write.req_buf, buf, n);
+		fsipcbuf.write.req_va = 0;
+	}
 	fsipcbuf.write.req_n = n;
-	return fsipc(FSREQ_WRITE, NULL);
+	r = fsipc(FSREQ_WRITE, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
 }
 
 static int
@@ -157,24 +195,148 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 {
 	int r;
 
+	mutex_lock(&fsipc_mu);
 	fsipcbuf.stat.req_fileid = fd->fd_file.id;
-	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
-		return r;
-	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
-	st->st_size = fsipcbuf.statRet.ret_size;
-	st->st_isdir = fsipcbuf.statRet.ret_isdir;
-	return 0;
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+		st->st_size = fsipcbuf.statRet.ret_size;
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+		r = 0;
+	}
+	mutex_unlock(&fsipc_mu);
+	return r;
 }
 
 // Truncate or extend an open file to 'size' bytes
 static int
 devfile_trunc(struct Fd *fd, off_t newsize)
 {
+	int r;
+
+	mutex_lock(&fsipc_mu);
 	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
 	fsipcbuf.set_size.req_size = newsize;
-	return fsipc(FSREQ_SET_SIZE, NULL);
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
 }
 
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+	fsipcbuf.allocate.req_offset = offset;
+	fsipcbuf.allocate.req_len = len;
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
+}
+
+// Mappings made by mmap are placed in [MMAPBASE, MMAPLIM).
+#define MMAPBASE	0x40000000
+#define MMAPLIM		0xC0000000
+
+// Find n bytes of unmapped address space for mmap.
+// Returns 0 if there is no such range.
+static uintptr_t
+mmap_find(size_t n)
+{
+	uintptr_t va, start;
+
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+			continue;
+		}
+		if (uvpt[PGNUM(va)] & PTE_P)
+			start = va + PGSIZE;
+		va += PGSIZE;
+	}
+	return va - start >= n ? start : 0;
+}
+
+// Map len bytes of file fdnum, starting at the page-aligned offset,
+// straight from the file server's block cache, without copying.
+// PROT_READ mappings share the cache pages.  PROT_WRITE mappings are
+// private copy-on-write copies: writes to them never reach the file.
+// The mapping ends at the page holding the end of the file.
+// Returns the address of the mapping, or NULL on error.
+void*
+mmap(int fdnum, off_t offset, size_t len, int prot)
+{
+	struct Fd *fd;
+	uintptr_t va;
+	int r;
+
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+		return NULL;
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+		return NULL;
+	if (prot & PROT_WRITE)
+		cow_enable();
+
+	mutex_lock(&fsipc_mu);
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+		mutex_unlock(&fsipc_mu);
+		return NULL;
+	}
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+	fsipcbuf.map.req_offset = offset;
+	fsipcbuf.map.req_len = len;
+	fsipcbuf.map.req_va = va;
+	fsipcbuf.map.req_prot = prot;
+	r = fsipc(FSREQ_MAP, NULL);
+	mutex_unlock(&fsipc_mu);
+	if (r < 0) {
+		if (debug)
+			cprintf("mmap: %e\n", r);
+		munmap((void*) va, len);
+		return NULL;
+	}
+	return (void*) va;
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+			return r;
+	return 0;
+}
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+	strcpy(fsipcbuf.remove.req_path, path);
+	r = fsipc(FSREQ_REMOVE, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
+}
 
 // Synchronize disk with buffer cache
 int
@@ -182,7 +344,26 @@ sync(void)
 {
 	// Ask the file server to update the disk
 	// by writing any dirty blocks in the buffer cache.
+	int r;
 
-	return fsipc(FSREQ_SYNC, NULL);
+	mutex_lock(&fsipc_mu);
+	r = fsipc(FSREQ_SYNC, NULL);
+	mutex_unlock(&fsipc_mu);
+	return r;
 }
 
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+	int r;
+
+	mutex_lock(&fsipc_mu);
+	fsipcbuf.bcstat.req_budget = budget;
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+		*st = fsipcbuf.bcstatRet;
+	mutex_unlock(&fsipc_mu);
+	return r;
+}
@@ -3,12 +3,44 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 extern volatile pte_t uvpt[];     // VA of "virtual page table"
 extern volatile pde_t uvpd[];     // VA of current page directory
+
+// Serializes copy-on-write faults among threads sharing our page table.
+// It sits at the bottom of the main thread's exception stack, a page
+// that is never copy-on-write, so taking it cannot fault in turn.
+#define COW_LOCK	((struct mutex *) (UXSTACKTOP - PGSIZE))
+
+// Replace the page at addr with a private writable copy of itself.
+static int
+cow_copy(uintptr_t addr)
+{
+	int r;
+
+	// Allocate a new page, map it at a temporary location (PFTEMP),
+	// copy the data from the old page to the new page, then move the new
+	// page to the old page's address.
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+	if (r < 0) {
+		cprintf("sys_page_alloc failed, %e.\n", r);
+		return r;
+	}
+
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+	if (r < 0) {
+		cprintf("sys_page_map failed, %e.\n", r);
+		sys_page_unmap(0, PFTEMP);
+		return r;
+	}
+	r = sys_page_unmap(0, PFTEMP);
+	if (r < 0) {
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+		return r;
+	}
+	return 0;
+}
+
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
@@ -18,7 +50,6 @@ pgfault(struct UTrapframe *utf)
 {
 	uintptr_t addr = utf->utf_fault_va;
 	uint32_t err = utf->utf_err;
-	int r;
 
 	// Check that the faulting access was (1) a write, and (2) to a
 	// copy-on-write page.  If not, panic.
@@ -32,31 +63,20 @@ pgfault(struct UTrapframe *utf)
 		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
 	}
 
-	// Allocate a new page, map it at a temporary location (PFTEMP),
-	// copy the data from the old page to the new page, then move the new
-	// page to the old page's address.
-	// Hint:
-	//   You should make three system calls.
 	addr = ROUNDDOWN(addr, PGSIZE);
+	mutex_lock(COW_LOCK);
+	// Another thread may have copied the page while we waited.
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+		cow_copy(addr);
+	mutex_unlock(COW_LOCK);
+}
 
-	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
-	if (r < 0) {
-		cprintf("sys_page_alloc failed, %e.\n", r);
-		return;
-	}
-
-	memmove(PFTEMP, (void*)addr, PGSIZE);
-	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
-	if (r < 0) {
-		cprintf("sys_page_map failed, %e.\n", r);
-		sys_page_unmap(0, PFTEMP);
-		return;
-	}
-	r = sys_page_unmap(0, PFTEMP);
-	if (r < 0) {
-		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
-		return;
-	}
+// Install the copy-on-write fault handler without forking, for
+// callers that are handed PTE_COW pages some other way, like mmap.
+void
+cow_enable(void)
+{
+	set_pgfault_handler(pgfault);
 }
 
 static int
@@ -142,6 +162,7 @@ fork(void)
 	// child
 	if (eid == 0) {
 		thisenv = &envs[ENVX(sys_getenvid())];
+		pthread_fork_child();
 		return eid;
 	}
 
@@ -205,10 +226,28 @@ fork(void)
 	return eid;
 }
 
-// Challenge!
-int
+// Is page pn part of the stack of the main thread or of thread t?
+static bool
+sfork_stack(unsigned pn, pthread_t t)
+{
+	uintptr_t va = pn << PGSHIFT;
+
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+}
+
+//
+// Shared-memory fork.  The child shares all of our memory, except that
+// it gets copy-on-write copies of the calling thread's stack and of the
+// main thread's stack, where thisenv lives.  Unlike threads the child
+// has its own page table, so mappings made after sfork are not shared.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
 sfork(void)
 {
+	pthread_t self = pthread_self();
 	int r;
 	envid_t eid;
 	set_pgfault_handler(pgfault);
@@ -224,33 +263,38 @@ sfork(void)
 	}
 
 	// parent
-	// iterate each pde, map writable pages
 	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
-		// if present, iterate each pte
-		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
-			int entry_num = NPTENTRIES;
-			if (pdeno == PDX(UTOP-1)) {
-				entry_num = PTX(UTOP-1) + 1;
+		if (!(uvpd[pdeno] & PTE_P))
+			continue;
+		int entry_num = NPTENTRIES;
+		if (pdeno == PDX(UTOP-1)) {
+			entry_num = PTX(UTOP-1) + 1;
+		}
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+			int pn = pdeno * NPDENTRIES + pteno;
+			pte_t pte = uvpt[pn];
+			if (!(pte & PTE_P))
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
 			}
-			for (int pteno = 0; pteno < entry_num; ++pteno) {
-				int pn = pdeno * NPDENTRIES + pteno;
-				pte_t pte = uvpt[pn];
-				if (pte & (PTE_P | PTE_U)) {
-					// user exception stack and user stack
-					if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
-						continue;
-					}
-					if (pn == ((USTACKTOP - PGSIZE) >> PGSHIFT)) {
-						cprintf("duppage_cow.\n");
-						if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
-							return r;
-						}
-						continue;
-					}
-					if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
-						return r;
-					}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+					return r;
 				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+				return r;
 			}
 		}
 	}
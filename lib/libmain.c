@@ -5,11 +5,7 @@
 
 extern void umain(int argc, char **argv);
 
-#ifdef SFORK
-const volatile struct Env **env;
-#else
-const volatile struct Env *thisenv;
-#endif
+struct pthread_tls *pthread_main_tls;
 const char *binaryname = "<unknown>";
 
 void
@@ -17,13 +13,10 @@ libmain(int argc, char **argv)
 {
 	// set thisenv to point at our Env structure in envs[].
 	envid_t eid = sys_getenvid();
-#ifdef SFORK
-	const volatile struct Env *stack_env;
-	stack_env = &envs[ENVX(eid)];
-	env = &stack_env;
-#else
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
 	thisenv = &envs[ENVX(eid)];
-#endif
 	// save the name of the program so that panic() can use it
 	if (argc > 0)
 		binaryname = argv[0];
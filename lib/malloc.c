@@ -25,6 +25,7 @@ enum
 static uint8_t *mbegin = (uint8_t*) 0x08000000;
 static uint8_t *mend   = (uint8_t*) 0x10000000;
 static uint8_t *mptr;
+static struct mutex malloc_mu;	// threads share the heap
 
 static int
 isfree(void *v, size_t n)
@@ -38,8 +39,8 @@ isfree(void *v, size_t n)
 	return 1;
 }
 
-void*
-malloc(size_t n)
+static void *
+malloc_locked(size_t n)
 {
 	int i, cont;
 	int nwrap;
@@ -111,8 +112,8 @@ malloc(size_t n)
 	return v;
 }
 
-void
-free(void *v)
+static void
+free_locked(void *v)
 {
 	uint8_t *c;
 	uint32_t *ref;
@@ -138,3 +139,21 @@ free(void *v)
 		sys_page_unmap(0, c);
 }
 
+void *
+malloc(size_t n)
+{
+	void *v;
+
+	mutex_lock(&malloc_mu);
+	v = malloc_locked(n);
+	mutex_unlock(&malloc_mu);
+	return v;
+}
+
+void
+free(void *v)
+{
+	mutex_lock(&malloc_mu);
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+}
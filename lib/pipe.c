@@ -1,4 +1,5 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 #define debug 0
 
@@ -19,9 +20,16 @@ struct Dev devpipe =
 
 #define PIPEBUFSIZ 32		// small to provoke races
 
+// How long a blocked reader or writer sleeps before rechecking whether
+// the other end has gone away without closing the pipe (e.g. it was
+// destroyed).  Orderly closes wake sleepers immediately.
+#define PIPEWAIT	10
+
 struct Pipe {
 	off_t p_rpos;		// read position
 	off_t p_wpos;		// write position
+	uint32_t p_rwait;	// readers sleeping on p_wpos
+	uint32_t p_wwait;	// writers sleeping on p_rpos
 	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
 };
 
@@ -101,6 +109,27 @@ pipeisclosed(int fdnum)
 	return _pipeisclosed(fd, p);
 }
 
+// Sleep until *pos moves away from 'val', the other end wakes us, or
+// PIPEWAIT passes.  'nwait' counts the sleepers so that pipewake only
+// enters the kernel when somebody is actually asleep.
+static void
+pipesleep(volatile uint32_t *nwait, volatile off_t *pos, off_t val)
+{
+	atomic_add(nwait, 1);
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+	atomic_add(nwait, -1);
+}
+
+// Wake everybody sleeping on *pos after we advanced it.
+static void
+pipewake(volatile uint32_t *nwait, volatile off_t *pos)
+{
+	// The locked add orders our update of *pos before the read of
+	// *nwait, pairing with the increment in pipesleep.
+	if (atomic_add(nwait, 0))
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+}
+
 static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 {
@@ -119,20 +148,23 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 			// pipe is empty
 			// if we got any data, return it
 			if (i > 0)
-				return i;
+				goto out;
 			// if all the writers are gone, note eof
 			if (_pipeisclosed(fd, p))
 				return 0;
-			// yield and see what happens
+			// sleep until a writer adds something
 			if (debug)
-				cprintf("devpipe_read yield\n");
-			sys_yield();
+				cprintf("devpipe_read sleep\n");
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
 		}
 		// there's a byte.  take it.
 		// wait to increment rpos until the byte is taken!
 		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
 		p->p_rpos++;
 	}
+out:
+	// we made room; let any blocked writers at it
+	pipewake(&p->p_wwait, &p->p_rpos);
 	return i;
 }
 
@@ -157,10 +189,13 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 			// note eof
 			if (_pipeisclosed(fd, p))
 				return 0;
-			// yield and see what happens
+			// hand what we wrote so far to the readers,
+			// then sleep until one of them makes room
 			if (debug)
-				cprintf("devpipe_write yield\n");
-			sys_yield();
+				cprintf("devpipe_write sleep\n");
+			pipewake(&p->p_rwait, &p->p_wpos);
+			pipesleep(&p->p_wwait, &p->p_rpos,
+				  p->p_wpos - sizeof(p->p_buf));
 		}
 		// there's room for a byte.  store it.
 		// wait to increment wpos until the byte is stored!
@@ -168,6 +203,7 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 		p->p_wpos++;
 	}
 
+	pipewake(&p->p_rwait, &p->p_wpos);
 	return i;
 }
 
@@ -185,7 +221,14 @@ devpipe_stat(struct Fd *fd, struct Stat *stat)
 static int
 devpipe_close(struct Fd *fd)
 {
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
 	(void) sys_page_unmap(0, fd);
+	pipewake(&p->p_rwait, &p->p_wpos);
+	pipewake(&p->p_wwait, &p->p_rpos);
 	return sys_page_unmap(0, fd2data(fd));
 }
 
@@ -38,6 +38,8 @@ static const char * const error_string[MAXERROR] =
 	[E_OVER_LENGTH]	= "length too long",
 	[E_FULL_BUFFER]	= "full buffer",
 	[E_BUFFER_TOO_SMALL]	= "receive buffer is too small",
+	[E_AGAIN]	= "resource temporarily unavailable",
+	[E_TIMEOUT]	= "timed out",
 };
 
 /*
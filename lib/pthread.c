@@ -0,0 +1,204 @@
+// Kernel-scheduled threads sharing one address space.  See inc/pthread.h.
+
+#include <inc/lib.h>
+
+enum {
+	PTH_FREE = 0,
+	PTH_RUNNING,
+	PTH_DONE,
+};
+
+struct pthread {
+	envid_t th_env;
+	volatile uint32_t th_state;	// PTH_*; joiners futex_wait on it
+	void *(*th_fn)(void *);
+	void *th_arg;
+	void *th_ret;
+};
+
+static struct pthread threads[PTHREAD_MAX];
+static struct mutex threads_mu;
+
+// Is the env behind th still one of ours?  After a fork the child's
+// copy of the table names its parent's threads.
+static bool
+pthread_ours(struct pthread *th)
+{
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+		&& e->env_pgdir == thisenv->env_pgdir;
+}
+
+static void
+pthread_start(pthread_t t)
+{
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+}
+
+// Map the exception stack and regular stack of slot t, unless an
+// earlier thread in the slot left them behind.
+static int
+pthread_map_stacks(pthread_t t)
+{
+	uintptr_t top = PTHREAD_TOP(t), va;
+	int r;
+
+	va = top - PGSIZE;
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+		return 0;
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+		return r;
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+			goto err;
+	return 0;
+
+err:
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+		va -= PGSIZE;
+		sys_page_unmap(0, (void *) va);
+	}
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+	return r;
+}
+
+// Start a new thread running fn(arg) in our address space.
+// Stores its id in *tp.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+	struct pthread *th;
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+	if (threads[0].th_state == PTH_FREE) {
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+		threads[0].th_state = PTH_RUNNING;
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+		if (threads[t].th_state == PTH_FREE)
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+		return -E_NO_FREE_ENV;
+	}
+	th = &threads[t];
+	th->th_state = PTH_RUNNING;
+	mutex_unlock(&threads_mu);
+
+	if ((r = pthread_map_stacks(t)) < 0)
+		goto err;
+	th->th_fn = fn;
+	th->th_arg = arg;
+	th->th_ret = NULL;
+
+	// Start in pthread_start(t), as if called with no return address.
+	esp = (uint32_t *) pthread_tls(t);
+	*--esp = t;
+	*--esp = 0;
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+				    (uintptr_t) esp, PTHREAD_TOP(t))) < 0) {
+		r = id;
+		goto err;
+	}
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+	return r;
+}
+
+// Wait for thread t to finish, and store what it returned in
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+	if (state != PTH_DONE)
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+	if (ret_store)
+		*ret_store = th->th_ret;
+	th->th_state = PTH_FREE;
+	return 0;
+}
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+		exit();
+	th->th_ret = ret;
+	th->th_state = PTH_DONE;
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+	sys_env_destroy(0);
+	panic("pthread_exit: still alive");
+}
+
+// Destroy every other thread in our address space, for exit().
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+		    && envs[ENVX(id)].env_id == id
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+	}
+}
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+	threads_mu.m_state = 0;
+	if (self != 0) {
+		threads[self].th_env = thisenv->env_id;
+		threads[self].th_state = PTH_RUNNING;
+	}
+}
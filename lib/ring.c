@@ -0,0 +1,240 @@
+// Shared-memory SPSC ring channels.  See inc/ring.h.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define debug 0
+
+#define RING_PERM	(PTE_P | PTE_U | PTE_W | PTE_SHARE)
+
+static inline void *
+ring_slot(struct Ring *r, uint32_t idx)
+{
+	return r->r_data + (idx & (r->r_hdr->rh_nslots - 1)) * r->r_hdr->rh_slotsize;
+}
+
+// Number of pages, header included, for nslots slots of slotsize
+// bytes, or 0 if that is not a valid ring or would not fit in
+// RING_MAXPAGES pages.  The bound is checked before multiplying, so
+// slotsize * nslots cannot wrap.
+static uint32_t
+ring_npages(uint32_t slotsize, uint32_t nslots)
+{
+	if (nslots == 0 || (nslots & (nslots - 1)) || slotsize == 0
+	    || slotsize % sizeof(uint32_t)
+	    || nslots > (RING_MAXPAGES - 1) * PGSIZE / slotsize)
+		return 0;
+	return 1 + ROUNDUP(slotsize * nslots, PGSIZE) / PGSIZE;
+}
+
+// Create a ring of nslots slots of slotsize bytes each, mapping its
+// pages at va in the current environment, and set up r as the 'role'
+// end of it.  The pages are PTE_SHARE, so children created with fork or
+// spawn afterwards inherit them and can ring_attach to the other end.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if nslots is not a power of two, va is not page aligned,
+//		or the ring would not fit in RING_MAXPAGES pages.
+//	-E_NO_MEM if we run out of memory.
+int
+ring_create(struct Ring *r, void *va, uint32_t slotsize, uint32_t nslots, int role)
+{
+	struct RingHdr *hdr = va;
+	uint32_t i, npages;
+	int rr;
+
+	if (PGOFF(va) || (npages = ring_npages(slotsize, nslots)) == 0)
+		return -E_INVAL;
+
+	for (i = 0; i < npages; i++)
+		if ((rr = sys_page_alloc(0, va + i * PGSIZE, RING_PERM)) < 0)
+			goto err;
+
+	hdr->rh_magic = RING_MAGIC;
+	hdr->rh_slotsize = slotsize;
+	hdr->rh_nslots = nslots;
+	hdr->rh_npages = npages;
+	return ring_attach(r, va, role);
+
+err:
+	while (i-- > 0)
+		sys_page_unmap(0, va + i * PGSIZE);
+	return rr;
+}
+
+// Set up r as the 'role' end of the ring whose pages are already
+// mapped at va, e.g. inherited from the parent or by ring_accept.
+// The header came from the peer, so its geometry is checked against
+// the pages it says are mapped before any slot is indexed.
+int
+ring_attach(struct Ring *r, void *va, int role)
+{
+	struct RingHdr *hdr = va;
+	uint32_t npages;
+
+	if (hdr->rh_magic != RING_MAGIC
+	    || (role != RING_PRODUCER && role != RING_CONSUMER))
+		return -E_INVAL;
+	npages = ring_npages(hdr->rh_slotsize, hdr->rh_nslots);
+	if (npages == 0 || npages > hdr->rh_npages || hdr->rh_npages > RING_MAXPAGES)
+		return -E_INVAL;
+	r->r_hdr = hdr;
+	r->r_data = va + PGSIZE;
+	r->r_role = role;
+	r->r_batch = MAX(hdr->rh_nslots / 4, 1);
+	if (role == RING_PRODUCER) {
+		r->r_next = r->r_pub = hdr->rh_head;
+		r->r_peer = hdr->rh_tail;
+	} else {
+		r->r_next = r->r_pub = hdr->rh_tail;
+		r->r_peer = hdr->rh_head;
+	}
+	return 0;
+}
+
+// Send the ring's pages to env 'to', which must be in ring_accept.
+int
+ring_grant(struct Ring *r, envid_t to)
+{
+	uint32_t i;
+
+	for (i = 0; i < r->r_hdr->rh_npages; i++)
+		ipc_send(to, i, (void *) r->r_hdr + i * PGSIZE, RING_PERM);
+	return 0;
+}
+
+// Receive a ring granted with ring_grant, mapping it at va, and set up
+// r as the 'role' end of it.  Stores the granting env in *from_store.
+int
+ring_accept(struct Ring *r, void *va, int role, envid_t *from_store)
+{
+	struct RingHdr *hdr = va;
+	envid_t from, who;
+	uint32_t i;
+	int perm, rr;
+
+	if ((rr = ipc_recv(&from, va, &perm)) != 0 || !(perm & PTE_P)
+	    || hdr->rh_magic != RING_MAGIC || hdr->rh_npages > RING_MAXPAGES)
+		return rr < 0 ? rr : -E_INVAL;
+	for (i = 1; i < hdr->rh_npages; i++) {
+		rr = ipc_recv(&who, va + i * PGSIZE, &perm);
+		if (rr != i || who != from || !(perm & PTE_P))
+			return -E_INVAL;
+	}
+	if (from_store)
+		*from_store = from;
+	return ring_attach(r, va, role);
+}
+
+// Publish (producer) or release (consumer) slots after every 'batch'
+// pushes or pops.  1 makes every operation visible at once.
+void
+ring_set_batch(struct Ring *r, uint32_t batch)
+{
+	r->r_batch = MIN(MAX(batch, 1), r->r_hdr->rh_nslots);
+}
+
+// Make our private index visible to the other side, and ring its
+// doorbell if it sleeps waiting for us.
+void
+ring_flush(struct Ring *r)
+{
+	struct RingHdr *hdr = r->r_hdr;
+
+	if (r->r_next == r->r_pub)
+		return;
+	r->r_pub = r->r_next;
+	// xchg is a locked store: it orders the slot contents before the
+	// index, and the index before our read of the idle flag below,
+	// pairing with the xchg in ring_sleep.
+	if (r->r_role == RING_PRODUCER) {
+		xchg(&hdr->rh_head, r->r_next);
+		if (hdr->rh_cons_idle)
+			sys_futex_wake(&hdr->rh_head, 1);
+	} else {
+		xchg(&hdr->rh_tail, r->r_next);
+		if (hdr->rh_prod_idle)
+			sys_futex_wake(&hdr->rh_tail, 1);
+	}
+}
+
+// Sleep until the other side moves its index away from r->r_peer.
+static void
+ring_sleep(struct Ring *r, volatile uint32_t *idle, volatile uint32_t *index)
+{
+	// Whatever we have done so far may be what the other side is
+	// waiting for.
+	ring_flush(r);
+	xchg(idle, 1);
+	if (*index == r->r_peer)
+		sys_futex_wait(index, r->r_peer, 0);
+	*idle = 0;
+}
+
+// Producer: return the next free slot, or NULL if the ring is full.
+// The slot is not handed to the consumer until ring_push.
+void *
+ring_try_alloc(struct Ring *r)
+{
+	uint32_t nslots = r->r_hdr->rh_nslots;
+
+	if (r->r_next - r->r_peer == nslots) {
+		r->r_peer = r->r_hdr->rh_tail;
+		if (r->r_next - r->r_peer == nslots)
+			return NULL;
+	}
+	return ring_slot(r, r->r_next);
+}
+
+// Producer: return the next free slot, sleeping while the ring is full.
+void *
+ring_alloc(struct Ring *r)
+{
+	void *slot;
+
+	while ((slot = ring_try_alloc(r)) == NULL)
+		ring_sleep(r, &r->r_hdr->rh_prod_idle, &r->r_hdr->rh_tail);
+	return slot;
+}
+
+// Producer: queue the slot returned by ring_alloc for the consumer.
+void
+ring_push(struct Ring *r)
+{
+	r->r_next++;
+	if (r->r_next - r->r_pub >= r->r_batch)
+		ring_flush(r);
+}
+
+// Consumer: return the oldest published slot, or NULL if there is none.
+// The slot stays ours until ring_pop.
+void *
+ring_try_front(struct Ring *r)
+{
+	if (r->r_next == r->r_peer) {
+		r->r_peer = r->r_hdr->rh_head;
+		if (r->r_next == r->r_peer)
+			return NULL;
+	}
+	return ring_slot(r, r->r_next);
+}
+
+// Consumer: return the oldest published slot, sleeping while there is none.
+void *
+ring_front(struct Ring *r)
+{
+	void *slot;
+
+	while ((slot = ring_try_front(r)) == NULL)
+		ring_sleep(r, &r->r_hdr->rh_cons_idle, &r->r_hdr->rh_head);
+	return slot;
+}
+
+// Consumer: give the slot returned by ring_front back to the producer.
+void
+ring_pop(struct Ring *r)
+{
+	r->r_next++;
+	if (r->r_next - r->r_pub >= r->r_batch)
+		ring_flush(r);
+}
@@ -0,0 +1,395 @@
+// Buffered streams over file descriptors.
+//
+// A stream gathers small reads and writes into one buffer, so that
+// reading a file a character or a line at a time costs one file server
+// request per buffer instead of one per call.  A stream holds either
+// unread input or unwritten output, never both; switching directions
+// flushes.  Streams are not safe to share between threads.
+
+#include <inc/lib.h>
+
+#define STREAM_BUFSIZE	PGSIZE
+
+// f_flags
+#define F_READ		0x1	// opened for reading
+#define F_WRITE		0x2	// opened for writing
+#define F_EOF		0x4	// last read hit end of file
+#define F_ERR		0x8	// a read or write failed
+#define F_MALLOC	0x10	// f_buf came from malloc
+
+struct FILE {
+	int f_fd;
+	int f_flags;		// 0 if the slot is free
+	int f_bufmode;		// _IOFBF, _IOLBF, _IONBF, or 0 if not chosen yet
+	char *f_buf;		// 0 until the first read or write
+	size_t f_bufsize;
+	size_t f_rpos;		// unread input is f_buf[f_rpos, f_rend)
+	size_t f_rend;
+	size_t f_wend;		// unwritten output is f_buf[0, f_wend)
+	char f_ch;		// buffer for unbuffered streams
+};
+
+static FILE streams[FOPEN_MAX] = {
+	{ .f_fd = 0, .f_flags = F_READ },
+	{ .f_fd = 1, .f_flags = F_WRITE },
+};
+
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+	int omode;
+
+	switch (mode[0]) {
+	case 'r':
+		omode = O_RDONLY;
+		*flags_store = F_READ;
+		break;
+	case 'w':
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+		*flags_store = F_WRITE;
+		break;
+	case 'a':
+		omode = O_WRONLY|O_CREAT;
+		*flags_store = F_WRITE;
+		break;
+	default:
+		return -E_INVAL;
+	}
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+		if (!streams[i].f_flags) {
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+}
+
+FILE*
+fopen(const char *path, const char *mode)
+{
+	struct Stat st;
+	int omode, flags, fd;
+	FILE *f;
+
+	if ((omode = parse_mode(mode, &flags)) < 0)
+		return 0;
+	if ((fd = open(path, omode)) < 0)
+		return 0;
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+		seek(fd, st.st_size);
+	if (!(f = stream_alloc(fd, flags)))
+		close(fd);
+	return f;
+}
+
+FILE*
+fdopen(int fd, const char *mode)
+{
+	int flags;
+
+	if (parse_mode(mode, &flags) < 0)
+		return 0;
+	return stream_alloc(fd, flags);
+}
+
+int
+fclose(FILE *f)
+{
+	int r;
+
+	r = fflush(f);
+	if (close(f->f_fd) < 0)
+		r = EOF;
+	if (f->f_flags & F_MALLOC)
+		free(f->f_buf);
+	f->f_flags = 0;
+	return r;
+}
+
+// Set up f's buffer before its first read or write.
+static void
+stream_setup(FILE *f)
+{
+	if (f->f_buf)
+		return;
+	if (!f->f_bufmode)
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+	if (f->f_bufmode != _IONBF
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+		f->f_bufsize = STREAM_BUFSIZE;
+		f->f_flags |= F_MALLOC;
+	} else {
+		f->f_buf = &f->f_ch;
+		f->f_bufsize = 1;
+	}
+}
+
+int
+setvbuf(FILE *f, char *buf, int mode, size_t size)
+{
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+		return EOF;
+	f->f_bufmode = mode;
+	if (buf && size && mode != _IONBF) {
+		f->f_buf = buf;
+		f->f_bufsize = size;
+	}
+	return 0;
+}
+
+// Write out everything in the buffer.
+static int
+stream_drain(FILE *f)
+{
+	size_t done;
+	ssize_t r;
+
+	for (done = 0; done < f->f_wend; done += r)
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+			f->f_flags |= F_ERR;
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+			f->f_wend -= done;
+			return EOF;
+		}
+	f->f_wend = 0;
+	return 0;
+}
+
+// Give back input that was read ahead but not consumed, by moving a
+// file's seek position back, so that the next reader of the descriptor
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+		return 0;
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+	f->f_rpos = f->f_rend = 0;
+	return 1;
+}
+
+// Flush f, or every open stream if f is null.
+int
+fflush(FILE *f)
+{
+	int i, r;
+
+	if (!f) {
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+				r = EOF;
+		return r;
+	}
+	stream_unread(f);
+	return stream_drain(f);
+}
+
+int
+fileno(FILE *f)
+{
+	return f->f_fd;
+}
+
+int
+feof(FILE *f)
+{
+	return (f->f_flags & F_EOF) != 0;
+}
+
+int
+ferror(FILE *f)
+{
+	return (f->f_flags & F_ERR) != 0;
+}
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+	ssize_t r;
+
+	stream_setup(f);
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+	f->f_rpos = 0;
+	f->f_rend = r;
+	return r;
+}
+
+int
+fgetc(FILE *f)
+{
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+}
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+		    != f->f_buf + f->f_rpos + m)
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+		f->f_rpos += m;
+		len += m;
+		if (s[len - 1] == '\n')
+			break;
+	}
+	if (len == 0)
+		return 0;
+	s[len] = 0;
+	return s;
+}
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+	want = size * n;
+	for (done = 0; done < want; done += m) {
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+			f->f_rpos += m;
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+				break;
+			}
+			m = r;
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+}
+
+int
+fputc(int c, FILE *f)
+{
+	char ch = c;
+
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+}
+
+int
+fputs(const char *s, FILE *f)
+{
+	size_t n = strlen(s);
+
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+		f->f_flags |= F_ERR;
+		return 0;
+	}
+	stream_setup(f);
+	want = size * n;
+	if (!stream_unread(f)) {
+		// Input that a pipe or the console could not take back
+		// keeps the buffer, so the data goes straight to the fd.
+		for (done = 0; done < want; done += r)
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+				f->f_flags |= F_ERR;
+				break;
+			}
+		return size ? done / size : 0;
+	}
+
+	for (done = 0; done < want; ) {
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+			// Large writes skip the buffer.
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+				f->f_flags |= F_ERR;
+				break;
+			}
+			done += r;
+			continue;
+		}
+		// Bytes count as written once they are in the buffer: a
+		// failed drain keeps them there for the next flush.
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+		memmove(f->f_buf + f->f_wend, p + done, m);
+		f->f_wend += m;
+		done += m;
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+			break;
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+
+static void
+putch(int ch, void *thunk)
+{
+	fputc(ch, (FILE *) thunk);
+}
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vprintfmt(putch, f, fmt, ap);
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+}
@@ -0,0 +1,164 @@
+// Mutexes, condition variables and semaphores on top of the futex
+// system calls.  The fast paths are a single atomic instruction; the
+// kernel is entered only when an env actually has to sleep or there is
+// somebody to wake.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+// --------------------------------------------------------------
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+	m->m_state = 0;
+}
+
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+		return;
+	if (c != 2)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+		c = xchg(&m->m_state, 2);
+	}
+}
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+	if (xchg(&m->m_state, 0) == 2)
+		sys_futex_wake(&m->m_state, 1);
+}
+
+// --------------------------------------------------------------
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+	c->c_seq = 0;
+}
+
+// Atomically release m and wait for c to be signalled, or for msec
+// milliseconds to pass (0 means forever).  m is held again on return.
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+	mutex_unlock(m);
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+		sys_futex_wait(&m->m_state, 2, 0);
+	return r == -E_TIMEOUT ? r : 0;
+}
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+	cond_timedwait(c, m, 0);
+}
+
+void
+cond_signal(struct cond *c)
+{
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+}
+
+// --------------------------------------------------------------
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+	s->s_count = count;
+	s->s_waiters = 0;
+}
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+			return 0;
+	return -E_AGAIN;
+}
+
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+	uint32_t end = sys_time_msec() + msec;
+	uint32_t left = 0;
+	int r;
+
+	while (sem_trywait(s) < 0) {
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+			return -E_TIMEOUT;
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+			return r;
+	}
+	return 0;
+}
+
+void
+sem_wait(struct semaphore *s)
+{
+	sem_timedwait(s, 0);
+}
+
+void
+sem_post(struct semaphore *s)
+{
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+		sys_futex_wake(&s->s_count, 1);
+}
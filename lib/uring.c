@@ -0,0 +1,79 @@
+// User side of asynchronous system call rings.  See inc/uring.h.
+
+#include <inc/lib.h>
+
+// Map a fresh page at u, which must be page-aligned, and register it
+// as this environment's system call ring.
+int
+uring_init(struct Uring *u)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, u, PTE_P|PTE_U|PTE_W)) < 0)
+		return r;
+	if ((r = sys_uring_setup(u)) < 0) {
+		sys_page_unmap(0, u);
+		return r;
+	}
+	return 0;
+}
+
+// Queue system call 'op' with the given arguments.  Its result shows up
+// on the completion queue tagged with 'data'.  If the submission queue
+// is full, rings the doorbell to make room first.
+//
+// Returns 0 on success, -E_AGAIN if the queue stays full because the
+// completion queue is full too: reap some completions and try again.
+int
+uring_queue(struct Uring *u, uint32_t op, uint32_t data,
+	    uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	struct UringSqe *sqe;
+
+	if (u->sq_tail - u->sq_head == URING_NSQE) {
+		sys_uring_enter();
+		if (u->sq_tail - u->sq_head == URING_NSQE)
+			return -E_AGAIN;
+	}
+	sqe = &u->sq[u->sq_tail % URING_NSQE];
+	sqe->sqe_op = op;
+	sqe->sqe_arg[0] = a1;
+	sqe->sqe_arg[1] = a2;
+	sqe->sqe_arg[2] = a3;
+	sqe->sqe_arg[3] = a4;
+	sqe->sqe_arg[4] = a5;
+	sqe->sqe_data = data;
+	// The kernel may pick the entry up as soon as the tail moves.
+	asm volatile("" ::: "memory");
+	u->sq_tail++;
+	return 0;
+}
+
+// Run all queued calls now.  Returns the number run, < 0 on error.
+int
+uring_submit(struct Uring *u)
+{
+	int r, n = 0;
+
+	while (u->sq_head != u->sq_tail) {
+		if ((r = sys_uring_enter()) < 0)
+			return r;
+		if (r == 0)	// completion queue full
+			break;
+		n += r;
+	}
+	return n;
+}
+
+// Take the oldest completion off the queue into *cqe.
+// Returns 1 if there was one, 0 if not.
+int
+uring_reap(struct Uring *u, struct UringCqe *cqe)
+{
+	if (u->cq_head == u->cq_tail)
+		return 0;
+	*cqe = u->cq[u->cq_head % URING_NCQE];
+	asm volatile("" ::: "memory");
+	u->cq_head++;
+	return 1;
+}
@@ -0,0 +1,20540 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 44 66 00 00       	call   806675 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_probe_disk>:
+	return 0;
+}
+
+bool
+ide_probe_disk(int d)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct IdeChannel *c;
+	int r, x;
+
+	if (d < 0 || d >= 2 * NCHANNELS)
+		return 0;
+  80003f:	be 00 00 00 00       	mov    $0x0,%esi
+	if (d < 0 || d >= 2 * NCHANNELS)
+  800044:	83 fb 03             	cmp    $0x3,%ebx
+  800047:	77 6c                	ja     8000b5 <ide_probe_disk+0x82>
+	return &channels[d / 2];
+  800049:	89 d8                	mov    %ebx,%eax
+  80004b:	c1 e8 1f             	shr    $0x1f,%eax
+  80004e:	01 d8                	add    %ebx,%eax
+  800050:	89 c2                	mov    %eax,%edx
+  800052:	d1 fa                	sar    %edx
+	c = disk_channel(d);
+
+	// switch to Device d
+	outb(c->ic_base + 6, 0xE0 | ((d&1)<<4));
+  800054:	83 e0 fe             	and    $0xfffffffe,%eax
+  800057:	01 d0                	add    %edx,%eax
+  800059:	0f b7 3c 85 0c d0 80 	movzwl 0x80d00c(,%eax,4),%edi
+  800060:	00 
+  800061:	8d 77 06             	lea    0x6(%edi),%esi
+  800064:	89 d8                	mov    %ebx,%eax
+  800066:	c1 e0 04             	shl    $0x4,%eax
+  800069:	83 e0 10             	and    $0x10,%eax
+  80006c:	83 c8 e0             	or     $0xffffffe0,%eax
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80006f:	89 f2                	mov    %esi,%edx
+  800071:	ee                   	out    %al,(%dx)
+
+	// check for Device d to be ready for a while.  A missing device
+	// never shows DRDY, and an empty channel floats to 0xFF.
+	for (x = 0;
+  800072:	b9 00 00 00 00       	mov    $0x0,%ecx
+	     x < 1000 && ((r = inb(c->ic_base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  800077:	8d 57 07             	lea    0x7(%edi),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80007a:	ec                   	in     (%dx),%al
+  80007b:	83 e0 e1             	and    $0xffffffe1,%eax
+  80007e:	3c 40                	cmp    $0x40,%al
+  800080:	74 0b                	je     80008d <ide_probe_disk+0x5a>
+	     x++)
+  800082:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(c->ic_base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  800085:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  80008b:	75 ed                	jne    80007a <ide_probe_disk+0x47>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80008d:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800092:	89 f2                	mov    %esi,%edx
+  800094:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(c->ic_base + 6, 0xE0 | (0<<4));
+
+	cprintf("Device %d presence: %d\n", d, (x < 1000));
+  800095:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  80009b:	0f 9e c0             	setle  %al
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	83 ec 04             	sub    $0x4,%esp
+  8000a3:	0f b6 c0             	movzbl %al,%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	53                   	push   %ebx
+  8000a8:	68 00 ad 80 00       	push   $0x80ad00
+  8000ad:	e8 41 67 00 00       	call   8067f3 <cprintf>
+	return (x < 1000);
+  8000b2:	83 c4 10             	add    $0x10,%esp
+}
+  8000b5:	89 f0                	mov    %esi,%eax
+  8000b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ba:	5b                   	pop    %ebx
+  8000bb:	5e                   	pop    %esi
+  8000bc:	5f                   	pop    %edi
+  8000bd:	5d                   	pop    %ebp
+  8000be:	c3                   	ret
+
+008000bf <ide_rw>:
+// threads that want it.  While only DMA transfers are in flight the
+// thread sleeps until the next disk interrupt.  Consumes dr_buf and
+// dr_nsecs.  Returns 0 on success, -1 if any transfer failed.
+int
+ide_rw(struct DiskReq *reqs, int n)
+{
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	57                   	push   %edi
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 5c             	sub    $0x5c,%esp
+  8000c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct DiskReq *cur[NCHANNELS] = { 0 };
+  8000cb:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  8000d2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	bool used[NCHANNELS], busy, progress, polled;
+	uint32_t seen;
+	int i, r, s;
+
+	for (i = 0; i < NCHANNELS; i++)
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+  8000d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8000df:	8d 04 86             	lea    (%esi,%eax,4),%eax
+  8000e2:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  8000e5:	89 f2                	mov    %esi,%edx
+  8000e7:	89 c1                	mov    %eax,%ecx
+  8000e9:	eb 03                	jmp    8000ee <ide_rw+0x2f>
+	for (; q < end; q++)
+  8000eb:	83 c2 14             	add    $0x14,%edx
+  8000ee:	39 ca                	cmp    %ecx,%edx
+  8000f0:	0f 83 6e 05 00 00    	jae    800664 <ide_rw+0x5a5>
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  8000f6:	83 7a 0c 00          	cmpl   $0x0,0xc(%edx)
+  8000fa:	74 ef                	je     8000eb <ide_rw+0x2c>
+	return &channels[d / 2];
+  8000fc:	8b 1a                	mov    (%edx),%ebx
+  8000fe:	89 d8                	mov    %ebx,%eax
+  800100:	c1 e8 1f             	shr    $0x1f,%eax
+  800103:	01 d8                	add    %ebx,%eax
+  800105:	89 c3                	mov    %eax,%ebx
+  800107:	d1 fb                	sar    %ebx
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  800109:	83 e0 fe             	and    $0xfffffffe,%eax
+  80010c:	01 d8                	add    %ebx,%eax
+  80010e:	c1 e0 02             	shl    $0x2,%eax
+  800111:	75 d8                	jne    8000eb <ide_rw+0x2c>
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+  800113:	85 d2                	test   %edx,%edx
+  800115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80011a:	0f 95 c3             	setne  %bl
+			mutex_lock(&channels[i].ic_mu);
+  80011d:	83 ec 0c             	sub    $0xc,%esp
+  800120:	68 14 d0 80 00       	push   $0x80d014
+  800125:	e8 76 99 00 00       	call   809aa0 <mutex_lock>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	e9 37 05 00 00       	jmp    800669 <ide_rw+0x5aa>
+	for (; q < end; q++)
+  800132:	83 c0 14             	add    $0x14,%eax
+  800135:	39 c8                	cmp    %ecx,%eax
+  800137:	0f 83 15 05 00 00    	jae    800652 <ide_rw+0x593>
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  80013d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  800141:	74 ef                	je     800132 <ide_rw+0x73>
+	return &channels[d / 2];
+  800143:	8b 30                	mov    (%eax),%esi
+  800145:	89 f2                	mov    %esi,%edx
+  800147:	c1 ea 1f             	shr    $0x1f,%edx
+  80014a:	01 f2                	add    %esi,%edx
+  80014c:	89 d6                	mov    %edx,%esi
+  80014e:	d1 fe                	sar    %esi
+  800150:	83 e2 fe             	and    $0xfffffffe,%edx
+  800153:	01 f2                	add    %esi,%edx
+  800155:	8d 14 95 0c d0 80 00 	lea    0x80d00c(,%edx,4),%edx
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  80015c:	81 fa 18 d0 80 00    	cmp    $0x80d018,%edx
+  800162:	75 ce                	jne    800132 <ide_rw+0x73>
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+  800164:	85 c0                	test   %eax,%eax
+  800166:	0f 95 c0             	setne  %al
+  800169:	88 c7                	mov    %al,%bh
+			mutex_lock(&channels[i].ic_mu);
+  80016b:	83 ec 0c             	sub    $0xc,%esp
+  80016e:	68 20 d0 80 00       	push   $0x80d020
+  800173:	e8 28 99 00 00       	call   809aa0 <mutex_lock>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	e9 d4 04 00 00       	jmp    800654 <ide_rw+0x595>
+	for (; q < end; q++)
+  800180:	83 c1 14             	add    $0x14,%ecx
+  800183:	39 d9                	cmp    %ebx,%ecx
+  800185:	0f 83 b9 04 00 00    	jae    800644 <ide_rw+0x585>
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  80018b:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80018f:	74 ef                	je     800180 <ide_rw+0xc1>
+	return &channels[d / 2];
+  800191:	8b 39                	mov    (%ecx),%edi
+  800193:	89 f8                	mov    %edi,%eax
+  800195:	c1 e8 1f             	shr    $0x1f,%eax
+  800198:	01 f8                	add    %edi,%eax
+  80019a:	89 c7                	mov    %eax,%edi
+  80019c:	d1 ff                	sar    %edi
+  80019e:	83 e0 fe             	and    $0xfffffffe,%eax
+  8001a1:	01 f8                	add    %edi,%eax
+  8001a3:	8d 04 85 0c d0 80 00 	lea    0x80d00c(,%eax,4),%eax
+		if (q->dr_nsecs > 0 && disk_channel(q->dr_disk) == c)
+  8001aa:	39 f0                	cmp    %esi,%eax
+  8001ac:	75 d2                	jne    800180 <ide_rw+0xc1>
+	do {
+		seen = ide_nintr;
+		busy = progress = polled = 0;
+		for (i = 0; i < NCHANNELS; i++) {
+			if (!cur[i]) {
+				if (!(cur[i] = ide_next(reqs, reqs + n, &channels[i])))
+  8001ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8001b1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8001b4:	89 08                	mov    %ecx,(%eax)
+	return &channels[d / 2];
+  8001b6:	8b 11                	mov    (%ecx),%edx
+  8001b8:	89 d0                	mov    %edx,%eax
+  8001ba:	c1 e8 1f             	shr    $0x1f,%eax
+  8001bd:	01 d0                	add    %edx,%eax
+  8001bf:	89 c2                	mov    %eax,%edx
+  8001c1:	d1 fa                	sar    %edx
+  8001c3:	83 e0 fe             	and    $0xfffffffe,%eax
+  8001c6:	01 d0                	add    %edx,%eax
+  8001c8:	c1 e0 02             	shl    $0x2,%eax
+	assert(q->dr_nsecs <= 256);
+  8001cb:	8b 71 0c             	mov    0xc(%ecx),%esi
+  8001ce:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  8001d4:	77 5b                	ja     800231 <ide_rw+0x172>
+	struct Prd *prd = prdt[c - channels];
+  8001d6:	c1 f8 02             	sar    $0x2,%eax
+  8001d9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+  8001df:	c1 e0 09             	shl    $0x9,%eax
+  8001e2:	8d b8 00 22 81 00    	lea    0x812200(%eax),%edi
+  8001e8:	89 7d ac             	mov    %edi,-0x54(%ebp)
+	uintptr_t va = (uintptr_t) q->dr_buf;
+  8001eb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8001ee:	8b 40 08             	mov    0x8(%eax),%eax
+	if (!c->ic_bmbase || va % 2)
+  8001f1:	8d 1c 52             	lea    (%edx,%edx,2),%ebx
+  8001f4:	0f b7 1c 9d 0e d0 80 	movzwl 0x80d00e(,%ebx,4),%ebx
+  8001fb:	00 
+  8001fc:	66 89 5d c0          	mov    %bx,-0x40(%ebp)
+  800200:	66 85 db             	test   %bx,%bx
+  800203:	0f 84 ff 00 00 00    	je     800308 <ide_rw+0x249>
+	uintptr_t va = (uintptr_t) q->dr_buf;
+  800209:	89 c1                	mov    %eax,%ecx
+	if (!c->ic_bmbase || va % 2)
+  80020b:	a8 01                	test   $0x1,%al
+  80020d:	0f 85 b7 01 00 00    	jne    8003ca <ide_rw+0x30b>
+	size_t left = q->dr_nsecs * SECTSIZE, n;
+  800213:	c1 e6 09             	shl    $0x9,%esi
+	for (i = 0; left > 0; i++) {
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021b:	89 7d bc             	mov    %edi,-0x44(%ebp)
+  80021e:	89 55 a8             	mov    %edx,-0x58(%ebp)
+  800221:	eb 7b                	jmp    80029e <ide_rw+0x1df>
+  800223:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800226:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  800229:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80022c:	e9 52 ff ff ff       	jmp    800183 <ide_rw+0xc4>
+	assert(q->dr_nsecs <= 256);
+  800231:	68 18 ad 80 00       	push   $0x80ad18
+  800236:	68 2b ad 80 00       	push   $0x80ad2b
+  80023b:	68 b2 00 00 00       	push   $0xb2
+  800240:	68 40 ad 80 00       	push   $0x80ad40
+  800245:	e8 ce 64 00 00       	call   806718 <_panic>
+		assert(i < NPRD);
+  80024a:	68 49 ad 80 00       	push   $0x80ad49
+  80024f:	68 2b ad 80 00       	push   $0x80ad2b
+  800254:	68 9b 00 00 00       	push   $0x9b
+  800259:	68 40 ad 80 00       	push   $0x80ad40
+  80025e:	e8 b5 64 00 00       	call   806718 <_panic>
+		n = MIN(PGSIZE - PGOFF(va), left);
+  800263:	89 ca                	mov    %ecx,%edx
+  800265:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80026b:	89 d7                	mov    %edx,%edi
+  80026d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  800272:	29 d0                	sub    %edx,%eax
+  800274:	89 c2                	mov    %eax,%edx
+  800276:	39 f0                	cmp    %esi,%eax
+  800278:	0f 47 d6             	cmova  %esi,%edx
+		prd[i].prd_addr = PTE_ADDR(pte) | PGOFF(va);
+  80027b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80027e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800283:	09 f8                	or     %edi,%eax
+  800285:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  800288:	89 04 df             	mov    %eax,(%edi,%ebx,8)
+		prd[i].prd_len = n;
+  80028b:	66 89 54 df 04       	mov    %dx,0x4(%edi,%ebx,8)
+		prd[i].prd_flags = 0;
+  800290:	66 c7 44 df 06 00 00 	movw   $0x0,0x6(%edi,%ebx,8)
+		va += n;
+  800297:	01 d1                	add    %edx,%ecx
+		left -= n;
+  800299:	29 d6                	sub    %edx,%esi
+	for (i = 0; left > 0; i++) {
+  80029b:	83 c3 01             	add    $0x1,%ebx
+  80029e:	85 f6                	test   %esi,%esi
+  8002a0:	74 52                	je     8002f4 <ide_rw+0x235>
+		assert(i < NPRD);
+  8002a2:	83 fb 40             	cmp    $0x40,%ebx
+  8002a5:	74 a3                	je     80024a <ide_rw+0x18b>
+		if (!(uvpd[PDX(va)] & PTE_P))
+  8002a7:	89 c8                	mov    %ecx,%eax
+  8002a9:	c1 e8 16             	shr    $0x16,%eax
+  8002ac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8002b3:	a8 01                	test   $0x1,%al
+  8002b5:	0f 84 19 01 00 00    	je     8003d4 <ide_rw+0x315>
+		pte = uvpt[PGNUM(va)];
+  8002bb:	89 c8                	mov    %ecx,%eax
+  8002bd:	c1 e8 0c             	shr    $0xc,%eax
+  8002c0:	8b 3c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edi
+  8002c7:	89 7d cc             	mov    %edi,-0x34(%ebp)
+		if (!(pte & PTE_P) || (!q->dr_write && !(pte & PTE_W)))
+  8002ca:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8002d0:	0f 84 0b 01 00 00    	je     8003e1 <ide_rw+0x322>
+  8002d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8002d9:	0f b6 50 10          	movzbl 0x10(%eax),%edx
+  8002dd:	84 d2                	test   %dl,%dl
+  8002df:	75 82                	jne    800263 <ide_rw+0x1a4>
+  8002e1:	f7 c7 02 00 00 00    	test   $0x2,%edi
+  8002e7:	0f 85 76 ff ff ff    	jne    800263 <ide_rw+0x1a4>
+  8002ed:	89 d7                	mov    %edx,%edi
+  8002ef:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  8002f2:	eb 19                	jmp    80030d <ide_rw+0x24e>
+	prd[i - 1].prd_flags = PRD_EOT;
+  8002f4:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  8002f7:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  8002fa:	66 c7 44 d8 fe 00 80 	movw   $0x8000,-0x2(%eax,%ebx,8)
+	return 1;
+  800301:	bf 01 00 00 00       	mov    $0x1,%edi
+  800306:	eb 05                	jmp    80030d <ide_rw+0x24e>
+		return 0;
+  800308:	bf 00 00 00 00       	mov    $0x0,%edi
+	c->ic_dma = ide_dma_prepare(c, q);
+  80030d:	8d 04 12             	lea    (%edx,%edx,1),%eax
+  800310:	8d 1c 10             	lea    (%eax,%edx,1),%ebx
+  800313:	89 f9                	mov    %edi,%ecx
+  800315:	88 0c 9d 10 d0 80 00 	mov    %cl,0x80d010(,%ebx,4)
+	while (((r = inb(c->ic_base + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80031c:	0f b7 04 9d 0c d0 80 	movzwl 0x80d00c(,%ebx,4),%eax
+  800323:	00 
+  800324:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800327:	8d 58 07             	lea    0x7(%eax),%ebx
+  80032a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80032d:	89 da                	mov    %ebx,%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80032f:	ec                   	in     (%dx),%al
+  800330:	83 e0 c0             	and    $0xffffffc0,%eax
+  800333:	3c 40                	cmp    $0x40,%al
+  800335:	75 f8                	jne    80032f <ide_rw+0x270>
+	if (c->ic_dma) {
+  800337:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80033a:	89 d3                	mov    %edx,%ebx
+  80033c:	89 f8                	mov    %edi,%eax
+  80033e:	84 c0                	test   %al,%al
+  800340:	0f 85 a8 00 00 00    	jne    8003ee <ide_rw+0x32f>
+	outb(c->ic_base + 2, q->dr_nsecs);
+  800346:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800349:	8b 46 0c             	mov    0xc(%esi),%eax
+  80034c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80034f:	8d 51 02             	lea    0x2(%ecx),%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800352:	ee                   	out    %al,(%dx)
+	outb(c->ic_base + 3, q->dr_secno & 0xFF);
+  800353:	8b 76 04             	mov    0x4(%esi),%esi
+  800356:	8d 51 03             	lea    0x3(%ecx),%edx
+  800359:	89 f0                	mov    %esi,%eax
+  80035b:	ee                   	out    %al,(%dx)
+	outb(c->ic_base + 4, (q->dr_secno >> 8) & 0xFF);
+  80035c:	89 f0                	mov    %esi,%eax
+  80035e:	c1 e8 08             	shr    $0x8,%eax
+  800361:	8d 51 04             	lea    0x4(%ecx),%edx
+  800364:	ee                   	out    %al,(%dx)
+	outb(c->ic_base + 5, (q->dr_secno >> 16) & 0xFF);
+  800365:	89 f0                	mov    %esi,%eax
+  800367:	c1 e8 10             	shr    $0x10,%eax
+  80036a:	8d 51 05             	lea    0x5(%ecx),%edx
+  80036d:	ee                   	out    %al,(%dx)
+	outb(c->ic_base + 6, 0xE0 | ((q->dr_disk&1)<<4) | ((q->dr_secno>>24)&0x0F));
+  80036e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800371:	0f b6 00             	movzbl (%eax),%eax
+  800374:	c1 e0 04             	shl    $0x4,%eax
+  800377:	83 e0 10             	and    $0x10,%eax
+  80037a:	c1 ee 18             	shr    $0x18,%esi
+  80037d:	83 e6 0f             	and    $0xf,%esi
+  800380:	09 f0                	or     %esi,%eax
+  800382:	83 c8 e0             	or     $0xffffffe0,%eax
+  800385:	8d 51 06             	lea    0x6(%ecx),%edx
+  800388:	ee                   	out    %al,(%dx)
+	if (c->ic_dma)
+  800389:	89 f8                	mov    %edi,%eax
+  80038b:	84 c0                	test   %al,%al
+  80038d:	0f 84 97 00 00 00    	je     80042a <ide_rw+0x36b>
+		cmd = q->dr_write ? 0xCA : 0xC8;
+  800393:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800396:	80 78 10 01          	cmpb   $0x1,0x10(%eax)
+  80039a:	19 c0                	sbb    %eax,%eax
+  80039c:	83 e0 fe             	and    $0xfffffffe,%eax
+  80039f:	05 ca 00 00 00       	add    $0xca,%eax
+  8003a4:	89 da                	mov    %ebx,%edx
+  8003a6:	ee                   	out    %al,(%dx)
+	if (c->ic_dma)
+  8003a7:	89 f8                	mov    %edi,%eax
+  8003a9:	84 c0                	test   %al,%al
+  8003ab:	0f 84 e1 01 00 00    	je     800592 <ide_rw+0x4d3>
+		outb(c->ic_bmbase + BM_CMD,
+  8003b1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b4:	80 78 10 01          	cmpb   $0x1,0x10(%eax)
+  8003b8:	19 c0                	sbb    %eax,%eax
+  8003ba:	83 e0 08             	and    $0x8,%eax
+  8003bd:	83 c0 01             	add    $0x1,%eax
+  8003c0:	0f b7 55 c0          	movzwl -0x40(%ebp),%edx
+  8003c4:	ee                   	out    %al,(%dx)
+}
+  8003c5:	e9 c8 01 00 00       	jmp    800592 <ide_rw+0x4d3>
+		return 0;
+  8003ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003cf:	e9 39 ff ff ff       	jmp    80030d <ide_rw+0x24e>
+			return 0;
+  8003d4:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  8003d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003dc:	e9 2c ff ff ff       	jmp    80030d <ide_rw+0x24e>
+			return 0;
+  8003e1:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  8003e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e9:	e9 1f ff ff ff       	jmp    80030d <ide_rw+0x24e>
+		outb(c->ic_bmbase + BM_CMD, 0);
+  8003ee:	0f b7 55 c0          	movzwl -0x40(%ebp),%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	89 d6                	mov    %edx,%esi
+  8003f9:	ee                   	out    %al,(%dx)
+	return PTE_ADDR(uvpt[PGNUM(va)]) | PGOFF(va);
+  8003fa:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  8003fd:	89 c8                	mov    %ecx,%eax
+  8003ff:	c1 e8 0c             	shr    $0xc,%eax
+  800402:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800409:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80040e:	89 c2                	mov    %eax,%edx
+  800410:	89 c8                	mov    %ecx,%eax
+  800412:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800417:	09 d0                	or     %edx,%eax
+		outl(c->ic_bmbase + BM_PRDT, va2pa(prdt[c - channels]));
+  800419:	8d 56 04             	lea    0x4(%esi),%edx
+}
+
+static inline void
+outl(int port, uint32_t data)
+{
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  80041c:	ef                   	out    %eax,(%dx)
+		     inb(c->ic_bmbase + BM_STATUS) | BM_STATUS_INTR | BM_STATUS_ERR);
+  80041d:	8d 56 02             	lea    0x2(%esi),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800420:	ec                   	in     (%dx),%al
+		outb(c->ic_bmbase + BM_STATUS,
+  800421:	83 c8 06             	or     $0x6,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800424:	ee                   	out    %al,(%dx)
+}
+  800425:	e9 1c ff ff ff       	jmp    800346 <ide_rw+0x287>
+		cmd = q->dr_write ? 0x30 : 0x20;
+  80042a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042d:	80 78 10 01          	cmpb   $0x1,0x10(%eax)
+  800431:	19 c0                	sbb    %eax,%eax
+  800433:	83 e0 f0             	and    $0xfffffff0,%eax
+  800436:	83 c0 30             	add    $0x30,%eax
+  800439:	e9 66 ff ff ff       	jmp    8003a4 <ide_rw+0x2e5>
+	bs = inb(c->ic_bmbase + BM_STATUS);
+  80043e:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  800441:	0f b7 3c 85 0e d0 80 	movzwl 0x80d00e(,%eax,4),%edi
+  800448:	00 
+  800449:	8d 57 02             	lea    0x2(%edi),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80044c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80044f:	ec                   	in     (%dx),%al
+	if (!(bs & BM_STATUS_INTR))
+  800450:	88 45 d0             	mov    %al,-0x30(%ebp)
+  800453:	a8 04                	test   $0x4,%al
+  800455:	0f 84 d4 01 00 00    	je     80062f <ide_rw+0x570>
+	s = inb(c->ic_base + 7);
+  80045b:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  80045e:	0f b7 14 85 0c d0 80 	movzwl 0x80d00c(,%eax,4),%edx
+  800465:	00 
+  800466:	83 c2 07             	add    $0x7,%edx
+  800469:	ec                   	in     (%dx),%al
+  80046a:	89 c1                	mov    %eax,%ecx
+	if (s & IDE_BSY)
+  80046c:	84 c0                	test   %al,%al
+  80046e:	0f 88 c2 01 00 00    	js     800636 <ide_rw+0x577>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	89 fa                	mov    %edi,%edx
+  80047b:	ee                   	out    %al,(%dx)
+  80047c:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+  800480:	83 c8 06             	or     $0x6,%eax
+  800483:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  800486:	ee                   	out    %al,(%dx)
+	if ((bs & BM_STATUS_ERR) || (s & (IDE_DF|IDE_ERR)))
+  800487:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+  80048b:	83 e0 02             	and    $0x2,%eax
+  80048e:	83 e1 21             	and    $0x21,%ecx
+  800491:	08 c8                	or     %cl,%al
+  800493:	0f 85 b5 00 00 00    	jne    80054e <ide_rw+0x48f>
+	q->dr_buf += q->dr_nsecs * SECTSIZE;
+  800499:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80049c:	c1 e0 09             	shl    $0x9,%eax
+  80049f:	01 43 08             	add    %eax,0x8(%ebx)
+	q->dr_nsecs = 0;
+  8004a2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  8004a9:	89 f0                	mov    %esi,%eax
+  8004ab:	88 45 c2             	mov    %al,-0x3e(%ebp)
+  8004ae:	e9 ad 00 00 00       	jmp    800560 <ide_rw+0x4a1>
+	asm volatile("cld\n\trepne\n\tinsl"
+  8004b3:	8b 7b 08             	mov    0x8(%ebx),%edi
+  8004b6:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8004bb:	89 f2                	mov    %esi,%edx
+  8004bd:	fc                   	cld
+  8004be:	f2 6d                	repnz insl (%dx),%es:(%edi)
+}
+  8004c0:	e9 43 01 00 00       	jmp    800608 <ide_rw+0x549>
+			progress |= s != 0;
+			if (cur[i]->dr_nsecs == 0)
+				cur[i] = 0;
+		}
+		// An interrupt after 'seen' was read makes this return at once.
+		if (busy && !progress && !polled)
+  8004c5:	84 d2                	test   %dl,%dl
+  8004c7:	74 09                	je     8004d2 <ide_rw+0x413>
+  8004c9:	0f b6 45 c2          	movzbl -0x3e(%ebp),%eax
+  8004cd:	0a 45 c3             	or     -0x3d(%ebp),%al
+  8004d0:	74 28                	je     8004fa <ide_rw+0x43b>
+			sys_futex_wait(&ide_nintr, seen, IDE_TIMEOUT);
+	} while (busy);
+  8004d2:	84 d2                	test   %dl,%dl
+  8004d4:	74 3b                	je     800511 <ide_rw+0x452>
+		seen = ide_nintr;
+  8004d6:	a1 00 20 81 00       	mov    0x812000,%eax
+  8004db:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+		for (i = 0; i < NCHANNELS; i++) {
+  8004de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8004e1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004e4:	c7 45 d4 0c d0 80 00 	movl   $0x80d00c,-0x2c(%ebp)
+		busy = progress = polled = 0;
+  8004eb:	c6 45 c3 00          	movb   $0x0,-0x3d(%ebp)
+  8004ef:	c6 45 c2 00          	movb   $0x0,-0x3e(%ebp)
+  8004f3:	ba 00 00 00 00       	mov    $0x0,%edx
+		for (i = 0; i < NCHANNELS; i++) {
+  8004f8:	eb 7c                	jmp    800576 <ide_rw+0x4b7>
+			sys_futex_wait(&ide_nintr, seen, IDE_TIMEOUT);
+  8004fa:	83 ec 04             	sub    $0x4,%esp
+  8004fd:	6a 64                	push   $0x64
+  8004ff:	ff 75 b4             	push   -0x4c(%ebp)
+  800502:	68 00 20 81 00       	push   $0x812000
+  800507:	e8 1e 70 00 00       	call   80752a <sys_futex_wait>
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	eb c5                	jmp    8004d6 <ide_rw+0x417>
+
+	for (i = 0; i < NCHANNELS; i++)
+		if (used[i])
+  800511:	0f b7 5d a6          	movzwl -0x5a(%ebp),%ebx
+  800515:	84 db                	test   %bl,%bl
+  800517:	75 11                	jne    80052a <ide_rw+0x46b>
+  800519:	66 c1 eb 08          	shr    $0x8,%bx
+  80051d:	75 1d                	jne    80053c <ide_rw+0x47d>
+			mutex_unlock(&channels[i].ic_mu);
+	return r;
+}
+  80051f:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800525:	5b                   	pop    %ebx
+  800526:	5e                   	pop    %esi
+  800527:	5f                   	pop    %edi
+  800528:	5d                   	pop    %ebp
+  800529:	c3                   	ret
+			mutex_unlock(&channels[i].ic_mu);
+  80052a:	83 ec 0c             	sub    $0xc,%esp
+  80052d:	68 14 d0 80 00       	push   $0x80d014
+  800532:	e8 d6 95 00 00       	call   809b0d <mutex_unlock>
+  800537:	83 c4 10             	add    $0x10,%esp
+  80053a:	eb dd                	jmp    800519 <ide_rw+0x45a>
+  80053c:	83 ec 0c             	sub    $0xc,%esp
+  80053f:	68 20 d0 80 00       	push   $0x80d020
+  800544:	e8 c4 95 00 00       	call   809b0d <mutex_unlock>
+  800549:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80054c:	eb d1                	jmp    80051f <ide_rw+0x460>
+				cur[i]->dr_nsecs = 0;
+  80054e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  800555:	c6 45 c2 01          	movb   $0x1,-0x3e(%ebp)
+				r = -1;
+  800559:	c7 45 b0 ff ff ff ff 	movl   $0xffffffff,-0x50(%ebp)
+				cur[i] = 0;
+  800560:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800563:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+			busy = 1;
+  800569:	ba 01 00 00 00       	mov    $0x1,%edx
+		for (i = 0; i < NCHANNELS; i++) {
+  80056e:	83 45 c4 04          	addl   $0x4,-0x3c(%ebp)
+  800572:	83 45 d4 0c          	addl   $0xc,-0x2c(%ebp)
+  800576:	81 7d d4 24 d0 80 00 	cmpl   $0x80d024,-0x2c(%ebp)
+  80057d:	0f 84 42 ff ff ff    	je     8004c5 <ide_rw+0x406>
+			if (!cur[i]) {
+  800583:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800586:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800589:	83 38 00             	cmpl   $0x0,(%eax)
+  80058c:	0f 84 91 fc ff ff    	je     800223 <ide_rw+0x164>
+			polled |= !channels[i].ic_dma;
+  800592:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800595:	0f b6 40 04          	movzbl 0x4(%eax),%eax
+  800599:	88 45 d0             	mov    %al,-0x30(%ebp)
+  80059c:	83 f0 01             	xor    $0x1,%eax
+  80059f:	08 45 c3             	or     %al,-0x3d(%ebp)
+			if ((s = ide_step(cur[i])) < 0) {
+  8005a2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005a5:	8b 18                	mov    (%eax),%ebx
+	return &channels[d / 2];
+  8005a7:	8b 13                	mov    (%ebx),%edx
+  8005a9:	89 d0                	mov    %edx,%eax
+  8005ab:	c1 e8 1f             	shr    $0x1f,%eax
+  8005ae:	01 d0                	add    %edx,%eax
+  8005b0:	89 c1                	mov    %eax,%ecx
+  8005b2:	d1 f9                	sar    %ecx
+	if (c->ic_dma)
+  8005b4:	83 e0 fe             	and    $0xfffffffe,%eax
+  8005b7:	01 c8                	add    %ecx,%eax
+  8005b9:	0f b6 34 85 10 d0 80 	movzbl 0x80d010(,%eax,4),%esi
+  8005c0:	00 
+  8005c1:	89 f0                	mov    %esi,%eax
+  8005c3:	84 c0                	test   %al,%al
+  8005c5:	0f 85 73 fe ff ff    	jne    80043e <ide_rw+0x37f>
+	s = inb(c->ic_base + 7);
+  8005cb:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  8005ce:	0f b7 3c 85 0c d0 80 	movzwl 0x80d00c(,%eax,4),%edi
+  8005d5:	00 
+  8005d6:	89 fe                	mov    %edi,%esi
+  8005d8:	8d 57 07             	lea    0x7(%edi),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  8005db:	ec                   	in     (%dx),%al
+	if (s & IDE_BSY)
+  8005dc:	84 c0                	test   %al,%al
+  8005de:	78 5d                	js     80063d <ide_rw+0x57e>
+	if (s & (IDE_DF|IDE_ERR))
+  8005e0:	a8 21                	test   $0x21,%al
+  8005e2:	0f 85 66 ff ff ff    	jne    80054e <ide_rw+0x48f>
+		return 0;
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(s & IDE_DRQ))
+  8005ed:	a8 08                	test   $0x8,%al
+  8005ef:	74 27                	je     800618 <ide_rw+0x559>
+	if (q->dr_write)
+  8005f1:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8005f5:	0f 84 b8 fe ff ff    	je     8004b3 <ide_rw+0x3f4>
+	asm volatile("cld\n\trepne\n\toutsl"
+  8005fb:	8b 73 08             	mov    0x8(%ebx),%esi
+  8005fe:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800603:	89 fa                	mov    %edi,%edx
+  800605:	fc                   	cld
+  800606:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	q->dr_buf += SECTSIZE;
+  800608:	81 43 08 00 02 00 00 	addl   $0x200,0x8(%ebx)
+	q->dr_nsecs--;
+  80060f:	83 6b 0c 01          	subl   $0x1,0xc(%ebx)
+	return 1;
+  800613:	ba 01 00 00 00       	mov    $0x1,%edx
+			progress |= s != 0;
+  800618:	08 55 c2             	or     %dl,-0x3e(%ebp)
+			if (cur[i]->dr_nsecs == 0)
+  80061b:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80061f:	0f 84 3b ff ff ff    	je     800560 <ide_rw+0x4a1>
+			busy = 1;
+  800625:	ba 01 00 00 00       	mov    $0x1,%edx
+  80062a:	e9 3f ff ff ff       	jmp    80056e <ide_rw+0x4af>
+		return 0;
+  80062f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800634:	eb e2                	jmp    800618 <ide_rw+0x559>
+		return 0;
+  800636:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063b:	eb db                	jmp    800618 <ide_rw+0x559>
+		return 0;
+  80063d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800642:	eb d4                	jmp    800618 <ide_rw+0x559>
+				if (!(cur[i] = ide_next(reqs, reqs + n, &channels[i])))
+  800644:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800647:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  80064d:	e9 1c ff ff ff       	jmp    80056e <ide_rw+0x4af>
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+  800652:	b7 00                	mov    $0x0,%bh
+	r = 0;
+  800654:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+		n = MIN(PGSIZE - PGOFF(va), left);
+  80065b:	66 89 5d a6          	mov    %bx,-0x5a(%ebp)
+  80065f:	e9 72 fe ff ff       	jmp    8004d6 <ide_rw+0x417>
+		if ((used[i] = ide_next(reqs, reqs + n, &channels[i]) != 0))
+  800664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800669:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066c:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+  80066f:	e9 c1 fa ff ff       	jmp    800135 <ide_rw+0x76>
+
+00800674 <ide_init>:
+{
+  800674:	55                   	push   %ebp
+  800675:	89 e5                	mov    %esp,%ebp
+  800677:	56                   	push   %esi
+  800678:	53                   	push   %ebx
+  800679:	83 ec 40             	sub    $0x40,%esp
+	for (i = 0; sys_pci_storage(i, &pd) == 0; i++)
+  80067c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800681:	8d 75 bc             	lea    -0x44(%ebp),%esi
+  800684:	eb 03                	jmp    800689 <ide_init+0x15>
+  800686:	83 c3 01             	add    $0x1,%ebx
+  800689:	83 ec 08             	sub    $0x8,%esp
+  80068c:	56                   	push   %esi
+  80068d:	53                   	push   %ebx
+  80068e:	e8 c8 6f 00 00       	call   80765b <sys_pci_storage>
+  800693:	83 c4 10             	add    $0x10,%esp
+  800696:	85 c0                	test   %eax,%eax
+  800698:	75 20                	jne    8006ba <ide_init+0x46>
+		if (PCIDEV_CLASS(&pd) == PCIDEV_CLASS_STORAGE
+  80069a:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80069d:	89 c2                	mov    %eax,%edx
+  80069f:	c1 ea 18             	shr    $0x18,%edx
+  8006a2:	83 fa 01             	cmp    $0x1,%edx
+  8006a5:	75 df                	jne    800686 <ide_init+0x12>
+		    && PCIDEV_SUBCLASS(&pd) == PCIDEV_SUBCLASS_IDE
+  8006a7:	c1 e8 10             	shr    $0x10,%eax
+  8006aa:	3c 01                	cmp    $0x1,%al
+  8006ac:	75 d8                	jne    800686 <ide_init+0x12>
+		    && pd.pd_base[4] && pd.pd_size[4] >= 16)
+  8006ae:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8006b2:	74 d2                	je     800686 <ide_init+0x12>
+  8006b4:	83 7d ec 0f          	cmpl   $0xf,-0x14(%ebp)
+  8006b8:	76 cc                	jbe    800686 <ide_init+0x12>
+	if (sys_pci_storage(i, &pd) < 0)
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  8006c0:	50                   	push   %eax
+  8006c1:	53                   	push   %ebx
+  8006c2:	e8 94 6f 00 00       	call   80765b <sys_pci_storage>
+  8006c7:	83 c4 10             	add    $0x10,%esp
+  8006ca:	85 c0                	test   %eax,%eax
+  8006cc:	78 50                	js     80071e <ide_init+0xaa>
+	if (sys_irq_listen(IRQ_IDE, &ide_nintr) < 0
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	68 00 20 81 00       	push   $0x812000
+  8006d6:	6a 0e                	push   $0xe
+  8006d8:	e8 50 6f 00 00       	call   80762d <sys_irq_listen>
+  8006dd:	83 c4 10             	add    $0x10,%esp
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	78 3a                	js     80071e <ide_init+0xaa>
+	    || sys_irq_listen(IRQ_IDE2, &ide_nintr) < 0)
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	68 00 20 81 00       	push   $0x812000
+  8006ec:	6a 0f                	push   $0xf
+  8006ee:	e8 3a 6f 00 00       	call   80762d <sys_irq_listen>
+  8006f3:	83 c4 10             	add    $0x10,%esp
+  8006f6:	85 c0                	test   %eax,%eax
+  8006f8:	78 24                	js     80071e <ide_init+0xaa>
+	channels[0].ic_bmbase = pd.pd_base[4];
+  8006fa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006fd:	66 a3 0e d0 80 00    	mov    %ax,0x80d00e
+	channels[1].ic_bmbase = pd.pd_base[4] + 8;
+  800703:	8d 50 08             	lea    0x8(%eax),%edx
+  800706:	66 89 15 1a d0 80 00 	mov    %dx,0x80d01a
+	cprintf("IDE: bus-master DMA at 0x%x\n", pd.pd_base[4]);
+  80070d:	83 ec 08             	sub    $0x8,%esp
+  800710:	50                   	push   %eax
+  800711:	68 52 ad 80 00       	push   $0x80ad52
+  800716:	e8 d8 60 00 00       	call   8067f3 <cprintf>
+  80071b:	83 c4 10             	add    $0x10,%esp
+}
+  80071e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800721:	5b                   	pop    %ebx
+  800722:	5e                   	pop    %esi
+  800723:	5d                   	pop    %ebp
+  800724:	c3                   	ret
+
+00800725 <ide_read>:
+	.dd_rw = ide_rw,
+};
+
+int
+ide_read(int d, uint32_t secno, void *dst, size_t nsecs)
+{
+  800725:	55                   	push   %ebp
+  800726:	89 e5                	mov    %esp,%ebp
+  800728:	83 ec 30             	sub    $0x30,%esp
+	struct DiskReq q = { d, secno, dst, nsecs, 0 };
+  80072b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800731:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800734:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800737:	8b 45 10             	mov    0x10(%ebp),%eax
+  80073a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800743:	c6 45 f4 00          	movb   $0x0,-0xc(%ebp)
+
+	return ide_rw(&q, 1);
+  800747:	6a 01                	push   $0x1
+  800749:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80074c:	50                   	push   %eax
+  80074d:	e8 6d f9 ff ff       	call   8000bf <ide_rw>
+}
+  800752:	c9                   	leave
+  800753:	c3                   	ret
+
+00800754 <ide_write>:
+
+int
+ide_write(int d, uint32_t secno, const void *src, size_t nsecs)
+{
+  800754:	55                   	push   %ebp
+  800755:	89 e5                	mov    %esp,%ebp
+  800757:	83 ec 30             	sub    $0x30,%esp
+	struct DiskReq q = { d, secno, (void*) src, nsecs, 1 };
+  80075a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80075d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800760:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800763:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800766:	8b 45 10             	mov    0x10(%ebp),%eax
+  800769:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800772:	c6 45 f4 01          	movb   $0x1,-0xc(%ebp)
+
+	return ide_rw(&q, 1);
+  800776:	6a 01                	push   $0x1
+  800778:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077b:	50                   	push   %eax
+  80077c:	e8 3e f9 ff ff       	call   8000bf <ide_rw>
+}
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+00800783 <va2pa>:
+// virtio_nintr when the lines were last unmasked.
+static uint32_t virtio_armed;
+
+static physaddr_t
+va2pa(const volatile void *va)
+{
+  800783:	89 c2                	mov    %eax,%edx
+	return PTE_ADDR(uvpt[PGNUM(va)]) | PGOFF(va);
+  800785:	c1 e8 0c             	shr    $0xc,%eax
+  800788:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80078f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800794:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80079a:	09 d0                	or     %edx,%eax
+}
+  80079c:	c3                   	ret
+
+0080079d <virtio_probe>:
+	return nvblk;
+}
+
+static bool
+virtio_probe(int d)
+{
+  80079d:	55                   	push   %ebp
+  80079e:	89 e5                	mov    %esp,%ebp
+  8007a0:	8b 55 08             	mov    0x8(%ebp),%edx
+	return d >= 0 && d < nvblk;
+  8007a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a8:	85 d2                	test   %edx,%edx
+  8007aa:	78 0c                	js     8007b8 <virtio_probe+0x1b>
+  8007ac:	39 15 08 26 81 00    	cmp    %edx,0x812608
+  8007b2:	0f 9f c0             	setg   %al
+  8007b5:	0f b6 c0             	movzbl %al,%eax
+  8007b8:	83 e0 01             	and    $0x1,%eax
+}
+  8007bb:	5d                   	pop    %ebp
+  8007bc:	c3                   	ret
+
+008007bd <virtio_submit>:
+// Put q on vb's available ring, without telling the device.
+// Returns the chain's head descriptor, or -1 if too few descriptors
+// are free.  Call with vb_mu held.
+static int
+virtio_submit(struct VirtioBlk *vb, struct DiskReq *q)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	57                   	push   %edi
+  8007c1:	56                   	push   %esi
+  8007c2:	53                   	push   %ebx
+  8007c3:	81 ec 3c 01 00 00    	sub    $0x13c,%esp
+  8007c9:	89 85 c8 fe ff ff    	mov    %eax,-0x138(%ebp)
+  8007cf:	89 95 cc fe ff ff    	mov    %edx,-0x134(%ebp)
+	struct { physaddr_t pa; uint32_t len; } seg[BC_MAXIO * BLKSECTS * SECTSIZE / PGSIZE + 1];
+	char *va = q->dr_buf, *end = va + q->dr_nsecs * SECTSIZE;
+  8007d5:	8b 5a 08             	mov    0x8(%edx),%ebx
+  8007d8:	8b 42 0c             	mov    0xc(%edx),%eax
+  8007db:	c1 e0 09             	shl    $0x9,%eax
+  8007de:	01 d8                	add    %ebx,%eax
+  8007e0:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	int nseg, head, i, d;
+	physaddr_t pa;
+	uint32_t n;
+
+	// Gather the buffer into physically contiguous pieces.
+	for (nseg = 0; va < end; va += n) {
+  8007e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007eb:	eb 56                	jmp    800843 <virtio_submit+0x86>
+		if (devwrite)
+  8007ed:	84 c0                	test   %al,%al
+  8007ef:	75 05                	jne    8007f6 <virtio_submit+0x39>
+			(void) *(volatile char *) va;
+  8007f1:	0f b6 03             	movzbl (%ebx),%eax
+  8007f4:	eb 05                	jmp    8007fb <virtio_submit+0x3e>
+			*(volatile char *) va = *(volatile char *) va;
+  8007f6:	0f b6 03             	movzbl (%ebx),%eax
+  8007f9:	88 03                	mov    %al,(%ebx)
+	return va2pa(va);
+  8007fb:	89 d8                	mov    %ebx,%eax
+  8007fd:	e8 81 ff ff ff       	call   800783 <va2pa>
+  800802:	89 c1                	mov    %eax,%ecx
+		n = MIN(PGSIZE - PGOFF(va), end - va);
+		pa = virtio_pa(va, !q->dr_write);
+		if (nseg > 0 && seg[nseg - 1].pa + seg[nseg - 1].len == pa)
+  800804:	85 ff                	test   %edi,%edi
+  800806:	7e 1f                	jle    800827 <virtio_submit+0x6a>
+  800808:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80080b:	8b 84 d5 e4 fe ff ff 	mov    -0x11c(%ebp,%edx,8),%eax
+  800812:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  800818:	03 84 d5 e0 fe ff ff 	add    -0x120(%ebp,%edx,8),%eax
+  80081f:	39 c8                	cmp    %ecx,%eax
+  800821:	0f 84 a0 00 00 00    	je     8008c7 <virtio_submit+0x10a>
+			seg[nseg - 1].len += n;
+		else {
+			assert(nseg < ARRAY_SIZE(seg));
+  800827:	83 ff 20             	cmp    $0x20,%edi
+  80082a:	0f 87 ab 00 00 00    	ja     8008db <virtio_submit+0x11e>
+			seg[nseg].pa = pa;
+  800830:	89 8c fd e0 fe ff ff 	mov    %ecx,-0x120(%ebp,%edi,8)
+			seg[nseg++].len = n;
+  800837:	89 b4 fd e4 fe ff ff 	mov    %esi,-0x11c(%ebp,%edi,8)
+  80083e:	8d 7f 01             	lea    0x1(%edi),%edi
+	for (nseg = 0; va < end; va += n) {
+  800841:	01 f3                	add    %esi,%ebx
+  800843:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  800849:	39 c3                	cmp    %eax,%ebx
+  80084b:	0f 83 a3 00 00 00    	jae    8008f4 <virtio_submit+0x137>
+		n = MIN(PGSIZE - PGOFF(va), end - va);
+  800851:	89 d8                	mov    %ebx,%eax
+  800853:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800858:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80085d:	29 c2                	sub    %eax,%edx
+  80085f:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  800865:	29 d8                	sub    %ebx,%eax
+  800867:	39 c2                	cmp    %eax,%edx
+  800869:	0f 46 c2             	cmovbe %edx,%eax
+  80086c:	89 c6                	mov    %eax,%esi
+		pa = virtio_pa(va, !q->dr_write);
+  80086e:	8b 85 cc fe ff ff    	mov    -0x134(%ebp),%eax
+  800874:	0f b6 40 10          	movzbl 0x10(%eax),%eax
+  800878:	88 85 d0 fe ff ff    	mov    %al,-0x130(%ebp)
+  80087e:	83 f0 01             	xor    $0x1,%eax
+	if (!(uvpd[PDX(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_P)
+  800881:	89 da                	mov    %ebx,%edx
+  800883:	c1 ea 16             	shr    $0x16,%edx
+  800886:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80088d:	f6 c2 01             	test   $0x1,%dl
+  800890:	0f 84 57 ff ff ff    	je     8007ed <virtio_submit+0x30>
+  800896:	89 da                	mov    %ebx,%edx
+  800898:	c1 ea 0c             	shr    $0xc,%edx
+  80089b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8008a2:	f6 c1 01             	test   $0x1,%cl
+  8008a5:	0f 84 42 ff ff ff    	je     8007ed <virtio_submit+0x30>
+	    || (devwrite && !(uvpt[PGNUM(va)] & PTE_W))) {
+  8008ab:	84 c0                	test   %al,%al
+  8008ad:	0f 84 48 ff ff ff    	je     8007fb <virtio_submit+0x3e>
+  8008b3:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8008ba:	a8 02                	test   $0x2,%al
+  8008bc:	0f 84 34 ff ff ff    	je     8007f6 <virtio_submit+0x39>
+  8008c2:	e9 34 ff ff ff       	jmp    8007fb <virtio_submit+0x3e>
+			seg[nseg - 1].len += n;
+  8008c7:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8008cd:	01 f1                	add    %esi,%ecx
+  8008cf:	89 8c d5 e4 fe ff ff 	mov    %ecx,-0x11c(%ebp,%edx,8)
+  8008d6:	e9 66 ff ff ff       	jmp    800841 <virtio_submit+0x84>
+			assert(nseg < ARRAY_SIZE(seg));
+  8008db:	68 73 ad 80 00       	push   $0x80ad73
+  8008e0:	68 2b ad 80 00       	push   $0x80ad2b
+  8008e5:	68 ce 00 00 00       	push   $0xce
+  8008ea:	68 8a ad 80 00       	push   $0x80ad8a
+  8008ef:	e8 24 5e 00 00       	call   806718 <_panic>
+		}
+	}
+	assert(nseg + 2 <= vb->vb_num);
+  8008f4:	8d 47 01             	lea    0x1(%edi),%eax
+  8008f7:	8b 8d c8 fe ff ff    	mov    -0x138(%ebp),%ecx
+  8008fd:	0f b7 51 04          	movzwl 0x4(%ecx),%edx
+  800901:	39 d0                	cmp    %edx,%eax
+  800903:	0f 8d ce 00 00 00    	jge    8009d7 <virtio_submit+0x21a>
+	if (nseg + 2 > vb->vb_nfree)
+  800909:	8b 9d c8 fe ff ff    	mov    -0x138(%ebp),%ebx
+  80090f:	0f b7 53 1a          	movzwl 0x1a(%ebx),%edx
+  800913:	39 d0                	cmp    %edx,%eax
+  800915:	0f 8d fc 01 00 00    	jge    800b17 <virtio_submit+0x35a>
+		return -1;
+
+	head = d = vb->vb_free;
+  80091b:	0f b7 43 18          	movzwl 0x18(%ebx),%eax
+  80091f:	66 89 85 c2 fe ff ff 	mov    %ax,-0x13e(%ebp)
+  800926:	0f b7 f0             	movzwl %ax,%esi
+	vslots[vb - vblk][head].vs_hdr.vh_type =
+  800929:	89 d8                	mov    %ebx,%eax
+  80092b:	2d 20 26 83 00       	sub    $0x832620,%eax
+  800930:	c1 f8 02             	sar    $0x2,%eax
+  800933:	69 c0 39 8e e3 38    	imul   $0x38e38e39,%eax,%eax
+  800939:	c1 e0 0a             	shl    $0xa,%eax
+  80093c:	01 f0                	add    %esi,%eax
+  80093e:	c1 e0 05             	shl    $0x5,%eax
+  800941:	89 c1                	mov    %eax,%ecx
+  800943:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+  800949:	8d 80 20 26 81 00    	lea    0x812620(%eax),%eax
+		q->dr_write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  80094f:	8b 95 cc fe ff ff    	mov    -0x134(%ebp),%edx
+  800955:	0f b6 52 10          	movzbl 0x10(%edx),%edx
+  800959:	89 91 20 26 81 00    	mov    %edx,0x812620(%ecx)
+	vslots[vb - vblk][head].vs_hdr.vh_ioprio = 0;
+  80095f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	vslots[vb - vblk][head].vs_hdr.vh_sector = q->dr_secno;
+  800966:	8b 95 cc fe ff ff    	mov    -0x134(%ebp),%edx
+  80096c:	8b 4a 04             	mov    0x4(%edx),%ecx
+  80096f:	89 48 08             	mov    %ecx,0x8(%eax)
+  800972:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+	vslots[vb - vblk][head].vs_status = 0xFF;
+  800979:	c6 40 10 ff          	movb   $0xff,0x10(%eax)
+	vslots[vb - vblk][head].vs_done = 0;
+  80097d:	c6 40 11 00          	movb   $0x0,0x11(%eax)
+
+	vb->vb_desc[d].vd_addr = va2pa(&vslots[vb - vblk][head].vs_hdr);
+  800981:	e8 fd fd ff ff       	call   800783 <va2pa>
+  800986:	89 c1                	mov    %eax,%ecx
+  800988:	89 b5 c4 fe ff ff    	mov    %esi,-0x13c(%ebp)
+  80098e:	89 f0                	mov    %esi,%eax
+  800990:	c1 e0 04             	shl    $0x4,%eax
+  800993:	89 de                	mov    %ebx,%esi
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	03 53 08             	add    0x8(%ebx),%edx
+  80099a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80099f:	89 0a                	mov    %ecx,(%edx)
+  8009a1:	89 5a 04             	mov    %ebx,0x4(%edx)
+	vb->vb_desc[d].vd_len = sizeof(struct VirtioBlkHdr);
+  8009a4:	89 f3                	mov    %esi,%ebx
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	03 56 08             	add    0x8(%esi),%edx
+  8009ab:	c7 42 08 10 00 00 00 	movl   $0x10,0x8(%edx)
+	vb->vb_desc[d].vd_flags = VRING_DESC_F_NEXT;
+  8009b2:	03 46 08             	add    0x8(%esi),%eax
+  8009b5:	66 c7 40 0c 01 00    	movw   $0x1,0xc(%eax)
+	head = d = vb->vb_free;
+  8009bb:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+	for (i = 0; i < nseg; i++) {
+  8009c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c6:	89 bd d0 fe ff ff    	mov    %edi,-0x130(%ebp)
+  8009cc:	89 9d d4 fe ff ff    	mov    %ebx,-0x12c(%ebp)
+  8009d2:	e9 80 00 00 00       	jmp    800a57 <virtio_submit+0x29a>
+	assert(nseg + 2 <= vb->vb_num);
+  8009d7:	68 96 ad 80 00       	push   $0x80ad96
+  8009dc:	68 2b ad 80 00       	push   $0x80ad2b
+  8009e1:	68 d3 00 00 00       	push   $0xd3
+  8009e6:	68 8a ad 80 00       	push   $0x80ad8a
+  8009eb:	e8 28 5d 00 00       	call   806718 <_panic>
+		d = vb->vb_desc[d].vd_next;
+  8009f0:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+  8009f6:	8b 4f 08             	mov    0x8(%edi),%ecx
+  8009f9:	c1 e6 04             	shl    $0x4,%esi
+  8009fc:	01 ce                	add    %ecx,%esi
+  8009fe:	0f b7 76 0e          	movzwl 0xe(%esi),%esi
+  800a02:	0f b7 f6             	movzwl %si,%esi
+		vb->vb_desc[d].vd_addr = seg[i].pa;
+  800a05:	89 f0                	mov    %esi,%eax
+  800a07:	c1 e0 04             	shl    $0x4,%eax
+  800a0a:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+  800a0d:	89 df                	mov    %ebx,%edi
+  800a0f:	8b 8c d5 e0 fe ff ff 	mov    -0x120(%ebp,%edx,8),%ecx
+  800a16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a1b:	89 0f                	mov    %ecx,(%edi)
+  800a1d:	89 5f 04             	mov    %ebx,0x4(%edi)
+		vb->vb_desc[d].vd_len = seg[i].len;
+  800a20:	89 c1                	mov    %eax,%ecx
+  800a22:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+  800a28:	03 4f 08             	add    0x8(%edi),%ecx
+  800a2b:	8b 9c d5 e4 fe ff ff 	mov    -0x11c(%ebp,%edx,8),%ebx
+  800a32:	89 59 08             	mov    %ebx,0x8(%ecx)
+		vb->vb_desc[d].vd_flags = VRING_DESC_F_NEXT
+  800a35:	8b bd cc fe ff ff    	mov    -0x134(%ebp),%edi
+  800a3b:	80 7f 10 01          	cmpb   $0x1,0x10(%edi)
+  800a3f:	19 c9                	sbb    %ecx,%ecx
+  800a41:	83 e1 02             	and    $0x2,%ecx
+  800a44:	83 c1 01             	add    $0x1,%ecx
+  800a47:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+  800a4d:	03 47 08             	add    0x8(%edi),%eax
+  800a50:	66 89 48 0c          	mov    %cx,0xc(%eax)
+	for (i = 0; i < nseg; i++) {
+  800a54:	83 c2 01             	add    $0x1,%edx
+  800a57:	39 95 d0 fe ff ff    	cmp    %edx,-0x130(%ebp)
+  800a5d:	7f 91                	jg     8009f0 <virtio_submit+0x233>
+			| (q->dr_write ? 0 : VRING_DESC_F_WRITE);
+	}
+	d = vb->vb_desc[d].vd_next;
+  800a5f:	8b bd d0 fe ff ff    	mov    -0x130(%ebp),%edi
+  800a65:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+  800a6b:	8b 48 08             	mov    0x8(%eax),%ecx
+  800a6e:	89 f0                	mov    %esi,%eax
+  800a70:	c1 e0 04             	shl    $0x4,%eax
+  800a73:	89 ce                	mov    %ecx,%esi
+  800a75:	01 c8                	add    %ecx,%eax
+  800a77:	0f b7 58 0e          	movzwl 0xe(%eax),%ebx
+	vb->vb_desc[d].vd_addr = va2pa(&vslots[vb - vblk][head].vs_status);
+  800a7b:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+  800a81:	05 30 26 81 00       	add    $0x812630,%eax
+  800a86:	e8 f8 fc ff ff       	call   800783 <va2pa>
+  800a8b:	0f b7 db             	movzwl %bx,%ebx
+  800a8e:	c1 e3 04             	shl    $0x4,%ebx
+  800a91:	8d 34 1e             	lea    (%esi,%ebx,1),%esi
+  800a94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a99:	89 06                	mov    %eax,(%esi)
+  800a9b:	89 56 04             	mov    %edx,0x4(%esi)
+	vb->vb_desc[d].vd_len = 1;
+  800a9e:	8b b5 c8 fe ff ff    	mov    -0x138(%ebp),%esi
+  800aa4:	89 d8                	mov    %ebx,%eax
+  800aa6:	03 46 08             	add    0x8(%esi),%eax
+  800aa9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	vb->vb_desc[d].vd_flags = VRING_DESC_F_WRITE;
+  800ab0:	89 d8                	mov    %ebx,%eax
+  800ab2:	03 46 08             	add    0x8(%esi),%eax
+  800ab5:	66 c7 40 0c 02 00    	movw   $0x2,0xc(%eax)
+	vb->vb_free = vb->vb_desc[d].vd_next;
+  800abb:	03 5e 08             	add    0x8(%esi),%ebx
+  800abe:	0f b7 43 0e          	movzwl 0xe(%ebx),%eax
+  800ac2:	66 89 46 18          	mov    %ax,0x18(%esi)
+	vb->vb_nfree -= nseg + 2;
+  800ac6:	0f b7 46 1a          	movzwl 0x1a(%esi),%eax
+  800aca:	66 89 85 d4 fe ff ff 	mov    %ax,-0x12c(%ebp)
+  800ad1:	83 e8 02             	sub    $0x2,%eax
+  800ad4:	29 f8                	sub    %edi,%eax
+  800ad6:	66 89 46 1a          	mov    %ax,0x1a(%esi)
+
+	// The ring entry must be visible before the index moves past it.
+	vb->vb_avail[2 + vb->vb_avail[1] % vb->vb_num] = head;
+  800ada:	8b 4e 0c             	mov    0xc(%esi),%ecx
+  800add:	0f b7 41 02          	movzwl 0x2(%ecx),%eax
+  800ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae6:	66 f7 76 04          	divw   0x4(%esi)
+  800aea:	0f b7 d2             	movzwl %dx,%edx
+  800aed:	8d 44 51 04          	lea    0x4(%ecx,%edx,2),%eax
+  800af1:	0f b7 bd c2 fe ff ff 	movzwl -0x13e(%ebp),%edi
+  800af8:	66 89 38             	mov    %di,(%eax)
+	asm volatile("" ::: "memory");
+	vb->vb_avail[1]++;
+  800afb:	8b 56 0c             	mov    0xc(%esi),%edx
+  800afe:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  800b02:	83 c0 01             	add    $0x1,%eax
+  800b05:	66 89 42 02          	mov    %ax,0x2(%edx)
+	return head;
+}
+  800b09:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  800b0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b12:	5b                   	pop    %ebx
+  800b13:	5e                   	pop    %esi
+  800b14:	5f                   	pop    %edi
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+		return -1;
+  800b17:	c7 85 c4 fe ff ff ff 	movl   $0xffffffff,-0x13c(%ebp)
+  800b1e:	ff ff ff 
+  800b21:	eb e6                	jmp    800b09 <virtio_submit+0x34c>
+
+00800b23 <virtio_rw>:
+// Run the n transfers in reqs, all outstanding at once: each device
+// is told about its new requests together, and the requests finish in
+// whatever order the devices like.
+static int
+virtio_rw(struct DiskReq *reqs, int n)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	57                   	push   %edi
+  800b27:	56                   	push   %esi
+  800b28:	53                   	push   %ebx
+  800b29:	83 ec 6c             	sub    $0x6c,%esp
+	bool done[FS_MAXDISKS], progress;
+	int i, nsub, ndone, r, s;
+	uint32_t seen, kick;
+	struct VirtioBlk *vb;
+
+	assert(n <= FS_MAXDISKS);
+  800b2c:	83 7d 0c 04          	cmpl   $0x4,0xc(%ebp)
+  800b30:	7f 1a                	jg     800b4c <virtio_rw+0x29>
+	nsub = ndone = r = 0;
+  800b32:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+  800b39:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+  800b40:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  800b47:	e9 56 01 00 00       	jmp    800ca2 <virtio_rw+0x17f>
+	assert(n <= FS_MAXDISKS);
+  800b4c:	68 ad ad 80 00       	push   $0x80adad
+  800b51:	68 2b ad 80 00       	push   $0x80ad2b
+  800b56:	68 2e 01 00 00       	push   $0x12e
+  800b5b:	68 8a ad 80 00       	push   $0x80ad8a
+  800b60:	e8 b3 5b 00 00       	call   806718 <_panic>
+				break;
+			done[nsub] = 0;
+			kick |= 1 << reqs[nsub].dr_disk;
+			progress = 1;
+		}
+		for (i = 0; i < nvblk; i++)
+  800b65:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  800b68:	8b 1d 08 26 81 00    	mov    0x812608,%ebx
+  800b6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b78:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  800b7b:	eb 03                	jmp    800b80 <virtio_rw+0x5d>
+  800b7d:	83 c1 01             	add    $0x1,%ecx
+  800b80:	39 cb                	cmp    %ecx,%ebx
+  800b82:	7e 1d                	jle    800ba1 <virtio_rw+0x7e>
+			if (kick & (1 << i))
+  800b84:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b89:	d3 e2                	shl    %cl,%edx
+  800b8b:	85 f2                	test   %esi,%edx
+  800b8d:	74 ee                	je     800b7d <virtio_rw+0x5a>
+				outw(vblk[i].vb_base + VIRTIO_QUEUE_NOTIFY, 0);
+  800b8f:	8d 14 c9             	lea    (%ecx,%ecx,8),%edx
+  800b92:	0f b7 14 95 20 26 83 	movzwl 0x832620(,%edx,4),%edx
+  800b99:	00 
+  800b9a:	83 c2 10             	add    $0x10,%edx
+  800b9d:	66 ef                	out    %ax,(%dx)
+}
+  800b9f:	eb dc                	jmp    800b7d <virtio_rw+0x5a>
+  800ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba4:	89 45 b0             	mov    %eax,-0x50(%ebp)
+
+		for (i = 0; i < nsub; i++) {
+  800ba7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  800bae:	e9 2c 02 00 00       	jmp    800ddf <virtio_rw+0x2bc>
+		slots[vb->vb_used_ring[vb->vb_used_idx % vb->vb_num].vu_id].vs_done = 1;
+  800bb3:	89 c8                	mov    %ecx,%eax
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	66 f7 33             	divw   (%ebx)
+  800bbd:	0f b7 d2             	movzwl %dx,%edx
+  800bc0:	8b 47 14             	mov    0x14(%edi),%eax
+  800bc3:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+  800bc6:	8b 00                	mov    (%eax),%eax
+  800bc8:	c1 e0 05             	shl    $0x5,%eax
+  800bcb:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  800bce:	c6 44 02 11 01       	movb   $0x1,0x11(%edx,%eax,1)
+		vb->vb_used_idx++;
+  800bd3:	83 c1 01             	add    $0x1,%ecx
+  800bd6:	66 89 4f 1c          	mov    %cx,0x1c(%edi)
+	while (vb->vb_used_idx != vb->vb_used[1]) {
+  800bda:	0f b7 4f 1c          	movzwl 0x1c(%edi),%ecx
+  800bde:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  800be2:	66 39 c1             	cmp    %ax,%cx
+  800be5:	75 cc                	jne    800bb3 <virtio_rw+0x90>
+	if (!slots[head].vs_done)
+  800be7:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+  800bea:	89 c8                	mov    %ecx,%eax
+  800bec:	c1 e0 05             	shl    $0x5,%eax
+  800bef:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  800bf2:	01 c6                	add    %eax,%esi
+  800bf4:	0f b6 7e 11          	movzbl 0x11(%esi),%edi
+  800bf8:	89 fa                	mov    %edi,%edx
+  800bfa:	84 d2                	test   %dl,%dl
+  800bfc:	0f 84 5d 02 00 00    	je     800e5f <virtio_rw+0x33c>
+	for (d = head, n = 1; vb->vb_desc[d].vd_flags & VRING_DESC_F_NEXT; n++)
+  800c02:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  800c05:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800c08:	8b 1c 85 28 26 83 00 	mov    0x832628(,%eax,4),%ebx
+  800c0f:	89 c8                	mov    %ecx,%eax
+  800c11:	ba 01 00 00 00       	mov    $0x1,%edx
+  800c16:	eb 0a                	jmp    800c22 <virtio_rw+0xff>
+		d = vb->vb_desc[d].vd_next;
+  800c18:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+  800c1c:	0f b7 c0             	movzwl %ax,%eax
+	for (d = head, n = 1; vb->vb_desc[d].vd_flags & VRING_DESC_F_NEXT; n++)
+  800c1f:	83 c2 01             	add    $0x1,%edx
+  800c22:	c1 e0 04             	shl    $0x4,%eax
+  800c25:	01 d8                	add    %ebx,%eax
+  800c27:	0f b7 48 0c          	movzwl 0xc(%eax),%ecx
+  800c2b:	f6 c1 01             	test   $0x1,%cl
+  800c2e:	75 e8                	jne    800c18 <virtio_rw+0xf5>
+	vb->vb_desc[d].vd_next = vb->vb_free;
+  800c30:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  800c33:	8d 0c dd 00 00 00 00 	lea    0x0(,%ebx,8),%ecx
+  800c3a:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  800c3d:	01 cb                	add    %ecx,%ebx
+  800c3f:	8d 1c 9d 20 26 83 00 	lea    0x832620(,%ebx,4),%ebx
+  800c46:	0f b7 4b 18          	movzwl 0x18(%ebx),%ecx
+  800c4a:	66 89 48 0e          	mov    %cx,0xe(%eax)
+	vb->vb_free = head;
+  800c4e:	0f b7 4d a8          	movzwl -0x58(%ebp),%ecx
+  800c52:	66 89 4b 18          	mov    %cx,0x18(%ebx)
+	vb->vb_nfree += n;
+  800c56:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  800c59:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  800c5c:	01 c1                	add    %eax,%ecx
+  800c5e:	66 03 14 8d 3a 26 83 	add    0x83263a(,%ecx,4),%dx
+  800c65:	00 
+  800c66:	66 89 53 1a          	mov    %dx,0x1a(%ebx)
+	return slots[head].vs_status == 0 ? 1 : -1;
+  800c6a:	0f b6 46 10          	movzbl 0x10(%esi),%eax
+  800c6e:	84 c0                	test   %al,%al
+  800c70:	0f 84 2c 01 00 00    	je     800da2 <virtio_rw+0x27f>
+			if (done[i])
+				continue;
+			vb = &vblk[reqs[i].dr_disk];
+			mutex_lock(&vb->vb_mu);
+			s = virtio_collect(vb, head[i]);
+			mutex_unlock(&vb->vb_mu);
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+  800c79:	ff 75 a4             	push   -0x5c(%ebp)
+  800c7c:	e8 8c 8e 00 00       	call   809b0d <mutex_unlock>
+  800c81:	83 c4 10             	add    $0x10,%esp
+			if (s == 0)
+				continue;
+			if (s < 0)
+				r = -1;
+  800c84:	c7 45 94 ff ff ff ff 	movl   $0xffffffff,-0x6c(%ebp)
+  800c8b:	e9 20 01 00 00       	jmp    800db0 <virtio_rw+0x28d>
+			ndone++;
+			progress = 1;
+		}
+
+		// An interrupt after 'seen' was read makes this return at once.
+		if (ndone < n && !progress && !virtio_rearm())
+  800c90:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  800c93:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800c96:	7d 0a                	jge    800ca2 <virtio_rw+0x17f>
+  800c98:	80 7d bf 01          	cmpb   $0x1,-0x41(%ebp)
+  800c9c:	0f 85 94 00 00 00    	jne    800d36 <virtio_rw+0x213>
+	while (ndone < n) {
+  800ca2:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  800ca5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800ca8:	0f 8d de 01 00 00    	jge    800e8c <virtio_rw+0x369>
+		seen = virtio_nintr;
+  800cae:	a1 04 26 81 00       	mov    0x812604,%eax
+  800cb3:	89 45 98             	mov    %eax,-0x68(%ebp)
+		for (; nsub < n; nsub++) {
+  800cb6:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  800cb9:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+  800cbc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cbf:	8d 34 86             	lea    (%esi,%eax,4),%esi
+		kick = 0;
+  800cc2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+		progress = 0;
+  800cc9:	c6 45 bf 00          	movb   $0x0,-0x41(%ebp)
+		for (; nsub < n; nsub++) {
+  800ccd:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+  800cd0:	0f 8d 8f fe ff ff    	jge    800b65 <virtio_rw+0x42>
+			vb = &vblk[reqs[nsub].dr_disk];
+  800cd6:	8b 06                	mov    (%esi),%eax
+  800cd8:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  800cdb:	c1 e3 02             	shl    $0x2,%ebx
+			mutex_lock(&vb->vb_mu);
+  800cde:	8d 83 40 26 83 00    	lea    0x832640(%ebx),%eax
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800cea:	50                   	push   %eax
+  800ceb:	e8 b0 8d 00 00       	call   809aa0 <mutex_lock>
+			vb = &vblk[reqs[nsub].dr_disk];
+  800cf0:	8d 83 20 26 83 00    	lea    0x832620(%ebx),%eax
+			head[nsub] = virtio_submit(vb, &reqs[nsub]);
+  800cf6:	89 f2                	mov    %esi,%edx
+  800cf8:	e8 c0 fa ff ff       	call   8007bd <virtio_submit>
+  800cfd:	89 c3                	mov    %eax,%ebx
+  800cff:	89 44 bd d8          	mov    %eax,-0x28(%ebp,%edi,4)
+			mutex_unlock(&vb->vb_mu);
+  800d03:	83 c4 04             	add    $0x4,%esp
+  800d06:	ff 75 c4             	push   -0x3c(%ebp)
+  800d09:	e8 ff 8d 00 00       	call   809b0d <mutex_unlock>
+			if (head[nsub] < 0)
+  800d0e:	83 c4 10             	add    $0x10,%esp
+  800d11:	85 db                	test   %ebx,%ebx
+  800d13:	0f 88 4c fe ff ff    	js     800b65 <virtio_rw+0x42>
+			done[nsub] = 0;
+  800d19:	c6 44 3d d4 00       	movb   $0x0,-0x2c(%ebp,%edi,1)
+			kick |= 1 << reqs[nsub].dr_disk;
+  800d1e:	8b 0e                	mov    (%esi),%ecx
+  800d20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d25:	d3 e0                	shl    %cl,%eax
+  800d27:	09 45 c0             	or     %eax,-0x40(%ebp)
+		for (; nsub < n; nsub++) {
+  800d2a:	83 c7 01             	add    $0x1,%edi
+  800d2d:	83 c6 14             	add    $0x14,%esi
+			progress = 1;
+  800d30:	c6 45 bf 01          	movb   $0x1,-0x41(%ebp)
+  800d34:	eb 97                	jmp    800ccd <virtio_rw+0x1aa>
+	uint32_t n = virtio_nintr;
+  800d36:	a1 04 26 81 00       	mov    0x812604,%eax
+	if (n == virtio_armed)
+  800d3b:	3b 05 00 26 81 00    	cmp    0x812600,%eax
+  800d41:	0f 84 2b 01 00 00    	je     800e72 <virtio_rw+0x34f>
+	virtio_armed = n;
+  800d47:	a3 00 26 81 00       	mov    %eax,0x812600
+	for (d = 0; d < nvblk; d++)
+  800d4c:	8b 35 08 26 81 00    	mov    0x812608,%esi
+  800d52:	bb 20 26 83 00       	mov    $0x832620,%ebx
+  800d57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5c:	eb 0d                	jmp    800d6b <virtio_rw+0x248>
+		inb(vblk[d].vb_base + VIRTIO_ISR);
+  800d5e:	0f b7 13             	movzwl (%ebx),%edx
+  800d61:	83 c2 13             	add    $0x13,%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800d64:	ec                   	in     (%dx),%al
+	for (d = 0; d < nvblk; d++)
+  800d65:	83 c1 01             	add    $0x1,%ecx
+  800d68:	83 c3 24             	add    $0x24,%ebx
+  800d6b:	39 f1                	cmp    %esi,%ecx
+  800d6d:	7c ef                	jl     800d5e <virtio_rw+0x23b>
+	for (d = 0; d < nvblk; d++)
+  800d6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d74:	eb 1f                	jmp    800d95 <virtio_rw+0x272>
+		sys_irq_listen(vblk[d].vb_irq, &virtio_nintr);
+  800d76:	83 ec 08             	sub    $0x8,%esp
+  800d79:	68 04 26 81 00       	push   $0x812604
+  800d7e:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+  800d81:	0f b6 04 85 22 26 83 	movzbl 0x832622(,%eax,4),%eax
+  800d88:	00 
+  800d89:	50                   	push   %eax
+  800d8a:	e8 9e 68 00 00       	call   80762d <sys_irq_listen>
+	for (d = 0; d < nvblk; d++)
+  800d8f:	83 c3 01             	add    $0x1,%ebx
+  800d92:	83 c4 10             	add    $0x10,%esp
+  800d95:	3b 1d 08 26 81 00    	cmp    0x812608,%ebx
+  800d9b:	7c d9                	jl     800d76 <virtio_rw+0x253>
+  800d9d:	e9 00 ff ff ff       	jmp    800ca2 <virtio_rw+0x17f>
+			mutex_unlock(&vb->vb_mu);
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	ff 75 a4             	push   -0x5c(%ebp)
+  800da8:	e8 60 8d 00 00       	call   809b0d <mutex_unlock>
+  800dad:	83 c4 10             	add    $0x10,%esp
+			reqs[i].dr_buf += reqs[i].dr_nsecs * SECTSIZE;
+  800db0:	8b 75 9c             	mov    -0x64(%ebp),%esi
+  800db3:	8b 46 0c             	mov    0xc(%esi),%eax
+  800db6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800db9:	c1 e0 09             	shl    $0x9,%eax
+  800dbc:	01 46 08             	add    %eax,0x8(%esi)
+			reqs[i].dr_nsecs = 0;
+  800dbf:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+			done[i] = 1;
+  800dc6:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  800dc9:	c6 44 28 d4 01       	movb   $0x1,-0x2c(%eax,%ebp,1)
+			ndone++;
+  800dce:	83 45 a0 01          	addl   $0x1,-0x60(%ebp)
+			progress = 1;
+  800dd2:	89 f8                	mov    %edi,%eax
+  800dd4:	88 45 bf             	mov    %al,-0x41(%ebp)
+		for (i = 0; i < nsub; i++) {
+  800dd7:	83 45 c0 01          	addl   $0x1,-0x40(%ebp)
+  800ddb:	83 45 b0 14          	addl   $0x14,-0x50(%ebp)
+  800ddf:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  800de2:	39 75 c0             	cmp    %esi,-0x40(%ebp)
+  800de5:	0f 8d a5 fe ff ff    	jge    800c90 <virtio_rw+0x16d>
+			if (done[i])
+  800deb:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  800dee:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  800df1:	80 7c 2f d4 00       	cmpb   $0x0,-0x2c(%edi,%ebp,1)
+  800df6:	75 df                	jne    800dd7 <virtio_rw+0x2b4>
+			vb = &vblk[reqs[i].dr_disk];
+  800df8:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800dfb:	89 45 9c             	mov    %eax,-0x64(%ebp)
+  800dfe:	8b 00                	mov    (%eax),%eax
+  800e00:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+  800e07:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  800e0a:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  800e0d:	c1 e6 02             	shl    $0x2,%esi
+			mutex_lock(&vb->vb_mu);
+  800e10:	8d 96 40 26 83 00    	lea    0x832640(%esi),%edx
+  800e16:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	52                   	push   %edx
+  800e1d:	e8 7e 8c 00 00       	call   809aa0 <mutex_lock>
+			s = virtio_collect(vb, head[i]);
+  800e22:	8b 7c bd d8          	mov    -0x28(%ebp,%edi,4),%edi
+  800e26:	89 7d a8             	mov    %edi,-0x58(%ebp)
+	struct VirtioSlot *slots = vslots[vb - vblk];
+  800e29:	c1 fe 02             	sar    $0x2,%esi
+  800e2c:	69 f6 39 8e e3 38    	imul   $0x38e38e39,%esi,%esi
+  800e32:	c1 e6 0f             	shl    $0xf,%esi
+  800e35:	81 c6 20 26 81 00    	add    $0x812620,%esi
+  800e3b:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	while (vb->vb_used_idx != vb->vb_used[1]) {
+  800e3e:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  800e41:	01 c3                	add    %eax,%ebx
+  800e43:	8b 34 9d 30 26 83 00 	mov    0x832630(,%ebx,4),%esi
+  800e4a:	83 c4 10             	add    $0x10,%esp
+  800e4d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800e50:	8d 3c 85 20 26 83 00 	lea    0x832620(,%eax,4),%edi
+		slots[vb->vb_used_ring[vb->vb_used_idx % vb->vb_num].vu_id].vs_done = 1;
+  800e57:	8d 5f 04             	lea    0x4(%edi),%ebx
+	while (vb->vb_used_idx != vb->vb_used[1]) {
+  800e5a:	e9 7b fd ff ff       	jmp    800bda <virtio_rw+0xb7>
+			mutex_unlock(&vb->vb_mu);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	ff 75 a4             	push   -0x5c(%ebp)
+  800e65:	e8 a3 8c 00 00       	call   809b0d <mutex_unlock>
+  800e6a:	83 c4 10             	add    $0x10,%esp
+  800e6d:	e9 65 ff ff ff       	jmp    800dd7 <virtio_rw+0x2b4>
+			sys_futex_wait(&virtio_nintr, seen, VIRTIO_TIMEOUT);
+  800e72:	83 ec 04             	sub    $0x4,%esp
+  800e75:	6a 64                	push   $0x64
+  800e77:	ff 75 98             	push   -0x68(%ebp)
+  800e7a:	68 04 26 81 00       	push   $0x812604
+  800e7f:	e8 a6 66 00 00       	call   80752a <sys_futex_wait>
+  800e84:	83 c4 10             	add    $0x10,%esp
+  800e87:	e9 16 fe ff ff       	jmp    800ca2 <virtio_rw+0x17f>
+	}
+	return r;
+}
+  800e8c:	8b 45 94             	mov    -0x6c(%ebp),%eax
+  800e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+
+00800e97 <virtio_init>:
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 5c             	sub    $0x5c,%esp
+	for (i = 0; nvblk < FS_MAXDISKS && sys_pci_storage(i, &pd) == 0; i++) {
+  800ea0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea5:	e9 da 00 00 00       	jmp    800f84 <virtio_init+0xed>
+		vb->vb_desc[i].vd_next = i + 1;
+  800eaa:	89 d8                	mov    %ebx,%eax
+  800eac:	c1 e0 04             	shl    $0x4,%eax
+  800eaf:	03 42 08             	add    0x8(%edx),%eax
+  800eb2:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  800eb5:	66 89 48 0e          	mov    %cx,0xe(%eax)
+	for (i = 0; i < vb->vb_num; i++)
+  800eb9:	83 c3 01             	add    $0x1,%ebx
+  800ebc:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+  800ec0:	0f b7 c8             	movzwl %ax,%ecx
+  800ec3:	39 cb                	cmp    %ecx,%ebx
+  800ec5:	7c e3                	jl     800eaa <virtio_init+0x13>
+	vb->vb_free = 0;
+  800ec7:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  800eca:	8d 3c ff             	lea    (%edi,%edi,8),%edi
+  800ecd:	8d 1c bd 20 26 83 00 	lea    0x832620(,%edi,4),%ebx
+  800ed4:	66 c7 43 18 00 00    	movw   $0x0,0x18(%ebx)
+	vb->vb_nfree = vb->vb_num;
+  800eda:	66 89 43 1a          	mov    %ax,0x1a(%ebx)
+	vb->vb_used_idx = 0;
+  800ede:	66 c7 43 1c 00 00    	movw   $0x0,0x1c(%ebx)
+	outl(vb->vb_base + VIRTIO_QUEUE_PFN, va2pa(ring) >> PGSHIFT);
+  800ee4:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  800ee7:	e8 97 f8 ff ff       	call   800783 <va2pa>
+  800eec:	c1 e8 0c             	shr    $0xc,%eax
+  800eef:	0f b7 14 bd 20 26 83 	movzwl 0x832620(,%edi,4),%edx
+  800ef6:	00 
+  800ef7:	83 c2 08             	add    $0x8,%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  800efa:	ef                   	out    %eax,(%dx)
+	if ((r = sys_irq_listen(vb->vb_irq, &virtio_nintr)) < 0)
+  800efb:	83 ec 08             	sub    $0x8,%esp
+  800efe:	68 04 26 81 00       	push   $0x812604
+  800f03:	0f b6 43 02          	movzbl 0x2(%ebx),%eax
+  800f07:	50                   	push   %eax
+  800f08:	e8 20 67 00 00       	call   80762d <sys_irq_listen>
+  800f0d:	89 c1                	mov    %eax,%ecx
+  800f0f:	83 c4 10             	add    $0x10,%esp
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	78 45                	js     800f5b <virtio_init+0xc4>
+	outb(vb->vb_base + VIRTIO_STATUS,
+  800f16:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  800f19:	8d 04 ff             	lea    (%edi,%edi,8),%eax
+  800f1c:	8d 1c 85 20 26 83 00 	lea    0x832620(,%eax,4),%ebx
+  800f23:	0f b7 0c 85 20 26 83 	movzwl 0x832620(,%eax,4),%ecx
+  800f2a:	00 
+  800f2b:	8d 51 12             	lea    0x12(%ecx),%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800f2e:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f33:	ee                   	out    %al,(%dx)
+	cprintf("virtio-blk %d: %d sectors, %d descriptors, irq %d\n", d,
+  800f34:	8d 51 14             	lea    0x14(%ecx),%edx
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+  800f37:	ed                   	in     (%dx),%eax
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	0f b6 53 02          	movzbl 0x2(%ebx),%edx
+  800f3f:	52                   	push   %edx
+  800f40:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  800f44:	52                   	push   %edx
+  800f45:	50                   	push   %eax
+  800f46:	57                   	push   %edi
+  800f47:	68 dc ad 80 00       	push   $0x80addc
+  800f4c:	e8 a2 58 00 00       	call   8067f3 <cprintf>
+  800f51:	83 c4 20             	add    $0x20,%esp
+  800f54:	eb 24                	jmp    800f7a <virtio_init+0xe3>
+		r = -E_INVAL;
+  800f56:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+	outb(vb->vb_base + VIRTIO_STATUS, VIRTIO_STATUS_FAILED);
+  800f5b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800f5e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800f61:	0f b7 14 85 20 26 83 	movzwl 0x832620(,%eax,4),%edx
+  800f68:	00 
+  800f69:	83 c2 12             	add    $0x12,%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800f6c:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+  800f71:	ee                   	out    %al,(%dx)
+		if ((r = virtio_setup(&vblk[nvblk], nvblk, &pd)) < 0)
+  800f72:	85 c9                	test   %ecx,%ecx
+  800f74:	0f 88 41 01 00 00    	js     8010bb <virtio_init+0x224>
+			nvblk++;
+  800f7a:	83 05 08 26 81 00 01 	addl   $0x1,0x812608
+	for (i = 0; nvblk < FS_MAXDISKS && sys_pci_storage(i, &pd) == 0; i++) {
+  800f81:	83 c6 01             	add    $0x1,%esi
+  800f84:	83 3d 08 26 81 00 03 	cmpl   $0x3,0x812608
+  800f8b:	0f 8f 46 01 00 00    	jg     8010d7 <virtio_init+0x240>
+  800f91:	83 ec 08             	sub    $0x8,%esp
+  800f94:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  800f97:	50                   	push   %eax
+  800f98:	56                   	push   %esi
+  800f99:	e8 bd 66 00 00       	call   80765b <sys_pci_storage>
+  800f9e:	89 c3                	mov    %eax,%ebx
+  800fa0:	83 c4 10             	add    $0x10,%esp
+  800fa3:	85 c0                	test   %eax,%eax
+  800fa5:	0f 85 2c 01 00 00    	jne    8010d7 <virtio_init+0x240>
+		if (PCIDEV_VENDOR(&pd) != PCIDEV_VENDOR_VIRTIO
+  800fab:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  800fae:	66 3d f4 1a          	cmp    $0x1af4,%ax
+  800fb2:	75 cd                	jne    800f81 <virtio_init+0xea>
+		    || PCIDEV_PRODUCT(&pd) != PCIDEV_PRODUCT_VIRTIO_BLK)
+  800fb4:	c1 e8 10             	shr    $0x10,%eax
+  800fb7:	3d 01 10 00 00       	cmp    $0x1001,%eax
+  800fbc:	75 c3                	jne    800f81 <virtio_init+0xea>
+		if ((r = virtio_setup(&vblk[nvblk], nvblk, &pd)) < 0)
+  800fbe:	8b 0d 08 26 81 00    	mov    0x812608,%ecx
+  800fc4:	89 c8                	mov    %ecx,%eax
+	vb->vb_base = pd->pd_base[0];
+  800fc6:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  800fc9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  800fcc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800fcf:	8d 3c 85 20 26 83 00 	lea    0x832620(,%eax,4),%edi
+  800fd6:	66 89 0c 85 20 26 83 	mov    %cx,0x832620(,%eax,4)
+  800fdd:	00 
+	vb->vb_irq = pd->pd_irq;
+  800fde:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  800fe2:	88 47 02             	mov    %al,0x2(%edi)
+	outb(vb->vb_base + VIRTIO_STATUS, 0);
+  800fe5:	0f b7 c9             	movzwl %cx,%ecx
+  800fe8:	8d 51 12             	lea    0x12(%ecx),%edx
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff0:	ee                   	out    %al,(%dx)
+  800ff1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff6:	ee                   	out    %al,(%dx)
+  800ff7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ffc:	ee                   	out    %al,(%dx)
+	outl(vb->vb_base + VIRTIO_GUEST_FEATURES, 0);
+  800ffd:	8d 51 04             	lea    0x4(%ecx),%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+  801005:	ef                   	out    %eax,(%dx)
+	outw(vb->vb_base + VIRTIO_QUEUE_SEL, 0);
+  801006:	8d 51 0e             	lea    0xe(%ecx),%edx
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  801009:	66 ef                	out    %ax,(%dx)
+	vb->vb_num = inw(vb->vb_base + VIRTIO_QUEUE_NUM);
+  80100b:	8d 51 0c             	lea    0xc(%ecx),%edx
+	asm volatile("inw %w1,%0" : "=a" (data) : "d" (port));
+  80100e:	66 ed                	in     (%dx),%ax
+  801010:	66 89 47 04          	mov    %ax,0x4(%edi)
+	availsz = vb->vb_num * sizeof(struct VringDesc) + (3 + vb->vb_num) * sizeof(uint16_t);
+  801014:	0f b7 c8             	movzwl %ax,%ecx
+  801017:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+  80101e:	01 d1                	add    %edx,%ecx
+	size = ROUNDUP(availsz, PGSIZE)
+  801020:	8d 8c 09 05 10 00 00 	lea    0x1005(%ecx,%ecx,1),%ecx
+  801027:	89 cf                	mov    %ecx,%edi
+  801029:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		+ ROUNDUP(3 * sizeof(uint16_t) + vb->vb_num * sizeof(struct VringUsedElem), PGSIZE);
+  80102f:	81 c2 05 10 00 00    	add    $0x1005,%edx
+	size = ROUNDUP(availsz, PGSIZE)
+  801035:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80103b:	01 fa                	add    %edi,%edx
+	if (vb->vb_num == 0 || vb->vb_num > VQ_MAXNUM || size > VRINGSLOT) {
+  80103d:	83 e8 01             	sub    $0x1,%eax
+  801040:	66 3d ff 03          	cmp    $0x3ff,%ax
+  801044:	0f 87 0c ff ff ff    	ja     800f56 <virtio_init+0xbf>
+  80104a:	81 fa 00 80 00 00    	cmp    $0x8000,%edx
+  801050:	0f 87 00 ff ff ff    	ja     800f56 <virtio_init+0xbf>
+	uint8_t *ring = (uint8_t *) (VRINGMAP + d * VRINGSLOT);
+  801056:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  801059:	c1 e0 0f             	shl    $0xf,%eax
+  80105c:	8d 88 00 40 88 e0    	lea    -0x1f77c000(%eax),%ecx
+	if ((r = sys_dma_map(ring, size / PGSIZE)) < 0)
+  801062:	83 ec 08             	sub    $0x8,%esp
+  801065:	c1 ea 0c             	shr    $0xc,%edx
+  801068:	52                   	push   %edx
+  801069:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+  80106c:	51                   	push   %ecx
+  80106d:	e8 17 66 00 00       	call   807689 <sys_dma_map>
+  801072:	89 c1                	mov    %eax,%ecx
+  801074:	83 c4 10             	add    $0x10,%esp
+  801077:	85 c0                	test   %eax,%eax
+  801079:	0f 88 dc fe ff ff    	js     800f5b <virtio_init+0xc4>
+	vb->vb_desc = (volatile struct VringDesc *) ring;
+  80107f:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  801082:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  801085:	8d 04 85 20 26 83 00 	lea    0x832620(,%eax,4),%eax
+  80108c:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80108f:	89 48 08             	mov    %ecx,0x8(%eax)
+	vb->vb_avail = (volatile uint16_t *) (ring + vb->vb_num * sizeof(struct VringDesc));
+  801092:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  801096:	c1 e2 04             	shl    $0x4,%edx
+  801099:	01 ca                	add    %ecx,%edx
+  80109b:	89 50 0c             	mov    %edx,0xc(%eax)
+	vb->vb_used = (volatile uint16_t *) (ring + ROUNDUP(availsz, PGSIZE));
+  80109e:	01 cf                	add    %ecx,%edi
+  8010a0:	89 78 10             	mov    %edi,0x10(%eax)
+	vb->vb_used_ring = (volatile struct VringUsedElem *) (vb->vb_used + 2);
+  8010a3:	83 c7 04             	add    $0x4,%edi
+  8010a6:	89 78 14             	mov    %edi,0x14(%eax)
+	for (i = 0; i < vb->vb_num; i++)
+  8010a9:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  8010ac:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8010af:	8d 14 85 20 26 83 00 	lea    0x832620(,%eax,4),%edx
+  8010b6:	e9 01 fe ff ff       	jmp    800ebc <virtio_init+0x25>
+			cprintf("virtio-blk %d: %e\n", nvblk, r);
+  8010bb:	83 ec 04             	sub    $0x4,%esp
+  8010be:	51                   	push   %ecx
+  8010bf:	ff 35 08 26 81 00    	push   0x812608
+  8010c5:	68 be ad 80 00       	push   $0x80adbe
+  8010ca:	e8 24 57 00 00       	call   8067f3 <cprintf>
+  8010cf:	83 c4 10             	add    $0x10,%esp
+  8010d2:	e9 aa fe ff ff       	jmp    800f81 <virtio_init+0xea>
+}
+  8010d7:	a1 08 26 81 00       	mov    0x812608,%eax
+  8010dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <bdev_rw>:
+
+// Transfer blocks [blockno, blockno+nblocks) in rounds, each taking
+// the next stripe unit from every disk and running them side by side.
+static int
+bdev_rw(uint32_t blockno, void *buf, uint32_t nblocks, bool write)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 7c             	sub    $0x7c,%esp
+  8010ed:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  8010f0:	89 55 88             	mov    %edx,-0x78(%ebp)
+  8010f3:	89 cf                	mov    %ecx,%edi
+  8010f5:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8010f9:	88 45 83             	mov    %al,-0x7d(%ebp)
+	struct DiskReq reqs[FS_MAXDISKS];
+	uint32_t unit, off, n;
+	int nreq, r;
+
+	while (nblocks > 0) {
+  8010fc:	eb 1d                	jmp    80111b <bdev_rw+0x37>
+			reqs[nreq].dr_write = write;
+			blockno += n;
+			buf += n * BLKSIZE;
+			nblocks -= n;
+		}
+		if ((r = bdev_drv->dd_rw(reqs, nreq)) < 0)
+  8010fe:	83 ec 08             	sub    $0x8,%esp
+  801101:	ff 75 94             	push   -0x6c(%ebp)
+  801104:	8d 45 98             	lea    -0x68(%ebp),%eax
+  801107:	50                   	push   %eax
+  801108:	a1 c0 26 83 00       	mov    0x8326c0,%eax
+  80110d:	ff 50 08             	call   *0x8(%eax)
+  801110:	83 c4 10             	add    $0x10,%esp
+  801113:	85 c0                	test   %eax,%eax
+  801115:	0f 88 93 00 00 00    	js     8011ae <bdev_rw+0xca>
+	while (nblocks > 0) {
+  80111b:	85 ff                	test   %edi,%edi
+  80111d:	0f 84 86 00 00 00    	je     8011a9 <bdev_rw+0xc5>
+		for (nreq = 0; nreq < bdev_ndisks && nblocks > 0; nreq++) {
+  801123:	a1 34 d0 80 00       	mov    0x80d034,%eax
+  801128:	89 45 90             	mov    %eax,-0x70(%ebp)
+			unit = blockno / bdev_unit;
+  80112b:	8b 35 30 d0 80 00    	mov    0x80d030,%esi
+  801131:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+		for (nreq = 0; nreq < bdev_ndisks && nblocks > 0; nreq++) {
+  801134:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+  80113b:	85 ff                	test   %edi,%edi
+  80113d:	74 bf                	je     8010fe <bdev_rw+0x1a>
+  80113f:	8b 4d 90             	mov    -0x70(%ebp),%ecx
+  801142:	39 4d 94             	cmp    %ecx,-0x6c(%ebp)
+  801145:	73 b7                	jae    8010fe <bdev_rw+0x1a>
+			unit = blockno / bdev_unit;
+  801147:	8b 45 8c             	mov    -0x74(%ebp),%eax
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	f7 f6                	div    %esi
+			n = MIN(bdev_unit - off, nblocks);
+  801151:	89 f1                	mov    %esi,%ecx
+  801153:	89 55 84             	mov    %edx,-0x7c(%ebp)
+  801156:	29 d1                	sub    %edx,%ecx
+  801158:	39 f9                	cmp    %edi,%ecx
+  80115a:	0f 47 cf             	cmova  %edi,%ecx
+			reqs[nreq].dr_disk = bdev_disks[unit % bdev_ndisks];
+  80115d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801162:	f7 75 90             	divl   -0x70(%ebp)
+  801165:	8b 14 95 b0 26 83 00 	mov    0x8326b0(,%edx,4),%edx
+  80116c:	89 13                	mov    %edx,(%ebx)
+			reqs[nreq].dr_secno = ((unit / bdev_ndisks) * bdev_unit + off) * BLKSECTS;
+  80116e:	0f af c6             	imul   %esi,%eax
+  801171:	8b 55 84             	mov    -0x7c(%ebp),%edx
+  801174:	01 d0                	add    %edx,%eax
+  801176:	c1 e0 03             	shl    $0x3,%eax
+  801179:	89 43 04             	mov    %eax,0x4(%ebx)
+			reqs[nreq].dr_buf = buf;
+  80117c:	8b 55 88             	mov    -0x78(%ebp),%edx
+  80117f:	89 53 08             	mov    %edx,0x8(%ebx)
+			reqs[nreq].dr_nsecs = n * BLKSECTS;
+  801182:	8d 04 cd 00 00 00 00 	lea    0x0(,%ecx,8),%eax
+  801189:	89 43 0c             	mov    %eax,0xc(%ebx)
+			reqs[nreq].dr_write = write;
+  80118c:	0f b6 55 83          	movzbl -0x7d(%ebp),%edx
+  801190:	88 53 10             	mov    %dl,0x10(%ebx)
+			blockno += n;
+  801193:	01 4d 8c             	add    %ecx,-0x74(%ebp)
+			buf += n * BLKSIZE;
+  801196:	89 c8                	mov    %ecx,%eax
+  801198:	c1 e0 0c             	shl    $0xc,%eax
+  80119b:	01 45 88             	add    %eax,-0x78(%ebp)
+			nblocks -= n;
+  80119e:	29 cf                	sub    %ecx,%edi
+		for (nreq = 0; nreq < bdev_ndisks && nblocks > 0; nreq++) {
+  8011a0:	83 45 94 01          	addl   $0x1,-0x6c(%ebp)
+  8011a4:	83 c3 14             	add    $0x14,%ebx
+  8011a7:	eb 92                	jmp    80113b <bdev_rw+0x57>
+			return r;
+	}
+	return 0;
+  8011a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5f                   	pop    %edi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+
+008011b6 <bdev_init>:
+{
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	bdev_drv = drv;
+  8011c2:	a3 c0 26 83 00       	mov    %eax,0x8326c0
+	bdev_disks[0] = disk;
+  8011c7:	89 15 b0 26 83 00    	mov    %edx,0x8326b0
+	cprintf("FS is on %s disk %d\n", drv->dd_name, disk);
+  8011cd:	52                   	push   %edx
+  8011ce:	ff 30                	push   (%eax)
+  8011d0:	68 0f ae 80 00       	push   $0x80ae0f
+  8011d5:	e8 19 56 00 00       	call   8067f3 <cprintf>
+}
+  8011da:	83 c4 10             	add    $0x10,%esp
+  8011dd:	c9                   	leave
+  8011de:	c3                   	ret
+
+008011df <bdev_stripe>:
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (s->s_ndisks <= 1)
+  8011e7:	8b 86 08 01 00 00    	mov    0x108(%esi),%eax
+  8011ed:	83 f8 01             	cmp    $0x1,%eax
+  8011f0:	0f 86 87 00 00 00    	jbe    80127d <bdev_stripe+0x9e>
+	if (s->s_ndisks > FS_MAXDISKS || s->s_stripe < 2)
+  8011f6:	83 f8 04             	cmp    $0x4,%eax
+  8011f9:	77 10                	ja     80120b <bdev_stripe+0x2c>
+  8011fb:	83 be 0c 01 00 00 01 	cmpl   $0x1,0x10c(%esi)
+  801202:	76 07                	jbe    80120b <bdev_stripe+0x2c>
+	for (i = 1; i < s->s_ndisks; i++) {
+  801204:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801209:	eb 1e                	jmp    801229 <bdev_stripe+0x4a>
+		panic("bad stripe: %d disks, %d blocks per unit",
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	ff b6 0c 01 00 00    	push   0x10c(%esi)
+  801214:	50                   	push   %eax
+  801215:	68 60 ae 80 00       	push   $0x80ae60
+  80121a:	6a 26                	push   $0x26
+  80121c:	68 24 ae 80 00       	push   $0x80ae24
+  801221:	e8 f2 54 00 00       	call   806718 <_panic>
+	for (i = 1; i < s->s_ndisks; i++) {
+  801226:	83 c3 01             	add    $0x1,%ebx
+  801229:	8b 86 08 01 00 00    	mov    0x108(%esi),%eax
+  80122f:	39 c3                	cmp    %eax,%ebx
+  801231:	73 3a                	jae    80126d <bdev_stripe+0x8e>
+		bdev_disks[i] = bdev_disks[0] + i;
+  801233:	89 d8                	mov    %ebx,%eax
+  801235:	03 05 b0 26 83 00    	add    0x8326b0,%eax
+  80123b:	89 04 9d b0 26 83 00 	mov    %eax,0x8326b0(,%ebx,4)
+		if (!bdev_drv->dd_probe(bdev_disks[i]))
+  801242:	83 ec 0c             	sub    $0xc,%esp
+  801245:	50                   	push   %eax
+  801246:	a1 c0 26 83 00       	mov    0x8326c0,%eax
+  80124b:	ff 50 04             	call   *0x4(%eax)
+  80124e:	83 c4 10             	add    $0x10,%esp
+  801251:	84 c0                	test   %al,%al
+  801253:	75 d1                	jne    801226 <bdev_stripe+0x47>
+			panic("striped disk %d is missing", bdev_disks[i]);
+  801255:	ff 34 9d b0 26 83 00 	push   0x8326b0(,%ebx,4)
+  80125c:	68 2e ae 80 00       	push   $0x80ae2e
+  801261:	6a 2b                	push   $0x2b
+  801263:	68 24 ae 80 00       	push   $0x80ae24
+  801268:	e8 ab 54 00 00       	call   806718 <_panic>
+	bdev_ndisks = s->s_ndisks;
+  80126d:	a3 34 d0 80 00       	mov    %eax,0x80d034
+	bdev_unit = s->s_stripe;
+  801272:	8b 86 0c 01 00 00    	mov    0x10c(%esi),%eax
+  801278:	a3 30 d0 80 00       	mov    %eax,0x80d030
+}
+  80127d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801280:	5b                   	pop    %ebx
+  801281:	5e                   	pop    %esi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <bdev_read>:
+
+int
+bdev_read(uint32_t blockno, void *dst, uint32_t nblocks)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	83 ec 08             	sub    $0x8,%esp
+  80128a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	assert(nblocks <= BC_MAXIO);
+  80128d:	83 f9 20             	cmp    $0x20,%ecx
+  801290:	77 12                	ja     8012a4 <bdev_read+0x20>
+	return bdev_rw(blockno, dst, nblocks, 0);
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	6a 00                	push   $0x0
+  801297:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80129d:	e8 42 fe ff ff       	call   8010e4 <bdev_rw>
+}
+  8012a2:	c9                   	leave
+  8012a3:	c3                   	ret
+	assert(nblocks <= BC_MAXIO);
+  8012a4:	68 49 ae 80 00       	push   $0x80ae49
+  8012a9:	68 2b ad 80 00       	push   $0x80ad2b
+  8012ae:	6a 51                	push   $0x51
+  8012b0:	68 24 ae 80 00       	push   $0x80ae24
+  8012b5:	e8 5e 54 00 00       	call   806718 <_panic>
+
+008012ba <bdev_write>:
+
+int
+bdev_write(uint32_t blockno, const void *src, uint32_t nblocks)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	83 ec 08             	sub    $0x8,%esp
+  8012c0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	assert(nblocks <= BC_MAXIO);
+  8012c3:	83 f9 20             	cmp    $0x20,%ecx
+  8012c6:	77 12                	ja     8012da <bdev_write+0x20>
+	return bdev_rw(blockno, (void*) src, nblocks, 1);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	6a 01                	push   $0x1
+  8012cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012d3:	e8 0c fe ff ff       	call   8010e4 <bdev_rw>
+}
+  8012d8:	c9                   	leave
+  8012d9:	c3                   	ret
+	assert(nblocks <= BC_MAXIO);
+  8012da:	68 49 ae 80 00       	push   $0x80ae49
+  8012df:	68 2b ad 80 00       	push   $0x80ad2b
+  8012e4:	6a 58                	push   $0x58
+  8012e6:	68 24 ae 80 00       	push   $0x80ae24
+  8012eb:	e8 28 54 00 00       	call   806718 <_panic>
+
+008012f0 <ioq_take>:
+
+// Remove and return ioq[i].
+static struct IoReq*
+ioq_take(uint32_t i)
+{
+	struct IoReq *q = ioq[i];
+  8012f0:	8b 0c 85 40 27 83 00 	mov    0x832740(,%eax,4),%ecx
+
+	ioq[i] = ioq[--ioq_n];
+  8012f7:	8b 15 28 27 83 00    	mov    0x832728,%edx
+  8012fd:	83 ea 01             	sub    $0x1,%edx
+  801300:	89 15 28 27 83 00    	mov    %edx,0x832728
+  801306:	8b 14 95 40 27 83 00 	mov    0x832740(,%edx,4),%edx
+  80130d:	89 14 85 40 27 83 00 	mov    %edx,0x832740(,%eax,4)
+	return q;
+}
+  801314:	89 c8                	mov    %ecx,%eax
+  801316:	c3                   	ret
+
+00801317 <ioq_find_merge>:
+// blocks at 'blockno' from or to 'buf', just before it (front) or just
+// after it.  Returns its index, or ~0.
+static uint32_t
+ioq_find_merge(uint32_t blockno, char *buf, uint32_t nblocks,
+	       bool write, bool front)
+{
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	57                   	push   %edi
+  80131b:	56                   	push   %esi
+  80131c:	53                   	push   %ebx
+  80131d:	83 ec 1c             	sub    $0x1c,%esp
+  801320:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801323:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  801326:	89 cf                	mov    %ecx,%edi
+  801328:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+  80132b:	0f b6 75 08          	movzbl 0x8(%ebp),%esi
+  80132f:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  801333:	88 5d eb             	mov    %bl,-0x15(%ebp)
+	struct IoReq *q;
+	uint32_t i;
+
+	for (i = 0; i < ioq_n; i++) {
+  801336:	8b 1d 28 27 83 00    	mov    0x832728,%ebx
+		if (q->io_write != write || nblocks + q->io_nblocks > BC_MAXIO)
+			continue;
+		if (front ? q->io_blockno + q->io_nblocks == blockno
+			    && (char *) q->io_buf + q->io_nblocks * BLKSIZE == buf
+			  : q->io_blockno == blockno + nblocks
+			    && q->io_buf == buf + nblocks * BLKSIZE)
+  80133c:	89 c8                	mov    %ecx,%eax
+  80133e:	c1 e0 0c             	shl    $0xc,%eax
+  801341:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  801344:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+	for (i = 0; i < ioq_n; i++) {
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+			  : q->io_blockno == blockno + nblocks
+  80134c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80134f:	01 d7                	add    %edx,%edi
+  801351:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  801354:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+	for (i = 0; i < ioq_n; i++) {
+  801357:	eb 0a                	jmp    801363 <ioq_find_merge+0x4c>
+			    && q->io_buf == buf + nblocks * BLKSIZE)
+  801359:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80135c:	39 1a                	cmp    %ebx,(%edx)
+  80135e:	74 41                	je     8013a1 <ioq_find_merge+0x8a>
+	for (i = 0; i < ioq_n; i++) {
+  801360:	83 c0 01             	add    $0x1,%eax
+  801363:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  801366:	74 43                	je     8013ab <ioq_find_merge+0x94>
+		q = ioq[i];
+  801368:	8b 14 85 40 27 83 00 	mov    0x832740(,%eax,4),%edx
+		if (q->io_write != write || nblocks + q->io_nblocks > BC_MAXIO)
+  80136f:	89 f1                	mov    %esi,%ecx
+  801371:	38 4a 0c             	cmp    %cl,0xc(%edx)
+  801374:	75 ea                	jne    801360 <ioq_find_merge+0x49>
+  801376:	8b 4a 04             	mov    0x4(%edx),%ecx
+  801379:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  80137c:	01 cf                	add    %ecx,%edi
+  80137e:	83 ff 20             	cmp    $0x20,%edi
+  801381:	77 dd                	ja     801360 <ioq_find_merge+0x49>
+		if (front ? q->io_blockno + q->io_nblocks == blockno
+  801383:	80 7d eb 00          	cmpb   $0x0,-0x15(%ebp)
+  801387:	74 d0                	je     801359 <ioq_find_merge+0x42>
+  801389:	89 cf                	mov    %ecx,%edi
+  80138b:	03 3a                	add    (%edx),%edi
+			    && (char *) q->io_buf + q->io_nblocks * BLKSIZE == buf
+  80138d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801390:	39 df                	cmp    %ebx,%edi
+  801392:	75 cc                	jne    801360 <ioq_find_merge+0x49>
+  801394:	c1 e1 0c             	shl    $0xc,%ecx
+  801397:	03 4a 08             	add    0x8(%edx),%ecx
+  80139a:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  80139d:	75 c1                	jne    801360 <ioq_find_merge+0x49>
+  80139f:	eb 0f                	jmp    8013b0 <ioq_find_merge+0x99>
+			    && q->io_buf == buf + nblocks * BLKSIZE)
+  8013a1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8013a4:	39 5a 08             	cmp    %ebx,0x8(%edx)
+  8013a7:	75 b7                	jne    801360 <ioq_find_merge+0x49>
+  8013a9:	eb 05                	jmp    8013b0 <ioq_find_merge+0x99>
+			return i;
+	}
+	return ~0;
+  8013ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8013b0:	83 c4 1c             	add    $0x1c,%esp
+  8013b3:	5b                   	pop    %ebx
+  8013b4:	5e                   	pop    %esi
+  8013b5:	5f                   	pop    %edi
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	c3                   	ret
+
+008013b8 <ioq_step>:
+
+// Make progress, with ioq_mu held: dispatch the next transfer if the
+// disks are idle, else wait for the running one to finish.
+static void
+ioq_step(void)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+  8013be:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+	if (ioq_busy || ioq_n == 0)
+  8013c4:	0f b6 1d 24 27 83 00 	movzbl 0x832724,%ebx
+  8013cb:	84 db                	test   %bl,%bl
+  8013cd:	75 09                	jne    8013d8 <ioq_step+0x20>
+  8013cf:	83 3d 28 27 83 00 00 	cmpl   $0x0,0x832728
+  8013d6:	75 1d                	jne    8013f5 <ioq_step+0x3d>
+		cond_wait(&ioq_cond, &ioq_mu);
+  8013d8:	83 ec 08             	sub    $0x8,%esp
+  8013db:	68 44 28 83 00       	push   $0x832844
+  8013e0:	68 40 28 83 00       	push   $0x832840
+  8013e5:	e8 b6 87 00 00       	call   809ba0 <cond_wait>
+  8013ea:	83 c4 10             	add    $0x10,%esp
+	else
+		ioq_dispatch();
+}
+  8013ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f0:	5b                   	pop    %ebx
+  8013f1:	5e                   	pop    %esi
+  8013f2:	5f                   	pop    %edi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+	now = sys_time_msec();
+  8013f5:	e8 a8 60 00 00       	call   8074a2 <sys_time_msec>
+  8013fa:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+	for (i = 0; i < ioq_n; i++) {
+  801400:	a1 28 27 83 00       	mov    0x832728,%eax
+  801405:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+	reads = writes = 0;
+  80140b:	89 df                	mov    %ebx,%edi
+	best = ~0;
+  80140d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+	for (i = 0; i < ioq_n; i++) {
+  801412:	b8 00 00 00 00       	mov    $0x0,%eax
+  801417:	88 9d 5b ff ff ff    	mov    %bl,-0xa5(%ebp)
+  80141d:	88 9d 64 ff ff ff    	mov    %bl,-0x9c(%ebp)
+  801423:	89 cb                	mov    %ecx,%ebx
+  801425:	eb 23                	jmp    80144a <ioq_step+0x92>
+			best = i;
+  801427:	89 c3                	mov    %eax,%ebx
+		if (ioq[i]->io_write)
+  801429:	0f b6 52 0c          	movzbl 0xc(%edx),%edx
+			writes = 1;
+  80142d:	84 d2                	test   %dl,%dl
+  80142f:	0f 45 fa             	cmovne %edx,%edi
+  801432:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801437:	0f b6 95 64 ff ff ff 	movzbl -0x9c(%ebp),%edx
+  80143e:	0f 44 d1             	cmove  %ecx,%edx
+  801441:	88 95 64 ff ff ff    	mov    %dl,-0x9c(%ebp)
+	for (i = 0; i < ioq_n; i++) {
+  801447:	83 c0 01             	add    $0x1,%eax
+  80144a:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+  801450:	39 c8                	cmp    %ecx,%eax
+  801452:	74 26                	je     80147a <ioq_step+0xc2>
+		if ((int32_t) (now - ioq[i]->io_deadline) >= 0
+  801454:	8b 14 85 40 27 83 00 	mov    0x832740(,%eax,4),%edx
+  80145b:	8b 4a 10             	mov    0x10(%edx),%ecx
+  80145e:	39 8d 5c ff ff ff    	cmp    %ecx,-0xa4(%ebp)
+  801464:	78 c3                	js     801429 <ioq_step+0x71>
+		    && (best == ~0
+  801466:	83 fb ff             	cmp    $0xffffffff,%ebx
+  801469:	74 bc                	je     801427 <ioq_step+0x6f>
+			best = i;
+  80146b:	8b 34 9d 40 27 83 00 	mov    0x832740(,%ebx,4),%esi
+  801472:	3b 4e 10             	cmp    0x10(%esi),%ecx
+  801475:	0f 48 d8             	cmovs  %eax,%ebx
+  801478:	eb af                	jmp    801429 <ioq_step+0x71>
+	if (best != ~0) {
+  80147a:	0f b6 b5 64 ff ff ff 	movzbl -0x9c(%ebp),%esi
+  801481:	89 d9                	mov    %ebx,%ecx
+  801483:	0f b6 9d 5b ff ff ff 	movzbl -0xa5(%ebp),%ebx
+  80148a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80148d:	74 56                	je     8014e5 <ioq_step+0x12d>
+		ioq_stat.bs_ioexpired++;
+  80148f:	83 05 10 27 83 00 01 	addl   $0x1,0x832710
+		if (ioq[best]->io_write)
+  801496:	8b 04 8d 40 27 83 00 	mov    0x832740(,%ecx,4),%eax
+  80149d:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+  8014a1:	74 0a                	je     8014ad <ioq_step+0xf5>
+			ioq_write_skips = 0;
+  8014a3:	c7 05 1c 27 83 00 00 	movl   $0x0,0x83271c
+  8014aa:	00 00 00 
+	q = ioq_take(ioq_pick());
+  8014ad:	89 c8                	mov    %ecx,%eax
+  8014af:	e8 3c fe ff ff       	call   8012f0 <ioq_take>
+	batch[0] = q;
+  8014b4:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	blockno = q->io_blockno;
+  8014ba:	8b 38                	mov    (%eax),%edi
+	nblocks = q->io_nblocks;
+  8014bc:	8b 58 04             	mov    0x4(%eax),%ebx
+	buf = q->io_buf;
+  8014bf:	8b 70 08             	mov    0x8(%eax),%esi
+  8014c2:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+	write = q->io_write;
+  8014c8:	0f b6 40 0c          	movzbl 0xc(%eax),%eax
+  8014cc:	88 85 5c ff ff ff    	mov    %al,-0xa4(%ebp)
+	nb = 1;
+  8014d2:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((i = ioq_find_merge(blockno, buf, nblocks, write, 0)) != ~0) {
+  8014d7:	0f b6 c0             	movzbl %al,%eax
+  8014da:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  8014e0:	e9 98 00 00 00       	jmp    80157d <ioq_step+0x1c5>
+	write = writes && (!reads || ioq_write_skips >= IOQ_WRITE_STARVE);
+  8014e5:	89 f8                	mov    %edi,%eax
+  8014e7:	84 c0                	test   %al,%al
+  8014e9:	74 1a                	je     801505 <ioq_step+0x14d>
+  8014eb:	89 f0                	mov    %esi,%eax
+  8014ed:	84 c0                	test   %al,%al
+  8014ef:	74 0a                	je     8014fb <ioq_step+0x143>
+  8014f1:	a1 1c 27 83 00       	mov    0x83271c,%eax
+  8014f6:	83 f8 01             	cmp    $0x1,%eax
+  8014f9:	76 1f                	jbe    80151a <ioq_step+0x162>
+		ioq_write_skips = 0;
+  8014fb:	c7 05 1c 27 83 00 00 	movl   $0x0,0x83271c
+  801502:	00 00 00 
+			|| ioq[i]->io_blockno - ioq_head < ioq[best]->io_blockno - ioq_head))
+  801505:	8b 35 20 27 83 00    	mov    0x832720,%esi
+	for (i = 0; i < ioq_n; i++)
+  80150b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801510:	8b 95 60 ff ff ff    	mov    -0xa0(%ebp),%edx
+  801516:	89 fb                	mov    %edi,%ebx
+  801518:	eb 2d                	jmp    801547 <ioq_step+0x18f>
+		ioq_write_skips++;
+  80151a:	83 c0 01             	add    $0x1,%eax
+  80151d:	a3 1c 27 83 00       	mov    %eax,0x83271c
+	write = writes && (!reads || ioq_write_skips >= IOQ_WRITE_STARVE);
+  801522:	89 df                	mov    %ebx,%edi
+  801524:	eb df                	jmp    801505 <ioq_step+0x14d>
+			|| ioq[i]->io_blockno - ioq_head < ioq[best]->io_blockno - ioq_head))
+  801526:	8b 3f                	mov    (%edi),%edi
+  801528:	29 f7                	sub    %esi,%edi
+  80152a:	89 bd 64 ff ff ff    	mov    %edi,-0x9c(%ebp)
+  801530:	8b 3c 8d 40 27 83 00 	mov    0x832740(,%ecx,4),%edi
+  801537:	8b 3f                	mov    (%edi),%edi
+  801539:	29 f7                	sub    %esi,%edi
+			best = i;
+  80153b:	39 bd 64 ff ff ff    	cmp    %edi,-0x9c(%ebp)
+  801541:	0f 42 c8             	cmovb  %eax,%ecx
+	for (i = 0; i < ioq_n; i++)
+  801544:	83 c0 01             	add    $0x1,%eax
+  801547:	39 c2                	cmp    %eax,%edx
+  801549:	0f 84 5e ff ff ff    	je     8014ad <ioq_step+0xf5>
+		if (ioq[i]->io_write == write
+  80154f:	8b 3c 85 40 27 83 00 	mov    0x832740(,%eax,4),%edi
+  801556:	38 5f 0c             	cmp    %bl,0xc(%edi)
+  801559:	75 e9                	jne    801544 <ioq_step+0x18c>
+		    && (best == ~0
+  80155b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80155e:	75 c6                	jne    801526 <ioq_step+0x16e>
+			best = i;
+  801560:	89 c1                	mov    %eax,%ecx
+  801562:	eb e0                	jmp    801544 <ioq_step+0x18c>
+		batch[nb++] = q = ioq_take(i);
+  801564:	e8 87 fd ff ff       	call   8012f0 <ioq_take>
+  801569:	83 c6 01             	add    $0x1,%esi
+  80156c:	89 84 b5 64 ff ff ff 	mov    %eax,-0x9c(%ebp,%esi,4)
+		nblocks += q->io_nblocks;
+  801573:	03 58 04             	add    0x4(%eax),%ebx
+		ioq_stat.bs_iomerged++;
+  801576:	83 05 08 27 83 00 01 	addl   $0x1,0x832708
+	while ((i = ioq_find_merge(blockno, buf, nblocks, write, 0)) != ~0) {
+  80157d:	83 ec 08             	sub    $0x8,%esp
+  801580:	6a 00                	push   $0x0
+  801582:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  801588:	89 d9                	mov    %ebx,%ecx
+  80158a:	8b 95 64 ff ff ff    	mov    -0x9c(%ebp),%edx
+  801590:	89 f8                	mov    %edi,%eax
+  801592:	e8 80 fd ff ff       	call   801317 <ioq_find_merge>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80159d:	75 c5                	jne    801564 <ioq_step+0x1ac>
+  80159f:	eb 24                	jmp    8015c5 <ioq_step+0x20d>
+		batch[nb++] = q = ioq_take(i);
+  8015a1:	e8 4a fd ff ff       	call   8012f0 <ioq_take>
+  8015a6:	83 c6 01             	add    $0x1,%esi
+  8015a9:	89 84 b5 64 ff ff ff 	mov    %eax,-0x9c(%ebp,%esi,4)
+		blockno = q->io_blockno;
+  8015b0:	8b 38                	mov    (%eax),%edi
+		buf = q->io_buf;
+  8015b2:	8b 48 08             	mov    0x8(%eax),%ecx
+  8015b5:	89 8d 64 ff ff ff    	mov    %ecx,-0x9c(%ebp)
+		nblocks += q->io_nblocks;
+  8015bb:	03 58 04             	add    0x4(%eax),%ebx
+		ioq_stat.bs_iomerged++;
+  8015be:	83 05 08 27 83 00 01 	addl   $0x1,0x832708
+	while ((i = ioq_find_merge(blockno, buf, nblocks, write, 1)) != ~0) {
+  8015c5:	83 ec 08             	sub    $0x8,%esp
+  8015c8:	6a 01                	push   $0x1
+  8015ca:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  8015d0:	89 d9                	mov    %ebx,%ecx
+  8015d2:	8b 95 64 ff ff ff    	mov    -0x9c(%ebp),%edx
+  8015d8:	89 f8                	mov    %edi,%eax
+  8015da:	e8 38 fd ff ff       	call   801317 <ioq_find_merge>
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8015e5:	75 ba                	jne    8015a1 <ioq_step+0x1e9>
+	ioq_stat.bs_iodispatched++;
+  8015e7:	83 05 0c 27 83 00 01 	addl   $0x1,0x83270c
+	ioq_head = blockno + nblocks;
+  8015ee:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+  8015f1:	a3 20 27 83 00       	mov    %eax,0x832720
+	ioq_busy = 1;
+  8015f6:	c6 05 24 27 83 00 01 	movb   $0x1,0x832724
+	mutex_unlock(&ioq_mu);
+  8015fd:	83 ec 0c             	sub    $0xc,%esp
+  801600:	68 44 28 83 00       	push   $0x832844
+  801605:	e8 03 85 00 00       	call   809b0d <mutex_unlock>
+	if (write)
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	80 bd 5c ff ff ff 00 	cmpb   $0x0,-0xa4(%ebp)
+  801614:	74 37                	je     80164d <ioq_step+0x295>
+		r = bdev_write(blockno, buf, nblocks);
+  801616:	83 ec 04             	sub    $0x4,%esp
+  801619:	53                   	push   %ebx
+  80161a:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  801620:	57                   	push   %edi
+  801621:	e8 94 fc ff ff       	call   8012ba <bdev_write>
+  801626:	89 c3                	mov    %eax,%ebx
+  801628:	83 c4 10             	add    $0x10,%esp
+	mutex_lock(&ioq_mu);
+  80162b:	83 ec 0c             	sub    $0xc,%esp
+  80162e:	68 44 28 83 00       	push   $0x832844
+  801633:	e8 68 84 00 00       	call   809aa0 <mutex_lock>
+	ioq_busy = 0;
+  801638:	c6 05 24 27 83 00 00 	movb   $0x0,0x832724
+	for (i = 0; i < nb; i++) {
+  80163f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801645:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  801648:	83 c4 10             	add    $0x10,%esp
+  80164b:	eb 23                	jmp    801670 <ioq_step+0x2b8>
+		r = bdev_read(blockno, buf, nblocks);
+  80164d:	83 ec 04             	sub    $0x4,%esp
+  801650:	53                   	push   %ebx
+  801651:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  801657:	57                   	push   %edi
+  801658:	e8 27 fc ff ff       	call   801284 <bdev_read>
+  80165d:	89 c3                	mov    %eax,%ebx
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	eb c7                	jmp    80162b <ioq_step+0x273>
+		batch[i]->io_result = r;
+  801664:	8b 10                	mov    (%eax),%edx
+  801666:	89 5a 18             	mov    %ebx,0x18(%edx)
+		batch[i]->io_done = 1;
+  801669:	c6 42 14 01          	movb   $0x1,0x14(%edx)
+	for (i = 0; i < nb; i++) {
+  80166d:	83 c0 04             	add    $0x4,%eax
+  801670:	39 c8                	cmp    %ecx,%eax
+  801672:	75 f0                	jne    801664 <ioq_step+0x2ac>
+	cond_broadcast(&ioq_cond);
+  801674:	83 ec 0c             	sub    $0xc,%esp
+  801677:	68 40 28 83 00       	push   $0x832840
+  80167c:	e8 56 85 00 00       	call   809bd7 <cond_broadcast>
+}
+  801681:	83 c4 10             	add    $0x10,%esp
+}
+  801684:	e9 64 fd ff ff       	jmp    8013ed <ioq_step+0x35>
+
+00801689 <ioq_submit>:
+{
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	56                   	push   %esi
+  80168d:	53                   	push   %ebx
+  80168e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801691:	8b 45 14             	mov    0x14(%ebp),%eax
+  801694:	8b 75 18             	mov    0x18(%ebp),%esi
+	assert(nblocks > 0 && nblocks <= BC_MAXIO);
+  801697:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80169a:	83 fa 1f             	cmp    $0x1f,%edx
+  80169d:	77 45                	ja     8016e4 <ioq_submit+0x5b>
+	q->io_blockno = blockno;
+  80169f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016a2:	89 13                	mov    %edx,(%ebx)
+	q->io_nblocks = nblocks;
+  8016a4:	89 43 04             	mov    %eax,0x4(%ebx)
+	q->io_buf = buf;
+  8016a7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016aa:	89 43 08             	mov    %eax,0x8(%ebx)
+	q->io_write = write;
+  8016ad:	89 f0                	mov    %esi,%eax
+  8016af:	88 43 0c             	mov    %al,0xc(%ebx)
+	q->io_deadline = sys_time_msec()
+  8016b2:	e8 eb 5d 00 00       	call   8074a2 <sys_time_msec>
+  8016b7:	89 c2                	mov    %eax,%edx
+		+ (write ? IOQ_WRITE_EXPIRE : IOQ_READ_EXPIRE);
+  8016b9:	89 f0                	mov    %esi,%eax
+  8016bb:	3c 01                	cmp    $0x1,%al
+  8016bd:	19 c0                	sbb    %eax,%eax
+  8016bf:	25 3e fe ff ff       	and    $0xfffffe3e,%eax
+  8016c4:	8d 84 10 f4 01 00 00 	lea    0x1f4(%eax,%edx,1),%eax
+  8016cb:	89 43 10             	mov    %eax,0x10(%ebx)
+	q->io_done = 0;
+  8016ce:	c6 43 14 00          	movb   $0x0,0x14(%ebx)
+	mutex_lock(&ioq_mu);
+  8016d2:	83 ec 0c             	sub    $0xc,%esp
+  8016d5:	68 44 28 83 00       	push   $0x832844
+  8016da:	e8 c1 83 00 00       	call   809aa0 <mutex_lock>
+	while (ioq_n == IOQ_MAX)
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	eb 1b                	jmp    8016ff <ioq_submit+0x76>
+	assert(nblocks > 0 && nblocks <= BC_MAXIO);
+  8016e4:	68 8c ae 80 00       	push   $0x80ae8c
+  8016e9:	68 2b ad 80 00       	push   $0x80ad2b
+  8016ee:	6a 22                	push   $0x22
+  8016f0:	68 af ae 80 00       	push   $0x80aeaf
+  8016f5:	e8 1e 50 00 00       	call   806718 <_panic>
+		ioq_step();
+  8016fa:	e8 b9 fc ff ff       	call   8013b8 <ioq_step>
+	while (ioq_n == IOQ_MAX)
+  8016ff:	a1 28 27 83 00       	mov    0x832728,%eax
+  801704:	83 f8 40             	cmp    $0x40,%eax
+  801707:	74 f1                	je     8016fa <ioq_submit+0x71>
+	ioq[ioq_n++] = q;
+  801709:	8d 50 01             	lea    0x1(%eax),%edx
+  80170c:	89 15 28 27 83 00    	mov    %edx,0x832728
+  801712:	89 1c 85 40 27 83 00 	mov    %ebx,0x832740(,%eax,4)
+	ioq_stat.bs_ioqueued++;
+  801719:	83 05 04 27 83 00 01 	addl   $0x1,0x832704
+	ioq_stat.bs_iomaxdepth = MAX(ioq_stat.bs_iomaxdepth, ioq_n);
+  801720:	a1 18 27 83 00       	mov    0x832718,%eax
+  801725:	39 d0                	cmp    %edx,%eax
+  801727:	0f 42 c2             	cmovb  %edx,%eax
+  80172a:	a3 18 27 83 00       	mov    %eax,0x832718
+	mutex_unlock(&ioq_mu);
+  80172f:	83 ec 0c             	sub    $0xc,%esp
+  801732:	68 44 28 83 00       	push   $0x832844
+  801737:	e8 d1 83 00 00       	call   809b0d <mutex_unlock>
+}
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5d                   	pop    %ebp
+  801745:	c3                   	ret
+
+00801746 <ioq_wait>:
+
+// Wait for q to finish.  Returns 0 on success, < 0 on error.
+int
+ioq_wait(struct IoReq *q)
+{
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	53                   	push   %ebx
+  80174a:	83 ec 10             	sub    $0x10,%esp
+  80174d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&ioq_mu);
+  801750:	68 44 28 83 00       	push   $0x832844
+  801755:	e8 46 83 00 00       	call   809aa0 <mutex_lock>
+	while (!q->io_done)
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	eb 05                	jmp    801764 <ioq_wait+0x1e>
+		ioq_step();
+  80175f:	e8 54 fc ff ff       	call   8013b8 <ioq_step>
+	while (!q->io_done)
+  801764:	80 7b 14 00          	cmpb   $0x0,0x14(%ebx)
+  801768:	74 f5                	je     80175f <ioq_wait+0x19>
+	mutex_unlock(&ioq_mu);
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	68 44 28 83 00       	push   $0x832844
+  801772:	e8 96 83 00 00       	call   809b0d <mutex_unlock>
+	return q->io_result;
+  801777:	8b 43 18             	mov    0x18(%ebx),%eax
+}
+  80177a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+
+0080177f <ioq_read>:
+
+int
+ioq_read(uint32_t blockno, void *dst, uint32_t nblocks)
+{
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	53                   	push   %ebx
+  801783:	83 ec 30             	sub    $0x30,%esp
+	struct IoReq q;
+
+	ioq_submit(&q, blockno, dst, nblocks, 0);
+  801786:	6a 00                	push   $0x0
+  801788:	ff 75 10             	push   0x10(%ebp)
+  80178b:	ff 75 0c             	push   0xc(%ebp)
+  80178e:	ff 75 08             	push   0x8(%ebp)
+  801791:	8d 5d dc             	lea    -0x24(%ebp),%ebx
+  801794:	53                   	push   %ebx
+  801795:	e8 ef fe ff ff       	call   801689 <ioq_submit>
+	return ioq_wait(&q);
+  80179a:	83 c4 14             	add    $0x14,%esp
+  80179d:	53                   	push   %ebx
+  80179e:	e8 a3 ff ff ff       	call   801746 <ioq_wait>
+}
+  8017a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a6:	c9                   	leave
+  8017a7:	c3                   	ret
+
+008017a8 <ioq_write>:
+
+int
+ioq_write(uint32_t blockno, const void *src, uint32_t nblocks)
+{
+  8017a8:	55                   	push   %ebp
+  8017a9:	89 e5                	mov    %esp,%ebp
+  8017ab:	53                   	push   %ebx
+  8017ac:	83 ec 30             	sub    $0x30,%esp
+	struct IoReq q;
+
+	ioq_submit(&q, blockno, (void *) src, nblocks, 1);
+  8017af:	6a 01                	push   $0x1
+  8017b1:	ff 75 10             	push   0x10(%ebp)
+  8017b4:	ff 75 0c             	push   0xc(%ebp)
+  8017b7:	ff 75 08             	push   0x8(%ebp)
+  8017ba:	8d 5d dc             	lea    -0x24(%ebp),%ebx
+  8017bd:	53                   	push   %ebx
+  8017be:	e8 c6 fe ff ff       	call   801689 <ioq_submit>
+	return ioq_wait(&q);
+  8017c3:	83 c4 14             	add    $0x14,%esp
+  8017c6:	53                   	push   %ebx
+  8017c7:	e8 7a ff ff ff       	call   801746 <ioq_wait>
+}
+  8017cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+
+008017d1 <ioq_get_stat>:
+
+// Fill in the queue counters of st.
+void
+ioq_get_stat(struct BcStat *st)
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 10             	sub    $0x10,%esp
+  8017d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&ioq_mu);
+  8017db:	68 44 28 83 00       	push   $0x832844
+  8017e0:	e8 bb 82 00 00       	call   809aa0 <mutex_lock>
+	st->bs_ioqueued = ioq_stat.bs_ioqueued;
+  8017e5:	a1 04 27 83 00       	mov    0x832704,%eax
+  8017ea:	89 43 24             	mov    %eax,0x24(%ebx)
+	st->bs_iomerged = ioq_stat.bs_iomerged;
+  8017ed:	a1 08 27 83 00       	mov    0x832708,%eax
+  8017f2:	89 43 28             	mov    %eax,0x28(%ebx)
+	st->bs_iodispatched = ioq_stat.bs_iodispatched;
+  8017f5:	a1 0c 27 83 00       	mov    0x83270c,%eax
+  8017fa:	89 43 2c             	mov    %eax,0x2c(%ebx)
+	st->bs_ioexpired = ioq_stat.bs_ioexpired;
+  8017fd:	a1 10 27 83 00       	mov    0x832710,%eax
+  801802:	89 43 30             	mov    %eax,0x30(%ebx)
+	st->bs_iodepth = ioq_n;
+  801805:	a1 28 27 83 00       	mov    0x832728,%eax
+  80180a:	89 43 34             	mov    %eax,0x34(%ebx)
+	st->bs_iomaxdepth = ioq_stat.bs_iomaxdepth;
+  80180d:	a1 18 27 83 00       	mov    0x832718,%eax
+  801812:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&ioq_mu);
+  801815:	c7 04 24 44 28 83 00 	movl   $0x832844,(%esp)
+  80181c:	e8 ec 82 00 00       	call   809b0d <mutex_unlock>
+}
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+
+00801829 <dirty_search>:
+}
+
+// Return the index of the first entry in bc_dirty that is >= blockno.
+static uint32_t
+dirty_search(uint32_t blockno)
+{
+  801829:	55                   	push   %ebp
+  80182a:	89 e5                	mov    %esp,%ebp
+  80182c:	53                   	push   %ebx
+  80182d:	89 c3                	mov    %eax,%ebx
+	uint32_t lo = 0, hi = bc_ndirty, mid;
+  80182f:	8b 0d 64 2f 83 00    	mov    0x832f64,%ecx
+  801835:	b8 00 00 00 00       	mov    $0x0,%eax
+
+	while (lo < hi) {
+  80183a:	39 c8                	cmp    %ecx,%eax
+  80183c:	73 17                	jae    801855 <dirty_search+0x2c>
+		mid = (lo + hi) / 2;
+  80183e:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  801841:	d1 ea                	shr    %edx
+		if (bc_dirty[mid] < blockno)
+  801843:	39 1c 95 80 6f 83 00 	cmp    %ebx,0x836f80(,%edx,4)
+  80184a:	72 04                	jb     801850 <dirty_search+0x27>
+		mid = (lo + hi) / 2;
+  80184c:	89 d1                	mov    %edx,%ecx
+  80184e:	eb ea                	jmp    80183a <dirty_search+0x11>
+			lo = mid + 1;
+  801850:	8d 42 01             	lea    0x1(%edx),%eax
+  801853:	eb e5                	jmp    80183a <dirty_search+0x11>
+		else
+			hi = mid;
+	}
+	return lo;
+}
+  801855:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801858:	c9                   	leave
+  801859:	c3                   	ret
+
+0080185a <dirty_run>:
+
+// Length of the run of consecutive dirty blocks starting at bc_dirty[i],
+// capped at what one ide_write can carry.
+static uint32_t
+dirty_run(uint32_t i)
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	57                   	push   %edi
+  80185e:	56                   	push   %esi
+  80185f:	53                   	push   %ebx
+  801860:	89 c1                	mov    %eax,%ecx
+	uint32_t n;
+
+	for (n = 1; i + n < bc_ndirty && n < BC_MAXIO; n++)
+  801862:	8b 3d 64 2f 83 00    	mov    0x832f64,%edi
+  801868:	8d 50 01             	lea    0x1(%eax),%edx
+  80186b:	89 d0                	mov    %edx,%eax
+  80186d:	29 c8                	sub    %ecx,%eax
+  80186f:	83 f8 1f             	cmp    $0x1f,%eax
+  801872:	77 1b                	ja     80188f <dirty_run+0x35>
+  801874:	39 fa                	cmp    %edi,%edx
+  801876:	73 17                	jae    80188f <dirty_run+0x35>
+		if (bc_dirty[i + n] != bc_dirty[i] + n)
+  801878:	8b 34 95 80 6f 83 00 	mov    0x836f80(,%edx,4),%esi
+  80187f:	83 c2 01             	add    $0x1,%edx
+  801882:	89 c3                	mov    %eax,%ebx
+  801884:	03 1c 8d 80 6f 83 00 	add    0x836f80(,%ecx,4),%ebx
+  80188b:	39 de                	cmp    %ebx,%esi
+  80188d:	74 dc                	je     80186b <dirty_run+0x11>
+			break;
+	return n;
+}
+  80188f:	5b                   	pop    %ebx
+  801890:	5e                   	pop    %esi
+  801891:	5f                   	pop    %edi
+  801892:	5d                   	pop    %ebp
+  801893:	c3                   	ret
+
+00801894 <bc_write_wait>:
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	57                   	push   %edi
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	83 ec 1c             	sub    $0x1c,%esp
+  80189d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	for (i = 0; i < n; i++) {
+  8018a0:	89 c7                	mov    %eax,%edi
+  8018a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018a9:	eb 46                	jmp    8018f1 <bc_write_wait+0x5d>
+			panic("bdev write block: %d, nblocks: %d failed, %e",
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+  8018ae:	50                   	push   %eax
+  8018af:	ff 77 04             	push   0x4(%edi)
+  8018b2:	ff 37                	push   (%edi)
+  8018b4:	68 b8 ae 80 00       	push   $0x80aeb8
+  8018b9:	6a 7b                	push   $0x7b
+  8018bb:	68 ac b0 80 00       	push   $0x80b0ac
+  8018c0:	e8 53 4e 00 00       	call   806718 <_panic>
+				panic("in bc_write, sys_page_map: %e", r);
+  8018c5:	50                   	push   %eax
+  8018c6:	68 b4 b0 80 00       	push   $0x80b0b4
+  8018cb:	68 80 00 00 00       	push   $0x80
+  8018d0:	68 ac b0 80 00       	push   $0x80b0ac
+  8018d5:	e8 3e 4e 00 00       	call   806718 <_panic>
+		bc_stat.bs_writes++;
+  8018da:	83 05 14 c4 84 00 01 	addl   $0x1,0x84c414
+		bc_stat.bs_writebacks += reqs[i].io_nblocks;
+  8018e1:	8b 46 04             	mov    0x4(%esi),%eax
+  8018e4:	01 05 10 c4 84 00    	add    %eax,0x84c410
+	for (i = 0; i < n; i++) {
+  8018ea:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  8018ee:	83 c7 1c             	add    $0x1c,%edi
+  8018f1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018f4:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+  8018f7:	74 44                	je     80193d <bc_write_wait+0xa9>
+		if ((r = ioq_wait(&reqs[i])) < 0)
+  8018f9:	89 fe                	mov    %edi,%esi
+  8018fb:	83 ec 0c             	sub    $0xc,%esp
+  8018fe:	57                   	push   %edi
+  8018ff:	e8 42 fe ff ff       	call   801746 <ioq_wait>
+  801904:	83 c4 10             	add    $0x10,%esp
+  801907:	85 c0                	test   %eax,%eax
+  801909:	78 a0                	js     8018ab <bc_write_wait+0x17>
+		for (j = 0; j < reqs[i].io_nblocks; j++) {
+  80190b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801910:	3b 5e 04             	cmp    0x4(%esi),%ebx
+  801913:	73 c5                	jae    8018da <bc_write_wait+0x46>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801915:	8b 06                	mov    (%esi),%eax
+  801917:	8d 84 03 00 00 01 00 	lea    0x10000(%ebx,%eax,1),%eax
+  80191e:	c1 e0 0c             	shl    $0xc,%eax
+			if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_P)) < 0)
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	6a 05                	push   $0x5
+  801926:	50                   	push   %eax
+  801927:	6a 00                	push   $0x0
+  801929:	50                   	push   %eax
+  80192a:	6a 00                	push   $0x0
+  80192c:	e8 31 59 00 00       	call   807262 <sys_page_map>
+  801931:	83 c4 20             	add    $0x20,%esp
+  801934:	85 c0                	test   %eax,%eax
+  801936:	78 8d                	js     8018c5 <bc_write_wait+0x31>
+		for (j = 0; j < reqs[i].io_nblocks; j++) {
+  801938:	83 c3 01             	add    $0x1,%ebx
+  80193b:	eb d3                	jmp    801910 <bc_write_wait+0x7c>
+}
+  80193d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801940:	5b                   	pop    %ebx
+  801941:	5e                   	pop    %esi
+  801942:	5f                   	pop    %edi
+  801943:	5d                   	pop    %ebp
+  801944:	c3                   	ret
+
+00801945 <dirty_insert>:
+{
+  801945:	55                   	push   %ebp
+  801946:	89 e5                	mov    %esp,%ebp
+  801948:	57                   	push   %edi
+  801949:	56                   	push   %esi
+  80194a:	53                   	push   %ebx
+  80194b:	83 ec 1c             	sub    $0x1c,%esp
+  80194e:	89 c7                	mov    %eax,%edi
+  801950:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	i = dirty_search(blockno);
+  801953:	e8 d1 fe ff ff       	call   801829 <dirty_search>
+  801958:	89 c3                	mov    %eax,%ebx
+	if (i < bc_ndirty && bc_dirty[i] == blockno)
+  80195a:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  80195f:	39 c3                	cmp    %eax,%ebx
+  801961:	73 09                	jae    80196c <dirty_insert+0x27>
+  801963:	39 3c 9d 80 6f 83 00 	cmp    %edi,0x836f80(,%ebx,4)
+  80196a:	74 67                	je     8019d3 <dirty_insert+0x8e>
+	memmove(&bc_dirty[i + 1], &bc_dirty[i],
+  80196c:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+  801973:	83 ec 04             	sub    $0x4,%esp
+		(bc_ndirty - i) * sizeof bc_dirty[0]);
+  801976:	29 d8                	sub    %ebx,%eax
+	memmove(&bc_dirty[i + 1], &bc_dirty[i],
+  801978:	c1 e0 02             	shl    $0x2,%eax
+  80197b:	50                   	push   %eax
+  80197c:	8d 86 80 6f 83 00    	lea    0x836f80(%esi),%eax
+  801982:	50                   	push   %eax
+  801983:	8d 46 04             	lea    0x4(%esi),%eax
+  801986:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801989:	8d 86 84 6f 83 00    	lea    0x836f84(%esi),%eax
+  80198f:	50                   	push   %eax
+  801990:	e8 c8 55 00 00       	call   806f5d <memmove>
+	memmove(&bc_dirty_time[i + 1], &bc_dirty_time[i],
+  801995:	83 c4 0c             	add    $0xc,%esp
+		(bc_ndirty - i) * sizeof bc_dirty_time[0]);
+  801998:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  80199d:	29 d8                	sub    %ebx,%eax
+	memmove(&bc_dirty_time[i + 1], &bc_dirty_time[i],
+  80199f:	c1 e0 02             	shl    $0x2,%eax
+  8019a2:	50                   	push   %eax
+  8019a3:	81 c6 80 2f 83 00    	add    $0x832f80,%esi
+  8019a9:	56                   	push   %esi
+  8019aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019ad:	05 80 2f 83 00       	add    $0x832f80,%eax
+  8019b2:	50                   	push   %eax
+  8019b3:	e8 a5 55 00 00       	call   806f5d <memmove>
+	bc_dirty[i] = blockno;
+  8019b8:	89 3c 9d 80 6f 83 00 	mov    %edi,0x836f80(,%ebx,4)
+	bc_dirty_time[i] = stamp;
+  8019bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019c2:	89 04 9d 80 2f 83 00 	mov    %eax,0x832f80(,%ebx,4)
+	bc_ndirty++;
+  8019c9:	83 05 64 2f 83 00 01 	addl   $0x1,0x832f64
+  8019d0:	83 c4 10             	add    $0x10,%esp
+}
+  8019d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d6:	5b                   	pop    %ebx
+  8019d7:	5e                   	pop    %esi
+  8019d8:	5f                   	pop    %edi
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+
+008019db <bc_mark_dirty>:
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+  8019e0:	89 c6                	mov    %eax,%esi
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8019e2:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+  8019e8:	c1 e3 0c             	shl    $0xc,%ebx
+	dirty_insert(blockno, sys_time_msec());
+  8019eb:	e8 b2 5a 00 00       	call   8074a2 <sys_time_msec>
+  8019f0:	89 c2                	mov    %eax,%edx
+  8019f2:	89 f0                	mov    %esi,%eax
+  8019f4:	e8 4c ff ff ff       	call   801945 <dirty_insert>
+	if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_W | PTE_P)) < 0)
+  8019f9:	83 ec 0c             	sub    $0xc,%esp
+  8019fc:	6a 07                	push   $0x7
+  8019fe:	53                   	push   %ebx
+  8019ff:	6a 00                	push   $0x0
+  801a01:	53                   	push   %ebx
+  801a02:	6a 00                	push   $0x0
+  801a04:	e8 59 58 00 00       	call   807262 <sys_page_map>
+  801a09:	83 c4 20             	add    $0x20,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 07                	js     801a17 <bc_mark_dirty+0x3c>
+}
+  801a10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a13:	5b                   	pop    %ebx
+  801a14:	5e                   	pop    %esi
+  801a15:	5d                   	pop    %ebp
+  801a16:	c3                   	ret
+		panic("in bc_mark_dirty, sys_page_map: %e", r);
+  801a17:	50                   	push   %eax
+  801a18:	68 e8 ae 80 00       	push   $0x80aee8
+  801a1d:	6a 6d                	push   $0x6d
+  801a1f:	68 ac b0 80 00       	push   $0x80b0ac
+  801a24:	e8 ef 4c 00 00       	call   806718 <_panic>
+
+00801a29 <diskaddr>:
+{
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+  801a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	74 19                	je     801a4f <diskaddr+0x26>
+  801a36:	8b 15 e4 c3 84 00    	mov    0x84c3e4,%edx
+  801a3c:	85 d2                	test   %edx,%edx
+  801a3e:	74 05                	je     801a45 <diskaddr+0x1c>
+  801a40:	3b 42 04             	cmp    0x4(%edx),%eax
+  801a43:	73 0a                	jae    801a4f <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801a45:	05 00 00 01 00       	add    $0x10000,%eax
+  801a4a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  801a4d:	c9                   	leave
+  801a4e:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  801a4f:	50                   	push   %eax
+  801a50:	68 0c af 80 00       	push   $0x80af0c
+  801a55:	6a 26                	push   $0x26
+  801a57:	68 ac b0 80 00       	push   $0x80b0ac
+  801a5c:	e8 b7 4c 00 00       	call   806718 <_panic>
+
+00801a61 <va_is_mapped>:
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  801a67:	89 d0                	mov    %edx,%eax
+  801a69:	c1 e8 16             	shr    $0x16,%eax
+  801a6c:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a78:	f6 c1 01             	test   $0x1,%cl
+  801a7b:	74 0d                	je     801a8a <va_is_mapped+0x29>
+  801a7d:	c1 ea 0c             	shr    $0xc,%edx
+  801a80:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801a87:	83 e0 01             	and    $0x1,%eax
+  801a8a:	83 e0 01             	and    $0x1,%eax
+}
+  801a8d:	5d                   	pop    %ebp
+  801a8e:	c3                   	ret
+
+00801a8f <va_is_dirty>:
+{
+  801a8f:	55                   	push   %ebp
+  801a90:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  801a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a95:	c1 e8 0c             	shr    $0xc,%eax
+  801a98:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a9f:	c1 e8 06             	shr    $0x6,%eax
+  801aa2:	83 e0 01             	and    $0x1,%eax
+}
+  801aa5:	5d                   	pop    %ebp
+  801aa6:	c3                   	ret
+
+00801aa7 <bc_writeback>:
+// dirtied at least 'age' msec ago, one request per run, all queued
+// together so the I/O queue can order them.  An age of 0 writes back
+// everything.  Returns the number of blocks written.
+uint32_t
+bc_writeback(uint32_t age)
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	57                   	push   %edi
+  801aab:	56                   	push   %esi
+  801aac:	53                   	push   %ebx
+  801aad:	83 ec 2c             	sub    $0x2c,%esp
+  801ab0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	// Callers hold fs_mu, so one array will do.
+	static struct IoReq reqs[IOQ_MAX];
+	uint32_t i, j, k, n, now, written, nreq;
+
+	now = sys_time_msec();
+  801ab3:	e8 ea 59 00 00       	call   8074a2 <sys_time_msec>
+  801ab8:	89 c6                	mov    %eax,%esi
+	written = nreq = 0;
+  801aba:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  801ac1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (i = j = 0; i < bc_ndirty; i += n) {
+  801ac8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  801acf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ad6:	eb 5e                	jmp    801b36 <bc_writeback+0x8f>
+			ioq_submit(&reqs[nreq++], bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+			written += n;
+			continue;
+		}
+		// Too young; keep the run.
+		for (k = i; k < i + n; k++, j++) {
+  801ad8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801adb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+		if (k < i + n) {
+  801ade:	39 d8                	cmp    %ebx,%eax
+  801ae0:	0f 83 d6 00 00 00    	jae    801bbc <bc_writeback+0x115>
+			if (nreq == IOQ_MAX) {
+  801ae6:	83 7d dc 40          	cmpl   $0x40,-0x24(%ebp)
+  801aea:	0f 84 8f 00 00 00    	je     801b7f <bc_writeback+0xd8>
+			ioq_submit(&reqs[nreq++], bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+  801af0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801af3:	8b 14 85 80 6f 83 00 	mov    0x836f80(,%eax,4),%edx
+  801afa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801afd:	8d 41 01             	lea    0x1(%ecx),%eax
+  801b00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b03:	83 ec 0c             	sub    $0xc,%esp
+  801b06:	6a 01                	push   $0x1
+  801b08:	ff 75 e0             	push   -0x20(%ebp)
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801b0b:	8d 82 00 00 01 00    	lea    0x10000(%edx),%eax
+  801b11:	c1 e0 0c             	shl    $0xc,%eax
+			ioq_submit(&reqs[nreq++], bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+  801b14:	50                   	push   %eax
+  801b15:	52                   	push   %edx
+  801b16:	6b c1 1c             	imul   $0x1c,%ecx,%eax
+  801b19:	05 60 28 83 00       	add    $0x832860,%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	e8 65 fb ff ff       	call   801689 <ioq_submit>
+			written += n;
+  801b24:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b27:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+			continue;
+  801b2a:	83 c4 20             	add    $0x20,%esp
+			ioq_submit(&reqs[nreq++], bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+  801b2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b30:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801b33:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+	for (i = j = 0; i < bc_ndirty; i += n) {
+  801b36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b39:	3b 05 64 2f 83 00    	cmp    0x832f64,%eax
+  801b3f:	0f 83 91 00 00 00    	jae    801bd6 <bc_writeback+0x12f>
+		n = dirty_run(i);
+  801b45:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801b48:	89 d8                	mov    %ebx,%eax
+  801b4a:	e8 0b fd ff ff       	call   80185a <dirty_run>
+  801b4f:	89 c2                	mov    %eax,%edx
+  801b51:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		for (k = i; k < i + n; k++)
+  801b54:	89 d8                	mov    %ebx,%eax
+  801b56:	8d 1c 13             	lea    (%ebx,%edx,1),%ebx
+			if (age == 0 || now - bc_dirty_time[k] >= age)
+  801b59:	85 ff                	test   %edi,%edi
+  801b5b:	0f 84 77 ff ff ff    	je     801ad8 <bc_writeback+0x31>
+  801b61:	39 d8                	cmp    %ebx,%eax
+  801b63:	0f 83 6f ff ff ff    	jae    801ad8 <bc_writeback+0x31>
+  801b69:	89 f2                	mov    %esi,%edx
+  801b6b:	2b 14 85 80 2f 83 00 	sub    0x832f80(,%eax,4),%edx
+  801b72:	39 fa                	cmp    %edi,%edx
+  801b74:	0f 83 6c ff ff ff    	jae    801ae6 <bc_writeback+0x3f>
+		for (k = i; k < i + n; k++)
+  801b7a:	83 c0 01             	add    $0x1,%eax
+  801b7d:	eb da                	jmp    801b59 <bc_writeback+0xb2>
+				bc_write_wait(reqs, nreq);
+  801b7f:	ba 40 00 00 00       	mov    $0x40,%edx
+  801b84:	b8 60 28 83 00       	mov    $0x832860,%eax
+  801b89:	e8 06 fd ff ff       	call   801894 <bc_write_wait>
+				nreq = 0;
+  801b8e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  801b95:	e9 56 ff ff ff       	jmp    801af0 <bc_writeback+0x49>
+			bc_dirty[j] = bc_dirty[k];
+  801b9a:	8b 04 95 80 6f 83 00 	mov    0x836f80(,%edx,4),%eax
+  801ba1:	89 04 8d 80 6f 83 00 	mov    %eax,0x836f80(,%ecx,4)
+			bc_dirty_time[j] = bc_dirty_time[k];
+  801ba8:	8b 04 95 80 2f 83 00 	mov    0x832f80(,%edx,4),%eax
+  801baf:	89 04 8d 80 2f 83 00 	mov    %eax,0x832f80(,%ecx,4)
+		for (k = i; k < i + n; k++, j++) {
+  801bb6:	83 c2 01             	add    $0x1,%edx
+  801bb9:	83 c1 01             	add    $0x1,%ecx
+  801bbc:	39 da                	cmp    %ebx,%edx
+  801bbe:	72 da                	jb     801b9a <bc_writeback+0xf3>
+  801bc0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bc3:	39 c3                	cmp    %eax,%ebx
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	0f 43 45 e0          	cmovae -0x20(%ebp),%eax
+  801bce:	01 45 d8             	add    %eax,-0x28(%ebp)
+  801bd1:	e9 5d ff ff ff       	jmp    801b33 <bc_writeback+0x8c>
+		}
+	}
+	bc_ndirty = j;
+  801bd6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801bd9:	a3 64 2f 83 00       	mov    %eax,0x832f64
+	bc_write_wait(reqs, nreq);
+  801bde:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801be1:	b8 60 28 83 00       	mov    $0x832860,%eax
+  801be6:	e8 a9 fc ff ff       	call   801894 <bc_write_wait>
+	return written;
+}
+  801beb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801bee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf1:	5b                   	pop    %ebx
+  801bf2:	5e                   	pop    %esi
+  801bf3:	5f                   	pop    %edi
+  801bf4:	5d                   	pop    %ebp
+  801bf5:	c3                   	ret
+
+00801bf6 <bc_sync>:
+
+// Write back every dirty block in the cache.
+void
+bc_sync(void)
+{
+  801bf6:	55                   	push   %ebp
+  801bf7:	89 e5                	mov    %esp,%ebp
+  801bf9:	83 ec 14             	sub    $0x14,%esp
+	bc_writeback(0);
+  801bfc:	6a 00                	push   $0x0
+  801bfe:	e8 a4 fe ff ff       	call   801aa7 <bc_writeback>
+}
+  801c03:	83 c4 10             	add    $0x10,%esp
+  801c06:	c9                   	leave
+  801c07:	c3                   	ret
+
+00801c08 <bc_ndirty_blocks>:
+// Return the number of dirty blocks in the cache.
+uint32_t
+bc_ndirty_blocks(void)
+{
+	return bc_ndirty;
+}
+  801c08:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801c0d:	c3                   	ret
+
+00801c0e <bc_get_stat>:
+
+// Fill in the cache counters.
+void
+bc_get_stat(struct BcStat *st)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t i;
+
+	*st = bc_stat;
+  801c16:	a1 00 c4 84 00       	mov    0x84c400,%eax
+  801c1b:	89 06                	mov    %eax,(%esi)
+  801c1d:	a1 04 c4 84 00       	mov    0x84c404,%eax
+  801c22:	89 46 04             	mov    %eax,0x4(%esi)
+  801c25:	a1 08 c4 84 00       	mov    0x84c408,%eax
+  801c2a:	89 46 08             	mov    %eax,0x8(%esi)
+  801c2d:	a1 0c c4 84 00       	mov    0x84c40c,%eax
+  801c32:	89 46 0c             	mov    %eax,0xc(%esi)
+  801c35:	a1 10 c4 84 00       	mov    0x84c410,%eax
+  801c3a:	89 46 10             	mov    %eax,0x10(%esi)
+  801c3d:	a1 14 c4 84 00       	mov    0x84c414,%eax
+  801c42:	89 46 14             	mov    %eax,0x14(%esi)
+  801c45:	a1 18 c4 84 00       	mov    0x84c418,%eax
+  801c4a:	89 46 18             	mov    %eax,0x18(%esi)
+  801c4d:	a1 1c c4 84 00       	mov    0x84c41c,%eax
+  801c52:	89 46 1c             	mov    %eax,0x1c(%esi)
+  801c55:	a1 20 c4 84 00       	mov    0x84c420,%eax
+  801c5a:	89 46 20             	mov    %eax,0x20(%esi)
+  801c5d:	a1 24 c4 84 00       	mov    0x84c424,%eax
+  801c62:	89 46 24             	mov    %eax,0x24(%esi)
+  801c65:	a1 28 c4 84 00       	mov    0x84c428,%eax
+  801c6a:	89 46 28             	mov    %eax,0x28(%esi)
+  801c6d:	a1 2c c4 84 00       	mov    0x84c42c,%eax
+  801c72:	89 46 2c             	mov    %eax,0x2c(%esi)
+  801c75:	a1 30 c4 84 00       	mov    0x84c430,%eax
+  801c7a:	89 46 30             	mov    %eax,0x30(%esi)
+  801c7d:	a1 34 c4 84 00       	mov    0x84c434,%eax
+  801c82:	89 46 34             	mov    %eax,0x34(%esi)
+  801c85:	a1 38 c4 84 00       	mov    0x84c438,%eax
+  801c8a:	89 46 38             	mov    %eax,0x38(%esi)
+	ioq_get_stat(st);
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	56                   	push   %esi
+  801c91:	e8 3b fb ff ff       	call   8017d1 <ioq_get_stat>
+	st->bs_budget = bc_budget;
+  801c96:	a1 38 d0 80 00       	mov    0x80d038,%eax
+  801c9b:	89 46 20             	mov    %eax,0x20(%esi)
+	st->bs_dirty = bc_ndirty;
+  801c9e:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801ca3:	89 46 18             	mov    %eax,0x18(%esi)
+	st->bs_resident = 0;
+  801ca6:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	for (i = 0; i < bc_nring; i++)
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb5:	eb 03                	jmp    801cba <bc_get_stat+0xac>
+  801cb7:	83 c3 01             	add    $0x1,%ebx
+  801cba:	3b 1d 8c af 83 00    	cmp    0x83af8c,%ebx
+  801cc0:	73 25                	jae    801ce7 <bc_get_stat+0xd9>
+		if (va_is_mapped(bc_va(bc_ring[i])))
+  801cc2:	83 ec 0c             	sub    $0xc,%esp
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801cc5:	8b 04 9d a0 af 83 00 	mov    0x83afa0(,%ebx,4),%eax
+  801ccc:	05 00 00 01 00       	add    $0x10000,%eax
+  801cd1:	c1 e0 0c             	shl    $0xc,%eax
+		if (va_is_mapped(bc_va(bc_ring[i])))
+  801cd4:	50                   	push   %eax
+  801cd5:	e8 87 fd ff ff       	call   801a61 <va_is_mapped>
+  801cda:	83 c4 10             	add    $0x10,%esp
+  801cdd:	84 c0                	test   %al,%al
+  801cdf:	74 d6                	je     801cb7 <bc_get_stat+0xa9>
+			st->bs_resident++;
+  801ce1:	83 46 1c 01          	addl   $0x1,0x1c(%esi)
+  801ce5:	eb d0                	jmp    801cb7 <bc_get_stat+0xa9>
+}
+  801ce7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cea:	5b                   	pop    %ebx
+  801ceb:	5e                   	pop    %esi
+  801cec:	5d                   	pop    %ebp
+  801ced:	c3                   	ret
+
+00801cee <bc_discard>:
+// Forget the cached copies of blocks [blockno, blockno+n), which have
+// just been freed: dirty ones are dropped without being written back,
+// and the pages are unmapped, leaving their ring slots to be reused.
+void
+bc_discard(uint32_t blockno, uint32_t n)
+{
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	57                   	push   %edi
+  801cf2:	56                   	push   %esi
+  801cf3:	53                   	push   %ebx
+  801cf4:	83 ec 1c             	sub    $0x1c,%esp
+  801cf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t i, j, b;
+	int r;
+
+	i = dirty_search(blockno);
+  801cfa:	89 d8                	mov    %ebx,%eax
+  801cfc:	e8 28 fb ff ff       	call   801829 <dirty_search>
+  801d01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	j = dirty_search(blockno + n);
+  801d04:	89 de                	mov    %ebx,%esi
+  801d06:	03 75 0c             	add    0xc(%ebp),%esi
+  801d09:	89 f0                	mov    %esi,%eax
+  801d0b:	e8 19 fb ff ff       	call   801829 <dirty_search>
+  801d10:	89 c7                	mov    %eax,%edi
+	memmove(&bc_dirty[i], &bc_dirty[j], (bc_ndirty - j) * sizeof bc_dirty[0]);
+  801d12:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  801d19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d1c:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+  801d23:	83 ec 04             	sub    $0x4,%esp
+  801d26:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801d2b:	29 f8                	sub    %edi,%eax
+  801d2d:	c1 e0 02             	shl    $0x2,%eax
+  801d30:	50                   	push   %eax
+  801d31:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801d34:	8d 82 80 6f 83 00    	lea    0x836f80(%edx),%eax
+  801d3a:	50                   	push   %eax
+  801d3b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801d3e:	8d 81 80 6f 83 00    	lea    0x836f80(%ecx),%eax
+  801d44:	50                   	push   %eax
+  801d45:	e8 13 52 00 00       	call   806f5d <memmove>
+	memmove(&bc_dirty_time[i], &bc_dirty_time[j],
+  801d4a:	83 c4 0c             	add    $0xc,%esp
+		(bc_ndirty - j) * sizeof bc_dirty_time[0]);
+  801d4d:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801d52:	29 f8                	sub    %edi,%eax
+	memmove(&bc_dirty_time[i], &bc_dirty_time[j],
+  801d54:	c1 e0 02             	shl    $0x2,%eax
+  801d57:	50                   	push   %eax
+  801d58:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801d5b:	8d 82 80 2f 83 00    	lea    0x832f80(%edx),%eax
+  801d61:	50                   	push   %eax
+  801d62:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d65:	8d 81 80 2f 83 00    	lea    0x832f80(%ecx),%eax
+  801d6b:	50                   	push   %eax
+  801d6c:	e8 ec 51 00 00       	call   806f5d <memmove>
+	bc_ndirty -= j - i;
+  801d71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d74:	29 f8                	sub    %edi,%eax
+  801d76:	01 05 64 2f 83 00    	add    %eax,0x832f64
+
+	for (b = blockno; b < blockno + n; b++) {
+  801d7c:	83 c4 10             	add    $0x10,%esp
+  801d7f:	eb 1e                	jmp    801d9f <bc_discard+0xb1>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801d81:	89 df                	mov    %ebx,%edi
+  801d83:	c1 e7 0c             	shl    $0xc,%edi
+  801d86:	81 c7 00 00 00 10    	add    $0x10000000,%edi
+		if (b >= bc_busy_lo && b < bc_busy_hi)
+			continue;
+		if (va_is_mapped(bc_va(b))
+  801d8c:	83 ec 0c             	sub    $0xc,%esp
+  801d8f:	57                   	push   %edi
+  801d90:	e8 cc fc ff ff       	call   801a61 <va_is_mapped>
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	84 c0                	test   %al,%al
+  801d9a:	75 19                	jne    801db5 <bc_discard+0xc7>
+	for (b = blockno; b < blockno + n; b++) {
+  801d9c:	83 c3 01             	add    $0x1,%ebx
+  801d9f:	39 f3                	cmp    %esi,%ebx
+  801da1:	73 39                	jae    801ddc <bc_discard+0xee>
+		if (b >= bc_busy_lo && b < bc_busy_hi)
+  801da3:	3b 1d 84 af 83 00    	cmp    0x83af84,%ebx
+  801da9:	72 d6                	jb     801d81 <bc_discard+0x93>
+  801dab:	3b 1d 80 af 83 00    	cmp    0x83af80,%ebx
+  801db1:	73 ce                	jae    801d81 <bc_discard+0x93>
+  801db3:	eb e7                	jmp    801d9c <bc_discard+0xae>
+		    && (r = sys_page_unmap(0, bc_va(b))) < 0)
+  801db5:	83 ec 08             	sub    $0x8,%esp
+  801db8:	57                   	push   %edi
+  801db9:	6a 00                	push   $0x0
+  801dbb:	e8 ee 54 00 00       	call   8072ae <sys_page_unmap>
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	79 d5                	jns    801d9c <bc_discard+0xae>
+			panic("in bc_discard, sys_page_unmap: %e", r);
+  801dc7:	50                   	push   %eax
+  801dc8:	68 30 af 80 00       	push   $0x80af30
+  801dcd:	68 f4 01 00 00       	push   $0x1f4
+  801dd2:	68 ac b0 80 00       	push   $0x80b0ac
+  801dd7:	e8 3c 49 00 00       	call   806718 <_panic>
+	}
+}
+  801ddc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddf:	5b                   	pop    %ebx
+  801de0:	5e                   	pop    %esi
+  801de1:	5f                   	pop    %edi
+  801de2:	5d                   	pop    %ebp
+  801de3:	c3                   	ret
+
+00801de4 <flush_block>:
+// Dirty neighbours of the block go out in the same ide_write.
+// If the block is not in the block cache or is not dirty, does
+// nothing.
+void
+flush_block(void *addr)
+{
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	57                   	push   %edi
+  801de8:	56                   	push   %esi
+  801de9:	53                   	push   %ebx
+  801dea:	83 ec 3c             	sub    $0x3c,%esp
+  801ded:	8b 55 08             	mov    0x8(%ebp),%edx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  801df0:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+  801df6:	89 c7                	mov    %eax,%edi
+  801df8:	c1 ef 0c             	shr    $0xc,%edi
+	uint32_t i, n;
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  801dfb:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801e00:	77 22                	ja     801e24 <flush_block+0x40>
+		panic("flush_block of bad va %08x", addr);
+
+	i = dirty_search(blockno);
+  801e02:	89 f8                	mov    %edi,%eax
+  801e04:	e8 20 fa ff ff       	call   801829 <dirty_search>
+  801e09:	89 c3                	mov    %eax,%ebx
+	if (i == bc_ndirty || bc_dirty[i] != blockno)
+  801e0b:	39 05 64 2f 83 00    	cmp    %eax,0x832f64
+  801e11:	74 09                	je     801e1c <flush_block+0x38>
+  801e13:	39 3c 85 80 6f 83 00 	cmp    %edi,0x836f80(,%eax,4)
+  801e1a:	74 1d                	je     801e39 <flush_block+0x55>
+	memmove(&bc_dirty[i], &bc_dirty[i + n],
+		(bc_ndirty - i - n) * sizeof bc_dirty[0]);
+	memmove(&bc_dirty_time[i], &bc_dirty_time[i + n],
+		(bc_ndirty - i - n) * sizeof bc_dirty_time[0]);
+	bc_ndirty -= n;
+}
+  801e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1f:	5b                   	pop    %ebx
+  801e20:	5e                   	pop    %esi
+  801e21:	5f                   	pop    %edi
+  801e22:	5d                   	pop    %ebp
+  801e23:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  801e24:	52                   	push   %edx
+  801e25:	68 d2 b0 80 00       	push   $0x80b0d2
+  801e2a:	68 2a 02 00 00       	push   $0x22a
+  801e2f:	68 ac b0 80 00       	push   $0x80b0ac
+  801e34:	e8 df 48 00 00       	call   806718 <_panic>
+	if (!va_is_mapped(bc_va(blockno))) {
+  801e39:	83 ec 0c             	sub    $0xc,%esp
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801e3c:	8d 87 00 00 01 00    	lea    0x10000(%edi),%eax
+  801e42:	c1 e0 0c             	shl    $0xc,%eax
+	if (!va_is_mapped(bc_va(blockno))) {
+  801e45:	50                   	push   %eax
+  801e46:	e8 16 fc ff ff       	call   801a61 <va_is_mapped>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+		n = 1;
+  801e4e:	be 01 00 00 00       	mov    $0x1,%esi
+	if (!va_is_mapped(bc_va(blockno))) {
+  801e53:	84 c0                	test   %al,%al
+  801e55:	75 04                	jne    801e5b <flush_block+0x77>
+  801e57:	eb 60                	jmp    801eb9 <flush_block+0xd5>
+		i--;
+  801e59:	89 d3                	mov    %edx,%ebx
+	       && blockno - bc_dirty[i - 1] < BC_MAXIO)
+  801e5b:	85 db                	test   %ebx,%ebx
+  801e5d:	74 21                	je     801e80 <flush_block+0x9c>
+	while (i > 0 && bc_dirty[i - 1] == bc_dirty[i] - 1
+  801e5f:	8d 53 ff             	lea    -0x1(%ebx),%edx
+  801e62:	8b 0c 95 80 6f 83 00 	mov    0x836f80(,%edx,4),%ecx
+  801e69:	8b 04 95 84 6f 83 00 	mov    0x836f84(,%edx,4),%eax
+  801e70:	83 e8 01             	sub    $0x1,%eax
+  801e73:	39 c1                	cmp    %eax,%ecx
+  801e75:	75 09                	jne    801e80 <flush_block+0x9c>
+	       && blockno - bc_dirty[i - 1] < BC_MAXIO)
+  801e77:	89 f8                	mov    %edi,%eax
+  801e79:	29 c8                	sub    %ecx,%eax
+  801e7b:	83 f8 1f             	cmp    $0x1f,%eax
+  801e7e:	76 d9                	jbe    801e59 <flush_block+0x75>
+	n = dirty_run(i);
+  801e80:	89 d8                	mov    %ebx,%eax
+  801e82:	e8 d3 f9 ff ff       	call   80185a <dirty_run>
+  801e87:	89 c6                	mov    %eax,%esi
+	ioq_submit(&q, bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+  801e89:	8b 14 9d 80 6f 83 00 	mov    0x836f80(,%ebx,4),%edx
+  801e90:	83 ec 0c             	sub    $0xc,%esp
+  801e93:	6a 01                	push   $0x1
+  801e95:	50                   	push   %eax
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801e96:	8d 82 00 00 01 00    	lea    0x10000(%edx),%eax
+  801e9c:	c1 e0 0c             	shl    $0xc,%eax
+	ioq_submit(&q, bc_dirty[i], bc_va(bc_dirty[i]), n, 1);
+  801e9f:	50                   	push   %eax
+  801ea0:	52                   	push   %edx
+  801ea1:	8d 7d cc             	lea    -0x34(%ebp),%edi
+  801ea4:	57                   	push   %edi
+  801ea5:	e8 df f7 ff ff       	call   801689 <ioq_submit>
+	bc_write_wait(&q, 1);
+  801eaa:	83 c4 20             	add    $0x20,%esp
+  801ead:	ba 01 00 00 00       	mov    $0x1,%edx
+  801eb2:	89 f8                	mov    %edi,%eax
+  801eb4:	e8 db f9 ff ff       	call   801894 <bc_write_wait>
+	memmove(&bc_dirty[i], &bc_dirty[i + n],
+  801eb9:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  801ebc:	8d 0c bd 00 00 00 00 	lea    0x0(,%edi,4),%ecx
+  801ec3:	c1 e3 02             	shl    $0x2,%ebx
+  801ec6:	83 ec 04             	sub    $0x4,%esp
+		(bc_ndirty - i - n) * sizeof bc_dirty[0]);
+  801ec9:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801ece:	29 f8                	sub    %edi,%eax
+	memmove(&bc_dirty[i], &bc_dirty[i + n],
+  801ed0:	c1 e0 02             	shl    $0x2,%eax
+  801ed3:	50                   	push   %eax
+  801ed4:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  801ed7:	8d 81 80 6f 83 00    	lea    0x836f80(%ecx),%eax
+  801edd:	50                   	push   %eax
+  801ede:	8d 83 80 6f 83 00    	lea    0x836f80(%ebx),%eax
+  801ee4:	50                   	push   %eax
+  801ee5:	e8 73 50 00 00       	call   806f5d <memmove>
+	memmove(&bc_dirty_time[i], &bc_dirty_time[i + n],
+  801eea:	83 c4 0c             	add    $0xc,%esp
+		(bc_ndirty - i - n) * sizeof bc_dirty_time[0]);
+  801eed:	a1 64 2f 83 00       	mov    0x832f64,%eax
+  801ef2:	29 f8                	sub    %edi,%eax
+	memmove(&bc_dirty_time[i], &bc_dirty_time[i + n],
+  801ef4:	c1 e0 02             	shl    $0x2,%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  801efb:	8d 81 80 2f 83 00    	lea    0x832f80(%ecx),%eax
+  801f01:	50                   	push   %eax
+  801f02:	81 c3 80 2f 83 00    	add    $0x832f80,%ebx
+  801f08:	53                   	push   %ebx
+  801f09:	e8 4f 50 00 00       	call   806f5d <memmove>
+	bc_ndirty -= n;
+  801f0e:	29 35 64 2f 83 00    	sub    %esi,0x832f64
+  801f14:	83 c4 10             	add    $0x10,%esp
+  801f17:	e9 00 ff ff ff       	jmp    801e1c <flush_block+0x38>
+
+00801f1c <bc_evict>:
+{
+  801f1c:	55                   	push   %ebp
+  801f1d:	89 e5                	mov    %esp,%ebp
+  801f1f:	57                   	push   %edi
+  801f20:	56                   	push   %esi
+  801f21:	53                   	push   %ebx
+  801f22:	83 ec 1c             	sub    $0x1c,%esp
+	for (i = 0; i < 3 * bc_nring; i++) {
+  801f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2a:	eb 2c                	jmp    801f58 <bc_evict+0x3c>
+			else if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+  801f2c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f2f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f36:	83 ec 0c             	sub    $0xc,%esp
+  801f39:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	56                   	push   %esi
+  801f40:	6a 00                	push   $0x0
+  801f42:	56                   	push   %esi
+  801f43:	6a 00                	push   $0x0
+  801f45:	e8 18 53 00 00       	call   807262 <sys_page_map>
+  801f4a:	83 c4 20             	add    $0x20,%esp
+  801f4d:	85 c0                	test   %eax,%eax
+  801f4f:	0f 88 c4 00 00 00    	js     802019 <bc_evict+0xfd>
+	for (i = 0; i < 3 * bc_nring; i++) {
+  801f55:	83 c7 01             	add    $0x1,%edi
+  801f58:	8b 35 8c af 83 00    	mov    0x83af8c,%esi
+  801f5e:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  801f61:	39 c7                	cmp    %eax,%edi
+  801f63:	0f 83 07 01 00 00    	jae    802070 <bc_evict+0x154>
+		slot = bc_hand++ % bc_nring;
+  801f69:	a1 88 af 83 00       	mov    0x83af88,%eax
+  801f6e:	8d 48 01             	lea    0x1(%eax),%ecx
+  801f71:	89 0d 88 af 83 00    	mov    %ecx,0x83af88
+  801f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7c:	f7 f6                	div    %esi
+  801f7e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		blockno = bc_ring[slot];
+  801f81:	8b 1c 95 a0 af 83 00 	mov    0x83afa0(,%edx,4),%ebx
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  801f88:	8d b3 00 00 01 00    	lea    0x10000(%ebx),%esi
+  801f8e:	c1 e6 0c             	shl    $0xc,%esi
+		if (blockno >= bc_busy_lo && blockno < bc_busy_hi)
+  801f91:	3b 1d 84 af 83 00    	cmp    0x83af84,%ebx
+  801f97:	72 08                	jb     801fa1 <bc_evict+0x85>
+  801f99:	3b 1d 80 af 83 00    	cmp    0x83af80,%ebx
+  801f9f:	72 b4                	jb     801f55 <bc_evict+0x39>
+		if (!va_is_mapped(va))
+  801fa1:	83 ec 0c             	sub    $0xc,%esp
+  801fa4:	56                   	push   %esi
+  801fa5:	e8 b7 fa ff ff       	call   801a61 <va_is_mapped>
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	84 c0                	test   %al,%al
+  801faf:	0f 84 9b 00 00 00    	je     802050 <bc_evict+0x134>
+	if (blockno < 2)
+  801fb5:	83 fb 01             	cmp    $0x1,%ebx
+  801fb8:	76 9b                	jbe    801f55 <bc_evict+0x39>
+	return super && blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
+  801fba:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	74 12                	je     801fd5 <bc_evict+0xb9>
+  801fc3:	8b 40 04             	mov    0x4(%eax),%eax
+  801fc6:	05 ff 7f 00 00       	add    $0x7fff,%eax
+  801fcb:	c1 e8 0f             	shr    $0xf,%eax
+  801fce:	83 c0 02             	add    $0x2,%eax
+		if (bc_pinned(blockno))
+  801fd1:	39 c3                	cmp    %eax,%ebx
+  801fd3:	72 80                	jb     801f55 <bc_evict+0x39>
+	return (uvpt[PGNUM(va)] & PTE_A) != 0;
+  801fd5:	89 f0                	mov    %esi,%eax
+  801fd7:	c1 e8 0c             	shr    $0xc,%eax
+  801fda:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801fdd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		if (va_is_accessed(va)) {
+  801fe4:	a8 20                	test   $0x20,%al
+  801fe6:	74 46                	je     80202e <bc_evict+0x112>
+	uint32_t i = dirty_search(blockno);
+  801fe8:	89 d8                	mov    %ebx,%eax
+  801fea:	e8 3a f8 ff ff       	call   801829 <dirty_search>
+	return i < bc_ndirty && bc_dirty[i] == blockno;
+  801fef:	3b 05 64 2f 83 00    	cmp    0x832f64,%eax
+  801ff5:	0f 83 31 ff ff ff    	jae    801f2c <bc_evict+0x10>
+			if (block_is_dirty(blockno))
+  801ffb:	3b 1c 85 80 6f 83 00 	cmp    0x836f80(,%eax,4),%ebx
+  802002:	0f 85 24 ff ff ff    	jne    801f2c <bc_evict+0x10>
+				flush_block(va);
+  802008:	83 ec 0c             	sub    $0xc,%esp
+  80200b:	56                   	push   %esi
+  80200c:	e8 d3 fd ff ff       	call   801de4 <flush_block>
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	e9 3c ff ff ff       	jmp    801f55 <bc_evict+0x39>
+				panic("in bc_evict, sys_page_map: %e", r);
+  802019:	50                   	push   %eax
+  80201a:	68 ed b0 80 00       	push   $0x80b0ed
+  80201f:	68 ce 00 00 00       	push   $0xce
+  802024:	68 ac b0 80 00       	push   $0x80b0ac
+  802029:	e8 ea 46 00 00       	call   806718 <_panic>
+		flush_block(va);
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	56                   	push   %esi
+  802032:	e8 ad fd ff ff       	call   801de4 <flush_block>
+		if ((r = sys_page_unmap(0, va)) < 0)
+  802037:	83 c4 08             	add    $0x8,%esp
+  80203a:	56                   	push   %esi
+  80203b:	6a 00                	push   $0x0
+  80203d:	e8 6c 52 00 00       	call   8072ae <sys_page_unmap>
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	85 c0                	test   %eax,%eax
+  802047:	78 12                	js     80205b <bc_evict+0x13f>
+		bc_stat.bs_evictions++;
+  802049:	83 05 0c c4 84 00 01 	addl   $0x1,0x84c40c
+}
+  802050:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802056:	5b                   	pop    %ebx
+  802057:	5e                   	pop    %esi
+  802058:	5f                   	pop    %edi
+  802059:	5d                   	pop    %ebp
+  80205a:	c3                   	ret
+			panic("in bc_evict, sys_page_unmap: %e", r);
+  80205b:	50                   	push   %eax
+  80205c:	68 54 af 80 00       	push   $0x80af54
+  802061:	68 d3 00 00 00       	push   $0xd3
+  802066:	68 ac b0 80 00       	push   $0x80b0ac
+  80206b:	e8 a8 46 00 00       	call   806718 <_panic>
+	panic("bc_evict: every cached block is pinned");
+  802070:	83 ec 04             	sub    $0x4,%esp
+  802073:	68 74 af 80 00       	push   $0x80af74
+  802078:	68 d7 00 00 00       	push   $0xd7
+  80207d:	68 ac b0 80 00       	push   $0x80b0ac
+  802082:	e8 91 46 00 00       	call   806718 <_panic>
+
+00802087 <bc_set_budget>:
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	83 ec 08             	sub    $0x8,%esp
+  80208d:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (nblocks < BC_MINBLOCKS || nblocks > BC_MAXBLOCKS)
+  802090:	8d 50 e0             	lea    -0x20(%eax),%edx
+  802093:	81 fa e0 0f 00 00    	cmp    $0xfe0,%edx
+  802099:	77 3d                	ja     8020d8 <bc_set_budget+0x51>
+	bc_budget = nblocks;
+  80209b:	a3 38 d0 80 00       	mov    %eax,0x80d038
+	while (bc_nring > bc_budget) {
+  8020a0:	eb 22                	jmp    8020c4 <bc_set_budget+0x3d>
+		slot = bc_evict();
+  8020a2:	e8 75 fe ff ff       	call   801f1c <bc_evict>
+  8020a7:	89 c2                	mov    %eax,%edx
+		bc_ring[slot] = bc_ring[--bc_nring];
+  8020a9:	a1 8c af 83 00       	mov    0x83af8c,%eax
+  8020ae:	83 e8 01             	sub    $0x1,%eax
+  8020b1:	a3 8c af 83 00       	mov    %eax,0x83af8c
+  8020b6:	8b 04 85 a0 af 83 00 	mov    0x83afa0(,%eax,4),%eax
+  8020bd:	89 04 95 a0 af 83 00 	mov    %eax,0x83afa0(,%edx,4)
+	while (bc_nring > bc_budget) {
+  8020c4:	a1 8c af 83 00       	mov    0x83af8c,%eax
+  8020c9:	39 05 38 d0 80 00    	cmp    %eax,0x80d038
+  8020cf:	72 d1                	jb     8020a2 <bc_set_budget+0x1b>
+	return 0;
+  8020d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+		return -E_INVAL;
+  8020d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020dd:	eb f7                	jmp    8020d6 <bc_set_budget+0x4f>
+
+008020df <bc_insert>:
+{
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	53                   	push   %ebx
+  8020e3:	83 ec 04             	sub    $0x4,%esp
+  8020e6:	89 c3                	mov    %eax,%ebx
+	for (slot = 0; slot < bc_nring; slot++)
+  8020e8:	8b 15 8c af 83 00    	mov    0x83af8c,%edx
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f3:	eb 03                	jmp    8020f8 <bc_insert+0x19>
+  8020f5:	83 c0 01             	add    $0x1,%eax
+  8020f8:	39 c2                	cmp    %eax,%edx
+  8020fa:	74 0b                	je     802107 <bc_insert+0x28>
+		if (bc_ring[slot] == blockno)
+  8020fc:	39 1c 85 a0 af 83 00 	cmp    %ebx,0x83afa0(,%eax,4)
+  802103:	75 f0                	jne    8020f5 <bc_insert+0x16>
+  802105:	eb 18                	jmp    80211f <bc_insert+0x40>
+	if (bc_nring < bc_budget)
+  802107:	3b 05 38 d0 80 00    	cmp    0x80d038,%eax
+  80210d:	73 15                	jae    802124 <bc_insert+0x45>
+		slot = bc_nring++;
+  80210f:	8d 50 01             	lea    0x1(%eax),%edx
+  802112:	89 15 8c af 83 00    	mov    %edx,0x83af8c
+	bc_ring[slot] = blockno;
+  802118:	89 1c 85 a0 af 83 00 	mov    %ebx,0x83afa0(,%eax,4)
+}
+  80211f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802122:	c9                   	leave
+  802123:	c3                   	ret
+		slot = bc_evict();
+  802124:	e8 f3 fd ff ff       	call   801f1c <bc_evict>
+  802129:	eb ed                	jmp    802118 <bc_insert+0x39>
+
+0080212b <bc_read>:
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	57                   	push   %edi
+  80212f:	56                   	push   %esi
+  802130:	53                   	push   %ebx
+  802131:	83 ec 1c             	sub    $0x1c,%esp
+  802134:	89 c3                	mov    %eax,%ebx
+  802136:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802139:	89 d7                	mov    %edx,%edi
+	bc_busy_lo = blockno;
+  80213b:	a3 84 af 83 00       	mov    %eax,0x83af84
+	bc_busy_hi = blockno + nblocks;
+  802140:	8d 04 10             	lea    (%eax,%edx,1),%eax
+  802143:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802146:	a3 80 af 83 00       	mov    %eax,0x83af80
+	for (i = 0; i < nblocks; i++) {
+  80214b:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80214e:	74 42                	je     802192 <bc_read+0x67>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  802150:	89 de                	mov    %ebx,%esi
+  802152:	c1 e6 0c             	shl    $0xc,%esi
+  802155:	81 c6 00 00 00 10    	add    $0x10000000,%esi
+		bc_insert(blockno + i);
+  80215b:	89 d8                	mov    %ebx,%eax
+  80215d:	e8 7d ff ff ff       	call   8020df <bc_insert>
+		if ((r = sys_page_alloc(0, va, PTE_U | PTE_W | PTE_P)) < 0)
+  802162:	83 ec 04             	sub    $0x4,%esp
+  802165:	6a 07                	push   $0x7
+  802167:	56                   	push   %esi
+  802168:	6a 00                	push   $0x0
+  80216a:	e8 a6 50 00 00       	call   807215 <sys_page_alloc>
+  80216f:	83 c3 01             	add    $0x1,%ebx
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	79 d2                	jns    80214b <bc_read+0x20>
+			panic("allocate page 0x%p failed: %e", va, r);
+  802179:	83 ec 0c             	sub    $0xc,%esp
+  80217c:	50                   	push   %eax
+  80217d:	56                   	push   %esi
+  80217e:	68 0b b1 80 00       	push   $0x80b10b
+  802183:	68 50 01 00 00       	push   $0x150
+  802188:	68 ac b0 80 00       	push   $0x80b0ac
+  80218d:	e8 86 45 00 00       	call   806718 <_panic>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  802192:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802195:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+  80219b:	c1 e3 0c             	shl    $0xc,%ebx
+	if ((r = ioq_read(blockno, bc_va(blockno), nblocks)) < 0)
+  80219e:	83 ec 04             	sub    $0x4,%esp
+  8021a1:	57                   	push   %edi
+  8021a2:	53                   	push   %ebx
+  8021a3:	50                   	push   %eax
+  8021a4:	e8 d6 f5 ff ff       	call   80177f <ioq_read>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 2b                	js     8021db <bc_read+0xb0>
+	for (i = 0; i < nblocks; i++) {
+  8021b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b5:	39 fe                	cmp    %edi,%esi
+  8021b7:	74 53                	je     80220c <bc_read+0xe1>
+		if ((r = sys_page_map(0, va, 0, va, PTE_U | PTE_P)) < 0)
+  8021b9:	83 ec 0c             	sub    $0xc,%esp
+  8021bc:	6a 05                	push   $0x5
+  8021be:	53                   	push   %ebx
+  8021bf:	6a 00                	push   $0x0
+  8021c1:	53                   	push   %ebx
+  8021c2:	6a 00                	push   $0x0
+  8021c4:	e8 99 50 00 00       	call   807262 <sys_page_map>
+  8021c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021cf:	83 c4 20             	add    $0x20,%esp
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 21                	js     8021f7 <bc_read+0xcc>
+	for (i = 0; i < nblocks; i++) {
+  8021d6:	83 c6 01             	add    $0x1,%esi
+  8021d9:	eb da                	jmp    8021b5 <bc_read+0x8a>
+		panic("bdev read block: %d, nblocks: %d failed, %e", blockno, nblocks, r);
+  8021db:	83 ec 08             	sub    $0x8,%esp
+  8021de:	50                   	push   %eax
+  8021df:	57                   	push   %edi
+  8021e0:	ff 75 e0             	push   -0x20(%ebp)
+  8021e3:	68 9c af 80 00       	push   $0x80af9c
+  8021e8:	68 53 01 00 00       	push   $0x153
+  8021ed:	68 ac b0 80 00       	push   $0x80b0ac
+  8021f2:	e8 21 45 00 00       	call   806718 <_panic>
+			panic("in bc_read, sys_page_map: %e", r);
+  8021f7:	50                   	push   %eax
+  8021f8:	68 29 b1 80 00       	push   $0x80b129
+  8021fd:	68 5a 01 00 00       	push   $0x15a
+  802202:	68 ac b0 80 00       	push   $0x80b0ac
+  802207:	e8 0c 45 00 00       	call   806718 <_panic>
+	bc_busy_lo = bc_busy_hi = 0;
+  80220c:	c7 05 80 af 83 00 00 	movl   $0x0,0x83af80
+  802213:	00 00 00 
+  802216:	c7 05 84 af 83 00 00 	movl   $0x0,0x83af84
+  80221d:	00 00 00 
+}
+  802220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802223:	5b                   	pop    %ebx
+  802224:	5e                   	pop    %esi
+  802225:	5f                   	pop    %edi
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+
+00802228 <bc_readahead>:
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	57                   	push   %edi
+  80222c:	56                   	push   %esi
+  80222d:	53                   	push   %ebx
+  80222e:	83 ec 1c             	sub    $0x1c,%esp
+  802231:	8b 55 08             	mov    0x8(%ebp),%edx
+  802234:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	if (super && blockno + nblocks > super->s_nblocks)
+  802237:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	74 0f                	je     80224f <bc_readahead+0x27>
+  802240:	8b 40 04             	mov    0x4(%eax),%eax
+  802243:	8d 34 11             	lea    (%ecx,%edx,1),%esi
+		nblocks = super->s_nblocks - blockno;
+  802246:	89 c3                	mov    %eax,%ebx
+  802248:	29 d3                	sub    %edx,%ebx
+  80224a:	39 f0                	cmp    %esi,%eax
+  80224c:	0f 42 cb             	cmovb  %ebx,%ecx
+	nblocks = MIN(nblocks, MIN(bc_budget / 2, BC_MAXIO));
+  80224f:	a1 38 d0 80 00       	mov    0x80d038,%eax
+  802254:	d1 e8                	shr    %eax
+  802256:	bb 20 00 00 00       	mov    $0x20,%ebx
+  80225b:	39 d8                	cmp    %ebx,%eax
+  80225d:	0f 47 c3             	cmova  %ebx,%eax
+  802260:	39 c8                	cmp    %ecx,%eax
+  802262:	0f 46 c8             	cmovbe %eax,%ecx
+  802265:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	for (i = 0; i < nblocks; i += n) {
+  802268:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80226f:	8d 82 00 00 01 00    	lea    0x10000(%edx),%eax
+  802275:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802278:	89 55 08             	mov    %edx,0x8(%ebp)
+  80227b:	eb 15                	jmp    802292 <bc_readahead+0x6a>
+  80227d:	89 f7                	mov    %esi,%edi
+		if (n == 0) {
+  80227f:	85 ff                	test   %edi,%edi
+  802281:	75 4a                	jne    8022cd <bc_readahead+0xa5>
+			bc_stat.bs_hits++;
+  802283:	83 05 00 c4 84 00 01 	addl   $0x1,0x84c400
+			n = 1;
+  80228a:	bf 01 00 00 00       	mov    $0x1,%edi
+	for (i = 0; i < nblocks; i += n) {
+  80228f:	01 7d e4             	add    %edi,-0x1c(%ebp)
+  802292:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802295:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802298:	39 c8                	cmp    %ecx,%eax
+  80229a:	73 46                	jae    8022e2 <bc_readahead+0xba>
+  80229c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80229f:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+  8022a2:	c1 e3 0c             	shl    $0xc,%ebx
+  8022a5:	29 c1                	sub    %eax,%ecx
+  8022a7:	89 cf                	mov    %ecx,%edi
+		for (n = 0; i + n < nblocks; n++)
+  8022a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ae:	39 fe                	cmp    %edi,%esi
+  8022b0:	74 cd                	je     80227f <bc_readahead+0x57>
+			if (va_is_mapped(bc_va(blockno + i + n)))
+  8022b2:	83 ec 0c             	sub    $0xc,%esp
+  8022b5:	53                   	push   %ebx
+  8022b6:	e8 a6 f7 ff ff       	call   801a61 <va_is_mapped>
+  8022bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022c1:	83 c4 10             	add    $0x10,%esp
+  8022c4:	84 c0                	test   %al,%al
+  8022c6:	75 b5                	jne    80227d <bc_readahead+0x55>
+		for (n = 0; i + n < nblocks; n++)
+  8022c8:	83 c6 01             	add    $0x1,%esi
+  8022cb:	eb e1                	jmp    8022ae <bc_readahead+0x86>
+		bc_read(blockno + i, n);
+  8022cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022d0:	03 45 08             	add    0x8(%ebp),%eax
+  8022d3:	89 fa                	mov    %edi,%edx
+  8022d5:	e8 51 fe ff ff       	call   80212b <bc_read>
+		bc_stat.bs_readahead += n;
+  8022da:	01 3d 08 c4 84 00    	add    %edi,0x84c408
+  8022e0:	eb ad                	jmp    80228f <bc_readahead+0x67>
+}
+  8022e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e5:	5b                   	pop    %ebx
+  8022e6:	5e                   	pop    %esi
+  8022e7:	5f                   	pop    %edi
+  8022e8:	5d                   	pop    %ebp
+  8022e9:	c3                   	ret
+
+008022ea <bc_pgfault>:
+{
+  8022ea:	55                   	push   %ebp
+  8022eb:	89 e5                	mov    %esp,%ebp
+  8022ed:	56                   	push   %esi
+  8022ee:	53                   	push   %ebx
+  8022ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8022f2:	8b 13                	mov    (%ebx),%edx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8022f4:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+  8022fa:	89 c6                	mov    %eax,%esi
+  8022fc:	c1 ee 0c             	shr    $0xc,%esi
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8022ff:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802304:	77 5d                	ja     802363 <bc_pgfault+0x79>
+	if (super && blockno >= super->s_nblocks)
+  802306:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	74 05                	je     802314 <bc_pgfault+0x2a>
+  80230f:	3b 70 04             	cmp    0x4(%eax),%esi
+  802312:	73 6d                	jae    802381 <bc_pgfault+0x97>
+	if ((utf->utf_err & FEC_WR) && va_is_mapped(addr)) {
+  802314:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802318:	74 10                	je     80232a <bc_pgfault+0x40>
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	52                   	push   %edx
+  80231e:	e8 3e f7 ff ff       	call   801a61 <va_is_mapped>
+  802323:	83 c4 10             	add    $0x10,%esp
+  802326:	84 c0                	test   %al,%al
+  802328:	75 6c                	jne    802396 <bc_pgfault+0xac>
+	bc_stat.bs_misses++;
+  80232a:	83 05 04 c4 84 00 01 	addl   $0x1,0x84c404
+	bc_read(blockno, 1);
+  802331:	ba 01 00 00 00       	mov    $0x1,%edx
+  802336:	89 f0                	mov    %esi,%eax
+  802338:	e8 ee fd ff ff       	call   80212b <bc_read>
+	if (utf->utf_err & FEC_WR)
+  80233d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802341:	75 63                	jne    8023a6 <bc_pgfault+0xbc>
+	if (bitmap && block_is_free(blockno))
+  802343:	83 3d e0 c3 84 00 00 	cmpl   $0x0,0x84c3e0
+  80234a:	74 10                	je     80235c <bc_pgfault+0x72>
+  80234c:	83 ec 0c             	sub    $0xc,%esp
+  80234f:	56                   	push   %esi
+  802350:	e8 a6 0d 00 00       	call   8030fb <block_is_free>
+  802355:	83 c4 10             	add    $0x10,%esp
+  802358:	84 c0                	test   %al,%al
+  80235a:	75 53                	jne    8023af <bc_pgfault+0xc5>
+}
+  80235c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80235f:	5b                   	pop    %ebx
+  802360:	5e                   	pop    %esi
+  802361:	5d                   	pop    %ebp
+  802362:	c3                   	ret
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  802363:	83 ec 08             	sub    $0x8,%esp
+  802366:	ff 73 04             	push   0x4(%ebx)
+  802369:	52                   	push   %edx
+  80236a:	ff 73 28             	push   0x28(%ebx)
+  80236d:	68 c8 af 80 00       	push   $0x80afc8
+  802372:	68 02 02 00 00       	push   $0x202
+  802377:	68 ac b0 80 00       	push   $0x80b0ac
+  80237c:	e8 97 43 00 00       	call   806718 <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  802381:	56                   	push   %esi
+  802382:	68 f8 af 80 00       	push   $0x80aff8
+  802387:	68 07 02 00 00       	push   $0x207
+  80238c:	68 ac b0 80 00       	push   $0x80b0ac
+  802391:	e8 82 43 00 00       	call   806718 <_panic>
+		bc_stat.bs_hits++;
+  802396:	83 05 00 c4 84 00 01 	addl   $0x1,0x84c400
+		bc_mark_dirty(blockno);
+  80239d:	89 f0                	mov    %esi,%eax
+  80239f:	e8 37 f6 ff ff       	call   8019db <bc_mark_dirty>
+		return;
+  8023a4:	eb b6                	jmp    80235c <bc_pgfault+0x72>
+		bc_mark_dirty(blockno);
+  8023a6:	89 f0                	mov    %esi,%eax
+  8023a8:	e8 2e f6 ff ff       	call   8019db <bc_mark_dirty>
+  8023ad:	eb 94                	jmp    802343 <bc_pgfault+0x59>
+		panic("reading free block %08x\n", blockno);
+  8023af:	56                   	push   %esi
+  8023b0:	68 46 b1 80 00       	push   $0x80b146
+  8023b5:	68 1b 02 00 00       	push   $0x21b
+  8023ba:	68 ac b0 80 00       	push   $0x80b0ac
+  8023bf:	e8 54 43 00 00       	call   806718 <_panic>
+
+008023c4 <bc_fill>:
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	57                   	push   %edi
+  8023c8:	56                   	push   %esi
+  8023c9:	53                   	push   %ebx
+  8023ca:	83 ec 3c             	sub    $0x3c,%esp
+  8023cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	if (super && blockno + nblocks > super->s_nblocks)
+  8023d3:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  8023d8:	85 c0                	test   %eax,%eax
+  8023da:	74 0f                	je     8023eb <bc_fill+0x27>
+  8023dc:	8b 40 04             	mov    0x4(%eax),%eax
+  8023df:	8d 34 11             	lea    (%ecx,%edx,1),%esi
+		nblocks = super->s_nblocks - blockno;
+  8023e2:	89 c3                	mov    %eax,%ebx
+  8023e4:	29 d3                	sub    %edx,%ebx
+  8023e6:	39 f0                	cmp    %esi,%eax
+  8023e8:	0f 42 cb             	cmovb  %ebx,%ecx
+	nblocks = MIN(nblocks, MIN(bc_budget / 2, BC_MAXIO));
+  8023eb:	a1 38 d0 80 00       	mov    0x80d038,%eax
+  8023f0:	d1 e8                	shr    %eax
+  8023f2:	bb 20 00 00 00       	mov    $0x20,%ebx
+  8023f7:	39 d8                	cmp    %ebx,%eax
+  8023f9:	0f 47 c3             	cmova  %ebx,%eax
+  8023fc:	39 c8                	cmp    %ecx,%eax
+  8023fe:	0f 46 c8             	cmovbe %eax,%ecx
+  802401:	89 cf                	mov    %ecx,%edi
+  802403:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		if (!(bc_fill_busy & (1 << slot)))
+  802406:	a1 60 2f 83 00       	mov    0x832f60,%eax
+  80240b:	89 c1                	mov    %eax,%ecx
+  80240d:	83 e1 01             	and    $0x1,%ecx
+  802410:	74 23                	je     802435 <bc_fill+0x71>
+  802412:	a8 02                	test   $0x2,%al
+  802414:	74 1f                	je     802435 <bc_fill+0x71>
+  802416:	a8 04                	test   $0x4,%al
+  802418:	74 16                	je     802430 <bc_fill+0x6c>
+  80241a:	a8 08                	test   $0x8,%al
+  80241c:	74 49                	je     802467 <bc_fill+0xa3>
+		bc_readahead(blockno, nblocks);
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	57                   	push   %edi
+  802422:	52                   	push   %edx
+  802423:	e8 00 fe ff ff       	call   802228 <bc_readahead>
+		return;
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	e9 e0 01 00 00       	jmp    802610 <bc_fill+0x24c>
+	for (slot = 0; slot < NWORKERS; slot++)
+  802430:	b9 02 00 00 00       	mov    $0x2,%ecx
+	bc_fill_busy |= 1 << slot;
+  802435:	bf 01 00 00 00       	mov    $0x1,%edi
+  80243a:	d3 e7                	shl    %cl,%edi
+  80243c:	09 f8                	or     %edi,%eax
+  80243e:	a3 60 2f 83 00       	mov    %eax,0x832f60
+		bc_fill_run(blockno + i, n, (char*) FILLMAP + slot * BC_MAXIO * BLKSIZE);
+  802443:	c1 e1 11             	shl    $0x11,%ecx
+  802446:	8d 81 00 00 40 e0    	lea    -0x1fc00000(%ecx),%eax
+  80244c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	for (i = 0; i < nblocks; i += n) {
+  80244f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802456:	8d 82 00 00 01 00    	lea    0x10000(%edx),%eax
+  80245c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80245f:	89 7d c0             	mov    %edi,-0x40(%ebp)
+  802462:	89 55 08             	mov    %edx,0x8(%ebp)
+  802465:	eb 24                	jmp    80248b <bc_fill+0xc7>
+	for (slot = 0; slot < NWORKERS; slot++)
+  802467:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80246c:	eb c7                	jmp    802435 <bc_fill+0x71>
+  80246e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+		if (n == 0) {
+  802471:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802475:	75 56                	jne    8024cd <bc_fill+0x109>
+			bc_stat.bs_hits++;
+  802477:	83 05 00 c4 84 00 01 	addl   $0x1,0x84c400
+			n = 1;
+  80247e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+	for (i = 0; i < nblocks; i += n) {
+  802485:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802488:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+  80248b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80248e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802491:	39 c1                	cmp    %eax,%ecx
+  802493:	0f 83 6c 01 00 00    	jae    802605 <bc_fill+0x241>
+  802499:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80249c:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+  80249f:	c1 e3 0c             	shl    $0xc,%ebx
+  8024a2:	29 c8                	sub    %ecx,%eax
+  8024a4:	89 c7                	mov    %eax,%edi
+  8024a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		for (n = 0; i + n < nblocks; n++)
+  8024a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ae:	39 fe                	cmp    %edi,%esi
+  8024b0:	74 bf                	je     802471 <bc_fill+0xad>
+			if (va_is_mapped(bc_va(blockno + i + n)))
+  8024b2:	83 ec 0c             	sub    $0xc,%esp
+  8024b5:	53                   	push   %ebx
+  8024b6:	e8 a6 f5 ff ff       	call   801a61 <va_is_mapped>
+  8024bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	84 c0                	test   %al,%al
+  8024c6:	75 a6                	jne    80246e <bc_fill+0xaa>
+		for (n = 0; i + n < nblocks; n++)
+  8024c8:	83 c6 01             	add    $0x1,%esi
+  8024cb:	eb e1                	jmp    8024ae <bc_fill+0xea>
+		bc_fill_run(blockno + i, n, (char*) FILLMAP + slot * BC_MAXIO * BLKSIZE);
+  8024cd:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8024d0:	03 5d 08             	add    0x8(%ebp),%ebx
+	for (i = 0; i < nblocks; i++)
+  8024d3:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  8024d6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  8024d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024de:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8024e1:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		if ((r = sys_page_alloc(0, scratch + i * BLKSIZE, PTE_U | PTE_W | PTE_P)) < 0)
+  8024e4:	83 ec 04             	sub    $0x4,%esp
+  8024e7:	6a 07                	push   $0x7
+  8024e9:	57                   	push   %edi
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	e8 24 4d 00 00       	call   807215 <sys_page_alloc>
+  8024f1:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	78 59                	js     802557 <bc_fill+0x193>
+	for (i = 0; i < nblocks; i++)
+  8024fe:	83 c6 01             	add    $0x1,%esi
+  802501:	39 de                	cmp    %ebx,%esi
+  802503:	75 df                	jne    8024e4 <bc_fill+0x120>
+	writes = bc_stat.bs_writes;
+  802505:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802508:	a1 14 c4 84 00       	mov    0x84c414,%eax
+  80250d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	mutex_unlock(&fs_mu);
+  802510:	83 ec 0c             	sub    $0xc,%esp
+  802513:	68 3c c4 84 00       	push   $0x84c43c
+  802518:	e8 f0 75 00 00       	call   809b0d <mutex_unlock>
+	r = ioq_read(blockno, scratch, nblocks);
+  80251d:	83 c4 0c             	add    $0xc,%esp
+  802520:	ff 75 d8             	push   -0x28(%ebp)
+  802523:	ff 75 c8             	push   -0x38(%ebp)
+  802526:	53                   	push   %ebx
+  802527:	e8 53 f2 ff ff       	call   80177f <ioq_read>
+  80252c:	89 c6                	mov    %eax,%esi
+	mutex_lock(&fs_mu);
+  80252e:	c7 04 24 3c c4 84 00 	movl   $0x84c43c,(%esp)
+  802535:	e8 66 75 00 00       	call   809aa0 <mutex_lock>
+	if (r < 0)
+  80253a:	83 c4 10             	add    $0x10,%esp
+  80253d:	85 f6                	test   %esi,%esi
+  80253f:	78 2b                	js     80256c <bc_fill+0x1a8>
+	stale = writes != bc_stat.bs_writes;
+  802541:	8b 3d 14 c4 84 00    	mov    0x84c414,%edi
+	for (i = 0; i < nblocks; i++) {
+  802547:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80254a:	01 d8                	add    %ebx,%eax
+  80254c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80254f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802552:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802555:	eb 4f                	jmp    8025a6 <bc_fill+0x1e2>
+			panic("in bc_fill_run, sys_page_alloc: %e", r);
+  802557:	50                   	push   %eax
+  802558:	68 1c b0 80 00       	push   $0x80b01c
+  80255d:	68 8d 01 00 00       	push   $0x18d
+  802562:	68 ac b0 80 00       	push   $0x80b0ac
+  802567:	e8 ac 41 00 00       	call   806718 <_panic>
+		panic("bdev read block: %d, nblocks: %d failed, %e", blockno, nblocks, r);
+  80256c:	83 ec 08             	sub    $0x8,%esp
+  80256f:	56                   	push   %esi
+  802570:	ff 75 d8             	push   -0x28(%ebp)
+  802573:	53                   	push   %ebx
+  802574:	68 9c af 80 00       	push   $0x80af9c
+  802579:	68 93 01 00 00       	push   $0x193
+  80257e:	68 ac b0 80 00       	push   $0x80b0ac
+  802583:	e8 90 41 00 00       	call   806718 <_panic>
+			bc_stat.bs_readahead++;
+  802588:	83 05 08 c4 84 00 01 	addl   $0x1,0x84c408
+		sys_page_unmap(0, scratch + i * BLKSIZE);
+  80258f:	83 ec 08             	sub    $0x8,%esp
+  802592:	56                   	push   %esi
+  802593:	6a 00                	push   $0x0
+  802595:	e8 14 4d 00 00       	call   8072ae <sys_page_unmap>
+	for (i = 0; i < nblocks; i++) {
+  80259a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025a0:	83 c3 01             	add    $0x1,%ebx
+  8025a3:	83 c4 10             	add    $0x10,%esp
+  8025a6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8025a9:	0f 84 d6 fe ff ff    	je     802485 <bc_fill+0xc1>
+		if (!stale && !va_is_mapped(va)) {
+  8025af:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8025b2:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+  8025b5:	75 d8                	jne    80258f <bc_fill+0x1cb>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8025b7:	89 df                	mov    %ebx,%edi
+  8025b9:	c1 e7 0c             	shl    $0xc,%edi
+  8025bc:	81 c7 00 00 00 10    	add    $0x10000000,%edi
+		if (!stale && !va_is_mapped(va)) {
+  8025c2:	83 ec 0c             	sub    $0xc,%esp
+  8025c5:	57                   	push   %edi
+  8025c6:	e8 96 f4 ff ff       	call   801a61 <va_is_mapped>
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	84 c0                	test   %al,%al
+  8025d0:	75 bd                	jne    80258f <bc_fill+0x1cb>
+			bc_insert(blockno + i);
+  8025d2:	89 d8                	mov    %ebx,%eax
+  8025d4:	e8 06 fb ff ff       	call   8020df <bc_insert>
+			if ((r = sys_page_map(0, scratch + i * BLKSIZE, 0, va, PTE_U | PTE_P)) < 0)
+  8025d9:	83 ec 0c             	sub    $0xc,%esp
+  8025dc:	6a 05                	push   $0x5
+  8025de:	57                   	push   %edi
+  8025df:	6a 00                	push   $0x0
+  8025e1:	56                   	push   %esi
+  8025e2:	6a 00                	push   $0x0
+  8025e4:	e8 79 4c 00 00       	call   807262 <sys_page_map>
+  8025e9:	83 c4 20             	add    $0x20,%esp
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	79 98                	jns    802588 <bc_fill+0x1c4>
+				panic("in bc_fill_run, sys_page_map: %e", r);
+  8025f0:	50                   	push   %eax
+  8025f1:	68 40 b0 80 00       	push   $0x80b040
+  8025f6:	68 9b 01 00 00       	push   $0x19b
+  8025fb:	68 ac b0 80 00       	push   $0x80b0ac
+  802600:	e8 13 41 00 00       	call   806718 <_panic>
+	bc_fill_busy &= ~(1 << slot);
+  802605:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  802608:	f7 d7                	not    %edi
+  80260a:	21 3d 60 2f 83 00    	and    %edi,0x832f60
+}
+  802610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802613:	5b                   	pop    %ebx
+  802614:	5e                   	pop    %esi
+  802615:	5f                   	pop    %edi
+  802616:	5d                   	pop    %ebp
+  802617:	c3                   	ret
+
+00802618 <bc_adopt>:
+{
+  802618:	55                   	push   %ebp
+  802619:	89 e5                	mov    %esp,%ebp
+  80261b:	53                   	push   %ebx
+  80261c:	83 ec 04             	sub    $0x4,%esp
+  80261f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	bc_insert(blockno);
+  802622:	89 d8                	mov    %ebx,%eax
+  802624:	e8 b6 fa ff ff       	call   8020df <bc_insert>
+	if ((r = sys_page_map(0, va, 0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+  802629:	83 ec 0c             	sub    $0xc,%esp
+  80262c:	6a 07                	push   $0x7
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  80262e:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  802634:	c1 e0 0c             	shl    $0xc,%eax
+	if ((r = sys_page_map(0, va, 0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+  802637:	50                   	push   %eax
+  802638:	6a 00                	push   $0x0
+  80263a:	ff 75 0c             	push   0xc(%ebp)
+  80263d:	6a 00                	push   $0x0
+  80263f:	e8 1e 4c 00 00       	call   807262 <sys_page_map>
+  802644:	83 c4 20             	add    $0x20,%esp
+  802647:	85 c0                	test   %eax,%eax
+  802649:	78 0f                	js     80265a <bc_adopt+0x42>
+	dirty_insert(blockno, stamp);
+  80264b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80264e:	89 d8                	mov    %ebx,%eax
+  802650:	e8 f0 f2 ff ff       	call   801945 <dirty_insert>
+}
+  802655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+		panic("in bc_adopt, sys_page_map: %e", r);
+  80265a:	50                   	push   %eax
+  80265b:	68 5f b1 80 00       	push   $0x80b15f
+  802660:	68 ce 01 00 00       	push   $0x1ce
+  802665:	68 ac b0 80 00       	push   $0x80b0ac
+  80266a:	e8 a9 40 00 00       	call   806718 <_panic>
+
+0080266f <bc_new_block>:
+{
+  80266f:	55                   	push   %ebp
+  802670:	89 e5                	mov    %esp,%ebp
+  802672:	53                   	push   %ebx
+  802673:	83 ec 04             	sub    $0x4,%esp
+  802676:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	bc_insert(blockno);
+  802679:	89 d8                	mov    %ebx,%eax
+  80267b:	e8 5f fa ff ff       	call   8020df <bc_insert>
+	if ((r = sys_page_alloc(0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+  802680:	83 ec 04             	sub    $0x4,%esp
+  802683:	6a 07                	push   $0x7
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  802685:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  80268b:	c1 e0 0c             	shl    $0xc,%eax
+	if ((r = sys_page_alloc(0, bc_va(blockno), PTE_U | PTE_W | PTE_P)) < 0)
+  80268e:	50                   	push   %eax
+  80268f:	6a 00                	push   $0x0
+  802691:	e8 7f 4b 00 00       	call   807215 <sys_page_alloc>
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	78 13                	js     8026b0 <bc_new_block+0x41>
+	dirty_insert(blockno, sys_time_msec());
+  80269d:	e8 00 4e 00 00       	call   8074a2 <sys_time_msec>
+  8026a2:	89 c2                	mov    %eax,%edx
+  8026a4:	89 d8                	mov    %ebx,%eax
+  8026a6:	e8 9a f2 ff ff       	call   801945 <dirty_insert>
+}
+  8026ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+		panic("in bc_new_block, sys_page_alloc: %e", r);
+  8026b0:	50                   	push   %eax
+  8026b1:	68 64 b0 80 00       	push   $0x80b064
+  8026b6:	68 db 01 00 00       	push   $0x1db
+  8026bb:	68 ac b0 80 00       	push   $0x80b0ac
+  8026c0:	e8 53 40 00 00       	call   806718 <_panic>
+
+008026c5 <bc_init>:
+	cprintf("block cache is good\n");
+}
+
+void
+bc_init(void)
+{
+  8026c5:	55                   	push   %ebp
+  8026c6:	89 e5                	mov    %esp,%ebp
+  8026c8:	53                   	push   %ebx
+  8026c9:	81 ec 30 02 00 00    	sub    $0x230,%esp
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  8026cf:	68 ea 22 80 00       	push   $0x8022ea
+  8026d4:	e8 de 4f 00 00       	call   8076b7 <set_pgfault_handler>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  8026d9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8026e0:	e8 44 f3 ff ff       	call   801a29 <diskaddr>
+  8026e5:	83 c4 0c             	add    $0xc,%esp
+  8026e8:	68 10 01 00 00       	push   $0x110
+  8026ed:	50                   	push   %eax
+  8026ee:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 63 48 00 00       	call   806f5d <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  8026fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802701:	e8 23 f3 ff ff       	call   801a29 <diskaddr>
+  802706:	83 c4 08             	add    $0x8,%esp
+  802709:	68 7d b1 80 00       	push   $0x80b17d
+  80270e:	50                   	push   %eax
+  80270f:	e8 c3 46 00 00       	call   806dd7 <strcpy>
+	flush_block(diskaddr(1));
+  802714:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80271b:	e8 09 f3 ff ff       	call   801a29 <diskaddr>
+  802720:	89 04 24             	mov    %eax,(%esp)
+  802723:	e8 bc f6 ff ff       	call   801de4 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  802728:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80272f:	e8 f5 f2 ff ff       	call   801a29 <diskaddr>
+  802734:	89 04 24             	mov    %eax,(%esp)
+  802737:	e8 25 f3 ff ff       	call   801a61 <va_is_mapped>
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	84 c0                	test   %al,%al
+  802741:	0f 84 d1 01 00 00    	je     802918 <bc_init+0x253>
+	assert(!va_is_dirty(diskaddr(1)));
+  802747:	83 ec 0c             	sub    $0xc,%esp
+  80274a:	6a 01                	push   $0x1
+  80274c:	e8 d8 f2 ff ff       	call   801a29 <diskaddr>
+  802751:	89 04 24             	mov    %eax,(%esp)
+  802754:	e8 36 f3 ff ff       	call   801a8f <va_is_dirty>
+  802759:	83 c4 10             	add    $0x10,%esp
+  80275c:	84 c0                	test   %al,%al
+  80275e:	0f 85 cd 01 00 00    	jne    802931 <bc_init+0x26c>
+	sys_page_unmap(0, diskaddr(1));
+  802764:	83 ec 0c             	sub    $0xc,%esp
+  802767:	6a 01                	push   $0x1
+  802769:	e8 bb f2 ff ff       	call   801a29 <diskaddr>
+  80276e:	83 c4 08             	add    $0x8,%esp
+  802771:	50                   	push   %eax
+  802772:	6a 00                	push   $0x0
+  802774:	e8 35 4b 00 00       	call   8072ae <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  802779:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802780:	e8 a4 f2 ff ff       	call   801a29 <diskaddr>
+  802785:	89 04 24             	mov    %eax,(%esp)
+  802788:	e8 d4 f2 ff ff       	call   801a61 <va_is_mapped>
+  80278d:	83 c4 10             	add    $0x10,%esp
+  802790:	84 c0                	test   %al,%al
+  802792:	0f 85 b2 01 00 00    	jne    80294a <bc_init+0x285>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802798:	83 ec 0c             	sub    $0xc,%esp
+  80279b:	6a 01                	push   $0x1
+  80279d:	e8 87 f2 ff ff       	call   801a29 <diskaddr>
+  8027a2:	83 c4 08             	add    $0x8,%esp
+  8027a5:	68 7d b1 80 00       	push   $0x80b17d
+  8027aa:	50                   	push   %eax
+  8027ab:	e8 d8 46 00 00       	call   806e88 <strcmp>
+  8027b0:	83 c4 10             	add    $0x10,%esp
+  8027b3:	85 c0                	test   %eax,%eax
+  8027b5:	0f 85 a8 01 00 00    	jne    802963 <bc_init+0x29e>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  8027bb:	83 ec 0c             	sub    $0xc,%esp
+  8027be:	6a 01                	push   $0x1
+  8027c0:	e8 64 f2 ff ff       	call   801a29 <diskaddr>
+  8027c5:	83 c4 0c             	add    $0xc,%esp
+  8027c8:	68 10 01 00 00       	push   $0x110
+  8027cd:	8d 9d d8 fd ff ff    	lea    -0x228(%ebp),%ebx
+  8027d3:	53                   	push   %ebx
+  8027d4:	50                   	push   %eax
+  8027d5:	e8 83 47 00 00       	call   806f5d <memmove>
+	flush_block(diskaddr(1));
+  8027da:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8027e1:	e8 43 f2 ff ff       	call   801a29 <diskaddr>
+  8027e6:	89 04 24             	mov    %eax,(%esp)
+  8027e9:	e8 f6 f5 ff ff       	call   801de4 <flush_block>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  8027ee:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8027f5:	e8 2f f2 ff ff       	call   801a29 <diskaddr>
+  8027fa:	83 c4 0c             	add    $0xc,%esp
+  8027fd:	68 10 01 00 00       	push   $0x110
+  802802:	50                   	push   %eax
+  802803:	53                   	push   %ebx
+  802804:	e8 54 47 00 00       	call   806f5d <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  802809:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802810:	e8 14 f2 ff ff       	call   801a29 <diskaddr>
+  802815:	83 c4 08             	add    $0x8,%esp
+  802818:	68 7d b1 80 00       	push   $0x80b17d
+  80281d:	50                   	push   %eax
+  80281e:	e8 b4 45 00 00       	call   806dd7 <strcpy>
+	flush_block(diskaddr(1) + 20);
+  802823:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80282a:	e8 fa f1 ff ff       	call   801a29 <diskaddr>
+  80282f:	83 c0 14             	add    $0x14,%eax
+  802832:	89 04 24             	mov    %eax,(%esp)
+  802835:	e8 aa f5 ff ff       	call   801de4 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  80283a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802841:	e8 e3 f1 ff ff       	call   801a29 <diskaddr>
+  802846:	89 04 24             	mov    %eax,(%esp)
+  802849:	e8 13 f2 ff ff       	call   801a61 <va_is_mapped>
+  80284e:	83 c4 10             	add    $0x10,%esp
+  802851:	84 c0                	test   %al,%al
+  802853:	0f 84 23 01 00 00    	je     80297c <bc_init+0x2b7>
+	sys_page_unmap(0, diskaddr(1));
+  802859:	83 ec 0c             	sub    $0xc,%esp
+  80285c:	6a 01                	push   $0x1
+  80285e:	e8 c6 f1 ff ff       	call   801a29 <diskaddr>
+  802863:	83 c4 08             	add    $0x8,%esp
+  802866:	50                   	push   %eax
+  802867:	6a 00                	push   $0x0
+  802869:	e8 40 4a 00 00       	call   8072ae <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  80286e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802875:	e8 af f1 ff ff       	call   801a29 <diskaddr>
+  80287a:	89 04 24             	mov    %eax,(%esp)
+  80287d:	e8 df f1 ff ff       	call   801a61 <va_is_mapped>
+  802882:	83 c4 10             	add    $0x10,%esp
+  802885:	84 c0                	test   %al,%al
+  802887:	0f 85 08 01 00 00    	jne    802995 <bc_init+0x2d0>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80288d:	83 ec 0c             	sub    $0xc,%esp
+  802890:	6a 01                	push   $0x1
+  802892:	e8 92 f1 ff ff       	call   801a29 <diskaddr>
+  802897:	83 c4 08             	add    $0x8,%esp
+  80289a:	68 7d b1 80 00       	push   $0x80b17d
+  80289f:	50                   	push   %eax
+  8028a0:	e8 e3 45 00 00       	call   806e88 <strcmp>
+  8028a5:	83 c4 10             	add    $0x10,%esp
+  8028a8:	85 c0                	test   %eax,%eax
+  8028aa:	0f 85 fe 00 00 00    	jne    8029ae <bc_init+0x2e9>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  8028b0:	83 ec 0c             	sub    $0xc,%esp
+  8028b3:	6a 01                	push   $0x1
+  8028b5:	e8 6f f1 ff ff       	call   801a29 <diskaddr>
+  8028ba:	83 c4 0c             	add    $0xc,%esp
+  8028bd:	68 10 01 00 00       	push   $0x110
+  8028c2:	8d 95 d8 fd ff ff    	lea    -0x228(%ebp),%edx
+  8028c8:	52                   	push   %edx
+  8028c9:	50                   	push   %eax
+  8028ca:	e8 8e 46 00 00       	call   806f5d <memmove>
+	flush_block(diskaddr(1));
+  8028cf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8028d6:	e8 4e f1 ff ff       	call   801a29 <diskaddr>
+  8028db:	89 04 24             	mov    %eax,(%esp)
+  8028de:	e8 01 f5 ff ff       	call   801de4 <flush_block>
+	cprintf("block cache is good\n");
+  8028e3:	c7 04 24 b9 b1 80 00 	movl   $0x80b1b9,(%esp)
+  8028ea:	e8 04 3f 00 00       	call   8067f3 <cprintf>
+	check_bc();
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  8028ef:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8028f6:	e8 2e f1 ff ff       	call   801a29 <diskaddr>
+  8028fb:	83 c4 0c             	add    $0xc,%esp
+  8028fe:	68 10 01 00 00       	push   $0x110
+  802903:	50                   	push   %eax
+  802904:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80290a:	50                   	push   %eax
+  80290b:	e8 4d 46 00 00       	call   806f5d <memmove>
+}
+  802910:	83 c4 10             	add    $0x10,%esp
+  802913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  802918:	68 9f b1 80 00       	push   $0x80b19f
+  80291d:	68 2b ad 80 00       	push   $0x80ad2b
+  802922:	68 4f 02 00 00       	push   $0x24f
+  802927:	68 ac b0 80 00       	push   $0x80b0ac
+  80292c:	e8 e7 3d 00 00       	call   806718 <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  802931:	68 84 b1 80 00       	push   $0x80b184
+  802936:	68 2b ad 80 00       	push   $0x80ad2b
+  80293b:	68 50 02 00 00       	push   $0x250
+  802940:	68 ac b0 80 00       	push   $0x80b0ac
+  802945:	e8 ce 3d 00 00       	call   806718 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  80294a:	68 9e b1 80 00       	push   $0x80b19e
+  80294f:	68 2b ad 80 00       	push   $0x80ad2b
+  802954:	68 54 02 00 00       	push   $0x254
+  802959:	68 ac b0 80 00       	push   $0x80b0ac
+  80295e:	e8 b5 3d 00 00       	call   806718 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802963:	68 88 b0 80 00       	push   $0x80b088
+  802968:	68 2b ad 80 00       	push   $0x80ad2b
+  80296d:	68 57 02 00 00       	push   $0x257
+  802972:	68 ac b0 80 00       	push   $0x80b0ac
+  802977:	e8 9c 3d 00 00       	call   806718 <_panic>
+	assert(va_is_mapped(diskaddr(1)));
+  80297c:	68 9f b1 80 00       	push   $0x80b19f
+  802981:	68 2b ad 80 00       	push   $0x80ad2b
+  802986:	68 68 02 00 00       	push   $0x268
+  80298b:	68 ac b0 80 00       	push   $0x80b0ac
+  802990:	e8 83 3d 00 00       	call   806718 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  802995:	68 9e b1 80 00       	push   $0x80b19e
+  80299a:	68 2b ad 80 00       	push   $0x80ad2b
+  80299f:	68 70 02 00 00       	push   $0x270
+  8029a4:	68 ac b0 80 00       	push   $0x80b0ac
+  8029a9:	e8 6a 3d 00 00       	call   806718 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8029ae:	68 88 b0 80 00       	push   $0x80b088
+  8029b3:	68 2b ad 80 00       	push   $0x80ad2b
+  8029b8:	68 73 02 00 00       	push   $0x273
+  8029bd:	68 ac b0 80 00       	push   $0x80b0ac
+  8029c2:	e8 51 3d 00 00       	call   806718 <_panic>
+
+008029c7 <find_free_block>:
+// Return the first free block at or after 'start', wrapping around at
+// the end of the disk, or -E_NO_DISK if there is none.  Words with no
+// free blocks are skipped whole.
+static int
+find_free_block(uint32_t start)
+{
+  8029c7:	55                   	push   %ebp
+  8029c8:	89 e5                	mov    %esp,%ebp
+  8029ca:	57                   	push   %edi
+  8029cb:	56                   	push   %esi
+  8029cc:	53                   	push   %ebx
+  8029cd:	83 ec 04             	sub    $0x4,%esp
+  8029d0:	89 c1                	mov    %eax,%ecx
+	uint32_t i, n, nwords, bits, blockno;
+
+	nwords = (super->s_nblocks + 31) / 32;
+  8029d2:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  8029d7:	8b 40 04             	mov    0x4(%eax),%eax
+  8029da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8029dd:	8d 58 1f             	lea    0x1f(%eax),%ebx
+  8029e0:	c1 eb 05             	shr    $0x5,%ebx
+	if (start >= super->s_nblocks)
+		start = 0;
+  8029e3:	39 c1                	cmp    %eax,%ecx
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ea:	0f 43 c8             	cmovae %eax,%ecx
+	i = start / 32;
+  8029ed:	89 c8                	mov    %ecx,%eax
+  8029ef:	c1 e8 05             	shr    $0x5,%eax
+	bits = bitmap[i] & (~0U << (start % 32));
+  8029f2:	8b 35 e0 c3 84 00    	mov    0x84c3e0,%esi
+  8029f8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8029fd:	d3 e2                	shl    %cl,%edx
+  8029ff:	23 14 86             	and    (%esi,%eax,4),%edx
+	// nwords + 1 words so that the first word is seen in full too.
+	for (n = 0; n <= nwords; n++) {
+  802a02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a07:	eb 18                	jmp    802a21 <find_free_block+0x5a>
+		if (bits) {
+			blockno = i * 32 + bsf(bits);
+			if (blockno < super->s_nblocks)
+				return blockno;
+		}
+		i = (i + 1) % nwords;
+  802a09:	83 c0 01             	add    $0x1,%eax
+  802a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a11:	f7 f3                	div    %ebx
+  802a13:	89 d0                	mov    %edx,%eax
+		bits = bitmap[i];
+  802a15:	8b 14 96             	mov    (%esi,%edx,4),%edx
+	for (n = 0; n <= nwords; n++) {
+  802a18:	8d 79 01             	lea    0x1(%ecx),%edi
+  802a1b:	39 cb                	cmp    %ecx,%ebx
+  802a1d:	74 1b                	je     802a3a <find_free_block+0x73>
+  802a1f:	89 f9                	mov    %edi,%ecx
+		if (bits) {
+  802a21:	85 d2                	test   %edx,%edx
+  802a23:	74 e4                	je     802a09 <find_free_block+0x42>
+// Index of the lowest set bit in x, which must not be 0.
+static inline uint32_t
+bsf(uint32_t x)
+{
+	uint32_t r;
+	asm("bsfl %1, %0" : "=r" (r) : "rm" (x) : "cc");
+  802a25:	0f bc d2             	bsf    %edx,%edx
+			blockno = i * 32 + bsf(bits);
+  802a28:	89 c7                	mov    %eax,%edi
+  802a2a:	c1 e7 05             	shl    $0x5,%edi
+  802a2d:	01 d7                	add    %edx,%edi
+			if (blockno < super->s_nblocks)
+  802a2f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a32:	39 d7                	cmp    %edx,%edi
+  802a34:	73 d3                	jae    802a09 <find_free_block+0x42>
+				return blockno;
+  802a36:	89 f8                	mov    %edi,%eax
+  802a38:	eb 05                	jmp    802a3f <find_free_block+0x78>
+	}
+	return -E_NO_DISK;
+  802a3a:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+}
+  802a3f:	83 c4 04             	add    $0x4,%esp
+  802a42:	5b                   	pop    %ebx
+  802a43:	5e                   	pop    %esi
+  802a44:	5f                   	pop    %edi
+  802a45:	5d                   	pop    %ebp
+  802a46:	c3                   	ret
+
+00802a47 <delayed_lookup>:
+}
+
+// Return the index of the pending block for filebno of f, or -1.
+static int
+delayed_lookup(struct File *f, uint32_t filebno)
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	53                   	push   %ebx
+  802a4b:	89 c1                	mov    %eax,%ecx
+  802a4d:	89 d3                	mov    %edx,%ebx
+	int i;
+
+	for (i = delayed_hash[DHASH(f, filebno)]; i >= 0; i = delayed[i].d_next)
+  802a4f:	c1 e8 08             	shr    $0x8,%eax
+  802a52:	01 d0                	add    %edx,%eax
+  802a54:	0f b6 c0             	movzbl %al,%eax
+  802a57:	8b 04 85 60 00 84 00 	mov    0x840060(,%eax,4),%eax
+  802a5e:	eb 0a                	jmp    802a6a <delayed_lookup+0x23>
+  802a60:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802a63:	8b 04 85 68 04 84 00 	mov    0x840468(,%eax,4),%eax
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	78 17                	js     802a85 <delayed_lookup+0x3e>
+		if (delayed[i].d_file == f && delayed[i].d_filebno == filebno)
+  802a6e:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802a71:	39 0c 95 60 04 84 00 	cmp    %ecx,0x840460(,%edx,4)
+  802a78:	75 e6                	jne    802a60 <delayed_lookup+0x19>
+  802a7a:	39 1c 95 64 04 84 00 	cmp    %ebx,0x840464(,%edx,4)
+  802a81:	75 dd                	jne    802a60 <delayed_lookup+0x19>
+  802a83:	eb 05                	jmp    802a8a <delayed_lookup+0x43>
+			return i;
+	return -1;
+  802a85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  802a8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <readahead_lookup>:
+
+// Find the read-ahead state of f, recycling the least recently used
+// entry if f has none.
+static struct Readahead*
+readahead_lookup(struct File *f)
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	53                   	push   %ebx
+  802a93:	89 c1                	mov    %eax,%ecx
+	struct Readahead *ra, *lru;
+
+	lru = &ratab[0];
+  802a95:	b8 c0 ff 83 00       	mov    $0x83ffc0,%eax
+	for (ra = ratab; ra < ratab + NREADAHEAD; ra++) {
+  802a9a:	89 c2                	mov    %eax,%edx
+		if (ra->ra_file == f)
+  802a9c:	39 0a                	cmp    %ecx,(%edx)
+  802a9e:	74 3b                	je     802adb <readahead_lookup+0x4c>
+			goto out;
+		if (ra->ra_stamp < lru->ra_stamp)
+  802aa0:	8b 58 0c             	mov    0xc(%eax),%ebx
+  802aa3:	39 5a 0c             	cmp    %ebx,0xc(%edx)
+  802aa6:	0f 42 c2             	cmovb  %edx,%eax
+	for (ra = ratab; ra < ratab + NREADAHEAD; ra++) {
+  802aa9:	83 c2 10             	add    $0x10,%edx
+  802aac:	81 fa 40 00 84 00    	cmp    $0x840040,%edx
+  802ab2:	75 e8                	jne    802a9c <readahead_lookup+0xd>
+			lru = ra;
+	}
+	ra = lru;
+	ra->ra_file = f;
+  802ab4:	89 08                	mov    %ecx,(%eax)
+	ra->ra_pos = 0;
+  802ab6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	ra->ra_window = 0;
+  802abd:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+out:
+	ra->ra_stamp = ++ra_clock;
+  802ac4:	8b 0d a0 ff 83 00    	mov    0x83ffa0,%ecx
+  802aca:	8d 51 01             	lea    0x1(%ecx),%edx
+  802acd:	89 15 a0 ff 83 00    	mov    %edx,0x83ffa0
+  802ad3:	89 50 0c             	mov    %edx,0xc(%eax)
+	return ra;
+}
+  802ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad9:	c9                   	leave
+  802ada:	c3                   	ret
+  802adb:	89 d0                	mov    %edx,%eax
+  802add:	eb e5                	jmp    802ac4 <readahead_lookup+0x35>
+
+00802adf <free_run>:
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	57                   	push   %edi
+  802ae3:	56                   	push   %esi
+  802ae4:	53                   	push   %ebx
+  802ae5:	83 ec 1c             	sub    $0x1c,%esp
+	uint32_t end = blockno + n, w, lo, hi, mask, newly;
+  802ae8:	8d 34 10             	lea    (%eax,%edx,1),%esi
+  802aeb:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	if (blockno == 0)
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	74 0c                	je     802afe <free_run+0x1f>
+  802af2:	8b 3d 88 36 84 00    	mov    0x843688,%edi
+  802af8:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  802afc:	eb 32                	jmp    802b30 <free_run+0x51>
+		panic("attempt to free zero block");
+  802afe:	83 ec 04             	sub    $0x4,%esp
+  802b01:	68 ce b1 80 00       	push   $0x80b1ce
+  802b06:	6a 43                	push   $0x43
+  802b08:	68 e9 b1 80 00       	push   $0x80b1e9
+  802b0d:	e8 06 3c 00 00       	call   806718 <_panic>
+		for (newly = mask & ~bitmap[w]; newly; newly &= newly - 1)
+  802b12:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b15:	21 f8                	and    %edi,%eax
+  802b17:	89 d7                	mov    %edx,%edi
+  802b19:	c6 45 e7 01          	movb   $0x1,-0x19(%ebp)
+  802b1d:	8d 57 01             	lea    0x1(%edi),%edx
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	75 ee                	jne    802b12 <free_run+0x33>
+		bitmap[w] |= mask;
+  802b24:	09 cb                	or     %ecx,%ebx
+  802b26:	89 1e                	mov    %ebx,(%esi)
+		blockno = w * 32 + hi;
+  802b28:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b2b:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802b2e:	01 d8                	add    %ebx,%eax
+	while (blockno < end) {
+  802b30:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802b33:	39 f0                	cmp    %esi,%eax
+  802b35:	73 57                	jae    802b8e <free_run+0xaf>
+		w = blockno / 32;
+  802b37:	89 c3                	mov    %eax,%ebx
+  802b39:	c1 eb 05             	shr    $0x5,%ebx
+		lo = blockno % 32;
+  802b3c:	89 c6                	mov    %eax,%esi
+  802b3e:	83 e6 1f             	and    $0x1f,%esi
+		hi = MIN(end - w * 32, 32);
+  802b41:	83 e0 e0             	and    $0xffffffe0,%eax
+  802b44:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802b47:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b4a:	29 c2                	sub    %eax,%edx
+  802b4c:	b8 20 00 00 00       	mov    $0x20,%eax
+  802b51:	39 c2                	cmp    %eax,%edx
+  802b53:	0f 46 c2             	cmovbe %edx,%eax
+  802b56:	89 c1                	mov    %eax,%ecx
+  802b58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		mask = (hi == 32 ? ~0U : (1U << hi) - 1) & ~((1U << lo) - 1);
+  802b5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b60:	83 fa 1f             	cmp    $0x1f,%edx
+  802b63:	77 0a                	ja     802b6f <free_run+0x90>
+  802b65:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b6a:	d3 e0                	shl    %cl,%eax
+  802b6c:	83 e8 01             	sub    $0x1,%eax
+  802b6f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802b74:	89 f1                	mov    %esi,%ecx
+  802b76:	d3 e2                	shl    %cl,%edx
+  802b78:	89 d1                	mov    %edx,%ecx
+  802b7a:	21 c1                	and    %eax,%ecx
+		for (newly = mask & ~bitmap[w]; newly; newly &= newly - 1)
+  802b7c:	a1 e0 c3 84 00       	mov    0x84c3e0,%eax
+  802b81:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+  802b84:	8b 1e                	mov    (%esi),%ebx
+  802b86:	89 d8                	mov    %ebx,%eax
+  802b88:	f7 d0                	not    %eax
+  802b8a:	21 c8                	and    %ecx,%eax
+  802b8c:	eb 8f                	jmp    802b1d <free_run+0x3e>
+  802b8e:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+  802b92:	74 06                	je     802b9a <free_run+0xbb>
+  802b94:	89 3d 88 36 84 00    	mov    %edi,0x843688
+}
+  802b9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b9d:	5b                   	pop    %ebx
+  802b9e:	5e                   	pop    %esi
+  802b9f:	5f                   	pop    %edi
+  802ba0:	5d                   	pop    %ebp
+  802ba1:	c3                   	ret
+
+00802ba2 <alloc_block_near>:
+{
+  802ba2:	55                   	push   %ebp
+  802ba3:	89 e5                	mov    %esp,%ebp
+  802ba5:	56                   	push   %esi
+  802ba6:	53                   	push   %ebx
+	if (super == 0) {
+  802ba7:	83 3d e4 c3 84 00 00 	cmpl   $0x0,0x84c3e4
+  802bae:	74 66                	je     802c16 <alloc_block_near+0x74>
+	if (!delalloc_flushing && nfree_blocks < delayed_reserve(ndelayed) + 1)
+  802bb0:	80 3d 80 36 84 00 00 	cmpb   $0x0,0x843680
+  802bb7:	75 22                	jne    802bdb <alloc_block_near+0x39>
+  802bb9:	8b 15 84 36 84 00    	mov    0x843684,%edx
+	if (n == 0)
+  802bbf:	85 d2                	test   %edx,%edx
+  802bc1:	74 0d                	je     802bd0 <alloc_block_near+0x2e>
+	return n + (n + NINDIRECT - 1) / NINDIRECT + 1;
+  802bc3:	8d 8a ff 03 00 00    	lea    0x3ff(%edx),%ecx
+  802bc9:	c1 e9 0a             	shr    $0xa,%ecx
+  802bcc:	8d 54 0a 01          	lea    0x1(%edx,%ecx,1),%edx
+	if (!delalloc_flushing && nfree_blocks < delayed_reserve(ndelayed) + 1)
+  802bd0:	83 c2 01             	add    $0x1,%edx
+  802bd3:	39 15 88 36 84 00    	cmp    %edx,0x843688
+  802bd9:	72 52                	jb     802c2d <alloc_block_near+0x8b>
+	if ((r = find_free_block(hint)) < 0)
+  802bdb:	e8 e7 fd ff ff       	call   8029c7 <find_free_block>
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	78 2b                	js     802c0f <alloc_block_near+0x6d>
+	bitmap[r / 32] &= ~(1 << (r % 32));
+  802be4:	8d 50 1f             	lea    0x1f(%eax),%edx
+  802be7:	0f 49 d0             	cmovns %eax,%edx
+  802bea:	c1 fa 05             	sar    $0x5,%edx
+  802bed:	8b 35 e0 c3 84 00    	mov    0x84c3e0,%esi
+  802bf3:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+  802bf8:	89 c1                	mov    %eax,%ecx
+  802bfa:	d3 c3                	rol    %cl,%ebx
+  802bfc:	21 1c 96             	and    %ebx,(%esi,%edx,4)
+	nfree_blocks--;
+  802bff:	83 2d 88 36 84 00 01 	subl   $0x1,0x843688
+	alloc_cursor = r + 1;
+  802c06:	8d 50 01             	lea    0x1(%eax),%edx
+  802c09:	89 15 60 34 84 00    	mov    %edx,0x843460
+}
+  802c0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c12:	5b                   	pop    %ebx
+  802c13:	5e                   	pop    %esi
+  802c14:	5d                   	pop    %ebp
+  802c15:	c3                   	ret
+		cprintf("Thereis no super block.\n");
+  802c16:	83 ec 0c             	sub    $0xc,%esp
+  802c19:	68 f1 b1 80 00       	push   $0x80b1f1
+  802c1e:	e8 d0 3b 00 00       	call   8067f3 <cprintf>
+		return -E_NO_DISK;
+  802c23:	83 c4 10             	add    $0x10,%esp
+  802c26:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  802c2b:	eb e2                	jmp    802c0f <alloc_block_near+0x6d>
+		return -E_NO_DISK;
+  802c2d:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  802c32:	eb db                	jmp    802c0f <alloc_block_near+0x6d>
+
+00802c34 <dir_index>:
+	if (dir->f_dirindex == 0)
+  802c34:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+  802c3a:	85 c0                	test   %eax,%eax
+  802c3c:	74 1f                	je     802c5d <dir_index+0x29>
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	83 ec 14             	sub    $0x14,%esp
+	di = diskaddr(dir->f_dirindex);
+  802c44:	50                   	push   %eax
+  802c45:	e8 df ed ff ff       	call   801a29 <diskaddr>
+	return di->di_magic == DIRINDEX_MAGIC ? di : 0;
+  802c4a:	83 c4 10             	add    $0x10,%esp
+  802c4d:	81 38 45 52 54 48    	cmpl   $0x48545245,(%eax)
+  802c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c58:	0f 45 c2             	cmovne %edx,%eax
+}
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+		return 0;
+  802c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c62:	c3                   	ret
+
+00802c63 <delayed_remove>:
+{
+  802c63:	55                   	push   %ebp
+  802c64:	89 e5                	mov    %esp,%ebp
+  802c66:	57                   	push   %edi
+  802c67:	56                   	push   %esi
+  802c68:	53                   	push   %ebx
+  802c69:	83 ec 0c             	sub    $0xc,%esp
+  802c6c:	89 c3                	mov    %eax,%ebx
+	for (pp = &delayed_hash[DHASH(delayed[i].d_file, delayed[i].d_filebno)];
+  802c6e:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802c71:	c1 e2 02             	shl    $0x2,%edx
+  802c74:	8b 82 60 04 84 00    	mov    0x840460(%edx),%eax
+  802c7a:	c1 e8 08             	shr    $0x8,%eax
+  802c7d:	03 82 64 04 84 00    	add    0x840464(%edx),%eax
+  802c83:	0f b6 c0             	movzbl %al,%eax
+  802c86:	8d 0c 85 60 00 84 00 	lea    0x840060(,%eax,4),%ecx
+  802c8d:	8b 04 85 60 00 84 00 	mov    0x840060(,%eax,4),%eax
+  802c94:	eb 16                	jmp    802cac <delayed_remove+0x49>
+	     *pp != i; pp = &delayed[*pp].d_next)
+  802c96:	8d 14 00             	lea    (%eax,%eax,1),%edx
+  802c99:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802c9c:	8d 0c 8d 68 04 84 00 	lea    0x840468(,%ecx,4),%ecx
+  802ca3:	01 c2                	add    %eax,%edx
+  802ca5:	8b 04 95 68 04 84 00 	mov    0x840468(,%edx,4),%eax
+  802cac:	39 d8                	cmp    %ebx,%eax
+  802cae:	75 e6                	jne    802c96 <delayed_remove+0x33>
+	*pp = delayed[i].d_next;
+  802cb0:	8d 34 5b             	lea    (%ebx,%ebx,2),%esi
+  802cb3:	c1 e6 02             	shl    $0x2,%esi
+  802cb6:	8b 86 68 04 84 00    	mov    0x840468(%esi),%eax
+  802cbc:	89 01                	mov    %eax,(%ecx)
+	sys_page_unmap(0, delayed_va(i));
+  802cbe:	83 ec 08             	sub    $0x8,%esp
+	return (char*) (DELAYMAP + i * BLKSIZE);
+  802cc1:	89 d8                	mov    %ebx,%eax
+  802cc3:	c1 e0 0c             	shl    $0xc,%eax
+  802cc6:	2d 00 00 00 20       	sub    $0x20000000,%eax
+	sys_page_unmap(0, delayed_va(i));
+  802ccb:	50                   	push   %eax
+  802ccc:	6a 00                	push   $0x0
+  802cce:	e8 db 45 00 00       	call   8072ae <sys_page_unmap>
+	delayed[i].d_file = 0;
+  802cd3:	c7 86 60 04 84 00 00 	movl   $0x0,0x840460(%esi)
+  802cda:	00 00 00 
+	delayed[i].d_next = delayed_free;
+  802cdd:	a1 44 00 84 00       	mov    0x840044,%eax
+  802ce2:	89 86 68 04 84 00    	mov    %eax,0x840468(%esi)
+	delayed_free = i;
+  802ce8:	89 1d 44 00 84 00    	mov    %ebx,0x840044
+	ndelayed--;
+  802cee:	83 2d 84 36 84 00 01 	subl   $0x1,0x843684
+}
+  802cf5:	83 c4 10             	add    $0x10,%esp
+  802cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cfb:	5b                   	pop    %ebx
+  802cfc:	5e                   	pop    %esi
+  802cfd:	5f                   	pop    %edi
+  802cfe:	5d                   	pop    %ebp
+  802cff:	c3                   	ret
+
+00802d00 <free_runs_apply>:
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	57                   	push   %edi
+  802d04:	56                   	push   %esi
+  802d05:	53                   	push   %ebx
+  802d06:	83 ec 0c             	sub    $0xc,%esp
+	for (i = 0; i < nfreeruns; i++) {
+  802d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d0e:	eb 55                	jmp    802d65 <free_runs_apply+0x65>
+		bc_discard(freeruns[i].fr_start, freeruns[i].fr_len);
+  802d10:	83 ec 08             	sub    $0x8,%esp
+  802d13:	ff 34 dd 84 34 84 00 	push   0x843484(,%ebx,8)
+  802d1a:	ff 34 dd 80 34 84 00 	push   0x843480(,%ebx,8)
+  802d21:	e8 c8 ef ff ff       	call   801cee <bc_discard>
+		free_run(freeruns[i].fr_start, freeruns[i].fr_len);
+  802d26:	8b 3c dd 84 34 84 00 	mov    0x843484(,%ebx,8),%edi
+  802d2d:	8b 34 dd 80 34 84 00 	mov    0x843480(,%ebx,8),%esi
+  802d34:	89 fa                	mov    %edi,%edx
+  802d36:	89 f0                	mov    %esi,%eax
+  802d38:	e8 a2 fd ff ff       	call   802adf <free_run>
+		freed_lo = MIN(freed_lo, freeruns[i].fr_start);
+  802d3d:	a1 3c d0 80 00       	mov    0x80d03c,%eax
+  802d42:	39 f0                	cmp    %esi,%eax
+  802d44:	0f 47 c6             	cmova  %esi,%eax
+  802d47:	a3 3c d0 80 00       	mov    %eax,0x80d03c
+		freed_hi = MAX(freed_hi, freeruns[i].fr_start + freeruns[i].fr_len);
+  802d4c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d4f:	8b 15 64 34 84 00    	mov    0x843464,%edx
+  802d55:	39 d0                	cmp    %edx,%eax
+  802d57:	0f 42 c2             	cmovb  %edx,%eax
+  802d5a:	a3 64 34 84 00       	mov    %eax,0x843464
+	for (i = 0; i < nfreeruns; i++) {
+  802d5f:	83 c3 01             	add    $0x1,%ebx
+  802d62:	83 c4 10             	add    $0x10,%esp
+  802d65:	3b 1d 68 34 84 00    	cmp    0x843468,%ebx
+  802d6b:	72 a3                	jb     802d10 <free_runs_apply+0x10>
+	nfreeruns = 0;
+  802d6d:	c7 05 68 34 84 00 00 	movl   $0x0,0x843468
+  802d74:	00 00 00 
+}
+  802d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	5f                   	pop    %edi
+  802d7d:	5d                   	pop    %ebp
+  802d7e:	c3                   	ret
+
+00802d7f <free_runs_add>:
+{
+  802d7f:	55                   	push   %ebp
+  802d80:	89 e5                	mov    %esp,%ebp
+  802d82:	56                   	push   %esi
+  802d83:	53                   	push   %ebx
+  802d84:	89 c3                	mov    %eax,%ebx
+	if (nfreeruns > 0
+  802d86:	a1 68 34 84 00       	mov    0x843468,%eax
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	74 1c                	je     802dab <free_runs_add+0x2c>
+	    && freeruns[nfreeruns - 1].fr_start + freeruns[nfreeruns - 1].fr_len == blockno) {
+  802d8f:	8d 50 ff             	lea    -0x1(%eax),%edx
+  802d92:	8b 0c d5 84 34 84 00 	mov    0x843484(,%edx,8),%ecx
+  802d99:	89 ce                	mov    %ecx,%esi
+  802d9b:	03 34 d5 80 34 84 00 	add    0x843480(,%edx,8),%esi
+  802da2:	39 de                	cmp    %ebx,%esi
+  802da4:	74 29                	je     802dcf <free_runs_add+0x50>
+	if (nfreeruns == NFREERUNS)
+  802da6:	83 f8 40             	cmp    $0x40,%eax
+  802da9:	74 30                	je     802ddb <free_runs_add+0x5c>
+	freeruns[nfreeruns].fr_start = blockno;
+  802dab:	a1 68 34 84 00       	mov    0x843468,%eax
+  802db0:	89 1c c5 80 34 84 00 	mov    %ebx,0x843480(,%eax,8)
+	freeruns[nfreeruns++].fr_len = 1;
+  802db7:	8d 50 01             	lea    0x1(%eax),%edx
+  802dba:	89 15 68 34 84 00    	mov    %edx,0x843468
+  802dc0:	c7 04 c5 84 34 84 00 	movl   $0x1,0x843484(,%eax,8)
+  802dc7:	01 00 00 00 
+}
+  802dcb:	5b                   	pop    %ebx
+  802dcc:	5e                   	pop    %esi
+  802dcd:	5d                   	pop    %ebp
+  802dce:	c3                   	ret
+		freeruns[nfreeruns - 1].fr_len++;
+  802dcf:	83 c1 01             	add    $0x1,%ecx
+  802dd2:	89 0c d5 84 34 84 00 	mov    %ecx,0x843484(,%edx,8)
+		return;
+  802dd9:	eb f0                	jmp    802dcb <free_runs_add+0x4c>
+		free_runs_apply();
+  802ddb:	e8 20 ff ff ff       	call   802d00 <free_runs_apply>
+  802de0:	eb c9                	jmp    802dab <free_runs_add+0x2c>
+
+00802de2 <free_runs_flush>:
+{
+  802de2:	55                   	push   %ebp
+  802de3:	89 e5                	mov    %esp,%ebp
+  802de5:	53                   	push   %ebx
+  802de6:	83 ec 04             	sub    $0x4,%esp
+	free_runs_apply();
+  802de9:	e8 12 ff ff ff       	call   802d00 <free_runs_apply>
+	if (freed_lo >= freed_hi)
+  802dee:	8b 1d 3c d0 80 00    	mov    0x80d03c,%ebx
+  802df4:	3b 1d 64 34 84 00    	cmp    0x843464,%ebx
+  802dfa:	73 42                	jae    802e3e <free_runs_flush+0x5c>
+	for (b = freed_lo / BLKBITSIZE; b <= (freed_hi - 1) / BLKBITSIZE; b++)
+  802dfc:	c1 eb 0f             	shr    $0xf,%ebx
+  802dff:	eb 1a                	jmp    802e1b <free_runs_flush+0x39>
+		flush_block(diskaddr(2 + b));
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	8d 43 02             	lea    0x2(%ebx),%eax
+  802e07:	50                   	push   %eax
+  802e08:	e8 1c ec ff ff       	call   801a29 <diskaddr>
+  802e0d:	89 04 24             	mov    %eax,(%esp)
+  802e10:	e8 cf ef ff ff       	call   801de4 <flush_block>
+	for (b = freed_lo / BLKBITSIZE; b <= (freed_hi - 1) / BLKBITSIZE; b++)
+  802e15:	83 c3 01             	add    $0x1,%ebx
+  802e18:	83 c4 10             	add    $0x10,%esp
+  802e1b:	a1 64 34 84 00       	mov    0x843464,%eax
+  802e20:	83 e8 01             	sub    $0x1,%eax
+  802e23:	c1 e8 0f             	shr    $0xf,%eax
+  802e26:	39 d8                	cmp    %ebx,%eax
+  802e28:	73 d7                	jae    802e01 <free_runs_flush+0x1f>
+	freed_lo = ~0;
+  802e2a:	c7 05 3c d0 80 00 ff 	movl   $0xffffffff,0x80d03c
+  802e31:	ff ff ff 
+	freed_hi = 0;
+  802e34:	c7 05 64 34 84 00 00 	movl   $0x0,0x843464
+  802e3b:	00 00 00 
+}
+  802e3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e41:	c9                   	leave
+  802e42:	c3                   	ret
+
+00802e43 <file_truncate_blocks>:
+// blocks that no longer map any block below new_nblocks are freed as
+// well.  The caller applies the result with free_runs_flush.
+// Do not change f->f_size.
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	57                   	push   %edi
+  802e47:	56                   	push   %esi
+  802e48:	53                   	push   %ebx
+  802e49:	83 ec 2c             	sub    $0x2c,%esp
+  802e4c:	89 c7                	mov    %eax,%edi
+  802e4e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802e51:	89 d0                	mov    %edx,%eax
+	uint32_t i, base, old_nblocks, new_nblocks, *dindirect;
+	bool keep;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  802e53:	8b 97 80 00 00 00    	mov    0x80(%edi),%edx
+  802e59:	8d 8a fe 1f 00 00    	lea    0x1ffe(%edx),%ecx
+  802e5f:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  802e65:	0f 48 d1             	cmovs  %ecx,%edx
+  802e68:	c1 fa 0c             	sar    $0xc,%edx
+  802e6b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  802e6e:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  802e74:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802e79:	0f 48 c2             	cmovs  %edx,%eax
+  802e7c:	c1 f8 0c             	sar    $0xc,%eax
+  802e7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < NDELAYED && ndelayed > 0; i++)
+  802e82:	bb 60 04 84 00       	mov    $0x840460,%ebx
+  802e87:	be 00 00 00 00       	mov    $0x0,%esi
+  802e8c:	eb 0e                	jmp    802e9c <file_truncate_blocks+0x59>
+  802e8e:	83 c6 01             	add    $0x1,%esi
+  802e91:	83 c3 0c             	add    $0xc,%ebx
+  802e94:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+  802e9a:	74 42                	je     802ede <file_truncate_blocks+0x9b>
+  802e9c:	83 3d 84 36 84 00 00 	cmpl   $0x0,0x843684
+  802ea3:	74 39                	je     802ede <file_truncate_blocks+0x9b>
+		if (delayed[i].d_file == f && delayed[i].d_filebno >= from)
+  802ea5:	3b 3b                	cmp    (%ebx),%edi
+  802ea7:	75 e5                	jne    802e8e <file_truncate_blocks+0x4b>
+  802ea9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eac:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802eaf:	72 dd                	jb     802e8e <file_truncate_blocks+0x4b>
+			delayed_remove(i);
+  802eb1:	89 f0                	mov    %esi,%eax
+  802eb3:	e8 ab fd ff ff       	call   802c63 <delayed_remove>
+  802eb8:	eb d4                	jmp    802e8e <file_truncate_blocks+0x4b>
+	delalloc_drop(f, new_nblocks);
+	// struct File is packed, so f_direct is indexed in place rather
+	// than handed to free_ptrs.
+	for (i = new_nblocks; i < MIN(old_nblocks, NDIRECT); i++)
+  802eba:	83 c3 01             	add    $0x1,%ebx
+  802ebd:	39 f3                	cmp    %esi,%ebx
+  802ebf:	73 32                	jae    802ef3 <file_truncate_blocks+0xb0>
+		if (f->f_direct[i]) {
+  802ec1:	8b 84 9f 88 00 00 00 	mov    0x88(%edi,%ebx,4),%eax
+  802ec8:	85 c0                	test   %eax,%eax
+  802eca:	74 ee                	je     802eba <file_truncate_blocks+0x77>
+			free_runs_add(f->f_direct[i]);
+  802ecc:	e8 ae fe ff ff       	call   802d7f <free_runs_add>
+			f->f_direct[i] = 0;
+  802ed1:	c7 84 9f 88 00 00 00 	movl   $0x0,0x88(%edi,%ebx,4)
+  802ed8:	00 00 00 00 
+  802edc:	eb dc                	jmp    802eba <file_truncate_blocks+0x77>
+	for (i = 0; i < NDELAYED && ndelayed > 0; i++)
+  802ede:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+	for (i = new_nblocks; i < MIN(old_nblocks, NDIRECT); i++)
+  802ee1:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ee6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ee9:	39 f0                	cmp    %esi,%eax
+  802eeb:	0f 46 f0             	cmovbe %eax,%esi
+  802eee:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  802ef1:	eb ca                	jmp    802ebd <file_truncate_blocks+0x7a>
+		}
+
+	if (f->f_indirect) {
+  802ef3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802ef6:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+  802efc:	85 c0                	test   %eax,%eax
+  802efe:	74 19                	je     802f19 <file_truncate_blocks+0xd6>
+		keep = new_nblocks > NDIRECT;
+		if (old_nblocks > NDIRECT && new_nblocks < NDIRECT + NINDIRECT)
+  802f00:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f03:	83 f9 0a             	cmp    $0xa,%ecx
+  802f06:	76 0b                	jbe    802f13 <file_truncate_blocks+0xd0>
+  802f08:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f0b:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  802f11:	76 1f                	jbe    802f32 <file_truncate_blocks+0xef>
+			free_ptrs(diskaddr(f->f_indirect),
+				  indirect_span(new_nblocks, NDIRECT),
+				  indirect_span(old_nblocks, NDIRECT), keep);
+		if (!keep) {
+  802f13:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%ebp)
+  802f17:	76 79                	jbe    802f92 <file_truncate_blocks+0x14f>
+			free_runs_add(f->f_indirect);
+			f->f_indirect = 0;
+		}
+	}
+	if (!f->f_dindirect)
+  802f19:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802f1c:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+  802f22:	85 c0                	test   %eax,%eax
+  802f24:	0f 85 85 00 00 00    	jne    802faf <file_truncate_blocks+0x16c>
+	}
+	if (new_nblocks <= NDIRECT + NINDIRECT) {
+		free_runs_add(f->f_dindirect);
+		f->f_dindirect = 0;
+	}
+}
+  802f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f2d:	5b                   	pop    %ebx
+  802f2e:	5e                   	pop    %esi
+  802f2f:	5f                   	pop    %edi
+  802f30:	5d                   	pop    %ebp
+  802f31:	c3                   	ret
+	return MIN(MAX(n, base), base + NINDIRECT) - base;
+  802f32:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802f37:	39 d1                	cmp    %edx,%ecx
+  802f39:	0f 43 d1             	cmovae %ecx,%edx
+  802f3c:	b9 0a 04 00 00       	mov    $0x40a,%ecx
+  802f41:	39 ca                	cmp    %ecx,%edx
+  802f43:	0f 47 d1             	cmova  %ecx,%edx
+  802f46:	8d 7a f6             	lea    -0xa(%edx),%edi
+  802f49:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  802f4e:	39 de                	cmp    %ebx,%esi
+  802f50:	0f 43 de             	cmovae %esi,%ebx
+  802f53:	ba 0a 04 00 00       	mov    $0x40a,%edx
+  802f58:	39 d3                	cmp    %edx,%ebx
+  802f5a:	0f 47 da             	cmova  %edx,%ebx
+  802f5d:	83 eb 0a             	sub    $0xa,%ebx
+			free_ptrs(diskaddr(f->f_indirect),
+  802f60:	83 ec 0c             	sub    $0xc,%esp
+  802f63:	50                   	push   %eax
+  802f64:	e8 c0 ea ff ff       	call   801a29 <diskaddr>
+  802f69:	89 c6                	mov    %eax,%esi
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	eb 03                	jmp    802f73 <file_truncate_blocks+0x130>
+	for (; from < to; from++)
+  802f70:	83 c3 01             	add    $0x1,%ebx
+  802f73:	39 fb                	cmp    %edi,%ebx
+  802f75:	73 9c                	jae    802f13 <file_truncate_blocks+0xd0>
+		if (ptrs[from]) {
+  802f77:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802f7a:	85 c0                	test   %eax,%eax
+  802f7c:	74 f2                	je     802f70 <file_truncate_blocks+0x12d>
+			free_runs_add(ptrs[from]);
+  802f7e:	e8 fc fd ff ff       	call   802d7f <free_runs_add>
+			if (clear)
+  802f83:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%ebp)
+  802f87:	76 e7                	jbe    802f70 <file_truncate_blocks+0x12d>
+				ptrs[from] = 0;
+  802f89:	c7 04 9e 00 00 00 00 	movl   $0x0,(%esi,%ebx,4)
+  802f90:	eb de                	jmp    802f70 <file_truncate_blocks+0x12d>
+			free_runs_add(f->f_indirect);
+  802f92:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  802f95:	8b 87 b0 00 00 00    	mov    0xb0(%edi),%eax
+  802f9b:	e8 df fd ff ff       	call   802d7f <free_runs_add>
+			f->f_indirect = 0;
+  802fa0:	c7 87 b0 00 00 00 00 	movl   $0x0,0xb0(%edi)
+  802fa7:	00 00 00 
+  802faa:	e9 6a ff ff ff       	jmp    802f19 <file_truncate_blocks+0xd6>
+	dindirect = diskaddr(f->f_dindirect);
+  802faf:	83 ec 0c             	sub    $0xc,%esp
+  802fb2:	50                   	push   %eax
+  802fb3:	e8 71 ea ff ff       	call   801a29 <diskaddr>
+  802fb8:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < NINDIRECT; i++) {
+  802fba:	83 c4 10             	add    $0x10,%esp
+	dindirect = diskaddr(f->f_dindirect);
+  802fbd:	be 0a 04 00 00       	mov    $0x40a,%esi
+  802fc2:	eb 42                	jmp    803006 <file_truncate_blocks+0x1c3>
+	for (; from < to; from++)
+  802fc4:	83 c3 01             	add    $0x1,%ebx
+  802fc7:	39 fb                	cmp    %edi,%ebx
+  802fc9:	73 1d                	jae    802fe8 <file_truncate_blocks+0x1a5>
+		if (ptrs[from]) {
+  802fcb:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802fce:	85 c0                	test   %eax,%eax
+  802fd0:	74 f2                	je     802fc4 <file_truncate_blocks+0x181>
+			free_runs_add(ptrs[from]);
+  802fd2:	e8 a8 fd ff ff       	call   802d7f <free_runs_add>
+			if (clear)
+  802fd7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802fda:	39 55 d8             	cmp    %edx,-0x28(%ebp)
+  802fdd:	73 e5                	jae    802fc4 <file_truncate_blocks+0x181>
+				ptrs[from] = 0;
+  802fdf:	c7 04 9e 00 00 00 00 	movl   $0x0,(%esi,%ebx,4)
+  802fe6:	eb dc                	jmp    802fc4 <file_truncate_blocks+0x181>
+  802fe8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  802feb:	8b 75 d8             	mov    -0x28(%ebp),%esi
+		if (!keep) {
+  802fee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ff1:	39 c6                	cmp    %eax,%esi
+  802ff3:	73 68                	jae    80305d <file_truncate_blocks+0x21a>
+	for (i = 0; i < NINDIRECT; i++) {
+  802ff5:	83 c7 04             	add    $0x4,%edi
+  802ff8:	81 c6 00 04 00 00    	add    $0x400,%esi
+  802ffe:	81 fe 0a 04 10 00    	cmp    $0x10040a,%esi
+  803004:	74 75                	je     80307b <file_truncate_blocks+0x238>
+		if (!dindirect[i])
+  803006:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  803009:	8b 07                	mov    (%edi),%eax
+  80300b:	85 c0                	test   %eax,%eax
+  80300d:	74 e6                	je     802ff5 <file_truncate_blocks+0x1b2>
+		if (old_nblocks > base && new_nblocks < base + NINDIRECT)
+  80300f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803012:	39 ce                	cmp    %ecx,%esi
+  803014:	73 d8                	jae    802fee <file_truncate_blocks+0x1ab>
+  803016:	8d 96 00 04 00 00    	lea    0x400(%esi),%edx
+  80301c:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80301f:	73 cd                	jae    802fee <file_truncate_blocks+0x1ab>
+	return MIN(MAX(n, base), base + NINDIRECT) - base;
+  803021:	39 f1                	cmp    %esi,%ecx
+  803023:	0f 42 ce             	cmovb  %esi,%ecx
+  803026:	39 d1                	cmp    %edx,%ecx
+  803028:	0f 47 ca             	cmova  %edx,%ecx
+  80302b:	29 f1                	sub    %esi,%ecx
+  80302d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  803030:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803033:	39 f1                	cmp    %esi,%ecx
+  803035:	89 cb                	mov    %ecx,%ebx
+  803037:	0f 42 de             	cmovb  %esi,%ebx
+  80303a:	39 d3                	cmp    %edx,%ebx
+  80303c:	0f 47 da             	cmova  %edx,%ebx
+  80303f:	29 f3                	sub    %esi,%ebx
+			free_ptrs(diskaddr(dindirect[i]), indirect_span(new_nblocks, base),
+  803041:	83 ec 0c             	sub    $0xc,%esp
+  803044:	50                   	push   %eax
+  803045:	e8 df e9 ff ff       	call   801a29 <diskaddr>
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  803050:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803053:	89 c6                	mov    %eax,%esi
+  803055:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803058:	e9 6a ff ff ff       	jmp    802fc7 <file_truncate_blocks+0x184>
+			free_runs_add(dindirect[i]);
+  80305d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803060:	8b 03                	mov    (%ebx),%eax
+  803062:	e8 18 fd ff ff       	call   802d7f <free_runs_add>
+			if (new_nblocks > NDIRECT + NINDIRECT)
+  803067:	81 7d e4 0a 04 00 00 	cmpl   $0x40a,-0x1c(%ebp)
+  80306e:	76 85                	jbe    802ff5 <file_truncate_blocks+0x1b2>
+				dindirect[i] = 0;
+  803070:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803076:	e9 7a ff ff ff       	jmp    802ff5 <file_truncate_blocks+0x1b2>
+	if (new_nblocks <= NDIRECT + NINDIRECT) {
+  80307b:	81 7d e4 0a 04 00 00 	cmpl   $0x40a,-0x1c(%ebp)
+  803082:	0f 87 a2 fe ff ff    	ja     802f2a <file_truncate_blocks+0xe7>
+		free_runs_add(f->f_dindirect);
+  803088:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  80308b:	8b 87 b4 00 00 00    	mov    0xb4(%edi),%eax
+  803091:	e8 e9 fc ff ff       	call   802d7f <free_runs_add>
+		f->f_dindirect = 0;
+  803096:	c7 87 b4 00 00 00 00 	movl   $0x0,0xb4(%edi)
+  80309d:	00 00 00 
+  8030a0:	e9 85 fe ff ff       	jmp    802f2a <file_truncate_blocks+0xe7>
+
+008030a5 <check_super>:
+{
+  8030a5:	55                   	push   %ebp
+  8030a6:	89 e5                	mov    %esp,%ebp
+  8030a8:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  8030ab:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  8030b0:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8030b6:	75 1b                	jne    8030d3 <check_super+0x2e>
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  8030b8:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  8030bf:	77 26                	ja     8030e7 <check_super+0x42>
+	cprintf("superblock is good\n");
+  8030c1:	83 ec 0c             	sub    $0xc,%esp
+  8030c4:	68 40 b2 80 00       	push   $0x80b240
+  8030c9:	e8 25 37 00 00       	call   8067f3 <cprintf>
+}
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	c9                   	leave
+  8030d2:	c3                   	ret
+		panic("bad file system magic number");
+  8030d3:	83 ec 04             	sub    $0x4,%esp
+  8030d6:	68 0a b2 80 00       	push   $0x80b20a
+  8030db:	6a 0f                	push   $0xf
+  8030dd:	68 e9 b1 80 00       	push   $0x80b1e9
+  8030e2:	e8 31 36 00 00       	call   806718 <_panic>
+		panic("file system is too large");
+  8030e7:	83 ec 04             	sub    $0x4,%esp
+  8030ea:	68 27 b2 80 00       	push   $0x80b227
+  8030ef:	6a 12                	push   $0x12
+  8030f1:	68 e9 b1 80 00       	push   $0x80b1e9
+  8030f6:	e8 1d 36 00 00       	call   806718 <_panic>
+
+008030fb <block_is_free>:
+{
+  8030fb:	55                   	push   %ebp
+  8030fc:	89 e5                	mov    %esp,%ebp
+  8030fe:	53                   	push   %ebx
+  8030ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  803102:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  803107:	85 c0                	test   %eax,%eax
+  803109:	74 29                	je     803134 <block_is_free+0x39>
+		return 0;
+  80310b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  803110:	3b 48 04             	cmp    0x4(%eax),%ecx
+  803113:	73 18                	jae    80312d <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  803115:	89 cb                	mov    %ecx,%ebx
+  803117:	c1 eb 05             	shr    $0x5,%ebx
+  80311a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80311f:	d3 e0                	shl    %cl,%eax
+  803121:	8b 15 e0 c3 84 00    	mov    0x84c3e0,%edx
+  803127:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  80312a:	0f 95 c2             	setne  %dl
+}
+  80312d:	89 d0                	mov    %edx,%eax
+  80312f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803132:	c9                   	leave
+  803133:	c3                   	ret
+		return 0;
+  803134:	ba 00 00 00 00       	mov    $0x0,%edx
+  803139:	eb f2                	jmp    80312d <block_is_free+0x32>
+
+0080313b <alloc_run>:
+{
+  80313b:	55                   	push   %ebp
+  80313c:	89 e5                	mov    %esp,%ebp
+  80313e:	57                   	push   %edi
+  80313f:	56                   	push   %esi
+  803140:	53                   	push   %ebx
+  803141:	83 ec 2c             	sub    $0x2c,%esp
+  803144:	89 c6                	mov    %eax,%esi
+  803146:	89 d7                	mov    %edx,%edi
+	for (scanned = 0; scanned < super->s_nblocks; scanned += n) {
+  803148:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  80314d:	8b 40 04             	mov    0x4(%eax),%eax
+  803150:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	best = bestn = 0;
+  803153:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80315a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (scanned = 0; scanned < super->s_nblocks; scanned += n) {
+  803161:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  803168:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80316b:	eb 43                	jmp    8031b0 <alloc_run+0x75>
+		for (n = 1; n < want && block_is_free(r + n); n++)
+  80316d:	83 c3 01             	add    $0x1,%ebx
+  803170:	39 fb                	cmp    %edi,%ebx
+  803172:	73 20                	jae    803194 <alloc_run+0x59>
+  803174:	83 ec 0c             	sub    $0xc,%esp
+  803177:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80317a:	50                   	push   %eax
+  80317b:	e8 7b ff ff ff       	call   8030fb <block_is_free>
+  803180:	83 c4 10             	add    $0x10,%esp
+  803183:	84 c0                	test   %al,%al
+  803185:	75 e6                	jne    80316d <alloc_run+0x32>
+		if (n > bestn) {
+  803187:	39 5d d8             	cmp    %ebx,-0x28(%ebp)
+  80318a:	73 13                	jae    80319f <alloc_run+0x64>
+  80318c:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+			best = r;
+  80318f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  803192:	eb 0f                	jmp    8031a3 <alloc_run+0x68>
+		if (n > bestn) {
+  803194:	39 5d d8             	cmp    %ebx,-0x28(%ebp)
+  803197:	73 06                	jae    80319f <alloc_run+0x64>
+  803199:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+			best = r;
+  80319c:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+		if (n == want)
+  80319f:	39 fb                	cmp    %edi,%ebx
+  8031a1:	74 3e                	je     8031e1 <alloc_run+0xa6>
+		start = r + n;
+  8031a3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8031a6:	89 c6                	mov    %eax,%esi
+	for (scanned = 0; scanned < super->s_nblocks; scanned += n) {
+  8031a8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8031ab:	01 c3                	add    %eax,%ebx
+  8031ad:	01 5d e0             	add    %ebx,-0x20(%ebp)
+  8031b0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8031b3:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+  8031b6:	73 2e                	jae    8031e6 <alloc_run+0xab>
+		if ((r = find_free_block(start)) < 0)
+  8031b8:	89 f3                	mov    %esi,%ebx
+  8031ba:	89 f0                	mov    %esi,%eax
+  8031bc:	e8 06 f8 ff ff       	call   8029c7 <find_free_block>
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 68                	js     80322d <alloc_run+0xf2>
+		scanned += r >= start ? r - start : super->s_nblocks - start + r;
+  8031c5:	89 c6                	mov    %eax,%esi
+  8031c7:	89 c1                	mov    %eax,%ecx
+  8031c9:	29 d9                	sub    %ebx,%ecx
+  8031cb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8031ce:	29 da                	sub    %ebx,%edx
+  8031d0:	01 c2                	add    %eax,%edx
+  8031d2:	39 d8                	cmp    %ebx,%eax
+  8031d4:	0f 42 ca             	cmovb  %edx,%ecx
+  8031d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+		for (n = 1; n < want && block_is_free(r + n); n++)
+  8031da:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8031df:	eb 8f                	jmp    803170 <alloc_run+0x35>
+  8031e1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8031e4:	eb 03                	jmp    8031e9 <alloc_run+0xae>
+  8031e6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+	for (n = 0; n < bestn; n++)
+  8031e9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8031ec:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8031ef:	8d 3c 01             	lea    (%ecx,%eax,1),%edi
+		bitmap[(best + n) / 32] &= ~(1 << ((best + n) % 32));
+  8031f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8031f7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+	for (n = 0; n < bestn; n++)
+  8031fa:	39 f9                	cmp    %edi,%ecx
+  8031fc:	74 18                	je     803216 <alloc_run+0xdb>
+		bitmap[(best + n) / 32] &= ~(1 << ((best + n) % 32));
+  8031fe:	89 ca                	mov    %ecx,%edx
+  803200:	c1 ea 05             	shr    $0x5,%edx
+  803203:	a1 e0 c3 84 00       	mov    0x84c3e0,%eax
+  803208:	89 f3                	mov    %esi,%ebx
+  80320a:	d3 e3                	shl    %cl,%ebx
+  80320c:	f7 d3                	not    %ebx
+  80320e:	21 1c 90             	and    %ebx,(%eax,%edx,4)
+	for (n = 0; n < bestn; n++)
+  803211:	83 c1 01             	add    $0x1,%ecx
+  803214:	eb e4                	jmp    8031fa <alloc_run+0xbf>
+	nfree_blocks -= bestn;
+  803216:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803219:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80321c:	29 05 88 36 84 00    	sub    %eax,0x843688
+	alloc_cursor = best + bestn;
+  803222:	89 3d 60 34 84 00    	mov    %edi,0x843460
+	*got = bestn;
+  803228:	89 03                	mov    %eax,(%ebx)
+	return best;
+  80322a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+}
+  80322d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803230:	5b                   	pop    %ebx
+  803231:	5e                   	pop    %esi
+  803232:	5f                   	pop    %edi
+  803233:	5d                   	pop    %ebp
+  803234:	c3                   	ret
+
+00803235 <free_block>:
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	56                   	push   %esi
+  803239:	53                   	push   %ebx
+  80323a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (blockno == 0)
+  80323d:	85 db                	test   %ebx,%ebx
+  80323f:	74 35                	je     803276 <free_block+0x41>
+	if (!block_is_free(blockno))
+  803241:	83 ec 0c             	sub    $0xc,%esp
+  803244:	53                   	push   %ebx
+  803245:	e8 b1 fe ff ff       	call   8030fb <block_is_free>
+  80324a:	83 c4 10             	add    $0x10,%esp
+  80324d:	84 c0                	test   %al,%al
+  80324f:	75 07                	jne    803258 <free_block+0x23>
+		nfree_blocks++;
+  803251:	83 05 88 36 84 00 01 	addl   $0x1,0x843688
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  803258:	89 de                	mov    %ebx,%esi
+  80325a:	c1 ee 05             	shr    $0x5,%esi
+  80325d:	8b 15 e0 c3 84 00    	mov    0x84c3e0,%edx
+  803263:	b8 01 00 00 00       	mov    $0x1,%eax
+  803268:	89 d9                	mov    %ebx,%ecx
+  80326a:	d3 e0                	shl    %cl,%eax
+  80326c:	09 04 b2             	or     %eax,(%edx,%esi,4)
+}
+  80326f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803272:	5b                   	pop    %ebx
+  803273:	5e                   	pop    %esi
+  803274:	5d                   	pop    %ebp
+  803275:	c3                   	ret
+		panic("attempt to free zero block");
+  803276:	83 ec 04             	sub    $0x4,%esp
+  803279:	68 ce b1 80 00       	push   $0x80b1ce
+  80327e:	6a 36                	push   $0x36
+  803280:	68 e9 b1 80 00       	push   $0x80b1e9
+  803285:	e8 8e 34 00 00       	call   806718 <_panic>
+
+0080328a <alloc_block>:
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	83 ec 08             	sub    $0x8,%esp
+	return alloc_block_near(alloc_cursor);
+  803290:	a1 60 34 84 00       	mov    0x843460,%eax
+  803295:	e8 08 f9 ff ff       	call   802ba2 <alloc_block_near>
+}
+  80329a:	c9                   	leave
+  80329b:	c3                   	ret
+
+0080329c <indirect_block>:
+{
+  80329c:	55                   	push   %ebp
+  80329d:	89 e5                	mov    %esp,%ebp
+  80329f:	56                   	push   %esi
+  8032a0:	53                   	push   %ebx
+  8032a1:	89 c3                	mov    %eax,%ebx
+  8032a3:	89 ce                	mov    %ecx,%esi
+	if (*slot == 0) {
+  8032a5:	83 38 00             	cmpl   $0x0,(%eax)
+  8032a8:	75 1b                	jne    8032c5 <indirect_block+0x29>
+		if (!alloc)
+  8032aa:	84 d2                	test   %dl,%dl
+  8032ac:	74 32                	je     8032e0 <indirect_block+0x44>
+		if ((r = alloc_block()) < 0)
+  8032ae:	e8 d7 ff ff ff       	call   80328a <alloc_block>
+  8032b3:	85 c0                	test   %eax,%eax
+  8032b5:	78 22                	js     8032d9 <indirect_block+0x3d>
+		*slot = r;
+  8032b7:	89 03                	mov    %eax,(%ebx)
+		bc_new_block(r);
+  8032b9:	83 ec 0c             	sub    $0xc,%esp
+  8032bc:	50                   	push   %eax
+  8032bd:	e8 ad f3 ff ff       	call   80266f <bc_new_block>
+  8032c2:	83 c4 10             	add    $0x10,%esp
+	*pblk = diskaddr(*slot);
+  8032c5:	83 ec 0c             	sub    $0xc,%esp
+  8032c8:	ff 33                	push   (%ebx)
+  8032ca:	e8 5a e7 ff ff       	call   801a29 <diskaddr>
+  8032cf:	89 06                	mov    %eax,(%esi)
+	return 0;
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032dc:	5b                   	pop    %ebx
+  8032dd:	5e                   	pop    %esi
+  8032de:	5d                   	pop    %ebp
+  8032df:	c3                   	ret
+			return -E_NOT_FOUND;
+  8032e0:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8032e5:	eb f2                	jmp    8032d9 <indirect_block+0x3d>
+
+008032e7 <file_block_walk>:
+{
+  8032e7:	55                   	push   %ebp
+  8032e8:	89 e5                	mov    %esp,%ebp
+  8032ea:	57                   	push   %edi
+  8032eb:	56                   	push   %esi
+  8032ec:	53                   	push   %ebx
+  8032ed:	83 ec 2c             	sub    $0x2c,%esp
+  8032f0:	89 c6                	mov    %eax,%esi
+  8032f2:	89 d3                	mov    %edx,%ebx
+  8032f4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8032f7:	8b 55 08             	mov    0x8(%ebp),%edx
+	nblock = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  8032fa:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+  803300:	8d 81 fe 1f 00 00    	lea    0x1ffe(%ecx),%eax
+  803306:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+  80330c:	0f 49 c1             	cmovns %ecx,%eax
+  80330f:	c1 f8 0c             	sar    $0xc,%eax
+	if (filebno >= nblock || filebno >= MAXFILEBLOCKS) {
+  803312:	39 c3                	cmp    %eax,%ebx
+  803314:	0f 83 e0 00 00 00    	jae    8033fa <file_block_walk+0x113>
+  80331a:	81 fb 09 04 10 00    	cmp    $0x100409,%ebx
+  803320:	0f 87 d4 00 00 00    	ja     8033fa <file_block_walk+0x113>
+	if (filebno < NDIRECT) {
+  803326:	83 fb 09             	cmp    $0x9,%ebx
+  803329:	76 3d                	jbe    803368 <file_block_walk+0x81>
+	filebno -= NDIRECT;
+  80332b:	8d 7b f6             	lea    -0xa(%ebx),%edi
+	if (filebno < NINDIRECT) {
+  80332e:	81 ff ff 03 00 00    	cmp    $0x3ff,%edi
+  803334:	77 4e                	ja     803384 <file_block_walk+0x9d>
+		bno = f->f_indirect;
+  803336:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  80333c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if ((r = indirect_block(&bno, alloc, &indirect)) < 0)
+  80333f:	0f b6 d2             	movzbl %dl,%edx
+  803342:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  803345:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803348:	e8 4f ff ff ff       	call   80329c <indirect_block>
+  80334d:	85 c0                	test   %eax,%eax
+  80334f:	0f 88 9d 00 00 00    	js     8033f2 <file_block_walk+0x10b>
+		if (f->f_indirect != bno)
+  803355:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803358:	39 86 b0 00 00 00    	cmp    %eax,0xb0(%esi)
+  80335e:	74 79                	je     8033d9 <file_block_walk+0xf2>
+			f->f_indirect = bno;
+  803360:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+  803366:	eb 71                	jmp    8033d9 <file_block_walk+0xf2>
+		return 0;
+  803368:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ppdiskbno) {
+  80336d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803370:	85 ff                	test   %edi,%edi
+  803372:	74 7e                	je     8033f2 <file_block_walk+0x10b>
+			*ppdiskbno = f->f_direct + filebno;
+  803374:	8d 84 9e 88 00 00 00 	lea    0x88(%esi,%ebx,4),%eax
+  80337b:	89 07                	mov    %eax,(%edi)
+		return 0;
+  80337d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803382:	eb 6e                	jmp    8033f2 <file_block_walk+0x10b>
+		bno = f->f_dindirect;
+  803384:	8b 86 b4 00 00 00    	mov    0xb4(%esi),%eax
+  80338a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if ((r = indirect_block(&bno, alloc, &indirect)) < 0)
+  80338d:	0f b6 fa             	movzbl %dl,%edi
+  803390:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  803393:	89 fa                	mov    %edi,%edx
+  803395:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803398:	e8 ff fe ff ff       	call   80329c <indirect_block>
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	78 51                	js     8033f2 <file_block_walk+0x10b>
+		if (f->f_dindirect != bno)
+  8033a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033a4:	39 86 b4 00 00 00    	cmp    %eax,0xb4(%esi)
+  8033aa:	74 06                	je     8033b2 <file_block_walk+0xcb>
+			f->f_dindirect = bno;
+  8033ac:	89 86 b4 00 00 00    	mov    %eax,0xb4(%esi)
+		filebno -= NINDIRECT;
+  8033b2:	81 eb 0a 04 00 00    	sub    $0x40a,%ebx
+		if ((r = indirect_block(&indirect[filebno / NINDIRECT], alloc, &indirect)) < 0)
+  8033b8:	89 da                	mov    %ebx,%edx
+  8033ba:	c1 ea 0a             	shr    $0xa,%edx
+  8033bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8033c0:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  8033c3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8033c6:	89 fa                	mov    %edi,%edx
+  8033c8:	e8 cf fe ff ff       	call   80329c <indirect_block>
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	78 21                	js     8033f2 <file_block_walk+0x10b>
+		filebno %= NINDIRECT;
+  8033d1:	89 df                	mov    %ebx,%edi
+  8033d3:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	return 0;
+  8033d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ppdiskbno) {
+  8033de:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8033e1:	85 f6                	test   %esi,%esi
+  8033e3:	74 0d                	je     8033f2 <file_block_walk+0x10b>
+		*ppdiskbno = indirect + filebno;
+  8033e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8033e8:	8d 04 b8             	lea    (%eax,%edi,4),%eax
+  8033eb:	89 06                	mov    %eax,(%esi)
+	return 0;
+  8033ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033f2:	83 c4 2c             	add    $0x2c,%esp
+  8033f5:	5b                   	pop    %ebx
+  8033f6:	5e                   	pop    %esi
+  8033f7:	5f                   	pop    %edi
+  8033f8:	5d                   	pop    %ebp
+  8033f9:	c3                   	ret
+		return -E_INVAL;
+  8033fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ff:	eb f1                	jmp    8033f2 <file_block_walk+0x10b>
+
+00803401 <file_alloc_hint>:
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+  803401:	85 d2                	test   %edx,%edx
+  803403:	75 06                	jne    80340b <file_alloc_hint+0xa>
+	return alloc_cursor;
+  803405:	a1 60 34 84 00       	mov    0x843460,%eax
+}
+  80340a:	c3                   	ret
+{
+  80340b:	55                   	push   %ebp
+  80340c:	89 e5                	mov    %esp,%ebp
+  80340e:	83 ec 24             	sub    $0x24,%esp
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+  803411:	83 ea 01             	sub    $0x1,%edx
+  803414:	6a 00                	push   $0x0
+  803416:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803419:	e8 c9 fe ff ff       	call   8032e7 <file_block_walk>
+  80341e:	83 c4 10             	add    $0x10,%esp
+  803421:	85 c0                	test   %eax,%eax
+  803423:	75 09                	jne    80342e <file_alloc_hint+0x2d>
+	    && *pdiskbno != 0)
+  803425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803428:	8b 00                	mov    (%eax),%eax
+  80342a:	85 c0                	test   %eax,%eax
+  80342c:	75 07                	jne    803435 <file_alloc_hint+0x34>
+	return alloc_cursor;
+  80342e:	a1 60 34 84 00       	mov    0x843460,%eax
+}
+  803433:	c9                   	leave
+  803434:	c3                   	ret
+		return *pdiskbno + 1;
+  803435:	83 c0 01             	add    $0x1,%eax
+  803438:	eb f9                	jmp    803433 <file_alloc_hint+0x32>
+
+0080343a <file_readahead>:
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	57                   	push   %edi
+  80343e:	56                   	push   %esi
+  80343f:	53                   	push   %ebx
+  803440:	83 ec 2c             	sub    $0x2c,%esp
+  803443:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803446:	89 d3                	mov    %edx,%ebx
+	nblock = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  803448:	8b b0 80 00 00 00    	mov    0x80(%eax),%esi
+  80344e:	8d 96 fe 1f 00 00    	lea    0x1ffe(%esi),%edx
+  803454:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+  80345a:	0f 49 d6             	cmovns %esi,%edx
+  80345d:	c1 fa 0c             	sar    $0xc,%edx
+	if (filebno >= nblock)
+  803460:	39 d3                	cmp    %edx,%ebx
+  803462:	73 7d                	jae    8034e1 <file_readahead+0xa7>
+	n = MIN(n, nblock - filebno);
+  803464:	29 da                	sub    %ebx,%edx
+  803466:	39 ca                	cmp    %ecx,%edx
+  803468:	0f 47 d1             	cmova  %ecx,%edx
+  80346b:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80346e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	start = run = 0;
+  803471:	be 00 00 00 00       	mov    $0x0,%esi
+  803476:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (i = 0; i < n; i++) {
+  80347b:	eb 1d                	jmp    80349a <file_readahead+0x60>
+			fill(start, run);
+  80347d:	83 ec 08             	sub    $0x8,%esp
+  803480:	56                   	push   %esi
+  803481:	57                   	push   %edi
+  803482:	ff 55 08             	call   *0x8(%ebp)
+  803485:	83 c4 10             	add    $0x10,%esp
+		start = *pdiskbno;
+  803488:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80348b:	8b 38                	mov    (%eax),%edi
+		run = start != 0;
+  80348d:	85 ff                	test   %edi,%edi
+  80348f:	0f 95 c0             	setne  %al
+  803492:	0f b6 c0             	movzbl %al,%eax
+  803495:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i++) {
+  803497:	83 c3 01             	add    $0x1,%ebx
+  80349a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80349d:	39 c3                	cmp    %eax,%ebx
+  80349f:	74 31                	je     8034d2 <file_readahead+0x98>
+		if (file_block_walk(f, filebno + i, &pdiskbno, 0) < 0)
+  8034a1:	83 ec 0c             	sub    $0xc,%esp
+  8034a4:	6a 00                	push   $0x0
+  8034a6:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8034a9:	89 da                	mov    %ebx,%edx
+  8034ab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8034ae:	e8 34 fe ff ff       	call   8032e7 <file_block_walk>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 18                	js     8034d2 <file_readahead+0x98>
+		if (run && *pdiskbno == start + run && run < BC_MAXIO) {
+  8034ba:	85 f6                	test   %esi,%esi
+  8034bc:	74 ca                	je     803488 <file_readahead+0x4e>
+  8034be:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8034c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8034c4:	39 02                	cmp    %eax,(%edx)
+  8034c6:	75 b5                	jne    80347d <file_readahead+0x43>
+  8034c8:	83 fe 1f             	cmp    $0x1f,%esi
+  8034cb:	77 b0                	ja     80347d <file_readahead+0x43>
+			run++;
+  8034cd:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8034d0:	eb c5                	jmp    803497 <file_readahead+0x5d>
+	if (run)
+  8034d2:	85 f6                	test   %esi,%esi
+  8034d4:	74 0b                	je     8034e1 <file_readahead+0xa7>
+		fill(start, run);
+  8034d6:	83 ec 08             	sub    $0x8,%esp
+  8034d9:	56                   	push   %esi
+  8034da:	57                   	push   %edi
+  8034db:	ff 55 08             	call   *0x8(%ebp)
+  8034de:	83 c4 10             	add    $0x10,%esp
+}
+  8034e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034e4:	5b                   	pop    %ebx
+  8034e5:	5e                   	pop    %esi
+  8034e6:	5f                   	pop    %edi
+  8034e7:	5d                   	pop    %ebp
+  8034e8:	c3                   	ret
+
+008034e9 <check_bitmap>:
+{
+  8034e9:	55                   	push   %ebp
+  8034ea:	89 e5                	mov    %esp,%ebp
+  8034ec:	56                   	push   %esi
+  8034ed:	53                   	push   %ebx
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8034ee:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  8034f3:	8b 70 04             	mov    0x4(%eax),%esi
+  8034f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034fb:	89 d8                	mov    %ebx,%eax
+  8034fd:	c1 e0 0f             	shl    $0xf,%eax
+  803500:	39 f0                	cmp    %esi,%eax
+  803502:	73 31                	jae    803535 <check_bitmap+0x4c>
+		assert(!block_is_free(2+i));
+  803504:	83 ec 0c             	sub    $0xc,%esp
+  803507:	8d 43 02             	lea    0x2(%ebx),%eax
+  80350a:	50                   	push   %eax
+  80350b:	e8 eb fb ff ff       	call   8030fb <block_is_free>
+  803510:	83 c4 10             	add    $0x10,%esp
+  803513:	84 c0                	test   %al,%al
+  803515:	75 05                	jne    80351c <check_bitmap+0x33>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  803517:	83 c3 01             	add    $0x1,%ebx
+  80351a:	eb df                	jmp    8034fb <check_bitmap+0x12>
+		assert(!block_is_free(2+i));
+  80351c:	68 54 b2 80 00       	push   $0x80b254
+  803521:	68 2b ad 80 00       	push   $0x80ad2b
+  803526:	68 ff 00 00 00       	push   $0xff
+  80352b:	68 e9 b1 80 00       	push   $0x80b1e9
+  803530:	e8 e3 31 00 00       	call   806718 <_panic>
+	assert(!block_is_free(0));
+  803535:	83 ec 0c             	sub    $0xc,%esp
+  803538:	6a 00                	push   $0x0
+  80353a:	e8 bc fb ff ff       	call   8030fb <block_is_free>
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	84 c0                	test   %al,%al
+  803544:	75 28                	jne    80356e <check_bitmap+0x85>
+	assert(!block_is_free(1));
+  803546:	83 ec 0c             	sub    $0xc,%esp
+  803549:	6a 01                	push   $0x1
+  80354b:	e8 ab fb ff ff       	call   8030fb <block_is_free>
+  803550:	83 c4 10             	add    $0x10,%esp
+  803553:	84 c0                	test   %al,%al
+  803555:	75 30                	jne    803587 <check_bitmap+0x9e>
+	cprintf("bitmap is good\n");
+  803557:	83 ec 0c             	sub    $0xc,%esp
+  80355a:	68 8c b2 80 00       	push   $0x80b28c
+  80355f:	e8 8f 32 00 00       	call   8067f3 <cprintf>
+}
+  803564:	83 c4 10             	add    $0x10,%esp
+  803567:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80356a:	5b                   	pop    %ebx
+  80356b:	5e                   	pop    %esi
+  80356c:	5d                   	pop    %ebp
+  80356d:	c3                   	ret
+	assert(!block_is_free(0));
+  80356e:	68 68 b2 80 00       	push   $0x80b268
+  803573:	68 2b ad 80 00       	push   $0x80ad2b
+  803578:	68 02 01 00 00       	push   $0x102
+  80357d:	68 e9 b1 80 00       	push   $0x80b1e9
+  803582:	e8 91 31 00 00       	call   806718 <_panic>
+	assert(!block_is_free(1));
+  803587:	68 7a b2 80 00       	push   $0x80b27a
+  80358c:	68 2b ad 80 00       	push   $0x80ad2b
+  803591:	68 03 01 00 00       	push   $0x103
+  803596:	68 e9 b1 80 00       	push   $0x80b1e9
+  80359b:	e8 78 31 00 00       	call   806718 <_panic>
+
+008035a0 <fs_init>:
+{
+  8035a0:	55                   	push   %ebp
+  8035a1:	89 e5                	mov    %esp,%ebp
+  8035a3:	56                   	push   %esi
+  8035a4:	53                   	push   %ebx
+	ide_init();
+  8035a5:	e8 ca d0 ff ff       	call   800674 <ide_init>
+	if (virtio_init() > 0)
+  8035aa:	e8 e8 d8 ff ff       	call   800e97 <virtio_init>
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	7e 61                	jle    803614 <fs_init+0x74>
+		bdev_init(&virtio_driver, 0);
+  8035b3:	83 ec 08             	sub    $0x8,%esp
+  8035b6:	6a 00                	push   $0x0
+  8035b8:	68 24 d0 80 00       	push   $0x80d024
+  8035bd:	e8 f4 db ff ff       	call   8011b6 <bdev_init>
+  8035c2:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  8035c5:	e8 fb f0 ff ff       	call   8026c5 <bc_init>
+	super = diskaddr(1);
+  8035ca:	83 ec 0c             	sub    $0xc,%esp
+  8035cd:	6a 01                	push   $0x1
+  8035cf:	e8 55 e4 ff ff       	call   801a29 <diskaddr>
+  8035d4:	a3 e4 c3 84 00       	mov    %eax,0x84c3e4
+	check_super();
+  8035d9:	e8 c7 fa ff ff       	call   8030a5 <check_super>
+	bdev_stripe(super);
+  8035de:	83 c4 04             	add    $0x4,%esp
+  8035e1:	ff 35 e4 c3 84 00    	push   0x84c3e4
+  8035e7:	e8 f3 db ff ff       	call   8011df <bdev_stripe>
+	bitmap = diskaddr(2);
+  8035ec:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  8035f3:	e8 31 e4 ff ff       	call   801a29 <diskaddr>
+  8035f8:	a3 e0 c3 84 00       	mov    %eax,0x84c3e0
+	check_bitmap();
+  8035fd:	e8 e7 fe ff ff       	call   8034e9 <check_bitmap>
+	for (i = 0; i < super->s_nblocks; i++)
+  803602:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  803607:	8b 70 04             	mov    0x4(%eax),%esi
+  80360a:	83 c4 10             	add    $0x10,%esp
+  80360d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803612:	eb 46                	jmp    80365a <fs_init+0xba>
+	else if (ide_probe_disk(1))
+  803614:	83 ec 0c             	sub    $0xc,%esp
+  803617:	6a 01                	push   $0x1
+  803619:	e8 15 ca ff ff       	call   800033 <ide_probe_disk>
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	84 c0                	test   %al,%al
+  803623:	74 14                	je     803639 <fs_init+0x99>
+		bdev_init(&ide_driver, 1);
+  803625:	83 ec 08             	sub    $0x8,%esp
+  803628:	6a 01                	push   $0x1
+  80362a:	68 00 d0 80 00       	push   $0x80d000
+  80362f:	e8 82 db ff ff       	call   8011b6 <bdev_init>
+  803634:	83 c4 10             	add    $0x10,%esp
+  803637:	eb 8c                	jmp    8035c5 <fs_init+0x25>
+		bdev_init(&ide_driver, 0);
+  803639:	83 ec 08             	sub    $0x8,%esp
+  80363c:	6a 00                	push   $0x0
+  80363e:	68 00 d0 80 00       	push   $0x80d000
+  803643:	e8 6e db ff ff       	call   8011b6 <bdev_init>
+  803648:	83 c4 10             	add    $0x10,%esp
+  80364b:	e9 75 ff ff ff       	jmp    8035c5 <fs_init+0x25>
+			nfree_blocks++;
+  803650:	83 05 88 36 84 00 01 	addl   $0x1,0x843688
+	for (i = 0; i < super->s_nblocks; i++)
+  803657:	83 c3 01             	add    $0x1,%ebx
+  80365a:	39 de                	cmp    %ebx,%esi
+  80365c:	74 12                	je     803670 <fs_init+0xd0>
+		if (block_is_free(i))
+  80365e:	83 ec 0c             	sub    $0xc,%esp
+  803661:	53                   	push   %ebx
+  803662:	e8 94 fa ff ff       	call   8030fb <block_is_free>
+  803667:	83 c4 10             	add    $0x10,%esp
+  80366a:	84 c0                	test   %al,%al
+  80366c:	74 e9                	je     803657 <fs_init+0xb7>
+  80366e:	eb e0                	jmp    803650 <fs_init+0xb0>
+	for (i = 0; i < DHASHSIZE; i++)
+  803670:	b8 00 00 00 00       	mov    $0x0,%eax
+		delayed_hash[i] = -1;
+  803675:	c7 04 85 60 00 84 00 	movl   $0xffffffff,0x840060(,%eax,4)
+  80367c:	ff ff ff ff 
+	for (i = 0; i < DHASHSIZE; i++)
+  803680:	83 c0 01             	add    $0x1,%eax
+  803683:	3d 00 01 00 00       	cmp    $0x100,%eax
+  803688:	75 eb                	jne    803675 <fs_init+0xd5>
+  80368a:	ba 68 04 84 00       	mov    $0x840468,%edx
+	for (i = 0; i < NDELAYED; i++)
+  80368f:	b8 00 00 00 00       	mov    $0x0,%eax
+		delayed[i].d_next = i + 1 < NDELAYED ? i + 1 : -1;
+  803694:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  803699:	8d 48 01             	lea    0x1(%eax),%ecx
+  80369c:	89 0a                	mov    %ecx,(%edx)
+	for (i = 0; i < NDELAYED; i++)
+  80369e:	83 c0 01             	add    $0x1,%eax
+  8036a1:	83 c2 0c             	add    $0xc,%edx
+  8036a4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8036a9:	74 0b                	je     8036b6 <fs_init+0x116>
+		delayed[i].d_next = i + 1 < NDELAYED ? i + 1 : -1;
+  8036ab:	89 d9                	mov    %ebx,%ecx
+  8036ad:	3d fe 03 00 00       	cmp    $0x3fe,%eax
+  8036b2:	7e e5                	jle    803699 <fs_init+0xf9>
+  8036b4:	eb e6                	jmp    80369c <fs_init+0xfc>
+	delayed_free = 0;
+  8036b6:	c7 05 44 00 84 00 00 	movl   $0x0,0x840044
+  8036bd:	00 00 00 
+}
+  8036c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036c3:	5b                   	pop    %ebx
+  8036c4:	5e                   	pop    %esi
+  8036c5:	5d                   	pop    %ebp
+  8036c6:	c3                   	ret
+
+008036c7 <delalloc_flush>:
+	if (ndelayed == 0)
+  8036c7:	83 3d 84 36 84 00 00 	cmpl   $0x0,0x843684
+  8036ce:	0f 84 43 02 00 00    	je     803917 <delalloc_flush+0x250>
+{
+  8036d4:	55                   	push   %ebp
+  8036d5:	89 e5                	mov    %esp,%ebp
+  8036d7:	57                   	push   %edi
+  8036d8:	56                   	push   %esi
+  8036d9:	53                   	push   %ebx
+  8036da:	83 ec 3c             	sub    $0x3c,%esp
+	delalloc_flushing = 1;
+  8036dd:	c6 05 80 36 84 00 01 	movb   $0x1,0x843680
+	for (i = j = 0; i < NDELAYED; i++)
+  8036e4:	ba 60 04 84 00       	mov    $0x840460,%edx
+  8036e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f3:	eb 0d                	jmp    803702 <delalloc_flush+0x3b>
+  8036f5:	83 c0 01             	add    $0x1,%eax
+  8036f8:	83 c2 0c             	add    $0xc,%edx
+  8036fb:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803700:	74 11                	je     803713 <delalloc_flush+0x4c>
+		if (delayed[i].d_file)
+  803702:	83 3a 00             	cmpl   $0x0,(%edx)
+  803705:	74 ee                	je     8036f5 <delalloc_flush+0x2e>
+			order[j++] = i;
+  803707:	89 04 8d a0 ef 83 00 	mov    %eax,0x83efa0(,%ecx,4)
+  80370e:	8d 49 01             	lea    0x1(%ecx),%ecx
+  803711:	eb e2                	jmp    8036f5 <delalloc_flush+0x2e>
+  803713:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  803716:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	for (gap = n = j; (gap /= 2) > 0; )
+  803719:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80371c:	89 c2                	mov    %eax,%edx
+  80371e:	d1 e8                	shr    %eax
+  803720:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  803723:	83 fa 01             	cmp    $0x1,%edx
+  803726:	0f 86 d2 01 00 00    	jbe    8038fe <delalloc_flush+0x237>
+  80372c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803733:	89 d3                	mov    %edx,%ebx
+  803735:	f7 db                	neg    %ebx
+		for (i = gap; i < n; i++)
+  803737:	89 c2                	mov    %eax,%edx
+  803739:	eb 61                	jmp    80379c <delalloc_flush+0xd5>
+	return delayed[a].d_filebno < delayed[b].d_filebno;
+  80373b:	8d 34 49             	lea    (%ecx,%ecx,2),%esi
+  80373e:	8d 3c 52             	lea    (%edx,%edx,2),%edi
+			for (k = i; k >= gap && delayed_before(order[k], order[k - gap]); k -= gap) {
+  803741:	8b 3c bd 64 04 84 00 	mov    0x840464(,%edi,4),%edi
+  803748:	39 3c b5 64 04 84 00 	cmp    %edi,0x840464(,%esi,4)
+  80374f:	73 40                	jae    803791 <delalloc_flush+0xca>
+				order[k] = order[k - gap];
+  803751:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  803754:	89 16                	mov    %edx,(%esi)
+				order[k - gap] = t;
+  803756:	89 0c 1e             	mov    %ecx,(%esi,%ebx,1)
+			for (k = i; k >= gap && delayed_before(order[k], order[k - gap]); k -= gap) {
+  803759:	01 d8                	add    %ebx,%eax
+  80375b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80375e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803761:	39 cf                	cmp    %ecx,%edi
+  803763:	72 31                	jb     803796 <delalloc_flush+0xcf>
+  803765:	29 cf                	sub    %ecx,%edi
+  803767:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  80376a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80376d:	8b 14 18             	mov    (%eax,%ebx,1),%edx
+  803770:	8b 08                	mov    (%eax),%ecx
+	if (delayed[a].d_file != delayed[b].d_file)
+  803772:	8d 34 49             	lea    (%ecx,%ecx,2),%esi
+  803775:	8b 3c b5 60 04 84 00 	mov    0x840460(,%esi,4),%edi
+  80377c:	8d 34 52             	lea    (%edx,%edx,2),%esi
+  80377f:	8b 34 b5 60 04 84 00 	mov    0x840460(,%esi,4),%esi
+  803786:	39 f7                	cmp    %esi,%edi
+  803788:	74 b1                	je     80373b <delalloc_flush+0x74>
+			for (k = i; k >= gap && delayed_before(order[k], order[k - gap]); k -= gap) {
+  80378a:	72 c5                	jb     803751 <delalloc_flush+0x8a>
+  80378c:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80378f:	eb 08                	jmp    803799 <delalloc_flush+0xd2>
+  803791:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803794:	eb 03                	jmp    803799 <delalloc_flush+0xd2>
+  803796:	8b 55 c8             	mov    -0x38(%ebp),%edx
+		for (i = gap; i < n; i++)
+  803799:	83 c2 01             	add    $0x1,%edx
+  80379c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80379f:	39 c2                	cmp    %eax,%edx
+  8037a1:	0f 83 72 ff ff ff    	jae    803719 <delalloc_flush+0x52>
+  8037a7:	8d 04 95 a0 ef 83 00 	lea    0x83efa0(,%edx,4),%eax
+			for (k = i; k >= gap && delayed_before(order[k], order[k - gap]); k -= gap) {
+  8037ae:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8037b1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8037b4:	eb a5                	jmp    80375b <delalloc_flush+0x94>
+			     && delayed[order[i + j]].d_filebno == delayed[order[i]].d_filebno + j; j++)
+  8037b6:	83 c3 01             	add    $0x1,%ebx
+  8037b9:	39 cb                	cmp    %ecx,%ebx
+  8037bb:	74 30                	je     8037ed <delalloc_flush+0x126>
+		for (j = 1; i + j < n && delayed[order[i + j]].d_file == f
+  8037bd:	8b 84 9e a0 ef 83 00 	mov    0x83efa0(%esi,%ebx,4),%eax
+  8037c4:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8037c7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8037ca:	39 3c 95 60 04 84 00 	cmp    %edi,0x840460(,%edx,4)
+  8037d1:	75 52                	jne    803825 <delalloc_flush+0x15e>
+			     && delayed[order[i + j]].d_filebno == delayed[order[i]].d_filebno + j; j++)
+  8037d3:	89 d8                	mov    %ebx,%eax
+  8037d5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8037d8:	03 04 bd 64 04 84 00 	add    0x840464(,%edi,4),%eax
+  8037df:	39 04 95 64 04 84 00 	cmp    %eax,0x840464(,%edx,4)
+  8037e6:	74 ce                	je     8037b6 <delalloc_flush+0xef>
+  8037e8:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8037eb:	eb 05                	jmp    8037f2 <delalloc_flush+0x12b>
+  8037ed:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8037f0:	89 cb                	mov    %ecx,%ebx
+		blockno = alloc_run(file_alloc_hint(f, delayed[order[i]].d_filebno), j, &got);
+  8037f2:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  8037f5:	8b 14 85 64 04 84 00 	mov    0x840464(,%eax,4),%edx
+  8037fc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8037ff:	e8 fd fb ff ff       	call   803401 <file_alloc_hint>
+  803804:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  803807:	89 da                	mov    %ebx,%edx
+  803809:	e8 2d f9 ff ff       	call   80313b <alloc_run>
+  80380e:	89 c7                	mov    %eax,%edi
+		if (blockno < 0)
+  803810:	85 c0                	test   %eax,%eax
+  803812:	78 16                	js     80382a <delalloc_flush+0x163>
+		for (k = i; k < i + j; k++, blockno++) {
+  803814:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803817:	89 c3                	mov    %eax,%ebx
+  803819:	89 c6                	mov    %eax,%esi
+  80381b:	03 75 e4             	add    -0x1c(%ebp),%esi
+  80381e:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  803821:	89 c7                	mov    %eax,%edi
+  803823:	eb 57                	jmp    80387c <delalloc_flush+0x1b5>
+  803825:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803828:	eb c8                	jmp    8037f2 <delalloc_flush+0x12b>
+			panic("delalloc_flush: %e", blockno);
+  80382a:	50                   	push   %eax
+  80382b:	68 9c b2 80 00       	push   $0x80b29c
+  803830:	68 36 02 00 00       	push   $0x236
+  803835:	68 e9 b1 80 00       	push   $0x80b1e9
+  80383a:	e8 d9 2e 00 00       	call   806718 <_panic>
+			*pdiskbno = blockno;
+  80383f:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  803842:	29 fa                	sub    %edi,%edx
+  803844:	01 da                	add    %ebx,%edx
+  803846:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803849:	89 10                	mov    %edx,(%eax)
+			bc_adopt(blockno, delayed_va(order[k]), delayed_since);
+  80384b:	83 ec 04             	sub    $0x4,%esp
+  80384e:	ff 35 40 00 84 00    	push   0x840040
+	return (char*) (DELAYMAP + i * BLKSIZE);
+  803854:	8b 04 9d a0 ef 83 00 	mov    0x83efa0(,%ebx,4),%eax
+  80385b:	c1 e0 0c             	shl    $0xc,%eax
+  80385e:	2d 00 00 00 20       	sub    $0x20000000,%eax
+			bc_adopt(blockno, delayed_va(order[k]), delayed_since);
+  803863:	50                   	push   %eax
+  803864:	52                   	push   %edx
+  803865:	e8 ae ed ff ff       	call   802618 <bc_adopt>
+			delayed_remove(order[k]);
+  80386a:	8b 04 9d a0 ef 83 00 	mov    0x83efa0(,%ebx,4),%eax
+  803871:	e8 ed f3 ff ff       	call   802c63 <delayed_remove>
+		for (k = i; k < i + j; k++, blockno++) {
+  803876:	83 c3 01             	add    $0x1,%ebx
+  803879:	83 c4 10             	add    $0x10,%esp
+  80387c:	39 f3                	cmp    %esi,%ebx
+  80387e:	73 3d                	jae    8038bd <delalloc_flush+0x1f6>
+			if ((r = file_block_walk(f, delayed[order[k]].d_filebno, &pdiskbno, 1)) < 0)
+  803880:	8b 04 9d a0 ef 83 00 	mov    0x83efa0(,%ebx,4),%eax
+  803887:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80388a:	8b 14 85 64 04 84 00 	mov    0x840464(,%eax,4),%edx
+  803891:	83 ec 0c             	sub    $0xc,%esp
+  803894:	6a 01                	push   $0x1
+  803896:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  803899:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80389c:	e8 46 fa ff ff       	call   8032e7 <file_block_walk>
+  8038a1:	83 c4 10             	add    $0x10,%esp
+  8038a4:	85 c0                	test   %eax,%eax
+  8038a6:	79 97                	jns    80383f <delalloc_flush+0x178>
+				panic("delalloc_flush: %e", r);
+  8038a8:	50                   	push   %eax
+  8038a9:	68 9c b2 80 00       	push   $0x80b29c
+  8038ae:	68 3a 02 00 00       	push   $0x23a
+  8038b3:	68 e9 b1 80 00       	push   $0x80b1e9
+  8038b8:	e8 5b 2e 00 00       	call   806718 <_panic>
+		for (k = i; k < i + j; k++, blockno++) {
+  8038bd:	89 75 cc             	mov    %esi,-0x34(%ebp)
+	for (i = 0; i < n; i += j) {
+  8038c0:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  8038c3:	39 5d cc             	cmp    %ebx,-0x34(%ebp)
+  8038c6:	73 40                	jae    803908 <delalloc_flush+0x241>
+		f = delayed[order[i]].d_file;
+  8038c8:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  8038cb:	8b 14 9d a0 ef 83 00 	mov    0x83efa0(,%ebx,4),%edx
+  8038d2:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  8038d5:	8b 04 85 60 04 84 00 	mov    0x840460(,%eax,4),%eax
+  8038dc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		for (j = 1; i + j < n && delayed[order[i + j]].d_file == f
+  8038df:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  8038e2:	29 d9                	sub    %ebx,%ecx
+  8038e4:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+  8038eb:	bb 01 00 00 00       	mov    $0x1,%ebx
+			     && delayed[order[i + j]].d_filebno == delayed[order[i]].d_filebno + j; j++)
+  8038f0:	8d 3c 52             	lea    (%edx,%edx,2),%edi
+  8038f3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8038f6:	89 7d d0             	mov    %edi,-0x30(%ebp)
+		for (j = 1; i + j < n && delayed[order[i + j]].d_file == f
+  8038f9:	e9 bb fe ff ff       	jmp    8037b9 <delalloc_flush+0xf2>
+	for (i = 0; i < n; i += j) {
+  8038fe:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = file_block_walk(f, delayed[order[k]].d_filebno, &pdiskbno, 1)) < 0)
+  803903:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  803906:	eb b8                	jmp    8038c0 <delalloc_flush+0x1f9>
+	delalloc_flushing = 0;
+  803908:	c6 05 80 36 84 00 00 	movb   $0x0,0x843680
+}
+  80390f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803912:	5b                   	pop    %ebx
+  803913:	5e                   	pop    %esi
+  803914:	5f                   	pop    %edi
+  803915:	5d                   	pop    %ebp
+  803916:	c3                   	ret
+  803917:	c3                   	ret
+
+00803918 <file_get_block>:
+{
+  803918:	55                   	push   %ebp
+  803919:	89 e5                	mov    %esp,%ebp
+  80391b:	56                   	push   %esi
+  80391c:	53                   	push   %ebx
+  80391d:	83 ec 10             	sub    $0x10,%esp
+  803920:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = file_spill(f)) < 0)
+  803923:	89 f0                	mov    %esi,%eax
+  803925:	e8 df 00 00 00       	call   803a09 <file_spill>
+  80392a:	89 c3                	mov    %eax,%ebx
+  80392c:	85 c0                	test   %eax,%eax
+  80392e:	78 6a                	js     80399a <file_get_block+0x82>
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 0)) < 0
+  803930:	83 ec 0c             	sub    $0xc,%esp
+  803933:	6a 00                	push   $0x0
+  803935:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803938:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80393b:	89 f0                	mov    %esi,%eax
+  80393d:	e8 a5 f9 ff ff       	call   8032e7 <file_block_walk>
+  803942:	89 c3                	mov    %eax,%ebx
+  803944:	83 c4 10             	add    $0x10,%esp
+  803947:	85 c0                	test   %eax,%eax
+  803949:	78 24                	js     80396f <file_get_block+0x57>
+	if (r == 0 && *ppdiskbno) {
+  80394b:	75 27                	jne    803974 <file_get_block+0x5c>
+  80394d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803950:	8b 00                	mov    (%eax),%eax
+  803952:	85 c0                	test   %eax,%eax
+  803954:	74 1e                	je     803974 <file_get_block+0x5c>
+		if (blk)
+  803956:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80395a:	74 3e                	je     80399a <file_get_block+0x82>
+			*blk = diskaddr(*ppdiskbno);
+  80395c:	83 ec 0c             	sub    $0xc,%esp
+  80395f:	50                   	push   %eax
+  803960:	e8 c4 e0 ff ff       	call   801a29 <diskaddr>
+  803965:	8b 55 10             	mov    0x10(%ebp),%edx
+  803968:	89 02                	mov    %eax,(%edx)
+  80396a:	83 c4 10             	add    $0x10,%esp
+  80396d:	eb 2b                	jmp    80399a <file_get_block+0x82>
+	    && r != -E_NOT_FOUND)
+  80396f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803972:	75 26                	jne    80399a <file_get_block+0x82>
+	if ((r = delayed_lookup(f, filebno)) >= 0) {
+  803974:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803977:	89 f0                	mov    %esi,%eax
+  803979:	e8 c9 f0 ff ff       	call   802a47 <delayed_lookup>
+  80397e:	85 c0                	test   %eax,%eax
+  803980:	78 21                	js     8039a3 <file_get_block+0x8b>
+		return 0;
+  803982:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (blk)
+  803987:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80398b:	74 0d                	je     80399a <file_get_block+0x82>
+	return (char*) (DELAYMAP + i * BLKSIZE);
+  80398d:	c1 e0 0c             	shl    $0xc,%eax
+  803990:	2d 00 00 00 20       	sub    $0x20000000,%eax
+  803995:	8b 55 10             	mov    0x10(%ebp),%edx
+  803998:	89 02                	mov    %eax,(%edx)
+}
+  80399a:	89 d8                	mov    %ebx,%eax
+  80399c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80399f:	5b                   	pop    %ebx
+  8039a0:	5e                   	pop    %esi
+  8039a1:	5d                   	pop    %ebp
+  8039a2:	c3                   	ret
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 1)) < 0)
+  8039a3:	83 ec 0c             	sub    $0xc,%esp
+  8039a6:	6a 01                	push   $0x1
+  8039a8:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8039ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039ae:	89 f0                	mov    %esi,%eax
+  8039b0:	e8 32 f9 ff ff       	call   8032e7 <file_block_walk>
+  8039b5:	89 c3                	mov    %eax,%ebx
+  8039b7:	83 c4 10             	add    $0x10,%esp
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	78 dc                	js     80399a <file_get_block+0x82>
+	if ((r = alloc_block_near(file_alloc_hint(f, filebno))) < 0)
+  8039be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039c1:	89 f0                	mov    %esi,%eax
+  8039c3:	e8 39 fa ff ff       	call   803401 <file_alloc_hint>
+  8039c8:	e8 d5 f1 ff ff       	call   802ba2 <alloc_block_near>
+  8039cd:	89 c3                	mov    %eax,%ebx
+  8039cf:	85 c0                	test   %eax,%eax
+  8039d1:	78 c7                	js     80399a <file_get_block+0x82>
+	*ppdiskbno = r;
+  8039d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039d6:	89 18                	mov    %ebx,(%eax)
+	bc_new_block(r);
+  8039d8:	83 ec 0c             	sub    $0xc,%esp
+  8039db:	53                   	push   %ebx
+  8039dc:	e8 8e ec ff ff       	call   80266f <bc_new_block>
+	if (blk)
+  8039e1:	83 c4 10             	add    $0x10,%esp
+  8039e4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039e8:	74 18                	je     803a02 <file_get_block+0xea>
+		*blk = diskaddr(r);
+  8039ea:	83 ec 0c             	sub    $0xc,%esp
+  8039ed:	53                   	push   %ebx
+  8039ee:	e8 36 e0 ff ff       	call   801a29 <diskaddr>
+  8039f3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039f6:	89 02                	mov    %eax,(%edx)
+  8039f8:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  8039fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a00:	eb 98                	jmp    80399a <file_get_block+0x82>
+  803a02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a07:	eb 91                	jmp    80399a <file_get_block+0x82>
+
+00803a09 <file_spill>:
+{
+  803a09:	55                   	push   %ebp
+  803a0a:	89 e5                	mov    %esp,%ebp
+  803a0c:	57                   	push   %edi
+  803a0d:	56                   	push   %esi
+  803a0e:	53                   	push   %ebx
+  803a0f:	83 ec 4c             	sub    $0x4c,%esp
+		return 0;
+  803a12:	be 00 00 00 00       	mov    $0x0,%esi
+	if (!(f->f_flags & FFLAG_INLINE))
+  803a17:	f6 80 c0 00 00 00 01 	testb  $0x1,0xc0(%eax)
+  803a1e:	75 0a                	jne    803a2a <file_spill+0x21>
+}
+  803a20:	89 f0                	mov    %esi,%eax
+  803a22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a25:	5b                   	pop    %ebx
+  803a26:	5e                   	pop    %esi
+  803a27:	5f                   	pop    %edi
+  803a28:	5d                   	pop    %ebp
+  803a29:	c3                   	ret
+  803a2a:	89 c3                	mov    %eax,%ebx
+	memmove(data, f->f_inline, FINLINE);
+  803a2c:	8d b8 c4 00 00 00    	lea    0xc4(%eax),%edi
+  803a32:	83 ec 04             	sub    $0x4,%esp
+  803a35:	6a 3c                	push   $0x3c
+  803a37:	57                   	push   %edi
+  803a38:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  803a3b:	50                   	push   %eax
+  803a3c:	e8 1c 35 00 00       	call   806f5d <memmove>
+	f->f_flags &= ~FFLAG_INLINE;
+  803a41:	83 a3 c0 00 00 00 fe 	andl   $0xfffffffe,0xc0(%ebx)
+	memset(f->f_inline, 0, FINLINE);
+  803a48:	83 c4 0c             	add    $0xc,%esp
+  803a4b:	6a 3c                	push   $0x3c
+  803a4d:	6a 00                	push   $0x0
+  803a4f:	57                   	push   %edi
+  803a50:	e8 d3 34 00 00       	call   806f28 <memset>
+	if (f->f_size == 0)
+  803a55:	8b b3 80 00 00 00    	mov    0x80(%ebx),%esi
+  803a5b:	83 c4 10             	add    $0x10,%esp
+  803a5e:	85 f6                	test   %esi,%esi
+  803a60:	74 be                	je     803a20 <file_spill+0x17>
+	if ((r = file_get_block(f, 0, &blk)) < 0) {
+  803a62:	83 ec 04             	sub    $0x4,%esp
+  803a65:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  803a68:	50                   	push   %eax
+  803a69:	6a 00                	push   $0x0
+  803a6b:	53                   	push   %ebx
+  803a6c:	e8 a7 fe ff ff       	call   803918 <file_get_block>
+  803a71:	89 c6                	mov    %eax,%esi
+  803a73:	83 c4 10             	add    $0x10,%esp
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	78 1f                	js     803a99 <file_spill+0x90>
+	memmove(blk, data, f->f_size);
+  803a7a:	83 ec 04             	sub    $0x4,%esp
+  803a7d:	ff b3 80 00 00 00    	push   0x80(%ebx)
+  803a83:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  803a86:	50                   	push   %eax
+  803a87:	ff 75 a8             	push   -0x58(%ebp)
+  803a8a:	e8 ce 34 00 00       	call   806f5d <memmove>
+	return 0;
+  803a8f:	83 c4 10             	add    $0x10,%esp
+  803a92:	be 00 00 00 00       	mov    $0x0,%esi
+  803a97:	eb 87                	jmp    803a20 <file_spill+0x17>
+		memmove(f->f_inline, data, FINLINE);
+  803a99:	83 ec 04             	sub    $0x4,%esp
+  803a9c:	6a 3c                	push   $0x3c
+  803a9e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  803aa1:	50                   	push   %eax
+  803aa2:	57                   	push   %edi
+  803aa3:	e8 b5 34 00 00       	call   806f5d <memmove>
+		f->f_flags |= FFLAG_INLINE;
+  803aa8:	83 8b c0 00 00 00 01 	orl    $0x1,0xc0(%ebx)
+		return r;
+  803aaf:	83 c4 10             	add    $0x10,%esp
+  803ab2:	e9 69 ff ff ff       	jmp    803a20 <file_spill+0x17>
+
+00803ab7 <dir_entry>:
+{
+  803ab7:	55                   	push   %ebp
+  803ab8:	89 e5                	mov    %esp,%ebp
+  803aba:	56                   	push   %esi
+  803abb:	53                   	push   %ebx
+  803abc:	83 ec 14             	sub    $0x14,%esp
+  803abf:	89 d3                	mov    %edx,%ebx
+  803ac1:	89 ce                	mov    %ecx,%esi
+	if ((r = file_get_block(dir, entno / BLKFILES, &blk)) < 0)
+  803ac3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ac6:	52                   	push   %edx
+  803ac7:	89 da                	mov    %ebx,%edx
+  803ac9:	c1 ea 04             	shr    $0x4,%edx
+  803acc:	52                   	push   %edx
+  803acd:	50                   	push   %eax
+  803ace:	e8 45 fe ff ff       	call   803918 <file_get_block>
+  803ad3:	83 c4 10             	add    $0x10,%esp
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	78 10                	js     803aea <dir_entry+0x33>
+	*pf = (struct File*) blk + entno % BLKFILES;
+  803ada:	83 e3 0f             	and    $0xf,%ebx
+  803add:	c1 e3 08             	shl    $0x8,%ebx
+  803ae0:	03 5d f4             	add    -0xc(%ebp),%ebx
+  803ae3:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+  803ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803aed:	5b                   	pop    %ebx
+  803aee:	5e                   	pop    %esi
+  803aef:	5d                   	pop    %ebp
+  803af0:	c3                   	ret
+
+00803af1 <walk_path>:
+{
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	57                   	push   %edi
+  803af5:	56                   	push   %esi
+  803af6:	53                   	push   %ebx
+  803af7:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  803afd:	89 c3                	mov    %eax,%ebx
+  803aff:	89 d6                	mov    %edx,%esi
+  803b01:	89 cf                	mov    %ecx,%edi
+	while (*p == '/')
+  803b03:	eb 03                	jmp    803b08 <walk_path+0x17>
+		p++;
+  803b05:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  803b08:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  803b0b:	74 f8                	je     803b05 <walk_path+0x14>
+	f = &super->s_root;
+  803b0d:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  803b12:	83 c0 08             	add    $0x8,%eax
+  803b15:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+	name[0] = 0;
+  803b1b:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+	if (pdir)
+  803b22:	85 f6                	test   %esi,%esi
+  803b24:	74 06                	je     803b2c <walk_path+0x3b>
+		*pdir = 0;
+  803b26:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	*pf = 0;
+  803b2c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	dir = 0;
+  803b32:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+  803b39:	00 00 00 
+  803b3c:	89 b5 44 ff ff ff    	mov    %esi,-0xbc(%ebp)
+  803b42:	89 bd 40 ff ff ff    	mov    %edi,-0xc0(%ebp)
+	while (*path != '\0') {
+  803b48:	e9 81 00 00 00       	jmp    803bce <walk_path+0xdd>
+			path++;
+  803b4d:	83 c6 01             	add    $0x1,%esi
+		while (*path != '/' && *path != '\0')
+  803b50:	0f b6 06             	movzbl (%esi),%eax
+  803b53:	3c 2f                	cmp    $0x2f,%al
+  803b55:	74 04                	je     803b5b <walk_path+0x6a>
+  803b57:	84 c0                	test   %al,%al
+  803b59:	75 f2                	jne    803b4d <walk_path+0x5c>
+		if (path - p >= MAXNAMELEN)
+  803b5b:	89 f7                	mov    %esi,%edi
+  803b5d:	29 df                	sub    %ebx,%edi
+  803b5f:	83 ff 7f             	cmp    $0x7f,%edi
+  803b62:	0f 8f 9b 02 00 00    	jg     803e03 <walk_path+0x312>
+		memmove(name, p, path - p);
+  803b68:	83 ec 04             	sub    $0x4,%esp
+  803b6b:	57                   	push   %edi
+  803b6c:	53                   	push   %ebx
+  803b6d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803b73:	50                   	push   %eax
+  803b74:	e8 e4 33 00 00       	call   806f5d <memmove>
+		name[path - p] = '\0';
+  803b79:	c6 84 3d 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%edi,1)
+  803b80:	00 
+	while (*p == '/')
+  803b81:	83 c4 10             	add    $0x10,%esp
+  803b84:	89 f3                	mov    %esi,%ebx
+  803b86:	eb 03                	jmp    803b8b <walk_path+0x9a>
+		p++;
+  803b88:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  803b8b:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  803b8e:	74 f8                	je     803b88 <walk_path+0x97>
+		if (dir->f_type != FTYPE_DIR)
+  803b90:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803b96:	83 ba 84 00 00 00 01 	cmpl   $0x1,0x84(%edx)
+  803b9d:	0f 85 67 02 00 00    	jne    803e0a <walk_path+0x319>
+		if (!dcache_lookup(dir, name, &f)) {
+  803ba3:	83 ec 04             	sub    $0x4,%esp
+  803ba6:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  803bac:	50                   	push   %eax
+  803bad:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803bb3:	50                   	push   %eax
+  803bb4:	52                   	push   %edx
+  803bb5:	e8 15 0f 00 00       	call   804acf <dcache_lookup>
+  803bba:	83 c4 10             	add    $0x10,%esp
+  803bbd:	84 c0                	test   %al,%al
+  803bbf:	74 29                	je     803bea <walk_path+0xf9>
+		if (f == 0) {
+  803bc1:	83 bd 64 ff ff ff 00 	cmpl   $0x0,-0x9c(%ebp)
+  803bc8:	0f 84 be 01 00 00    	je     803d8c <walk_path+0x29b>
+	while (*path != '\0') {
+  803bce:	80 3b 00             	cmpb   $0x0,(%ebx)
+  803bd1:	0f 84 ff 01 00 00    	je     803dd6 <walk_path+0x2e5>
+		dir = f;
+  803bd7:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  803bdd:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+		while (*path != '/' && *path != '\0')
+  803be3:	89 de                	mov    %ebx,%esi
+  803be5:	e9 66 ff ff ff       	jmp    803b50 <walk_path+0x5f>
+	assert((dir->f_size % BLKSIZE) == 0);
+  803bea:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  803bf0:	66 f7 80 80 00 00 00 	testw  $0xfff,0x80(%eax)
+  803bf7:	ff 0f 
+  803bf9:	0f 85 ce 00 00 00    	jne    803ccd <walk_path+0x1dc>
+	if ((di = dir_index(dir)) != 0) {
+  803bff:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  803c05:	e8 2a f0 ff ff       	call   802c34 <dir_index>
+  803c0a:	89 c6                	mov    %eax,%esi
+
+// Hash a file name for a directory index (FNV-1a)
+static inline uint32_t
+dir_hash(const char *name)
+{
+	uint32_t h = 2166136261U;
+  803c0c:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+  803c11:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  803c17:	85 c0                	test   %eax,%eax
+  803c19:	0f 85 d5 00 00 00    	jne    803cf4 <walk_path+0x203>
+	nblock = dir->f_size / BLKSIZE;
+  803c1f:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  803c25:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  803c2b:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  803c31:	85 d2                	test   %edx,%edx
+  803c33:	0f 49 c2             	cmovns %edx,%eax
+  803c36:	c1 f8 0c             	sar    $0xc,%eax
+  803c39:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+	for (i = 0; i < nblock; i++) {
+  803c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c44:	89 9d 48 ff ff ff    	mov    %ebx,-0xb8(%ebp)
+  803c4a:	89 c3                	mov    %eax,%ebx
+  803c4c:	39 9d 50 ff ff ff    	cmp    %ebx,-0xb0(%ebp)
+  803c52:	0f 84 29 01 00 00    	je     803d81 <walk_path+0x290>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  803c58:	83 ec 04             	sub    $0x4,%esp
+  803c5b:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  803c61:	50                   	push   %eax
+  803c62:	53                   	push   %ebx
+  803c63:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803c69:	e8 aa fc ff ff       	call   803918 <file_get_block>
+  803c6e:	83 c4 10             	add    $0x10,%esp
+  803c71:	85 c0                	test   %eax,%eax
+  803c73:	0f 88 db 01 00 00    	js     803e54 <walk_path+0x363>
+		f = (struct File*) blk;
+  803c79:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+  803c7f:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+		for (j = 0; j < BLKFILES; j++)
+  803c85:	89 f7                	mov    %esi,%edi
+  803c87:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803c8d:	89 9d 4c ff ff ff    	mov    %ebx,-0xb4(%ebp)
+  803c93:	39 f7                	cmp    %esi,%edi
+  803c95:	0f 84 d8 00 00 00    	je     803d73 <walk_path+0x282>
+			if (strcmp(f[j].f_name, name) == 0) {
+  803c9b:	89 fb                	mov    %edi,%ebx
+  803c9d:	83 ec 08             	sub    $0x8,%esp
+  803ca0:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803ca6:	50                   	push   %eax
+  803ca7:	57                   	push   %edi
+  803ca8:	e8 db 31 00 00       	call   806e88 <strcmp>
+  803cad:	81 c7 00 01 00 00    	add    $0x100,%edi
+  803cb3:	83 c4 10             	add    $0x10,%esp
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	75 d9                	jne    803c93 <walk_path+0x1a2>
+  803cba:	89 de                	mov    %ebx,%esi
+  803cbc:	8b 9d 48 ff ff ff    	mov    -0xb8(%ebp),%ebx
+				*file = &f[j];
+  803cc2:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+  803cc8:	e9 64 01 00 00       	jmp    803e31 <walk_path+0x340>
+	assert((dir->f_size % BLKSIZE) == 0);
+  803ccd:	68 af b2 80 00       	push   $0x80b2af
+  803cd2:	68 2b ad 80 00       	push   $0x80ad2b
+  803cd7:	68 05 03 00 00       	push   $0x305
+  803cdc:	68 e9 b1 80 00       	push   $0x80b1e9
+  803ce1:	e8 32 2a 00 00       	call   806718 <_panic>
+
+	while (*name)
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  803ce6:	83 c2 01             	add    $0x1,%edx
+  803ce9:	0f b6 c0             	movzbl %al,%eax
+  803cec:	31 c1                	xor    %eax,%ecx
+  803cee:	69 c9 93 01 00 01    	imul   $0x1000193,%ecx,%ecx
+	while (*name)
+  803cf4:	0f b6 02             	movzbl (%edx),%eax
+  803cf7:	84 c0                	test   %al,%al
+  803cf9:	75 eb                	jne    803ce6 <walk_path+0x1f5>
+	return h % DIRINDEX_NBUCKETS;
+  803cfb:	89 ca                	mov    %ecx,%edx
+  803cfd:	d1 ea                	shr    %edx
+  803cff:	bf 11 20 40 80       	mov    $0x80402011,%edi
+  803d04:	89 d0                	mov    %edx,%eax
+  803d06:	f7 e7                	mul    %edi
+  803d08:	c1 ea 08             	shr    $0x8,%edx
+  803d0b:	69 d2 fe 03 00 00    	imul   $0x3fe,%edx,%edx
+  803d11:	29 d1                	sub    %edx,%ecx
+		for (e = di->di_bucket[dir_hash(name)]; e; e = f->f_hnext) {
+  803d13:	8b 44 8e 08          	mov    0x8(%esi,%ecx,4),%eax
+			if (strcmp(f->f_name, name) == 0) {
+  803d17:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  803d1d:	89 9d 50 ff ff ff    	mov    %ebx,-0xb0(%ebp)
+  803d23:	8b 9d 54 ff ff ff    	mov    -0xac(%ebp),%ebx
+		for (e = di->di_bucket[dir_hash(name)]; e; e = f->f_hnext) {
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	74 3b                	je     803d68 <walk_path+0x277>
+			if ((r = dir_entry(dir, e - 1, &f)) < 0)
+  803d2d:	8d 50 ff             	lea    -0x1(%eax),%edx
+  803d30:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  803d36:	89 d8                	mov    %ebx,%eax
+  803d38:	e8 7a fd ff ff       	call   803ab7 <dir_entry>
+  803d3d:	85 c0                	test   %eax,%eax
+  803d3f:	0f 88 d7 00 00 00    	js     803e1c <walk_path+0x32b>
+			if (strcmp(f->f_name, name) == 0) {
+  803d45:	8b b5 60 ff ff ff    	mov    -0xa0(%ebp),%esi
+  803d4b:	83 ec 08             	sub    $0x8,%esp
+  803d4e:	57                   	push   %edi
+  803d4f:	56                   	push   %esi
+  803d50:	e8 33 31 00 00       	call   806e88 <strcmp>
+  803d55:	83 c4 10             	add    $0x10,%esp
+  803d58:	85 c0                	test   %eax,%eax
+  803d5a:	0f 84 b1 00 00 00    	je     803e11 <walk_path+0x320>
+		for (e = di->di_bucket[dir_hash(name)]; e; e = f->f_hnext) {
+  803d60:	8b 86 bc 00 00 00    	mov    0xbc(%esi),%eax
+  803d66:	eb c1                	jmp    803d29 <walk_path+0x238>
+  803d68:	8b 9d 50 ff ff ff    	mov    -0xb0(%ebp),%ebx
+  803d6e:	e9 b4 00 00 00       	jmp    803e27 <walk_path+0x336>
+	for (i = 0; i < nblock; i++) {
+  803d73:	8b 9d 4c ff ff ff    	mov    -0xb4(%ebp),%ebx
+  803d79:	83 c3 01             	add    $0x1,%ebx
+  803d7c:	e9 cb fe ff ff       	jmp    803c4c <walk_path+0x15b>
+  803d81:	8b 9d 48 ff ff ff    	mov    -0xb8(%ebp),%ebx
+  803d87:	e9 9b 00 00 00       	jmp    803e27 <walk_path+0x336>
+			return -E_NOT_FOUND;
+  803d8c:	8b b5 44 ff ff ff    	mov    -0xbc(%ebp),%esi
+  803d92:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+  803d98:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+			if (*path == '\0') {
+  803d9d:	80 3b 00             	cmpb   $0x0,(%ebx)
+  803da0:	75 59                	jne    803dfb <walk_path+0x30a>
+				if (pdir)
+  803da2:	85 f6                	test   %esi,%esi
+  803da4:	74 08                	je     803dae <walk_path+0x2bd>
+					*pdir = dir;
+  803da6:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  803dac:	89 06                	mov    %eax,(%esi)
+				if (lastelem)
+  803dae:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803db2:	74 15                	je     803dc9 <walk_path+0x2d8>
+					strcpy(lastelem, name);
+  803db4:	83 ec 08             	sub    $0x8,%esp
+  803db7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803dbd:	50                   	push   %eax
+  803dbe:	ff 75 08             	push   0x8(%ebp)
+  803dc1:	e8 11 30 00 00       	call   806dd7 <strcpy>
+  803dc6:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  803dc9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+			return -E_NOT_FOUND;
+  803dcf:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  803dd4:	eb 25                	jmp    803dfb <walk_path+0x30a>
+	if (pdir)
+  803dd6:	8b b5 44 ff ff ff    	mov    -0xbc(%ebp),%esi
+  803ddc:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+  803de2:	85 f6                	test   %esi,%esi
+  803de4:	74 08                	je     803dee <walk_path+0x2fd>
+		*pdir = dir;
+  803de6:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  803dec:	89 06                	mov    %eax,(%esi)
+	*pf = f;
+  803dee:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  803df4:	89 07                	mov    %eax,(%edi)
+	return 0;
+  803df6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dfe:	5b                   	pop    %ebx
+  803dff:	5e                   	pop    %esi
+  803e00:	5f                   	pop    %edi
+  803e01:	5d                   	pop    %ebp
+  803e02:	c3                   	ret
+			return -E_BAD_PATH;
+  803e03:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  803e08:	eb f1                	jmp    803dfb <walk_path+0x30a>
+			return -E_NOT_FOUND;
+  803e0a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  803e0f:	eb ea                	jmp    803dfb <walk_path+0x30a>
+  803e11:	8b 9d 50 ff ff ff    	mov    -0xb0(%ebp),%ebx
+  803e17:	e9 a6 fe ff ff       	jmp    803cc2 <walk_path+0x1d1>
+  803e1c:	8b 9d 50 ff ff ff    	mov    -0xb0(%ebp),%ebx
+				if (r != -E_NOT_FOUND)
+  803e22:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803e25:	75 d4                	jne    803dfb <walk_path+0x30a>
+				f = 0;
+  803e27:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+  803e2e:	00 00 00 
+			dcache_enter(dir, name, f);
+  803e31:	83 ec 04             	sub    $0x4,%esp
+  803e34:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  803e3a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803e40:	50                   	push   %eax
+  803e41:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803e47:	e8 d3 0c 00 00       	call   804b1f <dcache_enter>
+  803e4c:	83 c4 10             	add    $0x10,%esp
+  803e4f:	e9 6d fd ff ff       	jmp    803bc1 <walk_path+0xd0>
+  803e54:	8b 9d 48 ff ff ff    	mov    -0xb8(%ebp),%ebx
+  803e5a:	eb c6                	jmp    803e22 <walk_path+0x331>
+
+00803e5c <file_create>:
+{
+  803e5c:	55                   	push   %ebp
+  803e5d:	89 e5                	mov    %esp,%ebp
+  803e5f:	57                   	push   %edi
+  803e60:	56                   	push   %esi
+  803e61:	53                   	push   %ebx
+  803e62:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  803e68:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803e6e:	50                   	push   %eax
+  803e6f:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  803e75:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  803e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e7e:	e8 6e fc ff ff       	call   803af1 <walk_path>
+  803e83:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803e89:	83 c4 10             	add    $0x10,%esp
+  803e8c:	85 c0                	test   %eax,%eax
+  803e8e:	0f 84 c9 02 00 00    	je     80415d <file_create+0x301>
+	if (r != -E_NOT_FOUND || dir == 0)
+  803e94:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803e97:	0f 85 aa 02 00 00    	jne    804147 <file_create+0x2eb>
+  803e9d:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+  803ea3:	85 f6                	test   %esi,%esi
+  803ea5:	0f 84 9c 02 00 00    	je     804147 <file_create+0x2eb>
+	assert((dir->f_size % BLKSIZE) == 0);
+  803eab:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  803eb1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803eb6:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803ebc:	75 46                	jne    803f04 <file_create+0xa8>
+	if (!dir_index(dir) && dir->f_size / BLKSIZE >= DIRINDEX_MINBLOCKS
+  803ebe:	89 f0                	mov    %esi,%eax
+  803ec0:	e8 6f ed ff ff       	call   802c34 <dir_index>
+  803ec5:	85 c0                	test   %eax,%eax
+  803ec7:	74 54                	je     803f1d <file_create+0xc1>
+	di = dir_index(dir);
+  803ec9:	89 f0                	mov    %esi,%eax
+  803ecb:	e8 64 ed ff ff       	call   802c34 <dir_index>
+  803ed0:	89 c2                	mov    %eax,%edx
+  803ed2:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+	nent = dir->f_size / BLKSIZE * BLKFILES;
+  803ed8:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  803ede:	8d b8 ff 0f 00 00    	lea    0xfff(%eax),%edi
+  803ee4:	85 c0                	test   %eax,%eax
+  803ee6:	0f 49 f8             	cmovns %eax,%edi
+  803ee9:	c1 ff 0c             	sar    $0xc,%edi
+  803eec:	c1 e7 04             	shl    $0x4,%edi
+	for (entno = di ? di->di_free : 0; entno < nent; entno++) {
+  803eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ef4:	85 d2                	test   %edx,%edx
+  803ef6:	0f 84 2f 01 00 00    	je     80402b <file_create+0x1cf>
+  803efc:	8b 5a 04             	mov    0x4(%edx),%ebx
+  803eff:	e9 27 01 00 00       	jmp    80402b <file_create+0x1cf>
+	assert((dir->f_size % BLKSIZE) == 0);
+  803f04:	68 af b2 80 00       	push   $0x80b2af
+  803f09:	68 2b ad 80 00       	push   $0x80ad2b
+  803f0e:	68 2e 03 00 00       	push   $0x32e
+  803f13:	68 e9 b1 80 00       	push   $0x80b1e9
+  803f18:	e8 fb 27 00 00       	call   806718 <_panic>
+	if (!dir_index(dir) && dir->f_size / BLKSIZE >= DIRINDEX_MINBLOCKS
+  803f1d:	81 be 80 00 00 00 ff 	cmpl   $0x1fff,0x80(%esi)
+  803f24:	1f 00 00 
+  803f27:	7e a0                	jle    803ec9 <file_create+0x6d>
+	if ((blockno = alloc_block()) < 0)
+  803f29:	e8 5c f3 ff ff       	call   80328a <alloc_block>
+  803f2e:	89 c3                	mov    %eax,%ebx
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	78 40                	js     803f74 <file_create+0x118>
+	bc_new_block(blockno);
+  803f34:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  803f3a:	83 ec 0c             	sub    $0xc,%esp
+  803f3d:	50                   	push   %eax
+  803f3e:	e8 2c e7 ff ff       	call   80266f <bc_new_block>
+	di = diskaddr(blockno);
+  803f43:	89 1c 24             	mov    %ebx,(%esp)
+  803f46:	e8 de da ff ff       	call   801a29 <diskaddr>
+  803f4b:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+	di->di_magic = DIRINDEX_MAGIC;
+  803f51:	c7 00 45 52 54 48    	movl   $0x48545245,(%eax)
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+  803f57:	83 c4 10             	add    $0x10,%esp
+  803f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f5f:	eb 70                	jmp    803fd1 <file_create+0x175>
+	free_block(blockno);
+  803f61:	89 c3                	mov    %eax,%ebx
+  803f63:	83 ec 0c             	sub    $0xc,%esp
+  803f66:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  803f6c:	e8 c4 f2 ff ff       	call   803235 <free_block>
+	return r;
+  803f71:	83 c4 10             	add    $0x10,%esp
+		cprintf("warning: dir_build_index: %e\n", r);
+  803f74:	83 ec 08             	sub    $0x8,%esp
+  803f77:	53                   	push   %ebx
+  803f78:	68 cc b2 80 00       	push   $0x80b2cc
+  803f7d:	e8 71 28 00 00       	call   8067f3 <cprintf>
+  803f82:	83 c4 10             	add    $0x10,%esp
+  803f85:	e9 3f ff ff ff       	jmp    803ec9 <file_create+0x6d>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  803f8a:	83 c2 01             	add    $0x1,%edx
+  803f8d:	0f b6 c0             	movzbl %al,%eax
+  803f90:	31 c8                	xor    %ecx,%eax
+  803f92:	69 c8 93 01 00 01    	imul   $0x1000193,%eax,%ecx
+	while (*name)
+  803f98:	0f b6 02             	movzbl (%edx),%eax
+  803f9b:	84 c0                	test   %al,%al
+  803f9d:	75 eb                	jne    803f8a <file_create+0x12e>
+	return h % DIRINDEX_NBUCKETS;
+  803f9f:	89 c8                	mov    %ecx,%eax
+  803fa1:	d1 e8                	shr    %eax
+  803fa3:	ba 11 20 40 80       	mov    $0x80402011,%edx
+  803fa8:	f7 e2                	mul    %edx
+  803faa:	c1 ea 08             	shr    $0x8,%edx
+  803fad:	69 c2 fe 03 00 00    	imul   $0x3fe,%edx,%eax
+  803fb3:	89 ca                	mov    %ecx,%edx
+  803fb5:	29 c2                	sub    %eax,%edx
+	f->f_hnext = di->di_bucket[h];
+  803fb7:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  803fbd:	8b 44 91 08          	mov    0x8(%ecx,%edx,4),%eax
+  803fc1:	89 83 bc 00 00 00    	mov    %eax,0xbc(%ebx)
+	di->di_bucket[h] = entno + 1;
+  803fc7:	8d 47 01             	lea    0x1(%edi),%eax
+  803fca:	89 44 91 08          	mov    %eax,0x8(%ecx,%edx,4)
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+  803fce:	83 c7 01             	add    $0x1,%edi
+  803fd1:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  803fd7:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  803fdd:	85 d2                	test   %edx,%edx
+  803fdf:	0f 49 c2             	cmovns %edx,%eax
+  803fe2:	c1 f8 0c             	sar    $0xc,%eax
+  803fe5:	c1 e0 04             	shl    $0x4,%eax
+  803fe8:	39 c7                	cmp    %eax,%edi
+  803fea:	73 2b                	jae    804017 <file_create+0x1bb>
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+  803fec:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  803ff2:	89 fa                	mov    %edi,%edx
+  803ff4:	89 f0                	mov    %esi,%eax
+  803ff6:	e8 bc fa ff ff       	call   803ab7 <dir_entry>
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	0f 88 5e ff ff ff    	js     803f61 <file_create+0x105>
+		if (f->f_name[0] != '\0')
+  804003:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+	uint32_t h = dir_hash(f->f_name);
+  804009:	89 da                	mov    %ebx,%edx
+	uint32_t h = 2166136261U;
+  80400b:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+		if (f->f_name[0] != '\0')
+  804010:	80 3b 00             	cmpb   $0x0,(%ebx)
+  804013:	74 b9                	je     803fce <file_create+0x172>
+  804015:	eb 81                	jmp    803f98 <file_create+0x13c>
+	dir->f_dirindex = blockno;
+  804017:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  80401d:	89 86 b8 00 00 00    	mov    %eax,0xb8(%esi)
+	return 0;
+  804023:	e9 a1 fe ff ff       	jmp    803ec9 <file_create+0x6d>
+	for (entno = di ? di->di_free : 0; entno < nent; entno++) {
+  804028:	83 c3 01             	add    $0x1,%ebx
+  80402b:	39 fb                	cmp    %edi,%ebx
+  80402d:	73 7c                	jae    8040ab <file_create+0x24f>
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+  80402f:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  804035:	89 da                	mov    %ebx,%edx
+  804037:	89 f0                	mov    %esi,%eax
+  804039:	e8 79 fa ff ff       	call   803ab7 <dir_entry>
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	0f 88 0f 01 00 00    	js     804155 <file_create+0x2f9>
+		if (f->f_name[0] == '\0')
+  804046:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  80404c:	80 38 00             	cmpb   $0x0,(%eax)
+  80404f:	75 d7                	jne    804028 <file_create+0x1cc>
+	memset(f, 0, sizeof *f);
+  804051:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  804057:	89 c7                	mov    %eax,%edi
+  804059:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  80405f:	83 ec 04             	sub    $0x4,%esp
+  804062:	68 00 01 00 00       	push   $0x100
+  804067:	6a 00                	push   $0x0
+  804069:	50                   	push   %eax
+  80406a:	e8 b9 2e 00 00       	call   806f28 <memset>
+	strcpy(f->f_name, name);
+  80406f:	83 c4 08             	add    $0x8,%esp
+  804072:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804078:	50                   	push   %eax
+  804079:	57                   	push   %edi
+  80407a:	e8 58 2d 00 00       	call   806dd7 <strcpy>
+	if (di) {
+  80407f:	83 c4 10             	add    $0x10,%esp
+  804082:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+  804087:	83 bd 50 ff ff ff 00 	cmpl   $0x0,-0xb0(%ebp)
+  80408e:	0f 84 84 00 00 00    	je     804118 <file_create+0x2bc>
+	while (*name)
+  804094:	0f b6 07             	movzbl (%edi),%eax
+  804097:	84 c0                	test   %al,%al
+  804099:	74 43                	je     8040de <file_create+0x282>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  80409b:	83 c7 01             	add    $0x1,%edi
+  80409e:	0f b6 c0             	movzbl %al,%eax
+  8040a1:	31 c1                	xor    %eax,%ecx
+  8040a3:	69 c9 93 01 00 01    	imul   $0x1000193,%ecx,%ecx
+  8040a9:	eb e9                	jmp    804094 <file_create+0x238>
+	if (entno == nent) {
+  8040ab:	39 df                	cmp    %ebx,%edi
+  8040ad:	75 a2                	jne    804051 <file_create+0x1f5>
+		dir->f_size += BLKSIZE;
+  8040af:	81 86 80 00 00 00 00 	addl   $0x1000,0x80(%esi)
+  8040b6:	10 00 00 
+		if ((r = dir_entry(dir, entno, &f)) < 0) {
+  8040b9:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  8040bf:	89 da                	mov    %ebx,%edx
+  8040c1:	89 f0                	mov    %esi,%eax
+  8040c3:	e8 ef f9 ff ff       	call   803ab7 <dir_entry>
+  8040c8:	85 c0                	test   %eax,%eax
+  8040ca:	79 85                	jns    804051 <file_create+0x1f5>
+			dir->f_size -= BLKSIZE;
+  8040cc:	81 ae 80 00 00 00 00 	subl   $0x1000,0x80(%esi)
+  8040d3:	10 00 00 
+			return r;
+  8040d6:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8040dc:	eb 69                	jmp    804147 <file_create+0x2eb>
+	return h % DIRINDEX_NBUCKETS;
+  8040de:	89 ca                	mov    %ecx,%edx
+  8040e0:	d1 ea                	shr    %edx
+  8040e2:	bf 11 20 40 80       	mov    $0x80402011,%edi
+  8040e7:	89 d0                	mov    %edx,%eax
+  8040e9:	f7 e7                	mul    %edi
+  8040eb:	c1 ea 08             	shr    $0x8,%edx
+  8040ee:	69 c2 fe 03 00 00    	imul   $0x3fe,%edx,%eax
+  8040f4:	89 ca                	mov    %ecx,%edx
+  8040f6:	29 c2                	sub    %eax,%edx
+	f->f_hnext = di->di_bucket[h];
+  8040f8:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  8040fe:	8b 44 97 08          	mov    0x8(%edi,%edx,4),%eax
+  804102:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  804108:	89 81 bc 00 00 00    	mov    %eax,0xbc(%ecx)
+	di->di_bucket[h] = entno + 1;
+  80410e:	83 c3 01             	add    $0x1,%ebx
+  804111:	89 5c 97 08          	mov    %ebx,0x8(%edi,%edx,4)
+		di->di_free = entno + 1;
+  804115:	89 5f 04             	mov    %ebx,0x4(%edi)
+	*file = f;
+  804118:	8b bd 4c ff ff ff    	mov    -0xb4(%ebp),%edi
+  80411e:	89 bd 60 ff ff ff    	mov    %edi,-0xa0(%ebp)
+	f->f_flags = FFLAG_INLINE;
+  804124:	c7 87 c0 00 00 00 01 	movl   $0x1,0xc0(%edi)
+  80412b:	00 00 00 
+	dcache_enter(dir, name, f);
+  80412e:	83 ec 04             	sub    $0x4,%esp
+  804131:	57                   	push   %edi
+  804132:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804138:	50                   	push   %eax
+  804139:	56                   	push   %esi
+  80413a:	e8 e0 09 00 00       	call   804b1f <dcache_enter>
+	*pf = f;
+  80413f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804142:	89 38                	mov    %edi,(%eax)
+	return 0;
+  804144:	83 c4 10             	add    $0x10,%esp
+}
+  804147:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  80414d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804150:	5b                   	pop    %ebx
+  804151:	5e                   	pop    %esi
+  804152:	5f                   	pop    %edi
+  804153:	5d                   	pop    %ebp
+  804154:	c3                   	ret
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+  804155:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80415b:	eb ea                	jmp    804147 <file_create+0x2eb>
+		return -E_FILE_EXISTS;
+  80415d:	c7 85 54 ff ff ff f3 	movl   $0xfffffff3,-0xac(%ebp)
+  804164:	ff ff ff 
+  804167:	eb de                	jmp    804147 <file_create+0x2eb>
+
+00804169 <file_open>:
+{
+  804169:	55                   	push   %ebp
+  80416a:	89 e5                	mov    %esp,%ebp
+  80416c:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  80416f:	6a 00                	push   $0x0
+  804171:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804174:	ba 00 00 00 00       	mov    $0x0,%edx
+  804179:	8b 45 08             	mov    0x8(%ebp),%eax
+  80417c:	e8 70 f9 ff ff       	call   803af1 <walk_path>
+}
+  804181:	c9                   	leave
+  804182:	c3                   	ret
+
+00804183 <file_read>:
+{
+  804183:	55                   	push   %ebp
+  804184:	89 e5                	mov    %esp,%ebp
+  804186:	57                   	push   %edi
+  804187:	56                   	push   %esi
+  804188:	53                   	push   %ebx
+  804189:	83 ec 2c             	sub    $0x2c,%esp
+  80418c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80418f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  804192:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset >= f->f_size)
+  804195:	8b 45 08             	mov    0x8(%ebp),%eax
+  804198:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+		return 0;
+  80419e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  8041a3:	39 da                	cmp    %ebx,%edx
+  8041a5:	0f 8e 83 00 00 00    	jle    80422e <file_read+0xab>
+	count = MIN(count, f->f_size - offset);
+  8041ab:	29 da                	sub    %ebx,%edx
+  8041ad:	39 ca                	cmp    %ecx,%edx
+  8041af:	0f 46 ca             	cmovbe %edx,%ecx
+  8041b2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	if (f->f_flags & FFLAG_INLINE) {
+  8041b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041b8:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+  8041be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8041c1:	89 c6                	mov    %eax,%esi
+  8041c3:	83 e6 01             	and    $0x1,%esi
+  8041c6:	75 4a                	jne    804212 <file_read+0x8f>
+	ra = readahead_lookup(f);
+  8041c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041cb:	e8 bf e8 ff ff       	call   802a8f <readahead_lookup>
+	if (offset == ra->ra_pos)
+  8041d0:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8041d3:	74 61                	je     804236 <file_read+0xb3>
+	ra->ra_window = readahead_window(ra, offset);
+  8041d5:	89 70 08             	mov    %esi,0x8(%eax)
+	ra->ra_pos = offset + count;
+  8041d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8041db:	01 d9                	add    %ebx,%ecx
+  8041dd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8041e0:	89 48 04             	mov    %ecx,0x4(%eax)
+	first = offset / BLKSIZE;
+  8041e3:	8d 93 ff 0f 00 00    	lea    0xfff(%ebx),%edx
+  8041e9:	85 db                	test   %ebx,%ebx
+  8041eb:	0f 49 d3             	cmovns %ebx,%edx
+  8041ee:	c1 fa 0c             	sar    $0xc,%edx
+	file_readahead(f, first, (offset + count - 1) / BLKSIZE - first + 1 + ra->ra_window,
+  8041f1:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  8041f4:	c1 e8 0c             	shr    $0xc,%eax
+  8041f7:	29 d0                	sub    %edx,%eax
+  8041f9:	8d 4c 06 01          	lea    0x1(%esi,%eax,1),%ecx
+  8041fd:	83 ec 0c             	sub    $0xc,%esp
+  804200:	68 28 22 80 00       	push   $0x802228
+  804205:	8b 45 08             	mov    0x8(%ebp),%eax
+  804208:	e8 2d f2 ff ff       	call   80343a <file_readahead>
+	for (pos = offset; pos < offset + count; ) {
+  80420d:	83 c4 10             	add    $0x10,%esp
+  804210:	eb 7a                	jmp    80428c <file_read+0x109>
+		memmove(buf, f->f_inline + offset, count);
+  804212:	83 ec 04             	sub    $0x4,%esp
+  804215:	89 ce                	mov    %ecx,%esi
+  804217:	51                   	push   %ecx
+  804218:	8b 45 08             	mov    0x8(%ebp),%eax
+  80421b:	8d 84 18 c4 00 00 00 	lea    0xc4(%eax,%ebx,1),%eax
+  804222:	50                   	push   %eax
+  804223:	57                   	push   %edi
+  804224:	e8 34 2d 00 00       	call   806f5d <memmove>
+		return count;
+  804229:	89 f0                	mov    %esi,%eax
+  80422b:	83 c4 10             	add    $0x10,%esp
+}
+  80422e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804231:	5b                   	pop    %ebx
+  804232:	5e                   	pop    %esi
+  804233:	5f                   	pop    %edi
+  804234:	5d                   	pop    %ebp
+  804235:	c3                   	ret
+		return MIN(MAX(ra->ra_window * 2, RA_MINBLOCKS), BC_MAXIO);
+  804236:	8b 48 08             	mov    0x8(%eax),%ecx
+  804239:	8d 34 09             	lea    (%ecx,%ecx,1),%esi
+  80423c:	ba 02 00 00 00       	mov    $0x2,%edx
+  804241:	39 d6                	cmp    %edx,%esi
+  804243:	0f 42 f2             	cmovb  %edx,%esi
+  804246:	ba 20 00 00 00       	mov    $0x20,%edx
+  80424b:	39 d6                	cmp    %edx,%esi
+  80424d:	0f 47 f2             	cmova  %edx,%esi
+  804250:	eb 83                	jmp    8041d5 <file_read+0x52>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  804252:	89 da                	mov    %ebx,%edx
+  804254:	c1 fa 1f             	sar    $0x1f,%edx
+  804257:	c1 ea 14             	shr    $0x14,%edx
+  80425a:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  80425d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804262:	29 d0                	sub    %edx,%eax
+  804264:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804269:	29 c1                	sub    %eax,%ecx
+  80426b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80426e:	29 f2                	sub    %esi,%edx
+  804270:	39 d1                	cmp    %edx,%ecx
+  804272:	89 d6                	mov    %edx,%esi
+  804274:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  804277:	83 ec 04             	sub    $0x4,%esp
+  80427a:	56                   	push   %esi
+  80427b:	03 45 e4             	add    -0x1c(%ebp),%eax
+  80427e:	50                   	push   %eax
+  80427f:	57                   	push   %edi
+  804280:	e8 d8 2c 00 00       	call   806f5d <memmove>
+		pos += bn;
+  804285:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  804287:	01 f7                	add    %esi,%edi
+  804289:	83 c4 10             	add    $0x10,%esp
+	for (pos = offset; pos < offset + count; ) {
+  80428c:	89 de                	mov    %ebx,%esi
+  80428e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804291:	39 c3                	cmp    %eax,%ebx
+  804293:	73 2a                	jae    8042bf <file_read+0x13c>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  804295:	83 ec 04             	sub    $0x4,%esp
+  804298:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80429b:	50                   	push   %eax
+  80429c:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  8042a2:	85 db                	test   %ebx,%ebx
+  8042a4:	0f 49 c3             	cmovns %ebx,%eax
+  8042a7:	c1 f8 0c             	sar    $0xc,%eax
+  8042aa:	50                   	push   %eax
+  8042ab:	ff 75 08             	push   0x8(%ebp)
+  8042ae:	e8 65 f6 ff ff       	call   803918 <file_get_block>
+  8042b3:	83 c4 10             	add    $0x10,%esp
+  8042b6:	85 c0                	test   %eax,%eax
+  8042b8:	79 98                	jns    804252 <file_read+0xcf>
+  8042ba:	e9 6f ff ff ff       	jmp    80422e <file_read+0xab>
+	return count;
+  8042bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8042c2:	e9 67 ff ff ff       	jmp    80422e <file_read+0xab>
+
+008042c7 <file_prefetch>:
+{
+  8042c7:	55                   	push   %ebp
+  8042c8:	89 e5                	mov    %esp,%ebp
+  8042ca:	57                   	push   %edi
+  8042cb:	56                   	push   %esi
+  8042cc:	53                   	push   %ebx
+  8042cd:	83 ec 1c             	sub    $0x1c,%esp
+  8042d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (offset < 0 || offset >= f->f_size || count == 0)
+  8042d3:	85 db                	test   %ebx,%ebx
+  8042d5:	78 13                	js     8042ea <file_prefetch+0x23>
+  8042d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042da:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8042e0:	39 d8                	cmp    %ebx,%eax
+  8042e2:	7e 06                	jle    8042ea <file_prefetch+0x23>
+  8042e4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8042e8:	75 08                	jne    8042f2 <file_prefetch+0x2b>
+}
+  8042ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042ed:	5b                   	pop    %ebx
+  8042ee:	5e                   	pop    %esi
+  8042ef:	5f                   	pop    %edi
+  8042f0:	5d                   	pop    %ebp
+  8042f1:	c3                   	ret
+	first = offset / BLKSIZE;
+  8042f2:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8042f8:	85 db                	test   %ebx,%ebx
+  8042fa:	0f 49 fb             	cmovns %ebx,%edi
+  8042fd:	c1 ff 0c             	sar    $0xc,%edi
+	count = MIN(count, f->f_size - offset);
+  804300:	29 d8                	sub    %ebx,%eax
+  804302:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804305:	0f 47 45 10          	cmova  0x10(%ebp),%eax
+	file_readahead(f, first, (offset + count - 1) / BLKSIZE - first + 1
+  804309:	8d 74 03 ff          	lea    -0x1(%ebx,%eax,1),%esi
+  80430d:	c1 ee 0c             	shr    $0xc,%esi
+  804310:	b8 01 00 00 00       	mov    $0x1,%eax
+  804315:	29 f8                	sub    %edi,%eax
+  804317:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		       + readahead_window(readahead_lookup(f), offset), bc_fill);
+  80431a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80431d:	e8 6d e7 ff ff       	call   802a8f <readahead_lookup>
+	return 0;
+  804322:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (offset == ra->ra_pos)
+  804327:	3b 58 04             	cmp    0x4(%eax),%ebx
+  80432a:	74 1e                	je     80434a <file_prefetch+0x83>
+	file_readahead(f, first, (offset + count - 1) / BLKSIZE - first + 1
+  80432c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80432f:	01 f1                	add    %esi,%ecx
+  804331:	01 d1                	add    %edx,%ecx
+  804333:	83 ec 0c             	sub    $0xc,%esp
+  804336:	68 c4 23 80 00       	push   $0x8023c4
+  80433b:	89 fa                	mov    %edi,%edx
+  80433d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804340:	e8 f5 f0 ff ff       	call   80343a <file_readahead>
+  804345:	83 c4 10             	add    $0x10,%esp
+  804348:	eb a0                	jmp    8042ea <file_prefetch+0x23>
+		return MIN(MAX(ra->ra_window * 2, RA_MINBLOCKS), BC_MAXIO);
+  80434a:	8b 50 08             	mov    0x8(%eax),%edx
+  80434d:	01 d2                	add    %edx,%edx
+  80434f:	b8 02 00 00 00       	mov    $0x2,%eax
+  804354:	39 c2                	cmp    %eax,%edx
+  804356:	0f 42 d0             	cmovb  %eax,%edx
+  804359:	b8 20 00 00 00       	mov    $0x20,%eax
+  80435e:	39 c2                	cmp    %eax,%edx
+  804360:	0f 47 d0             	cmova  %eax,%edx
+  804363:	eb c7                	jmp    80432c <file_prefetch+0x65>
+
+00804365 <file_write>:
+{
+  804365:	55                   	push   %ebp
+  804366:	89 e5                	mov    %esp,%ebp
+  804368:	57                   	push   %edi
+  804369:	56                   	push   %esi
+  80436a:	53                   	push   %ebx
+  80436b:	83 ec 2c             	sub    $0x2c,%esp
+  80436e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (offset < 0 || offset > MAXFILESIZE || count > MAXFILESIZE - offset)
+  804371:	81 ff 00 f0 ff 7f    	cmp    $0x7ffff000,%edi
+  804377:	0f 87 23 02 00 00    	ja     8045a0 <file_write+0x23b>
+  80437d:	89 fb                	mov    %edi,%ebx
+  80437f:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+  804384:	29 f8                	sub    %edi,%eax
+  804386:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804389:	0f 82 18 02 00 00    	jb     8045a7 <file_write+0x242>
+	if ((f->f_flags & FFLAG_INLINE) && offset + count <= FINLINE) {
+  80438f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804392:	f6 80 c0 00 00 00 01 	testb  $0x1,0xc0(%eax)
+  804399:	74 0a                	je     8043a5 <file_write+0x40>
+  80439b:	89 fe                	mov    %edi,%esi
+  80439d:	03 75 10             	add    0x10(%ebp),%esi
+  8043a0:	83 fe 3c             	cmp    $0x3c,%esi
+  8043a3:	76 37                	jbe    8043dc <file_write+0x77>
+	if ((r = file_spill(f)) < 0)
+  8043a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043a8:	e8 5c f6 ff ff       	call   803a09 <file_spill>
+  8043ad:	85 c0                	test   %eax,%eax
+  8043af:	0f 88 e3 01 00 00    	js     804598 <file_write+0x233>
+	if (offset + count > f->f_size)
+  8043b5:	89 d9                	mov    %ebx,%ecx
+  8043b7:	03 4d 10             	add    0x10(%ebp),%ecx
+  8043ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043bd:	39 88 80 00 00 00    	cmp    %ecx,0x80(%eax)
+  8043c3:	73 06                	jae    8043cb <file_write+0x66>
+		f->f_size = offset + count;
+  8043c5:	89 88 80 00 00 00    	mov    %ecx,0x80(%eax)
+		delayed[i].d_next = delayed_hash[DHASH(f, filebno)];
+  8043cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043ce:	c1 e8 08             	shr    $0x8,%eax
+  8043d1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8043d4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8043d7:	e9 9b 00 00 00       	jmp    804477 <file_write+0x112>
+		memmove(f->f_inline + offset, buf, count);
+  8043dc:	83 ec 04             	sub    $0x4,%esp
+  8043df:	ff 75 10             	push   0x10(%ebp)
+  8043e2:	ff 75 0c             	push   0xc(%ebp)
+  8043e5:	8d 84 38 c4 00 00 00 	lea    0xc4(%eax,%edi,1),%eax
+  8043ec:	50                   	push   %eax
+  8043ed:	e8 6b 2b 00 00       	call   806f5d <memmove>
+		f->f_size = MAX(f->f_size, offset + count);
+  8043f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043f5:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8043fb:	39 f0                	cmp    %esi,%eax
+  8043fd:	0f 42 c6             	cmovb  %esi,%eax
+  804400:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804403:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+		return count;
+  804409:	8b 45 10             	mov    0x10(%ebp),%eax
+  80440c:	83 c4 10             	add    $0x10,%esp
+  80440f:	e9 84 01 00 00       	jmp    804598 <file_write+0x233>
+	    && r != -E_NOT_FOUND)
+  804414:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804417:	0f 85 7b 01 00 00    	jne    804598 <file_write+0x233>
+	if ((i = delayed_lookup(f, filebno)) < 0) {
+  80441d:	89 f2                	mov    %esi,%edx
+  80441f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804422:	e8 20 e6 ff ff       	call   802a47 <delayed_lookup>
+  804427:	89 c3                	mov    %eax,%ebx
+  804429:	85 c0                	test   %eax,%eax
+  80442b:	0f 88 a5 00 00 00    	js     8044d6 <file_write+0x171>
+	return (char*) (DELAYMAP + i * BLKSIZE);
+  804431:	c1 e3 0c             	shl    $0xc,%ebx
+  804434:	81 eb 00 00 00 20    	sub    $0x20000000,%ebx
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80443a:	89 fa                	mov    %edi,%edx
+  80443c:	c1 fa 1f             	sar    $0x1f,%edx
+  80443f:	c1 ea 14             	shr    $0x14,%edx
+  804442:	8d 04 17             	lea    (%edi,%edx,1),%eax
+  804445:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80444a:	29 d0                	sub    %edx,%eax
+  80444c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804451:	29 c6                	sub    %eax,%esi
+  804453:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  804456:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  804459:	29 ca                	sub    %ecx,%edx
+  80445b:	39 d6                	cmp    %edx,%esi
+  80445d:	0f 47 f2             	cmova  %edx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  804460:	83 ec 04             	sub    $0x4,%esp
+  804463:	56                   	push   %esi
+  804464:	ff 75 0c             	push   0xc(%ebp)
+  804467:	01 c3                	add    %eax,%ebx
+  804469:	53                   	push   %ebx
+  80446a:	e8 ee 2a 00 00       	call   806f5d <memmove>
+		pos += bn;
+  80446f:	01 f7                	add    %esi,%edi
+		buf += bn;
+  804471:	01 75 0c             	add    %esi,0xc(%ebp)
+  804474:	83 c4 10             	add    $0x10,%esp
+	for (pos = offset; pos < offset + count; ) {
+  804477:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  80447a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80447d:	39 c7                	cmp    %eax,%edi
+  80447f:	0f 83 10 01 00 00    	jae    804595 <file_write+0x230>
+		if ((r = file_write_block(f, pos / BLKSIZE, &blk)) < 0)
+  804485:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  80448b:	85 ff                	test   %edi,%edi
+  80448d:	0f 49 f7             	cmovns %edi,%esi
+  804490:	c1 fe 0c             	sar    $0xc,%esi
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 0)) < 0
+  804493:	83 ec 0c             	sub    $0xc,%esp
+  804496:	6a 00                	push   $0x0
+  804498:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  80449b:	89 f2                	mov    %esi,%edx
+  80449d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044a0:	e8 42 ee ff ff       	call   8032e7 <file_block_walk>
+  8044a5:	83 c4 10             	add    $0x10,%esp
+  8044a8:	85 c0                	test   %eax,%eax
+  8044aa:	0f 88 64 ff ff ff    	js     804414 <file_write+0xaf>
+	if (r == 0 && *ppdiskbno) {
+  8044b0:	0f 85 67 ff ff ff    	jne    80441d <file_write+0xb8>
+  8044b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8044b9:	8b 00                	mov    (%eax),%eax
+  8044bb:	85 c0                	test   %eax,%eax
+  8044bd:	0f 84 5a ff ff ff    	je     80441d <file_write+0xb8>
+		*blk = diskaddr(*ppdiskbno);
+  8044c3:	83 ec 0c             	sub    $0xc,%esp
+  8044c6:	50                   	push   %eax
+  8044c7:	e8 5d d5 ff ff       	call   801a29 <diskaddr>
+  8044cc:	89 c3                	mov    %eax,%ebx
+		return 0;
+  8044ce:	83 c4 10             	add    $0x10,%esp
+  8044d1:	e9 64 ff ff ff       	jmp    80443a <file_write+0xd5>
+		if (ndelayed == NDELAYED)
+  8044d6:	81 3d 84 36 84 00 00 	cmpl   $0x400,0x843684
+  8044dd:	04 00 00 
+  8044e0:	0f 84 a5 00 00 00    	je     80458b <file_write+0x226>
+		if (nfree_blocks < delayed_reserve(ndelayed + 1))
+  8044e6:	a1 84 36 84 00       	mov    0x843684,%eax
+	if (n == 0)
+  8044eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8044ee:	74 19                	je     804509 <file_write+0x1a4>
+	return n + (n + NINDIRECT - 1) / NINDIRECT + 1;
+  8044f0:	8d 90 00 04 00 00    	lea    0x400(%eax),%edx
+  8044f6:	c1 ea 0a             	shr    $0xa,%edx
+  8044f9:	8d 44 10 02          	lea    0x2(%eax,%edx,1),%eax
+		if (nfree_blocks < delayed_reserve(ndelayed + 1))
+  8044fd:	39 05 88 36 84 00    	cmp    %eax,0x843688
+  804503:	0f 82 a5 00 00 00    	jb     8045ae <file_write+0x249>
+		i = delayed_free;
+  804509:	8b 1d 44 00 84 00    	mov    0x840044,%ebx
+		if ((r = sys_page_alloc(0, delayed_va(i), PTE_P|PTE_U|PTE_W)) < 0)
+  80450f:	83 ec 04             	sub    $0x4,%esp
+  804512:	6a 07                	push   $0x7
+	return (char*) (DELAYMAP + i * BLKSIZE);
+  804514:	89 d8                	mov    %ebx,%eax
+  804516:	c1 e0 0c             	shl    $0xc,%eax
+  804519:	2d 00 00 00 20       	sub    $0x20000000,%eax
+		if ((r = sys_page_alloc(0, delayed_va(i), PTE_P|PTE_U|PTE_W)) < 0)
+  80451e:	50                   	push   %eax
+  80451f:	6a 00                	push   $0x0
+  804521:	e8 ef 2c 00 00       	call   807215 <sys_page_alloc>
+  804526:	83 c4 10             	add    $0x10,%esp
+  804529:	85 c0                	test   %eax,%eax
+  80452b:	78 6b                	js     804598 <file_write+0x233>
+		delayed_free = delayed[i].d_next;
+  80452d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  804530:	8d 14 85 60 04 84 00 	lea    0x840460(,%eax,4),%edx
+  804537:	8b 4a 08             	mov    0x8(%edx),%ecx
+  80453a:	89 0d 44 00 84 00    	mov    %ecx,0x840044
+		delayed[i].d_file = f;
+  804540:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804543:	89 0c 85 60 04 84 00 	mov    %ecx,0x840460(,%eax,4)
+		delayed[i].d_filebno = filebno;
+  80454a:	89 72 04             	mov    %esi,0x4(%edx)
+		delayed[i].d_next = delayed_hash[DHASH(f, filebno)];
+  80454d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  804550:	01 f0                	add    %esi,%eax
+  804552:	0f b6 f0             	movzbl %al,%esi
+  804555:	8b 04 b5 60 00 84 00 	mov    0x840060(,%esi,4),%eax
+  80455c:	89 42 08             	mov    %eax,0x8(%edx)
+		delayed_hash[DHASH(f, filebno)] = i;
+  80455f:	89 1c b5 60 00 84 00 	mov    %ebx,0x840060(,%esi,4)
+		if (ndelayed++ == 0)
+  804566:	a1 84 36 84 00       	mov    0x843684,%eax
+  80456b:	8d 50 01             	lea    0x1(%eax),%edx
+  80456e:	89 15 84 36 84 00    	mov    %edx,0x843684
+  804574:	85 c0                	test   %eax,%eax
+  804576:	0f 85 b5 fe ff ff    	jne    804431 <file_write+0xcc>
+			delayed_since = sys_time_msec();
+  80457c:	e8 21 2f 00 00       	call   8074a2 <sys_time_msec>
+  804581:	a3 40 00 84 00       	mov    %eax,0x840040
+  804586:	e9 a6 fe ff ff       	jmp    804431 <file_write+0xcc>
+			delalloc_flush();
+  80458b:	e8 37 f1 ff ff       	call   8036c7 <delalloc_flush>
+  804590:	e9 51 ff ff ff       	jmp    8044e6 <file_write+0x181>
+	return count;
+  804595:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  804598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80459b:	5b                   	pop    %ebx
+  80459c:	5e                   	pop    %esi
+  80459d:	5f                   	pop    %edi
+  80459e:	5d                   	pop    %ebp
+  80459f:	c3                   	ret
+		return -E_INVAL;
+  8045a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045a5:	eb f1                	jmp    804598 <file_write+0x233>
+  8045a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045ac:	eb ea                	jmp    804598 <file_write+0x233>
+			return -E_NO_DISK;
+  8045ae:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8045b3:	eb e3                	jmp    804598 <file_write+0x233>
+
+008045b5 <file_allocate>:
+{
+  8045b5:	55                   	push   %ebp
+  8045b6:	89 e5                	mov    %esp,%ebp
+  8045b8:	57                   	push   %edi
+  8045b9:	56                   	push   %esi
+  8045ba:	53                   	push   %ebx
+  8045bb:	83 ec 2c             	sub    $0x2c,%esp
+  8045be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8045c1:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (offset < 0 || len <= 0 || offset > MAXFILESIZE || len > MAXFILESIZE - offset)
+  8045c4:	85 f6                	test   %esi,%esi
+  8045c6:	0f 8e b9 01 00 00    	jle    804785 <file_allocate+0x1d0>
+  8045cc:	81 fb 00 f0 ff 7f    	cmp    $0x7ffff000,%ebx
+  8045d2:	0f 87 ad 01 00 00    	ja     804785 <file_allocate+0x1d0>
+  8045d8:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+  8045dd:	29 d8                	sub    %ebx,%eax
+  8045df:	39 f0                	cmp    %esi,%eax
+  8045e1:	0f 8c a7 01 00 00    	jl     80478e <file_allocate+0x1d9>
+	if ((r = file_spill(f)) < 0)
+  8045e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045ea:	e8 1a f4 ff ff       	call   803a09 <file_spill>
+  8045ef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8045f2:	85 c0                	test   %eax,%eax
+  8045f4:	0f 88 19 01 00 00    	js     804713 <file_allocate+0x15e>
+	oldsize = f->f_size;
+  8045fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045fd:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  804603:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	if (offset + len > f->f_size)
+  804606:	01 de                	add    %ebx,%esi
+  804608:	39 c6                	cmp    %eax,%esi
+  80460a:	7e 09                	jle    804615 <file_allocate+0x60>
+		f->f_size = offset + len;
+  80460c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80460f:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+	delalloc_flush();
+  804615:	e8 ad f0 ff ff       	call   8036c7 <delalloc_flush>
+	last = (offset + len - 1) / BLKSIZE + 1;
+  80461a:	8d 86 fe 0f 00 00    	lea    0xffe(%esi),%eax
+  804620:	83 ee 01             	sub    $0x1,%esi
+  804623:	0f 49 c6             	cmovns %esi,%eax
+  804626:	c1 f8 0c             	sar    $0xc,%eax
+  804629:	8d 78 01             	lea    0x1(%eax),%edi
+  80462c:	89 7d d0             	mov    %edi,-0x30(%ebp)
+	for (bno = offset / BLKSIZE; bno < last; bno += n) {
+  80462f:	8d 93 ff 0f 00 00    	lea    0xfff(%ebx),%edx
+  804635:	85 db                	test   %ebx,%ebx
+  804637:	0f 49 d3             	cmovns %ebx,%edx
+  80463a:	89 d7                	mov    %edx,%edi
+  80463c:	c1 ff 0c             	sar    $0xc,%edi
+  80463f:	83 c0 01             	add    $0x1,%eax
+  804642:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  804645:	e9 d6 00 00 00       	jmp    804720 <file_allocate+0x16b>
+		if (r < 0 && r != -E_NOT_FOUND)
+  80464a:	0f 89 01 01 00 00    	jns    804751 <file_allocate+0x19c>
+  804650:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804653:	0f 84 f8 00 00 00    	je     804751 <file_allocate+0x19c>
+  804659:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80465c:	e9 a4 00 00 00       	jmp    804705 <file_allocate+0x150>
+			n++;
+  804661:	83 c3 01             	add    $0x1,%ebx
+		while (bno + n < last
+  804664:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+		       && ((r = file_block_walk(f, bno + n, &pdiskbno, 0)) == -E_NOT_FOUND
+  804667:	39 f3                	cmp    %esi,%ebx
+  804669:	74 26                	je     804691 <file_allocate+0xdc>
+  80466b:	83 ec 0c             	sub    $0xc,%esp
+  80466e:	6a 00                	push   $0x0
+  804670:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  804673:	8b 45 08             	mov    0x8(%ebp),%eax
+  804676:	e8 6c ec ff ff       	call   8032e7 <file_block_walk>
+  80467b:	83 c4 10             	add    $0x10,%esp
+  80467e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804681:	74 de                	je     804661 <file_allocate+0xac>
+			   || (r == 0 && *pdiskbno == 0)))
+  804683:	85 c0                	test   %eax,%eax
+  804685:	75 0c                	jne    804693 <file_allocate+0xde>
+  804687:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80468a:	83 38 00             	cmpl   $0x0,(%eax)
+  80468d:	74 d2                	je     804661 <file_allocate+0xac>
+  80468f:	eb 02                	jmp    804693 <file_allocate+0xde>
+  804691:	89 f3                	mov    %esi,%ebx
+		if ((r = blockno = alloc_run(file_alloc_hint(f, bno), n, &got)) < 0)
+  804693:	89 fa                	mov    %edi,%edx
+  804695:	8b 45 08             	mov    0x8(%ebp),%eax
+  804698:	e8 64 ed ff ff       	call   803401 <file_alloc_hint>
+  80469d:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8046a0:	89 da                	mov    %ebx,%edx
+  8046a2:	e8 94 ea ff ff       	call   80313b <alloc_run>
+  8046a7:	85 c0                	test   %eax,%eax
+  8046a9:	0f 88 ba 00 00 00    	js     804769 <file_allocate+0x1b4>
+		for (j = 0; j < got; j++) {
+  8046af:	be 00 00 00 00       	mov    $0x0,%esi
+  8046b4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8046b7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8046ba:	39 de                	cmp    %ebx,%esi
+  8046bc:	73 60                	jae    80471e <file_allocate+0x169>
+			if ((r = file_block_walk(f, bno + j, &pdiskbno, 1)) < 0) {
+  8046be:	8d 14 37             	lea    (%edi,%esi,1),%edx
+  8046c1:	83 ec 0c             	sub    $0xc,%esp
+  8046c4:	6a 01                	push   $0x1
+  8046c6:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8046c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046cc:	e8 16 ec ff ff       	call   8032e7 <file_block_walk>
+  8046d1:	83 c4 10             	add    $0x10,%esp
+  8046d4:	85 c0                	test   %eax,%eax
+  8046d6:	78 1b                	js     8046f3 <file_allocate+0x13e>
+			*pdiskbno = blockno + j;
+  8046d8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8046db:	01 f0                	add    %esi,%eax
+  8046dd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8046e0:	89 02                	mov    %eax,(%edx)
+			bc_new_block(blockno + j);
+  8046e2:	83 ec 0c             	sub    $0xc,%esp
+  8046e5:	50                   	push   %eax
+  8046e6:	e8 84 df ff ff       	call   80266f <bc_new_block>
+		for (j = 0; j < got; j++) {
+  8046eb:	83 c6 01             	add    $0x1,%esi
+  8046ee:	83 c4 10             	add    $0x10,%esp
+  8046f1:	eb c4                	jmp    8046b7 <file_allocate+0x102>
+				free_run(blockno + j, got - j);
+  8046f3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8046f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8046f9:	29 f3                	sub    %esi,%ebx
+  8046fb:	89 da                	mov    %ebx,%edx
+  8046fd:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+  804700:	e8 da e3 ff ff       	call   802adf <free_run>
+	if (f->f_size > oldsize) {
+  804705:	8b 45 08             	mov    0x8(%ebp),%eax
+  804708:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  80470b:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  804711:	7f 5b                	jg     80476e <file_allocate+0x1b9>
+}
+  804713:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804716:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804719:	5b                   	pop    %ebx
+  80471a:	5e                   	pop    %esi
+  80471b:	5f                   	pop    %edi
+  80471c:	5d                   	pop    %ebp
+  80471d:	c3                   	ret
+	for (bno = offset / BLKSIZE; bno < last; bno += n) {
+  80471e:	01 df                	add    %ebx,%edi
+  804720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804723:	39 c7                	cmp    %eax,%edi
+  804725:	73 39                	jae    804760 <file_allocate+0x1ab>
+		if ((r = file_block_walk(f, bno, &pdiskbno, 0)) == 0 && *pdiskbno)
+  804727:	83 ec 0c             	sub    $0xc,%esp
+  80472a:	6a 00                	push   $0x0
+  80472c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80472f:	89 fa                	mov    %edi,%edx
+  804731:	8b 45 08             	mov    0x8(%ebp),%eax
+  804734:	e8 ae eb ff ff       	call   8032e7 <file_block_walk>
+  804739:	83 c4 10             	add    $0x10,%esp
+  80473c:	85 c0                	test   %eax,%eax
+  80473e:	0f 85 06 ff ff ff    	jne    80464a <file_allocate+0x95>
+		n = 1;
+  804744:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if ((r = file_block_walk(f, bno, &pdiskbno, 0)) == 0 && *pdiskbno)
+  804749:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80474c:	83 38 00             	cmpl   $0x0,(%eax)
+  80474f:	75 cd                	jne    80471e <file_allocate+0x169>
+  804751:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  804754:	29 fe                	sub    %edi,%esi
+		n = 1;
+  804756:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80475b:	e9 04 ff ff ff       	jmp    804664 <file_allocate+0xaf>
+	return 0;
+  804760:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  804767:	eb aa                	jmp    804713 <file_allocate+0x15e>
+		if ((r = blockno = alloc_run(file_alloc_hint(f, bno), n, &got)) < 0)
+  804769:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80476c:	eb 97                	jmp    804705 <file_allocate+0x150>
+		file_truncate_blocks(f, oldsize);
+  80476e:	89 fa                	mov    %edi,%edx
+  804770:	e8 ce e6 ff ff       	call   802e43 <file_truncate_blocks>
+		f->f_size = oldsize;
+  804775:	8b 75 08             	mov    0x8(%ebp),%esi
+  804778:	89 be 80 00 00 00    	mov    %edi,0x80(%esi)
+		free_runs_flush();
+  80477e:	e8 5f e6 ff ff       	call   802de2 <free_runs_flush>
+  804783:	eb 8e                	jmp    804713 <file_allocate+0x15e>
+		return -E_INVAL;
+  804785:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80478c:	eb 85                	jmp    804713 <file_allocate+0x15e>
+  80478e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  804795:	e9 79 ff ff ff       	jmp    804713 <file_allocate+0x15e>
+
+0080479a <file_set_size>:
+
+// Set the size of file f, truncating or extending as necessary.
+// A regular file truncated to nothing keeps its data inline again.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  80479a:	55                   	push   %ebp
+  80479b:	89 e5                	mov    %esp,%ebp
+  80479d:	56                   	push   %esi
+  80479e:	53                   	push   %ebx
+  80479f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8047a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+  8047a5:	81 fe 00 f0 ff 7f    	cmp    $0x7ffff000,%esi
+  8047ab:	0f 87 97 00 00 00    	ja     804848 <file_set_size+0xae>
+		return -E_INVAL;
+	if (f->f_flags & FFLAG_INLINE) {
+  8047b1:	f6 83 c0 00 00 00 01 	testb  $0x1,0xc0(%ebx)
+  8047b8:	74 27                	je     8047e1 <file_set_size+0x47>
+		if (newsize > FINLINE && (r = file_spill(f)) < 0)
+  8047ba:	83 fe 3c             	cmp    $0x3c,%esi
+  8047bd:	7f 61                	jg     804820 <file_set_size+0x86>
+			return r;
+		if (newsize < f->f_size)
+  8047bf:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8047c5:	39 f0                	cmp    %esi,%eax
+  8047c7:	7e 20                	jle    8047e9 <file_set_size+0x4f>
+			memset(f->f_inline + newsize, 0, f->f_size - newsize);
+  8047c9:	83 ec 04             	sub    $0x4,%esp
+  8047cc:	29 f0                	sub    %esi,%eax
+  8047ce:	50                   	push   %eax
+  8047cf:	6a 00                	push   $0x0
+  8047d1:	8d 84 33 c4 00 00 00 	lea    0xc4(%ebx,%esi,1),%eax
+  8047d8:	50                   	push   %eax
+  8047d9:	e8 4a 27 00 00       	call   806f28 <memset>
+  8047de:	83 c4 10             	add    $0x10,%esp
+	}
+	if (f->f_size > newsize)
+  8047e1:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+  8047e7:	7f 54                	jg     80483d <file_set_size+0xa3>
+		file_truncate_blocks(f, newsize);
+	f->f_size = newsize;
+  8047e9:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+	if (newsize == 0 && f->f_type == FTYPE_REG)
+  8047ef:	85 f6                	test   %esi,%esi
+  8047f1:	75 10                	jne    804803 <file_set_size+0x69>
+  8047f3:	83 bb 84 00 00 00 00 	cmpl   $0x0,0x84(%ebx)
+  8047fa:	75 07                	jne    804803 <file_set_size+0x69>
+		f->f_flags |= FFLAG_INLINE;
+  8047fc:	83 8b c0 00 00 00 01 	orl    $0x1,0xc0(%ebx)
+	// The file stops pointing at its old blocks on disk before the
+	// bitmap says they are free.
+	flush_block(f);
+  804803:	83 ec 0c             	sub    $0xc,%esp
+  804806:	53                   	push   %ebx
+  804807:	e8 d8 d5 ff ff       	call   801de4 <flush_block>
+	free_runs_flush();
+  80480c:	e8 d1 e5 ff ff       	call   802de2 <free_runs_flush>
+	return 0;
+  804811:	83 c4 10             	add    $0x10,%esp
+  804814:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804819:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80481c:	5b                   	pop    %ebx
+  80481d:	5e                   	pop    %esi
+  80481e:	5d                   	pop    %ebp
+  80481f:	c3                   	ret
+		if (newsize > FINLINE && (r = file_spill(f)) < 0)
+  804820:	89 d8                	mov    %ebx,%eax
+  804822:	e8 e2 f1 ff ff       	call   803a09 <file_spill>
+  804827:	85 c0                	test   %eax,%eax
+  804829:	78 ee                	js     804819 <file_set_size+0x7f>
+		if (newsize < f->f_size)
+  80482b:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  804831:	39 c6                	cmp    %eax,%esi
+  804833:	7c 94                	jl     8047c9 <file_set_size+0x2f>
+	f->f_size = newsize;
+  804835:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+	if (newsize == 0 && f->f_type == FTYPE_REG)
+  80483b:	eb c6                	jmp    804803 <file_set_size+0x69>
+		file_truncate_blocks(f, newsize);
+  80483d:	89 f2                	mov    %esi,%edx
+  80483f:	89 d8                	mov    %ebx,%eax
+  804841:	e8 fd e5 ff ff       	call   802e43 <file_truncate_blocks>
+  804846:	eb a1                	jmp    8047e9 <file_set_size+0x4f>
+		return -E_INVAL;
+  804848:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80484d:	eb ca                	jmp    804819 <file_set_size+0x7f>
+
+0080484f <file_remove>:
+//	-E_NOT_FOUND if path does not exist.
+//	-E_BAD_PATH if path is the root.
+//	-E_NOT_SUPP if path is a directory with entries in it.
+int
+file_remove(const char *path)
+{
+  80484f:	55                   	push   %ebp
+  804850:	89 e5                	mov    %esp,%ebp
+  804852:	57                   	push   %edi
+  804853:	56                   	push   %esi
+  804854:	53                   	push   %ebx
+  804855:	83 ec 38             	sub    $0x38,%esp
+	struct File *dir, *f;
+	struct DirIndex *di;
+	int r;
+
+	if ((r = walk_path(path, &dir, &f, 0)) < 0)
+  804858:	6a 00                	push   $0x0
+  80485a:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80485d:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  804860:	8b 45 08             	mov    0x8(%ebp),%eax
+  804863:	e8 89 f2 ff ff       	call   803af1 <walk_path>
+  804868:	83 c4 10             	add    $0x10,%esp
+  80486b:	85 c0                	test   %eax,%eax
+  80486d:	0f 88 80 00 00 00    	js     8048f3 <file_remove+0xa4>
+		return r;
+	if (!dir)
+  804873:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804876:	85 ff                	test   %edi,%edi
+  804878:	0f 84 80 01 00 00    	je     8049fe <file_remove+0x1af>
+		return -E_BAD_PATH;
+	if (f->f_type == FTYPE_DIR && (r = dir_is_empty(f)) <= 0)
+  80487e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804881:	83 bb 84 00 00 00 01 	cmpl   $0x1,0x84(%ebx)
+  804888:	0f 84 ae 00 00 00    	je     80493c <file_remove+0xed>
+		return r < 0 ? r : -E_NOT_SUPP;
+
+	dcache_invalidate(dir, f->f_name);
+  80488e:	89 de                	mov    %ebx,%esi
+  804890:	83 ec 08             	sub    $0x8,%esp
+  804893:	53                   	push   %ebx
+  804894:	57                   	push   %edi
+  804895:	e8 b8 02 00 00       	call   804b52 <dcache_invalidate>
+	if ((di = dir_index(dir)) != 0
+  80489a:	89 f8                	mov    %edi,%eax
+  80489c:	e8 93 e3 ff ff       	call   802c34 <dir_index>
+  8048a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8048a4:	83 c4 10             	add    $0x10,%esp
+	uint32_t h = 2166136261U;
+  8048a7:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+  8048ac:	85 c0                	test   %eax,%eax
+  8048ae:	0f 85 9d 00 00 00    	jne    804951 <file_remove+0x102>
+	    && (r = dir_index_remove(dir, di, f)) >= 0)
+		di->di_free = MIN(di->di_free, (uint32_t) r);
+	file_truncate_blocks(f, 0);
+  8048b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048b9:	89 d8                	mov    %ebx,%eax
+  8048bb:	e8 83 e5 ff ff       	call   802e43 <file_truncate_blocks>
+	if (f->f_dirindex)
+  8048c0:	8b 83 b8 00 00 00    	mov    0xb8(%ebx),%eax
+  8048c6:	85 c0                	test   %eax,%eax
+  8048c8:	0f 85 26 01 00 00    	jne    8049f4 <file_remove+0x1a5>
+		free_runs_add(f->f_dirindex);
+	memset(f, 0, sizeof *f);
+  8048ce:	83 ec 04             	sub    $0x4,%esp
+  8048d1:	68 00 01 00 00       	push   $0x100
+  8048d6:	6a 00                	push   $0x0
+  8048d8:	53                   	push   %ebx
+  8048d9:	e8 4a 26 00 00       	call   806f28 <memset>
+	flush_block(f);
+  8048de:	89 1c 24             	mov    %ebx,(%esp)
+  8048e1:	e8 fe d4 ff ff       	call   801de4 <flush_block>
+	free_runs_flush();
+  8048e6:	e8 f7 e4 ff ff       	call   802de2 <free_runs_flush>
+	return 0;
+  8048eb:	83 c4 10             	add    $0x10,%esp
+  8048ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048f6:	5b                   	pop    %ebx
+  8048f7:	5e                   	pop    %esi
+  8048f8:	5f                   	pop    %edi
+  8048f9:	5d                   	pop    %ebp
+  8048fa:	c3                   	ret
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+  8048fb:	83 c6 01             	add    $0x1,%esi
+  8048fe:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+  804904:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  80490a:	85 d2                	test   %edx,%edx
+  80490c:	0f 49 c2             	cmovns %edx,%eax
+  80490f:	c1 f8 0c             	sar    $0xc,%eax
+  804912:	c1 e0 04             	shl    $0x4,%eax
+  804915:	39 c6                	cmp    %eax,%esi
+  804917:	0f 83 71 ff ff ff    	jae    80488e <file_remove+0x3f>
+		if ((r = dir_entry(dir, entno, &f)) < 0)
+  80491d:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  804920:	89 f2                	mov    %esi,%edx
+  804922:	89 d8                	mov    %ebx,%eax
+  804924:	e8 8e f1 ff ff       	call   803ab7 <dir_entry>
+  804929:	85 c0                	test   %eax,%eax
+  80492b:	78 c6                	js     8048f3 <file_remove+0xa4>
+		if (f->f_name[0] != '\0')
+  80492d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804930:	80 38 00             	cmpb   $0x0,(%eax)
+  804933:	74 c6                	je     8048fb <file_remove+0xac>
+		return r < 0 ? r : -E_NOT_SUPP;
+  804935:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80493a:	eb b7                	jmp    8048f3 <file_remove+0xa4>
+	for (entno = 0; entno < dir->f_size / BLKSIZE * BLKFILES; entno++) {
+  80493c:	be 00 00 00 00       	mov    $0x0,%esi
+  804941:	eb bb                	jmp    8048fe <file_remove+0xaf>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  804943:	83 c6 01             	add    $0x1,%esi
+  804946:	0f b6 c0             	movzbl %al,%eax
+  804949:	31 c1                	xor    %eax,%ecx
+  80494b:	69 c9 93 01 00 01    	imul   $0x1000193,%ecx,%ecx
+	while (*name)
+  804951:	0f b6 06             	movzbl (%esi),%eax
+  804954:	84 c0                	test   %al,%al
+  804956:	75 eb                	jne    804943 <file_remove+0xf4>
+	return h % DIRINDEX_NBUCKETS;
+  804958:	89 ca                	mov    %ecx,%edx
+  80495a:	d1 ea                	shr    %edx
+  80495c:	be 11 20 40 80       	mov    $0x80402011,%esi
+  804961:	89 d0                	mov    %edx,%eax
+  804963:	f7 e6                	mul    %esi
+  804965:	c1 ea 08             	shr    $0x8,%edx
+  804968:	69 c2 fe 03 00 00    	imul   $0x3fe,%edx,%eax
+  80496e:	89 ca                	mov    %ecx,%edx
+  804970:	29 c2                	sub    %eax,%edx
+	for (e = di->di_bucket[h]; e != 0; e = g->f_hnext, prev = g) {
+  804972:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804975:	8b 74 90 08          	mov    0x8(%eax,%edx,4),%esi
+	struct File *g, *prev = 0;
+  804979:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  804980:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	for (e = di->di_bucket[h]; e != 0; e = g->f_hnext, prev = g) {
+  804983:	85 f6                	test   %esi,%esi
+  804985:	0f 84 29 ff ff ff    	je     8048b4 <file_remove+0x65>
+		if ((r = dir_entry(dir, e - 1, &g)) < 0)
+  80498b:	83 ee 01             	sub    $0x1,%esi
+  80498e:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  804991:	89 f2                	mov    %esi,%edx
+  804993:	89 f8                	mov    %edi,%eax
+  804995:	e8 1d f1 ff ff       	call   803ab7 <dir_entry>
+  80499a:	85 c0                	test   %eax,%eax
+  80499c:	0f 88 12 ff ff ff    	js     8048b4 <file_remove+0x65>
+		if (g != f)
+  8049a2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8049a5:	39 c3                	cmp    %eax,%ebx
+  8049a7:	74 0b                	je     8049b4 <file_remove+0x165>
+	for (e = di->di_bucket[h]; e != 0; e = g->f_hnext, prev = g) {
+  8049a9:	8b b0 bc 00 00 00    	mov    0xbc(%eax),%esi
+  8049af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8049b2:	eb cf                	jmp    804983 <file_remove+0x134>
+		if (prev)
+  8049b4:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8049b7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8049ba:	85 ff                	test   %edi,%edi
+  8049bc:	74 27                	je     8049e5 <file_remove+0x196>
+			prev->f_hnext = f->f_hnext;
+  8049be:	8b 83 bc 00 00 00    	mov    0xbc(%ebx),%eax
+  8049c4:	89 87 bc 00 00 00    	mov    %eax,0xbc(%edi)
+	    && (r = dir_index_remove(dir, di, f)) >= 0)
+  8049ca:	85 f6                	test   %esi,%esi
+  8049cc:	0f 88 e2 fe ff ff    	js     8048b4 <file_remove+0x65>
+		di->di_free = MIN(di->di_free, (uint32_t) r);
+  8049d2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8049d5:	8b 47 04             	mov    0x4(%edi),%eax
+  8049d8:	39 f0                	cmp    %esi,%eax
+  8049da:	0f 47 c6             	cmova  %esi,%eax
+  8049dd:	89 47 04             	mov    %eax,0x4(%edi)
+  8049e0:	e9 cf fe ff ff       	jmp    8048b4 <file_remove+0x65>
+			di->di_bucket[h] = f->f_hnext;
+  8049e5:	8b 83 bc 00 00 00    	mov    0xbc(%ebx),%eax
+  8049eb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8049ee:	89 44 97 08          	mov    %eax,0x8(%edi,%edx,4)
+  8049f2:	eb d6                	jmp    8049ca <file_remove+0x17b>
+		free_runs_add(f->f_dirindex);
+  8049f4:	e8 86 e3 ff ff       	call   802d7f <free_runs_add>
+  8049f9:	e9 d0 fe ff ff       	jmp    8048ce <file_remove+0x7f>
+		return -E_BAD_PATH;
+  8049fe:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  804a03:	e9 eb fe ff ff       	jmp    8048f3 <file_remove+0xa4>
+
+00804a08 <fs_sync>:
+
+
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void)
+{
+  804a08:	55                   	push   %ebp
+  804a09:	89 e5                	mov    %esp,%ebp
+  804a0b:	83 ec 08             	sub    $0x8,%esp
+	delalloc_flush();
+  804a0e:	e8 b4 ec ff ff       	call   8036c7 <delalloc_flush>
+	bc_sync();
+  804a13:	e8 de d1 ff ff       	call   801bf6 <bc_sync>
+}
+  804a18:	c9                   	leave
+  804a19:	c3                   	ret
+
+00804a1a <file_flush>:
+{
+  804a1a:	55                   	push   %ebp
+  804a1b:	89 e5                	mov    %esp,%ebp
+  804a1d:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  804a20:	e8 e3 ff ff ff       	call   804a08 <fs_sync>
+}
+  804a25:	c9                   	leave
+  804a26:	c3                   	ret
+
+00804a27 <fs_writeback>:
+// everything if age is 0.  Delayed blocks get their disk blocks first
+// so that they are written back along with the rest.
+// Returns the number of blocks written.
+uint32_t
+fs_writeback(uint32_t age)
+{
+  804a27:	55                   	push   %ebp
+  804a28:	89 e5                	mov    %esp,%ebp
+  804a2a:	53                   	push   %ebx
+  804a2b:	83 ec 04             	sub    $0x4,%esp
+  804a2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (ndelayed > 0 && (age == 0 || ndelayed > NDELAYED / 2
+  804a31:	a1 84 36 84 00       	mov    0x843684,%eax
+  804a36:	85 c0                	test   %eax,%eax
+  804a38:	74 10                	je     804a4a <fs_writeback+0x23>
+  804a3a:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804a3f:	77 04                	ja     804a45 <fs_writeback+0x1e>
+  804a41:	85 db                	test   %ebx,%ebx
+  804a43:	75 13                	jne    804a58 <fs_writeback+0x31>
+			     || sys_time_msec() - delayed_since >= age))
+		delalloc_flush();
+  804a45:	e8 7d ec ff ff       	call   8036c7 <delalloc_flush>
+	return bc_writeback(age);
+  804a4a:	83 ec 0c             	sub    $0xc,%esp
+  804a4d:	53                   	push   %ebx
+  804a4e:	e8 54 d0 ff ff       	call   801aa7 <bc_writeback>
+}
+  804a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a56:	c9                   	leave
+  804a57:	c3                   	ret
+			     || sys_time_msec() - delayed_since >= age))
+  804a58:	e8 45 2a 00 00       	call   8074a2 <sys_time_msec>
+  804a5d:	2b 05 40 00 84 00    	sub    0x840040,%eax
+  804a63:	39 d8                	cmp    %ebx,%eax
+  804a65:	72 e3                	jb     804a4a <fs_writeback+0x23>
+  804a67:	eb dc                	jmp    804a45 <fs_writeback+0x1e>
+
+00804a69 <fs_ndirty_blocks>:
+
+// Return the number of blocks waiting to be written back.
+uint32_t
+fs_ndirty_blocks(void)
+{
+  804a69:	55                   	push   %ebp
+  804a6a:	89 e5                	mov    %esp,%ebp
+  804a6c:	83 ec 08             	sub    $0x8,%esp
+	return bc_ndirty_blocks() + ndelayed;
+  804a6f:	e8 94 d1 ff ff       	call   801c08 <bc_ndirty_blocks>
+  804a74:	03 05 84 36 84 00    	add    0x843684,%eax
+}
+  804a7a:	c9                   	leave
+  804a7b:	c3                   	ret
+
+00804a7c <dcache_slot>:
+
+static struct Dentry dcache[NDCACHE];
+
+static struct Dentry*
+dcache_slot(struct File *dir, const char *name)
+{
+  804a7c:	55                   	push   %ebp
+  804a7d:	89 e5                	mov    %esp,%ebp
+  804a7f:	56                   	push   %esi
+  804a80:	53                   	push   %ebx
+  804a81:	89 c3                	mov    %eax,%ebx
+	uint32_t h = 2166136261U;
+  804a83:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+	while (*name)
+  804a88:	eb 0e                	jmp    804a98 <dcache_slot+0x1c>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  804a8a:	83 c2 01             	add    $0x1,%edx
+  804a8d:	0f b6 c0             	movzbl %al,%eax
+  804a90:	31 c8                	xor    %ecx,%eax
+  804a92:	69 c8 93 01 00 01    	imul   $0x1000193,%eax,%ecx
+	while (*name)
+  804a98:	0f b6 02             	movzbl (%edx),%eax
+  804a9b:	84 c0                	test   %al,%al
+  804a9d:	75 eb                	jne    804a8a <dcache_slot+0xe>
+	uint32_t h = dir_hash(name) + (uintptr_t) dir / sizeof(struct File);
+  804a9f:	c1 eb 08             	shr    $0x8,%ebx
+	return h % DIRINDEX_NBUCKETS;
+  804aa2:	89 ca                	mov    %ecx,%edx
+  804aa4:	d1 ea                	shr    %edx
+  804aa6:	be 11 20 40 80       	mov    $0x80402011,%esi
+  804aab:	89 d0                	mov    %edx,%eax
+  804aad:	f7 e6                	mul    %esi
+  804aaf:	c1 ea 08             	shr    $0x8,%edx
+  804ab2:	69 d2 fe 03 00 00    	imul   $0x3fe,%edx,%edx
+  804ab8:	29 d1                	sub    %edx,%ecx
+  804aba:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+
+	return &dcache[h % NDCACHE];
+  804abd:	0f b6 c0             	movzbl %al,%eax
+  804ac0:	69 c0 88 00 00 00    	imul   $0x88,%eax,%eax
+  804ac6:	05 a0 36 84 00       	add    $0x8436a0,%eax
+}
+  804acb:	5b                   	pop    %ebx
+  804acc:	5e                   	pop    %esi
+  804acd:	5d                   	pop    %ebp
+  804ace:	c3                   	ret
+
+00804acf <dcache_lookup>:
+// Look name up in dir through the cache.  Returns 1 and sets *pf if
+// the cache knows the answer (*pf is 0 if name does not exist),
+// otherwise returns 0.
+bool
+dcache_lookup(struct File *dir, const char *name, struct File **pf)
+{
+  804acf:	55                   	push   %ebp
+  804ad0:	89 e5                	mov    %esp,%ebp
+  804ad2:	56                   	push   %esi
+  804ad3:	53                   	push   %ebx
+  804ad4:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Dentry *d = dcache_slot(dir, name);
+  804ad7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804ada:	89 f0                	mov    %esi,%eax
+  804adc:	e8 9b ff ff ff       	call   804a7c <dcache_slot>
+  804ae1:	89 c3                	mov    %eax,%ebx
+
+	if (d->d_dir != dir || strcmp(d->d_name, name) != 0)
+		return 0;
+  804ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (d->d_dir != dir || strcmp(d->d_name, name) != 0)
+  804ae8:	39 33                	cmp    %esi,(%ebx)
+  804aea:	74 07                	je     804af3 <dcache_lookup+0x24>
+	*pf = d->d_file;
+	return 1;
+}
+  804aec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804aef:	5b                   	pop    %ebx
+  804af0:	5e                   	pop    %esi
+  804af1:	5d                   	pop    %ebp
+  804af2:	c3                   	ret
+	if (d->d_dir != dir || strcmp(d->d_name, name) != 0)
+  804af3:	83 ec 08             	sub    $0x8,%esp
+  804af6:	ff 75 0c             	push   0xc(%ebp)
+  804af9:	8d 43 08             	lea    0x8(%ebx),%eax
+  804afc:	50                   	push   %eax
+  804afd:	e8 86 23 00 00       	call   806e88 <strcmp>
+  804b02:	89 c2                	mov    %eax,%edx
+  804b04:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  804b07:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (d->d_dir != dir || strcmp(d->d_name, name) != 0)
+  804b0c:	85 d2                	test   %edx,%edx
+  804b0e:	75 dc                	jne    804aec <dcache_lookup+0x1d>
+	*pf = d->d_file;
+  804b10:	8b 53 04             	mov    0x4(%ebx),%edx
+  804b13:	8b 45 10             	mov    0x10(%ebp),%eax
+  804b16:	89 10                	mov    %edx,(%eax)
+	return 1;
+  804b18:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b1d:	eb cd                	jmp    804aec <dcache_lookup+0x1d>
+
+00804b1f <dcache_enter>:
+
+// Remember that name in dir is f, or does not exist if f is 0.
+void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+  804b1f:	55                   	push   %ebp
+  804b20:	89 e5                	mov    %esp,%ebp
+  804b22:	56                   	push   %esi
+  804b23:	53                   	push   %ebx
+  804b24:	8b 75 08             	mov    0x8(%ebp),%esi
+  804b27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Dentry *d = dcache_slot(dir, name);
+  804b2a:	89 da                	mov    %ebx,%edx
+  804b2c:	89 f0                	mov    %esi,%eax
+  804b2e:	e8 49 ff ff ff       	call   804a7c <dcache_slot>
+
+	d->d_dir = dir;
+  804b33:	89 30                	mov    %esi,(%eax)
+	d->d_file = f;
+  804b35:	8b 55 10             	mov    0x10(%ebp),%edx
+  804b38:	89 50 04             	mov    %edx,0x4(%eax)
+	strcpy(d->d_name, name);
+  804b3b:	83 ec 08             	sub    $0x8,%esp
+  804b3e:	53                   	push   %ebx
+  804b3f:	83 c0 08             	add    $0x8,%eax
+  804b42:	50                   	push   %eax
+  804b43:	e8 8f 22 00 00       	call   806dd7 <strcpy>
+}
+  804b48:	83 c4 10             	add    $0x10,%esp
+  804b4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b4e:	5b                   	pop    %ebx
+  804b4f:	5e                   	pop    %esi
+  804b50:	5d                   	pop    %ebp
+  804b51:	c3                   	ret
+
+00804b52 <dcache_invalidate>:
+
+// Forget whatever is cached about name in dir.  Call whenever name is
+// created, removed or renamed.
+void
+dcache_invalidate(struct File *dir, const char *name)
+{
+  804b52:	55                   	push   %ebp
+  804b53:	89 e5                	mov    %esp,%ebp
+  804b55:	56                   	push   %esi
+  804b56:	53                   	push   %ebx
+  804b57:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Dentry *d = dcache_slot(dir, name);
+  804b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804b5d:	89 f0                	mov    %esi,%eax
+  804b5f:	e8 18 ff ff ff       	call   804a7c <dcache_slot>
+
+	if (d->d_dir == dir && strcmp(d->d_name, name) == 0)
+  804b64:	39 30                	cmp    %esi,(%eax)
+  804b66:	74 07                	je     804b6f <dcache_invalidate+0x1d>
+		d->d_dir = 0;
+}
+  804b68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b6b:	5b                   	pop    %ebx
+  804b6c:	5e                   	pop    %esi
+  804b6d:	5d                   	pop    %ebp
+  804b6e:	c3                   	ret
+  804b6f:	89 c3                	mov    %eax,%ebx
+	if (d->d_dir == dir && strcmp(d->d_name, name) == 0)
+  804b71:	83 ec 08             	sub    $0x8,%esp
+  804b74:	ff 75 0c             	push   0xc(%ebp)
+  804b77:	8d 40 08             	lea    0x8(%eax),%eax
+  804b7a:	50                   	push   %eax
+  804b7b:	e8 08 23 00 00       	call   806e88 <strcmp>
+  804b80:	83 c4 10             	add    $0x10,%esp
+  804b83:	85 c0                	test   %eax,%eax
+  804b85:	75 e1                	jne    804b68 <dcache_invalidate+0x16>
+		d->d_dir = 0;
+  804b87:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+  804b8d:	eb d9                	jmp    804b68 <dcache_invalidate+0x16>
+
+00804b8f <aioclient_live>:
+static struct AioClient aioclients[NAIOCLIENTS];
+
+// Is the env that registered ac still running?
+static bool
+aioclient_live(struct AioClient *ac)
+{
+  804b8f:	89 c2                	mov    %eax,%edx
+	const volatile struct Env *e = &envs[ENVX(ac->ac_env)];
+  804b91:	8b 00                	mov    (%eax),%eax
+
+	return ac->ac_env && e->env_id == ac->ac_env
+		&& e->env_status != ENV_FREE && e->env_pgdir == ac->ac_pgdir;
+  804b93:	85 c0                	test   %eax,%eax
+  804b95:	74 5a                	je     804bf1 <aioclient_live+0x62>
+{
+  804b97:	55                   	push   %ebp
+  804b98:	89 e5                	mov    %esp,%ebp
+  804b9a:	53                   	push   %ebx
+	const volatile struct Env *e = &envs[ENVX(ac->ac_env)];
+  804b9b:	89 c3                	mov    %eax,%ebx
+  804b9d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	return ac->ac_env && e->env_id == ac->ac_env
+  804ba3:	8d 0c db             	lea    (%ebx,%ebx,8),%ecx
+  804ba6:	c1 e1 04             	shl    $0x4,%ecx
+  804ba9:	81 c1 00 00 c0 ee    	add    $0xeec00000,%ecx
+  804baf:	8b 49 48             	mov    0x48(%ecx),%ecx
+  804bb2:	39 c8                	cmp    %ecx,%eax
+  804bb4:	74 0d                	je     804bc3 <aioclient_live+0x34>
+		&& e->env_status != ENV_FREE && e->env_pgdir == ac->ac_pgdir;
+  804bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bbb:	83 e0 01             	and    $0x1,%eax
+}
+  804bbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804bc1:	c9                   	leave
+  804bc2:	c3                   	ret
+		&& e->env_status != ENV_FREE && e->env_pgdir == ac->ac_pgdir;
+  804bc3:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+  804bc6:	c1 e0 04             	shl    $0x4,%eax
+  804bc9:	8b 88 54 00 c0 ee    	mov    -0x113fffac(%eax),%ecx
+  804bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd4:	85 c9                	test   %ecx,%ecx
+  804bd6:	74 e3                	je     804bbb <aioclient_live+0x2c>
+  804bd8:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+  804bdb:	c1 e0 04             	shl    $0x4,%eax
+  804bde:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804be3:	8b 40 60             	mov    0x60(%eax),%eax
+  804be6:	39 42 04             	cmp    %eax,0x4(%edx)
+  804be9:	0f 94 c0             	sete   %al
+  804bec:	0f b6 c0             	movzbl %al,%eax
+  804bef:	eb ca                	jmp    804bbb <aioclient_live+0x2c>
+  804bf1:	83 e0 01             	and    $0x1,%eax
+}
+  804bf4:	c3                   	ret
+
+00804bf5 <aioclient_lookup>:
+}
+
+// Find the registered client whose address space envid runs in.
+static struct AioClient*
+aioclient_lookup(envid_t envid)
+{
+  804bf5:	55                   	push   %ebp
+  804bf6:	89 e5                	mov    %esp,%ebp
+  804bf8:	57                   	push   %edi
+  804bf9:	56                   	push   %esi
+  804bfa:	53                   	push   %ebx
+  804bfb:	83 ec 0c             	sub    $0xc,%esp
+	struct AioClient *ac;
+
+	for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+  804bfe:	bb a0 be 84 00       	mov    $0x84bea0,%ebx
+		if (aioclient_live(ac) && ac->ac_pgdir == envs[ENVX(envid)].env_pgdir)
+  804c03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c08:	89 c6                	mov    %eax,%esi
+  804c0a:	8d 3c c5 00 00 00 00 	lea    0x0(,%eax,8),%edi
+  804c11:	eb 0b                	jmp    804c1e <aioclient_lookup+0x29>
+	for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+  804c13:	83 c3 08             	add    $0x8,%ebx
+  804c16:	81 fb a0 c0 84 00    	cmp    $0x84c0a0,%ebx
+  804c1c:	74 28                	je     804c46 <aioclient_lookup+0x51>
+		if (aioclient_live(ac) && ac->ac_pgdir == envs[ENVX(envid)].env_pgdir)
+  804c1e:	89 d8                	mov    %ebx,%eax
+  804c20:	e8 6a ff ff ff       	call   804b8f <aioclient_live>
+  804c25:	84 c0                	test   %al,%al
+  804c27:	74 ea                	je     804c13 <aioclient_lookup+0x1e>
+  804c29:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  804c2c:	c1 e0 04             	shl    $0x4,%eax
+  804c2f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804c34:	8b 40 60             	mov    0x60(%eax),%eax
+  804c37:	39 43 04             	cmp    %eax,0x4(%ebx)
+  804c3a:	75 d7                	jne    804c13 <aioclient_lookup+0x1e>
+			return ac;
+	return NULL;
+}
+  804c3c:	89 d8                	mov    %ebx,%eax
+  804c3e:	83 c4 0c             	add    $0xc,%esp
+  804c41:	5b                   	pop    %ebx
+  804c42:	5e                   	pop    %esi
+  804c43:	5f                   	pop    %edi
+  804c44:	5d                   	pop    %ebp
+  804c45:	c3                   	ret
+	return NULL;
+  804c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804c4b:	eb ef                	jmp    804c3c <aioclient_lookup+0x47>
+
+00804c4d <serve_aio_setup>:
+
+// Keep the request page as envid's completion queue, replacing any
+// queue it had before.
+int
+serve_aio_setup(envid_t envid, union Fsipc *ipc)
+{
+  804c4d:	55                   	push   %ebp
+  804c4e:	89 e5                	mov    %esp,%ebp
+  804c50:	56                   	push   %esi
+  804c51:	53                   	push   %ebx
+  804c52:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+
+	if (debug)
+		cprintf("serve_aio_setup %08x\n", envid);
+
+	if ((ac = aioclient_lookup(envid)) == NULL)
+  804c55:	89 f0                	mov    %esi,%eax
+  804c57:	e8 99 ff ff ff       	call   804bf5 <aioclient_lookup>
+  804c5c:	85 c0                	test   %eax,%eax
+  804c5e:	74 56                	je     804cb6 <serve_aio_setup+0x69>
+  804c60:	89 c3                	mov    %eax,%ebx
+		for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+			if (!aioclient_live(ac))
+				break;
+	if (ac == aioclients + NAIOCLIENTS)
+  804c62:	3d a0 c0 84 00       	cmp    $0x84c0a0,%eax
+  804c67:	74 6f                	je     804cd8 <serve_aio_setup+0x8b>
+		return -E_MAX_OPEN;
+	if ((r = sys_page_map(0, ipc, 0, aioclient_cq(ac), PTE_P|PTE_U|PTE_W)) < 0)
+  804c69:	83 ec 0c             	sub    $0xc,%esp
+  804c6c:	6a 07                	push   $0x7
+	return (struct FsaioCq*) (AIOCQVA + (ac - aioclients) * PGSIZE);
+  804c6e:	89 d8                	mov    %ebx,%eax
+  804c70:	2d a0 be 84 00       	sub    $0x84bea0,%eax
+  804c75:	c1 e0 09             	shl    $0x9,%eax
+  804c78:	2d 00 00 c0 2f       	sub    $0x2fc00000,%eax
+	if ((r = sys_page_map(0, ipc, 0, aioclient_cq(ac), PTE_P|PTE_U|PTE_W)) < 0)
+  804c7d:	50                   	push   %eax
+  804c7e:	6a 00                	push   $0x0
+  804c80:	ff 75 0c             	push   0xc(%ebp)
+  804c83:	6a 00                	push   $0x0
+  804c85:	e8 d8 25 00 00       	call   807262 <sys_page_map>
+  804c8a:	83 c4 20             	add    $0x20,%esp
+  804c8d:	85 c0                	test   %eax,%eax
+  804c8f:	78 1e                	js     804caf <serve_aio_setup+0x62>
+		return r;
+	ac->ac_env = envid;
+  804c91:	89 33                	mov    %esi,(%ebx)
+	ac->ac_pgdir = envs[ENVX(envid)].env_pgdir;
+  804c93:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804c99:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804c9c:	c1 e0 04             	shl    $0x4,%eax
+  804c9f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804ca4:	8b 40 60             	mov    0x60(%eax),%eax
+  804ca7:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  804caa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804caf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804cb2:	5b                   	pop    %ebx
+  804cb3:	5e                   	pop    %esi
+  804cb4:	5d                   	pop    %ebp
+  804cb5:	c3                   	ret
+		for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+  804cb6:	bb a0 be 84 00       	mov    $0x84bea0,%ebx
+			if (!aioclient_live(ac))
+  804cbb:	89 d8                	mov    %ebx,%eax
+  804cbd:	e8 cd fe ff ff       	call   804b8f <aioclient_live>
+  804cc2:	84 c0                	test   %al,%al
+  804cc4:	74 a3                	je     804c69 <serve_aio_setup+0x1c>
+		for (ac = aioclients; ac < aioclients + NAIOCLIENTS; ac++)
+  804cc6:	83 c3 08             	add    $0x8,%ebx
+  804cc9:	81 fb a0 c0 84 00    	cmp    $0x84c0a0,%ebx
+  804ccf:	75 ea                	jne    804cbb <serve_aio_setup+0x6e>
+		return -E_MAX_OPEN;
+  804cd1:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  804cd6:	eb d7                	jmp    804caf <serve_aio_setup+0x62>
+  804cd8:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  804cdd:	eb d0                	jmp    804caf <serve_aio_setup+0x62>
+
+00804cdf <serve_sync>:
+{
+  804cdf:	55                   	push   %ebp
+  804ce0:	89 e5                	mov    %esp,%ebp
+  804ce2:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  804ce5:	e8 1e fd ff ff       	call   804a08 <fs_sync>
+}
+  804cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cef:	c9                   	leave
+  804cf0:	c3                   	ret
+
+00804cf1 <serve_remove>:
+{
+  804cf1:	55                   	push   %ebp
+  804cf2:	89 e5                	mov    %esp,%ebp
+  804cf4:	56                   	push   %esi
+  804cf5:	53                   	push   %ebx
+  804cf6:	81 ec 14 04 00 00    	sub    $0x414,%esp
+	memmove(path, req->req_path, MAXPATHLEN);
+  804cfc:	68 00 04 00 00       	push   $0x400
+  804d01:	ff 75 0c             	push   0xc(%ebp)
+  804d04:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  804d0a:	53                   	push   %ebx
+  804d0b:	e8 4d 22 00 00       	call   806f5d <memmove>
+	path[MAXPATHLEN-1] = 0;
+  804d10:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = file_open(path, &f)) < 0)
+  804d14:	83 c4 08             	add    $0x8,%esp
+  804d17:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  804d1d:	50                   	push   %eax
+  804d1e:	53                   	push   %ebx
+  804d1f:	e8 45 f4 ff ff       	call   804169 <file_open>
+  804d24:	83 c4 10             	add    $0x10,%esp
+  804d27:	85 c0                	test   %eax,%eax
+  804d29:	78 49                	js     804d74 <serve_remove+0x83>
+  804d2b:	bb a4 d0 80 00       	mov    $0x80d0a4,%ebx
+  804d30:	be a4 10 81 00       	mov    $0x8110a4,%esi
+  804d35:	eb 03                	jmp    804d3a <serve_remove+0x49>
+	for (i = 0; i < MAXOPEN; i++)
+  804d37:	83 c3 10             	add    $0x10,%ebx
+  804d3a:	39 f3                	cmp    %esi,%ebx
+  804d3c:	74 24                	je     804d62 <serve_remove+0x71>
+		if (opentab[i].o_file == f && pageref(opentab[i].o_fd) > 1)
+  804d3e:	8b 85 f4 fb ff ff    	mov    -0x40c(%ebp),%eax
+  804d44:	39 03                	cmp    %eax,(%ebx)
+  804d46:	75 ef                	jne    804d37 <serve_remove+0x46>
+  804d48:	83 ec 0c             	sub    $0xc,%esp
+  804d4b:	ff 73 08             	push   0x8(%ebx)
+  804d4e:	e8 45 41 00 00       	call   808e98 <pageref>
+  804d53:	83 c4 10             	add    $0x10,%esp
+  804d56:	83 f8 01             	cmp    $0x1,%eax
+  804d59:	7e dc                	jle    804d37 <serve_remove+0x46>
+			return -E_INVAL;
+  804d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d60:	eb 12                	jmp    804d74 <serve_remove+0x83>
+	return file_remove(path);
+  804d62:	83 ec 0c             	sub    $0xc,%esp
+  804d65:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  804d6b:	50                   	push   %eax
+  804d6c:	e8 de fa ff ff       	call   80484f <file_remove>
+  804d71:	83 c4 10             	add    $0x10,%esp
+}
+  804d74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d77:	5b                   	pop    %ebx
+  804d78:	5e                   	pop    %esi
+  804d79:	5d                   	pop    %ebp
+  804d7a:	c3                   	ret
+
+00804d7b <serve_bcstat>:
+{
+  804d7b:	55                   	push   %ebp
+  804d7c:	89 e5                	mov    %esp,%ebp
+  804d7e:	53                   	push   %ebx
+  804d7f:	83 ec 04             	sub    $0x4,%esp
+  804d82:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (ipc->bcstat.req_budget
+  804d85:	8b 03                	mov    (%ebx),%eax
+  804d87:	85 c0                	test   %eax,%eax
+  804d89:	74 10                	je     804d9b <serve_bcstat+0x20>
+	    && (r = bc_set_budget(ipc->bcstat.req_budget)) < 0)
+  804d8b:	83 ec 0c             	sub    $0xc,%esp
+  804d8e:	50                   	push   %eax
+  804d8f:	e8 f3 d2 ff ff       	call   802087 <bc_set_budget>
+  804d94:	83 c4 10             	add    $0x10,%esp
+  804d97:	85 c0                	test   %eax,%eax
+  804d99:	78 11                	js     804dac <serve_bcstat+0x31>
+	bc_get_stat(&ipc->bcstatRet);
+  804d9b:	83 ec 0c             	sub    $0xc,%esp
+  804d9e:	53                   	push   %ebx
+  804d9f:	e8 6a ce ff ff       	call   801c0e <bc_get_stat>
+	return 0;
+  804da4:	83 c4 10             	add    $0x10,%esp
+  804da7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804daf:	c9                   	leave
+  804db0:	c3                   	ret
+
+00804db1 <serve_load>:
+	sys_futex_wake(&cq->cq_tail, PTHREAD_MAX);
+}
+
+int
+serve_load(envid_t envid, union Fsipc *ipc)
+{
+  804db1:	55                   	push   %ebp
+  804db2:	89 e5                	mov    %esp,%ebp
+  804db4:	57                   	push   %edi
+  804db5:	56                   	push   %esi
+  804db6:	53                   	push   %ebx
+  804db7:	81 ec 80 06 00 00    	sub    $0x680,%esp
+	int r;
+
+	if (debug)
+		cprintf("path is %p %s\n", req->req_path, req->req_path);
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+  804dbd:	68 00 04 00 00       	push   $0x400
+  804dc2:	ff 75 0c             	push   0xc(%ebp)
+  804dc5:	8d 9d e8 f9 ff ff    	lea    -0x618(%ebp),%ebx
+  804dcb:	53                   	push   %ebx
+  804dcc:	e8 8c 21 00 00       	call   806f5d <memmove>
+	path[MAXPATHLEN-1] = 0;
+  804dd1:	c6 85 e7 fd ff ff 00 	movb   $0x0,-0x219(%ebp)
+
+	// now we can unmap fsipcbuf
+	if ((r = sys_page_unmap(envid, UTEMP)) < 0) {
+  804dd8:	83 c4 08             	add    $0x8,%esp
+  804ddb:	68 00 00 40 00       	push   $0x400000
+  804de0:	ff 75 08             	push   0x8(%ebp)
+  804de3:	e8 c6 24 00 00       	call   8072ae <sys_page_unmap>
+		if (debug)
+			cprintf("unmap UTEMP failed, %e", r);
+	}
+	if ((r = file_open(path, &f)) < 0) {
+  804de8:	83 c4 08             	add    $0x8,%esp
+  804deb:	8d 85 a0 f9 ff ff    	lea    -0x660(%ebp),%eax
+  804df1:	50                   	push   %eax
+  804df2:	53                   	push   %ebx
+  804df3:	e8 71 f3 ff ff       	call   804169 <file_open>
+  804df8:	89 c7                	mov    %eax,%edi
+  804dfa:	83 c4 10             	add    $0x10,%esp
+  804dfd:	85 c0                	test   %eax,%eax
+  804dff:	0f 88 c6 02 00 00    	js     8050cb <serve_load+0x31a>
+			cprintf("file_open failed: %e\n", r);
+		goto error;
+	}
+
+	elf = (struct Elf *)elf_buf;
+	if ((len = file_read(f, elf_buf, sizeof(elf_buf), 0)) != sizeof(elf_buf)
+  804e05:	6a 00                	push   $0x0
+  804e07:	68 00 02 00 00       	push   $0x200
+  804e0c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  804e12:	50                   	push   %eax
+  804e13:	ff b5 a0 f9 ff ff    	push   -0x660(%ebp)
+  804e19:	e8 65 f3 ff ff       	call   804183 <file_read>
+  804e1e:	83 c4 10             	add    $0x10,%esp
+  804e21:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804e26:	0f 85 9a 02 00 00    	jne    8050c6 <serve_load+0x315>
+		|| elf->e_magic != ELF_MAGIC) {
+  804e2c:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  804e33:	45 4c 46 
+  804e36:	0f 85 a7 02 00 00    	jne    8050e3 <serve_load+0x332>
+		goto error;
+	}
+	if (debug)
+		cprintf("magic: %x  entry: %x\n", elf->e_magic, elf->e_entry);
+
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  804e3c:	8b 8d 04 fe ff ff    	mov    -0x1fc(%ebp),%ecx
+
+	// FIXME: allow program header out of elf_buf
+	if (elf->e_ehsize + elf->e_phnum * elf->e_phentsize >= sizeof(elf_buf)) {
+  804e42:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  804e49:	0f b7 95 12 fe ff ff 	movzwl -0x1ee(%ebp),%edx
+  804e50:	0f af c2             	imul   %edx,%eax
+  804e53:	0f b7 95 10 fe ff ff 	movzwl -0x1f0(%ebp),%edx
+  804e5a:	01 d0                	add    %edx,%eax
+  804e5c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  804e61:	0f 87 83 02 00 00    	ja     8050ea <serve_load+0x339>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  804e67:	8d 84 0d e8 fd ff ff 	lea    -0x218(%ebp,%ecx,1),%eax
+  804e6e:	89 85 7c f9 ff ff    	mov    %eax,-0x684(%ebp)
+		r = -E_NOT_EXEC;
+		goto error;
+	}
+
+	// Set up program segments as defined in ELF header.
+	for (int i = 0; i < elf->e_phnum; i++, ph++) {
+  804e74:	c7 85 80 f9 ff ff 00 	movl   $0x0,-0x680(%ebp)
+  804e7b:	00 00 00 
+  804e7e:	e9 48 01 00 00       	jmp    804fcb <serve_load+0x21a>
+				cprintf("sys_page_alloc failed, %e\n", r);
+				return r;
+			}
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0) {
+  804e83:	83 ec 04             	sub    $0x4,%esp
+  804e86:	6a 07                	push   $0x7
+  804e88:	68 00 00 40 00       	push   $0x400000
+  804e8d:	6a 00                	push   $0x0
+  804e8f:	e8 81 23 00 00       	call   807215 <sys_page_alloc>
+  804e94:	83 c4 10             	add    $0x10,%esp
+  804e97:	85 c0                	test   %eax,%eax
+  804e99:	0f 88 df 00 00 00    	js     804f7e <serve_load+0x1cd>
+				cprintf("sys_page_alloc failed, %e\n", r);
+				return r;
+			}
+			if ((r = file_read(f, UTEMP, MIN(PGSIZE, filesz-i), fileoffset + i)) < 0) {
+  804e9f:	8b 85 88 f9 ff ff    	mov    -0x678(%ebp),%eax
+  804ea5:	8b 8d 94 f9 ff ff    	mov    -0x66c(%ebp),%ecx
+  804eab:	01 c8                	add    %ecx,%eax
+  804ead:	50                   	push   %eax
+  804eae:	89 f8                	mov    %edi,%eax
+  804eb0:	29 c8                	sub    %ecx,%eax
+  804eb2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804eb7:	39 d0                	cmp    %edx,%eax
+  804eb9:	0f 47 c2             	cmova  %edx,%eax
+  804ebc:	50                   	push   %eax
+  804ebd:	68 00 00 40 00       	push   $0x400000
+  804ec2:	ff b5 84 f9 ff ff    	push   -0x67c(%ebp)
+  804ec8:	e8 b6 f2 ff ff       	call   804183 <file_read>
+  804ecd:	83 c4 10             	add    $0x10,%esp
+  804ed0:	85 c0                	test   %eax,%eax
+  804ed2:	0f 88 bb 00 00 00    	js     804f93 <serve_load+0x1e2>
+				cprintf("file read failed, %e\n", r);
+				return r;
+			}
+			if ((r = sys_page_map(0, UTEMP, envid, (void*) (va + i), perm)) < 0)
+  804ed8:	83 ec 0c             	sub    $0xc,%esp
+  804edb:	ff b5 8c f9 ff ff    	push   -0x674(%ebp)
+  804ee1:	56                   	push   %esi
+  804ee2:	ff 75 08             	push   0x8(%ebp)
+  804ee5:	68 00 00 40 00       	push   $0x400000
+  804eea:	6a 00                	push   $0x0
+  804eec:	e8 71 23 00 00       	call   807262 <sys_page_map>
+  804ef1:	83 c4 20             	add    $0x20,%esp
+  804ef4:	85 c0                	test   %eax,%eax
+  804ef6:	0f 88 ac 00 00 00    	js     804fa8 <serve_load+0x1f7>
+				panic("exec: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  804efc:	83 ec 08             	sub    $0x8,%esp
+  804eff:	68 00 00 40 00       	push   $0x400000
+  804f04:	6a 00                	push   $0x0
+  804f06:	e8 a3 23 00 00       	call   8072ae <sys_page_unmap>
+  804f0b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  804f0e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804f14:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804f1a:	89 9d 94 f9 ff ff    	mov    %ebx,-0x66c(%ebp)
+  804f20:	8b 85 90 f9 ff ff    	mov    -0x670(%ebp),%eax
+  804f26:	39 c3                	cmp    %eax,%ebx
+  804f28:	0f 83 8f 00 00 00    	jae    804fbd <serve_load+0x20c>
+		if (i >= filesz) {
+  804f2e:	39 fb                	cmp    %edi,%ebx
+  804f30:	0f 82 4d ff ff ff    	jb     804e83 <serve_load+0xd2>
+			if ((r = sys_page_alloc(envid, (void*) (va + i), perm)) < 0) {
+  804f36:	83 ec 04             	sub    $0x4,%esp
+  804f39:	ff b5 8c f9 ff ff    	push   -0x674(%ebp)
+  804f3f:	56                   	push   %esi
+  804f40:	ff 75 08             	push   0x8(%ebp)
+  804f43:	e8 cd 22 00 00       	call   807215 <sys_page_alloc>
+  804f48:	83 c4 10             	add    $0x10,%esp
+  804f4b:	85 c0                	test   %eax,%eax
+  804f4d:	79 bf                	jns    804f0e <serve_load+0x15d>
+				cprintf("sys_page_alloc failed, %e\n", r);
+  804f4f:	89 c7                	mov    %eax,%edi
+  804f51:	83 ec 08             	sub    $0x8,%esp
+  804f54:	50                   	push   %eax
+  804f55:	68 fd b2 80 00       	push   $0x80b2fd
+  804f5a:	e8 94 18 00 00       	call   8067f3 <cprintf>
+				return r;
+  804f5f:	83 c4 10             	add    $0x10,%esp
+			cprintf("%dth program map failed, %e\n", i, r);
+  804f62:	83 ec 04             	sub    $0x4,%esp
+  804f65:	57                   	push   %edi
+  804f66:	ff b5 80 f9 ff ff    	push   -0x680(%ebp)
+  804f6c:	68 54 b3 80 00       	push   $0x80b354
+  804f71:	e8 7d 18 00 00       	call   8067f3 <cprintf>
+			goto error;
+  804f76:	83 c4 10             	add    $0x10,%esp
+  804f79:	e9 4d 01 00 00       	jmp    8050cb <serve_load+0x31a>
+				cprintf("sys_page_alloc failed, %e\n", r);
+  804f7e:	89 c7                	mov    %eax,%edi
+  804f80:	83 ec 08             	sub    $0x8,%esp
+  804f83:	50                   	push   %eax
+  804f84:	68 fd b2 80 00       	push   $0x80b2fd
+  804f89:	e8 65 18 00 00       	call   8067f3 <cprintf>
+				return r;
+  804f8e:	83 c4 10             	add    $0x10,%esp
+  804f91:	eb cf                	jmp    804f62 <serve_load+0x1b1>
+				cprintf("file read failed, %e\n", r);
+  804f93:	89 c7                	mov    %eax,%edi
+  804f95:	83 ec 08             	sub    $0x8,%esp
+  804f98:	50                   	push   %eax
+  804f99:	68 18 b3 80 00       	push   $0x80b318
+  804f9e:	e8 50 18 00 00       	call   8067f3 <cprintf>
+				return r;
+  804fa3:	83 c4 10             	add    $0x10,%esp
+  804fa6:	eb ba                	jmp    804f62 <serve_load+0x1b1>
+				panic("exec: sys_page_map data: %e", r);
+  804fa8:	50                   	push   %eax
+  804fa9:	68 2e b3 80 00       	push   $0x80b32e
+  804fae:	68 65 03 00 00       	push   $0x365
+  804fb3:	68 4a b3 80 00       	push   $0x80b34a
+  804fb8:	e8 5b 17 00 00       	call   806718 <_panic>
+	for (int i = 0; i < elf->e_phnum; i++, ph++) {
+  804fbd:	83 85 80 f9 ff ff 01 	addl   $0x1,-0x680(%ebp)
+  804fc4:	83 85 7c f9 ff ff 20 	addl   $0x20,-0x684(%ebp)
+  804fcb:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  804fd2:	39 85 80 f9 ff ff    	cmp    %eax,-0x680(%ebp)
+  804fd8:	0f 8d 92 00 00 00    	jge    805070 <serve_load+0x2bf>
+		if (ph->p_type != ELF_PROG_LOAD)
+  804fde:	8b 85 7c f9 ff ff    	mov    -0x684(%ebp),%eax
+  804fe4:	83 38 01             	cmpl   $0x1,(%eax)
+  804fe7:	75 d4                	jne    804fbd <serve_load+0x20c>
+		cprintf("map %dth programs\n", i);
+  804fe9:	83 ec 08             	sub    $0x8,%esp
+  804fec:	ff b5 80 f9 ff ff    	push   -0x680(%ebp)
+  804ff2:	68 ea b2 80 00       	push   $0x80b2ea
+  804ff7:	e8 f7 17 00 00       	call   8067f3 <cprintf>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  804ffc:	8b b5 7c f9 ff ff    	mov    -0x684(%ebp),%esi
+  805002:	8b 46 18             	mov    0x18(%esi),%eax
+  805005:	89 85 94 f9 ff ff    	mov    %eax,-0x66c(%ebp)
+  80500b:	83 e0 02             	and    $0x2,%eax
+  80500e:	83 c4 10             	add    $0x10,%esp
+		perm = PTE_P | PTE_U;
+  805011:	83 f8 01             	cmp    $0x1,%eax
+  805014:	19 c0                	sbb    %eax,%eax
+  805016:	83 e0 fe             	and    $0xfffffffe,%eax
+  805019:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(envid, ph->p_va, ph->p_memsz, f, ph->p_filesz, ph->p_offset, perm)) < 0) {
+  80501c:	8b 7e 04             	mov    0x4(%esi),%edi
+  80501f:	89 bd 88 f9 ff ff    	mov    %edi,-0x678(%ebp)
+  805025:	8b 4e 10             	mov    0x10(%esi),%ecx
+  805028:	8b 95 a0 f9 ff ff    	mov    -0x660(%ebp),%edx
+  80502e:	89 95 84 f9 ff ff    	mov    %edx,-0x67c(%ebp)
+  805034:	8b 56 14             	mov    0x14(%esi),%edx
+  805037:	89 95 90 f9 ff ff    	mov    %edx,-0x670(%ebp)
+  80503d:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  805040:	89 d3                	mov    %edx,%ebx
+  805042:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  805048:	74 12                	je     80505c <serve_load+0x2ab>
+		va -= i;
+  80504a:	29 da                	sub    %ebx,%edx
+		memsz += i;
+  80504c:	01 9d 90 f9 ff ff    	add    %ebx,-0x670(%ebp)
+		filesz += i;
+  805052:	01 d9                	add    %ebx,%ecx
+		fileoffset -= i;
+  805054:	29 df                	sub    %ebx,%edi
+  805056:	89 bd 88 f9 ff ff    	mov    %edi,-0x678(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  80505c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805061:	89 85 8c f9 ff ff    	mov    %eax,-0x674(%ebp)
+  805067:	89 cf                	mov    %ecx,%edi
+  805069:	89 d6                	mov    %edx,%esi
+  80506b:	e9 aa fe ff ff       	jmp    804f1a <serve_load+0x169>
+	env = &envs[ENVX(envid)];
+  805070:	8b 45 08             	mov    0x8(%ebp),%eax
+  805073:	25 ff 03 00 00       	and    $0x3ff,%eax
+	tf = env->env_tf;
+  805078:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80507b:	c1 e6 04             	shl    $0x4,%esi
+  80507e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  805084:	8d bd a4 f9 ff ff    	lea    -0x65c(%ebp),%edi
+  80508a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80508f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	tf.tf_eip = elf->e_entry;
+  805091:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  805097:	89 85 d4 f9 ff ff    	mov    %eax,-0x62c(%ebp)
+	sys_env_set_trapframe(envid, &tf);
+  80509d:	83 ec 08             	sub    $0x8,%esp
+  8050a0:	8d 85 a4 f9 ff ff    	lea    -0x65c(%ebp),%eax
+  8050a6:	50                   	push   %eax
+  8050a7:	ff 75 08             	push   0x8(%ebp)
+  8050aa:	e8 97 22 00 00       	call   807346 <sys_env_set_trapframe>
+	sys_env_set_status(envid, ENV_RUNNABLE);
+  8050af:	83 c4 08             	add    $0x8,%esp
+  8050b2:	6a 02                	push   $0x2
+  8050b4:	ff 75 08             	push   0x8(%ebp)
+  8050b7:	e8 3e 22 00 00       	call   8072fa <sys_env_set_status>
+	return 0;
+  8050bc:	83 c4 10             	add    $0x10,%esp
+  8050bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050c4:	eb 13                	jmp    8050d9 <serve_load+0x328>
+		r = -E_NOT_EXEC;
+  8050c6:	bf f2 ff ff ff       	mov    $0xfffffff2,%edi
+	sys_env_destroy(envid);
+  8050cb:	83 ec 0c             	sub    $0xc,%esp
+  8050ce:	ff 75 08             	push   0x8(%ebp)
+  8050d1:	e8 9c 20 00 00       	call   807172 <sys_env_destroy>
+	return r;
+  8050d6:	83 c4 10             	add    $0x10,%esp
+}
+  8050d9:	89 f8                	mov    %edi,%eax
+  8050db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050de:	5b                   	pop    %ebx
+  8050df:	5e                   	pop    %esi
+  8050e0:	5f                   	pop    %edi
+  8050e1:	5d                   	pop    %ebp
+  8050e2:	c3                   	ret
+		r = -E_NOT_EXEC;
+  8050e3:	bf f2 ff ff ff       	mov    $0xfffffff2,%edi
+  8050e8:	eb e1                	jmp    8050cb <serve_load+0x31a>
+		r = -E_NOT_EXEC;
+  8050ea:	bf f2 ff ff ff       	mov    $0xfffffff2,%edi
+  8050ef:	eb da                	jmp    8050cb <serve_load+0x31a>
+
+008050f1 <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  8050f1:	ba a0 d0 80 00       	mov    $0x80d0a0,%edx
+	uintptr_t va = FILEVA;
+  8050f6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  8050fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		opentab[i].o_fileid = i;
+  805100:	89 0a                	mov    %ecx,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  805102:	89 42 0c             	mov    %eax,0xc(%edx)
+		va += PGSIZE;
+  805105:	05 00 10 00 00       	add    $0x1000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  80510a:	83 c1 01             	add    $0x1,%ecx
+  80510d:	83 c2 10             	add    $0x10,%edx
+  805110:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  805115:	75 e9                	jne    805100 <serve_init+0xf>
+}
+  805117:	c3                   	ret
+
+00805118 <openfile_alloc>:
+{
+  805118:	55                   	push   %ebp
+  805119:	89 e5                	mov    %esp,%ebp
+  80511b:	57                   	push   %edi
+  80511c:	56                   	push   %esi
+  80511d:	53                   	push   %ebx
+  80511e:	83 ec 0c             	sub    $0xc,%esp
+  805121:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < MAXOPEN; i++) {
+  805124:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch (pageref(opentab[i].o_fd)) {
+  805129:	89 de                	mov    %ebx,%esi
+  80512b:	c1 e6 04             	shl    $0x4,%esi
+  80512e:	83 ec 0c             	sub    $0xc,%esp
+  805131:	ff b6 ac d0 80 00    	push   0x80d0ac(%esi)
+  805137:	e8 5c 3d 00 00       	call   808e98 <pageref>
+  80513c:	83 c4 10             	add    $0x10,%esp
+  80513f:	85 c0                	test   %eax,%eax
+  805141:	74 17                	je     80515a <openfile_alloc+0x42>
+  805143:	83 f8 01             	cmp    $0x1,%eax
+  805146:	74 30                	je     805178 <openfile_alloc+0x60>
+	for (i = 0; i < MAXOPEN; i++) {
+  805148:	83 c3 01             	add    $0x1,%ebx
+  80514b:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  805151:	75 d6                	jne    805129 <openfile_alloc+0x11>
+	return -E_MAX_OPEN;
+  805153:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  805158:	eb 4f                	jmp    8051a9 <openfile_alloc+0x91>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  80515a:	83 ec 04             	sub    $0x4,%esp
+  80515d:	6a 07                	push   $0x7
+  80515f:	89 d8                	mov    %ebx,%eax
+  805161:	c1 e0 04             	shl    $0x4,%eax
+  805164:	ff b0 ac d0 80 00    	push   0x80d0ac(%eax)
+  80516a:	6a 00                	push   $0x0
+  80516c:	e8 a4 20 00 00       	call   807215 <sys_page_alloc>
+  805171:	83 c4 10             	add    $0x10,%esp
+  805174:	85 c0                	test   %eax,%eax
+  805176:	78 31                	js     8051a9 <openfile_alloc+0x91>
+			opentab[i].o_fileid += MAXOPEN;
+  805178:	c1 e3 04             	shl    $0x4,%ebx
+  80517b:	81 83 a0 d0 80 00 00 	addl   $0x400,0x80d0a0(%ebx)
+  805182:	04 00 00 
+			*o = &opentab[i];
+  805185:	81 c6 a0 d0 80 00    	add    $0x80d0a0,%esi
+  80518b:	89 37                	mov    %esi,(%edi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  80518d:	83 ec 04             	sub    $0x4,%esp
+  805190:	68 00 10 00 00       	push   $0x1000
+  805195:	6a 00                	push   $0x0
+  805197:	ff b3 ac d0 80 00    	push   0x80d0ac(%ebx)
+  80519d:	e8 86 1d 00 00       	call   806f28 <memset>
+			return (*o)->o_fileid;
+  8051a2:	8b 07                	mov    (%edi),%eax
+  8051a4:	8b 00                	mov    (%eax),%eax
+  8051a6:	83 c4 10             	add    $0x10,%esp
+}
+  8051a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051ac:	5b                   	pop    %ebx
+  8051ad:	5e                   	pop    %esi
+  8051ae:	5f                   	pop    %edi
+  8051af:	5d                   	pop    %ebp
+  8051b0:	c3                   	ret
+
+008051b1 <openfile_lookup>:
+{
+  8051b1:	55                   	push   %ebp
+  8051b2:	89 e5                	mov    %esp,%ebp
+  8051b4:	57                   	push   %edi
+  8051b5:	56                   	push   %esi
+  8051b6:	53                   	push   %ebx
+  8051b7:	83 ec 18             	sub    $0x18,%esp
+  8051ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  8051bd:	89 fb                	mov    %edi,%ebx
+  8051bf:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8051c5:	89 de                	mov    %ebx,%esi
+  8051c7:	c1 e6 04             	shl    $0x4,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8051ca:	ff b6 ac d0 80 00    	push   0x80d0ac(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  8051d0:	81 c6 a0 d0 80 00    	add    $0x80d0a0,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8051d6:	e8 bd 3c 00 00       	call   808e98 <pageref>
+  8051db:	83 c4 10             	add    $0x10,%esp
+  8051de:	83 f8 01             	cmp    $0x1,%eax
+  8051e1:	7e 1d                	jle    805200 <openfile_lookup+0x4f>
+  8051e3:	c1 e3 04             	shl    $0x4,%ebx
+  8051e6:	39 bb a0 d0 80 00    	cmp    %edi,0x80d0a0(%ebx)
+  8051ec:	75 19                	jne    805207 <openfile_lookup+0x56>
+	*po = o;
+  8051ee:	8b 45 10             	mov    0x10(%ebp),%eax
+  8051f1:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8051f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051fb:	5b                   	pop    %ebx
+  8051fc:	5e                   	pop    %esi
+  8051fd:	5f                   	pop    %edi
+  8051fe:	5d                   	pop    %ebp
+  8051ff:	c3                   	ret
+		return -E_INVAL;
+  805200:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805205:	eb f1                	jmp    8051f8 <openfile_lookup+0x47>
+  805207:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80520c:	eb ea                	jmp    8051f8 <openfile_lookup+0x47>
+
+0080520e <serve_set_size>:
+{
+  80520e:	55                   	push   %ebp
+  80520f:	89 e5                	mov    %esp,%ebp
+  805211:	53                   	push   %ebx
+  805212:	83 ec 18             	sub    $0x18,%esp
+  805215:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805218:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80521b:	50                   	push   %eax
+  80521c:	ff 33                	push   (%ebx)
+  80521e:	ff 75 08             	push   0x8(%ebp)
+  805221:	e8 8b ff ff ff       	call   8051b1 <openfile_lookup>
+  805226:	83 c4 10             	add    $0x10,%esp
+  805229:	85 c0                	test   %eax,%eax
+  80522b:	78 14                	js     805241 <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  80522d:	83 ec 08             	sub    $0x8,%esp
+  805230:	ff 73 04             	push   0x4(%ebx)
+  805233:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805236:	ff 70 04             	push   0x4(%eax)
+  805239:	e8 5c f5 ff ff       	call   80479a <file_set_size>
+  80523e:	83 c4 10             	add    $0x10,%esp
+}
+  805241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805244:	c9                   	leave
+  805245:	c3                   	ret
+
+00805246 <serve_write_at>:
+{
+  805246:	55                   	push   %ebp
+  805247:	89 e5                	mov    %esp,%ebp
+  805249:	57                   	push   %edi
+  80524a:	56                   	push   %esi
+  80524b:	53                   	push   %ebx
+  80524c:	83 ec 20             	sub    $0x20,%esp
+  80524f:	89 cb                	mov    %ecx,%ebx
+  805251:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+  805254:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  805257:	51                   	push   %ecx
+  805258:	52                   	push   %edx
+  805259:	50                   	push   %eax
+  80525a:	e8 52 ff ff ff       	call   8051b1 <openfile_lookup>
+  80525f:	83 c4 10             	add    $0x10,%esp
+  805262:	85 c0                	test   %eax,%eax
+  805264:	78 17                	js     80527d <serve_write_at+0x37>
+	if ((r = file_write(o->o_file, buf, n, offset < 0 ? o->o_fd->fd_offset : offset)) < 0)
+  805266:	85 f6                	test   %esi,%esi
+  805268:	78 1b                	js     805285 <serve_write_at+0x3f>
+  80526a:	56                   	push   %esi
+  80526b:	ff 75 08             	push   0x8(%ebp)
+  80526e:	53                   	push   %ebx
+  80526f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805272:	ff 70 04             	push   0x4(%eax)
+  805275:	e8 eb f0 ff ff       	call   804365 <file_write>
+  80527a:	83 c4 10             	add    $0x10,%esp
+}
+  80527d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805280:	5b                   	pop    %ebx
+  805281:	5e                   	pop    %esi
+  805282:	5f                   	pop    %edi
+  805283:	5d                   	pop    %ebp
+  805284:	c3                   	ret
+	if ((r = file_write(o->o_file, buf, n, offset < 0 ? o->o_fd->fd_offset : offset)) < 0)
+  805285:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  805288:	8b 47 0c             	mov    0xc(%edi),%eax
+  80528b:	ff 70 04             	push   0x4(%eax)
+  80528e:	ff 75 08             	push   0x8(%ebp)
+  805291:	53                   	push   %ebx
+  805292:	ff 77 04             	push   0x4(%edi)
+  805295:	e8 cb f0 ff ff       	call   804365 <file_write>
+	if (offset < 0)
+  80529a:	f7 d6                	not    %esi
+  80529c:	83 c4 10             	add    $0x10,%esp
+  80529f:	09 c6                	or     %eax,%esi
+  8052a1:	78 da                	js     80527d <serve_write_at+0x37>
+		o->o_fd->fd_offset += r;
+  8052a3:	8b 57 0c             	mov    0xc(%edi),%edx
+  8052a6:	01 42 04             	add    %eax,0x4(%edx)
+  8052a9:	eb d2                	jmp    80527d <serve_write_at+0x37>
+
+008052ab <serve_pwrite>:
+{
+  8052ab:	55                   	push   %ebp
+  8052ac:	89 e5                	mov    %esp,%ebp
+  8052ae:	53                   	push   %ebx
+  8052af:	83 ec 04             	sub    $0x4,%esp
+  8052b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	if (req->req_offset < 0)
+  8052b5:	8b 50 08             	mov    0x8(%eax),%edx
+  8052b8:	85 d2                	test   %edx,%edx
+  8052ba:	78 29                	js     8052e5 <serve_pwrite+0x3a>
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+  8052bc:	8d 48 0c             	lea    0xc(%eax),%ecx
+  8052bf:	8b 18                	mov    (%eax),%ebx
+  8052c1:	83 ec 08             	sub    $0x8,%esp
+  8052c4:	52                   	push   %edx
+			      MIN(sizeof(req->req_buf), req->req_n), req->req_offset);
+  8052c5:	8b 40 04             	mov    0x4(%eax),%eax
+  8052c8:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8052cd:	39 d0                	cmp    %edx,%eax
+  8052cf:	0f 47 c2             	cmova  %edx,%eax
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+  8052d2:	50                   	push   %eax
+  8052d3:	89 da                	mov    %ebx,%edx
+  8052d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8052d8:	e8 69 ff ff ff       	call   805246 <serve_write_at>
+  8052dd:	83 c4 10             	add    $0x10,%esp
+}
+  8052e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8052e3:	c9                   	leave
+  8052e4:	c3                   	ret
+		return -E_INVAL;
+  8052e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8052ea:	eb f4                	jmp    8052e0 <serve_pwrite+0x35>
+
+008052ec <serve_read_at>:
+{
+  8052ec:	55                   	push   %ebp
+  8052ed:	89 e5                	mov    %esp,%ebp
+  8052ef:	57                   	push   %edi
+  8052f0:	56                   	push   %esi
+  8052f1:	53                   	push   %ebx
+  8052f2:	83 ec 2c             	sub    $0x2c,%esp
+  8052f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8052f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8052fb:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	for (done = 0; done < n; done += r) {
+  8052fe:	be 00 00 00 00       	mov    $0x0,%esi
+  805303:	eb 63                	jmp    805368 <serve_read_at+0x7c>
+		file_prefetch(o->o_file, offset < 0 ? o->o_fd->fd_offset : offset + done, chunk);
+  805305:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805308:	83 ec 04             	sub    $0x4,%esp
+  80530b:	53                   	push   %ebx
+  80530c:	8b 50 0c             	mov    0xc(%eax),%edx
+  80530f:	ff 72 04             	push   0x4(%edx)
+  805312:	ff 70 04             	push   0x4(%eax)
+  805315:	e8 ad ef ff ff       	call   8042c7 <file_prefetch>
+		if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+  80531a:	83 c4 0c             	add    $0xc,%esp
+  80531d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805320:	50                   	push   %eax
+  805321:	ff 75 d4             	push   -0x2c(%ebp)
+  805324:	57                   	push   %edi
+  805325:	e8 87 fe ff ff       	call   8051b1 <openfile_lookup>
+  80532a:	83 c4 10             	add    $0x10,%esp
+  80532d:	85 c0                	test   %eax,%eax
+  80532f:	0f 88 c1 00 00 00    	js     8053f6 <serve_read_at+0x10a>
+				   offset < 0 ? o->o_fd->fd_offset : offset + done)) < 0)
+  805335:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		if ((r = file_read(o->o_file, buf + done, chunk,
+  805338:	8b 47 0c             	mov    0xc(%edi),%eax
+  80533b:	ff 70 04             	push   0x4(%eax)
+  80533e:	53                   	push   %ebx
+  80533f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  805342:	01 f0                	add    %esi,%eax
+  805344:	50                   	push   %eax
+  805345:	ff 77 04             	push   0x4(%edi)
+  805348:	e8 36 ee ff ff       	call   804183 <file_read>
+  80534d:	83 c4 10             	add    $0x10,%esp
+  805350:	85 c0                	test   %eax,%eax
+  805352:	0f 88 9e 00 00 00    	js     8053f6 <serve_read_at+0x10a>
+			o->o_fd->fd_offset += r;
+  805358:	8b 57 0c             	mov    0xc(%edi),%edx
+  80535b:	01 42 04             	add    %eax,0x4(%edx)
+		if (r < chunk) {
+  80535e:	39 d8                	cmp    %ebx,%eax
+  805360:	0f 82 8c 00 00 00    	jb     8053f2 <serve_read_at+0x106>
+	for (done = 0; done < n; done += r) {
+  805366:	01 c6                	add    %eax,%esi
+  805368:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80536b:	0f 83 83 00 00 00    	jae    8053f4 <serve_read_at+0x108>
+		chunk = MIN(n - done, BC_MAXIO * BLKSIZE);
+  805371:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  805374:	29 f3                	sub    %esi,%ebx
+  805376:	b8 00 00 02 00       	mov    $0x20000,%eax
+  80537b:	39 c3                	cmp    %eax,%ebx
+  80537d:	0f 47 d8             	cmova  %eax,%ebx
+		if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+  805380:	83 ec 04             	sub    $0x4,%esp
+  805383:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805386:	50                   	push   %eax
+  805387:	ff 75 d4             	push   -0x2c(%ebp)
+  80538a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80538d:	57                   	push   %edi
+  80538e:	e8 1e fe ff ff       	call   8051b1 <openfile_lookup>
+  805393:	83 c4 10             	add    $0x10,%esp
+  805396:	85 c0                	test   %eax,%eax
+  805398:	78 5c                	js     8053f6 <serve_read_at+0x10a>
+		file_prefetch(o->o_file, offset < 0 ? o->o_fd->fd_offset : offset + done, chunk);
+  80539a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80539e:	0f 88 61 ff ff ff    	js     805305 <serve_read_at+0x19>
+  8053a4:	89 f7                	mov    %esi,%edi
+  8053a6:	03 7d 0c             	add    0xc(%ebp),%edi
+  8053a9:	83 ec 04             	sub    $0x4,%esp
+  8053ac:	53                   	push   %ebx
+  8053ad:	57                   	push   %edi
+  8053ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8053b1:	ff 70 04             	push   0x4(%eax)
+  8053b4:	e8 0e ef ff ff       	call   8042c7 <file_prefetch>
+		if ((r = openfile_lookup(envid, fileid, &o)) < 0)
+  8053b9:	83 c4 0c             	add    $0xc,%esp
+  8053bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8053bf:	50                   	push   %eax
+  8053c0:	ff 75 d4             	push   -0x2c(%ebp)
+  8053c3:	ff 75 d0             	push   -0x30(%ebp)
+  8053c6:	e8 e6 fd ff ff       	call   8051b1 <openfile_lookup>
+  8053cb:	83 c4 10             	add    $0x10,%esp
+  8053ce:	85 c0                	test   %eax,%eax
+  8053d0:	78 24                	js     8053f6 <serve_read_at+0x10a>
+		if ((r = file_read(o->o_file, buf + done, chunk,
+  8053d2:	57                   	push   %edi
+  8053d3:	53                   	push   %ebx
+  8053d4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8053d7:	01 f0                	add    %esi,%eax
+  8053d9:	50                   	push   %eax
+  8053da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8053dd:	ff 70 04             	push   0x4(%eax)
+  8053e0:	e8 9e ed ff ff       	call   804183 <file_read>
+  8053e5:	83 c4 10             	add    $0x10,%esp
+  8053e8:	85 c0                	test   %eax,%eax
+  8053ea:	0f 89 6e ff ff ff    	jns    80535e <serve_read_at+0x72>
+  8053f0:	eb 04                	jmp    8053f6 <serve_read_at+0x10a>
+			done += r;
+  8053f2:	01 c6                	add    %eax,%esi
+	return done;
+  8053f4:	89 f0                	mov    %esi,%eax
+}
+  8053f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8053f9:	5b                   	pop    %ebx
+  8053fa:	5e                   	pop    %esi
+  8053fb:	5f                   	pop    %edi
+  8053fc:	5d                   	pop    %ebp
+  8053fd:	c3                   	ret
+
+008053fe <serve_bulk>:
+{
+  8053fe:	55                   	push   %ebp
+  8053ff:	89 e5                	mov    %esp,%ebp
+  805401:	57                   	push   %edi
+  805402:	56                   	push   %esi
+  805403:	53                   	push   %ebx
+  805404:	83 ec 3c             	sub    $0x3c,%esp
+  805407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80540a:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80540d:	8b 55 08             	mov    0x8(%ebp),%edx
+  805410:	8b 45 10             	mov    0x10(%ebp),%eax
+  805413:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	n = MIN(n, FSBULK_MAX);
+  805416:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80541b:	39 c2                	cmp    %eax,%edx
+  80541d:	0f 47 d0             	cmova  %eax,%edx
+	if (va >= UTOP || n > UTOP - va)
+  805420:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  805426:	0f 87 59 01 00 00    	ja     805585 <serve_bulk+0x187>
+  80542c:	89 cf                	mov    %ecx,%edi
+  80542e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  805433:	29 c8                	sub    %ecx,%eax
+  805435:	39 d0                	cmp    %edx,%eax
+  805437:	0f 82 4f 01 00 00    	jb     80558c <serve_bulk+0x18e>
+		if (!(bulk_busy & (1 << slot)))
+  80543d:	a1 a0 c0 84 00       	mov    0x84c0a0,%eax
+  805442:	89 c1                	mov    %eax,%ecx
+  805444:	83 e1 01             	and    $0x1,%ecx
+  805447:	74 2a                	je     805473 <serve_bulk+0x75>
+  805449:	a8 02                	test   $0x2,%al
+  80544b:	74 26                	je     805473 <serve_bulk+0x75>
+  80544d:	a8 04                	test   $0x4,%al
+  80544f:	74 1d                	je     80546e <serve_bulk+0x70>
+  805451:	a8 08                	test   $0x8,%al
+  805453:	74 75                	je     8054ca <serve_bulk+0xcc>
+	assert(slot < NWORKERS);
+  805455:	68 71 b3 80 00       	push   $0x80b371
+  80545a:	68 2b ad 80 00       	push   $0x80ad2b
+  80545f:	68 2a 01 00 00       	push   $0x12a
+  805464:	68 4a b3 80 00       	push   $0x80b34a
+  805469:	e8 aa 12 00 00       	call   806718 <_panic>
+	for (slot = 0; slot < NWORKERS; slot++)
+  80546e:	b9 02 00 00 00       	mov    $0x2,%ecx
+	bulk_busy |= 1 << slot;
+  805473:	bb 01 00 00 00       	mov    $0x1,%ebx
+  805478:	d3 e3                	shl    %cl,%ebx
+  80547a:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  80547d:	09 d8                	or     %ebx,%eax
+  80547f:	a3 a0 c0 84 00       	mov    %eax,0x84c0a0
+	win = (char*) BULKMAP + slot * BULKSLOT;
+  805484:	69 c9 00 10 10 00    	imul   $0x101000,%ecx,%ecx
+  80548a:	8d b1 00 00 48 e0    	lea    -0x1fb80000(%ecx),%esi
+  805490:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	npages = ROUNDUP(PGOFF(va) + n, PGSIZE) / PGSIZE;
+  805493:	89 f9                	mov    %edi,%ecx
+  805495:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80549b:	8d 84 11 ff 0f 00 00 	lea    0xfff(%ecx,%edx,1),%eax
+  8054a2:	c1 e8 0c             	shr    $0xc,%eax
+  8054a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (i = 0; i < npages; i++)
+  8054a8:	80 7d d8 01          	cmpb   $0x1,-0x28(%ebp)
+  8054ac:	19 c0                	sbb    %eax,%eax
+  8054ae:	83 e0 02             	and    $0x2,%eax
+  8054b1:	83 c0 05             	add    $0x5,%eax
+  8054b4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8054b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = sys_page_map(envid, (void*) (ROUNDDOWN(va, PGSIZE) + i * PGSIZE),
+  8054bc:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  8054c2:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8054c5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (i = 0; i < npages; i++)
+  8054c8:	eb 0a                	jmp    8054d4 <serve_bulk+0xd6>
+	for (slot = 0; slot < NWORKERS; slot++)
+  8054ca:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8054cf:	eb a2                	jmp    805473 <serve_bulk+0x75>
+	for (i = 0; i < npages; i++)
+  8054d1:	83 c3 01             	add    $0x1,%ebx
+  8054d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8054d7:	39 c3                	cmp    %eax,%ebx
+  8054d9:	74 36                	je     805511 <serve_bulk+0x113>
+		if ((r = sys_page_map(envid, (void*) (ROUNDDOWN(va, PGSIZE) + i * PGSIZE),
+  8054db:	83 ec 0c             	sub    $0xc,%esp
+  8054de:	ff 75 dc             	push   -0x24(%ebp)
+  8054e1:	56                   	push   %esi
+  8054e2:	6a 00                	push   $0x0
+  8054e4:	89 d8                	mov    %ebx,%eax
+  8054e6:	c1 e0 0c             	shl    $0xc,%eax
+  8054e9:	01 f8                	add    %edi,%eax
+  8054eb:	50                   	push   %eax
+  8054ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8054ef:	e8 6e 1d 00 00       	call   807262 <sys_page_map>
+  8054f4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8054fa:	83 c4 20             	add    $0x20,%esp
+  8054fd:	85 c0                	test   %eax,%eax
+  8054ff:	79 d0                	jns    8054d1 <serve_bulk+0xd3>
+  805501:	89 de                	mov    %ebx,%esi
+  805503:	c1 e6 0c             	shl    $0xc,%esi
+  805506:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  805509:	01 f2                	add    %esi,%edx
+  80550b:	89 d6                	mov    %edx,%esi
+  80550d:	89 c7                	mov    %eax,%edi
+  80550f:	eb 55                	jmp    805566 <serve_bulk+0x168>
+	if (write)
+  805511:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  805514:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  805517:	80 7d d8 00          	cmpb   $0x0,-0x28(%ebp)
+  80551b:	74 1c                	je     805539 <serve_bulk+0x13b>
+		r = serve_write_at(envid, fileid, win + PGOFF(va), n, offset);
+  80551d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  805520:	01 c1                	add    %eax,%ecx
+  805522:	83 ec 08             	sub    $0x8,%esp
+  805525:	ff 75 0c             	push   0xc(%ebp)
+  805528:	52                   	push   %edx
+  805529:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80552c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80552f:	e8 12 fd ff ff       	call   805246 <serve_write_at>
+  805534:	83 c4 10             	add    $0x10,%esp
+  805537:	eb c8                	jmp    805501 <serve_bulk+0x103>
+		r = serve_read_at(envid, fileid, win + PGOFF(va), n, offset);
+  805539:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80553c:	01 c1                	add    %eax,%ecx
+  80553e:	83 ec 08             	sub    $0x8,%esp
+  805541:	ff 75 0c             	push   0xc(%ebp)
+  805544:	52                   	push   %edx
+  805545:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  805548:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80554b:	e8 9c fd ff ff       	call   8052ec <serve_read_at>
+  805550:	83 c4 10             	add    $0x10,%esp
+  805553:	eb ac                	jmp    805501 <serve_bulk+0x103>
+		sys_page_unmap(0, win + i * PGSIZE);
+  805555:	83 ec 08             	sub    $0x8,%esp
+  805558:	56                   	push   %esi
+  805559:	6a 00                	push   $0x0
+  80555b:	e8 4e 1d 00 00       	call   8072ae <sys_page_unmap>
+  805560:	83 eb 01             	sub    $0x1,%ebx
+  805563:	83 c4 10             	add    $0x10,%esp
+	while (i-- > 0)
+  805566:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+  80556c:	85 db                	test   %ebx,%ebx
+  80556e:	75 e5                	jne    805555 <serve_bulk+0x157>
+	bulk_busy &= ~(1 << slot);
+  805570:	89 f8                	mov    %edi,%eax
+  805572:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  805575:	f7 d2                	not    %edx
+  805577:	21 15 a0 c0 84 00    	and    %edx,0x84c0a0
+}
+  80557d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805580:	5b                   	pop    %ebx
+  805581:	5e                   	pop    %esi
+  805582:	5f                   	pop    %edi
+  805583:	5d                   	pop    %ebp
+  805584:	c3                   	ret
+		return -E_INVAL;
+  805585:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80558a:	eb f1                	jmp    80557d <serve_bulk+0x17f>
+  80558c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805591:	eb ea                	jmp    80557d <serve_bulk+0x17f>
+
+00805593 <serve_write>:
+{
+  805593:	55                   	push   %ebp
+  805594:	89 e5                	mov    %esp,%ebp
+  805596:	56                   	push   %esi
+  805597:	53                   	push   %ebx
+  805598:	8b 45 08             	mov    0x8(%ebp),%eax
+  80559b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (req->req_va)
+  80559e:	8b 4a 08             	mov    0x8(%edx),%ecx
+  8055a1:	85 c9                	test   %ecx,%ecx
+  8055a3:	75 29                	jne    8055ce <serve_write+0x3b>
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+  8055a5:	8d 4a 0c             	lea    0xc(%edx),%ecx
+  8055a8:	8b 1a                	mov    (%edx),%ebx
+  8055aa:	83 ec 08             	sub    $0x8,%esp
+  8055ad:	6a ff                	push   $0xffffffff
+			      MIN(sizeof(req->req_buf), req->req_n), -1);
+  8055af:	8b 52 04             	mov    0x4(%edx),%edx
+  8055b2:	be f4 0f 00 00       	mov    $0xff4,%esi
+  8055b7:	39 f2                	cmp    %esi,%edx
+  8055b9:	0f 47 d6             	cmova  %esi,%edx
+	return serve_write_at(envid, req->req_fileid, req->req_buf,
+  8055bc:	52                   	push   %edx
+  8055bd:	89 da                	mov    %ebx,%edx
+  8055bf:	e8 82 fc ff ff       	call   805246 <serve_write_at>
+  8055c4:	83 c4 10             	add    $0x10,%esp
+}
+  8055c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8055ca:	5b                   	pop    %ebx
+  8055cb:	5e                   	pop    %esi
+  8055cc:	5d                   	pop    %ebp
+  8055cd:	c3                   	ret
+		return serve_bulk(envid, req->req_fileid, req->req_va, req->req_n, -1, 1);
+  8055ce:	8b 1a                	mov    (%edx),%ebx
+  8055d0:	83 ec 04             	sub    $0x4,%esp
+  8055d3:	6a 01                	push   $0x1
+  8055d5:	6a ff                	push   $0xffffffff
+  8055d7:	ff 72 04             	push   0x4(%edx)
+  8055da:	89 da                	mov    %ebx,%edx
+  8055dc:	e8 1d fe ff ff       	call   8053fe <serve_bulk>
+  8055e1:	83 c4 10             	add    $0x10,%esp
+  8055e4:	eb e1                	jmp    8055c7 <serve_write+0x34>
+
+008055e6 <serve_read>:
+{
+  8055e6:	55                   	push   %ebp
+  8055e7:	89 e5                	mov    %esp,%ebp
+  8055e9:	56                   	push   %esi
+  8055ea:	53                   	push   %ebx
+  8055eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8055ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	if (req->req_va)
+  8055f1:	8b 51 08             	mov    0x8(%ecx),%edx
+  8055f4:	85 d2                	test   %edx,%edx
+  8055f6:	75 26                	jne    80561e <serve_read+0x38>
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+  8055f8:	8b 19                	mov    (%ecx),%ebx
+  8055fa:	83 ec 08             	sub    $0x8,%esp
+  8055fd:	6a ff                	push   $0xffffffff
+			     MIN(sizeof(ret->ret_buf), req->req_n), -1);
+  8055ff:	8b 51 04             	mov    0x4(%ecx),%edx
+  805602:	be 00 10 00 00       	mov    $0x1000,%esi
+  805607:	39 f2                	cmp    %esi,%edx
+  805609:	0f 47 d6             	cmova  %esi,%edx
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+  80560c:	52                   	push   %edx
+  80560d:	89 da                	mov    %ebx,%edx
+  80560f:	e8 d8 fc ff ff       	call   8052ec <serve_read_at>
+  805614:	83 c4 10             	add    $0x10,%esp
+}
+  805617:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80561a:	5b                   	pop    %ebx
+  80561b:	5e                   	pop    %esi
+  80561c:	5d                   	pop    %ebp
+  80561d:	c3                   	ret
+		return serve_bulk(envid, req->req_fileid, req->req_va, req->req_n, -1, 0);
+  80561e:	8b 19                	mov    (%ecx),%ebx
+  805620:	83 ec 04             	sub    $0x4,%esp
+  805623:	6a 00                	push   $0x0
+  805625:	6a ff                	push   $0xffffffff
+  805627:	ff 71 04             	push   0x4(%ecx)
+  80562a:	89 d1                	mov    %edx,%ecx
+  80562c:	89 da                	mov    %ebx,%edx
+  80562e:	e8 cb fd ff ff       	call   8053fe <serve_bulk>
+  805633:	83 c4 10             	add    $0x10,%esp
+  805636:	eb df                	jmp    805617 <serve_read+0x31>
+
+00805638 <serve_pread>:
+{
+  805638:	55                   	push   %ebp
+  805639:	89 e5                	mov    %esp,%ebp
+  80563b:	53                   	push   %ebx
+  80563c:	83 ec 04             	sub    $0x4,%esp
+  80563f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	if (req->req_offset < 0)
+  805642:	8b 41 08             	mov    0x8(%ecx),%eax
+  805645:	85 c0                	test   %eax,%eax
+  805647:	78 24                	js     80566d <serve_pread+0x35>
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+  805649:	8b 11                	mov    (%ecx),%edx
+  80564b:	83 ec 08             	sub    $0x8,%esp
+  80564e:	50                   	push   %eax
+			     MIN(sizeof(ret->ret_buf), req->req_n), req->req_offset);
+  80564f:	8b 41 04             	mov    0x4(%ecx),%eax
+  805652:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  805657:	39 d8                	cmp    %ebx,%eax
+  805659:	0f 47 c3             	cmova  %ebx,%eax
+	return serve_read_at(envid, req->req_fileid, ret->ret_buf,
+  80565c:	50                   	push   %eax
+  80565d:	8b 45 08             	mov    0x8(%ebp),%eax
+  805660:	e8 87 fc ff ff       	call   8052ec <serve_read_at>
+  805665:	83 c4 10             	add    $0x10,%esp
+}
+  805668:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80566b:	c9                   	leave
+  80566c:	c3                   	ret
+		return -E_INVAL;
+  80566d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805672:	eb f4                	jmp    805668 <serve_pread+0x30>
+
+00805674 <serve_stat>:
+{
+  805674:	55                   	push   %ebp
+  805675:	89 e5                	mov    %esp,%ebp
+  805677:	56                   	push   %esi
+  805678:	53                   	push   %ebx
+  805679:	83 ec 14             	sub    $0x14,%esp
+  80567c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80567f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805682:	50                   	push   %eax
+  805683:	ff 33                	push   (%ebx)
+  805685:	ff 75 08             	push   0x8(%ebp)
+  805688:	e8 24 fb ff ff       	call   8051b1 <openfile_lookup>
+  80568d:	83 c4 10             	add    $0x10,%esp
+  805690:	85 c0                	test   %eax,%eax
+  805692:	78 3c                	js     8056d0 <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  805694:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  805697:	83 ec 08             	sub    $0x8,%esp
+  80569a:	ff 76 04             	push   0x4(%esi)
+  80569d:	53                   	push   %ebx
+  80569e:	e8 34 17 00 00       	call   806dd7 <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  8056a3:	8b 46 04             	mov    0x4(%esi),%eax
+  8056a6:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8056ac:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8056b2:	8b 46 04             	mov    0x4(%esi),%eax
+  8056b5:	83 c4 10             	add    $0x10,%esp
+  8056b8:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  8056bf:	0f 94 c0             	sete   %al
+  8056c2:	0f b6 c0             	movzbl %al,%eax
+  8056c5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8056cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8056d3:	5b                   	pop    %ebx
+  8056d4:	5e                   	pop    %esi
+  8056d5:	5d                   	pop    %ebp
+  8056d6:	c3                   	ret
+
+008056d7 <serve_flush>:
+{
+  8056d7:	55                   	push   %ebp
+  8056d8:	89 e5                	mov    %esp,%ebp
+  8056da:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8056dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8056e0:	50                   	push   %eax
+  8056e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8056e4:	ff 30                	push   (%eax)
+  8056e6:	ff 75 08             	push   0x8(%ebp)
+  8056e9:	e8 c3 fa ff ff       	call   8051b1 <openfile_lookup>
+  8056ee:	83 c4 10             	add    $0x10,%esp
+  8056f1:	85 c0                	test   %eax,%eax
+  8056f3:	78 16                	js     80570b <serve_flush+0x34>
+	file_flush(o->o_file);
+  8056f5:	83 ec 0c             	sub    $0xc,%esp
+  8056f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8056fb:	ff 70 04             	push   0x4(%eax)
+  8056fe:	e8 17 f3 ff ff       	call   804a1a <file_flush>
+	return 0;
+  805703:	83 c4 10             	add    $0x10,%esp
+  805706:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80570b:	c9                   	leave
+  80570c:	c3                   	ret
+
+0080570d <serve_allocate>:
+{
+  80570d:	55                   	push   %ebp
+  80570e:	89 e5                	mov    %esp,%ebp
+  805710:	53                   	push   %ebx
+  805711:	83 ec 18             	sub    $0x18,%esp
+  805714:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805717:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80571a:	50                   	push   %eax
+  80571b:	ff 33                	push   (%ebx)
+  80571d:	ff 75 08             	push   0x8(%ebp)
+  805720:	e8 8c fa ff ff       	call   8051b1 <openfile_lookup>
+  805725:	83 c4 10             	add    $0x10,%esp
+  805728:	85 c0                	test   %eax,%eax
+  80572a:	78 17                	js     805743 <serve_allocate+0x36>
+	return file_allocate(o->o_file, req->req_offset, req->req_len);
+  80572c:	83 ec 04             	sub    $0x4,%esp
+  80572f:	ff 73 08             	push   0x8(%ebx)
+  805732:	ff 73 04             	push   0x4(%ebx)
+  805735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805738:	ff 70 04             	push   0x4(%eax)
+  80573b:	e8 75 ee ff ff       	call   8045b5 <file_allocate>
+  805740:	83 c4 10             	add    $0x10,%esp
+}
+  805743:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805746:	c9                   	leave
+  805747:	c3                   	ret
+
+00805748 <serve_map>:
+{
+  805748:	55                   	push   %ebp
+  805749:	89 e5                	mov    %esp,%ebp
+  80574b:	57                   	push   %edi
+  80574c:	56                   	push   %esi
+  80574d:	53                   	push   %ebx
+  80574e:	83 ec 30             	sub    $0x30,%esp
+  805751:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805754:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805757:	50                   	push   %eax
+  805758:	ff 36                	push   (%esi)
+  80575a:	ff 75 08             	push   0x8(%ebp)
+  80575d:	e8 4f fa ff ff       	call   8051b1 <openfile_lookup>
+  805762:	83 c4 10             	add    $0x10,%esp
+  805765:	85 c0                	test   %eax,%eax
+  805767:	0f 88 14 01 00 00    	js     805881 <serve_map+0x139>
+	f = o->o_file;
+  80576d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805770:	8b 48 04             	mov    0x4(%eax),%ecx
+	if ((o->o_mode & O_ACCMODE) == O_WRONLY || f->f_type == FTYPE_DIR)
+  805773:	8b 40 08             	mov    0x8(%eax),%eax
+  805776:	83 e0 03             	and    $0x3,%eax
+  805779:	83 f8 01             	cmp    $0x1,%eax
+  80577c:	0f 84 e5 00 00 00    	je     805867 <serve_map+0x11f>
+  805782:	83 b9 84 00 00 00 01 	cmpl   $0x1,0x84(%ecx)
+  805789:	0f 84 df 00 00 00    	je     80586e <serve_map+0x126>
+	if (PGOFF(req->req_offset) || PGOFF(req->req_va)
+  80578f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  805792:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  805798:	0f 85 d7 00 00 00    	jne    805875 <serve_map+0x12d>
+  80579e:	8b 46 0c             	mov    0xc(%esi),%eax
+	    || req->req_offset < 0 || req->req_offset >= f->f_size)
+  8057a1:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8057a6:	0f 85 d0 00 00 00    	jne    80587c <serve_map+0x134>
+  8057ac:	85 db                	test   %ebx,%ebx
+  8057ae:	0f 88 c8 00 00 00    	js     80587c <serve_map+0x134>
+  8057b4:	8b 91 80 00 00 00    	mov    0x80(%ecx),%edx
+  8057ba:	39 d3                	cmp    %edx,%ebx
+  8057bc:	0f 8d c7 00 00 00    	jge    805889 <serve_map+0x141>
+	n = MIN(req->req_len, f->f_size - req->req_offset);
+  8057c2:	29 da                	sub    %ebx,%edx
+  8057c4:	8b 5e 08             	mov    0x8(%esi),%ebx
+  8057c7:	39 da                	cmp    %ebx,%edx
+  8057c9:	89 df                	mov    %ebx,%edi
+  8057cb:	0f 46 fa             	cmovbe %edx,%edi
+  8057ce:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+	if (req->req_va >= UTOP || UTOP - req->req_va < ROUNDUP(n, PGSIZE))
+  8057d1:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+  8057d6:	0f 87 b4 00 00 00    	ja     805890 <serve_map+0x148>
+  8057dc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8057e1:	29 c2                	sub    %eax,%edx
+  8057e3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8057e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8057ee:	39 c2                	cmp    %eax,%edx
+  8057f0:	0f 82 a1 00 00 00    	jb     805897 <serve_map+0x14f>
+	if (req->req_prot & PROT_WRITE)
+  8057f6:	8b 46 10             	mov    0x10(%esi),%eax
+  8057f9:	83 e0 02             	and    $0x2,%eax
+	perm = PTE_P|PTE_U;
+  8057fc:	83 f8 01             	cmp    $0x1,%eax
+  8057ff:	19 ff                	sbb    %edi,%edi
+  805801:	81 e7 00 f8 ff ff    	and    $0xfffff800,%edi
+  805807:	81 c7 05 08 00 00    	add    $0x805,%edi
+	for (i = 0; i < n; i += BLKSIZE) {
+  80580d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805812:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  805815:	89 cf                	mov    %ecx,%edi
+  805817:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80581a:	39 c3                	cmp    %eax,%ebx
+  80581c:	73 63                	jae    805881 <serve_map+0x139>
+		if ((r = file_get_block(f, (req->req_offset + i) / BLKSIZE, &blk)) < 0)
+  80581e:	83 ec 04             	sub    $0x4,%esp
+  805821:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  805824:	50                   	push   %eax
+  805825:	89 d8                	mov    %ebx,%eax
+  805827:	03 46 04             	add    0x4(%esi),%eax
+  80582a:	c1 e8 0c             	shr    $0xc,%eax
+  80582d:	50                   	push   %eax
+  80582e:	57                   	push   %edi
+  80582f:	e8 e4 e0 ff ff       	call   803918 <file_get_block>
+  805834:	83 c4 10             	add    $0x10,%esp
+  805837:	85 c0                	test   %eax,%eax
+  805839:	78 46                	js     805881 <serve_map+0x139>
+		(void) *(volatile char*) blk;
+  80583b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80583e:	0f b6 10             	movzbl (%eax),%edx
+		if ((r = sys_page_map(0, blk, envid, (void*) (req->req_va + i), perm)) < 0)
+  805841:	83 ec 0c             	sub    $0xc,%esp
+  805844:	ff 75 d0             	push   -0x30(%ebp)
+  805847:	89 da                	mov    %ebx,%edx
+  805849:	03 56 0c             	add    0xc(%esi),%edx
+  80584c:	52                   	push   %edx
+  80584d:	ff 75 08             	push   0x8(%ebp)
+  805850:	50                   	push   %eax
+  805851:	6a 00                	push   $0x0
+  805853:	e8 0a 1a 00 00       	call   807262 <sys_page_map>
+  805858:	83 c4 20             	add    $0x20,%esp
+  80585b:	85 c0                	test   %eax,%eax
+  80585d:	78 22                	js     805881 <serve_map+0x139>
+	for (i = 0; i < n; i += BLKSIZE) {
+  80585f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  805865:	eb b0                	jmp    805817 <serve_map+0xcf>
+		return -E_INVAL;
+  805867:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80586c:	eb 13                	jmp    805881 <serve_map+0x139>
+  80586e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805873:	eb 0c                	jmp    805881 <serve_map+0x139>
+		return -E_INVAL;
+  805875:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80587a:	eb 05                	jmp    805881 <serve_map+0x139>
+  80587c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  805881:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805884:	5b                   	pop    %ebx
+  805885:	5e                   	pop    %esi
+  805886:	5f                   	pop    %edi
+  805887:	5d                   	pop    %ebp
+  805888:	c3                   	ret
+		return -E_INVAL;
+  805889:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80588e:	eb f1                	jmp    805881 <serve_map+0x139>
+		return -E_INVAL;
+  805890:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805895:	eb ea                	jmp    805881 <serve_map+0x139>
+  805897:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80589c:	eb e3                	jmp    805881 <serve_map+0x139>
+
+0080589e <serve_open>:
+{
+  80589e:	55                   	push   %ebp
+  80589f:	89 e5                	mov    %esp,%ebp
+  8058a1:	53                   	push   %ebx
+  8058a2:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  8058a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  8058ab:	68 00 04 00 00       	push   $0x400
+  8058b0:	53                   	push   %ebx
+  8058b1:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8058b7:	50                   	push   %eax
+  8058b8:	e8 a0 16 00 00       	call   806f5d <memmove>
+	path[MAXPATHLEN-1] = 0;
+  8058bd:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_alloc(&o)) < 0) {
+  8058c1:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  8058c7:	89 04 24             	mov    %eax,(%esp)
+  8058ca:	e8 49 f8 ff ff       	call   805118 <openfile_alloc>
+  8058cf:	83 c4 10             	add    $0x10,%esp
+  8058d2:	85 c0                	test   %eax,%eax
+  8058d4:	0f 88 aa 00 00 00    	js     805984 <serve_open+0xe6>
+	if (req->req_omode & O_CREAT) {
+  8058da:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  8058e1:	74 2b                	je     80590e <serve_open+0x70>
+		if ((r = file_create(path, &f)) < 0) {
+  8058e3:	83 ec 08             	sub    $0x8,%esp
+  8058e6:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8058ec:	50                   	push   %eax
+  8058ed:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8058f3:	50                   	push   %eax
+  8058f4:	e8 63 e5 ff ff       	call   803e5c <file_create>
+  8058f9:	83 c4 10             	add    $0x10,%esp
+  8058fc:	85 c0                	test   %eax,%eax
+  8058fe:	79 2b                	jns    80592b <serve_open+0x8d>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  805900:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  805907:	75 7b                	jne    805984 <serve_open+0xe6>
+  805909:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  80590c:	75 76                	jne    805984 <serve_open+0xe6>
+		if ((r = file_open(path, &f)) < 0) {
+  80590e:	83 ec 08             	sub    $0x8,%esp
+  805911:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  805917:	50                   	push   %eax
+  805918:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80591e:	50                   	push   %eax
+  80591f:	e8 45 e8 ff ff       	call   804169 <file_open>
+  805924:	83 c4 10             	add    $0x10,%esp
+  805927:	85 c0                	test   %eax,%eax
+  805929:	78 59                	js     805984 <serve_open+0xe6>
+	if (req->req_omode & O_TRUNC) {
+  80592b:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  805932:	75 55                	jne    805989 <serve_open+0xeb>
+	o->o_file = f;
+  805934:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  80593a:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  805940:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  805943:	8b 50 0c             	mov    0xc(%eax),%edx
+  805946:	8b 08                	mov    (%eax),%ecx
+  805948:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  80594b:	8b 48 0c             	mov    0xc(%eax),%ecx
+  80594e:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  805954:	83 e2 03             	and    $0x3,%edx
+  805957:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  80595a:	8b 50 0c             	mov    0xc(%eax),%edx
+  80595d:	8b 0d a4 10 81 00    	mov    0x8110a4,%ecx
+  805963:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  805965:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  80596b:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  80596e:	8b 50 0c             	mov    0xc(%eax),%edx
+  805971:	8b 45 10             	mov    0x10(%ebp),%eax
+  805974:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  805976:	8b 45 14             	mov    0x14(%ebp),%eax
+  805979:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  80597f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805984:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805987:	c9                   	leave
+  805988:	c3                   	ret
+		if ((r = file_set_size(f, 0)) < 0) {
+  805989:	83 ec 08             	sub    $0x8,%esp
+  80598c:	6a 00                	push   $0x0
+  80598e:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  805994:	e8 01 ee ff ff       	call   80479a <file_set_size>
+  805999:	83 c4 10             	add    $0x10,%esp
+  80599c:	85 c0                	test   %eax,%eax
+  80599e:	79 94                	jns    805934 <serve_open+0x96>
+  8059a0:	eb e2                	jmp    805984 <serve_open+0xe6>
+
+008059a2 <serve_worker>:
+{
+  8059a2:	55                   	push   %ebp
+  8059a3:	89 e5                	mov    %esp,%ebp
+  8059a5:	57                   	push   %edi
+  8059a6:	56                   	push   %esi
+  8059a7:	53                   	push   %ebx
+  8059a8:	83 ec 38             	sub    $0x38,%esp
+  8059ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mutex_lock(&workers_mu);
+  8059ae:	68 a8 c0 84 00       	push   $0x84c0a8
+  8059b3:	e8 e8 40 00 00       	call   809aa0 <mutex_lock>
+  8059b8:	83 c4 10             	add    $0x10,%esp
+  8059bb:	eb 14                	jmp    8059d1 <serve_worker+0x2f>
+			cond_wait(&w->w_cond, &workers_mu);
+  8059bd:	83 ec 08             	sub    $0x8,%esp
+  8059c0:	68 a8 c0 84 00       	push   $0x84c0a8
+  8059c5:	8d 47 14             	lea    0x14(%edi),%eax
+  8059c8:	50                   	push   %eax
+  8059c9:	e8 d2 41 00 00       	call   809ba0 <cond_wait>
+  8059ce:	83 c4 10             	add    $0x10,%esp
+		while (!w->w_busy)
+  8059d1:	80 3f 00             	cmpb   $0x0,(%edi)
+  8059d4:	74 e7                	je     8059bd <serve_worker+0x1b>
+		mutex_unlock(&workers_mu);
+  8059d6:	83 ec 0c             	sub    $0xc,%esp
+  8059d9:	68 a8 c0 84 00       	push   $0x84c0a8
+  8059de:	e8 2a 41 00 00       	call   809b0d <mutex_unlock>
+		serve_request(w->w_req, w->w_whom, w->w_ipc, w->w_perm);
+  8059e3:	8b 47 10             	mov    0x10(%edi),%eax
+  8059e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8059e9:	8b 47 08             	mov    0x8(%edi),%eax
+  8059ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8059ef:	8b 5f 04             	mov    0x4(%edi),%ebx
+  8059f2:	8b 47 0c             	mov    0xc(%edi),%eax
+  8059f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	tag = req >> FSAIO_TAGSHIFT;
+  8059f8:	89 de                	mov    %ebx,%esi
+  8059fa:	c1 ee 10             	shr    $0x10,%esi
+	req &= (1 << FSAIO_TAGSHIFT) - 1;
+  8059fd:	0f b7 c3             	movzwl %bx,%eax
+  805a00:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	pg = NULL;
+  805a03:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	mutex_lock(&fs_mu);
+  805a0a:	c7 04 24 3c c4 84 00 	movl   $0x84c43c,(%esp)
+  805a11:	e8 8a 40 00 00       	call   809aa0 <mutex_lock>
+	if (tag && (req == FSREQ_OPEN || req == FSREQ_LOAD)) {
+  805a16:	83 c4 10             	add    $0x10,%esp
+  805a19:	85 f6                	test   %esi,%esi
+  805a1b:	0f 84 a7 00 00 00    	je     805ac8 <serve_worker+0x126>
+  805a21:	89 d8                	mov    %ebx,%eax
+  805a23:	25 f7 ff 00 00       	and    $0xfff7,%eax
+  805a28:	83 f8 01             	cmp    $0x1,%eax
+  805a2b:	0f 85 9d 00 00 00    	jne    805ace <serve_worker+0x12c>
+		r = -E_INVAL;
+  805a31:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+	if ((ac = aioclient_lookup(envid)) == NULL)
+  805a36:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  805a39:	e8 b7 f1 ff ff       	call   804bf5 <aioclient_lookup>
+  805a3e:	85 c0                	test   %eax,%eax
+  805a40:	74 41                	je     805a83 <serve_worker+0xe1>
+	return (struct FsaioCq*) (AIOCQVA + (ac - aioclients) * PGSIZE);
+  805a42:	2d a0 be 84 00       	sub    $0x84bea0,%eax
+  805a47:	c1 e0 09             	shl    $0x9,%eax
+  805a4a:	8d 90 00 00 40 d0    	lea    -0x2fc00000(%eax),%edx
+	cq->cq[cq->cq_tail % FSAIO_NCQE].cqe_tag = tag;
+  805a50:	8b 4a 04             	mov    0x4(%edx),%ecx
+  805a53:	0f b6 c9             	movzbl %cl,%ecx
+		aio_complete(whom, tag - 1, r);
+  805a56:	83 ee 01             	sub    $0x1,%esi
+  805a59:	89 74 ca 08          	mov    %esi,0x8(%edx,%ecx,8)
+	cq->cq[cq->cq_tail % FSAIO_NCQE].cqe_res = r;
+  805a5d:	8b 4a 04             	mov    0x4(%edx),%ecx
+  805a60:	0f b6 c9             	movzbl %cl,%ecx
+  805a63:	89 5c ca 0c          	mov    %ebx,0xc(%edx,%ecx,8)
+	cq->cq_tail++;
+  805a67:	8b 4a 04             	mov    0x4(%edx),%ecx
+  805a6a:	83 c1 01             	add    $0x1,%ecx
+  805a6d:	89 4a 04             	mov    %ecx,0x4(%edx)
+	sys_futex_wake(&cq->cq_tail, PTHREAD_MAX);
+  805a70:	83 ec 08             	sub    $0x8,%esp
+  805a73:	6a 20                	push   $0x20
+  805a75:	2d fc ff bf 2f       	sub    $0x2fbffffc,%eax
+  805a7a:	50                   	push   %eax
+  805a7b:	e8 d9 1a 00 00       	call   807559 <sys_futex_wake>
+  805a80:	83 c4 10             	add    $0x10,%esp
+	wb_kick();
+  805a83:	e8 9e 02 00 00       	call   805d26 <wb_kick>
+	mutex_unlock(&fs_mu);
+  805a88:	83 ec 0c             	sub    $0xc,%esp
+  805a8b:	68 3c c4 84 00       	push   $0x84c43c
+  805a90:	e8 78 40 00 00       	call   809b0d <mutex_unlock>
+  805a95:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, ipc);
+  805a98:	83 ec 08             	sub    $0x8,%esp
+  805a9b:	ff 75 d0             	push   -0x30(%ebp)
+  805a9e:	6a 00                	push   $0x0
+  805aa0:	e8 09 18 00 00       	call   8072ae <sys_page_unmap>
+		mutex_lock(&workers_mu);
+  805aa5:	c7 04 24 a8 c0 84 00 	movl   $0x84c0a8,(%esp)
+  805aac:	e8 ef 3f 00 00       	call   809aa0 <mutex_lock>
+		w->w_busy = 0;
+  805ab1:	c6 07 00             	movb   $0x0,(%edi)
+		cond_signal(&workers_idle);
+  805ab4:	c7 04 24 a4 c0 84 00 	movl   $0x84c0a4,(%esp)
+  805abb:	e8 f8 40 00 00       	call   809bb8 <cond_signal>
+		while (!w->w_busy)
+  805ac0:	83 c4 10             	add    $0x10,%esp
+  805ac3:	e9 09 ff ff ff       	jmp    8059d1 <serve_worker+0x2f>
+	} else if (req == FSREQ_OPEN) {
+  805ac8:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+  805acc:	74 28                	je     805af6 <serve_worker+0x154>
+	} else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
+  805ace:	f7 c3 f0 ff 00 00    	test   $0xfff0,%ebx
+  805ad4:	75 4b                	jne    805b21 <serve_worker+0x17f>
+  805ad6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  805ad9:	8b 04 85 40 d0 80 00 	mov    0x80d040(,%eax,4),%eax
+  805ae0:	85 c0                	test   %eax,%eax
+  805ae2:	74 3d                	je     805b21 <serve_worker+0x17f>
+		r = handlers[req](whom, ipc);
+  805ae4:	83 ec 08             	sub    $0x8,%esp
+  805ae7:	ff 75 d0             	push   -0x30(%ebp)
+  805aea:	ff 75 cc             	push   -0x34(%ebp)
+  805aed:	ff d0                	call   *%eax
+  805aef:	89 c3                	mov    %eax,%ebx
+  805af1:	83 c4 10             	add    $0x10,%esp
+  805af4:	eb 46                	jmp    805b3c <serve_worker+0x19a>
+		r = serve_open(whom, (struct Fsreq_open*)ipc, &pg, &perm);
+  805af6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  805af9:	50                   	push   %eax
+  805afa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805afd:	50                   	push   %eax
+  805afe:	ff 75 d0             	push   -0x30(%ebp)
+  805b01:	ff 75 cc             	push   -0x34(%ebp)
+  805b04:	e8 95 fd ff ff       	call   80589e <serve_open>
+  805b09:	89 c3                	mov    %eax,%ebx
+	wb_kick();
+  805b0b:	e8 16 02 00 00       	call   805d26 <wb_kick>
+	mutex_unlock(&fs_mu);
+  805b10:	c7 04 24 3c c4 84 00 	movl   $0x84c43c,(%esp)
+  805b17:	e8 f1 3f 00 00       	call   809b0d <mutex_unlock>
+  805b1c:	83 c4 10             	add    $0x10,%esp
+  805b1f:	eb 4a                	jmp    805b6b <serve_worker+0x1c9>
+		cprintf("Invalid request code %d from %08x\n", req, whom);
+  805b21:	83 ec 04             	sub    $0x4,%esp
+  805b24:	ff 75 cc             	push   -0x34(%ebp)
+  805b27:	ff 75 d4             	push   -0x2c(%ebp)
+  805b2a:	68 bc b3 80 00       	push   $0x80b3bc
+  805b2f:	e8 bf 0c 00 00       	call   8067f3 <cprintf>
+  805b34:	83 c4 10             	add    $0x10,%esp
+		r = -E_INVAL;
+  805b37:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+	if (tag)
+  805b3c:	85 f6                	test   %esi,%esi
+  805b3e:	0f 85 f2 fe ff ff    	jne    805a36 <serve_worker+0x94>
+	wb_kick();
+  805b44:	e8 dd 01 00 00       	call   805d26 <wb_kick>
+	mutex_unlock(&fs_mu);
+  805b49:	83 ec 0c             	sub    $0xc,%esp
+  805b4c:	68 3c c4 84 00       	push   $0x84c43c
+  805b51:	e8 b7 3f 00 00       	call   809b0d <mutex_unlock>
+	if (!tag && req != FSREQ_LOAD) {
+  805b56:	83 c4 10             	add    $0x10,%esp
+  805b59:	85 f6                	test   %esi,%esi
+  805b5b:	0f 85 37 ff ff ff    	jne    805a98 <serve_worker+0xf6>
+  805b61:	83 7d d4 09          	cmpl   $0x9,-0x2c(%ebp)
+  805b65:	0f 84 2d ff ff ff    	je     805a98 <serve_worker+0xf6>
+		ipc_send(whom, r, pg, perm);
+  805b6b:	ff 75 e0             	push   -0x20(%ebp)
+  805b6e:	ff 75 e4             	push   -0x1c(%ebp)
+  805b71:	53                   	push   %ebx
+  805b72:	ff 75 cc             	push   -0x34(%ebp)
+  805b75:	e8 97 1c 00 00       	call   807811 <ipc_send>
+  805b7a:	83 c4 10             	add    $0x10,%esp
+  805b7d:	e9 16 ff ff ff       	jmp    805a98 <serve_worker+0xf6>
+
+00805b82 <serve>:
+{
+  805b82:	55                   	push   %ebp
+  805b83:	89 e5                	mov    %esp,%ebp
+  805b85:	57                   	push   %edi
+  805b86:	56                   	push   %esi
+  805b87:	53                   	push   %ebx
+  805b88:	83 ec 1c             	sub    $0x1c,%esp
+	for (i = 0; i < NWORKERS; i++) {
+  805b8b:	be c0 c0 84 00       	mov    $0x84c0c0,%esi
+{
+  805b90:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pthread_create(&t, serve_worker, &workers[i])) < 0)
+  805b95:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+		workers[i].w_ipc = fsreq - i;
+  805b98:	89 d8                	mov    %ebx,%eax
+  805b9a:	03 05 80 d0 80 00    	add    0x80d080,%eax
+  805ba0:	89 46 10             	mov    %eax,0x10(%esi)
+		if ((r = pthread_create(&t, serve_worker, &workers[i])) < 0)
+  805ba3:	83 ec 04             	sub    $0x4,%esp
+  805ba6:	56                   	push   %esi
+  805ba7:	68 a2 59 80 00       	push   $0x8059a2
+  805bac:	57                   	push   %edi
+  805bad:	e8 44 41 00 00       	call   809cf6 <pthread_create>
+  805bb2:	83 c6 18             	add    $0x18,%esi
+  805bb5:	83 c4 10             	add    $0x10,%esp
+  805bb8:	85 c0                	test   %eax,%eax
+  805bba:	78 20                	js     805bdc <serve+0x5a>
+	for (i = 0; i < NWORKERS; i++) {
+  805bbc:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  805bc2:	81 fb 00 c0 ff ff    	cmp    $0xffffc000,%ebx
+  805bc8:	75 ce                	jne    805b98 <serve+0x16>
+	mutex_lock(&workers_mu);
+  805bca:	83 ec 0c             	sub    $0xc,%esp
+  805bcd:	68 a8 c0 84 00       	push   $0x84c0a8
+  805bd2:	e8 c9 3e 00 00       	call   809aa0 <mutex_lock>
+  805bd7:	83 c4 10             	add    $0x10,%esp
+  805bda:	eb 7b                	jmp    805c57 <serve+0xd5>
+			panic("serve: pthread_create: %e", r);
+  805bdc:	50                   	push   %eax
+  805bdd:	68 81 b3 80 00       	push   $0x80b381
+  805be2:	68 0e 03 00 00       	push   $0x30e
+  805be7:	68 4a b3 80 00       	push   $0x80b34a
+  805bec:	e8 27 0b 00 00       	call   806718 <_panic>
+			cprintf("Invalid request from %08x: no argument page\n",
+  805bf1:	83 ec 08             	sub    $0x8,%esp
+  805bf4:	ff 73 08             	push   0x8(%ebx)
+  805bf7:	68 e0 b3 80 00       	push   $0x80b3e0
+  805bfc:	e8 f2 0b 00 00       	call   8067f3 <cprintf>
+			continue; // just leave it hanging...
+  805c01:	83 c4 10             	add    $0x10,%esp
+  805c04:	eb 51                	jmp    805c57 <serve+0xd5>
+		mutex_unlock(&workers_mu);
+  805c06:	83 ec 0c             	sub    $0xc,%esp
+  805c09:	68 a8 c0 84 00       	push   $0x84c0a8
+  805c0e:	e8 fa 3e 00 00       	call   809b0d <mutex_unlock>
+		w->w_perm = 0;
+  805c13:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		w->w_req = ipc_recv((int32_t *) &w->w_whom, w->w_ipc, &w->w_perm);
+  805c1a:	83 c4 0c             	add    $0xc,%esp
+  805c1d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  805c20:	50                   	push   %eax
+  805c21:	ff 73 10             	push   0x10(%ebx)
+  805c24:	8d 43 08             	lea    0x8(%ebx),%eax
+  805c27:	50                   	push   %eax
+  805c28:	e8 ee 1a 00 00       	call   80771b <ipc_recv>
+  805c2d:	89 43 04             	mov    %eax,0x4(%ebx)
+		mutex_lock(&workers_mu);
+  805c30:	c7 04 24 a8 c0 84 00 	movl   $0x84c0a8,(%esp)
+  805c37:	e8 64 3e 00 00       	call   809aa0 <mutex_lock>
+		if (!(w->w_perm & PTE_P)) {
+  805c3c:	83 c4 10             	add    $0x10,%esp
+  805c3f:	f6 43 0c 01          	testb  $0x1,0xc(%ebx)
+  805c43:	74 ac                	je     805bf1 <serve+0x6f>
+		w->w_busy = 1;
+  805c45:	c6 03 01             	movb   $0x1,(%ebx)
+		cond_signal(&w->w_cond);
+  805c48:	83 ec 0c             	sub    $0xc,%esp
+  805c4b:	83 c3 14             	add    $0x14,%ebx
+  805c4e:	53                   	push   %ebx
+  805c4f:	e8 64 3f 00 00       	call   809bb8 <cond_signal>
+  805c54:	83 c4 10             	add    $0x10,%esp
+		for (w = workers; w < workers + NWORKERS && w->w_busy; w++)
+  805c57:	bb c0 c0 84 00       	mov    $0x84c0c0,%ebx
+  805c5c:	80 3b 00             	cmpb   $0x0,(%ebx)
+  805c5f:	74 a5                	je     805c06 <serve+0x84>
+  805c61:	83 c3 18             	add    $0x18,%ebx
+  805c64:	81 fb 20 c1 84 00    	cmp    $0x84c120,%ebx
+  805c6a:	75 f0                	jne    805c5c <serve+0xda>
+			cond_wait(&workers_idle, &workers_mu);
+  805c6c:	83 ec 08             	sub    $0x8,%esp
+  805c6f:	68 a8 c0 84 00       	push   $0x84c0a8
+  805c74:	68 a4 c0 84 00       	push   $0x84c0a4
+  805c79:	e8 22 3f 00 00       	call   809ba0 <cond_wait>
+			continue;
+  805c7e:	83 c4 10             	add    $0x10,%esp
+  805c81:	eb d4                	jmp    805c57 <serve+0xd5>
+
+00805c83 <umain>:
+{
+  805c83:	55                   	push   %ebp
+  805c84:	89 e5                	mov    %esp,%ebp
+  805c86:	83 ec 14             	sub    $0x14,%esp
+	binaryname = "fs";
+  805c89:	c7 05 a0 10 81 00 9b 	movl   $0x80b39b,0x8110a0
+  805c90:	b3 80 00 
+	cprintf("FS is running\n");
+  805c93:	68 9e b3 80 00       	push   $0x80b39e
+  805c98:	e8 56 0b 00 00       	call   8067f3 <cprintf>
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  805c9d:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  805ca2:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  805ca7:	66 ef                	out    %ax,(%dx)
+	cprintf("FS can do I/O\n");
+  805ca9:	c7 04 24 ad b3 80 00 	movl   $0x80b3ad,(%esp)
+  805cb0:	e8 3e 0b 00 00       	call   8067f3 <cprintf>
+	serve_init();
+  805cb5:	e8 37 f4 ff ff       	call   8050f1 <serve_init>
+	fs_init();
+  805cba:	e8 e1 d8 ff ff       	call   8035a0 <fs_init>
+	fs_test();
+  805cbf:	e8 b7 00 00 00       	call   805d7b <fs_test>
+	wb_init();
+  805cc4:	e8 81 00 00 00       	call   805d4a <wb_init>
+	serve();
+  805cc9:	e8 b4 fe ff ff       	call   805b82 <serve>
+
+00805cce <wb_main>:
+
+static struct cond wb_cond;
+
+static void*
+wb_main(void *arg)
+{
+  805cce:	55                   	push   %ebp
+  805ccf:	89 e5                	mov    %esp,%ebp
+  805cd1:	83 ec 14             	sub    $0x14,%esp
+	uint32_t n;
+
+	mutex_lock(&fs_mu);
+  805cd4:	68 3c c4 84 00       	push   $0x84c43c
+  805cd9:	e8 c2 3d 00 00       	call   809aa0 <mutex_lock>
+  805cde:	83 c4 10             	add    $0x10,%esp
+  805ce1:	eb 0d                	jmp    805cf0 <wb_main+0x22>
+	while (1) {
+		cond_timedwait(&wb_cond, &fs_mu, WB_INTERVAL);
+		if (fs_ndirty_blocks() > WB_HIWAT)
+			n = fs_writeback(0);
+  805ce3:	83 ec 0c             	sub    $0xc,%esp
+  805ce6:	6a 00                	push   $0x0
+  805ce8:	e8 3a ed ff ff       	call   804a27 <fs_writeback>
+  805ced:	83 c4 10             	add    $0x10,%esp
+		cond_timedwait(&wb_cond, &fs_mu, WB_INTERVAL);
+  805cf0:	83 ec 04             	sub    $0x4,%esp
+  805cf3:	68 e8 03 00 00       	push   $0x3e8
+  805cf8:	68 3c c4 84 00       	push   $0x84c43c
+  805cfd:	68 20 c1 84 00       	push   $0x84c120
+  805d02:	e8 3c 3e 00 00       	call   809b43 <cond_timedwait>
+		if (fs_ndirty_blocks() > WB_HIWAT)
+  805d07:	e8 5d ed ff ff       	call   804a69 <fs_ndirty_blocks>
+  805d0c:	83 c4 10             	add    $0x10,%esp
+  805d0f:	83 f8 40             	cmp    $0x40,%eax
+  805d12:	77 cf                	ja     805ce3 <wb_main+0x15>
+		else
+			n = fs_writeback(WB_AGE);
+  805d14:	83 ec 0c             	sub    $0xc,%esp
+  805d17:	68 b8 0b 00 00       	push   $0xbb8
+  805d1c:	e8 06 ed ff ff       	call   804a27 <fs_writeback>
+  805d21:	83 c4 10             	add    $0x10,%esp
+  805d24:	eb ca                	jmp    805cf0 <wb_main+0x22>
+
+00805d26 <wb_kick>:
+
+// Wake the daemon early if too many blocks are dirty.
+// Call with fs_mu held.
+void
+wb_kick(void)
+{
+  805d26:	55                   	push   %ebp
+  805d27:	89 e5                	mov    %esp,%ebp
+  805d29:	83 ec 08             	sub    $0x8,%esp
+	if (fs_ndirty_blocks() > WB_HIWAT)
+  805d2c:	e8 38 ed ff ff       	call   804a69 <fs_ndirty_blocks>
+  805d31:	83 f8 40             	cmp    $0x40,%eax
+  805d34:	77 02                	ja     805d38 <wb_kick+0x12>
+		cond_signal(&wb_cond);
+}
+  805d36:	c9                   	leave
+  805d37:	c3                   	ret
+		cond_signal(&wb_cond);
+  805d38:	83 ec 0c             	sub    $0xc,%esp
+  805d3b:	68 20 c1 84 00       	push   $0x84c120
+  805d40:	e8 73 3e 00 00       	call   809bb8 <cond_signal>
+  805d45:	83 c4 10             	add    $0x10,%esp
+}
+  805d48:	eb ec                	jmp    805d36 <wb_kick+0x10>
+
+00805d4a <wb_init>:
+
+void
+wb_init(void)
+{
+  805d4a:	55                   	push   %ebp
+  805d4b:	89 e5                	mov    %esp,%ebp
+  805d4d:	83 ec 1c             	sub    $0x1c,%esp
+	pthread_t t;
+	int r;
+
+	if ((r = pthread_create(&t, wb_main, 0)) < 0)
+  805d50:	6a 00                	push   $0x0
+  805d52:	68 ce 5c 80 00       	push   $0x805cce
+  805d57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805d5a:	50                   	push   %eax
+  805d5b:	e8 96 3f 00 00       	call   809cf6 <pthread_create>
+  805d60:	83 c4 10             	add    $0x10,%esp
+  805d63:	85 c0                	test   %eax,%eax
+  805d65:	78 02                	js     805d69 <wb_init+0x1f>
+		panic("wb_init: pthread_create: %e", r);
+}
+  805d67:	c9                   	leave
+  805d68:	c3                   	ret
+		panic("wb_init: pthread_create: %e", r);
+  805d69:	50                   	push   %eax
+  805d6a:	68 0d b4 80 00       	push   $0x80b40d
+  805d6f:	6a 33                	push   $0x33
+  805d71:	68 29 b4 80 00       	push   $0x80b429
+  805d76:	e8 9d 09 00 00       	call   806718 <_panic>
+
+00805d7b <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  805d7b:	55                   	push   %ebp
+  805d7c:	89 e5                	mov    %esp,%ebp
+  805d7e:	57                   	push   %edi
+  805d7f:	56                   	push   %esi
+  805d80:	53                   	push   %ebx
+  805d81:	83 ec 60             	sub    $0x60,%esp
+	uint32_t *bits;
+	uint32_t bno, n, evictions;
+	struct BcStat st;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  805d84:	6a 07                	push   $0x7
+  805d86:	68 00 10 00 00       	push   $0x1000
+  805d8b:	6a 00                	push   $0x0
+  805d8d:	e8 83 14 00 00       	call   807215 <sys_page_alloc>
+  805d92:	83 c4 10             	add    $0x10,%esp
+  805d95:	85 c0                	test   %eax,%eax
+  805d97:	0f 88 f0 04 00 00    	js     80628d <fs_test+0x512>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  805d9d:	83 ec 04             	sub    $0x4,%esp
+  805da0:	68 00 10 00 00       	push   $0x1000
+  805da5:	ff 35 e0 c3 84 00    	push   0x84c3e0
+  805dab:	68 00 10 00 00       	push   $0x1000
+  805db0:	e8 a8 11 00 00       	call   806f5d <memmove>
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  805db5:	e8 d0 d4 ff ff       	call   80328a <alloc_block>
+  805dba:	89 c1                	mov    %eax,%ecx
+  805dbc:	83 c4 10             	add    $0x10,%esp
+  805dbf:	85 c0                	test   %eax,%eax
+  805dc1:	0f 88 d8 04 00 00    	js     80629f <fs_test+0x524>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  805dc7:	8d 50 1f             	lea    0x1f(%eax),%edx
+  805dca:	0f 49 d0             	cmovns %eax,%edx
+  805dcd:	c1 fa 05             	sar    $0x5,%edx
+  805dd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  805dd5:	d3 e0                	shl    %cl,%eax
+  805dd7:	89 c1                	mov    %eax,%ecx
+  805dd9:	23 0c 95 00 10 00 00 	and    0x1000(,%edx,4),%ecx
+  805de0:	0f 84 cb 04 00 00    	je     8062b1 <fs_test+0x536>
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  805de6:	8b 0d e0 c3 84 00    	mov    0x84c3e0,%ecx
+  805dec:	23 04 91             	and    (%ecx,%edx,4),%eax
+  805def:	0f 85 d2 04 00 00    	jne    8062c7 <fs_test+0x54c>
+	cprintf("alloc_block is good\n");
+  805df5:	83 ec 0c             	sub    $0xc,%esp
+  805df8:	68 80 b4 80 00       	push   $0x80b480
+  805dfd:	e8 f1 09 00 00       	call   8067f3 <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  805e02:	83 c4 08             	add    $0x8,%esp
+  805e05:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805e08:	50                   	push   %eax
+  805e09:	68 95 b4 80 00       	push   $0x80b495
+  805e0e:	e8 56 e3 ff ff       	call   804169 <file_open>
+  805e13:	83 c4 10             	add    $0x10,%esp
+  805e16:	85 c0                	test   %eax,%eax
+  805e18:	0f 88 bf 04 00 00    	js     8062dd <fs_test+0x562>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  805e1e:	0f 84 d4 04 00 00    	je     8062f8 <fs_test+0x57d>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  805e24:	83 ec 08             	sub    $0x8,%esp
+  805e27:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805e2a:	50                   	push   %eax
+  805e2b:	68 b9 b4 80 00       	push   $0x80b4b9
+  805e30:	e8 34 e3 ff ff       	call   804169 <file_open>
+  805e35:	83 c4 10             	add    $0x10,%esp
+  805e38:	85 c0                	test   %eax,%eax
+  805e3a:	0f 88 cc 04 00 00    	js     80630c <fs_test+0x591>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  805e40:	83 ec 0c             	sub    $0xc,%esp
+  805e43:	68 d9 b4 80 00       	push   $0x80b4d9
+  805e48:	e8 a6 09 00 00       	call   8067f3 <cprintf>
+
+	// newmotd is small enough to be inline until asked for a block
+	assert(f->f_flags & FFLAG_INLINE);
+  805e4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805e50:	83 c4 10             	add    $0x10,%esp
+  805e53:	f6 80 c0 00 00 00 01 	testb  $0x1,0xc0(%eax)
+  805e5a:	0f 84 be 04 00 00    	je     80631e <fs_test+0x5a3>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  805e60:	83 ec 04             	sub    $0x4,%esp
+  805e63:	8d 55 e0             	lea    -0x20(%ebp),%edx
+  805e66:	52                   	push   %edx
+  805e67:	6a 00                	push   $0x0
+  805e69:	50                   	push   %eax
+  805e6a:	e8 a9 da ff ff       	call   803918 <file_get_block>
+  805e6f:	83 c4 10             	add    $0x10,%esp
+  805e72:	85 c0                	test   %eax,%eax
+  805e74:	0f 88 ba 04 00 00    	js     806334 <fs_test+0x5b9>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  805e7a:	83 ec 08             	sub    $0x8,%esp
+  805e7d:	68 5c b7 80 00       	push   $0x80b75c
+  805e82:	ff 75 e0             	push   -0x20(%ebp)
+  805e85:	e8 fe 0f 00 00       	call   806e88 <strcmp>
+  805e8a:	83 c4 10             	add    $0x10,%esp
+  805e8d:	85 c0                	test   %eax,%eax
+  805e8f:	0f 85 b1 04 00 00    	jne    806346 <fs_test+0x5cb>
+		panic("file_get_block returned wrong data");
+	assert(!(f->f_flags & FFLAG_INLINE) && f->f_direct[0] != 0);
+  805e95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805e98:	f6 80 c0 00 00 00 01 	testb  $0x1,0xc0(%eax)
+  805e9f:	0f 85 b5 04 00 00    	jne    80635a <fs_test+0x5df>
+  805ea5:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  805eac:	0f 84 a8 04 00 00    	je     80635a <fs_test+0x5df>
+	cprintf("file_get_block is good\n");
+  805eb2:	83 ec 0c             	sub    $0xc,%esp
+  805eb5:	68 19 b5 80 00       	push   $0x80b519
+  805eba:	e8 34 09 00 00       	call   8067f3 <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  805ebf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805ec2:	0f b6 10             	movzbl (%eax),%edx
+  805ec5:	88 10                	mov    %dl,(%eax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  805ec7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805eca:	c1 e8 0c             	shr    $0xc,%eax
+  805ecd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805ed4:	83 c4 10             	add    $0x10,%esp
+  805ed7:	a8 40                	test   $0x40,%al
+  805ed9:	0f 84 91 04 00 00    	je     806370 <fs_test+0x5f5>
+	file_flush(f);
+  805edf:	83 ec 0c             	sub    $0xc,%esp
+  805ee2:	ff 75 e4             	push   -0x1c(%ebp)
+  805ee5:	e8 30 eb ff ff       	call   804a1a <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  805eea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805eed:	c1 e8 0c             	shr    $0xc,%eax
+  805ef0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805ef7:	83 c4 10             	add    $0x10,%esp
+  805efa:	a8 40                	test   $0x40,%al
+  805efc:	0f 85 84 04 00 00    	jne    806386 <fs_test+0x60b>
+	cprintf("file_flush is good\n");
+  805f02:	83 ec 0c             	sub    $0xc,%esp
+  805f05:	68 4d b5 80 00       	push   $0x80b54d
+  805f0a:	e8 e4 08 00 00       	call   8067f3 <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  805f0f:	83 c4 08             	add    $0x8,%esp
+  805f12:	6a 00                	push   $0x0
+  805f14:	ff 75 e4             	push   -0x1c(%ebp)
+  805f17:	e8 7e e8 ff ff       	call   80479a <file_set_size>
+  805f1c:	83 c4 10             	add    $0x10,%esp
+  805f1f:	85 c0                	test   %eax,%eax
+  805f21:	0f 88 75 04 00 00    	js     80639c <fs_test+0x621>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0 && (f->f_flags & FFLAG_INLINE));
+  805f27:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805f2a:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  805f31:	0f 85 77 04 00 00    	jne    8063ae <fs_test+0x633>
+  805f37:	f6 80 c0 00 00 00 01 	testb  $0x1,0xc0(%eax)
+  805f3e:	0f 84 6a 04 00 00    	je     8063ae <fs_test+0x633>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  805f44:	c1 e8 0c             	shr    $0xc,%eax
+  805f47:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805f4e:	a8 40                	test   $0x40,%al
+  805f50:	0f 85 6e 04 00 00    	jne    8063c4 <fs_test+0x649>
+	cprintf("file_truncate is good\n");
+  805f56:	83 ec 0c             	sub    $0xc,%esp
+  805f59:	68 8d b5 80 00       	push   $0x80b58d
+  805f5e:	e8 90 08 00 00       	call   8067f3 <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  805f63:	c7 04 24 5c b7 80 00 	movl   $0x80b75c,(%esp)
+  805f6a:	e8 2d 0e 00 00       	call   806d9c <strlen>
+  805f6f:	83 c4 08             	add    $0x8,%esp
+  805f72:	50                   	push   %eax
+  805f73:	ff 75 e4             	push   -0x1c(%ebp)
+  805f76:	e8 1f e8 ff ff       	call   80479a <file_set_size>
+  805f7b:	83 c4 10             	add    $0x10,%esp
+  805f7e:	85 c0                	test   %eax,%eax
+  805f80:	0f 88 54 04 00 00    	js     8063da <fs_test+0x65f>
+		panic("file_set_size 2: %e", r);
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  805f86:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805f89:	89 c2                	mov    %eax,%edx
+  805f8b:	c1 ea 0c             	shr    $0xc,%edx
+  805f8e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  805f95:	f6 c2 40             	test   $0x40,%dl
+  805f98:	0f 85 4e 04 00 00    	jne    8063ec <fs_test+0x671>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  805f9e:	83 ec 04             	sub    $0x4,%esp
+  805fa1:	8d 55 e0             	lea    -0x20(%ebp),%edx
+  805fa4:	52                   	push   %edx
+  805fa5:	6a 00                	push   $0x0
+  805fa7:	50                   	push   %eax
+  805fa8:	e8 6b d9 ff ff       	call   803918 <file_get_block>
+  805fad:	83 c4 10             	add    $0x10,%esp
+  805fb0:	85 c0                	test   %eax,%eax
+  805fb2:	0f 88 4a 04 00 00    	js     806402 <fs_test+0x687>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  805fb8:	83 ec 08             	sub    $0x8,%esp
+  805fbb:	68 5c b7 80 00       	push   $0x80b75c
+  805fc0:	ff 75 e0             	push   -0x20(%ebp)
+  805fc3:	e8 0f 0e 00 00       	call   806dd7 <strcpy>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  805fc8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805fcb:	c1 e8 0c             	shr    $0xc,%eax
+  805fce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805fd5:	83 c4 10             	add    $0x10,%esp
+  805fd8:	a8 40                	test   $0x40,%al
+  805fda:	0f 84 34 04 00 00    	je     806414 <fs_test+0x699>
+	file_flush(f);
+  805fe0:	83 ec 0c             	sub    $0xc,%esp
+  805fe3:	ff 75 e4             	push   -0x1c(%ebp)
+  805fe6:	e8 2f ea ff ff       	call   804a1a <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  805feb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805fee:	c1 e8 0c             	shr    $0xc,%eax
+  805ff1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805ff8:	83 c4 10             	add    $0x10,%esp
+  805ffb:	a8 40                	test   $0x40,%al
+  805ffd:	0f 85 27 04 00 00    	jne    80642a <fs_test+0x6af>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  806003:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  806006:	c1 e8 0c             	shr    $0xc,%eax
+  806009:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  806010:	a8 40                	test   $0x40,%al
+  806012:	0f 85 28 04 00 00    	jne    806440 <fs_test+0x6c5>
+	cprintf("file rewrite is good\n");
+  806018:	83 ec 0c             	sub    $0xc,%esp
+  80601b:	68 cd b5 80 00       	push   $0x80b5cd
+  806020:	e8 ce 07 00 00       	call   8067f3 <cprintf>
+
+	// Reach a block under the double-indirect block, then drop it
+	if ((r = file_set_size(f, (NDIRECT + 2 * NINDIRECT + 1) * BLKSIZE)) < 0)
+  806025:	83 c4 08             	add    $0x8,%esp
+  806028:	68 00 b0 80 00       	push   $0x80b000
+  80602d:	ff 75 e4             	push   -0x1c(%ebp)
+  806030:	e8 65 e7 ff ff       	call   80479a <file_set_size>
+  806035:	83 c4 10             	add    $0x10,%esp
+  806038:	85 c0                	test   %eax,%eax
+  80603a:	0f 88 16 04 00 00    	js     806456 <fs_test+0x6db>
+		panic("file_set_size 3: %e", r);
+	if ((r = file_get_block(f, NDIRECT + 2 * NINDIRECT, &blk)) < 0)
+  806040:	83 ec 04             	sub    $0x4,%esp
+  806043:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  806046:	50                   	push   %eax
+  806047:	68 0a 08 00 00       	push   $0x80a
+  80604c:	ff 75 e4             	push   -0x1c(%ebp)
+  80604f:	e8 c4 d8 ff ff       	call   803918 <file_get_block>
+  806054:	83 c4 10             	add    $0x10,%esp
+  806057:	85 c0                	test   %eax,%eax
+  806059:	0f 88 09 04 00 00    	js     806468 <fs_test+0x6ed>
+		panic("file_get_block 3: %e", r);
+	strcpy(blk, msg);
+  80605f:	83 ec 08             	sub    $0x8,%esp
+  806062:	68 5c b7 80 00       	push   $0x80b75c
+  806067:	ff 75 e0             	push   -0x20(%ebp)
+  80606a:	e8 68 0d 00 00       	call   806dd7 <strcpy>
+	assert(f->f_indirect == 0 && f->f_dindirect != 0);
+  80606f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  806072:	83 c4 10             	add    $0x10,%esp
+  806075:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+  80607c:	0f 85 f8 03 00 00    	jne    80647a <fs_test+0x6ff>
+  806082:	83 b8 b4 00 00 00 00 	cmpl   $0x0,0xb4(%eax)
+  806089:	0f 84 eb 03 00 00    	je     80647a <fs_test+0x6ff>
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  80608f:	83 ec 0c             	sub    $0xc,%esp
+  806092:	68 5c b7 80 00       	push   $0x80b75c
+  806097:	e8 00 0d 00 00       	call   806d9c <strlen>
+  80609c:	83 c4 08             	add    $0x8,%esp
+  80609f:	50                   	push   %eax
+  8060a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8060a3:	e8 f2 e6 ff ff       	call   80479a <file_set_size>
+  8060a8:	83 c4 10             	add    $0x10,%esp
+  8060ab:	85 c0                	test   %eax,%eax
+  8060ad:	0f 88 dd 03 00 00    	js     806490 <fs_test+0x715>
+		panic("file_set_size 4: %e", r);
+	assert(f->f_indirect == 0 && f->f_dindirect == 0);
+  8060b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8060b6:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+  8060bd:	0f 85 df 03 00 00    	jne    8064a2 <fs_test+0x727>
+  8060c3:	8b 98 b4 00 00 00    	mov    0xb4(%eax),%ebx
+  8060c9:	85 db                	test   %ebx,%ebx
+  8060cb:	0f 85 d1 03 00 00    	jne    8064a2 <fs_test+0x727>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  8060d1:	83 ec 04             	sub    $0x4,%esp
+  8060d4:	8d 55 e0             	lea    -0x20(%ebp),%edx
+  8060d7:	52                   	push   %edx
+  8060d8:	6a 00                	push   $0x0
+  8060da:	50                   	push   %eax
+  8060db:	e8 38 d8 ff ff       	call   803918 <file_get_block>
+  8060e0:	83 c4 10             	add    $0x10,%esp
+  8060e3:	85 c0                	test   %eax,%eax
+  8060e5:	0f 88 cd 03 00 00    	js     8064b8 <fs_test+0x73d>
+		panic("file_get_block 4: %e", r);
+	assert(strcmp(blk, msg) == 0);
+  8060eb:	83 ec 08             	sub    $0x8,%esp
+  8060ee:	68 5c b7 80 00       	push   $0x80b75c
+  8060f3:	ff 75 e0             	push   -0x20(%ebp)
+  8060f6:	e8 8d 0d 00 00       	call   806e88 <strcmp>
+  8060fb:	83 c4 10             	add    $0x10,%esp
+  8060fe:	85 c0                	test   %eax,%eax
+  806100:	0f 85 c4 03 00 00    	jne    8064ca <fs_test+0x74f>
+	cprintf("file double indirect is good\n");
+  806106:	83 ec 0c             	sub    $0xc,%esp
+  806109:	68 4b b6 80 00       	push   $0x80b64b
+  80610e:	e8 e0 06 00 00       	call   8067f3 <cprintf>
+
+	// Removing a file frees its data and indirect blocks at once
+	if ((r = file_create("/rmtest", &f)) < 0)
+  806113:	83 c4 08             	add    $0x8,%esp
+  806116:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  806119:	50                   	push   %eax
+  80611a:	68 69 b6 80 00       	push   $0x80b669
+  80611f:	e8 38 dd ff ff       	call   803e5c <file_create>
+  806124:	83 c4 10             	add    $0x10,%esp
+  806127:	85 c0                	test   %eax,%eax
+  806129:	0f 88 b1 03 00 00    	js     8064e0 <fs_test+0x765>
+		panic("file_create /rmtest: %e", r);
+	if ((r = file_set_size(f, (NDIRECT + 2) * BLKSIZE)) < 0)
+  80612f:	83 ec 08             	sub    $0x8,%esp
+  806132:	68 00 c0 00 00       	push   $0xc000
+  806137:	ff 75 e4             	push   -0x1c(%ebp)
+  80613a:	e8 5b e6 ff ff       	call   80479a <file_set_size>
+  80613f:	83 c4 10             	add    $0x10,%esp
+  806142:	85 c0                	test   %eax,%eax
+  806144:	0f 88 a8 03 00 00    	js     8064f2 <fs_test+0x777>
+		panic("file_set_size 5: %e", r);
+	for (n = 0; n < NDIRECT + 2; n++)
+		if ((r = file_get_block(f, n, &blk)) < 0)
+  80614a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80614d:	83 ec 04             	sub    $0x4,%esp
+  806150:	56                   	push   %esi
+  806151:	53                   	push   %ebx
+  806152:	ff 75 e4             	push   -0x1c(%ebp)
+  806155:	e8 be d7 ff ff       	call   803918 <file_get_block>
+  80615a:	83 c4 10             	add    $0x10,%esp
+  80615d:	85 c0                	test   %eax,%eax
+  80615f:	0f 88 9f 03 00 00    	js     806504 <fs_test+0x789>
+			panic("file_get_block 5: %e", r);
+		else
+			strcpy(blk, msg);
+  806165:	83 ec 08             	sub    $0x8,%esp
+  806168:	68 5c b7 80 00       	push   $0x80b75c
+  80616d:	ff 75 e0             	push   -0x20(%ebp)
+  806170:	e8 62 0c 00 00       	call   806dd7 <strcpy>
+	for (n = 0; n < NDIRECT + 2; n++)
+  806175:	83 c3 01             	add    $0x1,%ebx
+  806178:	83 c4 10             	add    $0x10,%esp
+  80617b:	83 fb 0c             	cmp    $0xc,%ebx
+  80617e:	75 cd                	jne    80614d <fs_test+0x3d2>
+	file_flush(f);
+  806180:	83 ec 0c             	sub    $0xc,%esp
+  806183:	ff 75 e4             	push   -0x1c(%ebp)
+  806186:	e8 8f e8 ff ff       	call   804a1a <file_flush>
+	bno = f->f_indirect;
+  80618b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80618e:	8b 98 b0 00 00 00    	mov    0xb0(%eax),%ebx
+	assert(bno != 0 && !block_is_free(bno) && !block_is_free(f->f_direct[0]));
+  806194:	83 c4 10             	add    $0x10,%esp
+  806197:	85 db                	test   %ebx,%ebx
+  806199:	0f 84 77 03 00 00    	je     806516 <fs_test+0x79b>
+  80619f:	83 ec 0c             	sub    $0xc,%esp
+  8061a2:	53                   	push   %ebx
+  8061a3:	e8 53 cf ff ff       	call   8030fb <block_is_free>
+  8061a8:	83 c4 10             	add    $0x10,%esp
+  8061ab:	84 c0                	test   %al,%al
+  8061ad:	0f 85 63 03 00 00    	jne    806516 <fs_test+0x79b>
+  8061b3:	83 ec 0c             	sub    $0xc,%esp
+  8061b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8061b9:	ff b0 88 00 00 00    	push   0x88(%eax)
+  8061bf:	e8 37 cf ff ff       	call   8030fb <block_is_free>
+  8061c4:	83 c4 10             	add    $0x10,%esp
+  8061c7:	84 c0                	test   %al,%al
+  8061c9:	0f 85 47 03 00 00    	jne    806516 <fs_test+0x79b>
+	n = f->f_direct[0];
+  8061cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8061d2:	8b b0 88 00 00 00    	mov    0x88(%eax),%esi
+	if ((r = file_remove("/rmtest")) < 0)
+  8061d8:	83 ec 0c             	sub    $0xc,%esp
+  8061db:	68 69 b6 80 00       	push   $0x80b669
+  8061e0:	e8 6a e6 ff ff       	call   80484f <file_remove>
+  8061e5:	83 c4 10             	add    $0x10,%esp
+  8061e8:	85 c0                	test   %eax,%eax
+  8061ea:	0f 88 3c 03 00 00    	js     80652c <fs_test+0x7b1>
+		panic("file_remove: %e", r);
+	assert(block_is_free(bno) && block_is_free(n));
+  8061f0:	83 ec 0c             	sub    $0xc,%esp
+  8061f3:	53                   	push   %ebx
+  8061f4:	e8 02 cf ff ff       	call   8030fb <block_is_free>
+  8061f9:	83 c4 10             	add    $0x10,%esp
+  8061fc:	84 c0                	test   %al,%al
+  8061fe:	0f 84 3a 03 00 00    	je     80653e <fs_test+0x7c3>
+  806204:	83 ec 0c             	sub    $0xc,%esp
+  806207:	56                   	push   %esi
+  806208:	e8 ee ce ff ff       	call   8030fb <block_is_free>
+  80620d:	83 c4 10             	add    $0x10,%esp
+  806210:	84 c0                	test   %al,%al
+  806212:	0f 84 26 03 00 00    	je     80653e <fs_test+0x7c3>
+	assert(!(uvpt[PGNUM(bitmap)] & PTE_D));
+  806218:	a1 e0 c3 84 00       	mov    0x84c3e0,%eax
+  80621d:	c1 e8 0c             	shr    $0xc,%eax
+  806220:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  806227:	83 e6 40             	and    $0x40,%esi
+  80622a:	0f 85 24 03 00 00    	jne    806554 <fs_test+0x7d9>
+	if ((r = file_open("/rmtest", &f)) != -E_NOT_FOUND)
+  806230:	83 ec 08             	sub    $0x8,%esp
+  806233:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  806236:	50                   	push   %eax
+  806237:	68 69 b6 80 00       	push   $0x80b669
+  80623c:	e8 28 df ff ff       	call   804169 <file_open>
+  806241:	83 c4 10             	add    $0x10,%esp
+  806244:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  806247:	0f 85 1d 03 00 00    	jne    80656a <fs_test+0x7ef>
+		panic("file_open /rmtest after remove: %e", r);
+	cprintf("file_remove is good\n");
+  80624d:	83 ec 0c             	sub    $0xc,%esp
+  806250:	68 c2 b6 80 00       	push   $0x80b6c2
+  806255:	e8 99 05 00 00       	call   8067f3 <cprintf>
+
+	// Touch more in-use blocks than a minimal cache can hold
+	if ((r = bc_set_budget(BC_MINBLOCKS)) < 0)
+  80625a:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+  806261:	e8 21 be ff ff       	call   802087 <bc_set_budget>
+  806266:	83 c4 10             	add    $0x10,%esp
+  806269:	85 c0                	test   %eax,%eax
+  80626b:	0f 88 0b 03 00 00    	js     80657c <fs_test+0x801>
+		panic("bc_set_budget: %e", r);
+	bc_get_stat(&st);
+  806271:	83 ec 0c             	sub    $0xc,%esp
+  806274:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  806277:	50                   	push   %eax
+  806278:	e8 91 b9 ff ff       	call   801c0e <bc_get_stat>
+	evictions = st.bs_evictions;
+  80627d:	8b 7d b0             	mov    -0x50(%ebp),%edi
+	for (bno = 2, n = 0; bno < super->s_nblocks; bno++)
+  806280:	83 c4 10             	add    $0x10,%esp
+  806283:	bb 02 00 00 00       	mov    $0x2,%ebx
+  806288:	e9 04 03 00 00       	jmp    806591 <fs_test+0x816>
+		panic("sys_page_alloc: %e", r);
+  80628d:	50                   	push   %eax
+  80628e:	68 38 b4 80 00       	push   $0x80b438
+  806293:	6a 14                	push   $0x14
+  806295:	68 4b b4 80 00       	push   $0x80b44b
+  80629a:	e8 79 04 00 00       	call   806718 <_panic>
+		panic("alloc_block: %e", r);
+  80629f:	50                   	push   %eax
+  8062a0:	68 55 b4 80 00       	push   $0x80b455
+  8062a5:	6a 19                	push   $0x19
+  8062a7:	68 4b b4 80 00       	push   $0x80b44b
+  8062ac:	e8 67 04 00 00       	call   806718 <_panic>
+	assert(bits[r/32] & (1 << (r%32)));
+  8062b1:	68 65 b4 80 00       	push   $0x80b465
+  8062b6:	68 2b ad 80 00       	push   $0x80ad2b
+  8062bb:	6a 1b                	push   $0x1b
+  8062bd:	68 4b b4 80 00       	push   $0x80b44b
+  8062c2:	e8 51 04 00 00       	call   806718 <_panic>
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  8062c7:	68 1c b7 80 00       	push   $0x80b71c
+  8062cc:	68 2b ad 80 00       	push   $0x80ad2b
+  8062d1:	6a 1d                	push   $0x1d
+  8062d3:	68 4b b4 80 00       	push   $0x80b44b
+  8062d8:	e8 3b 04 00 00       	call   806718 <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8062dd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8062e0:	0f 84 3e fb ff ff    	je     805e24 <fs_test+0xa9>
+		panic("file_open /not-found: %e", r);
+  8062e6:	50                   	push   %eax
+  8062e7:	68 a0 b4 80 00       	push   $0x80b4a0
+  8062ec:	6a 21                	push   $0x21
+  8062ee:	68 4b b4 80 00       	push   $0x80b44b
+  8062f3:	e8 20 04 00 00       	call   806718 <_panic>
+		panic("file_open /not-found succeeded!");
+  8062f8:	83 ec 04             	sub    $0x4,%esp
+  8062fb:	68 3c b7 80 00       	push   $0x80b73c
+  806300:	6a 23                	push   $0x23
+  806302:	68 4b b4 80 00       	push   $0x80b44b
+  806307:	e8 0c 04 00 00       	call   806718 <_panic>
+		panic("file_open /newmotd: %e", r);
+  80630c:	50                   	push   %eax
+  80630d:	68 c2 b4 80 00       	push   $0x80b4c2
+  806312:	6a 25                	push   $0x25
+  806314:	68 4b b4 80 00       	push   $0x80b44b
+  806319:	e8 fa 03 00 00       	call   806718 <_panic>
+	assert(f->f_flags & FFLAG_INLINE);
+  80631e:	68 ec b4 80 00       	push   $0x80b4ec
+  806323:	68 2b ad 80 00       	push   $0x80ad2b
+  806328:	6a 29                	push   $0x29
+  80632a:	68 4b b4 80 00       	push   $0x80b44b
+  80632f:	e8 e4 03 00 00       	call   806718 <_panic>
+		panic("file_get_block: %e", r);
+  806334:	50                   	push   %eax
+  806335:	68 06 b5 80 00       	push   $0x80b506
+  80633a:	6a 2b                	push   $0x2b
+  80633c:	68 4b b4 80 00       	push   $0x80b44b
+  806341:	e8 d2 03 00 00       	call   806718 <_panic>
+		panic("file_get_block returned wrong data");
+  806346:	83 ec 04             	sub    $0x4,%esp
+  806349:	68 84 b7 80 00       	push   $0x80b784
+  80634e:	6a 2d                	push   $0x2d
+  806350:	68 4b b4 80 00       	push   $0x80b44b
+  806355:	e8 be 03 00 00       	call   806718 <_panic>
+	assert(!(f->f_flags & FFLAG_INLINE) && f->f_direct[0] != 0);
+  80635a:	68 a8 b7 80 00       	push   $0x80b7a8
+  80635f:	68 2b ad 80 00       	push   $0x80ad2b
+  806364:	6a 2e                	push   $0x2e
+  806366:	68 4b b4 80 00       	push   $0x80b44b
+  80636b:	e8 a8 03 00 00       	call   806718 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  806370:	68 32 b5 80 00       	push   $0x80b532
+  806375:	68 2b ad 80 00       	push   $0x80ad2b
+  80637a:	6a 32                	push   $0x32
+  80637c:	68 4b b4 80 00       	push   $0x80b44b
+  806381:	e8 92 03 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  806386:	68 31 b5 80 00       	push   $0x80b531
+  80638b:	68 2b ad 80 00       	push   $0x80ad2b
+  806390:	6a 34                	push   $0x34
+  806392:	68 4b b4 80 00       	push   $0x80b44b
+  806397:	e8 7c 03 00 00       	call   806718 <_panic>
+		panic("file_set_size: %e", r);
+  80639c:	50                   	push   %eax
+  80639d:	68 61 b5 80 00       	push   $0x80b561
+  8063a2:	6a 38                	push   $0x38
+  8063a4:	68 4b b4 80 00       	push   $0x80b44b
+  8063a9:	e8 6a 03 00 00       	call   806718 <_panic>
+	assert(f->f_direct[0] == 0 && (f->f_flags & FFLAG_INLINE));
+  8063ae:	68 dc b7 80 00       	push   $0x80b7dc
+  8063b3:	68 2b ad 80 00       	push   $0x80ad2b
+  8063b8:	6a 39                	push   $0x39
+  8063ba:	68 4b b4 80 00       	push   $0x80b44b
+  8063bf:	e8 54 03 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8063c4:	68 73 b5 80 00       	push   $0x80b573
+  8063c9:	68 2b ad 80 00       	push   $0x80ad2b
+  8063ce:	6a 3a                	push   $0x3a
+  8063d0:	68 4b b4 80 00       	push   $0x80b44b
+  8063d5:	e8 3e 03 00 00       	call   806718 <_panic>
+		panic("file_set_size 2: %e", r);
+  8063da:	50                   	push   %eax
+  8063db:	68 a4 b5 80 00       	push   $0x80b5a4
+  8063e0:	6a 3e                	push   $0x3e
+  8063e2:	68 4b b4 80 00       	push   $0x80b44b
+  8063e7:	e8 2c 03 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8063ec:	68 73 b5 80 00       	push   $0x80b573
+  8063f1:	68 2b ad 80 00       	push   $0x80ad2b
+  8063f6:	6a 3f                	push   $0x3f
+  8063f8:	68 4b b4 80 00       	push   $0x80b44b
+  8063fd:	e8 16 03 00 00       	call   806718 <_panic>
+		panic("file_get_block 2: %e", r);
+  806402:	50                   	push   %eax
+  806403:	68 b8 b5 80 00       	push   $0x80b5b8
+  806408:	6a 41                	push   $0x41
+  80640a:	68 4b b4 80 00       	push   $0x80b44b
+  80640f:	e8 04 03 00 00       	call   806718 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  806414:	68 32 b5 80 00       	push   $0x80b532
+  806419:	68 2b ad 80 00       	push   $0x80ad2b
+  80641e:	6a 43                	push   $0x43
+  806420:	68 4b b4 80 00       	push   $0x80b44b
+  806425:	e8 ee 02 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80642a:	68 31 b5 80 00       	push   $0x80b531
+  80642f:	68 2b ad 80 00       	push   $0x80ad2b
+  806434:	6a 45                	push   $0x45
+  806436:	68 4b b4 80 00       	push   $0x80b44b
+  80643b:	e8 d8 02 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  806440:	68 73 b5 80 00       	push   $0x80b573
+  806445:	68 2b ad 80 00       	push   $0x80ad2b
+  80644a:	6a 46                	push   $0x46
+  80644c:	68 4b b4 80 00       	push   $0x80b44b
+  806451:	e8 c2 02 00 00       	call   806718 <_panic>
+		panic("file_set_size 3: %e", r);
+  806456:	50                   	push   %eax
+  806457:	68 e3 b5 80 00       	push   $0x80b5e3
+  80645c:	6a 4b                	push   $0x4b
+  80645e:	68 4b b4 80 00       	push   $0x80b44b
+  806463:	e8 b0 02 00 00       	call   806718 <_panic>
+		panic("file_get_block 3: %e", r);
+  806468:	50                   	push   %eax
+  806469:	68 f7 b5 80 00       	push   $0x80b5f7
+  80646e:	6a 4d                	push   $0x4d
+  806470:	68 4b b4 80 00       	push   $0x80b44b
+  806475:	e8 9e 02 00 00       	call   806718 <_panic>
+	assert(f->f_indirect == 0 && f->f_dindirect != 0);
+  80647a:	68 10 b8 80 00       	push   $0x80b810
+  80647f:	68 2b ad 80 00       	push   $0x80ad2b
+  806484:	6a 4f                	push   $0x4f
+  806486:	68 4b b4 80 00       	push   $0x80b44b
+  80648b:	e8 88 02 00 00       	call   806718 <_panic>
+		panic("file_set_size 4: %e", r);
+  806490:	50                   	push   %eax
+  806491:	68 0c b6 80 00       	push   $0x80b60c
+  806496:	6a 51                	push   $0x51
+  806498:	68 4b b4 80 00       	push   $0x80b44b
+  80649d:	e8 76 02 00 00       	call   806718 <_panic>
+	assert(f->f_indirect == 0 && f->f_dindirect == 0);
+  8064a2:	68 3c b8 80 00       	push   $0x80b83c
+  8064a7:	68 2b ad 80 00       	push   $0x80ad2b
+  8064ac:	6a 52                	push   $0x52
+  8064ae:	68 4b b4 80 00       	push   $0x80b44b
+  8064b3:	e8 60 02 00 00       	call   806718 <_panic>
+		panic("file_get_block 4: %e", r);
+  8064b8:	50                   	push   %eax
+  8064b9:	68 20 b6 80 00       	push   $0x80b620
+  8064be:	6a 54                	push   $0x54
+  8064c0:	68 4b b4 80 00       	push   $0x80b44b
+  8064c5:	e8 4e 02 00 00       	call   806718 <_panic>
+	assert(strcmp(blk, msg) == 0);
+  8064ca:	68 35 b6 80 00       	push   $0x80b635
+  8064cf:	68 2b ad 80 00       	push   $0x80ad2b
+  8064d4:	6a 55                	push   $0x55
+  8064d6:	68 4b b4 80 00       	push   $0x80b44b
+  8064db:	e8 38 02 00 00       	call   806718 <_panic>
+		panic("file_create /rmtest: %e", r);
+  8064e0:	50                   	push   %eax
+  8064e1:	68 71 b6 80 00       	push   $0x80b671
+  8064e6:	6a 5a                	push   $0x5a
+  8064e8:	68 4b b4 80 00       	push   $0x80b44b
+  8064ed:	e8 26 02 00 00       	call   806718 <_panic>
+		panic("file_set_size 5: %e", r);
+  8064f2:	50                   	push   %eax
+  8064f3:	68 89 b6 80 00       	push   $0x80b689
+  8064f8:	6a 5c                	push   $0x5c
+  8064fa:	68 4b b4 80 00       	push   $0x80b44b
+  8064ff:	e8 14 02 00 00       	call   806718 <_panic>
+			panic("file_get_block 5: %e", r);
+  806504:	50                   	push   %eax
+  806505:	68 9d b6 80 00       	push   $0x80b69d
+  80650a:	6a 5f                	push   $0x5f
+  80650c:	68 4b b4 80 00       	push   $0x80b44b
+  806511:	e8 02 02 00 00       	call   806718 <_panic>
+	assert(bno != 0 && !block_is_free(bno) && !block_is_free(f->f_direct[0]));
+  806516:	68 68 b8 80 00       	push   $0x80b868
+  80651b:	68 2b ad 80 00       	push   $0x80ad2b
+  806520:	6a 64                	push   $0x64
+  806522:	68 4b b4 80 00       	push   $0x80b44b
+  806527:	e8 ec 01 00 00       	call   806718 <_panic>
+		panic("file_remove: %e", r);
+  80652c:	50                   	push   %eax
+  80652d:	68 b2 b6 80 00       	push   $0x80b6b2
+  806532:	6a 67                	push   $0x67
+  806534:	68 4b b4 80 00       	push   $0x80b44b
+  806539:	e8 da 01 00 00       	call   806718 <_panic>
+	assert(block_is_free(bno) && block_is_free(n));
+  80653e:	68 ac b8 80 00       	push   $0x80b8ac
+  806543:	68 2b ad 80 00       	push   $0x80ad2b
+  806548:	6a 68                	push   $0x68
+  80654a:	68 4b b4 80 00       	push   $0x80b44b
+  80654f:	e8 c4 01 00 00       	call   806718 <_panic>
+	assert(!(uvpt[PGNUM(bitmap)] & PTE_D));
+  806554:	68 d4 b8 80 00       	push   $0x80b8d4
+  806559:	68 2b ad 80 00       	push   $0x80ad2b
+  80655e:	6a 69                	push   $0x69
+  806560:	68 4b b4 80 00       	push   $0x80b44b
+  806565:	e8 ae 01 00 00       	call   806718 <_panic>
+		panic("file_open /rmtest after remove: %e", r);
+  80656a:	50                   	push   %eax
+  80656b:	68 f4 b8 80 00       	push   $0x80b8f4
+  806570:	6a 6b                	push   $0x6b
+  806572:	68 4b b4 80 00       	push   $0x80b44b
+  806577:	e8 9c 01 00 00       	call   806718 <_panic>
+		panic("bc_set_budget: %e", r);
+  80657c:	50                   	push   %eax
+  80657d:	68 d7 b6 80 00       	push   $0x80b6d7
+  806582:	6a 70                	push   $0x70
+  806584:	68 4b b4 80 00       	push   $0x80b44b
+  806589:	e8 8a 01 00 00       	call   806718 <_panic>
+	for (bno = 2, n = 0; bno < super->s_nblocks; bno++)
+  80658e:	83 c3 01             	add    $0x1,%ebx
+  806591:	a1 e4 c3 84 00       	mov    0x84c3e4,%eax
+  806596:	3b 58 04             	cmp    0x4(%eax),%ebx
+  806599:	73 24                	jae    8065bf <fs_test+0x844>
+		if (!block_is_free(bno)) {
+  80659b:	83 ec 0c             	sub    $0xc,%esp
+  80659e:	53                   	push   %ebx
+  80659f:	e8 57 cb ff ff       	call   8030fb <block_is_free>
+  8065a4:	83 c4 10             	add    $0x10,%esp
+  8065a7:	84 c0                	test   %al,%al
+  8065a9:	75 e3                	jne    80658e <fs_test+0x813>
+			(void) *(volatile char*)diskaddr(bno);
+  8065ab:	83 ec 0c             	sub    $0xc,%esp
+  8065ae:	53                   	push   %ebx
+  8065af:	e8 75 b4 ff ff       	call   801a29 <diskaddr>
+  8065b4:	0f b6 00             	movzbl (%eax),%eax
+			n++;
+  8065b7:	83 c6 01             	add    $0x1,%esi
+  8065ba:	83 c4 10             	add    $0x10,%esp
+  8065bd:	eb cf                	jmp    80658e <fs_test+0x813>
+		}
+	bc_get_stat(&st);
+  8065bf:	83 ec 0c             	sub    $0xc,%esp
+  8065c2:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  8065c5:	50                   	push   %eax
+  8065c6:	e8 43 b6 ff ff       	call   801c0e <bc_get_stat>
+	assert(st.bs_resident <= BC_MINBLOCKS);
+  8065cb:	83 c4 10             	add    $0x10,%esp
+  8065ce:	83 7d c0 20          	cmpl   $0x20,-0x40(%ebp)
+  8065d2:	77 4d                	ja     806621 <fs_test+0x8a6>
+	assert(n <= BC_MINBLOCKS || st.bs_evictions > evictions);
+  8065d4:	83 fe 20             	cmp    $0x20,%esi
+  8065d7:	76 05                	jbe    8065de <fs_test+0x863>
+  8065d9:	3b 7d b0             	cmp    -0x50(%ebp),%edi
+  8065dc:	73 59                	jae    806637 <fs_test+0x8bc>
+	assert(strcmp(blk, msg) == 0);
+  8065de:	83 ec 08             	sub    $0x8,%esp
+  8065e1:	68 5c b7 80 00       	push   $0x80b75c
+  8065e6:	ff 75 e0             	push   -0x20(%ebp)
+  8065e9:	e8 9a 08 00 00       	call   806e88 <strcmp>
+  8065ee:	83 c4 10             	add    $0x10,%esp
+  8065f1:	85 c0                	test   %eax,%eax
+  8065f3:	75 58                	jne    80664d <fs_test+0x8d2>
+	if ((r = bc_set_budget(BC_NBLOCKS)) < 0)
+  8065f5:	83 ec 0c             	sub    $0xc,%esp
+  8065f8:	68 00 01 00 00       	push   $0x100
+  8065fd:	e8 85 ba ff ff       	call   802087 <bc_set_budget>
+  806602:	83 c4 10             	add    $0x10,%esp
+  806605:	85 c0                	test   %eax,%eax
+  806607:	78 5a                	js     806663 <fs_test+0x8e8>
+		panic("bc_set_budget 2: %e", r);
+	cprintf("block cache eviction is good\n");
+  806609:	83 ec 0c             	sub    $0xc,%esp
+  80660c:	68 fd b6 80 00       	push   $0x80b6fd
+  806611:	e8 dd 01 00 00       	call   8067f3 <cprintf>
+}
+  806616:	83 c4 10             	add    $0x10,%esp
+  806619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80661c:	5b                   	pop    %ebx
+  80661d:	5e                   	pop    %esi
+  80661e:	5f                   	pop    %edi
+  80661f:	5d                   	pop    %ebp
+  806620:	c3                   	ret
+	assert(st.bs_resident <= BC_MINBLOCKS);
+  806621:	68 18 b9 80 00       	push   $0x80b918
+  806626:	68 2b ad 80 00       	push   $0x80ad2b
+  80662b:	6a 79                	push   $0x79
+  80662d:	68 4b b4 80 00       	push   $0x80b44b
+  806632:	e8 e1 00 00 00       	call   806718 <_panic>
+	assert(n <= BC_MINBLOCKS || st.bs_evictions > evictions);
+  806637:	68 38 b9 80 00       	push   $0x80b938
+  80663c:	68 2b ad 80 00       	push   $0x80ad2b
+  806641:	6a 7a                	push   $0x7a
+  806643:	68 4b b4 80 00       	push   $0x80b44b
+  806648:	e8 cb 00 00 00       	call   806718 <_panic>
+	assert(strcmp(blk, msg) == 0);
+  80664d:	68 35 b6 80 00       	push   $0x80b635
+  806652:	68 2b ad 80 00       	push   $0x80ad2b
+  806657:	6a 7b                	push   $0x7b
+  806659:	68 4b b4 80 00       	push   $0x80b44b
+  80665e:	e8 b5 00 00 00       	call   806718 <_panic>
+		panic("bc_set_budget 2: %e", r);
+  806663:	50                   	push   %eax
+  806664:	68 e9 b6 80 00       	push   $0x80b6e9
+  806669:	6a 7d                	push   $0x7d
+  80666b:	68 4b b4 80 00       	push   $0x80b44b
+  806670:	e8 a3 00 00 00       	call   806718 <_panic>
+
+00806675 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  806675:	55                   	push   %ebp
+  806676:	89 e5                	mov    %esp,%ebp
+  806678:	57                   	push   %edi
+  806679:	56                   	push   %esi
+  80667a:	53                   	push   %ebx
+  80667b:	83 ec 1c             	sub    $0x1c,%esp
+  80667e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  806681:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  806684:	e8 34 0b 00 00       	call   8071bd <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  806689:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80668c:	89 15 40 c4 84 00    	mov    %edx,0x84c440
+	thisenv = &envs[ENVX(eid)];
+  806692:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806697:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  806699:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80669b:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8066a1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8066a6:	77 16                	ja     8066be <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8066a8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8066ad:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8066af:	c1 e8 10             	shr    $0x10,%eax
+  8066b2:	74 0a                	je     8066be <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8066b4:	c1 e0 10             	shl    $0x10,%eax
+  8066b7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8066bc:	29 c2                	sub    %eax,%edx
+  8066be:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8066c1:	c1 e0 04             	shl    $0x4,%eax
+  8066c4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8066c9:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8066cb:	85 db                	test   %ebx,%ebx
+  8066cd:	7e 07                	jle    8066d6 <libmain+0x61>
+		binaryname = argv[0];
+  8066cf:	8b 06                	mov    (%esi),%eax
+  8066d1:	a3 a0 10 81 00       	mov    %eax,0x8110a0
+
+	// call user main routine
+	umain(argc, argv);
+  8066d6:	83 ec 08             	sub    $0x8,%esp
+  8066d9:	56                   	push   %esi
+  8066da:	53                   	push   %ebx
+  8066db:	e8 a3 f5 ff ff       	call   805c83 <umain>
+
+	// exit gracefully
+	exit();
+  8066e0:	e8 0b 00 00 00       	call   8066f0 <exit>
+}
+  8066e5:	83 c4 10             	add    $0x10,%esp
+  8066e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8066eb:	5b                   	pop    %ebx
+  8066ec:	5e                   	pop    %esi
+  8066ed:	5f                   	pop    %edi
+  8066ee:	5d                   	pop    %ebp
+  8066ef:	c3                   	ret
+
+008066f0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8066f0:	55                   	push   %ebp
+  8066f1:	89 e5                	mov    %esp,%ebp
+  8066f3:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8066f6:	6a 00                	push   $0x0
+  8066f8:	e8 04 23 00 00       	call   808a01 <fflush>
+	pthread_kill_others();
+  8066fd:	e8 ab 39 00 00       	call   80a0ad <pthread_kill_others>
+	close_all();
+  806702:	e8 9d 13 00 00       	call   807aa4 <close_all>
+	sys_env_destroy(0);
+  806707:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80670e:	e8 5f 0a 00 00       	call   807172 <sys_env_destroy>
+}
+  806713:	83 c4 10             	add    $0x10,%esp
+  806716:	c9                   	leave
+  806717:	c3                   	ret
+
+00806718 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  806718:	55                   	push   %ebp
+  806719:	89 e5                	mov    %esp,%ebp
+  80671b:	56                   	push   %esi
+  80671c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80671d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  806720:	8b 35 a0 10 81 00    	mov    0x8110a0,%esi
+  806726:	e8 92 0a 00 00       	call   8071bd <sys_getenvid>
+  80672b:	83 ec 0c             	sub    $0xc,%esp
+  80672e:	ff 75 0c             	push   0xc(%ebp)
+  806731:	ff 75 08             	push   0x8(%ebp)
+  806734:	56                   	push   %esi
+  806735:	50                   	push   %eax
+  806736:	68 74 b9 80 00       	push   $0x80b974
+  80673b:	e8 b3 00 00 00       	call   8067f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806740:	83 c4 18             	add    $0x18,%esp
+  806743:	53                   	push   %ebx
+  806744:	ff 75 10             	push   0x10(%ebp)
+  806747:	e8 56 00 00 00       	call   8067a2 <vcprintf>
+	cprintf("\n");
+  80674c:	c7 04 24 82 b1 80 00 	movl   $0x80b182,(%esp)
+  806753:	e8 9b 00 00 00       	call   8067f3 <cprintf>
+  806758:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80675b:	cc                   	int3
+	while (1)
+  80675c:	eb fd                	jmp    80675b <_panic+0x43>
+
+0080675e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80675e:	55                   	push   %ebp
+  80675f:	89 e5                	mov    %esp,%ebp
+  806761:	53                   	push   %ebx
+  806762:	83 ec 04             	sub    $0x4,%esp
+  806765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  806768:	8b 13                	mov    (%ebx),%edx
+  80676a:	8d 42 01             	lea    0x1(%edx),%eax
+  80676d:	89 03                	mov    %eax,(%ebx)
+  80676f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  806772:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  806776:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80677b:	74 09                	je     806786 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80677d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  806781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806784:	c9                   	leave
+  806785:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  806786:	83 ec 08             	sub    $0x8,%esp
+  806789:	68 ff 00 00 00       	push   $0xff
+  80678e:	8d 43 08             	lea    0x8(%ebx),%eax
+  806791:	50                   	push   %eax
+  806792:	e8 84 09 00 00       	call   80711b <sys_cputs>
+		b->idx = 0;
+  806797:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80679d:	83 c4 10             	add    $0x10,%esp
+  8067a0:	eb db                	jmp    80677d <putch+0x1f>
+
+008067a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8067a2:	55                   	push   %ebp
+  8067a3:	89 e5                	mov    %esp,%ebp
+  8067a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8067ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8067b2:	00 00 00 
+	b.cnt = 0;
+  8067b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8067bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8067bf:	ff 75 0c             	push   0xc(%ebp)
+  8067c2:	ff 75 08             	push   0x8(%ebp)
+  8067c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8067cb:	50                   	push   %eax
+  8067cc:	68 5e 67 80 00       	push   $0x80675e
+  8067d1:	e8 14 01 00 00       	call   8068ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8067d6:	83 c4 08             	add    $0x8,%esp
+  8067d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8067df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8067e5:	50                   	push   %eax
+  8067e6:	e8 30 09 00 00       	call   80711b <sys_cputs>
+
+	return b.cnt;
+}
+  8067eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8067f1:	c9                   	leave
+  8067f2:	c3                   	ret
+
+008067f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8067f3:	55                   	push   %ebp
+  8067f4:	89 e5                	mov    %esp,%ebp
+  8067f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8067f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8067fc:	50                   	push   %eax
+  8067fd:	ff 75 08             	push   0x8(%ebp)
+  806800:	e8 9d ff ff ff       	call   8067a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  806805:	c9                   	leave
+  806806:	c3                   	ret
+
+00806807 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  806807:	55                   	push   %ebp
+  806808:	89 e5                	mov    %esp,%ebp
+  80680a:	57                   	push   %edi
+  80680b:	56                   	push   %esi
+  80680c:	53                   	push   %ebx
+  80680d:	83 ec 1c             	sub    $0x1c,%esp
+  806810:	89 c7                	mov    %eax,%edi
+  806812:	89 d6                	mov    %edx,%esi
+  806814:	8b 45 08             	mov    0x8(%ebp),%eax
+  806817:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80681a:	89 d1                	mov    %edx,%ecx
+  80681c:	89 c2                	mov    %eax,%edx
+  80681e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806821:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806824:	8b 45 10             	mov    0x10(%ebp),%eax
+  806827:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80682a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80682d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  806834:	39 c2                	cmp    %eax,%edx
+  806836:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  806839:	72 3e                	jb     806879 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80683b:	83 ec 0c             	sub    $0xc,%esp
+  80683e:	ff 75 18             	push   0x18(%ebp)
+  806841:	83 eb 01             	sub    $0x1,%ebx
+  806844:	53                   	push   %ebx
+  806845:	50                   	push   %eax
+  806846:	83 ec 08             	sub    $0x8,%esp
+  806849:	ff 75 e4             	push   -0x1c(%ebp)
+  80684c:	ff 75 e0             	push   -0x20(%ebp)
+  80684f:	ff 75 dc             	push   -0x24(%ebp)
+  806852:	ff 75 d8             	push   -0x28(%ebp)
+  806855:	e8 21 43 00 00       	call   80ab7b <__udivdi3>
+  80685a:	83 c4 18             	add    $0x18,%esp
+  80685d:	52                   	push   %edx
+  80685e:	50                   	push   %eax
+  80685f:	89 f2                	mov    %esi,%edx
+  806861:	89 f8                	mov    %edi,%eax
+  806863:	e8 9f ff ff ff       	call   806807 <printnum>
+  806868:	83 c4 20             	add    $0x20,%esp
+  80686b:	eb 13                	jmp    806880 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80686d:	83 ec 08             	sub    $0x8,%esp
+  806870:	56                   	push   %esi
+  806871:	ff 75 18             	push   0x18(%ebp)
+  806874:	ff d7                	call   *%edi
+  806876:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  806879:	83 eb 01             	sub    $0x1,%ebx
+  80687c:	85 db                	test   %ebx,%ebx
+  80687e:	7f ed                	jg     80686d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  806880:	83 ec 08             	sub    $0x8,%esp
+  806883:	56                   	push   %esi
+  806884:	83 ec 04             	sub    $0x4,%esp
+  806887:	ff 75 e4             	push   -0x1c(%ebp)
+  80688a:	ff 75 e0             	push   -0x20(%ebp)
+  80688d:	ff 75 dc             	push   -0x24(%ebp)
+  806890:	ff 75 d8             	push   -0x28(%ebp)
+  806893:	e8 04 43 00 00       	call   80ab9c <__umoddi3>
+  806898:	83 c4 14             	add    $0x14,%esp
+  80689b:	0f be 80 97 b9 80 00 	movsbl 0x80b997(%eax),%eax
+  8068a2:	50                   	push   %eax
+  8068a3:	ff d7                	call   *%edi
+}
+  8068a5:	83 c4 10             	add    $0x10,%esp
+  8068a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8068ab:	5b                   	pop    %ebx
+  8068ac:	5e                   	pop    %esi
+  8068ad:	5f                   	pop    %edi
+  8068ae:	5d                   	pop    %ebp
+  8068af:	c3                   	ret
+
+008068b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8068b0:	55                   	push   %ebp
+  8068b1:	89 e5                	mov    %esp,%ebp
+  8068b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8068b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8068ba:	8b 10                	mov    (%eax),%edx
+  8068bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8068bf:	73 0a                	jae    8068cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8068c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8068c4:	89 08                	mov    %ecx,(%eax)
+  8068c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8068c9:	88 02                	mov    %al,(%edx)
+}
+  8068cb:	5d                   	pop    %ebp
+  8068cc:	c3                   	ret
+
+008068cd <printfmt>:
+{
+  8068cd:	55                   	push   %ebp
+  8068ce:	89 e5                	mov    %esp,%ebp
+  8068d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8068d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8068d6:	50                   	push   %eax
+  8068d7:	ff 75 10             	push   0x10(%ebp)
+  8068da:	ff 75 0c             	push   0xc(%ebp)
+  8068dd:	ff 75 08             	push   0x8(%ebp)
+  8068e0:	e8 05 00 00 00       	call   8068ea <vprintfmt>
+}
+  8068e5:	83 c4 10             	add    $0x10,%esp
+  8068e8:	c9                   	leave
+  8068e9:	c3                   	ret
+
+008068ea <vprintfmt>:
+{
+  8068ea:	55                   	push   %ebp
+  8068eb:	89 e5                	mov    %esp,%ebp
+  8068ed:	57                   	push   %edi
+  8068ee:	56                   	push   %esi
+  8068ef:	53                   	push   %ebx
+  8068f0:	83 ec 2c             	sub    $0x2c,%esp
+  8068f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8068f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8068f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8068fc:	eb 0a                	jmp    806908 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8068fe:	83 ec 08             	sub    $0x8,%esp
+  806901:	53                   	push   %ebx
+  806902:	50                   	push   %eax
+  806903:	ff d6                	call   *%esi
+  806905:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  806908:	83 c7 01             	add    $0x1,%edi
+  80690b:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80690f:	83 f8 25             	cmp    $0x25,%eax
+  806912:	74 0c                	je     806920 <vprintfmt+0x36>
+			if (ch == '\0')
+  806914:	85 c0                	test   %eax,%eax
+  806916:	75 e6                	jne    8068fe <vprintfmt+0x14>
+}
+  806918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80691b:	5b                   	pop    %ebx
+  80691c:	5e                   	pop    %esi
+  80691d:	5f                   	pop    %edi
+  80691e:	5d                   	pop    %ebp
+  80691f:	c3                   	ret
+		padc = ' ';
+  806920:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  806924:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80692b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  806932:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  806939:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80693e:	8d 47 01             	lea    0x1(%edi),%eax
+  806941:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  806944:	0f b6 17             	movzbl (%edi),%edx
+  806947:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80694a:	3c 55                	cmp    $0x55,%al
+  80694c:	0f 87 c5 03 00 00    	ja     806d17 <vprintfmt+0x42d>
+  806952:	0f b6 c0             	movzbl %al,%eax
+  806955:	ff 24 85 20 bb 80 00 	jmp    *0x80bb20(,%eax,4)
+  80695c:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80695f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  806962:	eb da                	jmp    80693e <vprintfmt+0x54>
+  806964:	0f be d2             	movsbl %dl,%edx
+  806967:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80696a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80696f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  806972:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  806975:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  806979:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80697c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80697f:	83 f9 09             	cmp    $0x9,%ecx
+  806982:	77 55                	ja     8069d9 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  806984:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  806987:	eb e9                	jmp    806972 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  806989:	8b 45 14             	mov    0x14(%ebp),%eax
+  80698c:	8b 00                	mov    (%eax),%eax
+  80698e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  806991:	8b 45 14             	mov    0x14(%ebp),%eax
+  806994:	8d 40 04             	lea    0x4(%eax),%eax
+  806997:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80699a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80699d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8069a1:	79 9b                	jns    80693e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8069a3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8069a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8069a9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8069b0:	eb 8c                	jmp    80693e <vprintfmt+0x54>
+			if (width < 0)
+  8069b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8069b5:	85 d2                	test   %edx,%edx
+  8069b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069bc:	0f 49 c2             	cmovns %edx,%eax
+  8069bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8069c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8069c5:	e9 74 ff ff ff       	jmp    80693e <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8069ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8069cd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8069d4:	e9 65 ff ff ff       	jmp    80693e <vprintfmt+0x54>
+  8069d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8069dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8069df:	eb bc                	jmp    80699d <vprintfmt+0xb3>
+			lflag++;
+  8069e1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8069e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8069e7:	e9 52 ff ff ff       	jmp    80693e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8069ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8069ef:	8d 78 04             	lea    0x4(%eax),%edi
+  8069f2:	83 ec 08             	sub    $0x8,%esp
+  8069f5:	53                   	push   %ebx
+  8069f6:	ff 30                	push   (%eax)
+  8069f8:	ff d6                	call   *%esi
+			break;
+  8069fa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8069fd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  806a00:	e9 b1 02 00 00       	jmp    806cb6 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  806a05:	8b 45 14             	mov    0x14(%ebp),%eax
+  806a08:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  806a0b:	8b 10                	mov    (%eax),%edx
+  806a0d:	89 d0                	mov    %edx,%eax
+  806a0f:	f7 d8                	neg    %eax
+  806a11:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  806a14:	83 f8 14             	cmp    $0x14,%eax
+  806a17:	7f 23                	jg     806a3c <vprintfmt+0x152>
+  806a19:	8b 14 85 80 bc 80 00 	mov    0x80bc80(,%eax,4),%edx
+  806a20:	85 d2                	test   %edx,%edx
+  806a22:	74 18                	je     806a3c <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  806a24:	52                   	push   %edx
+  806a25:	68 3d ad 80 00       	push   $0x80ad3d
+  806a2a:	53                   	push   %ebx
+  806a2b:	56                   	push   %esi
+  806a2c:	e8 9c fe ff ff       	call   8068cd <printfmt>
+  806a31:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  806a34:	89 7d 14             	mov    %edi,0x14(%ebp)
+  806a37:	e9 7a 02 00 00       	jmp    806cb6 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  806a3c:	50                   	push   %eax
+  806a3d:	68 af b9 80 00       	push   $0x80b9af
+  806a42:	53                   	push   %ebx
+  806a43:	56                   	push   %esi
+  806a44:	e8 84 fe ff ff       	call   8068cd <printfmt>
+  806a49:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  806a4c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  806a4f:	e9 62 02 00 00       	jmp    806cb6 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  806a54:	8b 45 14             	mov    0x14(%ebp),%eax
+  806a57:	83 c0 04             	add    $0x4,%eax
+  806a5a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  806a5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  806a60:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  806a62:	85 c9                	test   %ecx,%ecx
+  806a64:	b8 a8 b9 80 00       	mov    $0x80b9a8,%eax
+  806a69:	0f 45 c1             	cmovne %ecx,%eax
+  806a6c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  806a6f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  806a73:	7e 06                	jle    806a7b <vprintfmt+0x191>
+  806a75:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  806a79:	75 0b                	jne    806a86 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  806a7b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  806a7e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  806a81:	89 75 08             	mov    %esi,0x8(%ebp)
+  806a84:	eb 5c                	jmp    806ae2 <vprintfmt+0x1f8>
+  806a86:	83 ec 08             	sub    $0x8,%esp
+  806a89:	ff 75 d0             	push   -0x30(%ebp)
+  806a8c:	ff 75 cc             	push   -0x34(%ebp)
+  806a8f:	e8 20 03 00 00       	call   806db4 <strnlen>
+  806a94:	89 c2                	mov    %eax,%edx
+  806a96:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  806a99:	29 d0                	sub    %edx,%eax
+  806a9b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  806a9e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  806aa2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806aa5:	89 75 08             	mov    %esi,0x8(%ebp)
+  806aa8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  806aaa:	eb 0e                	jmp    806aba <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  806aac:	83 ec 08             	sub    $0x8,%esp
+  806aaf:	53                   	push   %ebx
+  806ab0:	57                   	push   %edi
+  806ab1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  806ab4:	83 ee 01             	sub    $0x1,%esi
+  806ab7:	83 c4 10             	add    $0x10,%esp
+  806aba:	85 f6                	test   %esi,%esi
+  806abc:	7f ee                	jg     806aac <vprintfmt+0x1c2>
+  806abe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  806ac1:	8b 75 08             	mov    0x8(%ebp),%esi
+  806ac4:	85 c0                	test   %eax,%eax
+  806ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+  806acb:	0f 49 d0             	cmovns %eax,%edx
+  806ace:	29 d0                	sub    %edx,%eax
+  806ad0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806ad3:	eb a6                	jmp    806a7b <vprintfmt+0x191>
+					putch(ch, putdat);
+  806ad5:	83 ec 08             	sub    $0x8,%esp
+  806ad8:	53                   	push   %ebx
+  806ad9:	52                   	push   %edx
+  806ada:	ff 55 08             	call   *0x8(%ebp)
+  806add:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  806ae0:	89 f1                	mov    %esi,%ecx
+  806ae2:	8d 71 01             	lea    0x1(%ecx),%esi
+  806ae5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  806ae9:	0f be d0             	movsbl %al,%edx
+  806aec:	85 d2                	test   %edx,%edx
+  806aee:	74 28                	je     806b18 <vprintfmt+0x22e>
+  806af0:	85 ff                	test   %edi,%edi
+  806af2:	78 05                	js     806af9 <vprintfmt+0x20f>
+  806af4:	83 ef 01             	sub    $0x1,%edi
+  806af7:	78 30                	js     806b29 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  806af9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  806afd:	74 d6                	je     806ad5 <vprintfmt+0x1eb>
+  806aff:	0f be c0             	movsbl %al,%eax
+  806b02:	83 e8 20             	sub    $0x20,%eax
+  806b05:	83 f8 5e             	cmp    $0x5e,%eax
+  806b08:	76 cb                	jbe    806ad5 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  806b0a:	83 ec 08             	sub    $0x8,%esp
+  806b0d:	53                   	push   %ebx
+  806b0e:	6a 3f                	push   $0x3f
+  806b10:	ff 55 08             	call   *0x8(%ebp)
+  806b13:	83 c4 10             	add    $0x10,%esp
+  806b16:	eb c8                	jmp    806ae0 <vprintfmt+0x1f6>
+  806b18:	8b 75 08             	mov    0x8(%ebp),%esi
+  806b1b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  806b1e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  806b21:	01 d0                	add    %edx,%eax
+  806b23:	29 c8                	sub    %ecx,%eax
+  806b25:	89 c7                	mov    %eax,%edi
+  806b27:	eb 13                	jmp    806b3c <vprintfmt+0x252>
+  806b29:	8b 75 08             	mov    0x8(%ebp),%esi
+  806b2c:	eb ed                	jmp    806b1b <vprintfmt+0x231>
+				putch(' ', putdat);
+  806b2e:	83 ec 08             	sub    $0x8,%esp
+  806b31:	53                   	push   %ebx
+  806b32:	6a 20                	push   $0x20
+  806b34:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  806b36:	83 ef 01             	sub    $0x1,%edi
+  806b39:	83 c4 10             	add    $0x10,%esp
+  806b3c:	85 ff                	test   %edi,%edi
+  806b3e:	7f ee                	jg     806b2e <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  806b40:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  806b43:	89 45 14             	mov    %eax,0x14(%ebp)
+  806b46:	e9 6b 01 00 00       	jmp    806cb6 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  806b4b:	83 f9 01             	cmp    $0x1,%ecx
+  806b4e:	7f 1f                	jg     806b6f <vprintfmt+0x285>
+	else if (lflag)
+  806b50:	85 c9                	test   %ecx,%ecx
+  806b52:	74 67                	je     806bbb <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  806b54:	8b 45 14             	mov    0x14(%ebp),%eax
+  806b57:	8b 00                	mov    (%eax),%eax
+  806b59:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806b5c:	89 c1                	mov    %eax,%ecx
+  806b5e:	c1 f9 1f             	sar    $0x1f,%ecx
+  806b61:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806b64:	8b 45 14             	mov    0x14(%ebp),%eax
+  806b67:	8d 40 04             	lea    0x4(%eax),%eax
+  806b6a:	89 45 14             	mov    %eax,0x14(%ebp)
+  806b6d:	eb 17                	jmp    806b86 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  806b6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  806b72:	8b 50 04             	mov    0x4(%eax),%edx
+  806b75:	8b 00                	mov    (%eax),%eax
+  806b77:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806b7a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  806b7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  806b80:	8d 40 08             	lea    0x8(%eax),%eax
+  806b83:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  806b86:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  806b89:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  806b8c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  806b91:	85 c9                	test   %ecx,%ecx
+  806b93:	0f 89 03 01 00 00    	jns    806c9c <vprintfmt+0x3b2>
+				putch('-', putdat);
+  806b99:	83 ec 08             	sub    $0x8,%esp
+  806b9c:	53                   	push   %ebx
+  806b9d:	6a 2d                	push   $0x2d
+  806b9f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  806ba1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  806ba4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  806ba7:	f7 da                	neg    %edx
+  806ba9:	83 d1 00             	adc    $0x0,%ecx
+  806bac:	f7 d9                	neg    %ecx
+  806bae:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  806bb1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  806bb6:	e9 e1 00 00 00       	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  806bbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  806bbe:	8b 00                	mov    (%eax),%eax
+  806bc0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806bc3:	89 c1                	mov    %eax,%ecx
+  806bc5:	c1 f9 1f             	sar    $0x1f,%ecx
+  806bc8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806bcb:	8b 45 14             	mov    0x14(%ebp),%eax
+  806bce:	8d 40 04             	lea    0x4(%eax),%eax
+  806bd1:	89 45 14             	mov    %eax,0x14(%ebp)
+  806bd4:	eb b0                	jmp    806b86 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  806bd6:	83 f9 01             	cmp    $0x1,%ecx
+  806bd9:	7f 1e                	jg     806bf9 <vprintfmt+0x30f>
+	else if (lflag)
+  806bdb:	85 c9                	test   %ecx,%ecx
+  806bdd:	74 32                	je     806c11 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  806bdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  806be2:	8b 10                	mov    (%eax),%edx
+  806be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806be9:	8d 40 04             	lea    0x4(%eax),%eax
+  806bec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  806bef:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  806bf4:	e9 a3 00 00 00       	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  806bf9:	8b 45 14             	mov    0x14(%ebp),%eax
+  806bfc:	8b 10                	mov    (%eax),%edx
+  806bfe:	8b 48 04             	mov    0x4(%eax),%ecx
+  806c01:	8d 40 08             	lea    0x8(%eax),%eax
+  806c04:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  806c07:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  806c0c:	e9 8b 00 00 00       	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  806c11:	8b 45 14             	mov    0x14(%ebp),%eax
+  806c14:	8b 10                	mov    (%eax),%edx
+  806c16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806c1b:	8d 40 04             	lea    0x4(%eax),%eax
+  806c1e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  806c21:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  806c26:	eb 74                	jmp    806c9c <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  806c28:	83 f9 01             	cmp    $0x1,%ecx
+  806c2b:	7f 1b                	jg     806c48 <vprintfmt+0x35e>
+	else if (lflag)
+  806c2d:	85 c9                	test   %ecx,%ecx
+  806c2f:	74 2c                	je     806c5d <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  806c31:	8b 45 14             	mov    0x14(%ebp),%eax
+  806c34:	8b 10                	mov    (%eax),%edx
+  806c36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806c3b:	8d 40 04             	lea    0x4(%eax),%eax
+  806c3e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  806c41:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  806c46:	eb 54                	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  806c48:	8b 45 14             	mov    0x14(%ebp),%eax
+  806c4b:	8b 10                	mov    (%eax),%edx
+  806c4d:	8b 48 04             	mov    0x4(%eax),%ecx
+  806c50:	8d 40 08             	lea    0x8(%eax),%eax
+  806c53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  806c56:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  806c5b:	eb 3f                	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  806c5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  806c60:	8b 10                	mov    (%eax),%edx
+  806c62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806c67:	8d 40 04             	lea    0x4(%eax),%eax
+  806c6a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  806c6d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  806c72:	eb 28                	jmp    806c9c <vprintfmt+0x3b2>
+			putch('0', putdat);
+  806c74:	83 ec 08             	sub    $0x8,%esp
+  806c77:	53                   	push   %ebx
+  806c78:	6a 30                	push   $0x30
+  806c7a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  806c7c:	83 c4 08             	add    $0x8,%esp
+  806c7f:	53                   	push   %ebx
+  806c80:	6a 78                	push   $0x78
+  806c82:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  806c84:	8b 45 14             	mov    0x14(%ebp),%eax
+  806c87:	8b 10                	mov    (%eax),%edx
+  806c89:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  806c8e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  806c91:	8d 40 04             	lea    0x4(%eax),%eax
+  806c94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  806c97:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  806c9c:	83 ec 0c             	sub    $0xc,%esp
+  806c9f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  806ca3:	50                   	push   %eax
+  806ca4:	ff 75 e0             	push   -0x20(%ebp)
+  806ca7:	57                   	push   %edi
+  806ca8:	51                   	push   %ecx
+  806ca9:	52                   	push   %edx
+  806caa:	89 da                	mov    %ebx,%edx
+  806cac:	89 f0                	mov    %esi,%eax
+  806cae:	e8 54 fb ff ff       	call   806807 <printnum>
+			break;
+  806cb3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  806cb6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  806cb9:	e9 4a fc ff ff       	jmp    806908 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  806cbe:	83 f9 01             	cmp    $0x1,%ecx
+  806cc1:	7f 1b                	jg     806cde <vprintfmt+0x3f4>
+	else if (lflag)
+  806cc3:	85 c9                	test   %ecx,%ecx
+  806cc5:	74 2c                	je     806cf3 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  806cc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  806cca:	8b 10                	mov    (%eax),%edx
+  806ccc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806cd1:	8d 40 04             	lea    0x4(%eax),%eax
+  806cd4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  806cd7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  806cdc:	eb be                	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  806cde:	8b 45 14             	mov    0x14(%ebp),%eax
+  806ce1:	8b 10                	mov    (%eax),%edx
+  806ce3:	8b 48 04             	mov    0x4(%eax),%ecx
+  806ce6:	8d 40 08             	lea    0x8(%eax),%eax
+  806ce9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  806cec:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  806cf1:	eb a9                	jmp    806c9c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  806cf3:	8b 45 14             	mov    0x14(%ebp),%eax
+  806cf6:	8b 10                	mov    (%eax),%edx
+  806cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806cfd:	8d 40 04             	lea    0x4(%eax),%eax
+  806d00:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  806d03:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  806d08:	eb 92                	jmp    806c9c <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  806d0a:	83 ec 08             	sub    $0x8,%esp
+  806d0d:	53                   	push   %ebx
+  806d0e:	6a 25                	push   $0x25
+  806d10:	ff d6                	call   *%esi
+			break;
+  806d12:	83 c4 10             	add    $0x10,%esp
+  806d15:	eb 9f                	jmp    806cb6 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  806d17:	83 ec 08             	sub    $0x8,%esp
+  806d1a:	53                   	push   %ebx
+  806d1b:	6a 25                	push   $0x25
+  806d1d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  806d1f:	83 c4 10             	add    $0x10,%esp
+  806d22:	89 f8                	mov    %edi,%eax
+  806d24:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  806d28:	74 05                	je     806d2f <vprintfmt+0x445>
+  806d2a:	83 e8 01             	sub    $0x1,%eax
+  806d2d:	eb f5                	jmp    806d24 <vprintfmt+0x43a>
+  806d2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  806d32:	eb 82                	jmp    806cb6 <vprintfmt+0x3cc>
+
+00806d34 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  806d34:	55                   	push   %ebp
+  806d35:	89 e5                	mov    %esp,%ebp
+  806d37:	83 ec 18             	sub    $0x18,%esp
+  806d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  806d3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  806d40:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  806d43:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  806d47:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  806d4a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  806d51:	85 c0                	test   %eax,%eax
+  806d53:	74 26                	je     806d7b <vsnprintf+0x47>
+  806d55:	85 d2                	test   %edx,%edx
+  806d57:	7e 22                	jle    806d7b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  806d59:	ff 75 14             	push   0x14(%ebp)
+  806d5c:	ff 75 10             	push   0x10(%ebp)
+  806d5f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  806d62:	50                   	push   %eax
+  806d63:	68 b0 68 80 00       	push   $0x8068b0
+  806d68:	e8 7d fb ff ff       	call   8068ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  806d6d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  806d70:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  806d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  806d76:	83 c4 10             	add    $0x10,%esp
+}
+  806d79:	c9                   	leave
+  806d7a:	c3                   	ret
+		return -E_INVAL;
+  806d7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806d80:	eb f7                	jmp    806d79 <vsnprintf+0x45>
+
+00806d82 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  806d82:	55                   	push   %ebp
+  806d83:	89 e5                	mov    %esp,%ebp
+  806d85:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  806d88:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  806d8b:	50                   	push   %eax
+  806d8c:	ff 75 10             	push   0x10(%ebp)
+  806d8f:	ff 75 0c             	push   0xc(%ebp)
+  806d92:	ff 75 08             	push   0x8(%ebp)
+  806d95:	e8 9a ff ff ff       	call   806d34 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  806d9a:	c9                   	leave
+  806d9b:	c3                   	ret
+
+00806d9c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  806d9c:	55                   	push   %ebp
+  806d9d:	89 e5                	mov    %esp,%ebp
+  806d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  806da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  806da7:	eb 03                	jmp    806dac <strlen+0x10>
+		n++;
+  806da9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  806dac:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  806db0:	75 f7                	jne    806da9 <strlen+0xd>
+	return n;
+}
+  806db2:	5d                   	pop    %ebp
+  806db3:	c3                   	ret
+
+00806db4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  806db4:	55                   	push   %ebp
+  806db5:	89 e5                	mov    %esp,%ebp
+  806db7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  806dba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806dc2:	eb 03                	jmp    806dc7 <strnlen+0x13>
+		n++;
+  806dc4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  806dc7:	39 d0                	cmp    %edx,%eax
+  806dc9:	74 08                	je     806dd3 <strnlen+0x1f>
+  806dcb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  806dcf:	75 f3                	jne    806dc4 <strnlen+0x10>
+  806dd1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  806dd3:	89 d0                	mov    %edx,%eax
+  806dd5:	5d                   	pop    %ebp
+  806dd6:	c3                   	ret
+
+00806dd7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  806dd7:	55                   	push   %ebp
+  806dd8:	89 e5                	mov    %esp,%ebp
+  806dda:	53                   	push   %ebx
+  806ddb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  806dde:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  806de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  806de6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  806dea:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  806ded:	83 c0 01             	add    $0x1,%eax
+  806df0:	84 d2                	test   %dl,%dl
+  806df2:	75 f2                	jne    806de6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  806df4:	89 c8                	mov    %ecx,%eax
+  806df6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806df9:	c9                   	leave
+  806dfa:	c3                   	ret
+
+00806dfb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  806dfb:	55                   	push   %ebp
+  806dfc:	89 e5                	mov    %esp,%ebp
+  806dfe:	53                   	push   %ebx
+  806dff:	83 ec 10             	sub    $0x10,%esp
+  806e02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  806e05:	53                   	push   %ebx
+  806e06:	e8 91 ff ff ff       	call   806d9c <strlen>
+  806e0b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  806e0e:	ff 75 0c             	push   0xc(%ebp)
+  806e11:	01 d8                	add    %ebx,%eax
+  806e13:	50                   	push   %eax
+  806e14:	e8 be ff ff ff       	call   806dd7 <strcpy>
+	return dst;
+}
+  806e19:	89 d8                	mov    %ebx,%eax
+  806e1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806e1e:	c9                   	leave
+  806e1f:	c3                   	ret
+
+00806e20 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  806e20:	55                   	push   %ebp
+  806e21:	89 e5                	mov    %esp,%ebp
+  806e23:	56                   	push   %esi
+  806e24:	53                   	push   %ebx
+  806e25:	8b 75 08             	mov    0x8(%ebp),%esi
+  806e28:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  806e2b:	89 f3                	mov    %esi,%ebx
+  806e2d:	03 5d 10             	add    0x10(%ebp),%ebx
+  806e30:	89 f0                	mov    %esi,%eax
+  806e32:	eb 0f                	jmp    806e43 <strncpy+0x23>
+		*dst++ = *src;
+  806e34:	83 c0 01             	add    $0x1,%eax
+  806e37:	0f b6 0a             	movzbl (%edx),%ecx
+  806e3a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  806e3d:	80 f9 01             	cmp    $0x1,%cl
+  806e40:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  806e43:	39 d8                	cmp    %ebx,%eax
+  806e45:	75 ed                	jne    806e34 <strncpy+0x14>
+	}
+	return ret;
+}
+  806e47:	89 f0                	mov    %esi,%eax
+  806e49:	5b                   	pop    %ebx
+  806e4a:	5e                   	pop    %esi
+  806e4b:	5d                   	pop    %ebp
+  806e4c:	c3                   	ret
+
+00806e4d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  806e4d:	55                   	push   %ebp
+  806e4e:	89 e5                	mov    %esp,%ebp
+  806e50:	56                   	push   %esi
+  806e51:	53                   	push   %ebx
+  806e52:	8b 75 08             	mov    0x8(%ebp),%esi
+  806e55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806e58:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  806e5b:	89 f0                	mov    %esi,%eax
+  806e5d:	85 d2                	test   %edx,%edx
+  806e5f:	74 21                	je     806e82 <strlcpy+0x35>
+  806e61:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  806e65:	89 f2                	mov    %esi,%edx
+  806e67:	eb 09                	jmp    806e72 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  806e69:	83 c1 01             	add    $0x1,%ecx
+  806e6c:	83 c2 01             	add    $0x1,%edx
+  806e6f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  806e72:	39 c2                	cmp    %eax,%edx
+  806e74:	74 09                	je     806e7f <strlcpy+0x32>
+  806e76:	0f b6 19             	movzbl (%ecx),%ebx
+  806e79:	84 db                	test   %bl,%bl
+  806e7b:	75 ec                	jne    806e69 <strlcpy+0x1c>
+  806e7d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  806e7f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  806e82:	29 f0                	sub    %esi,%eax
+}
+  806e84:	5b                   	pop    %ebx
+  806e85:	5e                   	pop    %esi
+  806e86:	5d                   	pop    %ebp
+  806e87:	c3                   	ret
+
+00806e88 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  806e88:	55                   	push   %ebp
+  806e89:	89 e5                	mov    %esp,%ebp
+  806e8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  806e8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  806e91:	eb 06                	jmp    806e99 <strcmp+0x11>
+		p++, q++;
+  806e93:	83 c1 01             	add    $0x1,%ecx
+  806e96:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  806e99:	0f b6 01             	movzbl (%ecx),%eax
+  806e9c:	84 c0                	test   %al,%al
+  806e9e:	74 04                	je     806ea4 <strcmp+0x1c>
+  806ea0:	3a 02                	cmp    (%edx),%al
+  806ea2:	74 ef                	je     806e93 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  806ea4:	0f b6 c0             	movzbl %al,%eax
+  806ea7:	0f b6 12             	movzbl (%edx),%edx
+  806eaa:	29 d0                	sub    %edx,%eax
+}
+  806eac:	5d                   	pop    %ebp
+  806ead:	c3                   	ret
+
+00806eae <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  806eae:	55                   	push   %ebp
+  806eaf:	89 e5                	mov    %esp,%ebp
+  806eb1:	53                   	push   %ebx
+  806eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  806eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806eb8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  806ebb:	eb 09                	jmp    806ec6 <strncmp+0x18>
+		n--, p++, q++;
+  806ebd:	83 ea 01             	sub    $0x1,%edx
+  806ec0:	83 c0 01             	add    $0x1,%eax
+  806ec3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  806ec6:	85 d2                	test   %edx,%edx
+  806ec8:	74 18                	je     806ee2 <strncmp+0x34>
+  806eca:	0f b6 18             	movzbl (%eax),%ebx
+  806ecd:	84 db                	test   %bl,%bl
+  806ecf:	74 04                	je     806ed5 <strncmp+0x27>
+  806ed1:	3a 19                	cmp    (%ecx),%bl
+  806ed3:	74 e8                	je     806ebd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  806ed5:	0f b6 00             	movzbl (%eax),%eax
+  806ed8:	0f b6 11             	movzbl (%ecx),%edx
+  806edb:	29 d0                	sub    %edx,%eax
+}
+  806edd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806ee0:	c9                   	leave
+  806ee1:	c3                   	ret
+		return 0;
+  806ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ee7:	eb f4                	jmp    806edd <strncmp+0x2f>
+
+00806ee9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  806ee9:	55                   	push   %ebp
+  806eea:	89 e5                	mov    %esp,%ebp
+  806eec:	8b 45 08             	mov    0x8(%ebp),%eax
+  806eef:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  806ef3:	eb 03                	jmp    806ef8 <strchr+0xf>
+  806ef5:	83 c0 01             	add    $0x1,%eax
+  806ef8:	0f b6 10             	movzbl (%eax),%edx
+  806efb:	84 d2                	test   %dl,%dl
+  806efd:	74 06                	je     806f05 <strchr+0x1c>
+		if (*s == c)
+  806eff:	38 ca                	cmp    %cl,%dl
+  806f01:	75 f2                	jne    806ef5 <strchr+0xc>
+  806f03:	eb 05                	jmp    806f0a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  806f05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f0a:	5d                   	pop    %ebp
+  806f0b:	c3                   	ret
+
+00806f0c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  806f0c:	55                   	push   %ebp
+  806f0d:	89 e5                	mov    %esp,%ebp
+  806f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  806f12:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  806f16:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  806f19:	38 ca                	cmp    %cl,%dl
+  806f1b:	74 09                	je     806f26 <strfind+0x1a>
+  806f1d:	84 d2                	test   %dl,%dl
+  806f1f:	74 05                	je     806f26 <strfind+0x1a>
+	for (; *s; s++)
+  806f21:	83 c0 01             	add    $0x1,%eax
+  806f24:	eb f0                	jmp    806f16 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  806f26:	5d                   	pop    %ebp
+  806f27:	c3                   	ret
+
+00806f28 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  806f28:	55                   	push   %ebp
+  806f29:	89 e5                	mov    %esp,%ebp
+  806f2b:	57                   	push   %edi
+  806f2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  806f2f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  806f32:	85 c9                	test   %ecx,%ecx
+  806f34:	74 20                	je     806f56 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  806f36:	89 f8                	mov    %edi,%eax
+  806f38:	09 c8                	or     %ecx,%eax
+  806f3a:	a8 03                	test   $0x3,%al
+  806f3c:	75 12                	jne    806f50 <memset+0x28>
+		c &= 0xFF;
+  806f3e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  806f42:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  806f48:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  806f4b:	fc                   	cld
+  806f4c:	f3 ab                	rep stos %eax,%es:(%edi)
+  806f4e:	eb 06                	jmp    806f56 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  806f50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  806f53:	fc                   	cld
+  806f54:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  806f56:	89 f8                	mov    %edi,%eax
+  806f58:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  806f5b:	c9                   	leave
+  806f5c:	c3                   	ret
+
+00806f5d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  806f5d:	55                   	push   %ebp
+  806f5e:	89 e5                	mov    %esp,%ebp
+  806f60:	57                   	push   %edi
+  806f61:	56                   	push   %esi
+  806f62:	8b 45 08             	mov    0x8(%ebp),%eax
+  806f65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  806f68:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  806f6b:	39 c6                	cmp    %eax,%esi
+  806f6d:	73 32                	jae    806fa1 <memmove+0x44>
+  806f6f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  806f72:	39 d0                	cmp    %edx,%eax
+  806f74:	73 2b                	jae    806fa1 <memmove+0x44>
+		s += n;
+		d += n;
+  806f76:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  806f79:	89 d6                	mov    %edx,%esi
+  806f7b:	09 fe                	or     %edi,%esi
+  806f7d:	09 ce                	or     %ecx,%esi
+  806f7f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  806f85:	75 0e                	jne    806f95 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  806f87:	83 ef 04             	sub    $0x4,%edi
+  806f8a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  806f8d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  806f90:	fd                   	std
+  806f91:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  806f93:	eb 09                	jmp    806f9e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  806f95:	83 ef 01             	sub    $0x1,%edi
+  806f98:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  806f9b:	fd                   	std
+  806f9c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  806f9e:	fc                   	cld
+  806f9f:	eb 1a                	jmp    806fbb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  806fa1:	89 f2                	mov    %esi,%edx
+  806fa3:	09 c2                	or     %eax,%edx
+  806fa5:	09 ca                	or     %ecx,%edx
+  806fa7:	f6 c2 03             	test   $0x3,%dl
+  806faa:	75 0a                	jne    806fb6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  806fac:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  806faf:	89 c7                	mov    %eax,%edi
+  806fb1:	fc                   	cld
+  806fb2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  806fb4:	eb 05                	jmp    806fbb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  806fb6:	89 c7                	mov    %eax,%edi
+  806fb8:	fc                   	cld
+  806fb9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  806fbb:	5e                   	pop    %esi
+  806fbc:	5f                   	pop    %edi
+  806fbd:	5d                   	pop    %ebp
+  806fbe:	c3                   	ret
+
+00806fbf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  806fbf:	55                   	push   %ebp
+  806fc0:	89 e5                	mov    %esp,%ebp
+  806fc2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  806fc5:	ff 75 10             	push   0x10(%ebp)
+  806fc8:	ff 75 0c             	push   0xc(%ebp)
+  806fcb:	ff 75 08             	push   0x8(%ebp)
+  806fce:	e8 8a ff ff ff       	call   806f5d <memmove>
+}
+  806fd3:	c9                   	leave
+  806fd4:	c3                   	ret
+
+00806fd5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  806fd5:	55                   	push   %ebp
+  806fd6:	89 e5                	mov    %esp,%ebp
+  806fd8:	56                   	push   %esi
+  806fd9:	53                   	push   %ebx
+  806fda:	8b 45 08             	mov    0x8(%ebp),%eax
+  806fdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  806fe0:	89 c6                	mov    %eax,%esi
+  806fe2:	03 75 10             	add    0x10(%ebp),%esi
+  806fe5:	eb 06                	jmp    806fed <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  806fe7:	83 c0 01             	add    $0x1,%eax
+  806fea:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  806fed:	39 f0                	cmp    %esi,%eax
+  806fef:	74 14                	je     807005 <memcmp+0x30>
+		if (*s1 != *s2)
+  806ff1:	0f b6 08             	movzbl (%eax),%ecx
+  806ff4:	0f b6 1a             	movzbl (%edx),%ebx
+  806ff7:	38 d9                	cmp    %bl,%cl
+  806ff9:	74 ec                	je     806fe7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  806ffb:	0f b6 c1             	movzbl %cl,%eax
+  806ffe:	0f b6 db             	movzbl %bl,%ebx
+  807001:	29 d8                	sub    %ebx,%eax
+  807003:	eb 05                	jmp    80700a <memcmp+0x35>
+	}
+
+	return 0;
+  807005:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80700a:	5b                   	pop    %ebx
+  80700b:	5e                   	pop    %esi
+  80700c:	5d                   	pop    %ebp
+  80700d:	c3                   	ret
+
+0080700e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80700e:	55                   	push   %ebp
+  80700f:	89 e5                	mov    %esp,%ebp
+  807011:	8b 45 08             	mov    0x8(%ebp),%eax
+  807014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  807017:	89 c2                	mov    %eax,%edx
+  807019:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80701c:	eb 03                	jmp    807021 <memfind+0x13>
+  80701e:	83 c0 01             	add    $0x1,%eax
+  807021:	39 d0                	cmp    %edx,%eax
+  807023:	73 04                	jae    807029 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  807025:	38 08                	cmp    %cl,(%eax)
+  807027:	75 f5                	jne    80701e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  807029:	5d                   	pop    %ebp
+  80702a:	c3                   	ret
+
+0080702b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80702b:	55                   	push   %ebp
+  80702c:	89 e5                	mov    %esp,%ebp
+  80702e:	57                   	push   %edi
+  80702f:	56                   	push   %esi
+  807030:	53                   	push   %ebx
+  807031:	8b 55 08             	mov    0x8(%ebp),%edx
+  807034:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  807037:	eb 03                	jmp    80703c <strtol+0x11>
+		s++;
+  807039:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80703c:	0f b6 02             	movzbl (%edx),%eax
+  80703f:	3c 20                	cmp    $0x20,%al
+  807041:	74 f6                	je     807039 <strtol+0xe>
+  807043:	3c 09                	cmp    $0x9,%al
+  807045:	74 f2                	je     807039 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  807047:	3c 2b                	cmp    $0x2b,%al
+  807049:	74 2a                	je     807075 <strtol+0x4a>
+	int neg = 0;
+  80704b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  807050:	3c 2d                	cmp    $0x2d,%al
+  807052:	74 2b                	je     80707f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  807054:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80705a:	75 0f                	jne    80706b <strtol+0x40>
+  80705c:	80 3a 30             	cmpb   $0x30,(%edx)
+  80705f:	74 28                	je     807089 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  807061:	85 db                	test   %ebx,%ebx
+  807063:	b8 0a 00 00 00       	mov    $0xa,%eax
+  807068:	0f 44 d8             	cmove  %eax,%ebx
+  80706b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807070:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  807073:	eb 46                	jmp    8070bb <strtol+0x90>
+		s++;
+  807075:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  807078:	bf 00 00 00 00       	mov    $0x0,%edi
+  80707d:	eb d5                	jmp    807054 <strtol+0x29>
+		s++, neg = 1;
+  80707f:	83 c2 01             	add    $0x1,%edx
+  807082:	bf 01 00 00 00       	mov    $0x1,%edi
+  807087:	eb cb                	jmp    807054 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  807089:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80708d:	74 0e                	je     80709d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80708f:	85 db                	test   %ebx,%ebx
+  807091:	75 d8                	jne    80706b <strtol+0x40>
+		s++, base = 8;
+  807093:	83 c2 01             	add    $0x1,%edx
+  807096:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80709b:	eb ce                	jmp    80706b <strtol+0x40>
+		s += 2, base = 16;
+  80709d:	83 c2 02             	add    $0x2,%edx
+  8070a0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8070a5:	eb c4                	jmp    80706b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8070a7:	0f be c0             	movsbl %al,%eax
+  8070aa:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8070ad:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8070b0:	7d 3a                	jge    8070ec <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8070b2:	83 c2 01             	add    $0x1,%edx
+  8070b5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8070b9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8070bb:	0f b6 02             	movzbl (%edx),%eax
+  8070be:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8070c1:	89 f3                	mov    %esi,%ebx
+  8070c3:	80 fb 09             	cmp    $0x9,%bl
+  8070c6:	76 df                	jbe    8070a7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8070c8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8070cb:	89 f3                	mov    %esi,%ebx
+  8070cd:	80 fb 19             	cmp    $0x19,%bl
+  8070d0:	77 08                	ja     8070da <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8070d2:	0f be c0             	movsbl %al,%eax
+  8070d5:	83 e8 57             	sub    $0x57,%eax
+  8070d8:	eb d3                	jmp    8070ad <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8070da:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8070dd:	89 f3                	mov    %esi,%ebx
+  8070df:	80 fb 19             	cmp    $0x19,%bl
+  8070e2:	77 08                	ja     8070ec <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8070e4:	0f be c0             	movsbl %al,%eax
+  8070e7:	83 e8 37             	sub    $0x37,%eax
+  8070ea:	eb c1                	jmp    8070ad <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8070ec:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8070f0:	74 05                	je     8070f7 <strtol+0xcc>
+		*endptr = (char *) s;
+  8070f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8070f5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8070f7:	89 c8                	mov    %ecx,%eax
+  8070f9:	f7 d8                	neg    %eax
+  8070fb:	85 ff                	test   %edi,%edi
+  8070fd:	0f 45 c8             	cmovne %eax,%ecx
+}
+  807100:	89 c8                	mov    %ecx,%eax
+  807102:	5b                   	pop    %ebx
+  807103:	5e                   	pop    %esi
+  807104:	5f                   	pop    %edi
+  807105:	5d                   	pop    %ebp
+  807106:	c3                   	ret
+
+00807107 <atoi>:
+
+int
+atoi(const char* s)
+{
+  807107:	55                   	push   %ebp
+  807108:	89 e5                	mov    %esp,%ebp
+  80710a:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  80710d:	6a 00                	push   $0x0
+  80710f:	6a 00                	push   $0x0
+  807111:	ff 75 08             	push   0x8(%ebp)
+  807114:	e8 12 ff ff ff       	call   80702b <strtol>
+}
+  807119:	c9                   	leave
+  80711a:	c3                   	ret
+
+0080711b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80711b:	55                   	push   %ebp
+  80711c:	89 e5                	mov    %esp,%ebp
+  80711e:	57                   	push   %edi
+  80711f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807120:	b8 00 00 00 00       	mov    $0x0,%eax
+  807125:	8b 55 08             	mov    0x8(%ebp),%edx
+  807128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80712b:	89 c3                	mov    %eax,%ebx
+  80712d:	89 c7                	mov    %eax,%edi
+  80712f:	6a 00                	push   $0x0
+  807131:	55                   	push   %ebp
+  807132:	56                   	push   %esi
+  807133:	89 e5                	mov    %esp,%ebp
+  807135:	8d 35 3d 71 80 00    	lea    0x80713d,%esi
+  80713b:	0f 34                	sysenter
+
+0080713d <after_sysenter_label_47>:
+  80713d:	5e                   	pop    %esi
+  80713e:	5d                   	pop    %ebp
+  80713f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  807142:	5b                   	pop    %ebx
+  807143:	5f                   	pop    %edi
+  807144:	5d                   	pop    %ebp
+  807145:	c3                   	ret
+
+00807146 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  807146:	55                   	push   %ebp
+  807147:	89 e5                	mov    %esp,%ebp
+  807149:	57                   	push   %edi
+  80714a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80714b:	ba 00 00 00 00       	mov    $0x0,%edx
+  807150:	b8 01 00 00 00       	mov    $0x1,%eax
+  807155:	89 d1                	mov    %edx,%ecx
+  807157:	89 d3                	mov    %edx,%ebx
+  807159:	89 d7                	mov    %edx,%edi
+  80715b:	6a 00                	push   $0x0
+  80715d:	55                   	push   %ebp
+  80715e:	56                   	push   %esi
+  80715f:	89 e5                	mov    %esp,%ebp
+  807161:	8d 35 69 71 80 00    	lea    0x807169,%esi
+  807167:	0f 34                	sysenter
+
+00807169 <after_sysenter_label_128>:
+  807169:	5e                   	pop    %esi
+  80716a:	5d                   	pop    %ebp
+  80716b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80716e:	5b                   	pop    %ebx
+  80716f:	5f                   	pop    %edi
+  807170:	5d                   	pop    %ebp
+  807171:	c3                   	ret
+
+00807172 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  807172:	55                   	push   %ebp
+  807173:	89 e5                	mov    %esp,%ebp
+  807175:	57                   	push   %edi
+  807176:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807177:	8b 55 08             	mov    0x8(%ebp),%edx
+  80717a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80717f:	b8 03 00 00 00       	mov    $0x3,%eax
+  807184:	89 cb                	mov    %ecx,%ebx
+  807186:	89 cf                	mov    %ecx,%edi
+  807188:	6a 00                	push   $0x0
+  80718a:	55                   	push   %ebp
+  80718b:	56                   	push   %esi
+  80718c:	89 e5                	mov    %esp,%ebp
+  80718e:	8d 35 96 71 80 00    	lea    0x807196,%esi
+  807194:	0f 34                	sysenter
+
+00807196 <after_sysenter_label_212>:
+  807196:	5e                   	pop    %esi
+  807197:	5d                   	pop    %ebp
+  807198:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80719b:	85 c0                	test   %eax,%eax
+  80719d:	7f 07                	jg     8071a6 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80719f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8071a2:	5b                   	pop    %ebx
+  8071a3:	5f                   	pop    %edi
+  8071a4:	5d                   	pop    %ebp
+  8071a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8071a6:	83 ec 0c             	sub    $0xc,%esp
+  8071a9:	50                   	push   %eax
+  8071aa:	6a 03                	push   $0x3
+  8071ac:	68 15 bd 80 00       	push   $0x80bd15
+  8071b1:	6a 54                	push   $0x54
+  8071b3:	68 32 bd 80 00       	push   $0x80bd32
+  8071b8:	e8 5b f5 ff ff       	call   806718 <_panic>
+
+008071bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8071bd:	55                   	push   %ebp
+  8071be:	89 e5                	mov    %esp,%ebp
+  8071c0:	57                   	push   %edi
+  8071c1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8071c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8071c7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8071cc:	89 d1                	mov    %edx,%ecx
+  8071ce:	89 d3                	mov    %edx,%ebx
+  8071d0:	89 d7                	mov    %edx,%edi
+  8071d2:	6a 00                	push   $0x0
+  8071d4:	55                   	push   %ebp
+  8071d5:	56                   	push   %esi
+  8071d6:	89 e5                	mov    %esp,%ebp
+  8071d8:	8d 35 e0 71 80 00    	lea    0x8071e0,%esi
+  8071de:	0f 34                	sysenter
+
+008071e0 <after_sysenter_label_309>:
+  8071e0:	5e                   	pop    %esi
+  8071e1:	5d                   	pop    %ebp
+  8071e2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8071e5:	5b                   	pop    %ebx
+  8071e6:	5f                   	pop    %edi
+  8071e7:	5d                   	pop    %ebp
+  8071e8:	c3                   	ret
+
+008071e9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8071e9:	55                   	push   %ebp
+  8071ea:	89 e5                	mov    %esp,%ebp
+  8071ec:	57                   	push   %edi
+  8071ed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8071ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8071f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8071f8:	89 d1                	mov    %edx,%ecx
+  8071fa:	89 d3                	mov    %edx,%ebx
+  8071fc:	89 d7                	mov    %edx,%edi
+  8071fe:	6a 00                	push   $0x0
+  807200:	55                   	push   %ebp
+  807201:	56                   	push   %esi
+  807202:	89 e5                	mov    %esp,%ebp
+  807204:	8d 35 0c 72 80 00    	lea    0x80720c,%esi
+  80720a:	0f 34                	sysenter
+
+0080720c <after_sysenter_label_391>:
+  80720c:	5e                   	pop    %esi
+  80720d:	5d                   	pop    %ebp
+  80720e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  807211:	5b                   	pop    %ebx
+  807212:	5f                   	pop    %edi
+  807213:	5d                   	pop    %ebp
+  807214:	c3                   	ret
+
+00807215 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  807215:	55                   	push   %ebp
+  807216:	89 e5                	mov    %esp,%ebp
+  807218:	57                   	push   %edi
+  807219:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80721a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80721d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807220:	b8 04 00 00 00       	mov    $0x4,%eax
+  807225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80722a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80722d:	6a 00                	push   $0x0
+  80722f:	55                   	push   %ebp
+  807230:	56                   	push   %esi
+  807231:	89 e5                	mov    %esp,%ebp
+  807233:	8d 35 3b 72 80 00    	lea    0x80723b,%esi
+  807239:	0f 34                	sysenter
+
+0080723b <after_sysenter_label_479>:
+  80723b:	5e                   	pop    %esi
+  80723c:	5d                   	pop    %ebp
+  80723d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  807240:	85 c0                	test   %eax,%eax
+  807242:	7f 07                	jg     80724b <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  807244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807247:	5b                   	pop    %ebx
+  807248:	5f                   	pop    %edi
+  807249:	5d                   	pop    %ebp
+  80724a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80724b:	83 ec 0c             	sub    $0xc,%esp
+  80724e:	50                   	push   %eax
+  80724f:	6a 04                	push   $0x4
+  807251:	68 15 bd 80 00       	push   $0x80bd15
+  807256:	6a 54                	push   $0x54
+  807258:	68 32 bd 80 00       	push   $0x80bd32
+  80725d:	e8 b6 f4 ff ff       	call   806718 <_panic>
+
+00807262 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  807262:	55                   	push   %ebp
+  807263:	89 e5                	mov    %esp,%ebp
+  807265:	57                   	push   %edi
+  807266:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807267:	8b 55 08             	mov    0x8(%ebp),%edx
+  80726a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80726d:	b8 05 00 00 00       	mov    $0x5,%eax
+  807272:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807275:	8b 7d 14             	mov    0x14(%ebp),%edi
+  807278:	ff 75 18             	push   0x18(%ebp)
+  80727b:	55                   	push   %ebp
+  80727c:	56                   	push   %esi
+  80727d:	89 e5                	mov    %esp,%ebp
+  80727f:	8d 35 87 72 80 00    	lea    0x807287,%esi
+  807285:	0f 34                	sysenter
+
+00807287 <after_sysenter_label_593>:
+  807287:	5e                   	pop    %esi
+  807288:	5d                   	pop    %ebp
+  807289:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80728c:	85 c0                	test   %eax,%eax
+  80728e:	7f 07                	jg     807297 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  807290:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807293:	5b                   	pop    %ebx
+  807294:	5f                   	pop    %edi
+  807295:	5d                   	pop    %ebp
+  807296:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  807297:	83 ec 0c             	sub    $0xc,%esp
+  80729a:	50                   	push   %eax
+  80729b:	6a 05                	push   $0x5
+  80729d:	68 15 bd 80 00       	push   $0x80bd15
+  8072a2:	6a 54                	push   $0x54
+  8072a4:	68 32 bd 80 00       	push   $0x80bd32
+  8072a9:	e8 6a f4 ff ff       	call   806718 <_panic>
+
+008072ae <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8072ae:	55                   	push   %ebp
+  8072af:	89 e5                	mov    %esp,%ebp
+  8072b1:	57                   	push   %edi
+  8072b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8072b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8072b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8072bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8072be:	b8 06 00 00 00       	mov    $0x6,%eax
+  8072c3:	89 df                	mov    %ebx,%edi
+  8072c5:	6a 00                	push   $0x0
+  8072c7:	55                   	push   %ebp
+  8072c8:	56                   	push   %esi
+  8072c9:	89 e5                	mov    %esp,%ebp
+  8072cb:	8d 35 d3 72 80 00    	lea    0x8072d3,%esi
+  8072d1:	0f 34                	sysenter
+
+008072d3 <after_sysenter_label_704>:
+  8072d3:	5e                   	pop    %esi
+  8072d4:	5d                   	pop    %ebp
+  8072d5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8072d8:	85 c0                	test   %eax,%eax
+  8072da:	7f 07                	jg     8072e3 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8072dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8072df:	5b                   	pop    %ebx
+  8072e0:	5f                   	pop    %edi
+  8072e1:	5d                   	pop    %ebp
+  8072e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8072e3:	83 ec 0c             	sub    $0xc,%esp
+  8072e6:	50                   	push   %eax
+  8072e7:	6a 06                	push   $0x6
+  8072e9:	68 15 bd 80 00       	push   $0x80bd15
+  8072ee:	6a 54                	push   $0x54
+  8072f0:	68 32 bd 80 00       	push   $0x80bd32
+  8072f5:	e8 1e f4 ff ff       	call   806718 <_panic>
+
+008072fa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8072fa:	55                   	push   %ebp
+  8072fb:	89 e5                	mov    %esp,%ebp
+  8072fd:	57                   	push   %edi
+  8072fe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8072ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807304:	8b 55 08             	mov    0x8(%ebp),%edx
+  807307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80730a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80730f:	89 df                	mov    %ebx,%edi
+  807311:	6a 00                	push   $0x0
+  807313:	55                   	push   %ebp
+  807314:	56                   	push   %esi
+  807315:	89 e5                	mov    %esp,%ebp
+  807317:	8d 35 1f 73 80 00    	lea    0x80731f,%esi
+  80731d:	0f 34                	sysenter
+
+0080731f <after_sysenter_label_808>:
+  80731f:	5e                   	pop    %esi
+  807320:	5d                   	pop    %ebp
+  807321:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  807324:	85 c0                	test   %eax,%eax
+  807326:	7f 07                	jg     80732f <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  807328:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80732b:	5b                   	pop    %ebx
+  80732c:	5f                   	pop    %edi
+  80732d:	5d                   	pop    %ebp
+  80732e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80732f:	83 ec 0c             	sub    $0xc,%esp
+  807332:	50                   	push   %eax
+  807333:	6a 08                	push   $0x8
+  807335:	68 15 bd 80 00       	push   $0x80bd15
+  80733a:	6a 54                	push   $0x54
+  80733c:	68 32 bd 80 00       	push   $0x80bd32
+  807341:	e8 d2 f3 ff ff       	call   806718 <_panic>
+
+00807346 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  807346:	55                   	push   %ebp
+  807347:	89 e5                	mov    %esp,%ebp
+  807349:	57                   	push   %edi
+  80734a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80734b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807350:	8b 55 08             	mov    0x8(%ebp),%edx
+  807353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807356:	b8 09 00 00 00       	mov    $0x9,%eax
+  80735b:	89 df                	mov    %ebx,%edi
+  80735d:	6a 00                	push   $0x0
+  80735f:	55                   	push   %ebp
+  807360:	56                   	push   %esi
+  807361:	89 e5                	mov    %esp,%ebp
+  807363:	8d 35 6b 73 80 00    	lea    0x80736b,%esi
+  807369:	0f 34                	sysenter
+
+0080736b <after_sysenter_label_912>:
+  80736b:	5e                   	pop    %esi
+  80736c:	5d                   	pop    %ebp
+  80736d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  807370:	85 c0                	test   %eax,%eax
+  807372:	7f 07                	jg     80737b <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  807374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807377:	5b                   	pop    %ebx
+  807378:	5f                   	pop    %edi
+  807379:	5d                   	pop    %ebp
+  80737a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80737b:	83 ec 0c             	sub    $0xc,%esp
+  80737e:	50                   	push   %eax
+  80737f:	6a 09                	push   $0x9
+  807381:	68 15 bd 80 00       	push   $0x80bd15
+  807386:	6a 54                	push   $0x54
+  807388:	68 32 bd 80 00       	push   $0x80bd32
+  80738d:	e8 86 f3 ff ff       	call   806718 <_panic>
+
+00807392 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  807392:	55                   	push   %ebp
+  807393:	89 e5                	mov    %esp,%ebp
+  807395:	57                   	push   %edi
+  807396:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807397:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80739c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80739f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8073a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8073a7:	89 df                	mov    %ebx,%edi
+  8073a9:	6a 00                	push   $0x0
+  8073ab:	55                   	push   %ebp
+  8073ac:	56                   	push   %esi
+  8073ad:	89 e5                	mov    %esp,%ebp
+  8073af:	8d 35 b7 73 80 00    	lea    0x8073b7,%esi
+  8073b5:	0f 34                	sysenter
+
+008073b7 <after_sysenter_label_1016>:
+  8073b7:	5e                   	pop    %esi
+  8073b8:	5d                   	pop    %ebp
+  8073b9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8073bc:	85 c0                	test   %eax,%eax
+  8073be:	7f 07                	jg     8073c7 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8073c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8073c3:	5b                   	pop    %ebx
+  8073c4:	5f                   	pop    %edi
+  8073c5:	5d                   	pop    %ebp
+  8073c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8073c7:	83 ec 0c             	sub    $0xc,%esp
+  8073ca:	50                   	push   %eax
+  8073cb:	6a 0a                	push   $0xa
+  8073cd:	68 15 bd 80 00       	push   $0x80bd15
+  8073d2:	6a 54                	push   $0x54
+  8073d4:	68 32 bd 80 00       	push   $0x80bd32
+  8073d9:	e8 3a f3 ff ff       	call   806718 <_panic>
+
+008073de <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8073de:	55                   	push   %ebp
+  8073df:	89 e5                	mov    %esp,%ebp
+  8073e1:	57                   	push   %edi
+  8073e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8073e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8073e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8073e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8073ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8073f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8073f4:	6a 00                	push   $0x0
+  8073f6:	55                   	push   %ebp
+  8073f7:	56                   	push   %esi
+  8073f8:	89 e5                	mov    %esp,%ebp
+  8073fa:	8d 35 02 74 80 00    	lea    0x807402,%esi
+  807400:	0f 34                	sysenter
+
+00807402 <after_sysenter_label_1126>:
+  807402:	5e                   	pop    %esi
+  807403:	5d                   	pop    %ebp
+  807404:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  807407:	5b                   	pop    %ebx
+  807408:	5f                   	pop    %edi
+  807409:	5d                   	pop    %ebp
+  80740a:	c3                   	ret
+
+0080740b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80740b:	55                   	push   %ebp
+  80740c:	89 e5                	mov    %esp,%ebp
+  80740e:	57                   	push   %edi
+  80740f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807410:	8b 55 08             	mov    0x8(%ebp),%edx
+  807413:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807418:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80741d:	89 cb                	mov    %ecx,%ebx
+  80741f:	89 cf                	mov    %ecx,%edi
+  807421:	6a 00                	push   $0x0
+  807423:	55                   	push   %ebp
+  807424:	56                   	push   %esi
+  807425:	89 e5                	mov    %esp,%ebp
+  807427:	8d 35 2f 74 80 00    	lea    0x80742f,%esi
+  80742d:	0f 34                	sysenter
+
+0080742f <after_sysenter_label_1210>:
+  80742f:	5e                   	pop    %esi
+  807430:	5d                   	pop    %ebp
+  807431:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  807434:	85 c0                	test   %eax,%eax
+  807436:	7f 07                	jg     80743f <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  807438:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80743b:	5b                   	pop    %ebx
+  80743c:	5f                   	pop    %edi
+  80743d:	5d                   	pop    %ebp
+  80743e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80743f:	83 ec 0c             	sub    $0xc,%esp
+  807442:	50                   	push   %eax
+  807443:	6a 0d                	push   $0xd
+  807445:	68 15 bd 80 00       	push   $0x80bd15
+  80744a:	6a 54                	push   $0x54
+  80744c:	68 32 bd 80 00       	push   $0x80bd32
+  807451:	e8 c2 f2 ff ff       	call   806718 <_panic>
+
+00807456 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  807456:	55                   	push   %ebp
+  807457:	89 e5                	mov    %esp,%ebp
+  807459:	57                   	push   %edi
+  80745a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80745b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807460:	8b 55 08             	mov    0x8(%ebp),%edx
+  807463:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807466:	b8 42 00 00 00       	mov    $0x42,%eax
+  80746b:	89 df                	mov    %ebx,%edi
+  80746d:	6a 00                	push   $0x0
+  80746f:	55                   	push   %ebp
+  807470:	56                   	push   %esi
+  807471:	89 e5                	mov    %esp,%ebp
+  807473:	8d 35 7b 74 80 00    	lea    0x80747b,%esi
+  807479:	0f 34                	sysenter
+
+0080747b <after_sysenter_label_1311>:
+  80747b:	5e                   	pop    %esi
+  80747c:	5d                   	pop    %ebp
+  80747d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  807480:	85 c0                	test   %eax,%eax
+  807482:	7f 07                	jg     80748b <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  807484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807487:	5b                   	pop    %ebx
+  807488:	5f                   	pop    %edi
+  807489:	5d                   	pop    %ebp
+  80748a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80748b:	83 ec 0c             	sub    $0xc,%esp
+  80748e:	50                   	push   %eax
+  80748f:	6a 42                	push   $0x42
+  807491:	68 15 bd 80 00       	push   $0x80bd15
+  807496:	6a 54                	push   $0x54
+  807498:	68 32 bd 80 00       	push   $0x80bd32
+  80749d:	e8 76 f2 ff ff       	call   806718 <_panic>
+
+008074a2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8074a2:	55                   	push   %ebp
+  8074a3:	89 e5                	mov    %esp,%ebp
+  8074a5:	57                   	push   %edi
+  8074a6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8074a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8074ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8074b1:	89 d1                	mov    %edx,%ecx
+  8074b3:	89 d3                	mov    %edx,%ebx
+  8074b5:	89 d7                	mov    %edx,%edi
+  8074b7:	6a 00                	push   $0x0
+  8074b9:	55                   	push   %ebp
+  8074ba:	56                   	push   %esi
+  8074bb:	89 e5                	mov    %esp,%ebp
+  8074bd:	8d 35 c5 74 80 00    	lea    0x8074c5,%esi
+  8074c3:	0f 34                	sysenter
+
+008074c5 <after_sysenter_label_1411>:
+  8074c5:	5e                   	pop    %esi
+  8074c6:	5d                   	pop    %ebp
+  8074c7:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8074ca:	5b                   	pop    %ebx
+  8074cb:	5f                   	pop    %edi
+  8074cc:	5d                   	pop    %ebp
+  8074cd:	c3                   	ret
+
+008074ce <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8074ce:	55                   	push   %ebp
+  8074cf:	89 e5                	mov    %esp,%ebp
+  8074d1:	57                   	push   %edi
+  8074d2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8074d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8074d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8074db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8074de:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8074e3:	89 df                	mov    %ebx,%edi
+  8074e5:	6a 00                	push   $0x0
+  8074e7:	55                   	push   %ebp
+  8074e8:	56                   	push   %esi
+  8074e9:	89 e5                	mov    %esp,%ebp
+  8074eb:	8d 35 f3 74 80 00    	lea    0x8074f3,%esi
+  8074f1:	0f 34                	sysenter
+
+008074f3 <after_sysenter_label_1497>:
+  8074f3:	5e                   	pop    %esi
+  8074f4:	5d                   	pop    %ebp
+  8074f5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8074f8:	5b                   	pop    %ebx
+  8074f9:	5f                   	pop    %edi
+  8074fa:	5d                   	pop    %ebp
+  8074fb:	c3                   	ret
+
+008074fc <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8074fc:	55                   	push   %ebp
+  8074fd:	89 e5                	mov    %esp,%ebp
+  8074ff:	57                   	push   %edi
+  807500:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807506:	8b 55 08             	mov    0x8(%ebp),%edx
+  807509:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80750c:	b8 10 00 00 00       	mov    $0x10,%eax
+  807511:	89 df                	mov    %ebx,%edi
+  807513:	6a 00                	push   $0x0
+  807515:	55                   	push   %ebp
+  807516:	56                   	push   %esi
+  807517:	89 e5                	mov    %esp,%ebp
+  807519:	8d 35 21 75 80 00    	lea    0x807521,%esi
+  80751f:	0f 34                	sysenter
+
+00807521 <after_sysenter_label_1583>:
+  807521:	5e                   	pop    %esi
+  807522:	5d                   	pop    %ebp
+  807523:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  807526:	5b                   	pop    %ebx
+  807527:	5f                   	pop    %edi
+  807528:	5d                   	pop    %ebp
+  807529:	c3                   	ret
+
+0080752a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80752a:	55                   	push   %ebp
+  80752b:	89 e5                	mov    %esp,%ebp
+  80752d:	57                   	push   %edi
+  80752e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80752f:	8b 55 08             	mov    0x8(%ebp),%edx
+  807532:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807535:	b8 11 00 00 00       	mov    $0x11,%eax
+  80753a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80753f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807542:	6a 00                	push   $0x0
+  807544:	55                   	push   %ebp
+  807545:	56                   	push   %esi
+  807546:	89 e5                	mov    %esp,%ebp
+  807548:	8d 35 50 75 80 00    	lea    0x807550,%esi
+  80754e:	0f 34                	sysenter
+
+00807550 <after_sysenter_label_1672>:
+  807550:	5e                   	pop    %esi
+  807551:	5d                   	pop    %ebp
+  807552:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  807555:	5b                   	pop    %ebx
+  807556:	5f                   	pop    %edi
+  807557:	5d                   	pop    %ebp
+  807558:	c3                   	ret
+
+00807559 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  807559:	55                   	push   %ebp
+  80755a:	89 e5                	mov    %esp,%ebp
+  80755c:	57                   	push   %edi
+  80755d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80755e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807563:	8b 55 08             	mov    0x8(%ebp),%edx
+  807566:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807569:	b8 12 00 00 00       	mov    $0x12,%eax
+  80756e:	89 df                	mov    %ebx,%edi
+  807570:	6a 00                	push   $0x0
+  807572:	55                   	push   %ebp
+  807573:	56                   	push   %esi
+  807574:	89 e5                	mov    %esp,%ebp
+  807576:	8d 35 7e 75 80 00    	lea    0x80757e,%esi
+  80757c:	0f 34                	sysenter
+
+0080757e <after_sysenter_label_1758>:
+  80757e:	5e                   	pop    %esi
+  80757f:	5d                   	pop    %ebp
+  807580:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  807583:	5b                   	pop    %ebx
+  807584:	5f                   	pop    %edi
+  807585:	5d                   	pop    %ebp
+  807586:	c3                   	ret
+
+00807587 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  807587:	55                   	push   %ebp
+  807588:	89 e5                	mov    %esp,%ebp
+  80758a:	57                   	push   %edi
+  80758b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80758c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80758f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807594:	b8 13 00 00 00       	mov    $0x13,%eax
+  807599:	89 cb                	mov    %ecx,%ebx
+  80759b:	89 cf                	mov    %ecx,%edi
+  80759d:	6a 00                	push   $0x0
+  80759f:	55                   	push   %ebp
+  8075a0:	56                   	push   %esi
+  8075a1:	89 e5                	mov    %esp,%ebp
+  8075a3:	8d 35 ab 75 80 00    	lea    0x8075ab,%esi
+  8075a9:	0f 34                	sysenter
+
+008075ab <after_sysenter_label_1842>:
+  8075ab:	5e                   	pop    %esi
+  8075ac:	5d                   	pop    %ebp
+  8075ad:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8075b0:	85 c0                	test   %eax,%eax
+  8075b2:	7f 07                	jg     8075bb <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8075b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8075b7:	5b                   	pop    %ebx
+  8075b8:	5f                   	pop    %edi
+  8075b9:	5d                   	pop    %ebp
+  8075ba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8075bb:	83 ec 0c             	sub    $0xc,%esp
+  8075be:	50                   	push   %eax
+  8075bf:	6a 13                	push   $0x13
+  8075c1:	68 15 bd 80 00       	push   $0x80bd15
+  8075c6:	6a 54                	push   $0x54
+  8075c8:	68 32 bd 80 00       	push   $0x80bd32
+  8075cd:	e8 46 f1 ff ff       	call   806718 <_panic>
+
+008075d2 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8075d2:	55                   	push   %ebp
+  8075d3:	89 e5                	mov    %esp,%ebp
+  8075d5:	57                   	push   %edi
+  8075d6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8075d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8075dc:	b8 14 00 00 00       	mov    $0x14,%eax
+  8075e1:	89 d1                	mov    %edx,%ecx
+  8075e3:	89 d3                	mov    %edx,%ebx
+  8075e5:	89 d7                	mov    %edx,%edi
+  8075e7:	6a 00                	push   $0x0
+  8075e9:	55                   	push   %ebp
+  8075ea:	56                   	push   %esi
+  8075eb:	89 e5                	mov    %esp,%ebp
+  8075ed:	8d 35 f5 75 80 00    	lea    0x8075f5,%esi
+  8075f3:	0f 34                	sysenter
+
+008075f5 <after_sysenter_label_1939>:
+  8075f5:	5e                   	pop    %esi
+  8075f6:	5d                   	pop    %ebp
+  8075f7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8075fa:	5b                   	pop    %ebx
+  8075fb:	5f                   	pop    %edi
+  8075fc:	5d                   	pop    %ebp
+  8075fd:	c3                   	ret
+
+008075fe <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8075fe:	55                   	push   %ebp
+  8075ff:	89 e5                	mov    %esp,%ebp
+  807601:	57                   	push   %edi
+  807602:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807603:	8b 55 08             	mov    0x8(%ebp),%edx
+  807606:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807609:	b8 15 00 00 00       	mov    $0x15,%eax
+  80760e:	bf 00 00 00 00       	mov    $0x0,%edi
+  807613:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807616:	6a 00                	push   $0x0
+  807618:	55                   	push   %ebp
+  807619:	56                   	push   %esi
+  80761a:	89 e5                	mov    %esp,%ebp
+  80761c:	8d 35 24 76 80 00    	lea    0x807624,%esi
+  807622:	0f 34                	sysenter
+
+00807624 <after_sysenter_label_2028>:
+  807624:	5e                   	pop    %esi
+  807625:	5d                   	pop    %ebp
+  807626:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  807629:	5b                   	pop    %ebx
+  80762a:	5f                   	pop    %edi
+  80762b:	5d                   	pop    %ebp
+  80762c:	c3                   	ret
+
+0080762d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80762d:	55                   	push   %ebp
+  80762e:	89 e5                	mov    %esp,%ebp
+  807630:	57                   	push   %edi
+  807631:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80763a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80763d:	b8 16 00 00 00       	mov    $0x16,%eax
+  807642:	89 df                	mov    %ebx,%edi
+  807644:	6a 00                	push   $0x0
+  807646:	55                   	push   %ebp
+  807647:	56                   	push   %esi
+  807648:	89 e5                	mov    %esp,%ebp
+  80764a:	8d 35 52 76 80 00    	lea    0x807652,%esi
+  807650:	0f 34                	sysenter
+
+00807652 <after_sysenter_label_2114>:
+  807652:	5e                   	pop    %esi
+  807653:	5d                   	pop    %ebp
+  807654:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  807657:	5b                   	pop    %ebx
+  807658:	5f                   	pop    %edi
+  807659:	5d                   	pop    %ebp
+  80765a:	c3                   	ret
+
+0080765b <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80765b:	55                   	push   %ebp
+  80765c:	89 e5                	mov    %esp,%ebp
+  80765e:	57                   	push   %edi
+  80765f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  807660:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807665:	8b 55 08             	mov    0x8(%ebp),%edx
+  807668:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80766b:	b8 17 00 00 00       	mov    $0x17,%eax
+  807670:	89 df                	mov    %ebx,%edi
+  807672:	6a 00                	push   $0x0
+  807674:	55                   	push   %ebp
+  807675:	56                   	push   %esi
+  807676:	89 e5                	mov    %esp,%ebp
+  807678:	8d 35 80 76 80 00    	lea    0x807680,%esi
+  80767e:	0f 34                	sysenter
+
+00807680 <after_sysenter_label_2200>:
+  807680:	5e                   	pop    %esi
+  807681:	5d                   	pop    %ebp
+  807682:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  807685:	5b                   	pop    %ebx
+  807686:	5f                   	pop    %edi
+  807687:	5d                   	pop    %ebp
+  807688:	c3                   	ret
+
+00807689 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  807689:	55                   	push   %ebp
+  80768a:	89 e5                	mov    %esp,%ebp
+  80768c:	57                   	push   %edi
+  80768d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80768e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807693:	8b 55 08             	mov    0x8(%ebp),%edx
+  807696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807699:	b8 18 00 00 00       	mov    $0x18,%eax
+  80769e:	89 df                	mov    %ebx,%edi
+  8076a0:	6a 00                	push   $0x0
+  8076a2:	55                   	push   %ebp
+  8076a3:	56                   	push   %esi
+  8076a4:	89 e5                	mov    %esp,%ebp
+  8076a6:	8d 35 ae 76 80 00    	lea    0x8076ae,%esi
+  8076ac:	0f 34                	sysenter
+
+008076ae <after_sysenter_label_2286>:
+  8076ae:	5e                   	pop    %esi
+  8076af:	5d                   	pop    %ebp
+  8076b0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8076b3:	5b                   	pop    %ebx
+  8076b4:	5f                   	pop    %edi
+  8076b5:	5d                   	pop    %ebp
+  8076b6:	c3                   	ret
+
+008076b7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8076b7:	55                   	push   %ebp
+  8076b8:	89 e5                	mov    %esp,%ebp
+  8076ba:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8076bd:	83 3d 44 c4 84 00 00 	cmpl   $0x0,0x84c444
+  8076c4:	74 0a                	je     8076d0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8076c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8076c9:	a3 44 c4 84 00       	mov    %eax,0x84c444
+}
+  8076ce:	c9                   	leave
+  8076cf:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8076d0:	83 ec 04             	sub    $0x4,%esp
+  8076d3:	6a 07                	push   $0x7
+  8076d5:	68 00 f0 bf ee       	push   $0xeebff000
+  8076da:	6a 00                	push   $0x0
+  8076dc:	e8 34 fb ff ff       	call   807215 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8076e1:	83 c4 08             	add    $0x8,%esp
+  8076e4:	68 f5 76 80 00       	push   $0x8076f5
+  8076e9:	6a 00                	push   $0x0
+  8076eb:	e8 a2 fc ff ff       	call   807392 <sys_env_set_pgfault_upcall>
+  8076f0:	83 c4 10             	add    $0x10,%esp
+  8076f3:	eb d1                	jmp    8076c6 <set_pgfault_handler+0xf>
+
+008076f5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8076f5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8076f6:	a1 44 c4 84 00       	mov    0x84c444,%eax
+	call *%eax
+  8076fb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8076fd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  807700:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  807704:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  807708:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80770b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80770f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  807711:	83 c4 08             	add    $0x8,%esp
+	popal
+  807714:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  807715:	83 c4 04             	add    $0x4,%esp
+	popfl
+  807718:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  807719:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80771a:	c3                   	ret
+
+0080771b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80771b:	55                   	push   %ebp
+  80771c:	89 e5                	mov    %esp,%ebp
+  80771e:	57                   	push   %edi
+  80771f:	56                   	push   %esi
+  807720:	53                   	push   %ebx
+  807721:	83 ec 18             	sub    $0x18,%esp
+  807724:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807727:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80772a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80772d:	85 c0                	test   %eax,%eax
+  80772f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  807734:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  807737:	50                   	push   %eax
+  807738:	e8 ce fc ff ff       	call   80740b <sys_ipc_recv>
+	if (r < 0) {
+  80773d:	83 c4 10             	add    $0x10,%esp
+  807740:	85 c0                	test   %eax,%eax
+  807742:	78 2b                	js     80776f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  807744:	85 ff                	test   %edi,%edi
+  807746:	74 55                	je     80779d <ipc_recv+0x82>
+  807748:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80774a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  807750:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  807755:	77 39                	ja     807790 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  807757:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80775c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80775e:	c1 e8 10             	shr    $0x10,%eax
+  807761:	74 2d                	je     807790 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  807763:	c1 e0 10             	shl    $0x10,%eax
+  807766:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80776b:	29 c2                	sub    %eax,%edx
+  80776d:	eb 27                	jmp    807796 <ipc_recv+0x7b>
+  80776f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  807771:	83 ec 08             	sub    $0x8,%esp
+  807774:	50                   	push   %eax
+  807775:	68 40 bd 80 00       	push   $0x80bd40
+  80777a:	e8 74 f0 ff ff       	call   8067f3 <cprintf>
+		*from_env_store = 0;
+  80777f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  807785:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80778b:	83 c4 10             	add    $0x10,%esp
+  80778e:	eb 77                	jmp    807807 <ipc_recv+0xec>
+		return pthread_main_tls;
+  807790:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  807796:	8b 02                	mov    (%edx),%eax
+  807798:	8b 40 78             	mov    0x78(%eax),%eax
+  80779b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80779d:	85 f6                	test   %esi,%esi
+  80779f:	74 34                	je     8077d5 <ipc_recv+0xba>
+  8077a1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8077a3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8077a9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8077ae:	77 18                	ja     8077c8 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8077b0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8077b5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8077b7:	c1 e8 10             	shr    $0x10,%eax
+  8077ba:	74 0c                	je     8077c8 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8077bc:	c1 e0 10             	shl    $0x10,%eax
+  8077bf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8077c4:	29 c2                	sub    %eax,%edx
+  8077c6:	eb 06                	jmp    8077ce <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8077c8:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8077ce:	8b 02                	mov    (%edx),%eax
+  8077d0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8077d3:	89 06                	mov    %eax,(%esi)
+  8077d5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8077d7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8077dd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8077e2:	77 18                	ja     8077fc <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8077e4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8077e9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8077eb:	c1 e8 10             	shr    $0x10,%eax
+  8077ee:	74 0c                	je     8077fc <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8077f0:	c1 e0 10             	shl    $0x10,%eax
+  8077f3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8077f8:	29 c2                	sub    %eax,%edx
+  8077fa:	eb 06                	jmp    807802 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8077fc:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+	}
+	return thisenv->env_ipc_value;
+  807802:	8b 02                	mov    (%edx),%eax
+  807804:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  807807:	89 d8                	mov    %ebx,%eax
+  807809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80780c:	5b                   	pop    %ebx
+  80780d:	5e                   	pop    %esi
+  80780e:	5f                   	pop    %edi
+  80780f:	5d                   	pop    %ebp
+  807810:	c3                   	ret
+
+00807811 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  807811:	55                   	push   %ebp
+  807812:	89 e5                	mov    %esp,%ebp
+  807814:	57                   	push   %edi
+  807815:	56                   	push   %esi
+  807816:	53                   	push   %ebx
+  807817:	83 ec 0c             	sub    $0xc,%esp
+  80781a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80781d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807820:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  807823:	85 db                	test   %ebx,%ebx
+  807825:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80782a:	0f 44 d8             	cmove  %eax,%ebx
+  80782d:	eb 05                	jmp    807834 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80782f:	e8 b5 f9 ff ff       	call   8071e9 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  807834:	57                   	push   %edi
+  807835:	53                   	push   %ebx
+  807836:	ff 75 0c             	push   0xc(%ebp)
+  807839:	56                   	push   %esi
+  80783a:	e8 9f fb ff ff       	call   8073de <sys_ipc_try_send>
+		if (r == 0) {
+  80783f:	83 c4 10             	add    $0x10,%esp
+  807842:	85 c0                	test   %eax,%eax
+  807844:	74 19                	je     80785f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  807846:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  807849:	74 e4                	je     80782f <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80784b:	83 ec 0c             	sub    $0xc,%esp
+  80784e:	50                   	push   %eax
+  80784f:	57                   	push   %edi
+  807850:	53                   	push   %ebx
+  807851:	56                   	push   %esi
+  807852:	68 5c bd 80 00       	push   $0x80bd5c
+  807857:	e8 97 ef ff ff       	call   8067f3 <cprintf>
+			return;
+  80785c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80785f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807862:	5b                   	pop    %ebx
+  807863:	5e                   	pop    %esi
+  807864:	5f                   	pop    %edi
+  807865:	5d                   	pop    %ebp
+  807866:	c3                   	ret
+
+00807867 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  807867:	55                   	push   %ebp
+  807868:	89 e5                	mov    %esp,%ebp
+  80786a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80786d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  807872:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  807875:	c1 e0 04             	shl    $0x4,%eax
+  807878:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80787d:	8b 40 50             	mov    0x50(%eax),%eax
+  807880:	39 c8                	cmp    %ecx,%eax
+  807882:	74 12                	je     807896 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  807884:	83 c2 01             	add    $0x1,%edx
+  807887:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80788d:	75 e3                	jne    807872 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80788f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807894:	eb 0e                	jmp    8078a4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  807896:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  807899:	c1 e0 04             	shl    $0x4,%eax
+  80789c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8078a1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8078a4:	5d                   	pop    %ebp
+  8078a5:	c3                   	ret
+
+008078a6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8078a6:	55                   	push   %ebp
+  8078a7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8078a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8078ac:	05 00 00 00 30       	add    $0x30000000,%eax
+  8078b1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8078b4:	5d                   	pop    %ebp
+  8078b5:	c3                   	ret
+
+008078b6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8078b6:	55                   	push   %ebp
+  8078b7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8078b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8078bc:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8078c1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8078c6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8078cb:	5d                   	pop    %ebp
+  8078cc:	c3                   	ret
+
+008078cd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8078cd:	55                   	push   %ebp
+  8078ce:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8078d0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8078d5:	eb 02                	jmp    8078d9 <fd_alloc+0xc>
+  8078d7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8078d9:	89 c2                	mov    %eax,%edx
+  8078db:	c1 ea 16             	shr    $0x16,%edx
+  8078de:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8078e5:	f6 c2 01             	test   $0x1,%dl
+  8078e8:	74 2b                	je     807915 <fd_alloc+0x48>
+  8078ea:	89 c2                	mov    %eax,%edx
+  8078ec:	c1 ea 0c             	shr    $0xc,%edx
+  8078ef:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8078f6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8078fc:	f6 c1 01             	test   $0x1,%cl
+  8078ff:	74 14                	je     807915 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  807901:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  807907:	75 ce                	jne    8078d7 <fd_alloc+0xa>
+  807909:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80790e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  807913:	eb 05                	jmp    80791a <fd_alloc+0x4d>
+			return 0;
+  807915:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80791a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80791d:	89 02                	mov    %eax,(%edx)
+}
+  80791f:	89 c8                	mov    %ecx,%eax
+  807921:	5d                   	pop    %ebp
+  807922:	c3                   	ret
+
+00807923 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  807923:	55                   	push   %ebp
+  807924:	89 e5                	mov    %esp,%ebp
+  807926:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  807929:	83 f8 1f             	cmp    $0x1f,%eax
+  80792c:	77 30                	ja     80795e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80792e:	c1 e0 0c             	shl    $0xc,%eax
+  807931:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  807936:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80793c:	f6 c2 01             	test   $0x1,%dl
+  80793f:	74 24                	je     807965 <fd_lookup+0x42>
+  807941:	89 c2                	mov    %eax,%edx
+  807943:	c1 ea 0c             	shr    $0xc,%edx
+  807946:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80794d:	f6 c2 01             	test   $0x1,%dl
+  807950:	74 1a                	je     80796c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  807952:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807955:	89 02                	mov    %eax,(%edx)
+	return 0;
+  807957:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80795c:	5d                   	pop    %ebp
+  80795d:	c3                   	ret
+		return -E_INVAL;
+  80795e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807963:	eb f7                	jmp    80795c <fd_lookup+0x39>
+		return -E_INVAL;
+  807965:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80796a:	eb f0                	jmp    80795c <fd_lookup+0x39>
+  80796c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807971:	eb e9                	jmp    80795c <fd_lookup+0x39>
+
+00807973 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  807973:	55                   	push   %ebp
+  807974:	89 e5                	mov    %esp,%ebp
+  807976:	53                   	push   %ebx
+  807977:	83 ec 04             	sub    $0x4,%esp
+  80797a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80797d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807982:	eb 03                	jmp    807987 <dev_lookup+0x14>
+  807984:	83 c0 01             	add    $0x1,%eax
+  807987:	8b 1c 85 10 be 80 00 	mov    0x80be10(,%eax,4),%ebx
+  80798e:	85 db                	test   %ebx,%ebx
+  807990:	74 0b                	je     80799d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  807992:	39 13                	cmp    %edx,(%ebx)
+  807994:	75 ee                	jne    807984 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  807996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80799b:	eb 49                	jmp    8079e6 <dev_lookup+0x73>
+  80799d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80799f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8079a5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8079aa:	77 18                	ja     8079c4 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8079ac:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8079b1:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8079b3:	c1 e8 10             	shr    $0x10,%eax
+  8079b6:	74 0c                	je     8079c4 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8079b8:	c1 e0 10             	shl    $0x10,%eax
+  8079bb:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8079c0:	29 c1                	sub    %eax,%ecx
+  8079c2:	eb 06                	jmp    8079ca <dev_lookup+0x57>
+		return pthread_main_tls;
+  8079c4:	8b 0d 40 c4 84 00    	mov    0x84c440,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8079ca:	8b 01                	mov    (%ecx),%eax
+  8079cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8079cf:	83 ec 04             	sub    $0x4,%esp
+  8079d2:	52                   	push   %edx
+  8079d3:	50                   	push   %eax
+  8079d4:	68 94 bd 80 00       	push   $0x80bd94
+  8079d9:	e8 15 ee ff ff       	call   8067f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8079de:	83 c4 10             	add    $0x10,%esp
+  8079e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8079e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8079e9:	89 1a                	mov    %ebx,(%edx)
+}
+  8079eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8079ee:	c9                   	leave
+  8079ef:	c3                   	ret
+
+008079f0 <fd_close>:
+{
+  8079f0:	55                   	push   %ebp
+  8079f1:	89 e5                	mov    %esp,%ebp
+  8079f3:	57                   	push   %edi
+  8079f4:	56                   	push   %esi
+  8079f5:	53                   	push   %ebx
+  8079f6:	83 ec 24             	sub    $0x24,%esp
+  8079f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8079fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8079ff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  807a02:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  807a03:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  807a09:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  807a0c:	50                   	push   %eax
+  807a0d:	e8 11 ff ff ff       	call   807923 <fd_lookup>
+  807a12:	89 c3                	mov    %eax,%ebx
+  807a14:	83 c4 10             	add    $0x10,%esp
+  807a17:	85 c0                	test   %eax,%eax
+  807a19:	78 05                	js     807a20 <fd_close+0x30>
+	    || fd != fd2)
+  807a1b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  807a1e:	74 16                	je     807a36 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  807a20:	89 f8                	mov    %edi,%eax
+  807a22:	84 c0                	test   %al,%al
+  807a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  807a29:	0f 44 d8             	cmove  %eax,%ebx
+}
+  807a2c:	89 d8                	mov    %ebx,%eax
+  807a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807a31:	5b                   	pop    %ebx
+  807a32:	5e                   	pop    %esi
+  807a33:	5f                   	pop    %edi
+  807a34:	5d                   	pop    %ebp
+  807a35:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  807a36:	83 ec 08             	sub    $0x8,%esp
+  807a39:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  807a3c:	50                   	push   %eax
+  807a3d:	ff 36                	push   (%esi)
+  807a3f:	e8 2f ff ff ff       	call   807973 <dev_lookup>
+  807a44:	89 c3                	mov    %eax,%ebx
+  807a46:	83 c4 10             	add    $0x10,%esp
+  807a49:	85 c0                	test   %eax,%eax
+  807a4b:	78 1a                	js     807a67 <fd_close+0x77>
+		if (dev->dev_close)
+  807a4d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  807a50:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  807a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  807a58:	85 c0                	test   %eax,%eax
+  807a5a:	74 0b                	je     807a67 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  807a5c:	83 ec 0c             	sub    $0xc,%esp
+  807a5f:	56                   	push   %esi
+  807a60:	ff d0                	call   *%eax
+  807a62:	89 c3                	mov    %eax,%ebx
+  807a64:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  807a67:	83 ec 08             	sub    $0x8,%esp
+  807a6a:	56                   	push   %esi
+  807a6b:	6a 00                	push   $0x0
+  807a6d:	e8 3c f8 ff ff       	call   8072ae <sys_page_unmap>
+	return r;
+  807a72:	83 c4 10             	add    $0x10,%esp
+  807a75:	eb b5                	jmp    807a2c <fd_close+0x3c>
+
+00807a77 <close>:
+
+int
+close(int fdnum)
+{
+  807a77:	55                   	push   %ebp
+  807a78:	89 e5                	mov    %esp,%ebp
+  807a7a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807a7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807a80:	50                   	push   %eax
+  807a81:	ff 75 08             	push   0x8(%ebp)
+  807a84:	e8 9a fe ff ff       	call   807923 <fd_lookup>
+  807a89:	83 c4 10             	add    $0x10,%esp
+  807a8c:	85 c0                	test   %eax,%eax
+  807a8e:	79 02                	jns    807a92 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  807a90:	c9                   	leave
+  807a91:	c3                   	ret
+		return fd_close(fd, 1);
+  807a92:	83 ec 08             	sub    $0x8,%esp
+  807a95:	6a 01                	push   $0x1
+  807a97:	ff 75 f4             	push   -0xc(%ebp)
+  807a9a:	e8 51 ff ff ff       	call   8079f0 <fd_close>
+  807a9f:	83 c4 10             	add    $0x10,%esp
+  807aa2:	eb ec                	jmp    807a90 <close+0x19>
+
+00807aa4 <close_all>:
+
+void
+close_all(void)
+{
+  807aa4:	55                   	push   %ebp
+  807aa5:	89 e5                	mov    %esp,%ebp
+  807aa7:	53                   	push   %ebx
+  807aa8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  807aab:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  807ab0:	83 ec 0c             	sub    $0xc,%esp
+  807ab3:	53                   	push   %ebx
+  807ab4:	e8 be ff ff ff       	call   807a77 <close>
+	for (i = 0; i < MAXFD; i++)
+  807ab9:	83 c3 01             	add    $0x1,%ebx
+  807abc:	83 c4 10             	add    $0x10,%esp
+  807abf:	83 fb 20             	cmp    $0x20,%ebx
+  807ac2:	75 ec                	jne    807ab0 <close_all+0xc>
+}
+  807ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807ac7:	c9                   	leave
+  807ac8:	c3                   	ret
+
+00807ac9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  807ac9:	55                   	push   %ebp
+  807aca:	89 e5                	mov    %esp,%ebp
+  807acc:	57                   	push   %edi
+  807acd:	56                   	push   %esi
+  807ace:	53                   	push   %ebx
+  807acf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  807ad2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  807ad5:	50                   	push   %eax
+  807ad6:	ff 75 08             	push   0x8(%ebp)
+  807ad9:	e8 45 fe ff ff       	call   807923 <fd_lookup>
+  807ade:	89 c3                	mov    %eax,%ebx
+  807ae0:	83 c4 10             	add    $0x10,%esp
+  807ae3:	85 c0                	test   %eax,%eax
+  807ae5:	78 7f                	js     807b66 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  807ae7:	83 ec 0c             	sub    $0xc,%esp
+  807aea:	ff 75 0c             	push   0xc(%ebp)
+  807aed:	e8 85 ff ff ff       	call   807a77 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  807af2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  807af5:	c1 e6 0c             	shl    $0xc,%esi
+  807af8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  807afe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  807b01:	89 3c 24             	mov    %edi,(%esp)
+  807b04:	e8 ad fd ff ff       	call   8078b6 <fd2data>
+  807b09:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  807b0b:	89 34 24             	mov    %esi,(%esp)
+  807b0e:	e8 a3 fd ff ff       	call   8078b6 <fd2data>
+  807b13:	83 c4 10             	add    $0x10,%esp
+  807b16:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  807b19:	89 d8                	mov    %ebx,%eax
+  807b1b:	c1 e8 16             	shr    $0x16,%eax
+  807b1e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  807b25:	a8 01                	test   $0x1,%al
+  807b27:	74 11                	je     807b3a <dup+0x71>
+  807b29:	89 d8                	mov    %ebx,%eax
+  807b2b:	c1 e8 0c             	shr    $0xc,%eax
+  807b2e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  807b35:	f6 c2 01             	test   $0x1,%dl
+  807b38:	75 36                	jne    807b70 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  807b3a:	89 f8                	mov    %edi,%eax
+  807b3c:	c1 e8 0c             	shr    $0xc,%eax
+  807b3f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  807b46:	83 ec 0c             	sub    $0xc,%esp
+  807b49:	25 07 0e 00 00       	and    $0xe07,%eax
+  807b4e:	50                   	push   %eax
+  807b4f:	56                   	push   %esi
+  807b50:	6a 00                	push   $0x0
+  807b52:	57                   	push   %edi
+  807b53:	6a 00                	push   $0x0
+  807b55:	e8 08 f7 ff ff       	call   807262 <sys_page_map>
+  807b5a:	89 c3                	mov    %eax,%ebx
+  807b5c:	83 c4 20             	add    $0x20,%esp
+  807b5f:	85 c0                	test   %eax,%eax
+  807b61:	78 33                	js     807b96 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  807b63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  807b66:	89 d8                	mov    %ebx,%eax
+  807b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807b6b:	5b                   	pop    %ebx
+  807b6c:	5e                   	pop    %esi
+  807b6d:	5f                   	pop    %edi
+  807b6e:	5d                   	pop    %ebp
+  807b6f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  807b70:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  807b77:	83 ec 0c             	sub    $0xc,%esp
+  807b7a:	25 07 0e 00 00       	and    $0xe07,%eax
+  807b7f:	50                   	push   %eax
+  807b80:	ff 75 d4             	push   -0x2c(%ebp)
+  807b83:	6a 00                	push   $0x0
+  807b85:	53                   	push   %ebx
+  807b86:	6a 00                	push   $0x0
+  807b88:	e8 d5 f6 ff ff       	call   807262 <sys_page_map>
+  807b8d:	89 c3                	mov    %eax,%ebx
+  807b8f:	83 c4 20             	add    $0x20,%esp
+  807b92:	85 c0                	test   %eax,%eax
+  807b94:	79 a4                	jns    807b3a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  807b96:	83 ec 08             	sub    $0x8,%esp
+  807b99:	56                   	push   %esi
+  807b9a:	6a 00                	push   $0x0
+  807b9c:	e8 0d f7 ff ff       	call   8072ae <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  807ba1:	83 c4 08             	add    $0x8,%esp
+  807ba4:	ff 75 d4             	push   -0x2c(%ebp)
+  807ba7:	6a 00                	push   $0x0
+  807ba9:	e8 00 f7 ff ff       	call   8072ae <sys_page_unmap>
+	return r;
+  807bae:	83 c4 10             	add    $0x10,%esp
+  807bb1:	eb b3                	jmp    807b66 <dup+0x9d>
+
+00807bb3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  807bb3:	55                   	push   %ebp
+  807bb4:	89 e5                	mov    %esp,%ebp
+  807bb6:	56                   	push   %esi
+  807bb7:	53                   	push   %ebx
+  807bb8:	83 ec 18             	sub    $0x18,%esp
+  807bbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807bbe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  807bc1:	50                   	push   %eax
+  807bc2:	53                   	push   %ebx
+  807bc3:	e8 5b fd ff ff       	call   807923 <fd_lookup>
+  807bc8:	83 c4 10             	add    $0x10,%esp
+  807bcb:	85 c0                	test   %eax,%eax
+  807bcd:	78 3c                	js     807c0b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807bcf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807bd2:	83 ec 08             	sub    $0x8,%esp
+  807bd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807bd8:	50                   	push   %eax
+  807bd9:	ff 36                	push   (%esi)
+  807bdb:	e8 93 fd ff ff       	call   807973 <dev_lookup>
+  807be0:	83 c4 10             	add    $0x10,%esp
+  807be3:	85 c0                	test   %eax,%eax
+  807be5:	78 24                	js     807c0b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  807be7:	8b 46 08             	mov    0x8(%esi),%eax
+  807bea:	83 e0 03             	and    $0x3,%eax
+  807bed:	83 f8 01             	cmp    $0x1,%eax
+  807bf0:	74 20                	je     807c12 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  807bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807bf5:	8b 40 08             	mov    0x8(%eax),%eax
+  807bf8:	85 c0                	test   %eax,%eax
+  807bfa:	74 61                	je     807c5d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  807bfc:	83 ec 04             	sub    $0x4,%esp
+  807bff:	ff 75 10             	push   0x10(%ebp)
+  807c02:	ff 75 0c             	push   0xc(%ebp)
+  807c05:	56                   	push   %esi
+  807c06:	ff d0                	call   *%eax
+  807c08:	83 c4 10             	add    $0x10,%esp
+}
+  807c0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807c0e:	5b                   	pop    %ebx
+  807c0f:	5e                   	pop    %esi
+  807c10:	5d                   	pop    %ebp
+  807c11:	c3                   	ret
+  807c12:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  807c14:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  807c1a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  807c1f:	77 18                	ja     807c39 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  807c21:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  807c26:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  807c28:	c1 e8 10             	shr    $0x10,%eax
+  807c2b:	74 0c                	je     807c39 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  807c2d:	c1 e0 10             	shl    $0x10,%eax
+  807c30:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  807c35:	29 c2                	sub    %eax,%edx
+  807c37:	eb 06                	jmp    807c3f <read+0x8c>
+		return pthread_main_tls;
+  807c39:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  807c3f:	8b 02                	mov    (%edx),%eax
+  807c41:	8b 40 48             	mov    0x48(%eax),%eax
+  807c44:	83 ec 04             	sub    $0x4,%esp
+  807c47:	53                   	push   %ebx
+  807c48:	50                   	push   %eax
+  807c49:	68 d5 bd 80 00       	push   $0x80bdd5
+  807c4e:	e8 a0 eb ff ff       	call   8067f3 <cprintf>
+		return -E_INVAL;
+  807c53:	83 c4 10             	add    $0x10,%esp
+  807c56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807c5b:	eb ae                	jmp    807c0b <read+0x58>
+		return -E_NOT_SUPP;
+  807c5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807c62:	eb a7                	jmp    807c0b <read+0x58>
+
+00807c64 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  807c64:	55                   	push   %ebp
+  807c65:	89 e5                	mov    %esp,%ebp
+  807c67:	57                   	push   %edi
+  807c68:	56                   	push   %esi
+  807c69:	53                   	push   %ebx
+  807c6a:	83 ec 0c             	sub    $0xc,%esp
+  807c6d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807c70:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  807c73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807c78:	eb 02                	jmp    807c7c <readn+0x18>
+  807c7a:	01 c3                	add    %eax,%ebx
+  807c7c:	39 f3                	cmp    %esi,%ebx
+  807c7e:	73 21                	jae    807ca1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  807c80:	83 ec 04             	sub    $0x4,%esp
+  807c83:	89 f0                	mov    %esi,%eax
+  807c85:	29 d8                	sub    %ebx,%eax
+  807c87:	50                   	push   %eax
+  807c88:	89 d8                	mov    %ebx,%eax
+  807c8a:	03 45 0c             	add    0xc(%ebp),%eax
+  807c8d:	50                   	push   %eax
+  807c8e:	57                   	push   %edi
+  807c8f:	e8 1f ff ff ff       	call   807bb3 <read>
+		if (m < 0)
+  807c94:	83 c4 10             	add    $0x10,%esp
+  807c97:	85 c0                	test   %eax,%eax
+  807c99:	78 04                	js     807c9f <readn+0x3b>
+			return m;
+		if (m == 0)
+  807c9b:	75 dd                	jne    807c7a <readn+0x16>
+  807c9d:	eb 02                	jmp    807ca1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  807c9f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  807ca1:	89 d8                	mov    %ebx,%eax
+  807ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807ca6:	5b                   	pop    %ebx
+  807ca7:	5e                   	pop    %esi
+  807ca8:	5f                   	pop    %edi
+  807ca9:	5d                   	pop    %ebp
+  807caa:	c3                   	ret
+
+00807cab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  807cab:	55                   	push   %ebp
+  807cac:	89 e5                	mov    %esp,%ebp
+  807cae:	56                   	push   %esi
+  807caf:	53                   	push   %ebx
+  807cb0:	83 ec 18             	sub    $0x18,%esp
+  807cb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807cb6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  807cb9:	50                   	push   %eax
+  807cba:	53                   	push   %ebx
+  807cbb:	e8 63 fc ff ff       	call   807923 <fd_lookup>
+  807cc0:	83 c4 10             	add    $0x10,%esp
+  807cc3:	85 c0                	test   %eax,%eax
+  807cc5:	78 37                	js     807cfe <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807cc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807cca:	83 ec 08             	sub    $0x8,%esp
+  807ccd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807cd0:	50                   	push   %eax
+  807cd1:	ff 36                	push   (%esi)
+  807cd3:	e8 9b fc ff ff       	call   807973 <dev_lookup>
+  807cd8:	83 c4 10             	add    $0x10,%esp
+  807cdb:	85 c0                	test   %eax,%eax
+  807cdd:	78 1f                	js     807cfe <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  807cdf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  807ce3:	74 20                	je     807d05 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  807ce5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807ce8:	8b 40 0c             	mov    0xc(%eax),%eax
+  807ceb:	85 c0                	test   %eax,%eax
+  807ced:	74 61                	je     807d50 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  807cef:	83 ec 04             	sub    $0x4,%esp
+  807cf2:	ff 75 10             	push   0x10(%ebp)
+  807cf5:	ff 75 0c             	push   0xc(%ebp)
+  807cf8:	56                   	push   %esi
+  807cf9:	ff d0                	call   *%eax
+  807cfb:	83 c4 10             	add    $0x10,%esp
+}
+  807cfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807d01:	5b                   	pop    %ebx
+  807d02:	5e                   	pop    %esi
+  807d03:	5d                   	pop    %ebp
+  807d04:	c3                   	ret
+  807d05:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  807d07:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  807d0d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  807d12:	77 18                	ja     807d2c <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  807d14:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  807d19:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  807d1b:	c1 e8 10             	shr    $0x10,%eax
+  807d1e:	74 0c                	je     807d2c <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  807d20:	c1 e0 10             	shl    $0x10,%eax
+  807d23:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  807d28:	29 c2                	sub    %eax,%edx
+  807d2a:	eb 06                	jmp    807d32 <write+0x87>
+		return pthread_main_tls;
+  807d2c:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  807d32:	8b 02                	mov    (%edx),%eax
+  807d34:	8b 40 48             	mov    0x48(%eax),%eax
+  807d37:	83 ec 04             	sub    $0x4,%esp
+  807d3a:	53                   	push   %ebx
+  807d3b:	50                   	push   %eax
+  807d3c:	68 f1 bd 80 00       	push   $0x80bdf1
+  807d41:	e8 ad ea ff ff       	call   8067f3 <cprintf>
+		return -E_INVAL;
+  807d46:	83 c4 10             	add    $0x10,%esp
+  807d49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807d4e:	eb ae                	jmp    807cfe <write+0x53>
+		return -E_NOT_SUPP;
+  807d50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807d55:	eb a7                	jmp    807cfe <write+0x53>
+
+00807d57 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  807d57:	55                   	push   %ebp
+  807d58:	89 e5                	mov    %esp,%ebp
+  807d5a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807d5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807d60:	50                   	push   %eax
+  807d61:	ff 75 08             	push   0x8(%ebp)
+  807d64:	e8 ba fb ff ff       	call   807923 <fd_lookup>
+  807d69:	83 c4 10             	add    $0x10,%esp
+  807d6c:	85 c0                	test   %eax,%eax
+  807d6e:	78 0e                	js     807d7e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  807d70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807d76:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  807d79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807d7e:	c9                   	leave
+  807d7f:	c3                   	ret
+
+00807d80 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  807d80:	55                   	push   %ebp
+  807d81:	89 e5                	mov    %esp,%ebp
+  807d83:	56                   	push   %esi
+  807d84:	53                   	push   %ebx
+  807d85:	83 ec 18             	sub    $0x18,%esp
+  807d88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807d8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  807d8e:	50                   	push   %eax
+  807d8f:	53                   	push   %ebx
+  807d90:	e8 8e fb ff ff       	call   807923 <fd_lookup>
+  807d95:	83 c4 10             	add    $0x10,%esp
+  807d98:	85 c0                	test   %eax,%eax
+  807d9a:	78 34                	js     807dd0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807d9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807d9f:	83 ec 08             	sub    $0x8,%esp
+  807da2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807da5:	50                   	push   %eax
+  807da6:	ff 36                	push   (%esi)
+  807da8:	e8 c6 fb ff ff       	call   807973 <dev_lookup>
+  807dad:	83 c4 10             	add    $0x10,%esp
+  807db0:	85 c0                	test   %eax,%eax
+  807db2:	78 1c                	js     807dd0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  807db4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  807db8:	74 1d                	je     807dd7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  807dba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807dbd:	8b 40 18             	mov    0x18(%eax),%eax
+  807dc0:	85 c0                	test   %eax,%eax
+  807dc2:	74 5e                	je     807e22 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  807dc4:	83 ec 08             	sub    $0x8,%esp
+  807dc7:	ff 75 0c             	push   0xc(%ebp)
+  807dca:	56                   	push   %esi
+  807dcb:	ff d0                	call   *%eax
+  807dcd:	83 c4 10             	add    $0x10,%esp
+}
+  807dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807dd3:	5b                   	pop    %ebx
+  807dd4:	5e                   	pop    %esi
+  807dd5:	5d                   	pop    %ebp
+  807dd6:	c3                   	ret
+  807dd7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  807dd9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  807ddf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  807de4:	77 18                	ja     807dfe <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  807de6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  807deb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  807ded:	c1 e8 10             	shr    $0x10,%eax
+  807df0:	74 0c                	je     807dfe <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  807df2:	c1 e0 10             	shl    $0x10,%eax
+  807df5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  807dfa:	29 c2                	sub    %eax,%edx
+  807dfc:	eb 06                	jmp    807e04 <ftruncate+0x84>
+		return pthread_main_tls;
+  807dfe:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+			thisenv->env_id, fdnum);
+  807e04:	8b 02                	mov    (%edx),%eax
+  807e06:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  807e09:	83 ec 04             	sub    $0x4,%esp
+  807e0c:	53                   	push   %ebx
+  807e0d:	50                   	push   %eax
+  807e0e:	68 b4 bd 80 00       	push   $0x80bdb4
+  807e13:	e8 db e9 ff ff       	call   8067f3 <cprintf>
+		return -E_INVAL;
+  807e18:	83 c4 10             	add    $0x10,%esp
+  807e1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807e20:	eb ae                	jmp    807dd0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  807e22:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807e27:	eb a7                	jmp    807dd0 <ftruncate+0x50>
+
+00807e29 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  807e29:	55                   	push   %ebp
+  807e2a:	89 e5                	mov    %esp,%ebp
+  807e2c:	56                   	push   %esi
+  807e2d:	53                   	push   %ebx
+  807e2e:	83 ec 18             	sub    $0x18,%esp
+  807e31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807e34:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  807e37:	50                   	push   %eax
+  807e38:	ff 75 08             	push   0x8(%ebp)
+  807e3b:	e8 e3 fa ff ff       	call   807923 <fd_lookup>
+  807e40:	83 c4 10             	add    $0x10,%esp
+  807e43:	85 c0                	test   %eax,%eax
+  807e45:	78 49                	js     807e90 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807e47:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807e4a:	83 ec 08             	sub    $0x8,%esp
+  807e4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807e50:	50                   	push   %eax
+  807e51:	ff 36                	push   (%esi)
+  807e53:	e8 1b fb ff ff       	call   807973 <dev_lookup>
+  807e58:	83 c4 10             	add    $0x10,%esp
+  807e5b:	85 c0                	test   %eax,%eax
+  807e5d:	78 31                	js     807e90 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  807e5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807e62:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  807e66:	74 2f                	je     807e97 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  807e68:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  807e6b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  807e72:	00 00 00 
+	stat->st_isdir = 0;
+  807e75:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  807e7c:	00 00 00 
+	stat->st_dev = dev;
+  807e7f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  807e85:	83 ec 08             	sub    $0x8,%esp
+  807e88:	53                   	push   %ebx
+  807e89:	56                   	push   %esi
+  807e8a:	ff 50 14             	call   *0x14(%eax)
+  807e8d:	83 c4 10             	add    $0x10,%esp
+}
+  807e90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807e93:	5b                   	pop    %ebx
+  807e94:	5e                   	pop    %esi
+  807e95:	5d                   	pop    %ebp
+  807e96:	c3                   	ret
+		return -E_NOT_SUPP;
+  807e97:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807e9c:	eb f2                	jmp    807e90 <fstat+0x67>
+
+00807e9e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  807e9e:	55                   	push   %ebp
+  807e9f:	89 e5                	mov    %esp,%ebp
+  807ea1:	56                   	push   %esi
+  807ea2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  807ea3:	83 ec 08             	sub    $0x8,%esp
+  807ea6:	6a 00                	push   $0x0
+  807ea8:	ff 75 08             	push   0x8(%ebp)
+  807eab:	e8 4b 03 00 00       	call   8081fb <open>
+  807eb0:	89 c3                	mov    %eax,%ebx
+  807eb2:	83 c4 10             	add    $0x10,%esp
+  807eb5:	85 c0                	test   %eax,%eax
+  807eb7:	78 1b                	js     807ed4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  807eb9:	83 ec 08             	sub    $0x8,%esp
+  807ebc:	ff 75 0c             	push   0xc(%ebp)
+  807ebf:	50                   	push   %eax
+  807ec0:	e8 64 ff ff ff       	call   807e29 <fstat>
+  807ec5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  807ec7:	89 1c 24             	mov    %ebx,(%esp)
+  807eca:	e8 a8 fb ff ff       	call   807a77 <close>
+	return r;
+  807ecf:	83 c4 10             	add    $0x10,%esp
+  807ed2:	89 f3                	mov    %esi,%ebx
+}
+  807ed4:	89 d8                	mov    %ebx,%eax
+  807ed6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807ed9:	5b                   	pop    %ebx
+  807eda:	5e                   	pop    %esi
+  807edb:	5d                   	pop    %ebp
+  807edc:	c3                   	ret
+
+00807edd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  807edd:	55                   	push   %ebp
+  807ede:	89 e5                	mov    %esp,%ebp
+  807ee0:	56                   	push   %esi
+  807ee1:	53                   	push   %ebx
+  807ee2:	89 c6                	mov    %eax,%esi
+  807ee4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  807ee6:	83 3d 24 c1 84 00 00 	cmpl   $0x0,0x84c124
+  807eed:	74 27                	je     807f16 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  807eef:	6a 07                	push   $0x7
+  807ef1:	68 00 d0 84 00       	push   $0x84d000
+  807ef6:	56                   	push   %esi
+  807ef7:	ff 35 24 c1 84 00    	push   0x84c124
+  807efd:	e8 0f f9 ff ff       	call   807811 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  807f02:	83 c4 0c             	add    $0xc,%esp
+  807f05:	6a 00                	push   $0x0
+  807f07:	53                   	push   %ebx
+  807f08:	6a 00                	push   $0x0
+  807f0a:	e8 0c f8 ff ff       	call   80771b <ipc_recv>
+}
+  807f0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807f12:	5b                   	pop    %ebx
+  807f13:	5e                   	pop    %esi
+  807f14:	5d                   	pop    %ebp
+  807f15:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  807f16:	83 ec 0c             	sub    $0xc,%esp
+  807f19:	6a 01                	push   $0x1
+  807f1b:	e8 47 f9 ff ff       	call   807867 <ipc_find_env>
+  807f20:	a3 24 c1 84 00       	mov    %eax,0x84c124
+  807f25:	83 c4 10             	add    $0x10,%esp
+  807f28:	eb c5                	jmp    807eef <fsipc+0x12>
+
+00807f2a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  807f2a:	55                   	push   %ebp
+  807f2b:	89 e5                	mov    %esp,%ebp
+  807f2d:	53                   	push   %ebx
+  807f2e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  807f31:	68 28 c1 84 00       	push   $0x84c128
+  807f36:	e8 65 1b 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  807f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  807f3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  807f41:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	fsipcbuf.set_size.req_size = newsize;
+  807f46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807f49:	a3 04 d0 84 00       	mov    %eax,0x84d004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  807f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  807f53:	b8 02 00 00 00       	mov    $0x2,%eax
+  807f58:	e8 80 ff ff ff       	call   807edd <fsipc>
+  807f5d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  807f5f:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  807f66:	e8 a2 1b 00 00       	call   809b0d <mutex_unlock>
+	return r;
+}
+  807f6b:	89 d8                	mov    %ebx,%eax
+  807f6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807f70:	c9                   	leave
+  807f71:	c3                   	ret
+
+00807f72 <devfile_flush>:
+{
+  807f72:	55                   	push   %ebp
+  807f73:	89 e5                	mov    %esp,%ebp
+  807f75:	53                   	push   %ebx
+  807f76:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  807f79:	68 28 c1 84 00       	push   $0x84c128
+  807f7e:	e8 1d 1b 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  807f83:	8b 45 08             	mov    0x8(%ebp),%eax
+  807f86:	8b 40 0c             	mov    0xc(%eax),%eax
+  807f89:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  807f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  807f93:	b8 06 00 00 00       	mov    $0x6,%eax
+  807f98:	e8 40 ff ff ff       	call   807edd <fsipc>
+  807f9d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  807f9f:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  807fa6:	e8 62 1b 00 00       	call   809b0d <mutex_unlock>
+}
+  807fab:	89 d8                	mov    %ebx,%eax
+  807fad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807fb0:	c9                   	leave
+  807fb1:	c3                   	ret
+
+00807fb2 <devfile_stat>:
+{
+  807fb2:	55                   	push   %ebp
+  807fb3:	89 e5                	mov    %esp,%ebp
+  807fb5:	56                   	push   %esi
+  807fb6:	53                   	push   %ebx
+  807fb7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  807fba:	83 ec 0c             	sub    $0xc,%esp
+  807fbd:	68 28 c1 84 00       	push   $0x84c128
+  807fc2:	e8 d9 1a 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  807fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  807fca:	8b 40 0c             	mov    0xc(%eax),%eax
+  807fcd:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  807fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  807fd7:	b8 05 00 00 00       	mov    $0x5,%eax
+  807fdc:	e8 fc fe ff ff       	call   807edd <fsipc>
+  807fe1:	89 c3                	mov    %eax,%ebx
+  807fe3:	83 c4 10             	add    $0x10,%esp
+  807fe6:	85 c0                	test   %eax,%eax
+  807fe8:	79 16                	jns    808000 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  807fea:	83 ec 0c             	sub    $0xc,%esp
+  807fed:	68 28 c1 84 00       	push   $0x84c128
+  807ff2:	e8 16 1b 00 00       	call   809b0d <mutex_unlock>
+}
+  807ff7:	89 d8                	mov    %ebx,%eax
+  807ff9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807ffc:	5b                   	pop    %ebx
+  807ffd:	5e                   	pop    %esi
+  807ffe:	5d                   	pop    %ebp
+  807fff:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  808000:	83 ec 08             	sub    $0x8,%esp
+  808003:	68 00 d0 84 00       	push   $0x84d000
+  808008:	56                   	push   %esi
+  808009:	e8 c9 ed ff ff       	call   806dd7 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80800e:	a1 80 d0 84 00       	mov    0x84d080,%eax
+  808013:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  808019:	a1 84 d0 84 00       	mov    0x84d084,%eax
+  80801e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  808024:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  808027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80802c:	eb bc                	jmp    807fea <devfile_stat+0x38>
+
+0080802e <devfile_write>:
+{
+  80802e:	55                   	push   %ebp
+  80802f:	89 e5                	mov    %esp,%ebp
+  808031:	53                   	push   %ebx
+  808032:	83 ec 10             	sub    $0x10,%esp
+  808035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  808038:	68 28 c1 84 00       	push   $0x84c128
+  80803d:	e8 5e 1a 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  808042:	8b 45 08             	mov    0x8(%ebp),%eax
+  808045:	8b 40 0c             	mov    0xc(%eax),%eax
+  808048:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80804d:	83 c4 10             	add    $0x10,%esp
+  808050:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  808056:	76 3d                	jbe    808095 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  808058:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80805d:	39 c3                	cmp    %eax,%ebx
+  80805f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  808062:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808065:	a3 08 d0 84 00       	mov    %eax,0x84d008
+	fsipcbuf.write.req_n = n;
+  80806a:	89 1d 04 d0 84 00    	mov    %ebx,0x84d004
+	r = fsipc(FSREQ_WRITE, NULL);
+  808070:	ba 00 00 00 00       	mov    $0x0,%edx
+  808075:	b8 04 00 00 00       	mov    $0x4,%eax
+  80807a:	e8 5e fe ff ff       	call   807edd <fsipc>
+  80807f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  808081:	83 ec 0c             	sub    $0xc,%esp
+  808084:	68 28 c1 84 00       	push   $0x84c128
+  808089:	e8 7f 1a 00 00       	call   809b0d <mutex_unlock>
+}
+  80808e:	89 d8                	mov    %ebx,%eax
+  808090:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808093:	c9                   	leave
+  808094:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  808095:	83 ec 04             	sub    $0x4,%esp
+  808098:	53                   	push   %ebx
+  808099:	ff 75 0c             	push   0xc(%ebp)
+  80809c:	68 0c d0 84 00       	push   $0x84d00c
+  8080a1:	e8 b7 ee ff ff       	call   806f5d <memmove>
+  8080a6:	83 c4 10             	add    $0x10,%esp
+  8080a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8080ae:	eb b5                	jmp    808065 <devfile_write+0x37>
+
+008080b0 <devfile_read>:
+{
+  8080b0:	55                   	push   %ebp
+  8080b1:	89 e5                	mov    %esp,%ebp
+  8080b3:	57                   	push   %edi
+  8080b4:	56                   	push   %esi
+  8080b5:	53                   	push   %ebx
+  8080b6:	83 ec 0c             	sub    $0xc,%esp
+  8080b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8080bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8080bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8080c2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8080c8:	0f 86 8c 00 00 00    	jbe    80815a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8080ce:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8080d3:	39 c3                	cmp    %eax,%ebx
+  8080d5:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8080d8:	89 f8                	mov    %edi,%eax
+  8080da:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8080dd:	eb 0f                	jmp    8080ee <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8080df:	0f b6 08             	movzbl (%eax),%ecx
+  8080e2:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8080e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8080e9:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8080ee:	39 d0                	cmp    %edx,%eax
+  8080f0:	72 ed                	jb     8080df <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8080f2:	83 ec 0c             	sub    $0xc,%esp
+  8080f5:	68 28 c1 84 00       	push   $0x84c128
+  8080fa:	e8 a1 19 00 00       	call   809aa0 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8080ff:	8b 46 0c             	mov    0xc(%esi),%eax
+  808102:	a3 00 d0 84 00       	mov    %eax,0x84d000
+		fsipcbuf.read.req_n = n;
+  808107:	89 1d 04 d0 84 00    	mov    %ebx,0x84d004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  80810d:	89 3d 08 d0 84 00    	mov    %edi,0x84d008
+		r = fsipc(FSREQ_READ, NULL);
+  808113:	ba 00 00 00 00       	mov    $0x0,%edx
+  808118:	b8 03 00 00 00       	mov    $0x3,%eax
+  80811d:	e8 bb fd ff ff       	call   807edd <fsipc>
+  808122:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  808124:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  80812b:	e8 dd 19 00 00       	call   809b0d <mutex_unlock>
+		assert(r <= (int) n);
+  808130:	83 c4 10             	add    $0x10,%esp
+  808133:	39 f3                	cmp    %esi,%ebx
+  808135:	7c 0a                	jl     808141 <devfile_read+0x91>
+}
+  808137:	89 f0                	mov    %esi,%eax
+  808139:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80813c:	5b                   	pop    %ebx
+  80813d:	5e                   	pop    %esi
+  80813e:	5f                   	pop    %edi
+  80813f:	5d                   	pop    %ebp
+  808140:	c3                   	ret
+		assert(r <= (int) n);
+  808141:	68 24 be 80 00       	push   $0x80be24
+  808146:	68 2b ad 80 00       	push   $0x80ad2b
+  80814b:	68 90 00 00 00       	push   $0x90
+  808150:	68 31 be 80 00       	push   $0x80be31
+  808155:	e8 be e5 ff ff       	call   806718 <_panic>
+	mutex_lock(&fsipc_mu);
+  80815a:	83 ec 0c             	sub    $0xc,%esp
+  80815d:	68 28 c1 84 00       	push   $0x84c128
+  808162:	e8 39 19 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  808167:	8b 46 0c             	mov    0xc(%esi),%eax
+  80816a:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	fsipcbuf.read.req_n = n;
+  80816f:	89 1d 04 d0 84 00    	mov    %ebx,0x84d004
+	fsipcbuf.read.req_va = 0;
+  808175:	c7 05 08 d0 84 00 00 	movl   $0x0,0x84d008
+  80817c:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80817f:	ba 00 00 00 00       	mov    $0x0,%edx
+  808184:	b8 03 00 00 00       	mov    $0x3,%eax
+  808189:	e8 4f fd ff ff       	call   807edd <fsipc>
+  80818e:	89 c6                	mov    %eax,%esi
+  808190:	83 c4 10             	add    $0x10,%esp
+  808193:	85 c0                	test   %eax,%eax
+  808195:	78 1d                	js     8081b4 <devfile_read+0x104>
+		assert(r <= n);
+  808197:	39 c3                	cmp    %eax,%ebx
+  808199:	72 2e                	jb     8081c9 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80819b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8081a0:	7f 40                	jg     8081e2 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8081a2:	83 ec 04             	sub    $0x4,%esp
+  8081a5:	50                   	push   %eax
+  8081a6:	68 00 d0 84 00       	push   $0x84d000
+  8081ab:	57                   	push   %edi
+  8081ac:	e8 ac ed ff ff       	call   806f5d <memmove>
+  8081b1:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8081b4:	83 ec 0c             	sub    $0xc,%esp
+  8081b7:	68 28 c1 84 00       	push   $0x84c128
+  8081bc:	e8 4c 19 00 00       	call   809b0d <mutex_unlock>
+	return r;
+  8081c1:	83 c4 10             	add    $0x10,%esp
+  8081c4:	e9 6e ff ff ff       	jmp    808137 <devfile_read+0x87>
+		assert(r <= n);
+  8081c9:	68 3c be 80 00       	push   $0x80be3c
+  8081ce:	68 2b ad 80 00       	push   $0x80ad2b
+  8081d3:	68 99 00 00 00       	push   $0x99
+  8081d8:	68 31 be 80 00       	push   $0x80be31
+  8081dd:	e8 36 e5 ff ff       	call   806718 <_panic>
+		assert(r <= PGSIZE);
+  8081e2:	68 43 be 80 00       	push   $0x80be43
+  8081e7:	68 2b ad 80 00       	push   $0x80ad2b
+  8081ec:	68 9a 00 00 00       	push   $0x9a
+  8081f1:	68 31 be 80 00       	push   $0x80be31
+  8081f6:	e8 1d e5 ff ff       	call   806718 <_panic>
+
+008081fb <open>:
+{
+  8081fb:	55                   	push   %ebp
+  8081fc:	89 e5                	mov    %esp,%ebp
+  8081fe:	56                   	push   %esi
+  8081ff:	53                   	push   %ebx
+  808200:	83 ec 1c             	sub    $0x1c,%esp
+  808203:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  808206:	56                   	push   %esi
+  808207:	e8 90 eb ff ff       	call   806d9c <strlen>
+  80820c:	83 c4 10             	add    $0x10,%esp
+  80820f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  808214:	0f 8f 85 00 00 00    	jg     80829f <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  80821a:	83 ec 0c             	sub    $0xc,%esp
+  80821d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808220:	50                   	push   %eax
+  808221:	e8 a7 f6 ff ff       	call   8078cd <fd_alloc>
+  808226:	89 c3                	mov    %eax,%ebx
+  808228:	83 c4 10             	add    $0x10,%esp
+  80822b:	85 c0                	test   %eax,%eax
+  80822d:	78 55                	js     808284 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80822f:	83 ec 0c             	sub    $0xc,%esp
+  808232:	68 28 c1 84 00       	push   $0x84c128
+  808237:	e8 64 18 00 00       	call   809aa0 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80823c:	83 c4 08             	add    $0x8,%esp
+  80823f:	56                   	push   %esi
+  808240:	68 00 d0 84 00       	push   $0x84d000
+  808245:	e8 8d eb ff ff       	call   806dd7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80824a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80824d:	a3 00 d4 84 00       	mov    %eax,0x84d400
+	r = fsipc(FSREQ_OPEN, fd);
+  808252:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  808255:	b8 01 00 00 00       	mov    $0x1,%eax
+  80825a:	e8 7e fc ff ff       	call   807edd <fsipc>
+  80825f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  808261:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  808268:	e8 a0 18 00 00       	call   809b0d <mutex_unlock>
+	if (r < 0) {
+  80826d:	83 c4 10             	add    $0x10,%esp
+  808270:	85 db                	test   %ebx,%ebx
+  808272:	78 19                	js     80828d <open+0x92>
+	return fd2num(fd);
+  808274:	83 ec 0c             	sub    $0xc,%esp
+  808277:	ff 75 f4             	push   -0xc(%ebp)
+  80827a:	e8 27 f6 ff ff       	call   8078a6 <fd2num>
+  80827f:	89 c3                	mov    %eax,%ebx
+  808281:	83 c4 10             	add    $0x10,%esp
+}
+  808284:	89 d8                	mov    %ebx,%eax
+  808286:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808289:	5b                   	pop    %ebx
+  80828a:	5e                   	pop    %esi
+  80828b:	5d                   	pop    %ebp
+  80828c:	c3                   	ret
+		fd_close(fd, 0);
+  80828d:	83 ec 08             	sub    $0x8,%esp
+  808290:	6a 00                	push   $0x0
+  808292:	ff 75 f4             	push   -0xc(%ebp)
+  808295:	e8 56 f7 ff ff       	call   8079f0 <fd_close>
+		return r;
+  80829a:	83 c4 10             	add    $0x10,%esp
+  80829d:	eb e5                	jmp    808284 <open+0x89>
+		return -E_BAD_PATH;
+  80829f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8082a4:	eb de                	jmp    808284 <open+0x89>
+
+008082a6 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8082a6:	55                   	push   %ebp
+  8082a7:	89 e5                	mov    %esp,%ebp
+  8082a9:	53                   	push   %ebx
+  8082aa:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8082ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8082b0:	50                   	push   %eax
+  8082b1:	ff 75 08             	push   0x8(%ebp)
+  8082b4:	e8 6a f6 ff ff       	call   807923 <fd_lookup>
+  8082b9:	89 c3                	mov    %eax,%ebx
+  8082bb:	83 c4 10             	add    $0x10,%esp
+  8082be:	85 c0                	test   %eax,%eax
+  8082c0:	78 5b                	js     80831d <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8082c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8082c5:	8b 0d a4 10 81 00    	mov    0x8110a4,%ecx
+  8082cb:	39 08                	cmp    %ecx,(%eax)
+  8082cd:	75 55                	jne    808324 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8082cf:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8082d3:	74 56                	je     80832b <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8082d5:	83 ec 0c             	sub    $0xc,%esp
+  8082d8:	68 28 c1 84 00       	push   $0x84c128
+  8082dd:	e8 be 17 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8082e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8082e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8082e8:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	fsipcbuf.allocate.req_offset = offset;
+  8082ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8082f0:	a3 04 d0 84 00       	mov    %eax,0x84d004
+	fsipcbuf.allocate.req_len = len;
+  8082f5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8082f8:	a3 08 d0 84 00       	mov    %eax,0x84d008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8082fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  808302:	b8 0b 00 00 00       	mov    $0xb,%eax
+  808307:	e8 d1 fb ff ff       	call   807edd <fsipc>
+  80830c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80830e:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  808315:	e8 f3 17 00 00       	call   809b0d <mutex_unlock>
+	return r;
+  80831a:	83 c4 10             	add    $0x10,%esp
+}
+  80831d:	89 d8                	mov    %ebx,%eax
+  80831f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808322:	c9                   	leave
+  808323:	c3                   	ret
+		return -E_NOT_SUPP;
+  808324:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  808329:	eb f2                	jmp    80831d <fallocate+0x77>
+		return -E_INVAL;
+  80832b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  808330:	eb eb                	jmp    80831d <fallocate+0x77>
+
+00808332 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  808332:	55                   	push   %ebp
+  808333:	89 e5                	mov    %esp,%ebp
+  808335:	56                   	push   %esi
+  808336:	53                   	push   %ebx
+  808337:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80833a:	89 f3                	mov    %esi,%ebx
+  80833c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  808342:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  808345:	eb 06                	jmp    80834d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  808347:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80834d:	39 f3                	cmp    %esi,%ebx
+  80834f:	73 14                	jae    808365 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  808351:	83 ec 08             	sub    $0x8,%esp
+  808354:	53                   	push   %ebx
+  808355:	6a 00                	push   $0x0
+  808357:	e8 52 ef ff ff       	call   8072ae <sys_page_unmap>
+  80835c:	83 c4 10             	add    $0x10,%esp
+  80835f:	85 c0                	test   %eax,%eax
+  808361:	79 e4                	jns    808347 <munmap+0x15>
+  808363:	eb 05                	jmp    80836a <munmap+0x38>
+			return r;
+	return 0;
+  808365:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80836a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80836d:	5b                   	pop    %ebx
+  80836e:	5e                   	pop    %esi
+  80836f:	5d                   	pop    %ebp
+  808370:	c3                   	ret
+
+00808371 <mmap>:
+{
+  808371:	55                   	push   %ebp
+  808372:	89 e5                	mov    %esp,%ebp
+  808374:	57                   	push   %edi
+  808375:	56                   	push   %esi
+  808376:	53                   	push   %ebx
+  808377:	83 ec 24             	sub    $0x24,%esp
+  80837a:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80837d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  808380:	50                   	push   %eax
+  808381:	ff 75 08             	push   0x8(%ebp)
+  808384:	e8 9a f5 ff ff       	call   807923 <fd_lookup>
+  808389:	83 c4 10             	add    $0x10,%esp
+  80838c:	85 c0                	test   %eax,%eax
+  80838e:	0f 88 37 01 00 00    	js     8084cb <mmap+0x15a>
+		return NULL;
+  808394:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  808399:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80839c:	8b 0d a4 10 81 00    	mov    0x8110a4,%ecx
+  8083a2:	39 0a                	cmp    %ecx,(%edx)
+  8083a4:	0f 85 05 01 00 00    	jne    8084af <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8083aa:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8083b1:	0f 85 1b 01 00 00    	jne    8084d2 <mmap+0x161>
+  8083b7:	89 f0                	mov    %esi,%eax
+  8083b9:	83 e8 01             	sub    $0x1,%eax
+  8083bc:	0f 88 17 01 00 00    	js     8084d9 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8083c2:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8083c6:	75 28                	jne    8083f0 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8083c8:	83 ec 0c             	sub    $0xc,%esp
+  8083cb:	68 28 c1 84 00       	push   $0x84c128
+  8083d0:	e8 cb 16 00 00       	call   809aa0 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8083d5:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8083db:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8083e1:	83 c4 10             	add    $0x10,%esp
+  8083e4:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8083e9:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8083ee:	eb 2b                	jmp    80841b <mmap+0xaa>
+		cow_enable();
+  8083f0:	e8 30 22 00 00       	call   80a625 <cow_enable>
+  8083f5:	eb d1                	jmp    8083c8 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8083f7:	89 c2                	mov    %eax,%edx
+  8083f9:	c1 ea 0c             	shr    $0xc,%edx
+  8083fc:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  808403:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  808409:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80840f:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  808412:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  808414:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  808419:	77 25                	ja     808440 <mmap+0xcf>
+  80841b:	89 c2                	mov    %eax,%edx
+  80841d:	29 da                	sub    %ebx,%edx
+  80841f:	39 ca                	cmp    %ecx,%edx
+  808421:	73 3a                	jae    80845d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  808423:	89 c2                	mov    %eax,%edx
+  808425:	c1 ea 16             	shr    $0x16,%edx
+  808428:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80842f:	f6 c2 01             	test   $0x1,%dl
+  808432:	75 c3                	jne    8083f7 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  808434:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  808439:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80843e:	eb d4                	jmp    808414 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  808440:	29 d8                	sub    %ebx,%eax
+  808442:	39 c8                	cmp    %ecx,%eax
+  808444:	73 17                	jae    80845d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  808446:	83 ec 0c             	sub    $0xc,%esp
+  808449:	68 28 c1 84 00       	push   $0x84c128
+  80844e:	e8 ba 16 00 00       	call   809b0d <mutex_unlock>
+		return NULL;
+  808453:	83 c4 10             	add    $0x10,%esp
+  808456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80845b:	eb 52                	jmp    8084af <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80845d:	85 db                	test   %ebx,%ebx
+  80845f:	74 e5                	je     808446 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  808461:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808464:	8b 40 0c             	mov    0xc(%eax),%eax
+  808467:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	fsipcbuf.map.req_offset = offset;
+  80846c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80846f:	a3 04 d0 84 00       	mov    %eax,0x84d004
+	fsipcbuf.map.req_len = len;
+  808474:	89 35 08 d0 84 00    	mov    %esi,0x84d008
+	fsipcbuf.map.req_va = va;
+  80847a:	89 1d 0c d0 84 00    	mov    %ebx,0x84d00c
+	fsipcbuf.map.req_prot = prot;
+  808480:	8b 45 14             	mov    0x14(%ebp),%eax
+  808483:	a3 10 d0 84 00       	mov    %eax,0x84d010
+	r = fsipc(FSREQ_MAP, NULL);
+  808488:	ba 00 00 00 00       	mov    $0x0,%edx
+  80848d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  808492:	e8 46 fa ff ff       	call   807edd <fsipc>
+  808497:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  808499:	83 ec 0c             	sub    $0xc,%esp
+  80849c:	68 28 c1 84 00       	push   $0x84c128
+  8084a1:	e8 67 16 00 00       	call   809b0d <mutex_unlock>
+	if (r < 0) {
+  8084a6:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8084a9:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8084ab:	85 ff                	test   %edi,%edi
+  8084ad:	78 08                	js     8084b7 <mmap+0x146>
+}
+  8084af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8084b2:	5b                   	pop    %ebx
+  8084b3:	5e                   	pop    %esi
+  8084b4:	5f                   	pop    %edi
+  8084b5:	5d                   	pop    %ebp
+  8084b6:	c3                   	ret
+		munmap((void*) va, len);
+  8084b7:	83 ec 08             	sub    $0x8,%esp
+  8084ba:	56                   	push   %esi
+  8084bb:	53                   	push   %ebx
+  8084bc:	e8 71 fe ff ff       	call   808332 <munmap>
+		return NULL;
+  8084c1:	83 c4 10             	add    $0x10,%esp
+  8084c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084c9:	eb e4                	jmp    8084af <mmap+0x13e>
+		return NULL;
+  8084cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084d0:	eb dd                	jmp    8084af <mmap+0x13e>
+		return NULL;
+  8084d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084d7:	eb d6                	jmp    8084af <mmap+0x13e>
+  8084d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084de:	eb cf                	jmp    8084af <mmap+0x13e>
+
+008084e0 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8084e0:	55                   	push   %ebp
+  8084e1:	89 e5                	mov    %esp,%ebp
+  8084e3:	53                   	push   %ebx
+  8084e4:	83 ec 10             	sub    $0x10,%esp
+  8084e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8084ea:	53                   	push   %ebx
+  8084eb:	e8 ac e8 ff ff       	call   806d9c <strlen>
+  8084f0:	83 c4 10             	add    $0x10,%esp
+  8084f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8084f8:	7f 42                	jg     80853c <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8084fa:	83 ec 0c             	sub    $0xc,%esp
+  8084fd:	68 28 c1 84 00       	push   $0x84c128
+  808502:	e8 99 15 00 00       	call   809aa0 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  808507:	83 c4 08             	add    $0x8,%esp
+  80850a:	53                   	push   %ebx
+  80850b:	68 00 d0 84 00       	push   $0x84d000
+  808510:	e8 c2 e8 ff ff       	call   806dd7 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  808515:	ba 00 00 00 00       	mov    $0x0,%edx
+  80851a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80851f:	e8 b9 f9 ff ff       	call   807edd <fsipc>
+  808524:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  808526:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  80852d:	e8 db 15 00 00       	call   809b0d <mutex_unlock>
+	return r;
+  808532:	83 c4 10             	add    $0x10,%esp
+}
+  808535:	89 d8                	mov    %ebx,%eax
+  808537:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80853a:	c9                   	leave
+  80853b:	c3                   	ret
+		return -E_BAD_PATH;
+  80853c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  808541:	eb f2                	jmp    808535 <remove+0x55>
+
+00808543 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  808543:	55                   	push   %ebp
+  808544:	89 e5                	mov    %esp,%ebp
+  808546:	53                   	push   %ebx
+  808547:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80854a:	68 28 c1 84 00       	push   $0x84c128
+  80854f:	e8 4c 15 00 00       	call   809aa0 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  808554:	ba 00 00 00 00       	mov    $0x0,%edx
+  808559:	b8 08 00 00 00       	mov    $0x8,%eax
+  80855e:	e8 7a f9 ff ff       	call   807edd <fsipc>
+  808563:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  808565:	c7 04 24 28 c1 84 00 	movl   $0x84c128,(%esp)
+  80856c:	e8 9c 15 00 00       	call   809b0d <mutex_unlock>
+	return r;
+}
+  808571:	89 d8                	mov    %ebx,%eax
+  808573:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808576:	c9                   	leave
+  808577:	c3                   	ret
+
+00808578 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  808578:	55                   	push   %ebp
+  808579:	89 e5                	mov    %esp,%ebp
+  80857b:	56                   	push   %esi
+  80857c:	53                   	push   %ebx
+  80857d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  808580:	83 ec 0c             	sub    $0xc,%esp
+  808583:	68 28 c1 84 00       	push   $0x84c128
+  808588:	e8 13 15 00 00       	call   809aa0 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80858d:	8b 45 08             	mov    0x8(%ebp),%eax
+  808590:	a3 00 d0 84 00       	mov    %eax,0x84d000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  808595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80859a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80859f:	e8 39 f9 ff ff       	call   807edd <fsipc>
+  8085a4:	89 c6                	mov    %eax,%esi
+  8085a6:	83 c4 10             	add    $0x10,%esp
+  8085a9:	85 db                	test   %ebx,%ebx
+  8085ab:	74 7b                	je     808628 <fs_bcstat+0xb0>
+  8085ad:	85 c0                	test   %eax,%eax
+  8085af:	78 77                	js     808628 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8085b1:	a1 00 d0 84 00       	mov    0x84d000,%eax
+  8085b6:	89 03                	mov    %eax,(%ebx)
+  8085b8:	a1 04 d0 84 00       	mov    0x84d004,%eax
+  8085bd:	89 43 04             	mov    %eax,0x4(%ebx)
+  8085c0:	a1 08 d0 84 00       	mov    0x84d008,%eax
+  8085c5:	89 43 08             	mov    %eax,0x8(%ebx)
+  8085c8:	a1 0c d0 84 00       	mov    0x84d00c,%eax
+  8085cd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8085d0:	a1 10 d0 84 00       	mov    0x84d010,%eax
+  8085d5:	89 43 10             	mov    %eax,0x10(%ebx)
+  8085d8:	a1 14 d0 84 00       	mov    0x84d014,%eax
+  8085dd:	89 43 14             	mov    %eax,0x14(%ebx)
+  8085e0:	a1 18 d0 84 00       	mov    0x84d018,%eax
+  8085e5:	89 43 18             	mov    %eax,0x18(%ebx)
+  8085e8:	a1 1c d0 84 00       	mov    0x84d01c,%eax
+  8085ed:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8085f0:	a1 20 d0 84 00       	mov    0x84d020,%eax
+  8085f5:	89 43 20             	mov    %eax,0x20(%ebx)
+  8085f8:	a1 24 d0 84 00       	mov    0x84d024,%eax
+  8085fd:	89 43 24             	mov    %eax,0x24(%ebx)
+  808600:	a1 28 d0 84 00       	mov    0x84d028,%eax
+  808605:	89 43 28             	mov    %eax,0x28(%ebx)
+  808608:	a1 2c d0 84 00       	mov    0x84d02c,%eax
+  80860d:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  808610:	a1 30 d0 84 00       	mov    0x84d030,%eax
+  808615:	89 43 30             	mov    %eax,0x30(%ebx)
+  808618:	a1 34 d0 84 00       	mov    0x84d034,%eax
+  80861d:	89 43 34             	mov    %eax,0x34(%ebx)
+  808620:	a1 38 d0 84 00       	mov    0x84d038,%eax
+  808625:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  808628:	83 ec 0c             	sub    $0xc,%esp
+  80862b:	68 28 c1 84 00       	push   $0x84c128
+  808630:	e8 d8 14 00 00       	call   809b0d <mutex_unlock>
+	return r;
+}
+  808635:	89 f0                	mov    %esi,%eax
+  808637:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80863a:	5b                   	pop    %ebx
+  80863b:	5e                   	pop    %esi
+  80863c:	5d                   	pop    %ebp
+  80863d:	c3                   	ret
+
+0080863e <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80863e:	55                   	push   %ebp
+  80863f:	89 e5                	mov    %esp,%ebp
+  808641:	56                   	push   %esi
+  808642:	53                   	push   %ebx
+  808643:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  808645:	0f b6 10             	movzbl (%eax),%edx
+  808648:	80 fa 72             	cmp    $0x72,%dl
+  80864b:	74 44                	je     808691 <parse_mode+0x53>
+  80864d:	80 fa 77             	cmp    $0x77,%dl
+  808650:	74 4b                	je     80869d <parse_mode+0x5f>
+  808652:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  808657:	80 fa 61             	cmp    $0x61,%dl
+  80865a:	74 09                	je     808665 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80865c:	89 d8                	mov    %ebx,%eax
+  80865e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808661:	5b                   	pop    %ebx
+  808662:	5e                   	pop    %esi
+  808663:	5d                   	pop    %ebp
+  808664:	c3                   	ret
+	switch (mode[0]) {
+  808665:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80866a:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80866f:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  808671:	83 ec 08             	sub    $0x8,%esp
+  808674:	6a 2b                	push   $0x2b
+  808676:	50                   	push   %eax
+  808677:	e8 6d e8 ff ff       	call   806ee9 <strchr>
+  80867c:	83 c4 10             	add    $0x10,%esp
+  80867f:	85 c0                	test   %eax,%eax
+  808681:	74 d9                	je     80865c <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  808683:	83 e3 fc             	and    $0xfffffffc,%ebx
+  808686:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  808689:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80868f:	eb cb                	jmp    80865c <parse_mode+0x1e>
+	switch (mode[0]) {
+  808691:	ba 01 00 00 00       	mov    $0x1,%edx
+  808696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80869b:	eb d2                	jmp    80866f <parse_mode+0x31>
+  80869d:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8086a2:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8086a7:	eb c6                	jmp    80866f <parse_mode+0x31>
+
+008086a9 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8086a9:	55                   	push   %ebp
+  8086aa:	89 e5                	mov    %esp,%ebp
+  8086ac:	57                   	push   %edi
+  8086ad:	56                   	push   %esi
+  8086ae:	53                   	push   %ebx
+  8086af:	83 ec 1c             	sub    $0x1c,%esp
+  8086b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8086b5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8086b8:	b8 c4 10 81 00       	mov    $0x8110c4,%eax
+  8086bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8086c2:	83 c0 24             	add    $0x24,%eax
+  8086c5:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8086c9:	74 17                	je     8086e2 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8086cb:	83 c3 01             	add    $0x1,%ebx
+  8086ce:	83 fb 10             	cmp    $0x10,%ebx
+  8086d1:	75 ef                	jne    8086c2 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8086d3:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8086d8:	89 f0                	mov    %esi,%eax
+  8086da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8086dd:	5b                   	pop    %ebx
+  8086de:	5e                   	pop    %esi
+  8086df:	5f                   	pop    %edi
+  8086e0:	5d                   	pop    %ebp
+  8086e1:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8086e2:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8086e9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8086ec:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8086ef:	c1 e7 02             	shl    $0x2,%edi
+  8086f2:	8d b7 c0 10 81 00    	lea    0x8110c0(%edi),%esi
+  8086f8:	83 ec 04             	sub    $0x4,%esp
+  8086fb:	6a 24                	push   $0x24
+  8086fd:	6a 00                	push   $0x0
+  8086ff:	56                   	push   %esi
+  808700:	e8 23 e8 ff ff       	call   806f28 <memset>
+			streams[i].f_fd = fd;
+  808705:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  808708:	89 8f c0 10 81 00    	mov    %ecx,0x8110c0(%edi)
+			streams[i].f_flags = flags;
+  80870e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  808711:	01 d8                	add    %ebx,%eax
+  808713:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  808716:	89 0c 85 c4 10 81 00 	mov    %ecx,0x8110c4(,%eax,4)
+			return &streams[i];
+  80871d:	83 c4 10             	add    $0x10,%esp
+  808720:	eb b6                	jmp    8086d8 <stream_alloc+0x2f>
+
+00808722 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  808722:	55                   	push   %ebp
+  808723:	89 e5                	mov    %esp,%ebp
+  808725:	53                   	push   %ebx
+  808726:	83 ec 14             	sub    $0x14,%esp
+  808729:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80872b:	8b 40 18             	mov    0x18(%eax),%eax
+  80872e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  808731:	74 4a                	je     80877d <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  808733:	83 ec 08             	sub    $0x8,%esp
+  808736:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808739:	50                   	push   %eax
+  80873a:	ff 33                	push   (%ebx)
+  80873c:	e8 e2 f1 ff ff       	call   807923 <fd_lookup>
+  808741:	89 c2                	mov    %eax,%edx
+  808743:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  808746:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80874b:	85 d2                	test   %edx,%edx
+  80874d:	78 41                	js     808790 <stream_unread+0x6e>
+  80874f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  808752:	8b 0d a4 10 81 00    	mov    0x8110a4,%ecx
+  808758:	39 0a                	cmp    %ecx,(%edx)
+  80875a:	75 34                	jne    808790 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80875c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80875f:	03 42 04             	add    0x4(%edx),%eax
+  808762:	2b 43 18             	sub    0x18(%ebx),%eax
+  808765:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  808768:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80876f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  808776:	b8 01 00 00 00       	mov    $0x1,%eax
+  80877b:	eb 13                	jmp    808790 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80877d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  808784:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80878b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  808790:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808793:	c9                   	leave
+  808794:	c3                   	ret
+
+00808795 <stream_drain>:
+{
+  808795:	55                   	push   %ebp
+  808796:	89 e5                	mov    %esp,%ebp
+  808798:	56                   	push   %esi
+  808799:	53                   	push   %ebx
+  80879a:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80879c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8087a1:	eb 02                	jmp    8087a5 <stream_drain+0x10>
+  8087a3:	01 c3                	add    %eax,%ebx
+  8087a5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8087a8:	39 c3                	cmp    %eax,%ebx
+  8087aa:	73 43                	jae    8087ef <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8087ac:	83 ec 04             	sub    $0x4,%esp
+  8087af:	29 d8                	sub    %ebx,%eax
+  8087b1:	50                   	push   %eax
+  8087b2:	89 d8                	mov    %ebx,%eax
+  8087b4:	03 46 0c             	add    0xc(%esi),%eax
+  8087b7:	50                   	push   %eax
+  8087b8:	ff 36                	push   (%esi)
+  8087ba:	e8 ec f4 ff ff       	call   807cab <write>
+  8087bf:	83 c4 10             	add    $0x10,%esp
+  8087c2:	85 c0                	test   %eax,%eax
+  8087c4:	7f dd                	jg     8087a3 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8087c6:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8087ca:	8b 56 0c             	mov    0xc(%esi),%edx
+  8087cd:	83 ec 04             	sub    $0x4,%esp
+  8087d0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8087d3:	29 d8                	sub    %ebx,%eax
+  8087d5:	50                   	push   %eax
+  8087d6:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8087d9:	50                   	push   %eax
+  8087da:	52                   	push   %edx
+  8087db:	e8 7d e7 ff ff       	call   806f5d <memmove>
+			f->f_wend -= done;
+  8087e0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8087e3:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8087e5:	83 c4 10             	add    $0x10,%esp
+  8087e8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8087ed:	eb 0a                	jmp    8087f9 <stream_drain+0x64>
+  8087ef:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8087f4:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8087f9:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8087fc:	89 d0                	mov    %edx,%eax
+  8087fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808801:	5b                   	pop    %ebx
+  808802:	5e                   	pop    %esi
+  808803:	5d                   	pop    %ebp
+  808804:	c3                   	ret
+
+00808805 <stream_setup>:
+	if (f->f_buf)
+  808805:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  808809:	74 01                	je     80880c <stream_setup+0x7>
+  80880b:	c3                   	ret
+{
+  80880c:	55                   	push   %ebp
+  80880d:	89 e5                	mov    %esp,%ebp
+  80880f:	53                   	push   %ebx
+  808810:	83 ec 04             	sub    $0x4,%esp
+  808813:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  808815:	8b 40 08             	mov    0x8(%eax),%eax
+  808818:	85 c0                	test   %eax,%eax
+  80881a:	74 17                	je     808833 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80881c:	83 f8 03             	cmp    $0x3,%eax
+  80881f:	75 2d                	jne    80884e <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  808821:	8d 43 20             	lea    0x20(%ebx),%eax
+  808824:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  808827:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80882e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808831:	c9                   	leave
+  808832:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  808833:	83 ec 0c             	sub    $0xc,%esp
+  808836:	ff 33                	push   (%ebx)
+  808838:	e8 65 1b 00 00       	call   80a3a2 <iscons>
+  80883d:	83 c4 10             	add    $0x10,%esp
+  808840:	85 c0                	test   %eax,%eax
+  808842:	0f 9f c0             	setg   %al
+  808845:	0f b6 c0             	movzbl %al,%eax
+  808848:	83 c0 01             	add    $0x1,%eax
+  80884b:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80884e:	83 ec 0c             	sub    $0xc,%esp
+  808851:	68 00 10 00 00       	push   $0x1000
+  808856:	e8 aa 0b 00 00       	call   809405 <malloc>
+  80885b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80885e:	83 c4 10             	add    $0x10,%esp
+  808861:	85 c0                	test   %eax,%eax
+  808863:	74 bc                	je     808821 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  808865:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80886c:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  808870:	eb bc                	jmp    80882e <stream_setup+0x29>
+
+00808872 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  808872:	55                   	push   %ebp
+  808873:	89 e5                	mov    %esp,%ebp
+  808875:	53                   	push   %ebx
+  808876:	83 ec 04             	sub    $0x4,%esp
+  808879:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80887b:	e8 85 ff ff ff       	call   808805 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  808880:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  808885:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  808889:	74 3d                	je     8088c8 <stream_fill+0x56>
+  80888b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80888f:	74 10                	je     8088a1 <stream_fill+0x2f>
+  808891:	89 d8                	mov    %ebx,%eax
+  808893:	e8 fd fe ff ff       	call   808795 <stream_drain>
+		return 0;
+  808898:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80889d:	85 c0                	test   %eax,%eax
+  80889f:	78 27                	js     8088c8 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8088a1:	83 ec 04             	sub    $0x4,%esp
+  8088a4:	ff 73 10             	push   0x10(%ebx)
+  8088a7:	ff 73 0c             	push   0xc(%ebx)
+  8088aa:	ff 33                	push   (%ebx)
+  8088ac:	e8 02 f3 ff ff       	call   807bb3 <read>
+  8088b1:	83 c4 10             	add    $0x10,%esp
+  8088b4:	85 c0                	test   %eax,%eax
+  8088b6:	7e 17                	jle    8088cf <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8088b8:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8088bc:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8088c3:	89 c2                	mov    %eax,%edx
+  8088c5:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8088c8:	89 d0                	mov    %edx,%eax
+  8088ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8088cd:	c9                   	leave
+  8088ce:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8088cf:	c1 f8 1f             	sar    $0x1f,%eax
+  8088d2:	83 e0 04             	and    $0x4,%eax
+  8088d5:	83 c0 04             	add    $0x4,%eax
+  8088d8:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8088db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8088e0:	eb e6                	jmp    8088c8 <stream_fill+0x56>
+
+008088e2 <fopen>:
+{
+  8088e2:	55                   	push   %ebp
+  8088e3:	89 e5                	mov    %esp,%ebp
+  8088e5:	57                   	push   %edi
+  8088e6:	56                   	push   %esi
+  8088e7:	53                   	push   %ebx
+  8088e8:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8088ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8088f1:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8088f7:	89 f0                	mov    %esi,%eax
+  8088f9:	e8 40 fd ff ff       	call   80863e <parse_mode>
+		return 0;
+  8088fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  808903:	85 c0                	test   %eax,%eax
+  808905:	78 2d                	js     808934 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  808907:	83 ec 08             	sub    $0x8,%esp
+  80890a:	50                   	push   %eax
+  80890b:	ff 75 08             	push   0x8(%ebp)
+  80890e:	e8 e8 f8 ff ff       	call   8081fb <open>
+  808913:	89 c7                	mov    %eax,%edi
+  808915:	83 c4 10             	add    $0x10,%esp
+  808918:	85 c0                	test   %eax,%eax
+  80891a:	78 58                	js     808974 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80891c:	80 3e 61             	cmpb   $0x61,(%esi)
+  80891f:	74 1d                	je     80893e <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  808921:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  808927:	89 f8                	mov    %edi,%eax
+  808929:	e8 7b fd ff ff       	call   8086a9 <stream_alloc>
+  80892e:	89 c3                	mov    %eax,%ebx
+  808930:	85 c0                	test   %eax,%eax
+  808932:	74 32                	je     808966 <fopen+0x84>
+}
+  808934:	89 d8                	mov    %ebx,%eax
+  808936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808939:	5b                   	pop    %ebx
+  80893a:	5e                   	pop    %esi
+  80893b:	5f                   	pop    %edi
+  80893c:	5d                   	pop    %ebp
+  80893d:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80893e:	83 ec 08             	sub    $0x8,%esp
+  808941:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  808947:	50                   	push   %eax
+  808948:	57                   	push   %edi
+  808949:	e8 db f4 ff ff       	call   807e29 <fstat>
+  80894e:	83 c4 10             	add    $0x10,%esp
+  808951:	85 c0                	test   %eax,%eax
+  808953:	78 cc                	js     808921 <fopen+0x3f>
+		seek(fd, st.st_size);
+  808955:	83 ec 08             	sub    $0x8,%esp
+  808958:	ff 75 dc             	push   -0x24(%ebp)
+  80895b:	57                   	push   %edi
+  80895c:	e8 f6 f3 ff ff       	call   807d57 <seek>
+  808961:	83 c4 10             	add    $0x10,%esp
+  808964:	eb bb                	jmp    808921 <fopen+0x3f>
+		close(fd);
+  808966:	83 ec 0c             	sub    $0xc,%esp
+  808969:	57                   	push   %edi
+  80896a:	e8 08 f1 ff ff       	call   807a77 <close>
+  80896f:	83 c4 10             	add    $0x10,%esp
+  808972:	eb c0                	jmp    808934 <fopen+0x52>
+		return 0;
+  808974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808979:	eb b9                	jmp    808934 <fopen+0x52>
+
+0080897b <fdopen>:
+{
+  80897b:	55                   	push   %ebp
+  80897c:	89 e5                	mov    %esp,%ebp
+  80897e:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  808981:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  808984:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808987:	e8 b2 fc ff ff       	call   80863e <parse_mode>
+  80898c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80898e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  808993:	85 d2                	test   %edx,%edx
+  808995:	78 0b                	js     8089a2 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  808997:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80899a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80899d:	e8 07 fd ff ff       	call   8086a9 <stream_alloc>
+}
+  8089a2:	c9                   	leave
+  8089a3:	c3                   	ret
+
+008089a4 <setvbuf>:
+{
+  8089a4:	55                   	push   %ebp
+  8089a5:	89 e5                	mov    %esp,%ebp
+  8089a7:	57                   	push   %edi
+  8089a8:	56                   	push   %esi
+  8089a9:	53                   	push   %ebx
+  8089aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8089ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8089b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8089b3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8089b7:	75 3a                	jne    8089f3 <setvbuf+0x4f>
+  8089b9:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8089bc:	83 fe 02             	cmp    $0x2,%esi
+  8089bf:	77 39                	ja     8089fa <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8089c1:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8089c4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8089c8:	0f 95 c3             	setne  %bl
+  8089cb:	85 ff                	test   %edi,%edi
+  8089cd:	0f 95 c1             	setne  %cl
+  8089d0:	84 cb                	test   %cl,%bl
+  8089d2:	74 05                	je     8089d9 <setvbuf+0x35>
+  8089d4:	83 fa 03             	cmp    $0x3,%edx
+  8089d7:	75 0a                	jne    8089e3 <setvbuf+0x3f>
+	return 0;
+  8089d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8089de:	5b                   	pop    %ebx
+  8089df:	5e                   	pop    %esi
+  8089e0:	5f                   	pop    %edi
+  8089e1:	5d                   	pop    %ebp
+  8089e2:	c3                   	ret
+		f->f_buf = buf;
+  8089e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8089e6:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8089e9:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8089ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8089f1:	eb eb                	jmp    8089de <setvbuf+0x3a>
+		return EOF;
+  8089f3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8089f8:	eb e4                	jmp    8089de <setvbuf+0x3a>
+  8089fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8089ff:	eb dd                	jmp    8089de <setvbuf+0x3a>
+
+00808a01 <fflush>:
+{
+  808a01:	55                   	push   %ebp
+  808a02:	89 e5                	mov    %esp,%ebp
+  808a04:	57                   	push   %edi
+  808a05:	56                   	push   %esi
+  808a06:	53                   	push   %ebx
+  808a07:	83 ec 0c             	sub    $0xc,%esp
+  808a0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  808a0d:	85 db                	test   %ebx,%ebx
+  808a0f:	74 1a                	je     808a2b <fflush+0x2a>
+	stream_unread(f);
+  808a11:	89 d8                	mov    %ebx,%eax
+  808a13:	e8 0a fd ff ff       	call   808722 <stream_unread>
+	return stream_drain(f);
+  808a18:	89 d8                	mov    %ebx,%eax
+  808a1a:	e8 76 fd ff ff       	call   808795 <stream_drain>
+  808a1f:	89 c7                	mov    %eax,%edi
+}
+  808a21:	89 f8                	mov    %edi,%eax
+  808a23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808a26:	5b                   	pop    %ebx
+  808a27:	5e                   	pop    %esi
+  808a28:	5f                   	pop    %edi
+  808a29:	5d                   	pop    %ebp
+  808a2a:	c3                   	ret
+  808a2b:	bb c0 10 81 00       	mov    $0x8110c0,%ebx
+  808a30:	be 00 13 81 00       	mov    $0x811300,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  808a35:	bf 00 00 00 00       	mov    $0x0,%edi
+  808a3a:	eb 03                	jmp    808a3f <fflush+0x3e>
+  808a3c:	83 c3 24             	add    $0x24,%ebx
+  808a3f:	39 f3                	cmp    %esi,%ebx
+  808a41:	74 de                	je     808a21 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  808a43:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  808a47:	74 f3                	je     808a3c <fflush+0x3b>
+  808a49:	83 ec 0c             	sub    $0xc,%esp
+  808a4c:	53                   	push   %ebx
+  808a4d:	e8 af ff ff ff       	call   808a01 <fflush>
+  808a52:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  808a55:	85 c0                	test   %eax,%eax
+  808a57:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  808a5c:	0f 48 f8             	cmovs  %eax,%edi
+  808a5f:	eb db                	jmp    808a3c <fflush+0x3b>
+
+00808a61 <fclose>:
+{
+  808a61:	55                   	push   %ebp
+  808a62:	89 e5                	mov    %esp,%ebp
+  808a64:	56                   	push   %esi
+  808a65:	53                   	push   %ebx
+  808a66:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  808a69:	83 ec 0c             	sub    $0xc,%esp
+  808a6c:	56                   	push   %esi
+  808a6d:	e8 8f ff ff ff       	call   808a01 <fflush>
+  808a72:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  808a74:	83 c4 04             	add    $0x4,%esp
+  808a77:	ff 36                	push   (%esi)
+  808a79:	e8 f9 ef ff ff       	call   807a77 <close>
+  808a7e:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  808a81:	85 c0                	test   %eax,%eax
+  808a83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  808a88:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  808a8b:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  808a8f:	75 10                	jne    808aa1 <fclose+0x40>
+	f->f_flags = 0;
+  808a91:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  808a98:	89 d8                	mov    %ebx,%eax
+  808a9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808a9d:	5b                   	pop    %ebx
+  808a9e:	5e                   	pop    %esi
+  808a9f:	5d                   	pop    %ebp
+  808aa0:	c3                   	ret
+		free(f->f_buf);
+  808aa1:	83 ec 0c             	sub    $0xc,%esp
+  808aa4:	ff 76 0c             	push   0xc(%esi)
+  808aa7:	e8 90 08 00 00       	call   80933c <free>
+  808aac:	83 c4 10             	add    $0x10,%esp
+  808aaf:	eb e0                	jmp    808a91 <fclose+0x30>
+
+00808ab1 <fileno>:
+{
+  808ab1:	55                   	push   %ebp
+  808ab2:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  808ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  808ab7:	8b 00                	mov    (%eax),%eax
+}
+  808ab9:	5d                   	pop    %ebp
+  808aba:	c3                   	ret
+
+00808abb <feof>:
+{
+  808abb:	55                   	push   %ebp
+  808abc:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  808abe:	8b 45 08             	mov    0x8(%ebp),%eax
+  808ac1:	8b 40 04             	mov    0x4(%eax),%eax
+  808ac4:	c1 e8 02             	shr    $0x2,%eax
+  808ac7:	83 e0 01             	and    $0x1,%eax
+}
+  808aca:	5d                   	pop    %ebp
+  808acb:	c3                   	ret
+
+00808acc <ferror>:
+{
+  808acc:	55                   	push   %ebp
+  808acd:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  808acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  808ad2:	8b 40 04             	mov    0x4(%eax),%eax
+  808ad5:	c1 e8 03             	shr    $0x3,%eax
+  808ad8:	83 e0 01             	and    $0x1,%eax
+}
+  808adb:	5d                   	pop    %ebp
+  808adc:	c3                   	ret
+
+00808add <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  808add:	55                   	push   %ebp
+  808ade:	89 e5                	mov    %esp,%ebp
+  808ae0:	53                   	push   %ebx
+  808ae1:	83 ec 04             	sub    $0x4,%esp
+  808ae4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  808ae7:	8b 43 18             	mov    0x18(%ebx),%eax
+  808aea:	39 43 14             	cmp    %eax,0x14(%ebx)
+  808aed:	74 15                	je     808b04 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  808aef:	8b 53 0c             	mov    0xc(%ebx),%edx
+  808af2:	8b 43 14             	mov    0x14(%ebx),%eax
+  808af5:	8d 48 01             	lea    0x1(%eax),%ecx
+  808af8:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  808afb:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  808aff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808b02:	c9                   	leave
+  808b03:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  808b04:	89 d8                	mov    %ebx,%eax
+  808b06:	e8 67 fd ff ff       	call   808872 <stream_fill>
+  808b0b:	85 c0                	test   %eax,%eax
+  808b0d:	75 e0                	jne    808aef <fgetc+0x12>
+		return EOF;
+  808b0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  808b14:	eb e9                	jmp    808aff <fgetc+0x22>
+
+00808b16 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  808b16:	55                   	push   %ebp
+  808b17:	89 e5                	mov    %esp,%ebp
+  808b19:	57                   	push   %edi
+  808b1a:	56                   	push   %esi
+  808b1b:	53                   	push   %ebx
+  808b1c:	83 ec 1c             	sub    $0x1c,%esp
+  808b1f:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  808b22:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  808b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808b2a:	83 e8 01             	sub    $0x1,%eax
+  808b2d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  808b30:	eb 66                	jmp    808b98 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  808b32:	8b 46 14             	mov    0x14(%esi),%eax
+  808b35:	8b 5e 18             	mov    0x18(%esi),%ebx
+  808b38:	29 c3                	sub    %eax,%ebx
+  808b3a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  808b3d:	29 fa                	sub    %edi,%edx
+  808b3f:	39 d3                	cmp    %edx,%ebx
+  808b41:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  808b44:	83 ec 04             	sub    $0x4,%esp
+  808b47:	53                   	push   %ebx
+  808b48:	6a 0a                	push   $0xa
+  808b4a:	03 46 0c             	add    0xc(%esi),%eax
+  808b4d:	50                   	push   %eax
+  808b4e:	e8 bb e4 ff ff       	call   80700e <memfind>
+  808b53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  808b56:	8b 46 0c             	mov    0xc(%esi),%eax
+  808b59:	8b 4e 14             	mov    0x14(%esi),%ecx
+  808b5c:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  808b5f:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  808b61:	83 c4 10             	add    $0x10,%esp
+  808b64:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  808b67:	74 0b                	je     808b74 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  808b69:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  808b6c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  808b6f:	29 d3                	sub    %edx,%ebx
+  808b71:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  808b74:	83 ec 04             	sub    $0x4,%esp
+  808b77:	53                   	push   %ebx
+  808b78:	01 c8                	add    %ecx,%eax
+  808b7a:	50                   	push   %eax
+  808b7b:	89 f8                	mov    %edi,%eax
+  808b7d:	03 45 08             	add    0x8(%ebp),%eax
+  808b80:	50                   	push   %eax
+  808b81:	e8 d7 e3 ff ff       	call   806f5d <memmove>
+		f->f_rpos += m;
+  808b86:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  808b89:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  808b8b:	83 c4 10             	add    $0x10,%esp
+  808b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  808b91:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  808b96:	74 1f                	je     808bb7 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  808b98:	8d 47 01             	lea    0x1(%edi),%eax
+  808b9b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  808b9e:	73 17                	jae    808bb7 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  808ba0:	8b 46 18             	mov    0x18(%esi),%eax
+  808ba3:	39 46 14             	cmp    %eax,0x14(%esi)
+  808ba6:	75 8a                	jne    808b32 <fgets+0x1c>
+  808ba8:	89 f0                	mov    %esi,%eax
+  808baa:	e8 c3 fc ff ff       	call   808872 <stream_fill>
+  808baf:	85 c0                	test   %eax,%eax
+  808bb1:	0f 85 7b ff ff ff    	jne    808b32 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  808bb7:	85 ff                	test   %edi,%edi
+  808bb9:	74 0f                	je     808bca <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  808bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  808bbe:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  808bc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808bc5:	5b                   	pop    %ebx
+  808bc6:	5e                   	pop    %esi
+  808bc7:	5f                   	pop    %edi
+  808bc8:	5d                   	pop    %ebp
+  808bc9:	c3                   	ret
+		return 0;
+  808bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  808bcf:	eb f1                	jmp    808bc2 <fgets+0xac>
+
+00808bd1 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  808bd1:	55                   	push   %ebp
+  808bd2:	89 e5                	mov    %esp,%ebp
+  808bd4:	57                   	push   %edi
+  808bd5:	56                   	push   %esi
+  808bd6:	53                   	push   %ebx
+  808bd7:	83 ec 1c             	sub    $0x1c,%esp
+  808bda:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  808bdd:	89 f0                	mov    %esi,%eax
+  808bdf:	e8 21 fc ff ff       	call   808805 <stream_setup>
+	want = size * n;
+  808be4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808be7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  808beb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  808bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  808bf3:	eb 43                	jmp    808c38 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  808bf5:	29 d3                	sub    %edx,%ebx
+  808bf7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808bfa:	29 f8                	sub    %edi,%eax
+  808bfc:	39 c3                	cmp    %eax,%ebx
+  808bfe:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  808c01:	83 ec 04             	sub    $0x4,%esp
+  808c04:	53                   	push   %ebx
+  808c05:	03 56 0c             	add    0xc(%esi),%edx
+  808c08:	52                   	push   %edx
+  808c09:	89 f8                	mov    %edi,%eax
+  808c0b:	03 45 08             	add    0x8(%ebp),%eax
+  808c0e:	50                   	push   %eax
+  808c0f:	e8 49 e3 ff ff       	call   806f5d <memmove>
+			f->f_rpos += m;
+  808c14:	01 5e 14             	add    %ebx,0x14(%esi)
+  808c17:	83 c4 10             	add    $0x10,%esp
+  808c1a:	eb 1a                	jmp    808c36 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  808c1c:	83 ec 04             	sub    $0x4,%esp
+  808c1f:	53                   	push   %ebx
+  808c20:	89 f8                	mov    %edi,%eax
+  808c22:	03 45 08             	add    0x8(%ebp),%eax
+  808c25:	50                   	push   %eax
+  808c26:	ff 36                	push   (%esi)
+  808c28:	e8 86 ef ff ff       	call   807bb3 <read>
+  808c2d:	89 c3                	mov    %eax,%ebx
+  808c2f:	83 c4 10             	add    $0x10,%esp
+  808c32:	85 c0                	test   %eax,%eax
+  808c34:	7e 36                	jle    808c6c <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  808c36:	01 df                	add    %ebx,%edi
+  808c38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808c3b:	39 c7                	cmp    %eax,%edi
+  808c3d:	73 39                	jae    808c78 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  808c3f:	8b 56 14             	mov    0x14(%esi),%edx
+  808c42:	8b 5e 18             	mov    0x18(%esi),%ebx
+  808c45:	39 da                	cmp    %ebx,%edx
+  808c47:	72 ac                	jb     808bf5 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  808c49:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  808c4c:	29 fb                	sub    %edi,%ebx
+  808c4e:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  808c51:	72 3e                	jb     808c91 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  808c53:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  808c57:	74 1f                	je     808c78 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  808c59:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  808c5d:	74 bd                	je     808c1c <fread+0x4b>
+  808c5f:	89 f0                	mov    %esi,%eax
+  808c61:	e8 2f fb ff ff       	call   808795 <stream_drain>
+  808c66:	85 c0                	test   %eax,%eax
+  808c68:	79 b2                	jns    808c1c <fread+0x4b>
+  808c6a:	eb 0c                	jmp    808c78 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  808c6c:	c1 fb 1f             	sar    $0x1f,%ebx
+  808c6f:	83 e3 04             	and    $0x4,%ebx
+  808c72:	83 c3 04             	add    $0x4,%ebx
+  808c75:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  808c78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808c7b:	85 c0                	test   %eax,%eax
+  808c7d:	74 0a                	je     808c89 <fread+0xb8>
+  808c7f:	89 f8                	mov    %edi,%eax
+  808c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  808c86:	f7 75 0c             	divl   0xc(%ebp)
+}
+  808c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808c8c:	5b                   	pop    %ebx
+  808c8d:	5e                   	pop    %esi
+  808c8e:	5f                   	pop    %edi
+  808c8f:	5d                   	pop    %ebp
+  808c90:	c3                   	ret
+		} else if (!stream_fill(f))
+  808c91:	89 f0                	mov    %esi,%eax
+  808c93:	e8 da fb ff ff       	call   808872 <stream_fill>
+  808c98:	85 c0                	test   %eax,%eax
+  808c9a:	74 dc                	je     808c78 <fread+0xa7>
+			m = 0;
+  808c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808ca1:	eb 93                	jmp    808c36 <fread+0x65>
+
+00808ca3 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  808ca3:	55                   	push   %ebp
+  808ca4:	89 e5                	mov    %esp,%ebp
+  808ca6:	57                   	push   %edi
+  808ca7:	56                   	push   %esi
+  808ca8:	53                   	push   %ebx
+  808ca9:	83 ec 1c             	sub    $0x1c,%esp
+  808cac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  808caf:	8b 43 04             	mov    0x4(%ebx),%eax
+  808cb2:	a8 02                	test   $0x2,%al
+  808cb4:	75 13                	jne    808cc9 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  808cb6:	83 c8 08             	or     $0x8,%eax
+  808cb9:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  808cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  808cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808cc4:	5b                   	pop    %ebx
+  808cc5:	5e                   	pop    %esi
+  808cc6:	5f                   	pop    %edi
+  808cc7:	5d                   	pop    %ebp
+  808cc8:	c3                   	ret
+	stream_setup(f);
+  808cc9:	89 d8                	mov    %ebx,%eax
+  808ccb:	e8 35 fb ff ff       	call   808805 <stream_setup>
+	want = size * n;
+  808cd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808cd3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  808cd7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  808cda:	89 d8                	mov    %ebx,%eax
+  808cdc:	e8 41 fa ff ff       	call   808722 <stream_unread>
+	for (done = 0; done < want; ) {
+  808ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  808ce6:	84 c0                	test   %al,%al
+  808ce8:	75 7b                	jne    808d65 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  808cea:	be 00 00 00 00       	mov    $0x0,%esi
+  808cef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  808cf2:	39 fe                	cmp    %edi,%esi
+  808cf4:	73 24                	jae    808d1a <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  808cf6:	83 ec 04             	sub    $0x4,%esp
+  808cf9:	89 f8                	mov    %edi,%eax
+  808cfb:	29 f0                	sub    %esi,%eax
+  808cfd:	50                   	push   %eax
+  808cfe:	89 f0                	mov    %esi,%eax
+  808d00:	03 45 08             	add    0x8(%ebp),%eax
+  808d03:	50                   	push   %eax
+  808d04:	ff 33                	push   (%ebx)
+  808d06:	e8 a0 ef ff ff       	call   807cab <write>
+  808d0b:	83 c4 10             	add    $0x10,%esp
+  808d0e:	85 c0                	test   %eax,%eax
+  808d10:	7e 04                	jle    808d16 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  808d12:	01 c6                	add    %eax,%esi
+  808d14:	eb dc                	jmp    808cf2 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  808d16:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  808d1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808d1d:	85 c0                	test   %eax,%eax
+  808d1f:	74 a0                	je     808cc1 <fwrite+0x1e>
+  808d21:	89 f0                	mov    %esi,%eax
+  808d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  808d28:	f7 75 0c             	divl   0xc(%ebp)
+  808d2b:	eb 94                	jmp    808cc1 <fwrite+0x1e>
+			done += r;
+  808d2d:	01 c7                	add    %eax,%edi
+			continue;
+  808d2f:	eb 34                	jmp    808d65 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  808d31:	8b 73 10             	mov    0x10(%ebx),%esi
+  808d34:	29 c6                	sub    %eax,%esi
+  808d36:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  808d39:	29 fa                	sub    %edi,%edx
+  808d3b:	39 d6                	cmp    %edx,%esi
+  808d3d:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  808d40:	83 ec 04             	sub    $0x4,%esp
+  808d43:	56                   	push   %esi
+  808d44:	89 fa                	mov    %edi,%edx
+  808d46:	03 55 08             	add    0x8(%ebp),%edx
+  808d49:	52                   	push   %edx
+  808d4a:	03 43 0c             	add    0xc(%ebx),%eax
+  808d4d:	50                   	push   %eax
+  808d4e:	e8 0a e2 ff ff       	call   806f5d <memmove>
+		f->f_wend += m;
+  808d53:	89 f0                	mov    %esi,%eax
+  808d55:	03 43 1c             	add    0x1c(%ebx),%eax
+  808d58:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  808d5b:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  808d5d:	83 c4 10             	add    $0x10,%esp
+  808d60:	3b 43 10             	cmp    0x10(%ebx),%eax
+  808d63:	74 5b                	je     808dc0 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  808d65:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808d68:	39 c7                	cmp    %eax,%edi
+  808d6a:	73 2d                	jae    808d99 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  808d6c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  808d6f:	85 c0                	test   %eax,%eax
+  808d71:	75 be                	jne    808d31 <fwrite+0x8e>
+  808d73:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  808d76:	29 fa                	sub    %edi,%edx
+  808d78:	3b 53 10             	cmp    0x10(%ebx),%edx
+  808d7b:	72 b4                	jb     808d31 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  808d7d:	83 ec 04             	sub    $0x4,%esp
+  808d80:	52                   	push   %edx
+  808d81:	89 f8                	mov    %edi,%eax
+  808d83:	03 45 08             	add    0x8(%ebp),%eax
+  808d86:	50                   	push   %eax
+  808d87:	ff 33                	push   (%ebx)
+  808d89:	e8 1d ef ff ff       	call   807cab <write>
+  808d8e:	83 c4 10             	add    $0x10,%esp
+  808d91:	85 c0                	test   %eax,%eax
+  808d93:	7f 98                	jg     808d2d <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  808d95:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  808d99:	8b 43 08             	mov    0x8(%ebx),%eax
+  808d9c:	83 f8 03             	cmp    $0x3,%eax
+  808d9f:	74 48                	je     808de9 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  808da1:	83 f8 02             	cmp    $0x2,%eax
+  808da4:	74 27                	je     808dcd <fwrite+0x12a>
+	return size ? done / size : 0;
+  808da6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808da9:	85 c0                	test   %eax,%eax
+  808dab:	0f 84 10 ff ff ff    	je     808cc1 <fwrite+0x1e>
+  808db1:	89 f8                	mov    %edi,%eax
+  808db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  808db8:	f7 75 0c             	divl   0xc(%ebp)
+  808dbb:	e9 01 ff ff ff       	jmp    808cc1 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  808dc0:	89 d8                	mov    %ebx,%eax
+  808dc2:	e8 ce f9 ff ff       	call   808795 <stream_drain>
+  808dc7:	85 c0                	test   %eax,%eax
+  808dc9:	79 9a                	jns    808d65 <fwrite+0xc2>
+  808dcb:	eb cc                	jmp    808d99 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  808dcd:	83 ec 04             	sub    $0x4,%esp
+  808dd0:	57                   	push   %edi
+  808dd1:	6a 0a                	push   $0xa
+  808dd3:	ff 75 08             	push   0x8(%ebp)
+  808dd6:	e8 33 e2 ff ff       	call   80700e <memfind>
+  808ddb:	89 c2                	mov    %eax,%edx
+  808ddd:	89 f8                	mov    %edi,%eax
+  808ddf:	03 45 08             	add    0x8(%ebp),%eax
+  808de2:	83 c4 10             	add    $0x10,%esp
+  808de5:	39 c2                	cmp    %eax,%edx
+  808de7:	74 bd                	je     808da6 <fwrite+0x103>
+		stream_drain(f);
+  808de9:	89 d8                	mov    %ebx,%eax
+  808deb:	e8 a5 f9 ff ff       	call   808795 <stream_drain>
+  808df0:	eb b4                	jmp    808da6 <fwrite+0x103>
+
+00808df2 <fputc>:
+{
+  808df2:	55                   	push   %ebp
+  808df3:	89 e5                	mov    %esp,%ebp
+  808df5:	53                   	push   %ebx
+  808df6:	83 ec 14             	sub    $0x14,%esp
+  808df9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  808dfc:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  808dff:	ff 75 0c             	push   0xc(%ebp)
+  808e02:	6a 01                	push   $0x1
+  808e04:	6a 01                	push   $0x1
+  808e06:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  808e09:	50                   	push   %eax
+  808e0a:	e8 94 fe ff ff       	call   808ca3 <fwrite>
+  808e0f:	83 c4 10             	add    $0x10,%esp
+  808e12:	0f b6 db             	movzbl %bl,%ebx
+  808e15:	83 f8 01             	cmp    $0x1,%eax
+  808e18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  808e1d:	0f 44 c3             	cmove  %ebx,%eax
+}
+  808e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808e23:	c9                   	leave
+  808e24:	c3                   	ret
+
+00808e25 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  808e25:	55                   	push   %ebp
+  808e26:	89 e5                	mov    %esp,%ebp
+  808e28:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  808e2b:	ff 75 0c             	push   0xc(%ebp)
+  808e2e:	ff 75 08             	push   0x8(%ebp)
+  808e31:	e8 bc ff ff ff       	call   808df2 <fputc>
+}
+  808e36:	83 c4 10             	add    $0x10,%esp
+  808e39:	c9                   	leave
+  808e3a:	c3                   	ret
+
+00808e3b <fputs>:
+{
+  808e3b:	55                   	push   %ebp
+  808e3c:	89 e5                	mov    %esp,%ebp
+  808e3e:	56                   	push   %esi
+  808e3f:	53                   	push   %ebx
+  808e40:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  808e43:	83 ec 0c             	sub    $0xc,%esp
+  808e46:	56                   	push   %esi
+  808e47:	e8 50 df ff ff       	call   806d9c <strlen>
+  808e4c:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  808e4e:	ff 75 0c             	push   0xc(%ebp)
+  808e51:	50                   	push   %eax
+  808e52:	6a 01                	push   $0x1
+  808e54:	56                   	push   %esi
+  808e55:	e8 49 fe ff ff       	call   808ca3 <fwrite>
+  808e5a:	83 c4 20             	add    $0x20,%esp
+  808e5d:	39 d8                	cmp    %ebx,%eax
+  808e5f:	0f 95 c0             	setne  %al
+  808e62:	0f b6 c0             	movzbl %al,%eax
+  808e65:	f7 d8                	neg    %eax
+}
+  808e67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808e6a:	5b                   	pop    %ebx
+  808e6b:	5e                   	pop    %esi
+  808e6c:	5d                   	pop    %ebp
+  808e6d:	c3                   	ret
+
+00808e6e <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  808e6e:	55                   	push   %ebp
+  808e6f:	89 e5                	mov    %esp,%ebp
+  808e71:	53                   	push   %ebx
+  808e72:	83 ec 04             	sub    $0x4,%esp
+  808e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  808e78:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  808e7b:	50                   	push   %eax
+  808e7c:	ff 75 0c             	push   0xc(%ebp)
+  808e7f:	53                   	push   %ebx
+  808e80:	68 25 8e 80 00       	push   $0x808e25
+  808e85:	e8 60 da ff ff       	call   8068ea <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  808e8a:	8b 43 04             	mov    0x4(%ebx),%eax
+  808e8d:	c1 e0 1c             	shl    $0x1c,%eax
+  808e90:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  808e93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808e96:	c9                   	leave
+  808e97:	c3                   	ret
+
+00808e98 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  808e98:	55                   	push   %ebp
+  808e99:	89 e5                	mov    %esp,%ebp
+  808e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  808e9e:	89 c2                	mov    %eax,%edx
+  808ea0:	c1 ea 16             	shr    $0x16,%edx
+  808ea3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  808eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  808eaf:	f6 c1 01             	test   $0x1,%cl
+  808eb2:	74 1c                	je     808ed0 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  808eb4:	c1 e8 0c             	shr    $0xc,%eax
+  808eb7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  808ebe:	a8 01                	test   $0x1,%al
+  808ec0:	74 0e                	je     808ed0 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  808ec2:	c1 e8 0c             	shr    $0xc,%eax
+  808ec5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  808ecc:	ef 
+  808ecd:	0f b7 d2             	movzwl %dx,%edx
+}
+  808ed0:	89 d0                	mov    %edx,%eax
+  808ed2:	5d                   	pop    %ebp
+  808ed3:	c3                   	ret
+
+00808ed4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  808ed4:	55                   	push   %ebp
+  808ed5:	89 e5                	mov    %esp,%ebp
+  808ed7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  808eda:	68 58 be 80 00       	push   $0x80be58
+  808edf:	ff 75 0c             	push   0xc(%ebp)
+  808ee2:	e8 f0 de ff ff       	call   806dd7 <strcpy>
+	return 0;
+}
+  808ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  808eec:	c9                   	leave
+  808eed:	c3                   	ret
+
+00808eee <devsock_close>:
+{
+  808eee:	55                   	push   %ebp
+  808eef:	89 e5                	mov    %esp,%ebp
+  808ef1:	53                   	push   %ebx
+  808ef2:	83 ec 10             	sub    $0x10,%esp
+  808ef5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  808ef8:	53                   	push   %ebx
+  808ef9:	e8 9a ff ff ff       	call   808e98 <pageref>
+  808efe:	89 c2                	mov    %eax,%edx
+  808f00:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  808f03:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  808f08:	83 fa 01             	cmp    $0x1,%edx
+  808f0b:	74 05                	je     808f12 <devsock_close+0x24>
+}
+  808f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808f10:	c9                   	leave
+  808f11:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  808f12:	83 ec 0c             	sub    $0xc,%esp
+  808f15:	ff 73 0c             	push   0xc(%ebx)
+  808f18:	e8 b7 02 00 00       	call   8091d4 <nsipc_close>
+  808f1d:	83 c4 10             	add    $0x10,%esp
+  808f20:	eb eb                	jmp    808f0d <devsock_close+0x1f>
+
+00808f22 <devsock_write>:
+{
+  808f22:	55                   	push   %ebp
+  808f23:	89 e5                	mov    %esp,%ebp
+  808f25:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  808f28:	6a 00                	push   $0x0
+  808f2a:	ff 75 10             	push   0x10(%ebp)
+  808f2d:	ff 75 0c             	push   0xc(%ebp)
+  808f30:	8b 45 08             	mov    0x8(%ebp),%eax
+  808f33:	ff 70 0c             	push   0xc(%eax)
+  808f36:	e8 79 03 00 00       	call   8092b4 <nsipc_send>
+}
+  808f3b:	c9                   	leave
+  808f3c:	c3                   	ret
+
+00808f3d <devsock_read>:
+{
+  808f3d:	55                   	push   %ebp
+  808f3e:	89 e5                	mov    %esp,%ebp
+  808f40:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  808f43:	6a 00                	push   $0x0
+  808f45:	ff 75 10             	push   0x10(%ebp)
+  808f48:	ff 75 0c             	push   0xc(%ebp)
+  808f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  808f4e:	ff 70 0c             	push   0xc(%eax)
+  808f51:	e8 ef 02 00 00       	call   809245 <nsipc_recv>
+}
+  808f56:	c9                   	leave
+  808f57:	c3                   	ret
+
+00808f58 <fd2sockid>:
+{
+  808f58:	55                   	push   %ebp
+  808f59:	89 e5                	mov    %esp,%ebp
+  808f5b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  808f5e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  808f61:	52                   	push   %edx
+  808f62:	50                   	push   %eax
+  808f63:	e8 bb e9 ff ff       	call   807923 <fd_lookup>
+  808f68:	83 c4 10             	add    $0x10,%esp
+  808f6b:	85 c0                	test   %eax,%eax
+  808f6d:	78 10                	js     808f7f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  808f6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808f72:	8b 0d 00 13 81 00    	mov    0x811300,%ecx
+  808f78:	39 08                	cmp    %ecx,(%eax)
+  808f7a:	75 05                	jne    808f81 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  808f7c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  808f7f:	c9                   	leave
+  808f80:	c3                   	ret
+		return -E_NOT_SUPP;
+  808f81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  808f86:	eb f7                	jmp    808f7f <fd2sockid+0x27>
+
+00808f88 <alloc_sockfd>:
+{
+  808f88:	55                   	push   %ebp
+  808f89:	89 e5                	mov    %esp,%ebp
+  808f8b:	56                   	push   %esi
+  808f8c:	53                   	push   %ebx
+  808f8d:	83 ec 1c             	sub    $0x1c,%esp
+  808f90:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  808f92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808f95:	50                   	push   %eax
+  808f96:	e8 32 e9 ff ff       	call   8078cd <fd_alloc>
+  808f9b:	89 c3                	mov    %eax,%ebx
+  808f9d:	83 c4 10             	add    $0x10,%esp
+  808fa0:	85 c0                	test   %eax,%eax
+  808fa2:	78 43                	js     808fe7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  808fa4:	83 ec 04             	sub    $0x4,%esp
+  808fa7:	68 07 04 00 00       	push   $0x407
+  808fac:	ff 75 f4             	push   -0xc(%ebp)
+  808faf:	6a 00                	push   $0x0
+  808fb1:	e8 5f e2 ff ff       	call   807215 <sys_page_alloc>
+  808fb6:	89 c3                	mov    %eax,%ebx
+  808fb8:	83 c4 10             	add    $0x10,%esp
+  808fbb:	85 c0                	test   %eax,%eax
+  808fbd:	78 28                	js     808fe7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  808fbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808fc2:	8b 15 00 13 81 00    	mov    0x811300,%edx
+  808fc8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  808fca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808fcd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  808fd4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  808fd7:	83 ec 0c             	sub    $0xc,%esp
+  808fda:	50                   	push   %eax
+  808fdb:	e8 c6 e8 ff ff       	call   8078a6 <fd2num>
+  808fe0:	89 c3                	mov    %eax,%ebx
+  808fe2:	83 c4 10             	add    $0x10,%esp
+  808fe5:	eb 0c                	jmp    808ff3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  808fe7:	83 ec 0c             	sub    $0xc,%esp
+  808fea:	56                   	push   %esi
+  808feb:	e8 e4 01 00 00       	call   8091d4 <nsipc_close>
+		return r;
+  808ff0:	83 c4 10             	add    $0x10,%esp
+}
+  808ff3:	89 d8                	mov    %ebx,%eax
+  808ff5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808ff8:	5b                   	pop    %ebx
+  808ff9:	5e                   	pop    %esi
+  808ffa:	5d                   	pop    %ebp
+  808ffb:	c3                   	ret
+
+00808ffc <accept>:
+{
+  808ffc:	55                   	push   %ebp
+  808ffd:	89 e5                	mov    %esp,%ebp
+  808fff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  809002:	8b 45 08             	mov    0x8(%ebp),%eax
+  809005:	e8 4e ff ff ff       	call   808f58 <fd2sockid>
+  80900a:	85 c0                	test   %eax,%eax
+  80900c:	78 1b                	js     809029 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80900e:	83 ec 04             	sub    $0x4,%esp
+  809011:	ff 75 10             	push   0x10(%ebp)
+  809014:	ff 75 0c             	push   0xc(%ebp)
+  809017:	50                   	push   %eax
+  809018:	e8 0e 01 00 00       	call   80912b <nsipc_accept>
+  80901d:	83 c4 10             	add    $0x10,%esp
+  809020:	85 c0                	test   %eax,%eax
+  809022:	78 05                	js     809029 <accept+0x2d>
+	return alloc_sockfd(r);
+  809024:	e8 5f ff ff ff       	call   808f88 <alloc_sockfd>
+}
+  809029:	c9                   	leave
+  80902a:	c3                   	ret
+
+0080902b <bind>:
+{
+  80902b:	55                   	push   %ebp
+  80902c:	89 e5                	mov    %esp,%ebp
+  80902e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  809031:	8b 45 08             	mov    0x8(%ebp),%eax
+  809034:	e8 1f ff ff ff       	call   808f58 <fd2sockid>
+  809039:	85 c0                	test   %eax,%eax
+  80903b:	78 12                	js     80904f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80903d:	83 ec 04             	sub    $0x4,%esp
+  809040:	ff 75 10             	push   0x10(%ebp)
+  809043:	ff 75 0c             	push   0xc(%ebp)
+  809046:	50                   	push   %eax
+  809047:	e8 31 01 00 00       	call   80917d <nsipc_bind>
+  80904c:	83 c4 10             	add    $0x10,%esp
+}
+  80904f:	c9                   	leave
+  809050:	c3                   	ret
+
+00809051 <shutdown>:
+{
+  809051:	55                   	push   %ebp
+  809052:	89 e5                	mov    %esp,%ebp
+  809054:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  809057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80905a:	e8 f9 fe ff ff       	call   808f58 <fd2sockid>
+  80905f:	85 c0                	test   %eax,%eax
+  809061:	78 0f                	js     809072 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  809063:	83 ec 08             	sub    $0x8,%esp
+  809066:	ff 75 0c             	push   0xc(%ebp)
+  809069:	50                   	push   %eax
+  80906a:	e8 43 01 00 00       	call   8091b2 <nsipc_shutdown>
+  80906f:	83 c4 10             	add    $0x10,%esp
+}
+  809072:	c9                   	leave
+  809073:	c3                   	ret
+
+00809074 <connect>:
+{
+  809074:	55                   	push   %ebp
+  809075:	89 e5                	mov    %esp,%ebp
+  809077:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80907a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80907d:	e8 d6 fe ff ff       	call   808f58 <fd2sockid>
+  809082:	85 c0                	test   %eax,%eax
+  809084:	78 12                	js     809098 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  809086:	83 ec 04             	sub    $0x4,%esp
+  809089:	ff 75 10             	push   0x10(%ebp)
+  80908c:	ff 75 0c             	push   0xc(%ebp)
+  80908f:	50                   	push   %eax
+  809090:	e8 59 01 00 00       	call   8091ee <nsipc_connect>
+  809095:	83 c4 10             	add    $0x10,%esp
+}
+  809098:	c9                   	leave
+  809099:	c3                   	ret
+
+0080909a <listen>:
+{
+  80909a:	55                   	push   %ebp
+  80909b:	89 e5                	mov    %esp,%ebp
+  80909d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8090a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8090a3:	e8 b0 fe ff ff       	call   808f58 <fd2sockid>
+  8090a8:	85 c0                	test   %eax,%eax
+  8090aa:	78 0f                	js     8090bb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8090ac:	83 ec 08             	sub    $0x8,%esp
+  8090af:	ff 75 0c             	push   0xc(%ebp)
+  8090b2:	50                   	push   %eax
+  8090b3:	e8 6b 01 00 00       	call   809223 <nsipc_listen>
+  8090b8:	83 c4 10             	add    $0x10,%esp
+}
+  8090bb:	c9                   	leave
+  8090bc:	c3                   	ret
+
+008090bd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8090bd:	55                   	push   %ebp
+  8090be:	89 e5                	mov    %esp,%ebp
+  8090c0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8090c3:	ff 75 10             	push   0x10(%ebp)
+  8090c6:	ff 75 0c             	push   0xc(%ebp)
+  8090c9:	ff 75 08             	push   0x8(%ebp)
+  8090cc:	e8 41 02 00 00       	call   809312 <nsipc_socket>
+  8090d1:	83 c4 10             	add    $0x10,%esp
+  8090d4:	85 c0                	test   %eax,%eax
+  8090d6:	78 05                	js     8090dd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8090d8:	e8 ab fe ff ff       	call   808f88 <alloc_sockfd>
+}
+  8090dd:	c9                   	leave
+  8090de:	c3                   	ret
+
+008090df <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8090df:	55                   	push   %ebp
+  8090e0:	89 e5                	mov    %esp,%ebp
+  8090e2:	53                   	push   %ebx
+  8090e3:	83 ec 04             	sub    $0x4,%esp
+  8090e6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8090e8:	83 3d 2c c1 84 00 00 	cmpl   $0x0,0x84c12c
+  8090ef:	74 26                	je     809117 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8090f1:	6a 07                	push   $0x7
+  8090f3:	68 00 e0 84 00       	push   $0x84e000
+  8090f8:	53                   	push   %ebx
+  8090f9:	ff 35 2c c1 84 00    	push   0x84c12c
+  8090ff:	e8 0d e7 ff ff       	call   807811 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  809104:	83 c4 0c             	add    $0xc,%esp
+  809107:	6a 00                	push   $0x0
+  809109:	6a 00                	push   $0x0
+  80910b:	6a 00                	push   $0x0
+  80910d:	e8 09 e6 ff ff       	call   80771b <ipc_recv>
+}
+  809112:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  809115:	c9                   	leave
+  809116:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  809117:	83 ec 0c             	sub    $0xc,%esp
+  80911a:	6a 02                	push   $0x2
+  80911c:	e8 46 e7 ff ff       	call   807867 <ipc_find_env>
+  809121:	a3 2c c1 84 00       	mov    %eax,0x84c12c
+  809126:	83 c4 10             	add    $0x10,%esp
+  809129:	eb c6                	jmp    8090f1 <nsipc+0x12>
+
+0080912b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80912b:	55                   	push   %ebp
+  80912c:	89 e5                	mov    %esp,%ebp
+  80912e:	56                   	push   %esi
+  80912f:	53                   	push   %ebx
+  809130:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  809133:	8b 45 08             	mov    0x8(%ebp),%eax
+  809136:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80913b:	8b 06                	mov    (%esi),%eax
+  80913d:	a3 04 e0 84 00       	mov    %eax,0x84e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  809142:	b8 01 00 00 00       	mov    $0x1,%eax
+  809147:	e8 93 ff ff ff       	call   8090df <nsipc>
+  80914c:	89 c3                	mov    %eax,%ebx
+  80914e:	85 c0                	test   %eax,%eax
+  809150:	79 09                	jns    80915b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  809152:	89 d8                	mov    %ebx,%eax
+  809154:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  809157:	5b                   	pop    %ebx
+  809158:	5e                   	pop    %esi
+  809159:	5d                   	pop    %ebp
+  80915a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80915b:	83 ec 04             	sub    $0x4,%esp
+  80915e:	ff 35 10 e0 84 00    	push   0x84e010
+  809164:	68 00 e0 84 00       	push   $0x84e000
+  809169:	ff 75 0c             	push   0xc(%ebp)
+  80916c:	e8 ec dd ff ff       	call   806f5d <memmove>
+		*addrlen = ret->ret_addrlen;
+  809171:	a1 10 e0 84 00       	mov    0x84e010,%eax
+  809176:	89 06                	mov    %eax,(%esi)
+  809178:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80917b:	eb d5                	jmp    809152 <nsipc_accept+0x27>
+
+0080917d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80917d:	55                   	push   %ebp
+  80917e:	89 e5                	mov    %esp,%ebp
+  809180:	53                   	push   %ebx
+  809181:	83 ec 08             	sub    $0x8,%esp
+  809184:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  809187:	8b 45 08             	mov    0x8(%ebp),%eax
+  80918a:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80918f:	53                   	push   %ebx
+  809190:	ff 75 0c             	push   0xc(%ebp)
+  809193:	68 04 e0 84 00       	push   $0x84e004
+  809198:	e8 c0 dd ff ff       	call   806f5d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80919d:	89 1d 14 e0 84 00    	mov    %ebx,0x84e014
+	return nsipc(NSREQ_BIND);
+  8091a3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8091a8:	e8 32 ff ff ff       	call   8090df <nsipc>
+}
+  8091ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8091b0:	c9                   	leave
+  8091b1:	c3                   	ret
+
+008091b2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8091b2:	55                   	push   %ebp
+  8091b3:	89 e5                	mov    %esp,%ebp
+  8091b5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8091b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8091bb:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	nsipcbuf.shutdown.req_how = how;
+  8091c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8091c3:	a3 04 e0 84 00       	mov    %eax,0x84e004
+	return nsipc(NSREQ_SHUTDOWN);
+  8091c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8091cd:	e8 0d ff ff ff       	call   8090df <nsipc>
+}
+  8091d2:	c9                   	leave
+  8091d3:	c3                   	ret
+
+008091d4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8091d4:	55                   	push   %ebp
+  8091d5:	89 e5                	mov    %esp,%ebp
+  8091d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8091da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8091dd:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	return nsipc(NSREQ_CLOSE);
+  8091e2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8091e7:	e8 f3 fe ff ff       	call   8090df <nsipc>
+}
+  8091ec:	c9                   	leave
+  8091ed:	c3                   	ret
+
+008091ee <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8091ee:	55                   	push   %ebp
+  8091ef:	89 e5                	mov    %esp,%ebp
+  8091f1:	53                   	push   %ebx
+  8091f2:	83 ec 08             	sub    $0x8,%esp
+  8091f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8091f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8091fb:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  809200:	53                   	push   %ebx
+  809201:	ff 75 0c             	push   0xc(%ebp)
+  809204:	68 04 e0 84 00       	push   $0x84e004
+  809209:	e8 4f dd ff ff       	call   806f5d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80920e:	89 1d 14 e0 84 00    	mov    %ebx,0x84e014
+	return nsipc(NSREQ_CONNECT);
+  809214:	b8 05 00 00 00       	mov    $0x5,%eax
+  809219:	e8 c1 fe ff ff       	call   8090df <nsipc>
+}
+  80921e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  809221:	c9                   	leave
+  809222:	c3                   	ret
+
+00809223 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  809223:	55                   	push   %ebp
+  809224:	89 e5                	mov    %esp,%ebp
+  809226:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  809229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80922c:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	nsipcbuf.listen.req_backlog = backlog;
+  809231:	8b 45 0c             	mov    0xc(%ebp),%eax
+  809234:	a3 04 e0 84 00       	mov    %eax,0x84e004
+	return nsipc(NSREQ_LISTEN);
+  809239:	b8 06 00 00 00       	mov    $0x6,%eax
+  80923e:	e8 9c fe ff ff       	call   8090df <nsipc>
+}
+  809243:	c9                   	leave
+  809244:	c3                   	ret
+
+00809245 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  809245:	55                   	push   %ebp
+  809246:	89 e5                	mov    %esp,%ebp
+  809248:	56                   	push   %esi
+  809249:	53                   	push   %ebx
+  80924a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80924d:	8b 45 08             	mov    0x8(%ebp),%eax
+  809250:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	nsipcbuf.recv.req_len = len;
+  809255:	89 35 04 e0 84 00    	mov    %esi,0x84e004
+	nsipcbuf.recv.req_flags = flags;
+  80925b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80925e:	a3 08 e0 84 00       	mov    %eax,0x84e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  809263:	b8 07 00 00 00       	mov    $0x7,%eax
+  809268:	e8 72 fe ff ff       	call   8090df <nsipc>
+  80926d:	89 c3                	mov    %eax,%ebx
+  80926f:	85 c0                	test   %eax,%eax
+  809271:	78 22                	js     809295 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  809273:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  809278:	39 c6                	cmp    %eax,%esi
+  80927a:	0f 4e c6             	cmovle %esi,%eax
+  80927d:	39 c3                	cmp    %eax,%ebx
+  80927f:	7f 1d                	jg     80929e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  809281:	83 ec 04             	sub    $0x4,%esp
+  809284:	53                   	push   %ebx
+  809285:	68 00 e0 84 00       	push   $0x84e000
+  80928a:	ff 75 0c             	push   0xc(%ebp)
+  80928d:	e8 cb dc ff ff       	call   806f5d <memmove>
+  809292:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  809295:	89 d8                	mov    %ebx,%eax
+  809297:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80929a:	5b                   	pop    %ebx
+  80929b:	5e                   	pop    %esi
+  80929c:	5d                   	pop    %ebp
+  80929d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80929e:	68 64 be 80 00       	push   $0x80be64
+  8092a3:	68 2b ad 80 00       	push   $0x80ad2b
+  8092a8:	6a 62                	push   $0x62
+  8092aa:	68 79 be 80 00       	push   $0x80be79
+  8092af:	e8 64 d4 ff ff       	call   806718 <_panic>
+
+008092b4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8092b4:	55                   	push   %ebp
+  8092b5:	89 e5                	mov    %esp,%ebp
+  8092b7:	53                   	push   %ebx
+  8092b8:	83 ec 04             	sub    $0x4,%esp
+  8092bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8092be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8092c1:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	assert(size < 1600);
+  8092c6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8092cc:	7f 2e                	jg     8092fc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8092ce:	83 ec 04             	sub    $0x4,%esp
+  8092d1:	53                   	push   %ebx
+  8092d2:	ff 75 0c             	push   0xc(%ebp)
+  8092d5:	68 0c e0 84 00       	push   $0x84e00c
+  8092da:	e8 7e dc ff ff       	call   806f5d <memmove>
+	nsipcbuf.send.req_size = size;
+  8092df:	89 1d 04 e0 84 00    	mov    %ebx,0x84e004
+	nsipcbuf.send.req_flags = flags;
+  8092e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8092e8:	a3 08 e0 84 00       	mov    %eax,0x84e008
+	return nsipc(NSREQ_SEND);
+  8092ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8092f2:	e8 e8 fd ff ff       	call   8090df <nsipc>
+}
+  8092f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8092fa:	c9                   	leave
+  8092fb:	c3                   	ret
+	assert(size < 1600);
+  8092fc:	68 85 be 80 00       	push   $0x80be85
+  809301:	68 2b ad 80 00       	push   $0x80ad2b
+  809306:	6a 6d                	push   $0x6d
+  809308:	68 79 be 80 00       	push   $0x80be79
+  80930d:	e8 06 d4 ff ff       	call   806718 <_panic>
+
+00809312 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  809312:	55                   	push   %ebp
+  809313:	89 e5                	mov    %esp,%ebp
+  809315:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  809318:	8b 45 08             	mov    0x8(%ebp),%eax
+  80931b:	a3 00 e0 84 00       	mov    %eax,0x84e000
+	nsipcbuf.socket.req_type = type;
+  809320:	8b 45 0c             	mov    0xc(%ebp),%eax
+  809323:	a3 04 e0 84 00       	mov    %eax,0x84e004
+	nsipcbuf.socket.req_protocol = protocol;
+  809328:	8b 45 10             	mov    0x10(%ebp),%eax
+  80932b:	a3 08 e0 84 00       	mov    %eax,0x84e008
+	return nsipc(NSREQ_SOCKET);
+  809330:	b8 09 00 00 00       	mov    $0x9,%eax
+  809335:	e8 a5 fd ff ff       	call   8090df <nsipc>
+}
+  80933a:	c9                   	leave
+  80933b:	c3                   	ret
+
+0080933c <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80933c:	55                   	push   %ebp
+  80933d:	89 e5                	mov    %esp,%ebp
+  80933f:	53                   	push   %ebx
+  809340:	83 ec 10             	sub    $0x10,%esp
+  809343:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  809346:	68 30 c1 84 00       	push   $0x84c130
+  80934b:	e8 50 07 00 00       	call   809aa0 <mutex_lock>
+	if (v == 0)
+  809350:	83 c4 10             	add    $0x10,%esp
+  809353:	85 db                	test   %ebx,%ebx
+  809355:	0f 84 85 00 00 00    	je     8093e0 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80935b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  809361:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  809366:	77 51                	ja     8093b9 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  809368:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80936e:	89 d8                	mov    %ebx,%eax
+  809370:	c1 e8 0c             	shr    $0xc,%eax
+  809373:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80937a:	f6 c4 02             	test   $0x2,%ah
+  80937d:	74 50                	je     8093cf <free+0x93>
+		sys_page_unmap(0, c);
+  80937f:	83 ec 08             	sub    $0x8,%esp
+  809382:	53                   	push   %ebx
+  809383:	6a 00                	push   $0x0
+  809385:	e8 24 df ff ff       	call   8072ae <sys_page_unmap>
+		c += PGSIZE;
+  80938a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  809390:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  809396:	83 c4 10             	add    $0x10,%esp
+  809399:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80939e:	76 ce                	jbe    80936e <free+0x32>
+  8093a0:	68 cf be 80 00       	push   $0x80becf
+  8093a5:	68 2b ad 80 00       	push   $0x80ad2b
+  8093aa:	68 82 00 00 00       	push   $0x82
+  8093af:	68 c2 be 80 00       	push   $0x80bec2
+  8093b4:	e8 5f d3 ff ff       	call   806718 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8093b9:	68 94 be 80 00       	push   $0x80be94
+  8093be:	68 2b ad 80 00       	push   $0x80ad2b
+  8093c3:	6a 7b                	push   $0x7b
+  8093c5:	68 c2 be 80 00       	push   $0x80bec2
+  8093ca:	e8 49 d3 ff ff       	call   806718 <_panic>
+	if (--(*ref) == 0)
+  8093cf:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8093d5:	83 e8 01             	sub    $0x1,%eax
+  8093d8:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8093de:	74 15                	je     8093f5 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8093e0:	83 ec 0c             	sub    $0xc,%esp
+  8093e3:	68 30 c1 84 00       	push   $0x84c130
+  8093e8:	e8 20 07 00 00       	call   809b0d <mutex_unlock>
+}
+  8093ed:	83 c4 10             	add    $0x10,%esp
+  8093f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8093f3:	c9                   	leave
+  8093f4:	c3                   	ret
+		sys_page_unmap(0, c);
+  8093f5:	83 ec 08             	sub    $0x8,%esp
+  8093f8:	53                   	push   %ebx
+  8093f9:	6a 00                	push   $0x0
+  8093fb:	e8 ae de ff ff       	call   8072ae <sys_page_unmap>
+  809400:	83 c4 10             	add    $0x10,%esp
+  809403:	eb db                	jmp    8093e0 <free+0xa4>
+
+00809405 <malloc>:
+{
+  809405:	55                   	push   %ebp
+  809406:	89 e5                	mov    %esp,%ebp
+  809408:	57                   	push   %edi
+  809409:	56                   	push   %esi
+  80940a:	53                   	push   %ebx
+  80940b:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80940e:	68 30 c1 84 00       	push   $0x84c130
+  809413:	e8 88 06 00 00       	call   809aa0 <mutex_lock>
+	if (mptr == 0)
+  809418:	8b 3d 34 c1 84 00    	mov    0x84c134,%edi
+  80941e:	83 c4 10             	add    $0x10,%esp
+  809421:	85 ff                	test   %edi,%edi
+  809423:	74 6c                	je     809491 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  809425:	8b 45 08             	mov    0x8(%ebp),%eax
+  809428:	83 c0 03             	add    $0x3,%eax
+  80942b:	83 e0 fc             	and    $0xfffffffc,%eax
+  80942e:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  809430:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  809435:	0f 87 64 01 00 00    	ja     80959f <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80943b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  809441:	74 30                	je     809473 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  809443:	89 f9                	mov    %edi,%ecx
+  809445:	c1 e9 0c             	shr    $0xc,%ecx
+  809448:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80944c:	c1 e8 0c             	shr    $0xc,%eax
+  80944f:	39 c1                	cmp    %eax,%ecx
+  809451:	74 5f                	je     8094b2 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  809453:	83 ec 0c             	sub    $0xc,%esp
+  809456:	57                   	push   %edi
+  809457:	e8 e0 fe ff ff       	call   80933c <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80945c:	a1 34 c1 84 00       	mov    0x84c134,%eax
+  809461:	05 00 10 00 00       	add    $0x1000,%eax
+  809466:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80946b:	a3 34 c1 84 00       	mov    %eax,0x84c134
+  809470:	83 c4 10             	add    $0x10,%esp
+  809473:	8b 0d 34 c1 84 00    	mov    0x84c134,%ecx
+{
+  809479:	ba 02 00 00 00       	mov    $0x2,%edx
+  80947e:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  809482:	8d 7e 04             	lea    0x4(%esi),%edi
+  809485:	89 cb                	mov    %ecx,%ebx
+  809487:	01 f9                	add    %edi,%ecx
+  809489:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80948c:	e9 8b 00 00 00       	jmp    80951c <malloc+0x117>
+		mptr = mbegin;
+  809491:	c7 05 34 c1 84 00 00 	movl   $0x8000000,0x84c134
+  809498:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80949b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80949e:	83 c0 03             	add    $0x3,%eax
+  8094a1:	83 e0 fc             	and    $0xfffffffc,%eax
+  8094a4:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8094a6:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8094ab:	76 c6                	jbe    809473 <malloc+0x6e>
+  8094ad:	e9 d6 00 00 00       	jmp    809588 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8094b2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8094b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8094bd:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8094c1:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8094c4:	a3 34 c1 84 00       	mov    %eax,0x84c134
+			return v;
+  8094c9:	e9 ba 00 00 00       	jmp    809588 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8094ce:	05 00 10 00 00       	add    $0x1000,%eax
+  8094d3:	39 c8                	cmp    %ecx,%eax
+  8094d5:	0f 83 cb 00 00 00    	jae    8095a6 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8094db:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8094e0:	77 22                	ja     809504 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8094e2:	89 c2                	mov    %eax,%edx
+  8094e4:	c1 ea 16             	shr    $0x16,%edx
+  8094e7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8094ee:	f6 c2 01             	test   $0x1,%dl
+  8094f1:	74 db                	je     8094ce <malloc+0xc9>
+  8094f3:	89 c2                	mov    %eax,%edx
+  8094f5:	c1 ea 0c             	shr    $0xc,%edx
+  8094f8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8094ff:	f6 c2 01             	test   $0x1,%dl
+  809502:	74 ca                	je     8094ce <malloc+0xc9>
+		if (mptr == mend) {
+  809504:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80950a:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  809510:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  809514:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80951a:	74 04                	je     809520 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80951c:	89 d8                	mov    %ebx,%eax
+  80951e:	eb b3                	jmp    8094d3 <malloc+0xce>
+  809520:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  809523:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  809528:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80952c:	83 ea 01             	sub    $0x1,%edx
+  80952f:	0f 85 50 ff ff ff    	jne    809485 <malloc+0x80>
+  809535:	c7 05 34 c1 84 00 00 	movl   $0x8000000,0x84c134
+  80953c:	00 00 08 
+				return 0;	/* out of address space */
+  80953f:	bf 00 00 00 00       	mov    $0x0,%edi
+  809544:	eb 42                	jmp    809588 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  809546:	85 db                	test   %ebx,%ebx
+  809548:	78 1e                	js     809568 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80954a:	83 ec 08             	sub    $0x8,%esp
+  80954d:	89 d8                	mov    %ebx,%eax
+  80954f:	03 05 34 c1 84 00    	add    0x84c134,%eax
+  809555:	50                   	push   %eax
+  809556:	6a 00                	push   $0x0
+  809558:	e8 51 dd ff ff       	call   8072ae <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80955d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  809563:	83 c4 10             	add    $0x10,%esp
+  809566:	eb de                	jmp    809546 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  809568:	bf 00 00 00 00       	mov    $0x0,%edi
+  80956d:	eb 19                	jmp    809588 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80956f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  809572:	8b 3d 34 c1 84 00    	mov    0x84c134,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  809578:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80957f:	00 
+	mptr += n;
+  809580:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  809583:	a3 34 c1 84 00       	mov    %eax,0x84c134
+	mutex_unlock(&malloc_mu);
+  809588:	83 ec 0c             	sub    $0xc,%esp
+  80958b:	68 30 c1 84 00       	push   $0x84c130
+  809590:	e8 78 05 00 00       	call   809b0d <mutex_unlock>
+}
+  809595:	89 f8                	mov    %edi,%eax
+  809597:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80959a:	5b                   	pop    %ebx
+  80959b:	5e                   	pop    %esi
+  80959c:	5f                   	pop    %edi
+  80959d:	5d                   	pop    %ebp
+  80959e:	c3                   	ret
+		return 0;
+  80959f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8095a4:	eb e2                	jmp    809588 <malloc+0x183>
+  8095a6:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8095aa:	74 06                	je     8095b2 <malloc+0x1ad>
+  8095ac:	89 1d 34 c1 84 00    	mov    %ebx,0x84c134
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8095b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8095b7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8095ba:	39 fb                	cmp    %edi,%ebx
+  8095bc:	73 b1                	jae    80956f <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8095be:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8095c4:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8095c7:	39 fe                	cmp    %edi,%esi
+  8095c9:	0f 92 c0             	setb   %al
+  8095cc:	0f b6 c0             	movzbl %al,%eax
+  8095cf:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8095d2:	83 c8 07             	or     $0x7,%eax
+  8095d5:	50                   	push   %eax
+  8095d6:	89 d8                	mov    %ebx,%eax
+  8095d8:	03 05 34 c1 84 00    	add    0x84c134,%eax
+  8095de:	50                   	push   %eax
+  8095df:	6a 00                	push   $0x0
+  8095e1:	e8 2f dc ff ff       	call   807215 <sys_page_alloc>
+  8095e6:	83 c4 10             	add    $0x10,%esp
+  8095e9:	85 c0                	test   %eax,%eax
+  8095eb:	0f 88 55 ff ff ff    	js     809546 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8095f1:	89 f3                	mov    %esi,%ebx
+  8095f3:	eb c5                	jmp    8095ba <malloc+0x1b5>
+
+008095f5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8095f5:	55                   	push   %ebp
+  8095f6:	89 e5                	mov    %esp,%ebp
+  8095f8:	56                   	push   %esi
+  8095f9:	53                   	push   %ebx
+  8095fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8095fd:	83 ec 0c             	sub    $0xc,%esp
+  809600:	ff 75 08             	push   0x8(%ebp)
+  809603:	e8 ae e2 ff ff       	call   8078b6 <fd2data>
+  809608:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80960a:	83 c4 08             	add    $0x8,%esp
+  80960d:	68 e7 be 80 00       	push   $0x80bee7
+  809612:	53                   	push   %ebx
+  809613:	e8 bf d7 ff ff       	call   806dd7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  809618:	8b 46 04             	mov    0x4(%esi),%eax
+  80961b:	2b 06                	sub    (%esi),%eax
+  80961d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  809623:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80962a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80962d:	c7 83 88 00 00 00 1c 	movl   $0x81131c,0x88(%ebx)
+  809634:	13 81 00 
+	return 0;
+}
+  809637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80963c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80963f:	5b                   	pop    %ebx
+  809640:	5e                   	pop    %esi
+  809641:	5d                   	pop    %ebp
+  809642:	c3                   	ret
+
+00809643 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  809643:	b9 00 00 00 00       	mov    $0x0,%ecx
+  809648:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80964c:	85 c9                	test   %ecx,%ecx
+  80964e:	75 01                	jne    809651 <pipewake+0xe>
+  809650:	c3                   	ret
+{
+  809651:	55                   	push   %ebp
+  809652:	89 e5                	mov    %esp,%ebp
+  809654:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  809657:	68 00 04 00 00       	push   $0x400
+  80965c:	52                   	push   %edx
+  80965d:	e8 f7 de ff ff       	call   807559 <sys_futex_wake>
+  809662:	83 c4 10             	add    $0x10,%esp
+}
+  809665:	c9                   	leave
+  809666:	c3                   	ret
+
+00809667 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  809667:	55                   	push   %ebp
+  809668:	89 e5                	mov    %esp,%ebp
+  80966a:	56                   	push   %esi
+  80966b:	53                   	push   %ebx
+  80966c:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80966f:	83 ec 0c             	sub    $0xc,%esp
+  809672:	56                   	push   %esi
+  809673:	e8 3e e2 ff ff       	call   8078b6 <fd2data>
+  809678:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80967a:	83 c4 08             	add    $0x8,%esp
+  80967d:	56                   	push   %esi
+  80967e:	6a 00                	push   $0x0
+  809680:	e8 29 dc ff ff       	call   8072ae <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  809685:	8d 53 04             	lea    0x4(%ebx),%edx
+  809688:	8d 43 08             	lea    0x8(%ebx),%eax
+  80968b:	e8 b3 ff ff ff       	call   809643 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  809690:	8d 43 0c             	lea    0xc(%ebx),%eax
+  809693:	89 da                	mov    %ebx,%edx
+  809695:	e8 a9 ff ff ff       	call   809643 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80969a:	89 34 24             	mov    %esi,(%esp)
+  80969d:	e8 14 e2 ff ff       	call   8078b6 <fd2data>
+  8096a2:	83 c4 08             	add    $0x8,%esp
+  8096a5:	50                   	push   %eax
+  8096a6:	6a 00                	push   $0x0
+  8096a8:	e8 01 dc ff ff       	call   8072ae <sys_page_unmap>
+}
+  8096ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8096b0:	5b                   	pop    %ebx
+  8096b1:	5e                   	pop    %esi
+  8096b2:	5d                   	pop    %ebp
+  8096b3:	c3                   	ret
+
+008096b4 <_pipeisclosed>:
+{
+  8096b4:	55                   	push   %ebp
+  8096b5:	89 e5                	mov    %esp,%ebp
+  8096b7:	57                   	push   %edi
+  8096b8:	56                   	push   %esi
+  8096b9:	53                   	push   %ebx
+  8096ba:	83 ec 1c             	sub    $0x1c,%esp
+  8096bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8096c0:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8096c2:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8096c7:	eb 5d                	jmp    809726 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8096c9:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		n = thisenv->env_runs;
+  8096cf:	8b 02                	mov    (%edx),%eax
+  8096d1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8096d4:	83 ec 0c             	sub    $0xc,%esp
+  8096d7:	ff 75 e0             	push   -0x20(%ebp)
+  8096da:	e8 b9 f7 ff ff       	call   808e98 <pageref>
+  8096df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8096e2:	89 3c 24             	mov    %edi,(%esp)
+  8096e5:	e8 ae f7 ff ff       	call   808e98 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8096ea:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8096ec:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8096f2:	83 c4 10             	add    $0x10,%esp
+  8096f5:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8096fb:	77 15                	ja     809712 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8096fd:	89 f2                	mov    %esi,%edx
+  8096ff:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  809701:	c1 ea 10             	shr    $0x10,%edx
+  809704:	74 0c                	je     809712 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  809706:	c1 e2 10             	shl    $0x10,%edx
+  809709:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80970e:	29 d1                	sub    %edx,%ecx
+  809710:	eb 06                	jmp    809718 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  809712:	8b 0d 40 c4 84 00    	mov    0x84c440,%ecx
+		nn = thisenv->env_runs;
+  809718:	8b 11                	mov    (%ecx),%edx
+  80971a:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80971d:	39 d3                	cmp    %edx,%ebx
+  80971f:	74 6e                	je     80978f <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  809721:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  809724:	74 24                	je     80974a <_pipeisclosed+0x96>
+  809726:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  809728:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80972e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  809733:	77 94                	ja     8096c9 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  809735:	89 f0                	mov    %esi,%eax
+  809737:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  809739:	c1 e8 10             	shr    $0x10,%eax
+  80973c:	74 8b                	je     8096c9 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80973e:	c1 e0 10             	shl    $0x10,%eax
+  809741:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  809746:	29 c2                	sub    %eax,%edx
+  809748:	eb 85                	jmp    8096cf <_pipeisclosed+0x1b>
+  80974a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80974c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  809752:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  809757:	77 18                	ja     809771 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  809759:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80975e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  809760:	c1 e8 10             	shr    $0x10,%eax
+  809763:	74 0c                	je     809771 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  809765:	c1 e0 10             	shl    $0x10,%eax
+  809768:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80976d:	29 c2                	sub    %eax,%edx
+  80976f:	eb 06                	jmp    809777 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  809771:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  809777:	8b 02                	mov    (%edx),%eax
+  809779:	8b 40 58             	mov    0x58(%eax),%eax
+  80977c:	6a 01                	push   $0x1
+  80977e:	50                   	push   %eax
+  80977f:	53                   	push   %ebx
+  809780:	68 ee be 80 00       	push   $0x80beee
+  809785:	e8 69 d0 ff ff       	call   8067f3 <cprintf>
+  80978a:	83 c4 10             	add    $0x10,%esp
+  80978d:	eb 97                	jmp    809726 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80978f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  809792:	0f 94 c0             	sete   %al
+  809795:	0f b6 c0             	movzbl %al,%eax
+}
+  809798:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80979b:	5b                   	pop    %ebx
+  80979c:	5e                   	pop    %esi
+  80979d:	5f                   	pop    %edi
+  80979e:	5d                   	pop    %ebp
+  80979f:	c3                   	ret
+
+008097a0 <devpipe_write>:
+{
+  8097a0:	55                   	push   %ebp
+  8097a1:	89 e5                	mov    %esp,%ebp
+  8097a3:	57                   	push   %edi
+  8097a4:	56                   	push   %esi
+  8097a5:	53                   	push   %ebx
+  8097a6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8097a9:	ff 75 08             	push   0x8(%ebp)
+  8097ac:	e8 05 e1 ff ff       	call   8078b6 <fd2data>
+  8097b1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8097b3:	83 c4 10             	add    $0x10,%esp
+  8097b6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8097bd:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8097c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8097c3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8097c6:	0f 84 96 00 00 00    	je     809862 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8097cc:	8d 73 08             	lea    0x8(%ebx),%esi
+  8097cf:	eb 32                	jmp    809803 <devpipe_write+0x63>
+  8097d1:	89 fa                	mov    %edi,%edx
+  8097d3:	89 f0                	mov    %esi,%eax
+  8097d5:	e8 69 fe ff ff       	call   809643 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8097da:	8b 43 04             	mov    0x4(%ebx),%eax
+  8097dd:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8097e0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8097e5:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8097ea:	83 ec 04             	sub    $0x4,%esp
+  8097ed:	6a 0a                	push   $0xa
+  8097ef:	50                   	push   %eax
+  8097f0:	53                   	push   %ebx
+  8097f1:	e8 34 dd ff ff       	call   80752a <sys_futex_wait>
+  8097f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8097fb:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  809800:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  809803:	8b 43 04             	mov    0x4(%ebx),%eax
+  809806:	8b 0b                	mov    (%ebx),%ecx
+  809808:	8d 51 20             	lea    0x20(%ecx),%edx
+  80980b:	39 d0                	cmp    %edx,%eax
+  80980d:	72 1b                	jb     80982a <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80980f:	89 da                	mov    %ebx,%edx
+  809811:	8b 45 08             	mov    0x8(%ebp),%eax
+  809814:	e8 9b fe ff ff       	call   8096b4 <_pipeisclosed>
+  809819:	85 c0                	test   %eax,%eax
+  80981b:	74 b4                	je     8097d1 <devpipe_write+0x31>
+				return 0;
+  80981d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809825:	5b                   	pop    %ebx
+  809826:	5e                   	pop    %esi
+  809827:	5f                   	pop    %edi
+  809828:	5d                   	pop    %ebp
+  809829:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80982a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80982d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  809830:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  809834:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  809837:	89 c2                	mov    %eax,%edx
+  809839:	c1 fa 1f             	sar    $0x1f,%edx
+  80983c:	89 d1                	mov    %edx,%ecx
+  80983e:	c1 e9 1b             	shr    $0x1b,%ecx
+  809841:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  809844:	83 e2 1f             	and    $0x1f,%edx
+  809847:	29 ca                	sub    %ecx,%edx
+  809849:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80984d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  809851:	83 c0 01             	add    $0x1,%eax
+  809854:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  809857:	83 c6 01             	add    $0x1,%esi
+  80985a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80985d:	e9 5e ff ff ff       	jmp    8097c0 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  809862:	8d 53 04             	lea    0x4(%ebx),%edx
+  809865:	8d 43 08             	lea    0x8(%ebx),%eax
+  809868:	e8 d6 fd ff ff       	call   809643 <pipewake>
+	return i;
+  80986d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  809870:	eb b0                	jmp    809822 <devpipe_write+0x82>
+
+00809872 <devpipe_read>:
+{
+  809872:	55                   	push   %ebp
+  809873:	89 e5                	mov    %esp,%ebp
+  809875:	57                   	push   %edi
+  809876:	56                   	push   %esi
+  809877:	53                   	push   %ebx
+  809878:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80987b:	ff 75 08             	push   0x8(%ebp)
+  80987e:	e8 33 e0 ff ff       	call   8078b6 <fd2data>
+  809883:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  809885:	83 c4 10             	add    $0x10,%esp
+  809888:	be 00 00 00 00       	mov    $0x0,%esi
+  80988d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  809890:	74 6c                	je     8098fe <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  809892:	8d 7b 04             	lea    0x4(%ebx),%edi
+  809895:	eb 25                	jmp    8098bc <devpipe_read+0x4a>
+  809897:	8b 13                	mov    (%ebx),%edx
+  809899:	b8 01 00 00 00       	mov    $0x1,%eax
+  80989e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8098a3:	83 ec 04             	sub    $0x4,%esp
+  8098a6:	6a 0a                	push   $0xa
+  8098a8:	52                   	push   %edx
+  8098a9:	57                   	push   %edi
+  8098aa:	e8 7b dc ff ff       	call   80752a <sys_futex_wait>
+  8098af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8098b4:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8098b9:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8098bc:	8b 03                	mov    (%ebx),%eax
+  8098be:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8098c1:	75 19                	jne    8098dc <devpipe_read+0x6a>
+			if (i > 0)
+  8098c3:	85 f6                	test   %esi,%esi
+  8098c5:	75 3a                	jne    809901 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8098c7:	89 da                	mov    %ebx,%edx
+  8098c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8098cc:	e8 e3 fd ff ff       	call   8096b4 <_pipeisclosed>
+  8098d1:	85 c0                	test   %eax,%eax
+  8098d3:	74 c2                	je     809897 <devpipe_read+0x25>
+				return 0;
+  8098d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8098da:	eb 31                	jmp    80990d <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8098dc:	89 c1                	mov    %eax,%ecx
+  8098de:	c1 f9 1f             	sar    $0x1f,%ecx
+  8098e1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8098e4:	01 c8                	add    %ecx,%eax
+  8098e6:	83 e0 1f             	and    $0x1f,%eax
+  8098e9:	29 c8                	sub    %ecx,%eax
+  8098eb:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8098f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8098f3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8098f6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8098f9:	83 c6 01             	add    $0x1,%esi
+  8098fc:	eb 8f                	jmp    80988d <devpipe_read+0x1b>
+out:
+  8098fe:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  809901:	8d 43 0c             	lea    0xc(%ebx),%eax
+  809904:	89 da                	mov    %ebx,%edx
+  809906:	e8 38 fd ff ff       	call   809643 <pipewake>
+	return i;
+  80990b:	89 f0                	mov    %esi,%eax
+}
+  80990d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809910:	5b                   	pop    %ebx
+  809911:	5e                   	pop    %esi
+  809912:	5f                   	pop    %edi
+  809913:	5d                   	pop    %ebp
+  809914:	c3                   	ret
+
+00809915 <pipe>:
+{
+  809915:	55                   	push   %ebp
+  809916:	89 e5                	mov    %esp,%ebp
+  809918:	56                   	push   %esi
+  809919:	53                   	push   %ebx
+  80991a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80991d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  809920:	50                   	push   %eax
+  809921:	e8 a7 df ff ff       	call   8078cd <fd_alloc>
+  809926:	89 c3                	mov    %eax,%ebx
+  809928:	83 c4 10             	add    $0x10,%esp
+  80992b:	85 c0                	test   %eax,%eax
+  80992d:	0f 88 23 01 00 00    	js     809a56 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809933:	83 ec 04             	sub    $0x4,%esp
+  809936:	68 07 04 00 00       	push   $0x407
+  80993b:	ff 75 f4             	push   -0xc(%ebp)
+  80993e:	6a 00                	push   $0x0
+  809940:	e8 d0 d8 ff ff       	call   807215 <sys_page_alloc>
+  809945:	89 c3                	mov    %eax,%ebx
+  809947:	83 c4 10             	add    $0x10,%esp
+  80994a:	85 c0                	test   %eax,%eax
+  80994c:	0f 88 04 01 00 00    	js     809a56 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  809952:	83 ec 0c             	sub    $0xc,%esp
+  809955:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  809958:	50                   	push   %eax
+  809959:	e8 6f df ff ff       	call   8078cd <fd_alloc>
+  80995e:	89 c3                	mov    %eax,%ebx
+  809960:	83 c4 10             	add    $0x10,%esp
+  809963:	85 c0                	test   %eax,%eax
+  809965:	0f 88 db 00 00 00    	js     809a46 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80996b:	83 ec 04             	sub    $0x4,%esp
+  80996e:	68 07 04 00 00       	push   $0x407
+  809973:	ff 75 f0             	push   -0x10(%ebp)
+  809976:	6a 00                	push   $0x0
+  809978:	e8 98 d8 ff ff       	call   807215 <sys_page_alloc>
+  80997d:	89 c3                	mov    %eax,%ebx
+  80997f:	83 c4 10             	add    $0x10,%esp
+  809982:	85 c0                	test   %eax,%eax
+  809984:	0f 88 bc 00 00 00    	js     809a46 <pipe+0x131>
+	va = fd2data(fd0);
+  80998a:	83 ec 0c             	sub    $0xc,%esp
+  80998d:	ff 75 f4             	push   -0xc(%ebp)
+  809990:	e8 21 df ff ff       	call   8078b6 <fd2data>
+  809995:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809997:	83 c4 0c             	add    $0xc,%esp
+  80999a:	68 07 04 00 00       	push   $0x407
+  80999f:	50                   	push   %eax
+  8099a0:	6a 00                	push   $0x0
+  8099a2:	e8 6e d8 ff ff       	call   807215 <sys_page_alloc>
+  8099a7:	89 c3                	mov    %eax,%ebx
+  8099a9:	83 c4 10             	add    $0x10,%esp
+  8099ac:	85 c0                	test   %eax,%eax
+  8099ae:	0f 88 82 00 00 00    	js     809a36 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8099b4:	83 ec 0c             	sub    $0xc,%esp
+  8099b7:	ff 75 f0             	push   -0x10(%ebp)
+  8099ba:	e8 f7 de ff ff       	call   8078b6 <fd2data>
+  8099bf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8099c6:	50                   	push   %eax
+  8099c7:	6a 00                	push   $0x0
+  8099c9:	56                   	push   %esi
+  8099ca:	6a 00                	push   $0x0
+  8099cc:	e8 91 d8 ff ff       	call   807262 <sys_page_map>
+  8099d1:	89 c3                	mov    %eax,%ebx
+  8099d3:	83 c4 20             	add    $0x20,%esp
+  8099d6:	85 c0                	test   %eax,%eax
+  8099d8:	78 4e                	js     809a28 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8099da:	a1 1c 13 81 00       	mov    0x81131c,%eax
+  8099df:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8099e2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8099e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8099e7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8099ee:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8099f1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8099f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8099f6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8099fd:	83 ec 0c             	sub    $0xc,%esp
+  809a00:	ff 75 f4             	push   -0xc(%ebp)
+  809a03:	e8 9e de ff ff       	call   8078a6 <fd2num>
+  809a08:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  809a0b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  809a0d:	83 c4 04             	add    $0x4,%esp
+  809a10:	ff 75 f0             	push   -0x10(%ebp)
+  809a13:	e8 8e de ff ff       	call   8078a6 <fd2num>
+  809a18:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  809a1b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  809a1e:	83 c4 10             	add    $0x10,%esp
+  809a21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  809a26:	eb 2e                	jmp    809a56 <pipe+0x141>
+	sys_page_unmap(0, va);
+  809a28:	83 ec 08             	sub    $0x8,%esp
+  809a2b:	56                   	push   %esi
+  809a2c:	6a 00                	push   $0x0
+  809a2e:	e8 7b d8 ff ff       	call   8072ae <sys_page_unmap>
+  809a33:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  809a36:	83 ec 08             	sub    $0x8,%esp
+  809a39:	ff 75 f0             	push   -0x10(%ebp)
+  809a3c:	6a 00                	push   $0x0
+  809a3e:	e8 6b d8 ff ff       	call   8072ae <sys_page_unmap>
+  809a43:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  809a46:	83 ec 08             	sub    $0x8,%esp
+  809a49:	ff 75 f4             	push   -0xc(%ebp)
+  809a4c:	6a 00                	push   $0x0
+  809a4e:	e8 5b d8 ff ff       	call   8072ae <sys_page_unmap>
+  809a53:	83 c4 10             	add    $0x10,%esp
+}
+  809a56:	89 d8                	mov    %ebx,%eax
+  809a58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  809a5b:	5b                   	pop    %ebx
+  809a5c:	5e                   	pop    %esi
+  809a5d:	5d                   	pop    %ebp
+  809a5e:	c3                   	ret
+
+00809a5f <pipeisclosed>:
+{
+  809a5f:	55                   	push   %ebp
+  809a60:	89 e5                	mov    %esp,%ebp
+  809a62:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  809a65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  809a68:	50                   	push   %eax
+  809a69:	ff 75 08             	push   0x8(%ebp)
+  809a6c:	e8 b2 de ff ff       	call   807923 <fd_lookup>
+  809a71:	83 c4 10             	add    $0x10,%esp
+  809a74:	85 c0                	test   %eax,%eax
+  809a76:	78 18                	js     809a90 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  809a78:	83 ec 0c             	sub    $0xc,%esp
+  809a7b:	ff 75 f4             	push   -0xc(%ebp)
+  809a7e:	e8 33 de ff ff       	call   8078b6 <fd2data>
+  809a83:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  809a85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  809a88:	e8 27 fc ff ff       	call   8096b4 <_pipeisclosed>
+  809a8d:	83 c4 10             	add    $0x10,%esp
+}
+  809a90:	c9                   	leave
+  809a91:	c3                   	ret
+
+00809a92 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  809a92:	55                   	push   %ebp
+  809a93:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  809a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  809a98:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  809a9e:	5d                   	pop    %ebp
+  809a9f:	c3                   	ret
+
+00809aa0 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  809aa0:	55                   	push   %ebp
+  809aa1:	89 e5                	mov    %esp,%ebp
+  809aa3:	56                   	push   %esi
+  809aa4:	53                   	push   %ebx
+  809aa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  809aa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  809aad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  809ab2:	89 d0                	mov    %edx,%eax
+  809ab4:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  809ab8:	85 c0                	test   %eax,%eax
+  809aba:	74 2d                	je     809ae9 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  809abc:	83 f8 02             	cmp    $0x2,%eax
+  809abf:	74 08                	je     809ac9 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  809ac1:	b8 02 00 00 00       	mov    $0x2,%eax
+  809ac6:	f0 87 03             	lock xchg %eax,(%ebx)
+  809ac9:	be 02 00 00 00       	mov    $0x2,%esi
+  809ace:	eb 15                	jmp    809ae5 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  809ad0:	83 ec 04             	sub    $0x4,%esp
+  809ad3:	6a 00                	push   $0x0
+  809ad5:	6a 02                	push   $0x2
+  809ad7:	53                   	push   %ebx
+  809ad8:	e8 4d da ff ff       	call   80752a <sys_futex_wait>
+  809add:	89 f0                	mov    %esi,%eax
+  809adf:	f0 87 03             	lock xchg %eax,(%ebx)
+  809ae2:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  809ae5:	85 c0                	test   %eax,%eax
+  809ae7:	75 e7                	jne    809ad0 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  809ae9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  809aec:	5b                   	pop    %ebx
+  809aed:	5e                   	pop    %esi
+  809aee:	5d                   	pop    %ebp
+  809aef:	c3                   	ret
+
+00809af0 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  809af0:	55                   	push   %ebp
+  809af1:	89 e5                	mov    %esp,%ebp
+  809af3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  809af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  809afb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  809b00:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  809b04:	f7 d8                	neg    %eax
+  809b06:	19 c0                	sbb    %eax,%eax
+  809b08:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  809b0b:	5d                   	pop    %ebp
+  809b0c:	c3                   	ret
+
+00809b0d <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  809b0d:	55                   	push   %ebp
+  809b0e:	89 e5                	mov    %esp,%ebp
+  809b10:	83 ec 08             	sub    $0x8,%esp
+  809b13:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  809b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  809b1b:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  809b1e:	83 f8 02             	cmp    $0x2,%eax
+  809b21:	74 02                	je     809b25 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  809b23:	c9                   	leave
+  809b24:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  809b25:	83 ec 08             	sub    $0x8,%esp
+  809b28:	6a 01                	push   $0x1
+  809b2a:	52                   	push   %edx
+  809b2b:	e8 29 da ff ff       	call   807559 <sys_futex_wake>
+  809b30:	83 c4 10             	add    $0x10,%esp
+}
+  809b33:	eb ee                	jmp    809b23 <mutex_unlock+0x16>
+
+00809b35 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  809b35:	55                   	push   %ebp
+  809b36:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  809b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  809b3b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  809b41:	5d                   	pop    %ebp
+  809b42:	c3                   	ret
+
+00809b43 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  809b43:	55                   	push   %ebp
+  809b44:	89 e5                	mov    %esp,%ebp
+  809b46:	57                   	push   %edi
+  809b47:	56                   	push   %esi
+  809b48:	53                   	push   %ebx
+  809b49:	83 ec 18             	sub    $0x18,%esp
+  809b4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  809b4f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  809b52:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  809b54:	53                   	push   %ebx
+  809b55:	e8 b3 ff ff ff       	call   809b0d <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  809b5a:	83 c4 0c             	add    $0xc,%esp
+  809b5d:	ff 75 10             	push   0x10(%ebp)
+  809b60:	57                   	push   %edi
+  809b61:	56                   	push   %esi
+  809b62:	e8 c3 d9 ff ff       	call   80752a <sys_futex_wait>
+  809b67:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  809b69:	83 c4 10             	add    $0x10,%esp
+  809b6c:	be 02 00 00 00       	mov    $0x2,%esi
+  809b71:	eb 10                	jmp    809b83 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  809b73:	83 ec 04             	sub    $0x4,%esp
+  809b76:	6a 00                	push   $0x0
+  809b78:	6a 02                	push   $0x2
+  809b7a:	53                   	push   %ebx
+  809b7b:	e8 aa d9 ff ff       	call   80752a <sys_futex_wait>
+  809b80:	83 c4 10             	add    $0x10,%esp
+  809b83:	89 f0                	mov    %esi,%eax
+  809b85:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  809b88:	85 c0                	test   %eax,%eax
+  809b8a:	75 e7                	jne    809b73 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  809b8c:	83 ff ec             	cmp    $0xffffffec,%edi
+  809b8f:	74 05                	je     809b96 <cond_timedwait+0x53>
+  809b91:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  809b96:	89 f8                	mov    %edi,%eax
+  809b98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809b9b:	5b                   	pop    %ebx
+  809b9c:	5e                   	pop    %esi
+  809b9d:	5f                   	pop    %edi
+  809b9e:	5d                   	pop    %ebp
+  809b9f:	c3                   	ret
+
+00809ba0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  809ba0:	55                   	push   %ebp
+  809ba1:	89 e5                	mov    %esp,%ebp
+  809ba3:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  809ba6:	6a 00                	push   $0x0
+  809ba8:	ff 75 0c             	push   0xc(%ebp)
+  809bab:	ff 75 08             	push   0x8(%ebp)
+  809bae:	e8 90 ff ff ff       	call   809b43 <cond_timedwait>
+}
+  809bb3:	83 c4 10             	add    $0x10,%esp
+  809bb6:	c9                   	leave
+  809bb7:	c3                   	ret
+
+00809bb8 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  809bb8:	55                   	push   %ebp
+  809bb9:	89 e5                	mov    %esp,%ebp
+  809bbb:	83 ec 10             	sub    $0x10,%esp
+  809bbe:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  809bc1:	ba 01 00 00 00       	mov    $0x1,%edx
+  809bc6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  809bca:	6a 01                	push   $0x1
+  809bcc:	50                   	push   %eax
+  809bcd:	e8 87 d9 ff ff       	call   807559 <sys_futex_wake>
+}
+  809bd2:	83 c4 10             	add    $0x10,%esp
+  809bd5:	c9                   	leave
+  809bd6:	c3                   	ret
+
+00809bd7 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  809bd7:	55                   	push   %ebp
+  809bd8:	89 e5                	mov    %esp,%ebp
+  809bda:	83 ec 10             	sub    $0x10,%esp
+  809bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  809be0:	ba 01 00 00 00       	mov    $0x1,%edx
+  809be5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  809be9:	68 00 04 00 00       	push   $0x400
+  809bee:	50                   	push   %eax
+  809bef:	e8 65 d9 ff ff       	call   807559 <sys_futex_wake>
+}
+  809bf4:	83 c4 10             	add    $0x10,%esp
+  809bf7:	c9                   	leave
+  809bf8:	c3                   	ret
+
+00809bf9 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  809bf9:	55                   	push   %ebp
+  809bfa:	89 e5                	mov    %esp,%ebp
+  809bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  809bff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  809c02:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  809c04:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  809c0b:	5d                   	pop    %ebp
+  809c0c:	c3                   	ret
+
+00809c0d <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  809c0d:	55                   	push   %ebp
+  809c0e:	89 e5                	mov    %esp,%ebp
+  809c10:	53                   	push   %ebx
+  809c11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  809c14:	8b 11                	mov    (%ecx),%edx
+  809c16:	85 d2                	test   %edx,%edx
+  809c18:	74 14                	je     809c2e <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  809c1a:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  809c1d:	89 d0                	mov    %edx,%eax
+  809c1f:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  809c23:	39 c2                	cmp    %eax,%edx
+  809c25:	75 ed                	jne    809c14 <sem_trywait+0x7>
+			return 0;
+  809c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  809c2c:	eb 05                	jmp    809c33 <sem_trywait+0x26>
+	return -E_AGAIN;
+  809c2e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  809c33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  809c36:	c9                   	leave
+  809c37:	c3                   	ret
+
+00809c38 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  809c38:	55                   	push   %ebp
+  809c39:	89 e5                	mov    %esp,%ebp
+  809c3b:	57                   	push   %edi
+  809c3c:	56                   	push   %esi
+  809c3d:	53                   	push   %ebx
+  809c3e:	83 ec 1c             	sub    $0x1c,%esp
+  809c41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  809c44:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  809c47:	e8 56 d8 ff ff       	call   8074a2 <sys_time_msec>
+  809c4c:	01 f8                	add    %edi,%eax
+  809c4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  809c51:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  809c56:	eb 28                	jmp    809c80 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  809c58:	b8 01 00 00 00       	mov    $0x1,%eax
+  809c5d:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  809c62:	83 ec 04             	sub    $0x4,%esp
+  809c65:	56                   	push   %esi
+  809c66:	6a 00                	push   $0x0
+  809c68:	53                   	push   %ebx
+  809c69:	e8 bc d8 ff ff       	call   80752a <sys_futex_wait>
+  809c6e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  809c73:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  809c78:	83 c4 10             	add    $0x10,%esp
+  809c7b:	83 f8 ec             	cmp    $0xffffffec,%eax
+  809c7e:	74 2e                	je     809cae <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  809c80:	83 ec 0c             	sub    $0xc,%esp
+  809c83:	53                   	push   %ebx
+  809c84:	e8 84 ff ff ff       	call   809c0d <sem_trywait>
+  809c89:	83 c4 10             	add    $0x10,%esp
+  809c8c:	85 c0                	test   %eax,%eax
+  809c8e:	79 19                	jns    809ca9 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  809c90:	85 ff                	test   %edi,%edi
+  809c92:	74 c4                	je     809c58 <sem_timedwait+0x20>
+  809c94:	e8 09 d8 ff ff       	call   8074a2 <sys_time_msec>
+  809c99:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  809c9c:	29 c6                	sub    %eax,%esi
+  809c9e:	85 f6                	test   %esi,%esi
+  809ca0:	7f b6                	jg     809c58 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  809ca2:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  809ca7:	eb 05                	jmp    809cae <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  809ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809cae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809cb1:	5b                   	pop    %ebx
+  809cb2:	5e                   	pop    %esi
+  809cb3:	5f                   	pop    %edi
+  809cb4:	5d                   	pop    %ebp
+  809cb5:	c3                   	ret
+
+00809cb6 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  809cb6:	55                   	push   %ebp
+  809cb7:	89 e5                	mov    %esp,%ebp
+  809cb9:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  809cbc:	6a 00                	push   $0x0
+  809cbe:	ff 75 08             	push   0x8(%ebp)
+  809cc1:	e8 72 ff ff ff       	call   809c38 <sem_timedwait>
+}
+  809cc6:	83 c4 10             	add    $0x10,%esp
+  809cc9:	c9                   	leave
+  809cca:	c3                   	ret
+
+00809ccb <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  809ccb:	55                   	push   %ebp
+  809ccc:	89 e5                	mov    %esp,%ebp
+  809cce:	83 ec 08             	sub    $0x8,%esp
+  809cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  809cd4:	ba 01 00 00 00       	mov    $0x1,%edx
+  809cd9:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  809cdd:	8b 50 04             	mov    0x4(%eax),%edx
+  809ce0:	85 d2                	test   %edx,%edx
+  809ce2:	75 02                	jne    809ce6 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  809ce4:	c9                   	leave
+  809ce5:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  809ce6:	83 ec 08             	sub    $0x8,%esp
+  809ce9:	6a 01                	push   $0x1
+  809ceb:	50                   	push   %eax
+  809cec:	e8 68 d8 ff ff       	call   807559 <sys_futex_wake>
+  809cf1:	83 c4 10             	add    $0x10,%esp
+}
+  809cf4:	eb ee                	jmp    809ce4 <sem_post+0x19>
+
+00809cf6 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  809cf6:	55                   	push   %ebp
+  809cf7:	89 e5                	mov    %esp,%ebp
+  809cf9:	57                   	push   %edi
+  809cfa:	56                   	push   %esi
+  809cfb:	53                   	push   %ebx
+  809cfc:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  809cff:	68 40 c1 84 00       	push   $0x84c140
+  809d04:	e8 97 fd ff ff       	call   809aa0 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  809d09:	a1 64 c1 84 00       	mov    0x84c164,%eax
+  809d0e:	83 c4 10             	add    $0x10,%esp
+  809d11:	85 c0                	test   %eax,%eax
+  809d13:	75 19                	jne    809d2e <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  809d15:	a1 40 c4 84 00       	mov    0x84c440,%eax
+  809d1a:	8b 00                	mov    (%eax),%eax
+  809d1c:	8b 40 48             	mov    0x48(%eax),%eax
+  809d1f:	a3 60 c1 84 00       	mov    %eax,0x84c160
+		threads[0].th_state = PTH_RUNNING;
+  809d24:	c7 05 64 c1 84 00 01 	movl   $0x1,0x84c164
+  809d2b:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  809d2e:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  809d33:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809d36:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  809d3d:	8b 40 04             	mov    0x4(%eax),%eax
+  809d40:	85 c0                	test   %eax,%eax
+  809d42:	0f 84 e4 00 00 00    	je     809e2c <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  809d48:	83 c3 01             	add    $0x1,%ebx
+  809d4b:	83 fb 20             	cmp    $0x20,%ebx
+  809d4e:	75 e3                	jne    809d33 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  809d50:	83 ec 0c             	sub    $0xc,%esp
+  809d53:	68 40 c1 84 00       	push   $0x84c140
+  809d58:	e8 b0 fd ff ff       	call   809b0d <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  809d5d:	83 c4 10             	add    $0x10,%esp
+  809d60:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  809d65:	e9 b8 00 00 00       	jmp    809e22 <pthread_create+0x12c>
+  809d6a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  809d6d:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  809d70:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  809d72:	39 f3                	cmp    %esi,%ebx
+  809d74:	73 16                	jae    809d8c <pthread_create+0x96>
+		va -= PGSIZE;
+  809d76:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  809d7c:	83 ec 08             	sub    $0x8,%esp
+  809d7f:	56                   	push   %esi
+  809d80:	6a 00                	push   $0x0
+  809d82:	e8 27 d5 ff ff       	call   8072ae <sys_page_unmap>
+  809d87:	83 c4 10             	add    $0x10,%esp
+  809d8a:	eb e6                	jmp    809d72 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  809d8c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  809d8f:	83 ec 08             	sub    $0x8,%esp
+  809d92:	ff 75 e4             	push   -0x1c(%ebp)
+  809d95:	6a 00                	push   $0x0
+  809d97:	e8 12 d5 ff ff       	call   8072ae <sys_page_unmap>
+	return r;
+  809d9c:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  809d9f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809da2:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  809da9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  809db0:	eb 70                	jmp    809e22 <pthread_create+0x12c>
+	th->th_fn = fn;
+  809db2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809db5:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  809dbc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  809dbf:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  809dc2:	8b 55 10             	mov    0x10(%ebp),%edx
+  809dc5:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  809dc8:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  809dcf:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  809dd4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  809dd7:	29 c8                	sub    %ecx,%eax
+  809dd9:	85 db                	test   %ebx,%ebx
+  809ddb:	0f 44 05 40 c4 84 00 	cmove  0x84c440,%eax
+	*--esp = t;
+  809de2:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  809de5:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  809dec:	83 ec 04             	sub    $0x4,%esp
+  809def:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  809df4:	29 ca                	sub    %ecx,%edx
+  809df6:	52                   	push   %edx
+	*--esp = 0;
+  809df7:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  809dfa:	50                   	push   %eax
+  809dfb:	68 53 a0 80 00       	push   $0x80a053
+  809e00:	e8 f9 d7 ff ff       	call   8075fe <sys_thread_create>
+  809e05:	89 c7                	mov    %eax,%edi
+  809e07:	83 c4 10             	add    $0x10,%esp
+  809e0a:	85 c0                	test   %eax,%eax
+  809e0c:	78 91                	js     809d9f <pthread_create+0xa9>
+	th->th_env = id;
+  809e0e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809e11:	89 3c 85 60 c1 84 00 	mov    %edi,0x84c160(,%eax,4)
+	*tp = t;
+  809e18:	8b 45 08             	mov    0x8(%ebp),%eax
+  809e1b:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  809e1d:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  809e22:	89 f8                	mov    %edi,%eax
+  809e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809e27:	5b                   	pop    %ebx
+  809e28:	5e                   	pop    %esi
+  809e29:	5f                   	pop    %edi
+  809e2a:	5d                   	pop    %ebp
+  809e2b:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  809e2c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809e2f:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  809e36:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  809e3d:	83 ec 0c             	sub    $0xc,%esp
+  809e40:	68 40 c1 84 00       	push   $0x84c140
+  809e45:	e8 c3 fc ff ff       	call   809b0d <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  809e4a:	89 d9                	mov    %ebx,%ecx
+  809e4c:	c1 e1 10             	shl    $0x10,%ecx
+  809e4f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  809e52:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  809e57:	29 c8                	sub    %ecx,%eax
+  809e59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  809e5c:	c1 e8 16             	shr    $0x16,%eax
+  809e5f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  809e66:	83 c4 10             	add    $0x10,%esp
+  809e69:	a8 01                	test   $0x1,%al
+  809e6b:	74 15                	je     809e82 <pthread_create+0x18c>
+  809e6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  809e70:	c1 e8 0c             	shr    $0xc,%eax
+  809e73:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  809e7a:	a8 01                	test   $0x1,%al
+  809e7c:	0f 85 30 ff ff ff    	jne    809db2 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  809e82:	83 ec 04             	sub    $0x4,%esp
+  809e85:	6a 07                	push   $0x7
+  809e87:	ff 75 e4             	push   -0x1c(%ebp)
+  809e8a:	6a 00                	push   $0x0
+  809e8c:	e8 84 d3 ff ff       	call   807215 <sys_page_alloc>
+  809e91:	89 c7                	mov    %eax,%edi
+  809e93:	83 c4 10             	add    $0x10,%esp
+  809e96:	85 c0                	test   %eax,%eax
+  809e98:	0f 88 01 ff ff ff    	js     809d9f <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  809e9e:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  809ea3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  809ea6:	29 d0                	sub    %edx,%eax
+  809ea8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  809eab:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  809ead:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  809eb2:	29 d0                	sub    %edx,%eax
+  809eb4:	89 c7                	mov    %eax,%edi
+  809eb6:	39 fe                	cmp    %edi,%esi
+  809eb8:	0f 83 f4 fe ff ff    	jae    809db2 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  809ebe:	83 ec 04             	sub    $0x4,%esp
+  809ec1:	6a 07                	push   $0x7
+  809ec3:	56                   	push   %esi
+  809ec4:	6a 00                	push   $0x0
+  809ec6:	e8 4a d3 ff ff       	call   807215 <sys_page_alloc>
+  809ecb:	83 c4 10             	add    $0x10,%esp
+  809ece:	85 c0                	test   %eax,%eax
+  809ed0:	0f 88 94 fe ff ff    	js     809d6a <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  809ed6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  809edc:	eb d8                	jmp    809eb6 <pthread_create+0x1c0>
+
+00809ede <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  809ede:	55                   	push   %ebp
+  809edf:	89 e5                	mov    %esp,%ebp
+  809ee1:	57                   	push   %edi
+  809ee2:	56                   	push   %esi
+  809ee3:	53                   	push   %ebx
+  809ee4:	83 ec 0c             	sub    $0xc,%esp
+  809ee7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  809eea:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  809eed:	83 f8 1e             	cmp    $0x1e,%eax
+  809ef0:	0f 87 c7 00 00 00    	ja     809fbd <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  809ef6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  809ef8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  809efe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  809f03:	77 12                	ja     809f17 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  809f05:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  809f0a:	29 d0                	sub    %edx,%eax
+  809f0c:	c1 e8 10             	shr    $0x10,%eax
+  809f0f:	39 c3                	cmp    %eax,%ebx
+  809f11:	0f 84 ad 00 00 00    	je     809fc4 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  809f17:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809f1a:	8d 3c 85 64 c1 84 00 	lea    0x84c164(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  809f21:	8d 34 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%esi
+  809f28:	eb 10                	jmp    809f3a <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  809f2a:	83 ec 04             	sub    $0x4,%esp
+  809f2d:	6a 00                	push   $0x0
+  809f2f:	6a 01                	push   $0x1
+  809f31:	57                   	push   %edi
+  809f32:	e8 f3 d5 ff ff       	call   80752a <sys_futex_wait>
+  809f37:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  809f3a:	8b 46 04             	mov    0x4(%esi),%eax
+  809f3d:	83 f8 01             	cmp    $0x1,%eax
+  809f40:	74 e8                	je     809f2a <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  809f42:	83 f8 02             	cmp    $0x2,%eax
+  809f45:	0f 85 80 00 00 00    	jne    809fcb <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  809f4b:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  809f4e:	c1 e6 02             	shl    $0x2,%esi
+  809f51:	eb 05                	jmp    809f58 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  809f53:	e8 91 d2 ff ff       	call   8071e9 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  809f58:	8b 8e 60 c1 84 00    	mov    0x84c160(%esi),%ecx
+  809f5e:	89 ca                	mov    %ecx,%edx
+  809f60:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  809f66:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  809f69:	c1 e0 04             	shl    $0x4,%eax
+  809f6c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  809f71:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  809f74:	39 c1                	cmp    %eax,%ecx
+  809f76:	75 12                	jne    809f8a <pthread_join+0xac>
+  809f78:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  809f7b:	c1 e0 04             	shl    $0x4,%eax
+  809f7e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  809f83:	8b 40 54             	mov    0x54(%eax),%eax
+  809f86:	85 c0                	test   %eax,%eax
+  809f88:	75 c9                	jne    809f53 <pthread_join+0x75>
+	if (ret_store)
+  809f8a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  809f8e:	74 0f                	je     809f9f <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  809f90:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809f93:	8b 04 85 70 c1 84 00 	mov    0x84c170(,%eax,4),%eax
+  809f9a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  809f9d:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  809f9f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  809fa2:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  809fa9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  809fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809fb8:	5b                   	pop    %ebx
+  809fb9:	5e                   	pop    %esi
+  809fba:	5f                   	pop    %edi
+  809fbb:	5d                   	pop    %ebp
+  809fbc:	c3                   	ret
+		return -E_INVAL;
+  809fbd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809fc2:	eb f1                	jmp    809fb5 <pthread_join+0xd7>
+  809fc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809fc9:	eb ea                	jmp    809fb5 <pthread_join+0xd7>
+		return -E_INVAL;
+  809fcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809fd0:	eb e3                	jmp    809fb5 <pthread_join+0xd7>
+
+00809fd2 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  809fd2:	55                   	push   %ebp
+  809fd3:	89 e5                	mov    %esp,%ebp
+  809fd5:	53                   	push   %ebx
+  809fd6:	83 ec 04             	sub    $0x4,%esp
+  809fd9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  809fdb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  809fe1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  809fe6:	77 0c                	ja     809ff4 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  809fe8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  809fed:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  809fef:	c1 e8 10             	shr    $0x10,%eax
+  809ff2:	75 0a                	jne    809ffe <pthread_exit+0x2c>
+		exit();
+  809ff4:	e8 f7 c6 ff ff       	call   8066f0 <exit>
+  809ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  809ffe:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80a005:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80a008:	8d 0c 8d 60 c1 84 00 	lea    0x84c160(,%ecx,4),%ecx
+  80a00f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80a012:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80a015:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80a01c:	83 ec 08             	sub    $0x8,%esp
+  80a01f:	6a 20                	push   $0x20
+  80a021:	01 c2                	add    %eax,%edx
+  80a023:	8d 04 95 64 c1 84 00 	lea    0x84c164(,%edx,4),%eax
+  80a02a:	50                   	push   %eax
+  80a02b:	e8 29 d5 ff ff       	call   807559 <sys_futex_wake>
+	sys_env_destroy(0);
+  80a030:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80a037:	e8 36 d1 ff ff       	call   807172 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80a03c:	83 c4 0c             	add    $0xc,%esp
+  80a03f:	68 06 bf 80 00       	push   $0x80bf06
+  80a044:	68 a5 00 00 00       	push   $0xa5
+  80a049:	68 20 bf 80 00       	push   $0x80bf20
+  80a04e:	e8 c5 c6 ff ff       	call   806718 <_panic>
+
+0080a053 <pthread_start>:
+{
+  80a053:	55                   	push   %ebp
+  80a054:	89 e5                	mov    %esp,%ebp
+  80a056:	53                   	push   %ebx
+  80a057:	83 ec 04             	sub    $0x4,%esp
+  80a05a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80a05d:	e8 5b d1 ff ff       	call   8071bd <sys_getenvid>
+  80a062:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80a067:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+	if (t == 0)
+  80a06d:	85 db                	test   %ebx,%ebx
+  80a06f:	74 0c                	je     80a07d <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80a071:	89 d9                	mov    %ebx,%ecx
+  80a073:	c1 e1 10             	shl    $0x10,%ecx
+  80a076:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80a07b:	29 ca                	sub    %ecx,%edx
+  80a07d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80a080:	c1 e0 04             	shl    $0x4,%eax
+  80a083:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80a088:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80a08a:	83 ec 0c             	sub    $0xc,%esp
+  80a08d:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80a094:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80a097:	ff 34 95 6c c1 84 00 	push   0x84c16c(,%edx,4)
+  80a09e:	ff 14 95 68 c1 84 00 	call   *0x84c168(,%edx,4)
+  80a0a5:	89 04 24             	mov    %eax,(%esp)
+  80a0a8:	e8 25 ff ff ff       	call   809fd2 <pthread_exit>
+
+0080a0ad <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80a0ad:	55                   	push   %ebp
+  80a0ae:	89 e5                	mov    %esp,%ebp
+  80a0b0:	57                   	push   %edi
+  80a0b1:	56                   	push   %esi
+  80a0b2:	53                   	push   %ebx
+  80a0b3:	83 ec 1c             	sub    $0x1c,%esp
+  80a0b6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a0b8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80a0be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a0c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80a0ca:	77 0d                	ja     80a0d9 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a0cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80a0d1:	29 d0                	sub    %edx,%eax
+  80a0d3:	c1 e8 10             	shr    $0x10,%eax
+  80a0d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80a0d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a0de:	eb 2f                	jmp    80a10f <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80a0e0:	8b 0d 40 c4 84 00    	mov    0x84c440,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80a0e6:	8b 01                	mov    (%ecx),%eax
+  80a0e8:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80a0eb:	39 c2                	cmp    %eax,%edx
+  80a0ed:	75 14                	jne    80a103 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80a0ef:	83 ec 0c             	sub    $0xc,%esp
+  80a0f2:	57                   	push   %edi
+  80a0f3:	e8 7a d0 ff ff       	call   807172 <sys_env_destroy>
+  80a0f8:	83 c4 10             	add    $0x10,%esp
+  80a0fb:	85 c0                	test   %eax,%eax
+  80a0fd:	0f 88 97 00 00 00    	js     80a19a <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80a103:	83 c3 01             	add    $0x1,%ebx
+  80a106:	83 fb 20             	cmp    $0x20,%ebx
+  80a109:	0f 84 d2 00 00 00    	je     80a1e1 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80a10f:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80a112:	74 ef                	je     80a103 <pthread_kill_others+0x56>
+  80a114:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80a117:	8d 04 85 60 c1 84 00 	lea    0x84c160(,%eax,4),%eax
+  80a11e:	8b 40 04             	mov    0x4(%eax),%eax
+  80a121:	83 f8 01             	cmp    $0x1,%eax
+  80a124:	75 dd                	jne    80a103 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80a126:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80a129:	8b 3c 85 60 c1 84 00 	mov    0x84c160(,%eax,4),%edi
+  80a130:	89 fe                	mov    %edi,%esi
+  80a132:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80a138:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80a13b:	c1 e0 04             	shl    $0x4,%eax
+  80a13e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80a143:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80a146:	39 c7                	cmp    %eax,%edi
+  80a148:	75 b9                	jne    80a103 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80a14a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80a14d:	c1 e0 04             	shl    $0x4,%eax
+  80a150:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80a155:	8b 40 54             	mov    0x54(%eax),%eax
+  80a158:	85 c0                	test   %eax,%eax
+  80a15a:	74 a7                	je     80a103 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80a15c:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80a15f:	c1 e0 04             	shl    $0x4,%eax
+  80a162:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80a168:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a16a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80a170:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80a175:	0f 87 65 ff ff ff    	ja     80a0e0 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a17b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80a180:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80a182:	c1 e8 10             	shr    $0x10,%eax
+  80a185:	0f 84 55 ff ff ff    	je     80a0e0 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80a18b:	c1 e0 10             	shl    $0x10,%eax
+  80a18e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80a193:	29 c1                	sub    %eax,%ecx
+  80a195:	e9 4c ff ff ff       	jmp    80a0e6 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80a19a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80a19d:	c1 e2 04             	shl    $0x4,%edx
+  80a1a0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80a1a6:	8b 52 48             	mov    0x48(%edx),%edx
+  80a1a9:	39 fa                	cmp    %edi,%edx
+  80a1ab:	0f 85 52 ff ff ff    	jne    80a103 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80a1b1:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80a1b4:	c1 e2 04             	shl    $0x4,%edx
+  80a1b7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80a1bd:	8b 52 54             	mov    0x54(%edx),%edx
+  80a1c0:	85 d2                	test   %edx,%edx
+  80a1c2:	0f 84 3b ff ff ff    	je     80a103 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80a1c8:	83 ec 0c             	sub    $0xc,%esp
+  80a1cb:	50                   	push   %eax
+  80a1cc:	57                   	push   %edi
+  80a1cd:	68 30 bf 80 00       	push   $0x80bf30
+  80a1d2:	68 bb 00 00 00       	push   $0xbb
+  80a1d7:	68 20 bf 80 00       	push   $0x80bf20
+  80a1dc:	e8 37 c5 ff ff       	call   806718 <_panic>
+	}
+}
+  80a1e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80a1e4:	5b                   	pop    %ebx
+  80a1e5:	5e                   	pop    %esi
+  80a1e6:	5f                   	pop    %edi
+  80a1e7:	5d                   	pop    %ebp
+  80a1e8:	c3                   	ret
+
+0080a1e9 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80a1e9:	55                   	push   %ebp
+  80a1ea:	89 e5                	mov    %esp,%ebp
+  80a1ec:	53                   	push   %ebx
+  80a1ed:	83 ec 04             	sub    $0x4,%esp
+  80a1f0:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a1f2:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80a1f8:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80a1fe:	0f 87 85 00 00 00    	ja     80a289 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a204:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80a209:	29 c3                	sub    %eax,%ebx
+  80a20b:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80a20e:	83 ec 04             	sub    $0x4,%esp
+  80a211:	68 80 02 00 00       	push   $0x280
+  80a216:	6a 00                	push   $0x0
+  80a218:	68 60 c1 84 00       	push   $0x84c160
+  80a21d:	e8 06 cd ff ff       	call   806f28 <memset>
+	threads_mu.m_state = 0;
+  80a222:	c7 05 40 c1 84 00 00 	movl   $0x0,0x84c140
+  80a229:	00 00 00 
+	if (self != 0) {
+  80a22c:	83 c4 10             	add    $0x10,%esp
+  80a22f:	85 db                	test   %ebx,%ebx
+  80a231:	74 51                	je     80a284 <pthread_fork_child+0x9b>
+  80a233:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a235:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80a23b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80a240:	77 18                	ja     80a25a <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a242:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80a247:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80a249:	c1 e8 10             	shr    $0x10,%eax
+  80a24c:	74 0c                	je     80a25a <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80a24e:	c1 e0 10             	shl    $0x10,%eax
+  80a251:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80a256:	29 c2                	sub    %eax,%edx
+  80a258:	eb 06                	jmp    80a260 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80a25a:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		threads[self].th_env = thisenv->env_id;
+  80a260:	8b 02                	mov    (%edx),%eax
+  80a262:	8b 48 48             	mov    0x48(%eax),%ecx
+  80a265:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80a26c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80a26f:	89 0c 95 60 c1 84 00 	mov    %ecx,0x84c160(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80a276:	8d 04 95 60 c1 84 00 	lea    0x84c160(,%edx,4),%eax
+  80a27d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80a284:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80a287:	c9                   	leave
+  80a288:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80a289:	83 ec 04             	sub    $0x4,%esp
+  80a28c:	68 80 02 00 00       	push   $0x280
+  80a291:	6a 00                	push   $0x0
+  80a293:	68 60 c1 84 00       	push   $0x84c160
+  80a298:	e8 8b cc ff ff       	call   806f28 <memset>
+	threads_mu.m_state = 0;
+  80a29d:	c7 05 40 c1 84 00 00 	movl   $0x0,0x84c140
+  80a2a4:	00 00 00 
+  80a2a7:	83 c4 10             	add    $0x10,%esp
+  80a2aa:	eb d8                	jmp    80a284 <pthread_fork_child+0x9b>
+
+0080a2ac <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80a2ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a2b1:	c3                   	ret
+
+0080a2b2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80a2b2:	55                   	push   %ebp
+  80a2b3:	89 e5                	mov    %esp,%ebp
+  80a2b5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80a2b8:	68 55 bf 80 00       	push   $0x80bf55
+  80a2bd:	ff 75 0c             	push   0xc(%ebp)
+  80a2c0:	e8 12 cb ff ff       	call   806dd7 <strcpy>
+	return 0;
+}
+  80a2c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a2ca:	c9                   	leave
+  80a2cb:	c3                   	ret
+
+0080a2cc <devcons_write>:
+{
+  80a2cc:	55                   	push   %ebp
+  80a2cd:	89 e5                	mov    %esp,%ebp
+  80a2cf:	57                   	push   %edi
+  80a2d0:	56                   	push   %esi
+  80a2d1:	53                   	push   %ebx
+  80a2d2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80a2d8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80a2dd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80a2e3:	eb 2e                	jmp    80a313 <devcons_write+0x47>
+		m = n - tot;
+  80a2e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80a2e8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80a2ea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80a2ef:	39 c3                	cmp    %eax,%ebx
+  80a2f1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80a2f4:	83 ec 04             	sub    $0x4,%esp
+  80a2f7:	53                   	push   %ebx
+  80a2f8:	89 f0                	mov    %esi,%eax
+  80a2fa:	03 45 0c             	add    0xc(%ebp),%eax
+  80a2fd:	50                   	push   %eax
+  80a2fe:	57                   	push   %edi
+  80a2ff:	e8 59 cc ff ff       	call   806f5d <memmove>
+		sys_cputs(buf, m);
+  80a304:	83 c4 08             	add    $0x8,%esp
+  80a307:	53                   	push   %ebx
+  80a308:	57                   	push   %edi
+  80a309:	e8 0d ce ff ff       	call   80711b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80a30e:	01 de                	add    %ebx,%esi
+  80a310:	83 c4 10             	add    $0x10,%esp
+  80a313:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80a316:	72 cd                	jb     80a2e5 <devcons_write+0x19>
+}
+  80a318:	89 f0                	mov    %esi,%eax
+  80a31a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80a31d:	5b                   	pop    %ebx
+  80a31e:	5e                   	pop    %esi
+  80a31f:	5f                   	pop    %edi
+  80a320:	5d                   	pop    %ebp
+  80a321:	c3                   	ret
+
+0080a322 <devcons_read>:
+{
+  80a322:	55                   	push   %ebp
+  80a323:	89 e5                	mov    %esp,%ebp
+  80a325:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80a328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a32d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80a331:	75 07                	jne    80a33a <devcons_read+0x18>
+  80a333:	eb 1f                	jmp    80a354 <devcons_read+0x32>
+		sys_yield();
+  80a335:	e8 af ce ff ff       	call   8071e9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80a33a:	e8 07 ce ff ff       	call   807146 <sys_cgetc>
+  80a33f:	85 c0                	test   %eax,%eax
+  80a341:	74 f2                	je     80a335 <devcons_read+0x13>
+	if (c < 0)
+  80a343:	78 0f                	js     80a354 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80a345:	83 f8 04             	cmp    $0x4,%eax
+  80a348:	74 0c                	je     80a356 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80a34a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80a34d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80a34f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80a354:	c9                   	leave
+  80a355:	c3                   	ret
+		return 0;
+  80a356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a35b:	eb f7                	jmp    80a354 <devcons_read+0x32>
+
+0080a35d <cputchar>:
+{
+  80a35d:	55                   	push   %ebp
+  80a35e:	89 e5                	mov    %esp,%ebp
+  80a360:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80a363:	8b 45 08             	mov    0x8(%ebp),%eax
+  80a366:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80a369:	6a 01                	push   $0x1
+  80a36b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80a36e:	50                   	push   %eax
+  80a36f:	e8 a7 cd ff ff       	call   80711b <sys_cputs>
+}
+  80a374:	83 c4 10             	add    $0x10,%esp
+  80a377:	c9                   	leave
+  80a378:	c3                   	ret
+
+0080a379 <getchar>:
+{
+  80a379:	55                   	push   %ebp
+  80a37a:	89 e5                	mov    %esp,%ebp
+  80a37c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80a37f:	6a 01                	push   $0x1
+  80a381:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80a384:	50                   	push   %eax
+  80a385:	6a 00                	push   $0x0
+  80a387:	e8 27 d8 ff ff       	call   807bb3 <read>
+	if (r < 0)
+  80a38c:	83 c4 10             	add    $0x10,%esp
+  80a38f:	85 c0                	test   %eax,%eax
+  80a391:	78 06                	js     80a399 <getchar+0x20>
+	if (r < 1)
+  80a393:	74 06                	je     80a39b <getchar+0x22>
+	return c;
+  80a395:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80a399:	c9                   	leave
+  80a39a:	c3                   	ret
+		return -E_EOF;
+  80a39b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80a3a0:	eb f7                	jmp    80a399 <getchar+0x20>
+
+0080a3a2 <iscons>:
+{
+  80a3a2:	55                   	push   %ebp
+  80a3a3:	89 e5                	mov    %esp,%ebp
+  80a3a5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80a3a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80a3ab:	50                   	push   %eax
+  80a3ac:	ff 75 08             	push   0x8(%ebp)
+  80a3af:	e8 6f d5 ff ff       	call   807923 <fd_lookup>
+  80a3b4:	83 c4 10             	add    $0x10,%esp
+  80a3b7:	85 c0                	test   %eax,%eax
+  80a3b9:	78 11                	js     80a3cc <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80a3bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80a3be:	8b 15 38 13 81 00    	mov    0x811338,%edx
+  80a3c4:	39 10                	cmp    %edx,(%eax)
+  80a3c6:	0f 94 c0             	sete   %al
+  80a3c9:	0f b6 c0             	movzbl %al,%eax
+}
+  80a3cc:	c9                   	leave
+  80a3cd:	c3                   	ret
+
+0080a3ce <opencons>:
+{
+  80a3ce:	55                   	push   %ebp
+  80a3cf:	89 e5                	mov    %esp,%ebp
+  80a3d1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80a3d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80a3d7:	50                   	push   %eax
+  80a3d8:	e8 f0 d4 ff ff       	call   8078cd <fd_alloc>
+  80a3dd:	83 c4 10             	add    $0x10,%esp
+  80a3e0:	85 c0                	test   %eax,%eax
+  80a3e2:	78 3a                	js     80a41e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80a3e4:	83 ec 04             	sub    $0x4,%esp
+  80a3e7:	68 07 04 00 00       	push   $0x407
+  80a3ec:	ff 75 f4             	push   -0xc(%ebp)
+  80a3ef:	6a 00                	push   $0x0
+  80a3f1:	e8 1f ce ff ff       	call   807215 <sys_page_alloc>
+  80a3f6:	83 c4 10             	add    $0x10,%esp
+  80a3f9:	85 c0                	test   %eax,%eax
+  80a3fb:	78 21                	js     80a41e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80a3fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80a400:	8b 15 38 13 81 00    	mov    0x811338,%edx
+  80a406:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80a408:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80a40b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80a412:	83 ec 0c             	sub    $0xc,%esp
+  80a415:	50                   	push   %eax
+  80a416:	e8 8b d4 ff ff       	call   8078a6 <fd2num>
+  80a41b:	83 c4 10             	add    $0x10,%esp
+}
+  80a41e:	c9                   	leave
+  80a41f:	c3                   	ret
+
+0080a420 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80a420:	55                   	push   %ebp
+  80a421:	89 e5                	mov    %esp,%ebp
+  80a423:	57                   	push   %edi
+  80a424:	56                   	push   %esi
+  80a425:	53                   	push   %ebx
+  80a426:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80a429:	89 d6                	mov    %edx,%esi
+  80a42b:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80a42e:	89 cf                	mov    %ecx,%edi
+  80a430:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80a433:	89 fa                	mov    %edi,%edx
+  80a435:	80 ce 08             	or     $0x8,%dh
+  80a438:	f6 c5 08             	test   $0x8,%ch
+  80a43b:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80a43e:	57                   	push   %edi
+  80a43f:	56                   	push   %esi
+  80a440:	50                   	push   %eax
+  80a441:	56                   	push   %esi
+  80a442:	6a 00                	push   $0x0
+  80a444:	e8 19 ce ff ff       	call   807262 <sys_page_map>
+	if (r < 0) {
+  80a449:	83 c4 20             	add    $0x20,%esp
+  80a44c:	85 c0                	test   %eax,%eax
+  80a44e:	78 27                	js     80a477 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80a450:	83 ec 0c             	sub    $0xc,%esp
+  80a453:	57                   	push   %edi
+  80a454:	56                   	push   %esi
+  80a455:	6a 00                	push   $0x0
+  80a457:	56                   	push   %esi
+  80a458:	6a 00                	push   $0x0
+  80a45a:	e8 03 ce ff ff       	call   807262 <sys_page_map>
+  80a45f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80a461:	83 c4 20             	add    $0x20,%esp
+  80a464:	85 c0                	test   %eax,%eax
+  80a466:	78 24                	js     80a48c <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80a468:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80a46d:	89 d8                	mov    %ebx,%eax
+  80a46f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80a472:	5b                   	pop    %ebx
+  80a473:	5e                   	pop    %esi
+  80a474:	5f                   	pop    %edi
+  80a475:	5d                   	pop    %ebp
+  80a476:	c3                   	ret
+  80a477:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80a479:	83 ec 08             	sub    $0x8,%esp
+  80a47c:	50                   	push   %eax
+  80a47d:	68 64 bf 80 00       	push   $0x80bf64
+  80a482:	e8 6c c3 ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a487:	83 c4 10             	add    $0x10,%esp
+  80a48a:	eb e1                	jmp    80a46d <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80a48c:	83 ec 08             	sub    $0x8,%esp
+  80a48f:	50                   	push   %eax
+  80a490:	68 94 bf 80 00       	push   $0x80bf94
+  80a495:	e8 59 c3 ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a49a:	83 c4 10             	add    $0x10,%esp
+  80a49d:	eb ce                	jmp    80a46d <duppage_cow+0x4d>
+
+0080a49f <duppage>:
+{
+  80a49f:	55                   	push   %ebp
+  80a4a0:	89 e5                	mov    %esp,%ebp
+  80a4a2:	53                   	push   %ebx
+  80a4a3:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80a4a6:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80a4a9:	51                   	push   %ecx
+  80a4aa:	52                   	push   %edx
+  80a4ab:	50                   	push   %eax
+  80a4ac:	52                   	push   %edx
+  80a4ad:	6a 00                	push   $0x0
+  80a4af:	e8 ae cd ff ff       	call   807262 <sys_page_map>
+	if (r < 0) {
+  80a4b4:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80a4b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80a4bc:	85 c0                	test   %eax,%eax
+  80a4be:	78 07                	js     80a4c7 <duppage+0x28>
+}
+  80a4c0:	89 d8                	mov    %ebx,%eax
+  80a4c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80a4c5:	c9                   	leave
+  80a4c6:	c3                   	ret
+  80a4c7:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80a4c9:	83 ec 08             	sub    $0x8,%esp
+  80a4cc:	50                   	push   %eax
+  80a4cd:	68 64 bf 80 00       	push   $0x80bf64
+  80a4d2:	e8 1c c3 ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a4d7:	83 c4 10             	add    $0x10,%esp
+  80a4da:	eb e4                	jmp    80a4c0 <duppage+0x21>
+
+0080a4dc <cow_copy>:
+{
+  80a4dc:	55                   	push   %ebp
+  80a4dd:	89 e5                	mov    %esp,%ebp
+  80a4df:	56                   	push   %esi
+  80a4e0:	53                   	push   %ebx
+  80a4e1:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80a4e3:	83 ec 04             	sub    $0x4,%esp
+  80a4e6:	6a 07                	push   $0x7
+  80a4e8:	68 00 f0 7f 00       	push   $0x7ff000
+  80a4ed:	6a 00                	push   $0x0
+  80a4ef:	e8 21 cd ff ff       	call   807215 <sys_page_alloc>
+	if (r < 0) {
+  80a4f4:	83 c4 10             	add    $0x10,%esp
+  80a4f7:	85 c0                	test   %eax,%eax
+  80a4f9:	78 58                	js     80a553 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80a4fb:	83 ec 04             	sub    $0x4,%esp
+  80a4fe:	68 00 10 00 00       	push   $0x1000
+  80a503:	56                   	push   %esi
+  80a504:	68 00 f0 7f 00       	push   $0x7ff000
+  80a509:	e8 4f ca ff ff       	call   806f5d <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80a50e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80a515:	56                   	push   %esi
+  80a516:	6a 00                	push   $0x0
+  80a518:	68 00 f0 7f 00       	push   $0x7ff000
+  80a51d:	6a 00                	push   $0x0
+  80a51f:	e8 3e cd ff ff       	call   807262 <sys_page_map>
+  80a524:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80a526:	83 c4 20             	add    $0x20,%esp
+  80a529:	85 c0                	test   %eax,%eax
+  80a52b:	78 3b                	js     80a568 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80a52d:	83 ec 08             	sub    $0x8,%esp
+  80a530:	68 00 f0 7f 00       	push   $0x7ff000
+  80a535:	6a 00                	push   $0x0
+  80a537:	e8 72 cd ff ff       	call   8072ae <sys_page_unmap>
+  80a53c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80a53e:	83 c4 10             	add    $0x10,%esp
+  80a541:	85 c0                	test   %eax,%eax
+  80a543:	78 45                	js     80a58a <cow_copy+0xae>
+	return 0;
+  80a545:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80a54a:	89 d8                	mov    %ebx,%eax
+  80a54c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80a54f:	5b                   	pop    %ebx
+  80a550:	5e                   	pop    %esi
+  80a551:	5d                   	pop    %ebp
+  80a552:	c3                   	ret
+  80a553:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80a555:	83 ec 08             	sub    $0x8,%esp
+  80a558:	50                   	push   %eax
+  80a559:	68 84 c0 80 00       	push   $0x80c084
+  80a55e:	e8 90 c2 ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a563:	83 c4 10             	add    $0x10,%esp
+  80a566:	eb e2                	jmp    80a54a <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80a568:	83 ec 08             	sub    $0x8,%esp
+  80a56b:	50                   	push   %eax
+  80a56c:	68 a0 c0 80 00       	push   $0x80c0a0
+  80a571:	e8 7d c2 ff ff       	call   8067f3 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80a576:	83 c4 08             	add    $0x8,%esp
+  80a579:	68 00 f0 7f 00       	push   $0x7ff000
+  80a57e:	6a 00                	push   $0x0
+  80a580:	e8 29 cd ff ff       	call   8072ae <sys_page_unmap>
+		return r;
+  80a585:	83 c4 10             	add    $0x10,%esp
+  80a588:	eb c0                	jmp    80a54a <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80a58a:	83 ec 08             	sub    $0x8,%esp
+  80a58d:	50                   	push   %eax
+  80a58e:	68 bc bf 80 00       	push   $0x80bfbc
+  80a593:	e8 5b c2 ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a598:	83 c4 10             	add    $0x10,%esp
+  80a59b:	eb ad                	jmp    80a54a <cow_copy+0x6e>
+
+0080a59d <pgfault>:
+{
+  80a59d:	55                   	push   %ebp
+  80a59e:	89 e5                	mov    %esp,%ebp
+  80a5a0:	56                   	push   %esi
+  80a5a1:	53                   	push   %ebx
+  80a5a2:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80a5a5:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80a5a7:	89 d8                	mov    %ebx,%eax
+  80a5a9:	c1 e8 16             	shr    $0x16,%eax
+  80a5ac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80a5b3:	89 de                	mov    %ebx,%esi
+  80a5b5:	c1 ee 0c             	shr    $0xc,%esi
+  80a5b8:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80a5bf:	a8 07                	test   $0x7,%al
+  80a5c1:	74 3b                	je     80a5fe <pgfault+0x61>
+  80a5c3:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80a5c9:	74 33                	je     80a5fe <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80a5cb:	83 ec 0c             	sub    $0xc,%esp
+  80a5ce:	68 00 f0 bf ee       	push   $0xeebff000
+  80a5d3:	e8 c8 f4 ff ff       	call   809aa0 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80a5d8:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80a5df:	83 c4 10             	add    $0x10,%esp
+  80a5e2:	f6 c4 08             	test   $0x8,%ah
+  80a5e5:	75 30                	jne    80a617 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80a5e7:	83 ec 0c             	sub    $0xc,%esp
+  80a5ea:	68 00 f0 bf ee       	push   $0xeebff000
+  80a5ef:	e8 19 f5 ff ff       	call   809b0d <mutex_unlock>
+}
+  80a5f4:	83 c4 10             	add    $0x10,%esp
+  80a5f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80a5fa:	5b                   	pop    %ebx
+  80a5fb:	5e                   	pop    %esi
+  80a5fc:	5d                   	pop    %ebp
+  80a5fd:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80a5fe:	83 ec 08             	sub    $0x8,%esp
+  80a601:	ff 72 28             	push   0x28(%edx)
+  80a604:	51                   	push   %ecx
+  80a605:	50                   	push   %eax
+  80a606:	68 e0 bf 80 00       	push   $0x80bfe0
+  80a60b:	6a 3f                	push   $0x3f
+  80a60d:	68 ba c0 80 00       	push   $0x80c0ba
+  80a612:	e8 01 c1 ff ff       	call   806718 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80a617:	89 d8                	mov    %ebx,%eax
+  80a619:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80a61e:	e8 b9 fe ff ff       	call   80a4dc <cow_copy>
+  80a623:	eb c2                	jmp    80a5e7 <pgfault+0x4a>
+
+0080a625 <cow_enable>:
+{
+  80a625:	55                   	push   %ebp
+  80a626:	89 e5                	mov    %esp,%ebp
+  80a628:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80a62b:	68 9d a5 80 00       	push   $0x80a59d
+  80a630:	e8 82 d0 ff ff       	call   8076b7 <set_pgfault_handler>
+}
+  80a635:	83 c4 10             	add    $0x10,%esp
+  80a638:	c9                   	leave
+  80a639:	c3                   	ret
+
+0080a63a <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80a63a:	55                   	push   %ebp
+  80a63b:	89 e5                	mov    %esp,%ebp
+  80a63d:	57                   	push   %edi
+  80a63e:	56                   	push   %esi
+  80a63f:	53                   	push   %ebx
+  80a640:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80a643:	68 9d a5 80 00       	push   $0x80a59d
+  80a648:	e8 6a d0 ff ff       	call   8076b7 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80a64d:	b8 07 00 00 00       	mov    $0x7,%eax
+  80a652:	cd 30                	int    $0x30
+  80a654:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80a657:	83 c4 10             	add    $0x10,%esp
+  80a65a:	85 c0                	test   %eax,%eax
+  80a65c:	78 4b                	js     80a6a9 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80a65e:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80a663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80a668:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80a66b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80a66f:	0f 85 16 01 00 00    	jne    80a78b <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80a675:	e8 43 cb ff ff       	call   8071bd <sys_getenvid>
+  80a67a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80a67f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a681:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80a687:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80a68d:	77 32                	ja     80a6c1 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a68f:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80a694:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80a696:	c1 ea 10             	shr    $0x10,%edx
+  80a699:	74 26                	je     80a6c1 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80a69b:	c1 e2 10             	shl    $0x10,%edx
+  80a69e:	89 d1                	mov    %edx,%ecx
+  80a6a0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80a6a5:	29 ca                	sub    %ecx,%edx
+  80a6a7:	eb 1e                	jmp    80a6c7 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80a6a9:	83 ec 08             	sub    $0x8,%esp
+  80a6ac:	89 c7                	mov    %eax,%edi
+  80a6ae:	50                   	push   %eax
+  80a6af:	68 c5 c0 80 00       	push   $0x80c0c5
+  80a6b4:	e8 3a c1 ff ff       	call   8067f3 <cprintf>
+		return eid;
+  80a6b9:	83 c4 10             	add    $0x10,%esp
+  80a6bc:	e9 6c 01 00 00       	jmp    80a82d <fork+0x1f3>
+		return pthread_main_tls;
+  80a6c1:	8b 15 40 c4 84 00    	mov    0x84c440,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80a6c7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80a6ca:	c1 e0 04             	shl    $0x4,%eax
+  80a6cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80a6d2:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80a6d4:	e8 10 fb ff ff       	call   80a1e9 <pthread_fork_child>
+		return eid;
+  80a6d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80a6dc:	e9 4c 01 00 00       	jmp    80a82d <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80a6e1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80a6e7:	89 da                	mov    %ebx,%edx
+  80a6e9:	89 f8                	mov    %edi,%eax
+  80a6eb:	e8 af fd ff ff       	call   80a49f <duppage>
+  80a6f0:	85 c0                	test   %eax,%eax
+  80a6f2:	79 28                	jns    80a71c <fork+0xe2>
+  80a6f4:	89 c7                	mov    %eax,%edi
+  80a6f6:	e9 32 01 00 00       	jmp    80a82d <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80a6fb:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80a701:	83 f9 05             	cmp    $0x5,%ecx
+  80a704:	75 58                	jne    80a75e <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80a706:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80a70b:	89 da                	mov    %ebx,%edx
+  80a70d:	89 f8                	mov    %edi,%eax
+  80a70f:	e8 8b fd ff ff       	call   80a49f <duppage>
+  80a714:	85 c0                	test   %eax,%eax
+  80a716:	0f 88 0f 01 00 00    	js     80a82b <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80a71c:	83 c3 01             	add    $0x1,%ebx
+  80a71f:	39 de                	cmp    %ebx,%esi
+  80a721:	74 54                	je     80a777 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80a723:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80a72a:	f6 c1 05             	test   $0x5,%cl
+  80a72d:	74 ed                	je     80a71c <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80a72f:	f6 c5 04             	test   $0x4,%ch
+  80a732:	75 ad                	jne    80a6e1 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80a734:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80a73a:	74 bf                	je     80a6fb <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80a73c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80a742:	74 d8                	je     80a71c <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80a744:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80a74a:	89 da                	mov    %ebx,%edx
+  80a74c:	89 f8                	mov    %edi,%eax
+  80a74e:	e8 cd fc ff ff       	call   80a420 <duppage_cow>
+  80a753:	85 c0                	test   %eax,%eax
+  80a755:	79 c5                	jns    80a71c <fork+0xe2>
+  80a757:	89 c7                	mov    %eax,%edi
+  80a759:	e9 cf 00 00 00       	jmp    80a82d <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80a75e:	68 10 c0 80 00       	push   $0x80c010
+  80a763:	68 2b ad 80 00       	push   $0x80ad2b
+  80a768:	68 c6 00 00 00       	push   $0xc6
+  80a76d:	68 ba c0 80 00       	push   $0x80c0ba
+  80a772:	e8 a1 bf ff ff       	call   806718 <_panic>
+  80a777:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80a77a:	83 c1 01             	add    $0x1,%ecx
+  80a77d:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80a783:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80a789:	74 18                	je     80a7a3 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80a78b:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80a792:	a8 07                	test   $0x7,%al
+  80a794:	74 e4                	je     80a77a <fork+0x140>
+  80a796:	89 cb                	mov    %ecx,%ebx
+  80a798:	c1 e3 0a             	shl    $0xa,%ebx
+  80a79b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80a79e:	e9 7c ff ff ff       	jmp    80a71f <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80a7a3:	83 ec 04             	sub    $0x4,%esp
+  80a7a6:	6a 07                	push   $0x7
+  80a7a8:	68 00 f0 bf ee       	push   $0xeebff000
+  80a7ad:	ff 75 e4             	push   -0x1c(%ebp)
+  80a7b0:	e8 60 ca ff ff       	call   807215 <sys_page_alloc>
+  80a7b5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80a7b7:	83 c4 10             	add    $0x10,%esp
+  80a7ba:	85 c0                	test   %eax,%eax
+  80a7bc:	78 34                	js     80a7f2 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80a7be:	83 ec 08             	sub    $0x8,%esp
+  80a7c1:	68 f5 76 80 00       	push   $0x8076f5
+  80a7c6:	ff 75 e4             	push   -0x1c(%ebp)
+  80a7c9:	e8 c4 cb ff ff       	call   807392 <sys_env_set_pgfault_upcall>
+  80a7ce:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80a7d0:	83 c4 10             	add    $0x10,%esp
+  80a7d3:	85 c0                	test   %eax,%eax
+  80a7d5:	78 2e                	js     80a805 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80a7d7:	83 ec 08             	sub    $0x8,%esp
+  80a7da:	6a 02                	push   $0x2
+  80a7dc:	ff 75 e4             	push   -0x1c(%ebp)
+  80a7df:	e8 16 cb ff ff       	call   8072fa <sys_env_set_status>
+  80a7e4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80a7e6:	83 c4 10             	add    $0x10,%esp
+  80a7e9:	85 c0                	test   %eax,%eax
+  80a7eb:	78 2b                	js     80a818 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80a7ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80a7f0:	eb 3b                	jmp    80a82d <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80a7f2:	83 ec 08             	sub    $0x8,%esp
+  80a7f5:	50                   	push   %eax
+  80a7f6:	68 38 c0 80 00       	push   $0x80c038
+  80a7fb:	e8 f3 bf ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a800:	83 c4 10             	add    $0x10,%esp
+  80a803:	eb 28                	jmp    80a82d <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80a805:	83 ec 08             	sub    $0x8,%esp
+  80a808:	50                   	push   %eax
+  80a809:	68 60 c0 80 00       	push   $0x80c060
+  80a80e:	e8 e0 bf ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a813:	83 c4 10             	add    $0x10,%esp
+  80a816:	eb 15                	jmp    80a82d <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80a818:	83 ec 08             	sub    $0x8,%esp
+  80a81b:	50                   	push   %eax
+  80a81c:	68 d5 c0 80 00       	push   $0x80c0d5
+  80a821:	e8 cd bf ff ff       	call   8067f3 <cprintf>
+		return r;
+  80a826:	83 c4 10             	add    $0x10,%esp
+  80a829:	eb 02                	jmp    80a82d <fork+0x1f3>
+  80a82b:	89 c7                	mov    %eax,%edi
+}
+  80a82d:	89 f8                	mov    %edi,%eax
+  80a82f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80a832:	5b                   	pop    %ebx
+  80a833:	5e                   	pop    %esi
+  80a834:	5f                   	pop    %edi
+  80a835:	5d                   	pop    %ebp
+  80a836:	c3                   	ret
+
+0080a837 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80a837:	55                   	push   %ebp
+  80a838:	89 e5                	mov    %esp,%ebp
+  80a83a:	57                   	push   %edi
+  80a83b:	56                   	push   %esi
+  80a83c:	53                   	push   %ebx
+  80a83d:	83 ec 2c             	sub    $0x2c,%esp
+  80a840:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a842:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80a848:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a84d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80a853:	77 0a                	ja     80a85f <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a855:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80a85a:	29 c3                	sub    %eax,%ebx
+  80a85c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80a85f:	83 ec 0c             	sub    $0xc,%esp
+  80a862:	68 9d a5 80 00       	push   $0x80a59d
+  80a867:	e8 4b ce ff ff       	call   8076b7 <set_pgfault_handler>
+  80a86c:	b8 07 00 00 00       	mov    $0x7,%eax
+  80a871:	cd 30                	int    $0x30
+  80a873:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80a876:	83 c4 10             	add    $0x10,%esp
+  80a879:	85 c0                	test   %eax,%eax
+  80a87b:	78 30                	js     80a8ad <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80a87d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80a881:	74 42                	je     80a8c5 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80a883:	c1 e3 10             	shl    $0x10,%ebx
+  80a886:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80a88b:	29 d8                	sub    %ebx,%eax
+  80a88d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80a890:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80a895:	29 d8                	sub    %ebx,%eax
+  80a897:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80a89a:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80a89f:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a8a4:	89 f7                	mov    %esi,%edi
+  80a8a6:	89 d6                	mov    %edx,%esi
+  80a8a8:	e9 2c 01 00 00       	jmp    80a9d9 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80a8ad:	83 ec 08             	sub    $0x8,%esp
+  80a8b0:	89 c7                	mov    %eax,%edi
+  80a8b2:	50                   	push   %eax
+  80a8b3:	68 c5 c0 80 00       	push   $0x80c0c5
+  80a8b8:	e8 36 bf ff ff       	call   8067f3 <cprintf>
+		return eid;
+  80a8bd:	83 c4 10             	add    $0x10,%esp
+  80a8c0:	e9 d5 00 00 00       	jmp    80a99a <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80a8c5:	e8 f3 c8 ff ff       	call   8071bd <sys_getenvid>
+  80a8ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80a8cf:	89 c2                	mov    %eax,%edx
+  80a8d1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80a8d3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80a8d9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80a8de:	77 18                	ja     80a8f8 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80a8e0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80a8e5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80a8e7:	c1 e8 10             	shr    $0x10,%eax
+  80a8ea:	74 0c                	je     80a8f8 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80a8ec:	c1 e0 10             	shl    $0x10,%eax
+  80a8ef:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80a8f4:	29 c1                	sub    %eax,%ecx
+  80a8f6:	eb 06                	jmp    80a8fe <sfork+0xc7>
+		return pthread_main_tls;
+  80a8f8:	8b 0d 40 c4 84 00    	mov    0x84c440,%ecx
+  80a8fe:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80a901:	c1 e0 04             	shl    $0x4,%eax
+  80a904:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80a909:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80a90b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80a90e:	e9 87 00 00 00       	jmp    80a99a <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80a913:	f6 c5 04             	test   $0x4,%ch
+  80a916:	74 6c                	je     80a984 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80a918:	89 ca                	mov    %ecx,%edx
+  80a91a:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80a920:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80a926:	74 7c                	je     80a9a4 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80a928:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80a92e:	89 da                	mov    %ebx,%edx
+  80a930:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80a933:	e8 67 fb ff ff       	call   80a49f <duppage>
+  80a938:	85 c0                	test   %eax,%eax
+  80a93a:	0f 88 4f 01 00 00    	js     80aa8f <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80a940:	83 c3 01             	add    $0x1,%ebx
+  80a943:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80a946:	74 7a                	je     80a9c2 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80a948:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80a94a:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80a951:	f6 c1 01             	test   $0x1,%cl
+  80a954:	74 ea                	je     80a940 <sfork+0x109>
+  80a956:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80a95c:	74 e2                	je     80a940 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80a95e:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80a964:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80a967:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80a96c:	76 a5                	jbe    80a913 <sfork+0xdc>
+  80a96e:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80a974:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80a977:	39 fa                	cmp    %edi,%edx
+  80a979:	73 9d                	jae    80a918 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80a97b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80a97e:	39 fa                	cmp    %edi,%edx
+  80a980:	72 96                	jb     80a918 <sfork+0xe1>
+  80a982:	eb 8f                	jmp    80a913 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80a984:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80a98a:	89 da                	mov    %ebx,%edx
+  80a98c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80a98f:	e8 8c fa ff ff       	call   80a420 <duppage_cow>
+  80a994:	85 c0                	test   %eax,%eax
+  80a996:	79 a8                	jns    80a940 <sfork+0x109>
+  80a998:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80a99a:	89 f8                	mov    %edi,%eax
+  80a99c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80a99f:	5b                   	pop    %ebx
+  80a9a0:	5e                   	pop    %esi
+  80a9a1:	5f                   	pop    %edi
+  80a9a2:	5d                   	pop    %ebp
+  80a9a3:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80a9a4:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80a9a9:	e8 2e fb ff ff       	call   80a4dc <cow_copy>
+  80a9ae:	85 c0                	test   %eax,%eax
+  80a9b0:	0f 88 d2 00 00 00    	js     80aa88 <sfork+0x251>
+				pte = uvpt[pn];
+  80a9b6:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80a9bd:	e9 66 ff ff ff       	jmp    80a928 <sfork+0xf1>
+  80a9c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80a9c5:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80a9c8:	83 c6 01             	add    $0x1,%esi
+  80a9cb:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80a9d1:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80a9d7:	74 1b                	je     80a9f4 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80a9d9:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80a9e0:	a8 01                	test   $0x1,%al
+  80a9e2:	74 e4                	je     80a9c8 <sfork+0x191>
+  80a9e4:	89 f3                	mov    %esi,%ebx
+  80a9e6:	c1 e3 0a             	shl    $0xa,%ebx
+  80a9e9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80a9ec:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80a9ef:	e9 4f ff ff ff       	jmp    80a943 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80a9f4:	83 ec 04             	sub    $0x4,%esp
+  80a9f7:	6a 07                	push   $0x7
+  80a9f9:	68 00 f0 bf ee       	push   $0xeebff000
+  80a9fe:	ff 75 e0             	push   -0x20(%ebp)
+  80aa01:	e8 0f c8 ff ff       	call   807215 <sys_page_alloc>
+  80aa06:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80aa08:	83 c4 10             	add    $0x10,%esp
+  80aa0b:	85 c0                	test   %eax,%eax
+  80aa0d:	78 37                	js     80aa46 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80aa0f:	83 ec 08             	sub    $0x8,%esp
+  80aa12:	68 f5 76 80 00       	push   $0x8076f5
+  80aa17:	ff 75 e0             	push   -0x20(%ebp)
+  80aa1a:	e8 73 c9 ff ff       	call   807392 <sys_env_set_pgfault_upcall>
+  80aa1f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80aa21:	83 c4 10             	add    $0x10,%esp
+  80aa24:	85 c0                	test   %eax,%eax
+  80aa26:	78 34                	js     80aa5c <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80aa28:	83 ec 08             	sub    $0x8,%esp
+  80aa2b:	6a 02                	push   $0x2
+  80aa2d:	ff 75 e0             	push   -0x20(%ebp)
+  80aa30:	e8 c5 c8 ff ff       	call   8072fa <sys_env_set_status>
+  80aa35:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80aa37:	83 c4 10             	add    $0x10,%esp
+  80aa3a:	85 c0                	test   %eax,%eax
+  80aa3c:	78 34                	js     80aa72 <sfork+0x23b>
+	return eid;
+  80aa3e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80aa41:	e9 54 ff ff ff       	jmp    80a99a <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80aa46:	83 ec 08             	sub    $0x8,%esp
+  80aa49:	50                   	push   %eax
+  80aa4a:	68 38 c0 80 00       	push   $0x80c038
+  80aa4f:	e8 9f bd ff ff       	call   8067f3 <cprintf>
+		return r;
+  80aa54:	83 c4 10             	add    $0x10,%esp
+  80aa57:	e9 3e ff ff ff       	jmp    80a99a <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80aa5c:	83 ec 08             	sub    $0x8,%esp
+  80aa5f:	50                   	push   %eax
+  80aa60:	68 60 c0 80 00       	push   $0x80c060
+  80aa65:	e8 89 bd ff ff       	call   8067f3 <cprintf>
+		return r;
+  80aa6a:	83 c4 10             	add    $0x10,%esp
+  80aa6d:	e9 28 ff ff ff       	jmp    80a99a <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80aa72:	83 ec 08             	sub    $0x8,%esp
+  80aa75:	50                   	push   %eax
+  80aa76:	68 d5 c0 80 00       	push   $0x80c0d5
+  80aa7b:	e8 73 bd ff ff       	call   8067f3 <cprintf>
+		return r;
+  80aa80:	83 c4 10             	add    $0x10,%esp
+  80aa83:	e9 12 ff ff ff       	jmp    80a99a <sfork+0x163>
+  80aa88:	89 c7                	mov    %eax,%edi
+  80aa8a:	e9 0b ff ff ff       	jmp    80a99a <sfork+0x163>
+  80aa8f:	89 c7                	mov    %eax,%edi
+  80aa91:	e9 04 ff ff ff       	jmp    80a99a <sfork+0x163>
+
+0080aa96 <udm>:
+  80aa96:	57                   	push   %edi
+  80aa97:	56                   	push   %esi
+  80aa98:	53                   	push   %ebx
+  80aa99:	83 ec 20             	sub    $0x20,%esp
+  80aa9c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80aaa0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80aaa4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80aaa8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80aaac:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80aab0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80aab4:	89 d1                	mov    %edx,%ecx
+  80aab6:	09 c1                	or     %eax,%ecx
+  80aab8:	0f 84 91 00 00 00    	je     80ab4f <udm+0xb9>
+  80aabe:	b8 00 00 00 00       	mov    $0x0,%eax
+  80aac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  80aac8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80aacd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80aad4:	00 
+  80aad5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80aadc:	00 
+  80aadd:	eb 08                	jmp    80aae7 <udm+0x51>
+  80aadf:	83 e9 01             	sub    $0x1,%ecx
+  80aae2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80aae5:	74 7c                	je     80ab63 <udm+0xcd>
+  80aae7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80aaeb:	01 c0                	add    %eax,%eax
+  80aaed:	89 c6                	mov    %eax,%esi
+  80aaef:	89 d7                	mov    %edx,%edi
+  80aaf1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80aaf5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80aaf9:	0f ad d0             	shrd   %cl,%edx,%eax
+  80aafc:	d3 ea                	shr    %cl,%edx
+  80aafe:	f6 c1 20             	test   $0x20,%cl
+  80ab01:	74 04                	je     80ab07 <udm+0x71>
+  80ab03:	89 d0                	mov    %edx,%eax
+  80ab05:	31 d2                	xor    %edx,%edx
+  80ab07:	83 e0 01             	and    $0x1,%eax
+  80ab0a:	89 04 24             	mov    %eax,(%esp)
+  80ab0d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80ab14:	00 
+  80ab15:	8b 04 24             	mov    (%esp),%eax
+  80ab18:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80ab1c:	09 f0                	or     %esi,%eax
+  80ab1e:	09 fa                	or     %edi,%edx
+  80ab20:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80ab24:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80ab28:	39 f0                	cmp    %esi,%eax
+  80ab2a:	89 d3                	mov    %edx,%ebx
+  80ab2c:	19 fb                	sbb    %edi,%ebx
+  80ab2e:	72 af                	jb     80aadf <udm+0x49>
+  80ab30:	29 f0                	sub    %esi,%eax
+  80ab32:	19 fa                	sbb    %edi,%edx
+  80ab34:	89 cf                	mov    %ecx,%edi
+  80ab36:	c1 ef 05             	shr    $0x5,%edi
+  80ab39:	83 e7 01             	and    $0x1,%edi
+  80ab3c:	89 fe                	mov    %edi,%esi
+  80ab3e:	83 f6 01             	xor    $0x1,%esi
+  80ab41:	d3 e6                	shl    %cl,%esi
+  80ab43:	d3 e7                	shl    %cl,%edi
+  80ab45:	09 74 24 18          	or     %esi,0x18(%esp)
+  80ab49:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80ab4d:	eb 90                	jmp    80aadf <udm+0x49>
+  80ab4f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80ab53:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80ab57:	89 f0                	mov    %esi,%eax
+  80ab59:	89 fa                	mov    %edi,%edx
+  80ab5b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80ab5f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80ab63:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80ab67:	89 01                	mov    %eax,(%ecx)
+  80ab69:	89 51 04             	mov    %edx,0x4(%ecx)
+  80ab6c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80ab70:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80ab74:	83 c4 20             	add    $0x20,%esp
+  80ab77:	5b                   	pop    %ebx
+  80ab78:	5e                   	pop    %esi
+  80ab79:	5f                   	pop    %edi
+  80ab7a:	c3                   	ret
+
+0080ab7b <__udivdi3>:
+  80ab7b:	83 ec 18             	sub    $0x18,%esp
+  80ab7e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80ab82:	50                   	push   %eax
+  80ab83:	ff 74 24 2c          	push   0x2c(%esp)
+  80ab87:	ff 74 24 2c          	push   0x2c(%esp)
+  80ab8b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80ab8f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80ab93:	e8 fe fe ff ff       	call   80aa96 <udm>
+  80ab98:	83 c4 24             	add    $0x24,%esp
+  80ab9b:	c3                   	ret
+
+0080ab9c <__umoddi3>:
+  80ab9c:	83 ec 18             	sub    $0x18,%esp
+  80ab9f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80aba3:	50                   	push   %eax
+  80aba4:	ff 74 24 2c          	push   0x2c(%esp)
+  80aba8:	ff 74 24 2c          	push   0x2c(%esp)
+  80abac:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80abb0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80abb4:	e8 dd fe ff ff       	call   80aa96 <udm>
+  80abb9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80abbd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80abc1:	83 c4 24             	add    $0x24,%esp
+  80abc4:	c3                   	ret
+
+0080abc5 <__divdi3>:
+  80abc5:	56                   	push   %esi
+  80abc6:	53                   	push   %ebx
+  80abc7:	83 ec 14             	sub    $0x14,%esp
+  80abca:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80abce:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80abd2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80abd6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80abda:	85 d2                	test   %edx,%edx
+  80abdc:	78 18                	js     80abf6 <__divdi3+0x31>
+  80abde:	85 db                	test   %ebx,%ebx
+  80abe0:	78 3e                	js     80ac20 <__divdi3+0x5b>
+  80abe2:	83 ec 04             	sub    $0x4,%esp
+  80abe5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80abe9:	56                   	push   %esi
+  80abea:	53                   	push   %ebx
+  80abeb:	51                   	push   %ecx
+  80abec:	e8 a5 fe ff ff       	call   80aa96 <udm>
+  80abf1:	83 c4 10             	add    $0x10,%esp
+  80abf4:	eb 24                	jmp    80ac1a <__divdi3+0x55>
+  80abf6:	f7 d8                	neg    %eax
+  80abf8:	83 d2 00             	adc    $0x0,%edx
+  80abfb:	f7 da                	neg    %edx
+  80abfd:	85 db                	test   %ebx,%ebx
+  80abff:	78 3a                	js     80ac3b <__divdi3+0x76>
+  80ac01:	83 ec 04             	sub    $0x4,%esp
+  80ac04:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80ac08:	56                   	push   %esi
+  80ac09:	53                   	push   %ebx
+  80ac0a:	51                   	push   %ecx
+  80ac0b:	e8 86 fe ff ff       	call   80aa96 <udm>
+  80ac10:	83 c4 10             	add    $0x10,%esp
+  80ac13:	f7 d8                	neg    %eax
+  80ac15:	83 d2 00             	adc    $0x0,%edx
+  80ac18:	f7 da                	neg    %edx
+  80ac1a:	83 c4 14             	add    $0x14,%esp
+  80ac1d:	5b                   	pop    %ebx
+  80ac1e:	5e                   	pop    %esi
+  80ac1f:	c3                   	ret
+  80ac20:	83 ec 04             	sub    $0x4,%esp
+  80ac23:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80ac27:	56                   	push   %esi
+  80ac28:	f7 d9                	neg    %ecx
+  80ac2a:	83 d3 00             	adc    $0x0,%ebx
+  80ac2d:	f7 db                	neg    %ebx
+  80ac2f:	53                   	push   %ebx
+  80ac30:	51                   	push   %ecx
+  80ac31:	e8 60 fe ff ff       	call   80aa96 <udm>
+  80ac36:	83 c4 10             	add    $0x10,%esp
+  80ac39:	eb d8                	jmp    80ac13 <__divdi3+0x4e>
+  80ac3b:	83 ec 04             	sub    $0x4,%esp
+  80ac3e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80ac42:	56                   	push   %esi
+  80ac43:	f7 d9                	neg    %ecx
+  80ac45:	83 d3 00             	adc    $0x0,%ebx
+  80ac48:	f7 db                	neg    %ebx
+  80ac4a:	53                   	push   %ebx
+  80ac4b:	51                   	push   %ecx
+  80ac4c:	e8 45 fe ff ff       	call   80aa96 <udm>
+  80ac51:	83 c4 10             	add    $0x10,%esp
+  80ac54:	eb c4                	jmp    80ac1a <__divdi3+0x55>
+
+0080ac56 <__moddi3>:
+  80ac56:	55                   	push   %ebp
+  80ac57:	57                   	push   %edi
+  80ac58:	56                   	push   %esi
+  80ac59:	53                   	push   %ebx
+  80ac5a:	83 ec 24             	sub    $0x24,%esp
+  80ac5d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80ac61:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80ac65:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80ac69:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80ac6d:	85 d2                	test   %edx,%edx
+  80ac6f:	78 3b                	js     80acac <__moddi3+0x56>
+  80ac71:	83 ec 04             	sub    $0x4,%esp
+  80ac74:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80ac78:	56                   	push   %esi
+  80ac79:	89 ce                	mov    %ecx,%esi
+  80ac7b:	f7 de                	neg    %esi
+  80ac7d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80ac81:	89 de                	mov    %ebx,%esi
+  80ac83:	83 d6 00             	adc    $0x0,%esi
+  80ac86:	f7 de                	neg    %esi
+  80ac88:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80ac8c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80ac90:	0f 48 f1             	cmovs  %ecx,%esi
+  80ac93:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80ac98:	53                   	push   %ebx
+  80ac99:	56                   	push   %esi
+  80ac9a:	e8 f7 fd ff ff       	call   80aa96 <udm>
+  80ac9f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80aca3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80aca7:	83 c4 10             	add    $0x10,%esp
+  80acaa:	eb 47                	jmp    80acf3 <__moddi3+0x9d>
+  80acac:	f7 d8                	neg    %eax
+  80acae:	83 d2 00             	adc    $0x0,%edx
+  80acb1:	f7 da                	neg    %edx
+  80acb3:	83 ec 04             	sub    $0x4,%esp
+  80acb6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80acba:	56                   	push   %esi
+  80acbb:	89 cf                	mov    %ecx,%edi
+  80acbd:	f7 df                	neg    %edi
+  80acbf:	89 de                	mov    %ebx,%esi
+  80acc1:	83 d6 00             	adc    $0x0,%esi
+  80acc4:	f7 de                	neg    %esi
+  80acc6:	0f 49 cf             	cmovns %edi,%ecx
+  80acc9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80accd:	0f 49 de             	cmovns %esi,%ebx
+  80acd0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80acd4:	ff 74 24 0c          	push   0xc(%esp)
+  80acd8:	ff 74 24 0c          	push   0xc(%esp)
+  80acdc:	e8 b5 fd ff ff       	call   80aa96 <udm>
+  80ace1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80ace5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80ace9:	f7 d8                	neg    %eax
+  80aceb:	83 d2 00             	adc    $0x0,%edx
+  80acee:	f7 da                	neg    %edx
+  80acf0:	83 c4 10             	add    $0x10,%esp
+  80acf3:	83 c4 24             	add    $0x24,%esp
+  80acf6:	5b                   	pop    %ebx
+  80acf7:	5e                   	pop    %esi
+  80acf8:	5f                   	pop    %edi
+  80acf9:	5d                   	pop    %ebp
+  80acfa:	c3                   	ret
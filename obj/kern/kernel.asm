@@ -0,0 +1,15210 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 40 11 00       	mov    $0x114000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+	jmp	*%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100034:	bc 00 40 11 f0       	mov    $0xf0114000,%esp
+
+	# now to C code
+	call	i386_init
+f0100039:	e8 61 00 00 00       	call   f010009f <i386_init>
+
+f010003e <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	53                   	push   %ebx
+f0100044:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f0100047:	83 3d 40 62 a4 f0 00 	cmpl   $0x0,0xf0a46240
+f010004e:	74 0f                	je     f010005f <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100050:	83 ec 0c             	sub    $0xc,%esp
+f0100053:	6a 00                	push   $0x0
+f0100055:	e8 e3 0d 00 00       	call   f0100e3d <monitor>
+f010005a:	83 c4 10             	add    $0x10,%esp
+f010005d:	eb f1                	jmp    f0100050 <_panic+0x10>
+	panicstr = fmt;
+f010005f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100062:	a3 40 62 a4 f0       	mov    %eax,0xf0a46240
+	asm volatile("cli; cld");
+f0100067:	fa                   	cli
+f0100068:	fc                   	cld
+	va_start(ap, fmt);
+f0100069:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010006c:	e8 ca 75 00 00       	call   f010763b <cpunum>
+f0100071:	ff 75 0c             	push   0xc(%ebp)
+f0100074:	ff 75 08             	push   0x8(%ebp)
+f0100077:	50                   	push   %eax
+f0100078:	68 00 8e 10 f0       	push   $0xf0108e00
+f010007d:	e8 fb 42 00 00       	call   f010437d <cprintf>
+	vcprintf(fmt, ap);
+f0100082:	83 c4 08             	add    $0x8,%esp
+f0100085:	53                   	push   %ebx
+f0100086:	ff 75 10             	push   0x10(%ebp)
+f0100089:	e8 c9 42 00 00       	call   f0104357 <vcprintf>
+	cprintf("\n");
+f010008e:	c7 04 24 12 a2 10 f0 	movl   $0xf010a212,(%esp)
+f0100095:	e8 e3 42 00 00       	call   f010437d <cprintf>
+f010009a:	83 c4 10             	add    $0x10,%esp
+f010009d:	eb b1                	jmp    f0100050 <_panic+0x10>
+
+f010009f <i386_init>:
+{
+f010009f:	55                   	push   %ebp
+f01000a0:	89 e5                	mov    %esp,%ebp
+f01000a2:	53                   	push   %ebx
+f01000a3:	83 ec 0c             	sub    $0xc,%esp
+	spin_initlock(&log_lock);
+f01000a6:	68 6c 8e 10 f0       	push   $0xf0108e6c
+f01000ab:	68 60 62 a4 f0       	push   $0xf0a46260
+f01000b0:	e8 db 77 00 00       	call   f0107890 <__spin_initlock>
+	cons_init();
+f01000b5:	e8 57 06 00 00       	call   f0100711 <cons_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f01000ba:	83 c4 08             	add    $0x8,%esp
+f01000bd:	68 ac 1a 00 00       	push   $0x1aac
+f01000c2:	68 76 8e 10 f0       	push   $0xf0108e76
+f01000c7:	e8 b1 42 00 00       	call   f010437d <cprintf>
+	mem_init();
+f01000cc:	e8 31 1a 00 00       	call   f0101b02 <mem_init>
+	env_init();
+f01000d1:	e8 4f 3a 00 00       	call   f0103b25 <env_init>
+	trap_init();
+f01000d6:	e8 6e 43 00 00       	call   f0104449 <trap_init>
+	mp_init();
+f01000db:	e8 75 72 00 00       	call   f0107355 <mp_init>
+	lapic_init();
+f01000e0:	e8 6c 75 00 00       	call   f0107651 <lapic_init>
+	pic_init();
+f01000e5:	e8 36 41 00 00       	call   f0104220 <pic_init>
+	time_init();
+f01000ea:	e8 91 83 00 00       	call   f0108480 <time_init>
+	pci_init();
+f01000ef:	e8 6c 83 00 00       	call   f0108460 <pci_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000f4:	c7 04 24 c0 63 11 f0 	movl   $0xf01163c0,(%esp)
+f01000fb:	e8 ab 77 00 00       	call   f01078ab <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0100100:	83 c4 10             	add    $0x10,%esp
+f0100103:	83 3d 98 62 a4 f0 07 	cmpl   $0x7,0xf0a46298
+f010010a:	76 27                	jbe    f0100133 <i386_init+0x94>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f010010c:	83 ec 04             	sub    $0x4,%esp
+f010010f:	b8 b2 72 10 f0       	mov    $0xf01072b2,%eax
+f0100114:	2d 38 72 10 f0       	sub    $0xf0107238,%eax
+f0100119:	50                   	push   %eax
+f010011a:	68 38 72 10 f0       	push   $0xf0107238
+f010011f:	68 00 70 00 f0       	push   $0xf0007000
+f0100124:	e8 51 6f 00 00       	call   f010707a <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0100129:	83 c4 10             	add    $0x10,%esp
+f010012c:	bb 20 70 a4 f0       	mov    $0xf0a47020,%ebx
+f0100131:	eb 19                	jmp    f010014c <i386_init+0xad>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100133:	68 00 70 00 00       	push   $0x7000
+f0100138:	68 24 8e 10 f0       	push   $0xf0108e24
+f010013d:	6a 5e                	push   $0x5e
+f010013f:	68 91 8e 10 f0       	push   $0xf0108e91
+f0100144:	e8 f7 fe ff ff       	call   f0100040 <_panic>
+f0100149:	83 c3 7c             	add    $0x7c,%ebx
+f010014c:	6b 05 04 74 a4 f0 7c 	imul   $0x7c,0xf0a47404,%eax
+f0100153:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f0100158:	39 c3                	cmp    %eax,%ebx
+f010015a:	73 4d                	jae    f01001a9 <i386_init+0x10a>
+		if (c == cpus + cpunum())  // We've started already.
+f010015c:	e8 da 74 00 00       	call   f010763b <cpunum>
+f0100161:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0100164:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f0100169:	39 c3                	cmp    %eax,%ebx
+f010016b:	74 dc                	je     f0100149 <i386_init+0xaa>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010016d:	89 d8                	mov    %ebx,%eax
+f010016f:	2d 20 70 a4 f0       	sub    $0xf0a47020,%eax
+f0100174:	c1 f8 02             	sar    $0x2,%eax
+f0100177:	69 c0 df 7b ef bd    	imul   $0xbdef7bdf,%eax,%eax
+f010017d:	c1 e0 0f             	shl    $0xf,%eax
+f0100180:	8d 80 00 00 a5 f0    	lea    -0xf5b0000(%eax),%eax
+f0100186:	a3 44 62 a4 f0       	mov    %eax,0xf0a46244
+		lapic_startap(c->cpu_id, PADDR(code));
+f010018b:	83 ec 08             	sub    $0x8,%esp
+f010018e:	68 00 70 00 00       	push   $0x7000
+f0100193:	0f b6 03             	movzbl (%ebx),%eax
+f0100196:	50                   	push   %eax
+f0100197:	e8 07 76 00 00       	call   f01077a3 <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f010019c:	83 c4 10             	add    $0x10,%esp
+f010019f:	8b 43 04             	mov    0x4(%ebx),%eax
+f01001a2:	83 f8 01             	cmp    $0x1,%eax
+f01001a5:	75 f8                	jne    f010019f <i386_init+0x100>
+f01001a7:	eb a0                	jmp    f0100149 <i386_init+0xaa>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001a9:	83 ec 08             	sub    $0x8,%esp
+f01001ac:	6a 01                	push   $0x1
+f01001ae:	68 e8 1e 61 f0       	push   $0xf0611ee8
+f01001b3:	e8 4b 3b 00 00       	call   f0103d03 <env_create>
+	ENV_CREATE(net_ns, ENV_TYPE_NS);
+f01001b8:	83 c4 08             	add    $0x8,%esp
+f01001bb:	6a 02                	push   $0x2
+f01001bd:	68 64 ca 73 f0       	push   $0xf073ca64
+f01001c2:	e8 3c 3b 00 00       	call   f0103d03 <env_create>
+	ENV_CREATE(user_icode, ENV_TYPE_USER);
+f01001c7:	83 c4 08             	add    $0x8,%esp
+f01001ca:	6a 00                	push   $0x0
+f01001cc:	68 a8 c0 5e f0       	push   $0xf05ec0a8
+f01001d1:	e8 2d 3b 00 00       	call   f0103d03 <env_create>
+	kbd_intr();
+f01001d6:	e8 e2 04 00 00       	call   f01006bd <kbd_intr>
+	sched_yield();
+f01001db:	e8 13 51 00 00       	call   f01052f3 <sched_yield>
+
+f01001e0 <mp_main>:
+{
+f01001e0:	55                   	push   %ebp
+f01001e1:	89 e5                	mov    %esp,%ebp
+f01001e3:	83 ec 08             	sub    $0x8,%esp
+	lcr3(PADDR(kern_pgdir));
+f01001e6:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01001eb:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01001f0:	76 52                	jbe    f0100244 <mp_main+0x64>
+	return (physaddr_t)kva - KERNBASE;
+f01001f2:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static inline void
+lcr3(uint32_t val)
+{
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01001f7:	0f 22 d8             	mov    %eax,%cr3
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f01001fa:	e8 3c 74 00 00       	call   f010763b <cpunum>
+f01001ff:	83 ec 08             	sub    $0x8,%esp
+f0100202:	50                   	push   %eax
+f0100203:	68 9d 8e 10 f0       	push   $0xf0108e9d
+f0100208:	e8 70 41 00 00       	call   f010437d <cprintf>
+	lapic_init();
+f010020d:	e8 3f 74 00 00       	call   f0107651 <lapic_init>
+	env_init_percpu();
+f0100212:	e8 e2 38 00 00       	call   f0103af9 <env_init_percpu>
+	trap_init_percpu();
+f0100217:	e8 75 41 00 00       	call   f0104391 <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010021c:	e8 1a 74 00 00       	call   f010763b <cpunum>
+f0100221:	6b d0 7c             	imul   $0x7c,%eax,%edx
+f0100224:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f0100227:	b8 01 00 00 00       	mov    $0x1,%eax
+f010022c:	f0 87 82 20 70 a4 f0 	lock xchg %eax,-0xf5b8fe0(%edx)
+f0100233:	c7 04 24 c0 63 11 f0 	movl   $0xf01163c0,(%esp)
+f010023a:	e8 6c 76 00 00       	call   f01078ab <spin_lock>
+	sched_yield();
+f010023f:	e8 af 50 00 00       	call   f01052f3 <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100244:	50                   	push   %eax
+f0100245:	68 48 8e 10 f0       	push   $0xf0108e48
+f010024a:	6a 75                	push   $0x75
+f010024c:	68 91 8e 10 f0       	push   $0xf0108e91
+f0100251:	e8 ea fd ff ff       	call   f0100040 <_panic>
+
+f0100256 <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f0100256:	55                   	push   %ebp
+f0100257:	89 e5                	mov    %esp,%ebp
+f0100259:	53                   	push   %ebx
+f010025a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f010025d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f0100260:	ff 75 0c             	push   0xc(%ebp)
+f0100263:	ff 75 08             	push   0x8(%ebp)
+f0100266:	68 b3 8e 10 f0       	push   $0xf0108eb3
+f010026b:	e8 0d 41 00 00       	call   f010437d <cprintf>
+	vcprintf(fmt, ap);
+f0100270:	83 c4 08             	add    $0x8,%esp
+f0100273:	53                   	push   %ebx
+f0100274:	ff 75 10             	push   0x10(%ebp)
+f0100277:	e8 db 40 00 00       	call   f0104357 <vcprintf>
+	cprintf("\n");
+f010027c:	c7 04 24 12 a2 10 f0 	movl   $0xf010a212,(%esp)
+f0100283:	e8 f5 40 00 00       	call   f010437d <cprintf>
+	va_end(ap);
+}
+f0100288:	83 c4 10             	add    $0x10,%esp
+f010028b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010028e:	c9                   	leave
+f010028f:	c3                   	ret
+
+f0100290 <_log>:
+
+void
+_log(const char *file, const char *func, int line, const char *fmt,...)
+{
+f0100290:	55                   	push   %ebp
+f0100291:	89 e5                	mov    %esp,%ebp
+f0100293:	53                   	push   %ebx
+f0100294:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f0100297:	8d 5d 18             	lea    0x18(%ebp),%ebx
+	spin_lock(&log_lock);
+f010029a:	68 60 62 a4 f0       	push   $0xf0a46260
+f010029f:	e8 07 76 00 00       	call   f01078ab <spin_lock>
+	if (thiscpu) {
+f01002a4:	e8 92 73 00 00       	call   f010763b <cpunum>
+		cprintf("cpu %d ", thiscpu->cpu_id);
+f01002a9:	e8 8d 73 00 00       	call   f010763b <cpunum>
+f01002ae:	83 c4 08             	add    $0x8,%esp
+f01002b1:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01002b4:	0f b6 80 20 70 a4 f0 	movzbl -0xf5b8fe0(%eax),%eax
+f01002bb:	50                   	push   %eax
+f01002bc:	68 cd 8e 10 f0       	push   $0xf0108ecd
+f01002c1:	e8 b7 40 00 00       	call   f010437d <cprintf>
+	}
+	if (curenv) {
+f01002c6:	e8 70 73 00 00       	call   f010763b <cpunum>
+f01002cb:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01002ce:	83 c4 10             	add    $0x10,%esp
+f01002d1:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f01002d8:	74 21                	je     f01002fb <_log+0x6b>
+		cprintf(" env 0x%x : ", curenv->env_id);
+f01002da:	e8 5c 73 00 00       	call   f010763b <cpunum>
+f01002df:	83 ec 08             	sub    $0x8,%esp
+f01002e2:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01002e5:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01002eb:	ff 70 48             	push   0x48(%eax)
+f01002ee:	68 d5 8e 10 f0       	push   $0xf0108ed5
+f01002f3:	e8 85 40 00 00       	call   f010437d <cprintf>
+f01002f8:	83 c4 10             	add    $0x10,%esp
+	}
+	cprintf("%s:%d %s: ", file, line, func);
+f01002fb:	ff 75 0c             	push   0xc(%ebp)
+f01002fe:	ff 75 10             	push   0x10(%ebp)
+f0100301:	ff 75 08             	push   0x8(%ebp)
+f0100304:	68 e2 8e 10 f0       	push   $0xf0108ee2
+f0100309:	e8 6f 40 00 00       	call   f010437d <cprintf>
+	vcprintf(fmt, ap);
+f010030e:	83 c4 08             	add    $0x8,%esp
+f0100311:	53                   	push   %ebx
+f0100312:	ff 75 14             	push   0x14(%ebp)
+f0100315:	e8 3d 40 00 00       	call   f0104357 <vcprintf>
+	spin_unlock(&log_lock);
+f010031a:	c7 04 24 60 62 a4 f0 	movl   $0xf0a46260,(%esp)
+f0100321:	e8 1f 76 00 00       	call   f0107945 <spin_unlock>
+	cprintf("\n");
+f0100326:	c7 04 24 12 a2 10 f0 	movl   $0xf010a212,(%esp)
+f010032d:	e8 4b 40 00 00       	call   f010437d <cprintf>
+	va_end(ap);
+}
+f0100332:	83 c4 10             	add    $0x10,%esp
+f0100335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100338:	c9                   	leave
+f0100339:	c3                   	ret
+
+f010033a <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010033a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f010033f:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f0100340:	a8 01                	test   $0x1,%al
+f0100342:	74 0a                	je     f010034e <serial_proc_data+0x14>
+f0100344:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100349:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f010034a:	0f b6 c0             	movzbl %al,%eax
+f010034d:	c3                   	ret
+		return -1;
+f010034e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100353:	c3                   	ret
+
+f0100354 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f0100354:	55                   	push   %ebp
+f0100355:	89 e5                	mov    %esp,%ebp
+f0100357:	53                   	push   %ebx
+f0100358:	83 ec 04             	sub    $0x4,%esp
+f010035b:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+f010035d:	eb 23                	jmp    f0100382 <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f010035f:	8b 0d 24 42 a2 f0    	mov    0xf0a24224,%ecx
+f0100365:	8d 51 01             	lea    0x1(%ecx),%edx
+f0100368:	88 81 20 40 a2 f0    	mov    %al,-0xf5dbfe0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f010036e:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f0100374:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100379:	0f 44 d0             	cmove  %eax,%edx
+f010037c:	89 15 24 42 a2 f0    	mov    %edx,0xf0a24224
+	while ((c = (*proc)()) != -1) {
+f0100382:	ff d3                	call   *%ebx
+f0100384:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0100387:	74 06                	je     f010038f <cons_intr+0x3b>
+		if (c == 0)
+f0100389:	85 c0                	test   %eax,%eax
+f010038b:	75 d2                	jne    f010035f <cons_intr+0xb>
+f010038d:	eb f3                	jmp    f0100382 <cons_intr+0x2e>
+	}
+}
+f010038f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100392:	c9                   	leave
+f0100393:	c3                   	ret
+
+f0100394 <kbd_proc_data>:
+{
+f0100394:	55                   	push   %ebp
+f0100395:	89 e5                	mov    %esp,%ebp
+f0100397:	53                   	push   %ebx
+f0100398:	83 ec 04             	sub    $0x4,%esp
+f010039b:	ba 64 00 00 00       	mov    $0x64,%edx
+f01003a0:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f01003a1:	a8 01                	test   $0x1,%al
+f01003a3:	0f 84 ee 00 00 00    	je     f0100497 <kbd_proc_data+0x103>
+	if (stat & KBS_TERR)
+f01003a9:	a8 20                	test   $0x20,%al
+f01003ab:	0f 85 ed 00 00 00    	jne    f010049e <kbd_proc_data+0x10a>
+f01003b1:	ba 60 00 00 00       	mov    $0x60,%edx
+f01003b6:	ec                   	in     (%dx),%al
+f01003b7:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f01003b9:	3c e0                	cmp    $0xe0,%al
+f01003bb:	74 61                	je     f010041e <kbd_proc_data+0x8a>
+	} else if (data & 0x80) {
+f01003bd:	84 c0                	test   %al,%al
+f01003bf:	78 70                	js     f0100431 <kbd_proc_data+0x9d>
+	} else if (shift & E0ESC) {
+f01003c1:	8b 0d 00 40 a2 f0    	mov    0xf0a24000,%ecx
+f01003c7:	f6 c1 40             	test   $0x40,%cl
+f01003ca:	74 0e                	je     f01003da <kbd_proc_data+0x46>
+		data |= 0x80;
+f01003cc:	83 c8 80             	or     $0xffffff80,%eax
+f01003cf:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f01003d1:	83 e1 bf             	and    $0xffffffbf,%ecx
+f01003d4:	89 0d 00 40 a2 f0    	mov    %ecx,0xf0a24000
+	shift |= shiftcode[data];
+f01003da:	0f b6 d2             	movzbl %dl,%edx
+f01003dd:	0f b6 82 40 90 10 f0 	movzbl -0xfef6fc0(%edx),%eax
+f01003e4:	0b 05 00 40 a2 f0    	or     0xf0a24000,%eax
+	shift ^= togglecode[data];
+f01003ea:	0f b6 8a 40 8f 10 f0 	movzbl -0xfef70c0(%edx),%ecx
+f01003f1:	31 c8                	xor    %ecx,%eax
+f01003f3:	a3 00 40 a2 f0       	mov    %eax,0xf0a24000
+	c = charcode[shift & (CTL | SHIFT)][data];
+f01003f8:	89 c1                	mov    %eax,%ecx
+f01003fa:	83 e1 03             	and    $0x3,%ecx
+f01003fd:	8b 0c 8d 20 8f 10 f0 	mov    -0xfef70e0(,%ecx,4),%ecx
+f0100404:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100408:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f010040b:	a8 08                	test   $0x8,%al
+f010040d:	74 5d                	je     f010046c <kbd_proc_data+0xd8>
+		if ('a' <= c && c <= 'z')
+f010040f:	89 da                	mov    %ebx,%edx
+f0100411:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100414:	83 f9 19             	cmp    $0x19,%ecx
+f0100417:	77 47                	ja     f0100460 <kbd_proc_data+0xcc>
+			c += 'A' - 'a';
+f0100419:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010041c:	eb 0c                	jmp    f010042a <kbd_proc_data+0x96>
+		shift |= E0ESC;
+f010041e:	83 0d 00 40 a2 f0 40 	orl    $0x40,0xf0a24000
+		return 0;
+f0100425:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f010042a:	89 d8                	mov    %ebx,%eax
+f010042c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010042f:	c9                   	leave
+f0100430:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f0100431:	8b 0d 00 40 a2 f0    	mov    0xf0a24000,%ecx
+f0100437:	83 e0 7f             	and    $0x7f,%eax
+f010043a:	f6 c1 40             	test   $0x40,%cl
+f010043d:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f0100440:	0f b6 d2             	movzbl %dl,%edx
+f0100443:	0f b6 82 40 90 10 f0 	movzbl -0xfef6fc0(%edx),%eax
+f010044a:	83 c8 40             	or     $0x40,%eax
+f010044d:	0f b6 c0             	movzbl %al,%eax
+f0100450:	f7 d0                	not    %eax
+f0100452:	21 c8                	and    %ecx,%eax
+f0100454:	a3 00 40 a2 f0       	mov    %eax,0xf0a24000
+		return 0;
+f0100459:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010045e:	eb ca                	jmp    f010042a <kbd_proc_data+0x96>
+		else if ('A' <= c && c <= 'Z')
+f0100460:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f0100463:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f0100466:	83 fa 1a             	cmp    $0x1a,%edx
+f0100469:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010046c:	f7 d0                	not    %eax
+f010046e:	a8 06                	test   $0x6,%al
+f0100470:	75 b8                	jne    f010042a <kbd_proc_data+0x96>
+f0100472:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f0100478:	75 b0                	jne    f010042a <kbd_proc_data+0x96>
+		cprintf("Rebooting!\n");
+f010047a:	83 ec 0c             	sub    $0xc,%esp
+f010047d:	68 ed 8e 10 f0       	push   $0xf0108eed
+f0100482:	e8 f6 3e 00 00       	call   f010437d <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100487:	b8 03 00 00 00       	mov    $0x3,%eax
+f010048c:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100491:	ee                   	out    %al,(%dx)
+}
+f0100492:	83 c4 10             	add    $0x10,%esp
+f0100495:	eb 93                	jmp    f010042a <kbd_proc_data+0x96>
+		return -1;
+f0100497:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f010049c:	eb 8c                	jmp    f010042a <kbd_proc_data+0x96>
+		return -1;
+f010049e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f01004a3:	eb 85                	jmp    f010042a <kbd_proc_data+0x96>
+
+f01004a5 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f01004a5:	55                   	push   %ebp
+f01004a6:	89 e5                	mov    %esp,%ebp
+f01004a8:	57                   	push   %edi
+f01004a9:	56                   	push   %esi
+f01004aa:	53                   	push   %ebx
+f01004ab:	83 ec 1c             	sub    $0x1c,%esp
+f01004ae:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f01004b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01004b5:	be fd 03 00 00       	mov    $0x3fd,%esi
+f01004ba:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004bf:	89 f2                	mov    %esi,%edx
+f01004c1:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f01004c2:	a8 20                	test   $0x20,%al
+f01004c4:	75 13                	jne    f01004d9 <cons_putc+0x34>
+f01004c6:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004cc:	7f 0b                	jg     f01004d9 <cons_putc+0x34>
+f01004ce:	89 ca                	mov    %ecx,%edx
+f01004d0:	ec                   	in     (%dx),%al
+f01004d1:	ec                   	in     (%dx),%al
+f01004d2:	ec                   	in     (%dx),%al
+f01004d3:	ec                   	in     (%dx),%al
+	     i++)
+f01004d4:	83 c3 01             	add    $0x1,%ebx
+f01004d7:	eb e6                	jmp    f01004bf <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f01004d9:	89 f8                	mov    %edi,%eax
+f01004db:	88 45 e7             	mov    %al,-0x19(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01004de:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01004e3:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f01004e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01004e9:	be 79 03 00 00       	mov    $0x379,%esi
+f01004ee:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004f3:	89 f2                	mov    %esi,%edx
+f01004f5:	ec                   	in     (%dx),%al
+f01004f6:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004fc:	7f 0f                	jg     f010050d <cons_putc+0x68>
+f01004fe:	84 c0                	test   %al,%al
+f0100500:	78 0b                	js     f010050d <cons_putc+0x68>
+f0100502:	89 ca                	mov    %ecx,%edx
+f0100504:	ec                   	in     (%dx),%al
+f0100505:	ec                   	in     (%dx),%al
+f0100506:	ec                   	in     (%dx),%al
+f0100507:	ec                   	in     (%dx),%al
+f0100508:	83 c3 01             	add    $0x1,%ebx
+f010050b:	eb e6                	jmp    f01004f3 <cons_putc+0x4e>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010050d:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100512:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0100516:	ee                   	out    %al,(%dx)
+f0100517:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f010051c:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100521:	ee                   	out    %al,(%dx)
+f0100522:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100527:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f0100528:	89 f8                	mov    %edi,%eax
+f010052a:	80 cc 07             	or     $0x7,%ah
+f010052d:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f0100533:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f0100536:	89 f8                	mov    %edi,%eax
+f0100538:	0f b6 c0             	movzbl %al,%eax
+f010053b:	89 fb                	mov    %edi,%ebx
+f010053d:	80 fb 0a             	cmp    $0xa,%bl
+f0100540:	0f 84 e1 00 00 00    	je     f0100627 <cons_putc+0x182>
+f0100546:	83 f8 0a             	cmp    $0xa,%eax
+f0100549:	7f 46                	jg     f0100591 <cons_putc+0xec>
+f010054b:	83 f8 08             	cmp    $0x8,%eax
+f010054e:	0f 84 a7 00 00 00    	je     f01005fb <cons_putc+0x156>
+f0100554:	83 f8 09             	cmp    $0x9,%eax
+f0100557:	0f 85 d7 00 00 00    	jne    f0100634 <cons_putc+0x18f>
+		cons_putc(' ');
+f010055d:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100562:	e8 3e ff ff ff       	call   f01004a5 <cons_putc>
+		cons_putc(' ');
+f0100567:	b8 20 00 00 00       	mov    $0x20,%eax
+f010056c:	e8 34 ff ff ff       	call   f01004a5 <cons_putc>
+		cons_putc(' ');
+f0100571:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100576:	e8 2a ff ff ff       	call   f01004a5 <cons_putc>
+		cons_putc(' ');
+f010057b:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100580:	e8 20 ff ff ff       	call   f01004a5 <cons_putc>
+		cons_putc(' ');
+f0100585:	b8 20 00 00 00       	mov    $0x20,%eax
+f010058a:	e8 16 ff ff ff       	call   f01004a5 <cons_putc>
+		break;
+f010058f:	eb 25                	jmp    f01005b6 <cons_putc+0x111>
+	switch (c & 0xff) {
+f0100591:	83 f8 0d             	cmp    $0xd,%eax
+f0100594:	0f 85 9a 00 00 00    	jne    f0100634 <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f010059a:	0f b7 05 28 42 a2 f0 	movzwl 0xf0a24228,%eax
+f01005a1:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f01005a7:	c1 e8 16             	shr    $0x16,%eax
+f01005aa:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01005ad:	c1 e0 04             	shl    $0x4,%eax
+f01005b0:	66 a3 28 42 a2 f0    	mov    %ax,0xf0a24228
+	if (crt_pos >= CRT_SIZE) {
+f01005b6:	66 81 3d 28 42 a2 f0 	cmpw   $0x7cf,0xf0a24228
+f01005bd:	cf 07 
+f01005bf:	0f 87 92 00 00 00    	ja     f0100657 <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f01005c5:	8b 0d 30 42 a2 f0    	mov    0xf0a24230,%ecx
+f01005cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01005d0:	89 ca                	mov    %ecx,%edx
+f01005d2:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f01005d3:	0f b7 1d 28 42 a2 f0 	movzwl 0xf0a24228,%ebx
+f01005da:	8d 71 01             	lea    0x1(%ecx),%esi
+f01005dd:	89 d8                	mov    %ebx,%eax
+f01005df:	66 c1 e8 08          	shr    $0x8,%ax
+f01005e3:	89 f2                	mov    %esi,%edx
+f01005e5:	ee                   	out    %al,(%dx)
+f01005e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01005eb:	89 ca                	mov    %ecx,%edx
+f01005ed:	ee                   	out    %al,(%dx)
+f01005ee:	89 d8                	mov    %ebx,%eax
+f01005f0:	89 f2                	mov    %esi,%edx
+f01005f2:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f01005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01005f6:	5b                   	pop    %ebx
+f01005f7:	5e                   	pop    %esi
+f01005f8:	5f                   	pop    %edi
+f01005f9:	5d                   	pop    %ebp
+f01005fa:	c3                   	ret
+		if (crt_pos > 0) {
+f01005fb:	0f b7 05 28 42 a2 f0 	movzwl 0xf0a24228,%eax
+f0100602:	66 85 c0             	test   %ax,%ax
+f0100605:	74 be                	je     f01005c5 <cons_putc+0x120>
+			crt_pos--;
+f0100607:	83 e8 01             	sub    $0x1,%eax
+f010060a:	66 a3 28 42 a2 f0    	mov    %ax,0xf0a24228
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f0100610:	0f b7 c0             	movzwl %ax,%eax
+f0100613:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100618:	83 cf 20             	or     $0x20,%edi
+f010061b:	8b 15 2c 42 a2 f0    	mov    0xf0a2422c,%edx
+f0100621:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f0100625:	eb 8f                	jmp    f01005b6 <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f0100627:	66 83 05 28 42 a2 f0 	addw   $0x50,0xf0a24228
+f010062e:	50 
+f010062f:	e9 66 ff ff ff       	jmp    f010059a <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f0100634:	0f b7 05 28 42 a2 f0 	movzwl 0xf0a24228,%eax
+f010063b:	8d 50 01             	lea    0x1(%eax),%edx
+f010063e:	66 89 15 28 42 a2 f0 	mov    %dx,0xf0a24228
+f0100645:	0f b7 c0             	movzwl %ax,%eax
+f0100648:	8b 15 2c 42 a2 f0    	mov    0xf0a2422c,%edx
+f010064e:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f0100652:	e9 5f ff ff ff       	jmp    f01005b6 <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f0100657:	a1 2c 42 a2 f0       	mov    0xf0a2422c,%eax
+f010065c:	83 ec 04             	sub    $0x4,%esp
+f010065f:	68 00 0f 00 00       	push   $0xf00
+f0100664:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f010066a:	52                   	push   %edx
+f010066b:	50                   	push   %eax
+f010066c:	e8 09 6a 00 00       	call   f010707a <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f0100671:	8b 15 2c 42 a2 f0    	mov    0xf0a2422c,%edx
+f0100677:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f010067d:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100683:	83 c4 10             	add    $0x10,%esp
+f0100686:	eb 08                	jmp    f0100690 <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f0100688:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f010068d:	83 c0 02             	add    $0x2,%eax
+f0100690:	39 d0                	cmp    %edx,%eax
+f0100692:	75 f4                	jne    f0100688 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f0100694:	66 83 2d 28 42 a2 f0 	subw   $0x50,0xf0a24228
+f010069b:	50 
+f010069c:	e9 24 ff ff ff       	jmp    f01005c5 <cons_putc+0x120>
+
+f01006a1 <serial_intr>:
+	if (serial_exists)
+f01006a1:	80 3d 34 42 a2 f0 00 	cmpb   $0x0,0xf0a24234
+f01006a8:	75 01                	jne    f01006ab <serial_intr+0xa>
+f01006aa:	c3                   	ret
+{
+f01006ab:	55                   	push   %ebp
+f01006ac:	89 e5                	mov    %esp,%ebp
+f01006ae:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f01006b1:	b8 3a 03 10 f0       	mov    $0xf010033a,%eax
+f01006b6:	e8 99 fc ff ff       	call   f0100354 <cons_intr>
+}
+f01006bb:	c9                   	leave
+f01006bc:	c3                   	ret
+
+f01006bd <kbd_intr>:
+{
+f01006bd:	55                   	push   %ebp
+f01006be:	89 e5                	mov    %esp,%ebp
+f01006c0:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f01006c3:	b8 94 03 10 f0       	mov    $0xf0100394,%eax
+f01006c8:	e8 87 fc ff ff       	call   f0100354 <cons_intr>
+}
+f01006cd:	c9                   	leave
+f01006ce:	c3                   	ret
+
+f01006cf <cons_getc>:
+{
+f01006cf:	55                   	push   %ebp
+f01006d0:	89 e5                	mov    %esp,%ebp
+f01006d2:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+f01006d5:	e8 c7 ff ff ff       	call   f01006a1 <serial_intr>
+	kbd_intr();
+f01006da:	e8 de ff ff ff       	call   f01006bd <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+f01006df:	a1 20 42 a2 f0       	mov    0xf0a24220,%eax
+	return 0;
+f01006e4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f01006e9:	3b 05 24 42 a2 f0    	cmp    0xf0a24224,%eax
+f01006ef:	74 1c                	je     f010070d <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+f01006f1:	8d 48 01             	lea    0x1(%eax),%ecx
+f01006f4:	0f b6 90 20 40 a2 f0 	movzbl -0xf5dbfe0(%eax),%edx
+			cons.rpos = 0;
+f01006fb:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f0100700:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100705:	0f 45 c1             	cmovne %ecx,%eax
+f0100708:	a3 20 42 a2 f0       	mov    %eax,0xf0a24220
+}
+f010070d:	89 d0                	mov    %edx,%eax
+f010070f:	c9                   	leave
+f0100710:	c3                   	ret
+
+f0100711 <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f0100711:	55                   	push   %ebp
+f0100712:	89 e5                	mov    %esp,%ebp
+f0100714:	57                   	push   %edi
+f0100715:	56                   	push   %esi
+f0100716:	53                   	push   %ebx
+f0100717:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f010071a:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f0100721:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100728:	5a a5 
+	if (*cp != 0xA55A) {
+f010072a:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f0100731:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f0100736:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f010073b:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f010073f:	0f 84 cd 00 00 00    	je     f0100812 <cons_init+0x101>
+		addr_6845 = MONO_BASE;
+f0100745:	89 1d 30 42 a2 f0    	mov    %ebx,0xf0a24230
+f010074b:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100750:	89 da                	mov    %ebx,%edx
+f0100752:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f0100753:	8d 7b 01             	lea    0x1(%ebx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100756:	89 fa                	mov    %edi,%edx
+f0100758:	ec                   	in     (%dx),%al
+f0100759:	0f b6 c8             	movzbl %al,%ecx
+f010075c:	c1 e1 08             	shl    $0x8,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010075f:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100764:	89 da                	mov    %ebx,%edx
+f0100766:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100767:	89 fa                	mov    %edi,%edx
+f0100769:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f010076a:	89 35 2c 42 a2 f0    	mov    %esi,0xf0a2422c
+	pos |= inb(addr_6845 + 1);
+f0100770:	0f b6 c0             	movzbl %al,%eax
+f0100773:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f0100775:	66 a3 28 42 a2 f0    	mov    %ax,0xf0a24228
+	kbd_intr();
+f010077b:	e8 3d ff ff ff       	call   f01006bd <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_KBD));
+f0100780:	83 ec 0c             	sub    $0xc,%esp
+f0100783:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f010078a:	25 fd ff 00 00       	and    $0xfffd,%eax
+f010078f:	50                   	push   %eax
+f0100790:	e8 08 3a 00 00       	call   f010419d <irq_setmask_8259A>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100795:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010079a:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f010079f:	89 c8                	mov    %ecx,%eax
+f01007a1:	89 da                	mov    %ebx,%edx
+f01007a3:	ee                   	out    %al,(%dx)
+f01007a4:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f01007a9:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f01007ae:	89 fa                	mov    %edi,%edx
+f01007b0:	ee                   	out    %al,(%dx)
+f01007b1:	b8 0c 00 00 00       	mov    $0xc,%eax
+f01007b6:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007bb:	ee                   	out    %al,(%dx)
+f01007bc:	be f9 03 00 00       	mov    $0x3f9,%esi
+f01007c1:	89 c8                	mov    %ecx,%eax
+f01007c3:	89 f2                	mov    %esi,%edx
+f01007c5:	ee                   	out    %al,(%dx)
+f01007c6:	b8 03 00 00 00       	mov    $0x3,%eax
+f01007cb:	89 fa                	mov    %edi,%edx
+f01007cd:	ee                   	out    %al,(%dx)
+f01007ce:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f01007d3:	89 c8                	mov    %ecx,%eax
+f01007d5:	ee                   	out    %al,(%dx)
+f01007d6:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007db:	89 f2                	mov    %esi,%edx
+f01007dd:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01007de:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01007e3:	ec                   	in     (%dx),%al
+f01007e4:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f01007e6:	83 c4 10             	add    $0x10,%esp
+f01007e9:	3c ff                	cmp    $0xff,%al
+f01007eb:	0f 95 05 34 42 a2 f0 	setne  0xf0a24234
+f01007f2:	89 da                	mov    %ebx,%edx
+f01007f4:	ec                   	in     (%dx),%al
+f01007f5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007fa:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f01007fb:	80 f9 ff             	cmp    $0xff,%cl
+f01007fe:	75 28                	jne    f0100828 <cons_init+0x117>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f0100800:	83 ec 0c             	sub    $0xc,%esp
+f0100803:	68 f9 8e 10 f0       	push   $0xf0108ef9
+f0100808:	e8 70 3b 00 00       	call   f010437d <cprintf>
+f010080d:	83 c4 10             	add    $0x10,%esp
+}
+f0100810:	eb 37                	jmp    f0100849 <cons_init+0x138>
+		*cp = was;
+f0100812:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100819:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f010081e:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f0100823:	e9 1d ff ff ff       	jmp    f0100745 <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+f0100828:	83 ec 0c             	sub    $0xc,%esp
+f010082b:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f0100832:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100837:	50                   	push   %eax
+f0100838:	e8 60 39 00 00       	call   f010419d <irq_setmask_8259A>
+	if (!serial_exists)
+f010083d:	83 c4 10             	add    $0x10,%esp
+f0100840:	80 3d 34 42 a2 f0 00 	cmpb   $0x0,0xf0a24234
+f0100847:	74 b7                	je     f0100800 <cons_init+0xef>
+}
+f0100849:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010084c:	5b                   	pop    %ebx
+f010084d:	5e                   	pop    %esi
+f010084e:	5f                   	pop    %edi
+f010084f:	5d                   	pop    %ebp
+f0100850:	c3                   	ret
+
+f0100851 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f0100851:	55                   	push   %ebp
+f0100852:	89 e5                	mov    %esp,%ebp
+f0100854:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f0100857:	8b 45 08             	mov    0x8(%ebp),%eax
+f010085a:	e8 46 fc ff ff       	call   f01004a5 <cons_putc>
+}
+f010085f:	c9                   	leave
+f0100860:	c3                   	ret
+
+f0100861 <getchar>:
+
+int
+getchar(void)
+{
+f0100861:	55                   	push   %ebp
+f0100862:	89 e5                	mov    %esp,%ebp
+f0100864:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0100867:	e8 63 fe ff ff       	call   f01006cf <cons_getc>
+f010086c:	85 c0                	test   %eax,%eax
+f010086e:	74 f7                	je     f0100867 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f0100870:	c9                   	leave
+f0100871:	c3                   	ret
+
+f0100872 <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f0100872:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100877:	c3                   	ret
+
+f0100878 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0100878:	55                   	push   %ebp
+f0100879:	89 e5                	mov    %esp,%ebp
+f010087b:	56                   	push   %esi
+f010087c:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f010087d:	bb a0 94 10 f0       	mov    $0xf01094a0,%ebx
+f0100882:	be dc 94 10 f0       	mov    $0xf01094dc,%esi
+f0100887:	eb 18                	jmp    f01008a1 <mon_help+0x29>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0100889:	83 ec 04             	sub    $0x4,%esp
+f010088c:	ff 73 04             	push   0x4(%ebx)
+f010088f:	ff 33                	push   (%ebx)
+f0100891:	68 40 91 10 f0       	push   $0xf0109140
+f0100896:	e8 e2 3a 00 00       	call   f010437d <cprintf>
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f010089b:	83 c3 0c             	add    $0xc,%ebx
+f010089e:	83 c4 10             	add    $0x10,%esp
+f01008a1:	39 f3                	cmp    %esi,%ebx
+f01008a3:	75 e4                	jne    f0100889 <mon_help+0x11>
+	return 0;
+}
+f01008a5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01008ad:	5b                   	pop    %ebx
+f01008ae:	5e                   	pop    %esi
+f01008af:	5d                   	pop    %ebp
+f01008b0:	c3                   	ret
+
+f01008b1 <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f01008b1:	55                   	push   %ebp
+f01008b2:	89 e5                	mov    %esp,%ebp
+f01008b4:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f01008b7:	68 49 91 10 f0       	push   $0xf0109149
+f01008bc:	e8 bc 3a 00 00       	call   f010437d <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f01008c1:	83 c4 08             	add    $0x8,%esp
+f01008c4:	68 0c 00 10 00       	push   $0x10000c
+f01008c9:	68 7c 92 10 f0       	push   $0xf010927c
+f01008ce:	e8 aa 3a 00 00       	call   f010437d <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f01008d3:	83 c4 0c             	add    $0xc,%esp
+f01008d6:	68 0c 00 10 00       	push   $0x10000c
+f01008db:	68 0c 00 10 f0       	push   $0xf010000c
+f01008e0:	68 a4 92 10 f0       	push   $0xf01092a4
+f01008e5:	e8 93 3a 00 00       	call   f010437d <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f01008ea:	83 c4 0c             	add    $0xc,%esp
+f01008ed:	68 f4 8d 10 00       	push   $0x108df4
+f01008f2:	68 f4 8d 10 f0       	push   $0xf0108df4
+f01008f7:	68 c8 92 10 f0       	push   $0xf01092c8
+f01008fc:	e8 7c 3a 00 00       	call   f010437d <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f0100901:	83 c4 0c             	add    $0xc,%esp
+f0100904:	68 00 40 a2 00       	push   $0xa24000
+f0100909:	68 00 40 a2 f0       	push   $0xf0a24000
+f010090e:	68 ec 92 10 f0       	push   $0xf01092ec
+f0100913:	e8 65 3a 00 00       	call   f010437d <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f0100918:	83 c4 0c             	add    $0xc,%esp
+f010091b:	68 24 14 b2 00       	push   $0xb21424
+f0100920:	68 24 14 b2 f0       	push   $0xf0b21424
+f0100925:	68 10 93 10 f0       	push   $0xf0109310
+f010092a:	e8 4e 3a 00 00       	call   f010437d <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f010092f:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f0100932:	b8 24 14 b2 f0       	mov    $0xf0b21424,%eax
+f0100937:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f010093c:	c1 f8 0a             	sar    $0xa,%eax
+f010093f:	50                   	push   %eax
+f0100940:	68 34 93 10 f0       	push   $0xf0109334
+f0100945:	e8 33 3a 00 00       	call   f010437d <cprintf>
+	return 0;
+}
+f010094a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010094f:	c9                   	leave
+f0100950:	c3                   	ret
+
+f0100951 <mon_backtrace>:
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f0100951:	55                   	push   %ebp
+f0100952:	89 e5                	mov    %esp,%ebp
+f0100954:	57                   	push   %edi
+f0100955:	56                   	push   %esi
+f0100956:	53                   	push   %ebx
+f0100957:	83 ec 38             	sub    $0x38,%esp
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f010095a:	89 eb                	mov    %ebp,%ebx
+	struct Eipdebuginfo info;
+	uintptr_t eip;
+	uint32_t *ebp, *args;
+	ebp = (uint32_t *)read_ebp();
+	cprintf("Stack backtrace:\n");
+f010095c:	68 62 91 10 f0       	push   $0xf0109162
+f0100961:	e8 17 3a 00 00       	call   f010437d <cprintf>
+f0100966:	83 c4 10             	add    $0x10,%esp
+	do {
+		eip = (uintptr_t)*(ebp + 1);
+		args = ebp + 2;
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", ebp, eip, args[0], args[1], args[2], args[3], args[4]);
+		
+		if (debuginfo_eip(eip, &info) == 0) {
+f0100969:	8d 7d d0             	lea    -0x30(%ebp),%edi
+f010096c:	eb 06                	jmp    f0100974 <mon_backtrace+0x23>
+			cprintf("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip-info.eip_fn_addr);
+		}
+
+		ebp = (uint32_t *)*ebp;
+f010096e:	8b 1b                	mov    (%ebx),%ebx
+	// in entry.S, ebp initialized to 0
+	} while (ebp != 0);
+f0100970:	85 db                	test   %ebx,%ebx
+f0100972:	74 51                	je     f01009c5 <mon_backtrace+0x74>
+		eip = (uintptr_t)*(ebp + 1);
+f0100974:	8b 73 04             	mov    0x4(%ebx),%esi
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", ebp, eip, args[0], args[1], args[2], args[3], args[4]);
+f0100977:	ff 73 18             	push   0x18(%ebx)
+f010097a:	ff 73 14             	push   0x14(%ebx)
+f010097d:	ff 73 10             	push   0x10(%ebx)
+f0100980:	ff 73 0c             	push   0xc(%ebx)
+f0100983:	ff 73 08             	push   0x8(%ebx)
+f0100986:	56                   	push   %esi
+f0100987:	53                   	push   %ebx
+f0100988:	68 60 93 10 f0       	push   $0xf0109360
+f010098d:	e8 eb 39 00 00       	call   f010437d <cprintf>
+		if (debuginfo_eip(eip, &info) == 0) {
+f0100992:	83 c4 18             	add    $0x18,%esp
+f0100995:	57                   	push   %edi
+f0100996:	56                   	push   %esi
+f0100997:	e8 c3 5b 00 00       	call   f010655f <debuginfo_eip>
+f010099c:	83 c4 10             	add    $0x10,%esp
+f010099f:	85 c0                	test   %eax,%eax
+f01009a1:	75 cb                	jne    f010096e <mon_backtrace+0x1d>
+			cprintf("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip-info.eip_fn_addr);
+f01009a3:	83 ec 08             	sub    $0x8,%esp
+f01009a6:	2b 75 e0             	sub    -0x20(%ebp),%esi
+f01009a9:	56                   	push   %esi
+f01009aa:	ff 75 d8             	push   -0x28(%ebp)
+f01009ad:	ff 75 dc             	push   -0x24(%ebp)
+f01009b0:	ff 75 d4             	push   -0x2c(%ebp)
+f01009b3:	ff 75 d0             	push   -0x30(%ebp)
+f01009b6:	68 74 91 10 f0       	push   $0xf0109174
+f01009bb:	e8 bd 39 00 00       	call   f010437d <cprintf>
+f01009c0:	83 c4 20             	add    $0x20,%esp
+f01009c3:	eb a9                	jmp    f010096e <mon_backtrace+0x1d>
+	return 0;
+}
+f01009c5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01009cd:	5b                   	pop    %ebx
+f01009ce:	5e                   	pop    %esi
+f01009cf:	5f                   	pop    %edi
+f01009d0:	5d                   	pop    %ebp
+f01009d1:	c3                   	ret
+
+f01009d2 <print_memory_map>:
+}
+
+static void
+print_memory_map(pde_t* pgdir, void* addr)
+{
+	pde_t *pde = &pgdir[PDX(addr)];
+f01009d2:	89 d1                	mov    %edx,%ecx
+f01009d4:	c1 e9 16             	shr    $0x16,%ecx
+	uint32_t flag = 0;
+	if (!(*pde & PTE_P)) {
+f01009d7:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f01009da:	a8 01                	test   $0x1,%al
+f01009dc:	75 01                	jne    f01009df <print_memory_map+0xd>
+f01009de:	c3                   	ret
+{
+f01009df:	55                   	push   %ebp
+f01009e0:	89 e5                	mov    %esp,%ebp
+f01009e2:	53                   	push   %ebx
+f01009e3:	83 ec 04             	sub    $0x4,%esp
+		return;
+	}
+	pte_t* page_table = (pte_t*)KADDR(PTE_ADDR(*pde));
+f01009e6:	89 c3                	mov    %eax,%ebx
+f01009e8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (PGNUM(pa) >= npages)
+f01009ee:	89 c1                	mov    %eax,%ecx
+f01009f0:	c1 e9 0c             	shr    $0xc,%ecx
+f01009f3:	3b 0d 98 62 a4 f0    	cmp    0xf0a46298,%ecx
+f01009f9:	73 1c                	jae    f0100a17 <print_memory_map+0x45>
+	pte_t* pte = &page_table[PTX(addr)];
+f01009fb:	89 d1                	mov    %edx,%ecx
+f01009fd:	c1 e9 0c             	shr    $0xc,%ecx
+f0100a00:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	if (!(*pte & PTE_P)) {
+f0100a06:	8b 8c 8b 00 00 00 f0 	mov    -0x10000000(%ebx,%ecx,4),%ecx
+f0100a0d:	f6 c1 01             	test   $0x1,%cl
+f0100a10:	75 1a                	jne    f0100a2c <print_memory_map+0x5a>
+	}
+	if (flag & PTE_P) {
+		cprintf(" P");
+	}
+	cprintf("\n");
+}
+f0100a12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100a15:	c9                   	leave
+f0100a16:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100a17:	53                   	push   %ebx
+f0100a18:	68 24 8e 10 f0       	push   $0xf0108e24
+f0100a1d:	68 ff 00 00 00       	push   $0xff
+f0100a22:	68 8d 91 10 f0       	push   $0xf010918d
+f0100a27:	e8 14 f6 ff ff       	call   f0100040 <_panic>
+	flag = *pte & *pde;
+f0100a2c:	21 c8                	and    %ecx,%eax
+f0100a2e:	89 c3                	mov    %eax,%ebx
+	cprintf("0x%08x\t0x%08x\t", addr, PTE_ADDR(*pte));
+f0100a30:	83 ec 04             	sub    $0x4,%esp
+f0100a33:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0100a39:	51                   	push   %ecx
+f0100a3a:	52                   	push   %edx
+f0100a3b:	68 9c 91 10 f0       	push   $0xf010919c
+f0100a40:	e8 38 39 00 00       	call   f010437d <cprintf>
+	if (flag & PTE_G) {
+f0100a45:	83 c4 10             	add    $0x10,%esp
+f0100a48:	f6 c7 01             	test   $0x1,%bh
+f0100a4b:	75 51                	jne    f0100a9e <print_memory_map+0xcc>
+	if (flag & PTE_PS) {
+f0100a4d:	f6 c3 80             	test   $0x80,%bl
+f0100a50:	75 5e                	jne    f0100ab0 <print_memory_map+0xde>
+	if (flag & PTE_D) {
+f0100a52:	f6 c3 40             	test   $0x40,%bl
+f0100a55:	75 6b                	jne    f0100ac2 <print_memory_map+0xf0>
+	if (flag & PTE_A) {
+f0100a57:	f6 c3 20             	test   $0x20,%bl
+f0100a5a:	75 78                	jne    f0100ad4 <print_memory_map+0x102>
+	if (flag & PTE_PCD) {
+f0100a5c:	f6 c3 10             	test   $0x10,%bl
+f0100a5f:	0f 85 84 00 00 00    	jne    f0100ae9 <print_memory_map+0x117>
+	if (flag & PTE_PWT) {
+f0100a65:	f6 c3 08             	test   $0x8,%bl
+f0100a68:	0f 85 90 00 00 00    	jne    f0100afe <print_memory_map+0x12c>
+	if (flag & PTE_U) {
+f0100a6e:	f6 c3 04             	test   $0x4,%bl
+f0100a71:	0f 85 9c 00 00 00    	jne    f0100b13 <print_memory_map+0x141>
+	if (flag & PTE_W) {
+f0100a77:	f6 c3 02             	test   $0x2,%bl
+f0100a7a:	0f 85 a8 00 00 00    	jne    f0100b28 <print_memory_map+0x156>
+	if (flag & PTE_P) {
+f0100a80:	f6 c3 01             	test   $0x1,%bl
+f0100a83:	0f 85 b4 00 00 00    	jne    f0100b3d <print_memory_map+0x16b>
+	cprintf("\n");
+f0100a89:	83 ec 0c             	sub    $0xc,%esp
+f0100a8c:	68 12 a2 10 f0       	push   $0xf010a212
+f0100a91:	e8 e7 38 00 00       	call   f010437d <cprintf>
+f0100a96:	83 c4 10             	add    $0x10,%esp
+f0100a99:	e9 74 ff ff ff       	jmp    f0100a12 <print_memory_map+0x40>
+		cprintf(" G");
+f0100a9e:	83 ec 0c             	sub    $0xc,%esp
+f0100aa1:	68 ab 91 10 f0       	push   $0xf01091ab
+f0100aa6:	e8 d2 38 00 00       	call   f010437d <cprintf>
+f0100aab:	83 c4 10             	add    $0x10,%esp
+f0100aae:	eb 9d                	jmp    f0100a4d <print_memory_map+0x7b>
+		cprintf(" PS");
+f0100ab0:	83 ec 0c             	sub    $0xc,%esp
+f0100ab3:	68 ae 91 10 f0       	push   $0xf01091ae
+f0100ab8:	e8 c0 38 00 00       	call   f010437d <cprintf>
+f0100abd:	83 c4 10             	add    $0x10,%esp
+f0100ac0:	eb 90                	jmp    f0100a52 <print_memory_map+0x80>
+		cprintf(" D");
+f0100ac2:	83 ec 0c             	sub    $0xc,%esp
+f0100ac5:	68 b2 91 10 f0       	push   $0xf01091b2
+f0100aca:	e8 ae 38 00 00       	call   f010437d <cprintf>
+f0100acf:	83 c4 10             	add    $0x10,%esp
+f0100ad2:	eb 83                	jmp    f0100a57 <print_memory_map+0x85>
+		cprintf(" A");
+f0100ad4:	83 ec 0c             	sub    $0xc,%esp
+f0100ad7:	68 b5 91 10 f0       	push   $0xf01091b5
+f0100adc:	e8 9c 38 00 00       	call   f010437d <cprintf>
+f0100ae1:	83 c4 10             	add    $0x10,%esp
+f0100ae4:	e9 73 ff ff ff       	jmp    f0100a5c <print_memory_map+0x8a>
+		cprintf(" PCD");
+f0100ae9:	83 ec 0c             	sub    $0xc,%esp
+f0100aec:	68 b8 91 10 f0       	push   $0xf01091b8
+f0100af1:	e8 87 38 00 00       	call   f010437d <cprintf>
+f0100af6:	83 c4 10             	add    $0x10,%esp
+f0100af9:	e9 67 ff ff ff       	jmp    f0100a65 <print_memory_map+0x93>
+		cprintf(" PWT");
+f0100afe:	83 ec 0c             	sub    $0xc,%esp
+f0100b01:	68 bd 91 10 f0       	push   $0xf01091bd
+f0100b06:	e8 72 38 00 00       	call   f010437d <cprintf>
+f0100b0b:	83 c4 10             	add    $0x10,%esp
+f0100b0e:	e9 5b ff ff ff       	jmp    f0100a6e <print_memory_map+0x9c>
+		cprintf(" U");
+f0100b13:	83 ec 0c             	sub    $0xc,%esp
+f0100b16:	68 c2 91 10 f0       	push   $0xf01091c2
+f0100b1b:	e8 5d 38 00 00       	call   f010437d <cprintf>
+f0100b20:	83 c4 10             	add    $0x10,%esp
+f0100b23:	e9 4f ff ff ff       	jmp    f0100a77 <print_memory_map+0xa5>
+		cprintf(" W");
+f0100b28:	83 ec 0c             	sub    $0xc,%esp
+f0100b2b:	68 c5 91 10 f0       	push   $0xf01091c5
+f0100b30:	e8 48 38 00 00       	call   f010437d <cprintf>
+f0100b35:	83 c4 10             	add    $0x10,%esp
+f0100b38:	e9 43 ff ff ff       	jmp    f0100a80 <print_memory_map+0xae>
+		cprintf(" P");
+f0100b3d:	83 ec 0c             	sub    $0xc,%esp
+f0100b40:	68 c8 91 10 f0       	push   $0xf01091c8
+f0100b45:	e8 33 38 00 00       	call   f010437d <cprintf>
+f0100b4a:	83 c4 10             	add    $0x10,%esp
+f0100b4d:	e9 37 ff ff ff       	jmp    f0100a89 <print_memory_map+0xb7>
+
+f0100b52 <mon_show_mappings>:
+{
+f0100b52:	55                   	push   %ebp
+f0100b53:	89 e5                	mov    %esp,%ebp
+f0100b55:	57                   	push   %edi
+f0100b56:	56                   	push   %esi
+f0100b57:	53                   	push   %ebx
+f0100b58:	83 ec 1c             	sub    $0x1c,%esp
+f0100b5b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (argc < 2 || argc > 3) {
+f0100b5e:	8d 46 fe             	lea    -0x2(%esi),%eax
+f0100b61:	83 f8 01             	cmp    $0x1,%eax
+f0100b64:	77 5c                	ja     f0100bc2 <mon_show_mappings+0x70>
+	start_addr = (void*)ROUNDDOWN(atoi(argv[1]), PGSIZE);
+f0100b66:	83 ec 0c             	sub    $0xc,%esp
+f0100b69:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100b6c:	ff 70 04             	push   0x4(%eax)
+f0100b6f:	e8 b0 66 00 00       	call   f0107224 <atoi>
+f0100b74:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100b79:	89 c3                	mov    %eax,%ebx
+	if (argc == 3) {
+f0100b7b:	83 c4 10             	add    $0x10,%esp
+		end_addr = start_addr;
+f0100b7e:	89 c7                	mov    %eax,%edi
+	if (argc == 3) {
+f0100b80:	83 fe 03             	cmp    $0x3,%esi
+f0100b83:	74 5a                	je     f0100bdf <mon_show_mappings+0x8d>
+	size_t count = ((size_t)(end_addr - start_addr) >> PGSHIFT) + 1;
+f0100b85:	29 df                	sub    %ebx,%edi
+f0100b87:	c1 ef 0c             	shr    $0xc,%edi
+	asm volatile("movl %%cr3,%0" : "=r" (val));
+f0100b8a:	0f 20 d8             	mov    %cr3,%eax
+	if (PGNUM(pa) >= npages)
+f0100b8d:	89 c2                	mov    %eax,%edx
+f0100b8f:	c1 ea 0c             	shr    $0xc,%edx
+f0100b92:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f0100b98:	73 63                	jae    f0100bfd <mon_show_mappings+0xab>
+	return (void *)(pa + KERNBASE);
+f0100b9a:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100b9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (size_t i = 0; i < count; ++i, start_addr += PGSIZE) {
+f0100ba2:	be 00 00 00 00       	mov    $0x0,%esi
+		print_memory_map(pgdir, start_addr);
+f0100ba7:	89 da                	mov    %ebx,%edx
+f0100ba9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100bac:	e8 21 fe ff ff       	call   f01009d2 <print_memory_map>
+	for (size_t i = 0; i < count; ++i, start_addr += PGSIZE) {
+f0100bb1:	89 f0                	mov    %esi,%eax
+f0100bb3:	83 c6 01             	add    $0x1,%esi
+f0100bb6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0100bbc:	39 c7                	cmp    %eax,%edi
+f0100bbe:	75 e7                	jne    f0100ba7 <mon_show_mappings+0x55>
+f0100bc0:	eb 10                	jmp    f0100bd2 <mon_show_mappings+0x80>
+		cprintf("format error, please givin one or two address");
+f0100bc2:	83 ec 0c             	sub    $0xc,%esp
+f0100bc5:	68 98 93 10 f0       	push   $0xf0109398
+f0100bca:	e8 ae 37 00 00       	call   f010437d <cprintf>
+		return 0;
+f0100bcf:	83 c4 10             	add    $0x10,%esp
+}
+f0100bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100bd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100bda:	5b                   	pop    %ebx
+f0100bdb:	5e                   	pop    %esi
+f0100bdc:	5f                   	pop    %edi
+f0100bdd:	5d                   	pop    %ebp
+f0100bde:	c3                   	ret
+		end_addr = (void*)ROUNDDOWN(atoi(argv[2]), PGSIZE);
+f0100bdf:	83 ec 0c             	sub    $0xc,%esp
+f0100be2:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100be5:	ff 70 08             	push   0x8(%eax)
+f0100be8:	e8 37 66 00 00       	call   f0107224 <atoi>
+f0100bed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100bf2:	89 c7                	mov    %eax,%edi
+	if (end_addr < start_addr) {
+f0100bf4:	83 c4 10             	add    $0x10,%esp
+f0100bf7:	39 d8                	cmp    %ebx,%eax
+f0100bf9:	72 d7                	jb     f0100bd2 <mon_show_mappings+0x80>
+f0100bfb:	eb 88                	jmp    f0100b85 <mon_show_mappings+0x33>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100bfd:	50                   	push   %eax
+f0100bfe:	68 24 8e 10 f0       	push   $0xf0108e24
+f0100c03:	6a 6e                	push   $0x6e
+f0100c05:	68 8d 91 10 f0       	push   $0xf010918d
+f0100c0a:	e8 31 f4 ff ff       	call   f0100040 <_panic>
+
+f0100c0f <mon_change_page_perm>:
+{
+f0100c0f:	55                   	push   %ebp
+f0100c10:	89 e5                	mov    %esp,%ebp
+f0100c12:	57                   	push   %edi
+f0100c13:	56                   	push   %esi
+f0100c14:	53                   	push   %ebx
+f0100c15:	83 ec 1c             	sub    $0x1c,%esp
+f0100c18:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (argc < 2) {
+f0100c1b:	83 ff 01             	cmp    $0x1,%edi
+f0100c1e:	0f 8e 0c 02 00 00    	jle    f0100e30 <mon_change_page_perm+0x221>
+	if (strcmp(argv[idx], "--set") == 0) {
+f0100c24:	83 ec 08             	sub    $0x8,%esp
+f0100c27:	68 cb 91 10 f0       	push   $0xf01091cb
+f0100c2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100c2f:	ff 70 04             	push   0x4(%eax)
+f0100c32:	e8 6e 63 00 00       	call   f0106fa5 <strcmp>
+f0100c37:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0100c3a:	83 c4 10             	add    $0x10,%esp
+f0100c3d:	85 c0                	test   %eax,%eax
+f0100c3f:	75 20                	jne    f0100c61 <mon_change_page_perm+0x52>
+	if (idx == argc) {
+f0100c41:	83 ff 02             	cmp    $0x2,%edi
+f0100c44:	0f 84 e6 01 00 00    	je     f0100e30 <mon_change_page_perm+0x221>
+	++idx;
+f0100c4a:	b8 02 00 00 00       	mov    $0x2,%eax
+f0100c4f:	be 01 00 00 00       	mov    $0x1,%esi
+	for (const char* p = argv[idx]; *p; ++p) {
+f0100c54:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0100c57:	8b 14 83             	mov    (%ebx,%eax,4),%edx
+	uint32_t bits = 0;
+f0100c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (const char* p = argv[idx]; *p; ++p) {
+f0100c5f:	eb 5e                	jmp    f0100cbf <mon_change_page_perm+0xb0>
+	} else if (strcmp(argv[idx], "--add") == 0) {
+f0100c61:	83 ec 08             	sub    $0x8,%esp
+f0100c64:	68 d1 91 10 f0       	push   $0xf01091d1
+f0100c69:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100c6c:	ff 70 04             	push   0x4(%eax)
+f0100c6f:	e8 31 63 00 00       	call   f0106fa5 <strcmp>
+f0100c74:	83 c4 10             	add    $0x10,%esp
+		opt = ADD_PERM;
+f0100c77:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+	} else if (strcmp(argv[idx], "--add") == 0) {
+f0100c7e:	85 c0                	test   %eax,%eax
+f0100c80:	74 bf                	je     f0100c41 <mon_change_page_perm+0x32>
+	} else if (strcmp(argv[idx], "--remove") == 0) {
+f0100c82:	83 ec 08             	sub    $0x8,%esp
+f0100c85:	68 d7 91 10 f0       	push   $0xf01091d7
+f0100c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100c8d:	ff 70 04             	push   0x4(%eax)
+f0100c90:	e8 10 63 00 00       	call   f0106fa5 <strcmp>
+f0100c95:	83 c4 10             	add    $0x10,%esp
+f0100c98:	85 c0                	test   %eax,%eax
+f0100c9a:	75 09                	jne    f0100ca5 <mon_change_page_perm+0x96>
+		opt = REMOVE_PERM;
+f0100c9c:	c7 45 dc 02 00 00 00 	movl   $0x2,-0x24(%ebp)
+f0100ca3:	eb 9c                	jmp    f0100c41 <mon_change_page_perm+0x32>
+	++idx;
+f0100ca5:	b8 01 00 00 00       	mov    $0x1,%eax
+		idx--;
+f0100caa:	be 00 00 00 00       	mov    $0x0,%esi
+		opt = SET_PERM;
+f0100caf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f0100cb6:	eb 9c                	jmp    f0100c54 <mon_change_page_perm+0x45>
+		switch (*p) {
+f0100cb8:	3c 77                	cmp    $0x77,%al
+f0100cba:	74 18                	je     f0100cd4 <mon_change_page_perm+0xc5>
+	for (const char* p = argv[idx]; *p; ++p) {
+f0100cbc:	83 c2 01             	add    $0x1,%edx
+f0100cbf:	0f b6 02             	movzbl (%edx),%eax
+f0100cc2:	84 c0                	test   %al,%al
+f0100cc4:	74 18                	je     f0100cde <mon_change_page_perm+0xcf>
+		switch (*p) {
+f0100cc6:	3c 75                	cmp    $0x75,%al
+f0100cc8:	74 0f                	je     f0100cd9 <mon_change_page_perm+0xca>
+f0100cca:	7f ec                	jg     f0100cb8 <mon_change_page_perm+0xa9>
+f0100ccc:	3c 55                	cmp    $0x55,%al
+f0100cce:	74 09                	je     f0100cd9 <mon_change_page_perm+0xca>
+f0100cd0:	3c 57                	cmp    $0x57,%al
+f0100cd2:	75 e8                	jne    f0100cbc <mon_change_page_perm+0xad>
+			bits |= PTE_W;
+f0100cd4:	83 c9 02             	or     $0x2,%ecx
+			break;
+f0100cd7:	eb e3                	jmp    f0100cbc <mon_change_page_perm+0xad>
+			bits |= PTE_U;
+f0100cd9:	83 c9 04             	or     $0x4,%ecx
+			break;
+f0100cdc:	eb de                	jmp    f0100cbc <mon_change_page_perm+0xad>
+	idx++;
+f0100cde:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0100ce1:	8d 46 02             	lea    0x2(%esi),%eax
+	if (idx == argc) {
+f0100ce4:	39 c7                	cmp    %eax,%edi
+f0100ce6:	0f 84 44 01 00 00    	je     f0100e30 <mon_change_page_perm+0x221>
+	start_addr = (void*)ROUNDDOWN(atoi(argv[idx++]), PGSIZE);
+f0100cec:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+f0100cf3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0100cf6:	83 ec 0c             	sub    $0xc,%esp
+f0100cf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0100cfc:	ff 34 83             	push   (%ebx,%eax,4)
+f0100cff:	e8 20 65 00 00       	call   f0107224 <atoi>
+f0100d04:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100d09:	89 c3                	mov    %eax,%ebx
+f0100d0b:	8d 56 03             	lea    0x3(%esi),%edx
+	if (idx < argc) {
+f0100d0e:	83 c4 10             	add    $0x10,%esp
+f0100d11:	39 d7                	cmp    %edx,%edi
+f0100d13:	7f 28                	jg     f0100d3d <mon_change_page_perm+0x12e>
+f0100d15:	0f 20 df             	mov    %cr3,%edi
+	if (PGNUM(pa) >= npages)
+f0100d18:	89 fa                	mov    %edi,%edx
+f0100d1a:	c1 ea 0c             	shr    $0xc,%edx
+f0100d1d:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f0100d23:	73 34                	jae    f0100d59 <mon_change_page_perm+0x14a>
+	return (void *)(pa + KERNBASE);
+f0100d25:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+	size_t count = ((end_addr - start_addr) >> PGSHIFT) + 1;
+f0100d2b:	29 d8                	sub    %ebx,%eax
+f0100d2d:	c1 f8 0c             	sar    $0xc,%eax
+f0100d30:	83 c0 01             	add    $0x1,%eax
+f0100d33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (size_t i = 0; i < count; ++i, start_addr += PGSIZE) {
+f0100d36:	be 00 00 00 00       	mov    $0x0,%esi
+f0100d3b:	eb 6e                	jmp    f0100dab <mon_change_page_perm+0x19c>
+		end_addr = (void*)ROUNDDOWN(atoi(argv[idx]), PGSIZE);
+f0100d3d:	83 ec 0c             	sub    $0xc,%esp
+f0100d40:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100d43:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0100d46:	ff 74 30 04          	push   0x4(%eax,%esi,1)
+f0100d4a:	e8 d5 64 00 00       	call   f0107224 <atoi>
+f0100d4f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100d54:	83 c4 10             	add    $0x10,%esp
+f0100d57:	eb bc                	jmp    f0100d15 <mon_change_page_perm+0x106>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100d59:	57                   	push   %edi
+f0100d5a:	68 24 8e 10 f0       	push   $0xf0108e24
+f0100d5f:	68 ad 00 00 00       	push   $0xad
+f0100d64:	68 8d 91 10 f0       	push   $0xf010918d
+f0100d69:	e8 d2 f2 ff ff       	call   f0100040 <_panic>
+f0100d6e:	51                   	push   %ecx
+f0100d6f:	68 24 8e 10 f0       	push   $0xf0108e24
+f0100d74:	68 2b 01 00 00       	push   $0x12b
+f0100d79:	68 8d 91 10 f0       	push   $0xf010918d
+f0100d7e:	e8 bd f2 ff ff       	call   f0100040 <_panic>
+		*pte &= ~((pte_t)(bit));
+	log("pde: %x ,  pte: %x , opt: %d, bits: %x", *pde, *pte, opt, bits);
+
+	switch (opt) {
+	case SET_PERM:
+		PTE_SET_PERM(pte, PTE_W);
+f0100d83:	8b 10                	mov    (%eax),%edx
+f0100d85:	83 e2 fd             	and    $0xfffffffd,%edx
+		PTE_SET_PERM(pte, PTE_U);
+f0100d88:	89 d1                	mov    %edx,%ecx
+f0100d8a:	83 e1 fb             	and    $0xfffffffb,%ecx
+f0100d8d:	83 ca 04             	or     $0x4,%edx
+f0100d90:	f6 45 e0 04          	testb  $0x4,-0x20(%ebp)
+f0100d94:	0f 44 d1             	cmove  %ecx,%edx
+f0100d97:	89 10                	mov    %edx,(%eax)
+		print_memory_map(pgdir, start_addr);
+f0100d99:	89 da                	mov    %ebx,%edx
+f0100d9b:	89 f8                	mov    %edi,%eax
+f0100d9d:	e8 30 fc ff ff       	call   f01009d2 <print_memory_map>
+	for (size_t i = 0; i < count; ++i, start_addr += PGSIZE) {
+f0100da2:	83 c6 01             	add    $0x1,%esi
+f0100da5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0100dab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100dae:	39 c6                	cmp    %eax,%esi
+f0100db0:	74 7e                	je     f0100e30 <mon_change_page_perm+0x221>
+	pde_t *pde = &pgdir[PDX(addr)];
+f0100db2:	89 da                	mov    %ebx,%edx
+f0100db4:	89 d8                	mov    %ebx,%eax
+f0100db6:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*pde & PTE_P)) {
+f0100db9:	8b 04 87             	mov    (%edi,%eax,4),%eax
+f0100dbc:	a8 01                	test   $0x1,%al
+f0100dbe:	74 d9                	je     f0100d99 <mon_change_page_perm+0x18a>
+	pte_t *page_table = (pte_t*)KADDR(PTE_ADDR(*pde));
+f0100dc0:	89 c1                	mov    %eax,%ecx
+f0100dc2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0100dc8:	c1 e8 0c             	shr    $0xc,%eax
+f0100dcb:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0100dd1:	73 9b                	jae    f0100d6e <mon_change_page_perm+0x15f>
+	pte_t *pte = &page_table[PTX(addr)];
+f0100dd3:	c1 ea 0a             	shr    $0xa,%edx
+f0100dd6:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+f0100ddc:	8d 84 11 00 00 00 f0 	lea    -0x10000000(%ecx,%edx,1),%eax
+	switch (opt) {
+f0100de3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0100de6:	83 f9 01             	cmp    $0x1,%ecx
+f0100de9:	74 16                	je     f0100e01 <mon_change_page_perm+0x1f2>
+f0100deb:	83 f9 02             	cmp    $0x2,%ecx
+f0100dee:	74 25                	je     f0100e15 <mon_change_page_perm+0x206>
+f0100df0:	85 c9                	test   %ecx,%ecx
+f0100df2:	75 a5                	jne    f0100d99 <mon_change_page_perm+0x18a>
+		PTE_SET_PERM(pte, PTE_W);
+f0100df4:	f6 45 e0 02          	testb  $0x2,-0x20(%ebp)
+f0100df8:	74 89                	je     f0100d83 <mon_change_page_perm+0x174>
+f0100dfa:	8b 10                	mov    (%eax),%edx
+f0100dfc:	83 ca 02             	or     $0x2,%edx
+f0100dff:	eb 87                	jmp    f0100d88 <mon_change_page_perm+0x179>
+		break;
+	case ADD_PERM:
+		PTE_ADD_PERM(pte, PTE_W);
+f0100e01:	f6 45 e0 02          	testb  $0x2,-0x20(%ebp)
+f0100e05:	74 03                	je     f0100e0a <mon_change_page_perm+0x1fb>
+f0100e07:	83 08 02             	orl    $0x2,(%eax)
+		PTE_ADD_PERM(pte, PTE_U);
+f0100e0a:	f6 45 e0 04          	testb  $0x4,-0x20(%ebp)
+f0100e0e:	74 89                	je     f0100d99 <mon_change_page_perm+0x18a>
+f0100e10:	83 08 04             	orl    $0x4,(%eax)
+f0100e13:	eb 84                	jmp    f0100d99 <mon_change_page_perm+0x18a>
+		break;
+	case REMOVE_PERM:
+		PTE_REMOVE_PERM(pte, PTE_W);
+f0100e15:	f6 45 e0 02          	testb  $0x2,-0x20(%ebp)
+f0100e19:	74 03                	je     f0100e1e <mon_change_page_perm+0x20f>
+f0100e1b:	83 20 fd             	andl   $0xfffffffd,(%eax)
+		PTE_REMOVE_PERM(pte, PTE_U);
+f0100e1e:	f6 45 e0 04          	testb  $0x4,-0x20(%ebp)
+f0100e22:	0f 84 71 ff ff ff    	je     f0100d99 <mon_change_page_perm+0x18a>
+f0100e28:	83 20 fb             	andl   $0xfffffffb,(%eax)
+f0100e2b:	e9 69 ff ff ff       	jmp    f0100d99 <mon_change_page_perm+0x18a>
+}
+f0100e30:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100e38:	5b                   	pop    %ebx
+f0100e39:	5e                   	pop    %esi
+f0100e3a:	5f                   	pop    %edi
+f0100e3b:	5d                   	pop    %ebp
+f0100e3c:	c3                   	ret
+
+f0100e3d <monitor>:
+{
+f0100e3d:	55                   	push   %ebp
+f0100e3e:	89 e5                	mov    %esp,%ebp
+f0100e40:	57                   	push   %edi
+f0100e41:	56                   	push   %esi
+f0100e42:	53                   	push   %ebx
+f0100e43:	83 ec 58             	sub    $0x58,%esp
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0100e46:	68 c8 93 10 f0       	push   $0xf01093c8
+f0100e4b:	e8 2d 35 00 00       	call   f010437d <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0100e50:	c7 04 24 ec 93 10 f0 	movl   $0xf01093ec,(%esp)
+f0100e57:	e8 21 35 00 00       	call   f010437d <cprintf>
+	if (tf != NULL)
+f0100e5c:	83 c4 10             	add    $0x10,%esp
+f0100e5f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100e63:	74 57                	je     f0100ebc <monitor+0x7f>
+		print_trapframe(tf);
+f0100e65:	83 ec 0c             	sub    $0xc,%esp
+f0100e68:	ff 75 08             	push   0x8(%ebp)
+f0100e6b:	e8 7e 3b 00 00       	call   f01049ee <print_trapframe>
+f0100e70:	83 c4 10             	add    $0x10,%esp
+f0100e73:	eb 47                	jmp    f0100ebc <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100e75:	83 ec 08             	sub    $0x8,%esp
+f0100e78:	0f be c0             	movsbl %al,%eax
+f0100e7b:	50                   	push   %eax
+f0100e7c:	68 e4 91 10 f0       	push   $0xf01091e4
+f0100e81:	e8 80 61 00 00       	call   f0107006 <strchr>
+f0100e86:	83 c4 10             	add    $0x10,%esp
+f0100e89:	85 c0                	test   %eax,%eax
+f0100e8b:	74 0a                	je     f0100e97 <monitor+0x5a>
+			*buf++ = 0;
+f0100e8d:	c6 03 00             	movb   $0x0,(%ebx)
+f0100e90:	89 f7                	mov    %esi,%edi
+f0100e92:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100e95:	eb 6b                	jmp    f0100f02 <monitor+0xc5>
+		if (*buf == 0)
+f0100e97:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100e9a:	74 73                	je     f0100f0f <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f0100e9c:	83 fe 0f             	cmp    $0xf,%esi
+f0100e9f:	74 09                	je     f0100eaa <monitor+0x6d>
+		argv[argc++] = buf;
+f0100ea1:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100ea4:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100ea8:	eb 39                	jmp    f0100ee3 <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0100eaa:	83 ec 08             	sub    $0x8,%esp
+f0100ead:	6a 10                	push   $0x10
+f0100eaf:	68 e9 91 10 f0       	push   $0xf01091e9
+f0100eb4:	e8 c4 34 00 00       	call   f010437d <cprintf>
+			return 0;
+f0100eb9:	83 c4 10             	add    $0x10,%esp
+		buf = readline("K> ");
+f0100ebc:	83 ec 0c             	sub    $0xc,%esp
+f0100ebf:	68 e0 91 10 f0       	push   $0xf01091e0
+f0100ec4:	e8 02 5f 00 00       	call   f0106dcb <readline>
+f0100ec9:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f0100ecb:	83 c4 10             	add    $0x10,%esp
+f0100ece:	85 c0                	test   %eax,%eax
+f0100ed0:	74 ea                	je     f0100ebc <monitor+0x7f>
+	argv[argc] = 0;
+f0100ed2:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0100ed9:	be 00 00 00 00       	mov    $0x0,%esi
+f0100ede:	eb 24                	jmp    f0100f04 <monitor+0xc7>
+			buf++;
+f0100ee0:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100ee3:	0f b6 03             	movzbl (%ebx),%eax
+f0100ee6:	84 c0                	test   %al,%al
+f0100ee8:	74 18                	je     f0100f02 <monitor+0xc5>
+f0100eea:	83 ec 08             	sub    $0x8,%esp
+f0100eed:	0f be c0             	movsbl %al,%eax
+f0100ef0:	50                   	push   %eax
+f0100ef1:	68 e4 91 10 f0       	push   $0xf01091e4
+f0100ef6:	e8 0b 61 00 00       	call   f0107006 <strchr>
+f0100efb:	83 c4 10             	add    $0x10,%esp
+f0100efe:	85 c0                	test   %eax,%eax
+f0100f00:	74 de                	je     f0100ee0 <monitor+0xa3>
+			*buf++ = 0;
+f0100f02:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100f04:	0f b6 03             	movzbl (%ebx),%eax
+f0100f07:	84 c0                	test   %al,%al
+f0100f09:	0f 85 66 ff ff ff    	jne    f0100e75 <monitor+0x38>
+	argv[argc] = 0;
+f0100f0f:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100f16:	00 
+	if (argc == 0)
+f0100f17:	85 f6                	test   %esi,%esi
+f0100f19:	74 a1                	je     f0100ebc <monitor+0x7f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0100f20:	83 ec 08             	sub    $0x8,%esp
+f0100f23:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100f26:	ff 34 85 a0 94 10 f0 	push   -0xfef6b60(,%eax,4)
+f0100f2d:	ff 75 a8             	push   -0x58(%ebp)
+f0100f30:	e8 70 60 00 00       	call   f0106fa5 <strcmp>
+f0100f35:	83 c4 10             	add    $0x10,%esp
+f0100f38:	85 c0                	test   %eax,%eax
+f0100f3a:	74 20                	je     f0100f5c <monitor+0x11f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100f3c:	83 c3 01             	add    $0x1,%ebx
+f0100f3f:	83 fb 05             	cmp    $0x5,%ebx
+f0100f42:	75 dc                	jne    f0100f20 <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0100f44:	83 ec 08             	sub    $0x8,%esp
+f0100f47:	ff 75 a8             	push   -0x58(%ebp)
+f0100f4a:	68 06 92 10 f0       	push   $0xf0109206
+f0100f4f:	e8 29 34 00 00       	call   f010437d <cprintf>
+	return 0;
+f0100f54:	83 c4 10             	add    $0x10,%esp
+f0100f57:	e9 60 ff ff ff       	jmp    f0100ebc <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f0100f5c:	83 ec 04             	sub    $0x4,%esp
+f0100f5f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100f62:	ff 75 08             	push   0x8(%ebp)
+f0100f65:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0100f68:	52                   	push   %edx
+f0100f69:	56                   	push   %esi
+f0100f6a:	ff 14 85 a8 94 10 f0 	call   *-0xfef6b58(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0100f71:	83 c4 10             	add    $0x10,%esp
+f0100f74:	85 c0                	test   %eax,%eax
+f0100f76:	0f 89 40 ff ff ff    	jns    f0100ebc <monitor+0x7f>
+}
+f0100f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100f7f:	5b                   	pop    %ebx
+f0100f80:	5e                   	pop    %esi
+f0100f81:	5f                   	pop    %edi
+f0100f82:	5d                   	pop    %ebp
+f0100f83:	c3                   	ret
+
+f0100f84 <boot_alloc>:
+	// Initialize nextfree if this is the first time.
+	// 'end' is a magic symbol automatically generated by the linker,
+	// which points to the end of the kernel's bss segment:
+	// the first virtual address that the linker did *not* assign
+	// to any kernel code or global variables.
+	if (!nextfree) {
+f0100f84:	83 3d 38 42 a2 f0 00 	cmpl   $0x0,0xf0a24238
+f0100f8b:	74 2f                	je     f0100fbc <boot_alloc+0x38>
+
+	// Allocate a chunk large enough to hold 'n' bytes, then update
+	// nextfree.  Make sure nextfree is kept aligned
+	// to a multiple of PGSIZE.
+	if (n == 0) {
+		return nextfree;
+f0100f8d:	8b 15 38 42 a2 f0    	mov    0xf0a24238,%edx
+	if (n == 0) {
+f0100f93:	85 c0                	test   %eax,%eax
+f0100f95:	74 22                	je     f0100fb9 <boot_alloc+0x35>
+	}
+
+	// The entry.S page directory maps the first 4MB of physical memory
+	// starting at virtual address KERNBASE (that is, it maps virtual
+	// addresses [KERNBASE, KERNBASE+4MB) to physical addresses [0, 4MB)).
+	result = nextfree;
+f0100f97:	8b 15 38 42 a2 f0    	mov    0xf0a24238,%edx
+	if ((uintptr_t)nextfree + n > KERNBASE + PTSIZE) {
+f0100f9d:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+f0100fa0:	81 f9 00 00 40 f0    	cmp    $0xf0400000,%ecx
+f0100fa6:	77 27                	ja     f0100fcf <boot_alloc+0x4b>
+		panic("boot_alloc out of memory, n: %x\tnextfree: %x\n", n, nextfree);
+	}
+	nextfree += ROUNDUP(n, PGSIZE);
+f0100fa8:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0100fad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100fb2:	01 d0                	add    %edx,%eax
+f0100fb4:	a3 38 42 a2 f0       	mov    %eax,0xf0a24238
+	log("alloc %d bytes, result is %p", n, result);
+	return result;
+}
+f0100fb9:	89 d0                	mov    %edx,%eax
+f0100fbb:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f0100fbc:	ba 23 24 b2 f0       	mov    $0xf0b22423,%edx
+f0100fc1:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100fc7:	89 15 38 42 a2 f0    	mov    %edx,0xf0a24238
+f0100fcd:	eb be                	jmp    f0100f8d <boot_alloc+0x9>
+{
+f0100fcf:	55                   	push   %ebp
+f0100fd0:	89 e5                	mov    %esp,%ebp
+f0100fd2:	83 ec 14             	sub    $0x14,%esp
+		panic("boot_alloc out of memory, n: %x\tnextfree: %x\n", n, nextfree);
+f0100fd5:	52                   	push   %edx
+f0100fd6:	50                   	push   %eax
+f0100fd7:	68 dc 94 10 f0       	push   $0xf01094dc
+f0100fdc:	6a 7e                	push   $0x7e
+f0100fde:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0100fe3:	e8 58 f0 ff ff       	call   f0100040 <_panic>
+
+f0100fe8 <nvram_read>:
+{
+f0100fe8:	55                   	push   %ebp
+f0100fe9:	89 e5                	mov    %esp,%ebp
+f0100feb:	56                   	push   %esi
+f0100fec:	53                   	push   %ebx
+f0100fed:	89 c3                	mov    %eax,%ebx
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0100fef:	83 ec 0c             	sub    $0xc,%esp
+f0100ff2:	50                   	push   %eax
+f0100ff3:	e8 77 31 00 00       	call   f010416f <mc146818_read>
+f0100ff8:	89 c6                	mov    %eax,%esi
+f0100ffa:	83 c3 01             	add    $0x1,%ebx
+f0100ffd:	89 1c 24             	mov    %ebx,(%esp)
+f0101000:	e8 6a 31 00 00       	call   f010416f <mc146818_read>
+f0101005:	c1 e0 08             	shl    $0x8,%eax
+f0101008:	09 f0                	or     %esi,%eax
+}
+f010100a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010100d:	5b                   	pop    %ebx
+f010100e:	5e                   	pop    %esi
+f010100f:	5d                   	pop    %ebp
+f0101010:	c3                   	ret
+
+f0101011 <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+	pte_t *p;
+
+	pgdir = &pgdir[PDX(va)];
+f0101011:	89 d1                	mov    %edx,%ecx
+f0101013:	c1 e9 16             	shr    $0x16,%ecx
+	if (!(*pgdir & PTE_P))
+f0101016:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0101019:	a8 01                	test   $0x1,%al
+f010101b:	74 51                	je     f010106e <check_va2pa+0x5d>
+		return ~0;
+	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
+f010101d:	89 c1                	mov    %eax,%ecx
+f010101f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0101025:	c1 e8 0c             	shr    $0xc,%eax
+f0101028:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f010102e:	73 23                	jae    f0101053 <check_va2pa+0x42>
+	if (!(p[PTX(va)] & PTE_P))
+f0101030:	c1 ea 0c             	shr    $0xc,%edx
+f0101033:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0101039:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+		return ~0;
+	return PTE_ADDR(p[PTX(va)]);
+f0101040:	89 d0                	mov    %edx,%eax
+f0101042:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101047:	f6 c2 01             	test   $0x1,%dl
+f010104a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f010104f:	0f 44 c2             	cmove  %edx,%eax
+f0101052:	c3                   	ret
+{
+f0101053:	55                   	push   %ebp
+f0101054:	89 e5                	mov    %esp,%ebp
+f0101056:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101059:	51                   	push   %ecx
+f010105a:	68 24 8e 10 f0       	push   $0xf0108e24
+f010105f:	68 11 04 00 00       	push   $0x411
+f0101064:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101069:	e8 d2 ef ff ff       	call   f0100040 <_panic>
+		return ~0;
+f010106e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0101073:	c3                   	ret
+
+f0101074 <check_page_free_list>:
+{
+f0101074:	55                   	push   %ebp
+f0101075:	89 e5                	mov    %esp,%ebp
+f0101077:	57                   	push   %edi
+f0101078:	56                   	push   %esi
+f0101079:	53                   	push   %ebx
+f010107a:	83 ec 2c             	sub    $0x2c,%esp
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f010107d:	84 c0                	test   %al,%al
+f010107f:	0f 85 82 02 00 00    	jne    f0101307 <check_page_free_list+0x293>
+	if (!page_free_list)
+f0101085:	83 3d 40 42 a2 f0 00 	cmpl   $0x0,0xf0a24240
+f010108c:	74 0a                	je     f0101098 <check_page_free_list+0x24>
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f010108e:	be 00 04 00 00       	mov    $0x400,%esi
+f0101093:	e9 ca 02 00 00       	jmp    f0101362 <check_page_free_list+0x2ee>
+		panic("'page_free_list' is a null pointer!");
+f0101098:	83 ec 04             	sub    $0x4,%esp
+f010109b:	68 0c 95 10 f0       	push   $0xf010950c
+f01010a0:	68 44 03 00 00       	push   $0x344
+f01010a5:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01010aa:	e8 91 ef ff ff       	call   f0100040 <_panic>
+f01010af:	50                   	push   %eax
+f01010b0:	68 24 8e 10 f0       	push   $0xf0108e24
+f01010b5:	6a 5b                	push   $0x5b
+f01010b7:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01010bc:	e8 7f ef ff ff       	call   f0100040 <_panic>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f01010c1:	8b 1b                	mov    (%ebx),%ebx
+f01010c3:	85 db                	test   %ebx,%ebx
+f01010c5:	74 41                	je     f0101108 <check_page_free_list+0x94>
+int	user_mem_check2(struct Env*env, const void*va, size_t len, int perm, uintptr_t* err_addr);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f01010c7:	89 d8                	mov    %ebx,%eax
+f01010c9:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f01010cf:	c1 f8 03             	sar    $0x3,%eax
+f01010d2:	c1 e0 0c             	shl    $0xc,%eax
+		if (PDX(page2pa(pp)) < pdx_limit)
+f01010d5:	89 c2                	mov    %eax,%edx
+f01010d7:	c1 ea 16             	shr    $0x16,%edx
+f01010da:	39 f2                	cmp    %esi,%edx
+f01010dc:	73 e3                	jae    f01010c1 <check_page_free_list+0x4d>
+	if (PGNUM(pa) >= npages)
+f01010de:	89 c2                	mov    %eax,%edx
+f01010e0:	c1 ea 0c             	shr    $0xc,%edx
+f01010e3:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f01010e9:	73 c4                	jae    f01010af <check_page_free_list+0x3b>
+			memset(page2kva(pp), 0x97, 128);
+f01010eb:	83 ec 04             	sub    $0x4,%esp
+f01010ee:	68 80 00 00 00       	push   $0x80
+f01010f3:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f01010f8:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f01010fd:	50                   	push   %eax
+f01010fe:	e8 42 5f 00 00       	call   f0107045 <memset>
+f0101103:	83 c4 10             	add    $0x10,%esp
+f0101106:	eb b9                	jmp    f01010c1 <check_page_free_list+0x4d>
+	first_free_page = (char *) boot_alloc(0);
+f0101108:	b8 00 00 00 00       	mov    $0x0,%eax
+f010110d:	e8 72 fe ff ff       	call   f0100f84 <boot_alloc>
+f0101112:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101115:	8b 15 40 42 a2 f0    	mov    0xf0a24240,%edx
+		assert(pp >= pages);
+f010111b:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+		assert(pp < pages + npages);
+f0101121:	a1 98 62 a4 f0       	mov    0xf0a46298,%eax
+f0101126:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0101129:	8d 34 c1             	lea    (%ecx,%eax,8),%esi
+	int nfree_basemem = 0, nfree_extmem = 0;
+f010112c:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101131:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0101134:	89 7d d0             	mov    %edi,-0x30(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101137:	e9 fe 00 00 00       	jmp    f010123a <check_page_free_list+0x1c6>
+		assert(pp >= pages);
+f010113c:	68 c7 9e 10 f0       	push   $0xf0109ec7
+f0101141:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101146:	68 5e 03 00 00       	push   $0x35e
+f010114b:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101150:	e8 eb ee ff ff       	call   f0100040 <_panic>
+		assert(pp < pages + npages);
+f0101155:	68 e8 9e 10 f0       	push   $0xf0109ee8
+f010115a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010115f:	68 5f 03 00 00       	push   $0x35f
+f0101164:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101169:	e8 d2 ee ff ff       	call   f0100040 <_panic>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f010116e:	68 30 95 10 f0       	push   $0xf0109530
+f0101173:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101178:	68 60 03 00 00       	push   $0x360
+f010117d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101182:	e8 b9 ee ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != 0);
+f0101187:	68 fc 9e 10 f0       	push   $0xf0109efc
+f010118c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101191:	68 63 03 00 00       	push   $0x363
+f0101196:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010119b:	e8 a0 ee ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != IOPHYSMEM);
+f01011a0:	68 0d 9f 10 f0       	push   $0xf0109f0d
+f01011a5:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01011aa:	68 64 03 00 00       	push   $0x364
+f01011af:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01011b4:	e8 87 ee ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f01011b9:	68 64 95 10 f0       	push   $0xf0109564
+f01011be:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01011c3:	68 65 03 00 00       	push   $0x365
+f01011c8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01011cd:	e8 6e ee ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f01011d2:	68 26 9f 10 f0       	push   $0xf0109f26
+f01011d7:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01011dc:	68 66 03 00 00       	push   $0x366
+f01011e1:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01011e6:	e8 55 ee ff ff       	call   f0100040 <_panic>
+	if (PGNUM(pa) >= npages)
+f01011eb:	89 c3                	mov    %eax,%ebx
+f01011ed:	c1 eb 0c             	shr    $0xc,%ebx
+f01011f0:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f01011f3:	39 fb                	cmp    %edi,%ebx
+f01011f5:	73 12                	jae    f0101209 <check_page_free_list+0x195>
+	return (void *)(pa + KERNBASE);
+f01011f7:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f01011fc:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f01011ff:	39 f8                	cmp    %edi,%eax
+f0101201:	72 18                	jb     f010121b <check_page_free_list+0x1a7>
+			++nfree_extmem;
+f0101203:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0101207:	eb 2f                	jmp    f0101238 <check_page_free_list+0x1c4>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101209:	50                   	push   %eax
+f010120a:	68 24 8e 10 f0       	push   $0xf0108e24
+f010120f:	6a 5b                	push   $0x5b
+f0101211:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0101216:	e8 25 ee ff ff       	call   f0100040 <_panic>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f010121b:	68 88 95 10 f0       	push   $0xf0109588
+f0101220:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101225:	68 67 03 00 00       	push   $0x367
+f010122a:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010122f:	e8 0c ee ff ff       	call   f0100040 <_panic>
+			++nfree_basemem;
+f0101234:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101238:	8b 12                	mov    (%edx),%edx
+f010123a:	85 d2                	test   %edx,%edx
+f010123c:	74 74                	je     f01012b2 <check_page_free_list+0x23e>
+		assert(pp >= pages);
+f010123e:	39 ca                	cmp    %ecx,%edx
+f0101240:	0f 82 f6 fe ff ff    	jb     f010113c <check_page_free_list+0xc8>
+		assert(pp < pages + npages);
+f0101246:	39 f2                	cmp    %esi,%edx
+f0101248:	0f 83 07 ff ff ff    	jae    f0101155 <check_page_free_list+0xe1>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f010124e:	89 d0                	mov    %edx,%eax
+f0101250:	29 c8                	sub    %ecx,%eax
+f0101252:	a8 07                	test   $0x7,%al
+f0101254:	0f 85 14 ff ff ff    	jne    f010116e <check_page_free_list+0xfa>
+	return (pp - pages) << PGSHIFT;
+f010125a:	c1 f8 03             	sar    $0x3,%eax
+		assert(page2pa(pp) != 0);
+f010125d:	c1 e0 0c             	shl    $0xc,%eax
+f0101260:	0f 84 21 ff ff ff    	je     f0101187 <check_page_free_list+0x113>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0101266:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f010126b:	0f 84 2f ff ff ff    	je     f01011a0 <check_page_free_list+0x12c>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0101271:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f0101276:	0f 84 3d ff ff ff    	je     f01011b9 <check_page_free_list+0x145>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f010127c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f0101281:	0f 84 4b ff ff ff    	je     f01011d2 <check_page_free_list+0x15e>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0101287:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f010128c:	0f 87 59 ff ff ff    	ja     f01011eb <check_page_free_list+0x177>
+		assert(page2pa(pp) != MPENTRY_PADDR);
+f0101292:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f0101297:	75 9b                	jne    f0101234 <check_page_free_list+0x1c0>
+f0101299:	68 40 9f 10 f0       	push   $0xf0109f40
+f010129e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01012a3:	68 69 03 00 00       	push   $0x369
+f01012a8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01012ad:	e8 8e ed ff ff       	call   f0100040 <_panic>
+	assert(nfree_basemem > 0);
+f01012b2:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f01012b5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01012b8:	85 db                	test   %ebx,%ebx
+f01012ba:	7e 19                	jle    f01012d5 <check_page_free_list+0x261>
+	assert(nfree_extmem > 0);
+f01012bc:	85 ff                	test   %edi,%edi
+f01012be:	7e 2e                	jle    f01012ee <check_page_free_list+0x27a>
+	cprintf("check_page_free_list() succeeded!\n");
+f01012c0:	83 ec 0c             	sub    $0xc,%esp
+f01012c3:	68 d0 95 10 f0       	push   $0xf01095d0
+f01012c8:	e8 b0 30 00 00       	call   f010437d <cprintf>
+}
+f01012cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01012d0:	5b                   	pop    %ebx
+f01012d1:	5e                   	pop    %esi
+f01012d2:	5f                   	pop    %edi
+f01012d3:	5d                   	pop    %ebp
+f01012d4:	c3                   	ret
+	assert(nfree_basemem > 0);
+f01012d5:	68 5d 9f 10 f0       	push   $0xf0109f5d
+f01012da:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01012df:	68 71 03 00 00       	push   $0x371
+f01012e4:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01012e9:	e8 52 ed ff ff       	call   f0100040 <_panic>
+	assert(nfree_extmem > 0);
+f01012ee:	68 6f 9f 10 f0       	push   $0xf0109f6f
+f01012f3:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01012f8:	68 72 03 00 00       	push   $0x372
+f01012fd:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101302:	e8 39 ed ff ff       	call   f0100040 <_panic>
+	if (!page_free_list)
+f0101307:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f010130c:	85 c0                	test   %eax,%eax
+f010130e:	0f 84 84 fd ff ff    	je     f0101098 <check_page_free_list+0x24>
+		struct PageInfo **tp[2] = { &pp1, &pp2 };
+f0101314:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0101317:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f010131a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f010131d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101320:	89 c2                	mov    %eax,%edx
+f0101322:	2b 15 a0 62 a4 f0    	sub    0xf0a462a0,%edx
+			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f0101328:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f010132e:	0f 95 c2             	setne  %dl
+f0101331:	0f b6 d2             	movzbl %dl,%edx
+			*tp[pagetype] = pp;
+f0101334:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0101338:	89 01                	mov    %eax,(%ecx)
+			tp[pagetype] = &pp->pp_link;
+f010133a:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+		for (pp = page_free_list; pp; pp = pp->pp_link) {
+f010133e:	8b 00                	mov    (%eax),%eax
+f0101340:	85 c0                	test   %eax,%eax
+f0101342:	75 dc                	jne    f0101320 <check_page_free_list+0x2ac>
+		*tp[1] = 0;
+f0101344:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101347:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		*tp[0] = pp2;
+f010134d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0101350:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101353:	89 10                	mov    %edx,(%eax)
+		page_free_list = pp1;
+f0101355:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101358:	a3 40 42 a2 f0       	mov    %eax,0xf0a24240
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f010135d:	be 01 00 00 00       	mov    $0x1,%esi
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101362:	8b 1d 40 42 a2 f0    	mov    0xf0a24240,%ebx
+f0101368:	e9 56 fd ff ff       	jmp    f01010c3 <check_page_free_list+0x4f>
+
+f010136d <page_init>:
+{
+f010136d:	55                   	push   %ebp
+f010136e:	89 e5                	mov    %esp,%ebp
+f0101370:	57                   	push   %edi
+f0101371:	56                   	push   %esi
+f0101372:	53                   	push   %ebx
+f0101373:	83 ec 0c             	sub    $0xc,%esp
+	pages[0].pp_ref = 1;
+f0101376:	a1 a0 62 a4 f0       	mov    0xf0a462a0,%eax
+f010137b:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+	pages[0].pp_link = NULL;
+f0101381:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0101387:	ba 00 00 00 00       	mov    $0x0,%edx
+f010138c:	b8 08 00 00 00       	mov    $0x8,%eax
+		pages[i].pp_ref = 0;
+f0101391:	89 c1                	mov    %eax,%ecx
+f0101393:	03 0d a0 62 a4 f0    	add    0xf0a462a0,%ecx
+f0101399:	66 c7 41 04 00 00    	movw   $0x0,0x4(%ecx)
+		pages[i].pp_link = page_free_list;
+f010139f:	89 11                	mov    %edx,(%ecx)
+		page_free_list = &pages[i];
+f01013a1:	89 c2                	mov    %eax,%edx
+f01013a3:	03 15 a0 62 a4 f0    	add    0xf0a462a0,%edx
+	for (i = 1; i < mpentry_page_idx; ++i) {
+f01013a9:	83 c0 08             	add    $0x8,%eax
+f01013ac:	83 f8 38             	cmp    $0x38,%eax
+f01013af:	75 e0                	jne    f0101391 <page_init+0x24>
+f01013b1:	89 15 40 42 a2 f0    	mov    %edx,0xf0a24240
+	pages[i].pp_ref = 1;
+f01013b7:	a1 a0 62 a4 f0       	mov    0xf0a462a0,%eax
+f01013bc:	66 c7 40 3c 01 00    	movw   $0x1,0x3c(%eax)
+	pages[i].pp_link = NULL;
+f01013c2:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+	for (i++; i < npages_basemem; i++) {
+f01013c9:	8b 35 44 42 a2 f0    	mov    0xf0a24244,%esi
+f01013cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01013d4:	b8 08 00 00 00       	mov    $0x8,%eax
+f01013d9:	bf 01 00 00 00       	mov    $0x1,%edi
+f01013de:	eb 24                	jmp    f0101404 <page_init+0x97>
+		pages[i].pp_ref = 0;
+f01013e0:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+f01013e7:	89 cb                	mov    %ecx,%ebx
+f01013e9:	03 1d a0 62 a4 f0    	add    0xf0a462a0,%ebx
+f01013ef:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+		pages[i].pp_link = page_free_list;
+f01013f5:	89 13                	mov    %edx,(%ebx)
+		page_free_list = &pages[i];
+f01013f7:	03 0d a0 62 a4 f0    	add    0xf0a462a0,%ecx
+f01013fd:	89 ca                	mov    %ecx,%edx
+	for (i++; i < npages_basemem; i++) {
+f01013ff:	83 c0 01             	add    $0x1,%eax
+f0101402:	89 fb                	mov    %edi,%ebx
+f0101404:	39 f0                	cmp    %esi,%eax
+f0101406:	72 d8                	jb     f01013e0 <page_init+0x73>
+f0101408:	b9 08 00 00 00       	mov    $0x8,%ecx
+f010140d:	39 ce                	cmp    %ecx,%esi
+f010140f:	0f 43 ce             	cmovae %esi,%ecx
+f0101412:	84 db                	test   %bl,%bl
+f0101414:	74 06                	je     f010141c <page_init+0xaf>
+f0101416:	89 15 40 42 a2 f0    	mov    %edx,0xf0a24240
+	assert(npages_basemem << PGSHIFT == IOPHYSMEM);
+f010141c:	89 f0                	mov    %esi,%eax
+f010141e:	c1 e0 0c             	shl    $0xc,%eax
+f0101421:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f0101426:	75 04                	jne    f010142c <page_init+0xbf>
+f0101428:	89 c8                	mov    %ecx,%eax
+f010142a:	eb 31                	jmp    f010145d <page_init+0xf0>
+f010142c:	68 f4 95 10 f0       	push   $0xf01095f4
+f0101431:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101436:	68 5a 01 00 00       	push   $0x15a
+f010143b:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101440:	e8 fb eb ff ff       	call   f0100040 <_panic>
+		pages[i].pp_ref = 1;
+f0101445:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f010144b:	8d 14 c2             	lea    (%edx,%eax,8),%edx
+f010144e:	66 c7 42 04 01 00    	movw   $0x1,0x4(%edx)
+		pages[i].pp_link = NULL;
+f0101454:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (; i < EXTPHYSMEM >> PGSHIFT; i++) {
+f010145a:	83 c0 01             	add    $0x1,%eax
+f010145d:	3d ff 00 00 00       	cmp    $0xff,%eax
+f0101462:	76 e1                	jbe    f0101445 <page_init+0xd8>
+f0101464:	b8 00 01 00 00       	mov    $0x100,%eax
+f0101469:	29 c8                	sub    %ecx,%eax
+f010146b:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+f0101471:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101476:	0f 47 c2             	cmova  %edx,%eax
+f0101479:	8d 1c 08             	lea    (%eax,%ecx,1),%ebx
+	protect_page_n = (size_t)ROUNDUP(PADDR(boot_alloc(0)), PGSIZE) >> PGSHIFT;
+f010147c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101481:	e8 fe fa ff ff       	call   f0100f84 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101486:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010148b:	76 28                	jbe    f01014b5 <page_init+0x148>
+f010148d:	05 ff 0f 00 10       	add    $0x10000fff,%eax
+f0101492:	c1 e8 0c             	shr    $0xc,%eax
+	for (; i < protect_page_n; i++) {
+f0101495:	89 da                	mov    %ebx,%edx
+f0101497:	39 c2                	cmp    %eax,%edx
+f0101499:	73 2f                	jae    f01014ca <page_init+0x15d>
+		pages[i].pp_ref = 1;
+f010149b:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+f01014a1:	8d 0c d1             	lea    (%ecx,%edx,8),%ecx
+f01014a4:	66 c7 41 04 01 00    	movw   $0x1,0x4(%ecx)
+		pages[i].pp_link = NULL;
+f01014aa:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	for (; i < protect_page_n; i++) {
+f01014b0:	83 c2 01             	add    $0x1,%edx
+f01014b3:	eb e2                	jmp    f0101497 <page_init+0x12a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01014b5:	50                   	push   %eax
+f01014b6:	68 48 8e 10 f0       	push   $0xf0108e48
+f01014bb:	68 62 01 00 00       	push   $0x162
+f01014c0:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01014c5:	e8 76 eb ff ff       	call   f0100040 <_panic>
+f01014ca:	89 c2                	mov    %eax,%edx
+f01014cc:	29 da                	sub    %ebx,%edx
+f01014ce:	39 d8                	cmp    %ebx,%eax
+f01014d0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01014d5:	0f 42 d0             	cmovb  %eax,%edx
+f01014d8:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+f01014db:	8b 1d 40 42 a2 f0    	mov    0xf0a24240,%ebx
+f01014e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (; i < npages; i++) {
+f01014e6:	be 01 00 00 00       	mov    $0x1,%esi
+f01014eb:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01014f1:	73 26                	jae    f0101519 <page_init+0x1ac>
+		pages[i].pp_ref = 0;
+f01014f3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+f01014fa:	89 d1                	mov    %edx,%ecx
+f01014fc:	03 0d a0 62 a4 f0    	add    0xf0a462a0,%ecx
+f0101502:	66 c7 41 04 00 00    	movw   $0x0,0x4(%ecx)
+		pages[i].pp_link = page_free_list;
+f0101508:	89 19                	mov    %ebx,(%ecx)
+		page_free_list = &pages[i];
+f010150a:	89 d3                	mov    %edx,%ebx
+f010150c:	03 1d a0 62 a4 f0    	add    0xf0a462a0,%ebx
+	for (; i < npages; i++) {
+f0101512:	83 c0 01             	add    $0x1,%eax
+f0101515:	89 f2                	mov    %esi,%edx
+f0101517:	eb d2                	jmp    f01014eb <page_init+0x17e>
+f0101519:	84 d2                	test   %dl,%dl
+f010151b:	74 06                	je     f0101523 <page_init+0x1b6>
+f010151d:	89 1d 40 42 a2 f0    	mov    %ebx,0xf0a24240
+}
+f0101523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101526:	5b                   	pop    %ebx
+f0101527:	5e                   	pop    %esi
+f0101528:	5f                   	pop    %edi
+f0101529:	5d                   	pop    %ebp
+f010152a:	c3                   	ret
+
+f010152b <page_alloc>:
+{
+f010152b:	55                   	push   %ebp
+f010152c:	89 e5                	mov    %esp,%ebp
+f010152e:	53                   	push   %ebx
+f010152f:	83 ec 04             	sub    $0x4,%esp
+	if (!page_free_list) {
+f0101532:	8b 1d 40 42 a2 f0    	mov    0xf0a24240,%ebx
+f0101538:	85 db                	test   %ebx,%ebx
+f010153a:	74 19                	je     f0101555 <page_alloc+0x2a>
+	page_free_list = page_free_list->pp_link;
+f010153c:	8b 03                	mov    (%ebx),%eax
+f010153e:	a3 40 42 a2 f0       	mov    %eax,0xf0a24240
+	if (alloc_flags & ALLOC_ZERO) {
+f0101543:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0101547:	75 13                	jne    f010155c <page_alloc+0x31>
+	result->pp_ref= 0;
+f0101549:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+	result->pp_link = NULL;
+f010154f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+f0101555:	89 d8                	mov    %ebx,%eax
+f0101557:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010155a:	c9                   	leave
+f010155b:	c3                   	ret
+	return (pp - pages) << PGSHIFT;
+f010155c:	89 d8                	mov    %ebx,%eax
+f010155e:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0101564:	c1 f8 03             	sar    $0x3,%eax
+f0101567:	89 c2                	mov    %eax,%edx
+f0101569:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010156c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101571:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101577:	73 1b                	jae    f0101594 <page_alloc+0x69>
+		memset(page2kva(result), 0, PGSIZE);
+f0101579:	83 ec 04             	sub    $0x4,%esp
+f010157c:	68 00 10 00 00       	push   $0x1000
+f0101581:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0101583:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101589:	52                   	push   %edx
+f010158a:	e8 b6 5a 00 00       	call   f0107045 <memset>
+f010158f:	83 c4 10             	add    $0x10,%esp
+f0101592:	eb b5                	jmp    f0101549 <page_alloc+0x1e>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101594:	52                   	push   %edx
+f0101595:	68 24 8e 10 f0       	push   $0xf0108e24
+f010159a:	6a 5b                	push   $0x5b
+f010159c:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01015a1:	e8 9a ea ff ff       	call   f0100040 <_panic>
+
+f01015a6 <page_free>:
+{
+f01015a6:	55                   	push   %ebp
+f01015a7:	89 e5                	mov    %esp,%ebp
+f01015a9:	83 ec 08             	sub    $0x8,%esp
+f01015ac:	8b 45 08             	mov    0x8(%ebp),%eax
+	assert(pp->pp_ref == 0);
+f01015af:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f01015b4:	75 0f                	jne    f01015c5 <page_free+0x1f>
+	pp->pp_link = page_free_list;
+f01015b6:	8b 15 40 42 a2 f0    	mov    0xf0a24240,%edx
+f01015bc:	89 10                	mov    %edx,(%eax)
+	page_free_list = pp;
+f01015be:	a3 40 42 a2 f0       	mov    %eax,0xf0a24240
+}
+f01015c3:	c9                   	leave
+f01015c4:	c3                   	ret
+	assert(pp->pp_ref == 0);
+f01015c5:	68 80 9f 10 f0       	push   $0xf0109f80
+f01015ca:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01015cf:	68 97 01 00 00       	push   $0x197
+f01015d4:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01015d9:	e8 62 ea ff ff       	call   f0100040 <_panic>
+
+f01015de <page_decref>:
+{
+f01015de:	55                   	push   %ebp
+f01015df:	89 e5                	mov    %esp,%ebp
+f01015e1:	83 ec 08             	sub    $0x8,%esp
+f01015e4:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (--pp->pp_ref == 0)
+f01015e7:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+f01015eb:	83 e8 01             	sub    $0x1,%eax
+f01015ee:	66 89 42 04          	mov    %ax,0x4(%edx)
+f01015f2:	66 85 c0             	test   %ax,%ax
+f01015f5:	74 02                	je     f01015f9 <page_decref+0x1b>
+}
+f01015f7:	c9                   	leave
+f01015f8:	c3                   	ret
+		page_free(pp);
+f01015f9:	83 ec 0c             	sub    $0xc,%esp
+f01015fc:	52                   	push   %edx
+f01015fd:	e8 a4 ff ff ff       	call   f01015a6 <page_free>
+f0101602:	83 c4 10             	add    $0x10,%esp
+}
+f0101605:	eb f0                	jmp    f01015f7 <page_decref+0x19>
+
+f0101607 <pgdir_walk>:
+{
+f0101607:	55                   	push   %ebp
+f0101608:	89 e5                	mov    %esp,%ebp
+f010160a:	56                   	push   %esi
+f010160b:	53                   	push   %ebx
+f010160c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pde_t *pde_entry = &pgdir[PDX(va)];
+f010160f:	89 f3                	mov    %esi,%ebx
+f0101611:	c1 eb 16             	shr    $0x16,%ebx
+f0101614:	c1 e3 02             	shl    $0x2,%ebx
+f0101617:	03 5d 08             	add    0x8(%ebp),%ebx
+	if (*pde_entry & PTE_P) {
+f010161a:	8b 03                	mov    (%ebx),%eax
+f010161c:	a8 01                	test   $0x1,%al
+f010161e:	75 60                	jne    f0101680 <pgdir_walk+0x79>
+	if (!create) {
+f0101620:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101624:	0f 84 a2 00 00 00    	je     f01016cc <pgdir_walk+0xc5>
+	page = page_alloc(ALLOC_ZERO);
+f010162a:	83 ec 0c             	sub    $0xc,%esp
+f010162d:	6a 01                	push   $0x1
+f010162f:	e8 f7 fe ff ff       	call   f010152b <page_alloc>
+	if (!page) {
+f0101634:	83 c4 10             	add    $0x10,%esp
+f0101637:	85 c0                	test   %eax,%eax
+f0101639:	74 3e                	je     f0101679 <pgdir_walk+0x72>
+	page->pp_ref = 1;
+f010163b:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+	page->pp_link = NULL;
+f0101641:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	return (pp - pages) << PGSHIFT;
+f0101647:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f010164d:	c1 f8 03             	sar    $0x3,%eax
+f0101650:	89 c2                	mov    %eax,%edx
+f0101652:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101655:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010165a:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101660:	73 58                	jae    f01016ba <pgdir_walk+0xb3>
+	*pde_entry = page2pa(page) | PTE_W | PTE_P | PTE_U;
+f0101662:	89 d0                	mov    %edx,%eax
+f0101664:	83 c8 07             	or     $0x7,%eax
+f0101667:	89 03                	mov    %eax,(%ebx)
+	return &page_table[PTX(va)];
+f0101669:	c1 ee 0a             	shr    $0xa,%esi
+f010166c:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f0101672:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+}
+f0101679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010167c:	5b                   	pop    %ebx
+f010167d:	5e                   	pop    %esi
+f010167e:	5d                   	pop    %ebp
+f010167f:	c3                   	ret
+		page_table = KADDR(PTE_ADDR(*pde_entry));
+f0101680:	89 c2                	mov    %eax,%edx
+f0101682:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101688:	c1 e8 0c             	shr    $0xc,%eax
+f010168b:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101691:	73 12                	jae    f01016a5 <pgdir_walk+0x9e>
+		return &page_table[PTX(va)];
+f0101693:	c1 ee 0a             	shr    $0xa,%esi
+f0101696:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f010169c:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+f01016a3:	eb d4                	jmp    f0101679 <pgdir_walk+0x72>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01016a5:	52                   	push   %edx
+f01016a6:	68 24 8e 10 f0       	push   $0xf0108e24
+f01016ab:	68 c4 01 00 00       	push   $0x1c4
+f01016b0:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01016b5:	e8 86 e9 ff ff       	call   f0100040 <_panic>
+f01016ba:	52                   	push   %edx
+f01016bb:	68 24 8e 10 f0       	push   $0xf0108e24
+f01016c0:	6a 5b                	push   $0x5b
+f01016c2:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01016c7:	e8 74 e9 ff ff       	call   f0100040 <_panic>
+		return NULL;
+f01016cc:	b8 00 00 00 00       	mov    $0x0,%eax
+f01016d1:	eb a6                	jmp    f0101679 <pgdir_walk+0x72>
+
+f01016d3 <boot_map_region>:
+{
+f01016d3:	55                   	push   %ebp
+f01016d4:	89 e5                	mov    %esp,%ebp
+f01016d6:	57                   	push   %edi
+f01016d7:	56                   	push   %esi
+f01016d8:	53                   	push   %ebx
+f01016d9:	83 ec 1c             	sub    $0x1c,%esp
+f01016dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	assert(va%PGSIZE == 0);
+f01016df:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f01016e5:	75 2d                	jne    f0101714 <boot_map_region+0x41>
+f01016e7:	89 cf                	mov    %ecx,%edi
+	assert(pa%PGSIZE == 0);
+f01016e9:	f7 45 08 ff 0f 00 00 	testl  $0xfff,0x8(%ebp)
+f01016f0:	75 3b                	jne    f010172d <boot_map_region+0x5a>
+	assert(size%PGSIZE == 0);
+f01016f2:	89 ce                	mov    %ecx,%esi
+f01016f4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f01016fa:	75 4a                	jne    f0101746 <boot_map_region+0x73>
+	assert(MAX_VADDR - va + 1 >= size);
+f01016fc:	89 d0                	mov    %edx,%eax
+f01016fe:	f7 d8                	neg    %eax
+f0101700:	39 c8                	cmp    %ecx,%eax
+f0101702:	72 5b                	jb     f010175f <boot_map_region+0x8c>
+	assert(va >= UTOP);
+f0101704:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f010170a:	76 6c                	jbe    f0101778 <boot_map_region+0xa5>
+f010170c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f010170f:	e9 8b 00 00 00       	jmp    f010179f <boot_map_region+0xcc>
+	assert(va%PGSIZE == 0);
+f0101714:	68 90 9f 10 f0       	push   $0xf0109f90
+f0101719:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010171e:	68 eb 01 00 00       	push   $0x1eb
+f0101723:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101728:	e8 13 e9 ff ff       	call   f0100040 <_panic>
+	assert(pa%PGSIZE == 0);
+f010172d:	68 9f 9f 10 f0       	push   $0xf0109f9f
+f0101732:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101737:	68 ec 01 00 00       	push   $0x1ec
+f010173c:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101741:	e8 fa e8 ff ff       	call   f0100040 <_panic>
+	assert(size%PGSIZE == 0);
+f0101746:	68 ae 9f 10 f0       	push   $0xf0109fae
+f010174b:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101750:	68 ed 01 00 00       	push   $0x1ed
+f0101755:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010175a:	e8 e1 e8 ff ff       	call   f0100040 <_panic>
+	assert(MAX_VADDR - va + 1 >= size);
+f010175f:	68 bf 9f 10 f0       	push   $0xf0109fbf
+f0101764:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101769:	68 ee 01 00 00       	push   $0x1ee
+f010176e:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101773:	e8 c8 e8 ff ff       	call   f0100040 <_panic>
+	assert(va >= UTOP);
+f0101778:	68 da 9f 10 f0       	push   $0xf0109fda
+f010177d:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101782:	68 f0 01 00 00       	push   $0x1f0
+f0101787:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010178c:	e8 af e8 ff ff       	call   f0100040 <_panic>
+		*pte = pa | perm | PTE_P;
+f0101791:	0b 5d 0c             	or     0xc(%ebp),%ebx
+f0101794:	83 cb 01             	or     $0x1,%ebx
+f0101797:	89 18                	mov    %ebx,(%eax)
+	for (size_t i = 0; i < size; i += PGSIZE, va += PGSIZE, pa += PGSIZE) {
+f0101799:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010179f:	89 f3                	mov    %esi,%ebx
+f01017a1:	03 5d 08             	add    0x8(%ebp),%ebx
+f01017a4:	39 fe                	cmp    %edi,%esi
+f01017a6:	73 33                	jae    f01017db <boot_map_region+0x108>
+		pte_t* pte = pgdir_walk(pgdir, (void*)va, 1);
+f01017a8:	83 ec 04             	sub    $0x4,%esp
+f01017ab:	6a 01                	push   $0x1
+f01017ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01017b0:	01 f0                	add    %esi,%eax
+f01017b2:	50                   	push   %eax
+f01017b3:	ff 75 e4             	push   -0x1c(%ebp)
+f01017b6:	e8 4c fe ff ff       	call   f0101607 <pgdir_walk>
+		assert(pte);
+f01017bb:	83 c4 10             	add    $0x10,%esp
+f01017be:	85 c0                	test   %eax,%eax
+f01017c0:	75 cf                	jne    f0101791 <boot_map_region+0xbe>
+f01017c2:	68 e5 9f 10 f0       	push   $0xf0109fe5
+f01017c7:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01017cc:	68 f3 01 00 00       	push   $0x1f3
+f01017d1:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01017d6:	e8 65 e8 ff ff       	call   f0100040 <_panic>
+}
+f01017db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01017de:	5b                   	pop    %ebx
+f01017df:	5e                   	pop    %esi
+f01017e0:	5f                   	pop    %edi
+f01017e1:	5d                   	pop    %ebp
+f01017e2:	c3                   	ret
+
+f01017e3 <page_lookup>:
+{
+f01017e3:	55                   	push   %ebp
+f01017e4:	89 e5                	mov    %esp,%ebp
+f01017e6:	53                   	push   %ebx
+f01017e7:	83 ec 08             	sub    $0x8,%esp
+f01017ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte_t* pte = pgdir_walk(pgdir, va, 0);
+f01017ed:	6a 00                	push   $0x0
+f01017ef:	ff 75 0c             	push   0xc(%ebp)
+f01017f2:	ff 75 08             	push   0x8(%ebp)
+f01017f5:	e8 0d fe ff ff       	call   f0101607 <pgdir_walk>
+	if (!pte || !(*pte & PTE_P)) {
+f01017fa:	83 c4 10             	add    $0x10,%esp
+f01017fd:	85 c0                	test   %eax,%eax
+f01017ff:	74 21                	je     f0101822 <page_lookup+0x3f>
+f0101801:	f6 00 01             	testb  $0x1,(%eax)
+f0101804:	74 35                	je     f010183b <page_lookup+0x58>
+	if (pte_store) {
+f0101806:	85 db                	test   %ebx,%ebx
+f0101808:	74 02                	je     f010180c <page_lookup+0x29>
+		*pte_store = pte;
+f010180a:	89 03                	mov    %eax,(%ebx)
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010180c:	8b 00                	mov    (%eax),%eax
+f010180e:	c1 e8 0c             	shr    $0xc,%eax
+f0101811:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101817:	73 0e                	jae    f0101827 <page_lookup+0x44>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0101819:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f010181f:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+}
+f0101822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101825:	c9                   	leave
+f0101826:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0101827:	83 ec 04             	sub    $0x4,%esp
+f010182a:	68 1c 96 10 f0       	push   $0xf010961c
+f010182f:	6a 54                	push   $0x54
+f0101831:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0101836:	e8 05 e8 ff ff       	call   f0100040 <_panic>
+		return NULL;
+f010183b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101840:	eb e0                	jmp    f0101822 <page_lookup+0x3f>
+
+f0101842 <tlb_sync>:
+{
+f0101842:	55                   	push   %ebp
+f0101843:	89 e5                	mov    %esp,%ebp
+f0101845:	83 ec 08             	sub    $0x8,%esp
+	if (thiscpu->cpu_tlb_gen != tlb_gen) {
+f0101848:	e8 ee 5d 00 00       	call   f010763b <cpunum>
+f010184d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0101850:	8b 90 98 70 a4 f0    	mov    -0xf5b8f68(%eax),%edx
+f0101856:	a1 94 62 a4 f0       	mov    0xf0a46294,%eax
+f010185b:	39 c2                	cmp    %eax,%edx
+f010185d:	75 02                	jne    f0101861 <tlb_sync+0x1f>
+}
+f010185f:	c9                   	leave
+f0101860:	c3                   	ret
+		thiscpu->cpu_tlb_gen = tlb_gen;
+f0101861:	e8 d5 5d 00 00       	call   f010763b <cpunum>
+f0101866:	8b 15 94 62 a4 f0    	mov    0xf0a46294,%edx
+f010186c:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010186f:	89 90 98 70 a4 f0    	mov    %edx,-0xf5b8f68(%eax)
+f0101875:	0f 20 d8             	mov    %cr3,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0101878:	0f 22 d8             	mov    %eax,%cr3
+}
+f010187b:	eb e2                	jmp    f010185f <tlb_sync+0x1d>
+
+f010187d <tlb_invalidate>:
+{
+f010187d:	55                   	push   %ebp
+f010187e:	89 e5                	mov    %esp,%ebp
+f0101880:	57                   	push   %edi
+f0101881:	56                   	push   %esi
+f0101882:	53                   	push   %ebx
+f0101883:	83 ec 1c             	sub    $0x1c,%esp
+	if (!curenv || curenv->env_pgdir == pgdir)
+f0101886:	e8 b0 5d 00 00       	call   f010763b <cpunum>
+f010188b:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010188e:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f0101895:	74 16                	je     f01018ad <tlb_invalidate+0x30>
+f0101897:	e8 9f 5d 00 00       	call   f010763b <cpunum>
+f010189c:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010189f:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01018a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01018a8:	39 48 60             	cmp    %ecx,0x60(%eax)
+f01018ab:	75 06                	jne    f01018b3 <tlb_invalidate+0x36>
+	asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01018ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01018b0:	0f 01 38             	invlpg (%eax)
+	if ((uint32_t)kva < KERNBASE)
+f01018b3:	81 7d 08 ff ff ff ef 	cmpl   $0xefffffff,0x8(%ebp)
+f01018ba:	76 4c                	jbe    f0101908 <tlb_invalidate+0x8b>
+	return (physaddr_t)kva - KERNBASE;
+f01018bc:	8b 45 08             	mov    0x8(%ebp),%eax
+f01018bf:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f01018c4:	c1 e8 0c             	shr    $0xc,%eax
+f01018c7:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01018cd:	73 50                	jae    f010191f <tlb_invalidate+0xa2>
+	if (pa2page(PADDR(pgdir))->pp_ref < 2)
+f01018cf:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f01018d5:	66 83 7c c2 04 01    	cmpw   $0x1,0x4(%edx,%eax,8)
+f01018db:	0f 86 b4 00 00 00    	jbe    f0101995 <tlb_invalidate+0x118>
+	gen = ++tlb_gen;
+f01018e1:	a1 94 62 a4 f0       	mov    0xf0a46294,%eax
+f01018e6:	8d 78 01             	lea    0x1(%eax),%edi
+f01018e9:	89 3d 94 62 a4 f0    	mov    %edi,0xf0a46294
+	thiscpu->cpu_tlb_gen = gen;
+f01018ef:	e8 47 5d 00 00       	call   f010763b <cpunum>
+f01018f4:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01018f7:	89 b8 98 70 a4 f0    	mov    %edi,-0xf5b8f68(%eax)
+	bool sent = 0;
+f01018fd:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0101901:	bb 20 70 a4 f0       	mov    $0xf0a47020,%ebx
+f0101906:	eb 5b                	jmp    f0101963 <tlb_invalidate+0xe6>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101908:	ff 75 08             	push   0x8(%ebp)
+f010190b:	68 48 8e 10 f0       	push   $0xf0108e48
+f0101910:	68 6d 02 00 00       	push   $0x26d
+f0101915:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010191a:	e8 21 e7 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f010191f:	83 ec 04             	sub    $0x4,%esp
+f0101922:	68 1c 96 10 f0       	push   $0xf010961c
+f0101927:	6a 54                	push   $0x54
+f0101929:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f010192e:	e8 0d e7 ff ff       	call   f0100040 <_panic>
+			asm volatile("pause");
+f0101933:	f3 90                	pause
+f0101935:	89 f0                	mov    %esi,%eax
+f0101937:	88 45 e7             	mov    %al,-0x19(%ebp)
+		while (c->cpu_in_user && c->cpu_tlb_gen != gen) {
+f010193a:	0f b6 73 74          	movzbl 0x74(%ebx),%esi
+f010193e:	89 f0                	mov    %esi,%eax
+f0101940:	84 c0                	test   %al,%al
+f0101942:	74 1c                	je     f0101960 <tlb_invalidate+0xe3>
+f0101944:	8b 43 78             	mov    0x78(%ebx),%eax
+f0101947:	39 c7                	cmp    %eax,%edi
+f0101949:	74 15                	je     f0101960 <tlb_invalidate+0xe3>
+			if (!sent) {
+f010194b:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+f010194f:	75 e2                	jne    f0101933 <tlb_invalidate+0xb6>
+				lapic_ipi(T_TLBFLUSH);
+f0101951:	83 ec 0c             	sub    $0xc,%esp
+f0101954:	6a 31                	push   $0x31
+f0101956:	e8 09 5f 00 00       	call   f0107864 <lapic_ipi>
+f010195b:	83 c4 10             	add    $0x10,%esp
+f010195e:	eb d3                	jmp    f0101933 <tlb_invalidate+0xb6>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0101960:	83 c3 7c             	add    $0x7c,%ebx
+f0101963:	6b 05 04 74 a4 f0 7c 	imul   $0x7c,0xf0a47404,%eax
+f010196a:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f010196f:	39 c3                	cmp    %eax,%ebx
+f0101971:	73 22                	jae    f0101995 <tlb_invalidate+0x118>
+		if (c == thiscpu || !c->cpu_env || c->cpu_env->env_pgdir != pgdir)
+f0101973:	e8 c3 5c 00 00       	call   f010763b <cpunum>
+f0101978:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010197b:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f0101980:	39 c3                	cmp    %eax,%ebx
+f0101982:	74 dc                	je     f0101960 <tlb_invalidate+0xe3>
+f0101984:	8b 43 08             	mov    0x8(%ebx),%eax
+f0101987:	85 c0                	test   %eax,%eax
+f0101989:	74 d5                	je     f0101960 <tlb_invalidate+0xe3>
+f010198b:	8b 40 60             	mov    0x60(%eax),%eax
+f010198e:	39 45 08             	cmp    %eax,0x8(%ebp)
+f0101991:	75 cd                	jne    f0101960 <tlb_invalidate+0xe3>
+f0101993:	eb a5                	jmp    f010193a <tlb_invalidate+0xbd>
+}
+f0101995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101998:	5b                   	pop    %ebx
+f0101999:	5e                   	pop    %esi
+f010199a:	5f                   	pop    %edi
+f010199b:	5d                   	pop    %ebp
+f010199c:	c3                   	ret
+
+f010199d <page_remove>:
+{
+f010199d:	55                   	push   %ebp
+f010199e:	89 e5                	mov    %esp,%ebp
+f01019a0:	57                   	push   %edi
+f01019a1:	56                   	push   %esi
+f01019a2:	53                   	push   %ebx
+f01019a3:	83 ec 20             	sub    $0x20,%esp
+f01019a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01019a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pte_t* pte = NULL;
+f01019ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	page = page_lookup(pgdir, va, &pte);
+f01019b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01019b6:	50                   	push   %eax
+f01019b7:	56                   	push   %esi
+f01019b8:	53                   	push   %ebx
+f01019b9:	e8 25 fe ff ff       	call   f01017e3 <page_lookup>
+	assert((page && pte) || (!page && !pte));
+f01019be:	83 c4 10             	add    $0x10,%esp
+f01019c1:	85 c0                	test   %eax,%eax
+f01019c3:	74 2b                	je     f01019f0 <page_remove+0x53>
+f01019c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01019c8:	85 ff                	test   %edi,%edi
+f01019ca:	74 2a                	je     f01019f6 <page_remove+0x59>
+		page_decref(page);
+f01019cc:	83 ec 0c             	sub    $0xc,%esp
+f01019cf:	50                   	push   %eax
+f01019d0:	e8 09 fc ff ff       	call   f01015de <page_decref>
+		*pte = 0;
+f01019d5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		tlb_invalidate(pgdir, va);
+f01019db:	83 c4 08             	add    $0x8,%esp
+f01019de:	56                   	push   %esi
+f01019df:	53                   	push   %ebx
+f01019e0:	e8 98 fe ff ff       	call   f010187d <tlb_invalidate>
+f01019e5:	83 c4 10             	add    $0x10,%esp
+}
+f01019e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01019eb:	5b                   	pop    %ebx
+f01019ec:	5e                   	pop    %esi
+f01019ed:	5f                   	pop    %edi
+f01019ee:	5d                   	pop    %ebp
+f01019ef:	c3                   	ret
+	assert((page && pte) || (!page && !pte));
+f01019f0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f01019f4:	74 f2                	je     f01019e8 <page_remove+0x4b>
+f01019f6:	68 3c 96 10 f0       	push   $0xf010963c
+f01019fb:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101a00:	68 56 02 00 00       	push   $0x256
+f0101a05:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101a0a:	e8 31 e6 ff ff       	call   f0100040 <_panic>
+
+f0101a0f <page_insert>:
+{
+f0101a0f:	55                   	push   %ebp
+f0101a10:	89 e5                	mov    %esp,%ebp
+f0101a12:	57                   	push   %edi
+f0101a13:	56                   	push   %esi
+f0101a14:	53                   	push   %ebx
+f0101a15:	83 ec 0c             	sub    $0xc,%esp
+f0101a18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101a1b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	assert((uintptr_t)va % PGSIZE == 0);
+f0101a1e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+f0101a24:	75 48                	jne    f0101a6e <page_insert+0x5f>
+	pte = pgdir_walk(pgdir, va, 1);
+f0101a26:	83 ec 04             	sub    $0x4,%esp
+f0101a29:	6a 01                	push   $0x1
+f0101a2b:	57                   	push   %edi
+f0101a2c:	ff 75 08             	push   0x8(%ebp)
+f0101a2f:	e8 d3 fb ff ff       	call   f0101607 <pgdir_walk>
+f0101a34:	89 c6                	mov    %eax,%esi
+	if (!pte) {
+f0101a36:	83 c4 10             	add    $0x10,%esp
+f0101a39:	85 c0                	test   %eax,%eax
+f0101a3b:	74 5b                	je     f0101a98 <page_insert+0x89>
+	pp->pp_ref++;
+f0101a3d:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+	pp->pp_link = NULL;
+f0101a42:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	if (*pte & PTE_P) {
+f0101a48:	f6 00 01             	testb  $0x1,(%eax)
+f0101a4b:	75 3a                	jne    f0101a87 <page_insert+0x78>
+	return (pp - pages) << PGSHIFT;
+f0101a4d:	2b 1d a0 62 a4 f0    	sub    0xf0a462a0,%ebx
+f0101a53:	c1 fb 03             	sar    $0x3,%ebx
+f0101a56:	c1 e3 0c             	shl    $0xc,%ebx
+	*pte = page2pa(pp) | perm | PTE_P;
+f0101a59:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0101a5c:	83 cb 01             	or     $0x1,%ebx
+f0101a5f:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+f0101a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101a69:	5b                   	pop    %ebx
+f0101a6a:	5e                   	pop    %esi
+f0101a6b:	5f                   	pop    %edi
+f0101a6c:	5d                   	pop    %ebp
+f0101a6d:	c3                   	ret
+	assert((uintptr_t)va % PGSIZE == 0);
+f0101a6e:	68 e9 9f 10 f0       	push   $0xf0109fe9
+f0101a73:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101a78:	68 15 02 00 00       	push   $0x215
+f0101a7d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101a82:	e8 b9 e5 ff ff       	call   f0100040 <_panic>
+		page_remove(pgdir, va);
+f0101a87:	83 ec 08             	sub    $0x8,%esp
+f0101a8a:	57                   	push   %edi
+f0101a8b:	ff 75 08             	push   0x8(%ebp)
+f0101a8e:	e8 0a ff ff ff       	call   f010199d <page_remove>
+f0101a93:	83 c4 10             	add    $0x10,%esp
+f0101a96:	eb b5                	jmp    f0101a4d <page_insert+0x3e>
+		return -E_NO_MEM;
+f0101a98:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101a9d:	eb c7                	jmp    f0101a66 <page_insert+0x57>
+
+f0101a9f <mmio_map_region>:
+{
+f0101a9f:	55                   	push   %ebp
+f0101aa0:	89 e5                	mov    %esp,%ebp
+f0101aa2:	56                   	push   %esi
+f0101aa3:	53                   	push   %ebx
+	void *ret = (void*)base;
+f0101aa4:	8b 35 00 63 11 f0    	mov    0xf0116300,%esi
+	size = ROUNDUP(size, PGSIZE);
+f0101aaa:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101aad:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+f0101ab3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (MMIOLIM - base < size) {
+f0101ab9:	b8 00 00 c0 ef       	mov    $0xefc00000,%eax
+f0101abe:	29 f0                	sub    %esi,%eax
+f0101ac0:	39 d8                	cmp    %ebx,%eax
+f0101ac2:	72 25                	jb     f0101ae9 <mmio_map_region+0x4a>
+	boot_map_region(kern_pgdir, base, size, pa, PTE_W|PTE_PCD|PTE_PWT);
+f0101ac4:	83 ec 08             	sub    $0x8,%esp
+f0101ac7:	6a 1a                	push   $0x1a
+f0101ac9:	ff 75 08             	push   0x8(%ebp)
+f0101acc:	89 d9                	mov    %ebx,%ecx
+f0101ace:	89 f2                	mov    %esi,%edx
+f0101ad0:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0101ad5:	e8 f9 fb ff ff       	call   f01016d3 <boot_map_region>
+	base += size;
+f0101ada:	01 1d 00 63 11 f0    	add    %ebx,0xf0116300
+}
+f0101ae0:	89 f0                	mov    %esi,%eax
+f0101ae2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101ae5:	5b                   	pop    %ebx
+f0101ae6:	5e                   	pop    %esi
+f0101ae7:	5d                   	pop    %ebp
+f0101ae8:	c3                   	ret
+		panic("MMIO map size is too large, base: %p, size: 0x%x", base, size);
+f0101ae9:	83 ec 0c             	sub    $0xc,%esp
+f0101aec:	53                   	push   %ebx
+f0101aed:	56                   	push   %esi
+f0101aee:	68 60 96 10 f0       	push   $0xf0109660
+f0101af3:	68 b9 02 00 00       	push   $0x2b9
+f0101af8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101afd:	e8 3e e5 ff ff       	call   f0100040 <_panic>
+
+f0101b02 <mem_init>:
+{
+f0101b02:	55                   	push   %ebp
+f0101b03:	89 e5                	mov    %esp,%ebp
+f0101b05:	57                   	push   %edi
+f0101b06:	56                   	push   %esi
+f0101b07:	53                   	push   %ebx
+f0101b08:	83 ec 3c             	sub    $0x3c,%esp
+	basemem = nvram_read(NVRAM_BASELO);
+f0101b0b:	b8 15 00 00 00       	mov    $0x15,%eax
+f0101b10:	e8 d3 f4 ff ff       	call   f0100fe8 <nvram_read>
+f0101b15:	89 c3                	mov    %eax,%ebx
+	extmem = nvram_read(NVRAM_EXTLO);
+f0101b17:	b8 17 00 00 00       	mov    $0x17,%eax
+f0101b1c:	e8 c7 f4 ff ff       	call   f0100fe8 <nvram_read>
+f0101b21:	89 c6                	mov    %eax,%esi
+	ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+f0101b23:	b8 34 00 00 00       	mov    $0x34,%eax
+f0101b28:	e8 bb f4 ff ff       	call   f0100fe8 <nvram_read>
+	if (ext16mem)
+f0101b2d:	c1 e0 06             	shl    $0x6,%eax
+f0101b30:	0f 84 e2 00 00 00    	je     f0101c18 <mem_init+0x116>
+		totalmem = 16 * 1024 + ext16mem;
+f0101b36:	05 00 40 00 00       	add    $0x4000,%eax
+	npages = totalmem / (PGSIZE / 1024);
+f0101b3b:	89 c2                	mov    %eax,%edx
+f0101b3d:	c1 ea 02             	shr    $0x2,%edx
+f0101b40:	89 15 98 62 a4 f0    	mov    %edx,0xf0a46298
+	npages_basemem = basemem / (PGSIZE / 1024);
+f0101b46:	89 da                	mov    %ebx,%edx
+f0101b48:	c1 ea 02             	shr    $0x2,%edx
+f0101b4b:	89 15 44 42 a2 f0    	mov    %edx,0xf0a24244
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101b51:	89 c2                	mov    %eax,%edx
+f0101b53:	29 da                	sub    %ebx,%edx
+f0101b55:	52                   	push   %edx
+f0101b56:	53                   	push   %ebx
+f0101b57:	50                   	push   %eax
+f0101b58:	68 94 96 10 f0       	push   $0xf0109694
+f0101b5d:	e8 1b 28 00 00       	call   f010437d <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0101b62:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101b67:	e8 18 f4 ff ff       	call   f0100f84 <boot_alloc>
+f0101b6c:	a3 9c 62 a4 f0       	mov    %eax,0xf0a4629c
+	memset(kern_pgdir, 0, PGSIZE);
+f0101b71:	83 c4 0c             	add    $0xc,%esp
+f0101b74:	68 00 10 00 00       	push   $0x1000
+f0101b79:	6a 00                	push   $0x0
+f0101b7b:	50                   	push   %eax
+f0101b7c:	e8 c4 54 00 00       	call   f0107045 <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101b81:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101b86:	83 c4 10             	add    $0x10,%esp
+f0101b89:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101b8e:	0f 86 94 00 00 00    	jbe    f0101c28 <mem_init+0x126>
+	return (physaddr_t)kva - KERNBASE;
+f0101b94:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101b9a:	83 ca 05             	or     $0x5,%edx
+f0101b9d:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	pages_size = npages * sizeof(struct PageInfo);
+f0101ba3:	a1 98 62 a4 f0       	mov    0xf0a46298,%eax
+f0101ba8:	8d 3c c5 00 00 00 00 	lea    0x0(,%eax,8),%edi
+f0101baf:	89 7d cc             	mov    %edi,-0x34(%ebp)
+	pages = (struct PageInfo*)boot_alloc(pages_size);
+f0101bb2:	89 f8                	mov    %edi,%eax
+f0101bb4:	e8 cb f3 ff ff       	call   f0100f84 <boot_alloc>
+f0101bb9:	a3 a0 62 a4 f0       	mov    %eax,0xf0a462a0
+	memset(pages, 0, pages_size);
+f0101bbe:	83 ec 04             	sub    $0x4,%esp
+f0101bc1:	57                   	push   %edi
+f0101bc2:	6a 00                	push   $0x0
+f0101bc4:	50                   	push   %eax
+f0101bc5:	e8 7b 54 00 00       	call   f0107045 <memset>
+	envs = boot_alloc(envs_size);
+f0101bca:	b8 00 40 02 00       	mov    $0x24000,%eax
+f0101bcf:	e8 b0 f3 ff ff       	call   f0100f84 <boot_alloc>
+f0101bd4:	a3 48 42 a2 f0       	mov    %eax,0xf0a24248
+	page_init();
+f0101bd9:	e8 8f f7 ff ff       	call   f010136d <page_init>
+{
+	int count = 0;
+	// Move pages with lower addresses first in the free
+	// list, since entry_pgdir does not map all pages.
+	struct PageInfo *pp1, *pp2;
+	struct PageInfo **tp[2] = { &pp1, &pp2 };
+f0101bde:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0101be1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101be4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0101be7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (struct PageInfo* pp = page_free_list; pp; pp = pp->pp_link) {
+f0101bea:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f0101bef:	83 c4 10             	add    $0x10,%esp
+f0101bf2:	85 c0                	test   %eax,%eax
+f0101bf4:	74 47                	je     f0101c3d <mem_init+0x13b>
+	return (pp - pages) << PGSHIFT;
+f0101bf6:	89 c2                	mov    %eax,%edx
+f0101bf8:	2b 15 a0 62 a4 f0    	sub    0xf0a462a0,%edx
+		int pagetype = PDX(page2pa(pp)) >= 1;
+f0101bfe:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f0101c04:	0f 95 c2             	setne  %dl
+f0101c07:	0f b6 d2             	movzbl %dl,%edx
+		*tp[pagetype] = pp;
+f0101c0a:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0101c0e:	89 01                	mov    %eax,(%ecx)
+		tp[pagetype] = &pp->pp_link;
+f0101c10:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+	for (struct PageInfo* pp = page_free_list; pp; pp = pp->pp_link) {
+f0101c14:	8b 00                	mov    (%eax),%eax
+f0101c16:	eb da                	jmp    f0101bf2 <mem_init+0xf0>
+		totalmem = 1 * 1024 + extmem;
+f0101c18:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+f0101c1e:	85 f6                	test   %esi,%esi
+f0101c20:	0f 44 c3             	cmove  %ebx,%eax
+f0101c23:	e9 13 ff ff ff       	jmp    f0101b3b <mem_init+0x39>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101c28:	50                   	push   %eax
+f0101c29:	68 48 8e 10 f0       	push   $0xf0108e48
+f0101c2e:	68 a3 00 00 00       	push   $0xa3
+f0101c33:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101c38:	e8 03 e4 ff ff       	call   f0100040 <_panic>
+		if (!pagetype) {
+			++count;
+		}
+	}
+	log("There're %d free page frames.", count);
+	*tp[1] = 0;
+f0101c3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101c40:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*tp[0] = pp2;
+f0101c46:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0101c49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101c4c:	89 10                	mov    %edx,(%eax)
+	page_free_list = pp1;
+f0101c4e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101c51:	a3 40 42 a2 f0       	mov    %eax,0xf0a24240
+	check_page_free_list(1);
+f0101c56:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101c5b:	e8 14 f4 ff ff       	call   f0101074 <check_page_free_list>
+	if (!pages)
+f0101c60:	83 3d a0 62 a4 f0 00 	cmpl   $0x0,0xf0a462a0
+f0101c67:	74 0c                	je     f0101c75 <mem_init+0x173>
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0101c69:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f0101c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101c73:	eb 1c                	jmp    f0101c91 <mem_init+0x18f>
+		panic("'pages' is a null pointer!");
+f0101c75:	83 ec 04             	sub    $0x4,%esp
+f0101c78:	68 05 a0 10 f0       	push   $0xf010a005
+f0101c7d:	68 85 03 00 00       	push   $0x385
+f0101c82:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101c87:	e8 b4 e3 ff ff       	call   f0100040 <_panic>
+		++nfree;
+f0101c8c:	83 c3 01             	add    $0x1,%ebx
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0101c8f:	8b 00                	mov    (%eax),%eax
+f0101c91:	85 c0                	test   %eax,%eax
+f0101c93:	75 f7                	jne    f0101c8c <mem_init+0x18a>
+	assert((pp0 = page_alloc(0)));
+f0101c95:	83 ec 0c             	sub    $0xc,%esp
+f0101c98:	6a 00                	push   $0x0
+f0101c9a:	e8 8c f8 ff ff       	call   f010152b <page_alloc>
+f0101c9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101ca2:	83 c4 10             	add    $0x10,%esp
+f0101ca5:	85 c0                	test   %eax,%eax
+f0101ca7:	0f 84 fc 01 00 00    	je     f0101ea9 <mem_init+0x3a7>
+	assert((pp1 = page_alloc(0)));
+f0101cad:	83 ec 0c             	sub    $0xc,%esp
+f0101cb0:	6a 00                	push   $0x0
+f0101cb2:	e8 74 f8 ff ff       	call   f010152b <page_alloc>
+f0101cb7:	89 c7                	mov    %eax,%edi
+f0101cb9:	83 c4 10             	add    $0x10,%esp
+f0101cbc:	85 c0                	test   %eax,%eax
+f0101cbe:	0f 84 fe 01 00 00    	je     f0101ec2 <mem_init+0x3c0>
+	assert((pp2 = page_alloc(0)));
+f0101cc4:	83 ec 0c             	sub    $0xc,%esp
+f0101cc7:	6a 00                	push   $0x0
+f0101cc9:	e8 5d f8 ff ff       	call   f010152b <page_alloc>
+f0101cce:	89 c6                	mov    %eax,%esi
+f0101cd0:	83 c4 10             	add    $0x10,%esp
+f0101cd3:	85 c0                	test   %eax,%eax
+f0101cd5:	0f 84 00 02 00 00    	je     f0101edb <mem_init+0x3d9>
+	assert(pp1 && pp1 != pp0);
+f0101cdb:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101cde:	0f 84 10 02 00 00    	je     f0101ef4 <mem_init+0x3f2>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101ce4:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0101ce7:	0f 84 20 02 00 00    	je     f0101f0d <mem_init+0x40b>
+f0101ced:	39 c7                	cmp    %eax,%edi
+f0101cef:	0f 84 18 02 00 00    	je     f0101f0d <mem_init+0x40b>
+	return (pp - pages) << PGSHIFT;
+f0101cf5:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0101cfb:	a1 98 62 a4 f0       	mov    0xf0a46298,%eax
+f0101d00:	c1 e0 0c             	shl    $0xc,%eax
+f0101d03:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0101d06:	29 ca                	sub    %ecx,%edx
+f0101d08:	c1 fa 03             	sar    $0x3,%edx
+f0101d0b:	c1 e2 0c             	shl    $0xc,%edx
+f0101d0e:	39 c2                	cmp    %eax,%edx
+f0101d10:	0f 83 10 02 00 00    	jae    f0101f26 <mem_init+0x424>
+f0101d16:	89 fa                	mov    %edi,%edx
+f0101d18:	29 ca                	sub    %ecx,%edx
+f0101d1a:	c1 fa 03             	sar    $0x3,%edx
+f0101d1d:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0101d20:	39 c2                	cmp    %eax,%edx
+f0101d22:	0f 83 17 02 00 00    	jae    f0101f3f <mem_init+0x43d>
+f0101d28:	89 f2                	mov    %esi,%edx
+f0101d2a:	29 ca                	sub    %ecx,%edx
+f0101d2c:	c1 fa 03             	sar    $0x3,%edx
+f0101d2f:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0101d32:	39 c2                	cmp    %eax,%edx
+f0101d34:	0f 83 1e 02 00 00    	jae    f0101f58 <mem_init+0x456>
+	fl = page_free_list;
+f0101d3a:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f0101d3f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	page_free_list = 0;
+f0101d42:	c7 05 40 42 a2 f0 00 	movl   $0x0,0xf0a24240
+f0101d49:	00 00 00 
+	assert(!page_alloc(0));
+f0101d4c:	83 ec 0c             	sub    $0xc,%esp
+f0101d4f:	6a 00                	push   $0x0
+f0101d51:	e8 d5 f7 ff ff       	call   f010152b <page_alloc>
+f0101d56:	83 c4 10             	add    $0x10,%esp
+f0101d59:	85 c0                	test   %eax,%eax
+f0101d5b:	0f 85 10 02 00 00    	jne    f0101f71 <mem_init+0x46f>
+	page_free(pp0);
+f0101d61:	83 ec 0c             	sub    $0xc,%esp
+f0101d64:	ff 75 d4             	push   -0x2c(%ebp)
+f0101d67:	e8 3a f8 ff ff       	call   f01015a6 <page_free>
+	page_free(pp1);
+f0101d6c:	89 3c 24             	mov    %edi,(%esp)
+f0101d6f:	e8 32 f8 ff ff       	call   f01015a6 <page_free>
+	page_free(pp2);
+f0101d74:	89 34 24             	mov    %esi,(%esp)
+f0101d77:	e8 2a f8 ff ff       	call   f01015a6 <page_free>
+	assert((pp0 = page_alloc(0)));
+f0101d7c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0101d83:	e8 a3 f7 ff ff       	call   f010152b <page_alloc>
+f0101d88:	89 c6                	mov    %eax,%esi
+f0101d8a:	83 c4 10             	add    $0x10,%esp
+f0101d8d:	85 c0                	test   %eax,%eax
+f0101d8f:	0f 84 f5 01 00 00    	je     f0101f8a <mem_init+0x488>
+	assert((pp1 = page_alloc(0)));
+f0101d95:	83 ec 0c             	sub    $0xc,%esp
+f0101d98:	6a 00                	push   $0x0
+f0101d9a:	e8 8c f7 ff ff       	call   f010152b <page_alloc>
+f0101d9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101da2:	83 c4 10             	add    $0x10,%esp
+f0101da5:	85 c0                	test   %eax,%eax
+f0101da7:	0f 84 f6 01 00 00    	je     f0101fa3 <mem_init+0x4a1>
+	assert((pp2 = page_alloc(0)));
+f0101dad:	83 ec 0c             	sub    $0xc,%esp
+f0101db0:	6a 00                	push   $0x0
+f0101db2:	e8 74 f7 ff ff       	call   f010152b <page_alloc>
+f0101db7:	89 c7                	mov    %eax,%edi
+f0101db9:	83 c4 10             	add    $0x10,%esp
+f0101dbc:	85 c0                	test   %eax,%eax
+f0101dbe:	0f 84 f8 01 00 00    	je     f0101fbc <mem_init+0x4ba>
+	assert(pp1 && pp1 != pp0);
+f0101dc4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101dc7:	39 c6                	cmp    %eax,%esi
+f0101dc9:	0f 84 06 02 00 00    	je     f0101fd5 <mem_init+0x4d3>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101dcf:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101dd2:	0f 84 16 02 00 00    	je     f0101fee <mem_init+0x4ec>
+f0101dd8:	39 fe                	cmp    %edi,%esi
+f0101dda:	0f 84 0e 02 00 00    	je     f0101fee <mem_init+0x4ec>
+	assert(!page_alloc(0));
+f0101de0:	83 ec 0c             	sub    $0xc,%esp
+f0101de3:	6a 00                	push   $0x0
+f0101de5:	e8 41 f7 ff ff       	call   f010152b <page_alloc>
+f0101dea:	83 c4 10             	add    $0x10,%esp
+f0101ded:	85 c0                	test   %eax,%eax
+f0101def:	0f 85 12 02 00 00    	jne    f0102007 <mem_init+0x505>
+f0101df5:	89 f0                	mov    %esi,%eax
+f0101df7:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0101dfd:	c1 f8 03             	sar    $0x3,%eax
+f0101e00:	89 c2                	mov    %eax,%edx
+f0101e02:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101e05:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101e0a:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101e10:	0f 83 0a 02 00 00    	jae    f0102020 <mem_init+0x51e>
+	memset(page2kva(pp0), 1, PGSIZE);
+f0101e16:	83 ec 04             	sub    $0x4,%esp
+f0101e19:	68 00 10 00 00       	push   $0x1000
+f0101e1e:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0101e20:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101e26:	52                   	push   %edx
+f0101e27:	e8 19 52 00 00       	call   f0107045 <memset>
+	page_free(pp0);
+f0101e2c:	89 34 24             	mov    %esi,(%esp)
+f0101e2f:	e8 72 f7 ff ff       	call   f01015a6 <page_free>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f0101e34:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0101e3b:	e8 eb f6 ff ff       	call   f010152b <page_alloc>
+f0101e40:	83 c4 10             	add    $0x10,%esp
+f0101e43:	85 c0                	test   %eax,%eax
+f0101e45:	0f 84 e7 01 00 00    	je     f0102032 <mem_init+0x530>
+	assert(pp && pp0 == pp);
+f0101e4b:	39 c6                	cmp    %eax,%esi
+f0101e4d:	0f 85 f8 01 00 00    	jne    f010204b <mem_init+0x549>
+	return (pp - pages) << PGSHIFT;
+f0101e53:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0101e59:	c1 f8 03             	sar    $0x3,%eax
+f0101e5c:	89 c1                	mov    %eax,%ecx
+f0101e5e:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101e61:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101e66:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0101e6c:	0f 83 f2 01 00 00    	jae    f0102064 <mem_init+0x562>
+	return (void *)(pa + KERNBASE);
+f0101e72:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	for (i = 0; i < PGSIZE; i++)
+f0101e78:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0101e7e:	39 c8                	cmp    %ecx,%eax
+f0101e80:	0f 84 f0 01 00 00    	je     f0102076 <mem_init+0x574>
+		assert(c[i] == 0);
+f0101e86:	0f b6 10             	movzbl (%eax),%edx
+f0101e89:	83 c0 01             	add    $0x1,%eax
+f0101e8c:	84 d2                	test   %dl,%dl
+f0101e8e:	74 ee                	je     f0101e7e <mem_init+0x37c>
+f0101e90:	68 08 a1 10 f0       	push   $0xf010a108
+f0101e95:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101e9a:	68 b3 03 00 00       	push   $0x3b3
+f0101e9f:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101ea4:	e8 97 e1 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0101ea9:	68 20 a0 10 f0       	push   $0xf010a020
+f0101eae:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101eb3:	68 8d 03 00 00       	push   $0x38d
+f0101eb8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101ebd:	e8 7e e1 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0101ec2:	68 36 a0 10 f0       	push   $0xf010a036
+f0101ec7:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101ecc:	68 8e 03 00 00       	push   $0x38e
+f0101ed1:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101ed6:	e8 65 e1 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0101edb:	68 4c a0 10 f0       	push   $0xf010a04c
+f0101ee0:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101ee5:	68 8f 03 00 00       	push   $0x38f
+f0101eea:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101eef:	e8 4c e1 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0101ef4:	68 62 a0 10 f0       	push   $0xf010a062
+f0101ef9:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101efe:	68 92 03 00 00       	push   $0x392
+f0101f03:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f08:	e8 33 e1 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101f0d:	68 d0 96 10 f0       	push   $0xf01096d0
+f0101f12:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f17:	68 93 03 00 00       	push   $0x393
+f0101f1c:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f21:	e8 1a e1 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0101f26:	68 74 a0 10 f0       	push   $0xf010a074
+f0101f2b:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f30:	68 94 03 00 00       	push   $0x394
+f0101f35:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f3a:	e8 01 e1 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0101f3f:	68 91 a0 10 f0       	push   $0xf010a091
+f0101f44:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f49:	68 95 03 00 00       	push   $0x395
+f0101f4e:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f53:	e8 e8 e0 ff ff       	call   f0100040 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0101f58:	68 ae a0 10 f0       	push   $0xf010a0ae
+f0101f5d:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f62:	68 96 03 00 00       	push   $0x396
+f0101f67:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f6c:	e8 cf e0 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0101f71:	68 cb a0 10 f0       	push   $0xf010a0cb
+f0101f76:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f7b:	68 9d 03 00 00       	push   $0x39d
+f0101f80:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f85:	e8 b6 e0 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0101f8a:	68 20 a0 10 f0       	push   $0xf010a020
+f0101f8f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101f94:	68 a4 03 00 00       	push   $0x3a4
+f0101f99:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101f9e:	e8 9d e0 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0101fa3:	68 36 a0 10 f0       	push   $0xf010a036
+f0101fa8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101fad:	68 a5 03 00 00       	push   $0x3a5
+f0101fb2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101fb7:	e8 84 e0 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0101fbc:	68 4c a0 10 f0       	push   $0xf010a04c
+f0101fc1:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101fc6:	68 a6 03 00 00       	push   $0x3a6
+f0101fcb:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101fd0:	e8 6b e0 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0101fd5:	68 62 a0 10 f0       	push   $0xf010a062
+f0101fda:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101fdf:	68 a8 03 00 00       	push   $0x3a8
+f0101fe4:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0101fe9:	e8 52 e0 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101fee:	68 d0 96 10 f0       	push   $0xf01096d0
+f0101ff3:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0101ff8:	68 a9 03 00 00       	push   $0x3a9
+f0101ffd:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102002:	e8 39 e0 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102007:	68 cb a0 10 f0       	push   $0xf010a0cb
+f010200c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102011:	68 aa 03 00 00       	push   $0x3aa
+f0102016:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010201b:	e8 20 e0 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102020:	52                   	push   %edx
+f0102021:	68 24 8e 10 f0       	push   $0xf0108e24
+f0102026:	6a 5b                	push   $0x5b
+f0102028:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f010202d:	e8 0e e0 ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f0102032:	68 da a0 10 f0       	push   $0xf010a0da
+f0102037:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010203c:	68 af 03 00 00       	push   $0x3af
+f0102041:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102046:	e8 f5 df ff ff       	call   f0100040 <_panic>
+	assert(pp && pp0 == pp);
+f010204b:	68 f8 a0 10 f0       	push   $0xf010a0f8
+f0102050:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102055:	68 b0 03 00 00       	push   $0x3b0
+f010205a:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010205f:	e8 dc df ff ff       	call   f0100040 <_panic>
+f0102064:	51                   	push   %ecx
+f0102065:	68 24 8e 10 f0       	push   $0xf0108e24
+f010206a:	6a 5b                	push   $0x5b
+f010206c:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0102071:	e8 ca df ff ff       	call   f0100040 <_panic>
+	page_free_list = fl;
+f0102076:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102079:	a3 40 42 a2 f0       	mov    %eax,0xf0a24240
+	page_free(pp0);
+f010207e:	83 ec 0c             	sub    $0xc,%esp
+f0102081:	56                   	push   %esi
+f0102082:	e8 1f f5 ff ff       	call   f01015a6 <page_free>
+	page_free(pp1);
+f0102087:	83 c4 04             	add    $0x4,%esp
+f010208a:	ff 75 d4             	push   -0x2c(%ebp)
+f010208d:	e8 14 f5 ff ff       	call   f01015a6 <page_free>
+	page_free(pp2);
+f0102092:	89 3c 24             	mov    %edi,(%esp)
+f0102095:	e8 0c f5 ff ff       	call   f01015a6 <page_free>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f010209a:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f010209f:	83 c4 10             	add    $0x10,%esp
+f01020a2:	85 c0                	test   %eax,%eax
+f01020a4:	74 07                	je     f01020ad <mem_init+0x5ab>
+		--nfree;
+f01020a6:	83 eb 01             	sub    $0x1,%ebx
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f01020a9:	8b 00                	mov    (%eax),%eax
+f01020ab:	eb f5                	jmp    f01020a2 <mem_init+0x5a0>
+	assert(nfree == 0);
+f01020ad:	85 db                	test   %ebx,%ebx
+f01020af:	0f 85 7e 06 00 00    	jne    f0102733 <mem_init+0xc31>
+	cprintf("check_page_alloc() succeeded!\n");
+f01020b5:	83 ec 0c             	sub    $0xc,%esp
+f01020b8:	68 f0 96 10 f0       	push   $0xf01096f0
+f01020bd:	e8 bb 22 00 00       	call   f010437d <cprintf>
+	assert((pp0 = page_alloc(0)));
+f01020c2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f01020c9:	e8 5d f4 ff ff       	call   f010152b <page_alloc>
+f01020ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01020d1:	83 c4 10             	add    $0x10,%esp
+f01020d4:	85 c0                	test   %eax,%eax
+f01020d6:	0f 84 70 06 00 00    	je     f010274c <mem_init+0xc4a>
+	assert((pp1 = page_alloc(0)));
+f01020dc:	83 ec 0c             	sub    $0xc,%esp
+f01020df:	6a 00                	push   $0x0
+f01020e1:	e8 45 f4 ff ff       	call   f010152b <page_alloc>
+f01020e6:	89 c7                	mov    %eax,%edi
+f01020e8:	83 c4 10             	add    $0x10,%esp
+f01020eb:	85 c0                	test   %eax,%eax
+f01020ed:	0f 84 72 06 00 00    	je     f0102765 <mem_init+0xc63>
+	assert((pp2 = page_alloc(0)));
+f01020f3:	83 ec 0c             	sub    $0xc,%esp
+f01020f6:	6a 00                	push   $0x0
+f01020f8:	e8 2e f4 ff ff       	call   f010152b <page_alloc>
+f01020fd:	89 c3                	mov    %eax,%ebx
+f01020ff:	83 c4 10             	add    $0x10,%esp
+f0102102:	85 c0                	test   %eax,%eax
+f0102104:	0f 84 74 06 00 00    	je     f010277e <mem_init+0xc7c>
+	assert(pp1 && pp1 != pp0);
+f010210a:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010210d:	0f 84 84 06 00 00    	je     f0102797 <mem_init+0xc95>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102113:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0102116:	0f 84 94 06 00 00    	je     f01027b0 <mem_init+0xcae>
+f010211c:	39 c7                	cmp    %eax,%edi
+f010211e:	0f 84 8c 06 00 00    	je     f01027b0 <mem_init+0xcae>
+	fl = page_free_list;
+f0102124:	a1 40 42 a2 f0       	mov    0xf0a24240,%eax
+f0102129:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	page_free_list = 0;
+f010212c:	c7 05 40 42 a2 f0 00 	movl   $0x0,0xf0a24240
+f0102133:	00 00 00 
+	assert(!page_alloc(0));
+f0102136:	83 ec 0c             	sub    $0xc,%esp
+f0102139:	6a 00                	push   $0x0
+f010213b:	e8 eb f3 ff ff       	call   f010152b <page_alloc>
+f0102140:	83 c4 10             	add    $0x10,%esp
+f0102143:	85 c0                	test   %eax,%eax
+f0102145:	0f 85 7e 06 00 00    	jne    f01027c9 <mem_init+0xcc7>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f010214b:	83 ec 04             	sub    $0x4,%esp
+f010214e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0102151:	50                   	push   %eax
+f0102152:	6a 00                	push   $0x0
+f0102154:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010215a:	e8 84 f6 ff ff       	call   f01017e3 <page_lookup>
+f010215f:	83 c4 10             	add    $0x10,%esp
+f0102162:	85 c0                	test   %eax,%eax
+f0102164:	0f 85 78 06 00 00    	jne    f01027e2 <mem_init+0xce0>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f010216a:	6a 02                	push   $0x2
+f010216c:	6a 00                	push   $0x0
+f010216e:	57                   	push   %edi
+f010216f:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102175:	e8 95 f8 ff ff       	call   f0101a0f <page_insert>
+f010217a:	83 c4 10             	add    $0x10,%esp
+f010217d:	85 c0                	test   %eax,%eax
+f010217f:	0f 89 76 06 00 00    	jns    f01027fb <mem_init+0xcf9>
+	page_free(pp0);
+f0102185:	83 ec 0c             	sub    $0xc,%esp
+f0102188:	ff 75 d4             	push   -0x2c(%ebp)
+f010218b:	e8 16 f4 ff ff       	call   f01015a6 <page_free>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102190:	6a 02                	push   $0x2
+f0102192:	6a 00                	push   $0x0
+f0102194:	57                   	push   %edi
+f0102195:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010219b:	e8 6f f8 ff ff       	call   f0101a0f <page_insert>
+f01021a0:	83 c4 20             	add    $0x20,%esp
+f01021a3:	85 c0                	test   %eax,%eax
+f01021a5:	0f 85 69 06 00 00    	jne    f0102814 <mem_init+0xd12>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01021ab:	8b 35 9c 62 a4 f0    	mov    0xf0a4629c,%esi
+	return (pp - pages) << PGSHIFT;
+f01021b1:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+f01021b7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f01021ba:	8b 16                	mov    (%esi),%edx
+f01021bc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01021c2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01021c5:	29 c8                	sub    %ecx,%eax
+f01021c7:	c1 f8 03             	sar    $0x3,%eax
+f01021ca:	c1 e0 0c             	shl    $0xc,%eax
+f01021cd:	39 c2                	cmp    %eax,%edx
+f01021cf:	0f 85 58 06 00 00    	jne    f010282d <mem_init+0xd2b>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f01021d5:	ba 00 00 00 00       	mov    $0x0,%edx
+f01021da:	89 f0                	mov    %esi,%eax
+f01021dc:	e8 30 ee ff ff       	call   f0101011 <check_va2pa>
+f01021e1:	89 c2                	mov    %eax,%edx
+f01021e3:	89 f8                	mov    %edi,%eax
+f01021e5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f01021e8:	29 c8                	sub    %ecx,%eax
+f01021ea:	c1 f8 03             	sar    $0x3,%eax
+f01021ed:	c1 e0 0c             	shl    $0xc,%eax
+f01021f0:	39 c2                	cmp    %eax,%edx
+f01021f2:	0f 85 4e 06 00 00    	jne    f0102846 <mem_init+0xd44>
+	assert(pp1->pp_ref == 1);
+f01021f8:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f01021fd:	0f 85 5c 06 00 00    	jne    f010285f <mem_init+0xd5d>
+	assert(pp0->pp_ref == 1);
+f0102203:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102206:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010220b:	0f 85 67 06 00 00    	jne    f0102878 <mem_init+0xd76>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102211:	6a 02                	push   $0x2
+f0102213:	68 00 10 00 00       	push   $0x1000
+f0102218:	53                   	push   %ebx
+f0102219:	56                   	push   %esi
+f010221a:	e8 f0 f7 ff ff       	call   f0101a0f <page_insert>
+f010221f:	83 c4 10             	add    $0x10,%esp
+f0102222:	85 c0                	test   %eax,%eax
+f0102224:	0f 85 67 06 00 00    	jne    f0102891 <mem_init+0xd8f>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010222a:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010222f:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102234:	e8 d8 ed ff ff       	call   f0101011 <check_va2pa>
+f0102239:	89 c2                	mov    %eax,%edx
+f010223b:	89 d8                	mov    %ebx,%eax
+f010223d:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0102243:	c1 f8 03             	sar    $0x3,%eax
+f0102246:	c1 e0 0c             	shl    $0xc,%eax
+f0102249:	39 c2                	cmp    %eax,%edx
+f010224b:	0f 85 59 06 00 00    	jne    f01028aa <mem_init+0xda8>
+	assert(pp2->pp_ref == 1);
+f0102251:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102256:	0f 85 67 06 00 00    	jne    f01028c3 <mem_init+0xdc1>
+	assert(!page_alloc(0));
+f010225c:	83 ec 0c             	sub    $0xc,%esp
+f010225f:	6a 00                	push   $0x0
+f0102261:	e8 c5 f2 ff ff       	call   f010152b <page_alloc>
+f0102266:	83 c4 10             	add    $0x10,%esp
+f0102269:	85 c0                	test   %eax,%eax
+f010226b:	0f 85 6b 06 00 00    	jne    f01028dc <mem_init+0xdda>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102271:	6a 02                	push   $0x2
+f0102273:	68 00 10 00 00       	push   $0x1000
+f0102278:	53                   	push   %ebx
+f0102279:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010227f:	e8 8b f7 ff ff       	call   f0101a0f <page_insert>
+f0102284:	83 c4 10             	add    $0x10,%esp
+f0102287:	85 c0                	test   %eax,%eax
+f0102289:	0f 85 66 06 00 00    	jne    f01028f5 <mem_init+0xdf3>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010228f:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102294:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102299:	e8 73 ed ff ff       	call   f0101011 <check_va2pa>
+f010229e:	89 c2                	mov    %eax,%edx
+f01022a0:	89 d8                	mov    %ebx,%eax
+f01022a2:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f01022a8:	c1 f8 03             	sar    $0x3,%eax
+f01022ab:	c1 e0 0c             	shl    $0xc,%eax
+f01022ae:	39 c2                	cmp    %eax,%edx
+f01022b0:	0f 85 58 06 00 00    	jne    f010290e <mem_init+0xe0c>
+	assert(pp2->pp_ref == 1);
+f01022b6:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01022bb:	0f 85 66 06 00 00    	jne    f0102927 <mem_init+0xe25>
+	assert(!page_alloc(0));
+f01022c1:	83 ec 0c             	sub    $0xc,%esp
+f01022c4:	6a 00                	push   $0x0
+f01022c6:	e8 60 f2 ff ff       	call   f010152b <page_alloc>
+f01022cb:	83 c4 10             	add    $0x10,%esp
+f01022ce:	85 c0                	test   %eax,%eax
+f01022d0:	0f 85 6a 06 00 00    	jne    f0102940 <mem_init+0xe3e>
+	ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f01022d6:	8b 15 9c 62 a4 f0    	mov    0xf0a4629c,%edx
+f01022dc:	8b 02                	mov    (%edx),%eax
+f01022de:	89 c6                	mov    %eax,%esi
+f01022e0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f01022e6:	c1 e8 0c             	shr    $0xc,%eax
+f01022e9:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01022ef:	0f 83 64 06 00 00    	jae    f0102959 <mem_init+0xe57>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f01022f5:	83 ec 04             	sub    $0x4,%esp
+f01022f8:	6a 00                	push   $0x0
+f01022fa:	68 00 10 00 00       	push   $0x1000
+f01022ff:	52                   	push   %edx
+f0102300:	e8 02 f3 ff ff       	call   f0101607 <pgdir_walk>
+f0102305:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f010230b:	83 c4 10             	add    $0x10,%esp
+f010230e:	39 f0                	cmp    %esi,%eax
+f0102310:	0f 85 58 06 00 00    	jne    f010296e <mem_init+0xe6c>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0102316:	6a 06                	push   $0x6
+f0102318:	68 00 10 00 00       	push   $0x1000
+f010231d:	53                   	push   %ebx
+f010231e:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102324:	e8 e6 f6 ff ff       	call   f0101a0f <page_insert>
+f0102329:	83 c4 10             	add    $0x10,%esp
+f010232c:	85 c0                	test   %eax,%eax
+f010232e:	0f 85 53 06 00 00    	jne    f0102987 <mem_init+0xe85>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102334:	8b 35 9c 62 a4 f0    	mov    0xf0a4629c,%esi
+f010233a:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010233f:	89 f0                	mov    %esi,%eax
+f0102341:	e8 cb ec ff ff       	call   f0101011 <check_va2pa>
+f0102346:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f0102348:	89 d8                	mov    %ebx,%eax
+f010234a:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0102350:	c1 f8 03             	sar    $0x3,%eax
+f0102353:	c1 e0 0c             	shl    $0xc,%eax
+f0102356:	39 c2                	cmp    %eax,%edx
+f0102358:	0f 85 42 06 00 00    	jne    f01029a0 <mem_init+0xe9e>
+	assert(pp2->pp_ref == 1);
+f010235e:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102363:	0f 85 50 06 00 00    	jne    f01029b9 <mem_init+0xeb7>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f0102369:	83 ec 04             	sub    $0x4,%esp
+f010236c:	6a 00                	push   $0x0
+f010236e:	68 00 10 00 00       	push   $0x1000
+f0102373:	56                   	push   %esi
+f0102374:	e8 8e f2 ff ff       	call   f0101607 <pgdir_walk>
+f0102379:	83 c4 10             	add    $0x10,%esp
+f010237c:	f6 00 04             	testb  $0x4,(%eax)
+f010237f:	0f 84 4d 06 00 00    	je     f01029d2 <mem_init+0xed0>
+	assert(kern_pgdir[0] & PTE_U);
+f0102385:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f010238a:	f6 00 04             	testb  $0x4,(%eax)
+f010238d:	0f 84 58 06 00 00    	je     f01029eb <mem_init+0xee9>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102393:	6a 02                	push   $0x2
+f0102395:	68 00 10 00 00       	push   $0x1000
+f010239a:	53                   	push   %ebx
+f010239b:	50                   	push   %eax
+f010239c:	e8 6e f6 ff ff       	call   f0101a0f <page_insert>
+f01023a1:	83 c4 10             	add    $0x10,%esp
+f01023a4:	85 c0                	test   %eax,%eax
+f01023a6:	0f 85 58 06 00 00    	jne    f0102a04 <mem_init+0xf02>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f01023ac:	83 ec 04             	sub    $0x4,%esp
+f01023af:	6a 00                	push   $0x0
+f01023b1:	68 00 10 00 00       	push   $0x1000
+f01023b6:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01023bc:	e8 46 f2 ff ff       	call   f0101607 <pgdir_walk>
+f01023c1:	83 c4 10             	add    $0x10,%esp
+f01023c4:	f6 00 02             	testb  $0x2,(%eax)
+f01023c7:	0f 84 50 06 00 00    	je     f0102a1d <mem_init+0xf1b>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f01023cd:	83 ec 04             	sub    $0x4,%esp
+f01023d0:	6a 00                	push   $0x0
+f01023d2:	68 00 10 00 00       	push   $0x1000
+f01023d7:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01023dd:	e8 25 f2 ff ff       	call   f0101607 <pgdir_walk>
+f01023e2:	83 c4 10             	add    $0x10,%esp
+f01023e5:	f6 00 04             	testb  $0x4,(%eax)
+f01023e8:	0f 85 48 06 00 00    	jne    f0102a36 <mem_init+0xf34>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f01023ee:	6a 02                	push   $0x2
+f01023f0:	68 00 00 40 00       	push   $0x400000
+f01023f5:	ff 75 d4             	push   -0x2c(%ebp)
+f01023f8:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01023fe:	e8 0c f6 ff ff       	call   f0101a0f <page_insert>
+f0102403:	83 c4 10             	add    $0x10,%esp
+f0102406:	85 c0                	test   %eax,%eax
+f0102408:	0f 89 41 06 00 00    	jns    f0102a4f <mem_init+0xf4d>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f010240e:	6a 02                	push   $0x2
+f0102410:	68 00 10 00 00       	push   $0x1000
+f0102415:	57                   	push   %edi
+f0102416:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010241c:	e8 ee f5 ff ff       	call   f0101a0f <page_insert>
+f0102421:	83 c4 10             	add    $0x10,%esp
+f0102424:	85 c0                	test   %eax,%eax
+f0102426:	0f 85 3c 06 00 00    	jne    f0102a68 <mem_init+0xf66>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f010242c:	83 ec 04             	sub    $0x4,%esp
+f010242f:	6a 00                	push   $0x0
+f0102431:	68 00 10 00 00       	push   $0x1000
+f0102436:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010243c:	e8 c6 f1 ff ff       	call   f0101607 <pgdir_walk>
+f0102441:	83 c4 10             	add    $0x10,%esp
+f0102444:	f6 00 04             	testb  $0x4,(%eax)
+f0102447:	0f 85 34 06 00 00    	jne    f0102a81 <mem_init+0xf7f>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f010244d:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102452:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0102455:	ba 00 00 00 00       	mov    $0x0,%edx
+f010245a:	e8 b2 eb ff ff       	call   f0101011 <check_va2pa>
+f010245f:	89 fe                	mov    %edi,%esi
+f0102461:	2b 35 a0 62 a4 f0    	sub    0xf0a462a0,%esi
+f0102467:	c1 fe 03             	sar    $0x3,%esi
+f010246a:	c1 e6 0c             	shl    $0xc,%esi
+f010246d:	39 f0                	cmp    %esi,%eax
+f010246f:	0f 85 25 06 00 00    	jne    f0102a9a <mem_init+0xf98>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102475:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010247a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010247d:	e8 8f eb ff ff       	call   f0101011 <check_va2pa>
+f0102482:	39 c6                	cmp    %eax,%esi
+f0102484:	0f 85 29 06 00 00    	jne    f0102ab3 <mem_init+0xfb1>
+	assert(pp1->pp_ref == 2);
+f010248a:	66 83 7f 04 02       	cmpw   $0x2,0x4(%edi)
+f010248f:	0f 85 37 06 00 00    	jne    f0102acc <mem_init+0xfca>
+	assert(pp2->pp_ref == 0);
+f0102495:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f010249a:	0f 85 45 06 00 00    	jne    f0102ae5 <mem_init+0xfe3>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f01024a0:	83 ec 0c             	sub    $0xc,%esp
+f01024a3:	6a 00                	push   $0x0
+f01024a5:	e8 81 f0 ff ff       	call   f010152b <page_alloc>
+f01024aa:	83 c4 10             	add    $0x10,%esp
+f01024ad:	85 c0                	test   %eax,%eax
+f01024af:	0f 84 49 06 00 00    	je     f0102afe <mem_init+0xffc>
+f01024b5:	39 c3                	cmp    %eax,%ebx
+f01024b7:	0f 85 41 06 00 00    	jne    f0102afe <mem_init+0xffc>
+	page_remove(kern_pgdir, 0x0);
+f01024bd:	83 ec 08             	sub    $0x8,%esp
+f01024c0:	6a 00                	push   $0x0
+f01024c2:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01024c8:	e8 d0 f4 ff ff       	call   f010199d <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01024cd:	8b 35 9c 62 a4 f0    	mov    0xf0a4629c,%esi
+f01024d3:	ba 00 00 00 00       	mov    $0x0,%edx
+f01024d8:	89 f0                	mov    %esi,%eax
+f01024da:	e8 32 eb ff ff       	call   f0101011 <check_va2pa>
+f01024df:	83 c4 10             	add    $0x10,%esp
+f01024e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01024e5:	0f 85 2c 06 00 00    	jne    f0102b17 <mem_init+0x1015>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01024eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01024f0:	89 f0                	mov    %esi,%eax
+f01024f2:	e8 1a eb ff ff       	call   f0101011 <check_va2pa>
+f01024f7:	89 c2                	mov    %eax,%edx
+f01024f9:	89 f8                	mov    %edi,%eax
+f01024fb:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0102501:	c1 f8 03             	sar    $0x3,%eax
+f0102504:	c1 e0 0c             	shl    $0xc,%eax
+f0102507:	39 c2                	cmp    %eax,%edx
+f0102509:	0f 85 21 06 00 00    	jne    f0102b30 <mem_init+0x102e>
+	assert(pp1->pp_ref == 1);
+f010250f:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102514:	0f 85 2f 06 00 00    	jne    f0102b49 <mem_init+0x1047>
+	assert(pp2->pp_ref == 0);
+f010251a:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f010251f:	0f 85 3d 06 00 00    	jne    f0102b62 <mem_init+0x1060>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0102525:	6a 00                	push   $0x0
+f0102527:	68 00 10 00 00       	push   $0x1000
+f010252c:	57                   	push   %edi
+f010252d:	56                   	push   %esi
+f010252e:	e8 dc f4 ff ff       	call   f0101a0f <page_insert>
+f0102533:	83 c4 10             	add    $0x10,%esp
+f0102536:	85 c0                	test   %eax,%eax
+f0102538:	0f 85 3d 06 00 00    	jne    f0102b7b <mem_init+0x1079>
+	assert(pp1->pp_ref);
+f010253e:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102543:	0f 84 4b 06 00 00    	je     f0102b94 <mem_init+0x1092>
+	assert(pp1->pp_link == NULL);
+f0102549:	83 3f 00             	cmpl   $0x0,(%edi)
+f010254c:	0f 85 5b 06 00 00    	jne    f0102bad <mem_init+0x10ab>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0102552:	83 ec 08             	sub    $0x8,%esp
+f0102555:	68 00 10 00 00       	push   $0x1000
+f010255a:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102560:	e8 38 f4 ff ff       	call   f010199d <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102565:	8b 35 9c 62 a4 f0    	mov    0xf0a4629c,%esi
+f010256b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102570:	89 f0                	mov    %esi,%eax
+f0102572:	e8 9a ea ff ff       	call   f0101011 <check_va2pa>
+f0102577:	83 c4 10             	add    $0x10,%esp
+f010257a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010257d:	0f 85 43 06 00 00    	jne    f0102bc6 <mem_init+0x10c4>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102583:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102588:	89 f0                	mov    %esi,%eax
+f010258a:	e8 82 ea ff ff       	call   f0101011 <check_va2pa>
+f010258f:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102592:	0f 85 47 06 00 00    	jne    f0102bdf <mem_init+0x10dd>
+	assert(pp1->pp_ref == 0);
+f0102598:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f010259d:	0f 85 55 06 00 00    	jne    f0102bf8 <mem_init+0x10f6>
+	assert(pp2->pp_ref == 0);
+f01025a3:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f01025a8:	0f 85 63 06 00 00    	jne    f0102c11 <mem_init+0x110f>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f01025ae:	83 ec 0c             	sub    $0xc,%esp
+f01025b1:	6a 00                	push   $0x0
+f01025b3:	e8 73 ef ff ff       	call   f010152b <page_alloc>
+f01025b8:	83 c4 10             	add    $0x10,%esp
+f01025bb:	39 c7                	cmp    %eax,%edi
+f01025bd:	0f 85 67 06 00 00    	jne    f0102c2a <mem_init+0x1128>
+f01025c3:	85 c0                	test   %eax,%eax
+f01025c5:	0f 84 5f 06 00 00    	je     f0102c2a <mem_init+0x1128>
+	assert(!page_alloc(0));
+f01025cb:	83 ec 0c             	sub    $0xc,%esp
+f01025ce:	6a 00                	push   $0x0
+f01025d0:	e8 56 ef ff ff       	call   f010152b <page_alloc>
+f01025d5:	83 c4 10             	add    $0x10,%esp
+f01025d8:	85 c0                	test   %eax,%eax
+f01025da:	0f 85 63 06 00 00    	jne    f0102c43 <mem_init+0x1141>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01025e0:	8b 0d 9c 62 a4 f0    	mov    0xf0a4629c,%ecx
+f01025e6:	8b 11                	mov    (%ecx),%edx
+f01025e8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01025ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01025f1:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f01025f7:	c1 f8 03             	sar    $0x3,%eax
+f01025fa:	c1 e0 0c             	shl    $0xc,%eax
+f01025fd:	39 c2                	cmp    %eax,%edx
+f01025ff:	0f 85 57 06 00 00    	jne    f0102c5c <mem_init+0x115a>
+	kern_pgdir[0] = 0;
+f0102605:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f010260b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010260e:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102613:	0f 85 5c 06 00 00    	jne    f0102c75 <mem_init+0x1173>
+	pp0->pp_ref = 0;
+f0102619:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010261c:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	page_free(pp0);
+f0102622:	83 ec 0c             	sub    $0xc,%esp
+f0102625:	50                   	push   %eax
+f0102626:	e8 7b ef ff ff       	call   f01015a6 <page_free>
+	ptep = pgdir_walk(kern_pgdir, va, 1);
+f010262b:	83 c4 0c             	add    $0xc,%esp
+f010262e:	6a 01                	push   $0x1
+f0102630:	68 00 10 40 00       	push   $0x401000
+f0102635:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010263b:	e8 c7 ef ff ff       	call   f0101607 <pgdir_walk>
+f0102640:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f0102643:	8b 35 9c 62 a4 f0    	mov    0xf0a4629c,%esi
+f0102649:	8b 46 04             	mov    0x4(%esi),%eax
+f010264c:	89 c2                	mov    %eax,%edx
+f010264e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f0102654:	8b 0d 98 62 a4 f0    	mov    0xf0a46298,%ecx
+f010265a:	c1 e8 0c             	shr    $0xc,%eax
+f010265d:	83 c4 10             	add    $0x10,%esp
+f0102660:	39 c8                	cmp    %ecx,%eax
+f0102662:	0f 83 26 06 00 00    	jae    f0102c8e <mem_init+0x118c>
+	assert(ptep == ptep1 + PTX(va));
+f0102668:	81 ea fc ff ff 0f    	sub    $0xffffffc,%edx
+f010266e:	39 55 d0             	cmp    %edx,-0x30(%ebp)
+f0102671:	0f 85 2c 06 00 00    	jne    f0102ca3 <mem_init+0x11a1>
+	kern_pgdir[PDX(va)] = 0;
+f0102677:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	pp0->pp_ref = 0;
+f010267e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102681:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0102687:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f010268d:	c1 f8 03             	sar    $0x3,%eax
+f0102690:	89 c2                	mov    %eax,%edx
+f0102692:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102695:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010269a:	39 c8                	cmp    %ecx,%eax
+f010269c:	0f 83 1a 06 00 00    	jae    f0102cbc <mem_init+0x11ba>
+	memset(page2kva(pp0), 0xFF, PGSIZE);
+f01026a2:	83 ec 04             	sub    $0x4,%esp
+f01026a5:	68 00 10 00 00       	push   $0x1000
+f01026aa:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f01026af:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01026b5:	52                   	push   %edx
+f01026b6:	e8 8a 49 00 00       	call   f0107045 <memset>
+	page_free(pp0);
+f01026bb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f01026be:	89 34 24             	mov    %esi,(%esp)
+f01026c1:	e8 e0 ee ff ff       	call   f01015a6 <page_free>
+	pgdir_walk(kern_pgdir, 0x0, 1);
+f01026c6:	83 c4 0c             	add    $0xc,%esp
+f01026c9:	6a 01                	push   $0x1
+f01026cb:	6a 00                	push   $0x0
+f01026cd:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01026d3:	e8 2f ef ff ff       	call   f0101607 <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f01026d8:	89 f0                	mov    %esi,%eax
+f01026da:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f01026e0:	c1 f8 03             	sar    $0x3,%eax
+f01026e3:	89 c1                	mov    %eax,%ecx
+f01026e5:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01026e8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01026ed:	83 c4 10             	add    $0x10,%esp
+f01026f0:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01026f6:	0f 83 d2 05 00 00    	jae    f0102cce <mem_init+0x11cc>
+	return (void *)(pa + KERNBASE);
+f01026fc:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	for(i=0; i<NPTENTRIES; i++)
+f0102702:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0102708:	39 c8                	cmp    %ecx,%eax
+f010270a:	0f 84 d0 05 00 00    	je     f0102ce0 <mem_init+0x11de>
+		assert((ptep[i] & PTE_P) == 0);
+f0102710:	8b 10                	mov    (%eax),%edx
+f0102712:	83 c0 04             	add    $0x4,%eax
+f0102715:	f6 c2 01             	test   $0x1,%dl
+f0102718:	74 ee                	je     f0102708 <mem_init+0xc06>
+f010271a:	68 d2 a1 10 f0       	push   $0xf010a1d2
+f010271f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102724:	68 a3 04 00 00       	push   $0x4a3
+f0102729:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010272e:	e8 0d d9 ff ff       	call   f0100040 <_panic>
+	assert(nfree == 0);
+f0102733:	68 12 a1 10 f0       	push   $0xf010a112
+f0102738:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010273d:	68 c0 03 00 00       	push   $0x3c0
+f0102742:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102747:	e8 f4 d8 ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f010274c:	68 20 a0 10 f0       	push   $0xf010a020
+f0102751:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102756:	68 26 04 00 00       	push   $0x426
+f010275b:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102760:	e8 db d8 ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102765:	68 36 a0 10 f0       	push   $0xf010a036
+f010276a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010276f:	68 27 04 00 00       	push   $0x427
+f0102774:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102779:	e8 c2 d8 ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010277e:	68 4c a0 10 f0       	push   $0xf010a04c
+f0102783:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102788:	68 28 04 00 00       	push   $0x428
+f010278d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102792:	e8 a9 d8 ff ff       	call   f0100040 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102797:	68 62 a0 10 f0       	push   $0xf010a062
+f010279c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01027a1:	68 2b 04 00 00       	push   $0x42b
+f01027a6:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01027ab:	e8 90 d8 ff ff       	call   f0100040 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f01027b0:	68 d0 96 10 f0       	push   $0xf01096d0
+f01027b5:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01027ba:	68 2c 04 00 00       	push   $0x42c
+f01027bf:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01027c4:	e8 77 d8 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f01027c9:	68 cb a0 10 f0       	push   $0xf010a0cb
+f01027ce:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01027d3:	68 33 04 00 00       	push   $0x433
+f01027d8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01027dd:	e8 5e d8 ff ff       	call   f0100040 <_panic>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f01027e2:	68 10 97 10 f0       	push   $0xf0109710
+f01027e7:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01027ec:	68 36 04 00 00       	push   $0x436
+f01027f1:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01027f6:	e8 45 d8 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f01027fb:	68 48 97 10 f0       	push   $0xf0109748
+f0102800:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102805:	68 39 04 00 00       	push   $0x439
+f010280a:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010280f:	e8 2c d8 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102814:	68 78 97 10 f0       	push   $0xf0109778
+f0102819:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010281e:	68 3d 04 00 00       	push   $0x43d
+f0102823:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102828:	e8 13 d8 ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f010282d:	68 a8 97 10 f0       	push   $0xf01097a8
+f0102832:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102837:	68 3e 04 00 00       	push   $0x43e
+f010283c:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102841:	e8 fa d7 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0102846:	68 d0 97 10 f0       	push   $0xf01097d0
+f010284b:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102850:	68 3f 04 00 00       	push   $0x43f
+f0102855:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010285a:	e8 e1 d7 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f010285f:	68 1d a1 10 f0       	push   $0xf010a11d
+f0102864:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102869:	68 40 04 00 00       	push   $0x440
+f010286e:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102873:	e8 c8 d7 ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102878:	68 2e a1 10 f0       	push   $0xf010a12e
+f010287d:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102882:	68 41 04 00 00       	push   $0x441
+f0102887:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010288c:	e8 af d7 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102891:	68 00 98 10 f0       	push   $0xf0109800
+f0102896:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010289b:	68 44 04 00 00       	push   $0x444
+f01028a0:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01028a5:	e8 96 d7 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01028aa:	68 3c 98 10 f0       	push   $0xf010983c
+f01028af:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01028b4:	68 45 04 00 00       	push   $0x445
+f01028b9:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01028be:	e8 7d d7 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f01028c3:	68 3f a1 10 f0       	push   $0xf010a13f
+f01028c8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01028cd:	68 46 04 00 00       	push   $0x446
+f01028d2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01028d7:	e8 64 d7 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f01028dc:	68 cb a0 10 f0       	push   $0xf010a0cb
+f01028e1:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01028e6:	68 49 04 00 00       	push   $0x449
+f01028eb:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01028f0:	e8 4b d7 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01028f5:	68 00 98 10 f0       	push   $0xf0109800
+f01028fa:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01028ff:	68 4c 04 00 00       	push   $0x44c
+f0102904:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102909:	e8 32 d7 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010290e:	68 3c 98 10 f0       	push   $0xf010983c
+f0102913:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102918:	68 4d 04 00 00       	push   $0x44d
+f010291d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102922:	e8 19 d7 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102927:	68 3f a1 10 f0       	push   $0xf010a13f
+f010292c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102931:	68 4e 04 00 00       	push   $0x44e
+f0102936:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010293b:	e8 00 d7 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102940:	68 cb a0 10 f0       	push   $0xf010a0cb
+f0102945:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010294a:	68 52 04 00 00       	push   $0x452
+f010294f:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102954:	e8 e7 d6 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102959:	56                   	push   %esi
+f010295a:	68 24 8e 10 f0       	push   $0xf0108e24
+f010295f:	68 55 04 00 00       	push   $0x455
+f0102964:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102969:	e8 d2 d6 ff ff       	call   f0100040 <_panic>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f010296e:	68 6c 98 10 f0       	push   $0xf010986c
+f0102973:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102978:	68 56 04 00 00       	push   $0x456
+f010297d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102982:	e8 b9 d6 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0102987:	68 ac 98 10 f0       	push   $0xf01098ac
+f010298c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102991:	68 59 04 00 00       	push   $0x459
+f0102996:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010299b:	e8 a0 d6 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01029a0:	68 3c 98 10 f0       	push   $0xf010983c
+f01029a5:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01029aa:	68 5a 04 00 00       	push   $0x45a
+f01029af:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01029b4:	e8 87 d6 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f01029b9:	68 3f a1 10 f0       	push   $0xf010a13f
+f01029be:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01029c3:	68 5b 04 00 00       	push   $0x45b
+f01029c8:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01029cd:	e8 6e d6 ff ff       	call   f0100040 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f01029d2:	68 ec 98 10 f0       	push   $0xf01098ec
+f01029d7:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01029dc:	68 5c 04 00 00       	push   $0x45c
+f01029e1:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01029e6:	e8 55 d6 ff ff       	call   f0100040 <_panic>
+	assert(kern_pgdir[0] & PTE_U);
+f01029eb:	68 50 a1 10 f0       	push   $0xf010a150
+f01029f0:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01029f5:	68 5d 04 00 00       	push   $0x45d
+f01029fa:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01029ff:	e8 3c d6 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102a04:	68 00 98 10 f0       	push   $0xf0109800
+f0102a09:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a0e:	68 60 04 00 00       	push   $0x460
+f0102a13:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a18:	e8 23 d6 ff ff       	call   f0100040 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f0102a1d:	68 20 99 10 f0       	push   $0xf0109920
+f0102a22:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a27:	68 61 04 00 00       	push   $0x461
+f0102a2c:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a31:	e8 0a d6 ff ff       	call   f0100040 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102a36:	68 54 99 10 f0       	push   $0xf0109954
+f0102a3b:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a40:	68 62 04 00 00       	push   $0x462
+f0102a45:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a4a:	e8 f1 d5 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f0102a4f:	68 8c 99 10 f0       	push   $0xf010998c
+f0102a54:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a59:	68 65 04 00 00       	push   $0x465
+f0102a5e:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a63:	e8 d8 d5 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0102a68:	68 c4 99 10 f0       	push   $0xf01099c4
+f0102a6d:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a72:	68 68 04 00 00       	push   $0x468
+f0102a77:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a7c:	e8 bf d5 ff ff       	call   f0100040 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102a81:	68 54 99 10 f0       	push   $0xf0109954
+f0102a86:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102a8b:	68 69 04 00 00       	push   $0x469
+f0102a90:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102a95:	e8 a6 d5 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102a9a:	68 00 9a 10 f0       	push   $0xf0109a00
+f0102a9f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102aa4:	68 6c 04 00 00       	push   $0x46c
+f0102aa9:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102aae:	e8 8d d5 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102ab3:	68 2c 9a 10 f0       	push   $0xf0109a2c
+f0102ab8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102abd:	68 6d 04 00 00       	push   $0x46d
+f0102ac2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102ac7:	e8 74 d5 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 2);
+f0102acc:	68 66 a1 10 f0       	push   $0xf010a166
+f0102ad1:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102ad6:	68 6f 04 00 00       	push   $0x46f
+f0102adb:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102ae0:	e8 5b d5 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102ae5:	68 77 a1 10 f0       	push   $0xf010a177
+f0102aea:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102aef:	68 70 04 00 00       	push   $0x470
+f0102af4:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102af9:	e8 42 d5 ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0102afe:	68 5c 9a 10 f0       	push   $0xf0109a5c
+f0102b03:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b08:	68 73 04 00 00       	push   $0x473
+f0102b0d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b12:	e8 29 d5 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102b17:	68 80 9a 10 f0       	push   $0xf0109a80
+f0102b1c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b21:	68 77 04 00 00       	push   $0x477
+f0102b26:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b2b:	e8 10 d5 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102b30:	68 2c 9a 10 f0       	push   $0xf0109a2c
+f0102b35:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b3a:	68 78 04 00 00       	push   $0x478
+f0102b3f:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b44:	e8 f7 d4 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f0102b49:	68 1d a1 10 f0       	push   $0xf010a11d
+f0102b4e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b53:	68 79 04 00 00       	push   $0x479
+f0102b58:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b5d:	e8 de d4 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102b62:	68 77 a1 10 f0       	push   $0xf010a177
+f0102b67:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b6c:	68 7a 04 00 00       	push   $0x47a
+f0102b71:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b76:	e8 c5 d4 ff ff       	call   f0100040 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0102b7b:	68 a4 9a 10 f0       	push   $0xf0109aa4
+f0102b80:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b85:	68 7d 04 00 00       	push   $0x47d
+f0102b8a:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102b8f:	e8 ac d4 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref);
+f0102b94:	68 88 a1 10 f0       	push   $0xf010a188
+f0102b99:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102b9e:	68 7e 04 00 00       	push   $0x47e
+f0102ba3:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102ba8:	e8 93 d4 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_link == NULL);
+f0102bad:	68 94 a1 10 f0       	push   $0xf010a194
+f0102bb2:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102bb7:	68 7f 04 00 00       	push   $0x47f
+f0102bbc:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102bc1:	e8 7a d4 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102bc6:	68 80 9a 10 f0       	push   $0xf0109a80
+f0102bcb:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102bd0:	68 83 04 00 00       	push   $0x483
+f0102bd5:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102bda:	e8 61 d4 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102bdf:	68 dc 9a 10 f0       	push   $0xf0109adc
+f0102be4:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102be9:	68 84 04 00 00       	push   $0x484
+f0102bee:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102bf3:	e8 48 d4 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 0);
+f0102bf8:	68 a9 a1 10 f0       	push   $0xf010a1a9
+f0102bfd:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c02:	68 85 04 00 00       	push   $0x485
+f0102c07:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c0c:	e8 2f d4 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102c11:	68 77 a1 10 f0       	push   $0xf010a177
+f0102c16:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c1b:	68 86 04 00 00       	push   $0x486
+f0102c20:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c25:	e8 16 d4 ff ff       	call   f0100040 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0102c2a:	68 04 9b 10 f0       	push   $0xf0109b04
+f0102c2f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c34:	68 89 04 00 00       	push   $0x489
+f0102c39:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c3e:	e8 fd d3 ff ff       	call   f0100040 <_panic>
+	assert(!page_alloc(0));
+f0102c43:	68 cb a0 10 f0       	push   $0xf010a0cb
+f0102c48:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c4d:	68 8c 04 00 00       	push   $0x48c
+f0102c52:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c57:	e8 e4 d3 ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102c5c:	68 a8 97 10 f0       	push   $0xf01097a8
+f0102c61:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c66:	68 8f 04 00 00       	push   $0x48f
+f0102c6b:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c70:	e8 cb d3 ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102c75:	68 2e a1 10 f0       	push   $0xf010a12e
+f0102c7a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102c7f:	68 91 04 00 00       	push   $0x491
+f0102c84:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c89:	e8 b2 d3 ff ff       	call   f0100040 <_panic>
+f0102c8e:	52                   	push   %edx
+f0102c8f:	68 24 8e 10 f0       	push   $0xf0108e24
+f0102c94:	68 98 04 00 00       	push   $0x498
+f0102c99:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102c9e:	e8 9d d3 ff ff       	call   f0100040 <_panic>
+	assert(ptep == ptep1 + PTX(va));
+f0102ca3:	68 ba a1 10 f0       	push   $0xf010a1ba
+f0102ca8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102cad:	68 99 04 00 00       	push   $0x499
+f0102cb2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102cb7:	e8 84 d3 ff ff       	call   f0100040 <_panic>
+f0102cbc:	52                   	push   %edx
+f0102cbd:	68 24 8e 10 f0       	push   $0xf0108e24
+f0102cc2:	6a 5b                	push   $0x5b
+f0102cc4:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0102cc9:	e8 72 d3 ff ff       	call   f0100040 <_panic>
+f0102cce:	51                   	push   %ecx
+f0102ccf:	68 24 8e 10 f0       	push   $0xf0108e24
+f0102cd4:	6a 5b                	push   $0x5b
+f0102cd6:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0102cdb:	e8 60 d3 ff ff       	call   f0100040 <_panic>
+	kern_pgdir[0] = 0;
+f0102ce0:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102ce5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp0->pp_ref = 0;
+f0102ceb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102cee:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	page_free_list = fl;
+f0102cf4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+f0102cf7:	89 0d 40 42 a2 f0    	mov    %ecx,0xf0a24240
+	page_free(pp0);
+f0102cfd:	83 ec 0c             	sub    $0xc,%esp
+f0102d00:	50                   	push   %eax
+f0102d01:	e8 a0 e8 ff ff       	call   f01015a6 <page_free>
+	page_free(pp1);
+f0102d06:	89 3c 24             	mov    %edi,(%esp)
+f0102d09:	e8 98 e8 ff ff       	call   f01015a6 <page_free>
+	page_free(pp2);
+f0102d0e:	89 1c 24             	mov    %ebx,(%esp)
+f0102d11:	e8 90 e8 ff ff       	call   f01015a6 <page_free>
+	mm1 = (uintptr_t) mmio_map_region(0, 4097);
+f0102d16:	83 c4 08             	add    $0x8,%esp
+f0102d19:	68 01 10 00 00       	push   $0x1001
+f0102d1e:	6a 00                	push   $0x0
+f0102d20:	e8 7a ed ff ff       	call   f0101a9f <mmio_map_region>
+f0102d25:	89 c6                	mov    %eax,%esi
+	mm2 = (uintptr_t) mmio_map_region(0, 4096);
+f0102d27:	83 c4 08             	add    $0x8,%esp
+f0102d2a:	68 00 10 00 00       	push   $0x1000
+f0102d2f:	6a 00                	push   $0x0
+f0102d31:	e8 69 ed ff ff       	call   f0101a9f <mmio_map_region>
+f0102d36:	89 c7                	mov    %eax,%edi
+	assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f0102d38:	8d 86 00 20 00 00    	lea    0x2000(%esi),%eax
+f0102d3e:	83 c4 10             	add    $0x10,%esp
+f0102d41:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f0102d47:	0f 86 1d 02 00 00    	jbe    f0102f6a <mem_init+0x1468>
+f0102d4d:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f0102d52:	0f 87 12 02 00 00    	ja     f0102f6a <mem_init+0x1468>
+	assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f0102d58:	8d 97 00 20 00 00    	lea    0x2000(%edi),%edx
+f0102d5e:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f0102d64:	0f 87 19 02 00 00    	ja     f0102f83 <mem_init+0x1481>
+f0102d6a:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0102d70:	0f 86 0d 02 00 00    	jbe    f0102f83 <mem_init+0x1481>
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102d76:	89 f2                	mov    %esi,%edx
+f0102d78:	09 fa                	or     %edi,%edx
+f0102d7a:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0102d80:	0f 85 16 02 00 00    	jne    f0102f9c <mem_init+0x149a>
+	assert(mm1 + 8192 <= mm2);
+f0102d86:	39 c7                	cmp    %eax,%edi
+f0102d88:	0f 82 27 02 00 00    	jb     f0102fb5 <mem_init+0x14b3>
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102d8e:	8b 1d 9c 62 a4 f0    	mov    0xf0a4629c,%ebx
+f0102d94:	89 f2                	mov    %esi,%edx
+f0102d96:	89 d8                	mov    %ebx,%eax
+f0102d98:	e8 74 e2 ff ff       	call   f0101011 <check_va2pa>
+f0102d9d:	85 c0                	test   %eax,%eax
+f0102d9f:	0f 85 29 02 00 00    	jne    f0102fce <mem_init+0x14cc>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0102da5:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f0102dab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102dae:	89 c2                	mov    %eax,%edx
+f0102db0:	89 d8                	mov    %ebx,%eax
+f0102db2:	e8 5a e2 ff ff       	call   f0101011 <check_va2pa>
+f0102db7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0102dbc:	0f 85 25 02 00 00    	jne    f0102fe7 <mem_init+0x14e5>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f0102dc2:	89 fa                	mov    %edi,%edx
+f0102dc4:	89 d8                	mov    %ebx,%eax
+f0102dc6:	e8 46 e2 ff ff       	call   f0101011 <check_va2pa>
+f0102dcb:	85 c0                	test   %eax,%eax
+f0102dcd:	0f 85 2d 02 00 00    	jne    f0103000 <mem_init+0x14fe>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0102dd3:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+f0102dd9:	89 d8                	mov    %ebx,%eax
+f0102ddb:	e8 31 e2 ff ff       	call   f0101011 <check_va2pa>
+f0102de0:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102de3:	0f 85 30 02 00 00    	jne    f0103019 <mem_init+0x1517>
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0102de9:	83 ec 04             	sub    $0x4,%esp
+f0102dec:	6a 00                	push   $0x0
+f0102dee:	56                   	push   %esi
+f0102def:	53                   	push   %ebx
+f0102df0:	e8 12 e8 ff ff       	call   f0101607 <pgdir_walk>
+f0102df5:	83 c4 10             	add    $0x10,%esp
+f0102df8:	f6 00 1a             	testb  $0x1a,(%eax)
+f0102dfb:	0f 84 31 02 00 00    	je     f0103032 <mem_init+0x1530>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f0102e01:	83 ec 04             	sub    $0x4,%esp
+f0102e04:	6a 00                	push   $0x0
+f0102e06:	56                   	push   %esi
+f0102e07:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102e0d:	e8 f5 e7 ff ff       	call   f0101607 <pgdir_walk>
+f0102e12:	8b 00                	mov    (%eax),%eax
+f0102e14:	83 c4 10             	add    $0x10,%esp
+f0102e17:	83 e0 04             	and    $0x4,%eax
+f0102e1a:	89 c3                	mov    %eax,%ebx
+f0102e1c:	0f 85 29 02 00 00    	jne    f010304b <mem_init+0x1549>
+	*pgdir_walk(kern_pgdir, (void*) mm1, 0) = 0;
+f0102e22:	83 ec 04             	sub    $0x4,%esp
+f0102e25:	6a 00                	push   $0x0
+f0102e27:	56                   	push   %esi
+f0102e28:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102e2e:	e8 d4 e7 ff ff       	call   f0101607 <pgdir_walk>
+f0102e33:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm1 + PGSIZE, 0) = 0;
+f0102e39:	83 c4 0c             	add    $0xc,%esp
+f0102e3c:	6a 00                	push   $0x0
+f0102e3e:	ff 75 d4             	push   -0x2c(%ebp)
+f0102e41:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102e47:	e8 bb e7 ff ff       	call   f0101607 <pgdir_walk>
+f0102e4c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm2, 0) = 0;
+f0102e52:	83 c4 0c             	add    $0xc,%esp
+f0102e55:	6a 00                	push   $0x0
+f0102e57:	57                   	push   %edi
+f0102e58:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f0102e5e:	e8 a4 e7 ff ff       	call   f0101607 <pgdir_walk>
+f0102e63:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	cprintf("check_page() succeeded!\n");
+f0102e69:	c7 04 24 fb a1 10 f0 	movl   $0xf010a1fb,(%esp)
+f0102e70:	e8 08 15 00 00       	call   f010437d <cprintf>
+	n = ROUNDUP(pages_size, PGSIZE);
+f0102e75:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0102e78:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+f0102e7e:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	assert(n < PTSIZE);
+f0102e84:	83 c4 10             	add    $0x10,%esp
+f0102e87:	81 f9 ff ff 3f 00    	cmp    $0x3fffff,%ecx
+f0102e8d:	0f 87 d1 01 00 00    	ja     f0103064 <mem_init+0x1562>
+	boot_map_region(kern_pgdir, UPAGES, n, PADDR(pages), PTE_U);
+f0102e93:	a1 a0 62 a4 f0       	mov    0xf0a462a0,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102e98:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e9d:	0f 86 da 01 00 00    	jbe    f010307d <mem_init+0x157b>
+f0102ea3:	83 ec 08             	sub    $0x8,%esp
+f0102ea6:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f0102ea8:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102ead:	50                   	push   %eax
+f0102eae:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f0102eb3:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102eb8:	e8 16 e8 ff ff       	call   f01016d3 <boot_map_region>
+	boot_map_region(kern_pgdir, UENVS, n, PADDR(envs), PTE_U);
+f0102ebd:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102ec2:	83 c4 10             	add    $0x10,%esp
+f0102ec5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102eca:	0f 86 c2 01 00 00    	jbe    f0103092 <mem_init+0x1590>
+f0102ed0:	83 ec 08             	sub    $0x8,%esp
+f0102ed3:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f0102ed5:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102eda:	50                   	push   %eax
+f0102edb:	b9 00 40 02 00       	mov    $0x24000,%ecx
+f0102ee0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0102ee5:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102eea:	e8 e4 e7 ff ff       	call   f01016d3 <boot_map_region>
+	boot_map_region(kern_pgdir, KERNBASE, MAX_VADDR-KERNBASE+1, 0, PTE_W);
+f0102eef:	83 c4 08             	add    $0x8,%esp
+f0102ef2:	6a 02                	push   $0x2
+f0102ef4:	6a 00                	push   $0x0
+f0102ef6:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+f0102efb:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0102f00:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102f05:	e8 c9 e7 ff ff       	call   f01016d3 <boot_map_region>
+	for (int i = 0; i < NCPU; ++i) {
+f0102f0a:	c7 45 d4 00 80 a4 f0 	movl   $0xf0a48000,-0x2c(%ebp)
+f0102f11:	bf 00 80 a8 f0       	mov    $0xf0a88000,%edi
+f0102f16:	83 c4 10             	add    $0x10,%esp
+f0102f19:	b8 00 80 a4 f0       	mov    $0xf0a48000,%eax
+f0102f1e:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f0102f23:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0102f26:	89 c3                	mov    %eax,%ebx
+f0102f28:	39 fb                	cmp    %edi,%ebx
+f0102f2a:	0f 84 8c 01 00 00    	je     f01030bc <mem_init+0x15ba>
+	if ((uint32_t)kva < KERNBASE)
+f0102f30:	8d b2 00 00 ff ff    	lea    -0x10000(%edx),%esi
+f0102f36:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0102f3c:	0f 86 65 01 00 00    	jbe    f01030a7 <mem_init+0x15a5>
+		boot_map_region(kern_pgdir, vaddr, KSTKSIZE, PADDR(percpu_kstacks+i), PTE_W);
+f0102f42:	83 ec 08             	sub    $0x8,%esp
+f0102f45:	6a 02                	push   $0x2
+	return (physaddr_t)kva - KERNBASE;
+f0102f47:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0102f4d:	50                   	push   %eax
+f0102f4e:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f0102f53:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0102f58:	e8 76 e7 ff ff       	call   f01016d3 <boot_map_region>
+	for (int i = 0; i < NCPU; ++i) {
+f0102f5d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0102f63:	83 c4 10             	add    $0x10,%esp
+		boot_map_region(kern_pgdir, vaddr, KSTKSIZE, PADDR(percpu_kstacks+i), PTE_W);
+f0102f66:	89 f2                	mov    %esi,%edx
+f0102f68:	eb be                	jmp    f0102f28 <mem_init+0x1426>
+	assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f0102f6a:	68 28 9b 10 f0       	push   $0xf0109b28
+f0102f6f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102f74:	68 b3 04 00 00       	push   $0x4b3
+f0102f79:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102f7e:	e8 bd d0 ff ff       	call   f0100040 <_panic>
+	assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f0102f83:	68 50 9b 10 f0       	push   $0xf0109b50
+f0102f88:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102f8d:	68 b4 04 00 00       	push   $0x4b4
+f0102f92:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102f97:	e8 a4 d0 ff ff       	call   f0100040 <_panic>
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102f9c:	68 78 9b 10 f0       	push   $0xf0109b78
+f0102fa1:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102fa6:	68 b6 04 00 00       	push   $0x4b6
+f0102fab:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102fb0:	e8 8b d0 ff ff       	call   f0100040 <_panic>
+	assert(mm1 + 8192 <= mm2);
+f0102fb5:	68 e9 a1 10 f0       	push   $0xf010a1e9
+f0102fba:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102fbf:	68 b8 04 00 00       	push   $0x4b8
+f0102fc4:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102fc9:	e8 72 d0 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102fce:	68 a0 9b 10 f0       	push   $0xf0109ba0
+f0102fd3:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102fd8:	68 ba 04 00 00       	push   $0x4ba
+f0102fdd:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102fe2:	e8 59 d0 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0102fe7:	68 c4 9b 10 f0       	push   $0xf0109bc4
+f0102fec:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0102ff1:	68 bb 04 00 00       	push   $0x4bb
+f0102ff6:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0102ffb:	e8 40 d0 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f0103000:	68 f4 9b 10 f0       	push   $0xf0109bf4
+f0103005:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010300a:	68 bc 04 00 00       	push   $0x4bc
+f010300f:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103014:	e8 27 d0 ff ff       	call   f0100040 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0103019:	68 18 9c 10 f0       	push   $0xf0109c18
+f010301e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103023:	68 bd 04 00 00       	push   $0x4bd
+f0103028:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010302d:	e8 0e d0 ff ff       	call   f0100040 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0103032:	68 44 9c 10 f0       	push   $0xf0109c44
+f0103037:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010303c:	68 bf 04 00 00       	push   $0x4bf
+f0103041:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103046:	e8 f5 cf ff ff       	call   f0100040 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f010304b:	68 88 9c 10 f0       	push   $0xf0109c88
+f0103050:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103055:	68 c0 04 00 00       	push   $0x4c0
+f010305a:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010305f:	e8 dc cf ff ff       	call   f0100040 <_panic>
+	assert(n < PTSIZE);
+f0103064:	68 14 a2 10 f0       	push   $0xf010a214
+f0103069:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010306e:	68 ce 00 00 00       	push   $0xce
+f0103073:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103078:	e8 c3 cf ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010307d:	50                   	push   %eax
+f010307e:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103083:	68 d0 00 00 00       	push   $0xd0
+f0103088:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010308d:	e8 ae cf ff ff       	call   f0100040 <_panic>
+f0103092:	50                   	push   %eax
+f0103093:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103098:	68 db 00 00 00       	push   $0xdb
+f010309d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01030a2:	e8 99 cf ff ff       	call   f0100040 <_panic>
+f01030a7:	53                   	push   %ebx
+f01030a8:	68 48 8e 10 f0       	push   $0xf0108e48
+f01030ad:	68 1c 01 00 00       	push   $0x11c
+f01030b2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01030b7:	e8 84 cf ff ff       	call   f0100040 <_panic>
+	pgdir = kern_pgdir;
+f01030bc:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f01030bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f01030c2:	8b 3d 9c 62 a4 f0    	mov    0xf0a4629c,%edi
+	n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f01030c8:	a1 98 62 a4 f0       	mov    0xf0a46298,%eax
+f01030cd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f01030d0:	8d 14 c5 ff 0f 00 00 	lea    0xfff(,%eax,8),%edx
+f01030d7:	89 d0                	mov    %edx,%eax
+f01030d9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f01030de:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+f01030e4:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f01030e7:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+	for (i = 0; i < n; i += PGSIZE)
+f01030ed:	89 de                	mov    %ebx,%esi
+f01030ef:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f01030f2:	89 cf                	mov    %ecx,%edi
+f01030f4:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f01030f7:	89 c3                	mov    %eax,%ebx
+f01030f9:	eb 1d                	jmp    f0103118 <mem_init+0x1616>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01030fb:	ff 75 cc             	push   -0x34(%ebp)
+f01030fe:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103103:	68 d8 03 00 00       	push   $0x3d8
+f0103108:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010310d:	e8 2e cf ff ff       	call   f0100040 <_panic>
+f0103112:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103118:	39 de                	cmp    %ebx,%esi
+f010311a:	73 37                	jae    f0103153 <mem_init+0x1651>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f010311c:	8d 96 00 00 00 ef    	lea    -0x11000000(%esi),%edx
+f0103122:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103125:	e8 e7 de ff ff       	call   f0101011 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f010312a:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0103131:	76 c8                	jbe    f01030fb <mem_init+0x15f9>
+f0103133:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+f0103136:	39 d0                	cmp    %edx,%eax
+f0103138:	74 d8                	je     f0103112 <mem_init+0x1610>
+f010313a:	68 bc 9c 10 f0       	push   $0xf0109cbc
+f010313f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103144:	68 d8 03 00 00       	push   $0x3d8
+f0103149:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010314e:	e8 ed ce ff ff       	call   f0100040 <_panic>
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f0103153:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103156:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+f010315b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f010315e:	be 00 00 c0 ee       	mov    $0xeec00000,%esi
+f0103163:	8d 88 00 f0 3f 21    	lea    0x213ff000(%eax),%ecx
+f0103169:	89 c7                	mov    %eax,%edi
+f010316b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f010316e:	89 cb                	mov    %ecx,%ebx
+f0103170:	89 f2                	mov    %esi,%edx
+f0103172:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103175:	e8 97 de ff ff       	call   f0101011 <check_va2pa>
+f010317a:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0103180:	76 2a                	jbe    f01031ac <mem_init+0x16aa>
+f0103182:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103188:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+f010318b:	39 d0                	cmp    %edx,%eax
+f010318d:	75 34                	jne    f01031c3 <mem_init+0x16c1>
+	for (i = 0; i < n; i += PGSIZE)
+f010318f:	81 fe 00 40 c2 ee    	cmp    $0xeec24000,%esi
+f0103195:	75 d9                	jne    f0103170 <mem_init+0x166e>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0103197:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010319a:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010319d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01031a0:	c1 e0 0c             	shl    $0xc,%eax
+f01031a3:	89 de                	mov    %ebx,%esi
+f01031a5:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f01031a8:	89 c3                	mov    %eax,%ebx
+f01031aa:	eb 36                	jmp    f01031e2 <mem_init+0x16e0>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01031ac:	ff 75 c8             	push   -0x38(%ebp)
+f01031af:	68 48 8e 10 f0       	push   $0xf0108e48
+f01031b4:	68 dd 03 00 00       	push   $0x3dd
+f01031b9:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01031be:	e8 7d ce ff ff       	call   f0100040 <_panic>
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f01031c3:	68 f0 9c 10 f0       	push   $0xf0109cf0
+f01031c8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01031cd:	68 dd 03 00 00       	push   $0x3dd
+f01031d2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01031d7:	e8 64 ce ff ff       	call   f0100040 <_panic>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01031dc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01031e2:	39 de                	cmp    %ebx,%esi
+f01031e4:	73 2a                	jae    f0103210 <mem_init+0x170e>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f01031e6:	8d 96 00 00 00 f0    	lea    -0x10000000(%esi),%edx
+f01031ec:	89 f8                	mov    %edi,%eax
+f01031ee:	e8 1e de ff ff       	call   f0101011 <check_va2pa>
+f01031f3:	39 c6                	cmp    %eax,%esi
+f01031f5:	74 e5                	je     f01031dc <mem_init+0x16da>
+f01031f7:	68 24 9d 10 f0       	push   $0xf0109d24
+f01031fc:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103201:	68 e1 03 00 00       	push   $0x3e1
+f0103206:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010320b:	e8 30 ce ff ff       	call   f0100040 <_panic>
+f0103210:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103213:	c7 45 c8 00 00 a5 00 	movl   $0xa50000,-0x38(%ebp)
+f010321a:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f010321f:	81 ea 00 80 a4 f0    	sub    $0xf0a48000,%edx
+f0103225:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0103228:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f010322f:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+f0103232:	e9 83 00 00 00       	jmp    f01032ba <mem_init+0x17b8>
+f0103237:	ff 75 d4             	push   -0x2c(%ebp)
+f010323a:	68 48 8e 10 f0       	push   $0xf0108e48
+f010323f:	68 e9 03 00 00       	push   $0x3e9
+f0103244:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103249:	e8 f2 cd ff ff       	call   f0100040 <_panic>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010324e:	68 4c 9d 10 f0       	push   $0xf0109d4c
+f0103253:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103258:	68 e8 03 00 00       	push   $0x3e8
+f010325d:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103262:	e8 d9 cd ff ff       	call   f0100040 <_panic>
+f0103267:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f010326a:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+f010326d:	39 de                	cmp    %ebx,%esi
+f010326f:	74 2d                	je     f010329e <mem_init+0x179c>
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f0103271:	89 f2                	mov    %esi,%edx
+f0103273:	89 f8                	mov    %edi,%eax
+f0103275:	e8 97 dd ff ff       	call   f0101011 <check_va2pa>
+f010327a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103280:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103283:	74 e8                	je     f010326d <mem_init+0x176b>
+f0103285:	68 94 9d 10 f0       	push   $0xf0109d94
+f010328a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010328f:	68 eb 03 00 00       	push   $0x3eb
+f0103294:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103299:	e8 a2 cd ff ff       	call   f0100040 <_panic>
+	for (n = 0; n < NCPU; n++) {
+f010329e:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f01032a5:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f01032ac:	81 45 c8 00 80 00 00 	addl   $0x8000,-0x38(%ebp)
+f01032b3:	81 6d c4 00 80 01 00 	subl   $0x18000,-0x3c(%ebp)
+f01032ba:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f01032bd:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f01032c0:	74 55                	je     f0103317 <mem_init+0x1815>
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f01032c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01032c5:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f01032cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01032ce:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f01032d4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01032d7:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f01032dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01032df:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f01032e2:	8b 75 c8             	mov    -0x38(%ebp),%esi
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f01032e5:	39 f3                	cmp    %esi,%ebx
+f01032e7:	0f 84 7a ff ff ff    	je     f0103267 <mem_init+0x1765>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f01032ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01032f0:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f01032f3:	89 f8                	mov    %edi,%eax
+f01032f5:	e8 17 dd ff ff       	call   f0101011 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f01032fa:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f0103301:	0f 86 30 ff ff ff    	jbe    f0103237 <mem_init+0x1735>
+f0103307:	39 c3                	cmp    %eax,%ebx
+f0103309:	0f 85 3f ff ff ff    	jne    f010324e <mem_init+0x174c>
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f010330f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103315:	eb ce                	jmp    f01032e5 <mem_init+0x17e3>
+f0103317:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f010331a:	eb 35                	jmp    f0103351 <mem_init+0x184f>
+			assert(pgdir[i] & PTE_P);
+f010331c:	f6 04 9f 01          	testb  $0x1,(%edi,%ebx,4)
+f0103320:	75 24                	jne    f0103346 <mem_init+0x1844>
+f0103322:	68 1f a2 10 f0       	push   $0xf010a21f
+f0103327:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010332c:	68 f6 03 00 00       	push   $0x3f6
+f0103331:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103336:	e8 05 cd ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] & PTE_P);
+f010333b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+f010333e:	a8 01                	test   $0x1,%al
+f0103340:	74 41                	je     f0103383 <mem_init+0x1881>
+				assert(pgdir[i] & PTE_W);
+f0103342:	a8 02                	test   $0x2,%al
+f0103344:	74 56                	je     f010339c <mem_init+0x189a>
+	for (i = 0; i < NPDENTRIES; i++) {
+f0103346:	83 c3 01             	add    $0x1,%ebx
+f0103349:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+f010334f:	74 64                	je     f01033b5 <mem_init+0x18b3>
+		switch (i) {
+f0103351:	8d 83 45 fc ff ff    	lea    -0x3bb(%ebx),%eax
+f0103357:	83 f8 04             	cmp    $0x4,%eax
+f010335a:	76 c0                	jbe    f010331c <mem_init+0x181a>
+			if (i >= PDX(KERNBASE)) {
+f010335c:	81 fb bf 03 00 00    	cmp    $0x3bf,%ebx
+f0103362:	77 d7                	ja     f010333b <mem_init+0x1839>
+				assert(pgdir[i] == 0);
+f0103364:	83 3c 9f 00          	cmpl   $0x0,(%edi,%ebx,4)
+f0103368:	74 dc                	je     f0103346 <mem_init+0x1844>
+f010336a:	68 41 a2 10 f0       	push   $0xf010a241
+f010336f:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103374:	68 fd 03 00 00       	push   $0x3fd
+f0103379:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010337e:	e8 bd cc ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0103383:	68 1f a2 10 f0       	push   $0xf010a21f
+f0103388:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010338d:	68 fa 03 00 00       	push   $0x3fa
+f0103392:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103397:	e8 a4 cc ff ff       	call   f0100040 <_panic>
+				assert(pgdir[i] & PTE_W);
+f010339c:	68 30 a2 10 f0       	push   $0xf010a230
+f01033a1:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01033a6:	68 fb 03 00 00       	push   $0x3fb
+f01033ab:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01033b0:	e8 8b cc ff ff       	call   f0100040 <_panic>
+	cprintf("check_kern_pgdir() succeeded!\n");
+f01033b5:	83 ec 0c             	sub    $0xc,%esp
+f01033b8:	68 b8 9d 10 f0       	push   $0xf0109db8
+f01033bd:	e8 bb 0f 00 00       	call   f010437d <cprintf>
+	lcr3(PADDR(kern_pgdir));
+f01033c2:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f01033c7:	83 c4 10             	add    $0x10,%esp
+f01033ca:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01033cf:	0f 86 06 02 00 00    	jbe    f01035db <mem_init+0x1ad9>
+	return (physaddr_t)kva - KERNBASE;
+f01033d5:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01033da:	0f 22 d8             	mov    %eax,%cr3
+	check_page_free_list(0);
+f01033dd:	b8 00 00 00 00       	mov    $0x0,%eax
+f01033e2:	e8 8d dc ff ff       	call   f0101074 <check_page_free_list>
+	asm volatile("movl %%cr0,%0" : "=r" (val));
+f01033e7:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f01033ea:	83 e0 f3             	and    $0xfffffff3,%eax
+f01033ed:	0d 23 00 05 80       	or     $0x80050023,%eax
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f01033f2:	0f 22 c0             	mov    %eax,%cr0
+	assert((pp0 = page_alloc(0)));
+f01033f5:	83 ec 0c             	sub    $0xc,%esp
+f01033f8:	6a 00                	push   $0x0
+f01033fa:	e8 2c e1 ff ff       	call   f010152b <page_alloc>
+f01033ff:	89 c3                	mov    %eax,%ebx
+f0103401:	83 c4 10             	add    $0x10,%esp
+f0103404:	85 c0                	test   %eax,%eax
+f0103406:	0f 84 e4 01 00 00    	je     f01035f0 <mem_init+0x1aee>
+	assert((pp1 = page_alloc(0)));
+f010340c:	83 ec 0c             	sub    $0xc,%esp
+f010340f:	6a 00                	push   $0x0
+f0103411:	e8 15 e1 ff ff       	call   f010152b <page_alloc>
+f0103416:	89 c7                	mov    %eax,%edi
+f0103418:	83 c4 10             	add    $0x10,%esp
+f010341b:	85 c0                	test   %eax,%eax
+f010341d:	0f 84 e6 01 00 00    	je     f0103609 <mem_init+0x1b07>
+	assert((pp2 = page_alloc(0)));
+f0103423:	83 ec 0c             	sub    $0xc,%esp
+f0103426:	6a 00                	push   $0x0
+f0103428:	e8 fe e0 ff ff       	call   f010152b <page_alloc>
+f010342d:	89 c6                	mov    %eax,%esi
+f010342f:	83 c4 10             	add    $0x10,%esp
+f0103432:	85 c0                	test   %eax,%eax
+f0103434:	0f 84 e8 01 00 00    	je     f0103622 <mem_init+0x1b20>
+	page_free(pp0);
+f010343a:	83 ec 0c             	sub    $0xc,%esp
+f010343d:	53                   	push   %ebx
+f010343e:	e8 63 e1 ff ff       	call   f01015a6 <page_free>
+	return (pp - pages) << PGSHIFT;
+f0103443:	89 f8                	mov    %edi,%eax
+f0103445:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f010344b:	c1 f8 03             	sar    $0x3,%eax
+f010344e:	89 c2                	mov    %eax,%edx
+f0103450:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103453:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103458:	83 c4 10             	add    $0x10,%esp
+f010345b:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0103461:	0f 83 d4 01 00 00    	jae    f010363b <mem_init+0x1b39>
+	memset(page2kva(pp1), 1, PGSIZE);
+f0103467:	83 ec 04             	sub    $0x4,%esp
+f010346a:	68 00 10 00 00       	push   $0x1000
+f010346f:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0103471:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103477:	52                   	push   %edx
+f0103478:	e8 c8 3b 00 00       	call   f0107045 <memset>
+	return (pp - pages) << PGSHIFT;
+f010347d:	89 f0                	mov    %esi,%eax
+f010347f:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0103485:	c1 f8 03             	sar    $0x3,%eax
+f0103488:	89 c2                	mov    %eax,%edx
+f010348a:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010348d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103492:	83 c4 10             	add    $0x10,%esp
+f0103495:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f010349b:	0f 83 ac 01 00 00    	jae    f010364d <mem_init+0x1b4b>
+	memset(page2kva(pp2), 2, PGSIZE);
+f01034a1:	83 ec 04             	sub    $0x4,%esp
+f01034a4:	68 00 10 00 00       	push   $0x1000
+f01034a9:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f01034ab:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01034b1:	52                   	push   %edx
+f01034b2:	e8 8e 3b 00 00       	call   f0107045 <memset>
+	page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W);
+f01034b7:	6a 02                	push   $0x2
+f01034b9:	68 00 10 00 00       	push   $0x1000
+f01034be:	57                   	push   %edi
+f01034bf:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01034c5:	e8 45 e5 ff ff       	call   f0101a0f <page_insert>
+	assert(pp1->pp_ref == 1);
+f01034ca:	83 c4 20             	add    $0x20,%esp
+f01034cd:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f01034d2:	0f 85 87 01 00 00    	jne    f010365f <mem_init+0x1b5d>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f01034d8:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f01034df:	01 01 01 
+f01034e2:	0f 85 90 01 00 00    	jne    f0103678 <mem_init+0x1b76>
+	page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W);
+f01034e8:	6a 02                	push   $0x2
+f01034ea:	68 00 10 00 00       	push   $0x1000
+f01034ef:	56                   	push   %esi
+f01034f0:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f01034f6:	e8 14 e5 ff ff       	call   f0101a0f <page_insert>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f01034fb:	83 c4 10             	add    $0x10,%esp
+f01034fe:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0103505:	02 02 02 
+f0103508:	0f 85 83 01 00 00    	jne    f0103691 <mem_init+0x1b8f>
+	assert(pp2->pp_ref == 1);
+f010350e:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103513:	0f 85 91 01 00 00    	jne    f01036aa <mem_init+0x1ba8>
+	assert(pp1->pp_ref == 0);
+f0103519:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f010351e:	0f 85 9f 01 00 00    	jne    f01036c3 <mem_init+0x1bc1>
+	*(uint32_t *)PGSIZE = 0x03030303U;
+f0103524:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f010352b:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f010352e:	89 f0                	mov    %esi,%eax
+f0103530:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0103536:	c1 f8 03             	sar    $0x3,%eax
+f0103539:	89 c2                	mov    %eax,%edx
+f010353b:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010353e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103543:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0103549:	0f 83 8d 01 00 00    	jae    f01036dc <mem_init+0x1bda>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f010354f:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103556:	03 03 03 
+f0103559:	0f 85 8f 01 00 00    	jne    f01036ee <mem_init+0x1bec>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f010355f:	83 ec 08             	sub    $0x8,%esp
+f0103562:	68 00 10 00 00       	push   $0x1000
+f0103567:	ff 35 9c 62 a4 f0    	push   0xf0a4629c
+f010356d:	e8 2b e4 ff ff       	call   f010199d <page_remove>
+	assert(pp2->pp_ref == 0);
+f0103572:	83 c4 10             	add    $0x10,%esp
+f0103575:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f010357a:	0f 85 87 01 00 00    	jne    f0103707 <mem_init+0x1c05>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103580:	8b 0d 9c 62 a4 f0    	mov    0xf0a4629c,%ecx
+f0103586:	8b 11                	mov    (%ecx),%edx
+f0103588:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f010358e:	89 d8                	mov    %ebx,%eax
+f0103590:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0103596:	c1 f8 03             	sar    $0x3,%eax
+f0103599:	c1 e0 0c             	shl    $0xc,%eax
+f010359c:	39 c2                	cmp    %eax,%edx
+f010359e:	0f 85 7c 01 00 00    	jne    f0103720 <mem_init+0x1c1e>
+	kern_pgdir[0] = 0;
+f01035a4:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f01035aa:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01035af:	0f 85 84 01 00 00    	jne    f0103739 <mem_init+0x1c37>
+	pp0->pp_ref = 0;
+f01035b5:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+	page_free(pp0);
+f01035bb:	83 ec 0c             	sub    $0xc,%esp
+f01035be:	53                   	push   %ebx
+f01035bf:	e8 e2 df ff ff       	call   f01015a6 <page_free>
+	cprintf("check_page_installed_pgdir() succeeded!\n");
+f01035c4:	c7 04 24 4c 9e 10 f0 	movl   $0xf0109e4c,(%esp)
+f01035cb:	e8 ad 0d 00 00       	call   f010437d <cprintf>
+}
+f01035d0:	83 c4 10             	add    $0x10,%esp
+f01035d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01035d6:	5b                   	pop    %ebx
+f01035d7:	5e                   	pop    %esi
+f01035d8:	5f                   	pop    %edi
+f01035d9:	5d                   	pop    %ebp
+f01035da:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01035db:	50                   	push   %eax
+f01035dc:	68 48 8e 10 f0       	push   $0xf0108e48
+f01035e1:	68 f5 00 00 00       	push   $0xf5
+f01035e6:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01035eb:	e8 50 ca ff ff       	call   f0100040 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01035f0:	68 20 a0 10 f0       	push   $0xf010a020
+f01035f5:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01035fa:	68 d5 04 00 00       	push   $0x4d5
+f01035ff:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103604:	e8 37 ca ff ff       	call   f0100040 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103609:	68 36 a0 10 f0       	push   $0xf010a036
+f010360e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103613:	68 d6 04 00 00       	push   $0x4d6
+f0103618:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010361d:	e8 1e ca ff ff       	call   f0100040 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0103622:	68 4c a0 10 f0       	push   $0xf010a04c
+f0103627:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010362c:	68 d7 04 00 00       	push   $0x4d7
+f0103631:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103636:	e8 05 ca ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010363b:	52                   	push   %edx
+f010363c:	68 24 8e 10 f0       	push   $0xf0108e24
+f0103641:	6a 5b                	push   $0x5b
+f0103643:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0103648:	e8 f3 c9 ff ff       	call   f0100040 <_panic>
+f010364d:	52                   	push   %edx
+f010364e:	68 24 8e 10 f0       	push   $0xf0108e24
+f0103653:	6a 5b                	push   $0x5b
+f0103655:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f010365a:	e8 e1 c9 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 1);
+f010365f:	68 1d a1 10 f0       	push   $0xf010a11d
+f0103664:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103669:	68 dc 04 00 00       	push   $0x4dc
+f010366e:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103673:	e8 c8 c9 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f0103678:	68 d8 9d 10 f0       	push   $0xf0109dd8
+f010367d:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103682:	68 dd 04 00 00       	push   $0x4dd
+f0103687:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010368c:	e8 af c9 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0103691:	68 fc 9d 10 f0       	push   $0xf0109dfc
+f0103696:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010369b:	68 df 04 00 00       	push   $0x4df
+f01036a0:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01036a5:	e8 96 c9 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 1);
+f01036aa:	68 3f a1 10 f0       	push   $0xf010a13f
+f01036af:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01036b4:	68 e0 04 00 00       	push   $0x4e0
+f01036b9:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01036be:	e8 7d c9 ff ff       	call   f0100040 <_panic>
+	assert(pp1->pp_ref == 0);
+f01036c3:	68 a9 a1 10 f0       	push   $0xf010a1a9
+f01036c8:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01036cd:	68 e1 04 00 00       	push   $0x4e1
+f01036d2:	68 ad 9e 10 f0       	push   $0xf0109ead
+f01036d7:	e8 64 c9 ff ff       	call   f0100040 <_panic>
+f01036dc:	52                   	push   %edx
+f01036dd:	68 24 8e 10 f0       	push   $0xf0108e24
+f01036e2:	6a 5b                	push   $0x5b
+f01036e4:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01036e9:	e8 52 c9 ff ff       	call   f0100040 <_panic>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f01036ee:	68 20 9e 10 f0       	push   $0xf0109e20
+f01036f3:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01036f8:	68 e3 04 00 00       	push   $0x4e3
+f01036fd:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103702:	e8 39 c9 ff ff       	call   f0100040 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103707:	68 77 a1 10 f0       	push   $0xf010a177
+f010370c:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103711:	68 e5 04 00 00       	push   $0x4e5
+f0103716:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010371b:	e8 20 c9 ff ff       	call   f0100040 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103720:	68 a8 97 10 f0       	push   $0xf01097a8
+f0103725:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010372a:	68 e8 04 00 00       	push   $0x4e8
+f010372f:	68 ad 9e 10 f0       	push   $0xf0109ead
+f0103734:	e8 07 c9 ff ff       	call   f0100040 <_panic>
+	assert(pp0->pp_ref == 1);
+f0103739:	68 2e a1 10 f0       	push   $0xf010a12e
+f010373e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0103743:	68 ea 04 00 00       	push   $0x4ea
+f0103748:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010374d:	e8 ee c8 ff ff       	call   f0100040 <_panic>
+
+f0103752 <user_mem_check>:
+{
+f0103752:	55                   	push   %ebp
+f0103753:	89 e5                	mov    %esp,%ebp
+f0103755:	57                   	push   %edi
+f0103756:	56                   	push   %esi
+f0103757:	53                   	push   %ebx
+f0103758:	83 ec 2c             	sub    $0x2c,%esp
+f010375b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010375e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	pde_t *pgdir = env->env_pgdir;
+f0103761:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103764:	8b 40 60             	mov    0x60(%eax),%eax
+	if (!pgdir) {
+f0103767:	85 c0                	test   %eax,%eax
+f0103769:	0f 84 b5 00 00 00    	je     f0103824 <user_mem_check+0xd2>
+	if (va >= (void*)ULIM || (void*)ULIM - va < len) {
+f010376f:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0103775:	0f 87 b9 00 00 00    	ja     f0103834 <user_mem_check+0xe2>
+f010377b:	ba 00 00 80 ef       	mov    $0xef800000,%edx
+f0103780:	29 da                	sub    %ebx,%edx
+f0103782:	39 ca                	cmp    %ecx,%edx
+f0103784:	0f 82 aa 00 00 00    	jb     f0103834 <user_mem_check+0xe2>
+	start = ROUNDDOWN(va, PGSIZE);
+f010378a:	89 de                	mov    %ebx,%esi
+f010378c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	end = ROUNDDOWN(va + len-1, PGSIZE);
+f0103792:	8d 54 0b ff          	lea    -0x1(%ebx,%ecx,1),%edx
+f0103796:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010379c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+	pdenum = (end - start) >> PTSHIFT;
+f010379f:	29 f2                	sub    %esi,%edx
+f01037a1:	89 d1                	mov    %edx,%ecx
+f01037a3:	c1 f9 16             	sar    $0x16,%ecx
+		pde = pgdir[PDX(va) + pdeno];
+f01037a6:	89 da                	mov    %ebx,%edx
+f01037a8:	c1 ea 16             	shr    $0x16,%edx
+f01037ab:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	if (PGNUM(pa) >= npages)
+f01037ae:	8b 3d 98 62 a4 f0    	mov    0xf0a46298,%edi
+f01037b4:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f01037b7:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01037ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (int pdeno = 0; pdeno <= pdenum; ++pdeno) {
+f01037bd:	bf 00 00 00 00       	mov    $0x0,%edi
+			pteno = PTX(start);
+f01037c2:	89 f0                	mov    %esi,%eax
+f01037c4:	c1 e8 0c             	shr    $0xc,%eax
+f01037c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01037cc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01037cf:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f01037d2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+	for (int pdeno = 0; pdeno <= pdenum; ++pdeno) {
+f01037d5:	39 cf                	cmp    %ecx,%edi
+f01037d7:	0f 8f 0c 01 00 00    	jg     f01038e9 <user_mem_check+0x197>
+		pde = pgdir[PDX(va) + pdeno];
+f01037dd:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f01037e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01037e3:	8b 04 b8             	mov    (%eax,%edi,4),%eax
+		if (!(pde & (perm | PTE_P))) {
+f01037e6:	8b 75 14             	mov    0x14(%ebp),%esi
+f01037e9:	83 ce 01             	or     $0x1,%esi
+f01037ec:	85 c6                	test   %eax,%esi
+f01037ee:	74 54                	je     f0103844 <user_mem_check+0xf2>
+		pt = KADDR(PTE_ADDR(pde));
+f01037f0:	89 c2                	mov    %eax,%edx
+f01037f2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01037f8:	c1 e8 0c             	shr    $0xc,%eax
+f01037fb:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01037fe:	39 d8                	cmp    %ebx,%eax
+f0103800:	73 6b                	jae    f010386d <user_mem_check+0x11b>
+	return (void *)(pa + KERNBASE);
+f0103802:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+			pteno = PTX(start);
+f0103808:	85 ff                	test   %edi,%edi
+f010380a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010380f:	0f 44 45 dc          	cmove  -0x24(%ebp),%eax
+			ptenum = NPTENTRIES;
+f0103813:	bb 00 04 00 00       	mov    $0x400,%ebx
+		if (pdeno == pdenum) {
+f0103818:	39 cf                	cmp    %ecx,%edi
+f010381a:	74 66                	je     f0103882 <user_mem_check+0x130>
+f010381c:	8d 14 82             	lea    (%edx,%eax,4),%edx
+f010381f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0103822:	eb 7f                	jmp    f01038a3 <user_mem_check+0x151>
+		user_mem_check_addr = (uintptr_t)va;
+f0103824:	89 1d 3c 42 a2 f0    	mov    %ebx,0xf0a2423c
+		return -E_FAULT;
+f010382a:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010382f:	e9 a2 00 00 00       	jmp    f01038d6 <user_mem_check+0x184>
+		user_mem_check_addr = (uintptr_t)va;
+f0103834:	89 1d 3c 42 a2 f0    	mov    %ebx,0xf0a2423c
+		return -E_FAULT;
+f010383a:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010383f:	e9 92 00 00 00       	jmp    f01038d6 <user_mem_check+0x184>
+			if (pdeno == 0) {
+f0103844:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0103847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010384a:	85 ff                	test   %edi,%edi
+f010384c:	75 0d                	jne    f010385b <user_mem_check+0x109>
+				user_mem_check_addr = (uintptr_t)va;
+f010384e:	89 1d 3c 42 a2 f0    	mov    %ebx,0xf0a2423c
+			return -E_FAULT;
+f0103854:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0103859:	eb 7b                	jmp    f01038d6 <user_mem_check+0x184>
+				user_mem_check_addr = (uintptr_t)start + (pdeno << PTSHIFT);
+f010385b:	c1 e7 16             	shl    $0x16,%edi
+f010385e:	8d 04 37             	lea    (%edi,%esi,1),%eax
+f0103861:	a3 3c 42 a2 f0       	mov    %eax,0xf0a2423c
+			return -E_FAULT;
+f0103866:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010386b:	eb 69                	jmp    f01038d6 <user_mem_check+0x184>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010386d:	52                   	push   %edx
+f010386e:	68 24 8e 10 f0       	push   $0xf0108e24
+f0103873:	68 f7 02 00 00       	push   $0x2f7
+f0103878:	68 ad 9e 10 f0       	push   $0xf0109ead
+f010387d:	e8 be c7 ff ff       	call   f0100040 <_panic>
+			ptenum = PTX(end) + 1;
+f0103882:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103885:	c1 eb 0c             	shr    $0xc,%ebx
+f0103888:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f010388e:	83 c3 01             	add    $0x1,%ebx
+f0103891:	eb 89                	jmp    f010381c <user_mem_check+0xca>
+					user_mem_check_addr = (uintptr_t)va;
+f0103893:	89 1d 3c 42 a2 f0    	mov    %ebx,0xf0a2423c
+				return -E_FAULT;
+f0103899:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010389e:	eb 36                	jmp    f01038d6 <user_mem_check+0x184>
+		for (; pteno < ptenum; ++pteno) {
+f01038a0:	83 c0 01             	add    $0x1,%eax
+f01038a3:	39 d8                	cmp    %ebx,%eax
+f01038a5:	7d 37                	jge    f01038de <user_mem_check+0x18c>
+			if (!(pte & (perm | PTE_P))) {
+f01038a7:	89 f7                	mov    %esi,%edi
+f01038a9:	23 3a                	and    (%edx),%edi
+f01038ab:	83 c2 04             	add    $0x4,%edx
+f01038ae:	85 ff                	test   %edi,%edi
+f01038b0:	75 ee                	jne    f01038a0 <user_mem_check+0x14e>
+		pde = pgdir[PDX(va) + pdeno];
+f01038b2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f01038b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01038b8:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f01038bb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01038be:	01 ca                	add    %ecx,%edx
+				user_mem_check_addr = ((PDX(va) + pdeno) << PTSHIFT) + (pteno << PGSHIFT);
+f01038c0:	c1 e2 16             	shl    $0x16,%edx
+f01038c3:	c1 e0 0c             	shl    $0xc,%eax
+f01038c6:	01 d0                	add    %edx,%eax
+				if (user_mem_check_addr == ((uintptr_t)va & ~0xfff)) {
+f01038c8:	39 c6                	cmp    %eax,%esi
+f01038ca:	74 c7                	je     f0103893 <user_mem_check+0x141>
+				user_mem_check_addr = ((PDX(va) + pdeno) << PTSHIFT) + (pteno << PGSHIFT);
+f01038cc:	a3 3c 42 a2 f0       	mov    %eax,0xf0a2423c
+				return -E_FAULT;
+f01038d1:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f01038d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01038d9:	5b                   	pop    %ebx
+f01038da:	5e                   	pop    %esi
+f01038db:	5f                   	pop    %edi
+f01038dc:	5d                   	pop    %ebp
+f01038dd:	c3                   	ret
+	for (int pdeno = 0; pdeno <= pdenum; ++pdeno) {
+f01038de:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f01038e1:	83 c7 01             	add    $0x1,%edi
+f01038e4:	e9 ec fe ff ff       	jmp    f01037d5 <user_mem_check+0x83>
+	return 0;
+f01038e9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01038ee:	eb e6                	jmp    f01038d6 <user_mem_check+0x184>
+
+f01038f0 <user_mem_assert>:
+{
+f01038f0:	55                   	push   %ebp
+f01038f1:	89 e5                	mov    %esp,%ebp
+f01038f3:	53                   	push   %ebx
+f01038f4:	83 ec 04             	sub    $0x4,%esp
+f01038f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f01038fa:	8b 45 14             	mov    0x14(%ebp),%eax
+f01038fd:	83 c8 04             	or     $0x4,%eax
+f0103900:	50                   	push   %eax
+f0103901:	ff 75 10             	push   0x10(%ebp)
+f0103904:	ff 75 0c             	push   0xc(%ebp)
+f0103907:	53                   	push   %ebx
+f0103908:	e8 45 fe ff ff       	call   f0103752 <user_mem_check>
+f010390d:	83 c4 10             	add    $0x10,%esp
+f0103910:	85 c0                	test   %eax,%eax
+f0103912:	78 05                	js     f0103919 <user_mem_assert+0x29>
+}
+f0103914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103917:	c9                   	leave
+f0103918:	c3                   	ret
+		cprintf("[%08x] user_mem_check assertion failure for "
+f0103919:	83 ec 04             	sub    $0x4,%esp
+f010391c:	ff 35 3c 42 a2 f0    	push   0xf0a2423c
+f0103922:	ff 73 48             	push   0x48(%ebx)
+f0103925:	68 78 9e 10 f0       	push   $0xf0109e78
+f010392a:	e8 4e 0a 00 00       	call   f010437d <cprintf>
+		env_destroy(env);	// may not return
+f010392f:	89 1c 24             	mov    %ebx,(%esp)
+f0103932:	e8 d9 06 00 00       	call   f0104010 <env_destroy>
+f0103937:	83 c4 10             	add    $0x10,%esp
+}
+f010393a:	eb d8                	jmp    f0103914 <user_mem_assert+0x24>
+
+f010393c <user_mem_check2>:
+{
+f010393c:	55                   	push   %ebp
+f010393d:	89 e5                	mov    %esp,%ebp
+f010393f:	56                   	push   %esi
+f0103940:	53                   	push   %ebx
+f0103941:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = user_mem_check(env, va, len, perm | PTE_U)) < 0) {
+f0103944:	8b 45 14             	mov    0x14(%ebp),%eax
+f0103947:	83 c8 04             	or     $0x4,%eax
+f010394a:	50                   	push   %eax
+f010394b:	ff 75 10             	push   0x10(%ebp)
+f010394e:	ff 75 0c             	push   0xc(%ebp)
+f0103951:	56                   	push   %esi
+f0103952:	e8 fb fd ff ff       	call   f0103752 <user_mem_check>
+f0103957:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f010395a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((r = user_mem_check(env, va, len, perm | PTE_U)) < 0) {
+f010395f:	85 c0                	test   %eax,%eax
+f0103961:	78 09                	js     f010396c <user_mem_check2+0x30>
+}
+f0103963:	89 d8                	mov    %ebx,%eax
+f0103965:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0103968:	5b                   	pop    %ebx
+f0103969:	5e                   	pop    %esi
+f010396a:	5d                   	pop    %ebp
+f010396b:	c3                   	ret
+f010396c:	89 c3                	mov    %eax,%ebx
+		cprintf("[%08x] user_mem_check assertion failure for "
+f010396e:	83 ec 04             	sub    $0x4,%esp
+f0103971:	ff 35 3c 42 a2 f0    	push   0xf0a2423c
+f0103977:	ff 76 48             	push   0x48(%esi)
+f010397a:	68 78 9e 10 f0       	push   $0xf0109e78
+f010397f:	e8 f9 09 00 00       	call   f010437d <cprintf>
+		if (err_addr) {
+f0103984:	83 c4 10             	add    $0x10,%esp
+f0103987:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+f010398b:	74 d6                	je     f0103963 <user_mem_check2+0x27>
+			*err_addr = user_mem_check_addr;
+f010398d:	a1 3c 42 a2 f0       	mov    0xf0a2423c,%eax
+f0103992:	8b 55 18             	mov    0x18(%ebp),%edx
+f0103995:	89 02                	mov    %eax,(%edx)
+f0103997:	eb ca                	jmp    f0103963 <user_mem_check2+0x27>
+
+f0103999 <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f0103999:	55                   	push   %ebp
+f010399a:	89 e5                	mov    %esp,%ebp
+f010399c:	57                   	push   %edi
+f010399d:	56                   	push   %esi
+f010399e:	53                   	push   %ebx
+f010399f:	83 ec 1c             	sub    $0x1c,%esp
+f01039a2:	89 c7                	mov    %eax,%edi
+	//
+	// Hint: It is easier to use region_alloc if the caller can pass
+	//   'va' and 'len' values that are not page-aligned.
+	//   You should round va down, and round (va + len) up.
+	//   (Watch out for corner-cases!)
+	if (!e) {
+f01039a4:	85 c0                	test   %eax,%eax
+f01039a6:	0f 84 94 00 00 00    	je     f0103a40 <region_alloc+0xa7>
+f01039ac:	89 d0                	mov    %edx,%eax
+		log("arg Env is NULL");
+		return;
+	}
+	void* old_va = va;
+	assert((void*)MAX_VADDR - va + 1 >= len);
+f01039ae:	f7 da                	neg    %edx
+f01039b0:	39 ca                	cmp    %ecx,%edx
+f01039b2:	72 23                	jb     f01039d7 <region_alloc+0x3e>
+	va = ROUNDDOWN(old_va, PGSIZE);
+f01039b4:	89 c2                	mov    %eax,%edx
+f01039b6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01039bc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	len = ROUNDUP(old_va + len, PGSIZE) - va;
+f01039bf:	8d 84 08 ff 0f 00 00 	lea    0xfff(%eax,%ecx,1),%eax
+f01039c6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01039cb:	29 d0                	sub    %edx,%eax
+f01039cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	log("va: %p, size: %d", va, len);
+	for (int i = 0; i < len; i += PGSIZE) {
+f01039d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01039d5:	eb 1f                	jmp    f01039f6 <region_alloc+0x5d>
+	assert((void*)MAX_VADDR - va + 1 >= len);
+f01039d7:	68 50 a2 10 f0       	push   $0xf010a250
+f01039dc:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01039e1:	68 39 01 00 00       	push   $0x139
+f01039e6:	68 71 a2 10 f0       	push   $0xf010a271
+f01039eb:	e8 50 c6 ff ff       	call   f0100040 <_panic>
+	for (int i = 0; i < len; i += PGSIZE) {
+f01039f0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01039f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01039f9:	39 c3                	cmp    %eax,%ebx
+f01039fb:	73 43                	jae    f0103a40 <region_alloc+0xa7>
+		// if there exists a page frame, don't allocate a new one
+		if (page_lookup(e->env_pgdir, va+i, NULL) != NULL) {
+f01039fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103a00:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+f0103a03:	83 ec 04             	sub    $0x4,%esp
+f0103a06:	6a 00                	push   $0x0
+f0103a08:	56                   	push   %esi
+f0103a09:	ff 77 60             	push   0x60(%edi)
+f0103a0c:	e8 d2 dd ff ff       	call   f01017e3 <page_lookup>
+f0103a11:	83 c4 10             	add    $0x10,%esp
+f0103a14:	85 c0                	test   %eax,%eax
+f0103a16:	75 d8                	jne    f01039f0 <region_alloc+0x57>
+			log("there exists a page frame: %p", va+i);
+			continue;
+		}
+		struct PageInfo *page = page_alloc(0);
+f0103a18:	83 ec 0c             	sub    $0xc,%esp
+f0103a1b:	6a 00                	push   $0x0
+f0103a1d:	e8 09 db ff ff       	call   f010152b <page_alloc>
+		if (!page) {
+f0103a22:	83 c4 10             	add    $0x10,%esp
+f0103a25:	85 c0                	test   %eax,%eax
+f0103a27:	74 17                	je     f0103a40 <region_alloc+0xa7>
+			log("page_alloc failed");
+			return;
+		}
+		page->pp_ref = 1;
+f0103a29:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+		int err = page_insert(e->env_pgdir, page, va + i, PTE_U | PTE_W);
+f0103a2f:	6a 06                	push   $0x6
+f0103a31:	56                   	push   %esi
+f0103a32:	50                   	push   %eax
+f0103a33:	ff 77 60             	push   0x60(%edi)
+f0103a36:	e8 d4 df ff ff       	call   f0101a0f <page_insert>
+		if (err) {
+f0103a3b:	83 c4 10             	add    $0x10,%esp
+f0103a3e:	eb b0                	jmp    f01039f0 <region_alloc+0x57>
+			log("page_insert failed");
+		}
+	}
+
+}
+f0103a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103a43:	5b                   	pop    %ebx
+f0103a44:	5e                   	pop    %esi
+f0103a45:	5f                   	pop    %edi
+f0103a46:	5d                   	pop    %ebp
+f0103a47:	c3                   	ret
+
+f0103a48 <envid2env>:
+{
+f0103a48:	55                   	push   %ebp
+f0103a49:	89 e5                	mov    %esp,%ebp
+f0103a4b:	56                   	push   %esi
+f0103a4c:	53                   	push   %ebx
+f0103a4d:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103a50:	8b 55 10             	mov    0x10(%ebp),%edx
+	if (envid == 0) {
+f0103a53:	85 f6                	test   %esi,%esi
+f0103a55:	74 30                	je     f0103a87 <envid2env+0x3f>
+	e = &envs[ENVX(envid)];
+f0103a57:	89 f0                	mov    %esi,%eax
+f0103a59:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0103a5e:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+f0103a61:	c1 e3 04             	shl    $0x4,%ebx
+f0103a64:	03 1d 48 42 a2 f0    	add    0xf0a24248,%ebx
+	if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103a6a:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0103a6e:	74 71                	je     f0103ae1 <envid2env+0x99>
+f0103a70:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0103a73:	75 78                	jne    f0103aed <envid2env+0xa5>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+f0103a75:	84 d2                	test   %dl,%dl
+f0103a77:	75 20                	jne    f0103a99 <envid2env+0x51>
+	return 0;
+f0103a79:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0103a7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103a81:	89 1a                	mov    %ebx,(%edx)
+}
+f0103a83:	5b                   	pop    %ebx
+f0103a84:	5e                   	pop    %esi
+f0103a85:	5d                   	pop    %ebp
+f0103a86:	c3                   	ret
+		*env_store = curenv;
+f0103a87:	e8 af 3b 00 00       	call   f010763b <cpunum>
+f0103a8c:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0103a8f:	8b 98 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%ebx
+		return 0;
+f0103a95:	89 f0                	mov    %esi,%eax
+f0103a97:	eb e5                	jmp    f0103a7e <envid2env+0x36>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id
+f0103a99:	e8 9d 3b 00 00       	call   f010763b <cpunum>
+f0103a9e:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0103aa1:	39 98 28 70 a4 f0    	cmp    %ebx,-0xf5b8fd8(%eax)
+f0103aa7:	74 d0                	je     f0103a79 <envid2env+0x31>
+f0103aa9:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0103aac:	e8 8a 3b 00 00       	call   f010763b <cpunum>
+f0103ab1:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0103ab4:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0103aba:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103abd:	74 ba                	je     f0103a79 <envid2env+0x31>
+	    && e->env_pgdir != curenv->env_pgdir) {
+f0103abf:	8b 73 60             	mov    0x60(%ebx),%esi
+f0103ac2:	e8 74 3b 00 00       	call   f010763b <cpunum>
+f0103ac7:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0103aca:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0103ad0:	3b 70 60             	cmp    0x60(%eax),%esi
+f0103ad3:	74 a4                	je     f0103a79 <envid2env+0x31>
+f0103ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103ada:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103adf:	eb 9d                	jmp    f0103a7e <envid2env+0x36>
+f0103ae1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103ae6:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103aeb:	eb 91                	jmp    f0103a7e <envid2env+0x36>
+f0103aed:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103af2:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103af7:	eb 85                	jmp    f0103a7e <envid2env+0x36>
+
+f0103af9 <env_init_percpu>:
+	asm volatile("lgdt (%0)" : : "r" (p));
+f0103af9:	b8 20 63 11 f0       	mov    $0xf0116320,%eax
+f0103afe:	0f 01 10             	lgdtl  (%eax)
+	asm volatile("movw %%ax,%%gs" : : "a" (GD_UD|3));
+f0103b01:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103b06:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" : : "a" (GD_UD|3));
+f0103b08:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f0103b0a:	b8 10 00 00 00       	mov    $0x10,%eax
+f0103b0f:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f0103b11:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f0103b13:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f0103b15:	ea 1c 3b 10 f0 08 00 	ljmp   $0x8,$0xf0103b1c
+	asm volatile("lldt %0" : : "r" (sel));
+f0103b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103b21:	0f 00 d0             	lldt   %ax
+}
+f0103b24:	c3                   	ret
+
+f0103b25 <env_init>:
+{
+f0103b25:	55                   	push   %ebp
+f0103b26:	89 e5                	mov    %esp,%ebp
+f0103b28:	53                   	push   %ebx
+f0103b29:	83 ec 04             	sub    $0x4,%esp
+	prev = envs;
+f0103b2c:	8b 1d 48 42 a2 f0    	mov    0xf0a24248,%ebx
+	envs[0].env_id = 0;
+f0103b32:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+	envs[0].env_status = ENV_FREE;
+f0103b39:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+	for (int i = 1; i < NENV; ++i) {
+f0103b40:	8d 8b 70 3f 02 00    	lea    0x23f70(%ebx),%ecx
+	prev = envs;
+f0103b46:	89 da                	mov    %ebx,%edx
+	for (int i = 1; i < NENV; ++i) {
+f0103b48:	eb 1f                	jmp    f0103b69 <env_init+0x44>
+		cur = envs + i;
+f0103b4a:	8d 82 90 00 00 00    	lea    0x90(%edx),%eax
+		cur->env_id = 0;
+f0103b50:	c7 82 d8 00 00 00 00 	movl   $0x0,0xd8(%edx)
+f0103b57:	00 00 00 
+		cur->env_status = ENV_FREE;
+f0103b5a:	c7 82 e4 00 00 00 00 	movl   $0x0,0xe4(%edx)
+f0103b61:	00 00 00 
+		prev->env_link = cur;
+f0103b64:	89 40 b4             	mov    %eax,-0x4c(%eax)
+		prev = cur;
+f0103b67:	89 c2                	mov    %eax,%edx
+	for (int i = 1; i < NENV; ++i) {
+f0103b69:	39 ca                	cmp    %ecx,%edx
+f0103b6b:	75 dd                	jne    f0103b4a <env_init+0x25>
+	cur->env_link = NULL;
+f0103b6d:	c7 40 44 00 00 00 00 	movl   $0x0,0x44(%eax)
+	env_free_list = envs;
+f0103b74:	89 1d 4c 42 a2 f0    	mov    %ebx,0xf0a2424c
+	env_init_percpu();
+f0103b7a:	e8 7a ff ff ff       	call   f0103af9 <env_init_percpu>
+}
+f0103b7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103b82:	c9                   	leave
+f0103b83:	c3                   	ret
+
+f0103b84 <env_alloc>:
+{
+f0103b84:	55                   	push   %ebp
+f0103b85:	89 e5                	mov    %esp,%ebp
+f0103b87:	57                   	push   %edi
+f0103b88:	56                   	push   %esi
+f0103b89:	53                   	push   %ebx
+f0103b8a:	83 ec 0c             	sub    $0xc,%esp
+	if (!(e = env_free_list))
+f0103b8d:	8b 1d 4c 42 a2 f0    	mov    0xf0a2424c,%ebx
+f0103b93:	85 db                	test   %ebx,%ebx
+f0103b95:	0f 84 5a 01 00 00    	je     f0103cf5 <env_alloc+0x171>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0103b9b:	83 ec 0c             	sub    $0xc,%esp
+f0103b9e:	6a 01                	push   $0x1
+f0103ba0:	e8 86 d9 ff ff       	call   f010152b <page_alloc>
+f0103ba5:	83 c4 10             	add    $0x10,%esp
+f0103ba8:	85 c0                	test   %eax,%eax
+f0103baa:	0f 84 4c 01 00 00    	je     f0103cfc <env_alloc+0x178>
+	p->pp_ref = 1;
+f0103bb0:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0103bb6:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0103bbc:	c1 f8 03             	sar    $0x3,%eax
+f0103bbf:	89 c6                	mov    %eax,%esi
+f0103bc1:	c1 e6 0c             	shl    $0xc,%esi
+	if (PGNUM(pa) >= npages)
+f0103bc4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103bc9:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0103bcf:	0f 83 f9 00 00 00    	jae    f0103cce <env_alloc+0x14a>
+	return (void *)(pa + KERNBASE);
+f0103bd5:	8d be 00 00 00 f0    	lea    -0x10000000(%esi),%edi
+	memcpy(pgdir + PDX(UTOP), kern_pgdir + PDX(UTOP), n);
+f0103bdb:	83 ec 04             	sub    $0x4,%esp
+f0103bde:	68 14 01 00 00       	push   $0x114
+f0103be3:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+f0103be8:	05 ec 0e 00 00       	add    $0xeec,%eax
+f0103bed:	50                   	push   %eax
+f0103bee:	8d 86 ec 0e 00 f0    	lea    -0xffff114(%esi),%eax
+f0103bf4:	50                   	push   %eax
+f0103bf5:	e8 e2 34 00 00       	call   f01070dc <memcpy>
+	e->env_pgdir = pgdir;
+f0103bfa:	89 7b 60             	mov    %edi,0x60(%ebx)
+	if ((uint32_t)kva < KERNBASE)
+f0103bfd:	83 c4 10             	add    $0x10,%esp
+f0103c00:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0103c06:	0f 86 d4 00 00 00    	jbe    f0103ce0 <env_alloc+0x15c>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0103c0c:	83 ce 05             	or     $0x5,%esi
+f0103c0f:	89 b7 f4 0e 00 00    	mov    %esi,0xef4(%edi)
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103c15:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103c18:	05 00 10 00 00       	add    $0x1000,%eax
+		generation = 1 << ENVGENSHIFT;
+f0103c1d:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103c22:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103c27:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | (e - envs);
+f0103c2a:	89 da                	mov    %ebx,%edx
+f0103c2c:	2b 15 48 42 a2 f0    	sub    0xf0a24248,%edx
+f0103c32:	c1 fa 04             	sar    $0x4,%edx
+f0103c35:	69 d2 39 8e e3 38    	imul   $0x38e38e39,%edx,%edx
+f0103c3b:	09 d0                	or     %edx,%eax
+f0103c3d:	89 43 48             	mov    %eax,0x48(%ebx)
+	e->env_parent_id = parent_id;
+f0103c40:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103c43:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f0103c46:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f0103c4d:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	e->env_runs = 0;
+f0103c54:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+	memset(&e->env_tf, 0, sizeof(e->env_tf));
+f0103c5b:	83 ec 04             	sub    $0x4,%esp
+f0103c5e:	6a 44                	push   $0x44
+f0103c60:	6a 00                	push   $0x0
+f0103c62:	53                   	push   %ebx
+f0103c63:	e8 dd 33 00 00       	call   f0107045 <memset>
+	e->env_tf.tf_ds = GD_UD | 3;
+f0103c68:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f0103c6e:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f0103c74:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f0103c7a:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f0103c81:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	e->env_tf.tf_eflags |= FL_IF;
+f0103c87:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+	e->env_pgfault_upcall = 0;
+f0103c8e:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+	e->env_uxstacktop = UXSTACKTOP;
+f0103c95:	c7 43 68 00 00 c0 ee 	movl   $0xeec00000,0x68(%ebx)
+	e->env_ipc_recving = 0;
+f0103c9c:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+	e->env_futex_waiting = 0;
+f0103ca0:	c6 83 80 00 00 00 00 	movb   $0x0,0x80(%ebx)
+	e->env_uring = NULL;
+f0103ca7:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+f0103cae:	00 00 00 
+	env_free_list = e->env_link;
+f0103cb1:	8b 43 44             	mov    0x44(%ebx),%eax
+f0103cb4:	a3 4c 42 a2 f0       	mov    %eax,0xf0a2424c
+	*newenv_store = e;
+f0103cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103cbc:	89 18                	mov    %ebx,(%eax)
+	return 0;
+f0103cbe:	83 c4 10             	add    $0x10,%esp
+f0103cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103cc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103cc9:	5b                   	pop    %ebx
+f0103cca:	5e                   	pop    %esi
+f0103ccb:	5f                   	pop    %edi
+f0103ccc:	5d                   	pop    %ebp
+f0103ccd:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103cce:	56                   	push   %esi
+f0103ccf:	68 24 8e 10 f0       	push   $0xf0108e24
+f0103cd4:	6a 5b                	push   $0x5b
+f0103cd6:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0103cdb:	e8 60 c3 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103ce0:	57                   	push   %edi
+f0103ce1:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103ce6:	68 cf 00 00 00       	push   $0xcf
+f0103ceb:	68 71 a2 10 f0       	push   $0xf010a271
+f0103cf0:	e8 4b c3 ff ff       	call   f0100040 <_panic>
+		return -E_NO_FREE_ENV;
+f0103cf5:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0103cfa:	eb ca                	jmp    f0103cc6 <env_alloc+0x142>
+		return -E_NO_MEM;
+f0103cfc:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103d01:	eb c3                	jmp    f0103cc6 <env_alloc+0x142>
+
+f0103d03 <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, enum EnvType type)
+{
+f0103d03:	55                   	push   %ebp
+f0103d04:	89 e5                	mov    %esp,%ebp
+f0103d06:	57                   	push   %edi
+f0103d07:	56                   	push   %esi
+f0103d08:	53                   	push   %ebx
+f0103d09:	83 ec 34             	sub    $0x34,%esp
+	struct Env* e;
+
+	int err = env_alloc(&e, 0);
+f0103d0c:	6a 00                	push   $0x0
+f0103d0e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103d11:	50                   	push   %eax
+f0103d12:	e8 6d fe ff ff       	call   f0103b84 <env_alloc>
+	if (err) {
+		log("env_alloc failed: %e", err);
+	}
+	load_icode(e, binary);
+f0103d17:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+	if (!e) {
+f0103d1a:	83 c4 10             	add    $0x10,%esp
+f0103d1d:	85 f6                	test   %esi,%esi
+f0103d1f:	0f 84 d7 00 00 00    	je     f0103dfc <env_create+0xf9>
+	if (elf->e_magic != ELF_MAGIC) {
+f0103d25:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103d28:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f0103d2e:	0f 85 c8 00 00 00    	jne    f0103dfc <env_create+0xf9>
+	asm volatile("movl %%cr3,%0" : "=r" (val));
+f0103d34:	0f 20 d8             	mov    %cr3,%eax
+f0103d37:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	lcr3(PADDR(e->env_pgdir));
+f0103d3a:	8b 46 60             	mov    0x60(%esi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103d3d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103d42:	76 20                	jbe    f0103d64 <env_create+0x61>
+	return (physaddr_t)kva - KERNBASE;
+f0103d44:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0103d49:	0f 22 d8             	mov    %eax,%cr3
+	for (int i = 0; i < phnum; ++i) {
+f0103d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103d4f:	89 c3                	mov    %eax,%ebx
+f0103d51:	03 58 1c             	add    0x1c(%eax),%ebx
+f0103d54:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+f0103d58:	bf 00 00 00 00       	mov    $0x0,%edi
+f0103d5d:	89 75 cc             	mov    %esi,-0x34(%ebp)
+f0103d60:	89 c6                	mov    %eax,%esi
+f0103d62:	eb 32                	jmp    f0103d96 <env_create+0x93>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103d64:	50                   	push   %eax
+f0103d65:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103d6a:	68 97 01 00 00       	push   $0x197
+f0103d6f:	68 71 a2 10 f0       	push   $0xf010a271
+f0103d74:	e8 c7 c2 ff ff       	call   f0100040 <_panic>
+			memset((void*)hdr->p_va + hdr->p_filesz, 0, hdr->p_memsz - hdr->p_filesz);
+f0103d79:	83 ec 04             	sub    $0x4,%esp
+f0103d7c:	29 c2                	sub    %eax,%edx
+f0103d7e:	52                   	push   %edx
+f0103d7f:	6a 00                	push   $0x0
+f0103d81:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103d84:	03 41 08             	add    0x8(%ecx),%eax
+f0103d87:	50                   	push   %eax
+f0103d88:	e8 b8 32 00 00       	call   f0107045 <memset>
+f0103d8d:	83 c4 10             	add    $0x10,%esp
+	for (int i = 0; i < phnum; ++i) {
+f0103d90:	83 c7 01             	add    $0x1,%edi
+f0103d93:	83 c3 20             	add    $0x20,%ebx
+f0103d96:	39 f7                	cmp    %esi,%edi
+f0103d98:	74 3f                	je     f0103dd9 <env_create+0xd6>
+		if (hdr->p_type != ELF_PROG_LOAD) {
+f0103d9a:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0103d9d:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0103da0:	75 ee                	jne    f0103d90 <env_create+0x8d>
+		void *progaddr = binary + hdr->p_offset;
+f0103da2:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103da5:	03 43 04             	add    0x4(%ebx),%eax
+f0103da8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		region_alloc(e, (void*)hdr->p_va, hdr->p_memsz);
+f0103dab:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f0103dae:	8b 53 08             	mov    0x8(%ebx),%edx
+f0103db1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0103db4:	e8 e0 fb ff ff       	call   f0103999 <region_alloc>
+		memcpy((void*)hdr->p_va, progaddr, hdr->p_filesz);
+f0103db9:	83 ec 04             	sub    $0x4,%esp
+f0103dbc:	ff 73 10             	push   0x10(%ebx)
+f0103dbf:	ff 75 d0             	push   -0x30(%ebp)
+f0103dc2:	ff 73 08             	push   0x8(%ebx)
+f0103dc5:	e8 12 33 00 00       	call   f01070dc <memcpy>
+		if (hdr->p_filesz < hdr->p_memsz) {
+f0103dca:	8b 43 10             	mov    0x10(%ebx),%eax
+f0103dcd:	8b 53 14             	mov    0x14(%ebx),%edx
+f0103dd0:	83 c4 10             	add    $0x10,%esp
+f0103dd3:	39 d0                	cmp    %edx,%eax
+f0103dd5:	73 b9                	jae    f0103d90 <env_create+0x8d>
+f0103dd7:	eb a0                	jmp    f0103d79 <env_create+0x76>
+	region_alloc(e, (void*)(USTACKTOP - PGSIZE), PGSIZE);
+f0103dd9:	8b 75 cc             	mov    -0x34(%ebp),%esi
+f0103ddc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0103de1:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0103de6:	89 f0                	mov    %esi,%eax
+f0103de8:	e8 ac fb ff ff       	call   f0103999 <region_alloc>
+f0103ded:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0103df0:	0f 22 d8             	mov    %eax,%cr3
+	e->env_tf.tf_eip = elf->e_entry;
+f0103df3:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103df6:	8b 40 18             	mov    0x18(%eax),%eax
+f0103df9:	89 46 30             	mov    %eax,0x30(%esi)
+	switch (type) {
+f0103dfc:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+f0103e00:	74 0e                	je     f0103e10 <env_create+0x10d>
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+		break;
+	default:
+		break;
+	}
+	e->env_type = type;
+f0103e02:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103e05:	89 46 50             	mov    %eax,0x50(%esi)
+}
+f0103e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103e0b:	5b                   	pop    %ebx
+f0103e0c:	5e                   	pop    %esi
+f0103e0d:	5f                   	pop    %edi
+f0103e0e:	5d                   	pop    %ebp
+f0103e0f:	c3                   	ret
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+f0103e10:	81 4e 38 00 30 00 00 	orl    $0x3000,0x38(%esi)
+		break;
+f0103e17:	eb e9                	jmp    f0103e02 <env_create+0xff>
+
+f0103e19 <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f0103e19:	55                   	push   %ebp
+f0103e1a:	89 e5                	mov    %esp,%ebp
+f0103e1c:	57                   	push   %edi
+f0103e1d:	56                   	push   %esi
+f0103e1e:	53                   	push   %ebx
+f0103e1f:	83 ec 1c             	sub    $0x1c,%esp
+f0103e22:	8b 7d 08             	mov    0x8(%ebp),%edi
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f0103e25:	e8 11 38 00 00       	call   f010763b <cpunum>
+f0103e2a:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0103e2d:	39 b8 28 70 a4 f0    	cmp    %edi,-0xf5b8fd8(%eax)
+f0103e33:	74 3a                	je     f0103e6f <env_free+0x56>
+	// Note the environment's demise.
+	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+
+	// Threads share their page directory; only the last one out
+	// tears down the address space.
+	pa = PADDR(e->env_pgdir);
+f0103e35:	8b 47 60             	mov    0x60(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103e38:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103e3d:	76 5b                	jbe    f0103e9a <env_free+0x81>
+	return (physaddr_t)kva - KERNBASE;
+f0103e3f:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0103e44:	89 c2                	mov    %eax,%edx
+f0103e46:	c1 ea 0c             	shr    $0xc,%edx
+f0103e49:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f0103e4f:	73 5e                	jae    f0103eaf <env_free+0x96>
+	if (pa2page(pa)->pp_ref > 1)
+f0103e51:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+f0103e57:	66 83 7c d1 04 01    	cmpw   $0x1,0x4(%ecx,%edx,8)
+f0103e5d:	0f 87 40 01 00 00    	ja     f0103fa3 <env_free+0x18a>
+f0103e63:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0103e6a:	e9 cf 00 00 00       	jmp    f0103f3e <env_free+0x125>
+		lcr3(PADDR(kern_pgdir));
+f0103e6f:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103e74:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103e79:	76 0a                	jbe    f0103e85 <env_free+0x6c>
+	return (physaddr_t)kva - KERNBASE;
+f0103e7b:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103e80:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103e83:	eb b0                	jmp    f0103e35 <env_free+0x1c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103e85:	50                   	push   %eax
+f0103e86:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103e8b:	68 df 01 00 00       	push   $0x1df
+f0103e90:	68 71 a2 10 f0       	push   $0xf010a271
+f0103e95:	e8 a6 c1 ff ff       	call   f0100040 <_panic>
+f0103e9a:	50                   	push   %eax
+f0103e9b:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103ea0:	68 e6 01 00 00       	push   $0x1e6
+f0103ea5:	68 71 a2 10 f0       	push   $0xf010a271
+f0103eaa:	e8 91 c1 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0103eaf:	83 ec 04             	sub    $0x4,%esp
+f0103eb2:	68 1c 96 10 f0       	push   $0xf010961c
+f0103eb7:	6a 54                	push   $0x54
+f0103eb9:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0103ebe:	e8 7d c1 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103ec3:	56                   	push   %esi
+f0103ec4:	68 24 8e 10 f0       	push   $0xf0108e24
+f0103ec9:	68 f4 01 00 00       	push   $0x1f4
+f0103ece:	68 71 a2 10 f0       	push   $0xf010a271
+f0103ed3:	e8 68 c1 ff ff       	call   f0100040 <_panic>
+		// find the pa and va of the page table
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+		pt = (pte_t*) KADDR(pa);
+
+		// unmap all PTEs in this page table
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103ed8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103ede:	83 c6 04             	add    $0x4,%esi
+f0103ee1:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103ee7:	74 1b                	je     f0103f04 <env_free+0xeb>
+			if (pt[pteno] & PTE_P)
+f0103ee9:	f6 06 01             	testb  $0x1,(%esi)
+f0103eec:	74 ea                	je     f0103ed8 <env_free+0xbf>
+				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0103eee:	83 ec 08             	sub    $0x8,%esp
+f0103ef1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103ef4:	09 d8                	or     %ebx,%eax
+f0103ef6:	50                   	push   %eax
+f0103ef7:	ff 77 60             	push   0x60(%edi)
+f0103efa:	e8 9e da ff ff       	call   f010199d <page_remove>
+f0103eff:	83 c4 10             	add    $0x10,%esp
+f0103f02:	eb d4                	jmp    f0103ed8 <env_free+0xbf>
+		}
+
+		// free the page table itself
+		e->env_pgdir[pdeno] = 0;
+f0103f04:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103f07:	8b 47 60             	mov    0x60(%edi),%eax
+f0103f0a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103f0d:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103f14:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f0103f1a:	73 64                	jae    f0103f80 <env_free+0x167>
+		page_decref(pa2page(pa));
+f0103f1c:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103f1f:	a1 a0 62 a4 f0       	mov    0xf0a462a0,%eax
+f0103f24:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+f0103f27:	50                   	push   %eax
+f0103f28:	e8 b1 d6 ff ff       	call   f01015de <page_decref>
+f0103f2d:	83 c4 10             	add    $0x10,%esp
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0103f30:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0103f34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103f37:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0103f3c:	74 56                	je     f0103f94 <env_free+0x17b>
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f0103f3e:	8b 47 60             	mov    0x60(%edi),%eax
+f0103f41:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103f44:	8b 04 08             	mov    (%eax,%ecx,1),%eax
+f0103f47:	a8 01                	test   $0x1,%al
+f0103f49:	74 e5                	je     f0103f30 <env_free+0x117>
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0103f4b:	89 c6                	mov    %eax,%esi
+f0103f4d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0103f53:	c1 e8 0c             	shr    $0xc,%eax
+f0103f56:	89 c2                	mov    %eax,%edx
+f0103f58:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0103f5e:	0f 83 5f ff ff ff    	jae    f0103ec3 <env_free+0xaa>
+	return (void *)(pa + KERNBASE);
+f0103f64:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103f6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103f6d:	c1 e0 14             	shl    $0x14,%eax
+f0103f70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103f78:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0103f7b:	e9 69 ff ff ff       	jmp    f0103ee9 <env_free+0xd0>
+		panic("pa2page called with invalid pa");
+f0103f80:	83 ec 04             	sub    $0x4,%esp
+f0103f83:	68 1c 96 10 f0       	push   $0xf010961c
+f0103f88:	6a 54                	push   $0x54
+f0103f8a:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0103f8f:	e8 ac c0 ff ff       	call   f0100040 <_panic>
+	}
+
+	// free the page directory
+	pa = PADDR(e->env_pgdir);
+f0103f94:	8b 47 60             	mov    0x60(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103f97:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103f9c:	76 49                	jbe    f0103fe7 <env_free+0x1ce>
+	return (physaddr_t)kva - KERNBASE;
+f0103f9e:	05 00 00 00 10       	add    $0x10000000,%eax
+free_pgdir:
+	e->env_pgdir = 0;
+f0103fa3:	c7 47 60 00 00 00 00 	movl   $0x0,0x60(%edi)
+	if (PGNUM(pa) >= npages)
+f0103faa:	c1 e8 0c             	shr    $0xc,%eax
+f0103fad:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0103fb3:	73 47                	jae    f0103ffc <env_free+0x1e3>
+	page_decref(pa2page(pa));
+f0103fb5:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103fb8:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f0103fbe:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103fc1:	50                   	push   %eax
+f0103fc2:	e8 17 d6 ff ff       	call   f01015de <page_decref>
+
+	// return the environment to the free list
+	e->env_status = ENV_FREE;
+f0103fc7:	c7 47 54 00 00 00 00 	movl   $0x0,0x54(%edi)
+	e->env_link = env_free_list;
+f0103fce:	a1 4c 42 a2 f0       	mov    0xf0a2424c,%eax
+f0103fd3:	89 47 44             	mov    %eax,0x44(%edi)
+	env_free_list = e;
+f0103fd6:	89 3d 4c 42 a2 f0    	mov    %edi,0xf0a2424c
+}
+f0103fdc:	83 c4 10             	add    $0x10,%esp
+f0103fdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103fe2:	5b                   	pop    %ebx
+f0103fe3:	5e                   	pop    %esi
+f0103fe4:	5f                   	pop    %edi
+f0103fe5:	5d                   	pop    %ebp
+f0103fe6:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103fe7:	50                   	push   %eax
+f0103fe8:	68 48 8e 10 f0       	push   $0xf0108e48
+f0103fed:	68 02 02 00 00       	push   $0x202
+f0103ff2:	68 71 a2 10 f0       	push   $0xf010a271
+f0103ff7:	e8 44 c0 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0103ffc:	83 ec 04             	sub    $0x4,%esp
+f0103fff:	68 1c 96 10 f0       	push   $0xf010961c
+f0104004:	6a 54                	push   $0x54
+f0104006:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f010400b:	e8 30 c0 ff ff       	call   f0100040 <_panic>
+
+f0104010 <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f0104010:	55                   	push   %ebp
+f0104011:	89 e5                	mov    %esp,%ebp
+f0104013:	53                   	push   %ebx
+f0104014:	83 ec 04             	sub    $0x4,%esp
+f0104017:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f010401a:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f010401e:	74 21                	je     f0104041 <env_destroy+0x31>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f0104020:	83 ec 0c             	sub    $0xc,%esp
+f0104023:	53                   	push   %ebx
+f0104024:	e8 f0 fd ff ff       	call   f0103e19 <env_free>
+
+	if (curenv == e) {
+f0104029:	e8 0d 36 00 00       	call   f010763b <cpunum>
+f010402e:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104031:	83 c4 10             	add    $0x10,%esp
+f0104034:	39 98 28 70 a4 f0    	cmp    %ebx,-0xf5b8fd8(%eax)
+f010403a:	74 1e                	je     f010405a <env_destroy+0x4a>
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f010403c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010403f:	c9                   	leave
+f0104040:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104041:	e8 f5 35 00 00       	call   f010763b <cpunum>
+f0104046:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104049:	39 98 28 70 a4 f0    	cmp    %ebx,-0xf5b8fd8(%eax)
+f010404f:	74 cf                	je     f0104020 <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f0104051:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+		return;
+f0104058:	eb e2                	jmp    f010403c <env_destroy+0x2c>
+		curenv = NULL;
+f010405a:	e8 dc 35 00 00       	call   f010763b <cpunum>
+f010405f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104062:	c7 80 28 70 a4 f0 00 	movl   $0x0,-0xf5b8fd8(%eax)
+f0104069:	00 00 00 
+		sched_yield();
+f010406c:	e8 82 12 00 00       	call   f01052f3 <sched_yield>
+
+f0104071 <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f0104071:	55                   	push   %ebp
+f0104072:	89 e5                	mov    %esp,%ebp
+f0104074:	53                   	push   %ebx
+f0104075:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f0104078:	e8 be 35 00 00       	call   f010763b <cpunum>
+f010407d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104080:	8b 98 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%ebx
+f0104086:	e8 b0 35 00 00       	call   f010763b <cpunum>
+f010408b:	89 43 5c             	mov    %eax,0x5c(%ebx)
+	log("cpu %d switch to env 0x%x.\n", thiscpu->cpu_id, curenv->env_id);
+	asm volatile(
+f010408e:	8b 65 08             	mov    0x8(%ebp),%esp
+f0104091:	61                   	popa
+f0104092:	07                   	pop    %es
+f0104093:	1f                   	pop    %ds
+f0104094:	83 c4 08             	add    $0x8,%esp
+f0104097:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret\n"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f0104098:	83 ec 04             	sub    $0x4,%esp
+f010409b:	68 7c a2 10 f0       	push   $0xf010a27c
+f01040a0:	68 3a 02 00 00       	push   $0x23a
+f01040a5:	68 71 a2 10 f0       	push   $0xf010a271
+f01040aa:	e8 91 bf ff ff       	call   f0100040 <_panic>
+
+f01040af <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f01040af:	55                   	push   %ebp
+f01040b0:	89 e5                	mov    %esp,%ebp
+f01040b2:	53                   	push   %ebx
+f01040b3:	83 ec 04             	sub    $0x4,%esp
+f01040b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	//	      what other states it can be in),
+	//	   2. Set 'curenv' to the new environment,
+	//	   3. Set its status to ENV_RUNNING,
+	//	   4. Update its 'env_runs' counter,
+	//	   5. Use lcr3() to switch to its address space.
+	if (curenv != NULL) {
+f01040b9:	e8 7d 35 00 00       	call   f010763b <cpunum>
+f01040be:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01040c1:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f01040c8:	74 14                	je     f01040de <env_run+0x2f>
+		if (curenv->env_status == ENV_RUNNING) {
+f01040ca:	e8 6c 35 00 00       	call   f010763b <cpunum>
+f01040cf:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01040d2:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01040d8:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01040dc:	74 65                	je     f0104143 <env_run+0x94>
+			curenv->env_status = ENV_RUNNABLE;
+		}
+	}
+	curenv = e;
+f01040de:	e8 58 35 00 00       	call   f010763b <cpunum>
+f01040e3:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01040e6:	89 98 28 70 a4 f0    	mov    %ebx,-0xf5b8fd8(%eax)
+	e->env_status = ENV_RUNNING;
+f01040ec:	c7 43 54 03 00 00 00 	movl   $0x3,0x54(%ebx)
+	e->env_runs++;
+f01040f3:	83 43 58 01          	addl   $0x1,0x58(%ebx)
+	lcr3(PADDR(e->env_pgdir));
+f01040f7:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01040fa:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01040ff:	76 59                	jbe    f010415a <env_run+0xab>
+	return (physaddr_t)kva - KERNBASE;
+f0104101:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0104106:	0f 22 d8             	mov    %eax,%cr3
+	thiscpu->cpu_tlb_gen = tlb_gen;
+f0104109:	e8 2d 35 00 00       	call   f010763b <cpunum>
+f010410e:	8b 15 94 62 a4 f0    	mov    0xf0a46294,%edx
+f0104114:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104117:	89 90 98 70 a4 f0    	mov    %edx,-0xf5b8f68(%eax)
+	thiscpu->cpu_in_user = 1;
+f010411d:	e8 19 35 00 00       	call   f010763b <cpunum>
+f0104122:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104125:	c6 80 94 70 a4 f0 01 	movb   $0x1,-0xf5b8f6c(%eax)
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f010412c:	83 ec 0c             	sub    $0xc,%esp
+f010412f:	68 c0 63 11 f0       	push   $0xf01163c0
+f0104134:	e8 0c 38 00 00       	call   f0107945 <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f0104139:	f3 90                	pause
+
+	// Step 2: Use env_pop_tf() to restore the environment's
+	//	   registers and drop into user mode in the
+	//	   environment.
+	unlock_kernel();
+	env_pop_tf(&e->env_tf);
+f010413b:	89 1c 24             	mov    %ebx,(%esp)
+f010413e:	e8 2e ff ff ff       	call   f0104071 <env_pop_tf>
+			curenv->env_status = ENV_RUNNABLE;
+f0104143:	e8 f3 34 00 00       	call   f010763b <cpunum>
+f0104148:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010414b:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104151:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104158:	eb 84                	jmp    f01040de <env_run+0x2f>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010415a:	50                   	push   %eax
+f010415b:	68 48 8e 10 f0       	push   $0xf0108e48
+f0104160:	68 56 02 00 00       	push   $0x256
+f0104165:	68 71 a2 10 f0       	push   $0xf010a271
+f010416a:	e8 d1 be ff ff       	call   f0100040 <_panic>
+
+f010416f <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f010416f:	55                   	push   %ebp
+f0104170:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104172:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104175:	ba 70 00 00 00       	mov    $0x70,%edx
+f010417a:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010417b:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104180:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f0104181:	0f b6 c0             	movzbl %al,%eax
+}
+f0104184:	5d                   	pop    %ebp
+f0104185:	c3                   	ret
+
+f0104186 <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f0104186:	55                   	push   %ebp
+f0104187:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104189:	8b 45 08             	mov    0x8(%ebp),%eax
+f010418c:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104191:	ee                   	out    %al,(%dx)
+f0104192:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104195:	ba 71 00 00 00       	mov    $0x71,%edx
+f010419a:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f010419b:	5d                   	pop    %ebp
+f010419c:	c3                   	ret
+
+f010419d <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f010419d:	55                   	push   %ebp
+f010419e:	89 e5                	mov    %esp,%ebp
+f01041a0:	56                   	push   %esi
+f01041a1:	53                   	push   %ebx
+f01041a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f01041a5:	66 89 0d a8 63 11 f0 	mov    %cx,0xf01163a8
+	if (!didinit)
+f01041ac:	80 3d 50 42 a2 f0 00 	cmpb   $0x0,0xf0a24250
+f01041b3:	75 07                	jne    f01041bc <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f01041b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01041b8:	5b                   	pop    %ebx
+f01041b9:	5e                   	pop    %esi
+f01041ba:	5d                   	pop    %ebp
+f01041bb:	c3                   	ret
+f01041bc:	89 ce                	mov    %ecx,%esi
+f01041be:	ba 21 00 00 00       	mov    $0x21,%edx
+f01041c3:	89 c8                	mov    %ecx,%eax
+f01041c5:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f01041c6:	89 c8                	mov    %ecx,%eax
+f01041c8:	66 c1 e8 08          	shr    $0x8,%ax
+f01041cc:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01041d1:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f01041d2:	83 ec 0c             	sub    $0xc,%esp
+f01041d5:	68 88 a2 10 f0       	push   $0xf010a288
+f01041da:	e8 9e 01 00 00       	call   f010437d <cprintf>
+f01041df:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f01041e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f01041e7:	0f b7 f6             	movzwl %si,%esi
+f01041ea:	f7 d6                	not    %esi
+f01041ec:	eb 08                	jmp    f01041f6 <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f01041ee:	83 c3 01             	add    $0x1,%ebx
+f01041f1:	83 fb 10             	cmp    $0x10,%ebx
+f01041f4:	74 18                	je     f010420e <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f01041f6:	0f a3 de             	bt     %ebx,%esi
+f01041f9:	73 f3                	jae    f01041ee <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f01041fb:	83 ec 08             	sub    $0x8,%esp
+f01041fe:	53                   	push   %ebx
+f01041ff:	68 b7 b0 10 f0       	push   $0xf010b0b7
+f0104204:	e8 74 01 00 00       	call   f010437d <cprintf>
+f0104209:	83 c4 10             	add    $0x10,%esp
+f010420c:	eb e0                	jmp    f01041ee <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f010420e:	83 ec 0c             	sub    $0xc,%esp
+f0104211:	68 12 a2 10 f0       	push   $0xf010a212
+f0104216:	e8 62 01 00 00       	call   f010437d <cprintf>
+f010421b:	83 c4 10             	add    $0x10,%esp
+f010421e:	eb 95                	jmp    f01041b5 <irq_setmask_8259A+0x18>
+
+f0104220 <pic_init>:
+{
+f0104220:	55                   	push   %ebp
+f0104221:	89 e5                	mov    %esp,%ebp
+f0104223:	57                   	push   %edi
+f0104224:	56                   	push   %esi
+f0104225:	53                   	push   %ebx
+f0104226:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f0104229:	c6 05 50 42 a2 f0 01 	movb   $0x1,0xf0a24250
+f0104230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104235:	bb 21 00 00 00       	mov    $0x21,%ebx
+f010423a:	89 da                	mov    %ebx,%edx
+f010423c:	ee                   	out    %al,(%dx)
+f010423d:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0104242:	89 ca                	mov    %ecx,%edx
+f0104244:	ee                   	out    %al,(%dx)
+f0104245:	bf 11 00 00 00       	mov    $0x11,%edi
+f010424a:	be 20 00 00 00       	mov    $0x20,%esi
+f010424f:	89 f8                	mov    %edi,%eax
+f0104251:	89 f2                	mov    %esi,%edx
+f0104253:	ee                   	out    %al,(%dx)
+f0104254:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104259:	89 da                	mov    %ebx,%edx
+f010425b:	ee                   	out    %al,(%dx)
+f010425c:	b8 04 00 00 00       	mov    $0x4,%eax
+f0104261:	ee                   	out    %al,(%dx)
+f0104262:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104267:	ee                   	out    %al,(%dx)
+f0104268:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f010426d:	89 f8                	mov    %edi,%eax
+f010426f:	89 da                	mov    %ebx,%edx
+f0104271:	ee                   	out    %al,(%dx)
+f0104272:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104277:	89 ca                	mov    %ecx,%edx
+f0104279:	ee                   	out    %al,(%dx)
+f010427a:	b8 02 00 00 00       	mov    $0x2,%eax
+f010427f:	ee                   	out    %al,(%dx)
+f0104280:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104285:	ee                   	out    %al,(%dx)
+f0104286:	bf 68 00 00 00       	mov    $0x68,%edi
+f010428b:	89 f8                	mov    %edi,%eax
+f010428d:	89 f2                	mov    %esi,%edx
+f010428f:	ee                   	out    %al,(%dx)
+f0104290:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0104295:	89 c8                	mov    %ecx,%eax
+f0104297:	ee                   	out    %al,(%dx)
+f0104298:	89 f8                	mov    %edi,%eax
+f010429a:	89 da                	mov    %ebx,%edx
+f010429c:	ee                   	out    %al,(%dx)
+f010429d:	89 c8                	mov    %ecx,%eax
+f010429f:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f01042a0:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f01042a7:	66 83 f8 ff          	cmp    $0xffff,%ax
+f01042ab:	75 08                	jne    f01042b5 <pic_init+0x95>
+}
+f01042ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01042b0:	5b                   	pop    %ebx
+f01042b1:	5e                   	pop    %esi
+f01042b2:	5f                   	pop    %edi
+f01042b3:	5d                   	pop    %ebp
+f01042b4:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f01042b5:	83 ec 0c             	sub    $0xc,%esp
+f01042b8:	0f b7 c0             	movzwl %ax,%eax
+f01042bb:	50                   	push   %eax
+f01042bc:	e8 dc fe ff ff       	call   f010419d <irq_setmask_8259A>
+f01042c1:	83 c4 10             	add    $0x10,%esp
+}
+f01042c4:	eb e7                	jmp    f01042ad <pic_init+0x8d>
+
+f01042c6 <irq_mask_line>:
+
+// Mask or unmask one line, without irq_setmask_8259A's chatter.
+void
+irq_mask_line(int irq, bool masked)
+{
+f01042c6:	55                   	push   %ebp
+f01042c7:	89 e5                	mov    %esp,%ebp
+f01042c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (masked)
+f01042cc:	80 7d 0c 00          	cmpb   $0x0,0xc(%ebp)
+f01042d0:	74 2f                	je     f0104301 <irq_mask_line+0x3b>
+		irq_mask_8259A |= 1 << irq;
+f01042d2:	b8 01 00 00 00       	mov    $0x1,%eax
+f01042d7:	d3 e0                	shl    %cl,%eax
+f01042d9:	66 0b 05 a8 63 11 f0 	or     0xf01163a8,%ax
+f01042e0:	66 a3 a8 63 11 f0    	mov    %ax,0xf01163a8
+	else
+		irq_mask_8259A &= ~(1 << irq);
+	if (!didinit)
+f01042e6:	80 3d 50 42 a2 f0 00 	cmpb   $0x0,0xf0a24250
+f01042ed:	74 10                	je     f01042ff <irq_mask_line+0x39>
+f01042ef:	ba 21 00 00 00       	mov    $0x21,%edx
+f01042f4:	ee                   	out    %al,(%dx)
+		return;
+	outb(IO_PIC1+1, (char)irq_mask_8259A);
+	outb(IO_PIC2+1, (char)(irq_mask_8259A >> 8));
+f01042f5:	66 c1 e8 08          	shr    $0x8,%ax
+f01042f9:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01042fe:	ee                   	out    %al,(%dx)
+}
+f01042ff:	5d                   	pop    %ebp
+f0104300:	c3                   	ret
+		irq_mask_8259A &= ~(1 << irq);
+f0104301:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f0104308:	0f b3 c8             	btr    %ecx,%eax
+f010430b:	eb d3                	jmp    f01042e0 <irq_mask_line+0x1a>
+
+f010430d <irq_is_level>:
+
+// Is 'irq' level-triggered?  The BIOS sets PCI interrupt lines so in
+// the edge/level control registers (ELCR) at 0x4d0 and 0x4d1.
+bool
+irq_is_level(int irq)
+{
+f010430d:	55                   	push   %ebp
+f010430e:	89 e5                	mov    %esp,%ebp
+f0104310:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	return (inb(0x4d0 + irq / 8) >> (irq % 8)) & 1;
+f0104313:	8d 51 07             	lea    0x7(%ecx),%edx
+f0104316:	85 c9                	test   %ecx,%ecx
+f0104318:	0f 49 d1             	cmovns %ecx,%edx
+f010431b:	c1 fa 03             	sar    $0x3,%edx
+f010431e:	81 c2 d0 04 00 00    	add    $0x4d0,%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0104324:	ec                   	in     (%dx),%al
+f0104325:	0f b6 c0             	movzbl %al,%eax
+f0104328:	83 e1 07             	and    $0x7,%ecx
+f010432b:	d3 f8                	sar    %cl,%eax
+f010432d:	83 e0 01             	and    $0x1,%eax
+}
+f0104330:	5d                   	pop    %ebp
+f0104331:	c3                   	ret
+
+f0104332 <irq_eoi>:
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104332:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104337:	ba 20 00 00 00       	mov    $0x20,%edx
+f010433c:	ee                   	out    %al,(%dx)
+f010433d:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0104342:	ee                   	out    %al,(%dx)
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC1, 0x20);
+	outb(IO_PIC2, 0x20);
+}
+f0104343:	c3                   	ret
+
+f0104344 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f0104344:	55                   	push   %ebp
+f0104345:	89 e5                	mov    %esp,%ebp
+f0104347:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f010434a:	ff 75 08             	push   0x8(%ebp)
+f010434d:	e8 ff c4 ff ff       	call   f0100851 <cputchar>
+	*cnt++;
+}
+f0104352:	83 c4 10             	add    $0x10,%esp
+f0104355:	c9                   	leave
+f0104356:	c3                   	ret
+
+f0104357 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0104357:	55                   	push   %ebp
+f0104358:	89 e5                	mov    %esp,%ebp
+f010435a:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f010435d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f0104364:	ff 75 0c             	push   0xc(%ebp)
+f0104367:	ff 75 08             	push   0x8(%ebp)
+f010436a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010436d:	50                   	push   %eax
+f010436e:	68 44 43 10 f0       	push   $0xf0104344
+f0104373:	e8 a1 25 00 00       	call   f0106919 <vprintfmt>
+	return cnt;
+}
+f0104378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010437b:	c9                   	leave
+f010437c:	c3                   	ret
+
+f010437d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f010437d:	55                   	push   %ebp
+f010437e:	89 e5                	mov    %esp,%ebp
+f0104380:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f0104383:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f0104386:	50                   	push   %eax
+f0104387:	ff 75 08             	push   0x8(%ebp)
+f010438a:	e8 c8 ff ff ff       	call   f0104357 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f010438f:	c9                   	leave
+f0104390:	c3                   	ret
+
+f0104391 <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f0104391:	55                   	push   %ebp
+f0104392:	89 e5                	mov    %esp,%ebp
+f0104394:	56                   	push   %esi
+f0104395:	53                   	push   %ebx
+	// user space on that CPU.
+
+	struct CpuInfo* current;
+	int cpu_id;
+
+	current = thiscpu;
+f0104396:	e8 a0 32 00 00       	call   f010763b <cpunum>
+f010439b:	89 c3                	mov    %eax,%ebx
+	cpu_id = cpunum();
+f010439d:	e8 99 32 00 00       	call   f010763b <cpunum>
+f01043a2:	89 c2                	mov    %eax,%edx
+
+	// Setup Cpu ID
+	current->cpu_id = cpu_id;
+f01043a4:	6b c3 7c             	imul   $0x7c,%ebx,%eax
+f01043a7:	88 90 20 70 a4 f0    	mov    %dl,-0xf5b8fe0(%eax)
+
+	// Setup a TSS so that we get the right stack
+	// when we trap to the kernel.
+	current->cpu_ts.ts_esp0 = KSTACKTOP - cpu_id * (KSTKSIZE + KSTKGAP);
+f01043ad:	89 d6                	mov    %edx,%esi
+f01043af:	c1 e6 10             	shl    $0x10,%esi
+f01043b2:	bb 00 00 00 f0       	mov    $0xf0000000,%ebx
+f01043b7:	29 f3                	sub    %esi,%ebx
+f01043b9:	89 98 30 70 a4 f0    	mov    %ebx,-0xf5b8fd0(%eax)
+	current->cpu_ts.ts_ss0 = GD_KD;
+f01043bf:	66 c7 80 34 70 a4 f0 	movw   $0x10,-0xf5b8fcc(%eax)
+f01043c6:	10 00 
+	current->cpu_ts.ts_iomb = sizeof(struct Taskstate);
+f01043c8:	66 c7 80 92 70 a4 f0 	movw   $0x68,-0xf5b8f6e(%eax)
+f01043cf:	68 00 
+
+	// Initialize the TSS slot of the gdt.
+	gdt[(GD_TSS0 >> 3) + cpu_id] = SEG16(STS_T32A, (uint32_t) (&current->cpu_ts),
+f01043d1:	83 c2 05             	add    $0x5,%edx
+f01043d4:	05 2c 70 a4 f0       	add    $0xf0a4702c,%eax
+f01043d9:	66 c7 04 d5 40 63 11 	movw   $0x67,-0xfee9cc0(,%edx,8)
+f01043e0:	f0 67 00 
+f01043e3:	66 89 04 d5 42 63 11 	mov    %ax,-0xfee9cbe(,%edx,8)
+f01043ea:	f0 
+f01043eb:	89 c1                	mov    %eax,%ecx
+f01043ed:	c1 e9 10             	shr    $0x10,%ecx
+f01043f0:	88 0c d5 44 63 11 f0 	mov    %cl,-0xfee9cbc(,%edx,8)
+f01043f7:	c6 04 d5 46 63 11 f0 	movb   $0x40,-0xfee9cba(,%edx,8)
+f01043fe:	40 
+f01043ff:	c1 e8 18             	shr    $0x18,%eax
+f0104402:	88 04 d5 47 63 11 f0 	mov    %al,-0xfee9cb9(,%edx,8)
+					sizeof(struct Taskstate) - 1, 0);
+	gdt[(GD_TSS0 >> 3) + cpu_id].sd_s = 0;
+f0104409:	c6 04 d5 45 63 11 f0 	movb   $0x89,-0xfee9cbb(,%edx,8)
+f0104410:	89 
+
+	// Load the TSS selector (like other segment selectors, the
+	// bottom three bits are special; we leave them 0)
+	ltr(GD_TSS(cpu_id));
+f0104411:	c1 e2 03             	shl    $0x3,%edx
+	asm volatile("ltr %0" : : "r" (sel));
+f0104414:	0f 00 da             	ltr    %dx
+	asm volatile("lidt (%0)" : : "r" (p));
+f0104417:	b8 ac 63 11 f0       	mov    $0xf01163ac,%eax
+f010441c:	0f 01 18             	lidtl  (%eax)
+}
+
+static inline void
+wrmsr(uint32_t msr, uint32_t lo, uint32_t hi)
+{
+	asm volatile("wrmsr"
+f010441f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104424:	b9 74 01 00 00       	mov    $0x174,%ecx
+f0104429:	b8 08 00 00 00       	mov    $0x8,%eax
+f010442e:	0f 30                	wrmsr
+f0104430:	b9 76 01 00 00       	mov    $0x176,%ecx
+f0104435:	b8 44 51 10 f0       	mov    $0xf0105144,%eax
+f010443a:	0f 30                	wrmsr
+f010443c:	b9 75 01 00 00       	mov    $0x175,%ecx
+f0104441:	89 d8                	mov    %ebx,%eax
+f0104443:	0f 30                	wrmsr
+
+	// Load the IDT
+	lidt(&idt_pd);
+	// setup fast syscall sysenter
+	sysenter_init(KSTACKTOP - cpu_id * (KSTKSIZE + KSTKGAP));
+}
+f0104445:	5b                   	pop    %ebx
+f0104446:	5e                   	pop    %esi
+f0104447:	5d                   	pop    %ebp
+f0104448:	c3                   	ret
+
+f0104449 <trap_init>:
+{
+f0104449:	55                   	push   %ebp
+f010444a:	89 e5                	mov    %esp,%ebp
+f010444c:	83 ec 08             	sub    $0x8,%esp
+	IDT_SET_INTR_MEMBER(DIVIDE);
+f010444f:	b8 5a 51 10 f0       	mov    $0xf010515a,%eax
+f0104454:	66 a3 60 42 a2 f0    	mov    %ax,0xf0a24260
+f010445a:	66 c7 05 62 42 a2 f0 	movw   $0x8,0xf0a24262
+f0104461:	08 00 
+f0104463:	c6 05 64 42 a2 f0 00 	movb   $0x0,0xf0a24264
+f010446a:	c6 05 65 42 a2 f0 8e 	movb   $0x8e,0xf0a24265
+f0104471:	c1 e8 10             	shr    $0x10,%eax
+f0104474:	66 a3 66 42 a2 f0    	mov    %ax,0xf0a24266
+	IDT_SET_INTR_MEMBER(DEBUG);
+f010447a:	b8 64 51 10 f0       	mov    $0xf0105164,%eax
+f010447f:	66 a3 68 42 a2 f0    	mov    %ax,0xf0a24268
+f0104485:	66 c7 05 6a 42 a2 f0 	movw   $0x8,0xf0a2426a
+f010448c:	08 00 
+f010448e:	c6 05 6c 42 a2 f0 00 	movb   $0x0,0xf0a2426c
+f0104495:	c6 05 6d 42 a2 f0 8e 	movb   $0x8e,0xf0a2426d
+f010449c:	c1 e8 10             	shr    $0x10,%eax
+f010449f:	66 a3 6e 42 a2 f0    	mov    %ax,0xf0a2426e
+	IDT_SET_INTR_MEMBER(NMI);
+f01044a5:	b8 6e 51 10 f0       	mov    $0xf010516e,%eax
+f01044aa:	66 a3 70 42 a2 f0    	mov    %ax,0xf0a24270
+f01044b0:	66 c7 05 72 42 a2 f0 	movw   $0x8,0xf0a24272
+f01044b7:	08 00 
+f01044b9:	c6 05 74 42 a2 f0 00 	movb   $0x0,0xf0a24274
+f01044c0:	c6 05 75 42 a2 f0 8e 	movb   $0x8e,0xf0a24275
+f01044c7:	c1 e8 10             	shr    $0x10,%eax
+f01044ca:	66 a3 76 42 a2 f0    	mov    %ax,0xf0a24276
+	IDT_SET_INTR_MEMBER_USER(BRKPT);
+f01044d0:	b8 78 51 10 f0       	mov    $0xf0105178,%eax
+f01044d5:	66 a3 78 42 a2 f0    	mov    %ax,0xf0a24278
+f01044db:	66 c7 05 7a 42 a2 f0 	movw   $0x8,0xf0a2427a
+f01044e2:	08 00 
+f01044e4:	c6 05 7c 42 a2 f0 00 	movb   $0x0,0xf0a2427c
+f01044eb:	c6 05 7d 42 a2 f0 ee 	movb   $0xee,0xf0a2427d
+f01044f2:	c1 e8 10             	shr    $0x10,%eax
+f01044f5:	66 a3 7e 42 a2 f0    	mov    %ax,0xf0a2427e
+	IDT_SET_INTR_MEMBER(OFLOW);
+f01044fb:	b8 82 51 10 f0       	mov    $0xf0105182,%eax
+f0104500:	66 a3 80 42 a2 f0    	mov    %ax,0xf0a24280
+f0104506:	66 c7 05 82 42 a2 f0 	movw   $0x8,0xf0a24282
+f010450d:	08 00 
+f010450f:	c6 05 84 42 a2 f0 00 	movb   $0x0,0xf0a24284
+f0104516:	c6 05 85 42 a2 f0 8e 	movb   $0x8e,0xf0a24285
+f010451d:	c1 e8 10             	shr    $0x10,%eax
+f0104520:	66 a3 86 42 a2 f0    	mov    %ax,0xf0a24286
+	IDT_SET_INTR_MEMBER(BOUND);
+f0104526:	b8 8c 51 10 f0       	mov    $0xf010518c,%eax
+f010452b:	66 a3 88 42 a2 f0    	mov    %ax,0xf0a24288
+f0104531:	66 c7 05 8a 42 a2 f0 	movw   $0x8,0xf0a2428a
+f0104538:	08 00 
+f010453a:	c6 05 8c 42 a2 f0 00 	movb   $0x0,0xf0a2428c
+f0104541:	c6 05 8d 42 a2 f0 8e 	movb   $0x8e,0xf0a2428d
+f0104548:	c1 e8 10             	shr    $0x10,%eax
+f010454b:	66 a3 8e 42 a2 f0    	mov    %ax,0xf0a2428e
+	IDT_SET_INTR_MEMBER(ILLOP);
+f0104551:	b8 96 51 10 f0       	mov    $0xf0105196,%eax
+f0104556:	66 a3 90 42 a2 f0    	mov    %ax,0xf0a24290
+f010455c:	66 c7 05 92 42 a2 f0 	movw   $0x8,0xf0a24292
+f0104563:	08 00 
+f0104565:	c6 05 94 42 a2 f0 00 	movb   $0x0,0xf0a24294
+f010456c:	c6 05 95 42 a2 f0 8e 	movb   $0x8e,0xf0a24295
+f0104573:	c1 e8 10             	shr    $0x10,%eax
+f0104576:	66 a3 96 42 a2 f0    	mov    %ax,0xf0a24296
+	IDT_SET_INTR_MEMBER(DEVICE);
+f010457c:	b8 9c 51 10 f0       	mov    $0xf010519c,%eax
+f0104581:	66 a3 98 42 a2 f0    	mov    %ax,0xf0a24298
+f0104587:	66 c7 05 9a 42 a2 f0 	movw   $0x8,0xf0a2429a
+f010458e:	08 00 
+f0104590:	c6 05 9c 42 a2 f0 00 	movb   $0x0,0xf0a2429c
+f0104597:	c6 05 9d 42 a2 f0 8e 	movb   $0x8e,0xf0a2429d
+f010459e:	c1 e8 10             	shr    $0x10,%eax
+f01045a1:	66 a3 9e 42 a2 f0    	mov    %ax,0xf0a2429e
+	IDT_SET_INTR_MEMBER(DBLFLT);
+f01045a7:	b8 a2 51 10 f0       	mov    $0xf01051a2,%eax
+f01045ac:	66 a3 a0 42 a2 f0    	mov    %ax,0xf0a242a0
+f01045b2:	66 c7 05 a2 42 a2 f0 	movw   $0x8,0xf0a242a2
+f01045b9:	08 00 
+f01045bb:	c6 05 a4 42 a2 f0 00 	movb   $0x0,0xf0a242a4
+f01045c2:	c6 05 a5 42 a2 f0 8e 	movb   $0x8e,0xf0a242a5
+f01045c9:	c1 e8 10             	shr    $0x10,%eax
+f01045cc:	66 a3 a6 42 a2 f0    	mov    %ax,0xf0a242a6
+	IDT_SET_INTR_MEMBER(TSS);
+f01045d2:	b8 a6 51 10 f0       	mov    $0xf01051a6,%eax
+f01045d7:	66 a3 b0 42 a2 f0    	mov    %ax,0xf0a242b0
+f01045dd:	66 c7 05 b2 42 a2 f0 	movw   $0x8,0xf0a242b2
+f01045e4:	08 00 
+f01045e6:	c6 05 b4 42 a2 f0 00 	movb   $0x0,0xf0a242b4
+f01045ed:	c6 05 b5 42 a2 f0 8e 	movb   $0x8e,0xf0a242b5
+f01045f4:	c1 e8 10             	shr    $0x10,%eax
+f01045f7:	66 a3 b6 42 a2 f0    	mov    %ax,0xf0a242b6
+	IDT_SET_INTR_MEMBER(SEGNP);
+f01045fd:	b8 aa 51 10 f0       	mov    $0xf01051aa,%eax
+f0104602:	66 a3 b8 42 a2 f0    	mov    %ax,0xf0a242b8
+f0104608:	66 c7 05 ba 42 a2 f0 	movw   $0x8,0xf0a242ba
+f010460f:	08 00 
+f0104611:	c6 05 bc 42 a2 f0 00 	movb   $0x0,0xf0a242bc
+f0104618:	c6 05 bd 42 a2 f0 8e 	movb   $0x8e,0xf0a242bd
+f010461f:	c1 e8 10             	shr    $0x10,%eax
+f0104622:	66 a3 be 42 a2 f0    	mov    %ax,0xf0a242be
+	IDT_SET_INTR_MEMBER(STACK);
+f0104628:	b8 ae 51 10 f0       	mov    $0xf01051ae,%eax
+f010462d:	66 a3 c0 42 a2 f0    	mov    %ax,0xf0a242c0
+f0104633:	66 c7 05 c2 42 a2 f0 	movw   $0x8,0xf0a242c2
+f010463a:	08 00 
+f010463c:	c6 05 c4 42 a2 f0 00 	movb   $0x0,0xf0a242c4
+f0104643:	c6 05 c5 42 a2 f0 8e 	movb   $0x8e,0xf0a242c5
+f010464a:	c1 e8 10             	shr    $0x10,%eax
+f010464d:	66 a3 c6 42 a2 f0    	mov    %ax,0xf0a242c6
+	IDT_SET_INTR_MEMBER(GPFLT);
+f0104653:	b8 b2 51 10 f0       	mov    $0xf01051b2,%eax
+f0104658:	66 a3 c8 42 a2 f0    	mov    %ax,0xf0a242c8
+f010465e:	66 c7 05 ca 42 a2 f0 	movw   $0x8,0xf0a242ca
+f0104665:	08 00 
+f0104667:	c6 05 cc 42 a2 f0 00 	movb   $0x0,0xf0a242cc
+f010466e:	c6 05 cd 42 a2 f0 8e 	movb   $0x8e,0xf0a242cd
+f0104675:	c1 e8 10             	shr    $0x10,%eax
+f0104678:	66 a3 ce 42 a2 f0    	mov    %ax,0xf0a242ce
+	IDT_SET_INTR_MEMBER(PGFLT);
+f010467e:	b8 b6 51 10 f0       	mov    $0xf01051b6,%eax
+f0104683:	66 a3 d0 42 a2 f0    	mov    %ax,0xf0a242d0
+f0104689:	66 c7 05 d2 42 a2 f0 	movw   $0x8,0xf0a242d2
+f0104690:	08 00 
+f0104692:	c6 05 d4 42 a2 f0 00 	movb   $0x0,0xf0a242d4
+f0104699:	c6 05 d5 42 a2 f0 8e 	movb   $0x8e,0xf0a242d5
+f01046a0:	c1 e8 10             	shr    $0x10,%eax
+f01046a3:	66 a3 d6 42 a2 f0    	mov    %ax,0xf0a242d6
+	IDT_SET_INTR_MEMBER(FPERR);
+f01046a9:	b8 ba 51 10 f0       	mov    $0xf01051ba,%eax
+f01046ae:	66 a3 e0 42 a2 f0    	mov    %ax,0xf0a242e0
+f01046b4:	66 c7 05 e2 42 a2 f0 	movw   $0x8,0xf0a242e2
+f01046bb:	08 00 
+f01046bd:	c6 05 e4 42 a2 f0 00 	movb   $0x0,0xf0a242e4
+f01046c4:	c6 05 e5 42 a2 f0 8e 	movb   $0x8e,0xf0a242e5
+f01046cb:	c1 e8 10             	shr    $0x10,%eax
+f01046ce:	66 a3 e6 42 a2 f0    	mov    %ax,0xf0a242e6
+	IDT_SET_INTR_MEMBER(ALIGN);
+f01046d4:	b8 c0 51 10 f0       	mov    $0xf01051c0,%eax
+f01046d9:	66 a3 e8 42 a2 f0    	mov    %ax,0xf0a242e8
+f01046df:	66 c7 05 ea 42 a2 f0 	movw   $0x8,0xf0a242ea
+f01046e6:	08 00 
+f01046e8:	c6 05 ec 42 a2 f0 00 	movb   $0x0,0xf0a242ec
+f01046ef:	c6 05 ed 42 a2 f0 8e 	movb   $0x8e,0xf0a242ed
+f01046f6:	c1 e8 10             	shr    $0x10,%eax
+f01046f9:	66 a3 ee 42 a2 f0    	mov    %ax,0xf0a242ee
+	IDT_SET_INTR_MEMBER(MCHK);
+f01046ff:	b8 c4 51 10 f0       	mov    $0xf01051c4,%eax
+f0104704:	66 a3 f0 42 a2 f0    	mov    %ax,0xf0a242f0
+f010470a:	66 c7 05 f2 42 a2 f0 	movw   $0x8,0xf0a242f2
+f0104711:	08 00 
+f0104713:	c6 05 f4 42 a2 f0 00 	movb   $0x0,0xf0a242f4
+f010471a:	c6 05 f5 42 a2 f0 8e 	movb   $0x8e,0xf0a242f5
+f0104721:	c1 e8 10             	shr    $0x10,%eax
+f0104724:	66 a3 f6 42 a2 f0    	mov    %ax,0xf0a242f6
+	IDT_SET_INTR_MEMBER(SIMDERR);
+f010472a:	b8 ca 51 10 f0       	mov    $0xf01051ca,%eax
+f010472f:	66 a3 f8 42 a2 f0    	mov    %ax,0xf0a242f8
+f0104735:	66 c7 05 fa 42 a2 f0 	movw   $0x8,0xf0a242fa
+f010473c:	08 00 
+f010473e:	c6 05 fc 42 a2 f0 00 	movb   $0x0,0xf0a242fc
+f0104745:	c6 05 fd 42 a2 f0 8e 	movb   $0x8e,0xf0a242fd
+f010474c:	c1 e8 10             	shr    $0x10,%eax
+f010474f:	66 a3 fe 42 a2 f0    	mov    %ax,0xf0a242fe
+	IDT_SET_EXTERNAL_INTR_MEMBER(TIMER);
+f0104755:	b8 d0 51 10 f0       	mov    $0xf01051d0,%eax
+f010475a:	66 a3 60 43 a2 f0    	mov    %ax,0xf0a24360
+f0104760:	66 c7 05 62 43 a2 f0 	movw   $0x8,0xf0a24362
+f0104767:	08 00 
+f0104769:	c6 05 64 43 a2 f0 00 	movb   $0x0,0xf0a24364
+f0104770:	c6 05 65 43 a2 f0 8e 	movb   $0x8e,0xf0a24365
+f0104777:	c1 e8 10             	shr    $0x10,%eax
+f010477a:	66 a3 66 43 a2 f0    	mov    %ax,0xf0a24366
+	IDT_SET_EXTERNAL_INTR_MEMBER(KBD);
+f0104780:	b8 d6 51 10 f0       	mov    $0xf01051d6,%eax
+f0104785:	66 a3 68 43 a2 f0    	mov    %ax,0xf0a24368
+f010478b:	66 c7 05 6a 43 a2 f0 	movw   $0x8,0xf0a2436a
+f0104792:	08 00 
+f0104794:	c6 05 6c 43 a2 f0 00 	movb   $0x0,0xf0a2436c
+f010479b:	c6 05 6d 43 a2 f0 8e 	movb   $0x8e,0xf0a2436d
+f01047a2:	c1 e8 10             	shr    $0x10,%eax
+f01047a5:	66 a3 6e 43 a2 f0    	mov    %ax,0xf0a2436e
+	IDT_SET_EXTERNAL_INTR_MEMBER(SERIAL);
+f01047ab:	b8 dc 51 10 f0       	mov    $0xf01051dc,%eax
+f01047b0:	66 a3 80 43 a2 f0    	mov    %ax,0xf0a24380
+f01047b6:	66 c7 05 82 43 a2 f0 	movw   $0x8,0xf0a24382
+f01047bd:	08 00 
+f01047bf:	c6 05 84 43 a2 f0 00 	movb   $0x0,0xf0a24384
+f01047c6:	c6 05 85 43 a2 f0 8e 	movb   $0x8e,0xf0a24385
+f01047cd:	c1 e8 10             	shr    $0x10,%eax
+f01047d0:	66 a3 86 43 a2 f0    	mov    %ax,0xf0a24386
+	IDT_SET_EXTERNAL_INTR_MEMBER(SPURIOUS);
+f01047d6:	b8 e2 51 10 f0       	mov    $0xf01051e2,%eax
+f01047db:	66 a3 98 43 a2 f0    	mov    %ax,0xf0a24398
+f01047e1:	66 c7 05 9a 43 a2 f0 	movw   $0x8,0xf0a2439a
+f01047e8:	08 00 
+f01047ea:	c6 05 9c 43 a2 f0 00 	movb   $0x0,0xf0a2439c
+f01047f1:	c6 05 9d 43 a2 f0 8e 	movb   $0x8e,0xf0a2439d
+f01047f8:	c1 e8 10             	shr    $0x10,%eax
+f01047fb:	66 a3 9e 43 a2 f0    	mov    %ax,0xf0a2439e
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI9);
+f0104801:	b8 e8 51 10 f0       	mov    $0xf01051e8,%eax
+f0104806:	66 a3 a8 43 a2 f0    	mov    %ax,0xf0a243a8
+f010480c:	66 c7 05 aa 43 a2 f0 	movw   $0x8,0xf0a243aa
+f0104813:	08 00 
+f0104815:	c6 05 ac 43 a2 f0 00 	movb   $0x0,0xf0a243ac
+f010481c:	c6 05 ad 43 a2 f0 8e 	movb   $0x8e,0xf0a243ad
+f0104823:	c1 e8 10             	shr    $0x10,%eax
+f0104826:	66 a3 ae 43 a2 f0    	mov    %ax,0xf0a243ae
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI10);
+f010482c:	b8 ee 51 10 f0       	mov    $0xf01051ee,%eax
+f0104831:	66 a3 b0 43 a2 f0    	mov    %ax,0xf0a243b0
+f0104837:	66 c7 05 b2 43 a2 f0 	movw   $0x8,0xf0a243b2
+f010483e:	08 00 
+f0104840:	c6 05 b4 43 a2 f0 00 	movb   $0x0,0xf0a243b4
+f0104847:	c6 05 b5 43 a2 f0 8e 	movb   $0x8e,0xf0a243b5
+f010484e:	c1 e8 10             	shr    $0x10,%eax
+f0104851:	66 a3 b6 43 a2 f0    	mov    %ax,0xf0a243b6
+	IDT_SET_EXTERNAL_INTR_MEMBER(PCI11);
+f0104857:	b8 f4 51 10 f0       	mov    $0xf01051f4,%eax
+f010485c:	66 a3 b8 43 a2 f0    	mov    %ax,0xf0a243b8
+f0104862:	66 c7 05 ba 43 a2 f0 	movw   $0x8,0xf0a243ba
+f0104869:	08 00 
+f010486b:	c6 05 bc 43 a2 f0 00 	movb   $0x0,0xf0a243bc
+f0104872:	c6 05 bd 43 a2 f0 8e 	movb   $0x8e,0xf0a243bd
+f0104879:	c1 e8 10             	shr    $0x10,%eax
+f010487c:	66 a3 be 43 a2 f0    	mov    %ax,0xf0a243be
+	IDT_SET_EXTERNAL_INTR_MEMBER(IDE);
+f0104882:	b8 fa 51 10 f0       	mov    $0xf01051fa,%eax
+f0104887:	66 a3 d0 43 a2 f0    	mov    %ax,0xf0a243d0
+f010488d:	66 c7 05 d2 43 a2 f0 	movw   $0x8,0xf0a243d2
+f0104894:	08 00 
+f0104896:	c6 05 d4 43 a2 f0 00 	movb   $0x0,0xf0a243d4
+f010489d:	c6 05 d5 43 a2 f0 8e 	movb   $0x8e,0xf0a243d5
+f01048a4:	c1 e8 10             	shr    $0x10,%eax
+f01048a7:	66 a3 d6 43 a2 f0    	mov    %ax,0xf0a243d6
+	IDT_SET_EXTERNAL_INTR_MEMBER(IDE2);
+f01048ad:	b8 00 52 10 f0       	mov    $0xf0105200,%eax
+f01048b2:	66 a3 d8 43 a2 f0    	mov    %ax,0xf0a243d8
+f01048b8:	66 c7 05 da 43 a2 f0 	movw   $0x8,0xf0a243da
+f01048bf:	08 00 
+f01048c1:	c6 05 dc 43 a2 f0 00 	movb   $0x0,0xf0a243dc
+f01048c8:	c6 05 dd 43 a2 f0 8e 	movb   $0x8e,0xf0a243dd
+f01048cf:	c1 e8 10             	shr    $0x10,%eax
+f01048d2:	66 a3 de 43 a2 f0    	mov    %ax,0xf0a243de
+	IDT_SET_EXTERNAL_INTR_MEMBER(ERROR);
+f01048d8:	b8 06 52 10 f0       	mov    $0xf0105206,%eax
+f01048dd:	66 a3 f8 43 a2 f0    	mov    %ax,0xf0a243f8
+f01048e3:	66 c7 05 fa 43 a2 f0 	movw   $0x8,0xf0a243fa
+f01048ea:	08 00 
+f01048ec:	c6 05 fc 43 a2 f0 00 	movb   $0x0,0xf0a243fc
+f01048f3:	c6 05 fd 43 a2 f0 8e 	movb   $0x8e,0xf0a243fd
+f01048fa:	c1 e8 10             	shr    $0x10,%eax
+f01048fd:	66 a3 fe 43 a2 f0    	mov    %ax,0xf0a243fe
+	IDT_SET_INTR_MEMBER_USER(SYSCALL);
+f0104903:	b8 0c 52 10 f0       	mov    $0xf010520c,%eax
+f0104908:	66 a3 e0 43 a2 f0    	mov    %ax,0xf0a243e0
+f010490e:	66 c7 05 e2 43 a2 f0 	movw   $0x8,0xf0a243e2
+f0104915:	08 00 
+f0104917:	c6 05 e4 43 a2 f0 00 	movb   $0x0,0xf0a243e4
+f010491e:	c6 05 e5 43 a2 f0 ee 	movb   $0xee,0xf0a243e5
+f0104925:	c1 e8 10             	shr    $0x10,%eax
+f0104928:	66 a3 e6 43 a2 f0    	mov    %ax,0xf0a243e6
+	IDT_SET_INTR_MEMBER(TLBFLUSH);
+f010492e:	b8 12 52 10 f0       	mov    $0xf0105212,%eax
+f0104933:	66 a3 e8 43 a2 f0    	mov    %ax,0xf0a243e8
+f0104939:	66 c7 05 ea 43 a2 f0 	movw   $0x8,0xf0a243ea
+f0104940:	08 00 
+f0104942:	c6 05 ec 43 a2 f0 00 	movb   $0x0,0xf0a243ec
+f0104949:	c6 05 ed 43 a2 f0 8e 	movb   $0x8e,0xf0a243ed
+f0104950:	c1 e8 10             	shr    $0x10,%eax
+f0104953:	66 a3 ee 43 a2 f0    	mov    %ax,0xf0a243ee
+	trap_init_percpu();
+f0104959:	e8 33 fa ff ff       	call   f0104391 <trap_init_percpu>
+}
+f010495e:	c9                   	leave
+f010495f:	c3                   	ret
+
+f0104960 <print_regs>:
+	}
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f0104960:	55                   	push   %ebp
+f0104961:	89 e5                	mov    %esp,%ebp
+f0104963:	53                   	push   %ebx
+f0104964:	83 ec 0c             	sub    $0xc,%esp
+f0104967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f010496a:	ff 33                	push   (%ebx)
+f010496c:	68 9c a2 10 f0       	push   $0xf010a29c
+f0104971:	e8 07 fa ff ff       	call   f010437d <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f0104976:	83 c4 08             	add    $0x8,%esp
+f0104979:	ff 73 04             	push   0x4(%ebx)
+f010497c:	68 ab a2 10 f0       	push   $0xf010a2ab
+f0104981:	e8 f7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f0104986:	83 c4 08             	add    $0x8,%esp
+f0104989:	ff 73 08             	push   0x8(%ebx)
+f010498c:	68 ba a2 10 f0       	push   $0xf010a2ba
+f0104991:	e8 e7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f0104996:	83 c4 08             	add    $0x8,%esp
+f0104999:	ff 73 0c             	push   0xc(%ebx)
+f010499c:	68 c9 a2 10 f0       	push   $0xf010a2c9
+f01049a1:	e8 d7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f01049a6:	83 c4 08             	add    $0x8,%esp
+f01049a9:	ff 73 10             	push   0x10(%ebx)
+f01049ac:	68 d8 a2 10 f0       	push   $0xf010a2d8
+f01049b1:	e8 c7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f01049b6:	83 c4 08             	add    $0x8,%esp
+f01049b9:	ff 73 14             	push   0x14(%ebx)
+f01049bc:	68 e7 a2 10 f0       	push   $0xf010a2e7
+f01049c1:	e8 b7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f01049c6:	83 c4 08             	add    $0x8,%esp
+f01049c9:	ff 73 18             	push   0x18(%ebx)
+f01049cc:	68 f6 a2 10 f0       	push   $0xf010a2f6
+f01049d1:	e8 a7 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f01049d6:	83 c4 08             	add    $0x8,%esp
+f01049d9:	ff 73 1c             	push   0x1c(%ebx)
+f01049dc:	68 05 a3 10 f0       	push   $0xf010a305
+f01049e1:	e8 97 f9 ff ff       	call   f010437d <cprintf>
+}
+f01049e6:	83 c4 10             	add    $0x10,%esp
+f01049e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01049ec:	c9                   	leave
+f01049ed:	c3                   	ret
+
+f01049ee <print_trapframe>:
+{
+f01049ee:	55                   	push   %ebp
+f01049ef:	89 e5                	mov    %esp,%ebp
+f01049f1:	56                   	push   %esi
+f01049f2:	53                   	push   %ebx
+f01049f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f01049f6:	e8 40 2c 00 00       	call   f010763b <cpunum>
+f01049fb:	83 ec 04             	sub    $0x4,%esp
+f01049fe:	50                   	push   %eax
+f01049ff:	53                   	push   %ebx
+f0104a00:	68 4e a4 10 f0       	push   $0xf010a44e
+f0104a05:	e8 73 f9 ff ff       	call   f010437d <cprintf>
+	print_regs(&tf->tf_regs);
+f0104a0a:	89 1c 24             	mov    %ebx,(%esp)
+f0104a0d:	e8 4e ff ff ff       	call   f0104960 <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f0104a12:	83 c4 08             	add    $0x8,%esp
+f0104a15:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f0104a19:	50                   	push   %eax
+f0104a1a:	68 6c a4 10 f0       	push   $0xf010a46c
+f0104a1f:	e8 59 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0104a24:	83 c4 08             	add    $0x8,%esp
+f0104a27:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0104a2b:	50                   	push   %eax
+f0104a2c:	68 7f a4 10 f0       	push   $0xf010a47f
+f0104a31:	e8 47 f9 ff ff       	call   f010437d <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104a36:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < ARRAY_SIZE(excnames))
+f0104a39:	83 c4 10             	add    $0x10,%esp
+f0104a3c:	83 f8 13             	cmp    $0x13,%eax
+f0104a3f:	76 27                	jbe    f0104a68 <print_trapframe+0x7a>
+		return "System call";
+f0104a41:	ba 14 a3 10 f0       	mov    $0xf010a314,%edx
+	if (trapno == T_SYSCALL)
+f0104a46:	83 f8 30             	cmp    $0x30,%eax
+f0104a49:	74 24                	je     f0104a6f <print_trapframe+0x81>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16) {
+f0104a4b:	8d 48 e0             	lea    -0x20(%eax),%ecx
+	return "(unknown trap)";
+f0104a4e:	ba 20 a3 10 f0       	mov    $0xf010a320,%edx
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16) {
+f0104a53:	83 f9 0f             	cmp    $0xf,%ecx
+f0104a56:	77 17                	ja     f0104a6f <print_trapframe+0x81>
+		switch (trapno) {
+f0104a58:	83 f9 13             	cmp    $0x13,%ecx
+f0104a5b:	0f 87 cf 00 00 00    	ja     f0104b30 <print_trapframe+0x142>
+f0104a61:	ff 24 8d 00 a7 10 f0 	jmp    *-0xfef5900(,%ecx,4)
+		return excnames[trapno];
+f0104a68:	8b 14 85 20 a8 10 f0 	mov    -0xfef57e0(,%eax,4),%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104a6f:	83 ec 04             	sub    $0x4,%esp
+f0104a72:	52                   	push   %edx
+f0104a73:	50                   	push   %eax
+f0104a74:	68 92 a4 10 f0       	push   $0xf010a492
+f0104a79:	e8 ff f8 ff ff       	call   f010437d <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104a7e:	83 c4 10             	add    $0x10,%esp
+f0104a81:	39 1d 60 4a a2 f0    	cmp    %ebx,0xf0a24a60
+f0104a87:	0f 84 11 01 00 00    	je     f0104b9e <print_trapframe+0x1b0>
+	cprintf("  err  0x%08x", tf->tf_err);
+f0104a8d:	83 ec 08             	sub    $0x8,%esp
+f0104a90:	ff 73 2c             	push   0x2c(%ebx)
+f0104a93:	68 b3 a4 10 f0       	push   $0xf010a4b3
+f0104a98:	e8 e0 f8 ff ff       	call   f010437d <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f0104a9d:	83 c4 10             	add    $0x10,%esp
+f0104aa0:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104aa4:	0f 85 17 01 00 00    	jne    f0104bc1 <print_trapframe+0x1d3>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f0104aaa:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f0104aad:	a8 01                	test   $0x1,%al
+f0104aaf:	b9 32 a4 10 f0       	mov    $0xf010a432,%ecx
+f0104ab4:	ba 27 a4 10 f0       	mov    $0xf010a427,%edx
+f0104ab9:	0f 45 ca             	cmovne %edx,%ecx
+f0104abc:	a8 02                	test   $0x2,%al
+f0104abe:	ba 44 a4 10 f0       	mov    $0xf010a444,%edx
+f0104ac3:	be 3e a4 10 f0       	mov    $0xf010a43e,%esi
+f0104ac8:	0f 45 d6             	cmovne %esi,%edx
+f0104acb:	a8 04                	test   $0x4,%al
+f0104acd:	b8 ad a5 10 f0       	mov    $0xf010a5ad,%eax
+f0104ad2:	be 49 a4 10 f0       	mov    $0xf010a449,%esi
+f0104ad7:	0f 45 c6             	cmovne %esi,%eax
+f0104ada:	51                   	push   %ecx
+f0104adb:	52                   	push   %edx
+f0104adc:	50                   	push   %eax
+f0104add:	68 c1 a4 10 f0       	push   $0xf010a4c1
+f0104ae2:	e8 96 f8 ff ff       	call   f010437d <cprintf>
+f0104ae7:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0104aea:	83 ec 08             	sub    $0x8,%esp
+f0104aed:	ff 73 30             	push   0x30(%ebx)
+f0104af0:	68 d0 a4 10 f0       	push   $0xf010a4d0
+f0104af5:	e8 83 f8 ff ff       	call   f010437d <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f0104afa:	83 c4 08             	add    $0x8,%esp
+f0104afd:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104b01:	50                   	push   %eax
+f0104b02:	68 df a4 10 f0       	push   $0xf010a4df
+f0104b07:	e8 71 f8 ff ff       	call   f010437d <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0104b0c:	83 c4 08             	add    $0x8,%esp
+f0104b0f:	ff 73 38             	push   0x38(%ebx)
+f0104b12:	68 f2 a4 10 f0       	push   $0xf010a4f2
+f0104b17:	e8 61 f8 ff ff       	call   f010437d <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f0104b1c:	83 c4 10             	add    $0x10,%esp
+f0104b1f:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104b23:	0f 85 ad 00 00 00    	jne    f0104bd6 <print_trapframe+0x1e8>
+}
+f0104b29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104b2c:	5b                   	pop    %ebx
+f0104b2d:	5e                   	pop    %esi
+f0104b2e:	5d                   	pop    %ebp
+f0104b2f:	c3                   	ret
+	return "(unknown trap)";
+f0104b30:	ba 20 a3 10 f0       	mov    $0xf010a320,%edx
+f0104b35:	e9 35 ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(KBD);
+f0104b3a:	ba 48 a3 10 f0       	mov    $0xf010a348,%edx
+f0104b3f:	e9 2b ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(SERIAL);
+f0104b44:	ba 5f a3 10 f0       	mov    $0xf010a35f,%edx
+f0104b49:	e9 21 ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(SPURIOUS);
+f0104b4e:	ba 79 a3 10 f0       	mov    $0xf010a379,%edx
+f0104b53:	e9 17 ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(PCI9);
+f0104b58:	ba 95 a3 10 f0       	mov    $0xf010a395,%edx
+f0104b5d:	e9 0d ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(PCI10);
+f0104b62:	ba ad a3 10 f0       	mov    $0xf010a3ad,%edx
+f0104b67:	e9 03 ff ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(PCI11);
+f0104b6c:	ba c6 a3 10 f0       	mov    $0xf010a3c6,%edx
+f0104b71:	e9 f9 fe ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(IDE);
+f0104b76:	ba df a3 10 f0       	mov    $0xf010a3df,%edx
+f0104b7b:	e9 ef fe ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(IDE2);
+f0104b80:	ba f6 a3 10 f0       	mov    $0xf010a3f6,%edx
+f0104b85:	e9 e5 fe ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+			RETURN_IRQ_DESC(ERROR);
+f0104b8a:	ba 0e a4 10 f0       	mov    $0xf010a40e,%edx
+f0104b8f:	e9 db fe ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+		switch (trapno) {
+f0104b94:	ba 2f a3 10 f0       	mov    $0xf010a32f,%edx
+f0104b99:	e9 d1 fe ff ff       	jmp    f0104a6f <print_trapframe+0x81>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104b9e:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104ba2:	0f 85 e5 fe ff ff    	jne    f0104a8d <print_trapframe+0x9f>
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f0104ba8:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f0104bab:	83 ec 08             	sub    $0x8,%esp
+f0104bae:	50                   	push   %eax
+f0104baf:	68 a4 a4 10 f0       	push   $0xf010a4a4
+f0104bb4:	e8 c4 f7 ff ff       	call   f010437d <cprintf>
+f0104bb9:	83 c4 10             	add    $0x10,%esp
+f0104bbc:	e9 cc fe ff ff       	jmp    f0104a8d <print_trapframe+0x9f>
+		cprintf("\n");
+f0104bc1:	83 ec 0c             	sub    $0xc,%esp
+f0104bc4:	68 12 a2 10 f0       	push   $0xf010a212
+f0104bc9:	e8 af f7 ff ff       	call   f010437d <cprintf>
+f0104bce:	83 c4 10             	add    $0x10,%esp
+f0104bd1:	e9 14 ff ff ff       	jmp    f0104aea <print_trapframe+0xfc>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0104bd6:	83 ec 08             	sub    $0x8,%esp
+f0104bd9:	ff 73 3c             	push   0x3c(%ebx)
+f0104bdc:	68 01 a5 10 f0       	push   $0xf010a501
+f0104be1:	e8 97 f7 ff ff       	call   f010437d <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0104be6:	83 c4 08             	add    $0x8,%esp
+f0104be9:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104bed:	50                   	push   %eax
+f0104bee:	68 10 a5 10 f0       	push   $0xf010a510
+f0104bf3:	e8 85 f7 ff ff       	call   f010437d <cprintf>
+f0104bf8:	83 c4 10             	add    $0x10,%esp
+}
+f0104bfb:	e9 29 ff ff ff       	jmp    f0104b29 <print_trapframe+0x13b>
+
+f0104c00 <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0104c00:	55                   	push   %ebp
+f0104c01:	89 e5                	mov    %esp,%ebp
+f0104c03:	57                   	push   %edi
+f0104c04:	56                   	push   %esi
+f0104c05:	53                   	push   %ebx
+f0104c06:	83 ec 1c             	sub    $0x1c,%esp
+f0104c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104c0c:	0f 20 d7             	mov    %cr2,%edi
+
+	// Read processor's CR2 register to find the faulting address
+	fault_va = rcr2();
+
+	// Handle kernel-mode page faults.
+	if ((tf->tf_cs & 0x3) == 0) {
+f0104c0f:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104c13:	0f 84 05 01 00 00    	je     f0104d1e <page_fault_handler+0x11e>
+	//   user_mem_assert() and env_run() are useful here.
+	//   To change what the user environment runs, modify 'curenv->env_tf'
+	//   (the 'tf' variable points at 'curenv->env_tf').
+
+	struct UTrapframe *utf;
+	uintptr_t uxstacktop = curenv->env_uxstacktop;
+f0104c19:	e8 1d 2a 00 00       	call   f010763b <cpunum>
+f0104c1e:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104c21:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104c27:	8b 70 68             	mov    0x68(%eax),%esi
+	int r;
+
+	// If there's no page fault upcall, destroy env
+	if (!curenv->env_pgfault_upcall) {
+f0104c2a:	e8 0c 2a 00 00       	call   f010763b <cpunum>
+f0104c2f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104c32:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104c38:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f0104c3c:	0f 84 39 01 00 00    	je     f0104d7b <page_fault_handler+0x17b>
+		log("there's no pg_fault_upcall.");
+		goto destroy_env;
+	}
+	// if the environment didn't allocate a page for its exception stack or 
+	// can't write to it, destroy env
+	if ((r = user_mem_check2(curenv, (void*)(uxstacktop - PGSIZE), PGSIZE, PTE_P | PTE_U | PTE_W, NULL)) < 0) {
+f0104c42:	8d 86 00 f0 ff ff    	lea    -0x1000(%esi),%eax
+f0104c48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104c4b:	e8 eb 29 00 00       	call   f010763b <cpunum>
+f0104c50:	83 ec 0c             	sub    $0xc,%esp
+f0104c53:	6a 00                	push   $0x0
+f0104c55:	6a 07                	push   $0x7
+f0104c57:	68 00 10 00 00       	push   $0x1000
+f0104c5c:	ff 75 e4             	push   -0x1c(%ebp)
+f0104c5f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104c62:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104c68:	e8 cf ec ff ff       	call   f010393c <user_mem_check2>
+f0104c6d:	83 c4 20             	add    $0x20,%esp
+f0104c70:	85 c0                	test   %eax,%eax
+f0104c72:	0f 88 03 01 00 00    	js     f0104d7b <page_fault_handler+0x17b>
+		log("there's no mapped user exception stack");
+		goto destroy_env;
+	}
+	// if the exception stack overflows into the empty page below it,
+	// destroy env
+	if (tf->tf_esp < uxstacktop-PGSIZE && tf->tf_esp >= uxstacktop-2*PGSIZE) {
+f0104c78:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104c7b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0104c7e:	39 c8                	cmp    %ecx,%eax
+f0104c80:	0f 83 b6 00 00 00    	jae    f0104d3c <page_fault_handler+0x13c>
+f0104c86:	8d 96 00 e0 ff ff    	lea    -0x2000(%esi),%edx
+f0104c8c:	39 d0                	cmp    %edx,%eax
+f0104c8e:	0f 83 e7 00 00 00    	jae    f0104d7b <page_fault_handler+0x17b>
+	// set user exception stack
+	// recursive case, 
+	if (tf->tf_esp >= uxstacktop-PGSIZE && tf->tf_esp < uxstacktop) {
+		utf = (void*)tf->tf_esp - 4 - sizeof(struct UTrapframe);
+	} else {
+		utf = (void*)uxstacktop - sizeof(struct UTrapframe);
+f0104c94:	8d 46 cc             	lea    -0x34(%esi),%eax
+	}
+	utf->utf_eflags = tf->tf_eflags;
+f0104c97:	8b 53 38             	mov    0x38(%ebx),%edx
+f0104c9a:	89 50 2c             	mov    %edx,0x2c(%eax)
+	utf->utf_eip = tf->tf_eip;
+f0104c9d:	8b 53 30             	mov    0x30(%ebx),%edx
+f0104ca0:	89 50 28             	mov    %edx,0x28(%eax)
+	utf->utf_err = tf->tf_err;
+f0104ca3:	8b 53 2c             	mov    0x2c(%ebx),%edx
+f0104ca6:	89 50 04             	mov    %edx,0x4(%eax)
+	utf->utf_esp = tf->tf_esp;
+f0104ca9:	8b 53 3c             	mov    0x3c(%ebx),%edx
+f0104cac:	89 50 30             	mov    %edx,0x30(%eax)
+	utf->utf_fault_va = fault_va;
+f0104caf:	89 38                	mov    %edi,(%eax)
+	utf->utf_regs = tf->tf_regs;
+f0104cb1:	8b 13                	mov    (%ebx),%edx
+f0104cb3:	89 50 08             	mov    %edx,0x8(%eax)
+f0104cb6:	8b 53 04             	mov    0x4(%ebx),%edx
+f0104cb9:	89 50 0c             	mov    %edx,0xc(%eax)
+f0104cbc:	8b 53 08             	mov    0x8(%ebx),%edx
+f0104cbf:	89 50 10             	mov    %edx,0x10(%eax)
+f0104cc2:	8b 53 0c             	mov    0xc(%ebx),%edx
+f0104cc5:	89 50 14             	mov    %edx,0x14(%eax)
+f0104cc8:	8b 53 10             	mov    0x10(%ebx),%edx
+f0104ccb:	89 50 18             	mov    %edx,0x18(%eax)
+f0104cce:	8b 53 14             	mov    0x14(%ebx),%edx
+f0104cd1:	89 50 1c             	mov    %edx,0x1c(%eax)
+f0104cd4:	8b 53 18             	mov    0x18(%ebx),%edx
+f0104cd7:	89 50 20             	mov    %edx,0x20(%eax)
+f0104cda:	8b 53 1c             	mov    0x1c(%ebx),%edx
+f0104cdd:	89 50 24             	mov    %edx,0x24(%eax)
+	tf->tf_esp = (uintptr_t)utf;
+f0104ce0:	89 43 3c             	mov    %eax,0x3c(%ebx)
+	tf->tf_eip = (uintptr_t)curenv->env_pgfault_upcall;
+f0104ce3:	e8 53 29 00 00       	call   f010763b <cpunum>
+f0104ce8:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104ceb:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104cf1:	8b 40 64             	mov    0x64(%eax),%eax
+f0104cf4:	89 43 30             	mov    %eax,0x30(%ebx)
+	// log("cs: 0x%x, ip: 0x%x, ss: 0x%x, sp: 0x:%x", tf->tf_cs, tf->tf_eip, tf->tf_ss, tf->tf_esp);
+	assert(tf->tf_ss == (GD_UD | 0x3));
+f0104cf7:	66 83 7b 40 23       	cmpw   $0x23,0x40(%ebx)
+f0104cfc:	75 4e                	jne    f0104d4c <page_fault_handler+0x14c>
+	assert(tf->tf_cs == (GD_UT | 0x3));
+f0104cfe:	66 83 7b 34 1b       	cmpw   $0x1b,0x34(%ebx)
+f0104d03:	74 60                	je     f0104d65 <page_fault_handler+0x165>
+f0104d05:	68 4a a5 10 f0       	push   $0xf010a54a
+f0104d0a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0104d0f:	68 f8 01 00 00       	push   $0x1f8
+f0104d14:	68 23 a5 10 f0       	push   $0xf010a523
+f0104d19:	e8 22 b3 ff ff       	call   f0100040 <_panic>
+		panic("kernel memory access error, va 0x%08x ip %08x err %08x", fault_va, tf->tf_eip, tf->tf_err);
+f0104d1e:	83 ec 08             	sub    $0x8,%esp
+f0104d21:	ff 73 2c             	push   0x2c(%ebx)
+f0104d24:	ff 73 30             	push   0x30(%ebx)
+f0104d27:	57                   	push   %edi
+f0104d28:	68 70 a8 10 f0       	push   $0xf010a870
+f0104d2d:	68 ae 01 00 00       	push   $0x1ae
+f0104d32:	68 23 a5 10 f0       	push   $0xf010a523
+f0104d37:	e8 04 b3 ff ff       	call   f0100040 <_panic>
+	if (tf->tf_esp >= uxstacktop-PGSIZE && tf->tf_esp < uxstacktop) {
+f0104d3c:	39 f0                	cmp    %esi,%eax
+f0104d3e:	0f 83 50 ff ff ff    	jae    f0104c94 <page_fault_handler+0x94>
+		utf = (void*)tf->tf_esp - 4 - sizeof(struct UTrapframe);
+f0104d44:	83 e8 38             	sub    $0x38,%eax
+f0104d47:	e9 4b ff ff ff       	jmp    f0104c97 <page_fault_handler+0x97>
+	assert(tf->tf_ss == (GD_UD | 0x3));
+f0104d4c:	68 2f a5 10 f0       	push   $0xf010a52f
+f0104d51:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0104d56:	68 f7 01 00 00       	push   $0x1f7
+f0104d5b:	68 23 a5 10 f0       	push   $0xf010a523
+f0104d60:	e8 db b2 ff ff       	call   f0100040 <_panic>
+	env_run(curenv);
+f0104d65:	e8 d1 28 00 00       	call   f010763b <cpunum>
+f0104d6a:	83 ec 0c             	sub    $0xc,%esp
+f0104d6d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104d70:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104d76:	e8 34 f3 ff ff       	call   f01040af <env_run>
+
+destroy_env:
+	// Destroy the environment that caused the fault.
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104d7b:	8b 73 30             	mov    0x30(%ebx),%esi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0104d7e:	e8 b8 28 00 00       	call   f010763b <cpunum>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104d83:	56                   	push   %esi
+f0104d84:	57                   	push   %edi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0104d85:	6b c0 7c             	imul   $0x7c,%eax,%eax
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104d88:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104d8e:	ff 70 48             	push   0x48(%eax)
+f0104d91:	68 a8 a8 10 f0       	push   $0xf010a8a8
+f0104d96:	e8 e2 f5 ff ff       	call   f010437d <cprintf>
+	print_trapframe(tf);
+f0104d9b:	89 1c 24             	mov    %ebx,(%esp)
+f0104d9e:	e8 4b fc ff ff       	call   f01049ee <print_trapframe>
+	env_destroy(curenv);
+f0104da3:	e8 93 28 00 00       	call   f010763b <cpunum>
+f0104da8:	83 c4 04             	add    $0x4,%esp
+f0104dab:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104dae:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104db4:	e8 57 f2 ff ff       	call   f0104010 <env_destroy>
+}
+f0104db9:	83 c4 10             	add    $0x10,%esp
+f0104dbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104dbf:	5b                   	pop    %ebx
+f0104dc0:	5e                   	pop    %esi
+f0104dc1:	5f                   	pop    %edi
+f0104dc2:	5d                   	pop    %ebp
+f0104dc3:	c3                   	ret
+
+f0104dc4 <trap>:
+{
+f0104dc4:	55                   	push   %ebp
+f0104dc5:	89 e5                	mov    %esp,%ebp
+f0104dc7:	57                   	push   %edi
+f0104dc8:	56                   	push   %esi
+f0104dc9:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f0104dcc:	fc                   	cld
+	if (tf->tf_trapno == T_TLBFLUSH) {
+f0104dcd:	83 7e 28 31          	cmpl   $0x31,0x28(%esi)
+f0104dd1:	0f 84 88 00 00 00    	je     f0104e5f <trap+0x9b>
+	thiscpu->cpu_in_user = 0;
+f0104dd7:	e8 5f 28 00 00       	call   f010763b <cpunum>
+f0104ddc:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104ddf:	c6 80 94 70 a4 f0 00 	movb   $0x0,-0xf5b8f6c(%eax)
+	if (panicstr)
+f0104de6:	83 3d 40 62 a4 f0 00 	cmpl   $0x0,0xf0a46240
+f0104ded:	74 01                	je     f0104df0 <trap+0x2c>
+		asm volatile("hlt");
+f0104def:	f4                   	hlt
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
+f0104df0:	e8 46 28 00 00       	call   f010763b <cpunum>
+f0104df5:	6b d0 7c             	imul   $0x7c,%eax,%edx
+f0104df8:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f0104dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104e00:	f0 87 82 20 70 a4 f0 	lock xchg %eax,-0xf5b8fe0(%edx)
+f0104e07:	83 f8 02             	cmp    $0x2,%eax
+f0104e0a:	74 7b                	je     f0104e87 <trap+0xc3>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0104e0c:	9c                   	pushf
+f0104e0d:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f0104e0e:	f6 c4 02             	test   $0x2,%ah
+f0104e11:	0f 85 8a 00 00 00    	jne    f0104ea1 <trap+0xdd>
+	if (tf->tf_eip >= (uintptr_t)sysenter_handler && tf->tf_eip <= (uintptr_t)sysenter_handler_end) {
+f0104e17:	8b 46 30             	mov    0x30(%esi),%eax
+f0104e1a:	3d 44 51 10 f0       	cmp    $0xf0105144,%eax
+f0104e1f:	72 11                	jb     f0104e32 <trap+0x6e>
+f0104e21:	3d 59 51 10 f0       	cmp    $0xf0105159,%eax
+f0104e26:	77 0a                	ja     f0104e32 <trap+0x6e>
+		if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+f0104e28:	83 7e 28 20          	cmpl   $0x20,0x28(%esi)
+f0104e2c:	0f 84 88 00 00 00    	je     f0104eba <trap+0xf6>
+	if ((tf->tf_cs & 3) == 3) {
+f0104e32:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0104e36:	83 e0 03             	and    $0x3,%eax
+f0104e39:	66 83 f8 03          	cmp    $0x3,%ax
+f0104e3d:	0f 84 8d 00 00 00    	je     f0104ed0 <trap+0x10c>
+	last_tf = tf;
+f0104e43:	89 35 60 4a a2 f0    	mov    %esi,0xf0a24a60
+	switch (tf->tf_trapno) {
+f0104e49:	8b 56 28             	mov    0x28(%esi),%edx
+f0104e4c:	8d 42 fd             	lea    -0x3(%edx),%eax
+f0104e4f:	83 f8 2d             	cmp    $0x2d,%eax
+f0104e52:	0f 87 3c 01 00 00    	ja     f0104f94 <trap+0x1d0>
+f0104e58:	ff 24 85 50 a7 10 f0 	jmp    *-0xfef58b0(,%eax,4)
+	asm volatile("movl %%cr3,%0" : "=r" (val));
+f0104e5f:	0f 20 d8             	mov    %cr3,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0104e62:	0f 22 d8             	mov    %eax,%cr3
+		thiscpu->cpu_tlb_gen = tlb_gen;
+f0104e65:	e8 d1 27 00 00       	call   f010763b <cpunum>
+f0104e6a:	8b 15 94 62 a4 f0    	mov    0xf0a46294,%edx
+f0104e70:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104e73:	89 90 98 70 a4 f0    	mov    %edx,-0xf5b8f68(%eax)
+		lapic_eoi();
+f0104e79:	e8 04 29 00 00       	call   f0107782 <lapic_eoi>
+		env_pop_tf(tf);
+f0104e7e:	83 ec 0c             	sub    $0xc,%esp
+f0104e81:	56                   	push   %esi
+f0104e82:	e8 ea f1 ff ff       	call   f0104071 <env_pop_tf>
+	spin_lock(&kernel_lock);
+f0104e87:	83 ec 0c             	sub    $0xc,%esp
+f0104e8a:	68 c0 63 11 f0       	push   $0xf01163c0
+f0104e8f:	e8 17 2a 00 00       	call   f01078ab <spin_lock>
+		tlb_sync();
+f0104e94:	e8 a9 c9 ff ff       	call   f0101842 <tlb_sync>
+f0104e99:	83 c4 10             	add    $0x10,%esp
+f0104e9c:	e9 6b ff ff ff       	jmp    f0104e0c <trap+0x48>
+	assert(!(read_eflags() & FL_IF));
+f0104ea1:	68 65 a5 10 f0       	push   $0xf010a565
+f0104ea6:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0104eab:	68 6f 01 00 00       	push   $0x16f
+f0104eb0:	68 23 a5 10 f0       	push   $0xf010a523
+f0104eb5:	e8 86 b1 ff ff       	call   f0100040 <_panic>
+			env_run(curenv);
+f0104eba:	e8 7c 27 00 00       	call   f010763b <cpunum>
+f0104ebf:	83 ec 0c             	sub    $0xc,%esp
+f0104ec2:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104ec5:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104ecb:	e8 df f1 ff ff       	call   f01040af <env_run>
+f0104ed0:	83 ec 0c             	sub    $0xc,%esp
+f0104ed3:	68 c0 63 11 f0       	push   $0xf01163c0
+f0104ed8:	e8 ce 29 00 00       	call   f01078ab <spin_lock>
+		tlb_sync();
+f0104edd:	e8 60 c9 ff ff       	call   f0101842 <tlb_sync>
+		assert(curenv);
+f0104ee2:	e8 54 27 00 00       	call   f010763b <cpunum>
+f0104ee7:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104eea:	83 c4 10             	add    $0x10,%esp
+f0104eed:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f0104ef4:	74 3e                	je     f0104f34 <trap+0x170>
+		if (curenv->env_status == ENV_DYING) {
+f0104ef6:	e8 40 27 00 00       	call   f010763b <cpunum>
+f0104efb:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104efe:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104f04:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0104f08:	74 43                	je     f0104f4d <trap+0x189>
+		curenv->env_tf = *tf;
+f0104f0a:	e8 2c 27 00 00       	call   f010763b <cpunum>
+f0104f0f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104f12:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104f18:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0104f1d:	89 c7                	mov    %eax,%edi
+f0104f1f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f0104f21:	e8 15 27 00 00       	call   f010763b <cpunum>
+f0104f26:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104f29:	8b b0 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%esi
+f0104f2f:	e9 0f ff ff ff       	jmp    f0104e43 <trap+0x7f>
+		assert(curenv);
+f0104f34:	68 29 ba 10 f0       	push   $0xf010ba29
+f0104f39:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0104f3e:	68 82 01 00 00       	push   $0x182
+f0104f43:	68 23 a5 10 f0       	push   $0xf010a523
+f0104f48:	e8 f3 b0 ff ff       	call   f0100040 <_panic>
+			env_free(curenv);
+f0104f4d:	e8 e9 26 00 00       	call   f010763b <cpunum>
+f0104f52:	83 ec 0c             	sub    $0xc,%esp
+f0104f55:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104f58:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104f5e:	e8 b6 ee ff ff       	call   f0103e19 <env_free>
+			curenv = NULL;
+f0104f63:	e8 d3 26 00 00       	call   f010763b <cpunum>
+f0104f68:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104f6b:	c7 80 28 70 a4 f0 00 	movl   $0x0,-0xf5b8fd8(%eax)
+f0104f72:	00 00 00 
+			sched_yield();
+f0104f75:	e8 79 03 00 00       	call   f01052f3 <sched_yield>
+		monitor(tf);
+f0104f7a:	83 ec 0c             	sub    $0xc,%esp
+f0104f7d:	56                   	push   %esi
+f0104f7e:	e8 ba be ff ff       	call   f0100e3d <monitor>
+		return;
+f0104f83:	83 c4 10             	add    $0x10,%esp
+f0104f86:	eb 3c                	jmp    f0104fc4 <trap+0x200>
+		page_fault_handler(tf);
+f0104f88:	83 ec 0c             	sub    $0xc,%esp
+f0104f8b:	56                   	push   %esi
+f0104f8c:	e8 6f fc ff ff       	call   f0104c00 <page_fault_handler>
+		break;
+f0104f91:	83 c4 10             	add    $0x10,%esp
+	print_trapframe(tf);
+f0104f94:	83 ec 0c             	sub    $0xc,%esp
+f0104f97:	56                   	push   %esi
+f0104f98:	e8 51 fa ff ff       	call   f01049ee <print_trapframe>
+	if (tf->tf_cs == GD_KT)
+f0104f9d:	83 c4 10             	add    $0x10,%esp
+f0104fa0:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0104fa5:	0f 84 6c 01 00 00    	je     f0105117 <trap+0x353>
+		env_destroy(curenv);
+f0104fab:	e8 8b 26 00 00       	call   f010763b <cpunum>
+f0104fb0:	83 ec 0c             	sub    $0xc,%esp
+f0104fb3:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104fb6:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0104fbc:	e8 4f f0 ff ff       	call   f0104010 <env_destroy>
+		return;
+f0104fc1:	83 c4 10             	add    $0x10,%esp
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0104fc4:	e8 72 26 00 00       	call   f010763b <cpunum>
+f0104fc9:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104fcc:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f0104fd3:	74 18                	je     f0104fed <trap+0x229>
+f0104fd5:	e8 61 26 00 00       	call   f010763b <cpunum>
+f0104fda:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104fdd:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0104fe3:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104fe7:	0f 84 41 01 00 00    	je     f010512e <trap+0x36a>
+		sched_yield();
+f0104fed:	e8 01 03 00 00       	call   f01052f3 <sched_yield>
+		if (curenv->env_uring)
+f0104ff2:	e8 44 26 00 00       	call   f010763b <cpunum>
+f0104ff7:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0104ffa:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105000:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+f0105007:	74 19                	je     f0105022 <trap+0x25e>
+			uring_drain(curenv);
+f0105009:	e8 2d 26 00 00       	call   f010763b <cpunum>
+f010500e:	83 ec 0c             	sub    $0xc,%esp
+f0105011:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105014:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f010501a:	e8 40 3a 00 00       	call   f0108a5f <uring_drain>
+f010501f:	83 c4 10             	add    $0x10,%esp
+		tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx, tf->tf_regs.reg_ecx, tf->tf_regs.reg_ebx, tf->tf_regs.reg_edi, tf->tf_regs.reg_esi);
+f0105022:	83 ec 08             	sub    $0x8,%esp
+f0105025:	ff 76 04             	push   0x4(%esi)
+f0105028:	ff 36                	push   (%esi)
+f010502a:	ff 76 10             	push   0x10(%esi)
+f010502d:	ff 76 18             	push   0x18(%esi)
+f0105030:	ff 76 14             	push   0x14(%esi)
+f0105033:	ff 76 1c             	push   0x1c(%esi)
+f0105036:	e8 d0 11 00 00       	call   f010620b <syscall>
+f010503b:	89 46 1c             	mov    %eax,0x1c(%esi)
+		return;
+f010503e:	83 c4 20             	add    $0x20,%esp
+f0105041:	eb 81                	jmp    f0104fc4 <trap+0x200>
+		if (thiscpu->cpu_id == 0) {
+f0105043:	e8 f3 25 00 00       	call   f010763b <cpunum>
+f0105048:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010504b:	80 b8 20 70 a4 f0 00 	cmpb   $0x0,-0xf5b8fe0(%eax)
+f0105052:	74 2f                	je     f0105083 <trap+0x2bf>
+		lapic_eoi();
+f0105054:	e8 29 27 00 00       	call   f0107782 <lapic_eoi>
+		if (curenv && curenv->env_status == ENV_RUNNING
+f0105059:	e8 dd 25 00 00       	call   f010763b <cpunum>
+f010505e:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105061:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f0105068:	74 14                	je     f010507e <trap+0x2ba>
+f010506a:	e8 cc 25 00 00       	call   f010763b <cpunum>
+f010506f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105072:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105078:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f010507c:	74 1d                	je     f010509b <trap+0x2d7>
+		sched_yield();
+f010507e:	e8 70 02 00 00       	call   f01052f3 <sched_yield>
+			time_tick();
+f0105083:	e8 03 34 00 00       	call   f010848b <time_tick>
+			futex_tick(time_msec());
+f0105088:	e8 2c 34 00 00       	call   f01084b9 <time_msec>
+f010508d:	83 ec 0c             	sub    $0xc,%esp
+f0105090:	50                   	push   %eax
+f0105091:	e8 44 38 00 00       	call   f01088da <futex_tick>
+f0105096:	83 c4 10             	add    $0x10,%esp
+f0105099:	eb b9                	jmp    f0105054 <trap+0x290>
+		    && curenv->env_uring)
+f010509b:	e8 9b 25 00 00       	call   f010763b <cpunum>
+f01050a0:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01050a3:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01050a9:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+f01050b0:	74 cc                	je     f010507e <trap+0x2ba>
+			uring_drain(curenv);
+f01050b2:	e8 84 25 00 00       	call   f010763b <cpunum>
+f01050b7:	83 ec 0c             	sub    $0xc,%esp
+f01050ba:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01050bd:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f01050c3:	e8 97 39 00 00       	call   f0108a5f <uring_drain>
+f01050c8:	83 c4 10             	add    $0x10,%esp
+f01050cb:	eb b1                	jmp    f010507e <trap+0x2ba>
+		kbd_intr();
+f01050cd:	e8 eb b5 ff ff       	call   f01006bd <kbd_intr>
+		return;
+f01050d2:	e9 ed fe ff ff       	jmp    f0104fc4 <trap+0x200>
+		serial_intr();
+f01050d7:	e8 c5 b5 ff ff       	call   f01006a1 <serial_intr>
+		return;
+f01050dc:	e9 e3 fe ff ff       	jmp    f0104fc4 <trap+0x200>
+		futex_irq(tf->tf_trapno - IRQ_OFFSET);
+f01050e1:	83 ec 0c             	sub    $0xc,%esp
+f01050e4:	83 ea 20             	sub    $0x20,%edx
+f01050e7:	52                   	push   %edx
+f01050e8:	e8 01 37 00 00       	call   f01087ee <futex_irq>
+		irq_eoi();
+f01050ed:	e8 40 f2 ff ff       	call   f0104332 <irq_eoi>
+		return;
+f01050f2:	83 c4 10             	add    $0x10,%esp
+f01050f5:	e9 ca fe ff ff       	jmp    f0104fc4 <trap+0x200>
+		cprintf("Spurious interrupt on irq 7\n");
+f01050fa:	83 ec 0c             	sub    $0xc,%esp
+f01050fd:	68 7e a5 10 f0       	push   $0xf010a57e
+f0105102:	e8 76 f2 ff ff       	call   f010437d <cprintf>
+		print_trapframe(tf);
+f0105107:	89 34 24             	mov    %esi,(%esp)
+f010510a:	e8 df f8 ff ff       	call   f01049ee <print_trapframe>
+		return;
+f010510f:	83 c4 10             	add    $0x10,%esp
+f0105112:	e9 ad fe ff ff       	jmp    f0104fc4 <trap+0x200>
+		panic("unhandled trap in kernel");
+f0105117:	83 ec 04             	sub    $0x4,%esp
+f010511a:	68 9b a5 10 f0       	push   $0xf010a59b
+f010511f:	68 49 01 00 00       	push   $0x149
+f0105124:	68 23 a5 10 f0       	push   $0xf010a523
+f0105129:	e8 12 af ff ff       	call   f0100040 <_panic>
+		env_run(curenv);
+f010512e:	e8 08 25 00 00       	call   f010763b <cpunum>
+f0105133:	83 ec 0c             	sub    $0xc,%esp
+f0105136:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105139:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f010513f:	e8 6b ef ff ff       	call   f01040af <env_run>
+
+f0105144 <sysenter_handler>:
+
+.global sysenter_handler;
+.type sysenter_handler @function;
+.align 2;
+sysenter_handler:
+	cli;
+f0105144:	fa                   	cli
+	pushl %ebp;
+f0105145:	55                   	push   %ebp
+	pushl %esi;
+f0105146:	56                   	push   %esi
+	pushl %edi;
+f0105147:	57                   	push   %edi
+	pushl %ebx;
+f0105148:	53                   	push   %ebx
+	pushl %ecx;
+f0105149:	51                   	push   %ecx
+	pushl %edx;
+f010514a:	52                   	push   %edx
+	pushl %eax;
+f010514b:	50                   	push   %eax
+	call sysenter_wrapper;
+f010514c:	e8 01 11 00 00       	call   f0106252 <sysenter_wrapper>
+	add $20, %esp;
+f0105151:	83 c4 14             	add    $0x14,%esp
+	popl %edx;
+f0105154:	5a                   	pop    %edx
+	popl %ecx;
+f0105155:	59                   	pop    %ecx
+	sti;
+f0105156:	fb                   	sti
+	sysexit;
+f0105157:	0f 35                	sysexit
+
+f0105159 <sysenter_handler_end>:
+.global sysenter_handler_end;
+.type sysenter_handler_end @function;
+sysenter_handler_end:
+	nop;
+f0105159:	90                   	nop
+
+f010515a <DIVIDE_ENTRY>:
+
+/*
+ * Generate entry points for the different traps.
+ * Which exceptions has error_code? reference: https://wiki.osdev.org/Exceptions
+ */
+TRAPHANDLER_INTERNAL_NOEC(DIVIDE)
+f010515a:	6a 00                	push   $0x0
+f010515c:	6a 00                	push   $0x0
+f010515e:	e9 b5 00 00 00       	jmp    f0105218 <_alltraps>
+f0105163:	90                   	nop
+
+f0105164 <DEBUG_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(DEBUG)
+f0105164:	6a 00                	push   $0x0
+f0105166:	6a 01                	push   $0x1
+f0105168:	e9 ab 00 00 00       	jmp    f0105218 <_alltraps>
+f010516d:	90                   	nop
+
+f010516e <NMI_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(NMI)
+f010516e:	6a 00                	push   $0x0
+f0105170:	6a 02                	push   $0x2
+f0105172:	e9 a1 00 00 00       	jmp    f0105218 <_alltraps>
+f0105177:	90                   	nop
+
+f0105178 <BRKPT_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(BRKPT)
+f0105178:	6a 00                	push   $0x0
+f010517a:	6a 03                	push   $0x3
+f010517c:	e9 97 00 00 00       	jmp    f0105218 <_alltraps>
+f0105181:	90                   	nop
+
+f0105182 <OFLOW_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(OFLOW)
+f0105182:	6a 00                	push   $0x0
+f0105184:	6a 04                	push   $0x4
+f0105186:	e9 8d 00 00 00       	jmp    f0105218 <_alltraps>
+f010518b:	90                   	nop
+
+f010518c <BOUND_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(BOUND)
+f010518c:	6a 00                	push   $0x0
+f010518e:	6a 05                	push   $0x5
+f0105190:	e9 83 00 00 00       	jmp    f0105218 <_alltraps>
+f0105195:	90                   	nop
+
+f0105196 <ILLOP_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(ILLOP)
+f0105196:	6a 00                	push   $0x0
+f0105198:	6a 06                	push   $0x6
+f010519a:	eb 7c                	jmp    f0105218 <_alltraps>
+
+f010519c <DEVICE_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(DEVICE)
+f010519c:	6a 00                	push   $0x0
+f010519e:	6a 07                	push   $0x7
+f01051a0:	eb 76                	jmp    f0105218 <_alltraps>
+
+f01051a2 <DBLFLT_ENTRY>:
+TRAPHANDLER_INTERNAL(DBLFLT)
+f01051a2:	6a 08                	push   $0x8
+f01051a4:	eb 72                	jmp    f0105218 <_alltraps>
+
+f01051a6 <TSS_ENTRY>:
+# 9 is reserve
+TRAPHANDLER_INTERNAL(TSS)
+f01051a6:	6a 0a                	push   $0xa
+f01051a8:	eb 6e                	jmp    f0105218 <_alltraps>
+
+f01051aa <SEGNP_ENTRY>:
+TRAPHANDLER_INTERNAL(SEGNP)
+f01051aa:	6a 0b                	push   $0xb
+f01051ac:	eb 6a                	jmp    f0105218 <_alltraps>
+
+f01051ae <STACK_ENTRY>:
+TRAPHANDLER_INTERNAL(STACK)
+f01051ae:	6a 0c                	push   $0xc
+f01051b0:	eb 66                	jmp    f0105218 <_alltraps>
+
+f01051b2 <GPFLT_ENTRY>:
+TRAPHANDLER_INTERNAL(GPFLT)
+f01051b2:	6a 0d                	push   $0xd
+f01051b4:	eb 62                	jmp    f0105218 <_alltraps>
+
+f01051b6 <PGFLT_ENTRY>:
+TRAPHANDLER_INTERNAL(PGFLT)
+f01051b6:	6a 0e                	push   $0xe
+f01051b8:	eb 5e                	jmp    f0105218 <_alltraps>
+
+f01051ba <FPERR_ENTRY>:
+# 15 is reserved
+TRAPHANDLER_INTERNAL_NOEC(FPERR)
+f01051ba:	6a 00                	push   $0x0
+f01051bc:	6a 10                	push   $0x10
+f01051be:	eb 58                	jmp    f0105218 <_alltraps>
+
+f01051c0 <ALIGN_ENTRY>:
+TRAPHANDLER_INTERNAL(ALIGN)
+f01051c0:	6a 11                	push   $0x11
+f01051c2:	eb 54                	jmp    f0105218 <_alltraps>
+
+f01051c4 <MCHK_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(MCHK)
+f01051c4:	6a 00                	push   $0x0
+f01051c6:	6a 12                	push   $0x12
+f01051c8:	eb 4e                	jmp    f0105218 <_alltraps>
+
+f01051ca <SIMDERR_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(SIMDERR)
+f01051ca:	6a 00                	push   $0x0
+f01051cc:	6a 13                	push   $0x13
+f01051ce:	eb 48                	jmp    f0105218 <_alltraps>
+
+f01051d0 <TIMER_ENTRY>:
+
+# 16-47, external interrupts
+TRAPHANDLER_EXTERNAL_NOEC(TIMER)
+f01051d0:	6a 00                	push   $0x0
+f01051d2:	6a 20                	push   $0x20
+f01051d4:	eb 42                	jmp    f0105218 <_alltraps>
+
+f01051d6 <KBD_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(KBD)
+f01051d6:	6a 00                	push   $0x0
+f01051d8:	6a 21                	push   $0x21
+f01051da:	eb 3c                	jmp    f0105218 <_alltraps>
+
+f01051dc <SERIAL_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(SERIAL)
+f01051dc:	6a 00                	push   $0x0
+f01051de:	6a 24                	push   $0x24
+f01051e0:	eb 36                	jmp    f0105218 <_alltraps>
+
+f01051e2 <SPURIOUS_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(SPURIOUS)
+f01051e2:	6a 00                	push   $0x0
+f01051e4:	6a 27                	push   $0x27
+f01051e6:	eb 30                	jmp    f0105218 <_alltraps>
+
+f01051e8 <PCI9_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(PCI9)
+f01051e8:	6a 00                	push   $0x0
+f01051ea:	6a 29                	push   $0x29
+f01051ec:	eb 2a                	jmp    f0105218 <_alltraps>
+
+f01051ee <PCI10_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(PCI10)
+f01051ee:	6a 00                	push   $0x0
+f01051f0:	6a 2a                	push   $0x2a
+f01051f2:	eb 24                	jmp    f0105218 <_alltraps>
+
+f01051f4 <PCI11_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(PCI11)
+f01051f4:	6a 00                	push   $0x0
+f01051f6:	6a 2b                	push   $0x2b
+f01051f8:	eb 1e                	jmp    f0105218 <_alltraps>
+
+f01051fa <IDE_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(IDE)
+f01051fa:	6a 00                	push   $0x0
+f01051fc:	6a 2e                	push   $0x2e
+f01051fe:	eb 18                	jmp    f0105218 <_alltraps>
+
+f0105200 <IDE2_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(IDE2)
+f0105200:	6a 00                	push   $0x0
+f0105202:	6a 2f                	push   $0x2f
+f0105204:	eb 12                	jmp    f0105218 <_alltraps>
+
+f0105206 <ERROR_ENTRY>:
+TRAPHANDLER_EXTERNAL_NOEC(ERROR)
+f0105206:	6a 00                	push   $0x0
+f0105208:	6a 33                	push   $0x33
+f010520a:	eb 0c                	jmp    f0105218 <_alltraps>
+
+f010520c <SYSCALL_ENTRY>:
+
+# 48
+TRAPHANDLER_INTERNAL_NOEC(SYSCALL)
+f010520c:	6a 00                	push   $0x0
+f010520e:	6a 30                	push   $0x30
+f0105210:	eb 06                	jmp    f0105218 <_alltraps>
+
+f0105212 <TLBFLUSH_ENTRY>:
+TRAPHANDLER_INTERNAL_NOEC(TLBFLUSH)
+f0105212:	6a 00                	push   $0x0
+f0105214:	6a 31                	push   $0x31
+f0105216:	eb 00                	jmp    f0105218 <_alltraps>
+
+f0105218 <_alltraps>:
+
+_alltraps:
+    # Push values to make the stack look like a struct Trapframe
+	pushl %ds
+f0105218:	1e                   	push   %ds
+	pushl %es
+f0105219:	06                   	push   %es
+	pushal
+f010521a:	60                   	pusha
+	# load GD_KD into %ds and %es
+	movw $GD_KD, %ax
+f010521b:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax, %ds
+f010521f:	8e d8                	mov    %eax,%ds
+	movw %ax, %es
+f0105221:	8e c0                	mov    %eax,%es
+	# pass a pointer to the Trapframe as an argument to trap()
+	pushl %esp
+f0105223:	54                   	push   %esp
+	call trap
+f0105224:	e8 9b fb ff ff       	call   f0104dc4 <trap>
+
+f0105229 <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0105229:	55                   	push   %ebp
+f010522a:	89 e5                	mov    %esp,%ebp
+f010522c:	83 ec 08             	sub    $0x8,%esp
+	int i;
+
+	// For debugging and testing purposes, if there are no runnable
+	// environments in the system, then drop into the kernel monitor.
+	for (i = 0; i < NENV; i++) {
+f010522f:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+f0105234:	8d 50 54             	lea    0x54(%eax),%edx
+f0105237:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+		     envs[i].env_status == ENV_RUNNING ||
+f010523c:	8b 02                	mov    (%edx),%eax
+f010523e:	83 e8 01             	sub    $0x1,%eax
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+f0105241:	81 c2 90 00 00 00    	add    $0x90,%edx
+f0105247:	83 f8 02             	cmp    $0x2,%eax
+f010524a:	76 3c                	jbe    f0105288 <sched_halt+0x5f>
+	for (i = 0; i < NENV; i++) {
+f010524c:	83 c1 01             	add    $0x1,%ecx
+f010524f:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+f0105255:	75 e5                	jne    f010523c <sched_halt+0x13>
+		     envs[i].env_status == ENV_DYING))
+			break;
+	}
+	if (i == NENV) {
+		cprintf("No runnable environments in the system!\n");
+f0105257:	83 ec 0c             	sub    $0xc,%esp
+f010525a:	68 cc a8 10 f0       	push   $0xf010a8cc
+f010525f:	e8 19 f1 ff ff       	call   f010437d <cprintf>
+f0105264:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			monitor(NULL);
+f0105267:	83 ec 0c             	sub    $0xc,%esp
+f010526a:	6a 00                	push   $0x0
+f010526c:	e8 cc bb ff ff       	call   f0100e3d <monitor>
+f0105271:	83 c4 10             	add    $0x10,%esp
+f0105274:	eb f1                	jmp    f0105267 <sched_halt+0x3e>
+f0105276:	50                   	push   %eax
+f0105277:	68 48 8e 10 f0       	push   $0xf0108e48
+f010527c:	6a 59                	push   $0x59
+f010527e:	68 42 a9 10 f0       	push   $0xf010a942
+f0105283:	e8 b8 ad ff ff       	call   f0100040 <_panic>
+	}
+
+	// Mark that no environment is running on this CPU
+	curenv = NULL;
+f0105288:	e8 ae 23 00 00       	call   f010763b <cpunum>
+f010528d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105290:	c7 80 28 70 a4 f0 00 	movl   $0x0,-0xf5b8fd8(%eax)
+f0105297:	00 00 00 
+	lcr3(PADDR(kern_pgdir));
+f010529a:	a1 9c 62 a4 f0       	mov    0xf0a4629c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010529f:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01052a4:	76 d0                	jbe    f0105276 <sched_halt+0x4d>
+	return (physaddr_t)kva - KERNBASE;
+f01052a6:	05 00 00 00 10       	add    $0x10000000,%eax
+f01052ab:	0f 22 d8             	mov    %eax,%cr3
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+f01052ae:	e8 88 23 00 00       	call   f010763b <cpunum>
+f01052b3:	6b d0 7c             	imul   $0x7c,%eax,%edx
+f01052b6:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f01052b9:	b8 02 00 00 00       	mov    $0x2,%eax
+f01052be:	f0 87 82 20 70 a4 f0 	lock xchg %eax,-0xf5b8fe0(%edx)
+	spin_unlock(&kernel_lock);
+f01052c5:	83 ec 0c             	sub    $0xc,%esp
+f01052c8:	68 c0 63 11 f0       	push   $0xf01163c0
+f01052cd:	e8 73 26 00 00       	call   f0107945 <spin_unlock>
+	asm volatile("pause");
+f01052d2:	f3 90                	pause
+		// Uncomment the following line after completing exercise 13
+		"sti\n"
+		"1:\n"
+		"hlt\n"
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+f01052d4:	e8 62 23 00 00       	call   f010763b <cpunum>
+f01052d9:	6b c0 7c             	imul   $0x7c,%eax,%eax
+	asm volatile (
+f01052dc:	8b 80 30 70 a4 f0    	mov    -0xf5b8fd0(%eax),%eax
+f01052e2:	bd 00 00 00 00       	mov    $0x0,%ebp
+f01052e7:	89 c4                	mov    %eax,%esp
+f01052e9:	6a 00                	push   $0x0
+f01052eb:	6a 00                	push   $0x0
+f01052ed:	fb                   	sti
+f01052ee:	f4                   	hlt
+f01052ef:	eb fd                	jmp    f01052ee <sched_halt+0xc5>
+}
+f01052f1:	c9                   	leave
+f01052f2:	c3                   	ret
+
+f01052f3 <sched_yield>:
+{
+f01052f3:	55                   	push   %ebp
+f01052f4:	89 e5                	mov    %esp,%ebp
+f01052f6:	57                   	push   %edi
+f01052f7:	56                   	push   %esi
+f01052f8:	53                   	push   %ebx
+f01052f9:	83 ec 0c             	sub    $0xc,%esp
+	if (curenv) {
+f01052fc:	e8 3a 23 00 00       	call   f010763b <cpunum>
+f0105301:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105304:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f010530b:	74 44                	je     f0105351 <sched_yield+0x5e>
+		id = ENVX(curenv->env_id);
+f010530d:	e8 29 23 00 00       	call   f010763b <cpunum>
+f0105312:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105315:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f010531b:	8b 58 48             	mov    0x48(%eax),%ebx
+f010531e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+		i = id + 1;
+f0105324:	8d 43 01             	lea    0x1(%ebx),%eax
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f0105327:	8b 0d 48 42 a2 f0    	mov    0xf0a24248,%ecx
+f010532d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+f0105330:	c1 e0 04             	shl    $0x4,%eax
+f0105333:	01 c8                	add    %ecx,%eax
+f0105335:	89 ca                	mov    %ecx,%edx
+f0105337:	8d b9 00 40 02 00    	lea    0x24000(%ecx),%edi
+	for (; i < NENV; ++i) {
+f010533d:	39 f8                	cmp    %edi,%eax
+f010533f:	74 2d                	je     f010536e <sched_yield+0x7b>
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f0105341:	8d b0 90 00 00 00    	lea    0x90(%eax),%esi
+f0105347:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f010534b:	74 10                	je     f010535d <sched_yield+0x6a>
+f010534d:	89 f0                	mov    %esi,%eax
+f010534f:	eb ec                	jmp    f010533d <sched_yield+0x4a>
+	int i = 0;
+f0105351:	b8 00 00 00 00       	mov    $0x0,%eax
+	int id = 0;
+f0105356:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010535b:	eb ca                	jmp    f0105327 <sched_yield+0x34>
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f010535d:	89 c3                	mov    %eax,%ebx
+	assert(!(idle->env_status == ENV_RUNNING && idle->env_cpunum != thiscpu->cpu_id));
+f010535f:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f0105363:	74 6f                	je     f01053d4 <sched_yield+0xe1>
+	env_run(idle);
+f0105365:	83 ec 0c             	sub    $0xc,%esp
+f0105368:	53                   	push   %ebx
+f0105369:	e8 41 ed ff ff       	call   f01040af <env_run>
+f010536e:	69 db 90 00 00 00    	imul   $0x90,%ebx,%ebx
+f0105374:	8d 8c 19 90 00 00 00 	lea    0x90(%ecx,%ebx,1),%ecx
+	for (i = 0; i <= id; ++i) {
+f010537b:	39 ca                	cmp    %ecx,%edx
+f010537d:	74 14                	je     f0105393 <sched_yield+0xa0>
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f010537f:	8d 82 90 00 00 00    	lea    0x90(%edx),%eax
+f0105385:	83 7a 54 02          	cmpl   $0x2,0x54(%edx)
+f0105389:	74 04                	je     f010538f <sched_yield+0x9c>
+f010538b:	89 c2                	mov    %eax,%edx
+f010538d:	eb ec                	jmp    f010537b <sched_yield+0x88>
+f010538f:	89 d3                	mov    %edx,%ebx
+f0105391:	eb cc                	jmp    f010535f <sched_yield+0x6c>
+	if (curenv && curenv->env_status == ENV_RUNNING) {
+f0105393:	e8 a3 22 00 00       	call   f010763b <cpunum>
+f0105398:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010539b:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f01053a2:	74 14                	je     f01053b8 <sched_yield+0xc5>
+f01053a4:	e8 92 22 00 00       	call   f010763b <cpunum>
+f01053a9:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01053ac:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01053b2:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01053b6:	74 0c                	je     f01053c4 <sched_yield+0xd1>
+	sched_halt();
+f01053b8:	e8 6c fe ff ff       	call   f0105229 <sched_halt>
+	idle = NULL;
+f01053bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01053c2:	eb 9b                	jmp    f010535f <sched_yield+0x6c>
+		idle = curenv;
+f01053c4:	e8 72 22 00 00       	call   f010763b <cpunum>
+f01053c9:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01053cc:	8b 98 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%ebx
+		goto found;
+f01053d2:	eb 8b                	jmp    f010535f <sched_yield+0x6c>
+	assert(!(idle->env_status == ENV_RUNNING && idle->env_cpunum != thiscpu->cpu_id));
+f01053d4:	8b 73 5c             	mov    0x5c(%ebx),%esi
+f01053d7:	e8 5f 22 00 00       	call   f010763b <cpunum>
+f01053dc:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01053df:	0f b6 80 20 70 a4 f0 	movzbl -0xf5b8fe0(%eax),%eax
+f01053e6:	39 c6                	cmp    %eax,%esi
+f01053e8:	0f 84 77 ff ff ff    	je     f0105365 <sched_yield+0x72>
+f01053ee:	68 f8 a8 10 f0       	push   $0xf010a8f8
+f01053f3:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f01053f8:	6a 3c                	push   $0x3c
+f01053fa:	68 42 a9 10 f0       	push   $0xf010a942
+f01053ff:	e8 3c ac ff ff       	call   f0100040 <_panic>
+
+f0105404 <sys_getenvid>:
+}
+
+// Returns the current environment's envid.
+static envid_t
+sys_getenvid(void)
+{
+f0105404:	55                   	push   %ebp
+f0105405:	89 e5                	mov    %esp,%ebp
+f0105407:	83 ec 08             	sub    $0x8,%esp
+	return curenv->env_id;
+f010540a:	e8 2c 22 00 00       	call   f010763b <cpunum>
+f010540f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105412:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105418:	8b 40 48             	mov    0x48(%eax),%eax
+}
+f010541b:	c9                   	leave
+f010541c:	c3                   	ret
+
+f010541d <sys_dma_map>:
+//	-E_BAD_ENV if curenv is not the file server.
+//	-E_INVAL if va is not page-aligned or the range reaches UTOP.
+//	-E_NO_MEM if the pool or page table memory runs out.
+static int
+sys_dma_map(void *va, size_t npages)
+{
+f010541d:	55                   	push   %ebp
+f010541e:	89 e5                	mov    %esp,%ebp
+f0105420:	57                   	push   %edi
+f0105421:	56                   	push   %esi
+f0105422:	53                   	push   %ebx
+f0105423:	83 ec 0c             	sub    $0xc,%esp
+f0105426:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0105429:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	struct PageInfo *pp;
+	size_t i;
+	int r;
+
+	if (curenv->env_type != ENV_TYPE_FS)
+f010542c:	e8 0a 22 00 00       	call   f010763b <cpunum>
+f0105431:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105434:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f010543a:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f010543e:	75 6a                	jne    f01054aa <sys_dma_map+0x8d>
+		return -E_BAD_ENV;
+	if (PGOFF(va) || npages > (UTOP - (uintptr_t) va) / PGSIZE)
+f0105440:	89 de                	mov    %ebx,%esi
+f0105442:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0105448:	75 67                	jne    f01054b1 <sys_dma_map+0x94>
+f010544a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+f010544f:	29 d8                	sub    %ebx,%eax
+f0105451:	c1 e8 0c             	shr    $0xc,%eax
+f0105454:	39 f8                	cmp    %edi,%eax
+f0105456:	72 60                	jb     f01054b8 <sys_dma_map+0x9b>
+		return -E_INVAL;
+	if (!(pp = pci_dma_alloc(npages)))
+f0105458:	83 ec 0c             	sub    $0xc,%esp
+f010545b:	57                   	push   %edi
+f010545c:	e8 b5 2d 00 00       	call   f0108216 <pci_dma_alloc>
+f0105461:	83 c4 10             	add    $0x10,%esp
+f0105464:	85 c0                	test   %eax,%eax
+f0105466:	74 57                	je     f01054bf <sys_dma_map+0xa2>
+f0105468:	89 c3                	mov    %eax,%ebx
+f010546a:	8d 3c f8             	lea    (%eax,%edi,8),%edi
+		return -E_NO_MEM;
+	for (i = 0; i < npages; i++)
+f010546d:	39 fb                	cmp    %edi,%ebx
+f010546f:	74 2c                	je     f010549d <sys_dma_map+0x80>
+		if ((r = page_insert(curenv->env_pgdir, pp + i,
+f0105471:	e8 c5 21 00 00       	call   f010763b <cpunum>
+f0105476:	6a 07                	push   $0x7
+f0105478:	56                   	push   %esi
+f0105479:	53                   	push   %ebx
+f010547a:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010547d:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105483:	ff 70 60             	push   0x60(%eax)
+f0105486:	e8 84 c5 ff ff       	call   f0101a0f <page_insert>
+f010548b:	83 c3 08             	add    $0x8,%ebx
+f010548e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0105494:	83 c4 10             	add    $0x10,%esp
+f0105497:	85 c0                	test   %eax,%eax
+f0105499:	79 d2                	jns    f010546d <sys_dma_map+0x50>
+f010549b:	eb 05                	jmp    f01054a2 <sys_dma_map+0x85>
+				     (uint8_t *) va + i * PGSIZE, PTE_U|PTE_W|PTE_P)) < 0)
+			return r;
+	return 0;
+f010549d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01054a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01054a5:	5b                   	pop    %ebx
+f01054a6:	5e                   	pop    %esi
+f01054a7:	5f                   	pop    %edi
+f01054a8:	5d                   	pop    %ebp
+f01054a9:	c3                   	ret
+		return -E_BAD_ENV;
+f01054aa:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01054af:	eb f1                	jmp    f01054a2 <sys_dma_map+0x85>
+		return -E_INVAL;
+f01054b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01054b6:	eb ea                	jmp    f01054a2 <sys_dma_map+0x85>
+f01054b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01054bd:	eb e3                	jmp    f01054a2 <sys_dma_map+0x85>
+		return -E_NO_MEM;
+f01054bf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01054c4:	eb dc                	jmp    f01054a2 <sys_dma_map+0x85>
+
+f01054c6 <sys_cputs>:
+{
+f01054c6:	55                   	push   %ebp
+f01054c7:	89 e5                	mov    %esp,%ebp
+f01054c9:	56                   	push   %esi
+f01054ca:	53                   	push   %ebx
+f01054cb:	8b 75 08             	mov    0x8(%ebp),%esi
+f01054ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	user_mem_assert(curenv, s, len, 0);
+f01054d1:	e8 65 21 00 00       	call   f010763b <cpunum>
+f01054d6:	6a 00                	push   $0x0
+f01054d8:	53                   	push   %ebx
+f01054d9:	56                   	push   %esi
+f01054da:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01054dd:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f01054e3:	e8 08 e4 ff ff       	call   f01038f0 <user_mem_assert>
+	cprintf("%.*s", len, s);
+f01054e8:	83 c4 0c             	add    $0xc,%esp
+f01054eb:	56                   	push   %esi
+f01054ec:	53                   	push   %ebx
+f01054ed:	68 4f a9 10 f0       	push   $0xf010a94f
+f01054f2:	e8 86 ee ff ff       	call   f010437d <cprintf>
+}
+f01054f7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01054fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01054ff:	5b                   	pop    %ebx
+f0105500:	5e                   	pop    %esi
+f0105501:	5d                   	pop    %ebp
+f0105502:	c3                   	ret
+
+f0105503 <sys_pci_storage>:
+{
+f0105503:	55                   	push   %ebp
+f0105504:	89 e5                	mov    %esp,%ebp
+f0105506:	53                   	push   %ebx
+f0105507:	83 ec 04             	sub    $0x4,%esp
+f010550a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	user_mem_assert(curenv, pd, sizeof *pd, PTE_U|PTE_W);
+f010550d:	e8 29 21 00 00       	call   f010763b <cpunum>
+f0105512:	6a 06                	push   $0x6
+f0105514:	6a 3c                	push   $0x3c
+f0105516:	53                   	push   %ebx
+f0105517:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010551a:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0105520:	e8 cb e3 ff ff       	call   f01038f0 <user_mem_assert>
+	if (pci_storage_get(i, pd) < 0)
+f0105525:	83 c4 08             	add    $0x8,%esp
+f0105528:	53                   	push   %ebx
+f0105529:	ff 75 08             	push   0x8(%ebp)
+f010552c:	e8 4f 2c 00 00       	call   f0108180 <pci_storage_get>
+f0105531:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f0105534:	c1 f8 1f             	sar    $0x1f,%eax
+f0105537:	83 e0 fd             	and    $0xfffffffd,%eax
+}
+f010553a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010553d:	c9                   	leave
+f010553e:	c3                   	ret
+
+f010553f <sys_irq_listen>:
+{
+f010553f:	55                   	push   %ebp
+f0105540:	89 e5                	mov    %esp,%ebp
+f0105542:	83 ec 10             	sub    $0x10,%esp
+	return futex_irq_listen(irq, counter);
+f0105545:	ff 75 0c             	push   0xc(%ebp)
+f0105548:	ff 75 08             	push   0x8(%ebp)
+f010554b:	e8 0c 31 00 00       	call   f010865c <futex_irq_listen>
+}
+f0105550:	c9                   	leave
+f0105551:	c3                   	ret
+
+f0105552 <sys_exofork>:
+{
+f0105552:	55                   	push   %ebp
+f0105553:	89 e5                	mov    %esp,%ebp
+f0105555:	57                   	push   %edi
+f0105556:	56                   	push   %esi
+f0105557:	83 ec 10             	sub    $0x10,%esp
+	if ((err = env_alloc(&e, curenv->env_id)) < 0) {
+f010555a:	e8 dc 20 00 00       	call   f010763b <cpunum>
+f010555f:	83 ec 08             	sub    $0x8,%esp
+f0105562:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105565:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f010556b:	ff 70 48             	push   0x48(%eax)
+f010556e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105571:	50                   	push   %eax
+f0105572:	e8 0d e6 ff ff       	call   f0103b84 <env_alloc>
+f0105577:	83 c4 10             	add    $0x10,%esp
+f010557a:	85 c0                	test   %eax,%eax
+f010557c:	78 2e                	js     f01055ac <sys_exofork+0x5a>
+	e->env_status = ENV_NOT_RUNNABLE;
+f010557e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105581:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	e->env_tf = curenv->env_tf;
+f0105588:	e8 ae 20 00 00       	call   f010763b <cpunum>
+f010558d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105590:	8b b0 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%esi
+f0105596:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105599:	b9 11 00 00 00       	mov    $0x11,%ecx
+f010559e:	89 c7                	mov    %eax,%edi
+f01055a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01055a2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	return e->env_id;
+f01055a9:	8b 40 48             	mov    0x48(%eax),%eax
+}
+f01055ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01055af:	5e                   	pop    %esi
+f01055b0:	5f                   	pop    %edi
+f01055b1:	5d                   	pop    %ebp
+f01055b2:	c3                   	ret
+
+f01055b3 <sys_uring_enter>:
+//
+// Returns the number of calls run, < 0 on error.  Errors are:
+//	-E_INVAL if the ring's indices are corrupt.
+static int
+sys_uring_enter(void)
+{
+f01055b3:	55                   	push   %ebp
+f01055b4:	89 e5                	mov    %esp,%ebp
+f01055b6:	83 ec 08             	sub    $0x8,%esp
+	return uring_drain(curenv);
+f01055b9:	e8 7d 20 00 00       	call   f010763b <cpunum>
+f01055be:	83 ec 0c             	sub    $0xc,%esp
+f01055c1:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01055c4:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f01055ca:	e8 90 34 00 00       	call   f0108a5f <uring_drain>
+}
+f01055cf:	c9                   	leave
+f01055d0:	c3                   	ret
+
+f01055d1 <sys_uring_setup>:
+{
+f01055d1:	55                   	push   %ebp
+f01055d2:	89 e5                	mov    %esp,%ebp
+f01055d4:	83 ec 14             	sub    $0x14,%esp
+	return uring_setup(va);
+f01055d7:	ff 75 08             	push   0x8(%ebp)
+f01055da:	e8 db 33 00 00       	call   f01089ba <uring_setup>
+}
+f01055df:	c9                   	leave
+f01055e0:	c3                   	ret
+
+f01055e1 <sys_futex_wake>:
+{
+f01055e1:	55                   	push   %ebp
+f01055e2:	89 e5                	mov    %esp,%ebp
+f01055e4:	83 ec 10             	sub    $0x10,%esp
+	return futex_wake(addr, n);
+f01055e7:	ff 75 0c             	push   0xc(%ebp)
+f01055ea:	ff 75 08             	push   0x8(%ebp)
+f01055ed:	e8 3a 30 00 00       	call   f010862c <futex_wake>
+}
+f01055f2:	c9                   	leave
+f01055f3:	c3                   	ret
+
+f01055f4 <sys_futex_wait>:
+{
+f01055f4:	55                   	push   %ebp
+f01055f5:	89 e5                	mov    %esp,%ebp
+f01055f7:	83 ec 0c             	sub    $0xc,%esp
+	return futex_wait(addr, val, timeout);
+f01055fa:	ff 75 10             	push   0x10(%ebp)
+f01055fd:	ff 75 0c             	push   0xc(%ebp)
+f0105600:	ff 75 08             	push   0x8(%ebp)
+f0105603:	e8 96 2f 00 00       	call   f010859e <futex_wait>
+}
+f0105608:	c9                   	leave
+f0105609:	c3                   	ret
+
+f010560a <sys_net_try_recv>:
+{
+f010560a:	55                   	push   %ebp
+f010560b:	89 e5                	mov    %esp,%ebp
+f010560d:	83 ec 08             	sub    $0x8,%esp
+f0105610:	8b 45 08             	mov    0x8(%ebp),%eax
+	if ((uint32_t)buf >= UTOP) {
+f0105613:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f0105618:	77 11                	ja     f010562b <sys_net_try_recv+0x21>
+	return e1000_recv(buf, length);
+f010561a:	83 ec 08             	sub    $0x8,%esp
+f010561d:	ff 75 0c             	push   0xc(%ebp)
+f0105620:	50                   	push   %eax
+f0105621:	e8 a0 24 00 00       	call   f0107ac6 <e1000_recv>
+f0105626:	83 c4 10             	add    $0x10,%esp
+}
+f0105629:	c9                   	leave
+f010562a:	c3                   	ret
+		return -E_INVAL;
+f010562b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105630:	eb f7                	jmp    f0105629 <sys_net_try_recv+0x1f>
+
+f0105632 <sys_net_try_send>:
+{
+f0105632:	55                   	push   %ebp
+f0105633:	89 e5                	mov    %esp,%ebp
+f0105635:	83 ec 08             	sub    $0x8,%esp
+f0105638:	8b 45 08             	mov    0x8(%ebp),%eax
+	if ((uint32_t)buf >= UTOP) {
+f010563b:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f0105640:	77 11                	ja     f0105653 <sys_net_try_send+0x21>
+	return e1000_send(buf, length);
+f0105642:	83 ec 08             	sub    $0x8,%esp
+f0105645:	ff 75 0c             	push   0xc(%ebp)
+f0105648:	50                   	push   %eax
+f0105649:	e8 e6 23 00 00       	call   f0107a34 <e1000_send>
+f010564e:	83 c4 10             	add    $0x10,%esp
+}
+f0105651:	c9                   	leave
+f0105652:	c3                   	ret
+		return -E_INVAL;
+f0105653:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105658:	eb f7                	jmp    f0105651 <sys_net_try_send+0x1f>
+
+f010565a <sys_time_msec>:
+{
+f010565a:	55                   	push   %ebp
+f010565b:	89 e5                	mov    %esp,%ebp
+f010565d:	83 ec 08             	sub    $0x8,%esp
+	return time_msec();
+f0105660:	e8 54 2e 00 00       	call   f01084b9 <time_msec>
+}
+f0105665:	c9                   	leave
+f0105666:	c3                   	ret
+
+f0105667 <sys_ipc_recv>:
+{
+f0105667:	55                   	push   %ebp
+f0105668:	89 e5                	mov    %esp,%ebp
+f010566a:	53                   	push   %ebx
+f010566b:	83 ec 04             	sub    $0x4,%esp
+f010566e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cur = curenv;
+f0105671:	e8 c5 1f 00 00       	call   f010763b <cpunum>
+	if (dstva < (void*)UTOP) {
+f0105676:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010567c:	77 12                	ja     f0105690 <sys_ipc_recv+0x29>
+		CHECK_ARG_VA_ALIGNED(dstva);
+f010567e:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0105684:	74 0a                	je     f0105690 <sys_ipc_recv+0x29>
+}
+f0105686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010568b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010568e:	c9                   	leave
+f010568f:	c3                   	ret
+	cur = curenv;
+f0105690:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105693:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+	cur->env_status = ENV_NOT_RUNNABLE;
+f0105699:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	cur->env_ipc_recving = 1;
+f01056a0:	c6 40 6c 01          	movb   $0x1,0x6c(%eax)
+	cur->env_ipc_dstva = dstva;
+f01056a4:	89 58 70             	mov    %ebx,0x70(%eax)
+	sched_yield();
+f01056a7:	e8 47 fc ff ff       	call   f01052f3 <sched_yield>
+
+f01056ac <sys_yield>:
+{
+f01056ac:	55                   	push   %ebp
+f01056ad:	89 e5                	mov    %esp,%ebp
+f01056af:	83 ec 08             	sub    $0x8,%esp
+	sched_yield();
+f01056b2:	e8 3c fc ff ff       	call   f01052f3 <sched_yield>
+
+f01056b7 <sys_env_set_pgfault_upcall>:
+{
+f01056b7:	55                   	push   %ebp
+f01056b8:	89 e5                	mov    %esp,%ebp
+f01056ba:	53                   	push   %ebx
+f01056bb:	83 ec 18             	sub    $0x18,%esp
+f01056be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = envid2env(envid, &e, 1)) < 0) {
+f01056c1:	6a 01                	push   $0x1
+f01056c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01056c6:	50                   	push   %eax
+f01056c7:	ff 75 08             	push   0x8(%ebp)
+f01056ca:	e8 79 e3 ff ff       	call   f0103a48 <envid2env>
+f01056cf:	83 c4 10             	add    $0x10,%esp
+f01056d2:	85 c0                	test   %eax,%eax
+f01056d4:	78 1e                	js     f01056f4 <sys_env_set_pgfault_upcall+0x3d>
+	user_mem_assert(e, func, PGSIZE, PTE_U | PTE_P);
+f01056d6:	6a 05                	push   $0x5
+f01056d8:	68 00 10 00 00       	push   $0x1000
+f01056dd:	53                   	push   %ebx
+f01056de:	ff 75 f4             	push   -0xc(%ebp)
+f01056e1:	e8 0a e2 ff ff       	call   f01038f0 <user_mem_assert>
+	e->env_pgfault_upcall = func;
+f01056e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01056e9:	89 58 64             	mov    %ebx,0x64(%eax)
+	return 0;
+f01056ec:	83 c4 10             	add    $0x10,%esp
+f01056ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01056f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01056f7:	c9                   	leave
+f01056f8:	c3                   	ret
+
+f01056f9 <sys_env_set_trapframe>:
+{
+f01056f9:	55                   	push   %ebp
+f01056fa:	89 e5                	mov    %esp,%ebp
+f01056fc:	57                   	push   %edi
+f01056fd:	56                   	push   %esi
+f01056fe:	83 ec 10             	sub    $0x10,%esp
+f0105701:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (curenv->env_type == ENV_TYPE_FS) {
+f0105704:	e8 32 1f 00 00       	call   f010763b <cpunum>
+	if ((r = envid2env(envid, &env, check)) < 0) {
+f0105709:	83 ec 04             	sub    $0x4,%esp
+	if (curenv->env_type == ENV_TYPE_FS) {
+f010570c:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010570f:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105715:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105719:	0f 95 c0             	setne  %al
+f010571c:	0f b6 c0             	movzbl %al,%eax
+	if ((r = envid2env(envid, &env, check)) < 0) {
+f010571f:	50                   	push   %eax
+f0105720:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105723:	50                   	push   %eax
+f0105724:	ff 75 08             	push   0x8(%ebp)
+f0105727:	e8 1c e3 ff ff       	call   f0103a48 <envid2env>
+f010572c:	83 c4 10             	add    $0x10,%esp
+f010572f:	85 c0                	test   %eax,%eax
+f0105731:	78 32                	js     f0105765 <sys_env_set_trapframe+0x6c>
+	if ((uintptr_t)tf >= UTOP) {
+f0105733:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0105739:	77 31                	ja     f010576c <sys_env_set_trapframe+0x73>
+	tf->tf_cs |= 3;
+f010573b:	66 83 4e 34 03       	orw    $0x3,0x34(%esi)
+	tf->tf_es |= 3;
+f0105740:	66 83 4e 20 03       	orw    $0x3,0x20(%esi)
+	tf->tf_ds |= 3;
+f0105745:	66 83 4e 24 03       	orw    $0x3,0x24(%esi)
+	tf->tf_eflags &= ~FL_IOPL_MASK;
+f010574a:	8b 46 38             	mov    0x38(%esi),%eax
+f010574d:	80 e4 cf             	and    $0xcf,%ah
+f0105750:	80 cc 02             	or     $0x2,%ah
+f0105753:	89 46 38             	mov    %eax,0x38(%esi)
+	env->env_tf = *tf;
+f0105756:	b9 11 00 00 00       	mov    $0x11,%ecx
+f010575b:	8b 7d f4             	mov    -0xc(%ebp),%edi
+f010575e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	return 0;
+f0105760:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105765:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105768:	5e                   	pop    %esi
+f0105769:	5f                   	pop    %edi
+f010576a:	5d                   	pop    %ebp
+f010576b:	c3                   	ret
+		return -E_BAD_ENV;
+f010576c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105771:	eb f2                	jmp    f0105765 <sys_env_set_trapframe+0x6c>
+
+f0105773 <sys_env_set_status>:
+{
+f0105773:	55                   	push   %ebp
+f0105774:	89 e5                	mov    %esp,%ebp
+f0105776:	56                   	push   %esi
+f0105777:	53                   	push   %ebx
+f0105778:	83 ec 10             	sub    $0x10,%esp
+f010577b:	8b 75 08             	mov    0x8(%ebp),%esi
+f010577e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	cur = curenv;
+f0105781:	e8 b5 1e 00 00       	call   f010763b <cpunum>
+f0105786:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105789:	8b 90 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%edx
+	int check = 1;
+f010578f:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (cur->env_type == ENV_TYPE_FS && cur->env_id != envid) {
+f0105794:	83 7a 50 01          	cmpl   $0x1,0x50(%edx)
+f0105798:	74 31                	je     f01057cb <sys_env_set_status+0x58>
+	if ((r = envid2env(envid, &e, check)) < 0) {
+f010579a:	83 ec 04             	sub    $0x4,%esp
+f010579d:	50                   	push   %eax
+f010579e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01057a1:	50                   	push   %eax
+f01057a2:	56                   	push   %esi
+f01057a3:	e8 a0 e2 ff ff       	call   f0103a48 <envid2env>
+f01057a8:	83 c4 10             	add    $0x10,%esp
+f01057ab:	85 c0                	test   %eax,%eax
+f01057ad:	78 15                	js     f01057c4 <sys_env_set_status+0x51>
+	if (status != ENV_RUNNABLE && status != ENV_NOT_RUNNABLE) {
+f01057af:	8d 43 fe             	lea    -0x2(%ebx),%eax
+f01057b2:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f01057b7:	75 1d                	jne    f01057d6 <sys_env_set_status+0x63>
+	e->env_status = status;
+f01057b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01057bc:	89 58 54             	mov    %ebx,0x54(%eax)
+	return 0;
+f01057bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01057c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01057c7:	5b                   	pop    %ebx
+f01057c8:	5e                   	pop    %esi
+f01057c9:	5d                   	pop    %ebp
+f01057ca:	c3                   	ret
+	if (cur->env_type == ENV_TYPE_FS && cur->env_id != envid) {
+f01057cb:	39 72 48             	cmp    %esi,0x48(%edx)
+f01057ce:	0f 94 c0             	sete   %al
+f01057d1:	0f b6 c0             	movzbl %al,%eax
+f01057d4:	eb c4                	jmp    f010579a <sys_env_set_status+0x27>
+		return -E_INVAL;
+f01057d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01057db:	eb e7                	jmp    f01057c4 <sys_env_set_status+0x51>
+
+f01057dd <envid2pgdirWithCheck>:
+{
+f01057dd:	55                   	push   %ebp
+f01057de:	89 e5                	mov    %esp,%ebp
+f01057e0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((err = envid2env(envid, &e, perm)) < 0) {
+f01057e3:	0f b6 d2             	movzbl %dl,%edx
+f01057e6:	52                   	push   %edx
+f01057e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f01057ea:	52                   	push   %edx
+f01057eb:	50                   	push   %eax
+f01057ec:	e8 57 e2 ff ff       	call   f0103a48 <envid2env>
+f01057f1:	83 c4 10             	add    $0x10,%esp
+f01057f4:	85 c0                	test   %eax,%eax
+f01057f6:	78 08                	js     f0105800 <envid2pgdirWithCheck+0x23>
+	return e->env_pgdir;
+f01057f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01057fb:	8b 40 60             	mov    0x60(%eax),%eax
+}
+f01057fe:	c9                   	leave
+f01057ff:	c3                   	ret
+		return NULL;
+f0105800:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105805:	eb f7                	jmp    f01057fe <envid2pgdirWithCheck+0x21>
+
+f0105807 <sys_page_unmap>:
+{
+f0105807:	55                   	push   %ebp
+f0105808:	89 e5                	mov    %esp,%ebp
+f010580a:	53                   	push   %ebx
+f010580b:	83 ec 04             	sub    $0x4,%esp
+f010580e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (curenv->env_type == ENV_TYPE_FS) {
+f0105811:	e8 25 1e 00 00       	call   f010763b <cpunum>
+f0105816:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105819:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f010581f:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105823:	0f 95 c2             	setne  %dl
+	CHECK_ARG_VA(va);
+f0105826:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f010582c:	75 2e                	jne    f010585c <sys_page_unmap+0x55>
+f010582e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105834:	77 26                	ja     f010585c <sys_page_unmap+0x55>
+	pgdir = envid2pgdirWithCheck(envid, check);
+f0105836:	0f b6 d2             	movzbl %dl,%edx
+f0105839:	8b 45 08             	mov    0x8(%ebp),%eax
+f010583c:	e8 9c ff ff ff       	call   f01057dd <envid2pgdirWithCheck>
+	if (!pgdir) {
+f0105841:	85 c0                	test   %eax,%eax
+f0105843:	74 1e                	je     f0105863 <sys_page_unmap+0x5c>
+	page_remove(pgdir, va);
+f0105845:	83 ec 08             	sub    $0x8,%esp
+f0105848:	53                   	push   %ebx
+f0105849:	50                   	push   %eax
+f010584a:	e8 4e c1 ff ff       	call   f010199d <page_remove>
+	return 0;
+f010584f:	83 c4 10             	add    $0x10,%esp
+f0105852:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105857:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010585a:	c9                   	leave
+f010585b:	c3                   	ret
+	CHECK_ARG_VA(va);
+f010585c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105861:	eb f4                	jmp    f0105857 <sys_page_unmap+0x50>
+		return -E_BAD_ENV;
+f0105863:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105868:	eb ed                	jmp    f0105857 <sys_page_unmap+0x50>
+
+f010586a <sys_ipc_try_send>:
+{
+f010586a:	55                   	push   %ebp
+f010586b:	89 e5                	mov    %esp,%ebp
+f010586d:	57                   	push   %edi
+f010586e:	56                   	push   %esi
+f010586f:	53                   	push   %ebx
+f0105870:	83 ec 20             	sub    $0x20,%esp
+f0105873:	8b 75 08             	mov    0x8(%ebp),%esi
+f0105876:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if ((r = envid2env(envid, &e, 0)) < 0) {
+f0105879:	6a 00                	push   $0x0
+f010587b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010587e:	50                   	push   %eax
+f010587f:	56                   	push   %esi
+f0105880:	e8 c3 e1 ff ff       	call   f0103a48 <envid2env>
+f0105885:	83 c4 10             	add    $0x10,%esp
+f0105888:	85 c0                	test   %eax,%eax
+f010588a:	0f 88 cd 00 00 00    	js     f010595d <sys_ipc_try_send+0xf3>
+	cur = curenv;
+f0105890:	e8 a6 1d 00 00       	call   f010763b <cpunum>
+f0105895:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105898:	8b b0 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%esi
+	if (!e->env_ipc_recving || e->env_status != ENV_NOT_RUNNABLE) {
+f010589e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01058a1:	80 78 6c 00          	cmpb   $0x0,0x6c(%eax)
+f01058a5:	0f 84 d7 00 00 00    	je     f0105982 <sys_ipc_try_send+0x118>
+f01058ab:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f01058af:	0f 85 d4 00 00 00    	jne    f0105989 <sys_ipc_try_send+0x11f>
+	if (srcva < (void*)UTOP) {
+f01058b5:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f01058bb:	0f 87 f9 00 00 00    	ja     f01059ba <sys_ipc_try_send+0x150>
+		CHECK_ARG_VA_ALIGNED(srcva);
+f01058c1:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+f01058c7:	0f 85 c3 00 00 00    	jne    f0105990 <sys_ipc_try_send+0x126>
+		CHECK_ARG_PERM(perm);
+f01058cd:	8b 55 14             	mov    0x14(%ebp),%edx
+f01058d0:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+f01058d6:	83 fa 05             	cmp    $0x5,%edx
+f01058d9:	0f 85 b8 00 00 00    	jne    f0105997 <sys_ipc_try_send+0x12d>
+	e->env_ipc_perm = 0;
+f01058df:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+	if (srcva < (void*)UTOP && e->env_ipc_dstva < (void*)UTOP) {
+f01058e6:	81 78 70 ff ff bf ee 	cmpl   $0xeebfffff,0x70(%eax)
+f01058ed:	0f 87 ce 00 00 00    	ja     f01059c1 <sys_ipc_try_send+0x157>
+		page = page_lookup(cur->env_pgdir, srcva, &pte);
+f01058f3:	83 ec 04             	sub    $0x4,%esp
+f01058f6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01058f9:	50                   	push   %eax
+f01058fa:	57                   	push   %edi
+f01058fb:	ff 76 60             	push   0x60(%esi)
+f01058fe:	e8 e0 be ff ff       	call   f01017e3 <page_lookup>
+		if (!page || !pte || !(*pte & (PTE_U | PTE_P))) {
+f0105903:	83 c4 10             	add    $0x10,%esp
+f0105906:	85 c0                	test   %eax,%eax
+f0105908:	0f 84 90 00 00 00    	je     f010599e <sys_ipc_try_send+0x134>
+f010590e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0105911:	85 d2                	test   %edx,%edx
+f0105913:	0f 84 8c 00 00 00    	je     f01059a5 <sys_ipc_try_send+0x13b>
+f0105919:	8b 12                	mov    (%edx),%edx
+f010591b:	f6 c2 05             	test   $0x5,%dl
+f010591e:	0f 84 88 00 00 00    	je     f01059ac <sys_ipc_try_send+0x142>
+		if ((perm & PTE_W) && !(*pte & PTE_W)) {
+f0105924:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+f0105928:	74 09                	je     f0105933 <sys_ipc_try_send+0xc9>
+f010592a:	f6 c2 02             	test   $0x2,%dl
+f010592d:	0f 84 80 00 00 00    	je     f01059b3 <sys_ipc_try_send+0x149>
+		if ((r = page_insert(e->env_pgdir, page, e->env_ipc_dstva, perm)) < 0) {
+f0105933:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105936:	ff 75 14             	push   0x14(%ebp)
+f0105939:	ff 72 70             	push   0x70(%edx)
+f010593c:	50                   	push   %eax
+f010593d:	ff 72 60             	push   0x60(%edx)
+f0105940:	e8 ca c0 ff ff       	call   f0101a0f <page_insert>
+f0105945:	89 c3                	mov    %eax,%ebx
+f0105947:	83 c4 10             	add    $0x10,%esp
+f010594a:	85 c0                	test   %eax,%eax
+f010594c:	0f 88 95 00 00 00    	js     f01059e7 <sys_ipc_try_send+0x17d>
+		e->env_ipc_perm = perm;
+f0105952:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105955:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0105958:	89 48 7c             	mov    %ecx,0x7c(%eax)
+f010595b:	eb 64                	jmp    f01059c1 <sys_ipc_try_send+0x157>
+f010595d:	89 c3                	mov    %eax,%ebx
+		Debug("bad envid: %x, %e", envid, r);
+f010595f:	83 ec 08             	sub    $0x8,%esp
+f0105962:	50                   	push   %eax
+f0105963:	56                   	push   %esi
+f0105964:	68 54 a9 10 f0       	push   $0xf010a954
+f0105969:	68 23 02 00 00       	push   $0x223
+f010596e:	68 30 ac 10 f0       	push   $0xf010ac30
+f0105973:	68 66 a9 10 f0       	push   $0xf010a966
+f0105978:	e8 13 a9 ff ff       	call   f0100290 <_log>
+		return r;
+f010597d:	83 c4 20             	add    $0x20,%esp
+f0105980:	eb 65                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+		return -E_IPC_NOT_RECV;
+f0105982:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f0105987:	eb 5e                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+f0105989:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f010598e:	eb 57                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+		CHECK_ARG_VA_ALIGNED(srcva);
+f0105990:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105995:	eb 50                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+		CHECK_ARG_PERM(perm);
+f0105997:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010599c:	eb 49                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+			return -E_INVAL;
+f010599e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01059a3:	eb 42                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+f01059a5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01059aa:	eb 3b                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+f01059ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01059b1:	eb 34                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+			return -E_INVAL;
+f01059b3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01059b8:	eb 2d                	jmp    f01059e7 <sys_ipc_try_send+0x17d>
+	e->env_ipc_perm = 0;
+f01059ba:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+	e->env_ipc_from = cur->env_id;
+f01059c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01059c4:	8b 56 48             	mov    0x48(%esi),%edx
+f01059c7:	89 50 78             	mov    %edx,0x78(%eax)
+	e->env_ipc_value = value;
+f01059ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01059cd:	89 50 74             	mov    %edx,0x74(%eax)
+	e->env_ipc_recving = 0;
+f01059d0:	c6 40 6c 00          	movb   $0x0,0x6c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f01059d4:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01059db:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	return 0;
+f01059e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01059e7:	89 d8                	mov    %ebx,%eax
+f01059e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01059ec:	5b                   	pop    %ebx
+f01059ed:	5e                   	pop    %esi
+f01059ee:	5f                   	pop    %edi
+f01059ef:	5d                   	pop    %ebp
+f01059f0:	c3                   	ret
+
+f01059f1 <sys_page_map>:
+{
+f01059f1:	55                   	push   %ebp
+f01059f2:	89 e5                	mov    %esp,%ebp
+f01059f4:	57                   	push   %edi
+f01059f5:	56                   	push   %esi
+f01059f6:	53                   	push   %ebx
+f01059f7:	83 ec 2c             	sub    $0x2c,%esp
+f01059fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01059fd:	8b 75 14             	mov    0x14(%ebp),%esi
+	CHECK_ARG_VA(srcva);
+f0105a00:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105a06:	0f 87 cb 00 00 00    	ja     f0105ad7 <sys_page_map+0xe6>
+	CHECK_ARG_VA(dstva);
+f0105a0c:	89 d8                	mov    %ebx,%eax
+f0105a0e:	09 f0                	or     %esi,%eax
+f0105a10:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0105a15:	0f 85 c3 00 00 00    	jne    f0105ade <sys_page_map+0xed>
+f0105a1b:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0105a21:	0f 87 b7 00 00 00    	ja     f0105ade <sys_page_map+0xed>
+	CHECK_ARG_PERM(perm);
+f0105a27:	8b 45 18             	mov    0x18(%ebp),%eax
+f0105a2a:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105a2f:	83 f8 05             	cmp    $0x5,%eax
+f0105a32:	0f 85 ad 00 00 00    	jne    f0105ae5 <sys_page_map+0xf4>
+	if ((r = envid2env(srcenvid, &env, curenv->env_type != ENV_TYPE_FS)) < 0) {
+f0105a38:	e8 fe 1b 00 00       	call   f010763b <cpunum>
+f0105a3d:	83 ec 04             	sub    $0x4,%esp
+f0105a40:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105a43:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105a49:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105a4d:	0f 95 c0             	setne  %al
+f0105a50:	0f b6 c0             	movzbl %al,%eax
+f0105a53:	50                   	push   %eax
+f0105a54:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105a57:	50                   	push   %eax
+f0105a58:	ff 75 08             	push   0x8(%ebp)
+f0105a5b:	e8 e8 df ff ff       	call   f0103a48 <envid2env>
+f0105a60:	83 c4 10             	add    $0x10,%esp
+f0105a63:	85 c0                	test   %eax,%eax
+f0105a65:	78 68                	js     f0105acf <sys_page_map+0xde>
+	srcpgdir = env->env_pgdir;
+f0105a67:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105a6a:	8b 40 60             	mov    0x60(%eax),%eax
+f0105a6d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if (curenv->env_type == ENV_TYPE_FS) {
+f0105a70:	e8 c6 1b 00 00       	call   f010763b <cpunum>
+f0105a75:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105a78:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105a7e:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105a82:	0f 95 c2             	setne  %dl
+f0105a85:	0f b6 d2             	movzbl %dl,%edx
+	if ((dstpgdir = envid2pgdirWithCheck(dstenvid, checkDstEnv)) == NULL) {
+f0105a88:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105a8b:	e8 4d fd ff ff       	call   f01057dd <envid2pgdirWithCheck>
+f0105a90:	89 c7                	mov    %eax,%edi
+f0105a92:	85 c0                	test   %eax,%eax
+f0105a94:	74 56                	je     f0105aec <sys_page_map+0xfb>
+	srcpage = page_lookup(srcpgdir,srcva, &srcpte);
+f0105a96:	83 ec 04             	sub    $0x4,%esp
+f0105a99:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105a9c:	50                   	push   %eax
+f0105a9d:	53                   	push   %ebx
+f0105a9e:	ff 75 d4             	push   -0x2c(%ebp)
+f0105aa1:	e8 3d bd ff ff       	call   f01017e3 <page_lookup>
+	if (!srcpage) {
+f0105aa6:	83 c4 10             	add    $0x10,%esp
+f0105aa9:	85 c0                	test   %eax,%eax
+f0105aab:	74 46                	je     f0105af3 <sys_page_map+0x102>
+	if (perm & PTE_W && !(*srcpte & PTE_W)) {
+f0105aad:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+f0105ab1:	74 08                	je     f0105abb <sys_page_map+0xca>
+f0105ab3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105ab6:	f6 02 02             	testb  $0x2,(%edx)
+f0105ab9:	74 3f                	je     f0105afa <sys_page_map+0x109>
+	if (page_insert(dstpgdir, srcpage, dstva, perm) < 0) {
+f0105abb:	ff 75 18             	push   0x18(%ebp)
+f0105abe:	56                   	push   %esi
+f0105abf:	50                   	push   %eax
+f0105ac0:	57                   	push   %edi
+f0105ac1:	e8 49 bf ff ff       	call   f0101a0f <page_insert>
+f0105ac6:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f0105ac9:	c1 f8 1f             	sar    $0x1f,%eax
+f0105acc:	83 e0 fc             	and    $0xfffffffc,%eax
+}
+f0105acf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105ad2:	5b                   	pop    %ebx
+f0105ad3:	5e                   	pop    %esi
+f0105ad4:	5f                   	pop    %edi
+f0105ad5:	5d                   	pop    %ebp
+f0105ad6:	c3                   	ret
+	CHECK_ARG_VA(srcva);
+f0105ad7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105adc:	eb f1                	jmp    f0105acf <sys_page_map+0xde>
+	CHECK_ARG_VA(dstva);
+f0105ade:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105ae3:	eb ea                	jmp    f0105acf <sys_page_map+0xde>
+	CHECK_ARG_PERM(perm);
+f0105ae5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105aea:	eb e3                	jmp    f0105acf <sys_page_map+0xde>
+		return -E_BAD_ENV;
+f0105aec:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105af1:	eb dc                	jmp    f0105acf <sys_page_map+0xde>
+		return -E_INVAL;
+f0105af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105af8:	eb d5                	jmp    f0105acf <sys_page_map+0xde>
+		return -E_INVAL;
+f0105afa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105aff:	eb ce                	jmp    f0105acf <sys_page_map+0xde>
+
+f0105b01 <sys_page_alloc>:
+{
+f0105b01:	55                   	push   %ebp
+f0105b02:	89 e5                	mov    %esp,%ebp
+f0105b04:	57                   	push   %edi
+f0105b05:	56                   	push   %esi
+f0105b06:	53                   	push   %ebx
+f0105b07:	83 ec 0c             	sub    $0xc,%esp
+f0105b0a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	CHECK_ARG_VA(va);
+f0105b0d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+f0105b13:	0f 85 af 00 00 00    	jne    f0105bc8 <sys_page_alloc+0xc7>
+f0105b19:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105b1f:	0f 87 a3 00 00 00    	ja     f0105bc8 <sys_page_alloc+0xc7>
+	CHECK_ARG_PERM(perm);
+f0105b25:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105b28:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105b2d:	83 f8 05             	cmp    $0x5,%eax
+f0105b30:	0f 85 99 00 00 00    	jne    f0105bcf <sys_page_alloc+0xce>
+	cur = curenv;
+f0105b36:	e8 00 1b 00 00       	call   f010763b <cpunum>
+f0105b3b:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105b3e:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+	int check = 1;
+f0105b44:	ba 01 00 00 00       	mov    $0x1,%edx
+	if (cur->env_type == ENV_TYPE_FS && envid != cur->env_id) {
+f0105b49:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105b4d:	74 44                	je     f0105b93 <sys_page_alloc+0x92>
+	pgdir = envid2pgdirWithCheck(envid, check);
+f0105b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105b52:	e8 86 fc ff ff       	call   f01057dd <envid2pgdirWithCheck>
+f0105b57:	89 c6                	mov    %eax,%esi
+	if (!pgdir) {
+f0105b59:	85 c0                	test   %eax,%eax
+f0105b5b:	74 79                	je     f0105bd6 <sys_page_alloc+0xd5>
+	page = page_alloc(ALLOC_ZERO);
+f0105b5d:	83 ec 0c             	sub    $0xc,%esp
+f0105b60:	6a 01                	push   $0x1
+f0105b62:	e8 c4 b9 ff ff       	call   f010152b <page_alloc>
+f0105b67:	89 c3                	mov    %eax,%ebx
+	if (!page) {
+f0105b69:	83 c4 10             	add    $0x10,%esp
+f0105b6c:	85 c0                	test   %eax,%eax
+f0105b6e:	74 6d                	je     f0105bdd <sys_page_alloc+0xdc>
+	if ((err = page_insert(pgdir, page, va, perm)) < 0) {
+f0105b70:	ff 75 10             	push   0x10(%ebp)
+f0105b73:	57                   	push   %edi
+f0105b74:	50                   	push   %eax
+f0105b75:	56                   	push   %esi
+f0105b76:	e8 94 be ff ff       	call   f0101a0f <page_insert>
+f0105b7b:	89 c6                	mov    %eax,%esi
+f0105b7d:	83 c4 10             	add    $0x10,%esp
+f0105b80:	85 c0                	test   %eax,%eax
+f0105b82:	78 1d                	js     f0105ba1 <sys_page_alloc+0xa0>
+	return 0;
+f0105b84:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0105b89:	89 f0                	mov    %esi,%eax
+f0105b8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105b8e:	5b                   	pop    %ebx
+f0105b8f:	5e                   	pop    %esi
+f0105b90:	5f                   	pop    %edi
+f0105b91:	5d                   	pop    %ebp
+f0105b92:	c3                   	ret
+	if (cur->env_type == ENV_TYPE_FS && envid != cur->env_id) {
+f0105b93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0105b96:	39 48 48             	cmp    %ecx,0x48(%eax)
+f0105b99:	0f 94 c2             	sete   %dl
+f0105b9c:	0f b6 d2             	movzbl %dl,%edx
+f0105b9f:	eb ae                	jmp    f0105b4f <sys_page_alloc+0x4e>
+		page_free(page);
+f0105ba1:	83 ec 0c             	sub    $0xc,%esp
+f0105ba4:	53                   	push   %ebx
+f0105ba5:	e8 fc b9 ff ff       	call   f01015a6 <page_free>
+		Debug("No aviable page allocated for pte table");
+f0105baa:	68 68 ab 10 f0       	push   $0xf010ab68
+f0105baf:	68 8d 01 00 00       	push   $0x18d
+f0105bb4:	68 20 ac 10 f0       	push   $0xf010ac20
+f0105bb9:	68 66 a9 10 f0       	push   $0xf010a966
+f0105bbe:	e8 cd a6 ff ff       	call   f0100290 <_log>
+		return err;
+f0105bc3:	83 c4 20             	add    $0x20,%esp
+f0105bc6:	eb c1                	jmp    f0105b89 <sys_page_alloc+0x88>
+	CHECK_ARG_VA(va);
+f0105bc8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0105bcd:	eb ba                	jmp    f0105b89 <sys_page_alloc+0x88>
+	CHECK_ARG_PERM(perm);
+f0105bcf:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0105bd4:	eb b3                	jmp    f0105b89 <sys_page_alloc+0x88>
+		return -E_BAD_ENV;
+f0105bd6:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0105bdb:	eb ac                	jmp    f0105b89 <sys_page_alloc+0x88>
+		return -E_NO_MEM;
+f0105bdd:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0105be2:	eb a5                	jmp    f0105b89 <sys_page_alloc+0x88>
+
+f0105be4 <sys_env_destroy>:
+{
+f0105be4:	55                   	push   %ebp
+f0105be5:	89 e5                	mov    %esp,%ebp
+f0105be7:	83 ec 18             	sub    $0x18,%esp
+	if (curenv->env_type ==ENV_TYPE_FS)
+f0105bea:	e8 4c 1a 00 00       	call   f010763b <cpunum>
+	if ((r = envid2env(envid, &e, check)) < 0)
+f0105bef:	83 ec 04             	sub    $0x4,%esp
+	if (curenv->env_type ==ENV_TYPE_FS)
+f0105bf2:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105bf5:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105bfb:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0105bff:	0f 95 c0             	setne  %al
+f0105c02:	0f b6 c0             	movzbl %al,%eax
+	if ((r = envid2env(envid, &e, check)) < 0)
+f0105c05:	50                   	push   %eax
+f0105c06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105c09:	50                   	push   %eax
+f0105c0a:	ff 75 08             	push   0x8(%ebp)
+f0105c0d:	e8 36 de ff ff       	call   f0103a48 <envid2env>
+f0105c12:	83 c4 10             	add    $0x10,%esp
+f0105c15:	85 c0                	test   %eax,%eax
+f0105c17:	78 13                	js     f0105c2c <sys_env_destroy+0x48>
+	env_destroy(e);
+f0105c19:	83 ec 0c             	sub    $0xc,%esp
+f0105c1c:	ff 75 f4             	push   -0xc(%ebp)
+f0105c1f:	e8 ec e3 ff ff       	call   f0104010 <env_destroy>
+	return 0;
+f0105c24:	83 c4 10             	add    $0x10,%esp
+f0105c27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105c2c:	c9                   	leave
+f0105c2d:	c3                   	ret
+
+f0105c2e <sys_cgetc>:
+{
+f0105c2e:	55                   	push   %ebp
+f0105c2f:	89 e5                	mov    %esp,%ebp
+f0105c31:	83 ec 08             	sub    $0x8,%esp
+	return cons_getc();
+f0105c34:	e8 96 aa ff ff       	call   f01006cf <cons_getc>
+}
+f0105c39:	c9                   	leave
+f0105c3a:	c3                   	ret
+
+f0105c3b <sys_thread_create>:
+{
+f0105c3b:	55                   	push   %ebp
+f0105c3c:	89 e5                	mov    %esp,%ebp
+f0105c3e:	57                   	push   %edi
+f0105c3f:	56                   	push   %esi
+f0105c40:	53                   	push   %ebx
+f0105c41:	83 ec 1c             	sub    $0x1c,%esp
+f0105c44:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0105c47:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0105c4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (eip >= UTOP || esp > UTOP || uxstacktop > UTOP || PGOFF(uxstacktop))
+f0105c4d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105c53:	0f 97 c0             	seta   %al
+f0105c56:	81 fe 00 00 c0 ee    	cmp    $0xeec00000,%esi
+f0105c5c:	0f 97 c2             	seta   %dl
+f0105c5f:	08 d0                	or     %dl,%al
+f0105c61:	0f 85 71 01 00 00    	jne    f0105dd8 <sys_thread_create+0x19d>
+f0105c67:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+f0105c6d:	0f 87 65 01 00 00    	ja     f0105dd8 <sys_thread_create+0x19d>
+f0105c73:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0105c79:	0f 85 60 01 00 00    	jne    f0105ddf <sys_thread_create+0x1a4>
+	if ((err = env_alloc(&e, curenv->env_id)) < 0)
+f0105c7f:	e8 b7 19 00 00       	call   f010763b <cpunum>
+f0105c84:	83 ec 08             	sub    $0x8,%esp
+f0105c87:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105c8a:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105c90:	ff 70 48             	push   0x48(%eax)
+f0105c93:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105c96:	50                   	push   %eax
+f0105c97:	e8 e8 de ff ff       	call   f0103b84 <env_alloc>
+f0105c9c:	83 c4 10             	add    $0x10,%esp
+f0105c9f:	85 c0                	test   %eax,%eax
+f0105ca1:	0f 88 d7 00 00 00    	js     f0105d7e <sys_thread_create+0x143>
+	page_decref(pa2page(PADDR(e->env_pgdir)));
+f0105ca7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105caa:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0105cad:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105cb2:	0f 86 ce 00 00 00    	jbe    f0105d86 <sys_thread_create+0x14b>
+	return (physaddr_t)kva - KERNBASE;
+f0105cb8:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0105cbd:	c1 e8 0c             	shr    $0xc,%eax
+f0105cc0:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0105cc6:	0f 83 cf 00 00 00    	jae    f0105d9b <sys_thread_create+0x160>
+f0105ccc:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0105ccf:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f0105cd5:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0105cd8:	50                   	push   %eax
+f0105cd9:	e8 00 b9 ff ff       	call   f01015de <page_decref>
+	e->env_pgdir = curenv->env_pgdir;
+f0105cde:	e8 58 19 00 00       	call   f010763b <cpunum>
+f0105ce3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105ce6:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105ce9:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105cef:	8b 40 60             	mov    0x60(%eax),%eax
+f0105cf2:	89 42 60             	mov    %eax,0x60(%edx)
+	if ((uint32_t)kva < KERNBASE)
+f0105cf5:	83 c4 10             	add    $0x10,%esp
+f0105cf8:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105cfd:	0f 86 ac 00 00 00    	jbe    f0105daf <sys_thread_create+0x174>
+	return (physaddr_t)kva - KERNBASE;
+f0105d03:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0105d08:	c1 e8 0c             	shr    $0xc,%eax
+f0105d0b:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0105d11:	0f 83 ad 00 00 00    	jae    f0105dc4 <sys_thread_create+0x189>
+	return &pages[PGNUM(pa)];
+f0105d17:	8b 0d a0 62 a4 f0    	mov    0xf0a462a0,%ecx
+	pa2page(PADDR(e->env_pgdir))->pp_ref++;
+f0105d1d:	66 83 44 c1 04 01    	addw   $0x1,0x4(%ecx,%eax,8)
+	e->env_tf.tf_eip = eip;
+f0105d23:	89 7a 30             	mov    %edi,0x30(%edx)
+	e->env_tf.tf_esp = esp;
+f0105d26:	89 72 3c             	mov    %esi,0x3c(%edx)
+	e->env_tf.tf_eflags = curenv->env_tf.tf_eflags | FL_IF;
+f0105d29:	e8 0d 19 00 00       	call   f010763b <cpunum>
+f0105d2e:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105d31:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105d37:	8b 40 38             	mov    0x38(%eax),%eax
+f0105d3a:	80 cc 02             	or     $0x2,%ah
+f0105d3d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105d40:	89 42 38             	mov    %eax,0x38(%edx)
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f0105d43:	e8 f3 18 00 00       	call   f010763b <cpunum>
+f0105d48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105d4b:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105d4e:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105d54:	8b 40 64             	mov    0x64(%eax),%eax
+f0105d57:	89 42 64             	mov    %eax,0x64(%edx)
+	e->env_uxstacktop = uxstacktop;
+f0105d5a:	89 5a 68             	mov    %ebx,0x68(%edx)
+	e->env_type = curenv->env_type;
+f0105d5d:	e8 d9 18 00 00       	call   f010763b <cpunum>
+f0105d62:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105d65:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105d68:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105d6e:	8b 40 50             	mov    0x50(%eax),%eax
+f0105d71:	89 42 50             	mov    %eax,0x50(%edx)
+	e->env_status = ENV_RUNNABLE;
+f0105d74:	c7 42 54 02 00 00 00 	movl   $0x2,0x54(%edx)
+	return e->env_id;
+f0105d7b:	8b 42 48             	mov    0x48(%edx),%eax
+}
+f0105d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105d81:	5b                   	pop    %ebx
+f0105d82:	5e                   	pop    %esi
+f0105d83:	5f                   	pop    %edi
+f0105d84:	5d                   	pop    %ebp
+f0105d85:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105d86:	50                   	push   %eax
+f0105d87:	68 48 8e 10 f0       	push   $0xf0108e48
+f0105d8c:	68 ba 00 00 00       	push   $0xba
+f0105d91:	68 66 a9 10 f0       	push   $0xf010a966
+f0105d96:	e8 a5 a2 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0105d9b:	83 ec 04             	sub    $0x4,%esp
+f0105d9e:	68 1c 96 10 f0       	push   $0xf010961c
+f0105da3:	6a 54                	push   $0x54
+f0105da5:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0105daa:	e8 91 a2 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105daf:	50                   	push   %eax
+f0105db0:	68 48 8e 10 f0       	push   $0xf0108e48
+f0105db5:	68 bc 00 00 00       	push   $0xbc
+f0105dba:	68 66 a9 10 f0       	push   $0xf010a966
+f0105dbf:	e8 7c a2 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0105dc4:	83 ec 04             	sub    $0x4,%esp
+f0105dc7:	68 1c 96 10 f0       	push   $0xf010961c
+f0105dcc:	6a 54                	push   $0x54
+f0105dce:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0105dd3:	e8 68 a2 ff ff       	call   f0100040 <_panic>
+		return -E_INVAL;
+f0105dd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105ddd:	eb 9f                	jmp    f0105d7e <sys_thread_create+0x143>
+f0105ddf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105de4:	eb 98                	jmp    f0105d7e <sys_thread_create+0x143>
+
+f0105de6 <sys_exec>:
+{
+f0105de6:	55                   	push   %ebp
+f0105de7:	89 e5                	mov    %esp,%ebp
+f0105de9:	57                   	push   %edi
+f0105dea:	56                   	push   %esi
+f0105deb:	53                   	push   %ebx
+f0105dec:	83 ec 2c             	sub    $0x2c,%esp
+	if (pa2page(PADDR(curenv->env_pgdir))->pp_ref > 1)
+f0105def:	e8 47 18 00 00       	call   f010763b <cpunum>
+f0105df4:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105df7:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105dfd:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0105e00:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105e05:	0f 86 d1 00 00 00    	jbe    f0105edc <sys_exec+0xf6>
+	return (physaddr_t)kva - KERNBASE;
+f0105e0b:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0105e10:	c1 e8 0c             	shr    $0xc,%eax
+f0105e13:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0105e19:	0f 83 d2 00 00 00    	jae    f0105ef1 <sys_exec+0x10b>
+f0105e1f:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f0105e25:	66 83 7c c2 04 01    	cmpw   $0x1,0x4(%edx,%eax,8)
+f0105e2b:	0f 87 91 03 00 00    	ja     f01061c2 <sys_exec+0x3dc>
+	if (!envs[0].env_ipc_recving) {
+f0105e31:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+f0105e36:	80 78 6c 00          	cmpb   $0x0,0x6c(%eax)
+f0105e3a:	0f 84 c5 00 00 00    	je     f0105f05 <sys_exec+0x11f>
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0) {
+f0105e40:	83 ec 04             	sub    $0x4,%esp
+f0105e43:	6a 07                	push   $0x7
+f0105e45:	68 00 00 40 00       	push   $0x400000
+f0105e4a:	6a 00                	push   $0x0
+f0105e4c:	e8 b0 fc ff ff       	call   f0105b01 <sys_page_alloc>
+f0105e51:	89 c3                	mov    %eax,%ebx
+f0105e53:	83 c4 10             	add    $0x10,%esp
+f0105e56:	85 c0                	test   %eax,%eax
+f0105e58:	0f 88 91 03 00 00    	js     f01061ef <sys_exec+0x409>
+	e = curenv;
+f0105e5e:	e8 d8 17 00 00       	call   f010763b <cpunum>
+f0105e63:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105e66:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105e6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	e->env_status = ENV_NOT_RUNNABLE;
+f0105e6f:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	strncpy(fsipcbuf->load.req_path, pathname, MAXPATHLEN);
+f0105e76:	83 ec 04             	sub    $0x4,%esp
+f0105e79:	68 00 04 00 00       	push   $0x400
+f0105e7e:	ff 75 08             	push   0x8(%ebp)
+f0105e81:	68 00 00 40 00       	push   $0x400000
+f0105e86:	e8 b2 10 00 00       	call   f0106f3d <strncpy>
+	fsipcbuf->load.req_path[MAXPATHLEN-1] = 0;
+f0105e8b:	c6 05 ff 03 40 00 00 	movb   $0x0,0x4003ff
+	Debug("fsipcbuf.load.req_path: %p %s %s\n", &fsipcbuf->load.req_path, fsipcbuf->load.req_path, (void*)fsipcbuf);
+f0105e92:	83 c4 0c             	add    $0xc,%esp
+f0105e95:	68 00 00 40 00       	push   $0x400000
+f0105e9a:	68 00 00 40 00       	push   $0x400000
+f0105e9f:	68 00 00 40 00       	push   $0x400000
+f0105ea4:	68 90 ab 10 f0       	push   $0xf010ab90
+f0105ea9:	68 5f 03 00 00       	push   $0x35f
+f0105eae:	68 50 ac 10 f0       	push   $0xf010ac50
+f0105eb3:	68 66 a9 10 f0       	push   $0xf010a966
+f0105eb8:	e8 d3 a3 ff ff       	call   f0100290 <_log>
+	cprintf("enter init stack\n");
+f0105ebd:	83 c4 14             	add    $0x14,%esp
+f0105ec0:	68 75 a9 10 f0       	push   $0xf010a975
+f0105ec5:	e8 b3 e4 ff ff       	call   f010437d <cprintf>
+	for (argc = 0; argv[argc] != 0; argc++)
+f0105eca:	83 c4 10             	add    $0x10,%esp
+f0105ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+	string_size = 0;
+f0105ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105ed7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+f0105eda:	eb 53                	jmp    f0105f2f <sys_exec+0x149>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105edc:	50                   	push   %eax
+f0105edd:	68 48 8e 10 f0       	push   $0xf0108e48
+f0105ee2:	68 47 03 00 00       	push   $0x347
+f0105ee7:	68 66 a9 10 f0       	push   $0xf010a966
+f0105eec:	e8 4f a1 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0105ef1:	83 ec 04             	sub    $0x4,%esp
+f0105ef4:	68 1c 96 10 f0       	push   $0xf010961c
+f0105ef9:	6a 54                	push   $0x54
+f0105efb:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f0105f00:	e8 3b a1 ff ff       	call   f0100040 <_panic>
+		curenv->env_tf.tf_eip -= 2;
+f0105f05:	e8 31 17 00 00       	call   f010763b <cpunum>
+f0105f0a:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0105f0d:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0105f13:	83 68 30 02          	subl   $0x2,0x30(%eax)
+	sched_yield();
+f0105f17:	e8 d7 f3 ff ff       	call   f01052f3 <sched_yield>
+		string_size += strlen(argv[argc]) + 1;
+f0105f1c:	83 ec 0c             	sub    $0xc,%esp
+f0105f1f:	50                   	push   %eax
+f0105f20:	e8 94 0f 00 00       	call   f0106eb9 <strlen>
+f0105f25:	8d 5c 03 01          	lea    0x1(%ebx,%eax,1),%ebx
+	for (argc = 0; argv[argc] != 0; argc++)
+f0105f29:	83 c7 01             	add    $0x1,%edi
+f0105f2c:	83 c4 10             	add    $0x10,%esp
+f0105f2f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+f0105f32:	8b 04 be             	mov    (%esi,%edi,4),%eax
+f0105f35:	85 c0                	test   %eax,%eax
+f0105f37:	75 e3                	jne    f0105f1c <sys_exec+0x136>
+	Debug("argc is %d, string size is %d\n", argc, string_size);
+f0105f39:	83 ec 08             	sub    $0x8,%esp
+f0105f3c:	53                   	push   %ebx
+f0105f3d:	57                   	push   %edi
+f0105f3e:	68 b4 ab 10 f0       	push   $0xf010abb4
+f0105f43:	68 05 03 00 00       	push   $0x305
+f0105f48:	68 44 ac 10 f0       	push   $0xf010ac44
+f0105f4d:	68 66 a9 10 f0       	push   $0xf010a966
+f0105f52:	e8 39 a3 ff ff       	call   f0100290 <_log>
+	string_store = stack + PGSIZE - string_size;
+f0105f57:	be 00 e0 bf ee       	mov    $0xeebfe000,%esi
+f0105f5c:	29 de                	sub    %ebx,%esi
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+f0105f5e:	89 f2                	mov    %esi,%edx
+f0105f60:	83 e2 fc             	and    $0xfffffffc,%edx
+f0105f63:	8d 04 bd 04 00 00 00 	lea    0x4(,%edi,4),%eax
+f0105f6a:	29 c2                	sub    %eax,%edx
+f0105f6c:	89 d3                	mov    %edx,%ebx
+f0105f6e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	Debug("string_store: %p argv_store %p\n", string_store, argv_store);
+f0105f71:	83 c4 18             	add    $0x18,%esp
+f0105f74:	52                   	push   %edx
+f0105f75:	56                   	push   %esi
+f0105f76:	68 d4 ab 10 f0       	push   $0xf010abd4
+f0105f7b:	68 10 03 00 00       	push   $0x310
+f0105f80:	68 44 ac 10 f0       	push   $0xf010ac44
+f0105f85:	68 66 a9 10 f0       	push   $0xf010a966
+f0105f8a:	e8 01 a3 ff ff       	call   f0100290 <_log>
+	if ((void*) (argv_store - 2) < stack)
+f0105f8f:	8d 43 f8             	lea    -0x8(%ebx),%eax
+f0105f92:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0105f95:	83 c4 20             	add    $0x20,%esp
+f0105f98:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+f0105f9d:	0f 86 26 02 00 00    	jbe    f01061c9 <sys_exec+0x3e3>
+	for (i = 0; i < argc; i++) {
+f0105fa3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105fa8:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0105fab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0105fae:	39 5d d8             	cmp    %ebx,-0x28(%ebp)
+f0105fb1:	7e 47                	jle    f0105ffa <sys_exec+0x214>
+		argv_store[i] = (uintptr_t)string_store;
+f0105fb3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105fb6:	89 34 98             	mov    %esi,(%eax,%ebx,4)
+		strcpy(string_store, argv[i]);
+f0105fb9:	83 ec 08             	sub    $0x8,%esp
+f0105fbc:	ff 34 9f             	push   (%edi,%ebx,4)
+f0105fbf:	56                   	push   %esi
+f0105fc0:	e8 2f 0f 00 00       	call   f0106ef4 <strcpy>
+		Debug("%dth argv %s", i, string_store);
+f0105fc5:	83 c4 08             	add    $0x8,%esp
+f0105fc8:	56                   	push   %esi
+f0105fc9:	53                   	push   %ebx
+f0105fca:	68 87 a9 10 f0       	push   $0xf010a987
+f0105fcf:	68 2b 03 00 00       	push   $0x32b
+f0105fd4:	68 44 ac 10 f0       	push   $0xf010ac44
+f0105fd9:	68 66 a9 10 f0       	push   $0xf010a966
+f0105fde:	e8 ad a2 ff ff       	call   f0100290 <_log>
+		string_store += strlen(argv[i]) + 1;
+f0105fe3:	83 c4 14             	add    $0x14,%esp
+f0105fe6:	ff 34 9f             	push   (%edi,%ebx,4)
+f0105fe9:	e8 cb 0e 00 00       	call   f0106eb9 <strlen>
+f0105fee:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+f0105ff2:	83 c3 01             	add    $0x1,%ebx
+f0105ff5:	83 c4 10             	add    $0x10,%esp
+f0105ff8:	eb b4                	jmp    f0105fae <sys_exec+0x1c8>
+	argv_store[argc] = 0;
+f0105ffa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105ffd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0106000:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	Debug("string_store %p", string_store);
+f0106007:	83 ec 0c             	sub    $0xc,%esp
+f010600a:	56                   	push   %esi
+f010600b:	68 94 a9 10 f0       	push   $0xf010a994
+f0106010:	68 2f 03 00 00       	push   $0x32f
+f0106015:	68 44 ac 10 f0       	push   $0xf010ac44
+f010601a:	68 66 a9 10 f0       	push   $0xf010a966
+f010601f:	e8 6c a2 ff ff       	call   f0100290 <_log>
+	assert(string_store == stack + PGSIZE);
+f0106024:	83 c4 20             	add    $0x20,%esp
+f0106027:	81 fe 00 e0 bf ee    	cmp    $0xeebfe000,%esi
+f010602d:	75 46                	jne    f0106075 <sys_exec+0x28f>
+	argv_store[-1] = (uintptr_t)argv_store;
+f010602f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106032:	89 40 fc             	mov    %eax,-0x4(%eax)
+	argv_store[-2] = argc;
+f0106035:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0106038:	89 48 f8             	mov    %ecx,-0x8(%eax)
+	e->env_tf.tf_esp = (uintptr_t)(&argv_store[-2]);
+f010603b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010603e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0106041:	89 4f 3c             	mov    %ecx,0x3c(%edi)
+	Debug("env esp is %p", e->env_tf.tf_esp);
+f0106044:	83 ec 0c             	sub    $0xc,%esp
+f0106047:	51                   	push   %ecx
+f0106048:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010604d:	68 36 03 00 00       	push   $0x336
+f0106052:	68 44 ac 10 f0       	push   $0xf010ac44
+f0106057:	68 66 a9 10 f0       	push   $0xf010a966
+f010605c:	e8 2f a2 ff ff       	call   f0100290 <_log>
+	pd = e->env_pgdir;
+f0106061:	8b 4f 60             	mov    0x60(%edi),%ecx
+	assert(pd);
+f0106064:	83 c4 20             	add    $0x20,%esp
+f0106067:	85 c9                	test   %ecx,%ecx
+f0106069:	74 23                	je     f010608e <sys_exec+0x2a8>
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+f010606b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106070:	e9 87 00 00 00       	jmp    f01060fc <sys_exec+0x316>
+	assert(string_store == stack + PGSIZE);
+f0106075:	68 f4 ab 10 f0       	push   $0xf010abf4
+f010607a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010607f:	68 30 03 00 00       	push   $0x330
+f0106084:	68 66 a9 10 f0       	push   $0xf010a966
+f0106089:	e8 b2 9f ff ff       	call   f0100040 <_panic>
+	assert(pd);
+f010608e:	68 b2 a9 10 f0       	push   $0xf010a9b2
+f0106093:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0106098:	68 d8 02 00 00       	push   $0x2d8
+f010609d:	68 66 a9 10 f0       	push   $0xf010a966
+f01060a2:	e8 99 9f ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01060a7:	56                   	push   %esi
+f01060a8:	68 24 8e 10 f0       	push   $0xf0108e24
+f01060ad:	68 e1 02 00 00       	push   $0x2e1
+f01060b2:	68 66 a9 10 f0       	push   $0xf010a966
+f01060b7:	e8 84 9f ff ff       	call   f0100040 <_panic>
+				if (PGADDR(pdeno, pteno, 0) == (void*)(USTACKTOP - PGSIZE) ||
+f01060bc:	89 d8                	mov    %ebx,%eax
+f01060be:	09 f8                	or     %edi,%eax
+f01060c0:	3d 00 d0 bf ee       	cmp    $0xeebfd000,%eax
+f01060c5:	74 13                	je     f01060da <sys_exec+0x2f4>
+f01060c7:	3d 00 00 40 00       	cmp    $0x400000,%eax
+f01060cc:	74 0c                	je     f01060da <sys_exec+0x2f4>
+				pte_t pte = pt[pteno];
+f01060ce:	8b 16                	mov    (%esi),%edx
+				if ((pte & (PTE_P | PTE_U)) && !(pte & PTE_SHARE)) {
+f01060d0:	f6 c2 05             	test   $0x5,%dl
+f01060d3:	74 05                	je     f01060da <sys_exec+0x2f4>
+f01060d5:	f6 c6 04             	test   $0x4,%dh
+f01060d8:	74 54                	je     f010612e <sys_exec+0x348>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+f01060da:	83 c6 04             	add    $0x4,%esi
+f01060dd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01060e3:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f01060e9:	75 d1                	jne    f01060bc <sys_exec+0x2d6>
+f01060eb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01060ee:	8b 55 dc             	mov    -0x24(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+f01060f1:	83 c2 01             	add    $0x1,%edx
+f01060f4:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+f01060fa:	74 46                	je     f0106142 <sys_exec+0x35c>
+		pte_t pde = pd[pdeno];
+f01060fc:	89 d7                	mov    %edx,%edi
+f01060fe:	8b 04 91             	mov    (%ecx,%edx,4),%eax
+		if (pde & (PTE_P | PTE_U)) {
+f0106101:	a8 05                	test   $0x5,%al
+f0106103:	74 ec                	je     f01060f1 <sys_exec+0x30b>
+			pt = KADDR(PTE_ADDR(pde));
+f0106105:	89 c6                	mov    %eax,%esi
+f0106107:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f010610d:	c1 e8 0c             	shr    $0xc,%eax
+f0106110:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0106116:	73 8f                	jae    f01060a7 <sys_exec+0x2c1>
+	return (void *)(pa + KERNBASE);
+f0106118:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+f010611e:	c1 e7 16             	shl    $0x16,%edi
+f0106121:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106126:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0106129:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010612c:	eb 8e                	jmp    f01060bc <sys_exec+0x2d6>
+					page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f010612e:	83 ec 08             	sub    $0x8,%esp
+f0106131:	50                   	push   %eax
+f0106132:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106135:	ff 70 60             	push   0x60(%eax)
+f0106138:	e8 60 b8 ff ff       	call   f010199d <page_remove>
+f010613d:	83 c4 10             	add    $0x10,%esp
+f0106140:	eb 98                	jmp    f01060da <sys_exec+0x2f4>
+	e->env_uring = NULL;
+f0106142:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106145:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f010614c:	00 00 00 
+	e->env_uxstacktop = UXSTACKTOP;
+f010614f:	c7 40 68 00 00 c0 ee 	movl   $0xeec00000,0x68(%eax)
+	if (fsenv == 0)
+f0106156:	8b 1d 64 4a a2 f0    	mov    0xf0a24a64,%ebx
+f010615c:	85 db                	test   %ebx,%ebx
+f010615e:	75 28                	jne    f0106188 <sys_exec+0x3a2>
+f0106160:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+f0106165:	8d 88 00 40 02 00    	lea    0x24000(%eax),%ecx
+	for (i = 0; i < NENV; i++)
+f010616b:	39 c1                	cmp    %eax,%ecx
+f010616d:	74 13                	je     f0106182 <sys_exec+0x39c>
+		if (envs[i].env_type == type)
+f010616f:	8d 90 90 00 00 00    	lea    0x90(%eax),%edx
+f0106175:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0106179:	74 04                	je     f010617f <sys_exec+0x399>
+f010617b:	89 d0                	mov    %edx,%eax
+f010617d:	eb ec                	jmp    f010616b <sys_exec+0x385>
+			return envs[i].env_id;
+f010617f:	8b 58 48             	mov    0x48(%eax),%ebx
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+f0106182:	89 1d 64 4a a2 f0    	mov    %ebx,0xf0a24a64
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+f0106188:	6a 07                	push   $0x7
+f010618a:	68 00 00 40 00       	push   $0x400000
+f010618f:	6a 09                	push   $0x9
+f0106191:	ff 35 64 4a a2 f0    	push   0xf0a24a64
+f0106197:	e8 ce f6 ff ff       	call   f010586a <sys_ipc_try_send>
+		} else if (r == -E_IPC_NOT_RECV) {
+f010619c:	83 c4 10             	add    $0x10,%esp
+f010619f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+f01061a2:	74 07                	je     f01061ab <sys_exec+0x3c5>
+	return 0;
+f01061a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01061a9:	eb 56                	jmp    f0106201 <sys_exec+0x41b>
+			panic("FS is not recving");
+f01061ab:	83 ec 04             	sub    $0x4,%esp
+f01061ae:	68 b5 a9 10 f0       	push   $0xf010a9b5
+f01061b3:	68 a7 02 00 00       	push   $0x2a7
+f01061b8:	68 66 a9 10 f0       	push   $0xf010a966
+f01061bd:	e8 7e 9e ff ff       	call   f0100040 <_panic>
+		return -E_INVAL;
+f01061c2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01061c7:	eb 38                	jmp    f0106201 <sys_exec+0x41b>
+		Debug("init stack failed, %e\n", r);
+f01061c9:	83 ec 0c             	sub    $0xc,%esp
+f01061cc:	6a fc                	push   $0xfffffffc
+f01061ce:	68 c7 a9 10 f0       	push   $0xf010a9c7
+f01061d3:	68 62 03 00 00       	push   $0x362
+f01061d8:	68 50 ac 10 f0       	push   $0xf010ac50
+f01061dd:	68 66 a9 10 f0       	push   $0xf010a966
+f01061e2:	e8 a9 a0 ff ff       	call   f0100290 <_log>
+		goto error;
+f01061e7:	83 c4 20             	add    $0x20,%esp
+		return -E_NO_MEM;
+f01061ea:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+	sys_page_unmap(0, UTEMP);
+f01061ef:	83 ec 08             	sub    $0x8,%esp
+f01061f2:	68 00 00 40 00       	push   $0x400000
+f01061f7:	6a 00                	push   $0x0
+f01061f9:	e8 09 f6 ff ff       	call   f0105807 <sys_page_unmap>
+	return r;
+f01061fe:	83 c4 10             	add    $0x10,%esp
+}
+f0106201:	89 d8                	mov    %ebx,%eax
+f0106203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106206:	5b                   	pop    %ebx
+f0106207:	5e                   	pop    %esi
+f0106208:	5f                   	pop    %edi
+f0106209:	5d                   	pop    %ebp
+f010620a:	c3                   	ret
+
+f010620b <syscall>:
+}
+
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f010620b:	55                   	push   %ebp
+f010620c:	89 e5                	mov    %esp,%ebp
+f010620e:	83 ec 08             	sub    $0x8,%esp
+f0106211:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (syscallno >= ARRAY_SIZE(syscalls) || !syscalls[syscallno].sc_fn)
+f0106214:	83 f8 42             	cmp    $0x42,%eax
+f0106217:	77 2b                	ja     f0106244 <syscall+0x39>
+f0106219:	89 c2                	mov    %eax,%edx
+f010621b:	c1 e2 04             	shl    $0x4,%edx
+f010621e:	83 ba 60 ac 10 f0 00 	cmpl   $0x0,-0xfef53a0(%edx)
+f0106225:	74 24                	je     f010624b <syscall+0x40>
+	const struct Syscall *sc = syscall_lookup(syscallno);
+
+	// log("syscall %s", syscallname(syscallno));
+	if (!sc)
+		return -E_INVAL;
+	return sc->sc_fn(a1, a2, a3, a4, a5);
+f0106227:	83 ec 0c             	sub    $0xc,%esp
+f010622a:	ff 75 1c             	push   0x1c(%ebp)
+f010622d:	ff 75 18             	push   0x18(%ebp)
+f0106230:	ff 75 14             	push   0x14(%ebp)
+f0106233:	ff 75 10             	push   0x10(%ebp)
+f0106236:	ff 75 0c             	push   0xc(%ebp)
+f0106239:	ff 92 60 ac 10 f0    	call   *-0xfef53a0(%edx)
+f010623f:	83 c4 20             	add    $0x20,%esp
+}
+f0106242:	c9                   	leave
+f0106243:	c3                   	ret
+		return -E_INVAL;
+f0106244:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106249:	eb f7                	jmp    f0106242 <syscall+0x37>
+f010624b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106250:	eb f0                	jmp    f0106242 <syscall+0x37>
+
+f0106252 <sysenter_wrapper>:
+// Calls that do not touch the trapframe return straight back through
+// sysexit.  The others get a complete trapframe, as if they had come
+// in through int 0x30, and leave through env_run or sched_yield.
+int32_t
+sysenter_wrapper(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t eip, uint32_t esp)
+{
+f0106252:	55                   	push   %ebp
+f0106253:	89 e5                	mov    %esp,%ebp
+f0106255:	57                   	push   %edi
+f0106256:	56                   	push   %esi
+f0106257:	53                   	push   %ebx
+f0106258:	83 ec 1c             	sub    $0x1c,%esp
+f010625b:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f010625e:	9c                   	pushf
+f010625f:	58                   	pop    %eax
+f0106260:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct Trapframe *tf;
+	uint32_t eflags = read_eflags();
+	uint32_t a5 = 0;
+	int32_t r;
+
+	asm volatile("cld" ::: "cc");
+f0106263:	fc                   	cld
+	thiscpu->cpu_in_user = 0;
+f0106264:	e8 d2 13 00 00       	call   f010763b <cpunum>
+f0106269:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010626c:	c6 80 94 70 a4 f0 00 	movb   $0x0,-0xf5b8f6c(%eax)
+	spin_lock(&kernel_lock);
+f0106273:	83 ec 0c             	sub    $0xc,%esp
+f0106276:	68 c0 63 11 f0       	push   $0xf01163c0
+f010627b:	e8 2b 16 00 00       	call   f01078ab <spin_lock>
+	lock_kernel();
+	tlb_sync();
+f0106280:	e8 bd b5 ff ff       	call   f0101842 <tlb_sync>
+	assert(curenv);
+f0106285:	e8 b1 13 00 00       	call   f010763b <cpunum>
+f010628a:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010628d:	83 c4 10             	add    $0x10,%esp
+f0106290:	83 b8 28 70 a4 f0 00 	cmpl   $0x0,-0xf5b8fd8(%eax)
+f0106297:	0f 84 b3 00 00 00    	je     f0106350 <sysenter_wrapper+0xfe>
+	log("sysenter %s, eip: %p, esp: %p", syscallname(syscallno), eip, esp);
+
+	// Calls queued earlier go first.
+	if (curenv->env_uring)
+f010629d:	e8 99 13 00 00       	call   f010763b <cpunum>
+f01062a2:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01062a5:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01062ab:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+f01062b2:	74 19                	je     f01062cd <sysenter_wrapper+0x7b>
+		uring_drain(curenv);
+f01062b4:	e8 82 13 00 00       	call   f010763b <cpunum>
+f01062b9:	83 ec 0c             	sub    $0xc,%esp
+f01062bc:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01062bf:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f01062c5:	e8 95 27 00 00       	call   f0108a5f <uring_drain>
+f01062ca:	83 c4 10             	add    $0x10,%esp
+	if (syscallno >= ARRAY_SIZE(syscalls) || !syscalls[syscallno].sc_fn)
+f01062cd:	83 fe 42             	cmp    $0x42,%esi
+f01062d0:	0f 87 c7 00 00 00    	ja     f010639d <sysenter_wrapper+0x14b>
+f01062d6:	89 f0                	mov    %esi,%eax
+f01062d8:	c1 e0 04             	shl    $0x4,%eax
+f01062db:	83 b8 60 ac 10 f0 00 	cmpl   $0x0,-0xfef53a0(%eax)
+f01062e2:	0f 84 bf 00 00 00    	je     f01063a7 <sysenter_wrapper+0x155>
+
+	sc = syscall_lookup(syscallno);
+	if (sc && sc->sc_nargs > 4) {
+f01062e8:	89 f0                	mov    %esi,%eax
+f01062ea:	c1 e0 04             	shl    $0x4,%eax
+	uint32_t a5 = 0;
+f01062ed:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (sc && sc->sc_nargs > 4) {
+f01062f2:	83 b8 68 ac 10 f0 04 	cmpl   $0x4,-0xfef5398(%eax)
+f01062f9:	7f 6e                	jg     f0106369 <sysenter_wrapper+0x117>
+			goto out;
+		}
+		a5 = *(uint32_t *) (esp + 8);
+	}
+
+	if (!sc || !(sc->sc_flags & SC_TF)) {
+f01062fb:	89 f0                	mov    %esi,%eax
+f01062fd:	c1 e0 04             	shl    $0x4,%eax
+f0106300:	f6 80 6c ac 10 f0 01 	testb  $0x1,-0xfef5394(%eax)
+f0106307:	0f 85 a4 00 00 00    	jne    f01063b1 <sysenter_wrapper+0x15f>
+		r = syscall(syscallno, a1, a2, a3, a4, a5);
+f010630d:	83 ec 08             	sub    $0x8,%esp
+f0106310:	57                   	push   %edi
+f0106311:	ff 75 18             	push   0x18(%ebp)
+f0106314:	ff 75 14             	push   0x14(%ebp)
+f0106317:	ff 75 10             	push   0x10(%ebp)
+f010631a:	ff 75 0c             	push   0xc(%ebp)
+f010631d:	56                   	push   %esi
+f010631e:	e8 e8 fe ff ff       	call   f010620b <syscall>
+f0106323:	89 c3                	mov    %eax,%ebx
+		goto out;
+f0106325:	83 c4 20             	add    $0x20,%esp
+	if (curenv->env_status == ENV_RUNNING)
+		env_run(curenv);
+	sched_yield();
+
+out:
+	thiscpu->cpu_in_user = 1;
+f0106328:	e8 0e 13 00 00       	call   f010763b <cpunum>
+f010632d:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0106330:	c6 80 94 70 a4 f0 01 	movb   $0x1,-0xf5b8f6c(%eax)
+	spin_unlock(&kernel_lock);
+f0106337:	83 ec 0c             	sub    $0xc,%esp
+f010633a:	68 c0 63 11 f0       	push   $0xf01163c0
+f010633f:	e8 01 16 00 00       	call   f0107945 <spin_unlock>
+	asm volatile("pause");
+f0106344:	f3 90                	pause
+	unlock_kernel();
+	return r;
+}
+f0106346:	89 d8                	mov    %ebx,%eax
+f0106348:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010634b:	5b                   	pop    %ebx
+f010634c:	5e                   	pop    %esi
+f010634d:	5f                   	pop    %edi
+f010634e:	5d                   	pop    %ebp
+f010634f:	c3                   	ret
+	assert(curenv);
+f0106350:	68 29 ba 10 f0       	push   $0xf010ba29
+f0106355:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f010635a:	68 24 04 00 00       	push   $0x424
+f010635f:	68 66 a9 10 f0       	push   $0xf010a966
+f0106364:	e8 d7 9c ff ff       	call   f0100040 <_panic>
+		if (user_mem_check(curenv, (void *) esp + 8, 4, PTE_U) < 0) {
+f0106369:	8b 45 20             	mov    0x20(%ebp),%eax
+f010636c:	8d 58 08             	lea    0x8(%eax),%ebx
+f010636f:	e8 c7 12 00 00       	call   f010763b <cpunum>
+f0106374:	6a 04                	push   $0x4
+f0106376:	6a 04                	push   $0x4
+f0106378:	53                   	push   %ebx
+f0106379:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010637c:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f0106382:	e8 cb d3 ff ff       	call   f0103752 <user_mem_check>
+f0106387:	83 c4 10             	add    $0x10,%esp
+f010638a:	85 c0                	test   %eax,%eax
+f010638c:	0f 88 bf 00 00 00    	js     f0106451 <sysenter_wrapper+0x1ff>
+		a5 = *(uint32_t *) (esp + 8);
+f0106392:	8b 45 20             	mov    0x20(%ebp),%eax
+f0106395:	8b 78 08             	mov    0x8(%eax),%edi
+	if (!sc || !(sc->sc_flags & SC_TF)) {
+f0106398:	e9 5e ff ff ff       	jmp    f01062fb <sysenter_wrapper+0xa9>
+	uint32_t a5 = 0;
+f010639d:	bf 00 00 00 00       	mov    $0x0,%edi
+f01063a2:	e9 66 ff ff ff       	jmp    f010630d <sysenter_wrapper+0xbb>
+f01063a7:	bf 00 00 00 00       	mov    $0x0,%edi
+f01063ac:	e9 5c ff ff ff       	jmp    f010630d <sysenter_wrapper+0xbb>
+	tf = &curenv->env_tf;
+f01063b1:	e8 85 12 00 00       	call   f010763b <cpunum>
+f01063b6:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01063b9:	8b 98 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%ebx
+	tf->tf_regs.reg_eax = syscallno;
+f01063bf:	89 73 1c             	mov    %esi,0x1c(%ebx)
+	tf->tf_regs.reg_edx = a1;
+f01063c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01063c5:	89 43 14             	mov    %eax,0x14(%ebx)
+	tf->tf_regs.reg_ecx = a2;
+f01063c8:	8b 45 10             	mov    0x10(%ebp),%eax
+f01063cb:	89 43 18             	mov    %eax,0x18(%ebx)
+	tf->tf_regs.reg_ebx = a3;
+f01063ce:	8b 45 14             	mov    0x14(%ebp),%eax
+f01063d1:	89 43 10             	mov    %eax,0x10(%ebx)
+	tf->tf_regs.reg_edi = a4;
+f01063d4:	8b 45 18             	mov    0x18(%ebp),%eax
+f01063d7:	89 03                	mov    %eax,(%ebx)
+	tf->tf_regs.reg_esi = eip;
+f01063d9:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f01063dc:	89 43 04             	mov    %eax,0x4(%ebx)
+	tf->tf_regs.reg_ebp = esp;
+f01063df:	8b 45 20             	mov    0x20(%ebp),%eax
+f01063e2:	89 43 08             	mov    %eax,0x8(%ebx)
+	tf->tf_cs = GD_UT | 3;
+f01063e5:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	tf->tf_eip = eip;
+f01063eb:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f01063ee:	89 43 30             	mov    %eax,0x30(%ebx)
+	tf->tf_ss = GD_UD | 3;
+f01063f1:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	tf->tf_esp = esp;
+f01063f7:	8b 45 20             	mov    0x20(%ebp),%eax
+f01063fa:	89 43 3c             	mov    %eax,0x3c(%ebx)
+	tf->tf_eflags = eflags | FL_IF;
+f01063fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106400:	80 cc 02             	or     $0x2,%ah
+f0106403:	89 43 38             	mov    %eax,0x38(%ebx)
+	tf->tf_regs.reg_eax = syscall(syscallno, a1, a2, a3, a4, a5);
+f0106406:	83 ec 08             	sub    $0x8,%esp
+f0106409:	57                   	push   %edi
+f010640a:	ff 75 18             	push   0x18(%ebp)
+f010640d:	ff 75 14             	push   0x14(%ebp)
+f0106410:	ff 75 10             	push   0x10(%ebp)
+f0106413:	ff 75 0c             	push   0xc(%ebp)
+f0106416:	56                   	push   %esi
+f0106417:	e8 ef fd ff ff       	call   f010620b <syscall>
+f010641c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	if (curenv->env_status == ENV_RUNNING)
+f010641f:	83 c4 20             	add    $0x20,%esp
+f0106422:	e8 14 12 00 00       	call   f010763b <cpunum>
+f0106427:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010642a:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0106430:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0106434:	74 05                	je     f010643b <sysenter_wrapper+0x1e9>
+	sched_yield();
+f0106436:	e8 b8 ee ff ff       	call   f01052f3 <sched_yield>
+		env_run(curenv);
+f010643b:	e8 fb 11 00 00       	call   f010763b <cpunum>
+f0106440:	83 ec 0c             	sub    $0xc,%esp
+f0106443:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0106446:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f010644c:	e8 5e dc ff ff       	call   f01040af <env_run>
+			r = -E_FAULT;
+f0106451:	bb fa ff ff ff       	mov    $0xfffffffa,%ebx
+f0106456:	e9 cd fe ff ff       	jmp    f0106328 <sysenter_wrapper+0xd6>
+
+f010645b <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f010645b:	55                   	push   %ebp
+f010645c:	89 e5                	mov    %esp,%ebp
+f010645e:	57                   	push   %edi
+f010645f:	56                   	push   %esi
+f0106460:	53                   	push   %ebx
+f0106461:	83 ec 14             	sub    $0x14,%esp
+f0106464:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0106467:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010646a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f010646d:	8b 1a                	mov    (%edx),%ebx
+f010646f:	8b 09                	mov    (%ecx),%ecx
+f0106471:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0106478:	eb 4f                	jmp    f01064c9 <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f010647a:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f010647d:	39 c3                	cmp    %eax,%ebx
+f010647f:	0f 8f cc 00 00 00    	jg     f0106551 <stab_binsearch+0xf6>
+f0106485:	0f b6 0a             	movzbl (%edx),%ecx
+f0106488:	83 ea 0c             	sub    $0xc,%edx
+f010648b:	39 f1                	cmp    %esi,%ecx
+f010648d:	75 eb                	jne    f010647a <stab_binsearch+0x1f>
+f010648f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106492:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0106495:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106498:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f010649b:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f010649f:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f01064a2:	72 16                	jb     f01064ba <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f01064a4:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f01064a7:	73 48                	jae    f01064f1 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f01064a9:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f01064ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01064af:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f01064b1:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01064b8:	eb 0f                	jmp    f01064c9 <stab_binsearch+0x6e>
+			*region_left = m;
+f01064ba:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01064bd:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f01064bf:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f01064c2:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f01064c9:	39 cb                	cmp    %ecx,%ebx
+f01064cb:	7f 38                	jg     f0106505 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f01064cd:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f01064d0:	89 c2                	mov    %eax,%edx
+f01064d2:	c1 ea 1f             	shr    $0x1f,%edx
+f01064d5:	01 d0                	add    %edx,%eax
+f01064d7:	89 c7                	mov    %eax,%edi
+f01064d9:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f01064db:	83 e0 fe             	and    $0xfffffffe,%eax
+f01064de:	01 f8                	add    %edi,%eax
+f01064e0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f01064e3:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f01064e7:	89 f8                	mov    %edi,%eax
+f01064e9:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f01064ec:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f01064ef:	eb 8c                	jmp    f010647d <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f01064f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01064f4:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f01064f6:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f01064fa:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f01064fc:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106503:	eb c4                	jmp    f01064c9 <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0106505:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106508:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f010650c:	75 15                	jne    f0106523 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f010650e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106511:	8b 00                	mov    (%eax),%eax
+f0106513:	83 e8 01             	sub    $0x1,%eax
+f0106516:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0106519:	89 07                	mov    %eax,(%edi)
+		     l--) {
+			/* do nothing */
+		}
+		*region_left = l;
+	}
+}
+f010651b:	83 c4 14             	add    $0x14,%esp
+f010651e:	5b                   	pop    %ebx
+f010651f:	5e                   	pop    %esi
+f0106520:	5f                   	pop    %edi
+f0106521:	5d                   	pop    %ebp
+f0106522:	c3                   	ret
+		for (l = *region_right;
+f0106523:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106526:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0106528:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010652b:	8b 0f                	mov    (%edi),%ecx
+f010652d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106530:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0106533:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0106537:	39 c1                	cmp    %eax,%ecx
+f0106539:	7d 0f                	jge    f010654a <stab_binsearch+0xef>
+f010653b:	0f b6 1a             	movzbl (%edx),%ebx
+f010653e:	83 ea 0c             	sub    $0xc,%edx
+f0106541:	39 f3                	cmp    %esi,%ebx
+f0106543:	74 05                	je     f010654a <stab_binsearch+0xef>
+		     l--) {
+f0106545:	83 e8 01             	sub    $0x1,%eax
+f0106548:	eb ed                	jmp    f0106537 <stab_binsearch+0xdc>
+		*region_left = l;
+f010654a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010654d:	89 07                	mov    %eax,(%edi)
+}
+f010654f:	eb ca                	jmp    f010651b <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0106551:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106554:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106557:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f010655a:	e9 6a ff ff ff       	jmp    f01064c9 <stab_binsearch+0x6e>
+
+f010655f <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f010655f:	55                   	push   %ebp
+f0106560:	89 e5                	mov    %esp,%ebp
+f0106562:	57                   	push   %edi
+f0106563:	56                   	push   %esi
+f0106564:	53                   	push   %ebx
+f0106565:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0106568:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010656b:	c7 00 90 b0 10 f0    	movl   $0xf010b090,(%eax)
+	info->eip_line = 0;
+f0106571:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f0106578:	c7 40 08 90 b0 10 f0 	movl   $0xf010b090,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f010657f:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0106586:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106589:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f010658c:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0106593:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0106599:	0f 86 12 01 00 00    	jbe    f01066b1 <debuginfo_eip+0x152>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f010659f:	c7 45 c4 3e ba 10 f0 	movl   $0xf010ba3e,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f01065a6:	c7 45 c0 3e ba 10 f0 	movl   $0xf010ba3e,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f01065ad:	be 3d ba 10 f0       	mov    $0xf010ba3d,%esi
+		stabs = __STAB_BEGIN__;
+f01065b2:	bf 3d ba 10 f0       	mov    $0xf010ba3d,%edi
+			return -1;
+		}
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f01065b7:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f01065ba:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+f01065bd:	0f 83 4a 02 00 00    	jae    f010680d <debuginfo_eip+0x2ae>
+f01065c3:	80 7a ff 00          	cmpb   $0x0,-0x1(%edx)
+f01065c7:	0f 85 47 02 00 00    	jne    f0106814 <debuginfo_eip+0x2b5>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f01065cd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f01065d4:	29 fe                	sub    %edi,%esi
+f01065d6:	c1 fe 02             	sar    $0x2,%esi
+f01065d9:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f01065df:	83 e8 01             	sub    $0x1,%eax
+f01065e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f01065e5:	83 ec 08             	sub    $0x8,%esp
+f01065e8:	ff 75 08             	push   0x8(%ebp)
+f01065eb:	6a 64                	push   $0x64
+f01065ed:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f01065f0:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+f01065f3:	89 da                	mov    %ebx,%edx
+f01065f5:	89 f8                	mov    %edi,%eax
+f01065f7:	e8 5f fe ff ff       	call   f010645b <stab_binsearch>
+	if (lfile == 0)
+f01065fc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01065ff:	83 c4 10             	add    $0x10,%esp
+f0106602:	85 f6                	test   %esi,%esi
+f0106604:	0f 84 11 02 00 00    	je     f010681b <debuginfo_eip+0x2bc>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile + 1;
+f010660a:	8d 46 01             	lea    0x1(%esi),%eax
+f010660d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	rfun = rfile;
+f0106610:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0106613:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0106616:	83 ec 08             	sub    $0x8,%esp
+f0106619:	ff 75 08             	push   0x8(%ebp)
+f010661c:	6a 24                	push   $0x24
+f010661e:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+f0106621:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0106624:	89 c2                	mov    %eax,%edx
+f0106626:	89 f8                	mov    %edi,%eax
+f0106628:	e8 2e fe ff ff       	call   f010645b <stab_binsearch>
+
+	if (lfun <= rfun) {
+f010662d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0106630:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0106633:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0106636:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+f0106639:	83 c4 10             	add    $0x10,%esp
+f010663c:	39 c8                	cmp    %ecx,%eax
+f010663e:	0f 8f 39 01 00 00    	jg     f010677d <debuginfo_eip+0x21e>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr) {
+f0106644:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0106647:	8d 1c 87             	lea    (%edi,%eax,4),%ebx
+f010664a:	8b 03                	mov    (%ebx),%eax
+f010664c:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f010664f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0106652:	29 ca                	sub    %ecx,%edx
+f0106654:	39 d0                	cmp    %edx,%eax
+f0106656:	0f 82 fd 00 00 00    	jb     f0106759 <debuginfo_eip+0x1fa>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+			// Search within the function definition for the line number.
+			// Ignore stuff after the colon.
+			info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+		}
+		info->eip_fn_addr = stabs[lfun].n_value;
+f010665c:	8b 43 08             	mov    0x8(%ebx),%eax
+		addr -= info->eip_fn_addr;
+f010665f:	29 45 08             	sub    %eax,0x8(%ebp)
+		lline = lfun;
+		rline = rfun;
+f0106662:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0106665:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0106668:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010666b:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f010666e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0106671:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+	// If found, set info->eip_line to the right line number.
+	// If not found, return -1.
+	// An N_SLINE symbol represents the start of a source line.
+	// The desc field contains the line number and 
+	// the value contains the code address for the start of that source line.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0106674:	83 ec 08             	sub    $0x8,%esp
+f0106677:	ff 75 08             	push   0x8(%ebp)
+f010667a:	6a 44                	push   $0x44
+f010667c:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f010667f:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0106682:	89 f8                	mov    %edi,%eax
+f0106684:	e8 d2 fd ff ff       	call   f010645b <stab_binsearch>
+	if (lline > rline) {
+f0106689:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010668c:	83 c4 10             	add    $0x10,%esp
+f010668f:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0106692:	0f 8f 8a 01 00 00    	jg     f0106822 <debuginfo_eip+0x2c3>
+		return -1;
+	}
+	info->eip_line = stabs[lline].n_desc;
+f0106698:	89 c2                	mov    %eax,%edx
+f010669a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010669d:	0f b7 4c 87 06       	movzwl 0x6(%edi,%eax,4),%ecx
+f01066a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01066a5:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f01066a8:	8d 44 87 04          	lea    0x4(%edi,%eax,4),%eax
+f01066ac:	e9 dc 00 00 00       	jmp    f010678d <debuginfo_eip+0x22e>
+		if (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_U) != 0) {
+f01066b1:	e8 85 0f 00 00       	call   f010763b <cpunum>
+f01066b6:	6a 04                	push   $0x4
+f01066b8:	6a 10                	push   $0x10
+f01066ba:	68 00 00 20 00       	push   $0x200000
+f01066bf:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01066c2:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f01066c8:	e8 85 d0 ff ff       	call   f0103752 <user_mem_check>
+f01066cd:	83 c4 10             	add    $0x10,%esp
+f01066d0:	85 c0                	test   %eax,%eax
+f01066d2:	0f 85 27 01 00 00    	jne    f01067ff <debuginfo_eip+0x2a0>
+		stabs = usd->stabs;
+f01066d8:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f01066de:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f01066e4:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f01066ea:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f01066ed:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f01066f3:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		if (user_mem_check(curenv, stabs, stab_end - stabs, PTE_U) != PTE_U) {
+f01066f6:	e8 40 0f 00 00       	call   f010763b <cpunum>
+f01066fb:	89 c2                	mov    %eax,%edx
+f01066fd:	6a 04                	push   $0x4
+f01066ff:	89 f0                	mov    %esi,%eax
+f0106701:	29 f8                	sub    %edi,%eax
+f0106703:	c1 f8 02             	sar    $0x2,%eax
+f0106706:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010670c:	50                   	push   %eax
+f010670d:	57                   	push   %edi
+f010670e:	6b d2 7c             	imul   $0x7c,%edx,%edx
+f0106711:	ff b2 28 70 a4 f0    	push   -0xf5b8fd8(%edx)
+f0106717:	e8 36 d0 ff ff       	call   f0103752 <user_mem_check>
+f010671c:	83 c4 10             	add    $0x10,%esp
+f010671f:	83 f8 04             	cmp    $0x4,%eax
+f0106722:	0f 85 de 00 00 00    	jne    f0106806 <debuginfo_eip+0x2a7>
+		if (user_mem_check(curenv, stabstr, stabstr_end - stabstr, PTE_U) != 0) {
+f0106728:	e8 0e 0f 00 00       	call   f010763b <cpunum>
+f010672d:	6a 04                	push   $0x4
+f010672f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0106732:	29 da                	sub    %ebx,%edx
+f0106734:	52                   	push   %edx
+f0106735:	53                   	push   %ebx
+f0106736:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0106739:	ff b0 28 70 a4 f0    	push   -0xf5b8fd8(%eax)
+f010673f:	e8 0e d0 ff ff       	call   f0103752 <user_mem_check>
+f0106744:	83 c4 10             	add    $0x10,%esp
+f0106747:	85 c0                	test   %eax,%eax
+f0106749:	0f 84 68 fe ff ff    	je     f01065b7 <debuginfo_eip+0x58>
+			return -1;
+f010674f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106754:	e9 d5 00 00 00       	jmp    f010682e <debuginfo_eip+0x2cf>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0106759:	01 c8                	add    %ecx,%eax
+f010675b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010675e:	89 42 08             	mov    %eax,0x8(%edx)
+			info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0106761:	83 ec 08             	sub    $0x8,%esp
+f0106764:	6a 3a                	push   $0x3a
+f0106766:	50                   	push   %eax
+f0106767:	e8 bd 08 00 00       	call   f0107029 <strfind>
+f010676c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010676f:	2b 42 08             	sub    0x8(%edx),%eax
+f0106772:	89 42 0c             	mov    %eax,0xc(%edx)
+f0106775:	83 c4 10             	add    $0x10,%esp
+f0106778:	e9 df fe ff ff       	jmp    f010665c <debuginfo_eip+0xfd>
+f010677d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106780:	89 f2                	mov    %esi,%edx
+f0106782:	e9 e1 fe ff ff       	jmp    f0106668 <debuginfo_eip+0x109>
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0106787:	83 ea 01             	sub    $0x1,%edx
+f010678a:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f010678d:	39 d6                	cmp    %edx,%esi
+f010678f:	7f 31                	jg     f01067c2 <debuginfo_eip+0x263>
+	       && stabs[lline].n_type != N_SOL
+f0106791:	0f b6 08             	movzbl (%eax),%ecx
+f0106794:	80 f9 84             	cmp    $0x84,%cl
+f0106797:	74 0b                	je     f01067a4 <debuginfo_eip+0x245>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106799:	80 f9 64             	cmp    $0x64,%cl
+f010679c:	75 e9                	jne    f0106787 <debuginfo_eip+0x228>
+f010679e:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f01067a2:	74 e3                	je     f0106787 <debuginfo_eip+0x228>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f01067a4:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f01067a7:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f01067aa:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01067ad:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f01067b0:	29 f0                	sub    %esi,%eax
+f01067b2:	39 c2                	cmp    %eax,%edx
+f01067b4:	73 0c                	jae    f01067c2 <debuginfo_eip+0x263>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f01067b6:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f01067b9:	01 d0                	add    %edx,%eax
+f01067bb:	89 c2                	mov    %eax,%edx
+f01067bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01067c0:	89 10                	mov    %edx,(%eax)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f01067c2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f01067c7:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f01067ca:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f01067cd:	39 f3                	cmp    %esi,%ebx
+f01067cf:	7d 5d                	jge    f010682e <debuginfo_eip+0x2cf>
+		for (lline = lfun + 1;
+f01067d1:	89 d8                	mov    %ebx,%eax
+f01067d3:	83 c0 01             	add    $0x1,%eax
+f01067d6:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01067d9:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f01067dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01067e0:	eb 04                	jmp    f01067e6 <debuginfo_eip+0x287>
+			info->eip_fn_narg++;
+f01067e2:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f01067e6:	39 c6                	cmp    %eax,%esi
+f01067e8:	7e 3f                	jle    f0106829 <debuginfo_eip+0x2ca>
+f01067ea:	0f b6 0a             	movzbl (%edx),%ecx
+f01067ed:	83 c0 01             	add    $0x1,%eax
+f01067f0:	83 c2 0c             	add    $0xc,%edx
+f01067f3:	80 f9 a0             	cmp    $0xa0,%cl
+f01067f6:	74 ea                	je     f01067e2 <debuginfo_eip+0x283>
+	return 0;
+f01067f8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01067fd:	eb 2f                	jmp    f010682e <debuginfo_eip+0x2cf>
+			return -1;
+f01067ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106804:	eb 28                	jmp    f010682e <debuginfo_eip+0x2cf>
+			return -1;
+f0106806:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010680b:	eb 21                	jmp    f010682e <debuginfo_eip+0x2cf>
+		return -1;
+f010680d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106812:	eb 1a                	jmp    f010682e <debuginfo_eip+0x2cf>
+f0106814:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106819:	eb 13                	jmp    f010682e <debuginfo_eip+0x2cf>
+		return -1;
+f010681b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106820:	eb 0c                	jmp    f010682e <debuginfo_eip+0x2cf>
+		return -1;
+f0106822:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106827:	eb 05                	jmp    f010682e <debuginfo_eip+0x2cf>
+	return 0;
+f0106829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010682e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106831:	5b                   	pop    %ebx
+f0106832:	5e                   	pop    %esi
+f0106833:	5f                   	pop    %edi
+f0106834:	5d                   	pop    %ebp
+f0106835:	c3                   	ret
+
+f0106836 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0106836:	55                   	push   %ebp
+f0106837:	89 e5                	mov    %esp,%ebp
+f0106839:	57                   	push   %edi
+f010683a:	56                   	push   %esi
+f010683b:	53                   	push   %ebx
+f010683c:	83 ec 1c             	sub    $0x1c,%esp
+f010683f:	89 c7                	mov    %eax,%edi
+f0106841:	89 d6                	mov    %edx,%esi
+f0106843:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106846:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106849:	89 d1                	mov    %edx,%ecx
+f010684b:	89 c2                	mov    %eax,%edx
+f010684d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106850:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106853:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106856:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0106859:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010685c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0106863:	39 c2                	cmp    %eax,%edx
+f0106865:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0106868:	72 3e                	jb     f01068a8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f010686a:	83 ec 0c             	sub    $0xc,%esp
+f010686d:	ff 75 18             	push   0x18(%ebp)
+f0106870:	83 eb 01             	sub    $0x1,%ebx
+f0106873:	53                   	push   %ebx
+f0106874:	50                   	push   %eax
+f0106875:	83 ec 08             	sub    $0x8,%esp
+f0106878:	ff 75 e4             	push   -0x1c(%ebp)
+f010687b:	ff 75 e0             	push   -0x20(%ebp)
+f010687e:	ff 75 dc             	push   -0x24(%ebp)
+f0106881:	ff 75 d8             	push   -0x28(%ebp)
+f0106884:	e8 eb 23 00 00       	call   f0108c74 <__udivdi3>
+f0106889:	83 c4 18             	add    $0x18,%esp
+f010688c:	52                   	push   %edx
+f010688d:	50                   	push   %eax
+f010688e:	89 f2                	mov    %esi,%edx
+f0106890:	89 f8                	mov    %edi,%eax
+f0106892:	e8 9f ff ff ff       	call   f0106836 <printnum>
+f0106897:	83 c4 20             	add    $0x20,%esp
+f010689a:	eb 13                	jmp    f01068af <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f010689c:	83 ec 08             	sub    $0x8,%esp
+f010689f:	56                   	push   %esi
+f01068a0:	ff 75 18             	push   0x18(%ebp)
+f01068a3:	ff d7                	call   *%edi
+f01068a5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f01068a8:	83 eb 01             	sub    $0x1,%ebx
+f01068ab:	85 db                	test   %ebx,%ebx
+f01068ad:	7f ed                	jg     f010689c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f01068af:	83 ec 08             	sub    $0x8,%esp
+f01068b2:	56                   	push   %esi
+f01068b3:	83 ec 04             	sub    $0x4,%esp
+f01068b6:	ff 75 e4             	push   -0x1c(%ebp)
+f01068b9:	ff 75 e0             	push   -0x20(%ebp)
+f01068bc:	ff 75 dc             	push   -0x24(%ebp)
+f01068bf:	ff 75 d8             	push   -0x28(%ebp)
+f01068c2:	e8 ce 23 00 00       	call   f0108c95 <__umoddi3>
+f01068c7:	83 c4 14             	add    $0x14,%esp
+f01068ca:	0f be 80 9a b0 10 f0 	movsbl -0xfef4f66(%eax),%eax
+f01068d1:	50                   	push   %eax
+f01068d2:	ff d7                	call   *%edi
+}
+f01068d4:	83 c4 10             	add    $0x10,%esp
+f01068d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01068da:	5b                   	pop    %ebx
+f01068db:	5e                   	pop    %esi
+f01068dc:	5f                   	pop    %edi
+f01068dd:	5d                   	pop    %ebp
+f01068de:	c3                   	ret
+
+f01068df <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f01068df:	55                   	push   %ebp
+f01068e0:	89 e5                	mov    %esp,%ebp
+f01068e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f01068e5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f01068e9:	8b 10                	mov    (%eax),%edx
+f01068eb:	3b 50 04             	cmp    0x4(%eax),%edx
+f01068ee:	73 0a                	jae    f01068fa <sprintputch+0x1b>
+		*b->buf++ = ch;
+f01068f0:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01068f3:	89 08                	mov    %ecx,(%eax)
+f01068f5:	8b 45 08             	mov    0x8(%ebp),%eax
+f01068f8:	88 02                	mov    %al,(%edx)
+}
+f01068fa:	5d                   	pop    %ebp
+f01068fb:	c3                   	ret
+
+f01068fc <printfmt>:
+{
+f01068fc:	55                   	push   %ebp
+f01068fd:	89 e5                	mov    %esp,%ebp
+f01068ff:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0106902:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f0106905:	50                   	push   %eax
+f0106906:	ff 75 10             	push   0x10(%ebp)
+f0106909:	ff 75 0c             	push   0xc(%ebp)
+f010690c:	ff 75 08             	push   0x8(%ebp)
+f010690f:	e8 05 00 00 00       	call   f0106919 <vprintfmt>
+}
+f0106914:	83 c4 10             	add    $0x10,%esp
+f0106917:	c9                   	leave
+f0106918:	c3                   	ret
+
+f0106919 <vprintfmt>:
+{
+f0106919:	55                   	push   %ebp
+f010691a:	89 e5                	mov    %esp,%ebp
+f010691c:	57                   	push   %edi
+f010691d:	56                   	push   %esi
+f010691e:	53                   	push   %ebx
+f010691f:	83 ec 2c             	sub    $0x2c,%esp
+f0106922:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106925:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106928:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010692b:	eb 0a                	jmp    f0106937 <vprintfmt+0x1e>
+			putch(ch, putdat);
+f010692d:	83 ec 08             	sub    $0x8,%esp
+f0106930:	53                   	push   %ebx
+f0106931:	50                   	push   %eax
+f0106932:	ff d6                	call   *%esi
+f0106934:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+f0106937:	83 c7 01             	add    $0x1,%edi
+f010693a:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+f010693e:	83 f8 25             	cmp    $0x25,%eax
+f0106941:	74 0c                	je     f010694f <vprintfmt+0x36>
+			if (ch == '\0')
+f0106943:	85 c0                	test   %eax,%eax
+f0106945:	75 e6                	jne    f010692d <vprintfmt+0x14>
+}
+f0106947:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010694a:	5b                   	pop    %ebx
+f010694b:	5e                   	pop    %esi
+f010694c:	5f                   	pop    %edi
+f010694d:	5d                   	pop    %ebp
+f010694e:	c3                   	ret
+		padc = ' ';
+f010694f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f0106953:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f010695a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f0106961:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f0106968:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+f010696d:	8d 47 01             	lea    0x1(%edi),%eax
+f0106970:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106973:	0f b6 17             	movzbl (%edi),%edx
+f0106976:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0106979:	3c 55                	cmp    $0x55,%al
+f010697b:	0f 87 c5 03 00 00    	ja     f0106d46 <vprintfmt+0x42d>
+f0106981:	0f b6 c0             	movzbl %al,%eax
+f0106984:	ff 24 85 20 b2 10 f0 	jmp    *-0xfef4de0(,%eax,4)
+f010698b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+f010698e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106991:	eb da                	jmp    f010696d <vprintfmt+0x54>
+f0106993:	0f be d2             	movsbl %dl,%edx
+f0106996:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f0106999:	b8 00 00 00 00       	mov    $0x0,%eax
+f010699e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f01069a1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01069a4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f01069a8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f01069ab:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f01069ae:	83 f9 09             	cmp    $0x9,%ecx
+f01069b1:	77 55                	ja     f0106a08 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+f01069b3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f01069b6:	eb e9                	jmp    f01069a1 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+f01069b8:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069bb:	8b 00                	mov    (%eax),%eax
+f01069bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01069c0:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069c3:	8d 40 04             	lea    0x4(%eax),%eax
+f01069c6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+f01069c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f01069cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f01069d0:	79 9b                	jns    f010696d <vprintfmt+0x54>
+				width = precision, precision = -1;
+f01069d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01069d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01069d8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f01069df:	eb 8c                	jmp    f010696d <vprintfmt+0x54>
+			if (width < 0)
+f01069e1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01069e4:	85 d2                	test   %edx,%edx
+f01069e6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01069eb:	0f 49 c2             	cmovns %edx,%eax
+f01069ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+f01069f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f01069f4:	e9 74 ff ff ff       	jmp    f010696d <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+f01069f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f01069fc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f0106a03:	e9 65 ff ff ff       	jmp    f010696d <vprintfmt+0x54>
+f0106a08:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0106a0b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106a0e:	eb bc                	jmp    f01069cc <vprintfmt+0xb3>
+			lflag++;
+f0106a10:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+f0106a13:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0106a16:	e9 52 ff ff ff       	jmp    f010696d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f0106a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a1e:	8d 78 04             	lea    0x4(%eax),%edi
+f0106a21:	83 ec 08             	sub    $0x8,%esp
+f0106a24:	53                   	push   %ebx
+f0106a25:	ff 30                	push   (%eax)
+f0106a27:	ff d6                	call   *%esi
+			break;
+f0106a29:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0106a2c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f0106a2f:	e9 b1 02 00 00       	jmp    f0106ce5 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+f0106a34:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a37:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f0106a3a:	8b 10                	mov    (%eax),%edx
+f0106a3c:	89 d0                	mov    %edx,%eax
+f0106a3e:	f7 d8                	neg    %eax
+f0106a40:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0106a43:	83 f8 14             	cmp    $0x14,%eax
+f0106a46:	7f 23                	jg     f0106a6b <vprintfmt+0x152>
+f0106a48:	8b 14 85 80 b3 10 f0 	mov    -0xfef4c80(,%eax,4),%edx
+f0106a4f:	85 d2                	test   %edx,%edx
+f0106a51:	74 18                	je     f0106a6b <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+f0106a53:	52                   	push   %edx
+f0106a54:	68 e5 9e 10 f0       	push   $0xf0109ee5
+f0106a59:	53                   	push   %ebx
+f0106a5a:	56                   	push   %esi
+f0106a5b:	e8 9c fe ff ff       	call   f01068fc <printfmt>
+f0106a60:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0106a63:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0106a66:	e9 7a 02 00 00       	jmp    f0106ce5 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+f0106a6b:	50                   	push   %eax
+f0106a6c:	68 b2 b0 10 f0       	push   $0xf010b0b2
+f0106a71:	53                   	push   %ebx
+f0106a72:	56                   	push   %esi
+f0106a73:	e8 84 fe ff ff       	call   f01068fc <printfmt>
+f0106a78:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0106a7b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f0106a7e:	e9 62 02 00 00       	jmp    f0106ce5 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0106a83:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a86:	83 c0 04             	add    $0x4,%eax
+f0106a89:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0106a8c:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a8f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f0106a91:	85 c9                	test   %ecx,%ecx
+f0106a93:	b8 ab b0 10 f0       	mov    $0xf010b0ab,%eax
+f0106a98:	0f 45 c1             	cmovne %ecx,%eax
+f0106a9b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f0106a9e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0106aa2:	7e 06                	jle    f0106aaa <vprintfmt+0x191>
+f0106aa4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f0106aa8:	75 0b                	jne    f0106ab5 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0106aaa:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0106aad:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0106ab0:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106ab3:	eb 5c                	jmp    f0106b11 <vprintfmt+0x1f8>
+f0106ab5:	83 ec 08             	sub    $0x8,%esp
+f0106ab8:	ff 75 d0             	push   -0x30(%ebp)
+f0106abb:	ff 75 cc             	push   -0x34(%ebp)
+f0106abe:	e8 0e 04 00 00       	call   f0106ed1 <strnlen>
+f0106ac3:	89 c2                	mov    %eax,%edx
+f0106ac5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106ac8:	29 d0                	sub    %edx,%eax
+f0106aca:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f0106acd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f0106ad1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106ad4:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106ad7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0106ad9:	eb 0e                	jmp    f0106ae9 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+f0106adb:	83 ec 08             	sub    $0x8,%esp
+f0106ade:	53                   	push   %ebx
+f0106adf:	57                   	push   %edi
+f0106ae0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0106ae3:	83 ee 01             	sub    $0x1,%esi
+f0106ae6:	83 c4 10             	add    $0x10,%esp
+f0106ae9:	85 f6                	test   %esi,%esi
+f0106aeb:	7f ee                	jg     f0106adb <vprintfmt+0x1c2>
+f0106aed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106af0:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106af3:	85 c0                	test   %eax,%eax
+f0106af5:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106afa:	0f 49 d0             	cmovns %eax,%edx
+f0106afd:	29 d0                	sub    %edx,%eax
+f0106aff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106b02:	eb a6                	jmp    f0106aaa <vprintfmt+0x191>
+					putch(ch, putdat);
+f0106b04:	83 ec 08             	sub    $0x8,%esp
+f0106b07:	53                   	push   %ebx
+f0106b08:	52                   	push   %edx
+f0106b09:	ff 55 08             	call   *0x8(%ebp)
+f0106b0c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0106b0f:	89 f1                	mov    %esi,%ecx
+f0106b11:	8d 71 01             	lea    0x1(%ecx),%esi
+f0106b14:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0106b18:	0f be d0             	movsbl %al,%edx
+f0106b1b:	85 d2                	test   %edx,%edx
+f0106b1d:	74 28                	je     f0106b47 <vprintfmt+0x22e>
+f0106b1f:	85 ff                	test   %edi,%edi
+f0106b21:	78 05                	js     f0106b28 <vprintfmt+0x20f>
+f0106b23:	83 ef 01             	sub    $0x1,%edi
+f0106b26:	78 30                	js     f0106b58 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+f0106b28:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0106b2c:	74 d6                	je     f0106b04 <vprintfmt+0x1eb>
+f0106b2e:	0f be c0             	movsbl %al,%eax
+f0106b31:	83 e8 20             	sub    $0x20,%eax
+f0106b34:	83 f8 5e             	cmp    $0x5e,%eax
+f0106b37:	76 cb                	jbe    f0106b04 <vprintfmt+0x1eb>
+					putch('?', putdat);
+f0106b39:	83 ec 08             	sub    $0x8,%esp
+f0106b3c:	53                   	push   %ebx
+f0106b3d:	6a 3f                	push   $0x3f
+f0106b3f:	ff 55 08             	call   *0x8(%ebp)
+f0106b42:	83 c4 10             	add    $0x10,%esp
+f0106b45:	eb c8                	jmp    f0106b0f <vprintfmt+0x1f6>
+f0106b47:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106b4a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0106b4d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0106b50:	01 d0                	add    %edx,%eax
+f0106b52:	29 c8                	sub    %ecx,%eax
+f0106b54:	89 c7                	mov    %eax,%edi
+f0106b56:	eb 13                	jmp    f0106b6b <vprintfmt+0x252>
+f0106b58:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106b5b:	eb ed                	jmp    f0106b4a <vprintfmt+0x231>
+				putch(' ', putdat);
+f0106b5d:	83 ec 08             	sub    $0x8,%esp
+f0106b60:	53                   	push   %ebx
+f0106b61:	6a 20                	push   $0x20
+f0106b63:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f0106b65:	83 ef 01             	sub    $0x1,%edi
+f0106b68:	83 c4 10             	add    $0x10,%esp
+f0106b6b:	85 ff                	test   %edi,%edi
+f0106b6d:	7f ee                	jg     f0106b5d <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0106b6f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0106b72:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106b75:	e9 6b 01 00 00       	jmp    f0106ce5 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+f0106b7a:	83 f9 01             	cmp    $0x1,%ecx
+f0106b7d:	7f 1f                	jg     f0106b9e <vprintfmt+0x285>
+	else if (lflag)
+f0106b7f:	85 c9                	test   %ecx,%ecx
+f0106b81:	74 67                	je     f0106bea <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+f0106b83:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106b86:	8b 00                	mov    (%eax),%eax
+f0106b88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106b8b:	89 c1                	mov    %eax,%ecx
+f0106b8d:	c1 f9 1f             	sar    $0x1f,%ecx
+f0106b90:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106b93:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106b96:	8d 40 04             	lea    0x4(%eax),%eax
+f0106b99:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106b9c:	eb 17                	jmp    f0106bb5 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+f0106b9e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106ba1:	8b 50 04             	mov    0x4(%eax),%edx
+f0106ba4:	8b 00                	mov    (%eax),%eax
+f0106ba6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106ba9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0106bac:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106baf:	8d 40 08             	lea    0x8(%eax),%eax
+f0106bb2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f0106bb5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106bb8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f0106bbb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f0106bc0:	85 c9                	test   %ecx,%ecx
+f0106bc2:	0f 89 03 01 00 00    	jns    f0106ccb <vprintfmt+0x3b2>
+				putch('-', putdat);
+f0106bc8:	83 ec 08             	sub    $0x8,%esp
+f0106bcb:	53                   	push   %ebx
+f0106bcc:	6a 2d                	push   $0x2d
+f0106bce:	ff d6                	call   *%esi
+				num = -(long long) num;
+f0106bd0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106bd3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0106bd6:	f7 da                	neg    %edx
+f0106bd8:	83 d1 00             	adc    $0x0,%ecx
+f0106bdb:	f7 d9                	neg    %ecx
+f0106bdd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f0106be0:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0106be5:	e9 e1 00 00 00       	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+f0106bea:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106bed:	8b 00                	mov    (%eax),%eax
+f0106bef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106bf2:	89 c1                	mov    %eax,%ecx
+f0106bf4:	c1 f9 1f             	sar    $0x1f,%ecx
+f0106bf7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106bfa:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106bfd:	8d 40 04             	lea    0x4(%eax),%eax
+f0106c00:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106c03:	eb b0                	jmp    f0106bb5 <vprintfmt+0x29c>
+	if (lflag >= 2)
+f0106c05:	83 f9 01             	cmp    $0x1,%ecx
+f0106c08:	7f 1e                	jg     f0106c28 <vprintfmt+0x30f>
+	else if (lflag)
+f0106c0a:	85 c9                	test   %ecx,%ecx
+f0106c0c:	74 32                	je     f0106c40 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+f0106c0e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c11:	8b 10                	mov    (%eax),%edx
+f0106c13:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106c18:	8d 40 04             	lea    0x4(%eax),%eax
+f0106c1b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106c1e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f0106c23:	e9 a3 00 00 00       	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+f0106c28:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c2b:	8b 10                	mov    (%eax),%edx
+f0106c2d:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106c30:	8d 40 08             	lea    0x8(%eax),%eax
+f0106c33:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106c36:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f0106c3b:	e9 8b 00 00 00       	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+f0106c40:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c43:	8b 10                	mov    (%eax),%edx
+f0106c45:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106c4a:	8d 40 04             	lea    0x4(%eax),%eax
+f0106c4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106c50:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f0106c55:	eb 74                	jmp    f0106ccb <vprintfmt+0x3b2>
+	if (lflag >= 2)
+f0106c57:	83 f9 01             	cmp    $0x1,%ecx
+f0106c5a:	7f 1b                	jg     f0106c77 <vprintfmt+0x35e>
+	else if (lflag)
+f0106c5c:	85 c9                	test   %ecx,%ecx
+f0106c5e:	74 2c                	je     f0106c8c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+f0106c60:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c63:	8b 10                	mov    (%eax),%edx
+f0106c65:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106c6a:	8d 40 04             	lea    0x4(%eax),%eax
+f0106c6d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106c70:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+f0106c75:	eb 54                	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+f0106c77:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c7a:	8b 10                	mov    (%eax),%edx
+f0106c7c:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106c7f:	8d 40 08             	lea    0x8(%eax),%eax
+f0106c82:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106c85:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+f0106c8a:	eb 3f                	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+f0106c8c:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106c8f:	8b 10                	mov    (%eax),%edx
+f0106c91:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106c96:	8d 40 04             	lea    0x4(%eax),%eax
+f0106c99:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106c9c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+f0106ca1:	eb 28                	jmp    f0106ccb <vprintfmt+0x3b2>
+			putch('0', putdat);
+f0106ca3:	83 ec 08             	sub    $0x8,%esp
+f0106ca6:	53                   	push   %ebx
+f0106ca7:	6a 30                	push   $0x30
+f0106ca9:	ff d6                	call   *%esi
+			putch('x', putdat);
+f0106cab:	83 c4 08             	add    $0x8,%esp
+f0106cae:	53                   	push   %ebx
+f0106caf:	6a 78                	push   $0x78
+f0106cb1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f0106cb3:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106cb6:	8b 10                	mov    (%eax),%edx
+f0106cb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f0106cbd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f0106cc0:	8d 40 04             	lea    0x4(%eax),%eax
+f0106cc3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106cc6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f0106ccb:	83 ec 0c             	sub    $0xc,%esp
+f0106cce:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f0106cd2:	50                   	push   %eax
+f0106cd3:	ff 75 e0             	push   -0x20(%ebp)
+f0106cd6:	57                   	push   %edi
+f0106cd7:	51                   	push   %ecx
+f0106cd8:	52                   	push   %edx
+f0106cd9:	89 da                	mov    %ebx,%edx
+f0106cdb:	89 f0                	mov    %esi,%eax
+f0106cdd:	e8 54 fb ff ff       	call   f0106836 <printnum>
+			break;
+f0106ce2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f0106ce5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+f0106ce8:	e9 4a fc ff ff       	jmp    f0106937 <vprintfmt+0x1e>
+	if (lflag >= 2)
+f0106ced:	83 f9 01             	cmp    $0x1,%ecx
+f0106cf0:	7f 1b                	jg     f0106d0d <vprintfmt+0x3f4>
+	else if (lflag)
+f0106cf2:	85 c9                	test   %ecx,%ecx
+f0106cf4:	74 2c                	je     f0106d22 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+f0106cf6:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106cf9:	8b 10                	mov    (%eax),%edx
+f0106cfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106d00:	8d 40 04             	lea    0x4(%eax),%eax
+f0106d03:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106d06:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f0106d0b:	eb be                	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+f0106d0d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106d10:	8b 10                	mov    (%eax),%edx
+f0106d12:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106d15:	8d 40 08             	lea    0x8(%eax),%eax
+f0106d18:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106d1b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f0106d20:	eb a9                	jmp    f0106ccb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+f0106d22:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106d25:	8b 10                	mov    (%eax),%edx
+f0106d27:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106d2c:	8d 40 04             	lea    0x4(%eax),%eax
+f0106d2f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106d32:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f0106d37:	eb 92                	jmp    f0106ccb <vprintfmt+0x3b2>
+			putch(ch, putdat);
+f0106d39:	83 ec 08             	sub    $0x8,%esp
+f0106d3c:	53                   	push   %ebx
+f0106d3d:	6a 25                	push   $0x25
+f0106d3f:	ff d6                	call   *%esi
+			break;
+f0106d41:	83 c4 10             	add    $0x10,%esp
+f0106d44:	eb 9f                	jmp    f0106ce5 <vprintfmt+0x3cc>
+			putch('%', putdat);
+f0106d46:	83 ec 08             	sub    $0x8,%esp
+f0106d49:	53                   	push   %ebx
+f0106d4a:	6a 25                	push   $0x25
+f0106d4c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0106d4e:	83 c4 10             	add    $0x10,%esp
+f0106d51:	89 f8                	mov    %edi,%eax
+f0106d53:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0106d57:	74 05                	je     f0106d5e <vprintfmt+0x445>
+f0106d59:	83 e8 01             	sub    $0x1,%eax
+f0106d5c:	eb f5                	jmp    f0106d53 <vprintfmt+0x43a>
+f0106d5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106d61:	eb 82                	jmp    f0106ce5 <vprintfmt+0x3cc>
+
+f0106d63 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0106d63:	55                   	push   %ebp
+f0106d64:	89 e5                	mov    %esp,%ebp
+f0106d66:	83 ec 18             	sub    $0x18,%esp
+f0106d69:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106d6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0106d6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0106d72:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0106d76:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0106d79:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0106d80:	85 c0                	test   %eax,%eax
+f0106d82:	74 26                	je     f0106daa <vsnprintf+0x47>
+f0106d84:	85 d2                	test   %edx,%edx
+f0106d86:	7e 22                	jle    f0106daa <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f0106d88:	ff 75 14             	push   0x14(%ebp)
+f0106d8b:	ff 75 10             	push   0x10(%ebp)
+f0106d8e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0106d91:	50                   	push   %eax
+f0106d92:	68 df 68 10 f0       	push   $0xf01068df
+f0106d97:	e8 7d fb ff ff       	call   f0106919 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f0106d9c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0106d9f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f0106da2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106da5:	83 c4 10             	add    $0x10,%esp
+}
+f0106da8:	c9                   	leave
+f0106da9:	c3                   	ret
+		return -E_INVAL;
+f0106daa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106daf:	eb f7                	jmp    f0106da8 <vsnprintf+0x45>
+
+f0106db1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f0106db1:	55                   	push   %ebp
+f0106db2:	89 e5                	mov    %esp,%ebp
+f0106db4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f0106db7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0106dba:	50                   	push   %eax
+f0106dbb:	ff 75 10             	push   0x10(%ebp)
+f0106dbe:	ff 75 0c             	push   0xc(%ebp)
+f0106dc1:	ff 75 08             	push   0x8(%ebp)
+f0106dc4:	e8 9a ff ff ff       	call   f0106d63 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f0106dc9:	c9                   	leave
+f0106dca:	c3                   	ret
+
+f0106dcb <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0106dcb:	55                   	push   %ebp
+f0106dcc:	89 e5                	mov    %esp,%ebp
+f0106dce:	57                   	push   %edi
+f0106dcf:	56                   	push   %esi
+f0106dd0:	53                   	push   %ebx
+f0106dd1:	83 ec 0c             	sub    $0xc,%esp
+f0106dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f0106dd7:	85 c0                	test   %eax,%eax
+f0106dd9:	74 11                	je     f0106dec <readline+0x21>
+		cprintf("%s", prompt);
+f0106ddb:	83 ec 08             	sub    $0x8,%esp
+f0106dde:	50                   	push   %eax
+f0106ddf:	68 e5 9e 10 f0       	push   $0xf0109ee5
+f0106de4:	e8 94 d5 ff ff       	call   f010437d <cprintf>
+f0106de9:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f0106dec:	83 ec 0c             	sub    $0xc,%esp
+f0106def:	6a 00                	push   $0x0
+f0106df1:	e8 7c 9a ff ff       	call   f0100872 <iscons>
+f0106df6:	89 c7                	mov    %eax,%edi
+f0106df8:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f0106dfb:	be 00 00 00 00       	mov    $0x0,%esi
+f0106e00:	eb 4b                	jmp    f0106e4d <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f0106e02:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f0106e07:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f0106e0a:	75 08                	jne    f0106e14 <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f0106e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106e0f:	5b                   	pop    %ebx
+f0106e10:	5e                   	pop    %esi
+f0106e11:	5f                   	pop    %edi
+f0106e12:	5d                   	pop    %ebp
+f0106e13:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f0106e14:	83 ec 08             	sub    $0x8,%esp
+f0106e17:	53                   	push   %ebx
+f0106e18:	68 15 b4 10 f0       	push   $0xf010b415
+f0106e1d:	e8 5b d5 ff ff       	call   f010437d <cprintf>
+f0106e22:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f0106e25:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106e2a:	eb e0                	jmp    f0106e0c <readline+0x41>
+			if (echoing)
+f0106e2c:	85 ff                	test   %edi,%edi
+f0106e2e:	75 05                	jne    f0106e35 <readline+0x6a>
+			i--;
+f0106e30:	83 ee 01             	sub    $0x1,%esi
+f0106e33:	eb 18                	jmp    f0106e4d <readline+0x82>
+				cputchar('\b');
+f0106e35:	83 ec 0c             	sub    $0xc,%esp
+f0106e38:	6a 08                	push   $0x8
+f0106e3a:	e8 12 9a ff ff       	call   f0100851 <cputchar>
+f0106e3f:	83 c4 10             	add    $0x10,%esp
+f0106e42:	eb ec                	jmp    f0106e30 <readline+0x65>
+			buf[i++] = c;
+f0106e44:	88 9e 80 4a a2 f0    	mov    %bl,-0xf5db580(%esi)
+f0106e4a:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0106e4d:	e8 0f 9a ff ff       	call   f0100861 <getchar>
+f0106e52:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f0106e54:	85 c0                	test   %eax,%eax
+f0106e56:	78 aa                	js     f0106e02 <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f0106e58:	83 f8 08             	cmp    $0x8,%eax
+f0106e5b:	0f 94 c0             	sete   %al
+f0106e5e:	83 fb 7f             	cmp    $0x7f,%ebx
+f0106e61:	0f 94 c2             	sete   %dl
+f0106e64:	08 d0                	or     %dl,%al
+f0106e66:	74 04                	je     f0106e6c <readline+0xa1>
+f0106e68:	85 f6                	test   %esi,%esi
+f0106e6a:	7f c0                	jg     f0106e2c <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0106e6c:	83 fb 1f             	cmp    $0x1f,%ebx
+f0106e6f:	7e 1a                	jle    f0106e8b <readline+0xc0>
+f0106e71:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f0106e77:	7f 12                	jg     f0106e8b <readline+0xc0>
+			if (echoing)
+f0106e79:	85 ff                	test   %edi,%edi
+f0106e7b:	74 c7                	je     f0106e44 <readline+0x79>
+				cputchar(c);
+f0106e7d:	83 ec 0c             	sub    $0xc,%esp
+f0106e80:	53                   	push   %ebx
+f0106e81:	e8 cb 99 ff ff       	call   f0100851 <cputchar>
+f0106e86:	83 c4 10             	add    $0x10,%esp
+f0106e89:	eb b9                	jmp    f0106e44 <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f0106e8b:	83 fb 0a             	cmp    $0xa,%ebx
+f0106e8e:	74 05                	je     f0106e95 <readline+0xca>
+f0106e90:	83 fb 0d             	cmp    $0xd,%ebx
+f0106e93:	75 b8                	jne    f0106e4d <readline+0x82>
+			if (echoing)
+f0106e95:	85 ff                	test   %edi,%edi
+f0106e97:	75 11                	jne    f0106eaa <readline+0xdf>
+			buf[i] = 0;
+f0106e99:	c6 86 80 4a a2 f0 00 	movb   $0x0,-0xf5db580(%esi)
+			return buf;
+f0106ea0:	b8 80 4a a2 f0       	mov    $0xf0a24a80,%eax
+f0106ea5:	e9 62 ff ff ff       	jmp    f0106e0c <readline+0x41>
+				cputchar('\n');
+f0106eaa:	83 ec 0c             	sub    $0xc,%esp
+f0106ead:	6a 0a                	push   $0xa
+f0106eaf:	e8 9d 99 ff ff       	call   f0100851 <cputchar>
+f0106eb4:	83 c4 10             	add    $0x10,%esp
+f0106eb7:	eb e0                	jmp    f0106e99 <readline+0xce>
+
+f0106eb9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f0106eb9:	55                   	push   %ebp
+f0106eba:	89 e5                	mov    %esp,%ebp
+f0106ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f0106ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106ec4:	eb 03                	jmp    f0106ec9 <strlen+0x10>
+		n++;
+f0106ec6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f0106ec9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0106ecd:	75 f7                	jne    f0106ec6 <strlen+0xd>
+	return n;
+}
+f0106ecf:	5d                   	pop    %ebp
+f0106ed0:	c3                   	ret
+
+f0106ed1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0106ed1:	55                   	push   %ebp
+f0106ed2:	89 e5                	mov    %esp,%ebp
+f0106ed4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0106ed7:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106eda:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106edf:	eb 03                	jmp    f0106ee4 <strnlen+0x13>
+		n++;
+f0106ee1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0106ee4:	39 d0                	cmp    %edx,%eax
+f0106ee6:	74 08                	je     f0106ef0 <strnlen+0x1f>
+f0106ee8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0106eec:	75 f3                	jne    f0106ee1 <strnlen+0x10>
+f0106eee:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f0106ef0:	89 d0                	mov    %edx,%eax
+f0106ef2:	5d                   	pop    %ebp
+f0106ef3:	c3                   	ret
+
+f0106ef4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f0106ef4:	55                   	push   %ebp
+f0106ef5:	89 e5                	mov    %esp,%ebp
+f0106ef7:	53                   	push   %ebx
+f0106ef8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0106efb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f0106efe:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106f03:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0106f07:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0106f0a:	83 c0 01             	add    $0x1,%eax
+f0106f0d:	84 d2                	test   %dl,%dl
+f0106f0f:	75 f2                	jne    f0106f03 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f0106f11:	89 c8                	mov    %ecx,%eax
+f0106f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106f16:	c9                   	leave
+f0106f17:	c3                   	ret
+
+f0106f18 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f0106f18:	55                   	push   %ebp
+f0106f19:	89 e5                	mov    %esp,%ebp
+f0106f1b:	53                   	push   %ebx
+f0106f1c:	83 ec 10             	sub    $0x10,%esp
+f0106f1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f0106f22:	53                   	push   %ebx
+f0106f23:	e8 91 ff ff ff       	call   f0106eb9 <strlen>
+f0106f28:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0106f2b:	ff 75 0c             	push   0xc(%ebp)
+f0106f2e:	01 d8                	add    %ebx,%eax
+f0106f30:	50                   	push   %eax
+f0106f31:	e8 be ff ff ff       	call   f0106ef4 <strcpy>
+	return dst;
+}
+f0106f36:	89 d8                	mov    %ebx,%eax
+f0106f38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106f3b:	c9                   	leave
+f0106f3c:	c3                   	ret
+
+f0106f3d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0106f3d:	55                   	push   %ebp
+f0106f3e:	89 e5                	mov    %esp,%ebp
+f0106f40:	56                   	push   %esi
+f0106f41:	53                   	push   %ebx
+f0106f42:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106f45:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f0106f48:	89 f3                	mov    %esi,%ebx
+f0106f4a:	03 5d 10             	add    0x10(%ebp),%ebx
+f0106f4d:	89 f0                	mov    %esi,%eax
+f0106f4f:	eb 0f                	jmp    f0106f60 <strncpy+0x23>
+		*dst++ = *src;
+f0106f51:	83 c0 01             	add    $0x1,%eax
+f0106f54:	0f b6 0a             	movzbl (%edx),%ecx
+f0106f57:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0106f5a:	80 f9 01             	cmp    $0x1,%cl
+f0106f5d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0106f60:	39 d8                	cmp    %ebx,%eax
+f0106f62:	75 ed                	jne    f0106f51 <strncpy+0x14>
+	}
+	return ret;
+}
+f0106f64:	89 f0                	mov    %esi,%eax
+f0106f66:	5b                   	pop    %ebx
+f0106f67:	5e                   	pop    %esi
+f0106f68:	5d                   	pop    %ebp
+f0106f69:	c3                   	ret
+
+f0106f6a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0106f6a:	55                   	push   %ebp
+f0106f6b:	89 e5                	mov    %esp,%ebp
+f0106f6d:	56                   	push   %esi
+f0106f6e:	53                   	push   %ebx
+f0106f6f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106f75:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f0106f78:	89 f0                	mov    %esi,%eax
+f0106f7a:	85 d2                	test   %edx,%edx
+f0106f7c:	74 21                	je     f0106f9f <strlcpy+0x35>
+f0106f7e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0106f82:	89 f2                	mov    %esi,%edx
+f0106f84:	eb 09                	jmp    f0106f8f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f0106f86:	83 c1 01             	add    $0x1,%ecx
+f0106f89:	83 c2 01             	add    $0x1,%edx
+f0106f8c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f0106f8f:	39 c2                	cmp    %eax,%edx
+f0106f91:	74 09                	je     f0106f9c <strlcpy+0x32>
+f0106f93:	0f b6 19             	movzbl (%ecx),%ebx
+f0106f96:	84 db                	test   %bl,%bl
+f0106f98:	75 ec                	jne    f0106f86 <strlcpy+0x1c>
+f0106f9a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f0106f9c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0106f9f:	29 f0                	sub    %esi,%eax
+}
+f0106fa1:	5b                   	pop    %ebx
+f0106fa2:	5e                   	pop    %esi
+f0106fa3:	5d                   	pop    %ebp
+f0106fa4:	c3                   	ret
+
+f0106fa5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f0106fa5:	55                   	push   %ebp
+f0106fa6:	89 e5                	mov    %esp,%ebp
+f0106fa8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0106fab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f0106fae:	eb 06                	jmp    f0106fb6 <strcmp+0x11>
+		p++, q++;
+f0106fb0:	83 c1 01             	add    $0x1,%ecx
+f0106fb3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0106fb6:	0f b6 01             	movzbl (%ecx),%eax
+f0106fb9:	84 c0                	test   %al,%al
+f0106fbb:	74 04                	je     f0106fc1 <strcmp+0x1c>
+f0106fbd:	3a 02                	cmp    (%edx),%al
+f0106fbf:	74 ef                	je     f0106fb0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0106fc1:	0f b6 c0             	movzbl %al,%eax
+f0106fc4:	0f b6 12             	movzbl (%edx),%edx
+f0106fc7:	29 d0                	sub    %edx,%eax
+}
+f0106fc9:	5d                   	pop    %ebp
+f0106fca:	c3                   	ret
+
+f0106fcb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0106fcb:	55                   	push   %ebp
+f0106fcc:	89 e5                	mov    %esp,%ebp
+f0106fce:	53                   	push   %ebx
+f0106fcf:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106fd5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f0106fd8:	eb 09                	jmp    f0106fe3 <strncmp+0x18>
+		n--, p++, q++;
+f0106fda:	83 ea 01             	sub    $0x1,%edx
+f0106fdd:	83 c0 01             	add    $0x1,%eax
+f0106fe0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f0106fe3:	85 d2                	test   %edx,%edx
+f0106fe5:	74 18                	je     f0106fff <strncmp+0x34>
+f0106fe7:	0f b6 18             	movzbl (%eax),%ebx
+f0106fea:	84 db                	test   %bl,%bl
+f0106fec:	74 04                	je     f0106ff2 <strncmp+0x27>
+f0106fee:	3a 19                	cmp    (%ecx),%bl
+f0106ff0:	74 e8                	je     f0106fda <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f0106ff2:	0f b6 00             	movzbl (%eax),%eax
+f0106ff5:	0f b6 11             	movzbl (%ecx),%edx
+f0106ff8:	29 d0                	sub    %edx,%eax
+}
+f0106ffa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106ffd:	c9                   	leave
+f0106ffe:	c3                   	ret
+		return 0;
+f0106fff:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107004:	eb f4                	jmp    f0106ffa <strncmp+0x2f>
+
+f0107006 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f0107006:	55                   	push   %ebp
+f0107007:	89 e5                	mov    %esp,%ebp
+f0107009:	8b 45 08             	mov    0x8(%ebp),%eax
+f010700c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0107010:	eb 03                	jmp    f0107015 <strchr+0xf>
+f0107012:	83 c0 01             	add    $0x1,%eax
+f0107015:	0f b6 10             	movzbl (%eax),%edx
+f0107018:	84 d2                	test   %dl,%dl
+f010701a:	74 06                	je     f0107022 <strchr+0x1c>
+		if (*s == c)
+f010701c:	38 ca                	cmp    %cl,%dl
+f010701e:	75 f2                	jne    f0107012 <strchr+0xc>
+f0107020:	eb 05                	jmp    f0107027 <strchr+0x21>
+			return (char *) s;
+	return 0;
+f0107022:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107027:	5d                   	pop    %ebp
+f0107028:	c3                   	ret
+
+f0107029 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f0107029:	55                   	push   %ebp
+f010702a:	89 e5                	mov    %esp,%ebp
+f010702c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010702f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0107033:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f0107036:	38 ca                	cmp    %cl,%dl
+f0107038:	74 09                	je     f0107043 <strfind+0x1a>
+f010703a:	84 d2                	test   %dl,%dl
+f010703c:	74 05                	je     f0107043 <strfind+0x1a>
+	for (; *s; s++)
+f010703e:	83 c0 01             	add    $0x1,%eax
+f0107041:	eb f0                	jmp    f0107033 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f0107043:	5d                   	pop    %ebp
+f0107044:	c3                   	ret
+
+f0107045 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f0107045:	55                   	push   %ebp
+f0107046:	89 e5                	mov    %esp,%ebp
+f0107048:	57                   	push   %edi
+f0107049:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010704c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f010704f:	85 c9                	test   %ecx,%ecx
+f0107051:	74 20                	je     f0107073 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0107053:	89 f8                	mov    %edi,%eax
+f0107055:	09 c8                	or     %ecx,%eax
+f0107057:	a8 03                	test   $0x3,%al
+f0107059:	75 12                	jne    f010706d <memset+0x28>
+		c &= 0xFF;
+f010705b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f010705f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f0107065:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f0107068:	fc                   	cld
+f0107069:	f3 ab                	rep stos %eax,%es:(%edi)
+f010706b:	eb 06                	jmp    f0107073 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f010706d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107070:	fc                   	cld
+f0107071:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0107073:	89 f8                	mov    %edi,%eax
+f0107075:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f0107078:	c9                   	leave
+f0107079:	c3                   	ret
+
+f010707a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f010707a:	55                   	push   %ebp
+f010707b:	89 e5                	mov    %esp,%ebp
+f010707d:	57                   	push   %edi
+f010707e:	56                   	push   %esi
+f010707f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107082:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0107085:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f0107088:	39 c6                	cmp    %eax,%esi
+f010708a:	73 32                	jae    f01070be <memmove+0x44>
+f010708c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f010708f:	39 d0                	cmp    %edx,%eax
+f0107091:	73 2b                	jae    f01070be <memmove+0x44>
+		s += n;
+		d += n;
+f0107093:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0107096:	89 d6                	mov    %edx,%esi
+f0107098:	09 fe                	or     %edi,%esi
+f010709a:	09 ce                	or     %ecx,%esi
+f010709c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f01070a2:	75 0e                	jne    f01070b2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f01070a4:	83 ef 04             	sub    $0x4,%edi
+f01070a7:	8d 72 fc             	lea    -0x4(%edx),%esi
+f01070aa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f01070ad:	fd                   	std
+f01070ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01070b0:	eb 09                	jmp    f01070bb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f01070b2:	83 ef 01             	sub    $0x1,%edi
+f01070b5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f01070b8:	fd                   	std
+f01070b9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f01070bb:	fc                   	cld
+f01070bc:	eb 1a                	jmp    f01070d8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f01070be:	89 f2                	mov    %esi,%edx
+f01070c0:	09 c2                	or     %eax,%edx
+f01070c2:	09 ca                	or     %ecx,%edx
+f01070c4:	f6 c2 03             	test   $0x3,%dl
+f01070c7:	75 0a                	jne    f01070d3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f01070c9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f01070cc:	89 c7                	mov    %eax,%edi
+f01070ce:	fc                   	cld
+f01070cf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01070d1:	eb 05                	jmp    f01070d8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f01070d3:	89 c7                	mov    %eax,%edi
+f01070d5:	fc                   	cld
+f01070d6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f01070d8:	5e                   	pop    %esi
+f01070d9:	5f                   	pop    %edi
+f01070da:	5d                   	pop    %ebp
+f01070db:	c3                   	ret
+
+f01070dc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f01070dc:	55                   	push   %ebp
+f01070dd:	89 e5                	mov    %esp,%ebp
+f01070df:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f01070e2:	ff 75 10             	push   0x10(%ebp)
+f01070e5:	ff 75 0c             	push   0xc(%ebp)
+f01070e8:	ff 75 08             	push   0x8(%ebp)
+f01070eb:	e8 8a ff ff ff       	call   f010707a <memmove>
+}
+f01070f0:	c9                   	leave
+f01070f1:	c3                   	ret
+
+f01070f2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f01070f2:	55                   	push   %ebp
+f01070f3:	89 e5                	mov    %esp,%ebp
+f01070f5:	56                   	push   %esi
+f01070f6:	53                   	push   %ebx
+f01070f7:	8b 45 08             	mov    0x8(%ebp),%eax
+f01070fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f01070fd:	89 c6                	mov    %eax,%esi
+f01070ff:	03 75 10             	add    0x10(%ebp),%esi
+f0107102:	eb 06                	jmp    f010710a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f0107104:	83 c0 01             	add    $0x1,%eax
+f0107107:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f010710a:	39 f0                	cmp    %esi,%eax
+f010710c:	74 14                	je     f0107122 <memcmp+0x30>
+		if (*s1 != *s2)
+f010710e:	0f b6 08             	movzbl (%eax),%ecx
+f0107111:	0f b6 1a             	movzbl (%edx),%ebx
+f0107114:	38 d9                	cmp    %bl,%cl
+f0107116:	74 ec                	je     f0107104 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f0107118:	0f b6 c1             	movzbl %cl,%eax
+f010711b:	0f b6 db             	movzbl %bl,%ebx
+f010711e:	29 d8                	sub    %ebx,%eax
+f0107120:	eb 05                	jmp    f0107127 <memcmp+0x35>
+	}
+
+	return 0;
+f0107122:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107127:	5b                   	pop    %ebx
+f0107128:	5e                   	pop    %esi
+f0107129:	5d                   	pop    %ebp
+f010712a:	c3                   	ret
+
+f010712b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f010712b:	55                   	push   %ebp
+f010712c:	89 e5                	mov    %esp,%ebp
+f010712e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107131:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f0107134:	89 c2                	mov    %eax,%edx
+f0107136:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f0107139:	eb 03                	jmp    f010713e <memfind+0x13>
+f010713b:	83 c0 01             	add    $0x1,%eax
+f010713e:	39 d0                	cmp    %edx,%eax
+f0107140:	73 04                	jae    f0107146 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f0107142:	38 08                	cmp    %cl,(%eax)
+f0107144:	75 f5                	jne    f010713b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f0107146:	5d                   	pop    %ebp
+f0107147:	c3                   	ret
+
+f0107148 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f0107148:	55                   	push   %ebp
+f0107149:	89 e5                	mov    %esp,%ebp
+f010714b:	57                   	push   %edi
+f010714c:	56                   	push   %esi
+f010714d:	53                   	push   %ebx
+f010714e:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107151:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f0107154:	eb 03                	jmp    f0107159 <strtol+0x11>
+		s++;
+f0107156:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f0107159:	0f b6 02             	movzbl (%edx),%eax
+f010715c:	3c 20                	cmp    $0x20,%al
+f010715e:	74 f6                	je     f0107156 <strtol+0xe>
+f0107160:	3c 09                	cmp    $0x9,%al
+f0107162:	74 f2                	je     f0107156 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f0107164:	3c 2b                	cmp    $0x2b,%al
+f0107166:	74 2a                	je     f0107192 <strtol+0x4a>
+	int neg = 0;
+f0107168:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f010716d:	3c 2d                	cmp    $0x2d,%al
+f010716f:	74 2b                	je     f010719c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0107171:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f0107177:	75 0f                	jne    f0107188 <strtol+0x40>
+f0107179:	80 3a 30             	cmpb   $0x30,(%edx)
+f010717c:	74 28                	je     f01071a6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f010717e:	85 db                	test   %ebx,%ebx
+f0107180:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0107185:	0f 44 d8             	cmove  %eax,%ebx
+f0107188:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010718d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0107190:	eb 46                	jmp    f01071d8 <strtol+0x90>
+		s++;
+f0107192:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f0107195:	bf 00 00 00 00       	mov    $0x0,%edi
+f010719a:	eb d5                	jmp    f0107171 <strtol+0x29>
+		s++, neg = 1;
+f010719c:	83 c2 01             	add    $0x1,%edx
+f010719f:	bf 01 00 00 00       	mov    $0x1,%edi
+f01071a4:	eb cb                	jmp    f0107171 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01071a6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f01071aa:	74 0e                	je     f01071ba <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f01071ac:	85 db                	test   %ebx,%ebx
+f01071ae:	75 d8                	jne    f0107188 <strtol+0x40>
+		s++, base = 8;
+f01071b0:	83 c2 01             	add    $0x1,%edx
+f01071b3:	bb 08 00 00 00       	mov    $0x8,%ebx
+f01071b8:	eb ce                	jmp    f0107188 <strtol+0x40>
+		s += 2, base = 16;
+f01071ba:	83 c2 02             	add    $0x2,%edx
+f01071bd:	bb 10 00 00 00       	mov    $0x10,%ebx
+f01071c2:	eb c4                	jmp    f0107188 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f01071c4:	0f be c0             	movsbl %al,%eax
+f01071c7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f01071ca:	3b 45 10             	cmp    0x10(%ebp),%eax
+f01071cd:	7d 3a                	jge    f0107209 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f01071cf:	83 c2 01             	add    $0x1,%edx
+f01071d2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f01071d6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f01071d8:	0f b6 02             	movzbl (%edx),%eax
+f01071db:	8d 70 d0             	lea    -0x30(%eax),%esi
+f01071de:	89 f3                	mov    %esi,%ebx
+f01071e0:	80 fb 09             	cmp    $0x9,%bl
+f01071e3:	76 df                	jbe    f01071c4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f01071e5:	8d 70 9f             	lea    -0x61(%eax),%esi
+f01071e8:	89 f3                	mov    %esi,%ebx
+f01071ea:	80 fb 19             	cmp    $0x19,%bl
+f01071ed:	77 08                	ja     f01071f7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f01071ef:	0f be c0             	movsbl %al,%eax
+f01071f2:	83 e8 57             	sub    $0x57,%eax
+f01071f5:	eb d3                	jmp    f01071ca <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f01071f7:	8d 70 bf             	lea    -0x41(%eax),%esi
+f01071fa:	89 f3                	mov    %esi,%ebx
+f01071fc:	80 fb 19             	cmp    $0x19,%bl
+f01071ff:	77 08                	ja     f0107209 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f0107201:	0f be c0             	movsbl %al,%eax
+f0107204:	83 e8 37             	sub    $0x37,%eax
+f0107207:	eb c1                	jmp    f01071ca <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f0107209:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010720d:	74 05                	je     f0107214 <strtol+0xcc>
+		*endptr = (char *) s;
+f010720f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107212:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f0107214:	89 c8                	mov    %ecx,%eax
+f0107216:	f7 d8                	neg    %eax
+f0107218:	85 ff                	test   %edi,%edi
+f010721a:	0f 45 c8             	cmovne %eax,%ecx
+}
+f010721d:	89 c8                	mov    %ecx,%eax
+f010721f:	5b                   	pop    %ebx
+f0107220:	5e                   	pop    %esi
+f0107221:	5f                   	pop    %edi
+f0107222:	5d                   	pop    %ebp
+f0107223:	c3                   	ret
+
+f0107224 <atoi>:
+
+int
+atoi(const char* s)
+{
+f0107224:	55                   	push   %ebp
+f0107225:	89 e5                	mov    %esp,%ebp
+f0107227:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+f010722a:	6a 00                	push   $0x0
+f010722c:	6a 00                	push   $0x0
+f010722e:	ff 75 08             	push   0x8(%ebp)
+f0107231:	e8 12 ff ff ff       	call   f0107148 <strtol>
+}
+f0107236:	c9                   	leave
+f0107237:	c3                   	ret
+
+f0107238 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f0107238:	fa                   	cli
+
+	xorw    %ax, %ax
+f0107239:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f010723b:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010723d:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f010723f:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0107241:	0f 01 16             	lgdtl  (%esi)
+f0107244:	74 70                	je     f01072b6 <mpsearch1+0x3>
+	movl    %cr0, %eax
+f0107246:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0107249:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f010724d:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0107250:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0107256:	08 00                	or     %al,(%eax)
+
+f0107258 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0107258:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f010725c:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010725e:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107260:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0107262:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0107266:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0107268:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f010726a:	b8 00 40 11 00       	mov    $0x114000,%eax
+	movl    %eax, %cr3
+f010726f:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f0107272:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0107275:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f010727a:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f010727d:	8b 25 44 62 a4 f0    	mov    0xf0a46244,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f0107283:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0107288:	b8 e0 01 10 f0       	mov    $0xf01001e0,%eax
+	call    *%eax
+f010728d:	ff d0                	call   *%eax
+
+f010728f <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f010728f:	eb fe                	jmp    f010728f <spin>
+f0107291:	8d 76 00             	lea    0x0(%esi),%esi
+
+f0107294 <gdt>:
+	...
+f010729c:	ff                   	(bad)
+f010729d:	ff 00                	incl   (%eax)
+f010729f:	00 00                	add    %al,(%eax)
+f01072a1:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f01072a8:	00                   	.byte 0x0
+f01072a9:	92                   	xchg   %eax,%edx
+f01072aa:	cf                   	iret
+	...
+
+f01072ac <gdtdesc>:
+f01072ac:	17                   	pop    %ss
+f01072ad:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f01072b2 <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f01072b2:	90                   	nop
+
+f01072b3 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f01072b3:	55                   	push   %ebp
+f01072b4:	89 e5                	mov    %esp,%ebp
+f01072b6:	57                   	push   %edi
+f01072b7:	56                   	push   %esi
+f01072b8:	53                   	push   %ebx
+f01072b9:	83 ec 0c             	sub    $0xc,%esp
+f01072bc:	89 c3                	mov    %eax,%ebx
+f01072be:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages)
+f01072c0:	a1 98 62 a4 f0       	mov    0xf0a46298,%eax
+f01072c5:	89 da                	mov    %ebx,%edx
+f01072c7:	c1 ea 0c             	shr    $0xc,%edx
+f01072ca:	39 c2                	cmp    %eax,%edx
+f01072cc:	73 1f                	jae    f01072ed <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f01072ce:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f01072d4:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f01072d6:	89 fa                	mov    %edi,%edx
+f01072d8:	c1 ea 0c             	shr    $0xc,%edx
+f01072db:	39 c2                	cmp    %eax,%edx
+f01072dd:	73 20                	jae    f01072ff <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f01072df:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f01072e5:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f01072eb:	eb 3a                	jmp    f0107327 <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01072ed:	53                   	push   %ebx
+f01072ee:	68 24 8e 10 f0       	push   $0xf0108e24
+f01072f3:	6a 57                	push   $0x57
+f01072f5:	68 b5 b5 10 f0       	push   $0xf010b5b5
+f01072fa:	e8 41 8d ff ff       	call   f0100040 <_panic>
+f01072ff:	57                   	push   %edi
+f0107300:	68 24 8e 10 f0       	push   $0xf0108e24
+f0107305:	6a 57                	push   $0x57
+f0107307:	68 b5 b5 10 f0       	push   $0xf010b5b5
+f010730c:	e8 2f 8d ff ff       	call   f0100040 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f0107311:	0f b6 0a             	movzbl (%edx),%ecx
+f0107314:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f0107316:	83 c2 01             	add    $0x1,%edx
+f0107319:	39 da                	cmp    %ebx,%edx
+f010731b:	75 f4                	jne    f0107311 <mpsearch1+0x5e>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010731d:	84 c0                	test   %al,%al
+f010731f:	74 2a                	je     f010734b <mpsearch1+0x98>
+	for (; mp < end; mp++)
+f0107321:	83 c6 10             	add    $0x10,%esi
+f0107324:	83 c3 10             	add    $0x10,%ebx
+f0107327:	39 fe                	cmp    %edi,%esi
+f0107329:	73 1b                	jae    f0107346 <mpsearch1+0x93>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010732b:	83 ec 04             	sub    $0x4,%esp
+f010732e:	6a 04                	push   $0x4
+f0107330:	68 c5 b5 10 f0       	push   $0xf010b5c5
+f0107335:	56                   	push   %esi
+f0107336:	e8 b7 fd ff ff       	call   f01070f2 <memcmp>
+f010733b:	83 c4 10             	add    $0x10,%esp
+f010733e:	89 f2                	mov    %esi,%edx
+f0107340:	85 c0                	test   %eax,%eax
+f0107342:	74 d5                	je     f0107319 <mpsearch1+0x66>
+f0107344:	eb db                	jmp    f0107321 <mpsearch1+0x6e>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f0107346:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f010734b:	89 f0                	mov    %esi,%eax
+f010734d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107350:	5b                   	pop    %ebx
+f0107351:	5e                   	pop    %esi
+f0107352:	5f                   	pop    %edi
+f0107353:	5d                   	pop    %ebp
+f0107354:	c3                   	ret
+
+f0107355 <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f0107355:	55                   	push   %ebp
+f0107356:	89 e5                	mov    %esp,%ebp
+f0107358:	57                   	push   %edi
+f0107359:	56                   	push   %esi
+f010735a:	53                   	push   %ebx
+f010735b:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f010735e:	c7 05 00 74 a4 f0 20 	movl   $0xf0a47020,0xf0a47400
+f0107365:	70 a4 f0 
+	if (PGNUM(pa) >= npages)
+f0107368:	83 3d 98 62 a4 f0 00 	cmpl   $0x0,0xf0a46298
+f010736f:	0f 84 86 00 00 00    	je     f01073fb <mp_init+0xa6>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0107375:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f010737c:	85 c0                	test   %eax,%eax
+f010737e:	0f 84 8d 00 00 00    	je     f0107411 <mp_init+0xbc>
+		p <<= 4;	// Translate from segment to PA
+f0107384:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0107387:	ba 00 04 00 00       	mov    $0x400,%edx
+f010738c:	e8 22 ff ff ff       	call   f01072b3 <mpsearch1>
+f0107391:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107394:	85 c0                	test   %eax,%eax
+f0107396:	75 1a                	jne    f01073b2 <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f0107398:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010739d:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f01073a2:	e8 0c ff ff ff       	call   f01072b3 <mpsearch1>
+f01073a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f01073aa:	85 c0                	test   %eax,%eax
+f01073ac:	0f 84 20 02 00 00    	je     f01075d2 <mp_init+0x27d>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f01073b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01073b5:	8b 58 04             	mov    0x4(%eax),%ebx
+f01073b8:	85 db                	test   %ebx,%ebx
+f01073ba:	74 7a                	je     f0107436 <mp_init+0xe1>
+f01073bc:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f01073c0:	75 74                	jne    f0107436 <mp_init+0xe1>
+f01073c2:	89 d8                	mov    %ebx,%eax
+f01073c4:	c1 e8 0c             	shr    $0xc,%eax
+f01073c7:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01073cd:	73 7c                	jae    f010744b <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f01073cf:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f01073d5:	89 de                	mov    %ebx,%esi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f01073d7:	83 ec 04             	sub    $0x4,%esp
+f01073da:	6a 04                	push   $0x4
+f01073dc:	68 ca b5 10 f0       	push   $0xf010b5ca
+f01073e1:	53                   	push   %ebx
+f01073e2:	e8 0b fd ff ff       	call   f01070f2 <memcmp>
+f01073e7:	83 c4 10             	add    $0x10,%esp
+f01073ea:	85 c0                	test   %eax,%eax
+f01073ec:	75 72                	jne    f0107460 <mp_init+0x10b>
+	for (i = 0; i < len; i++)
+f01073ee:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f01073f2:	01 df                	add    %ebx,%edi
+	sum = 0;
+f01073f4:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f01073f6:	e9 82 00 00 00       	jmp    f010747d <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01073fb:	68 00 04 00 00       	push   $0x400
+f0107400:	68 24 8e 10 f0       	push   $0xf0108e24
+f0107405:	6a 6f                	push   $0x6f
+f0107407:	68 b5 b5 10 f0       	push   $0xf010b5b5
+f010740c:	e8 2f 8c ff ff       	call   f0100040 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f0107411:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f0107418:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f010741b:	2d 00 04 00 00       	sub    $0x400,%eax
+f0107420:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107425:	e8 89 fe ff ff       	call   f01072b3 <mpsearch1>
+f010742a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010742d:	85 c0                	test   %eax,%eax
+f010742f:	75 81                	jne    f01073b2 <mp_init+0x5d>
+f0107431:	e9 62 ff ff ff       	jmp    f0107398 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f0107436:	83 ec 0c             	sub    $0xc,%esp
+f0107439:	68 28 b4 10 f0       	push   $0xf010b428
+f010743e:	e8 3a cf ff ff       	call   f010437d <cprintf>
+		return NULL;
+f0107443:	83 c4 10             	add    $0x10,%esp
+f0107446:	e9 87 01 00 00       	jmp    f01075d2 <mp_init+0x27d>
+f010744b:	53                   	push   %ebx
+f010744c:	68 24 8e 10 f0       	push   $0xf0108e24
+f0107451:	68 90 00 00 00       	push   $0x90
+f0107456:	68 b5 b5 10 f0       	push   $0xf010b5b5
+f010745b:	e8 e0 8b ff ff       	call   f0100040 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f0107460:	83 ec 0c             	sub    $0xc,%esp
+f0107463:	68 58 b4 10 f0       	push   $0xf010b458
+f0107468:	e8 10 cf ff ff       	call   f010437d <cprintf>
+		return NULL;
+f010746d:	83 c4 10             	add    $0x10,%esp
+f0107470:	e9 5d 01 00 00       	jmp    f01075d2 <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f0107475:	0f b6 0b             	movzbl (%ebx),%ecx
+f0107478:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f010747a:	83 c3 01             	add    $0x1,%ebx
+f010747d:	39 fb                	cmp    %edi,%ebx
+f010747f:	75 f4                	jne    f0107475 <mp_init+0x120>
+	if (sum(conf, conf->length) != 0) {
+f0107481:	84 d2                	test   %dl,%dl
+f0107483:	75 16                	jne    f010749b <mp_init+0x146>
+	if (conf->version != 1 && conf->version != 4) {
+f0107485:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f0107489:	80 fa 01             	cmp    $0x1,%dl
+f010748c:	74 05                	je     f0107493 <mp_init+0x13e>
+f010748e:	80 fa 04             	cmp    $0x4,%dl
+f0107491:	75 1d                	jne    f01074b0 <mp_init+0x15b>
+	for (i = 0; i < len; i++)
+f0107493:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f0107497:	01 d9                	add    %ebx,%ecx
+f0107499:	eb 36                	jmp    f01074d1 <mp_init+0x17c>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f010749b:	83 ec 0c             	sub    $0xc,%esp
+f010749e:	68 8c b4 10 f0       	push   $0xf010b48c
+f01074a3:	e8 d5 ce ff ff       	call   f010437d <cprintf>
+		return NULL;
+f01074a8:	83 c4 10             	add    $0x10,%esp
+f01074ab:	e9 22 01 00 00       	jmp    f01075d2 <mp_init+0x27d>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f01074b0:	83 ec 08             	sub    $0x8,%esp
+f01074b3:	0f b6 d2             	movzbl %dl,%edx
+f01074b6:	52                   	push   %edx
+f01074b7:	68 b0 b4 10 f0       	push   $0xf010b4b0
+f01074bc:	e8 bc ce ff ff       	call   f010437d <cprintf>
+		return NULL;
+f01074c1:	83 c4 10             	add    $0x10,%esp
+f01074c4:	e9 09 01 00 00       	jmp    f01075d2 <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f01074c9:	0f b6 13             	movzbl (%ebx),%edx
+f01074cc:	01 d0                	add    %edx,%eax
+	for (i = 0; i < len; i++)
+f01074ce:	83 c3 01             	add    $0x1,%ebx
+f01074d1:	39 d9                	cmp    %ebx,%ecx
+f01074d3:	75 f4                	jne    f01074c9 <mp_init+0x174>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f01074d5:	02 46 2a             	add    0x2a(%esi),%al
+f01074d8:	75 1c                	jne    f01074f6 <mp_init+0x1a1>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f01074da:	c7 05 00 70 a4 f0 01 	movl   $0x1,0xf0a47000
+f01074e1:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f01074e4:	8b 46 24             	mov    0x24(%esi),%eax
+f01074e7:	a3 00 80 a8 f0       	mov    %eax,0xf0a88000
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01074ec:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f01074ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01074f4:	eb 4d                	jmp    f0107543 <mp_init+0x1ee>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f01074f6:	83 ec 0c             	sub    $0xc,%esp
+f01074f9:	68 d0 b4 10 f0       	push   $0xf010b4d0
+f01074fe:	e8 7a ce ff ff       	call   f010437d <cprintf>
+		return NULL;
+f0107503:	83 c4 10             	add    $0x10,%esp
+f0107506:	e9 c7 00 00 00       	jmp    f01075d2 <mp_init+0x27d>
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+f010750b:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f010750f:	74 11                	je     f0107522 <mp_init+0x1cd>
+				bootcpu = &cpus[ncpu];
+f0107511:	6b 05 04 74 a4 f0 7c 	imul   $0x7c,0xf0a47404,%eax
+f0107518:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f010751d:	a3 00 74 a4 f0       	mov    %eax,0xf0a47400
+			if (ncpu < NCPU) {
+f0107522:	a1 04 74 a4 f0       	mov    0xf0a47404,%eax
+f0107527:	83 f8 07             	cmp    $0x7,%eax
+f010752a:	7f 33                	jg     f010755f <mp_init+0x20a>
+				cpus[ncpu].cpu_id = ncpu;
+f010752c:	6b d0 7c             	imul   $0x7c,%eax,%edx
+f010752f:	88 82 20 70 a4 f0    	mov    %al,-0xf5b8fe0(%edx)
+				ncpu++;
+f0107535:	83 c0 01             	add    $0x1,%eax
+f0107538:	a3 04 74 a4 f0       	mov    %eax,0xf0a47404
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f010753d:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0107540:	83 c3 01             	add    $0x1,%ebx
+f0107543:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f0107547:	39 c3                	cmp    %eax,%ebx
+f0107549:	73 4f                	jae    f010759a <mp_init+0x245>
+		switch (*p) {
+f010754b:	0f b6 07             	movzbl (%edi),%eax
+f010754e:	84 c0                	test   %al,%al
+f0107550:	74 b9                	je     f010750b <mp_init+0x1b6>
+f0107552:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0107555:	80 fa 03             	cmp    $0x3,%dl
+f0107558:	77 1c                	ja     f0107576 <mp_init+0x221>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f010755a:	83 c7 08             	add    $0x8,%edi
+			continue;
+f010755d:	eb e1                	jmp    f0107540 <mp_init+0x1eb>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f010755f:	83 ec 08             	sub    $0x8,%esp
+f0107562:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0107566:	50                   	push   %eax
+f0107567:	68 00 b5 10 f0       	push   $0xf010b500
+f010756c:	e8 0c ce ff ff       	call   f010437d <cprintf>
+f0107571:	83 c4 10             	add    $0x10,%esp
+f0107574:	eb c7                	jmp    f010753d <mp_init+0x1e8>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0107576:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0107579:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010757c:	50                   	push   %eax
+f010757d:	68 28 b5 10 f0       	push   $0xf010b528
+f0107582:	e8 f6 cd ff ff       	call   f010437d <cprintf>
+			ismp = 0;
+f0107587:	c7 05 00 70 a4 f0 00 	movl   $0x0,0xf0a47000
+f010758e:	00 00 00 
+			i = conf->entry;
+f0107591:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f0107595:	83 c4 10             	add    $0x10,%esp
+f0107598:	eb a6                	jmp    f0107540 <mp_init+0x1eb>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f010759a:	a1 00 74 a4 f0       	mov    0xf0a47400,%eax
+f010759f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f01075a6:	83 3d 00 70 a4 f0 00 	cmpl   $0x0,0xf0a47000
+f01075ad:	74 2b                	je     f01075da <mp_init+0x285>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f01075af:	83 ec 04             	sub    $0x4,%esp
+f01075b2:	ff 35 04 74 a4 f0    	push   0xf0a47404
+f01075b8:	0f b6 00             	movzbl (%eax),%eax
+f01075bb:	50                   	push   %eax
+f01075bc:	68 cf b5 10 f0       	push   $0xf010b5cf
+f01075c1:	e8 b7 cd ff ff       	call   f010437d <cprintf>
+
+	if (mp->imcrp) {
+f01075c6:	83 c4 10             	add    $0x10,%esp
+f01075c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01075cc:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f01075d0:	75 2e                	jne    f0107600 <mp_init+0x2ab>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f01075d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01075d5:	5b                   	pop    %ebx
+f01075d6:	5e                   	pop    %esi
+f01075d7:	5f                   	pop    %edi
+f01075d8:	5d                   	pop    %ebp
+f01075d9:	c3                   	ret
+		ncpu = 1;
+f01075da:	c7 05 04 74 a4 f0 01 	movl   $0x1,0xf0a47404
+f01075e1:	00 00 00 
+		lapicaddr = 0;
+f01075e4:	c7 05 00 80 a8 f0 00 	movl   $0x0,0xf0a88000
+f01075eb:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f01075ee:	83 ec 0c             	sub    $0xc,%esp
+f01075f1:	68 48 b5 10 f0       	push   $0xf010b548
+f01075f6:	e8 82 cd ff ff       	call   f010437d <cprintf>
+		return;
+f01075fb:	83 c4 10             	add    $0x10,%esp
+f01075fe:	eb d2                	jmp    f01075d2 <mp_init+0x27d>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f0107600:	83 ec 0c             	sub    $0xc,%esp
+f0107603:	68 74 b5 10 f0       	push   $0xf010b574
+f0107608:	e8 70 cd ff ff       	call   f010437d <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010760d:	b8 70 00 00 00       	mov    $0x70,%eax
+f0107612:	ba 22 00 00 00       	mov    $0x22,%edx
+f0107617:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0107618:	ba 23 00 00 00       	mov    $0x23,%edx
+f010761d:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f010761e:	83 c8 01             	or     $0x1,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107621:	ee                   	out    %al,(%dx)
+}
+f0107622:	83 c4 10             	add    $0x10,%esp
+f0107625:	eb ab                	jmp    f01075d2 <mp_init+0x27d>
+
+f0107627 <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f0107627:	8b 0d 04 80 a8 f0    	mov    0xf0a88004,%ecx
+f010762d:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f0107630:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f0107632:	a1 04 80 a8 f0       	mov    0xf0a88004,%eax
+f0107637:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f010763a:	c3                   	ret
+
+f010763b <cpunum>:
+}
+
+int
+cpunum(void)
+{
+	if (lapic)
+f010763b:	8b 15 04 80 a8 f0    	mov    0xf0a88004,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f0107641:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f0107646:	85 d2                	test   %edx,%edx
+f0107648:	74 06                	je     f0107650 <cpunum+0x15>
+		return lapic[ID] >> 24;
+f010764a:	8b 42 20             	mov    0x20(%edx),%eax
+f010764d:	c1 e8 18             	shr    $0x18,%eax
+}
+f0107650:	c3                   	ret
+
+f0107651 <lapic_init>:
+	if (!lapicaddr)
+f0107651:	a1 00 80 a8 f0       	mov    0xf0a88000,%eax
+f0107656:	85 c0                	test   %eax,%eax
+f0107658:	75 01                	jne    f010765b <lapic_init+0xa>
+f010765a:	c3                   	ret
+{
+f010765b:	55                   	push   %ebp
+f010765c:	89 e5                	mov    %esp,%ebp
+f010765e:	83 ec 10             	sub    $0x10,%esp
+	lapic = mmio_map_region(lapicaddr, 4096);
+f0107661:	68 00 10 00 00       	push   $0x1000
+f0107666:	50                   	push   %eax
+f0107667:	e8 33 a4 ff ff       	call   f0101a9f <mmio_map_region>
+f010766c:	a3 04 80 a8 f0       	mov    %eax,0xf0a88004
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0107671:	ba 27 01 00 00       	mov    $0x127,%edx
+f0107676:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f010767b:	e8 a7 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(TDCR, X1);
+f0107680:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0107685:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f010768a:	e8 98 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f010768f:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0107694:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0107699:	e8 89 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(TICR, 10000000); 
+f010769e:	ba 80 96 98 00       	mov    $0x989680,%edx
+f01076a3:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f01076a8:	e8 7a ff ff ff       	call   f0107627 <lapicw>
+	if (thiscpu != bootcpu)
+f01076ad:	e8 89 ff ff ff       	call   f010763b <cpunum>
+f01076b2:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01076b5:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f01076ba:	83 c4 10             	add    $0x10,%esp
+f01076bd:	39 05 00 74 a4 f0    	cmp    %eax,0xf0a47400
+f01076c3:	74 0f                	je     f01076d4 <lapic_init+0x83>
+		lapicw(LINT0, MASKED);
+f01076c5:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01076ca:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f01076cf:	e8 53 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(LINT1, MASKED);
+f01076d4:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01076d9:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f01076de:	e8 44 ff ff ff       	call   f0107627 <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f01076e3:	a1 04 80 a8 f0       	mov    0xf0a88004,%eax
+f01076e8:	8b 40 30             	mov    0x30(%eax),%eax
+f01076eb:	c1 e8 10             	shr    $0x10,%eax
+f01076ee:	a8 fc                	test   $0xfc,%al
+f01076f0:	75 7c                	jne    f010776e <lapic_init+0x11d>
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f01076f2:	ba 33 00 00 00       	mov    $0x33,%edx
+f01076f7:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f01076fc:	e8 26 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(ESR, 0);
+f0107701:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107706:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010770b:	e8 17 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(ESR, 0);
+f0107710:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107715:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010771a:	e8 08 ff ff ff       	call   f0107627 <lapicw>
+	lapicw(EOI, 0);
+f010771f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107724:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107729:	e8 f9 fe ff ff       	call   f0107627 <lapicw>
+	lapicw(ICRHI, 0);
+f010772e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107733:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107738:	e8 ea fe ff ff       	call   f0107627 <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f010773d:	ba 00 85 08 00       	mov    $0x88500,%edx
+f0107742:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107747:	e8 db fe ff ff       	call   f0107627 <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f010774c:	8b 15 04 80 a8 f0    	mov    0xf0a88004,%edx
+f0107752:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107758:	f6 c4 10             	test   $0x10,%ah
+f010775b:	75 f5                	jne    f0107752 <lapic_init+0x101>
+	lapicw(TPR, 0);
+f010775d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107762:	b8 20 00 00 00       	mov    $0x20,%eax
+f0107767:	e8 bb fe ff ff       	call   f0107627 <lapicw>
+}
+f010776c:	c9                   	leave
+f010776d:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f010776e:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107773:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0107778:	e8 aa fe ff ff       	call   f0107627 <lapicw>
+f010777d:	e9 70 ff ff ff       	jmp    f01076f2 <lapic_init+0xa1>
+
+f0107782 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f0107782:	83 3d 04 80 a8 f0 00 	cmpl   $0x0,0xf0a88004
+f0107789:	74 17                	je     f01077a2 <lapic_eoi+0x20>
+{
+f010778b:	55                   	push   %ebp
+f010778c:	89 e5                	mov    %esp,%ebp
+f010778e:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0107791:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107796:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010779b:	e8 87 fe ff ff       	call   f0107627 <lapicw>
+}
+f01077a0:	c9                   	leave
+f01077a1:	c3                   	ret
+f01077a2:	c3                   	ret
+
+f01077a3 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f01077a3:	55                   	push   %ebp
+f01077a4:	89 e5                	mov    %esp,%ebp
+f01077a6:	56                   	push   %esi
+f01077a7:	53                   	push   %ebx
+f01077a8:	8b 75 08             	mov    0x8(%ebp),%esi
+f01077ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01077ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01077b3:	ba 70 00 00 00       	mov    $0x70,%edx
+f01077b8:	ee                   	out    %al,(%dx)
+f01077b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01077be:	ba 71 00 00 00       	mov    $0x71,%edx
+f01077c3:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f01077c4:	83 3d 98 62 a4 f0 00 	cmpl   $0x0,0xf0a46298
+f01077cb:	74 7e                	je     f010784b <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f01077cd:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f01077d4:	00 00 
+	wrv[1] = addr >> 4;
+f01077d6:	89 d8                	mov    %ebx,%eax
+f01077d8:	c1 e8 04             	shr    $0x4,%eax
+f01077db:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f01077e1:	c1 e6 18             	shl    $0x18,%esi
+f01077e4:	89 f2                	mov    %esi,%edx
+f01077e6:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01077eb:	e8 37 fe ff ff       	call   f0107627 <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f01077f0:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f01077f5:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01077fa:	e8 28 fe ff ff       	call   f0107627 <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f01077ff:	ba 00 85 00 00       	mov    $0x8500,%edx
+f0107804:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107809:	e8 19 fe ff ff       	call   f0107627 <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f010780e:	c1 eb 0c             	shr    $0xc,%ebx
+f0107811:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f0107814:	89 f2                	mov    %esi,%edx
+f0107816:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010781b:	e8 07 fe ff ff       	call   f0107627 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0107820:	89 da                	mov    %ebx,%edx
+f0107822:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107827:	e8 fb fd ff ff       	call   f0107627 <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f010782c:	89 f2                	mov    %esi,%edx
+f010782e:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107833:	e8 ef fd ff ff       	call   f0107627 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0107838:	89 da                	mov    %ebx,%edx
+f010783a:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010783f:	e8 e3 fd ff ff       	call   f0107627 <lapicw>
+		microdelay(200);
+	}
+}
+f0107844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107847:	5b                   	pop    %ebx
+f0107848:	5e                   	pop    %esi
+f0107849:	5d                   	pop    %ebp
+f010784a:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010784b:	68 67 04 00 00       	push   $0x467
+f0107850:	68 24 8e 10 f0       	push   $0xf0108e24
+f0107855:	68 98 00 00 00       	push   $0x98
+f010785a:	68 ec b5 10 f0       	push   $0xf010b5ec
+f010785f:	e8 dc 87 ff ff       	call   f0100040 <_panic>
+
+f0107864 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0107864:	55                   	push   %ebp
+f0107865:	89 e5                	mov    %esp,%ebp
+f0107867:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f010786a:	8b 55 08             	mov    0x8(%ebp),%edx
+f010786d:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0107873:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107878:	e8 aa fd ff ff       	call   f0107627 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f010787d:	8b 15 04 80 a8 f0    	mov    0xf0a88004,%edx
+f0107883:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107889:	f6 c4 10             	test   $0x10,%ah
+f010788c:	75 f5                	jne    f0107883 <lapic_ipi+0x1f>
+		;
+}
+f010788e:	c9                   	leave
+f010788f:	c3                   	ret
+
+f0107890 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0107890:	55                   	push   %ebp
+f0107891:	89 e5                	mov    %esp,%ebp
+f0107893:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f0107896:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f010789c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010789f:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f01078a2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f01078a9:	5d                   	pop    %ebp
+f01078aa:	c3                   	ret
+
+f01078ab <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f01078ab:	55                   	push   %ebp
+f01078ac:	89 e5                	mov    %esp,%ebp
+f01078ae:	56                   	push   %esi
+f01078af:	53                   	push   %ebx
+f01078b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->locked && lock->cpu == thiscpu;
+f01078b3:	83 3b 00             	cmpl   $0x0,(%ebx)
+f01078b6:	75 07                	jne    f01078bf <spin_lock+0x14>
+	asm volatile("lock; xchgl %0, %1"
+f01078b8:	ba 01 00 00 00       	mov    $0x1,%edx
+f01078bd:	eb 34                	jmp    f01078f3 <spin_lock+0x48>
+f01078bf:	8b 73 08             	mov    0x8(%ebx),%esi
+f01078c2:	e8 74 fd ff ff       	call   f010763b <cpunum>
+f01078c7:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01078ca:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+#ifdef DEBUG_SPINLOCK
+	if (holding(lk))
+f01078cf:	39 c6                	cmp    %eax,%esi
+f01078d1:	75 e5                	jne    f01078b8 <spin_lock+0xd>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f01078d3:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f01078d6:	e8 60 fd ff ff       	call   f010763b <cpunum>
+f01078db:	83 ec 0c             	sub    $0xc,%esp
+f01078de:	53                   	push   %ebx
+f01078df:	50                   	push   %eax
+f01078e0:	68 fc b5 10 f0       	push   $0xf010b5fc
+f01078e5:	6a 41                	push   $0x41
+f01078e7:	68 5e b6 10 f0       	push   $0xf010b65e
+f01078ec:	e8 4f 87 ff ff       	call   f0100040 <_panic>
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it. 
+	while (xchg(&lk->locked, 1) != 0)
+		asm volatile ("pause");
+f01078f1:	f3 90                	pause
+f01078f3:	89 d0                	mov    %edx,%eax
+f01078f5:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&lk->locked, 1) != 0)
+f01078f8:	85 c0                	test   %eax,%eax
+f01078fa:	75 f5                	jne    f01078f1 <spin_lock+0x46>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f01078fc:	e8 3a fd ff ff       	call   f010763b <cpunum>
+f0107901:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0107904:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+f0107909:	89 43 08             	mov    %eax,0x8(%ebx)
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f010790c:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f010790e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f0107913:	83 f8 09             	cmp    $0x9,%eax
+f0107916:	7f 21                	jg     f0107939 <spin_lock+0x8e>
+f0107918:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f010791e:	76 19                	jbe    f0107939 <spin_lock+0x8e>
+		pcs[i] = ebp[1];          // saved %eip
+f0107920:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0107923:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f0107927:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f0107929:	83 c0 01             	add    $0x1,%eax
+f010792c:	eb e5                	jmp    f0107913 <spin_lock+0x68>
+		pcs[i] = 0;
+f010792e:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+f0107935:	00 
+	for (; i < 10; i++)
+f0107936:	83 c0 01             	add    $0x1,%eax
+f0107939:	83 f8 09             	cmp    $0x9,%eax
+f010793c:	7e f0                	jle    f010792e <spin_lock+0x83>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f010793e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107941:	5b                   	pop    %ebx
+f0107942:	5e                   	pop    %esi
+f0107943:	5d                   	pop    %ebp
+f0107944:	c3                   	ret
+
+f0107945 <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f0107945:	55                   	push   %ebp
+f0107946:	89 e5                	mov    %esp,%ebp
+f0107948:	57                   	push   %edi
+f0107949:	56                   	push   %esi
+f010794a:	53                   	push   %ebx
+f010794b:	83 ec 5c             	sub    $0x5c,%esp
+f010794e:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0107951:	83 3e 00             	cmpl   $0x0,(%esi)
+f0107954:	75 38                	jne    f010798e <spin_unlock+0x49>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f0107956:	83 ec 04             	sub    $0x4,%esp
+f0107959:	6a 28                	push   $0x28
+f010795b:	8d 46 0c             	lea    0xc(%esi),%eax
+f010795e:	50                   	push   %eax
+f010795f:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f0107962:	53                   	push   %ebx
+f0107963:	e8 12 f7 ff ff       	call   f010707a <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f0107968:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f010796b:	0f b6 38             	movzbl (%eax),%edi
+f010796e:	8b 76 04             	mov    0x4(%esi),%esi
+f0107971:	e8 c5 fc ff ff       	call   f010763b <cpunum>
+f0107976:	57                   	push   %edi
+f0107977:	56                   	push   %esi
+f0107978:	50                   	push   %eax
+f0107979:	68 28 b6 10 f0       	push   $0xf010b628
+f010797e:	e8 fa c9 ff ff       	call   f010437d <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0107983:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f0107986:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0107989:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010798c:	eb 4a                	jmp    f01079d8 <spin_unlock+0x93>
+	return lock->locked && lock->cpu == thiscpu;
+f010798e:	8b 5e 08             	mov    0x8(%esi),%ebx
+f0107991:	e8 a5 fc ff ff       	call   f010763b <cpunum>
+f0107996:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0107999:	05 20 70 a4 f0       	add    $0xf0a47020,%eax
+	if (!holding(lk)) {
+f010799e:	39 c3                	cmp    %eax,%ebx
+f01079a0:	75 b4                	jne    f0107956 <spin_unlock+0x11>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f01079a2:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f01079a9:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1"
+f01079b0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01079b5:	f0 87 06             	lock xchg %eax,(%esi)
+	// respect to any other instruction which references the same memory.
+	// x86 CPUs will not reorder loads/stores across locked instructions
+	// (vol 3, 8.2.2). Because xchg() is implemented using asm volatile,
+	// gcc will not reorder C statements across the xchg.
+	xchg(&lk->locked, 0);
+}
+f01079b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01079bb:	5b                   	pop    %ebx
+f01079bc:	5e                   	pop    %esi
+f01079bd:	5f                   	pop    %edi
+f01079be:	5d                   	pop    %ebp
+f01079bf:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f01079c0:	83 ec 08             	sub    $0x8,%esp
+f01079c3:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01079c6:	ff 30                	push   (%eax)
+f01079c8:	68 85 b6 10 f0       	push   $0xf010b685
+f01079cd:	e8 ab c9 ff ff       	call   f010437d <cprintf>
+f01079d2:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f01079d5:	83 c3 04             	add    $0x4,%ebx
+f01079d8:	39 fb                	cmp    %edi,%ebx
+f01079da:	74 44                	je     f0107a20 <spin_unlock+0xdb>
+f01079dc:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f01079df:	8b 03                	mov    (%ebx),%eax
+f01079e1:	85 c0                	test   %eax,%eax
+f01079e3:	74 3b                	je     f0107a20 <spin_unlock+0xdb>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f01079e5:	83 ec 08             	sub    $0x8,%esp
+f01079e8:	56                   	push   %esi
+f01079e9:	50                   	push   %eax
+f01079ea:	e8 70 eb ff ff       	call   f010655f <debuginfo_eip>
+f01079ef:	83 c4 10             	add    $0x10,%esp
+f01079f2:	85 c0                	test   %eax,%eax
+f01079f4:	78 ca                	js     f01079c0 <spin_unlock+0x7b>
+					pcs[i] - info.eip_fn_addr);
+f01079f6:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01079f9:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f01079fb:	83 ec 04             	sub    $0x4,%esp
+f01079fe:	89 c2                	mov    %eax,%edx
+f0107a00:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f0107a03:	52                   	push   %edx
+f0107a04:	ff 75 b0             	push   -0x50(%ebp)
+f0107a07:	ff 75 b4             	push   -0x4c(%ebp)
+f0107a0a:	ff 75 ac             	push   -0x54(%ebp)
+f0107a0d:	ff 75 a8             	push   -0x58(%ebp)
+f0107a10:	50                   	push   %eax
+f0107a11:	68 6e b6 10 f0       	push   $0xf010b66e
+f0107a16:	e8 62 c9 ff ff       	call   f010437d <cprintf>
+f0107a1b:	83 c4 20             	add    $0x20,%esp
+f0107a1e:	eb b5                	jmp    f01079d5 <spin_unlock+0x90>
+		panic("spin_unlock");
+f0107a20:	83 ec 04             	sub    $0x4,%esp
+f0107a23:	68 8d b6 10 f0       	push   $0xf010b68d
+f0107a28:	6a 67                	push   $0x67
+f0107a2a:	68 5e b6 10 f0       	push   $0xf010b65e
+f0107a2f:	e8 0c 86 ff ff       	call   f0100040 <_panic>
+
+f0107a34 <e1000_send>:
+    return 0;
+}
+
+int
+e1000_send(uint8_t *buf, size_t length)
+{
+f0107a34:	55                   	push   %ebp
+f0107a35:	89 e5                	mov    %esp,%ebp
+f0107a37:	56                   	push   %esi
+f0107a38:	53                   	push   %ebx
+f0107a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+    if (length > E1000_TX_BUFFER_SIZE) {
+f0107a3c:	81 fe 00 06 00 00    	cmp    $0x600,%esi
+f0107a42:	77 74                	ja     f0107ab8 <e1000_send+0x84>
+gen_rw_ctrl_reg_func(32)
+f0107a44:	a1 20 14 b2 f0       	mov    0xf0b21420,%eax
+f0107a49:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+        return -E_OVER_LENGTH;
+    }
+    size_t tail = read_tx_desc_tail();
+    if (!(tx_desc_array[tail].status & E1000_TXD_STAT_DD)) {
+f0107a4f:	89 d8                	mov    %ebx,%eax
+f0107a51:	c1 e0 04             	shl    $0x4,%eax
+f0107a54:	f6 80 2c 80 a8 f0 01 	testb  $0x1,-0xf577fd4(%eax)
+f0107a5b:	74 62                	je     f0107abf <e1000_send+0x8b>
+        return -E_FULL_BUFFER;
+    }
+    memcpy(tx_buffer[tail], buf, length);
+f0107a5d:	83 ec 04             	sub    $0x4,%esp
+f0107a60:	56                   	push   %esi
+f0107a61:	ff 75 08             	push   0x8(%ebp)
+f0107a64:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0107a67:	c1 e0 09             	shl    $0x9,%eax
+f0107a6a:	05 20 94 b0 f0       	add    $0xf0b09420,%eax
+f0107a6f:	50                   	push   %eax
+f0107a70:	e8 67 f6 ff ff       	call   f01070dc <memcpy>
+    // tx_desc_array[tail].addr is fixed
+    tx_desc_array[tail].length = length;
+f0107a75:	89 d8                	mov    %ebx,%eax
+f0107a77:	c1 e0 04             	shl    $0x4,%eax
+f0107a7a:	66 89 b0 28 80 a8 f0 	mov    %si,-0xf577fd8(%eax)
+    // set report bit
+    tx_desc_array[tail].cmd = E1000_TXD_CMD_RS | E1000_TXD_CMD_EOP;
+f0107a81:	c6 80 2b 80 a8 f0 09 	movb   $0x9,-0xf577fd5(%eax)
+    // clear is done bit
+    tx_desc_array[tail].status = 0;
+f0107a88:	c6 80 2c 80 a8 f0 00 	movb   $0x0,-0xf577fd4(%eax)
+
+    // if tail will be out of array, round it to zero
+    if (++tail == E1000_TX_DESC_N)
+f0107a8f:	8d 43 01             	lea    0x1(%ebx),%eax
+f0107a92:	83 c4 10             	add    $0x10,%esp
+        tail = 0;
+f0107a95:	83 fb 3f             	cmp    $0x3f,%ebx
+f0107a98:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107a9d:	0f 44 c2             	cmove  %edx,%eax
+gen_rw_ctrl_reg_func(32)
+f0107aa0:	8b 15 20 14 b2 f0    	mov    0xf0b21420,%edx
+f0107aa6:	89 82 18 38 00 00    	mov    %eax,0x3818(%edx)
+    write_tx_desc_tail(tail);
+    return 0;
+f0107aac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107ab1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107ab4:	5b                   	pop    %ebx
+f0107ab5:	5e                   	pop    %esi
+f0107ab6:	5d                   	pop    %ebp
+f0107ab7:	c3                   	ret
+        return -E_OVER_LENGTH;
+f0107ab8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f0107abd:	eb f2                	jmp    f0107ab1 <e1000_send+0x7d>
+        return -E_FULL_BUFFER;
+f0107abf:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+f0107ac4:	eb eb                	jmp    f0107ab1 <e1000_send+0x7d>
+
+f0107ac6 <e1000_recv>:
+
+int 
+e1000_recv(uint8_t *buf, size_t length)
+{
+f0107ac6:	55                   	push   %ebp
+f0107ac7:	89 e5                	mov    %esp,%ebp
+f0107ac9:	53                   	push   %ebx
+f0107aca:	83 ec 04             	sub    $0x4,%esp
+gen_rw_ctrl_reg_func(32)
+f0107acd:	a1 20 14 b2 f0       	mov    0xf0b21420,%eax
+    size_t recv_len;
+    size_t tail = read_rx_desc_tail();
+    if (++tail == E1000_RX_DESC_N)
+f0107ad2:	8b 80 18 28 00 00    	mov    0x2818(%eax),%eax
+f0107ad8:	8d 58 01             	lea    0x1(%eax),%ebx
+        tail = 0;
+f0107adb:	3d ff 00 00 00       	cmp    $0xff,%eax
+f0107ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107ae5:	0f 44 d8             	cmove  %eax,%ebx
+    if (!(rx_desc_array[tail].status & E1000_RXD_STAT_DD)) {
+f0107ae8:	89 d8                	mov    %ebx,%eax
+f0107aea:	c1 e0 04             	shl    $0x4,%eax
+f0107aed:	0f b6 80 2c 84 a8 f0 	movzbl -0xf577bd4(%eax),%eax
+f0107af4:	a8 01                	test   $0x1,%al
+f0107af6:	74 6e                	je     f0107b66 <e1000_recv+0xa0>
+        return -E_FULL_BUFFER;
+    }
+    // disable long packets
+    assert(rx_desc_array[tail].status & E1000_RXD_STAT_EOP);
+f0107af8:	a8 02                	test   $0x2,%al
+f0107afa:	74 51                	je     f0107b4d <e1000_recv+0x87>
+    if (rx_desc_array[tail].length > length) {
+f0107afc:	89 d8                	mov    %ebx,%eax
+f0107afe:	c1 e0 04             	shl    $0x4,%eax
+f0107b01:	0f b7 80 28 84 a8 f0 	movzwl -0xf577bd8(%eax),%eax
+f0107b08:	39 45 0c             	cmp    %eax,0xc(%ebp)
+f0107b0b:	72 60                	jb     f0107b6d <e1000_recv+0xa7>
+        return -E_BUFFER_TOO_SMALL;
+    }
+
+    memcpy(buf, rx_buffer[tail], rx_desc_array[tail].length);
+f0107b0d:	83 ec 04             	sub    $0x4,%esp
+f0107b10:	50                   	push   %eax
+f0107b11:	89 d8                	mov    %ebx,%eax
+f0107b13:	c1 e0 0b             	shl    $0xb,%eax
+f0107b16:	05 20 94 a8 f0       	add    $0xf0a89420,%eax
+f0107b1b:	50                   	push   %eax
+f0107b1c:	ff 75 08             	push   0x8(%ebp)
+f0107b1f:	e8 b8 f5 ff ff       	call   f01070dc <memcpy>
+    // clear DD and EOP
+    rx_desc_array[tail].status = 0;
+f0107b24:	89 d8                	mov    %ebx,%eax
+f0107b26:	c1 e0 04             	shl    $0x4,%eax
+f0107b29:	c6 80 2c 84 a8 f0 00 	movb   $0x0,-0xf577bd4(%eax)
+f0107b30:	05 20 84 a8 f0       	add    $0xf0a88420,%eax
+gen_rw_ctrl_reg_func(32)
+f0107b35:	8b 15 20 14 b2 f0    	mov    0xf0b21420,%edx
+f0107b3b:	89 9a 18 28 00 00    	mov    %ebx,0x2818(%edx)
+    recv_len = rx_desc_array[tail].length;
+    write_rx_desc_tail(tail);
+    return recv_len;
+f0107b41:	0f b7 40 08          	movzwl 0x8(%eax),%eax
+f0107b45:	83 c4 10             	add    $0x10,%esp
+}
+f0107b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107b4b:	c9                   	leave
+f0107b4c:	c3                   	ret
+    assert(rx_desc_array[tail].status & E1000_RXD_STAT_EOP);
+f0107b4d:	68 a8 b6 10 f0       	push   $0xf010b6a8
+f0107b52:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107b57:	68 9b 00 00 00       	push   $0x9b
+f0107b5c:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107b61:	e8 da 84 ff ff       	call   f0100040 <_panic>
+        return -E_FULL_BUFFER;
+f0107b66:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+f0107b6b:	eb db                	jmp    f0107b48 <e1000_recv+0x82>
+        return -E_BUFFER_TOO_SMALL;
+f0107b6d:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+f0107b72:	eb d4                	jmp    f0107b48 <e1000_recv+0x82>
+
+f0107b74 <e1000_attach>:
+    }
+}
+
+int
+e1000_attach(struct pci_func *f)
+{
+f0107b74:	55                   	push   %ebp
+f0107b75:	89 e5                	mov    %esp,%ebp
+f0107b77:	57                   	push   %edi
+f0107b78:	56                   	push   %esi
+f0107b79:	53                   	push   %ebx
+f0107b7a:	83 ec 18             	sub    $0x18,%esp
+f0107b7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pci_func_enable(f);
+f0107b80:	53                   	push   %ebx
+f0107b81:	e8 26 07 00 00       	call   f01082ac <pci_func_enable>
+    io_base = mmio_map_region(f->reg_base[0], f->reg_size[0]);
+f0107b86:	83 c4 08             	add    $0x8,%esp
+f0107b89:	ff 73 2c             	push   0x2c(%ebx)
+f0107b8c:	ff 73 14             	push   0x14(%ebx)
+f0107b8f:	e8 0b 9f ff ff       	call   f0101a9f <mmio_map_region>
+f0107b94:	a3 20 14 b2 f0       	mov    %eax,0xf0b21420
+    assert(read_ctrl_reg32(E1000_STATUS) == 0x80080783);
+f0107b99:	83 c4 10             	add    $0x10,%esp
+f0107b9c:	81 78 08 83 07 08 80 	cmpl   $0x80080783,0x8(%eax)
+f0107ba3:	75 26                	jne    f0107bcb <e1000_attach+0x57>
+f0107ba5:	89 c7                	mov    %eax,%edi
+    assert((uint32_t)tx_desc_array % 16 == 0);
+f0107ba7:	b8 20 80 a8 f0       	mov    $0xf0a88020,%eax
+f0107bac:	a8 0f                	test   $0xf,%al
+f0107bae:	75 34                	jne    f0107be4 <e1000_attach+0x70>
+f0107bb0:	b8 20 94 b0 f0       	mov    $0xf0b09420,%eax
+f0107bb5:	b9 20 94 b0 00       	mov    $0xb09420,%ecx
+f0107bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107bbf:	be 20 14 b2 f0       	mov    $0xf0b21420,%esi
+f0107bc4:	ba 20 80 a8 f0       	mov    $0xf0a88020,%edx
+f0107bc9:	eb 49                	jmp    f0107c14 <e1000_attach+0xa0>
+    assert(read_ctrl_reg32(E1000_STATUS) == 0x80080783);
+f0107bcb:	68 d8 b6 10 f0       	push   $0xf010b6d8
+f0107bd0:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107bd5:	68 ba 00 00 00       	push   $0xba
+f0107bda:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107bdf:	e8 5c 84 ff ff       	call   f0100040 <_panic>
+    assert((uint32_t)tx_desc_array % 16 == 0);
+f0107be4:	68 04 b7 10 f0       	push   $0xf010b704
+f0107be9:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107bee:	6a 41                	push   $0x41
+f0107bf0:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107bf5:	e8 46 84 ff ff       	call   f0100040 <_panic>
+        tx_desc_array[i].addr = PADDR(tx_buffer[i]);
+f0107bfa:	89 0a                	mov    %ecx,(%edx)
+f0107bfc:	89 5a 04             	mov    %ebx,0x4(%edx)
+        tx_desc_array[i].status = E1000_TXD_STAT_DD;
+f0107bff:	c6 42 0c 01          	movb   $0x1,0xc(%edx)
+    for (int i = 0; i < E1000_TX_DESC_N; i++) {
+f0107c03:	81 c1 00 06 00 00    	add    $0x600,%ecx
+f0107c09:	83 d3 00             	adc    $0x0,%ebx
+f0107c0c:	83 c2 10             	add    $0x10,%edx
+f0107c0f:	05 00 06 00 00       	add    $0x600,%eax
+f0107c14:	39 f0                	cmp    %esi,%eax
+f0107c16:	74 19                	je     f0107c31 <e1000_attach+0xbd>
+	if ((uint32_t)kva < KERNBASE)
+f0107c18:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107c1d:	77 db                	ja     f0107bfa <e1000_attach+0x86>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0107c1f:	50                   	push   %eax
+f0107c20:	68 48 8e 10 f0       	push   $0xf0108e48
+f0107c25:	6a 43                	push   $0x43
+f0107c27:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107c2c:	e8 0f 84 ff ff       	call   f0100040 <_panic>
+	if ((uint32_t)kva < KERNBASE)
+f0107c31:	b8 20 80 a8 f0       	mov    $0xf0a88020,%eax
+f0107c36:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107c3b:	76 71                	jbe    f0107cae <e1000_attach+0x13a>
+	return (physaddr_t)kva - KERNBASE;
+f0107c3d:	c7 87 00 38 00 00 20 	movl   $0xa88020,0x3800(%edi)
+f0107c44:	80 a8 00 
+gen_rw_ctrl_reg_func(32)
+f0107c47:	c7 87 04 38 00 00 00 	movl   $0x0,0x3804(%edi)
+f0107c4e:	00 00 00 
+f0107c51:	c7 87 08 38 00 00 00 	movl   $0x400,0x3808(%edi)
+f0107c58:	04 00 00 
+gen_rw_ctrl_reg_func(16)
+f0107c5b:	66 c7 87 10 38 00 00 	movw   $0x0,0x3810(%edi)
+f0107c62:	00 00 
+f0107c64:	66 c7 87 18 38 00 00 	movw   $0x0,0x3818(%edi)
+f0107c6b:	00 00 
+gen_rw_ctrl_reg_func(32)
+f0107c6d:	c7 87 00 04 00 00 0a 	movl   $0x4010a,0x400(%edi)
+f0107c74:	01 04 00 
+f0107c77:	c7 87 10 04 00 00 0a 	movl   $0x60100a,0x410(%edi)
+f0107c7e:	10 60 00 
+    tx_init();
+    cprintf("tx init finish\n");
+f0107c81:	83 ec 0c             	sub    $0xc,%esp
+f0107c84:	68 57 b7 10 f0       	push   $0xf010b757
+f0107c89:	e8 ef c6 ff ff       	call   f010437d <cprintf>
+rx_init()
+f0107c8e:	b8 20 94 a8 f0       	mov    $0xf0a89420,%eax
+f0107c93:	b9 20 94 a8 00       	mov    $0xa89420,%ecx
+f0107c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107c9d:	bf 20 84 a8 f0       	mov    $0xf0a88420,%edi
+f0107ca2:	be 20 94 b0 f0       	mov    $0xf0b09420,%esi
+f0107ca7:	83 c4 10             	add    $0x10,%esp
+    cprintf("tx init finish\n");
+f0107caa:	89 fa                	mov    %edi,%edx
+f0107cac:	eb 2c                	jmp    f0107cda <e1000_attach+0x166>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0107cae:	50                   	push   %eax
+f0107caf:	68 48 8e 10 f0       	push   $0xf0108e48
+f0107cb4:	6a 48                	push   $0x48
+f0107cb6:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107cbb:	e8 80 83 ff ff       	call   f0100040 <_panic>
+        rx_desc_array[i].addr= PADDR(rx_buffer[i]);
+f0107cc0:	89 0a                	mov    %ecx,(%edx)
+f0107cc2:	89 5a 04             	mov    %ebx,0x4(%edx)
+        rx_desc_array[i].status = 0;
+f0107cc5:	c6 42 0c 00          	movb   $0x0,0xc(%edx)
+    for (int i = 0; i < E1000_RX_DESC_N; i++) {
+f0107cc9:	81 c1 00 08 00 00    	add    $0x800,%ecx
+f0107ccf:	83 d3 00             	adc    $0x0,%ebx
+f0107cd2:	83 c2 10             	add    $0x10,%edx
+f0107cd5:	05 00 08 00 00       	add    $0x800,%eax
+f0107cda:	39 c6                	cmp    %eax,%esi
+f0107cdc:	74 19                	je     f0107cf7 <e1000_attach+0x183>
+	if ((uint32_t)kva < KERNBASE)
+f0107cde:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107ce3:	77 db                	ja     f0107cc0 <e1000_attach+0x14c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0107ce5:	50                   	push   %eax
+f0107ce6:	68 48 8e 10 f0       	push   $0xf0108e48
+f0107ceb:	6a 5e                	push   $0x5e
+f0107ced:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107cf2:	e8 49 83 ff ff       	call   f0100040 <_panic>
+gen_rw_ctrl_reg_func(32)
+f0107cf7:	a1 20 14 b2 f0       	mov    0xf0b21420,%eax
+f0107cfc:	c7 80 00 54 00 00 52 	movl   $0x12005452,0x5400(%eax)
+f0107d03:	54 00 12 
+f0107d06:	c7 80 04 54 00 00 34 	movl   $0x80005634,0x5404(%eax)
+f0107d0d:	56 00 80 
+    assert((uint32_t)rx_desc_array % 16 == 0);
+f0107d10:	f7 c7 0f 00 00 00    	test   $0xf,%edi
+f0107d16:	75 5e                	jne    f0107d76 <e1000_attach+0x202>
+	if ((uint32_t)kva < KERNBASE)
+f0107d18:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0107d1e:	76 6c                	jbe    f0107d8c <e1000_attach+0x218>
+	return (physaddr_t)kva - KERNBASE;
+f0107d20:	c7 80 00 28 00 00 20 	movl   $0xa88420,0x2800(%eax)
+f0107d27:	84 a8 00 
+gen_rw_ctrl_reg_func(32)
+f0107d2a:	c7 80 04 28 00 00 00 	movl   $0x0,0x2804(%eax)
+f0107d31:	00 00 00 
+f0107d34:	c7 80 08 28 00 00 00 	movl   $0x1000,0x2808(%eax)
+f0107d3b:	10 00 00 
+f0107d3e:	c7 80 10 28 00 00 00 	movl   $0x0,0x2810(%eax)
+f0107d45:	00 00 00 
+f0107d48:	c7 80 18 28 00 00 ff 	movl   $0xff,0x2818(%eax)
+f0107d4f:	00 00 00 
+f0107d52:	c7 80 00 01 00 00 02 	movl   $0x4008002,0x100(%eax)
+f0107d59:	80 00 04 
+    rx_init();
+    cprintf("rx init finish\n");
+f0107d5c:	83 ec 0c             	sub    $0xc,%esp
+f0107d5f:	68 67 b7 10 f0       	push   $0xf010b767
+f0107d64:	e8 14 c6 ff ff       	call   f010437d <cprintf>
+    // tx_test();
+    return 1;
+}
+f0107d69:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107d71:	5b                   	pop    %ebx
+f0107d72:	5e                   	pop    %esi
+f0107d73:	5f                   	pop    %edi
+f0107d74:	5d                   	pop    %ebp
+f0107d75:	c3                   	ret
+    assert((uint32_t)rx_desc_array % 16 == 0);
+f0107d76:	68 28 b7 10 f0       	push   $0xf010b728
+f0107d7b:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107d80:	6a 66                	push   $0x66
+f0107d82:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107d87:	e8 b4 82 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0107d8c:	68 20 84 a8 f0       	push   $0xf0a88420
+f0107d91:	68 48 8e 10 f0       	push   $0xf0108e48
+f0107d96:	6a 67                	push   $0x67
+f0107d98:	68 4a b7 10 f0       	push   $0xf010b74a
+f0107d9d:	e8 9e 82 ff ff       	call   f0100040 <_panic>
+
+f0107da2 <pci_attach_match>:
+}
+
+static int __attribute__((warn_unused_result))
+pci_attach_match(uint32_t key1, uint32_t key2,
+		 struct pci_driver *list, struct pci_func *pcif)
+{
+f0107da2:	55                   	push   %ebp
+f0107da3:	89 e5                	mov    %esp,%ebp
+f0107da5:	57                   	push   %edi
+f0107da6:	56                   	push   %esi
+f0107da7:	53                   	push   %ebx
+f0107da8:	83 ec 1c             	sub    $0x1c,%esp
+f0107dab:	89 c7                	mov    %eax,%edi
+f0107dad:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint32_t i;
+
+	for (i = 0; list[i].attachfn; i++) {
+f0107db0:	89 cb                	mov    %ecx,%ebx
+f0107db2:	eb 03                	jmp    f0107db7 <pci_attach_match+0x15>
+f0107db4:	83 c3 0c             	add    $0xc,%ebx
+f0107db7:	89 de                	mov    %ebx,%esi
+f0107db9:	8b 43 08             	mov    0x8(%ebx),%eax
+f0107dbc:	85 c0                	test   %eax,%eax
+f0107dbe:	74 37                	je     f0107df7 <pci_attach_match+0x55>
+		if (list[i].key1 == key1 && list[i].key2 == key2) {
+f0107dc0:	39 3b                	cmp    %edi,(%ebx)
+f0107dc2:	75 f0                	jne    f0107db4 <pci_attach_match+0x12>
+f0107dc4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0107dc7:	39 56 04             	cmp    %edx,0x4(%esi)
+f0107dca:	75 e8                	jne    f0107db4 <pci_attach_match+0x12>
+			int r = list[i].attachfn(pcif);
+f0107dcc:	83 ec 0c             	sub    $0xc,%esp
+f0107dcf:	ff 75 08             	push   0x8(%ebp)
+f0107dd2:	ff d0                	call   *%eax
+			if (r > 0)
+f0107dd4:	83 c4 10             	add    $0x10,%esp
+f0107dd7:	85 c0                	test   %eax,%eax
+f0107dd9:	7f 1c                	jg     f0107df7 <pci_attach_match+0x55>
+				return r;
+			if (r < 0)
+f0107ddb:	79 d7                	jns    f0107db4 <pci_attach_match+0x12>
+				cprintf("pci_attach_match: attaching "
+f0107ddd:	83 ec 0c             	sub    $0xc,%esp
+f0107de0:	50                   	push   %eax
+f0107de1:	ff 76 08             	push   0x8(%esi)
+f0107de4:	ff 75 e4             	push   -0x1c(%ebp)
+f0107de7:	57                   	push   %edi
+f0107de8:	68 78 b7 10 f0       	push   $0xf010b778
+f0107ded:	e8 8b c5 ff ff       	call   f010437d <cprintf>
+f0107df2:	83 c4 20             	add    $0x20,%esp
+f0107df5:	eb bd                	jmp    f0107db4 <pci_attach_match+0x12>
+					"%x.%x (%p): e\n",
+					key1, key2, list[i].attachfn, r);
+		}
+	}
+	return 0;
+}
+f0107df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107dfa:	5b                   	pop    %ebx
+f0107dfb:	5e                   	pop    %esi
+f0107dfc:	5f                   	pop    %edi
+f0107dfd:	5d                   	pop    %ebp
+f0107dfe:	c3                   	ret
+
+f0107dff <pci_conf1_set_addr>:
+{
+f0107dff:	55                   	push   %ebp
+f0107e00:	89 e5                	mov    %esp,%ebp
+f0107e02:	56                   	push   %esi
+f0107e03:	53                   	push   %ebx
+f0107e04:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(bus < 256);
+f0107e07:	3d ff 00 00 00       	cmp    $0xff,%eax
+f0107e0c:	77 3b                	ja     f0107e49 <pci_conf1_set_addr+0x4a>
+	assert(dev < 32);
+f0107e0e:	83 fa 1f             	cmp    $0x1f,%edx
+f0107e11:	77 4c                	ja     f0107e5f <pci_conf1_set_addr+0x60>
+	assert(func < 8);
+f0107e13:	83 f9 07             	cmp    $0x7,%ecx
+f0107e16:	77 5d                	ja     f0107e75 <pci_conf1_set_addr+0x76>
+	assert(offset < 256);
+f0107e18:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f0107e1e:	77 6b                	ja     f0107e8b <pci_conf1_set_addr+0x8c>
+	assert((offset & 0x3) == 0);
+f0107e20:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0107e26:	75 79                	jne    f0107ea1 <pci_conf1_set_addr+0xa2>
+		(bus << 16) | (dev << 11) | (func << 8) | (offset);
+f0107e28:	c1 e0 10             	shl    $0x10,%eax
+f0107e2b:	09 f0                	or     %esi,%eax
+f0107e2d:	c1 e1 08             	shl    $0x8,%ecx
+f0107e30:	09 c8                	or     %ecx,%eax
+f0107e32:	c1 e2 0b             	shl    $0xb,%edx
+f0107e35:	09 d0                	or     %edx,%eax
+	uint32_t v = (1 << 31) |		// config-space
+f0107e37:	0d 00 00 00 80       	or     $0x80000000,%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0107e3c:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f0107e41:	ef                   	out    %eax,(%dx)
+}
+f0107e42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107e45:	5b                   	pop    %ebx
+f0107e46:	5e                   	pop    %esi
+f0107e47:	5d                   	pop    %ebp
+f0107e48:	c3                   	ret
+	assert(bus < 256);
+f0107e49:	68 17 b9 10 f0       	push   $0xf010b917
+f0107e4e:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107e53:	6a 3c                	push   $0x3c
+f0107e55:	68 21 b9 10 f0       	push   $0xf010b921
+f0107e5a:	e8 e1 81 ff ff       	call   f0100040 <_panic>
+	assert(dev < 32);
+f0107e5f:	68 2c b9 10 f0       	push   $0xf010b92c
+f0107e64:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107e69:	6a 3d                	push   $0x3d
+f0107e6b:	68 21 b9 10 f0       	push   $0xf010b921
+f0107e70:	e8 cb 81 ff ff       	call   f0100040 <_panic>
+	assert(func < 8);
+f0107e75:	68 35 b9 10 f0       	push   $0xf010b935
+f0107e7a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107e7f:	6a 3e                	push   $0x3e
+f0107e81:	68 21 b9 10 f0       	push   $0xf010b921
+f0107e86:	e8 b5 81 ff ff       	call   f0100040 <_panic>
+	assert(offset < 256);
+f0107e8b:	68 3e b9 10 f0       	push   $0xf010b93e
+f0107e90:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107e95:	6a 3f                	push   $0x3f
+f0107e97:	68 21 b9 10 f0       	push   $0xf010b921
+f0107e9c:	e8 9f 81 ff ff       	call   f0100040 <_panic>
+	assert((offset & 0x3) == 0);
+f0107ea1:	68 4b b9 10 f0       	push   $0xf010b94b
+f0107ea6:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0107eab:	6a 40                	push   $0x40
+f0107ead:	68 21 b9 10 f0       	push   $0xf010b921
+f0107eb2:	e8 89 81 ff ff       	call   f0100040 <_panic>
+
+f0107eb7 <pci_conf_read>:
+{
+f0107eb7:	55                   	push   %ebp
+f0107eb8:	89 e5                	mov    %esp,%ebp
+f0107eba:	53                   	push   %ebx
+f0107ebb:	83 ec 10             	sub    $0x10,%esp
+f0107ebe:	89 d3                	mov    %edx,%ebx
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f0107ec0:	8b 48 08             	mov    0x8(%eax),%ecx
+f0107ec3:	8b 50 04             	mov    0x4(%eax),%edx
+f0107ec6:	8b 00                	mov    (%eax),%eax
+f0107ec8:	8b 40 04             	mov    0x4(%eax),%eax
+f0107ecb:	53                   	push   %ebx
+f0107ecc:	e8 2e ff ff ff       	call   f0107dff <pci_conf1_set_addr>
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0107ed1:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f0107ed6:	ed                   	in     (%dx),%eax
+}
+f0107ed7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107eda:	c9                   	leave
+f0107edb:	c3                   	ret
+
+f0107edc <pci_scan_bus>:
+		f->irq_line);
+}
+
+static int
+pci_scan_bus(struct pci_bus *bus)
+{
+f0107edc:	55                   	push   %ebp
+f0107edd:	89 e5                	mov    %esp,%ebp
+f0107edf:	57                   	push   %edi
+f0107ee0:	56                   	push   %esi
+f0107ee1:	53                   	push   %ebx
+f0107ee2:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f0107ee8:	89 c3                	mov    %eax,%ebx
+	int totaldev = 0;
+	struct pci_func df;
+	memset(&df, 0, sizeof(df));
+f0107eea:	6a 48                	push   $0x48
+f0107eec:	6a 00                	push   $0x0
+f0107eee:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f0107ef1:	50                   	push   %eax
+f0107ef2:	e8 4e f1 ff ff       	call   f0107045 <memset>
+	df.bus = bus;
+f0107ef7:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f0107efa:	83 c4 10             	add    $0x10,%esp
+f0107efd:	b8 00 00 00 00       	mov    $0x0,%eax
+	int totaldev = 0;
+f0107f02:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f0107f09:	00 00 00 
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f0107f0c:	e9 3e 01 00 00       	jmp    f010804f <pci_scan_bus+0x173>
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f0107f11:	83 ec 08             	sub    $0x8,%esp
+f0107f14:	89 fa                	mov    %edi,%edx
+f0107f16:	0f b6 fa             	movzbl %dl,%edi
+f0107f19:	57                   	push   %edi
+f0107f1a:	51                   	push   %ecx
+		PCI_CLASS(f->dev_class), PCI_SUBCLASS(f->dev_class), class,
+f0107f1b:	c1 e8 10             	shr    $0x10,%eax
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f0107f1e:	0f b6 c0             	movzbl %al,%eax
+f0107f21:	50                   	push   %eax
+f0107f22:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f0107f28:	c1 ee 10             	shr    $0x10,%esi
+f0107f2b:	56                   	push   %esi
+f0107f2c:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f0107f32:	53                   	push   %ebx
+f0107f33:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f0107f39:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f0107f3f:	ff 70 04             	push   0x4(%eax)
+f0107f42:	68 a4 b7 10 f0       	push   $0xf010b7a4
+f0107f47:	e8 31 c4 ff ff       	call   f010437d <cprintf>
+				 PCI_SUBCLASS(f->dev_class),
+f0107f4c:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f0107f52:	83 c4 24             	add    $0x24,%esp
+				 PCI_SUBCLASS(f->dev_class),
+f0107f55:	89 c2                	mov    %eax,%edx
+f0107f57:	c1 ea 10             	shr    $0x10,%edx
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f0107f5a:	0f b6 d2             	movzbl %dl,%edx
+f0107f5d:	c1 e8 18             	shr    $0x18,%eax
+f0107f60:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f0107f66:	51                   	push   %ecx
+f0107f67:	b9 40 64 11 f0       	mov    $0xf0116440,%ecx
+f0107f6c:	e8 31 fe ff ff       	call   f0107da2 <pci_attach_match>
+				 &pci_attach_class[0], f) ||
+f0107f71:	83 c4 10             	add    $0x10,%esp
+f0107f74:	85 c0                	test   %eax,%eax
+f0107f76:	0f 84 a3 00 00 00    	je     f010801f <pci_scan_bus+0x143>
+
+		totaldev++;
+
+		struct pci_func f = df;
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+		     f.func++) {
+f0107f7c:	83 c3 01             	add    $0x1,%ebx
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f0107f7f:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f0107f85:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f0107f8b:	39 c3                	cmp    %eax,%ebx
+f0107f8d:	0f 83 b6 00 00 00    	jae    f0108049 <pci_scan_bus+0x16d>
+			struct pci_func af = f;
+f0107f93:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f0107f99:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f0107f9f:	b9 12 00 00 00       	mov    $0x12,%ecx
+f0107fa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+			af.dev_id = pci_conf_read(&f, PCI_ID_REG);
+f0107fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107fab:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f0107fb1:	e8 01 ff ff ff       	call   f0107eb7 <pci_conf_read>
+f0107fb6:	89 c6                	mov    %eax,%esi
+f0107fb8:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+			if (PCI_VENDOR(af.dev_id) == 0xffff)
+f0107fbe:	0f b7 c0             	movzwl %ax,%eax
+f0107fc1:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f0107fc7:	66 83 fe ff          	cmp    $0xffff,%si
+f0107fcb:	74 af                	je     f0107f7c <pci_scan_bus+0xa0>
+				continue;
+
+			uint32_t intr = pci_conf_read(&af, PCI_INTERRUPT_REG);
+f0107fcd:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f0107fd2:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f0107fd8:	e8 da fe ff ff       	call   f0107eb7 <pci_conf_read>
+f0107fdd:	89 c7                	mov    %eax,%edi
+			af.irq_line = PCI_INTERRUPT_LINE(intr);
+f0107fdf:	88 45 9c             	mov    %al,-0x64(%ebp)
+
+			af.dev_class = pci_conf_read(&af, PCI_CLASS_REG);
+f0107fe2:	ba 08 00 00 00       	mov    $0x8,%edx
+f0107fe7:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f0107fed:	e8 c5 fe ff ff       	call   f0107eb7 <pci_conf_read>
+f0107ff2:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f0107ff8:	89 c2                	mov    %eax,%edx
+f0107ffa:	c1 ea 18             	shr    $0x18,%edx
+f0107ffd:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+	const char *class = pci_class[0];
+f0108003:	b9 5f b9 10 f0       	mov    $0xf010b95f,%ecx
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f0108008:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f010800d:	0f 87 fe fe ff ff    	ja     f0107f11 <pci_scan_bus+0x35>
+		class = pci_class[PCI_CLASS(f->dev_class)];
+f0108013:	8b 0c 95 d4 b9 10 f0 	mov    -0xfef462c(,%edx,4),%ecx
+f010801a:	e9 f2 fe ff ff       	jmp    f0107f11 <pci_scan_bus+0x35>
+				 PCI_PRODUCT(f->dev_id),
+f010801f:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+		pci_attach_match(PCI_VENDOR(f->dev_id),
+f0108025:	89 c2                	mov    %eax,%edx
+f0108027:	c1 ea 10             	shr    $0x10,%edx
+f010802a:	0f b7 c0             	movzwl %ax,%eax
+f010802d:	83 ec 0c             	sub    $0xc,%esp
+f0108030:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f0108036:	57                   	push   %edi
+f0108037:	b9 00 64 11 f0       	mov    $0xf0116400,%ecx
+f010803c:	e8 61 fd ff ff       	call   f0107da2 <pci_attach_match>
+f0108041:	83 c4 10             	add    $0x10,%esp
+f0108044:	e9 33 ff ff ff       	jmp    f0107f7c <pci_scan_bus+0xa0>
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f0108049:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010804c:	83 c0 01             	add    $0x1,%eax
+f010804f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0108052:	83 f8 1f             	cmp    $0x1f,%eax
+f0108055:	77 4b                	ja     f01080a2 <pci_scan_bus+0x1c6>
+		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
+f0108057:	ba 0c 00 00 00       	mov    $0xc,%edx
+f010805c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010805f:	e8 53 fe ff ff       	call   f0107eb7 <pci_conf_read>
+		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	    // Unsupported or no device
+f0108064:	89 c2                	mov    %eax,%edx
+f0108066:	c1 ea 10             	shr    $0x10,%edx
+f0108069:	89 d3                	mov    %edx,%ebx
+f010806b:	83 e3 7e             	and    $0x7e,%ebx
+f010806e:	75 d9                	jne    f0108049 <pci_scan_bus+0x16d>
+		totaldev++;
+f0108070:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+		struct pci_func f = df;
+f0108077:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f010807d:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f0108080:	b9 12 00 00 00       	mov    $0x12,%ecx
+f0108085:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f0108087:	25 00 00 80 00       	and    $0x800000,%eax
+f010808c:	83 f8 01             	cmp    $0x1,%eax
+f010808f:	19 c0                	sbb    %eax,%eax
+f0108091:	83 e0 f9             	and    $0xfffffff9,%eax
+f0108094:	83 c0 08             	add    $0x8,%eax
+f0108097:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f010809d:	e9 dd fe ff ff       	jmp    f0107f7f <pci_scan_bus+0xa3>
+			pci_attach(&af);
+		}
+	}
+
+	return totaldev;
+}
+f01080a2:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f01080a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01080ab:	5b                   	pop    %ebx
+f01080ac:	5e                   	pop    %esi
+f01080ad:	5f                   	pop    %edi
+f01080ae:	5d                   	pop    %ebp
+f01080af:	c3                   	ret
+
+f01080b0 <pci_bridge_attach>:
+
+static int
+pci_bridge_attach(struct pci_func *pcif)
+{
+f01080b0:	55                   	push   %ebp
+f01080b1:	89 e5                	mov    %esp,%ebp
+f01080b3:	57                   	push   %edi
+f01080b4:	56                   	push   %esi
+f01080b5:	53                   	push   %ebx
+f01080b6:	83 ec 1c             	sub    $0x1c,%esp
+f01080b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t ioreg  = pci_conf_read(pcif, PCI_BRIDGE_STATIO_REG);
+f01080bc:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f01080c1:	89 f0                	mov    %esi,%eax
+f01080c3:	e8 ef fd ff ff       	call   f0107eb7 <pci_conf_read>
+f01080c8:	89 c7                	mov    %eax,%edi
+	uint32_t busreg = pci_conf_read(pcif, PCI_BRIDGE_BUS_REG);
+f01080ca:	ba 18 00 00 00       	mov    $0x18,%edx
+f01080cf:	89 f0                	mov    %esi,%eax
+f01080d1:	e8 e1 fd ff ff       	call   f0107eb7 <pci_conf_read>
+
+	if (PCI_BRIDGE_IO_32BITS(ioreg)) {
+f01080d6:	83 e7 0f             	and    $0xf,%edi
+f01080d9:	83 ff 01             	cmp    $0x1,%edi
+f01080dc:	74 52                	je     f0108130 <pci_bridge_attach+0x80>
+f01080de:	89 c3                	mov    %eax,%ebx
+			pcif->bus->busno, pcif->dev, pcif->func);
+		return 0;
+	}
+
+	struct pci_bus nbus;
+	memset(&nbus, 0, sizeof(nbus));
+f01080e0:	83 ec 04             	sub    $0x4,%esp
+f01080e3:	6a 08                	push   $0x8
+f01080e5:	6a 00                	push   $0x0
+f01080e7:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f01080ea:	57                   	push   %edi
+f01080eb:	e8 55 ef ff ff       	call   f0107045 <memset>
+	nbus.parent_bridge = pcif;
+f01080f0:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	nbus.busno = (busreg >> PCI_BRIDGE_BUS_SECONDARY_SHIFT) & 0xff;
+f01080f3:	0f b6 c7             	movzbl %bh,%eax
+f01080f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (pci_show_devs)
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f01080f9:	83 c4 08             	add    $0x8,%esp
+			pcif->bus->busno, pcif->dev, pcif->func,
+			nbus.busno,
+			(busreg >> PCI_BRIDGE_BUS_SUBORDINATE_SHIFT) & 0xff);
+f01080fc:	c1 eb 10             	shr    $0x10,%ebx
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f01080ff:	0f b6 db             	movzbl %bl,%ebx
+f0108102:	53                   	push   %ebx
+f0108103:	50                   	push   %eax
+f0108104:	ff 76 08             	push   0x8(%esi)
+f0108107:	ff 76 04             	push   0x4(%esi)
+f010810a:	8b 06                	mov    (%esi),%eax
+f010810c:	ff 70 04             	push   0x4(%eax)
+f010810f:	68 14 b8 10 f0       	push   $0xf010b814
+f0108114:	e8 64 c2 ff ff       	call   f010437d <cprintf>
+
+	pci_scan_bus(&nbus);
+f0108119:	83 c4 20             	add    $0x20,%esp
+f010811c:	89 f8                	mov    %edi,%eax
+f010811e:	e8 b9 fd ff ff       	call   f0107edc <pci_scan_bus>
+	return 1;
+f0108123:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0108128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010812b:	5b                   	pop    %ebx
+f010812c:	5e                   	pop    %esi
+f010812d:	5f                   	pop    %edi
+f010812e:	5d                   	pop    %ebp
+f010812f:	c3                   	ret
+		cprintf("PCI: %02x:%02x.%d: 32-bit bridge IO not supported.\n",
+f0108130:	ff 76 08             	push   0x8(%esi)
+f0108133:	ff 76 04             	push   0x4(%esi)
+f0108136:	8b 06                	mov    (%esi),%eax
+f0108138:	ff 70 04             	push   0x4(%eax)
+f010813b:	68 e0 b7 10 f0       	push   $0xf010b7e0
+f0108140:	e8 38 c2 ff ff       	call   f010437d <cprintf>
+		return 0;
+f0108145:	83 c4 10             	add    $0x10,%esp
+f0108148:	b8 00 00 00 00       	mov    $0x0,%eax
+f010814d:	eb d9                	jmp    f0108128 <pci_bridge_attach+0x78>
+
+f010814f <pci_conf_write>:
+{
+f010814f:	55                   	push   %ebp
+f0108150:	89 e5                	mov    %esp,%ebp
+f0108152:	57                   	push   %edi
+f0108153:	56                   	push   %esi
+f0108154:	53                   	push   %ebx
+f0108155:	83 ec 18             	sub    $0x18,%esp
+f0108158:	89 d7                	mov    %edx,%edi
+f010815a:	89 ce                	mov    %ecx,%esi
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010815c:	8b 48 08             	mov    0x8(%eax),%ecx
+f010815f:	8b 50 04             	mov    0x4(%eax),%edx
+f0108162:	8b 00                	mov    (%eax),%eax
+f0108164:	8b 40 04             	mov    0x4(%eax),%eax
+f0108167:	57                   	push   %edi
+f0108168:	e8 92 fc ff ff       	call   f0107dff <pci_conf1_set_addr>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010816d:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f0108172:	89 f0                	mov    %esi,%eax
+f0108174:	ef                   	out    %eax,(%dx)
+}
+f0108175:	83 c4 10             	add    $0x10,%esp
+f0108178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010817b:	5b                   	pop    %ebx
+f010817c:	5e                   	pop    %esi
+f010817d:	5f                   	pop    %edi
+f010817e:	5d                   	pop    %ebp
+f010817f:	c3                   	ret
+
+f0108180 <pci_storage_get>:
+
+// Fill *pd with the i'th mass storage function found at boot.
+// Returns 0, or -1 if there are not that many.
+int
+pci_storage_get(int i, struct PciDev *pd)
+{
+f0108180:	55                   	push   %ebp
+f0108181:	89 e5                	mov    %esp,%ebp
+f0108183:	57                   	push   %edi
+f0108184:	56                   	push   %esi
+f0108185:	53                   	push   %ebx
+f0108186:	83 ec 1c             	sub    $0x1c,%esp
+f0108189:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010818c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct pci_func *f;
+
+	if (i < 0 || i >= npci_storage)
+f010818f:	85 db                	test   %ebx,%ebx
+f0108191:	78 75                	js     f0108208 <pci_storage_get+0x88>
+f0108193:	39 1d 00 60 a4 f0    	cmp    %ebx,0xf0a46000
+f0108199:	7e 74                	jle    f010820f <pci_storage_get+0x8f>
+		return -1;
+	f = &pci_storage[i];
+	pd->pd_id = f->dev_id;
+f010819b:	8d 3c dd 00 00 00 00 	lea    0x0(,%ebx,8),%edi
+f01081a2:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+f01081a5:	8d 04 c5 20 60 a4 f0 	lea    -0xf5b9fe0(,%eax,8),%eax
+f01081ac:	8b 50 0c             	mov    0xc(%eax),%edx
+f01081af:	89 16                	mov    %edx,(%esi)
+	pd->pd_class = f->dev_class;
+f01081b1:	8b 40 10             	mov    0x10(%eax),%eax
+f01081b4:	89 46 04             	mov    %eax,0x4(%esi)
+	memmove(pd->pd_base, f->reg_base, sizeof pd->pd_base);
+f01081b7:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+f01081ba:	c1 e0 03             	shl    $0x3,%eax
+f01081bd:	83 ec 04             	sub    $0x4,%esp
+f01081c0:	6a 18                	push   $0x18
+f01081c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01081c5:	05 34 60 a4 f0       	add    $0xf0a46034,%eax
+f01081ca:	50                   	push   %eax
+f01081cb:	8d 46 08             	lea    0x8(%esi),%eax
+f01081ce:	50                   	push   %eax
+f01081cf:	e8 a6 ee ff ff       	call   f010707a <memmove>
+	memmove(pd->pd_size, f->reg_size, sizeof pd->pd_size);
+f01081d4:	83 c4 0c             	add    $0xc,%esp
+f01081d7:	6a 18                	push   $0x18
+f01081d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01081dc:	05 4c 60 a4 f0       	add    $0xf0a4604c,%eax
+f01081e1:	50                   	push   %eax
+f01081e2:	8d 46 20             	lea    0x20(%esi),%eax
+f01081e5:	50                   	push   %eax
+f01081e6:	e8 8f ee ff ff       	call   f010707a <memmove>
+	pd->pd_irq = f->irq_line;
+f01081eb:	01 df                	add    %ebx,%edi
+f01081ed:	0f b6 04 fd 64 60 a4 	movzbl -0xf5b9f9c(,%edi,8),%eax
+f01081f4:	f0 
+f01081f5:	88 46 38             	mov    %al,0x38(%esi)
+	return 0;
+f01081f8:	83 c4 10             	add    $0x10,%esp
+f01081fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108203:	5b                   	pop    %ebx
+f0108204:	5e                   	pop    %esi
+f0108205:	5f                   	pop    %edi
+f0108206:	5d                   	pop    %ebp
+f0108207:	c3                   	ret
+		return -1;
+f0108208:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010820d:	eb f1                	jmp    f0108200 <pci_storage_get+0x80>
+f010820f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0108214:	eb ea                	jmp    f0108200 <pci_storage_get+0x80>
+
+f0108216 <pci_dma_alloc>:
+
+// Take npages physically contiguous, zeroed pages from the DMA pool.
+// Returns the first page, or NULL if the pool is used up.
+struct PageInfo*
+pci_dma_alloc(size_t npages)
+{
+f0108216:	55                   	push   %ebp
+f0108217:	89 e5                	mov    %esp,%ebp
+f0108219:	53                   	push   %ebx
+f010821a:	83 ec 04             	sub    $0x4,%esp
+f010821d:	8b 45 08             	mov    0x8(%ebp),%eax
+	uint8_t *va;
+
+	if (npages > NPCIDMA - npci_dma)
+f0108220:	8b 15 08 50 a2 f0    	mov    0xf0a25008,%edx
+f0108226:	b9 20 00 00 00       	mov    $0x20,%ecx
+f010822b:	29 d1                	sub    %edx,%ecx
+f010822d:	39 c1                	cmp    %eax,%ecx
+f010822f:	72 74                	jb     f01082a5 <pci_dma_alloc+0x8f>
+		return NULL;
+	va = pci_dma_pool + npci_dma * PGSIZE;
+f0108231:	89 d3                	mov    %edx,%ebx
+f0108233:	c1 e3 0c             	shl    $0xc,%ebx
+f0108236:	81 c3 00 60 a2 f0    	add    $0xf0a26000,%ebx
+	npci_dma += npages;
+f010823c:	01 c2                	add    %eax,%edx
+f010823e:	89 15 08 50 a2 f0    	mov    %edx,0xf0a25008
+	memset(va, 0, npages * PGSIZE);
+f0108244:	83 ec 04             	sub    $0x4,%esp
+f0108247:	c1 e0 0c             	shl    $0xc,%eax
+f010824a:	50                   	push   %eax
+f010824b:	6a 00                	push   $0x0
+f010824d:	53                   	push   %ebx
+f010824e:	e8 f2 ed ff ff       	call   f0107045 <memset>
+	if ((uint32_t)kva < KERNBASE)
+f0108253:	83 c4 10             	add    $0x10,%esp
+f0108256:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f010825c:	76 1e                	jbe    f010827c <pci_dma_alloc+0x66>
+	return (physaddr_t)kva - KERNBASE;
+f010825e:	81 c3 00 00 00 10    	add    $0x10000000,%ebx
+	if (PGNUM(pa) >= npages)
+f0108264:	c1 eb 0c             	shr    $0xc,%ebx
+f0108267:	3b 1d 98 62 a4 f0    	cmp    0xf0a46298,%ebx
+f010826d:	73 22                	jae    f0108291 <pci_dma_alloc+0x7b>
+	return &pages[PGNUM(pa)];
+f010826f:	a1 a0 62 a4 f0       	mov    0xf0a462a0,%eax
+f0108274:	8d 04 d8             	lea    (%eax,%ebx,8),%eax
+	return pa2page(PADDR(va));
+}
+f0108277:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010827a:	c9                   	leave
+f010827b:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010827c:	53                   	push   %ebx
+f010827d:	68 48 8e 10 f0       	push   $0xf0108e48
+f0108282:	68 fa 00 00 00       	push   $0xfa
+f0108287:	68 21 b9 10 f0       	push   $0xf010b921
+f010828c:	e8 af 7d ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0108291:	83 ec 04             	sub    $0x4,%esp
+f0108294:	68 1c 96 10 f0       	push   $0xf010961c
+f0108299:	6a 54                	push   $0x54
+f010829b:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01082a0:	e8 9b 7d ff ff       	call   f0100040 <_panic>
+		return NULL;
+f01082a5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01082aa:	eb cb                	jmp    f0108277 <pci_dma_alloc+0x61>
+
+f01082ac <pci_func_enable>:
+
+void
+pci_func_enable(struct pci_func *f)
+{
+f01082ac:	55                   	push   %ebp
+f01082ad:	89 e5                	mov    %esp,%ebp
+f01082af:	57                   	push   %edi
+f01082b0:	56                   	push   %esi
+f01082b1:	53                   	push   %ebx
+f01082b2:	83 ec 1c             	sub    $0x1c,%esp
+f01082b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pci_conf_write(f, PCI_COMMAND_STATUS_REG,
+f01082b8:	b9 07 00 00 00       	mov    $0x7,%ecx
+f01082bd:	ba 04 00 00 00       	mov    $0x4,%edx
+f01082c2:	89 f8                	mov    %edi,%eax
+f01082c4:	e8 86 fe ff ff       	call   f010814f <pci_conf_write>
+		       PCI_COMMAND_MEM_ENABLE |
+		       PCI_COMMAND_MASTER_ENABLE);
+
+	uint32_t bar_width;
+	uint32_t bar;
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f01082c9:	be 10 00 00 00       	mov    $0x10,%esi
+f01082ce:	eb 3f                	jmp    f010830f <pci_func_enable+0x63>
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+			if (pci_show_addrs)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		} else {
+			size = PCI_MAPREG_IO_SIZE(rv);
+f01082d0:	89 c2                	mov    %eax,%edx
+f01082d2:	83 e2 fc             	and    $0xfffffffc,%edx
+f01082d5:	f7 da                	neg    %edx
+f01082d7:	21 c2                	and    %eax,%edx
+f01082d9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+			base = PCI_MAPREG_IO_ADDR(oldv);
+f01082dc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01082df:	83 e1 fc             	and    $0xfffffffc,%ecx
+f01082e2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+			if (pci_show_addrs)
+				cprintf("  io region %d: %d bytes at 0x%x\n",
+f01082e5:	51                   	push   %ecx
+f01082e6:	52                   	push   %edx
+f01082e7:	53                   	push   %ebx
+f01082e8:	68 68 b8 10 f0       	push   $0xf010b868
+f01082ed:	e8 8b c0 ff ff       	call   f010437d <cprintf>
+f01082f2:	83 c4 10             	add    $0x10,%esp
+		bar_width = 4;
+f01082f5:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f01082fc:	e9 85 00 00 00       	jmp    f0108386 <pci_func_enable+0xda>
+	     bar += bar_width)
+f0108301:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108304:	01 c6                	add    %eax,%esi
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f0108306:	83 fe 27             	cmp    $0x27,%esi
+f0108309:	0f 87 d2 00 00 00    	ja     f01083e1 <pci_func_enable+0x135>
+		uint32_t oldv = pci_conf_read(f, bar);
+f010830f:	89 f2                	mov    %esi,%edx
+f0108311:	89 f8                	mov    %edi,%eax
+f0108313:	e8 9f fb ff ff       	call   f0107eb7 <pci_conf_read>
+f0108318:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		pci_conf_write(f, bar, 0xffffffff);
+f010831b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f0108320:	89 f2                	mov    %esi,%edx
+f0108322:	89 f8                	mov    %edi,%eax
+f0108324:	e8 26 fe ff ff       	call   f010814f <pci_conf_write>
+		uint32_t rv = pci_conf_read(f, bar);
+f0108329:	89 f2                	mov    %esi,%edx
+f010832b:	89 f8                	mov    %edi,%eax
+f010832d:	e8 85 fb ff ff       	call   f0107eb7 <pci_conf_read>
+		bar_width = 4;
+f0108332:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+		if (rv == 0)
+f0108339:	85 c0                	test   %eax,%eax
+f010833b:	74 c4                	je     f0108301 <pci_func_enable+0x55>
+		int regnum = PCI_MAPREG_NUM(bar);
+f010833d:	8d 56 f0             	lea    -0x10(%esi),%edx
+f0108340:	89 d3                	mov    %edx,%ebx
+f0108342:	c1 eb 02             	shr    $0x2,%ebx
+		if (PCI_MAPREG_TYPE(rv) == PCI_MAPREG_TYPE_MEM) {
+f0108345:	a8 01                	test   $0x1,%al
+f0108347:	75 87                	jne    f01082d0 <pci_func_enable+0x24>
+			if (PCI_MAPREG_MEM_TYPE(rv) == PCI_MAPREG_MEM_TYPE_64BIT)
+f0108349:	89 c2                	mov    %eax,%edx
+f010834b:	83 e2 06             	and    $0x6,%edx
+		bar_width = 4;
+f010834e:	83 fa 04             	cmp    $0x4,%edx
+f0108351:	0f 94 c1             	sete   %cl
+f0108354:	0f b6 c9             	movzbl %cl,%ecx
+f0108357:	8d 0c 8d 04 00 00 00 	lea    0x4(,%ecx,4),%ecx
+f010835e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+			size = PCI_MAPREG_MEM_SIZE(rv);
+f0108361:	89 c2                	mov    %eax,%edx
+f0108363:	83 e2 f0             	and    $0xfffffff0,%edx
+f0108366:	f7 da                	neg    %edx
+f0108368:	21 c2                	and    %eax,%edx
+f010836a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+f010836d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108370:	83 e0 f0             	and    $0xfffffff0,%eax
+f0108373:	89 45 d8             	mov    %eax,-0x28(%ebp)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+f0108376:	50                   	push   %eax
+f0108377:	52                   	push   %edx
+f0108378:	53                   	push   %ebx
+f0108379:	68 44 b8 10 f0       	push   $0xf010b844
+f010837e:	e8 fa bf ff ff       	call   f010437d <cprintf>
+f0108383:	83 c4 10             	add    $0x10,%esp
+					regnum, size, base);
+		}
+
+		pci_conf_write(f, bar, oldv);
+f0108386:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0108389:	89 f2                	mov    %esi,%edx
+f010838b:	89 f8                	mov    %edi,%eax
+f010838d:	e8 bd fd ff ff       	call   f010814f <pci_conf_write>
+		f->reg_base[regnum] = base;
+f0108392:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0108395:	89 44 9f 14          	mov    %eax,0x14(%edi,%ebx,4)
+		f->reg_size[regnum] = size;
+f0108399:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010839c:	89 4c 9f 2c          	mov    %ecx,0x2c(%edi,%ebx,4)
+
+		if (size && !base)
+f01083a0:	85 c9                	test   %ecx,%ecx
+f01083a2:	0f 84 59 ff ff ff    	je     f0108301 <pci_func_enable+0x55>
+f01083a8:	85 c0                	test   %eax,%eax
+f01083aa:	0f 85 51 ff ff ff    	jne    f0108301 <pci_func_enable+0x55>
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+				"may be misconfigured: "
+				"region %d: base 0x%x, size %d\n",
+				f->bus->busno, f->dev, f->func,
+				PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id),
+f01083b0:	8b 47 0c             	mov    0xc(%edi),%eax
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+f01083b3:	83 ec 0c             	sub    $0xc,%esp
+f01083b6:	51                   	push   %ecx
+f01083b7:	6a 00                	push   $0x0
+f01083b9:	53                   	push   %ebx
+f01083ba:	89 c2                	mov    %eax,%edx
+f01083bc:	c1 ea 10             	shr    $0x10,%edx
+f01083bf:	52                   	push   %edx
+f01083c0:	0f b7 c0             	movzwl %ax,%eax
+f01083c3:	50                   	push   %eax
+f01083c4:	ff 77 08             	push   0x8(%edi)
+f01083c7:	ff 77 04             	push   0x4(%edi)
+f01083ca:	8b 07                	mov    (%edi),%eax
+f01083cc:	ff 70 04             	push   0x4(%eax)
+f01083cf:	68 8c b8 10 f0       	push   $0xf010b88c
+f01083d4:	e8 a4 bf ff ff       	call   f010437d <cprintf>
+f01083d9:	83 c4 30             	add    $0x30,%esp
+f01083dc:	e9 20 ff ff ff       	jmp    f0108301 <pci_func_enable+0x55>
+				regnum, base, size);
+	}
+
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+		f->bus->busno, f->dev, f->func,
+		PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id));
+f01083e1:	8b 47 0c             	mov    0xc(%edi),%eax
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+f01083e4:	83 ec 08             	sub    $0x8,%esp
+f01083e7:	89 c2                	mov    %eax,%edx
+f01083e9:	c1 ea 10             	shr    $0x10,%edx
+f01083ec:	52                   	push   %edx
+f01083ed:	0f b7 c0             	movzwl %ax,%eax
+f01083f0:	50                   	push   %eax
+f01083f1:	ff 77 08             	push   0x8(%edi)
+f01083f4:	ff 77 04             	push   0x4(%edi)
+f01083f7:	8b 07                	mov    (%edi),%eax
+f01083f9:	ff 70 04             	push   0x4(%eax)
+f01083fc:	68 e8 b8 10 f0       	push   $0xf010b8e8
+f0108401:	e8 77 bf ff ff       	call   f010437d <cprintf>
+}
+f0108406:	83 c4 20             	add    $0x20,%esp
+f0108409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010840c:	5b                   	pop    %ebx
+f010840d:	5e                   	pop    %esi
+f010840e:	5f                   	pop    %edi
+f010840f:	5d                   	pop    %ebp
+f0108410:	c3                   	ret
+
+f0108411 <pci_storage_attach>:
+{
+f0108411:	55                   	push   %ebp
+f0108412:	89 e5                	mov    %esp,%ebp
+f0108414:	57                   	push   %edi
+f0108415:	56                   	push   %esi
+f0108416:	8b 75 08             	mov    0x8(%ebp),%esi
+		return 0;
+f0108419:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (npci_storage == NPCISTORAGE)
+f010841e:	83 3d 00 60 a4 f0 04 	cmpl   $0x4,0xf0a46000
+f0108425:	74 32                	je     f0108459 <pci_storage_attach+0x48>
+	pci_func_enable(pcif);
+f0108427:	83 ec 0c             	sub    $0xc,%esp
+f010842a:	56                   	push   %esi
+f010842b:	e8 7c fe ff ff       	call   f01082ac <pci_func_enable>
+	pci_storage[npci_storage++] = *pcif;
+f0108430:	a1 00 60 a4 f0       	mov    0xf0a46000,%eax
+f0108435:	8d 50 01             	lea    0x1(%eax),%edx
+f0108438:	89 15 00 60 a4 f0    	mov    %edx,0xf0a46000
+f010843e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+f0108441:	8d 04 c5 20 60 a4 f0 	lea    -0xf5b9fe0(,%eax,8),%eax
+f0108448:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010844d:	89 c7                	mov    %eax,%edi
+f010844f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	return 1;
+f0108451:	83 c4 10             	add    $0x10,%esp
+f0108454:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0108459:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010845c:	5e                   	pop    %esi
+f010845d:	5f                   	pop    %edi
+f010845e:	5d                   	pop    %ebp
+f010845f:	c3                   	ret
+
+f0108460 <pci_init>:
+
+int
+pci_init(void)
+{
+f0108460:	55                   	push   %ebp
+f0108461:	89 e5                	mov    %esp,%ebp
+f0108463:	83 ec 0c             	sub    $0xc,%esp
+	static struct pci_bus root_bus;
+	memset(&root_bus, 0, sizeof(root_bus));
+f0108466:	6a 08                	push   $0x8
+f0108468:	6a 00                	push   $0x0
+f010846a:	68 00 50 a2 f0       	push   $0xf0a25000
+f010846f:	e8 d1 eb ff ff       	call   f0107045 <memset>
+
+	return pci_scan_bus(&root_bus);
+f0108474:	b8 00 50 a2 f0       	mov    $0xf0a25000,%eax
+f0108479:	e8 5e fa ff ff       	call   f0107edc <pci_scan_bus>
+}
+f010847e:	c9                   	leave
+f010847f:	c3                   	ret
+
+f0108480 <time_init>:
+static unsigned int ticks;
+
+void
+time_init(void)
+{
+	ticks = 0;
+f0108480:	c7 05 40 61 a4 f0 00 	movl   $0x0,0xf0a46140
+f0108487:	00 00 00 
+}
+f010848a:	c3                   	ret
+
+f010848b <time_tick>:
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+	ticks++;
+f010848b:	a1 40 61 a4 f0       	mov    0xf0a46140,%eax
+f0108490:	83 c0 01             	add    $0x1,%eax
+f0108493:	a3 40 61 a4 f0       	mov    %eax,0xf0a46140
+	if (ticks * 10 < ticks)
+f0108498:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f010849b:	01 d2                	add    %edx,%edx
+f010849d:	39 c2                	cmp    %eax,%edx
+f010849f:	72 01                	jb     f01084a2 <time_tick+0x17>
+f01084a1:	c3                   	ret
+{
+f01084a2:	55                   	push   %ebp
+f01084a3:	89 e5                	mov    %esp,%ebp
+f01084a5:	83 ec 0c             	sub    $0xc,%esp
+		panic("time_tick: time overflowed");
+f01084a8:	68 f0 b9 10 f0       	push   $0xf010b9f0
+f01084ad:	6a 13                	push   $0x13
+f01084af:	68 0b ba 10 f0       	push   $0xf010ba0b
+f01084b4:	e8 87 7b ff ff       	call   f0100040 <_panic>
+
+f01084b9 <time_msec>:
+}
+
+unsigned int
+time_msec(void)
+{
+	return ticks * 10;
+f01084b9:	a1 40 61 a4 f0       	mov    0xf0a46140,%eax
+f01084be:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01084c1:	01 c0                	add    %eax,%eax
+}
+f01084c3:	c3                   	ret
+
+f01084c4 <futex_wake_key>:
+}
+
+// Wake up to n envs sleeping on the word with key 'key'.
+static int
+futex_wake_key(physaddr_t key, int n)
+{
+f01084c4:	55                   	push   %ebp
+f01084c5:	89 e5                	mov    %esp,%ebp
+f01084c7:	57                   	push   %edi
+f01084c8:	56                   	push   %esi
+f01084c9:	53                   	push   %ebx
+f01084ca:	89 c3                	mov    %eax,%ebx
+	int i, woken;
+
+	woken = 0;
+	for (i = 0; i < NENV && woken < n; i++) {
+f01084cc:	a1 48 42 a2 f0       	mov    0xf0a24248,%eax
+f01084d1:	83 c0 1c             	add    $0x1c,%eax
+	woken = 0;
+f01084d4:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < NENV && woken < n; i++) {
+f01084d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01084de:	eb 08                	jmp    f01084e8 <futex_wake_key+0x24>
+f01084e0:	83 c1 01             	add    $0x1,%ecx
+f01084e3:	05 90 00 00 00       	add    $0x90,%eax
+f01084e8:	81 f9 ff 03 00 00    	cmp    $0x3ff,%ecx
+f01084ee:	7f 32                	jg     f0108522 <futex_wake_key+0x5e>
+f01084f0:	39 d6                	cmp    %edx,%esi
+f01084f2:	7d 2e                	jge    f0108522 <futex_wake_key+0x5e>
+		if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+f01084f4:	83 78 38 04          	cmpl   $0x4,0x38(%eax)
+f01084f8:	75 e6                	jne    f01084e0 <futex_wake_key+0x1c>
+f01084fa:	80 78 64 00          	cmpb   $0x0,0x64(%eax)
+f01084fe:	74 e0                	je     f01084e0 <futex_wake_key+0x1c>
+		    envs[i].env_futex_waiting &&
+f0108500:	39 58 68             	cmp    %ebx,0x68(%eax)
+f0108503:	75 db                	jne    f01084e0 <futex_wake_key+0x1c>
+	e->env_futex_waiting = 0;
+f0108505:	c6 40 64 00          	movb   $0x0,0x64(%eax)
+	e->env_futex_deadline = 0;
+f0108509:	c7 40 6c 00 00 00 00 	movl   $0x0,0x6c(%eax)
+	e->env_tf.tf_regs.reg_eax = ret;
+f0108510:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	e->env_status = ENV_RUNNABLE;
+f0108516:	c7 40 38 02 00 00 00 	movl   $0x2,0x38(%eax)
+		    envs[i].env_futex_key == key) {
+			futex_wakeup(&envs[i], 0);
+			woken++;
+f010851d:	83 c6 01             	add    $0x1,%esi
+f0108520:	eb be                	jmp    f01084e0 <futex_wake_key+0x1c>
+		}
+	}
+	return woken;
+}
+f0108522:	89 f0                	mov    %esi,%eax
+f0108524:	5b                   	pop    %ebx
+f0108525:	5e                   	pop    %esi
+f0108526:	5f                   	pop    %edi
+f0108527:	5d                   	pop    %ebp
+f0108528:	c3                   	ret
+
+f0108529 <futex_key>:
+	if ((uintptr_t) va % sizeof(uint32_t) || (uintptr_t) va >= UTOP)
+f0108529:	f6 c2 03             	test   $0x3,%dl
+f010852c:	75 6a                	jne    f0108598 <futex_key+0x6f>
+{
+f010852e:	55                   	push   %ebp
+f010852f:	89 e5                	mov    %esp,%ebp
+f0108531:	56                   	push   %esi
+f0108532:	53                   	push   %ebx
+f0108533:	83 ec 10             	sub    $0x10,%esp
+f0108536:	89 d3                	mov    %edx,%ebx
+f0108538:	89 ce                	mov    %ecx,%esi
+	if ((uintptr_t) va % sizeof(uint32_t) || (uintptr_t) va >= UTOP)
+f010853a:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0108540:	77 41                	ja     f0108583 <futex_key+0x5a>
+	pp = page_lookup(e->env_pgdir, (void *) va, &pte);
+f0108542:	83 ec 04             	sub    $0x4,%esp
+f0108545:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0108548:	52                   	push   %edx
+f0108549:	53                   	push   %ebx
+f010854a:	ff 70 60             	push   0x60(%eax)
+f010854d:	e8 91 92 ff ff       	call   f01017e3 <page_lookup>
+	if (!pp || !(*pte & PTE_U))
+f0108552:	83 c4 10             	add    $0x10,%esp
+f0108555:	85 c0                	test   %eax,%eax
+f0108557:	74 31                	je     f010858a <futex_key+0x61>
+f0108559:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010855c:	f6 02 04             	testb  $0x4,(%edx)
+f010855f:	74 30                	je     f0108591 <futex_key+0x68>
+	return (pp - pages) << PGSHIFT;
+f0108561:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0108567:	c1 f8 03             	sar    $0x3,%eax
+f010856a:	c1 e0 0c             	shl    $0xc,%eax
+	*key = page2pa(pp) + PGOFF(va);
+f010856d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f0108573:	01 d8                	add    %ebx,%eax
+f0108575:	89 06                	mov    %eax,(%esi)
+	return 0;
+f0108577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010857c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010857f:	5b                   	pop    %ebx
+f0108580:	5e                   	pop    %esi
+f0108581:	5d                   	pop    %ebp
+f0108582:	c3                   	ret
+		return -E_INVAL;
+f0108583:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108588:	eb f2                	jmp    f010857c <futex_key+0x53>
+		return -E_INVAL;
+f010858a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010858f:	eb eb                	jmp    f010857c <futex_key+0x53>
+f0108591:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108596:	eb e4                	jmp    f010857c <futex_key+0x53>
+		return -E_INVAL;
+f0108598:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010859d:	c3                   	ret
+
+f010859e <futex_wait>:
+{
+f010859e:	55                   	push   %ebp
+f010859f:	89 e5                	mov    %esp,%ebp
+f01085a1:	56                   	push   %esi
+f01085a2:	53                   	push   %ebx
+f01085a3:	83 ec 10             	sub    $0x10,%esp
+f01085a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct Env *e = curenv;
+f01085a9:	e8 8d f0 ff ff       	call   f010763b <cpunum>
+f01085ae:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01085b1:	8b b0 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%esi
+	if ((r = futex_key(e, va, &key)) < 0)
+f01085b7:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+f01085ba:	89 da                	mov    %ebx,%edx
+f01085bc:	89 f0                	mov    %esi,%eax
+f01085be:	e8 66 ff ff ff       	call   f0108529 <futex_key>
+f01085c3:	85 c0                	test   %eax,%eax
+f01085c5:	78 0c                	js     f01085d3 <futex_wait+0x35>
+	if (*va != val)
+f01085c7:	8b 03                	mov    (%ebx),%eax
+f01085c9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01085cc:	74 0c                	je     f01085da <futex_wait+0x3c>
+		return -E_AGAIN;
+f01085ce:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+f01085d3:	83 c4 10             	add    $0x10,%esp
+f01085d6:	5b                   	pop    %ebx
+f01085d7:	5e                   	pop    %esi
+f01085d8:	5d                   	pop    %ebp
+f01085d9:	c3                   	ret
+	e->env_futex_waiting = 1;
+f01085da:	c6 86 80 00 00 00 01 	movb   $0x1,0x80(%esi)
+	e->env_futex_key = key;
+f01085e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01085e4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	e->env_futex_deadline = 0;
+f01085ea:	c7 86 88 00 00 00 00 	movl   $0x0,0x88(%esi)
+f01085f1:	00 00 00 
+	if (timeout) {
+f01085f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01085f8:	75 13                	jne    f010860d <futex_wait+0x6f>
+	e->env_status = ENV_NOT_RUNNABLE;
+f01085fa:	c7 46 54 04 00 00 00 	movl   $0x4,0x54(%esi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f0108601:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	sched_yield();
+f0108608:	e8 e6 cc ff ff       	call   f01052f3 <sched_yield>
+		e->env_futex_deadline = time_msec() + timeout;
+f010860d:	e8 a7 fe ff ff       	call   f01084b9 <time_msec>
+f0108612:	03 45 10             	add    0x10(%ebp),%eax
+f0108615:	ba 01 00 00 00       	mov    $0x1,%edx
+f010861a:	0f 44 c2             	cmove  %edx,%eax
+f010861d:	89 86 88 00 00 00    	mov    %eax,0x88(%esi)
+		nfutex_timed++;
+f0108623:	83 05 20 62 a4 f0 01 	addl   $0x1,0xf0a46220
+f010862a:	eb ce                	jmp    f01085fa <futex_wait+0x5c>
+
+f010862c <futex_wake>:
+
+// Wake up to n envs sleeping on the word at va.
+// Returns the number of envs woken, or -E_INVAL for a bad va.
+int
+futex_wake(const volatile uint32_t *va, int n)
+{
+f010862c:	55                   	push   %ebp
+f010862d:	89 e5                	mov    %esp,%ebp
+f010862f:	83 ec 18             	sub    $0x18,%esp
+	physaddr_t key;
+	int r;
+
+	if ((r = futex_key(curenv, va, &key)) < 0)
+f0108632:	e8 04 f0 ff ff       	call   f010763b <cpunum>
+f0108637:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010863a:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108640:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+f0108643:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108646:	e8 de fe ff ff       	call   f0108529 <futex_key>
+f010864b:	85 c0                	test   %eax,%eax
+f010864d:	78 0b                	js     f010865a <futex_wake+0x2e>
+		return r;
+	return futex_wake_key(key, n);
+f010864f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108652:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0108655:	e8 6a fe ff ff       	call   f01084c4 <futex_wake_key>
+}
+f010865a:	c9                   	leave
+f010865b:	c3                   	ret
+
+f010865c <futex_irq_listen>:
+//	-E_INVAL if irq is out of range or va is bad.
+//	-E_BAD_ENV if curenv is not the file server, or another live
+//		address space already listens to irq.
+int
+futex_irq_listen(int irq, volatile uint32_t *va)
+{
+f010865c:	55                   	push   %ebp
+f010865d:	89 e5                	mov    %esp,%ebp
+f010865f:	57                   	push   %edi
+f0108660:	56                   	push   %esi
+f0108661:	53                   	push   %ebx
+f0108662:	83 ec 1c             	sub    $0x1c,%esp
+f0108665:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct IrqListener *l;
+	struct PageInfo *pp;
+	physaddr_t key;
+	int r;
+
+	if (irq < 8 || irq >= MAX_IRQS)
+f0108668:	8d 43 f8             	lea    -0x8(%ebx),%eax
+f010866b:	83 f8 07             	cmp    $0x7,%eax
+f010866e:	0f 87 5c 01 00 00    	ja     f01087d0 <futex_irq_listen+0x174>
+		return -E_INVAL;
+	if (curenv->env_type != ENV_TYPE_FS)
+f0108674:	e8 c2 ef ff ff       	call   f010763b <cpunum>
+f0108679:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f010867c:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108682:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0108686:	0f 85 4e 01 00 00    	jne    f01087da <futex_irq_listen+0x17e>
+		return -E_BAD_ENV;
+	if ((r = futex_key(curenv, va, &key)) < 0)
+f010868c:	e8 aa ef ff ff       	call   f010763b <cpunum>
+f0108691:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108694:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f010869a:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+f010869d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01086a0:	e8 84 fe ff ff       	call   f0108529 <futex_key>
+f01086a5:	85 c0                	test   %eax,%eax
+f01086a7:	0f 88 a8 00 00 00    	js     f0108755 <futex_irq_listen+0xf9>
+		return r;
+	l = &irq_listeners[irq];
+	if (l->il_env && envs[ENVX(l->il_env)].env_id == l->il_env
+f01086ad:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01086b0:	8b 14 85 60 61 a4 f0 	mov    -0xf5b9ea0(,%eax,4),%edx
+f01086b7:	85 d2                	test   %edx,%edx
+f01086b9:	74 1c                	je     f01086d7 <futex_irq_listen+0x7b>
+f01086bb:	89 d0                	mov    %edx,%eax
+f01086bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01086c2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+f01086c5:	c1 e0 04             	shl    $0x4,%eax
+f01086c8:	03 05 48 42 a2 f0    	add    0xf0a24248,%eax
+f01086ce:	3b 50 48             	cmp    0x48(%eax),%edx
+f01086d1:	0f 84 86 00 00 00    	je     f010875d <futex_irq_listen+0x101>
+			return 0;
+		}
+	}
+
+	// Pin the page so the word outlives any unmapping.
+	pp = pa2page(key);
+f01086d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (PGNUM(pa) >= npages)
+f01086da:	89 f8                	mov    %edi,%eax
+f01086dc:	c1 e8 0c             	shr    $0xc,%eax
+f01086df:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f01086e5:	0f 83 ba 00 00 00    	jae    f01087a5 <futex_irq_listen+0x149>
+	return &pages[PGNUM(pa)];
+f01086eb:	8b 15 a0 62 a4 f0    	mov    0xf0a462a0,%edx
+f01086f1:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+	pp->pp_ref++;
+f01086f4:	66 83 46 04 01       	addw   $0x1,0x4(%esi)
+	if (l->il_env)
+f01086f9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01086fc:	83 3c 85 60 61 a4 f0 	cmpl   $0x0,-0xf5b9ea0(,%eax,4)
+f0108703:	00 
+f0108704:	0f 85 af 00 00 00    	jne    f01087b9 <futex_irq_listen+0x15d>
+		page_decref(l->il_page);
+	l->il_env = curenv->env_id;
+f010870a:	e8 2c ef ff ff       	call   f010763b <cpunum>
+f010870f:	89 c2                	mov    %eax,%edx
+f0108711:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0108714:	c1 e0 02             	shl    $0x2,%eax
+f0108717:	6b d2 7c             	imul   $0x7c,%edx,%edx
+f010871a:	8b 92 28 70 a4 f0    	mov    -0xf5b8fd8(%edx),%edx
+f0108720:	8b 52 48             	mov    0x48(%edx),%edx
+f0108723:	89 90 60 61 a4 f0    	mov    %edx,-0xf5b9ea0(%eax)
+	l->il_page = pp;
+f0108729:	89 b0 64 61 a4 f0    	mov    %esi,-0xf5b9e9c(%eax)
+	l->il_key = key;
+f010872f:	89 b8 68 61 a4 f0    	mov    %edi,-0xf5b9e98(%eax)
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << irq) & ~(1 << IRQ_SLAVE));
+f0108735:	83 ec 0c             	sub    $0xc,%esp
+f0108738:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f010873f:	0f b3 d8             	btr    %ebx,%eax
+f0108742:	25 fb ff 00 00       	and    $0xfffb,%eax
+f0108747:	50                   	push   %eax
+f0108748:	e8 50 ba ff ff       	call   f010419d <irq_setmask_8259A>
+	return 0;
+f010874d:	83 c4 10             	add    $0x10,%esp
+f0108750:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108758:	5b                   	pop    %ebx
+f0108759:	5e                   	pop    %esi
+f010875a:	5f                   	pop    %edi
+f010875b:	5d                   	pop    %ebp
+f010875c:	c3                   	ret
+	    && envs[ENVX(l->il_env)].env_status != ENV_FREE) {
+f010875d:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f0108761:	0f 84 70 ff ff ff    	je     f01086d7 <futex_irq_listen+0x7b>
+		if (envs[ENVX(l->il_env)].env_pgdir != curenv->env_pgdir)
+f0108767:	8b 70 60             	mov    0x60(%eax),%esi
+f010876a:	e8 cc ee ff ff       	call   f010763b <cpunum>
+f010876f:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108772:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108778:	3b 70 60             	cmp    0x60(%eax),%esi
+f010877b:	75 67                	jne    f01087e4 <futex_irq_listen+0x188>
+		if (l->il_key == key) {
+f010877d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0108780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108783:	39 3c 85 68 61 a4 f0 	cmp    %edi,-0xf5b9e98(,%eax,4)
+f010878a:	0f 85 47 ff ff ff    	jne    f01086d7 <futex_irq_listen+0x7b>
+			irq_mask_line(irq, 0);
+f0108790:	83 ec 08             	sub    $0x8,%esp
+f0108793:	6a 00                	push   $0x0
+f0108795:	53                   	push   %ebx
+f0108796:	e8 2b bb ff ff       	call   f01042c6 <irq_mask_line>
+			return 0;
+f010879b:	83 c4 10             	add    $0x10,%esp
+f010879e:	b8 00 00 00 00       	mov    $0x0,%eax
+f01087a3:	eb b0                	jmp    f0108755 <futex_irq_listen+0xf9>
+		panic("pa2page called with invalid pa");
+f01087a5:	83 ec 04             	sub    $0x4,%esp
+f01087a8:	68 1c 96 10 f0       	push   $0xf010961c
+f01087ad:	6a 54                	push   $0x54
+f01087af:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01087b4:	e8 87 78 ff ff       	call   f0100040 <_panic>
+		page_decref(l->il_page);
+f01087b9:	83 ec 0c             	sub    $0xc,%esp
+f01087bc:	ff 34 85 64 61 a4 f0 	push   -0xf5b9e9c(,%eax,4)
+f01087c3:	e8 16 8e ff ff       	call   f01015de <page_decref>
+f01087c8:	83 c4 10             	add    $0x10,%esp
+f01087cb:	e9 3a ff ff ff       	jmp    f010870a <futex_irq_listen+0xae>
+		return -E_INVAL;
+f01087d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01087d5:	e9 7b ff ff ff       	jmp    f0108755 <futex_irq_listen+0xf9>
+		return -E_BAD_ENV;
+f01087da:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01087df:	e9 71 ff ff ff       	jmp    f0108755 <futex_irq_listen+0xf9>
+			return -E_BAD_ENV;
+f01087e4:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01087e9:	e9 67 ff ff ff       	jmp    f0108755 <futex_irq_listen+0xf9>
+
+f01087ee <futex_irq>:
+
+// Deliver interrupt 'irq' to its listener.
+// Returns 1 if someone listens to irq, 0 otherwise.
+bool
+futex_irq(int irq)
+{
+f01087ee:	55                   	push   %ebp
+f01087ef:	89 e5                	mov    %esp,%ebp
+f01087f1:	56                   	push   %esi
+f01087f2:	53                   	push   %ebx
+f01087f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct IrqListener *l;
+	struct Env *e;
+
+	if (irq < 0 || irq >= MAX_IRQS || !(l = &irq_listeners[irq])->il_env)
+f01087f6:	83 fb 0f             	cmp    $0xf,%ebx
+f01087f9:	0f 87 c8 00 00 00    	ja     f01088c7 <futex_irq+0xd9>
+f01087ff:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0108802:	8b 14 85 60 61 a4 f0 	mov    -0xf5b9ea0(,%eax,4),%edx
+f0108809:	85 d2                	test   %edx,%edx
+f010880b:	0f 84 c2 00 00 00    	je     f01088d3 <futex_irq+0xe5>
+		return 0;
+	e = &envs[ENVX(l->il_env)];
+f0108811:	89 d0                	mov    %edx,%eax
+f0108813:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0108818:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+f010881b:	c1 e0 04             	shl    $0x4,%eax
+f010881e:	03 05 48 42 a2 f0    	add    0xf0a24248,%eax
+	if (e->env_id != l->il_env || e->env_status == ENV_FREE) {
+f0108824:	3b 50 48             	cmp    0x48(%eax),%edx
+f0108827:	75 06                	jne    f010882f <futex_irq+0x41>
+f0108829:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f010882d:	75 2c                	jne    f010885b <futex_irq+0x6d>
+		// The listener died; leave the line to the default handler.
+		page_decref(l->il_page);
+f010882f:	83 ec 0c             	sub    $0xc,%esp
+f0108832:	8d 34 1b             	lea    (%ebx,%ebx,1),%esi
+f0108835:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+f0108838:	ff 34 85 64 61 a4 f0 	push   -0xf5b9e9c(,%eax,4)
+f010883f:	e8 9a 8d ff ff       	call   f01015de <page_decref>
+		l->il_env = 0;
+f0108844:	01 de                	add    %ebx,%esi
+f0108846:	c7 04 b5 60 61 a4 f0 	movl   $0x0,-0xf5b9ea0(,%esi,4)
+f010884d:	00 00 00 00 
+		return 0;
+f0108851:	83 c4 10             	add    $0x10,%esp
+f0108854:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108859:	eb 71                	jmp    f01088cc <futex_irq+0xde>
+	}
+	if (irq_is_level(irq))
+f010885b:	83 ec 0c             	sub    $0xc,%esp
+f010885e:	53                   	push   %ebx
+f010885f:	e8 a9 ba ff ff       	call   f010430d <irq_is_level>
+f0108864:	83 c4 10             	add    $0x10,%esp
+f0108867:	84 c0                	test   %al,%al
+f0108869:	75 37                	jne    f01088a2 <futex_irq+0xb4>
+		irq_mask_line(irq, 1);
+	(*(volatile uint32_t *) KADDR(l->il_key))++;
+f010886b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f010886e:	8b 04 85 68 61 a4 f0 	mov    -0xf5b9e98(,%eax,4),%eax
+	if (PGNUM(pa) >= npages)
+f0108875:	89 c2                	mov    %eax,%edx
+f0108877:	c1 ea 0c             	shr    $0xc,%edx
+f010887a:	3b 15 98 62 a4 f0    	cmp    0xf0a46298,%edx
+f0108880:	73 30                	jae    f01088b2 <futex_irq+0xc4>
+f0108882:	8b 90 00 00 00 f0    	mov    -0x10000000(%eax),%edx
+f0108888:	83 c2 01             	add    $0x1,%edx
+f010888b:	89 90 00 00 00 f0    	mov    %edx,-0x10000000(%eax)
+	futex_wake_key(l->il_key, NENV);
+f0108891:	ba 00 04 00 00       	mov    $0x400,%edx
+f0108896:	e8 29 fc ff ff       	call   f01084c4 <futex_wake_key>
+	return 1;
+f010889b:	b8 01 00 00 00       	mov    $0x1,%eax
+f01088a0:	eb 2a                	jmp    f01088cc <futex_irq+0xde>
+		irq_mask_line(irq, 1);
+f01088a2:	83 ec 08             	sub    $0x8,%esp
+f01088a5:	6a 01                	push   $0x1
+f01088a7:	53                   	push   %ebx
+f01088a8:	e8 19 ba ff ff       	call   f01042c6 <irq_mask_line>
+f01088ad:	83 c4 10             	add    $0x10,%esp
+f01088b0:	eb b9                	jmp    f010886b <futex_irq+0x7d>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01088b2:	50                   	push   %eax
+f01088b3:	68 24 8e 10 f0       	push   $0xf0108e24
+f01088b8:	68 c6 00 00 00       	push   $0xc6
+f01088bd:	68 17 ba 10 f0       	push   $0xf010ba17
+f01088c2:	e8 79 77 ff ff       	call   f0100040 <_panic>
+		return 0;
+f01088c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01088cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01088cf:	5b                   	pop    %ebx
+f01088d0:	5e                   	pop    %esi
+f01088d1:	5d                   	pop    %ebp
+f01088d2:	c3                   	ret
+		return 0;
+f01088d3:	b8 00 00 00 00       	mov    $0x0,%eax
+f01088d8:	eb f2                	jmp    f01088cc <futex_irq+0xde>
+
+f01088da <futex_tick>:
+
+// Time out sleepers whose deadline has passed.
+// Called once per timer tick with the current time_msec().
+void
+futex_tick(unsigned int now)
+{
+f01088da:	55                   	push   %ebp
+f01088db:	89 e5                	mov    %esp,%ebp
+f01088dd:	57                   	push   %edi
+f01088de:	56                   	push   %esi
+f01088df:	53                   	push   %ebx
+f01088e0:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, timed;
+
+	if (nfutex_timed == 0)
+f01088e3:	83 3d 20 62 a4 f0 00 	cmpl   $0x0,0xf0a46220
+f01088ea:	74 59                	je     f0108945 <futex_tick+0x6b>
+		return;
+
+	timed = 0;
+	for (i = 0; i < NENV; i++) {
+		struct Env *e = &envs[i];
+f01088ec:	8b 0d 48 42 a2 f0    	mov    0xf0a24248,%ecx
+f01088f2:	8d 41 1c             	lea    0x1c(%ecx),%eax
+f01088f5:	81 c1 1c 40 02 00    	add    $0x2401c,%ecx
+	timed = 0;
+f01088fb:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108900:	eb 08                	jmp    f010890a <futex_tick+0x30>
+		    !e->env_futex_waiting || !e->env_futex_deadline)
+			continue;
+		if ((int32_t) (now - e->env_futex_deadline) >= 0)
+			futex_wakeup(e, -E_TIMEOUT);
+		else
+			timed++;
+f0108902:	83 c7 01             	add    $0x1,%edi
+	for (i = 0; i < NENV; i++) {
+f0108905:	05 90 00 00 00       	add    $0x90,%eax
+f010890a:	39 c8                	cmp    %ecx,%eax
+f010890c:	74 31                	je     f010893f <futex_tick+0x65>
+		if (e->env_status != ENV_NOT_RUNNABLE ||
+f010890e:	83 78 38 04          	cmpl   $0x4,0x38(%eax)
+f0108912:	75 f1                	jne    f0108905 <futex_tick+0x2b>
+f0108914:	80 78 64 00          	cmpb   $0x0,0x64(%eax)
+f0108918:	74 eb                	je     f0108905 <futex_tick+0x2b>
+		    !e->env_futex_waiting || !e->env_futex_deadline)
+f010891a:	8b 58 6c             	mov    0x6c(%eax),%ebx
+f010891d:	85 db                	test   %ebx,%ebx
+f010891f:	74 e4                	je     f0108905 <futex_tick+0x2b>
+		if ((int32_t) (now - e->env_futex_deadline) >= 0)
+f0108921:	39 de                	cmp    %ebx,%esi
+f0108923:	78 dd                	js     f0108902 <futex_tick+0x28>
+	e->env_futex_waiting = 0;
+f0108925:	c6 40 64 00          	movb   $0x0,0x64(%eax)
+	e->env_futex_deadline = 0;
+f0108929:	c7 40 6c 00 00 00 00 	movl   $0x0,0x6c(%eax)
+	e->env_tf.tf_regs.reg_eax = ret;
+f0108930:	c7 00 ec ff ff ff    	movl   $0xffffffec,(%eax)
+	e->env_status = ENV_RUNNABLE;
+f0108936:	c7 40 38 02 00 00 00 	movl   $0x2,0x38(%eax)
+}
+f010893d:	eb c6                	jmp    f0108905 <futex_tick+0x2b>
+	}
+	nfutex_timed = timed;
+f010893f:	89 3d 20 62 a4 f0    	mov    %edi,0xf0a46220
+}
+f0108945:	5b                   	pop    %ebx
+f0108946:	5e                   	pop    %esi
+f0108947:	5f                   	pop    %edi
+f0108948:	5d                   	pop    %ebp
+f0108949:	c3                   	ret
+
+f010894a <uring_map>:
+// page is not mapped user-writable right now.  The latter happens while
+// the page is still shared copy-on-write after a fork; the env's next
+// write to it, such as queueing a call, fixes that.
+static struct Uring *
+uring_map(struct Env *e)
+{
+f010894a:	89 c2                	mov    %eax,%edx
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if (!e->env_uring)
+f010894c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+f0108952:	85 c0                	test   %eax,%eax
+f0108954:	74 63                	je     f01089b9 <uring_map+0x6f>
+{
+f0108956:	55                   	push   %ebp
+f0108957:	89 e5                	mov    %esp,%ebp
+f0108959:	83 ec 1c             	sub    $0x1c,%esp
+		return NULL;
+	pp = page_lookup(e->env_pgdir, e->env_uring, &pte);
+f010895c:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+f010895f:	51                   	push   %ecx
+f0108960:	50                   	push   %eax
+f0108961:	ff 72 60             	push   0x60(%edx)
+f0108964:	e8 7a 8e ff ff       	call   f01017e3 <page_lookup>
+	if (!pp || (*pte & (PTE_U|PTE_W)) != (PTE_U|PTE_W))
+f0108969:	83 c4 10             	add    $0x10,%esp
+f010896c:	85 c0                	test   %eax,%eax
+f010896e:	74 2e                	je     f010899e <uring_map+0x54>
+f0108970:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0108973:	8b 12                	mov    (%edx),%edx
+f0108975:	83 e2 06             	and    $0x6,%edx
+f0108978:	83 fa 06             	cmp    $0x6,%edx
+f010897b:	75 35                	jne    f01089b2 <uring_map+0x68>
+	return (pp - pages) << PGSHIFT;
+f010897d:	2b 05 a0 62 a4 f0    	sub    0xf0a462a0,%eax
+f0108983:	c1 f8 03             	sar    $0x3,%eax
+f0108986:	89 c2                	mov    %eax,%edx
+f0108988:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010898b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0108990:	3b 05 98 62 a4 f0    	cmp    0xf0a46298,%eax
+f0108996:	73 08                	jae    f01089a0 <uring_map+0x56>
+	return (void *)(pa + KERNBASE);
+f0108998:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+		return NULL;
+	return page2kva(pp);
+}
+f010899e:	c9                   	leave
+f010899f:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01089a0:	52                   	push   %edx
+f01089a1:	68 24 8e 10 f0       	push   $0xf0108e24
+f01089a6:	6a 5b                	push   $0x5b
+f01089a8:	68 b9 9e 10 f0       	push   $0xf0109eb9
+f01089ad:	e8 8e 76 ff ff       	call   f0100040 <_panic>
+		return NULL;
+f01089b2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01089b7:	eb e5                	jmp    f010899e <uring_map+0x54>
+}
+f01089b9:	c3                   	ret
+
+f01089ba <uring_setup>:
+//
+// Returns 0 on success, -E_INVAL if va is not page-aligned, is above
+// UTOP, or is not mapped user-writable.
+int
+uring_setup(void *va)
+{
+f01089ba:	55                   	push   %ebp
+f01089bb:	89 e5                	mov    %esp,%ebp
+f01089bd:	56                   	push   %esi
+f01089be:	53                   	push   %ebx
+f01089bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *old = curenv->env_uring;
+f01089c2:	e8 74 ec ff ff       	call   f010763b <cpunum>
+f01089c7:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01089ca:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01089d0:	8b b0 8c 00 00 00    	mov    0x8c(%eax),%esi
+
+	if (va == NULL) {
+f01089d6:	85 db                	test   %ebx,%ebx
+f01089d8:	74 44                	je     f0108a1e <uring_setup+0x64>
+		curenv->env_uring = NULL;
+		return 0;
+	}
+	if (PGOFF(va) || (uintptr_t) va >= UTOP)
+f01089da:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f01089e0:	75 76                	jne    f0108a58 <uring_setup+0x9e>
+f01089e2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f01089e8:	77 6e                	ja     f0108a58 <uring_setup+0x9e>
+		return -E_INVAL;
+	curenv->env_uring = va;
+f01089ea:	e8 4c ec ff ff       	call   f010763b <cpunum>
+f01089ef:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f01089f2:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f01089f8:	89 98 8c 00 00 00    	mov    %ebx,0x8c(%eax)
+	if (!uring_map(curenv)) {
+f01089fe:	e8 38 ec ff ff       	call   f010763b <cpunum>
+f0108a03:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108a06:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108a0c:	e8 39 ff ff ff       	call   f010894a <uring_map>
+f0108a11:	85 c0                	test   %eax,%eax
+f0108a13:	74 28                	je     f0108a3d <uring_setup+0x83>
+		curenv->env_uring = old;
+		return -E_INVAL;
+	}
+	return 0;
+f0108a15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108a1a:	5b                   	pop    %ebx
+f0108a1b:	5e                   	pop    %esi
+f0108a1c:	5d                   	pop    %ebp
+f0108a1d:	c3                   	ret
+		curenv->env_uring = NULL;
+f0108a1e:	e8 18 ec ff ff       	call   f010763b <cpunum>
+f0108a23:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108a26:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108a2c:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f0108a33:	00 00 00 
+		return 0;
+f0108a36:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108a3b:	eb dd                	jmp    f0108a1a <uring_setup+0x60>
+		curenv->env_uring = old;
+f0108a3d:	e8 f9 eb ff ff       	call   f010763b <cpunum>
+f0108a42:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108a45:	8b 80 28 70 a4 f0    	mov    -0xf5b8fd8(%eax),%eax
+f0108a4b:	89 b0 8c 00 00 00    	mov    %esi,0x8c(%eax)
+		return -E_INVAL;
+f0108a51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108a56:	eb c2                	jmp    f0108a1a <uring_setup+0x60>
+		return -E_INVAL;
+f0108a58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108a5d:	eb bb                	jmp    f0108a1a <uring_setup+0x60>
+
+f0108a5f <uring_drain>:
+//
+// Returns the number of calls run, or -E_INVAL if the queue indices
+// are corrupt.
+int
+uring_drain(struct Env *e)
+{
+f0108a5f:	55                   	push   %ebp
+f0108a60:	89 e5                	mov    %esp,%ebp
+f0108a62:	57                   	push   %edi
+f0108a63:	56                   	push   %esi
+f0108a64:	53                   	push   %ebx
+f0108a65:	83 ec 1c             	sub    $0x1c,%esp
+f0108a68:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct UringSqe sqe;
+	struct UringCqe *cqe;
+	int32_t res;
+	int n;
+
+	assert(e == curenv);
+f0108a6b:	e8 cb eb ff ff       	call   f010763b <cpunum>
+f0108a70:	6b c0 7c             	imul   $0x7c,%eax,%eax
+f0108a73:	39 b8 28 70 a4 f0    	cmp    %edi,-0xf5b8fd8(%eax)
+f0108a79:	75 0a                	jne    f0108a85 <uring_drain+0x26>
+	for (n = 0; n < URING_NSQE; n++) {
+f0108a7b:	be 00 00 00 00       	mov    $0x0,%esi
+	switch (op) {
+f0108a80:	89 7d 08             	mov    %edi,0x8(%ebp)
+f0108a83:	eb 53                	jmp    f0108ad8 <uring_drain+0x79>
+	assert(e == curenv);
+f0108a85:	68 24 ba 10 f0       	push   $0xf010ba24
+f0108a8a:	68 d3 9e 10 f0       	push   $0xf0109ed3
+f0108a8f:	6a 64                	push   $0x64
+f0108a91:	68 30 ba 10 f0       	push   $0xf010ba30
+f0108a96:	e8 a5 75 ff ff       	call   f0100040 <_panic>
+	switch (op) {
+f0108a9b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+			res = syscall(sqe.sqe_op, sqe.sqe_arg[0], sqe.sqe_arg[1],
+				      sqe.sqe_arg[2], sqe.sqe_arg[3], sqe.sqe_arg[4]);
+		else
+			res = -E_INVAL;
+
+		if (!(u = uring_map(e)))
+f0108aa0:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108aa3:	e8 a2 fe ff ff       	call   f010894a <uring_map>
+f0108aa8:	85 c0                	test   %eax,%eax
+f0108aaa:	0f 84 d5 00 00 00    	je     f0108b85 <uring_drain+0x126>
+			break;
+		cqe = &u->cq[u->cq_tail % URING_NCQE];
+f0108ab0:	8b 50 0c             	mov    0xc(%eax),%edx
+f0108ab3:	83 e2 7f             	and    $0x7f,%edx
+		cqe->cqe_data = sqe.sqe_data;
+f0108ab6:	81 c2 08 01 00 00    	add    $0x108,%edx
+f0108abc:	89 3c d0             	mov    %edi,(%eax,%edx,8)
+		cqe->cqe_res = res;
+f0108abf:	89 5c d0 04          	mov    %ebx,0x4(%eax,%edx,8)
+		u->cq_tail++;
+f0108ac3:	8b 50 0c             	mov    0xc(%eax),%edx
+f0108ac6:	83 c2 01             	add    $0x1,%edx
+f0108ac9:	89 50 0c             	mov    %edx,0xc(%eax)
+	for (n = 0; n < URING_NSQE; n++) {
+f0108acc:	83 c6 01             	add    $0x1,%esi
+f0108acf:	83 fe 40             	cmp    $0x40,%esi
+f0108ad2:	0f 84 ad 00 00 00    	je     f0108b85 <uring_drain+0x126>
+		if (!(u = uring_map(e)))
+f0108ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108adb:	e8 6a fe ff ff       	call   f010894a <uring_map>
+f0108ae0:	85 c0                	test   %eax,%eax
+f0108ae2:	0f 84 9d 00 00 00    	je     f0108b85 <uring_drain+0x126>
+		if (u->sq_tail - u->sq_head > URING_NSQE)
+f0108ae8:	8b 50 04             	mov    0x4(%eax),%edx
+f0108aeb:	8b 08                	mov    (%eax),%ecx
+f0108aed:	29 ca                	sub    %ecx,%edx
+f0108aef:	83 fa 40             	cmp    $0x40,%edx
+f0108af2:	0f 87 88 00 00 00    	ja     f0108b80 <uring_drain+0x121>
+		if (u->sq_head == u->sq_tail
+f0108af8:	8b 08                	mov    (%eax),%ecx
+f0108afa:	8b 50 04             	mov    0x4(%eax),%edx
+f0108afd:	39 d1                	cmp    %edx,%ecx
+f0108aff:	0f 84 80 00 00 00    	je     f0108b85 <uring_drain+0x126>
+		    || u->cq_tail - u->cq_head >= URING_NCQE)
+f0108b05:	8b 50 0c             	mov    0xc(%eax),%edx
+f0108b08:	8b 48 08             	mov    0x8(%eax),%ecx
+f0108b0b:	29 ca                	sub    %ecx,%edx
+f0108b0d:	83 fa 7f             	cmp    $0x7f,%edx
+f0108b10:	77 73                	ja     f0108b85 <uring_drain+0x126>
+		sqe = u->sq[u->sq_head % URING_NSQE];
+f0108b12:	8b 18                	mov    (%eax),%ebx
+f0108b14:	83 e3 3f             	and    $0x3f,%ebx
+f0108b17:	c1 e3 05             	shl    $0x5,%ebx
+f0108b1a:	01 c3                	add    %eax,%ebx
+f0108b1c:	8b 53 40             	mov    0x40(%ebx),%edx
+f0108b1f:	8b 7b 44             	mov    0x44(%ebx),%edi
+f0108b22:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0108b25:	8b 4b 48             	mov    0x48(%ebx),%ecx
+f0108b28:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0108b2b:	8b 4b 4c             	mov    0x4c(%ebx),%ecx
+f0108b2e:	8b 7b 50             	mov    0x50(%ebx),%edi
+f0108b31:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0108b34:	8b 7b 54             	mov    0x54(%ebx),%edi
+f0108b37:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0108b3a:	8b 7b 58             	mov    0x58(%ebx),%edi
+		u->sq_head++;
+f0108b3d:	8b 18                	mov    (%eax),%ebx
+f0108b3f:	83 c3 01             	add    $0x1,%ebx
+f0108b42:	89 18                	mov    %ebx,(%eax)
+	switch (op) {
+f0108b44:	83 fa 12             	cmp    $0x12,%edx
+f0108b47:	0f 87 4e ff ff ff    	ja     f0108a9b <uring_drain+0x3c>
+f0108b4d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108b52:	b8 77 d5 05 00       	mov    $0x5d577,%eax
+f0108b57:	0f a3 d0             	bt     %edx,%eax
+f0108b5a:	0f 83 40 ff ff ff    	jae    f0108aa0 <uring_drain+0x41>
+			res = syscall(sqe.sqe_op, sqe.sqe_arg[0], sqe.sqe_arg[1],
+f0108b60:	83 ec 08             	sub    $0x8,%esp
+f0108b63:	ff 75 d8             	push   -0x28(%ebp)
+f0108b66:	ff 75 e0             	push   -0x20(%ebp)
+f0108b69:	51                   	push   %ecx
+f0108b6a:	ff 75 dc             	push   -0x24(%ebp)
+f0108b6d:	ff 75 e4             	push   -0x1c(%ebp)
+f0108b70:	52                   	push   %edx
+f0108b71:	e8 95 d6 ff ff       	call   f010620b <syscall>
+f0108b76:	89 c3                	mov    %eax,%ebx
+f0108b78:	83 c4 20             	add    $0x20,%esp
+f0108b7b:	e9 20 ff ff ff       	jmp    f0108aa0 <uring_drain+0x41>
+			return -E_INVAL;
+f0108b80:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+	}
+	return n;
+}
+f0108b85:	89 f0                	mov    %esi,%eax
+f0108b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108b8a:	5b                   	pop    %ebx
+f0108b8b:	5e                   	pop    %esi
+f0108b8c:	5f                   	pop    %edi
+f0108b8d:	5d                   	pop    %ebp
+f0108b8e:	c3                   	ret
+
+f0108b8f <udm>:
+f0108b8f:	57                   	push   %edi
+f0108b90:	56                   	push   %esi
+f0108b91:	53                   	push   %ebx
+f0108b92:	83 ec 20             	sub    $0x20,%esp
+f0108b95:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0108b99:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0108b9d:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0108ba1:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0108ba5:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0108ba9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0108bad:	89 d1                	mov    %edx,%ecx
+f0108baf:	09 c1                	or     %eax,%ecx
+f0108bb1:	0f 84 91 00 00 00    	je     f0108c48 <udm+0xb9>
+f0108bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108bc1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0108bc6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f0108bcd:	00 
+f0108bce:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0108bd5:	00 
+f0108bd6:	eb 08                	jmp    f0108be0 <udm+0x51>
+f0108bd8:	83 e9 01             	sub    $0x1,%ecx
+f0108bdb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f0108bde:	74 7c                	je     f0108c5c <udm+0xcd>
+f0108be0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0108be4:	01 c0                	add    %eax,%eax
+f0108be6:	89 c6                	mov    %eax,%esi
+f0108be8:	89 d7                	mov    %edx,%edi
+f0108bea:	8b 44 24 10          	mov    0x10(%esp),%eax
+f0108bee:	8b 54 24 14          	mov    0x14(%esp),%edx
+f0108bf2:	0f ad d0             	shrd   %cl,%edx,%eax
+f0108bf5:	d3 ea                	shr    %cl,%edx
+f0108bf7:	f6 c1 20             	test   $0x20,%cl
+f0108bfa:	74 04                	je     f0108c00 <udm+0x71>
+f0108bfc:	89 d0                	mov    %edx,%eax
+f0108bfe:	31 d2                	xor    %edx,%edx
+f0108c00:	83 e0 01             	and    $0x1,%eax
+f0108c03:	89 04 24             	mov    %eax,(%esp)
+f0108c06:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0108c0d:	00 
+f0108c0e:	8b 04 24             	mov    (%esp),%eax
+f0108c11:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0108c15:	09 f0                	or     %esi,%eax
+f0108c17:	09 fa                	or     %edi,%edx
+f0108c19:	8b 74 24 08          	mov    0x8(%esp),%esi
+f0108c1d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+f0108c21:	39 f0                	cmp    %esi,%eax
+f0108c23:	89 d3                	mov    %edx,%ebx
+f0108c25:	19 fb                	sbb    %edi,%ebx
+f0108c27:	72 af                	jb     f0108bd8 <udm+0x49>
+f0108c29:	29 f0                	sub    %esi,%eax
+f0108c2b:	19 fa                	sbb    %edi,%edx
+f0108c2d:	89 cf                	mov    %ecx,%edi
+f0108c2f:	c1 ef 05             	shr    $0x5,%edi
+f0108c32:	83 e7 01             	and    $0x1,%edi
+f0108c35:	89 fe                	mov    %edi,%esi
+f0108c37:	83 f6 01             	xor    $0x1,%esi
+f0108c3a:	d3 e6                	shl    %cl,%esi
+f0108c3c:	d3 e7                	shl    %cl,%edi
+f0108c3e:	09 74 24 18          	or     %esi,0x18(%esp)
+f0108c42:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0108c46:	eb 90                	jmp    f0108bd8 <udm+0x49>
+f0108c48:	8b 74 24 08          	mov    0x8(%esp),%esi
+f0108c4c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+f0108c50:	89 f0                	mov    %esi,%eax
+f0108c52:	89 fa                	mov    %edi,%edx
+f0108c54:	89 74 24 18          	mov    %esi,0x18(%esp)
+f0108c58:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+f0108c5c:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+f0108c60:	89 01                	mov    %eax,(%ecx)
+f0108c62:	89 51 04             	mov    %edx,0x4(%ecx)
+f0108c65:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0108c69:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0108c6d:	83 c4 20             	add    $0x20,%esp
+f0108c70:	5b                   	pop    %ebx
+f0108c71:	5e                   	pop    %esi
+f0108c72:	5f                   	pop    %edi
+f0108c73:	c3                   	ret
+
+f0108c74 <__udivdi3>:
+f0108c74:	83 ec 18             	sub    $0x18,%esp
+f0108c77:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f0108c7b:	50                   	push   %eax
+f0108c7c:	ff 74 24 2c          	push   0x2c(%esp)
+f0108c80:	ff 74 24 2c          	push   0x2c(%esp)
+f0108c84:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108c88:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108c8c:	e8 fe fe ff ff       	call   f0108b8f <udm>
+f0108c91:	83 c4 24             	add    $0x24,%esp
+f0108c94:	c3                   	ret
+
+f0108c95 <__umoddi3>:
+f0108c95:	83 ec 18             	sub    $0x18,%esp
+f0108c98:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f0108c9c:	50                   	push   %eax
+f0108c9d:	ff 74 24 2c          	push   0x2c(%esp)
+f0108ca1:	ff 74 24 2c          	push   0x2c(%esp)
+f0108ca5:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108ca9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108cad:	e8 dd fe ff ff       	call   f0108b8f <udm>
+f0108cb2:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0108cb6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0108cba:	83 c4 24             	add    $0x24,%esp
+f0108cbd:	c3                   	ret
+
+f0108cbe <__divdi3>:
+f0108cbe:	56                   	push   %esi
+f0108cbf:	53                   	push   %ebx
+f0108cc0:	83 ec 14             	sub    $0x14,%esp
+f0108cc3:	8b 44 24 20          	mov    0x20(%esp),%eax
+f0108cc7:	8b 54 24 24          	mov    0x24(%esp),%edx
+f0108ccb:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+f0108ccf:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+f0108cd3:	85 d2                	test   %edx,%edx
+f0108cd5:	78 18                	js     f0108cef <__divdi3+0x31>
+f0108cd7:	85 db                	test   %ebx,%ebx
+f0108cd9:	78 3e                	js     f0108d19 <__divdi3+0x5b>
+f0108cdb:	83 ec 04             	sub    $0x4,%esp
+f0108cde:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f0108ce2:	56                   	push   %esi
+f0108ce3:	53                   	push   %ebx
+f0108ce4:	51                   	push   %ecx
+f0108ce5:	e8 a5 fe ff ff       	call   f0108b8f <udm>
+f0108cea:	83 c4 10             	add    $0x10,%esp
+f0108ced:	eb 24                	jmp    f0108d13 <__divdi3+0x55>
+f0108cef:	f7 d8                	neg    %eax
+f0108cf1:	83 d2 00             	adc    $0x0,%edx
+f0108cf4:	f7 da                	neg    %edx
+f0108cf6:	85 db                	test   %ebx,%ebx
+f0108cf8:	78 3a                	js     f0108d34 <__divdi3+0x76>
+f0108cfa:	83 ec 04             	sub    $0x4,%esp
+f0108cfd:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f0108d01:	56                   	push   %esi
+f0108d02:	53                   	push   %ebx
+f0108d03:	51                   	push   %ecx
+f0108d04:	e8 86 fe ff ff       	call   f0108b8f <udm>
+f0108d09:	83 c4 10             	add    $0x10,%esp
+f0108d0c:	f7 d8                	neg    %eax
+f0108d0e:	83 d2 00             	adc    $0x0,%edx
+f0108d11:	f7 da                	neg    %edx
+f0108d13:	83 c4 14             	add    $0x14,%esp
+f0108d16:	5b                   	pop    %ebx
+f0108d17:	5e                   	pop    %esi
+f0108d18:	c3                   	ret
+f0108d19:	83 ec 04             	sub    $0x4,%esp
+f0108d1c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f0108d20:	56                   	push   %esi
+f0108d21:	f7 d9                	neg    %ecx
+f0108d23:	83 d3 00             	adc    $0x0,%ebx
+f0108d26:	f7 db                	neg    %ebx
+f0108d28:	53                   	push   %ebx
+f0108d29:	51                   	push   %ecx
+f0108d2a:	e8 60 fe ff ff       	call   f0108b8f <udm>
+f0108d2f:	83 c4 10             	add    $0x10,%esp
+f0108d32:	eb d8                	jmp    f0108d0c <__divdi3+0x4e>
+f0108d34:	83 ec 04             	sub    $0x4,%esp
+f0108d37:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f0108d3b:	56                   	push   %esi
+f0108d3c:	f7 d9                	neg    %ecx
+f0108d3e:	83 d3 00             	adc    $0x0,%ebx
+f0108d41:	f7 db                	neg    %ebx
+f0108d43:	53                   	push   %ebx
+f0108d44:	51                   	push   %ecx
+f0108d45:	e8 45 fe ff ff       	call   f0108b8f <udm>
+f0108d4a:	83 c4 10             	add    $0x10,%esp
+f0108d4d:	eb c4                	jmp    f0108d13 <__divdi3+0x55>
+
+f0108d4f <__moddi3>:
+f0108d4f:	55                   	push   %ebp
+f0108d50:	57                   	push   %edi
+f0108d51:	56                   	push   %esi
+f0108d52:	53                   	push   %ebx
+f0108d53:	83 ec 24             	sub    $0x24,%esp
+f0108d56:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0108d5a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0108d5e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+f0108d62:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+f0108d66:	85 d2                	test   %edx,%edx
+f0108d68:	78 3b                	js     f0108da5 <__moddi3+0x56>
+f0108d6a:	83 ec 04             	sub    $0x4,%esp
+f0108d6d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f0108d71:	56                   	push   %esi
+f0108d72:	89 ce                	mov    %ecx,%esi
+f0108d74:	f7 de                	neg    %esi
+f0108d76:	89 74 24 08          	mov    %esi,0x8(%esp)
+f0108d7a:	89 de                	mov    %ebx,%esi
+f0108d7c:	83 d6 00             	adc    $0x0,%esi
+f0108d7f:	f7 de                	neg    %esi
+f0108d81:	89 74 24 14          	mov    %esi,0x14(%esp)
+f0108d85:	8b 74 24 08          	mov    0x8(%esp),%esi
+f0108d89:	0f 48 f1             	cmovs  %ecx,%esi
+f0108d8c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+f0108d91:	53                   	push   %ebx
+f0108d92:	56                   	push   %esi
+f0108d93:	e8 f7 fd ff ff       	call   f0108b8f <udm>
+f0108d98:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108d9c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108da0:	83 c4 10             	add    $0x10,%esp
+f0108da3:	eb 47                	jmp    f0108dec <__moddi3+0x9d>
+f0108da5:	f7 d8                	neg    %eax
+f0108da7:	83 d2 00             	adc    $0x0,%edx
+f0108daa:	f7 da                	neg    %edx
+f0108dac:	83 ec 04             	sub    $0x4,%esp
+f0108daf:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f0108db3:	56                   	push   %esi
+f0108db4:	89 cf                	mov    %ecx,%edi
+f0108db6:	f7 df                	neg    %edi
+f0108db8:	89 de                	mov    %ebx,%esi
+f0108dba:	83 d6 00             	adc    $0x0,%esi
+f0108dbd:	f7 de                	neg    %esi
+f0108dbf:	0f 49 cf             	cmovns %edi,%ecx
+f0108dc2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+f0108dc6:	0f 49 de             	cmovns %esi,%ebx
+f0108dc9:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+f0108dcd:	ff 74 24 0c          	push   0xc(%esp)
+f0108dd1:	ff 74 24 0c          	push   0xc(%esp)
+f0108dd5:	e8 b5 fd ff ff       	call   f0108b8f <udm>
+f0108dda:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108dde:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108de2:	f7 d8                	neg    %eax
+f0108de4:	83 d2 00             	adc    $0x0,%edx
+f0108de7:	f7 da                	neg    %edx
+f0108de9:	83 c4 10             	add    $0x10,%esp
+f0108dec:	83 c4 24             	add    $0x24,%esp
+f0108def:	5b                   	pop    %ebx
+f0108df0:	5e                   	pop    %esi
+f0108df1:	5f                   	pop    %edi
+f0108df2:	5d                   	pop    %ebp
+f0108df3:	c3                   	ret
@@ -0,0 +1,10718 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 85 08 00 00       	call   8008b6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003c:	e8 bd 13 00 00       	call   8013fe <sys_getenvid>
+  800041:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800043:	c7 05 00 60 80 00 40 	movl   $0x804f40,0x806000
+  80004a:	4f 80 00 
+
+	output_envid = fork();
+  80004d:	e8 c0 1a 00 00       	call   801b12 <fork>
+  800052:	a3 04 70 80 00       	mov    %eax,0x807004
+	if (output_envid < 0)
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 88 7a 01 00 00    	js     8001d9 <umain+0x1a6>
+		panic("error forking");
+	else if (output_envid == 0) {
+  80005f:	0f 84 88 01 00 00    	je     8001ed <umain+0x1ba>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800065:	e8 a8 1a 00 00       	call   801b12 <fork>
+  80006a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (input_envid < 0)
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 8a 01 00 00    	js     800201 <umain+0x1ce>
+		panic("error forking");
+	else if (input_envid == 0) {
+  800077:	0f 84 98 01 00 00    	je     800215 <umain+0x1e2>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 68 4f 80 00       	push   $0x804f68
+  800085:	e8 aa 09 00 00       	call   800a34 <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  80008a:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800091:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+	uint32_t myip = inet_addr(IP);
+  800097:	c7 04 24 85 4f 80 00 	movl   $0x804f85,(%esp)
+  80009e:	e8 d9 07 00 00       	call   80087c <inet_addr>
+  8000a3:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000a6:	c7 04 24 8f 4f 80 00 	movl   $0x804f8f,(%esp)
+  8000ad:	e8 ca 07 00 00       	call   80087c <inet_addr>
+  8000b2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000b5:	83 c4 0c             	add    $0xc,%esp
+  8000b8:	6a 07                	push   $0x7
+  8000ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 90 13 00 00       	call   801456 <sys_page_alloc>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 52 01 00 00    	js     800223 <umain+0x1f0>
+	pkt->jp_len = sizeof(*arp);
+  8000d1:	c7 05 00 b0 fe 0f 2a 	movl   $0x2a,0xffeb000
+  8000d8:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	6a 06                	push   $0x6
+  8000e0:	68 ff 00 00 00       	push   $0xff
+  8000e5:	68 04 b0 fe 0f       	push   $0xffeb004
+  8000ea:	e8 7a 10 00 00       	call   801169 <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000ef:	83 c4 0c             	add    $0xc,%esp
+  8000f2:	6a 06                	push   $0x6
+  8000f4:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 0a b0 fe 0f       	push   $0xffeb00a
+  8000fd:	e8 fe 10 00 00       	call   801200 <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800102:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  800109:	e8 50 05 00 00       	call   80065e <htons>
+  80010e:	66 a3 10 b0 fe 0f    	mov    %ax,0xffeb010
+	arp->hwtype = htons(1); // Ethernet
+  800114:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011b:	e8 3e 05 00 00       	call   80065e <htons>
+  800120:	66 a3 12 b0 fe 0f    	mov    %ax,0xffeb012
+	arp->proto = htons(ETHTYPE_IP);
+  800126:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80012d:	e8 2c 05 00 00       	call   80065e <htons>
+  800132:	66 a3 14 b0 fe 0f    	mov    %ax,0xffeb014
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  800138:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  80013f:	e8 1a 05 00 00       	call   80065e <htons>
+  800144:	66 a3 16 b0 fe 0f    	mov    %ax,0xffeb016
+	arp->opcode = htons(ARP_REQUEST);
+  80014a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800151:	e8 08 05 00 00       	call   80065e <htons>
+  800156:	66 a3 18 b0 fe 0f    	mov    %ax,0xffeb018
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80015c:	83 c4 0c             	add    $0xc,%esp
+  80015f:	6a 06                	push   $0x6
+  800161:	53                   	push   %ebx
+  800162:	68 1a b0 fe 0f       	push   $0xffeb01a
+  800167:	e8 94 10 00 00       	call   801200 <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80016c:	83 c4 0c             	add    $0xc,%esp
+  80016f:	6a 04                	push   $0x4
+  800171:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	68 20 b0 fe 0f       	push   $0xffeb020
+  80017a:	e8 81 10 00 00       	call   801200 <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  80017f:	83 c4 0c             	add    $0xc,%esp
+  800182:	6a 06                	push   $0x6
+  800184:	6a 00                	push   $0x0
+  800186:	68 24 b0 fe 0f       	push   $0xffeb024
+  80018b:	e8 d9 0f 00 00       	call   801169 <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  800190:	83 c4 0c             	add    $0xc,%esp
+  800193:	6a 04                	push   $0x4
+  800195:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800198:	50                   	push   %eax
+  800199:	68 2a b0 fe 0f       	push   $0xffeb02a
+  80019e:	e8 5d 10 00 00       	call   801200 <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001a3:	6a 07                	push   $0x7
+  8001a5:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001aa:	6a 0b                	push   $0xb
+  8001ac:	ff 35 04 70 80 00    	push   0x807004
+  8001b2:	e8 ad 1e 00 00       	call   802064 <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	e8 29 13 00 00       	call   8014ef <sys_page_unmap>
+}
+  8001c6:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001c9:	bf 01 00 00 00       	mov    $0x1,%edi
+			out = buf + snprintf(buf, end - buf,
+  8001ce:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+}
+  8001d4:	e9 65 01 00 00       	jmp    80033e <umain+0x30b>
+		panic("error forking");
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 4a 4f 80 00       	push   $0x804f4a
+  8001e1:	6a 4d                	push   $0x4d
+  8001e3:	68 58 4f 80 00       	push   $0x804f58
+  8001e8:	e8 6c 07 00 00       	call   800959 <_panic>
+		output(ns_envid);
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+  8001f0:	53                   	push   %ebx
+  8001f1:	e8 38 03 00 00       	call   80052e <output>
+		return;
+  8001f6:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+		panic("error forking");
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	68 4a 4f 80 00       	push   $0x804f4a
+  800209:	6a 55                	push   $0x55
+  80020b:	68 58 4f 80 00       	push   $0x804f58
+  800210:	e8 44 07 00 00       	call   800959 <_panic>
+		input(ns_envid);
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	53                   	push   %ebx
+  800219:	e8 59 02 00 00       	call   800477 <input>
+		return;
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	eb d6                	jmp    8001f9 <umain+0x1c6>
+		panic("sys_page_map: %e", r);
+  800223:	50                   	push   %eax
+  800224:	68 98 4f 80 00       	push   $0x804f98
+  800229:	6a 19                	push   $0x19
+  80022b:	68 58 4f 80 00       	push   $0x804f58
+  800230:	e8 24 07 00 00       	call   800959 <_panic>
+			panic("ipc_recv: %e", req);
+  800235:	50                   	push   %eax
+  800236:	68 a9 4f 80 00       	push   $0x804fa9
+  80023b:	6a 64                	push   $0x64
+  80023d:	68 58 4f 80 00       	push   $0x804f58
+  800242:	e8 12 07 00 00       	call   800959 <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800247:	52                   	push   %edx
+  800248:	68 00 50 80 00       	push   $0x805000
+  80024d:	6a 66                	push   $0x66
+  80024f:	68 58 4f 80 00       	push   $0x804f58
+  800254:	e8 00 07 00 00       	call   800959 <_panic>
+			panic("Unexpected IPC %d", req);
+  800259:	50                   	push   %eax
+  80025a:	68 b6 4f 80 00       	push   $0x804fb6
+  80025f:	6a 68                	push   $0x68
+  800261:	68 58 4f 80 00       	push   $0x804f58
+  800266:	e8 ee 06 00 00       	call   800959 <_panic>
+			out = buf + snprintf(buf, end - buf,
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	53                   	push   %ebx
+  80026f:	68 c8 4f 80 00       	push   $0x804fc8
+  800274:	68 d0 4f 80 00       	push   $0x804fd0
+  800279:	6a 50                	push   $0x50
+  80027b:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	e8 3f 0d 00 00       	call   800fc3 <snprintf>
+  800284:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800287:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  80028a:	83 c4 20             	add    $0x20,%esp
+  80028d:	eb 40                	jmp    8002cf <umain+0x29c>
+			cprintf("%.*s\n", out - buf, buf);
+  80028f:	83 ec 04             	sub    $0x4,%esp
+  800292:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800295:	50                   	push   %eax
+  800296:	89 f0                	mov    %esi,%eax
+  800298:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  80029b:	29 c8                	sub    %ecx,%eax
+  80029d:	50                   	push   %eax
+  80029e:	68 df 4f 80 00       	push   $0x804fdf
+  8002a3:	e8 8c 07 00 00       	call   800a34 <cprintf>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002ab:	89 da                	mov    %ebx,%edx
+  8002ad:	c1 ea 1f             	shr    $0x1f,%edx
+  8002b0:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b3:	83 e0 01             	and    $0x1,%eax
+  8002b6:	29 d0                	sub    %edx,%eax
+  8002b8:	83 f8 01             	cmp    $0x1,%eax
+  8002bb:	74 4e                	je     80030b <umain+0x2d8>
+		if (i % 16 == 7)
+  8002bd:	83 ff 07             	cmp    $0x7,%edi
+  8002c0:	74 51                	je     800313 <umain+0x2e0>
+	for (i = 0; i < len; i++) {
+  8002c2:	83 c3 01             	add    $0x1,%ebx
+  8002c5:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002c8:	7e 51                	jle    80031b <umain+0x2e8>
+		if (i % 16 == 0)
+  8002ca:	f6 c3 0f             	test   $0xf,%bl
+  8002cd:	74 9c                	je     80026b <umain+0x238>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002cf:	0f b6 83 04 b0 fe 0f 	movzbl 0xffeb004(%ebx),%eax
+  8002d6:	50                   	push   %eax
+  8002d7:	68 da 4f 80 00       	push   $0x804fda
+  8002dc:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002df:	29 f0                	sub    %esi,%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	56                   	push   %esi
+  8002e3:	e8 db 0c 00 00       	call   800fc3 <snprintf>
+  8002e8:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002ea:	89 d8                	mov    %ebx,%eax
+  8002ec:	c1 f8 1f             	sar    $0x1f,%eax
+  8002ef:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f2:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f5:	83 e7 0f             	and    $0xf,%edi
+  8002f8:	29 c7                	sub    %eax,%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	83 ff 0f             	cmp    $0xf,%edi
+  800300:	74 8d                	je     80028f <umain+0x25c>
+  800302:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800305:	39 c3                	cmp    %eax,%ebx
+  800307:	75 a2                	jne    8002ab <umain+0x278>
+  800309:	eb 84                	jmp    80028f <umain+0x25c>
+			*(out++) = ' ';
+  80030b:	c6 06 20             	movb   $0x20,(%esi)
+  80030e:	8d 76 01             	lea    0x1(%esi),%esi
+  800311:	eb aa                	jmp    8002bd <umain+0x28a>
+			*(out++) = ' ';
+  800313:	c6 06 20             	movb   $0x20,(%esi)
+  800316:	8d 76 01             	lea    0x1(%esi),%esi
+  800319:	eb a7                	jmp    8002c2 <umain+0x28f>
+		cprintf("\n");
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+  80031e:	68 fb 4f 80 00       	push   $0x804ffb
+  800323:	e8 0c 07 00 00       	call   800a34 <cprintf>
+		if (first)
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800332:	75 60                	jne    800394 <umain+0x361>
+		first = 0;
+  800334:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  80033b:	00 00 00 
+		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  80033e:	83 ec 04             	sub    $0x4,%esp
+  800341:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800344:	50                   	push   %eax
+  800345:	68 00 b0 fe 0f       	push   $0xffeb000
+  80034a:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	e8 1b 1c 00 00       	call   801f6e <ipc_recv>
+		if (req < 0)
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	85 c0                	test   %eax,%eax
+  800358:	0f 88 d7 fe ff ff    	js     800235 <umain+0x202>
+		if (whom != input_envid)
+  80035e:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800361:	3b 15 00 70 80 00    	cmp    0x807000,%edx
+  800367:	0f 85 da fe ff ff    	jne    800247 <umain+0x214>
+		if (req != NSREQ_INPUT)
+  80036d:	83 f8 0a             	cmp    $0xa,%eax
+  800370:	0f 85 e3 fe ff ff    	jne    800259 <umain+0x226>
+		hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800376:	8b 0d 00 b0 fe 0f    	mov    0xffeb000,%ecx
+	char *out = NULL;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  800381:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  800386:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800389:	89 45 80             	mov    %eax,-0x80(%ebp)
+  80038c:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+	for (i = 0; i < len; i++) {
+  80038f:	e9 31 ff ff ff       	jmp    8002c5 <umain+0x292>
+			cprintf("Waiting for packets...\n");
+  800394:	83 ec 0c             	sub    $0xc,%esp
+  800397:	68 e5 4f 80 00       	push   $0x804fe5
+  80039c:	e8 93 06 00 00       	call   800a34 <cprintf>
+  8003a1:	83 c4 10             	add    $0x10,%esp
+  8003a4:	eb 8e                	jmp    800334 <umain+0x301>
+
+008003a6 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8003a6:	55                   	push   %ebp
+  8003a7:	89 e5                	mov    %esp,%ebp
+  8003a9:	57                   	push   %edi
+  8003aa:	56                   	push   %esi
+  8003ab:	53                   	push   %ebx
+  8003ac:	83 ec 1c             	sub    $0x1c,%esp
+  8003af:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  8003b2:	e8 2c 13 00 00       	call   8016e3 <sys_time_msec>
+  8003b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8003ba:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  8003bc:	c7 05 00 60 80 00 25 	movl   $0x805025,0x806000
+  8003c3:	50 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003c6:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8003c9:	eb 05                	jmp    8003d0 <timer+0x2a>
+			sys_yield();
+  8003cb:	e8 5a 10 00 00       	call   80142a <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  8003d0:	e8 0e 13 00 00       	call   8016e3 <sys_time_msec>
+  8003d5:	39 d8                	cmp    %ebx,%eax
+  8003d7:	73 16                	jae    8003ef <timer+0x49>
+  8003d9:	85 c0                	test   %eax,%eax
+  8003db:	79 ee                	jns    8003cb <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  8003dd:	50                   	push   %eax
+  8003de:	68 2e 50 80 00       	push   $0x80502e
+  8003e3:	6a 0f                	push   $0xf
+  8003e5:	68 40 50 80 00       	push   $0x805040
+  8003ea:	e8 6a 05 00 00       	call   800959 <_panic>
+		if (r < 0)
+  8003ef:	85 c0                	test   %eax,%eax
+  8003f1:	78 ea                	js     8003dd <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8003f3:	6a 00                	push   $0x0
+  8003f5:	6a 00                	push   $0x0
+  8003f7:	6a 0c                	push   $0xc
+  8003f9:	56                   	push   %esi
+  8003fa:	e8 65 1c 00 00       	call   802064 <ipc_send>
+  8003ff:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800402:	83 ec 04             	sub    $0x4,%esp
+  800405:	6a 00                	push   $0x0
+  800407:	6a 00                	push   $0x0
+  800409:	57                   	push   %edi
+  80040a:	e8 5f 1b 00 00       	call   801f6e <ipc_recv>
+  80040f:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  800411:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	39 f0                	cmp    %esi,%eax
+  800419:	75 09                	jne    800424 <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  80041b:	e8 c3 12 00 00       	call   8016e3 <sys_time_msec>
+  800420:	01 c3                	add    %eax,%ebx
+			break;
+  800422:	eb ac                	jmp    8003d0 <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  800424:	83 ec 08             	sub    $0x8,%esp
+  800427:	50                   	push   %eax
+  800428:	68 4c 50 80 00       	push   $0x80504c
+  80042d:	e8 02 06 00 00       	call   800a34 <cprintf>
+				continue;
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	eb cb                	jmp    800402 <timer+0x5c>
+
+00800437 <sleep>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void sleep(int ms)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	56                   	push   %esi
+  80043b:	53                   	push   %ebx
+  80043c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int now;
+	now = sys_time_msec();
+  80043f:	e8 9f 12 00 00       	call   8016e3 <sys_time_msec>
+  800444:	89 c3                	mov    %eax,%ebx
+	assert(now > 0);
+  800446:	85 c0                	test   %eax,%eax
+  800448:	7f 1b                	jg     800465 <sleep+0x2e>
+  80044a:	68 87 50 80 00       	push   $0x805087
+  80044f:	68 8f 50 80 00       	push   $0x80508f
+  800454:	6a 09                	push   $0x9
+  800456:	68 a4 50 80 00       	push   $0x8050a4
+  80045b:	e8 f9 04 00 00       	call   800959 <_panic>
+	while ((sys_time_msec() - now) < ms) {
+		sys_yield();
+  800460:	e8 c5 0f 00 00       	call   80142a <sys_yield>
+	while ((sys_time_msec() - now) < ms) {
+  800465:	e8 79 12 00 00       	call   8016e3 <sys_time_msec>
+  80046a:	29 d8                	sub    %ebx,%eax
+  80046c:	39 f0                	cmp    %esi,%eax
+  80046e:	72 f0                	jb     800460 <sleep+0x29>
+	}
+}
+  800470:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800473:	5b                   	pop    %ebx
+  800474:	5e                   	pop    %esi
+  800475:	5d                   	pop    %ebp
+  800476:	c3                   	ret
+
+00800477 <input>:
+
+void
+input(envid_t ns_envid)
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	57                   	push   %edi
+  80047b:	56                   	push   %esi
+  80047c:	53                   	push   %ebx
+  80047d:	83 ec 10             	sub    $0x10,%esp
+  800480:	8b 7d 08             	mov    0x8(%ebp),%edi
+	binaryname = "ns_input";
+  800483:	c7 05 00 60 80 00 b0 	movl   $0x8050b0,0x806000
+  80048a:	50 80 00 
+	// Hint: When you IPC a page to the network server, it will be
+	// reading from it for a while, so don't immediately receive
+	// another packet in to the same physical page.
+
+	// pre-copy before write to avoid page fault in kernel
+	sys_page_alloc(0, &nsipcbuf, PTE_P | PTE_U | PTE_W);
+  80048d:	6a 07                	push   $0x7
+  80048f:	68 00 90 80 00       	push   $0x809000
+  800494:	6a 00                	push   $0x0
+  800496:	e8 bb 0f 00 00       	call   801456 <sys_page_alloc>
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	e9 81 00 00 00       	jmp    800524 <input+0xad>
+	while (1) {
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+			// cprintf("jp_data %p, uvpt %x\n", nsipcbuf.pkt.jp_data, uvpt[PGNUM(&nsipcbuf)]);
+			recv_len = sys_net_try_recv((uint8_t*)nsipcbuf.pkt.jp_data, sizeof(nsipcbuf));
+			if (recv_len == -E_FULL_BUFFER) {
+				sys_yield();
+  8004a3:	e8 82 0f 00 00       	call   80142a <sys_yield>
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  8004a8:	83 ee 01             	sub    $0x1,%esi
+  8004ab:	74 4e                	je     8004fb <input+0x84>
+			recv_len = sys_net_try_recv((uint8_t*)nsipcbuf.pkt.jp_data, sizeof(nsipcbuf));
+  8004ad:	83 ec 08             	sub    $0x8,%esp
+  8004b0:	68 00 10 00 00       	push   $0x1000
+  8004b5:	68 04 90 80 00       	push   $0x809004
+  8004ba:	e8 7e 12 00 00       	call   80173d <sys_net_try_recv>
+  8004bf:	89 c3                	mov    %eax,%ebx
+			if (recv_len == -E_FULL_BUFFER) {
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8004c7:	74 da                	je     8004a3 <input+0x2c>
+				continue;
+			} else	if (recv_len >= 0) {
+  8004c9:	85 c0                	test   %eax,%eax
+  8004cb:	79 1d                	jns    8004ea <input+0x73>
+				cprintf("receive , len = %d\n", recv_len);
+				break;
+			}
+			else {
+				cprintf("recv failed, %e", recv_len);
+  8004cd:	83 ec 08             	sub    $0x8,%esp
+  8004d0:	50                   	push   %eax
+  8004d1:	68 cd 50 80 00       	push   $0x8050cd
+  8004d6:	e8 59 05 00 00       	call   800a34 <cprintf>
+				nsipcbuf.pkt.jp_len = 0;
+  8004db:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8004e2:	00 00 00 
+  8004e5:	83 c4 10             	add    $0x10,%esp
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  8004e8:	eb be                	jmp    8004a8 <input+0x31>
+				cprintf("receive , len = %d\n", recv_len);
+  8004ea:	83 ec 08             	sub    $0x8,%esp
+  8004ed:	50                   	push   %eax
+  8004ee:	68 b9 50 80 00       	push   $0x8050b9
+  8004f3:	e8 3c 05 00 00       	call   800a34 <cprintf>
+				break;
+  8004f8:	83 c4 10             	add    $0x10,%esp
+			}
+		}
+		if (recv_len > 0) {
+  8004fb:	85 db                	test   %ebx,%ebx
+  8004fd:	7e 18                	jle    800517 <input+0xa0>
+			nsipcbuf.pkt.jp_len = recv_len;
+  8004ff:	89 1d 00 90 80 00    	mov    %ebx,0x809000
+			ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, PTE_P | PTE_U | PTE_W);
+  800505:	6a 07                	push   $0x7
+  800507:	68 00 90 80 00       	push   $0x809000
+  80050c:	6a 0a                	push   $0xa
+  80050e:	57                   	push   %edi
+  80050f:	e8 50 1b 00 00       	call   802064 <ipc_send>
+  800514:	83 c4 10             	add    $0x10,%esp
+		}
+		sleep(50);
+  800517:	83 ec 0c             	sub    $0xc,%esp
+  80051a:	6a 32                	push   $0x32
+  80051c:	e8 16 ff ff ff       	call   800437 <sleep>
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  800521:	83 c4 10             	add    $0x10,%esp
+  800524:	be 65 00 00 00       	mov    $0x65,%esi
+  800529:	e9 7a ff ff ff       	jmp    8004a8 <input+0x31>
+
+0080052e <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	57                   	push   %edi
+  800532:	56                   	push   %esi
+  800533:	53                   	push   %ebx
+  800534:	83 ec 1c             	sub    $0x1c,%esp
+  800537:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_output";
+  80053a:	c7 05 00 60 80 00 dd 	movl   $0x8050dd,0x806000
+  800541:	50 80 00 
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	while (1) {
+		envid_t from;
+		int rsq, r;
+		rsq = ipc_recv(&from, (void*)&nsipcbuf, NULL);
+  800544:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  800547:	eb 14                	jmp    80055d <output+0x2f>
+		if (rsq != NSREQ_OUTPUT || from != ns_envid) {
+			cprintf("rsq is %x, from is %x\n", rsq, from);
+  800549:	83 ec 04             	sub    $0x4,%esp
+  80054c:	ff 75 e4             	push   -0x1c(%ebp)
+  80054f:	50                   	push   %eax
+  800550:	68 e7 50 80 00       	push   $0x8050e7
+  800555:	e8 da 04 00 00       	call   800a34 <cprintf>
+  80055a:	83 c4 10             	add    $0x10,%esp
+		rsq = ipc_recv(&from, (void*)&nsipcbuf, NULL);
+  80055d:	83 ec 04             	sub    $0x4,%esp
+  800560:	6a 00                	push   $0x0
+  800562:	68 00 90 80 00       	push   $0x809000
+  800567:	53                   	push   %ebx
+  800568:	e8 01 1a 00 00       	call   801f6e <ipc_recv>
+		if (rsq != NSREQ_OUTPUT || from != ns_envid) {
+  80056d:	83 c4 10             	add    $0x10,%esp
+  800570:	83 f8 0b             	cmp    $0xb,%eax
+  800573:	75 d4                	jne    800549 <output+0x1b>
+  800575:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800578:	75 cf                	jne    800549 <output+0x1b>
+  80057a:	bf 65 00 00 00       	mov    $0x65,%edi
+			continue;
+		}
+		int cnt = SEND_RETRY_TIME;
+		while (cnt && (r = sys_net_try_send((const uint8_t*)&nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) < 0) {
+  80057f:	83 ef 01             	sub    $0x1,%edi
+  800582:	74 d9                	je     80055d <output+0x2f>
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	ff 35 00 90 80 00    	push   0x809000
+  80058d:	68 04 90 80 00       	push   $0x809004
+  800592:	e8 78 11 00 00       	call   80170f <sys_net_try_send>
+  800597:	83 c4 10             	add    $0x10,%esp
+  80059a:	85 c0                	test   %eax,%eax
+  80059c:	79 bf                	jns    80055d <output+0x2f>
+			if (r == -E_FULL_BUFFER) {
+  80059e:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8005a1:	74 dc                	je     80057f <output+0x51>
+				--cnt;
+			}
+			else {
+				cprintf("pkg send failed, %e\n", r);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	50                   	push   %eax
+  8005a7:	68 fe 50 80 00       	push   $0x8050fe
+  8005ac:	e8 83 04 00 00       	call   800a34 <cprintf>
+				break;
+  8005b1:	83 c4 10             	add    $0x10,%esp
+  8005b4:	eb a7                	jmp    80055d <output+0x2f>
+
+008005b6 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8005b6:	55                   	push   %ebp
+  8005b7:	89 e5                	mov    %esp,%ebp
+  8005b9:	57                   	push   %edi
+  8005ba:	56                   	push   %esi
+  8005bb:	53                   	push   %ebx
+  8005bc:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8005bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8005c5:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8005c8:	b9 08 70 80 00       	mov    $0x807008,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8005cd:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8005d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d5:	eb 31                	jmp    800608 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8005d7:	0f b6 c8             	movzbl %al,%ecx
+  8005da:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  8005df:	88 0a                	mov    %cl,(%edx)
+  8005e1:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  8005e4:	83 e8 01             	sub    $0x1,%eax
+  8005e7:	3c ff                	cmp    $0xff,%al
+  8005e9:	75 ec                	jne    8005d7 <inet_ntoa+0x21>
+  8005eb:	0f b6 db             	movzbl %bl,%ebx
+  8005ee:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8005f1:	01 d8                	add    %ebx,%eax
+  8005f3:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  8005f5:	8d 40 01             	lea    0x1(%eax),%eax
+  8005f8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005fb:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  8005fe:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800601:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800604:	39 c7                	cmp    %eax,%edi
+  800606:	74 46                	je     80064e <inet_ntoa+0x98>
+  800608:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80060b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800610:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800613:	89 f0                	mov    %esi,%eax
+  800615:	f6 e2                	mul    %dl
+  800617:	66 c1 e8 0b          	shr    $0xb,%ax
+  80061b:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80061e:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800621:	01 c9                	add    %ecx,%ecx
+  800623:	89 d0                	mov    %edx,%eax
+  800625:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800627:	89 d7                	mov    %edx,%edi
+  800629:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80062d:	89 d9                	mov    %ebx,%ecx
+  80062f:	83 c3 01             	add    $0x1,%ebx
+  800632:	0f b6 c9             	movzbl %cl,%ecx
+  800635:	83 c0 30             	add    $0x30,%eax
+  800638:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80063c:	89 f8                	mov    %edi,%eax
+  80063e:	3c 09                	cmp    $0x9,%al
+  800640:	77 d1                	ja     800613 <inet_ntoa+0x5d>
+  800642:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800645:	88 17                	mov    %dl,(%edi)
+  800647:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80064a:	89 d8                	mov    %ebx,%eax
+  80064c:	eb 96                	jmp    8005e4 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80064e:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800651:	b8 08 70 80 00       	mov    $0x807008,%eax
+  800656:	83 c4 1c             	add    $0x1c,%esp
+  800659:	5b                   	pop    %ebx
+  80065a:	5e                   	pop    %esi
+  80065b:	5f                   	pop    %edi
+  80065c:	5d                   	pop    %ebp
+  80065d:	c3                   	ret
+
+0080065e <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80065e:	55                   	push   %ebp
+  80065f:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800661:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800665:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  800669:	5d                   	pop    %ebp
+  80066a:	c3                   	ret
+
+0080066b <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80066b:	55                   	push   %ebp
+  80066c:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80066e:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800672:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800676:	5d                   	pop    %ebp
+  800677:	c3                   	ret
+
+00800678 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800678:	55                   	push   %ebp
+  800679:	89 e5                	mov    %esp,%ebp
+  80067b:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80067e:	89 d0                	mov    %edx,%eax
+  800680:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  800683:	89 d1                	mov    %edx,%ecx
+  800685:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800688:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  80068a:	89 d1                	mov    %edx,%ecx
+  80068c:	c1 e1 08             	shl    $0x8,%ecx
+  80068f:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800695:	09 c8                	or     %ecx,%eax
+  800697:	c1 ea 08             	shr    $0x8,%edx
+  80069a:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8006a0:	09 d0                	or     %edx,%eax
+}
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <inet_aton>:
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	57                   	push   %edi
+  8006a8:	56                   	push   %esi
+  8006a9:	53                   	push   %ebx
+  8006aa:	83 ec 2c             	sub    $0x2c,%esp
+  8006ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8006b0:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8006b3:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8006b6:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8006b9:	e9 9b 00 00 00       	jmp    800759 <inet_aton+0xb5>
+      c = *++cp;
+  8006be:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8006c2:	89 c1                	mov    %eax,%ecx
+  8006c4:	83 e1 df             	and    $0xffffffdf,%ecx
+  8006c7:	80 f9 58             	cmp    $0x58,%cl
+  8006ca:	74 10                	je     8006dc <inet_aton+0x38>
+      c = *++cp;
+  8006cc:	83 c2 01             	add    $0x1,%edx
+  8006cf:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8006d2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006d7:	e9 97 00 00 00       	jmp    800773 <inet_aton+0xcf>
+        c = *++cp;
+  8006dc:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8006e0:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8006e3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006e8:	e9 86 00 00 00       	jmp    800773 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  8006ed:	0f af d7             	imul   %edi,%edx
+  8006f0:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8006f4:	0f be 01             	movsbl (%ecx),%eax
+  8006f7:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  8006fa:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8006fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800700:	80 fb 09             	cmp    $0x9,%bl
+  800703:	76 e8                	jbe    8006ed <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800705:	83 ff 10             	cmp    $0x10,%edi
+  800708:	75 2e                	jne    800738 <inet_aton+0x94>
+  80070a:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80070e:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800711:	83 e3 df             	and    $0xffffffdf,%ebx
+  800714:	83 eb 41             	sub    $0x41,%ebx
+  800717:	80 fb 05             	cmp    $0x5,%bl
+  80071a:	77 1c                	ja     800738 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80071c:	c1 e2 04             	shl    $0x4,%edx
+  80071f:	83 c0 0a             	add    $0xa,%eax
+  800722:	89 f3                	mov    %esi,%ebx
+  800724:	80 fb 1a             	cmp    $0x1a,%bl
+  800727:	19 db                	sbb    %ebx,%ebx
+  800729:	83 e3 20             	and    $0x20,%ebx
+  80072c:	83 c3 41             	add    $0x41,%ebx
+  80072f:	29 d8                	sub    %ebx,%eax
+  800731:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800733:	0f be 01             	movsbl (%ecx),%eax
+  800736:	eb bf                	jmp    8006f7 <inet_aton+0x53>
+    if (c == '.') {
+  800738:	83 f8 2e             	cmp    $0x2e,%eax
+  80073b:	75 43                	jne    800780 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80073d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800740:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800743:	39 f0                	cmp    %esi,%eax
+  800745:	0f 84 22 01 00 00    	je     80086d <inet_aton+0x1c9>
+      *pp++ = val;
+  80074b:	83 c0 04             	add    $0x4,%eax
+  80074e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800751:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800754:	89 ca                	mov    %ecx,%edx
+  800756:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800759:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80075c:	80 f9 09             	cmp    $0x9,%cl
+  80075f:	0f 87 01 01 00 00    	ja     800866 <inet_aton+0x1c2>
+    base = 10;
+  800765:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80076a:	83 f8 30             	cmp    $0x30,%eax
+  80076d:	0f 84 4b ff ff ff    	je     8006be <inet_aton+0x1a>
+  800773:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80077b:	e9 7a ff ff ff       	jmp    8006fa <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800780:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  800784:	89 d6                	mov    %edx,%esi
+  800786:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800789:	85 c0                	test   %eax,%eax
+  80078b:	74 2e                	je     8007bb <inet_aton+0x117>
+    return (0);
+  80078d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800792:	89 fa                	mov    %edi,%edx
+  800794:	80 fa 1f             	cmp    $0x1f,%dl
+  800797:	0f 86 d5 00 00 00    	jbe    800872 <inet_aton+0x1ce>
+  80079d:	84 c0                	test   %al,%al
+  80079f:	0f 88 cd 00 00 00    	js     800872 <inet_aton+0x1ce>
+  8007a5:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8007a8:	83 f9 04             	cmp    $0x4,%ecx
+  8007ab:	76 0e                	jbe    8007bb <inet_aton+0x117>
+    return (0);
+  8007ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8007b2:	83 f8 20             	cmp    $0x20,%eax
+  8007b5:	0f 85 b7 00 00 00    	jne    800872 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8007bb:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8007be:	89 d8                	mov    %ebx,%eax
+  8007c0:	29 c8                	sub    %ecx,%eax
+  8007c2:	c1 f8 02             	sar    $0x2,%eax
+  8007c5:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8007c8:	83 f8 02             	cmp    $0x2,%eax
+  8007cb:	74 7a                	je     800847 <inet_aton+0x1a3>
+  8007cd:	83 f9 03             	cmp    $0x3,%ecx
+  8007d0:	7f 49                	jg     80081b <inet_aton+0x177>
+  8007d2:	85 c9                	test   %ecx,%ecx
+  8007d4:	0f 84 98 00 00 00    	je     800872 <inet_aton+0x1ce>
+  8007da:	83 f9 02             	cmp    $0x2,%ecx
+  8007dd:	75 19                	jne    8007f8 <inet_aton+0x154>
+      return (0);
+  8007df:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8007e4:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8007ea:	0f 87 82 00 00 00    	ja     800872 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  8007f0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007f3:	c1 e0 18             	shl    $0x18,%eax
+  8007f6:	09 c6                	or     %eax,%esi
+  return (1);
+  8007f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  8007fd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800801:	74 6f                	je     800872 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800803:	83 ec 0c             	sub    $0xc,%esp
+  800806:	56                   	push   %esi
+  800807:	e8 6c fe ff ff       	call   800678 <htonl>
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800812:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800814:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800819:	eb 57                	jmp    800872 <inet_aton+0x1ce>
+  switch (n) {
+  80081b:	83 f9 04             	cmp    $0x4,%ecx
+  80081e:	75 d8                	jne    8007f8 <inet_aton+0x154>
+      return (0);
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800825:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80082b:	77 45                	ja     800872 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80082d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800830:	c1 e0 18             	shl    $0x18,%eax
+  800833:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800836:	c1 e1 10             	shl    $0x10,%ecx
+  800839:	09 c8                	or     %ecx,%eax
+  80083b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80083e:	c1 e1 08             	shl    $0x8,%ecx
+  800841:	09 c8                	or     %ecx,%eax
+  800843:	09 c6                	or     %eax,%esi
+    break;
+  800845:	eb b1                	jmp    8007f8 <inet_aton+0x154>
+      return (0);
+  800847:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80084c:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800852:	77 1e                	ja     800872 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800854:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800857:	c1 e0 18             	shl    $0x18,%eax
+  80085a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80085d:	c1 e1 10             	shl    $0x10,%ecx
+  800860:	09 c8                	or     %ecx,%eax
+  800862:	09 c6                	or     %eax,%esi
+    break;
+  800864:	eb 92                	jmp    8007f8 <inet_aton+0x154>
+      return (0);
+  800866:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086b:	eb 05                	jmp    800872 <inet_aton+0x1ce>
+        return (0);
+  80086d:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800872:	89 c8                	mov    %ecx,%eax
+  800874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800877:	5b                   	pop    %ebx
+  800878:	5e                   	pop    %esi
+  800879:	5f                   	pop    %edi
+  80087a:	5d                   	pop    %ebp
+  80087b:	c3                   	ret
+
+0080087c <inet_addr>:
+{
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  800882:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800885:	50                   	push   %eax
+  800886:	ff 75 08             	push   0x8(%ebp)
+  800889:	e8 16 fe ff ff       	call   8006a4 <inet_aton>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  800893:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  800898:	85 d2                	test   %edx,%edx
+  80089a:	75 02                	jne    80089e <inet_addr+0x22>
+}
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+    return (val.s_addr);
+  80089e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a1:	eb f9                	jmp    80089c <inet_addr+0x20>
+
+008008a3 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8008a9:	ff 75 08             	push   0x8(%ebp)
+  8008ac:	e8 c7 fd ff ff       	call   800678 <htonl>
+  8008b1:	83 c4 10             	add    $0x10,%esp
+}
+  8008b4:	c9                   	leave
+  8008b5:	c3                   	ret
+
+008008b6 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	57                   	push   %edi
+  8008ba:	56                   	push   %esi
+  8008bb:	53                   	push   %ebx
+  8008bc:	83 ec 1c             	sub    $0x1c,%esp
+  8008bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8008c5:	e8 34 0b 00 00       	call   8013fe <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8008ca:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8008cd:	89 15 e0 72 80 00    	mov    %edx,0x8072e0
+	thisenv = &envs[ENVX(eid)];
+  8008d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8008d8:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8008da:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8008dc:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8008e2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8008e7:	77 16                	ja     8008ff <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8008e9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8008ee:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8008f0:	c1 e8 10             	shr    $0x10,%eax
+  8008f3:	74 0a                	je     8008ff <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8008f5:	c1 e0 10             	shl    $0x10,%eax
+  8008f8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8008fd:	29 c2                	sub    %eax,%edx
+  8008ff:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800902:	c1 e0 04             	shl    $0x4,%eax
+  800905:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80090a:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80090c:	85 db                	test   %ebx,%ebx
+  80090e:	7e 07                	jle    800917 <libmain+0x61>
+		binaryname = argv[0];
+  800910:	8b 06                	mov    (%esi),%eax
+  800912:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800917:	83 ec 08             	sub    $0x8,%esp
+  80091a:	56                   	push   %esi
+  80091b:	53                   	push   %ebx
+  80091c:	e8 12 f7 ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800921:	e8 0b 00 00 00       	call   800931 <exit>
+}
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80092c:	5b                   	pop    %ebx
+  80092d:	5e                   	pop    %esi
+  80092e:	5f                   	pop    %edi
+  80092f:	5d                   	pop    %ebp
+  800930:	c3                   	ret
+
+00800931 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800931:	55                   	push   %ebp
+  800932:	89 e5                	mov    %esp,%ebp
+  800934:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800937:	6a 00                	push   $0x0
+  800939:	e8 16 29 00 00       	call   803254 <fflush>
+	pthread_kill_others();
+  80093e:	e8 81 3f 00 00       	call   8048c4 <pthread_kill_others>
+	close_all();
+  800943:	e8 af 19 00 00       	call   8022f7 <close_all>
+	sys_env_destroy(0);
+  800948:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80094f:	e8 5f 0a 00 00       	call   8013b3 <sys_env_destroy>
+}
+  800954:	83 c4 10             	add    $0x10,%esp
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+
+00800959 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	56                   	push   %esi
+  80095d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80095e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800961:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800967:	e8 92 0a 00 00       	call   8013fe <sys_getenvid>
+  80096c:	83 ec 0c             	sub    $0xc,%esp
+  80096f:	ff 75 0c             	push   0xc(%ebp)
+  800972:	ff 75 08             	push   0x8(%ebp)
+  800975:	56                   	push   %esi
+  800976:	50                   	push   %eax
+  800977:	68 20 51 80 00       	push   $0x805120
+  80097c:	e8 b3 00 00 00       	call   800a34 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800981:	83 c4 18             	add    $0x18,%esp
+  800984:	53                   	push   %ebx
+  800985:	ff 75 10             	push   0x10(%ebp)
+  800988:	e8 56 00 00 00       	call   8009e3 <vcprintf>
+	cprintf("\n");
+  80098d:	c7 04 24 fb 4f 80 00 	movl   $0x804ffb,(%esp)
+  800994:	e8 9b 00 00 00       	call   800a34 <cprintf>
+  800999:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80099c:	cc                   	int3
+	while (1)
+  80099d:	eb fd                	jmp    80099c <_panic+0x43>
+
+0080099f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	53                   	push   %ebx
+  8009a3:	83 ec 04             	sub    $0x4,%esp
+  8009a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8009a9:	8b 13                	mov    (%ebx),%edx
+  8009ab:	8d 42 01             	lea    0x1(%edx),%eax
+  8009ae:	89 03                	mov    %eax,(%ebx)
+  8009b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8009b7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8009bc:	74 09                	je     8009c7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8009be:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8009c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c5:	c9                   	leave
+  8009c6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	68 ff 00 00 00       	push   $0xff
+  8009cf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8009d2:	50                   	push   %eax
+  8009d3:	e8 84 09 00 00       	call   80135c <sys_cputs>
+		b->idx = 0;
+  8009d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8009de:	83 c4 10             	add    $0x10,%esp
+  8009e1:	eb db                	jmp    8009be <putch+0x1f>
+
+008009e3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8009ec:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8009f3:	00 00 00 
+	b.cnt = 0;
+  8009f6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8009fd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800a00:	ff 75 0c             	push   0xc(%ebp)
+  800a03:	ff 75 08             	push   0x8(%ebp)
+  800a06:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800a0c:	50                   	push   %eax
+  800a0d:	68 9f 09 80 00       	push   $0x80099f
+  800a12:	e8 14 01 00 00       	call   800b2b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800a17:	83 c4 08             	add    $0x8,%esp
+  800a1a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800a20:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800a26:	50                   	push   %eax
+  800a27:	e8 30 09 00 00       	call   80135c <sys_cputs>
+
+	return b.cnt;
+}
+  800a2c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800a32:	c9                   	leave
+  800a33:	c3                   	ret
+
+00800a34 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800a3a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800a3d:	50                   	push   %eax
+  800a3e:	ff 75 08             	push   0x8(%ebp)
+  800a41:	e8 9d ff ff ff       	call   8009e3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800a46:	c9                   	leave
+  800a47:	c3                   	ret
+
+00800a48 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	57                   	push   %edi
+  800a4c:	56                   	push   %esi
+  800a4d:	53                   	push   %ebx
+  800a4e:	83 ec 1c             	sub    $0x1c,%esp
+  800a51:	89 c7                	mov    %eax,%edi
+  800a53:	89 d6                	mov    %edx,%esi
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5b:	89 d1                	mov    %edx,%ecx
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a62:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a65:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a68:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800a6b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a6e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800a75:	39 c2                	cmp    %eax,%edx
+  800a77:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800a7a:	72 3e                	jb     800aba <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800a7c:	83 ec 0c             	sub    $0xc,%esp
+  800a7f:	ff 75 18             	push   0x18(%ebp)
+  800a82:	83 eb 01             	sub    $0x1,%ebx
+  800a85:	53                   	push   %ebx
+  800a86:	50                   	push   %eax
+  800a87:	83 ec 08             	sub    $0x8,%esp
+  800a8a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a8d:	ff 75 e0             	push   -0x20(%ebp)
+  800a90:	ff 75 dc             	push   -0x24(%ebp)
+  800a93:	ff 75 d8             	push   -0x28(%ebp)
+  800a96:	e8 21 43 00 00       	call   804dbc <__udivdi3>
+  800a9b:	83 c4 18             	add    $0x18,%esp
+  800a9e:	52                   	push   %edx
+  800a9f:	50                   	push   %eax
+  800aa0:	89 f2                	mov    %esi,%edx
+  800aa2:	89 f8                	mov    %edi,%eax
+  800aa4:	e8 9f ff ff ff       	call   800a48 <printnum>
+  800aa9:	83 c4 20             	add    $0x20,%esp
+  800aac:	eb 13                	jmp    800ac1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800aae:	83 ec 08             	sub    $0x8,%esp
+  800ab1:	56                   	push   %esi
+  800ab2:	ff 75 18             	push   0x18(%ebp)
+  800ab5:	ff d7                	call   *%edi
+  800ab7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800aba:	83 eb 01             	sub    $0x1,%ebx
+  800abd:	85 db                	test   %ebx,%ebx
+  800abf:	7f ed                	jg     800aae <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800ac1:	83 ec 08             	sub    $0x8,%esp
+  800ac4:	56                   	push   %esi
+  800ac5:	83 ec 04             	sub    $0x4,%esp
+  800ac8:	ff 75 e4             	push   -0x1c(%ebp)
+  800acb:	ff 75 e0             	push   -0x20(%ebp)
+  800ace:	ff 75 dc             	push   -0x24(%ebp)
+  800ad1:	ff 75 d8             	push   -0x28(%ebp)
+  800ad4:	e8 04 43 00 00       	call   804ddd <__umoddi3>
+  800ad9:	83 c4 14             	add    $0x14,%esp
+  800adc:	0f be 80 43 51 80 00 	movsbl 0x805143(%eax),%eax
+  800ae3:	50                   	push   %eax
+  800ae4:	ff d7                	call   *%edi
+}
+  800ae6:	83 c4 10             	add    $0x10,%esp
+  800ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800af7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800afb:	8b 10                	mov    (%eax),%edx
+  800afd:	3b 50 04             	cmp    0x4(%eax),%edx
+  800b00:	73 0a                	jae    800b0c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800b02:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800b05:	89 08                	mov    %ecx,(%eax)
+  800b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0a:	88 02                	mov    %al,(%edx)
+}
+  800b0c:	5d                   	pop    %ebp
+  800b0d:	c3                   	ret
+
+00800b0e <printfmt>:
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800b14:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800b17:	50                   	push   %eax
+  800b18:	ff 75 10             	push   0x10(%ebp)
+  800b1b:	ff 75 0c             	push   0xc(%ebp)
+  800b1e:	ff 75 08             	push   0x8(%ebp)
+  800b21:	e8 05 00 00 00       	call   800b2b <vprintfmt>
+}
+  800b26:	83 c4 10             	add    $0x10,%esp
+  800b29:	c9                   	leave
+  800b2a:	c3                   	ret
+
+00800b2b <vprintfmt>:
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	57                   	push   %edi
+  800b2f:	56                   	push   %esi
+  800b30:	53                   	push   %ebx
+  800b31:	83 ec 2c             	sub    $0x2c,%esp
+  800b34:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b3a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800b3d:	eb 0a                	jmp    800b49 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800b3f:	83 ec 08             	sub    $0x8,%esp
+  800b42:	53                   	push   %ebx
+  800b43:	50                   	push   %eax
+  800b44:	ff d6                	call   *%esi
+  800b46:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800b49:	83 c7 01             	add    $0x1,%edi
+  800b4c:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800b50:	83 f8 25             	cmp    $0x25,%eax
+  800b53:	74 0c                	je     800b61 <vprintfmt+0x36>
+			if (ch == '\0')
+  800b55:	85 c0                	test   %eax,%eax
+  800b57:	75 e6                	jne    800b3f <vprintfmt+0x14>
+}
+  800b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+		padc = ' ';
+  800b61:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800b65:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800b6c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800b73:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800b7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800b7f:	8d 47 01             	lea    0x1(%edi),%eax
+  800b82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b85:	0f b6 17             	movzbl (%edi),%edx
+  800b88:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800b8b:	3c 55                	cmp    $0x55,%al
+  800b8d:	0f 87 c5 03 00 00    	ja     800f58 <vprintfmt+0x42d>
+  800b93:	0f b6 c0             	movzbl %al,%eax
+  800b96:	ff 24 85 c0 52 80 00 	jmp    *0x8052c0(,%eax,4)
+  800b9d:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800ba0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ba3:	eb da                	jmp    800b7f <vprintfmt+0x54>
+  800ba5:	0f be d2             	movsbl %dl,%edx
+  800ba8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800bb3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800bb6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800bba:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800bbd:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800bc0:	83 f9 09             	cmp    $0x9,%ecx
+  800bc3:	77 55                	ja     800c1a <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800bc5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800bc8:	eb e9                	jmp    800bb3 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcd:	8b 00                	mov    (%eax),%eax
+  800bcf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800bd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd5:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800bdb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800bde:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800be2:	79 9b                	jns    800b7f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800be4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800be7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800bea:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800bf1:	eb 8c                	jmp    800b7f <vprintfmt+0x54>
+			if (width < 0)
+  800bf3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800bf6:	85 d2                	test   %edx,%edx
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfd:	0f 49 c2             	cmovns %edx,%eax
+  800c00:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800c03:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800c06:	e9 74 ff ff ff       	jmp    800b7f <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800c0b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800c0e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800c15:	e9 65 ff ff ff       	jmp    800b7f <vprintfmt+0x54>
+  800c1a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800c1d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800c20:	eb bc                	jmp    800bde <vprintfmt+0xb3>
+			lflag++;
+  800c22:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800c25:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800c28:	e9 52 ff ff ff       	jmp    800b7f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800c2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c30:	8d 78 04             	lea    0x4(%eax),%edi
+  800c33:	83 ec 08             	sub    $0x8,%esp
+  800c36:	53                   	push   %ebx
+  800c37:	ff 30                	push   (%eax)
+  800c39:	ff d6                	call   *%esi
+			break;
+  800c3b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800c3e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800c41:	e9 b1 02 00 00       	jmp    800ef7 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800c46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c49:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800c4c:	8b 10                	mov    (%eax),%edx
+  800c4e:	89 d0                	mov    %edx,%eax
+  800c50:	f7 d8                	neg    %eax
+  800c52:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c55:	83 f8 14             	cmp    $0x14,%eax
+  800c58:	7f 23                	jg     800c7d <vprintfmt+0x152>
+  800c5a:	8b 14 85 20 54 80 00 	mov    0x805420(,%eax,4),%edx
+  800c61:	85 d2                	test   %edx,%edx
+  800c63:	74 18                	je     800c7d <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800c65:	52                   	push   %edx
+  800c66:	68 a1 50 80 00       	push   $0x8050a1
+  800c6b:	53                   	push   %ebx
+  800c6c:	56                   	push   %esi
+  800c6d:	e8 9c fe ff ff       	call   800b0e <printfmt>
+  800c72:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800c75:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800c78:	e9 7a 02 00 00       	jmp    800ef7 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800c7d:	50                   	push   %eax
+  800c7e:	68 5b 51 80 00       	push   $0x80515b
+  800c83:	53                   	push   %ebx
+  800c84:	56                   	push   %esi
+  800c85:	e8 84 fe ff ff       	call   800b0e <printfmt>
+  800c8a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800c8d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800c90:	e9 62 02 00 00       	jmp    800ef7 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c98:	83 c0 04             	add    $0x4,%eax
+  800c9b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800c9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800ca3:	85 c9                	test   %ecx,%ecx
+  800ca5:	b8 54 51 80 00       	mov    $0x805154,%eax
+  800caa:	0f 45 c1             	cmovne %ecx,%eax
+  800cad:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800cb0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800cb4:	7e 06                	jle    800cbc <vprintfmt+0x191>
+  800cb6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800cba:	75 0b                	jne    800cc7 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800cbc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800cbf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800cc2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cc5:	eb 5c                	jmp    800d23 <vprintfmt+0x1f8>
+  800cc7:	83 ec 08             	sub    $0x8,%esp
+  800cca:	ff 75 d0             	push   -0x30(%ebp)
+  800ccd:	ff 75 cc             	push   -0x34(%ebp)
+  800cd0:	e8 20 03 00 00       	call   800ff5 <strnlen>
+  800cd5:	89 c2                	mov    %eax,%edx
+  800cd7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cda:	29 d0                	sub    %edx,%eax
+  800cdc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800cdf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800ce3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ce6:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ce9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ceb:	eb 0e                	jmp    800cfb <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800ced:	83 ec 08             	sub    $0x8,%esp
+  800cf0:	53                   	push   %ebx
+  800cf1:	57                   	push   %edi
+  800cf2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800cf5:	83 ee 01             	sub    $0x1,%esi
+  800cf8:	83 c4 10             	add    $0x10,%esp
+  800cfb:	85 f6                	test   %esi,%esi
+  800cfd:	7f ee                	jg     800ced <vprintfmt+0x1c2>
+  800cff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800d02:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0c:	0f 49 d0             	cmovns %eax,%edx
+  800d0f:	29 d0                	sub    %edx,%eax
+  800d11:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d14:	eb a6                	jmp    800cbc <vprintfmt+0x191>
+					putch(ch, putdat);
+  800d16:	83 ec 08             	sub    $0x8,%esp
+  800d19:	53                   	push   %ebx
+  800d1a:	52                   	push   %edx
+  800d1b:	ff 55 08             	call   *0x8(%ebp)
+  800d1e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d21:	89 f1                	mov    %esi,%ecx
+  800d23:	8d 71 01             	lea    0x1(%ecx),%esi
+  800d26:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800d2a:	0f be d0             	movsbl %al,%edx
+  800d2d:	85 d2                	test   %edx,%edx
+  800d2f:	74 28                	je     800d59 <vprintfmt+0x22e>
+  800d31:	85 ff                	test   %edi,%edi
+  800d33:	78 05                	js     800d3a <vprintfmt+0x20f>
+  800d35:	83 ef 01             	sub    $0x1,%edi
+  800d38:	78 30                	js     800d6a <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800d3a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800d3e:	74 d6                	je     800d16 <vprintfmt+0x1eb>
+  800d40:	0f be c0             	movsbl %al,%eax
+  800d43:	83 e8 20             	sub    $0x20,%eax
+  800d46:	83 f8 5e             	cmp    $0x5e,%eax
+  800d49:	76 cb                	jbe    800d16 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800d4b:	83 ec 08             	sub    $0x8,%esp
+  800d4e:	53                   	push   %ebx
+  800d4f:	6a 3f                	push   $0x3f
+  800d51:	ff 55 08             	call   *0x8(%ebp)
+  800d54:	83 c4 10             	add    $0x10,%esp
+  800d57:	eb c8                	jmp    800d21 <vprintfmt+0x1f6>
+  800d59:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d5c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d5f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800d62:	01 d0                	add    %edx,%eax
+  800d64:	29 c8                	sub    %ecx,%eax
+  800d66:	89 c7                	mov    %eax,%edi
+  800d68:	eb 13                	jmp    800d7d <vprintfmt+0x252>
+  800d6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d6d:	eb ed                	jmp    800d5c <vprintfmt+0x231>
+				putch(' ', putdat);
+  800d6f:	83 ec 08             	sub    $0x8,%esp
+  800d72:	53                   	push   %ebx
+  800d73:	6a 20                	push   $0x20
+  800d75:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800d77:	83 ef 01             	sub    $0x1,%edi
+  800d7a:	83 c4 10             	add    $0x10,%esp
+  800d7d:	85 ff                	test   %edi,%edi
+  800d7f:	7f ee                	jg     800d6f <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d81:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800d84:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d87:	e9 6b 01 00 00       	jmp    800ef7 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800d8c:	83 f9 01             	cmp    $0x1,%ecx
+  800d8f:	7f 1f                	jg     800db0 <vprintfmt+0x285>
+	else if (lflag)
+  800d91:	85 c9                	test   %ecx,%ecx
+  800d93:	74 67                	je     800dfc <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800d95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d98:	8b 00                	mov    (%eax),%eax
+  800d9a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d9d:	89 c1                	mov    %eax,%ecx
+  800d9f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800da2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800da5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800da8:	8d 40 04             	lea    0x4(%eax),%eax
+  800dab:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dae:	eb 17                	jmp    800dc7 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800db0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800db3:	8b 50 04             	mov    0x4(%eax),%edx
+  800db6:	8b 00                	mov    (%eax),%eax
+  800db8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800dbb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800dbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dc1:	8d 40 08             	lea    0x8(%eax),%eax
+  800dc4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800dc7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800dca:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800dcd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800dd2:	85 c9                	test   %ecx,%ecx
+  800dd4:	0f 89 03 01 00 00    	jns    800edd <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800dda:	83 ec 08             	sub    $0x8,%esp
+  800ddd:	53                   	push   %ebx
+  800dde:	6a 2d                	push   $0x2d
+  800de0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800de2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800de5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800de8:	f7 da                	neg    %edx
+  800dea:	83 d1 00             	adc    $0x0,%ecx
+  800ded:	f7 d9                	neg    %ecx
+  800def:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800df2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800df7:	e9 e1 00 00 00       	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800dfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dff:	8b 00                	mov    (%eax),%eax
+  800e01:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e04:	89 c1                	mov    %eax,%ecx
+  800e06:	c1 f9 1f             	sar    $0x1f,%ecx
+  800e09:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800e12:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e15:	eb b0                	jmp    800dc7 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800e17:	83 f9 01             	cmp    $0x1,%ecx
+  800e1a:	7f 1e                	jg     800e3a <vprintfmt+0x30f>
+	else if (lflag)
+  800e1c:	85 c9                	test   %ecx,%ecx
+  800e1e:	74 32                	je     800e52 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800e20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e23:	8b 10                	mov    (%eax),%edx
+  800e25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e2a:	8d 40 04             	lea    0x4(%eax),%eax
+  800e2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800e30:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800e35:	e9 a3 00 00 00       	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800e3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e3d:	8b 10                	mov    (%eax),%edx
+  800e3f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e42:	8d 40 08             	lea    0x8(%eax),%eax
+  800e45:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800e48:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800e4d:	e9 8b 00 00 00       	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800e52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e55:	8b 10                	mov    (%eax),%edx
+  800e57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e5f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800e62:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800e67:	eb 74                	jmp    800edd <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800e69:	83 f9 01             	cmp    $0x1,%ecx
+  800e6c:	7f 1b                	jg     800e89 <vprintfmt+0x35e>
+	else if (lflag)
+  800e6e:	85 c9                	test   %ecx,%ecx
+  800e70:	74 2c                	je     800e9e <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800e72:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e75:	8b 10                	mov    (%eax),%edx
+  800e77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e7f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e82:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800e87:	eb 54                	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800e89:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8c:	8b 10                	mov    (%eax),%edx
+  800e8e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e91:	8d 40 08             	lea    0x8(%eax),%eax
+  800e94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e97:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800e9c:	eb 3f                	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800e9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea1:	8b 10                	mov    (%eax),%edx
+  800ea3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea8:	8d 40 04             	lea    0x4(%eax),%eax
+  800eab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800eae:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800eb3:	eb 28                	jmp    800edd <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800eb5:	83 ec 08             	sub    $0x8,%esp
+  800eb8:	53                   	push   %ebx
+  800eb9:	6a 30                	push   $0x30
+  800ebb:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ebd:	83 c4 08             	add    $0x8,%esp
+  800ec0:	53                   	push   %ebx
+  800ec1:	6a 78                	push   $0x78
+  800ec3:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800ec5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ec8:	8b 10                	mov    (%eax),%edx
+  800eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800ecf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800ed2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ed5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ed8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ee4:	50                   	push   %eax
+  800ee5:	ff 75 e0             	push   -0x20(%ebp)
+  800ee8:	57                   	push   %edi
+  800ee9:	51                   	push   %ecx
+  800eea:	52                   	push   %edx
+  800eeb:	89 da                	mov    %ebx,%edx
+  800eed:	89 f0                	mov    %esi,%eax
+  800eef:	e8 54 fb ff ff       	call   800a48 <printnum>
+			break;
+  800ef4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ef7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800efa:	e9 4a fc ff ff       	jmp    800b49 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800eff:	83 f9 01             	cmp    $0x1,%ecx
+  800f02:	7f 1b                	jg     800f1f <vprintfmt+0x3f4>
+	else if (lflag)
+  800f04:	85 c9                	test   %ecx,%ecx
+  800f06:	74 2c                	je     800f34 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800f08:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f0b:	8b 10                	mov    (%eax),%edx
+  800f0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f12:	8d 40 04             	lea    0x4(%eax),%eax
+  800f15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f18:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800f1d:	eb be                	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800f1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f22:	8b 10                	mov    (%eax),%edx
+  800f24:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f27:	8d 40 08             	lea    0x8(%eax),%eax
+  800f2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f2d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800f32:	eb a9                	jmp    800edd <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800f34:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f37:	8b 10                	mov    (%eax),%edx
+  800f39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f3e:	8d 40 04             	lea    0x4(%eax),%eax
+  800f41:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f44:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800f49:	eb 92                	jmp    800edd <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800f4b:	83 ec 08             	sub    $0x8,%esp
+  800f4e:	53                   	push   %ebx
+  800f4f:	6a 25                	push   $0x25
+  800f51:	ff d6                	call   *%esi
+			break;
+  800f53:	83 c4 10             	add    $0x10,%esp
+  800f56:	eb 9f                	jmp    800ef7 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800f58:	83 ec 08             	sub    $0x8,%esp
+  800f5b:	53                   	push   %ebx
+  800f5c:	6a 25                	push   $0x25
+  800f5e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800f60:	83 c4 10             	add    $0x10,%esp
+  800f63:	89 f8                	mov    %edi,%eax
+  800f65:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800f69:	74 05                	je     800f70 <vprintfmt+0x445>
+  800f6b:	83 e8 01             	sub    $0x1,%eax
+  800f6e:	eb f5                	jmp    800f65 <vprintfmt+0x43a>
+  800f70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800f73:	eb 82                	jmp    800ef7 <vprintfmt+0x3cc>
+
+00800f75 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	83 ec 18             	sub    $0x18,%esp
+  800f7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f81:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800f84:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800f88:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800f8b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	74 26                	je     800fbc <vsnprintf+0x47>
+  800f96:	85 d2                	test   %edx,%edx
+  800f98:	7e 22                	jle    800fbc <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800f9a:	ff 75 14             	push   0x14(%ebp)
+  800f9d:	ff 75 10             	push   0x10(%ebp)
+  800fa0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800fa3:	50                   	push   %eax
+  800fa4:	68 f1 0a 80 00       	push   $0x800af1
+  800fa9:	e8 7d fb ff ff       	call   800b2b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800fae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fb1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800fb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800fb7:	83 c4 10             	add    $0x10,%esp
+}
+  800fba:	c9                   	leave
+  800fbb:	c3                   	ret
+		return -E_INVAL;
+  800fbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fc1:	eb f7                	jmp    800fba <vsnprintf+0x45>
+
+00800fc3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800fc9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800fcc:	50                   	push   %eax
+  800fcd:	ff 75 10             	push   0x10(%ebp)
+  800fd0:	ff 75 0c             	push   0xc(%ebp)
+  800fd3:	ff 75 08             	push   0x8(%ebp)
+  800fd6:	e8 9a ff ff ff       	call   800f75 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800fdb:	c9                   	leave
+  800fdc:	c3                   	ret
+
+00800fdd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe8:	eb 03                	jmp    800fed <strlen+0x10>
+		n++;
+  800fea:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800fed:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ff1:	75 f7                	jne    800fea <strlen+0xd>
+	return n;
+}
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ffb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801003:	eb 03                	jmp    801008 <strnlen+0x13>
+		n++;
+  801005:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801008:	39 d0                	cmp    %edx,%eax
+  80100a:	74 08                	je     801014 <strnlen+0x1f>
+  80100c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801010:	75 f3                	jne    801005 <strnlen+0x10>
+  801012:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801014:	89 d0                	mov    %edx,%eax
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+
+00801018 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	53                   	push   %ebx
+  80101c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80101f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801022:	b8 00 00 00 00       	mov    $0x0,%eax
+  801027:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80102b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80102e:	83 c0 01             	add    $0x1,%eax
+  801031:	84 d2                	test   %dl,%dl
+  801033:	75 f2                	jne    801027 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801035:	89 c8                	mov    %ecx,%eax
+  801037:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103a:	c9                   	leave
+  80103b:	c3                   	ret
+
+0080103c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	53                   	push   %ebx
+  801040:	83 ec 10             	sub    $0x10,%esp
+  801043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801046:	53                   	push   %ebx
+  801047:	e8 91 ff ff ff       	call   800fdd <strlen>
+  80104c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80104f:	ff 75 0c             	push   0xc(%ebp)
+  801052:	01 d8                	add    %ebx,%eax
+  801054:	50                   	push   %eax
+  801055:	e8 be ff ff ff       	call   801018 <strcpy>
+	return dst;
+}
+  80105a:	89 d8                	mov    %ebx,%eax
+  80105c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80105f:	c9                   	leave
+  801060:	c3                   	ret
+
+00801061 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  801066:	8b 75 08             	mov    0x8(%ebp),%esi
+  801069:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80106c:	89 f3                	mov    %esi,%ebx
+  80106e:	03 5d 10             	add    0x10(%ebp),%ebx
+  801071:	89 f0                	mov    %esi,%eax
+  801073:	eb 0f                	jmp    801084 <strncpy+0x23>
+		*dst++ = *src;
+  801075:	83 c0 01             	add    $0x1,%eax
+  801078:	0f b6 0a             	movzbl (%edx),%ecx
+  80107b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80107e:	80 f9 01             	cmp    $0x1,%cl
+  801081:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801084:	39 d8                	cmp    %ebx,%eax
+  801086:	75 ed                	jne    801075 <strncpy+0x14>
+	}
+	return ret;
+}
+  801088:	89 f0                	mov    %esi,%eax
+  80108a:	5b                   	pop    %ebx
+  80108b:	5e                   	pop    %esi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+  801093:	8b 75 08             	mov    0x8(%ebp),%esi
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80109c:	89 f0                	mov    %esi,%eax
+  80109e:	85 d2                	test   %edx,%edx
+  8010a0:	74 21                	je     8010c3 <strlcpy+0x35>
+  8010a2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8010a6:	89 f2                	mov    %esi,%edx
+  8010a8:	eb 09                	jmp    8010b3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8010aa:	83 c1 01             	add    $0x1,%ecx
+  8010ad:	83 c2 01             	add    $0x1,%edx
+  8010b0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8010b3:	39 c2                	cmp    %eax,%edx
+  8010b5:	74 09                	je     8010c0 <strlcpy+0x32>
+  8010b7:	0f b6 19             	movzbl (%ecx),%ebx
+  8010ba:	84 db                	test   %bl,%bl
+  8010bc:	75 ec                	jne    8010aa <strlcpy+0x1c>
+  8010be:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8010c0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8010c3:	29 f0                	sub    %esi,%eax
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+
+008010c9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8010cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8010d2:	eb 06                	jmp    8010da <strcmp+0x11>
+		p++, q++;
+  8010d4:	83 c1 01             	add    $0x1,%ecx
+  8010d7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8010da:	0f b6 01             	movzbl (%ecx),%eax
+  8010dd:	84 c0                	test   %al,%al
+  8010df:	74 04                	je     8010e5 <strcmp+0x1c>
+  8010e1:	3a 02                	cmp    (%edx),%al
+  8010e3:	74 ef                	je     8010d4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010e5:	0f b6 c0             	movzbl %al,%eax
+  8010e8:	0f b6 12             	movzbl (%edx),%edx
+  8010eb:	29 d0                	sub    %edx,%eax
+}
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+
+008010ef <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	53                   	push   %ebx
+  8010f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8010fc:	eb 09                	jmp    801107 <strncmp+0x18>
+		n--, p++, q++;
+  8010fe:	83 ea 01             	sub    $0x1,%edx
+  801101:	83 c0 01             	add    $0x1,%eax
+  801104:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801107:	85 d2                	test   %edx,%edx
+  801109:	74 18                	je     801123 <strncmp+0x34>
+  80110b:	0f b6 18             	movzbl (%eax),%ebx
+  80110e:	84 db                	test   %bl,%bl
+  801110:	74 04                	je     801116 <strncmp+0x27>
+  801112:	3a 19                	cmp    (%ecx),%bl
+  801114:	74 e8                	je     8010fe <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801116:	0f b6 00             	movzbl (%eax),%eax
+  801119:	0f b6 11             	movzbl (%ecx),%edx
+  80111c:	29 d0                	sub    %edx,%eax
+}
+  80111e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801121:	c9                   	leave
+  801122:	c3                   	ret
+		return 0;
+  801123:	b8 00 00 00 00       	mov    $0x0,%eax
+  801128:	eb f4                	jmp    80111e <strncmp+0x2f>
+
+0080112a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801130:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801134:	eb 03                	jmp    801139 <strchr+0xf>
+  801136:	83 c0 01             	add    $0x1,%eax
+  801139:	0f b6 10             	movzbl (%eax),%edx
+  80113c:	84 d2                	test   %dl,%dl
+  80113e:	74 06                	je     801146 <strchr+0x1c>
+		if (*s == c)
+  801140:	38 ca                	cmp    %cl,%dl
+  801142:	75 f2                	jne    801136 <strchr+0xc>
+  801144:	eb 05                	jmp    80114b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801146:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+
+0080114d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80114d:	55                   	push   %ebp
+  80114e:	89 e5                	mov    %esp,%ebp
+  801150:	8b 45 08             	mov    0x8(%ebp),%eax
+  801153:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801157:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80115a:	38 ca                	cmp    %cl,%dl
+  80115c:	74 09                	je     801167 <strfind+0x1a>
+  80115e:	84 d2                	test   %dl,%dl
+  801160:	74 05                	je     801167 <strfind+0x1a>
+	for (; *s; s++)
+  801162:	83 c0 01             	add    $0x1,%eax
+  801165:	eb f0                	jmp    801157 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+
+00801169 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801170:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801173:	85 c9                	test   %ecx,%ecx
+  801175:	74 20                	je     801197 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801177:	89 f8                	mov    %edi,%eax
+  801179:	09 c8                	or     %ecx,%eax
+  80117b:	a8 03                	test   $0x3,%al
+  80117d:	75 12                	jne    801191 <memset+0x28>
+		c &= 0xFF;
+  80117f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801183:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801189:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80118c:	fc                   	cld
+  80118d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80118f:	eb 06                	jmp    801197 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801194:	fc                   	cld
+  801195:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801197:	89 f8                	mov    %edi,%eax
+  801199:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+
+0080119e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8011ac:	39 c6                	cmp    %eax,%esi
+  8011ae:	73 32                	jae    8011e2 <memmove+0x44>
+  8011b0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8011b3:	39 d0                	cmp    %edx,%eax
+  8011b5:	73 2b                	jae    8011e2 <memmove+0x44>
+		s += n;
+		d += n;
+  8011b7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8011ba:	89 d6                	mov    %edx,%esi
+  8011bc:	09 fe                	or     %edi,%esi
+  8011be:	09 ce                	or     %ecx,%esi
+  8011c0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8011c6:	75 0e                	jne    8011d6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8011c8:	83 ef 04             	sub    $0x4,%edi
+  8011cb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8011ce:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8011d1:	fd                   	std
+  8011d2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8011d4:	eb 09                	jmp    8011df <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8011d6:	83 ef 01             	sub    $0x1,%edi
+  8011d9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8011dc:	fd                   	std
+  8011dd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8011df:	fc                   	cld
+  8011e0:	eb 1a                	jmp    8011fc <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8011e2:	89 f2                	mov    %esi,%edx
+  8011e4:	09 c2                	or     %eax,%edx
+  8011e6:	09 ca                	or     %ecx,%edx
+  8011e8:	f6 c2 03             	test   $0x3,%dl
+  8011eb:	75 0a                	jne    8011f7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8011ed:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8011f0:	89 c7                	mov    %eax,%edi
+  8011f2:	fc                   	cld
+  8011f3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8011f5:	eb 05                	jmp    8011fc <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8011f7:	89 c7                	mov    %eax,%edi
+  8011f9:	fc                   	cld
+  8011fa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801206:	ff 75 10             	push   0x10(%ebp)
+  801209:	ff 75 0c             	push   0xc(%ebp)
+  80120c:	ff 75 08             	push   0x8(%ebp)
+  80120f:	e8 8a ff ff ff       	call   80119e <memmove>
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+00801216 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801221:	89 c6                	mov    %eax,%esi
+  801223:	03 75 10             	add    0x10(%ebp),%esi
+  801226:	eb 06                	jmp    80122e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801228:	83 c0 01             	add    $0x1,%eax
+  80122b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80122e:	39 f0                	cmp    %esi,%eax
+  801230:	74 14                	je     801246 <memcmp+0x30>
+		if (*s1 != *s2)
+  801232:	0f b6 08             	movzbl (%eax),%ecx
+  801235:	0f b6 1a             	movzbl (%edx),%ebx
+  801238:	38 d9                	cmp    %bl,%cl
+  80123a:	74 ec                	je     801228 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80123c:	0f b6 c1             	movzbl %cl,%eax
+  80123f:	0f b6 db             	movzbl %bl,%ebx
+  801242:	29 d8                	sub    %ebx,%eax
+  801244:	eb 05                	jmp    80124b <memcmp+0x35>
+	}
+
+	return 0;
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80124b:	5b                   	pop    %ebx
+  80124c:	5e                   	pop    %esi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+
+0080124f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	8b 45 08             	mov    0x8(%ebp),%eax
+  801255:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801258:	89 c2                	mov    %eax,%edx
+  80125a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80125d:	eb 03                	jmp    801262 <memfind+0x13>
+  80125f:	83 c0 01             	add    $0x1,%eax
+  801262:	39 d0                	cmp    %edx,%eax
+  801264:	73 04                	jae    80126a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801266:	38 08                	cmp    %cl,(%eax)
+  801268:	75 f5                	jne    80125f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+
+0080126c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801278:	eb 03                	jmp    80127d <strtol+0x11>
+		s++;
+  80127a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80127d:	0f b6 02             	movzbl (%edx),%eax
+  801280:	3c 20                	cmp    $0x20,%al
+  801282:	74 f6                	je     80127a <strtol+0xe>
+  801284:	3c 09                	cmp    $0x9,%al
+  801286:	74 f2                	je     80127a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801288:	3c 2b                	cmp    $0x2b,%al
+  80128a:	74 2a                	je     8012b6 <strtol+0x4a>
+	int neg = 0;
+  80128c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801291:	3c 2d                	cmp    $0x2d,%al
+  801293:	74 2b                	je     8012c0 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801295:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80129b:	75 0f                	jne    8012ac <strtol+0x40>
+  80129d:	80 3a 30             	cmpb   $0x30,(%edx)
+  8012a0:	74 28                	je     8012ca <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8012a2:	85 db                	test   %ebx,%ebx
+  8012a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a9:	0f 44 d8             	cmove  %eax,%ebx
+  8012ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8012b4:	eb 46                	jmp    8012fc <strtol+0x90>
+		s++;
+  8012b6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8012b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012be:	eb d5                	jmp    801295 <strtol+0x29>
+		s++, neg = 1;
+  8012c0:	83 c2 01             	add    $0x1,%edx
+  8012c3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8012c8:	eb cb                	jmp    801295 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8012ca:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8012ce:	74 0e                	je     8012de <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8012d0:	85 db                	test   %ebx,%ebx
+  8012d2:	75 d8                	jne    8012ac <strtol+0x40>
+		s++, base = 8;
+  8012d4:	83 c2 01             	add    $0x1,%edx
+  8012d7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8012dc:	eb ce                	jmp    8012ac <strtol+0x40>
+		s += 2, base = 16;
+  8012de:	83 c2 02             	add    $0x2,%edx
+  8012e1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8012e6:	eb c4                	jmp    8012ac <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8012e8:	0f be c0             	movsbl %al,%eax
+  8012eb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8012ee:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012f1:	7d 3a                	jge    80132d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8012f3:	83 c2 01             	add    $0x1,%edx
+  8012f6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8012fa:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8012fc:	0f b6 02             	movzbl (%edx),%eax
+  8012ff:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801302:	89 f3                	mov    %esi,%ebx
+  801304:	80 fb 09             	cmp    $0x9,%bl
+  801307:	76 df                	jbe    8012e8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801309:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80130c:	89 f3                	mov    %esi,%ebx
+  80130e:	80 fb 19             	cmp    $0x19,%bl
+  801311:	77 08                	ja     80131b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801313:	0f be c0             	movsbl %al,%eax
+  801316:	83 e8 57             	sub    $0x57,%eax
+  801319:	eb d3                	jmp    8012ee <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80131b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80131e:	89 f3                	mov    %esi,%ebx
+  801320:	80 fb 19             	cmp    $0x19,%bl
+  801323:	77 08                	ja     80132d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801325:	0f be c0             	movsbl %al,%eax
+  801328:	83 e8 37             	sub    $0x37,%eax
+  80132b:	eb c1                	jmp    8012ee <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80132d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801331:	74 05                	je     801338 <strtol+0xcc>
+		*endptr = (char *) s;
+  801333:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801336:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801338:	89 c8                	mov    %ecx,%eax
+  80133a:	f7 d8                	neg    %eax
+  80133c:	85 ff                	test   %edi,%edi
+  80133e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801341:	89 c8                	mov    %ecx,%eax
+  801343:	5b                   	pop    %ebx
+  801344:	5e                   	pop    %esi
+  801345:	5f                   	pop    %edi
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+
+00801348 <atoi>:
+
+int
+atoi(const char* s)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  80134e:	6a 00                	push   $0x0
+  801350:	6a 00                	push   $0x0
+  801352:	ff 75 08             	push   0x8(%ebp)
+  801355:	e8 12 ff ff ff       	call   80126c <strtol>
+}
+  80135a:	c9                   	leave
+  80135b:	c3                   	ret
+
+0080135c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	57                   	push   %edi
+  801360:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801361:	b8 00 00 00 00       	mov    $0x0,%eax
+  801366:	8b 55 08             	mov    0x8(%ebp),%edx
+  801369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136c:	89 c3                	mov    %eax,%ebx
+  80136e:	89 c7                	mov    %eax,%edi
+  801370:	6a 00                	push   $0x0
+  801372:	55                   	push   %ebp
+  801373:	56                   	push   %esi
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	8d 35 7e 13 80 00    	lea    0x80137e,%esi
+  80137c:	0f 34                	sysenter
+
+0080137e <after_sysenter_label_47>:
+  80137e:	5e                   	pop    %esi
+  80137f:	5d                   	pop    %ebp
+  801380:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801383:	5b                   	pop    %ebx
+  801384:	5f                   	pop    %edi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+
+00801387 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80138c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801391:	b8 01 00 00 00       	mov    $0x1,%eax
+  801396:	89 d1                	mov    %edx,%ecx
+  801398:	89 d3                	mov    %edx,%ebx
+  80139a:	89 d7                	mov    %edx,%edi
+  80139c:	6a 00                	push   $0x0
+  80139e:	55                   	push   %ebp
+  80139f:	56                   	push   %esi
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	8d 35 aa 13 80 00    	lea    0x8013aa,%esi
+  8013a8:	0f 34                	sysenter
+
+008013aa <after_sysenter_label_128>:
+  8013aa:	5e                   	pop    %esi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5f                   	pop    %edi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+
+008013b3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8013c5:	89 cb                	mov    %ecx,%ebx
+  8013c7:	89 cf                	mov    %ecx,%edi
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	55                   	push   %ebp
+  8013cc:	56                   	push   %esi
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	8d 35 d7 13 80 00    	lea    0x8013d7,%esi
+  8013d5:	0f 34                	sysenter
+
+008013d7 <after_sysenter_label_212>:
+  8013d7:	5e                   	pop    %esi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	7f 07                	jg     8013e7 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8013e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e3:	5b                   	pop    %ebx
+  8013e4:	5f                   	pop    %edi
+  8013e5:	5d                   	pop    %ebp
+  8013e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+  8013ea:	50                   	push   %eax
+  8013eb:	6a 03                	push   $0x3
+  8013ed:	68 b5 54 80 00       	push   $0x8054b5
+  8013f2:	6a 54                	push   $0x54
+  8013f4:	68 d2 54 80 00       	push   $0x8054d2
+  8013f9:	e8 5b f5 ff ff       	call   800959 <_panic>
+
+008013fe <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	57                   	push   %edi
+  801402:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801403:	ba 00 00 00 00       	mov    $0x0,%edx
+  801408:	b8 02 00 00 00       	mov    $0x2,%eax
+  80140d:	89 d1                	mov    %edx,%ecx
+  80140f:	89 d3                	mov    %edx,%ebx
+  801411:	89 d7                	mov    %edx,%edi
+  801413:	6a 00                	push   $0x0
+  801415:	55                   	push   %ebp
+  801416:	56                   	push   %esi
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	8d 35 21 14 80 00    	lea    0x801421,%esi
+  80141f:	0f 34                	sysenter
+
+00801421 <after_sysenter_label_309>:
+  801421:	5e                   	pop    %esi
+  801422:	5d                   	pop    %ebp
+  801423:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801426:	5b                   	pop    %ebx
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+
+0080142a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80142f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801434:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801439:	89 d1                	mov    %edx,%ecx
+  80143b:	89 d3                	mov    %edx,%ebx
+  80143d:	89 d7                	mov    %edx,%edi
+  80143f:	6a 00                	push   $0x0
+  801441:	55                   	push   %ebp
+  801442:	56                   	push   %esi
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	8d 35 4d 14 80 00    	lea    0x80144d,%esi
+  80144b:	0f 34                	sysenter
+
+0080144d <after_sysenter_label_391>:
+  80144d:	5e                   	pop    %esi
+  80144e:	5d                   	pop    %ebp
+  80144f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801452:	5b                   	pop    %ebx
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+
+00801456 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80145b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801461:	b8 04 00 00 00       	mov    $0x4,%eax
+  801466:	bf 00 00 00 00       	mov    $0x0,%edi
+  80146b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80146e:	6a 00                	push   $0x0
+  801470:	55                   	push   %ebp
+  801471:	56                   	push   %esi
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	8d 35 7c 14 80 00    	lea    0x80147c,%esi
+  80147a:	0f 34                	sysenter
+
+0080147c <after_sysenter_label_479>:
+  80147c:	5e                   	pop    %esi
+  80147d:	5d                   	pop    %ebp
+  80147e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801481:	85 c0                	test   %eax,%eax
+  801483:	7f 07                	jg     80148c <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801485:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801488:	5b                   	pop    %ebx
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80148c:	83 ec 0c             	sub    $0xc,%esp
+  80148f:	50                   	push   %eax
+  801490:	6a 04                	push   $0x4
+  801492:	68 b5 54 80 00       	push   $0x8054b5
+  801497:	6a 54                	push   $0x54
+  801499:	68 d2 54 80 00       	push   $0x8054d2
+  80149e:	e8 b6 f4 ff ff       	call   800959 <_panic>
+
+008014a3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	57                   	push   %edi
+  8014a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ae:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b9:	ff 75 18             	push   0x18(%ebp)
+  8014bc:	55                   	push   %ebp
+  8014bd:	56                   	push   %esi
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	8d 35 c8 14 80 00    	lea    0x8014c8,%esi
+  8014c6:	0f 34                	sysenter
+
+008014c8 <after_sysenter_label_593>:
+  8014c8:	5e                   	pop    %esi
+  8014c9:	5d                   	pop    %ebp
+  8014ca:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8014cd:	85 c0                	test   %eax,%eax
+  8014cf:	7f 07                	jg     8014d8 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8014d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014d8:	83 ec 0c             	sub    $0xc,%esp
+  8014db:	50                   	push   %eax
+  8014dc:	6a 05                	push   $0x5
+  8014de:	68 b5 54 80 00       	push   $0x8054b5
+  8014e3:	6a 54                	push   $0x54
+  8014e5:	68 d2 54 80 00       	push   $0x8054d2
+  8014ea:	e8 6a f4 ff ff       	call   800959 <_panic>
+
+008014ef <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	57                   	push   %edi
+  8014f3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ff:	b8 06 00 00 00       	mov    $0x6,%eax
+  801504:	89 df                	mov    %ebx,%edi
+  801506:	6a 00                	push   $0x0
+  801508:	55                   	push   %ebp
+  801509:	56                   	push   %esi
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	8d 35 14 15 80 00    	lea    0x801514,%esi
+  801512:	0f 34                	sysenter
+
+00801514 <after_sysenter_label_704>:
+  801514:	5e                   	pop    %esi
+  801515:	5d                   	pop    %ebp
+  801516:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	7f 07                	jg     801524 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80151d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801520:	5b                   	pop    %ebx
+  801521:	5f                   	pop    %edi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801524:	83 ec 0c             	sub    $0xc,%esp
+  801527:	50                   	push   %eax
+  801528:	6a 06                	push   $0x6
+  80152a:	68 b5 54 80 00       	push   $0x8054b5
+  80152f:	6a 54                	push   $0x54
+  801531:	68 d2 54 80 00       	push   $0x8054d2
+  801536:	e8 1e f4 ff ff       	call   800959 <_panic>
+
+0080153b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	57                   	push   %edi
+  80153f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801550:	89 df                	mov    %ebx,%edi
+  801552:	6a 00                	push   $0x0
+  801554:	55                   	push   %ebp
+  801555:	56                   	push   %esi
+  801556:	89 e5                	mov    %esp,%ebp
+  801558:	8d 35 60 15 80 00    	lea    0x801560,%esi
+  80155e:	0f 34                	sysenter
+
+00801560 <after_sysenter_label_808>:
+  801560:	5e                   	pop    %esi
+  801561:	5d                   	pop    %ebp
+  801562:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801565:	85 c0                	test   %eax,%eax
+  801567:	7f 07                	jg     801570 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801569:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80156c:	5b                   	pop    %ebx
+  80156d:	5f                   	pop    %edi
+  80156e:	5d                   	pop    %ebp
+  80156f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	50                   	push   %eax
+  801574:	6a 08                	push   $0x8
+  801576:	68 b5 54 80 00       	push   $0x8054b5
+  80157b:	6a 54                	push   $0x54
+  80157d:	68 d2 54 80 00       	push   $0x8054d2
+  801582:	e8 d2 f3 ff ff       	call   800959 <_panic>
+
+00801587 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80158c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801591:	8b 55 08             	mov    0x8(%ebp),%edx
+  801594:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801597:	b8 09 00 00 00       	mov    $0x9,%eax
+  80159c:	89 df                	mov    %ebx,%edi
+  80159e:	6a 00                	push   $0x0
+  8015a0:	55                   	push   %ebp
+  8015a1:	56                   	push   %esi
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	8d 35 ac 15 80 00    	lea    0x8015ac,%esi
+  8015aa:	0f 34                	sysenter
+
+008015ac <after_sysenter_label_912>:
+  8015ac:	5e                   	pop    %esi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	7f 07                	jg     8015bc <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8015b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b8:	5b                   	pop    %ebx
+  8015b9:	5f                   	pop    %edi
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bc:	83 ec 0c             	sub    $0xc,%esp
+  8015bf:	50                   	push   %eax
+  8015c0:	6a 09                	push   $0x9
+  8015c2:	68 b5 54 80 00       	push   $0x8054b5
+  8015c7:	6a 54                	push   $0x54
+  8015c9:	68 d2 54 80 00       	push   $0x8054d2
+  8015ce:	e8 86 f3 ff ff       	call   800959 <_panic>
+
+008015d3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	57                   	push   %edi
+  8015d7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015e8:	89 df                	mov    %ebx,%edi
+  8015ea:	6a 00                	push   $0x0
+  8015ec:	55                   	push   %ebp
+  8015ed:	56                   	push   %esi
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	8d 35 f8 15 80 00    	lea    0x8015f8,%esi
+  8015f6:	0f 34                	sysenter
+
+008015f8 <after_sysenter_label_1016>:
+  8015f8:	5e                   	pop    %esi
+  8015f9:	5d                   	pop    %ebp
+  8015fa:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	7f 07                	jg     801608 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801601:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801604:	5b                   	pop    %ebx
+  801605:	5f                   	pop    %edi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801608:	83 ec 0c             	sub    $0xc,%esp
+  80160b:	50                   	push   %eax
+  80160c:	6a 0a                	push   $0xa
+  80160e:	68 b5 54 80 00       	push   $0x8054b5
+  801613:	6a 54                	push   $0x54
+  801615:	68 d2 54 80 00       	push   $0x8054d2
+  80161a:	e8 3a f3 ff ff       	call   800959 <_panic>
+
+0080161f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	57                   	push   %edi
+  801623:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801624:	8b 55 08             	mov    0x8(%ebp),%edx
+  801627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80162f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801632:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801635:	6a 00                	push   $0x0
+  801637:	55                   	push   %ebp
+  801638:	56                   	push   %esi
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	8d 35 43 16 80 00    	lea    0x801643,%esi
+  801641:	0f 34                	sysenter
+
+00801643 <after_sysenter_label_1126>:
+  801643:	5e                   	pop    %esi
+  801644:	5d                   	pop    %ebp
+  801645:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801648:	5b                   	pop    %ebx
+  801649:	5f                   	pop    %edi
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+
+0080164c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	57                   	push   %edi
+  801650:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801651:	8b 55 08             	mov    0x8(%ebp),%edx
+  801654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801659:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80165e:	89 cb                	mov    %ecx,%ebx
+  801660:	89 cf                	mov    %ecx,%edi
+  801662:	6a 00                	push   $0x0
+  801664:	55                   	push   %ebp
+  801665:	56                   	push   %esi
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	8d 35 70 16 80 00    	lea    0x801670,%esi
+  80166e:	0f 34                	sysenter
+
+00801670 <after_sysenter_label_1210>:
+  801670:	5e                   	pop    %esi
+  801671:	5d                   	pop    %ebp
+  801672:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801675:	85 c0                	test   %eax,%eax
+  801677:	7f 07                	jg     801680 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167c:	5b                   	pop    %ebx
+  80167d:	5f                   	pop    %edi
+  80167e:	5d                   	pop    %ebp
+  80167f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801680:	83 ec 0c             	sub    $0xc,%esp
+  801683:	50                   	push   %eax
+  801684:	6a 0d                	push   $0xd
+  801686:	68 b5 54 80 00       	push   $0x8054b5
+  80168b:	6a 54                	push   $0x54
+  80168d:	68 d2 54 80 00       	push   $0x8054d2
+  801692:	e8 c2 f2 ff ff       	call   800959 <_panic>
+
+00801697 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	57                   	push   %edi
+  80169b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80169c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a7:	b8 42 00 00 00       	mov    $0x42,%eax
+  8016ac:	89 df                	mov    %ebx,%edi
+  8016ae:	6a 00                	push   $0x0
+  8016b0:	55                   	push   %ebp
+  8016b1:	56                   	push   %esi
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	8d 35 bc 16 80 00    	lea    0x8016bc,%esi
+  8016ba:	0f 34                	sysenter
+
+008016bc <after_sysenter_label_1311>:
+  8016bc:	5e                   	pop    %esi
+  8016bd:	5d                   	pop    %ebp
+  8016be:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8016c1:	85 c0                	test   %eax,%eax
+  8016c3:	7f 07                	jg     8016cc <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8016c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c8:	5b                   	pop    %ebx
+  8016c9:	5f                   	pop    %edi
+  8016ca:	5d                   	pop    %ebp
+  8016cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016cc:	83 ec 0c             	sub    $0xc,%esp
+  8016cf:	50                   	push   %eax
+  8016d0:	6a 42                	push   $0x42
+  8016d2:	68 b5 54 80 00       	push   $0x8054b5
+  8016d7:	6a 54                	push   $0x54
+  8016d9:	68 d2 54 80 00       	push   $0x8054d2
+  8016de:	e8 76 f2 ff ff       	call   800959 <_panic>
+
+008016e3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	57                   	push   %edi
+  8016e7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8016e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8016f2:	89 d1                	mov    %edx,%ecx
+  8016f4:	89 d3                	mov    %edx,%ebx
+  8016f6:	89 d7                	mov    %edx,%edi
+  8016f8:	6a 00                	push   $0x0
+  8016fa:	55                   	push   %ebp
+  8016fb:	56                   	push   %esi
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	8d 35 06 17 80 00    	lea    0x801706,%esi
+  801704:	0f 34                	sysenter
+
+00801706 <after_sysenter_label_1411>:
+  801706:	5e                   	pop    %esi
+  801707:	5d                   	pop    %ebp
+  801708:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80170b:	5b                   	pop    %ebx
+  80170c:	5f                   	pop    %edi
+  80170d:	5d                   	pop    %ebp
+  80170e:	c3                   	ret
+
+0080170f <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	57                   	push   %edi
+  801713:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801714:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801724:	89 df                	mov    %ebx,%edi
+  801726:	6a 00                	push   $0x0
+  801728:	55                   	push   %ebp
+  801729:	56                   	push   %esi
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	8d 35 34 17 80 00    	lea    0x801734,%esi
+  801732:	0f 34                	sysenter
+
+00801734 <after_sysenter_label_1497>:
+  801734:	5e                   	pop    %esi
+  801735:	5d                   	pop    %ebp
+  801736:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801739:	5b                   	pop    %ebx
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+
+0080173d <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	57                   	push   %edi
+  801741:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801752:	89 df                	mov    %ebx,%edi
+  801754:	6a 00                	push   $0x0
+  801756:	55                   	push   %ebp
+  801757:	56                   	push   %esi
+  801758:	89 e5                	mov    %esp,%ebp
+  80175a:	8d 35 62 17 80 00    	lea    0x801762,%esi
+  801760:	0f 34                	sysenter
+
+00801762 <after_sysenter_label_1583>:
+  801762:	5e                   	pop    %esi
+  801763:	5d                   	pop    %ebp
+  801764:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801767:	5b                   	pop    %ebx
+  801768:	5f                   	pop    %edi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+
+0080176b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	57                   	push   %edi
+  80176f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801770:	8b 55 08             	mov    0x8(%ebp),%edx
+  801773:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801776:	b8 11 00 00 00       	mov    $0x11,%eax
+  80177b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801780:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801783:	6a 00                	push   $0x0
+  801785:	55                   	push   %ebp
+  801786:	56                   	push   %esi
+  801787:	89 e5                	mov    %esp,%ebp
+  801789:	8d 35 91 17 80 00    	lea    0x801791,%esi
+  80178f:	0f 34                	sysenter
+
+00801791 <after_sysenter_label_1672>:
+  801791:	5e                   	pop    %esi
+  801792:	5d                   	pop    %ebp
+  801793:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801796:	5b                   	pop    %ebx
+  801797:	5f                   	pop    %edi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+
+0080179a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	57                   	push   %edi
+  80179e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80179f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017aa:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017af:	89 df                	mov    %ebx,%edi
+  8017b1:	6a 00                	push   $0x0
+  8017b3:	55                   	push   %ebp
+  8017b4:	56                   	push   %esi
+  8017b5:	89 e5                	mov    %esp,%ebp
+  8017b7:	8d 35 bf 17 80 00    	lea    0x8017bf,%esi
+  8017bd:	0f 34                	sysenter
+
+008017bf <after_sysenter_label_1758>:
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5d                   	pop    %ebp
+  8017c1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8017c4:	5b                   	pop    %ebx
+  8017c5:	5f                   	pop    %edi
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+
+008017c8 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	57                   	push   %edi
+  8017cc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017da:	89 cb                	mov    %ecx,%ebx
+  8017dc:	89 cf                	mov    %ecx,%edi
+  8017de:	6a 00                	push   $0x0
+  8017e0:	55                   	push   %ebp
+  8017e1:	56                   	push   %esi
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	8d 35 ec 17 80 00    	lea    0x8017ec,%esi
+  8017ea:	0f 34                	sysenter
+
+008017ec <after_sysenter_label_1842>:
+  8017ec:	5e                   	pop    %esi
+  8017ed:	5d                   	pop    %ebp
+  8017ee:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8017f1:	85 c0                	test   %eax,%eax
+  8017f3:	7f 07                	jg     8017fc <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8017f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f8:	5b                   	pop    %ebx
+  8017f9:	5f                   	pop    %edi
+  8017fa:	5d                   	pop    %ebp
+  8017fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017fc:	83 ec 0c             	sub    $0xc,%esp
+  8017ff:	50                   	push   %eax
+  801800:	6a 13                	push   $0x13
+  801802:	68 b5 54 80 00       	push   $0x8054b5
+  801807:	6a 54                	push   $0x54
+  801809:	68 d2 54 80 00       	push   $0x8054d2
+  80180e:	e8 46 f1 ff ff       	call   800959 <_panic>
+
+00801813 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801813:	55                   	push   %ebp
+  801814:	89 e5                	mov    %esp,%ebp
+  801816:	57                   	push   %edi
+  801817:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801822:	89 d1                	mov    %edx,%ecx
+  801824:	89 d3                	mov    %edx,%ebx
+  801826:	89 d7                	mov    %edx,%edi
+  801828:	6a 00                	push   $0x0
+  80182a:	55                   	push   %ebp
+  80182b:	56                   	push   %esi
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	8d 35 36 18 80 00    	lea    0x801836,%esi
+  801834:	0f 34                	sysenter
+
+00801836 <after_sysenter_label_1939>:
+  801836:	5e                   	pop    %esi
+  801837:	5d                   	pop    %ebp
+  801838:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80183b:	5b                   	pop    %ebx
+  80183c:	5f                   	pop    %edi
+  80183d:	5d                   	pop    %ebp
+  80183e:	c3                   	ret
+
+0080183f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	57                   	push   %edi
+  801843:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801844:	8b 55 08             	mov    0x8(%ebp),%edx
+  801847:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80184a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80184f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801854:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801857:	6a 00                	push   $0x0
+  801859:	55                   	push   %ebp
+  80185a:	56                   	push   %esi
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	8d 35 65 18 80 00    	lea    0x801865,%esi
+  801863:	0f 34                	sysenter
+
+00801865 <after_sysenter_label_2028>:
+  801865:	5e                   	pop    %esi
+  801866:	5d                   	pop    %ebp
+  801867:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80186a:	5b                   	pop    %ebx
+  80186b:	5f                   	pop    %edi
+  80186c:	5d                   	pop    %ebp
+  80186d:	c3                   	ret
+
+0080186e <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	57                   	push   %edi
+  801872:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801873:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801878:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801883:	89 df                	mov    %ebx,%edi
+  801885:	6a 00                	push   $0x0
+  801887:	55                   	push   %ebp
+  801888:	56                   	push   %esi
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	8d 35 93 18 80 00    	lea    0x801893,%esi
+  801891:	0f 34                	sysenter
+
+00801893 <after_sysenter_label_2114>:
+  801893:	5e                   	pop    %esi
+  801894:	5d                   	pop    %ebp
+  801895:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801898:	5b                   	pop    %ebx
+  801899:	5f                   	pop    %edi
+  80189a:	5d                   	pop    %ebp
+  80189b:	c3                   	ret
+
+0080189c <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80189c:	55                   	push   %ebp
+  80189d:	89 e5                	mov    %esp,%ebp
+  80189f:	57                   	push   %edi
+  8018a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8018a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ac:	b8 17 00 00 00       	mov    $0x17,%eax
+  8018b1:	89 df                	mov    %ebx,%edi
+  8018b3:	6a 00                	push   $0x0
+  8018b5:	55                   	push   %ebp
+  8018b6:	56                   	push   %esi
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	8d 35 c1 18 80 00    	lea    0x8018c1,%esi
+  8018bf:	0f 34                	sysenter
+
+008018c1 <after_sysenter_label_2200>:
+  8018c1:	5e                   	pop    %esi
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8018c6:	5b                   	pop    %ebx
+  8018c7:	5f                   	pop    %edi
+  8018c8:	5d                   	pop    %ebp
+  8018c9:	c3                   	ret
+
+008018ca <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	57                   	push   %edi
+  8018ce:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8018cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018da:	b8 18 00 00 00       	mov    $0x18,%eax
+  8018df:	89 df                	mov    %ebx,%edi
+  8018e1:	6a 00                	push   $0x0
+  8018e3:	55                   	push   %ebp
+  8018e4:	56                   	push   %esi
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	8d 35 ef 18 80 00    	lea    0x8018ef,%esi
+  8018ed:	0f 34                	sysenter
+
+008018ef <after_sysenter_label_2286>:
+  8018ef:	5e                   	pop    %esi
+  8018f0:	5d                   	pop    %ebp
+  8018f1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8018f4:	5b                   	pop    %ebx
+  8018f5:	5f                   	pop    %edi
+  8018f6:	5d                   	pop    %ebp
+  8018f7:	c3                   	ret
+
+008018f8 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	57                   	push   %edi
+  8018fc:	56                   	push   %esi
+  8018fd:	53                   	push   %ebx
+  8018fe:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801901:	89 d6                	mov    %edx,%esi
+  801903:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801906:	89 cf                	mov    %ecx,%edi
+  801908:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80190b:	89 fa                	mov    %edi,%edx
+  80190d:	80 ce 08             	or     $0x8,%dh
+  801910:	f6 c5 08             	test   $0x8,%ch
+  801913:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801916:	57                   	push   %edi
+  801917:	56                   	push   %esi
+  801918:	50                   	push   %eax
+  801919:	56                   	push   %esi
+  80191a:	6a 00                	push   $0x0
+  80191c:	e8 82 fb ff ff       	call   8014a3 <sys_page_map>
+	if (r < 0) {
+  801921:	83 c4 20             	add    $0x20,%esp
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 27                	js     80194f <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	57                   	push   %edi
+  80192c:	56                   	push   %esi
+  80192d:	6a 00                	push   $0x0
+  80192f:	56                   	push   %esi
+  801930:	6a 00                	push   $0x0
+  801932:	e8 6c fb ff ff       	call   8014a3 <sys_page_map>
+  801937:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801939:	83 c4 20             	add    $0x20,%esp
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 24                	js     801964 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801940:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801945:	89 d8                	mov    %ebx,%eax
+  801947:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194a:	5b                   	pop    %ebx
+  80194b:	5e                   	pop    %esi
+  80194c:	5f                   	pop    %edi
+  80194d:	5d                   	pop    %ebp
+  80194e:	c3                   	ret
+  80194f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	50                   	push   %eax
+  801955:	68 e0 54 80 00       	push   $0x8054e0
+  80195a:	e8 d5 f0 ff ff       	call   800a34 <cprintf>
+		return r;
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	eb e1                	jmp    801945 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	50                   	push   %eax
+  801968:	68 10 55 80 00       	push   $0x805510
+  80196d:	e8 c2 f0 ff ff       	call   800a34 <cprintf>
+		return r;
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	eb ce                	jmp    801945 <duppage_cow+0x4d>
+
+00801977 <duppage>:
+{
+  801977:	55                   	push   %ebp
+  801978:	89 e5                	mov    %esp,%ebp
+  80197a:	53                   	push   %ebx
+  80197b:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80197e:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801981:	51                   	push   %ecx
+  801982:	52                   	push   %edx
+  801983:	50                   	push   %eax
+  801984:	52                   	push   %edx
+  801985:	6a 00                	push   $0x0
+  801987:	e8 17 fb ff ff       	call   8014a3 <sys_page_map>
+	if (r < 0) {
+  80198c:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80198f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 07                	js     80199f <duppage+0x28>
+}
+  801998:	89 d8                	mov    %ebx,%eax
+  80199a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80199d:	c9                   	leave
+  80199e:	c3                   	ret
+  80199f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8019a1:	83 ec 08             	sub    $0x8,%esp
+  8019a4:	50                   	push   %eax
+  8019a5:	68 e0 54 80 00       	push   $0x8054e0
+  8019aa:	e8 85 f0 ff ff       	call   800a34 <cprintf>
+		return r;
+  8019af:	83 c4 10             	add    $0x10,%esp
+  8019b2:	eb e4                	jmp    801998 <duppage+0x21>
+
+008019b4 <cow_copy>:
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	56                   	push   %esi
+  8019b8:	53                   	push   %ebx
+  8019b9:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8019bb:	83 ec 04             	sub    $0x4,%esp
+  8019be:	6a 07                	push   $0x7
+  8019c0:	68 00 f0 7f 00       	push   $0x7ff000
+  8019c5:	6a 00                	push   $0x0
+  8019c7:	e8 8a fa ff ff       	call   801456 <sys_page_alloc>
+	if (r < 0) {
+  8019cc:	83 c4 10             	add    $0x10,%esp
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	78 58                	js     801a2b <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8019d3:	83 ec 04             	sub    $0x4,%esp
+  8019d6:	68 00 10 00 00       	push   $0x1000
+  8019db:	56                   	push   %esi
+  8019dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8019e1:	e8 b8 f7 ff ff       	call   80119e <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8019e6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8019ed:	56                   	push   %esi
+  8019ee:	6a 00                	push   $0x0
+  8019f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8019f5:	6a 00                	push   $0x0
+  8019f7:	e8 a7 fa ff ff       	call   8014a3 <sys_page_map>
+  8019fc:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8019fe:	83 c4 20             	add    $0x20,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 3b                	js     801a40 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801a05:	83 ec 08             	sub    $0x8,%esp
+  801a08:	68 00 f0 7f 00       	push   $0x7ff000
+  801a0d:	6a 00                	push   $0x0
+  801a0f:	e8 db fa ff ff       	call   8014ef <sys_page_unmap>
+  801a14:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 45                	js     801a62 <cow_copy+0xae>
+	return 0;
+  801a1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801a22:	89 d8                	mov    %ebx,%eax
+  801a24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a27:	5b                   	pop    %ebx
+  801a28:	5e                   	pop    %esi
+  801a29:	5d                   	pop    %ebp
+  801a2a:	c3                   	ret
+  801a2b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801a2d:	83 ec 08             	sub    $0x8,%esp
+  801a30:	50                   	push   %eax
+  801a31:	68 00 56 80 00       	push   $0x805600
+  801a36:	e8 f9 ef ff ff       	call   800a34 <cprintf>
+		return r;
+  801a3b:	83 c4 10             	add    $0x10,%esp
+  801a3e:	eb e2                	jmp    801a22 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801a40:	83 ec 08             	sub    $0x8,%esp
+  801a43:	50                   	push   %eax
+  801a44:	68 1c 56 80 00       	push   $0x80561c
+  801a49:	e8 e6 ef ff ff       	call   800a34 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801a4e:	83 c4 08             	add    $0x8,%esp
+  801a51:	68 00 f0 7f 00       	push   $0x7ff000
+  801a56:	6a 00                	push   $0x0
+  801a58:	e8 92 fa ff ff       	call   8014ef <sys_page_unmap>
+		return r;
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	eb c0                	jmp    801a22 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801a62:	83 ec 08             	sub    $0x8,%esp
+  801a65:	50                   	push   %eax
+  801a66:	68 38 55 80 00       	push   $0x805538
+  801a6b:	e8 c4 ef ff ff       	call   800a34 <cprintf>
+		return r;
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	eb ad                	jmp    801a22 <cow_copy+0x6e>
+
+00801a75 <pgfault>:
+{
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	56                   	push   %esi
+  801a79:	53                   	push   %ebx
+  801a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801a7d:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801a7f:	89 d8                	mov    %ebx,%eax
+  801a81:	c1 e8 16             	shr    $0x16,%eax
+  801a84:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801a8b:	89 de                	mov    %ebx,%esi
+  801a8d:	c1 ee 0c             	shr    $0xc,%esi
+  801a90:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801a97:	a8 07                	test   $0x7,%al
+  801a99:	74 3b                	je     801ad6 <pgfault+0x61>
+  801a9b:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801aa1:	74 33                	je     801ad6 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801aa3:	83 ec 0c             	sub    $0xc,%esp
+  801aa6:	68 00 f0 bf ee       	push   $0xeebff000
+  801aab:	e8 07 28 00 00       	call   8042b7 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801ab0:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	f6 c4 08             	test   $0x8,%ah
+  801abd:	75 30                	jne    801aef <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	68 00 f0 bf ee       	push   $0xeebff000
+  801ac7:	e8 58 28 00 00       	call   804324 <mutex_unlock>
+}
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad2:	5b                   	pop    %ebx
+  801ad3:	5e                   	pop    %esi
+  801ad4:	5d                   	pop    %ebp
+  801ad5:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801ad6:	83 ec 08             	sub    $0x8,%esp
+  801ad9:	ff 72 28             	push   0x28(%edx)
+  801adc:	51                   	push   %ecx
+  801add:	50                   	push   %eax
+  801ade:	68 5c 55 80 00       	push   $0x80555c
+  801ae3:	6a 3f                	push   $0x3f
+  801ae5:	68 36 56 80 00       	push   $0x805636
+  801aea:	e8 6a ee ff ff       	call   800959 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801aef:	89 d8                	mov    %ebx,%eax
+  801af1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801af6:	e8 b9 fe ff ff       	call   8019b4 <cow_copy>
+  801afb:	eb c2                	jmp    801abf <pgfault+0x4a>
+
+00801afd <cow_enable>:
+{
+  801afd:	55                   	push   %ebp
+  801afe:	89 e5                	mov    %esp,%ebp
+  801b00:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801b03:	68 75 1a 80 00       	push   $0x801a75
+  801b08:	e8 2a 31 00 00       	call   804c37 <set_pgfault_handler>
+}
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+
+00801b12 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	57                   	push   %edi
+  801b16:	56                   	push   %esi
+  801b17:	53                   	push   %ebx
+  801b18:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801b1b:	68 75 1a 80 00       	push   $0x801a75
+  801b20:	e8 12 31 00 00       	call   804c37 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801b25:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b2a:	cd 30                	int    $0x30
+  801b2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	78 4b                	js     801b81 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801b36:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801b3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b40:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801b43:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801b47:	0f 85 16 01 00 00    	jne    801c63 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801b4d:	e8 ac f8 ff ff       	call   8013fe <sys_getenvid>
+  801b52:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b57:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b59:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801b5f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801b65:	77 32                	ja     801b99 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b67:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801b6c:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801b6e:	c1 ea 10             	shr    $0x10,%edx
+  801b71:	74 26                	je     801b99 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b73:	c1 e2 10             	shl    $0x10,%edx
+  801b76:	89 d1                	mov    %edx,%ecx
+  801b78:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801b7d:	29 ca                	sub    %ecx,%edx
+  801b7f:	eb 1e                	jmp    801b9f <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801b81:	83 ec 08             	sub    $0x8,%esp
+  801b84:	89 c7                	mov    %eax,%edi
+  801b86:	50                   	push   %eax
+  801b87:	68 41 56 80 00       	push   $0x805641
+  801b8c:	e8 a3 ee ff ff       	call   800a34 <cprintf>
+		return eid;
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	e9 6c 01 00 00       	jmp    801d05 <fork+0x1f3>
+		return pthread_main_tls;
+  801b99:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801b9f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801ba2:	c1 e0 04             	shl    $0x4,%eax
+  801ba5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801baa:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801bac:	e8 4f 2e 00 00       	call   804a00 <pthread_fork_child>
+		return eid;
+  801bb1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bb4:	e9 4c 01 00 00       	jmp    801d05 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801bb9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801bbf:	89 da                	mov    %ebx,%edx
+  801bc1:	89 f8                	mov    %edi,%eax
+  801bc3:	e8 af fd ff ff       	call   801977 <duppage>
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	79 28                	jns    801bf4 <fork+0xe2>
+  801bcc:	89 c7                	mov    %eax,%edi
+  801bce:	e9 32 01 00 00       	jmp    801d05 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801bd3:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801bd9:	83 f9 05             	cmp    $0x5,%ecx
+  801bdc:	75 58                	jne    801c36 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801bde:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801be3:	89 da                	mov    %ebx,%edx
+  801be5:	89 f8                	mov    %edi,%eax
+  801be7:	e8 8b fd ff ff       	call   801977 <duppage>
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	0f 88 0f 01 00 00    	js     801d03 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801bf4:	83 c3 01             	add    $0x1,%ebx
+  801bf7:	39 de                	cmp    %ebx,%esi
+  801bf9:	74 54                	je     801c4f <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801bfb:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801c02:	f6 c1 05             	test   $0x5,%cl
+  801c05:	74 ed                	je     801bf4 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801c07:	f6 c5 04             	test   $0x4,%ch
+  801c0a:	75 ad                	jne    801bb9 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801c0c:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801c12:	74 bf                	je     801bd3 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801c14:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801c1a:	74 d8                	je     801bf4 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801c1c:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801c22:	89 da                	mov    %ebx,%edx
+  801c24:	89 f8                	mov    %edi,%eax
+  801c26:	e8 cd fc ff ff       	call   8018f8 <duppage_cow>
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	79 c5                	jns    801bf4 <fork+0xe2>
+  801c2f:	89 c7                	mov    %eax,%edi
+  801c31:	e9 cf 00 00 00       	jmp    801d05 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801c36:	68 8c 55 80 00       	push   $0x80558c
+  801c3b:	68 8f 50 80 00       	push   $0x80508f
+  801c40:	68 c6 00 00 00       	push   $0xc6
+  801c45:	68 36 56 80 00       	push   $0x805636
+  801c4a:	e8 0a ed ff ff       	call   800959 <_panic>
+  801c4f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801c52:	83 c1 01             	add    $0x1,%ecx
+  801c55:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801c5b:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801c61:	74 18                	je     801c7b <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801c63:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801c6a:	a8 07                	test   $0x7,%al
+  801c6c:	74 e4                	je     801c52 <fork+0x140>
+  801c6e:	89 cb                	mov    %ecx,%ebx
+  801c70:	c1 e3 0a             	shl    $0xa,%ebx
+  801c73:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c76:	e9 7c ff ff ff       	jmp    801bf7 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801c7b:	83 ec 04             	sub    $0x4,%esp
+  801c7e:	6a 07                	push   $0x7
+  801c80:	68 00 f0 bf ee       	push   $0xeebff000
+  801c85:	ff 75 e4             	push   -0x1c(%ebp)
+  801c88:	e8 c9 f7 ff ff       	call   801456 <sys_page_alloc>
+  801c8d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 34                	js     801cca <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801c96:	83 ec 08             	sub    $0x8,%esp
+  801c99:	68 75 4c 80 00       	push   $0x804c75
+  801c9e:	ff 75 e4             	push   -0x1c(%ebp)
+  801ca1:	e8 2d f9 ff ff       	call   8015d3 <sys_env_set_pgfault_upcall>
+  801ca6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	78 2e                	js     801cdd <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801caf:	83 ec 08             	sub    $0x8,%esp
+  801cb2:	6a 02                	push   $0x2
+  801cb4:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb7:	e8 7f f8 ff ff       	call   80153b <sys_env_set_status>
+  801cbc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	78 2b                	js     801cf0 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801cc5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cc8:	eb 3b                	jmp    801d05 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801cca:	83 ec 08             	sub    $0x8,%esp
+  801ccd:	50                   	push   %eax
+  801cce:	68 b4 55 80 00       	push   $0x8055b4
+  801cd3:	e8 5c ed ff ff       	call   800a34 <cprintf>
+		return r;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	eb 28                	jmp    801d05 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+  801ce0:	50                   	push   %eax
+  801ce1:	68 dc 55 80 00       	push   $0x8055dc
+  801ce6:	e8 49 ed ff ff       	call   800a34 <cprintf>
+		return r;
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	eb 15                	jmp    801d05 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801cf0:	83 ec 08             	sub    $0x8,%esp
+  801cf3:	50                   	push   %eax
+  801cf4:	68 51 56 80 00       	push   $0x805651
+  801cf9:	e8 36 ed ff ff       	call   800a34 <cprintf>
+		return r;
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	eb 02                	jmp    801d05 <fork+0x1f3>
+  801d03:	89 c7                	mov    %eax,%edi
+}
+  801d05:	89 f8                	mov    %edi,%eax
+  801d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d0a:	5b                   	pop    %ebx
+  801d0b:	5e                   	pop    %esi
+  801d0c:	5f                   	pop    %edi
+  801d0d:	5d                   	pop    %ebp
+  801d0e:	c3                   	ret
+
+00801d0f <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801d0f:	55                   	push   %ebp
+  801d10:	89 e5                	mov    %esp,%ebp
+  801d12:	57                   	push   %edi
+  801d13:	56                   	push   %esi
+  801d14:	53                   	push   %ebx
+  801d15:	83 ec 2c             	sub    $0x2c,%esp
+  801d18:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d1a:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d25:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801d2b:	77 0a                	ja     801d37 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d2d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801d32:	29 c3                	sub    %eax,%ebx
+  801d34:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801d37:	83 ec 0c             	sub    $0xc,%esp
+  801d3a:	68 75 1a 80 00       	push   $0x801a75
+  801d3f:	e8 f3 2e 00 00       	call   804c37 <set_pgfault_handler>
+  801d44:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d49:	cd 30                	int    $0x30
+  801d4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 30                	js     801d85 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801d55:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801d59:	74 42                	je     801d9d <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801d5b:	c1 e3 10             	shl    $0x10,%ebx
+  801d5e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801d63:	29 d8                	sub    %ebx,%eax
+  801d65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801d68:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801d6d:	29 d8                	sub    %ebx,%eax
+  801d6f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801d72:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7c:	89 f7                	mov    %esi,%edi
+  801d7e:	89 d6                	mov    %edx,%esi
+  801d80:	e9 2c 01 00 00       	jmp    801eb1 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801d85:	83 ec 08             	sub    $0x8,%esp
+  801d88:	89 c7                	mov    %eax,%edi
+  801d8a:	50                   	push   %eax
+  801d8b:	68 41 56 80 00       	push   $0x805641
+  801d90:	e8 9f ec ff ff       	call   800a34 <cprintf>
+		return eid;
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	e9 d5 00 00 00       	jmp    801e72 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801d9d:	e8 5c f6 ff ff       	call   8013fe <sys_getenvid>
+  801da2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da7:	89 c2                	mov    %eax,%edx
+  801da9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801dab:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801db1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801db6:	77 18                	ja     801dd0 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801db8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801dbd:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801dbf:	c1 e8 10             	shr    $0x10,%eax
+  801dc2:	74 0c                	je     801dd0 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801dc4:	c1 e0 10             	shl    $0x10,%eax
+  801dc7:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801dcc:	29 c1                	sub    %eax,%ecx
+  801dce:	eb 06                	jmp    801dd6 <sfork+0xc7>
+		return pthread_main_tls;
+  801dd0:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+  801dd6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801dd9:	c1 e0 04             	shl    $0x4,%eax
+  801ddc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801de1:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  801de3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801de6:	e9 87 00 00 00       	jmp    801e72 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801deb:	f6 c5 04             	test   $0x4,%ch
+  801dee:	74 6c                	je     801e5c <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801df0:	89 ca                	mov    %ecx,%edx
+  801df2:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801df8:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801dfe:	74 7c                	je     801e7c <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801e00:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801e06:	89 da                	mov    %ebx,%edx
+  801e08:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e0b:	e8 67 fb ff ff       	call   801977 <duppage>
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	0f 88 4f 01 00 00    	js     801f67 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801e18:	83 c3 01             	add    $0x1,%ebx
+  801e1b:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801e1e:	74 7a                	je     801e9a <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801e20:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  801e22:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801e29:	f6 c1 01             	test   $0x1,%cl
+  801e2c:	74 ea                	je     801e18 <sfork+0x109>
+  801e2e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801e34:	74 e2                	je     801e18 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801e36:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801e3c:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801e3f:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801e44:	76 a5                	jbe    801deb <sfork+0xdc>
+  801e46:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801e4c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801e4f:	39 fa                	cmp    %edi,%edx
+  801e51:	73 9d                	jae    801df0 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801e53:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801e56:	39 fa                	cmp    %edi,%edx
+  801e58:	72 96                	jb     801df0 <sfork+0xe1>
+  801e5a:	eb 8f                	jmp    801deb <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801e5c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801e62:	89 da                	mov    %ebx,%edx
+  801e64:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e67:	e8 8c fa ff ff       	call   8018f8 <duppage_cow>
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	79 a8                	jns    801e18 <sfork+0x109>
+  801e70:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801e72:	89 f8                	mov    %edi,%eax
+  801e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e77:	5b                   	pop    %ebx
+  801e78:	5e                   	pop    %esi
+  801e79:	5f                   	pop    %edi
+  801e7a:	5d                   	pop    %ebp
+  801e7b:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801e7c:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801e81:	e8 2e fb ff ff       	call   8019b4 <cow_copy>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	0f 88 d2 00 00 00    	js     801f60 <sfork+0x251>
+				pte = uvpt[pn];
+  801e8e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801e95:	e9 66 ff ff ff       	jmp    801e00 <sfork+0xf1>
+  801e9a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e9d:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801ea0:	83 c6 01             	add    $0x1,%esi
+  801ea3:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801ea9:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801eaf:	74 1b                	je     801ecc <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801eb1:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801eb8:	a8 01                	test   $0x1,%al
+  801eba:	74 e4                	je     801ea0 <sfork+0x191>
+  801ebc:	89 f3                	mov    %esi,%ebx
+  801ebe:	c1 e3 0a             	shl    $0xa,%ebx
+  801ec1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801ec4:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801ec7:	e9 4f ff ff ff       	jmp    801e1b <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801ecc:	83 ec 04             	sub    $0x4,%esp
+  801ecf:	6a 07                	push   $0x7
+  801ed1:	68 00 f0 bf ee       	push   $0xeebff000
+  801ed6:	ff 75 e0             	push   -0x20(%ebp)
+  801ed9:	e8 78 f5 ff ff       	call   801456 <sys_page_alloc>
+  801ede:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 37                	js     801f1e <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801ee7:	83 ec 08             	sub    $0x8,%esp
+  801eea:	68 75 4c 80 00       	push   $0x804c75
+  801eef:	ff 75 e0             	push   -0x20(%ebp)
+  801ef2:	e8 dc f6 ff ff       	call   8015d3 <sys_env_set_pgfault_upcall>
+  801ef7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 34                	js     801f34 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801f00:	83 ec 08             	sub    $0x8,%esp
+  801f03:	6a 02                	push   $0x2
+  801f05:	ff 75 e0             	push   -0x20(%ebp)
+  801f08:	e8 2e f6 ff ff       	call   80153b <sys_env_set_status>
+  801f0d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 34                	js     801f4a <sfork+0x23b>
+	return eid;
+  801f16:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801f19:	e9 54 ff ff ff       	jmp    801e72 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801f1e:	83 ec 08             	sub    $0x8,%esp
+  801f21:	50                   	push   %eax
+  801f22:	68 b4 55 80 00       	push   $0x8055b4
+  801f27:	e8 08 eb ff ff       	call   800a34 <cprintf>
+		return r;
+  801f2c:	83 c4 10             	add    $0x10,%esp
+  801f2f:	e9 3e ff ff ff       	jmp    801e72 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801f34:	83 ec 08             	sub    $0x8,%esp
+  801f37:	50                   	push   %eax
+  801f38:	68 dc 55 80 00       	push   $0x8055dc
+  801f3d:	e8 f2 ea ff ff       	call   800a34 <cprintf>
+		return r;
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	e9 28 ff ff ff       	jmp    801e72 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+  801f4d:	50                   	push   %eax
+  801f4e:	68 51 56 80 00       	push   $0x805651
+  801f53:	e8 dc ea ff ff       	call   800a34 <cprintf>
+		return r;
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	e9 12 ff ff ff       	jmp    801e72 <sfork+0x163>
+  801f60:	89 c7                	mov    %eax,%edi
+  801f62:	e9 0b ff ff ff       	jmp    801e72 <sfork+0x163>
+  801f67:	89 c7                	mov    %eax,%edi
+  801f69:	e9 04 ff ff ff       	jmp    801e72 <sfork+0x163>
+
+00801f6e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	57                   	push   %edi
+  801f72:	56                   	push   %esi
+  801f73:	53                   	push   %ebx
+  801f74:	83 ec 18             	sub    $0x18,%esp
+  801f77:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f7d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f87:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  801f8a:	50                   	push   %eax
+  801f8b:	e8 bc f6 ff ff       	call   80164c <sys_ipc_recv>
+	if (r < 0) {
+  801f90:	83 c4 10             	add    $0x10,%esp
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	78 2b                	js     801fc2 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  801f97:	85 ff                	test   %edi,%edi
+  801f99:	74 55                	je     801ff0 <ipc_recv+0x82>
+  801f9b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f9d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801fa3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801fa8:	77 39                	ja     801fe3 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801faa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801faf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801fb1:	c1 e8 10             	shr    $0x10,%eax
+  801fb4:	74 2d                	je     801fe3 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801fb6:	c1 e0 10             	shl    $0x10,%eax
+  801fb9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801fbe:	29 c2                	sub    %eax,%edx
+  801fc0:	eb 27                	jmp    801fe9 <ipc_recv+0x7b>
+  801fc2:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801fc4:	83 ec 08             	sub    $0x8,%esp
+  801fc7:	50                   	push   %eax
+  801fc8:	68 6f 56 80 00       	push   $0x80566f
+  801fcd:	e8 62 ea ff ff       	call   800a34 <cprintf>
+		*from_env_store = 0;
+  801fd2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801fd8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	eb 77                	jmp    80205a <ipc_recv+0xec>
+		return pthread_main_tls;
+  801fe3:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801fe9:	8b 02                	mov    (%edx),%eax
+  801feb:	8b 40 78             	mov    0x78(%eax),%eax
+  801fee:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801ff0:	85 f6                	test   %esi,%esi
+  801ff2:	74 34                	je     802028 <ipc_recv+0xba>
+  801ff4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ff6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ffc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802001:	77 18                	ja     80201b <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802003:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802008:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80200a:	c1 e8 10             	shr    $0x10,%eax
+  80200d:	74 0c                	je     80201b <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80200f:	c1 e0 10             	shl    $0x10,%eax
+  802012:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802017:	29 c2                	sub    %eax,%edx
+  802019:	eb 06                	jmp    802021 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80201b:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  802021:	8b 02                	mov    (%edx),%eax
+  802023:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802026:	89 06                	mov    %eax,(%esi)
+  802028:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80202a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802030:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802035:	77 18                	ja     80204f <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802037:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80203c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80203e:	c1 e8 10             	shr    $0x10,%eax
+  802041:	74 0c                	je     80204f <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802043:	c1 e0 10             	shl    $0x10,%eax
+  802046:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80204b:	29 c2                	sub    %eax,%edx
+  80204d:	eb 06                	jmp    802055 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80204f:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	}
+	return thisenv->env_ipc_value;
+  802055:	8b 02                	mov    (%edx),%eax
+  802057:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80205a:	89 d8                	mov    %ebx,%eax
+  80205c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205f:	5b                   	pop    %ebx
+  802060:	5e                   	pop    %esi
+  802061:	5f                   	pop    %edi
+  802062:	5d                   	pop    %ebp
+  802063:	c3                   	ret
+
+00802064 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802064:	55                   	push   %ebp
+  802065:	89 e5                	mov    %esp,%ebp
+  802067:	57                   	push   %edi
+  802068:	56                   	push   %esi
+  802069:	53                   	push   %ebx
+  80206a:	83 ec 0c             	sub    $0xc,%esp
+  80206d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802070:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802073:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  802076:	85 db                	test   %ebx,%ebx
+  802078:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80207d:	0f 44 d8             	cmove  %eax,%ebx
+  802080:	eb 05                	jmp    802087 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  802082:	e8 a3 f3 ff ff       	call   80142a <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  802087:	57                   	push   %edi
+  802088:	53                   	push   %ebx
+  802089:	ff 75 0c             	push   0xc(%ebp)
+  80208c:	56                   	push   %esi
+  80208d:	e8 8d f5 ff ff       	call   80161f <sys_ipc_try_send>
+		if (r == 0) {
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	74 19                	je     8020b2 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  802099:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80209c:	74 e4                	je     802082 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	50                   	push   %eax
+  8020a2:	57                   	push   %edi
+  8020a3:	53                   	push   %ebx
+  8020a4:	56                   	push   %esi
+  8020a5:	68 88 56 80 00       	push   $0x805688
+  8020aa:	e8 85 e9 ff ff       	call   800a34 <cprintf>
+			return;
+  8020af:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8020b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b5:	5b                   	pop    %ebx
+  8020b6:	5e                   	pop    %esi
+  8020b7:	5f                   	pop    %edi
+  8020b8:	5d                   	pop    %ebp
+  8020b9:	c3                   	ret
+
+008020ba <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8020ba:	55                   	push   %ebp
+  8020bb:	89 e5                	mov    %esp,%ebp
+  8020bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8020c0:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8020c5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020c8:	c1 e0 04             	shl    $0x4,%eax
+  8020cb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020d0:	8b 40 50             	mov    0x50(%eax),%eax
+  8020d3:	39 c8                	cmp    %ecx,%eax
+  8020d5:	74 12                	je     8020e9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8020d7:	83 c2 01             	add    $0x1,%edx
+  8020da:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8020e0:	75 e3                	jne    8020c5 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8020e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e7:	eb 0e                	jmp    8020f7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8020e9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020ec:	c1 e0 04             	shl    $0x4,%eax
+  8020ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020f4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8020f7:	5d                   	pop    %ebp
+  8020f8:	c3                   	ret
+
+008020f9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ff:	05 00 00 00 30       	add    $0x30000000,%eax
+  802104:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802107:	5d                   	pop    %ebp
+  802108:	c3                   	ret
+
+00802109 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80210c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802114:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802119:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80211e:	5d                   	pop    %ebp
+  80211f:	c3                   	ret
+
+00802120 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802120:	55                   	push   %ebp
+  802121:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802123:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802128:	eb 02                	jmp    80212c <fd_alloc+0xc>
+  80212a:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80212c:	89 c2                	mov    %eax,%edx
+  80212e:	c1 ea 16             	shr    $0x16,%edx
+  802131:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802138:	f6 c2 01             	test   $0x1,%dl
+  80213b:	74 2b                	je     802168 <fd_alloc+0x48>
+  80213d:	89 c2                	mov    %eax,%edx
+  80213f:	c1 ea 0c             	shr    $0xc,%edx
+  802142:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802149:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80214f:	f6 c1 01             	test   $0x1,%cl
+  802152:	74 14                	je     802168 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802154:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80215a:	75 ce                	jne    80212a <fd_alloc+0xa>
+  80215c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802161:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802166:	eb 05                	jmp    80216d <fd_alloc+0x4d>
+			return 0;
+  802168:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80216d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802170:	89 02                	mov    %eax,(%edx)
+}
+  802172:	89 c8                	mov    %ecx,%eax
+  802174:	5d                   	pop    %ebp
+  802175:	c3                   	ret
+
+00802176 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802176:	55                   	push   %ebp
+  802177:	89 e5                	mov    %esp,%ebp
+  802179:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80217c:	83 f8 1f             	cmp    $0x1f,%eax
+  80217f:	77 30                	ja     8021b1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802181:	c1 e0 0c             	shl    $0xc,%eax
+  802184:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802189:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80218f:	f6 c2 01             	test   $0x1,%dl
+  802192:	74 24                	je     8021b8 <fd_lookup+0x42>
+  802194:	89 c2                	mov    %eax,%edx
+  802196:	c1 ea 0c             	shr    $0xc,%edx
+  802199:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8021a0:	f6 c2 01             	test   $0x1,%dl
+  8021a3:	74 1a                	je     8021bf <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8021a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8021aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021af:	5d                   	pop    %ebp
+  8021b0:	c3                   	ret
+		return -E_INVAL;
+  8021b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b6:	eb f7                	jmp    8021af <fd_lookup+0x39>
+		return -E_INVAL;
+  8021b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021bd:	eb f0                	jmp    8021af <fd_lookup+0x39>
+  8021bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c4:	eb e9                	jmp    8021af <fd_lookup+0x39>
+
+008021c6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	53                   	push   %ebx
+  8021ca:	83 ec 04             	sub    $0x4,%esp
+  8021cd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8021d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d5:	eb 03                	jmp    8021da <dev_lookup+0x14>
+  8021d7:	83 c0 01             	add    $0x1,%eax
+  8021da:	8b 1c 85 3c 57 80 00 	mov    0x80573c(,%eax,4),%ebx
+  8021e1:	85 db                	test   %ebx,%ebx
+  8021e3:	74 0b                	je     8021f0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8021e5:	39 13                	cmp    %edx,(%ebx)
+  8021e7:	75 ee                	jne    8021d7 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8021e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ee:	eb 49                	jmp    802239 <dev_lookup+0x73>
+  8021f0:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8021f2:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8021f8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8021fd:	77 18                	ja     802217 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8021ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802204:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802206:	c1 e8 10             	shr    $0x10,%eax
+  802209:	74 0c                	je     802217 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80220b:	c1 e0 10             	shl    $0x10,%eax
+  80220e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802213:	29 c1                	sub    %eax,%ecx
+  802215:	eb 06                	jmp    80221d <dev_lookup+0x57>
+		return pthread_main_tls;
+  802217:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80221d:	8b 01                	mov    (%ecx),%eax
+  80221f:	8b 40 48             	mov    0x48(%eax),%eax
+  802222:	83 ec 04             	sub    $0x4,%esp
+  802225:	52                   	push   %edx
+  802226:	50                   	push   %eax
+  802227:	68 c0 56 80 00       	push   $0x8056c0
+  80222c:	e8 03 e8 ff ff       	call   800a34 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802239:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223c:	89 1a                	mov    %ebx,(%edx)
+}
+  80223e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802241:	c9                   	leave
+  802242:	c3                   	ret
+
+00802243 <fd_close>:
+{
+  802243:	55                   	push   %ebp
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	57                   	push   %edi
+  802247:	56                   	push   %esi
+  802248:	53                   	push   %ebx
+  802249:	83 ec 24             	sub    $0x24,%esp
+  80224c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80224f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802252:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802255:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802256:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80225c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80225f:	50                   	push   %eax
+  802260:	e8 11 ff ff ff       	call   802176 <fd_lookup>
+  802265:	89 c3                	mov    %eax,%ebx
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	78 05                	js     802273 <fd_close+0x30>
+	    || fd != fd2)
+  80226e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802271:	74 16                	je     802289 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802273:	89 f8                	mov    %edi,%eax
+  802275:	84 c0                	test   %al,%al
+  802277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80227f:	89 d8                	mov    %ebx,%eax
+  802281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802284:	5b                   	pop    %ebx
+  802285:	5e                   	pop    %esi
+  802286:	5f                   	pop    %edi
+  802287:	5d                   	pop    %ebp
+  802288:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802289:	83 ec 08             	sub    $0x8,%esp
+  80228c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80228f:	50                   	push   %eax
+  802290:	ff 36                	push   (%esi)
+  802292:	e8 2f ff ff ff       	call   8021c6 <dev_lookup>
+  802297:	89 c3                	mov    %eax,%ebx
+  802299:	83 c4 10             	add    $0x10,%esp
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	78 1a                	js     8022ba <fd_close+0x77>
+		if (dev->dev_close)
+  8022a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022a3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8022a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	74 0b                	je     8022ba <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8022af:	83 ec 0c             	sub    $0xc,%esp
+  8022b2:	56                   	push   %esi
+  8022b3:	ff d0                	call   *%eax
+  8022b5:	89 c3                	mov    %eax,%ebx
+  8022b7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8022ba:	83 ec 08             	sub    $0x8,%esp
+  8022bd:	56                   	push   %esi
+  8022be:	6a 00                	push   $0x0
+  8022c0:	e8 2a f2 ff ff       	call   8014ef <sys_page_unmap>
+	return r;
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	eb b5                	jmp    80227f <fd_close+0x3c>
+
+008022ca <close>:
+
+int
+close(int fdnum)
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022d3:	50                   	push   %eax
+  8022d4:	ff 75 08             	push   0x8(%ebp)
+  8022d7:	e8 9a fe ff ff       	call   802176 <fd_lookup>
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	79 02                	jns    8022e5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+		return fd_close(fd, 1);
+  8022e5:	83 ec 08             	sub    $0x8,%esp
+  8022e8:	6a 01                	push   $0x1
+  8022ea:	ff 75 f4             	push   -0xc(%ebp)
+  8022ed:	e8 51 ff ff ff       	call   802243 <fd_close>
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	eb ec                	jmp    8022e3 <close+0x19>
+
+008022f7 <close_all>:
+
+void
+close_all(void)
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	53                   	push   %ebx
+  8022fb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8022fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802303:	83 ec 0c             	sub    $0xc,%esp
+  802306:	53                   	push   %ebx
+  802307:	e8 be ff ff ff       	call   8022ca <close>
+	for (i = 0; i < MAXFD; i++)
+  80230c:	83 c3 01             	add    $0x1,%ebx
+  80230f:	83 c4 10             	add    $0x10,%esp
+  802312:	83 fb 20             	cmp    $0x20,%ebx
+  802315:	75 ec                	jne    802303 <close_all+0xc>
+}
+  802317:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231a:	c9                   	leave
+  80231b:	c3                   	ret
+
+0080231c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80231c:	55                   	push   %ebp
+  80231d:	89 e5                	mov    %esp,%ebp
+  80231f:	57                   	push   %edi
+  802320:	56                   	push   %esi
+  802321:	53                   	push   %ebx
+  802322:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802325:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802328:	50                   	push   %eax
+  802329:	ff 75 08             	push   0x8(%ebp)
+  80232c:	e8 45 fe ff ff       	call   802176 <fd_lookup>
+  802331:	89 c3                	mov    %eax,%ebx
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	85 c0                	test   %eax,%eax
+  802338:	78 7f                	js     8023b9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80233a:	83 ec 0c             	sub    $0xc,%esp
+  80233d:	ff 75 0c             	push   0xc(%ebp)
+  802340:	e8 85 ff ff ff       	call   8022ca <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802345:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802348:	c1 e6 0c             	shl    $0xc,%esi
+  80234b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802354:	89 3c 24             	mov    %edi,(%esp)
+  802357:	e8 ad fd ff ff       	call   802109 <fd2data>
+  80235c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80235e:	89 34 24             	mov    %esi,(%esp)
+  802361:	e8 a3 fd ff ff       	call   802109 <fd2data>
+  802366:	83 c4 10             	add    $0x10,%esp
+  802369:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80236c:	89 d8                	mov    %ebx,%eax
+  80236e:	c1 e8 16             	shr    $0x16,%eax
+  802371:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802378:	a8 01                	test   $0x1,%al
+  80237a:	74 11                	je     80238d <dup+0x71>
+  80237c:	89 d8                	mov    %ebx,%eax
+  80237e:	c1 e8 0c             	shr    $0xc,%eax
+  802381:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802388:	f6 c2 01             	test   $0x1,%dl
+  80238b:	75 36                	jne    8023c3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80238d:	89 f8                	mov    %edi,%eax
+  80238f:	c1 e8 0c             	shr    $0xc,%eax
+  802392:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023a1:	50                   	push   %eax
+  8023a2:	56                   	push   %esi
+  8023a3:	6a 00                	push   $0x0
+  8023a5:	57                   	push   %edi
+  8023a6:	6a 00                	push   $0x0
+  8023a8:	e8 f6 f0 ff ff       	call   8014a3 <sys_page_map>
+  8023ad:	89 c3                	mov    %eax,%ebx
+  8023af:	83 c4 20             	add    $0x20,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 33                	js     8023e9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8023b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8023b9:	89 d8                	mov    %ebx,%eax
+  8023bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5f                   	pop    %edi
+  8023c1:	5d                   	pop    %ebp
+  8023c2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8023c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023ca:	83 ec 0c             	sub    $0xc,%esp
+  8023cd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023d2:	50                   	push   %eax
+  8023d3:	ff 75 d4             	push   -0x2c(%ebp)
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	53                   	push   %ebx
+  8023d9:	6a 00                	push   $0x0
+  8023db:	e8 c3 f0 ff ff       	call   8014a3 <sys_page_map>
+  8023e0:	89 c3                	mov    %eax,%ebx
+  8023e2:	83 c4 20             	add    $0x20,%esp
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	79 a4                	jns    80238d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8023e9:	83 ec 08             	sub    $0x8,%esp
+  8023ec:	56                   	push   %esi
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	e8 fb f0 ff ff       	call   8014ef <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8023f4:	83 c4 08             	add    $0x8,%esp
+  8023f7:	ff 75 d4             	push   -0x2c(%ebp)
+  8023fa:	6a 00                	push   $0x0
+  8023fc:	e8 ee f0 ff ff       	call   8014ef <sys_page_unmap>
+	return r;
+  802401:	83 c4 10             	add    $0x10,%esp
+  802404:	eb b3                	jmp    8023b9 <dup+0x9d>
+
+00802406 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	56                   	push   %esi
+  80240a:	53                   	push   %ebx
+  80240b:	83 ec 18             	sub    $0x18,%esp
+  80240e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802411:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802414:	50                   	push   %eax
+  802415:	53                   	push   %ebx
+  802416:	e8 5b fd ff ff       	call   802176 <fd_lookup>
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	78 3c                	js     80245e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802422:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802425:	83 ec 08             	sub    $0x8,%esp
+  802428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242b:	50                   	push   %eax
+  80242c:	ff 36                	push   (%esi)
+  80242e:	e8 93 fd ff ff       	call   8021c6 <dev_lookup>
+  802433:	83 c4 10             	add    $0x10,%esp
+  802436:	85 c0                	test   %eax,%eax
+  802438:	78 24                	js     80245e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80243a:	8b 46 08             	mov    0x8(%esi),%eax
+  80243d:	83 e0 03             	and    $0x3,%eax
+  802440:	83 f8 01             	cmp    $0x1,%eax
+  802443:	74 20                	je     802465 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802445:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802448:	8b 40 08             	mov    0x8(%eax),%eax
+  80244b:	85 c0                	test   %eax,%eax
+  80244d:	74 61                	je     8024b0 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80244f:	83 ec 04             	sub    $0x4,%esp
+  802452:	ff 75 10             	push   0x10(%ebp)
+  802455:	ff 75 0c             	push   0xc(%ebp)
+  802458:	56                   	push   %esi
+  802459:	ff d0                	call   *%eax
+  80245b:	83 c4 10             	add    $0x10,%esp
+}
+  80245e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802461:	5b                   	pop    %ebx
+  802462:	5e                   	pop    %esi
+  802463:	5d                   	pop    %ebp
+  802464:	c3                   	ret
+  802465:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802467:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80246d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802472:	77 18                	ja     80248c <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802474:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802479:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80247b:	c1 e8 10             	shr    $0x10,%eax
+  80247e:	74 0c                	je     80248c <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802480:	c1 e0 10             	shl    $0x10,%eax
+  802483:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802488:	29 c2                	sub    %eax,%edx
+  80248a:	eb 06                	jmp    802492 <read+0x8c>
+		return pthread_main_tls;
+  80248c:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802492:	8b 02                	mov    (%edx),%eax
+  802494:	8b 40 48             	mov    0x48(%eax),%eax
+  802497:	83 ec 04             	sub    $0x4,%esp
+  80249a:	53                   	push   %ebx
+  80249b:	50                   	push   %eax
+  80249c:	68 01 57 80 00       	push   $0x805701
+  8024a1:	e8 8e e5 ff ff       	call   800a34 <cprintf>
+		return -E_INVAL;
+  8024a6:	83 c4 10             	add    $0x10,%esp
+  8024a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024ae:	eb ae                	jmp    80245e <read+0x58>
+		return -E_NOT_SUPP;
+  8024b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024b5:	eb a7                	jmp    80245e <read+0x58>
+
+008024b7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	57                   	push   %edi
+  8024bb:	56                   	push   %esi
+  8024bc:	53                   	push   %ebx
+  8024bd:	83 ec 0c             	sub    $0xc,%esp
+  8024c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024c3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8024c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024cb:	eb 02                	jmp    8024cf <readn+0x18>
+  8024cd:	01 c3                	add    %eax,%ebx
+  8024cf:	39 f3                	cmp    %esi,%ebx
+  8024d1:	73 21                	jae    8024f4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024d3:	83 ec 04             	sub    $0x4,%esp
+  8024d6:	89 f0                	mov    %esi,%eax
+  8024d8:	29 d8                	sub    %ebx,%eax
+  8024da:	50                   	push   %eax
+  8024db:	89 d8                	mov    %ebx,%eax
+  8024dd:	03 45 0c             	add    0xc(%ebp),%eax
+  8024e0:	50                   	push   %eax
+  8024e1:	57                   	push   %edi
+  8024e2:	e8 1f ff ff ff       	call   802406 <read>
+		if (m < 0)
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	85 c0                	test   %eax,%eax
+  8024ec:	78 04                	js     8024f2 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8024ee:	75 dd                	jne    8024cd <readn+0x16>
+  8024f0:	eb 02                	jmp    8024f4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024f2:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8024f4:	89 d8                	mov    %ebx,%eax
+  8024f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f9:	5b                   	pop    %ebx
+  8024fa:	5e                   	pop    %esi
+  8024fb:	5f                   	pop    %edi
+  8024fc:	5d                   	pop    %ebp
+  8024fd:	c3                   	ret
+
+008024fe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	56                   	push   %esi
+  802502:	53                   	push   %ebx
+  802503:	83 ec 18             	sub    $0x18,%esp
+  802506:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802509:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80250c:	50                   	push   %eax
+  80250d:	53                   	push   %ebx
+  80250e:	e8 63 fc ff ff       	call   802176 <fd_lookup>
+  802513:	83 c4 10             	add    $0x10,%esp
+  802516:	85 c0                	test   %eax,%eax
+  802518:	78 37                	js     802551 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80251a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80251d:	83 ec 08             	sub    $0x8,%esp
+  802520:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802523:	50                   	push   %eax
+  802524:	ff 36                	push   (%esi)
+  802526:	e8 9b fc ff ff       	call   8021c6 <dev_lookup>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	78 1f                	js     802551 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802532:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802536:	74 20                	je     802558 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802538:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	74 61                	je     8025a3 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802542:	83 ec 04             	sub    $0x4,%esp
+  802545:	ff 75 10             	push   0x10(%ebp)
+  802548:	ff 75 0c             	push   0xc(%ebp)
+  80254b:	56                   	push   %esi
+  80254c:	ff d0                	call   *%eax
+  80254e:	83 c4 10             	add    $0x10,%esp
+}
+  802551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+  802558:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80255a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802560:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802565:	77 18                	ja     80257f <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802567:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80256c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80256e:	c1 e8 10             	shr    $0x10,%eax
+  802571:	74 0c                	je     80257f <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802573:	c1 e0 10             	shl    $0x10,%eax
+  802576:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80257b:	29 c2                	sub    %eax,%edx
+  80257d:	eb 06                	jmp    802585 <write+0x87>
+		return pthread_main_tls;
+  80257f:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802585:	8b 02                	mov    (%edx),%eax
+  802587:	8b 40 48             	mov    0x48(%eax),%eax
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	53                   	push   %ebx
+  80258e:	50                   	push   %eax
+  80258f:	68 1d 57 80 00       	push   $0x80571d
+  802594:	e8 9b e4 ff ff       	call   800a34 <cprintf>
+		return -E_INVAL;
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a1:	eb ae                	jmp    802551 <write+0x53>
+		return -E_NOT_SUPP;
+  8025a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025a8:	eb a7                	jmp    802551 <write+0x53>
+
+008025aa <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8025aa:	55                   	push   %ebp
+  8025ab:	89 e5                	mov    %esp,%ebp
+  8025ad:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b3:	50                   	push   %eax
+  8025b4:	ff 75 08             	push   0x8(%ebp)
+  8025b7:	e8 ba fb ff ff       	call   802176 <fd_lookup>
+  8025bc:	83 c4 10             	add    $0x10,%esp
+  8025bf:	85 c0                	test   %eax,%eax
+  8025c1:	78 0e                	js     8025d1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8025c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8025cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d1:	c9                   	leave
+  8025d2:	c3                   	ret
+
+008025d3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	56                   	push   %esi
+  8025d7:	53                   	push   %ebx
+  8025d8:	83 ec 18             	sub    $0x18,%esp
+  8025db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025e1:	50                   	push   %eax
+  8025e2:	53                   	push   %ebx
+  8025e3:	e8 8e fb ff ff       	call   802176 <fd_lookup>
+  8025e8:	83 c4 10             	add    $0x10,%esp
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	78 34                	js     802623 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025ef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025f2:	83 ec 08             	sub    $0x8,%esp
+  8025f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f8:	50                   	push   %eax
+  8025f9:	ff 36                	push   (%esi)
+  8025fb:	e8 c6 fb ff ff       	call   8021c6 <dev_lookup>
+  802600:	83 c4 10             	add    $0x10,%esp
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 1c                	js     802623 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802607:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80260b:	74 1d                	je     80262a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80260d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802610:	8b 40 18             	mov    0x18(%eax),%eax
+  802613:	85 c0                	test   %eax,%eax
+  802615:	74 5e                	je     802675 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	ff 75 0c             	push   0xc(%ebp)
+  80261d:	56                   	push   %esi
+  80261e:	ff d0                	call   *%eax
+  802620:	83 c4 10             	add    $0x10,%esp
+}
+  802623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802626:	5b                   	pop    %ebx
+  802627:	5e                   	pop    %esi
+  802628:	5d                   	pop    %ebp
+  802629:	c3                   	ret
+  80262a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80262c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802632:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802637:	77 18                	ja     802651 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802639:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80263e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802640:	c1 e8 10             	shr    $0x10,%eax
+  802643:	74 0c                	je     802651 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802645:	c1 e0 10             	shl    $0x10,%eax
+  802648:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80264d:	29 c2                	sub    %eax,%edx
+  80264f:	eb 06                	jmp    802657 <ftruncate+0x84>
+		return pthread_main_tls;
+  802651:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			thisenv->env_id, fdnum);
+  802657:	8b 02                	mov    (%edx),%eax
+  802659:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80265c:	83 ec 04             	sub    $0x4,%esp
+  80265f:	53                   	push   %ebx
+  802660:	50                   	push   %eax
+  802661:	68 e0 56 80 00       	push   $0x8056e0
+  802666:	e8 c9 e3 ff ff       	call   800a34 <cprintf>
+		return -E_INVAL;
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802673:	eb ae                	jmp    802623 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802675:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80267a:	eb a7                	jmp    802623 <ftruncate+0x50>
+
+0080267c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80267c:	55                   	push   %ebp
+  80267d:	89 e5                	mov    %esp,%ebp
+  80267f:	56                   	push   %esi
+  802680:	53                   	push   %ebx
+  802681:	83 ec 18             	sub    $0x18,%esp
+  802684:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802687:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80268a:	50                   	push   %eax
+  80268b:	ff 75 08             	push   0x8(%ebp)
+  80268e:	e8 e3 fa ff ff       	call   802176 <fd_lookup>
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	85 c0                	test   %eax,%eax
+  802698:	78 49                	js     8026e3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80269a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80269d:	83 ec 08             	sub    $0x8,%esp
+  8026a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a3:	50                   	push   %eax
+  8026a4:	ff 36                	push   (%esi)
+  8026a6:	e8 1b fb ff ff       	call   8021c6 <dev_lookup>
+  8026ab:	83 c4 10             	add    $0x10,%esp
+  8026ae:	85 c0                	test   %eax,%eax
+  8026b0:	78 31                	js     8026e3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8026b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026b5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8026b9:	74 2f                	je     8026ea <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8026bb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8026be:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8026c5:	00 00 00 
+	stat->st_isdir = 0;
+  8026c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026cf:	00 00 00 
+	stat->st_dev = dev;
+  8026d2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8026d8:	83 ec 08             	sub    $0x8,%esp
+  8026db:	53                   	push   %ebx
+  8026dc:	56                   	push   %esi
+  8026dd:	ff 50 14             	call   *0x14(%eax)
+  8026e0:	83 c4 10             	add    $0x10,%esp
+}
+  8026e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e6:	5b                   	pop    %ebx
+  8026e7:	5e                   	pop    %esi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026ef:	eb f2                	jmp    8026e3 <fstat+0x67>
+
+008026f1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8026f1:	55                   	push   %ebp
+  8026f2:	89 e5                	mov    %esp,%ebp
+  8026f4:	56                   	push   %esi
+  8026f5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8026f6:	83 ec 08             	sub    $0x8,%esp
+  8026f9:	6a 00                	push   $0x0
+  8026fb:	ff 75 08             	push   0x8(%ebp)
+  8026fe:	e8 4b 03 00 00       	call   802a4e <open>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 1b                	js     802727 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80270c:	83 ec 08             	sub    $0x8,%esp
+  80270f:	ff 75 0c             	push   0xc(%ebp)
+  802712:	50                   	push   %eax
+  802713:	e8 64 ff ff ff       	call   80267c <fstat>
+  802718:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80271a:	89 1c 24             	mov    %ebx,(%esp)
+  80271d:	e8 a8 fb ff ff       	call   8022ca <close>
+	return r;
+  802722:	83 c4 10             	add    $0x10,%esp
+  802725:	89 f3                	mov    %esi,%ebx
+}
+  802727:	89 d8                	mov    %ebx,%eax
+  802729:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80272c:	5b                   	pop    %ebx
+  80272d:	5e                   	pop    %esi
+  80272e:	5d                   	pop    %ebp
+  80272f:	c3                   	ret
+
+00802730 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802730:	55                   	push   %ebp
+  802731:	89 e5                	mov    %esp,%ebp
+  802733:	56                   	push   %esi
+  802734:	53                   	push   %ebx
+  802735:	89 c6                	mov    %eax,%esi
+  802737:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802739:	83 3d 18 70 80 00 00 	cmpl   $0x0,0x807018
+  802740:	74 27                	je     802769 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802742:	6a 07                	push   $0x7
+  802744:	68 00 80 80 00       	push   $0x808000
+  802749:	56                   	push   %esi
+  80274a:	ff 35 18 70 80 00    	push   0x807018
+  802750:	e8 0f f9 ff ff       	call   802064 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802755:	83 c4 0c             	add    $0xc,%esp
+  802758:	6a 00                	push   $0x0
+  80275a:	53                   	push   %ebx
+  80275b:	6a 00                	push   $0x0
+  80275d:	e8 0c f8 ff ff       	call   801f6e <ipc_recv>
+}
+  802762:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802765:	5b                   	pop    %ebx
+  802766:	5e                   	pop    %esi
+  802767:	5d                   	pop    %ebp
+  802768:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802769:	83 ec 0c             	sub    $0xc,%esp
+  80276c:	6a 01                	push   $0x1
+  80276e:	e8 47 f9 ff ff       	call   8020ba <ipc_find_env>
+  802773:	a3 18 70 80 00       	mov    %eax,0x807018
+  802778:	83 c4 10             	add    $0x10,%esp
+  80277b:	eb c5                	jmp    802742 <fsipc+0x12>
+
+0080277d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	53                   	push   %ebx
+  802781:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802784:	68 1c 70 80 00       	push   $0x80701c
+  802789:	e8 29 1b 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80278e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802791:	8b 40 0c             	mov    0xc(%eax),%eax
+  802794:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  802799:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80279c:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8027a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8027ab:	e8 80 ff ff ff       	call   802730 <fsipc>
+  8027b0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027b2:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  8027b9:	e8 66 1b 00 00       	call   804324 <mutex_unlock>
+	return r;
+}
+  8027be:	89 d8                	mov    %ebx,%eax
+  8027c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+008027c5 <devfile_flush>:
+{
+  8027c5:	55                   	push   %ebp
+  8027c6:	89 e5                	mov    %esp,%ebp
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8027cc:	68 1c 70 80 00       	push   $0x80701c
+  8027d1:	e8 e1 1a 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027dc:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8027e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8027eb:	e8 40 ff ff ff       	call   802730 <fsipc>
+  8027f0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027f2:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  8027f9:	e8 26 1b 00 00       	call   804324 <mutex_unlock>
+}
+  8027fe:	89 d8                	mov    %ebx,%eax
+  802800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802803:	c9                   	leave
+  802804:	c3                   	ret
+
+00802805 <devfile_stat>:
+{
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	56                   	push   %esi
+  802809:	53                   	push   %ebx
+  80280a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80280d:	83 ec 0c             	sub    $0xc,%esp
+  802810:	68 1c 70 80 00       	push   $0x80701c
+  802815:	e8 9d 1a 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80281a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802820:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802825:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80282f:	e8 fc fe ff ff       	call   802730 <fsipc>
+  802834:	89 c3                	mov    %eax,%ebx
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	79 16                	jns    802853 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80283d:	83 ec 0c             	sub    $0xc,%esp
+  802840:	68 1c 70 80 00       	push   $0x80701c
+  802845:	e8 da 1a 00 00       	call   804324 <mutex_unlock>
+}
+  80284a:	89 d8                	mov    %ebx,%eax
+  80284c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80284f:	5b                   	pop    %ebx
+  802850:	5e                   	pop    %esi
+  802851:	5d                   	pop    %ebp
+  802852:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802853:	83 ec 08             	sub    $0x8,%esp
+  802856:	68 00 80 80 00       	push   $0x808000
+  80285b:	56                   	push   %esi
+  80285c:	e8 b7 e7 ff ff       	call   801018 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802861:	a1 80 80 80 00       	mov    0x808080,%eax
+  802866:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80286c:	a1 84 80 80 00       	mov    0x808084,%eax
+  802871:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802877:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80287a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80287f:	eb bc                	jmp    80283d <devfile_stat+0x38>
+
+00802881 <devfile_write>:
+{
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	53                   	push   %ebx
+  802885:	83 ec 10             	sub    $0x10,%esp
+  802888:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80288b:	68 1c 70 80 00       	push   $0x80701c
+  802890:	e8 22 1a 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802895:	8b 45 08             	mov    0x8(%ebp),%eax
+  802898:	8b 40 0c             	mov    0xc(%eax),%eax
+  80289b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8028a0:	83 c4 10             	add    $0x10,%esp
+  8028a3:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8028a9:	76 3d                	jbe    8028e8 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8028ab:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8028b0:	39 c3                	cmp    %eax,%ebx
+  8028b2:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8028b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028b8:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8028bd:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8028c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028cd:	e8 5e fe ff ff       	call   802730 <fsipc>
+  8028d2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8028d4:	83 ec 0c             	sub    $0xc,%esp
+  8028d7:	68 1c 70 80 00       	push   $0x80701c
+  8028dc:	e8 43 1a 00 00       	call   804324 <mutex_unlock>
+}
+  8028e1:	89 d8                	mov    %ebx,%eax
+  8028e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e6:	c9                   	leave
+  8028e7:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8028e8:	83 ec 04             	sub    $0x4,%esp
+  8028eb:	53                   	push   %ebx
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	68 0c 80 80 00       	push   $0x80800c
+  8028f4:	e8 a5 e8 ff ff       	call   80119e <memmove>
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802901:	eb b5                	jmp    8028b8 <devfile_write+0x37>
+
+00802903 <devfile_read>:
+{
+  802903:	55                   	push   %ebp
+  802904:	89 e5                	mov    %esp,%ebp
+  802906:	57                   	push   %edi
+  802907:	56                   	push   %esi
+  802908:	53                   	push   %ebx
+  802909:	83 ec 0c             	sub    $0xc,%esp
+  80290c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80290f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802912:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802915:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80291b:	0f 86 8c 00 00 00    	jbe    8029ad <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802921:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802926:	39 c3                	cmp    %eax,%ebx
+  802928:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80292b:	89 f8                	mov    %edi,%eax
+  80292d:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802930:	eb 0f                	jmp    802941 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802932:	0f b6 08             	movzbl (%eax),%ecx
+  802935:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802937:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80293c:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802941:	39 d0                	cmp    %edx,%eax
+  802943:	72 ed                	jb     802932 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802945:	83 ec 0c             	sub    $0xc,%esp
+  802948:	68 1c 70 80 00       	push   $0x80701c
+  80294d:	e8 65 19 00 00       	call   8042b7 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802952:	8b 46 0c             	mov    0xc(%esi),%eax
+  802955:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  80295a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802960:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  802966:	ba 00 00 00 00       	mov    $0x0,%edx
+  80296b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802970:	e8 bb fd ff ff       	call   802730 <fsipc>
+  802975:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802977:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  80297e:	e8 a1 19 00 00       	call   804324 <mutex_unlock>
+		assert(r <= (int) n);
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	39 f3                	cmp    %esi,%ebx
+  802988:	7c 0a                	jl     802994 <devfile_read+0x91>
+}
+  80298a:	89 f0                	mov    %esi,%eax
+  80298c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298f:	5b                   	pop    %ebx
+  802990:	5e                   	pop    %esi
+  802991:	5f                   	pop    %edi
+  802992:	5d                   	pop    %ebp
+  802993:	c3                   	ret
+		assert(r <= (int) n);
+  802994:	68 50 57 80 00       	push   $0x805750
+  802999:	68 8f 50 80 00       	push   $0x80508f
+  80299e:	68 90 00 00 00       	push   $0x90
+  8029a3:	68 5d 57 80 00       	push   $0x80575d
+  8029a8:	e8 ac df ff ff       	call   800959 <_panic>
+	mutex_lock(&fsipc_mu);
+  8029ad:	83 ec 0c             	sub    $0xc,%esp
+  8029b0:	68 1c 70 80 00       	push   $0x80701c
+  8029b5:	e8 fd 18 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029ba:	8b 46 0c             	mov    0xc(%esi),%eax
+  8029bd:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8029c2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8029c8:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8029cf:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8029d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029dc:	e8 4f fd ff ff       	call   802730 <fsipc>
+  8029e1:	89 c6                	mov    %eax,%esi
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	78 1d                	js     802a07 <devfile_read+0x104>
+		assert(r <= n);
+  8029ea:	39 c3                	cmp    %eax,%ebx
+  8029ec:	72 2e                	jb     802a1c <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8029ee:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029f3:	7f 40                	jg     802a35 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8029f5:	83 ec 04             	sub    $0x4,%esp
+  8029f8:	50                   	push   %eax
+  8029f9:	68 00 80 80 00       	push   $0x808000
+  8029fe:	57                   	push   %edi
+  8029ff:	e8 9a e7 ff ff       	call   80119e <memmove>
+  802a04:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802a07:	83 ec 0c             	sub    $0xc,%esp
+  802a0a:	68 1c 70 80 00       	push   $0x80701c
+  802a0f:	e8 10 19 00 00       	call   804324 <mutex_unlock>
+	return r;
+  802a14:	83 c4 10             	add    $0x10,%esp
+  802a17:	e9 6e ff ff ff       	jmp    80298a <devfile_read+0x87>
+		assert(r <= n);
+  802a1c:	68 68 57 80 00       	push   $0x805768
+  802a21:	68 8f 50 80 00       	push   $0x80508f
+  802a26:	68 99 00 00 00       	push   $0x99
+  802a2b:	68 5d 57 80 00       	push   $0x80575d
+  802a30:	e8 24 df ff ff       	call   800959 <_panic>
+		assert(r <= PGSIZE);
+  802a35:	68 6f 57 80 00       	push   $0x80576f
+  802a3a:	68 8f 50 80 00       	push   $0x80508f
+  802a3f:	68 9a 00 00 00       	push   $0x9a
+  802a44:	68 5d 57 80 00       	push   $0x80575d
+  802a49:	e8 0b df ff ff       	call   800959 <_panic>
+
+00802a4e <open>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	56                   	push   %esi
+  802a52:	53                   	push   %ebx
+  802a53:	83 ec 1c             	sub    $0x1c,%esp
+  802a56:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802a59:	56                   	push   %esi
+  802a5a:	e8 7e e5 ff ff       	call   800fdd <strlen>
+  802a5f:	83 c4 10             	add    $0x10,%esp
+  802a62:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a67:	0f 8f 85 00 00 00    	jg     802af2 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802a6d:	83 ec 0c             	sub    $0xc,%esp
+  802a70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a73:	50                   	push   %eax
+  802a74:	e8 a7 f6 ff ff       	call   802120 <fd_alloc>
+  802a79:	89 c3                	mov    %eax,%ebx
+  802a7b:	83 c4 10             	add    $0x10,%esp
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	78 55                	js     802ad7 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802a82:	83 ec 0c             	sub    $0xc,%esp
+  802a85:	68 1c 70 80 00       	push   $0x80701c
+  802a8a:	e8 28 18 00 00       	call   8042b7 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802a8f:	83 c4 08             	add    $0x8,%esp
+  802a92:	56                   	push   %esi
+  802a93:	68 00 80 80 00       	push   $0x808000
+  802a98:	e8 7b e5 ff ff       	call   801018 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802a9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aa0:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  802aa5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802aa8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aad:	e8 7e fc ff ff       	call   802730 <fsipc>
+  802ab2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802ab4:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  802abb:	e8 64 18 00 00       	call   804324 <mutex_unlock>
+	if (r < 0) {
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	85 db                	test   %ebx,%ebx
+  802ac5:	78 19                	js     802ae0 <open+0x92>
+	return fd2num(fd);
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	ff 75 f4             	push   -0xc(%ebp)
+  802acd:	e8 27 f6 ff ff       	call   8020f9 <fd2num>
+  802ad2:	89 c3                	mov    %eax,%ebx
+  802ad4:	83 c4 10             	add    $0x10,%esp
+}
+  802ad7:	89 d8                	mov    %ebx,%eax
+  802ad9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802adc:	5b                   	pop    %ebx
+  802add:	5e                   	pop    %esi
+  802ade:	5d                   	pop    %ebp
+  802adf:	c3                   	ret
+		fd_close(fd, 0);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	6a 00                	push   $0x0
+  802ae5:	ff 75 f4             	push   -0xc(%ebp)
+  802ae8:	e8 56 f7 ff ff       	call   802243 <fd_close>
+		return r;
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	eb e5                	jmp    802ad7 <open+0x89>
+		return -E_BAD_PATH;
+  802af2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802af7:	eb de                	jmp    802ad7 <open+0x89>
+
+00802af9 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802af9:	55                   	push   %ebp
+  802afa:	89 e5                	mov    %esp,%ebp
+  802afc:	53                   	push   %ebx
+  802afd:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b03:	50                   	push   %eax
+  802b04:	ff 75 08             	push   0x8(%ebp)
+  802b07:	e8 6a f6 ff ff       	call   802176 <fd_lookup>
+  802b0c:	89 c3                	mov    %eax,%ebx
+  802b0e:	83 c4 10             	add    $0x10,%esp
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	78 5b                	js     802b70 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802b15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b18:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802b1e:	39 08                	cmp    %ecx,(%eax)
+  802b20:	75 55                	jne    802b77 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802b22:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802b26:	74 56                	je     802b7e <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802b28:	83 ec 0c             	sub    $0xc,%esp
+  802b2b:	68 1c 70 80 00       	push   $0x80701c
+  802b30:	e8 82 17 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b38:	8b 40 0c             	mov    0xc(%eax),%eax
+  802b3b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802b40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b43:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802b48:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b4b:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802b50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b55:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802b5a:	e8 d1 fb ff ff       	call   802730 <fsipc>
+  802b5f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802b61:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  802b68:	e8 b7 17 00 00       	call   804324 <mutex_unlock>
+	return r;
+  802b6d:	83 c4 10             	add    $0x10,%esp
+}
+  802b70:	89 d8                	mov    %ebx,%eax
+  802b72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b75:	c9                   	leave
+  802b76:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b77:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802b7c:	eb f2                	jmp    802b70 <fallocate+0x77>
+		return -E_INVAL;
+  802b7e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802b83:	eb eb                	jmp    802b70 <fallocate+0x77>
+
+00802b85 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802b85:	55                   	push   %ebp
+  802b86:	89 e5                	mov    %esp,%ebp
+  802b88:	56                   	push   %esi
+  802b89:	53                   	push   %ebx
+  802b8a:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802b8d:	89 f3                	mov    %esi,%ebx
+  802b8f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802b95:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802b98:	eb 06                	jmp    802ba0 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802b9a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ba0:	39 f3                	cmp    %esi,%ebx
+  802ba2:	73 14                	jae    802bb8 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802ba4:	83 ec 08             	sub    $0x8,%esp
+  802ba7:	53                   	push   %ebx
+  802ba8:	6a 00                	push   $0x0
+  802baa:	e8 40 e9 ff ff       	call   8014ef <sys_page_unmap>
+  802baf:	83 c4 10             	add    $0x10,%esp
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	79 e4                	jns    802b9a <munmap+0x15>
+  802bb6:	eb 05                	jmp    802bbd <munmap+0x38>
+			return r;
+	return 0;
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc0:	5b                   	pop    %ebx
+  802bc1:	5e                   	pop    %esi
+  802bc2:	5d                   	pop    %ebp
+  802bc3:	c3                   	ret
+
+00802bc4 <mmap>:
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	57                   	push   %edi
+  802bc8:	56                   	push   %esi
+  802bc9:	53                   	push   %ebx
+  802bca:	83 ec 24             	sub    $0x24,%esp
+  802bcd:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802bd0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802bd3:	50                   	push   %eax
+  802bd4:	ff 75 08             	push   0x8(%ebp)
+  802bd7:	e8 9a f5 ff ff       	call   802176 <fd_lookup>
+  802bdc:	83 c4 10             	add    $0x10,%esp
+  802bdf:	85 c0                	test   %eax,%eax
+  802be1:	0f 88 37 01 00 00    	js     802d1e <mmap+0x15a>
+		return NULL;
+  802be7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802bec:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bef:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802bf5:	39 0a                	cmp    %ecx,(%edx)
+  802bf7:	0f 85 05 01 00 00    	jne    802d02 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802bfd:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802c04:	0f 85 1b 01 00 00    	jne    802d25 <mmap+0x161>
+  802c0a:	89 f0                	mov    %esi,%eax
+  802c0c:	83 e8 01             	sub    $0x1,%eax
+  802c0f:	0f 88 17 01 00 00    	js     802d2c <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802c15:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802c19:	75 28                	jne    802c43 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802c1b:	83 ec 0c             	sub    $0xc,%esp
+  802c1e:	68 1c 70 80 00       	push   $0x80701c
+  802c23:	e8 8f 16 00 00       	call   8042b7 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802c28:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802c2e:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802c34:	83 c4 10             	add    $0x10,%esp
+  802c37:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802c3c:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802c41:	eb 2b                	jmp    802c6e <mmap+0xaa>
+		cow_enable();
+  802c43:	e8 b5 ee ff ff       	call   801afd <cow_enable>
+  802c48:	eb d1                	jmp    802c1b <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802c4a:	89 c2                	mov    %eax,%edx
+  802c4c:	c1 ea 0c             	shr    $0xc,%edx
+  802c4f:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802c56:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802c5c:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802c62:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802c65:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802c67:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802c6c:	77 25                	ja     802c93 <mmap+0xcf>
+  802c6e:	89 c2                	mov    %eax,%edx
+  802c70:	29 da                	sub    %ebx,%edx
+  802c72:	39 ca                	cmp    %ecx,%edx
+  802c74:	73 3a                	jae    802cb0 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802c76:	89 c2                	mov    %eax,%edx
+  802c78:	c1 ea 16             	shr    $0x16,%edx
+  802c7b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802c82:	f6 c2 01             	test   $0x1,%dl
+  802c85:	75 c3                	jne    802c4a <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802c87:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802c8c:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802c91:	eb d4                	jmp    802c67 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802c93:	29 d8                	sub    %ebx,%eax
+  802c95:	39 c8                	cmp    %ecx,%eax
+  802c97:	73 17                	jae    802cb0 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+  802c9c:	68 1c 70 80 00       	push   $0x80701c
+  802ca1:	e8 7e 16 00 00       	call   804324 <mutex_unlock>
+		return NULL;
+  802ca6:	83 c4 10             	add    $0x10,%esp
+  802ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cae:	eb 52                	jmp    802d02 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802cb0:	85 db                	test   %ebx,%ebx
+  802cb2:	74 e5                	je     802c99 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802cb4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cb7:	8b 40 0c             	mov    0xc(%eax),%eax
+  802cba:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802cbf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc2:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802cc7:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802ccd:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802cd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cd6:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802ce5:	e8 46 fa ff ff       	call   802730 <fsipc>
+  802cea:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802cec:	83 ec 0c             	sub    $0xc,%esp
+  802cef:	68 1c 70 80 00       	push   $0x80701c
+  802cf4:	e8 2b 16 00 00       	call   804324 <mutex_unlock>
+	if (r < 0) {
+  802cf9:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802cfc:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802cfe:	85 ff                	test   %edi,%edi
+  802d00:	78 08                	js     802d0a <mmap+0x146>
+}
+  802d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d05:	5b                   	pop    %ebx
+  802d06:	5e                   	pop    %esi
+  802d07:	5f                   	pop    %edi
+  802d08:	5d                   	pop    %ebp
+  802d09:	c3                   	ret
+		munmap((void*) va, len);
+  802d0a:	83 ec 08             	sub    $0x8,%esp
+  802d0d:	56                   	push   %esi
+  802d0e:	53                   	push   %ebx
+  802d0f:	e8 71 fe ff ff       	call   802b85 <munmap>
+		return NULL;
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1c:	eb e4                	jmp    802d02 <mmap+0x13e>
+		return NULL;
+  802d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d23:	eb dd                	jmp    802d02 <mmap+0x13e>
+		return NULL;
+  802d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2a:	eb d6                	jmp    802d02 <mmap+0x13e>
+  802d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d31:	eb cf                	jmp    802d02 <mmap+0x13e>
+
+00802d33 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	53                   	push   %ebx
+  802d37:	83 ec 10             	sub    $0x10,%esp
+  802d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802d3d:	53                   	push   %ebx
+  802d3e:	e8 9a e2 ff ff       	call   800fdd <strlen>
+  802d43:	83 c4 10             	add    $0x10,%esp
+  802d46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d4b:	7f 42                	jg     802d8f <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802d4d:	83 ec 0c             	sub    $0xc,%esp
+  802d50:	68 1c 70 80 00       	push   $0x80701c
+  802d55:	e8 5d 15 00 00       	call   8042b7 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802d5a:	83 c4 08             	add    $0x8,%esp
+  802d5d:	53                   	push   %ebx
+  802d5e:	68 00 80 80 00       	push   $0x808000
+  802d63:	e8 b0 e2 ff ff       	call   801018 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d72:	e8 b9 f9 ff ff       	call   802730 <fsipc>
+  802d77:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802d79:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  802d80:	e8 9f 15 00 00       	call   804324 <mutex_unlock>
+	return r;
+  802d85:	83 c4 10             	add    $0x10,%esp
+}
+  802d88:	89 d8                	mov    %ebx,%eax
+  802d8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d8d:	c9                   	leave
+  802d8e:	c3                   	ret
+		return -E_BAD_PATH;
+  802d8f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802d94:	eb f2                	jmp    802d88 <remove+0x55>
+
+00802d96 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802d96:	55                   	push   %ebp
+  802d97:	89 e5                	mov    %esp,%ebp
+  802d99:	53                   	push   %ebx
+  802d9a:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802d9d:	68 1c 70 80 00       	push   $0x80701c
+  802da2:	e8 10 15 00 00       	call   8042b7 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dac:	b8 08 00 00 00       	mov    $0x8,%eax
+  802db1:	e8 7a f9 ff ff       	call   802730 <fsipc>
+  802db6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802db8:	c7 04 24 1c 70 80 00 	movl   $0x80701c,(%esp)
+  802dbf:	e8 60 15 00 00       	call   804324 <mutex_unlock>
+	return r;
+}
+  802dc4:	89 d8                	mov    %ebx,%eax
+  802dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc9:	c9                   	leave
+  802dca:	c3                   	ret
+
+00802dcb <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802dcb:	55                   	push   %ebp
+  802dcc:	89 e5                	mov    %esp,%ebp
+  802dce:	56                   	push   %esi
+  802dcf:	53                   	push   %ebx
+  802dd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802dd3:	83 ec 0c             	sub    $0xc,%esp
+  802dd6:	68 1c 70 80 00       	push   $0x80701c
+  802ddb:	e8 d7 14 00 00       	call   8042b7 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de3:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802de8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ded:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802df2:	e8 39 f9 ff ff       	call   802730 <fsipc>
+  802df7:	89 c6                	mov    %eax,%esi
+  802df9:	83 c4 10             	add    $0x10,%esp
+  802dfc:	85 db                	test   %ebx,%ebx
+  802dfe:	74 7b                	je     802e7b <fs_bcstat+0xb0>
+  802e00:	85 c0                	test   %eax,%eax
+  802e02:	78 77                	js     802e7b <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802e04:	a1 00 80 80 00       	mov    0x808000,%eax
+  802e09:	89 03                	mov    %eax,(%ebx)
+  802e0b:	a1 04 80 80 00       	mov    0x808004,%eax
+  802e10:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e13:	a1 08 80 80 00       	mov    0x808008,%eax
+  802e18:	89 43 08             	mov    %eax,0x8(%ebx)
+  802e1b:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802e20:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802e23:	a1 10 80 80 00       	mov    0x808010,%eax
+  802e28:	89 43 10             	mov    %eax,0x10(%ebx)
+  802e2b:	a1 14 80 80 00       	mov    0x808014,%eax
+  802e30:	89 43 14             	mov    %eax,0x14(%ebx)
+  802e33:	a1 18 80 80 00       	mov    0x808018,%eax
+  802e38:	89 43 18             	mov    %eax,0x18(%ebx)
+  802e3b:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802e40:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802e43:	a1 20 80 80 00       	mov    0x808020,%eax
+  802e48:	89 43 20             	mov    %eax,0x20(%ebx)
+  802e4b:	a1 24 80 80 00       	mov    0x808024,%eax
+  802e50:	89 43 24             	mov    %eax,0x24(%ebx)
+  802e53:	a1 28 80 80 00       	mov    0x808028,%eax
+  802e58:	89 43 28             	mov    %eax,0x28(%ebx)
+  802e5b:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802e60:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802e63:	a1 30 80 80 00       	mov    0x808030,%eax
+  802e68:	89 43 30             	mov    %eax,0x30(%ebx)
+  802e6b:	a1 34 80 80 00       	mov    0x808034,%eax
+  802e70:	89 43 34             	mov    %eax,0x34(%ebx)
+  802e73:	a1 38 80 80 00       	mov    0x808038,%eax
+  802e78:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802e7b:	83 ec 0c             	sub    $0xc,%esp
+  802e7e:	68 1c 70 80 00       	push   $0x80701c
+  802e83:	e8 9c 14 00 00       	call   804324 <mutex_unlock>
+	return r;
+}
+  802e88:	89 f0                	mov    %esi,%eax
+  802e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e8d:	5b                   	pop    %ebx
+  802e8e:	5e                   	pop    %esi
+  802e8f:	5d                   	pop    %ebp
+  802e90:	c3                   	ret
+
+00802e91 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802e91:	55                   	push   %ebp
+  802e92:	89 e5                	mov    %esp,%ebp
+  802e94:	56                   	push   %esi
+  802e95:	53                   	push   %ebx
+  802e96:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802e98:	0f b6 10             	movzbl (%eax),%edx
+  802e9b:	80 fa 72             	cmp    $0x72,%dl
+  802e9e:	74 44                	je     802ee4 <parse_mode+0x53>
+  802ea0:	80 fa 77             	cmp    $0x77,%dl
+  802ea3:	74 4b                	je     802ef0 <parse_mode+0x5f>
+  802ea5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802eaa:	80 fa 61             	cmp    $0x61,%dl
+  802ead:	74 09                	je     802eb8 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802eaf:	89 d8                	mov    %ebx,%eax
+  802eb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eb4:	5b                   	pop    %ebx
+  802eb5:	5e                   	pop    %esi
+  802eb6:	5d                   	pop    %ebp
+  802eb7:	c3                   	ret
+	switch (mode[0]) {
+  802eb8:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802ebd:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802ec2:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802ec4:	83 ec 08             	sub    $0x8,%esp
+  802ec7:	6a 2b                	push   $0x2b
+  802ec9:	50                   	push   %eax
+  802eca:	e8 5b e2 ff ff       	call   80112a <strchr>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	74 d9                	je     802eaf <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802ed6:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802ed9:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802edc:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802ee2:	eb cb                	jmp    802eaf <parse_mode+0x1e>
+	switch (mode[0]) {
+  802ee4:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eee:	eb d2                	jmp    802ec2 <parse_mode+0x31>
+  802ef0:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802ef5:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802efa:	eb c6                	jmp    802ec2 <parse_mode+0x31>
+
+00802efc <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802efc:	55                   	push   %ebp
+  802efd:	89 e5                	mov    %esp,%ebp
+  802eff:	57                   	push   %edi
+  802f00:	56                   	push   %esi
+  802f01:	53                   	push   %ebx
+  802f02:	83 ec 1c             	sub    $0x1c,%esp
+  802f05:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f08:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802f0b:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802f15:	83 c0 24             	add    $0x24,%eax
+  802f18:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802f1c:	74 17                	je     802f35 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802f1e:	83 c3 01             	add    $0x1,%ebx
+  802f21:	83 fb 10             	cmp    $0x10,%ebx
+  802f24:	75 ef                	jne    802f15 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802f26:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802f2b:	89 f0                	mov    %esi,%eax
+  802f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f30:	5b                   	pop    %ebx
+  802f31:	5e                   	pop    %esi
+  802f32:	5f                   	pop    %edi
+  802f33:	5d                   	pop    %ebp
+  802f34:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802f35:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802f3c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f3f:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802f42:	c1 e7 02             	shl    $0x2,%edi
+  802f45:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802f4b:	83 ec 04             	sub    $0x4,%esp
+  802f4e:	6a 24                	push   $0x24
+  802f50:	6a 00                	push   $0x0
+  802f52:	56                   	push   %esi
+  802f53:	e8 11 e2 ff ff       	call   801169 <memset>
+			streams[i].f_fd = fd;
+  802f58:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f5b:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802f61:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f64:	01 d8                	add    %ebx,%eax
+  802f66:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f69:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802f70:	83 c4 10             	add    $0x10,%esp
+  802f73:	eb b6                	jmp    802f2b <stream_alloc+0x2f>
+
+00802f75 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802f75:	55                   	push   %ebp
+  802f76:	89 e5                	mov    %esp,%ebp
+  802f78:	53                   	push   %ebx
+  802f79:	83 ec 14             	sub    $0x14,%esp
+  802f7c:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802f7e:	8b 40 18             	mov    0x18(%eax),%eax
+  802f81:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802f84:	74 4a                	je     802fd0 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802f86:	83 ec 08             	sub    $0x8,%esp
+  802f89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f8c:	50                   	push   %eax
+  802f8d:	ff 33                	push   (%ebx)
+  802f8f:	e8 e2 f1 ff ff       	call   802176 <fd_lookup>
+  802f94:	89 c2                	mov    %eax,%edx
+  802f96:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802f9e:	85 d2                	test   %edx,%edx
+  802fa0:	78 41                	js     802fe3 <stream_unread+0x6e>
+  802fa2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fa5:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802fab:	39 0a                	cmp    %ecx,(%edx)
+  802fad:	75 34                	jne    802fe3 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802faf:	8b 43 14             	mov    0x14(%ebx),%eax
+  802fb2:	03 42 04             	add    0x4(%edx),%eax
+  802fb5:	2b 43 18             	sub    0x18(%ebx),%eax
+  802fb8:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802fbb:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802fc2:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fce:	eb 13                	jmp    802fe3 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802fd0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802fd7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802fde:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802fe3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe6:	c9                   	leave
+  802fe7:	c3                   	ret
+
+00802fe8 <stream_drain>:
+{
+  802fe8:	55                   	push   %ebp
+  802fe9:	89 e5                	mov    %esp,%ebp
+  802feb:	56                   	push   %esi
+  802fec:	53                   	push   %ebx
+  802fed:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ff4:	eb 02                	jmp    802ff8 <stream_drain+0x10>
+  802ff6:	01 c3                	add    %eax,%ebx
+  802ff8:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802ffb:	39 c3                	cmp    %eax,%ebx
+  802ffd:	73 43                	jae    803042 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802fff:	83 ec 04             	sub    $0x4,%esp
+  803002:	29 d8                	sub    %ebx,%eax
+  803004:	50                   	push   %eax
+  803005:	89 d8                	mov    %ebx,%eax
+  803007:	03 46 0c             	add    0xc(%esi),%eax
+  80300a:	50                   	push   %eax
+  80300b:	ff 36                	push   (%esi)
+  80300d:	e8 ec f4 ff ff       	call   8024fe <write>
+  803012:	83 c4 10             	add    $0x10,%esp
+  803015:	85 c0                	test   %eax,%eax
+  803017:	7f dd                	jg     802ff6 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  803019:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80301d:	8b 56 0c             	mov    0xc(%esi),%edx
+  803020:	83 ec 04             	sub    $0x4,%esp
+  803023:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803026:	29 d8                	sub    %ebx,%eax
+  803028:	50                   	push   %eax
+  803029:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80302c:	50                   	push   %eax
+  80302d:	52                   	push   %edx
+  80302e:	e8 6b e1 ff ff       	call   80119e <memmove>
+			f->f_wend -= done;
+  803033:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803036:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  803038:	83 c4 10             	add    $0x10,%esp
+  80303b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803040:	eb 0a                	jmp    80304c <stream_drain+0x64>
+  803042:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  803047:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80304c:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80304f:	89 d0                	mov    %edx,%eax
+  803051:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803054:	5b                   	pop    %ebx
+  803055:	5e                   	pop    %esi
+  803056:	5d                   	pop    %ebp
+  803057:	c3                   	ret
+
+00803058 <stream_setup>:
+	if (f->f_buf)
+  803058:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80305c:	74 01                	je     80305f <stream_setup+0x7>
+  80305e:	c3                   	ret
+{
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	53                   	push   %ebx
+  803063:	83 ec 04             	sub    $0x4,%esp
+  803066:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  803068:	8b 40 08             	mov    0x8(%eax),%eax
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	74 17                	je     803086 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80306f:	83 f8 03             	cmp    $0x3,%eax
+  803072:	75 2d                	jne    8030a1 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  803074:	8d 43 20             	lea    0x20(%ebx),%eax
+  803077:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80307a:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  803081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803084:	c9                   	leave
+  803085:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  803086:	83 ec 0c             	sub    $0xc,%esp
+  803089:	ff 33                	push   (%ebx)
+  80308b:	e8 29 1b 00 00       	call   804bb9 <iscons>
+  803090:	83 c4 10             	add    $0x10,%esp
+  803093:	85 c0                	test   %eax,%eax
+  803095:	0f 9f c0             	setg   %al
+  803098:	0f b6 c0             	movzbl %al,%eax
+  80309b:	83 c0 01             	add    $0x1,%eax
+  80309e:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8030a1:	83 ec 0c             	sub    $0xc,%esp
+  8030a4:	68 00 10 00 00       	push   $0x1000
+  8030a9:	e8 6e 0b 00 00       	call   803c1c <malloc>
+  8030ae:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8030b1:	83 c4 10             	add    $0x10,%esp
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	74 bc                	je     803074 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8030b8:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8030bf:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8030c3:	eb bc                	jmp    803081 <stream_setup+0x29>
+
+008030c5 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8030c5:	55                   	push   %ebp
+  8030c6:	89 e5                	mov    %esp,%ebp
+  8030c8:	53                   	push   %ebx
+  8030c9:	83 ec 04             	sub    $0x4,%esp
+  8030cc:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8030ce:	e8 85 ff ff ff       	call   803058 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8030d3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8030d8:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8030dc:	74 3d                	je     80311b <stream_fill+0x56>
+  8030de:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8030e2:	74 10                	je     8030f4 <stream_fill+0x2f>
+  8030e4:	89 d8                	mov    %ebx,%eax
+  8030e6:	e8 fd fe ff ff       	call   802fe8 <stream_drain>
+		return 0;
+  8030eb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8030f0:	85 c0                	test   %eax,%eax
+  8030f2:	78 27                	js     80311b <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8030f4:	83 ec 04             	sub    $0x4,%esp
+  8030f7:	ff 73 10             	push   0x10(%ebx)
+  8030fa:	ff 73 0c             	push   0xc(%ebx)
+  8030fd:	ff 33                	push   (%ebx)
+  8030ff:	e8 02 f3 ff ff       	call   802406 <read>
+  803104:	83 c4 10             	add    $0x10,%esp
+  803107:	85 c0                	test   %eax,%eax
+  803109:	7e 17                	jle    803122 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80310b:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80310f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  803116:	89 c2                	mov    %eax,%edx
+  803118:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80311b:	89 d0                	mov    %edx,%eax
+  80311d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803120:	c9                   	leave
+  803121:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  803122:	c1 f8 1f             	sar    $0x1f,%eax
+  803125:	83 e0 04             	and    $0x4,%eax
+  803128:	83 c0 04             	add    $0x4,%eax
+  80312b:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80312e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803133:	eb e6                	jmp    80311b <stream_fill+0x56>
+
+00803135 <fopen>:
+{
+  803135:	55                   	push   %ebp
+  803136:	89 e5                	mov    %esp,%ebp
+  803138:	57                   	push   %edi
+  803139:	56                   	push   %esi
+  80313a:	53                   	push   %ebx
+  80313b:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  803141:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  803144:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80314a:	89 f0                	mov    %esi,%eax
+  80314c:	e8 40 fd ff ff       	call   802e91 <parse_mode>
+		return 0;
+  803151:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  803156:	85 c0                	test   %eax,%eax
+  803158:	78 2d                	js     803187 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80315a:	83 ec 08             	sub    $0x8,%esp
+  80315d:	50                   	push   %eax
+  80315e:	ff 75 08             	push   0x8(%ebp)
+  803161:	e8 e8 f8 ff ff       	call   802a4e <open>
+  803166:	89 c7                	mov    %eax,%edi
+  803168:	83 c4 10             	add    $0x10,%esp
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	78 58                	js     8031c7 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80316f:	80 3e 61             	cmpb   $0x61,(%esi)
+  803172:	74 1d                	je     803191 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  803174:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80317a:	89 f8                	mov    %edi,%eax
+  80317c:	e8 7b fd ff ff       	call   802efc <stream_alloc>
+  803181:	89 c3                	mov    %eax,%ebx
+  803183:	85 c0                	test   %eax,%eax
+  803185:	74 32                	je     8031b9 <fopen+0x84>
+}
+  803187:	89 d8                	mov    %ebx,%eax
+  803189:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80318c:	5b                   	pop    %ebx
+  80318d:	5e                   	pop    %esi
+  80318e:	5f                   	pop    %edi
+  80318f:	5d                   	pop    %ebp
+  803190:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  803191:	83 ec 08             	sub    $0x8,%esp
+  803194:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80319a:	50                   	push   %eax
+  80319b:	57                   	push   %edi
+  80319c:	e8 db f4 ff ff       	call   80267c <fstat>
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	78 cc                	js     803174 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8031a8:	83 ec 08             	sub    $0x8,%esp
+  8031ab:	ff 75 dc             	push   -0x24(%ebp)
+  8031ae:	57                   	push   %edi
+  8031af:	e8 f6 f3 ff ff       	call   8025aa <seek>
+  8031b4:	83 c4 10             	add    $0x10,%esp
+  8031b7:	eb bb                	jmp    803174 <fopen+0x3f>
+		close(fd);
+  8031b9:	83 ec 0c             	sub    $0xc,%esp
+  8031bc:	57                   	push   %edi
+  8031bd:	e8 08 f1 ff ff       	call   8022ca <close>
+  8031c2:	83 c4 10             	add    $0x10,%esp
+  8031c5:	eb c0                	jmp    803187 <fopen+0x52>
+		return 0;
+  8031c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031cc:	eb b9                	jmp    803187 <fopen+0x52>
+
+008031ce <fdopen>:
+{
+  8031ce:	55                   	push   %ebp
+  8031cf:	89 e5                	mov    %esp,%ebp
+  8031d1:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8031d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8031d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031da:	e8 b2 fc ff ff       	call   802e91 <parse_mode>
+  8031df:	89 c2                	mov    %eax,%edx
+		return 0;
+  8031e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8031e6:	85 d2                	test   %edx,%edx
+  8031e8:	78 0b                	js     8031f5 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8031ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f0:	e8 07 fd ff ff       	call   802efc <stream_alloc>
+}
+  8031f5:	c9                   	leave
+  8031f6:	c3                   	ret
+
+008031f7 <setvbuf>:
+{
+  8031f7:	55                   	push   %ebp
+  8031f8:	89 e5                	mov    %esp,%ebp
+  8031fa:	57                   	push   %edi
+  8031fb:	56                   	push   %esi
+  8031fc:	53                   	push   %ebx
+  8031fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803200:	8b 55 10             	mov    0x10(%ebp),%edx
+  803203:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  803206:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80320a:	75 3a                	jne    803246 <setvbuf+0x4f>
+  80320c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80320f:	83 fe 02             	cmp    $0x2,%esi
+  803212:	77 39                	ja     80324d <setvbuf+0x56>
+	f->f_bufmode = mode;
+  803214:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  803217:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80321b:	0f 95 c3             	setne  %bl
+  80321e:	85 ff                	test   %edi,%edi
+  803220:	0f 95 c1             	setne  %cl
+  803223:	84 cb                	test   %cl,%bl
+  803225:	74 05                	je     80322c <setvbuf+0x35>
+  803227:	83 fa 03             	cmp    $0x3,%edx
+  80322a:	75 0a                	jne    803236 <setvbuf+0x3f>
+	return 0;
+  80322c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803231:	5b                   	pop    %ebx
+  803232:	5e                   	pop    %esi
+  803233:	5f                   	pop    %edi
+  803234:	5d                   	pop    %ebp
+  803235:	c3                   	ret
+		f->f_buf = buf;
+  803236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803239:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80323c:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80323f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803244:	eb eb                	jmp    803231 <setvbuf+0x3a>
+		return EOF;
+  803246:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80324b:	eb e4                	jmp    803231 <setvbuf+0x3a>
+  80324d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803252:	eb dd                	jmp    803231 <setvbuf+0x3a>
+
+00803254 <fflush>:
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	57                   	push   %edi
+  803258:	56                   	push   %esi
+  803259:	53                   	push   %ebx
+  80325a:	83 ec 0c             	sub    $0xc,%esp
+  80325d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  803260:	85 db                	test   %ebx,%ebx
+  803262:	74 1a                	je     80327e <fflush+0x2a>
+	stream_unread(f);
+  803264:	89 d8                	mov    %ebx,%eax
+  803266:	e8 0a fd ff ff       	call   802f75 <stream_unread>
+	return stream_drain(f);
+  80326b:	89 d8                	mov    %ebx,%eax
+  80326d:	e8 76 fd ff ff       	call   802fe8 <stream_drain>
+  803272:	89 c7                	mov    %eax,%edi
+}
+  803274:	89 f8                	mov    %edi,%eax
+  803276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803279:	5b                   	pop    %ebx
+  80327a:	5e                   	pop    %esi
+  80327b:	5f                   	pop    %edi
+  80327c:	5d                   	pop    %ebp
+  80327d:	c3                   	ret
+  80327e:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  803283:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  803288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80328d:	eb 03                	jmp    803292 <fflush+0x3e>
+  80328f:	83 c3 24             	add    $0x24,%ebx
+  803292:	39 f3                	cmp    %esi,%ebx
+  803294:	74 de                	je     803274 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  803296:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80329a:	74 f3                	je     80328f <fflush+0x3b>
+  80329c:	83 ec 0c             	sub    $0xc,%esp
+  80329f:	53                   	push   %ebx
+  8032a0:	e8 af ff ff ff       	call   803254 <fflush>
+  8032a5:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8032a8:	85 c0                	test   %eax,%eax
+  8032aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8032af:	0f 48 f8             	cmovs  %eax,%edi
+  8032b2:	eb db                	jmp    80328f <fflush+0x3b>
+
+008032b4 <fclose>:
+{
+  8032b4:	55                   	push   %ebp
+  8032b5:	89 e5                	mov    %esp,%ebp
+  8032b7:	56                   	push   %esi
+  8032b8:	53                   	push   %ebx
+  8032b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8032bc:	83 ec 0c             	sub    $0xc,%esp
+  8032bf:	56                   	push   %esi
+  8032c0:	e8 8f ff ff ff       	call   803254 <fflush>
+  8032c5:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8032c7:	83 c4 04             	add    $0x4,%esp
+  8032ca:	ff 36                	push   (%esi)
+  8032cc:	e8 f9 ef ff ff       	call   8022ca <close>
+  8032d1:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8032db:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8032de:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8032e2:	75 10                	jne    8032f4 <fclose+0x40>
+	f->f_flags = 0;
+  8032e4:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8032eb:	89 d8                	mov    %ebx,%eax
+  8032ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032f0:	5b                   	pop    %ebx
+  8032f1:	5e                   	pop    %esi
+  8032f2:	5d                   	pop    %ebp
+  8032f3:	c3                   	ret
+		free(f->f_buf);
+  8032f4:	83 ec 0c             	sub    $0xc,%esp
+  8032f7:	ff 76 0c             	push   0xc(%esi)
+  8032fa:	e8 54 08 00 00       	call   803b53 <free>
+  8032ff:	83 c4 10             	add    $0x10,%esp
+  803302:	eb e0                	jmp    8032e4 <fclose+0x30>
+
+00803304 <fileno>:
+{
+  803304:	55                   	push   %ebp
+  803305:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  803307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80330a:	8b 00                	mov    (%eax),%eax
+}
+  80330c:	5d                   	pop    %ebp
+  80330d:	c3                   	ret
+
+0080330e <feof>:
+{
+  80330e:	55                   	push   %ebp
+  80330f:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  803311:	8b 45 08             	mov    0x8(%ebp),%eax
+  803314:	8b 40 04             	mov    0x4(%eax),%eax
+  803317:	c1 e8 02             	shr    $0x2,%eax
+  80331a:	83 e0 01             	and    $0x1,%eax
+}
+  80331d:	5d                   	pop    %ebp
+  80331e:	c3                   	ret
+
+0080331f <ferror>:
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  803322:	8b 45 08             	mov    0x8(%ebp),%eax
+  803325:	8b 40 04             	mov    0x4(%eax),%eax
+  803328:	c1 e8 03             	shr    $0x3,%eax
+  80332b:	83 e0 01             	and    $0x1,%eax
+}
+  80332e:	5d                   	pop    %ebp
+  80332f:	c3                   	ret
+
+00803330 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	53                   	push   %ebx
+  803334:	83 ec 04             	sub    $0x4,%esp
+  803337:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80333a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80333d:	39 43 14             	cmp    %eax,0x14(%ebx)
+  803340:	74 15                	je     803357 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  803342:	8b 53 0c             	mov    0xc(%ebx),%edx
+  803345:	8b 43 14             	mov    0x14(%ebx),%eax
+  803348:	8d 48 01             	lea    0x1(%eax),%ecx
+  80334b:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80334e:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  803352:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803355:	c9                   	leave
+  803356:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  803357:	89 d8                	mov    %ebx,%eax
+  803359:	e8 67 fd ff ff       	call   8030c5 <stream_fill>
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	75 e0                	jne    803342 <fgetc+0x12>
+		return EOF;
+  803362:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803367:	eb e9                	jmp    803352 <fgetc+0x22>
+
+00803369 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  803369:	55                   	push   %ebp
+  80336a:	89 e5                	mov    %esp,%ebp
+  80336c:	57                   	push   %edi
+  80336d:	56                   	push   %esi
+  80336e:	53                   	push   %ebx
+  80336f:	83 ec 1c             	sub    $0x1c,%esp
+  803372:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  803375:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80337a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80337d:	83 e8 01             	sub    $0x1,%eax
+  803380:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  803383:	eb 66                	jmp    8033eb <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  803385:	8b 46 14             	mov    0x14(%esi),%eax
+  803388:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80338b:	29 c3                	sub    %eax,%ebx
+  80338d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803390:	29 fa                	sub    %edi,%edx
+  803392:	39 d3                	cmp    %edx,%ebx
+  803394:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  803397:	83 ec 04             	sub    $0x4,%esp
+  80339a:	53                   	push   %ebx
+  80339b:	6a 0a                	push   $0xa
+  80339d:	03 46 0c             	add    0xc(%esi),%eax
+  8033a0:	50                   	push   %eax
+  8033a1:	e8 a9 de ff ff       	call   80124f <memfind>
+  8033a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8033a9:	8b 46 0c             	mov    0xc(%esi),%eax
+  8033ac:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8033af:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8033b2:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8033b4:	83 c4 10             	add    $0x10,%esp
+  8033b7:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8033ba:	74 0b                	je     8033c7 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8033bc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8033bf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8033c2:	29 d3                	sub    %edx,%ebx
+  8033c4:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8033c7:	83 ec 04             	sub    $0x4,%esp
+  8033ca:	53                   	push   %ebx
+  8033cb:	01 c8                	add    %ecx,%eax
+  8033cd:	50                   	push   %eax
+  8033ce:	89 f8                	mov    %edi,%eax
+  8033d0:	03 45 08             	add    0x8(%ebp),%eax
+  8033d3:	50                   	push   %eax
+  8033d4:	e8 c5 dd ff ff       	call   80119e <memmove>
+		f->f_rpos += m;
+  8033d9:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8033dc:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8033de:	83 c4 10             	add    $0x10,%esp
+  8033e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e4:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8033e9:	74 1f                	je     80340a <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8033eb:	8d 47 01             	lea    0x1(%edi),%eax
+  8033ee:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8033f1:	73 17                	jae    80340a <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8033f3:	8b 46 18             	mov    0x18(%esi),%eax
+  8033f6:	39 46 14             	cmp    %eax,0x14(%esi)
+  8033f9:	75 8a                	jne    803385 <fgets+0x1c>
+  8033fb:	89 f0                	mov    %esi,%eax
+  8033fd:	e8 c3 fc ff ff       	call   8030c5 <stream_fill>
+  803402:	85 c0                	test   %eax,%eax
+  803404:	0f 85 7b ff ff ff    	jne    803385 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80340a:	85 ff                	test   %edi,%edi
+  80340c:	74 0f                	je     80341d <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80340e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803411:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  803415:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803418:	5b                   	pop    %ebx
+  803419:	5e                   	pop    %esi
+  80341a:	5f                   	pop    %edi
+  80341b:	5d                   	pop    %ebp
+  80341c:	c3                   	ret
+		return 0;
+  80341d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803422:	eb f1                	jmp    803415 <fgets+0xac>
+
+00803424 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	57                   	push   %edi
+  803428:	56                   	push   %esi
+  803429:	53                   	push   %ebx
+  80342a:	83 ec 1c             	sub    $0x1c,%esp
+  80342d:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  803430:	89 f0                	mov    %esi,%eax
+  803432:	e8 21 fc ff ff       	call   803058 <stream_setup>
+	want = size * n;
+  803437:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80343a:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80343e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  803441:	bf 00 00 00 00       	mov    $0x0,%edi
+  803446:	eb 43                	jmp    80348b <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  803448:	29 d3                	sub    %edx,%ebx
+  80344a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80344d:	29 f8                	sub    %edi,%eax
+  80344f:	39 c3                	cmp    %eax,%ebx
+  803451:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  803454:	83 ec 04             	sub    $0x4,%esp
+  803457:	53                   	push   %ebx
+  803458:	03 56 0c             	add    0xc(%esi),%edx
+  80345b:	52                   	push   %edx
+  80345c:	89 f8                	mov    %edi,%eax
+  80345e:	03 45 08             	add    0x8(%ebp),%eax
+  803461:	50                   	push   %eax
+  803462:	e8 37 dd ff ff       	call   80119e <memmove>
+			f->f_rpos += m;
+  803467:	01 5e 14             	add    %ebx,0x14(%esi)
+  80346a:	83 c4 10             	add    $0x10,%esp
+  80346d:	eb 1a                	jmp    803489 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  80346f:	83 ec 04             	sub    $0x4,%esp
+  803472:	53                   	push   %ebx
+  803473:	89 f8                	mov    %edi,%eax
+  803475:	03 45 08             	add    0x8(%ebp),%eax
+  803478:	50                   	push   %eax
+  803479:	ff 36                	push   (%esi)
+  80347b:	e8 86 ef ff ff       	call   802406 <read>
+  803480:	89 c3                	mov    %eax,%ebx
+  803482:	83 c4 10             	add    $0x10,%esp
+  803485:	85 c0                	test   %eax,%eax
+  803487:	7e 36                	jle    8034bf <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  803489:	01 df                	add    %ebx,%edi
+  80348b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80348e:	39 c7                	cmp    %eax,%edi
+  803490:	73 39                	jae    8034cb <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  803492:	8b 56 14             	mov    0x14(%esi),%edx
+  803495:	8b 5e 18             	mov    0x18(%esi),%ebx
+  803498:	39 da                	cmp    %ebx,%edx
+  80349a:	72 ac                	jb     803448 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80349c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80349f:	29 fb                	sub    %edi,%ebx
+  8034a1:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8034a4:	72 3e                	jb     8034e4 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8034a6:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8034aa:	74 1f                	je     8034cb <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8034ac:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8034b0:	74 bd                	je     80346f <fread+0x4b>
+  8034b2:	89 f0                	mov    %esi,%eax
+  8034b4:	e8 2f fb ff ff       	call   802fe8 <stream_drain>
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	79 b2                	jns    80346f <fread+0x4b>
+  8034bd:	eb 0c                	jmp    8034cb <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8034bf:	c1 fb 1f             	sar    $0x1f,%ebx
+  8034c2:	83 e3 04             	and    $0x4,%ebx
+  8034c5:	83 c3 04             	add    $0x4,%ebx
+  8034c8:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8034cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034ce:	85 c0                	test   %eax,%eax
+  8034d0:	74 0a                	je     8034dc <fread+0xb8>
+  8034d2:	89 f8                	mov    %edi,%eax
+  8034d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d9:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8034dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034df:	5b                   	pop    %ebx
+  8034e0:	5e                   	pop    %esi
+  8034e1:	5f                   	pop    %edi
+  8034e2:	5d                   	pop    %ebp
+  8034e3:	c3                   	ret
+		} else if (!stream_fill(f))
+  8034e4:	89 f0                	mov    %esi,%eax
+  8034e6:	e8 da fb ff ff       	call   8030c5 <stream_fill>
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	74 dc                	je     8034cb <fread+0xa7>
+			m = 0;
+  8034ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034f4:	eb 93                	jmp    803489 <fread+0x65>
+
+008034f6 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8034f6:	55                   	push   %ebp
+  8034f7:	89 e5                	mov    %esp,%ebp
+  8034f9:	57                   	push   %edi
+  8034fa:	56                   	push   %esi
+  8034fb:	53                   	push   %ebx
+  8034fc:	83 ec 1c             	sub    $0x1c,%esp
+  8034ff:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  803502:	8b 43 04             	mov    0x4(%ebx),%eax
+  803505:	a8 02                	test   $0x2,%al
+  803507:	75 13                	jne    80351c <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  803509:	83 c8 08             	or     $0x8,%eax
+  80350c:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  80350f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  803514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803517:	5b                   	pop    %ebx
+  803518:	5e                   	pop    %esi
+  803519:	5f                   	pop    %edi
+  80351a:	5d                   	pop    %ebp
+  80351b:	c3                   	ret
+	stream_setup(f);
+  80351c:	89 d8                	mov    %ebx,%eax
+  80351e:	e8 35 fb ff ff       	call   803058 <stream_setup>
+	want = size * n;
+  803523:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803526:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80352a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80352d:	89 d8                	mov    %ebx,%eax
+  80352f:	e8 41 fa ff ff       	call   802f75 <stream_unread>
+	for (done = 0; done < want; ) {
+  803534:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  803539:	84 c0                	test   %al,%al
+  80353b:	75 7b                	jne    8035b8 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80353d:	be 00 00 00 00       	mov    $0x0,%esi
+  803542:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803545:	39 fe                	cmp    %edi,%esi
+  803547:	73 24                	jae    80356d <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  803549:	83 ec 04             	sub    $0x4,%esp
+  80354c:	89 f8                	mov    %edi,%eax
+  80354e:	29 f0                	sub    %esi,%eax
+  803550:	50                   	push   %eax
+  803551:	89 f0                	mov    %esi,%eax
+  803553:	03 45 08             	add    0x8(%ebp),%eax
+  803556:	50                   	push   %eax
+  803557:	ff 33                	push   (%ebx)
+  803559:	e8 a0 ef ff ff       	call   8024fe <write>
+  80355e:	83 c4 10             	add    $0x10,%esp
+  803561:	85 c0                	test   %eax,%eax
+  803563:	7e 04                	jle    803569 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  803565:	01 c6                	add    %eax,%esi
+  803567:	eb dc                	jmp    803545 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  803569:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  80356d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803570:	85 c0                	test   %eax,%eax
+  803572:	74 a0                	je     803514 <fwrite+0x1e>
+  803574:	89 f0                	mov    %esi,%eax
+  803576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357b:	f7 75 0c             	divl   0xc(%ebp)
+  80357e:	eb 94                	jmp    803514 <fwrite+0x1e>
+			done += r;
+  803580:	01 c7                	add    %eax,%edi
+			continue;
+  803582:	eb 34                	jmp    8035b8 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  803584:	8b 73 10             	mov    0x10(%ebx),%esi
+  803587:	29 c6                	sub    %eax,%esi
+  803589:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80358c:	29 fa                	sub    %edi,%edx
+  80358e:	39 d6                	cmp    %edx,%esi
+  803590:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  803593:	83 ec 04             	sub    $0x4,%esp
+  803596:	56                   	push   %esi
+  803597:	89 fa                	mov    %edi,%edx
+  803599:	03 55 08             	add    0x8(%ebp),%edx
+  80359c:	52                   	push   %edx
+  80359d:	03 43 0c             	add    0xc(%ebx),%eax
+  8035a0:	50                   	push   %eax
+  8035a1:	e8 f8 db ff ff       	call   80119e <memmove>
+		f->f_wend += m;
+  8035a6:	89 f0                	mov    %esi,%eax
+  8035a8:	03 43 1c             	add    0x1c(%ebx),%eax
+  8035ab:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8035ae:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8035b0:	83 c4 10             	add    $0x10,%esp
+  8035b3:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8035b6:	74 5b                	je     803613 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8035b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035bb:	39 c7                	cmp    %eax,%edi
+  8035bd:	73 2d                	jae    8035ec <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8035bf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8035c2:	85 c0                	test   %eax,%eax
+  8035c4:	75 be                	jne    803584 <fwrite+0x8e>
+  8035c6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8035c9:	29 fa                	sub    %edi,%edx
+  8035cb:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8035ce:	72 b4                	jb     803584 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8035d0:	83 ec 04             	sub    $0x4,%esp
+  8035d3:	52                   	push   %edx
+  8035d4:	89 f8                	mov    %edi,%eax
+  8035d6:	03 45 08             	add    0x8(%ebp),%eax
+  8035d9:	50                   	push   %eax
+  8035da:	ff 33                	push   (%ebx)
+  8035dc:	e8 1d ef ff ff       	call   8024fe <write>
+  8035e1:	83 c4 10             	add    $0x10,%esp
+  8035e4:	85 c0                	test   %eax,%eax
+  8035e6:	7f 98                	jg     803580 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8035e8:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8035ec:	8b 43 08             	mov    0x8(%ebx),%eax
+  8035ef:	83 f8 03             	cmp    $0x3,%eax
+  8035f2:	74 48                	je     80363c <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8035f4:	83 f8 02             	cmp    $0x2,%eax
+  8035f7:	74 27                	je     803620 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8035f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035fc:	85 c0                	test   %eax,%eax
+  8035fe:	0f 84 10 ff ff ff    	je     803514 <fwrite+0x1e>
+  803604:	89 f8                	mov    %edi,%eax
+  803606:	ba 00 00 00 00       	mov    $0x0,%edx
+  80360b:	f7 75 0c             	divl   0xc(%ebp)
+  80360e:	e9 01 ff ff ff       	jmp    803514 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803613:	89 d8                	mov    %ebx,%eax
+  803615:	e8 ce f9 ff ff       	call   802fe8 <stream_drain>
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	79 9a                	jns    8035b8 <fwrite+0xc2>
+  80361e:	eb cc                	jmp    8035ec <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803620:	83 ec 04             	sub    $0x4,%esp
+  803623:	57                   	push   %edi
+  803624:	6a 0a                	push   $0xa
+  803626:	ff 75 08             	push   0x8(%ebp)
+  803629:	e8 21 dc ff ff       	call   80124f <memfind>
+  80362e:	89 c2                	mov    %eax,%edx
+  803630:	89 f8                	mov    %edi,%eax
+  803632:	03 45 08             	add    0x8(%ebp),%eax
+  803635:	83 c4 10             	add    $0x10,%esp
+  803638:	39 c2                	cmp    %eax,%edx
+  80363a:	74 bd                	je     8035f9 <fwrite+0x103>
+		stream_drain(f);
+  80363c:	89 d8                	mov    %ebx,%eax
+  80363e:	e8 a5 f9 ff ff       	call   802fe8 <stream_drain>
+  803643:	eb b4                	jmp    8035f9 <fwrite+0x103>
+
+00803645 <fputc>:
+{
+  803645:	55                   	push   %ebp
+  803646:	89 e5                	mov    %esp,%ebp
+  803648:	53                   	push   %ebx
+  803649:	83 ec 14             	sub    $0x14,%esp
+  80364c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  80364f:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  803652:	ff 75 0c             	push   0xc(%ebp)
+  803655:	6a 01                	push   $0x1
+  803657:	6a 01                	push   $0x1
+  803659:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80365c:	50                   	push   %eax
+  80365d:	e8 94 fe ff ff       	call   8034f6 <fwrite>
+  803662:	83 c4 10             	add    $0x10,%esp
+  803665:	0f b6 db             	movzbl %bl,%ebx
+  803668:	83 f8 01             	cmp    $0x1,%eax
+  80366b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803670:	0f 44 c3             	cmove  %ebx,%eax
+}
+  803673:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803676:	c9                   	leave
+  803677:	c3                   	ret
+
+00803678 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  803678:	55                   	push   %ebp
+  803679:	89 e5                	mov    %esp,%ebp
+  80367b:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80367e:	ff 75 0c             	push   0xc(%ebp)
+  803681:	ff 75 08             	push   0x8(%ebp)
+  803684:	e8 bc ff ff ff       	call   803645 <fputc>
+}
+  803689:	83 c4 10             	add    $0x10,%esp
+  80368c:	c9                   	leave
+  80368d:	c3                   	ret
+
+0080368e <fputs>:
+{
+  80368e:	55                   	push   %ebp
+  80368f:	89 e5                	mov    %esp,%ebp
+  803691:	56                   	push   %esi
+  803692:	53                   	push   %ebx
+  803693:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  803696:	83 ec 0c             	sub    $0xc,%esp
+  803699:	56                   	push   %esi
+  80369a:	e8 3e d9 ff ff       	call   800fdd <strlen>
+  80369f:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8036a1:	ff 75 0c             	push   0xc(%ebp)
+  8036a4:	50                   	push   %eax
+  8036a5:	6a 01                	push   $0x1
+  8036a7:	56                   	push   %esi
+  8036a8:	e8 49 fe ff ff       	call   8034f6 <fwrite>
+  8036ad:	83 c4 20             	add    $0x20,%esp
+  8036b0:	39 d8                	cmp    %ebx,%eax
+  8036b2:	0f 95 c0             	setne  %al
+  8036b5:	0f b6 c0             	movzbl %al,%eax
+  8036b8:	f7 d8                	neg    %eax
+}
+  8036ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036bd:	5b                   	pop    %ebx
+  8036be:	5e                   	pop    %esi
+  8036bf:	5d                   	pop    %ebp
+  8036c0:	c3                   	ret
+
+008036c1 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8036c1:	55                   	push   %ebp
+  8036c2:	89 e5                	mov    %esp,%ebp
+  8036c4:	53                   	push   %ebx
+  8036c5:	83 ec 04             	sub    $0x4,%esp
+  8036c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8036cb:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8036ce:	50                   	push   %eax
+  8036cf:	ff 75 0c             	push   0xc(%ebp)
+  8036d2:	53                   	push   %ebx
+  8036d3:	68 78 36 80 00       	push   $0x803678
+  8036d8:	e8 4e d4 ff ff       	call   800b2b <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8036dd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8036e0:	c1 e0 1c             	shl    $0x1c,%eax
+  8036e3:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8036e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036e9:	c9                   	leave
+  8036ea:	c3                   	ret
+
+008036eb <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8036eb:	55                   	push   %ebp
+  8036ec:	89 e5                	mov    %esp,%ebp
+  8036ee:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8036f1:	68 84 57 80 00       	push   $0x805784
+  8036f6:	ff 75 0c             	push   0xc(%ebp)
+  8036f9:	e8 1a d9 ff ff       	call   801018 <strcpy>
+	return 0;
+}
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803703:	c9                   	leave
+  803704:	c3                   	ret
+
+00803705 <devsock_close>:
+{
+  803705:	55                   	push   %ebp
+  803706:	89 e5                	mov    %esp,%ebp
+  803708:	53                   	push   %ebx
+  803709:	83 ec 10             	sub    $0x10,%esp
+  80370c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80370f:	53                   	push   %ebx
+  803710:	e8 86 15 00 00       	call   804c9b <pageref>
+  803715:	89 c2                	mov    %eax,%edx
+  803717:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80371a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80371f:	83 fa 01             	cmp    $0x1,%edx
+  803722:	74 05                	je     803729 <devsock_close+0x24>
+}
+  803724:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803727:	c9                   	leave
+  803728:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803729:	83 ec 0c             	sub    $0xc,%esp
+  80372c:	ff 73 0c             	push   0xc(%ebx)
+  80372f:	e8 b7 02 00 00       	call   8039eb <nsipc_close>
+  803734:	83 c4 10             	add    $0x10,%esp
+  803737:	eb eb                	jmp    803724 <devsock_close+0x1f>
+
+00803739 <devsock_write>:
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80373f:	6a 00                	push   $0x0
+  803741:	ff 75 10             	push   0x10(%ebp)
+  803744:	ff 75 0c             	push   0xc(%ebp)
+  803747:	8b 45 08             	mov    0x8(%ebp),%eax
+  80374a:	ff 70 0c             	push   0xc(%eax)
+  80374d:	e8 79 03 00 00       	call   803acb <nsipc_send>
+}
+  803752:	c9                   	leave
+  803753:	c3                   	ret
+
+00803754 <devsock_read>:
+{
+  803754:	55                   	push   %ebp
+  803755:	89 e5                	mov    %esp,%ebp
+  803757:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80375a:	6a 00                	push   $0x0
+  80375c:	ff 75 10             	push   0x10(%ebp)
+  80375f:	ff 75 0c             	push   0xc(%ebp)
+  803762:	8b 45 08             	mov    0x8(%ebp),%eax
+  803765:	ff 70 0c             	push   0xc(%eax)
+  803768:	e8 ef 02 00 00       	call   803a5c <nsipc_recv>
+}
+  80376d:	c9                   	leave
+  80376e:	c3                   	ret
+
+0080376f <fd2sockid>:
+{
+  80376f:	55                   	push   %ebp
+  803770:	89 e5                	mov    %esp,%ebp
+  803772:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803775:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803778:	52                   	push   %edx
+  803779:	50                   	push   %eax
+  80377a:	e8 f7 e9 ff ff       	call   802176 <fd_lookup>
+  80377f:	83 c4 10             	add    $0x10,%esp
+  803782:	85 c0                	test   %eax,%eax
+  803784:	78 10                	js     803796 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803786:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803789:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  80378f:	39 08                	cmp    %ecx,(%eax)
+  803791:	75 05                	jne    803798 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803793:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803796:	c9                   	leave
+  803797:	c3                   	ret
+		return -E_NOT_SUPP;
+  803798:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80379d:	eb f7                	jmp    803796 <fd2sockid+0x27>
+
+0080379f <alloc_sockfd>:
+{
+  80379f:	55                   	push   %ebp
+  8037a0:	89 e5                	mov    %esp,%ebp
+  8037a2:	56                   	push   %esi
+  8037a3:	53                   	push   %ebx
+  8037a4:	83 ec 1c             	sub    $0x1c,%esp
+  8037a7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8037a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037ac:	50                   	push   %eax
+  8037ad:	e8 6e e9 ff ff       	call   802120 <fd_alloc>
+  8037b2:	89 c3                	mov    %eax,%ebx
+  8037b4:	83 c4 10             	add    $0x10,%esp
+  8037b7:	85 c0                	test   %eax,%eax
+  8037b9:	78 43                	js     8037fe <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8037bb:	83 ec 04             	sub    $0x4,%esp
+  8037be:	68 07 04 00 00       	push   $0x407
+  8037c3:	ff 75 f4             	push   -0xc(%ebp)
+  8037c6:	6a 00                	push   $0x0
+  8037c8:	e8 89 dc ff ff       	call   801456 <sys_page_alloc>
+  8037cd:	89 c3                	mov    %eax,%ebx
+  8037cf:	83 c4 10             	add    $0x10,%esp
+  8037d2:	85 c0                	test   %eax,%eax
+  8037d4:	78 28                	js     8037fe <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8037d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037d9:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8037df:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8037e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037e4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8037eb:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8037ee:	83 ec 0c             	sub    $0xc,%esp
+  8037f1:	50                   	push   %eax
+  8037f2:	e8 02 e9 ff ff       	call   8020f9 <fd2num>
+  8037f7:	89 c3                	mov    %eax,%ebx
+  8037f9:	83 c4 10             	add    $0x10,%esp
+  8037fc:	eb 0c                	jmp    80380a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8037fe:	83 ec 0c             	sub    $0xc,%esp
+  803801:	56                   	push   %esi
+  803802:	e8 e4 01 00 00       	call   8039eb <nsipc_close>
+		return r;
+  803807:	83 c4 10             	add    $0x10,%esp
+}
+  80380a:	89 d8                	mov    %ebx,%eax
+  80380c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80380f:	5b                   	pop    %ebx
+  803810:	5e                   	pop    %esi
+  803811:	5d                   	pop    %ebp
+  803812:	c3                   	ret
+
+00803813 <accept>:
+{
+  803813:	55                   	push   %ebp
+  803814:	89 e5                	mov    %esp,%ebp
+  803816:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80381c:	e8 4e ff ff ff       	call   80376f <fd2sockid>
+  803821:	85 c0                	test   %eax,%eax
+  803823:	78 1b                	js     803840 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803825:	83 ec 04             	sub    $0x4,%esp
+  803828:	ff 75 10             	push   0x10(%ebp)
+  80382b:	ff 75 0c             	push   0xc(%ebp)
+  80382e:	50                   	push   %eax
+  80382f:	e8 0e 01 00 00       	call   803942 <nsipc_accept>
+  803834:	83 c4 10             	add    $0x10,%esp
+  803837:	85 c0                	test   %eax,%eax
+  803839:	78 05                	js     803840 <accept+0x2d>
+	return alloc_sockfd(r);
+  80383b:	e8 5f ff ff ff       	call   80379f <alloc_sockfd>
+}
+  803840:	c9                   	leave
+  803841:	c3                   	ret
+
+00803842 <bind>:
+{
+  803842:	55                   	push   %ebp
+  803843:	89 e5                	mov    %esp,%ebp
+  803845:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803848:	8b 45 08             	mov    0x8(%ebp),%eax
+  80384b:	e8 1f ff ff ff       	call   80376f <fd2sockid>
+  803850:	85 c0                	test   %eax,%eax
+  803852:	78 12                	js     803866 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803854:	83 ec 04             	sub    $0x4,%esp
+  803857:	ff 75 10             	push   0x10(%ebp)
+  80385a:	ff 75 0c             	push   0xc(%ebp)
+  80385d:	50                   	push   %eax
+  80385e:	e8 31 01 00 00       	call   803994 <nsipc_bind>
+  803863:	83 c4 10             	add    $0x10,%esp
+}
+  803866:	c9                   	leave
+  803867:	c3                   	ret
+
+00803868 <shutdown>:
+{
+  803868:	55                   	push   %ebp
+  803869:	89 e5                	mov    %esp,%ebp
+  80386b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80386e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803871:	e8 f9 fe ff ff       	call   80376f <fd2sockid>
+  803876:	85 c0                	test   %eax,%eax
+  803878:	78 0f                	js     803889 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80387a:	83 ec 08             	sub    $0x8,%esp
+  80387d:	ff 75 0c             	push   0xc(%ebp)
+  803880:	50                   	push   %eax
+  803881:	e8 43 01 00 00       	call   8039c9 <nsipc_shutdown>
+  803886:	83 c4 10             	add    $0x10,%esp
+}
+  803889:	c9                   	leave
+  80388a:	c3                   	ret
+
+0080388b <connect>:
+{
+  80388b:	55                   	push   %ebp
+  80388c:	89 e5                	mov    %esp,%ebp
+  80388e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803891:	8b 45 08             	mov    0x8(%ebp),%eax
+  803894:	e8 d6 fe ff ff       	call   80376f <fd2sockid>
+  803899:	85 c0                	test   %eax,%eax
+  80389b:	78 12                	js     8038af <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80389d:	83 ec 04             	sub    $0x4,%esp
+  8038a0:	ff 75 10             	push   0x10(%ebp)
+  8038a3:	ff 75 0c             	push   0xc(%ebp)
+  8038a6:	50                   	push   %eax
+  8038a7:	e8 59 01 00 00       	call   803a05 <nsipc_connect>
+  8038ac:	83 c4 10             	add    $0x10,%esp
+}
+  8038af:	c9                   	leave
+  8038b0:	c3                   	ret
+
+008038b1 <listen>:
+{
+  8038b1:	55                   	push   %ebp
+  8038b2:	89 e5                	mov    %esp,%ebp
+  8038b4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8038b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ba:	e8 b0 fe ff ff       	call   80376f <fd2sockid>
+  8038bf:	85 c0                	test   %eax,%eax
+  8038c1:	78 0f                	js     8038d2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8038c3:	83 ec 08             	sub    $0x8,%esp
+  8038c6:	ff 75 0c             	push   0xc(%ebp)
+  8038c9:	50                   	push   %eax
+  8038ca:	e8 6b 01 00 00       	call   803a3a <nsipc_listen>
+  8038cf:	83 c4 10             	add    $0x10,%esp
+}
+  8038d2:	c9                   	leave
+  8038d3:	c3                   	ret
+
+008038d4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8038d4:	55                   	push   %ebp
+  8038d5:	89 e5                	mov    %esp,%ebp
+  8038d7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8038da:	ff 75 10             	push   0x10(%ebp)
+  8038dd:	ff 75 0c             	push   0xc(%ebp)
+  8038e0:	ff 75 08             	push   0x8(%ebp)
+  8038e3:	e8 41 02 00 00       	call   803b29 <nsipc_socket>
+  8038e8:	83 c4 10             	add    $0x10,%esp
+  8038eb:	85 c0                	test   %eax,%eax
+  8038ed:	78 05                	js     8038f4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8038ef:	e8 ab fe ff ff       	call   80379f <alloc_sockfd>
+}
+  8038f4:	c9                   	leave
+  8038f5:	c3                   	ret
+
+008038f6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8038f6:	55                   	push   %ebp
+  8038f7:	89 e5                	mov    %esp,%ebp
+  8038f9:	53                   	push   %ebx
+  8038fa:	83 ec 04             	sub    $0x4,%esp
+  8038fd:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8038ff:	83 3d 20 70 80 00 00 	cmpl   $0x0,0x807020
+  803906:	74 26                	je     80392e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803908:	6a 07                	push   $0x7
+  80390a:	68 00 90 80 00       	push   $0x809000
+  80390f:	53                   	push   %ebx
+  803910:	ff 35 20 70 80 00    	push   0x807020
+  803916:	e8 49 e7 ff ff       	call   802064 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80391b:	83 c4 0c             	add    $0xc,%esp
+  80391e:	6a 00                	push   $0x0
+  803920:	6a 00                	push   $0x0
+  803922:	6a 00                	push   $0x0
+  803924:	e8 45 e6 ff ff       	call   801f6e <ipc_recv>
+}
+  803929:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80392c:	c9                   	leave
+  80392d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80392e:	83 ec 0c             	sub    $0xc,%esp
+  803931:	6a 02                	push   $0x2
+  803933:	e8 82 e7 ff ff       	call   8020ba <ipc_find_env>
+  803938:	a3 20 70 80 00       	mov    %eax,0x807020
+  80393d:	83 c4 10             	add    $0x10,%esp
+  803940:	eb c6                	jmp    803908 <nsipc+0x12>
+
+00803942 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803942:	55                   	push   %ebp
+  803943:	89 e5                	mov    %esp,%ebp
+  803945:	56                   	push   %esi
+  803946:	53                   	push   %ebx
+  803947:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80394a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80394d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803952:	8b 06                	mov    (%esi),%eax
+  803954:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803959:	b8 01 00 00 00       	mov    $0x1,%eax
+  80395e:	e8 93 ff ff ff       	call   8038f6 <nsipc>
+  803963:	89 c3                	mov    %eax,%ebx
+  803965:	85 c0                	test   %eax,%eax
+  803967:	79 09                	jns    803972 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803969:	89 d8                	mov    %ebx,%eax
+  80396b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80396e:	5b                   	pop    %ebx
+  80396f:	5e                   	pop    %esi
+  803970:	5d                   	pop    %ebp
+  803971:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803972:	83 ec 04             	sub    $0x4,%esp
+  803975:	ff 35 10 90 80 00    	push   0x809010
+  80397b:	68 00 90 80 00       	push   $0x809000
+  803980:	ff 75 0c             	push   0xc(%ebp)
+  803983:	e8 16 d8 ff ff       	call   80119e <memmove>
+		*addrlen = ret->ret_addrlen;
+  803988:	a1 10 90 80 00       	mov    0x809010,%eax
+  80398d:	89 06                	mov    %eax,(%esi)
+  80398f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803992:	eb d5                	jmp    803969 <nsipc_accept+0x27>
+
+00803994 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803994:	55                   	push   %ebp
+  803995:	89 e5                	mov    %esp,%ebp
+  803997:	53                   	push   %ebx
+  803998:	83 ec 08             	sub    $0x8,%esp
+  80399b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80399e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039a1:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8039a6:	53                   	push   %ebx
+  8039a7:	ff 75 0c             	push   0xc(%ebp)
+  8039aa:	68 04 90 80 00       	push   $0x809004
+  8039af:	e8 ea d7 ff ff       	call   80119e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8039b4:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8039ba:	b8 02 00 00 00       	mov    $0x2,%eax
+  8039bf:	e8 32 ff ff ff       	call   8038f6 <nsipc>
+}
+  8039c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c7:	c9                   	leave
+  8039c8:	c3                   	ret
+
+008039c9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8039c9:	55                   	push   %ebp
+  8039ca:	89 e5                	mov    %esp,%ebp
+  8039cc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8039cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039d2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8039d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039da:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8039df:	b8 03 00 00 00       	mov    $0x3,%eax
+  8039e4:	e8 0d ff ff ff       	call   8038f6 <nsipc>
+}
+  8039e9:	c9                   	leave
+  8039ea:	c3                   	ret
+
+008039eb <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8039eb:	55                   	push   %ebp
+  8039ec:	89 e5                	mov    %esp,%ebp
+  8039ee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8039f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f4:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  8039f9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8039fe:	e8 f3 fe ff ff       	call   8038f6 <nsipc>
+}
+  803a03:	c9                   	leave
+  803a04:	c3                   	ret
+
+00803a05 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803a05:	55                   	push   %ebp
+  803a06:	89 e5                	mov    %esp,%ebp
+  803a08:	53                   	push   %ebx
+  803a09:	83 ec 08             	sub    $0x8,%esp
+  803a0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a12:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803a17:	53                   	push   %ebx
+  803a18:	ff 75 0c             	push   0xc(%ebp)
+  803a1b:	68 04 90 80 00       	push   $0x809004
+  803a20:	e8 79 d7 ff ff       	call   80119e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803a25:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803a2b:	b8 05 00 00 00       	mov    $0x5,%eax
+  803a30:	e8 c1 fe ff ff       	call   8038f6 <nsipc>
+}
+  803a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a38:	c9                   	leave
+  803a39:	c3                   	ret
+
+00803a3a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803a3a:	55                   	push   %ebp
+  803a3b:	89 e5                	mov    %esp,%ebp
+  803a3d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803a40:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a43:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803a48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a4b:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803a50:	b8 06 00 00 00       	mov    $0x6,%eax
+  803a55:	e8 9c fe ff ff       	call   8038f6 <nsipc>
+}
+  803a5a:	c9                   	leave
+  803a5b:	c3                   	ret
+
+00803a5c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803a5c:	55                   	push   %ebp
+  803a5d:	89 e5                	mov    %esp,%ebp
+  803a5f:	56                   	push   %esi
+  803a60:	53                   	push   %ebx
+  803a61:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a67:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803a6c:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803a72:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a75:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803a7a:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a7f:	e8 72 fe ff ff       	call   8038f6 <nsipc>
+  803a84:	89 c3                	mov    %eax,%ebx
+  803a86:	85 c0                	test   %eax,%eax
+  803a88:	78 22                	js     803aac <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803a8a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803a8f:	39 c6                	cmp    %eax,%esi
+  803a91:	0f 4e c6             	cmovle %esi,%eax
+  803a94:	39 c3                	cmp    %eax,%ebx
+  803a96:	7f 1d                	jg     803ab5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803a98:	83 ec 04             	sub    $0x4,%esp
+  803a9b:	53                   	push   %ebx
+  803a9c:	68 00 90 80 00       	push   $0x809000
+  803aa1:	ff 75 0c             	push   0xc(%ebp)
+  803aa4:	e8 f5 d6 ff ff       	call   80119e <memmove>
+  803aa9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803aac:	89 d8                	mov    %ebx,%eax
+  803aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ab1:	5b                   	pop    %ebx
+  803ab2:	5e                   	pop    %esi
+  803ab3:	5d                   	pop    %ebp
+  803ab4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803ab5:	68 90 57 80 00       	push   $0x805790
+  803aba:	68 8f 50 80 00       	push   $0x80508f
+  803abf:	6a 62                	push   $0x62
+  803ac1:	68 a5 57 80 00       	push   $0x8057a5
+  803ac6:	e8 8e ce ff ff       	call   800959 <_panic>
+
+00803acb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803acb:	55                   	push   %ebp
+  803acc:	89 e5                	mov    %esp,%ebp
+  803ace:	53                   	push   %ebx
+  803acf:	83 ec 04             	sub    $0x4,%esp
+  803ad2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ad8:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803add:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803ae3:	7f 2e                	jg     803b13 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803ae5:	83 ec 04             	sub    $0x4,%esp
+  803ae8:	53                   	push   %ebx
+  803ae9:	ff 75 0c             	push   0xc(%ebp)
+  803aec:	68 0c 90 80 00       	push   $0x80900c
+  803af1:	e8 a8 d6 ff ff       	call   80119e <memmove>
+	nsipcbuf.send.req_size = size;
+  803af6:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803afc:	8b 45 14             	mov    0x14(%ebp),%eax
+  803aff:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803b04:	b8 08 00 00 00       	mov    $0x8,%eax
+  803b09:	e8 e8 fd ff ff       	call   8038f6 <nsipc>
+}
+  803b0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b11:	c9                   	leave
+  803b12:	c3                   	ret
+	assert(size < 1600);
+  803b13:	68 b1 57 80 00       	push   $0x8057b1
+  803b18:	68 8f 50 80 00       	push   $0x80508f
+  803b1d:	6a 6d                	push   $0x6d
+  803b1f:	68 a5 57 80 00       	push   $0x8057a5
+  803b24:	e8 30 ce ff ff       	call   800959 <_panic>
+
+00803b29 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803b29:	55                   	push   %ebp
+  803b2a:	89 e5                	mov    %esp,%ebp
+  803b2c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b32:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803b37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b3a:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803b3f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803b42:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803b47:	b8 09 00 00 00       	mov    $0x9,%eax
+  803b4c:	e8 a5 fd ff ff       	call   8038f6 <nsipc>
+}
+  803b51:	c9                   	leave
+  803b52:	c3                   	ret
+
+00803b53 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803b53:	55                   	push   %ebp
+  803b54:	89 e5                	mov    %esp,%ebp
+  803b56:	53                   	push   %ebx
+  803b57:	83 ec 10             	sub    $0x10,%esp
+  803b5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803b5d:	68 24 70 80 00       	push   $0x807024
+  803b62:	e8 50 07 00 00       	call   8042b7 <mutex_lock>
+	if (v == 0)
+  803b67:	83 c4 10             	add    $0x10,%esp
+  803b6a:	85 db                	test   %ebx,%ebx
+  803b6c:	0f 84 85 00 00 00    	je     803bf7 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803b72:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803b78:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803b7d:	77 51                	ja     803bd0 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803b7f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803b85:	89 d8                	mov    %ebx,%eax
+  803b87:	c1 e8 0c             	shr    $0xc,%eax
+  803b8a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b91:	f6 c4 02             	test   $0x2,%ah
+  803b94:	74 50                	je     803be6 <free+0x93>
+		sys_page_unmap(0, c);
+  803b96:	83 ec 08             	sub    $0x8,%esp
+  803b99:	53                   	push   %ebx
+  803b9a:	6a 00                	push   $0x0
+  803b9c:	e8 4e d9 ff ff       	call   8014ef <sys_page_unmap>
+		c += PGSIZE;
+  803ba1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803ba7:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803bad:	83 c4 10             	add    $0x10,%esp
+  803bb0:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803bb5:	76 ce                	jbe    803b85 <free+0x32>
+  803bb7:	68 fb 57 80 00       	push   $0x8057fb
+  803bbc:	68 8f 50 80 00       	push   $0x80508f
+  803bc1:	68 82 00 00 00       	push   $0x82
+  803bc6:	68 ee 57 80 00       	push   $0x8057ee
+  803bcb:	e8 89 cd ff ff       	call   800959 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803bd0:	68 c0 57 80 00       	push   $0x8057c0
+  803bd5:	68 8f 50 80 00       	push   $0x80508f
+  803bda:	6a 7b                	push   $0x7b
+  803bdc:	68 ee 57 80 00       	push   $0x8057ee
+  803be1:	e8 73 cd ff ff       	call   800959 <_panic>
+	if (--(*ref) == 0)
+  803be6:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803bec:	83 e8 01             	sub    $0x1,%eax
+  803bef:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803bf5:	74 15                	je     803c0c <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803bf7:	83 ec 0c             	sub    $0xc,%esp
+  803bfa:	68 24 70 80 00       	push   $0x807024
+  803bff:	e8 20 07 00 00       	call   804324 <mutex_unlock>
+}
+  803c04:	83 c4 10             	add    $0x10,%esp
+  803c07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c0a:	c9                   	leave
+  803c0b:	c3                   	ret
+		sys_page_unmap(0, c);
+  803c0c:	83 ec 08             	sub    $0x8,%esp
+  803c0f:	53                   	push   %ebx
+  803c10:	6a 00                	push   $0x0
+  803c12:	e8 d8 d8 ff ff       	call   8014ef <sys_page_unmap>
+  803c17:	83 c4 10             	add    $0x10,%esp
+  803c1a:	eb db                	jmp    803bf7 <free+0xa4>
+
+00803c1c <malloc>:
+{
+  803c1c:	55                   	push   %ebp
+  803c1d:	89 e5                	mov    %esp,%ebp
+  803c1f:	57                   	push   %edi
+  803c20:	56                   	push   %esi
+  803c21:	53                   	push   %ebx
+  803c22:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803c25:	68 24 70 80 00       	push   $0x807024
+  803c2a:	e8 88 06 00 00       	call   8042b7 <mutex_lock>
+	if (mptr == 0)
+  803c2f:	8b 3d 28 70 80 00    	mov    0x807028,%edi
+  803c35:	83 c4 10             	add    $0x10,%esp
+  803c38:	85 ff                	test   %edi,%edi
+  803c3a:	74 6c                	je     803ca8 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c3f:	83 c0 03             	add    $0x3,%eax
+  803c42:	83 e0 fc             	and    $0xfffffffc,%eax
+  803c45:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803c47:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803c4c:	0f 87 64 01 00 00    	ja     803db6 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803c52:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803c58:	74 30                	je     803c8a <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803c5a:	89 f9                	mov    %edi,%ecx
+  803c5c:	c1 e9 0c             	shr    $0xc,%ecx
+  803c5f:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803c63:	c1 e8 0c             	shr    $0xc,%eax
+  803c66:	39 c1                	cmp    %eax,%ecx
+  803c68:	74 5f                	je     803cc9 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803c6a:	83 ec 0c             	sub    $0xc,%esp
+  803c6d:	57                   	push   %edi
+  803c6e:	e8 e0 fe ff ff       	call   803b53 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803c73:	a1 28 70 80 00       	mov    0x807028,%eax
+  803c78:	05 00 10 00 00       	add    $0x1000,%eax
+  803c7d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803c82:	a3 28 70 80 00       	mov    %eax,0x807028
+  803c87:	83 c4 10             	add    $0x10,%esp
+  803c8a:	8b 0d 28 70 80 00    	mov    0x807028,%ecx
+{
+  803c90:	ba 02 00 00 00       	mov    $0x2,%edx
+  803c95:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803c99:	8d 7e 04             	lea    0x4(%esi),%edi
+  803c9c:	89 cb                	mov    %ecx,%ebx
+  803c9e:	01 f9                	add    %edi,%ecx
+  803ca0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803ca3:	e9 8b 00 00 00       	jmp    803d33 <malloc+0x117>
+		mptr = mbegin;
+  803ca8:	c7 05 28 70 80 00 00 	movl   $0x8000000,0x807028
+  803caf:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cb5:	83 c0 03             	add    $0x3,%eax
+  803cb8:	83 e0 fc             	and    $0xfffffffc,%eax
+  803cbb:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803cbd:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803cc2:	76 c6                	jbe    803c8a <malloc+0x6e>
+  803cc4:	e9 d6 00 00 00       	jmp    803d9f <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803cc9:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803ccf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803cd4:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803cd8:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803cdb:	a3 28 70 80 00       	mov    %eax,0x807028
+			return v;
+  803ce0:	e9 ba 00 00 00       	jmp    803d9f <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803ce5:	05 00 10 00 00       	add    $0x1000,%eax
+  803cea:	39 c8                	cmp    %ecx,%eax
+  803cec:	0f 83 cb 00 00 00    	jae    803dbd <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803cf2:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803cf7:	77 22                	ja     803d1b <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803cf9:	89 c2                	mov    %eax,%edx
+  803cfb:	c1 ea 16             	shr    $0x16,%edx
+  803cfe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803d05:	f6 c2 01             	test   $0x1,%dl
+  803d08:	74 db                	je     803ce5 <malloc+0xc9>
+  803d0a:	89 c2                	mov    %eax,%edx
+  803d0c:	c1 ea 0c             	shr    $0xc,%edx
+  803d0f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803d16:	f6 c2 01             	test   $0x1,%dl
+  803d19:	74 ca                	je     803ce5 <malloc+0xc9>
+		if (mptr == mend) {
+  803d1b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803d21:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803d27:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803d2b:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803d31:	74 04                	je     803d37 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803d33:	89 d8                	mov    %ebx,%eax
+  803d35:	eb b3                	jmp    803cea <malloc+0xce>
+  803d37:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803d3a:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803d3f:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803d43:	83 ea 01             	sub    $0x1,%edx
+  803d46:	0f 85 50 ff ff ff    	jne    803c9c <malloc+0x80>
+  803d4c:	c7 05 28 70 80 00 00 	movl   $0x8000000,0x807028
+  803d53:	00 00 08 
+				return 0;	/* out of address space */
+  803d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5b:	eb 42                	jmp    803d9f <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803d5d:	85 db                	test   %ebx,%ebx
+  803d5f:	78 1e                	js     803d7f <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803d61:	83 ec 08             	sub    $0x8,%esp
+  803d64:	89 d8                	mov    %ebx,%eax
+  803d66:	03 05 28 70 80 00    	add    0x807028,%eax
+  803d6c:	50                   	push   %eax
+  803d6d:	6a 00                	push   $0x0
+  803d6f:	e8 7b d7 ff ff       	call   8014ef <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803d74:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803d7a:	83 c4 10             	add    $0x10,%esp
+  803d7d:	eb de                	jmp    803d5d <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d84:	eb 19                	jmp    803d9f <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803d86:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803d89:	8b 3d 28 70 80 00    	mov    0x807028,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803d8f:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803d96:	00 
+	mptr += n;
+  803d97:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803d9a:	a3 28 70 80 00       	mov    %eax,0x807028
+	mutex_unlock(&malloc_mu);
+  803d9f:	83 ec 0c             	sub    $0xc,%esp
+  803da2:	68 24 70 80 00       	push   $0x807024
+  803da7:	e8 78 05 00 00       	call   804324 <mutex_unlock>
+}
+  803dac:	89 f8                	mov    %edi,%eax
+  803dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803db1:	5b                   	pop    %ebx
+  803db2:	5e                   	pop    %esi
+  803db3:	5f                   	pop    %edi
+  803db4:	5d                   	pop    %ebp
+  803db5:	c3                   	ret
+		return 0;
+  803db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbb:	eb e2                	jmp    803d9f <malloc+0x183>
+  803dbd:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803dc1:	74 06                	je     803dc9 <malloc+0x1ad>
+  803dc3:	89 1d 28 70 80 00    	mov    %ebx,0x807028
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803dc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dce:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803dd1:	39 fb                	cmp    %edi,%ebx
+  803dd3:	73 b1                	jae    803d86 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803dd5:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803ddb:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803dde:	39 fe                	cmp    %edi,%esi
+  803de0:	0f 92 c0             	setb   %al
+  803de3:	0f b6 c0             	movzbl %al,%eax
+  803de6:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803de9:	83 c8 07             	or     $0x7,%eax
+  803dec:	50                   	push   %eax
+  803ded:	89 d8                	mov    %ebx,%eax
+  803def:	03 05 28 70 80 00    	add    0x807028,%eax
+  803df5:	50                   	push   %eax
+  803df6:	6a 00                	push   $0x0
+  803df8:	e8 59 d6 ff ff       	call   801456 <sys_page_alloc>
+  803dfd:	83 c4 10             	add    $0x10,%esp
+  803e00:	85 c0                	test   %eax,%eax
+  803e02:	0f 88 55 ff ff ff    	js     803d5d <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803e08:	89 f3                	mov    %esi,%ebx
+  803e0a:	eb c5                	jmp    803dd1 <malloc+0x1b5>
+
+00803e0c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803e0c:	55                   	push   %ebp
+  803e0d:	89 e5                	mov    %esp,%ebp
+  803e0f:	56                   	push   %esi
+  803e10:	53                   	push   %ebx
+  803e11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803e14:	83 ec 0c             	sub    $0xc,%esp
+  803e17:	ff 75 08             	push   0x8(%ebp)
+  803e1a:	e8 ea e2 ff ff       	call   802109 <fd2data>
+  803e1f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803e21:	83 c4 08             	add    $0x8,%esp
+  803e24:	68 13 58 80 00       	push   $0x805813
+  803e29:	53                   	push   %ebx
+  803e2a:	e8 e9 d1 ff ff       	call   801018 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803e2f:	8b 46 04             	mov    0x4(%esi),%eax
+  803e32:	2b 06                	sub    (%esi),%eax
+  803e34:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803e3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803e41:	00 00 00 
+	stat->st_dev = &devpipe;
+  803e44:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803e4b:	62 80 00 
+	return 0;
+}
+  803e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e56:	5b                   	pop    %ebx
+  803e57:	5e                   	pop    %esi
+  803e58:	5d                   	pop    %ebp
+  803e59:	c3                   	ret
+
+00803e5a <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803e5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e5f:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803e63:	85 c9                	test   %ecx,%ecx
+  803e65:	75 01                	jne    803e68 <pipewake+0xe>
+  803e67:	c3                   	ret
+{
+  803e68:	55                   	push   %ebp
+  803e69:	89 e5                	mov    %esp,%ebp
+  803e6b:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803e6e:	68 00 04 00 00       	push   $0x400
+  803e73:	52                   	push   %edx
+  803e74:	e8 21 d9 ff ff       	call   80179a <sys_futex_wake>
+  803e79:	83 c4 10             	add    $0x10,%esp
+}
+  803e7c:	c9                   	leave
+  803e7d:	c3                   	ret
+
+00803e7e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803e7e:	55                   	push   %ebp
+  803e7f:	89 e5                	mov    %esp,%ebp
+  803e81:	56                   	push   %esi
+  803e82:	53                   	push   %ebx
+  803e83:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803e86:	83 ec 0c             	sub    $0xc,%esp
+  803e89:	56                   	push   %esi
+  803e8a:	e8 7a e2 ff ff       	call   802109 <fd2data>
+  803e8f:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803e91:	83 c4 08             	add    $0x8,%esp
+  803e94:	56                   	push   %esi
+  803e95:	6a 00                	push   $0x0
+  803e97:	e8 53 d6 ff ff       	call   8014ef <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803e9c:	8d 53 04             	lea    0x4(%ebx),%edx
+  803e9f:	8d 43 08             	lea    0x8(%ebx),%eax
+  803ea2:	e8 b3 ff ff ff       	call   803e5a <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803ea7:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803eaa:	89 da                	mov    %ebx,%edx
+  803eac:	e8 a9 ff ff ff       	call   803e5a <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803eb1:	89 34 24             	mov    %esi,(%esp)
+  803eb4:	e8 50 e2 ff ff       	call   802109 <fd2data>
+  803eb9:	83 c4 08             	add    $0x8,%esp
+  803ebc:	50                   	push   %eax
+  803ebd:	6a 00                	push   $0x0
+  803ebf:	e8 2b d6 ff ff       	call   8014ef <sys_page_unmap>
+}
+  803ec4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ec7:	5b                   	pop    %ebx
+  803ec8:	5e                   	pop    %esi
+  803ec9:	5d                   	pop    %ebp
+  803eca:	c3                   	ret
+
+00803ecb <_pipeisclosed>:
+{
+  803ecb:	55                   	push   %ebp
+  803ecc:	89 e5                	mov    %esp,%ebp
+  803ece:	57                   	push   %edi
+  803ecf:	56                   	push   %esi
+  803ed0:	53                   	push   %ebx
+  803ed1:	83 ec 1c             	sub    $0x1c,%esp
+  803ed4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803ed7:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ed9:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803ede:	eb 5d                	jmp    803f3d <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803ee0:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		n = thisenv->env_runs;
+  803ee6:	8b 02                	mov    (%edx),%eax
+  803ee8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803eeb:	83 ec 0c             	sub    $0xc,%esp
+  803eee:	ff 75 e0             	push   -0x20(%ebp)
+  803ef1:	e8 a5 0d 00 00       	call   804c9b <pageref>
+  803ef6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803ef9:	89 3c 24             	mov    %edi,(%esp)
+  803efc:	e8 9a 0d 00 00       	call   804c9b <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803f01:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f03:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f09:	83 c4 10             	add    $0x10,%esp
+  803f0c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f12:	77 15                	ja     803f29 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f14:	89 f2                	mov    %esi,%edx
+  803f16:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f18:	c1 ea 10             	shr    $0x10,%edx
+  803f1b:	74 0c                	je     803f29 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f1d:	c1 e2 10             	shl    $0x10,%edx
+  803f20:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803f25:	29 d1                	sub    %edx,%ecx
+  803f27:	eb 06                	jmp    803f2f <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803f29:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		nn = thisenv->env_runs;
+  803f2f:	8b 11                	mov    (%ecx),%edx
+  803f31:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803f34:	39 d3                	cmp    %edx,%ebx
+  803f36:	74 6e                	je     803fa6 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803f38:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803f3b:	74 24                	je     803f61 <_pipeisclosed+0x96>
+  803f3d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f3f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f45:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f4a:	77 94                	ja     803ee0 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f4c:	89 f0                	mov    %esi,%eax
+  803f4e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803f50:	c1 e8 10             	shr    $0x10,%eax
+  803f53:	74 8b                	je     803ee0 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f55:	c1 e0 10             	shl    $0x10,%eax
+  803f58:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f5d:	29 c2                	sub    %eax,%edx
+  803f5f:	eb 85                	jmp    803ee6 <_pipeisclosed+0x1b>
+  803f61:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f63:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f69:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f6e:	77 18                	ja     803f88 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f70:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f75:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803f77:	c1 e8 10             	shr    $0x10,%eax
+  803f7a:	74 0c                	je     803f88 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f7c:	c1 e0 10             	shl    $0x10,%eax
+  803f7f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f84:	29 c2                	sub    %eax,%edx
+  803f86:	eb 06                	jmp    803f8e <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803f88:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803f8e:	8b 02                	mov    (%edx),%eax
+  803f90:	8b 40 58             	mov    0x58(%eax),%eax
+  803f93:	6a 01                	push   $0x1
+  803f95:	50                   	push   %eax
+  803f96:	53                   	push   %ebx
+  803f97:	68 1a 58 80 00       	push   $0x80581a
+  803f9c:	e8 93 ca ff ff       	call   800a34 <cprintf>
+  803fa1:	83 c4 10             	add    $0x10,%esp
+  803fa4:	eb 97                	jmp    803f3d <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803fa6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803fa9:	0f 94 c0             	sete   %al
+  803fac:	0f b6 c0             	movzbl %al,%eax
+}
+  803faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fb2:	5b                   	pop    %ebx
+  803fb3:	5e                   	pop    %esi
+  803fb4:	5f                   	pop    %edi
+  803fb5:	5d                   	pop    %ebp
+  803fb6:	c3                   	ret
+
+00803fb7 <devpipe_write>:
+{
+  803fb7:	55                   	push   %ebp
+  803fb8:	89 e5                	mov    %esp,%ebp
+  803fba:	57                   	push   %edi
+  803fbb:	56                   	push   %esi
+  803fbc:	53                   	push   %ebx
+  803fbd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803fc0:	ff 75 08             	push   0x8(%ebp)
+  803fc3:	e8 41 e1 ff ff       	call   802109 <fd2data>
+  803fc8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803fca:	83 c4 10             	add    $0x10,%esp
+  803fcd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803fd4:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803fd7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fda:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803fdd:	0f 84 96 00 00 00    	je     804079 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803fe3:	8d 73 08             	lea    0x8(%ebx),%esi
+  803fe6:	eb 32                	jmp    80401a <devpipe_write+0x63>
+  803fe8:	89 fa                	mov    %edi,%edx
+  803fea:	89 f0                	mov    %esi,%eax
+  803fec:	e8 69 fe ff ff       	call   803e5a <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803ff1:	8b 43 04             	mov    0x4(%ebx),%eax
+  803ff4:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803ff7:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ffc:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  804001:	83 ec 04             	sub    $0x4,%esp
+  804004:	6a 0a                	push   $0xa
+  804006:	50                   	push   %eax
+  804007:	53                   	push   %ebx
+  804008:	e8 5e d7 ff ff       	call   80176b <sys_futex_wait>
+  80400d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804012:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  804017:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80401a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80401d:	8b 0b                	mov    (%ebx),%ecx
+  80401f:	8d 51 20             	lea    0x20(%ecx),%edx
+  804022:	39 d0                	cmp    %edx,%eax
+  804024:	72 1b                	jb     804041 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  804026:	89 da                	mov    %ebx,%edx
+  804028:	8b 45 08             	mov    0x8(%ebp),%eax
+  80402b:	e8 9b fe ff ff       	call   803ecb <_pipeisclosed>
+  804030:	85 c0                	test   %eax,%eax
+  804032:	74 b4                	je     803fe8 <devpipe_write+0x31>
+				return 0;
+  804034:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80403c:	5b                   	pop    %ebx
+  80403d:	5e                   	pop    %esi
+  80403e:	5f                   	pop    %edi
+  80403f:	5d                   	pop    %ebp
+  804040:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804041:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804044:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804047:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80404b:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80404e:	89 c2                	mov    %eax,%edx
+  804050:	c1 fa 1f             	sar    $0x1f,%edx
+  804053:	89 d1                	mov    %edx,%ecx
+  804055:	c1 e9 1b             	shr    $0x1b,%ecx
+  804058:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80405b:	83 e2 1f             	and    $0x1f,%edx
+  80405e:	29 ca                	sub    %ecx,%edx
+  804060:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  804064:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  804068:	83 c0 01             	add    $0x1,%eax
+  80406b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80406e:	83 c6 01             	add    $0x1,%esi
+  804071:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804074:	e9 5e ff ff ff       	jmp    803fd7 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  804079:	8d 53 04             	lea    0x4(%ebx),%edx
+  80407c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80407f:	e8 d6 fd ff ff       	call   803e5a <pipewake>
+	return i;
+  804084:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804087:	eb b0                	jmp    804039 <devpipe_write+0x82>
+
+00804089 <devpipe_read>:
+{
+  804089:	55                   	push   %ebp
+  80408a:	89 e5                	mov    %esp,%ebp
+  80408c:	57                   	push   %edi
+  80408d:	56                   	push   %esi
+  80408e:	53                   	push   %ebx
+  80408f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  804092:	ff 75 08             	push   0x8(%ebp)
+  804095:	e8 6f e0 ff ff       	call   802109 <fd2data>
+  80409a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80409c:	83 c4 10             	add    $0x10,%esp
+  80409f:	be 00 00 00 00       	mov    $0x0,%esi
+  8040a4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8040a7:	74 6c                	je     804115 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8040a9:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8040ac:	eb 25                	jmp    8040d3 <devpipe_read+0x4a>
+  8040ae:	8b 13                	mov    (%ebx),%edx
+  8040b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040b5:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8040ba:	83 ec 04             	sub    $0x4,%esp
+  8040bd:	6a 0a                	push   $0xa
+  8040bf:	52                   	push   %edx
+  8040c0:	57                   	push   %edi
+  8040c1:	e8 a5 d6 ff ff       	call   80176b <sys_futex_wait>
+  8040c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8040cb:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8040d0:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8040d3:	8b 03                	mov    (%ebx),%eax
+  8040d5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8040d8:	75 19                	jne    8040f3 <devpipe_read+0x6a>
+			if (i > 0)
+  8040da:	85 f6                	test   %esi,%esi
+  8040dc:	75 3a                	jne    804118 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8040de:	89 da                	mov    %ebx,%edx
+  8040e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040e3:	e8 e3 fd ff ff       	call   803ecb <_pipeisclosed>
+  8040e8:	85 c0                	test   %eax,%eax
+  8040ea:	74 c2                	je     8040ae <devpipe_read+0x25>
+				return 0;
+  8040ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f1:	eb 31                	jmp    804124 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8040f3:	89 c1                	mov    %eax,%ecx
+  8040f5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8040f8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8040fb:	01 c8                	add    %ecx,%eax
+  8040fd:	83 e0 1f             	and    $0x1f,%eax
+  804100:	29 c8                	sub    %ecx,%eax
+  804102:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  804107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80410a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80410d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  804110:	83 c6 01             	add    $0x1,%esi
+  804113:	eb 8f                	jmp    8040a4 <devpipe_read+0x1b>
+out:
+  804115:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  804118:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80411b:	89 da                	mov    %ebx,%edx
+  80411d:	e8 38 fd ff ff       	call   803e5a <pipewake>
+	return i;
+  804122:	89 f0                	mov    %esi,%eax
+}
+  804124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804127:	5b                   	pop    %ebx
+  804128:	5e                   	pop    %esi
+  804129:	5f                   	pop    %edi
+  80412a:	5d                   	pop    %ebp
+  80412b:	c3                   	ret
+
+0080412c <pipe>:
+{
+  80412c:	55                   	push   %ebp
+  80412d:	89 e5                	mov    %esp,%ebp
+  80412f:	56                   	push   %esi
+  804130:	53                   	push   %ebx
+  804131:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804134:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804137:	50                   	push   %eax
+  804138:	e8 e3 df ff ff       	call   802120 <fd_alloc>
+  80413d:	89 c3                	mov    %eax,%ebx
+  80413f:	83 c4 10             	add    $0x10,%esp
+  804142:	85 c0                	test   %eax,%eax
+  804144:	0f 88 23 01 00 00    	js     80426d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80414a:	83 ec 04             	sub    $0x4,%esp
+  80414d:	68 07 04 00 00       	push   $0x407
+  804152:	ff 75 f4             	push   -0xc(%ebp)
+  804155:	6a 00                	push   $0x0
+  804157:	e8 fa d2 ff ff       	call   801456 <sys_page_alloc>
+  80415c:	89 c3                	mov    %eax,%ebx
+  80415e:	83 c4 10             	add    $0x10,%esp
+  804161:	85 c0                	test   %eax,%eax
+  804163:	0f 88 04 01 00 00    	js     80426d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804169:	83 ec 0c             	sub    $0xc,%esp
+  80416c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80416f:	50                   	push   %eax
+  804170:	e8 ab df ff ff       	call   802120 <fd_alloc>
+  804175:	89 c3                	mov    %eax,%ebx
+  804177:	83 c4 10             	add    $0x10,%esp
+  80417a:	85 c0                	test   %eax,%eax
+  80417c:	0f 88 db 00 00 00    	js     80425d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804182:	83 ec 04             	sub    $0x4,%esp
+  804185:	68 07 04 00 00       	push   $0x407
+  80418a:	ff 75 f0             	push   -0x10(%ebp)
+  80418d:	6a 00                	push   $0x0
+  80418f:	e8 c2 d2 ff ff       	call   801456 <sys_page_alloc>
+  804194:	89 c3                	mov    %eax,%ebx
+  804196:	83 c4 10             	add    $0x10,%esp
+  804199:	85 c0                	test   %eax,%eax
+  80419b:	0f 88 bc 00 00 00    	js     80425d <pipe+0x131>
+	va = fd2data(fd0);
+  8041a1:	83 ec 0c             	sub    $0xc,%esp
+  8041a4:	ff 75 f4             	push   -0xc(%ebp)
+  8041a7:	e8 5d df ff ff       	call   802109 <fd2data>
+  8041ac:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041ae:	83 c4 0c             	add    $0xc,%esp
+  8041b1:	68 07 04 00 00       	push   $0x407
+  8041b6:	50                   	push   %eax
+  8041b7:	6a 00                	push   $0x0
+  8041b9:	e8 98 d2 ff ff       	call   801456 <sys_page_alloc>
+  8041be:	89 c3                	mov    %eax,%ebx
+  8041c0:	83 c4 10             	add    $0x10,%esp
+  8041c3:	85 c0                	test   %eax,%eax
+  8041c5:	0f 88 82 00 00 00    	js     80424d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041cb:	83 ec 0c             	sub    $0xc,%esp
+  8041ce:	ff 75 f0             	push   -0x10(%ebp)
+  8041d1:	e8 33 df ff ff       	call   802109 <fd2data>
+  8041d6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8041dd:	50                   	push   %eax
+  8041de:	6a 00                	push   $0x0
+  8041e0:	56                   	push   %esi
+  8041e1:	6a 00                	push   $0x0
+  8041e3:	e8 bb d2 ff ff       	call   8014a3 <sys_page_map>
+  8041e8:	89 c3                	mov    %eax,%ebx
+  8041ea:	83 c4 20             	add    $0x20,%esp
+  8041ed:	85 c0                	test   %eax,%eax
+  8041ef:	78 4e                	js     80423f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8041f1:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  8041f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8041f9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8041fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8041fe:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804205:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804208:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80420a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80420d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804214:	83 ec 0c             	sub    $0xc,%esp
+  804217:	ff 75 f4             	push   -0xc(%ebp)
+  80421a:	e8 da de ff ff       	call   8020f9 <fd2num>
+  80421f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804222:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804224:	83 c4 04             	add    $0x4,%esp
+  804227:	ff 75 f0             	push   -0x10(%ebp)
+  80422a:	e8 ca de ff ff       	call   8020f9 <fd2num>
+  80422f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804232:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804235:	83 c4 10             	add    $0x10,%esp
+  804238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80423d:	eb 2e                	jmp    80426d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80423f:	83 ec 08             	sub    $0x8,%esp
+  804242:	56                   	push   %esi
+  804243:	6a 00                	push   $0x0
+  804245:	e8 a5 d2 ff ff       	call   8014ef <sys_page_unmap>
+  80424a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80424d:	83 ec 08             	sub    $0x8,%esp
+  804250:	ff 75 f0             	push   -0x10(%ebp)
+  804253:	6a 00                	push   $0x0
+  804255:	e8 95 d2 ff ff       	call   8014ef <sys_page_unmap>
+  80425a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80425d:	83 ec 08             	sub    $0x8,%esp
+  804260:	ff 75 f4             	push   -0xc(%ebp)
+  804263:	6a 00                	push   $0x0
+  804265:	e8 85 d2 ff ff       	call   8014ef <sys_page_unmap>
+  80426a:	83 c4 10             	add    $0x10,%esp
+}
+  80426d:	89 d8                	mov    %ebx,%eax
+  80426f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804272:	5b                   	pop    %ebx
+  804273:	5e                   	pop    %esi
+  804274:	5d                   	pop    %ebp
+  804275:	c3                   	ret
+
+00804276 <pipeisclosed>:
+{
+  804276:	55                   	push   %ebp
+  804277:	89 e5                	mov    %esp,%ebp
+  804279:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80427c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80427f:	50                   	push   %eax
+  804280:	ff 75 08             	push   0x8(%ebp)
+  804283:	e8 ee de ff ff       	call   802176 <fd_lookup>
+  804288:	83 c4 10             	add    $0x10,%esp
+  80428b:	85 c0                	test   %eax,%eax
+  80428d:	78 18                	js     8042a7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80428f:	83 ec 0c             	sub    $0xc,%esp
+  804292:	ff 75 f4             	push   -0xc(%ebp)
+  804295:	e8 6f de ff ff       	call   802109 <fd2data>
+  80429a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80429c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80429f:	e8 27 fc ff ff       	call   803ecb <_pipeisclosed>
+  8042a4:	83 c4 10             	add    $0x10,%esp
+}
+  8042a7:	c9                   	leave
+  8042a8:	c3                   	ret
+
+008042a9 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8042a9:	55                   	push   %ebp
+  8042aa:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8042ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042af:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8042b5:	5d                   	pop    %ebp
+  8042b6:	c3                   	ret
+
+008042b7 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8042b7:	55                   	push   %ebp
+  8042b8:	89 e5                	mov    %esp,%ebp
+  8042ba:	56                   	push   %esi
+  8042bb:	53                   	push   %ebx
+  8042bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8042bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8042c9:	89 d0                	mov    %edx,%eax
+  8042cb:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8042cf:	85 c0                	test   %eax,%eax
+  8042d1:	74 2d                	je     804300 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8042d3:	83 f8 02             	cmp    $0x2,%eax
+  8042d6:	74 08                	je     8042e0 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8042d8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8042dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  8042e0:	be 02 00 00 00       	mov    $0x2,%esi
+  8042e5:	eb 15                	jmp    8042fc <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8042e7:	83 ec 04             	sub    $0x4,%esp
+  8042ea:	6a 00                	push   $0x0
+  8042ec:	6a 02                	push   $0x2
+  8042ee:	53                   	push   %ebx
+  8042ef:	e8 77 d4 ff ff       	call   80176b <sys_futex_wait>
+  8042f4:	89 f0                	mov    %esi,%eax
+  8042f6:	f0 87 03             	lock xchg %eax,(%ebx)
+  8042f9:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8042fc:	85 c0                	test   %eax,%eax
+  8042fe:	75 e7                	jne    8042e7 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804300:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804303:	5b                   	pop    %ebx
+  804304:	5e                   	pop    %esi
+  804305:	5d                   	pop    %ebp
+  804306:	c3                   	ret
+
+00804307 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  804307:	55                   	push   %ebp
+  804308:	89 e5                	mov    %esp,%ebp
+  80430a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80430d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804312:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804317:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80431b:	f7 d8                	neg    %eax
+  80431d:	19 c0                	sbb    %eax,%eax
+  80431f:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  804322:	5d                   	pop    %ebp
+  804323:	c3                   	ret
+
+00804324 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804324:	55                   	push   %ebp
+  804325:	89 e5                	mov    %esp,%ebp
+  804327:	83 ec 08             	sub    $0x8,%esp
+  80432a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80432d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804332:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804335:	83 f8 02             	cmp    $0x2,%eax
+  804338:	74 02                	je     80433c <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80433a:	c9                   	leave
+  80433b:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80433c:	83 ec 08             	sub    $0x8,%esp
+  80433f:	6a 01                	push   $0x1
+  804341:	52                   	push   %edx
+  804342:	e8 53 d4 ff ff       	call   80179a <sys_futex_wake>
+  804347:	83 c4 10             	add    $0x10,%esp
+}
+  80434a:	eb ee                	jmp    80433a <mutex_unlock+0x16>
+
+0080434c <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80434c:	55                   	push   %ebp
+  80434d:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80434f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804352:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804358:	5d                   	pop    %ebp
+  804359:	c3                   	ret
+
+0080435a <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80435a:	55                   	push   %ebp
+  80435b:	89 e5                	mov    %esp,%ebp
+  80435d:	57                   	push   %edi
+  80435e:	56                   	push   %esi
+  80435f:	53                   	push   %ebx
+  804360:	83 ec 18             	sub    $0x18,%esp
+  804363:	8b 75 08             	mov    0x8(%ebp),%esi
+  804366:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  804369:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80436b:	53                   	push   %ebx
+  80436c:	e8 b3 ff ff ff       	call   804324 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804371:	83 c4 0c             	add    $0xc,%esp
+  804374:	ff 75 10             	push   0x10(%ebp)
+  804377:	57                   	push   %edi
+  804378:	56                   	push   %esi
+  804379:	e8 ed d3 ff ff       	call   80176b <sys_futex_wait>
+  80437e:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  804380:	83 c4 10             	add    $0x10,%esp
+  804383:	be 02 00 00 00       	mov    $0x2,%esi
+  804388:	eb 10                	jmp    80439a <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80438a:	83 ec 04             	sub    $0x4,%esp
+  80438d:	6a 00                	push   $0x0
+  80438f:	6a 02                	push   $0x2
+  804391:	53                   	push   %ebx
+  804392:	e8 d4 d3 ff ff       	call   80176b <sys_futex_wait>
+  804397:	83 c4 10             	add    $0x10,%esp
+  80439a:	89 f0                	mov    %esi,%eax
+  80439c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80439f:	85 c0                	test   %eax,%eax
+  8043a1:	75 e7                	jne    80438a <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8043a3:	83 ff ec             	cmp    $0xffffffec,%edi
+  8043a6:	74 05                	je     8043ad <cond_timedwait+0x53>
+  8043a8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8043ad:	89 f8                	mov    %edi,%eax
+  8043af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043b2:	5b                   	pop    %ebx
+  8043b3:	5e                   	pop    %esi
+  8043b4:	5f                   	pop    %edi
+  8043b5:	5d                   	pop    %ebp
+  8043b6:	c3                   	ret
+
+008043b7 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8043b7:	55                   	push   %ebp
+  8043b8:	89 e5                	mov    %esp,%ebp
+  8043ba:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8043bd:	6a 00                	push   $0x0
+  8043bf:	ff 75 0c             	push   0xc(%ebp)
+  8043c2:	ff 75 08             	push   0x8(%ebp)
+  8043c5:	e8 90 ff ff ff       	call   80435a <cond_timedwait>
+}
+  8043ca:	83 c4 10             	add    $0x10,%esp
+  8043cd:	c9                   	leave
+  8043ce:	c3                   	ret
+
+008043cf <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8043cf:	55                   	push   %ebp
+  8043d0:	89 e5                	mov    %esp,%ebp
+  8043d2:	83 ec 10             	sub    $0x10,%esp
+  8043d5:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8043d8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043dd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8043e1:	6a 01                	push   $0x1
+  8043e3:	50                   	push   %eax
+  8043e4:	e8 b1 d3 ff ff       	call   80179a <sys_futex_wake>
+}
+  8043e9:	83 c4 10             	add    $0x10,%esp
+  8043ec:	c9                   	leave
+  8043ed:	c3                   	ret
+
+008043ee <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8043ee:	55                   	push   %ebp
+  8043ef:	89 e5                	mov    %esp,%ebp
+  8043f1:	83 ec 10             	sub    $0x10,%esp
+  8043f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043f7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043fc:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  804400:	68 00 04 00 00       	push   $0x400
+  804405:	50                   	push   %eax
+  804406:	e8 8f d3 ff ff       	call   80179a <sys_futex_wake>
+}
+  80440b:	83 c4 10             	add    $0x10,%esp
+  80440e:	c9                   	leave
+  80440f:	c3                   	ret
+
+00804410 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  804410:	55                   	push   %ebp
+  804411:	89 e5                	mov    %esp,%ebp
+  804413:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  804416:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804419:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80441b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804422:	5d                   	pop    %ebp
+  804423:	c3                   	ret
+
+00804424 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  804424:	55                   	push   %ebp
+  804425:	89 e5                	mov    %esp,%ebp
+  804427:	53                   	push   %ebx
+  804428:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80442b:	8b 11                	mov    (%ecx),%edx
+  80442d:	85 d2                	test   %edx,%edx
+  80442f:	74 14                	je     804445 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  804431:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804434:	89 d0                	mov    %edx,%eax
+  804436:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80443a:	39 c2                	cmp    %eax,%edx
+  80443c:	75 ed                	jne    80442b <sem_trywait+0x7>
+			return 0;
+  80443e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804443:	eb 05                	jmp    80444a <sem_trywait+0x26>
+	return -E_AGAIN;
+  804445:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80444a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80444d:	c9                   	leave
+  80444e:	c3                   	ret
+
+0080444f <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  80444f:	55                   	push   %ebp
+  804450:	89 e5                	mov    %esp,%ebp
+  804452:	57                   	push   %edi
+  804453:	56                   	push   %esi
+  804454:	53                   	push   %ebx
+  804455:	83 ec 1c             	sub    $0x1c,%esp
+  804458:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80445b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  80445e:	e8 80 d2 ff ff       	call   8016e3 <sys_time_msec>
+  804463:	01 f8                	add    %edi,%eax
+  804465:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  804468:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  80446d:	eb 28                	jmp    804497 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  80446f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804474:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  804479:	83 ec 04             	sub    $0x4,%esp
+  80447c:	56                   	push   %esi
+  80447d:	6a 00                	push   $0x0
+  80447f:	53                   	push   %ebx
+  804480:	e8 e6 d2 ff ff       	call   80176b <sys_futex_wait>
+  804485:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80448a:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  80448f:	83 c4 10             	add    $0x10,%esp
+  804492:	83 f8 ec             	cmp    $0xffffffec,%eax
+  804495:	74 2e                	je     8044c5 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  804497:	83 ec 0c             	sub    $0xc,%esp
+  80449a:	53                   	push   %ebx
+  80449b:	e8 84 ff ff ff       	call   804424 <sem_trywait>
+  8044a0:	83 c4 10             	add    $0x10,%esp
+  8044a3:	85 c0                	test   %eax,%eax
+  8044a5:	79 19                	jns    8044c0 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8044a7:	85 ff                	test   %edi,%edi
+  8044a9:	74 c4                	je     80446f <sem_timedwait+0x20>
+  8044ab:	e8 33 d2 ff ff       	call   8016e3 <sys_time_msec>
+  8044b0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8044b3:	29 c6                	sub    %eax,%esi
+  8044b5:	85 f6                	test   %esi,%esi
+  8044b7:	7f b6                	jg     80446f <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8044b9:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8044be:	eb 05                	jmp    8044c5 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8044c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044c8:	5b                   	pop    %ebx
+  8044c9:	5e                   	pop    %esi
+  8044ca:	5f                   	pop    %edi
+  8044cb:	5d                   	pop    %ebp
+  8044cc:	c3                   	ret
+
+008044cd <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8044cd:	55                   	push   %ebp
+  8044ce:	89 e5                	mov    %esp,%ebp
+  8044d0:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8044d3:	6a 00                	push   $0x0
+  8044d5:	ff 75 08             	push   0x8(%ebp)
+  8044d8:	e8 72 ff ff ff       	call   80444f <sem_timedwait>
+}
+  8044dd:	83 c4 10             	add    $0x10,%esp
+  8044e0:	c9                   	leave
+  8044e1:	c3                   	ret
+
+008044e2 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8044e2:	55                   	push   %ebp
+  8044e3:	89 e5                	mov    %esp,%ebp
+  8044e5:	83 ec 08             	sub    $0x8,%esp
+  8044e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044eb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044f0:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8044f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8044f7:	85 d2                	test   %edx,%edx
+  8044f9:	75 02                	jne    8044fd <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8044fb:	c9                   	leave
+  8044fc:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8044fd:	83 ec 08             	sub    $0x8,%esp
+  804500:	6a 01                	push   $0x1
+  804502:	50                   	push   %eax
+  804503:	e8 92 d2 ff ff       	call   80179a <sys_futex_wake>
+  804508:	83 c4 10             	add    $0x10,%esp
+}
+  80450b:	eb ee                	jmp    8044fb <sem_post+0x19>
+
+0080450d <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80450d:	55                   	push   %ebp
+  80450e:	89 e5                	mov    %esp,%ebp
+  804510:	57                   	push   %edi
+  804511:	56                   	push   %esi
+  804512:	53                   	push   %ebx
+  804513:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  804516:	68 40 70 80 00       	push   $0x807040
+  80451b:	e8 97 fd ff ff       	call   8042b7 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  804520:	a1 64 70 80 00       	mov    0x807064,%eax
+  804525:	83 c4 10             	add    $0x10,%esp
+  804528:	85 c0                	test   %eax,%eax
+  80452a:	75 19                	jne    804545 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80452c:	a1 e0 72 80 00       	mov    0x8072e0,%eax
+  804531:	8b 00                	mov    (%eax),%eax
+  804533:	8b 40 48             	mov    0x48(%eax),%eax
+  804536:	a3 60 70 80 00       	mov    %eax,0x807060
+		threads[0].th_state = PTH_RUNNING;
+  80453b:	c7 05 64 70 80 00 01 	movl   $0x1,0x807064
+  804542:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  804545:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80454a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80454d:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  804554:	8b 40 04             	mov    0x4(%eax),%eax
+  804557:	85 c0                	test   %eax,%eax
+  804559:	0f 84 e4 00 00 00    	je     804643 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80455f:	83 c3 01             	add    $0x1,%ebx
+  804562:	83 fb 20             	cmp    $0x20,%ebx
+  804565:	75 e3                	jne    80454a <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  804567:	83 ec 0c             	sub    $0xc,%esp
+  80456a:	68 40 70 80 00       	push   $0x807040
+  80456f:	e8 b0 fd ff ff       	call   804324 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  804574:	83 c4 10             	add    $0x10,%esp
+  804577:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80457c:	e9 b8 00 00 00       	jmp    804639 <pthread_create+0x12c>
+  804581:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804584:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  804587:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  804589:	39 f3                	cmp    %esi,%ebx
+  80458b:	73 16                	jae    8045a3 <pthread_create+0x96>
+		va -= PGSIZE;
+  80458d:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  804593:	83 ec 08             	sub    $0x8,%esp
+  804596:	56                   	push   %esi
+  804597:	6a 00                	push   $0x0
+  804599:	e8 51 cf ff ff       	call   8014ef <sys_page_unmap>
+  80459e:	83 c4 10             	add    $0x10,%esp
+  8045a1:	eb e6                	jmp    804589 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8045a3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8045a6:	83 ec 08             	sub    $0x8,%esp
+  8045a9:	ff 75 e4             	push   -0x1c(%ebp)
+  8045ac:	6a 00                	push   $0x0
+  8045ae:	e8 3c cf ff ff       	call   8014ef <sys_page_unmap>
+	return r;
+  8045b3:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8045b6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8045b9:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8045c0:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8045c7:	eb 70                	jmp    804639 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8045c9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8045cc:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8045d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8045d6:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8045d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8045dc:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8045df:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8045e6:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8045eb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8045ee:	29 c8                	sub    %ecx,%eax
+  8045f0:	85 db                	test   %ebx,%ebx
+  8045f2:	0f 44 05 e0 72 80 00 	cmove  0x8072e0,%eax
+	*--esp = t;
+  8045f9:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8045fc:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  804603:	83 ec 04             	sub    $0x4,%esp
+  804606:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80460b:	29 ca                	sub    %ecx,%edx
+  80460d:	52                   	push   %edx
+	*--esp = 0;
+  80460e:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  804611:	50                   	push   %eax
+  804612:	68 6a 48 80 00       	push   $0x80486a
+  804617:	e8 23 d2 ff ff       	call   80183f <sys_thread_create>
+  80461c:	89 c7                	mov    %eax,%edi
+  80461e:	83 c4 10             	add    $0x10,%esp
+  804621:	85 c0                	test   %eax,%eax
+  804623:	78 91                	js     8045b6 <pthread_create+0xa9>
+	th->th_env = id;
+  804625:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804628:	89 3c 85 60 70 80 00 	mov    %edi,0x807060(,%eax,4)
+	*tp = t;
+  80462f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804632:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  804634:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  804639:	89 f8                	mov    %edi,%eax
+  80463b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80463e:	5b                   	pop    %ebx
+  80463f:	5e                   	pop    %esi
+  804640:	5f                   	pop    %edi
+  804641:	5d                   	pop    %ebp
+  804642:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  804643:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804646:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  80464d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  804654:	83 ec 0c             	sub    $0xc,%esp
+  804657:	68 40 70 80 00       	push   $0x807040
+  80465c:	e8 c3 fc ff ff       	call   804324 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  804661:	89 d9                	mov    %ebx,%ecx
+  804663:	c1 e1 10             	shl    $0x10,%ecx
+  804666:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  804669:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  80466e:	29 c8                	sub    %ecx,%eax
+  804670:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  804673:	c1 e8 16             	shr    $0x16,%eax
+  804676:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80467d:	83 c4 10             	add    $0x10,%esp
+  804680:	a8 01                	test   $0x1,%al
+  804682:	74 15                	je     804699 <pthread_create+0x18c>
+  804684:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804687:	c1 e8 0c             	shr    $0xc,%eax
+  80468a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804691:	a8 01                	test   $0x1,%al
+  804693:	0f 85 30 ff ff ff    	jne    8045c9 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804699:	83 ec 04             	sub    $0x4,%esp
+  80469c:	6a 07                	push   $0x7
+  80469e:	ff 75 e4             	push   -0x1c(%ebp)
+  8046a1:	6a 00                	push   $0x0
+  8046a3:	e8 ae cd ff ff       	call   801456 <sys_page_alloc>
+  8046a8:	89 c7                	mov    %eax,%edi
+  8046aa:	83 c4 10             	add    $0x10,%esp
+  8046ad:	85 c0                	test   %eax,%eax
+  8046af:	0f 88 01 ff ff ff    	js     8045b6 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8046b5:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8046ba:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8046bd:	29 d0                	sub    %edx,%eax
+  8046bf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046c2:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8046c4:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8046c9:	29 d0                	sub    %edx,%eax
+  8046cb:	89 c7                	mov    %eax,%edi
+  8046cd:	39 fe                	cmp    %edi,%esi
+  8046cf:	0f 83 f4 fe ff ff    	jae    8045c9 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8046d5:	83 ec 04             	sub    $0x4,%esp
+  8046d8:	6a 07                	push   $0x7
+  8046da:	56                   	push   %esi
+  8046db:	6a 00                	push   $0x0
+  8046dd:	e8 74 cd ff ff       	call   801456 <sys_page_alloc>
+  8046e2:	83 c4 10             	add    $0x10,%esp
+  8046e5:	85 c0                	test   %eax,%eax
+  8046e7:	0f 88 94 fe ff ff    	js     804581 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8046ed:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8046f3:	eb d8                	jmp    8046cd <pthread_create+0x1c0>
+
+008046f5 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8046f5:	55                   	push   %ebp
+  8046f6:	89 e5                	mov    %esp,%ebp
+  8046f8:	57                   	push   %edi
+  8046f9:	56                   	push   %esi
+  8046fa:	53                   	push   %ebx
+  8046fb:	83 ec 0c             	sub    $0xc,%esp
+  8046fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  804701:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804704:	83 f8 1e             	cmp    $0x1e,%eax
+  804707:	0f 87 c7 00 00 00    	ja     8047d4 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80470d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80470f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804715:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80471a:	77 12                	ja     80472e <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80471c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804721:	29 d0                	sub    %edx,%eax
+  804723:	c1 e8 10             	shr    $0x10,%eax
+  804726:	39 c3                	cmp    %eax,%ebx
+  804728:	0f 84 ad 00 00 00    	je     8047db <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80472e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804731:	8d 3c 85 64 70 80 00 	lea    0x807064(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  804738:	8d 34 85 60 70 80 00 	lea    0x807060(,%eax,4),%esi
+  80473f:	eb 10                	jmp    804751 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804741:	83 ec 04             	sub    $0x4,%esp
+  804744:	6a 00                	push   $0x0
+  804746:	6a 01                	push   $0x1
+  804748:	57                   	push   %edi
+  804749:	e8 1d d0 ff ff       	call   80176b <sys_futex_wait>
+  80474e:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  804751:	8b 46 04             	mov    0x4(%esi),%eax
+  804754:	83 f8 01             	cmp    $0x1,%eax
+  804757:	74 e8                	je     804741 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  804759:	83 f8 02             	cmp    $0x2,%eax
+  80475c:	0f 85 80 00 00 00    	jne    8047e2 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804762:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804765:	c1 e6 02             	shl    $0x2,%esi
+  804768:	eb 05                	jmp    80476f <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80476a:	e8 bb cc ff ff       	call   80142a <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80476f:	8b 8e 60 70 80 00    	mov    0x807060(%esi),%ecx
+  804775:	89 ca                	mov    %ecx,%edx
+  804777:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80477d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804780:	c1 e0 04             	shl    $0x4,%eax
+  804783:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804788:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80478b:	39 c1                	cmp    %eax,%ecx
+  80478d:	75 12                	jne    8047a1 <pthread_join+0xac>
+  80478f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804792:	c1 e0 04             	shl    $0x4,%eax
+  804795:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80479a:	8b 40 54             	mov    0x54(%eax),%eax
+  80479d:	85 c0                	test   %eax,%eax
+  80479f:	75 c9                	jne    80476a <pthread_join+0x75>
+	if (ret_store)
+  8047a1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8047a5:	74 0f                	je     8047b6 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8047a7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8047aa:	8b 04 85 70 70 80 00 	mov    0x807070(,%eax,4),%eax
+  8047b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8047b4:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8047b6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8047b9:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8047c0:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8047c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047cf:	5b                   	pop    %ebx
+  8047d0:	5e                   	pop    %esi
+  8047d1:	5f                   	pop    %edi
+  8047d2:	5d                   	pop    %ebp
+  8047d3:	c3                   	ret
+		return -E_INVAL;
+  8047d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047d9:	eb f1                	jmp    8047cc <pthread_join+0xd7>
+  8047db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047e0:	eb ea                	jmp    8047cc <pthread_join+0xd7>
+		return -E_INVAL;
+  8047e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047e7:	eb e3                	jmp    8047cc <pthread_join+0xd7>
+
+008047e9 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8047e9:	55                   	push   %ebp
+  8047ea:	89 e5                	mov    %esp,%ebp
+  8047ec:	53                   	push   %ebx
+  8047ed:	83 ec 04             	sub    $0x4,%esp
+  8047f0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047f2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8047f8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8047fd:	77 0c                	ja     80480b <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804804:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804806:	c1 e8 10             	shr    $0x10,%eax
+  804809:	75 0a                	jne    804815 <pthread_exit+0x2c>
+		exit();
+  80480b:	e8 21 c1 ff ff       	call   800931 <exit>
+  804810:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804815:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80481c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80481f:	8d 0c 8d 60 70 80 00 	lea    0x807060(,%ecx,4),%ecx
+  804826:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804829:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80482c:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  804833:	83 ec 08             	sub    $0x8,%esp
+  804836:	6a 20                	push   $0x20
+  804838:	01 c2                	add    %eax,%edx
+  80483a:	8d 04 95 64 70 80 00 	lea    0x807064(,%edx,4),%eax
+  804841:	50                   	push   %eax
+  804842:	e8 53 cf ff ff       	call   80179a <sys_futex_wake>
+	sys_env_destroy(0);
+  804847:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80484e:	e8 60 cb ff ff       	call   8013b3 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804853:	83 c4 0c             	add    $0xc,%esp
+  804856:	68 32 58 80 00       	push   $0x805832
+  80485b:	68 a5 00 00 00       	push   $0xa5
+  804860:	68 4c 58 80 00       	push   $0x80584c
+  804865:	e8 ef c0 ff ff       	call   800959 <_panic>
+
+0080486a <pthread_start>:
+{
+  80486a:	55                   	push   %ebp
+  80486b:	89 e5                	mov    %esp,%ebp
+  80486d:	53                   	push   %ebx
+  80486e:	83 ec 04             	sub    $0x4,%esp
+  804871:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804874:	e8 85 cb ff ff       	call   8013fe <sys_getenvid>
+  804879:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80487e:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	if (t == 0)
+  804884:	85 db                	test   %ebx,%ebx
+  804886:	74 0c                	je     804894 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804888:	89 d9                	mov    %ebx,%ecx
+  80488a:	c1 e1 10             	shl    $0x10,%ecx
+  80488d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804892:	29 ca                	sub    %ecx,%edx
+  804894:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804897:	c1 e0 04             	shl    $0x4,%eax
+  80489a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80489f:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8048a1:	83 ec 0c             	sub    $0xc,%esp
+  8048a4:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8048ab:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8048ae:	ff 34 95 6c 70 80 00 	push   0x80706c(,%edx,4)
+  8048b5:	ff 14 95 68 70 80 00 	call   *0x807068(,%edx,4)
+  8048bc:	89 04 24             	mov    %eax,(%esp)
+  8048bf:	e8 25 ff ff ff       	call   8047e9 <pthread_exit>
+
+008048c4 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8048c4:	55                   	push   %ebp
+  8048c5:	89 e5                	mov    %esp,%ebp
+  8048c7:	57                   	push   %edi
+  8048c8:	56                   	push   %esi
+  8048c9:	53                   	push   %ebx
+  8048ca:	83 ec 1c             	sub    $0x1c,%esp
+  8048cd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048cf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8048d5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048dc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048e1:	77 0d                	ja     8048f0 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8048e3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8048e8:	29 d0                	sub    %edx,%eax
+  8048ea:	c1 e8 10             	shr    $0x10,%eax
+  8048ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8048f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048f5:	eb 2f                	jmp    804926 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8048f7:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8048fd:	8b 01                	mov    (%ecx),%eax
+  8048ff:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804902:	39 c2                	cmp    %eax,%edx
+  804904:	75 14                	jne    80491a <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804906:	83 ec 0c             	sub    $0xc,%esp
+  804909:	57                   	push   %edi
+  80490a:	e8 a4 ca ff ff       	call   8013b3 <sys_env_destroy>
+  80490f:	83 c4 10             	add    $0x10,%esp
+  804912:	85 c0                	test   %eax,%eax
+  804914:	0f 88 97 00 00 00    	js     8049b1 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80491a:	83 c3 01             	add    $0x1,%ebx
+  80491d:	83 fb 20             	cmp    $0x20,%ebx
+  804920:	0f 84 d2 00 00 00    	je     8049f8 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804926:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804929:	74 ef                	je     80491a <pthread_kill_others+0x56>
+  80492b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80492e:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  804935:	8b 40 04             	mov    0x4(%eax),%eax
+  804938:	83 f8 01             	cmp    $0x1,%eax
+  80493b:	75 dd                	jne    80491a <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80493d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804940:	8b 3c 85 60 70 80 00 	mov    0x807060(,%eax,4),%edi
+  804947:	89 fe                	mov    %edi,%esi
+  804949:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80494f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804952:	c1 e0 04             	shl    $0x4,%eax
+  804955:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80495a:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80495d:	39 c7                	cmp    %eax,%edi
+  80495f:	75 b9                	jne    80491a <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804961:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804964:	c1 e0 04             	shl    $0x4,%eax
+  804967:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80496c:	8b 40 54             	mov    0x54(%eax),%eax
+  80496f:	85 c0                	test   %eax,%eax
+  804971:	74 a7                	je     80491a <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804973:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804976:	c1 e0 04             	shl    $0x4,%eax
+  804979:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80497f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804981:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804987:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80498c:	0f 87 65 ff ff ff    	ja     8048f7 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804992:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804997:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804999:	c1 e8 10             	shr    $0x10,%eax
+  80499c:	0f 84 55 ff ff ff    	je     8048f7 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8049a2:	c1 e0 10             	shl    $0x10,%eax
+  8049a5:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8049aa:	29 c1                	sub    %eax,%ecx
+  8049ac:	e9 4c ff ff ff       	jmp    8048fd <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8049b1:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8049b4:	c1 e2 04             	shl    $0x4,%edx
+  8049b7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8049bd:	8b 52 48             	mov    0x48(%edx),%edx
+  8049c0:	39 fa                	cmp    %edi,%edx
+  8049c2:	0f 85 52 ff ff ff    	jne    80491a <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8049c8:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8049cb:	c1 e2 04             	shl    $0x4,%edx
+  8049ce:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8049d4:	8b 52 54             	mov    0x54(%edx),%edx
+  8049d7:	85 d2                	test   %edx,%edx
+  8049d9:	0f 84 3b ff ff ff    	je     80491a <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8049df:	83 ec 0c             	sub    $0xc,%esp
+  8049e2:	50                   	push   %eax
+  8049e3:	57                   	push   %edi
+  8049e4:	68 5c 58 80 00       	push   $0x80585c
+  8049e9:	68 bb 00 00 00       	push   $0xbb
+  8049ee:	68 4c 58 80 00       	push   $0x80584c
+  8049f3:	e8 61 bf ff ff       	call   800959 <_panic>
+	}
+}
+  8049f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049fb:	5b                   	pop    %ebx
+  8049fc:	5e                   	pop    %esi
+  8049fd:	5f                   	pop    %edi
+  8049fe:	5d                   	pop    %ebp
+  8049ff:	c3                   	ret
+
+00804a00 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804a00:	55                   	push   %ebp
+  804a01:	89 e5                	mov    %esp,%ebp
+  804a03:	53                   	push   %ebx
+  804a04:	83 ec 04             	sub    $0x4,%esp
+  804a07:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a09:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804a0f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804a15:	0f 87 85 00 00 00    	ja     804aa0 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a1b:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804a20:	29 c3                	sub    %eax,%ebx
+  804a22:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804a25:	83 ec 04             	sub    $0x4,%esp
+  804a28:	68 80 02 00 00       	push   $0x280
+  804a2d:	6a 00                	push   $0x0
+  804a2f:	68 60 70 80 00       	push   $0x807060
+  804a34:	e8 30 c7 ff ff       	call   801169 <memset>
+	threads_mu.m_state = 0;
+  804a39:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  804a40:	00 00 00 
+	if (self != 0) {
+  804a43:	83 c4 10             	add    $0x10,%esp
+  804a46:	85 db                	test   %ebx,%ebx
+  804a48:	74 51                	je     804a9b <pthread_fork_child+0x9b>
+  804a4a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a4c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a52:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a57:	77 18                	ja     804a71 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a59:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a5e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a60:	c1 e8 10             	shr    $0x10,%eax
+  804a63:	74 0c                	je     804a71 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a65:	c1 e0 10             	shl    $0x10,%eax
+  804a68:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a6d:	29 c2                	sub    %eax,%edx
+  804a6f:	eb 06                	jmp    804a77 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804a71:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804a77:	8b 02                	mov    (%edx),%eax
+  804a79:	8b 48 48             	mov    0x48(%eax),%ecx
+  804a7c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804a83:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804a86:	89 0c 95 60 70 80 00 	mov    %ecx,0x807060(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804a8d:	8d 04 95 60 70 80 00 	lea    0x807060(,%edx,4),%eax
+  804a94:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804a9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a9e:	c9                   	leave
+  804a9f:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804aa0:	83 ec 04             	sub    $0x4,%esp
+  804aa3:	68 80 02 00 00       	push   $0x280
+  804aa8:	6a 00                	push   $0x0
+  804aaa:	68 60 70 80 00       	push   $0x807060
+  804aaf:	e8 b5 c6 ff ff       	call   801169 <memset>
+	threads_mu.m_state = 0;
+  804ab4:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  804abb:	00 00 00 
+  804abe:	83 c4 10             	add    $0x10,%esp
+  804ac1:	eb d8                	jmp    804a9b <pthread_fork_child+0x9b>
+
+00804ac3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac8:	c3                   	ret
+
+00804ac9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804ac9:	55                   	push   %ebp
+  804aca:	89 e5                	mov    %esp,%ebp
+  804acc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804acf:	68 81 58 80 00       	push   $0x805881
+  804ad4:	ff 75 0c             	push   0xc(%ebp)
+  804ad7:	e8 3c c5 ff ff       	call   801018 <strcpy>
+	return 0;
+}
+  804adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae1:	c9                   	leave
+  804ae2:	c3                   	ret
+
+00804ae3 <devcons_write>:
+{
+  804ae3:	55                   	push   %ebp
+  804ae4:	89 e5                	mov    %esp,%ebp
+  804ae6:	57                   	push   %edi
+  804ae7:	56                   	push   %esi
+  804ae8:	53                   	push   %ebx
+  804ae9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804aef:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804af4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804afa:	eb 2e                	jmp    804b2a <devcons_write+0x47>
+		m = n - tot;
+  804afc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804aff:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804b01:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804b06:	39 c3                	cmp    %eax,%ebx
+  804b08:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804b0b:	83 ec 04             	sub    $0x4,%esp
+  804b0e:	53                   	push   %ebx
+  804b0f:	89 f0                	mov    %esi,%eax
+  804b11:	03 45 0c             	add    0xc(%ebp),%eax
+  804b14:	50                   	push   %eax
+  804b15:	57                   	push   %edi
+  804b16:	e8 83 c6 ff ff       	call   80119e <memmove>
+		sys_cputs(buf, m);
+  804b1b:	83 c4 08             	add    $0x8,%esp
+  804b1e:	53                   	push   %ebx
+  804b1f:	57                   	push   %edi
+  804b20:	e8 37 c8 ff ff       	call   80135c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804b25:	01 de                	add    %ebx,%esi
+  804b27:	83 c4 10             	add    $0x10,%esp
+  804b2a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804b2d:	72 cd                	jb     804afc <devcons_write+0x19>
+}
+  804b2f:	89 f0                	mov    %esi,%eax
+  804b31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b34:	5b                   	pop    %ebx
+  804b35:	5e                   	pop    %esi
+  804b36:	5f                   	pop    %edi
+  804b37:	5d                   	pop    %ebp
+  804b38:	c3                   	ret
+
+00804b39 <devcons_read>:
+{
+  804b39:	55                   	push   %ebp
+  804b3a:	89 e5                	mov    %esp,%ebp
+  804b3c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b44:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804b48:	75 07                	jne    804b51 <devcons_read+0x18>
+  804b4a:	eb 1f                	jmp    804b6b <devcons_read+0x32>
+		sys_yield();
+  804b4c:	e8 d9 c8 ff ff       	call   80142a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804b51:	e8 31 c8 ff ff       	call   801387 <sys_cgetc>
+  804b56:	85 c0                	test   %eax,%eax
+  804b58:	74 f2                	je     804b4c <devcons_read+0x13>
+	if (c < 0)
+  804b5a:	78 0f                	js     804b6b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804b5c:	83 f8 04             	cmp    $0x4,%eax
+  804b5f:	74 0c                	je     804b6d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804b61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804b64:	88 02                	mov    %al,(%edx)
+	return 1;
+  804b66:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804b6b:	c9                   	leave
+  804b6c:	c3                   	ret
+		return 0;
+  804b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b72:	eb f7                	jmp    804b6b <devcons_read+0x32>
+
+00804b74 <cputchar>:
+{
+  804b74:	55                   	push   %ebp
+  804b75:	89 e5                	mov    %esp,%ebp
+  804b77:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b7d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804b80:	6a 01                	push   $0x1
+  804b82:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804b85:	50                   	push   %eax
+  804b86:	e8 d1 c7 ff ff       	call   80135c <sys_cputs>
+}
+  804b8b:	83 c4 10             	add    $0x10,%esp
+  804b8e:	c9                   	leave
+  804b8f:	c3                   	ret
+
+00804b90 <getchar>:
+{
+  804b90:	55                   	push   %ebp
+  804b91:	89 e5                	mov    %esp,%ebp
+  804b93:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804b96:	6a 01                	push   $0x1
+  804b98:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804b9b:	50                   	push   %eax
+  804b9c:	6a 00                	push   $0x0
+  804b9e:	e8 63 d8 ff ff       	call   802406 <read>
+	if (r < 0)
+  804ba3:	83 c4 10             	add    $0x10,%esp
+  804ba6:	85 c0                	test   %eax,%eax
+  804ba8:	78 06                	js     804bb0 <getchar+0x20>
+	if (r < 1)
+  804baa:	74 06                	je     804bb2 <getchar+0x22>
+	return c;
+  804bac:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804bb0:	c9                   	leave
+  804bb1:	c3                   	ret
+		return -E_EOF;
+  804bb2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804bb7:	eb f7                	jmp    804bb0 <getchar+0x20>
+
+00804bb9 <iscons>:
+{
+  804bb9:	55                   	push   %ebp
+  804bba:	89 e5                	mov    %esp,%ebp
+  804bbc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804bc2:	50                   	push   %eax
+  804bc3:	ff 75 08             	push   0x8(%ebp)
+  804bc6:	e8 ab d5 ff ff       	call   802176 <fd_lookup>
+  804bcb:	83 c4 10             	add    $0x10,%esp
+  804bce:	85 c0                	test   %eax,%eax
+  804bd0:	78 11                	js     804be3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804bd5:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804bdb:	39 10                	cmp    %edx,(%eax)
+  804bdd:	0f 94 c0             	sete   %al
+  804be0:	0f b6 c0             	movzbl %al,%eax
+}
+  804be3:	c9                   	leave
+  804be4:	c3                   	ret
+
+00804be5 <opencons>:
+{
+  804be5:	55                   	push   %ebp
+  804be6:	89 e5                	mov    %esp,%ebp
+  804be8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804beb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804bee:	50                   	push   %eax
+  804bef:	e8 2c d5 ff ff       	call   802120 <fd_alloc>
+  804bf4:	83 c4 10             	add    $0x10,%esp
+  804bf7:	85 c0                	test   %eax,%eax
+  804bf9:	78 3a                	js     804c35 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804bfb:	83 ec 04             	sub    $0x4,%esp
+  804bfe:	68 07 04 00 00       	push   $0x407
+  804c03:	ff 75 f4             	push   -0xc(%ebp)
+  804c06:	6a 00                	push   $0x0
+  804c08:	e8 49 c8 ff ff       	call   801456 <sys_page_alloc>
+  804c0d:	83 c4 10             	add    $0x10,%esp
+  804c10:	85 c0                	test   %eax,%eax
+  804c12:	78 21                	js     804c35 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804c14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c17:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804c1d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804c1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c22:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804c29:	83 ec 0c             	sub    $0xc,%esp
+  804c2c:	50                   	push   %eax
+  804c2d:	e8 c7 d4 ff ff       	call   8020f9 <fd2num>
+  804c32:	83 c4 10             	add    $0x10,%esp
+}
+  804c35:	c9                   	leave
+  804c36:	c3                   	ret
+
+00804c37 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804c37:	55                   	push   %ebp
+  804c38:	89 e5                	mov    %esp,%ebp
+  804c3a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804c3d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804c44:	74 0a                	je     804c50 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c49:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804c4e:	c9                   	leave
+  804c4f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804c50:	83 ec 04             	sub    $0x4,%esp
+  804c53:	6a 07                	push   $0x7
+  804c55:	68 00 f0 bf ee       	push   $0xeebff000
+  804c5a:	6a 00                	push   $0x0
+  804c5c:	e8 f5 c7 ff ff       	call   801456 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804c61:	83 c4 08             	add    $0x8,%esp
+  804c64:	68 75 4c 80 00       	push   $0x804c75
+  804c69:	6a 00                	push   $0x0
+  804c6b:	e8 63 c9 ff ff       	call   8015d3 <sys_env_set_pgfault_upcall>
+  804c70:	83 c4 10             	add    $0x10,%esp
+  804c73:	eb d1                	jmp    804c46 <set_pgfault_handler+0xf>
+
+00804c75 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804c75:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804c76:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804c7b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804c7d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804c80:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804c84:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804c88:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804c8b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804c8f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804c91:	83 c4 08             	add    $0x8,%esp
+	popal
+  804c94:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804c95:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804c98:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804c99:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804c9a:	c3                   	ret
+
+00804c9b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804c9b:	55                   	push   %ebp
+  804c9c:	89 e5                	mov    %esp,%ebp
+  804c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ca1:	89 c2                	mov    %eax,%edx
+  804ca3:	c1 ea 16             	shr    $0x16,%edx
+  804ca6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804cad:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804cb2:	f6 c1 01             	test   $0x1,%cl
+  804cb5:	74 1c                	je     804cd3 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804cb7:	c1 e8 0c             	shr    $0xc,%eax
+  804cba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804cc1:	a8 01                	test   $0x1,%al
+  804cc3:	74 0e                	je     804cd3 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804cc5:	c1 e8 0c             	shr    $0xc,%eax
+  804cc8:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804ccf:	ef 
+  804cd0:	0f b7 d2             	movzwl %dx,%edx
+}
+  804cd3:	89 d0                	mov    %edx,%eax
+  804cd5:	5d                   	pop    %ebp
+  804cd6:	c3                   	ret
+
+00804cd7 <udm>:
+  804cd7:	57                   	push   %edi
+  804cd8:	56                   	push   %esi
+  804cd9:	53                   	push   %ebx
+  804cda:	83 ec 20             	sub    $0x20,%esp
+  804cdd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804ce1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804ce5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804ce9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804ced:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804cf1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804cf5:	89 d1                	mov    %edx,%ecx
+  804cf7:	09 c1                	or     %eax,%ecx
+  804cf9:	0f 84 91 00 00 00    	je     804d90 <udm+0xb9>
+  804cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d09:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804d0e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804d15:	00 
+  804d16:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804d1d:	00 
+  804d1e:	eb 08                	jmp    804d28 <udm+0x51>
+  804d20:	83 e9 01             	sub    $0x1,%ecx
+  804d23:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804d26:	74 7c                	je     804da4 <udm+0xcd>
+  804d28:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804d2c:	01 c0                	add    %eax,%eax
+  804d2e:	89 c6                	mov    %eax,%esi
+  804d30:	89 d7                	mov    %edx,%edi
+  804d32:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804d36:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804d3a:	0f ad d0             	shrd   %cl,%edx,%eax
+  804d3d:	d3 ea                	shr    %cl,%edx
+  804d3f:	f6 c1 20             	test   $0x20,%cl
+  804d42:	74 04                	je     804d48 <udm+0x71>
+  804d44:	89 d0                	mov    %edx,%eax
+  804d46:	31 d2                	xor    %edx,%edx
+  804d48:	83 e0 01             	and    $0x1,%eax
+  804d4b:	89 04 24             	mov    %eax,(%esp)
+  804d4e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804d55:	00 
+  804d56:	8b 04 24             	mov    (%esp),%eax
+  804d59:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804d5d:	09 f0                	or     %esi,%eax
+  804d5f:	09 fa                	or     %edi,%edx
+  804d61:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d65:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804d69:	39 f0                	cmp    %esi,%eax
+  804d6b:	89 d3                	mov    %edx,%ebx
+  804d6d:	19 fb                	sbb    %edi,%ebx
+  804d6f:	72 af                	jb     804d20 <udm+0x49>
+  804d71:	29 f0                	sub    %esi,%eax
+  804d73:	19 fa                	sbb    %edi,%edx
+  804d75:	89 cf                	mov    %ecx,%edi
+  804d77:	c1 ef 05             	shr    $0x5,%edi
+  804d7a:	83 e7 01             	and    $0x1,%edi
+  804d7d:	89 fe                	mov    %edi,%esi
+  804d7f:	83 f6 01             	xor    $0x1,%esi
+  804d82:	d3 e6                	shl    %cl,%esi
+  804d84:	d3 e7                	shl    %cl,%edi
+  804d86:	09 74 24 18          	or     %esi,0x18(%esp)
+  804d8a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804d8e:	eb 90                	jmp    804d20 <udm+0x49>
+  804d90:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d94:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804d98:	89 f0                	mov    %esi,%eax
+  804d9a:	89 fa                	mov    %edi,%edx
+  804d9c:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804da0:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804da4:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804da8:	89 01                	mov    %eax,(%ecx)
+  804daa:	89 51 04             	mov    %edx,0x4(%ecx)
+  804dad:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804db1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804db5:	83 c4 20             	add    $0x20,%esp
+  804db8:	5b                   	pop    %ebx
+  804db9:	5e                   	pop    %esi
+  804dba:	5f                   	pop    %edi
+  804dbb:	c3                   	ret
+
+00804dbc <__udivdi3>:
+  804dbc:	83 ec 18             	sub    $0x18,%esp
+  804dbf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804dc3:	50                   	push   %eax
+  804dc4:	ff 74 24 2c          	push   0x2c(%esp)
+  804dc8:	ff 74 24 2c          	push   0x2c(%esp)
+  804dcc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804dd0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804dd4:	e8 fe fe ff ff       	call   804cd7 <udm>
+  804dd9:	83 c4 24             	add    $0x24,%esp
+  804ddc:	c3                   	ret
+
+00804ddd <__umoddi3>:
+  804ddd:	83 ec 18             	sub    $0x18,%esp
+  804de0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804de4:	50                   	push   %eax
+  804de5:	ff 74 24 2c          	push   0x2c(%esp)
+  804de9:	ff 74 24 2c          	push   0x2c(%esp)
+  804ded:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804df1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804df5:	e8 dd fe ff ff       	call   804cd7 <udm>
+  804dfa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804dfe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804e02:	83 c4 24             	add    $0x24,%esp
+  804e05:	c3                   	ret
+
+00804e06 <__divdi3>:
+  804e06:	56                   	push   %esi
+  804e07:	53                   	push   %ebx
+  804e08:	83 ec 14             	sub    $0x14,%esp
+  804e0b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804e0f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804e13:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804e17:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804e1b:	85 d2                	test   %edx,%edx
+  804e1d:	78 18                	js     804e37 <__divdi3+0x31>
+  804e1f:	85 db                	test   %ebx,%ebx
+  804e21:	78 3e                	js     804e61 <__divdi3+0x5b>
+  804e23:	83 ec 04             	sub    $0x4,%esp
+  804e26:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e2a:	56                   	push   %esi
+  804e2b:	53                   	push   %ebx
+  804e2c:	51                   	push   %ecx
+  804e2d:	e8 a5 fe ff ff       	call   804cd7 <udm>
+  804e32:	83 c4 10             	add    $0x10,%esp
+  804e35:	eb 24                	jmp    804e5b <__divdi3+0x55>
+  804e37:	f7 d8                	neg    %eax
+  804e39:	83 d2 00             	adc    $0x0,%edx
+  804e3c:	f7 da                	neg    %edx
+  804e3e:	85 db                	test   %ebx,%ebx
+  804e40:	78 3a                	js     804e7c <__divdi3+0x76>
+  804e42:	83 ec 04             	sub    $0x4,%esp
+  804e45:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e49:	56                   	push   %esi
+  804e4a:	53                   	push   %ebx
+  804e4b:	51                   	push   %ecx
+  804e4c:	e8 86 fe ff ff       	call   804cd7 <udm>
+  804e51:	83 c4 10             	add    $0x10,%esp
+  804e54:	f7 d8                	neg    %eax
+  804e56:	83 d2 00             	adc    $0x0,%edx
+  804e59:	f7 da                	neg    %edx
+  804e5b:	83 c4 14             	add    $0x14,%esp
+  804e5e:	5b                   	pop    %ebx
+  804e5f:	5e                   	pop    %esi
+  804e60:	c3                   	ret
+  804e61:	83 ec 04             	sub    $0x4,%esp
+  804e64:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e68:	56                   	push   %esi
+  804e69:	f7 d9                	neg    %ecx
+  804e6b:	83 d3 00             	adc    $0x0,%ebx
+  804e6e:	f7 db                	neg    %ebx
+  804e70:	53                   	push   %ebx
+  804e71:	51                   	push   %ecx
+  804e72:	e8 60 fe ff ff       	call   804cd7 <udm>
+  804e77:	83 c4 10             	add    $0x10,%esp
+  804e7a:	eb d8                	jmp    804e54 <__divdi3+0x4e>
+  804e7c:	83 ec 04             	sub    $0x4,%esp
+  804e7f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e83:	56                   	push   %esi
+  804e84:	f7 d9                	neg    %ecx
+  804e86:	83 d3 00             	adc    $0x0,%ebx
+  804e89:	f7 db                	neg    %ebx
+  804e8b:	53                   	push   %ebx
+  804e8c:	51                   	push   %ecx
+  804e8d:	e8 45 fe ff ff       	call   804cd7 <udm>
+  804e92:	83 c4 10             	add    $0x10,%esp
+  804e95:	eb c4                	jmp    804e5b <__divdi3+0x55>
+
+00804e97 <__moddi3>:
+  804e97:	55                   	push   %ebp
+  804e98:	57                   	push   %edi
+  804e99:	56                   	push   %esi
+  804e9a:	53                   	push   %ebx
+  804e9b:	83 ec 24             	sub    $0x24,%esp
+  804e9e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804ea2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804ea6:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804eaa:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804eae:	85 d2                	test   %edx,%edx
+  804eb0:	78 3b                	js     804eed <__moddi3+0x56>
+  804eb2:	83 ec 04             	sub    $0x4,%esp
+  804eb5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804eb9:	56                   	push   %esi
+  804eba:	89 ce                	mov    %ecx,%esi
+  804ebc:	f7 de                	neg    %esi
+  804ebe:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804ec2:	89 de                	mov    %ebx,%esi
+  804ec4:	83 d6 00             	adc    $0x0,%esi
+  804ec7:	f7 de                	neg    %esi
+  804ec9:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804ecd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ed1:	0f 48 f1             	cmovs  %ecx,%esi
+  804ed4:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804ed9:	53                   	push   %ebx
+  804eda:	56                   	push   %esi
+  804edb:	e8 f7 fd ff ff       	call   804cd7 <udm>
+  804ee0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804ee4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ee8:	83 c4 10             	add    $0x10,%esp
+  804eeb:	eb 47                	jmp    804f34 <__moddi3+0x9d>
+  804eed:	f7 d8                	neg    %eax
+  804eef:	83 d2 00             	adc    $0x0,%edx
+  804ef2:	f7 da                	neg    %edx
+  804ef4:	83 ec 04             	sub    $0x4,%esp
+  804ef7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804efb:	56                   	push   %esi
+  804efc:	89 cf                	mov    %ecx,%edi
+  804efe:	f7 df                	neg    %edi
+  804f00:	89 de                	mov    %ebx,%esi
+  804f02:	83 d6 00             	adc    $0x0,%esi
+  804f05:	f7 de                	neg    %esi
+  804f07:	0f 49 cf             	cmovns %edi,%ecx
+  804f0a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804f0e:	0f 49 de             	cmovns %esi,%ebx
+  804f11:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804f15:	ff 74 24 0c          	push   0xc(%esp)
+  804f19:	ff 74 24 0c          	push   0xc(%esp)
+  804f1d:	e8 b5 fd ff ff       	call   804cd7 <udm>
+  804f22:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804f26:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804f2a:	f7 d8                	neg    %eax
+  804f2c:	83 d2 00             	adc    $0x0,%edx
+  804f2f:	f7 da                	neg    %edx
+  804f31:	83 c4 10             	add    $0x10,%esp
+  804f34:	83 c4 24             	add    $0x24,%esp
+  804f37:	5b                   	pop    %ebx
+  804f38:	5e                   	pop    %esi
+  804f39:	5f                   	pop    %edi
+  804f3a:	5d                   	pop    %ebp
+  804f3b:	c3                   	ret
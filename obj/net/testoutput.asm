@@ -0,0 +1,10075 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ff 02 00 00       	call   800330 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  800038:	e8 3b 0e 00 00       	call   800e78 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  80003f:	c7 05 00 60 80 00 c0 	movl   $0x8049c0,0x806000
+  800046:	49 80 00 
+
+	output_envid = fork();
+  800049:	e8 3e 15 00 00       	call   80158c <fork>
+  80004e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (output_envid < 0)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 80 00 00 00    	js     8000db <umain+0xa8>
+	else if (output_envid == 0) {
+		output(ns_envid);
+		return;
+	}
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800060:	0f 84 89 00 00 00    	je     8000ef <umain+0xbc>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 b0 fe 0f       	push   $0xffeb000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 59 0e 00 00       	call   800ed0 <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 7f                	js     8000fd <umain+0xca>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  80007e:	53                   	push   %ebx
+  80007f:	68 fd 49 80 00       	push   $0x8049fd
+  800084:	68 fc 0f 00 00       	push   $0xffc
+  800089:	68 04 b0 fe 0f       	push   $0xffeb004
+  80008e:	e8 aa 09 00 00       	call   800a3d <snprintf>
+  800093:	a3 00 b0 fe 0f       	mov    %eax,0xffeb000
+				       PGSIZE - sizeof(pkt->jp_len),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  800098:	83 c4 08             	add    $0x8,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	68 09 4a 80 00       	push   $0x804a09
+  8000a1:	e8 08 04 00 00       	call   8004ae <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000a6:	6a 07                	push   $0x7
+  8000a8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000ad:	6a 0b                	push   $0xb
+  8000af:	ff 35 00 70 80 00    	push   0x807000
+  8000b5:	e8 24 1a 00 00       	call   801ade <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000ba:	83 c4 18             	add    $0x18,%esp
+  8000bd:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 a0 0e 00 00       	call   800f69 <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000c9:	83 c3 01             	add    $0x1,%ebx
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 92                	jne    800066 <umain+0x33>
+  8000d4:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8000d9:	eb 39                	jmp    800114 <umain+0xe1>
+		panic("error forking");
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 cb 49 80 00       	push   $0x8049cb
+  8000e3:	6a 16                	push   $0x16
+  8000e5:	68 d9 49 80 00       	push   $0x8049d9
+  8000ea:	e8 e4 02 00 00       	call   8003d3 <_panic>
+		output(ns_envid);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	e8 b0 01 00 00       	call   8002a8 <output>
+		return;
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb 1c                	jmp    800119 <umain+0xe6>
+			panic("sys_page_alloc: %e", r);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 ea 49 80 00       	push   $0x8049ea
+  800103:	6a 1e                	push   $0x1e
+  800105:	68 d9 49 80 00       	push   $0x8049d9
+  80010a:	e8 c4 02 00 00       	call   8003d3 <_panic>
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  80010f:	e8 90 0d 00 00       	call   800ea4 <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  800114:	83 eb 01             	sub    $0x1,%ebx
+  800117:	75 f6                	jne    80010f <umain+0xdc>
+}
+  800119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 1c             	sub    $0x1c,%esp
+  800129:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  80012c:	e8 2c 10 00 00       	call   80115d <sys_time_msec>
+  800131:	03 45 0c             	add    0xc(%ebp),%eax
+  800134:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800136:	c7 05 00 60 80 00 21 	movl   $0x804a21,0x806000
+  80013d:	4a 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800140:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800143:	eb 05                	jmp    80014a <timer+0x2a>
+			sys_yield();
+  800145:	e8 5a 0d 00 00       	call   800ea4 <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  80014a:	e8 0e 10 00 00       	call   80115d <sys_time_msec>
+  80014f:	39 d8                	cmp    %ebx,%eax
+  800151:	73 16                	jae    800169 <timer+0x49>
+  800153:	85 c0                	test   %eax,%eax
+  800155:	79 ee                	jns    800145 <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  800157:	50                   	push   %eax
+  800158:	68 2a 4a 80 00       	push   $0x804a2a
+  80015d:	6a 0f                	push   $0xf
+  80015f:	68 3c 4a 80 00       	push   $0x804a3c
+  800164:	e8 6a 02 00 00       	call   8003d3 <_panic>
+		if (r < 0)
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	78 ea                	js     800157 <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  80016d:	6a 00                	push   $0x0
+  80016f:	6a 00                	push   $0x0
+  800171:	6a 0c                	push   $0xc
+  800173:	56                   	push   %esi
+  800174:	e8 65 19 00 00       	call   801ade <ipc_send>
+  800179:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	6a 00                	push   $0x0
+  800183:	57                   	push   %edi
+  800184:	e8 5f 18 00 00       	call   8019e8 <ipc_recv>
+  800189:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  80018b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	39 f0                	cmp    %esi,%eax
+  800193:	75 09                	jne    80019e <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  800195:	e8 c3 0f 00 00       	call   80115d <sys_time_msec>
+  80019a:	01 c3                	add    %eax,%ebx
+			break;
+  80019c:	eb ac                	jmp    80014a <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	50                   	push   %eax
+  8001a2:	68 48 4a 80 00       	push   $0x804a48
+  8001a7:	e8 02 03 00 00       	call   8004ae <cprintf>
+				continue;
+  8001ac:	83 c4 10             	add    $0x10,%esp
+  8001af:	eb cb                	jmp    80017c <timer+0x5c>
+
+008001b1 <sleep>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void sleep(int ms)
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	56                   	push   %esi
+  8001b5:	53                   	push   %ebx
+  8001b6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int now;
+	now = sys_time_msec();
+  8001b9:	e8 9f 0f 00 00       	call   80115d <sys_time_msec>
+  8001be:	89 c3                	mov    %eax,%ebx
+	assert(now > 0);
+  8001c0:	85 c0                	test   %eax,%eax
+  8001c2:	7f 1b                	jg     8001df <sleep+0x2e>
+  8001c4:	68 83 4a 80 00       	push   $0x804a83
+  8001c9:	68 8b 4a 80 00       	push   $0x804a8b
+  8001ce:	6a 09                	push   $0x9
+  8001d0:	68 a0 4a 80 00       	push   $0x804aa0
+  8001d5:	e8 f9 01 00 00       	call   8003d3 <_panic>
+	while ((sys_time_msec() - now) < ms) {
+		sys_yield();
+  8001da:	e8 c5 0c 00 00       	call   800ea4 <sys_yield>
+	while ((sys_time_msec() - now) < ms) {
+  8001df:	e8 79 0f 00 00       	call   80115d <sys_time_msec>
+  8001e4:	29 d8                	sub    %ebx,%eax
+  8001e6:	39 f0                	cmp    %esi,%eax
+  8001e8:	72 f0                	jb     8001da <sleep+0x29>
+	}
+}
+  8001ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ed:	5b                   	pop    %ebx
+  8001ee:	5e                   	pop    %esi
+  8001ef:	5d                   	pop    %ebp
+  8001f0:	c3                   	ret
+
+008001f1 <input>:
+
+void
+input(envid_t ns_envid)
+{
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	57                   	push   %edi
+  8001f5:	56                   	push   %esi
+  8001f6:	53                   	push   %ebx
+  8001f7:	83 ec 10             	sub    $0x10,%esp
+  8001fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+	binaryname = "ns_input";
+  8001fd:	c7 05 00 60 80 00 ac 	movl   $0x804aac,0x806000
+  800204:	4a 80 00 
+	// Hint: When you IPC a page to the network server, it will be
+	// reading from it for a while, so don't immediately receive
+	// another packet in to the same physical page.
+
+	// pre-copy before write to avoid page fault in kernel
+	sys_page_alloc(0, &nsipcbuf, PTE_P | PTE_U | PTE_W);
+  800207:	6a 07                	push   $0x7
+  800209:	68 00 90 80 00       	push   $0x809000
+  80020e:	6a 00                	push   $0x0
+  800210:	e8 bb 0c 00 00       	call   800ed0 <sys_page_alloc>
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	e9 81 00 00 00       	jmp    80029e <input+0xad>
+	while (1) {
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+			// cprintf("jp_data %p, uvpt %x\n", nsipcbuf.pkt.jp_data, uvpt[PGNUM(&nsipcbuf)]);
+			recv_len = sys_net_try_recv((uint8_t*)nsipcbuf.pkt.jp_data, sizeof(nsipcbuf));
+			if (recv_len == -E_FULL_BUFFER) {
+				sys_yield();
+  80021d:	e8 82 0c 00 00       	call   800ea4 <sys_yield>
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  800222:	83 ee 01             	sub    $0x1,%esi
+  800225:	74 4e                	je     800275 <input+0x84>
+			recv_len = sys_net_try_recv((uint8_t*)nsipcbuf.pkt.jp_data, sizeof(nsipcbuf));
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	68 00 10 00 00       	push   $0x1000
+  80022f:	68 04 90 80 00       	push   $0x809004
+  800234:	e8 7e 0f 00 00       	call   8011b7 <sys_net_try_recv>
+  800239:	89 c3                	mov    %eax,%ebx
+			if (recv_len == -E_FULL_BUFFER) {
+  80023b:	83 c4 10             	add    $0x10,%esp
+  80023e:	83 f8 ef             	cmp    $0xffffffef,%eax
+  800241:	74 da                	je     80021d <input+0x2c>
+				continue;
+			} else	if (recv_len >= 0) {
+  800243:	85 c0                	test   %eax,%eax
+  800245:	79 1d                	jns    800264 <input+0x73>
+				cprintf("receive , len = %d\n", recv_len);
+				break;
+			}
+			else {
+				cprintf("recv failed, %e", recv_len);
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	50                   	push   %eax
+  80024b:	68 c9 4a 80 00       	push   $0x804ac9
+  800250:	e8 59 02 00 00       	call   8004ae <cprintf>
+				nsipcbuf.pkt.jp_len = 0;
+  800255:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80025c:	00 00 00 
+  80025f:	83 c4 10             	add    $0x10,%esp
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  800262:	eb be                	jmp    800222 <input+0x31>
+				cprintf("receive , len = %d\n", recv_len);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	50                   	push   %eax
+  800268:	68 b5 4a 80 00       	push   $0x804ab5
+  80026d:	e8 3c 02 00 00       	call   8004ae <cprintf>
+				break;
+  800272:	83 c4 10             	add    $0x10,%esp
+			}
+		}
+		if (recv_len > 0) {
+  800275:	85 db                	test   %ebx,%ebx
+  800277:	7e 18                	jle    800291 <input+0xa0>
+			nsipcbuf.pkt.jp_len = recv_len;
+  800279:	89 1d 00 90 80 00    	mov    %ebx,0x809000
+			ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, PTE_P | PTE_U | PTE_W);
+  80027f:	6a 07                	push   $0x7
+  800281:	68 00 90 80 00       	push   $0x809000
+  800286:	6a 0a                	push   $0xa
+  800288:	57                   	push   %edi
+  800289:	e8 50 18 00 00       	call   801ade <ipc_send>
+  80028e:	83 c4 10             	add    $0x10,%esp
+		}
+		sleep(50);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	6a 32                	push   $0x32
+  800296:	e8 16 ff ff ff       	call   8001b1 <sleep>
+		for (int i = 0; i < RECV_RETRY_TIME; i++) {
+  80029b:	83 c4 10             	add    $0x10,%esp
+  80029e:	be 65 00 00 00       	mov    $0x65,%esi
+  8002a3:	e9 7a ff ff ff       	jmp    800222 <input+0x31>
+
+008002a8 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	57                   	push   %edi
+  8002ac:	56                   	push   %esi
+  8002ad:	53                   	push   %ebx
+  8002ae:	83 ec 1c             	sub    $0x1c,%esp
+  8002b1:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_output";
+  8002b4:	c7 05 00 60 80 00 d9 	movl   $0x804ad9,0x806000
+  8002bb:	4a 80 00 
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	while (1) {
+		envid_t from;
+		int rsq, r;
+		rsq = ipc_recv(&from, (void*)&nsipcbuf, NULL);
+  8002be:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  8002c1:	eb 14                	jmp    8002d7 <output+0x2f>
+		if (rsq != NSREQ_OUTPUT || from != ns_envid) {
+			cprintf("rsq is %x, from is %x\n", rsq, from);
+  8002c3:	83 ec 04             	sub    $0x4,%esp
+  8002c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c9:	50                   	push   %eax
+  8002ca:	68 e3 4a 80 00       	push   $0x804ae3
+  8002cf:	e8 da 01 00 00       	call   8004ae <cprintf>
+  8002d4:	83 c4 10             	add    $0x10,%esp
+		rsq = ipc_recv(&from, (void*)&nsipcbuf, NULL);
+  8002d7:	83 ec 04             	sub    $0x4,%esp
+  8002da:	6a 00                	push   $0x0
+  8002dc:	68 00 90 80 00       	push   $0x809000
+  8002e1:	53                   	push   %ebx
+  8002e2:	e8 01 17 00 00       	call   8019e8 <ipc_recv>
+		if (rsq != NSREQ_OUTPUT || from != ns_envid) {
+  8002e7:	83 c4 10             	add    $0x10,%esp
+  8002ea:	83 f8 0b             	cmp    $0xb,%eax
+  8002ed:	75 d4                	jne    8002c3 <output+0x1b>
+  8002ef:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8002f2:	75 cf                	jne    8002c3 <output+0x1b>
+  8002f4:	bf 65 00 00 00       	mov    $0x65,%edi
+			continue;
+		}
+		int cnt = SEND_RETRY_TIME;
+		while (cnt && (r = sys_net_try_send((const uint8_t*)&nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) < 0) {
+  8002f9:	83 ef 01             	sub    $0x1,%edi
+  8002fc:	74 d9                	je     8002d7 <output+0x2f>
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	ff 35 00 90 80 00    	push   0x809000
+  800307:	68 04 90 80 00       	push   $0x809004
+  80030c:	e8 78 0e 00 00       	call   801189 <sys_net_try_send>
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	85 c0                	test   %eax,%eax
+  800316:	79 bf                	jns    8002d7 <output+0x2f>
+			if (r == -E_FULL_BUFFER) {
+  800318:	83 f8 ef             	cmp    $0xffffffef,%eax
+  80031b:	74 dc                	je     8002f9 <output+0x51>
+				--cnt;
+			}
+			else {
+				cprintf("pkg send failed, %e\n", r);
+  80031d:	83 ec 08             	sub    $0x8,%esp
+  800320:	50                   	push   %eax
+  800321:	68 fa 4a 80 00       	push   $0x804afa
+  800326:	e8 83 01 00 00       	call   8004ae <cprintf>
+				break;
+  80032b:	83 c4 10             	add    $0x10,%esp
+  80032e:	eb a7                	jmp    8002d7 <output+0x2f>
+
+00800330 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800330:	55                   	push   %ebp
+  800331:	89 e5                	mov    %esp,%ebp
+  800333:	57                   	push   %edi
+  800334:	56                   	push   %esi
+  800335:	53                   	push   %ebx
+  800336:	83 ec 1c             	sub    $0x1c,%esp
+  800339:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80033c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80033f:	e8 34 0b 00 00       	call   800e78 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800344:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800347:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  80034d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800352:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800354:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800356:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80035c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800361:	77 16                	ja     800379 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800363:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800368:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80036a:	c1 e8 10             	shr    $0x10,%eax
+  80036d:	74 0a                	je     800379 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80036f:	c1 e0 10             	shl    $0x10,%eax
+  800372:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800377:	29 c2                	sub    %eax,%edx
+  800379:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80037c:	c1 e0 04             	shl    $0x4,%eax
+  80037f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800384:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800386:	85 db                	test   %ebx,%ebx
+  800388:	7e 07                	jle    800391 <libmain+0x61>
+		binaryname = argv[0];
+  80038a:	8b 06                	mov    (%esi),%eax
+  80038c:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800391:	83 ec 08             	sub    $0x8,%esp
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+  800396:	e8 98 fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80039b:	e8 0b 00 00 00       	call   8003ab <exit>
+}
+  8003a0:	83 c4 10             	add    $0x10,%esp
+  8003a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a6:	5b                   	pop    %ebx
+  8003a7:	5e                   	pop    %esi
+  8003a8:	5f                   	pop    %edi
+  8003a9:	5d                   	pop    %ebp
+  8003aa:	c3                   	ret
+
+008003ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8003b1:	6a 00                	push   $0x0
+  8003b3:	e8 16 29 00 00       	call   802cce <fflush>
+	pthread_kill_others();
+  8003b8:	e8 81 3f 00 00       	call   80433e <pthread_kill_others>
+	close_all();
+  8003bd:	e8 af 19 00 00       	call   801d71 <close_all>
+	sys_env_destroy(0);
+  8003c2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8003c9:	e8 5f 0a 00 00       	call   800e2d <sys_env_destroy>
+}
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	c9                   	leave
+  8003d2:	c3                   	ret
+
+008003d3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	56                   	push   %esi
+  8003d7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003d8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003db:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8003e1:	e8 92 0a 00 00       	call   800e78 <sys_getenvid>
+  8003e6:	83 ec 0c             	sub    $0xc,%esp
+  8003e9:	ff 75 0c             	push   0xc(%ebp)
+  8003ec:	ff 75 08             	push   0x8(%ebp)
+  8003ef:	56                   	push   %esi
+  8003f0:	50                   	push   %eax
+  8003f1:	68 1c 4b 80 00       	push   $0x804b1c
+  8003f6:	e8 b3 00 00 00       	call   8004ae <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003fb:	83 c4 18             	add    $0x18,%esp
+  8003fe:	53                   	push   %ebx
+  8003ff:	ff 75 10             	push   0x10(%ebp)
+  800402:	e8 56 00 00 00       	call   80045d <vcprintf>
+	cprintf("\n");
+  800407:	c7 04 24 1a 50 80 00 	movl   $0x80501a,(%esp)
+  80040e:	e8 9b 00 00 00       	call   8004ae <cprintf>
+  800413:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800416:	cc                   	int3
+	while (1)
+  800417:	eb fd                	jmp    800416 <_panic+0x43>
+
+00800419 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800423:	8b 13                	mov    (%ebx),%edx
+  800425:	8d 42 01             	lea    0x1(%edx),%eax
+  800428:	89 03                	mov    %eax,(%ebx)
+  80042a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80042d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800431:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800436:	74 09                	je     800441 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800438:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80043c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80043f:	c9                   	leave
+  800440:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800441:	83 ec 08             	sub    $0x8,%esp
+  800444:	68 ff 00 00 00       	push   $0xff
+  800449:	8d 43 08             	lea    0x8(%ebx),%eax
+  80044c:	50                   	push   %eax
+  80044d:	e8 84 09 00 00       	call   800dd6 <sys_cputs>
+		b->idx = 0;
+  800452:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800458:	83 c4 10             	add    $0x10,%esp
+  80045b:	eb db                	jmp    800438 <putch+0x1f>
+
+0080045d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800466:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80046d:	00 00 00 
+	b.cnt = 0;
+  800470:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800477:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80047a:	ff 75 0c             	push   0xc(%ebp)
+  80047d:	ff 75 08             	push   0x8(%ebp)
+  800480:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800486:	50                   	push   %eax
+  800487:	68 19 04 80 00       	push   $0x800419
+  80048c:	e8 14 01 00 00       	call   8005a5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800491:	83 c4 08             	add    $0x8,%esp
+  800494:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80049a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004a0:	50                   	push   %eax
+  8004a1:	e8 30 09 00 00       	call   800dd6 <sys_cputs>
+
+	return b.cnt;
+}
+  8004a6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004ac:	c9                   	leave
+  8004ad:	c3                   	ret
+
+008004ae <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ae:	55                   	push   %ebp
+  8004af:	89 e5                	mov    %esp,%ebp
+  8004b1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004b4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004b7:	50                   	push   %eax
+  8004b8:	ff 75 08             	push   0x8(%ebp)
+  8004bb:	e8 9d ff ff ff       	call   80045d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+
+008004c2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	57                   	push   %edi
+  8004c6:	56                   	push   %esi
+  8004c7:	53                   	push   %ebx
+  8004c8:	83 ec 1c             	sub    $0x1c,%esp
+  8004cb:	89 c7                	mov    %eax,%edi
+  8004cd:	89 d6                	mov    %edx,%esi
+  8004cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d5:	89 d1                	mov    %edx,%ecx
+  8004d7:	89 c2                	mov    %eax,%edx
+  8004d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004df:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004e2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ef:	39 c2                	cmp    %eax,%edx
+  8004f1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004f4:	72 3e                	jb     800534 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004f6:	83 ec 0c             	sub    $0xc,%esp
+  8004f9:	ff 75 18             	push   0x18(%ebp)
+  8004fc:	83 eb 01             	sub    $0x1,%ebx
+  8004ff:	53                   	push   %ebx
+  800500:	50                   	push   %eax
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	ff 75 e4             	push   -0x1c(%ebp)
+  800507:	ff 75 e0             	push   -0x20(%ebp)
+  80050a:	ff 75 dc             	push   -0x24(%ebp)
+  80050d:	ff 75 d8             	push   -0x28(%ebp)
+  800510:	e8 21 43 00 00       	call   804836 <__udivdi3>
+  800515:	83 c4 18             	add    $0x18,%esp
+  800518:	52                   	push   %edx
+  800519:	50                   	push   %eax
+  80051a:	89 f2                	mov    %esi,%edx
+  80051c:	89 f8                	mov    %edi,%eax
+  80051e:	e8 9f ff ff ff       	call   8004c2 <printnum>
+  800523:	83 c4 20             	add    $0x20,%esp
+  800526:	eb 13                	jmp    80053b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	56                   	push   %esi
+  80052c:	ff 75 18             	push   0x18(%ebp)
+  80052f:	ff d7                	call   *%edi
+  800531:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800534:	83 eb 01             	sub    $0x1,%ebx
+  800537:	85 db                	test   %ebx,%ebx
+  800539:	7f ed                	jg     800528 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	56                   	push   %esi
+  80053f:	83 ec 04             	sub    $0x4,%esp
+  800542:	ff 75 e4             	push   -0x1c(%ebp)
+  800545:	ff 75 e0             	push   -0x20(%ebp)
+  800548:	ff 75 dc             	push   -0x24(%ebp)
+  80054b:	ff 75 d8             	push   -0x28(%ebp)
+  80054e:	e8 04 43 00 00       	call   804857 <__umoddi3>
+  800553:	83 c4 14             	add    $0x14,%esp
+  800556:	0f be 80 3f 4b 80 00 	movsbl 0x804b3f(%eax),%eax
+  80055d:	50                   	push   %eax
+  80055e:	ff d7                	call   *%edi
+}
+  800560:	83 c4 10             	add    $0x10,%esp
+  800563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800566:	5b                   	pop    %ebx
+  800567:	5e                   	pop    %esi
+  800568:	5f                   	pop    %edi
+  800569:	5d                   	pop    %ebp
+  80056a:	c3                   	ret
+
+0080056b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80056b:	55                   	push   %ebp
+  80056c:	89 e5                	mov    %esp,%ebp
+  80056e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800571:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800575:	8b 10                	mov    (%eax),%edx
+  800577:	3b 50 04             	cmp    0x4(%eax),%edx
+  80057a:	73 0a                	jae    800586 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80057c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80057f:	89 08                	mov    %ecx,(%eax)
+  800581:	8b 45 08             	mov    0x8(%ebp),%eax
+  800584:	88 02                	mov    %al,(%edx)
+}
+  800586:	5d                   	pop    %ebp
+  800587:	c3                   	ret
+
+00800588 <printfmt>:
+{
+  800588:	55                   	push   %ebp
+  800589:	89 e5                	mov    %esp,%ebp
+  80058b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80058e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800591:	50                   	push   %eax
+  800592:	ff 75 10             	push   0x10(%ebp)
+  800595:	ff 75 0c             	push   0xc(%ebp)
+  800598:	ff 75 08             	push   0x8(%ebp)
+  80059b:	e8 05 00 00 00       	call   8005a5 <vprintfmt>
+}
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	c9                   	leave
+  8005a4:	c3                   	ret
+
+008005a5 <vprintfmt>:
+{
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+  8005a8:	57                   	push   %edi
+  8005a9:	56                   	push   %esi
+  8005aa:	53                   	push   %ebx
+  8005ab:	83 ec 2c             	sub    $0x2c,%esp
+  8005ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005b7:	eb 0a                	jmp    8005c3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005b9:	83 ec 08             	sub    $0x8,%esp
+  8005bc:	53                   	push   %ebx
+  8005bd:	50                   	push   %eax
+  8005be:	ff d6                	call   *%esi
+  8005c0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8005c3:	83 c7 01             	add    $0x1,%edi
+  8005c6:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8005ca:	83 f8 25             	cmp    $0x25,%eax
+  8005cd:	74 0c                	je     8005db <vprintfmt+0x36>
+			if (ch == '\0')
+  8005cf:	85 c0                	test   %eax,%eax
+  8005d1:	75 e6                	jne    8005b9 <vprintfmt+0x14>
+}
+  8005d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d6:	5b                   	pop    %ebx
+  8005d7:	5e                   	pop    %esi
+  8005d8:	5f                   	pop    %edi
+  8005d9:	5d                   	pop    %ebp
+  8005da:	c3                   	ret
+		padc = ' ';
+  8005db:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005df:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005e6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005ed:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8005f9:	8d 47 01             	lea    0x1(%edi),%eax
+  8005fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005ff:	0f b6 17             	movzbl (%edi),%edx
+  800602:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800605:	3c 55                	cmp    $0x55,%al
+  800607:	0f 87 c5 03 00 00    	ja     8009d2 <vprintfmt+0x42d>
+  80060d:	0f b6 c0             	movzbl %al,%eax
+  800610:	ff 24 85 c0 4c 80 00 	jmp    *0x804cc0(,%eax,4)
+  800617:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80061a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80061d:	eb da                	jmp    8005f9 <vprintfmt+0x54>
+  80061f:	0f be d2             	movsbl %dl,%edx
+  800622:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80062d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800630:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800634:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800637:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80063a:	83 f9 09             	cmp    $0x9,%ecx
+  80063d:	77 55                	ja     800694 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80063f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800642:	eb e9                	jmp    80062d <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 00                	mov    (%eax),%eax
+  800649:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800655:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800658:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80065c:	79 9b                	jns    8005f9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80065e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800661:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800664:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80066b:	eb 8c                	jmp    8005f9 <vprintfmt+0x54>
+			if (width < 0)
+  80066d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800670:	85 d2                	test   %edx,%edx
+  800672:	b8 00 00 00 00       	mov    $0x0,%eax
+  800677:	0f 49 c2             	cmovns %edx,%eax
+  80067a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80067d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800680:	e9 74 ff ff ff       	jmp    8005f9 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800685:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800688:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80068f:	e9 65 ff ff ff       	jmp    8005f9 <vprintfmt+0x54>
+  800694:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800697:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80069a:	eb bc                	jmp    800658 <vprintfmt+0xb3>
+			lflag++;
+  80069c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80069f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006a2:	e9 52 ff ff ff       	jmp    8005f9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8d 78 04             	lea    0x4(%eax),%edi
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	ff 30                	push   (%eax)
+  8006b3:	ff d6                	call   *%esi
+			break;
+  8006b5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006b8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006bb:	e9 b1 02 00 00       	jmp    800971 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	89 d0                	mov    %edx,%eax
+  8006ca:	f7 d8                	neg    %eax
+  8006cc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006cf:	83 f8 14             	cmp    $0x14,%eax
+  8006d2:	7f 23                	jg     8006f7 <vprintfmt+0x152>
+  8006d4:	8b 14 85 20 4e 80 00 	mov    0x804e20(,%eax,4),%edx
+  8006db:	85 d2                	test   %edx,%edx
+  8006dd:	74 18                	je     8006f7 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8006df:	52                   	push   %edx
+  8006e0:	68 9d 4a 80 00       	push   $0x804a9d
+  8006e5:	53                   	push   %ebx
+  8006e6:	56                   	push   %esi
+  8006e7:	e8 9c fe ff ff       	call   800588 <printfmt>
+  8006ec:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006f2:	e9 7a 02 00 00       	jmp    800971 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8006f7:	50                   	push   %eax
+  8006f8:	68 57 4b 80 00       	push   $0x804b57
+  8006fd:	53                   	push   %ebx
+  8006fe:	56                   	push   %esi
+  8006ff:	e8 84 fe ff ff       	call   800588 <printfmt>
+  800704:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800707:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80070a:	e9 62 02 00 00       	jmp    800971 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	83 c0 04             	add    $0x4,%eax
+  800715:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	b8 50 4b 80 00       	mov    $0x804b50,%eax
+  800724:	0f 45 c1             	cmovne %ecx,%eax
+  800727:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80072a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80072e:	7e 06                	jle    800736 <vprintfmt+0x191>
+  800730:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800734:	75 0b                	jne    800741 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800736:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800739:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80073c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80073f:	eb 5c                	jmp    80079d <vprintfmt+0x1f8>
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	ff 75 d0             	push   -0x30(%ebp)
+  800747:	ff 75 cc             	push   -0x34(%ebp)
+  80074a:	e8 20 03 00 00       	call   800a6f <strnlen>
+  80074f:	89 c2                	mov    %eax,%edx
+  800751:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800754:	29 d0                	sub    %edx,%eax
+  800756:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800759:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80075d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800760:	89 75 08             	mov    %esi,0x8(%ebp)
+  800763:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800765:	eb 0e                	jmp    800775 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	57                   	push   %edi
+  80076c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076f:	83 ee 01             	sub    $0x1,%esi
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	85 f6                	test   %esi,%esi
+  800777:	7f ee                	jg     800767 <vprintfmt+0x1c2>
+  800779:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	ba 00 00 00 00       	mov    $0x0,%edx
+  800786:	0f 49 d0             	cmovns %eax,%edx
+  800789:	29 d0                	sub    %edx,%eax
+  80078b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078e:	eb a6                	jmp    800736 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	52                   	push   %edx
+  800795:	ff 55 08             	call   *0x8(%ebp)
+  800798:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80079b:	89 f1                	mov    %esi,%ecx
+  80079d:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007a0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007a4:	0f be d0             	movsbl %al,%edx
+  8007a7:	85 d2                	test   %edx,%edx
+  8007a9:	74 28                	je     8007d3 <vprintfmt+0x22e>
+  8007ab:	85 ff                	test   %edi,%edi
+  8007ad:	78 05                	js     8007b4 <vprintfmt+0x20f>
+  8007af:	83 ef 01             	sub    $0x1,%edi
+  8007b2:	78 30                	js     8007e4 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007b4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007b8:	74 d6                	je     800790 <vprintfmt+0x1eb>
+  8007ba:	0f be c0             	movsbl %al,%eax
+  8007bd:	83 e8 20             	sub    $0x20,%eax
+  8007c0:	83 f8 5e             	cmp    $0x5e,%eax
+  8007c3:	76 cb                	jbe    800790 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	53                   	push   %ebx
+  8007c9:	6a 3f                	push   $0x3f
+  8007cb:	ff 55 08             	call   *0x8(%ebp)
+  8007ce:	83 c4 10             	add    $0x10,%esp
+  8007d1:	eb c8                	jmp    80079b <vprintfmt+0x1f6>
+  8007d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007dc:	01 d0                	add    %edx,%eax
+  8007de:	29 c8                	sub    %ecx,%eax
+  8007e0:	89 c7                	mov    %eax,%edi
+  8007e2:	eb 13                	jmp    8007f7 <vprintfmt+0x252>
+  8007e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e7:	eb ed                	jmp    8007d6 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+  8007ec:	53                   	push   %ebx
+  8007ed:	6a 20                	push   $0x20
+  8007ef:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007f1:	83 ef 01             	sub    $0x1,%edi
+  8007f4:	83 c4 10             	add    $0x10,%esp
+  8007f7:	85 ff                	test   %edi,%edi
+  8007f9:	7f ee                	jg     8007e9 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007fb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800801:	e9 6b 01 00 00       	jmp    800971 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800806:	83 f9 01             	cmp    $0x1,%ecx
+  800809:	7f 1f                	jg     80082a <vprintfmt+0x285>
+	else if (lflag)
+  80080b:	85 c9                	test   %ecx,%ecx
+  80080d:	74 67                	je     800876 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 00                	mov    (%eax),%eax
+  800814:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800817:	89 c1                	mov    %eax,%ecx
+  800819:	c1 f9 1f             	sar    $0x1f,%ecx
+  80081c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+  800828:	eb 17                	jmp    800841 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 50 04             	mov    0x4(%eax),%edx
+  800830:	8b 00                	mov    (%eax),%eax
+  800832:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800835:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8d 40 08             	lea    0x8(%eax),%eax
+  80083e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800841:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800844:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800847:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80084c:	85 c9                	test   %ecx,%ecx
+  80084e:	0f 89 03 01 00 00    	jns    800957 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	53                   	push   %ebx
+  800858:	6a 2d                	push   $0x2d
+  80085a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80085c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80085f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800862:	f7 da                	neg    %edx
+  800864:	83 d1 00             	adc    $0x0,%ecx
+  800867:	f7 d9                	neg    %ecx
+  800869:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80086c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800871:	e9 e1 00 00 00       	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 00                	mov    (%eax),%eax
+  80087b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80087e:	89 c1                	mov    %eax,%ecx
+  800880:	c1 f9 1f             	sar    $0x1f,%ecx
+  800883:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	eb b0                	jmp    800841 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800891:	83 f9 01             	cmp    $0x1,%ecx
+  800894:	7f 1e                	jg     8008b4 <vprintfmt+0x30f>
+	else if (lflag)
+  800896:	85 c9                	test   %ecx,%ecx
+  800898:	74 32                	je     8008cc <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80089a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089d:	8b 10                	mov    (%eax),%edx
+  80089f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008af:	e9 a3 00 00 00       	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b7:	8b 10                	mov    (%eax),%edx
+  8008b9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008bc:	8d 40 08             	lea    0x8(%eax),%eax
+  8008bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008c7:	e9 8b 00 00 00       	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cf:	8b 10                	mov    (%eax),%edx
+  8008d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008e1:	eb 74                	jmp    800957 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8008e3:	83 f9 01             	cmp    $0x1,%ecx
+  8008e6:	7f 1b                	jg     800903 <vprintfmt+0x35e>
+	else if (lflag)
+  8008e8:	85 c9                	test   %ecx,%ecx
+  8008ea:	74 2c                	je     800918 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 10                	mov    (%eax),%edx
+  8008f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008fc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800901:	eb 54                	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800903:	8b 45 14             	mov    0x14(%ebp),%eax
+  800906:	8b 10                	mov    (%eax),%edx
+  800908:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090b:	8d 40 08             	lea    0x8(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800911:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800916:	eb 3f                	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8b 10                	mov    (%eax),%edx
+  80091d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800922:	8d 40 04             	lea    0x4(%eax),%eax
+  800925:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800928:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80092d:	eb 28                	jmp    800957 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80092f:	83 ec 08             	sub    $0x8,%esp
+  800932:	53                   	push   %ebx
+  800933:	6a 30                	push   $0x30
+  800935:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800937:	83 c4 08             	add    $0x8,%esp
+  80093a:	53                   	push   %ebx
+  80093b:	6a 78                	push   $0x78
+  80093d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80093f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800942:	8b 10                	mov    (%eax),%edx
+  800944:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800949:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800952:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800957:	83 ec 0c             	sub    $0xc,%esp
+  80095a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80095e:	50                   	push   %eax
+  80095f:	ff 75 e0             	push   -0x20(%ebp)
+  800962:	57                   	push   %edi
+  800963:	51                   	push   %ecx
+  800964:	52                   	push   %edx
+  800965:	89 da                	mov    %ebx,%edx
+  800967:	89 f0                	mov    %esi,%eax
+  800969:	e8 54 fb ff ff       	call   8004c2 <printnum>
+			break;
+  80096e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800971:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800974:	e9 4a fc ff ff       	jmp    8005c3 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800979:	83 f9 01             	cmp    $0x1,%ecx
+  80097c:	7f 1b                	jg     800999 <vprintfmt+0x3f4>
+	else if (lflag)
+  80097e:	85 c9                	test   %ecx,%ecx
+  800980:	74 2c                	je     8009ae <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800982:	8b 45 14             	mov    0x14(%ebp),%eax
+  800985:	8b 10                	mov    (%eax),%edx
+  800987:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80098c:	8d 40 04             	lea    0x4(%eax),%eax
+  80098f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800992:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800997:	eb be                	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8b 10                	mov    (%eax),%edx
+  80099e:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8009a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009ac:	eb a9                	jmp    800957 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8009ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b1:	8b 10                	mov    (%eax),%edx
+  8009b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009be:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009c3:	eb 92                	jmp    800957 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8009c5:	83 ec 08             	sub    $0x8,%esp
+  8009c8:	53                   	push   %ebx
+  8009c9:	6a 25                	push   $0x25
+  8009cb:	ff d6                	call   *%esi
+			break;
+  8009cd:	83 c4 10             	add    $0x10,%esp
+  8009d0:	eb 9f                	jmp    800971 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8009d2:	83 ec 08             	sub    $0x8,%esp
+  8009d5:	53                   	push   %ebx
+  8009d6:	6a 25                	push   $0x25
+  8009d8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009da:	83 c4 10             	add    $0x10,%esp
+  8009dd:	89 f8                	mov    %edi,%eax
+  8009df:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009e3:	74 05                	je     8009ea <vprintfmt+0x445>
+  8009e5:	83 e8 01             	sub    $0x1,%eax
+  8009e8:	eb f5                	jmp    8009df <vprintfmt+0x43a>
+  8009ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009ed:	eb 82                	jmp    800971 <vprintfmt+0x3cc>
+
+008009ef <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009ef:	55                   	push   %ebp
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	83 ec 18             	sub    $0x18,%esp
+  8009f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009fe:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a02:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a05:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a0c:	85 c0                	test   %eax,%eax
+  800a0e:	74 26                	je     800a36 <vsnprintf+0x47>
+  800a10:	85 d2                	test   %edx,%edx
+  800a12:	7e 22                	jle    800a36 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a14:	ff 75 14             	push   0x14(%ebp)
+  800a17:	ff 75 10             	push   0x10(%ebp)
+  800a1a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a1d:	50                   	push   %eax
+  800a1e:	68 6b 05 80 00       	push   $0x80056b
+  800a23:	e8 7d fb ff ff       	call   8005a5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a28:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a2b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a31:	83 c4 10             	add    $0x10,%esp
+}
+  800a34:	c9                   	leave
+  800a35:	c3                   	ret
+		return -E_INVAL;
+  800a36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a3b:	eb f7                	jmp    800a34 <vsnprintf+0x45>
+
+00800a3d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a43:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a46:	50                   	push   %eax
+  800a47:	ff 75 10             	push   0x10(%ebp)
+  800a4a:	ff 75 0c             	push   0xc(%ebp)
+  800a4d:	ff 75 08             	push   0x8(%ebp)
+  800a50:	e8 9a ff ff ff       	call   8009ef <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a55:	c9                   	leave
+  800a56:	c3                   	ret
+
+00800a57 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	eb 03                	jmp    800a67 <strlen+0x10>
+		n++;
+  800a64:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a67:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a6b:	75 f7                	jne    800a64 <strlen+0xd>
+	return n;
+}
+  800a6d:	5d                   	pop    %ebp
+  800a6e:	c3                   	ret
+
+00800a6f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	eb 03                	jmp    800a82 <strnlen+0x13>
+		n++;
+  800a7f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a82:	39 d0                	cmp    %edx,%eax
+  800a84:	74 08                	je     800a8e <strnlen+0x1f>
+  800a86:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a8a:	75 f3                	jne    800a7f <strnlen+0x10>
+  800a8c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a8e:	89 d0                	mov    %edx,%eax
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	53                   	push   %ebx
+  800a96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800aa5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800aa8:	83 c0 01             	add    $0x1,%eax
+  800aab:	84 d2                	test   %dl,%dl
+  800aad:	75 f2                	jne    800aa1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800aaf:	89 c8                	mov    %ecx,%eax
+  800ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+
+00800ab6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	53                   	push   %ebx
+  800aba:	83 ec 10             	sub    $0x10,%esp
+  800abd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ac0:	53                   	push   %ebx
+  800ac1:	e8 91 ff ff ff       	call   800a57 <strlen>
+  800ac6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ac9:	ff 75 0c             	push   0xc(%ebp)
+  800acc:	01 d8                	add    %ebx,%eax
+  800ace:	50                   	push   %eax
+  800acf:	e8 be ff ff ff       	call   800a92 <strcpy>
+	return dst;
+}
+  800ad4:	89 d8                	mov    %ebx,%eax
+  800ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad9:	c9                   	leave
+  800ada:	c3                   	ret
+
+00800adb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	56                   	push   %esi
+  800adf:	53                   	push   %ebx
+  800ae0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ae6:	89 f3                	mov    %esi,%ebx
+  800ae8:	03 5d 10             	add    0x10(%ebp),%ebx
+  800aeb:	89 f0                	mov    %esi,%eax
+  800aed:	eb 0f                	jmp    800afe <strncpy+0x23>
+		*dst++ = *src;
+  800aef:	83 c0 01             	add    $0x1,%eax
+  800af2:	0f b6 0a             	movzbl (%edx),%ecx
+  800af5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800af8:	80 f9 01             	cmp    $0x1,%cl
+  800afb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800afe:	39 d8                	cmp    %ebx,%eax
+  800b00:	75 ed                	jne    800aef <strncpy+0x14>
+	}
+	return ret;
+}
+  800b02:	89 f0                	mov    %esi,%eax
+  800b04:	5b                   	pop    %ebx
+  800b05:	5e                   	pop    %esi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+
+00800b08 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	56                   	push   %esi
+  800b0c:	53                   	push   %ebx
+  800b0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b13:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b16:	89 f0                	mov    %esi,%eax
+  800b18:	85 d2                	test   %edx,%edx
+  800b1a:	74 21                	je     800b3d <strlcpy+0x35>
+  800b1c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b20:	89 f2                	mov    %esi,%edx
+  800b22:	eb 09                	jmp    800b2d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b24:	83 c1 01             	add    $0x1,%ecx
+  800b27:	83 c2 01             	add    $0x1,%edx
+  800b2a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b2d:	39 c2                	cmp    %eax,%edx
+  800b2f:	74 09                	je     800b3a <strlcpy+0x32>
+  800b31:	0f b6 19             	movzbl (%ecx),%ebx
+  800b34:	84 db                	test   %bl,%bl
+  800b36:	75 ec                	jne    800b24 <strlcpy+0x1c>
+  800b38:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b3a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b3d:	29 f0                	sub    %esi,%eax
+}
+  800b3f:	5b                   	pop    %ebx
+  800b40:	5e                   	pop    %esi
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b49:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b4c:	eb 06                	jmp    800b54 <strcmp+0x11>
+		p++, q++;
+  800b4e:	83 c1 01             	add    $0x1,%ecx
+  800b51:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b54:	0f b6 01             	movzbl (%ecx),%eax
+  800b57:	84 c0                	test   %al,%al
+  800b59:	74 04                	je     800b5f <strcmp+0x1c>
+  800b5b:	3a 02                	cmp    (%edx),%al
+  800b5d:	74 ef                	je     800b4e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b5f:	0f b6 c0             	movzbl %al,%eax
+  800b62:	0f b6 12             	movzbl (%edx),%edx
+  800b65:	29 d0                	sub    %edx,%eax
+}
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+
+00800b69 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	53                   	push   %ebx
+  800b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b73:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b76:	eb 09                	jmp    800b81 <strncmp+0x18>
+		n--, p++, q++;
+  800b78:	83 ea 01             	sub    $0x1,%edx
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b81:	85 d2                	test   %edx,%edx
+  800b83:	74 18                	je     800b9d <strncmp+0x34>
+  800b85:	0f b6 18             	movzbl (%eax),%ebx
+  800b88:	84 db                	test   %bl,%bl
+  800b8a:	74 04                	je     800b90 <strncmp+0x27>
+  800b8c:	3a 19                	cmp    (%ecx),%bl
+  800b8e:	74 e8                	je     800b78 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b90:	0f b6 00             	movzbl (%eax),%eax
+  800b93:	0f b6 11             	movzbl (%ecx),%edx
+  800b96:	29 d0                	sub    %edx,%eax
+}
+  800b98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9b:	c9                   	leave
+  800b9c:	c3                   	ret
+		return 0;
+  800b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba2:	eb f4                	jmp    800b98 <strncmp+0x2f>
+
+00800ba4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bae:	eb 03                	jmp    800bb3 <strchr+0xf>
+  800bb0:	83 c0 01             	add    $0x1,%eax
+  800bb3:	0f b6 10             	movzbl (%eax),%edx
+  800bb6:	84 d2                	test   %dl,%dl
+  800bb8:	74 06                	je     800bc0 <strchr+0x1c>
+		if (*s == c)
+  800bba:	38 ca                	cmp    %cl,%dl
+  800bbc:	75 f2                	jne    800bb0 <strchr+0xc>
+  800bbe:	eb 05                	jmp    800bc5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+
+00800bc7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bd1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bd4:	38 ca                	cmp    %cl,%dl
+  800bd6:	74 09                	je     800be1 <strfind+0x1a>
+  800bd8:	84 d2                	test   %dl,%dl
+  800bda:	74 05                	je     800be1 <strfind+0x1a>
+	for (; *s; s++)
+  800bdc:	83 c0 01             	add    $0x1,%eax
+  800bdf:	eb f0                	jmp    800bd1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bed:	85 c9                	test   %ecx,%ecx
+  800bef:	74 20                	je     800c11 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bf1:	89 f8                	mov    %edi,%eax
+  800bf3:	09 c8                	or     %ecx,%eax
+  800bf5:	a8 03                	test   $0x3,%al
+  800bf7:	75 12                	jne    800c0b <memset+0x28>
+		c &= 0xFF;
+  800bf9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bfd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c03:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c06:	fc                   	cld
+  800c07:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c09:	eb 06                	jmp    800c11 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c0e:	fc                   	cld
+  800c0f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c11:	89 f8                	mov    %edi,%eax
+  800c13:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c16:	c9                   	leave
+  800c17:	c3                   	ret
+
+00800c18 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	57                   	push   %edi
+  800c1c:	56                   	push   %esi
+  800c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c20:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c23:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c26:	39 c6                	cmp    %eax,%esi
+  800c28:	73 32                	jae    800c5c <memmove+0x44>
+  800c2a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c2d:	39 d0                	cmp    %edx,%eax
+  800c2f:	73 2b                	jae    800c5c <memmove+0x44>
+		s += n;
+		d += n;
+  800c31:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c34:	89 d6                	mov    %edx,%esi
+  800c36:	09 fe                	or     %edi,%esi
+  800c38:	09 ce                	or     %ecx,%esi
+  800c3a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c40:	75 0e                	jne    800c50 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c42:	83 ef 04             	sub    $0x4,%edi
+  800c45:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c48:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c4b:	fd                   	std
+  800c4c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c4e:	eb 09                	jmp    800c59 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c50:	83 ef 01             	sub    $0x1,%edi
+  800c53:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c56:	fd                   	std
+  800c57:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c59:	fc                   	cld
+  800c5a:	eb 1a                	jmp    800c76 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5c:	89 f2                	mov    %esi,%edx
+  800c5e:	09 c2                	or     %eax,%edx
+  800c60:	09 ca                	or     %ecx,%edx
+  800c62:	f6 c2 03             	test   $0x3,%dl
+  800c65:	75 0a                	jne    800c71 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c67:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c6a:	89 c7                	mov    %eax,%edi
+  800c6c:	fc                   	cld
+  800c6d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c6f:	eb 05                	jmp    800c76 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c71:	89 c7                	mov    %eax,%edi
+  800c73:	fc                   	cld
+  800c74:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c76:	5e                   	pop    %esi
+  800c77:	5f                   	pop    %edi
+  800c78:	5d                   	pop    %ebp
+  800c79:	c3                   	ret
+
+00800c7a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c80:	ff 75 10             	push   0x10(%ebp)
+  800c83:	ff 75 0c             	push   0xc(%ebp)
+  800c86:	ff 75 08             	push   0x8(%ebp)
+  800c89:	e8 8a ff ff ff       	call   800c18 <memmove>
+}
+  800c8e:	c9                   	leave
+  800c8f:	c3                   	ret
+
+00800c90 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	56                   	push   %esi
+  800c94:	53                   	push   %ebx
+  800c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c9b:	89 c6                	mov    %eax,%esi
+  800c9d:	03 75 10             	add    0x10(%ebp),%esi
+  800ca0:	eb 06                	jmp    800ca8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ca2:	83 c0 01             	add    $0x1,%eax
+  800ca5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ca8:	39 f0                	cmp    %esi,%eax
+  800caa:	74 14                	je     800cc0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800cac:	0f b6 08             	movzbl (%eax),%ecx
+  800caf:	0f b6 1a             	movzbl (%edx),%ebx
+  800cb2:	38 d9                	cmp    %bl,%cl
+  800cb4:	74 ec                	je     800ca2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cb6:	0f b6 c1             	movzbl %cl,%eax
+  800cb9:	0f b6 db             	movzbl %bl,%ebx
+  800cbc:	29 d8                	sub    %ebx,%eax
+  800cbe:	eb 05                	jmp    800cc5 <memcmp+0x35>
+	}
+
+	return 0;
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+
+00800cc9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cd2:	89 c2                	mov    %eax,%edx
+  800cd4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cd7:	eb 03                	jmp    800cdc <memfind+0x13>
+  800cd9:	83 c0 01             	add    $0x1,%eax
+  800cdc:	39 d0                	cmp    %edx,%eax
+  800cde:	73 04                	jae    800ce4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ce0:	38 08                	cmp    %cl,(%eax)
+  800ce2:	75 f5                	jne    800cd9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ce4:	5d                   	pop    %ebp
+  800ce5:	c3                   	ret
+
+00800ce6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	57                   	push   %edi
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+  800cec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cf2:	eb 03                	jmp    800cf7 <strtol+0x11>
+		s++;
+  800cf4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cf7:	0f b6 02             	movzbl (%edx),%eax
+  800cfa:	3c 20                	cmp    $0x20,%al
+  800cfc:	74 f6                	je     800cf4 <strtol+0xe>
+  800cfe:	3c 09                	cmp    $0x9,%al
+  800d00:	74 f2                	je     800cf4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d02:	3c 2b                	cmp    $0x2b,%al
+  800d04:	74 2a                	je     800d30 <strtol+0x4a>
+	int neg = 0;
+  800d06:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d0b:	3c 2d                	cmp    $0x2d,%al
+  800d0d:	74 2b                	je     800d3a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d0f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d15:	75 0f                	jne    800d26 <strtol+0x40>
+  800d17:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d1a:	74 28                	je     800d44 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d1c:	85 db                	test   %ebx,%ebx
+  800d1e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d23:	0f 44 d8             	cmove  %eax,%ebx
+  800d26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d2b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d2e:	eb 46                	jmp    800d76 <strtol+0x90>
+		s++;
+  800d30:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d33:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d38:	eb d5                	jmp    800d0f <strtol+0x29>
+		s++, neg = 1;
+  800d3a:	83 c2 01             	add    $0x1,%edx
+  800d3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d42:	eb cb                	jmp    800d0f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d44:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d48:	74 0e                	je     800d58 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d4a:	85 db                	test   %ebx,%ebx
+  800d4c:	75 d8                	jne    800d26 <strtol+0x40>
+		s++, base = 8;
+  800d4e:	83 c2 01             	add    $0x1,%edx
+  800d51:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d56:	eb ce                	jmp    800d26 <strtol+0x40>
+		s += 2, base = 16;
+  800d58:	83 c2 02             	add    $0x2,%edx
+  800d5b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d60:	eb c4                	jmp    800d26 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d62:	0f be c0             	movsbl %al,%eax
+  800d65:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d68:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d6b:	7d 3a                	jge    800da7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d6d:	83 c2 01             	add    $0x1,%edx
+  800d70:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d74:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d76:	0f b6 02             	movzbl (%edx),%eax
+  800d79:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d7c:	89 f3                	mov    %esi,%ebx
+  800d7e:	80 fb 09             	cmp    $0x9,%bl
+  800d81:	76 df                	jbe    800d62 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d83:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d86:	89 f3                	mov    %esi,%ebx
+  800d88:	80 fb 19             	cmp    $0x19,%bl
+  800d8b:	77 08                	ja     800d95 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d8d:	0f be c0             	movsbl %al,%eax
+  800d90:	83 e8 57             	sub    $0x57,%eax
+  800d93:	eb d3                	jmp    800d68 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d95:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d98:	89 f3                	mov    %esi,%ebx
+  800d9a:	80 fb 19             	cmp    $0x19,%bl
+  800d9d:	77 08                	ja     800da7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d9f:	0f be c0             	movsbl %al,%eax
+  800da2:	83 e8 37             	sub    $0x37,%eax
+  800da5:	eb c1                	jmp    800d68 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800da7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dab:	74 05                	je     800db2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800dad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800db0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800db2:	89 c8                	mov    %ecx,%eax
+  800db4:	f7 d8                	neg    %eax
+  800db6:	85 ff                	test   %edi,%edi
+  800db8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dbb:	89 c8                	mov    %ecx,%eax
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800dc8:	6a 00                	push   $0x0
+  800dca:	6a 00                	push   $0x0
+  800dcc:	ff 75 08             	push   0x8(%ebp)
+  800dcf:	e8 12 ff ff ff       	call   800ce6 <strtol>
+}
+  800dd4:	c9                   	leave
+  800dd5:	c3                   	ret
+
+00800dd6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	57                   	push   %edi
+  800dda:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de6:	89 c3                	mov    %eax,%ebx
+  800de8:	89 c7                	mov    %eax,%edi
+  800dea:	6a 00                	push   $0x0
+  800dec:	55                   	push   %ebp
+  800ded:	56                   	push   %esi
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	8d 35 f8 0d 80 00    	lea    0x800df8,%esi
+  800df6:	0f 34                	sysenter
+
+00800df8 <after_sysenter_label_47>:
+  800df8:	5e                   	pop    %esi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dfd:	5b                   	pop    %ebx
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+
+00800e01 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	6a 00                	push   $0x0
+  800e18:	55                   	push   %ebp
+  800e19:	56                   	push   %esi
+  800e1a:	89 e5                	mov    %esp,%ebp
+  800e1c:	8d 35 24 0e 80 00    	lea    0x800e24,%esi
+  800e22:	0f 34                	sysenter
+
+00800e24 <after_sysenter_label_128>:
+  800e24:	5e                   	pop    %esi
+  800e25:	5d                   	pop    %ebp
+  800e26:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e29:	5b                   	pop    %ebx
+  800e2a:	5f                   	pop    %edi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	c3                   	ret
+
+00800e2d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e3f:	89 cb                	mov    %ecx,%ebx
+  800e41:	89 cf                	mov    %ecx,%edi
+  800e43:	6a 00                	push   $0x0
+  800e45:	55                   	push   %ebp
+  800e46:	56                   	push   %esi
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	8d 35 51 0e 80 00    	lea    0x800e51,%esi
+  800e4f:	0f 34                	sysenter
+
+00800e51 <after_sysenter_label_212>:
+  800e51:	5e                   	pop    %esi
+  800e52:	5d                   	pop    %ebp
+  800e53:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e56:	85 c0                	test   %eax,%eax
+  800e58:	7f 07                	jg     800e61 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+  800e64:	50                   	push   %eax
+  800e65:	6a 03                	push   $0x3
+  800e67:	68 b5 4e 80 00       	push   $0x804eb5
+  800e6c:	6a 54                	push   $0x54
+  800e6e:	68 d2 4e 80 00       	push   $0x804ed2
+  800e73:	e8 5b f5 ff ff       	call   8003d3 <_panic>
+
+00800e78 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	57                   	push   %edi
+  800e7c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e87:	89 d1                	mov    %edx,%ecx
+  800e89:	89 d3                	mov    %edx,%ebx
+  800e8b:	89 d7                	mov    %edx,%edi
+  800e8d:	6a 00                	push   $0x0
+  800e8f:	55                   	push   %ebp
+  800e90:	56                   	push   %esi
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	8d 35 9b 0e 80 00    	lea    0x800e9b,%esi
+  800e99:	0f 34                	sysenter
+
+00800e9b <after_sysenter_label_309>:
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ea0:	5b                   	pop    %ebx
+  800ea1:	5f                   	pop    %edi
+  800ea2:	5d                   	pop    %ebp
+  800ea3:	c3                   	ret
+
+00800ea4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	57                   	push   %edi
+  800ea8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb3:	89 d1                	mov    %edx,%ecx
+  800eb5:	89 d3                	mov    %edx,%ebx
+  800eb7:	89 d7                	mov    %edx,%edi
+  800eb9:	6a 00                	push   $0x0
+  800ebb:	55                   	push   %ebp
+  800ebc:	56                   	push   %esi
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	8d 35 c7 0e 80 00    	lea    0x800ec7,%esi
+  800ec5:	0f 34                	sysenter
+
+00800ec7 <after_sysenter_label_391>:
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+
+00800ed0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ee0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ee5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee8:	6a 00                	push   $0x0
+  800eea:	55                   	push   %ebp
+  800eeb:	56                   	push   %esi
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	8d 35 f6 0e 80 00    	lea    0x800ef6,%esi
+  800ef4:	0f 34                	sysenter
+
+00800ef6 <after_sysenter_label_479>:
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800efb:	85 c0                	test   %eax,%eax
+  800efd:	7f 07                	jg     800f06 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f02:	5b                   	pop    %ebx
+  800f03:	5f                   	pop    %edi
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f06:	83 ec 0c             	sub    $0xc,%esp
+  800f09:	50                   	push   %eax
+  800f0a:	6a 04                	push   $0x4
+  800f0c:	68 b5 4e 80 00       	push   $0x804eb5
+  800f11:	6a 54                	push   $0x54
+  800f13:	68 d2 4e 80 00       	push   $0x804ed2
+  800f18:	e8 b6 f4 ff ff       	call   8003d3 <_panic>
+
+00800f1d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f33:	ff 75 18             	push   0x18(%ebp)
+  800f36:	55                   	push   %ebp
+  800f37:	56                   	push   %esi
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	8d 35 42 0f 80 00    	lea    0x800f42,%esi
+  800f40:	0f 34                	sysenter
+
+00800f42 <after_sysenter_label_593>:
+  800f42:	5e                   	pop    %esi
+  800f43:	5d                   	pop    %ebp
+  800f44:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 07                	jg     800f52 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 05                	push   $0x5
+  800f58:	68 b5 4e 80 00       	push   $0x804eb5
+  800f5d:	6a 54                	push   $0x54
+  800f5f:	68 d2 4e 80 00       	push   $0x804ed2
+  800f64:	e8 6a f4 ff ff       	call   8003d3 <_panic>
+
+00800f69 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f79:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7e:	89 df                	mov    %ebx,%edi
+  800f80:	6a 00                	push   $0x0
+  800f82:	55                   	push   %ebp
+  800f83:	56                   	push   %esi
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+
+00800f8e <after_sysenter_label_704>:
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	7f 07                	jg     800f9e <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	50                   	push   %eax
+  800fa2:	6a 06                	push   $0x6
+  800fa4:	68 b5 4e 80 00       	push   $0x804eb5
+  800fa9:	6a 54                	push   $0x54
+  800fab:	68 d2 4e 80 00       	push   $0x804ed2
+  800fb0:	e8 1e f4 ff ff       	call   8003d3 <_panic>
+
+00800fb5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	6a 00                	push   $0x0
+  800fce:	55                   	push   %ebp
+  800fcf:	56                   	push   %esi
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	8d 35 da 0f 80 00    	lea    0x800fda,%esi
+  800fd8:	0f 34                	sysenter
+
+00800fda <after_sysenter_label_808>:
+  800fda:	5e                   	pop    %esi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fdf:	85 c0                	test   %eax,%eax
+  800fe1:	7f 07                	jg     800fea <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fe3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fe6:	5b                   	pop    %ebx
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 08                	push   $0x8
+  800ff0:	68 b5 4e 80 00       	push   $0x804eb5
+  800ff5:	6a 54                	push   $0x54
+  800ff7:	68 d2 4e 80 00       	push   $0x804ed2
+  800ffc:	e8 d2 f3 ff ff       	call   8003d3 <_panic>
+
+00801001 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 09 00 00 00       	mov    $0x9,%eax
+  801016:	89 df                	mov    %ebx,%edi
+  801018:	6a 00                	push   $0x0
+  80101a:	55                   	push   %ebp
+  80101b:	56                   	push   %esi
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	8d 35 26 10 80 00    	lea    0x801026,%esi
+  801024:	0f 34                	sysenter
+
+00801026 <after_sysenter_label_912>:
+  801026:	5e                   	pop    %esi
+  801027:	5d                   	pop    %ebp
+  801028:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	7f 07                	jg     801036 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80102f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	50                   	push   %eax
+  80103a:	6a 09                	push   $0x9
+  80103c:	68 b5 4e 80 00       	push   $0x804eb5
+  801041:	6a 54                	push   $0x54
+  801043:	68 d2 4e 80 00       	push   $0x804ed2
+  801048:	e8 86 f3 ff ff       	call   8003d3 <_panic>
+
+0080104d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801062:	89 df                	mov    %ebx,%edi
+  801064:	6a 00                	push   $0x0
+  801066:	55                   	push   %ebp
+  801067:	56                   	push   %esi
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	8d 35 72 10 80 00    	lea    0x801072,%esi
+  801070:	0f 34                	sysenter
+
+00801072 <after_sysenter_label_1016>:
+  801072:	5e                   	pop    %esi
+  801073:	5d                   	pop    %ebp
+  801074:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801077:	85 c0                	test   %eax,%eax
+  801079:	7f 07                	jg     801082 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80107b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 0a                	push   $0xa
+  801088:	68 b5 4e 80 00       	push   $0x804eb5
+  80108d:	6a 54                	push   $0x54
+  80108f:	68 d2 4e 80 00       	push   $0x804ed2
+  801094:	e8 3a f3 ff ff       	call   8003d3 <_panic>
+
+00801099 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010af:	6a 00                	push   $0x0
+  8010b1:	55                   	push   %ebp
+  8010b2:	56                   	push   %esi
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	8d 35 bd 10 80 00    	lea    0x8010bd,%esi
+  8010bb:	0f 34                	sysenter
+
+008010bd <after_sysenter_label_1126>:
+  8010bd:	5e                   	pop    %esi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d8:	89 cb                	mov    %ecx,%ebx
+  8010da:	89 cf                	mov    %ecx,%edi
+  8010dc:	6a 00                	push   $0x0
+  8010de:	55                   	push   %ebp
+  8010df:	56                   	push   %esi
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	8d 35 ea 10 80 00    	lea    0x8010ea,%esi
+  8010e8:	0f 34                	sysenter
+
+008010ea <after_sysenter_label_1210>:
+  8010ea:	5e                   	pop    %esi
+  8010eb:	5d                   	pop    %ebp
+  8010ec:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	7f 07                	jg     8010fa <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	50                   	push   %eax
+  8010fe:	6a 0d                	push   $0xd
+  801100:	68 b5 4e 80 00       	push   $0x804eb5
+  801105:	6a 54                	push   $0x54
+  801107:	68 d2 4e 80 00       	push   $0x804ed2
+  80110c:	e8 c2 f2 ff ff       	call   8003d3 <_panic>
+
+00801111 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 42 00 00 00       	mov    $0x42,%eax
+  801126:	89 df                	mov    %ebx,%edi
+  801128:	6a 00                	push   $0x0
+  80112a:	55                   	push   %ebp
+  80112b:	56                   	push   %esi
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	8d 35 36 11 80 00    	lea    0x801136,%esi
+  801134:	0f 34                	sysenter
+
+00801136 <after_sysenter_label_1311>:
+  801136:	5e                   	pop    %esi
+  801137:	5d                   	pop    %ebp
+  801138:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	7f 07                	jg     801146 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80113f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 42                	push   $0x42
+  80114c:	68 b5 4e 80 00       	push   $0x804eb5
+  801151:	6a 54                	push   $0x54
+  801153:	68 d2 4e 80 00       	push   $0x804ed2
+  801158:	e8 76 f2 ff ff       	call   8003d3 <_panic>
+
+0080115d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801162:	ba 00 00 00 00       	mov    $0x0,%edx
+  801167:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80116c:	89 d1                	mov    %edx,%ecx
+  80116e:	89 d3                	mov    %edx,%ebx
+  801170:	89 d7                	mov    %edx,%edi
+  801172:	6a 00                	push   $0x0
+  801174:	55                   	push   %ebp
+  801175:	56                   	push   %esi
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	8d 35 80 11 80 00    	lea    0x801180,%esi
+  80117e:	0f 34                	sysenter
+
+00801180 <after_sysenter_label_1411>:
+  801180:	5e                   	pop    %esi
+  801181:	5d                   	pop    %ebp
+  801182:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801185:	5b                   	pop    %ebx
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80118e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801193:	8b 55 08             	mov    0x8(%ebp),%edx
+  801196:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801199:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80119e:	89 df                	mov    %ebx,%edi
+  8011a0:	6a 00                	push   $0x0
+  8011a2:	55                   	push   %ebp
+  8011a3:	56                   	push   %esi
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	8d 35 ae 11 80 00    	lea    0x8011ae,%esi
+  8011ac:	0f 34                	sysenter
+
+008011ae <after_sysenter_label_1497>:
+  8011ae:	5e                   	pop    %esi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5f                   	pop    %edi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+
+008011b7 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011cc:	89 df                	mov    %ebx,%edi
+  8011ce:	6a 00                	push   $0x0
+  8011d0:	55                   	push   %ebp
+  8011d1:	56                   	push   %esi
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	8d 35 dc 11 80 00    	lea    0x8011dc,%esi
+  8011da:	0f 34                	sysenter
+
+008011dc <after_sysenter_label_1583>:
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+
+008011e5 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fd:	6a 00                	push   $0x0
+  8011ff:	55                   	push   %ebp
+  801200:	56                   	push   %esi
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	8d 35 0b 12 80 00    	lea    0x80120b,%esi
+  801209:	0f 34                	sysenter
+
+0080120b <after_sysenter_label_1672>:
+  80120b:	5e                   	pop    %esi
+  80120c:	5d                   	pop    %ebp
+  80120d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801210:	5b                   	pop    %ebx
+  801211:	5f                   	pop    %edi
+  801212:	5d                   	pop    %ebp
+  801213:	c3                   	ret
+
+00801214 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	57                   	push   %edi
+  801218:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	b8 12 00 00 00       	mov    $0x12,%eax
+  801229:	89 df                	mov    %ebx,%edi
+  80122b:	6a 00                	push   $0x0
+  80122d:	55                   	push   %ebp
+  80122e:	56                   	push   %esi
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	8d 35 39 12 80 00    	lea    0x801239,%esi
+  801237:	0f 34                	sysenter
+
+00801239 <after_sysenter_label_1758>:
+  801239:	5e                   	pop    %esi
+  80123a:	5d                   	pop    %ebp
+  80123b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80123e:	5b                   	pop    %ebx
+  80123f:	5f                   	pop    %edi
+  801240:	5d                   	pop    %ebp
+  801241:	c3                   	ret
+
+00801242 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801254:	89 cb                	mov    %ecx,%ebx
+  801256:	89 cf                	mov    %ecx,%edi
+  801258:	6a 00                	push   $0x0
+  80125a:	55                   	push   %ebp
+  80125b:	56                   	push   %esi
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	8d 35 66 12 80 00    	lea    0x801266,%esi
+  801264:	0f 34                	sysenter
+
+00801266 <after_sysenter_label_1842>:
+  801266:	5e                   	pop    %esi
+  801267:	5d                   	pop    %ebp
+  801268:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	7f 07                	jg     801276 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80126f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801272:	5b                   	pop    %ebx
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  801279:	50                   	push   %eax
+  80127a:	6a 13                	push   $0x13
+  80127c:	68 b5 4e 80 00       	push   $0x804eb5
+  801281:	6a 54                	push   $0x54
+  801283:	68 d2 4e 80 00       	push   $0x804ed2
+  801288:	e8 46 f1 ff ff       	call   8003d3 <_panic>
+
+0080128d <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801292:	ba 00 00 00 00       	mov    $0x0,%edx
+  801297:	b8 14 00 00 00       	mov    $0x14,%eax
+  80129c:	89 d1                	mov    %edx,%ecx
+  80129e:	89 d3                	mov    %edx,%ebx
+  8012a0:	89 d7                	mov    %edx,%edi
+  8012a2:	6a 00                	push   $0x0
+  8012a4:	55                   	push   %ebp
+  8012a5:	56                   	push   %esi
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	8d 35 b0 12 80 00    	lea    0x8012b0,%esi
+  8012ae:	0f 34                	sysenter
+
+008012b0 <after_sysenter_label_1939>:
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5f                   	pop    %edi
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	c3                   	ret
+
+008012b9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d1:	6a 00                	push   $0x0
+  8012d3:	55                   	push   %ebp
+  8012d4:	56                   	push   %esi
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	8d 35 df 12 80 00    	lea    0x8012df,%esi
+  8012dd:	0f 34                	sysenter
+
+008012df <after_sysenter_label_2028>:
+  8012df:	5e                   	pop    %esi
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8012e4:	5b                   	pop    %ebx
+  8012e5:	5f                   	pop    %edi
+  8012e6:	5d                   	pop    %ebp
+  8012e7:	c3                   	ret
+
+008012e8 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	57                   	push   %edi
+  8012ec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012fd:	89 df                	mov    %ebx,%edi
+  8012ff:	6a 00                	push   $0x0
+  801301:	55                   	push   %ebp
+  801302:	56                   	push   %esi
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	8d 35 0d 13 80 00    	lea    0x80130d,%esi
+  80130b:	0f 34                	sysenter
+
+0080130d <after_sysenter_label_2114>:
+  80130d:	5e                   	pop    %esi
+  80130e:	5d                   	pop    %ebp
+  80130f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801312:	5b                   	pop    %ebx
+  801313:	5f                   	pop    %edi
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+
+00801316 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801320:	8b 55 08             	mov    0x8(%ebp),%edx
+  801323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801326:	b8 17 00 00 00       	mov    $0x17,%eax
+  80132b:	89 df                	mov    %ebx,%edi
+  80132d:	6a 00                	push   $0x0
+  80132f:	55                   	push   %ebp
+  801330:	56                   	push   %esi
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	8d 35 3b 13 80 00    	lea    0x80133b,%esi
+  801339:	0f 34                	sysenter
+
+0080133b <after_sysenter_label_2200>:
+  80133b:	5e                   	pop    %esi
+  80133c:	5d                   	pop    %ebp
+  80133d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5f                   	pop    %edi
+  801342:	5d                   	pop    %ebp
+  801343:	c3                   	ret
+
+00801344 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	57                   	push   %edi
+  801348:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 18 00 00 00       	mov    $0x18,%eax
+  801359:	89 df                	mov    %ebx,%edi
+  80135b:	6a 00                	push   $0x0
+  80135d:	55                   	push   %ebp
+  80135e:	56                   	push   %esi
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	8d 35 69 13 80 00    	lea    0x801369,%esi
+  801367:	0f 34                	sysenter
+
+00801369 <after_sysenter_label_2286>:
+  801369:	5e                   	pop    %esi
+  80136a:	5d                   	pop    %ebp
+  80136b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80136e:	5b                   	pop    %ebx
+  80136f:	5f                   	pop    %edi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+
+00801372 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+  801378:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80137b:	89 d6                	mov    %edx,%esi
+  80137d:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801380:	89 cf                	mov    %ecx,%edi
+  801382:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801385:	89 fa                	mov    %edi,%edx
+  801387:	80 ce 08             	or     $0x8,%dh
+  80138a:	f6 c5 08             	test   $0x8,%ch
+  80138d:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801390:	57                   	push   %edi
+  801391:	56                   	push   %esi
+  801392:	50                   	push   %eax
+  801393:	56                   	push   %esi
+  801394:	6a 00                	push   $0x0
+  801396:	e8 82 fb ff ff       	call   800f1d <sys_page_map>
+	if (r < 0) {
+  80139b:	83 c4 20             	add    $0x20,%esp
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	78 27                	js     8013c9 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8013a2:	83 ec 0c             	sub    $0xc,%esp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	6a 00                	push   $0x0
+  8013a9:	56                   	push   %esi
+  8013aa:	6a 00                	push   $0x0
+  8013ac:	e8 6c fb ff ff       	call   800f1d <sys_page_map>
+  8013b1:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8013b3:	83 c4 20             	add    $0x20,%esp
+  8013b6:	85 c0                	test   %eax,%eax
+  8013b8:	78 24                	js     8013de <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8013ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8013bf:	89 d8                	mov    %ebx,%eax
+  8013c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5f                   	pop    %edi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+  8013c9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8013cb:	83 ec 08             	sub    $0x8,%esp
+  8013ce:	50                   	push   %eax
+  8013cf:	68 e0 4e 80 00       	push   $0x804ee0
+  8013d4:	e8 d5 f0 ff ff       	call   8004ae <cprintf>
+		return r;
+  8013d9:	83 c4 10             	add    $0x10,%esp
+  8013dc:	eb e1                	jmp    8013bf <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8013de:	83 ec 08             	sub    $0x8,%esp
+  8013e1:	50                   	push   %eax
+  8013e2:	68 10 4f 80 00       	push   $0x804f10
+  8013e7:	e8 c2 f0 ff ff       	call   8004ae <cprintf>
+		return r;
+  8013ec:	83 c4 10             	add    $0x10,%esp
+  8013ef:	eb ce                	jmp    8013bf <duppage_cow+0x4d>
+
+008013f1 <duppage>:
+{
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	53                   	push   %ebx
+  8013f5:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8013f8:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8013fb:	51                   	push   %ecx
+  8013fc:	52                   	push   %edx
+  8013fd:	50                   	push   %eax
+  8013fe:	52                   	push   %edx
+  8013ff:	6a 00                	push   $0x0
+  801401:	e8 17 fb ff ff       	call   800f1d <sys_page_map>
+	if (r < 0) {
+  801406:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	78 07                	js     801419 <duppage+0x28>
+}
+  801412:	89 d8                	mov    %ebx,%eax
+  801414:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801417:	c9                   	leave
+  801418:	c3                   	ret
+  801419:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80141b:	83 ec 08             	sub    $0x8,%esp
+  80141e:	50                   	push   %eax
+  80141f:	68 e0 4e 80 00       	push   $0x804ee0
+  801424:	e8 85 f0 ff ff       	call   8004ae <cprintf>
+		return r;
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	eb e4                	jmp    801412 <duppage+0x21>
+
+0080142e <cow_copy>:
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801435:	83 ec 04             	sub    $0x4,%esp
+  801438:	6a 07                	push   $0x7
+  80143a:	68 00 f0 7f 00       	push   $0x7ff000
+  80143f:	6a 00                	push   $0x0
+  801441:	e8 8a fa ff ff       	call   800ed0 <sys_page_alloc>
+	if (r < 0) {
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	78 58                	js     8014a5 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80144d:	83 ec 04             	sub    $0x4,%esp
+  801450:	68 00 10 00 00       	push   $0x1000
+  801455:	56                   	push   %esi
+  801456:	68 00 f0 7f 00       	push   $0x7ff000
+  80145b:	e8 b8 f7 ff ff       	call   800c18 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801460:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801467:	56                   	push   %esi
+  801468:	6a 00                	push   $0x0
+  80146a:	68 00 f0 7f 00       	push   $0x7ff000
+  80146f:	6a 00                	push   $0x0
+  801471:	e8 a7 fa ff ff       	call   800f1d <sys_page_map>
+  801476:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801478:	83 c4 20             	add    $0x20,%esp
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	78 3b                	js     8014ba <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	68 00 f0 7f 00       	push   $0x7ff000
+  801487:	6a 00                	push   $0x0
+  801489:	e8 db fa ff ff       	call   800f69 <sys_page_unmap>
+  80148e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	85 c0                	test   %eax,%eax
+  801495:	78 45                	js     8014dc <cow_copy+0xae>
+	return 0;
+  801497:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80149c:	89 d8                	mov    %ebx,%eax
+  80149e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+  8014a5:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8014a7:	83 ec 08             	sub    $0x8,%esp
+  8014aa:	50                   	push   %eax
+  8014ab:	68 00 50 80 00       	push   $0x805000
+  8014b0:	e8 f9 ef ff ff       	call   8004ae <cprintf>
+		return r;
+  8014b5:	83 c4 10             	add    $0x10,%esp
+  8014b8:	eb e2                	jmp    80149c <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8014ba:	83 ec 08             	sub    $0x8,%esp
+  8014bd:	50                   	push   %eax
+  8014be:	68 1c 50 80 00       	push   $0x80501c
+  8014c3:	e8 e6 ef ff ff       	call   8004ae <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8014c8:	83 c4 08             	add    $0x8,%esp
+  8014cb:	68 00 f0 7f 00       	push   $0x7ff000
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	e8 92 fa ff ff       	call   800f69 <sys_page_unmap>
+		return r;
+  8014d7:	83 c4 10             	add    $0x10,%esp
+  8014da:	eb c0                	jmp    80149c <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8014dc:	83 ec 08             	sub    $0x8,%esp
+  8014df:	50                   	push   %eax
+  8014e0:	68 38 4f 80 00       	push   $0x804f38
+  8014e5:	e8 c4 ef ff ff       	call   8004ae <cprintf>
+		return r;
+  8014ea:	83 c4 10             	add    $0x10,%esp
+  8014ed:	eb ad                	jmp    80149c <cow_copy+0x6e>
+
+008014ef <pgfault>:
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8014f7:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8014f9:	89 d8                	mov    %ebx,%eax
+  8014fb:	c1 e8 16             	shr    $0x16,%eax
+  8014fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801505:	89 de                	mov    %ebx,%esi
+  801507:	c1 ee 0c             	shr    $0xc,%esi
+  80150a:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801511:	a8 07                	test   $0x7,%al
+  801513:	74 3b                	je     801550 <pgfault+0x61>
+  801515:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80151b:	74 33                	je     801550 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80151d:	83 ec 0c             	sub    $0xc,%esp
+  801520:	68 00 f0 bf ee       	push   $0xeebff000
+  801525:	e8 07 28 00 00       	call   803d31 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80152a:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	f6 c4 08             	test   $0x8,%ah
+  801537:	75 30                	jne    801569 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801539:	83 ec 0c             	sub    $0xc,%esp
+  80153c:	68 00 f0 bf ee       	push   $0xeebff000
+  801541:	e8 58 28 00 00       	call   803d9e <mutex_unlock>
+}
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80154c:	5b                   	pop    %ebx
+  80154d:	5e                   	pop    %esi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801550:	83 ec 08             	sub    $0x8,%esp
+  801553:	ff 72 28             	push   0x28(%edx)
+  801556:	51                   	push   %ecx
+  801557:	50                   	push   %eax
+  801558:	68 5c 4f 80 00       	push   $0x804f5c
+  80155d:	6a 3f                	push   $0x3f
+  80155f:	68 36 50 80 00       	push   $0x805036
+  801564:	e8 6a ee ff ff       	call   8003d3 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801569:	89 d8                	mov    %ebx,%eax
+  80156b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801570:	e8 b9 fe ff ff       	call   80142e <cow_copy>
+  801575:	eb c2                	jmp    801539 <pgfault+0x4a>
+
+00801577 <cow_enable>:
+{
+  801577:	55                   	push   %ebp
+  801578:	89 e5                	mov    %esp,%ebp
+  80157a:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80157d:	68 ef 14 80 00       	push   $0x8014ef
+  801582:	e8 2a 31 00 00       	call   8046b1 <set_pgfault_handler>
+}
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	c9                   	leave
+  80158b:	c3                   	ret
+
+0080158c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80158c:	55                   	push   %ebp
+  80158d:	89 e5                	mov    %esp,%ebp
+  80158f:	57                   	push   %edi
+  801590:	56                   	push   %esi
+  801591:	53                   	push   %ebx
+  801592:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801595:	68 ef 14 80 00       	push   $0x8014ef
+  80159a:	e8 12 31 00 00       	call   8046b1 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80159f:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015a4:	cd 30                	int    $0x30
+  8015a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015a9:	83 c4 10             	add    $0x10,%esp
+  8015ac:	85 c0                	test   %eax,%eax
+  8015ae:	78 4b                	js     8015fb <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015b0:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8015b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8015bd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8015c1:	0f 85 16 01 00 00    	jne    8016dd <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8015c7:	e8 ac f8 ff ff       	call   800e78 <sys_getenvid>
+  8015cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015d1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015d3:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8015d9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8015df:	77 32                	ja     801613 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015e1:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8015e6:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8015e8:	c1 ea 10             	shr    $0x10,%edx
+  8015eb:	74 26                	je     801613 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015ed:	c1 e2 10             	shl    $0x10,%edx
+  8015f0:	89 d1                	mov    %edx,%ecx
+  8015f2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015f7:	29 ca                	sub    %ecx,%edx
+  8015f9:	eb 1e                	jmp    801619 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8015fb:	83 ec 08             	sub    $0x8,%esp
+  8015fe:	89 c7                	mov    %eax,%edi
+  801600:	50                   	push   %eax
+  801601:	68 41 50 80 00       	push   $0x805041
+  801606:	e8 a3 ee ff ff       	call   8004ae <cprintf>
+		return eid;
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	e9 6c 01 00 00       	jmp    80177f <fork+0x1f3>
+		return pthread_main_tls;
+  801613:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801619:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80161c:	c1 e0 04             	shl    $0x4,%eax
+  80161f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801624:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801626:	e8 4f 2e 00 00       	call   80447a <pthread_fork_child>
+		return eid;
+  80162b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80162e:	e9 4c 01 00 00       	jmp    80177f <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801633:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801639:	89 da                	mov    %ebx,%edx
+  80163b:	89 f8                	mov    %edi,%eax
+  80163d:	e8 af fd ff ff       	call   8013f1 <duppage>
+  801642:	85 c0                	test   %eax,%eax
+  801644:	79 28                	jns    80166e <fork+0xe2>
+  801646:	89 c7                	mov    %eax,%edi
+  801648:	e9 32 01 00 00       	jmp    80177f <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80164d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801653:	83 f9 05             	cmp    $0x5,%ecx
+  801656:	75 58                	jne    8016b0 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801658:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80165d:	89 da                	mov    %ebx,%edx
+  80165f:	89 f8                	mov    %edi,%eax
+  801661:	e8 8b fd ff ff       	call   8013f1 <duppage>
+  801666:	85 c0                	test   %eax,%eax
+  801668:	0f 88 0f 01 00 00    	js     80177d <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80166e:	83 c3 01             	add    $0x1,%ebx
+  801671:	39 de                	cmp    %ebx,%esi
+  801673:	74 54                	je     8016c9 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801675:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80167c:	f6 c1 05             	test   $0x5,%cl
+  80167f:	74 ed                	je     80166e <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801681:	f6 c5 04             	test   $0x4,%ch
+  801684:	75 ad                	jne    801633 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801686:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80168c:	74 bf                	je     80164d <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80168e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801694:	74 d8                	je     80166e <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801696:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80169c:	89 da                	mov    %ebx,%edx
+  80169e:	89 f8                	mov    %edi,%eax
+  8016a0:	e8 cd fc ff ff       	call   801372 <duppage_cow>
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	79 c5                	jns    80166e <fork+0xe2>
+  8016a9:	89 c7                	mov    %eax,%edi
+  8016ab:	e9 cf 00 00 00       	jmp    80177f <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8016b0:	68 8c 4f 80 00       	push   $0x804f8c
+  8016b5:	68 8b 4a 80 00       	push   $0x804a8b
+  8016ba:	68 c6 00 00 00       	push   $0xc6
+  8016bf:	68 36 50 80 00       	push   $0x805036
+  8016c4:	e8 0a ed ff ff       	call   8003d3 <_panic>
+  8016c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8016cc:	83 c1 01             	add    $0x1,%ecx
+  8016cf:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8016d5:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8016db:	74 18                	je     8016f5 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8016dd:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8016e4:	a8 07                	test   $0x7,%al
+  8016e6:	74 e4                	je     8016cc <fork+0x140>
+  8016e8:	89 cb                	mov    %ecx,%ebx
+  8016ea:	c1 e3 0a             	shl    $0xa,%ebx
+  8016ed:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016f0:	e9 7c ff ff ff       	jmp    801671 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8016f5:	83 ec 04             	sub    $0x4,%esp
+  8016f8:	6a 07                	push   $0x7
+  8016fa:	68 00 f0 bf ee       	push   $0xeebff000
+  8016ff:	ff 75 e4             	push   -0x1c(%ebp)
+  801702:	e8 c9 f7 ff ff       	call   800ed0 <sys_page_alloc>
+  801707:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	78 34                	js     801744 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801710:	83 ec 08             	sub    $0x8,%esp
+  801713:	68 ef 46 80 00       	push   $0x8046ef
+  801718:	ff 75 e4             	push   -0x1c(%ebp)
+  80171b:	e8 2d f9 ff ff       	call   80104d <sys_env_set_pgfault_upcall>
+  801720:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	85 c0                	test   %eax,%eax
+  801727:	78 2e                	js     801757 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801729:	83 ec 08             	sub    $0x8,%esp
+  80172c:	6a 02                	push   $0x2
+  80172e:	ff 75 e4             	push   -0x1c(%ebp)
+  801731:	e8 7f f8 ff ff       	call   800fb5 <sys_env_set_status>
+  801736:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	78 2b                	js     80176a <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80173f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801742:	eb 3b                	jmp    80177f <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801744:	83 ec 08             	sub    $0x8,%esp
+  801747:	50                   	push   %eax
+  801748:	68 b4 4f 80 00       	push   $0x804fb4
+  80174d:	e8 5c ed ff ff       	call   8004ae <cprintf>
+		return r;
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	eb 28                	jmp    80177f <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801757:	83 ec 08             	sub    $0x8,%esp
+  80175a:	50                   	push   %eax
+  80175b:	68 dc 4f 80 00       	push   $0x804fdc
+  801760:	e8 49 ed ff ff       	call   8004ae <cprintf>
+		return r;
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	eb 15                	jmp    80177f <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80176a:	83 ec 08             	sub    $0x8,%esp
+  80176d:	50                   	push   %eax
+  80176e:	68 51 50 80 00       	push   $0x805051
+  801773:	e8 36 ed ff ff       	call   8004ae <cprintf>
+		return r;
+  801778:	83 c4 10             	add    $0x10,%esp
+  80177b:	eb 02                	jmp    80177f <fork+0x1f3>
+  80177d:	89 c7                	mov    %eax,%edi
+}
+  80177f:	89 f8                	mov    %edi,%eax
+  801781:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801784:	5b                   	pop    %ebx
+  801785:	5e                   	pop    %esi
+  801786:	5f                   	pop    %edi
+  801787:	5d                   	pop    %ebp
+  801788:	c3                   	ret
+
+00801789 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801789:	55                   	push   %ebp
+  80178a:	89 e5                	mov    %esp,%ebp
+  80178c:	57                   	push   %edi
+  80178d:	56                   	push   %esi
+  80178e:	53                   	push   %ebx
+  80178f:	83 ec 2c             	sub    $0x2c,%esp
+  801792:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801794:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80179a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80179f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8017a5:	77 0a                	ja     8017b1 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017a7:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8017ac:	29 c3                	sub    %eax,%ebx
+  8017ae:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8017b1:	83 ec 0c             	sub    $0xc,%esp
+  8017b4:	68 ef 14 80 00       	push   $0x8014ef
+  8017b9:	e8 f3 2e 00 00       	call   8046b1 <set_pgfault_handler>
+  8017be:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017c3:	cd 30                	int    $0x30
+  8017c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 30                	js     8017ff <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8017cf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017d3:	74 42                	je     801817 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8017d5:	c1 e3 10             	shl    $0x10,%ebx
+  8017d8:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8017dd:	29 d8                	sub    %ebx,%eax
+  8017df:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8017e2:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8017e7:	29 d8                	sub    %ebx,%eax
+  8017e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8017ec:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8017f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f6:	89 f7                	mov    %esi,%edi
+  8017f8:	89 d6                	mov    %edx,%esi
+  8017fa:	e9 2c 01 00 00       	jmp    80192b <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8017ff:	83 ec 08             	sub    $0x8,%esp
+  801802:	89 c7                	mov    %eax,%edi
+  801804:	50                   	push   %eax
+  801805:	68 41 50 80 00       	push   $0x805041
+  80180a:	e8 9f ec ff ff       	call   8004ae <cprintf>
+		return eid;
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	e9 d5 00 00 00       	jmp    8018ec <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801817:	e8 5c f6 ff ff       	call   800e78 <sys_getenvid>
+  80181c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801821:	89 c2                	mov    %eax,%edx
+  801823:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801825:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80182b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801830:	77 18                	ja     80184a <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801832:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801837:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801839:	c1 e8 10             	shr    $0x10,%eax
+  80183c:	74 0c                	je     80184a <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80183e:	c1 e0 10             	shl    $0x10,%eax
+  801841:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801846:	29 c1                	sub    %eax,%ecx
+  801848:	eb 06                	jmp    801850 <sfork+0xc7>
+		return pthread_main_tls;
+  80184a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  801850:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801853:	c1 e0 04             	shl    $0x4,%eax
+  801856:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80185b:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80185d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801860:	e9 87 00 00 00       	jmp    8018ec <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801865:	f6 c5 04             	test   $0x4,%ch
+  801868:	74 6c                	je     8018d6 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80186a:	89 ca                	mov    %ecx,%edx
+  80186c:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801872:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801878:	74 7c                	je     8018f6 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80187a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801880:	89 da                	mov    %ebx,%edx
+  801882:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801885:	e8 67 fb ff ff       	call   8013f1 <duppage>
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	0f 88 4f 01 00 00    	js     8019e1 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801892:	83 c3 01             	add    $0x1,%ebx
+  801895:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801898:	74 7a                	je     801914 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80189a:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80189c:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8018a3:	f6 c1 01             	test   $0x1,%cl
+  8018a6:	74 ea                	je     801892 <sfork+0x109>
+  8018a8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8018ae:	74 e2                	je     801892 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8018b0:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8018b6:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8018b9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8018be:	76 a5                	jbe    801865 <sfork+0xdc>
+  8018c0:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8018c6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8018c9:	39 fa                	cmp    %edi,%edx
+  8018cb:	73 9d                	jae    80186a <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8018cd:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8018d0:	39 fa                	cmp    %edi,%edx
+  8018d2:	72 96                	jb     80186a <sfork+0xe1>
+  8018d4:	eb 8f                	jmp    801865 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8018d6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8018dc:	89 da                	mov    %ebx,%edx
+  8018de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018e1:	e8 8c fa ff ff       	call   801372 <duppage_cow>
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	79 a8                	jns    801892 <sfork+0x109>
+  8018ea:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8018ec:	89 f8                	mov    %edi,%eax
+  8018ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f1:	5b                   	pop    %ebx
+  8018f2:	5e                   	pop    %esi
+  8018f3:	5f                   	pop    %edi
+  8018f4:	5d                   	pop    %ebp
+  8018f5:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8018f6:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8018fb:	e8 2e fb ff ff       	call   80142e <cow_copy>
+  801900:	85 c0                	test   %eax,%eax
+  801902:	0f 88 d2 00 00 00    	js     8019da <sfork+0x251>
+				pte = uvpt[pn];
+  801908:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80190f:	e9 66 ff ff ff       	jmp    80187a <sfork+0xf1>
+  801914:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801917:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80191a:	83 c6 01             	add    $0x1,%esi
+  80191d:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801923:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801929:	74 1b                	je     801946 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80192b:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801932:	a8 01                	test   $0x1,%al
+  801934:	74 e4                	je     80191a <sfork+0x191>
+  801936:	89 f3                	mov    %esi,%ebx
+  801938:	c1 e3 0a             	shl    $0xa,%ebx
+  80193b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80193e:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801941:	e9 4f ff ff ff       	jmp    801895 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801946:	83 ec 04             	sub    $0x4,%esp
+  801949:	6a 07                	push   $0x7
+  80194b:	68 00 f0 bf ee       	push   $0xeebff000
+  801950:	ff 75 e0             	push   -0x20(%ebp)
+  801953:	e8 78 f5 ff ff       	call   800ed0 <sys_page_alloc>
+  801958:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	85 c0                	test   %eax,%eax
+  80195f:	78 37                	js     801998 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801961:	83 ec 08             	sub    $0x8,%esp
+  801964:	68 ef 46 80 00       	push   $0x8046ef
+  801969:	ff 75 e0             	push   -0x20(%ebp)
+  80196c:	e8 dc f6 ff ff       	call   80104d <sys_env_set_pgfault_upcall>
+  801971:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801973:	83 c4 10             	add    $0x10,%esp
+  801976:	85 c0                	test   %eax,%eax
+  801978:	78 34                	js     8019ae <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80197a:	83 ec 08             	sub    $0x8,%esp
+  80197d:	6a 02                	push   $0x2
+  80197f:	ff 75 e0             	push   -0x20(%ebp)
+  801982:	e8 2e f6 ff ff       	call   800fb5 <sys_env_set_status>
+  801987:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 34                	js     8019c4 <sfork+0x23b>
+	return eid;
+  801990:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801993:	e9 54 ff ff ff       	jmp    8018ec <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801998:	83 ec 08             	sub    $0x8,%esp
+  80199b:	50                   	push   %eax
+  80199c:	68 b4 4f 80 00       	push   $0x804fb4
+  8019a1:	e8 08 eb ff ff       	call   8004ae <cprintf>
+		return r;
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	e9 3e ff ff ff       	jmp    8018ec <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8019ae:	83 ec 08             	sub    $0x8,%esp
+  8019b1:	50                   	push   %eax
+  8019b2:	68 dc 4f 80 00       	push   $0x804fdc
+  8019b7:	e8 f2 ea ff ff       	call   8004ae <cprintf>
+		return r;
+  8019bc:	83 c4 10             	add    $0x10,%esp
+  8019bf:	e9 28 ff ff ff       	jmp    8018ec <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8019c4:	83 ec 08             	sub    $0x8,%esp
+  8019c7:	50                   	push   %eax
+  8019c8:	68 51 50 80 00       	push   $0x805051
+  8019cd:	e8 dc ea ff ff       	call   8004ae <cprintf>
+		return r;
+  8019d2:	83 c4 10             	add    $0x10,%esp
+  8019d5:	e9 12 ff ff ff       	jmp    8018ec <sfork+0x163>
+  8019da:	89 c7                	mov    %eax,%edi
+  8019dc:	e9 0b ff ff ff       	jmp    8018ec <sfork+0x163>
+  8019e1:	89 c7                	mov    %eax,%edi
+  8019e3:	e9 04 ff ff ff       	jmp    8018ec <sfork+0x163>
+
+008019e8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8019e8:	55                   	push   %ebp
+  8019e9:	89 e5                	mov    %esp,%ebp
+  8019eb:	57                   	push   %edi
+  8019ec:	56                   	push   %esi
+  8019ed:	53                   	push   %ebx
+  8019ee:	83 ec 18             	sub    $0x18,%esp
+  8019f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801a01:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  801a04:	50                   	push   %eax
+  801a05:	e8 bc f6 ff ff       	call   8010c6 <sys_ipc_recv>
+	if (r < 0) {
+  801a0a:	83 c4 10             	add    $0x10,%esp
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 2b                	js     801a3c <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  801a11:	85 ff                	test   %edi,%edi
+  801a13:	74 55                	je     801a6a <ipc_recv+0x82>
+  801a15:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a17:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a1d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a22:	77 39                	ja     801a5d <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a24:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a29:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a2b:	c1 e8 10             	shr    $0x10,%eax
+  801a2e:	74 2d                	je     801a5d <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a30:	c1 e0 10             	shl    $0x10,%eax
+  801a33:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a38:	29 c2                	sub    %eax,%edx
+  801a3a:	eb 27                	jmp    801a63 <ipc_recv+0x7b>
+  801a3c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801a3e:	83 ec 08             	sub    $0x8,%esp
+  801a41:	50                   	push   %eax
+  801a42:	68 6f 50 80 00       	push   $0x80506f
+  801a47:	e8 62 ea ff ff       	call   8004ae <cprintf>
+		*from_env_store = 0;
+  801a4c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801a52:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	eb 77                	jmp    801ad4 <ipc_recv+0xec>
+		return pthread_main_tls;
+  801a5d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801a63:	8b 02                	mov    (%edx),%eax
+  801a65:	8b 40 78             	mov    0x78(%eax),%eax
+  801a68:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801a6a:	85 f6                	test   %esi,%esi
+  801a6c:	74 34                	je     801aa2 <ipc_recv+0xba>
+  801a6e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a70:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a76:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a7b:	77 18                	ja     801a95 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a7d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a82:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a84:	c1 e8 10             	shr    $0x10,%eax
+  801a87:	74 0c                	je     801a95 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a89:	c1 e0 10             	shl    $0x10,%eax
+  801a8c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a91:	29 c2                	sub    %eax,%edx
+  801a93:	eb 06                	jmp    801a9b <ipc_recv+0xb3>
+		return pthread_main_tls;
+  801a95:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  801a9b:	8b 02                	mov    (%edx),%eax
+  801a9d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801aa0:	89 06                	mov    %eax,(%esi)
+  801aa2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801aa4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801aaa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801aaf:	77 18                	ja     801ac9 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ab1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ab6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ab8:	c1 e8 10             	shr    $0x10,%eax
+  801abb:	74 0c                	je     801ac9 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801abd:	c1 e0 10             	shl    $0x10,%eax
+  801ac0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ac5:	29 c2                	sub    %eax,%edx
+  801ac7:	eb 06                	jmp    801acf <ipc_recv+0xe7>
+		return pthread_main_tls;
+  801ac9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  801acf:	8b 02                	mov    (%edx),%eax
+  801ad1:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  801ad4:	89 d8                	mov    %ebx,%eax
+  801ad6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad9:	5b                   	pop    %ebx
+  801ada:	5e                   	pop    %esi
+  801adb:	5f                   	pop    %edi
+  801adc:	5d                   	pop    %ebp
+  801add:	c3                   	ret
+
+00801ade <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	57                   	push   %edi
+  801ae2:	56                   	push   %esi
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 0c             	sub    $0xc,%esp
+  801ae7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801aea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aed:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801af0:	85 db                	test   %ebx,%ebx
+  801af2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801af7:	0f 44 d8             	cmove  %eax,%ebx
+  801afa:	eb 05                	jmp    801b01 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801afc:	e8 a3 f3 ff ff       	call   800ea4 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801b01:	57                   	push   %edi
+  801b02:	53                   	push   %ebx
+  801b03:	ff 75 0c             	push   0xc(%ebp)
+  801b06:	56                   	push   %esi
+  801b07:	e8 8d f5 ff ff       	call   801099 <sys_ipc_try_send>
+		if (r == 0) {
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	74 19                	je     801b2c <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  801b13:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b16:	74 e4                	je     801afc <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	50                   	push   %eax
+  801b1c:	57                   	push   %edi
+  801b1d:	53                   	push   %ebx
+  801b1e:	56                   	push   %esi
+  801b1f:	68 88 50 80 00       	push   $0x805088
+  801b24:	e8 85 e9 ff ff       	call   8004ae <cprintf>
+			return;
+  801b29:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  801b2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b2f:	5b                   	pop    %ebx
+  801b30:	5e                   	pop    %esi
+  801b31:	5f                   	pop    %edi
+  801b32:	5d                   	pop    %ebp
+  801b33:	c3                   	ret
+
+00801b34 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801b3f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801b42:	c1 e0 04             	shl    $0x4,%eax
+  801b45:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b4a:	8b 40 50             	mov    0x50(%eax),%eax
+  801b4d:	39 c8                	cmp    %ecx,%eax
+  801b4f:	74 12                	je     801b63 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801b51:	83 c2 01             	add    $0x1,%edx
+  801b54:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801b5a:	75 e3                	jne    801b3f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b61:	eb 0e                	jmp    801b71 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801b63:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801b66:	c1 e0 04             	shl    $0x4,%eax
+  801b69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b6e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801b71:	5d                   	pop    %ebp
+  801b72:	c3                   	ret
+
+00801b73 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b79:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b7e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b81:	5d                   	pop    %ebp
+  801b82:	c3                   	ret
+
+00801b83 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b83:	55                   	push   %ebp
+  801b84:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b89:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b8e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b93:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b98:	5d                   	pop    %ebp
+  801b99:	c3                   	ret
+
+00801b9a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b9d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801ba2:	eb 02                	jmp    801ba6 <fd_alloc+0xc>
+  801ba4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ba6:	89 c2                	mov    %eax,%edx
+  801ba8:	c1 ea 16             	shr    $0x16,%edx
+  801bab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bb2:	f6 c2 01             	test   $0x1,%dl
+  801bb5:	74 2b                	je     801be2 <fd_alloc+0x48>
+  801bb7:	89 c2                	mov    %eax,%edx
+  801bb9:	c1 ea 0c             	shr    $0xc,%edx
+  801bbc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801bc3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bc9:	f6 c1 01             	test   $0x1,%cl
+  801bcc:	74 14                	je     801be2 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801bce:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801bd4:	75 ce                	jne    801ba4 <fd_alloc+0xa>
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bdb:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801be0:	eb 05                	jmp    801be7 <fd_alloc+0x4d>
+			return 0;
+  801be2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801be7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bea:	89 02                	mov    %eax,(%edx)
+}
+  801bec:	89 c8                	mov    %ecx,%eax
+  801bee:	5d                   	pop    %ebp
+  801bef:	c3                   	ret
+
+00801bf0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801bf6:	83 f8 1f             	cmp    $0x1f,%eax
+  801bf9:	77 30                	ja     801c2b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bfb:	c1 e0 0c             	shl    $0xc,%eax
+  801bfe:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c03:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c09:	f6 c2 01             	test   $0x1,%dl
+  801c0c:	74 24                	je     801c32 <fd_lookup+0x42>
+  801c0e:	89 c2                	mov    %eax,%edx
+  801c10:	c1 ea 0c             	shr    $0xc,%edx
+  801c13:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c1a:	f6 c2 01             	test   $0x1,%dl
+  801c1d:	74 1a                	je     801c39 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c22:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c29:	5d                   	pop    %ebp
+  801c2a:	c3                   	ret
+		return -E_INVAL;
+  801c2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c30:	eb f7                	jmp    801c29 <fd_lookup+0x39>
+		return -E_INVAL;
+  801c32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c37:	eb f0                	jmp    801c29 <fd_lookup+0x39>
+  801c39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3e:	eb e9                	jmp    801c29 <fd_lookup+0x39>
+
+00801c40 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 04             	sub    $0x4,%esp
+  801c47:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4f:	eb 03                	jmp    801c54 <dev_lookup+0x14>
+  801c51:	83 c0 01             	add    $0x1,%eax
+  801c54:	8b 1c 85 3c 51 80 00 	mov    0x80513c(,%eax,4),%ebx
+  801c5b:	85 db                	test   %ebx,%ebx
+  801c5d:	74 0b                	je     801c6a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801c5f:	39 13                	cmp    %edx,(%ebx)
+  801c61:	75 ee                	jne    801c51 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	eb 49                	jmp    801cb3 <dev_lookup+0x73>
+  801c6a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c6c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801c72:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c77:	77 18                	ja     801c91 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c79:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c7e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801c80:	c1 e8 10             	shr    $0x10,%eax
+  801c83:	74 0c                	je     801c91 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c85:	c1 e0 10             	shl    $0x10,%eax
+  801c88:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801c8d:	29 c1                	sub    %eax,%ecx
+  801c8f:	eb 06                	jmp    801c97 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801c91:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c97:	8b 01                	mov    (%ecx),%eax
+  801c99:	8b 40 48             	mov    0x48(%eax),%eax
+  801c9c:	83 ec 04             	sub    $0x4,%esp
+  801c9f:	52                   	push   %edx
+  801ca0:	50                   	push   %eax
+  801ca1:	68 c0 50 80 00       	push   $0x8050c0
+  801ca6:	e8 03 e8 ff ff       	call   8004ae <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801cb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cb6:	89 1a                	mov    %ebx,(%edx)
+}
+  801cb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbb:	c9                   	leave
+  801cbc:	c3                   	ret
+
+00801cbd <fd_close>:
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	57                   	push   %edi
+  801cc1:	56                   	push   %esi
+  801cc2:	53                   	push   %ebx
+  801cc3:	83 ec 24             	sub    $0x24,%esp
+  801cc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cc9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ccc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ccf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801cd0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cd6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cd9:	50                   	push   %eax
+  801cda:	e8 11 ff ff ff       	call   801bf0 <fd_lookup>
+  801cdf:	89 c3                	mov    %eax,%ebx
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  801ce4:	85 c0                	test   %eax,%eax
+  801ce6:	78 05                	js     801ced <fd_close+0x30>
+	    || fd != fd2)
+  801ce8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ceb:	74 16                	je     801d03 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ced:	89 f8                	mov    %edi,%eax
+  801cef:	84 c0                	test   %al,%al
+  801cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf6:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801cf9:	89 d8                	mov    %ebx,%eax
+  801cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfe:	5b                   	pop    %ebx
+  801cff:	5e                   	pop    %esi
+  801d00:	5f                   	pop    %edi
+  801d01:	5d                   	pop    %ebp
+  801d02:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d03:	83 ec 08             	sub    $0x8,%esp
+  801d06:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d09:	50                   	push   %eax
+  801d0a:	ff 36                	push   (%esi)
+  801d0c:	e8 2f ff ff ff       	call   801c40 <dev_lookup>
+  801d11:	89 c3                	mov    %eax,%ebx
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	78 1a                	js     801d34 <fd_close+0x77>
+		if (dev->dev_close)
+  801d1a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d1d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	74 0b                	je     801d34 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d29:	83 ec 0c             	sub    $0xc,%esp
+  801d2c:	56                   	push   %esi
+  801d2d:	ff d0                	call   *%eax
+  801d2f:	89 c3                	mov    %eax,%ebx
+  801d31:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	56                   	push   %esi
+  801d38:	6a 00                	push   $0x0
+  801d3a:	e8 2a f2 ff ff       	call   800f69 <sys_page_unmap>
+	return r;
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	eb b5                	jmp    801cf9 <fd_close+0x3c>
+
+00801d44 <close>:
+
+int
+close(int fdnum)
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4d:	50                   	push   %eax
+  801d4e:	ff 75 08             	push   0x8(%ebp)
+  801d51:	e8 9a fe ff ff       	call   801bf0 <fd_lookup>
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	79 02                	jns    801d5f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d5d:	c9                   	leave
+  801d5e:	c3                   	ret
+		return fd_close(fd, 1);
+  801d5f:	83 ec 08             	sub    $0x8,%esp
+  801d62:	6a 01                	push   $0x1
+  801d64:	ff 75 f4             	push   -0xc(%ebp)
+  801d67:	e8 51 ff ff ff       	call   801cbd <fd_close>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	eb ec                	jmp    801d5d <close+0x19>
+
+00801d71 <close_all>:
+
+void
+close_all(void)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	53                   	push   %ebx
+  801d75:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d78:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d7d:	83 ec 0c             	sub    $0xc,%esp
+  801d80:	53                   	push   %ebx
+  801d81:	e8 be ff ff ff       	call   801d44 <close>
+	for (i = 0; i < MAXFD; i++)
+  801d86:	83 c3 01             	add    $0x1,%ebx
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	83 fb 20             	cmp    $0x20,%ebx
+  801d8f:	75 ec                	jne    801d7d <close_all+0xc>
+}
+  801d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+
+00801d96 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d96:	55                   	push   %ebp
+  801d97:	89 e5                	mov    %esp,%ebp
+  801d99:	57                   	push   %edi
+  801d9a:	56                   	push   %esi
+  801d9b:	53                   	push   %ebx
+  801d9c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d9f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801da2:	50                   	push   %eax
+  801da3:	ff 75 08             	push   0x8(%ebp)
+  801da6:	e8 45 fe ff ff       	call   801bf0 <fd_lookup>
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 7f                	js     801e33 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	ff 75 0c             	push   0xc(%ebp)
+  801dba:	e8 85 ff ff ff       	call   801d44 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801dbf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dc2:	c1 e6 0c             	shl    $0xc,%esi
+  801dc5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801dcb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dce:	89 3c 24             	mov    %edi,(%esp)
+  801dd1:	e8 ad fd ff ff       	call   801b83 <fd2data>
+  801dd6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801dd8:	89 34 24             	mov    %esi,(%esp)
+  801ddb:	e8 a3 fd ff ff       	call   801b83 <fd2data>
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801de6:	89 d8                	mov    %ebx,%eax
+  801de8:	c1 e8 16             	shr    $0x16,%eax
+  801deb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801df2:	a8 01                	test   $0x1,%al
+  801df4:	74 11                	je     801e07 <dup+0x71>
+  801df6:	89 d8                	mov    %ebx,%eax
+  801df8:	c1 e8 0c             	shr    $0xc,%eax
+  801dfb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e02:	f6 c2 01             	test   $0x1,%dl
+  801e05:	75 36                	jne    801e3d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e07:	89 f8                	mov    %edi,%eax
+  801e09:	c1 e8 0c             	shr    $0xc,%eax
+  801e0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e13:	83 ec 0c             	sub    $0xc,%esp
+  801e16:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e1b:	50                   	push   %eax
+  801e1c:	56                   	push   %esi
+  801e1d:	6a 00                	push   $0x0
+  801e1f:	57                   	push   %edi
+  801e20:	6a 00                	push   $0x0
+  801e22:	e8 f6 f0 ff ff       	call   800f1d <sys_page_map>
+  801e27:	89 c3                	mov    %eax,%ebx
+  801e29:	83 c4 20             	add    $0x20,%esp
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 33                	js     801e63 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e33:	89 d8                	mov    %ebx,%eax
+  801e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e38:	5b                   	pop    %ebx
+  801e39:	5e                   	pop    %esi
+  801e3a:	5f                   	pop    %edi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e3d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e4c:	50                   	push   %eax
+  801e4d:	ff 75 d4             	push   -0x2c(%ebp)
+  801e50:	6a 00                	push   $0x0
+  801e52:	53                   	push   %ebx
+  801e53:	6a 00                	push   $0x0
+  801e55:	e8 c3 f0 ff ff       	call   800f1d <sys_page_map>
+  801e5a:	89 c3                	mov    %eax,%ebx
+  801e5c:	83 c4 20             	add    $0x20,%esp
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	79 a4                	jns    801e07 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e63:	83 ec 08             	sub    $0x8,%esp
+  801e66:	56                   	push   %esi
+  801e67:	6a 00                	push   $0x0
+  801e69:	e8 fb f0 ff ff       	call   800f69 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e6e:	83 c4 08             	add    $0x8,%esp
+  801e71:	ff 75 d4             	push   -0x2c(%ebp)
+  801e74:	6a 00                	push   $0x0
+  801e76:	e8 ee f0 ff ff       	call   800f69 <sys_page_unmap>
+	return r;
+  801e7b:	83 c4 10             	add    $0x10,%esp
+  801e7e:	eb b3                	jmp    801e33 <dup+0x9d>
+
+00801e80 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 18             	sub    $0x18,%esp
+  801e88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e8e:	50                   	push   %eax
+  801e8f:	53                   	push   %ebx
+  801e90:	e8 5b fd ff ff       	call   801bf0 <fd_lookup>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 3c                	js     801ed8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e9f:	83 ec 08             	sub    $0x8,%esp
+  801ea2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea5:	50                   	push   %eax
+  801ea6:	ff 36                	push   (%esi)
+  801ea8:	e8 93 fd ff ff       	call   801c40 <dev_lookup>
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 24                	js     801ed8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801eb4:	8b 46 08             	mov    0x8(%esi),%eax
+  801eb7:	83 e0 03             	and    $0x3,%eax
+  801eba:	83 f8 01             	cmp    $0x1,%eax
+  801ebd:	74 20                	je     801edf <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec2:	8b 40 08             	mov    0x8(%eax),%eax
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	74 61                	je     801f2a <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	ff 75 10             	push   0x10(%ebp)
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	56                   	push   %esi
+  801ed3:	ff d0                	call   *%eax
+  801ed5:	83 c4 10             	add    $0x10,%esp
+}
+  801ed8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edb:	5b                   	pop    %ebx
+  801edc:	5e                   	pop    %esi
+  801edd:	5d                   	pop    %ebp
+  801ede:	c3                   	ret
+  801edf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ee1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ee7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801eec:	77 18                	ja     801f06 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801eee:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ef3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ef5:	c1 e8 10             	shr    $0x10,%eax
+  801ef8:	74 0c                	je     801f06 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801efa:	c1 e0 10             	shl    $0x10,%eax
+  801efd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f02:	29 c2                	sub    %eax,%edx
+  801f04:	eb 06                	jmp    801f0c <read+0x8c>
+		return pthread_main_tls;
+  801f06:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f0c:	8b 02                	mov    (%edx),%eax
+  801f0e:	8b 40 48             	mov    0x48(%eax),%eax
+  801f11:	83 ec 04             	sub    $0x4,%esp
+  801f14:	53                   	push   %ebx
+  801f15:	50                   	push   %eax
+  801f16:	68 01 51 80 00       	push   $0x805101
+  801f1b:	e8 8e e5 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f28:	eb ae                	jmp    801ed8 <read+0x58>
+		return -E_NOT_SUPP;
+  801f2a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f2f:	eb a7                	jmp    801ed8 <read+0x58>
+
+00801f31 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	57                   	push   %edi
+  801f35:	56                   	push   %esi
+  801f36:	53                   	push   %ebx
+  801f37:	83 ec 0c             	sub    $0xc,%esp
+  801f3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f3d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f45:	eb 02                	jmp    801f49 <readn+0x18>
+  801f47:	01 c3                	add    %eax,%ebx
+  801f49:	39 f3                	cmp    %esi,%ebx
+  801f4b:	73 21                	jae    801f6e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f4d:	83 ec 04             	sub    $0x4,%esp
+  801f50:	89 f0                	mov    %esi,%eax
+  801f52:	29 d8                	sub    %ebx,%eax
+  801f54:	50                   	push   %eax
+  801f55:	89 d8                	mov    %ebx,%eax
+  801f57:	03 45 0c             	add    0xc(%ebp),%eax
+  801f5a:	50                   	push   %eax
+  801f5b:	57                   	push   %edi
+  801f5c:	e8 1f ff ff ff       	call   801e80 <read>
+		if (m < 0)
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	85 c0                	test   %eax,%eax
+  801f66:	78 04                	js     801f6c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f68:	75 dd                	jne    801f47 <readn+0x16>
+  801f6a:	eb 02                	jmp    801f6e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f6c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f6e:	89 d8                	mov    %ebx,%eax
+  801f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f73:	5b                   	pop    %ebx
+  801f74:	5e                   	pop    %esi
+  801f75:	5f                   	pop    %edi
+  801f76:	5d                   	pop    %ebp
+  801f77:	c3                   	ret
+
+00801f78 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	56                   	push   %esi
+  801f7c:	53                   	push   %ebx
+  801f7d:	83 ec 18             	sub    $0x18,%esp
+  801f80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	53                   	push   %ebx
+  801f88:	e8 63 fc ff ff       	call   801bf0 <fd_lookup>
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	78 37                	js     801fcb <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f94:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f97:	83 ec 08             	sub    $0x8,%esp
+  801f9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f9d:	50                   	push   %eax
+  801f9e:	ff 36                	push   (%esi)
+  801fa0:	e8 9b fc ff ff       	call   801c40 <dev_lookup>
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 1f                	js     801fcb <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fac:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fb0:	74 20                	je     801fd2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	74 61                	je     80201d <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fbc:	83 ec 04             	sub    $0x4,%esp
+  801fbf:	ff 75 10             	push   0x10(%ebp)
+  801fc2:	ff 75 0c             	push   0xc(%ebp)
+  801fc5:	56                   	push   %esi
+  801fc6:	ff d0                	call   *%eax
+  801fc8:	83 c4 10             	add    $0x10,%esp
+}
+  801fcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fce:	5b                   	pop    %ebx
+  801fcf:	5e                   	pop    %esi
+  801fd0:	5d                   	pop    %ebp
+  801fd1:	c3                   	ret
+  801fd2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801fd4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801fda:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801fdf:	77 18                	ja     801ff9 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801fe1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801fe6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801fe8:	c1 e8 10             	shr    $0x10,%eax
+  801feb:	74 0c                	je     801ff9 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801fed:	c1 e0 10             	shl    $0x10,%eax
+  801ff0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ff5:	29 c2                	sub    %eax,%edx
+  801ff7:	eb 06                	jmp    801fff <write+0x87>
+		return pthread_main_tls;
+  801ff9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fff:	8b 02                	mov    (%edx),%eax
+  802001:	8b 40 48             	mov    0x48(%eax),%eax
+  802004:	83 ec 04             	sub    $0x4,%esp
+  802007:	53                   	push   %ebx
+  802008:	50                   	push   %eax
+  802009:	68 1d 51 80 00       	push   $0x80511d
+  80200e:	e8 9b e4 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80201b:	eb ae                	jmp    801fcb <write+0x53>
+		return -E_NOT_SUPP;
+  80201d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802022:	eb a7                	jmp    801fcb <write+0x53>
+
+00802024 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80202a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80202d:	50                   	push   %eax
+  80202e:	ff 75 08             	push   0x8(%ebp)
+  802031:	e8 ba fb ff ff       	call   801bf0 <fd_lookup>
+  802036:	83 c4 10             	add    $0x10,%esp
+  802039:	85 c0                	test   %eax,%eax
+  80203b:	78 0e                	js     80204b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80203d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802040:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802043:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802046:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+0080204d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	56                   	push   %esi
+  802051:	53                   	push   %ebx
+  802052:	83 ec 18             	sub    $0x18,%esp
+  802055:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802058:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80205b:	50                   	push   %eax
+  80205c:	53                   	push   %ebx
+  80205d:	e8 8e fb ff ff       	call   801bf0 <fd_lookup>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 34                	js     80209d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802069:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80206c:	83 ec 08             	sub    $0x8,%esp
+  80206f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802072:	50                   	push   %eax
+  802073:	ff 36                	push   (%esi)
+  802075:	e8 c6 fb ff ff       	call   801c40 <dev_lookup>
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	78 1c                	js     80209d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802081:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802085:	74 1d                	je     8020a4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80208a:	8b 40 18             	mov    0x18(%eax),%eax
+  80208d:	85 c0                	test   %eax,%eax
+  80208f:	74 5e                	je     8020ef <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802091:	83 ec 08             	sub    $0x8,%esp
+  802094:	ff 75 0c             	push   0xc(%ebp)
+  802097:	56                   	push   %esi
+  802098:	ff d0                	call   *%eax
+  80209a:	83 c4 10             	add    $0x10,%esp
+}
+  80209d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a0:	5b                   	pop    %ebx
+  8020a1:	5e                   	pop    %esi
+  8020a2:	5d                   	pop    %ebp
+  8020a3:	c3                   	ret
+  8020a4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8020a6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8020ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8020b1:	77 18                	ja     8020cb <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8020b3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8020b8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8020ba:	c1 e8 10             	shr    $0x10,%eax
+  8020bd:	74 0c                	je     8020cb <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8020bf:	c1 e0 10             	shl    $0x10,%eax
+  8020c2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8020c7:	29 c2                	sub    %eax,%edx
+  8020c9:	eb 06                	jmp    8020d1 <ftruncate+0x84>
+		return pthread_main_tls;
+  8020cb:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  8020d1:	8b 02                	mov    (%edx),%eax
+  8020d3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020d6:	83 ec 04             	sub    $0x4,%esp
+  8020d9:	53                   	push   %ebx
+  8020da:	50                   	push   %eax
+  8020db:	68 e0 50 80 00       	push   $0x8050e0
+  8020e0:	e8 c9 e3 ff ff       	call   8004ae <cprintf>
+		return -E_INVAL;
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ed:	eb ae                	jmp    80209d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8020ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f4:	eb a7                	jmp    80209d <ftruncate+0x50>
+
+008020f6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	56                   	push   %esi
+  8020fa:	53                   	push   %ebx
+  8020fb:	83 ec 18             	sub    $0x18,%esp
+  8020fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802101:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802104:	50                   	push   %eax
+  802105:	ff 75 08             	push   0x8(%ebp)
+  802108:	e8 e3 fa ff ff       	call   801bf0 <fd_lookup>
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 49                	js     80215d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802114:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802117:	83 ec 08             	sub    $0x8,%esp
+  80211a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80211d:	50                   	push   %eax
+  80211e:	ff 36                	push   (%esi)
+  802120:	e8 1b fb ff ff       	call   801c40 <dev_lookup>
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 31                	js     80215d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80212c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802133:	74 2f                	je     802164 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802135:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802138:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80213f:	00 00 00 
+	stat->st_isdir = 0;
+  802142:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802149:	00 00 00 
+	stat->st_dev = dev;
+  80214c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802152:	83 ec 08             	sub    $0x8,%esp
+  802155:	53                   	push   %ebx
+  802156:	56                   	push   %esi
+  802157:	ff 50 14             	call   *0x14(%eax)
+  80215a:	83 c4 10             	add    $0x10,%esp
+}
+  80215d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802160:	5b                   	pop    %ebx
+  802161:	5e                   	pop    %esi
+  802162:	5d                   	pop    %ebp
+  802163:	c3                   	ret
+		return -E_NOT_SUPP;
+  802164:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802169:	eb f2                	jmp    80215d <fstat+0x67>
+
+0080216b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80216b:	55                   	push   %ebp
+  80216c:	89 e5                	mov    %esp,%ebp
+  80216e:	56                   	push   %esi
+  80216f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802170:	83 ec 08             	sub    $0x8,%esp
+  802173:	6a 00                	push   $0x0
+  802175:	ff 75 08             	push   0x8(%ebp)
+  802178:	e8 4b 03 00 00       	call   8024c8 <open>
+  80217d:	89 c3                	mov    %eax,%ebx
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 1b                	js     8021a1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802186:	83 ec 08             	sub    $0x8,%esp
+  802189:	ff 75 0c             	push   0xc(%ebp)
+  80218c:	50                   	push   %eax
+  80218d:	e8 64 ff ff ff       	call   8020f6 <fstat>
+  802192:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802194:	89 1c 24             	mov    %ebx,(%esp)
+  802197:	e8 a8 fb ff ff       	call   801d44 <close>
+	return r;
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	89 f3                	mov    %esi,%ebx
+}
+  8021a1:	89 d8                	mov    %ebx,%eax
+  8021a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a6:	5b                   	pop    %ebx
+  8021a7:	5e                   	pop    %esi
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+
+008021aa <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	56                   	push   %esi
+  8021ae:	53                   	push   %ebx
+  8021af:	89 c6                	mov    %eax,%esi
+  8021b1:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8021b3:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  8021ba:	74 27                	je     8021e3 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8021bc:	6a 07                	push   $0x7
+  8021be:	68 00 80 80 00       	push   $0x808000
+  8021c3:	56                   	push   %esi
+  8021c4:	ff 35 04 70 80 00    	push   0x807004
+  8021ca:	e8 0f f9 ff ff       	call   801ade <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8021cf:	83 c4 0c             	add    $0xc,%esp
+  8021d2:	6a 00                	push   $0x0
+  8021d4:	53                   	push   %ebx
+  8021d5:	6a 00                	push   $0x0
+  8021d7:	e8 0c f8 ff ff       	call   8019e8 <ipc_recv>
+}
+  8021dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021df:	5b                   	pop    %ebx
+  8021e0:	5e                   	pop    %esi
+  8021e1:	5d                   	pop    %ebp
+  8021e2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021e3:	83 ec 0c             	sub    $0xc,%esp
+  8021e6:	6a 01                	push   $0x1
+  8021e8:	e8 47 f9 ff ff       	call   801b34 <ipc_find_env>
+  8021ed:	a3 04 70 80 00       	mov    %eax,0x807004
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	eb c5                	jmp    8021bc <fsipc+0x12>
+
+008021f7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	53                   	push   %ebx
+  8021fb:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8021fe:	68 08 70 80 00       	push   $0x807008
+  802203:	e8 29 1b 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802208:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80220e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  802213:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802216:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80221b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802220:	b8 02 00 00 00       	mov    $0x2,%eax
+  802225:	e8 80 ff ff ff       	call   8021aa <fsipc>
+  80222a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80222c:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  802233:	e8 66 1b 00 00       	call   803d9e <mutex_unlock>
+	return r;
+}
+  802238:	89 d8                	mov    %ebx,%eax
+  80223a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+
+0080223f <devfile_flush>:
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	53                   	push   %ebx
+  802243:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802246:	68 08 70 80 00       	push   $0x807008
+  80224b:	e8 e1 1a 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802250:	8b 45 08             	mov    0x8(%ebp),%eax
+  802253:	8b 40 0c             	mov    0xc(%eax),%eax
+  802256:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80225b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802260:	b8 06 00 00 00       	mov    $0x6,%eax
+  802265:	e8 40 ff ff ff       	call   8021aa <fsipc>
+  80226a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80226c:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  802273:	e8 26 1b 00 00       	call   803d9e <mutex_unlock>
+}
+  802278:	89 d8                	mov    %ebx,%eax
+  80227a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+
+0080227f <devfile_stat>:
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802287:	83 ec 0c             	sub    $0xc,%esp
+  80228a:	68 08 70 80 00       	push   $0x807008
+  80228f:	e8 9d 1a 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802294:	8b 45 08             	mov    0x8(%ebp),%eax
+  802297:	8b 40 0c             	mov    0xc(%eax),%eax
+  80229a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80229f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022a9:	e8 fc fe ff ff       	call   8021aa <fsipc>
+  8022ae:	89 c3                	mov    %eax,%ebx
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	85 c0                	test   %eax,%eax
+  8022b5:	79 16                	jns    8022cd <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8022b7:	83 ec 0c             	sub    $0xc,%esp
+  8022ba:	68 08 70 80 00       	push   $0x807008
+  8022bf:	e8 da 1a 00 00       	call   803d9e <mutex_unlock>
+}
+  8022c4:	89 d8                	mov    %ebx,%eax
+  8022c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c9:	5b                   	pop    %ebx
+  8022ca:	5e                   	pop    %esi
+  8022cb:	5d                   	pop    %ebp
+  8022cc:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+  8022d0:	68 00 80 80 00       	push   $0x808000
+  8022d5:	56                   	push   %esi
+  8022d6:	e8 b7 e7 ff ff       	call   800a92 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8022db:	a1 80 80 80 00       	mov    0x808080,%eax
+  8022e0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022e6:	a1 84 80 80 00       	mov    0x808084,%eax
+  8022eb:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8022f1:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8022f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022f9:	eb bc                	jmp    8022b7 <devfile_stat+0x38>
+
+008022fb <devfile_write>:
+{
+  8022fb:	55                   	push   %ebp
+  8022fc:	89 e5                	mov    %esp,%ebp
+  8022fe:	53                   	push   %ebx
+  8022ff:	83 ec 10             	sub    $0x10,%esp
+  802302:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802305:	68 08 70 80 00       	push   $0x807008
+  80230a:	e8 22 1a 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80230f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802312:	8b 40 0c             	mov    0xc(%eax),%eax
+  802315:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802323:	76 3d                	jbe    802362 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802325:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80232a:	39 c3                	cmp    %eax,%ebx
+  80232c:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80232f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802332:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802337:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80233d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802342:	b8 04 00 00 00       	mov    $0x4,%eax
+  802347:	e8 5e fe ff ff       	call   8021aa <fsipc>
+  80234c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80234e:	83 ec 0c             	sub    $0xc,%esp
+  802351:	68 08 70 80 00       	push   $0x807008
+  802356:	e8 43 1a 00 00       	call   803d9e <mutex_unlock>
+}
+  80235b:	89 d8                	mov    %ebx,%eax
+  80235d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802362:	83 ec 04             	sub    $0x4,%esp
+  802365:	53                   	push   %ebx
+  802366:	ff 75 0c             	push   0xc(%ebp)
+  802369:	68 0c 80 80 00       	push   $0x80800c
+  80236e:	e8 a5 e8 ff ff       	call   800c18 <memmove>
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237b:	eb b5                	jmp    802332 <devfile_write+0x37>
+
+0080237d <devfile_read>:
+{
+  80237d:	55                   	push   %ebp
+  80237e:	89 e5                	mov    %esp,%ebp
+  802380:	57                   	push   %edi
+  802381:	56                   	push   %esi
+  802382:	53                   	push   %ebx
+  802383:	83 ec 0c             	sub    $0xc,%esp
+  802386:	8b 75 08             	mov    0x8(%ebp),%esi
+  802389:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80238c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80238f:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802395:	0f 86 8c 00 00 00    	jbe    802427 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80239b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8023a0:	39 c3                	cmp    %eax,%ebx
+  8023a2:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8023a5:	89 f8                	mov    %edi,%eax
+  8023a7:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8023aa:	eb 0f                	jmp    8023bb <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8023ac:	0f b6 08             	movzbl (%eax),%ecx
+  8023af:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8023b1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023b6:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8023bb:	39 d0                	cmp    %edx,%eax
+  8023bd:	72 ed                	jb     8023ac <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8023bf:	83 ec 0c             	sub    $0xc,%esp
+  8023c2:	68 08 70 80 00       	push   $0x807008
+  8023c7:	e8 65 19 00 00       	call   803d31 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023cc:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023cf:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8023d4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8023da:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8023e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023ea:	e8 bb fd ff ff       	call   8021aa <fsipc>
+  8023ef:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8023f1:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  8023f8:	e8 a1 19 00 00       	call   803d9e <mutex_unlock>
+		assert(r <= (int) n);
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	39 f3                	cmp    %esi,%ebx
+  802402:	7c 0a                	jl     80240e <devfile_read+0x91>
+}
+  802404:	89 f0                	mov    %esi,%eax
+  802406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802409:	5b                   	pop    %ebx
+  80240a:	5e                   	pop    %esi
+  80240b:	5f                   	pop    %edi
+  80240c:	5d                   	pop    %ebp
+  80240d:	c3                   	ret
+		assert(r <= (int) n);
+  80240e:	68 50 51 80 00       	push   $0x805150
+  802413:	68 8b 4a 80 00       	push   $0x804a8b
+  802418:	68 90 00 00 00       	push   $0x90
+  80241d:	68 5d 51 80 00       	push   $0x80515d
+  802422:	e8 ac df ff ff       	call   8003d3 <_panic>
+	mutex_lock(&fsipc_mu);
+  802427:	83 ec 0c             	sub    $0xc,%esp
+  80242a:	68 08 70 80 00       	push   $0x807008
+  80242f:	e8 fd 18 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802434:	8b 46 0c             	mov    0xc(%esi),%eax
+  802437:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  80243c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802442:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802449:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80244c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802451:	b8 03 00 00 00       	mov    $0x3,%eax
+  802456:	e8 4f fd ff ff       	call   8021aa <fsipc>
+  80245b:	89 c6                	mov    %eax,%esi
+  80245d:	83 c4 10             	add    $0x10,%esp
+  802460:	85 c0                	test   %eax,%eax
+  802462:	78 1d                	js     802481 <devfile_read+0x104>
+		assert(r <= n);
+  802464:	39 c3                	cmp    %eax,%ebx
+  802466:	72 2e                	jb     802496 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802468:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80246d:	7f 40                	jg     8024af <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80246f:	83 ec 04             	sub    $0x4,%esp
+  802472:	50                   	push   %eax
+  802473:	68 00 80 80 00       	push   $0x808000
+  802478:	57                   	push   %edi
+  802479:	e8 9a e7 ff ff       	call   800c18 <memmove>
+  80247e:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802481:	83 ec 0c             	sub    $0xc,%esp
+  802484:	68 08 70 80 00       	push   $0x807008
+  802489:	e8 10 19 00 00       	call   803d9e <mutex_unlock>
+	return r;
+  80248e:	83 c4 10             	add    $0x10,%esp
+  802491:	e9 6e ff ff ff       	jmp    802404 <devfile_read+0x87>
+		assert(r <= n);
+  802496:	68 68 51 80 00       	push   $0x805168
+  80249b:	68 8b 4a 80 00       	push   $0x804a8b
+  8024a0:	68 99 00 00 00       	push   $0x99
+  8024a5:	68 5d 51 80 00       	push   $0x80515d
+  8024aa:	e8 24 df ff ff       	call   8003d3 <_panic>
+		assert(r <= PGSIZE);
+  8024af:	68 6f 51 80 00       	push   $0x80516f
+  8024b4:	68 8b 4a 80 00       	push   $0x804a8b
+  8024b9:	68 9a 00 00 00       	push   $0x9a
+  8024be:	68 5d 51 80 00       	push   $0x80515d
+  8024c3:	e8 0b df ff ff       	call   8003d3 <_panic>
+
+008024c8 <open>:
+{
+  8024c8:	55                   	push   %ebp
+  8024c9:	89 e5                	mov    %esp,%ebp
+  8024cb:	56                   	push   %esi
+  8024cc:	53                   	push   %ebx
+  8024cd:	83 ec 1c             	sub    $0x1c,%esp
+  8024d0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8024d3:	56                   	push   %esi
+  8024d4:	e8 7e e5 ff ff       	call   800a57 <strlen>
+  8024d9:	83 c4 10             	add    $0x10,%esp
+  8024dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024e1:	0f 8f 85 00 00 00    	jg     80256c <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8024e7:	83 ec 0c             	sub    $0xc,%esp
+  8024ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ed:	50                   	push   %eax
+  8024ee:	e8 a7 f6 ff ff       	call   801b9a <fd_alloc>
+  8024f3:	89 c3                	mov    %eax,%ebx
+  8024f5:	83 c4 10             	add    $0x10,%esp
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 55                	js     802551 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8024fc:	83 ec 0c             	sub    $0xc,%esp
+  8024ff:	68 08 70 80 00       	push   $0x807008
+  802504:	e8 28 18 00 00       	call   803d31 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802509:	83 c4 08             	add    $0x8,%esp
+  80250c:	56                   	push   %esi
+  80250d:	68 00 80 80 00       	push   $0x808000
+  802512:	e8 7b e5 ff ff       	call   800a92 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802517:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80251a:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  80251f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802522:	b8 01 00 00 00       	mov    $0x1,%eax
+  802527:	e8 7e fc ff ff       	call   8021aa <fsipc>
+  80252c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80252e:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  802535:	e8 64 18 00 00       	call   803d9e <mutex_unlock>
+	if (r < 0) {
+  80253a:	83 c4 10             	add    $0x10,%esp
+  80253d:	85 db                	test   %ebx,%ebx
+  80253f:	78 19                	js     80255a <open+0x92>
+	return fd2num(fd);
+  802541:	83 ec 0c             	sub    $0xc,%esp
+  802544:	ff 75 f4             	push   -0xc(%ebp)
+  802547:	e8 27 f6 ff ff       	call   801b73 <fd2num>
+  80254c:	89 c3                	mov    %eax,%ebx
+  80254e:	83 c4 10             	add    $0x10,%esp
+}
+  802551:	89 d8                	mov    %ebx,%eax
+  802553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5d                   	pop    %ebp
+  802559:	c3                   	ret
+		fd_close(fd, 0);
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	6a 00                	push   $0x0
+  80255f:	ff 75 f4             	push   -0xc(%ebp)
+  802562:	e8 56 f7 ff ff       	call   801cbd <fd_close>
+		return r;
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	eb e5                	jmp    802551 <open+0x89>
+		return -E_BAD_PATH;
+  80256c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802571:	eb de                	jmp    802551 <open+0x89>
+
+00802573 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	53                   	push   %ebx
+  802577:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80257a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80257d:	50                   	push   %eax
+  80257e:	ff 75 08             	push   0x8(%ebp)
+  802581:	e8 6a f6 ff ff       	call   801bf0 <fd_lookup>
+  802586:	89 c3                	mov    %eax,%ebx
+  802588:	83 c4 10             	add    $0x10,%esp
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	78 5b                	js     8025ea <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80258f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802592:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802598:	39 08                	cmp    %ecx,(%eax)
+  80259a:	75 55                	jne    8025f1 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80259c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8025a0:	74 56                	je     8025f8 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8025a2:	83 ec 0c             	sub    $0xc,%esp
+  8025a5:	68 08 70 80 00       	push   $0x807008
+  8025aa:	e8 82 17 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8025af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025b5:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  8025ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025bd:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  8025c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025c5:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8025ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8025d4:	e8 d1 fb ff ff       	call   8021aa <fsipc>
+  8025d9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8025db:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  8025e2:	e8 b7 17 00 00       	call   803d9e <mutex_unlock>
+	return r;
+  8025e7:	83 c4 10             	add    $0x10,%esp
+}
+  8025ea:	89 d8                	mov    %ebx,%eax
+  8025ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ef:	c9                   	leave
+  8025f0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025f1:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025f6:	eb f2                	jmp    8025ea <fallocate+0x77>
+		return -E_INVAL;
+  8025f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025fd:	eb eb                	jmp    8025ea <fallocate+0x77>
+
+008025ff <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8025ff:	55                   	push   %ebp
+  802600:	89 e5                	mov    %esp,%ebp
+  802602:	56                   	push   %esi
+  802603:	53                   	push   %ebx
+  802604:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802607:	89 f3                	mov    %esi,%ebx
+  802609:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80260f:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802612:	eb 06                	jmp    80261a <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802614:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80261a:	39 f3                	cmp    %esi,%ebx
+  80261c:	73 14                	jae    802632 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80261e:	83 ec 08             	sub    $0x8,%esp
+  802621:	53                   	push   %ebx
+  802622:	6a 00                	push   $0x0
+  802624:	e8 40 e9 ff ff       	call   800f69 <sys_page_unmap>
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	79 e4                	jns    802614 <munmap+0x15>
+  802630:	eb 05                	jmp    802637 <munmap+0x38>
+			return r;
+	return 0;
+  802632:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802637:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263a:	5b                   	pop    %ebx
+  80263b:	5e                   	pop    %esi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+
+0080263e <mmap>:
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	57                   	push   %edi
+  802642:	56                   	push   %esi
+  802643:	53                   	push   %ebx
+  802644:	83 ec 24             	sub    $0x24,%esp
+  802647:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80264a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	ff 75 08             	push   0x8(%ebp)
+  802651:	e8 9a f5 ff ff       	call   801bf0 <fd_lookup>
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	0f 88 37 01 00 00    	js     802798 <mmap+0x15a>
+		return NULL;
+  802661:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802666:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802669:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80266f:	39 0a                	cmp    %ecx,(%edx)
+  802671:	0f 85 05 01 00 00    	jne    80277c <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802677:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80267e:	0f 85 1b 01 00 00    	jne    80279f <mmap+0x161>
+  802684:	89 f0                	mov    %esi,%eax
+  802686:	83 e8 01             	sub    $0x1,%eax
+  802689:	0f 88 17 01 00 00    	js     8027a6 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80268f:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802693:	75 28                	jne    8026bd <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802695:	83 ec 0c             	sub    $0xc,%esp
+  802698:	68 08 70 80 00       	push   $0x807008
+  80269d:	e8 8f 16 00 00       	call   803d31 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8026a2:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8026a8:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  8026b1:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8026b6:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8026bb:	eb 2b                	jmp    8026e8 <mmap+0xaa>
+		cow_enable();
+  8026bd:	e8 b5 ee ff ff       	call   801577 <cow_enable>
+  8026c2:	eb d1                	jmp    802695 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8026c4:	89 c2                	mov    %eax,%edx
+  8026c6:	c1 ea 0c             	shr    $0xc,%edx
+  8026c9:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8026d0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8026d6:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8026dc:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8026df:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8026e1:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8026e6:	77 25                	ja     80270d <mmap+0xcf>
+  8026e8:	89 c2                	mov    %eax,%edx
+  8026ea:	29 da                	sub    %ebx,%edx
+  8026ec:	39 ca                	cmp    %ecx,%edx
+  8026ee:	73 3a                	jae    80272a <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8026f0:	89 c2                	mov    %eax,%edx
+  8026f2:	c1 ea 16             	shr    $0x16,%edx
+  8026f5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8026fc:	f6 c2 01             	test   $0x1,%dl
+  8026ff:	75 c3                	jne    8026c4 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802701:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802706:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80270b:	eb d4                	jmp    8026e1 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80270d:	29 d8                	sub    %ebx,%eax
+  80270f:	39 c8                	cmp    %ecx,%eax
+  802711:	73 17                	jae    80272a <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802713:	83 ec 0c             	sub    $0xc,%esp
+  802716:	68 08 70 80 00       	push   $0x807008
+  80271b:	e8 7e 16 00 00       	call   803d9e <mutex_unlock>
+		return NULL;
+  802720:	83 c4 10             	add    $0x10,%esp
+  802723:	b8 00 00 00 00       	mov    $0x0,%eax
+  802728:	eb 52                	jmp    80277c <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80272a:	85 db                	test   %ebx,%ebx
+  80272c:	74 e5                	je     802713 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80272e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802731:	8b 40 0c             	mov    0xc(%eax),%eax
+  802734:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802739:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80273c:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802741:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802747:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  80274d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802750:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80275f:	e8 46 fa ff ff       	call   8021aa <fsipc>
+  802764:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802766:	83 ec 0c             	sub    $0xc,%esp
+  802769:	68 08 70 80 00       	push   $0x807008
+  80276e:	e8 2b 16 00 00       	call   803d9e <mutex_unlock>
+	if (r < 0) {
+  802773:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802776:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802778:	85 ff                	test   %edi,%edi
+  80277a:	78 08                	js     802784 <mmap+0x146>
+}
+  80277c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277f:	5b                   	pop    %ebx
+  802780:	5e                   	pop    %esi
+  802781:	5f                   	pop    %edi
+  802782:	5d                   	pop    %ebp
+  802783:	c3                   	ret
+		munmap((void*) va, len);
+  802784:	83 ec 08             	sub    $0x8,%esp
+  802787:	56                   	push   %esi
+  802788:	53                   	push   %ebx
+  802789:	e8 71 fe ff ff       	call   8025ff <munmap>
+		return NULL;
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+  802796:	eb e4                	jmp    80277c <mmap+0x13e>
+		return NULL;
+  802798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279d:	eb dd                	jmp    80277c <mmap+0x13e>
+		return NULL;
+  80279f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a4:	eb d6                	jmp    80277c <mmap+0x13e>
+  8027a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ab:	eb cf                	jmp    80277c <mmap+0x13e>
+
+008027ad <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8027ad:	55                   	push   %ebp
+  8027ae:	89 e5                	mov    %esp,%ebp
+  8027b0:	53                   	push   %ebx
+  8027b1:	83 ec 10             	sub    $0x10,%esp
+  8027b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8027b7:	53                   	push   %ebx
+  8027b8:	e8 9a e2 ff ff       	call   800a57 <strlen>
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027c5:	7f 42                	jg     802809 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	68 08 70 80 00       	push   $0x807008
+  8027cf:	e8 5d 15 00 00       	call   803d31 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8027d4:	83 c4 08             	add    $0x8,%esp
+  8027d7:	53                   	push   %ebx
+  8027d8:	68 00 80 80 00       	push   $0x808000
+  8027dd:	e8 b0 e2 ff ff       	call   800a92 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8027e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027ec:	e8 b9 f9 ff ff       	call   8021aa <fsipc>
+  8027f1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027f3:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  8027fa:	e8 9f 15 00 00       	call   803d9e <mutex_unlock>
+	return r;
+  8027ff:	83 c4 10             	add    $0x10,%esp
+}
+  802802:	89 d8                	mov    %ebx,%eax
+  802804:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802807:	c9                   	leave
+  802808:	c3                   	ret
+		return -E_BAD_PATH;
+  802809:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80280e:	eb f2                	jmp    802802 <remove+0x55>
+
+00802810 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802810:	55                   	push   %ebp
+  802811:	89 e5                	mov    %esp,%ebp
+  802813:	53                   	push   %ebx
+  802814:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802817:	68 08 70 80 00       	push   $0x807008
+  80281c:	e8 10 15 00 00       	call   803d31 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802821:	ba 00 00 00 00       	mov    $0x0,%edx
+  802826:	b8 08 00 00 00       	mov    $0x8,%eax
+  80282b:	e8 7a f9 ff ff       	call   8021aa <fsipc>
+  802830:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802832:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  802839:	e8 60 15 00 00       	call   803d9e <mutex_unlock>
+	return r;
+}
+  80283e:	89 d8                	mov    %ebx,%eax
+  802840:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802843:	c9                   	leave
+  802844:	c3                   	ret
+
+00802845 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802845:	55                   	push   %ebp
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	56                   	push   %esi
+  802849:	53                   	push   %ebx
+  80284a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80284d:	83 ec 0c             	sub    $0xc,%esp
+  802850:	68 08 70 80 00       	push   $0x807008
+  802855:	e8 d7 14 00 00       	call   803d31 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80285a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802862:	ba 00 00 00 00       	mov    $0x0,%edx
+  802867:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80286c:	e8 39 f9 ff ff       	call   8021aa <fsipc>
+  802871:	89 c6                	mov    %eax,%esi
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	85 db                	test   %ebx,%ebx
+  802878:	74 7b                	je     8028f5 <fs_bcstat+0xb0>
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	78 77                	js     8028f5 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80287e:	a1 00 80 80 00       	mov    0x808000,%eax
+  802883:	89 03                	mov    %eax,(%ebx)
+  802885:	a1 04 80 80 00       	mov    0x808004,%eax
+  80288a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80288d:	a1 08 80 80 00       	mov    0x808008,%eax
+  802892:	89 43 08             	mov    %eax,0x8(%ebx)
+  802895:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  80289a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80289d:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028a2:	89 43 10             	mov    %eax,0x10(%ebx)
+  8028a5:	a1 14 80 80 00       	mov    0x808014,%eax
+  8028aa:	89 43 14             	mov    %eax,0x14(%ebx)
+  8028ad:	a1 18 80 80 00       	mov    0x808018,%eax
+  8028b2:	89 43 18             	mov    %eax,0x18(%ebx)
+  8028b5:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8028ba:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8028bd:	a1 20 80 80 00       	mov    0x808020,%eax
+  8028c2:	89 43 20             	mov    %eax,0x20(%ebx)
+  8028c5:	a1 24 80 80 00       	mov    0x808024,%eax
+  8028ca:	89 43 24             	mov    %eax,0x24(%ebx)
+  8028cd:	a1 28 80 80 00       	mov    0x808028,%eax
+  8028d2:	89 43 28             	mov    %eax,0x28(%ebx)
+  8028d5:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8028da:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8028dd:	a1 30 80 80 00       	mov    0x808030,%eax
+  8028e2:	89 43 30             	mov    %eax,0x30(%ebx)
+  8028e5:	a1 34 80 80 00       	mov    0x808034,%eax
+  8028ea:	89 43 34             	mov    %eax,0x34(%ebx)
+  8028ed:	a1 38 80 80 00       	mov    0x808038,%eax
+  8028f2:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8028f5:	83 ec 0c             	sub    $0xc,%esp
+  8028f8:	68 08 70 80 00       	push   $0x807008
+  8028fd:	e8 9c 14 00 00       	call   803d9e <mutex_unlock>
+	return r;
+}
+  802902:	89 f0                	mov    %esi,%eax
+  802904:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802907:	5b                   	pop    %ebx
+  802908:	5e                   	pop    %esi
+  802909:	5d                   	pop    %ebp
+  80290a:	c3                   	ret
+
+0080290b <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80290b:	55                   	push   %ebp
+  80290c:	89 e5                	mov    %esp,%ebp
+  80290e:	56                   	push   %esi
+  80290f:	53                   	push   %ebx
+  802910:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802912:	0f b6 10             	movzbl (%eax),%edx
+  802915:	80 fa 72             	cmp    $0x72,%dl
+  802918:	74 44                	je     80295e <parse_mode+0x53>
+  80291a:	80 fa 77             	cmp    $0x77,%dl
+  80291d:	74 4b                	je     80296a <parse_mode+0x5f>
+  80291f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802924:	80 fa 61             	cmp    $0x61,%dl
+  802927:	74 09                	je     802932 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802929:	89 d8                	mov    %ebx,%eax
+  80292b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292e:	5b                   	pop    %ebx
+  80292f:	5e                   	pop    %esi
+  802930:	5d                   	pop    %ebp
+  802931:	c3                   	ret
+	switch (mode[0]) {
+  802932:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802937:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80293c:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80293e:	83 ec 08             	sub    $0x8,%esp
+  802941:	6a 2b                	push   $0x2b
+  802943:	50                   	push   %eax
+  802944:	e8 5b e2 ff ff       	call   800ba4 <strchr>
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	74 d9                	je     802929 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802950:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802953:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802956:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80295c:	eb cb                	jmp    802929 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80295e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802968:	eb d2                	jmp    80293c <parse_mode+0x31>
+  80296a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80296f:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802974:	eb c6                	jmp    80293c <parse_mode+0x31>
+
+00802976 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802976:	55                   	push   %ebp
+  802977:	89 e5                	mov    %esp,%ebp
+  802979:	57                   	push   %edi
+  80297a:	56                   	push   %esi
+  80297b:	53                   	push   %ebx
+  80297c:	83 ec 1c             	sub    $0x1c,%esp
+  80297f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802982:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802985:	b8 24 60 80 00       	mov    $0x806024,%eax
+  80298a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80298f:	83 c0 24             	add    $0x24,%eax
+  802992:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802996:	74 17                	je     8029af <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802998:	83 c3 01             	add    $0x1,%ebx
+  80299b:	83 fb 10             	cmp    $0x10,%ebx
+  80299e:	75 ef                	jne    80298f <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8029a0:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8029a5:	89 f0                	mov    %esi,%eax
+  8029a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029aa:	5b                   	pop    %ebx
+  8029ab:	5e                   	pop    %esi
+  8029ac:	5f                   	pop    %edi
+  8029ad:	5d                   	pop    %ebp
+  8029ae:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8029af:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8029b6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8029b9:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8029bc:	c1 e7 02             	shl    $0x2,%edi
+  8029bf:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8029c5:	83 ec 04             	sub    $0x4,%esp
+  8029c8:	6a 24                	push   $0x24
+  8029ca:	6a 00                	push   $0x0
+  8029cc:	56                   	push   %esi
+  8029cd:	e8 11 e2 ff ff       	call   800be3 <memset>
+			streams[i].f_fd = fd;
+  8029d2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8029d5:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8029db:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029de:	01 d8                	add    %ebx,%eax
+  8029e0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029e3:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8029ea:	83 c4 10             	add    $0x10,%esp
+  8029ed:	eb b6                	jmp    8029a5 <stream_alloc+0x2f>
+
+008029ef <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	53                   	push   %ebx
+  8029f3:	83 ec 14             	sub    $0x14,%esp
+  8029f6:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8029f8:	8b 40 18             	mov    0x18(%eax),%eax
+  8029fb:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8029fe:	74 4a                	je     802a4a <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802a00:	83 ec 08             	sub    $0x8,%esp
+  802a03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a06:	50                   	push   %eax
+  802a07:	ff 33                	push   (%ebx)
+  802a09:	e8 e2 f1 ff ff       	call   801bf0 <fd_lookup>
+  802a0e:	89 c2                	mov    %eax,%edx
+  802a10:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a13:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802a18:	85 d2                	test   %edx,%edx
+  802a1a:	78 41                	js     802a5d <stream_unread+0x6e>
+  802a1c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a1f:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802a25:	39 0a                	cmp    %ecx,(%edx)
+  802a27:	75 34                	jne    802a5d <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802a29:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a2c:	03 42 04             	add    0x4(%edx),%eax
+  802a2f:	2b 43 18             	sub    0x18(%ebx),%eax
+  802a32:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802a35:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802a3c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802a43:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a48:	eb 13                	jmp    802a5d <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802a4a:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802a51:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802a58:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+00802a62 <stream_drain>:
+{
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	56                   	push   %esi
+  802a66:	53                   	push   %ebx
+  802a67:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802a69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a6e:	eb 02                	jmp    802a72 <stream_drain+0x10>
+  802a70:	01 c3                	add    %eax,%ebx
+  802a72:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a75:	39 c3                	cmp    %eax,%ebx
+  802a77:	73 43                	jae    802abc <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802a79:	83 ec 04             	sub    $0x4,%esp
+  802a7c:	29 d8                	sub    %ebx,%eax
+  802a7e:	50                   	push   %eax
+  802a7f:	89 d8                	mov    %ebx,%eax
+  802a81:	03 46 0c             	add    0xc(%esi),%eax
+  802a84:	50                   	push   %eax
+  802a85:	ff 36                	push   (%esi)
+  802a87:	e8 ec f4 ff ff       	call   801f78 <write>
+  802a8c:	83 c4 10             	add    $0x10,%esp
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	7f dd                	jg     802a70 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802a93:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802a97:	8b 56 0c             	mov    0xc(%esi),%edx
+  802a9a:	83 ec 04             	sub    $0x4,%esp
+  802a9d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802aa0:	29 d8                	sub    %ebx,%eax
+  802aa2:	50                   	push   %eax
+  802aa3:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802aa6:	50                   	push   %eax
+  802aa7:	52                   	push   %edx
+  802aa8:	e8 6b e1 ff ff       	call   800c18 <memmove>
+			f->f_wend -= done;
+  802aad:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802ab0:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802ab2:	83 c4 10             	add    $0x10,%esp
+  802ab5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802aba:	eb 0a                	jmp    802ac6 <stream_drain+0x64>
+  802abc:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802ac6:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802ac9:	89 d0                	mov    %edx,%eax
+  802acb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ace:	5b                   	pop    %ebx
+  802acf:	5e                   	pop    %esi
+  802ad0:	5d                   	pop    %ebp
+  802ad1:	c3                   	ret
+
+00802ad2 <stream_setup>:
+	if (f->f_buf)
+  802ad2:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802ad6:	74 01                	je     802ad9 <stream_setup+0x7>
+  802ad8:	c3                   	ret
+{
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	53                   	push   %ebx
+  802add:	83 ec 04             	sub    $0x4,%esp
+  802ae0:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802ae2:	8b 40 08             	mov    0x8(%eax),%eax
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	74 17                	je     802b00 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802ae9:	83 f8 03             	cmp    $0x3,%eax
+  802aec:	75 2d                	jne    802b1b <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802aee:	8d 43 20             	lea    0x20(%ebx),%eax
+  802af1:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802af4:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802b00:	83 ec 0c             	sub    $0xc,%esp
+  802b03:	ff 33                	push   (%ebx)
+  802b05:	e8 29 1b 00 00       	call   804633 <iscons>
+  802b0a:	83 c4 10             	add    $0x10,%esp
+  802b0d:	85 c0                	test   %eax,%eax
+  802b0f:	0f 9f c0             	setg   %al
+  802b12:	0f b6 c0             	movzbl %al,%eax
+  802b15:	83 c0 01             	add    $0x1,%eax
+  802b18:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802b1b:	83 ec 0c             	sub    $0xc,%esp
+  802b1e:	68 00 10 00 00       	push   $0x1000
+  802b23:	e8 6e 0b 00 00       	call   803696 <malloc>
+  802b28:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b2b:	83 c4 10             	add    $0x10,%esp
+  802b2e:	85 c0                	test   %eax,%eax
+  802b30:	74 bc                	je     802aee <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802b32:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802b39:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802b3d:	eb bc                	jmp    802afb <stream_setup+0x29>
+
+00802b3f <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802b3f:	55                   	push   %ebp
+  802b40:	89 e5                	mov    %esp,%ebp
+  802b42:	53                   	push   %ebx
+  802b43:	83 ec 04             	sub    $0x4,%esp
+  802b46:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802b48:	e8 85 ff ff ff       	call   802ad2 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802b52:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802b56:	74 3d                	je     802b95 <stream_fill+0x56>
+  802b58:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802b5c:	74 10                	je     802b6e <stream_fill+0x2f>
+  802b5e:	89 d8                	mov    %ebx,%eax
+  802b60:	e8 fd fe ff ff       	call   802a62 <stream_drain>
+		return 0;
+  802b65:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802b6a:	85 c0                	test   %eax,%eax
+  802b6c:	78 27                	js     802b95 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802b6e:	83 ec 04             	sub    $0x4,%esp
+  802b71:	ff 73 10             	push   0x10(%ebx)
+  802b74:	ff 73 0c             	push   0xc(%ebx)
+  802b77:	ff 33                	push   (%ebx)
+  802b79:	e8 02 f3 ff ff       	call   801e80 <read>
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	7e 17                	jle    802b9c <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802b85:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802b89:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802b90:	89 c2                	mov    %eax,%edx
+  802b92:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802b95:	89 d0                	mov    %edx,%eax
+  802b97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b9a:	c9                   	leave
+  802b9b:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802b9c:	c1 f8 1f             	sar    $0x1f,%eax
+  802b9f:	83 e0 04             	and    $0x4,%eax
+  802ba2:	83 c0 04             	add    $0x4,%eax
+  802ba5:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bad:	eb e6                	jmp    802b95 <stream_fill+0x56>
+
+00802baf <fopen>:
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	57                   	push   %edi
+  802bb3:	56                   	push   %esi
+  802bb4:	53                   	push   %ebx
+  802bb5:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802bbb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802bbe:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802bc4:	89 f0                	mov    %esi,%eax
+  802bc6:	e8 40 fd ff ff       	call   80290b <parse_mode>
+		return 0;
+  802bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	78 2d                	js     802c01 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802bd4:	83 ec 08             	sub    $0x8,%esp
+  802bd7:	50                   	push   %eax
+  802bd8:	ff 75 08             	push   0x8(%ebp)
+  802bdb:	e8 e8 f8 ff ff       	call   8024c8 <open>
+  802be0:	89 c7                	mov    %eax,%edi
+  802be2:	83 c4 10             	add    $0x10,%esp
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	78 58                	js     802c41 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802be9:	80 3e 61             	cmpb   $0x61,(%esi)
+  802bec:	74 1d                	je     802c0b <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802bee:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802bf4:	89 f8                	mov    %edi,%eax
+  802bf6:	e8 7b fd ff ff       	call   802976 <stream_alloc>
+  802bfb:	89 c3                	mov    %eax,%ebx
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	74 32                	je     802c33 <fopen+0x84>
+}
+  802c01:	89 d8                	mov    %ebx,%eax
+  802c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c06:	5b                   	pop    %ebx
+  802c07:	5e                   	pop    %esi
+  802c08:	5f                   	pop    %edi
+  802c09:	5d                   	pop    %ebp
+  802c0a:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802c0b:	83 ec 08             	sub    $0x8,%esp
+  802c0e:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802c14:	50                   	push   %eax
+  802c15:	57                   	push   %edi
+  802c16:	e8 db f4 ff ff       	call   8020f6 <fstat>
+  802c1b:	83 c4 10             	add    $0x10,%esp
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	78 cc                	js     802bee <fopen+0x3f>
+		seek(fd, st.st_size);
+  802c22:	83 ec 08             	sub    $0x8,%esp
+  802c25:	ff 75 dc             	push   -0x24(%ebp)
+  802c28:	57                   	push   %edi
+  802c29:	e8 f6 f3 ff ff       	call   802024 <seek>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	eb bb                	jmp    802bee <fopen+0x3f>
+		close(fd);
+  802c33:	83 ec 0c             	sub    $0xc,%esp
+  802c36:	57                   	push   %edi
+  802c37:	e8 08 f1 ff ff       	call   801d44 <close>
+  802c3c:	83 c4 10             	add    $0x10,%esp
+  802c3f:	eb c0                	jmp    802c01 <fopen+0x52>
+		return 0;
+  802c41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c46:	eb b9                	jmp    802c01 <fopen+0x52>
+
+00802c48 <fdopen>:
+{
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802c4e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c54:	e8 b2 fc ff ff       	call   80290b <parse_mode>
+  802c59:	89 c2                	mov    %eax,%edx
+		return 0;
+  802c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802c60:	85 d2                	test   %edx,%edx
+  802c62:	78 0b                	js     802c6f <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802c64:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	e8 07 fd ff ff       	call   802976 <stream_alloc>
+}
+  802c6f:	c9                   	leave
+  802c70:	c3                   	ret
+
+00802c71 <setvbuf>:
+{
+  802c71:	55                   	push   %ebp
+  802c72:	89 e5                	mov    %esp,%ebp
+  802c74:	57                   	push   %edi
+  802c75:	56                   	push   %esi
+  802c76:	53                   	push   %ebx
+  802c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802c80:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802c84:	75 3a                	jne    802cc0 <setvbuf+0x4f>
+  802c86:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802c89:	83 fe 02             	cmp    $0x2,%esi
+  802c8c:	77 39                	ja     802cc7 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802c8e:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802c91:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c95:	0f 95 c3             	setne  %bl
+  802c98:	85 ff                	test   %edi,%edi
+  802c9a:	0f 95 c1             	setne  %cl
+  802c9d:	84 cb                	test   %cl,%bl
+  802c9f:	74 05                	je     802ca6 <setvbuf+0x35>
+  802ca1:	83 fa 03             	cmp    $0x3,%edx
+  802ca4:	75 0a                	jne    802cb0 <setvbuf+0x3f>
+	return 0;
+  802ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cab:	5b                   	pop    %ebx
+  802cac:	5e                   	pop    %esi
+  802cad:	5f                   	pop    %edi
+  802cae:	5d                   	pop    %ebp
+  802caf:	c3                   	ret
+		f->f_buf = buf;
+  802cb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cb3:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802cb6:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	eb eb                	jmp    802cab <setvbuf+0x3a>
+		return EOF;
+  802cc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802cc5:	eb e4                	jmp    802cab <setvbuf+0x3a>
+  802cc7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ccc:	eb dd                	jmp    802cab <setvbuf+0x3a>
+
+00802cce <fflush>:
+{
+  802cce:	55                   	push   %ebp
+  802ccf:	89 e5                	mov    %esp,%ebp
+  802cd1:	57                   	push   %edi
+  802cd2:	56                   	push   %esi
+  802cd3:	53                   	push   %ebx
+  802cd4:	83 ec 0c             	sub    $0xc,%esp
+  802cd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802cda:	85 db                	test   %ebx,%ebx
+  802cdc:	74 1a                	je     802cf8 <fflush+0x2a>
+	stream_unread(f);
+  802cde:	89 d8                	mov    %ebx,%eax
+  802ce0:	e8 0a fd ff ff       	call   8029ef <stream_unread>
+	return stream_drain(f);
+  802ce5:	89 d8                	mov    %ebx,%eax
+  802ce7:	e8 76 fd ff ff       	call   802a62 <stream_drain>
+  802cec:	89 c7                	mov    %eax,%edi
+}
+  802cee:	89 f8                	mov    %edi,%eax
+  802cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cf3:	5b                   	pop    %ebx
+  802cf4:	5e                   	pop    %esi
+  802cf5:	5f                   	pop    %edi
+  802cf6:	5d                   	pop    %ebp
+  802cf7:	c3                   	ret
+  802cf8:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802cfd:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d07:	eb 03                	jmp    802d0c <fflush+0x3e>
+  802d09:	83 c3 24             	add    $0x24,%ebx
+  802d0c:	39 f3                	cmp    %esi,%ebx
+  802d0e:	74 de                	je     802cee <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802d10:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802d14:	74 f3                	je     802d09 <fflush+0x3b>
+  802d16:	83 ec 0c             	sub    $0xc,%esp
+  802d19:	53                   	push   %ebx
+  802d1a:	e8 af ff ff ff       	call   802cce <fflush>
+  802d1f:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802d22:	85 c0                	test   %eax,%eax
+  802d24:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d29:	0f 48 f8             	cmovs  %eax,%edi
+  802d2c:	eb db                	jmp    802d09 <fflush+0x3b>
+
+00802d2e <fclose>:
+{
+  802d2e:	55                   	push   %ebp
+  802d2f:	89 e5                	mov    %esp,%ebp
+  802d31:	56                   	push   %esi
+  802d32:	53                   	push   %ebx
+  802d33:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802d36:	83 ec 0c             	sub    $0xc,%esp
+  802d39:	56                   	push   %esi
+  802d3a:	e8 8f ff ff ff       	call   802cce <fflush>
+  802d3f:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802d41:	83 c4 04             	add    $0x4,%esp
+  802d44:	ff 36                	push   (%esi)
+  802d46:	e8 f9 ef ff ff       	call   801d44 <close>
+  802d4b:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802d4e:	85 c0                	test   %eax,%eax
+  802d50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d55:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802d58:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802d5c:	75 10                	jne    802d6e <fclose+0x40>
+	f->f_flags = 0;
+  802d5e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802d65:	89 d8                	mov    %ebx,%eax
+  802d67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d6a:	5b                   	pop    %ebx
+  802d6b:	5e                   	pop    %esi
+  802d6c:	5d                   	pop    %ebp
+  802d6d:	c3                   	ret
+		free(f->f_buf);
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+  802d71:	ff 76 0c             	push   0xc(%esi)
+  802d74:	e8 54 08 00 00       	call   8035cd <free>
+  802d79:	83 c4 10             	add    $0x10,%esp
+  802d7c:	eb e0                	jmp    802d5e <fclose+0x30>
+
+00802d7e <fileno>:
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d84:	8b 00                	mov    (%eax),%eax
+}
+  802d86:	5d                   	pop    %ebp
+  802d87:	c3                   	ret
+
+00802d88 <feof>:
+{
+  802d88:	55                   	push   %ebp
+  802d89:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8e:	8b 40 04             	mov    0x4(%eax),%eax
+  802d91:	c1 e8 02             	shr    $0x2,%eax
+  802d94:	83 e0 01             	and    $0x1,%eax
+}
+  802d97:	5d                   	pop    %ebp
+  802d98:	c3                   	ret
+
+00802d99 <ferror>:
+{
+  802d99:	55                   	push   %ebp
+  802d9a:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802d9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9f:	8b 40 04             	mov    0x4(%eax),%eax
+  802da2:	c1 e8 03             	shr    $0x3,%eax
+  802da5:	83 e0 01             	and    $0x1,%eax
+}
+  802da8:	5d                   	pop    %ebp
+  802da9:	c3                   	ret
+
+00802daa <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802daa:	55                   	push   %ebp
+  802dab:	89 e5                	mov    %esp,%ebp
+  802dad:	53                   	push   %ebx
+  802dae:	83 ec 04             	sub    $0x4,%esp
+  802db1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802db4:	8b 43 18             	mov    0x18(%ebx),%eax
+  802db7:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802dba:	74 15                	je     802dd1 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802dbc:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802dbf:	8b 43 14             	mov    0x14(%ebx),%eax
+  802dc2:	8d 48 01             	lea    0x1(%eax),%ecx
+  802dc5:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802dc8:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802dcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802dd1:	89 d8                	mov    %ebx,%eax
+  802dd3:	e8 67 fd ff ff       	call   802b3f <stream_fill>
+  802dd8:	85 c0                	test   %eax,%eax
+  802dda:	75 e0                	jne    802dbc <fgetc+0x12>
+		return EOF;
+  802ddc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802de1:	eb e9                	jmp    802dcc <fgetc+0x22>
+
+00802de3 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802de3:	55                   	push   %ebp
+  802de4:	89 e5                	mov    %esp,%ebp
+  802de6:	57                   	push   %edi
+  802de7:	56                   	push   %esi
+  802de8:	53                   	push   %ebx
+  802de9:	83 ec 1c             	sub    $0x1c,%esp
+  802dec:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802def:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802df4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df7:	83 e8 01             	sub    $0x1,%eax
+  802dfa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802dfd:	eb 66                	jmp    802e65 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802dff:	8b 46 14             	mov    0x14(%esi),%eax
+  802e02:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802e05:	29 c3                	sub    %eax,%ebx
+  802e07:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802e0a:	29 fa                	sub    %edi,%edx
+  802e0c:	39 d3                	cmp    %edx,%ebx
+  802e0e:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802e11:	83 ec 04             	sub    $0x4,%esp
+  802e14:	53                   	push   %ebx
+  802e15:	6a 0a                	push   $0xa
+  802e17:	03 46 0c             	add    0xc(%esi),%eax
+  802e1a:	50                   	push   %eax
+  802e1b:	e8 a9 de ff ff       	call   800cc9 <memfind>
+  802e20:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802e23:	8b 46 0c             	mov    0xc(%esi),%eax
+  802e26:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802e29:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802e2c:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802e2e:	83 c4 10             	add    $0x10,%esp
+  802e31:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e34:	74 0b                	je     802e41 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802e36:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e39:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e3c:	29 d3                	sub    %edx,%ebx
+  802e3e:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802e41:	83 ec 04             	sub    $0x4,%esp
+  802e44:	53                   	push   %ebx
+  802e45:	01 c8                	add    %ecx,%eax
+  802e47:	50                   	push   %eax
+  802e48:	89 f8                	mov    %edi,%eax
+  802e4a:	03 45 08             	add    0x8(%ebp),%eax
+  802e4d:	50                   	push   %eax
+  802e4e:	e8 c5 dd ff ff       	call   800c18 <memmove>
+		f->f_rpos += m;
+  802e53:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802e56:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5e:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802e63:	74 1f                	je     802e84 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802e65:	8d 47 01             	lea    0x1(%edi),%eax
+  802e68:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802e6b:	73 17                	jae    802e84 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802e6d:	8b 46 18             	mov    0x18(%esi),%eax
+  802e70:	39 46 14             	cmp    %eax,0x14(%esi)
+  802e73:	75 8a                	jne    802dff <fgets+0x1c>
+  802e75:	89 f0                	mov    %esi,%eax
+  802e77:	e8 c3 fc ff ff       	call   802b3f <stream_fill>
+  802e7c:	85 c0                	test   %eax,%eax
+  802e7e:	0f 85 7b ff ff ff    	jne    802dff <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802e84:	85 ff                	test   %edi,%edi
+  802e86:	74 0f                	je     802e97 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802e88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8b:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e92:	5b                   	pop    %ebx
+  802e93:	5e                   	pop    %esi
+  802e94:	5f                   	pop    %edi
+  802e95:	5d                   	pop    %ebp
+  802e96:	c3                   	ret
+		return 0;
+  802e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9c:	eb f1                	jmp    802e8f <fgets+0xac>
+
+00802e9e <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802e9e:	55                   	push   %ebp
+  802e9f:	89 e5                	mov    %esp,%ebp
+  802ea1:	57                   	push   %edi
+  802ea2:	56                   	push   %esi
+  802ea3:	53                   	push   %ebx
+  802ea4:	83 ec 1c             	sub    $0x1c,%esp
+  802ea7:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802eaa:	89 f0                	mov    %esi,%eax
+  802eac:	e8 21 fc ff ff       	call   802ad2 <stream_setup>
+	want = size * n;
+  802eb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802eb4:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802eb8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec0:	eb 43                	jmp    802f05 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802ec2:	29 d3                	sub    %edx,%ebx
+  802ec4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ec7:	29 f8                	sub    %edi,%eax
+  802ec9:	39 c3                	cmp    %eax,%ebx
+  802ecb:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802ece:	83 ec 04             	sub    $0x4,%esp
+  802ed1:	53                   	push   %ebx
+  802ed2:	03 56 0c             	add    0xc(%esi),%edx
+  802ed5:	52                   	push   %edx
+  802ed6:	89 f8                	mov    %edi,%eax
+  802ed8:	03 45 08             	add    0x8(%ebp),%eax
+  802edb:	50                   	push   %eax
+  802edc:	e8 37 dd ff ff       	call   800c18 <memmove>
+			f->f_rpos += m;
+  802ee1:	01 5e 14             	add    %ebx,0x14(%esi)
+  802ee4:	83 c4 10             	add    $0x10,%esp
+  802ee7:	eb 1a                	jmp    802f03 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802ee9:	83 ec 04             	sub    $0x4,%esp
+  802eec:	53                   	push   %ebx
+  802eed:	89 f8                	mov    %edi,%eax
+  802eef:	03 45 08             	add    0x8(%ebp),%eax
+  802ef2:	50                   	push   %eax
+  802ef3:	ff 36                	push   (%esi)
+  802ef5:	e8 86 ef ff ff       	call   801e80 <read>
+  802efa:	89 c3                	mov    %eax,%ebx
+  802efc:	83 c4 10             	add    $0x10,%esp
+  802eff:	85 c0                	test   %eax,%eax
+  802f01:	7e 36                	jle    802f39 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802f03:	01 df                	add    %ebx,%edi
+  802f05:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f08:	39 c7                	cmp    %eax,%edi
+  802f0a:	73 39                	jae    802f45 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802f0c:	8b 56 14             	mov    0x14(%esi),%edx
+  802f0f:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802f12:	39 da                	cmp    %ebx,%edx
+  802f14:	72 ac                	jb     802ec2 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802f16:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802f19:	29 fb                	sub    %edi,%ebx
+  802f1b:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802f1e:	72 3e                	jb     802f5e <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802f20:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802f24:	74 1f                	je     802f45 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802f26:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802f2a:	74 bd                	je     802ee9 <fread+0x4b>
+  802f2c:	89 f0                	mov    %esi,%eax
+  802f2e:	e8 2f fb ff ff       	call   802a62 <stream_drain>
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	79 b2                	jns    802ee9 <fread+0x4b>
+  802f37:	eb 0c                	jmp    802f45 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802f39:	c1 fb 1f             	sar    $0x1f,%ebx
+  802f3c:	83 e3 04             	and    $0x4,%ebx
+  802f3f:	83 c3 04             	add    $0x4,%ebx
+  802f42:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802f45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f48:	85 c0                	test   %eax,%eax
+  802f4a:	74 0a                	je     802f56 <fread+0xb8>
+  802f4c:	89 f8                	mov    %edi,%eax
+  802f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f53:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f59:	5b                   	pop    %ebx
+  802f5a:	5e                   	pop    %esi
+  802f5b:	5f                   	pop    %edi
+  802f5c:	5d                   	pop    %ebp
+  802f5d:	c3                   	ret
+		} else if (!stream_fill(f))
+  802f5e:	89 f0                	mov    %esi,%eax
+  802f60:	e8 da fb ff ff       	call   802b3f <stream_fill>
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	74 dc                	je     802f45 <fread+0xa7>
+			m = 0;
+  802f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f6e:	eb 93                	jmp    802f03 <fread+0x65>
+
+00802f70 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	57                   	push   %edi
+  802f74:	56                   	push   %esi
+  802f75:	53                   	push   %ebx
+  802f76:	83 ec 1c             	sub    $0x1c,%esp
+  802f79:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802f7c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f7f:	a8 02                	test   $0x2,%al
+  802f81:	75 13                	jne    802f96 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802f83:	83 c8 08             	or     $0x8,%eax
+  802f86:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802f89:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802f8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f91:	5b                   	pop    %ebx
+  802f92:	5e                   	pop    %esi
+  802f93:	5f                   	pop    %edi
+  802f94:	5d                   	pop    %ebp
+  802f95:	c3                   	ret
+	stream_setup(f);
+  802f96:	89 d8                	mov    %ebx,%eax
+  802f98:	e8 35 fb ff ff       	call   802ad2 <stream_setup>
+	want = size * n;
+  802f9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fa0:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802fa4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802fa7:	89 d8                	mov    %ebx,%eax
+  802fa9:	e8 41 fa ff ff       	call   8029ef <stream_unread>
+	for (done = 0; done < want; ) {
+  802fae:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802fb3:	84 c0                	test   %al,%al
+  802fb5:	75 7b                	jne    803032 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802fb7:	be 00 00 00 00       	mov    $0x0,%esi
+  802fbc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802fbf:	39 fe                	cmp    %edi,%esi
+  802fc1:	73 24                	jae    802fe7 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802fc3:	83 ec 04             	sub    $0x4,%esp
+  802fc6:	89 f8                	mov    %edi,%eax
+  802fc8:	29 f0                	sub    %esi,%eax
+  802fca:	50                   	push   %eax
+  802fcb:	89 f0                	mov    %esi,%eax
+  802fcd:	03 45 08             	add    0x8(%ebp),%eax
+  802fd0:	50                   	push   %eax
+  802fd1:	ff 33                	push   (%ebx)
+  802fd3:	e8 a0 ef ff ff       	call   801f78 <write>
+  802fd8:	83 c4 10             	add    $0x10,%esp
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	7e 04                	jle    802fe3 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802fdf:	01 c6                	add    %eax,%esi
+  802fe1:	eb dc                	jmp    802fbf <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802fe3:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802fe7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	74 a0                	je     802f8e <fwrite+0x1e>
+  802fee:	89 f0                	mov    %esi,%eax
+  802ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff5:	f7 75 0c             	divl   0xc(%ebp)
+  802ff8:	eb 94                	jmp    802f8e <fwrite+0x1e>
+			done += r;
+  802ffa:	01 c7                	add    %eax,%edi
+			continue;
+  802ffc:	eb 34                	jmp    803032 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802ffe:	8b 73 10             	mov    0x10(%ebx),%esi
+  803001:	29 c6                	sub    %eax,%esi
+  803003:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803006:	29 fa                	sub    %edi,%edx
+  803008:	39 d6                	cmp    %edx,%esi
+  80300a:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80300d:	83 ec 04             	sub    $0x4,%esp
+  803010:	56                   	push   %esi
+  803011:	89 fa                	mov    %edi,%edx
+  803013:	03 55 08             	add    0x8(%ebp),%edx
+  803016:	52                   	push   %edx
+  803017:	03 43 0c             	add    0xc(%ebx),%eax
+  80301a:	50                   	push   %eax
+  80301b:	e8 f8 db ff ff       	call   800c18 <memmove>
+		f->f_wend += m;
+  803020:	89 f0                	mov    %esi,%eax
+  803022:	03 43 1c             	add    0x1c(%ebx),%eax
+  803025:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  803028:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	3b 43 10             	cmp    0x10(%ebx),%eax
+  803030:	74 5b                	je     80308d <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  803032:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803035:	39 c7                	cmp    %eax,%edi
+  803037:	73 2d                	jae    803066 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  803039:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	75 be                	jne    802ffe <fwrite+0x8e>
+  803040:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803043:	29 fa                	sub    %edi,%edx
+  803045:	3b 53 10             	cmp    0x10(%ebx),%edx
+  803048:	72 b4                	jb     802ffe <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80304a:	83 ec 04             	sub    $0x4,%esp
+  80304d:	52                   	push   %edx
+  80304e:	89 f8                	mov    %edi,%eax
+  803050:	03 45 08             	add    0x8(%ebp),%eax
+  803053:	50                   	push   %eax
+  803054:	ff 33                	push   (%ebx)
+  803056:	e8 1d ef ff ff       	call   801f78 <write>
+  80305b:	83 c4 10             	add    $0x10,%esp
+  80305e:	85 c0                	test   %eax,%eax
+  803060:	7f 98                	jg     802ffa <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  803062:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  803066:	8b 43 08             	mov    0x8(%ebx),%eax
+  803069:	83 f8 03             	cmp    $0x3,%eax
+  80306c:	74 48                	je     8030b6 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80306e:	83 f8 02             	cmp    $0x2,%eax
+  803071:	74 27                	je     80309a <fwrite+0x12a>
+	return size ? done / size : 0;
+  803073:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803076:	85 c0                	test   %eax,%eax
+  803078:	0f 84 10 ff ff ff    	je     802f8e <fwrite+0x1e>
+  80307e:	89 f8                	mov    %edi,%eax
+  803080:	ba 00 00 00 00       	mov    $0x0,%edx
+  803085:	f7 75 0c             	divl   0xc(%ebp)
+  803088:	e9 01 ff ff ff       	jmp    802f8e <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80308d:	89 d8                	mov    %ebx,%eax
+  80308f:	e8 ce f9 ff ff       	call   802a62 <stream_drain>
+  803094:	85 c0                	test   %eax,%eax
+  803096:	79 9a                	jns    803032 <fwrite+0xc2>
+  803098:	eb cc                	jmp    803066 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80309a:	83 ec 04             	sub    $0x4,%esp
+  80309d:	57                   	push   %edi
+  80309e:	6a 0a                	push   $0xa
+  8030a0:	ff 75 08             	push   0x8(%ebp)
+  8030a3:	e8 21 dc ff ff       	call   800cc9 <memfind>
+  8030a8:	89 c2                	mov    %eax,%edx
+  8030aa:	89 f8                	mov    %edi,%eax
+  8030ac:	03 45 08             	add    0x8(%ebp),%eax
+  8030af:	83 c4 10             	add    $0x10,%esp
+  8030b2:	39 c2                	cmp    %eax,%edx
+  8030b4:	74 bd                	je     803073 <fwrite+0x103>
+		stream_drain(f);
+  8030b6:	89 d8                	mov    %ebx,%eax
+  8030b8:	e8 a5 f9 ff ff       	call   802a62 <stream_drain>
+  8030bd:	eb b4                	jmp    803073 <fwrite+0x103>
+
+008030bf <fputc>:
+{
+  8030bf:	55                   	push   %ebp
+  8030c0:	89 e5                	mov    %esp,%ebp
+  8030c2:	53                   	push   %ebx
+  8030c3:	83 ec 14             	sub    $0x14,%esp
+  8030c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8030c9:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8030cc:	ff 75 0c             	push   0xc(%ebp)
+  8030cf:	6a 01                	push   $0x1
+  8030d1:	6a 01                	push   $0x1
+  8030d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030d6:	50                   	push   %eax
+  8030d7:	e8 94 fe ff ff       	call   802f70 <fwrite>
+  8030dc:	83 c4 10             	add    $0x10,%esp
+  8030df:	0f b6 db             	movzbl %bl,%ebx
+  8030e2:	83 f8 01             	cmp    $0x1,%eax
+  8030e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030ea:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8030ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f0:	c9                   	leave
+  8030f1:	c3                   	ret
+
+008030f2 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8030f2:	55                   	push   %ebp
+  8030f3:	89 e5                	mov    %esp,%ebp
+  8030f5:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8030f8:	ff 75 0c             	push   0xc(%ebp)
+  8030fb:	ff 75 08             	push   0x8(%ebp)
+  8030fe:	e8 bc ff ff ff       	call   8030bf <fputc>
+}
+  803103:	83 c4 10             	add    $0x10,%esp
+  803106:	c9                   	leave
+  803107:	c3                   	ret
+
+00803108 <fputs>:
+{
+  803108:	55                   	push   %ebp
+  803109:	89 e5                	mov    %esp,%ebp
+  80310b:	56                   	push   %esi
+  80310c:	53                   	push   %ebx
+  80310d:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  803110:	83 ec 0c             	sub    $0xc,%esp
+  803113:	56                   	push   %esi
+  803114:	e8 3e d9 ff ff       	call   800a57 <strlen>
+  803119:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80311b:	ff 75 0c             	push   0xc(%ebp)
+  80311e:	50                   	push   %eax
+  80311f:	6a 01                	push   $0x1
+  803121:	56                   	push   %esi
+  803122:	e8 49 fe ff ff       	call   802f70 <fwrite>
+  803127:	83 c4 20             	add    $0x20,%esp
+  80312a:	39 d8                	cmp    %ebx,%eax
+  80312c:	0f 95 c0             	setne  %al
+  80312f:	0f b6 c0             	movzbl %al,%eax
+  803132:	f7 d8                	neg    %eax
+}
+  803134:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803137:	5b                   	pop    %ebx
+  803138:	5e                   	pop    %esi
+  803139:	5d                   	pop    %ebp
+  80313a:	c3                   	ret
+
+0080313b <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80313b:	55                   	push   %ebp
+  80313c:	89 e5                	mov    %esp,%ebp
+  80313e:	53                   	push   %ebx
+  80313f:	83 ec 04             	sub    $0x4,%esp
+  803142:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803145:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803148:	50                   	push   %eax
+  803149:	ff 75 0c             	push   0xc(%ebp)
+  80314c:	53                   	push   %ebx
+  80314d:	68 f2 30 80 00       	push   $0x8030f2
+  803152:	e8 4e d4 ff ff       	call   8005a5 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803157:	8b 43 04             	mov    0x4(%ebx),%eax
+  80315a:	c1 e0 1c             	shl    $0x1c,%eax
+  80315d:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  803160:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803163:	c9                   	leave
+  803164:	c3                   	ret
+
+00803165 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803165:	55                   	push   %ebp
+  803166:	89 e5                	mov    %esp,%ebp
+  803168:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80316b:	68 84 51 80 00       	push   $0x805184
+  803170:	ff 75 0c             	push   0xc(%ebp)
+  803173:	e8 1a d9 ff ff       	call   800a92 <strcpy>
+	return 0;
+}
+  803178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+0080317f <devsock_close>:
+{
+  80317f:	55                   	push   %ebp
+  803180:	89 e5                	mov    %esp,%ebp
+  803182:	53                   	push   %ebx
+  803183:	83 ec 10             	sub    $0x10,%esp
+  803186:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803189:	53                   	push   %ebx
+  80318a:	e8 86 15 00 00       	call   804715 <pageref>
+  80318f:	89 c2                	mov    %eax,%edx
+  803191:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803199:	83 fa 01             	cmp    $0x1,%edx
+  80319c:	74 05                	je     8031a3 <devsock_close+0x24>
+}
+  80319e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031a1:	c9                   	leave
+  8031a2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8031a3:	83 ec 0c             	sub    $0xc,%esp
+  8031a6:	ff 73 0c             	push   0xc(%ebx)
+  8031a9:	e8 b7 02 00 00       	call   803465 <nsipc_close>
+  8031ae:	83 c4 10             	add    $0x10,%esp
+  8031b1:	eb eb                	jmp    80319e <devsock_close+0x1f>
+
+008031b3 <devsock_write>:
+{
+  8031b3:	55                   	push   %ebp
+  8031b4:	89 e5                	mov    %esp,%ebp
+  8031b6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8031b9:	6a 00                	push   $0x0
+  8031bb:	ff 75 10             	push   0x10(%ebp)
+  8031be:	ff 75 0c             	push   0xc(%ebp)
+  8031c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c4:	ff 70 0c             	push   0xc(%eax)
+  8031c7:	e8 79 03 00 00       	call   803545 <nsipc_send>
+}
+  8031cc:	c9                   	leave
+  8031cd:	c3                   	ret
+
+008031ce <devsock_read>:
+{
+  8031ce:	55                   	push   %ebp
+  8031cf:	89 e5                	mov    %esp,%ebp
+  8031d1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8031d4:	6a 00                	push   $0x0
+  8031d6:	ff 75 10             	push   0x10(%ebp)
+  8031d9:	ff 75 0c             	push   0xc(%ebp)
+  8031dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031df:	ff 70 0c             	push   0xc(%eax)
+  8031e2:	e8 ef 02 00 00       	call   8034d6 <nsipc_recv>
+}
+  8031e7:	c9                   	leave
+  8031e8:	c3                   	ret
+
+008031e9 <fd2sockid>:
+{
+  8031e9:	55                   	push   %ebp
+  8031ea:	89 e5                	mov    %esp,%ebp
+  8031ec:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8031ef:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8031f2:	52                   	push   %edx
+  8031f3:	50                   	push   %eax
+  8031f4:	e8 f7 e9 ff ff       	call   801bf0 <fd_lookup>
+  8031f9:	83 c4 10             	add    $0x10,%esp
+  8031fc:	85 c0                	test   %eax,%eax
+  8031fe:	78 10                	js     803210 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803203:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  803209:	39 08                	cmp    %ecx,(%eax)
+  80320b:	75 05                	jne    803212 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80320d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803210:	c9                   	leave
+  803211:	c3                   	ret
+		return -E_NOT_SUPP;
+  803212:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803217:	eb f7                	jmp    803210 <fd2sockid+0x27>
+
+00803219 <alloc_sockfd>:
+{
+  803219:	55                   	push   %ebp
+  80321a:	89 e5                	mov    %esp,%ebp
+  80321c:	56                   	push   %esi
+  80321d:	53                   	push   %ebx
+  80321e:	83 ec 1c             	sub    $0x1c,%esp
+  803221:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803223:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803226:	50                   	push   %eax
+  803227:	e8 6e e9 ff ff       	call   801b9a <fd_alloc>
+  80322c:	89 c3                	mov    %eax,%ebx
+  80322e:	83 c4 10             	add    $0x10,%esp
+  803231:	85 c0                	test   %eax,%eax
+  803233:	78 43                	js     803278 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803235:	83 ec 04             	sub    $0x4,%esp
+  803238:	68 07 04 00 00       	push   $0x407
+  80323d:	ff 75 f4             	push   -0xc(%ebp)
+  803240:	6a 00                	push   $0x0
+  803242:	e8 89 dc ff ff       	call   800ed0 <sys_page_alloc>
+  803247:	89 c3                	mov    %eax,%ebx
+  803249:	83 c4 10             	add    $0x10,%esp
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	78 28                	js     803278 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803253:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  803259:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80325b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80325e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803265:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803268:	83 ec 0c             	sub    $0xc,%esp
+  80326b:	50                   	push   %eax
+  80326c:	e8 02 e9 ff ff       	call   801b73 <fd2num>
+  803271:	89 c3                	mov    %eax,%ebx
+  803273:	83 c4 10             	add    $0x10,%esp
+  803276:	eb 0c                	jmp    803284 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803278:	83 ec 0c             	sub    $0xc,%esp
+  80327b:	56                   	push   %esi
+  80327c:	e8 e4 01 00 00       	call   803465 <nsipc_close>
+		return r;
+  803281:	83 c4 10             	add    $0x10,%esp
+}
+  803284:	89 d8                	mov    %ebx,%eax
+  803286:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803289:	5b                   	pop    %ebx
+  80328a:	5e                   	pop    %esi
+  80328b:	5d                   	pop    %ebp
+  80328c:	c3                   	ret
+
+0080328d <accept>:
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803293:	8b 45 08             	mov    0x8(%ebp),%eax
+  803296:	e8 4e ff ff ff       	call   8031e9 <fd2sockid>
+  80329b:	85 c0                	test   %eax,%eax
+  80329d:	78 1b                	js     8032ba <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80329f:	83 ec 04             	sub    $0x4,%esp
+  8032a2:	ff 75 10             	push   0x10(%ebp)
+  8032a5:	ff 75 0c             	push   0xc(%ebp)
+  8032a8:	50                   	push   %eax
+  8032a9:	e8 0e 01 00 00       	call   8033bc <nsipc_accept>
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	85 c0                	test   %eax,%eax
+  8032b3:	78 05                	js     8032ba <accept+0x2d>
+	return alloc_sockfd(r);
+  8032b5:	e8 5f ff ff ff       	call   803219 <alloc_sockfd>
+}
+  8032ba:	c9                   	leave
+  8032bb:	c3                   	ret
+
+008032bc <bind>:
+{
+  8032bc:	55                   	push   %ebp
+  8032bd:	89 e5                	mov    %esp,%ebp
+  8032bf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c5:	e8 1f ff ff ff       	call   8031e9 <fd2sockid>
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	78 12                	js     8032e0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8032ce:	83 ec 04             	sub    $0x4,%esp
+  8032d1:	ff 75 10             	push   0x10(%ebp)
+  8032d4:	ff 75 0c             	push   0xc(%ebp)
+  8032d7:	50                   	push   %eax
+  8032d8:	e8 31 01 00 00       	call   80340e <nsipc_bind>
+  8032dd:	83 c4 10             	add    $0x10,%esp
+}
+  8032e0:	c9                   	leave
+  8032e1:	c3                   	ret
+
+008032e2 <shutdown>:
+{
+  8032e2:	55                   	push   %ebp
+  8032e3:	89 e5                	mov    %esp,%ebp
+  8032e5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032eb:	e8 f9 fe ff ff       	call   8031e9 <fd2sockid>
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	78 0f                	js     803303 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8032f4:	83 ec 08             	sub    $0x8,%esp
+  8032f7:	ff 75 0c             	push   0xc(%ebp)
+  8032fa:	50                   	push   %eax
+  8032fb:	e8 43 01 00 00       	call   803443 <nsipc_shutdown>
+  803300:	83 c4 10             	add    $0x10,%esp
+}
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+
+00803305 <connect>:
+{
+  803305:	55                   	push   %ebp
+  803306:	89 e5                	mov    %esp,%ebp
+  803308:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80330b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80330e:	e8 d6 fe ff ff       	call   8031e9 <fd2sockid>
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 12                	js     803329 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803317:	83 ec 04             	sub    $0x4,%esp
+  80331a:	ff 75 10             	push   0x10(%ebp)
+  80331d:	ff 75 0c             	push   0xc(%ebp)
+  803320:	50                   	push   %eax
+  803321:	e8 59 01 00 00       	call   80347f <nsipc_connect>
+  803326:	83 c4 10             	add    $0x10,%esp
+}
+  803329:	c9                   	leave
+  80332a:	c3                   	ret
+
+0080332b <listen>:
+{
+  80332b:	55                   	push   %ebp
+  80332c:	89 e5                	mov    %esp,%ebp
+  80332e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803331:	8b 45 08             	mov    0x8(%ebp),%eax
+  803334:	e8 b0 fe ff ff       	call   8031e9 <fd2sockid>
+  803339:	85 c0                	test   %eax,%eax
+  80333b:	78 0f                	js     80334c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80333d:	83 ec 08             	sub    $0x8,%esp
+  803340:	ff 75 0c             	push   0xc(%ebp)
+  803343:	50                   	push   %eax
+  803344:	e8 6b 01 00 00       	call   8034b4 <nsipc_listen>
+  803349:	83 c4 10             	add    $0x10,%esp
+}
+  80334c:	c9                   	leave
+  80334d:	c3                   	ret
+
+0080334e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80334e:	55                   	push   %ebp
+  80334f:	89 e5                	mov    %esp,%ebp
+  803351:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803354:	ff 75 10             	push   0x10(%ebp)
+  803357:	ff 75 0c             	push   0xc(%ebp)
+  80335a:	ff 75 08             	push   0x8(%ebp)
+  80335d:	e8 41 02 00 00       	call   8035a3 <nsipc_socket>
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	85 c0                	test   %eax,%eax
+  803367:	78 05                	js     80336e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803369:	e8 ab fe ff ff       	call   803219 <alloc_sockfd>
+}
+  80336e:	c9                   	leave
+  80336f:	c3                   	ret
+
+00803370 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803370:	55                   	push   %ebp
+  803371:	89 e5                	mov    %esp,%ebp
+  803373:	53                   	push   %ebx
+  803374:	83 ec 04             	sub    $0x4,%esp
+  803377:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803379:	83 3d 0c 70 80 00 00 	cmpl   $0x0,0x80700c
+  803380:	74 26                	je     8033a8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803382:	6a 07                	push   $0x7
+  803384:	68 00 90 80 00       	push   $0x809000
+  803389:	53                   	push   %ebx
+  80338a:	ff 35 0c 70 80 00    	push   0x80700c
+  803390:	e8 49 e7 ff ff       	call   801ade <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803395:	83 c4 0c             	add    $0xc,%esp
+  803398:	6a 00                	push   $0x0
+  80339a:	6a 00                	push   $0x0
+  80339c:	6a 00                	push   $0x0
+  80339e:	e8 45 e6 ff ff       	call   8019e8 <ipc_recv>
+}
+  8033a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033a6:	c9                   	leave
+  8033a7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8033a8:	83 ec 0c             	sub    $0xc,%esp
+  8033ab:	6a 02                	push   $0x2
+  8033ad:	e8 82 e7 ff ff       	call   801b34 <ipc_find_env>
+  8033b2:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  8033b7:	83 c4 10             	add    $0x10,%esp
+  8033ba:	eb c6                	jmp    803382 <nsipc+0x12>
+
+008033bc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8033bc:	55                   	push   %ebp
+  8033bd:	89 e5                	mov    %esp,%ebp
+  8033bf:	56                   	push   %esi
+  8033c0:	53                   	push   %ebx
+  8033c1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8033c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8033cc:	8b 06                	mov    (%esi),%eax
+  8033ce:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8033d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033d8:	e8 93 ff ff ff       	call   803370 <nsipc>
+  8033dd:	89 c3                	mov    %eax,%ebx
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	79 09                	jns    8033ec <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8033e3:	89 d8                	mov    %ebx,%eax
+  8033e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033e8:	5b                   	pop    %ebx
+  8033e9:	5e                   	pop    %esi
+  8033ea:	5d                   	pop    %ebp
+  8033eb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8033ec:	83 ec 04             	sub    $0x4,%esp
+  8033ef:	ff 35 10 90 80 00    	push   0x809010
+  8033f5:	68 00 90 80 00       	push   $0x809000
+  8033fa:	ff 75 0c             	push   0xc(%ebp)
+  8033fd:	e8 16 d8 ff ff       	call   800c18 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803402:	a1 10 90 80 00       	mov    0x809010,%eax
+  803407:	89 06                	mov    %eax,(%esi)
+  803409:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80340c:	eb d5                	jmp    8033e3 <nsipc_accept+0x27>
+
+0080340e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	53                   	push   %ebx
+  803412:	83 ec 08             	sub    $0x8,%esp
+  803415:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803418:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803420:	53                   	push   %ebx
+  803421:	ff 75 0c             	push   0xc(%ebp)
+  803424:	68 04 90 80 00       	push   $0x809004
+  803429:	e8 ea d7 ff ff       	call   800c18 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80342e:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803434:	b8 02 00 00 00       	mov    $0x2,%eax
+  803439:	e8 32 ff ff ff       	call   803370 <nsipc>
+}
+  80343e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803441:	c9                   	leave
+  803442:	c3                   	ret
+
+00803443 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803443:	55                   	push   %ebp
+  803444:	89 e5                	mov    %esp,%ebp
+  803446:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803449:	8b 45 08             	mov    0x8(%ebp),%eax
+  80344c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803451:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803454:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803459:	b8 03 00 00 00       	mov    $0x3,%eax
+  80345e:	e8 0d ff ff ff       	call   803370 <nsipc>
+}
+  803463:	c9                   	leave
+  803464:	c3                   	ret
+
+00803465 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803465:	55                   	push   %ebp
+  803466:	89 e5                	mov    %esp,%ebp
+  803468:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80346b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346e:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803473:	b8 04 00 00 00       	mov    $0x4,%eax
+  803478:	e8 f3 fe ff ff       	call   803370 <nsipc>
+}
+  80347d:	c9                   	leave
+  80347e:	c3                   	ret
+
+0080347f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80347f:	55                   	push   %ebp
+  803480:	89 e5                	mov    %esp,%ebp
+  803482:	53                   	push   %ebx
+  803483:	83 ec 08             	sub    $0x8,%esp
+  803486:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803489:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348c:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803491:	53                   	push   %ebx
+  803492:	ff 75 0c             	push   0xc(%ebp)
+  803495:	68 04 90 80 00       	push   $0x809004
+  80349a:	e8 79 d7 ff ff       	call   800c18 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80349f:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8034a5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8034aa:	e8 c1 fe ff ff       	call   803370 <nsipc>
+}
+  8034af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034b2:	c9                   	leave
+  8034b3:	c3                   	ret
+
+008034b4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8034b4:	55                   	push   %ebp
+  8034b5:	89 e5                	mov    %esp,%ebp
+  8034b7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8034ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034bd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8034c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c5:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8034ca:	b8 06 00 00 00       	mov    $0x6,%eax
+  8034cf:	e8 9c fe ff ff       	call   803370 <nsipc>
+}
+  8034d4:	c9                   	leave
+  8034d5:	c3                   	ret
+
+008034d6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8034d6:	55                   	push   %ebp
+  8034d7:	89 e5                	mov    %esp,%ebp
+  8034d9:	56                   	push   %esi
+  8034da:	53                   	push   %ebx
+  8034db:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8034de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8034e6:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8034ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034ef:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8034f4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8034f9:	e8 72 fe ff ff       	call   803370 <nsipc>
+  8034fe:	89 c3                	mov    %eax,%ebx
+  803500:	85 c0                	test   %eax,%eax
+  803502:	78 22                	js     803526 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803504:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803509:	39 c6                	cmp    %eax,%esi
+  80350b:	0f 4e c6             	cmovle %esi,%eax
+  80350e:	39 c3                	cmp    %eax,%ebx
+  803510:	7f 1d                	jg     80352f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803512:	83 ec 04             	sub    $0x4,%esp
+  803515:	53                   	push   %ebx
+  803516:	68 00 90 80 00       	push   $0x809000
+  80351b:	ff 75 0c             	push   0xc(%ebp)
+  80351e:	e8 f5 d6 ff ff       	call   800c18 <memmove>
+  803523:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803526:	89 d8                	mov    %ebx,%eax
+  803528:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80352b:	5b                   	pop    %ebx
+  80352c:	5e                   	pop    %esi
+  80352d:	5d                   	pop    %ebp
+  80352e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80352f:	68 90 51 80 00       	push   $0x805190
+  803534:	68 8b 4a 80 00       	push   $0x804a8b
+  803539:	6a 62                	push   $0x62
+  80353b:	68 a5 51 80 00       	push   $0x8051a5
+  803540:	e8 8e ce ff ff       	call   8003d3 <_panic>
+
+00803545 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803545:	55                   	push   %ebp
+  803546:	89 e5                	mov    %esp,%ebp
+  803548:	53                   	push   %ebx
+  803549:	83 ec 04             	sub    $0x4,%esp
+  80354c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80354f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803552:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803557:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80355d:	7f 2e                	jg     80358d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80355f:	83 ec 04             	sub    $0x4,%esp
+  803562:	53                   	push   %ebx
+  803563:	ff 75 0c             	push   0xc(%ebp)
+  803566:	68 0c 90 80 00       	push   $0x80900c
+  80356b:	e8 a8 d6 ff ff       	call   800c18 <memmove>
+	nsipcbuf.send.req_size = size;
+  803570:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803576:	8b 45 14             	mov    0x14(%ebp),%eax
+  803579:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80357e:	b8 08 00 00 00       	mov    $0x8,%eax
+  803583:	e8 e8 fd ff ff       	call   803370 <nsipc>
+}
+  803588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80358b:	c9                   	leave
+  80358c:	c3                   	ret
+	assert(size < 1600);
+  80358d:	68 b1 51 80 00       	push   $0x8051b1
+  803592:	68 8b 4a 80 00       	push   $0x804a8b
+  803597:	6a 6d                	push   $0x6d
+  803599:	68 a5 51 80 00       	push   $0x8051a5
+  80359e:	e8 30 ce ff ff       	call   8003d3 <_panic>
+
+008035a3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8035a3:	55                   	push   %ebp
+  8035a4:	89 e5                	mov    %esp,%ebp
+  8035a6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8035a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ac:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8035b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035b4:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8035b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035bc:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8035c1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8035c6:	e8 a5 fd ff ff       	call   803370 <nsipc>
+}
+  8035cb:	c9                   	leave
+  8035cc:	c3                   	ret
+
+008035cd <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8035cd:	55                   	push   %ebp
+  8035ce:	89 e5                	mov    %esp,%ebp
+  8035d0:	53                   	push   %ebx
+  8035d1:	83 ec 10             	sub    $0x10,%esp
+  8035d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8035d7:	68 10 70 80 00       	push   $0x807010
+  8035dc:	e8 50 07 00 00       	call   803d31 <mutex_lock>
+	if (v == 0)
+  8035e1:	83 c4 10             	add    $0x10,%esp
+  8035e4:	85 db                	test   %ebx,%ebx
+  8035e6:	0f 84 85 00 00 00    	je     803671 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8035ec:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8035f2:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8035f7:	77 51                	ja     80364a <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8035f9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8035ff:	89 d8                	mov    %ebx,%eax
+  803601:	c1 e8 0c             	shr    $0xc,%eax
+  803604:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80360b:	f6 c4 02             	test   $0x2,%ah
+  80360e:	74 50                	je     803660 <free+0x93>
+		sys_page_unmap(0, c);
+  803610:	83 ec 08             	sub    $0x8,%esp
+  803613:	53                   	push   %ebx
+  803614:	6a 00                	push   $0x0
+  803616:	e8 4e d9 ff ff       	call   800f69 <sys_page_unmap>
+		c += PGSIZE;
+  80361b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803621:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803627:	83 c4 10             	add    $0x10,%esp
+  80362a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80362f:	76 ce                	jbe    8035ff <free+0x32>
+  803631:	68 fb 51 80 00       	push   $0x8051fb
+  803636:	68 8b 4a 80 00       	push   $0x804a8b
+  80363b:	68 82 00 00 00       	push   $0x82
+  803640:	68 ee 51 80 00       	push   $0x8051ee
+  803645:	e8 89 cd ff ff       	call   8003d3 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80364a:	68 c0 51 80 00       	push   $0x8051c0
+  80364f:	68 8b 4a 80 00       	push   $0x804a8b
+  803654:	6a 7b                	push   $0x7b
+  803656:	68 ee 51 80 00       	push   $0x8051ee
+  80365b:	e8 73 cd ff ff       	call   8003d3 <_panic>
+	if (--(*ref) == 0)
+  803660:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803666:	83 e8 01             	sub    $0x1,%eax
+  803669:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80366f:	74 15                	je     803686 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803671:	83 ec 0c             	sub    $0xc,%esp
+  803674:	68 10 70 80 00       	push   $0x807010
+  803679:	e8 20 07 00 00       	call   803d9e <mutex_unlock>
+}
+  80367e:	83 c4 10             	add    $0x10,%esp
+  803681:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803684:	c9                   	leave
+  803685:	c3                   	ret
+		sys_page_unmap(0, c);
+  803686:	83 ec 08             	sub    $0x8,%esp
+  803689:	53                   	push   %ebx
+  80368a:	6a 00                	push   $0x0
+  80368c:	e8 d8 d8 ff ff       	call   800f69 <sys_page_unmap>
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	eb db                	jmp    803671 <free+0xa4>
+
+00803696 <malloc>:
+{
+  803696:	55                   	push   %ebp
+  803697:	89 e5                	mov    %esp,%ebp
+  803699:	57                   	push   %edi
+  80369a:	56                   	push   %esi
+  80369b:	53                   	push   %ebx
+  80369c:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80369f:	68 10 70 80 00       	push   $0x807010
+  8036a4:	e8 88 06 00 00       	call   803d31 <mutex_lock>
+	if (mptr == 0)
+  8036a9:	8b 3d 14 70 80 00    	mov    0x807014,%edi
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	85 ff                	test   %edi,%edi
+  8036b4:	74 6c                	je     803722 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8036b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b9:	83 c0 03             	add    $0x3,%eax
+  8036bc:	83 e0 fc             	and    $0xfffffffc,%eax
+  8036bf:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8036c1:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8036c6:	0f 87 64 01 00 00    	ja     803830 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8036cc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036d2:	74 30                	je     803704 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8036d4:	89 f9                	mov    %edi,%ecx
+  8036d6:	c1 e9 0c             	shr    $0xc,%ecx
+  8036d9:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8036dd:	c1 e8 0c             	shr    $0xc,%eax
+  8036e0:	39 c1                	cmp    %eax,%ecx
+  8036e2:	74 5f                	je     803743 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8036e4:	83 ec 0c             	sub    $0xc,%esp
+  8036e7:	57                   	push   %edi
+  8036e8:	e8 e0 fe ff ff       	call   8035cd <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8036ed:	a1 14 70 80 00       	mov    0x807014,%eax
+  8036f2:	05 00 10 00 00       	add    $0x1000,%eax
+  8036f7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8036fc:	a3 14 70 80 00       	mov    %eax,0x807014
+  803701:	83 c4 10             	add    $0x10,%esp
+  803704:	8b 0d 14 70 80 00    	mov    0x807014,%ecx
+{
+  80370a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80370f:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803713:	8d 7e 04             	lea    0x4(%esi),%edi
+  803716:	89 cb                	mov    %ecx,%ebx
+  803718:	01 f9                	add    %edi,%ecx
+  80371a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80371d:	e9 8b 00 00 00       	jmp    8037ad <malloc+0x117>
+		mptr = mbegin;
+  803722:	c7 05 14 70 80 00 00 	movl   $0x8000000,0x807014
+  803729:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80372c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80372f:	83 c0 03             	add    $0x3,%eax
+  803732:	83 e0 fc             	and    $0xfffffffc,%eax
+  803735:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803737:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80373c:	76 c6                	jbe    803704 <malloc+0x6e>
+  80373e:	e9 d6 00 00 00       	jmp    803819 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803743:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803749:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80374e:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803752:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803755:	a3 14 70 80 00       	mov    %eax,0x807014
+			return v;
+  80375a:	e9 ba 00 00 00       	jmp    803819 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80375f:	05 00 10 00 00       	add    $0x1000,%eax
+  803764:	39 c8                	cmp    %ecx,%eax
+  803766:	0f 83 cb 00 00 00    	jae    803837 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80376c:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803771:	77 22                	ja     803795 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803773:	89 c2                	mov    %eax,%edx
+  803775:	c1 ea 16             	shr    $0x16,%edx
+  803778:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80377f:	f6 c2 01             	test   $0x1,%dl
+  803782:	74 db                	je     80375f <malloc+0xc9>
+  803784:	89 c2                	mov    %eax,%edx
+  803786:	c1 ea 0c             	shr    $0xc,%edx
+  803789:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803790:	f6 c2 01             	test   $0x1,%dl
+  803793:	74 ca                	je     80375f <malloc+0xc9>
+		if (mptr == mend) {
+  803795:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80379b:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8037a1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8037a5:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8037ab:	74 04                	je     8037b1 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8037ad:	89 d8                	mov    %ebx,%eax
+  8037af:	eb b3                	jmp    803764 <malloc+0xce>
+  8037b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8037b4:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8037b9:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8037bd:	83 ea 01             	sub    $0x1,%edx
+  8037c0:	0f 85 50 ff ff ff    	jne    803716 <malloc+0x80>
+  8037c6:	c7 05 14 70 80 00 00 	movl   $0x8000000,0x807014
+  8037cd:	00 00 08 
+				return 0;	/* out of address space */
+  8037d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d5:	eb 42                	jmp    803819 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8037d7:	85 db                	test   %ebx,%ebx
+  8037d9:	78 1e                	js     8037f9 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8037db:	83 ec 08             	sub    $0x8,%esp
+  8037de:	89 d8                	mov    %ebx,%eax
+  8037e0:	03 05 14 70 80 00    	add    0x807014,%eax
+  8037e6:	50                   	push   %eax
+  8037e7:	6a 00                	push   $0x0
+  8037e9:	e8 7b d7 ff ff       	call   800f69 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8037ee:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8037f4:	83 c4 10             	add    $0x10,%esp
+  8037f7:	eb de                	jmp    8037d7 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8037f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037fe:	eb 19                	jmp    803819 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803800:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803803:	8b 3d 14 70 80 00    	mov    0x807014,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803809:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803810:	00 
+	mptr += n;
+  803811:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803814:	a3 14 70 80 00       	mov    %eax,0x807014
+	mutex_unlock(&malloc_mu);
+  803819:	83 ec 0c             	sub    $0xc,%esp
+  80381c:	68 10 70 80 00       	push   $0x807010
+  803821:	e8 78 05 00 00       	call   803d9e <mutex_unlock>
+}
+  803826:	89 f8                	mov    %edi,%eax
+  803828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382b:	5b                   	pop    %ebx
+  80382c:	5e                   	pop    %esi
+  80382d:	5f                   	pop    %edi
+  80382e:	5d                   	pop    %ebp
+  80382f:	c3                   	ret
+		return 0;
+  803830:	bf 00 00 00 00       	mov    $0x0,%edi
+  803835:	eb e2                	jmp    803819 <malloc+0x183>
+  803837:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80383b:	74 06                	je     803843 <malloc+0x1ad>
+  80383d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803843:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803848:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80384b:	39 fb                	cmp    %edi,%ebx
+  80384d:	73 b1                	jae    803800 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80384f:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803855:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803858:	39 fe                	cmp    %edi,%esi
+  80385a:	0f 92 c0             	setb   %al
+  80385d:	0f b6 c0             	movzbl %al,%eax
+  803860:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803863:	83 c8 07             	or     $0x7,%eax
+  803866:	50                   	push   %eax
+  803867:	89 d8                	mov    %ebx,%eax
+  803869:	03 05 14 70 80 00    	add    0x807014,%eax
+  80386f:	50                   	push   %eax
+  803870:	6a 00                	push   $0x0
+  803872:	e8 59 d6 ff ff       	call   800ed0 <sys_page_alloc>
+  803877:	83 c4 10             	add    $0x10,%esp
+  80387a:	85 c0                	test   %eax,%eax
+  80387c:	0f 88 55 ff ff ff    	js     8037d7 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803882:	89 f3                	mov    %esi,%ebx
+  803884:	eb c5                	jmp    80384b <malloc+0x1b5>
+
+00803886 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803886:	55                   	push   %ebp
+  803887:	89 e5                	mov    %esp,%ebp
+  803889:	56                   	push   %esi
+  80388a:	53                   	push   %ebx
+  80388b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80388e:	83 ec 0c             	sub    $0xc,%esp
+  803891:	ff 75 08             	push   0x8(%ebp)
+  803894:	e8 ea e2 ff ff       	call   801b83 <fd2data>
+  803899:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80389b:	83 c4 08             	add    $0x8,%esp
+  80389e:	68 13 52 80 00       	push   $0x805213
+  8038a3:	53                   	push   %ebx
+  8038a4:	e8 e9 d1 ff ff       	call   800a92 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8038a9:	8b 46 04             	mov    0x4(%esi),%eax
+  8038ac:	2b 06                	sub    (%esi),%eax
+  8038ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8038b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8038bb:	00 00 00 
+	stat->st_dev = &devpipe;
+  8038be:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8038c5:	62 80 00 
+	return 0;
+}
+  8038c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038d0:	5b                   	pop    %ebx
+  8038d1:	5e                   	pop    %esi
+  8038d2:	5d                   	pop    %ebp
+  8038d3:	c3                   	ret
+
+008038d4 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8038d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8038d9:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8038dd:	85 c9                	test   %ecx,%ecx
+  8038df:	75 01                	jne    8038e2 <pipewake+0xe>
+  8038e1:	c3                   	ret
+{
+  8038e2:	55                   	push   %ebp
+  8038e3:	89 e5                	mov    %esp,%ebp
+  8038e5:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8038e8:	68 00 04 00 00       	push   $0x400
+  8038ed:	52                   	push   %edx
+  8038ee:	e8 21 d9 ff ff       	call   801214 <sys_futex_wake>
+  8038f3:	83 c4 10             	add    $0x10,%esp
+}
+  8038f6:	c9                   	leave
+  8038f7:	c3                   	ret
+
+008038f8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8038f8:	55                   	push   %ebp
+  8038f9:	89 e5                	mov    %esp,%ebp
+  8038fb:	56                   	push   %esi
+  8038fc:	53                   	push   %ebx
+  8038fd:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803900:	83 ec 0c             	sub    $0xc,%esp
+  803903:	56                   	push   %esi
+  803904:	e8 7a e2 ff ff       	call   801b83 <fd2data>
+  803909:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80390b:	83 c4 08             	add    $0x8,%esp
+  80390e:	56                   	push   %esi
+  80390f:	6a 00                	push   $0x0
+  803911:	e8 53 d6 ff ff       	call   800f69 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803916:	8d 53 04             	lea    0x4(%ebx),%edx
+  803919:	8d 43 08             	lea    0x8(%ebx),%eax
+  80391c:	e8 b3 ff ff ff       	call   8038d4 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803921:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803924:	89 da                	mov    %ebx,%edx
+  803926:	e8 a9 ff ff ff       	call   8038d4 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80392b:	89 34 24             	mov    %esi,(%esp)
+  80392e:	e8 50 e2 ff ff       	call   801b83 <fd2data>
+  803933:	83 c4 08             	add    $0x8,%esp
+  803936:	50                   	push   %eax
+  803937:	6a 00                	push   $0x0
+  803939:	e8 2b d6 ff ff       	call   800f69 <sys_page_unmap>
+}
+  80393e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803941:	5b                   	pop    %ebx
+  803942:	5e                   	pop    %esi
+  803943:	5d                   	pop    %ebp
+  803944:	c3                   	ret
+
+00803945 <_pipeisclosed>:
+{
+  803945:	55                   	push   %ebp
+  803946:	89 e5                	mov    %esp,%ebp
+  803948:	57                   	push   %edi
+  803949:	56                   	push   %esi
+  80394a:	53                   	push   %ebx
+  80394b:	83 ec 1c             	sub    $0x1c,%esp
+  80394e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803951:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803953:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803958:	eb 5d                	jmp    8039b7 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80395a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803960:	8b 02                	mov    (%edx),%eax
+  803962:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803965:	83 ec 0c             	sub    $0xc,%esp
+  803968:	ff 75 e0             	push   -0x20(%ebp)
+  80396b:	e8 a5 0d 00 00       	call   804715 <pageref>
+  803970:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803973:	89 3c 24             	mov    %edi,(%esp)
+  803976:	e8 9a 0d 00 00       	call   804715 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80397b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80397d:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803983:	83 c4 10             	add    $0x10,%esp
+  803986:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80398c:	77 15                	ja     8039a3 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80398e:	89 f2                	mov    %esi,%edx
+  803990:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803992:	c1 ea 10             	shr    $0x10,%edx
+  803995:	74 0c                	je     8039a3 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803997:	c1 e2 10             	shl    $0x10,%edx
+  80399a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80399f:	29 d1                	sub    %edx,%ecx
+  8039a1:	eb 06                	jmp    8039a9 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8039a3:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  8039a9:	8b 11                	mov    (%ecx),%edx
+  8039ab:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8039ae:	39 d3                	cmp    %edx,%ebx
+  8039b0:	74 6e                	je     803a20 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8039b2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039b5:	74 24                	je     8039db <_pipeisclosed+0x96>
+  8039b7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039b9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039bf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039c4:	77 94                	ja     80395a <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039c6:	89 f0                	mov    %esi,%eax
+  8039c8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039ca:	c1 e8 10             	shr    $0x10,%eax
+  8039cd:	74 8b                	je     80395a <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039cf:	c1 e0 10             	shl    $0x10,%eax
+  8039d2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039d7:	29 c2                	sub    %eax,%edx
+  8039d9:	eb 85                	jmp    803960 <_pipeisclosed+0x1b>
+  8039db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039e8:	77 18                	ja     803a02 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039ef:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039f1:	c1 e8 10             	shr    $0x10,%eax
+  8039f4:	74 0c                	je     803a02 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039f6:	c1 e0 10             	shl    $0x10,%eax
+  8039f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039fe:	29 c2                	sub    %eax,%edx
+  803a00:	eb 06                	jmp    803a08 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803a02:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803a08:	8b 02                	mov    (%edx),%eax
+  803a0a:	8b 40 58             	mov    0x58(%eax),%eax
+  803a0d:	6a 01                	push   $0x1
+  803a0f:	50                   	push   %eax
+  803a10:	53                   	push   %ebx
+  803a11:	68 1a 52 80 00       	push   $0x80521a
+  803a16:	e8 93 ca ff ff       	call   8004ae <cprintf>
+  803a1b:	83 c4 10             	add    $0x10,%esp
+  803a1e:	eb 97                	jmp    8039b7 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803a20:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803a23:	0f 94 c0             	sete   %al
+  803a26:	0f b6 c0             	movzbl %al,%eax
+}
+  803a29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a2c:	5b                   	pop    %ebx
+  803a2d:	5e                   	pop    %esi
+  803a2e:	5f                   	pop    %edi
+  803a2f:	5d                   	pop    %ebp
+  803a30:	c3                   	ret
+
+00803a31 <devpipe_write>:
+{
+  803a31:	55                   	push   %ebp
+  803a32:	89 e5                	mov    %esp,%ebp
+  803a34:	57                   	push   %edi
+  803a35:	56                   	push   %esi
+  803a36:	53                   	push   %ebx
+  803a37:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803a3a:	ff 75 08             	push   0x8(%ebp)
+  803a3d:	e8 41 e1 ff ff       	call   801b83 <fd2data>
+  803a42:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a44:	83 c4 10             	add    $0x10,%esp
+  803a47:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803a4e:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803a51:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a54:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803a57:	0f 84 96 00 00 00    	je     803af3 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803a5d:	8d 73 08             	lea    0x8(%ebx),%esi
+  803a60:	eb 32                	jmp    803a94 <devpipe_write+0x63>
+  803a62:	89 fa                	mov    %edi,%edx
+  803a64:	89 f0                	mov    %esi,%eax
+  803a66:	e8 69 fe ff ff       	call   8038d4 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803a6b:	8b 43 04             	mov    0x4(%ebx),%eax
+  803a6e:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803a71:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a76:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803a7b:	83 ec 04             	sub    $0x4,%esp
+  803a7e:	6a 0a                	push   $0xa
+  803a80:	50                   	push   %eax
+  803a81:	53                   	push   %ebx
+  803a82:	e8 5e d7 ff ff       	call   8011e5 <sys_futex_wait>
+  803a87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803a8c:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803a91:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803a94:	8b 43 04             	mov    0x4(%ebx),%eax
+  803a97:	8b 0b                	mov    (%ebx),%ecx
+  803a99:	8d 51 20             	lea    0x20(%ecx),%edx
+  803a9c:	39 d0                	cmp    %edx,%eax
+  803a9e:	72 1b                	jb     803abb <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803aa0:	89 da                	mov    %ebx,%edx
+  803aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa5:	e8 9b fe ff ff       	call   803945 <_pipeisclosed>
+  803aaa:	85 c0                	test   %eax,%eax
+  803aac:	74 b4                	je     803a62 <devpipe_write+0x31>
+				return 0;
+  803aae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ab6:	5b                   	pop    %ebx
+  803ab7:	5e                   	pop    %esi
+  803ab8:	5f                   	pop    %edi
+  803ab9:	5d                   	pop    %ebp
+  803aba:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803abb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803abe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803ac1:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803ac5:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803ac8:	89 c2                	mov    %eax,%edx
+  803aca:	c1 fa 1f             	sar    $0x1f,%edx
+  803acd:	89 d1                	mov    %edx,%ecx
+  803acf:	c1 e9 1b             	shr    $0x1b,%ecx
+  803ad2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803ad5:	83 e2 1f             	and    $0x1f,%edx
+  803ad8:	29 ca                	sub    %ecx,%edx
+  803ada:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803ade:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803ae2:	83 c0 01             	add    $0x1,%eax
+  803ae5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803ae8:	83 c6 01             	add    $0x1,%esi
+  803aeb:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803aee:	e9 5e ff ff ff       	jmp    803a51 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803af3:	8d 53 04             	lea    0x4(%ebx),%edx
+  803af6:	8d 43 08             	lea    0x8(%ebx),%eax
+  803af9:	e8 d6 fd ff ff       	call   8038d4 <pipewake>
+	return i;
+  803afe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b01:	eb b0                	jmp    803ab3 <devpipe_write+0x82>
+
+00803b03 <devpipe_read>:
+{
+  803b03:	55                   	push   %ebp
+  803b04:	89 e5                	mov    %esp,%ebp
+  803b06:	57                   	push   %edi
+  803b07:	56                   	push   %esi
+  803b08:	53                   	push   %ebx
+  803b09:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803b0c:	ff 75 08             	push   0x8(%ebp)
+  803b0f:	e8 6f e0 ff ff       	call   801b83 <fd2data>
+  803b14:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803b16:	83 c4 10             	add    $0x10,%esp
+  803b19:	be 00 00 00 00       	mov    $0x0,%esi
+  803b1e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b21:	74 6c                	je     803b8f <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803b23:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803b26:	eb 25                	jmp    803b4d <devpipe_read+0x4a>
+  803b28:	8b 13                	mov    (%ebx),%edx
+  803b2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b2f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803b34:	83 ec 04             	sub    $0x4,%esp
+  803b37:	6a 0a                	push   $0xa
+  803b39:	52                   	push   %edx
+  803b3a:	57                   	push   %edi
+  803b3b:	e8 a5 d6 ff ff       	call   8011e5 <sys_futex_wait>
+  803b40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b45:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803b4a:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803b4d:	8b 03                	mov    (%ebx),%eax
+  803b4f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803b52:	75 19                	jne    803b6d <devpipe_read+0x6a>
+			if (i > 0)
+  803b54:	85 f6                	test   %esi,%esi
+  803b56:	75 3a                	jne    803b92 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803b58:	89 da                	mov    %ebx,%edx
+  803b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b5d:	e8 e3 fd ff ff       	call   803945 <_pipeisclosed>
+  803b62:	85 c0                	test   %eax,%eax
+  803b64:	74 c2                	je     803b28 <devpipe_read+0x25>
+				return 0;
+  803b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6b:	eb 31                	jmp    803b9e <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b6d:	89 c1                	mov    %eax,%ecx
+  803b6f:	c1 f9 1f             	sar    $0x1f,%ecx
+  803b72:	c1 e9 1b             	shr    $0x1b,%ecx
+  803b75:	01 c8                	add    %ecx,%eax
+  803b77:	83 e0 1f             	and    $0x1f,%eax
+  803b7a:	29 c8                	sub    %ecx,%eax
+  803b7c:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803b81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803b84:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803b87:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803b8a:	83 c6 01             	add    $0x1,%esi
+  803b8d:	eb 8f                	jmp    803b1e <devpipe_read+0x1b>
+out:
+  803b8f:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803b92:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803b95:	89 da                	mov    %ebx,%edx
+  803b97:	e8 38 fd ff ff       	call   8038d4 <pipewake>
+	return i;
+  803b9c:	89 f0                	mov    %esi,%eax
+}
+  803b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba1:	5b                   	pop    %ebx
+  803ba2:	5e                   	pop    %esi
+  803ba3:	5f                   	pop    %edi
+  803ba4:	5d                   	pop    %ebp
+  803ba5:	c3                   	ret
+
+00803ba6 <pipe>:
+{
+  803ba6:	55                   	push   %ebp
+  803ba7:	89 e5                	mov    %esp,%ebp
+  803ba9:	56                   	push   %esi
+  803baa:	53                   	push   %ebx
+  803bab:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803bae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bb1:	50                   	push   %eax
+  803bb2:	e8 e3 df ff ff       	call   801b9a <fd_alloc>
+  803bb7:	89 c3                	mov    %eax,%ebx
+  803bb9:	83 c4 10             	add    $0x10,%esp
+  803bbc:	85 c0                	test   %eax,%eax
+  803bbe:	0f 88 23 01 00 00    	js     803ce7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bc4:	83 ec 04             	sub    $0x4,%esp
+  803bc7:	68 07 04 00 00       	push   $0x407
+  803bcc:	ff 75 f4             	push   -0xc(%ebp)
+  803bcf:	6a 00                	push   $0x0
+  803bd1:	e8 fa d2 ff ff       	call   800ed0 <sys_page_alloc>
+  803bd6:	89 c3                	mov    %eax,%ebx
+  803bd8:	83 c4 10             	add    $0x10,%esp
+  803bdb:	85 c0                	test   %eax,%eax
+  803bdd:	0f 88 04 01 00 00    	js     803ce7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803be3:	83 ec 0c             	sub    $0xc,%esp
+  803be6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803be9:	50                   	push   %eax
+  803bea:	e8 ab df ff ff       	call   801b9a <fd_alloc>
+  803bef:	89 c3                	mov    %eax,%ebx
+  803bf1:	83 c4 10             	add    $0x10,%esp
+  803bf4:	85 c0                	test   %eax,%eax
+  803bf6:	0f 88 db 00 00 00    	js     803cd7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bfc:	83 ec 04             	sub    $0x4,%esp
+  803bff:	68 07 04 00 00       	push   $0x407
+  803c04:	ff 75 f0             	push   -0x10(%ebp)
+  803c07:	6a 00                	push   $0x0
+  803c09:	e8 c2 d2 ff ff       	call   800ed0 <sys_page_alloc>
+  803c0e:	89 c3                	mov    %eax,%ebx
+  803c10:	83 c4 10             	add    $0x10,%esp
+  803c13:	85 c0                	test   %eax,%eax
+  803c15:	0f 88 bc 00 00 00    	js     803cd7 <pipe+0x131>
+	va = fd2data(fd0);
+  803c1b:	83 ec 0c             	sub    $0xc,%esp
+  803c1e:	ff 75 f4             	push   -0xc(%ebp)
+  803c21:	e8 5d df ff ff       	call   801b83 <fd2data>
+  803c26:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c28:	83 c4 0c             	add    $0xc,%esp
+  803c2b:	68 07 04 00 00       	push   $0x407
+  803c30:	50                   	push   %eax
+  803c31:	6a 00                	push   $0x0
+  803c33:	e8 98 d2 ff ff       	call   800ed0 <sys_page_alloc>
+  803c38:	89 c3                	mov    %eax,%ebx
+  803c3a:	83 c4 10             	add    $0x10,%esp
+  803c3d:	85 c0                	test   %eax,%eax
+  803c3f:	0f 88 82 00 00 00    	js     803cc7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c45:	83 ec 0c             	sub    $0xc,%esp
+  803c48:	ff 75 f0             	push   -0x10(%ebp)
+  803c4b:	e8 33 df ff ff       	call   801b83 <fd2data>
+  803c50:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803c57:	50                   	push   %eax
+  803c58:	6a 00                	push   $0x0
+  803c5a:	56                   	push   %esi
+  803c5b:	6a 00                	push   $0x0
+  803c5d:	e8 bb d2 ff ff       	call   800f1d <sys_page_map>
+  803c62:	89 c3                	mov    %eax,%ebx
+  803c64:	83 c4 20             	add    $0x20,%esp
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	78 4e                	js     803cb9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803c6b:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803c70:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c73:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803c75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c78:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803c7f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803c82:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803c84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803c87:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803c8e:	83 ec 0c             	sub    $0xc,%esp
+  803c91:	ff 75 f4             	push   -0xc(%ebp)
+  803c94:	e8 da de ff ff       	call   801b73 <fd2num>
+  803c99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c9c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803c9e:	83 c4 04             	add    $0x4,%esp
+  803ca1:	ff 75 f0             	push   -0x10(%ebp)
+  803ca4:	e8 ca de ff ff       	call   801b73 <fd2num>
+  803ca9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803cac:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803caf:	83 c4 10             	add    $0x10,%esp
+  803cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cb7:	eb 2e                	jmp    803ce7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803cb9:	83 ec 08             	sub    $0x8,%esp
+  803cbc:	56                   	push   %esi
+  803cbd:	6a 00                	push   $0x0
+  803cbf:	e8 a5 d2 ff ff       	call   800f69 <sys_page_unmap>
+  803cc4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803cc7:	83 ec 08             	sub    $0x8,%esp
+  803cca:	ff 75 f0             	push   -0x10(%ebp)
+  803ccd:	6a 00                	push   $0x0
+  803ccf:	e8 95 d2 ff ff       	call   800f69 <sys_page_unmap>
+  803cd4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803cd7:	83 ec 08             	sub    $0x8,%esp
+  803cda:	ff 75 f4             	push   -0xc(%ebp)
+  803cdd:	6a 00                	push   $0x0
+  803cdf:	e8 85 d2 ff ff       	call   800f69 <sys_page_unmap>
+  803ce4:	83 c4 10             	add    $0x10,%esp
+}
+  803ce7:	89 d8                	mov    %ebx,%eax
+  803ce9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cec:	5b                   	pop    %ebx
+  803ced:	5e                   	pop    %esi
+  803cee:	5d                   	pop    %ebp
+  803cef:	c3                   	ret
+
+00803cf0 <pipeisclosed>:
+{
+  803cf0:	55                   	push   %ebp
+  803cf1:	89 e5                	mov    %esp,%ebp
+  803cf3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803cf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cf9:	50                   	push   %eax
+  803cfa:	ff 75 08             	push   0x8(%ebp)
+  803cfd:	e8 ee de ff ff       	call   801bf0 <fd_lookup>
+  803d02:	83 c4 10             	add    $0x10,%esp
+  803d05:	85 c0                	test   %eax,%eax
+  803d07:	78 18                	js     803d21 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d09:	83 ec 0c             	sub    $0xc,%esp
+  803d0c:	ff 75 f4             	push   -0xc(%ebp)
+  803d0f:	e8 6f de ff ff       	call   801b83 <fd2data>
+  803d14:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d19:	e8 27 fc ff ff       	call   803945 <_pipeisclosed>
+  803d1e:	83 c4 10             	add    $0x10,%esp
+}
+  803d21:	c9                   	leave
+  803d22:	c3                   	ret
+
+00803d23 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803d23:	55                   	push   %ebp
+  803d24:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d29:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d2f:	5d                   	pop    %ebp
+  803d30:	c3                   	ret
+
+00803d31 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803d31:	55                   	push   %ebp
+  803d32:	89 e5                	mov    %esp,%ebp
+  803d34:	56                   	push   %esi
+  803d35:	53                   	push   %ebx
+  803d36:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d3e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803d43:	89 d0                	mov    %edx,%eax
+  803d45:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803d49:	85 c0                	test   %eax,%eax
+  803d4b:	74 2d                	je     803d7a <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803d4d:	83 f8 02             	cmp    $0x2,%eax
+  803d50:	74 08                	je     803d5a <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803d52:	b8 02 00 00 00       	mov    $0x2,%eax
+  803d57:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d5a:	be 02 00 00 00       	mov    $0x2,%esi
+  803d5f:	eb 15                	jmp    803d76 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803d61:	83 ec 04             	sub    $0x4,%esp
+  803d64:	6a 00                	push   $0x0
+  803d66:	6a 02                	push   $0x2
+  803d68:	53                   	push   %ebx
+  803d69:	e8 77 d4 ff ff       	call   8011e5 <sys_futex_wait>
+  803d6e:	89 f0                	mov    %esi,%eax
+  803d70:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d73:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803d76:	85 c0                	test   %eax,%eax
+  803d78:	75 e7                	jne    803d61 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d7d:	5b                   	pop    %ebx
+  803d7e:	5e                   	pop    %esi
+  803d7f:	5d                   	pop    %ebp
+  803d80:	c3                   	ret
+
+00803d81 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803d81:	55                   	push   %ebp
+  803d82:	89 e5                	mov    %esp,%ebp
+  803d84:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803d91:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803d95:	f7 d8                	neg    %eax
+  803d97:	19 c0                	sbb    %eax,%eax
+  803d99:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803d9c:	5d                   	pop    %ebp
+  803d9d:	c3                   	ret
+
+00803d9e <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803d9e:	55                   	push   %ebp
+  803d9f:	89 e5                	mov    %esp,%ebp
+  803da1:	83 ec 08             	sub    $0x8,%esp
+  803da4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dac:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803daf:	83 f8 02             	cmp    $0x2,%eax
+  803db2:	74 02                	je     803db6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803db4:	c9                   	leave
+  803db5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803db6:	83 ec 08             	sub    $0x8,%esp
+  803db9:	6a 01                	push   $0x1
+  803dbb:	52                   	push   %edx
+  803dbc:	e8 53 d4 ff ff       	call   801214 <sys_futex_wake>
+  803dc1:	83 c4 10             	add    $0x10,%esp
+}
+  803dc4:	eb ee                	jmp    803db4 <mutex_unlock+0x16>
+
+00803dc6 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803dc6:	55                   	push   %ebp
+  803dc7:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dcc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803dd2:	5d                   	pop    %ebp
+  803dd3:	c3                   	ret
+
+00803dd4 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803dd4:	55                   	push   %ebp
+  803dd5:	89 e5                	mov    %esp,%ebp
+  803dd7:	57                   	push   %edi
+  803dd8:	56                   	push   %esi
+  803dd9:	53                   	push   %ebx
+  803dda:	83 ec 18             	sub    $0x18,%esp
+  803ddd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803de0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803de3:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803de5:	53                   	push   %ebx
+  803de6:	e8 b3 ff ff ff       	call   803d9e <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803deb:	83 c4 0c             	add    $0xc,%esp
+  803dee:	ff 75 10             	push   0x10(%ebp)
+  803df1:	57                   	push   %edi
+  803df2:	56                   	push   %esi
+  803df3:	e8 ed d3 ff ff       	call   8011e5 <sys_futex_wait>
+  803df8:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803dfa:	83 c4 10             	add    $0x10,%esp
+  803dfd:	be 02 00 00 00       	mov    $0x2,%esi
+  803e02:	eb 10                	jmp    803e14 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803e04:	83 ec 04             	sub    $0x4,%esp
+  803e07:	6a 00                	push   $0x0
+  803e09:	6a 02                	push   $0x2
+  803e0b:	53                   	push   %ebx
+  803e0c:	e8 d4 d3 ff ff       	call   8011e5 <sys_futex_wait>
+  803e11:	83 c4 10             	add    $0x10,%esp
+  803e14:	89 f0                	mov    %esi,%eax
+  803e16:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803e19:	85 c0                	test   %eax,%eax
+  803e1b:	75 e7                	jne    803e04 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803e1d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803e20:	74 05                	je     803e27 <cond_timedwait+0x53>
+  803e22:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803e27:	89 f8                	mov    %edi,%eax
+  803e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e2c:	5b                   	pop    %ebx
+  803e2d:	5e                   	pop    %esi
+  803e2e:	5f                   	pop    %edi
+  803e2f:	5d                   	pop    %ebp
+  803e30:	c3                   	ret
+
+00803e31 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803e31:	55                   	push   %ebp
+  803e32:	89 e5                	mov    %esp,%ebp
+  803e34:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803e37:	6a 00                	push   $0x0
+  803e39:	ff 75 0c             	push   0xc(%ebp)
+  803e3c:	ff 75 08             	push   0x8(%ebp)
+  803e3f:	e8 90 ff ff ff       	call   803dd4 <cond_timedwait>
+}
+  803e44:	83 c4 10             	add    $0x10,%esp
+  803e47:	c9                   	leave
+  803e48:	c3                   	ret
+
+00803e49 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803e49:	55                   	push   %ebp
+  803e4a:	89 e5                	mov    %esp,%ebp
+  803e4c:	83 ec 10             	sub    $0x10,%esp
+  803e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803e52:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e57:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803e5b:	6a 01                	push   $0x1
+  803e5d:	50                   	push   %eax
+  803e5e:	e8 b1 d3 ff ff       	call   801214 <sys_futex_wake>
+}
+  803e63:	83 c4 10             	add    $0x10,%esp
+  803e66:	c9                   	leave
+  803e67:	c3                   	ret
+
+00803e68 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803e68:	55                   	push   %ebp
+  803e69:	89 e5                	mov    %esp,%ebp
+  803e6b:	83 ec 10             	sub    $0x10,%esp
+  803e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e71:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e76:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803e7a:	68 00 04 00 00       	push   $0x400
+  803e7f:	50                   	push   %eax
+  803e80:	e8 8f d3 ff ff       	call   801214 <sys_futex_wake>
+}
+  803e85:	83 c4 10             	add    $0x10,%esp
+  803e88:	c9                   	leave
+  803e89:	c3                   	ret
+
+00803e8a <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803e8a:	55                   	push   %ebp
+  803e8b:	89 e5                	mov    %esp,%ebp
+  803e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803e90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e93:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803e95:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803e9c:	5d                   	pop    %ebp
+  803e9d:	c3                   	ret
+
+00803e9e <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803e9e:	55                   	push   %ebp
+  803e9f:	89 e5                	mov    %esp,%ebp
+  803ea1:	53                   	push   %ebx
+  803ea2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803ea5:	8b 11                	mov    (%ecx),%edx
+  803ea7:	85 d2                	test   %edx,%edx
+  803ea9:	74 14                	je     803ebf <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803eab:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803eae:	89 d0                	mov    %edx,%eax
+  803eb0:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803eb4:	39 c2                	cmp    %eax,%edx
+  803eb6:	75 ed                	jne    803ea5 <sem_trywait+0x7>
+			return 0;
+  803eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebd:	eb 05                	jmp    803ec4 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803ebf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803ec4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ec7:	c9                   	leave
+  803ec8:	c3                   	ret
+
+00803ec9 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803ec9:	55                   	push   %ebp
+  803eca:	89 e5                	mov    %esp,%ebp
+  803ecc:	57                   	push   %edi
+  803ecd:	56                   	push   %esi
+  803ece:	53                   	push   %ebx
+  803ecf:	83 ec 1c             	sub    $0x1c,%esp
+  803ed2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ed5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803ed8:	e8 80 d2 ff ff       	call   80115d <sys_time_msec>
+  803edd:	01 f8                	add    %edi,%eax
+  803edf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803ee2:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803ee7:	eb 28                	jmp    803f11 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  803eee:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803ef3:	83 ec 04             	sub    $0x4,%esp
+  803ef6:	56                   	push   %esi
+  803ef7:	6a 00                	push   $0x0
+  803ef9:	53                   	push   %ebx
+  803efa:	e8 e6 d2 ff ff       	call   8011e5 <sys_futex_wait>
+  803eff:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803f04:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803f09:	83 c4 10             	add    $0x10,%esp
+  803f0c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803f0f:	74 2e                	je     803f3f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803f11:	83 ec 0c             	sub    $0xc,%esp
+  803f14:	53                   	push   %ebx
+  803f15:	e8 84 ff ff ff       	call   803e9e <sem_trywait>
+  803f1a:	83 c4 10             	add    $0x10,%esp
+  803f1d:	85 c0                	test   %eax,%eax
+  803f1f:	79 19                	jns    803f3a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803f21:	85 ff                	test   %edi,%edi
+  803f23:	74 c4                	je     803ee9 <sem_timedwait+0x20>
+  803f25:	e8 33 d2 ff ff       	call   80115d <sys_time_msec>
+  803f2a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803f2d:	29 c6                	sub    %eax,%esi
+  803f2f:	85 f6                	test   %esi,%esi
+  803f31:	7f b6                	jg     803ee9 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803f33:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803f38:	eb 05                	jmp    803f3f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f42:	5b                   	pop    %ebx
+  803f43:	5e                   	pop    %esi
+  803f44:	5f                   	pop    %edi
+  803f45:	5d                   	pop    %ebp
+  803f46:	c3                   	ret
+
+00803f47 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803f47:	55                   	push   %ebp
+  803f48:	89 e5                	mov    %esp,%ebp
+  803f4a:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803f4d:	6a 00                	push   $0x0
+  803f4f:	ff 75 08             	push   0x8(%ebp)
+  803f52:	e8 72 ff ff ff       	call   803ec9 <sem_timedwait>
+}
+  803f57:	83 c4 10             	add    $0x10,%esp
+  803f5a:	c9                   	leave
+  803f5b:	c3                   	ret
+
+00803f5c <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803f5c:	55                   	push   %ebp
+  803f5d:	89 e5                	mov    %esp,%ebp
+  803f5f:	83 ec 08             	sub    $0x8,%esp
+  803f62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f65:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f6a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803f6e:	8b 50 04             	mov    0x4(%eax),%edx
+  803f71:	85 d2                	test   %edx,%edx
+  803f73:	75 02                	jne    803f77 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803f75:	c9                   	leave
+  803f76:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803f77:	83 ec 08             	sub    $0x8,%esp
+  803f7a:	6a 01                	push   $0x1
+  803f7c:	50                   	push   %eax
+  803f7d:	e8 92 d2 ff ff       	call   801214 <sys_futex_wake>
+  803f82:	83 c4 10             	add    $0x10,%esp
+}
+  803f85:	eb ee                	jmp    803f75 <sem_post+0x19>
+
+00803f87 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803f87:	55                   	push   %ebp
+  803f88:	89 e5                	mov    %esp,%ebp
+  803f8a:	57                   	push   %edi
+  803f8b:	56                   	push   %esi
+  803f8c:	53                   	push   %ebx
+  803f8d:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803f90:	68 20 70 80 00       	push   $0x807020
+  803f95:	e8 97 fd ff ff       	call   803d31 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803f9a:	a1 44 70 80 00       	mov    0x807044,%eax
+  803f9f:	83 c4 10             	add    $0x10,%esp
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	75 19                	jne    803fbf <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803fa6:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803fab:	8b 00                	mov    (%eax),%eax
+  803fad:	8b 40 48             	mov    0x48(%eax),%eax
+  803fb0:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803fb5:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803fbc:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803fbf:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803fc4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fc7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fce:	8b 40 04             	mov    0x4(%eax),%eax
+  803fd1:	85 c0                	test   %eax,%eax
+  803fd3:	0f 84 e4 00 00 00    	je     8040bd <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803fd9:	83 c3 01             	add    $0x1,%ebx
+  803fdc:	83 fb 20             	cmp    $0x20,%ebx
+  803fdf:	75 e3                	jne    803fc4 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803fe1:	83 ec 0c             	sub    $0xc,%esp
+  803fe4:	68 20 70 80 00       	push   $0x807020
+  803fe9:	e8 b0 fd ff ff       	call   803d9e <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803fee:	83 c4 10             	add    $0x10,%esp
+  803ff1:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803ff6:	e9 b8 00 00 00       	jmp    8040b3 <pthread_create+0x12c>
+  803ffb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803ffe:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  804001:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  804003:	39 f3                	cmp    %esi,%ebx
+  804005:	73 16                	jae    80401d <pthread_create+0x96>
+		va -= PGSIZE;
+  804007:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80400d:	83 ec 08             	sub    $0x8,%esp
+  804010:	56                   	push   %esi
+  804011:	6a 00                	push   $0x0
+  804013:	e8 51 cf ff ff       	call   800f69 <sys_page_unmap>
+  804018:	83 c4 10             	add    $0x10,%esp
+  80401b:	eb e6                	jmp    804003 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80401d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804020:	83 ec 08             	sub    $0x8,%esp
+  804023:	ff 75 e4             	push   -0x1c(%ebp)
+  804026:	6a 00                	push   $0x0
+  804028:	e8 3c cf ff ff       	call   800f69 <sys_page_unmap>
+	return r;
+  80402d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  804030:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804033:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80403a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  804041:	eb 70                	jmp    8040b3 <pthread_create+0x12c>
+	th->th_fn = fn;
+  804043:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804046:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80404d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804050:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  804053:	8b 55 10             	mov    0x10(%ebp),%edx
+  804056:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  804059:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  804060:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  804065:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804068:	29 c8                	sub    %ecx,%eax
+  80406a:	85 db                	test   %ebx,%ebx
+  80406c:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  804073:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  804076:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80407d:	83 ec 04             	sub    $0x4,%esp
+  804080:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804085:	29 ca                	sub    %ecx,%edx
+  804087:	52                   	push   %edx
+	*--esp = 0;
+  804088:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80408b:	50                   	push   %eax
+  80408c:	68 e4 42 80 00       	push   $0x8042e4
+  804091:	e8 23 d2 ff ff       	call   8012b9 <sys_thread_create>
+  804096:	89 c7                	mov    %eax,%edi
+  804098:	83 c4 10             	add    $0x10,%esp
+  80409b:	85 c0                	test   %eax,%eax
+  80409d:	78 91                	js     804030 <pthread_create+0xa9>
+	th->th_env = id;
+  80409f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040a2:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8040a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040ac:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8040ae:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8040b3:	89 f8                	mov    %edi,%eax
+  8040b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040b8:	5b                   	pop    %ebx
+  8040b9:	5e                   	pop    %esi
+  8040ba:	5f                   	pop    %edi
+  8040bb:	5d                   	pop    %ebp
+  8040bc:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8040bd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040c0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8040c7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8040ce:	83 ec 0c             	sub    $0xc,%esp
+  8040d1:	68 20 70 80 00       	push   $0x807020
+  8040d6:	e8 c3 fc ff ff       	call   803d9e <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8040db:	89 d9                	mov    %ebx,%ecx
+  8040dd:	c1 e1 10             	shl    $0x10,%ecx
+  8040e0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8040e3:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8040e8:	29 c8                	sub    %ecx,%eax
+  8040ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8040ed:	c1 e8 16             	shr    $0x16,%eax
+  8040f0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8040f7:	83 c4 10             	add    $0x10,%esp
+  8040fa:	a8 01                	test   $0x1,%al
+  8040fc:	74 15                	je     804113 <pthread_create+0x18c>
+  8040fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804101:	c1 e8 0c             	shr    $0xc,%eax
+  804104:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80410b:	a8 01                	test   $0x1,%al
+  80410d:	0f 85 30 ff ff ff    	jne    804043 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804113:	83 ec 04             	sub    $0x4,%esp
+  804116:	6a 07                	push   $0x7
+  804118:	ff 75 e4             	push   -0x1c(%ebp)
+  80411b:	6a 00                	push   $0x0
+  80411d:	e8 ae cd ff ff       	call   800ed0 <sys_page_alloc>
+  804122:	89 c7                	mov    %eax,%edi
+  804124:	83 c4 10             	add    $0x10,%esp
+  804127:	85 c0                	test   %eax,%eax
+  804129:	0f 88 01 ff ff ff    	js     804030 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80412f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  804134:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804137:	29 d0                	sub    %edx,%eax
+  804139:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80413c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80413e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  804143:	29 d0                	sub    %edx,%eax
+  804145:	89 c7                	mov    %eax,%edi
+  804147:	39 fe                	cmp    %edi,%esi
+  804149:	0f 83 f4 fe ff ff    	jae    804043 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80414f:	83 ec 04             	sub    $0x4,%esp
+  804152:	6a 07                	push   $0x7
+  804154:	56                   	push   %esi
+  804155:	6a 00                	push   $0x0
+  804157:	e8 74 cd ff ff       	call   800ed0 <sys_page_alloc>
+  80415c:	83 c4 10             	add    $0x10,%esp
+  80415f:	85 c0                	test   %eax,%eax
+  804161:	0f 88 94 fe ff ff    	js     803ffb <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804167:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80416d:	eb d8                	jmp    804147 <pthread_create+0x1c0>
+
+0080416f <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80416f:	55                   	push   %ebp
+  804170:	89 e5                	mov    %esp,%ebp
+  804172:	57                   	push   %edi
+  804173:	56                   	push   %esi
+  804174:	53                   	push   %ebx
+  804175:	83 ec 0c             	sub    $0xc,%esp
+  804178:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80417b:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80417e:	83 f8 1e             	cmp    $0x1e,%eax
+  804181:	0f 87 c7 00 00 00    	ja     80424e <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804187:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804189:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80418f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804194:	77 12                	ja     8041a8 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804196:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80419b:	29 d0                	sub    %edx,%eax
+  80419d:	c1 e8 10             	shr    $0x10,%eax
+  8041a0:	39 c3                	cmp    %eax,%ebx
+  8041a2:	0f 84 ad 00 00 00    	je     804255 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8041a8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041ab:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8041b2:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8041b9:	eb 10                	jmp    8041cb <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8041bb:	83 ec 04             	sub    $0x4,%esp
+  8041be:	6a 00                	push   $0x0
+  8041c0:	6a 01                	push   $0x1
+  8041c2:	57                   	push   %edi
+  8041c3:	e8 1d d0 ff ff       	call   8011e5 <sys_futex_wait>
+  8041c8:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8041cb:	8b 46 04             	mov    0x4(%esi),%eax
+  8041ce:	83 f8 01             	cmp    $0x1,%eax
+  8041d1:	74 e8                	je     8041bb <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8041d3:	83 f8 02             	cmp    $0x2,%eax
+  8041d6:	0f 85 80 00 00 00    	jne    80425c <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8041dc:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8041df:	c1 e6 02             	shl    $0x2,%esi
+  8041e2:	eb 05                	jmp    8041e9 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8041e4:	e8 bb cc ff ff       	call   800ea4 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8041e9:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8041ef:	89 ca                	mov    %ecx,%edx
+  8041f1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8041f7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8041fa:	c1 e0 04             	shl    $0x4,%eax
+  8041fd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804202:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  804205:	39 c1                	cmp    %eax,%ecx
+  804207:	75 12                	jne    80421b <pthread_join+0xac>
+  804209:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80420c:	c1 e0 04             	shl    $0x4,%eax
+  80420f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804214:	8b 40 54             	mov    0x54(%eax),%eax
+  804217:	85 c0                	test   %eax,%eax
+  804219:	75 c9                	jne    8041e4 <pthread_join+0x75>
+	if (ret_store)
+  80421b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80421f:	74 0f                	je     804230 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804221:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804224:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80422b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80422e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804230:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804233:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80423a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804241:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804249:	5b                   	pop    %ebx
+  80424a:	5e                   	pop    %esi
+  80424b:	5f                   	pop    %edi
+  80424c:	5d                   	pop    %ebp
+  80424d:	c3                   	ret
+		return -E_INVAL;
+  80424e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804253:	eb f1                	jmp    804246 <pthread_join+0xd7>
+  804255:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80425a:	eb ea                	jmp    804246 <pthread_join+0xd7>
+		return -E_INVAL;
+  80425c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804261:	eb e3                	jmp    804246 <pthread_join+0xd7>
+
+00804263 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804263:	55                   	push   %ebp
+  804264:	89 e5                	mov    %esp,%ebp
+  804266:	53                   	push   %ebx
+  804267:	83 ec 04             	sub    $0x4,%esp
+  80426a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80426c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804272:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804277:	77 0c                	ja     804285 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804279:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80427e:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804280:	c1 e8 10             	shr    $0x10,%eax
+  804283:	75 0a                	jne    80428f <pthread_exit+0x2c>
+		exit();
+  804285:	e8 21 c1 ff ff       	call   8003ab <exit>
+  80428a:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80428f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804296:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804299:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8042a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8042a3:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8042a6:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8042ad:	83 ec 08             	sub    $0x8,%esp
+  8042b0:	6a 20                	push   $0x20
+  8042b2:	01 c2                	add    %eax,%edx
+  8042b4:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8042bb:	50                   	push   %eax
+  8042bc:	e8 53 cf ff ff       	call   801214 <sys_futex_wake>
+	sys_env_destroy(0);
+  8042c1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8042c8:	e8 60 cb ff ff       	call   800e2d <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8042cd:	83 c4 0c             	add    $0xc,%esp
+  8042d0:	68 32 52 80 00       	push   $0x805232
+  8042d5:	68 a5 00 00 00       	push   $0xa5
+  8042da:	68 4c 52 80 00       	push   $0x80524c
+  8042df:	e8 ef c0 ff ff       	call   8003d3 <_panic>
+
+008042e4 <pthread_start>:
+{
+  8042e4:	55                   	push   %ebp
+  8042e5:	89 e5                	mov    %esp,%ebp
+  8042e7:	53                   	push   %ebx
+  8042e8:	83 ec 04             	sub    $0x4,%esp
+  8042eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8042ee:	e8 85 cb ff ff       	call   800e78 <sys_getenvid>
+  8042f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8042f8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8042fe:	85 db                	test   %ebx,%ebx
+  804300:	74 0c                	je     80430e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804302:	89 d9                	mov    %ebx,%ecx
+  804304:	c1 e1 10             	shl    $0x10,%ecx
+  804307:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80430c:	29 ca                	sub    %ecx,%edx
+  80430e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804311:	c1 e0 04             	shl    $0x4,%eax
+  804314:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804319:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80431b:	83 ec 0c             	sub    $0xc,%esp
+  80431e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804325:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804328:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  80432f:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804336:	89 04 24             	mov    %eax,(%esp)
+  804339:	e8 25 ff ff ff       	call   804263 <pthread_exit>
+
+0080433e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80433e:	55                   	push   %ebp
+  80433f:	89 e5                	mov    %esp,%ebp
+  804341:	57                   	push   %edi
+  804342:	56                   	push   %esi
+  804343:	53                   	push   %ebx
+  804344:	83 ec 1c             	sub    $0x1c,%esp
+  804347:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804349:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80434f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804356:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80435b:	77 0d                	ja     80436a <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80435d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804362:	29 d0                	sub    %edx,%eax
+  804364:	c1 e8 10             	shr    $0x10,%eax
+  804367:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80436a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80436f:	eb 2f                	jmp    8043a0 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804371:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804377:	8b 01                	mov    (%ecx),%eax
+  804379:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80437c:	39 c2                	cmp    %eax,%edx
+  80437e:	75 14                	jne    804394 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804380:	83 ec 0c             	sub    $0xc,%esp
+  804383:	57                   	push   %edi
+  804384:	e8 a4 ca ff ff       	call   800e2d <sys_env_destroy>
+  804389:	83 c4 10             	add    $0x10,%esp
+  80438c:	85 c0                	test   %eax,%eax
+  80438e:	0f 88 97 00 00 00    	js     80442b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804394:	83 c3 01             	add    $0x1,%ebx
+  804397:	83 fb 20             	cmp    $0x20,%ebx
+  80439a:	0f 84 d2 00 00 00    	je     804472 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8043a0:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8043a3:	74 ef                	je     804394 <pthread_kill_others+0x56>
+  8043a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8043a8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8043af:	8b 40 04             	mov    0x4(%eax),%eax
+  8043b2:	83 f8 01             	cmp    $0x1,%eax
+  8043b5:	75 dd                	jne    804394 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8043b7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8043ba:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8043c1:	89 fe                	mov    %edi,%esi
+  8043c3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8043c9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8043cc:	c1 e0 04             	shl    $0x4,%eax
+  8043cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043d4:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8043d7:	39 c7                	cmp    %eax,%edi
+  8043d9:	75 b9                	jne    804394 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8043db:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8043de:	c1 e0 04             	shl    $0x4,%eax
+  8043e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043e6:	8b 40 54             	mov    0x54(%eax),%eax
+  8043e9:	85 c0                	test   %eax,%eax
+  8043eb:	74 a7                	je     804394 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8043ed:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8043f0:	c1 e0 04             	shl    $0x4,%eax
+  8043f3:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8043f9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043fb:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804401:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804406:	0f 87 65 ff ff ff    	ja     804371 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80440c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804411:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804413:	c1 e8 10             	shr    $0x10,%eax
+  804416:	0f 84 55 ff ff ff    	je     804371 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80441c:	c1 e0 10             	shl    $0x10,%eax
+  80441f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804424:	29 c1                	sub    %eax,%ecx
+  804426:	e9 4c ff ff ff       	jmp    804377 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80442b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80442e:	c1 e2 04             	shl    $0x4,%edx
+  804431:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804437:	8b 52 48             	mov    0x48(%edx),%edx
+  80443a:	39 fa                	cmp    %edi,%edx
+  80443c:	0f 85 52 ff ff ff    	jne    804394 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804442:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804445:	c1 e2 04             	shl    $0x4,%edx
+  804448:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80444e:	8b 52 54             	mov    0x54(%edx),%edx
+  804451:	85 d2                	test   %edx,%edx
+  804453:	0f 84 3b ff ff ff    	je     804394 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804459:	83 ec 0c             	sub    $0xc,%esp
+  80445c:	50                   	push   %eax
+  80445d:	57                   	push   %edi
+  80445e:	68 5c 52 80 00       	push   $0x80525c
+  804463:	68 bb 00 00 00       	push   $0xbb
+  804468:	68 4c 52 80 00       	push   $0x80524c
+  80446d:	e8 61 bf ff ff       	call   8003d3 <_panic>
+	}
+}
+  804472:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804475:	5b                   	pop    %ebx
+  804476:	5e                   	pop    %esi
+  804477:	5f                   	pop    %edi
+  804478:	5d                   	pop    %ebp
+  804479:	c3                   	ret
+
+0080447a <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80447a:	55                   	push   %ebp
+  80447b:	89 e5                	mov    %esp,%ebp
+  80447d:	53                   	push   %ebx
+  80447e:	83 ec 04             	sub    $0x4,%esp
+  804481:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804483:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804489:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80448f:	0f 87 85 00 00 00    	ja     80451a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804495:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80449a:	29 c3                	sub    %eax,%ebx
+  80449c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80449f:	83 ec 04             	sub    $0x4,%esp
+  8044a2:	68 80 02 00 00       	push   $0x280
+  8044a7:	6a 00                	push   $0x0
+  8044a9:	68 40 70 80 00       	push   $0x807040
+  8044ae:	e8 30 c7 ff ff       	call   800be3 <memset>
+	threads_mu.m_state = 0;
+  8044b3:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8044ba:	00 00 00 
+	if (self != 0) {
+  8044bd:	83 c4 10             	add    $0x10,%esp
+  8044c0:	85 db                	test   %ebx,%ebx
+  8044c2:	74 51                	je     804515 <pthread_fork_child+0x9b>
+  8044c4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044c6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044cc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044d1:	77 18                	ja     8044eb <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044d3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044d8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044da:	c1 e8 10             	shr    $0x10,%eax
+  8044dd:	74 0c                	je     8044eb <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044df:	c1 e0 10             	shl    $0x10,%eax
+  8044e2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044e7:	29 c2                	sub    %eax,%edx
+  8044e9:	eb 06                	jmp    8044f1 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8044eb:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8044f1:	8b 02                	mov    (%edx),%eax
+  8044f3:	8b 48 48             	mov    0x48(%eax),%ecx
+  8044f6:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8044fd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804500:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804507:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  80450e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804518:	c9                   	leave
+  804519:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80451a:	83 ec 04             	sub    $0x4,%esp
+  80451d:	68 80 02 00 00       	push   $0x280
+  804522:	6a 00                	push   $0x0
+  804524:	68 40 70 80 00       	push   $0x807040
+  804529:	e8 b5 c6 ff ff       	call   800be3 <memset>
+	threads_mu.m_state = 0;
+  80452e:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804535:	00 00 00 
+  804538:	83 c4 10             	add    $0x10,%esp
+  80453b:	eb d8                	jmp    804515 <pthread_fork_child+0x9b>
+
+0080453d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80453d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804542:	c3                   	ret
+
+00804543 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804543:	55                   	push   %ebp
+  804544:	89 e5                	mov    %esp,%ebp
+  804546:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804549:	68 81 52 80 00       	push   $0x805281
+  80454e:	ff 75 0c             	push   0xc(%ebp)
+  804551:	e8 3c c5 ff ff       	call   800a92 <strcpy>
+	return 0;
+}
+  804556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455b:	c9                   	leave
+  80455c:	c3                   	ret
+
+0080455d <devcons_write>:
+{
+  80455d:	55                   	push   %ebp
+  80455e:	89 e5                	mov    %esp,%ebp
+  804560:	57                   	push   %edi
+  804561:	56                   	push   %esi
+  804562:	53                   	push   %ebx
+  804563:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804569:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80456e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804574:	eb 2e                	jmp    8045a4 <devcons_write+0x47>
+		m = n - tot;
+  804576:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804579:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80457b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804580:	39 c3                	cmp    %eax,%ebx
+  804582:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804585:	83 ec 04             	sub    $0x4,%esp
+  804588:	53                   	push   %ebx
+  804589:	89 f0                	mov    %esi,%eax
+  80458b:	03 45 0c             	add    0xc(%ebp),%eax
+  80458e:	50                   	push   %eax
+  80458f:	57                   	push   %edi
+  804590:	e8 83 c6 ff ff       	call   800c18 <memmove>
+		sys_cputs(buf, m);
+  804595:	83 c4 08             	add    $0x8,%esp
+  804598:	53                   	push   %ebx
+  804599:	57                   	push   %edi
+  80459a:	e8 37 c8 ff ff       	call   800dd6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80459f:	01 de                	add    %ebx,%esi
+  8045a1:	83 c4 10             	add    $0x10,%esp
+  8045a4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8045a7:	72 cd                	jb     804576 <devcons_write+0x19>
+}
+  8045a9:	89 f0                	mov    %esi,%eax
+  8045ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ae:	5b                   	pop    %ebx
+  8045af:	5e                   	pop    %esi
+  8045b0:	5f                   	pop    %edi
+  8045b1:	5d                   	pop    %ebp
+  8045b2:	c3                   	ret
+
+008045b3 <devcons_read>:
+{
+  8045b3:	55                   	push   %ebp
+  8045b4:	89 e5                	mov    %esp,%ebp
+  8045b6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8045b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045be:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8045c2:	75 07                	jne    8045cb <devcons_read+0x18>
+  8045c4:	eb 1f                	jmp    8045e5 <devcons_read+0x32>
+		sys_yield();
+  8045c6:	e8 d9 c8 ff ff       	call   800ea4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8045cb:	e8 31 c8 ff ff       	call   800e01 <sys_cgetc>
+  8045d0:	85 c0                	test   %eax,%eax
+  8045d2:	74 f2                	je     8045c6 <devcons_read+0x13>
+	if (c < 0)
+  8045d4:	78 0f                	js     8045e5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8045d6:	83 f8 04             	cmp    $0x4,%eax
+  8045d9:	74 0c                	je     8045e7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8045db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8045de:	88 02                	mov    %al,(%edx)
+	return 1;
+  8045e0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8045e5:	c9                   	leave
+  8045e6:	c3                   	ret
+		return 0;
+  8045e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ec:	eb f7                	jmp    8045e5 <devcons_read+0x32>
+
+008045ee <cputchar>:
+{
+  8045ee:	55                   	push   %ebp
+  8045ef:	89 e5                	mov    %esp,%ebp
+  8045f1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8045f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045f7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8045fa:	6a 01                	push   $0x1
+  8045fc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8045ff:	50                   	push   %eax
+  804600:	e8 d1 c7 ff ff       	call   800dd6 <sys_cputs>
+}
+  804605:	83 c4 10             	add    $0x10,%esp
+  804608:	c9                   	leave
+  804609:	c3                   	ret
+
+0080460a <getchar>:
+{
+  80460a:	55                   	push   %ebp
+  80460b:	89 e5                	mov    %esp,%ebp
+  80460d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804610:	6a 01                	push   $0x1
+  804612:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804615:	50                   	push   %eax
+  804616:	6a 00                	push   $0x0
+  804618:	e8 63 d8 ff ff       	call   801e80 <read>
+	if (r < 0)
+  80461d:	83 c4 10             	add    $0x10,%esp
+  804620:	85 c0                	test   %eax,%eax
+  804622:	78 06                	js     80462a <getchar+0x20>
+	if (r < 1)
+  804624:	74 06                	je     80462c <getchar+0x22>
+	return c;
+  804626:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80462a:	c9                   	leave
+  80462b:	c3                   	ret
+		return -E_EOF;
+  80462c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804631:	eb f7                	jmp    80462a <getchar+0x20>
+
+00804633 <iscons>:
+{
+  804633:	55                   	push   %ebp
+  804634:	89 e5                	mov    %esp,%ebp
+  804636:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804639:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80463c:	50                   	push   %eax
+  80463d:	ff 75 08             	push   0x8(%ebp)
+  804640:	e8 ab d5 ff ff       	call   801bf0 <fd_lookup>
+  804645:	83 c4 10             	add    $0x10,%esp
+  804648:	85 c0                	test   %eax,%eax
+  80464a:	78 11                	js     80465d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80464c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80464f:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804655:	39 10                	cmp    %edx,(%eax)
+  804657:	0f 94 c0             	sete   %al
+  80465a:	0f b6 c0             	movzbl %al,%eax
+}
+  80465d:	c9                   	leave
+  80465e:	c3                   	ret
+
+0080465f <opencons>:
+{
+  80465f:	55                   	push   %ebp
+  804660:	89 e5                	mov    %esp,%ebp
+  804662:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804665:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804668:	50                   	push   %eax
+  804669:	e8 2c d5 ff ff       	call   801b9a <fd_alloc>
+  80466e:	83 c4 10             	add    $0x10,%esp
+  804671:	85 c0                	test   %eax,%eax
+  804673:	78 3a                	js     8046af <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804675:	83 ec 04             	sub    $0x4,%esp
+  804678:	68 07 04 00 00       	push   $0x407
+  80467d:	ff 75 f4             	push   -0xc(%ebp)
+  804680:	6a 00                	push   $0x0
+  804682:	e8 49 c8 ff ff       	call   800ed0 <sys_page_alloc>
+  804687:	83 c4 10             	add    $0x10,%esp
+  80468a:	85 c0                	test   %eax,%eax
+  80468c:	78 21                	js     8046af <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80468e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804691:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804697:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804699:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80469c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8046a3:	83 ec 0c             	sub    $0xc,%esp
+  8046a6:	50                   	push   %eax
+  8046a7:	e8 c7 d4 ff ff       	call   801b73 <fd2num>
+  8046ac:	83 c4 10             	add    $0x10,%esp
+}
+  8046af:	c9                   	leave
+  8046b0:	c3                   	ret
+
+008046b1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8046b1:	55                   	push   %ebp
+  8046b2:	89 e5                	mov    %esp,%ebp
+  8046b4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8046b7:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8046be:	74 0a                	je     8046ca <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8046c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046c3:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8046c8:	c9                   	leave
+  8046c9:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8046ca:	83 ec 04             	sub    $0x4,%esp
+  8046cd:	6a 07                	push   $0x7
+  8046cf:	68 00 f0 bf ee       	push   $0xeebff000
+  8046d4:	6a 00                	push   $0x0
+  8046d6:	e8 f5 c7 ff ff       	call   800ed0 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8046db:	83 c4 08             	add    $0x8,%esp
+  8046de:	68 ef 46 80 00       	push   $0x8046ef
+  8046e3:	6a 00                	push   $0x0
+  8046e5:	e8 63 c9 ff ff       	call   80104d <sys_env_set_pgfault_upcall>
+  8046ea:	83 c4 10             	add    $0x10,%esp
+  8046ed:	eb d1                	jmp    8046c0 <set_pgfault_handler+0xf>
+
+008046ef <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8046ef:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8046f0:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8046f5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8046f7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8046fa:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8046fe:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804702:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804705:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804709:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80470b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80470e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80470f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804712:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804713:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804714:	c3                   	ret
+
+00804715 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804715:	55                   	push   %ebp
+  804716:	89 e5                	mov    %esp,%ebp
+  804718:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80471b:	89 c2                	mov    %eax,%edx
+  80471d:	c1 ea 16             	shr    $0x16,%edx
+  804720:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804727:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80472c:	f6 c1 01             	test   $0x1,%cl
+  80472f:	74 1c                	je     80474d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804731:	c1 e8 0c             	shr    $0xc,%eax
+  804734:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80473b:	a8 01                	test   $0x1,%al
+  80473d:	74 0e                	je     80474d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80473f:	c1 e8 0c             	shr    $0xc,%eax
+  804742:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804749:	ef 
+  80474a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80474d:	89 d0                	mov    %edx,%eax
+  80474f:	5d                   	pop    %ebp
+  804750:	c3                   	ret
+
+00804751 <udm>:
+  804751:	57                   	push   %edi
+  804752:	56                   	push   %esi
+  804753:	53                   	push   %ebx
+  804754:	83 ec 20             	sub    $0x20,%esp
+  804757:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80475b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80475f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804763:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804767:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80476b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80476f:	89 d1                	mov    %edx,%ecx
+  804771:	09 c1                	or     %eax,%ecx
+  804773:	0f 84 91 00 00 00    	je     80480a <udm+0xb9>
+  804779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804783:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804788:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80478f:	00 
+  804790:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804797:	00 
+  804798:	eb 08                	jmp    8047a2 <udm+0x51>
+  80479a:	83 e9 01             	sub    $0x1,%ecx
+  80479d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8047a0:	74 7c                	je     80481e <udm+0xcd>
+  8047a2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8047a6:	01 c0                	add    %eax,%eax
+  8047a8:	89 c6                	mov    %eax,%esi
+  8047aa:	89 d7                	mov    %edx,%edi
+  8047ac:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8047b0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8047b4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8047b7:	d3 ea                	shr    %cl,%edx
+  8047b9:	f6 c1 20             	test   $0x20,%cl
+  8047bc:	74 04                	je     8047c2 <udm+0x71>
+  8047be:	89 d0                	mov    %edx,%eax
+  8047c0:	31 d2                	xor    %edx,%edx
+  8047c2:	83 e0 01             	and    $0x1,%eax
+  8047c5:	89 04 24             	mov    %eax,(%esp)
+  8047c8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8047cf:	00 
+  8047d0:	8b 04 24             	mov    (%esp),%eax
+  8047d3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8047d7:	09 f0                	or     %esi,%eax
+  8047d9:	09 fa                	or     %edi,%edx
+  8047db:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047df:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8047e3:	39 f0                	cmp    %esi,%eax
+  8047e5:	89 d3                	mov    %edx,%ebx
+  8047e7:	19 fb                	sbb    %edi,%ebx
+  8047e9:	72 af                	jb     80479a <udm+0x49>
+  8047eb:	29 f0                	sub    %esi,%eax
+  8047ed:	19 fa                	sbb    %edi,%edx
+  8047ef:	89 cf                	mov    %ecx,%edi
+  8047f1:	c1 ef 05             	shr    $0x5,%edi
+  8047f4:	83 e7 01             	and    $0x1,%edi
+  8047f7:	89 fe                	mov    %edi,%esi
+  8047f9:	83 f6 01             	xor    $0x1,%esi
+  8047fc:	d3 e6                	shl    %cl,%esi
+  8047fe:	d3 e7                	shl    %cl,%edi
+  804800:	09 74 24 18          	or     %esi,0x18(%esp)
+  804804:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804808:	eb 90                	jmp    80479a <udm+0x49>
+  80480a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80480e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804812:	89 f0                	mov    %esi,%eax
+  804814:	89 fa                	mov    %edi,%edx
+  804816:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80481a:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80481e:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804822:	89 01                	mov    %eax,(%ecx)
+  804824:	89 51 04             	mov    %edx,0x4(%ecx)
+  804827:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80482b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80482f:	83 c4 20             	add    $0x20,%esp
+  804832:	5b                   	pop    %ebx
+  804833:	5e                   	pop    %esi
+  804834:	5f                   	pop    %edi
+  804835:	c3                   	ret
+
+00804836 <__udivdi3>:
+  804836:	83 ec 18             	sub    $0x18,%esp
+  804839:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80483d:	50                   	push   %eax
+  80483e:	ff 74 24 2c          	push   0x2c(%esp)
+  804842:	ff 74 24 2c          	push   0x2c(%esp)
+  804846:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80484a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80484e:	e8 fe fe ff ff       	call   804751 <udm>
+  804853:	83 c4 24             	add    $0x24,%esp
+  804856:	c3                   	ret
+
+00804857 <__umoddi3>:
+  804857:	83 ec 18             	sub    $0x18,%esp
+  80485a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80485e:	50                   	push   %eax
+  80485f:	ff 74 24 2c          	push   0x2c(%esp)
+  804863:	ff 74 24 2c          	push   0x2c(%esp)
+  804867:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80486b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80486f:	e8 dd fe ff ff       	call   804751 <udm>
+  804874:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804878:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80487c:	83 c4 24             	add    $0x24,%esp
+  80487f:	c3                   	ret
+
+00804880 <__divdi3>:
+  804880:	56                   	push   %esi
+  804881:	53                   	push   %ebx
+  804882:	83 ec 14             	sub    $0x14,%esp
+  804885:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804889:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80488d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804891:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804895:	85 d2                	test   %edx,%edx
+  804897:	78 18                	js     8048b1 <__divdi3+0x31>
+  804899:	85 db                	test   %ebx,%ebx
+  80489b:	78 3e                	js     8048db <__divdi3+0x5b>
+  80489d:	83 ec 04             	sub    $0x4,%esp
+  8048a0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048a4:	56                   	push   %esi
+  8048a5:	53                   	push   %ebx
+  8048a6:	51                   	push   %ecx
+  8048a7:	e8 a5 fe ff ff       	call   804751 <udm>
+  8048ac:	83 c4 10             	add    $0x10,%esp
+  8048af:	eb 24                	jmp    8048d5 <__divdi3+0x55>
+  8048b1:	f7 d8                	neg    %eax
+  8048b3:	83 d2 00             	adc    $0x0,%edx
+  8048b6:	f7 da                	neg    %edx
+  8048b8:	85 db                	test   %ebx,%ebx
+  8048ba:	78 3a                	js     8048f6 <__divdi3+0x76>
+  8048bc:	83 ec 04             	sub    $0x4,%esp
+  8048bf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048c3:	56                   	push   %esi
+  8048c4:	53                   	push   %ebx
+  8048c5:	51                   	push   %ecx
+  8048c6:	e8 86 fe ff ff       	call   804751 <udm>
+  8048cb:	83 c4 10             	add    $0x10,%esp
+  8048ce:	f7 d8                	neg    %eax
+  8048d0:	83 d2 00             	adc    $0x0,%edx
+  8048d3:	f7 da                	neg    %edx
+  8048d5:	83 c4 14             	add    $0x14,%esp
+  8048d8:	5b                   	pop    %ebx
+  8048d9:	5e                   	pop    %esi
+  8048da:	c3                   	ret
+  8048db:	83 ec 04             	sub    $0x4,%esp
+  8048de:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048e2:	56                   	push   %esi
+  8048e3:	f7 d9                	neg    %ecx
+  8048e5:	83 d3 00             	adc    $0x0,%ebx
+  8048e8:	f7 db                	neg    %ebx
+  8048ea:	53                   	push   %ebx
+  8048eb:	51                   	push   %ecx
+  8048ec:	e8 60 fe ff ff       	call   804751 <udm>
+  8048f1:	83 c4 10             	add    $0x10,%esp
+  8048f4:	eb d8                	jmp    8048ce <__divdi3+0x4e>
+  8048f6:	83 ec 04             	sub    $0x4,%esp
+  8048f9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048fd:	56                   	push   %esi
+  8048fe:	f7 d9                	neg    %ecx
+  804900:	83 d3 00             	adc    $0x0,%ebx
+  804903:	f7 db                	neg    %ebx
+  804905:	53                   	push   %ebx
+  804906:	51                   	push   %ecx
+  804907:	e8 45 fe ff ff       	call   804751 <udm>
+  80490c:	83 c4 10             	add    $0x10,%esp
+  80490f:	eb c4                	jmp    8048d5 <__divdi3+0x55>
+
+00804911 <__moddi3>:
+  804911:	55                   	push   %ebp
+  804912:	57                   	push   %edi
+  804913:	56                   	push   %esi
+  804914:	53                   	push   %ebx
+  804915:	83 ec 24             	sub    $0x24,%esp
+  804918:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80491c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804920:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804924:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804928:	85 d2                	test   %edx,%edx
+  80492a:	78 3b                	js     804967 <__moddi3+0x56>
+  80492c:	83 ec 04             	sub    $0x4,%esp
+  80492f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804933:	56                   	push   %esi
+  804934:	89 ce                	mov    %ecx,%esi
+  804936:	f7 de                	neg    %esi
+  804938:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80493c:	89 de                	mov    %ebx,%esi
+  80493e:	83 d6 00             	adc    $0x0,%esi
+  804941:	f7 de                	neg    %esi
+  804943:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804947:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80494b:	0f 48 f1             	cmovs  %ecx,%esi
+  80494e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804953:	53                   	push   %ebx
+  804954:	56                   	push   %esi
+  804955:	e8 f7 fd ff ff       	call   804751 <udm>
+  80495a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80495e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804962:	83 c4 10             	add    $0x10,%esp
+  804965:	eb 47                	jmp    8049ae <__moddi3+0x9d>
+  804967:	f7 d8                	neg    %eax
+  804969:	83 d2 00             	adc    $0x0,%edx
+  80496c:	f7 da                	neg    %edx
+  80496e:	83 ec 04             	sub    $0x4,%esp
+  804971:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804975:	56                   	push   %esi
+  804976:	89 cf                	mov    %ecx,%edi
+  804978:	f7 df                	neg    %edi
+  80497a:	89 de                	mov    %ebx,%esi
+  80497c:	83 d6 00             	adc    $0x0,%esi
+  80497f:	f7 de                	neg    %esi
+  804981:	0f 49 cf             	cmovns %edi,%ecx
+  804984:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804988:	0f 49 de             	cmovns %esi,%ebx
+  80498b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80498f:	ff 74 24 0c          	push   0xc(%esp)
+  804993:	ff 74 24 0c          	push   0xc(%esp)
+  804997:	e8 b5 fd ff ff       	call   804751 <udm>
+  80499c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049a0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049a4:	f7 d8                	neg    %eax
+  8049a6:	83 d2 00             	adc    $0x0,%edx
+  8049a9:	f7 da                	neg    %edx
+  8049ab:	83 c4 10             	add    $0x10,%esp
+  8049ae:	83 c4 24             	add    $0x24,%esp
+  8049b1:	5b                   	pop    %ebx
+  8049b2:	5e                   	pop    %esi
+  8049b3:	5f                   	pop    %edi
+  8049b4:	5d                   	pop    %ebp
+  8049b5:	c3                   	ret
@@ -0,0 +1,9680 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	57                   	push   %edi
+  80003e:	56                   	push   %esi
+  80003f:	53                   	push   %ebx
+  800040:	83 ec 1c             	sub    $0x1c,%esp
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800049:	e8 31 01 00 00       	call   80017f <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80004e:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800051:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80005e:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800060:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800066:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80006b:	77 16                	ja     800083 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80006d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800072:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800074:	c1 e8 10             	shr    $0x10,%eax
+  800077:	74 0a                	je     800083 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800079:	c1 e0 10             	shl    $0x10,%eax
+  80007c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800081:	29 c2                	sub    %eax,%edx
+  800083:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800086:	c1 e0 04             	shl    $0x4,%eax
+  800089:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80008e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800090:	85 db                	test   %ebx,%ebx
+  800092:	7e 07                	jle    80009b <libmain+0x61>
+		binaryname = argv[0];
+  800094:	8b 06                	mov    (%esi),%eax
+  800096:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80009b:	83 ec 08             	sub    $0x8,%esp
+  80009e:	56                   	push   %esi
+  80009f:	53                   	push   %ebx
+  8000a0:	e8 8e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a5:	e8 0b 00 00 00       	call   8000b5 <exit>
+}
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b0:	5b                   	pop    %ebx
+  8000b1:	5e                   	pop    %esi
+  8000b2:	5f                   	pop    %edi
+  8000b3:	5d                   	pop    %ebp
+  8000b4:	c3                   	ret
+
+008000b5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000bb:	6a 00                	push   $0x0
+  8000bd:	e8 12 17 00 00       	call   8017d4 <fflush>
+	pthread_kill_others();
+  8000c2:	e8 7d 2d 00 00       	call   802e44 <pthread_kill_others>
+	close_all();
+  8000c7:	e8 ab 07 00 00       	call   800877 <close_all>
+	sys_env_destroy(0);
+  8000cc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000d3:	e8 5c 00 00 00       	call   800134 <sys_env_destroy>
+}
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	c9                   	leave
+  8000dc:	c3                   	ret
+
+008000dd <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	57                   	push   %edi
+  8000e1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ed:	89 c3                	mov    %eax,%ebx
+  8000ef:	89 c7                	mov    %eax,%edi
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	55                   	push   %ebp
+  8000f4:	56                   	push   %esi
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	8d 35 ff 00 80 00    	lea    0x8000ff,%esi
+  8000fd:	0f 34                	sysenter
+
+008000ff <after_sysenter_label_47>:
+  8000ff:	5e                   	pop    %esi
+  800100:	5d                   	pop    %ebp
+  800101:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800104:	5b                   	pop    %ebx
+  800105:	5f                   	pop    %edi
+  800106:	5d                   	pop    %ebp
+  800107:	c3                   	ret
+
+00800108 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	57                   	push   %edi
+  80010c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80010d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800112:	b8 01 00 00 00       	mov    $0x1,%eax
+  800117:	89 d1                	mov    %edx,%ecx
+  800119:	89 d3                	mov    %edx,%ebx
+  80011b:	89 d7                	mov    %edx,%edi
+  80011d:	6a 00                	push   $0x0
+  80011f:	55                   	push   %ebp
+  800120:	56                   	push   %esi
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	8d 35 2b 01 80 00    	lea    0x80012b,%esi
+  800129:	0f 34                	sysenter
+
+0080012b <after_sysenter_label_128>:
+  80012b:	5e                   	pop    %esi
+  80012c:	5d                   	pop    %ebp
+  80012d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800130:	5b                   	pop    %ebx
+  800131:	5f                   	pop    %edi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+
+00800134 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80013c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800141:	b8 03 00 00 00       	mov    $0x3,%eax
+  800146:	89 cb                	mov    %ecx,%ebx
+  800148:	89 cf                	mov    %ecx,%edi
+  80014a:	6a 00                	push   $0x0
+  80014c:	55                   	push   %ebp
+  80014d:	56                   	push   %esi
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	8d 35 58 01 80 00    	lea    0x800158,%esi
+  800156:	0f 34                	sysenter
+
+00800158 <after_sysenter_label_212>:
+  800158:	5e                   	pop    %esi
+  800159:	5d                   	pop    %ebp
+  80015a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80015d:	85 c0                	test   %eax,%eax
+  80015f:	7f 07                	jg     800168 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800161:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800164:	5b                   	pop    %ebx
+  800165:	5f                   	pop    %edi
+  800166:	5d                   	pop    %ebp
+  800167:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800168:	83 ec 0c             	sub    $0xc,%esp
+  80016b:	50                   	push   %eax
+  80016c:	6a 03                	push   $0x3
+  80016e:	68 ca 46 80 00       	push   $0x8046ca
+  800173:	6a 54                	push   $0x54
+  800175:	68 e7 46 80 00       	push   $0x8046e7
+  80017a:	e8 38 30 00 00       	call   8031b7 <_panic>
+
+0080017f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	57                   	push   %edi
+  800183:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800184:	ba 00 00 00 00       	mov    $0x0,%edx
+  800189:	b8 02 00 00 00       	mov    $0x2,%eax
+  80018e:	89 d1                	mov    %edx,%ecx
+  800190:	89 d3                	mov    %edx,%ebx
+  800192:	89 d7                	mov    %edx,%edi
+  800194:	6a 00                	push   $0x0
+  800196:	55                   	push   %ebp
+  800197:	56                   	push   %esi
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	8d 35 a2 01 80 00    	lea    0x8001a2,%esi
+  8001a0:	0f 34                	sysenter
+
+008001a2 <after_sysenter_label_309>:
+  8001a2:	5e                   	pop    %esi
+  8001a3:	5d                   	pop    %ebp
+  8001a4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5f                   	pop    %edi
+  8001a9:	5d                   	pop    %ebp
+  8001aa:	c3                   	ret
+
+008001ab <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	57                   	push   %edi
+  8001af:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001ba:	89 d1                	mov    %edx,%ecx
+  8001bc:	89 d3                	mov    %edx,%ebx
+  8001be:	89 d7                	mov    %edx,%edi
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	55                   	push   %ebp
+  8001c3:	56                   	push   %esi
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	8d 35 ce 01 80 00    	lea    0x8001ce,%esi
+  8001cc:	0f 34                	sysenter
+
+008001ce <after_sysenter_label_391>:
+  8001ce:	5e                   	pop    %esi
+  8001cf:	5d                   	pop    %ebp
+  8001d0:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001d3:	5b                   	pop    %ebx
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	55                   	push   %ebp
+  8001f2:	56                   	push   %esi
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	8d 35 fd 01 80 00    	lea    0x8001fd,%esi
+  8001fb:	0f 34                	sysenter
+
+008001fd <after_sysenter_label_479>:
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5d                   	pop    %ebp
+  8001ff:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800202:	85 c0                	test   %eax,%eax
+  800204:	7f 07                	jg     80020d <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800206:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800209:	5b                   	pop    %ebx
+  80020a:	5f                   	pop    %edi
+  80020b:	5d                   	pop    %ebp
+  80020c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80020d:	83 ec 0c             	sub    $0xc,%esp
+  800210:	50                   	push   %eax
+  800211:	6a 04                	push   $0x4
+  800213:	68 ca 46 80 00       	push   $0x8046ca
+  800218:	6a 54                	push   $0x54
+  80021a:	68 e7 46 80 00       	push   $0x8046e7
+  80021f:	e8 93 2f 00 00       	call   8031b7 <_panic>
+
+00800224 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	57                   	push   %edi
+  800228:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800234:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800237:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80023a:	ff 75 18             	push   0x18(%ebp)
+  80023d:	55                   	push   %ebp
+  80023e:	56                   	push   %esi
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	8d 35 49 02 80 00    	lea    0x800249,%esi
+  800247:	0f 34                	sysenter
+
+00800249 <after_sysenter_label_593>:
+  800249:	5e                   	pop    %esi
+  80024a:	5d                   	pop    %ebp
+  80024b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	7f 07                	jg     800259 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800252:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5f                   	pop    %edi
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800259:	83 ec 0c             	sub    $0xc,%esp
+  80025c:	50                   	push   %eax
+  80025d:	6a 05                	push   $0x5
+  80025f:	68 ca 46 80 00       	push   $0x8046ca
+  800264:	6a 54                	push   $0x54
+  800266:	68 e7 46 80 00       	push   $0x8046e7
+  80026b:	e8 47 2f 00 00       	call   8031b7 <_panic>
+
+00800270 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	57                   	push   %edi
+  800274:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800275:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800280:	b8 06 00 00 00       	mov    $0x6,%eax
+  800285:	89 df                	mov    %ebx,%edi
+  800287:	6a 00                	push   $0x0
+  800289:	55                   	push   %ebp
+  80028a:	56                   	push   %esi
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	8d 35 95 02 80 00    	lea    0x800295,%esi
+  800293:	0f 34                	sysenter
+
+00800295 <after_sysenter_label_704>:
+  800295:	5e                   	pop    %esi
+  800296:	5d                   	pop    %ebp
+  800297:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80029a:	85 c0                	test   %eax,%eax
+  80029c:	7f 07                	jg     8002a5 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80029e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a1:	5b                   	pop    %ebx
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+  8002a8:	50                   	push   %eax
+  8002a9:	6a 06                	push   $0x6
+  8002ab:	68 ca 46 80 00       	push   $0x8046ca
+  8002b0:	6a 54                	push   $0x54
+  8002b2:	68 e7 46 80 00       	push   $0x8046e7
+  8002b7:	e8 fb 2e 00 00       	call   8031b7 <_panic>
+
+008002bc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002bc:	55                   	push   %ebp
+  8002bd:	89 e5                	mov    %esp,%ebp
+  8002bf:	57                   	push   %edi
+  8002c0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002d1:	89 df                	mov    %ebx,%edi
+  8002d3:	6a 00                	push   $0x0
+  8002d5:	55                   	push   %ebp
+  8002d6:	56                   	push   %esi
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	8d 35 e1 02 80 00    	lea    0x8002e1,%esi
+  8002df:	0f 34                	sysenter
+
+008002e1 <after_sysenter_label_808>:
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5d                   	pop    %ebp
+  8002e3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002e6:	85 c0                	test   %eax,%eax
+  8002e8:	7f 07                	jg     8002f1 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002ed:	5b                   	pop    %ebx
+  8002ee:	5f                   	pop    %edi
+  8002ef:	5d                   	pop    %ebp
+  8002f0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002f1:	83 ec 0c             	sub    $0xc,%esp
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 08                	push   $0x8
+  8002f7:	68 ca 46 80 00       	push   $0x8046ca
+  8002fc:	6a 54                	push   $0x54
+  8002fe:	68 e7 46 80 00       	push   $0x8046e7
+  800303:	e8 af 2e 00 00       	call   8031b7 <_panic>
+
+00800308 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80030d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800312:	8b 55 08             	mov    0x8(%ebp),%edx
+  800315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800318:	b8 09 00 00 00       	mov    $0x9,%eax
+  80031d:	89 df                	mov    %ebx,%edi
+  80031f:	6a 00                	push   $0x0
+  800321:	55                   	push   %ebp
+  800322:	56                   	push   %esi
+  800323:	89 e5                	mov    %esp,%ebp
+  800325:	8d 35 2d 03 80 00    	lea    0x80032d,%esi
+  80032b:	0f 34                	sysenter
+
+0080032d <after_sysenter_label_912>:
+  80032d:	5e                   	pop    %esi
+  80032e:	5d                   	pop    %ebp
+  80032f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800332:	85 c0                	test   %eax,%eax
+  800334:	7f 07                	jg     80033d <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800336:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800339:	5b                   	pop    %ebx
+  80033a:	5f                   	pop    %edi
+  80033b:	5d                   	pop    %ebp
+  80033c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80033d:	83 ec 0c             	sub    $0xc,%esp
+  800340:	50                   	push   %eax
+  800341:	6a 09                	push   $0x9
+  800343:	68 ca 46 80 00       	push   $0x8046ca
+  800348:	6a 54                	push   $0x54
+  80034a:	68 e7 46 80 00       	push   $0x8046e7
+  80034f:	e8 63 2e 00 00       	call   8031b7 <_panic>
+
+00800354 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800354:	55                   	push   %ebp
+  800355:	89 e5                	mov    %esp,%ebp
+  800357:	57                   	push   %edi
+  800358:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800359:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80035e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800364:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800369:	89 df                	mov    %ebx,%edi
+  80036b:	6a 00                	push   $0x0
+  80036d:	55                   	push   %ebp
+  80036e:	56                   	push   %esi
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	8d 35 79 03 80 00    	lea    0x800379,%esi
+  800377:	0f 34                	sysenter
+
+00800379 <after_sysenter_label_1016>:
+  800379:	5e                   	pop    %esi
+  80037a:	5d                   	pop    %ebp
+  80037b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80037e:	85 c0                	test   %eax,%eax
+  800380:	7f 07                	jg     800389 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800382:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800385:	5b                   	pop    %ebx
+  800386:	5f                   	pop    %edi
+  800387:	5d                   	pop    %ebp
+  800388:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800389:	83 ec 0c             	sub    $0xc,%esp
+  80038c:	50                   	push   %eax
+  80038d:	6a 0a                	push   $0xa
+  80038f:	68 ca 46 80 00       	push   $0x8046ca
+  800394:	6a 54                	push   $0x54
+  800396:	68 e7 46 80 00       	push   $0x8046e7
+  80039b:	e8 17 2e 00 00       	call   8031b7 <_panic>
+
+008003a0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003a0:	55                   	push   %ebp
+  8003a1:	89 e5                	mov    %esp,%ebp
+  8003a3:	57                   	push   %edi
+  8003a4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b6:	6a 00                	push   $0x0
+  8003b8:	55                   	push   %ebp
+  8003b9:	56                   	push   %esi
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	8d 35 c4 03 80 00    	lea    0x8003c4,%esi
+  8003c2:	0f 34                	sysenter
+
+008003c4 <after_sysenter_label_1126>:
+  8003c4:	5e                   	pop    %esi
+  8003c5:	5d                   	pop    %ebp
+  8003c6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5f                   	pop    %edi
+  8003cb:	5d                   	pop    %ebp
+  8003cc:	c3                   	ret
+
+008003cd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	57                   	push   %edi
+  8003d1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003df:	89 cb                	mov    %ecx,%ebx
+  8003e1:	89 cf                	mov    %ecx,%edi
+  8003e3:	6a 00                	push   $0x0
+  8003e5:	55                   	push   %ebp
+  8003e6:	56                   	push   %esi
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	8d 35 f1 03 80 00    	lea    0x8003f1,%esi
+  8003ef:	0f 34                	sysenter
+
+008003f1 <after_sysenter_label_1210>:
+  8003f1:	5e                   	pop    %esi
+  8003f2:	5d                   	pop    %ebp
+  8003f3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8003f6:	85 c0                	test   %eax,%eax
+  8003f8:	7f 07                	jg     800401 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8003fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003fd:	5b                   	pop    %ebx
+  8003fe:	5f                   	pop    %edi
+  8003ff:	5d                   	pop    %ebp
+  800400:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800401:	83 ec 0c             	sub    $0xc,%esp
+  800404:	50                   	push   %eax
+  800405:	6a 0d                	push   $0xd
+  800407:	68 ca 46 80 00       	push   $0x8046ca
+  80040c:	6a 54                	push   $0x54
+  80040e:	68 e7 46 80 00       	push   $0x8046e7
+  800413:	e8 9f 2d 00 00       	call   8031b7 <_panic>
+
+00800418 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	57                   	push   %edi
+  80041c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80041d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800422:	8b 55 08             	mov    0x8(%ebp),%edx
+  800425:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800428:	b8 42 00 00 00       	mov    $0x42,%eax
+  80042d:	89 df                	mov    %ebx,%edi
+  80042f:	6a 00                	push   $0x0
+  800431:	55                   	push   %ebp
+  800432:	56                   	push   %esi
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8d 35 3d 04 80 00    	lea    0x80043d,%esi
+  80043b:	0f 34                	sysenter
+
+0080043d <after_sysenter_label_1311>:
+  80043d:	5e                   	pop    %esi
+  80043e:	5d                   	pop    %ebp
+  80043f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800442:	85 c0                	test   %eax,%eax
+  800444:	7f 07                	jg     80044d <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800446:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800449:	5b                   	pop    %ebx
+  80044a:	5f                   	pop    %edi
+  80044b:	5d                   	pop    %ebp
+  80044c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80044d:	83 ec 0c             	sub    $0xc,%esp
+  800450:	50                   	push   %eax
+  800451:	6a 42                	push   $0x42
+  800453:	68 ca 46 80 00       	push   $0x8046ca
+  800458:	6a 54                	push   $0x54
+  80045a:	68 e7 46 80 00       	push   $0x8046e7
+  80045f:	e8 53 2d 00 00       	call   8031b7 <_panic>
+
+00800464 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800464:	55                   	push   %ebp
+  800465:	89 e5                	mov    %esp,%ebp
+  800467:	57                   	push   %edi
+  800468:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800473:	89 d1                	mov    %edx,%ecx
+  800475:	89 d3                	mov    %edx,%ebx
+  800477:	89 d7                	mov    %edx,%edi
+  800479:	6a 00                	push   $0x0
+  80047b:	55                   	push   %ebp
+  80047c:	56                   	push   %esi
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	8d 35 87 04 80 00    	lea    0x800487,%esi
+  800485:	0f 34                	sysenter
+
+00800487 <after_sysenter_label_1411>:
+  800487:	5e                   	pop    %esi
+  800488:	5d                   	pop    %ebp
+  800489:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80048c:	5b                   	pop    %ebx
+  80048d:	5f                   	pop    %edi
+  80048e:	5d                   	pop    %ebp
+  80048f:	c3                   	ret
+
+00800490 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004a5:	89 df                	mov    %ebx,%edi
+  8004a7:	6a 00                	push   $0x0
+  8004a9:	55                   	push   %ebp
+  8004aa:	56                   	push   %esi
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	8d 35 b5 04 80 00    	lea    0x8004b5,%esi
+  8004b3:	0f 34                	sysenter
+
+008004b5 <after_sysenter_label_1497>:
+  8004b5:	5e                   	pop    %esi
+  8004b6:	5d                   	pop    %ebp
+  8004b7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004ba:	5b                   	pop    %ebx
+  8004bb:	5f                   	pop    %edi
+  8004bc:	5d                   	pop    %ebp
+  8004bd:	c3                   	ret
+
+008004be <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004be:	55                   	push   %ebp
+  8004bf:	89 e5                	mov    %esp,%ebp
+  8004c1:	57                   	push   %edi
+  8004c2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ce:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004d3:	89 df                	mov    %ebx,%edi
+  8004d5:	6a 00                	push   $0x0
+  8004d7:	55                   	push   %ebp
+  8004d8:	56                   	push   %esi
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	8d 35 e3 04 80 00    	lea    0x8004e3,%esi
+  8004e1:	0f 34                	sysenter
+
+008004e3 <after_sysenter_label_1583>:
+  8004e3:	5e                   	pop    %esi
+  8004e4:	5d                   	pop    %ebp
+  8004e5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004e8:	5b                   	pop    %ebx
+  8004e9:	5f                   	pop    %edi
+  8004ea:	5d                   	pop    %ebp
+  8004eb:	c3                   	ret
+
+008004ec <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004ec:	55                   	push   %ebp
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	57                   	push   %edi
+  8004f0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8004fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800501:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800504:	6a 00                	push   $0x0
+  800506:	55                   	push   %ebp
+  800507:	56                   	push   %esi
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	8d 35 12 05 80 00    	lea    0x800512,%esi
+  800510:	0f 34                	sysenter
+
+00800512 <after_sysenter_label_1672>:
+  800512:	5e                   	pop    %esi
+  800513:	5d                   	pop    %ebp
+  800514:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800517:	5b                   	pop    %ebx
+  800518:	5f                   	pop    %edi
+  800519:	5d                   	pop    %ebp
+  80051a:	c3                   	ret
+
+0080051b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80051b:	55                   	push   %ebp
+  80051c:	89 e5                	mov    %esp,%ebp
+  80051e:	57                   	push   %edi
+  80051f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800520:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800525:	8b 55 08             	mov    0x8(%ebp),%edx
+  800528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800530:	89 df                	mov    %ebx,%edi
+  800532:	6a 00                	push   $0x0
+  800534:	55                   	push   %ebp
+  800535:	56                   	push   %esi
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	8d 35 40 05 80 00    	lea    0x800540,%esi
+  80053e:	0f 34                	sysenter
+
+00800540 <after_sysenter_label_1758>:
+  800540:	5e                   	pop    %esi
+  800541:	5d                   	pop    %ebp
+  800542:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800545:	5b                   	pop    %ebx
+  800546:	5f                   	pop    %edi
+  800547:	5d                   	pop    %ebp
+  800548:	c3                   	ret
+
+00800549 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800549:	55                   	push   %ebp
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	57                   	push   %edi
+  80054d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80054e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800556:	b8 13 00 00 00       	mov    $0x13,%eax
+  80055b:	89 cb                	mov    %ecx,%ebx
+  80055d:	89 cf                	mov    %ecx,%edi
+  80055f:	6a 00                	push   $0x0
+  800561:	55                   	push   %ebp
+  800562:	56                   	push   %esi
+  800563:	89 e5                	mov    %esp,%ebp
+  800565:	8d 35 6d 05 80 00    	lea    0x80056d,%esi
+  80056b:	0f 34                	sysenter
+
+0080056d <after_sysenter_label_1842>:
+  80056d:	5e                   	pop    %esi
+  80056e:	5d                   	pop    %ebp
+  80056f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800572:	85 c0                	test   %eax,%eax
+  800574:	7f 07                	jg     80057d <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800576:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800579:	5b                   	pop    %ebx
+  80057a:	5f                   	pop    %edi
+  80057b:	5d                   	pop    %ebp
+  80057c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80057d:	83 ec 0c             	sub    $0xc,%esp
+  800580:	50                   	push   %eax
+  800581:	6a 13                	push   $0x13
+  800583:	68 ca 46 80 00       	push   $0x8046ca
+  800588:	6a 54                	push   $0x54
+  80058a:	68 e7 46 80 00       	push   $0x8046e7
+  80058f:	e8 23 2c 00 00       	call   8031b7 <_panic>
+
+00800594 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800594:	55                   	push   %ebp
+  800595:	89 e5                	mov    %esp,%ebp
+  800597:	57                   	push   %edi
+  800598:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059e:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005a3:	89 d1                	mov    %edx,%ecx
+  8005a5:	89 d3                	mov    %edx,%ebx
+  8005a7:	89 d7                	mov    %edx,%edi
+  8005a9:	6a 00                	push   $0x0
+  8005ab:	55                   	push   %ebp
+  8005ac:	56                   	push   %esi
+  8005ad:	89 e5                	mov    %esp,%ebp
+  8005af:	8d 35 b7 05 80 00    	lea    0x8005b7,%esi
+  8005b5:	0f 34                	sysenter
+
+008005b7 <after_sysenter_label_1939>:
+  8005b7:	5e                   	pop    %esi
+  8005b8:	5d                   	pop    %ebp
+  8005b9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005bc:	5b                   	pop    %ebx
+  8005bd:	5f                   	pop    %edi
+  8005be:	5d                   	pop    %ebp
+  8005bf:	c3                   	ret
+
+008005c0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005c0:	55                   	push   %ebp
+  8005c1:	89 e5                	mov    %esp,%ebp
+  8005c3:	57                   	push   %edi
+  8005c4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005d8:	6a 00                	push   $0x0
+  8005da:	55                   	push   %ebp
+  8005db:	56                   	push   %esi
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	8d 35 e6 05 80 00    	lea    0x8005e6,%esi
+  8005e4:	0f 34                	sysenter
+
+008005e6 <after_sysenter_label_2028>:
+  8005e6:	5e                   	pop    %esi
+  8005e7:	5d                   	pop    %ebp
+  8005e8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005eb:	5b                   	pop    %ebx
+  8005ec:	5f                   	pop    %edi
+  8005ed:	5d                   	pop    %ebp
+  8005ee:	c3                   	ret
+
+008005ef <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005ef:	55                   	push   %ebp
+  8005f0:	89 e5                	mov    %esp,%ebp
+  8005f2:	57                   	push   %edi
+  8005f3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ff:	b8 16 00 00 00       	mov    $0x16,%eax
+  800604:	89 df                	mov    %ebx,%edi
+  800606:	6a 00                	push   $0x0
+  800608:	55                   	push   %ebp
+  800609:	56                   	push   %esi
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	8d 35 14 06 80 00    	lea    0x800614,%esi
+  800612:	0f 34                	sysenter
+
+00800614 <after_sysenter_label_2114>:
+  800614:	5e                   	pop    %esi
+  800615:	5d                   	pop    %ebp
+  800616:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800619:	5b                   	pop    %ebx
+  80061a:	5f                   	pop    %edi
+  80061b:	5d                   	pop    %ebp
+  80061c:	c3                   	ret
+
+0080061d <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80061d:	55                   	push   %ebp
+  80061e:	89 e5                	mov    %esp,%ebp
+  800620:	57                   	push   %edi
+  800621:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800622:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800627:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800632:	89 df                	mov    %ebx,%edi
+  800634:	6a 00                	push   $0x0
+  800636:	55                   	push   %ebp
+  800637:	56                   	push   %esi
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	8d 35 42 06 80 00    	lea    0x800642,%esi
+  800640:	0f 34                	sysenter
+
+00800642 <after_sysenter_label_2200>:
+  800642:	5e                   	pop    %esi
+  800643:	5d                   	pop    %ebp
+  800644:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800647:	5b                   	pop    %ebx
+  800648:	5f                   	pop    %edi
+  800649:	5d                   	pop    %ebp
+  80064a:	c3                   	ret
+
+0080064b <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80064b:	55                   	push   %ebp
+  80064c:	89 e5                	mov    %esp,%ebp
+  80064e:	57                   	push   %edi
+  80064f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800655:	8b 55 08             	mov    0x8(%ebp),%edx
+  800658:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80065b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800660:	89 df                	mov    %ebx,%edi
+  800662:	6a 00                	push   $0x0
+  800664:	55                   	push   %ebp
+  800665:	56                   	push   %esi
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	8d 35 70 06 80 00    	lea    0x800670,%esi
+  80066e:	0f 34                	sysenter
+
+00800670 <after_sysenter_label_2286>:
+  800670:	5e                   	pop    %esi
+  800671:	5d                   	pop    %ebp
+  800672:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800675:	5b                   	pop    %ebx
+  800676:	5f                   	pop    %edi
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80067c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800684:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80068c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80068f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800694:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800699:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80069e:	5d                   	pop    %ebp
+  80069f:	c3                   	ret
+
+008006a0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006a0:	55                   	push   %ebp
+  8006a1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006a3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006a8:	eb 02                	jmp    8006ac <fd_alloc+0xc>
+  8006aa:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006ac:	89 c2                	mov    %eax,%edx
+  8006ae:	c1 ea 16             	shr    $0x16,%edx
+  8006b1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006b8:	f6 c2 01             	test   $0x1,%dl
+  8006bb:	74 2b                	je     8006e8 <fd_alloc+0x48>
+  8006bd:	89 c2                	mov    %eax,%edx
+  8006bf:	c1 ea 0c             	shr    $0xc,%edx
+  8006c2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006c9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006cf:	f6 c1 01             	test   $0x1,%cl
+  8006d2:	74 14                	je     8006e8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006d4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006da:	75 ce                	jne    8006aa <fd_alloc+0xa>
+  8006dc:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006e1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006e6:	eb 05                	jmp    8006ed <fd_alloc+0x4d>
+			return 0;
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f0:	89 02                	mov    %eax,(%edx)
+}
+  8006f2:	89 c8                	mov    %ecx,%eax
+  8006f4:	5d                   	pop    %ebp
+  8006f5:	c3                   	ret
+
+008006f6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006fc:	83 f8 1f             	cmp    $0x1f,%eax
+  8006ff:	77 30                	ja     800731 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800701:	c1 e0 0c             	shl    $0xc,%eax
+  800704:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800709:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80070f:	f6 c2 01             	test   $0x1,%dl
+  800712:	74 24                	je     800738 <fd_lookup+0x42>
+  800714:	89 c2                	mov    %eax,%edx
+  800716:	c1 ea 0c             	shr    $0xc,%edx
+  800719:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800720:	f6 c2 01             	test   $0x1,%dl
+  800723:	74 1a                	je     80073f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800725:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800728:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80072a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80072f:	5d                   	pop    %ebp
+  800730:	c3                   	ret
+		return -E_INVAL;
+  800731:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800736:	eb f7                	jmp    80072f <fd_lookup+0x39>
+		return -E_INVAL;
+  800738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073d:	eb f0                	jmp    80072f <fd_lookup+0x39>
+  80073f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800744:	eb e9                	jmp    80072f <fd_lookup+0x39>
+
+00800746 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	53                   	push   %ebx
+  80074a:	83 ec 04             	sub    $0x4,%esp
+  80074d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	eb 03                	jmp    80075a <dev_lookup+0x14>
+  800757:	83 c0 01             	add    $0x1,%eax
+  80075a:	8b 1c 85 74 47 80 00 	mov    0x804774(,%eax,4),%ebx
+  800761:	85 db                	test   %ebx,%ebx
+  800763:	74 0b                	je     800770 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800765:	39 13                	cmp    %edx,(%ebx)
+  800767:	75 ee                	jne    800757 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076e:	eb 49                	jmp    8007b9 <dev_lookup+0x73>
+  800770:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800772:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800778:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80077d:	77 18                	ja     800797 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80077f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800784:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800786:	c1 e8 10             	shr    $0x10,%eax
+  800789:	74 0c                	je     800797 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80078b:	c1 e0 10             	shl    $0x10,%eax
+  80078e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  800793:	29 c1                	sub    %eax,%ecx
+  800795:	eb 06                	jmp    80079d <dev_lookup+0x57>
+		return pthread_main_tls;
+  800797:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80079d:	8b 01                	mov    (%ecx),%eax
+  80079f:	8b 40 48             	mov    0x48(%eax),%eax
+  8007a2:	83 ec 04             	sub    $0x4,%esp
+  8007a5:	52                   	push   %edx
+  8007a6:	50                   	push   %eax
+  8007a7:	68 f8 46 80 00       	push   $0x8046f8
+  8007ac:	e8 e1 2a 00 00       	call   803292 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007b1:	83 c4 10             	add    $0x10,%esp
+  8007b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007bc:	89 1a                	mov    %ebx,(%edx)
+}
+  8007be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c1:	c9                   	leave
+  8007c2:	c3                   	ret
+
+008007c3 <fd_close>:
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	57                   	push   %edi
+  8007c7:	56                   	push   %esi
+  8007c8:	53                   	push   %ebx
+  8007c9:	83 ec 24             	sub    $0x24,%esp
+  8007cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007d2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007d5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007d6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007dc:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007df:	50                   	push   %eax
+  8007e0:	e8 11 ff ff ff       	call   8006f6 <fd_lookup>
+  8007e5:	89 c3                	mov    %eax,%ebx
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	85 c0                	test   %eax,%eax
+  8007ec:	78 05                	js     8007f3 <fd_close+0x30>
+	    || fd != fd2)
+  8007ee:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007f1:	74 16                	je     800809 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8007f3:	89 f8                	mov    %edi,%eax
+  8007f5:	84 c0                	test   %al,%al
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007ff:	89 d8                	mov    %ebx,%eax
+  800801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800804:	5b                   	pop    %ebx
+  800805:	5e                   	pop    %esi
+  800806:	5f                   	pop    %edi
+  800807:	5d                   	pop    %ebp
+  800808:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800809:	83 ec 08             	sub    $0x8,%esp
+  80080c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80080f:	50                   	push   %eax
+  800810:	ff 36                	push   (%esi)
+  800812:	e8 2f ff ff ff       	call   800746 <dev_lookup>
+  800817:	89 c3                	mov    %eax,%ebx
+  800819:	83 c4 10             	add    $0x10,%esp
+  80081c:	85 c0                	test   %eax,%eax
+  80081e:	78 1a                	js     80083a <fd_close+0x77>
+		if (dev->dev_close)
+  800820:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800823:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800826:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	74 0b                	je     80083a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80082f:	83 ec 0c             	sub    $0xc,%esp
+  800832:	56                   	push   %esi
+  800833:	ff d0                	call   *%eax
+  800835:	89 c3                	mov    %eax,%ebx
+  800837:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80083a:	83 ec 08             	sub    $0x8,%esp
+  80083d:	56                   	push   %esi
+  80083e:	6a 00                	push   $0x0
+  800840:	e8 2b fa ff ff       	call   800270 <sys_page_unmap>
+	return r;
+  800845:	83 c4 10             	add    $0x10,%esp
+  800848:	eb b5                	jmp    8007ff <fd_close+0x3c>
+
+0080084a <close>:
+
+int
+close(int fdnum)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800850:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800853:	50                   	push   %eax
+  800854:	ff 75 08             	push   0x8(%ebp)
+  800857:	e8 9a fe ff ff       	call   8006f6 <fd_lookup>
+  80085c:	83 c4 10             	add    $0x10,%esp
+  80085f:	85 c0                	test   %eax,%eax
+  800861:	79 02                	jns    800865 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800863:	c9                   	leave
+  800864:	c3                   	ret
+		return fd_close(fd, 1);
+  800865:	83 ec 08             	sub    $0x8,%esp
+  800868:	6a 01                	push   $0x1
+  80086a:	ff 75 f4             	push   -0xc(%ebp)
+  80086d:	e8 51 ff ff ff       	call   8007c3 <fd_close>
+  800872:	83 c4 10             	add    $0x10,%esp
+  800875:	eb ec                	jmp    800863 <close+0x19>
+
+00800877 <close_all>:
+
+void
+close_all(void)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	53                   	push   %ebx
+  80087b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80087e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800883:	83 ec 0c             	sub    $0xc,%esp
+  800886:	53                   	push   %ebx
+  800887:	e8 be ff ff ff       	call   80084a <close>
+	for (i = 0; i < MAXFD; i++)
+  80088c:	83 c3 01             	add    $0x1,%ebx
+  80088f:	83 c4 10             	add    $0x10,%esp
+  800892:	83 fb 20             	cmp    $0x20,%ebx
+  800895:	75 ec                	jne    800883 <close_all+0xc>
+}
+  800897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+
+0080089c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	57                   	push   %edi
+  8008a0:	56                   	push   %esi
+  8008a1:	53                   	push   %ebx
+  8008a2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008a8:	50                   	push   %eax
+  8008a9:	ff 75 08             	push   0x8(%ebp)
+  8008ac:	e8 45 fe ff ff       	call   8006f6 <fd_lookup>
+  8008b1:	89 c3                	mov    %eax,%ebx
+  8008b3:	83 c4 10             	add    $0x10,%esp
+  8008b6:	85 c0                	test   %eax,%eax
+  8008b8:	78 7f                	js     800939 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008ba:	83 ec 0c             	sub    $0xc,%esp
+  8008bd:	ff 75 0c             	push   0xc(%ebp)
+  8008c0:	e8 85 ff ff ff       	call   80084a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c8:	c1 e6 0c             	shl    $0xc,%esi
+  8008cb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008d4:	89 3c 24             	mov    %edi,(%esp)
+  8008d7:	e8 ad fd ff ff       	call   800689 <fd2data>
+  8008dc:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008de:	89 34 24             	mov    %esi,(%esp)
+  8008e1:	e8 a3 fd ff ff       	call   800689 <fd2data>
+  8008e6:	83 c4 10             	add    $0x10,%esp
+  8008e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008ec:	89 d8                	mov    %ebx,%eax
+  8008ee:	c1 e8 16             	shr    $0x16,%eax
+  8008f1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008f8:	a8 01                	test   $0x1,%al
+  8008fa:	74 11                	je     80090d <dup+0x71>
+  8008fc:	89 d8                	mov    %ebx,%eax
+  8008fe:	c1 e8 0c             	shr    $0xc,%eax
+  800901:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800908:	f6 c2 01             	test   $0x1,%dl
+  80090b:	75 36                	jne    800943 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80090d:	89 f8                	mov    %edi,%eax
+  80090f:	c1 e8 0c             	shr    $0xc,%eax
+  800912:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800919:	83 ec 0c             	sub    $0xc,%esp
+  80091c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800921:	50                   	push   %eax
+  800922:	56                   	push   %esi
+  800923:	6a 00                	push   $0x0
+  800925:	57                   	push   %edi
+  800926:	6a 00                	push   $0x0
+  800928:	e8 f7 f8 ff ff       	call   800224 <sys_page_map>
+  80092d:	89 c3                	mov    %eax,%ebx
+  80092f:	83 c4 20             	add    $0x20,%esp
+  800932:	85 c0                	test   %eax,%eax
+  800934:	78 33                	js     800969 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800936:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800939:	89 d8                	mov    %ebx,%eax
+  80093b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80093e:	5b                   	pop    %ebx
+  80093f:	5e                   	pop    %esi
+  800940:	5f                   	pop    %edi
+  800941:	5d                   	pop    %ebp
+  800942:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800943:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80094a:	83 ec 0c             	sub    $0xc,%esp
+  80094d:	25 07 0e 00 00       	and    $0xe07,%eax
+  800952:	50                   	push   %eax
+  800953:	ff 75 d4             	push   -0x2c(%ebp)
+  800956:	6a 00                	push   $0x0
+  800958:	53                   	push   %ebx
+  800959:	6a 00                	push   $0x0
+  80095b:	e8 c4 f8 ff ff       	call   800224 <sys_page_map>
+  800960:	89 c3                	mov    %eax,%ebx
+  800962:	83 c4 20             	add    $0x20,%esp
+  800965:	85 c0                	test   %eax,%eax
+  800967:	79 a4                	jns    80090d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800969:	83 ec 08             	sub    $0x8,%esp
+  80096c:	56                   	push   %esi
+  80096d:	6a 00                	push   $0x0
+  80096f:	e8 fc f8 ff ff       	call   800270 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800974:	83 c4 08             	add    $0x8,%esp
+  800977:	ff 75 d4             	push   -0x2c(%ebp)
+  80097a:	6a 00                	push   $0x0
+  80097c:	e8 ef f8 ff ff       	call   800270 <sys_page_unmap>
+	return r;
+  800981:	83 c4 10             	add    $0x10,%esp
+  800984:	eb b3                	jmp    800939 <dup+0x9d>
+
+00800986 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	56                   	push   %esi
+  80098a:	53                   	push   %ebx
+  80098b:	83 ec 18             	sub    $0x18,%esp
+  80098e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800991:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800994:	50                   	push   %eax
+  800995:	53                   	push   %ebx
+  800996:	e8 5b fd ff ff       	call   8006f6 <fd_lookup>
+  80099b:	83 c4 10             	add    $0x10,%esp
+  80099e:	85 c0                	test   %eax,%eax
+  8009a0:	78 3c                	js     8009de <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009a5:	83 ec 08             	sub    $0x8,%esp
+  8009a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ab:	50                   	push   %eax
+  8009ac:	ff 36                	push   (%esi)
+  8009ae:	e8 93 fd ff ff       	call   800746 <dev_lookup>
+  8009b3:	83 c4 10             	add    $0x10,%esp
+  8009b6:	85 c0                	test   %eax,%eax
+  8009b8:	78 24                	js     8009de <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009ba:	8b 46 08             	mov    0x8(%esi),%eax
+  8009bd:	83 e0 03             	and    $0x3,%eax
+  8009c0:	83 f8 01             	cmp    $0x1,%eax
+  8009c3:	74 20                	je     8009e5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c8:	8b 40 08             	mov    0x8(%eax),%eax
+  8009cb:	85 c0                	test   %eax,%eax
+  8009cd:	74 61                	je     800a30 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009cf:	83 ec 04             	sub    $0x4,%esp
+  8009d2:	ff 75 10             	push   0x10(%ebp)
+  8009d5:	ff 75 0c             	push   0xc(%ebp)
+  8009d8:	56                   	push   %esi
+  8009d9:	ff d0                	call   *%eax
+  8009db:	83 c4 10             	add    $0x10,%esp
+}
+  8009de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e1:	5b                   	pop    %ebx
+  8009e2:	5e                   	pop    %esi
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+  8009e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8009f2:	77 18                	ja     800a0c <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8009f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8009f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8009fb:	c1 e8 10             	shr    $0x10,%eax
+  8009fe:	74 0c                	je     800a0c <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a00:	c1 e0 10             	shl    $0x10,%eax
+  800a03:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a08:	29 c2                	sub    %eax,%edx
+  800a0a:	eb 06                	jmp    800a12 <read+0x8c>
+		return pthread_main_tls;
+  800a0c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a12:	8b 02                	mov    (%edx),%eax
+  800a14:	8b 40 48             	mov    0x48(%eax),%eax
+  800a17:	83 ec 04             	sub    $0x4,%esp
+  800a1a:	53                   	push   %ebx
+  800a1b:	50                   	push   %eax
+  800a1c:	68 39 47 80 00       	push   $0x804739
+  800a21:	e8 6c 28 00 00       	call   803292 <cprintf>
+		return -E_INVAL;
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a2e:	eb ae                	jmp    8009de <read+0x58>
+		return -E_NOT_SUPP;
+  800a30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a35:	eb a7                	jmp    8009de <read+0x58>
+
+00800a37 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	57                   	push   %edi
+  800a3b:	56                   	push   %esi
+  800a3c:	53                   	push   %ebx
+  800a3d:	83 ec 0c             	sub    $0xc,%esp
+  800a40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a43:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a4b:	eb 02                	jmp    800a4f <readn+0x18>
+  800a4d:	01 c3                	add    %eax,%ebx
+  800a4f:	39 f3                	cmp    %esi,%ebx
+  800a51:	73 21                	jae    800a74 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a53:	83 ec 04             	sub    $0x4,%esp
+  800a56:	89 f0                	mov    %esi,%eax
+  800a58:	29 d8                	sub    %ebx,%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	89 d8                	mov    %ebx,%eax
+  800a5d:	03 45 0c             	add    0xc(%ebp),%eax
+  800a60:	50                   	push   %eax
+  800a61:	57                   	push   %edi
+  800a62:	e8 1f ff ff ff       	call   800986 <read>
+		if (m < 0)
+  800a67:	83 c4 10             	add    $0x10,%esp
+  800a6a:	85 c0                	test   %eax,%eax
+  800a6c:	78 04                	js     800a72 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a6e:	75 dd                	jne    800a4d <readn+0x16>
+  800a70:	eb 02                	jmp    800a74 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a72:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a74:	89 d8                	mov    %ebx,%eax
+  800a76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a79:	5b                   	pop    %ebx
+  800a7a:	5e                   	pop    %esi
+  800a7b:	5f                   	pop    %edi
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	56                   	push   %esi
+  800a82:	53                   	push   %ebx
+  800a83:	83 ec 18             	sub    $0x18,%esp
+  800a86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a8c:	50                   	push   %eax
+  800a8d:	53                   	push   %ebx
+  800a8e:	e8 63 fc ff ff       	call   8006f6 <fd_lookup>
+  800a93:	83 c4 10             	add    $0x10,%esp
+  800a96:	85 c0                	test   %eax,%eax
+  800a98:	78 37                	js     800ad1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a9d:	83 ec 08             	sub    $0x8,%esp
+  800aa0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aa3:	50                   	push   %eax
+  800aa4:	ff 36                	push   (%esi)
+  800aa6:	e8 9b fc ff ff       	call   800746 <dev_lookup>
+  800aab:	83 c4 10             	add    $0x10,%esp
+  800aae:	85 c0                	test   %eax,%eax
+  800ab0:	78 1f                	js     800ad1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ab2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ab6:	74 20                	je     800ad8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800abb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800abe:	85 c0                	test   %eax,%eax
+  800ac0:	74 61                	je     800b23 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ac2:	83 ec 04             	sub    $0x4,%esp
+  800ac5:	ff 75 10             	push   0x10(%ebp)
+  800ac8:	ff 75 0c             	push   0xc(%ebp)
+  800acb:	56                   	push   %esi
+  800acc:	ff d0                	call   *%eax
+  800ace:	83 c4 10             	add    $0x10,%esp
+}
+  800ad1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ad4:	5b                   	pop    %ebx
+  800ad5:	5e                   	pop    %esi
+  800ad6:	5d                   	pop    %ebp
+  800ad7:	c3                   	ret
+  800ad8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ada:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800ae0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800ae5:	77 18                	ja     800aff <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800ae7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800aec:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800aee:	c1 e8 10             	shr    $0x10,%eax
+  800af1:	74 0c                	je     800aff <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800af3:	c1 e0 10             	shl    $0x10,%eax
+  800af6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800afb:	29 c2                	sub    %eax,%edx
+  800afd:	eb 06                	jmp    800b05 <write+0x87>
+		return pthread_main_tls;
+  800aff:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b05:	8b 02                	mov    (%edx),%eax
+  800b07:	8b 40 48             	mov    0x48(%eax),%eax
+  800b0a:	83 ec 04             	sub    $0x4,%esp
+  800b0d:	53                   	push   %ebx
+  800b0e:	50                   	push   %eax
+  800b0f:	68 55 47 80 00       	push   $0x804755
+  800b14:	e8 79 27 00 00       	call   803292 <cprintf>
+		return -E_INVAL;
+  800b19:	83 c4 10             	add    $0x10,%esp
+  800b1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b21:	eb ae                	jmp    800ad1 <write+0x53>
+		return -E_NOT_SUPP;
+  800b23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b28:	eb a7                	jmp    800ad1 <write+0x53>
+
+00800b2a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b33:	50                   	push   %eax
+  800b34:	ff 75 08             	push   0x8(%ebp)
+  800b37:	e8 ba fb ff ff       	call   8006f6 <fd_lookup>
+  800b3c:	83 c4 10             	add    $0x10,%esp
+  800b3f:	85 c0                	test   %eax,%eax
+  800b41:	78 0e                	js     800b51 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b49:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b51:	c9                   	leave
+  800b52:	c3                   	ret
+
+00800b53 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	56                   	push   %esi
+  800b57:	53                   	push   %ebx
+  800b58:	83 ec 18             	sub    $0x18,%esp
+  800b5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b61:	50                   	push   %eax
+  800b62:	53                   	push   %ebx
+  800b63:	e8 8e fb ff ff       	call   8006f6 <fd_lookup>
+  800b68:	83 c4 10             	add    $0x10,%esp
+  800b6b:	85 c0                	test   %eax,%eax
+  800b6d:	78 34                	js     800ba3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b6f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b72:	83 ec 08             	sub    $0x8,%esp
+  800b75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b78:	50                   	push   %eax
+  800b79:	ff 36                	push   (%esi)
+  800b7b:	e8 c6 fb ff ff       	call   800746 <dev_lookup>
+  800b80:	83 c4 10             	add    $0x10,%esp
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	78 1c                	js     800ba3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b87:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b8b:	74 1d                	je     800baa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b90:	8b 40 18             	mov    0x18(%eax),%eax
+  800b93:	85 c0                	test   %eax,%eax
+  800b95:	74 5e                	je     800bf5 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b97:	83 ec 08             	sub    $0x8,%esp
+  800b9a:	ff 75 0c             	push   0xc(%ebp)
+  800b9d:	56                   	push   %esi
+  800b9e:	ff d0                	call   *%eax
+  800ba0:	83 c4 10             	add    $0x10,%esp
+}
+  800ba3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ba6:	5b                   	pop    %ebx
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+  800baa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bac:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bb2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bb7:	77 18                	ja     800bd1 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bb9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bbe:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bc0:	c1 e8 10             	shr    $0x10,%eax
+  800bc3:	74 0c                	je     800bd1 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bc5:	c1 e0 10             	shl    $0x10,%eax
+  800bc8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bcd:	29 c2                	sub    %eax,%edx
+  800bcf:	eb 06                	jmp    800bd7 <ftruncate+0x84>
+		return pthread_main_tls;
+  800bd1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800bd7:	8b 02                	mov    (%edx),%eax
+  800bd9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bdc:	83 ec 04             	sub    $0x4,%esp
+  800bdf:	53                   	push   %ebx
+  800be0:	50                   	push   %eax
+  800be1:	68 18 47 80 00       	push   $0x804718
+  800be6:	e8 a7 26 00 00       	call   803292 <cprintf>
+		return -E_INVAL;
+  800beb:	83 c4 10             	add    $0x10,%esp
+  800bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf3:	eb ae                	jmp    800ba3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bfa:	eb a7                	jmp    800ba3 <ftruncate+0x50>
+
+00800bfc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	56                   	push   %esi
+  800c00:	53                   	push   %ebx
+  800c01:	83 ec 18             	sub    $0x18,%esp
+  800c04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c0a:	50                   	push   %eax
+  800c0b:	ff 75 08             	push   0x8(%ebp)
+  800c0e:	e8 e3 fa ff ff       	call   8006f6 <fd_lookup>
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	85 c0                	test   %eax,%eax
+  800c18:	78 49                	js     800c63 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c1a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c1d:	83 ec 08             	sub    $0x8,%esp
+  800c20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c23:	50                   	push   %eax
+  800c24:	ff 36                	push   (%esi)
+  800c26:	e8 1b fb ff ff       	call   800746 <dev_lookup>
+  800c2b:	83 c4 10             	add    $0x10,%esp
+  800c2e:	85 c0                	test   %eax,%eax
+  800c30:	78 31                	js     800c63 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c35:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c39:	74 2f                	je     800c6a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c3b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c3e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c45:	00 00 00 
+	stat->st_isdir = 0;
+  800c48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c4f:	00 00 00 
+	stat->st_dev = dev;
+  800c52:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c58:	83 ec 08             	sub    $0x8,%esp
+  800c5b:	53                   	push   %ebx
+  800c5c:	56                   	push   %esi
+  800c5d:	ff 50 14             	call   *0x14(%eax)
+  800c60:	83 c4 10             	add    $0x10,%esp
+}
+  800c63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c6a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6f:	eb f2                	jmp    800c63 <fstat+0x67>
+
+00800c71 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	56                   	push   %esi
+  800c75:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c76:	83 ec 08             	sub    $0x8,%esp
+  800c79:	6a 00                	push   $0x0
+  800c7b:	ff 75 08             	push   0x8(%ebp)
+  800c7e:	e8 4b 03 00 00       	call   800fce <open>
+  800c83:	89 c3                	mov    %eax,%ebx
+  800c85:	83 c4 10             	add    $0x10,%esp
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	78 1b                	js     800ca7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c8c:	83 ec 08             	sub    $0x8,%esp
+  800c8f:	ff 75 0c             	push   0xc(%ebp)
+  800c92:	50                   	push   %eax
+  800c93:	e8 64 ff ff ff       	call   800bfc <fstat>
+  800c98:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c9a:	89 1c 24             	mov    %ebx,(%esp)
+  800c9d:	e8 a8 fb ff ff       	call   80084a <close>
+	return r;
+  800ca2:	83 c4 10             	add    $0x10,%esp
+  800ca5:	89 f3                	mov    %esi,%ebx
+}
+  800ca7:	89 d8                	mov    %ebx,%eax
+  800ca9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5d                   	pop    %ebp
+  800caf:	c3                   	ret
+
+00800cb0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+  800cb5:	89 c6                	mov    %eax,%esi
+  800cb7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cb9:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cc0:	74 27                	je     800ce9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc2:	6a 07                	push   $0x7
+  800cc4:	68 00 70 80 00       	push   $0x807000
+  800cc9:	56                   	push   %esi
+  800cca:	ff 35 00 60 80 00    	push   0x806000
+  800cd0:	e8 51 36 00 00       	call   804326 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cd5:	83 c4 0c             	add    $0xc,%esp
+  800cd8:	6a 00                	push   $0x0
+  800cda:	53                   	push   %ebx
+  800cdb:	6a 00                	push   $0x0
+  800cdd:	e8 4e 35 00 00       	call   804230 <ipc_recv>
+}
+  800ce2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+  800cec:	6a 01                	push   $0x1
+  800cee:	e8 89 36 00 00       	call   80437c <ipc_find_env>
+  800cf3:	a3 00 60 80 00       	mov    %eax,0x806000
+  800cf8:	83 c4 10             	add    $0x10,%esp
+  800cfb:	eb c5                	jmp    800cc2 <fsipc+0x12>
+
+00800cfd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	53                   	push   %ebx
+  800d01:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d04:	68 04 60 80 00       	push   $0x806004
+  800d09:	e8 29 1b 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d11:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d14:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1c:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d26:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2b:	e8 80 ff ff ff       	call   800cb0 <fsipc>
+  800d30:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d32:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d39:	e8 66 1b 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+}
+  800d3e:	89 d8                	mov    %ebx,%eax
+  800d40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d43:	c9                   	leave
+  800d44:	c3                   	ret
+
+00800d45 <devfile_flush>:
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	53                   	push   %ebx
+  800d49:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d4c:	68 04 60 80 00       	push   $0x806004
+  800d51:	e8 e1 1a 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d59:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d5c:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d66:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6b:	e8 40 ff ff ff       	call   800cb0 <fsipc>
+  800d70:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d72:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d79:	e8 26 1b 00 00       	call   8028a4 <mutex_unlock>
+}
+  800d7e:	89 d8                	mov    %ebx,%eax
+  800d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d83:	c9                   	leave
+  800d84:	c3                   	ret
+
+00800d85 <devfile_stat>:
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+  800d8a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	68 04 60 80 00       	push   $0x806004
+  800d95:	e8 9d 1a 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800daf:	e8 fc fe ff ff       	call   800cb0 <fsipc>
+  800db4:	89 c3                	mov    %eax,%ebx
+  800db6:	83 c4 10             	add    $0x10,%esp
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	79 16                	jns    800dd3 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+  800dc0:	68 04 60 80 00       	push   $0x806004
+  800dc5:	e8 da 1a 00 00       	call   8028a4 <mutex_unlock>
+}
+  800dca:	89 d8                	mov    %ebx,%eax
+  800dcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcf:	5b                   	pop    %ebx
+  800dd0:	5e                   	pop    %esi
+  800dd1:	5d                   	pop    %ebp
+  800dd2:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dd3:	83 ec 08             	sub    $0x8,%esp
+  800dd6:	68 00 70 80 00       	push   $0x807000
+  800ddb:	56                   	push   %esi
+  800ddc:	e8 95 2a 00 00       	call   803876 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800de1:	a1 80 70 80 00       	mov    0x807080,%eax
+  800de6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dec:	a1 84 70 80 00       	mov    0x807084,%eax
+  800df1:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800df7:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800dfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dff:	eb bc                	jmp    800dbd <devfile_stat+0x38>
+
+00800e01 <devfile_write>:
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	53                   	push   %ebx
+  800e05:	83 ec 10             	sub    $0x10,%esp
+  800e08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e0b:	68 04 60 80 00       	push   $0x806004
+  800e10:	e8 22 1a 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e18:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e1b:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e20:	83 c4 10             	add    $0x10,%esp
+  800e23:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e29:	76 3d                	jbe    800e68 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e2b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e30:	39 c3                	cmp    %eax,%ebx
+  800e32:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e38:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e3d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e48:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e4d:	e8 5e fe ff ff       	call   800cb0 <fsipc>
+  800e52:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+  800e57:	68 04 60 80 00       	push   $0x806004
+  800e5c:	e8 43 1a 00 00       	call   8028a4 <mutex_unlock>
+}
+  800e61:	89 d8                	mov    %ebx,%eax
+  800e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e66:	c9                   	leave
+  800e67:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e68:	83 ec 04             	sub    $0x4,%esp
+  800e6b:	53                   	push   %ebx
+  800e6c:	ff 75 0c             	push   0xc(%ebp)
+  800e6f:	68 0c 70 80 00       	push   $0x80700c
+  800e74:	e8 83 2b 00 00       	call   8039fc <memmove>
+  800e79:	83 c4 10             	add    $0x10,%esp
+  800e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e81:	eb b5                	jmp    800e38 <devfile_write+0x37>
+
+00800e83 <devfile_read>:
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  800e8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e8f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800e95:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800e9b:	0f 86 8c 00 00 00    	jbe    800f2d <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800ea1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800ea6:	39 c3                	cmp    %eax,%ebx
+  800ea8:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800eab:	89 f8                	mov    %edi,%eax
+  800ead:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800eb0:	eb 0f                	jmp    800ec1 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800eb2:	0f b6 08             	movzbl (%eax),%ecx
+  800eb5:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800eb7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ebc:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ec1:	39 d0                	cmp    %edx,%eax
+  800ec3:	72 ed                	jb     800eb2 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+  800ec8:	68 04 60 80 00       	push   $0x806004
+  800ecd:	e8 65 19 00 00       	call   802837 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ed2:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ed5:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800eda:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800ee0:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eeb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ef0:	e8 bb fd ff ff       	call   800cb0 <fsipc>
+  800ef5:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800ef7:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800efe:	e8 a1 19 00 00       	call   8028a4 <mutex_unlock>
+		assert(r <= (int) n);
+  800f03:	83 c4 10             	add    $0x10,%esp
+  800f06:	39 f3                	cmp    %esi,%ebx
+  800f08:	7c 0a                	jl     800f14 <devfile_read+0x91>
+}
+  800f0a:	89 f0                	mov    %esi,%eax
+  800f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+		assert(r <= (int) n);
+  800f14:	68 88 47 80 00       	push   $0x804788
+  800f19:	68 95 47 80 00       	push   $0x804795
+  800f1e:	68 90 00 00 00       	push   $0x90
+  800f23:	68 aa 47 80 00       	push   $0x8047aa
+  800f28:	e8 8a 22 00 00       	call   8031b7 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+  800f30:	68 04 60 80 00       	push   $0x806004
+  800f35:	e8 fd 18 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f3a:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f3d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f42:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f48:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f4f:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f57:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f5c:	e8 4f fd ff ff       	call   800cb0 <fsipc>
+  800f61:	89 c6                	mov    %eax,%esi
+  800f63:	83 c4 10             	add    $0x10,%esp
+  800f66:	85 c0                	test   %eax,%eax
+  800f68:	78 1d                	js     800f87 <devfile_read+0x104>
+		assert(r <= n);
+  800f6a:	39 c3                	cmp    %eax,%ebx
+  800f6c:	72 2e                	jb     800f9c <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f6e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f73:	7f 40                	jg     800fb5 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f75:	83 ec 04             	sub    $0x4,%esp
+  800f78:	50                   	push   %eax
+  800f79:	68 00 70 80 00       	push   $0x807000
+  800f7e:	57                   	push   %edi
+  800f7f:	e8 78 2a 00 00       	call   8039fc <memmove>
+  800f84:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+  800f8a:	68 04 60 80 00       	push   $0x806004
+  800f8f:	e8 10 19 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+  800f94:	83 c4 10             	add    $0x10,%esp
+  800f97:	e9 6e ff ff ff       	jmp    800f0a <devfile_read+0x87>
+		assert(r <= n);
+  800f9c:	68 b5 47 80 00       	push   $0x8047b5
+  800fa1:	68 95 47 80 00       	push   $0x804795
+  800fa6:	68 99 00 00 00       	push   $0x99
+  800fab:	68 aa 47 80 00       	push   $0x8047aa
+  800fb0:	e8 02 22 00 00       	call   8031b7 <_panic>
+		assert(r <= PGSIZE);
+  800fb5:	68 bc 47 80 00       	push   $0x8047bc
+  800fba:	68 95 47 80 00       	push   $0x804795
+  800fbf:	68 9a 00 00 00       	push   $0x9a
+  800fc4:	68 aa 47 80 00       	push   $0x8047aa
+  800fc9:	e8 e9 21 00 00       	call   8031b7 <_panic>
+
+00800fce <open>:
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+  800fd3:	83 ec 1c             	sub    $0x1c,%esp
+  800fd6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fd9:	56                   	push   %esi
+  800fda:	e8 5c 28 00 00       	call   80383b <strlen>
+  800fdf:	83 c4 10             	add    $0x10,%esp
+  800fe2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe7:	0f 8f 85 00 00 00    	jg     801072 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ff3:	50                   	push   %eax
+  800ff4:	e8 a7 f6 ff ff       	call   8006a0 <fd_alloc>
+  800ff9:	89 c3                	mov    %eax,%ebx
+  800ffb:	83 c4 10             	add    $0x10,%esp
+  800ffe:	85 c0                	test   %eax,%eax
+  801000:	78 55                	js     801057 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801002:	83 ec 0c             	sub    $0xc,%esp
+  801005:	68 04 60 80 00       	push   $0x806004
+  80100a:	e8 28 18 00 00       	call   802837 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80100f:	83 c4 08             	add    $0x8,%esp
+  801012:	56                   	push   %esi
+  801013:	68 00 70 80 00       	push   $0x807000
+  801018:	e8 59 28 00 00       	call   803876 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80101d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801020:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801025:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801028:	b8 01 00 00 00       	mov    $0x1,%eax
+  80102d:	e8 7e fc ff ff       	call   800cb0 <fsipc>
+  801032:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801034:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80103b:	e8 64 18 00 00       	call   8028a4 <mutex_unlock>
+	if (r < 0) {
+  801040:	83 c4 10             	add    $0x10,%esp
+  801043:	85 db                	test   %ebx,%ebx
+  801045:	78 19                	js     801060 <open+0x92>
+	return fd2num(fd);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	ff 75 f4             	push   -0xc(%ebp)
+  80104d:	e8 27 f6 ff ff       	call   800679 <fd2num>
+  801052:	89 c3                	mov    %eax,%ebx
+  801054:	83 c4 10             	add    $0x10,%esp
+}
+  801057:	89 d8                	mov    %ebx,%eax
+  801059:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80105c:	5b                   	pop    %ebx
+  80105d:	5e                   	pop    %esi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+		fd_close(fd, 0);
+  801060:	83 ec 08             	sub    $0x8,%esp
+  801063:	6a 00                	push   $0x0
+  801065:	ff 75 f4             	push   -0xc(%ebp)
+  801068:	e8 56 f7 ff ff       	call   8007c3 <fd_close>
+		return r;
+  80106d:	83 c4 10             	add    $0x10,%esp
+  801070:	eb e5                	jmp    801057 <open+0x89>
+		return -E_BAD_PATH;
+  801072:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801077:	eb de                	jmp    801057 <open+0x89>
+
+00801079 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801080:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801083:	50                   	push   %eax
+  801084:	ff 75 08             	push   0x8(%ebp)
+  801087:	e8 6a f6 ff ff       	call   8006f6 <fd_lookup>
+  80108c:	89 c3                	mov    %eax,%ebx
+  80108e:	83 c4 10             	add    $0x10,%esp
+  801091:	85 c0                	test   %eax,%eax
+  801093:	78 5b                	js     8010f0 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801095:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801098:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80109e:	39 08                	cmp    %ecx,(%eax)
+  8010a0:	75 55                	jne    8010f7 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010a2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010a6:	74 56                	je     8010fe <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	68 04 60 80 00       	push   $0x806004
+  8010b0:	e8 82 17 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010bb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010c3:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010cb:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010da:	e8 d1 fb ff ff       	call   800cb0 <fsipc>
+  8010df:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010e1:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010e8:	e8 b7 17 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+  8010ed:	83 c4 10             	add    $0x10,%esp
+}
+  8010f0:	89 d8                	mov    %ebx,%eax
+  8010f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f5:	c9                   	leave
+  8010f6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010f7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8010fc:	eb f2                	jmp    8010f0 <fallocate+0x77>
+		return -E_INVAL;
+  8010fe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801103:	eb eb                	jmp    8010f0 <fallocate+0x77>
+
+00801105 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+  80110a:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80110d:	89 f3                	mov    %esi,%ebx
+  80110f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801115:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801118:	eb 06                	jmp    801120 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80111a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801120:	39 f3                	cmp    %esi,%ebx
+  801122:	73 14                	jae    801138 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801124:	83 ec 08             	sub    $0x8,%esp
+  801127:	53                   	push   %ebx
+  801128:	6a 00                	push   $0x0
+  80112a:	e8 41 f1 ff ff       	call   800270 <sys_page_unmap>
+  80112f:	83 c4 10             	add    $0x10,%esp
+  801132:	85 c0                	test   %eax,%eax
+  801134:	79 e4                	jns    80111a <munmap+0x15>
+  801136:	eb 05                	jmp    80113d <munmap+0x38>
+			return r;
+	return 0;
+  801138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80113d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+
+00801144 <mmap>:
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+  80114a:	83 ec 24             	sub    $0x24,%esp
+  80114d:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801150:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801153:	50                   	push   %eax
+  801154:	ff 75 08             	push   0x8(%ebp)
+  801157:	e8 9a f5 ff ff       	call   8006f6 <fd_lookup>
+  80115c:	83 c4 10             	add    $0x10,%esp
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	0f 88 37 01 00 00    	js     80129e <mmap+0x15a>
+		return NULL;
+  801167:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80116c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80116f:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801175:	39 0a                	cmp    %ecx,(%edx)
+  801177:	0f 85 05 01 00 00    	jne    801282 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80117d:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801184:	0f 85 1b 01 00 00    	jne    8012a5 <mmap+0x161>
+  80118a:	89 f0                	mov    %esi,%eax
+  80118c:	83 e8 01             	sub    $0x1,%eax
+  80118f:	0f 88 17 01 00 00    	js     8012ac <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801195:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801199:	75 28                	jne    8011c3 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	68 04 60 80 00       	push   $0x806004
+  8011a3:	e8 8f 16 00 00       	call   802837 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011a8:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011ae:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011b4:	83 c4 10             	add    $0x10,%esp
+  8011b7:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011bc:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011c1:	eb 2b                	jmp    8011ee <mmap+0xaa>
+		cow_enable();
+  8011c3:	e8 f7 2b 00 00       	call   803dbf <cow_enable>
+  8011c8:	eb d1                	jmp    80119b <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011ca:	89 c2                	mov    %eax,%edx
+  8011cc:	c1 ea 0c             	shr    $0xc,%edx
+  8011cf:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011d6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011dc:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011e2:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011e5:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011e7:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011ec:	77 25                	ja     801213 <mmap+0xcf>
+  8011ee:	89 c2                	mov    %eax,%edx
+  8011f0:	29 da                	sub    %ebx,%edx
+  8011f2:	39 ca                	cmp    %ecx,%edx
+  8011f4:	73 3a                	jae    801230 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8011f6:	89 c2                	mov    %eax,%edx
+  8011f8:	c1 ea 16             	shr    $0x16,%edx
+  8011fb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801202:	f6 c2 01             	test   $0x1,%dl
+  801205:	75 c3                	jne    8011ca <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801207:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80120c:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801211:	eb d4                	jmp    8011e7 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801213:	29 d8                	sub    %ebx,%eax
+  801215:	39 c8                	cmp    %ecx,%eax
+  801217:	73 17                	jae    801230 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801219:	83 ec 0c             	sub    $0xc,%esp
+  80121c:	68 04 60 80 00       	push   $0x806004
+  801221:	e8 7e 16 00 00       	call   8028a4 <mutex_unlock>
+		return NULL;
+  801226:	83 c4 10             	add    $0x10,%esp
+  801229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122e:	eb 52                	jmp    801282 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801230:	85 db                	test   %ebx,%ebx
+  801232:	74 e5                	je     801219 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801234:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801237:	8b 40 0c             	mov    0xc(%eax),%eax
+  80123a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80123f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801242:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801247:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  80124d:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801253:	8b 45 14             	mov    0x14(%ebp),%eax
+  801256:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80125b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801260:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801265:	e8 46 fa ff ff       	call   800cb0 <fsipc>
+  80126a:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	68 04 60 80 00       	push   $0x806004
+  801274:	e8 2b 16 00 00       	call   8028a4 <mutex_unlock>
+	if (r < 0) {
+  801279:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80127c:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80127e:	85 ff                	test   %edi,%edi
+  801280:	78 08                	js     80128a <mmap+0x146>
+}
+  801282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+		munmap((void*) va, len);
+  80128a:	83 ec 08             	sub    $0x8,%esp
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+  80128f:	e8 71 fe ff ff       	call   801105 <munmap>
+		return NULL;
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129c:	eb e4                	jmp    801282 <mmap+0x13e>
+		return NULL;
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	eb dd                	jmp    801282 <mmap+0x13e>
+		return NULL;
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012aa:	eb d6                	jmp    801282 <mmap+0x13e>
+  8012ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b1:	eb cf                	jmp    801282 <mmap+0x13e>
+
+008012b3 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	53                   	push   %ebx
+  8012b7:	83 ec 10             	sub    $0x10,%esp
+  8012ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012bd:	53                   	push   %ebx
+  8012be:	e8 78 25 00 00       	call   80383b <strlen>
+  8012c3:	83 c4 10             	add    $0x10,%esp
+  8012c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012cb:	7f 42                	jg     80130f <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012cd:	83 ec 0c             	sub    $0xc,%esp
+  8012d0:	68 04 60 80 00       	push   $0x806004
+  8012d5:	e8 5d 15 00 00       	call   802837 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012da:	83 c4 08             	add    $0x8,%esp
+  8012dd:	53                   	push   %ebx
+  8012de:	68 00 70 80 00       	push   $0x807000
+  8012e3:	e8 8e 25 00 00       	call   803876 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ed:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012f2:	e8 b9 f9 ff ff       	call   800cb0 <fsipc>
+  8012f7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8012f9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801300:	e8 9f 15 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+  801305:	83 c4 10             	add    $0x10,%esp
+}
+  801308:	89 d8                	mov    %ebx,%eax
+  80130a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+		return -E_BAD_PATH;
+  80130f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801314:	eb f2                	jmp    801308 <remove+0x55>
+
+00801316 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80131d:	68 04 60 80 00       	push   $0x806004
+  801322:	e8 10 15 00 00       	call   802837 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801331:	e8 7a f9 ff ff       	call   800cb0 <fsipc>
+  801336:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801338:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80133f:	e8 60 15 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+}
+  801344:	89 d8                	mov    %ebx,%eax
+  801346:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801349:	c9                   	leave
+  80134a:	c3                   	ret
+
+0080134b <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+  801350:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801353:	83 ec 0c             	sub    $0xc,%esp
+  801356:	68 04 60 80 00       	push   $0x806004
+  80135b:	e8 d7 14 00 00       	call   802837 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801360:	8b 45 08             	mov    0x8(%ebp),%eax
+  801363:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801372:	e8 39 f9 ff ff       	call   800cb0 <fsipc>
+  801377:	89 c6                	mov    %eax,%esi
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	85 db                	test   %ebx,%ebx
+  80137e:	74 7b                	je     8013fb <fs_bcstat+0xb0>
+  801380:	85 c0                	test   %eax,%eax
+  801382:	78 77                	js     8013fb <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801384:	a1 00 70 80 00       	mov    0x807000,%eax
+  801389:	89 03                	mov    %eax,(%ebx)
+  80138b:	a1 04 70 80 00       	mov    0x807004,%eax
+  801390:	89 43 04             	mov    %eax,0x4(%ebx)
+  801393:	a1 08 70 80 00       	mov    0x807008,%eax
+  801398:	89 43 08             	mov    %eax,0x8(%ebx)
+  80139b:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013a0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013a3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013ab:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013b0:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013b3:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013b8:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013bb:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013c0:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013c3:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013c8:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013cb:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013d0:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013d3:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013d8:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013db:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013e0:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013e3:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013e8:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013eb:	a1 34 70 80 00       	mov    0x807034,%eax
+  8013f0:	89 43 34             	mov    %eax,0x34(%ebx)
+  8013f3:	a1 38 70 80 00       	mov    0x807038,%eax
+  8013f8:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	68 04 60 80 00       	push   $0x806004
+  801403:	e8 9c 14 00 00       	call   8028a4 <mutex_unlock>
+	return r;
+}
+  801408:	89 f0                	mov    %esi,%eax
+  80140a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5d                   	pop    %ebp
+  801410:	c3                   	ret
+
+00801411 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801411:	55                   	push   %ebp
+  801412:	89 e5                	mov    %esp,%ebp
+  801414:	56                   	push   %esi
+  801415:	53                   	push   %ebx
+  801416:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801418:	0f b6 10             	movzbl (%eax),%edx
+  80141b:	80 fa 72             	cmp    $0x72,%dl
+  80141e:	74 44                	je     801464 <parse_mode+0x53>
+  801420:	80 fa 77             	cmp    $0x77,%dl
+  801423:	74 4b                	je     801470 <parse_mode+0x5f>
+  801425:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80142a:	80 fa 61             	cmp    $0x61,%dl
+  80142d:	74 09                	je     801438 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80142f:	89 d8                	mov    %ebx,%eax
+  801431:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5d                   	pop    %ebp
+  801437:	c3                   	ret
+	switch (mode[0]) {
+  801438:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80143d:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801442:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801444:	83 ec 08             	sub    $0x8,%esp
+  801447:	6a 2b                	push   $0x2b
+  801449:	50                   	push   %eax
+  80144a:	e8 39 25 00 00       	call   803988 <strchr>
+  80144f:	83 c4 10             	add    $0x10,%esp
+  801452:	85 c0                	test   %eax,%eax
+  801454:	74 d9                	je     80142f <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801456:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801459:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80145c:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801462:	eb cb                	jmp    80142f <parse_mode+0x1e>
+	switch (mode[0]) {
+  801464:	ba 01 00 00 00       	mov    $0x1,%edx
+  801469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146e:	eb d2                	jmp    801442 <parse_mode+0x31>
+  801470:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801475:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80147a:	eb c6                	jmp    801442 <parse_mode+0x31>
+
+0080147c <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	57                   	push   %edi
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+  801482:	83 ec 1c             	sub    $0x1c,%esp
+  801485:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801488:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80148b:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801490:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801495:	83 c0 24             	add    $0x24,%eax
+  801498:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80149c:	74 17                	je     8014b5 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80149e:	83 c3 01             	add    $0x1,%ebx
+  8014a1:	83 fb 10             	cmp    $0x10,%ebx
+  8014a4:	75 ef                	jne    801495 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014a6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014ab:	89 f0                	mov    %esi,%eax
+  8014ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b0:	5b                   	pop    %ebx
+  8014b1:	5e                   	pop    %esi
+  8014b2:	5f                   	pop    %edi
+  8014b3:	5d                   	pop    %ebp
+  8014b4:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014b5:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014bc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014bf:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014c2:	c1 e7 02             	shl    $0x2,%edi
+  8014c5:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014cb:	83 ec 04             	sub    $0x4,%esp
+  8014ce:	6a 24                	push   $0x24
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	56                   	push   %esi
+  8014d3:	e8 ef 24 00 00       	call   8039c7 <memset>
+			streams[i].f_fd = fd;
+  8014d8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014db:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014e1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014e4:	01 d8                	add    %ebx,%eax
+  8014e6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014e9:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	eb b6                	jmp    8014ab <stream_alloc+0x2f>
+
+008014f5 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8014f5:	55                   	push   %ebp
+  8014f6:	89 e5                	mov    %esp,%ebp
+  8014f8:	53                   	push   %ebx
+  8014f9:	83 ec 14             	sub    $0x14,%esp
+  8014fc:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8014fe:	8b 40 18             	mov    0x18(%eax),%eax
+  801501:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801504:	74 4a                	je     801550 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801506:	83 ec 08             	sub    $0x8,%esp
+  801509:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150c:	50                   	push   %eax
+  80150d:	ff 33                	push   (%ebx)
+  80150f:	e8 e2 f1 ff ff       	call   8006f6 <fd_lookup>
+  801514:	89 c2                	mov    %eax,%edx
+  801516:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801519:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80151e:	85 d2                	test   %edx,%edx
+  801520:	78 41                	js     801563 <stream_unread+0x6e>
+  801522:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801525:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80152b:	39 0a                	cmp    %ecx,(%edx)
+  80152d:	75 34                	jne    801563 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80152f:	8b 43 14             	mov    0x14(%ebx),%eax
+  801532:	03 42 04             	add    0x4(%edx),%eax
+  801535:	2b 43 18             	sub    0x18(%ebx),%eax
+  801538:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80153b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801542:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801549:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154e:	eb 13                	jmp    801563 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801550:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801557:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80155e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801563:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801566:	c9                   	leave
+  801567:	c3                   	ret
+
+00801568 <stream_drain>:
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+  80156d:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80156f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801574:	eb 02                	jmp    801578 <stream_drain+0x10>
+  801576:	01 c3                	add    %eax,%ebx
+  801578:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80157b:	39 c3                	cmp    %eax,%ebx
+  80157d:	73 43                	jae    8015c2 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80157f:	83 ec 04             	sub    $0x4,%esp
+  801582:	29 d8                	sub    %ebx,%eax
+  801584:	50                   	push   %eax
+  801585:	89 d8                	mov    %ebx,%eax
+  801587:	03 46 0c             	add    0xc(%esi),%eax
+  80158a:	50                   	push   %eax
+  80158b:	ff 36                	push   (%esi)
+  80158d:	e8 ec f4 ff ff       	call   800a7e <write>
+  801592:	83 c4 10             	add    $0x10,%esp
+  801595:	85 c0                	test   %eax,%eax
+  801597:	7f dd                	jg     801576 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801599:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80159d:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015a0:	83 ec 04             	sub    $0x4,%esp
+  8015a3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015a6:	29 d8                	sub    %ebx,%eax
+  8015a8:	50                   	push   %eax
+  8015a9:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015ac:	50                   	push   %eax
+  8015ad:	52                   	push   %edx
+  8015ae:	e8 49 24 00 00       	call   8039fc <memmove>
+			f->f_wend -= done;
+  8015b3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015b6:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015c0:	eb 0a                	jmp    8015cc <stream_drain+0x64>
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015c7:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015cc:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015cf:	89 d0                	mov    %edx,%eax
+  8015d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d4:	5b                   	pop    %ebx
+  8015d5:	5e                   	pop    %esi
+  8015d6:	5d                   	pop    %ebp
+  8015d7:	c3                   	ret
+
+008015d8 <stream_setup>:
+	if (f->f_buf)
+  8015d8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015dc:	74 01                	je     8015df <stream_setup+0x7>
+  8015de:	c3                   	ret
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	53                   	push   %ebx
+  8015e3:	83 ec 04             	sub    $0x4,%esp
+  8015e6:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015e8:	8b 40 08             	mov    0x8(%eax),%eax
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	74 17                	je     801606 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015ef:	83 f8 03             	cmp    $0x3,%eax
+  8015f2:	75 2d                	jne    801621 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8015f4:	8d 43 20             	lea    0x20(%ebx),%eax
+  8015f7:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8015fa:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801606:	83 ec 0c             	sub    $0xc,%esp
+  801609:	ff 33                	push   (%ebx)
+  80160b:	e8 29 1b 00 00       	call   803139 <iscons>
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	85 c0                	test   %eax,%eax
+  801615:	0f 9f c0             	setg   %al
+  801618:	0f b6 c0             	movzbl %al,%eax
+  80161b:	83 c0 01             	add    $0x1,%eax
+  80161e:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801621:	83 ec 0c             	sub    $0xc,%esp
+  801624:	68 00 10 00 00       	push   $0x1000
+  801629:	e8 6e 0b 00 00       	call   80219c <malloc>
+  80162e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	85 c0                	test   %eax,%eax
+  801636:	74 bc                	je     8015f4 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801638:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80163f:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801643:	eb bc                	jmp    801601 <stream_setup+0x29>
+
+00801645 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	53                   	push   %ebx
+  801649:	83 ec 04             	sub    $0x4,%esp
+  80164c:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80164e:	e8 85 ff ff ff       	call   8015d8 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801653:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801658:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80165c:	74 3d                	je     80169b <stream_fill+0x56>
+  80165e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801662:	74 10                	je     801674 <stream_fill+0x2f>
+  801664:	89 d8                	mov    %ebx,%eax
+  801666:	e8 fd fe ff ff       	call   801568 <stream_drain>
+		return 0;
+  80166b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801670:	85 c0                	test   %eax,%eax
+  801672:	78 27                	js     80169b <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801674:	83 ec 04             	sub    $0x4,%esp
+  801677:	ff 73 10             	push   0x10(%ebx)
+  80167a:	ff 73 0c             	push   0xc(%ebx)
+  80167d:	ff 33                	push   (%ebx)
+  80167f:	e8 02 f3 ff ff       	call   800986 <read>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	7e 17                	jle    8016a2 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80168b:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80168f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  801696:	89 c2                	mov    %eax,%edx
+  801698:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80169b:	89 d0                	mov    %edx,%eax
+  80169d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016a2:	c1 f8 1f             	sar    $0x1f,%eax
+  8016a5:	83 e0 04             	and    $0x4,%eax
+  8016a8:	83 c0 04             	add    $0x4,%eax
+  8016ab:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b3:	eb e6                	jmp    80169b <stream_fill+0x56>
+
+008016b5 <fopen>:
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	57                   	push   %edi
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+  8016bb:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016c4:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016ca:	89 f0                	mov    %esi,%eax
+  8016cc:	e8 40 fd ff ff       	call   801411 <parse_mode>
+		return 0;
+  8016d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 2d                	js     801707 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016da:	83 ec 08             	sub    $0x8,%esp
+  8016dd:	50                   	push   %eax
+  8016de:	ff 75 08             	push   0x8(%ebp)
+  8016e1:	e8 e8 f8 ff ff       	call   800fce <open>
+  8016e6:	89 c7                	mov    %eax,%edi
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 58                	js     801747 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016ef:	80 3e 61             	cmpb   $0x61,(%esi)
+  8016f2:	74 1d                	je     801711 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8016f4:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8016fa:	89 f8                	mov    %edi,%eax
+  8016fc:	e8 7b fd ff ff       	call   80147c <stream_alloc>
+  801701:	89 c3                	mov    %eax,%ebx
+  801703:	85 c0                	test   %eax,%eax
+  801705:	74 32                	je     801739 <fopen+0x84>
+}
+  801707:	89 d8                	mov    %ebx,%eax
+  801709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170c:	5b                   	pop    %ebx
+  80170d:	5e                   	pop    %esi
+  80170e:	5f                   	pop    %edi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801711:	83 ec 08             	sub    $0x8,%esp
+  801714:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	57                   	push   %edi
+  80171c:	e8 db f4 ff ff       	call   800bfc <fstat>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 cc                	js     8016f4 <fopen+0x3f>
+		seek(fd, st.st_size);
+  801728:	83 ec 08             	sub    $0x8,%esp
+  80172b:	ff 75 dc             	push   -0x24(%ebp)
+  80172e:	57                   	push   %edi
+  80172f:	e8 f6 f3 ff ff       	call   800b2a <seek>
+  801734:	83 c4 10             	add    $0x10,%esp
+  801737:	eb bb                	jmp    8016f4 <fopen+0x3f>
+		close(fd);
+  801739:	83 ec 0c             	sub    $0xc,%esp
+  80173c:	57                   	push   %edi
+  80173d:	e8 08 f1 ff ff       	call   80084a <close>
+  801742:	83 c4 10             	add    $0x10,%esp
+  801745:	eb c0                	jmp    801707 <fopen+0x52>
+		return 0;
+  801747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174c:	eb b9                	jmp    801707 <fopen+0x52>
+
+0080174e <fdopen>:
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801754:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801757:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80175a:	e8 b2 fc ff ff       	call   801411 <parse_mode>
+  80175f:	89 c2                	mov    %eax,%edx
+		return 0;
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801766:	85 d2                	test   %edx,%edx
+  801768:	78 0b                	js     801775 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80176a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80176d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801770:	e8 07 fd ff ff       	call   80147c <stream_alloc>
+}
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+00801777 <setvbuf>:
+{
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	57                   	push   %edi
+  80177b:	56                   	push   %esi
+  80177c:	53                   	push   %ebx
+  80177d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801780:	8b 55 10             	mov    0x10(%ebp),%edx
+  801783:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801786:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80178a:	75 3a                	jne    8017c6 <setvbuf+0x4f>
+  80178c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80178f:	83 fe 02             	cmp    $0x2,%esi
+  801792:	77 39                	ja     8017cd <setvbuf+0x56>
+	f->f_bufmode = mode;
+  801794:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  801797:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80179b:	0f 95 c3             	setne  %bl
+  80179e:	85 ff                	test   %edi,%edi
+  8017a0:	0f 95 c1             	setne  %cl
+  8017a3:	84 cb                	test   %cl,%bl
+  8017a5:	74 05                	je     8017ac <setvbuf+0x35>
+  8017a7:	83 fa 03             	cmp    $0x3,%edx
+  8017aa:	75 0a                	jne    8017b6 <setvbuf+0x3f>
+	return 0;
+  8017ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b1:	5b                   	pop    %ebx
+  8017b2:	5e                   	pop    %esi
+  8017b3:	5f                   	pop    %edi
+  8017b4:	5d                   	pop    %ebp
+  8017b5:	c3                   	ret
+		f->f_buf = buf;
+  8017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b9:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017bc:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c4:	eb eb                	jmp    8017b1 <setvbuf+0x3a>
+		return EOF;
+  8017c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017cb:	eb e4                	jmp    8017b1 <setvbuf+0x3a>
+  8017cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017d2:	eb dd                	jmp    8017b1 <setvbuf+0x3a>
+
+008017d4 <fflush>:
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	57                   	push   %edi
+  8017d8:	56                   	push   %esi
+  8017d9:	53                   	push   %ebx
+  8017da:	83 ec 0c             	sub    $0xc,%esp
+  8017dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017e0:	85 db                	test   %ebx,%ebx
+  8017e2:	74 1a                	je     8017fe <fflush+0x2a>
+	stream_unread(f);
+  8017e4:	89 d8                	mov    %ebx,%eax
+  8017e6:	e8 0a fd ff ff       	call   8014f5 <stream_unread>
+	return stream_drain(f);
+  8017eb:	89 d8                	mov    %ebx,%eax
+  8017ed:	e8 76 fd ff ff       	call   801568 <stream_drain>
+  8017f2:	89 c7                	mov    %eax,%edi
+}
+  8017f4:	89 f8                	mov    %edi,%eax
+  8017f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f9:	5b                   	pop    %ebx
+  8017fa:	5e                   	pop    %esi
+  8017fb:	5f                   	pop    %edi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+  8017fe:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801803:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801808:	bf 00 00 00 00       	mov    $0x0,%edi
+  80180d:	eb 03                	jmp    801812 <fflush+0x3e>
+  80180f:	83 c3 24             	add    $0x24,%ebx
+  801812:	39 f3                	cmp    %esi,%ebx
+  801814:	74 de                	je     8017f4 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801816:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80181a:	74 f3                	je     80180f <fflush+0x3b>
+  80181c:	83 ec 0c             	sub    $0xc,%esp
+  80181f:	53                   	push   %ebx
+  801820:	e8 af ff ff ff       	call   8017d4 <fflush>
+  801825:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801828:	85 c0                	test   %eax,%eax
+  80182a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80182f:	0f 48 f8             	cmovs  %eax,%edi
+  801832:	eb db                	jmp    80180f <fflush+0x3b>
+
+00801834 <fclose>:
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	56                   	push   %esi
+  801838:	53                   	push   %ebx
+  801839:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80183c:	83 ec 0c             	sub    $0xc,%esp
+  80183f:	56                   	push   %esi
+  801840:	e8 8f ff ff ff       	call   8017d4 <fflush>
+  801845:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801847:	83 c4 04             	add    $0x4,%esp
+  80184a:	ff 36                	push   (%esi)
+  80184c:	e8 f9 ef ff ff       	call   80084a <close>
+  801851:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801854:	85 c0                	test   %eax,%eax
+  801856:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80185b:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80185e:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  801862:	75 10                	jne    801874 <fclose+0x40>
+	f->f_flags = 0;
+  801864:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80186b:	89 d8                	mov    %ebx,%eax
+  80186d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801870:	5b                   	pop    %ebx
+  801871:	5e                   	pop    %esi
+  801872:	5d                   	pop    %ebp
+  801873:	c3                   	ret
+		free(f->f_buf);
+  801874:	83 ec 0c             	sub    $0xc,%esp
+  801877:	ff 76 0c             	push   0xc(%esi)
+  80187a:	e8 54 08 00 00       	call   8020d3 <free>
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	eb e0                	jmp    801864 <fclose+0x30>
+
+00801884 <fileno>:
+{
+  801884:	55                   	push   %ebp
+  801885:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188a:	8b 00                	mov    (%eax),%eax
+}
+  80188c:	5d                   	pop    %ebp
+  80188d:	c3                   	ret
+
+0080188e <feof>:
+{
+  80188e:	55                   	push   %ebp
+  80188f:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  801891:	8b 45 08             	mov    0x8(%ebp),%eax
+  801894:	8b 40 04             	mov    0x4(%eax),%eax
+  801897:	c1 e8 02             	shr    $0x2,%eax
+  80189a:	83 e0 01             	and    $0x1,%eax
+}
+  80189d:	5d                   	pop    %ebp
+  80189e:	c3                   	ret
+
+0080189f <ferror>:
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a5:	8b 40 04             	mov    0x4(%eax),%eax
+  8018a8:	c1 e8 03             	shr    $0x3,%eax
+  8018ab:	83 e0 01             	and    $0x1,%eax
+}
+  8018ae:	5d                   	pop    %ebp
+  8018af:	c3                   	ret
+
+008018b0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	53                   	push   %ebx
+  8018b4:	83 ec 04             	sub    $0x4,%esp
+  8018b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018ba:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018bd:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018c0:	74 15                	je     8018d7 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018c2:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018c5:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018c8:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018cb:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018ce:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d5:	c9                   	leave
+  8018d6:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018d7:	89 d8                	mov    %ebx,%eax
+  8018d9:	e8 67 fd ff ff       	call   801645 <stream_fill>
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	75 e0                	jne    8018c2 <fgetc+0x12>
+		return EOF;
+  8018e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018e7:	eb e9                	jmp    8018d2 <fgetc+0x22>
+
+008018e9 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	57                   	push   %edi
+  8018ed:	56                   	push   %esi
+  8018ee:	53                   	push   %ebx
+  8018ef:	83 ec 1c             	sub    $0x1c,%esp
+  8018f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8018f5:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8018fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018fd:	83 e8 01             	sub    $0x1,%eax
+  801900:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801903:	eb 66                	jmp    80196b <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801905:	8b 46 14             	mov    0x14(%esi),%eax
+  801908:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80190b:	29 c3                	sub    %eax,%ebx
+  80190d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801910:	29 fa                	sub    %edi,%edx
+  801912:	39 d3                	cmp    %edx,%ebx
+  801914:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801917:	83 ec 04             	sub    $0x4,%esp
+  80191a:	53                   	push   %ebx
+  80191b:	6a 0a                	push   $0xa
+  80191d:	03 46 0c             	add    0xc(%esi),%eax
+  801920:	50                   	push   %eax
+  801921:	e8 87 21 00 00       	call   803aad <memfind>
+  801926:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801929:	8b 46 0c             	mov    0xc(%esi),%eax
+  80192c:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80192f:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801932:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80193a:	74 0b                	je     801947 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80193c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80193f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801942:	29 d3                	sub    %edx,%ebx
+  801944:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801947:	83 ec 04             	sub    $0x4,%esp
+  80194a:	53                   	push   %ebx
+  80194b:	01 c8                	add    %ecx,%eax
+  80194d:	50                   	push   %eax
+  80194e:	89 f8                	mov    %edi,%eax
+  801950:	03 45 08             	add    0x8(%ebp),%eax
+  801953:	50                   	push   %eax
+  801954:	e8 a3 20 00 00       	call   8039fc <memmove>
+		f->f_rpos += m;
+  801959:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80195c:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	8b 45 08             	mov    0x8(%ebp),%eax
+  801964:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801969:	74 1f                	je     80198a <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80196b:	8d 47 01             	lea    0x1(%edi),%eax
+  80196e:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801971:	73 17                	jae    80198a <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801973:	8b 46 18             	mov    0x18(%esi),%eax
+  801976:	39 46 14             	cmp    %eax,0x14(%esi)
+  801979:	75 8a                	jne    801905 <fgets+0x1c>
+  80197b:	89 f0                	mov    %esi,%eax
+  80197d:	e8 c3 fc ff ff       	call   801645 <stream_fill>
+  801982:	85 c0                	test   %eax,%eax
+  801984:	0f 85 7b ff ff ff    	jne    801905 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80198a:	85 ff                	test   %edi,%edi
+  80198c:	74 0f                	je     80199d <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  801995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801998:	5b                   	pop    %ebx
+  801999:	5e                   	pop    %esi
+  80199a:	5f                   	pop    %edi
+  80199b:	5d                   	pop    %ebp
+  80199c:	c3                   	ret
+		return 0;
+  80199d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a2:	eb f1                	jmp    801995 <fgets+0xac>
+
+008019a4 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	57                   	push   %edi
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 1c             	sub    $0x1c,%esp
+  8019ad:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019b0:	89 f0                	mov    %esi,%eax
+  8019b2:	e8 21 fc ff ff       	call   8015d8 <stream_setup>
+	want = size * n;
+  8019b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ba:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c6:	eb 43                	jmp    801a0b <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019c8:	29 d3                	sub    %edx,%ebx
+  8019ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019cd:	29 f8                	sub    %edi,%eax
+  8019cf:	39 c3                	cmp    %eax,%ebx
+  8019d1:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019d4:	83 ec 04             	sub    $0x4,%esp
+  8019d7:	53                   	push   %ebx
+  8019d8:	03 56 0c             	add    0xc(%esi),%edx
+  8019db:	52                   	push   %edx
+  8019dc:	89 f8                	mov    %edi,%eax
+  8019de:	03 45 08             	add    0x8(%ebp),%eax
+  8019e1:	50                   	push   %eax
+  8019e2:	e8 15 20 00 00       	call   8039fc <memmove>
+			f->f_rpos += m;
+  8019e7:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	eb 1a                	jmp    801a09 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019ef:	83 ec 04             	sub    $0x4,%esp
+  8019f2:	53                   	push   %ebx
+  8019f3:	89 f8                	mov    %edi,%eax
+  8019f5:	03 45 08             	add    0x8(%ebp),%eax
+  8019f8:	50                   	push   %eax
+  8019f9:	ff 36                	push   (%esi)
+  8019fb:	e8 86 ef ff ff       	call   800986 <read>
+  801a00:	89 c3                	mov    %eax,%ebx
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	7e 36                	jle    801a3f <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a09:	01 df                	add    %ebx,%edi
+  801a0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a0e:	39 c7                	cmp    %eax,%edi
+  801a10:	73 39                	jae    801a4b <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a12:	8b 56 14             	mov    0x14(%esi),%edx
+  801a15:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a18:	39 da                	cmp    %ebx,%edx
+  801a1a:	72 ac                	jb     8019c8 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a1c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a1f:	29 fb                	sub    %edi,%ebx
+  801a21:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a24:	72 3e                	jb     801a64 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a26:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a2a:	74 1f                	je     801a4b <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a2c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a30:	74 bd                	je     8019ef <fread+0x4b>
+  801a32:	89 f0                	mov    %esi,%eax
+  801a34:	e8 2f fb ff ff       	call   801568 <stream_drain>
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	79 b2                	jns    8019ef <fread+0x4b>
+  801a3d:	eb 0c                	jmp    801a4b <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a3f:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a42:	83 e3 04             	and    $0x4,%ebx
+  801a45:	83 c3 04             	add    $0x4,%ebx
+  801a48:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	74 0a                	je     801a5c <fread+0xb8>
+  801a52:	89 f8                	mov    %edi,%eax
+  801a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a59:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5f:	5b                   	pop    %ebx
+  801a60:	5e                   	pop    %esi
+  801a61:	5f                   	pop    %edi
+  801a62:	5d                   	pop    %ebp
+  801a63:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a64:	89 f0                	mov    %esi,%eax
+  801a66:	e8 da fb ff ff       	call   801645 <stream_fill>
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	74 dc                	je     801a4b <fread+0xa7>
+			m = 0;
+  801a6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a74:	eb 93                	jmp    801a09 <fread+0x65>
+
+00801a76 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  801a79:	57                   	push   %edi
+  801a7a:	56                   	push   %esi
+  801a7b:	53                   	push   %ebx
+  801a7c:	83 ec 1c             	sub    $0x1c,%esp
+  801a7f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a82:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a85:	a8 02                	test   $0x2,%al
+  801a87:	75 13                	jne    801a9c <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a89:	83 c8 08             	or     $0x8,%eax
+  801a8c:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a97:	5b                   	pop    %ebx
+  801a98:	5e                   	pop    %esi
+  801a99:	5f                   	pop    %edi
+  801a9a:	5d                   	pop    %ebp
+  801a9b:	c3                   	ret
+	stream_setup(f);
+  801a9c:	89 d8                	mov    %ebx,%eax
+  801a9e:	e8 35 fb ff ff       	call   8015d8 <stream_setup>
+	want = size * n;
+  801aa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa6:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aaa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801aad:	89 d8                	mov    %ebx,%eax
+  801aaf:	e8 41 fa ff ff       	call   8014f5 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ab9:	84 c0                	test   %al,%al
+  801abb:	75 7b                	jne    801b38 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801abd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ac5:	39 fe                	cmp    %edi,%esi
+  801ac7:	73 24                	jae    801aed <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ac9:	83 ec 04             	sub    $0x4,%esp
+  801acc:	89 f8                	mov    %edi,%eax
+  801ace:	29 f0                	sub    %esi,%eax
+  801ad0:	50                   	push   %eax
+  801ad1:	89 f0                	mov    %esi,%eax
+  801ad3:	03 45 08             	add    0x8(%ebp),%eax
+  801ad6:	50                   	push   %eax
+  801ad7:	ff 33                	push   (%ebx)
+  801ad9:	e8 a0 ef ff ff       	call   800a7e <write>
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	7e 04                	jle    801ae9 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801ae5:	01 c6                	add    %eax,%esi
+  801ae7:	eb dc                	jmp    801ac5 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801ae9:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801aed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	74 a0                	je     801a94 <fwrite+0x1e>
+  801af4:	89 f0                	mov    %esi,%eax
+  801af6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afb:	f7 75 0c             	divl   0xc(%ebp)
+  801afe:	eb 94                	jmp    801a94 <fwrite+0x1e>
+			done += r;
+  801b00:	01 c7                	add    %eax,%edi
+			continue;
+  801b02:	eb 34                	jmp    801b38 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b04:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b07:	29 c6                	sub    %eax,%esi
+  801b09:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b0c:	29 fa                	sub    %edi,%edx
+  801b0e:	39 d6                	cmp    %edx,%esi
+  801b10:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b13:	83 ec 04             	sub    $0x4,%esp
+  801b16:	56                   	push   %esi
+  801b17:	89 fa                	mov    %edi,%edx
+  801b19:	03 55 08             	add    0x8(%ebp),%edx
+  801b1c:	52                   	push   %edx
+  801b1d:	03 43 0c             	add    0xc(%ebx),%eax
+  801b20:	50                   	push   %eax
+  801b21:	e8 d6 1e 00 00       	call   8039fc <memmove>
+		f->f_wend += m;
+  801b26:	89 f0                	mov    %esi,%eax
+  801b28:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b2b:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b2e:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b36:	74 5b                	je     801b93 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b3b:	39 c7                	cmp    %eax,%edi
+  801b3d:	73 2d                	jae    801b6c <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b3f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	75 be                	jne    801b04 <fwrite+0x8e>
+  801b46:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b49:	29 fa                	sub    %edi,%edx
+  801b4b:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b4e:	72 b4                	jb     801b04 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b50:	83 ec 04             	sub    $0x4,%esp
+  801b53:	52                   	push   %edx
+  801b54:	89 f8                	mov    %edi,%eax
+  801b56:	03 45 08             	add    0x8(%ebp),%eax
+  801b59:	50                   	push   %eax
+  801b5a:	ff 33                	push   (%ebx)
+  801b5c:	e8 1d ef ff ff       	call   800a7e <write>
+  801b61:	83 c4 10             	add    $0x10,%esp
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	7f 98                	jg     801b00 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b68:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b6c:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b6f:	83 f8 03             	cmp    $0x3,%eax
+  801b72:	74 48                	je     801bbc <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b74:	83 f8 02             	cmp    $0x2,%eax
+  801b77:	74 27                	je     801ba0 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	0f 84 10 ff ff ff    	je     801a94 <fwrite+0x1e>
+  801b84:	89 f8                	mov    %edi,%eax
+  801b86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8b:	f7 75 0c             	divl   0xc(%ebp)
+  801b8e:	e9 01 ff ff ff       	jmp    801a94 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b93:	89 d8                	mov    %ebx,%eax
+  801b95:	e8 ce f9 ff ff       	call   801568 <stream_drain>
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	79 9a                	jns    801b38 <fwrite+0xc2>
+  801b9e:	eb cc                	jmp    801b6c <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801ba0:	83 ec 04             	sub    $0x4,%esp
+  801ba3:	57                   	push   %edi
+  801ba4:	6a 0a                	push   $0xa
+  801ba6:	ff 75 08             	push   0x8(%ebp)
+  801ba9:	e8 ff 1e 00 00       	call   803aad <memfind>
+  801bae:	89 c2                	mov    %eax,%edx
+  801bb0:	89 f8                	mov    %edi,%eax
+  801bb2:	03 45 08             	add    0x8(%ebp),%eax
+  801bb5:	83 c4 10             	add    $0x10,%esp
+  801bb8:	39 c2                	cmp    %eax,%edx
+  801bba:	74 bd                	je     801b79 <fwrite+0x103>
+		stream_drain(f);
+  801bbc:	89 d8                	mov    %ebx,%eax
+  801bbe:	e8 a5 f9 ff ff       	call   801568 <stream_drain>
+  801bc3:	eb b4                	jmp    801b79 <fwrite+0x103>
+
+00801bc5 <fputc>:
+{
+  801bc5:	55                   	push   %ebp
+  801bc6:	89 e5                	mov    %esp,%ebp
+  801bc8:	53                   	push   %ebx
+  801bc9:	83 ec 14             	sub    $0x14,%esp
+  801bcc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bcf:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bd2:	ff 75 0c             	push   0xc(%ebp)
+  801bd5:	6a 01                	push   $0x1
+  801bd7:	6a 01                	push   $0x1
+  801bd9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801bdc:	50                   	push   %eax
+  801bdd:	e8 94 fe ff ff       	call   801a76 <fwrite>
+  801be2:	83 c4 10             	add    $0x10,%esp
+  801be5:	0f b6 db             	movzbl %bl,%ebx
+  801be8:	83 f8 01             	cmp    $0x1,%eax
+  801beb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bf0:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+00801bf8 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801bfe:	ff 75 0c             	push   0xc(%ebp)
+  801c01:	ff 75 08             	push   0x8(%ebp)
+  801c04:	e8 bc ff ff ff       	call   801bc5 <fputc>
+}
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+00801c0e <fputs>:
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c16:	83 ec 0c             	sub    $0xc,%esp
+  801c19:	56                   	push   %esi
+  801c1a:	e8 1c 1c 00 00       	call   80383b <strlen>
+  801c1f:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c21:	ff 75 0c             	push   0xc(%ebp)
+  801c24:	50                   	push   %eax
+  801c25:	6a 01                	push   $0x1
+  801c27:	56                   	push   %esi
+  801c28:	e8 49 fe ff ff       	call   801a76 <fwrite>
+  801c2d:	83 c4 20             	add    $0x20,%esp
+  801c30:	39 d8                	cmp    %ebx,%eax
+  801c32:	0f 95 c0             	setne  %al
+  801c35:	0f b6 c0             	movzbl %al,%eax
+  801c38:	f7 d8                	neg    %eax
+}
+  801c3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3d:	5b                   	pop    %ebx
+  801c3e:	5e                   	pop    %esi
+  801c3f:	5d                   	pop    %ebp
+  801c40:	c3                   	ret
+
+00801c41 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 04             	sub    $0x4,%esp
+  801c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c4b:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c4e:	50                   	push   %eax
+  801c4f:	ff 75 0c             	push   0xc(%ebp)
+  801c52:	53                   	push   %ebx
+  801c53:	68 f8 1b 80 00       	push   $0x801bf8
+  801c58:	e8 2c 17 00 00       	call   803389 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c5d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c60:	c1 e0 1c             	shl    $0x1c,%eax
+  801c63:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c69:	c9                   	leave
+  801c6a:	c3                   	ret
+
+00801c6b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c71:	68 d0 47 80 00       	push   $0x8047d0
+  801c76:	ff 75 0c             	push   0xc(%ebp)
+  801c79:	e8 f8 1b 00 00       	call   803876 <strcpy>
+	return 0;
+}
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	c9                   	leave
+  801c84:	c3                   	ret
+
+00801c85 <devsock_close>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	53                   	push   %ebx
+  801c89:	83 ec 10             	sub    $0x10,%esp
+  801c8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c8f:	53                   	push   %ebx
+  801c90:	e8 26 27 00 00       	call   8043bb <pageref>
+  801c95:	89 c2                	mov    %eax,%edx
+  801c97:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c9f:	83 fa 01             	cmp    $0x1,%edx
+  801ca2:	74 05                	je     801ca9 <devsock_close+0x24>
+}
+  801ca4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca7:	c9                   	leave
+  801ca8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+  801cac:	ff 73 0c             	push   0xc(%ebx)
+  801caf:	e8 b7 02 00 00       	call   801f6b <nsipc_close>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  801cb7:	eb eb                	jmp    801ca4 <devsock_close+0x1f>
+
+00801cb9 <devsock_write>:
+{
+  801cb9:	55                   	push   %ebp
+  801cba:	89 e5                	mov    %esp,%ebp
+  801cbc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cbf:	6a 00                	push   $0x0
+  801cc1:	ff 75 10             	push   0x10(%ebp)
+  801cc4:	ff 75 0c             	push   0xc(%ebp)
+  801cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cca:	ff 70 0c             	push   0xc(%eax)
+  801ccd:	e8 79 03 00 00       	call   80204b <nsipc_send>
+}
+  801cd2:	c9                   	leave
+  801cd3:	c3                   	ret
+
+00801cd4 <devsock_read>:
+{
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cda:	6a 00                	push   $0x0
+  801cdc:	ff 75 10             	push   0x10(%ebp)
+  801cdf:	ff 75 0c             	push   0xc(%ebp)
+  801ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce5:	ff 70 0c             	push   0xc(%eax)
+  801ce8:	e8 ef 02 00 00       	call   801fdc <nsipc_recv>
+}
+  801ced:	c9                   	leave
+  801cee:	c3                   	ret
+
+00801cef <fd2sockid>:
+{
+  801cef:	55                   	push   %ebp
+  801cf0:	89 e5                	mov    %esp,%ebp
+  801cf2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cf5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cf8:	52                   	push   %edx
+  801cf9:	50                   	push   %eax
+  801cfa:	e8 f7 e9 ff ff       	call   8006f6 <fd_lookup>
+  801cff:	83 c4 10             	add    $0x10,%esp
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 10                	js     801d16 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d09:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d0f:	39 08                	cmp    %ecx,(%eax)
+  801d11:	75 05                	jne    801d18 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d13:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d16:	c9                   	leave
+  801d17:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d18:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d1d:	eb f7                	jmp    801d16 <fd2sockid+0x27>
+
+00801d1f <alloc_sockfd>:
+{
+  801d1f:	55                   	push   %ebp
+  801d20:	89 e5                	mov    %esp,%ebp
+  801d22:	56                   	push   %esi
+  801d23:	53                   	push   %ebx
+  801d24:	83 ec 1c             	sub    $0x1c,%esp
+  801d27:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d2c:	50                   	push   %eax
+  801d2d:	e8 6e e9 ff ff       	call   8006a0 <fd_alloc>
+  801d32:	89 c3                	mov    %eax,%ebx
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 43                	js     801d7e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d3b:	83 ec 04             	sub    $0x4,%esp
+  801d3e:	68 07 04 00 00       	push   $0x407
+  801d43:	ff 75 f4             	push   -0xc(%ebp)
+  801d46:	6a 00                	push   $0x0
+  801d48:	e8 8a e4 ff ff       	call   8001d7 <sys_page_alloc>
+  801d4d:	89 c3                	mov    %eax,%ebx
+  801d4f:	83 c4 10             	add    $0x10,%esp
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 28                	js     801d7e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d59:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d5f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d64:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d6b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d6e:	83 ec 0c             	sub    $0xc,%esp
+  801d71:	50                   	push   %eax
+  801d72:	e8 02 e9 ff ff       	call   800679 <fd2num>
+  801d77:	89 c3                	mov    %eax,%ebx
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	eb 0c                	jmp    801d8a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	56                   	push   %esi
+  801d82:	e8 e4 01 00 00       	call   801f6b <nsipc_close>
+		return r;
+  801d87:	83 c4 10             	add    $0x10,%esp
+}
+  801d8a:	89 d8                	mov    %ebx,%eax
+  801d8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8f:	5b                   	pop    %ebx
+  801d90:	5e                   	pop    %esi
+  801d91:	5d                   	pop    %ebp
+  801d92:	c3                   	ret
+
+00801d93 <accept>:
+{
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9c:	e8 4e ff ff ff       	call   801cef <fd2sockid>
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 1b                	js     801dc0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	ff 75 10             	push   0x10(%ebp)
+  801dab:	ff 75 0c             	push   0xc(%ebp)
+  801dae:	50                   	push   %eax
+  801daf:	e8 0e 01 00 00       	call   801ec2 <nsipc_accept>
+  801db4:	83 c4 10             	add    $0x10,%esp
+  801db7:	85 c0                	test   %eax,%eax
+  801db9:	78 05                	js     801dc0 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dbb:	e8 5f ff ff ff       	call   801d1f <alloc_sockfd>
+}
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+
+00801dc2 <bind>:
+{
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcb:	e8 1f ff ff ff       	call   801cef <fd2sockid>
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 12                	js     801de6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dd4:	83 ec 04             	sub    $0x4,%esp
+  801dd7:	ff 75 10             	push   0x10(%ebp)
+  801dda:	ff 75 0c             	push   0xc(%ebp)
+  801ddd:	50                   	push   %eax
+  801dde:	e8 31 01 00 00       	call   801f14 <nsipc_bind>
+  801de3:	83 c4 10             	add    $0x10,%esp
+}
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+
+00801de8 <shutdown>:
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df1:	e8 f9 fe ff ff       	call   801cef <fd2sockid>
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 0f                	js     801e09 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dfa:	83 ec 08             	sub    $0x8,%esp
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	50                   	push   %eax
+  801e01:	e8 43 01 00 00       	call   801f49 <nsipc_shutdown>
+  801e06:	83 c4 10             	add    $0x10,%esp
+}
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+
+00801e0b <connect>:
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e14:	e8 d6 fe ff ff       	call   801cef <fd2sockid>
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 12                	js     801e2f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e1d:	83 ec 04             	sub    $0x4,%esp
+  801e20:	ff 75 10             	push   0x10(%ebp)
+  801e23:	ff 75 0c             	push   0xc(%ebp)
+  801e26:	50                   	push   %eax
+  801e27:	e8 59 01 00 00       	call   801f85 <nsipc_connect>
+  801e2c:	83 c4 10             	add    $0x10,%esp
+}
+  801e2f:	c9                   	leave
+  801e30:	c3                   	ret
+
+00801e31 <listen>:
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3a:	e8 b0 fe ff ff       	call   801cef <fd2sockid>
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 0f                	js     801e52 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e43:	83 ec 08             	sub    $0x8,%esp
+  801e46:	ff 75 0c             	push   0xc(%ebp)
+  801e49:	50                   	push   %eax
+  801e4a:	e8 6b 01 00 00       	call   801fba <nsipc_listen>
+  801e4f:	83 c4 10             	add    $0x10,%esp
+}
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+
+00801e54 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e5a:	ff 75 10             	push   0x10(%ebp)
+  801e5d:	ff 75 0c             	push   0xc(%ebp)
+  801e60:	ff 75 08             	push   0x8(%ebp)
+  801e63:	e8 41 02 00 00       	call   8020a9 <nsipc_socket>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 05                	js     801e74 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e6f:	e8 ab fe ff ff       	call   801d1f <alloc_sockfd>
+}
+  801e74:	c9                   	leave
+  801e75:	c3                   	ret
+
+00801e76 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e76:	55                   	push   %ebp
+  801e77:	89 e5                	mov    %esp,%ebp
+  801e79:	53                   	push   %ebx
+  801e7a:	83 ec 04             	sub    $0x4,%esp
+  801e7d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e7f:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e86:	74 26                	je     801eae <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e88:	6a 07                	push   $0x7
+  801e8a:	68 00 80 80 00       	push   $0x808000
+  801e8f:	53                   	push   %ebx
+  801e90:	ff 35 08 60 80 00    	push   0x806008
+  801e96:	e8 8b 24 00 00       	call   804326 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e9b:	83 c4 0c             	add    $0xc,%esp
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	e8 87 23 00 00       	call   804230 <ipc_recv>
+}
+  801ea9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eac:	c9                   	leave
+  801ead:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801eae:	83 ec 0c             	sub    $0xc,%esp
+  801eb1:	6a 02                	push   $0x2
+  801eb3:	e8 c4 24 00 00       	call   80437c <ipc_find_env>
+  801eb8:	a3 08 60 80 00       	mov    %eax,0x806008
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	eb c6                	jmp    801e88 <nsipc+0x12>
+
+00801ec2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ec2:	55                   	push   %ebp
+  801ec3:	89 e5                	mov    %esp,%ebp
+  801ec5:	56                   	push   %esi
+  801ec6:	53                   	push   %ebx
+  801ec7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ecd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ed2:	8b 06                	mov    (%esi),%eax
+  801ed4:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ede:	e8 93 ff ff ff       	call   801e76 <nsipc>
+  801ee3:	89 c3                	mov    %eax,%ebx
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	79 09                	jns    801ef2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ee9:	89 d8                	mov    %ebx,%eax
+  801eeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eee:	5b                   	pop    %ebx
+  801eef:	5e                   	pop    %esi
+  801ef0:	5d                   	pop    %ebp
+  801ef1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ef2:	83 ec 04             	sub    $0x4,%esp
+  801ef5:	ff 35 10 80 80 00    	push   0x808010
+  801efb:	68 00 80 80 00       	push   $0x808000
+  801f00:	ff 75 0c             	push   0xc(%ebp)
+  801f03:	e8 f4 1a 00 00       	call   8039fc <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f08:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f0d:	89 06                	mov    %eax,(%esi)
+  801f0f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f12:	eb d5                	jmp    801ee9 <nsipc_accept+0x27>
+
+00801f14 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f14:	55                   	push   %ebp
+  801f15:	89 e5                	mov    %esp,%ebp
+  801f17:	53                   	push   %ebx
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f21:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f26:	53                   	push   %ebx
+  801f27:	ff 75 0c             	push   0xc(%ebp)
+  801f2a:	68 04 80 80 00       	push   $0x808004
+  801f2f:	e8 c8 1a 00 00       	call   8039fc <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f34:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f3f:	e8 32 ff ff ff       	call   801e76 <nsipc>
+}
+  801f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+00801f49 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f49:	55                   	push   %ebp
+  801f4a:	89 e5                	mov    %esp,%ebp
+  801f4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f52:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f5a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f5f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f64:	e8 0d ff ff ff       	call   801e76 <nsipc>
+}
+  801f69:	c9                   	leave
+  801f6a:	c3                   	ret
+
+00801f6b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f74:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f79:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f7e:	e8 f3 fe ff ff       	call   801e76 <nsipc>
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 08             	sub    $0x8,%esp
+  801f8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f92:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f97:	53                   	push   %ebx
+  801f98:	ff 75 0c             	push   0xc(%ebp)
+  801f9b:	68 04 80 80 00       	push   $0x808004
+  801fa0:	e8 57 1a 00 00       	call   8039fc <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fa5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fab:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fb0:	e8 c1 fe ff ff       	call   801e76 <nsipc>
+}
+  801fb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb8:	c9                   	leave
+  801fb9:	c3                   	ret
+
+00801fba <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fcb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fd0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd5:	e8 9c fe ff ff       	call   801e76 <nsipc>
+}
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+
+00801fdc <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fdc:	55                   	push   %ebp
+  801fdd:	89 e5                	mov    %esp,%ebp
+  801fdf:	56                   	push   %esi
+  801fe0:	53                   	push   %ebx
+  801fe1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fec:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801ff2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff5:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801ffa:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fff:	e8 72 fe ff ff       	call   801e76 <nsipc>
+  802004:	89 c3                	mov    %eax,%ebx
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 22                	js     80202c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80200a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80200f:	39 c6                	cmp    %eax,%esi
+  802011:	0f 4e c6             	cmovle %esi,%eax
+  802014:	39 c3                	cmp    %eax,%ebx
+  802016:	7f 1d                	jg     802035 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802018:	83 ec 04             	sub    $0x4,%esp
+  80201b:	53                   	push   %ebx
+  80201c:	68 00 80 80 00       	push   $0x808000
+  802021:	ff 75 0c             	push   0xc(%ebp)
+  802024:	e8 d3 19 00 00       	call   8039fc <memmove>
+  802029:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80202c:	89 d8                	mov    %ebx,%eax
+  80202e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802031:	5b                   	pop    %ebx
+  802032:	5e                   	pop    %esi
+  802033:	5d                   	pop    %ebp
+  802034:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802035:	68 dc 47 80 00       	push   $0x8047dc
+  80203a:	68 95 47 80 00       	push   $0x804795
+  80203f:	6a 62                	push   $0x62
+  802041:	68 f1 47 80 00       	push   $0x8047f1
+  802046:	e8 6c 11 00 00       	call   8031b7 <_panic>
+
+0080204b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	53                   	push   %ebx
+  80204f:	83 ec 04             	sub    $0x4,%esp
+  802052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802055:	8b 45 08             	mov    0x8(%ebp),%eax
+  802058:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80205d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802063:	7f 2e                	jg     802093 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802065:	83 ec 04             	sub    $0x4,%esp
+  802068:	53                   	push   %ebx
+  802069:	ff 75 0c             	push   0xc(%ebp)
+  80206c:	68 0c 80 80 00       	push   $0x80800c
+  802071:	e8 86 19 00 00       	call   8039fc <memmove>
+	nsipcbuf.send.req_size = size;
+  802076:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80207c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802084:	b8 08 00 00 00       	mov    $0x8,%eax
+  802089:	e8 e8 fd ff ff       	call   801e76 <nsipc>
+}
+  80208e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802091:	c9                   	leave
+  802092:	c3                   	ret
+	assert(size < 1600);
+  802093:	68 fd 47 80 00       	push   $0x8047fd
+  802098:	68 95 47 80 00       	push   $0x804795
+  80209d:	6a 6d                	push   $0x6d
+  80209f:	68 f1 47 80 00       	push   $0x8047f1
+  8020a4:	e8 0e 11 00 00       	call   8031b7 <_panic>
+
+008020a9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ba:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020bf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020c2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020c7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020cc:	e8 a5 fd ff ff       	call   801e76 <nsipc>
+}
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+
+008020d3 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	53                   	push   %ebx
+  8020d7:	83 ec 10             	sub    $0x10,%esp
+  8020da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020dd:	68 0c 60 80 00       	push   $0x80600c
+  8020e2:	e8 50 07 00 00       	call   802837 <mutex_lock>
+	if (v == 0)
+  8020e7:	83 c4 10             	add    $0x10,%esp
+  8020ea:	85 db                	test   %ebx,%ebx
+  8020ec:	0f 84 85 00 00 00    	je     802177 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8020f2:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8020f8:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8020fd:	77 51                	ja     802150 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8020ff:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	c1 e8 0c             	shr    $0xc,%eax
+  80210a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802111:	f6 c4 02             	test   $0x2,%ah
+  802114:	74 50                	je     802166 <free+0x93>
+		sys_page_unmap(0, c);
+  802116:	83 ec 08             	sub    $0x8,%esp
+  802119:	53                   	push   %ebx
+  80211a:	6a 00                	push   $0x0
+  80211c:	e8 4f e1 ff ff       	call   800270 <sys_page_unmap>
+		c += PGSIZE;
+  802121:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802127:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802135:	76 ce                	jbe    802105 <free+0x32>
+  802137:	68 47 48 80 00       	push   $0x804847
+  80213c:	68 95 47 80 00       	push   $0x804795
+  802141:	68 82 00 00 00       	push   $0x82
+  802146:	68 3a 48 80 00       	push   $0x80483a
+  80214b:	e8 67 10 00 00       	call   8031b7 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802150:	68 0c 48 80 00       	push   $0x80480c
+  802155:	68 95 47 80 00       	push   $0x804795
+  80215a:	6a 7b                	push   $0x7b
+  80215c:	68 3a 48 80 00       	push   $0x80483a
+  802161:	e8 51 10 00 00       	call   8031b7 <_panic>
+	if (--(*ref) == 0)
+  802166:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80216c:	83 e8 01             	sub    $0x1,%eax
+  80216f:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802175:	74 15                	je     80218c <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	68 0c 60 80 00       	push   $0x80600c
+  80217f:	e8 20 07 00 00       	call   8028a4 <mutex_unlock>
+}
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80218a:	c9                   	leave
+  80218b:	c3                   	ret
+		sys_page_unmap(0, c);
+  80218c:	83 ec 08             	sub    $0x8,%esp
+  80218f:	53                   	push   %ebx
+  802190:	6a 00                	push   $0x0
+  802192:	e8 d9 e0 ff ff       	call   800270 <sys_page_unmap>
+  802197:	83 c4 10             	add    $0x10,%esp
+  80219a:	eb db                	jmp    802177 <free+0xa4>
+
+0080219c <malloc>:
+{
+  80219c:	55                   	push   %ebp
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	57                   	push   %edi
+  8021a0:	56                   	push   %esi
+  8021a1:	53                   	push   %ebx
+  8021a2:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021a5:	68 0c 60 80 00       	push   $0x80600c
+  8021aa:	e8 88 06 00 00       	call   802837 <mutex_lock>
+	if (mptr == 0)
+  8021af:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021b5:	83 c4 10             	add    $0x10,%esp
+  8021b8:	85 ff                	test   %edi,%edi
+  8021ba:	74 6c                	je     802228 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	83 c0 03             	add    $0x3,%eax
+  8021c2:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021c5:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021c7:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021cc:	0f 87 64 01 00 00    	ja     802336 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021d2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021d8:	74 30                	je     80220a <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021da:	89 f9                	mov    %edi,%ecx
+  8021dc:	c1 e9 0c             	shr    $0xc,%ecx
+  8021df:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021e3:	c1 e8 0c             	shr    $0xc,%eax
+  8021e6:	39 c1                	cmp    %eax,%ecx
+  8021e8:	74 5f                	je     802249 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+  8021ed:	57                   	push   %edi
+  8021ee:	e8 e0 fe ff ff       	call   8020d3 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8021f3:	a1 10 60 80 00       	mov    0x806010,%eax
+  8021f8:	05 00 10 00 00       	add    $0x1000,%eax
+  8021fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802202:	a3 10 60 80 00       	mov    %eax,0x806010
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802210:	ba 02 00 00 00       	mov    $0x2,%edx
+  802215:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802219:	8d 7e 04             	lea    0x4(%esi),%edi
+  80221c:	89 cb                	mov    %ecx,%ebx
+  80221e:	01 f9                	add    %edi,%ecx
+  802220:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802223:	e9 8b 00 00 00       	jmp    8022b3 <malloc+0x117>
+		mptr = mbegin;
+  802228:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80222f:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802232:	8b 45 08             	mov    0x8(%ebp),%eax
+  802235:	83 c0 03             	add    $0x3,%eax
+  802238:	83 e0 fc             	and    $0xfffffffc,%eax
+  80223b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80223d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802242:	76 c6                	jbe    80220a <malloc+0x6e>
+  802244:	e9 d6 00 00 00       	jmp    80231f <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802249:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80224f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802254:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802258:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80225b:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802260:	e9 ba 00 00 00       	jmp    80231f <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802265:	05 00 10 00 00       	add    $0x1000,%eax
+  80226a:	39 c8                	cmp    %ecx,%eax
+  80226c:	0f 83 cb 00 00 00    	jae    80233d <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802272:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802277:	77 22                	ja     80229b <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802279:	89 c2                	mov    %eax,%edx
+  80227b:	c1 ea 16             	shr    $0x16,%edx
+  80227e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802285:	f6 c2 01             	test   $0x1,%dl
+  802288:	74 db                	je     802265 <malloc+0xc9>
+  80228a:	89 c2                	mov    %eax,%edx
+  80228c:	c1 ea 0c             	shr    $0xc,%edx
+  80228f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802296:	f6 c2 01             	test   $0x1,%dl
+  802299:	74 ca                	je     802265 <malloc+0xc9>
+		if (mptr == mend) {
+  80229b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022a1:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022a7:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022ab:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022b1:	74 04                	je     8022b7 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022b3:	89 d8                	mov    %ebx,%eax
+  8022b5:	eb b3                	jmp    80226a <malloc+0xce>
+  8022b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022ba:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022bf:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022c3:	83 ea 01             	sub    $0x1,%edx
+  8022c6:	0f 85 50 ff ff ff    	jne    80221c <malloc+0x80>
+  8022cc:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022d3:	00 00 08 
+				return 0;	/* out of address space */
+  8022d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022db:	eb 42                	jmp    80231f <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022dd:	85 db                	test   %ebx,%ebx
+  8022df:	78 1e                	js     8022ff <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022e1:	83 ec 08             	sub    $0x8,%esp
+  8022e4:	89 d8                	mov    %ebx,%eax
+  8022e6:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022ec:	50                   	push   %eax
+  8022ed:	6a 00                	push   $0x0
+  8022ef:	e8 7c df ff ff       	call   800270 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8022f4:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	eb de                	jmp    8022dd <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8022ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802304:	eb 19                	jmp    80231f <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802306:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802309:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80230f:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802316:	00 
+	mptr += n;
+  802317:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80231a:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80231f:	83 ec 0c             	sub    $0xc,%esp
+  802322:	68 0c 60 80 00       	push   $0x80600c
+  802327:	e8 78 05 00 00       	call   8028a4 <mutex_unlock>
+}
+  80232c:	89 f8                	mov    %edi,%eax
+  80232e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802331:	5b                   	pop    %ebx
+  802332:	5e                   	pop    %esi
+  802333:	5f                   	pop    %edi
+  802334:	5d                   	pop    %ebp
+  802335:	c3                   	ret
+		return 0;
+  802336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233b:	eb e2                	jmp    80231f <malloc+0x183>
+  80233d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802341:	74 06                	je     802349 <malloc+0x1ad>
+  802343:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802351:	39 fb                	cmp    %edi,%ebx
+  802353:	73 b1                	jae    802306 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802355:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80235b:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80235e:	39 fe                	cmp    %edi,%esi
+  802360:	0f 92 c0             	setb   %al
+  802363:	0f b6 c0             	movzbl %al,%eax
+  802366:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802369:	83 c8 07             	or     $0x7,%eax
+  80236c:	50                   	push   %eax
+  80236d:	89 d8                	mov    %ebx,%eax
+  80236f:	03 05 10 60 80 00    	add    0x806010,%eax
+  802375:	50                   	push   %eax
+  802376:	6a 00                	push   $0x0
+  802378:	e8 5a de ff ff       	call   8001d7 <sys_page_alloc>
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	85 c0                	test   %eax,%eax
+  802382:	0f 88 55 ff ff ff    	js     8022dd <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802388:	89 f3                	mov    %esi,%ebx
+  80238a:	eb c5                	jmp    802351 <malloc+0x1b5>
+
+0080238c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80238c:	55                   	push   %ebp
+  80238d:	89 e5                	mov    %esp,%ebp
+  80238f:	56                   	push   %esi
+  802390:	53                   	push   %ebx
+  802391:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802394:	83 ec 0c             	sub    $0xc,%esp
+  802397:	ff 75 08             	push   0x8(%ebp)
+  80239a:	e8 ea e2 ff ff       	call   800689 <fd2data>
+  80239f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023a1:	83 c4 08             	add    $0x8,%esp
+  8023a4:	68 5f 48 80 00       	push   $0x80485f
+  8023a9:	53                   	push   %ebx
+  8023aa:	e8 c7 14 00 00       	call   803876 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023af:	8b 46 04             	mov    0x4(%esi),%eax
+  8023b2:	2b 06                	sub    (%esi),%eax
+  8023b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023c4:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023cb:	52 80 00 
+	return 0;
+}
+  8023ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+
+008023da <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023df:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023e3:	85 c9                	test   %ecx,%ecx
+  8023e5:	75 01                	jne    8023e8 <pipewake+0xe>
+  8023e7:	c3                   	ret
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023ee:	68 00 04 00 00       	push   $0x400
+  8023f3:	52                   	push   %edx
+  8023f4:	e8 22 e1 ff ff       	call   80051b <sys_futex_wake>
+  8023f9:	83 c4 10             	add    $0x10,%esp
+}
+  8023fc:	c9                   	leave
+  8023fd:	c3                   	ret
+
+008023fe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023fe:	55                   	push   %ebp
+  8023ff:	89 e5                	mov    %esp,%ebp
+  802401:	56                   	push   %esi
+  802402:	53                   	push   %ebx
+  802403:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802406:	83 ec 0c             	sub    $0xc,%esp
+  802409:	56                   	push   %esi
+  80240a:	e8 7a e2 ff ff       	call   800689 <fd2data>
+  80240f:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802411:	83 c4 08             	add    $0x8,%esp
+  802414:	56                   	push   %esi
+  802415:	6a 00                	push   $0x0
+  802417:	e8 54 de ff ff       	call   800270 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80241c:	8d 53 04             	lea    0x4(%ebx),%edx
+  80241f:	8d 43 08             	lea    0x8(%ebx),%eax
+  802422:	e8 b3 ff ff ff       	call   8023da <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802427:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80242a:	89 da                	mov    %ebx,%edx
+  80242c:	e8 a9 ff ff ff       	call   8023da <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802431:	89 34 24             	mov    %esi,(%esp)
+  802434:	e8 50 e2 ff ff       	call   800689 <fd2data>
+  802439:	83 c4 08             	add    $0x8,%esp
+  80243c:	50                   	push   %eax
+  80243d:	6a 00                	push   $0x0
+  80243f:	e8 2c de ff ff       	call   800270 <sys_page_unmap>
+}
+  802444:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802447:	5b                   	pop    %ebx
+  802448:	5e                   	pop    %esi
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+
+0080244b <_pipeisclosed>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	57                   	push   %edi
+  80244f:	56                   	push   %esi
+  802450:	53                   	push   %ebx
+  802451:	83 ec 1c             	sub    $0x1c,%esp
+  802454:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802457:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802459:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80245e:	eb 5d                	jmp    8024bd <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802460:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802466:	8b 02                	mov    (%edx),%eax
+  802468:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+  80246e:	ff 75 e0             	push   -0x20(%ebp)
+  802471:	e8 45 1f 00 00       	call   8043bb <pageref>
+  802476:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802479:	89 3c 24             	mov    %edi,(%esp)
+  80247c:	e8 3a 1f 00 00       	call   8043bb <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802481:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802483:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802492:	77 15                	ja     8024a9 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802494:	89 f2                	mov    %esi,%edx
+  802496:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802498:	c1 ea 10             	shr    $0x10,%edx
+  80249b:	74 0c                	je     8024a9 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80249d:	c1 e2 10             	shl    $0x10,%edx
+  8024a0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024a5:	29 d1                	sub    %edx,%ecx
+  8024a7:	eb 06                	jmp    8024af <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024a9:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024af:	8b 11                	mov    (%ecx),%edx
+  8024b1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024b4:	39 d3                	cmp    %edx,%ebx
+  8024b6:	74 6e                	je     802526 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024b8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024bb:	74 24                	je     8024e1 <_pipeisclosed+0x96>
+  8024bd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024bf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024ca:	77 94                	ja     802460 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024cc:	89 f0                	mov    %esi,%eax
+  8024ce:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024d0:	c1 e8 10             	shr    $0x10,%eax
+  8024d3:	74 8b                	je     802460 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024d5:	c1 e0 10             	shl    $0x10,%eax
+  8024d8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024dd:	29 c2                	sub    %eax,%edx
+  8024df:	eb 85                	jmp    802466 <_pipeisclosed+0x1b>
+  8024e1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024e3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024ee:	77 18                	ja     802508 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8024f5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024f7:	c1 e8 10             	shr    $0x10,%eax
+  8024fa:	74 0c                	je     802508 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024fc:	c1 e0 10             	shl    $0x10,%eax
+  8024ff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802504:	29 c2                	sub    %eax,%edx
+  802506:	eb 06                	jmp    80250e <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802508:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80250e:	8b 02                	mov    (%edx),%eax
+  802510:	8b 40 58             	mov    0x58(%eax),%eax
+  802513:	6a 01                	push   $0x1
+  802515:	50                   	push   %eax
+  802516:	53                   	push   %ebx
+  802517:	68 66 48 80 00       	push   $0x804866
+  80251c:	e8 71 0d 00 00       	call   803292 <cprintf>
+  802521:	83 c4 10             	add    $0x10,%esp
+  802524:	eb 97                	jmp    8024bd <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802526:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802529:	0f 94 c0             	sete   %al
+  80252c:	0f b6 c0             	movzbl %al,%eax
+}
+  80252f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5f                   	pop    %edi
+  802535:	5d                   	pop    %ebp
+  802536:	c3                   	ret
+
+00802537 <devpipe_write>:
+{
+  802537:	55                   	push   %ebp
+  802538:	89 e5                	mov    %esp,%ebp
+  80253a:	57                   	push   %edi
+  80253b:	56                   	push   %esi
+  80253c:	53                   	push   %ebx
+  80253d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802540:	ff 75 08             	push   0x8(%ebp)
+  802543:	e8 41 e1 ff ff       	call   800689 <fd2data>
+  802548:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802554:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802557:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80255a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80255d:	0f 84 96 00 00 00    	je     8025f9 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802563:	8d 73 08             	lea    0x8(%ebx),%esi
+  802566:	eb 32                	jmp    80259a <devpipe_write+0x63>
+  802568:	89 fa                	mov    %edi,%edx
+  80256a:	89 f0                	mov    %esi,%eax
+  80256c:	e8 69 fe ff ff       	call   8023da <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802571:	8b 43 04             	mov    0x4(%ebx),%eax
+  802574:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802577:	ba 01 00 00 00       	mov    $0x1,%edx
+  80257c:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802581:	83 ec 04             	sub    $0x4,%esp
+  802584:	6a 0a                	push   $0xa
+  802586:	50                   	push   %eax
+  802587:	53                   	push   %ebx
+  802588:	e8 5f df ff ff       	call   8004ec <sys_futex_wait>
+  80258d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802592:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802597:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80259a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80259d:	8b 0b                	mov    (%ebx),%ecx
+  80259f:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025a2:	39 d0                	cmp    %edx,%eax
+  8025a4:	72 1b                	jb     8025c1 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025a6:	89 da                	mov    %ebx,%edx
+  8025a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ab:	e8 9b fe ff ff       	call   80244b <_pipeisclosed>
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	74 b4                	je     802568 <devpipe_write+0x31>
+				return 0;
+  8025b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bc:	5b                   	pop    %ebx
+  8025bd:	5e                   	pop    %esi
+  8025be:	5f                   	pop    %edi
+  8025bf:	5d                   	pop    %ebp
+  8025c0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025c7:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025cb:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025ce:	89 c2                	mov    %eax,%edx
+  8025d0:	c1 fa 1f             	sar    $0x1f,%edx
+  8025d3:	89 d1                	mov    %edx,%ecx
+  8025d5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025d8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025db:	83 e2 1f             	and    $0x1f,%edx
+  8025de:	29 ca                	sub    %ecx,%edx
+  8025e0:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025e4:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025e8:	83 c0 01             	add    $0x1,%eax
+  8025eb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025ee:	83 c6 01             	add    $0x1,%esi
+  8025f1:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8025f4:	e9 5e ff ff ff       	jmp    802557 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8025f9:	8d 53 04             	lea    0x4(%ebx),%edx
+  8025fc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025ff:	e8 d6 fd ff ff       	call   8023da <pipewake>
+	return i;
+  802604:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802607:	eb b0                	jmp    8025b9 <devpipe_write+0x82>
+
+00802609 <devpipe_read>:
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+  80260c:	57                   	push   %edi
+  80260d:	56                   	push   %esi
+  80260e:	53                   	push   %ebx
+  80260f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802612:	ff 75 08             	push   0x8(%ebp)
+  802615:	e8 6f e0 ff ff       	call   800689 <fd2data>
+  80261a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80261c:	83 c4 10             	add    $0x10,%esp
+  80261f:	be 00 00 00 00       	mov    $0x0,%esi
+  802624:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802627:	74 6c                	je     802695 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802629:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80262c:	eb 25                	jmp    802653 <devpipe_read+0x4a>
+  80262e:	8b 13                	mov    (%ebx),%edx
+  802630:	b8 01 00 00 00       	mov    $0x1,%eax
+  802635:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80263a:	83 ec 04             	sub    $0x4,%esp
+  80263d:	6a 0a                	push   $0xa
+  80263f:	52                   	push   %edx
+  802640:	57                   	push   %edi
+  802641:	e8 a6 de ff ff       	call   8004ec <sys_futex_wait>
+  802646:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80264b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802650:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802653:	8b 03                	mov    (%ebx),%eax
+  802655:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802658:	75 19                	jne    802673 <devpipe_read+0x6a>
+			if (i > 0)
+  80265a:	85 f6                	test   %esi,%esi
+  80265c:	75 3a                	jne    802698 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80265e:	89 da                	mov    %ebx,%edx
+  802660:	8b 45 08             	mov    0x8(%ebp),%eax
+  802663:	e8 e3 fd ff ff       	call   80244b <_pipeisclosed>
+  802668:	85 c0                	test   %eax,%eax
+  80266a:	74 c2                	je     80262e <devpipe_read+0x25>
+				return 0;
+  80266c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802671:	eb 31                	jmp    8026a4 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802673:	89 c1                	mov    %eax,%ecx
+  802675:	c1 f9 1f             	sar    $0x1f,%ecx
+  802678:	c1 e9 1b             	shr    $0x1b,%ecx
+  80267b:	01 c8                	add    %ecx,%eax
+  80267d:	83 e0 1f             	and    $0x1f,%eax
+  802680:	29 c8                	sub    %ecx,%eax
+  802682:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802687:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80268a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80268d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802690:	83 c6 01             	add    $0x1,%esi
+  802693:	eb 8f                	jmp    802624 <devpipe_read+0x1b>
+out:
+  802695:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802698:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80269b:	89 da                	mov    %ebx,%edx
+  80269d:	e8 38 fd ff ff       	call   8023da <pipewake>
+	return i;
+  8026a2:	89 f0                	mov    %esi,%eax
+}
+  8026a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a7:	5b                   	pop    %ebx
+  8026a8:	5e                   	pop    %esi
+  8026a9:	5f                   	pop    %edi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+
+008026ac <pipe>:
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b7:	50                   	push   %eax
+  8026b8:	e8 e3 df ff ff       	call   8006a0 <fd_alloc>
+  8026bd:	89 c3                	mov    %eax,%ebx
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	0f 88 23 01 00 00    	js     8027ed <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ca:	83 ec 04             	sub    $0x4,%esp
+  8026cd:	68 07 04 00 00       	push   $0x407
+  8026d2:	ff 75 f4             	push   -0xc(%ebp)
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	e8 fb da ff ff       	call   8001d7 <sys_page_alloc>
+  8026dc:	89 c3                	mov    %eax,%ebx
+  8026de:	83 c4 10             	add    $0x10,%esp
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	0f 88 04 01 00 00    	js     8027ed <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	e8 ab df ff ff       	call   8006a0 <fd_alloc>
+  8026f5:	89 c3                	mov    %eax,%ebx
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	0f 88 db 00 00 00    	js     8027dd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802702:	83 ec 04             	sub    $0x4,%esp
+  802705:	68 07 04 00 00       	push   $0x407
+  80270a:	ff 75 f0             	push   -0x10(%ebp)
+  80270d:	6a 00                	push   $0x0
+  80270f:	e8 c3 da ff ff       	call   8001d7 <sys_page_alloc>
+  802714:	89 c3                	mov    %eax,%ebx
+  802716:	83 c4 10             	add    $0x10,%esp
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	0f 88 bc 00 00 00    	js     8027dd <pipe+0x131>
+	va = fd2data(fd0);
+  802721:	83 ec 0c             	sub    $0xc,%esp
+  802724:	ff 75 f4             	push   -0xc(%ebp)
+  802727:	e8 5d df ff ff       	call   800689 <fd2data>
+  80272c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272e:	83 c4 0c             	add    $0xc,%esp
+  802731:	68 07 04 00 00       	push   $0x407
+  802736:	50                   	push   %eax
+  802737:	6a 00                	push   $0x0
+  802739:	e8 99 da ff ff       	call   8001d7 <sys_page_alloc>
+  80273e:	89 c3                	mov    %eax,%ebx
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 c0                	test   %eax,%eax
+  802745:	0f 88 82 00 00 00    	js     8027cd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80274b:	83 ec 0c             	sub    $0xc,%esp
+  80274e:	ff 75 f0             	push   -0x10(%ebp)
+  802751:	e8 33 df ff ff       	call   800689 <fd2data>
+  802756:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80275d:	50                   	push   %eax
+  80275e:	6a 00                	push   $0x0
+  802760:	56                   	push   %esi
+  802761:	6a 00                	push   $0x0
+  802763:	e8 bc da ff ff       	call   800224 <sys_page_map>
+  802768:	89 c3                	mov    %eax,%ebx
+  80276a:	83 c4 20             	add    $0x20,%esp
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	78 4e                	js     8027bf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802771:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802776:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802779:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80277b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802785:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802788:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80278a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80278d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802794:	83 ec 0c             	sub    $0xc,%esp
+  802797:	ff 75 f4             	push   -0xc(%ebp)
+  80279a:	e8 da de ff ff       	call   800679 <fd2num>
+  80279f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a4:	83 c4 04             	add    $0x4,%esp
+  8027a7:	ff 75 f0             	push   -0x10(%ebp)
+  8027aa:	e8 ca de ff ff       	call   800679 <fd2num>
+  8027af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  8027b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027bd:	eb 2e                	jmp    8027ed <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027bf:	83 ec 08             	sub    $0x8,%esp
+  8027c2:	56                   	push   %esi
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	e8 a6 da ff ff       	call   800270 <sys_page_unmap>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+  8027d0:	ff 75 f0             	push   -0x10(%ebp)
+  8027d3:	6a 00                	push   $0x0
+  8027d5:	e8 96 da ff ff       	call   800270 <sys_page_unmap>
+  8027da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027dd:	83 ec 08             	sub    $0x8,%esp
+  8027e0:	ff 75 f4             	push   -0xc(%ebp)
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	e8 86 da ff ff       	call   800270 <sys_page_unmap>
+  8027ea:	83 c4 10             	add    $0x10,%esp
+}
+  8027ed:	89 d8                	mov    %ebx,%eax
+  8027ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	5e                   	pop    %esi
+  8027f4:	5d                   	pop    %ebp
+  8027f5:	c3                   	ret
+
+008027f6 <pipeisclosed>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ff:	50                   	push   %eax
+  802800:	ff 75 08             	push   0x8(%ebp)
+  802803:	e8 ee de ff ff       	call   8006f6 <fd_lookup>
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 18                	js     802827 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280f:	83 ec 0c             	sub    $0xc,%esp
+  802812:	ff 75 f4             	push   -0xc(%ebp)
+  802815:	e8 6f de ff ff       	call   800689 <fd2data>
+  80281a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281f:	e8 27 fc ff ff       	call   80244b <_pipeisclosed>
+  802824:	83 c4 10             	add    $0x10,%esp
+}
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+
+00802829 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80282c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802835:	5d                   	pop    %ebp
+  802836:	c3                   	ret
+
+00802837 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802837:	55                   	push   %ebp
+  802838:	89 e5                	mov    %esp,%ebp
+  80283a:	56                   	push   %esi
+  80283b:	53                   	push   %ebx
+  80283c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80283f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802844:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802849:	89 d0                	mov    %edx,%eax
+  80284b:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	74 2d                	je     802880 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802853:	83 f8 02             	cmp    $0x2,%eax
+  802856:	74 08                	je     802860 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802858:	b8 02 00 00 00       	mov    $0x2,%eax
+  80285d:	f0 87 03             	lock xchg %eax,(%ebx)
+  802860:	be 02 00 00 00       	mov    $0x2,%esi
+  802865:	eb 15                	jmp    80287c <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802867:	83 ec 04             	sub    $0x4,%esp
+  80286a:	6a 00                	push   $0x0
+  80286c:	6a 02                	push   $0x2
+  80286e:	53                   	push   %ebx
+  80286f:	e8 78 dc ff ff       	call   8004ec <sys_futex_wait>
+  802874:	89 f0                	mov    %esi,%eax
+  802876:	f0 87 03             	lock xchg %eax,(%ebx)
+  802879:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80287c:	85 c0                	test   %eax,%eax
+  80287e:	75 e7                	jne    802867 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  802880:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802883:	5b                   	pop    %ebx
+  802884:	5e                   	pop    %esi
+  802885:	5d                   	pop    %ebp
+  802886:	c3                   	ret
+
+00802887 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80288d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802892:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802897:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80289b:	f7 d8                	neg    %eax
+  80289d:	19 c0                	sbb    %eax,%eax
+  80289f:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028a2:	5d                   	pop    %ebp
+  8028a3:	c3                   	ret
+
+008028a4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028a4:	55                   	push   %ebp
+  8028a5:	89 e5                	mov    %esp,%ebp
+  8028a7:	83 ec 08             	sub    $0x8,%esp
+  8028aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b2:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028b5:	83 f8 02             	cmp    $0x2,%eax
+  8028b8:	74 02                	je     8028bc <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028bc:	83 ec 08             	sub    $0x8,%esp
+  8028bf:	6a 01                	push   $0x1
+  8028c1:	52                   	push   %edx
+  8028c2:	e8 54 dc ff ff       	call   80051b <sys_futex_wake>
+  8028c7:	83 c4 10             	add    $0x10,%esp
+}
+  8028ca:	eb ee                	jmp    8028ba <mutex_unlock+0x16>
+
+008028cc <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028d8:	5d                   	pop    %ebp
+  8028d9:	c3                   	ret
+
+008028da <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	57                   	push   %edi
+  8028de:	56                   	push   %esi
+  8028df:	53                   	push   %ebx
+  8028e0:	83 ec 18             	sub    $0x18,%esp
+  8028e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028e9:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028eb:	53                   	push   %ebx
+  8028ec:	e8 b3 ff ff ff       	call   8028a4 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8028f1:	83 c4 0c             	add    $0xc,%esp
+  8028f4:	ff 75 10             	push   0x10(%ebp)
+  8028f7:	57                   	push   %edi
+  8028f8:	56                   	push   %esi
+  8028f9:	e8 ee db ff ff       	call   8004ec <sys_futex_wait>
+  8028fe:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802900:	83 c4 10             	add    $0x10,%esp
+  802903:	be 02 00 00 00       	mov    $0x2,%esi
+  802908:	eb 10                	jmp    80291a <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80290a:	83 ec 04             	sub    $0x4,%esp
+  80290d:	6a 00                	push   $0x0
+  80290f:	6a 02                	push   $0x2
+  802911:	53                   	push   %ebx
+  802912:	e8 d5 db ff ff       	call   8004ec <sys_futex_wait>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	89 f0                	mov    %esi,%eax
+  80291c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	75 e7                	jne    80290a <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802923:	83 ff ec             	cmp    $0xffffffec,%edi
+  802926:	74 05                	je     80292d <cond_timedwait+0x53>
+  802928:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80292d:	89 f8                	mov    %edi,%eax
+  80292f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802932:	5b                   	pop    %ebx
+  802933:	5e                   	pop    %esi
+  802934:	5f                   	pop    %edi
+  802935:	5d                   	pop    %ebp
+  802936:	c3                   	ret
+
+00802937 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80293d:	6a 00                	push   $0x0
+  80293f:	ff 75 0c             	push   0xc(%ebp)
+  802942:	ff 75 08             	push   0x8(%ebp)
+  802945:	e8 90 ff ff ff       	call   8028da <cond_timedwait>
+}
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	c9                   	leave
+  80294e:	c3                   	ret
+
+0080294f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	83 ec 10             	sub    $0x10,%esp
+  802955:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802958:	ba 01 00 00 00       	mov    $0x1,%edx
+  80295d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  802961:	6a 01                	push   $0x1
+  802963:	50                   	push   %eax
+  802964:	e8 b2 db ff ff       	call   80051b <sys_futex_wake>
+}
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+
+0080296e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80296e:	55                   	push   %ebp
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	83 ec 10             	sub    $0x10,%esp
+  802974:	8b 45 08             	mov    0x8(%ebp),%eax
+  802977:	ba 01 00 00 00       	mov    $0x1,%edx
+  80297c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  802980:	68 00 04 00 00       	push   $0x400
+  802985:	50                   	push   %eax
+  802986:	e8 90 db ff ff       	call   80051b <sys_futex_wake>
+}
+  80298b:	83 c4 10             	add    $0x10,%esp
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+
+00802990 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  802990:	55                   	push   %ebp
+  802991:	89 e5                	mov    %esp,%ebp
+  802993:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  802996:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802999:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80299b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029a2:	5d                   	pop    %ebp
+  8029a3:	c3                   	ret
+
+008029a4 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029a4:	55                   	push   %ebp
+  8029a5:	89 e5                	mov    %esp,%ebp
+  8029a7:	53                   	push   %ebx
+  8029a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029ab:	8b 11                	mov    (%ecx),%edx
+  8029ad:	85 d2                	test   %edx,%edx
+  8029af:	74 14                	je     8029c5 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029b1:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029b4:	89 d0                	mov    %edx,%eax
+  8029b6:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029ba:	39 c2                	cmp    %eax,%edx
+  8029bc:	75 ed                	jne    8029ab <sem_trywait+0x7>
+			return 0;
+  8029be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c3:	eb 05                	jmp    8029ca <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+
+008029cf <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	57                   	push   %edi
+  8029d3:	56                   	push   %esi
+  8029d4:	53                   	push   %ebx
+  8029d5:	83 ec 1c             	sub    $0x1c,%esp
+  8029d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029de:	e8 81 da ff ff       	call   800464 <sys_time_msec>
+  8029e3:	01 f8                	add    %edi,%eax
+  8029e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029e8:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029ed:	eb 28                	jmp    802a17 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f4:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8029f9:	83 ec 04             	sub    $0x4,%esp
+  8029fc:	56                   	push   %esi
+  8029fd:	6a 00                	push   $0x0
+  8029ff:	53                   	push   %ebx
+  802a00:	e8 e7 da ff ff       	call   8004ec <sys_futex_wait>
+  802a05:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a0a:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a15:	74 2e                	je     802a45 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a17:	83 ec 0c             	sub    $0xc,%esp
+  802a1a:	53                   	push   %ebx
+  802a1b:	e8 84 ff ff ff       	call   8029a4 <sem_trywait>
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	79 19                	jns    802a40 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a27:	85 ff                	test   %edi,%edi
+  802a29:	74 c4                	je     8029ef <sem_timedwait+0x20>
+  802a2b:	e8 34 da ff ff       	call   800464 <sys_time_msec>
+  802a30:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a33:	29 c6                	sub    %eax,%esi
+  802a35:	85 f6                	test   %esi,%esi
+  802a37:	7f b6                	jg     8029ef <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a39:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a3e:	eb 05                	jmp    802a45 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a48:	5b                   	pop    %ebx
+  802a49:	5e                   	pop    %esi
+  802a4a:	5f                   	pop    %edi
+  802a4b:	5d                   	pop    %ebp
+  802a4c:	c3                   	ret
+
+00802a4d <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a53:	6a 00                	push   $0x0
+  802a55:	ff 75 08             	push   0x8(%ebp)
+  802a58:	e8 72 ff ff ff       	call   8029cf <sem_timedwait>
+}
+  802a5d:	83 c4 10             	add    $0x10,%esp
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+00802a62 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	83 ec 08             	sub    $0x8,%esp
+  802a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a70:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a74:	8b 50 04             	mov    0x4(%eax),%edx
+  802a77:	85 d2                	test   %edx,%edx
+  802a79:	75 02                	jne    802a7d <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a7b:	c9                   	leave
+  802a7c:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a7d:	83 ec 08             	sub    $0x8,%esp
+  802a80:	6a 01                	push   $0x1
+  802a82:	50                   	push   %eax
+  802a83:	e8 93 da ff ff       	call   80051b <sys_futex_wake>
+  802a88:	83 c4 10             	add    $0x10,%esp
+}
+  802a8b:	eb ee                	jmp    802a7b <sem_post+0x19>
+
+00802a8d <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	57                   	push   %edi
+  802a91:	56                   	push   %esi
+  802a92:	53                   	push   %ebx
+  802a93:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802a96:	68 20 60 80 00       	push   $0x806020
+  802a9b:	e8 97 fd ff ff       	call   802837 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802aa0:	a1 44 60 80 00       	mov    0x806044,%eax
+  802aa5:	83 c4 10             	add    $0x10,%esp
+  802aa8:	85 c0                	test   %eax,%eax
+  802aaa:	75 19                	jne    802ac5 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802aac:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802ab1:	8b 00                	mov    (%eax),%eax
+  802ab3:	8b 40 48             	mov    0x48(%eax),%eax
+  802ab6:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802abb:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802ac2:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ac5:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802aca:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802acd:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ad4:	8b 40 04             	mov    0x4(%eax),%eax
+  802ad7:	85 c0                	test   %eax,%eax
+  802ad9:	0f 84 e4 00 00 00    	je     802bc3 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802adf:	83 c3 01             	add    $0x1,%ebx
+  802ae2:	83 fb 20             	cmp    $0x20,%ebx
+  802ae5:	75 e3                	jne    802aca <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802ae7:	83 ec 0c             	sub    $0xc,%esp
+  802aea:	68 20 60 80 00       	push   $0x806020
+  802aef:	e8 b0 fd ff ff       	call   8028a4 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802af4:	83 c4 10             	add    $0x10,%esp
+  802af7:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802afc:	e9 b8 00 00 00       	jmp    802bb9 <pthread_create+0x12c>
+  802b01:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b04:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b07:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b09:	39 f3                	cmp    %esi,%ebx
+  802b0b:	73 16                	jae    802b23 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b0d:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b13:	83 ec 08             	sub    $0x8,%esp
+  802b16:	56                   	push   %esi
+  802b17:	6a 00                	push   $0x0
+  802b19:	e8 52 d7 ff ff       	call   800270 <sys_page_unmap>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+  802b21:	eb e6                	jmp    802b09 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b23:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b26:	83 ec 08             	sub    $0x8,%esp
+  802b29:	ff 75 e4             	push   -0x1c(%ebp)
+  802b2c:	6a 00                	push   $0x0
+  802b2e:	e8 3d d7 ff ff       	call   800270 <sys_page_unmap>
+	return r;
+  802b33:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b36:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b39:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b40:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b47:	eb 70                	jmp    802bb9 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b49:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b4c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b56:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b59:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b5c:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b5f:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b66:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b6b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b6e:	29 c8                	sub    %ecx,%eax
+  802b70:	85 db                	test   %ebx,%ebx
+  802b72:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b79:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b7c:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b83:	83 ec 04             	sub    $0x4,%esp
+  802b86:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b8b:	29 ca                	sub    %ecx,%edx
+  802b8d:	52                   	push   %edx
+	*--esp = 0;
+  802b8e:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b91:	50                   	push   %eax
+  802b92:	68 ea 2d 80 00       	push   $0x802dea
+  802b97:	e8 24 da ff ff       	call   8005c0 <sys_thread_create>
+  802b9c:	89 c7                	mov    %eax,%edi
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 91                	js     802b36 <pthread_create+0xa9>
+	th->th_env = id;
+  802ba5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ba8:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802baf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb2:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bb9:	89 f8                	mov    %edi,%eax
+  802bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbe:	5b                   	pop    %ebx
+  802bbf:	5e                   	pop    %esi
+  802bc0:	5f                   	pop    %edi
+  802bc1:	5d                   	pop    %ebp
+  802bc2:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bc3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bc6:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bcd:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802bd4:	83 ec 0c             	sub    $0xc,%esp
+  802bd7:	68 20 60 80 00       	push   $0x806020
+  802bdc:	e8 c3 fc ff ff       	call   8028a4 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802be1:	89 d9                	mov    %ebx,%ecx
+  802be3:	c1 e1 10             	shl    $0x10,%ecx
+  802be6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802be9:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802bee:	29 c8                	sub    %ecx,%eax
+  802bf0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802bf3:	c1 e8 16             	shr    $0x16,%eax
+  802bf6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	a8 01                	test   $0x1,%al
+  802c02:	74 15                	je     802c19 <pthread_create+0x18c>
+  802c04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c07:	c1 e8 0c             	shr    $0xc,%eax
+  802c0a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c11:	a8 01                	test   $0x1,%al
+  802c13:	0f 85 30 ff ff ff    	jne    802b49 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c19:	83 ec 04             	sub    $0x4,%esp
+  802c1c:	6a 07                	push   $0x7
+  802c1e:	ff 75 e4             	push   -0x1c(%ebp)
+  802c21:	6a 00                	push   $0x0
+  802c23:	e8 af d5 ff ff       	call   8001d7 <sys_page_alloc>
+  802c28:	89 c7                	mov    %eax,%edi
+  802c2a:	83 c4 10             	add    $0x10,%esp
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	0f 88 01 ff ff ff    	js     802b36 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c35:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c3a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c3d:	29 d0                	sub    %edx,%eax
+  802c3f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c42:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c44:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c49:	29 d0                	sub    %edx,%eax
+  802c4b:	89 c7                	mov    %eax,%edi
+  802c4d:	39 fe                	cmp    %edi,%esi
+  802c4f:	0f 83 f4 fe ff ff    	jae    802b49 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c55:	83 ec 04             	sub    $0x4,%esp
+  802c58:	6a 07                	push   $0x7
+  802c5a:	56                   	push   %esi
+  802c5b:	6a 00                	push   $0x0
+  802c5d:	e8 75 d5 ff ff       	call   8001d7 <sys_page_alloc>
+  802c62:	83 c4 10             	add    $0x10,%esp
+  802c65:	85 c0                	test   %eax,%eax
+  802c67:	0f 88 94 fe ff ff    	js     802b01 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c6d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c73:	eb d8                	jmp    802c4d <pthread_create+0x1c0>
+
+00802c75 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c75:	55                   	push   %ebp
+  802c76:	89 e5                	mov    %esp,%ebp
+  802c78:	57                   	push   %edi
+  802c79:	56                   	push   %esi
+  802c7a:	53                   	push   %ebx
+  802c7b:	83 ec 0c             	sub    $0xc,%esp
+  802c7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c81:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c84:	83 f8 1e             	cmp    $0x1e,%eax
+  802c87:	0f 87 c7 00 00 00    	ja     802d54 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c8d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c8f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802c95:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802c9a:	77 12                	ja     802cae <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802c9c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ca1:	29 d0                	sub    %edx,%eax
+  802ca3:	c1 e8 10             	shr    $0x10,%eax
+  802ca6:	39 c3                	cmp    %eax,%ebx
+  802ca8:	0f 84 ad 00 00 00    	je     802d5b <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cae:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cb1:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cb8:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cbf:	eb 10                	jmp    802cd1 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cc1:	83 ec 04             	sub    $0x4,%esp
+  802cc4:	6a 00                	push   $0x0
+  802cc6:	6a 01                	push   $0x1
+  802cc8:	57                   	push   %edi
+  802cc9:	e8 1e d8 ff ff       	call   8004ec <sys_futex_wait>
+  802cce:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cd1:	8b 46 04             	mov    0x4(%esi),%eax
+  802cd4:	83 f8 01             	cmp    $0x1,%eax
+  802cd7:	74 e8                	je     802cc1 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802cd9:	83 f8 02             	cmp    $0x2,%eax
+  802cdc:	0f 85 80 00 00 00    	jne    802d62 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802ce2:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802ce5:	c1 e6 02             	shl    $0x2,%esi
+  802ce8:	eb 05                	jmp    802cef <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802cea:	e8 bc d4 ff ff       	call   8001ab <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cef:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802cf5:	89 ca                	mov    %ecx,%edx
+  802cf7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802cfd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d00:	c1 e0 04             	shl    $0x4,%eax
+  802d03:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d08:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d0b:	39 c1                	cmp    %eax,%ecx
+  802d0d:	75 12                	jne    802d21 <pthread_join+0xac>
+  802d0f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d12:	c1 e0 04             	shl    $0x4,%eax
+  802d15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d1a:	8b 40 54             	mov    0x54(%eax),%eax
+  802d1d:	85 c0                	test   %eax,%eax
+  802d1f:	75 c9                	jne    802cea <pthread_join+0x75>
+	if (ret_store)
+  802d21:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d25:	74 0f                	je     802d36 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d27:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d2a:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d31:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d34:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d36:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d39:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d40:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4f:	5b                   	pop    %ebx
+  802d50:	5e                   	pop    %esi
+  802d51:	5f                   	pop    %edi
+  802d52:	5d                   	pop    %ebp
+  802d53:	c3                   	ret
+		return -E_INVAL;
+  802d54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d59:	eb f1                	jmp    802d4c <pthread_join+0xd7>
+  802d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d60:	eb ea                	jmp    802d4c <pthread_join+0xd7>
+		return -E_INVAL;
+  802d62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d67:	eb e3                	jmp    802d4c <pthread_join+0xd7>
+
+00802d69 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d69:	55                   	push   %ebp
+  802d6a:	89 e5                	mov    %esp,%ebp
+  802d6c:	53                   	push   %ebx
+  802d6d:	83 ec 04             	sub    $0x4,%esp
+  802d70:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d72:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d78:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d7d:	77 0c                	ja     802d8b <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d7f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d84:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d86:	c1 e8 10             	shr    $0x10,%eax
+  802d89:	75 0a                	jne    802d95 <pthread_exit+0x2c>
+		exit();
+  802d8b:	e8 25 d3 ff ff       	call   8000b5 <exit>
+  802d90:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802d95:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802d9c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802d9f:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802da6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802da9:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802dac:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802db3:	83 ec 08             	sub    $0x8,%esp
+  802db6:	6a 20                	push   $0x20
+  802db8:	01 c2                	add    %eax,%edx
+  802dba:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dc1:	50                   	push   %eax
+  802dc2:	e8 54 d7 ff ff       	call   80051b <sys_futex_wake>
+	sys_env_destroy(0);
+  802dc7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802dce:	e8 61 d3 ff ff       	call   800134 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802dd3:	83 c4 0c             	add    $0xc,%esp
+  802dd6:	68 7e 48 80 00       	push   $0x80487e
+  802ddb:	68 a5 00 00 00       	push   $0xa5
+  802de0:	68 98 48 80 00       	push   $0x804898
+  802de5:	e8 cd 03 00 00       	call   8031b7 <_panic>
+
+00802dea <pthread_start>:
+{
+  802dea:	55                   	push   %ebp
+  802deb:	89 e5                	mov    %esp,%ebp
+  802ded:	53                   	push   %ebx
+  802dee:	83 ec 04             	sub    $0x4,%esp
+  802df1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802df4:	e8 86 d3 ff ff       	call   80017f <sys_getenvid>
+  802df9:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802dfe:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e04:	85 db                	test   %ebx,%ebx
+  802e06:	74 0c                	je     802e14 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e08:	89 d9                	mov    %ebx,%ecx
+  802e0a:	c1 e1 10             	shl    $0x10,%ecx
+  802e0d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e12:	29 ca                	sub    %ecx,%edx
+  802e14:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e17:	c1 e0 04             	shl    $0x4,%eax
+  802e1a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e1f:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e21:	83 ec 0c             	sub    $0xc,%esp
+  802e24:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e2b:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e2e:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e35:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e3c:	89 04 24             	mov    %eax,(%esp)
+  802e3f:	e8 25 ff ff ff       	call   802d69 <pthread_exit>
+
+00802e44 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	57                   	push   %edi
+  802e48:	56                   	push   %esi
+  802e49:	53                   	push   %ebx
+  802e4a:	83 ec 1c             	sub    $0x1c,%esp
+  802e4d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e4f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e55:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e5c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e61:	77 0d                	ja     802e70 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e63:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e68:	29 d0                	sub    %edx,%eax
+  802e6a:	c1 e8 10             	shr    $0x10,%eax
+  802e6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e75:	eb 2f                	jmp    802ea6 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e77:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e7d:	8b 01                	mov    (%ecx),%eax
+  802e7f:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e82:	39 c2                	cmp    %eax,%edx
+  802e84:	75 14                	jne    802e9a <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e86:	83 ec 0c             	sub    $0xc,%esp
+  802e89:	57                   	push   %edi
+  802e8a:	e8 a5 d2 ff ff       	call   800134 <sys_env_destroy>
+  802e8f:	83 c4 10             	add    $0x10,%esp
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	0f 88 97 00 00 00    	js     802f31 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e9a:	83 c3 01             	add    $0x1,%ebx
+  802e9d:	83 fb 20             	cmp    $0x20,%ebx
+  802ea0:	0f 84 d2 00 00 00    	je     802f78 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802ea6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ea9:	74 ef                	je     802e9a <pthread_kill_others+0x56>
+  802eab:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802eae:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802eb5:	8b 40 04             	mov    0x4(%eax),%eax
+  802eb8:	83 f8 01             	cmp    $0x1,%eax
+  802ebb:	75 dd                	jne    802e9a <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802ebd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ec0:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ec7:	89 fe                	mov    %edi,%esi
+  802ec9:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ecf:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ed2:	c1 e0 04             	shl    $0x4,%eax
+  802ed5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eda:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802edd:	39 c7                	cmp    %eax,%edi
+  802edf:	75 b9                	jne    802e9a <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ee1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ee4:	c1 e0 04             	shl    $0x4,%eax
+  802ee7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eec:	8b 40 54             	mov    0x54(%eax),%eax
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	74 a7                	je     802e9a <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ef3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef6:	c1 e0 04             	shl    $0x4,%eax
+  802ef9:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802eff:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f01:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f07:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f0c:	0f 87 65 ff ff ff    	ja     802e77 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f12:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f17:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f19:	c1 e8 10             	shr    $0x10,%eax
+  802f1c:	0f 84 55 ff ff ff    	je     802e77 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f22:	c1 e0 10             	shl    $0x10,%eax
+  802f25:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f2a:	29 c1                	sub    %eax,%ecx
+  802f2c:	e9 4c ff ff ff       	jmp    802e7d <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f31:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f34:	c1 e2 04             	shl    $0x4,%edx
+  802f37:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f3d:	8b 52 48             	mov    0x48(%edx),%edx
+  802f40:	39 fa                	cmp    %edi,%edx
+  802f42:	0f 85 52 ff ff ff    	jne    802e9a <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f48:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f4b:	c1 e2 04             	shl    $0x4,%edx
+  802f4e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f54:	8b 52 54             	mov    0x54(%edx),%edx
+  802f57:	85 d2                	test   %edx,%edx
+  802f59:	0f 84 3b ff ff ff    	je     802e9a <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f5f:	83 ec 0c             	sub    $0xc,%esp
+  802f62:	50                   	push   %eax
+  802f63:	57                   	push   %edi
+  802f64:	68 a8 48 80 00       	push   $0x8048a8
+  802f69:	68 bb 00 00 00       	push   $0xbb
+  802f6e:	68 98 48 80 00       	push   $0x804898
+  802f73:	e8 3f 02 00 00       	call   8031b7 <_panic>
+	}
+}
+  802f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f7b:	5b                   	pop    %ebx
+  802f7c:	5e                   	pop    %esi
+  802f7d:	5f                   	pop    %edi
+  802f7e:	5d                   	pop    %ebp
+  802f7f:	c3                   	ret
+
+00802f80 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f80:	55                   	push   %ebp
+  802f81:	89 e5                	mov    %esp,%ebp
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 04             	sub    $0x4,%esp
+  802f87:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f89:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f8f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f95:	0f 87 85 00 00 00    	ja     803020 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f9b:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fa0:	29 c3                	sub    %eax,%ebx
+  802fa2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fa5:	83 ec 04             	sub    $0x4,%esp
+  802fa8:	68 80 02 00 00       	push   $0x280
+  802fad:	6a 00                	push   $0x0
+  802faf:	68 40 60 80 00       	push   $0x806040
+  802fb4:	e8 0e 0a 00 00       	call   8039c7 <memset>
+	threads_mu.m_state = 0;
+  802fb9:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fc0:	00 00 00 
+	if (self != 0) {
+  802fc3:	83 c4 10             	add    $0x10,%esp
+  802fc6:	85 db                	test   %ebx,%ebx
+  802fc8:	74 51                	je     80301b <pthread_fork_child+0x9b>
+  802fca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fcc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fd2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fd7:	77 18                	ja     802ff1 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fd9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fde:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fe0:	c1 e8 10             	shr    $0x10,%eax
+  802fe3:	74 0c                	je     802ff1 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fe5:	c1 e0 10             	shl    $0x10,%eax
+  802fe8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fed:	29 c2                	sub    %eax,%edx
+  802fef:	eb 06                	jmp    802ff7 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  802ff1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  802ff7:	8b 02                	mov    (%edx),%eax
+  802ff9:	8b 48 48             	mov    0x48(%eax),%ecx
+  802ffc:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803003:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803006:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80300d:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803014:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80301b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301e:	c9                   	leave
+  80301f:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803020:	83 ec 04             	sub    $0x4,%esp
+  803023:	68 80 02 00 00       	push   $0x280
+  803028:	6a 00                	push   $0x0
+  80302a:	68 40 60 80 00       	push   $0x806040
+  80302f:	e8 93 09 00 00       	call   8039c7 <memset>
+	threads_mu.m_state = 0;
+  803034:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80303b:	00 00 00 
+  80303e:	83 c4 10             	add    $0x10,%esp
+  803041:	eb d8                	jmp    80301b <pthread_fork_child+0x9b>
+
+00803043 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	c3                   	ret
+
+00803049 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803049:	55                   	push   %ebp
+  80304a:	89 e5                	mov    %esp,%ebp
+  80304c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80304f:	68 cd 48 80 00       	push   $0x8048cd
+  803054:	ff 75 0c             	push   0xc(%ebp)
+  803057:	e8 1a 08 00 00       	call   803876 <strcpy>
+	return 0;
+}
+  80305c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+
+00803063 <devcons_write>:
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	57                   	push   %edi
+  803067:	56                   	push   %esi
+  803068:	53                   	push   %ebx
+  803069:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80306f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803074:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80307a:	eb 2e                	jmp    8030aa <devcons_write+0x47>
+		m = n - tot;
+  80307c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80307f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803081:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803086:	39 c3                	cmp    %eax,%ebx
+  803088:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80308b:	83 ec 04             	sub    $0x4,%esp
+  80308e:	53                   	push   %ebx
+  80308f:	89 f0                	mov    %esi,%eax
+  803091:	03 45 0c             	add    0xc(%ebp),%eax
+  803094:	50                   	push   %eax
+  803095:	57                   	push   %edi
+  803096:	e8 61 09 00 00       	call   8039fc <memmove>
+		sys_cputs(buf, m);
+  80309b:	83 c4 08             	add    $0x8,%esp
+  80309e:	53                   	push   %ebx
+  80309f:	57                   	push   %edi
+  8030a0:	e8 38 d0 ff ff       	call   8000dd <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030a5:	01 de                	add    %ebx,%esi
+  8030a7:	83 c4 10             	add    $0x10,%esp
+  8030aa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030ad:	72 cd                	jb     80307c <devcons_write+0x19>
+}
+  8030af:	89 f0                	mov    %esi,%eax
+  8030b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b4:	5b                   	pop    %ebx
+  8030b5:	5e                   	pop    %esi
+  8030b6:	5f                   	pop    %edi
+  8030b7:	5d                   	pop    %ebp
+  8030b8:	c3                   	ret
+
+008030b9 <devcons_read>:
+{
+  8030b9:	55                   	push   %ebp
+  8030ba:	89 e5                	mov    %esp,%ebp
+  8030bc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030c8:	75 07                	jne    8030d1 <devcons_read+0x18>
+  8030ca:	eb 1f                	jmp    8030eb <devcons_read+0x32>
+		sys_yield();
+  8030cc:	e8 da d0 ff ff       	call   8001ab <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030d1:	e8 32 d0 ff ff       	call   800108 <sys_cgetc>
+  8030d6:	85 c0                	test   %eax,%eax
+  8030d8:	74 f2                	je     8030cc <devcons_read+0x13>
+	if (c < 0)
+  8030da:	78 0f                	js     8030eb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030dc:	83 f8 04             	cmp    $0x4,%eax
+  8030df:	74 0c                	je     8030ed <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030e4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030e6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030eb:	c9                   	leave
+  8030ec:	c3                   	ret
+		return 0;
+  8030ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f2:	eb f7                	jmp    8030eb <devcons_read+0x32>
+
+008030f4 <cputchar>:
+{
+  8030f4:	55                   	push   %ebp
+  8030f5:	89 e5                	mov    %esp,%ebp
+  8030f7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fd:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803100:	6a 01                	push   $0x1
+  803102:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803105:	50                   	push   %eax
+  803106:	e8 d2 cf ff ff       	call   8000dd <sys_cputs>
+}
+  80310b:	83 c4 10             	add    $0x10,%esp
+  80310e:	c9                   	leave
+  80310f:	c3                   	ret
+
+00803110 <getchar>:
+{
+  803110:	55                   	push   %ebp
+  803111:	89 e5                	mov    %esp,%ebp
+  803113:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803116:	6a 01                	push   $0x1
+  803118:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80311b:	50                   	push   %eax
+  80311c:	6a 00                	push   $0x0
+  80311e:	e8 63 d8 ff ff       	call   800986 <read>
+	if (r < 0)
+  803123:	83 c4 10             	add    $0x10,%esp
+  803126:	85 c0                	test   %eax,%eax
+  803128:	78 06                	js     803130 <getchar+0x20>
+	if (r < 1)
+  80312a:	74 06                	je     803132 <getchar+0x22>
+	return c;
+  80312c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803130:	c9                   	leave
+  803131:	c3                   	ret
+		return -E_EOF;
+  803132:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803137:	eb f7                	jmp    803130 <getchar+0x20>
+
+00803139 <iscons>:
+{
+  803139:	55                   	push   %ebp
+  80313a:	89 e5                	mov    %esp,%ebp
+  80313c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80313f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803142:	50                   	push   %eax
+  803143:	ff 75 08             	push   0x8(%ebp)
+  803146:	e8 ab d5 ff ff       	call   8006f6 <fd_lookup>
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	85 c0                	test   %eax,%eax
+  803150:	78 11                	js     803163 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803155:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80315b:	39 10                	cmp    %edx,(%eax)
+  80315d:	0f 94 c0             	sete   %al
+  803160:	0f b6 c0             	movzbl %al,%eax
+}
+  803163:	c9                   	leave
+  803164:	c3                   	ret
+
+00803165 <opencons>:
+{
+  803165:	55                   	push   %ebp
+  803166:	89 e5                	mov    %esp,%ebp
+  803168:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80316b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80316e:	50                   	push   %eax
+  80316f:	e8 2c d5 ff ff       	call   8006a0 <fd_alloc>
+  803174:	83 c4 10             	add    $0x10,%esp
+  803177:	85 c0                	test   %eax,%eax
+  803179:	78 3a                	js     8031b5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80317b:	83 ec 04             	sub    $0x4,%esp
+  80317e:	68 07 04 00 00       	push   $0x407
+  803183:	ff 75 f4             	push   -0xc(%ebp)
+  803186:	6a 00                	push   $0x0
+  803188:	e8 4a d0 ff ff       	call   8001d7 <sys_page_alloc>
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	85 c0                	test   %eax,%eax
+  803192:	78 21                	js     8031b5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803194:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803197:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80319d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80319f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031a9:	83 ec 0c             	sub    $0xc,%esp
+  8031ac:	50                   	push   %eax
+  8031ad:	e8 c7 d4 ff ff       	call   800679 <fd2num>
+  8031b2:	83 c4 10             	add    $0x10,%esp
+}
+  8031b5:	c9                   	leave
+  8031b6:	c3                   	ret
+
+008031b7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031b7:	55                   	push   %ebp
+  8031b8:	89 e5                	mov    %esp,%ebp
+  8031ba:	56                   	push   %esi
+  8031bb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031bc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031bf:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031c5:	e8 b5 cf ff ff       	call   80017f <sys_getenvid>
+  8031ca:	83 ec 0c             	sub    $0xc,%esp
+  8031cd:	ff 75 0c             	push   0xc(%ebp)
+  8031d0:	ff 75 08             	push   0x8(%ebp)
+  8031d3:	56                   	push   %esi
+  8031d4:	50                   	push   %eax
+  8031d5:	68 dc 48 80 00       	push   $0x8048dc
+  8031da:	e8 b3 00 00 00       	call   803292 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031df:	83 c4 18             	add    $0x18,%esp
+  8031e2:	53                   	push   %ebx
+  8031e3:	ff 75 10             	push   0x10(%ebp)
+  8031e6:	e8 56 00 00 00       	call   803241 <vcprintf>
+	cprintf("\n");
+  8031eb:	c7 04 24 b2 4d 80 00 	movl   $0x804db2,(%esp)
+  8031f2:	e8 9b 00 00 00       	call   803292 <cprintf>
+  8031f7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8031fa:	cc                   	int3
+	while (1)
+  8031fb:	eb fd                	jmp    8031fa <_panic+0x43>
+
+008031fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8031fd:	55                   	push   %ebp
+  8031fe:	89 e5                	mov    %esp,%ebp
+  803200:	53                   	push   %ebx
+  803201:	83 ec 04             	sub    $0x4,%esp
+  803204:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803207:	8b 13                	mov    (%ebx),%edx
+  803209:	8d 42 01             	lea    0x1(%edx),%eax
+  80320c:	89 03                	mov    %eax,(%ebx)
+  80320e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803211:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803215:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80321a:	74 09                	je     803225 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80321c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803220:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803223:	c9                   	leave
+  803224:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803225:	83 ec 08             	sub    $0x8,%esp
+  803228:	68 ff 00 00 00       	push   $0xff
+  80322d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803230:	50                   	push   %eax
+  803231:	e8 a7 ce ff ff       	call   8000dd <sys_cputs>
+		b->idx = 0;
+  803236:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	eb db                	jmp    80321c <putch+0x1f>
+
+00803241 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803241:	55                   	push   %ebp
+  803242:	89 e5                	mov    %esp,%ebp
+  803244:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80324a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803251:	00 00 00 
+	b.cnt = 0;
+  803254:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80325b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80325e:	ff 75 0c             	push   0xc(%ebp)
+  803261:	ff 75 08             	push   0x8(%ebp)
+  803264:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80326a:	50                   	push   %eax
+  80326b:	68 fd 31 80 00       	push   $0x8031fd
+  803270:	e8 14 01 00 00       	call   803389 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803275:	83 c4 08             	add    $0x8,%esp
+  803278:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80327e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803284:	50                   	push   %eax
+  803285:	e8 53 ce ff ff       	call   8000dd <sys_cputs>
+
+	return b.cnt;
+}
+  80328a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  803290:	c9                   	leave
+  803291:	c3                   	ret
+
+00803292 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  803292:	55                   	push   %ebp
+  803293:	89 e5                	mov    %esp,%ebp
+  803295:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803298:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80329b:	50                   	push   %eax
+  80329c:	ff 75 08             	push   0x8(%ebp)
+  80329f:	e8 9d ff ff ff       	call   803241 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+008032a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	57                   	push   %edi
+  8032aa:	56                   	push   %esi
+  8032ab:	53                   	push   %ebx
+  8032ac:	83 ec 1c             	sub    $0x1c,%esp
+  8032af:	89 c7                	mov    %eax,%edi
+  8032b1:	89 d6                	mov    %edx,%esi
+  8032b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b9:	89 d1                	mov    %edx,%ecx
+  8032bb:	89 c2                	mov    %eax,%edx
+  8032bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032d3:	39 c2                	cmp    %eax,%edx
+  8032d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032d8:	72 3e                	jb     803318 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032da:	83 ec 0c             	sub    $0xc,%esp
+  8032dd:	ff 75 18             	push   0x18(%ebp)
+  8032e0:	83 eb 01             	sub    $0x1,%ebx
+  8032e3:	53                   	push   %ebx
+  8032e4:	50                   	push   %eax
+  8032e5:	83 ec 08             	sub    $0x8,%esp
+  8032e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8032eb:	ff 75 e0             	push   -0x20(%ebp)
+  8032ee:	ff 75 dc             	push   -0x24(%ebp)
+  8032f1:	ff 75 d8             	push   -0x28(%ebp)
+  8032f4:	e8 47 12 00 00       	call   804540 <__udivdi3>
+  8032f9:	83 c4 18             	add    $0x18,%esp
+  8032fc:	52                   	push   %edx
+  8032fd:	50                   	push   %eax
+  8032fe:	89 f2                	mov    %esi,%edx
+  803300:	89 f8                	mov    %edi,%eax
+  803302:	e8 9f ff ff ff       	call   8032a6 <printnum>
+  803307:	83 c4 20             	add    $0x20,%esp
+  80330a:	eb 13                	jmp    80331f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80330c:	83 ec 08             	sub    $0x8,%esp
+  80330f:	56                   	push   %esi
+  803310:	ff 75 18             	push   0x18(%ebp)
+  803313:	ff d7                	call   *%edi
+  803315:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803318:	83 eb 01             	sub    $0x1,%ebx
+  80331b:	85 db                	test   %ebx,%ebx
+  80331d:	7f ed                	jg     80330c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80331f:	83 ec 08             	sub    $0x8,%esp
+  803322:	56                   	push   %esi
+  803323:	83 ec 04             	sub    $0x4,%esp
+  803326:	ff 75 e4             	push   -0x1c(%ebp)
+  803329:	ff 75 e0             	push   -0x20(%ebp)
+  80332c:	ff 75 dc             	push   -0x24(%ebp)
+  80332f:	ff 75 d8             	push   -0x28(%ebp)
+  803332:	e8 2a 12 00 00       	call   804561 <__umoddi3>
+  803337:	83 c4 14             	add    $0x14,%esp
+  80333a:	0f be 80 ff 48 80 00 	movsbl 0x8048ff(%eax),%eax
+  803341:	50                   	push   %eax
+  803342:	ff d7                	call   *%edi
+}
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334a:	5b                   	pop    %ebx
+  80334b:	5e                   	pop    %esi
+  80334c:	5f                   	pop    %edi
+  80334d:	5d                   	pop    %ebp
+  80334e:	c3                   	ret
+
+0080334f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80334f:	55                   	push   %ebp
+  803350:	89 e5                	mov    %esp,%ebp
+  803352:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803355:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803359:	8b 10                	mov    (%eax),%edx
+  80335b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80335e:	73 0a                	jae    80336a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803360:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803363:	89 08                	mov    %ecx,(%eax)
+  803365:	8b 45 08             	mov    0x8(%ebp),%eax
+  803368:	88 02                	mov    %al,(%edx)
+}
+  80336a:	5d                   	pop    %ebp
+  80336b:	c3                   	ret
+
+0080336c <printfmt>:
+{
+  80336c:	55                   	push   %ebp
+  80336d:	89 e5                	mov    %esp,%ebp
+  80336f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803372:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803375:	50                   	push   %eax
+  803376:	ff 75 10             	push   0x10(%ebp)
+  803379:	ff 75 0c             	push   0xc(%ebp)
+  80337c:	ff 75 08             	push   0x8(%ebp)
+  80337f:	e8 05 00 00 00       	call   803389 <vprintfmt>
+}
+  803384:	83 c4 10             	add    $0x10,%esp
+  803387:	c9                   	leave
+  803388:	c3                   	ret
+
+00803389 <vprintfmt>:
+{
+  803389:	55                   	push   %ebp
+  80338a:	89 e5                	mov    %esp,%ebp
+  80338c:	57                   	push   %edi
+  80338d:	56                   	push   %esi
+  80338e:	53                   	push   %ebx
+  80338f:	83 ec 2c             	sub    $0x2c,%esp
+  803392:	8b 75 08             	mov    0x8(%ebp),%esi
+  803395:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803398:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80339b:	eb 0a                	jmp    8033a7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80339d:	83 ec 08             	sub    $0x8,%esp
+  8033a0:	53                   	push   %ebx
+  8033a1:	50                   	push   %eax
+  8033a2:	ff d6                	call   *%esi
+  8033a4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033a7:	83 c7 01             	add    $0x1,%edi
+  8033aa:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033ae:	83 f8 25             	cmp    $0x25,%eax
+  8033b1:	74 0c                	je     8033bf <vprintfmt+0x36>
+			if (ch == '\0')
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	75 e6                	jne    80339d <vprintfmt+0x14>
+}
+  8033b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ba:	5b                   	pop    %ebx
+  8033bb:	5e                   	pop    %esi
+  8033bc:	5f                   	pop    %edi
+  8033bd:	5d                   	pop    %ebp
+  8033be:	c3                   	ret
+		padc = ' ';
+  8033bf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033d1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8033e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033e3:	0f b6 17             	movzbl (%edi),%edx
+  8033e6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033e9:	3c 55                	cmp    $0x55,%al
+  8033eb:	0f 87 c5 03 00 00    	ja     8037b6 <vprintfmt+0x42d>
+  8033f1:	0f b6 c0             	movzbl %al,%eax
+  8033f4:	ff 24 85 80 4a 80 00 	jmp    *0x804a80(,%eax,4)
+  8033fb:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8033fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803401:	eb da                	jmp    8033dd <vprintfmt+0x54>
+  803403:	0f be d2             	movsbl %dl,%edx
+  803406:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803411:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803414:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803418:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80341b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80341e:	83 f9 09             	cmp    $0x9,%ecx
+  803421:	77 55                	ja     803478 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803423:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803426:	eb e9                	jmp    803411 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803428:	8b 45 14             	mov    0x14(%ebp),%eax
+  80342b:	8b 00                	mov    (%eax),%eax
+  80342d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803430:	8b 45 14             	mov    0x14(%ebp),%eax
+  803433:	8d 40 04             	lea    0x4(%eax),%eax
+  803436:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803439:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80343c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803440:	79 9b                	jns    8033dd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803442:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803445:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803448:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80344f:	eb 8c                	jmp    8033dd <vprintfmt+0x54>
+			if (width < 0)
+  803451:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803454:	85 d2                	test   %edx,%edx
+  803456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345b:	0f 49 c2             	cmovns %edx,%eax
+  80345e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  803461:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803464:	e9 74 ff ff ff       	jmp    8033dd <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803469:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80346c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803473:	e9 65 ff ff ff       	jmp    8033dd <vprintfmt+0x54>
+  803478:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80347b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80347e:	eb bc                	jmp    80343c <vprintfmt+0xb3>
+			lflag++;
+  803480:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  803483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803486:	e9 52 ff ff ff       	jmp    8033dd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80348b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80348e:	8d 78 04             	lea    0x4(%eax),%edi
+  803491:	83 ec 08             	sub    $0x8,%esp
+  803494:	53                   	push   %ebx
+  803495:	ff 30                	push   (%eax)
+  803497:	ff d6                	call   *%esi
+			break;
+  803499:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80349c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80349f:	e9 b1 02 00 00       	jmp    803755 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034a7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034aa:	8b 10                	mov    (%eax),%edx
+  8034ac:	89 d0                	mov    %edx,%eax
+  8034ae:	f7 d8                	neg    %eax
+  8034b0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034b3:	83 f8 14             	cmp    $0x14,%eax
+  8034b6:	7f 23                	jg     8034db <vprintfmt+0x152>
+  8034b8:	8b 14 85 e0 4b 80 00 	mov    0x804be0(,%eax,4),%edx
+  8034bf:	85 d2                	test   %edx,%edx
+  8034c1:	74 18                	je     8034db <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034c3:	52                   	push   %edx
+  8034c4:	68 a7 47 80 00       	push   $0x8047a7
+  8034c9:	53                   	push   %ebx
+  8034ca:	56                   	push   %esi
+  8034cb:	e8 9c fe ff ff       	call   80336c <printfmt>
+  8034d0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034d3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034d6:	e9 7a 02 00 00       	jmp    803755 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034db:	50                   	push   %eax
+  8034dc:	68 17 49 80 00       	push   $0x804917
+  8034e1:	53                   	push   %ebx
+  8034e2:	56                   	push   %esi
+  8034e3:	e8 84 fe ff ff       	call   80336c <printfmt>
+  8034e8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034eb:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034ee:	e9 62 02 00 00       	jmp    803755 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8034f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034f6:	83 c0 04             	add    $0x4,%eax
+  8034f9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8034fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034ff:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803501:	85 c9                	test   %ecx,%ecx
+  803503:	b8 10 49 80 00       	mov    $0x804910,%eax
+  803508:	0f 45 c1             	cmovne %ecx,%eax
+  80350b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80350e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803512:	7e 06                	jle    80351a <vprintfmt+0x191>
+  803514:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803518:	75 0b                	jne    803525 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80351a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80351d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803520:	89 75 08             	mov    %esi,0x8(%ebp)
+  803523:	eb 5c                	jmp    803581 <vprintfmt+0x1f8>
+  803525:	83 ec 08             	sub    $0x8,%esp
+  803528:	ff 75 d0             	push   -0x30(%ebp)
+  80352b:	ff 75 cc             	push   -0x34(%ebp)
+  80352e:	e8 20 03 00 00       	call   803853 <strnlen>
+  803533:	89 c2                	mov    %eax,%edx
+  803535:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803538:	29 d0                	sub    %edx,%eax
+  80353a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80353d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803541:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803544:	89 75 08             	mov    %esi,0x8(%ebp)
+  803547:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803549:	eb 0e                	jmp    803559 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80354b:	83 ec 08             	sub    $0x8,%esp
+  80354e:	53                   	push   %ebx
+  80354f:	57                   	push   %edi
+  803550:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803553:	83 ee 01             	sub    $0x1,%esi
+  803556:	83 c4 10             	add    $0x10,%esp
+  803559:	85 f6                	test   %esi,%esi
+  80355b:	7f ee                	jg     80354b <vprintfmt+0x1c2>
+  80355d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803560:	8b 75 08             	mov    0x8(%ebp),%esi
+  803563:	85 c0                	test   %eax,%eax
+  803565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356a:	0f 49 d0             	cmovns %eax,%edx
+  80356d:	29 d0                	sub    %edx,%eax
+  80356f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803572:	eb a6                	jmp    80351a <vprintfmt+0x191>
+					putch(ch, putdat);
+  803574:	83 ec 08             	sub    $0x8,%esp
+  803577:	53                   	push   %ebx
+  803578:	52                   	push   %edx
+  803579:	ff 55 08             	call   *0x8(%ebp)
+  80357c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80357f:	89 f1                	mov    %esi,%ecx
+  803581:	8d 71 01             	lea    0x1(%ecx),%esi
+  803584:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803588:	0f be d0             	movsbl %al,%edx
+  80358b:	85 d2                	test   %edx,%edx
+  80358d:	74 28                	je     8035b7 <vprintfmt+0x22e>
+  80358f:	85 ff                	test   %edi,%edi
+  803591:	78 05                	js     803598 <vprintfmt+0x20f>
+  803593:	83 ef 01             	sub    $0x1,%edi
+  803596:	78 30                	js     8035c8 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  803598:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80359c:	74 d6                	je     803574 <vprintfmt+0x1eb>
+  80359e:	0f be c0             	movsbl %al,%eax
+  8035a1:	83 e8 20             	sub    $0x20,%eax
+  8035a4:	83 f8 5e             	cmp    $0x5e,%eax
+  8035a7:	76 cb                	jbe    803574 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035a9:	83 ec 08             	sub    $0x8,%esp
+  8035ac:	53                   	push   %ebx
+  8035ad:	6a 3f                	push   $0x3f
+  8035af:	ff 55 08             	call   *0x8(%ebp)
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	eb c8                	jmp    80357f <vprintfmt+0x1f6>
+  8035b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035bd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035c0:	01 d0                	add    %edx,%eax
+  8035c2:	29 c8                	sub    %ecx,%eax
+  8035c4:	89 c7                	mov    %eax,%edi
+  8035c6:	eb 13                	jmp    8035db <vprintfmt+0x252>
+  8035c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035cb:	eb ed                	jmp    8035ba <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035cd:	83 ec 08             	sub    $0x8,%esp
+  8035d0:	53                   	push   %ebx
+  8035d1:	6a 20                	push   $0x20
+  8035d3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035d5:	83 ef 01             	sub    $0x1,%edi
+  8035d8:	83 c4 10             	add    $0x10,%esp
+  8035db:	85 ff                	test   %edi,%edi
+  8035dd:	7f ee                	jg     8035cd <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035df:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035e5:	e9 6b 01 00 00       	jmp    803755 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035ea:	83 f9 01             	cmp    $0x1,%ecx
+  8035ed:	7f 1f                	jg     80360e <vprintfmt+0x285>
+	else if (lflag)
+  8035ef:	85 c9                	test   %ecx,%ecx
+  8035f1:	74 67                	je     80365a <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8035f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035f6:	8b 00                	mov    (%eax),%eax
+  8035f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8035fb:	89 c1                	mov    %eax,%ecx
+  8035fd:	c1 f9 1f             	sar    $0x1f,%ecx
+  803600:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803603:	8b 45 14             	mov    0x14(%ebp),%eax
+  803606:	8d 40 04             	lea    0x4(%eax),%eax
+  803609:	89 45 14             	mov    %eax,0x14(%ebp)
+  80360c:	eb 17                	jmp    803625 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80360e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803611:	8b 50 04             	mov    0x4(%eax),%edx
+  803614:	8b 00                	mov    (%eax),%eax
+  803616:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803619:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80361c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80361f:	8d 40 08             	lea    0x8(%eax),%eax
+  803622:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803625:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803628:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80362b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803630:	85 c9                	test   %ecx,%ecx
+  803632:	0f 89 03 01 00 00    	jns    80373b <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803638:	83 ec 08             	sub    $0x8,%esp
+  80363b:	53                   	push   %ebx
+  80363c:	6a 2d                	push   $0x2d
+  80363e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803640:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803643:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803646:	f7 da                	neg    %edx
+  803648:	83 d1 00             	adc    $0x0,%ecx
+  80364b:	f7 d9                	neg    %ecx
+  80364d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803650:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803655:	e9 e1 00 00 00       	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80365a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80365d:	8b 00                	mov    (%eax),%eax
+  80365f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803662:	89 c1                	mov    %eax,%ecx
+  803664:	c1 f9 1f             	sar    $0x1f,%ecx
+  803667:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80366a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80366d:	8d 40 04             	lea    0x4(%eax),%eax
+  803670:	89 45 14             	mov    %eax,0x14(%ebp)
+  803673:	eb b0                	jmp    803625 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803675:	83 f9 01             	cmp    $0x1,%ecx
+  803678:	7f 1e                	jg     803698 <vprintfmt+0x30f>
+	else if (lflag)
+  80367a:	85 c9                	test   %ecx,%ecx
+  80367c:	74 32                	je     8036b0 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80367e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803681:	8b 10                	mov    (%eax),%edx
+  803683:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803688:	8d 40 04             	lea    0x4(%eax),%eax
+  80368b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80368e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  803693:	e9 a3 00 00 00       	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80369b:	8b 10                	mov    (%eax),%edx
+  80369d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8036a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036ab:	e9 8b 00 00 00       	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036b3:	8b 10                	mov    (%eax),%edx
+  8036b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8036bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036c5:	eb 74                	jmp    80373b <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036c7:	83 f9 01             	cmp    $0x1,%ecx
+  8036ca:	7f 1b                	jg     8036e7 <vprintfmt+0x35e>
+	else if (lflag)
+  8036cc:	85 c9                	test   %ecx,%ecx
+  8036ce:	74 2c                	je     8036fc <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036d3:	8b 10                	mov    (%eax),%edx
+  8036d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036da:	8d 40 04             	lea    0x4(%eax),%eax
+  8036dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036e0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036e5:	eb 54                	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ea:	8b 10                	mov    (%eax),%edx
+  8036ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8036f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8036fa:	eb 3f                	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ff:	8b 10                	mov    (%eax),%edx
+  803701:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803706:	8d 40 04             	lea    0x4(%eax),%eax
+  803709:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80370c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803711:	eb 28                	jmp    80373b <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803713:	83 ec 08             	sub    $0x8,%esp
+  803716:	53                   	push   %ebx
+  803717:	6a 30                	push   $0x30
+  803719:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80371b:	83 c4 08             	add    $0x8,%esp
+  80371e:	53                   	push   %ebx
+  80371f:	6a 78                	push   $0x78
+  803721:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803723:	8b 45 14             	mov    0x14(%ebp),%eax
+  803726:	8b 10                	mov    (%eax),%edx
+  803728:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80372d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803730:	8d 40 04             	lea    0x4(%eax),%eax
+  803733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803736:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80373b:	83 ec 0c             	sub    $0xc,%esp
+  80373e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803742:	50                   	push   %eax
+  803743:	ff 75 e0             	push   -0x20(%ebp)
+  803746:	57                   	push   %edi
+  803747:	51                   	push   %ecx
+  803748:	52                   	push   %edx
+  803749:	89 da                	mov    %ebx,%edx
+  80374b:	89 f0                	mov    %esi,%eax
+  80374d:	e8 54 fb ff ff       	call   8032a6 <printnum>
+			break;
+  803752:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803755:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803758:	e9 4a fc ff ff       	jmp    8033a7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80375d:	83 f9 01             	cmp    $0x1,%ecx
+  803760:	7f 1b                	jg     80377d <vprintfmt+0x3f4>
+	else if (lflag)
+  803762:	85 c9                	test   %ecx,%ecx
+  803764:	74 2c                	je     803792 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803766:	8b 45 14             	mov    0x14(%ebp),%eax
+  803769:	8b 10                	mov    (%eax),%edx
+  80376b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803770:	8d 40 04             	lea    0x4(%eax),%eax
+  803773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803776:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80377b:	eb be                	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80377d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803780:	8b 10                	mov    (%eax),%edx
+  803782:	8b 48 04             	mov    0x4(%eax),%ecx
+  803785:	8d 40 08             	lea    0x8(%eax),%eax
+  803788:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80378b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  803790:	eb a9                	jmp    80373b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803792:	8b 45 14             	mov    0x14(%ebp),%eax
+  803795:	8b 10                	mov    (%eax),%edx
+  803797:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80379c:	8d 40 04             	lea    0x4(%eax),%eax
+  80379f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037a2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037a7:	eb 92                	jmp    80373b <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037a9:	83 ec 08             	sub    $0x8,%esp
+  8037ac:	53                   	push   %ebx
+  8037ad:	6a 25                	push   $0x25
+  8037af:	ff d6                	call   *%esi
+			break;
+  8037b1:	83 c4 10             	add    $0x10,%esp
+  8037b4:	eb 9f                	jmp    803755 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037b6:	83 ec 08             	sub    $0x8,%esp
+  8037b9:	53                   	push   %ebx
+  8037ba:	6a 25                	push   $0x25
+  8037bc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037be:	83 c4 10             	add    $0x10,%esp
+  8037c1:	89 f8                	mov    %edi,%eax
+  8037c3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037c7:	74 05                	je     8037ce <vprintfmt+0x445>
+  8037c9:	83 e8 01             	sub    $0x1,%eax
+  8037cc:	eb f5                	jmp    8037c3 <vprintfmt+0x43a>
+  8037ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037d1:	eb 82                	jmp    803755 <vprintfmt+0x3cc>
+
+008037d3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037d3:	55                   	push   %ebp
+  8037d4:	89 e5                	mov    %esp,%ebp
+  8037d6:	83 ec 18             	sub    $0x18,%esp
+  8037d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037e2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037e6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	74 26                	je     80381a <vsnprintf+0x47>
+  8037f4:	85 d2                	test   %edx,%edx
+  8037f6:	7e 22                	jle    80381a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8037f8:	ff 75 14             	push   0x14(%ebp)
+  8037fb:	ff 75 10             	push   0x10(%ebp)
+  8037fe:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803801:	50                   	push   %eax
+  803802:	68 4f 33 80 00       	push   $0x80334f
+  803807:	e8 7d fb ff ff       	call   803389 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80380c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80380f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803812:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803815:	83 c4 10             	add    $0x10,%esp
+}
+  803818:	c9                   	leave
+  803819:	c3                   	ret
+		return -E_INVAL;
+  80381a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80381f:	eb f7                	jmp    803818 <vsnprintf+0x45>
+
+00803821 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803821:	55                   	push   %ebp
+  803822:	89 e5                	mov    %esp,%ebp
+  803824:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803827:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80382a:	50                   	push   %eax
+  80382b:	ff 75 10             	push   0x10(%ebp)
+  80382e:	ff 75 0c             	push   0xc(%ebp)
+  803831:	ff 75 08             	push   0x8(%ebp)
+  803834:	e8 9a ff ff ff       	call   8037d3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803839:	c9                   	leave
+  80383a:	c3                   	ret
+
+0080383b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80383b:	55                   	push   %ebp
+  80383c:	89 e5                	mov    %esp,%ebp
+  80383e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803841:	b8 00 00 00 00       	mov    $0x0,%eax
+  803846:	eb 03                	jmp    80384b <strlen+0x10>
+		n++;
+  803848:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80384b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80384f:	75 f7                	jne    803848 <strlen+0xd>
+	return n;
+}
+  803851:	5d                   	pop    %ebp
+  803852:	c3                   	ret
+
+00803853 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803853:	55                   	push   %ebp
+  803854:	89 e5                	mov    %esp,%ebp
+  803856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803859:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80385c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803861:	eb 03                	jmp    803866 <strnlen+0x13>
+		n++;
+  803863:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803866:	39 d0                	cmp    %edx,%eax
+  803868:	74 08                	je     803872 <strnlen+0x1f>
+  80386a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80386e:	75 f3                	jne    803863 <strnlen+0x10>
+  803870:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  803872:	89 d0                	mov    %edx,%eax
+  803874:	5d                   	pop    %ebp
+  803875:	c3                   	ret
+
+00803876 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803876:	55                   	push   %ebp
+  803877:	89 e5                	mov    %esp,%ebp
+  803879:	53                   	push   %ebx
+  80387a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80387d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  803880:	b8 00 00 00 00       	mov    $0x0,%eax
+  803885:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  803889:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80388c:	83 c0 01             	add    $0x1,%eax
+  80388f:	84 d2                	test   %dl,%dl
+  803891:	75 f2                	jne    803885 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  803893:	89 c8                	mov    %ecx,%eax
+  803895:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803898:	c9                   	leave
+  803899:	c3                   	ret
+
+0080389a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80389a:	55                   	push   %ebp
+  80389b:	89 e5                	mov    %esp,%ebp
+  80389d:	53                   	push   %ebx
+  80389e:	83 ec 10             	sub    $0x10,%esp
+  8038a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038a4:	53                   	push   %ebx
+  8038a5:	e8 91 ff ff ff       	call   80383b <strlen>
+  8038aa:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038ad:	ff 75 0c             	push   0xc(%ebp)
+  8038b0:	01 d8                	add    %ebx,%eax
+  8038b2:	50                   	push   %eax
+  8038b3:	e8 be ff ff ff       	call   803876 <strcpy>
+	return dst;
+}
+  8038b8:	89 d8                	mov    %ebx,%eax
+  8038ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038bd:	c9                   	leave
+  8038be:	c3                   	ret
+
+008038bf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038bf:	55                   	push   %ebp
+  8038c0:	89 e5                	mov    %esp,%ebp
+  8038c2:	56                   	push   %esi
+  8038c3:	53                   	push   %ebx
+  8038c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038ca:	89 f3                	mov    %esi,%ebx
+  8038cc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038cf:	89 f0                	mov    %esi,%eax
+  8038d1:	eb 0f                	jmp    8038e2 <strncpy+0x23>
+		*dst++ = *src;
+  8038d3:	83 c0 01             	add    $0x1,%eax
+  8038d6:	0f b6 0a             	movzbl (%edx),%ecx
+  8038d9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038dc:	80 f9 01             	cmp    $0x1,%cl
+  8038df:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038e2:	39 d8                	cmp    %ebx,%eax
+  8038e4:	75 ed                	jne    8038d3 <strncpy+0x14>
+	}
+	return ret;
+}
+  8038e6:	89 f0                	mov    %esi,%eax
+  8038e8:	5b                   	pop    %ebx
+  8038e9:	5e                   	pop    %esi
+  8038ea:	5d                   	pop    %ebp
+  8038eb:	c3                   	ret
+
+008038ec <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038ec:	55                   	push   %ebp
+  8038ed:	89 e5                	mov    %esp,%ebp
+  8038ef:	56                   	push   %esi
+  8038f0:	53                   	push   %ebx
+  8038f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038f7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8038fa:	89 f0                	mov    %esi,%eax
+  8038fc:	85 d2                	test   %edx,%edx
+  8038fe:	74 21                	je     803921 <strlcpy+0x35>
+  803900:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803904:	89 f2                	mov    %esi,%edx
+  803906:	eb 09                	jmp    803911 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803908:	83 c1 01             	add    $0x1,%ecx
+  80390b:	83 c2 01             	add    $0x1,%edx
+  80390e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803911:	39 c2                	cmp    %eax,%edx
+  803913:	74 09                	je     80391e <strlcpy+0x32>
+  803915:	0f b6 19             	movzbl (%ecx),%ebx
+  803918:	84 db                	test   %bl,%bl
+  80391a:	75 ec                	jne    803908 <strlcpy+0x1c>
+  80391c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80391e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803921:	29 f0                	sub    %esi,%eax
+}
+  803923:	5b                   	pop    %ebx
+  803924:	5e                   	pop    %esi
+  803925:	5d                   	pop    %ebp
+  803926:	c3                   	ret
+
+00803927 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803927:	55                   	push   %ebp
+  803928:	89 e5                	mov    %esp,%ebp
+  80392a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80392d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803930:	eb 06                	jmp    803938 <strcmp+0x11>
+		p++, q++;
+  803932:	83 c1 01             	add    $0x1,%ecx
+  803935:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803938:	0f b6 01             	movzbl (%ecx),%eax
+  80393b:	84 c0                	test   %al,%al
+  80393d:	74 04                	je     803943 <strcmp+0x1c>
+  80393f:	3a 02                	cmp    (%edx),%al
+  803941:	74 ef                	je     803932 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803943:	0f b6 c0             	movzbl %al,%eax
+  803946:	0f b6 12             	movzbl (%edx),%edx
+  803949:	29 d0                	sub    %edx,%eax
+}
+  80394b:	5d                   	pop    %ebp
+  80394c:	c3                   	ret
+
+0080394d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80394d:	55                   	push   %ebp
+  80394e:	89 e5                	mov    %esp,%ebp
+  803950:	53                   	push   %ebx
+  803951:	8b 45 08             	mov    0x8(%ebp),%eax
+  803954:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803957:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80395a:	eb 09                	jmp    803965 <strncmp+0x18>
+		n--, p++, q++;
+  80395c:	83 ea 01             	sub    $0x1,%edx
+  80395f:	83 c0 01             	add    $0x1,%eax
+  803962:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803965:	85 d2                	test   %edx,%edx
+  803967:	74 18                	je     803981 <strncmp+0x34>
+  803969:	0f b6 18             	movzbl (%eax),%ebx
+  80396c:	84 db                	test   %bl,%bl
+  80396e:	74 04                	je     803974 <strncmp+0x27>
+  803970:	3a 19                	cmp    (%ecx),%bl
+  803972:	74 e8                	je     80395c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803974:	0f b6 00             	movzbl (%eax),%eax
+  803977:	0f b6 11             	movzbl (%ecx),%edx
+  80397a:	29 d0                	sub    %edx,%eax
+}
+  80397c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397f:	c9                   	leave
+  803980:	c3                   	ret
+		return 0;
+  803981:	b8 00 00 00 00       	mov    $0x0,%eax
+  803986:	eb f4                	jmp    80397c <strncmp+0x2f>
+
+00803988 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803988:	55                   	push   %ebp
+  803989:	89 e5                	mov    %esp,%ebp
+  80398b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80398e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  803992:	eb 03                	jmp    803997 <strchr+0xf>
+  803994:	83 c0 01             	add    $0x1,%eax
+  803997:	0f b6 10             	movzbl (%eax),%edx
+  80399a:	84 d2                	test   %dl,%dl
+  80399c:	74 06                	je     8039a4 <strchr+0x1c>
+		if (*s == c)
+  80399e:	38 ca                	cmp    %cl,%dl
+  8039a0:	75 f2                	jne    803994 <strchr+0xc>
+  8039a2:	eb 05                	jmp    8039a9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a9:	5d                   	pop    %ebp
+  8039aa:	c3                   	ret
+
+008039ab <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039ab:	55                   	push   %ebp
+  8039ac:	89 e5                	mov    %esp,%ebp
+  8039ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039b5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039b8:	38 ca                	cmp    %cl,%dl
+  8039ba:	74 09                	je     8039c5 <strfind+0x1a>
+  8039bc:	84 d2                	test   %dl,%dl
+  8039be:	74 05                	je     8039c5 <strfind+0x1a>
+	for (; *s; s++)
+  8039c0:	83 c0 01             	add    $0x1,%eax
+  8039c3:	eb f0                	jmp    8039b5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039c5:	5d                   	pop    %ebp
+  8039c6:	c3                   	ret
+
+008039c7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039c7:	55                   	push   %ebp
+  8039c8:	89 e5                	mov    %esp,%ebp
+  8039ca:	57                   	push   %edi
+  8039cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039ce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039d1:	85 c9                	test   %ecx,%ecx
+  8039d3:	74 20                	je     8039f5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039d5:	89 f8                	mov    %edi,%eax
+  8039d7:	09 c8                	or     %ecx,%eax
+  8039d9:	a8 03                	test   $0x3,%al
+  8039db:	75 12                	jne    8039ef <memset+0x28>
+		c &= 0xFF;
+  8039dd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039e1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039e7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039ea:	fc                   	cld
+  8039eb:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039ed:	eb 06                	jmp    8039f5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039f2:	fc                   	cld
+  8039f3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8039f5:	89 f8                	mov    %edi,%eax
+  8039f7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8039fa:	c9                   	leave
+  8039fb:	c3                   	ret
+
+008039fc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8039fc:	55                   	push   %ebp
+  8039fd:	89 e5                	mov    %esp,%ebp
+  8039ff:	57                   	push   %edi
+  803a00:	56                   	push   %esi
+  803a01:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a04:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a0a:	39 c6                	cmp    %eax,%esi
+  803a0c:	73 32                	jae    803a40 <memmove+0x44>
+  803a0e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a11:	39 d0                	cmp    %edx,%eax
+  803a13:	73 2b                	jae    803a40 <memmove+0x44>
+		s += n;
+		d += n;
+  803a15:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a18:	89 d6                	mov    %edx,%esi
+  803a1a:	09 fe                	or     %edi,%esi
+  803a1c:	09 ce                	or     %ecx,%esi
+  803a1e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a24:	75 0e                	jne    803a34 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a26:	83 ef 04             	sub    $0x4,%edi
+  803a29:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a2c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a2f:	fd                   	std
+  803a30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a32:	eb 09                	jmp    803a3d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a34:	83 ef 01             	sub    $0x1,%edi
+  803a37:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a3a:	fd                   	std
+  803a3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a3d:	fc                   	cld
+  803a3e:	eb 1a                	jmp    803a5a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a40:	89 f2                	mov    %esi,%edx
+  803a42:	09 c2                	or     %eax,%edx
+  803a44:	09 ca                	or     %ecx,%edx
+  803a46:	f6 c2 03             	test   $0x3,%dl
+  803a49:	75 0a                	jne    803a55 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a4b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a4e:	89 c7                	mov    %eax,%edi
+  803a50:	fc                   	cld
+  803a51:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a53:	eb 05                	jmp    803a5a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a55:	89 c7                	mov    %eax,%edi
+  803a57:	fc                   	cld
+  803a58:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a5a:	5e                   	pop    %esi
+  803a5b:	5f                   	pop    %edi
+  803a5c:	5d                   	pop    %ebp
+  803a5d:	c3                   	ret
+
+00803a5e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a5e:	55                   	push   %ebp
+  803a5f:	89 e5                	mov    %esp,%ebp
+  803a61:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a64:	ff 75 10             	push   0x10(%ebp)
+  803a67:	ff 75 0c             	push   0xc(%ebp)
+  803a6a:	ff 75 08             	push   0x8(%ebp)
+  803a6d:	e8 8a ff ff ff       	call   8039fc <memmove>
+}
+  803a72:	c9                   	leave
+  803a73:	c3                   	ret
+
+00803a74 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a74:	55                   	push   %ebp
+  803a75:	89 e5                	mov    %esp,%ebp
+  803a77:	56                   	push   %esi
+  803a78:	53                   	push   %ebx
+  803a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a7f:	89 c6                	mov    %eax,%esi
+  803a81:	03 75 10             	add    0x10(%ebp),%esi
+  803a84:	eb 06                	jmp    803a8c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a86:	83 c0 01             	add    $0x1,%eax
+  803a89:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a8c:	39 f0                	cmp    %esi,%eax
+  803a8e:	74 14                	je     803aa4 <memcmp+0x30>
+		if (*s1 != *s2)
+  803a90:	0f b6 08             	movzbl (%eax),%ecx
+  803a93:	0f b6 1a             	movzbl (%edx),%ebx
+  803a96:	38 d9                	cmp    %bl,%cl
+  803a98:	74 ec                	je     803a86 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803a9a:	0f b6 c1             	movzbl %cl,%eax
+  803a9d:	0f b6 db             	movzbl %bl,%ebx
+  803aa0:	29 d8                	sub    %ebx,%eax
+  803aa2:	eb 05                	jmp    803aa9 <memcmp+0x35>
+	}
+
+	return 0;
+  803aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa9:	5b                   	pop    %ebx
+  803aaa:	5e                   	pop    %esi
+  803aab:	5d                   	pop    %ebp
+  803aac:	c3                   	ret
+
+00803aad <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803aad:	55                   	push   %ebp
+  803aae:	89 e5                	mov    %esp,%ebp
+  803ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ab3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ab6:	89 c2                	mov    %eax,%edx
+  803ab8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803abb:	eb 03                	jmp    803ac0 <memfind+0x13>
+  803abd:	83 c0 01             	add    $0x1,%eax
+  803ac0:	39 d0                	cmp    %edx,%eax
+  803ac2:	73 04                	jae    803ac8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ac4:	38 08                	cmp    %cl,(%eax)
+  803ac6:	75 f5                	jne    803abd <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803ac8:	5d                   	pop    %ebp
+  803ac9:	c3                   	ret
+
+00803aca <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803aca:	55                   	push   %ebp
+  803acb:	89 e5                	mov    %esp,%ebp
+  803acd:	57                   	push   %edi
+  803ace:	56                   	push   %esi
+  803acf:	53                   	push   %ebx
+  803ad0:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ad3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ad6:	eb 03                	jmp    803adb <strtol+0x11>
+		s++;
+  803ad8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803adb:	0f b6 02             	movzbl (%edx),%eax
+  803ade:	3c 20                	cmp    $0x20,%al
+  803ae0:	74 f6                	je     803ad8 <strtol+0xe>
+  803ae2:	3c 09                	cmp    $0x9,%al
+  803ae4:	74 f2                	je     803ad8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803ae6:	3c 2b                	cmp    $0x2b,%al
+  803ae8:	74 2a                	je     803b14 <strtol+0x4a>
+	int neg = 0;
+  803aea:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803aef:	3c 2d                	cmp    $0x2d,%al
+  803af1:	74 2b                	je     803b1e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803af3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803af9:	75 0f                	jne    803b0a <strtol+0x40>
+  803afb:	80 3a 30             	cmpb   $0x30,(%edx)
+  803afe:	74 28                	je     803b28 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b00:	85 db                	test   %ebx,%ebx
+  803b02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b07:	0f 44 d8             	cmove  %eax,%ebx
+  803b0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b0f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b12:	eb 46                	jmp    803b5a <strtol+0x90>
+		s++;
+  803b14:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b1c:	eb d5                	jmp    803af3 <strtol+0x29>
+		s++, neg = 1;
+  803b1e:	83 c2 01             	add    $0x1,%edx
+  803b21:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b26:	eb cb                	jmp    803af3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b28:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b2c:	74 0e                	je     803b3c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b2e:	85 db                	test   %ebx,%ebx
+  803b30:	75 d8                	jne    803b0a <strtol+0x40>
+		s++, base = 8;
+  803b32:	83 c2 01             	add    $0x1,%edx
+  803b35:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b3a:	eb ce                	jmp    803b0a <strtol+0x40>
+		s += 2, base = 16;
+  803b3c:	83 c2 02             	add    $0x2,%edx
+  803b3f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b44:	eb c4                	jmp    803b0a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b46:	0f be c0             	movsbl %al,%eax
+  803b49:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b4c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b4f:	7d 3a                	jge    803b8b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b51:	83 c2 01             	add    $0x1,%edx
+  803b54:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b58:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b5a:	0f b6 02             	movzbl (%edx),%eax
+  803b5d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b60:	89 f3                	mov    %esi,%ebx
+  803b62:	80 fb 09             	cmp    $0x9,%bl
+  803b65:	76 df                	jbe    803b46 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b67:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b6a:	89 f3                	mov    %esi,%ebx
+  803b6c:	80 fb 19             	cmp    $0x19,%bl
+  803b6f:	77 08                	ja     803b79 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b71:	0f be c0             	movsbl %al,%eax
+  803b74:	83 e8 57             	sub    $0x57,%eax
+  803b77:	eb d3                	jmp    803b4c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b79:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b7c:	89 f3                	mov    %esi,%ebx
+  803b7e:	80 fb 19             	cmp    $0x19,%bl
+  803b81:	77 08                	ja     803b8b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b83:	0f be c0             	movsbl %al,%eax
+  803b86:	83 e8 37             	sub    $0x37,%eax
+  803b89:	eb c1                	jmp    803b4c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b8b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b8f:	74 05                	je     803b96 <strtol+0xcc>
+		*endptr = (char *) s;
+  803b91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b94:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803b96:	89 c8                	mov    %ecx,%eax
+  803b98:	f7 d8                	neg    %eax
+  803b9a:	85 ff                	test   %edi,%edi
+  803b9c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803b9f:	89 c8                	mov    %ecx,%eax
+  803ba1:	5b                   	pop    %ebx
+  803ba2:	5e                   	pop    %esi
+  803ba3:	5f                   	pop    %edi
+  803ba4:	5d                   	pop    %ebp
+  803ba5:	c3                   	ret
+
+00803ba6 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803ba6:	55                   	push   %ebp
+  803ba7:	89 e5                	mov    %esp,%ebp
+  803ba9:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bac:	6a 00                	push   $0x0
+  803bae:	6a 00                	push   $0x0
+  803bb0:	ff 75 08             	push   0x8(%ebp)
+  803bb3:	e8 12 ff ff ff       	call   803aca <strtol>
+}
+  803bb8:	c9                   	leave
+  803bb9:	c3                   	ret
+
+00803bba <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bba:	55                   	push   %ebp
+  803bbb:	89 e5                	mov    %esp,%ebp
+  803bbd:	57                   	push   %edi
+  803bbe:	56                   	push   %esi
+  803bbf:	53                   	push   %ebx
+  803bc0:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bc3:	89 d6                	mov    %edx,%esi
+  803bc5:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bc8:	89 cf                	mov    %ecx,%edi
+  803bca:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bcd:	89 fa                	mov    %edi,%edx
+  803bcf:	80 ce 08             	or     $0x8,%dh
+  803bd2:	f6 c5 08             	test   $0x8,%ch
+  803bd5:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bd8:	57                   	push   %edi
+  803bd9:	56                   	push   %esi
+  803bda:	50                   	push   %eax
+  803bdb:	56                   	push   %esi
+  803bdc:	6a 00                	push   $0x0
+  803bde:	e8 41 c6 ff ff       	call   800224 <sys_page_map>
+	if (r < 0) {
+  803be3:	83 c4 20             	add    $0x20,%esp
+  803be6:	85 c0                	test   %eax,%eax
+  803be8:	78 27                	js     803c11 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bea:	83 ec 0c             	sub    $0xc,%esp
+  803bed:	57                   	push   %edi
+  803bee:	56                   	push   %esi
+  803bef:	6a 00                	push   $0x0
+  803bf1:	56                   	push   %esi
+  803bf2:	6a 00                	push   $0x0
+  803bf4:	e8 2b c6 ff ff       	call   800224 <sys_page_map>
+  803bf9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803bfb:	83 c4 20             	add    $0x20,%esp
+  803bfe:	85 c0                	test   %eax,%eax
+  803c00:	78 24                	js     803c26 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c02:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c07:	89 d8                	mov    %ebx,%eax
+  803c09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c0c:	5b                   	pop    %ebx
+  803c0d:	5e                   	pop    %esi
+  803c0e:	5f                   	pop    %edi
+  803c0f:	5d                   	pop    %ebp
+  803c10:	c3                   	ret
+  803c11:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c13:	83 ec 08             	sub    $0x8,%esp
+  803c16:	50                   	push   %eax
+  803c17:	68 78 4c 80 00       	push   $0x804c78
+  803c1c:	e8 71 f6 ff ff       	call   803292 <cprintf>
+		return r;
+  803c21:	83 c4 10             	add    $0x10,%esp
+  803c24:	eb e1                	jmp    803c07 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c26:	83 ec 08             	sub    $0x8,%esp
+  803c29:	50                   	push   %eax
+  803c2a:	68 a8 4c 80 00       	push   $0x804ca8
+  803c2f:	e8 5e f6 ff ff       	call   803292 <cprintf>
+		return r;
+  803c34:	83 c4 10             	add    $0x10,%esp
+  803c37:	eb ce                	jmp    803c07 <duppage_cow+0x4d>
+
+00803c39 <duppage>:
+{
+  803c39:	55                   	push   %ebp
+  803c3a:	89 e5                	mov    %esp,%ebp
+  803c3c:	53                   	push   %ebx
+  803c3d:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c40:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c43:	51                   	push   %ecx
+  803c44:	52                   	push   %edx
+  803c45:	50                   	push   %eax
+  803c46:	52                   	push   %edx
+  803c47:	6a 00                	push   $0x0
+  803c49:	e8 d6 c5 ff ff       	call   800224 <sys_page_map>
+	if (r < 0) {
+  803c4e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c56:	85 c0                	test   %eax,%eax
+  803c58:	78 07                	js     803c61 <duppage+0x28>
+}
+  803c5a:	89 d8                	mov    %ebx,%eax
+  803c5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c5f:	c9                   	leave
+  803c60:	c3                   	ret
+  803c61:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c63:	83 ec 08             	sub    $0x8,%esp
+  803c66:	50                   	push   %eax
+  803c67:	68 78 4c 80 00       	push   $0x804c78
+  803c6c:	e8 21 f6 ff ff       	call   803292 <cprintf>
+		return r;
+  803c71:	83 c4 10             	add    $0x10,%esp
+  803c74:	eb e4                	jmp    803c5a <duppage+0x21>
+
+00803c76 <cow_copy>:
+{
+  803c76:	55                   	push   %ebp
+  803c77:	89 e5                	mov    %esp,%ebp
+  803c79:	56                   	push   %esi
+  803c7a:	53                   	push   %ebx
+  803c7b:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c7d:	83 ec 04             	sub    $0x4,%esp
+  803c80:	6a 07                	push   $0x7
+  803c82:	68 00 f0 7f 00       	push   $0x7ff000
+  803c87:	6a 00                	push   $0x0
+  803c89:	e8 49 c5 ff ff       	call   8001d7 <sys_page_alloc>
+	if (r < 0) {
+  803c8e:	83 c4 10             	add    $0x10,%esp
+  803c91:	85 c0                	test   %eax,%eax
+  803c93:	78 58                	js     803ced <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803c95:	83 ec 04             	sub    $0x4,%esp
+  803c98:	68 00 10 00 00       	push   $0x1000
+  803c9d:	56                   	push   %esi
+  803c9e:	68 00 f0 7f 00       	push   $0x7ff000
+  803ca3:	e8 54 fd ff ff       	call   8039fc <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803ca8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803caf:	56                   	push   %esi
+  803cb0:	6a 00                	push   $0x0
+  803cb2:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb7:	6a 00                	push   $0x0
+  803cb9:	e8 66 c5 ff ff       	call   800224 <sys_page_map>
+  803cbe:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cc0:	83 c4 20             	add    $0x20,%esp
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	78 3b                	js     803d02 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cc7:	83 ec 08             	sub    $0x8,%esp
+  803cca:	68 00 f0 7f 00       	push   $0x7ff000
+  803ccf:	6a 00                	push   $0x0
+  803cd1:	e8 9a c5 ff ff       	call   800270 <sys_page_unmap>
+  803cd6:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd8:	83 c4 10             	add    $0x10,%esp
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	78 45                	js     803d24 <cow_copy+0xae>
+	return 0;
+  803cdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ce4:	89 d8                	mov    %ebx,%eax
+  803ce6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ce9:	5b                   	pop    %ebx
+  803cea:	5e                   	pop    %esi
+  803ceb:	5d                   	pop    %ebp
+  803cec:	c3                   	ret
+  803ced:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803cef:	83 ec 08             	sub    $0x8,%esp
+  803cf2:	50                   	push   %eax
+  803cf3:	68 98 4d 80 00       	push   $0x804d98
+  803cf8:	e8 95 f5 ff ff       	call   803292 <cprintf>
+		return r;
+  803cfd:	83 c4 10             	add    $0x10,%esp
+  803d00:	eb e2                	jmp    803ce4 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d02:	83 ec 08             	sub    $0x8,%esp
+  803d05:	50                   	push   %eax
+  803d06:	68 b4 4d 80 00       	push   $0x804db4
+  803d0b:	e8 82 f5 ff ff       	call   803292 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d10:	83 c4 08             	add    $0x8,%esp
+  803d13:	68 00 f0 7f 00       	push   $0x7ff000
+  803d18:	6a 00                	push   $0x0
+  803d1a:	e8 51 c5 ff ff       	call   800270 <sys_page_unmap>
+		return r;
+  803d1f:	83 c4 10             	add    $0x10,%esp
+  803d22:	eb c0                	jmp    803ce4 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d24:	83 ec 08             	sub    $0x8,%esp
+  803d27:	50                   	push   %eax
+  803d28:	68 d0 4c 80 00       	push   $0x804cd0
+  803d2d:	e8 60 f5 ff ff       	call   803292 <cprintf>
+		return r;
+  803d32:	83 c4 10             	add    $0x10,%esp
+  803d35:	eb ad                	jmp    803ce4 <cow_copy+0x6e>
+
+00803d37 <pgfault>:
+{
+  803d37:	55                   	push   %ebp
+  803d38:	89 e5                	mov    %esp,%ebp
+  803d3a:	56                   	push   %esi
+  803d3b:	53                   	push   %ebx
+  803d3c:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d3f:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d41:	89 d8                	mov    %ebx,%eax
+  803d43:	c1 e8 16             	shr    $0x16,%eax
+  803d46:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d4d:	89 de                	mov    %ebx,%esi
+  803d4f:	c1 ee 0c             	shr    $0xc,%esi
+  803d52:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d59:	a8 07                	test   $0x7,%al
+  803d5b:	74 3b                	je     803d98 <pgfault+0x61>
+  803d5d:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d63:	74 33                	je     803d98 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d65:	83 ec 0c             	sub    $0xc,%esp
+  803d68:	68 00 f0 bf ee       	push   $0xeebff000
+  803d6d:	e8 c5 ea ff ff       	call   802837 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d72:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d79:	83 c4 10             	add    $0x10,%esp
+  803d7c:	f6 c4 08             	test   $0x8,%ah
+  803d7f:	75 30                	jne    803db1 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d81:	83 ec 0c             	sub    $0xc,%esp
+  803d84:	68 00 f0 bf ee       	push   $0xeebff000
+  803d89:	e8 16 eb ff ff       	call   8028a4 <mutex_unlock>
+}
+  803d8e:	83 c4 10             	add    $0x10,%esp
+  803d91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d94:	5b                   	pop    %ebx
+  803d95:	5e                   	pop    %esi
+  803d96:	5d                   	pop    %ebp
+  803d97:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803d98:	83 ec 08             	sub    $0x8,%esp
+  803d9b:	ff 72 28             	push   0x28(%edx)
+  803d9e:	51                   	push   %ecx
+  803d9f:	50                   	push   %eax
+  803da0:	68 f4 4c 80 00       	push   $0x804cf4
+  803da5:	6a 3f                	push   $0x3f
+  803da7:	68 ce 4d 80 00       	push   $0x804dce
+  803dac:	e8 06 f4 ff ff       	call   8031b7 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803db1:	89 d8                	mov    %ebx,%eax
+  803db3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803db8:	e8 b9 fe ff ff       	call   803c76 <cow_copy>
+  803dbd:	eb c2                	jmp    803d81 <pgfault+0x4a>
+
+00803dbf <cow_enable>:
+{
+  803dbf:	55                   	push   %ebp
+  803dc0:	89 e5                	mov    %esp,%ebp
+  803dc2:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dc5:	68 37 3d 80 00       	push   $0x803d37
+  803dca:	e8 28 06 00 00       	call   8043f7 <set_pgfault_handler>
+}
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	c9                   	leave
+  803dd3:	c3                   	ret
+
+00803dd4 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dd4:	55                   	push   %ebp
+  803dd5:	89 e5                	mov    %esp,%ebp
+  803dd7:	57                   	push   %edi
+  803dd8:	56                   	push   %esi
+  803dd9:	53                   	push   %ebx
+  803dda:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ddd:	68 37 3d 80 00       	push   $0x803d37
+  803de2:	e8 10 06 00 00       	call   8043f7 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803de7:	b8 07 00 00 00       	mov    $0x7,%eax
+  803dec:	cd 30                	int    $0x30
+  803dee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803df1:	83 c4 10             	add    $0x10,%esp
+  803df4:	85 c0                	test   %eax,%eax
+  803df6:	78 4b                	js     803e43 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803df8:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e05:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e09:	0f 85 16 01 00 00    	jne    803f25 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e0f:	e8 6b c3 ff ff       	call   80017f <sys_getenvid>
+  803e14:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e19:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e1b:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e21:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e27:	77 32                	ja     803e5b <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e29:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e2e:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e30:	c1 ea 10             	shr    $0x10,%edx
+  803e33:	74 26                	je     803e5b <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e35:	c1 e2 10             	shl    $0x10,%edx
+  803e38:	89 d1                	mov    %edx,%ecx
+  803e3a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e3f:	29 ca                	sub    %ecx,%edx
+  803e41:	eb 1e                	jmp    803e61 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e43:	83 ec 08             	sub    $0x8,%esp
+  803e46:	89 c7                	mov    %eax,%edi
+  803e48:	50                   	push   %eax
+  803e49:	68 d9 4d 80 00       	push   $0x804dd9
+  803e4e:	e8 3f f4 ff ff       	call   803292 <cprintf>
+		return eid;
+  803e53:	83 c4 10             	add    $0x10,%esp
+  803e56:	e9 6c 01 00 00       	jmp    803fc7 <fork+0x1f3>
+		return pthread_main_tls;
+  803e5b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e61:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e64:	c1 e0 04             	shl    $0x4,%eax
+  803e67:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e6c:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e6e:	e8 0d f1 ff ff       	call   802f80 <pthread_fork_child>
+		return eid;
+  803e73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e76:	e9 4c 01 00 00       	jmp    803fc7 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e7b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e81:	89 da                	mov    %ebx,%edx
+  803e83:	89 f8                	mov    %edi,%eax
+  803e85:	e8 af fd ff ff       	call   803c39 <duppage>
+  803e8a:	85 c0                	test   %eax,%eax
+  803e8c:	79 28                	jns    803eb6 <fork+0xe2>
+  803e8e:	89 c7                	mov    %eax,%edi
+  803e90:	e9 32 01 00 00       	jmp    803fc7 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803e95:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e9b:	83 f9 05             	cmp    $0x5,%ecx
+  803e9e:	75 58                	jne    803ef8 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ea0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ea5:	89 da                	mov    %ebx,%edx
+  803ea7:	89 f8                	mov    %edi,%eax
+  803ea9:	e8 8b fd ff ff       	call   803c39 <duppage>
+  803eae:	85 c0                	test   %eax,%eax
+  803eb0:	0f 88 0f 01 00 00    	js     803fc5 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eb6:	83 c3 01             	add    $0x1,%ebx
+  803eb9:	39 de                	cmp    %ebx,%esi
+  803ebb:	74 54                	je     803f11 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ebd:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ec4:	f6 c1 05             	test   $0x5,%cl
+  803ec7:	74 ed                	je     803eb6 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ec9:	f6 c5 04             	test   $0x4,%ch
+  803ecc:	75 ad                	jne    803e7b <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ece:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ed4:	74 bf                	je     803e95 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ed6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803edc:	74 d8                	je     803eb6 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ede:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ee4:	89 da                	mov    %ebx,%edx
+  803ee6:	89 f8                	mov    %edi,%eax
+  803ee8:	e8 cd fc ff ff       	call   803bba <duppage_cow>
+  803eed:	85 c0                	test   %eax,%eax
+  803eef:	79 c5                	jns    803eb6 <fork+0xe2>
+  803ef1:	89 c7                	mov    %eax,%edi
+  803ef3:	e9 cf 00 00 00       	jmp    803fc7 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ef8:	68 24 4d 80 00       	push   $0x804d24
+  803efd:	68 95 47 80 00       	push   $0x804795
+  803f02:	68 c6 00 00 00       	push   $0xc6
+  803f07:	68 ce 4d 80 00       	push   $0x804dce
+  803f0c:	e8 a6 f2 ff ff       	call   8031b7 <_panic>
+  803f11:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f14:	83 c1 01             	add    $0x1,%ecx
+  803f17:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f1d:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f23:	74 18                	je     803f3d <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f25:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f2c:	a8 07                	test   $0x7,%al
+  803f2e:	74 e4                	je     803f14 <fork+0x140>
+  803f30:	89 cb                	mov    %ecx,%ebx
+  803f32:	c1 e3 0a             	shl    $0xa,%ebx
+  803f35:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f38:	e9 7c ff ff ff       	jmp    803eb9 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f3d:	83 ec 04             	sub    $0x4,%esp
+  803f40:	6a 07                	push   $0x7
+  803f42:	68 00 f0 bf ee       	push   $0xeebff000
+  803f47:	ff 75 e4             	push   -0x1c(%ebp)
+  803f4a:	e8 88 c2 ff ff       	call   8001d7 <sys_page_alloc>
+  803f4f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f51:	83 c4 10             	add    $0x10,%esp
+  803f54:	85 c0                	test   %eax,%eax
+  803f56:	78 34                	js     803f8c <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f58:	83 ec 08             	sub    $0x8,%esp
+  803f5b:	68 35 44 80 00       	push   $0x804435
+  803f60:	ff 75 e4             	push   -0x1c(%ebp)
+  803f63:	e8 ec c3 ff ff       	call   800354 <sys_env_set_pgfault_upcall>
+  803f68:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f6a:	83 c4 10             	add    $0x10,%esp
+  803f6d:	85 c0                	test   %eax,%eax
+  803f6f:	78 2e                	js     803f9f <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f71:	83 ec 08             	sub    $0x8,%esp
+  803f74:	6a 02                	push   $0x2
+  803f76:	ff 75 e4             	push   -0x1c(%ebp)
+  803f79:	e8 3e c3 ff ff       	call   8002bc <sys_env_set_status>
+  803f7e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f80:	83 c4 10             	add    $0x10,%esp
+  803f83:	85 c0                	test   %eax,%eax
+  803f85:	78 2b                	js     803fb2 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f8a:	eb 3b                	jmp    803fc7 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f8c:	83 ec 08             	sub    $0x8,%esp
+  803f8f:	50                   	push   %eax
+  803f90:	68 4c 4d 80 00       	push   $0x804d4c
+  803f95:	e8 f8 f2 ff ff       	call   803292 <cprintf>
+		return r;
+  803f9a:	83 c4 10             	add    $0x10,%esp
+  803f9d:	eb 28                	jmp    803fc7 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803f9f:	83 ec 08             	sub    $0x8,%esp
+  803fa2:	50                   	push   %eax
+  803fa3:	68 74 4d 80 00       	push   $0x804d74
+  803fa8:	e8 e5 f2 ff ff       	call   803292 <cprintf>
+		return r;
+  803fad:	83 c4 10             	add    $0x10,%esp
+  803fb0:	eb 15                	jmp    803fc7 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fb2:	83 ec 08             	sub    $0x8,%esp
+  803fb5:	50                   	push   %eax
+  803fb6:	68 e9 4d 80 00       	push   $0x804de9
+  803fbb:	e8 d2 f2 ff ff       	call   803292 <cprintf>
+		return r;
+  803fc0:	83 c4 10             	add    $0x10,%esp
+  803fc3:	eb 02                	jmp    803fc7 <fork+0x1f3>
+  803fc5:	89 c7                	mov    %eax,%edi
+}
+  803fc7:	89 f8                	mov    %edi,%eax
+  803fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fcc:	5b                   	pop    %ebx
+  803fcd:	5e                   	pop    %esi
+  803fce:	5f                   	pop    %edi
+  803fcf:	5d                   	pop    %ebp
+  803fd0:	c3                   	ret
+
+00803fd1 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fd1:	55                   	push   %ebp
+  803fd2:	89 e5                	mov    %esp,%ebp
+  803fd4:	57                   	push   %edi
+  803fd5:	56                   	push   %esi
+  803fd6:	53                   	push   %ebx
+  803fd7:	83 ec 2c             	sub    $0x2c,%esp
+  803fda:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fdc:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803fe2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803fed:	77 0a                	ja     803ff9 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fef:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803ff4:	29 c3                	sub    %eax,%ebx
+  803ff6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ff9:	83 ec 0c             	sub    $0xc,%esp
+  803ffc:	68 37 3d 80 00       	push   $0x803d37
+  804001:	e8 f1 03 00 00       	call   8043f7 <set_pgfault_handler>
+  804006:	b8 07 00 00 00       	mov    $0x7,%eax
+  80400b:	cd 30                	int    $0x30
+  80400d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804010:	83 c4 10             	add    $0x10,%esp
+  804013:	85 c0                	test   %eax,%eax
+  804015:	78 30                	js     804047 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804017:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80401b:	74 42                	je     80405f <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80401d:	c1 e3 10             	shl    $0x10,%ebx
+  804020:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804025:	29 d8                	sub    %ebx,%eax
+  804027:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80402a:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80402f:	29 d8                	sub    %ebx,%eax
+  804031:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804034:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80403e:	89 f7                	mov    %esi,%edi
+  804040:	89 d6                	mov    %edx,%esi
+  804042:	e9 2c 01 00 00       	jmp    804173 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804047:	83 ec 08             	sub    $0x8,%esp
+  80404a:	89 c7                	mov    %eax,%edi
+  80404c:	50                   	push   %eax
+  80404d:	68 d9 4d 80 00       	push   $0x804dd9
+  804052:	e8 3b f2 ff ff       	call   803292 <cprintf>
+		return eid;
+  804057:	83 c4 10             	add    $0x10,%esp
+  80405a:	e9 d5 00 00 00       	jmp    804134 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80405f:	e8 1b c1 ff ff       	call   80017f <sys_getenvid>
+  804064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804069:	89 c2                	mov    %eax,%edx
+  80406b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80406d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804073:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804078:	77 18                	ja     804092 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80407a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80407f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804081:	c1 e8 10             	shr    $0x10,%eax
+  804084:	74 0c                	je     804092 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804086:	c1 e0 10             	shl    $0x10,%eax
+  804089:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80408e:	29 c1                	sub    %eax,%ecx
+  804090:	eb 06                	jmp    804098 <sfork+0xc7>
+		return pthread_main_tls;
+  804092:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804098:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80409b:	c1 e0 04             	shl    $0x4,%eax
+  80409e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040a3:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040a5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040a8:	e9 87 00 00 00       	jmp    804134 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040ad:	f6 c5 04             	test   $0x4,%ch
+  8040b0:	74 6c                	je     80411e <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040b2:	89 ca                	mov    %ecx,%edx
+  8040b4:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040ba:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040c0:	74 7c                	je     80413e <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040c2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040c8:	89 da                	mov    %ebx,%edx
+  8040ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040cd:	e8 67 fb ff ff       	call   803c39 <duppage>
+  8040d2:	85 c0                	test   %eax,%eax
+  8040d4:	0f 88 4f 01 00 00    	js     804229 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040da:	83 c3 01             	add    $0x1,%ebx
+  8040dd:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040e0:	74 7a                	je     80415c <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040e2:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040e4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040eb:	f6 c1 01             	test   $0x1,%cl
+  8040ee:	74 ea                	je     8040da <sfork+0x109>
+  8040f0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040f6:	74 e2                	je     8040da <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8040f8:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8040fe:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804101:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804106:	76 a5                	jbe    8040ad <sfork+0xdc>
+  804108:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80410e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804111:	39 fa                	cmp    %edi,%edx
+  804113:	73 9d                	jae    8040b2 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804115:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804118:	39 fa                	cmp    %edi,%edx
+  80411a:	72 96                	jb     8040b2 <sfork+0xe1>
+  80411c:	eb 8f                	jmp    8040ad <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80411e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804124:	89 da                	mov    %ebx,%edx
+  804126:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804129:	e8 8c fa ff ff       	call   803bba <duppage_cow>
+  80412e:	85 c0                	test   %eax,%eax
+  804130:	79 a8                	jns    8040da <sfork+0x109>
+  804132:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804134:	89 f8                	mov    %edi,%eax
+  804136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804139:	5b                   	pop    %ebx
+  80413a:	5e                   	pop    %esi
+  80413b:	5f                   	pop    %edi
+  80413c:	5d                   	pop    %ebp
+  80413d:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80413e:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804143:	e8 2e fb ff ff       	call   803c76 <cow_copy>
+  804148:	85 c0                	test   %eax,%eax
+  80414a:	0f 88 d2 00 00 00    	js     804222 <sfork+0x251>
+				pte = uvpt[pn];
+  804150:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804157:	e9 66 ff ff ff       	jmp    8040c2 <sfork+0xf1>
+  80415c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80415f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804162:	83 c6 01             	add    $0x1,%esi
+  804165:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80416b:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804171:	74 1b                	je     80418e <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804173:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80417a:	a8 01                	test   $0x1,%al
+  80417c:	74 e4                	je     804162 <sfork+0x191>
+  80417e:	89 f3                	mov    %esi,%ebx
+  804180:	c1 e3 0a             	shl    $0xa,%ebx
+  804183:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804186:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804189:	e9 4f ff ff ff       	jmp    8040dd <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80418e:	83 ec 04             	sub    $0x4,%esp
+  804191:	6a 07                	push   $0x7
+  804193:	68 00 f0 bf ee       	push   $0xeebff000
+  804198:	ff 75 e0             	push   -0x20(%ebp)
+  80419b:	e8 37 c0 ff ff       	call   8001d7 <sys_page_alloc>
+  8041a0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041a2:	83 c4 10             	add    $0x10,%esp
+  8041a5:	85 c0                	test   %eax,%eax
+  8041a7:	78 37                	js     8041e0 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041a9:	83 ec 08             	sub    $0x8,%esp
+  8041ac:	68 35 44 80 00       	push   $0x804435
+  8041b1:	ff 75 e0             	push   -0x20(%ebp)
+  8041b4:	e8 9b c1 ff ff       	call   800354 <sys_env_set_pgfault_upcall>
+  8041b9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041bb:	83 c4 10             	add    $0x10,%esp
+  8041be:	85 c0                	test   %eax,%eax
+  8041c0:	78 34                	js     8041f6 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041c2:	83 ec 08             	sub    $0x8,%esp
+  8041c5:	6a 02                	push   $0x2
+  8041c7:	ff 75 e0             	push   -0x20(%ebp)
+  8041ca:	e8 ed c0 ff ff       	call   8002bc <sys_env_set_status>
+  8041cf:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041d1:	83 c4 10             	add    $0x10,%esp
+  8041d4:	85 c0                	test   %eax,%eax
+  8041d6:	78 34                	js     80420c <sfork+0x23b>
+	return eid;
+  8041d8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041db:	e9 54 ff ff ff       	jmp    804134 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041e0:	83 ec 08             	sub    $0x8,%esp
+  8041e3:	50                   	push   %eax
+  8041e4:	68 4c 4d 80 00       	push   $0x804d4c
+  8041e9:	e8 a4 f0 ff ff       	call   803292 <cprintf>
+		return r;
+  8041ee:	83 c4 10             	add    $0x10,%esp
+  8041f1:	e9 3e ff ff ff       	jmp    804134 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041f6:	83 ec 08             	sub    $0x8,%esp
+  8041f9:	50                   	push   %eax
+  8041fa:	68 74 4d 80 00       	push   $0x804d74
+  8041ff:	e8 8e f0 ff ff       	call   803292 <cprintf>
+		return r;
+  804204:	83 c4 10             	add    $0x10,%esp
+  804207:	e9 28 ff ff ff       	jmp    804134 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80420c:	83 ec 08             	sub    $0x8,%esp
+  80420f:	50                   	push   %eax
+  804210:	68 e9 4d 80 00       	push   $0x804de9
+  804215:	e8 78 f0 ff ff       	call   803292 <cprintf>
+		return r;
+  80421a:	83 c4 10             	add    $0x10,%esp
+  80421d:	e9 12 ff ff ff       	jmp    804134 <sfork+0x163>
+  804222:	89 c7                	mov    %eax,%edi
+  804224:	e9 0b ff ff ff       	jmp    804134 <sfork+0x163>
+  804229:	89 c7                	mov    %eax,%edi
+  80422b:	e9 04 ff ff ff       	jmp    804134 <sfork+0x163>
+
+00804230 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804230:	55                   	push   %ebp
+  804231:	89 e5                	mov    %esp,%ebp
+  804233:	57                   	push   %edi
+  804234:	56                   	push   %esi
+  804235:	53                   	push   %ebx
+  804236:	83 ec 18             	sub    $0x18,%esp
+  804239:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80423c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80423f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804242:	85 c0                	test   %eax,%eax
+  804244:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804249:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80424c:	50                   	push   %eax
+  80424d:	e8 7b c1 ff ff       	call   8003cd <sys_ipc_recv>
+	if (r < 0) {
+  804252:	83 c4 10             	add    $0x10,%esp
+  804255:	85 c0                	test   %eax,%eax
+  804257:	78 2b                	js     804284 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804259:	85 ff                	test   %edi,%edi
+  80425b:	74 55                	je     8042b2 <ipc_recv+0x82>
+  80425d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80425f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804265:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80426a:	77 39                	ja     8042a5 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80426c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804271:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804273:	c1 e8 10             	shr    $0x10,%eax
+  804276:	74 2d                	je     8042a5 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804278:	c1 e0 10             	shl    $0x10,%eax
+  80427b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804280:	29 c2                	sub    %eax,%edx
+  804282:	eb 27                	jmp    8042ab <ipc_recv+0x7b>
+  804284:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804286:	83 ec 08             	sub    $0x8,%esp
+  804289:	50                   	push   %eax
+  80428a:	68 07 4e 80 00       	push   $0x804e07
+  80428f:	e8 fe ef ff ff       	call   803292 <cprintf>
+		*from_env_store = 0;
+  804294:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80429a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042a0:	83 c4 10             	add    $0x10,%esp
+  8042a3:	eb 77                	jmp    80431c <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042a5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042ab:	8b 02                	mov    (%edx),%eax
+  8042ad:	8b 40 78             	mov    0x78(%eax),%eax
+  8042b0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042b2:	85 f6                	test   %esi,%esi
+  8042b4:	74 34                	je     8042ea <ipc_recv+0xba>
+  8042b6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042be:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042c3:	77 18                	ja     8042dd <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042ca:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042cc:	c1 e8 10             	shr    $0x10,%eax
+  8042cf:	74 0c                	je     8042dd <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042d1:	c1 e0 10             	shl    $0x10,%eax
+  8042d4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042d9:	29 c2                	sub    %eax,%edx
+  8042db:	eb 06                	jmp    8042e3 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042dd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042e3:	8b 02                	mov    (%edx),%eax
+  8042e5:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042e8:	89 06                	mov    %eax,(%esi)
+  8042ea:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042ec:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042f2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f7:	77 18                	ja     804311 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042fe:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804300:	c1 e8 10             	shr    $0x10,%eax
+  804303:	74 0c                	je     804311 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804305:	c1 e0 10             	shl    $0x10,%eax
+  804308:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80430d:	29 c2                	sub    %eax,%edx
+  80430f:	eb 06                	jmp    804317 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804311:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804317:	8b 02                	mov    (%edx),%eax
+  804319:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80431c:	89 d8                	mov    %ebx,%eax
+  80431e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804321:	5b                   	pop    %ebx
+  804322:	5e                   	pop    %esi
+  804323:	5f                   	pop    %edi
+  804324:	5d                   	pop    %ebp
+  804325:	c3                   	ret
+
+00804326 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804326:	55                   	push   %ebp
+  804327:	89 e5                	mov    %esp,%ebp
+  804329:	57                   	push   %edi
+  80432a:	56                   	push   %esi
+  80432b:	53                   	push   %ebx
+  80432c:	83 ec 0c             	sub    $0xc,%esp
+  80432f:	8b 75 08             	mov    0x8(%ebp),%esi
+  804332:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804335:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804338:	85 db                	test   %ebx,%ebx
+  80433a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80433f:	0f 44 d8             	cmove  %eax,%ebx
+  804342:	eb 05                	jmp    804349 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804344:	e8 62 be ff ff       	call   8001ab <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804349:	57                   	push   %edi
+  80434a:	53                   	push   %ebx
+  80434b:	ff 75 0c             	push   0xc(%ebp)
+  80434e:	56                   	push   %esi
+  80434f:	e8 4c c0 ff ff       	call   8003a0 <sys_ipc_try_send>
+		if (r == 0) {
+  804354:	83 c4 10             	add    $0x10,%esp
+  804357:	85 c0                	test   %eax,%eax
+  804359:	74 19                	je     804374 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80435b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80435e:	74 e4                	je     804344 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804360:	83 ec 0c             	sub    $0xc,%esp
+  804363:	50                   	push   %eax
+  804364:	57                   	push   %edi
+  804365:	53                   	push   %ebx
+  804366:	56                   	push   %esi
+  804367:	68 20 4e 80 00       	push   $0x804e20
+  80436c:	e8 21 ef ff ff       	call   803292 <cprintf>
+			return;
+  804371:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804377:	5b                   	pop    %ebx
+  804378:	5e                   	pop    %esi
+  804379:	5f                   	pop    %edi
+  80437a:	5d                   	pop    %ebp
+  80437b:	c3                   	ret
+
+0080437c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80437c:	55                   	push   %ebp
+  80437d:	89 e5                	mov    %esp,%ebp
+  80437f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804382:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804387:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80438a:	c1 e0 04             	shl    $0x4,%eax
+  80438d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804392:	8b 40 50             	mov    0x50(%eax),%eax
+  804395:	39 c8                	cmp    %ecx,%eax
+  804397:	74 12                	je     8043ab <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804399:	83 c2 01             	add    $0x1,%edx
+  80439c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043a2:	75 e3                	jne    804387 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a9:	eb 0e                	jmp    8043b9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043ab:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043ae:	c1 e0 04             	shl    $0x4,%eax
+  8043b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043b6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043b9:	5d                   	pop    %ebp
+  8043ba:	c3                   	ret
+
+008043bb <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043bb:	55                   	push   %ebp
+  8043bc:	89 e5                	mov    %esp,%ebp
+  8043be:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043c1:	89 c2                	mov    %eax,%edx
+  8043c3:	c1 ea 16             	shr    $0x16,%edx
+  8043c6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043cd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043d2:	f6 c1 01             	test   $0x1,%cl
+  8043d5:	74 1c                	je     8043f3 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043d7:	c1 e8 0c             	shr    $0xc,%eax
+  8043da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043e1:	a8 01                	test   $0x1,%al
+  8043e3:	74 0e                	je     8043f3 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043e5:	c1 e8 0c             	shr    $0xc,%eax
+  8043e8:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043ef:	ef 
+  8043f0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043f3:	89 d0                	mov    %edx,%eax
+  8043f5:	5d                   	pop    %ebp
+  8043f6:	c3                   	ret
+
+008043f7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043f7:	55                   	push   %ebp
+  8043f8:	89 e5                	mov    %esp,%ebp
+  8043fa:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8043fd:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804404:	74 0a                	je     804410 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804406:	8b 45 08             	mov    0x8(%ebp),%eax
+  804409:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80440e:	c9                   	leave
+  80440f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804410:	83 ec 04             	sub    $0x4,%esp
+  804413:	6a 07                	push   $0x7
+  804415:	68 00 f0 bf ee       	push   $0xeebff000
+  80441a:	6a 00                	push   $0x0
+  80441c:	e8 b6 bd ff ff       	call   8001d7 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804421:	83 c4 08             	add    $0x8,%esp
+  804424:	68 35 44 80 00       	push   $0x804435
+  804429:	6a 00                	push   $0x0
+  80442b:	e8 24 bf ff ff       	call   800354 <sys_env_set_pgfault_upcall>
+  804430:	83 c4 10             	add    $0x10,%esp
+  804433:	eb d1                	jmp    804406 <set_pgfault_handler+0xf>
+
+00804435 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804435:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804436:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80443b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80443d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804440:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804444:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804448:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80444b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80444f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804451:	83 c4 08             	add    $0x8,%esp
+	popal
+  804454:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804455:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804458:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804459:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80445a:	c3                   	ret
+
+0080445b <udm>:
+  80445b:	57                   	push   %edi
+  80445c:	56                   	push   %esi
+  80445d:	53                   	push   %ebx
+  80445e:	83 ec 20             	sub    $0x20,%esp
+  804461:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804465:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804469:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80446d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804471:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804475:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804479:	89 d1                	mov    %edx,%ecx
+  80447b:	09 c1                	or     %eax,%ecx
+  80447d:	0f 84 91 00 00 00    	je     804514 <udm+0xb9>
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+  804488:	ba 00 00 00 00       	mov    $0x0,%edx
+  80448d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804492:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804499:	00 
+  80449a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044a1:	00 
+  8044a2:	eb 08                	jmp    8044ac <udm+0x51>
+  8044a4:	83 e9 01             	sub    $0x1,%ecx
+  8044a7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044aa:	74 7c                	je     804528 <udm+0xcd>
+  8044ac:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044b0:	01 c0                	add    %eax,%eax
+  8044b2:	89 c6                	mov    %eax,%esi
+  8044b4:	89 d7                	mov    %edx,%edi
+  8044b6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044ba:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044be:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044c1:	d3 ea                	shr    %cl,%edx
+  8044c3:	f6 c1 20             	test   $0x20,%cl
+  8044c6:	74 04                	je     8044cc <udm+0x71>
+  8044c8:	89 d0                	mov    %edx,%eax
+  8044ca:	31 d2                	xor    %edx,%edx
+  8044cc:	83 e0 01             	and    $0x1,%eax
+  8044cf:	89 04 24             	mov    %eax,(%esp)
+  8044d2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044d9:	00 
+  8044da:	8b 04 24             	mov    (%esp),%eax
+  8044dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044e1:	09 f0                	or     %esi,%eax
+  8044e3:	09 fa                	or     %edi,%edx
+  8044e5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044e9:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044ed:	39 f0                	cmp    %esi,%eax
+  8044ef:	89 d3                	mov    %edx,%ebx
+  8044f1:	19 fb                	sbb    %edi,%ebx
+  8044f3:	72 af                	jb     8044a4 <udm+0x49>
+  8044f5:	29 f0                	sub    %esi,%eax
+  8044f7:	19 fa                	sbb    %edi,%edx
+  8044f9:	89 cf                	mov    %ecx,%edi
+  8044fb:	c1 ef 05             	shr    $0x5,%edi
+  8044fe:	83 e7 01             	and    $0x1,%edi
+  804501:	89 fe                	mov    %edi,%esi
+  804503:	83 f6 01             	xor    $0x1,%esi
+  804506:	d3 e6                	shl    %cl,%esi
+  804508:	d3 e7                	shl    %cl,%edi
+  80450a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80450e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804512:	eb 90                	jmp    8044a4 <udm+0x49>
+  804514:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804518:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80451c:	89 f0                	mov    %esi,%eax
+  80451e:	89 fa                	mov    %edi,%edx
+  804520:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804524:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804528:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80452c:	89 01                	mov    %eax,(%ecx)
+  80452e:	89 51 04             	mov    %edx,0x4(%ecx)
+  804531:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804535:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804539:	83 c4 20             	add    $0x20,%esp
+  80453c:	5b                   	pop    %ebx
+  80453d:	5e                   	pop    %esi
+  80453e:	5f                   	pop    %edi
+  80453f:	c3                   	ret
+
+00804540 <__udivdi3>:
+  804540:	83 ec 18             	sub    $0x18,%esp
+  804543:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804547:	50                   	push   %eax
+  804548:	ff 74 24 2c          	push   0x2c(%esp)
+  80454c:	ff 74 24 2c          	push   0x2c(%esp)
+  804550:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804554:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804558:	e8 fe fe ff ff       	call   80445b <udm>
+  80455d:	83 c4 24             	add    $0x24,%esp
+  804560:	c3                   	ret
+
+00804561 <__umoddi3>:
+  804561:	83 ec 18             	sub    $0x18,%esp
+  804564:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804568:	50                   	push   %eax
+  804569:	ff 74 24 2c          	push   0x2c(%esp)
+  80456d:	ff 74 24 2c          	push   0x2c(%esp)
+  804571:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804575:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804579:	e8 dd fe ff ff       	call   80445b <udm>
+  80457e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804582:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804586:	83 c4 24             	add    $0x24,%esp
+  804589:	c3                   	ret
+
+0080458a <__divdi3>:
+  80458a:	56                   	push   %esi
+  80458b:	53                   	push   %ebx
+  80458c:	83 ec 14             	sub    $0x14,%esp
+  80458f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804593:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804597:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80459b:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80459f:	85 d2                	test   %edx,%edx
+  8045a1:	78 18                	js     8045bb <__divdi3+0x31>
+  8045a3:	85 db                	test   %ebx,%ebx
+  8045a5:	78 3e                	js     8045e5 <__divdi3+0x5b>
+  8045a7:	83 ec 04             	sub    $0x4,%esp
+  8045aa:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045ae:	56                   	push   %esi
+  8045af:	53                   	push   %ebx
+  8045b0:	51                   	push   %ecx
+  8045b1:	e8 a5 fe ff ff       	call   80445b <udm>
+  8045b6:	83 c4 10             	add    $0x10,%esp
+  8045b9:	eb 24                	jmp    8045df <__divdi3+0x55>
+  8045bb:	f7 d8                	neg    %eax
+  8045bd:	83 d2 00             	adc    $0x0,%edx
+  8045c0:	f7 da                	neg    %edx
+  8045c2:	85 db                	test   %ebx,%ebx
+  8045c4:	78 3a                	js     804600 <__divdi3+0x76>
+  8045c6:	83 ec 04             	sub    $0x4,%esp
+  8045c9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045cd:	56                   	push   %esi
+  8045ce:	53                   	push   %ebx
+  8045cf:	51                   	push   %ecx
+  8045d0:	e8 86 fe ff ff       	call   80445b <udm>
+  8045d5:	83 c4 10             	add    $0x10,%esp
+  8045d8:	f7 d8                	neg    %eax
+  8045da:	83 d2 00             	adc    $0x0,%edx
+  8045dd:	f7 da                	neg    %edx
+  8045df:	83 c4 14             	add    $0x14,%esp
+  8045e2:	5b                   	pop    %ebx
+  8045e3:	5e                   	pop    %esi
+  8045e4:	c3                   	ret
+  8045e5:	83 ec 04             	sub    $0x4,%esp
+  8045e8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045ec:	56                   	push   %esi
+  8045ed:	f7 d9                	neg    %ecx
+  8045ef:	83 d3 00             	adc    $0x0,%ebx
+  8045f2:	f7 db                	neg    %ebx
+  8045f4:	53                   	push   %ebx
+  8045f5:	51                   	push   %ecx
+  8045f6:	e8 60 fe ff ff       	call   80445b <udm>
+  8045fb:	83 c4 10             	add    $0x10,%esp
+  8045fe:	eb d8                	jmp    8045d8 <__divdi3+0x4e>
+  804600:	83 ec 04             	sub    $0x4,%esp
+  804603:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804607:	56                   	push   %esi
+  804608:	f7 d9                	neg    %ecx
+  80460a:	83 d3 00             	adc    $0x0,%ebx
+  80460d:	f7 db                	neg    %ebx
+  80460f:	53                   	push   %ebx
+  804610:	51                   	push   %ecx
+  804611:	e8 45 fe ff ff       	call   80445b <udm>
+  804616:	83 c4 10             	add    $0x10,%esp
+  804619:	eb c4                	jmp    8045df <__divdi3+0x55>
+
+0080461b <__moddi3>:
+  80461b:	55                   	push   %ebp
+  80461c:	57                   	push   %edi
+  80461d:	56                   	push   %esi
+  80461e:	53                   	push   %ebx
+  80461f:	83 ec 24             	sub    $0x24,%esp
+  804622:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804626:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80462a:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80462e:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804632:	85 d2                	test   %edx,%edx
+  804634:	78 3b                	js     804671 <__moddi3+0x56>
+  804636:	83 ec 04             	sub    $0x4,%esp
+  804639:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80463d:	56                   	push   %esi
+  80463e:	89 ce                	mov    %ecx,%esi
+  804640:	f7 de                	neg    %esi
+  804642:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804646:	89 de                	mov    %ebx,%esi
+  804648:	83 d6 00             	adc    $0x0,%esi
+  80464b:	f7 de                	neg    %esi
+  80464d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804651:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804655:	0f 48 f1             	cmovs  %ecx,%esi
+  804658:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80465d:	53                   	push   %ebx
+  80465e:	56                   	push   %esi
+  80465f:	e8 f7 fd ff ff       	call   80445b <udm>
+  804664:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804668:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80466c:	83 c4 10             	add    $0x10,%esp
+  80466f:	eb 47                	jmp    8046b8 <__moddi3+0x9d>
+  804671:	f7 d8                	neg    %eax
+  804673:	83 d2 00             	adc    $0x0,%edx
+  804676:	f7 da                	neg    %edx
+  804678:	83 ec 04             	sub    $0x4,%esp
+  80467b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80467f:	56                   	push   %esi
+  804680:	89 cf                	mov    %ecx,%edi
+  804682:	f7 df                	neg    %edi
+  804684:	89 de                	mov    %ebx,%esi
+  804686:	83 d6 00             	adc    $0x0,%esi
+  804689:	f7 de                	neg    %esi
+  80468b:	0f 49 cf             	cmovns %edi,%ecx
+  80468e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804692:	0f 49 de             	cmovns %esi,%ebx
+  804695:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804699:	ff 74 24 0c          	push   0xc(%esp)
+  80469d:	ff 74 24 0c          	push   0xc(%esp)
+  8046a1:	e8 b5 fd ff ff       	call   80445b <udm>
+  8046a6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046aa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046ae:	f7 d8                	neg    %eax
+  8046b0:	83 d2 00             	adc    $0x0,%edx
+  8046b3:	f7 da                	neg    %edx
+  8046b5:	83 c4 10             	add    $0x10,%esp
+  8046b8:	83 c4 24             	add    $0x24,%esp
+  8046bb:	5b                   	pop    %ebx
+  8046bc:	5e                   	pop    %esi
+  8046bd:	5f                   	pop    %edi
+  8046be:	5d                   	pop    %ebp
+  8046bf:	c3                   	ret
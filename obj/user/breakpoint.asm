@@ -0,0 +1,9679 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 1c             	sub    $0x1c,%esp
+  80003e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800041:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800044:	e8 31 01 00 00       	call   80017a <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800049:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80004c:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800052:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800057:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800059:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80005b:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800061:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800066:	77 16                	ja     80007e <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800068:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80006d:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80006f:	c1 e8 10             	shr    $0x10,%eax
+  800072:	74 0a                	je     80007e <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800074:	c1 e0 10             	shl    $0x10,%eax
+  800077:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80007c:	29 c2                	sub    %eax,%edx
+  80007e:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800081:	c1 e0 04             	shl    $0x4,%eax
+  800084:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800089:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80008b:	85 db                	test   %ebx,%ebx
+  80008d:	7e 07                	jle    800096 <libmain+0x61>
+		binaryname = argv[0];
+  80008f:	8b 06                	mov    (%esi),%eax
+  800091:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800096:	83 ec 08             	sub    $0x8,%esp
+  800099:	56                   	push   %esi
+  80009a:	53                   	push   %ebx
+  80009b:	e8 93 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a0:	e8 0b 00 00 00       	call   8000b0 <exit>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ab:	5b                   	pop    %ebx
+  8000ac:	5e                   	pop    %esi
+  8000ad:	5f                   	pop    %edi
+  8000ae:	5d                   	pop    %ebp
+  8000af:	c3                   	ret
+
+008000b0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b0:	55                   	push   %ebp
+  8000b1:	89 e5                	mov    %esp,%ebp
+  8000b3:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000b6:	6a 00                	push   $0x0
+  8000b8:	e8 12 17 00 00       	call   8017cf <fflush>
+	pthread_kill_others();
+  8000bd:	e8 7d 2d 00 00       	call   802e3f <pthread_kill_others>
+	close_all();
+  8000c2:	e8 ab 07 00 00       	call   800872 <close_all>
+	sys_env_destroy(0);
+  8000c7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000ce:	e8 5c 00 00 00       	call   80012f <sys_env_destroy>
+}
+  8000d3:	83 c4 10             	add    $0x10,%esp
+  8000d6:	c9                   	leave
+  8000d7:	c3                   	ret
+
+008000d8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d8:	55                   	push   %ebp
+  8000d9:	89 e5                	mov    %esp,%ebp
+  8000db:	57                   	push   %edi
+  8000dc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e8:	89 c3                	mov    %eax,%ebx
+  8000ea:	89 c7                	mov    %eax,%edi
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	55                   	push   %ebp
+  8000ef:	56                   	push   %esi
+  8000f0:	89 e5                	mov    %esp,%ebp
+  8000f2:	8d 35 fa 00 80 00    	lea    0x8000fa,%esi
+  8000f8:	0f 34                	sysenter
+
+008000fa <after_sysenter_label_47>:
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5d                   	pop    %ebp
+  8000fc:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000ff:	5b                   	pop    %ebx
+  800100:	5f                   	pop    %edi
+  800101:	5d                   	pop    %ebp
+  800102:	c3                   	ret
+
+00800103 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	57                   	push   %edi
+  800107:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800112:	89 d1                	mov    %edx,%ecx
+  800114:	89 d3                	mov    %edx,%ebx
+  800116:	89 d7                	mov    %edx,%edi
+  800118:	6a 00                	push   $0x0
+  80011a:	55                   	push   %ebp
+  80011b:	56                   	push   %esi
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	8d 35 26 01 80 00    	lea    0x800126,%esi
+  800124:	0f 34                	sysenter
+
+00800126 <after_sysenter_label_128>:
+  800126:	5e                   	pop    %esi
+  800127:	5d                   	pop    %ebp
+  800128:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80012b:	5b                   	pop    %ebx
+  80012c:	5f                   	pop    %edi
+  80012d:	5d                   	pop    %ebp
+  80012e:	c3                   	ret
+
+0080012f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	57                   	push   %edi
+  800133:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800134:	8b 55 08             	mov    0x8(%ebp),%edx
+  800137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800141:	89 cb                	mov    %ecx,%ebx
+  800143:	89 cf                	mov    %ecx,%edi
+  800145:	6a 00                	push   $0x0
+  800147:	55                   	push   %ebp
+  800148:	56                   	push   %esi
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	8d 35 53 01 80 00    	lea    0x800153,%esi
+  800151:	0f 34                	sysenter
+
+00800153 <after_sysenter_label_212>:
+  800153:	5e                   	pop    %esi
+  800154:	5d                   	pop    %ebp
+  800155:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800158:	85 c0                	test   %eax,%eax
+  80015a:	7f 07                	jg     800163 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80015c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80015f:	5b                   	pop    %ebx
+  800160:	5f                   	pop    %edi
+  800161:	5d                   	pop    %ebp
+  800162:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800163:	83 ec 0c             	sub    $0xc,%esp
+  800166:	50                   	push   %eax
+  800167:	6a 03                	push   $0x3
+  800169:	68 ca 46 80 00       	push   $0x8046ca
+  80016e:	6a 54                	push   $0x54
+  800170:	68 e7 46 80 00       	push   $0x8046e7
+  800175:	e8 38 30 00 00       	call   8031b2 <_panic>
+
+0080017a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	57                   	push   %edi
+  80017e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80017f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800184:	b8 02 00 00 00       	mov    $0x2,%eax
+  800189:	89 d1                	mov    %edx,%ecx
+  80018b:	89 d3                	mov    %edx,%ebx
+  80018d:	89 d7                	mov    %edx,%edi
+  80018f:	6a 00                	push   $0x0
+  800191:	55                   	push   %ebp
+  800192:	56                   	push   %esi
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	8d 35 9d 01 80 00    	lea    0x80019d,%esi
+  80019b:	0f 34                	sysenter
+
+0080019d <after_sysenter_label_309>:
+  80019d:	5e                   	pop    %esi
+  80019e:	5d                   	pop    %ebp
+  80019f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001a2:	5b                   	pop    %ebx
+  8001a3:	5f                   	pop    %edi
+  8001a4:	5d                   	pop    %ebp
+  8001a5:	c3                   	ret
+
+008001a6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001b5:	89 d1                	mov    %edx,%ecx
+  8001b7:	89 d3                	mov    %edx,%ebx
+  8001b9:	89 d7                	mov    %edx,%edi
+  8001bb:	6a 00                	push   $0x0
+  8001bd:	55                   	push   %ebp
+  8001be:	56                   	push   %esi
+  8001bf:	89 e5                	mov    %esp,%ebp
+  8001c1:	8d 35 c9 01 80 00    	lea    0x8001c9,%esi
+  8001c7:	0f 34                	sysenter
+
+008001c9 <after_sysenter_label_391>:
+  8001c9:	5e                   	pop    %esi
+  8001ca:	5d                   	pop    %ebp
+  8001cb:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001ce:	5b                   	pop    %ebx
+  8001cf:	5f                   	pop    %edi
+  8001d0:	5d                   	pop    %ebp
+  8001d1:	c3                   	ret
+
+008001d2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	57                   	push   %edi
+  8001d6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	55                   	push   %ebp
+  8001ed:	56                   	push   %esi
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	8d 35 f8 01 80 00    	lea    0x8001f8,%esi
+  8001f6:	0f 34                	sysenter
+
+008001f8 <after_sysenter_label_479>:
+  8001f8:	5e                   	pop    %esi
+  8001f9:	5d                   	pop    %ebp
+  8001fa:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8001fd:	85 c0                	test   %eax,%eax
+  8001ff:	7f 07                	jg     800208 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800201:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5f                   	pop    %edi
+  800206:	5d                   	pop    %ebp
+  800207:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800208:	83 ec 0c             	sub    $0xc,%esp
+  80020b:	50                   	push   %eax
+  80020c:	6a 04                	push   $0x4
+  80020e:	68 ca 46 80 00       	push   $0x8046ca
+  800213:	6a 54                	push   $0x54
+  800215:	68 e7 46 80 00       	push   $0x8046e7
+  80021a:	e8 93 2f 00 00       	call   8031b2 <_panic>
+
+0080021f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80021f:	55                   	push   %ebp
+  800220:	89 e5                	mov    %esp,%ebp
+  800222:	57                   	push   %edi
+  800223:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800224:	8b 55 08             	mov    0x8(%ebp),%edx
+  800227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80022f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800232:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800235:	ff 75 18             	push   0x18(%ebp)
+  800238:	55                   	push   %ebp
+  800239:	56                   	push   %esi
+  80023a:	89 e5                	mov    %esp,%ebp
+  80023c:	8d 35 44 02 80 00    	lea    0x800244,%esi
+  800242:	0f 34                	sysenter
+
+00800244 <after_sysenter_label_593>:
+  800244:	5e                   	pop    %esi
+  800245:	5d                   	pop    %ebp
+  800246:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800249:	85 c0                	test   %eax,%eax
+  80024b:	7f 07                	jg     800254 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80024d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800250:	5b                   	pop    %ebx
+  800251:	5f                   	pop    %edi
+  800252:	5d                   	pop    %ebp
+  800253:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800254:	83 ec 0c             	sub    $0xc,%esp
+  800257:	50                   	push   %eax
+  800258:	6a 05                	push   $0x5
+  80025a:	68 ca 46 80 00       	push   $0x8046ca
+  80025f:	6a 54                	push   $0x54
+  800261:	68 e7 46 80 00       	push   $0x8046e7
+  800266:	e8 47 2f 00 00       	call   8031b2 <_panic>
+
+0080026b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	57                   	push   %edi
+  80026f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800270:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800275:	8b 55 08             	mov    0x8(%ebp),%edx
+  800278:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800280:	89 df                	mov    %ebx,%edi
+  800282:	6a 00                	push   $0x0
+  800284:	55                   	push   %ebp
+  800285:	56                   	push   %esi
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	8d 35 90 02 80 00    	lea    0x800290,%esi
+  80028e:	0f 34                	sysenter
+
+00800290 <after_sysenter_label_704>:
+  800290:	5e                   	pop    %esi
+  800291:	5d                   	pop    %ebp
+  800292:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800295:	85 c0                	test   %eax,%eax
+  800297:	7f 07                	jg     8002a0 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800299:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80029c:	5b                   	pop    %ebx
+  80029d:	5f                   	pop    %edi
+  80029e:	5d                   	pop    %ebp
+  80029f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a0:	83 ec 0c             	sub    $0xc,%esp
+  8002a3:	50                   	push   %eax
+  8002a4:	6a 06                	push   $0x6
+  8002a6:	68 ca 46 80 00       	push   $0x8046ca
+  8002ab:	6a 54                	push   $0x54
+  8002ad:	68 e7 46 80 00       	push   $0x8046e7
+  8002b2:	e8 fb 2e 00 00       	call   8031b2 <_panic>
+
+008002b7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	57                   	push   %edi
+  8002bb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002cc:	89 df                	mov    %ebx,%edi
+  8002ce:	6a 00                	push   $0x0
+  8002d0:	55                   	push   %ebp
+  8002d1:	56                   	push   %esi
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	8d 35 dc 02 80 00    	lea    0x8002dc,%esi
+  8002da:	0f 34                	sysenter
+
+008002dc <after_sysenter_label_808>:
+  8002dc:	5e                   	pop    %esi
+  8002dd:	5d                   	pop    %ebp
+  8002de:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002e1:	85 c0                	test   %eax,%eax
+  8002e3:	7f 07                	jg     8002ec <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002e8:	5b                   	pop    %ebx
+  8002e9:	5f                   	pop    %edi
+  8002ea:	5d                   	pop    %ebp
+  8002eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+  8002ef:	50                   	push   %eax
+  8002f0:	6a 08                	push   $0x8
+  8002f2:	68 ca 46 80 00       	push   $0x8046ca
+  8002f7:	6a 54                	push   $0x54
+  8002f9:	68 e7 46 80 00       	push   $0x8046e7
+  8002fe:	e8 af 2e 00 00       	call   8031b2 <_panic>
+
+00800303 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	57                   	push   %edi
+  800307:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800308:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80030d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800313:	b8 09 00 00 00       	mov    $0x9,%eax
+  800318:	89 df                	mov    %ebx,%edi
+  80031a:	6a 00                	push   $0x0
+  80031c:	55                   	push   %ebp
+  80031d:	56                   	push   %esi
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	8d 35 28 03 80 00    	lea    0x800328,%esi
+  800326:	0f 34                	sysenter
+
+00800328 <after_sysenter_label_912>:
+  800328:	5e                   	pop    %esi
+  800329:	5d                   	pop    %ebp
+  80032a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80032d:	85 c0                	test   %eax,%eax
+  80032f:	7f 07                	jg     800338 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800331:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800334:	5b                   	pop    %ebx
+  800335:	5f                   	pop    %edi
+  800336:	5d                   	pop    %ebp
+  800337:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800338:	83 ec 0c             	sub    $0xc,%esp
+  80033b:	50                   	push   %eax
+  80033c:	6a 09                	push   $0x9
+  80033e:	68 ca 46 80 00       	push   $0x8046ca
+  800343:	6a 54                	push   $0x54
+  800345:	68 e7 46 80 00       	push   $0x8046e7
+  80034a:	e8 63 2e 00 00       	call   8031b2 <_panic>
+
+0080034f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80034f:	55                   	push   %ebp
+  800350:	89 e5                	mov    %esp,%ebp
+  800352:	57                   	push   %edi
+  800353:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80035f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800364:	89 df                	mov    %ebx,%edi
+  800366:	6a 00                	push   $0x0
+  800368:	55                   	push   %ebp
+  800369:	56                   	push   %esi
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	8d 35 74 03 80 00    	lea    0x800374,%esi
+  800372:	0f 34                	sysenter
+
+00800374 <after_sysenter_label_1016>:
+  800374:	5e                   	pop    %esi
+  800375:	5d                   	pop    %ebp
+  800376:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800379:	85 c0                	test   %eax,%eax
+  80037b:	7f 07                	jg     800384 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80037d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800380:	5b                   	pop    %ebx
+  800381:	5f                   	pop    %edi
+  800382:	5d                   	pop    %ebp
+  800383:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800384:	83 ec 0c             	sub    $0xc,%esp
+  800387:	50                   	push   %eax
+  800388:	6a 0a                	push   $0xa
+  80038a:	68 ca 46 80 00       	push   $0x8046ca
+  80038f:	6a 54                	push   $0x54
+  800391:	68 e7 46 80 00       	push   $0x8046e7
+  800396:	e8 17 2e 00 00       	call   8031b2 <_panic>
+
+0080039b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80039b:	55                   	push   %ebp
+  80039c:	89 e5                	mov    %esp,%ebp
+  80039e:	57                   	push   %edi
+  80039f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b1:	6a 00                	push   $0x0
+  8003b3:	55                   	push   %ebp
+  8003b4:	56                   	push   %esi
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	8d 35 bf 03 80 00    	lea    0x8003bf,%esi
+  8003bd:	0f 34                	sysenter
+
+008003bf <after_sysenter_label_1126>:
+  8003bf:	5e                   	pop    %esi
+  8003c0:	5d                   	pop    %ebp
+  8003c1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5f                   	pop    %edi
+  8003c6:	5d                   	pop    %ebp
+  8003c7:	c3                   	ret
+
+008003c8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	57                   	push   %edi
+  8003cc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003da:	89 cb                	mov    %ecx,%ebx
+  8003dc:	89 cf                	mov    %ecx,%edi
+  8003de:	6a 00                	push   $0x0
+  8003e0:	55                   	push   %ebp
+  8003e1:	56                   	push   %esi
+  8003e2:	89 e5                	mov    %esp,%ebp
+  8003e4:	8d 35 ec 03 80 00    	lea    0x8003ec,%esi
+  8003ea:	0f 34                	sysenter
+
+008003ec <after_sysenter_label_1210>:
+  8003ec:	5e                   	pop    %esi
+  8003ed:	5d                   	pop    %ebp
+  8003ee:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8003f1:	85 c0                	test   %eax,%eax
+  8003f3:	7f 07                	jg     8003fc <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8003f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003f8:	5b                   	pop    %ebx
+  8003f9:	5f                   	pop    %edi
+  8003fa:	5d                   	pop    %ebp
+  8003fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fc:	83 ec 0c             	sub    $0xc,%esp
+  8003ff:	50                   	push   %eax
+  800400:	6a 0d                	push   $0xd
+  800402:	68 ca 46 80 00       	push   $0x8046ca
+  800407:	6a 54                	push   $0x54
+  800409:	68 e7 46 80 00       	push   $0x8046e7
+  80040e:	e8 9f 2d 00 00       	call   8031b2 <_panic>
+
+00800413 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	57                   	push   %edi
+  800417:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800418:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80041d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800423:	b8 42 00 00 00       	mov    $0x42,%eax
+  800428:	89 df                	mov    %ebx,%edi
+  80042a:	6a 00                	push   $0x0
+  80042c:	55                   	push   %ebp
+  80042d:	56                   	push   %esi
+  80042e:	89 e5                	mov    %esp,%ebp
+  800430:	8d 35 38 04 80 00    	lea    0x800438,%esi
+  800436:	0f 34                	sysenter
+
+00800438 <after_sysenter_label_1311>:
+  800438:	5e                   	pop    %esi
+  800439:	5d                   	pop    %ebp
+  80043a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80043d:	85 c0                	test   %eax,%eax
+  80043f:	7f 07                	jg     800448 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800441:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800444:	5b                   	pop    %ebx
+  800445:	5f                   	pop    %edi
+  800446:	5d                   	pop    %ebp
+  800447:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800448:	83 ec 0c             	sub    $0xc,%esp
+  80044b:	50                   	push   %eax
+  80044c:	6a 42                	push   $0x42
+  80044e:	68 ca 46 80 00       	push   $0x8046ca
+  800453:	6a 54                	push   $0x54
+  800455:	68 e7 46 80 00       	push   $0x8046e7
+  80045a:	e8 53 2d 00 00       	call   8031b2 <_panic>
+
+0080045f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80045f:	55                   	push   %ebp
+  800460:	89 e5                	mov    %esp,%ebp
+  800462:	57                   	push   %edi
+  800463:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800464:	ba 00 00 00 00       	mov    $0x0,%edx
+  800469:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80046e:	89 d1                	mov    %edx,%ecx
+  800470:	89 d3                	mov    %edx,%ebx
+  800472:	89 d7                	mov    %edx,%edi
+  800474:	6a 00                	push   $0x0
+  800476:	55                   	push   %ebp
+  800477:	56                   	push   %esi
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	8d 35 82 04 80 00    	lea    0x800482,%esi
+  800480:	0f 34                	sysenter
+
+00800482 <after_sysenter_label_1411>:
+  800482:	5e                   	pop    %esi
+  800483:	5d                   	pop    %ebp
+  800484:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800487:	5b                   	pop    %ebx
+  800488:	5f                   	pop    %edi
+  800489:	5d                   	pop    %ebp
+  80048a:	c3                   	ret
+
+0080048b <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80048b:	55                   	push   %ebp
+  80048c:	89 e5                	mov    %esp,%ebp
+  80048e:	57                   	push   %edi
+  80048f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800490:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800495:	8b 55 08             	mov    0x8(%ebp),%edx
+  800498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004a0:	89 df                	mov    %ebx,%edi
+  8004a2:	6a 00                	push   $0x0
+  8004a4:	55                   	push   %ebp
+  8004a5:	56                   	push   %esi
+  8004a6:	89 e5                	mov    %esp,%ebp
+  8004a8:	8d 35 b0 04 80 00    	lea    0x8004b0,%esi
+  8004ae:	0f 34                	sysenter
+
+008004b0 <after_sysenter_label_1497>:
+  8004b0:	5e                   	pop    %esi
+  8004b1:	5d                   	pop    %ebp
+  8004b2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004b5:	5b                   	pop    %ebx
+  8004b6:	5f                   	pop    %edi
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+
+008004b9 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004b9:	55                   	push   %ebp
+  8004ba:	89 e5                	mov    %esp,%ebp
+  8004bc:	57                   	push   %edi
+  8004bd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004ce:	89 df                	mov    %ebx,%edi
+  8004d0:	6a 00                	push   $0x0
+  8004d2:	55                   	push   %ebp
+  8004d3:	56                   	push   %esi
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	8d 35 de 04 80 00    	lea    0x8004de,%esi
+  8004dc:	0f 34                	sysenter
+
+008004de <after_sysenter_label_1583>:
+  8004de:	5e                   	pop    %esi
+  8004df:	5d                   	pop    %ebp
+  8004e0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004e3:	5b                   	pop    %ebx
+  8004e4:	5f                   	pop    %edi
+  8004e5:	5d                   	pop    %ebp
+  8004e6:	c3                   	ret
+
+008004e7 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	57                   	push   %edi
+  8004eb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8004f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004ff:	6a 00                	push   $0x0
+  800501:	55                   	push   %ebp
+  800502:	56                   	push   %esi
+  800503:	89 e5                	mov    %esp,%ebp
+  800505:	8d 35 0d 05 80 00    	lea    0x80050d,%esi
+  80050b:	0f 34                	sysenter
+
+0080050d <after_sysenter_label_1672>:
+  80050d:	5e                   	pop    %esi
+  80050e:	5d                   	pop    %ebp
+  80050f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800512:	5b                   	pop    %ebx
+  800513:	5f                   	pop    %edi
+  800514:	5d                   	pop    %ebp
+  800515:	c3                   	ret
+
+00800516 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800516:	55                   	push   %ebp
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	57                   	push   %edi
+  80051a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80051b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800520:	8b 55 08             	mov    0x8(%ebp),%edx
+  800523:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800526:	b8 12 00 00 00       	mov    $0x12,%eax
+  80052b:	89 df                	mov    %ebx,%edi
+  80052d:	6a 00                	push   $0x0
+  80052f:	55                   	push   %ebp
+  800530:	56                   	push   %esi
+  800531:	89 e5                	mov    %esp,%ebp
+  800533:	8d 35 3b 05 80 00    	lea    0x80053b,%esi
+  800539:	0f 34                	sysenter
+
+0080053b <after_sysenter_label_1758>:
+  80053b:	5e                   	pop    %esi
+  80053c:	5d                   	pop    %ebp
+  80053d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800540:	5b                   	pop    %ebx
+  800541:	5f                   	pop    %edi
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	57                   	push   %edi
+  800548:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800551:	b8 13 00 00 00       	mov    $0x13,%eax
+  800556:	89 cb                	mov    %ecx,%ebx
+  800558:	89 cf                	mov    %ecx,%edi
+  80055a:	6a 00                	push   $0x0
+  80055c:	55                   	push   %ebp
+  80055d:	56                   	push   %esi
+  80055e:	89 e5                	mov    %esp,%ebp
+  800560:	8d 35 68 05 80 00    	lea    0x800568,%esi
+  800566:	0f 34                	sysenter
+
+00800568 <after_sysenter_label_1842>:
+  800568:	5e                   	pop    %esi
+  800569:	5d                   	pop    %ebp
+  80056a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80056d:	85 c0                	test   %eax,%eax
+  80056f:	7f 07                	jg     800578 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800571:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800574:	5b                   	pop    %ebx
+  800575:	5f                   	pop    %edi
+  800576:	5d                   	pop    %ebp
+  800577:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800578:	83 ec 0c             	sub    $0xc,%esp
+  80057b:	50                   	push   %eax
+  80057c:	6a 13                	push   $0x13
+  80057e:	68 ca 46 80 00       	push   $0x8046ca
+  800583:	6a 54                	push   $0x54
+  800585:	68 e7 46 80 00       	push   $0x8046e7
+  80058a:	e8 23 2c 00 00       	call   8031b2 <_panic>
+
+0080058f <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80058f:	55                   	push   %ebp
+  800590:	89 e5                	mov    %esp,%ebp
+  800592:	57                   	push   %edi
+  800593:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800594:	ba 00 00 00 00       	mov    $0x0,%edx
+  800599:	b8 14 00 00 00       	mov    $0x14,%eax
+  80059e:	89 d1                	mov    %edx,%ecx
+  8005a0:	89 d3                	mov    %edx,%ebx
+  8005a2:	89 d7                	mov    %edx,%edi
+  8005a4:	6a 00                	push   $0x0
+  8005a6:	55                   	push   %ebp
+  8005a7:	56                   	push   %esi
+  8005a8:	89 e5                	mov    %esp,%ebp
+  8005aa:	8d 35 b2 05 80 00    	lea    0x8005b2,%esi
+  8005b0:	0f 34                	sysenter
+
+008005b2 <after_sysenter_label_1939>:
+  8005b2:	5e                   	pop    %esi
+  8005b3:	5d                   	pop    %ebp
+  8005b4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005b7:	5b                   	pop    %ebx
+  8005b8:	5f                   	pop    %edi
+  8005b9:	5d                   	pop    %ebp
+  8005ba:	c3                   	ret
+
+008005bb <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005bb:	55                   	push   %ebp
+  8005bc:	89 e5                	mov    %esp,%ebp
+  8005be:	57                   	push   %edi
+  8005bf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005d3:	6a 00                	push   $0x0
+  8005d5:	55                   	push   %ebp
+  8005d6:	56                   	push   %esi
+  8005d7:	89 e5                	mov    %esp,%ebp
+  8005d9:	8d 35 e1 05 80 00    	lea    0x8005e1,%esi
+  8005df:	0f 34                	sysenter
+
+008005e1 <after_sysenter_label_2028>:
+  8005e1:	5e                   	pop    %esi
+  8005e2:	5d                   	pop    %ebp
+  8005e3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005e6:	5b                   	pop    %ebx
+  8005e7:	5f                   	pop    %edi
+  8005e8:	5d                   	pop    %ebp
+  8005e9:	c3                   	ret
+
+008005ea <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005ea:	55                   	push   %ebp
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	57                   	push   %edi
+  8005ee:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fa:	b8 16 00 00 00       	mov    $0x16,%eax
+  8005ff:	89 df                	mov    %ebx,%edi
+  800601:	6a 00                	push   $0x0
+  800603:	55                   	push   %ebp
+  800604:	56                   	push   %esi
+  800605:	89 e5                	mov    %esp,%ebp
+  800607:	8d 35 0f 06 80 00    	lea    0x80060f,%esi
+  80060d:	0f 34                	sysenter
+
+0080060f <after_sysenter_label_2114>:
+  80060f:	5e                   	pop    %esi
+  800610:	5d                   	pop    %ebp
+  800611:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800614:	5b                   	pop    %ebx
+  800615:	5f                   	pop    %edi
+  800616:	5d                   	pop    %ebp
+  800617:	c3                   	ret
+
+00800618 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800618:	55                   	push   %ebp
+  800619:	89 e5                	mov    %esp,%ebp
+  80061b:	57                   	push   %edi
+  80061c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80061d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800622:	8b 55 08             	mov    0x8(%ebp),%edx
+  800625:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800628:	b8 17 00 00 00       	mov    $0x17,%eax
+  80062d:	89 df                	mov    %ebx,%edi
+  80062f:	6a 00                	push   $0x0
+  800631:	55                   	push   %ebp
+  800632:	56                   	push   %esi
+  800633:	89 e5                	mov    %esp,%ebp
+  800635:	8d 35 3d 06 80 00    	lea    0x80063d,%esi
+  80063b:	0f 34                	sysenter
+
+0080063d <after_sysenter_label_2200>:
+  80063d:	5e                   	pop    %esi
+  80063e:	5d                   	pop    %ebp
+  80063f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800642:	5b                   	pop    %ebx
+  800643:	5f                   	pop    %edi
+  800644:	5d                   	pop    %ebp
+  800645:	c3                   	ret
+
+00800646 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800646:	55                   	push   %ebp
+  800647:	89 e5                	mov    %esp,%ebp
+  800649:	57                   	push   %edi
+  80064a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80064b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800650:	8b 55 08             	mov    0x8(%ebp),%edx
+  800653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800656:	b8 18 00 00 00       	mov    $0x18,%eax
+  80065b:	89 df                	mov    %ebx,%edi
+  80065d:	6a 00                	push   $0x0
+  80065f:	55                   	push   %ebp
+  800660:	56                   	push   %esi
+  800661:	89 e5                	mov    %esp,%ebp
+  800663:	8d 35 6b 06 80 00    	lea    0x80066b,%esi
+  800669:	0f 34                	sysenter
+
+0080066b <after_sysenter_label_2286>:
+  80066b:	5e                   	pop    %esi
+  80066c:	5d                   	pop    %ebp
+  80066d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800670:	5b                   	pop    %ebx
+  800671:	5f                   	pop    %edi
+  800672:	5d                   	pop    %ebp
+  800673:	c3                   	ret
+
+00800674 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800674:	55                   	push   %ebp
+  800675:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800677:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80067f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800682:	5d                   	pop    %ebp
+  800683:	c3                   	ret
+
+00800684 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800684:	55                   	push   %ebp
+  800685:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800687:	8b 45 08             	mov    0x8(%ebp),%eax
+  80068a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80068f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800694:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800699:	5d                   	pop    %ebp
+  80069a:	c3                   	ret
+
+0080069b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80069b:	55                   	push   %ebp
+  80069c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80069e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006a3:	eb 02                	jmp    8006a7 <fd_alloc+0xc>
+  8006a5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006a7:	89 c2                	mov    %eax,%edx
+  8006a9:	c1 ea 16             	shr    $0x16,%edx
+  8006ac:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006b3:	f6 c2 01             	test   $0x1,%dl
+  8006b6:	74 2b                	je     8006e3 <fd_alloc+0x48>
+  8006b8:	89 c2                	mov    %eax,%edx
+  8006ba:	c1 ea 0c             	shr    $0xc,%edx
+  8006bd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006c4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006ca:	f6 c1 01             	test   $0x1,%cl
+  8006cd:	74 14                	je     8006e3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006cf:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006d5:	75 ce                	jne    8006a5 <fd_alloc+0xa>
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006dc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006e1:	eb 05                	jmp    8006e8 <fd_alloc+0x4d>
+			return 0;
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006eb:	89 02                	mov    %eax,(%edx)
+}
+  8006ed:	89 c8                	mov    %ecx,%eax
+  8006ef:	5d                   	pop    %ebp
+  8006f0:	c3                   	ret
+
+008006f1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006f1:	55                   	push   %ebp
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006f7:	83 f8 1f             	cmp    $0x1f,%eax
+  8006fa:	77 30                	ja     80072c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006fc:	c1 e0 0c             	shl    $0xc,%eax
+  8006ff:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800704:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80070a:	f6 c2 01             	test   $0x1,%dl
+  80070d:	74 24                	je     800733 <fd_lookup+0x42>
+  80070f:	89 c2                	mov    %eax,%edx
+  800711:	c1 ea 0c             	shr    $0xc,%edx
+  800714:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80071b:	f6 c2 01             	test   $0x1,%dl
+  80071e:	74 1a                	je     80073a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800720:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800723:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800725:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80072a:	5d                   	pop    %ebp
+  80072b:	c3                   	ret
+		return -E_INVAL;
+  80072c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800731:	eb f7                	jmp    80072a <fd_lookup+0x39>
+		return -E_INVAL;
+  800733:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800738:	eb f0                	jmp    80072a <fd_lookup+0x39>
+  80073a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073f:	eb e9                	jmp    80072a <fd_lookup+0x39>
+
+00800741 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800741:	55                   	push   %ebp
+  800742:	89 e5                	mov    %esp,%ebp
+  800744:	53                   	push   %ebx
+  800745:	83 ec 04             	sub    $0x4,%esp
+  800748:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	eb 03                	jmp    800755 <dev_lookup+0x14>
+  800752:	83 c0 01             	add    $0x1,%eax
+  800755:	8b 1c 85 74 47 80 00 	mov    0x804774(,%eax,4),%ebx
+  80075c:	85 db                	test   %ebx,%ebx
+  80075e:	74 0b                	je     80076b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800760:	39 13                	cmp    %edx,(%ebx)
+  800762:	75 ee                	jne    800752 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	eb 49                	jmp    8007b4 <dev_lookup+0x73>
+  80076b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80076d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800773:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800778:	77 18                	ja     800792 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80077a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80077f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800781:	c1 e8 10             	shr    $0x10,%eax
+  800784:	74 0c                	je     800792 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800786:	c1 e0 10             	shl    $0x10,%eax
+  800789:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80078e:	29 c1                	sub    %eax,%ecx
+  800790:	eb 06                	jmp    800798 <dev_lookup+0x57>
+		return pthread_main_tls;
+  800792:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800798:	8b 01                	mov    (%ecx),%eax
+  80079a:	8b 40 48             	mov    0x48(%eax),%eax
+  80079d:	83 ec 04             	sub    $0x4,%esp
+  8007a0:	52                   	push   %edx
+  8007a1:	50                   	push   %eax
+  8007a2:	68 f8 46 80 00       	push   $0x8046f8
+  8007a7:	e8 e1 2a 00 00       	call   80328d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b7:	89 1a                	mov    %ebx,(%edx)
+}
+  8007b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007bc:	c9                   	leave
+  8007bd:	c3                   	ret
+
+008007be <fd_close>:
+{
+  8007be:	55                   	push   %ebp
+  8007bf:	89 e5                	mov    %esp,%ebp
+  8007c1:	57                   	push   %edi
+  8007c2:	56                   	push   %esi
+  8007c3:	53                   	push   %ebx
+  8007c4:	83 ec 24             	sub    $0x24,%esp
+  8007c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007d0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007d1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007d7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007da:	50                   	push   %eax
+  8007db:	e8 11 ff ff ff       	call   8006f1 <fd_lookup>
+  8007e0:	89 c3                	mov    %eax,%ebx
+  8007e2:	83 c4 10             	add    $0x10,%esp
+  8007e5:	85 c0                	test   %eax,%eax
+  8007e7:	78 05                	js     8007ee <fd_close+0x30>
+	    || fd != fd2)
+  8007e9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007ec:	74 16                	je     800804 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8007ee:	89 f8                	mov    %edi,%eax
+  8007f0:	84 c0                	test   %al,%al
+  8007f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007fa:	89 d8                	mov    %ebx,%eax
+  8007fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ff:	5b                   	pop    %ebx
+  800800:	5e                   	pop    %esi
+  800801:	5f                   	pop    %edi
+  800802:	5d                   	pop    %ebp
+  800803:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800804:	83 ec 08             	sub    $0x8,%esp
+  800807:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80080a:	50                   	push   %eax
+  80080b:	ff 36                	push   (%esi)
+  80080d:	e8 2f ff ff ff       	call   800741 <dev_lookup>
+  800812:	89 c3                	mov    %eax,%ebx
+  800814:	83 c4 10             	add    $0x10,%esp
+  800817:	85 c0                	test   %eax,%eax
+  800819:	78 1a                	js     800835 <fd_close+0x77>
+		if (dev->dev_close)
+  80081b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80081e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800821:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800826:	85 c0                	test   %eax,%eax
+  800828:	74 0b                	je     800835 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80082a:	83 ec 0c             	sub    $0xc,%esp
+  80082d:	56                   	push   %esi
+  80082e:	ff d0                	call   *%eax
+  800830:	89 c3                	mov    %eax,%ebx
+  800832:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800835:	83 ec 08             	sub    $0x8,%esp
+  800838:	56                   	push   %esi
+  800839:	6a 00                	push   $0x0
+  80083b:	e8 2b fa ff ff       	call   80026b <sys_page_unmap>
+	return r;
+  800840:	83 c4 10             	add    $0x10,%esp
+  800843:	eb b5                	jmp    8007fa <fd_close+0x3c>
+
+00800845 <close>:
+
+int
+close(int fdnum)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80084b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80084e:	50                   	push   %eax
+  80084f:	ff 75 08             	push   0x8(%ebp)
+  800852:	e8 9a fe ff ff       	call   8006f1 <fd_lookup>
+  800857:	83 c4 10             	add    $0x10,%esp
+  80085a:	85 c0                	test   %eax,%eax
+  80085c:	79 02                	jns    800860 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80085e:	c9                   	leave
+  80085f:	c3                   	ret
+		return fd_close(fd, 1);
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	6a 01                	push   $0x1
+  800865:	ff 75 f4             	push   -0xc(%ebp)
+  800868:	e8 51 ff ff ff       	call   8007be <fd_close>
+  80086d:	83 c4 10             	add    $0x10,%esp
+  800870:	eb ec                	jmp    80085e <close+0x19>
+
+00800872 <close_all>:
+
+void
+close_all(void)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	53                   	push   %ebx
+  800876:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800879:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80087e:	83 ec 0c             	sub    $0xc,%esp
+  800881:	53                   	push   %ebx
+  800882:	e8 be ff ff ff       	call   800845 <close>
+	for (i = 0; i < MAXFD; i++)
+  800887:	83 c3 01             	add    $0x1,%ebx
+  80088a:	83 c4 10             	add    $0x10,%esp
+  80088d:	83 fb 20             	cmp    $0x20,%ebx
+  800890:	75 ec                	jne    80087e <close_all+0xc>
+}
+  800892:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800895:	c9                   	leave
+  800896:	c3                   	ret
+
+00800897 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	57                   	push   %edi
+  80089b:	56                   	push   %esi
+  80089c:	53                   	push   %ebx
+  80089d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008a0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008a3:	50                   	push   %eax
+  8008a4:	ff 75 08             	push   0x8(%ebp)
+  8008a7:	e8 45 fe ff ff       	call   8006f1 <fd_lookup>
+  8008ac:	89 c3                	mov    %eax,%ebx
+  8008ae:	83 c4 10             	add    $0x10,%esp
+  8008b1:	85 c0                	test   %eax,%eax
+  8008b3:	78 7f                	js     800934 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008b5:	83 ec 0c             	sub    $0xc,%esp
+  8008b8:	ff 75 0c             	push   0xc(%ebp)
+  8008bb:	e8 85 ff ff ff       	call   800845 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c3:	c1 e6 0c             	shl    $0xc,%esi
+  8008c6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008cf:	89 3c 24             	mov    %edi,(%esp)
+  8008d2:	e8 ad fd ff ff       	call   800684 <fd2data>
+  8008d7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008d9:	89 34 24             	mov    %esi,(%esp)
+  8008dc:	e8 a3 fd ff ff       	call   800684 <fd2data>
+  8008e1:	83 c4 10             	add    $0x10,%esp
+  8008e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008e7:	89 d8                	mov    %ebx,%eax
+  8008e9:	c1 e8 16             	shr    $0x16,%eax
+  8008ec:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008f3:	a8 01                	test   $0x1,%al
+  8008f5:	74 11                	je     800908 <dup+0x71>
+  8008f7:	89 d8                	mov    %ebx,%eax
+  8008f9:	c1 e8 0c             	shr    $0xc,%eax
+  8008fc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800903:	f6 c2 01             	test   $0x1,%dl
+  800906:	75 36                	jne    80093e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800908:	89 f8                	mov    %edi,%eax
+  80090a:	c1 e8 0c             	shr    $0xc,%eax
+  80090d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800914:	83 ec 0c             	sub    $0xc,%esp
+  800917:	25 07 0e 00 00       	and    $0xe07,%eax
+  80091c:	50                   	push   %eax
+  80091d:	56                   	push   %esi
+  80091e:	6a 00                	push   $0x0
+  800920:	57                   	push   %edi
+  800921:	6a 00                	push   $0x0
+  800923:	e8 f7 f8 ff ff       	call   80021f <sys_page_map>
+  800928:	89 c3                	mov    %eax,%ebx
+  80092a:	83 c4 20             	add    $0x20,%esp
+  80092d:	85 c0                	test   %eax,%eax
+  80092f:	78 33                	js     800964 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800931:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800934:	89 d8                	mov    %ebx,%eax
+  800936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800939:	5b                   	pop    %ebx
+  80093a:	5e                   	pop    %esi
+  80093b:	5f                   	pop    %edi
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80093e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800945:	83 ec 0c             	sub    $0xc,%esp
+  800948:	25 07 0e 00 00       	and    $0xe07,%eax
+  80094d:	50                   	push   %eax
+  80094e:	ff 75 d4             	push   -0x2c(%ebp)
+  800951:	6a 00                	push   $0x0
+  800953:	53                   	push   %ebx
+  800954:	6a 00                	push   $0x0
+  800956:	e8 c4 f8 ff ff       	call   80021f <sys_page_map>
+  80095b:	89 c3                	mov    %eax,%ebx
+  80095d:	83 c4 20             	add    $0x20,%esp
+  800960:	85 c0                	test   %eax,%eax
+  800962:	79 a4                	jns    800908 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800964:	83 ec 08             	sub    $0x8,%esp
+  800967:	56                   	push   %esi
+  800968:	6a 00                	push   $0x0
+  80096a:	e8 fc f8 ff ff       	call   80026b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80096f:	83 c4 08             	add    $0x8,%esp
+  800972:	ff 75 d4             	push   -0x2c(%ebp)
+  800975:	6a 00                	push   $0x0
+  800977:	e8 ef f8 ff ff       	call   80026b <sys_page_unmap>
+	return r;
+  80097c:	83 c4 10             	add    $0x10,%esp
+  80097f:	eb b3                	jmp    800934 <dup+0x9d>
+
+00800981 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	83 ec 18             	sub    $0x18,%esp
+  800989:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80098c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80098f:	50                   	push   %eax
+  800990:	53                   	push   %ebx
+  800991:	e8 5b fd ff ff       	call   8006f1 <fd_lookup>
+  800996:	83 c4 10             	add    $0x10,%esp
+  800999:	85 c0                	test   %eax,%eax
+  80099b:	78 3c                	js     8009d9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80099d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009a0:	83 ec 08             	sub    $0x8,%esp
+  8009a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009a6:	50                   	push   %eax
+  8009a7:	ff 36                	push   (%esi)
+  8009a9:	e8 93 fd ff ff       	call   800741 <dev_lookup>
+  8009ae:	83 c4 10             	add    $0x10,%esp
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	78 24                	js     8009d9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009b5:	8b 46 08             	mov    0x8(%esi),%eax
+  8009b8:	83 e0 03             	and    $0x3,%eax
+  8009bb:	83 f8 01             	cmp    $0x1,%eax
+  8009be:	74 20                	je     8009e0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c3:	8b 40 08             	mov    0x8(%eax),%eax
+  8009c6:	85 c0                	test   %eax,%eax
+  8009c8:	74 61                	je     800a2b <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009ca:	83 ec 04             	sub    $0x4,%esp
+  8009cd:	ff 75 10             	push   0x10(%ebp)
+  8009d0:	ff 75 0c             	push   0xc(%ebp)
+  8009d3:	56                   	push   %esi
+  8009d4:	ff d0                	call   *%eax
+  8009d6:	83 c4 10             	add    $0x10,%esp
+}
+  8009d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009dc:	5b                   	pop    %ebx
+  8009dd:	5e                   	pop    %esi
+  8009de:	5d                   	pop    %ebp
+  8009df:	c3                   	ret
+  8009e0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009e2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009e8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8009ed:	77 18                	ja     800a07 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8009ef:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8009f4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8009f6:	c1 e8 10             	shr    $0x10,%eax
+  8009f9:	74 0c                	je     800a07 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8009fb:	c1 e0 10             	shl    $0x10,%eax
+  8009fe:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a03:	29 c2                	sub    %eax,%edx
+  800a05:	eb 06                	jmp    800a0d <read+0x8c>
+		return pthread_main_tls;
+  800a07:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a0d:	8b 02                	mov    (%edx),%eax
+  800a0f:	8b 40 48             	mov    0x48(%eax),%eax
+  800a12:	83 ec 04             	sub    $0x4,%esp
+  800a15:	53                   	push   %ebx
+  800a16:	50                   	push   %eax
+  800a17:	68 39 47 80 00       	push   $0x804739
+  800a1c:	e8 6c 28 00 00       	call   80328d <cprintf>
+		return -E_INVAL;
+  800a21:	83 c4 10             	add    $0x10,%esp
+  800a24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a29:	eb ae                	jmp    8009d9 <read+0x58>
+		return -E_NOT_SUPP;
+  800a2b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a30:	eb a7                	jmp    8009d9 <read+0x58>
+
+00800a32 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	57                   	push   %edi
+  800a36:	56                   	push   %esi
+  800a37:	53                   	push   %ebx
+  800a38:	83 ec 0c             	sub    $0xc,%esp
+  800a3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a46:	eb 02                	jmp    800a4a <readn+0x18>
+  800a48:	01 c3                	add    %eax,%ebx
+  800a4a:	39 f3                	cmp    %esi,%ebx
+  800a4c:	73 21                	jae    800a6f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a4e:	83 ec 04             	sub    $0x4,%esp
+  800a51:	89 f0                	mov    %esi,%eax
+  800a53:	29 d8                	sub    %ebx,%eax
+  800a55:	50                   	push   %eax
+  800a56:	89 d8                	mov    %ebx,%eax
+  800a58:	03 45 0c             	add    0xc(%ebp),%eax
+  800a5b:	50                   	push   %eax
+  800a5c:	57                   	push   %edi
+  800a5d:	e8 1f ff ff ff       	call   800981 <read>
+		if (m < 0)
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	85 c0                	test   %eax,%eax
+  800a67:	78 04                	js     800a6d <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a69:	75 dd                	jne    800a48 <readn+0x16>
+  800a6b:	eb 02                	jmp    800a6f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a6d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a6f:	89 d8                	mov    %ebx,%eax
+  800a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a74:	5b                   	pop    %ebx
+  800a75:	5e                   	pop    %esi
+  800a76:	5f                   	pop    %edi
+  800a77:	5d                   	pop    %ebp
+  800a78:	c3                   	ret
+
+00800a79 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	56                   	push   %esi
+  800a7d:	53                   	push   %ebx
+  800a7e:	83 ec 18             	sub    $0x18,%esp
+  800a81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a84:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a87:	50                   	push   %eax
+  800a88:	53                   	push   %ebx
+  800a89:	e8 63 fc ff ff       	call   8006f1 <fd_lookup>
+  800a8e:	83 c4 10             	add    $0x10,%esp
+  800a91:	85 c0                	test   %eax,%eax
+  800a93:	78 37                	js     800acc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a95:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a98:	83 ec 08             	sub    $0x8,%esp
+  800a9b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a9e:	50                   	push   %eax
+  800a9f:	ff 36                	push   (%esi)
+  800aa1:	e8 9b fc ff ff       	call   800741 <dev_lookup>
+  800aa6:	83 c4 10             	add    $0x10,%esp
+  800aa9:	85 c0                	test   %eax,%eax
+  800aab:	78 1f                	js     800acc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800aad:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ab1:	74 20                	je     800ad3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ab3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ab9:	85 c0                	test   %eax,%eax
+  800abb:	74 61                	je     800b1e <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800abd:	83 ec 04             	sub    $0x4,%esp
+  800ac0:	ff 75 10             	push   0x10(%ebp)
+  800ac3:	ff 75 0c             	push   0xc(%ebp)
+  800ac6:	56                   	push   %esi
+  800ac7:	ff d0                	call   *%eax
+  800ac9:	83 c4 10             	add    $0x10,%esp
+}
+  800acc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800acf:	5b                   	pop    %ebx
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+  800ad3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ad5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800adb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800ae0:	77 18                	ja     800afa <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800ae2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800ae7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800ae9:	c1 e8 10             	shr    $0x10,%eax
+  800aec:	74 0c                	je     800afa <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800aee:	c1 e0 10             	shl    $0x10,%eax
+  800af1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800af6:	29 c2                	sub    %eax,%edx
+  800af8:	eb 06                	jmp    800b00 <write+0x87>
+		return pthread_main_tls;
+  800afa:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b00:	8b 02                	mov    (%edx),%eax
+  800b02:	8b 40 48             	mov    0x48(%eax),%eax
+  800b05:	83 ec 04             	sub    $0x4,%esp
+  800b08:	53                   	push   %ebx
+  800b09:	50                   	push   %eax
+  800b0a:	68 55 47 80 00       	push   $0x804755
+  800b0f:	e8 79 27 00 00       	call   80328d <cprintf>
+		return -E_INVAL;
+  800b14:	83 c4 10             	add    $0x10,%esp
+  800b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1c:	eb ae                	jmp    800acc <write+0x53>
+		return -E_NOT_SUPP;
+  800b1e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b23:	eb a7                	jmp    800acc <write+0x53>
+
+00800b25 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b25:	55                   	push   %ebp
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b2e:	50                   	push   %eax
+  800b2f:	ff 75 08             	push   0x8(%ebp)
+  800b32:	e8 ba fb ff ff       	call   8006f1 <fd_lookup>
+  800b37:	83 c4 10             	add    $0x10,%esp
+  800b3a:	85 c0                	test   %eax,%eax
+  800b3c:	78 0e                	js     800b4c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b44:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+
+00800b4e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+  800b53:	83 ec 18             	sub    $0x18,%esp
+  800b56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b5c:	50                   	push   %eax
+  800b5d:	53                   	push   %ebx
+  800b5e:	e8 8e fb ff ff       	call   8006f1 <fd_lookup>
+  800b63:	83 c4 10             	add    $0x10,%esp
+  800b66:	85 c0                	test   %eax,%eax
+  800b68:	78 34                	js     800b9e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b6d:	83 ec 08             	sub    $0x8,%esp
+  800b70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b73:	50                   	push   %eax
+  800b74:	ff 36                	push   (%esi)
+  800b76:	e8 c6 fb ff ff       	call   800741 <dev_lookup>
+  800b7b:	83 c4 10             	add    $0x10,%esp
+  800b7e:	85 c0                	test   %eax,%eax
+  800b80:	78 1c                	js     800b9e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b82:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b86:	74 1d                	je     800ba5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b8b:	8b 40 18             	mov    0x18(%eax),%eax
+  800b8e:	85 c0                	test   %eax,%eax
+  800b90:	74 5e                	je     800bf0 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b92:	83 ec 08             	sub    $0x8,%esp
+  800b95:	ff 75 0c             	push   0xc(%ebp)
+  800b98:	56                   	push   %esi
+  800b99:	ff d0                	call   *%eax
+  800b9b:	83 c4 10             	add    $0x10,%esp
+}
+  800b9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ba1:	5b                   	pop    %ebx
+  800ba2:	5e                   	pop    %esi
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+  800ba5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ba7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bad:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bb2:	77 18                	ja     800bcc <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bb4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bb9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bbb:	c1 e8 10             	shr    $0x10,%eax
+  800bbe:	74 0c                	je     800bcc <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bc0:	c1 e0 10             	shl    $0x10,%eax
+  800bc3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bc8:	29 c2                	sub    %eax,%edx
+  800bca:	eb 06                	jmp    800bd2 <ftruncate+0x84>
+		return pthread_main_tls;
+  800bcc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800bd2:	8b 02                	mov    (%edx),%eax
+  800bd4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bd7:	83 ec 04             	sub    $0x4,%esp
+  800bda:	53                   	push   %ebx
+  800bdb:	50                   	push   %eax
+  800bdc:	68 18 47 80 00       	push   $0x804718
+  800be1:	e8 a7 26 00 00       	call   80328d <cprintf>
+		return -E_INVAL;
+  800be6:	83 c4 10             	add    $0x10,%esp
+  800be9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bee:	eb ae                	jmp    800b9e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf5:	eb a7                	jmp    800b9e <ftruncate+0x50>
+
+00800bf7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	56                   	push   %esi
+  800bfb:	53                   	push   %ebx
+  800bfc:	83 ec 18             	sub    $0x18,%esp
+  800bff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c02:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c05:	50                   	push   %eax
+  800c06:	ff 75 08             	push   0x8(%ebp)
+  800c09:	e8 e3 fa ff ff       	call   8006f1 <fd_lookup>
+  800c0e:	83 c4 10             	add    $0x10,%esp
+  800c11:	85 c0                	test   %eax,%eax
+  800c13:	78 49                	js     800c5e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c18:	83 ec 08             	sub    $0x8,%esp
+  800c1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c1e:	50                   	push   %eax
+  800c1f:	ff 36                	push   (%esi)
+  800c21:	e8 1b fb ff ff       	call   800741 <dev_lookup>
+  800c26:	83 c4 10             	add    $0x10,%esp
+  800c29:	85 c0                	test   %eax,%eax
+  800c2b:	78 31                	js     800c5e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c30:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c34:	74 2f                	je     800c65 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c36:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c39:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c40:	00 00 00 
+	stat->st_isdir = 0;
+  800c43:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c4a:	00 00 00 
+	stat->st_dev = dev;
+  800c4d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c53:	83 ec 08             	sub    $0x8,%esp
+  800c56:	53                   	push   %ebx
+  800c57:	56                   	push   %esi
+  800c58:	ff 50 14             	call   *0x14(%eax)
+  800c5b:	83 c4 10             	add    $0x10,%esp
+}
+  800c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c61:	5b                   	pop    %ebx
+  800c62:	5e                   	pop    %esi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c65:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6a:	eb f2                	jmp    800c5e <fstat+0x67>
+
+00800c6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	56                   	push   %esi
+  800c70:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c71:	83 ec 08             	sub    $0x8,%esp
+  800c74:	6a 00                	push   $0x0
+  800c76:	ff 75 08             	push   0x8(%ebp)
+  800c79:	e8 4b 03 00 00       	call   800fc9 <open>
+  800c7e:	89 c3                	mov    %eax,%ebx
+  800c80:	83 c4 10             	add    $0x10,%esp
+  800c83:	85 c0                	test   %eax,%eax
+  800c85:	78 1b                	js     800ca2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c87:	83 ec 08             	sub    $0x8,%esp
+  800c8a:	ff 75 0c             	push   0xc(%ebp)
+  800c8d:	50                   	push   %eax
+  800c8e:	e8 64 ff ff ff       	call   800bf7 <fstat>
+  800c93:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c95:	89 1c 24             	mov    %ebx,(%esp)
+  800c98:	e8 a8 fb ff ff       	call   800845 <close>
+	return r;
+  800c9d:	83 c4 10             	add    $0x10,%esp
+  800ca0:	89 f3                	mov    %esi,%ebx
+}
+  800ca2:	89 d8                	mov    %ebx,%eax
+  800ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+
+00800cab <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	89 c6                	mov    %eax,%esi
+  800cb2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cb4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cbb:	74 27                	je     800ce4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cbd:	6a 07                	push   $0x7
+  800cbf:	68 00 70 80 00       	push   $0x807000
+  800cc4:	56                   	push   %esi
+  800cc5:	ff 35 00 60 80 00    	push   0x806000
+  800ccb:	e8 51 36 00 00       	call   804321 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cd0:	83 c4 0c             	add    $0xc,%esp
+  800cd3:	6a 00                	push   $0x0
+  800cd5:	53                   	push   %ebx
+  800cd6:	6a 00                	push   $0x0
+  800cd8:	e8 4e 35 00 00       	call   80422b <ipc_recv>
+}
+  800cdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	6a 01                	push   $0x1
+  800ce9:	e8 89 36 00 00       	call   804377 <ipc_find_env>
+  800cee:	a3 00 60 80 00       	mov    %eax,0x806000
+  800cf3:	83 c4 10             	add    $0x10,%esp
+  800cf6:	eb c5                	jmp    800cbd <fsipc+0x12>
+
+00800cf8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	53                   	push   %ebx
+  800cfc:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800cff:	68 04 60 80 00       	push   $0x806004
+  800d04:	e8 29 1b 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d0f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d17:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d26:	e8 80 ff ff ff       	call   800cab <fsipc>
+  800d2b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d2d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d34:	e8 66 1b 00 00       	call   80289f <mutex_unlock>
+	return r;
+}
+  800d39:	89 d8                	mov    %ebx,%eax
+  800d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+
+00800d40 <devfile_flush>:
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	53                   	push   %ebx
+  800d44:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d47:	68 04 60 80 00       	push   $0x806004
+  800d4c:	e8 e1 1a 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d54:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d57:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d61:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d66:	e8 40 ff ff ff       	call   800cab <fsipc>
+  800d6b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d6d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d74:	e8 26 1b 00 00       	call   80289f <mutex_unlock>
+}
+  800d79:	89 d8                	mov    %ebx,%eax
+  800d7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d7e:	c9                   	leave
+  800d7f:	c3                   	ret
+
+00800d80 <devfile_stat>:
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	56                   	push   %esi
+  800d84:	53                   	push   %ebx
+  800d85:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	68 04 60 80 00       	push   $0x806004
+  800d90:	e8 9d 1a 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d98:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d9b:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800da0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800daa:	e8 fc fe ff ff       	call   800cab <fsipc>
+  800daf:	89 c3                	mov    %eax,%ebx
+  800db1:	83 c4 10             	add    $0x10,%esp
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	79 16                	jns    800dce <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800db8:	83 ec 0c             	sub    $0xc,%esp
+  800dbb:	68 04 60 80 00       	push   $0x806004
+  800dc0:	e8 da 1a 00 00       	call   80289f <mutex_unlock>
+}
+  800dc5:	89 d8                	mov    %ebx,%eax
+  800dc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dce:	83 ec 08             	sub    $0x8,%esp
+  800dd1:	68 00 70 80 00       	push   $0x807000
+  800dd6:	56                   	push   %esi
+  800dd7:	e8 95 2a 00 00       	call   803871 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800ddc:	a1 80 70 80 00       	mov    0x807080,%eax
+  800de1:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800de7:	a1 84 70 80 00       	mov    0x807084,%eax
+  800dec:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800df2:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	eb bc                	jmp    800db8 <devfile_stat+0x38>
+
+00800dfc <devfile_write>:
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	53                   	push   %ebx
+  800e00:	83 ec 10             	sub    $0x10,%esp
+  800e03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e06:	68 04 60 80 00       	push   $0x806004
+  800e0b:	e8 22 1a 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e13:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e16:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e1b:	83 c4 10             	add    $0x10,%esp
+  800e1e:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e24:	76 3d                	jbe    800e63 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e26:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e2b:	39 c3                	cmp    %eax,%ebx
+  800e2d:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e30:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e33:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e38:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e43:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e48:	e8 5e fe ff ff       	call   800cab <fsipc>
+  800e4d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+  800e52:	68 04 60 80 00       	push   $0x806004
+  800e57:	e8 43 1a 00 00       	call   80289f <mutex_unlock>
+}
+  800e5c:	89 d8                	mov    %ebx,%eax
+  800e5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e61:	c9                   	leave
+  800e62:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e63:	83 ec 04             	sub    $0x4,%esp
+  800e66:	53                   	push   %ebx
+  800e67:	ff 75 0c             	push   0xc(%ebp)
+  800e6a:	68 0c 70 80 00       	push   $0x80700c
+  800e6f:	e8 83 2b 00 00       	call   8039f7 <memmove>
+  800e74:	83 c4 10             	add    $0x10,%esp
+  800e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7c:	eb b5                	jmp    800e33 <devfile_write+0x37>
+
+00800e7e <devfile_read>:
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	56                   	push   %esi
+  800e83:	53                   	push   %ebx
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800e90:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800e96:	0f 86 8c 00 00 00    	jbe    800f28 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800e9c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800ea1:	39 c3                	cmp    %eax,%ebx
+  800ea3:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ea6:	89 f8                	mov    %edi,%eax
+  800ea8:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800eab:	eb 0f                	jmp    800ebc <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800ead:	0f b6 08             	movzbl (%eax),%ecx
+  800eb0:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800eb2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800eb7:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ebc:	39 d0                	cmp    %edx,%eax
+  800ebe:	72 ed                	jb     800ead <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	68 04 60 80 00       	push   $0x806004
+  800ec8:	e8 65 19 00 00       	call   802832 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ecd:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ed0:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800ed5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800edb:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eeb:	e8 bb fd ff ff       	call   800cab <fsipc>
+  800ef0:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800ef2:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800ef9:	e8 a1 19 00 00       	call   80289f <mutex_unlock>
+		assert(r <= (int) n);
+  800efe:	83 c4 10             	add    $0x10,%esp
+  800f01:	39 f3                	cmp    %esi,%ebx
+  800f03:	7c 0a                	jl     800f0f <devfile_read+0x91>
+}
+  800f05:	89 f0                	mov    %esi,%eax
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+		assert(r <= (int) n);
+  800f0f:	68 88 47 80 00       	push   $0x804788
+  800f14:	68 95 47 80 00       	push   $0x804795
+  800f19:	68 90 00 00 00       	push   $0x90
+  800f1e:	68 aa 47 80 00       	push   $0x8047aa
+  800f23:	e8 8a 22 00 00       	call   8031b2 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f28:	83 ec 0c             	sub    $0xc,%esp
+  800f2b:	68 04 60 80 00       	push   $0x806004
+  800f30:	e8 fd 18 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f35:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f38:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f3d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f43:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f4a:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f52:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f57:	e8 4f fd ff ff       	call   800cab <fsipc>
+  800f5c:	89 c6                	mov    %eax,%esi
+  800f5e:	83 c4 10             	add    $0x10,%esp
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	78 1d                	js     800f82 <devfile_read+0x104>
+		assert(r <= n);
+  800f65:	39 c3                	cmp    %eax,%ebx
+  800f67:	72 2e                	jb     800f97 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f6e:	7f 40                	jg     800fb0 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f70:	83 ec 04             	sub    $0x4,%esp
+  800f73:	50                   	push   %eax
+  800f74:	68 00 70 80 00       	push   $0x807000
+  800f79:	57                   	push   %edi
+  800f7a:	e8 78 2a 00 00       	call   8039f7 <memmove>
+  800f7f:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  800f85:	68 04 60 80 00       	push   $0x806004
+  800f8a:	e8 10 19 00 00       	call   80289f <mutex_unlock>
+	return r;
+  800f8f:	83 c4 10             	add    $0x10,%esp
+  800f92:	e9 6e ff ff ff       	jmp    800f05 <devfile_read+0x87>
+		assert(r <= n);
+  800f97:	68 b5 47 80 00       	push   $0x8047b5
+  800f9c:	68 95 47 80 00       	push   $0x804795
+  800fa1:	68 99 00 00 00       	push   $0x99
+  800fa6:	68 aa 47 80 00       	push   $0x8047aa
+  800fab:	e8 02 22 00 00       	call   8031b2 <_panic>
+		assert(r <= PGSIZE);
+  800fb0:	68 bc 47 80 00       	push   $0x8047bc
+  800fb5:	68 95 47 80 00       	push   $0x804795
+  800fba:	68 9a 00 00 00       	push   $0x9a
+  800fbf:	68 aa 47 80 00       	push   $0x8047aa
+  800fc4:	e8 e9 21 00 00       	call   8031b2 <_panic>
+
+00800fc9 <open>:
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 1c             	sub    $0x1c,%esp
+  800fd1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fd4:	56                   	push   %esi
+  800fd5:	e8 5c 28 00 00       	call   803836 <strlen>
+  800fda:	83 c4 10             	add    $0x10,%esp
+  800fdd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe2:	0f 8f 85 00 00 00    	jg     80106d <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+  800feb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fee:	50                   	push   %eax
+  800fef:	e8 a7 f6 ff ff       	call   80069b <fd_alloc>
+  800ff4:	89 c3                	mov    %eax,%ebx
+  800ff6:	83 c4 10             	add    $0x10,%esp
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	78 55                	js     801052 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	68 04 60 80 00       	push   $0x806004
+  801005:	e8 28 18 00 00       	call   802832 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80100a:	83 c4 08             	add    $0x8,%esp
+  80100d:	56                   	push   %esi
+  80100e:	68 00 70 80 00       	push   $0x807000
+  801013:	e8 59 28 00 00       	call   803871 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801018:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80101b:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801020:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801023:	b8 01 00 00 00       	mov    $0x1,%eax
+  801028:	e8 7e fc ff ff       	call   800cab <fsipc>
+  80102d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80102f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801036:	e8 64 18 00 00       	call   80289f <mutex_unlock>
+	if (r < 0) {
+  80103b:	83 c4 10             	add    $0x10,%esp
+  80103e:	85 db                	test   %ebx,%ebx
+  801040:	78 19                	js     80105b <open+0x92>
+	return fd2num(fd);
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	ff 75 f4             	push   -0xc(%ebp)
+  801048:	e8 27 f6 ff ff       	call   800674 <fd2num>
+  80104d:	89 c3                	mov    %eax,%ebx
+  80104f:	83 c4 10             	add    $0x10,%esp
+}
+  801052:	89 d8                	mov    %ebx,%eax
+  801054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+		fd_close(fd, 0);
+  80105b:	83 ec 08             	sub    $0x8,%esp
+  80105e:	6a 00                	push   $0x0
+  801060:	ff 75 f4             	push   -0xc(%ebp)
+  801063:	e8 56 f7 ff ff       	call   8007be <fd_close>
+		return r;
+  801068:	83 c4 10             	add    $0x10,%esp
+  80106b:	eb e5                	jmp    801052 <open+0x89>
+		return -E_BAD_PATH;
+  80106d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801072:	eb de                	jmp    801052 <open+0x89>
+
+00801074 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	53                   	push   %ebx
+  801078:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80107b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80107e:	50                   	push   %eax
+  80107f:	ff 75 08             	push   0x8(%ebp)
+  801082:	e8 6a f6 ff ff       	call   8006f1 <fd_lookup>
+  801087:	89 c3                	mov    %eax,%ebx
+  801089:	83 c4 10             	add    $0x10,%esp
+  80108c:	85 c0                	test   %eax,%eax
+  80108e:	78 5b                	js     8010eb <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801090:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801093:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801099:	39 08                	cmp    %ecx,(%eax)
+  80109b:	75 55                	jne    8010f2 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80109d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010a1:	74 56                	je     8010f9 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+  8010a6:	68 04 60 80 00       	push   $0x806004
+  8010ab:	e8 82 17 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010be:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010c6:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010d5:	e8 d1 fb ff ff       	call   800cab <fsipc>
+  8010da:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010dc:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010e3:	e8 b7 17 00 00       	call   80289f <mutex_unlock>
+	return r;
+  8010e8:	83 c4 10             	add    $0x10,%esp
+}
+  8010eb:	89 d8                	mov    %ebx,%eax
+  8010ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010f2:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8010f7:	eb f2                	jmp    8010eb <fallocate+0x77>
+		return -E_INVAL;
+  8010f9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8010fe:	eb eb                	jmp    8010eb <fallocate+0x77>
+
+00801100 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	56                   	push   %esi
+  801104:	53                   	push   %ebx
+  801105:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801108:	89 f3                	mov    %esi,%ebx
+  80110a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801110:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801113:	eb 06                	jmp    80111b <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801115:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80111b:	39 f3                	cmp    %esi,%ebx
+  80111d:	73 14                	jae    801133 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80111f:	83 ec 08             	sub    $0x8,%esp
+  801122:	53                   	push   %ebx
+  801123:	6a 00                	push   $0x0
+  801125:	e8 41 f1 ff ff       	call   80026b <sys_page_unmap>
+  80112a:	83 c4 10             	add    $0x10,%esp
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	79 e4                	jns    801115 <munmap+0x15>
+  801131:	eb 05                	jmp    801138 <munmap+0x38>
+			return r;
+	return 0;
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113b:	5b                   	pop    %ebx
+  80113c:	5e                   	pop    %esi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+
+0080113f <mmap>:
+{
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	57                   	push   %edi
+  801143:	56                   	push   %esi
+  801144:	53                   	push   %ebx
+  801145:	83 ec 24             	sub    $0x24,%esp
+  801148:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80114b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80114e:	50                   	push   %eax
+  80114f:	ff 75 08             	push   0x8(%ebp)
+  801152:	e8 9a f5 ff ff       	call   8006f1 <fd_lookup>
+  801157:	83 c4 10             	add    $0x10,%esp
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	0f 88 37 01 00 00    	js     801299 <mmap+0x15a>
+		return NULL;
+  801162:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801167:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80116a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801170:	39 0a                	cmp    %ecx,(%edx)
+  801172:	0f 85 05 01 00 00    	jne    80127d <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801178:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80117f:	0f 85 1b 01 00 00    	jne    8012a0 <mmap+0x161>
+  801185:	89 f0                	mov    %esi,%eax
+  801187:	83 e8 01             	sub    $0x1,%eax
+  80118a:	0f 88 17 01 00 00    	js     8012a7 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801190:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801194:	75 28                	jne    8011be <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801196:	83 ec 0c             	sub    $0xc,%esp
+  801199:	68 04 60 80 00       	push   $0x806004
+  80119e:	e8 8f 16 00 00       	call   802832 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011a3:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011a9:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011af:	83 c4 10             	add    $0x10,%esp
+  8011b2:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011b7:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011bc:	eb 2b                	jmp    8011e9 <mmap+0xaa>
+		cow_enable();
+  8011be:	e8 f7 2b 00 00       	call   803dba <cow_enable>
+  8011c3:	eb d1                	jmp    801196 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011c5:	89 c2                	mov    %eax,%edx
+  8011c7:	c1 ea 0c             	shr    $0xc,%edx
+  8011ca:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011d1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011d7:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011dd:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011e0:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011e2:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011e7:	77 25                	ja     80120e <mmap+0xcf>
+  8011e9:	89 c2                	mov    %eax,%edx
+  8011eb:	29 da                	sub    %ebx,%edx
+  8011ed:	39 ca                	cmp    %ecx,%edx
+  8011ef:	73 3a                	jae    80122b <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8011f1:	89 c2                	mov    %eax,%edx
+  8011f3:	c1 ea 16             	shr    $0x16,%edx
+  8011f6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011fd:	f6 c2 01             	test   $0x1,%dl
+  801200:	75 c3                	jne    8011c5 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801202:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801207:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80120c:	eb d4                	jmp    8011e2 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80120e:	29 d8                	sub    %ebx,%eax
+  801210:	39 c8                	cmp    %ecx,%eax
+  801212:	73 17                	jae    80122b <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801214:	83 ec 0c             	sub    $0xc,%esp
+  801217:	68 04 60 80 00       	push   $0x806004
+  80121c:	e8 7e 16 00 00       	call   80289f <mutex_unlock>
+		return NULL;
+  801221:	83 c4 10             	add    $0x10,%esp
+  801224:	b8 00 00 00 00       	mov    $0x0,%eax
+  801229:	eb 52                	jmp    80127d <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80122b:	85 db                	test   %ebx,%ebx
+  80122d:	74 e5                	je     801214 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80122f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801232:	8b 40 0c             	mov    0xc(%eax),%eax
+  801235:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80123a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80123d:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801242:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801248:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  80124e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801251:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801260:	e8 46 fa ff ff       	call   800cab <fsipc>
+  801265:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	68 04 60 80 00       	push   $0x806004
+  80126f:	e8 2b 16 00 00       	call   80289f <mutex_unlock>
+	if (r < 0) {
+  801274:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801277:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801279:	85 ff                	test   %edi,%edi
+  80127b:	78 08                	js     801285 <mmap+0x146>
+}
+  80127d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801280:	5b                   	pop    %ebx
+  801281:	5e                   	pop    %esi
+  801282:	5f                   	pop    %edi
+  801283:	5d                   	pop    %ebp
+  801284:	c3                   	ret
+		munmap((void*) va, len);
+  801285:	83 ec 08             	sub    $0x8,%esp
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	e8 71 fe ff ff       	call   801100 <munmap>
+		return NULL;
+  80128f:	83 c4 10             	add    $0x10,%esp
+  801292:	b8 00 00 00 00       	mov    $0x0,%eax
+  801297:	eb e4                	jmp    80127d <mmap+0x13e>
+		return NULL;
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129e:	eb dd                	jmp    80127d <mmap+0x13e>
+		return NULL;
+  8012a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a5:	eb d6                	jmp    80127d <mmap+0x13e>
+  8012a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ac:	eb cf                	jmp    80127d <mmap+0x13e>
+
+008012ae <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	53                   	push   %ebx
+  8012b2:	83 ec 10             	sub    $0x10,%esp
+  8012b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012b8:	53                   	push   %ebx
+  8012b9:	e8 78 25 00 00       	call   803836 <strlen>
+  8012be:	83 c4 10             	add    $0x10,%esp
+  8012c1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012c6:	7f 42                	jg     80130a <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	68 04 60 80 00       	push   $0x806004
+  8012d0:	e8 5d 15 00 00       	call   802832 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012d5:	83 c4 08             	add    $0x8,%esp
+  8012d8:	53                   	push   %ebx
+  8012d9:	68 00 70 80 00       	push   $0x807000
+  8012de:	e8 8e 25 00 00       	call   803871 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012ed:	e8 b9 f9 ff ff       	call   800cab <fsipc>
+  8012f2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8012f4:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8012fb:	e8 9f 15 00 00       	call   80289f <mutex_unlock>
+	return r;
+  801300:	83 c4 10             	add    $0x10,%esp
+}
+  801303:	89 d8                	mov    %ebx,%eax
+  801305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+		return -E_BAD_PATH;
+  80130a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80130f:	eb f2                	jmp    801303 <remove+0x55>
+
+00801311 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	53                   	push   %ebx
+  801315:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801318:	68 04 60 80 00       	push   $0x806004
+  80131d:	e8 10 15 00 00       	call   802832 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801322:	ba 00 00 00 00       	mov    $0x0,%edx
+  801327:	b8 08 00 00 00       	mov    $0x8,%eax
+  80132c:	e8 7a f9 ff ff       	call   800cab <fsipc>
+  801331:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801333:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80133a:	e8 60 15 00 00       	call   80289f <mutex_unlock>
+	return r;
+}
+  80133f:	89 d8                	mov    %ebx,%eax
+  801341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801344:	c9                   	leave
+  801345:	c3                   	ret
+
+00801346 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80134e:	83 ec 0c             	sub    $0xc,%esp
+  801351:	68 04 60 80 00       	push   $0x806004
+  801356:	e8 d7 14 00 00       	call   802832 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80135b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80135e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801363:	ba 00 00 00 00       	mov    $0x0,%edx
+  801368:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80136d:	e8 39 f9 ff ff       	call   800cab <fsipc>
+  801372:	89 c6                	mov    %eax,%esi
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	85 db                	test   %ebx,%ebx
+  801379:	74 7b                	je     8013f6 <fs_bcstat+0xb0>
+  80137b:	85 c0                	test   %eax,%eax
+  80137d:	78 77                	js     8013f6 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80137f:	a1 00 70 80 00       	mov    0x807000,%eax
+  801384:	89 03                	mov    %eax,(%ebx)
+  801386:	a1 04 70 80 00       	mov    0x807004,%eax
+  80138b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80138e:	a1 08 70 80 00       	mov    0x807008,%eax
+  801393:	89 43 08             	mov    %eax,0x8(%ebx)
+  801396:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80139b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80139e:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013a3:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013a6:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013ab:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013ae:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013b3:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013b6:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013bb:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013be:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013c3:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013c6:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013cb:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013ce:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013d3:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013d6:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013db:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013de:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013e3:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013e6:	a1 34 70 80 00       	mov    0x807034,%eax
+  8013eb:	89 43 34             	mov    %eax,0x34(%ebx)
+  8013ee:	a1 38 70 80 00       	mov    0x807038,%eax
+  8013f3:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	68 04 60 80 00       	push   $0x806004
+  8013fe:	e8 9c 14 00 00       	call   80289f <mutex_unlock>
+	return r;
+}
+  801403:	89 f0                	mov    %esi,%eax
+  801405:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801408:	5b                   	pop    %ebx
+  801409:	5e                   	pop    %esi
+  80140a:	5d                   	pop    %ebp
+  80140b:	c3                   	ret
+
+0080140c <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+  801411:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801413:	0f b6 10             	movzbl (%eax),%edx
+  801416:	80 fa 72             	cmp    $0x72,%dl
+  801419:	74 44                	je     80145f <parse_mode+0x53>
+  80141b:	80 fa 77             	cmp    $0x77,%dl
+  80141e:	74 4b                	je     80146b <parse_mode+0x5f>
+  801420:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801425:	80 fa 61             	cmp    $0x61,%dl
+  801428:	74 09                	je     801433 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80142a:	89 d8                	mov    %ebx,%eax
+  80142c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+	switch (mode[0]) {
+  801433:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801438:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80143d:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80143f:	83 ec 08             	sub    $0x8,%esp
+  801442:	6a 2b                	push   $0x2b
+  801444:	50                   	push   %eax
+  801445:	e8 39 25 00 00       	call   803983 <strchr>
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	74 d9                	je     80142a <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801451:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801454:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801457:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80145d:	eb cb                	jmp    80142a <parse_mode+0x1e>
+	switch (mode[0]) {
+  80145f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801464:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801469:	eb d2                	jmp    80143d <parse_mode+0x31>
+  80146b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801470:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801475:	eb c6                	jmp    80143d <parse_mode+0x31>
+
+00801477 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	56                   	push   %esi
+  80147c:	53                   	push   %ebx
+  80147d:	83 ec 1c             	sub    $0x1c,%esp
+  801480:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801483:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801486:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80148b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801490:	83 c0 24             	add    $0x24,%eax
+  801493:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801497:	74 17                	je     8014b0 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801499:	83 c3 01             	add    $0x1,%ebx
+  80149c:	83 fb 10             	cmp    $0x10,%ebx
+  80149f:	75 ef                	jne    801490 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014a1:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014a6:	89 f0                	mov    %esi,%eax
+  8014a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ab:	5b                   	pop    %ebx
+  8014ac:	5e                   	pop    %esi
+  8014ad:	5f                   	pop    %edi
+  8014ae:	5d                   	pop    %ebp
+  8014af:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014b0:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014b7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014ba:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014bd:	c1 e7 02             	shl    $0x2,%edi
+  8014c0:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+  8014c9:	6a 24                	push   $0x24
+  8014cb:	6a 00                	push   $0x0
+  8014cd:	56                   	push   %esi
+  8014ce:	e8 ef 24 00 00       	call   8039c2 <memset>
+			streams[i].f_fd = fd;
+  8014d3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014d6:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014dc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014df:	01 d8                	add    %ebx,%eax
+  8014e1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014e4:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	eb b6                	jmp    8014a6 <stream_alloc+0x2f>
+
+008014f0 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 14             	sub    $0x14,%esp
+  8014f7:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8014f9:	8b 40 18             	mov    0x18(%eax),%eax
+  8014fc:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8014ff:	74 4a                	je     80154b <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801501:	83 ec 08             	sub    $0x8,%esp
+  801504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801507:	50                   	push   %eax
+  801508:	ff 33                	push   (%ebx)
+  80150a:	e8 e2 f1 ff ff       	call   8006f1 <fd_lookup>
+  80150f:	89 c2                	mov    %eax,%edx
+  801511:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801519:	85 d2                	test   %edx,%edx
+  80151b:	78 41                	js     80155e <stream_unread+0x6e>
+  80151d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801520:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801526:	39 0a                	cmp    %ecx,(%edx)
+  801528:	75 34                	jne    80155e <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80152a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80152d:	03 42 04             	add    0x4(%edx),%eax
+  801530:	2b 43 18             	sub    0x18(%ebx),%eax
+  801533:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801536:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80153d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801544:	b8 01 00 00 00       	mov    $0x1,%eax
+  801549:	eb 13                	jmp    80155e <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80154b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801552:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801559:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80155e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801561:	c9                   	leave
+  801562:	c3                   	ret
+
+00801563 <stream_drain>:
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	eb 02                	jmp    801573 <stream_drain+0x10>
+  801571:	01 c3                	add    %eax,%ebx
+  801573:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801576:	39 c3                	cmp    %eax,%ebx
+  801578:	73 43                	jae    8015bd <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80157a:	83 ec 04             	sub    $0x4,%esp
+  80157d:	29 d8                	sub    %ebx,%eax
+  80157f:	50                   	push   %eax
+  801580:	89 d8                	mov    %ebx,%eax
+  801582:	03 46 0c             	add    0xc(%esi),%eax
+  801585:	50                   	push   %eax
+  801586:	ff 36                	push   (%esi)
+  801588:	e8 ec f4 ff ff       	call   800a79 <write>
+  80158d:	83 c4 10             	add    $0x10,%esp
+  801590:	85 c0                	test   %eax,%eax
+  801592:	7f dd                	jg     801571 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801594:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801598:	8b 56 0c             	mov    0xc(%esi),%edx
+  80159b:	83 ec 04             	sub    $0x4,%esp
+  80159e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015a1:	29 d8                	sub    %ebx,%eax
+  8015a3:	50                   	push   %eax
+  8015a4:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	52                   	push   %edx
+  8015a9:	e8 49 24 00 00       	call   8039f7 <memmove>
+			f->f_wend -= done;
+  8015ae:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015b1:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015b3:	83 c4 10             	add    $0x10,%esp
+  8015b6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015bb:	eb 0a                	jmp    8015c7 <stream_drain+0x64>
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015c2:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015c7:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015ca:	89 d0                	mov    %edx,%eax
+  8015cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5d                   	pop    %ebp
+  8015d2:	c3                   	ret
+
+008015d3 <stream_setup>:
+	if (f->f_buf)
+  8015d3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015d7:	74 01                	je     8015da <stream_setup+0x7>
+  8015d9:	c3                   	ret
+{
+  8015da:	55                   	push   %ebp
+  8015db:	89 e5                	mov    %esp,%ebp
+  8015dd:	53                   	push   %ebx
+  8015de:	83 ec 04             	sub    $0x4,%esp
+  8015e1:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015e3:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	74 17                	je     801601 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015ea:	83 f8 03             	cmp    $0x3,%eax
+  8015ed:	75 2d                	jne    80161c <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8015ef:	8d 43 20             	lea    0x20(%ebx),%eax
+  8015f2:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8015f5:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8015fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	ff 33                	push   (%ebx)
+  801606:	e8 29 1b 00 00       	call   803134 <iscons>
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	0f 9f c0             	setg   %al
+  801613:	0f b6 c0             	movzbl %al,%eax
+  801616:	83 c0 01             	add    $0x1,%eax
+  801619:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80161c:	83 ec 0c             	sub    $0xc,%esp
+  80161f:	68 00 10 00 00       	push   $0x1000
+  801624:	e8 6e 0b 00 00       	call   802197 <malloc>
+  801629:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	74 bc                	je     8015ef <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801633:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80163a:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80163e:	eb bc                	jmp    8015fc <stream_setup+0x29>
+
+00801640 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	53                   	push   %ebx
+  801644:	83 ec 04             	sub    $0x4,%esp
+  801647:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  801649:	e8 85 ff ff ff       	call   8015d3 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80164e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801653:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801657:	74 3d                	je     801696 <stream_fill+0x56>
+  801659:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80165d:	74 10                	je     80166f <stream_fill+0x2f>
+  80165f:	89 d8                	mov    %ebx,%eax
+  801661:	e8 fd fe ff ff       	call   801563 <stream_drain>
+		return 0;
+  801666:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80166b:	85 c0                	test   %eax,%eax
+  80166d:	78 27                	js     801696 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80166f:	83 ec 04             	sub    $0x4,%esp
+  801672:	ff 73 10             	push   0x10(%ebx)
+  801675:	ff 73 0c             	push   0xc(%ebx)
+  801678:	ff 33                	push   (%ebx)
+  80167a:	e8 02 f3 ff ff       	call   800981 <read>
+  80167f:	83 c4 10             	add    $0x10,%esp
+  801682:	85 c0                	test   %eax,%eax
+  801684:	7e 17                	jle    80169d <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  801686:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80168a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  801691:	89 c2                	mov    %eax,%edx
+  801693:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  801696:	89 d0                	mov    %edx,%eax
+  801698:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80169d:	c1 f8 1f             	sar    $0x1f,%eax
+  8016a0:	83 e0 04             	and    $0x4,%eax
+  8016a3:	83 c0 04             	add    $0x4,%eax
+  8016a6:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ae:	eb e6                	jmp    801696 <stream_fill+0x56>
+
+008016b0 <fopen>:
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	57                   	push   %edi
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+  8016b6:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016bf:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016c5:	89 f0                	mov    %esi,%eax
+  8016c7:	e8 40 fd ff ff       	call   80140c <parse_mode>
+		return 0;
+  8016cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 2d                	js     801702 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	50                   	push   %eax
+  8016d9:	ff 75 08             	push   0x8(%ebp)
+  8016dc:	e8 e8 f8 ff ff       	call   800fc9 <open>
+  8016e1:	89 c7                	mov    %eax,%edi
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 58                	js     801742 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016ea:	80 3e 61             	cmpb   $0x61,(%esi)
+  8016ed:	74 1d                	je     80170c <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8016ef:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8016f5:	89 f8                	mov    %edi,%eax
+  8016f7:	e8 7b fd ff ff       	call   801477 <stream_alloc>
+  8016fc:	89 c3                	mov    %eax,%ebx
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	74 32                	je     801734 <fopen+0x84>
+}
+  801702:	89 d8                	mov    %ebx,%eax
+  801704:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5f                   	pop    %edi
+  80170a:	5d                   	pop    %ebp
+  80170b:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80170c:	83 ec 08             	sub    $0x8,%esp
+  80170f:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801715:	50                   	push   %eax
+  801716:	57                   	push   %edi
+  801717:	e8 db f4 ff ff       	call   800bf7 <fstat>
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 cc                	js     8016ef <fopen+0x3f>
+		seek(fd, st.st_size);
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	ff 75 dc             	push   -0x24(%ebp)
+  801729:	57                   	push   %edi
+  80172a:	e8 f6 f3 ff ff       	call   800b25 <seek>
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	eb bb                	jmp    8016ef <fopen+0x3f>
+		close(fd);
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	57                   	push   %edi
+  801738:	e8 08 f1 ff ff       	call   800845 <close>
+  80173d:	83 c4 10             	add    $0x10,%esp
+  801740:	eb c0                	jmp    801702 <fopen+0x52>
+		return 0;
+  801742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801747:	eb b9                	jmp    801702 <fopen+0x52>
+
+00801749 <fdopen>:
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80174f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801752:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801755:	e8 b2 fc ff ff       	call   80140c <parse_mode>
+  80175a:	89 c2                	mov    %eax,%edx
+		return 0;
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801761:	85 d2                	test   %edx,%edx
+  801763:	78 0b                	js     801770 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  801765:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176b:	e8 07 fd ff ff       	call   801477 <stream_alloc>
+}
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+00801772 <setvbuf>:
+{
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	57                   	push   %edi
+  801776:	56                   	push   %esi
+  801777:	53                   	push   %ebx
+  801778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80177e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801781:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801785:	75 3a                	jne    8017c1 <setvbuf+0x4f>
+  801787:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80178a:	83 fe 02             	cmp    $0x2,%esi
+  80178d:	77 39                	ja     8017c8 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80178f:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  801792:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801796:	0f 95 c3             	setne  %bl
+  801799:	85 ff                	test   %edi,%edi
+  80179b:	0f 95 c1             	setne  %cl
+  80179e:	84 cb                	test   %cl,%bl
+  8017a0:	74 05                	je     8017a7 <setvbuf+0x35>
+  8017a2:	83 fa 03             	cmp    $0x3,%edx
+  8017a5:	75 0a                	jne    8017b1 <setvbuf+0x3f>
+	return 0;
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ac:	5b                   	pop    %ebx
+  8017ad:	5e                   	pop    %esi
+  8017ae:	5f                   	pop    %edi
+  8017af:	5d                   	pop    %ebp
+  8017b0:	c3                   	ret
+		f->f_buf = buf;
+  8017b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b4:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017b7:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bf:	eb eb                	jmp    8017ac <setvbuf+0x3a>
+		return EOF;
+  8017c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017c6:	eb e4                	jmp    8017ac <setvbuf+0x3a>
+  8017c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017cd:	eb dd                	jmp    8017ac <setvbuf+0x3a>
+
+008017cf <fflush>:
+{
+  8017cf:	55                   	push   %ebp
+  8017d0:	89 e5                	mov    %esp,%ebp
+  8017d2:	57                   	push   %edi
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 0c             	sub    $0xc,%esp
+  8017d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017db:	85 db                	test   %ebx,%ebx
+  8017dd:	74 1a                	je     8017f9 <fflush+0x2a>
+	stream_unread(f);
+  8017df:	89 d8                	mov    %ebx,%eax
+  8017e1:	e8 0a fd ff ff       	call   8014f0 <stream_unread>
+	return stream_drain(f);
+  8017e6:	89 d8                	mov    %ebx,%eax
+  8017e8:	e8 76 fd ff ff       	call   801563 <stream_drain>
+  8017ed:	89 c7                	mov    %eax,%edi
+}
+  8017ef:	89 f8                	mov    %edi,%eax
+  8017f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5f                   	pop    %edi
+  8017f7:	5d                   	pop    %ebp
+  8017f8:	c3                   	ret
+  8017f9:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8017fe:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801803:	bf 00 00 00 00       	mov    $0x0,%edi
+  801808:	eb 03                	jmp    80180d <fflush+0x3e>
+  80180a:	83 c3 24             	add    $0x24,%ebx
+  80180d:	39 f3                	cmp    %esi,%ebx
+  80180f:	74 de                	je     8017ef <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801811:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  801815:	74 f3                	je     80180a <fflush+0x3b>
+  801817:	83 ec 0c             	sub    $0xc,%esp
+  80181a:	53                   	push   %ebx
+  80181b:	e8 af ff ff ff       	call   8017cf <fflush>
+  801820:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801823:	85 c0                	test   %eax,%eax
+  801825:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80182a:	0f 48 f8             	cmovs  %eax,%edi
+  80182d:	eb db                	jmp    80180a <fflush+0x3b>
+
+0080182f <fclose>:
+{
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	56                   	push   %esi
+  801833:	53                   	push   %ebx
+  801834:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801837:	83 ec 0c             	sub    $0xc,%esp
+  80183a:	56                   	push   %esi
+  80183b:	e8 8f ff ff ff       	call   8017cf <fflush>
+  801840:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801842:	83 c4 04             	add    $0x4,%esp
+  801845:	ff 36                	push   (%esi)
+  801847:	e8 f9 ef ff ff       	call   800845 <close>
+  80184c:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801856:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  801859:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80185d:	75 10                	jne    80186f <fclose+0x40>
+	f->f_flags = 0;
+  80185f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  801866:	89 d8                	mov    %ebx,%eax
+  801868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186b:	5b                   	pop    %ebx
+  80186c:	5e                   	pop    %esi
+  80186d:	5d                   	pop    %ebp
+  80186e:	c3                   	ret
+		free(f->f_buf);
+  80186f:	83 ec 0c             	sub    $0xc,%esp
+  801872:	ff 76 0c             	push   0xc(%esi)
+  801875:	e8 54 08 00 00       	call   8020ce <free>
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	eb e0                	jmp    80185f <fclose+0x30>
+
+0080187f <fileno>:
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801882:	8b 45 08             	mov    0x8(%ebp),%eax
+  801885:	8b 00                	mov    (%eax),%eax
+}
+  801887:	5d                   	pop    %ebp
+  801888:	c3                   	ret
+
+00801889 <feof>:
+{
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80188c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188f:	8b 40 04             	mov    0x4(%eax),%eax
+  801892:	c1 e8 02             	shr    $0x2,%eax
+  801895:	83 e0 01             	and    $0x1,%eax
+}
+  801898:	5d                   	pop    %ebp
+  801899:	c3                   	ret
+
+0080189a <ferror>:
+{
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	8b 40 04             	mov    0x4(%eax),%eax
+  8018a3:	c1 e8 03             	shr    $0x3,%eax
+  8018a6:	83 e0 01             	and    $0x1,%eax
+}
+  8018a9:	5d                   	pop    %ebp
+  8018aa:	c3                   	ret
+
+008018ab <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018ab:	55                   	push   %ebp
+  8018ac:	89 e5                	mov    %esp,%ebp
+  8018ae:	53                   	push   %ebx
+  8018af:	83 ec 04             	sub    $0x4,%esp
+  8018b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018b5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018b8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018bb:	74 15                	je     8018d2 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018bd:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018c0:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018c3:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018c6:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018c9:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018d2:	89 d8                	mov    %ebx,%eax
+  8018d4:	e8 67 fd ff ff       	call   801640 <stream_fill>
+  8018d9:	85 c0                	test   %eax,%eax
+  8018db:	75 e0                	jne    8018bd <fgetc+0x12>
+		return EOF;
+  8018dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018e2:	eb e9                	jmp    8018cd <fgetc+0x22>
+
+008018e4 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	57                   	push   %edi
+  8018e8:	56                   	push   %esi
+  8018e9:	53                   	push   %ebx
+  8018ea:	83 ec 1c             	sub    $0x1c,%esp
+  8018ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8018f0:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8018f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f8:	83 e8 01             	sub    $0x1,%eax
+  8018fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8018fe:	eb 66                	jmp    801966 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801900:	8b 46 14             	mov    0x14(%esi),%eax
+  801903:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801906:	29 c3                	sub    %eax,%ebx
+  801908:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80190b:	29 fa                	sub    %edi,%edx
+  80190d:	39 d3                	cmp    %edx,%ebx
+  80190f:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801912:	83 ec 04             	sub    $0x4,%esp
+  801915:	53                   	push   %ebx
+  801916:	6a 0a                	push   $0xa
+  801918:	03 46 0c             	add    0xc(%esi),%eax
+  80191b:	50                   	push   %eax
+  80191c:	e8 87 21 00 00       	call   803aa8 <memfind>
+  801921:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801924:	8b 46 0c             	mov    0xc(%esi),%eax
+  801927:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80192a:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80192d:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80192f:	83 c4 10             	add    $0x10,%esp
+  801932:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  801935:	74 0b                	je     801942 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801937:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80193a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80193d:	29 d3                	sub    %edx,%ebx
+  80193f:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801942:	83 ec 04             	sub    $0x4,%esp
+  801945:	53                   	push   %ebx
+  801946:	01 c8                	add    %ecx,%eax
+  801948:	50                   	push   %eax
+  801949:	89 f8                	mov    %edi,%eax
+  80194b:	03 45 08             	add    0x8(%ebp),%eax
+  80194e:	50                   	push   %eax
+  80194f:	e8 a3 20 00 00       	call   8039f7 <memmove>
+		f->f_rpos += m;
+  801954:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801957:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  801959:	83 c4 10             	add    $0x10,%esp
+  80195c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195f:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801964:	74 1f                	je     801985 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  801966:	8d 47 01             	lea    0x1(%edi),%eax
+  801969:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80196c:	73 17                	jae    801985 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80196e:	8b 46 18             	mov    0x18(%esi),%eax
+  801971:	39 46 14             	cmp    %eax,0x14(%esi)
+  801974:	75 8a                	jne    801900 <fgets+0x1c>
+  801976:	89 f0                	mov    %esi,%eax
+  801978:	e8 c3 fc ff ff       	call   801640 <stream_fill>
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	0f 85 7b ff ff ff    	jne    801900 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  801985:	85 ff                	test   %edi,%edi
+  801987:	74 0f                	je     801998 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  801989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198c:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  801990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801993:	5b                   	pop    %ebx
+  801994:	5e                   	pop    %esi
+  801995:	5f                   	pop    %edi
+  801996:	5d                   	pop    %ebp
+  801997:	c3                   	ret
+		return 0;
+  801998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199d:	eb f1                	jmp    801990 <fgets+0xac>
+
+0080199f <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80199f:	55                   	push   %ebp
+  8019a0:	89 e5                	mov    %esp,%ebp
+  8019a2:	57                   	push   %edi
+  8019a3:	56                   	push   %esi
+  8019a4:	53                   	push   %ebx
+  8019a5:	83 ec 1c             	sub    $0x1c,%esp
+  8019a8:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019ab:	89 f0                	mov    %esi,%eax
+  8019ad:	e8 21 fc ff ff       	call   8015d3 <stream_setup>
+	want = size * n;
+  8019b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b5:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c1:	eb 43                	jmp    801a06 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019c3:	29 d3                	sub    %edx,%ebx
+  8019c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019c8:	29 f8                	sub    %edi,%eax
+  8019ca:	39 c3                	cmp    %eax,%ebx
+  8019cc:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019cf:	83 ec 04             	sub    $0x4,%esp
+  8019d2:	53                   	push   %ebx
+  8019d3:	03 56 0c             	add    0xc(%esi),%edx
+  8019d6:	52                   	push   %edx
+  8019d7:	89 f8                	mov    %edi,%eax
+  8019d9:	03 45 08             	add    0x8(%ebp),%eax
+  8019dc:	50                   	push   %eax
+  8019dd:	e8 15 20 00 00       	call   8039f7 <memmove>
+			f->f_rpos += m;
+  8019e2:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	eb 1a                	jmp    801a04 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019ea:	83 ec 04             	sub    $0x4,%esp
+  8019ed:	53                   	push   %ebx
+  8019ee:	89 f8                	mov    %edi,%eax
+  8019f0:	03 45 08             	add    0x8(%ebp),%eax
+  8019f3:	50                   	push   %eax
+  8019f4:	ff 36                	push   (%esi)
+  8019f6:	e8 86 ef ff ff       	call   800981 <read>
+  8019fb:	89 c3                	mov    %eax,%ebx
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	7e 36                	jle    801a3a <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a04:	01 df                	add    %ebx,%edi
+  801a06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a09:	39 c7                	cmp    %eax,%edi
+  801a0b:	73 39                	jae    801a46 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a0d:	8b 56 14             	mov    0x14(%esi),%edx
+  801a10:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a13:	39 da                	cmp    %ebx,%edx
+  801a15:	72 ac                	jb     8019c3 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a17:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a1a:	29 fb                	sub    %edi,%ebx
+  801a1c:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a1f:	72 3e                	jb     801a5f <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a21:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a25:	74 1f                	je     801a46 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a27:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a2b:	74 bd                	je     8019ea <fread+0x4b>
+  801a2d:	89 f0                	mov    %esi,%eax
+  801a2f:	e8 2f fb ff ff       	call   801563 <stream_drain>
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	79 b2                	jns    8019ea <fread+0x4b>
+  801a38:	eb 0c                	jmp    801a46 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a3a:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a3d:	83 e3 04             	and    $0x4,%ebx
+  801a40:	83 c3 04             	add    $0x4,%ebx
+  801a43:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	74 0a                	je     801a57 <fread+0xb8>
+  801a4d:	89 f8                	mov    %edi,%eax
+  801a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a54:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5a:	5b                   	pop    %ebx
+  801a5b:	5e                   	pop    %esi
+  801a5c:	5f                   	pop    %edi
+  801a5d:	5d                   	pop    %ebp
+  801a5e:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a5f:	89 f0                	mov    %esi,%eax
+  801a61:	e8 da fb ff ff       	call   801640 <stream_fill>
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	74 dc                	je     801a46 <fread+0xa7>
+			m = 0;
+  801a6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6f:	eb 93                	jmp    801a04 <fread+0x65>
+
+00801a71 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	57                   	push   %edi
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	83 ec 1c             	sub    $0x1c,%esp
+  801a7a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a7d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a80:	a8 02                	test   $0x2,%al
+  801a82:	75 13                	jne    801a97 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a84:	83 c8 08             	or     $0x8,%eax
+  801a87:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801a8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a92:	5b                   	pop    %ebx
+  801a93:	5e                   	pop    %esi
+  801a94:	5f                   	pop    %edi
+  801a95:	5d                   	pop    %ebp
+  801a96:	c3                   	ret
+	stream_setup(f);
+  801a97:	89 d8                	mov    %ebx,%eax
+  801a99:	e8 35 fb ff ff       	call   8015d3 <stream_setup>
+	want = size * n;
+  801a9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa1:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aa5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801aa8:	89 d8                	mov    %ebx,%eax
+  801aaa:	e8 41 fa ff ff       	call   8014f0 <stream_unread>
+	for (done = 0; done < want; ) {
+  801aaf:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ab4:	84 c0                	test   %al,%al
+  801ab6:	75 7b                	jne    801b33 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ab8:	be 00 00 00 00       	mov    $0x0,%esi
+  801abd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ac0:	39 fe                	cmp    %edi,%esi
+  801ac2:	73 24                	jae    801ae8 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ac4:	83 ec 04             	sub    $0x4,%esp
+  801ac7:	89 f8                	mov    %edi,%eax
+  801ac9:	29 f0                	sub    %esi,%eax
+  801acb:	50                   	push   %eax
+  801acc:	89 f0                	mov    %esi,%eax
+  801ace:	03 45 08             	add    0x8(%ebp),%eax
+  801ad1:	50                   	push   %eax
+  801ad2:	ff 33                	push   (%ebx)
+  801ad4:	e8 a0 ef ff ff       	call   800a79 <write>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	7e 04                	jle    801ae4 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801ae0:	01 c6                	add    %eax,%esi
+  801ae2:	eb dc                	jmp    801ac0 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801ae4:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801ae8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	74 a0                	je     801a8f <fwrite+0x1e>
+  801aef:	89 f0                	mov    %esi,%eax
+  801af1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af6:	f7 75 0c             	divl   0xc(%ebp)
+  801af9:	eb 94                	jmp    801a8f <fwrite+0x1e>
+			done += r;
+  801afb:	01 c7                	add    %eax,%edi
+			continue;
+  801afd:	eb 34                	jmp    801b33 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801aff:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b02:	29 c6                	sub    %eax,%esi
+  801b04:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b07:	29 fa                	sub    %edi,%edx
+  801b09:	39 d6                	cmp    %edx,%esi
+  801b0b:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b0e:	83 ec 04             	sub    $0x4,%esp
+  801b11:	56                   	push   %esi
+  801b12:	89 fa                	mov    %edi,%edx
+  801b14:	03 55 08             	add    0x8(%ebp),%edx
+  801b17:	52                   	push   %edx
+  801b18:	03 43 0c             	add    0xc(%ebx),%eax
+  801b1b:	50                   	push   %eax
+  801b1c:	e8 d6 1e 00 00       	call   8039f7 <memmove>
+		f->f_wend += m;
+  801b21:	89 f0                	mov    %esi,%eax
+  801b23:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b26:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b29:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b31:	74 5b                	je     801b8e <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b33:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b36:	39 c7                	cmp    %eax,%edi
+  801b38:	73 2d                	jae    801b67 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b3a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	75 be                	jne    801aff <fwrite+0x8e>
+  801b41:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b44:	29 fa                	sub    %edi,%edx
+  801b46:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b49:	72 b4                	jb     801aff <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b4b:	83 ec 04             	sub    $0x4,%esp
+  801b4e:	52                   	push   %edx
+  801b4f:	89 f8                	mov    %edi,%eax
+  801b51:	03 45 08             	add    0x8(%ebp),%eax
+  801b54:	50                   	push   %eax
+  801b55:	ff 33                	push   (%ebx)
+  801b57:	e8 1d ef ff ff       	call   800a79 <write>
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	7f 98                	jg     801afb <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b63:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b67:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b6a:	83 f8 03             	cmp    $0x3,%eax
+  801b6d:	74 48                	je     801bb7 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b6f:	83 f8 02             	cmp    $0x2,%eax
+  801b72:	74 27                	je     801b9b <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	0f 84 10 ff ff ff    	je     801a8f <fwrite+0x1e>
+  801b7f:	89 f8                	mov    %edi,%eax
+  801b81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b86:	f7 75 0c             	divl   0xc(%ebp)
+  801b89:	e9 01 ff ff ff       	jmp    801a8f <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b8e:	89 d8                	mov    %ebx,%eax
+  801b90:	e8 ce f9 ff ff       	call   801563 <stream_drain>
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	79 9a                	jns    801b33 <fwrite+0xc2>
+  801b99:	eb cc                	jmp    801b67 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b9b:	83 ec 04             	sub    $0x4,%esp
+  801b9e:	57                   	push   %edi
+  801b9f:	6a 0a                	push   $0xa
+  801ba1:	ff 75 08             	push   0x8(%ebp)
+  801ba4:	e8 ff 1e 00 00       	call   803aa8 <memfind>
+  801ba9:	89 c2                	mov    %eax,%edx
+  801bab:	89 f8                	mov    %edi,%eax
+  801bad:	03 45 08             	add    0x8(%ebp),%eax
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	39 c2                	cmp    %eax,%edx
+  801bb5:	74 bd                	je     801b74 <fwrite+0x103>
+		stream_drain(f);
+  801bb7:	89 d8                	mov    %ebx,%eax
+  801bb9:	e8 a5 f9 ff ff       	call   801563 <stream_drain>
+  801bbe:	eb b4                	jmp    801b74 <fwrite+0x103>
+
+00801bc0 <fputc>:
+{
+  801bc0:	55                   	push   %ebp
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	53                   	push   %ebx
+  801bc4:	83 ec 14             	sub    $0x14,%esp
+  801bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bca:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bcd:	ff 75 0c             	push   0xc(%ebp)
+  801bd0:	6a 01                	push   $0x1
+  801bd2:	6a 01                	push   $0x1
+  801bd4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801bd7:	50                   	push   %eax
+  801bd8:	e8 94 fe ff ff       	call   801a71 <fwrite>
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	0f b6 db             	movzbl %bl,%ebx
+  801be3:	83 f8 01             	cmp    $0x1,%eax
+  801be6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801beb:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+00801bf3 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801bf9:	ff 75 0c             	push   0xc(%ebp)
+  801bfc:	ff 75 08             	push   0x8(%ebp)
+  801bff:	e8 bc ff ff ff       	call   801bc0 <fputc>
+}
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	c9                   	leave
+  801c08:	c3                   	ret
+
+00801c09 <fputs>:
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	56                   	push   %esi
+  801c0d:	53                   	push   %ebx
+  801c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c11:	83 ec 0c             	sub    $0xc,%esp
+  801c14:	56                   	push   %esi
+  801c15:	e8 1c 1c 00 00       	call   803836 <strlen>
+  801c1a:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c1c:	ff 75 0c             	push   0xc(%ebp)
+  801c1f:	50                   	push   %eax
+  801c20:	6a 01                	push   $0x1
+  801c22:	56                   	push   %esi
+  801c23:	e8 49 fe ff ff       	call   801a71 <fwrite>
+  801c28:	83 c4 20             	add    $0x20,%esp
+  801c2b:	39 d8                	cmp    %ebx,%eax
+  801c2d:	0f 95 c0             	setne  %al
+  801c30:	0f b6 c0             	movzbl %al,%eax
+  801c33:	f7 d8                	neg    %eax
+}
+  801c35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c38:	5b                   	pop    %ebx
+  801c39:	5e                   	pop    %esi
+  801c3a:	5d                   	pop    %ebp
+  801c3b:	c3                   	ret
+
+00801c3c <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	53                   	push   %ebx
+  801c40:	83 ec 04             	sub    $0x4,%esp
+  801c43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c46:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c49:	50                   	push   %eax
+  801c4a:	ff 75 0c             	push   0xc(%ebp)
+  801c4d:	53                   	push   %ebx
+  801c4e:	68 f3 1b 80 00       	push   $0x801bf3
+  801c53:	e8 2c 17 00 00       	call   803384 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c58:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c5b:	c1 e0 1c             	shl    $0x1c,%eax
+  801c5e:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c64:	c9                   	leave
+  801c65:	c3                   	ret
+
+00801c66 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c6c:	68 d0 47 80 00       	push   $0x8047d0
+  801c71:	ff 75 0c             	push   0xc(%ebp)
+  801c74:	e8 f8 1b 00 00       	call   803871 <strcpy>
+	return 0;
+}
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	c9                   	leave
+  801c7f:	c3                   	ret
+
+00801c80 <devsock_close>:
+{
+  801c80:	55                   	push   %ebp
+  801c81:	89 e5                	mov    %esp,%ebp
+  801c83:	53                   	push   %ebx
+  801c84:	83 ec 10             	sub    $0x10,%esp
+  801c87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c8a:	53                   	push   %ebx
+  801c8b:	e8 26 27 00 00       	call   8043b6 <pageref>
+  801c90:	89 c2                	mov    %eax,%edx
+  801c92:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c9a:	83 fa 01             	cmp    $0x1,%edx
+  801c9d:	74 05                	je     801ca4 <devsock_close+0x24>
+}
+  801c9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca2:	c9                   	leave
+  801ca3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ca4:	83 ec 0c             	sub    $0xc,%esp
+  801ca7:	ff 73 0c             	push   0xc(%ebx)
+  801caa:	e8 b7 02 00 00       	call   801f66 <nsipc_close>
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	eb eb                	jmp    801c9f <devsock_close+0x1f>
+
+00801cb4 <devsock_write>:
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cba:	6a 00                	push   $0x0
+  801cbc:	ff 75 10             	push   0x10(%ebp)
+  801cbf:	ff 75 0c             	push   0xc(%ebp)
+  801cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc5:	ff 70 0c             	push   0xc(%eax)
+  801cc8:	e8 79 03 00 00       	call   802046 <nsipc_send>
+}
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+
+00801ccf <devsock_read>:
+{
+  801ccf:	55                   	push   %ebp
+  801cd0:	89 e5                	mov    %esp,%ebp
+  801cd2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cd5:	6a 00                	push   $0x0
+  801cd7:	ff 75 10             	push   0x10(%ebp)
+  801cda:	ff 75 0c             	push   0xc(%ebp)
+  801cdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce0:	ff 70 0c             	push   0xc(%eax)
+  801ce3:	e8 ef 02 00 00       	call   801fd7 <nsipc_recv>
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <fd2sockid>:
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cf0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cf3:	52                   	push   %edx
+  801cf4:	50                   	push   %eax
+  801cf5:	e8 f7 e9 ff ff       	call   8006f1 <fd_lookup>
+  801cfa:	83 c4 10             	add    $0x10,%esp
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	78 10                	js     801d11 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d04:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d0a:	39 08                	cmp    %ecx,(%eax)
+  801d0c:	75 05                	jne    801d13 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d0e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d13:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d18:	eb f7                	jmp    801d11 <fd2sockid+0x27>
+
+00801d1a <alloc_sockfd>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	56                   	push   %esi
+  801d1e:	53                   	push   %ebx
+  801d1f:	83 ec 1c             	sub    $0x1c,%esp
+  801d22:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d27:	50                   	push   %eax
+  801d28:	e8 6e e9 ff ff       	call   80069b <fd_alloc>
+  801d2d:	89 c3                	mov    %eax,%ebx
+  801d2f:	83 c4 10             	add    $0x10,%esp
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 43                	js     801d79 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d36:	83 ec 04             	sub    $0x4,%esp
+  801d39:	68 07 04 00 00       	push   $0x407
+  801d3e:	ff 75 f4             	push   -0xc(%ebp)
+  801d41:	6a 00                	push   $0x0
+  801d43:	e8 8a e4 ff ff       	call   8001d2 <sys_page_alloc>
+  801d48:	89 c3                	mov    %eax,%ebx
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 28                	js     801d79 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d54:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d5a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d66:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d69:	83 ec 0c             	sub    $0xc,%esp
+  801d6c:	50                   	push   %eax
+  801d6d:	e8 02 e9 ff ff       	call   800674 <fd2num>
+  801d72:	89 c3                	mov    %eax,%ebx
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	eb 0c                	jmp    801d85 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d79:	83 ec 0c             	sub    $0xc,%esp
+  801d7c:	56                   	push   %esi
+  801d7d:	e8 e4 01 00 00       	call   801f66 <nsipc_close>
+		return r;
+  801d82:	83 c4 10             	add    $0x10,%esp
+}
+  801d85:	89 d8                	mov    %ebx,%eax
+  801d87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8a:	5b                   	pop    %ebx
+  801d8b:	5e                   	pop    %esi
+  801d8c:	5d                   	pop    %ebp
+  801d8d:	c3                   	ret
+
+00801d8e <accept>:
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d97:	e8 4e ff ff ff       	call   801cea <fd2sockid>
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 1b                	js     801dbb <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801da0:	83 ec 04             	sub    $0x4,%esp
+  801da3:	ff 75 10             	push   0x10(%ebp)
+  801da6:	ff 75 0c             	push   0xc(%ebp)
+  801da9:	50                   	push   %eax
+  801daa:	e8 0e 01 00 00       	call   801ebd <nsipc_accept>
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	85 c0                	test   %eax,%eax
+  801db4:	78 05                	js     801dbb <accept+0x2d>
+	return alloc_sockfd(r);
+  801db6:	e8 5f ff ff ff       	call   801d1a <alloc_sockfd>
+}
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <bind>:
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc6:	e8 1f ff ff ff       	call   801cea <fd2sockid>
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 12                	js     801de1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dcf:	83 ec 04             	sub    $0x4,%esp
+  801dd2:	ff 75 10             	push   0x10(%ebp)
+  801dd5:	ff 75 0c             	push   0xc(%ebp)
+  801dd8:	50                   	push   %eax
+  801dd9:	e8 31 01 00 00       	call   801f0f <nsipc_bind>
+  801dde:	83 c4 10             	add    $0x10,%esp
+}
+  801de1:	c9                   	leave
+  801de2:	c3                   	ret
+
+00801de3 <shutdown>:
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dec:	e8 f9 fe ff ff       	call   801cea <fd2sockid>
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 0f                	js     801e04 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801df5:	83 ec 08             	sub    $0x8,%esp
+  801df8:	ff 75 0c             	push   0xc(%ebp)
+  801dfb:	50                   	push   %eax
+  801dfc:	e8 43 01 00 00       	call   801f44 <nsipc_shutdown>
+  801e01:	83 c4 10             	add    $0x10,%esp
+}
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+00801e06 <connect>:
+{
+  801e06:	55                   	push   %ebp
+  801e07:	89 e5                	mov    %esp,%ebp
+  801e09:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0f:	e8 d6 fe ff ff       	call   801cea <fd2sockid>
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	78 12                	js     801e2a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e18:	83 ec 04             	sub    $0x4,%esp
+  801e1b:	ff 75 10             	push   0x10(%ebp)
+  801e1e:	ff 75 0c             	push   0xc(%ebp)
+  801e21:	50                   	push   %eax
+  801e22:	e8 59 01 00 00       	call   801f80 <nsipc_connect>
+  801e27:	83 c4 10             	add    $0x10,%esp
+}
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+
+00801e2c <listen>:
+{
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e35:	e8 b0 fe ff ff       	call   801cea <fd2sockid>
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 0f                	js     801e4d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e3e:	83 ec 08             	sub    $0x8,%esp
+  801e41:	ff 75 0c             	push   0xc(%ebp)
+  801e44:	50                   	push   %eax
+  801e45:	e8 6b 01 00 00       	call   801fb5 <nsipc_listen>
+  801e4a:	83 c4 10             	add    $0x10,%esp
+}
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+00801e4f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e55:	ff 75 10             	push   0x10(%ebp)
+  801e58:	ff 75 0c             	push   0xc(%ebp)
+  801e5b:	ff 75 08             	push   0x8(%ebp)
+  801e5e:	e8 41 02 00 00       	call   8020a4 <nsipc_socket>
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 05                	js     801e6f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e6a:	e8 ab fe ff ff       	call   801d1a <alloc_sockfd>
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+00801e71 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	53                   	push   %ebx
+  801e75:	83 ec 04             	sub    $0x4,%esp
+  801e78:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e7a:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e81:	74 26                	je     801ea9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e83:	6a 07                	push   $0x7
+  801e85:	68 00 80 80 00       	push   $0x808000
+  801e8a:	53                   	push   %ebx
+  801e8b:	ff 35 08 60 80 00    	push   0x806008
+  801e91:	e8 8b 24 00 00       	call   804321 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e96:	83 c4 0c             	add    $0xc,%esp
+  801e99:	6a 00                	push   $0x0
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	6a 00                	push   $0x0
+  801e9f:	e8 87 23 00 00       	call   80422b <ipc_recv>
+}
+  801ea4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ea9:	83 ec 0c             	sub    $0xc,%esp
+  801eac:	6a 02                	push   $0x2
+  801eae:	e8 c4 24 00 00       	call   804377 <ipc_find_env>
+  801eb3:	a3 08 60 80 00       	mov    %eax,0x806008
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	eb c6                	jmp    801e83 <nsipc+0x12>
+
+00801ebd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	56                   	push   %esi
+  801ec1:	53                   	push   %ebx
+  801ec2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ecd:	8b 06                	mov    (%esi),%eax
+  801ecf:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ed4:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ed9:	e8 93 ff ff ff       	call   801e71 <nsipc>
+  801ede:	89 c3                	mov    %eax,%ebx
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	79 09                	jns    801eed <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ee4:	89 d8                	mov    %ebx,%eax
+  801ee6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee9:	5b                   	pop    %ebx
+  801eea:	5e                   	pop    %esi
+  801eeb:	5d                   	pop    %ebp
+  801eec:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801eed:	83 ec 04             	sub    $0x4,%esp
+  801ef0:	ff 35 10 80 80 00    	push   0x808010
+  801ef6:	68 00 80 80 00       	push   $0x808000
+  801efb:	ff 75 0c             	push   0xc(%ebp)
+  801efe:	e8 f4 1a 00 00       	call   8039f7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f03:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f08:	89 06                	mov    %eax,(%esi)
+  801f0a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f0d:	eb d5                	jmp    801ee4 <nsipc_accept+0x27>
+
+00801f0f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	53                   	push   %ebx
+  801f13:	83 ec 08             	sub    $0x8,%esp
+  801f16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f21:	53                   	push   %ebx
+  801f22:	ff 75 0c             	push   0xc(%ebp)
+  801f25:	68 04 80 80 00       	push   $0x808004
+  801f2a:	e8 c8 1a 00 00       	call   8039f7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f2f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f35:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f3a:	e8 32 ff ff ff       	call   801e71 <nsipc>
+}
+  801f3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f42:	c9                   	leave
+  801f43:	c3                   	ret
+
+00801f44 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f44:	55                   	push   %ebp
+  801f45:	89 e5                	mov    %esp,%ebp
+  801f47:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f55:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f5a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f5f:	e8 0d ff ff ff       	call   801e71 <nsipc>
+}
+  801f64:	c9                   	leave
+  801f65:	c3                   	ret
+
+00801f66 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f74:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f79:	e8 f3 fe ff ff       	call   801e71 <nsipc>
+}
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+
+00801f80 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	53                   	push   %ebx
+  801f84:	83 ec 08             	sub    $0x8,%esp
+  801f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f92:	53                   	push   %ebx
+  801f93:	ff 75 0c             	push   0xc(%ebp)
+  801f96:	68 04 80 80 00       	push   $0x808004
+  801f9b:	e8 57 1a 00 00       	call   8039f7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fa0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fa6:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fab:	e8 c1 fe ff ff       	call   801e71 <nsipc>
+}
+  801fb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb3:	c9                   	leave
+  801fb4:	c3                   	ret
+
+00801fb5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbe:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fc3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fcb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd0:	e8 9c fe ff ff       	call   801e71 <nsipc>
+}
+  801fd5:	c9                   	leave
+  801fd6:	c3                   	ret
+
+00801fd7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fd7:	55                   	push   %ebp
+  801fd8:	89 e5                	mov    %esp,%ebp
+  801fda:	56                   	push   %esi
+  801fdb:	53                   	push   %ebx
+  801fdc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fe7:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fed:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff0:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801ff5:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ffa:	e8 72 fe ff ff       	call   801e71 <nsipc>
+  801fff:	89 c3                	mov    %eax,%ebx
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 22                	js     802027 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802005:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80200a:	39 c6                	cmp    %eax,%esi
+  80200c:	0f 4e c6             	cmovle %esi,%eax
+  80200f:	39 c3                	cmp    %eax,%ebx
+  802011:	7f 1d                	jg     802030 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802013:	83 ec 04             	sub    $0x4,%esp
+  802016:	53                   	push   %ebx
+  802017:	68 00 80 80 00       	push   $0x808000
+  80201c:	ff 75 0c             	push   0xc(%ebp)
+  80201f:	e8 d3 19 00 00       	call   8039f7 <memmove>
+  802024:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802027:	89 d8                	mov    %ebx,%eax
+  802029:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202c:	5b                   	pop    %ebx
+  80202d:	5e                   	pop    %esi
+  80202e:	5d                   	pop    %ebp
+  80202f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802030:	68 dc 47 80 00       	push   $0x8047dc
+  802035:	68 95 47 80 00       	push   $0x804795
+  80203a:	6a 62                	push   $0x62
+  80203c:	68 f1 47 80 00       	push   $0x8047f1
+  802041:	e8 6c 11 00 00       	call   8031b2 <_panic>
+
+00802046 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	53                   	push   %ebx
+  80204a:	83 ec 04             	sub    $0x4,%esp
+  80204d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802050:	8b 45 08             	mov    0x8(%ebp),%eax
+  802053:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802058:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80205e:	7f 2e                	jg     80208e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802060:	83 ec 04             	sub    $0x4,%esp
+  802063:	53                   	push   %ebx
+  802064:	ff 75 0c             	push   0xc(%ebp)
+  802067:	68 0c 80 80 00       	push   $0x80800c
+  80206c:	e8 86 19 00 00       	call   8039f7 <memmove>
+	nsipcbuf.send.req_size = size;
+  802071:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802077:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80207f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802084:	e8 e8 fd ff ff       	call   801e71 <nsipc>
+}
+  802089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208c:	c9                   	leave
+  80208d:	c3                   	ret
+	assert(size < 1600);
+  80208e:	68 fd 47 80 00       	push   $0x8047fd
+  802093:	68 95 47 80 00       	push   $0x804795
+  802098:	6a 6d                	push   $0x6d
+  80209a:	68 f1 47 80 00       	push   $0x8047f1
+  80209f:	e8 0e 11 00 00       	call   8031b2 <_panic>
+
+008020a4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ad:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020ba:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020bd:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020c2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020c7:	e8 a5 fd ff ff       	call   801e71 <nsipc>
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+008020ce <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	53                   	push   %ebx
+  8020d2:	83 ec 10             	sub    $0x10,%esp
+  8020d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020d8:	68 0c 60 80 00       	push   $0x80600c
+  8020dd:	e8 50 07 00 00       	call   802832 <mutex_lock>
+	if (v == 0)
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 db                	test   %ebx,%ebx
+  8020e7:	0f 84 85 00 00 00    	je     802172 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8020ed:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8020f3:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8020f8:	77 51                	ja     80214b <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8020fa:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802100:	89 d8                	mov    %ebx,%eax
+  802102:	c1 e8 0c             	shr    $0xc,%eax
+  802105:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80210c:	f6 c4 02             	test   $0x2,%ah
+  80210f:	74 50                	je     802161 <free+0x93>
+		sys_page_unmap(0, c);
+  802111:	83 ec 08             	sub    $0x8,%esp
+  802114:	53                   	push   %ebx
+  802115:	6a 00                	push   $0x0
+  802117:	e8 4f e1 ff ff       	call   80026b <sys_page_unmap>
+		c += PGSIZE;
+  80211c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802122:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802130:	76 ce                	jbe    802100 <free+0x32>
+  802132:	68 47 48 80 00       	push   $0x804847
+  802137:	68 95 47 80 00       	push   $0x804795
+  80213c:	68 82 00 00 00       	push   $0x82
+  802141:	68 3a 48 80 00       	push   $0x80483a
+  802146:	e8 67 10 00 00       	call   8031b2 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80214b:	68 0c 48 80 00       	push   $0x80480c
+  802150:	68 95 47 80 00       	push   $0x804795
+  802155:	6a 7b                	push   $0x7b
+  802157:	68 3a 48 80 00       	push   $0x80483a
+  80215c:	e8 51 10 00 00       	call   8031b2 <_panic>
+	if (--(*ref) == 0)
+  802161:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802167:	83 e8 01             	sub    $0x1,%eax
+  80216a:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802170:	74 15                	je     802187 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802172:	83 ec 0c             	sub    $0xc,%esp
+  802175:	68 0c 60 80 00       	push   $0x80600c
+  80217a:	e8 20 07 00 00       	call   80289f <mutex_unlock>
+}
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802185:	c9                   	leave
+  802186:	c3                   	ret
+		sys_page_unmap(0, c);
+  802187:	83 ec 08             	sub    $0x8,%esp
+  80218a:	53                   	push   %ebx
+  80218b:	6a 00                	push   $0x0
+  80218d:	e8 d9 e0 ff ff       	call   80026b <sys_page_unmap>
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	eb db                	jmp    802172 <free+0xa4>
+
+00802197 <malloc>:
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	57                   	push   %edi
+  80219b:	56                   	push   %esi
+  80219c:	53                   	push   %ebx
+  80219d:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021a0:	68 0c 60 80 00       	push   $0x80600c
+  8021a5:	e8 88 06 00 00       	call   802832 <mutex_lock>
+	if (mptr == 0)
+  8021aa:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021b0:	83 c4 10             	add    $0x10,%esp
+  8021b3:	85 ff                	test   %edi,%edi
+  8021b5:	74 6c                	je     802223 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ba:	83 c0 03             	add    $0x3,%eax
+  8021bd:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021c0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021c2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021c7:	0f 87 64 01 00 00    	ja     802331 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021cd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021d3:	74 30                	je     802205 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021d5:	89 f9                	mov    %edi,%ecx
+  8021d7:	c1 e9 0c             	shr    $0xc,%ecx
+  8021da:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021de:	c1 e8 0c             	shr    $0xc,%eax
+  8021e1:	39 c1                	cmp    %eax,%ecx
+  8021e3:	74 5f                	je     802244 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021e5:	83 ec 0c             	sub    $0xc,%esp
+  8021e8:	57                   	push   %edi
+  8021e9:	e8 e0 fe ff ff       	call   8020ce <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8021ee:	a1 10 60 80 00       	mov    0x806010,%eax
+  8021f3:	05 00 10 00 00       	add    $0x1000,%eax
+  8021f8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021fd:	a3 10 60 80 00       	mov    %eax,0x806010
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  80220b:	ba 02 00 00 00       	mov    $0x2,%edx
+  802210:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802214:	8d 7e 04             	lea    0x4(%esi),%edi
+  802217:	89 cb                	mov    %ecx,%ebx
+  802219:	01 f9                	add    %edi,%ecx
+  80221b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80221e:	e9 8b 00 00 00       	jmp    8022ae <malloc+0x117>
+		mptr = mbegin;
+  802223:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80222a:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80222d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802230:	83 c0 03             	add    $0x3,%eax
+  802233:	83 e0 fc             	and    $0xfffffffc,%eax
+  802236:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802238:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80223d:	76 c6                	jbe    802205 <malloc+0x6e>
+  80223f:	e9 d6 00 00 00       	jmp    80231a <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802244:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80224a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80224f:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802253:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802256:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80225b:	e9 ba 00 00 00       	jmp    80231a <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802260:	05 00 10 00 00       	add    $0x1000,%eax
+  802265:	39 c8                	cmp    %ecx,%eax
+  802267:	0f 83 cb 00 00 00    	jae    802338 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80226d:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802272:	77 22                	ja     802296 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802274:	89 c2                	mov    %eax,%edx
+  802276:	c1 ea 16             	shr    $0x16,%edx
+  802279:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802280:	f6 c2 01             	test   $0x1,%dl
+  802283:	74 db                	je     802260 <malloc+0xc9>
+  802285:	89 c2                	mov    %eax,%edx
+  802287:	c1 ea 0c             	shr    $0xc,%edx
+  80228a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802291:	f6 c2 01             	test   $0x1,%dl
+  802294:	74 ca                	je     802260 <malloc+0xc9>
+		if (mptr == mend) {
+  802296:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80229c:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022a2:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022a6:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022ac:	74 04                	je     8022b2 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022ae:	89 d8                	mov    %ebx,%eax
+  8022b0:	eb b3                	jmp    802265 <malloc+0xce>
+  8022b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022b5:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022ba:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022be:	83 ea 01             	sub    $0x1,%edx
+  8022c1:	0f 85 50 ff ff ff    	jne    802217 <malloc+0x80>
+  8022c7:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022ce:	00 00 08 
+				return 0;	/* out of address space */
+  8022d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d6:	eb 42                	jmp    80231a <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022d8:	85 db                	test   %ebx,%ebx
+  8022da:	78 1e                	js     8022fa <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022dc:	83 ec 08             	sub    $0x8,%esp
+  8022df:	89 d8                	mov    %ebx,%eax
+  8022e1:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022e7:	50                   	push   %eax
+  8022e8:	6a 00                	push   $0x0
+  8022ea:	e8 7c df ff ff       	call   80026b <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8022ef:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	eb de                	jmp    8022d8 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8022fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ff:	eb 19                	jmp    80231a <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802301:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802304:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80230a:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802311:	00 
+	mptr += n;
+  802312:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802315:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	68 0c 60 80 00       	push   $0x80600c
+  802322:	e8 78 05 00 00       	call   80289f <mutex_unlock>
+}
+  802327:	89 f8                	mov    %edi,%eax
+  802329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5f                   	pop    %edi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+		return 0;
+  802331:	bf 00 00 00 00       	mov    $0x0,%edi
+  802336:	eb e2                	jmp    80231a <malloc+0x183>
+  802338:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80233c:	74 06                	je     802344 <malloc+0x1ad>
+  80233e:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802349:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80234c:	39 fb                	cmp    %edi,%ebx
+  80234e:	73 b1                	jae    802301 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802350:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802356:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802359:	39 fe                	cmp    %edi,%esi
+  80235b:	0f 92 c0             	setb   %al
+  80235e:	0f b6 c0             	movzbl %al,%eax
+  802361:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802364:	83 c8 07             	or     $0x7,%eax
+  802367:	50                   	push   %eax
+  802368:	89 d8                	mov    %ebx,%eax
+  80236a:	03 05 10 60 80 00    	add    0x806010,%eax
+  802370:	50                   	push   %eax
+  802371:	6a 00                	push   $0x0
+  802373:	e8 5a de ff ff       	call   8001d2 <sys_page_alloc>
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	0f 88 55 ff ff ff    	js     8022d8 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802383:	89 f3                	mov    %esi,%ebx
+  802385:	eb c5                	jmp    80234c <malloc+0x1b5>
+
+00802387 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	56                   	push   %esi
+  80238b:	53                   	push   %ebx
+  80238c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80238f:	83 ec 0c             	sub    $0xc,%esp
+  802392:	ff 75 08             	push   0x8(%ebp)
+  802395:	e8 ea e2 ff ff       	call   800684 <fd2data>
+  80239a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80239c:	83 c4 08             	add    $0x8,%esp
+  80239f:	68 5f 48 80 00       	push   $0x80485f
+  8023a4:	53                   	push   %ebx
+  8023a5:	e8 c7 14 00 00       	call   803871 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023aa:	8b 46 04             	mov    0x4(%esi),%eax
+  8023ad:	2b 06                	sub    (%esi),%eax
+  8023af:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023b5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023bc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023bf:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023c6:	52 80 00 
+	return 0;
+}
+  8023c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d1:	5b                   	pop    %ebx
+  8023d2:	5e                   	pop    %esi
+  8023d3:	5d                   	pop    %ebp
+  8023d4:	c3                   	ret
+
+008023d5 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023da:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023de:	85 c9                	test   %ecx,%ecx
+  8023e0:	75 01                	jne    8023e3 <pipewake+0xe>
+  8023e2:	c3                   	ret
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023e9:	68 00 04 00 00       	push   $0x400
+  8023ee:	52                   	push   %edx
+  8023ef:	e8 22 e1 ff ff       	call   800516 <sys_futex_wake>
+  8023f4:	83 c4 10             	add    $0x10,%esp
+}
+  8023f7:	c9                   	leave
+  8023f8:	c3                   	ret
+
+008023f9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	56                   	push   %esi
+  8023fd:	53                   	push   %ebx
+  8023fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802401:	83 ec 0c             	sub    $0xc,%esp
+  802404:	56                   	push   %esi
+  802405:	e8 7a e2 ff ff       	call   800684 <fd2data>
+  80240a:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80240c:	83 c4 08             	add    $0x8,%esp
+  80240f:	56                   	push   %esi
+  802410:	6a 00                	push   $0x0
+  802412:	e8 54 de ff ff       	call   80026b <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802417:	8d 53 04             	lea    0x4(%ebx),%edx
+  80241a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80241d:	e8 b3 ff ff ff       	call   8023d5 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802422:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802425:	89 da                	mov    %ebx,%edx
+  802427:	e8 a9 ff ff ff       	call   8023d5 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80242c:	89 34 24             	mov    %esi,(%esp)
+  80242f:	e8 50 e2 ff ff       	call   800684 <fd2data>
+  802434:	83 c4 08             	add    $0x8,%esp
+  802437:	50                   	push   %eax
+  802438:	6a 00                	push   $0x0
+  80243a:	e8 2c de ff ff       	call   80026b <sys_page_unmap>
+}
+  80243f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+
+00802446 <_pipeisclosed>:
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	57                   	push   %edi
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 1c             	sub    $0x1c,%esp
+  80244f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802452:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802454:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802459:	eb 5d                	jmp    8024b8 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80245b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802461:	8b 02                	mov    (%edx),%eax
+  802463:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802466:	83 ec 0c             	sub    $0xc,%esp
+  802469:	ff 75 e0             	push   -0x20(%ebp)
+  80246c:	e8 45 1f 00 00       	call   8043b6 <pageref>
+  802471:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802474:	89 3c 24             	mov    %edi,(%esp)
+  802477:	e8 3a 1f 00 00       	call   8043b6 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80247c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80247e:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80248d:	77 15                	ja     8024a4 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80248f:	89 f2                	mov    %esi,%edx
+  802491:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802493:	c1 ea 10             	shr    $0x10,%edx
+  802496:	74 0c                	je     8024a4 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802498:	c1 e2 10             	shl    $0x10,%edx
+  80249b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024a0:	29 d1                	sub    %edx,%ecx
+  8024a2:	eb 06                	jmp    8024aa <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024a4:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024aa:	8b 11                	mov    (%ecx),%edx
+  8024ac:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024af:	39 d3                	cmp    %edx,%ebx
+  8024b1:	74 6e                	je     802521 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024b3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024b6:	74 24                	je     8024dc <_pipeisclosed+0x96>
+  8024b8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024ba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024c0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024c5:	77 94                	ja     80245b <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024c7:	89 f0                	mov    %esi,%eax
+  8024c9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024cb:	c1 e8 10             	shr    $0x10,%eax
+  8024ce:	74 8b                	je     80245b <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024d0:	c1 e0 10             	shl    $0x10,%eax
+  8024d3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024d8:	29 c2                	sub    %eax,%edx
+  8024da:	eb 85                	jmp    802461 <_pipeisclosed+0x1b>
+  8024dc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024de:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024e4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024e9:	77 18                	ja     802503 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024eb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8024f0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024f2:	c1 e8 10             	shr    $0x10,%eax
+  8024f5:	74 0c                	je     802503 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024f7:	c1 e0 10             	shl    $0x10,%eax
+  8024fa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024ff:	29 c2                	sub    %eax,%edx
+  802501:	eb 06                	jmp    802509 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802503:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802509:	8b 02                	mov    (%edx),%eax
+  80250b:	8b 40 58             	mov    0x58(%eax),%eax
+  80250e:	6a 01                	push   $0x1
+  802510:	50                   	push   %eax
+  802511:	53                   	push   %ebx
+  802512:	68 66 48 80 00       	push   $0x804866
+  802517:	e8 71 0d 00 00       	call   80328d <cprintf>
+  80251c:	83 c4 10             	add    $0x10,%esp
+  80251f:	eb 97                	jmp    8024b8 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802521:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802524:	0f 94 c0             	sete   %al
+  802527:	0f b6 c0             	movzbl %al,%eax
+}
+  80252a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80252d:	5b                   	pop    %ebx
+  80252e:	5e                   	pop    %esi
+  80252f:	5f                   	pop    %edi
+  802530:	5d                   	pop    %ebp
+  802531:	c3                   	ret
+
+00802532 <devpipe_write>:
+{
+  802532:	55                   	push   %ebp
+  802533:	89 e5                	mov    %esp,%ebp
+  802535:	57                   	push   %edi
+  802536:	56                   	push   %esi
+  802537:	53                   	push   %ebx
+  802538:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80253b:	ff 75 08             	push   0x8(%ebp)
+  80253e:	e8 41 e1 ff ff       	call   800684 <fd2data>
+  802543:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802545:	83 c4 10             	add    $0x10,%esp
+  802548:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80254f:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802552:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802555:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802558:	0f 84 96 00 00 00    	je     8025f4 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80255e:	8d 73 08             	lea    0x8(%ebx),%esi
+  802561:	eb 32                	jmp    802595 <devpipe_write+0x63>
+  802563:	89 fa                	mov    %edi,%edx
+  802565:	89 f0                	mov    %esi,%eax
+  802567:	e8 69 fe ff ff       	call   8023d5 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80256c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80256f:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802572:	ba 01 00 00 00       	mov    $0x1,%edx
+  802577:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80257c:	83 ec 04             	sub    $0x4,%esp
+  80257f:	6a 0a                	push   $0xa
+  802581:	50                   	push   %eax
+  802582:	53                   	push   %ebx
+  802583:	e8 5f df ff ff       	call   8004e7 <sys_futex_wait>
+  802588:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80258d:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802592:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802595:	8b 43 04             	mov    0x4(%ebx),%eax
+  802598:	8b 0b                	mov    (%ebx),%ecx
+  80259a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80259d:	39 d0                	cmp    %edx,%eax
+  80259f:	72 1b                	jb     8025bc <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025a1:	89 da                	mov    %ebx,%edx
+  8025a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a6:	e8 9b fe ff ff       	call   802446 <_pipeisclosed>
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	74 b4                	je     802563 <devpipe_write+0x31>
+				return 0;
+  8025af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b7:	5b                   	pop    %ebx
+  8025b8:	5e                   	pop    %esi
+  8025b9:	5f                   	pop    %edi
+  8025ba:	5d                   	pop    %ebp
+  8025bb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025bf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025c2:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025c6:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025c9:	89 c2                	mov    %eax,%edx
+  8025cb:	c1 fa 1f             	sar    $0x1f,%edx
+  8025ce:	89 d1                	mov    %edx,%ecx
+  8025d0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025d3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025d6:	83 e2 1f             	and    $0x1f,%edx
+  8025d9:	29 ca                	sub    %ecx,%edx
+  8025db:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025df:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025e3:	83 c0 01             	add    $0x1,%eax
+  8025e6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025e9:	83 c6 01             	add    $0x1,%esi
+  8025ec:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8025ef:	e9 5e ff ff ff       	jmp    802552 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8025f4:	8d 53 04             	lea    0x4(%ebx),%edx
+  8025f7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025fa:	e8 d6 fd ff ff       	call   8023d5 <pipewake>
+	return i;
+  8025ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802602:	eb b0                	jmp    8025b4 <devpipe_write+0x82>
+
+00802604 <devpipe_read>:
+{
+  802604:	55                   	push   %ebp
+  802605:	89 e5                	mov    %esp,%ebp
+  802607:	57                   	push   %edi
+  802608:	56                   	push   %esi
+  802609:	53                   	push   %ebx
+  80260a:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80260d:	ff 75 08             	push   0x8(%ebp)
+  802610:	e8 6f e0 ff ff       	call   800684 <fd2data>
+  802615:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802617:	83 c4 10             	add    $0x10,%esp
+  80261a:	be 00 00 00 00       	mov    $0x0,%esi
+  80261f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802622:	74 6c                	je     802690 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802624:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802627:	eb 25                	jmp    80264e <devpipe_read+0x4a>
+  802629:	8b 13                	mov    (%ebx),%edx
+  80262b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802630:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802635:	83 ec 04             	sub    $0x4,%esp
+  802638:	6a 0a                	push   $0xa
+  80263a:	52                   	push   %edx
+  80263b:	57                   	push   %edi
+  80263c:	e8 a6 de ff ff       	call   8004e7 <sys_futex_wait>
+  802641:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802646:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80264b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80264e:	8b 03                	mov    (%ebx),%eax
+  802650:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802653:	75 19                	jne    80266e <devpipe_read+0x6a>
+			if (i > 0)
+  802655:	85 f6                	test   %esi,%esi
+  802657:	75 3a                	jne    802693 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  802659:	89 da                	mov    %ebx,%edx
+  80265b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265e:	e8 e3 fd ff ff       	call   802446 <_pipeisclosed>
+  802663:	85 c0                	test   %eax,%eax
+  802665:	74 c2                	je     802629 <devpipe_read+0x25>
+				return 0;
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266c:	eb 31                	jmp    80269f <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80266e:	89 c1                	mov    %eax,%ecx
+  802670:	c1 f9 1f             	sar    $0x1f,%ecx
+  802673:	c1 e9 1b             	shr    $0x1b,%ecx
+  802676:	01 c8                	add    %ecx,%eax
+  802678:	83 e0 1f             	and    $0x1f,%eax
+  80267b:	29 c8                	sub    %ecx,%eax
+  80267d:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802682:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802685:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802688:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80268b:	83 c6 01             	add    $0x1,%esi
+  80268e:	eb 8f                	jmp    80261f <devpipe_read+0x1b>
+out:
+  802690:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802693:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802696:	89 da                	mov    %ebx,%edx
+  802698:	e8 38 fd ff ff       	call   8023d5 <pipewake>
+	return i;
+  80269d:	89 f0                	mov    %esi,%eax
+}
+  80269f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a2:	5b                   	pop    %ebx
+  8026a3:	5e                   	pop    %esi
+  8026a4:	5f                   	pop    %edi
+  8026a5:	5d                   	pop    %ebp
+  8026a6:	c3                   	ret
+
+008026a7 <pipe>:
+{
+  8026a7:	55                   	push   %ebp
+  8026a8:	89 e5                	mov    %esp,%ebp
+  8026aa:	56                   	push   %esi
+  8026ab:	53                   	push   %ebx
+  8026ac:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b2:	50                   	push   %eax
+  8026b3:	e8 e3 df ff ff       	call   80069b <fd_alloc>
+  8026b8:	89 c3                	mov    %eax,%ebx
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	0f 88 23 01 00 00    	js     8027e8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c5:	83 ec 04             	sub    $0x4,%esp
+  8026c8:	68 07 04 00 00       	push   $0x407
+  8026cd:	ff 75 f4             	push   -0xc(%ebp)
+  8026d0:	6a 00                	push   $0x0
+  8026d2:	e8 fb da ff ff       	call   8001d2 <sys_page_alloc>
+  8026d7:	89 c3                	mov    %eax,%ebx
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	0f 88 04 01 00 00    	js     8027e8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e4:	83 ec 0c             	sub    $0xc,%esp
+  8026e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ea:	50                   	push   %eax
+  8026eb:	e8 ab df ff ff       	call   80069b <fd_alloc>
+  8026f0:	89 c3                	mov    %eax,%ebx
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	0f 88 db 00 00 00    	js     8027d8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	68 07 04 00 00       	push   $0x407
+  802705:	ff 75 f0             	push   -0x10(%ebp)
+  802708:	6a 00                	push   $0x0
+  80270a:	e8 c3 da ff ff       	call   8001d2 <sys_page_alloc>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	85 c0                	test   %eax,%eax
+  802716:	0f 88 bc 00 00 00    	js     8027d8 <pipe+0x131>
+	va = fd2data(fd0);
+  80271c:	83 ec 0c             	sub    $0xc,%esp
+  80271f:	ff 75 f4             	push   -0xc(%ebp)
+  802722:	e8 5d df ff ff       	call   800684 <fd2data>
+  802727:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802729:	83 c4 0c             	add    $0xc,%esp
+  80272c:	68 07 04 00 00       	push   $0x407
+  802731:	50                   	push   %eax
+  802732:	6a 00                	push   $0x0
+  802734:	e8 99 da ff ff       	call   8001d2 <sys_page_alloc>
+  802739:	89 c3                	mov    %eax,%ebx
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	0f 88 82 00 00 00    	js     8027c8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802746:	83 ec 0c             	sub    $0xc,%esp
+  802749:	ff 75 f0             	push   -0x10(%ebp)
+  80274c:	e8 33 df ff ff       	call   800684 <fd2data>
+  802751:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802758:	50                   	push   %eax
+  802759:	6a 00                	push   $0x0
+  80275b:	56                   	push   %esi
+  80275c:	6a 00                	push   $0x0
+  80275e:	e8 bc da ff ff       	call   80021f <sys_page_map>
+  802763:	89 c3                	mov    %eax,%ebx
+  802765:	83 c4 20             	add    $0x20,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 4e                	js     8027ba <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80276c:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802771:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802774:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802776:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802779:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802780:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802783:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802785:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802788:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80278f:	83 ec 0c             	sub    $0xc,%esp
+  802792:	ff 75 f4             	push   -0xc(%ebp)
+  802795:	e8 da de ff ff       	call   800674 <fd2num>
+  80279a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80279f:	83 c4 04             	add    $0x4,%esp
+  8027a2:	ff 75 f0             	push   -0x10(%ebp)
+  8027a5:	e8 ca de ff ff       	call   800674 <fd2num>
+  8027aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027ad:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b0:	83 c4 10             	add    $0x10,%esp
+  8027b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b8:	eb 2e                	jmp    8027e8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ba:	83 ec 08             	sub    $0x8,%esp
+  8027bd:	56                   	push   %esi
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 a6 da ff ff       	call   80026b <sys_page_unmap>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027c8:	83 ec 08             	sub    $0x8,%esp
+  8027cb:	ff 75 f0             	push   -0x10(%ebp)
+  8027ce:	6a 00                	push   $0x0
+  8027d0:	e8 96 da ff ff       	call   80026b <sys_page_unmap>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027d8:	83 ec 08             	sub    $0x8,%esp
+  8027db:	ff 75 f4             	push   -0xc(%ebp)
+  8027de:	6a 00                	push   $0x0
+  8027e0:	e8 86 da ff ff       	call   80026b <sys_page_unmap>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+}
+  8027e8:	89 d8                	mov    %ebx,%eax
+  8027ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ed:	5b                   	pop    %ebx
+  8027ee:	5e                   	pop    %esi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+
+008027f1 <pipeisclosed>:
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	ff 75 08             	push   0x8(%ebp)
+  8027fe:	e8 ee de ff ff       	call   8006f1 <fd_lookup>
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	85 c0                	test   %eax,%eax
+  802808:	78 18                	js     802822 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280a:	83 ec 0c             	sub    $0xc,%esp
+  80280d:	ff 75 f4             	push   -0xc(%ebp)
+  802810:	e8 6f de ff ff       	call   800684 <fd2data>
+  802815:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281a:	e8 27 fc ff ff       	call   802446 <_pipeisclosed>
+  80281f:	83 c4 10             	add    $0x10,%esp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+00802824 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802824:	55                   	push   %ebp
+  802825:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802827:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802830:	5d                   	pop    %ebp
+  802831:	c3                   	ret
+
+00802832 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802832:	55                   	push   %ebp
+  802833:	89 e5                	mov    %esp,%ebp
+  802835:	56                   	push   %esi
+  802836:	53                   	push   %ebx
+  802837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80283a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802844:	89 d0                	mov    %edx,%eax
+  802846:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	74 2d                	je     80287b <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80284e:	83 f8 02             	cmp    $0x2,%eax
+  802851:	74 08                	je     80285b <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802853:	b8 02 00 00 00       	mov    $0x2,%eax
+  802858:	f0 87 03             	lock xchg %eax,(%ebx)
+  80285b:	be 02 00 00 00       	mov    $0x2,%esi
+  802860:	eb 15                	jmp    802877 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802862:	83 ec 04             	sub    $0x4,%esp
+  802865:	6a 00                	push   $0x0
+  802867:	6a 02                	push   $0x2
+  802869:	53                   	push   %ebx
+  80286a:	e8 78 dc ff ff       	call   8004e7 <sys_futex_wait>
+  80286f:	89 f0                	mov    %esi,%eax
+  802871:	f0 87 03             	lock xchg %eax,(%ebx)
+  802874:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802877:	85 c0                	test   %eax,%eax
+  802879:	75 e7                	jne    802862 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80287b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287e:	5b                   	pop    %ebx
+  80287f:	5e                   	pop    %esi
+  802880:	5d                   	pop    %ebp
+  802881:	c3                   	ret
+
+00802882 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802892:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  802896:	f7 d8                	neg    %eax
+  802898:	19 c0                	sbb    %eax,%eax
+  80289a:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  80289d:	5d                   	pop    %ebp
+  80289e:	c3                   	ret
+
+0080289f <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80289f:	55                   	push   %ebp
+  8028a0:	89 e5                	mov    %esp,%ebp
+  8028a2:	83 ec 08             	sub    $0x8,%esp
+  8028a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ad:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028b0:	83 f8 02             	cmp    $0x2,%eax
+  8028b3:	74 02                	je     8028b7 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028b5:	c9                   	leave
+  8028b6:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+  8028ba:	6a 01                	push   $0x1
+  8028bc:	52                   	push   %edx
+  8028bd:	e8 54 dc ff ff       	call   800516 <sys_futex_wake>
+  8028c2:	83 c4 10             	add    $0x10,%esp
+}
+  8028c5:	eb ee                	jmp    8028b5 <mutex_unlock+0x16>
+
+008028c7 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028d3:	5d                   	pop    %ebp
+  8028d4:	c3                   	ret
+
+008028d5 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	57                   	push   %edi
+  8028d9:	56                   	push   %esi
+  8028da:	53                   	push   %ebx
+  8028db:	83 ec 18             	sub    $0x18,%esp
+  8028de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028e4:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028e6:	53                   	push   %ebx
+  8028e7:	e8 b3 ff ff ff       	call   80289f <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8028ec:	83 c4 0c             	add    $0xc,%esp
+  8028ef:	ff 75 10             	push   0x10(%ebp)
+  8028f2:	57                   	push   %edi
+  8028f3:	56                   	push   %esi
+  8028f4:	e8 ee db ff ff       	call   8004e7 <sys_futex_wait>
+  8028f9:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8028fb:	83 c4 10             	add    $0x10,%esp
+  8028fe:	be 02 00 00 00       	mov    $0x2,%esi
+  802903:	eb 10                	jmp    802915 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802905:	83 ec 04             	sub    $0x4,%esp
+  802908:	6a 00                	push   $0x0
+  80290a:	6a 02                	push   $0x2
+  80290c:	53                   	push   %ebx
+  80290d:	e8 d5 db ff ff       	call   8004e7 <sys_futex_wait>
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	89 f0                	mov    %esi,%eax
+  802917:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	75 e7                	jne    802905 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80291e:	83 ff ec             	cmp    $0xffffffec,%edi
+  802921:	74 05                	je     802928 <cond_timedwait+0x53>
+  802923:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802928:	89 f8                	mov    %edi,%eax
+  80292a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5f                   	pop    %edi
+  802930:	5d                   	pop    %ebp
+  802931:	c3                   	ret
+
+00802932 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+  802935:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802938:	6a 00                	push   $0x0
+  80293a:	ff 75 0c             	push   0xc(%ebp)
+  80293d:	ff 75 08             	push   0x8(%ebp)
+  802940:	e8 90 ff ff ff       	call   8028d5 <cond_timedwait>
+}
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+0080294a <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 10             	sub    $0x10,%esp
+  802950:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802953:	ba 01 00 00 00       	mov    $0x1,%edx
+  802958:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80295c:	6a 01                	push   $0x1
+  80295e:	50                   	push   %eax
+  80295f:	e8 b2 db ff ff       	call   800516 <sys_futex_wake>
+}
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+
+00802969 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802969:	55                   	push   %ebp
+  80296a:	89 e5                	mov    %esp,%ebp
+  80296c:	83 ec 10             	sub    $0x10,%esp
+  80296f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802972:	ba 01 00 00 00       	mov    $0x1,%edx
+  802977:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80297b:	68 00 04 00 00       	push   $0x400
+  802980:	50                   	push   %eax
+  802981:	e8 90 db ff ff       	call   800516 <sys_futex_wake>
+}
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	c9                   	leave
+  80298a:	c3                   	ret
+
+0080298b <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80298b:	55                   	push   %ebp
+  80298c:	89 e5                	mov    %esp,%ebp
+  80298e:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  802991:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802994:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  802996:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80299d:	5d                   	pop    %ebp
+  80299e:	c3                   	ret
+
+0080299f <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80299f:	55                   	push   %ebp
+  8029a0:	89 e5                	mov    %esp,%ebp
+  8029a2:	53                   	push   %ebx
+  8029a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029a6:	8b 11                	mov    (%ecx),%edx
+  8029a8:	85 d2                	test   %edx,%edx
+  8029aa:	74 14                	je     8029c0 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029ac:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029af:	89 d0                	mov    %edx,%eax
+  8029b1:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029b5:	39 c2                	cmp    %eax,%edx
+  8029b7:	75 ed                	jne    8029a6 <sem_trywait+0x7>
+			return 0;
+  8029b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029be:	eb 05                	jmp    8029c5 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029c0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+008029ca <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	57                   	push   %edi
+  8029ce:	56                   	push   %esi
+  8029cf:	53                   	push   %ebx
+  8029d0:	83 ec 1c             	sub    $0x1c,%esp
+  8029d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029d6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029d9:	e8 81 da ff ff       	call   80045f <sys_time_msec>
+  8029de:	01 f8                	add    %edi,%eax
+  8029e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029e3:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029e8:	eb 28                	jmp    802a12 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ef:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8029f4:	83 ec 04             	sub    $0x4,%esp
+  8029f7:	56                   	push   %esi
+  8029f8:	6a 00                	push   $0x0
+  8029fa:	53                   	push   %ebx
+  8029fb:	e8 e7 da ff ff       	call   8004e7 <sys_futex_wait>
+  802a00:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a05:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a10:	74 2e                	je     802a40 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a12:	83 ec 0c             	sub    $0xc,%esp
+  802a15:	53                   	push   %ebx
+  802a16:	e8 84 ff ff ff       	call   80299f <sem_trywait>
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	79 19                	jns    802a3b <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a22:	85 ff                	test   %edi,%edi
+  802a24:	74 c4                	je     8029ea <sem_timedwait+0x20>
+  802a26:	e8 34 da ff ff       	call   80045f <sys_time_msec>
+  802a2b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a2e:	29 c6                	sub    %eax,%esi
+  802a30:	85 f6                	test   %esi,%esi
+  802a32:	7f b6                	jg     8029ea <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a34:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a39:	eb 05                	jmp    802a40 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a43:	5b                   	pop    %ebx
+  802a44:	5e                   	pop    %esi
+  802a45:	5f                   	pop    %edi
+  802a46:	5d                   	pop    %ebp
+  802a47:	c3                   	ret
+
+00802a48 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a48:	55                   	push   %ebp
+  802a49:	89 e5                	mov    %esp,%ebp
+  802a4b:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a4e:	6a 00                	push   $0x0
+  802a50:	ff 75 08             	push   0x8(%ebp)
+  802a53:	e8 72 ff ff ff       	call   8029ca <sem_timedwait>
+}
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	c9                   	leave
+  802a5c:	c3                   	ret
+
+00802a5d <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	83 ec 08             	sub    $0x8,%esp
+  802a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a66:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a6b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a6f:	8b 50 04             	mov    0x4(%eax),%edx
+  802a72:	85 d2                	test   %edx,%edx
+  802a74:	75 02                	jne    802a78 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a76:	c9                   	leave
+  802a77:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a78:	83 ec 08             	sub    $0x8,%esp
+  802a7b:	6a 01                	push   $0x1
+  802a7d:	50                   	push   %eax
+  802a7e:	e8 93 da ff ff       	call   800516 <sys_futex_wake>
+  802a83:	83 c4 10             	add    $0x10,%esp
+}
+  802a86:	eb ee                	jmp    802a76 <sem_post+0x19>
+
+00802a88 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a88:	55                   	push   %ebp
+  802a89:	89 e5                	mov    %esp,%ebp
+  802a8b:	57                   	push   %edi
+  802a8c:	56                   	push   %esi
+  802a8d:	53                   	push   %ebx
+  802a8e:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802a91:	68 20 60 80 00       	push   $0x806020
+  802a96:	e8 97 fd ff ff       	call   802832 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802a9b:	a1 44 60 80 00       	mov    0x806044,%eax
+  802aa0:	83 c4 10             	add    $0x10,%esp
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	75 19                	jne    802ac0 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802aa7:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802aac:	8b 00                	mov    (%eax),%eax
+  802aae:	8b 40 48             	mov    0x48(%eax),%eax
+  802ab1:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802ab6:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802abd:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ac0:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ac5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ac8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802acf:	8b 40 04             	mov    0x4(%eax),%eax
+  802ad2:	85 c0                	test   %eax,%eax
+  802ad4:	0f 84 e4 00 00 00    	je     802bbe <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ada:	83 c3 01             	add    $0x1,%ebx
+  802add:	83 fb 20             	cmp    $0x20,%ebx
+  802ae0:	75 e3                	jne    802ac5 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802ae2:	83 ec 0c             	sub    $0xc,%esp
+  802ae5:	68 20 60 80 00       	push   $0x806020
+  802aea:	e8 b0 fd ff ff       	call   80289f <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802aef:	83 c4 10             	add    $0x10,%esp
+  802af2:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802af7:	e9 b8 00 00 00       	jmp    802bb4 <pthread_create+0x12c>
+  802afc:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802aff:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b02:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b04:	39 f3                	cmp    %esi,%ebx
+  802b06:	73 16                	jae    802b1e <pthread_create+0x96>
+		va -= PGSIZE;
+  802b08:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b0e:	83 ec 08             	sub    $0x8,%esp
+  802b11:	56                   	push   %esi
+  802b12:	6a 00                	push   $0x0
+  802b14:	e8 52 d7 ff ff       	call   80026b <sys_page_unmap>
+  802b19:	83 c4 10             	add    $0x10,%esp
+  802b1c:	eb e6                	jmp    802b04 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b1e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b21:	83 ec 08             	sub    $0x8,%esp
+  802b24:	ff 75 e4             	push   -0x1c(%ebp)
+  802b27:	6a 00                	push   $0x0
+  802b29:	e8 3d d7 ff ff       	call   80026b <sys_page_unmap>
+	return r;
+  802b2e:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b31:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b34:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b3b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b42:	eb 70                	jmp    802bb4 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b44:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b47:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b51:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b54:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b57:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b5a:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b61:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b66:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b69:	29 c8                	sub    %ecx,%eax
+  802b6b:	85 db                	test   %ebx,%ebx
+  802b6d:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b74:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b77:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b7e:	83 ec 04             	sub    $0x4,%esp
+  802b81:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b86:	29 ca                	sub    %ecx,%edx
+  802b88:	52                   	push   %edx
+	*--esp = 0;
+  802b89:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b8c:	50                   	push   %eax
+  802b8d:	68 e5 2d 80 00       	push   $0x802de5
+  802b92:	e8 24 da ff ff       	call   8005bb <sys_thread_create>
+  802b97:	89 c7                	mov    %eax,%edi
+  802b99:	83 c4 10             	add    $0x10,%esp
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	78 91                	js     802b31 <pthread_create+0xa9>
+	th->th_env = id;
+  802ba0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ba3:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bad:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802baf:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bb4:	89 f8                	mov    %edi,%eax
+  802bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bbe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bc1:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bc8:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802bcf:	83 ec 0c             	sub    $0xc,%esp
+  802bd2:	68 20 60 80 00       	push   $0x806020
+  802bd7:	e8 c3 fc ff ff       	call   80289f <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802bdc:	89 d9                	mov    %ebx,%ecx
+  802bde:	c1 e1 10             	shl    $0x10,%ecx
+  802be1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802be4:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802be9:	29 c8                	sub    %ecx,%eax
+  802beb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802bee:	c1 e8 16             	shr    $0x16,%eax
+  802bf1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802bf8:	83 c4 10             	add    $0x10,%esp
+  802bfb:	a8 01                	test   $0x1,%al
+  802bfd:	74 15                	je     802c14 <pthread_create+0x18c>
+  802bff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c02:	c1 e8 0c             	shr    $0xc,%eax
+  802c05:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c0c:	a8 01                	test   $0x1,%al
+  802c0e:	0f 85 30 ff ff ff    	jne    802b44 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c14:	83 ec 04             	sub    $0x4,%esp
+  802c17:	6a 07                	push   $0x7
+  802c19:	ff 75 e4             	push   -0x1c(%ebp)
+  802c1c:	6a 00                	push   $0x0
+  802c1e:	e8 af d5 ff ff       	call   8001d2 <sys_page_alloc>
+  802c23:	89 c7                	mov    %eax,%edi
+  802c25:	83 c4 10             	add    $0x10,%esp
+  802c28:	85 c0                	test   %eax,%eax
+  802c2a:	0f 88 01 ff ff ff    	js     802b31 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c30:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c35:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c38:	29 d0                	sub    %edx,%eax
+  802c3a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c3d:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c3f:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c44:	29 d0                	sub    %edx,%eax
+  802c46:	89 c7                	mov    %eax,%edi
+  802c48:	39 fe                	cmp    %edi,%esi
+  802c4a:	0f 83 f4 fe ff ff    	jae    802b44 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c50:	83 ec 04             	sub    $0x4,%esp
+  802c53:	6a 07                	push   $0x7
+  802c55:	56                   	push   %esi
+  802c56:	6a 00                	push   $0x0
+  802c58:	e8 75 d5 ff ff       	call   8001d2 <sys_page_alloc>
+  802c5d:	83 c4 10             	add    $0x10,%esp
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	0f 88 94 fe ff ff    	js     802afc <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c68:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c6e:	eb d8                	jmp    802c48 <pthread_create+0x1c0>
+
+00802c70 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	57                   	push   %edi
+  802c74:	56                   	push   %esi
+  802c75:	53                   	push   %ebx
+  802c76:	83 ec 0c             	sub    $0xc,%esp
+  802c79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c7c:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c7f:	83 f8 1e             	cmp    $0x1e,%eax
+  802c82:	0f 87 c7 00 00 00    	ja     802d4f <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c88:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c8a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802c90:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802c95:	77 12                	ja     802ca9 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802c97:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802c9c:	29 d0                	sub    %edx,%eax
+  802c9e:	c1 e8 10             	shr    $0x10,%eax
+  802ca1:	39 c3                	cmp    %eax,%ebx
+  802ca3:	0f 84 ad 00 00 00    	je     802d56 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802ca9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cac:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cb3:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cba:	eb 10                	jmp    802ccc <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cbc:	83 ec 04             	sub    $0x4,%esp
+  802cbf:	6a 00                	push   $0x0
+  802cc1:	6a 01                	push   $0x1
+  802cc3:	57                   	push   %edi
+  802cc4:	e8 1e d8 ff ff       	call   8004e7 <sys_futex_wait>
+  802cc9:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ccc:	8b 46 04             	mov    0x4(%esi),%eax
+  802ccf:	83 f8 01             	cmp    $0x1,%eax
+  802cd2:	74 e8                	je     802cbc <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802cd4:	83 f8 02             	cmp    $0x2,%eax
+  802cd7:	0f 85 80 00 00 00    	jne    802d5d <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cdd:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802ce0:	c1 e6 02             	shl    $0x2,%esi
+  802ce3:	eb 05                	jmp    802cea <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802ce5:	e8 bc d4 ff ff       	call   8001a6 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cea:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802cf0:	89 ca                	mov    %ecx,%edx
+  802cf2:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802cf8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802cfb:	c1 e0 04             	shl    $0x4,%eax
+  802cfe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d03:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d06:	39 c1                	cmp    %eax,%ecx
+  802d08:	75 12                	jne    802d1c <pthread_join+0xac>
+  802d0a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d0d:	c1 e0 04             	shl    $0x4,%eax
+  802d10:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d15:	8b 40 54             	mov    0x54(%eax),%eax
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	75 c9                	jne    802ce5 <pthread_join+0x75>
+	if (ret_store)
+  802d1c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d20:	74 0f                	je     802d31 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d22:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d25:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d2f:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d31:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d34:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d3b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4a:	5b                   	pop    %ebx
+  802d4b:	5e                   	pop    %esi
+  802d4c:	5f                   	pop    %edi
+  802d4d:	5d                   	pop    %ebp
+  802d4e:	c3                   	ret
+		return -E_INVAL;
+  802d4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d54:	eb f1                	jmp    802d47 <pthread_join+0xd7>
+  802d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5b:	eb ea                	jmp    802d47 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d62:	eb e3                	jmp    802d47 <pthread_join+0xd7>
+
+00802d64 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	53                   	push   %ebx
+  802d68:	83 ec 04             	sub    $0x4,%esp
+  802d6b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d6d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d73:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d78:	77 0c                	ja     802d86 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d7a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d7f:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d81:	c1 e8 10             	shr    $0x10,%eax
+  802d84:	75 0a                	jne    802d90 <pthread_exit+0x2c>
+		exit();
+  802d86:	e8 25 d3 ff ff       	call   8000b0 <exit>
+  802d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802d90:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802d97:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802d9a:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802da1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802da4:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802da7:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802dae:	83 ec 08             	sub    $0x8,%esp
+  802db1:	6a 20                	push   $0x20
+  802db3:	01 c2                	add    %eax,%edx
+  802db5:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dbc:	50                   	push   %eax
+  802dbd:	e8 54 d7 ff ff       	call   800516 <sys_futex_wake>
+	sys_env_destroy(0);
+  802dc2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802dc9:	e8 61 d3 ff ff       	call   80012f <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802dce:	83 c4 0c             	add    $0xc,%esp
+  802dd1:	68 7e 48 80 00       	push   $0x80487e
+  802dd6:	68 a5 00 00 00       	push   $0xa5
+  802ddb:	68 98 48 80 00       	push   $0x804898
+  802de0:	e8 cd 03 00 00       	call   8031b2 <_panic>
+
+00802de5 <pthread_start>:
+{
+  802de5:	55                   	push   %ebp
+  802de6:	89 e5                	mov    %esp,%ebp
+  802de8:	53                   	push   %ebx
+  802de9:	83 ec 04             	sub    $0x4,%esp
+  802dec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802def:	e8 86 d3 ff ff       	call   80017a <sys_getenvid>
+  802df4:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802df9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802dff:	85 db                	test   %ebx,%ebx
+  802e01:	74 0c                	je     802e0f <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e03:	89 d9                	mov    %ebx,%ecx
+  802e05:	c1 e1 10             	shl    $0x10,%ecx
+  802e08:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e0d:	29 ca                	sub    %ecx,%edx
+  802e0f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e12:	c1 e0 04             	shl    $0x4,%eax
+  802e15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e1a:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e1c:	83 ec 0c             	sub    $0xc,%esp
+  802e1f:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e26:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e29:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e30:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e37:	89 04 24             	mov    %eax,(%esp)
+  802e3a:	e8 25 ff ff ff       	call   802d64 <pthread_exit>
+
+00802e3f <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	57                   	push   %edi
+  802e43:	56                   	push   %esi
+  802e44:	53                   	push   %ebx
+  802e45:	83 ec 1c             	sub    $0x1c,%esp
+  802e48:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e4a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e50:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e57:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e5c:	77 0d                	ja     802e6b <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e5e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e63:	29 d0                	sub    %edx,%eax
+  802e65:	c1 e8 10             	shr    $0x10,%eax
+  802e68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e70:	eb 2f                	jmp    802ea1 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e72:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e78:	8b 01                	mov    (%ecx),%eax
+  802e7a:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e7d:	39 c2                	cmp    %eax,%edx
+  802e7f:	75 14                	jne    802e95 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e81:	83 ec 0c             	sub    $0xc,%esp
+  802e84:	57                   	push   %edi
+  802e85:	e8 a5 d2 ff ff       	call   80012f <sys_env_destroy>
+  802e8a:	83 c4 10             	add    $0x10,%esp
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	0f 88 97 00 00 00    	js     802f2c <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e95:	83 c3 01             	add    $0x1,%ebx
+  802e98:	83 fb 20             	cmp    $0x20,%ebx
+  802e9b:	0f 84 d2 00 00 00    	je     802f73 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802ea1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ea4:	74 ef                	je     802e95 <pthread_kill_others+0x56>
+  802ea6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ea9:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802eb0:	8b 40 04             	mov    0x4(%eax),%eax
+  802eb3:	83 f8 01             	cmp    $0x1,%eax
+  802eb6:	75 dd                	jne    802e95 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802eb8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ebb:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ec2:	89 fe                	mov    %edi,%esi
+  802ec4:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802eca:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ecd:	c1 e0 04             	shl    $0x4,%eax
+  802ed0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ed5:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ed8:	39 c7                	cmp    %eax,%edi
+  802eda:	75 b9                	jne    802e95 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802edc:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802edf:	c1 e0 04             	shl    $0x4,%eax
+  802ee2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ee7:	8b 40 54             	mov    0x54(%eax),%eax
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	74 a7                	je     802e95 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802eee:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef1:	c1 e0 04             	shl    $0x4,%eax
+  802ef4:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802efa:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802efc:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f02:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f07:	0f 87 65 ff ff ff    	ja     802e72 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f0d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f12:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f14:	c1 e8 10             	shr    $0x10,%eax
+  802f17:	0f 84 55 ff ff ff    	je     802e72 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f1d:	c1 e0 10             	shl    $0x10,%eax
+  802f20:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f25:	29 c1                	sub    %eax,%ecx
+  802f27:	e9 4c ff ff ff       	jmp    802e78 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f2c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f2f:	c1 e2 04             	shl    $0x4,%edx
+  802f32:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f38:	8b 52 48             	mov    0x48(%edx),%edx
+  802f3b:	39 fa                	cmp    %edi,%edx
+  802f3d:	0f 85 52 ff ff ff    	jne    802e95 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f43:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f46:	c1 e2 04             	shl    $0x4,%edx
+  802f49:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f4f:	8b 52 54             	mov    0x54(%edx),%edx
+  802f52:	85 d2                	test   %edx,%edx
+  802f54:	0f 84 3b ff ff ff    	je     802e95 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f5a:	83 ec 0c             	sub    $0xc,%esp
+  802f5d:	50                   	push   %eax
+  802f5e:	57                   	push   %edi
+  802f5f:	68 a8 48 80 00       	push   $0x8048a8
+  802f64:	68 bb 00 00 00       	push   $0xbb
+  802f69:	68 98 48 80 00       	push   $0x804898
+  802f6e:	e8 3f 02 00 00       	call   8031b2 <_panic>
+	}
+}
+  802f73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f76:	5b                   	pop    %ebx
+  802f77:	5e                   	pop    %esi
+  802f78:	5f                   	pop    %edi
+  802f79:	5d                   	pop    %ebp
+  802f7a:	c3                   	ret
+
+00802f7b <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f7b:	55                   	push   %ebp
+  802f7c:	89 e5                	mov    %esp,%ebp
+  802f7e:	53                   	push   %ebx
+  802f7f:	83 ec 04             	sub    $0x4,%esp
+  802f82:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f84:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f8a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f90:	0f 87 85 00 00 00    	ja     80301b <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f96:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802f9b:	29 c3                	sub    %eax,%ebx
+  802f9d:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fa0:	83 ec 04             	sub    $0x4,%esp
+  802fa3:	68 80 02 00 00       	push   $0x280
+  802fa8:	6a 00                	push   $0x0
+  802faa:	68 40 60 80 00       	push   $0x806040
+  802faf:	e8 0e 0a 00 00       	call   8039c2 <memset>
+	threads_mu.m_state = 0;
+  802fb4:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fbb:	00 00 00 
+	if (self != 0) {
+  802fbe:	83 c4 10             	add    $0x10,%esp
+  802fc1:	85 db                	test   %ebx,%ebx
+  802fc3:	74 51                	je     803016 <pthread_fork_child+0x9b>
+  802fc5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fc7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fcd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fd2:	77 18                	ja     802fec <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fd4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fd9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fdb:	c1 e8 10             	shr    $0x10,%eax
+  802fde:	74 0c                	je     802fec <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fe0:	c1 e0 10             	shl    $0x10,%eax
+  802fe3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fe8:	29 c2                	sub    %eax,%edx
+  802fea:	eb 06                	jmp    802ff2 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  802fec:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  802ff2:	8b 02                	mov    (%edx),%eax
+  802ff4:	8b 48 48             	mov    0x48(%eax),%ecx
+  802ff7:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802ffe:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803001:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803008:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  80300f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803016:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803019:	c9                   	leave
+  80301a:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80301b:	83 ec 04             	sub    $0x4,%esp
+  80301e:	68 80 02 00 00       	push   $0x280
+  803023:	6a 00                	push   $0x0
+  803025:	68 40 60 80 00       	push   $0x806040
+  80302a:	e8 93 09 00 00       	call   8039c2 <memset>
+	threads_mu.m_state = 0;
+  80302f:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803036:	00 00 00 
+  803039:	83 c4 10             	add    $0x10,%esp
+  80303c:	eb d8                	jmp    803016 <pthread_fork_child+0x9b>
+
+0080303e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803043:	c3                   	ret
+
+00803044 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803044:	55                   	push   %ebp
+  803045:	89 e5                	mov    %esp,%ebp
+  803047:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80304a:	68 cd 48 80 00       	push   $0x8048cd
+  80304f:	ff 75 0c             	push   0xc(%ebp)
+  803052:	e8 1a 08 00 00       	call   803871 <strcpy>
+	return 0;
+}
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	c9                   	leave
+  80305d:	c3                   	ret
+
+0080305e <devcons_write>:
+{
+  80305e:	55                   	push   %ebp
+  80305f:	89 e5                	mov    %esp,%ebp
+  803061:	57                   	push   %edi
+  803062:	56                   	push   %esi
+  803063:	53                   	push   %ebx
+  803064:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80306a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80306f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803075:	eb 2e                	jmp    8030a5 <devcons_write+0x47>
+		m = n - tot;
+  803077:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80307a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80307c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803081:	39 c3                	cmp    %eax,%ebx
+  803083:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803086:	83 ec 04             	sub    $0x4,%esp
+  803089:	53                   	push   %ebx
+  80308a:	89 f0                	mov    %esi,%eax
+  80308c:	03 45 0c             	add    0xc(%ebp),%eax
+  80308f:	50                   	push   %eax
+  803090:	57                   	push   %edi
+  803091:	e8 61 09 00 00       	call   8039f7 <memmove>
+		sys_cputs(buf, m);
+  803096:	83 c4 08             	add    $0x8,%esp
+  803099:	53                   	push   %ebx
+  80309a:	57                   	push   %edi
+  80309b:	e8 38 d0 ff ff       	call   8000d8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030a0:	01 de                	add    %ebx,%esi
+  8030a2:	83 c4 10             	add    $0x10,%esp
+  8030a5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030a8:	72 cd                	jb     803077 <devcons_write+0x19>
+}
+  8030aa:	89 f0                	mov    %esi,%eax
+  8030ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030af:	5b                   	pop    %ebx
+  8030b0:	5e                   	pop    %esi
+  8030b1:	5f                   	pop    %edi
+  8030b2:	5d                   	pop    %ebp
+  8030b3:	c3                   	ret
+
+008030b4 <devcons_read>:
+{
+  8030b4:	55                   	push   %ebp
+  8030b5:	89 e5                	mov    %esp,%ebp
+  8030b7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030c3:	75 07                	jne    8030cc <devcons_read+0x18>
+  8030c5:	eb 1f                	jmp    8030e6 <devcons_read+0x32>
+		sys_yield();
+  8030c7:	e8 da d0 ff ff       	call   8001a6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030cc:	e8 32 d0 ff ff       	call   800103 <sys_cgetc>
+  8030d1:	85 c0                	test   %eax,%eax
+  8030d3:	74 f2                	je     8030c7 <devcons_read+0x13>
+	if (c < 0)
+  8030d5:	78 0f                	js     8030e6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030d7:	83 f8 04             	cmp    $0x4,%eax
+  8030da:	74 0c                	je     8030e8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030df:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030e1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030e6:	c9                   	leave
+  8030e7:	c3                   	ret
+		return 0;
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ed:	eb f7                	jmp    8030e6 <devcons_read+0x32>
+
+008030ef <cputchar>:
+{
+  8030ef:	55                   	push   %ebp
+  8030f0:	89 e5                	mov    %esp,%ebp
+  8030f2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8030fb:	6a 01                	push   $0x1
+  8030fd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803100:	50                   	push   %eax
+  803101:	e8 d2 cf ff ff       	call   8000d8 <sys_cputs>
+}
+  803106:	83 c4 10             	add    $0x10,%esp
+  803109:	c9                   	leave
+  80310a:	c3                   	ret
+
+0080310b <getchar>:
+{
+  80310b:	55                   	push   %ebp
+  80310c:	89 e5                	mov    %esp,%ebp
+  80310e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803111:	6a 01                	push   $0x1
+  803113:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803116:	50                   	push   %eax
+  803117:	6a 00                	push   $0x0
+  803119:	e8 63 d8 ff ff       	call   800981 <read>
+	if (r < 0)
+  80311e:	83 c4 10             	add    $0x10,%esp
+  803121:	85 c0                	test   %eax,%eax
+  803123:	78 06                	js     80312b <getchar+0x20>
+	if (r < 1)
+  803125:	74 06                	je     80312d <getchar+0x22>
+	return c;
+  803127:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80312b:	c9                   	leave
+  80312c:	c3                   	ret
+		return -E_EOF;
+  80312d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803132:	eb f7                	jmp    80312b <getchar+0x20>
+
+00803134 <iscons>:
+{
+  803134:	55                   	push   %ebp
+  803135:	89 e5                	mov    %esp,%ebp
+  803137:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80313a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80313d:	50                   	push   %eax
+  80313e:	ff 75 08             	push   0x8(%ebp)
+  803141:	e8 ab d5 ff ff       	call   8006f1 <fd_lookup>
+  803146:	83 c4 10             	add    $0x10,%esp
+  803149:	85 c0                	test   %eax,%eax
+  80314b:	78 11                	js     80315e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80314d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803150:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803156:	39 10                	cmp    %edx,(%eax)
+  803158:	0f 94 c0             	sete   %al
+  80315b:	0f b6 c0             	movzbl %al,%eax
+}
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+00803160 <opencons>:
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803166:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803169:	50                   	push   %eax
+  80316a:	e8 2c d5 ff ff       	call   80069b <fd_alloc>
+  80316f:	83 c4 10             	add    $0x10,%esp
+  803172:	85 c0                	test   %eax,%eax
+  803174:	78 3a                	js     8031b0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803176:	83 ec 04             	sub    $0x4,%esp
+  803179:	68 07 04 00 00       	push   $0x407
+  80317e:	ff 75 f4             	push   -0xc(%ebp)
+  803181:	6a 00                	push   $0x0
+  803183:	e8 4a d0 ff ff       	call   8001d2 <sys_page_alloc>
+  803188:	83 c4 10             	add    $0x10,%esp
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	78 21                	js     8031b0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80318f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803192:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803198:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80319a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031a4:	83 ec 0c             	sub    $0xc,%esp
+  8031a7:	50                   	push   %eax
+  8031a8:	e8 c7 d4 ff ff       	call   800674 <fd2num>
+  8031ad:	83 c4 10             	add    $0x10,%esp
+}
+  8031b0:	c9                   	leave
+  8031b1:	c3                   	ret
+
+008031b2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031b2:	55                   	push   %ebp
+  8031b3:	89 e5                	mov    %esp,%ebp
+  8031b5:	56                   	push   %esi
+  8031b6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031b7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031ba:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031c0:	e8 b5 cf ff ff       	call   80017a <sys_getenvid>
+  8031c5:	83 ec 0c             	sub    $0xc,%esp
+  8031c8:	ff 75 0c             	push   0xc(%ebp)
+  8031cb:	ff 75 08             	push   0x8(%ebp)
+  8031ce:	56                   	push   %esi
+  8031cf:	50                   	push   %eax
+  8031d0:	68 dc 48 80 00       	push   $0x8048dc
+  8031d5:	e8 b3 00 00 00       	call   80328d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031da:	83 c4 18             	add    $0x18,%esp
+  8031dd:	53                   	push   %ebx
+  8031de:	ff 75 10             	push   0x10(%ebp)
+  8031e1:	e8 56 00 00 00       	call   80323c <vcprintf>
+	cprintf("\n");
+  8031e6:	c7 04 24 b2 4d 80 00 	movl   $0x804db2,(%esp)
+  8031ed:	e8 9b 00 00 00       	call   80328d <cprintf>
+  8031f2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8031f5:	cc                   	int3
+	while (1)
+  8031f6:	eb fd                	jmp    8031f5 <_panic+0x43>
+
+008031f8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8031f8:	55                   	push   %ebp
+  8031f9:	89 e5                	mov    %esp,%ebp
+  8031fb:	53                   	push   %ebx
+  8031fc:	83 ec 04             	sub    $0x4,%esp
+  8031ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803202:	8b 13                	mov    (%ebx),%edx
+  803204:	8d 42 01             	lea    0x1(%edx),%eax
+  803207:	89 03                	mov    %eax,(%ebx)
+  803209:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80320c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803210:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803215:	74 09                	je     803220 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803217:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80321b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803220:	83 ec 08             	sub    $0x8,%esp
+  803223:	68 ff 00 00 00       	push   $0xff
+  803228:	8d 43 08             	lea    0x8(%ebx),%eax
+  80322b:	50                   	push   %eax
+  80322c:	e8 a7 ce ff ff       	call   8000d8 <sys_cputs>
+		b->idx = 0;
+  803231:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803237:	83 c4 10             	add    $0x10,%esp
+  80323a:	eb db                	jmp    803217 <putch+0x1f>
+
+0080323c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80323c:	55                   	push   %ebp
+  80323d:	89 e5                	mov    %esp,%ebp
+  80323f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803245:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80324c:	00 00 00 
+	b.cnt = 0;
+  80324f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803256:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803259:	ff 75 0c             	push   0xc(%ebp)
+  80325c:	ff 75 08             	push   0x8(%ebp)
+  80325f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803265:	50                   	push   %eax
+  803266:	68 f8 31 80 00       	push   $0x8031f8
+  80326b:	e8 14 01 00 00       	call   803384 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803270:	83 c4 08             	add    $0x8,%esp
+  803273:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  803279:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80327f:	50                   	push   %eax
+  803280:	e8 53 ce ff ff       	call   8000d8 <sys_cputs>
+
+	return b.cnt;
+}
+  803285:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+
+0080328d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803293:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  803296:	50                   	push   %eax
+  803297:	ff 75 08             	push   0x8(%ebp)
+  80329a:	e8 9d ff ff ff       	call   80323c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80329f:	c9                   	leave
+  8032a0:	c3                   	ret
+
+008032a1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032a1:	55                   	push   %ebp
+  8032a2:	89 e5                	mov    %esp,%ebp
+  8032a4:	57                   	push   %edi
+  8032a5:	56                   	push   %esi
+  8032a6:	53                   	push   %ebx
+  8032a7:	83 ec 1c             	sub    $0x1c,%esp
+  8032aa:	89 c7                	mov    %eax,%edi
+  8032ac:	89 d6                	mov    %edx,%esi
+  8032ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b4:	89 d1                	mov    %edx,%ecx
+  8032b6:	89 c2                	mov    %eax,%edx
+  8032b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032bb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032be:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032c1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032c7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032ce:	39 c2                	cmp    %eax,%edx
+  8032d0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032d3:	72 3e                	jb     803313 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032d5:	83 ec 0c             	sub    $0xc,%esp
+  8032d8:	ff 75 18             	push   0x18(%ebp)
+  8032db:	83 eb 01             	sub    $0x1,%ebx
+  8032de:	53                   	push   %ebx
+  8032df:	50                   	push   %eax
+  8032e0:	83 ec 08             	sub    $0x8,%esp
+  8032e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8032e6:	ff 75 e0             	push   -0x20(%ebp)
+  8032e9:	ff 75 dc             	push   -0x24(%ebp)
+  8032ec:	ff 75 d8             	push   -0x28(%ebp)
+  8032ef:	e8 47 12 00 00       	call   80453b <__udivdi3>
+  8032f4:	83 c4 18             	add    $0x18,%esp
+  8032f7:	52                   	push   %edx
+  8032f8:	50                   	push   %eax
+  8032f9:	89 f2                	mov    %esi,%edx
+  8032fb:	89 f8                	mov    %edi,%eax
+  8032fd:	e8 9f ff ff ff       	call   8032a1 <printnum>
+  803302:	83 c4 20             	add    $0x20,%esp
+  803305:	eb 13                	jmp    80331a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803307:	83 ec 08             	sub    $0x8,%esp
+  80330a:	56                   	push   %esi
+  80330b:	ff 75 18             	push   0x18(%ebp)
+  80330e:	ff d7                	call   *%edi
+  803310:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803313:	83 eb 01             	sub    $0x1,%ebx
+  803316:	85 db                	test   %ebx,%ebx
+  803318:	7f ed                	jg     803307 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80331a:	83 ec 08             	sub    $0x8,%esp
+  80331d:	56                   	push   %esi
+  80331e:	83 ec 04             	sub    $0x4,%esp
+  803321:	ff 75 e4             	push   -0x1c(%ebp)
+  803324:	ff 75 e0             	push   -0x20(%ebp)
+  803327:	ff 75 dc             	push   -0x24(%ebp)
+  80332a:	ff 75 d8             	push   -0x28(%ebp)
+  80332d:	e8 2a 12 00 00       	call   80455c <__umoddi3>
+  803332:	83 c4 14             	add    $0x14,%esp
+  803335:	0f be 80 ff 48 80 00 	movsbl 0x8048ff(%eax),%eax
+  80333c:	50                   	push   %eax
+  80333d:	ff d7                	call   *%edi
+}
+  80333f:	83 c4 10             	add    $0x10,%esp
+  803342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803345:	5b                   	pop    %ebx
+  803346:	5e                   	pop    %esi
+  803347:	5f                   	pop    %edi
+  803348:	5d                   	pop    %ebp
+  803349:	c3                   	ret
+
+0080334a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80334a:	55                   	push   %ebp
+  80334b:	89 e5                	mov    %esp,%ebp
+  80334d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803350:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803354:	8b 10                	mov    (%eax),%edx
+  803356:	3b 50 04             	cmp    0x4(%eax),%edx
+  803359:	73 0a                	jae    803365 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80335b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80335e:	89 08                	mov    %ecx,(%eax)
+  803360:	8b 45 08             	mov    0x8(%ebp),%eax
+  803363:	88 02                	mov    %al,(%edx)
+}
+  803365:	5d                   	pop    %ebp
+  803366:	c3                   	ret
+
+00803367 <printfmt>:
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80336d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803370:	50                   	push   %eax
+  803371:	ff 75 10             	push   0x10(%ebp)
+  803374:	ff 75 0c             	push   0xc(%ebp)
+  803377:	ff 75 08             	push   0x8(%ebp)
+  80337a:	e8 05 00 00 00       	call   803384 <vprintfmt>
+}
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	c9                   	leave
+  803383:	c3                   	ret
+
+00803384 <vprintfmt>:
+{
+  803384:	55                   	push   %ebp
+  803385:	89 e5                	mov    %esp,%ebp
+  803387:	57                   	push   %edi
+  803388:	56                   	push   %esi
+  803389:	53                   	push   %ebx
+  80338a:	83 ec 2c             	sub    $0x2c,%esp
+  80338d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803390:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803393:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803396:	eb 0a                	jmp    8033a2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  803398:	83 ec 08             	sub    $0x8,%esp
+  80339b:	53                   	push   %ebx
+  80339c:	50                   	push   %eax
+  80339d:	ff d6                	call   *%esi
+  80339f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033a2:	83 c7 01             	add    $0x1,%edi
+  8033a5:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033a9:	83 f8 25             	cmp    $0x25,%eax
+  8033ac:	74 0c                	je     8033ba <vprintfmt+0x36>
+			if (ch == '\0')
+  8033ae:	85 c0                	test   %eax,%eax
+  8033b0:	75 e6                	jne    803398 <vprintfmt+0x14>
+}
+  8033b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b5:	5b                   	pop    %ebx
+  8033b6:	5e                   	pop    %esi
+  8033b7:	5f                   	pop    %edi
+  8033b8:	5d                   	pop    %ebp
+  8033b9:	c3                   	ret
+		padc = ' ';
+  8033ba:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033be:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033cc:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033d8:	8d 47 01             	lea    0x1(%edi),%eax
+  8033db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033de:	0f b6 17             	movzbl (%edi),%edx
+  8033e1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033e4:	3c 55                	cmp    $0x55,%al
+  8033e6:	0f 87 c5 03 00 00    	ja     8037b1 <vprintfmt+0x42d>
+  8033ec:	0f b6 c0             	movzbl %al,%eax
+  8033ef:	ff 24 85 80 4a 80 00 	jmp    *0x804a80(,%eax,4)
+  8033f6:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8033f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8033fc:	eb da                	jmp    8033d8 <vprintfmt+0x54>
+  8033fe:	0f be d2             	movsbl %dl,%edx
+  803401:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803404:	b8 00 00 00 00       	mov    $0x0,%eax
+  803409:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80340c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80340f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803413:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803416:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803419:	83 f9 09             	cmp    $0x9,%ecx
+  80341c:	77 55                	ja     803473 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80341e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803421:	eb e9                	jmp    80340c <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803423:	8b 45 14             	mov    0x14(%ebp),%eax
+  803426:	8b 00                	mov    (%eax),%eax
+  803428:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80342b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80342e:	8d 40 04             	lea    0x4(%eax),%eax
+  803431:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803434:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803437:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80343b:	79 9b                	jns    8033d8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80343d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803440:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803443:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80344a:	eb 8c                	jmp    8033d8 <vprintfmt+0x54>
+			if (width < 0)
+  80344c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80344f:	85 d2                	test   %edx,%edx
+  803451:	b8 00 00 00 00       	mov    $0x0,%eax
+  803456:	0f 49 c2             	cmovns %edx,%eax
+  803459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80345c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80345f:	e9 74 ff ff ff       	jmp    8033d8 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803464:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803467:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80346e:	e9 65 ff ff ff       	jmp    8033d8 <vprintfmt+0x54>
+  803473:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803476:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803479:	eb bc                	jmp    803437 <vprintfmt+0xb3>
+			lflag++;
+  80347b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80347e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803481:	e9 52 ff ff ff       	jmp    8033d8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  803486:	8b 45 14             	mov    0x14(%ebp),%eax
+  803489:	8d 78 04             	lea    0x4(%eax),%edi
+  80348c:	83 ec 08             	sub    $0x8,%esp
+  80348f:	53                   	push   %ebx
+  803490:	ff 30                	push   (%eax)
+  803492:	ff d6                	call   *%esi
+			break;
+  803494:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  803497:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80349a:	e9 b1 02 00 00       	jmp    803750 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80349f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034a2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034a5:	8b 10                	mov    (%eax),%edx
+  8034a7:	89 d0                	mov    %edx,%eax
+  8034a9:	f7 d8                	neg    %eax
+  8034ab:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034ae:	83 f8 14             	cmp    $0x14,%eax
+  8034b1:	7f 23                	jg     8034d6 <vprintfmt+0x152>
+  8034b3:	8b 14 85 e0 4b 80 00 	mov    0x804be0(,%eax,4),%edx
+  8034ba:	85 d2                	test   %edx,%edx
+  8034bc:	74 18                	je     8034d6 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034be:	52                   	push   %edx
+  8034bf:	68 a7 47 80 00       	push   $0x8047a7
+  8034c4:	53                   	push   %ebx
+  8034c5:	56                   	push   %esi
+  8034c6:	e8 9c fe ff ff       	call   803367 <printfmt>
+  8034cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034ce:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034d1:	e9 7a 02 00 00       	jmp    803750 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034d6:	50                   	push   %eax
+  8034d7:	68 17 49 80 00       	push   $0x804917
+  8034dc:	53                   	push   %ebx
+  8034dd:	56                   	push   %esi
+  8034de:	e8 84 fe ff ff       	call   803367 <printfmt>
+  8034e3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034e6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034e9:	e9 62 02 00 00       	jmp    803750 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8034ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034f1:	83 c0 04             	add    $0x4,%eax
+  8034f4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8034f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034fa:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8034fc:	85 c9                	test   %ecx,%ecx
+  8034fe:	b8 10 49 80 00       	mov    $0x804910,%eax
+  803503:	0f 45 c1             	cmovne %ecx,%eax
+  803506:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803509:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80350d:	7e 06                	jle    803515 <vprintfmt+0x191>
+  80350f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803513:	75 0b                	jne    803520 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803515:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803518:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80351b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80351e:	eb 5c                	jmp    80357c <vprintfmt+0x1f8>
+  803520:	83 ec 08             	sub    $0x8,%esp
+  803523:	ff 75 d0             	push   -0x30(%ebp)
+  803526:	ff 75 cc             	push   -0x34(%ebp)
+  803529:	e8 20 03 00 00       	call   80384e <strnlen>
+  80352e:	89 c2                	mov    %eax,%edx
+  803530:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803533:	29 d0                	sub    %edx,%eax
+  803535:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803538:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80353c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80353f:	89 75 08             	mov    %esi,0x8(%ebp)
+  803542:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803544:	eb 0e                	jmp    803554 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  803546:	83 ec 08             	sub    $0x8,%esp
+  803549:	53                   	push   %ebx
+  80354a:	57                   	push   %edi
+  80354b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80354e:	83 ee 01             	sub    $0x1,%esi
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	85 f6                	test   %esi,%esi
+  803556:	7f ee                	jg     803546 <vprintfmt+0x1c2>
+  803558:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80355b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	ba 00 00 00 00       	mov    $0x0,%edx
+  803565:	0f 49 d0             	cmovns %eax,%edx
+  803568:	29 d0                	sub    %edx,%eax
+  80356a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80356d:	eb a6                	jmp    803515 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80356f:	83 ec 08             	sub    $0x8,%esp
+  803572:	53                   	push   %ebx
+  803573:	52                   	push   %edx
+  803574:	ff 55 08             	call   *0x8(%ebp)
+  803577:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80357a:	89 f1                	mov    %esi,%ecx
+  80357c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80357f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803583:	0f be d0             	movsbl %al,%edx
+  803586:	85 d2                	test   %edx,%edx
+  803588:	74 28                	je     8035b2 <vprintfmt+0x22e>
+  80358a:	85 ff                	test   %edi,%edi
+  80358c:	78 05                	js     803593 <vprintfmt+0x20f>
+  80358e:	83 ef 01             	sub    $0x1,%edi
+  803591:	78 30                	js     8035c3 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  803593:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  803597:	74 d6                	je     80356f <vprintfmt+0x1eb>
+  803599:	0f be c0             	movsbl %al,%eax
+  80359c:	83 e8 20             	sub    $0x20,%eax
+  80359f:	83 f8 5e             	cmp    $0x5e,%eax
+  8035a2:	76 cb                	jbe    80356f <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035a4:	83 ec 08             	sub    $0x8,%esp
+  8035a7:	53                   	push   %ebx
+  8035a8:	6a 3f                	push   $0x3f
+  8035aa:	ff 55 08             	call   *0x8(%ebp)
+  8035ad:	83 c4 10             	add    $0x10,%esp
+  8035b0:	eb c8                	jmp    80357a <vprintfmt+0x1f6>
+  8035b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035b8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035bb:	01 d0                	add    %edx,%eax
+  8035bd:	29 c8                	sub    %ecx,%eax
+  8035bf:	89 c7                	mov    %eax,%edi
+  8035c1:	eb 13                	jmp    8035d6 <vprintfmt+0x252>
+  8035c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035c6:	eb ed                	jmp    8035b5 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035c8:	83 ec 08             	sub    $0x8,%esp
+  8035cb:	53                   	push   %ebx
+  8035cc:	6a 20                	push   $0x20
+  8035ce:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035d0:	83 ef 01             	sub    $0x1,%edi
+  8035d3:	83 c4 10             	add    $0x10,%esp
+  8035d6:	85 ff                	test   %edi,%edi
+  8035d8:	7f ee                	jg     8035c8 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035da:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035dd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035e0:	e9 6b 01 00 00       	jmp    803750 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035e5:	83 f9 01             	cmp    $0x1,%ecx
+  8035e8:	7f 1f                	jg     803609 <vprintfmt+0x285>
+	else if (lflag)
+  8035ea:	85 c9                	test   %ecx,%ecx
+  8035ec:	74 67                	je     803655 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8035ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035f1:	8b 00                	mov    (%eax),%eax
+  8035f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8035f6:	89 c1                	mov    %eax,%ecx
+  8035f8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8035fb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8035fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  803601:	8d 40 04             	lea    0x4(%eax),%eax
+  803604:	89 45 14             	mov    %eax,0x14(%ebp)
+  803607:	eb 17                	jmp    803620 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  803609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80360c:	8b 50 04             	mov    0x4(%eax),%edx
+  80360f:	8b 00                	mov    (%eax),%eax
+  803611:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803614:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80361a:	8d 40 08             	lea    0x8(%eax),%eax
+  80361d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803620:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803623:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803626:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80362b:	85 c9                	test   %ecx,%ecx
+  80362d:	0f 89 03 01 00 00    	jns    803736 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803633:	83 ec 08             	sub    $0x8,%esp
+  803636:	53                   	push   %ebx
+  803637:	6a 2d                	push   $0x2d
+  803639:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80363b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80363e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803641:	f7 da                	neg    %edx
+  803643:	83 d1 00             	adc    $0x0,%ecx
+  803646:	f7 d9                	neg    %ecx
+  803648:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80364b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803650:	e9 e1 00 00 00       	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  803655:	8b 45 14             	mov    0x14(%ebp),%eax
+  803658:	8b 00                	mov    (%eax),%eax
+  80365a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80365d:	89 c1                	mov    %eax,%ecx
+  80365f:	c1 f9 1f             	sar    $0x1f,%ecx
+  803662:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803665:	8b 45 14             	mov    0x14(%ebp),%eax
+  803668:	8d 40 04             	lea    0x4(%eax),%eax
+  80366b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80366e:	eb b0                	jmp    803620 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803670:	83 f9 01             	cmp    $0x1,%ecx
+  803673:	7f 1e                	jg     803693 <vprintfmt+0x30f>
+	else if (lflag)
+  803675:	85 c9                	test   %ecx,%ecx
+  803677:	74 32                	je     8036ab <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  803679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80367c:	8b 10                	mov    (%eax),%edx
+  80367e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803683:	8d 40 04             	lea    0x4(%eax),%eax
+  803686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803689:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80368e:	e9 a3 00 00 00       	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803693:	8b 45 14             	mov    0x14(%ebp),%eax
+  803696:	8b 10                	mov    (%eax),%edx
+  803698:	8b 48 04             	mov    0x4(%eax),%ecx
+  80369b:	8d 40 08             	lea    0x8(%eax),%eax
+  80369e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036a1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036a6:	e9 8b 00 00 00       	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ae:	8b 10                	mov    (%eax),%edx
+  8036b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8036b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036c0:	eb 74                	jmp    803736 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036c2:	83 f9 01             	cmp    $0x1,%ecx
+  8036c5:	7f 1b                	jg     8036e2 <vprintfmt+0x35e>
+	else if (lflag)
+  8036c7:	85 c9                	test   %ecx,%ecx
+  8036c9:	74 2c                	je     8036f7 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ce:	8b 10                	mov    (%eax),%edx
+  8036d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8036d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036db:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036e0:	eb 54                	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036e5:	8b 10                	mov    (%eax),%edx
+  8036e7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036ea:	8d 40 08             	lea    0x8(%eax),%eax
+  8036ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8036f5:	eb 3f                	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036fa:	8b 10                	mov    (%eax),%edx
+  8036fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803701:	8d 40 04             	lea    0x4(%eax),%eax
+  803704:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803707:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80370c:	eb 28                	jmp    803736 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80370e:	83 ec 08             	sub    $0x8,%esp
+  803711:	53                   	push   %ebx
+  803712:	6a 30                	push   $0x30
+  803714:	ff d6                	call   *%esi
+			putch('x', putdat);
+  803716:	83 c4 08             	add    $0x8,%esp
+  803719:	53                   	push   %ebx
+  80371a:	6a 78                	push   $0x78
+  80371c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80371e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803721:	8b 10                	mov    (%eax),%edx
+  803723:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803728:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80372b:	8d 40 04             	lea    0x4(%eax),%eax
+  80372e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803731:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803736:	83 ec 0c             	sub    $0xc,%esp
+  803739:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80373d:	50                   	push   %eax
+  80373e:	ff 75 e0             	push   -0x20(%ebp)
+  803741:	57                   	push   %edi
+  803742:	51                   	push   %ecx
+  803743:	52                   	push   %edx
+  803744:	89 da                	mov    %ebx,%edx
+  803746:	89 f0                	mov    %esi,%eax
+  803748:	e8 54 fb ff ff       	call   8032a1 <printnum>
+			break;
+  80374d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803750:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803753:	e9 4a fc ff ff       	jmp    8033a2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803758:	83 f9 01             	cmp    $0x1,%ecx
+  80375b:	7f 1b                	jg     803778 <vprintfmt+0x3f4>
+	else if (lflag)
+  80375d:	85 c9                	test   %ecx,%ecx
+  80375f:	74 2c                	je     80378d <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803761:	8b 45 14             	mov    0x14(%ebp),%eax
+  803764:	8b 10                	mov    (%eax),%edx
+  803766:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80376b:	8d 40 04             	lea    0x4(%eax),%eax
+  80376e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803771:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  803776:	eb be                	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80377b:	8b 10                	mov    (%eax),%edx
+  80377d:	8b 48 04             	mov    0x4(%eax),%ecx
+  803780:	8d 40 08             	lea    0x8(%eax),%eax
+  803783:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803786:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80378b:	eb a9                	jmp    803736 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80378d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803790:	8b 10                	mov    (%eax),%edx
+  803792:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803797:	8d 40 04             	lea    0x4(%eax),%eax
+  80379a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80379d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037a2:	eb 92                	jmp    803736 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037a4:	83 ec 08             	sub    $0x8,%esp
+  8037a7:	53                   	push   %ebx
+  8037a8:	6a 25                	push   $0x25
+  8037aa:	ff d6                	call   *%esi
+			break;
+  8037ac:	83 c4 10             	add    $0x10,%esp
+  8037af:	eb 9f                	jmp    803750 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037b1:	83 ec 08             	sub    $0x8,%esp
+  8037b4:	53                   	push   %ebx
+  8037b5:	6a 25                	push   $0x25
+  8037b7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037b9:	83 c4 10             	add    $0x10,%esp
+  8037bc:	89 f8                	mov    %edi,%eax
+  8037be:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037c2:	74 05                	je     8037c9 <vprintfmt+0x445>
+  8037c4:	83 e8 01             	sub    $0x1,%eax
+  8037c7:	eb f5                	jmp    8037be <vprintfmt+0x43a>
+  8037c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037cc:	eb 82                	jmp    803750 <vprintfmt+0x3cc>
+
+008037ce <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037ce:	55                   	push   %ebp
+  8037cf:	89 e5                	mov    %esp,%ebp
+  8037d1:	83 ec 18             	sub    $0x18,%esp
+  8037d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037dd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037e1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8037eb:	85 c0                	test   %eax,%eax
+  8037ed:	74 26                	je     803815 <vsnprintf+0x47>
+  8037ef:	85 d2                	test   %edx,%edx
+  8037f1:	7e 22                	jle    803815 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8037f3:	ff 75 14             	push   0x14(%ebp)
+  8037f6:	ff 75 10             	push   0x10(%ebp)
+  8037f9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8037fc:	50                   	push   %eax
+  8037fd:	68 4a 33 80 00       	push   $0x80334a
+  803802:	e8 7d fb ff ff       	call   803384 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803807:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80380a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80380d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803810:	83 c4 10             	add    $0x10,%esp
+}
+  803813:	c9                   	leave
+  803814:	c3                   	ret
+		return -E_INVAL;
+  803815:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80381a:	eb f7                	jmp    803813 <vsnprintf+0x45>
+
+0080381c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80381c:	55                   	push   %ebp
+  80381d:	89 e5                	mov    %esp,%ebp
+  80381f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803822:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803825:	50                   	push   %eax
+  803826:	ff 75 10             	push   0x10(%ebp)
+  803829:	ff 75 0c             	push   0xc(%ebp)
+  80382c:	ff 75 08             	push   0x8(%ebp)
+  80382f:	e8 9a ff ff ff       	call   8037ce <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803834:	c9                   	leave
+  803835:	c3                   	ret
+
+00803836 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803836:	55                   	push   %ebp
+  803837:	89 e5                	mov    %esp,%ebp
+  803839:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80383c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803841:	eb 03                	jmp    803846 <strlen+0x10>
+		n++;
+  803843:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803846:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80384a:	75 f7                	jne    803843 <strlen+0xd>
+	return n;
+}
+  80384c:	5d                   	pop    %ebp
+  80384d:	c3                   	ret
+
+0080384e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80384e:	55                   	push   %ebp
+  80384f:	89 e5                	mov    %esp,%ebp
+  803851:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803854:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385c:	eb 03                	jmp    803861 <strnlen+0x13>
+		n++;
+  80385e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803861:	39 d0                	cmp    %edx,%eax
+  803863:	74 08                	je     80386d <strnlen+0x1f>
+  803865:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803869:	75 f3                	jne    80385e <strnlen+0x10>
+  80386b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80386d:	89 d0                	mov    %edx,%eax
+  80386f:	5d                   	pop    %ebp
+  803870:	c3                   	ret
+
+00803871 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803871:	55                   	push   %ebp
+  803872:	89 e5                	mov    %esp,%ebp
+  803874:	53                   	push   %ebx
+  803875:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803878:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80387b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803880:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  803884:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  803887:	83 c0 01             	add    $0x1,%eax
+  80388a:	84 d2                	test   %dl,%dl
+  80388c:	75 f2                	jne    803880 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80388e:	89 c8                	mov    %ecx,%eax
+  803890:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+
+00803895 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  803895:	55                   	push   %ebp
+  803896:	89 e5                	mov    %esp,%ebp
+  803898:	53                   	push   %ebx
+  803899:	83 ec 10             	sub    $0x10,%esp
+  80389c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80389f:	53                   	push   %ebx
+  8038a0:	e8 91 ff ff ff       	call   803836 <strlen>
+  8038a5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038a8:	ff 75 0c             	push   0xc(%ebp)
+  8038ab:	01 d8                	add    %ebx,%eax
+  8038ad:	50                   	push   %eax
+  8038ae:	e8 be ff ff ff       	call   803871 <strcpy>
+	return dst;
+}
+  8038b3:	89 d8                	mov    %ebx,%eax
+  8038b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038b8:	c9                   	leave
+  8038b9:	c3                   	ret
+
+008038ba <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038ba:	55                   	push   %ebp
+  8038bb:	89 e5                	mov    %esp,%ebp
+  8038bd:	56                   	push   %esi
+  8038be:	53                   	push   %ebx
+  8038bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038c5:	89 f3                	mov    %esi,%ebx
+  8038c7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038ca:	89 f0                	mov    %esi,%eax
+  8038cc:	eb 0f                	jmp    8038dd <strncpy+0x23>
+		*dst++ = *src;
+  8038ce:	83 c0 01             	add    $0x1,%eax
+  8038d1:	0f b6 0a             	movzbl (%edx),%ecx
+  8038d4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038d7:	80 f9 01             	cmp    $0x1,%cl
+  8038da:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038dd:	39 d8                	cmp    %ebx,%eax
+  8038df:	75 ed                	jne    8038ce <strncpy+0x14>
+	}
+	return ret;
+}
+  8038e1:	89 f0                	mov    %esi,%eax
+  8038e3:	5b                   	pop    %ebx
+  8038e4:	5e                   	pop    %esi
+  8038e5:	5d                   	pop    %ebp
+  8038e6:	c3                   	ret
+
+008038e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038e7:	55                   	push   %ebp
+  8038e8:	89 e5                	mov    %esp,%ebp
+  8038ea:	56                   	push   %esi
+  8038eb:	53                   	push   %ebx
+  8038ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038f2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8038f5:	89 f0                	mov    %esi,%eax
+  8038f7:	85 d2                	test   %edx,%edx
+  8038f9:	74 21                	je     80391c <strlcpy+0x35>
+  8038fb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8038ff:	89 f2                	mov    %esi,%edx
+  803901:	eb 09                	jmp    80390c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803903:	83 c1 01             	add    $0x1,%ecx
+  803906:	83 c2 01             	add    $0x1,%edx
+  803909:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80390c:	39 c2                	cmp    %eax,%edx
+  80390e:	74 09                	je     803919 <strlcpy+0x32>
+  803910:	0f b6 19             	movzbl (%ecx),%ebx
+  803913:	84 db                	test   %bl,%bl
+  803915:	75 ec                	jne    803903 <strlcpy+0x1c>
+  803917:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  803919:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80391c:	29 f0                	sub    %esi,%eax
+}
+  80391e:	5b                   	pop    %ebx
+  80391f:	5e                   	pop    %esi
+  803920:	5d                   	pop    %ebp
+  803921:	c3                   	ret
+
+00803922 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803922:	55                   	push   %ebp
+  803923:	89 e5                	mov    %esp,%ebp
+  803925:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803928:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80392b:	eb 06                	jmp    803933 <strcmp+0x11>
+		p++, q++;
+  80392d:	83 c1 01             	add    $0x1,%ecx
+  803930:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803933:	0f b6 01             	movzbl (%ecx),%eax
+  803936:	84 c0                	test   %al,%al
+  803938:	74 04                	je     80393e <strcmp+0x1c>
+  80393a:	3a 02                	cmp    (%edx),%al
+  80393c:	74 ef                	je     80392d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80393e:	0f b6 c0             	movzbl %al,%eax
+  803941:	0f b6 12             	movzbl (%edx),%edx
+  803944:	29 d0                	sub    %edx,%eax
+}
+  803946:	5d                   	pop    %ebp
+  803947:	c3                   	ret
+
+00803948 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803948:	55                   	push   %ebp
+  803949:	89 e5                	mov    %esp,%ebp
+  80394b:	53                   	push   %ebx
+  80394c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80394f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803952:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  803955:	eb 09                	jmp    803960 <strncmp+0x18>
+		n--, p++, q++;
+  803957:	83 ea 01             	sub    $0x1,%edx
+  80395a:	83 c0 01             	add    $0x1,%eax
+  80395d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803960:	85 d2                	test   %edx,%edx
+  803962:	74 18                	je     80397c <strncmp+0x34>
+  803964:	0f b6 18             	movzbl (%eax),%ebx
+  803967:	84 db                	test   %bl,%bl
+  803969:	74 04                	je     80396f <strncmp+0x27>
+  80396b:	3a 19                	cmp    (%ecx),%bl
+  80396d:	74 e8                	je     803957 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80396f:	0f b6 00             	movzbl (%eax),%eax
+  803972:	0f b6 11             	movzbl (%ecx),%edx
+  803975:	29 d0                	sub    %edx,%eax
+}
+  803977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+		return 0;
+  80397c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803981:	eb f4                	jmp    803977 <strncmp+0x2f>
+
+00803983 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803983:	55                   	push   %ebp
+  803984:	89 e5                	mov    %esp,%ebp
+  803986:	8b 45 08             	mov    0x8(%ebp),%eax
+  803989:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80398d:	eb 03                	jmp    803992 <strchr+0xf>
+  80398f:	83 c0 01             	add    $0x1,%eax
+  803992:	0f b6 10             	movzbl (%eax),%edx
+  803995:	84 d2                	test   %dl,%dl
+  803997:	74 06                	je     80399f <strchr+0x1c>
+		if (*s == c)
+  803999:	38 ca                	cmp    %cl,%dl
+  80399b:	75 f2                	jne    80398f <strchr+0xc>
+  80399d:	eb 05                	jmp    8039a4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80399f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a4:	5d                   	pop    %ebp
+  8039a5:	c3                   	ret
+
+008039a6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039a6:	55                   	push   %ebp
+  8039a7:	89 e5                	mov    %esp,%ebp
+  8039a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039b0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039b3:	38 ca                	cmp    %cl,%dl
+  8039b5:	74 09                	je     8039c0 <strfind+0x1a>
+  8039b7:	84 d2                	test   %dl,%dl
+  8039b9:	74 05                	je     8039c0 <strfind+0x1a>
+	for (; *s; s++)
+  8039bb:	83 c0 01             	add    $0x1,%eax
+  8039be:	eb f0                	jmp    8039b0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039c0:	5d                   	pop    %ebp
+  8039c1:	c3                   	ret
+
+008039c2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039c2:	55                   	push   %ebp
+  8039c3:	89 e5                	mov    %esp,%ebp
+  8039c5:	57                   	push   %edi
+  8039c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039c9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039cc:	85 c9                	test   %ecx,%ecx
+  8039ce:	74 20                	je     8039f0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039d0:	89 f8                	mov    %edi,%eax
+  8039d2:	09 c8                	or     %ecx,%eax
+  8039d4:	a8 03                	test   $0x3,%al
+  8039d6:	75 12                	jne    8039ea <memset+0x28>
+		c &= 0xFF;
+  8039d8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039dc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039e2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039e5:	fc                   	cld
+  8039e6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039e8:	eb 06                	jmp    8039f0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039ed:	fc                   	cld
+  8039ee:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8039f0:	89 f8                	mov    %edi,%eax
+  8039f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8039f5:	c9                   	leave
+  8039f6:	c3                   	ret
+
+008039f7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8039f7:	55                   	push   %ebp
+  8039f8:	89 e5                	mov    %esp,%ebp
+  8039fa:	57                   	push   %edi
+  8039fb:	56                   	push   %esi
+  8039fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a05:	39 c6                	cmp    %eax,%esi
+  803a07:	73 32                	jae    803a3b <memmove+0x44>
+  803a09:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a0c:	39 d0                	cmp    %edx,%eax
+  803a0e:	73 2b                	jae    803a3b <memmove+0x44>
+		s += n;
+		d += n;
+  803a10:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a13:	89 d6                	mov    %edx,%esi
+  803a15:	09 fe                	or     %edi,%esi
+  803a17:	09 ce                	or     %ecx,%esi
+  803a19:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a1f:	75 0e                	jne    803a2f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a21:	83 ef 04             	sub    $0x4,%edi
+  803a24:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a27:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a2a:	fd                   	std
+  803a2b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a2d:	eb 09                	jmp    803a38 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a2f:	83 ef 01             	sub    $0x1,%edi
+  803a32:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a35:	fd                   	std
+  803a36:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a38:	fc                   	cld
+  803a39:	eb 1a                	jmp    803a55 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a3b:	89 f2                	mov    %esi,%edx
+  803a3d:	09 c2                	or     %eax,%edx
+  803a3f:	09 ca                	or     %ecx,%edx
+  803a41:	f6 c2 03             	test   $0x3,%dl
+  803a44:	75 0a                	jne    803a50 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a46:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a49:	89 c7                	mov    %eax,%edi
+  803a4b:	fc                   	cld
+  803a4c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a4e:	eb 05                	jmp    803a55 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a50:	89 c7                	mov    %eax,%edi
+  803a52:	fc                   	cld
+  803a53:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a55:	5e                   	pop    %esi
+  803a56:	5f                   	pop    %edi
+  803a57:	5d                   	pop    %ebp
+  803a58:	c3                   	ret
+
+00803a59 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a59:	55                   	push   %ebp
+  803a5a:	89 e5                	mov    %esp,%ebp
+  803a5c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a5f:	ff 75 10             	push   0x10(%ebp)
+  803a62:	ff 75 0c             	push   0xc(%ebp)
+  803a65:	ff 75 08             	push   0x8(%ebp)
+  803a68:	e8 8a ff ff ff       	call   8039f7 <memmove>
+}
+  803a6d:	c9                   	leave
+  803a6e:	c3                   	ret
+
+00803a6f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a6f:	55                   	push   %ebp
+  803a70:	89 e5                	mov    %esp,%ebp
+  803a72:	56                   	push   %esi
+  803a73:	53                   	push   %ebx
+  803a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a77:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a7a:	89 c6                	mov    %eax,%esi
+  803a7c:	03 75 10             	add    0x10(%ebp),%esi
+  803a7f:	eb 06                	jmp    803a87 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a81:	83 c0 01             	add    $0x1,%eax
+  803a84:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a87:	39 f0                	cmp    %esi,%eax
+  803a89:	74 14                	je     803a9f <memcmp+0x30>
+		if (*s1 != *s2)
+  803a8b:	0f b6 08             	movzbl (%eax),%ecx
+  803a8e:	0f b6 1a             	movzbl (%edx),%ebx
+  803a91:	38 d9                	cmp    %bl,%cl
+  803a93:	74 ec                	je     803a81 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803a95:	0f b6 c1             	movzbl %cl,%eax
+  803a98:	0f b6 db             	movzbl %bl,%ebx
+  803a9b:	29 d8                	sub    %ebx,%eax
+  803a9d:	eb 05                	jmp    803aa4 <memcmp+0x35>
+	}
+
+	return 0;
+  803a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa4:	5b                   	pop    %ebx
+  803aa5:	5e                   	pop    %esi
+  803aa6:	5d                   	pop    %ebp
+  803aa7:	c3                   	ret
+
+00803aa8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803aa8:	55                   	push   %ebp
+  803aa9:	89 e5                	mov    %esp,%ebp
+  803aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ab1:	89 c2                	mov    %eax,%edx
+  803ab3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803ab6:	eb 03                	jmp    803abb <memfind+0x13>
+  803ab8:	83 c0 01             	add    $0x1,%eax
+  803abb:	39 d0                	cmp    %edx,%eax
+  803abd:	73 04                	jae    803ac3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803abf:	38 08                	cmp    %cl,(%eax)
+  803ac1:	75 f5                	jne    803ab8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803ac3:	5d                   	pop    %ebp
+  803ac4:	c3                   	ret
+
+00803ac5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ac5:	55                   	push   %ebp
+  803ac6:	89 e5                	mov    %esp,%ebp
+  803ac8:	57                   	push   %edi
+  803ac9:	56                   	push   %esi
+  803aca:	53                   	push   %ebx
+  803acb:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ace:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ad1:	eb 03                	jmp    803ad6 <strtol+0x11>
+		s++;
+  803ad3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803ad6:	0f b6 02             	movzbl (%edx),%eax
+  803ad9:	3c 20                	cmp    $0x20,%al
+  803adb:	74 f6                	je     803ad3 <strtol+0xe>
+  803add:	3c 09                	cmp    $0x9,%al
+  803adf:	74 f2                	je     803ad3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803ae1:	3c 2b                	cmp    $0x2b,%al
+  803ae3:	74 2a                	je     803b0f <strtol+0x4a>
+	int neg = 0;
+  803ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803aea:	3c 2d                	cmp    $0x2d,%al
+  803aec:	74 2b                	je     803b19 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803aee:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803af4:	75 0f                	jne    803b05 <strtol+0x40>
+  803af6:	80 3a 30             	cmpb   $0x30,(%edx)
+  803af9:	74 28                	je     803b23 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803afb:	85 db                	test   %ebx,%ebx
+  803afd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b02:	0f 44 d8             	cmove  %eax,%ebx
+  803b05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b0a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b0d:	eb 46                	jmp    803b55 <strtol+0x90>
+		s++;
+  803b0f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b12:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b17:	eb d5                	jmp    803aee <strtol+0x29>
+		s++, neg = 1;
+  803b19:	83 c2 01             	add    $0x1,%edx
+  803b1c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b21:	eb cb                	jmp    803aee <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b23:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b27:	74 0e                	je     803b37 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b29:	85 db                	test   %ebx,%ebx
+  803b2b:	75 d8                	jne    803b05 <strtol+0x40>
+		s++, base = 8;
+  803b2d:	83 c2 01             	add    $0x1,%edx
+  803b30:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b35:	eb ce                	jmp    803b05 <strtol+0x40>
+		s += 2, base = 16;
+  803b37:	83 c2 02             	add    $0x2,%edx
+  803b3a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b3f:	eb c4                	jmp    803b05 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b41:	0f be c0             	movsbl %al,%eax
+  803b44:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b47:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b4a:	7d 3a                	jge    803b86 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b4c:	83 c2 01             	add    $0x1,%edx
+  803b4f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b53:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b55:	0f b6 02             	movzbl (%edx),%eax
+  803b58:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b5b:	89 f3                	mov    %esi,%ebx
+  803b5d:	80 fb 09             	cmp    $0x9,%bl
+  803b60:	76 df                	jbe    803b41 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b62:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b65:	89 f3                	mov    %esi,%ebx
+  803b67:	80 fb 19             	cmp    $0x19,%bl
+  803b6a:	77 08                	ja     803b74 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b6c:	0f be c0             	movsbl %al,%eax
+  803b6f:	83 e8 57             	sub    $0x57,%eax
+  803b72:	eb d3                	jmp    803b47 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b74:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b77:	89 f3                	mov    %esi,%ebx
+  803b79:	80 fb 19             	cmp    $0x19,%bl
+  803b7c:	77 08                	ja     803b86 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b7e:	0f be c0             	movsbl %al,%eax
+  803b81:	83 e8 37             	sub    $0x37,%eax
+  803b84:	eb c1                	jmp    803b47 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b86:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b8a:	74 05                	je     803b91 <strtol+0xcc>
+		*endptr = (char *) s;
+  803b8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b8f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803b91:	89 c8                	mov    %ecx,%eax
+  803b93:	f7 d8                	neg    %eax
+  803b95:	85 ff                	test   %edi,%edi
+  803b97:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803b9a:	89 c8                	mov    %ecx,%eax
+  803b9c:	5b                   	pop    %ebx
+  803b9d:	5e                   	pop    %esi
+  803b9e:	5f                   	pop    %edi
+  803b9f:	5d                   	pop    %ebp
+  803ba0:	c3                   	ret
+
+00803ba1 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803ba1:	55                   	push   %ebp
+  803ba2:	89 e5                	mov    %esp,%ebp
+  803ba4:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803ba7:	6a 00                	push   $0x0
+  803ba9:	6a 00                	push   $0x0
+  803bab:	ff 75 08             	push   0x8(%ebp)
+  803bae:	e8 12 ff ff ff       	call   803ac5 <strtol>
+}
+  803bb3:	c9                   	leave
+  803bb4:	c3                   	ret
+
+00803bb5 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bb5:	55                   	push   %ebp
+  803bb6:	89 e5                	mov    %esp,%ebp
+  803bb8:	57                   	push   %edi
+  803bb9:	56                   	push   %esi
+  803bba:	53                   	push   %ebx
+  803bbb:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bbe:	89 d6                	mov    %edx,%esi
+  803bc0:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bc3:	89 cf                	mov    %ecx,%edi
+  803bc5:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bc8:	89 fa                	mov    %edi,%edx
+  803bca:	80 ce 08             	or     $0x8,%dh
+  803bcd:	f6 c5 08             	test   $0x8,%ch
+  803bd0:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bd3:	57                   	push   %edi
+  803bd4:	56                   	push   %esi
+  803bd5:	50                   	push   %eax
+  803bd6:	56                   	push   %esi
+  803bd7:	6a 00                	push   $0x0
+  803bd9:	e8 41 c6 ff ff       	call   80021f <sys_page_map>
+	if (r < 0) {
+  803bde:	83 c4 20             	add    $0x20,%esp
+  803be1:	85 c0                	test   %eax,%eax
+  803be3:	78 27                	js     803c0c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803be5:	83 ec 0c             	sub    $0xc,%esp
+  803be8:	57                   	push   %edi
+  803be9:	56                   	push   %esi
+  803bea:	6a 00                	push   $0x0
+  803bec:	56                   	push   %esi
+  803bed:	6a 00                	push   $0x0
+  803bef:	e8 2b c6 ff ff       	call   80021f <sys_page_map>
+  803bf4:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803bf6:	83 c4 20             	add    $0x20,%esp
+  803bf9:	85 c0                	test   %eax,%eax
+  803bfb:	78 24                	js     803c21 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803bfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c02:	89 d8                	mov    %ebx,%eax
+  803c04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c07:	5b                   	pop    %ebx
+  803c08:	5e                   	pop    %esi
+  803c09:	5f                   	pop    %edi
+  803c0a:	5d                   	pop    %ebp
+  803c0b:	c3                   	ret
+  803c0c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c0e:	83 ec 08             	sub    $0x8,%esp
+  803c11:	50                   	push   %eax
+  803c12:	68 78 4c 80 00       	push   $0x804c78
+  803c17:	e8 71 f6 ff ff       	call   80328d <cprintf>
+		return r;
+  803c1c:	83 c4 10             	add    $0x10,%esp
+  803c1f:	eb e1                	jmp    803c02 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c21:	83 ec 08             	sub    $0x8,%esp
+  803c24:	50                   	push   %eax
+  803c25:	68 a8 4c 80 00       	push   $0x804ca8
+  803c2a:	e8 5e f6 ff ff       	call   80328d <cprintf>
+		return r;
+  803c2f:	83 c4 10             	add    $0x10,%esp
+  803c32:	eb ce                	jmp    803c02 <duppage_cow+0x4d>
+
+00803c34 <duppage>:
+{
+  803c34:	55                   	push   %ebp
+  803c35:	89 e5                	mov    %esp,%ebp
+  803c37:	53                   	push   %ebx
+  803c38:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c3b:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c3e:	51                   	push   %ecx
+  803c3f:	52                   	push   %edx
+  803c40:	50                   	push   %eax
+  803c41:	52                   	push   %edx
+  803c42:	6a 00                	push   $0x0
+  803c44:	e8 d6 c5 ff ff       	call   80021f <sys_page_map>
+	if (r < 0) {
+  803c49:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c51:	85 c0                	test   %eax,%eax
+  803c53:	78 07                	js     803c5c <duppage+0x28>
+}
+  803c55:	89 d8                	mov    %ebx,%eax
+  803c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+  803c5c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c5e:	83 ec 08             	sub    $0x8,%esp
+  803c61:	50                   	push   %eax
+  803c62:	68 78 4c 80 00       	push   $0x804c78
+  803c67:	e8 21 f6 ff ff       	call   80328d <cprintf>
+		return r;
+  803c6c:	83 c4 10             	add    $0x10,%esp
+  803c6f:	eb e4                	jmp    803c55 <duppage+0x21>
+
+00803c71 <cow_copy>:
+{
+  803c71:	55                   	push   %ebp
+  803c72:	89 e5                	mov    %esp,%ebp
+  803c74:	56                   	push   %esi
+  803c75:	53                   	push   %ebx
+  803c76:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c78:	83 ec 04             	sub    $0x4,%esp
+  803c7b:	6a 07                	push   $0x7
+  803c7d:	68 00 f0 7f 00       	push   $0x7ff000
+  803c82:	6a 00                	push   $0x0
+  803c84:	e8 49 c5 ff ff       	call   8001d2 <sys_page_alloc>
+	if (r < 0) {
+  803c89:	83 c4 10             	add    $0x10,%esp
+  803c8c:	85 c0                	test   %eax,%eax
+  803c8e:	78 58                	js     803ce8 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803c90:	83 ec 04             	sub    $0x4,%esp
+  803c93:	68 00 10 00 00       	push   $0x1000
+  803c98:	56                   	push   %esi
+  803c99:	68 00 f0 7f 00       	push   $0x7ff000
+  803c9e:	e8 54 fd ff ff       	call   8039f7 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803ca3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803caa:	56                   	push   %esi
+  803cab:	6a 00                	push   $0x0
+  803cad:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 66 c5 ff ff       	call   80021f <sys_page_map>
+  803cb9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cbb:	83 c4 20             	add    $0x20,%esp
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	78 3b                	js     803cfd <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cc2:	83 ec 08             	sub    $0x8,%esp
+  803cc5:	68 00 f0 7f 00       	push   $0x7ff000
+  803cca:	6a 00                	push   $0x0
+  803ccc:	e8 9a c5 ff ff       	call   80026b <sys_page_unmap>
+  803cd1:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd3:	83 c4 10             	add    $0x10,%esp
+  803cd6:	85 c0                	test   %eax,%eax
+  803cd8:	78 45                	js     803d1f <cow_copy+0xae>
+	return 0;
+  803cda:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cdf:	89 d8                	mov    %ebx,%eax
+  803ce1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ce4:	5b                   	pop    %ebx
+  803ce5:	5e                   	pop    %esi
+  803ce6:	5d                   	pop    %ebp
+  803ce7:	c3                   	ret
+  803ce8:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803cea:	83 ec 08             	sub    $0x8,%esp
+  803ced:	50                   	push   %eax
+  803cee:	68 98 4d 80 00       	push   $0x804d98
+  803cf3:	e8 95 f5 ff ff       	call   80328d <cprintf>
+		return r;
+  803cf8:	83 c4 10             	add    $0x10,%esp
+  803cfb:	eb e2                	jmp    803cdf <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803cfd:	83 ec 08             	sub    $0x8,%esp
+  803d00:	50                   	push   %eax
+  803d01:	68 b4 4d 80 00       	push   $0x804db4
+  803d06:	e8 82 f5 ff ff       	call   80328d <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d0b:	83 c4 08             	add    $0x8,%esp
+  803d0e:	68 00 f0 7f 00       	push   $0x7ff000
+  803d13:	6a 00                	push   $0x0
+  803d15:	e8 51 c5 ff ff       	call   80026b <sys_page_unmap>
+		return r;
+  803d1a:	83 c4 10             	add    $0x10,%esp
+  803d1d:	eb c0                	jmp    803cdf <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d1f:	83 ec 08             	sub    $0x8,%esp
+  803d22:	50                   	push   %eax
+  803d23:	68 d0 4c 80 00       	push   $0x804cd0
+  803d28:	e8 60 f5 ff ff       	call   80328d <cprintf>
+		return r;
+  803d2d:	83 c4 10             	add    $0x10,%esp
+  803d30:	eb ad                	jmp    803cdf <cow_copy+0x6e>
+
+00803d32 <pgfault>:
+{
+  803d32:	55                   	push   %ebp
+  803d33:	89 e5                	mov    %esp,%ebp
+  803d35:	56                   	push   %esi
+  803d36:	53                   	push   %ebx
+  803d37:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d3a:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d3c:	89 d8                	mov    %ebx,%eax
+  803d3e:	c1 e8 16             	shr    $0x16,%eax
+  803d41:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d48:	89 de                	mov    %ebx,%esi
+  803d4a:	c1 ee 0c             	shr    $0xc,%esi
+  803d4d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d54:	a8 07                	test   $0x7,%al
+  803d56:	74 3b                	je     803d93 <pgfault+0x61>
+  803d58:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d5e:	74 33                	je     803d93 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d60:	83 ec 0c             	sub    $0xc,%esp
+  803d63:	68 00 f0 bf ee       	push   $0xeebff000
+  803d68:	e8 c5 ea ff ff       	call   802832 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d6d:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d74:	83 c4 10             	add    $0x10,%esp
+  803d77:	f6 c4 08             	test   $0x8,%ah
+  803d7a:	75 30                	jne    803dac <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d7c:	83 ec 0c             	sub    $0xc,%esp
+  803d7f:	68 00 f0 bf ee       	push   $0xeebff000
+  803d84:	e8 16 eb ff ff       	call   80289f <mutex_unlock>
+}
+  803d89:	83 c4 10             	add    $0x10,%esp
+  803d8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d8f:	5b                   	pop    %ebx
+  803d90:	5e                   	pop    %esi
+  803d91:	5d                   	pop    %ebp
+  803d92:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803d93:	83 ec 08             	sub    $0x8,%esp
+  803d96:	ff 72 28             	push   0x28(%edx)
+  803d99:	51                   	push   %ecx
+  803d9a:	50                   	push   %eax
+  803d9b:	68 f4 4c 80 00       	push   $0x804cf4
+  803da0:	6a 3f                	push   $0x3f
+  803da2:	68 ce 4d 80 00       	push   $0x804dce
+  803da7:	e8 06 f4 ff ff       	call   8031b2 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dac:	89 d8                	mov    %ebx,%eax
+  803dae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803db3:	e8 b9 fe ff ff       	call   803c71 <cow_copy>
+  803db8:	eb c2                	jmp    803d7c <pgfault+0x4a>
+
+00803dba <cow_enable>:
+{
+  803dba:	55                   	push   %ebp
+  803dbb:	89 e5                	mov    %esp,%ebp
+  803dbd:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dc0:	68 32 3d 80 00       	push   $0x803d32
+  803dc5:	e8 28 06 00 00       	call   8043f2 <set_pgfault_handler>
+}
+  803dca:	83 c4 10             	add    $0x10,%esp
+  803dcd:	c9                   	leave
+  803dce:	c3                   	ret
+
+00803dcf <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dcf:	55                   	push   %ebp
+  803dd0:	89 e5                	mov    %esp,%ebp
+  803dd2:	57                   	push   %edi
+  803dd3:	56                   	push   %esi
+  803dd4:	53                   	push   %ebx
+  803dd5:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803dd8:	68 32 3d 80 00       	push   $0x803d32
+  803ddd:	e8 10 06 00 00       	call   8043f2 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803de2:	b8 07 00 00 00       	mov    $0x7,%eax
+  803de7:	cd 30                	int    $0x30
+  803de9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803dec:	83 c4 10             	add    $0x10,%esp
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	78 4b                	js     803e3e <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803df3:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803df8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803dfd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e00:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e04:	0f 85 16 01 00 00    	jne    803f20 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e0a:	e8 6b c3 ff ff       	call   80017a <sys_getenvid>
+  803e0f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e14:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e16:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e1c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e22:	77 32                	ja     803e56 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e24:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e29:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e2b:	c1 ea 10             	shr    $0x10,%edx
+  803e2e:	74 26                	je     803e56 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e30:	c1 e2 10             	shl    $0x10,%edx
+  803e33:	89 d1                	mov    %edx,%ecx
+  803e35:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e3a:	29 ca                	sub    %ecx,%edx
+  803e3c:	eb 1e                	jmp    803e5c <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e3e:	83 ec 08             	sub    $0x8,%esp
+  803e41:	89 c7                	mov    %eax,%edi
+  803e43:	50                   	push   %eax
+  803e44:	68 d9 4d 80 00       	push   $0x804dd9
+  803e49:	e8 3f f4 ff ff       	call   80328d <cprintf>
+		return eid;
+  803e4e:	83 c4 10             	add    $0x10,%esp
+  803e51:	e9 6c 01 00 00       	jmp    803fc2 <fork+0x1f3>
+		return pthread_main_tls;
+  803e56:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e5c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e5f:	c1 e0 04             	shl    $0x4,%eax
+  803e62:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e67:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e69:	e8 0d f1 ff ff       	call   802f7b <pthread_fork_child>
+		return eid;
+  803e6e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e71:	e9 4c 01 00 00       	jmp    803fc2 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e76:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e7c:	89 da                	mov    %ebx,%edx
+  803e7e:	89 f8                	mov    %edi,%eax
+  803e80:	e8 af fd ff ff       	call   803c34 <duppage>
+  803e85:	85 c0                	test   %eax,%eax
+  803e87:	79 28                	jns    803eb1 <fork+0xe2>
+  803e89:	89 c7                	mov    %eax,%edi
+  803e8b:	e9 32 01 00 00       	jmp    803fc2 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803e90:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e96:	83 f9 05             	cmp    $0x5,%ecx
+  803e99:	75 58                	jne    803ef3 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e9b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ea0:	89 da                	mov    %ebx,%edx
+  803ea2:	89 f8                	mov    %edi,%eax
+  803ea4:	e8 8b fd ff ff       	call   803c34 <duppage>
+  803ea9:	85 c0                	test   %eax,%eax
+  803eab:	0f 88 0f 01 00 00    	js     803fc0 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eb1:	83 c3 01             	add    $0x1,%ebx
+  803eb4:	39 de                	cmp    %ebx,%esi
+  803eb6:	74 54                	je     803f0c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803eb8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ebf:	f6 c1 05             	test   $0x5,%cl
+  803ec2:	74 ed                	je     803eb1 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ec4:	f6 c5 04             	test   $0x4,%ch
+  803ec7:	75 ad                	jne    803e76 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ec9:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ecf:	74 bf                	je     803e90 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ed1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ed7:	74 d8                	je     803eb1 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ed9:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803edf:	89 da                	mov    %ebx,%edx
+  803ee1:	89 f8                	mov    %edi,%eax
+  803ee3:	e8 cd fc ff ff       	call   803bb5 <duppage_cow>
+  803ee8:	85 c0                	test   %eax,%eax
+  803eea:	79 c5                	jns    803eb1 <fork+0xe2>
+  803eec:	89 c7                	mov    %eax,%edi
+  803eee:	e9 cf 00 00 00       	jmp    803fc2 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ef3:	68 24 4d 80 00       	push   $0x804d24
+  803ef8:	68 95 47 80 00       	push   $0x804795
+  803efd:	68 c6 00 00 00       	push   $0xc6
+  803f02:	68 ce 4d 80 00       	push   $0x804dce
+  803f07:	e8 a6 f2 ff ff       	call   8031b2 <_panic>
+  803f0c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f0f:	83 c1 01             	add    $0x1,%ecx
+  803f12:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f18:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f1e:	74 18                	je     803f38 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f20:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f27:	a8 07                	test   $0x7,%al
+  803f29:	74 e4                	je     803f0f <fork+0x140>
+  803f2b:	89 cb                	mov    %ecx,%ebx
+  803f2d:	c1 e3 0a             	shl    $0xa,%ebx
+  803f30:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f33:	e9 7c ff ff ff       	jmp    803eb4 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f38:	83 ec 04             	sub    $0x4,%esp
+  803f3b:	6a 07                	push   $0x7
+  803f3d:	68 00 f0 bf ee       	push   $0xeebff000
+  803f42:	ff 75 e4             	push   -0x1c(%ebp)
+  803f45:	e8 88 c2 ff ff       	call   8001d2 <sys_page_alloc>
+  803f4a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f4c:	83 c4 10             	add    $0x10,%esp
+  803f4f:	85 c0                	test   %eax,%eax
+  803f51:	78 34                	js     803f87 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f53:	83 ec 08             	sub    $0x8,%esp
+  803f56:	68 30 44 80 00       	push   $0x804430
+  803f5b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5e:	e8 ec c3 ff ff       	call   80034f <sys_env_set_pgfault_upcall>
+  803f63:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	78 2e                	js     803f9a <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f6c:	83 ec 08             	sub    $0x8,%esp
+  803f6f:	6a 02                	push   $0x2
+  803f71:	ff 75 e4             	push   -0x1c(%ebp)
+  803f74:	e8 3e c3 ff ff       	call   8002b7 <sys_env_set_status>
+  803f79:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7b:	83 c4 10             	add    $0x10,%esp
+  803f7e:	85 c0                	test   %eax,%eax
+  803f80:	78 2b                	js     803fad <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f82:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f85:	eb 3b                	jmp    803fc2 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f87:	83 ec 08             	sub    $0x8,%esp
+  803f8a:	50                   	push   %eax
+  803f8b:	68 4c 4d 80 00       	push   $0x804d4c
+  803f90:	e8 f8 f2 ff ff       	call   80328d <cprintf>
+		return r;
+  803f95:	83 c4 10             	add    $0x10,%esp
+  803f98:	eb 28                	jmp    803fc2 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803f9a:	83 ec 08             	sub    $0x8,%esp
+  803f9d:	50                   	push   %eax
+  803f9e:	68 74 4d 80 00       	push   $0x804d74
+  803fa3:	e8 e5 f2 ff ff       	call   80328d <cprintf>
+		return r;
+  803fa8:	83 c4 10             	add    $0x10,%esp
+  803fab:	eb 15                	jmp    803fc2 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fad:	83 ec 08             	sub    $0x8,%esp
+  803fb0:	50                   	push   %eax
+  803fb1:	68 e9 4d 80 00       	push   $0x804de9
+  803fb6:	e8 d2 f2 ff ff       	call   80328d <cprintf>
+		return r;
+  803fbb:	83 c4 10             	add    $0x10,%esp
+  803fbe:	eb 02                	jmp    803fc2 <fork+0x1f3>
+  803fc0:	89 c7                	mov    %eax,%edi
+}
+  803fc2:	89 f8                	mov    %edi,%eax
+  803fc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fc7:	5b                   	pop    %ebx
+  803fc8:	5e                   	pop    %esi
+  803fc9:	5f                   	pop    %edi
+  803fca:	5d                   	pop    %ebp
+  803fcb:	c3                   	ret
+
+00803fcc <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fcc:	55                   	push   %ebp
+  803fcd:	89 e5                	mov    %esp,%ebp
+  803fcf:	57                   	push   %edi
+  803fd0:	56                   	push   %esi
+  803fd1:	53                   	push   %ebx
+  803fd2:	83 ec 2c             	sub    $0x2c,%esp
+  803fd5:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fd7:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe2:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803fe8:	77 0a                	ja     803ff4 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fea:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803fef:	29 c3                	sub    %eax,%ebx
+  803ff1:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ff4:	83 ec 0c             	sub    $0xc,%esp
+  803ff7:	68 32 3d 80 00       	push   $0x803d32
+  803ffc:	e8 f1 03 00 00       	call   8043f2 <set_pgfault_handler>
+  804001:	b8 07 00 00 00       	mov    $0x7,%eax
+  804006:	cd 30                	int    $0x30
+  804008:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80400b:	83 c4 10             	add    $0x10,%esp
+  80400e:	85 c0                	test   %eax,%eax
+  804010:	78 30                	js     804042 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804012:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804016:	74 42                	je     80405a <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804018:	c1 e3 10             	shl    $0x10,%ebx
+  80401b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804020:	29 d8                	sub    %ebx,%eax
+  804022:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804025:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80402a:	29 d8                	sub    %ebx,%eax
+  80402c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80402f:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804034:	ba 00 00 00 00       	mov    $0x0,%edx
+  804039:	89 f7                	mov    %esi,%edi
+  80403b:	89 d6                	mov    %edx,%esi
+  80403d:	e9 2c 01 00 00       	jmp    80416e <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804042:	83 ec 08             	sub    $0x8,%esp
+  804045:	89 c7                	mov    %eax,%edi
+  804047:	50                   	push   %eax
+  804048:	68 d9 4d 80 00       	push   $0x804dd9
+  80404d:	e8 3b f2 ff ff       	call   80328d <cprintf>
+		return eid;
+  804052:	83 c4 10             	add    $0x10,%esp
+  804055:	e9 d5 00 00 00       	jmp    80412f <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80405a:	e8 1b c1 ff ff       	call   80017a <sys_getenvid>
+  80405f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804064:	89 c2                	mov    %eax,%edx
+  804066:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804068:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80406e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804073:	77 18                	ja     80408d <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804075:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80407a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80407c:	c1 e8 10             	shr    $0x10,%eax
+  80407f:	74 0c                	je     80408d <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804081:	c1 e0 10             	shl    $0x10,%eax
+  804084:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804089:	29 c1                	sub    %eax,%ecx
+  80408b:	eb 06                	jmp    804093 <sfork+0xc7>
+		return pthread_main_tls;
+  80408d:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804093:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804096:	c1 e0 04             	shl    $0x4,%eax
+  804099:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80409e:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040a0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040a3:	e9 87 00 00 00       	jmp    80412f <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040a8:	f6 c5 04             	test   $0x4,%ch
+  8040ab:	74 6c                	je     804119 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040ad:	89 ca                	mov    %ecx,%edx
+  8040af:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040b5:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040bb:	74 7c                	je     804139 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040bd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040c3:	89 da                	mov    %ebx,%edx
+  8040c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040c8:	e8 67 fb ff ff       	call   803c34 <duppage>
+  8040cd:	85 c0                	test   %eax,%eax
+  8040cf:	0f 88 4f 01 00 00    	js     804224 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040d5:	83 c3 01             	add    $0x1,%ebx
+  8040d8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040db:	74 7a                	je     804157 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040dd:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040df:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040e6:	f6 c1 01             	test   $0x1,%cl
+  8040e9:	74 ea                	je     8040d5 <sfork+0x109>
+  8040eb:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040f1:	74 e2                	je     8040d5 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8040f3:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8040f9:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040fc:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804101:	76 a5                	jbe    8040a8 <sfork+0xdc>
+  804103:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804109:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80410c:	39 fa                	cmp    %edi,%edx
+  80410e:	73 9d                	jae    8040ad <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804110:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804113:	39 fa                	cmp    %edi,%edx
+  804115:	72 96                	jb     8040ad <sfork+0xe1>
+  804117:	eb 8f                	jmp    8040a8 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804119:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80411f:	89 da                	mov    %ebx,%edx
+  804121:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804124:	e8 8c fa ff ff       	call   803bb5 <duppage_cow>
+  804129:	85 c0                	test   %eax,%eax
+  80412b:	79 a8                	jns    8040d5 <sfork+0x109>
+  80412d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80412f:	89 f8                	mov    %edi,%eax
+  804131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804134:	5b                   	pop    %ebx
+  804135:	5e                   	pop    %esi
+  804136:	5f                   	pop    %edi
+  804137:	5d                   	pop    %ebp
+  804138:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804139:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80413e:	e8 2e fb ff ff       	call   803c71 <cow_copy>
+  804143:	85 c0                	test   %eax,%eax
+  804145:	0f 88 d2 00 00 00    	js     80421d <sfork+0x251>
+				pte = uvpt[pn];
+  80414b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804152:	e9 66 ff ff ff       	jmp    8040bd <sfork+0xf1>
+  804157:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80415a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80415d:	83 c6 01             	add    $0x1,%esi
+  804160:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804166:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80416c:	74 1b                	je     804189 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80416e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804175:	a8 01                	test   $0x1,%al
+  804177:	74 e4                	je     80415d <sfork+0x191>
+  804179:	89 f3                	mov    %esi,%ebx
+  80417b:	c1 e3 0a             	shl    $0xa,%ebx
+  80417e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804181:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804184:	e9 4f ff ff ff       	jmp    8040d8 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804189:	83 ec 04             	sub    $0x4,%esp
+  80418c:	6a 07                	push   $0x7
+  80418e:	68 00 f0 bf ee       	push   $0xeebff000
+  804193:	ff 75 e0             	push   -0x20(%ebp)
+  804196:	e8 37 c0 ff ff       	call   8001d2 <sys_page_alloc>
+  80419b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80419d:	83 c4 10             	add    $0x10,%esp
+  8041a0:	85 c0                	test   %eax,%eax
+  8041a2:	78 37                	js     8041db <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041a4:	83 ec 08             	sub    $0x8,%esp
+  8041a7:	68 30 44 80 00       	push   $0x804430
+  8041ac:	ff 75 e0             	push   -0x20(%ebp)
+  8041af:	e8 9b c1 ff ff       	call   80034f <sys_env_set_pgfault_upcall>
+  8041b4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041b6:	83 c4 10             	add    $0x10,%esp
+  8041b9:	85 c0                	test   %eax,%eax
+  8041bb:	78 34                	js     8041f1 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041bd:	83 ec 08             	sub    $0x8,%esp
+  8041c0:	6a 02                	push   $0x2
+  8041c2:	ff 75 e0             	push   -0x20(%ebp)
+  8041c5:	e8 ed c0 ff ff       	call   8002b7 <sys_env_set_status>
+  8041ca:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cc:	83 c4 10             	add    $0x10,%esp
+  8041cf:	85 c0                	test   %eax,%eax
+  8041d1:	78 34                	js     804207 <sfork+0x23b>
+	return eid;
+  8041d3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041d6:	e9 54 ff ff ff       	jmp    80412f <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041db:	83 ec 08             	sub    $0x8,%esp
+  8041de:	50                   	push   %eax
+  8041df:	68 4c 4d 80 00       	push   $0x804d4c
+  8041e4:	e8 a4 f0 ff ff       	call   80328d <cprintf>
+		return r;
+  8041e9:	83 c4 10             	add    $0x10,%esp
+  8041ec:	e9 3e ff ff ff       	jmp    80412f <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041f1:	83 ec 08             	sub    $0x8,%esp
+  8041f4:	50                   	push   %eax
+  8041f5:	68 74 4d 80 00       	push   $0x804d74
+  8041fa:	e8 8e f0 ff ff       	call   80328d <cprintf>
+		return r;
+  8041ff:	83 c4 10             	add    $0x10,%esp
+  804202:	e9 28 ff ff ff       	jmp    80412f <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804207:	83 ec 08             	sub    $0x8,%esp
+  80420a:	50                   	push   %eax
+  80420b:	68 e9 4d 80 00       	push   $0x804de9
+  804210:	e8 78 f0 ff ff       	call   80328d <cprintf>
+		return r;
+  804215:	83 c4 10             	add    $0x10,%esp
+  804218:	e9 12 ff ff ff       	jmp    80412f <sfork+0x163>
+  80421d:	89 c7                	mov    %eax,%edi
+  80421f:	e9 0b ff ff ff       	jmp    80412f <sfork+0x163>
+  804224:	89 c7                	mov    %eax,%edi
+  804226:	e9 04 ff ff ff       	jmp    80412f <sfork+0x163>
+
+0080422b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80422b:	55                   	push   %ebp
+  80422c:	89 e5                	mov    %esp,%ebp
+  80422e:	57                   	push   %edi
+  80422f:	56                   	push   %esi
+  804230:	53                   	push   %ebx
+  804231:	83 ec 18             	sub    $0x18,%esp
+  804234:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804237:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80423a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80423d:	85 c0                	test   %eax,%eax
+  80423f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804244:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804247:	50                   	push   %eax
+  804248:	e8 7b c1 ff ff       	call   8003c8 <sys_ipc_recv>
+	if (r < 0) {
+  80424d:	83 c4 10             	add    $0x10,%esp
+  804250:	85 c0                	test   %eax,%eax
+  804252:	78 2b                	js     80427f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804254:	85 ff                	test   %edi,%edi
+  804256:	74 55                	je     8042ad <ipc_recv+0x82>
+  804258:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80425a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804260:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804265:	77 39                	ja     8042a0 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804267:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80426c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80426e:	c1 e8 10             	shr    $0x10,%eax
+  804271:	74 2d                	je     8042a0 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804273:	c1 e0 10             	shl    $0x10,%eax
+  804276:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80427b:	29 c2                	sub    %eax,%edx
+  80427d:	eb 27                	jmp    8042a6 <ipc_recv+0x7b>
+  80427f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804281:	83 ec 08             	sub    $0x8,%esp
+  804284:	50                   	push   %eax
+  804285:	68 07 4e 80 00       	push   $0x804e07
+  80428a:	e8 fe ef ff ff       	call   80328d <cprintf>
+		*from_env_store = 0;
+  80428f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804295:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80429b:	83 c4 10             	add    $0x10,%esp
+  80429e:	eb 77                	jmp    804317 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042a0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042a6:	8b 02                	mov    (%edx),%eax
+  8042a8:	8b 40 78             	mov    0x78(%eax),%eax
+  8042ab:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042ad:	85 f6                	test   %esi,%esi
+  8042af:	74 34                	je     8042e5 <ipc_recv+0xba>
+  8042b1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042b9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042be:	77 18                	ja     8042d8 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042c5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042c7:	c1 e8 10             	shr    $0x10,%eax
+  8042ca:	74 0c                	je     8042d8 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042cc:	c1 e0 10             	shl    $0x10,%eax
+  8042cf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042d4:	29 c2                	sub    %eax,%edx
+  8042d6:	eb 06                	jmp    8042de <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042d8:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042de:	8b 02                	mov    (%edx),%eax
+  8042e0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042e3:	89 06                	mov    %eax,(%esi)
+  8042e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f2:	77 18                	ja     80430c <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042fb:	c1 e8 10             	shr    $0x10,%eax
+  8042fe:	74 0c                	je     80430c <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804300:	c1 e0 10             	shl    $0x10,%eax
+  804303:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804308:	29 c2                	sub    %eax,%edx
+  80430a:	eb 06                	jmp    804312 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80430c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804312:	8b 02                	mov    (%edx),%eax
+  804314:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804317:	89 d8                	mov    %ebx,%eax
+  804319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80431c:	5b                   	pop    %ebx
+  80431d:	5e                   	pop    %esi
+  80431e:	5f                   	pop    %edi
+  80431f:	5d                   	pop    %ebp
+  804320:	c3                   	ret
+
+00804321 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804321:	55                   	push   %ebp
+  804322:	89 e5                	mov    %esp,%ebp
+  804324:	57                   	push   %edi
+  804325:	56                   	push   %esi
+  804326:	53                   	push   %ebx
+  804327:	83 ec 0c             	sub    $0xc,%esp
+  80432a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80432d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804330:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804333:	85 db                	test   %ebx,%ebx
+  804335:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80433a:	0f 44 d8             	cmove  %eax,%ebx
+  80433d:	eb 05                	jmp    804344 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80433f:	e8 62 be ff ff       	call   8001a6 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804344:	57                   	push   %edi
+  804345:	53                   	push   %ebx
+  804346:	ff 75 0c             	push   0xc(%ebp)
+  804349:	56                   	push   %esi
+  80434a:	e8 4c c0 ff ff       	call   80039b <sys_ipc_try_send>
+		if (r == 0) {
+  80434f:	83 c4 10             	add    $0x10,%esp
+  804352:	85 c0                	test   %eax,%eax
+  804354:	74 19                	je     80436f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804356:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804359:	74 e4                	je     80433f <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80435b:	83 ec 0c             	sub    $0xc,%esp
+  80435e:	50                   	push   %eax
+  80435f:	57                   	push   %edi
+  804360:	53                   	push   %ebx
+  804361:	56                   	push   %esi
+  804362:	68 20 4e 80 00       	push   $0x804e20
+  804367:	e8 21 ef ff ff       	call   80328d <cprintf>
+			return;
+  80436c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80436f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804372:	5b                   	pop    %ebx
+  804373:	5e                   	pop    %esi
+  804374:	5f                   	pop    %edi
+  804375:	5d                   	pop    %ebp
+  804376:	c3                   	ret
+
+00804377 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804377:	55                   	push   %ebp
+  804378:	89 e5                	mov    %esp,%ebp
+  80437a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80437d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804382:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804385:	c1 e0 04             	shl    $0x4,%eax
+  804388:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80438d:	8b 40 50             	mov    0x50(%eax),%eax
+  804390:	39 c8                	cmp    %ecx,%eax
+  804392:	74 12                	je     8043a6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804394:	83 c2 01             	add    $0x1,%edx
+  804397:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80439d:	75 e3                	jne    804382 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80439f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a4:	eb 0e                	jmp    8043b4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043a6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043a9:	c1 e0 04             	shl    $0x4,%eax
+  8043ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043b1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043b4:	5d                   	pop    %ebp
+  8043b5:	c3                   	ret
+
+008043b6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043b6:	55                   	push   %ebp
+  8043b7:	89 e5                	mov    %esp,%ebp
+  8043b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043bc:	89 c2                	mov    %eax,%edx
+  8043be:	c1 ea 16             	shr    $0x16,%edx
+  8043c1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043c8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043cd:	f6 c1 01             	test   $0x1,%cl
+  8043d0:	74 1c                	je     8043ee <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043d2:	c1 e8 0c             	shr    $0xc,%eax
+  8043d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043dc:	a8 01                	test   $0x1,%al
+  8043de:	74 0e                	je     8043ee <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043e0:	c1 e8 0c             	shr    $0xc,%eax
+  8043e3:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043ea:	ef 
+  8043eb:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043ee:	89 d0                	mov    %edx,%eax
+  8043f0:	5d                   	pop    %ebp
+  8043f1:	c3                   	ret
+
+008043f2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043f2:	55                   	push   %ebp
+  8043f3:	89 e5                	mov    %esp,%ebp
+  8043f5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8043f8:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8043ff:	74 0a                	je     80440b <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804401:	8b 45 08             	mov    0x8(%ebp),%eax
+  804404:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804409:	c9                   	leave
+  80440a:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80440b:	83 ec 04             	sub    $0x4,%esp
+  80440e:	6a 07                	push   $0x7
+  804410:	68 00 f0 bf ee       	push   $0xeebff000
+  804415:	6a 00                	push   $0x0
+  804417:	e8 b6 bd ff ff       	call   8001d2 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80441c:	83 c4 08             	add    $0x8,%esp
+  80441f:	68 30 44 80 00       	push   $0x804430
+  804424:	6a 00                	push   $0x0
+  804426:	e8 24 bf ff ff       	call   80034f <sys_env_set_pgfault_upcall>
+  80442b:	83 c4 10             	add    $0x10,%esp
+  80442e:	eb d1                	jmp    804401 <set_pgfault_handler+0xf>
+
+00804430 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804430:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804431:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804436:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804438:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80443b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80443f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804443:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804446:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80444a:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80444c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80444f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804450:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804453:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804454:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804455:	c3                   	ret
+
+00804456 <udm>:
+  804456:	57                   	push   %edi
+  804457:	56                   	push   %esi
+  804458:	53                   	push   %ebx
+  804459:	83 ec 20             	sub    $0x20,%esp
+  80445c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804460:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804464:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804468:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80446c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804470:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804474:	89 d1                	mov    %edx,%ecx
+  804476:	09 c1                	or     %eax,%ecx
+  804478:	0f 84 91 00 00 00    	je     80450f <udm+0xb9>
+  80447e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804483:	ba 00 00 00 00       	mov    $0x0,%edx
+  804488:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80448d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804494:	00 
+  804495:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80449c:	00 
+  80449d:	eb 08                	jmp    8044a7 <udm+0x51>
+  80449f:	83 e9 01             	sub    $0x1,%ecx
+  8044a2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044a5:	74 7c                	je     804523 <udm+0xcd>
+  8044a7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044ab:	01 c0                	add    %eax,%eax
+  8044ad:	89 c6                	mov    %eax,%esi
+  8044af:	89 d7                	mov    %edx,%edi
+  8044b1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044b5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044b9:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044bc:	d3 ea                	shr    %cl,%edx
+  8044be:	f6 c1 20             	test   $0x20,%cl
+  8044c1:	74 04                	je     8044c7 <udm+0x71>
+  8044c3:	89 d0                	mov    %edx,%eax
+  8044c5:	31 d2                	xor    %edx,%edx
+  8044c7:	83 e0 01             	and    $0x1,%eax
+  8044ca:	89 04 24             	mov    %eax,(%esp)
+  8044cd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044d4:	00 
+  8044d5:	8b 04 24             	mov    (%esp),%eax
+  8044d8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044dc:	09 f0                	or     %esi,%eax
+  8044de:	09 fa                	or     %edi,%edx
+  8044e0:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044e4:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044e8:	39 f0                	cmp    %esi,%eax
+  8044ea:	89 d3                	mov    %edx,%ebx
+  8044ec:	19 fb                	sbb    %edi,%ebx
+  8044ee:	72 af                	jb     80449f <udm+0x49>
+  8044f0:	29 f0                	sub    %esi,%eax
+  8044f2:	19 fa                	sbb    %edi,%edx
+  8044f4:	89 cf                	mov    %ecx,%edi
+  8044f6:	c1 ef 05             	shr    $0x5,%edi
+  8044f9:	83 e7 01             	and    $0x1,%edi
+  8044fc:	89 fe                	mov    %edi,%esi
+  8044fe:	83 f6 01             	xor    $0x1,%esi
+  804501:	d3 e6                	shl    %cl,%esi
+  804503:	d3 e7                	shl    %cl,%edi
+  804505:	09 74 24 18          	or     %esi,0x18(%esp)
+  804509:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80450d:	eb 90                	jmp    80449f <udm+0x49>
+  80450f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804513:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804517:	89 f0                	mov    %esi,%eax
+  804519:	89 fa                	mov    %edi,%edx
+  80451b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80451f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804523:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804527:	89 01                	mov    %eax,(%ecx)
+  804529:	89 51 04             	mov    %edx,0x4(%ecx)
+  80452c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804530:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804534:	83 c4 20             	add    $0x20,%esp
+  804537:	5b                   	pop    %ebx
+  804538:	5e                   	pop    %esi
+  804539:	5f                   	pop    %edi
+  80453a:	c3                   	ret
+
+0080453b <__udivdi3>:
+  80453b:	83 ec 18             	sub    $0x18,%esp
+  80453e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804542:	50                   	push   %eax
+  804543:	ff 74 24 2c          	push   0x2c(%esp)
+  804547:	ff 74 24 2c          	push   0x2c(%esp)
+  80454b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80454f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804553:	e8 fe fe ff ff       	call   804456 <udm>
+  804558:	83 c4 24             	add    $0x24,%esp
+  80455b:	c3                   	ret
+
+0080455c <__umoddi3>:
+  80455c:	83 ec 18             	sub    $0x18,%esp
+  80455f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804563:	50                   	push   %eax
+  804564:	ff 74 24 2c          	push   0x2c(%esp)
+  804568:	ff 74 24 2c          	push   0x2c(%esp)
+  80456c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804570:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804574:	e8 dd fe ff ff       	call   804456 <udm>
+  804579:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80457d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804581:	83 c4 24             	add    $0x24,%esp
+  804584:	c3                   	ret
+
+00804585 <__divdi3>:
+  804585:	56                   	push   %esi
+  804586:	53                   	push   %ebx
+  804587:	83 ec 14             	sub    $0x14,%esp
+  80458a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80458e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804592:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804596:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80459a:	85 d2                	test   %edx,%edx
+  80459c:	78 18                	js     8045b6 <__divdi3+0x31>
+  80459e:	85 db                	test   %ebx,%ebx
+  8045a0:	78 3e                	js     8045e0 <__divdi3+0x5b>
+  8045a2:	83 ec 04             	sub    $0x4,%esp
+  8045a5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045a9:	56                   	push   %esi
+  8045aa:	53                   	push   %ebx
+  8045ab:	51                   	push   %ecx
+  8045ac:	e8 a5 fe ff ff       	call   804456 <udm>
+  8045b1:	83 c4 10             	add    $0x10,%esp
+  8045b4:	eb 24                	jmp    8045da <__divdi3+0x55>
+  8045b6:	f7 d8                	neg    %eax
+  8045b8:	83 d2 00             	adc    $0x0,%edx
+  8045bb:	f7 da                	neg    %edx
+  8045bd:	85 db                	test   %ebx,%ebx
+  8045bf:	78 3a                	js     8045fb <__divdi3+0x76>
+  8045c1:	83 ec 04             	sub    $0x4,%esp
+  8045c4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c8:	56                   	push   %esi
+  8045c9:	53                   	push   %ebx
+  8045ca:	51                   	push   %ecx
+  8045cb:	e8 86 fe ff ff       	call   804456 <udm>
+  8045d0:	83 c4 10             	add    $0x10,%esp
+  8045d3:	f7 d8                	neg    %eax
+  8045d5:	83 d2 00             	adc    $0x0,%edx
+  8045d8:	f7 da                	neg    %edx
+  8045da:	83 c4 14             	add    $0x14,%esp
+  8045dd:	5b                   	pop    %ebx
+  8045de:	5e                   	pop    %esi
+  8045df:	c3                   	ret
+  8045e0:	83 ec 04             	sub    $0x4,%esp
+  8045e3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e7:	56                   	push   %esi
+  8045e8:	f7 d9                	neg    %ecx
+  8045ea:	83 d3 00             	adc    $0x0,%ebx
+  8045ed:	f7 db                	neg    %ebx
+  8045ef:	53                   	push   %ebx
+  8045f0:	51                   	push   %ecx
+  8045f1:	e8 60 fe ff ff       	call   804456 <udm>
+  8045f6:	83 c4 10             	add    $0x10,%esp
+  8045f9:	eb d8                	jmp    8045d3 <__divdi3+0x4e>
+  8045fb:	83 ec 04             	sub    $0x4,%esp
+  8045fe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804602:	56                   	push   %esi
+  804603:	f7 d9                	neg    %ecx
+  804605:	83 d3 00             	adc    $0x0,%ebx
+  804608:	f7 db                	neg    %ebx
+  80460a:	53                   	push   %ebx
+  80460b:	51                   	push   %ecx
+  80460c:	e8 45 fe ff ff       	call   804456 <udm>
+  804611:	83 c4 10             	add    $0x10,%esp
+  804614:	eb c4                	jmp    8045da <__divdi3+0x55>
+
+00804616 <__moddi3>:
+  804616:	55                   	push   %ebp
+  804617:	57                   	push   %edi
+  804618:	56                   	push   %esi
+  804619:	53                   	push   %ebx
+  80461a:	83 ec 24             	sub    $0x24,%esp
+  80461d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804621:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804625:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804629:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80462d:	85 d2                	test   %edx,%edx
+  80462f:	78 3b                	js     80466c <__moddi3+0x56>
+  804631:	83 ec 04             	sub    $0x4,%esp
+  804634:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804638:	56                   	push   %esi
+  804639:	89 ce                	mov    %ecx,%esi
+  80463b:	f7 de                	neg    %esi
+  80463d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804641:	89 de                	mov    %ebx,%esi
+  804643:	83 d6 00             	adc    $0x0,%esi
+  804646:	f7 de                	neg    %esi
+  804648:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80464c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804650:	0f 48 f1             	cmovs  %ecx,%esi
+  804653:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804658:	53                   	push   %ebx
+  804659:	56                   	push   %esi
+  80465a:	e8 f7 fd ff ff       	call   804456 <udm>
+  80465f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804663:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804667:	83 c4 10             	add    $0x10,%esp
+  80466a:	eb 47                	jmp    8046b3 <__moddi3+0x9d>
+  80466c:	f7 d8                	neg    %eax
+  80466e:	83 d2 00             	adc    $0x0,%edx
+  804671:	f7 da                	neg    %edx
+  804673:	83 ec 04             	sub    $0x4,%esp
+  804676:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80467a:	56                   	push   %esi
+  80467b:	89 cf                	mov    %ecx,%edi
+  80467d:	f7 df                	neg    %edi
+  80467f:	89 de                	mov    %ebx,%esi
+  804681:	83 d6 00             	adc    $0x0,%esi
+  804684:	f7 de                	neg    %esi
+  804686:	0f 49 cf             	cmovns %edi,%ecx
+  804689:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80468d:	0f 49 de             	cmovns %esi,%ebx
+  804690:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804694:	ff 74 24 0c          	push   0xc(%esp)
+  804698:	ff 74 24 0c          	push   0xc(%esp)
+  80469c:	e8 b5 fd ff ff       	call   804456 <udm>
+  8046a1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046a5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046a9:	f7 d8                	neg    %eax
+  8046ab:	83 d2 00             	adc    $0x0,%edx
+  8046ae:	f7 da                	neg    %edx
+  8046b0:	83 c4 10             	add    $0x10,%esp
+  8046b3:	83 c4 24             	add    $0x24,%esp
+  8046b6:	5b                   	pop    %ebx
+  8046b7:	5e                   	pop    %esi
+  8046b8:	5f                   	pop    %edi
+  8046b9:	5d                   	pop    %ebp
+  8046ba:	c3                   	ret
@@ -0,0 +1,9687 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 a8 00 00 00       	call   8000ea <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	57                   	push   %edi
+  80004b:	56                   	push   %esi
+  80004c:	53                   	push   %ebx
+  80004d:	83 ec 1c             	sub    $0x1c,%esp
+  800050:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800053:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800056:	e8 31 01 00 00       	call   80018c <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80005b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80005e:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80006b:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80006d:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800073:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800078:	77 16                	ja     800090 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80007a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80007f:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800081:	c1 e8 10             	shr    $0x10,%eax
+  800084:	74 0a                	je     800090 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800086:	c1 e0 10             	shl    $0x10,%eax
+  800089:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80008e:	29 c2                	sub    %eax,%edx
+  800090:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800093:	c1 e0 04             	shl    $0x4,%eax
+  800096:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009b:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80009d:	85 db                	test   %ebx,%ebx
+  80009f:	7e 07                	jle    8000a8 <libmain+0x61>
+		binaryname = argv[0];
+  8000a1:	8b 06                	mov    (%esi),%eax
+  8000a3:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000a8:	83 ec 08             	sub    $0x8,%esp
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	e8 81 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b2:	e8 0b 00 00 00       	call   8000c2 <exit>
+}
+  8000b7:	83 c4 10             	add    $0x10,%esp
+  8000ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bd:	5b                   	pop    %ebx
+  8000be:	5e                   	pop    %esi
+  8000bf:	5f                   	pop    %edi
+  8000c0:	5d                   	pop    %ebp
+  8000c1:	c3                   	ret
+
+008000c2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c2:	55                   	push   %ebp
+  8000c3:	89 e5                	mov    %esp,%ebp
+  8000c5:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000c8:	6a 00                	push   $0x0
+  8000ca:	e8 12 17 00 00       	call   8017e1 <fflush>
+	pthread_kill_others();
+  8000cf:	e8 7d 2d 00 00       	call   802e51 <pthread_kill_others>
+	close_all();
+  8000d4:	e8 ab 07 00 00       	call   800884 <close_all>
+	sys_env_destroy(0);
+  8000d9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000e0:	e8 5c 00 00 00       	call   800141 <sys_env_destroy>
+}
+  8000e5:	83 c4 10             	add    $0x10,%esp
+  8000e8:	c9                   	leave
+  8000e9:	c3                   	ret
+
+008000ea <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	57                   	push   %edi
+  8000ee:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000fa:	89 c3                	mov    %eax,%ebx
+  8000fc:	89 c7                	mov    %eax,%edi
+  8000fe:	6a 00                	push   $0x0
+  800100:	55                   	push   %ebp
+  800101:	56                   	push   %esi
+  800102:	89 e5                	mov    %esp,%ebp
+  800104:	8d 35 0c 01 80 00    	lea    0x80010c,%esi
+  80010a:	0f 34                	sysenter
+
+0080010c <after_sysenter_label_47>:
+  80010c:	5e                   	pop    %esi
+  80010d:	5d                   	pop    %ebp
+  80010e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800111:	5b                   	pop    %ebx
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+
+00800115 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	57                   	push   %edi
+  800119:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80011a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800124:	89 d1                	mov    %edx,%ecx
+  800126:	89 d3                	mov    %edx,%ebx
+  800128:	89 d7                	mov    %edx,%edi
+  80012a:	6a 00                	push   $0x0
+  80012c:	55                   	push   %ebp
+  80012d:	56                   	push   %esi
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	8d 35 38 01 80 00    	lea    0x800138,%esi
+  800136:	0f 34                	sysenter
+
+00800138 <after_sysenter_label_128>:
+  800138:	5e                   	pop    %esi
+  800139:	5d                   	pop    %ebp
+  80013a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80013d:	5b                   	pop    %ebx
+  80013e:	5f                   	pop    %edi
+  80013f:	5d                   	pop    %ebp
+  800140:	c3                   	ret
+
+00800141 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	57                   	push   %edi
+  800145:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800146:	8b 55 08             	mov    0x8(%ebp),%edx
+  800149:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80014e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800153:	89 cb                	mov    %ecx,%ebx
+  800155:	89 cf                	mov    %ecx,%edi
+  800157:	6a 00                	push   $0x0
+  800159:	55                   	push   %ebp
+  80015a:	56                   	push   %esi
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	8d 35 65 01 80 00    	lea    0x800165,%esi
+  800163:	0f 34                	sysenter
+
+00800165 <after_sysenter_label_212>:
+  800165:	5e                   	pop    %esi
+  800166:	5d                   	pop    %ebp
+  800167:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80016a:	85 c0                	test   %eax,%eax
+  80016c:	7f 07                	jg     800175 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80016e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800171:	5b                   	pop    %ebx
+  800172:	5f                   	pop    %edi
+  800173:	5d                   	pop    %ebp
+  800174:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	50                   	push   %eax
+  800179:	6a 03                	push   $0x3
+  80017b:	68 ea 46 80 00       	push   $0x8046ea
+  800180:	6a 54                	push   $0x54
+  800182:	68 07 47 80 00       	push   $0x804707
+  800187:	e8 38 30 00 00       	call   8031c4 <_panic>
+
+0080018c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800191:	ba 00 00 00 00       	mov    $0x0,%edx
+  800196:	b8 02 00 00 00       	mov    $0x2,%eax
+  80019b:	89 d1                	mov    %edx,%ecx
+  80019d:	89 d3                	mov    %edx,%ebx
+  80019f:	89 d7                	mov    %edx,%edi
+  8001a1:	6a 00                	push   $0x0
+  8001a3:	55                   	push   %ebp
+  8001a4:	56                   	push   %esi
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	8d 35 af 01 80 00    	lea    0x8001af,%esi
+  8001ad:	0f 34                	sysenter
+
+008001af <after_sysenter_label_309>:
+  8001af:	5e                   	pop    %esi
+  8001b0:	5d                   	pop    %ebp
+  8001b1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001b4:	5b                   	pop    %ebx
+  8001b5:	5f                   	pop    %edi
+  8001b6:	5d                   	pop    %ebp
+  8001b7:	c3                   	ret
+
+008001b8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	57                   	push   %edi
+  8001bc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001c7:	89 d1                	mov    %edx,%ecx
+  8001c9:	89 d3                	mov    %edx,%ebx
+  8001cb:	89 d7                	mov    %edx,%edi
+  8001cd:	6a 00                	push   $0x0
+  8001cf:	55                   	push   %ebp
+  8001d0:	56                   	push   %esi
+  8001d1:	89 e5                	mov    %esp,%ebp
+  8001d3:	8d 35 db 01 80 00    	lea    0x8001db,%esi
+  8001d9:	0f 34                	sysenter
+
+008001db <after_sysenter_label_391>:
+  8001db:	5e                   	pop    %esi
+  8001dc:	5d                   	pop    %ebp
+  8001dd:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001e0:	5b                   	pop    %ebx
+  8001e1:	5f                   	pop    %edi
+  8001e2:	5d                   	pop    %ebp
+  8001e3:	c3                   	ret
+
+008001e4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001e4:	55                   	push   %ebp
+  8001e5:	89 e5                	mov    %esp,%ebp
+  8001e7:	57                   	push   %edi
+  8001e8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ef:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fc:	6a 00                	push   $0x0
+  8001fe:	55                   	push   %ebp
+  8001ff:	56                   	push   %esi
+  800200:	89 e5                	mov    %esp,%ebp
+  800202:	8d 35 0a 02 80 00    	lea    0x80020a,%esi
+  800208:	0f 34                	sysenter
+
+0080020a <after_sysenter_label_479>:
+  80020a:	5e                   	pop    %esi
+  80020b:	5d                   	pop    %ebp
+  80020c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80020f:	85 c0                	test   %eax,%eax
+  800211:	7f 07                	jg     80021a <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800213:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800216:	5b                   	pop    %ebx
+  800217:	5f                   	pop    %edi
+  800218:	5d                   	pop    %ebp
+  800219:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021a:	83 ec 0c             	sub    $0xc,%esp
+  80021d:	50                   	push   %eax
+  80021e:	6a 04                	push   $0x4
+  800220:	68 ea 46 80 00       	push   $0x8046ea
+  800225:	6a 54                	push   $0x54
+  800227:	68 07 47 80 00       	push   $0x804707
+  80022c:	e8 93 2f 00 00       	call   8031c4 <_panic>
+
+00800231 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	57                   	push   %edi
+  800235:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800236:	8b 55 08             	mov    0x8(%ebp),%edx
+  800239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800241:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800244:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800247:	ff 75 18             	push   0x18(%ebp)
+  80024a:	55                   	push   %ebp
+  80024b:	56                   	push   %esi
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	8d 35 56 02 80 00    	lea    0x800256,%esi
+  800254:	0f 34                	sysenter
+
+00800256 <after_sysenter_label_593>:
+  800256:	5e                   	pop    %esi
+  800257:	5d                   	pop    %ebp
+  800258:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80025b:	85 c0                	test   %eax,%eax
+  80025d:	7f 07                	jg     800266 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80025f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800262:	5b                   	pop    %ebx
+  800263:	5f                   	pop    %edi
+  800264:	5d                   	pop    %ebp
+  800265:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800266:	83 ec 0c             	sub    $0xc,%esp
+  800269:	50                   	push   %eax
+  80026a:	6a 05                	push   $0x5
+  80026c:	68 ea 46 80 00       	push   $0x8046ea
+  800271:	6a 54                	push   $0x54
+  800273:	68 07 47 80 00       	push   $0x804707
+  800278:	e8 47 2f 00 00       	call   8031c4 <_panic>
+
+0080027d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	57                   	push   %edi
+  800281:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800282:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800292:	89 df                	mov    %ebx,%edi
+  800294:	6a 00                	push   $0x0
+  800296:	55                   	push   %ebp
+  800297:	56                   	push   %esi
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	8d 35 a2 02 80 00    	lea    0x8002a2,%esi
+  8002a0:	0f 34                	sysenter
+
+008002a2 <after_sysenter_label_704>:
+  8002a2:	5e                   	pop    %esi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	7f 07                	jg     8002b2 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002ae:	5b                   	pop    %ebx
+  8002af:	5f                   	pop    %edi
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+  8002b5:	50                   	push   %eax
+  8002b6:	6a 06                	push   $0x6
+  8002b8:	68 ea 46 80 00       	push   $0x8046ea
+  8002bd:	6a 54                	push   $0x54
+  8002bf:	68 07 47 80 00       	push   $0x804707
+  8002c4:	e8 fb 2e 00 00       	call   8031c4 <_panic>
+
+008002c9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	57                   	push   %edi
+  8002cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002de:	89 df                	mov    %ebx,%edi
+  8002e0:	6a 00                	push   $0x0
+  8002e2:	55                   	push   %ebp
+  8002e3:	56                   	push   %esi
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	8d 35 ee 02 80 00    	lea    0x8002ee,%esi
+  8002ec:	0f 34                	sysenter
+
+008002ee <after_sysenter_label_808>:
+  8002ee:	5e                   	pop    %esi
+  8002ef:	5d                   	pop    %ebp
+  8002f0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002f3:	85 c0                	test   %eax,%eax
+  8002f5:	7f 07                	jg     8002fe <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002fa:	5b                   	pop    %ebx
+  8002fb:	5f                   	pop    %edi
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+  800301:	50                   	push   %eax
+  800302:	6a 08                	push   $0x8
+  800304:	68 ea 46 80 00       	push   $0x8046ea
+  800309:	6a 54                	push   $0x54
+  80030b:	68 07 47 80 00       	push   $0x804707
+  800310:	e8 af 2e 00 00       	call   8031c4 <_panic>
+
+00800315 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	57                   	push   %edi
+  800319:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80031a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80031f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800325:	b8 09 00 00 00       	mov    $0x9,%eax
+  80032a:	89 df                	mov    %ebx,%edi
+  80032c:	6a 00                	push   $0x0
+  80032e:	55                   	push   %ebp
+  80032f:	56                   	push   %esi
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	8d 35 3a 03 80 00    	lea    0x80033a,%esi
+  800338:	0f 34                	sysenter
+
+0080033a <after_sysenter_label_912>:
+  80033a:	5e                   	pop    %esi
+  80033b:	5d                   	pop    %ebp
+  80033c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80033f:	85 c0                	test   %eax,%eax
+  800341:	7f 07                	jg     80034a <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800343:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800346:	5b                   	pop    %ebx
+  800347:	5f                   	pop    %edi
+  800348:	5d                   	pop    %ebp
+  800349:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80034a:	83 ec 0c             	sub    $0xc,%esp
+  80034d:	50                   	push   %eax
+  80034e:	6a 09                	push   $0x9
+  800350:	68 ea 46 80 00       	push   $0x8046ea
+  800355:	6a 54                	push   $0x54
+  800357:	68 07 47 80 00       	push   $0x804707
+  80035c:	e8 63 2e 00 00       	call   8031c4 <_panic>
+
+00800361 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800361:	55                   	push   %ebp
+  800362:	89 e5                	mov    %esp,%ebp
+  800364:	57                   	push   %edi
+  800365:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800371:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800376:	89 df                	mov    %ebx,%edi
+  800378:	6a 00                	push   $0x0
+  80037a:	55                   	push   %ebp
+  80037b:	56                   	push   %esi
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	8d 35 86 03 80 00    	lea    0x800386,%esi
+  800384:	0f 34                	sysenter
+
+00800386 <after_sysenter_label_1016>:
+  800386:	5e                   	pop    %esi
+  800387:	5d                   	pop    %ebp
+  800388:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80038b:	85 c0                	test   %eax,%eax
+  80038d:	7f 07                	jg     800396 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80038f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800392:	5b                   	pop    %ebx
+  800393:	5f                   	pop    %edi
+  800394:	5d                   	pop    %ebp
+  800395:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800396:	83 ec 0c             	sub    $0xc,%esp
+  800399:	50                   	push   %eax
+  80039a:	6a 0a                	push   $0xa
+  80039c:	68 ea 46 80 00       	push   $0x8046ea
+  8003a1:	6a 54                	push   $0x54
+  8003a3:	68 07 47 80 00       	push   $0x804707
+  8003a8:	e8 17 2e 00 00       	call   8031c4 <_panic>
+
+008003ad <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003c3:	6a 00                	push   $0x0
+  8003c5:	55                   	push   %ebp
+  8003c6:	56                   	push   %esi
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	8d 35 d1 03 80 00    	lea    0x8003d1,%esi
+  8003cf:	0f 34                	sysenter
+
+008003d1 <after_sysenter_label_1126>:
+  8003d1:	5e                   	pop    %esi
+  8003d2:	5d                   	pop    %ebp
+  8003d3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003d6:	5b                   	pop    %ebx
+  8003d7:	5f                   	pop    %edi
+  8003d8:	5d                   	pop    %ebp
+  8003d9:	c3                   	ret
+
+008003da <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003da:	55                   	push   %ebp
+  8003db:	89 e5                	mov    %esp,%ebp
+  8003dd:	57                   	push   %edi
+  8003de:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003e7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ec:	89 cb                	mov    %ecx,%ebx
+  8003ee:	89 cf                	mov    %ecx,%edi
+  8003f0:	6a 00                	push   $0x0
+  8003f2:	55                   	push   %ebp
+  8003f3:	56                   	push   %esi
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	8d 35 fe 03 80 00    	lea    0x8003fe,%esi
+  8003fc:	0f 34                	sysenter
+
+008003fe <after_sysenter_label_1210>:
+  8003fe:	5e                   	pop    %esi
+  8003ff:	5d                   	pop    %ebp
+  800400:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800403:	85 c0                	test   %eax,%eax
+  800405:	7f 07                	jg     80040e <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80040a:	5b                   	pop    %ebx
+  80040b:	5f                   	pop    %edi
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80040e:	83 ec 0c             	sub    $0xc,%esp
+  800411:	50                   	push   %eax
+  800412:	6a 0d                	push   $0xd
+  800414:	68 ea 46 80 00       	push   $0x8046ea
+  800419:	6a 54                	push   $0x54
+  80041b:	68 07 47 80 00       	push   $0x804707
+  800420:	e8 9f 2d 00 00       	call   8031c4 <_panic>
+
+00800425 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800425:	55                   	push   %ebp
+  800426:	89 e5                	mov    %esp,%ebp
+  800428:	57                   	push   %edi
+  800429:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80042a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800432:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800435:	b8 42 00 00 00       	mov    $0x42,%eax
+  80043a:	89 df                	mov    %ebx,%edi
+  80043c:	6a 00                	push   $0x0
+  80043e:	55                   	push   %ebp
+  80043f:	56                   	push   %esi
+  800440:	89 e5                	mov    %esp,%ebp
+  800442:	8d 35 4a 04 80 00    	lea    0x80044a,%esi
+  800448:	0f 34                	sysenter
+
+0080044a <after_sysenter_label_1311>:
+  80044a:	5e                   	pop    %esi
+  80044b:	5d                   	pop    %ebp
+  80044c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80044f:	85 c0                	test   %eax,%eax
+  800451:	7f 07                	jg     80045a <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800453:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800456:	5b                   	pop    %ebx
+  800457:	5f                   	pop    %edi
+  800458:	5d                   	pop    %ebp
+  800459:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80045a:	83 ec 0c             	sub    $0xc,%esp
+  80045d:	50                   	push   %eax
+  80045e:	6a 42                	push   $0x42
+  800460:	68 ea 46 80 00       	push   $0x8046ea
+  800465:	6a 54                	push   $0x54
+  800467:	68 07 47 80 00       	push   $0x804707
+  80046c:	e8 53 2d 00 00       	call   8031c4 <_panic>
+
+00800471 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800480:	89 d1                	mov    %edx,%ecx
+  800482:	89 d3                	mov    %edx,%ebx
+  800484:	89 d7                	mov    %edx,%edi
+  800486:	6a 00                	push   $0x0
+  800488:	55                   	push   %ebp
+  800489:	56                   	push   %esi
+  80048a:	89 e5                	mov    %esp,%ebp
+  80048c:	8d 35 94 04 80 00    	lea    0x800494,%esi
+  800492:	0f 34                	sysenter
+
+00800494 <after_sysenter_label_1411>:
+  800494:	5e                   	pop    %esi
+  800495:	5d                   	pop    %ebp
+  800496:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800499:	5b                   	pop    %ebx
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	57                   	push   %edi
+  8004a1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004b2:	89 df                	mov    %ebx,%edi
+  8004b4:	6a 00                	push   $0x0
+  8004b6:	55                   	push   %ebp
+  8004b7:	56                   	push   %esi
+  8004b8:	89 e5                	mov    %esp,%ebp
+  8004ba:	8d 35 c2 04 80 00    	lea    0x8004c2,%esi
+  8004c0:	0f 34                	sysenter
+
+008004c2 <after_sysenter_label_1497>:
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5d                   	pop    %ebp
+  8004c4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004c7:	5b                   	pop    %ebx
+  8004c8:	5f                   	pop    %edi
+  8004c9:	5d                   	pop    %ebp
+  8004ca:	c3                   	ret
+
+008004cb <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004cb:	55                   	push   %ebp
+  8004cc:	89 e5                	mov    %esp,%ebp
+  8004ce:	57                   	push   %edi
+  8004cf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004db:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004e0:	89 df                	mov    %ebx,%edi
+  8004e2:	6a 00                	push   $0x0
+  8004e4:	55                   	push   %ebp
+  8004e5:	56                   	push   %esi
+  8004e6:	89 e5                	mov    %esp,%ebp
+  8004e8:	8d 35 f0 04 80 00    	lea    0x8004f0,%esi
+  8004ee:	0f 34                	sysenter
+
+008004f0 <after_sysenter_label_1583>:
+  8004f0:	5e                   	pop    %esi
+  8004f1:	5d                   	pop    %ebp
+  8004f2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004f5:	5b                   	pop    %ebx
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+
+008004f9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	57                   	push   %edi
+  8004fd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800501:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800504:	b8 11 00 00 00       	mov    $0x11,%eax
+  800509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80050e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800511:	6a 00                	push   $0x0
+  800513:	55                   	push   %ebp
+  800514:	56                   	push   %esi
+  800515:	89 e5                	mov    %esp,%ebp
+  800517:	8d 35 1f 05 80 00    	lea    0x80051f,%esi
+  80051d:	0f 34                	sysenter
+
+0080051f <after_sysenter_label_1672>:
+  80051f:	5e                   	pop    %esi
+  800520:	5d                   	pop    %ebp
+  800521:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800524:	5b                   	pop    %ebx
+  800525:	5f                   	pop    %edi
+  800526:	5d                   	pop    %ebp
+  800527:	c3                   	ret
+
+00800528 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	57                   	push   %edi
+  80052c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80052d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800532:	8b 55 08             	mov    0x8(%ebp),%edx
+  800535:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800538:	b8 12 00 00 00       	mov    $0x12,%eax
+  80053d:	89 df                	mov    %ebx,%edi
+  80053f:	6a 00                	push   $0x0
+  800541:	55                   	push   %ebp
+  800542:	56                   	push   %esi
+  800543:	89 e5                	mov    %esp,%ebp
+  800545:	8d 35 4d 05 80 00    	lea    0x80054d,%esi
+  80054b:	0f 34                	sysenter
+
+0080054d <after_sysenter_label_1758>:
+  80054d:	5e                   	pop    %esi
+  80054e:	5d                   	pop    %ebp
+  80054f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800552:	5b                   	pop    %ebx
+  800553:	5f                   	pop    %edi
+  800554:	5d                   	pop    %ebp
+  800555:	c3                   	ret
+
+00800556 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800556:	55                   	push   %ebp
+  800557:	89 e5                	mov    %esp,%ebp
+  800559:	57                   	push   %edi
+  80055a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80055b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800563:	b8 13 00 00 00       	mov    $0x13,%eax
+  800568:	89 cb                	mov    %ecx,%ebx
+  80056a:	89 cf                	mov    %ecx,%edi
+  80056c:	6a 00                	push   $0x0
+  80056e:	55                   	push   %ebp
+  80056f:	56                   	push   %esi
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	8d 35 7a 05 80 00    	lea    0x80057a,%esi
+  800578:	0f 34                	sysenter
+
+0080057a <after_sysenter_label_1842>:
+  80057a:	5e                   	pop    %esi
+  80057b:	5d                   	pop    %ebp
+  80057c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80057f:	85 c0                	test   %eax,%eax
+  800581:	7f 07                	jg     80058a <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800586:	5b                   	pop    %ebx
+  800587:	5f                   	pop    %edi
+  800588:	5d                   	pop    %ebp
+  800589:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80058a:	83 ec 0c             	sub    $0xc,%esp
+  80058d:	50                   	push   %eax
+  80058e:	6a 13                	push   $0x13
+  800590:	68 ea 46 80 00       	push   $0x8046ea
+  800595:	6a 54                	push   $0x54
+  800597:	68 07 47 80 00       	push   $0x804707
+  80059c:	e8 23 2c 00 00       	call   8031c4 <_panic>
+
+008005a1 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8005a1:	55                   	push   %ebp
+  8005a2:	89 e5                	mov    %esp,%ebp
+  8005a4:	57                   	push   %edi
+  8005a5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ab:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005b0:	89 d1                	mov    %edx,%ecx
+  8005b2:	89 d3                	mov    %edx,%ebx
+  8005b4:	89 d7                	mov    %edx,%edi
+  8005b6:	6a 00                	push   $0x0
+  8005b8:	55                   	push   %ebp
+  8005b9:	56                   	push   %esi
+  8005ba:	89 e5                	mov    %esp,%ebp
+  8005bc:	8d 35 c4 05 80 00    	lea    0x8005c4,%esi
+  8005c2:	0f 34                	sysenter
+
+008005c4 <after_sysenter_label_1939>:
+  8005c4:	5e                   	pop    %esi
+  8005c5:	5d                   	pop    %ebp
+  8005c6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005c9:	5b                   	pop    %ebx
+  8005ca:	5f                   	pop    %edi
+  8005cb:	5d                   	pop    %ebp
+  8005cc:	c3                   	ret
+
+008005cd <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	57                   	push   %edi
+  8005d1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005e5:	6a 00                	push   $0x0
+  8005e7:	55                   	push   %ebp
+  8005e8:	56                   	push   %esi
+  8005e9:	89 e5                	mov    %esp,%ebp
+  8005eb:	8d 35 f3 05 80 00    	lea    0x8005f3,%esi
+  8005f1:	0f 34                	sysenter
+
+008005f3 <after_sysenter_label_2028>:
+  8005f3:	5e                   	pop    %esi
+  8005f4:	5d                   	pop    %ebp
+  8005f5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005f8:	5b                   	pop    %ebx
+  8005f9:	5f                   	pop    %edi
+  8005fa:	5d                   	pop    %ebp
+  8005fb:	c3                   	ret
+
+008005fc <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005fc:	55                   	push   %ebp
+  8005fd:	89 e5                	mov    %esp,%ebp
+  8005ff:	57                   	push   %edi
+  800600:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800606:	8b 55 08             	mov    0x8(%ebp),%edx
+  800609:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80060c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800611:	89 df                	mov    %ebx,%edi
+  800613:	6a 00                	push   $0x0
+  800615:	55                   	push   %ebp
+  800616:	56                   	push   %esi
+  800617:	89 e5                	mov    %esp,%ebp
+  800619:	8d 35 21 06 80 00    	lea    0x800621,%esi
+  80061f:	0f 34                	sysenter
+
+00800621 <after_sysenter_label_2114>:
+  800621:	5e                   	pop    %esi
+  800622:	5d                   	pop    %ebp
+  800623:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800626:	5b                   	pop    %ebx
+  800627:	5f                   	pop    %edi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+
+0080062a <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80062a:	55                   	push   %ebp
+  80062b:	89 e5                	mov    %esp,%ebp
+  80062d:	57                   	push   %edi
+  80062e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80062f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800634:	8b 55 08             	mov    0x8(%ebp),%edx
+  800637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80063a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80063f:	89 df                	mov    %ebx,%edi
+  800641:	6a 00                	push   $0x0
+  800643:	55                   	push   %ebp
+  800644:	56                   	push   %esi
+  800645:	89 e5                	mov    %esp,%ebp
+  800647:	8d 35 4f 06 80 00    	lea    0x80064f,%esi
+  80064d:	0f 34                	sysenter
+
+0080064f <after_sysenter_label_2200>:
+  80064f:	5e                   	pop    %esi
+  800650:	5d                   	pop    %ebp
+  800651:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800654:	5b                   	pop    %ebx
+  800655:	5f                   	pop    %edi
+  800656:	5d                   	pop    %ebp
+  800657:	c3                   	ret
+
+00800658 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800658:	55                   	push   %ebp
+  800659:	89 e5                	mov    %esp,%ebp
+  80065b:	57                   	push   %edi
+  80065c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80065d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800662:	8b 55 08             	mov    0x8(%ebp),%edx
+  800665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800668:	b8 18 00 00 00       	mov    $0x18,%eax
+  80066d:	89 df                	mov    %ebx,%edi
+  80066f:	6a 00                	push   $0x0
+  800671:	55                   	push   %ebp
+  800672:	56                   	push   %esi
+  800673:	89 e5                	mov    %esp,%ebp
+  800675:	8d 35 7d 06 80 00    	lea    0x80067d,%esi
+  80067b:	0f 34                	sysenter
+
+0080067d <after_sysenter_label_2286>:
+  80067d:	5e                   	pop    %esi
+  80067e:	5d                   	pop    %ebp
+  80067f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800682:	5b                   	pop    %ebx
+  800683:	5f                   	pop    %edi
+  800684:	5d                   	pop    %ebp
+  800685:	c3                   	ret
+
+00800686 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800686:	55                   	push   %ebp
+  800687:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80068c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800691:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800694:	5d                   	pop    %ebp
+  800695:	c3                   	ret
+
+00800696 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800696:	55                   	push   %ebp
+  800697:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800699:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8006a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8006a6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006ab:	5d                   	pop    %ebp
+  8006ac:	c3                   	ret
+
+008006ad <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006ad:	55                   	push   %ebp
+  8006ae:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006b5:	eb 02                	jmp    8006b9 <fd_alloc+0xc>
+  8006b7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	c1 ea 16             	shr    $0x16,%edx
+  8006be:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006c5:	f6 c2 01             	test   $0x1,%dl
+  8006c8:	74 2b                	je     8006f5 <fd_alloc+0x48>
+  8006ca:	89 c2                	mov    %eax,%edx
+  8006cc:	c1 ea 0c             	shr    $0xc,%edx
+  8006cf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006d6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006dc:	f6 c1 01             	test   $0x1,%cl
+  8006df:	74 14                	je     8006f5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006e1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006e7:	75 ce                	jne    8006b7 <fd_alloc+0xa>
+  8006e9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006ee:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006f3:	eb 05                	jmp    8006fa <fd_alloc+0x4d>
+			return 0;
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006fd:	89 02                	mov    %eax,(%edx)
+}
+  8006ff:	89 c8                	mov    %ecx,%eax
+  800701:	5d                   	pop    %ebp
+  800702:	c3                   	ret
+
+00800703 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800703:	55                   	push   %ebp
+  800704:	89 e5                	mov    %esp,%ebp
+  800706:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800709:	83 f8 1f             	cmp    $0x1f,%eax
+  80070c:	77 30                	ja     80073e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80070e:	c1 e0 0c             	shl    $0xc,%eax
+  800711:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800716:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80071c:	f6 c2 01             	test   $0x1,%dl
+  80071f:	74 24                	je     800745 <fd_lookup+0x42>
+  800721:	89 c2                	mov    %eax,%edx
+  800723:	c1 ea 0c             	shr    $0xc,%edx
+  800726:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80072d:	f6 c2 01             	test   $0x1,%dl
+  800730:	74 1a                	je     80074c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800732:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800735:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80073c:	5d                   	pop    %ebp
+  80073d:	c3                   	ret
+		return -E_INVAL;
+  80073e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800743:	eb f7                	jmp    80073c <fd_lookup+0x39>
+		return -E_INVAL;
+  800745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074a:	eb f0                	jmp    80073c <fd_lookup+0x39>
+  80074c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800751:	eb e9                	jmp    80073c <fd_lookup+0x39>
+
+00800753 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800753:	55                   	push   %ebp
+  800754:	89 e5                	mov    %esp,%ebp
+  800756:	53                   	push   %ebx
+  800757:	83 ec 04             	sub    $0x4,%esp
+  80075a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80075d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800762:	eb 03                	jmp    800767 <dev_lookup+0x14>
+  800764:	83 c0 01             	add    $0x1,%eax
+  800767:	8b 1c 85 94 47 80 00 	mov    0x804794(,%eax,4),%ebx
+  80076e:	85 db                	test   %ebx,%ebx
+  800770:	74 0b                	je     80077d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800772:	39 13                	cmp    %edx,(%ebx)
+  800774:	75 ee                	jne    800764 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077b:	eb 49                	jmp    8007c6 <dev_lookup+0x73>
+  80077d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80077f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800785:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80078a:	77 18                	ja     8007a4 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80078c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800791:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800793:	c1 e8 10             	shr    $0x10,%eax
+  800796:	74 0c                	je     8007a4 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800798:	c1 e0 10             	shl    $0x10,%eax
+  80079b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8007a0:	29 c1                	sub    %eax,%ecx
+  8007a2:	eb 06                	jmp    8007aa <dev_lookup+0x57>
+		return pthread_main_tls;
+  8007a4:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007aa:	8b 01                	mov    (%ecx),%eax
+  8007ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8007af:	83 ec 04             	sub    $0x4,%esp
+  8007b2:	52                   	push   %edx
+  8007b3:	50                   	push   %eax
+  8007b4:	68 18 47 80 00       	push   $0x804718
+  8007b9:	e8 e1 2a 00 00       	call   80329f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007be:	83 c4 10             	add    $0x10,%esp
+  8007c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c9:	89 1a                	mov    %ebx,(%edx)
+}
+  8007cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+
+008007d0 <fd_close>:
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	57                   	push   %edi
+  8007d4:	56                   	push   %esi
+  8007d5:	53                   	push   %ebx
+  8007d6:	83 ec 24             	sub    $0x24,%esp
+  8007d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007e2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007e3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007e9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007ec:	50                   	push   %eax
+  8007ed:	e8 11 ff ff ff       	call   800703 <fd_lookup>
+  8007f2:	89 c3                	mov    %eax,%ebx
+  8007f4:	83 c4 10             	add    $0x10,%esp
+  8007f7:	85 c0                	test   %eax,%eax
+  8007f9:	78 05                	js     800800 <fd_close+0x30>
+	    || fd != fd2)
+  8007fb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007fe:	74 16                	je     800816 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800800:	89 f8                	mov    %edi,%eax
+  800802:	84 c0                	test   %al,%al
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80080c:	89 d8                	mov    %ebx,%eax
+  80080e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800811:	5b                   	pop    %ebx
+  800812:	5e                   	pop    %esi
+  800813:	5f                   	pop    %edi
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800816:	83 ec 08             	sub    $0x8,%esp
+  800819:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80081c:	50                   	push   %eax
+  80081d:	ff 36                	push   (%esi)
+  80081f:	e8 2f ff ff ff       	call   800753 <dev_lookup>
+  800824:	89 c3                	mov    %eax,%ebx
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	85 c0                	test   %eax,%eax
+  80082b:	78 1a                	js     800847 <fd_close+0x77>
+		if (dev->dev_close)
+  80082d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800830:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800833:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800838:	85 c0                	test   %eax,%eax
+  80083a:	74 0b                	je     800847 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80083c:	83 ec 0c             	sub    $0xc,%esp
+  80083f:	56                   	push   %esi
+  800840:	ff d0                	call   *%eax
+  800842:	89 c3                	mov    %eax,%ebx
+  800844:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800847:	83 ec 08             	sub    $0x8,%esp
+  80084a:	56                   	push   %esi
+  80084b:	6a 00                	push   $0x0
+  80084d:	e8 2b fa ff ff       	call   80027d <sys_page_unmap>
+	return r;
+  800852:	83 c4 10             	add    $0x10,%esp
+  800855:	eb b5                	jmp    80080c <fd_close+0x3c>
+
+00800857 <close>:
+
+int
+close(int fdnum)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80085d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800860:	50                   	push   %eax
+  800861:	ff 75 08             	push   0x8(%ebp)
+  800864:	e8 9a fe ff ff       	call   800703 <fd_lookup>
+  800869:	83 c4 10             	add    $0x10,%esp
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	79 02                	jns    800872 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800870:	c9                   	leave
+  800871:	c3                   	ret
+		return fd_close(fd, 1);
+  800872:	83 ec 08             	sub    $0x8,%esp
+  800875:	6a 01                	push   $0x1
+  800877:	ff 75 f4             	push   -0xc(%ebp)
+  80087a:	e8 51 ff ff ff       	call   8007d0 <fd_close>
+  80087f:	83 c4 10             	add    $0x10,%esp
+  800882:	eb ec                	jmp    800870 <close+0x19>
+
+00800884 <close_all>:
+
+void
+close_all(void)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	53                   	push   %ebx
+  800888:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80088b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800890:	83 ec 0c             	sub    $0xc,%esp
+  800893:	53                   	push   %ebx
+  800894:	e8 be ff ff ff       	call   800857 <close>
+	for (i = 0; i < MAXFD; i++)
+  800899:	83 c3 01             	add    $0x1,%ebx
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	83 fb 20             	cmp    $0x20,%ebx
+  8008a2:	75 ec                	jne    800890 <close_all+0xc>
+}
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	57                   	push   %edi
+  8008ad:	56                   	push   %esi
+  8008ae:	53                   	push   %ebx
+  8008af:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008b5:	50                   	push   %eax
+  8008b6:	ff 75 08             	push   0x8(%ebp)
+  8008b9:	e8 45 fe ff ff       	call   800703 <fd_lookup>
+  8008be:	89 c3                	mov    %eax,%ebx
+  8008c0:	83 c4 10             	add    $0x10,%esp
+  8008c3:	85 c0                	test   %eax,%eax
+  8008c5:	78 7f                	js     800946 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008c7:	83 ec 0c             	sub    $0xc,%esp
+  8008ca:	ff 75 0c             	push   0xc(%ebp)
+  8008cd:	e8 85 ff ff ff       	call   800857 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008d5:	c1 e6 0c             	shl    $0xc,%esi
+  8008d8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008e1:	89 3c 24             	mov    %edi,(%esp)
+  8008e4:	e8 ad fd ff ff       	call   800696 <fd2data>
+  8008e9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008eb:	89 34 24             	mov    %esi,(%esp)
+  8008ee:	e8 a3 fd ff ff       	call   800696 <fd2data>
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008f9:	89 d8                	mov    %ebx,%eax
+  8008fb:	c1 e8 16             	shr    $0x16,%eax
+  8008fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800905:	a8 01                	test   $0x1,%al
+  800907:	74 11                	je     80091a <dup+0x71>
+  800909:	89 d8                	mov    %ebx,%eax
+  80090b:	c1 e8 0c             	shr    $0xc,%eax
+  80090e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800915:	f6 c2 01             	test   $0x1,%dl
+  800918:	75 36                	jne    800950 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80091a:	89 f8                	mov    %edi,%eax
+  80091c:	c1 e8 0c             	shr    $0xc,%eax
+  80091f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800926:	83 ec 0c             	sub    $0xc,%esp
+  800929:	25 07 0e 00 00       	and    $0xe07,%eax
+  80092e:	50                   	push   %eax
+  80092f:	56                   	push   %esi
+  800930:	6a 00                	push   $0x0
+  800932:	57                   	push   %edi
+  800933:	6a 00                	push   $0x0
+  800935:	e8 f7 f8 ff ff       	call   800231 <sys_page_map>
+  80093a:	89 c3                	mov    %eax,%ebx
+  80093c:	83 c4 20             	add    $0x20,%esp
+  80093f:	85 c0                	test   %eax,%eax
+  800941:	78 33                	js     800976 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800943:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800946:	89 d8                	mov    %ebx,%eax
+  800948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80094b:	5b                   	pop    %ebx
+  80094c:	5e                   	pop    %esi
+  80094d:	5f                   	pop    %edi
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800950:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800957:	83 ec 0c             	sub    $0xc,%esp
+  80095a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80095f:	50                   	push   %eax
+  800960:	ff 75 d4             	push   -0x2c(%ebp)
+  800963:	6a 00                	push   $0x0
+  800965:	53                   	push   %ebx
+  800966:	6a 00                	push   $0x0
+  800968:	e8 c4 f8 ff ff       	call   800231 <sys_page_map>
+  80096d:	89 c3                	mov    %eax,%ebx
+  80096f:	83 c4 20             	add    $0x20,%esp
+  800972:	85 c0                	test   %eax,%eax
+  800974:	79 a4                	jns    80091a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800976:	83 ec 08             	sub    $0x8,%esp
+  800979:	56                   	push   %esi
+  80097a:	6a 00                	push   $0x0
+  80097c:	e8 fc f8 ff ff       	call   80027d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800981:	83 c4 08             	add    $0x8,%esp
+  800984:	ff 75 d4             	push   -0x2c(%ebp)
+  800987:	6a 00                	push   $0x0
+  800989:	e8 ef f8 ff ff       	call   80027d <sys_page_unmap>
+	return r;
+  80098e:	83 c4 10             	add    $0x10,%esp
+  800991:	eb b3                	jmp    800946 <dup+0x9d>
+
+00800993 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	56                   	push   %esi
+  800997:	53                   	push   %ebx
+  800998:	83 ec 18             	sub    $0x18,%esp
+  80099b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80099e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009a1:	50                   	push   %eax
+  8009a2:	53                   	push   %ebx
+  8009a3:	e8 5b fd ff ff       	call   800703 <fd_lookup>
+  8009a8:	83 c4 10             	add    $0x10,%esp
+  8009ab:	85 c0                	test   %eax,%eax
+  8009ad:	78 3c                	js     8009eb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009b2:	83 ec 08             	sub    $0x8,%esp
+  8009b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009b8:	50                   	push   %eax
+  8009b9:	ff 36                	push   (%esi)
+  8009bb:	e8 93 fd ff ff       	call   800753 <dev_lookup>
+  8009c0:	83 c4 10             	add    $0x10,%esp
+  8009c3:	85 c0                	test   %eax,%eax
+  8009c5:	78 24                	js     8009eb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009c7:	8b 46 08             	mov    0x8(%esi),%eax
+  8009ca:	83 e0 03             	and    $0x3,%eax
+  8009cd:	83 f8 01             	cmp    $0x1,%eax
+  8009d0:	74 20                	je     8009f2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009d5:	8b 40 08             	mov    0x8(%eax),%eax
+  8009d8:	85 c0                	test   %eax,%eax
+  8009da:	74 61                	je     800a3d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009dc:	83 ec 04             	sub    $0x4,%esp
+  8009df:	ff 75 10             	push   0x10(%ebp)
+  8009e2:	ff 75 0c             	push   0xc(%ebp)
+  8009e5:	56                   	push   %esi
+  8009e6:	ff d0                	call   *%eax
+  8009e8:	83 c4 10             	add    $0x10,%esp
+}
+  8009eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009ee:	5b                   	pop    %ebx
+  8009ef:	5e                   	pop    %esi
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+  8009f2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009f4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009fa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8009ff:	77 18                	ja     800a19 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800a01:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800a06:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800a08:	c1 e8 10             	shr    $0x10,%eax
+  800a0b:	74 0c                	je     800a19 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a0d:	c1 e0 10             	shl    $0x10,%eax
+  800a10:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a15:	29 c2                	sub    %eax,%edx
+  800a17:	eb 06                	jmp    800a1f <read+0x8c>
+		return pthread_main_tls;
+  800a19:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a1f:	8b 02                	mov    (%edx),%eax
+  800a21:	8b 40 48             	mov    0x48(%eax),%eax
+  800a24:	83 ec 04             	sub    $0x4,%esp
+  800a27:	53                   	push   %ebx
+  800a28:	50                   	push   %eax
+  800a29:	68 59 47 80 00       	push   $0x804759
+  800a2e:	e8 6c 28 00 00       	call   80329f <cprintf>
+		return -E_INVAL;
+  800a33:	83 c4 10             	add    $0x10,%esp
+  800a36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a3b:	eb ae                	jmp    8009eb <read+0x58>
+		return -E_NOT_SUPP;
+  800a3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a42:	eb a7                	jmp    8009eb <read+0x58>
+
+00800a44 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	57                   	push   %edi
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	83 ec 0c             	sub    $0xc,%esp
+  800a4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a50:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a58:	eb 02                	jmp    800a5c <readn+0x18>
+  800a5a:	01 c3                	add    %eax,%ebx
+  800a5c:	39 f3                	cmp    %esi,%ebx
+  800a5e:	73 21                	jae    800a81 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a60:	83 ec 04             	sub    $0x4,%esp
+  800a63:	89 f0                	mov    %esi,%eax
+  800a65:	29 d8                	sub    %ebx,%eax
+  800a67:	50                   	push   %eax
+  800a68:	89 d8                	mov    %ebx,%eax
+  800a6a:	03 45 0c             	add    0xc(%ebp),%eax
+  800a6d:	50                   	push   %eax
+  800a6e:	57                   	push   %edi
+  800a6f:	e8 1f ff ff ff       	call   800993 <read>
+		if (m < 0)
+  800a74:	83 c4 10             	add    $0x10,%esp
+  800a77:	85 c0                	test   %eax,%eax
+  800a79:	78 04                	js     800a7f <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a7b:	75 dd                	jne    800a5a <readn+0x16>
+  800a7d:	eb 02                	jmp    800a81 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a7f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a81:	89 d8                	mov    %ebx,%eax
+  800a83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a86:	5b                   	pop    %ebx
+  800a87:	5e                   	pop    %esi
+  800a88:	5f                   	pop    %edi
+  800a89:	5d                   	pop    %ebp
+  800a8a:	c3                   	ret
+
+00800a8b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	56                   	push   %esi
+  800a8f:	53                   	push   %ebx
+  800a90:	83 ec 18             	sub    $0x18,%esp
+  800a93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a96:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a99:	50                   	push   %eax
+  800a9a:	53                   	push   %ebx
+  800a9b:	e8 63 fc ff ff       	call   800703 <fd_lookup>
+  800aa0:	83 c4 10             	add    $0x10,%esp
+  800aa3:	85 c0                	test   %eax,%eax
+  800aa5:	78 37                	js     800ade <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aa7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aaa:	83 ec 08             	sub    $0x8,%esp
+  800aad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ab0:	50                   	push   %eax
+  800ab1:	ff 36                	push   (%esi)
+  800ab3:	e8 9b fc ff ff       	call   800753 <dev_lookup>
+  800ab8:	83 c4 10             	add    $0x10,%esp
+  800abb:	85 c0                	test   %eax,%eax
+  800abd:	78 1f                	js     800ade <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800abf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ac3:	74 20                	je     800ae5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ac5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800acb:	85 c0                	test   %eax,%eax
+  800acd:	74 61                	je     800b30 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800acf:	83 ec 04             	sub    $0x4,%esp
+  800ad2:	ff 75 10             	push   0x10(%ebp)
+  800ad5:	ff 75 0c             	push   0xc(%ebp)
+  800ad8:	56                   	push   %esi
+  800ad9:	ff d0                	call   *%eax
+  800adb:	83 c4 10             	add    $0x10,%esp
+}
+  800ade:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ae1:	5b                   	pop    %ebx
+  800ae2:	5e                   	pop    %esi
+  800ae3:	5d                   	pop    %ebp
+  800ae4:	c3                   	ret
+  800ae5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ae7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800aed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800af2:	77 18                	ja     800b0c <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800af4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800af9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800afb:	c1 e8 10             	shr    $0x10,%eax
+  800afe:	74 0c                	je     800b0c <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800b00:	c1 e0 10             	shl    $0x10,%eax
+  800b03:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800b08:	29 c2                	sub    %eax,%edx
+  800b0a:	eb 06                	jmp    800b12 <write+0x87>
+		return pthread_main_tls;
+  800b0c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b12:	8b 02                	mov    (%edx),%eax
+  800b14:	8b 40 48             	mov    0x48(%eax),%eax
+  800b17:	83 ec 04             	sub    $0x4,%esp
+  800b1a:	53                   	push   %ebx
+  800b1b:	50                   	push   %eax
+  800b1c:	68 75 47 80 00       	push   $0x804775
+  800b21:	e8 79 27 00 00       	call   80329f <cprintf>
+		return -E_INVAL;
+  800b26:	83 c4 10             	add    $0x10,%esp
+  800b29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b2e:	eb ae                	jmp    800ade <write+0x53>
+		return -E_NOT_SUPP;
+  800b30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b35:	eb a7                	jmp    800ade <write+0x53>
+
+00800b37 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b40:	50                   	push   %eax
+  800b41:	ff 75 08             	push   0x8(%ebp)
+  800b44:	e8 ba fb ff ff       	call   800703 <fd_lookup>
+  800b49:	83 c4 10             	add    $0x10,%esp
+  800b4c:	85 c0                	test   %eax,%eax
+  800b4e:	78 0e                	js     800b5e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b56:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5e:	c9                   	leave
+  800b5f:	c3                   	ret
+
+00800b60 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+  800b65:	83 ec 18             	sub    $0x18,%esp
+  800b68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b6e:	50                   	push   %eax
+  800b6f:	53                   	push   %ebx
+  800b70:	e8 8e fb ff ff       	call   800703 <fd_lookup>
+  800b75:	83 c4 10             	add    $0x10,%esp
+  800b78:	85 c0                	test   %eax,%eax
+  800b7a:	78 34                	js     800bb0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b7c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b7f:	83 ec 08             	sub    $0x8,%esp
+  800b82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b85:	50                   	push   %eax
+  800b86:	ff 36                	push   (%esi)
+  800b88:	e8 c6 fb ff ff       	call   800753 <dev_lookup>
+  800b8d:	83 c4 10             	add    $0x10,%esp
+  800b90:	85 c0                	test   %eax,%eax
+  800b92:	78 1c                	js     800bb0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b94:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b98:	74 1d                	je     800bb7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b9d:	8b 40 18             	mov    0x18(%eax),%eax
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	74 5e                	je     800c02 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ba4:	83 ec 08             	sub    $0x8,%esp
+  800ba7:	ff 75 0c             	push   0xc(%ebp)
+  800baa:	56                   	push   %esi
+  800bab:	ff d0                	call   *%eax
+  800bad:	83 c4 10             	add    $0x10,%esp
+}
+  800bb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+  800bb7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bb9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bbf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bc4:	77 18                	ja     800bde <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bc6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bcb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bcd:	c1 e8 10             	shr    $0x10,%eax
+  800bd0:	74 0c                	je     800bde <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bd2:	c1 e0 10             	shl    $0x10,%eax
+  800bd5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bda:	29 c2                	sub    %eax,%edx
+  800bdc:	eb 06                	jmp    800be4 <ftruncate+0x84>
+		return pthread_main_tls;
+  800bde:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800be4:	8b 02                	mov    (%edx),%eax
+  800be6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800be9:	83 ec 04             	sub    $0x4,%esp
+  800bec:	53                   	push   %ebx
+  800bed:	50                   	push   %eax
+  800bee:	68 38 47 80 00       	push   $0x804738
+  800bf3:	e8 a7 26 00 00       	call   80329f <cprintf>
+		return -E_INVAL;
+  800bf8:	83 c4 10             	add    $0x10,%esp
+  800bfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c00:	eb ae                	jmp    800bb0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c07:	eb a7                	jmp    800bb0 <ftruncate+0x50>
+
+00800c09 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	56                   	push   %esi
+  800c0d:	53                   	push   %ebx
+  800c0e:	83 ec 18             	sub    $0x18,%esp
+  800c11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c17:	50                   	push   %eax
+  800c18:	ff 75 08             	push   0x8(%ebp)
+  800c1b:	e8 e3 fa ff ff       	call   800703 <fd_lookup>
+  800c20:	83 c4 10             	add    $0x10,%esp
+  800c23:	85 c0                	test   %eax,%eax
+  800c25:	78 49                	js     800c70 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c27:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c2a:	83 ec 08             	sub    $0x8,%esp
+  800c2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c30:	50                   	push   %eax
+  800c31:	ff 36                	push   (%esi)
+  800c33:	e8 1b fb ff ff       	call   800753 <dev_lookup>
+  800c38:	83 c4 10             	add    $0x10,%esp
+  800c3b:	85 c0                	test   %eax,%eax
+  800c3d:	78 31                	js     800c70 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c42:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c46:	74 2f                	je     800c77 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c48:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c4b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c52:	00 00 00 
+	stat->st_isdir = 0;
+  800c55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c5c:	00 00 00 
+	stat->st_dev = dev;
+  800c5f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c65:	83 ec 08             	sub    $0x8,%esp
+  800c68:	53                   	push   %ebx
+  800c69:	56                   	push   %esi
+  800c6a:	ff 50 14             	call   *0x14(%eax)
+  800c6d:	83 c4 10             	add    $0x10,%esp
+}
+  800c70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c7c:	eb f2                	jmp    800c70 <fstat+0x67>
+
+00800c7e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	56                   	push   %esi
+  800c82:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c83:	83 ec 08             	sub    $0x8,%esp
+  800c86:	6a 00                	push   $0x0
+  800c88:	ff 75 08             	push   0x8(%ebp)
+  800c8b:	e8 4b 03 00 00       	call   800fdb <open>
+  800c90:	89 c3                	mov    %eax,%ebx
+  800c92:	83 c4 10             	add    $0x10,%esp
+  800c95:	85 c0                	test   %eax,%eax
+  800c97:	78 1b                	js     800cb4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c99:	83 ec 08             	sub    $0x8,%esp
+  800c9c:	ff 75 0c             	push   0xc(%ebp)
+  800c9f:	50                   	push   %eax
+  800ca0:	e8 64 ff ff ff       	call   800c09 <fstat>
+  800ca5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800ca7:	89 1c 24             	mov    %ebx,(%esp)
+  800caa:	e8 a8 fb ff ff       	call   800857 <close>
+	return r;
+  800caf:	83 c4 10             	add    $0x10,%esp
+  800cb2:	89 f3                	mov    %esi,%ebx
+}
+  800cb4:	89 d8                	mov    %ebx,%eax
+  800cb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	56                   	push   %esi
+  800cc1:	53                   	push   %ebx
+  800cc2:	89 c6                	mov    %eax,%esi
+  800cc4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cc6:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800ccd:	74 27                	je     800cf6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ccf:	6a 07                	push   $0x7
+  800cd1:	68 00 70 80 00       	push   $0x807000
+  800cd6:	56                   	push   %esi
+  800cd7:	ff 35 00 60 80 00    	push   0x806000
+  800cdd:	e8 51 36 00 00       	call   804333 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800ce2:	83 c4 0c             	add    $0xc,%esp
+  800ce5:	6a 00                	push   $0x0
+  800ce7:	53                   	push   %ebx
+  800ce8:	6a 00                	push   $0x0
+  800cea:	e8 4e 35 00 00       	call   80423d <ipc_recv>
+}
+  800cef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	6a 01                	push   $0x1
+  800cfb:	e8 89 36 00 00       	call   804389 <ipc_find_env>
+  800d00:	a3 00 60 80 00       	mov    %eax,0x806000
+  800d05:	83 c4 10             	add    $0x10,%esp
+  800d08:	eb c5                	jmp    800ccf <fsipc+0x12>
+
+00800d0a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	53                   	push   %ebx
+  800d0e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d11:	68 04 60 80 00       	push   $0x806004
+  800d16:	e8 29 1b 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d21:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d29:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d33:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d38:	e8 80 ff ff ff       	call   800cbd <fsipc>
+  800d3d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d3f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d46:	e8 66 1b 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+}
+  800d4b:	89 d8                	mov    %ebx,%eax
+  800d4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d50:	c9                   	leave
+  800d51:	c3                   	ret
+
+00800d52 <devfile_flush>:
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	53                   	push   %ebx
+  800d56:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d59:	68 04 60 80 00       	push   $0x806004
+  800d5e:	e8 e1 1a 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d66:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d69:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d73:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d78:	e8 40 ff ff ff       	call   800cbd <fsipc>
+  800d7d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d7f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d86:	e8 26 1b 00 00       	call   8028b1 <mutex_unlock>
+}
+  800d8b:	89 d8                	mov    %ebx,%eax
+  800d8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d90:	c9                   	leave
+  800d91:	c3                   	ret
+
+00800d92 <devfile_stat>:
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  800d97:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	68 04 60 80 00       	push   $0x806004
+  800da2:	e8 9d 1a 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800da7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800daa:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dad:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbc:	e8 fc fe ff ff       	call   800cbd <fsipc>
+  800dc1:	89 c3                	mov    %eax,%ebx
+  800dc3:	83 c4 10             	add    $0x10,%esp
+  800dc6:	85 c0                	test   %eax,%eax
+  800dc8:	79 16                	jns    800de0 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+  800dcd:	68 04 60 80 00       	push   $0x806004
+  800dd2:	e8 da 1a 00 00       	call   8028b1 <mutex_unlock>
+}
+  800dd7:	89 d8                	mov    %ebx,%eax
+  800dd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800de0:	83 ec 08             	sub    $0x8,%esp
+  800de3:	68 00 70 80 00       	push   $0x807000
+  800de8:	56                   	push   %esi
+  800de9:	e8 95 2a 00 00       	call   803883 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800dee:	a1 80 70 80 00       	mov    0x807080,%eax
+  800df3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800df9:	a1 84 70 80 00       	mov    0x807084,%eax
+  800dfe:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800e04:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0c:	eb bc                	jmp    800dca <devfile_stat+0x38>
+
+00800e0e <devfile_write>:
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 10             	sub    $0x10,%esp
+  800e15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e18:	68 04 60 80 00       	push   $0x806004
+  800e1d:	e8 22 1a 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e25:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e28:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e2d:	83 c4 10             	add    $0x10,%esp
+  800e30:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e36:	76 3d                	jbe    800e75 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e38:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e3d:	39 c3                	cmp    %eax,%ebx
+  800e3f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e45:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e4a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e55:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5a:	e8 5e fe ff ff       	call   800cbd <fsipc>
+  800e5f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+  800e64:	68 04 60 80 00       	push   $0x806004
+  800e69:	e8 43 1a 00 00       	call   8028b1 <mutex_unlock>
+}
+  800e6e:	89 d8                	mov    %ebx,%eax
+  800e70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e73:	c9                   	leave
+  800e74:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e75:	83 ec 04             	sub    $0x4,%esp
+  800e78:	53                   	push   %ebx
+  800e79:	ff 75 0c             	push   0xc(%ebp)
+  800e7c:	68 0c 70 80 00       	push   $0x80700c
+  800e81:	e8 83 2b 00 00       	call   803a09 <memmove>
+  800e86:	83 c4 10             	add    $0x10,%esp
+  800e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8e:	eb b5                	jmp    800e45 <devfile_write+0x37>
+
+00800e90 <devfile_read>:
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  800e96:	83 ec 0c             	sub    $0xc,%esp
+  800e99:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800ea2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800ea8:	0f 86 8c 00 00 00    	jbe    800f3a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800eae:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800eb3:	39 c3                	cmp    %eax,%ebx
+  800eb5:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800eb8:	89 f8                	mov    %edi,%eax
+  800eba:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800ebd:	eb 0f                	jmp    800ece <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800ebf:	0f b6 08             	movzbl (%eax),%ecx
+  800ec2:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ec4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ec9:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ece:	39 d0                	cmp    %edx,%eax
+  800ed0:	72 ed                	jb     800ebf <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  800ed5:	68 04 60 80 00       	push   $0x806004
+  800eda:	e8 65 19 00 00       	call   802844 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800edf:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ee2:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800ee7:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800eed:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800efd:	e8 bb fd ff ff       	call   800cbd <fsipc>
+  800f02:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800f04:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f0b:	e8 a1 19 00 00       	call   8028b1 <mutex_unlock>
+		assert(r <= (int) n);
+  800f10:	83 c4 10             	add    $0x10,%esp
+  800f13:	39 f3                	cmp    %esi,%ebx
+  800f15:	7c 0a                	jl     800f21 <devfile_read+0x91>
+}
+  800f17:	89 f0                	mov    %esi,%eax
+  800f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+		assert(r <= (int) n);
+  800f21:	68 a8 47 80 00       	push   $0x8047a8
+  800f26:	68 b5 47 80 00       	push   $0x8047b5
+  800f2b:	68 90 00 00 00       	push   $0x90
+  800f30:	68 ca 47 80 00       	push   $0x8047ca
+  800f35:	e8 8a 22 00 00       	call   8031c4 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+  800f3d:	68 04 60 80 00       	push   $0x806004
+  800f42:	e8 fd 18 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f47:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f4a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f4f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f55:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f5c:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f64:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f69:	e8 4f fd ff ff       	call   800cbd <fsipc>
+  800f6e:	89 c6                	mov    %eax,%esi
+  800f70:	83 c4 10             	add    $0x10,%esp
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	78 1d                	js     800f94 <devfile_read+0x104>
+		assert(r <= n);
+  800f77:	39 c3                	cmp    %eax,%ebx
+  800f79:	72 2e                	jb     800fa9 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f7b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f80:	7f 40                	jg     800fc2 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f82:	83 ec 04             	sub    $0x4,%esp
+  800f85:	50                   	push   %eax
+  800f86:	68 00 70 80 00       	push   $0x807000
+  800f8b:	57                   	push   %edi
+  800f8c:	e8 78 2a 00 00       	call   803a09 <memmove>
+  800f91:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	68 04 60 80 00       	push   $0x806004
+  800f9c:	e8 10 19 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+  800fa1:	83 c4 10             	add    $0x10,%esp
+  800fa4:	e9 6e ff ff ff       	jmp    800f17 <devfile_read+0x87>
+		assert(r <= n);
+  800fa9:	68 d5 47 80 00       	push   $0x8047d5
+  800fae:	68 b5 47 80 00       	push   $0x8047b5
+  800fb3:	68 99 00 00 00       	push   $0x99
+  800fb8:	68 ca 47 80 00       	push   $0x8047ca
+  800fbd:	e8 02 22 00 00       	call   8031c4 <_panic>
+		assert(r <= PGSIZE);
+  800fc2:	68 dc 47 80 00       	push   $0x8047dc
+  800fc7:	68 b5 47 80 00       	push   $0x8047b5
+  800fcc:	68 9a 00 00 00       	push   $0x9a
+  800fd1:	68 ca 47 80 00       	push   $0x8047ca
+  800fd6:	e8 e9 21 00 00       	call   8031c4 <_panic>
+
+00800fdb <open>:
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+  800fe0:	83 ec 1c             	sub    $0x1c,%esp
+  800fe3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fe6:	56                   	push   %esi
+  800fe7:	e8 5c 28 00 00       	call   803848 <strlen>
+  800fec:	83 c4 10             	add    $0x10,%esp
+  800fef:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ff4:	0f 8f 85 00 00 00    	jg     80107f <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801000:	50                   	push   %eax
+  801001:	e8 a7 f6 ff ff       	call   8006ad <fd_alloc>
+  801006:	89 c3                	mov    %eax,%ebx
+  801008:	83 c4 10             	add    $0x10,%esp
+  80100b:	85 c0                	test   %eax,%eax
+  80100d:	78 55                	js     801064 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80100f:	83 ec 0c             	sub    $0xc,%esp
+  801012:	68 04 60 80 00       	push   $0x806004
+  801017:	e8 28 18 00 00       	call   802844 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80101c:	83 c4 08             	add    $0x8,%esp
+  80101f:	56                   	push   %esi
+  801020:	68 00 70 80 00       	push   $0x807000
+  801025:	e8 59 28 00 00       	call   803883 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80102a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80102d:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801032:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801035:	b8 01 00 00 00       	mov    $0x1,%eax
+  80103a:	e8 7e fc ff ff       	call   800cbd <fsipc>
+  80103f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801041:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801048:	e8 64 18 00 00       	call   8028b1 <mutex_unlock>
+	if (r < 0) {
+  80104d:	83 c4 10             	add    $0x10,%esp
+  801050:	85 db                	test   %ebx,%ebx
+  801052:	78 19                	js     80106d <open+0x92>
+	return fd2num(fd);
+  801054:	83 ec 0c             	sub    $0xc,%esp
+  801057:	ff 75 f4             	push   -0xc(%ebp)
+  80105a:	e8 27 f6 ff ff       	call   800686 <fd2num>
+  80105f:	89 c3                	mov    %eax,%ebx
+  801061:	83 c4 10             	add    $0x10,%esp
+}
+  801064:	89 d8                	mov    %ebx,%eax
+  801066:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+		fd_close(fd, 0);
+  80106d:	83 ec 08             	sub    $0x8,%esp
+  801070:	6a 00                	push   $0x0
+  801072:	ff 75 f4             	push   -0xc(%ebp)
+  801075:	e8 56 f7 ff ff       	call   8007d0 <fd_close>
+		return r;
+  80107a:	83 c4 10             	add    $0x10,%esp
+  80107d:	eb e5                	jmp    801064 <open+0x89>
+		return -E_BAD_PATH;
+  80107f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801084:	eb de                	jmp    801064 <open+0x89>
+
+00801086 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	53                   	push   %ebx
+  80108a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80108d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801090:	50                   	push   %eax
+  801091:	ff 75 08             	push   0x8(%ebp)
+  801094:	e8 6a f6 ff ff       	call   800703 <fd_lookup>
+  801099:	89 c3                	mov    %eax,%ebx
+  80109b:	83 c4 10             	add    $0x10,%esp
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	78 5b                	js     8010fd <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8010a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a5:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8010ab:	39 08                	cmp    %ecx,(%eax)
+  8010ad:	75 55                	jne    801104 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010af:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010b3:	74 56                	je     80110b <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010b5:	83 ec 0c             	sub    $0xc,%esp
+  8010b8:	68 04 60 80 00       	push   $0x806004
+  8010bd:	e8 82 17 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010c5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010c8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d0:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010d8:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010e7:	e8 d1 fb ff ff       	call   800cbd <fsipc>
+  8010ec:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010ee:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010f5:	e8 b7 17 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+  8010fa:	83 c4 10             	add    $0x10,%esp
+}
+  8010fd:	89 d8                	mov    %ebx,%eax
+  8010ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+		return -E_NOT_SUPP;
+  801104:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801109:	eb f2                	jmp    8010fd <fallocate+0x77>
+		return -E_INVAL;
+  80110b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801110:	eb eb                	jmp    8010fd <fallocate+0x77>
+
+00801112 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+  801117:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80111a:	89 f3                	mov    %esi,%ebx
+  80111c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801122:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801125:	eb 06                	jmp    80112d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801127:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80112d:	39 f3                	cmp    %esi,%ebx
+  80112f:	73 14                	jae    801145 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801131:	83 ec 08             	sub    $0x8,%esp
+  801134:	53                   	push   %ebx
+  801135:	6a 00                	push   $0x0
+  801137:	e8 41 f1 ff ff       	call   80027d <sys_page_unmap>
+  80113c:	83 c4 10             	add    $0x10,%esp
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	79 e4                	jns    801127 <munmap+0x15>
+  801143:	eb 05                	jmp    80114a <munmap+0x38>
+			return r;
+	return 0;
+  801145:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+
+00801151 <mmap>:
+{
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	57                   	push   %edi
+  801155:	56                   	push   %esi
+  801156:	53                   	push   %ebx
+  801157:	83 ec 24             	sub    $0x24,%esp
+  80115a:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80115d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801160:	50                   	push   %eax
+  801161:	ff 75 08             	push   0x8(%ebp)
+  801164:	e8 9a f5 ff ff       	call   800703 <fd_lookup>
+  801169:	83 c4 10             	add    $0x10,%esp
+  80116c:	85 c0                	test   %eax,%eax
+  80116e:	0f 88 37 01 00 00    	js     8012ab <mmap+0x15a>
+		return NULL;
+  801174:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801179:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80117c:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801182:	39 0a                	cmp    %ecx,(%edx)
+  801184:	0f 85 05 01 00 00    	jne    80128f <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80118a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801191:	0f 85 1b 01 00 00    	jne    8012b2 <mmap+0x161>
+  801197:	89 f0                	mov    %esi,%eax
+  801199:	83 e8 01             	sub    $0x1,%eax
+  80119c:	0f 88 17 01 00 00    	js     8012b9 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8011a2:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8011a6:	75 28                	jne    8011d0 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8011a8:	83 ec 0c             	sub    $0xc,%esp
+  8011ab:	68 04 60 80 00       	push   $0x806004
+  8011b0:	e8 8f 16 00 00       	call   802844 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011b5:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011bb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011c1:	83 c4 10             	add    $0x10,%esp
+  8011c4:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011c9:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011ce:	eb 2b                	jmp    8011fb <mmap+0xaa>
+		cow_enable();
+  8011d0:	e8 f7 2b 00 00       	call   803dcc <cow_enable>
+  8011d5:	eb d1                	jmp    8011a8 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011d7:	89 c2                	mov    %eax,%edx
+  8011d9:	c1 ea 0c             	shr    $0xc,%edx
+  8011dc:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011e3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011e9:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011ef:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011f2:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011f4:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011f9:	77 25                	ja     801220 <mmap+0xcf>
+  8011fb:	89 c2                	mov    %eax,%edx
+  8011fd:	29 da                	sub    %ebx,%edx
+  8011ff:	39 ca                	cmp    %ecx,%edx
+  801201:	73 3a                	jae    80123d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801203:	89 c2                	mov    %eax,%edx
+  801205:	c1 ea 16             	shr    $0x16,%edx
+  801208:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80120f:	f6 c2 01             	test   $0x1,%dl
+  801212:	75 c3                	jne    8011d7 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801214:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801219:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80121e:	eb d4                	jmp    8011f4 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801220:	29 d8                	sub    %ebx,%eax
+  801222:	39 c8                	cmp    %ecx,%eax
+  801224:	73 17                	jae    80123d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	68 04 60 80 00       	push   $0x806004
+  80122e:	e8 7e 16 00 00       	call   8028b1 <mutex_unlock>
+		return NULL;
+  801233:	83 c4 10             	add    $0x10,%esp
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123b:	eb 52                	jmp    80128f <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80123d:	85 db                	test   %ebx,%ebx
+  80123f:	74 e5                	je     801226 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801241:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801244:	8b 40 0c             	mov    0xc(%eax),%eax
+  801247:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80124c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80124f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801254:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  80125a:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801260:	8b 45 14             	mov    0x14(%ebp),%eax
+  801263:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801268:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801272:	e8 46 fa ff ff       	call   800cbd <fsipc>
+  801277:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	68 04 60 80 00       	push   $0x806004
+  801281:	e8 2b 16 00 00       	call   8028b1 <mutex_unlock>
+	if (r < 0) {
+  801286:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801289:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80128b:	85 ff                	test   %edi,%edi
+  80128d:	78 08                	js     801297 <mmap+0x146>
+}
+  80128f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+		munmap((void*) va, len);
+  801297:	83 ec 08             	sub    $0x8,%esp
+  80129a:	56                   	push   %esi
+  80129b:	53                   	push   %ebx
+  80129c:	e8 71 fe ff ff       	call   801112 <munmap>
+		return NULL;
+  8012a1:	83 c4 10             	add    $0x10,%esp
+  8012a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a9:	eb e4                	jmp    80128f <mmap+0x13e>
+		return NULL;
+  8012ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b0:	eb dd                	jmp    80128f <mmap+0x13e>
+		return NULL;
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	eb d6                	jmp    80128f <mmap+0x13e>
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	eb cf                	jmp    80128f <mmap+0x13e>
+
+008012c0 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	53                   	push   %ebx
+  8012c4:	83 ec 10             	sub    $0x10,%esp
+  8012c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012ca:	53                   	push   %ebx
+  8012cb:	e8 78 25 00 00       	call   803848 <strlen>
+  8012d0:	83 c4 10             	add    $0x10,%esp
+  8012d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012d8:	7f 42                	jg     80131c <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+  8012dd:	68 04 60 80 00       	push   $0x806004
+  8012e2:	e8 5d 15 00 00       	call   802844 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012e7:	83 c4 08             	add    $0x8,%esp
+  8012ea:	53                   	push   %ebx
+  8012eb:	68 00 70 80 00       	push   $0x807000
+  8012f0:	e8 8e 25 00 00       	call   803883 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012ff:	e8 b9 f9 ff ff       	call   800cbd <fsipc>
+  801304:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801306:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80130d:	e8 9f 15 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+  801312:	83 c4 10             	add    $0x10,%esp
+}
+  801315:	89 d8                	mov    %ebx,%eax
+  801317:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131a:	c9                   	leave
+  80131b:	c3                   	ret
+		return -E_BAD_PATH;
+  80131c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801321:	eb f2                	jmp    801315 <remove+0x55>
+
+00801323 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	53                   	push   %ebx
+  801327:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80132a:	68 04 60 80 00       	push   $0x806004
+  80132f:	e8 10 15 00 00       	call   802844 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801334:	ba 00 00 00 00       	mov    $0x0,%edx
+  801339:	b8 08 00 00 00       	mov    $0x8,%eax
+  80133e:	e8 7a f9 ff ff       	call   800cbd <fsipc>
+  801343:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801345:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80134c:	e8 60 15 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+}
+  801351:	89 d8                	mov    %ebx,%eax
+  801353:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801356:	c9                   	leave
+  801357:	c3                   	ret
+
+00801358 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  80135d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801360:	83 ec 0c             	sub    $0xc,%esp
+  801363:	68 04 60 80 00       	push   $0x806004
+  801368:	e8 d7 14 00 00       	call   802844 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80136d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801370:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80137f:	e8 39 f9 ff ff       	call   800cbd <fsipc>
+  801384:	89 c6                	mov    %eax,%esi
+  801386:	83 c4 10             	add    $0x10,%esp
+  801389:	85 db                	test   %ebx,%ebx
+  80138b:	74 7b                	je     801408 <fs_bcstat+0xb0>
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	78 77                	js     801408 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801391:	a1 00 70 80 00       	mov    0x807000,%eax
+  801396:	89 03                	mov    %eax,(%ebx)
+  801398:	a1 04 70 80 00       	mov    0x807004,%eax
+  80139d:	89 43 04             	mov    %eax,0x4(%ebx)
+  8013a0:	a1 08 70 80 00       	mov    0x807008,%eax
+  8013a5:	89 43 08             	mov    %eax,0x8(%ebx)
+  8013a8:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013ad:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013b0:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013b5:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013b8:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013bd:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013c0:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013c5:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013c8:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013cd:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013d0:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013d5:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013d8:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013dd:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013e0:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013e5:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013e8:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013ed:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013f0:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013f5:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013f8:	a1 34 70 80 00       	mov    0x807034,%eax
+  8013fd:	89 43 34             	mov    %eax,0x34(%ebx)
+  801400:	a1 38 70 80 00       	mov    0x807038,%eax
+  801405:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	68 04 60 80 00       	push   $0x806004
+  801410:	e8 9c 14 00 00       	call   8028b1 <mutex_unlock>
+	return r;
+}
+  801415:	89 f0                	mov    %esi,%eax
+  801417:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80141a:	5b                   	pop    %ebx
+  80141b:	5e                   	pop    %esi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	56                   	push   %esi
+  801422:	53                   	push   %ebx
+  801423:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801425:	0f b6 10             	movzbl (%eax),%edx
+  801428:	80 fa 72             	cmp    $0x72,%dl
+  80142b:	74 44                	je     801471 <parse_mode+0x53>
+  80142d:	80 fa 77             	cmp    $0x77,%dl
+  801430:	74 4b                	je     80147d <parse_mode+0x5f>
+  801432:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801437:	80 fa 61             	cmp    $0x61,%dl
+  80143a:	74 09                	je     801445 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80143c:	89 d8                	mov    %ebx,%eax
+  80143e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5d                   	pop    %ebp
+  801444:	c3                   	ret
+	switch (mode[0]) {
+  801445:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80144a:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80144f:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801451:	83 ec 08             	sub    $0x8,%esp
+  801454:	6a 2b                	push   $0x2b
+  801456:	50                   	push   %eax
+  801457:	e8 39 25 00 00       	call   803995 <strchr>
+  80145c:	83 c4 10             	add    $0x10,%esp
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	74 d9                	je     80143c <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801463:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801466:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801469:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80146f:	eb cb                	jmp    80143c <parse_mode+0x1e>
+	switch (mode[0]) {
+  801471:	ba 01 00 00 00       	mov    $0x1,%edx
+  801476:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147b:	eb d2                	jmp    80144f <parse_mode+0x31>
+  80147d:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801482:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801487:	eb c6                	jmp    80144f <parse_mode+0x31>
+
+00801489 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	57                   	push   %edi
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+  80148f:	83 ec 1c             	sub    $0x1c,%esp
+  801492:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801495:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801498:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80149d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8014a2:	83 c0 24             	add    $0x24,%eax
+  8014a5:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014a9:	74 17                	je     8014c2 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014ab:	83 c3 01             	add    $0x1,%ebx
+  8014ae:	83 fb 10             	cmp    $0x10,%ebx
+  8014b1:	75 ef                	jne    8014a2 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014b3:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014b8:	89 f0                	mov    %esi,%eax
+  8014ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5f                   	pop    %edi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014c2:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014cc:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014cf:	c1 e7 02             	shl    $0x2,%edi
+  8014d2:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014d8:	83 ec 04             	sub    $0x4,%esp
+  8014db:	6a 24                	push   $0x24
+  8014dd:	6a 00                	push   $0x0
+  8014df:	56                   	push   %esi
+  8014e0:	e8 ef 24 00 00       	call   8039d4 <memset>
+			streams[i].f_fd = fd;
+  8014e5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014e8:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014ee:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014f1:	01 d8                	add    %ebx,%eax
+  8014f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014f6:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8014fd:	83 c4 10             	add    $0x10,%esp
+  801500:	eb b6                	jmp    8014b8 <stream_alloc+0x2f>
+
+00801502 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	53                   	push   %ebx
+  801506:	83 ec 14             	sub    $0x14,%esp
+  801509:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80150b:	8b 40 18             	mov    0x18(%eax),%eax
+  80150e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801511:	74 4a                	je     80155d <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801513:	83 ec 08             	sub    $0x8,%esp
+  801516:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801519:	50                   	push   %eax
+  80151a:	ff 33                	push   (%ebx)
+  80151c:	e8 e2 f1 ff ff       	call   800703 <fd_lookup>
+  801521:	89 c2                	mov    %eax,%edx
+  801523:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801526:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80152b:	85 d2                	test   %edx,%edx
+  80152d:	78 41                	js     801570 <stream_unread+0x6e>
+  80152f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801532:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801538:	39 0a                	cmp    %ecx,(%edx)
+  80153a:	75 34                	jne    801570 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80153c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80153f:	03 42 04             	add    0x4(%edx),%eax
+  801542:	2b 43 18             	sub    0x18(%ebx),%eax
+  801545:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801548:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80154f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801556:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155b:	eb 13                	jmp    801570 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80155d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801564:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80156b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+
+00801575 <stream_drain>:
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  80157a:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80157c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801581:	eb 02                	jmp    801585 <stream_drain+0x10>
+  801583:	01 c3                	add    %eax,%ebx
+  801585:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801588:	39 c3                	cmp    %eax,%ebx
+  80158a:	73 43                	jae    8015cf <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80158c:	83 ec 04             	sub    $0x4,%esp
+  80158f:	29 d8                	sub    %ebx,%eax
+  801591:	50                   	push   %eax
+  801592:	89 d8                	mov    %ebx,%eax
+  801594:	03 46 0c             	add    0xc(%esi),%eax
+  801597:	50                   	push   %eax
+  801598:	ff 36                	push   (%esi)
+  80159a:	e8 ec f4 ff ff       	call   800a8b <write>
+  80159f:	83 c4 10             	add    $0x10,%esp
+  8015a2:	85 c0                	test   %eax,%eax
+  8015a4:	7f dd                	jg     801583 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8015a6:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015aa:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015ad:	83 ec 04             	sub    $0x4,%esp
+  8015b0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015b3:	29 d8                	sub    %ebx,%eax
+  8015b5:	50                   	push   %eax
+  8015b6:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015b9:	50                   	push   %eax
+  8015ba:	52                   	push   %edx
+  8015bb:	e8 49 24 00 00       	call   803a09 <memmove>
+			f->f_wend -= done;
+  8015c0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015c3:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015c5:	83 c4 10             	add    $0x10,%esp
+  8015c8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015cd:	eb 0a                	jmp    8015d9 <stream_drain+0x64>
+  8015cf:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015d4:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015d9:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015dc:	89 d0                	mov    %edx,%eax
+  8015de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+
+008015e5 <stream_setup>:
+	if (f->f_buf)
+  8015e5:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015e9:	74 01                	je     8015ec <stream_setup+0x7>
+  8015eb:	c3                   	ret
+{
+  8015ec:	55                   	push   %ebp
+  8015ed:	89 e5                	mov    %esp,%ebp
+  8015ef:	53                   	push   %ebx
+  8015f0:	83 ec 04             	sub    $0x4,%esp
+  8015f3:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015f5:	8b 40 08             	mov    0x8(%eax),%eax
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	74 17                	je     801613 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015fc:	83 f8 03             	cmp    $0x3,%eax
+  8015ff:	75 2d                	jne    80162e <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801601:	8d 43 20             	lea    0x20(%ebx),%eax
+  801604:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801607:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80160e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801611:	c9                   	leave
+  801612:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801613:	83 ec 0c             	sub    $0xc,%esp
+  801616:	ff 33                	push   (%ebx)
+  801618:	e8 29 1b 00 00       	call   803146 <iscons>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	85 c0                	test   %eax,%eax
+  801622:	0f 9f c0             	setg   %al
+  801625:	0f b6 c0             	movzbl %al,%eax
+  801628:	83 c0 01             	add    $0x1,%eax
+  80162b:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80162e:	83 ec 0c             	sub    $0xc,%esp
+  801631:	68 00 10 00 00       	push   $0x1000
+  801636:	e8 6e 0b 00 00       	call   8021a9 <malloc>
+  80163b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80163e:	83 c4 10             	add    $0x10,%esp
+  801641:	85 c0                	test   %eax,%eax
+  801643:	74 bc                	je     801601 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801645:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80164c:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801650:	eb bc                	jmp    80160e <stream_setup+0x29>
+
+00801652 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	53                   	push   %ebx
+  801656:	83 ec 04             	sub    $0x4,%esp
+  801659:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80165b:	e8 85 ff ff ff       	call   8015e5 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801660:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801665:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801669:	74 3d                	je     8016a8 <stream_fill+0x56>
+  80166b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80166f:	74 10                	je     801681 <stream_fill+0x2f>
+  801671:	89 d8                	mov    %ebx,%eax
+  801673:	e8 fd fe ff ff       	call   801575 <stream_drain>
+		return 0;
+  801678:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	78 27                	js     8016a8 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801681:	83 ec 04             	sub    $0x4,%esp
+  801684:	ff 73 10             	push   0x10(%ebx)
+  801687:	ff 73 0c             	push   0xc(%ebx)
+  80168a:	ff 33                	push   (%ebx)
+  80168c:	e8 02 f3 ff ff       	call   800993 <read>
+  801691:	83 c4 10             	add    $0x10,%esp
+  801694:	85 c0                	test   %eax,%eax
+  801696:	7e 17                	jle    8016af <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  801698:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80169c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8016a3:	89 c2                	mov    %eax,%edx
+  8016a5:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8016a8:	89 d0                	mov    %edx,%eax
+  8016aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016af:	c1 f8 1f             	sar    $0x1f,%eax
+  8016b2:	83 e0 04             	and    $0x4,%eax
+  8016b5:	83 c0 04             	add    $0x4,%eax
+  8016b8:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c0:	eb e6                	jmp    8016a8 <stream_fill+0x56>
+
+008016c2 <fopen>:
+{
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	57                   	push   %edi
+  8016c6:	56                   	push   %esi
+  8016c7:	53                   	push   %ebx
+  8016c8:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d1:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016d7:	89 f0                	mov    %esi,%eax
+  8016d9:	e8 40 fd ff ff       	call   80141e <parse_mode>
+		return 0;
+  8016de:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 2d                	js     801714 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	50                   	push   %eax
+  8016eb:	ff 75 08             	push   0x8(%ebp)
+  8016ee:	e8 e8 f8 ff ff       	call   800fdb <open>
+  8016f3:	89 c7                	mov    %eax,%edi
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 58                	js     801754 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016fc:	80 3e 61             	cmpb   $0x61,(%esi)
+  8016ff:	74 1d                	je     80171e <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  801701:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  801707:	89 f8                	mov    %edi,%eax
+  801709:	e8 7b fd ff ff       	call   801489 <stream_alloc>
+  80170e:	89 c3                	mov    %eax,%ebx
+  801710:	85 c0                	test   %eax,%eax
+  801712:	74 32                	je     801746 <fopen+0x84>
+}
+  801714:	89 d8                	mov    %ebx,%eax
+  801716:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5f                   	pop    %edi
+  80171c:	5d                   	pop    %ebp
+  80171d:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80171e:	83 ec 08             	sub    $0x8,%esp
+  801721:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801727:	50                   	push   %eax
+  801728:	57                   	push   %edi
+  801729:	e8 db f4 ff ff       	call   800c09 <fstat>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	85 c0                	test   %eax,%eax
+  801733:	78 cc                	js     801701 <fopen+0x3f>
+		seek(fd, st.st_size);
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	ff 75 dc             	push   -0x24(%ebp)
+  80173b:	57                   	push   %edi
+  80173c:	e8 f6 f3 ff ff       	call   800b37 <seek>
+  801741:	83 c4 10             	add    $0x10,%esp
+  801744:	eb bb                	jmp    801701 <fopen+0x3f>
+		close(fd);
+  801746:	83 ec 0c             	sub    $0xc,%esp
+  801749:	57                   	push   %edi
+  80174a:	e8 08 f1 ff ff       	call   800857 <close>
+  80174f:	83 c4 10             	add    $0x10,%esp
+  801752:	eb c0                	jmp    801714 <fopen+0x52>
+		return 0;
+  801754:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801759:	eb b9                	jmp    801714 <fopen+0x52>
+
+0080175b <fdopen>:
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801761:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801764:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801767:	e8 b2 fc ff ff       	call   80141e <parse_mode>
+  80176c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80176e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801773:	85 d2                	test   %edx,%edx
+  801775:	78 0b                	js     801782 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  801777:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80177a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177d:	e8 07 fd ff ff       	call   801489 <stream_alloc>
+}
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+
+00801784 <setvbuf>:
+{
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	57                   	push   %edi
+  801788:	56                   	push   %esi
+  801789:	53                   	push   %ebx
+  80178a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80178d:	8b 55 10             	mov    0x10(%ebp),%edx
+  801790:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801793:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801797:	75 3a                	jne    8017d3 <setvbuf+0x4f>
+  801799:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80179c:	83 fe 02             	cmp    $0x2,%esi
+  80179f:	77 39                	ja     8017da <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8017a1:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8017a4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8017a8:	0f 95 c3             	setne  %bl
+  8017ab:	85 ff                	test   %edi,%edi
+  8017ad:	0f 95 c1             	setne  %cl
+  8017b0:	84 cb                	test   %cl,%bl
+  8017b2:	74 05                	je     8017b9 <setvbuf+0x35>
+  8017b4:	83 fa 03             	cmp    $0x3,%edx
+  8017b7:	75 0a                	jne    8017c3 <setvbuf+0x3f>
+	return 0;
+  8017b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017be:	5b                   	pop    %ebx
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5f                   	pop    %edi
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+		f->f_buf = buf;
+  8017c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c6:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017c9:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d1:	eb eb                	jmp    8017be <setvbuf+0x3a>
+		return EOF;
+  8017d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017d8:	eb e4                	jmp    8017be <setvbuf+0x3a>
+  8017da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017df:	eb dd                	jmp    8017be <setvbuf+0x3a>
+
+008017e1 <fflush>:
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	57                   	push   %edi
+  8017e5:	56                   	push   %esi
+  8017e6:	53                   	push   %ebx
+  8017e7:	83 ec 0c             	sub    $0xc,%esp
+  8017ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017ed:	85 db                	test   %ebx,%ebx
+  8017ef:	74 1a                	je     80180b <fflush+0x2a>
+	stream_unread(f);
+  8017f1:	89 d8                	mov    %ebx,%eax
+  8017f3:	e8 0a fd ff ff       	call   801502 <stream_unread>
+	return stream_drain(f);
+  8017f8:	89 d8                	mov    %ebx,%eax
+  8017fa:	e8 76 fd ff ff       	call   801575 <stream_drain>
+  8017ff:	89 c7                	mov    %eax,%edi
+}
+  801801:	89 f8                	mov    %edi,%eax
+  801803:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801806:	5b                   	pop    %ebx
+  801807:	5e                   	pop    %esi
+  801808:	5f                   	pop    %edi
+  801809:	5d                   	pop    %ebp
+  80180a:	c3                   	ret
+  80180b:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801810:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181a:	eb 03                	jmp    80181f <fflush+0x3e>
+  80181c:	83 c3 24             	add    $0x24,%ebx
+  80181f:	39 f3                	cmp    %esi,%ebx
+  801821:	74 de                	je     801801 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801823:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  801827:	74 f3                	je     80181c <fflush+0x3b>
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	53                   	push   %ebx
+  80182d:	e8 af ff ff ff       	call   8017e1 <fflush>
+  801832:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801835:	85 c0                	test   %eax,%eax
+  801837:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80183c:	0f 48 f8             	cmovs  %eax,%edi
+  80183f:	eb db                	jmp    80181c <fflush+0x3b>
+
+00801841 <fclose>:
+{
+  801841:	55                   	push   %ebp
+  801842:	89 e5                	mov    %esp,%ebp
+  801844:	56                   	push   %esi
+  801845:	53                   	push   %ebx
+  801846:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801849:	83 ec 0c             	sub    $0xc,%esp
+  80184c:	56                   	push   %esi
+  80184d:	e8 8f ff ff ff       	call   8017e1 <fflush>
+  801852:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801854:	83 c4 04             	add    $0x4,%esp
+  801857:	ff 36                	push   (%esi)
+  801859:	e8 f9 ef ff ff       	call   800857 <close>
+  80185e:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801861:	85 c0                	test   %eax,%eax
+  801863:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801868:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80186b:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80186f:	75 10                	jne    801881 <fclose+0x40>
+	f->f_flags = 0;
+  801871:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  801878:	89 d8                	mov    %ebx,%eax
+  80187a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187d:	5b                   	pop    %ebx
+  80187e:	5e                   	pop    %esi
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+		free(f->f_buf);
+  801881:	83 ec 0c             	sub    $0xc,%esp
+  801884:	ff 76 0c             	push   0xc(%esi)
+  801887:	e8 54 08 00 00       	call   8020e0 <free>
+  80188c:	83 c4 10             	add    $0x10,%esp
+  80188f:	eb e0                	jmp    801871 <fclose+0x30>
+
+00801891 <fileno>:
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801894:	8b 45 08             	mov    0x8(%ebp),%eax
+  801897:	8b 00                	mov    (%eax),%eax
+}
+  801899:	5d                   	pop    %ebp
+  80189a:	c3                   	ret
+
+0080189b <feof>:
+{
+  80189b:	55                   	push   %ebp
+  80189c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80189e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a1:	8b 40 04             	mov    0x4(%eax),%eax
+  8018a4:	c1 e8 02             	shr    $0x2,%eax
+  8018a7:	83 e0 01             	and    $0x1,%eax
+}
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+
+008018ac <ferror>:
+{
+  8018ac:	55                   	push   %ebp
+  8018ad:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b2:	8b 40 04             	mov    0x4(%eax),%eax
+  8018b5:	c1 e8 03             	shr    $0x3,%eax
+  8018b8:	83 e0 01             	and    $0x1,%eax
+}
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+
+008018bd <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	53                   	push   %ebx
+  8018c1:	83 ec 04             	sub    $0x4,%esp
+  8018c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018c7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018ca:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018cd:	74 15                	je     8018e4 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018cf:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018d2:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018d5:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018d8:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018db:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e2:	c9                   	leave
+  8018e3:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018e4:	89 d8                	mov    %ebx,%eax
+  8018e6:	e8 67 fd ff ff       	call   801652 <stream_fill>
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	75 e0                	jne    8018cf <fgetc+0x12>
+		return EOF;
+  8018ef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018f4:	eb e9                	jmp    8018df <fgetc+0x22>
+
+008018f6 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018f6:	55                   	push   %ebp
+  8018f7:	89 e5                	mov    %esp,%ebp
+  8018f9:	57                   	push   %edi
+  8018fa:	56                   	push   %esi
+  8018fb:	53                   	push   %ebx
+  8018fc:	83 ec 1c             	sub    $0x1c,%esp
+  8018ff:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801902:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801907:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190a:	83 e8 01             	sub    $0x1,%eax
+  80190d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801910:	eb 66                	jmp    801978 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801912:	8b 46 14             	mov    0x14(%esi),%eax
+  801915:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801918:	29 c3                	sub    %eax,%ebx
+  80191a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80191d:	29 fa                	sub    %edi,%edx
+  80191f:	39 d3                	cmp    %edx,%ebx
+  801921:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801924:	83 ec 04             	sub    $0x4,%esp
+  801927:	53                   	push   %ebx
+  801928:	6a 0a                	push   $0xa
+  80192a:	03 46 0c             	add    0xc(%esi),%eax
+  80192d:	50                   	push   %eax
+  80192e:	e8 87 21 00 00       	call   803aba <memfind>
+  801933:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801936:	8b 46 0c             	mov    0xc(%esi),%eax
+  801939:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80193c:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80193f:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801941:	83 c4 10             	add    $0x10,%esp
+  801944:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  801947:	74 0b                	je     801954 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801949:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80194c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80194f:	29 d3                	sub    %edx,%ebx
+  801951:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801954:	83 ec 04             	sub    $0x4,%esp
+  801957:	53                   	push   %ebx
+  801958:	01 c8                	add    %ecx,%eax
+  80195a:	50                   	push   %eax
+  80195b:	89 f8                	mov    %edi,%eax
+  80195d:	03 45 08             	add    0x8(%ebp),%eax
+  801960:	50                   	push   %eax
+  801961:	e8 a3 20 00 00       	call   803a09 <memmove>
+		f->f_rpos += m;
+  801966:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801969:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801971:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801976:	74 1f                	je     801997 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  801978:	8d 47 01             	lea    0x1(%edi),%eax
+  80197b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80197e:	73 17                	jae    801997 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801980:	8b 46 18             	mov    0x18(%esi),%eax
+  801983:	39 46 14             	cmp    %eax,0x14(%esi)
+  801986:	75 8a                	jne    801912 <fgets+0x1c>
+  801988:	89 f0                	mov    %esi,%eax
+  80198a:	e8 c3 fc ff ff       	call   801652 <stream_fill>
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	0f 85 7b ff ff ff    	jne    801912 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  801997:	85 ff                	test   %edi,%edi
+  801999:	74 0f                	je     8019aa <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80199b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199e:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8019a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5f                   	pop    %edi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+		return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019af:	eb f1                	jmp    8019a2 <fgets+0xac>
+
+008019b1 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	57                   	push   %edi
+  8019b5:	56                   	push   %esi
+  8019b6:	53                   	push   %ebx
+  8019b7:	83 ec 1c             	sub    $0x1c,%esp
+  8019ba:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019bd:	89 f0                	mov    %esi,%eax
+  8019bf:	e8 21 fc ff ff       	call   8015e5 <stream_setup>
+	want = size * n;
+  8019c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d3:	eb 43                	jmp    801a18 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019d5:	29 d3                	sub    %edx,%ebx
+  8019d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019da:	29 f8                	sub    %edi,%eax
+  8019dc:	39 c3                	cmp    %eax,%ebx
+  8019de:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019e1:	83 ec 04             	sub    $0x4,%esp
+  8019e4:	53                   	push   %ebx
+  8019e5:	03 56 0c             	add    0xc(%esi),%edx
+  8019e8:	52                   	push   %edx
+  8019e9:	89 f8                	mov    %edi,%eax
+  8019eb:	03 45 08             	add    0x8(%ebp),%eax
+  8019ee:	50                   	push   %eax
+  8019ef:	e8 15 20 00 00       	call   803a09 <memmove>
+			f->f_rpos += m;
+  8019f4:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	eb 1a                	jmp    801a16 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019fc:	83 ec 04             	sub    $0x4,%esp
+  8019ff:	53                   	push   %ebx
+  801a00:	89 f8                	mov    %edi,%eax
+  801a02:	03 45 08             	add    0x8(%ebp),%eax
+  801a05:	50                   	push   %eax
+  801a06:	ff 36                	push   (%esi)
+  801a08:	e8 86 ef ff ff       	call   800993 <read>
+  801a0d:	89 c3                	mov    %eax,%ebx
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	85 c0                	test   %eax,%eax
+  801a14:	7e 36                	jle    801a4c <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a16:	01 df                	add    %ebx,%edi
+  801a18:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a1b:	39 c7                	cmp    %eax,%edi
+  801a1d:	73 39                	jae    801a58 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a1f:	8b 56 14             	mov    0x14(%esi),%edx
+  801a22:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a25:	39 da                	cmp    %ebx,%edx
+  801a27:	72 ac                	jb     8019d5 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a29:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a2c:	29 fb                	sub    %edi,%ebx
+  801a2e:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a31:	72 3e                	jb     801a71 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a33:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a37:	74 1f                	je     801a58 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a39:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a3d:	74 bd                	je     8019fc <fread+0x4b>
+  801a3f:	89 f0                	mov    %esi,%eax
+  801a41:	e8 2f fb ff ff       	call   801575 <stream_drain>
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	79 b2                	jns    8019fc <fread+0x4b>
+  801a4a:	eb 0c                	jmp    801a58 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a4c:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a4f:	83 e3 04             	and    $0x4,%ebx
+  801a52:	83 c3 04             	add    $0x4,%ebx
+  801a55:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	74 0a                	je     801a69 <fread+0xb8>
+  801a5f:	89 f8                	mov    %edi,%eax
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a6c:	5b                   	pop    %ebx
+  801a6d:	5e                   	pop    %esi
+  801a6e:	5f                   	pop    %edi
+  801a6f:	5d                   	pop    %ebp
+  801a70:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a71:	89 f0                	mov    %esi,%eax
+  801a73:	e8 da fb ff ff       	call   801652 <stream_fill>
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	74 dc                	je     801a58 <fread+0xa7>
+			m = 0;
+  801a7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a81:	eb 93                	jmp    801a16 <fread+0x65>
+
+00801a83 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	57                   	push   %edi
+  801a87:	56                   	push   %esi
+  801a88:	53                   	push   %ebx
+  801a89:	83 ec 1c             	sub    $0x1c,%esp
+  801a8c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a8f:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a92:	a8 02                	test   $0x2,%al
+  801a94:	75 13                	jne    801aa9 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a96:	83 c8 08             	or     $0x8,%eax
+  801a99:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+	stream_setup(f);
+  801aa9:	89 d8                	mov    %ebx,%eax
+  801aab:	e8 35 fb ff ff       	call   8015e5 <stream_setup>
+	want = size * n;
+  801ab0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801ab7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801aba:	89 d8                	mov    %ebx,%eax
+  801abc:	e8 41 fa ff ff       	call   801502 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ac1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ac6:	84 c0                	test   %al,%al
+  801ac8:	75 7b                	jne    801b45 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801aca:	be 00 00 00 00       	mov    $0x0,%esi
+  801acf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad2:	39 fe                	cmp    %edi,%esi
+  801ad4:	73 24                	jae    801afa <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ad6:	83 ec 04             	sub    $0x4,%esp
+  801ad9:	89 f8                	mov    %edi,%eax
+  801adb:	29 f0                	sub    %esi,%eax
+  801add:	50                   	push   %eax
+  801ade:	89 f0                	mov    %esi,%eax
+  801ae0:	03 45 08             	add    0x8(%ebp),%eax
+  801ae3:	50                   	push   %eax
+  801ae4:	ff 33                	push   (%ebx)
+  801ae6:	e8 a0 ef ff ff       	call   800a8b <write>
+  801aeb:	83 c4 10             	add    $0x10,%esp
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	7e 04                	jle    801af6 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801af2:	01 c6                	add    %eax,%esi
+  801af4:	eb dc                	jmp    801ad2 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801af6:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801afa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	74 a0                	je     801aa1 <fwrite+0x1e>
+  801b01:	89 f0                	mov    %esi,%eax
+  801b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b08:	f7 75 0c             	divl   0xc(%ebp)
+  801b0b:	eb 94                	jmp    801aa1 <fwrite+0x1e>
+			done += r;
+  801b0d:	01 c7                	add    %eax,%edi
+			continue;
+  801b0f:	eb 34                	jmp    801b45 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b11:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b14:	29 c6                	sub    %eax,%esi
+  801b16:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b19:	29 fa                	sub    %edi,%edx
+  801b1b:	39 d6                	cmp    %edx,%esi
+  801b1d:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b20:	83 ec 04             	sub    $0x4,%esp
+  801b23:	56                   	push   %esi
+  801b24:	89 fa                	mov    %edi,%edx
+  801b26:	03 55 08             	add    0x8(%ebp),%edx
+  801b29:	52                   	push   %edx
+  801b2a:	03 43 0c             	add    0xc(%ebx),%eax
+  801b2d:	50                   	push   %eax
+  801b2e:	e8 d6 1e 00 00       	call   803a09 <memmove>
+		f->f_wend += m;
+  801b33:	89 f0                	mov    %esi,%eax
+  801b35:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b38:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b3b:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b43:	74 5b                	je     801ba0 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b48:	39 c7                	cmp    %eax,%edi
+  801b4a:	73 2d                	jae    801b79 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b4c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	75 be                	jne    801b11 <fwrite+0x8e>
+  801b53:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b56:	29 fa                	sub    %edi,%edx
+  801b58:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b5b:	72 b4                	jb     801b11 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b5d:	83 ec 04             	sub    $0x4,%esp
+  801b60:	52                   	push   %edx
+  801b61:	89 f8                	mov    %edi,%eax
+  801b63:	03 45 08             	add    0x8(%ebp),%eax
+  801b66:	50                   	push   %eax
+  801b67:	ff 33                	push   (%ebx)
+  801b69:	e8 1d ef ff ff       	call   800a8b <write>
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	7f 98                	jg     801b0d <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b75:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b79:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b7c:	83 f8 03             	cmp    $0x3,%eax
+  801b7f:	74 48                	je     801bc9 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b81:	83 f8 02             	cmp    $0x2,%eax
+  801b84:	74 27                	je     801bad <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	0f 84 10 ff ff ff    	je     801aa1 <fwrite+0x1e>
+  801b91:	89 f8                	mov    %edi,%eax
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	f7 75 0c             	divl   0xc(%ebp)
+  801b9b:	e9 01 ff ff ff       	jmp    801aa1 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801ba0:	89 d8                	mov    %ebx,%eax
+  801ba2:	e8 ce f9 ff ff       	call   801575 <stream_drain>
+  801ba7:	85 c0                	test   %eax,%eax
+  801ba9:	79 9a                	jns    801b45 <fwrite+0xc2>
+  801bab:	eb cc                	jmp    801b79 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801bad:	83 ec 04             	sub    $0x4,%esp
+  801bb0:	57                   	push   %edi
+  801bb1:	6a 0a                	push   $0xa
+  801bb3:	ff 75 08             	push   0x8(%ebp)
+  801bb6:	e8 ff 1e 00 00       	call   803aba <memfind>
+  801bbb:	89 c2                	mov    %eax,%edx
+  801bbd:	89 f8                	mov    %edi,%eax
+  801bbf:	03 45 08             	add    0x8(%ebp),%eax
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	39 c2                	cmp    %eax,%edx
+  801bc7:	74 bd                	je     801b86 <fwrite+0x103>
+		stream_drain(f);
+  801bc9:	89 d8                	mov    %ebx,%eax
+  801bcb:	e8 a5 f9 ff ff       	call   801575 <stream_drain>
+  801bd0:	eb b4                	jmp    801b86 <fwrite+0x103>
+
+00801bd2 <fputc>:
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	53                   	push   %ebx
+  801bd6:	83 ec 14             	sub    $0x14,%esp
+  801bd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bdc:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bdf:	ff 75 0c             	push   0xc(%ebp)
+  801be2:	6a 01                	push   $0x1
+  801be4:	6a 01                	push   $0x1
+  801be6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801be9:	50                   	push   %eax
+  801bea:	e8 94 fe ff ff       	call   801a83 <fwrite>
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	0f b6 db             	movzbl %bl,%ebx
+  801bf5:	83 f8 01             	cmp    $0x1,%eax
+  801bf8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bfd:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+
+00801c05 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c0b:	ff 75 0c             	push   0xc(%ebp)
+  801c0e:	ff 75 08             	push   0x8(%ebp)
+  801c11:	e8 bc ff ff ff       	call   801bd2 <fputc>
+}
+  801c16:	83 c4 10             	add    $0x10,%esp
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <fputs>:
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	56                   	push   %esi
+  801c1f:	53                   	push   %ebx
+  801c20:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c23:	83 ec 0c             	sub    $0xc,%esp
+  801c26:	56                   	push   %esi
+  801c27:	e8 1c 1c 00 00       	call   803848 <strlen>
+  801c2c:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	50                   	push   %eax
+  801c32:	6a 01                	push   $0x1
+  801c34:	56                   	push   %esi
+  801c35:	e8 49 fe ff ff       	call   801a83 <fwrite>
+  801c3a:	83 c4 20             	add    $0x20,%esp
+  801c3d:	39 d8                	cmp    %ebx,%eax
+  801c3f:	0f 95 c0             	setne  %al
+  801c42:	0f b6 c0             	movzbl %al,%eax
+  801c45:	f7 d8                	neg    %eax
+}
+  801c47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c4a:	5b                   	pop    %ebx
+  801c4b:	5e                   	pop    %esi
+  801c4c:	5d                   	pop    %ebp
+  801c4d:	c3                   	ret
+
+00801c4e <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	53                   	push   %ebx
+  801c52:	83 ec 04             	sub    $0x4,%esp
+  801c55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c58:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c5b:	50                   	push   %eax
+  801c5c:	ff 75 0c             	push   0xc(%ebp)
+  801c5f:	53                   	push   %ebx
+  801c60:	68 05 1c 80 00       	push   $0x801c05
+  801c65:	e8 2c 17 00 00       	call   803396 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c6a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c6d:	c1 e0 1c             	shl    $0x1c,%eax
+  801c70:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+
+00801c78 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c78:	55                   	push   %ebp
+  801c79:	89 e5                	mov    %esp,%ebp
+  801c7b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c7e:	68 f0 47 80 00       	push   $0x8047f0
+  801c83:	ff 75 0c             	push   0xc(%ebp)
+  801c86:	e8 f8 1b 00 00       	call   803883 <strcpy>
+	return 0;
+}
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c90:	c9                   	leave
+  801c91:	c3                   	ret
+
+00801c92 <devsock_close>:
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	53                   	push   %ebx
+  801c96:	83 ec 10             	sub    $0x10,%esp
+  801c99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c9c:	53                   	push   %ebx
+  801c9d:	e8 26 27 00 00       	call   8043c8 <pageref>
+  801ca2:	89 c2                	mov    %eax,%edx
+  801ca4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cac:	83 fa 01             	cmp    $0x1,%edx
+  801caf:	74 05                	je     801cb6 <devsock_close+0x24>
+}
+  801cb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb4:	c9                   	leave
+  801cb5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	ff 73 0c             	push   0xc(%ebx)
+  801cbc:	e8 b7 02 00 00       	call   801f78 <nsipc_close>
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	eb eb                	jmp    801cb1 <devsock_close+0x1f>
+
+00801cc6 <devsock_write>:
+{
+  801cc6:	55                   	push   %ebp
+  801cc7:	89 e5                	mov    %esp,%ebp
+  801cc9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ccc:	6a 00                	push   $0x0
+  801cce:	ff 75 10             	push   0x10(%ebp)
+  801cd1:	ff 75 0c             	push   0xc(%ebp)
+  801cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd7:	ff 70 0c             	push   0xc(%eax)
+  801cda:	e8 79 03 00 00       	call   802058 <nsipc_send>
+}
+  801cdf:	c9                   	leave
+  801ce0:	c3                   	ret
+
+00801ce1 <devsock_read>:
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ce7:	6a 00                	push   $0x0
+  801ce9:	ff 75 10             	push   0x10(%ebp)
+  801cec:	ff 75 0c             	push   0xc(%ebp)
+  801cef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf2:	ff 70 0c             	push   0xc(%eax)
+  801cf5:	e8 ef 02 00 00       	call   801fe9 <nsipc_recv>
+}
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+00801cfc <fd2sockid>:
+{
+  801cfc:	55                   	push   %ebp
+  801cfd:	89 e5                	mov    %esp,%ebp
+  801cff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d02:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d05:	52                   	push   %edx
+  801d06:	50                   	push   %eax
+  801d07:	e8 f7 e9 ff ff       	call   800703 <fd_lookup>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	78 10                	js     801d23 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d16:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d1c:	39 08                	cmp    %ecx,(%eax)
+  801d1e:	75 05                	jne    801d25 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d20:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d23:	c9                   	leave
+  801d24:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2a:	eb f7                	jmp    801d23 <fd2sockid+0x27>
+
+00801d2c <alloc_sockfd>:
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	56                   	push   %esi
+  801d30:	53                   	push   %ebx
+  801d31:	83 ec 1c             	sub    $0x1c,%esp
+  801d34:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d39:	50                   	push   %eax
+  801d3a:	e8 6e e9 ff ff       	call   8006ad <fd_alloc>
+  801d3f:	89 c3                	mov    %eax,%ebx
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 43                	js     801d8b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d48:	83 ec 04             	sub    $0x4,%esp
+  801d4b:	68 07 04 00 00       	push   $0x407
+  801d50:	ff 75 f4             	push   -0xc(%ebp)
+  801d53:	6a 00                	push   $0x0
+  801d55:	e8 8a e4 ff ff       	call   8001e4 <sys_page_alloc>
+  801d5a:	89 c3                	mov    %eax,%ebx
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	85 c0                	test   %eax,%eax
+  801d61:	78 28                	js     801d8b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d66:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d6c:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d71:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d78:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d7b:	83 ec 0c             	sub    $0xc,%esp
+  801d7e:	50                   	push   %eax
+  801d7f:	e8 02 e9 ff ff       	call   800686 <fd2num>
+  801d84:	89 c3                	mov    %eax,%ebx
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	eb 0c                	jmp    801d97 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d8b:	83 ec 0c             	sub    $0xc,%esp
+  801d8e:	56                   	push   %esi
+  801d8f:	e8 e4 01 00 00       	call   801f78 <nsipc_close>
+		return r;
+  801d94:	83 c4 10             	add    $0x10,%esp
+}
+  801d97:	89 d8                	mov    %ebx,%eax
+  801d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+
+00801da0 <accept>:
+{
+  801da0:	55                   	push   %ebp
+  801da1:	89 e5                	mov    %esp,%ebp
+  801da3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da9:	e8 4e ff ff ff       	call   801cfc <fd2sockid>
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	78 1b                	js     801dcd <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801db2:	83 ec 04             	sub    $0x4,%esp
+  801db5:	ff 75 10             	push   0x10(%ebp)
+  801db8:	ff 75 0c             	push   0xc(%ebp)
+  801dbb:	50                   	push   %eax
+  801dbc:	e8 0e 01 00 00       	call   801ecf <nsipc_accept>
+  801dc1:	83 c4 10             	add    $0x10,%esp
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	78 05                	js     801dcd <accept+0x2d>
+	return alloc_sockfd(r);
+  801dc8:	e8 5f ff ff ff       	call   801d2c <alloc_sockfd>
+}
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+
+00801dcf <bind>:
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd8:	e8 1f ff ff ff       	call   801cfc <fd2sockid>
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	78 12                	js     801df3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801de1:	83 ec 04             	sub    $0x4,%esp
+  801de4:	ff 75 10             	push   0x10(%ebp)
+  801de7:	ff 75 0c             	push   0xc(%ebp)
+  801dea:	50                   	push   %eax
+  801deb:	e8 31 01 00 00       	call   801f21 <nsipc_bind>
+  801df0:	83 c4 10             	add    $0x10,%esp
+}
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+00801df5 <shutdown>:
+{
+  801df5:	55                   	push   %ebp
+  801df6:	89 e5                	mov    %esp,%ebp
+  801df8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfe:	e8 f9 fe ff ff       	call   801cfc <fd2sockid>
+  801e03:	85 c0                	test   %eax,%eax
+  801e05:	78 0f                	js     801e16 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e07:	83 ec 08             	sub    $0x8,%esp
+  801e0a:	ff 75 0c             	push   0xc(%ebp)
+  801e0d:	50                   	push   %eax
+  801e0e:	e8 43 01 00 00       	call   801f56 <nsipc_shutdown>
+  801e13:	83 c4 10             	add    $0x10,%esp
+}
+  801e16:	c9                   	leave
+  801e17:	c3                   	ret
+
+00801e18 <connect>:
+{
+  801e18:	55                   	push   %ebp
+  801e19:	89 e5                	mov    %esp,%ebp
+  801e1b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e21:	e8 d6 fe ff ff       	call   801cfc <fd2sockid>
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 12                	js     801e3c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e2a:	83 ec 04             	sub    $0x4,%esp
+  801e2d:	ff 75 10             	push   0x10(%ebp)
+  801e30:	ff 75 0c             	push   0xc(%ebp)
+  801e33:	50                   	push   %eax
+  801e34:	e8 59 01 00 00       	call   801f92 <nsipc_connect>
+  801e39:	83 c4 10             	add    $0x10,%esp
+}
+  801e3c:	c9                   	leave
+  801e3d:	c3                   	ret
+
+00801e3e <listen>:
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e47:	e8 b0 fe ff ff       	call   801cfc <fd2sockid>
+  801e4c:	85 c0                	test   %eax,%eax
+  801e4e:	78 0f                	js     801e5f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e50:	83 ec 08             	sub    $0x8,%esp
+  801e53:	ff 75 0c             	push   0xc(%ebp)
+  801e56:	50                   	push   %eax
+  801e57:	e8 6b 01 00 00       	call   801fc7 <nsipc_listen>
+  801e5c:	83 c4 10             	add    $0x10,%esp
+}
+  801e5f:	c9                   	leave
+  801e60:	c3                   	ret
+
+00801e61 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e67:	ff 75 10             	push   0x10(%ebp)
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	ff 75 08             	push   0x8(%ebp)
+  801e70:	e8 41 02 00 00       	call   8020b6 <nsipc_socket>
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 05                	js     801e81 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e7c:	e8 ab fe ff ff       	call   801d2c <alloc_sockfd>
+}
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+
+00801e83 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	53                   	push   %ebx
+  801e87:	83 ec 04             	sub    $0x4,%esp
+  801e8a:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e8c:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e93:	74 26                	je     801ebb <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e95:	6a 07                	push   $0x7
+  801e97:	68 00 80 80 00       	push   $0x808000
+  801e9c:	53                   	push   %ebx
+  801e9d:	ff 35 08 60 80 00    	push   0x806008
+  801ea3:	e8 8b 24 00 00       	call   804333 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ea8:	83 c4 0c             	add    $0xc,%esp
+  801eab:	6a 00                	push   $0x0
+  801ead:	6a 00                	push   $0x0
+  801eaf:	6a 00                	push   $0x0
+  801eb1:	e8 87 23 00 00       	call   80423d <ipc_recv>
+}
+  801eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	6a 02                	push   $0x2
+  801ec0:	e8 c4 24 00 00       	call   804389 <ipc_find_env>
+  801ec5:	a3 08 60 80 00       	mov    %eax,0x806008
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	eb c6                	jmp    801e95 <nsipc+0x12>
+
+00801ecf <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	56                   	push   %esi
+  801ed3:	53                   	push   %ebx
+  801ed4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eda:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801edf:	8b 06                	mov    (%esi),%eax
+  801ee1:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ee6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eeb:	e8 93 ff ff ff       	call   801e83 <nsipc>
+  801ef0:	89 c3                	mov    %eax,%ebx
+  801ef2:	85 c0                	test   %eax,%eax
+  801ef4:	79 09                	jns    801eff <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ef6:	89 d8                	mov    %ebx,%eax
+  801ef8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801efb:	5b                   	pop    %ebx
+  801efc:	5e                   	pop    %esi
+  801efd:	5d                   	pop    %ebp
+  801efe:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801eff:	83 ec 04             	sub    $0x4,%esp
+  801f02:	ff 35 10 80 80 00    	push   0x808010
+  801f08:	68 00 80 80 00       	push   $0x808000
+  801f0d:	ff 75 0c             	push   0xc(%ebp)
+  801f10:	e8 f4 1a 00 00       	call   803a09 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f15:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f1a:	89 06                	mov    %eax,(%esi)
+  801f1c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f1f:	eb d5                	jmp    801ef6 <nsipc_accept+0x27>
+
+00801f21 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	53                   	push   %ebx
+  801f25:	83 ec 08             	sub    $0x8,%esp
+  801f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f33:	53                   	push   %ebx
+  801f34:	ff 75 0c             	push   0xc(%ebp)
+  801f37:	68 04 80 80 00       	push   $0x808004
+  801f3c:	e8 c8 1a 00 00       	call   803a09 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f41:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f47:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f4c:	e8 32 ff ff ff       	call   801e83 <nsipc>
+}
+  801f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+
+00801f56 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f67:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f71:	e8 0d ff ff ff       	call   801e83 <nsipc>
+}
+  801f76:	c9                   	leave
+  801f77:	c3                   	ret
+
+00801f78 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f81:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f86:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f8b:	e8 f3 fe ff ff       	call   801e83 <nsipc>
+}
+  801f90:	c9                   	leave
+  801f91:	c3                   	ret
+
+00801f92 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f92:	55                   	push   %ebp
+  801f93:	89 e5                	mov    %esp,%ebp
+  801f95:	53                   	push   %ebx
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  801f99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fa4:	53                   	push   %ebx
+  801fa5:	ff 75 0c             	push   0xc(%ebp)
+  801fa8:	68 04 80 80 00       	push   $0x808004
+  801fad:	e8 57 1a 00 00       	call   803a09 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fb2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fb8:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fbd:	e8 c1 fe ff ff       	call   801e83 <nsipc>
+}
+  801fc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+00801fc7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd8:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fdd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fe2:	e8 9c fe ff ff       	call   801e83 <nsipc>
+}
+  801fe7:	c9                   	leave
+  801fe8:	c3                   	ret
+
+00801fe9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	56                   	push   %esi
+  801fed:	53                   	push   %ebx
+  801fee:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801ff9:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802002:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802007:	b8 07 00 00 00       	mov    $0x7,%eax
+  80200c:	e8 72 fe ff ff       	call   801e83 <nsipc>
+  802011:	89 c3                	mov    %eax,%ebx
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 22                	js     802039 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802017:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80201c:	39 c6                	cmp    %eax,%esi
+  80201e:	0f 4e c6             	cmovle %esi,%eax
+  802021:	39 c3                	cmp    %eax,%ebx
+  802023:	7f 1d                	jg     802042 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802025:	83 ec 04             	sub    $0x4,%esp
+  802028:	53                   	push   %ebx
+  802029:	68 00 80 80 00       	push   $0x808000
+  80202e:	ff 75 0c             	push   0xc(%ebp)
+  802031:	e8 d3 19 00 00       	call   803a09 <memmove>
+  802036:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802039:	89 d8                	mov    %ebx,%eax
+  80203b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203e:	5b                   	pop    %ebx
+  80203f:	5e                   	pop    %esi
+  802040:	5d                   	pop    %ebp
+  802041:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802042:	68 fc 47 80 00       	push   $0x8047fc
+  802047:	68 b5 47 80 00       	push   $0x8047b5
+  80204c:	6a 62                	push   $0x62
+  80204e:	68 11 48 80 00       	push   $0x804811
+  802053:	e8 6c 11 00 00       	call   8031c4 <_panic>
+
+00802058 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	53                   	push   %ebx
+  80205c:	83 ec 04             	sub    $0x4,%esp
+  80205f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802062:	8b 45 08             	mov    0x8(%ebp),%eax
+  802065:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80206a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802070:	7f 2e                	jg     8020a0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802072:	83 ec 04             	sub    $0x4,%esp
+  802075:	53                   	push   %ebx
+  802076:	ff 75 0c             	push   0xc(%ebp)
+  802079:	68 0c 80 80 00       	push   $0x80800c
+  80207e:	e8 86 19 00 00       	call   803a09 <memmove>
+	nsipcbuf.send.req_size = size;
+  802083:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802089:	8b 45 14             	mov    0x14(%ebp),%eax
+  80208c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802091:	b8 08 00 00 00       	mov    $0x8,%eax
+  802096:	e8 e8 fd ff ff       	call   801e83 <nsipc>
+}
+  80209b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+	assert(size < 1600);
+  8020a0:	68 1d 48 80 00       	push   $0x80481d
+  8020a5:	68 b5 47 80 00       	push   $0x8047b5
+  8020aa:	6a 6d                	push   $0x6d
+  8020ac:	68 11 48 80 00       	push   $0x804811
+  8020b1:	e8 0e 11 00 00       	call   8031c4 <_panic>
+
+008020b6 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c7:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cf:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020d4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020d9:	e8 a5 fd ff ff       	call   801e83 <nsipc>
+}
+  8020de:	c9                   	leave
+  8020df:	c3                   	ret
+
+008020e0 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	53                   	push   %ebx
+  8020e4:	83 ec 10             	sub    $0x10,%esp
+  8020e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020ea:	68 0c 60 80 00       	push   $0x80600c
+  8020ef:	e8 50 07 00 00       	call   802844 <mutex_lock>
+	if (v == 0)
+  8020f4:	83 c4 10             	add    $0x10,%esp
+  8020f7:	85 db                	test   %ebx,%ebx
+  8020f9:	0f 84 85 00 00 00    	je     802184 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8020ff:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802105:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80210a:	77 51                	ja     80215d <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80210c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802112:	89 d8                	mov    %ebx,%eax
+  802114:	c1 e8 0c             	shr    $0xc,%eax
+  802117:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80211e:	f6 c4 02             	test   $0x2,%ah
+  802121:	74 50                	je     802173 <free+0x93>
+		sys_page_unmap(0, c);
+  802123:	83 ec 08             	sub    $0x8,%esp
+  802126:	53                   	push   %ebx
+  802127:	6a 00                	push   $0x0
+  802129:	e8 4f e1 ff ff       	call   80027d <sys_page_unmap>
+		c += PGSIZE;
+  80212e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802134:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80213a:	83 c4 10             	add    $0x10,%esp
+  80213d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802142:	76 ce                	jbe    802112 <free+0x32>
+  802144:	68 67 48 80 00       	push   $0x804867
+  802149:	68 b5 47 80 00       	push   $0x8047b5
+  80214e:	68 82 00 00 00       	push   $0x82
+  802153:	68 5a 48 80 00       	push   $0x80485a
+  802158:	e8 67 10 00 00       	call   8031c4 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80215d:	68 2c 48 80 00       	push   $0x80482c
+  802162:	68 b5 47 80 00       	push   $0x8047b5
+  802167:	6a 7b                	push   $0x7b
+  802169:	68 5a 48 80 00       	push   $0x80485a
+  80216e:	e8 51 10 00 00       	call   8031c4 <_panic>
+	if (--(*ref) == 0)
+  802173:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802179:	83 e8 01             	sub    $0x1,%eax
+  80217c:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802182:	74 15                	je     802199 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	68 0c 60 80 00       	push   $0x80600c
+  80218c:	e8 20 07 00 00       	call   8028b1 <mutex_unlock>
+}
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+		sys_page_unmap(0, c);
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	53                   	push   %ebx
+  80219d:	6a 00                	push   $0x0
+  80219f:	e8 d9 e0 ff ff       	call   80027d <sys_page_unmap>
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	eb db                	jmp    802184 <free+0xa4>
+
+008021a9 <malloc>:
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	57                   	push   %edi
+  8021ad:	56                   	push   %esi
+  8021ae:	53                   	push   %ebx
+  8021af:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021b2:	68 0c 60 80 00       	push   $0x80600c
+  8021b7:	e8 88 06 00 00       	call   802844 <mutex_lock>
+	if (mptr == 0)
+  8021bc:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	85 ff                	test   %edi,%edi
+  8021c7:	74 6c                	je     802235 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cc:	83 c0 03             	add    $0x3,%eax
+  8021cf:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021d2:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021d4:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021d9:	0f 87 64 01 00 00    	ja     802343 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021df:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021e5:	74 30                	je     802217 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021e7:	89 f9                	mov    %edi,%ecx
+  8021e9:	c1 e9 0c             	shr    $0xc,%ecx
+  8021ec:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021f0:	c1 e8 0c             	shr    $0xc,%eax
+  8021f3:	39 c1                	cmp    %eax,%ecx
+  8021f5:	74 5f                	je     802256 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021f7:	83 ec 0c             	sub    $0xc,%esp
+  8021fa:	57                   	push   %edi
+  8021fb:	e8 e0 fe ff ff       	call   8020e0 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802200:	a1 10 60 80 00       	mov    0x806010,%eax
+  802205:	05 00 10 00 00       	add    $0x1000,%eax
+  80220a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80220f:	a3 10 60 80 00       	mov    %eax,0x806010
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  80221d:	ba 02 00 00 00       	mov    $0x2,%edx
+  802222:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802226:	8d 7e 04             	lea    0x4(%esi),%edi
+  802229:	89 cb                	mov    %ecx,%ebx
+  80222b:	01 f9                	add    %edi,%ecx
+  80222d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802230:	e9 8b 00 00 00       	jmp    8022c0 <malloc+0x117>
+		mptr = mbegin;
+  802235:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80223c:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80223f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802242:	83 c0 03             	add    $0x3,%eax
+  802245:	83 e0 fc             	and    $0xfffffffc,%eax
+  802248:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80224a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80224f:	76 c6                	jbe    802217 <malloc+0x6e>
+  802251:	e9 d6 00 00 00       	jmp    80232c <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802256:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80225c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802261:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802265:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802268:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80226d:	e9 ba 00 00 00       	jmp    80232c <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802272:	05 00 10 00 00       	add    $0x1000,%eax
+  802277:	39 c8                	cmp    %ecx,%eax
+  802279:	0f 83 cb 00 00 00    	jae    80234a <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80227f:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802284:	77 22                	ja     8022a8 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802286:	89 c2                	mov    %eax,%edx
+  802288:	c1 ea 16             	shr    $0x16,%edx
+  80228b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802292:	f6 c2 01             	test   $0x1,%dl
+  802295:	74 db                	je     802272 <malloc+0xc9>
+  802297:	89 c2                	mov    %eax,%edx
+  802299:	c1 ea 0c             	shr    $0xc,%edx
+  80229c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022a3:	f6 c2 01             	test   $0x1,%dl
+  8022a6:	74 ca                	je     802272 <malloc+0xc9>
+		if (mptr == mend) {
+  8022a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022ae:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022b4:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022b8:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022be:	74 04                	je     8022c4 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022c0:	89 d8                	mov    %ebx,%eax
+  8022c2:	eb b3                	jmp    802277 <malloc+0xce>
+  8022c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022c7:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022cc:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022d0:	83 ea 01             	sub    $0x1,%edx
+  8022d3:	0f 85 50 ff ff ff    	jne    802229 <malloc+0x80>
+  8022d9:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022e0:	00 00 08 
+				return 0;	/* out of address space */
+  8022e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e8:	eb 42                	jmp    80232c <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022ea:	85 db                	test   %ebx,%ebx
+  8022ec:	78 1e                	js     80230c <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022ee:	83 ec 08             	sub    $0x8,%esp
+  8022f1:	89 d8                	mov    %ebx,%eax
+  8022f3:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022f9:	50                   	push   %eax
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	e8 7c df ff ff       	call   80027d <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802301:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	eb de                	jmp    8022ea <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80230c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802311:	eb 19                	jmp    80232c <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802313:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802316:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80231c:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802323:	00 
+	mptr += n;
+  802324:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802327:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80232c:	83 ec 0c             	sub    $0xc,%esp
+  80232f:	68 0c 60 80 00       	push   $0x80600c
+  802334:	e8 78 05 00 00       	call   8028b1 <mutex_unlock>
+}
+  802339:	89 f8                	mov    %edi,%eax
+  80233b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80233e:	5b                   	pop    %ebx
+  80233f:	5e                   	pop    %esi
+  802340:	5f                   	pop    %edi
+  802341:	5d                   	pop    %ebp
+  802342:	c3                   	ret
+		return 0;
+  802343:	bf 00 00 00 00       	mov    $0x0,%edi
+  802348:	eb e2                	jmp    80232c <malloc+0x183>
+  80234a:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80234e:	74 06                	je     802356 <malloc+0x1ad>
+  802350:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802356:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80235b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80235e:	39 fb                	cmp    %edi,%ebx
+  802360:	73 b1                	jae    802313 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802362:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802368:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80236b:	39 fe                	cmp    %edi,%esi
+  80236d:	0f 92 c0             	setb   %al
+  802370:	0f b6 c0             	movzbl %al,%eax
+  802373:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802376:	83 c8 07             	or     $0x7,%eax
+  802379:	50                   	push   %eax
+  80237a:	89 d8                	mov    %ebx,%eax
+  80237c:	03 05 10 60 80 00    	add    0x806010,%eax
+  802382:	50                   	push   %eax
+  802383:	6a 00                	push   $0x0
+  802385:	e8 5a de ff ff       	call   8001e4 <sys_page_alloc>
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	0f 88 55 ff ff ff    	js     8022ea <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802395:	89 f3                	mov    %esi,%ebx
+  802397:	eb c5                	jmp    80235e <malloc+0x1b5>
+
+00802399 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802399:	55                   	push   %ebp
+  80239a:	89 e5                	mov    %esp,%ebp
+  80239c:	56                   	push   %esi
+  80239d:	53                   	push   %ebx
+  80239e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023a1:	83 ec 0c             	sub    $0xc,%esp
+  8023a4:	ff 75 08             	push   0x8(%ebp)
+  8023a7:	e8 ea e2 ff ff       	call   800696 <fd2data>
+  8023ac:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023ae:	83 c4 08             	add    $0x8,%esp
+  8023b1:	68 7f 48 80 00       	push   $0x80487f
+  8023b6:	53                   	push   %ebx
+  8023b7:	e8 c7 14 00 00       	call   803883 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023bc:	8b 46 04             	mov    0x4(%esi),%eax
+  8023bf:	2b 06                	sub    (%esi),%eax
+  8023c1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023ce:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023d1:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023d8:	52 80 00 
+	return 0;
+}
+  8023db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e3:	5b                   	pop    %ebx
+  8023e4:	5e                   	pop    %esi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+
+008023e7 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ec:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023f0:	85 c9                	test   %ecx,%ecx
+  8023f2:	75 01                	jne    8023f5 <pipewake+0xe>
+  8023f4:	c3                   	ret
+{
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023fb:	68 00 04 00 00       	push   $0x400
+  802400:	52                   	push   %edx
+  802401:	e8 22 e1 ff ff       	call   800528 <sys_futex_wake>
+  802406:	83 c4 10             	add    $0x10,%esp
+}
+  802409:	c9                   	leave
+  80240a:	c3                   	ret
+
+0080240b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80240b:	55                   	push   %ebp
+  80240c:	89 e5                	mov    %esp,%ebp
+  80240e:	56                   	push   %esi
+  80240f:	53                   	push   %ebx
+  802410:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802413:	83 ec 0c             	sub    $0xc,%esp
+  802416:	56                   	push   %esi
+  802417:	e8 7a e2 ff ff       	call   800696 <fd2data>
+  80241c:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80241e:	83 c4 08             	add    $0x8,%esp
+  802421:	56                   	push   %esi
+  802422:	6a 00                	push   $0x0
+  802424:	e8 54 de ff ff       	call   80027d <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802429:	8d 53 04             	lea    0x4(%ebx),%edx
+  80242c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80242f:	e8 b3 ff ff ff       	call   8023e7 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802434:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802437:	89 da                	mov    %ebx,%edx
+  802439:	e8 a9 ff ff ff       	call   8023e7 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80243e:	89 34 24             	mov    %esi,(%esp)
+  802441:	e8 50 e2 ff ff       	call   800696 <fd2data>
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	50                   	push   %eax
+  80244a:	6a 00                	push   $0x0
+  80244c:	e8 2c de ff ff       	call   80027d <sys_page_unmap>
+}
+  802451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802454:	5b                   	pop    %ebx
+  802455:	5e                   	pop    %esi
+  802456:	5d                   	pop    %ebp
+  802457:	c3                   	ret
+
+00802458 <_pipeisclosed>:
+{
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	57                   	push   %edi
+  80245c:	56                   	push   %esi
+  80245d:	53                   	push   %ebx
+  80245e:	83 ec 1c             	sub    $0x1c,%esp
+  802461:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802464:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802466:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80246b:	eb 5d                	jmp    8024ca <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80246d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802473:	8b 02                	mov    (%edx),%eax
+  802475:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802478:	83 ec 0c             	sub    $0xc,%esp
+  80247b:	ff 75 e0             	push   -0x20(%ebp)
+  80247e:	e8 45 1f 00 00       	call   8043c8 <pageref>
+  802483:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802486:	89 3c 24             	mov    %edi,(%esp)
+  802489:	e8 3a 1f 00 00       	call   8043c8 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80248e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802490:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80249f:	77 15                	ja     8024b6 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024a1:	89 f2                	mov    %esi,%edx
+  8024a3:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8024a5:	c1 ea 10             	shr    $0x10,%edx
+  8024a8:	74 0c                	je     8024b6 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024aa:	c1 e2 10             	shl    $0x10,%edx
+  8024ad:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024b2:	29 d1                	sub    %edx,%ecx
+  8024b4:	eb 06                	jmp    8024bc <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024b6:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024bc:	8b 11                	mov    (%ecx),%edx
+  8024be:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024c1:	39 d3                	cmp    %edx,%ebx
+  8024c3:	74 6e                	je     802533 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024c8:	74 24                	je     8024ee <_pipeisclosed+0x96>
+  8024ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024d7:	77 94                	ja     80246d <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024d9:	89 f0                	mov    %esi,%eax
+  8024db:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024dd:	c1 e8 10             	shr    $0x10,%eax
+  8024e0:	74 8b                	je     80246d <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024e2:	c1 e0 10             	shl    $0x10,%eax
+  8024e5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024ea:	29 c2                	sub    %eax,%edx
+  8024ec:	eb 85                	jmp    802473 <_pipeisclosed+0x1b>
+  8024ee:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024f0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024fb:	77 18                	ja     802515 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802502:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802504:	c1 e8 10             	shr    $0x10,%eax
+  802507:	74 0c                	je     802515 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802509:	c1 e0 10             	shl    $0x10,%eax
+  80250c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802511:	29 c2                	sub    %eax,%edx
+  802513:	eb 06                	jmp    80251b <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802515:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80251b:	8b 02                	mov    (%edx),%eax
+  80251d:	8b 40 58             	mov    0x58(%eax),%eax
+  802520:	6a 01                	push   $0x1
+  802522:	50                   	push   %eax
+  802523:	53                   	push   %ebx
+  802524:	68 86 48 80 00       	push   $0x804886
+  802529:	e8 71 0d 00 00       	call   80329f <cprintf>
+  80252e:	83 c4 10             	add    $0x10,%esp
+  802531:	eb 97                	jmp    8024ca <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802533:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802536:	0f 94 c0             	sete   %al
+  802539:	0f b6 c0             	movzbl %al,%eax
+}
+  80253c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80253f:	5b                   	pop    %ebx
+  802540:	5e                   	pop    %esi
+  802541:	5f                   	pop    %edi
+  802542:	5d                   	pop    %ebp
+  802543:	c3                   	ret
+
+00802544 <devpipe_write>:
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	57                   	push   %edi
+  802548:	56                   	push   %esi
+  802549:	53                   	push   %ebx
+  80254a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80254d:	ff 75 08             	push   0x8(%ebp)
+  802550:	e8 41 e1 ff ff       	call   800696 <fd2data>
+  802555:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802557:	83 c4 10             	add    $0x10,%esp
+  80255a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802561:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802564:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802567:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80256a:	0f 84 96 00 00 00    	je     802606 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802570:	8d 73 08             	lea    0x8(%ebx),%esi
+  802573:	eb 32                	jmp    8025a7 <devpipe_write+0x63>
+  802575:	89 fa                	mov    %edi,%edx
+  802577:	89 f0                	mov    %esi,%eax
+  802579:	e8 69 fe ff ff       	call   8023e7 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80257e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802581:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802584:	ba 01 00 00 00       	mov    $0x1,%edx
+  802589:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80258e:	83 ec 04             	sub    $0x4,%esp
+  802591:	6a 0a                	push   $0xa
+  802593:	50                   	push   %eax
+  802594:	53                   	push   %ebx
+  802595:	e8 5f df ff ff       	call   8004f9 <sys_futex_wait>
+  80259a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80259f:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8025a4:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025a7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025aa:	8b 0b                	mov    (%ebx),%ecx
+  8025ac:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025af:	39 d0                	cmp    %edx,%eax
+  8025b1:	72 1b                	jb     8025ce <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025b3:	89 da                	mov    %ebx,%edx
+  8025b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b8:	e8 9b fe ff ff       	call   802458 <_pipeisclosed>
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	74 b4                	je     802575 <devpipe_write+0x31>
+				return 0;
+  8025c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c9:	5b                   	pop    %ebx
+  8025ca:	5e                   	pop    %esi
+  8025cb:	5f                   	pop    %edi
+  8025cc:	5d                   	pop    %ebp
+  8025cd:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025d4:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025d8:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025db:	89 c2                	mov    %eax,%edx
+  8025dd:	c1 fa 1f             	sar    $0x1f,%edx
+  8025e0:	89 d1                	mov    %edx,%ecx
+  8025e2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025e5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025e8:	83 e2 1f             	and    $0x1f,%edx
+  8025eb:	29 ca                	sub    %ecx,%edx
+  8025ed:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025f1:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025f5:	83 c0 01             	add    $0x1,%eax
+  8025f8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025fb:	83 c6 01             	add    $0x1,%esi
+  8025fe:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802601:	e9 5e ff ff ff       	jmp    802564 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802606:	8d 53 04             	lea    0x4(%ebx),%edx
+  802609:	8d 43 08             	lea    0x8(%ebx),%eax
+  80260c:	e8 d6 fd ff ff       	call   8023e7 <pipewake>
+	return i;
+  802611:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802614:	eb b0                	jmp    8025c6 <devpipe_write+0x82>
+
+00802616 <devpipe_read>:
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	57                   	push   %edi
+  80261a:	56                   	push   %esi
+  80261b:	53                   	push   %ebx
+  80261c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80261f:	ff 75 08             	push   0x8(%ebp)
+  802622:	e8 6f e0 ff ff       	call   800696 <fd2data>
+  802627:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	be 00 00 00 00       	mov    $0x0,%esi
+  802631:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802634:	74 6c                	je     8026a2 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802636:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802639:	eb 25                	jmp    802660 <devpipe_read+0x4a>
+  80263b:	8b 13                	mov    (%ebx),%edx
+  80263d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802642:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802647:	83 ec 04             	sub    $0x4,%esp
+  80264a:	6a 0a                	push   $0xa
+  80264c:	52                   	push   %edx
+  80264d:	57                   	push   %edi
+  80264e:	e8 a6 de ff ff       	call   8004f9 <sys_futex_wait>
+  802653:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802658:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80265d:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802660:	8b 03                	mov    (%ebx),%eax
+  802662:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802665:	75 19                	jne    802680 <devpipe_read+0x6a>
+			if (i > 0)
+  802667:	85 f6                	test   %esi,%esi
+  802669:	75 3a                	jne    8026a5 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80266b:	89 da                	mov    %ebx,%edx
+  80266d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802670:	e8 e3 fd ff ff       	call   802458 <_pipeisclosed>
+  802675:	85 c0                	test   %eax,%eax
+  802677:	74 c2                	je     80263b <devpipe_read+0x25>
+				return 0;
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267e:	eb 31                	jmp    8026b1 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802680:	89 c1                	mov    %eax,%ecx
+  802682:	c1 f9 1f             	sar    $0x1f,%ecx
+  802685:	c1 e9 1b             	shr    $0x1b,%ecx
+  802688:	01 c8                	add    %ecx,%eax
+  80268a:	83 e0 1f             	and    $0x1f,%eax
+  80268d:	29 c8                	sub    %ecx,%eax
+  80268f:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802694:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802697:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80269a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80269d:	83 c6 01             	add    $0x1,%esi
+  8026a0:	eb 8f                	jmp    802631 <devpipe_read+0x1b>
+out:
+  8026a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8026a5:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8026a8:	89 da                	mov    %ebx,%edx
+  8026aa:	e8 38 fd ff ff       	call   8023e7 <pipewake>
+	return i;
+  8026af:	89 f0                	mov    %esi,%eax
+}
+  8026b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b4:	5b                   	pop    %ebx
+  8026b5:	5e                   	pop    %esi
+  8026b6:	5f                   	pop    %edi
+  8026b7:	5d                   	pop    %ebp
+  8026b8:	c3                   	ret
+
+008026b9 <pipe>:
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	56                   	push   %esi
+  8026bd:	53                   	push   %ebx
+  8026be:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c4:	50                   	push   %eax
+  8026c5:	e8 e3 df ff ff       	call   8006ad <fd_alloc>
+  8026ca:	89 c3                	mov    %eax,%ebx
+  8026cc:	83 c4 10             	add    $0x10,%esp
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	0f 88 23 01 00 00    	js     8027fa <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026d7:	83 ec 04             	sub    $0x4,%esp
+  8026da:	68 07 04 00 00       	push   $0x407
+  8026df:	ff 75 f4             	push   -0xc(%ebp)
+  8026e2:	6a 00                	push   $0x0
+  8026e4:	e8 fb da ff ff       	call   8001e4 <sys_page_alloc>
+  8026e9:	89 c3                	mov    %eax,%ebx
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	85 c0                	test   %eax,%eax
+  8026f0:	0f 88 04 01 00 00    	js     8027fa <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026f6:	83 ec 0c             	sub    $0xc,%esp
+  8026f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026fc:	50                   	push   %eax
+  8026fd:	e8 ab df ff ff       	call   8006ad <fd_alloc>
+  802702:	89 c3                	mov    %eax,%ebx
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	85 c0                	test   %eax,%eax
+  802709:	0f 88 db 00 00 00    	js     8027ea <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80270f:	83 ec 04             	sub    $0x4,%esp
+  802712:	68 07 04 00 00       	push   $0x407
+  802717:	ff 75 f0             	push   -0x10(%ebp)
+  80271a:	6a 00                	push   $0x0
+  80271c:	e8 c3 da ff ff       	call   8001e4 <sys_page_alloc>
+  802721:	89 c3                	mov    %eax,%ebx
+  802723:	83 c4 10             	add    $0x10,%esp
+  802726:	85 c0                	test   %eax,%eax
+  802728:	0f 88 bc 00 00 00    	js     8027ea <pipe+0x131>
+	va = fd2data(fd0);
+  80272e:	83 ec 0c             	sub    $0xc,%esp
+  802731:	ff 75 f4             	push   -0xc(%ebp)
+  802734:	e8 5d df ff ff       	call   800696 <fd2data>
+  802739:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80273b:	83 c4 0c             	add    $0xc,%esp
+  80273e:	68 07 04 00 00       	push   $0x407
+  802743:	50                   	push   %eax
+  802744:	6a 00                	push   $0x0
+  802746:	e8 99 da ff ff       	call   8001e4 <sys_page_alloc>
+  80274b:	89 c3                	mov    %eax,%ebx
+  80274d:	83 c4 10             	add    $0x10,%esp
+  802750:	85 c0                	test   %eax,%eax
+  802752:	0f 88 82 00 00 00    	js     8027da <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802758:	83 ec 0c             	sub    $0xc,%esp
+  80275b:	ff 75 f0             	push   -0x10(%ebp)
+  80275e:	e8 33 df ff ff       	call   800696 <fd2data>
+  802763:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80276a:	50                   	push   %eax
+  80276b:	6a 00                	push   $0x0
+  80276d:	56                   	push   %esi
+  80276e:	6a 00                	push   $0x0
+  802770:	e8 bc da ff ff       	call   800231 <sys_page_map>
+  802775:	89 c3                	mov    %eax,%ebx
+  802777:	83 c4 20             	add    $0x20,%esp
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 4e                	js     8027cc <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80277e:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802783:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802786:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802788:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80278b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802792:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802795:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802797:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80279a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027a1:	83 ec 0c             	sub    $0xc,%esp
+  8027a4:	ff 75 f4             	push   -0xc(%ebp)
+  8027a7:	e8 da de ff ff       	call   800686 <fd2num>
+  8027ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027af:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027b1:	83 c4 04             	add    $0x4,%esp
+  8027b4:	ff 75 f0             	push   -0x10(%ebp)
+  8027b7:	e8 ca de ff ff       	call   800686 <fd2num>
+  8027bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027bf:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027c2:	83 c4 10             	add    $0x10,%esp
+  8027c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ca:	eb 2e                	jmp    8027fa <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027cc:	83 ec 08             	sub    $0x8,%esp
+  8027cf:	56                   	push   %esi
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	e8 a6 da ff ff       	call   80027d <sys_page_unmap>
+  8027d7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027da:	83 ec 08             	sub    $0x8,%esp
+  8027dd:	ff 75 f0             	push   -0x10(%ebp)
+  8027e0:	6a 00                	push   $0x0
+  8027e2:	e8 96 da ff ff       	call   80027d <sys_page_unmap>
+  8027e7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027ea:	83 ec 08             	sub    $0x8,%esp
+  8027ed:	ff 75 f4             	push   -0xc(%ebp)
+  8027f0:	6a 00                	push   $0x0
+  8027f2:	e8 86 da ff ff       	call   80027d <sys_page_unmap>
+  8027f7:	83 c4 10             	add    $0x10,%esp
+}
+  8027fa:	89 d8                	mov    %ebx,%eax
+  8027fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ff:	5b                   	pop    %ebx
+  802800:	5e                   	pop    %esi
+  802801:	5d                   	pop    %ebp
+  802802:	c3                   	ret
+
+00802803 <pipeisclosed>:
+{
+  802803:	55                   	push   %ebp
+  802804:	89 e5                	mov    %esp,%ebp
+  802806:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802809:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280c:	50                   	push   %eax
+  80280d:	ff 75 08             	push   0x8(%ebp)
+  802810:	e8 ee de ff ff       	call   800703 <fd_lookup>
+  802815:	83 c4 10             	add    $0x10,%esp
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	78 18                	js     802834 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80281c:	83 ec 0c             	sub    $0xc,%esp
+  80281f:	ff 75 f4             	push   -0xc(%ebp)
+  802822:	e8 6f de ff ff       	call   800696 <fd2data>
+  802827:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802829:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80282c:	e8 27 fc ff ff       	call   802458 <_pipeisclosed>
+  802831:	83 c4 10             	add    $0x10,%esp
+}
+  802834:	c9                   	leave
+  802835:	c3                   	ret
+
+00802836 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802836:	55                   	push   %ebp
+  802837:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802839:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802842:	5d                   	pop    %ebp
+  802843:	c3                   	ret
+
+00802844 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	56                   	push   %esi
+  802848:	53                   	push   %ebx
+  802849:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80284c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802851:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802856:	89 d0                	mov    %edx,%eax
+  802858:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	74 2d                	je     80288d <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802860:	83 f8 02             	cmp    $0x2,%eax
+  802863:	74 08                	je     80286d <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802865:	b8 02 00 00 00       	mov    $0x2,%eax
+  80286a:	f0 87 03             	lock xchg %eax,(%ebx)
+  80286d:	be 02 00 00 00       	mov    $0x2,%esi
+  802872:	eb 15                	jmp    802889 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	6a 00                	push   $0x0
+  802879:	6a 02                	push   $0x2
+  80287b:	53                   	push   %ebx
+  80287c:	e8 78 dc ff ff       	call   8004f9 <sys_futex_wait>
+  802881:	89 f0                	mov    %esi,%eax
+  802883:	f0 87 03             	lock xchg %eax,(%ebx)
+  802886:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	75 e7                	jne    802874 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80288d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802890:	5b                   	pop    %ebx
+  802891:	5e                   	pop    %esi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+
+00802894 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80289a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028a4:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8028a8:	f7 d8                	neg    %eax
+  8028aa:	19 c0                	sbb    %eax,%eax
+  8028ac:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028af:	5d                   	pop    %ebp
+  8028b0:	c3                   	ret
+
+008028b1 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028b1:	55                   	push   %ebp
+  8028b2:	89 e5                	mov    %esp,%ebp
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+  8028b7:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028c2:	83 f8 02             	cmp    $0x2,%eax
+  8028c5:	74 02                	je     8028c9 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028c9:	83 ec 08             	sub    $0x8,%esp
+  8028cc:	6a 01                	push   $0x1
+  8028ce:	52                   	push   %edx
+  8028cf:	e8 54 dc ff ff       	call   800528 <sys_futex_wake>
+  8028d4:	83 c4 10             	add    $0x10,%esp
+}
+  8028d7:	eb ee                	jmp    8028c7 <mutex_unlock+0x16>
+
+008028d9 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028df:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028e5:	5d                   	pop    %ebp
+  8028e6:	c3                   	ret
+
+008028e7 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028e7:	55                   	push   %ebp
+  8028e8:	89 e5                	mov    %esp,%ebp
+  8028ea:	57                   	push   %edi
+  8028eb:	56                   	push   %esi
+  8028ec:	53                   	push   %ebx
+  8028ed:	83 ec 18             	sub    $0x18,%esp
+  8028f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028f6:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028f8:	53                   	push   %ebx
+  8028f9:	e8 b3 ff ff ff       	call   8028b1 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8028fe:	83 c4 0c             	add    $0xc,%esp
+  802901:	ff 75 10             	push   0x10(%ebp)
+  802904:	57                   	push   %edi
+  802905:	56                   	push   %esi
+  802906:	e8 ee db ff ff       	call   8004f9 <sys_futex_wait>
+  80290b:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	be 02 00 00 00       	mov    $0x2,%esi
+  802915:	eb 10                	jmp    802927 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802917:	83 ec 04             	sub    $0x4,%esp
+  80291a:	6a 00                	push   $0x0
+  80291c:	6a 02                	push   $0x2
+  80291e:	53                   	push   %ebx
+  80291f:	e8 d5 db ff ff       	call   8004f9 <sys_futex_wait>
+  802924:	83 c4 10             	add    $0x10,%esp
+  802927:	89 f0                	mov    %esi,%eax
+  802929:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	75 e7                	jne    802917 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802930:	83 ff ec             	cmp    $0xffffffec,%edi
+  802933:	74 05                	je     80293a <cond_timedwait+0x53>
+  802935:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80293a:	89 f8                	mov    %edi,%eax
+  80293c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293f:	5b                   	pop    %ebx
+  802940:	5e                   	pop    %esi
+  802941:	5f                   	pop    %edi
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+
+00802944 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80294a:	6a 00                	push   $0x0
+  80294c:	ff 75 0c             	push   0xc(%ebp)
+  80294f:	ff 75 08             	push   0x8(%ebp)
+  802952:	e8 90 ff ff ff       	call   8028e7 <cond_timedwait>
+}
+  802957:	83 c4 10             	add    $0x10,%esp
+  80295a:	c9                   	leave
+  80295b:	c3                   	ret
+
+0080295c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80295c:	55                   	push   %ebp
+  80295d:	89 e5                	mov    %esp,%ebp
+  80295f:	83 ec 10             	sub    $0x10,%esp
+  802962:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802965:	ba 01 00 00 00       	mov    $0x1,%edx
+  80296a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80296e:	6a 01                	push   $0x1
+  802970:	50                   	push   %eax
+  802971:	e8 b2 db ff ff       	call   800528 <sys_futex_wake>
+}
+  802976:	83 c4 10             	add    $0x10,%esp
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+
+0080297b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	83 ec 10             	sub    $0x10,%esp
+  802981:	8b 45 08             	mov    0x8(%ebp),%eax
+  802984:	ba 01 00 00 00       	mov    $0x1,%edx
+  802989:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80298d:	68 00 04 00 00       	push   $0x400
+  802992:	50                   	push   %eax
+  802993:	e8 90 db ff ff       	call   800528 <sys_futex_wake>
+}
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+0080299d <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8029a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a6:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8029a8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029af:	5d                   	pop    %ebp
+  8029b0:	c3                   	ret
+
+008029b1 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029b1:	55                   	push   %ebp
+  8029b2:	89 e5                	mov    %esp,%ebp
+  8029b4:	53                   	push   %ebx
+  8029b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029b8:	8b 11                	mov    (%ecx),%edx
+  8029ba:	85 d2                	test   %edx,%edx
+  8029bc:	74 14                	je     8029d2 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029be:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029c1:	89 d0                	mov    %edx,%eax
+  8029c3:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029c7:	39 c2                	cmp    %eax,%edx
+  8029c9:	75 ed                	jne    8029b8 <sem_trywait+0x7>
+			return 0;
+  8029cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d0:	eb 05                	jmp    8029d7 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029d2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029da:	c9                   	leave
+  8029db:	c3                   	ret
+
+008029dc <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029dc:	55                   	push   %ebp
+  8029dd:	89 e5                	mov    %esp,%ebp
+  8029df:	57                   	push   %edi
+  8029e0:	56                   	push   %esi
+  8029e1:	53                   	push   %ebx
+  8029e2:	83 ec 1c             	sub    $0x1c,%esp
+  8029e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029e8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029eb:	e8 81 da ff ff       	call   800471 <sys_time_msec>
+  8029f0:	01 f8                	add    %edi,%eax
+  8029f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029f5:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029fa:	eb 28                	jmp    802a24 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a01:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802a06:	83 ec 04             	sub    $0x4,%esp
+  802a09:	56                   	push   %esi
+  802a0a:	6a 00                	push   $0x0
+  802a0c:	53                   	push   %ebx
+  802a0d:	e8 e7 da ff ff       	call   8004f9 <sys_futex_wait>
+  802a12:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a17:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a22:	74 2e                	je     802a52 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+  802a27:	53                   	push   %ebx
+  802a28:	e8 84 ff ff ff       	call   8029b1 <sem_trywait>
+  802a2d:	83 c4 10             	add    $0x10,%esp
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	79 19                	jns    802a4d <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a34:	85 ff                	test   %edi,%edi
+  802a36:	74 c4                	je     8029fc <sem_timedwait+0x20>
+  802a38:	e8 34 da ff ff       	call   800471 <sys_time_msec>
+  802a3d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a40:	29 c6                	sub    %eax,%esi
+  802a42:	85 f6                	test   %esi,%esi
+  802a44:	7f b6                	jg     8029fc <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a46:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a4b:	eb 05                	jmp    802a52 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a55:	5b                   	pop    %ebx
+  802a56:	5e                   	pop    %esi
+  802a57:	5f                   	pop    %edi
+  802a58:	5d                   	pop    %ebp
+  802a59:	c3                   	ret
+
+00802a5a <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a60:	6a 00                	push   $0x0
+  802a62:	ff 75 08             	push   0x8(%ebp)
+  802a65:	e8 72 ff ff ff       	call   8029dc <sem_timedwait>
+}
+  802a6a:	83 c4 10             	add    $0x10,%esp
+  802a6d:	c9                   	leave
+  802a6e:	c3                   	ret
+
+00802a6f <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	83 ec 08             	sub    $0x8,%esp
+  802a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a78:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a7d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a81:	8b 50 04             	mov    0x4(%eax),%edx
+  802a84:	85 d2                	test   %edx,%edx
+  802a86:	75 02                	jne    802a8a <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a88:	c9                   	leave
+  802a89:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a8a:	83 ec 08             	sub    $0x8,%esp
+  802a8d:	6a 01                	push   $0x1
+  802a8f:	50                   	push   %eax
+  802a90:	e8 93 da ff ff       	call   800528 <sys_futex_wake>
+  802a95:	83 c4 10             	add    $0x10,%esp
+}
+  802a98:	eb ee                	jmp    802a88 <sem_post+0x19>
+
+00802a9a <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a9a:	55                   	push   %ebp
+  802a9b:	89 e5                	mov    %esp,%ebp
+  802a9d:	57                   	push   %edi
+  802a9e:	56                   	push   %esi
+  802a9f:	53                   	push   %ebx
+  802aa0:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802aa3:	68 20 60 80 00       	push   $0x806020
+  802aa8:	e8 97 fd ff ff       	call   802844 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802aad:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ab2:	83 c4 10             	add    $0x10,%esp
+  802ab5:	85 c0                	test   %eax,%eax
+  802ab7:	75 19                	jne    802ad2 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802ab9:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802abe:	8b 00                	mov    (%eax),%eax
+  802ac0:	8b 40 48             	mov    0x48(%eax),%eax
+  802ac3:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802ac8:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802acf:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ad2:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ad7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ada:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ae1:	8b 40 04             	mov    0x4(%eax),%eax
+  802ae4:	85 c0                	test   %eax,%eax
+  802ae6:	0f 84 e4 00 00 00    	je     802bd0 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802aec:	83 c3 01             	add    $0x1,%ebx
+  802aef:	83 fb 20             	cmp    $0x20,%ebx
+  802af2:	75 e3                	jne    802ad7 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802af4:	83 ec 0c             	sub    $0xc,%esp
+  802af7:	68 20 60 80 00       	push   $0x806020
+  802afc:	e8 b0 fd ff ff       	call   8028b1 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b09:	e9 b8 00 00 00       	jmp    802bc6 <pthread_create+0x12c>
+  802b0e:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b11:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b14:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b16:	39 f3                	cmp    %esi,%ebx
+  802b18:	73 16                	jae    802b30 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b1a:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b20:	83 ec 08             	sub    $0x8,%esp
+  802b23:	56                   	push   %esi
+  802b24:	6a 00                	push   $0x0
+  802b26:	e8 52 d7 ff ff       	call   80027d <sys_page_unmap>
+  802b2b:	83 c4 10             	add    $0x10,%esp
+  802b2e:	eb e6                	jmp    802b16 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b30:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b33:	83 ec 08             	sub    $0x8,%esp
+  802b36:	ff 75 e4             	push   -0x1c(%ebp)
+  802b39:	6a 00                	push   $0x0
+  802b3b:	e8 3d d7 ff ff       	call   80027d <sys_page_unmap>
+	return r;
+  802b40:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b43:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b46:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b4d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b54:	eb 70                	jmp    802bc6 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b56:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b59:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b63:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b66:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b69:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b6c:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b73:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b78:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b7b:	29 c8                	sub    %ecx,%eax
+  802b7d:	85 db                	test   %ebx,%ebx
+  802b7f:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b86:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b89:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b90:	83 ec 04             	sub    $0x4,%esp
+  802b93:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b98:	29 ca                	sub    %ecx,%edx
+  802b9a:	52                   	push   %edx
+	*--esp = 0;
+  802b9b:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b9e:	50                   	push   %eax
+  802b9f:	68 f7 2d 80 00       	push   $0x802df7
+  802ba4:	e8 24 da ff ff       	call   8005cd <sys_thread_create>
+  802ba9:	89 c7                	mov    %eax,%edi
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 91                	js     802b43 <pthread_create+0xa9>
+	th->th_env = id;
+  802bb2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bb5:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbf:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bc6:	89 f8                	mov    %edi,%eax
+  802bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bcb:	5b                   	pop    %ebx
+  802bcc:	5e                   	pop    %esi
+  802bcd:	5f                   	pop    %edi
+  802bce:	5d                   	pop    %ebp
+  802bcf:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bd0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bd3:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bda:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802be1:	83 ec 0c             	sub    $0xc,%esp
+  802be4:	68 20 60 80 00       	push   $0x806020
+  802be9:	e8 c3 fc ff ff       	call   8028b1 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802bee:	89 d9                	mov    %ebx,%ecx
+  802bf0:	c1 e1 10             	shl    $0x10,%ecx
+  802bf3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802bf6:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802bfb:	29 c8                	sub    %ecx,%eax
+  802bfd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802c00:	c1 e8 16             	shr    $0x16,%eax
+  802c03:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c0a:	83 c4 10             	add    $0x10,%esp
+  802c0d:	a8 01                	test   $0x1,%al
+  802c0f:	74 15                	je     802c26 <pthread_create+0x18c>
+  802c11:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c14:	c1 e8 0c             	shr    $0xc,%eax
+  802c17:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c1e:	a8 01                	test   $0x1,%al
+  802c20:	0f 85 30 ff ff ff    	jne    802b56 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c26:	83 ec 04             	sub    $0x4,%esp
+  802c29:	6a 07                	push   $0x7
+  802c2b:	ff 75 e4             	push   -0x1c(%ebp)
+  802c2e:	6a 00                	push   $0x0
+  802c30:	e8 af d5 ff ff       	call   8001e4 <sys_page_alloc>
+  802c35:	89 c7                	mov    %eax,%edi
+  802c37:	83 c4 10             	add    $0x10,%esp
+  802c3a:	85 c0                	test   %eax,%eax
+  802c3c:	0f 88 01 ff ff ff    	js     802b43 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c42:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c47:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c4a:	29 d0                	sub    %edx,%eax
+  802c4c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c4f:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c51:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c56:	29 d0                	sub    %edx,%eax
+  802c58:	89 c7                	mov    %eax,%edi
+  802c5a:	39 fe                	cmp    %edi,%esi
+  802c5c:	0f 83 f4 fe ff ff    	jae    802b56 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c62:	83 ec 04             	sub    $0x4,%esp
+  802c65:	6a 07                	push   $0x7
+  802c67:	56                   	push   %esi
+  802c68:	6a 00                	push   $0x0
+  802c6a:	e8 75 d5 ff ff       	call   8001e4 <sys_page_alloc>
+  802c6f:	83 c4 10             	add    $0x10,%esp
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	0f 88 94 fe ff ff    	js     802b0e <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c7a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c80:	eb d8                	jmp    802c5a <pthread_create+0x1c0>
+
+00802c82 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	57                   	push   %edi
+  802c86:	56                   	push   %esi
+  802c87:	53                   	push   %ebx
+  802c88:	83 ec 0c             	sub    $0xc,%esp
+  802c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c8e:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c91:	83 f8 1e             	cmp    $0x1e,%eax
+  802c94:	0f 87 c7 00 00 00    	ja     802d61 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c9a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c9c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ca2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ca7:	77 12                	ja     802cbb <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ca9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802cae:	29 d0                	sub    %edx,%eax
+  802cb0:	c1 e8 10             	shr    $0x10,%eax
+  802cb3:	39 c3                	cmp    %eax,%ebx
+  802cb5:	0f 84 ad 00 00 00    	je     802d68 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cbb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cbe:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cc5:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802ccc:	eb 10                	jmp    802cde <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cce:	83 ec 04             	sub    $0x4,%esp
+  802cd1:	6a 00                	push   $0x0
+  802cd3:	6a 01                	push   $0x1
+  802cd5:	57                   	push   %edi
+  802cd6:	e8 1e d8 ff ff       	call   8004f9 <sys_futex_wait>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cde:	8b 46 04             	mov    0x4(%esi),%eax
+  802ce1:	83 f8 01             	cmp    $0x1,%eax
+  802ce4:	74 e8                	je     802cce <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802ce6:	83 f8 02             	cmp    $0x2,%eax
+  802ce9:	0f 85 80 00 00 00    	jne    802d6f <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cef:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802cf2:	c1 e6 02             	shl    $0x2,%esi
+  802cf5:	eb 05                	jmp    802cfc <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802cf7:	e8 bc d4 ff ff       	call   8001b8 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cfc:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802d02:	89 ca                	mov    %ecx,%edx
+  802d04:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d0a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d0d:	c1 e0 04             	shl    $0x4,%eax
+  802d10:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d15:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d18:	39 c1                	cmp    %eax,%ecx
+  802d1a:	75 12                	jne    802d2e <pthread_join+0xac>
+  802d1c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d1f:	c1 e0 04             	shl    $0x4,%eax
+  802d22:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d27:	8b 40 54             	mov    0x54(%eax),%eax
+  802d2a:	85 c0                	test   %eax,%eax
+  802d2c:	75 c9                	jne    802cf7 <pthread_join+0x75>
+	if (ret_store)
+  802d2e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d32:	74 0f                	je     802d43 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d34:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d37:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d3e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d41:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d43:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d46:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d4d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d5c:	5b                   	pop    %ebx
+  802d5d:	5e                   	pop    %esi
+  802d5e:	5f                   	pop    %edi
+  802d5f:	5d                   	pop    %ebp
+  802d60:	c3                   	ret
+		return -E_INVAL;
+  802d61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d66:	eb f1                	jmp    802d59 <pthread_join+0xd7>
+  802d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6d:	eb ea                	jmp    802d59 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d74:	eb e3                	jmp    802d59 <pthread_join+0xd7>
+
+00802d76 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d76:	55                   	push   %ebp
+  802d77:	89 e5                	mov    %esp,%ebp
+  802d79:	53                   	push   %ebx
+  802d7a:	83 ec 04             	sub    $0x4,%esp
+  802d7d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d7f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d85:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d8a:	77 0c                	ja     802d98 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d8c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d91:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d93:	c1 e8 10             	shr    $0x10,%eax
+  802d96:	75 0a                	jne    802da2 <pthread_exit+0x2c>
+		exit();
+  802d98:	e8 25 d3 ff ff       	call   8000c2 <exit>
+  802d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802da2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802da9:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802dac:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802db3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802db6:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802db9:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802dc0:	83 ec 08             	sub    $0x8,%esp
+  802dc3:	6a 20                	push   $0x20
+  802dc5:	01 c2                	add    %eax,%edx
+  802dc7:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dce:	50                   	push   %eax
+  802dcf:	e8 54 d7 ff ff       	call   800528 <sys_futex_wake>
+	sys_env_destroy(0);
+  802dd4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802ddb:	e8 61 d3 ff ff       	call   800141 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802de0:	83 c4 0c             	add    $0xc,%esp
+  802de3:	68 9e 48 80 00       	push   $0x80489e
+  802de8:	68 a5 00 00 00       	push   $0xa5
+  802ded:	68 b8 48 80 00       	push   $0x8048b8
+  802df2:	e8 cd 03 00 00       	call   8031c4 <_panic>
+
+00802df7 <pthread_start>:
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	53                   	push   %ebx
+  802dfb:	83 ec 04             	sub    $0x4,%esp
+  802dfe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802e01:	e8 86 d3 ff ff       	call   80018c <sys_getenvid>
+  802e06:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e0b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e11:	85 db                	test   %ebx,%ebx
+  802e13:	74 0c                	je     802e21 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e15:	89 d9                	mov    %ebx,%ecx
+  802e17:	c1 e1 10             	shl    $0x10,%ecx
+  802e1a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e1f:	29 ca                	sub    %ecx,%edx
+  802e21:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e24:	c1 e0 04             	shl    $0x4,%eax
+  802e27:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e2c:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e2e:	83 ec 0c             	sub    $0xc,%esp
+  802e31:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e38:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e3b:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e42:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e49:	89 04 24             	mov    %eax,(%esp)
+  802e4c:	e8 25 ff ff ff       	call   802d76 <pthread_exit>
+
+00802e51 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e51:	55                   	push   %ebp
+  802e52:	89 e5                	mov    %esp,%ebp
+  802e54:	57                   	push   %edi
+  802e55:	56                   	push   %esi
+  802e56:	53                   	push   %ebx
+  802e57:	83 ec 1c             	sub    $0x1c,%esp
+  802e5a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e5c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e62:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e69:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e6e:	77 0d                	ja     802e7d <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e70:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e75:	29 d0                	sub    %edx,%eax
+  802e77:	c1 e8 10             	shr    $0x10,%eax
+  802e7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e82:	eb 2f                	jmp    802eb3 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e84:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e8a:	8b 01                	mov    (%ecx),%eax
+  802e8c:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e8f:	39 c2                	cmp    %eax,%edx
+  802e91:	75 14                	jne    802ea7 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e93:	83 ec 0c             	sub    $0xc,%esp
+  802e96:	57                   	push   %edi
+  802e97:	e8 a5 d2 ff ff       	call   800141 <sys_env_destroy>
+  802e9c:	83 c4 10             	add    $0x10,%esp
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	0f 88 97 00 00 00    	js     802f3e <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802ea7:	83 c3 01             	add    $0x1,%ebx
+  802eaa:	83 fb 20             	cmp    $0x20,%ebx
+  802ead:	0f 84 d2 00 00 00    	je     802f85 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802eb3:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802eb6:	74 ef                	je     802ea7 <pthread_kill_others+0x56>
+  802eb8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ebb:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ec2:	8b 40 04             	mov    0x4(%eax),%eax
+  802ec5:	83 f8 01             	cmp    $0x1,%eax
+  802ec8:	75 dd                	jne    802ea7 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802eca:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ecd:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ed4:	89 fe                	mov    %edi,%esi
+  802ed6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802edc:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802edf:	c1 e0 04             	shl    $0x4,%eax
+  802ee2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ee7:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802eea:	39 c7                	cmp    %eax,%edi
+  802eec:	75 b9                	jne    802ea7 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802eee:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef1:	c1 e0 04             	shl    $0x4,%eax
+  802ef4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ef9:	8b 40 54             	mov    0x54(%eax),%eax
+  802efc:	85 c0                	test   %eax,%eax
+  802efe:	74 a7                	je     802ea7 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f00:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f03:	c1 e0 04             	shl    $0x4,%eax
+  802f06:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f0c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f0e:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f14:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f19:	0f 87 65 ff ff ff    	ja     802e84 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f1f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f24:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f26:	c1 e8 10             	shr    $0x10,%eax
+  802f29:	0f 84 55 ff ff ff    	je     802e84 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f2f:	c1 e0 10             	shl    $0x10,%eax
+  802f32:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f37:	29 c1                	sub    %eax,%ecx
+  802f39:	e9 4c ff ff ff       	jmp    802e8a <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f3e:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f41:	c1 e2 04             	shl    $0x4,%edx
+  802f44:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f4a:	8b 52 48             	mov    0x48(%edx),%edx
+  802f4d:	39 fa                	cmp    %edi,%edx
+  802f4f:	0f 85 52 ff ff ff    	jne    802ea7 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f55:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f58:	c1 e2 04             	shl    $0x4,%edx
+  802f5b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f61:	8b 52 54             	mov    0x54(%edx),%edx
+  802f64:	85 d2                	test   %edx,%edx
+  802f66:	0f 84 3b ff ff ff    	je     802ea7 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f6c:	83 ec 0c             	sub    $0xc,%esp
+  802f6f:	50                   	push   %eax
+  802f70:	57                   	push   %edi
+  802f71:	68 c8 48 80 00       	push   $0x8048c8
+  802f76:	68 bb 00 00 00       	push   $0xbb
+  802f7b:	68 b8 48 80 00       	push   $0x8048b8
+  802f80:	e8 3f 02 00 00       	call   8031c4 <_panic>
+	}
+}
+  802f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f88:	5b                   	pop    %ebx
+  802f89:	5e                   	pop    %esi
+  802f8a:	5f                   	pop    %edi
+  802f8b:	5d                   	pop    %ebp
+  802f8c:	c3                   	ret
+
+00802f8d <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f8d:	55                   	push   %ebp
+  802f8e:	89 e5                	mov    %esp,%ebp
+  802f90:	53                   	push   %ebx
+  802f91:	83 ec 04             	sub    $0x4,%esp
+  802f94:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f96:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f9c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fa2:	0f 87 85 00 00 00    	ja     80302d <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fa8:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fad:	29 c3                	sub    %eax,%ebx
+  802faf:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fb2:	83 ec 04             	sub    $0x4,%esp
+  802fb5:	68 80 02 00 00       	push   $0x280
+  802fba:	6a 00                	push   $0x0
+  802fbc:	68 40 60 80 00       	push   $0x806040
+  802fc1:	e8 0e 0a 00 00       	call   8039d4 <memset>
+	threads_mu.m_state = 0;
+  802fc6:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fcd:	00 00 00 
+	if (self != 0) {
+  802fd0:	83 c4 10             	add    $0x10,%esp
+  802fd3:	85 db                	test   %ebx,%ebx
+  802fd5:	74 51                	je     803028 <pthread_fork_child+0x9b>
+  802fd7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fd9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fdf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fe4:	77 18                	ja     802ffe <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fe6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802feb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fed:	c1 e8 10             	shr    $0x10,%eax
+  802ff0:	74 0c                	je     802ffe <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ff2:	c1 e0 10             	shl    $0x10,%eax
+  802ff5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ffa:	29 c2                	sub    %eax,%edx
+  802ffc:	eb 06                	jmp    803004 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  802ffe:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803004:	8b 02                	mov    (%edx),%eax
+  803006:	8b 48 48             	mov    0x48(%eax),%ecx
+  803009:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803010:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803013:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80301a:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803021:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803028:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80302b:	c9                   	leave
+  80302c:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80302d:	83 ec 04             	sub    $0x4,%esp
+  803030:	68 80 02 00 00       	push   $0x280
+  803035:	6a 00                	push   $0x0
+  803037:	68 40 60 80 00       	push   $0x806040
+  80303c:	e8 93 09 00 00       	call   8039d4 <memset>
+	threads_mu.m_state = 0;
+  803041:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803048:	00 00 00 
+  80304b:	83 c4 10             	add    $0x10,%esp
+  80304e:	eb d8                	jmp    803028 <pthread_fork_child+0x9b>
+
+00803050 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803050:	b8 00 00 00 00       	mov    $0x0,%eax
+  803055:	c3                   	ret
+
+00803056 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803056:	55                   	push   %ebp
+  803057:	89 e5                	mov    %esp,%ebp
+  803059:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80305c:	68 ed 48 80 00       	push   $0x8048ed
+  803061:	ff 75 0c             	push   0xc(%ebp)
+  803064:	e8 1a 08 00 00       	call   803883 <strcpy>
+	return 0;
+}
+  803069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+
+00803070 <devcons_write>:
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	57                   	push   %edi
+  803074:	56                   	push   %esi
+  803075:	53                   	push   %ebx
+  803076:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80307c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803081:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803087:	eb 2e                	jmp    8030b7 <devcons_write+0x47>
+		m = n - tot;
+  803089:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80308c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80308e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803093:	39 c3                	cmp    %eax,%ebx
+  803095:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803098:	83 ec 04             	sub    $0x4,%esp
+  80309b:	53                   	push   %ebx
+  80309c:	89 f0                	mov    %esi,%eax
+  80309e:	03 45 0c             	add    0xc(%ebp),%eax
+  8030a1:	50                   	push   %eax
+  8030a2:	57                   	push   %edi
+  8030a3:	e8 61 09 00 00       	call   803a09 <memmove>
+		sys_cputs(buf, m);
+  8030a8:	83 c4 08             	add    $0x8,%esp
+  8030ab:	53                   	push   %ebx
+  8030ac:	57                   	push   %edi
+  8030ad:	e8 38 d0 ff ff       	call   8000ea <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030b2:	01 de                	add    %ebx,%esi
+  8030b4:	83 c4 10             	add    $0x10,%esp
+  8030b7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030ba:	72 cd                	jb     803089 <devcons_write+0x19>
+}
+  8030bc:	89 f0                	mov    %esi,%eax
+  8030be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c1:	5b                   	pop    %ebx
+  8030c2:	5e                   	pop    %esi
+  8030c3:	5f                   	pop    %edi
+  8030c4:	5d                   	pop    %ebp
+  8030c5:	c3                   	ret
+
+008030c6 <devcons_read>:
+{
+  8030c6:	55                   	push   %ebp
+  8030c7:	89 e5                	mov    %esp,%ebp
+  8030c9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030d5:	75 07                	jne    8030de <devcons_read+0x18>
+  8030d7:	eb 1f                	jmp    8030f8 <devcons_read+0x32>
+		sys_yield();
+  8030d9:	e8 da d0 ff ff       	call   8001b8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030de:	e8 32 d0 ff ff       	call   800115 <sys_cgetc>
+  8030e3:	85 c0                	test   %eax,%eax
+  8030e5:	74 f2                	je     8030d9 <devcons_read+0x13>
+	if (c < 0)
+  8030e7:	78 0f                	js     8030f8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030e9:	83 f8 04             	cmp    $0x4,%eax
+  8030ec:	74 0c                	je     8030fa <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030f1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030f8:	c9                   	leave
+  8030f9:	c3                   	ret
+		return 0;
+  8030fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ff:	eb f7                	jmp    8030f8 <devcons_read+0x32>
+
+00803101 <cputchar>:
+{
+  803101:	55                   	push   %ebp
+  803102:	89 e5                	mov    %esp,%ebp
+  803104:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803107:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80310d:	6a 01                	push   $0x1
+  80310f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803112:	50                   	push   %eax
+  803113:	e8 d2 cf ff ff       	call   8000ea <sys_cputs>
+}
+  803118:	83 c4 10             	add    $0x10,%esp
+  80311b:	c9                   	leave
+  80311c:	c3                   	ret
+
+0080311d <getchar>:
+{
+  80311d:	55                   	push   %ebp
+  80311e:	89 e5                	mov    %esp,%ebp
+  803120:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803123:	6a 01                	push   $0x1
+  803125:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803128:	50                   	push   %eax
+  803129:	6a 00                	push   $0x0
+  80312b:	e8 63 d8 ff ff       	call   800993 <read>
+	if (r < 0)
+  803130:	83 c4 10             	add    $0x10,%esp
+  803133:	85 c0                	test   %eax,%eax
+  803135:	78 06                	js     80313d <getchar+0x20>
+	if (r < 1)
+  803137:	74 06                	je     80313f <getchar+0x22>
+	return c;
+  803139:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80313d:	c9                   	leave
+  80313e:	c3                   	ret
+		return -E_EOF;
+  80313f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803144:	eb f7                	jmp    80313d <getchar+0x20>
+
+00803146 <iscons>:
+{
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80314f:	50                   	push   %eax
+  803150:	ff 75 08             	push   0x8(%ebp)
+  803153:	e8 ab d5 ff ff       	call   800703 <fd_lookup>
+  803158:	83 c4 10             	add    $0x10,%esp
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	78 11                	js     803170 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80315f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803162:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803168:	39 10                	cmp    %edx,(%eax)
+  80316a:	0f 94 c0             	sete   %al
+  80316d:	0f b6 c0             	movzbl %al,%eax
+}
+  803170:	c9                   	leave
+  803171:	c3                   	ret
+
+00803172 <opencons>:
+{
+  803172:	55                   	push   %ebp
+  803173:	89 e5                	mov    %esp,%ebp
+  803175:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803178:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80317b:	50                   	push   %eax
+  80317c:	e8 2c d5 ff ff       	call   8006ad <fd_alloc>
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 3a                	js     8031c2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803188:	83 ec 04             	sub    $0x4,%esp
+  80318b:	68 07 04 00 00       	push   $0x407
+  803190:	ff 75 f4             	push   -0xc(%ebp)
+  803193:	6a 00                	push   $0x0
+  803195:	e8 4a d0 ff ff       	call   8001e4 <sys_page_alloc>
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	85 c0                	test   %eax,%eax
+  80319f:	78 21                	js     8031c2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a4:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8031aa:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031b6:	83 ec 0c             	sub    $0xc,%esp
+  8031b9:	50                   	push   %eax
+  8031ba:	e8 c7 d4 ff ff       	call   800686 <fd2num>
+  8031bf:	83 c4 10             	add    $0x10,%esp
+}
+  8031c2:	c9                   	leave
+  8031c3:	c3                   	ret
+
+008031c4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031c4:	55                   	push   %ebp
+  8031c5:	89 e5                	mov    %esp,%ebp
+  8031c7:	56                   	push   %esi
+  8031c8:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031c9:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031cc:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031d2:	e8 b5 cf ff ff       	call   80018c <sys_getenvid>
+  8031d7:	83 ec 0c             	sub    $0xc,%esp
+  8031da:	ff 75 0c             	push   0xc(%ebp)
+  8031dd:	ff 75 08             	push   0x8(%ebp)
+  8031e0:	56                   	push   %esi
+  8031e1:	50                   	push   %eax
+  8031e2:	68 fc 48 80 00       	push   $0x8048fc
+  8031e7:	e8 b3 00 00 00       	call   80329f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031ec:	83 c4 18             	add    $0x18,%esp
+  8031ef:	53                   	push   %ebx
+  8031f0:	ff 75 10             	push   0x10(%ebp)
+  8031f3:	e8 56 00 00 00       	call   80324e <vcprintf>
+	cprintf("\n");
+  8031f8:	c7 04 24 d2 4d 80 00 	movl   $0x804dd2,(%esp)
+  8031ff:	e8 9b 00 00 00       	call   80329f <cprintf>
+  803204:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803207:	cc                   	int3
+	while (1)
+  803208:	eb fd                	jmp    803207 <_panic+0x43>
+
+0080320a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80320a:	55                   	push   %ebp
+  80320b:	89 e5                	mov    %esp,%ebp
+  80320d:	53                   	push   %ebx
+  80320e:	83 ec 04             	sub    $0x4,%esp
+  803211:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803214:	8b 13                	mov    (%ebx),%edx
+  803216:	8d 42 01             	lea    0x1(%edx),%eax
+  803219:	89 03                	mov    %eax,(%ebx)
+  80321b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80321e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803222:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803227:	74 09                	je     803232 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803229:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80322d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803230:	c9                   	leave
+  803231:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803232:	83 ec 08             	sub    $0x8,%esp
+  803235:	68 ff 00 00 00       	push   $0xff
+  80323a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80323d:	50                   	push   %eax
+  80323e:	e8 a7 ce ff ff       	call   8000ea <sys_cputs>
+		b->idx = 0;
+  803243:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803249:	83 c4 10             	add    $0x10,%esp
+  80324c:	eb db                	jmp    803229 <putch+0x1f>
+
+0080324e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80324e:	55                   	push   %ebp
+  80324f:	89 e5                	mov    %esp,%ebp
+  803251:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803257:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80325e:	00 00 00 
+	b.cnt = 0;
+  803261:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803268:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80326b:	ff 75 0c             	push   0xc(%ebp)
+  80326e:	ff 75 08             	push   0x8(%ebp)
+  803271:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803277:	50                   	push   %eax
+  803278:	68 0a 32 80 00       	push   $0x80320a
+  80327d:	e8 14 01 00 00       	call   803396 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803282:	83 c4 08             	add    $0x8,%esp
+  803285:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80328b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803291:	50                   	push   %eax
+  803292:	e8 53 ce ff ff       	call   8000ea <sys_cputs>
+
+	return b.cnt;
+}
+  803297:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80329d:	c9                   	leave
+  80329e:	c3                   	ret
+
+0080329f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80329f:	55                   	push   %ebp
+  8032a0:	89 e5                	mov    %esp,%ebp
+  8032a2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8032a5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8032a8:	50                   	push   %eax
+  8032a9:	ff 75 08             	push   0x8(%ebp)
+  8032ac:	e8 9d ff ff ff       	call   80324e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032b1:	c9                   	leave
+  8032b2:	c3                   	ret
+
+008032b3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032b3:	55                   	push   %ebp
+  8032b4:	89 e5                	mov    %esp,%ebp
+  8032b6:	57                   	push   %edi
+  8032b7:	56                   	push   %esi
+  8032b8:	53                   	push   %ebx
+  8032b9:	83 ec 1c             	sub    $0x1c,%esp
+  8032bc:	89 c7                	mov    %eax,%edi
+  8032be:	89 d6                	mov    %edx,%esi
+  8032c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032c6:	89 d1                	mov    %edx,%ecx
+  8032c8:	89 c2                	mov    %eax,%edx
+  8032ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032d0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032d3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032d9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032e0:	39 c2                	cmp    %eax,%edx
+  8032e2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032e5:	72 3e                	jb     803325 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032e7:	83 ec 0c             	sub    $0xc,%esp
+  8032ea:	ff 75 18             	push   0x18(%ebp)
+  8032ed:	83 eb 01             	sub    $0x1,%ebx
+  8032f0:	53                   	push   %ebx
+  8032f1:	50                   	push   %eax
+  8032f2:	83 ec 08             	sub    $0x8,%esp
+  8032f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8032f8:	ff 75 e0             	push   -0x20(%ebp)
+  8032fb:	ff 75 dc             	push   -0x24(%ebp)
+  8032fe:	ff 75 d8             	push   -0x28(%ebp)
+  803301:	e8 47 12 00 00       	call   80454d <__udivdi3>
+  803306:	83 c4 18             	add    $0x18,%esp
+  803309:	52                   	push   %edx
+  80330a:	50                   	push   %eax
+  80330b:	89 f2                	mov    %esi,%edx
+  80330d:	89 f8                	mov    %edi,%eax
+  80330f:	e8 9f ff ff ff       	call   8032b3 <printnum>
+  803314:	83 c4 20             	add    $0x20,%esp
+  803317:	eb 13                	jmp    80332c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803319:	83 ec 08             	sub    $0x8,%esp
+  80331c:	56                   	push   %esi
+  80331d:	ff 75 18             	push   0x18(%ebp)
+  803320:	ff d7                	call   *%edi
+  803322:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803325:	83 eb 01             	sub    $0x1,%ebx
+  803328:	85 db                	test   %ebx,%ebx
+  80332a:	7f ed                	jg     803319 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80332c:	83 ec 08             	sub    $0x8,%esp
+  80332f:	56                   	push   %esi
+  803330:	83 ec 04             	sub    $0x4,%esp
+  803333:	ff 75 e4             	push   -0x1c(%ebp)
+  803336:	ff 75 e0             	push   -0x20(%ebp)
+  803339:	ff 75 dc             	push   -0x24(%ebp)
+  80333c:	ff 75 d8             	push   -0x28(%ebp)
+  80333f:	e8 2a 12 00 00       	call   80456e <__umoddi3>
+  803344:	83 c4 14             	add    $0x14,%esp
+  803347:	0f be 80 1f 49 80 00 	movsbl 0x80491f(%eax),%eax
+  80334e:	50                   	push   %eax
+  80334f:	ff d7                	call   *%edi
+}
+  803351:	83 c4 10             	add    $0x10,%esp
+  803354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803357:	5b                   	pop    %ebx
+  803358:	5e                   	pop    %esi
+  803359:	5f                   	pop    %edi
+  80335a:	5d                   	pop    %ebp
+  80335b:	c3                   	ret
+
+0080335c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80335c:	55                   	push   %ebp
+  80335d:	89 e5                	mov    %esp,%ebp
+  80335f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803362:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803366:	8b 10                	mov    (%eax),%edx
+  803368:	3b 50 04             	cmp    0x4(%eax),%edx
+  80336b:	73 0a                	jae    803377 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80336d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803370:	89 08                	mov    %ecx,(%eax)
+  803372:	8b 45 08             	mov    0x8(%ebp),%eax
+  803375:	88 02                	mov    %al,(%edx)
+}
+  803377:	5d                   	pop    %ebp
+  803378:	c3                   	ret
+
+00803379 <printfmt>:
+{
+  803379:	55                   	push   %ebp
+  80337a:	89 e5                	mov    %esp,%ebp
+  80337c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80337f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803382:	50                   	push   %eax
+  803383:	ff 75 10             	push   0x10(%ebp)
+  803386:	ff 75 0c             	push   0xc(%ebp)
+  803389:	ff 75 08             	push   0x8(%ebp)
+  80338c:	e8 05 00 00 00       	call   803396 <vprintfmt>
+}
+  803391:	83 c4 10             	add    $0x10,%esp
+  803394:	c9                   	leave
+  803395:	c3                   	ret
+
+00803396 <vprintfmt>:
+{
+  803396:	55                   	push   %ebp
+  803397:	89 e5                	mov    %esp,%ebp
+  803399:	57                   	push   %edi
+  80339a:	56                   	push   %esi
+  80339b:	53                   	push   %ebx
+  80339c:	83 ec 2c             	sub    $0x2c,%esp
+  80339f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8033a5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033a8:	eb 0a                	jmp    8033b4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033aa:	83 ec 08             	sub    $0x8,%esp
+  8033ad:	53                   	push   %ebx
+  8033ae:	50                   	push   %eax
+  8033af:	ff d6                	call   *%esi
+  8033b1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033b4:	83 c7 01             	add    $0x1,%edi
+  8033b7:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033bb:	83 f8 25             	cmp    $0x25,%eax
+  8033be:	74 0c                	je     8033cc <vprintfmt+0x36>
+			if (ch == '\0')
+  8033c0:	85 c0                	test   %eax,%eax
+  8033c2:	75 e6                	jne    8033aa <vprintfmt+0x14>
+}
+  8033c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033c7:	5b                   	pop    %ebx
+  8033c8:	5e                   	pop    %esi
+  8033c9:	5f                   	pop    %edi
+  8033ca:	5d                   	pop    %ebp
+  8033cb:	c3                   	ret
+		padc = ' ';
+  8033cc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033d0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033d7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033de:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033ea:	8d 47 01             	lea    0x1(%edi),%eax
+  8033ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033f0:	0f b6 17             	movzbl (%edi),%edx
+  8033f3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033f6:	3c 55                	cmp    $0x55,%al
+  8033f8:	0f 87 c5 03 00 00    	ja     8037c3 <vprintfmt+0x42d>
+  8033fe:	0f b6 c0             	movzbl %al,%eax
+  803401:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  803408:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80340b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80340e:	eb da                	jmp    8033ea <vprintfmt+0x54>
+  803410:	0f be d2             	movsbl %dl,%edx
+  803413:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80341e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803421:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803425:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803428:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80342b:	83 f9 09             	cmp    $0x9,%ecx
+  80342e:	77 55                	ja     803485 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803430:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803433:	eb e9                	jmp    80341e <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803435:	8b 45 14             	mov    0x14(%ebp),%eax
+  803438:	8b 00                	mov    (%eax),%eax
+  80343a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80343d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803440:	8d 40 04             	lea    0x4(%eax),%eax
+  803443:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803446:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803449:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80344d:	79 9b                	jns    8033ea <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80344f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803455:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80345c:	eb 8c                	jmp    8033ea <vprintfmt+0x54>
+			if (width < 0)
+  80345e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803461:	85 d2                	test   %edx,%edx
+  803463:	b8 00 00 00 00       	mov    $0x0,%eax
+  803468:	0f 49 c2             	cmovns %edx,%eax
+  80346b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80346e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803471:	e9 74 ff ff ff       	jmp    8033ea <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803476:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803479:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803480:	e9 65 ff ff ff       	jmp    8033ea <vprintfmt+0x54>
+  803485:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803488:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80348b:	eb bc                	jmp    803449 <vprintfmt+0xb3>
+			lflag++;
+  80348d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  803490:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803493:	e9 52 ff ff ff       	jmp    8033ea <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  803498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80349b:	8d 78 04             	lea    0x4(%eax),%edi
+  80349e:	83 ec 08             	sub    $0x8,%esp
+  8034a1:	53                   	push   %ebx
+  8034a2:	ff 30                	push   (%eax)
+  8034a4:	ff d6                	call   *%esi
+			break;
+  8034a6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034ac:	e9 b1 02 00 00       	jmp    803762 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034b4:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034b7:	8b 10                	mov    (%eax),%edx
+  8034b9:	89 d0                	mov    %edx,%eax
+  8034bb:	f7 d8                	neg    %eax
+  8034bd:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034c0:	83 f8 14             	cmp    $0x14,%eax
+  8034c3:	7f 23                	jg     8034e8 <vprintfmt+0x152>
+  8034c5:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  8034cc:	85 d2                	test   %edx,%edx
+  8034ce:	74 18                	je     8034e8 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034d0:	52                   	push   %edx
+  8034d1:	68 c7 47 80 00       	push   $0x8047c7
+  8034d6:	53                   	push   %ebx
+  8034d7:	56                   	push   %esi
+  8034d8:	e8 9c fe ff ff       	call   803379 <printfmt>
+  8034dd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034e0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034e3:	e9 7a 02 00 00       	jmp    803762 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034e8:	50                   	push   %eax
+  8034e9:	68 37 49 80 00       	push   $0x804937
+  8034ee:	53                   	push   %ebx
+  8034ef:	56                   	push   %esi
+  8034f0:	e8 84 fe ff ff       	call   803379 <printfmt>
+  8034f5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034fb:	e9 62 02 00 00       	jmp    803762 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803500:	8b 45 14             	mov    0x14(%ebp),%eax
+  803503:	83 c0 04             	add    $0x4,%eax
+  803506:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80350c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80350e:	85 c9                	test   %ecx,%ecx
+  803510:	b8 30 49 80 00       	mov    $0x804930,%eax
+  803515:	0f 45 c1             	cmovne %ecx,%eax
+  803518:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80351b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80351f:	7e 06                	jle    803527 <vprintfmt+0x191>
+  803521:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803525:	75 0b                	jne    803532 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803527:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80352a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80352d:	89 75 08             	mov    %esi,0x8(%ebp)
+  803530:	eb 5c                	jmp    80358e <vprintfmt+0x1f8>
+  803532:	83 ec 08             	sub    $0x8,%esp
+  803535:	ff 75 d0             	push   -0x30(%ebp)
+  803538:	ff 75 cc             	push   -0x34(%ebp)
+  80353b:	e8 20 03 00 00       	call   803860 <strnlen>
+  803540:	89 c2                	mov    %eax,%edx
+  803542:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803545:	29 d0                	sub    %edx,%eax
+  803547:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80354a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80354e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803551:	89 75 08             	mov    %esi,0x8(%ebp)
+  803554:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803556:	eb 0e                	jmp    803566 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  803558:	83 ec 08             	sub    $0x8,%esp
+  80355b:	53                   	push   %ebx
+  80355c:	57                   	push   %edi
+  80355d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803560:	83 ee 01             	sub    $0x1,%esi
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	85 f6                	test   %esi,%esi
+  803568:	7f ee                	jg     803558 <vprintfmt+0x1c2>
+  80356a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80356d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803570:	85 c0                	test   %eax,%eax
+  803572:	ba 00 00 00 00       	mov    $0x0,%edx
+  803577:	0f 49 d0             	cmovns %eax,%edx
+  80357a:	29 d0                	sub    %edx,%eax
+  80357c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80357f:	eb a6                	jmp    803527 <vprintfmt+0x191>
+					putch(ch, putdat);
+  803581:	83 ec 08             	sub    $0x8,%esp
+  803584:	53                   	push   %ebx
+  803585:	52                   	push   %edx
+  803586:	ff 55 08             	call   *0x8(%ebp)
+  803589:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80358c:	89 f1                	mov    %esi,%ecx
+  80358e:	8d 71 01             	lea    0x1(%ecx),%esi
+  803591:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803595:	0f be d0             	movsbl %al,%edx
+  803598:	85 d2                	test   %edx,%edx
+  80359a:	74 28                	je     8035c4 <vprintfmt+0x22e>
+  80359c:	85 ff                	test   %edi,%edi
+  80359e:	78 05                	js     8035a5 <vprintfmt+0x20f>
+  8035a0:	83 ef 01             	sub    $0x1,%edi
+  8035a3:	78 30                	js     8035d5 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8035a5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035a9:	74 d6                	je     803581 <vprintfmt+0x1eb>
+  8035ab:	0f be c0             	movsbl %al,%eax
+  8035ae:	83 e8 20             	sub    $0x20,%eax
+  8035b1:	83 f8 5e             	cmp    $0x5e,%eax
+  8035b4:	76 cb                	jbe    803581 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035b6:	83 ec 08             	sub    $0x8,%esp
+  8035b9:	53                   	push   %ebx
+  8035ba:	6a 3f                	push   $0x3f
+  8035bc:	ff 55 08             	call   *0x8(%ebp)
+  8035bf:	83 c4 10             	add    $0x10,%esp
+  8035c2:	eb c8                	jmp    80358c <vprintfmt+0x1f6>
+  8035c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035c7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035ca:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035cd:	01 d0                	add    %edx,%eax
+  8035cf:	29 c8                	sub    %ecx,%eax
+  8035d1:	89 c7                	mov    %eax,%edi
+  8035d3:	eb 13                	jmp    8035e8 <vprintfmt+0x252>
+  8035d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035d8:	eb ed                	jmp    8035c7 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035da:	83 ec 08             	sub    $0x8,%esp
+  8035dd:	53                   	push   %ebx
+  8035de:	6a 20                	push   $0x20
+  8035e0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035e2:	83 ef 01             	sub    $0x1,%edi
+  8035e5:	83 c4 10             	add    $0x10,%esp
+  8035e8:	85 ff                	test   %edi,%edi
+  8035ea:	7f ee                	jg     8035da <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035ec:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035f2:	e9 6b 01 00 00       	jmp    803762 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035f7:	83 f9 01             	cmp    $0x1,%ecx
+  8035fa:	7f 1f                	jg     80361b <vprintfmt+0x285>
+	else if (lflag)
+  8035fc:	85 c9                	test   %ecx,%ecx
+  8035fe:	74 67                	je     803667 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  803600:	8b 45 14             	mov    0x14(%ebp),%eax
+  803603:	8b 00                	mov    (%eax),%eax
+  803605:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803608:	89 c1                	mov    %eax,%ecx
+  80360a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80360d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803610:	8b 45 14             	mov    0x14(%ebp),%eax
+  803613:	8d 40 04             	lea    0x4(%eax),%eax
+  803616:	89 45 14             	mov    %eax,0x14(%ebp)
+  803619:	eb 17                	jmp    803632 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80361b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80361e:	8b 50 04             	mov    0x4(%eax),%edx
+  803621:	8b 00                	mov    (%eax),%eax
+  803623:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803626:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80362c:	8d 40 08             	lea    0x8(%eax),%eax
+  80362f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803632:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803635:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803638:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80363d:	85 c9                	test   %ecx,%ecx
+  80363f:	0f 89 03 01 00 00    	jns    803748 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803645:	83 ec 08             	sub    $0x8,%esp
+  803648:	53                   	push   %ebx
+  803649:	6a 2d                	push   $0x2d
+  80364b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80364d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803650:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803653:	f7 da                	neg    %edx
+  803655:	83 d1 00             	adc    $0x0,%ecx
+  803658:	f7 d9                	neg    %ecx
+  80365a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80365d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803662:	e9 e1 00 00 00       	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  803667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80366a:	8b 00                	mov    (%eax),%eax
+  80366c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80366f:	89 c1                	mov    %eax,%ecx
+  803671:	c1 f9 1f             	sar    $0x1f,%ecx
+  803674:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80367a:	8d 40 04             	lea    0x4(%eax),%eax
+  80367d:	89 45 14             	mov    %eax,0x14(%ebp)
+  803680:	eb b0                	jmp    803632 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803682:	83 f9 01             	cmp    $0x1,%ecx
+  803685:	7f 1e                	jg     8036a5 <vprintfmt+0x30f>
+	else if (lflag)
+  803687:	85 c9                	test   %ecx,%ecx
+  803689:	74 32                	je     8036bd <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80368b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80368e:	8b 10                	mov    (%eax),%edx
+  803690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803695:	8d 40 04             	lea    0x4(%eax),%eax
+  803698:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80369b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8036a0:	e9 a3 00 00 00       	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036a8:	8b 10                	mov    (%eax),%edx
+  8036aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8036b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036b8:	e9 8b 00 00 00       	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036c0:	8b 10                	mov    (%eax),%edx
+  8036c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8036ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036d2:	eb 74                	jmp    803748 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036d4:	83 f9 01             	cmp    $0x1,%ecx
+  8036d7:	7f 1b                	jg     8036f4 <vprintfmt+0x35e>
+	else if (lflag)
+  8036d9:	85 c9                	test   %ecx,%ecx
+  8036db:	74 2c                	je     803709 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036e0:	8b 10                	mov    (%eax),%edx
+  8036e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8036ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036ed:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036f2:	eb 54                	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036f7:	8b 10                	mov    (%eax),%edx
+  8036f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8036ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803702:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  803707:	eb 3f                	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80370c:	8b 10                	mov    (%eax),%edx
+  80370e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803713:	8d 40 04             	lea    0x4(%eax),%eax
+  803716:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803719:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80371e:	eb 28                	jmp    803748 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803720:	83 ec 08             	sub    $0x8,%esp
+  803723:	53                   	push   %ebx
+  803724:	6a 30                	push   $0x30
+  803726:	ff d6                	call   *%esi
+			putch('x', putdat);
+  803728:	83 c4 08             	add    $0x8,%esp
+  80372b:	53                   	push   %ebx
+  80372c:	6a 78                	push   $0x78
+  80372e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803730:	8b 45 14             	mov    0x14(%ebp),%eax
+  803733:	8b 10                	mov    (%eax),%edx
+  803735:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80373a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80373d:	8d 40 04             	lea    0x4(%eax),%eax
+  803740:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803743:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803748:	83 ec 0c             	sub    $0xc,%esp
+  80374b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80374f:	50                   	push   %eax
+  803750:	ff 75 e0             	push   -0x20(%ebp)
+  803753:	57                   	push   %edi
+  803754:	51                   	push   %ecx
+  803755:	52                   	push   %edx
+  803756:	89 da                	mov    %ebx,%edx
+  803758:	89 f0                	mov    %esi,%eax
+  80375a:	e8 54 fb ff ff       	call   8032b3 <printnum>
+			break;
+  80375f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803762:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803765:	e9 4a fc ff ff       	jmp    8033b4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80376a:	83 f9 01             	cmp    $0x1,%ecx
+  80376d:	7f 1b                	jg     80378a <vprintfmt+0x3f4>
+	else if (lflag)
+  80376f:	85 c9                	test   %ecx,%ecx
+  803771:	74 2c                	je     80379f <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803773:	8b 45 14             	mov    0x14(%ebp),%eax
+  803776:	8b 10                	mov    (%eax),%edx
+  803778:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80377d:	8d 40 04             	lea    0x4(%eax),%eax
+  803780:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803783:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  803788:	eb be                	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80378a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80378d:	8b 10                	mov    (%eax),%edx
+  80378f:	8b 48 04             	mov    0x4(%eax),%ecx
+  803792:	8d 40 08             	lea    0x8(%eax),%eax
+  803795:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803798:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80379d:	eb a9                	jmp    803748 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80379f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037a2:	8b 10                	mov    (%eax),%edx
+  8037a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8037ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037af:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037b4:	eb 92                	jmp    803748 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037b6:	83 ec 08             	sub    $0x8,%esp
+  8037b9:	53                   	push   %ebx
+  8037ba:	6a 25                	push   $0x25
+  8037bc:	ff d6                	call   *%esi
+			break;
+  8037be:	83 c4 10             	add    $0x10,%esp
+  8037c1:	eb 9f                	jmp    803762 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037c3:	83 ec 08             	sub    $0x8,%esp
+  8037c6:	53                   	push   %ebx
+  8037c7:	6a 25                	push   $0x25
+  8037c9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037cb:	83 c4 10             	add    $0x10,%esp
+  8037ce:	89 f8                	mov    %edi,%eax
+  8037d0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037d4:	74 05                	je     8037db <vprintfmt+0x445>
+  8037d6:	83 e8 01             	sub    $0x1,%eax
+  8037d9:	eb f5                	jmp    8037d0 <vprintfmt+0x43a>
+  8037db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037de:	eb 82                	jmp    803762 <vprintfmt+0x3cc>
+
+008037e0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037e0:	55                   	push   %ebp
+  8037e1:	89 e5                	mov    %esp,%ebp
+  8037e3:	83 ec 18             	sub    $0x18,%esp
+  8037e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037ef:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037f3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8037fd:	85 c0                	test   %eax,%eax
+  8037ff:	74 26                	je     803827 <vsnprintf+0x47>
+  803801:	85 d2                	test   %edx,%edx
+  803803:	7e 22                	jle    803827 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803805:	ff 75 14             	push   0x14(%ebp)
+  803808:	ff 75 10             	push   0x10(%ebp)
+  80380b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80380e:	50                   	push   %eax
+  80380f:	68 5c 33 80 00       	push   $0x80335c
+  803814:	e8 7d fb ff ff       	call   803396 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803819:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80381c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80381f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803822:	83 c4 10             	add    $0x10,%esp
+}
+  803825:	c9                   	leave
+  803826:	c3                   	ret
+		return -E_INVAL;
+  803827:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80382c:	eb f7                	jmp    803825 <vsnprintf+0x45>
+
+0080382e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80382e:	55                   	push   %ebp
+  80382f:	89 e5                	mov    %esp,%ebp
+  803831:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803834:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803837:	50                   	push   %eax
+  803838:	ff 75 10             	push   0x10(%ebp)
+  80383b:	ff 75 0c             	push   0xc(%ebp)
+  80383e:	ff 75 08             	push   0x8(%ebp)
+  803841:	e8 9a ff ff ff       	call   8037e0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803846:	c9                   	leave
+  803847:	c3                   	ret
+
+00803848 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803848:	55                   	push   %ebp
+  803849:	89 e5                	mov    %esp,%ebp
+  80384b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80384e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803853:	eb 03                	jmp    803858 <strlen+0x10>
+		n++;
+  803855:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803858:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80385c:	75 f7                	jne    803855 <strlen+0xd>
+	return n;
+}
+  80385e:	5d                   	pop    %ebp
+  80385f:	c3                   	ret
+
+00803860 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803860:	55                   	push   %ebp
+  803861:	89 e5                	mov    %esp,%ebp
+  803863:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803866:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386e:	eb 03                	jmp    803873 <strnlen+0x13>
+		n++;
+  803870:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803873:	39 d0                	cmp    %edx,%eax
+  803875:	74 08                	je     80387f <strnlen+0x1f>
+  803877:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80387b:	75 f3                	jne    803870 <strnlen+0x10>
+  80387d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80387f:	89 d0                	mov    %edx,%eax
+  803881:	5d                   	pop    %ebp
+  803882:	c3                   	ret
+
+00803883 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803883:	55                   	push   %ebp
+  803884:	89 e5                	mov    %esp,%ebp
+  803886:	53                   	push   %ebx
+  803887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80388a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80388d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803892:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  803896:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  803899:	83 c0 01             	add    $0x1,%eax
+  80389c:	84 d2                	test   %dl,%dl
+  80389e:	75 f2                	jne    803892 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8038a0:	89 c8                	mov    %ecx,%eax
+  8038a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a5:	c9                   	leave
+  8038a6:	c3                   	ret
+
+008038a7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8038a7:	55                   	push   %ebp
+  8038a8:	89 e5                	mov    %esp,%ebp
+  8038aa:	53                   	push   %ebx
+  8038ab:	83 ec 10             	sub    $0x10,%esp
+  8038ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038b1:	53                   	push   %ebx
+  8038b2:	e8 91 ff ff ff       	call   803848 <strlen>
+  8038b7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038ba:	ff 75 0c             	push   0xc(%ebp)
+  8038bd:	01 d8                	add    %ebx,%eax
+  8038bf:	50                   	push   %eax
+  8038c0:	e8 be ff ff ff       	call   803883 <strcpy>
+	return dst;
+}
+  8038c5:	89 d8                	mov    %ebx,%eax
+  8038c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038ca:	c9                   	leave
+  8038cb:	c3                   	ret
+
+008038cc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038cc:	55                   	push   %ebp
+  8038cd:	89 e5                	mov    %esp,%ebp
+  8038cf:	56                   	push   %esi
+  8038d0:	53                   	push   %ebx
+  8038d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038d7:	89 f3                	mov    %esi,%ebx
+  8038d9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038dc:	89 f0                	mov    %esi,%eax
+  8038de:	eb 0f                	jmp    8038ef <strncpy+0x23>
+		*dst++ = *src;
+  8038e0:	83 c0 01             	add    $0x1,%eax
+  8038e3:	0f b6 0a             	movzbl (%edx),%ecx
+  8038e6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038e9:	80 f9 01             	cmp    $0x1,%cl
+  8038ec:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038ef:	39 d8                	cmp    %ebx,%eax
+  8038f1:	75 ed                	jne    8038e0 <strncpy+0x14>
+	}
+	return ret;
+}
+  8038f3:	89 f0                	mov    %esi,%eax
+  8038f5:	5b                   	pop    %ebx
+  8038f6:	5e                   	pop    %esi
+  8038f7:	5d                   	pop    %ebp
+  8038f8:	c3                   	ret
+
+008038f9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038f9:	55                   	push   %ebp
+  8038fa:	89 e5                	mov    %esp,%ebp
+  8038fc:	56                   	push   %esi
+  8038fd:	53                   	push   %ebx
+  8038fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803901:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803904:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803907:	89 f0                	mov    %esi,%eax
+  803909:	85 d2                	test   %edx,%edx
+  80390b:	74 21                	je     80392e <strlcpy+0x35>
+  80390d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803911:	89 f2                	mov    %esi,%edx
+  803913:	eb 09                	jmp    80391e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803915:	83 c1 01             	add    $0x1,%ecx
+  803918:	83 c2 01             	add    $0x1,%edx
+  80391b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80391e:	39 c2                	cmp    %eax,%edx
+  803920:	74 09                	je     80392b <strlcpy+0x32>
+  803922:	0f b6 19             	movzbl (%ecx),%ebx
+  803925:	84 db                	test   %bl,%bl
+  803927:	75 ec                	jne    803915 <strlcpy+0x1c>
+  803929:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80392b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80392e:	29 f0                	sub    %esi,%eax
+}
+  803930:	5b                   	pop    %ebx
+  803931:	5e                   	pop    %esi
+  803932:	5d                   	pop    %ebp
+  803933:	c3                   	ret
+
+00803934 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803934:	55                   	push   %ebp
+  803935:	89 e5                	mov    %esp,%ebp
+  803937:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80393a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80393d:	eb 06                	jmp    803945 <strcmp+0x11>
+		p++, q++;
+  80393f:	83 c1 01             	add    $0x1,%ecx
+  803942:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803945:	0f b6 01             	movzbl (%ecx),%eax
+  803948:	84 c0                	test   %al,%al
+  80394a:	74 04                	je     803950 <strcmp+0x1c>
+  80394c:	3a 02                	cmp    (%edx),%al
+  80394e:	74 ef                	je     80393f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803950:	0f b6 c0             	movzbl %al,%eax
+  803953:	0f b6 12             	movzbl (%edx),%edx
+  803956:	29 d0                	sub    %edx,%eax
+}
+  803958:	5d                   	pop    %ebp
+  803959:	c3                   	ret
+
+0080395a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80395a:	55                   	push   %ebp
+  80395b:	89 e5                	mov    %esp,%ebp
+  80395d:	53                   	push   %ebx
+  80395e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803961:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803964:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  803967:	eb 09                	jmp    803972 <strncmp+0x18>
+		n--, p++, q++;
+  803969:	83 ea 01             	sub    $0x1,%edx
+  80396c:	83 c0 01             	add    $0x1,%eax
+  80396f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803972:	85 d2                	test   %edx,%edx
+  803974:	74 18                	je     80398e <strncmp+0x34>
+  803976:	0f b6 18             	movzbl (%eax),%ebx
+  803979:	84 db                	test   %bl,%bl
+  80397b:	74 04                	je     803981 <strncmp+0x27>
+  80397d:	3a 19                	cmp    (%ecx),%bl
+  80397f:	74 e8                	je     803969 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803981:	0f b6 00             	movzbl (%eax),%eax
+  803984:	0f b6 11             	movzbl (%ecx),%edx
+  803987:	29 d0                	sub    %edx,%eax
+}
+  803989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398c:	c9                   	leave
+  80398d:	c3                   	ret
+		return 0;
+  80398e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803993:	eb f4                	jmp    803989 <strncmp+0x2f>
+
+00803995 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803995:	55                   	push   %ebp
+  803996:	89 e5                	mov    %esp,%ebp
+  803998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80399b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80399f:	eb 03                	jmp    8039a4 <strchr+0xf>
+  8039a1:	83 c0 01             	add    $0x1,%eax
+  8039a4:	0f b6 10             	movzbl (%eax),%edx
+  8039a7:	84 d2                	test   %dl,%dl
+  8039a9:	74 06                	je     8039b1 <strchr+0x1c>
+		if (*s == c)
+  8039ab:	38 ca                	cmp    %cl,%dl
+  8039ad:	75 f2                	jne    8039a1 <strchr+0xc>
+  8039af:	eb 05                	jmp    8039b6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b6:	5d                   	pop    %ebp
+  8039b7:	c3                   	ret
+
+008039b8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039b8:	55                   	push   %ebp
+  8039b9:	89 e5                	mov    %esp,%ebp
+  8039bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039be:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039c2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039c5:	38 ca                	cmp    %cl,%dl
+  8039c7:	74 09                	je     8039d2 <strfind+0x1a>
+  8039c9:	84 d2                	test   %dl,%dl
+  8039cb:	74 05                	je     8039d2 <strfind+0x1a>
+	for (; *s; s++)
+  8039cd:	83 c0 01             	add    $0x1,%eax
+  8039d0:	eb f0                	jmp    8039c2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039d2:	5d                   	pop    %ebp
+  8039d3:	c3                   	ret
+
+008039d4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039d4:	55                   	push   %ebp
+  8039d5:	89 e5                	mov    %esp,%ebp
+  8039d7:	57                   	push   %edi
+  8039d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039de:	85 c9                	test   %ecx,%ecx
+  8039e0:	74 20                	je     803a02 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039e2:	89 f8                	mov    %edi,%eax
+  8039e4:	09 c8                	or     %ecx,%eax
+  8039e6:	a8 03                	test   $0x3,%al
+  8039e8:	75 12                	jne    8039fc <memset+0x28>
+		c &= 0xFF;
+  8039ea:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039ee:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039f4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039f7:	fc                   	cld
+  8039f8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039fa:	eb 06                	jmp    803a02 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039ff:	fc                   	cld
+  803a00:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803a02:	89 f8                	mov    %edi,%eax
+  803a04:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803a07:	c9                   	leave
+  803a08:	c3                   	ret
+
+00803a09 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a09:	55                   	push   %ebp
+  803a0a:	89 e5                	mov    %esp,%ebp
+  803a0c:	57                   	push   %edi
+  803a0d:	56                   	push   %esi
+  803a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a11:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a17:	39 c6                	cmp    %eax,%esi
+  803a19:	73 32                	jae    803a4d <memmove+0x44>
+  803a1b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a1e:	39 d0                	cmp    %edx,%eax
+  803a20:	73 2b                	jae    803a4d <memmove+0x44>
+		s += n;
+		d += n;
+  803a22:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a25:	89 d6                	mov    %edx,%esi
+  803a27:	09 fe                	or     %edi,%esi
+  803a29:	09 ce                	or     %ecx,%esi
+  803a2b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a31:	75 0e                	jne    803a41 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a33:	83 ef 04             	sub    $0x4,%edi
+  803a36:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a39:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a3c:	fd                   	std
+  803a3d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a3f:	eb 09                	jmp    803a4a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a41:	83 ef 01             	sub    $0x1,%edi
+  803a44:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a47:	fd                   	std
+  803a48:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a4a:	fc                   	cld
+  803a4b:	eb 1a                	jmp    803a67 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a4d:	89 f2                	mov    %esi,%edx
+  803a4f:	09 c2                	or     %eax,%edx
+  803a51:	09 ca                	or     %ecx,%edx
+  803a53:	f6 c2 03             	test   $0x3,%dl
+  803a56:	75 0a                	jne    803a62 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a58:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a5b:	89 c7                	mov    %eax,%edi
+  803a5d:	fc                   	cld
+  803a5e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a60:	eb 05                	jmp    803a67 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a62:	89 c7                	mov    %eax,%edi
+  803a64:	fc                   	cld
+  803a65:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a67:	5e                   	pop    %esi
+  803a68:	5f                   	pop    %edi
+  803a69:	5d                   	pop    %ebp
+  803a6a:	c3                   	ret
+
+00803a6b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a6b:	55                   	push   %ebp
+  803a6c:	89 e5                	mov    %esp,%ebp
+  803a6e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a71:	ff 75 10             	push   0x10(%ebp)
+  803a74:	ff 75 0c             	push   0xc(%ebp)
+  803a77:	ff 75 08             	push   0x8(%ebp)
+  803a7a:	e8 8a ff ff ff       	call   803a09 <memmove>
+}
+  803a7f:	c9                   	leave
+  803a80:	c3                   	ret
+
+00803a81 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a81:	55                   	push   %ebp
+  803a82:	89 e5                	mov    %esp,%ebp
+  803a84:	56                   	push   %esi
+  803a85:	53                   	push   %ebx
+  803a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a89:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a8c:	89 c6                	mov    %eax,%esi
+  803a8e:	03 75 10             	add    0x10(%ebp),%esi
+  803a91:	eb 06                	jmp    803a99 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a93:	83 c0 01             	add    $0x1,%eax
+  803a96:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a99:	39 f0                	cmp    %esi,%eax
+  803a9b:	74 14                	je     803ab1 <memcmp+0x30>
+		if (*s1 != *s2)
+  803a9d:	0f b6 08             	movzbl (%eax),%ecx
+  803aa0:	0f b6 1a             	movzbl (%edx),%ebx
+  803aa3:	38 d9                	cmp    %bl,%cl
+  803aa5:	74 ec                	je     803a93 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803aa7:	0f b6 c1             	movzbl %cl,%eax
+  803aaa:	0f b6 db             	movzbl %bl,%ebx
+  803aad:	29 d8                	sub    %ebx,%eax
+  803aaf:	eb 05                	jmp    803ab6 <memcmp+0x35>
+	}
+
+	return 0;
+  803ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab6:	5b                   	pop    %ebx
+  803ab7:	5e                   	pop    %esi
+  803ab8:	5d                   	pop    %ebp
+  803ab9:	c3                   	ret
+
+00803aba <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803aba:	55                   	push   %ebp
+  803abb:	89 e5                	mov    %esp,%ebp
+  803abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ac3:	89 c2                	mov    %eax,%edx
+  803ac5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803ac8:	eb 03                	jmp    803acd <memfind+0x13>
+  803aca:	83 c0 01             	add    $0x1,%eax
+  803acd:	39 d0                	cmp    %edx,%eax
+  803acf:	73 04                	jae    803ad5 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ad1:	38 08                	cmp    %cl,(%eax)
+  803ad3:	75 f5                	jne    803aca <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803ad5:	5d                   	pop    %ebp
+  803ad6:	c3                   	ret
+
+00803ad7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ad7:	55                   	push   %ebp
+  803ad8:	89 e5                	mov    %esp,%ebp
+  803ada:	57                   	push   %edi
+  803adb:	56                   	push   %esi
+  803adc:	53                   	push   %ebx
+  803add:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ae0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ae3:	eb 03                	jmp    803ae8 <strtol+0x11>
+		s++;
+  803ae5:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803ae8:	0f b6 02             	movzbl (%edx),%eax
+  803aeb:	3c 20                	cmp    $0x20,%al
+  803aed:	74 f6                	je     803ae5 <strtol+0xe>
+  803aef:	3c 09                	cmp    $0x9,%al
+  803af1:	74 f2                	je     803ae5 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803af3:	3c 2b                	cmp    $0x2b,%al
+  803af5:	74 2a                	je     803b21 <strtol+0x4a>
+	int neg = 0;
+  803af7:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803afc:	3c 2d                	cmp    $0x2d,%al
+  803afe:	74 2b                	je     803b2b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b00:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803b06:	75 0f                	jne    803b17 <strtol+0x40>
+  803b08:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b0b:	74 28                	je     803b35 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b0d:	85 db                	test   %ebx,%ebx
+  803b0f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b14:	0f 44 d8             	cmove  %eax,%ebx
+  803b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b1c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b1f:	eb 46                	jmp    803b67 <strtol+0x90>
+		s++;
+  803b21:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b29:	eb d5                	jmp    803b00 <strtol+0x29>
+		s++, neg = 1;
+  803b2b:	83 c2 01             	add    $0x1,%edx
+  803b2e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b33:	eb cb                	jmp    803b00 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b35:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b39:	74 0e                	je     803b49 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b3b:	85 db                	test   %ebx,%ebx
+  803b3d:	75 d8                	jne    803b17 <strtol+0x40>
+		s++, base = 8;
+  803b3f:	83 c2 01             	add    $0x1,%edx
+  803b42:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b47:	eb ce                	jmp    803b17 <strtol+0x40>
+		s += 2, base = 16;
+  803b49:	83 c2 02             	add    $0x2,%edx
+  803b4c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b51:	eb c4                	jmp    803b17 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b53:	0f be c0             	movsbl %al,%eax
+  803b56:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b59:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b5c:	7d 3a                	jge    803b98 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b5e:	83 c2 01             	add    $0x1,%edx
+  803b61:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b65:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b67:	0f b6 02             	movzbl (%edx),%eax
+  803b6a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b6d:	89 f3                	mov    %esi,%ebx
+  803b6f:	80 fb 09             	cmp    $0x9,%bl
+  803b72:	76 df                	jbe    803b53 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b74:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b77:	89 f3                	mov    %esi,%ebx
+  803b79:	80 fb 19             	cmp    $0x19,%bl
+  803b7c:	77 08                	ja     803b86 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b7e:	0f be c0             	movsbl %al,%eax
+  803b81:	83 e8 57             	sub    $0x57,%eax
+  803b84:	eb d3                	jmp    803b59 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b86:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b89:	89 f3                	mov    %esi,%ebx
+  803b8b:	80 fb 19             	cmp    $0x19,%bl
+  803b8e:	77 08                	ja     803b98 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b90:	0f be c0             	movsbl %al,%eax
+  803b93:	83 e8 37             	sub    $0x37,%eax
+  803b96:	eb c1                	jmp    803b59 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b98:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b9c:	74 05                	je     803ba3 <strtol+0xcc>
+		*endptr = (char *) s;
+  803b9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ba1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803ba3:	89 c8                	mov    %ecx,%eax
+  803ba5:	f7 d8                	neg    %eax
+  803ba7:	85 ff                	test   %edi,%edi
+  803ba9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803bac:	89 c8                	mov    %ecx,%eax
+  803bae:	5b                   	pop    %ebx
+  803baf:	5e                   	pop    %esi
+  803bb0:	5f                   	pop    %edi
+  803bb1:	5d                   	pop    %ebp
+  803bb2:	c3                   	ret
+
+00803bb3 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803bb3:	55                   	push   %ebp
+  803bb4:	89 e5                	mov    %esp,%ebp
+  803bb6:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bb9:	6a 00                	push   $0x0
+  803bbb:	6a 00                	push   $0x0
+  803bbd:	ff 75 08             	push   0x8(%ebp)
+  803bc0:	e8 12 ff ff ff       	call   803ad7 <strtol>
+}
+  803bc5:	c9                   	leave
+  803bc6:	c3                   	ret
+
+00803bc7 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bc7:	55                   	push   %ebp
+  803bc8:	89 e5                	mov    %esp,%ebp
+  803bca:	57                   	push   %edi
+  803bcb:	56                   	push   %esi
+  803bcc:	53                   	push   %ebx
+  803bcd:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bd0:	89 d6                	mov    %edx,%esi
+  803bd2:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bd5:	89 cf                	mov    %ecx,%edi
+  803bd7:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bda:	89 fa                	mov    %edi,%edx
+  803bdc:	80 ce 08             	or     $0x8,%dh
+  803bdf:	f6 c5 08             	test   $0x8,%ch
+  803be2:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803be5:	57                   	push   %edi
+  803be6:	56                   	push   %esi
+  803be7:	50                   	push   %eax
+  803be8:	56                   	push   %esi
+  803be9:	6a 00                	push   $0x0
+  803beb:	e8 41 c6 ff ff       	call   800231 <sys_page_map>
+	if (r < 0) {
+  803bf0:	83 c4 20             	add    $0x20,%esp
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	78 27                	js     803c1e <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bf7:	83 ec 0c             	sub    $0xc,%esp
+  803bfa:	57                   	push   %edi
+  803bfb:	56                   	push   %esi
+  803bfc:	6a 00                	push   $0x0
+  803bfe:	56                   	push   %esi
+  803bff:	6a 00                	push   $0x0
+  803c01:	e8 2b c6 ff ff       	call   800231 <sys_page_map>
+  803c06:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c08:	83 c4 20             	add    $0x20,%esp
+  803c0b:	85 c0                	test   %eax,%eax
+  803c0d:	78 24                	js     803c33 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c14:	89 d8                	mov    %ebx,%eax
+  803c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c19:	5b                   	pop    %ebx
+  803c1a:	5e                   	pop    %esi
+  803c1b:	5f                   	pop    %edi
+  803c1c:	5d                   	pop    %ebp
+  803c1d:	c3                   	ret
+  803c1e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c20:	83 ec 08             	sub    $0x8,%esp
+  803c23:	50                   	push   %eax
+  803c24:	68 98 4c 80 00       	push   $0x804c98
+  803c29:	e8 71 f6 ff ff       	call   80329f <cprintf>
+		return r;
+  803c2e:	83 c4 10             	add    $0x10,%esp
+  803c31:	eb e1                	jmp    803c14 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c33:	83 ec 08             	sub    $0x8,%esp
+  803c36:	50                   	push   %eax
+  803c37:	68 c8 4c 80 00       	push   $0x804cc8
+  803c3c:	e8 5e f6 ff ff       	call   80329f <cprintf>
+		return r;
+  803c41:	83 c4 10             	add    $0x10,%esp
+  803c44:	eb ce                	jmp    803c14 <duppage_cow+0x4d>
+
+00803c46 <duppage>:
+{
+  803c46:	55                   	push   %ebp
+  803c47:	89 e5                	mov    %esp,%ebp
+  803c49:	53                   	push   %ebx
+  803c4a:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c4d:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c50:	51                   	push   %ecx
+  803c51:	52                   	push   %edx
+  803c52:	50                   	push   %eax
+  803c53:	52                   	push   %edx
+  803c54:	6a 00                	push   $0x0
+  803c56:	e8 d6 c5 ff ff       	call   800231 <sys_page_map>
+	if (r < 0) {
+  803c5b:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c63:	85 c0                	test   %eax,%eax
+  803c65:	78 07                	js     803c6e <duppage+0x28>
+}
+  803c67:	89 d8                	mov    %ebx,%eax
+  803c69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c6c:	c9                   	leave
+  803c6d:	c3                   	ret
+  803c6e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c70:	83 ec 08             	sub    $0x8,%esp
+  803c73:	50                   	push   %eax
+  803c74:	68 98 4c 80 00       	push   $0x804c98
+  803c79:	e8 21 f6 ff ff       	call   80329f <cprintf>
+		return r;
+  803c7e:	83 c4 10             	add    $0x10,%esp
+  803c81:	eb e4                	jmp    803c67 <duppage+0x21>
+
+00803c83 <cow_copy>:
+{
+  803c83:	55                   	push   %ebp
+  803c84:	89 e5                	mov    %esp,%ebp
+  803c86:	56                   	push   %esi
+  803c87:	53                   	push   %ebx
+  803c88:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c8a:	83 ec 04             	sub    $0x4,%esp
+  803c8d:	6a 07                	push   $0x7
+  803c8f:	68 00 f0 7f 00       	push   $0x7ff000
+  803c94:	6a 00                	push   $0x0
+  803c96:	e8 49 c5 ff ff       	call   8001e4 <sys_page_alloc>
+	if (r < 0) {
+  803c9b:	83 c4 10             	add    $0x10,%esp
+  803c9e:	85 c0                	test   %eax,%eax
+  803ca0:	78 58                	js     803cfa <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803ca2:	83 ec 04             	sub    $0x4,%esp
+  803ca5:	68 00 10 00 00       	push   $0x1000
+  803caa:	56                   	push   %esi
+  803cab:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb0:	e8 54 fd ff ff       	call   803a09 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cb5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cbc:	56                   	push   %esi
+  803cbd:	6a 00                	push   $0x0
+  803cbf:	68 00 f0 7f 00       	push   $0x7ff000
+  803cc4:	6a 00                	push   $0x0
+  803cc6:	e8 66 c5 ff ff       	call   800231 <sys_page_map>
+  803ccb:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ccd:	83 c4 20             	add    $0x20,%esp
+  803cd0:	85 c0                	test   %eax,%eax
+  803cd2:	78 3b                	js     803d0f <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cd4:	83 ec 08             	sub    $0x8,%esp
+  803cd7:	68 00 f0 7f 00       	push   $0x7ff000
+  803cdc:	6a 00                	push   $0x0
+  803cde:	e8 9a c5 ff ff       	call   80027d <sys_page_unmap>
+  803ce3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ce5:	83 c4 10             	add    $0x10,%esp
+  803ce8:	85 c0                	test   %eax,%eax
+  803cea:	78 45                	js     803d31 <cow_copy+0xae>
+	return 0;
+  803cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf1:	89 d8                	mov    %ebx,%eax
+  803cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cf6:	5b                   	pop    %ebx
+  803cf7:	5e                   	pop    %esi
+  803cf8:	5d                   	pop    %ebp
+  803cf9:	c3                   	ret
+  803cfa:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803cfc:	83 ec 08             	sub    $0x8,%esp
+  803cff:	50                   	push   %eax
+  803d00:	68 b8 4d 80 00       	push   $0x804db8
+  803d05:	e8 95 f5 ff ff       	call   80329f <cprintf>
+		return r;
+  803d0a:	83 c4 10             	add    $0x10,%esp
+  803d0d:	eb e2                	jmp    803cf1 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d0f:	83 ec 08             	sub    $0x8,%esp
+  803d12:	50                   	push   %eax
+  803d13:	68 d4 4d 80 00       	push   $0x804dd4
+  803d18:	e8 82 f5 ff ff       	call   80329f <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d1d:	83 c4 08             	add    $0x8,%esp
+  803d20:	68 00 f0 7f 00       	push   $0x7ff000
+  803d25:	6a 00                	push   $0x0
+  803d27:	e8 51 c5 ff ff       	call   80027d <sys_page_unmap>
+		return r;
+  803d2c:	83 c4 10             	add    $0x10,%esp
+  803d2f:	eb c0                	jmp    803cf1 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d31:	83 ec 08             	sub    $0x8,%esp
+  803d34:	50                   	push   %eax
+  803d35:	68 f0 4c 80 00       	push   $0x804cf0
+  803d3a:	e8 60 f5 ff ff       	call   80329f <cprintf>
+		return r;
+  803d3f:	83 c4 10             	add    $0x10,%esp
+  803d42:	eb ad                	jmp    803cf1 <cow_copy+0x6e>
+
+00803d44 <pgfault>:
+{
+  803d44:	55                   	push   %ebp
+  803d45:	89 e5                	mov    %esp,%ebp
+  803d47:	56                   	push   %esi
+  803d48:	53                   	push   %ebx
+  803d49:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d4c:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d4e:	89 d8                	mov    %ebx,%eax
+  803d50:	c1 e8 16             	shr    $0x16,%eax
+  803d53:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d5a:	89 de                	mov    %ebx,%esi
+  803d5c:	c1 ee 0c             	shr    $0xc,%esi
+  803d5f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d66:	a8 07                	test   $0x7,%al
+  803d68:	74 3b                	je     803da5 <pgfault+0x61>
+  803d6a:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d70:	74 33                	je     803da5 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d72:	83 ec 0c             	sub    $0xc,%esp
+  803d75:	68 00 f0 bf ee       	push   $0xeebff000
+  803d7a:	e8 c5 ea ff ff       	call   802844 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d7f:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d86:	83 c4 10             	add    $0x10,%esp
+  803d89:	f6 c4 08             	test   $0x8,%ah
+  803d8c:	75 30                	jne    803dbe <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d8e:	83 ec 0c             	sub    $0xc,%esp
+  803d91:	68 00 f0 bf ee       	push   $0xeebff000
+  803d96:	e8 16 eb ff ff       	call   8028b1 <mutex_unlock>
+}
+  803d9b:	83 c4 10             	add    $0x10,%esp
+  803d9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da1:	5b                   	pop    %ebx
+  803da2:	5e                   	pop    %esi
+  803da3:	5d                   	pop    %ebp
+  803da4:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803da5:	83 ec 08             	sub    $0x8,%esp
+  803da8:	ff 72 28             	push   0x28(%edx)
+  803dab:	51                   	push   %ecx
+  803dac:	50                   	push   %eax
+  803dad:	68 14 4d 80 00       	push   $0x804d14
+  803db2:	6a 3f                	push   $0x3f
+  803db4:	68 ee 4d 80 00       	push   $0x804dee
+  803db9:	e8 06 f4 ff ff       	call   8031c4 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dbe:	89 d8                	mov    %ebx,%eax
+  803dc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dc5:	e8 b9 fe ff ff       	call   803c83 <cow_copy>
+  803dca:	eb c2                	jmp    803d8e <pgfault+0x4a>
+
+00803dcc <cow_enable>:
+{
+  803dcc:	55                   	push   %ebp
+  803dcd:	89 e5                	mov    %esp,%ebp
+  803dcf:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dd2:	68 44 3d 80 00       	push   $0x803d44
+  803dd7:	e8 28 06 00 00       	call   804404 <set_pgfault_handler>
+}
+  803ddc:	83 c4 10             	add    $0x10,%esp
+  803ddf:	c9                   	leave
+  803de0:	c3                   	ret
+
+00803de1 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803de1:	55                   	push   %ebp
+  803de2:	89 e5                	mov    %esp,%ebp
+  803de4:	57                   	push   %edi
+  803de5:	56                   	push   %esi
+  803de6:	53                   	push   %ebx
+  803de7:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803dea:	68 44 3d 80 00       	push   $0x803d44
+  803def:	e8 10 06 00 00       	call   804404 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803df4:	b8 07 00 00 00       	mov    $0x7,%eax
+  803df9:	cd 30                	int    $0x30
+  803dfb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803dfe:	83 c4 10             	add    $0x10,%esp
+  803e01:	85 c0                	test   %eax,%eax
+  803e03:	78 4b                	js     803e50 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e05:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e0f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e12:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e16:	0f 85 16 01 00 00    	jne    803f32 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e1c:	e8 6b c3 ff ff       	call   80018c <sys_getenvid>
+  803e21:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e26:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e28:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e2e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e34:	77 32                	ja     803e68 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e36:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e3b:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e3d:	c1 ea 10             	shr    $0x10,%edx
+  803e40:	74 26                	je     803e68 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e42:	c1 e2 10             	shl    $0x10,%edx
+  803e45:	89 d1                	mov    %edx,%ecx
+  803e47:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e4c:	29 ca                	sub    %ecx,%edx
+  803e4e:	eb 1e                	jmp    803e6e <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e50:	83 ec 08             	sub    $0x8,%esp
+  803e53:	89 c7                	mov    %eax,%edi
+  803e55:	50                   	push   %eax
+  803e56:	68 f9 4d 80 00       	push   $0x804df9
+  803e5b:	e8 3f f4 ff ff       	call   80329f <cprintf>
+		return eid;
+  803e60:	83 c4 10             	add    $0x10,%esp
+  803e63:	e9 6c 01 00 00       	jmp    803fd4 <fork+0x1f3>
+		return pthread_main_tls;
+  803e68:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e6e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e71:	c1 e0 04             	shl    $0x4,%eax
+  803e74:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e79:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e7b:	e8 0d f1 ff ff       	call   802f8d <pthread_fork_child>
+		return eid;
+  803e80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e83:	e9 4c 01 00 00       	jmp    803fd4 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e88:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e8e:	89 da                	mov    %ebx,%edx
+  803e90:	89 f8                	mov    %edi,%eax
+  803e92:	e8 af fd ff ff       	call   803c46 <duppage>
+  803e97:	85 c0                	test   %eax,%eax
+  803e99:	79 28                	jns    803ec3 <fork+0xe2>
+  803e9b:	89 c7                	mov    %eax,%edi
+  803e9d:	e9 32 01 00 00       	jmp    803fd4 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ea2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803ea8:	83 f9 05             	cmp    $0x5,%ecx
+  803eab:	75 58                	jne    803f05 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ead:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803eb2:	89 da                	mov    %ebx,%edx
+  803eb4:	89 f8                	mov    %edi,%eax
+  803eb6:	e8 8b fd ff ff       	call   803c46 <duppage>
+  803ebb:	85 c0                	test   %eax,%eax
+  803ebd:	0f 88 0f 01 00 00    	js     803fd2 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803ec3:	83 c3 01             	add    $0x1,%ebx
+  803ec6:	39 de                	cmp    %ebx,%esi
+  803ec8:	74 54                	je     803f1e <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803eca:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ed1:	f6 c1 05             	test   $0x5,%cl
+  803ed4:	74 ed                	je     803ec3 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ed6:	f6 c5 04             	test   $0x4,%ch
+  803ed9:	75 ad                	jne    803e88 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803edb:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ee1:	74 bf                	je     803ea2 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ee3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ee9:	74 d8                	je     803ec3 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803eeb:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ef1:	89 da                	mov    %ebx,%edx
+  803ef3:	89 f8                	mov    %edi,%eax
+  803ef5:	e8 cd fc ff ff       	call   803bc7 <duppage_cow>
+  803efa:	85 c0                	test   %eax,%eax
+  803efc:	79 c5                	jns    803ec3 <fork+0xe2>
+  803efe:	89 c7                	mov    %eax,%edi
+  803f00:	e9 cf 00 00 00       	jmp    803fd4 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f05:	68 44 4d 80 00       	push   $0x804d44
+  803f0a:	68 b5 47 80 00       	push   $0x8047b5
+  803f0f:	68 c6 00 00 00       	push   $0xc6
+  803f14:	68 ee 4d 80 00       	push   $0x804dee
+  803f19:	e8 a6 f2 ff ff       	call   8031c4 <_panic>
+  803f1e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f21:	83 c1 01             	add    $0x1,%ecx
+  803f24:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f2a:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f30:	74 18                	je     803f4a <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f32:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f39:	a8 07                	test   $0x7,%al
+  803f3b:	74 e4                	je     803f21 <fork+0x140>
+  803f3d:	89 cb                	mov    %ecx,%ebx
+  803f3f:	c1 e3 0a             	shl    $0xa,%ebx
+  803f42:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f45:	e9 7c ff ff ff       	jmp    803ec6 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f4a:	83 ec 04             	sub    $0x4,%esp
+  803f4d:	6a 07                	push   $0x7
+  803f4f:	68 00 f0 bf ee       	push   $0xeebff000
+  803f54:	ff 75 e4             	push   -0x1c(%ebp)
+  803f57:	e8 88 c2 ff ff       	call   8001e4 <sys_page_alloc>
+  803f5c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f5e:	83 c4 10             	add    $0x10,%esp
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	78 34                	js     803f99 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f65:	83 ec 08             	sub    $0x8,%esp
+  803f68:	68 42 44 80 00       	push   $0x804442
+  803f6d:	ff 75 e4             	push   -0x1c(%ebp)
+  803f70:	e8 ec c3 ff ff       	call   800361 <sys_env_set_pgfault_upcall>
+  803f75:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f77:	83 c4 10             	add    $0x10,%esp
+  803f7a:	85 c0                	test   %eax,%eax
+  803f7c:	78 2e                	js     803fac <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f7e:	83 ec 08             	sub    $0x8,%esp
+  803f81:	6a 02                	push   $0x2
+  803f83:	ff 75 e4             	push   -0x1c(%ebp)
+  803f86:	e8 3e c3 ff ff       	call   8002c9 <sys_env_set_status>
+  803f8b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f8d:	83 c4 10             	add    $0x10,%esp
+  803f90:	85 c0                	test   %eax,%eax
+  803f92:	78 2b                	js     803fbf <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f94:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f97:	eb 3b                	jmp    803fd4 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f99:	83 ec 08             	sub    $0x8,%esp
+  803f9c:	50                   	push   %eax
+  803f9d:	68 6c 4d 80 00       	push   $0x804d6c
+  803fa2:	e8 f8 f2 ff ff       	call   80329f <cprintf>
+		return r;
+  803fa7:	83 c4 10             	add    $0x10,%esp
+  803faa:	eb 28                	jmp    803fd4 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fac:	83 ec 08             	sub    $0x8,%esp
+  803faf:	50                   	push   %eax
+  803fb0:	68 94 4d 80 00       	push   $0x804d94
+  803fb5:	e8 e5 f2 ff ff       	call   80329f <cprintf>
+		return r;
+  803fba:	83 c4 10             	add    $0x10,%esp
+  803fbd:	eb 15                	jmp    803fd4 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fbf:	83 ec 08             	sub    $0x8,%esp
+  803fc2:	50                   	push   %eax
+  803fc3:	68 09 4e 80 00       	push   $0x804e09
+  803fc8:	e8 d2 f2 ff ff       	call   80329f <cprintf>
+		return r;
+  803fcd:	83 c4 10             	add    $0x10,%esp
+  803fd0:	eb 02                	jmp    803fd4 <fork+0x1f3>
+  803fd2:	89 c7                	mov    %eax,%edi
+}
+  803fd4:	89 f8                	mov    %edi,%eax
+  803fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fd9:	5b                   	pop    %ebx
+  803fda:	5e                   	pop    %esi
+  803fdb:	5f                   	pop    %edi
+  803fdc:	5d                   	pop    %ebp
+  803fdd:	c3                   	ret
+
+00803fde <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fde:	55                   	push   %ebp
+  803fdf:	89 e5                	mov    %esp,%ebp
+  803fe1:	57                   	push   %edi
+  803fe2:	56                   	push   %esi
+  803fe3:	53                   	push   %ebx
+  803fe4:	83 ec 2c             	sub    $0x2c,%esp
+  803fe7:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe9:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ff4:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ffa:	77 0a                	ja     804006 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ffc:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804001:	29 c3                	sub    %eax,%ebx
+  804003:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804006:	83 ec 0c             	sub    $0xc,%esp
+  804009:	68 44 3d 80 00       	push   $0x803d44
+  80400e:	e8 f1 03 00 00       	call   804404 <set_pgfault_handler>
+  804013:	b8 07 00 00 00       	mov    $0x7,%eax
+  804018:	cd 30                	int    $0x30
+  80401a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80401d:	83 c4 10             	add    $0x10,%esp
+  804020:	85 c0                	test   %eax,%eax
+  804022:	78 30                	js     804054 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804024:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804028:	74 42                	je     80406c <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80402a:	c1 e3 10             	shl    $0x10,%ebx
+  80402d:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804032:	29 d8                	sub    %ebx,%eax
+  804034:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804037:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80403c:	29 d8                	sub    %ebx,%eax
+  80403e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804041:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80404b:	89 f7                	mov    %esi,%edi
+  80404d:	89 d6                	mov    %edx,%esi
+  80404f:	e9 2c 01 00 00       	jmp    804180 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804054:	83 ec 08             	sub    $0x8,%esp
+  804057:	89 c7                	mov    %eax,%edi
+  804059:	50                   	push   %eax
+  80405a:	68 f9 4d 80 00       	push   $0x804df9
+  80405f:	e8 3b f2 ff ff       	call   80329f <cprintf>
+		return eid;
+  804064:	83 c4 10             	add    $0x10,%esp
+  804067:	e9 d5 00 00 00       	jmp    804141 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80406c:	e8 1b c1 ff ff       	call   80018c <sys_getenvid>
+  804071:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804076:	89 c2                	mov    %eax,%edx
+  804078:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80407a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804080:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804085:	77 18                	ja     80409f <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804087:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80408c:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80408e:	c1 e8 10             	shr    $0x10,%eax
+  804091:	74 0c                	je     80409f <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804093:	c1 e0 10             	shl    $0x10,%eax
+  804096:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80409b:	29 c1                	sub    %eax,%ecx
+  80409d:	eb 06                	jmp    8040a5 <sfork+0xc7>
+		return pthread_main_tls;
+  80409f:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040a5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040a8:	c1 e0 04             	shl    $0x4,%eax
+  8040ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040b0:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040b2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040b5:	e9 87 00 00 00       	jmp    804141 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040ba:	f6 c5 04             	test   $0x4,%ch
+  8040bd:	74 6c                	je     80412b <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040bf:	89 ca                	mov    %ecx,%edx
+  8040c1:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040c7:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040cd:	74 7c                	je     80414b <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040cf:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040d5:	89 da                	mov    %ebx,%edx
+  8040d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040da:	e8 67 fb ff ff       	call   803c46 <duppage>
+  8040df:	85 c0                	test   %eax,%eax
+  8040e1:	0f 88 4f 01 00 00    	js     804236 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040e7:	83 c3 01             	add    $0x1,%ebx
+  8040ea:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040ed:	74 7a                	je     804169 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040ef:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040f1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040f8:	f6 c1 01             	test   $0x1,%cl
+  8040fb:	74 ea                	je     8040e7 <sfork+0x109>
+  8040fd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804103:	74 e2                	je     8040e7 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804105:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80410b:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80410e:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804113:	76 a5                	jbe    8040ba <sfork+0xdc>
+  804115:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80411b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80411e:	39 fa                	cmp    %edi,%edx
+  804120:	73 9d                	jae    8040bf <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804122:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804125:	39 fa                	cmp    %edi,%edx
+  804127:	72 96                	jb     8040bf <sfork+0xe1>
+  804129:	eb 8f                	jmp    8040ba <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80412b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804131:	89 da                	mov    %ebx,%edx
+  804133:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804136:	e8 8c fa ff ff       	call   803bc7 <duppage_cow>
+  80413b:	85 c0                	test   %eax,%eax
+  80413d:	79 a8                	jns    8040e7 <sfork+0x109>
+  80413f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804141:	89 f8                	mov    %edi,%eax
+  804143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804146:	5b                   	pop    %ebx
+  804147:	5e                   	pop    %esi
+  804148:	5f                   	pop    %edi
+  804149:	5d                   	pop    %ebp
+  80414a:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80414b:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804150:	e8 2e fb ff ff       	call   803c83 <cow_copy>
+  804155:	85 c0                	test   %eax,%eax
+  804157:	0f 88 d2 00 00 00    	js     80422f <sfork+0x251>
+				pte = uvpt[pn];
+  80415d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804164:	e9 66 ff ff ff       	jmp    8040cf <sfork+0xf1>
+  804169:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80416c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80416f:	83 c6 01             	add    $0x1,%esi
+  804172:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804178:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80417e:	74 1b                	je     80419b <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804180:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804187:	a8 01                	test   $0x1,%al
+  804189:	74 e4                	je     80416f <sfork+0x191>
+  80418b:	89 f3                	mov    %esi,%ebx
+  80418d:	c1 e3 0a             	shl    $0xa,%ebx
+  804190:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804193:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804196:	e9 4f ff ff ff       	jmp    8040ea <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80419b:	83 ec 04             	sub    $0x4,%esp
+  80419e:	6a 07                	push   $0x7
+  8041a0:	68 00 f0 bf ee       	push   $0xeebff000
+  8041a5:	ff 75 e0             	push   -0x20(%ebp)
+  8041a8:	e8 37 c0 ff ff       	call   8001e4 <sys_page_alloc>
+  8041ad:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041af:	83 c4 10             	add    $0x10,%esp
+  8041b2:	85 c0                	test   %eax,%eax
+  8041b4:	78 37                	js     8041ed <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041b6:	83 ec 08             	sub    $0x8,%esp
+  8041b9:	68 42 44 80 00       	push   $0x804442
+  8041be:	ff 75 e0             	push   -0x20(%ebp)
+  8041c1:	e8 9b c1 ff ff       	call   800361 <sys_env_set_pgfault_upcall>
+  8041c6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041c8:	83 c4 10             	add    $0x10,%esp
+  8041cb:	85 c0                	test   %eax,%eax
+  8041cd:	78 34                	js     804203 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041cf:	83 ec 08             	sub    $0x8,%esp
+  8041d2:	6a 02                	push   $0x2
+  8041d4:	ff 75 e0             	push   -0x20(%ebp)
+  8041d7:	e8 ed c0 ff ff       	call   8002c9 <sys_env_set_status>
+  8041dc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041de:	83 c4 10             	add    $0x10,%esp
+  8041e1:	85 c0                	test   %eax,%eax
+  8041e3:	78 34                	js     804219 <sfork+0x23b>
+	return eid;
+  8041e5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041e8:	e9 54 ff ff ff       	jmp    804141 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041ed:	83 ec 08             	sub    $0x8,%esp
+  8041f0:	50                   	push   %eax
+  8041f1:	68 6c 4d 80 00       	push   $0x804d6c
+  8041f6:	e8 a4 f0 ff ff       	call   80329f <cprintf>
+		return r;
+  8041fb:	83 c4 10             	add    $0x10,%esp
+  8041fe:	e9 3e ff ff ff       	jmp    804141 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804203:	83 ec 08             	sub    $0x8,%esp
+  804206:	50                   	push   %eax
+  804207:	68 94 4d 80 00       	push   $0x804d94
+  80420c:	e8 8e f0 ff ff       	call   80329f <cprintf>
+		return r;
+  804211:	83 c4 10             	add    $0x10,%esp
+  804214:	e9 28 ff ff ff       	jmp    804141 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804219:	83 ec 08             	sub    $0x8,%esp
+  80421c:	50                   	push   %eax
+  80421d:	68 09 4e 80 00       	push   $0x804e09
+  804222:	e8 78 f0 ff ff       	call   80329f <cprintf>
+		return r;
+  804227:	83 c4 10             	add    $0x10,%esp
+  80422a:	e9 12 ff ff ff       	jmp    804141 <sfork+0x163>
+  80422f:	89 c7                	mov    %eax,%edi
+  804231:	e9 0b ff ff ff       	jmp    804141 <sfork+0x163>
+  804236:	89 c7                	mov    %eax,%edi
+  804238:	e9 04 ff ff ff       	jmp    804141 <sfork+0x163>
+
+0080423d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80423d:	55                   	push   %ebp
+  80423e:	89 e5                	mov    %esp,%ebp
+  804240:	57                   	push   %edi
+  804241:	56                   	push   %esi
+  804242:	53                   	push   %ebx
+  804243:	83 ec 18             	sub    $0x18,%esp
+  804246:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804249:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80424c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804256:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804259:	50                   	push   %eax
+  80425a:	e8 7b c1 ff ff       	call   8003da <sys_ipc_recv>
+	if (r < 0) {
+  80425f:	83 c4 10             	add    $0x10,%esp
+  804262:	85 c0                	test   %eax,%eax
+  804264:	78 2b                	js     804291 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804266:	85 ff                	test   %edi,%edi
+  804268:	74 55                	je     8042bf <ipc_recv+0x82>
+  80426a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80426c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804272:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804277:	77 39                	ja     8042b2 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804279:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80427e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804280:	c1 e8 10             	shr    $0x10,%eax
+  804283:	74 2d                	je     8042b2 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804285:	c1 e0 10             	shl    $0x10,%eax
+  804288:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80428d:	29 c2                	sub    %eax,%edx
+  80428f:	eb 27                	jmp    8042b8 <ipc_recv+0x7b>
+  804291:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804293:	83 ec 08             	sub    $0x8,%esp
+  804296:	50                   	push   %eax
+  804297:	68 27 4e 80 00       	push   $0x804e27
+  80429c:	e8 fe ef ff ff       	call   80329f <cprintf>
+		*from_env_store = 0;
+  8042a1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042ad:	83 c4 10             	add    $0x10,%esp
+  8042b0:	eb 77                	jmp    804329 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042b2:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042b8:	8b 02                	mov    (%edx),%eax
+  8042ba:	8b 40 78             	mov    0x78(%eax),%eax
+  8042bd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042bf:	85 f6                	test   %esi,%esi
+  8042c1:	74 34                	je     8042f7 <ipc_recv+0xba>
+  8042c3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042c5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042cb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d0:	77 18                	ja     8042ea <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042d7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042d9:	c1 e8 10             	shr    $0x10,%eax
+  8042dc:	74 0c                	je     8042ea <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042de:	c1 e0 10             	shl    $0x10,%eax
+  8042e1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042e6:	29 c2                	sub    %eax,%edx
+  8042e8:	eb 06                	jmp    8042f0 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042ea:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042f0:	8b 02                	mov    (%edx),%eax
+  8042f2:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042f5:	89 06                	mov    %eax,(%esi)
+  8042f7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042f9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ff:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804304:	77 18                	ja     80431e <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804306:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80430b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80430d:	c1 e8 10             	shr    $0x10,%eax
+  804310:	74 0c                	je     80431e <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804312:	c1 e0 10             	shl    $0x10,%eax
+  804315:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80431a:	29 c2                	sub    %eax,%edx
+  80431c:	eb 06                	jmp    804324 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80431e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804324:	8b 02                	mov    (%edx),%eax
+  804326:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804329:	89 d8                	mov    %ebx,%eax
+  80432b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80432e:	5b                   	pop    %ebx
+  80432f:	5e                   	pop    %esi
+  804330:	5f                   	pop    %edi
+  804331:	5d                   	pop    %ebp
+  804332:	c3                   	ret
+
+00804333 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804333:	55                   	push   %ebp
+  804334:	89 e5                	mov    %esp,%ebp
+  804336:	57                   	push   %edi
+  804337:	56                   	push   %esi
+  804338:	53                   	push   %ebx
+  804339:	83 ec 0c             	sub    $0xc,%esp
+  80433c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80433f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804342:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804345:	85 db                	test   %ebx,%ebx
+  804347:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80434c:	0f 44 d8             	cmove  %eax,%ebx
+  80434f:	eb 05                	jmp    804356 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804351:	e8 62 be ff ff       	call   8001b8 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804356:	57                   	push   %edi
+  804357:	53                   	push   %ebx
+  804358:	ff 75 0c             	push   0xc(%ebp)
+  80435b:	56                   	push   %esi
+  80435c:	e8 4c c0 ff ff       	call   8003ad <sys_ipc_try_send>
+		if (r == 0) {
+  804361:	83 c4 10             	add    $0x10,%esp
+  804364:	85 c0                	test   %eax,%eax
+  804366:	74 19                	je     804381 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804368:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80436b:	74 e4                	je     804351 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80436d:	83 ec 0c             	sub    $0xc,%esp
+  804370:	50                   	push   %eax
+  804371:	57                   	push   %edi
+  804372:	53                   	push   %ebx
+  804373:	56                   	push   %esi
+  804374:	68 40 4e 80 00       	push   $0x804e40
+  804379:	e8 21 ef ff ff       	call   80329f <cprintf>
+			return;
+  80437e:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804384:	5b                   	pop    %ebx
+  804385:	5e                   	pop    %esi
+  804386:	5f                   	pop    %edi
+  804387:	5d                   	pop    %ebp
+  804388:	c3                   	ret
+
+00804389 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804389:	55                   	push   %ebp
+  80438a:	89 e5                	mov    %esp,%ebp
+  80438c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80438f:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804394:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804397:	c1 e0 04             	shl    $0x4,%eax
+  80439a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80439f:	8b 40 50             	mov    0x50(%eax),%eax
+  8043a2:	39 c8                	cmp    %ecx,%eax
+  8043a4:	74 12                	je     8043b8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043a6:	83 c2 01             	add    $0x1,%edx
+  8043a9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043af:	75 e3                	jne    804394 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b6:	eb 0e                	jmp    8043c6 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043b8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043bb:	c1 e0 04             	shl    $0x4,%eax
+  8043be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043c3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043c6:	5d                   	pop    %ebp
+  8043c7:	c3                   	ret
+
+008043c8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043c8:	55                   	push   %ebp
+  8043c9:	89 e5                	mov    %esp,%ebp
+  8043cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043ce:	89 c2                	mov    %eax,%edx
+  8043d0:	c1 ea 16             	shr    $0x16,%edx
+  8043d3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043da:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043df:	f6 c1 01             	test   $0x1,%cl
+  8043e2:	74 1c                	je     804400 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043e4:	c1 e8 0c             	shr    $0xc,%eax
+  8043e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043ee:	a8 01                	test   $0x1,%al
+  8043f0:	74 0e                	je     804400 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043f2:	c1 e8 0c             	shr    $0xc,%eax
+  8043f5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043fc:	ef 
+  8043fd:	0f b7 d2             	movzwl %dx,%edx
+}
+  804400:	89 d0                	mov    %edx,%eax
+  804402:	5d                   	pop    %ebp
+  804403:	c3                   	ret
+
+00804404 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804404:	55                   	push   %ebp
+  804405:	89 e5                	mov    %esp,%ebp
+  804407:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80440a:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804411:	74 0a                	je     80441d <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804413:	8b 45 08             	mov    0x8(%ebp),%eax
+  804416:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80441b:	c9                   	leave
+  80441c:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80441d:	83 ec 04             	sub    $0x4,%esp
+  804420:	6a 07                	push   $0x7
+  804422:	68 00 f0 bf ee       	push   $0xeebff000
+  804427:	6a 00                	push   $0x0
+  804429:	e8 b6 bd ff ff       	call   8001e4 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80442e:	83 c4 08             	add    $0x8,%esp
+  804431:	68 42 44 80 00       	push   $0x804442
+  804436:	6a 00                	push   $0x0
+  804438:	e8 24 bf ff ff       	call   800361 <sys_env_set_pgfault_upcall>
+  80443d:	83 c4 10             	add    $0x10,%esp
+  804440:	eb d1                	jmp    804413 <set_pgfault_handler+0xf>
+
+00804442 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804442:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804443:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804448:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80444a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80444d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804451:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804455:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804458:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80445c:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80445e:	83 c4 08             	add    $0x8,%esp
+	popal
+  804461:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804462:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804465:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804466:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804467:	c3                   	ret
+
+00804468 <udm>:
+  804468:	57                   	push   %edi
+  804469:	56                   	push   %esi
+  80446a:	53                   	push   %ebx
+  80446b:	83 ec 20             	sub    $0x20,%esp
+  80446e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804472:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804476:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80447a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80447e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804482:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804486:	89 d1                	mov    %edx,%ecx
+  804488:	09 c1                	or     %eax,%ecx
+  80448a:	0f 84 91 00 00 00    	je     804521 <udm+0xb9>
+  804490:	b8 00 00 00 00       	mov    $0x0,%eax
+  804495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80449a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80449f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044a6:	00 
+  8044a7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044ae:	00 
+  8044af:	eb 08                	jmp    8044b9 <udm+0x51>
+  8044b1:	83 e9 01             	sub    $0x1,%ecx
+  8044b4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044b7:	74 7c                	je     804535 <udm+0xcd>
+  8044b9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044bd:	01 c0                	add    %eax,%eax
+  8044bf:	89 c6                	mov    %eax,%esi
+  8044c1:	89 d7                	mov    %edx,%edi
+  8044c3:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044c7:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044cb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044ce:	d3 ea                	shr    %cl,%edx
+  8044d0:	f6 c1 20             	test   $0x20,%cl
+  8044d3:	74 04                	je     8044d9 <udm+0x71>
+  8044d5:	89 d0                	mov    %edx,%eax
+  8044d7:	31 d2                	xor    %edx,%edx
+  8044d9:	83 e0 01             	and    $0x1,%eax
+  8044dc:	89 04 24             	mov    %eax,(%esp)
+  8044df:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044e6:	00 
+  8044e7:	8b 04 24             	mov    (%esp),%eax
+  8044ea:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044ee:	09 f0                	or     %esi,%eax
+  8044f0:	09 fa                	or     %edi,%edx
+  8044f2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044f6:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044fa:	39 f0                	cmp    %esi,%eax
+  8044fc:	89 d3                	mov    %edx,%ebx
+  8044fe:	19 fb                	sbb    %edi,%ebx
+  804500:	72 af                	jb     8044b1 <udm+0x49>
+  804502:	29 f0                	sub    %esi,%eax
+  804504:	19 fa                	sbb    %edi,%edx
+  804506:	89 cf                	mov    %ecx,%edi
+  804508:	c1 ef 05             	shr    $0x5,%edi
+  80450b:	83 e7 01             	and    $0x1,%edi
+  80450e:	89 fe                	mov    %edi,%esi
+  804510:	83 f6 01             	xor    $0x1,%esi
+  804513:	d3 e6                	shl    %cl,%esi
+  804515:	d3 e7                	shl    %cl,%edi
+  804517:	09 74 24 18          	or     %esi,0x18(%esp)
+  80451b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80451f:	eb 90                	jmp    8044b1 <udm+0x49>
+  804521:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804525:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804529:	89 f0                	mov    %esi,%eax
+  80452b:	89 fa                	mov    %edi,%edx
+  80452d:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804531:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804535:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804539:	89 01                	mov    %eax,(%ecx)
+  80453b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80453e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804542:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804546:	83 c4 20             	add    $0x20,%esp
+  804549:	5b                   	pop    %ebx
+  80454a:	5e                   	pop    %esi
+  80454b:	5f                   	pop    %edi
+  80454c:	c3                   	ret
+
+0080454d <__udivdi3>:
+  80454d:	83 ec 18             	sub    $0x18,%esp
+  804550:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804554:	50                   	push   %eax
+  804555:	ff 74 24 2c          	push   0x2c(%esp)
+  804559:	ff 74 24 2c          	push   0x2c(%esp)
+  80455d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804561:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804565:	e8 fe fe ff ff       	call   804468 <udm>
+  80456a:	83 c4 24             	add    $0x24,%esp
+  80456d:	c3                   	ret
+
+0080456e <__umoddi3>:
+  80456e:	83 ec 18             	sub    $0x18,%esp
+  804571:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804575:	50                   	push   %eax
+  804576:	ff 74 24 2c          	push   0x2c(%esp)
+  80457a:	ff 74 24 2c          	push   0x2c(%esp)
+  80457e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804582:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804586:	e8 dd fe ff ff       	call   804468 <udm>
+  80458b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80458f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804593:	83 c4 24             	add    $0x24,%esp
+  804596:	c3                   	ret
+
+00804597 <__divdi3>:
+  804597:	56                   	push   %esi
+  804598:	53                   	push   %ebx
+  804599:	83 ec 14             	sub    $0x14,%esp
+  80459c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045a0:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045a4:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045a8:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045ac:	85 d2                	test   %edx,%edx
+  8045ae:	78 18                	js     8045c8 <__divdi3+0x31>
+  8045b0:	85 db                	test   %ebx,%ebx
+  8045b2:	78 3e                	js     8045f2 <__divdi3+0x5b>
+  8045b4:	83 ec 04             	sub    $0x4,%esp
+  8045b7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045bb:	56                   	push   %esi
+  8045bc:	53                   	push   %ebx
+  8045bd:	51                   	push   %ecx
+  8045be:	e8 a5 fe ff ff       	call   804468 <udm>
+  8045c3:	83 c4 10             	add    $0x10,%esp
+  8045c6:	eb 24                	jmp    8045ec <__divdi3+0x55>
+  8045c8:	f7 d8                	neg    %eax
+  8045ca:	83 d2 00             	adc    $0x0,%edx
+  8045cd:	f7 da                	neg    %edx
+  8045cf:	85 db                	test   %ebx,%ebx
+  8045d1:	78 3a                	js     80460d <__divdi3+0x76>
+  8045d3:	83 ec 04             	sub    $0x4,%esp
+  8045d6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045da:	56                   	push   %esi
+  8045db:	53                   	push   %ebx
+  8045dc:	51                   	push   %ecx
+  8045dd:	e8 86 fe ff ff       	call   804468 <udm>
+  8045e2:	83 c4 10             	add    $0x10,%esp
+  8045e5:	f7 d8                	neg    %eax
+  8045e7:	83 d2 00             	adc    $0x0,%edx
+  8045ea:	f7 da                	neg    %edx
+  8045ec:	83 c4 14             	add    $0x14,%esp
+  8045ef:	5b                   	pop    %ebx
+  8045f0:	5e                   	pop    %esi
+  8045f1:	c3                   	ret
+  8045f2:	83 ec 04             	sub    $0x4,%esp
+  8045f5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045f9:	56                   	push   %esi
+  8045fa:	f7 d9                	neg    %ecx
+  8045fc:	83 d3 00             	adc    $0x0,%ebx
+  8045ff:	f7 db                	neg    %ebx
+  804601:	53                   	push   %ebx
+  804602:	51                   	push   %ecx
+  804603:	e8 60 fe ff ff       	call   804468 <udm>
+  804608:	83 c4 10             	add    $0x10,%esp
+  80460b:	eb d8                	jmp    8045e5 <__divdi3+0x4e>
+  80460d:	83 ec 04             	sub    $0x4,%esp
+  804610:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804614:	56                   	push   %esi
+  804615:	f7 d9                	neg    %ecx
+  804617:	83 d3 00             	adc    $0x0,%ebx
+  80461a:	f7 db                	neg    %ebx
+  80461c:	53                   	push   %ebx
+  80461d:	51                   	push   %ecx
+  80461e:	e8 45 fe ff ff       	call   804468 <udm>
+  804623:	83 c4 10             	add    $0x10,%esp
+  804626:	eb c4                	jmp    8045ec <__divdi3+0x55>
+
+00804628 <__moddi3>:
+  804628:	55                   	push   %ebp
+  804629:	57                   	push   %edi
+  80462a:	56                   	push   %esi
+  80462b:	53                   	push   %ebx
+  80462c:	83 ec 24             	sub    $0x24,%esp
+  80462f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804633:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804637:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80463b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80463f:	85 d2                	test   %edx,%edx
+  804641:	78 3b                	js     80467e <__moddi3+0x56>
+  804643:	83 ec 04             	sub    $0x4,%esp
+  804646:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80464a:	56                   	push   %esi
+  80464b:	89 ce                	mov    %ecx,%esi
+  80464d:	f7 de                	neg    %esi
+  80464f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804653:	89 de                	mov    %ebx,%esi
+  804655:	83 d6 00             	adc    $0x0,%esi
+  804658:	f7 de                	neg    %esi
+  80465a:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80465e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804662:	0f 48 f1             	cmovs  %ecx,%esi
+  804665:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80466a:	53                   	push   %ebx
+  80466b:	56                   	push   %esi
+  80466c:	e8 f7 fd ff ff       	call   804468 <udm>
+  804671:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804675:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804679:	83 c4 10             	add    $0x10,%esp
+  80467c:	eb 47                	jmp    8046c5 <__moddi3+0x9d>
+  80467e:	f7 d8                	neg    %eax
+  804680:	83 d2 00             	adc    $0x0,%edx
+  804683:	f7 da                	neg    %edx
+  804685:	83 ec 04             	sub    $0x4,%esp
+  804688:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80468c:	56                   	push   %esi
+  80468d:	89 cf                	mov    %ecx,%edi
+  80468f:	f7 df                	neg    %edi
+  804691:	89 de                	mov    %ebx,%esi
+  804693:	83 d6 00             	adc    $0x0,%esi
+  804696:	f7 de                	neg    %esi
+  804698:	0f 49 cf             	cmovns %edi,%ecx
+  80469b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80469f:	0f 49 de             	cmovns %esi,%ebx
+  8046a2:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046a6:	ff 74 24 0c          	push   0xc(%esp)
+  8046aa:	ff 74 24 0c          	push   0xc(%esp)
+  8046ae:	e8 b5 fd ff ff       	call   804468 <udm>
+  8046b3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046bb:	f7 d8                	neg    %eax
+  8046bd:	83 d2 00             	adc    $0x0,%edx
+  8046c0:	f7 da                	neg    %edx
+  8046c2:	83 c4 10             	add    $0x10,%esp
+  8046c5:	83 c4 24             	add    $0x24,%esp
+  8046c8:	5b                   	pop    %ebx
+  8046c9:	5e                   	pop    %esi
+  8046ca:	5f                   	pop    %edi
+  8046cb:	5d                   	pop    %ebp
+  8046cc:	c3                   	ret
@@ -0,0 +1,9687 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 50 80 00    	push   0x805000
+  800044:	e8 a8 00 00 00       	call   8000f1 <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 1c             	sub    $0x1c,%esp
+  800057:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80005d:	e8 31 01 00 00       	call   800193 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800062:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800065:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  80006b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800070:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800072:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800074:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80007a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80007f:	77 16                	ja     800097 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800081:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800086:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800088:	c1 e8 10             	shr    $0x10,%eax
+  80008b:	74 0a                	je     800097 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80008d:	c1 e0 10             	shl    $0x10,%eax
+  800090:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800095:	29 c2                	sub    %eax,%edx
+  800097:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80009a:	c1 e0 04             	shl    $0x4,%eax
+  80009d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a2:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a4:	85 db                	test   %ebx,%ebx
+  8000a6:	7e 07                	jle    8000af <libmain+0x61>
+		binaryname = argv[0];
+  8000a8:	8b 06                	mov    (%esi),%eax
+  8000aa:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8000af:	83 ec 08             	sub    $0x8,%esp
+  8000b2:	56                   	push   %esi
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 7a ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b9:	e8 0b 00 00 00       	call   8000c9 <exit>
+}
+  8000be:	83 c4 10             	add    $0x10,%esp
+  8000c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c4:	5b                   	pop    %ebx
+  8000c5:	5e                   	pop    %esi
+  8000c6:	5f                   	pop    %edi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	e8 12 17 00 00       	call   8017e8 <fflush>
+	pthread_kill_others();
+  8000d6:	e8 7d 2d 00 00       	call   802e58 <pthread_kill_others>
+	close_all();
+  8000db:	e8 ab 07 00 00       	call   80088b <close_all>
+	sys_env_destroy(0);
+  8000e0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000e7:	e8 5c 00 00 00       	call   800148 <sys_env_destroy>
+}
+  8000ec:	83 c4 10             	add    $0x10,%esp
+  8000ef:	c9                   	leave
+  8000f0:	c3                   	ret
+
+008000f1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	57                   	push   %edi
+  8000f5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800101:	89 c3                	mov    %eax,%ebx
+  800103:	89 c7                	mov    %eax,%edi
+  800105:	6a 00                	push   $0x0
+  800107:	55                   	push   %ebp
+  800108:	56                   	push   %esi
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	8d 35 13 01 80 00    	lea    0x800113,%esi
+  800111:	0f 34                	sysenter
+
+00800113 <after_sysenter_label_47>:
+  800113:	5e                   	pop    %esi
+  800114:	5d                   	pop    %ebp
+  800115:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800118:	5b                   	pop    %ebx
+  800119:	5f                   	pop    %edi
+  80011a:	5d                   	pop    %ebp
+  80011b:	c3                   	ret
+
+0080011c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80011c:	55                   	push   %ebp
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	57                   	push   %edi
+  800120:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800121:	ba 00 00 00 00       	mov    $0x0,%edx
+  800126:	b8 01 00 00 00       	mov    $0x1,%eax
+  80012b:	89 d1                	mov    %edx,%ecx
+  80012d:	89 d3                	mov    %edx,%ebx
+  80012f:	89 d7                	mov    %edx,%edi
+  800131:	6a 00                	push   $0x0
+  800133:	55                   	push   %ebp
+  800134:	56                   	push   %esi
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	8d 35 3f 01 80 00    	lea    0x80013f,%esi
+  80013d:	0f 34                	sysenter
+
+0080013f <after_sysenter_label_128>:
+  80013f:	5e                   	pop    %esi
+  800140:	5d                   	pop    %ebp
+  800141:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800144:	5b                   	pop    %ebx
+  800145:	5f                   	pop    %edi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+
+00800148 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	57                   	push   %edi
+  80014c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80014d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800155:	b8 03 00 00 00       	mov    $0x3,%eax
+  80015a:	89 cb                	mov    %ecx,%ebx
+  80015c:	89 cf                	mov    %ecx,%edi
+  80015e:	6a 00                	push   $0x0
+  800160:	55                   	push   %ebp
+  800161:	56                   	push   %esi
+  800162:	89 e5                	mov    %esp,%ebp
+  800164:	8d 35 6c 01 80 00    	lea    0x80016c,%esi
+  80016a:	0f 34                	sysenter
+
+0080016c <after_sysenter_label_212>:
+  80016c:	5e                   	pop    %esi
+  80016d:	5d                   	pop    %ebp
+  80016e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800171:	85 c0                	test   %eax,%eax
+  800173:	7f 07                	jg     80017c <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800175:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800178:	5b                   	pop    %ebx
+  800179:	5f                   	pop    %edi
+  80017a:	5d                   	pop    %ebp
+  80017b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80017c:	83 ec 0c             	sub    $0xc,%esp
+  80017f:	50                   	push   %eax
+  800180:	6a 03                	push   $0x3
+  800182:	68 f8 46 80 00       	push   $0x8046f8
+  800187:	6a 54                	push   $0x54
+  800189:	68 15 47 80 00       	push   $0x804715
+  80018e:	e8 38 30 00 00       	call   8031cb <_panic>
+
+00800193 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	57                   	push   %edi
+  800197:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8001a2:	89 d1                	mov    %edx,%ecx
+  8001a4:	89 d3                	mov    %edx,%ebx
+  8001a6:	89 d7                	mov    %edx,%edi
+  8001a8:	6a 00                	push   $0x0
+  8001aa:	55                   	push   %ebp
+  8001ab:	56                   	push   %esi
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	8d 35 b6 01 80 00    	lea    0x8001b6,%esi
+  8001b4:	0f 34                	sysenter
+
+008001b6 <after_sysenter_label_309>:
+  8001b6:	5e                   	pop    %esi
+  8001b7:	5d                   	pop    %ebp
+  8001b8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001bb:	5b                   	pop    %ebx
+  8001bc:	5f                   	pop    %edi
+  8001bd:	5d                   	pop    %ebp
+  8001be:	c3                   	ret
+
+008001bf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001bf:	55                   	push   %ebp
+  8001c0:	89 e5                	mov    %esp,%ebp
+  8001c2:	57                   	push   %edi
+  8001c3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001ce:	89 d1                	mov    %edx,%ecx
+  8001d0:	89 d3                	mov    %edx,%ebx
+  8001d2:	89 d7                	mov    %edx,%edi
+  8001d4:	6a 00                	push   $0x0
+  8001d6:	55                   	push   %ebp
+  8001d7:	56                   	push   %esi
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	8d 35 e2 01 80 00    	lea    0x8001e2,%esi
+  8001e0:	0f 34                	sysenter
+
+008001e2 <after_sysenter_label_391>:
+  8001e2:	5e                   	pop    %esi
+  8001e3:	5d                   	pop    %ebp
+  8001e4:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001e7:	5b                   	pop    %ebx
+  8001e8:	5f                   	pop    %edi
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	c3                   	ret
+
+008001eb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	57                   	push   %edi
+  8001ef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800203:	6a 00                	push   $0x0
+  800205:	55                   	push   %ebp
+  800206:	56                   	push   %esi
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	8d 35 11 02 80 00    	lea    0x800211,%esi
+  80020f:	0f 34                	sysenter
+
+00800211 <after_sysenter_label_479>:
+  800211:	5e                   	pop    %esi
+  800212:	5d                   	pop    %ebp
+  800213:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800216:	85 c0                	test   %eax,%eax
+  800218:	7f 07                	jg     800221 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80021a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80021d:	5b                   	pop    %ebx
+  80021e:	5f                   	pop    %edi
+  80021f:	5d                   	pop    %ebp
+  800220:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  800224:	50                   	push   %eax
+  800225:	6a 04                	push   $0x4
+  800227:	68 f8 46 80 00       	push   $0x8046f8
+  80022c:	6a 54                	push   $0x54
+  80022e:	68 15 47 80 00       	push   $0x804715
+  800233:	e8 93 2f 00 00       	call   8031cb <_panic>
+
+00800238 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80023d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800243:	b8 05 00 00 00       	mov    $0x5,%eax
+  800248:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80024b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80024e:	ff 75 18             	push   0x18(%ebp)
+  800251:	55                   	push   %ebp
+  800252:	56                   	push   %esi
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	8d 35 5d 02 80 00    	lea    0x80025d,%esi
+  80025b:	0f 34                	sysenter
+
+0080025d <after_sysenter_label_593>:
+  80025d:	5e                   	pop    %esi
+  80025e:	5d                   	pop    %ebp
+  80025f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800262:	85 c0                	test   %eax,%eax
+  800264:	7f 07                	jg     80026d <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800266:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800269:	5b                   	pop    %ebx
+  80026a:	5f                   	pop    %edi
+  80026b:	5d                   	pop    %ebp
+  80026c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	50                   	push   %eax
+  800271:	6a 05                	push   $0x5
+  800273:	68 f8 46 80 00       	push   $0x8046f8
+  800278:	6a 54                	push   $0x54
+  80027a:	68 15 47 80 00       	push   $0x804715
+  80027f:	e8 47 2f 00 00       	call   8031cb <_panic>
+
+00800284 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	57                   	push   %edi
+  800288:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800294:	b8 06 00 00 00       	mov    $0x6,%eax
+  800299:	89 df                	mov    %ebx,%edi
+  80029b:	6a 00                	push   $0x0
+  80029d:	55                   	push   %ebp
+  80029e:	56                   	push   %esi
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	8d 35 a9 02 80 00    	lea    0x8002a9,%esi
+  8002a7:	0f 34                	sysenter
+
+008002a9 <after_sysenter_label_704>:
+  8002a9:	5e                   	pop    %esi
+  8002aa:	5d                   	pop    %ebp
+  8002ab:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	7f 07                	jg     8002b9 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002b5:	5b                   	pop    %ebx
+  8002b6:	5f                   	pop    %edi
+  8002b7:	5d                   	pop    %ebp
+  8002b8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+  8002bc:	50                   	push   %eax
+  8002bd:	6a 06                	push   $0x6
+  8002bf:	68 f8 46 80 00       	push   $0x8046f8
+  8002c4:	6a 54                	push   $0x54
+  8002c6:	68 15 47 80 00       	push   $0x804715
+  8002cb:	e8 fb 2e 00 00       	call   8031cb <_panic>
+
+008002d0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002d0:	55                   	push   %ebp
+  8002d1:	89 e5                	mov    %esp,%ebp
+  8002d3:	57                   	push   %edi
+  8002d4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e5:	89 df                	mov    %ebx,%edi
+  8002e7:	6a 00                	push   $0x0
+  8002e9:	55                   	push   %ebp
+  8002ea:	56                   	push   %esi
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	8d 35 f5 02 80 00    	lea    0x8002f5,%esi
+  8002f3:	0f 34                	sysenter
+
+008002f5 <after_sysenter_label_808>:
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002fa:	85 c0                	test   %eax,%eax
+  8002fc:	7f 07                	jg     800305 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800301:	5b                   	pop    %ebx
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	50                   	push   %eax
+  800309:	6a 08                	push   $0x8
+  80030b:	68 f8 46 80 00       	push   $0x8046f8
+  800310:	6a 54                	push   $0x54
+  800312:	68 15 47 80 00       	push   $0x804715
+  800317:	e8 af 2e 00 00       	call   8031cb <_panic>
+
+0080031c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	57                   	push   %edi
+  800320:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800321:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800326:	8b 55 08             	mov    0x8(%ebp),%edx
+  800329:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80032c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800331:	89 df                	mov    %ebx,%edi
+  800333:	6a 00                	push   $0x0
+  800335:	55                   	push   %ebp
+  800336:	56                   	push   %esi
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	8d 35 41 03 80 00    	lea    0x800341,%esi
+  80033f:	0f 34                	sysenter
+
+00800341 <after_sysenter_label_912>:
+  800341:	5e                   	pop    %esi
+  800342:	5d                   	pop    %ebp
+  800343:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800346:	85 c0                	test   %eax,%eax
+  800348:	7f 07                	jg     800351 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80034a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80034d:	5b                   	pop    %ebx
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800351:	83 ec 0c             	sub    $0xc,%esp
+  800354:	50                   	push   %eax
+  800355:	6a 09                	push   $0x9
+  800357:	68 f8 46 80 00       	push   $0x8046f8
+  80035c:	6a 54                	push   $0x54
+  80035e:	68 15 47 80 00       	push   $0x804715
+  800363:	e8 63 2e 00 00       	call   8031cb <_panic>
+
+00800368 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800368:	55                   	push   %ebp
+  800369:	89 e5                	mov    %esp,%ebp
+  80036b:	57                   	push   %edi
+  80036c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80036d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800372:	8b 55 08             	mov    0x8(%ebp),%edx
+  800375:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800378:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80037d:	89 df                	mov    %ebx,%edi
+  80037f:	6a 00                	push   $0x0
+  800381:	55                   	push   %ebp
+  800382:	56                   	push   %esi
+  800383:	89 e5                	mov    %esp,%ebp
+  800385:	8d 35 8d 03 80 00    	lea    0x80038d,%esi
+  80038b:	0f 34                	sysenter
+
+0080038d <after_sysenter_label_1016>:
+  80038d:	5e                   	pop    %esi
+  80038e:	5d                   	pop    %ebp
+  80038f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800392:	85 c0                	test   %eax,%eax
+  800394:	7f 07                	jg     80039d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800399:	5b                   	pop    %ebx
+  80039a:	5f                   	pop    %edi
+  80039b:	5d                   	pop    %ebp
+  80039c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80039d:	83 ec 0c             	sub    $0xc,%esp
+  8003a0:	50                   	push   %eax
+  8003a1:	6a 0a                	push   $0xa
+  8003a3:	68 f8 46 80 00       	push   $0x8046f8
+  8003a8:	6a 54                	push   $0x54
+  8003aa:	68 15 47 80 00       	push   $0x804715
+  8003af:	e8 17 2e 00 00       	call   8031cb <_panic>
+
+008003b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	57                   	push   %edi
+  8003b8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003ca:	6a 00                	push   $0x0
+  8003cc:	55                   	push   %ebp
+  8003cd:	56                   	push   %esi
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	8d 35 d8 03 80 00    	lea    0x8003d8,%esi
+  8003d6:	0f 34                	sysenter
+
+008003d8 <after_sysenter_label_1126>:
+  8003d8:	5e                   	pop    %esi
+  8003d9:	5d                   	pop    %ebp
+  8003da:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003dd:	5b                   	pop    %ebx
+  8003de:	5f                   	pop    %edi
+  8003df:	5d                   	pop    %ebp
+  8003e0:	c3                   	ret
+
+008003e1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003e1:	55                   	push   %ebp
+  8003e2:	89 e5                	mov    %esp,%ebp
+  8003e4:	57                   	push   %edi
+  8003e5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ee:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003f3:	89 cb                	mov    %ecx,%ebx
+  8003f5:	89 cf                	mov    %ecx,%edi
+  8003f7:	6a 00                	push   $0x0
+  8003f9:	55                   	push   %ebp
+  8003fa:	56                   	push   %esi
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	8d 35 05 04 80 00    	lea    0x800405,%esi
+  800403:	0f 34                	sysenter
+
+00800405 <after_sysenter_label_1210>:
+  800405:	5e                   	pop    %esi
+  800406:	5d                   	pop    %ebp
+  800407:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80040a:	85 c0                	test   %eax,%eax
+  80040c:	7f 07                	jg     800415 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80040e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800411:	5b                   	pop    %ebx
+  800412:	5f                   	pop    %edi
+  800413:	5d                   	pop    %ebp
+  800414:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800415:	83 ec 0c             	sub    $0xc,%esp
+  800418:	50                   	push   %eax
+  800419:	6a 0d                	push   $0xd
+  80041b:	68 f8 46 80 00       	push   $0x8046f8
+  800420:	6a 54                	push   $0x54
+  800422:	68 15 47 80 00       	push   $0x804715
+  800427:	e8 9f 2d 00 00       	call   8031cb <_panic>
+
+0080042c <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	57                   	push   %edi
+  800430:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800436:	8b 55 08             	mov    0x8(%ebp),%edx
+  800439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043c:	b8 42 00 00 00       	mov    $0x42,%eax
+  800441:	89 df                	mov    %ebx,%edi
+  800443:	6a 00                	push   $0x0
+  800445:	55                   	push   %ebp
+  800446:	56                   	push   %esi
+  800447:	89 e5                	mov    %esp,%ebp
+  800449:	8d 35 51 04 80 00    	lea    0x800451,%esi
+  80044f:	0f 34                	sysenter
+
+00800451 <after_sysenter_label_1311>:
+  800451:	5e                   	pop    %esi
+  800452:	5d                   	pop    %ebp
+  800453:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800456:	85 c0                	test   %eax,%eax
+  800458:	7f 07                	jg     800461 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80045a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80045d:	5b                   	pop    %ebx
+  80045e:	5f                   	pop    %edi
+  80045f:	5d                   	pop    %ebp
+  800460:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800461:	83 ec 0c             	sub    $0xc,%esp
+  800464:	50                   	push   %eax
+  800465:	6a 42                	push   $0x42
+  800467:	68 f8 46 80 00       	push   $0x8046f8
+  80046c:	6a 54                	push   $0x54
+  80046e:	68 15 47 80 00       	push   $0x804715
+  800473:	e8 53 2d 00 00       	call   8031cb <_panic>
+
+00800478 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	57                   	push   %edi
+  80047c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80047d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800482:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800487:	89 d1                	mov    %edx,%ecx
+  800489:	89 d3                	mov    %edx,%ebx
+  80048b:	89 d7                	mov    %edx,%edi
+  80048d:	6a 00                	push   $0x0
+  80048f:	55                   	push   %ebp
+  800490:	56                   	push   %esi
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	8d 35 9b 04 80 00    	lea    0x80049b,%esi
+  800499:	0f 34                	sysenter
+
+0080049b <after_sysenter_label_1411>:
+  80049b:	5e                   	pop    %esi
+  80049c:	5d                   	pop    %ebp
+  80049d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004a0:	5b                   	pop    %ebx
+  8004a1:	5f                   	pop    %edi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	57                   	push   %edi
+  8004a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004b9:	89 df                	mov    %ebx,%edi
+  8004bb:	6a 00                	push   $0x0
+  8004bd:	55                   	push   %ebp
+  8004be:	56                   	push   %esi
+  8004bf:	89 e5                	mov    %esp,%ebp
+  8004c1:	8d 35 c9 04 80 00    	lea    0x8004c9,%esi
+  8004c7:	0f 34                	sysenter
+
+008004c9 <after_sysenter_label_1497>:
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5d                   	pop    %ebp
+  8004cb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004ce:	5b                   	pop    %ebx
+  8004cf:	5f                   	pop    %edi
+  8004d0:	5d                   	pop    %ebp
+  8004d1:	c3                   	ret
+
+008004d2 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004d2:	55                   	push   %ebp
+  8004d3:	89 e5                	mov    %esp,%ebp
+  8004d5:	57                   	push   %edi
+  8004d6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004e7:	89 df                	mov    %ebx,%edi
+  8004e9:	6a 00                	push   $0x0
+  8004eb:	55                   	push   %ebp
+  8004ec:	56                   	push   %esi
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	8d 35 f7 04 80 00    	lea    0x8004f7,%esi
+  8004f5:	0f 34                	sysenter
+
+008004f7 <after_sysenter_label_1583>:
+  8004f7:	5e                   	pop    %esi
+  8004f8:	5d                   	pop    %ebp
+  8004f9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004fc:	5b                   	pop    %ebx
+  8004fd:	5f                   	pop    %edi
+  8004fe:	5d                   	pop    %ebp
+  8004ff:	c3                   	ret
+
+00800500 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800500:	55                   	push   %ebp
+  800501:	89 e5                	mov    %esp,%ebp
+  800503:	57                   	push   %edi
+  800504:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800505:	8b 55 08             	mov    0x8(%ebp),%edx
+  800508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800510:	bf 00 00 00 00       	mov    $0x0,%edi
+  800515:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800518:	6a 00                	push   $0x0
+  80051a:	55                   	push   %ebp
+  80051b:	56                   	push   %esi
+  80051c:	89 e5                	mov    %esp,%ebp
+  80051e:	8d 35 26 05 80 00    	lea    0x800526,%esi
+  800524:	0f 34                	sysenter
+
+00800526 <after_sysenter_label_1672>:
+  800526:	5e                   	pop    %esi
+  800527:	5d                   	pop    %ebp
+  800528:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80052b:	5b                   	pop    %ebx
+  80052c:	5f                   	pop    %edi
+  80052d:	5d                   	pop    %ebp
+  80052e:	c3                   	ret
+
+0080052f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80052f:	55                   	push   %ebp
+  800530:	89 e5                	mov    %esp,%ebp
+  800532:	57                   	push   %edi
+  800533:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800534:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800544:	89 df                	mov    %ebx,%edi
+  800546:	6a 00                	push   $0x0
+  800548:	55                   	push   %ebp
+  800549:	56                   	push   %esi
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	8d 35 54 05 80 00    	lea    0x800554,%esi
+  800552:	0f 34                	sysenter
+
+00800554 <after_sysenter_label_1758>:
+  800554:	5e                   	pop    %esi
+  800555:	5d                   	pop    %ebp
+  800556:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800559:	5b                   	pop    %ebx
+  80055a:	5f                   	pop    %edi
+  80055b:	5d                   	pop    %ebp
+  80055c:	c3                   	ret
+
+0080055d <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80055d:	55                   	push   %ebp
+  80055e:	89 e5                	mov    %esp,%ebp
+  800560:	57                   	push   %edi
+  800561:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800562:	8b 55 08             	mov    0x8(%ebp),%edx
+  800565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80056f:	89 cb                	mov    %ecx,%ebx
+  800571:	89 cf                	mov    %ecx,%edi
+  800573:	6a 00                	push   $0x0
+  800575:	55                   	push   %ebp
+  800576:	56                   	push   %esi
+  800577:	89 e5                	mov    %esp,%ebp
+  800579:	8d 35 81 05 80 00    	lea    0x800581,%esi
+  80057f:	0f 34                	sysenter
+
+00800581 <after_sysenter_label_1842>:
+  800581:	5e                   	pop    %esi
+  800582:	5d                   	pop    %ebp
+  800583:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800586:	85 c0                	test   %eax,%eax
+  800588:	7f 07                	jg     800591 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80058a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80058d:	5b                   	pop    %ebx
+  80058e:	5f                   	pop    %edi
+  80058f:	5d                   	pop    %ebp
+  800590:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800591:	83 ec 0c             	sub    $0xc,%esp
+  800594:	50                   	push   %eax
+  800595:	6a 13                	push   $0x13
+  800597:	68 f8 46 80 00       	push   $0x8046f8
+  80059c:	6a 54                	push   $0x54
+  80059e:	68 15 47 80 00       	push   $0x804715
+  8005a3:	e8 23 2c 00 00       	call   8031cb <_panic>
+
+008005a8 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	57                   	push   %edi
+  8005ac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005b7:	89 d1                	mov    %edx,%ecx
+  8005b9:	89 d3                	mov    %edx,%ebx
+  8005bb:	89 d7                	mov    %edx,%edi
+  8005bd:	6a 00                	push   $0x0
+  8005bf:	55                   	push   %ebp
+  8005c0:	56                   	push   %esi
+  8005c1:	89 e5                	mov    %esp,%ebp
+  8005c3:	8d 35 cb 05 80 00    	lea    0x8005cb,%esi
+  8005c9:	0f 34                	sysenter
+
+008005cb <after_sysenter_label_1939>:
+  8005cb:	5e                   	pop    %esi
+  8005cc:	5d                   	pop    %ebp
+  8005cd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005d0:	5b                   	pop    %ebx
+  8005d1:	5f                   	pop    %edi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	57                   	push   %edi
+  8005d8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005df:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ec:	6a 00                	push   $0x0
+  8005ee:	55                   	push   %ebp
+  8005ef:	56                   	push   %esi
+  8005f0:	89 e5                	mov    %esp,%ebp
+  8005f2:	8d 35 fa 05 80 00    	lea    0x8005fa,%esi
+  8005f8:	0f 34                	sysenter
+
+008005fa <after_sysenter_label_2028>:
+  8005fa:	5e                   	pop    %esi
+  8005fb:	5d                   	pop    %ebp
+  8005fc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005ff:	5b                   	pop    %ebx
+  800600:	5f                   	pop    %edi
+  800601:	5d                   	pop    %ebp
+  800602:	c3                   	ret
+
+00800603 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800603:	55                   	push   %ebp
+  800604:	89 e5                	mov    %esp,%ebp
+  800606:	57                   	push   %edi
+  800607:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800613:	b8 16 00 00 00       	mov    $0x16,%eax
+  800618:	89 df                	mov    %ebx,%edi
+  80061a:	6a 00                	push   $0x0
+  80061c:	55                   	push   %ebp
+  80061d:	56                   	push   %esi
+  80061e:	89 e5                	mov    %esp,%ebp
+  800620:	8d 35 28 06 80 00    	lea    0x800628,%esi
+  800626:	0f 34                	sysenter
+
+00800628 <after_sysenter_label_2114>:
+  800628:	5e                   	pop    %esi
+  800629:	5d                   	pop    %ebp
+  80062a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80062d:	5b                   	pop    %ebx
+  80062e:	5f                   	pop    %edi
+  80062f:	5d                   	pop    %ebp
+  800630:	c3                   	ret
+
+00800631 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800631:	55                   	push   %ebp
+  800632:	89 e5                	mov    %esp,%ebp
+  800634:	57                   	push   %edi
+  800635:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80063b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800641:	b8 17 00 00 00       	mov    $0x17,%eax
+  800646:	89 df                	mov    %ebx,%edi
+  800648:	6a 00                	push   $0x0
+  80064a:	55                   	push   %ebp
+  80064b:	56                   	push   %esi
+  80064c:	89 e5                	mov    %esp,%ebp
+  80064e:	8d 35 56 06 80 00    	lea    0x800656,%esi
+  800654:	0f 34                	sysenter
+
+00800656 <after_sysenter_label_2200>:
+  800656:	5e                   	pop    %esi
+  800657:	5d                   	pop    %ebp
+  800658:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80065b:	5b                   	pop    %ebx
+  80065c:	5f                   	pop    %edi
+  80065d:	5d                   	pop    %ebp
+  80065e:	c3                   	ret
+
+0080065f <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80065f:	55                   	push   %ebp
+  800660:	89 e5                	mov    %esp,%ebp
+  800662:	57                   	push   %edi
+  800663:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800669:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800674:	89 df                	mov    %ebx,%edi
+  800676:	6a 00                	push   $0x0
+  800678:	55                   	push   %ebp
+  800679:	56                   	push   %esi
+  80067a:	89 e5                	mov    %esp,%ebp
+  80067c:	8d 35 84 06 80 00    	lea    0x800684,%esi
+  800682:	0f 34                	sysenter
+
+00800684 <after_sysenter_label_2286>:
+  800684:	5e                   	pop    %esi
+  800685:	5d                   	pop    %ebp
+  800686:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800689:	5b                   	pop    %ebx
+  80068a:	5f                   	pop    %edi
+  80068b:	5d                   	pop    %ebp
+  80068c:	c3                   	ret
+
+0080068d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800690:	8b 45 08             	mov    0x8(%ebp),%eax
+  800693:	05 00 00 00 30       	add    $0x30000000,%eax
+  800698:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+
+0080069d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80069d:	55                   	push   %ebp
+  80069e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8006a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8006ad:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006b2:	5d                   	pop    %ebp
+  8006b3:	c3                   	ret
+
+008006b4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006b4:	55                   	push   %ebp
+  8006b5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006b7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006bc:	eb 02                	jmp    8006c0 <fd_alloc+0xc>
+  8006be:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006c0:	89 c2                	mov    %eax,%edx
+  8006c2:	c1 ea 16             	shr    $0x16,%edx
+  8006c5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006cc:	f6 c2 01             	test   $0x1,%dl
+  8006cf:	74 2b                	je     8006fc <fd_alloc+0x48>
+  8006d1:	89 c2                	mov    %eax,%edx
+  8006d3:	c1 ea 0c             	shr    $0xc,%edx
+  8006d6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006dd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006e3:	f6 c1 01             	test   $0x1,%cl
+  8006e6:	74 14                	je     8006fc <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006e8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006ee:	75 ce                	jne    8006be <fd_alloc+0xa>
+  8006f0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006f5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006fa:	eb 05                	jmp    800701 <fd_alloc+0x4d>
+			return 0;
+  8006fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800701:	8b 55 08             	mov    0x8(%ebp),%edx
+  800704:	89 02                	mov    %eax,(%edx)
+}
+  800706:	89 c8                	mov    %ecx,%eax
+  800708:	5d                   	pop    %ebp
+  800709:	c3                   	ret
+
+0080070a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800710:	83 f8 1f             	cmp    $0x1f,%eax
+  800713:	77 30                	ja     800745 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800715:	c1 e0 0c             	shl    $0xc,%eax
+  800718:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80071d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800723:	f6 c2 01             	test   $0x1,%dl
+  800726:	74 24                	je     80074c <fd_lookup+0x42>
+  800728:	89 c2                	mov    %eax,%edx
+  80072a:	c1 ea 0c             	shr    $0xc,%edx
+  80072d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800734:	f6 c2 01             	test   $0x1,%dl
+  800737:	74 1a                	je     800753 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800739:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80073e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800743:	5d                   	pop    %ebp
+  800744:	c3                   	ret
+		return -E_INVAL;
+  800745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074a:	eb f7                	jmp    800743 <fd_lookup+0x39>
+		return -E_INVAL;
+  80074c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800751:	eb f0                	jmp    800743 <fd_lookup+0x39>
+  800753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800758:	eb e9                	jmp    800743 <fd_lookup+0x39>
+
+0080075a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80075a:	55                   	push   %ebp
+  80075b:	89 e5                	mov    %esp,%ebp
+  80075d:	53                   	push   %ebx
+  80075e:	83 ec 04             	sub    $0x4,%esp
+  800761:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	eb 03                	jmp    80076e <dev_lookup+0x14>
+  80076b:	83 c0 01             	add    $0x1,%eax
+  80076e:	8b 1c 85 a0 47 80 00 	mov    0x8047a0(,%eax,4),%ebx
+  800775:	85 db                	test   %ebx,%ebx
+  800777:	74 0b                	je     800784 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800779:	39 13                	cmp    %edx,(%ebx)
+  80077b:	75 ee                	jne    80076b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80077d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800782:	eb 49                	jmp    8007cd <dev_lookup+0x73>
+  800784:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800786:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80078c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800791:	77 18                	ja     8007ab <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800793:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800798:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80079a:	c1 e8 10             	shr    $0x10,%eax
+  80079d:	74 0c                	je     8007ab <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80079f:	c1 e0 10             	shl    $0x10,%eax
+  8007a2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8007a7:	29 c1                	sub    %eax,%ecx
+  8007a9:	eb 06                	jmp    8007b1 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8007ab:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007b1:	8b 01                	mov    (%ecx),%eax
+  8007b3:	8b 40 48             	mov    0x48(%eax),%eax
+  8007b6:	83 ec 04             	sub    $0x4,%esp
+  8007b9:	52                   	push   %edx
+  8007ba:	50                   	push   %eax
+  8007bb:	68 24 47 80 00       	push   $0x804724
+  8007c0:	e8 e1 2a 00 00       	call   8032a6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d0:	89 1a                	mov    %ebx,(%edx)
+}
+  8007d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d5:	c9                   	leave
+  8007d6:	c3                   	ret
+
+008007d7 <fd_close>:
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	57                   	push   %edi
+  8007db:	56                   	push   %esi
+  8007dc:	53                   	push   %ebx
+  8007dd:	83 ec 24             	sub    $0x24,%esp
+  8007e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007e6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007e9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007ea:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007f0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007f3:	50                   	push   %eax
+  8007f4:	e8 11 ff ff ff       	call   80070a <fd_lookup>
+  8007f9:	89 c3                	mov    %eax,%ebx
+  8007fb:	83 c4 10             	add    $0x10,%esp
+  8007fe:	85 c0                	test   %eax,%eax
+  800800:	78 05                	js     800807 <fd_close+0x30>
+	    || fd != fd2)
+  800802:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800805:	74 16                	je     80081d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800807:	89 f8                	mov    %edi,%eax
+  800809:	84 c0                	test   %al,%al
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800813:	89 d8                	mov    %ebx,%eax
+  800815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800818:	5b                   	pop    %ebx
+  800819:	5e                   	pop    %esi
+  80081a:	5f                   	pop    %edi
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80081d:	83 ec 08             	sub    $0x8,%esp
+  800820:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800823:	50                   	push   %eax
+  800824:	ff 36                	push   (%esi)
+  800826:	e8 2f ff ff ff       	call   80075a <dev_lookup>
+  80082b:	89 c3                	mov    %eax,%ebx
+  80082d:	83 c4 10             	add    $0x10,%esp
+  800830:	85 c0                	test   %eax,%eax
+  800832:	78 1a                	js     80084e <fd_close+0x77>
+		if (dev->dev_close)
+  800834:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800837:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80083a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80083f:	85 c0                	test   %eax,%eax
+  800841:	74 0b                	je     80084e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800843:	83 ec 0c             	sub    $0xc,%esp
+  800846:	56                   	push   %esi
+  800847:	ff d0                	call   *%eax
+  800849:	89 c3                	mov    %eax,%ebx
+  80084b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80084e:	83 ec 08             	sub    $0x8,%esp
+  800851:	56                   	push   %esi
+  800852:	6a 00                	push   $0x0
+  800854:	e8 2b fa ff ff       	call   800284 <sys_page_unmap>
+	return r;
+  800859:	83 c4 10             	add    $0x10,%esp
+  80085c:	eb b5                	jmp    800813 <fd_close+0x3c>
+
+0080085e <close>:
+
+int
+close(int fdnum)
+{
+  80085e:	55                   	push   %ebp
+  80085f:	89 e5                	mov    %esp,%ebp
+  800861:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800864:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800867:	50                   	push   %eax
+  800868:	ff 75 08             	push   0x8(%ebp)
+  80086b:	e8 9a fe ff ff       	call   80070a <fd_lookup>
+  800870:	83 c4 10             	add    $0x10,%esp
+  800873:	85 c0                	test   %eax,%eax
+  800875:	79 02                	jns    800879 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800877:	c9                   	leave
+  800878:	c3                   	ret
+		return fd_close(fd, 1);
+  800879:	83 ec 08             	sub    $0x8,%esp
+  80087c:	6a 01                	push   $0x1
+  80087e:	ff 75 f4             	push   -0xc(%ebp)
+  800881:	e8 51 ff ff ff       	call   8007d7 <fd_close>
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	eb ec                	jmp    800877 <close+0x19>
+
+0080088b <close_all>:
+
+void
+close_all(void)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	53                   	push   %ebx
+  80088f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800892:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800897:	83 ec 0c             	sub    $0xc,%esp
+  80089a:	53                   	push   %ebx
+  80089b:	e8 be ff ff ff       	call   80085e <close>
+	for (i = 0; i < MAXFD; i++)
+  8008a0:	83 c3 01             	add    $0x1,%ebx
+  8008a3:	83 c4 10             	add    $0x10,%esp
+  8008a6:	83 fb 20             	cmp    $0x20,%ebx
+  8008a9:	75 ec                	jne    800897 <close_all+0xc>
+}
+  8008ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ae:	c9                   	leave
+  8008af:	c3                   	ret
+
+008008b0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	57                   	push   %edi
+  8008b4:	56                   	push   %esi
+  8008b5:	53                   	push   %ebx
+  8008b6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008bc:	50                   	push   %eax
+  8008bd:	ff 75 08             	push   0x8(%ebp)
+  8008c0:	e8 45 fe ff ff       	call   80070a <fd_lookup>
+  8008c5:	89 c3                	mov    %eax,%ebx
+  8008c7:	83 c4 10             	add    $0x10,%esp
+  8008ca:	85 c0                	test   %eax,%eax
+  8008cc:	78 7f                	js     80094d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008ce:	83 ec 0c             	sub    $0xc,%esp
+  8008d1:	ff 75 0c             	push   0xc(%ebp)
+  8008d4:	e8 85 ff ff ff       	call   80085e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008dc:	c1 e6 0c             	shl    $0xc,%esi
+  8008df:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008e8:	89 3c 24             	mov    %edi,(%esp)
+  8008eb:	e8 ad fd ff ff       	call   80069d <fd2data>
+  8008f0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008f2:	89 34 24             	mov    %esi,(%esp)
+  8008f5:	e8 a3 fd ff ff       	call   80069d <fd2data>
+  8008fa:	83 c4 10             	add    $0x10,%esp
+  8008fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800900:	89 d8                	mov    %ebx,%eax
+  800902:	c1 e8 16             	shr    $0x16,%eax
+  800905:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80090c:	a8 01                	test   $0x1,%al
+  80090e:	74 11                	je     800921 <dup+0x71>
+  800910:	89 d8                	mov    %ebx,%eax
+  800912:	c1 e8 0c             	shr    $0xc,%eax
+  800915:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80091c:	f6 c2 01             	test   $0x1,%dl
+  80091f:	75 36                	jne    800957 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800921:	89 f8                	mov    %edi,%eax
+  800923:	c1 e8 0c             	shr    $0xc,%eax
+  800926:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80092d:	83 ec 0c             	sub    $0xc,%esp
+  800930:	25 07 0e 00 00       	and    $0xe07,%eax
+  800935:	50                   	push   %eax
+  800936:	56                   	push   %esi
+  800937:	6a 00                	push   $0x0
+  800939:	57                   	push   %edi
+  80093a:	6a 00                	push   $0x0
+  80093c:	e8 f7 f8 ff ff       	call   800238 <sys_page_map>
+  800941:	89 c3                	mov    %eax,%ebx
+  800943:	83 c4 20             	add    $0x20,%esp
+  800946:	85 c0                	test   %eax,%eax
+  800948:	78 33                	js     80097d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80094a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80094d:	89 d8                	mov    %ebx,%eax
+  80094f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800952:	5b                   	pop    %ebx
+  800953:	5e                   	pop    %esi
+  800954:	5f                   	pop    %edi
+  800955:	5d                   	pop    %ebp
+  800956:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800957:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80095e:	83 ec 0c             	sub    $0xc,%esp
+  800961:	25 07 0e 00 00       	and    $0xe07,%eax
+  800966:	50                   	push   %eax
+  800967:	ff 75 d4             	push   -0x2c(%ebp)
+  80096a:	6a 00                	push   $0x0
+  80096c:	53                   	push   %ebx
+  80096d:	6a 00                	push   $0x0
+  80096f:	e8 c4 f8 ff ff       	call   800238 <sys_page_map>
+  800974:	89 c3                	mov    %eax,%ebx
+  800976:	83 c4 20             	add    $0x20,%esp
+  800979:	85 c0                	test   %eax,%eax
+  80097b:	79 a4                	jns    800921 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80097d:	83 ec 08             	sub    $0x8,%esp
+  800980:	56                   	push   %esi
+  800981:	6a 00                	push   $0x0
+  800983:	e8 fc f8 ff ff       	call   800284 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800988:	83 c4 08             	add    $0x8,%esp
+  80098b:	ff 75 d4             	push   -0x2c(%ebp)
+  80098e:	6a 00                	push   $0x0
+  800990:	e8 ef f8 ff ff       	call   800284 <sys_page_unmap>
+	return r;
+  800995:	83 c4 10             	add    $0x10,%esp
+  800998:	eb b3                	jmp    80094d <dup+0x9d>
+
+0080099a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	56                   	push   %esi
+  80099e:	53                   	push   %ebx
+  80099f:	83 ec 18             	sub    $0x18,%esp
+  8009a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009a8:	50                   	push   %eax
+  8009a9:	53                   	push   %ebx
+  8009aa:	e8 5b fd ff ff       	call   80070a <fd_lookup>
+  8009af:	83 c4 10             	add    $0x10,%esp
+  8009b2:	85 c0                	test   %eax,%eax
+  8009b4:	78 3c                	js     8009f2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009b6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009b9:	83 ec 08             	sub    $0x8,%esp
+  8009bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009bf:	50                   	push   %eax
+  8009c0:	ff 36                	push   (%esi)
+  8009c2:	e8 93 fd ff ff       	call   80075a <dev_lookup>
+  8009c7:	83 c4 10             	add    $0x10,%esp
+  8009ca:	85 c0                	test   %eax,%eax
+  8009cc:	78 24                	js     8009f2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009ce:	8b 46 08             	mov    0x8(%esi),%eax
+  8009d1:	83 e0 03             	and    $0x3,%eax
+  8009d4:	83 f8 01             	cmp    $0x1,%eax
+  8009d7:	74 20                	je     8009f9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009dc:	8b 40 08             	mov    0x8(%eax),%eax
+  8009df:	85 c0                	test   %eax,%eax
+  8009e1:	74 61                	je     800a44 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009e3:	83 ec 04             	sub    $0x4,%esp
+  8009e6:	ff 75 10             	push   0x10(%ebp)
+  8009e9:	ff 75 0c             	push   0xc(%ebp)
+  8009ec:	56                   	push   %esi
+  8009ed:	ff d0                	call   *%eax
+  8009ef:	83 c4 10             	add    $0x10,%esp
+}
+  8009f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009f5:	5b                   	pop    %ebx
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+  8009f9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009fb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800a01:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800a06:	77 18                	ja     800a20 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800a08:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800a0d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800a0f:	c1 e8 10             	shr    $0x10,%eax
+  800a12:	74 0c                	je     800a20 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a14:	c1 e0 10             	shl    $0x10,%eax
+  800a17:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a1c:	29 c2                	sub    %eax,%edx
+  800a1e:	eb 06                	jmp    800a26 <read+0x8c>
+		return pthread_main_tls;
+  800a20:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a26:	8b 02                	mov    (%edx),%eax
+  800a28:	8b 40 48             	mov    0x48(%eax),%eax
+  800a2b:	83 ec 04             	sub    $0x4,%esp
+  800a2e:	53                   	push   %ebx
+  800a2f:	50                   	push   %eax
+  800a30:	68 65 47 80 00       	push   $0x804765
+  800a35:	e8 6c 28 00 00       	call   8032a6 <cprintf>
+		return -E_INVAL;
+  800a3a:	83 c4 10             	add    $0x10,%esp
+  800a3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a42:	eb ae                	jmp    8009f2 <read+0x58>
+		return -E_NOT_SUPP;
+  800a44:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a49:	eb a7                	jmp    8009f2 <read+0x58>
+
+00800a4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	57                   	push   %edi
+  800a4f:	56                   	push   %esi
+  800a50:	53                   	push   %ebx
+  800a51:	83 ec 0c             	sub    $0xc,%esp
+  800a54:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a57:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a5f:	eb 02                	jmp    800a63 <readn+0x18>
+  800a61:	01 c3                	add    %eax,%ebx
+  800a63:	39 f3                	cmp    %esi,%ebx
+  800a65:	73 21                	jae    800a88 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a67:	83 ec 04             	sub    $0x4,%esp
+  800a6a:	89 f0                	mov    %esi,%eax
+  800a6c:	29 d8                	sub    %ebx,%eax
+  800a6e:	50                   	push   %eax
+  800a6f:	89 d8                	mov    %ebx,%eax
+  800a71:	03 45 0c             	add    0xc(%ebp),%eax
+  800a74:	50                   	push   %eax
+  800a75:	57                   	push   %edi
+  800a76:	e8 1f ff ff ff       	call   80099a <read>
+		if (m < 0)
+  800a7b:	83 c4 10             	add    $0x10,%esp
+  800a7e:	85 c0                	test   %eax,%eax
+  800a80:	78 04                	js     800a86 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a82:	75 dd                	jne    800a61 <readn+0x16>
+  800a84:	eb 02                	jmp    800a88 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a86:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a88:	89 d8                	mov    %ebx,%eax
+  800a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a8d:	5b                   	pop    %ebx
+  800a8e:	5e                   	pop    %esi
+  800a8f:	5f                   	pop    %edi
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	56                   	push   %esi
+  800a96:	53                   	push   %ebx
+  800a97:	83 ec 18             	sub    $0x18,%esp
+  800a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800aa0:	50                   	push   %eax
+  800aa1:	53                   	push   %ebx
+  800aa2:	e8 63 fc ff ff       	call   80070a <fd_lookup>
+  800aa7:	83 c4 10             	add    $0x10,%esp
+  800aaa:	85 c0                	test   %eax,%eax
+  800aac:	78 37                	js     800ae5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ab1:	83 ec 08             	sub    $0x8,%esp
+  800ab4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ab7:	50                   	push   %eax
+  800ab8:	ff 36                	push   (%esi)
+  800aba:	e8 9b fc ff ff       	call   80075a <dev_lookup>
+  800abf:	83 c4 10             	add    $0x10,%esp
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	78 1f                	js     800ae5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ac6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aca:	74 20                	je     800aec <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800acf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ad2:	85 c0                	test   %eax,%eax
+  800ad4:	74 61                	je     800b37 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ad6:	83 ec 04             	sub    $0x4,%esp
+  800ad9:	ff 75 10             	push   0x10(%ebp)
+  800adc:	ff 75 0c             	push   0xc(%ebp)
+  800adf:	56                   	push   %esi
+  800ae0:	ff d0                	call   *%eax
+  800ae2:	83 c4 10             	add    $0x10,%esp
+}
+  800ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ae8:	5b                   	pop    %ebx
+  800ae9:	5e                   	pop    %esi
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+  800aec:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800aee:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800af4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800af9:	77 18                	ja     800b13 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800afb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800b00:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800b02:	c1 e8 10             	shr    $0x10,%eax
+  800b05:	74 0c                	je     800b13 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800b07:	c1 e0 10             	shl    $0x10,%eax
+  800b0a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800b0f:	29 c2                	sub    %eax,%edx
+  800b11:	eb 06                	jmp    800b19 <write+0x87>
+		return pthread_main_tls;
+  800b13:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b19:	8b 02                	mov    (%edx),%eax
+  800b1b:	8b 40 48             	mov    0x48(%eax),%eax
+  800b1e:	83 ec 04             	sub    $0x4,%esp
+  800b21:	53                   	push   %ebx
+  800b22:	50                   	push   %eax
+  800b23:	68 81 47 80 00       	push   $0x804781
+  800b28:	e8 79 27 00 00       	call   8032a6 <cprintf>
+		return -E_INVAL;
+  800b2d:	83 c4 10             	add    $0x10,%esp
+  800b30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b35:	eb ae                	jmp    800ae5 <write+0x53>
+		return -E_NOT_SUPP;
+  800b37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b3c:	eb a7                	jmp    800ae5 <write+0x53>
+
+00800b3e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b47:	50                   	push   %eax
+  800b48:	ff 75 08             	push   0x8(%ebp)
+  800b4b:	e8 ba fb ff ff       	call   80070a <fd_lookup>
+  800b50:	83 c4 10             	add    $0x10,%esp
+  800b53:	85 c0                	test   %eax,%eax
+  800b55:	78 0e                	js     800b65 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b65:	c9                   	leave
+  800b66:	c3                   	ret
+
+00800b67 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	56                   	push   %esi
+  800b6b:	53                   	push   %ebx
+  800b6c:	83 ec 18             	sub    $0x18,%esp
+  800b6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b75:	50                   	push   %eax
+  800b76:	53                   	push   %ebx
+  800b77:	e8 8e fb ff ff       	call   80070a <fd_lookup>
+  800b7c:	83 c4 10             	add    $0x10,%esp
+  800b7f:	85 c0                	test   %eax,%eax
+  800b81:	78 34                	js     800bb7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b83:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b86:	83 ec 08             	sub    $0x8,%esp
+  800b89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b8c:	50                   	push   %eax
+  800b8d:	ff 36                	push   (%esi)
+  800b8f:	e8 c6 fb ff ff       	call   80075a <dev_lookup>
+  800b94:	83 c4 10             	add    $0x10,%esp
+  800b97:	85 c0                	test   %eax,%eax
+  800b99:	78 1c                	js     800bb7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b9b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b9f:	74 1d                	je     800bbe <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800ba1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba4:	8b 40 18             	mov    0x18(%eax),%eax
+  800ba7:	85 c0                	test   %eax,%eax
+  800ba9:	74 5e                	je     800c09 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bab:	83 ec 08             	sub    $0x8,%esp
+  800bae:	ff 75 0c             	push   0xc(%ebp)
+  800bb1:	56                   	push   %esi
+  800bb2:	ff d0                	call   *%eax
+  800bb4:	83 c4 10             	add    $0x10,%esp
+}
+  800bb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bba:	5b                   	pop    %ebx
+  800bbb:	5e                   	pop    %esi
+  800bbc:	5d                   	pop    %ebp
+  800bbd:	c3                   	ret
+  800bbe:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bc0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bc6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bcb:	77 18                	ja     800be5 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bcd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bd2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bd4:	c1 e8 10             	shr    $0x10,%eax
+  800bd7:	74 0c                	je     800be5 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bd9:	c1 e0 10             	shl    $0x10,%eax
+  800bdc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800be1:	29 c2                	sub    %eax,%edx
+  800be3:	eb 06                	jmp    800beb <ftruncate+0x84>
+		return pthread_main_tls;
+  800be5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800beb:	8b 02                	mov    (%edx),%eax
+  800bed:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bf0:	83 ec 04             	sub    $0x4,%esp
+  800bf3:	53                   	push   %ebx
+  800bf4:	50                   	push   %eax
+  800bf5:	68 44 47 80 00       	push   $0x804744
+  800bfa:	e8 a7 26 00 00       	call   8032a6 <cprintf>
+		return -E_INVAL;
+  800bff:	83 c4 10             	add    $0x10,%esp
+  800c02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c07:	eb ae                	jmp    800bb7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c09:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c0e:	eb a7                	jmp    800bb7 <ftruncate+0x50>
+
+00800c10 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	56                   	push   %esi
+  800c14:	53                   	push   %ebx
+  800c15:	83 ec 18             	sub    $0x18,%esp
+  800c18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c1b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c1e:	50                   	push   %eax
+  800c1f:	ff 75 08             	push   0x8(%ebp)
+  800c22:	e8 e3 fa ff ff       	call   80070a <fd_lookup>
+  800c27:	83 c4 10             	add    $0x10,%esp
+  800c2a:	85 c0                	test   %eax,%eax
+  800c2c:	78 49                	js     800c77 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c2e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c31:	83 ec 08             	sub    $0x8,%esp
+  800c34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c37:	50                   	push   %eax
+  800c38:	ff 36                	push   (%esi)
+  800c3a:	e8 1b fb ff ff       	call   80075a <dev_lookup>
+  800c3f:	83 c4 10             	add    $0x10,%esp
+  800c42:	85 c0                	test   %eax,%eax
+  800c44:	78 31                	js     800c77 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c49:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c4d:	74 2f                	je     800c7e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c4f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c52:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c59:	00 00 00 
+	stat->st_isdir = 0;
+  800c5c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c63:	00 00 00 
+	stat->st_dev = dev;
+  800c66:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+  800c6f:	53                   	push   %ebx
+  800c70:	56                   	push   %esi
+  800c71:	ff 50 14             	call   *0x14(%eax)
+  800c74:	83 c4 10             	add    $0x10,%esp
+}
+  800c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7a:	5b                   	pop    %ebx
+  800c7b:	5e                   	pop    %esi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c83:	eb f2                	jmp    800c77 <fstat+0x67>
+
+00800c85 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	56                   	push   %esi
+  800c89:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c8a:	83 ec 08             	sub    $0x8,%esp
+  800c8d:	6a 00                	push   $0x0
+  800c8f:	ff 75 08             	push   0x8(%ebp)
+  800c92:	e8 4b 03 00 00       	call   800fe2 <open>
+  800c97:	89 c3                	mov    %eax,%ebx
+  800c99:	83 c4 10             	add    $0x10,%esp
+  800c9c:	85 c0                	test   %eax,%eax
+  800c9e:	78 1b                	js     800cbb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800ca0:	83 ec 08             	sub    $0x8,%esp
+  800ca3:	ff 75 0c             	push   0xc(%ebp)
+  800ca6:	50                   	push   %eax
+  800ca7:	e8 64 ff ff ff       	call   800c10 <fstat>
+  800cac:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cae:	89 1c 24             	mov    %ebx,(%esp)
+  800cb1:	e8 a8 fb ff ff       	call   80085e <close>
+	return r;
+  800cb6:	83 c4 10             	add    $0x10,%esp
+  800cb9:	89 f3                	mov    %esi,%ebx
+}
+  800cbb:	89 d8                	mov    %ebx,%eax
+  800cbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	56                   	push   %esi
+  800cc8:	53                   	push   %ebx
+  800cc9:	89 c6                	mov    %eax,%esi
+  800ccb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ccd:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cd4:	74 27                	je     800cfd <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd6:	6a 07                	push   $0x7
+  800cd8:	68 00 70 80 00       	push   $0x807000
+  800cdd:	56                   	push   %esi
+  800cde:	ff 35 00 60 80 00    	push   0x806000
+  800ce4:	e8 51 36 00 00       	call   80433a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800ce9:	83 c4 0c             	add    $0xc,%esp
+  800cec:	6a 00                	push   $0x0
+  800cee:	53                   	push   %ebx
+  800cef:	6a 00                	push   $0x0
+  800cf1:	e8 4e 35 00 00       	call   804244 <ipc_recv>
+}
+  800cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf9:	5b                   	pop    %ebx
+  800cfa:	5e                   	pop    %esi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cfd:	83 ec 0c             	sub    $0xc,%esp
+  800d00:	6a 01                	push   $0x1
+  800d02:	e8 89 36 00 00       	call   804390 <ipc_find_env>
+  800d07:	a3 00 60 80 00       	mov    %eax,0x806000
+  800d0c:	83 c4 10             	add    $0x10,%esp
+  800d0f:	eb c5                	jmp    800cd6 <fsipc+0x12>
+
+00800d11 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	53                   	push   %ebx
+  800d15:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d18:	68 04 60 80 00       	push   $0x806004
+  800d1d:	e8 29 1b 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d25:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d28:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d30:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3f:	e8 80 ff ff ff       	call   800cc4 <fsipc>
+  800d44:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d46:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d4d:	e8 66 1b 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+}
+  800d52:	89 d8                	mov    %ebx,%eax
+  800d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+00800d59 <devfile_flush>:
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	53                   	push   %ebx
+  800d5d:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d60:	68 04 60 80 00       	push   $0x806004
+  800d65:	e8 e1 1a 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d70:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d7f:	e8 40 ff ff ff       	call   800cc4 <fsipc>
+  800d84:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d86:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d8d:	e8 26 1b 00 00       	call   8028b8 <mutex_unlock>
+}
+  800d92:	89 d8                	mov    %ebx,%eax
+  800d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d97:	c9                   	leave
+  800d98:	c3                   	ret
+
+00800d99 <devfile_stat>:
+{
+  800d99:	55                   	push   %ebp
+  800d9a:	89 e5                	mov    %esp,%ebp
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  800d9e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800da1:	83 ec 0c             	sub    $0xc,%esp
+  800da4:	68 04 60 80 00       	push   $0x806004
+  800da9:	e8 9d 1a 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc3:	e8 fc fe ff ff       	call   800cc4 <fsipc>
+  800dc8:	89 c3                	mov    %eax,%ebx
+  800dca:	83 c4 10             	add    $0x10,%esp
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	79 16                	jns    800de7 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dd1:	83 ec 0c             	sub    $0xc,%esp
+  800dd4:	68 04 60 80 00       	push   $0x806004
+  800dd9:	e8 da 1a 00 00       	call   8028b8 <mutex_unlock>
+}
+  800dde:	89 d8                	mov    %ebx,%eax
+  800de0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800de7:	83 ec 08             	sub    $0x8,%esp
+  800dea:	68 00 70 80 00       	push   $0x807000
+  800def:	56                   	push   %esi
+  800df0:	e8 95 2a 00 00       	call   80388a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800df5:	a1 80 70 80 00       	mov    0x807080,%eax
+  800dfa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800e00:	a1 84 70 80 00       	mov    0x807084,%eax
+  800e05:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800e0b:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800e0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e13:	eb bc                	jmp    800dd1 <devfile_stat+0x38>
+
+00800e15 <devfile_write>:
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 10             	sub    $0x10,%esp
+  800e1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e1f:	68 04 60 80 00       	push   $0x806004
+  800e24:	e8 22 1a 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e2f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e34:	83 c4 10             	add    $0x10,%esp
+  800e37:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e3d:	76 3d                	jbe    800e7c <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e3f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e44:	39 c3                	cmp    %eax,%ebx
+  800e46:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e4c:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e51:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e61:	e8 5e fe ff ff       	call   800cc4 <fsipc>
+  800e66:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+  800e6b:	68 04 60 80 00       	push   $0x806004
+  800e70:	e8 43 1a 00 00       	call   8028b8 <mutex_unlock>
+}
+  800e75:	89 d8                	mov    %ebx,%eax
+  800e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e7a:	c9                   	leave
+  800e7b:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e7c:	83 ec 04             	sub    $0x4,%esp
+  800e7f:	53                   	push   %ebx
+  800e80:	ff 75 0c             	push   0xc(%ebp)
+  800e83:	68 0c 70 80 00       	push   $0x80700c
+  800e88:	e8 83 2b 00 00       	call   803a10 <memmove>
+  800e8d:	83 c4 10             	add    $0x10,%esp
+  800e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e95:	eb b5                	jmp    800e4c <devfile_write+0x37>
+
+00800e97 <devfile_read>:
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  800ea0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800ea9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800eaf:	0f 86 8c 00 00 00    	jbe    800f41 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800eb5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800eba:	39 c3                	cmp    %eax,%ebx
+  800ebc:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ebf:	89 f8                	mov    %edi,%eax
+  800ec1:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800ec4:	eb 0f                	jmp    800ed5 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800ec6:	0f b6 08             	movzbl (%eax),%ecx
+  800ec9:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ecb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ed0:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ed5:	39 d0                	cmp    %edx,%eax
+  800ed7:	72 ed                	jb     800ec6 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ed9:	83 ec 0c             	sub    $0xc,%esp
+  800edc:	68 04 60 80 00       	push   $0x806004
+  800ee1:	e8 65 19 00 00       	call   80284b <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ee6:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ee9:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800eee:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800ef4:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f04:	e8 bb fd ff ff       	call   800cc4 <fsipc>
+  800f09:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800f0b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f12:	e8 a1 19 00 00       	call   8028b8 <mutex_unlock>
+		assert(r <= (int) n);
+  800f17:	83 c4 10             	add    $0x10,%esp
+  800f1a:	39 f3                	cmp    %esi,%ebx
+  800f1c:	7c 0a                	jl     800f28 <devfile_read+0x91>
+}
+  800f1e:	89 f0                	mov    %esi,%eax
+  800f20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+		assert(r <= (int) n);
+  800f28:	68 b4 47 80 00       	push   $0x8047b4
+  800f2d:	68 c1 47 80 00       	push   $0x8047c1
+  800f32:	68 90 00 00 00       	push   $0x90
+  800f37:	68 d6 47 80 00       	push   $0x8047d6
+  800f3c:	e8 8a 22 00 00       	call   8031cb <_panic>
+	mutex_lock(&fsipc_mu);
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+  800f44:	68 04 60 80 00       	push   $0x806004
+  800f49:	e8 fd 18 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f4e:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f51:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f56:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f5c:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f63:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f70:	e8 4f fd ff ff       	call   800cc4 <fsipc>
+  800f75:	89 c6                	mov    %eax,%esi
+  800f77:	83 c4 10             	add    $0x10,%esp
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	78 1d                	js     800f9b <devfile_read+0x104>
+		assert(r <= n);
+  800f7e:	39 c3                	cmp    %eax,%ebx
+  800f80:	72 2e                	jb     800fb0 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f82:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f87:	7f 40                	jg     800fc9 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f89:	83 ec 04             	sub    $0x4,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	68 00 70 80 00       	push   $0x807000
+  800f92:	57                   	push   %edi
+  800f93:	e8 78 2a 00 00       	call   803a10 <memmove>
+  800f98:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	68 04 60 80 00       	push   $0x806004
+  800fa3:	e8 10 19 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+  800fa8:	83 c4 10             	add    $0x10,%esp
+  800fab:	e9 6e ff ff ff       	jmp    800f1e <devfile_read+0x87>
+		assert(r <= n);
+  800fb0:	68 e1 47 80 00       	push   $0x8047e1
+  800fb5:	68 c1 47 80 00       	push   $0x8047c1
+  800fba:	68 99 00 00 00       	push   $0x99
+  800fbf:	68 d6 47 80 00       	push   $0x8047d6
+  800fc4:	e8 02 22 00 00       	call   8031cb <_panic>
+		assert(r <= PGSIZE);
+  800fc9:	68 e8 47 80 00       	push   $0x8047e8
+  800fce:	68 c1 47 80 00       	push   $0x8047c1
+  800fd3:	68 9a 00 00 00       	push   $0x9a
+  800fd8:	68 d6 47 80 00       	push   $0x8047d6
+  800fdd:	e8 e9 21 00 00       	call   8031cb <_panic>
+
+00800fe2 <open>:
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  800fe7:	83 ec 1c             	sub    $0x1c,%esp
+  800fea:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fed:	56                   	push   %esi
+  800fee:	e8 5c 28 00 00       	call   80384f <strlen>
+  800ff3:	83 c4 10             	add    $0x10,%esp
+  800ff6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ffb:	0f 8f 85 00 00 00    	jg     801086 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801007:	50                   	push   %eax
+  801008:	e8 a7 f6 ff ff       	call   8006b4 <fd_alloc>
+  80100d:	89 c3                	mov    %eax,%ebx
+  80100f:	83 c4 10             	add    $0x10,%esp
+  801012:	85 c0                	test   %eax,%eax
+  801014:	78 55                	js     80106b <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	68 04 60 80 00       	push   $0x806004
+  80101e:	e8 28 18 00 00       	call   80284b <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801023:	83 c4 08             	add    $0x8,%esp
+  801026:	56                   	push   %esi
+  801027:	68 00 70 80 00       	push   $0x807000
+  80102c:	e8 59 28 00 00       	call   80388a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801031:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801034:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801039:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80103c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801041:	e8 7e fc ff ff       	call   800cc4 <fsipc>
+  801046:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801048:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80104f:	e8 64 18 00 00       	call   8028b8 <mutex_unlock>
+	if (r < 0) {
+  801054:	83 c4 10             	add    $0x10,%esp
+  801057:	85 db                	test   %ebx,%ebx
+  801059:	78 19                	js     801074 <open+0x92>
+	return fd2num(fd);
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	ff 75 f4             	push   -0xc(%ebp)
+  801061:	e8 27 f6 ff ff       	call   80068d <fd2num>
+  801066:	89 c3                	mov    %eax,%ebx
+  801068:	83 c4 10             	add    $0x10,%esp
+}
+  80106b:	89 d8                	mov    %ebx,%eax
+  80106d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801070:	5b                   	pop    %ebx
+  801071:	5e                   	pop    %esi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+		fd_close(fd, 0);
+  801074:	83 ec 08             	sub    $0x8,%esp
+  801077:	6a 00                	push   $0x0
+  801079:	ff 75 f4             	push   -0xc(%ebp)
+  80107c:	e8 56 f7 ff ff       	call   8007d7 <fd_close>
+		return r;
+  801081:	83 c4 10             	add    $0x10,%esp
+  801084:	eb e5                	jmp    80106b <open+0x89>
+		return -E_BAD_PATH;
+  801086:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80108b:	eb de                	jmp    80106b <open+0x89>
+
+0080108d <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	53                   	push   %ebx
+  801091:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801094:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801097:	50                   	push   %eax
+  801098:	ff 75 08             	push   0x8(%ebp)
+  80109b:	e8 6a f6 ff ff       	call   80070a <fd_lookup>
+  8010a0:	89 c3                	mov    %eax,%ebx
+  8010a2:	83 c4 10             	add    $0x10,%esp
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	78 5b                	js     801104 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8010a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ac:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8010b2:	39 08                	cmp    %ecx,(%eax)
+  8010b4:	75 55                	jne    80110b <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010b6:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010ba:	74 56                	je     801112 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010bc:	83 ec 0c             	sub    $0xc,%esp
+  8010bf:	68 04 60 80 00       	push   $0x806004
+  8010c4:	e8 82 17 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010cf:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d7:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010df:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ee:	e8 d1 fb ff ff       	call   800cc4 <fsipc>
+  8010f3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010f5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010fc:	e8 b7 17 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+  801101:	83 c4 10             	add    $0x10,%esp
+}
+  801104:	89 d8                	mov    %ebx,%eax
+  801106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80110b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801110:	eb f2                	jmp    801104 <fallocate+0x77>
+		return -E_INVAL;
+  801112:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801117:	eb eb                	jmp    801104 <fallocate+0x77>
+
+00801119 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801121:	89 f3                	mov    %esi,%ebx
+  801123:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801129:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80112c:	eb 06                	jmp    801134 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80112e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801134:	39 f3                	cmp    %esi,%ebx
+  801136:	73 14                	jae    80114c <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801138:	83 ec 08             	sub    $0x8,%esp
+  80113b:	53                   	push   %ebx
+  80113c:	6a 00                	push   $0x0
+  80113e:	e8 41 f1 ff ff       	call   800284 <sys_page_unmap>
+  801143:	83 c4 10             	add    $0x10,%esp
+  801146:	85 c0                	test   %eax,%eax
+  801148:	79 e4                	jns    80112e <munmap+0x15>
+  80114a:	eb 05                	jmp    801151 <munmap+0x38>
+			return r;
+	return 0;
+  80114c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801151:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+
+00801158 <mmap>:
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	57                   	push   %edi
+  80115c:	56                   	push   %esi
+  80115d:	53                   	push   %ebx
+  80115e:	83 ec 24             	sub    $0x24,%esp
+  801161:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801164:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801167:	50                   	push   %eax
+  801168:	ff 75 08             	push   0x8(%ebp)
+  80116b:	e8 9a f5 ff ff       	call   80070a <fd_lookup>
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	85 c0                	test   %eax,%eax
+  801175:	0f 88 37 01 00 00    	js     8012b2 <mmap+0x15a>
+		return NULL;
+  80117b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801180:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801183:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  801189:	39 0a                	cmp    %ecx,(%edx)
+  80118b:	0f 85 05 01 00 00    	jne    801296 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801191:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801198:	0f 85 1b 01 00 00    	jne    8012b9 <mmap+0x161>
+  80119e:	89 f0                	mov    %esi,%eax
+  8011a0:	83 e8 01             	sub    $0x1,%eax
+  8011a3:	0f 88 17 01 00 00    	js     8012c0 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8011a9:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8011ad:	75 28                	jne    8011d7 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8011af:	83 ec 0c             	sub    $0xc,%esp
+  8011b2:	68 04 60 80 00       	push   $0x806004
+  8011b7:	e8 8f 16 00 00       	call   80284b <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011bc:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011c2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011c8:	83 c4 10             	add    $0x10,%esp
+  8011cb:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011d0:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011d5:	eb 2b                	jmp    801202 <mmap+0xaa>
+		cow_enable();
+  8011d7:	e8 f7 2b 00 00       	call   803dd3 <cow_enable>
+  8011dc:	eb d1                	jmp    8011af <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011de:	89 c2                	mov    %eax,%edx
+  8011e0:	c1 ea 0c             	shr    $0xc,%edx
+  8011e3:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011ea:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011f0:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011f6:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011f9:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011fb:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801200:	77 25                	ja     801227 <mmap+0xcf>
+  801202:	89 c2                	mov    %eax,%edx
+  801204:	29 da                	sub    %ebx,%edx
+  801206:	39 ca                	cmp    %ecx,%edx
+  801208:	73 3a                	jae    801244 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80120a:	89 c2                	mov    %eax,%edx
+  80120c:	c1 ea 16             	shr    $0x16,%edx
+  80120f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801216:	f6 c2 01             	test   $0x1,%dl
+  801219:	75 c3                	jne    8011de <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80121b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801220:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801225:	eb d4                	jmp    8011fb <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801227:	29 d8                	sub    %ebx,%eax
+  801229:	39 c8                	cmp    %ecx,%eax
+  80122b:	73 17                	jae    801244 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+  801230:	68 04 60 80 00       	push   $0x806004
+  801235:	e8 7e 16 00 00       	call   8028b8 <mutex_unlock>
+		return NULL;
+  80123a:	83 c4 10             	add    $0x10,%esp
+  80123d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801242:	eb 52                	jmp    801296 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801244:	85 db                	test   %ebx,%ebx
+  801246:	74 e5                	je     80122d <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801248:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80124b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80124e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801253:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801256:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  80125b:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801261:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801267:	8b 45 14             	mov    0x14(%ebp),%eax
+  80126a:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80126f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801274:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801279:	e8 46 fa ff ff       	call   800cc4 <fsipc>
+  80127e:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801280:	83 ec 0c             	sub    $0xc,%esp
+  801283:	68 04 60 80 00       	push   $0x806004
+  801288:	e8 2b 16 00 00       	call   8028b8 <mutex_unlock>
+	if (r < 0) {
+  80128d:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801290:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801292:	85 ff                	test   %edi,%edi
+  801294:	78 08                	js     80129e <mmap+0x146>
+}
+  801296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+		munmap((void*) va, len);
+  80129e:	83 ec 08             	sub    $0x8,%esp
+  8012a1:	56                   	push   %esi
+  8012a2:	53                   	push   %ebx
+  8012a3:	e8 71 fe ff ff       	call   801119 <munmap>
+		return NULL;
+  8012a8:	83 c4 10             	add    $0x10,%esp
+  8012ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b0:	eb e4                	jmp    801296 <mmap+0x13e>
+		return NULL;
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	eb dd                	jmp    801296 <mmap+0x13e>
+		return NULL;
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	eb d6                	jmp    801296 <mmap+0x13e>
+  8012c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c5:	eb cf                	jmp    801296 <mmap+0x13e>
+
+008012c7 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	53                   	push   %ebx
+  8012cb:	83 ec 10             	sub    $0x10,%esp
+  8012ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012d1:	53                   	push   %ebx
+  8012d2:	e8 78 25 00 00       	call   80384f <strlen>
+  8012d7:	83 c4 10             	add    $0x10,%esp
+  8012da:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012df:	7f 42                	jg     801323 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	68 04 60 80 00       	push   $0x806004
+  8012e9:	e8 5d 15 00 00       	call   80284b <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012ee:	83 c4 08             	add    $0x8,%esp
+  8012f1:	53                   	push   %ebx
+  8012f2:	68 00 70 80 00       	push   $0x807000
+  8012f7:	e8 8e 25 00 00       	call   80388a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801301:	b8 07 00 00 00       	mov    $0x7,%eax
+  801306:	e8 b9 f9 ff ff       	call   800cc4 <fsipc>
+  80130b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80130d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801314:	e8 9f 15 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+  801319:	83 c4 10             	add    $0x10,%esp
+}
+  80131c:	89 d8                	mov    %ebx,%eax
+  80131e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+		return -E_BAD_PATH;
+  801323:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801328:	eb f2                	jmp    80131c <remove+0x55>
+
+0080132a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	53                   	push   %ebx
+  80132e:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801331:	68 04 60 80 00       	push   $0x806004
+  801336:	e8 10 15 00 00       	call   80284b <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  80133b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801340:	b8 08 00 00 00       	mov    $0x8,%eax
+  801345:	e8 7a f9 ff ff       	call   800cc4 <fsipc>
+  80134a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80134c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801353:	e8 60 15 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+}
+  801358:	89 d8                	mov    %ebx,%eax
+  80135a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80135d:	c9                   	leave
+  80135e:	c3                   	ret
+
+0080135f <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	56                   	push   %esi
+  801363:	53                   	push   %ebx
+  801364:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801367:	83 ec 0c             	sub    $0xc,%esp
+  80136a:	68 04 60 80 00       	push   $0x806004
+  80136f:	e8 d7 14 00 00       	call   80284b <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801374:	8b 45 08             	mov    0x8(%ebp),%eax
+  801377:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80137c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801381:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801386:	e8 39 f9 ff ff       	call   800cc4 <fsipc>
+  80138b:	89 c6                	mov    %eax,%esi
+  80138d:	83 c4 10             	add    $0x10,%esp
+  801390:	85 db                	test   %ebx,%ebx
+  801392:	74 7b                	je     80140f <fs_bcstat+0xb0>
+  801394:	85 c0                	test   %eax,%eax
+  801396:	78 77                	js     80140f <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801398:	a1 00 70 80 00       	mov    0x807000,%eax
+  80139d:	89 03                	mov    %eax,(%ebx)
+  80139f:	a1 04 70 80 00       	mov    0x807004,%eax
+  8013a4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8013a7:	a1 08 70 80 00       	mov    0x807008,%eax
+  8013ac:	89 43 08             	mov    %eax,0x8(%ebx)
+  8013af:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013b4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013b7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013bc:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013bf:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013c4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013c7:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013cc:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013cf:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013d4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013d7:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013dc:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013df:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013e4:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013e7:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013ec:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013ef:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013f4:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013f7:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013fc:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013ff:	a1 34 70 80 00       	mov    0x807034,%eax
+  801404:	89 43 34             	mov    %eax,0x34(%ebx)
+  801407:	a1 38 70 80 00       	mov    0x807038,%eax
+  80140c:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80140f:	83 ec 0c             	sub    $0xc,%esp
+  801412:	68 04 60 80 00       	push   $0x806004
+  801417:	e8 9c 14 00 00       	call   8028b8 <mutex_unlock>
+	return r;
+}
+  80141c:	89 f0                	mov    %esi,%eax
+  80141e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5d                   	pop    %ebp
+  801424:	c3                   	ret
+
+00801425 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+  80142a:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80142c:	0f b6 10             	movzbl (%eax),%edx
+  80142f:	80 fa 72             	cmp    $0x72,%dl
+  801432:	74 44                	je     801478 <parse_mode+0x53>
+  801434:	80 fa 77             	cmp    $0x77,%dl
+  801437:	74 4b                	je     801484 <parse_mode+0x5f>
+  801439:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80143e:	80 fa 61             	cmp    $0x61,%dl
+  801441:	74 09                	je     80144c <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801443:	89 d8                	mov    %ebx,%eax
+  801445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+	switch (mode[0]) {
+  80144c:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801451:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801456:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801458:	83 ec 08             	sub    $0x8,%esp
+  80145b:	6a 2b                	push   $0x2b
+  80145d:	50                   	push   %eax
+  80145e:	e8 39 25 00 00       	call   80399c <strchr>
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	85 c0                	test   %eax,%eax
+  801468:	74 d9                	je     801443 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80146a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80146d:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801470:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801476:	eb cb                	jmp    801443 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801478:	ba 01 00 00 00       	mov    $0x1,%edx
+  80147d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801482:	eb d2                	jmp    801456 <parse_mode+0x31>
+  801484:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801489:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80148e:	eb c6                	jmp    801456 <parse_mode+0x31>
+
+00801490 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+  801496:	83 ec 1c             	sub    $0x1c,%esp
+  801499:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80149c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80149f:	b8 44 50 80 00       	mov    $0x805044,%eax
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8014a9:	83 c0 24             	add    $0x24,%eax
+  8014ac:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014b0:	74 17                	je     8014c9 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014b2:	83 c3 01             	add    $0x1,%ebx
+  8014b5:	83 fb 10             	cmp    $0x10,%ebx
+  8014b8:	75 ef                	jne    8014a9 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014ba:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014bf:	89 f0                	mov    %esi,%eax
+  8014c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014c9:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014d3:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014d6:	c1 e7 02             	shl    $0x2,%edi
+  8014d9:	8d b7 40 50 80 00    	lea    0x805040(%edi),%esi
+  8014df:	83 ec 04             	sub    $0x4,%esp
+  8014e2:	6a 24                	push   $0x24
+  8014e4:	6a 00                	push   $0x0
+  8014e6:	56                   	push   %esi
+  8014e7:	e8 ef 24 00 00       	call   8039db <memset>
+			streams[i].f_fd = fd;
+  8014ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014ef:	89 8f 40 50 80 00    	mov    %ecx,0x805040(%edi)
+			streams[i].f_flags = flags;
+  8014f5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014f8:	01 d8                	add    %ebx,%eax
+  8014fa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014fd:	89 0c 85 44 50 80 00 	mov    %ecx,0x805044(,%eax,4)
+			return &streams[i];
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	eb b6                	jmp    8014bf <stream_alloc+0x2f>
+
+00801509 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	53                   	push   %ebx
+  80150d:	83 ec 14             	sub    $0x14,%esp
+  801510:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801512:	8b 40 18             	mov    0x18(%eax),%eax
+  801515:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801518:	74 4a                	je     801564 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80151a:	83 ec 08             	sub    $0x8,%esp
+  80151d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801520:	50                   	push   %eax
+  801521:	ff 33                	push   (%ebx)
+  801523:	e8 e2 f1 ff ff       	call   80070a <fd_lookup>
+  801528:	89 c2                	mov    %eax,%edx
+  80152a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80152d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801532:	85 d2                	test   %edx,%edx
+  801534:	78 41                	js     801577 <stream_unread+0x6e>
+  801536:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801539:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80153f:	39 0a                	cmp    %ecx,(%edx)
+  801541:	75 34                	jne    801577 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801543:	8b 43 14             	mov    0x14(%ebx),%eax
+  801546:	03 42 04             	add    0x4(%edx),%eax
+  801549:	2b 43 18             	sub    0x18(%ebx),%eax
+  80154c:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80154f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801556:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80155d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801562:	eb 13                	jmp    801577 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801564:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80156b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801572:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801577:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80157a:	c9                   	leave
+  80157b:	c3                   	ret
+
+0080157c <stream_drain>:
+{
+  80157c:	55                   	push   %ebp
+  80157d:	89 e5                	mov    %esp,%ebp
+  80157f:	56                   	push   %esi
+  801580:	53                   	push   %ebx
+  801581:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801588:	eb 02                	jmp    80158c <stream_drain+0x10>
+  80158a:	01 c3                	add    %eax,%ebx
+  80158c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80158f:	39 c3                	cmp    %eax,%ebx
+  801591:	73 43                	jae    8015d6 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801593:	83 ec 04             	sub    $0x4,%esp
+  801596:	29 d8                	sub    %ebx,%eax
+  801598:	50                   	push   %eax
+  801599:	89 d8                	mov    %ebx,%eax
+  80159b:	03 46 0c             	add    0xc(%esi),%eax
+  80159e:	50                   	push   %eax
+  80159f:	ff 36                	push   (%esi)
+  8015a1:	e8 ec f4 ff ff       	call   800a92 <write>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	7f dd                	jg     80158a <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8015ad:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015b1:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015b4:	83 ec 04             	sub    $0x4,%esp
+  8015b7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015ba:	29 d8                	sub    %ebx,%eax
+  8015bc:	50                   	push   %eax
+  8015bd:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015c0:	50                   	push   %eax
+  8015c1:	52                   	push   %edx
+  8015c2:	e8 49 24 00 00       	call   803a10 <memmove>
+			f->f_wend -= done;
+  8015c7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015ca:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015cc:	83 c4 10             	add    $0x10,%esp
+  8015cf:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015d4:	eb 0a                	jmp    8015e0 <stream_drain+0x64>
+  8015d6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015db:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015e0:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015e3:	89 d0                	mov    %edx,%eax
+  8015e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	c3                   	ret
+
+008015ec <stream_setup>:
+	if (f->f_buf)
+  8015ec:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015f0:	74 01                	je     8015f3 <stream_setup+0x7>
+  8015f2:	c3                   	ret
+{
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	53                   	push   %ebx
+  8015f7:	83 ec 04             	sub    $0x4,%esp
+  8015fa:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015fc:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	74 17                	je     80161a <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801603:	83 f8 03             	cmp    $0x3,%eax
+  801606:	75 2d                	jne    801635 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801608:	8d 43 20             	lea    0x20(%ebx),%eax
+  80160b:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80160e:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	ff 33                	push   (%ebx)
+  80161f:	e8 29 1b 00 00       	call   80314d <iscons>
+  801624:	83 c4 10             	add    $0x10,%esp
+  801627:	85 c0                	test   %eax,%eax
+  801629:	0f 9f c0             	setg   %al
+  80162c:	0f b6 c0             	movzbl %al,%eax
+  80162f:	83 c0 01             	add    $0x1,%eax
+  801632:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801635:	83 ec 0c             	sub    $0xc,%esp
+  801638:	68 00 10 00 00       	push   $0x1000
+  80163d:	e8 6e 0b 00 00       	call   8021b0 <malloc>
+  801642:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801645:	83 c4 10             	add    $0x10,%esp
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	74 bc                	je     801608 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80164c:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  801653:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801657:	eb bc                	jmp    801615 <stream_setup+0x29>
+
+00801659 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801659:	55                   	push   %ebp
+  80165a:	89 e5                	mov    %esp,%ebp
+  80165c:	53                   	push   %ebx
+  80165d:	83 ec 04             	sub    $0x4,%esp
+  801660:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  801662:	e8 85 ff ff ff       	call   8015ec <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801667:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80166c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801670:	74 3d                	je     8016af <stream_fill+0x56>
+  801672:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801676:	74 10                	je     801688 <stream_fill+0x2f>
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	e8 fd fe ff ff       	call   80157c <stream_drain>
+		return 0;
+  80167f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801684:	85 c0                	test   %eax,%eax
+  801686:	78 27                	js     8016af <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801688:	83 ec 04             	sub    $0x4,%esp
+  80168b:	ff 73 10             	push   0x10(%ebx)
+  80168e:	ff 73 0c             	push   0xc(%ebx)
+  801691:	ff 33                	push   (%ebx)
+  801693:	e8 02 f3 ff ff       	call   80099a <read>
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	7e 17                	jle    8016b6 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80169f:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8016a3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8016aa:	89 c2                	mov    %eax,%edx
+  8016ac:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8016af:	89 d0                	mov    %edx,%eax
+  8016b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016b4:	c9                   	leave
+  8016b5:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016b6:	c1 f8 1f             	sar    $0x1f,%eax
+  8016b9:	83 e0 04             	and    $0x4,%eax
+  8016bc:	83 c0 04             	add    $0x4,%eax
+  8016bf:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c7:	eb e6                	jmp    8016af <stream_fill+0x56>
+
+008016c9 <fopen>:
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	57                   	push   %edi
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d8:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016de:	89 f0                	mov    %esi,%eax
+  8016e0:	e8 40 fd ff ff       	call   801425 <parse_mode>
+		return 0;
+  8016e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	78 2d                	js     80171b <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016ee:	83 ec 08             	sub    $0x8,%esp
+  8016f1:	50                   	push   %eax
+  8016f2:	ff 75 08             	push   0x8(%ebp)
+  8016f5:	e8 e8 f8 ff ff       	call   800fe2 <open>
+  8016fa:	89 c7                	mov    %eax,%edi
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 58                	js     80175b <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801703:	80 3e 61             	cmpb   $0x61,(%esi)
+  801706:	74 1d                	je     801725 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  801708:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80170e:	89 f8                	mov    %edi,%eax
+  801710:	e8 7b fd ff ff       	call   801490 <stream_alloc>
+  801715:	89 c3                	mov    %eax,%ebx
+  801717:	85 c0                	test   %eax,%eax
+  801719:	74 32                	je     80174d <fopen+0x84>
+}
+  80171b:	89 d8                	mov    %ebx,%eax
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801725:	83 ec 08             	sub    $0x8,%esp
+  801728:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80172e:	50                   	push   %eax
+  80172f:	57                   	push   %edi
+  801730:	e8 db f4 ff ff       	call   800c10 <fstat>
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 cc                	js     801708 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80173c:	83 ec 08             	sub    $0x8,%esp
+  80173f:	ff 75 dc             	push   -0x24(%ebp)
+  801742:	57                   	push   %edi
+  801743:	e8 f6 f3 ff ff       	call   800b3e <seek>
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	eb bb                	jmp    801708 <fopen+0x3f>
+		close(fd);
+  80174d:	83 ec 0c             	sub    $0xc,%esp
+  801750:	57                   	push   %edi
+  801751:	e8 08 f1 ff ff       	call   80085e <close>
+  801756:	83 c4 10             	add    $0x10,%esp
+  801759:	eb c0                	jmp    80171b <fopen+0x52>
+		return 0;
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	eb b9                	jmp    80171b <fopen+0x52>
+
+00801762 <fdopen>:
+{
+  801762:	55                   	push   %ebp
+  801763:	89 e5                	mov    %esp,%ebp
+  801765:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801768:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80176b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176e:	e8 b2 fc ff ff       	call   801425 <parse_mode>
+  801773:	89 c2                	mov    %eax,%edx
+		return 0;
+  801775:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80177a:	85 d2                	test   %edx,%edx
+  80177c:	78 0b                	js     801789 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80177e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801781:	8b 45 08             	mov    0x8(%ebp),%eax
+  801784:	e8 07 fd ff ff       	call   801490 <stream_alloc>
+}
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+
+0080178b <setvbuf>:
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	57                   	push   %edi
+  80178f:	56                   	push   %esi
+  801790:	53                   	push   %ebx
+  801791:	8b 45 08             	mov    0x8(%ebp),%eax
+  801794:	8b 55 10             	mov    0x10(%ebp),%edx
+  801797:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80179a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80179e:	75 3a                	jne    8017da <setvbuf+0x4f>
+  8017a0:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8017a3:	83 fe 02             	cmp    $0x2,%esi
+  8017a6:	77 39                	ja     8017e1 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8017a8:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8017ab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8017af:	0f 95 c3             	setne  %bl
+  8017b2:	85 ff                	test   %edi,%edi
+  8017b4:	0f 95 c1             	setne  %cl
+  8017b7:	84 cb                	test   %cl,%bl
+  8017b9:	74 05                	je     8017c0 <setvbuf+0x35>
+  8017bb:	83 fa 03             	cmp    $0x3,%edx
+  8017be:	75 0a                	jne    8017ca <setvbuf+0x3f>
+	return 0;
+  8017c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c5:	5b                   	pop    %ebx
+  8017c6:	5e                   	pop    %esi
+  8017c7:	5f                   	pop    %edi
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+		f->f_buf = buf;
+  8017ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cd:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017d0:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d8:	eb eb                	jmp    8017c5 <setvbuf+0x3a>
+		return EOF;
+  8017da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017df:	eb e4                	jmp    8017c5 <setvbuf+0x3a>
+  8017e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017e6:	eb dd                	jmp    8017c5 <setvbuf+0x3a>
+
+008017e8 <fflush>:
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	57                   	push   %edi
+  8017ec:	56                   	push   %esi
+  8017ed:	53                   	push   %ebx
+  8017ee:	83 ec 0c             	sub    $0xc,%esp
+  8017f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017f4:	85 db                	test   %ebx,%ebx
+  8017f6:	74 1a                	je     801812 <fflush+0x2a>
+	stream_unread(f);
+  8017f8:	89 d8                	mov    %ebx,%eax
+  8017fa:	e8 0a fd ff ff       	call   801509 <stream_unread>
+	return stream_drain(f);
+  8017ff:	89 d8                	mov    %ebx,%eax
+  801801:	e8 76 fd ff ff       	call   80157c <stream_drain>
+  801806:	89 c7                	mov    %eax,%edi
+}
+  801808:	89 f8                	mov    %edi,%eax
+  80180a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180d:	5b                   	pop    %ebx
+  80180e:	5e                   	pop    %esi
+  80180f:	5f                   	pop    %edi
+  801810:	5d                   	pop    %ebp
+  801811:	c3                   	ret
+  801812:	bb 40 50 80 00       	mov    $0x805040,%ebx
+  801817:	be 80 52 80 00       	mov    $0x805280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80181c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801821:	eb 03                	jmp    801826 <fflush+0x3e>
+  801823:	83 c3 24             	add    $0x24,%ebx
+  801826:	39 f3                	cmp    %esi,%ebx
+  801828:	74 de                	je     801808 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80182a:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80182e:	74 f3                	je     801823 <fflush+0x3b>
+  801830:	83 ec 0c             	sub    $0xc,%esp
+  801833:	53                   	push   %ebx
+  801834:	e8 af ff ff ff       	call   8017e8 <fflush>
+  801839:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80183c:	85 c0                	test   %eax,%eax
+  80183e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801843:	0f 48 f8             	cmovs  %eax,%edi
+  801846:	eb db                	jmp    801823 <fflush+0x3b>
+
+00801848 <fclose>:
+{
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  80184d:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801850:	83 ec 0c             	sub    $0xc,%esp
+  801853:	56                   	push   %esi
+  801854:	e8 8f ff ff ff       	call   8017e8 <fflush>
+  801859:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80185b:	83 c4 04             	add    $0x4,%esp
+  80185e:	ff 36                	push   (%esi)
+  801860:	e8 f9 ef ff ff       	call   80085e <close>
+  801865:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80186f:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  801872:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  801876:	75 10                	jne    801888 <fclose+0x40>
+	f->f_flags = 0;
+  801878:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80187f:	89 d8                	mov    %ebx,%eax
+  801881:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801884:	5b                   	pop    %ebx
+  801885:	5e                   	pop    %esi
+  801886:	5d                   	pop    %ebp
+  801887:	c3                   	ret
+		free(f->f_buf);
+  801888:	83 ec 0c             	sub    $0xc,%esp
+  80188b:	ff 76 0c             	push   0xc(%esi)
+  80188e:	e8 54 08 00 00       	call   8020e7 <free>
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	eb e0                	jmp    801878 <fclose+0x30>
+
+00801898 <fileno>:
+{
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80189b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189e:	8b 00                	mov    (%eax),%eax
+}
+  8018a0:	5d                   	pop    %ebp
+  8018a1:	c3                   	ret
+
+008018a2 <feof>:
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8018a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a8:	8b 40 04             	mov    0x4(%eax),%eax
+  8018ab:	c1 e8 02             	shr    $0x2,%eax
+  8018ae:	83 e0 01             	and    $0x1,%eax
+}
+  8018b1:	5d                   	pop    %ebp
+  8018b2:	c3                   	ret
+
+008018b3 <ferror>:
+{
+  8018b3:	55                   	push   %ebp
+  8018b4:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b9:	8b 40 04             	mov    0x4(%eax),%eax
+  8018bc:	c1 e8 03             	shr    $0x3,%eax
+  8018bf:	83 e0 01             	and    $0x1,%eax
+}
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+
+008018c4 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 04             	sub    $0x4,%esp
+  8018cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018ce:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018d1:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018d4:	74 15                	je     8018eb <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018d6:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018d9:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018dc:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018df:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018e2:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018eb:	89 d8                	mov    %ebx,%eax
+  8018ed:	e8 67 fd ff ff       	call   801659 <stream_fill>
+  8018f2:	85 c0                	test   %eax,%eax
+  8018f4:	75 e0                	jne    8018d6 <fgetc+0x12>
+		return EOF;
+  8018f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018fb:	eb e9                	jmp    8018e6 <fgetc+0x22>
+
+008018fd <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	57                   	push   %edi
+  801901:	56                   	push   %esi
+  801902:	53                   	push   %ebx
+  801903:	83 ec 1c             	sub    $0x1c,%esp
+  801906:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801909:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80190e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801911:	83 e8 01             	sub    $0x1,%eax
+  801914:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801917:	eb 66                	jmp    80197f <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801919:	8b 46 14             	mov    0x14(%esi),%eax
+  80191c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80191f:	29 c3                	sub    %eax,%ebx
+  801921:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801924:	29 fa                	sub    %edi,%edx
+  801926:	39 d3                	cmp    %edx,%ebx
+  801928:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80192b:	83 ec 04             	sub    $0x4,%esp
+  80192e:	53                   	push   %ebx
+  80192f:	6a 0a                	push   $0xa
+  801931:	03 46 0c             	add    0xc(%esi),%eax
+  801934:	50                   	push   %eax
+  801935:	e8 87 21 00 00       	call   803ac1 <memfind>
+  80193a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80193d:	8b 46 0c             	mov    0xc(%esi),%eax
+  801940:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801943:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801946:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801948:	83 c4 10             	add    $0x10,%esp
+  80194b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80194e:	74 0b                	je     80195b <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801950:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801953:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801956:	29 d3                	sub    %edx,%ebx
+  801958:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	53                   	push   %ebx
+  80195f:	01 c8                	add    %ecx,%eax
+  801961:	50                   	push   %eax
+  801962:	89 f8                	mov    %edi,%eax
+  801964:	03 45 08             	add    0x8(%ebp),%eax
+  801967:	50                   	push   %eax
+  801968:	e8 a3 20 00 00       	call   803a10 <memmove>
+		f->f_rpos += m;
+  80196d:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801970:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	8b 45 08             	mov    0x8(%ebp),%eax
+  801978:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80197d:	74 1f                	je     80199e <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80197f:	8d 47 01             	lea    0x1(%edi),%eax
+  801982:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801985:	73 17                	jae    80199e <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801987:	8b 46 18             	mov    0x18(%esi),%eax
+  80198a:	39 46 14             	cmp    %eax,0x14(%esi)
+  80198d:	75 8a                	jne    801919 <fgets+0x1c>
+  80198f:	89 f0                	mov    %esi,%eax
+  801991:	e8 c3 fc ff ff       	call   801659 <stream_fill>
+  801996:	85 c0                	test   %eax,%eax
+  801998:	0f 85 7b ff ff ff    	jne    801919 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80199e:	85 ff                	test   %edi,%edi
+  8019a0:	74 0f                	je     8019b1 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8019a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a5:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8019a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ac:	5b                   	pop    %ebx
+  8019ad:	5e                   	pop    %esi
+  8019ae:	5f                   	pop    %edi
+  8019af:	5d                   	pop    %ebp
+  8019b0:	c3                   	ret
+		return 0;
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b6:	eb f1                	jmp    8019a9 <fgets+0xac>
+
+008019b8 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	57                   	push   %edi
+  8019bc:	56                   	push   %esi
+  8019bd:	53                   	push   %ebx
+  8019be:	83 ec 1c             	sub    $0x1c,%esp
+  8019c1:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019c4:	89 f0                	mov    %esi,%eax
+  8019c6:	e8 21 fc ff ff       	call   8015ec <stream_setup>
+	want = size * n;
+  8019cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ce:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019da:	eb 43                	jmp    801a1f <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019dc:	29 d3                	sub    %edx,%ebx
+  8019de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019e1:	29 f8                	sub    %edi,%eax
+  8019e3:	39 c3                	cmp    %eax,%ebx
+  8019e5:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019e8:	83 ec 04             	sub    $0x4,%esp
+  8019eb:	53                   	push   %ebx
+  8019ec:	03 56 0c             	add    0xc(%esi),%edx
+  8019ef:	52                   	push   %edx
+  8019f0:	89 f8                	mov    %edi,%eax
+  8019f2:	03 45 08             	add    0x8(%ebp),%eax
+  8019f5:	50                   	push   %eax
+  8019f6:	e8 15 20 00 00       	call   803a10 <memmove>
+			f->f_rpos += m;
+  8019fb:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	eb 1a                	jmp    801a1d <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  801a03:	83 ec 04             	sub    $0x4,%esp
+  801a06:	53                   	push   %ebx
+  801a07:	89 f8                	mov    %edi,%eax
+  801a09:	03 45 08             	add    0x8(%ebp),%eax
+  801a0c:	50                   	push   %eax
+  801a0d:	ff 36                	push   (%esi)
+  801a0f:	e8 86 ef ff ff       	call   80099a <read>
+  801a14:	89 c3                	mov    %eax,%ebx
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	7e 36                	jle    801a53 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a1d:	01 df                	add    %ebx,%edi
+  801a1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a22:	39 c7                	cmp    %eax,%edi
+  801a24:	73 39                	jae    801a5f <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a26:	8b 56 14             	mov    0x14(%esi),%edx
+  801a29:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a2c:	39 da                	cmp    %ebx,%edx
+  801a2e:	72 ac                	jb     8019dc <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a30:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a33:	29 fb                	sub    %edi,%ebx
+  801a35:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a38:	72 3e                	jb     801a78 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a3a:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a3e:	74 1f                	je     801a5f <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a40:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a44:	74 bd                	je     801a03 <fread+0x4b>
+  801a46:	89 f0                	mov    %esi,%eax
+  801a48:	e8 2f fb ff ff       	call   80157c <stream_drain>
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	79 b2                	jns    801a03 <fread+0x4b>
+  801a51:	eb 0c                	jmp    801a5f <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a53:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a56:	83 e3 04             	and    $0x4,%ebx
+  801a59:	83 c3 04             	add    $0x4,%ebx
+  801a5c:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a62:	85 c0                	test   %eax,%eax
+  801a64:	74 0a                	je     801a70 <fread+0xb8>
+  801a66:	89 f8                	mov    %edi,%eax
+  801a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6d:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a73:	5b                   	pop    %ebx
+  801a74:	5e                   	pop    %esi
+  801a75:	5f                   	pop    %edi
+  801a76:	5d                   	pop    %ebp
+  801a77:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a78:	89 f0                	mov    %esi,%eax
+  801a7a:	e8 da fb ff ff       	call   801659 <stream_fill>
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	74 dc                	je     801a5f <fread+0xa7>
+			m = 0;
+  801a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a88:	eb 93                	jmp    801a1d <fread+0x65>
+
+00801a8a <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	57                   	push   %edi
+  801a8e:	56                   	push   %esi
+  801a8f:	53                   	push   %ebx
+  801a90:	83 ec 1c             	sub    $0x1c,%esp
+  801a93:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a96:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a99:	a8 02                	test   $0x2,%al
+  801a9b:	75 13                	jne    801ab0 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a9d:	83 c8 08             	or     $0x8,%eax
+  801aa0:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aab:	5b                   	pop    %ebx
+  801aac:	5e                   	pop    %esi
+  801aad:	5f                   	pop    %edi
+  801aae:	5d                   	pop    %ebp
+  801aaf:	c3                   	ret
+	stream_setup(f);
+  801ab0:	89 d8                	mov    %ebx,%eax
+  801ab2:	e8 35 fb ff ff       	call   8015ec <stream_setup>
+	want = size * n;
+  801ab7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aba:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801abe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801ac1:	89 d8                	mov    %ebx,%eax
+  801ac3:	e8 41 fa ff ff       	call   801509 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801acd:	84 c0                	test   %al,%al
+  801acf:	75 7b                	jne    801b4c <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ad1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad9:	39 fe                	cmp    %edi,%esi
+  801adb:	73 24                	jae    801b01 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801add:	83 ec 04             	sub    $0x4,%esp
+  801ae0:	89 f8                	mov    %edi,%eax
+  801ae2:	29 f0                	sub    %esi,%eax
+  801ae4:	50                   	push   %eax
+  801ae5:	89 f0                	mov    %esi,%eax
+  801ae7:	03 45 08             	add    0x8(%ebp),%eax
+  801aea:	50                   	push   %eax
+  801aeb:	ff 33                	push   (%ebx)
+  801aed:	e8 a0 ef ff ff       	call   800a92 <write>
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	7e 04                	jle    801afd <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801af9:	01 c6                	add    %eax,%esi
+  801afb:	eb dc                	jmp    801ad9 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801afd:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801b01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	74 a0                	je     801aa8 <fwrite+0x1e>
+  801b08:	89 f0                	mov    %esi,%eax
+  801b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0f:	f7 75 0c             	divl   0xc(%ebp)
+  801b12:	eb 94                	jmp    801aa8 <fwrite+0x1e>
+			done += r;
+  801b14:	01 c7                	add    %eax,%edi
+			continue;
+  801b16:	eb 34                	jmp    801b4c <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b18:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b1b:	29 c6                	sub    %eax,%esi
+  801b1d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b20:	29 fa                	sub    %edi,%edx
+  801b22:	39 d6                	cmp    %edx,%esi
+  801b24:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b27:	83 ec 04             	sub    $0x4,%esp
+  801b2a:	56                   	push   %esi
+  801b2b:	89 fa                	mov    %edi,%edx
+  801b2d:	03 55 08             	add    0x8(%ebp),%edx
+  801b30:	52                   	push   %edx
+  801b31:	03 43 0c             	add    0xc(%ebx),%eax
+  801b34:	50                   	push   %eax
+  801b35:	e8 d6 1e 00 00       	call   803a10 <memmove>
+		f->f_wend += m;
+  801b3a:	89 f0                	mov    %esi,%eax
+  801b3c:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b3f:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b42:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b4a:	74 5b                	je     801ba7 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b4f:	39 c7                	cmp    %eax,%edi
+  801b51:	73 2d                	jae    801b80 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b53:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	75 be                	jne    801b18 <fwrite+0x8e>
+  801b5a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b5d:	29 fa                	sub    %edi,%edx
+  801b5f:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b62:	72 b4                	jb     801b18 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b64:	83 ec 04             	sub    $0x4,%esp
+  801b67:	52                   	push   %edx
+  801b68:	89 f8                	mov    %edi,%eax
+  801b6a:	03 45 08             	add    0x8(%ebp),%eax
+  801b6d:	50                   	push   %eax
+  801b6e:	ff 33                	push   (%ebx)
+  801b70:	e8 1d ef ff ff       	call   800a92 <write>
+  801b75:	83 c4 10             	add    $0x10,%esp
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	7f 98                	jg     801b14 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b7c:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b80:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b83:	83 f8 03             	cmp    $0x3,%eax
+  801b86:	74 48                	je     801bd0 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b88:	83 f8 02             	cmp    $0x2,%eax
+  801b8b:	74 27                	je     801bb4 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	0f 84 10 ff ff ff    	je     801aa8 <fwrite+0x1e>
+  801b98:	89 f8                	mov    %edi,%eax
+  801b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9f:	f7 75 0c             	divl   0xc(%ebp)
+  801ba2:	e9 01 ff ff ff       	jmp    801aa8 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801ba7:	89 d8                	mov    %ebx,%eax
+  801ba9:	e8 ce f9 ff ff       	call   80157c <stream_drain>
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	79 9a                	jns    801b4c <fwrite+0xc2>
+  801bb2:	eb cc                	jmp    801b80 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801bb4:	83 ec 04             	sub    $0x4,%esp
+  801bb7:	57                   	push   %edi
+  801bb8:	6a 0a                	push   $0xa
+  801bba:	ff 75 08             	push   0x8(%ebp)
+  801bbd:	e8 ff 1e 00 00       	call   803ac1 <memfind>
+  801bc2:	89 c2                	mov    %eax,%edx
+  801bc4:	89 f8                	mov    %edi,%eax
+  801bc6:	03 45 08             	add    0x8(%ebp),%eax
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	39 c2                	cmp    %eax,%edx
+  801bce:	74 bd                	je     801b8d <fwrite+0x103>
+		stream_drain(f);
+  801bd0:	89 d8                	mov    %ebx,%eax
+  801bd2:	e8 a5 f9 ff ff       	call   80157c <stream_drain>
+  801bd7:	eb b4                	jmp    801b8d <fwrite+0x103>
+
+00801bd9 <fputc>:
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 14             	sub    $0x14,%esp
+  801be0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801be3:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801be6:	ff 75 0c             	push   0xc(%ebp)
+  801be9:	6a 01                	push   $0x1
+  801beb:	6a 01                	push   $0x1
+  801bed:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801bf0:	50                   	push   %eax
+  801bf1:	e8 94 fe ff ff       	call   801a8a <fwrite>
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	0f b6 db             	movzbl %bl,%ebx
+  801bfc:	83 f8 01             	cmp    $0x1,%eax
+  801bff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c04:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801c07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0a:	c9                   	leave
+  801c0b:	c3                   	ret
+
+00801c0c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c12:	ff 75 0c             	push   0xc(%ebp)
+  801c15:	ff 75 08             	push   0x8(%ebp)
+  801c18:	e8 bc ff ff ff       	call   801bd9 <fputc>
+}
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+00801c22 <fputs>:
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	56                   	push   %esi
+  801c26:	53                   	push   %ebx
+  801c27:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c2a:	83 ec 0c             	sub    $0xc,%esp
+  801c2d:	56                   	push   %esi
+  801c2e:	e8 1c 1c 00 00       	call   80384f <strlen>
+  801c33:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c35:	ff 75 0c             	push   0xc(%ebp)
+  801c38:	50                   	push   %eax
+  801c39:	6a 01                	push   $0x1
+  801c3b:	56                   	push   %esi
+  801c3c:	e8 49 fe ff ff       	call   801a8a <fwrite>
+  801c41:	83 c4 20             	add    $0x20,%esp
+  801c44:	39 d8                	cmp    %ebx,%eax
+  801c46:	0f 95 c0             	setne  %al
+  801c49:	0f b6 c0             	movzbl %al,%eax
+  801c4c:	f7 d8                	neg    %eax
+}
+  801c4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c51:	5b                   	pop    %ebx
+  801c52:	5e                   	pop    %esi
+  801c53:	5d                   	pop    %ebp
+  801c54:	c3                   	ret
+
+00801c55 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	53                   	push   %ebx
+  801c59:	83 ec 04             	sub    $0x4,%esp
+  801c5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c5f:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c62:	50                   	push   %eax
+  801c63:	ff 75 0c             	push   0xc(%ebp)
+  801c66:	53                   	push   %ebx
+  801c67:	68 0c 1c 80 00       	push   $0x801c0c
+  801c6c:	e8 2c 17 00 00       	call   80339d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c71:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c74:	c1 e0 1c             	shl    $0x1c,%eax
+  801c77:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c7d:	c9                   	leave
+  801c7e:	c3                   	ret
+
+00801c7f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c85:	68 fc 47 80 00       	push   $0x8047fc
+  801c8a:	ff 75 0c             	push   0xc(%ebp)
+  801c8d:	e8 f8 1b 00 00       	call   80388a <strcpy>
+	return 0;
+}
+  801c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c97:	c9                   	leave
+  801c98:	c3                   	ret
+
+00801c99 <devsock_close>:
+{
+  801c99:	55                   	push   %ebp
+  801c9a:	89 e5                	mov    %esp,%ebp
+  801c9c:	53                   	push   %ebx
+  801c9d:	83 ec 10             	sub    $0x10,%esp
+  801ca0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 26 27 00 00       	call   8043cf <pageref>
+  801ca9:	89 c2                	mov    %eax,%edx
+  801cab:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cb3:	83 fa 01             	cmp    $0x1,%edx
+  801cb6:	74 05                	je     801cbd <devsock_close+0x24>
+}
+  801cb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbb:	c9                   	leave
+  801cbc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cbd:	83 ec 0c             	sub    $0xc,%esp
+  801cc0:	ff 73 0c             	push   0xc(%ebx)
+  801cc3:	e8 b7 02 00 00       	call   801f7f <nsipc_close>
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  801ccb:	eb eb                	jmp    801cb8 <devsock_close+0x1f>
+
+00801ccd <devsock_write>:
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cd3:	6a 00                	push   $0x0
+  801cd5:	ff 75 10             	push   0x10(%ebp)
+  801cd8:	ff 75 0c             	push   0xc(%ebp)
+  801cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cde:	ff 70 0c             	push   0xc(%eax)
+  801ce1:	e8 79 03 00 00       	call   80205f <nsipc_send>
+}
+  801ce6:	c9                   	leave
+  801ce7:	c3                   	ret
+
+00801ce8 <devsock_read>:
+{
+  801ce8:	55                   	push   %ebp
+  801ce9:	89 e5                	mov    %esp,%ebp
+  801ceb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cee:	6a 00                	push   $0x0
+  801cf0:	ff 75 10             	push   0x10(%ebp)
+  801cf3:	ff 75 0c             	push   0xc(%ebp)
+  801cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf9:	ff 70 0c             	push   0xc(%eax)
+  801cfc:	e8 ef 02 00 00       	call   801ff0 <nsipc_recv>
+}
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+
+00801d03 <fd2sockid>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d09:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d0c:	52                   	push   %edx
+  801d0d:	50                   	push   %eax
+  801d0e:	e8 f7 e9 ff ff       	call   80070a <fd_lookup>
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	78 10                	js     801d2a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1d:	8b 0d 80 52 80 00    	mov    0x805280,%ecx
+  801d23:	39 08                	cmp    %ecx,(%eax)
+  801d25:	75 05                	jne    801d2c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d27:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d2a:	c9                   	leave
+  801d2b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d31:	eb f7                	jmp    801d2a <fd2sockid+0x27>
+
+00801d33 <alloc_sockfd>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	56                   	push   %esi
+  801d37:	53                   	push   %ebx
+  801d38:	83 ec 1c             	sub    $0x1c,%esp
+  801d3b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	e8 6e e9 ff ff       	call   8006b4 <fd_alloc>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 43                	js     801d92 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d4f:	83 ec 04             	sub    $0x4,%esp
+  801d52:	68 07 04 00 00       	push   $0x407
+  801d57:	ff 75 f4             	push   -0xc(%ebp)
+  801d5a:	6a 00                	push   $0x0
+  801d5c:	e8 8a e4 ff ff       	call   8001eb <sys_page_alloc>
+  801d61:	89 c3                	mov    %eax,%ebx
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 28                	js     801d92 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d6d:	8b 15 80 52 80 00    	mov    0x805280,%edx
+  801d73:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d78:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d7f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d82:	83 ec 0c             	sub    $0xc,%esp
+  801d85:	50                   	push   %eax
+  801d86:	e8 02 e9 ff ff       	call   80068d <fd2num>
+  801d8b:	89 c3                	mov    %eax,%ebx
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	eb 0c                	jmp    801d9e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d92:	83 ec 0c             	sub    $0xc,%esp
+  801d95:	56                   	push   %esi
+  801d96:	e8 e4 01 00 00       	call   801f7f <nsipc_close>
+		return r;
+  801d9b:	83 c4 10             	add    $0x10,%esp
+}
+  801d9e:	89 d8                	mov    %ebx,%eax
+  801da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da3:	5b                   	pop    %ebx
+  801da4:	5e                   	pop    %esi
+  801da5:	5d                   	pop    %ebp
+  801da6:	c3                   	ret
+
+00801da7 <accept>:
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db0:	e8 4e ff ff ff       	call   801d03 <fd2sockid>
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 1b                	js     801dd4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801db9:	83 ec 04             	sub    $0x4,%esp
+  801dbc:	ff 75 10             	push   0x10(%ebp)
+  801dbf:	ff 75 0c             	push   0xc(%ebp)
+  801dc2:	50                   	push   %eax
+  801dc3:	e8 0e 01 00 00       	call   801ed6 <nsipc_accept>
+  801dc8:	83 c4 10             	add    $0x10,%esp
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 05                	js     801dd4 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dcf:	e8 5f ff ff ff       	call   801d33 <alloc_sockfd>
+}
+  801dd4:	c9                   	leave
+  801dd5:	c3                   	ret
+
+00801dd6 <bind>:
+{
+  801dd6:	55                   	push   %ebp
+  801dd7:	89 e5                	mov    %esp,%ebp
+  801dd9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddf:	e8 1f ff ff ff       	call   801d03 <fd2sockid>
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 12                	js     801dfa <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801de8:	83 ec 04             	sub    $0x4,%esp
+  801deb:	ff 75 10             	push   0x10(%ebp)
+  801dee:	ff 75 0c             	push   0xc(%ebp)
+  801df1:	50                   	push   %eax
+  801df2:	e8 31 01 00 00       	call   801f28 <nsipc_bind>
+  801df7:	83 c4 10             	add    $0x10,%esp
+}
+  801dfa:	c9                   	leave
+  801dfb:	c3                   	ret
+
+00801dfc <shutdown>:
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e05:	e8 f9 fe ff ff       	call   801d03 <fd2sockid>
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 0f                	js     801e1d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	50                   	push   %eax
+  801e15:	e8 43 01 00 00       	call   801f5d <nsipc_shutdown>
+  801e1a:	83 c4 10             	add    $0x10,%esp
+}
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+00801e1f <connect>:
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e28:	e8 d6 fe ff ff       	call   801d03 <fd2sockid>
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 12                	js     801e43 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e31:	83 ec 04             	sub    $0x4,%esp
+  801e34:	ff 75 10             	push   0x10(%ebp)
+  801e37:	ff 75 0c             	push   0xc(%ebp)
+  801e3a:	50                   	push   %eax
+  801e3b:	e8 59 01 00 00       	call   801f99 <nsipc_connect>
+  801e40:	83 c4 10             	add    $0x10,%esp
+}
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+00801e45 <listen>:
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4e:	e8 b0 fe ff ff       	call   801d03 <fd2sockid>
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 0f                	js     801e66 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e57:	83 ec 08             	sub    $0x8,%esp
+  801e5a:	ff 75 0c             	push   0xc(%ebp)
+  801e5d:	50                   	push   %eax
+  801e5e:	e8 6b 01 00 00       	call   801fce <nsipc_listen>
+  801e63:	83 c4 10             	add    $0x10,%esp
+}
+  801e66:	c9                   	leave
+  801e67:	c3                   	ret
+
+00801e68 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e6e:	ff 75 10             	push   0x10(%ebp)
+  801e71:	ff 75 0c             	push   0xc(%ebp)
+  801e74:	ff 75 08             	push   0x8(%ebp)
+  801e77:	e8 41 02 00 00       	call   8020bd <nsipc_socket>
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 05                	js     801e88 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e83:	e8 ab fe ff ff       	call   801d33 <alloc_sockfd>
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+
+00801e8a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	53                   	push   %ebx
+  801e8e:	83 ec 04             	sub    $0x4,%esp
+  801e91:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e93:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e9a:	74 26                	je     801ec2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e9c:	6a 07                	push   $0x7
+  801e9e:	68 00 80 80 00       	push   $0x808000
+  801ea3:	53                   	push   %ebx
+  801ea4:	ff 35 08 60 80 00    	push   0x806008
+  801eaa:	e8 8b 24 00 00       	call   80433a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801eaf:	83 c4 0c             	add    $0xc,%esp
+  801eb2:	6a 00                	push   $0x0
+  801eb4:	6a 00                	push   $0x0
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	e8 87 23 00 00       	call   804244 <ipc_recv>
+}
+  801ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec0:	c9                   	leave
+  801ec1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ec2:	83 ec 0c             	sub    $0xc,%esp
+  801ec5:	6a 02                	push   $0x2
+  801ec7:	e8 c4 24 00 00       	call   804390 <ipc_find_env>
+  801ecc:	a3 08 60 80 00       	mov    %eax,0x806008
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	eb c6                	jmp    801e9c <nsipc+0x12>
+
+00801ed6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ed6:	55                   	push   %ebp
+  801ed7:	89 e5                	mov    %esp,%ebp
+  801ed9:	56                   	push   %esi
+  801eda:	53                   	push   %ebx
+  801edb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ee6:	8b 06                	mov    (%esi),%eax
+  801ee8:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef2:	e8 93 ff ff ff       	call   801e8a <nsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	79 09                	jns    801f06 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801efd:	89 d8                	mov    %ebx,%eax
+  801eff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f02:	5b                   	pop    %ebx
+  801f03:	5e                   	pop    %esi
+  801f04:	5d                   	pop    %ebp
+  801f05:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f06:	83 ec 04             	sub    $0x4,%esp
+  801f09:	ff 35 10 80 80 00    	push   0x808010
+  801f0f:	68 00 80 80 00       	push   $0x808000
+  801f14:	ff 75 0c             	push   0xc(%ebp)
+  801f17:	e8 f4 1a 00 00       	call   803a10 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f1c:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f21:	89 06                	mov    %eax,(%esi)
+  801f23:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f26:	eb d5                	jmp    801efd <nsipc_accept+0x27>
+
+00801f28 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	53                   	push   %ebx
+  801f2c:	83 ec 08             	sub    $0x8,%esp
+  801f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f35:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f3a:	53                   	push   %ebx
+  801f3b:	ff 75 0c             	push   0xc(%ebp)
+  801f3e:	68 04 80 80 00       	push   $0x808004
+  801f43:	e8 c8 1a 00 00       	call   803a10 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f48:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f53:	e8 32 ff ff ff       	call   801e8a <nsipc>
+}
+  801f58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5b:	c9                   	leave
+  801f5c:	c3                   	ret
+
+00801f5d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f5d:	55                   	push   %ebp
+  801f5e:	89 e5                	mov    %esp,%ebp
+  801f60:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f63:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f66:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f73:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f78:	e8 0d ff ff ff       	call   801e8a <nsipc>
+}
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+00801f7f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f92:	e8 f3 fe ff ff       	call   801e8a <nsipc>
+}
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+
+00801f99 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f99:	55                   	push   %ebp
+  801f9a:	89 e5                	mov    %esp,%ebp
+  801f9c:	53                   	push   %ebx
+  801f9d:	83 ec 08             	sub    $0x8,%esp
+  801fa0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa6:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fab:	53                   	push   %ebx
+  801fac:	ff 75 0c             	push   0xc(%ebp)
+  801faf:	68 04 80 80 00       	push   $0x808004
+  801fb4:	e8 57 1a 00 00       	call   803a10 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fb9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fc4:	e8 c1 fe ff ff       	call   801e8a <nsipc>
+}
+  801fc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+
+00801fce <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fdf:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fe4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fe9:	e8 9c fe ff ff       	call   801e8a <nsipc>
+}
+  801fee:	c9                   	leave
+  801fef:	c3                   	ret
+
+00801ff0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	56                   	push   %esi
+  801ff4:	53                   	push   %ebx
+  801ff5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ff8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802000:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802006:	8b 45 14             	mov    0x14(%ebp),%eax
+  802009:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80200e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802013:	e8 72 fe ff ff       	call   801e8a <nsipc>
+  802018:	89 c3                	mov    %eax,%ebx
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 22                	js     802040 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80201e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802023:	39 c6                	cmp    %eax,%esi
+  802025:	0f 4e c6             	cmovle %esi,%eax
+  802028:	39 c3                	cmp    %eax,%ebx
+  80202a:	7f 1d                	jg     802049 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80202c:	83 ec 04             	sub    $0x4,%esp
+  80202f:	53                   	push   %ebx
+  802030:	68 00 80 80 00       	push   $0x808000
+  802035:	ff 75 0c             	push   0xc(%ebp)
+  802038:	e8 d3 19 00 00       	call   803a10 <memmove>
+  80203d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802040:	89 d8                	mov    %ebx,%eax
+  802042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802045:	5b                   	pop    %ebx
+  802046:	5e                   	pop    %esi
+  802047:	5d                   	pop    %ebp
+  802048:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802049:	68 08 48 80 00       	push   $0x804808
+  80204e:	68 c1 47 80 00       	push   $0x8047c1
+  802053:	6a 62                	push   $0x62
+  802055:	68 1d 48 80 00       	push   $0x80481d
+  80205a:	e8 6c 11 00 00       	call   8031cb <_panic>
+
+0080205f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	53                   	push   %ebx
+  802063:	83 ec 04             	sub    $0x4,%esp
+  802066:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802071:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802077:	7f 2e                	jg     8020a7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802079:	83 ec 04             	sub    $0x4,%esp
+  80207c:	53                   	push   %ebx
+  80207d:	ff 75 0c             	push   0xc(%ebp)
+  802080:	68 0c 80 80 00       	push   $0x80800c
+  802085:	e8 86 19 00 00       	call   803a10 <memmove>
+	nsipcbuf.send.req_size = size;
+  80208a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802090:	8b 45 14             	mov    0x14(%ebp),%eax
+  802093:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802098:	b8 08 00 00 00       	mov    $0x8,%eax
+  80209d:	e8 e8 fd ff ff       	call   801e8a <nsipc>
+}
+  8020a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a5:	c9                   	leave
+  8020a6:	c3                   	ret
+	assert(size < 1600);
+  8020a7:	68 29 48 80 00       	push   $0x804829
+  8020ac:	68 c1 47 80 00       	push   $0x8047c1
+  8020b1:	6a 6d                	push   $0x6d
+  8020b3:	68 1d 48 80 00       	push   $0x80481d
+  8020b8:	e8 0e 11 00 00       	call   8031cb <_panic>
+
+008020bd <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020bd:	55                   	push   %ebp
+  8020be:	89 e5                	mov    %esp,%ebp
+  8020c0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ce:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020d6:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020db:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020e0:	e8 a5 fd ff ff       	call   801e8a <nsipc>
+}
+  8020e5:	c9                   	leave
+  8020e6:	c3                   	ret
+
+008020e7 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020e7:	55                   	push   %ebp
+  8020e8:	89 e5                	mov    %esp,%ebp
+  8020ea:	53                   	push   %ebx
+  8020eb:	83 ec 10             	sub    $0x10,%esp
+  8020ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020f1:	68 0c 60 80 00       	push   $0x80600c
+  8020f6:	e8 50 07 00 00       	call   80284b <mutex_lock>
+	if (v == 0)
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	85 db                	test   %ebx,%ebx
+  802100:	0f 84 85 00 00 00    	je     80218b <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802106:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80210c:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802111:	77 51                	ja     802164 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802113:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802119:	89 d8                	mov    %ebx,%eax
+  80211b:	c1 e8 0c             	shr    $0xc,%eax
+  80211e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802125:	f6 c4 02             	test   $0x2,%ah
+  802128:	74 50                	je     80217a <free+0x93>
+		sys_page_unmap(0, c);
+  80212a:	83 ec 08             	sub    $0x8,%esp
+  80212d:	53                   	push   %ebx
+  80212e:	6a 00                	push   $0x0
+  802130:	e8 4f e1 ff ff       	call   800284 <sys_page_unmap>
+		c += PGSIZE;
+  802135:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80213b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802149:	76 ce                	jbe    802119 <free+0x32>
+  80214b:	68 73 48 80 00       	push   $0x804873
+  802150:	68 c1 47 80 00       	push   $0x8047c1
+  802155:	68 82 00 00 00       	push   $0x82
+  80215a:	68 66 48 80 00       	push   $0x804866
+  80215f:	e8 67 10 00 00       	call   8031cb <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802164:	68 38 48 80 00       	push   $0x804838
+  802169:	68 c1 47 80 00       	push   $0x8047c1
+  80216e:	6a 7b                	push   $0x7b
+  802170:	68 66 48 80 00       	push   $0x804866
+  802175:	e8 51 10 00 00       	call   8031cb <_panic>
+	if (--(*ref) == 0)
+  80217a:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802180:	83 e8 01             	sub    $0x1,%eax
+  802183:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802189:	74 15                	je     8021a0 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  80218b:	83 ec 0c             	sub    $0xc,%esp
+  80218e:	68 0c 60 80 00       	push   $0x80600c
+  802193:	e8 20 07 00 00       	call   8028b8 <mutex_unlock>
+}
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219e:	c9                   	leave
+  80219f:	c3                   	ret
+		sys_page_unmap(0, c);
+  8021a0:	83 ec 08             	sub    $0x8,%esp
+  8021a3:	53                   	push   %ebx
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	e8 d9 e0 ff ff       	call   800284 <sys_page_unmap>
+  8021ab:	83 c4 10             	add    $0x10,%esp
+  8021ae:	eb db                	jmp    80218b <free+0xa4>
+
+008021b0 <malloc>:
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	57                   	push   %edi
+  8021b4:	56                   	push   %esi
+  8021b5:	53                   	push   %ebx
+  8021b6:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021b9:	68 0c 60 80 00       	push   $0x80600c
+  8021be:	e8 88 06 00 00       	call   80284b <mutex_lock>
+	if (mptr == 0)
+  8021c3:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	85 ff                	test   %edi,%edi
+  8021ce:	74 6c                	je     80223c <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d3:	83 c0 03             	add    $0x3,%eax
+  8021d6:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021d9:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021db:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021e0:	0f 87 64 01 00 00    	ja     80234a <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021e6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021ec:	74 30                	je     80221e <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021ee:	89 f9                	mov    %edi,%ecx
+  8021f0:	c1 e9 0c             	shr    $0xc,%ecx
+  8021f3:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021f7:	c1 e8 0c             	shr    $0xc,%eax
+  8021fa:	39 c1                	cmp    %eax,%ecx
+  8021fc:	74 5f                	je     80225d <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021fe:	83 ec 0c             	sub    $0xc,%esp
+  802201:	57                   	push   %edi
+  802202:	e8 e0 fe ff ff       	call   8020e7 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802207:	a1 10 60 80 00       	mov    0x806010,%eax
+  80220c:	05 00 10 00 00       	add    $0x1000,%eax
+  802211:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802216:	a3 10 60 80 00       	mov    %eax,0x806010
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802224:	ba 02 00 00 00       	mov    $0x2,%edx
+  802229:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80222d:	8d 7e 04             	lea    0x4(%esi),%edi
+  802230:	89 cb                	mov    %ecx,%ebx
+  802232:	01 f9                	add    %edi,%ecx
+  802234:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802237:	e9 8b 00 00 00       	jmp    8022c7 <malloc+0x117>
+		mptr = mbegin;
+  80223c:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802243:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802246:	8b 45 08             	mov    0x8(%ebp),%eax
+  802249:	83 c0 03             	add    $0x3,%eax
+  80224c:	83 e0 fc             	and    $0xfffffffc,%eax
+  80224f:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802251:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802256:	76 c6                	jbe    80221e <malloc+0x6e>
+  802258:	e9 d6 00 00 00       	jmp    802333 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80225d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802263:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802268:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80226c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80226f:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802274:	e9 ba 00 00 00       	jmp    802333 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802279:	05 00 10 00 00       	add    $0x1000,%eax
+  80227e:	39 c8                	cmp    %ecx,%eax
+  802280:	0f 83 cb 00 00 00    	jae    802351 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802286:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80228b:	77 22                	ja     8022af <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80228d:	89 c2                	mov    %eax,%edx
+  80228f:	c1 ea 16             	shr    $0x16,%edx
+  802292:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802299:	f6 c2 01             	test   $0x1,%dl
+  80229c:	74 db                	je     802279 <malloc+0xc9>
+  80229e:	89 c2                	mov    %eax,%edx
+  8022a0:	c1 ea 0c             	shr    $0xc,%edx
+  8022a3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022aa:	f6 c2 01             	test   $0x1,%dl
+  8022ad:	74 ca                	je     802279 <malloc+0xc9>
+		if (mptr == mend) {
+  8022af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022b5:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022bb:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022bf:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022c5:	74 04                	je     8022cb <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022c7:	89 d8                	mov    %ebx,%eax
+  8022c9:	eb b3                	jmp    80227e <malloc+0xce>
+  8022cb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022ce:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022d3:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022d7:	83 ea 01             	sub    $0x1,%edx
+  8022da:	0f 85 50 ff ff ff    	jne    802230 <malloc+0x80>
+  8022e0:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022e7:	00 00 08 
+				return 0;	/* out of address space */
+  8022ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ef:	eb 42                	jmp    802333 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022f1:	85 db                	test   %ebx,%ebx
+  8022f3:	78 1e                	js     802313 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022f5:	83 ec 08             	sub    $0x8,%esp
+  8022f8:	89 d8                	mov    %ebx,%eax
+  8022fa:	03 05 10 60 80 00    	add    0x806010,%eax
+  802300:	50                   	push   %eax
+  802301:	6a 00                	push   $0x0
+  802303:	e8 7c df ff ff       	call   800284 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802308:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	eb de                	jmp    8022f1 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802313:	bf 00 00 00 00       	mov    $0x0,%edi
+  802318:	eb 19                	jmp    802333 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80231a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80231d:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802323:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80232a:	00 
+	mptr += n;
+  80232b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80232e:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	68 0c 60 80 00       	push   $0x80600c
+  80233b:	e8 78 05 00 00       	call   8028b8 <mutex_unlock>
+}
+  802340:	89 f8                	mov    %edi,%eax
+  802342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802345:	5b                   	pop    %ebx
+  802346:	5e                   	pop    %esi
+  802347:	5f                   	pop    %edi
+  802348:	5d                   	pop    %ebp
+  802349:	c3                   	ret
+		return 0;
+  80234a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234f:	eb e2                	jmp    802333 <malloc+0x183>
+  802351:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802355:	74 06                	je     80235d <malloc+0x1ad>
+  802357:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80235d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802362:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802365:	39 fb                	cmp    %edi,%ebx
+  802367:	73 b1                	jae    80231a <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802369:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80236f:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802372:	39 fe                	cmp    %edi,%esi
+  802374:	0f 92 c0             	setb   %al
+  802377:	0f b6 c0             	movzbl %al,%eax
+  80237a:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80237d:	83 c8 07             	or     $0x7,%eax
+  802380:	50                   	push   %eax
+  802381:	89 d8                	mov    %ebx,%eax
+  802383:	03 05 10 60 80 00    	add    0x806010,%eax
+  802389:	50                   	push   %eax
+  80238a:	6a 00                	push   $0x0
+  80238c:	e8 5a de ff ff       	call   8001eb <sys_page_alloc>
+  802391:	83 c4 10             	add    $0x10,%esp
+  802394:	85 c0                	test   %eax,%eax
+  802396:	0f 88 55 ff ff ff    	js     8022f1 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80239c:	89 f3                	mov    %esi,%ebx
+  80239e:	eb c5                	jmp    802365 <malloc+0x1b5>
+
+008023a0 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023a0:	55                   	push   %ebp
+  8023a1:	89 e5                	mov    %esp,%ebp
+  8023a3:	56                   	push   %esi
+  8023a4:	53                   	push   %ebx
+  8023a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	ff 75 08             	push   0x8(%ebp)
+  8023ae:	e8 ea e2 ff ff       	call   80069d <fd2data>
+  8023b3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023b5:	83 c4 08             	add    $0x8,%esp
+  8023b8:	68 8b 48 80 00       	push   $0x80488b
+  8023bd:	53                   	push   %ebx
+  8023be:	e8 c7 14 00 00       	call   80388a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023c3:	8b 46 04             	mov    0x4(%esi),%eax
+  8023c6:	2b 06                	sub    (%esi),%eax
+  8023c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023ce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023d5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023d8:	c7 83 88 00 00 00 9c 	movl   $0x80529c,0x88(%ebx)
+  8023df:	52 80 00 
+	return 0;
+}
+  8023e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5d                   	pop    %ebp
+  8023ed:	c3                   	ret
+
+008023ee <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023f3:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023f7:	85 c9                	test   %ecx,%ecx
+  8023f9:	75 01                	jne    8023fc <pipewake+0xe>
+  8023fb:	c3                   	ret
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802402:	68 00 04 00 00       	push   $0x400
+  802407:	52                   	push   %edx
+  802408:	e8 22 e1 ff ff       	call   80052f <sys_futex_wake>
+  80240d:	83 c4 10             	add    $0x10,%esp
+}
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+
+00802412 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	56                   	push   %esi
+  802416:	53                   	push   %ebx
+  802417:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80241a:	83 ec 0c             	sub    $0xc,%esp
+  80241d:	56                   	push   %esi
+  80241e:	e8 7a e2 ff ff       	call   80069d <fd2data>
+  802423:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802425:	83 c4 08             	add    $0x8,%esp
+  802428:	56                   	push   %esi
+  802429:	6a 00                	push   $0x0
+  80242b:	e8 54 de ff ff       	call   800284 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802430:	8d 53 04             	lea    0x4(%ebx),%edx
+  802433:	8d 43 08             	lea    0x8(%ebx),%eax
+  802436:	e8 b3 ff ff ff       	call   8023ee <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80243b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80243e:	89 da                	mov    %ebx,%edx
+  802440:	e8 a9 ff ff ff       	call   8023ee <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802445:	89 34 24             	mov    %esi,(%esp)
+  802448:	e8 50 e2 ff ff       	call   80069d <fd2data>
+  80244d:	83 c4 08             	add    $0x8,%esp
+  802450:	50                   	push   %eax
+  802451:	6a 00                	push   $0x0
+  802453:	e8 2c de ff ff       	call   800284 <sys_page_unmap>
+}
+  802458:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245b:	5b                   	pop    %ebx
+  80245c:	5e                   	pop    %esi
+  80245d:	5d                   	pop    %ebp
+  80245e:	c3                   	ret
+
+0080245f <_pipeisclosed>:
+{
+  80245f:	55                   	push   %ebp
+  802460:	89 e5                	mov    %esp,%ebp
+  802462:	57                   	push   %edi
+  802463:	56                   	push   %esi
+  802464:	53                   	push   %ebx
+  802465:	83 ec 1c             	sub    $0x1c,%esp
+  802468:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80246b:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80246d:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802472:	eb 5d                	jmp    8024d1 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802474:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  80247a:	8b 02                	mov    (%edx),%eax
+  80247c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80247f:	83 ec 0c             	sub    $0xc,%esp
+  802482:	ff 75 e0             	push   -0x20(%ebp)
+  802485:	e8 45 1f 00 00       	call   8043cf <pageref>
+  80248a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80248d:	89 3c 24             	mov    %edi,(%esp)
+  802490:	e8 3a 1f 00 00       	call   8043cf <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802495:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802497:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8024a6:	77 15                	ja     8024bd <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024a8:	89 f2                	mov    %esi,%edx
+  8024aa:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8024ac:	c1 ea 10             	shr    $0x10,%edx
+  8024af:	74 0c                	je     8024bd <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024b1:	c1 e2 10             	shl    $0x10,%edx
+  8024b4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024b9:	29 d1                	sub    %edx,%ecx
+  8024bb:	eb 06                	jmp    8024c3 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024bd:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024c3:	8b 11                	mov    (%ecx),%edx
+  8024c5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024c8:	39 d3                	cmp    %edx,%ebx
+  8024ca:	74 6e                	je     80253a <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024cc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024cf:	74 24                	je     8024f5 <_pipeisclosed+0x96>
+  8024d1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024d3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024d9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024de:	77 94                	ja     802474 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024e0:	89 f0                	mov    %esi,%eax
+  8024e2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024e4:	c1 e8 10             	shr    $0x10,%eax
+  8024e7:	74 8b                	je     802474 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024e9:	c1 e0 10             	shl    $0x10,%eax
+  8024ec:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024f1:	29 c2                	sub    %eax,%edx
+  8024f3:	eb 85                	jmp    80247a <_pipeisclosed+0x1b>
+  8024f5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024f7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024fd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802502:	77 18                	ja     80251c <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802504:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802509:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80250b:	c1 e8 10             	shr    $0x10,%eax
+  80250e:	74 0c                	je     80251c <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802510:	c1 e0 10             	shl    $0x10,%eax
+  802513:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802518:	29 c2                	sub    %eax,%edx
+  80251a:	eb 06                	jmp    802522 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80251c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802522:	8b 02                	mov    (%edx),%eax
+  802524:	8b 40 58             	mov    0x58(%eax),%eax
+  802527:	6a 01                	push   $0x1
+  802529:	50                   	push   %eax
+  80252a:	53                   	push   %ebx
+  80252b:	68 92 48 80 00       	push   $0x804892
+  802530:	e8 71 0d 00 00       	call   8032a6 <cprintf>
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	eb 97                	jmp    8024d1 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80253a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80253d:	0f 94 c0             	sete   %al
+  802540:	0f b6 c0             	movzbl %al,%eax
+}
+  802543:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802546:	5b                   	pop    %ebx
+  802547:	5e                   	pop    %esi
+  802548:	5f                   	pop    %edi
+  802549:	5d                   	pop    %ebp
+  80254a:	c3                   	ret
+
+0080254b <devpipe_write>:
+{
+  80254b:	55                   	push   %ebp
+  80254c:	89 e5                	mov    %esp,%ebp
+  80254e:	57                   	push   %edi
+  80254f:	56                   	push   %esi
+  802550:	53                   	push   %ebx
+  802551:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802554:	ff 75 08             	push   0x8(%ebp)
+  802557:	e8 41 e1 ff ff       	call   80069d <fd2data>
+  80255c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80255e:	83 c4 10             	add    $0x10,%esp
+  802561:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802568:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80256b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80256e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802571:	0f 84 96 00 00 00    	je     80260d <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802577:	8d 73 08             	lea    0x8(%ebx),%esi
+  80257a:	eb 32                	jmp    8025ae <devpipe_write+0x63>
+  80257c:	89 fa                	mov    %edi,%edx
+  80257e:	89 f0                	mov    %esi,%eax
+  802580:	e8 69 fe ff ff       	call   8023ee <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802585:	8b 43 04             	mov    0x4(%ebx),%eax
+  802588:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80258b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802590:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802595:	83 ec 04             	sub    $0x4,%esp
+  802598:	6a 0a                	push   $0xa
+  80259a:	50                   	push   %eax
+  80259b:	53                   	push   %ebx
+  80259c:	e8 5f df ff ff       	call   800500 <sys_futex_wait>
+  8025a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025a6:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8025ab:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025ae:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025b1:	8b 0b                	mov    (%ebx),%ecx
+  8025b3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025b6:	39 d0                	cmp    %edx,%eax
+  8025b8:	72 1b                	jb     8025d5 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025ba:	89 da                	mov    %ebx,%edx
+  8025bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025bf:	e8 9b fe ff ff       	call   80245f <_pipeisclosed>
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	74 b4                	je     80257c <devpipe_write+0x31>
+				return 0;
+  8025c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d0:	5b                   	pop    %ebx
+  8025d1:	5e                   	pop    %esi
+  8025d2:	5f                   	pop    %edi
+  8025d3:	5d                   	pop    %ebp
+  8025d4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025db:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025df:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025e2:	89 c2                	mov    %eax,%edx
+  8025e4:	c1 fa 1f             	sar    $0x1f,%edx
+  8025e7:	89 d1                	mov    %edx,%ecx
+  8025e9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025ec:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025ef:	83 e2 1f             	and    $0x1f,%edx
+  8025f2:	29 ca                	sub    %ecx,%edx
+  8025f4:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025f8:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025fc:	83 c0 01             	add    $0x1,%eax
+  8025ff:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802602:	83 c6 01             	add    $0x1,%esi
+  802605:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802608:	e9 5e ff ff ff       	jmp    80256b <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80260d:	8d 53 04             	lea    0x4(%ebx),%edx
+  802610:	8d 43 08             	lea    0x8(%ebx),%eax
+  802613:	e8 d6 fd ff ff       	call   8023ee <pipewake>
+	return i;
+  802618:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80261b:	eb b0                	jmp    8025cd <devpipe_write+0x82>
+
+0080261d <devpipe_read>:
+{
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	57                   	push   %edi
+  802621:	56                   	push   %esi
+  802622:	53                   	push   %ebx
+  802623:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802626:	ff 75 08             	push   0x8(%ebp)
+  802629:	e8 6f e0 ff ff       	call   80069d <fd2data>
+  80262e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802630:	83 c4 10             	add    $0x10,%esp
+  802633:	be 00 00 00 00       	mov    $0x0,%esi
+  802638:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80263b:	74 6c                	je     8026a9 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80263d:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802640:	eb 25                	jmp    802667 <devpipe_read+0x4a>
+  802642:	8b 13                	mov    (%ebx),%edx
+  802644:	b8 01 00 00 00       	mov    $0x1,%eax
+  802649:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80264e:	83 ec 04             	sub    $0x4,%esp
+  802651:	6a 0a                	push   $0xa
+  802653:	52                   	push   %edx
+  802654:	57                   	push   %edi
+  802655:	e8 a6 de ff ff       	call   800500 <sys_futex_wait>
+  80265a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80265f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802664:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802667:	8b 03                	mov    (%ebx),%eax
+  802669:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80266c:	75 19                	jne    802687 <devpipe_read+0x6a>
+			if (i > 0)
+  80266e:	85 f6                	test   %esi,%esi
+  802670:	75 3a                	jne    8026ac <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  802672:	89 da                	mov    %ebx,%edx
+  802674:	8b 45 08             	mov    0x8(%ebp),%eax
+  802677:	e8 e3 fd ff ff       	call   80245f <_pipeisclosed>
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	74 c2                	je     802642 <devpipe_read+0x25>
+				return 0;
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+  802685:	eb 31                	jmp    8026b8 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802687:	89 c1                	mov    %eax,%ecx
+  802689:	c1 f9 1f             	sar    $0x1f,%ecx
+  80268c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80268f:	01 c8                	add    %ecx,%eax
+  802691:	83 e0 1f             	and    $0x1f,%eax
+  802694:	29 c8                	sub    %ecx,%eax
+  802696:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80269b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80269e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026a1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026a4:	83 c6 01             	add    $0x1,%esi
+  8026a7:	eb 8f                	jmp    802638 <devpipe_read+0x1b>
+out:
+  8026a9:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8026ac:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8026af:	89 da                	mov    %ebx,%edx
+  8026b1:	e8 38 fd ff ff       	call   8023ee <pipewake>
+	return i;
+  8026b6:	89 f0                	mov    %esi,%eax
+}
+  8026b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026bb:	5b                   	pop    %ebx
+  8026bc:	5e                   	pop    %esi
+  8026bd:	5f                   	pop    %edi
+  8026be:	5d                   	pop    %ebp
+  8026bf:	c3                   	ret
+
+008026c0 <pipe>:
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	56                   	push   %esi
+  8026c4:	53                   	push   %ebx
+  8026c5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026cb:	50                   	push   %eax
+  8026cc:	e8 e3 df ff ff       	call   8006b4 <fd_alloc>
+  8026d1:	89 c3                	mov    %eax,%ebx
+  8026d3:	83 c4 10             	add    $0x10,%esp
+  8026d6:	85 c0                	test   %eax,%eax
+  8026d8:	0f 88 23 01 00 00    	js     802801 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026de:	83 ec 04             	sub    $0x4,%esp
+  8026e1:	68 07 04 00 00       	push   $0x407
+  8026e6:	ff 75 f4             	push   -0xc(%ebp)
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	e8 fb da ff ff       	call   8001eb <sys_page_alloc>
+  8026f0:	89 c3                	mov    %eax,%ebx
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	0f 88 04 01 00 00    	js     802801 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026fd:	83 ec 0c             	sub    $0xc,%esp
+  802700:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802703:	50                   	push   %eax
+  802704:	e8 ab df ff ff       	call   8006b4 <fd_alloc>
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	0f 88 db 00 00 00    	js     8027f1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802716:	83 ec 04             	sub    $0x4,%esp
+  802719:	68 07 04 00 00       	push   $0x407
+  80271e:	ff 75 f0             	push   -0x10(%ebp)
+  802721:	6a 00                	push   $0x0
+  802723:	e8 c3 da ff ff       	call   8001eb <sys_page_alloc>
+  802728:	89 c3                	mov    %eax,%ebx
+  80272a:	83 c4 10             	add    $0x10,%esp
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	0f 88 bc 00 00 00    	js     8027f1 <pipe+0x131>
+	va = fd2data(fd0);
+  802735:	83 ec 0c             	sub    $0xc,%esp
+  802738:	ff 75 f4             	push   -0xc(%ebp)
+  80273b:	e8 5d df ff ff       	call   80069d <fd2data>
+  802740:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802742:	83 c4 0c             	add    $0xc,%esp
+  802745:	68 07 04 00 00       	push   $0x407
+  80274a:	50                   	push   %eax
+  80274b:	6a 00                	push   $0x0
+  80274d:	e8 99 da ff ff       	call   8001eb <sys_page_alloc>
+  802752:	89 c3                	mov    %eax,%ebx
+  802754:	83 c4 10             	add    $0x10,%esp
+  802757:	85 c0                	test   %eax,%eax
+  802759:	0f 88 82 00 00 00    	js     8027e1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80275f:	83 ec 0c             	sub    $0xc,%esp
+  802762:	ff 75 f0             	push   -0x10(%ebp)
+  802765:	e8 33 df ff ff       	call   80069d <fd2data>
+  80276a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802771:	50                   	push   %eax
+  802772:	6a 00                	push   $0x0
+  802774:	56                   	push   %esi
+  802775:	6a 00                	push   $0x0
+  802777:	e8 bc da ff ff       	call   800238 <sys_page_map>
+  80277c:	89 c3                	mov    %eax,%ebx
+  80277e:	83 c4 20             	add    $0x20,%esp
+  802781:	85 c0                	test   %eax,%eax
+  802783:	78 4e                	js     8027d3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802785:	a1 9c 52 80 00       	mov    0x80529c,%eax
+  80278a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80278d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80278f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802792:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802799:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80279c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80279e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027a1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027a8:	83 ec 0c             	sub    $0xc,%esp
+  8027ab:	ff 75 f4             	push   -0xc(%ebp)
+  8027ae:	e8 da de ff ff       	call   80068d <fd2num>
+  8027b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027b8:	83 c4 04             	add    $0x4,%esp
+  8027bb:	ff 75 f0             	push   -0x10(%ebp)
+  8027be:	e8 ca de ff ff       	call   80068d <fd2num>
+  8027c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027c6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027d1:	eb 2e                	jmp    802801 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027d3:	83 ec 08             	sub    $0x8,%esp
+  8027d6:	56                   	push   %esi
+  8027d7:	6a 00                	push   $0x0
+  8027d9:	e8 a6 da ff ff       	call   800284 <sys_page_unmap>
+  8027de:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027e1:	83 ec 08             	sub    $0x8,%esp
+  8027e4:	ff 75 f0             	push   -0x10(%ebp)
+  8027e7:	6a 00                	push   $0x0
+  8027e9:	e8 96 da ff ff       	call   800284 <sys_page_unmap>
+  8027ee:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027f1:	83 ec 08             	sub    $0x8,%esp
+  8027f4:	ff 75 f4             	push   -0xc(%ebp)
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	e8 86 da ff ff       	call   800284 <sys_page_unmap>
+  8027fe:	83 c4 10             	add    $0x10,%esp
+}
+  802801:	89 d8                	mov    %ebx,%eax
+  802803:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802806:	5b                   	pop    %ebx
+  802807:	5e                   	pop    %esi
+  802808:	5d                   	pop    %ebp
+  802809:	c3                   	ret
+
+0080280a <pipeisclosed>:
+{
+  80280a:	55                   	push   %ebp
+  80280b:	89 e5                	mov    %esp,%ebp
+  80280d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802810:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802813:	50                   	push   %eax
+  802814:	ff 75 08             	push   0x8(%ebp)
+  802817:	e8 ee de ff ff       	call   80070a <fd_lookup>
+  80281c:	83 c4 10             	add    $0x10,%esp
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	78 18                	js     80283b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802823:	83 ec 0c             	sub    $0xc,%esp
+  802826:	ff 75 f4             	push   -0xc(%ebp)
+  802829:	e8 6f de ff ff       	call   80069d <fd2data>
+  80282e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802830:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802833:	e8 27 fc ff ff       	call   80245f <_pipeisclosed>
+  802838:	83 c4 10             	add    $0x10,%esp
+}
+  80283b:	c9                   	leave
+  80283c:	c3                   	ret
+
+0080283d <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802840:	8b 45 08             	mov    0x8(%ebp),%eax
+  802843:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802849:	5d                   	pop    %ebp
+  80284a:	c3                   	ret
+
+0080284b <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80284b:	55                   	push   %ebp
+  80284c:	89 e5                	mov    %esp,%ebp
+  80284e:	56                   	push   %esi
+  80284f:	53                   	push   %ebx
+  802850:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802853:	ba 00 00 00 00       	mov    $0x0,%edx
+  802858:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80285d:	89 d0                	mov    %edx,%eax
+  80285f:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  802863:	85 c0                	test   %eax,%eax
+  802865:	74 2d                	je     802894 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802867:	83 f8 02             	cmp    $0x2,%eax
+  80286a:	74 08                	je     802874 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80286c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802871:	f0 87 03             	lock xchg %eax,(%ebx)
+  802874:	be 02 00 00 00       	mov    $0x2,%esi
+  802879:	eb 15                	jmp    802890 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	6a 00                	push   $0x0
+  802880:	6a 02                	push   $0x2
+  802882:	53                   	push   %ebx
+  802883:	e8 78 dc ff ff       	call   800500 <sys_futex_wait>
+  802888:	89 f0                	mov    %esi,%eax
+  80288a:	f0 87 03             	lock xchg %eax,(%ebx)
+  80288d:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802890:	85 c0                	test   %eax,%eax
+  802892:	75 e7                	jne    80287b <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  802894:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802897:	5b                   	pop    %ebx
+  802898:	5e                   	pop    %esi
+  802899:	5d                   	pop    %ebp
+  80289a:	c3                   	ret
+
+0080289b <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80289b:	55                   	push   %ebp
+  80289c:	89 e5                	mov    %esp,%ebp
+  80289e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8028a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028ab:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8028af:	f7 d8                	neg    %eax
+  8028b1:	19 c0                	sbb    %eax,%eax
+  8028b3:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028b6:	5d                   	pop    %ebp
+  8028b7:	c3                   	ret
+
+008028b8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028b8:	55                   	push   %ebp
+  8028b9:	89 e5                	mov    %esp,%ebp
+  8028bb:	83 ec 08             	sub    $0x8,%esp
+  8028be:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028c9:	83 f8 02             	cmp    $0x2,%eax
+  8028cc:	74 02                	je     8028d0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028ce:	c9                   	leave
+  8028cf:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028d0:	83 ec 08             	sub    $0x8,%esp
+  8028d3:	6a 01                	push   $0x1
+  8028d5:	52                   	push   %edx
+  8028d6:	e8 54 dc ff ff       	call   80052f <sys_futex_wake>
+  8028db:	83 c4 10             	add    $0x10,%esp
+}
+  8028de:	eb ee                	jmp    8028ce <mutex_unlock+0x16>
+
+008028e0 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028ec:	5d                   	pop    %ebp
+  8028ed:	c3                   	ret
+
+008028ee <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	57                   	push   %edi
+  8028f2:	56                   	push   %esi
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 18             	sub    $0x18,%esp
+  8028f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028fd:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028ff:	53                   	push   %ebx
+  802900:	e8 b3 ff ff ff       	call   8028b8 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  802905:	83 c4 0c             	add    $0xc,%esp
+  802908:	ff 75 10             	push   0x10(%ebp)
+  80290b:	57                   	push   %edi
+  80290c:	56                   	push   %esi
+  80290d:	e8 ee db ff ff       	call   800500 <sys_futex_wait>
+  802912:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802914:	83 c4 10             	add    $0x10,%esp
+  802917:	be 02 00 00 00       	mov    $0x2,%esi
+  80291c:	eb 10                	jmp    80292e <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80291e:	83 ec 04             	sub    $0x4,%esp
+  802921:	6a 00                	push   $0x0
+  802923:	6a 02                	push   $0x2
+  802925:	53                   	push   %ebx
+  802926:	e8 d5 db ff ff       	call   800500 <sys_futex_wait>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	89 f0                	mov    %esi,%eax
+  802930:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  802933:	85 c0                	test   %eax,%eax
+  802935:	75 e7                	jne    80291e <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802937:	83 ff ec             	cmp    $0xffffffec,%edi
+  80293a:	74 05                	je     802941 <cond_timedwait+0x53>
+  80293c:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802941:	89 f8                	mov    %edi,%eax
+  802943:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802946:	5b                   	pop    %ebx
+  802947:	5e                   	pop    %esi
+  802948:	5f                   	pop    %edi
+  802949:	5d                   	pop    %ebp
+  80294a:	c3                   	ret
+
+0080294b <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802951:	6a 00                	push   $0x0
+  802953:	ff 75 0c             	push   0xc(%ebp)
+  802956:	ff 75 08             	push   0x8(%ebp)
+  802959:	e8 90 ff ff ff       	call   8028ee <cond_timedwait>
+}
+  80295e:	83 c4 10             	add    $0x10,%esp
+  802961:	c9                   	leave
+  802962:	c3                   	ret
+
+00802963 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  802963:	55                   	push   %ebp
+  802964:	89 e5                	mov    %esp,%ebp
+  802966:	83 ec 10             	sub    $0x10,%esp
+  802969:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80296c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802971:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  802975:	6a 01                	push   $0x1
+  802977:	50                   	push   %eax
+  802978:	e8 b2 db ff ff       	call   80052f <sys_futex_wake>
+}
+  80297d:	83 c4 10             	add    $0x10,%esp
+  802980:	c9                   	leave
+  802981:	c3                   	ret
+
+00802982 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802982:	55                   	push   %ebp
+  802983:	89 e5                	mov    %esp,%ebp
+  802985:	83 ec 10             	sub    $0x10,%esp
+  802988:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802990:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  802994:	68 00 04 00 00       	push   $0x400
+  802999:	50                   	push   %eax
+  80299a:	e8 90 db ff ff       	call   80052f <sys_futex_wake>
+}
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	c9                   	leave
+  8029a3:	c3                   	ret
+
+008029a4 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8029a4:	55                   	push   %ebp
+  8029a5:	89 e5                	mov    %esp,%ebp
+  8029a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8029aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ad:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8029af:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029b6:	5d                   	pop    %ebp
+  8029b7:	c3                   	ret
+
+008029b8 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029b8:	55                   	push   %ebp
+  8029b9:	89 e5                	mov    %esp,%ebp
+  8029bb:	53                   	push   %ebx
+  8029bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029bf:	8b 11                	mov    (%ecx),%edx
+  8029c1:	85 d2                	test   %edx,%edx
+  8029c3:	74 14                	je     8029d9 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029c5:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029c8:	89 d0                	mov    %edx,%eax
+  8029ca:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029ce:	39 c2                	cmp    %eax,%edx
+  8029d0:	75 ed                	jne    8029bf <sem_trywait+0x7>
+			return 0;
+  8029d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d7:	eb 05                	jmp    8029de <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029d9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+008029e3 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	57                   	push   %edi
+  8029e7:	56                   	push   %esi
+  8029e8:	53                   	push   %ebx
+  8029e9:	83 ec 1c             	sub    $0x1c,%esp
+  8029ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029f2:	e8 81 da ff ff       	call   800478 <sys_time_msec>
+  8029f7:	01 f8                	add    %edi,%eax
+  8029f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029fc:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  802a01:	eb 28                	jmp    802a2b <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  802a03:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a08:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	56                   	push   %esi
+  802a11:	6a 00                	push   $0x0
+  802a13:	53                   	push   %ebx
+  802a14:	e8 e7 da ff ff       	call   800500 <sys_futex_wait>
+  802a19:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a1e:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a23:	83 c4 10             	add    $0x10,%esp
+  802a26:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a29:	74 2e                	je     802a59 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a2b:	83 ec 0c             	sub    $0xc,%esp
+  802a2e:	53                   	push   %ebx
+  802a2f:	e8 84 ff ff ff       	call   8029b8 <sem_trywait>
+  802a34:	83 c4 10             	add    $0x10,%esp
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	79 19                	jns    802a54 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a3b:	85 ff                	test   %edi,%edi
+  802a3d:	74 c4                	je     802a03 <sem_timedwait+0x20>
+  802a3f:	e8 34 da ff ff       	call   800478 <sys_time_msec>
+  802a44:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a47:	29 c6                	sub    %eax,%esi
+  802a49:	85 f6                	test   %esi,%esi
+  802a4b:	7f b6                	jg     802a03 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a4d:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a52:	eb 05                	jmp    802a59 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a5c:	5b                   	pop    %ebx
+  802a5d:	5e                   	pop    %esi
+  802a5e:	5f                   	pop    %edi
+  802a5f:	5d                   	pop    %ebp
+  802a60:	c3                   	ret
+
+00802a61 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+  802a64:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a67:	6a 00                	push   $0x0
+  802a69:	ff 75 08             	push   0x8(%ebp)
+  802a6c:	e8 72 ff ff ff       	call   8029e3 <sem_timedwait>
+}
+  802a71:	83 c4 10             	add    $0x10,%esp
+  802a74:	c9                   	leave
+  802a75:	c3                   	ret
+
+00802a76 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a76:	55                   	push   %ebp
+  802a77:	89 e5                	mov    %esp,%ebp
+  802a79:	83 ec 08             	sub    $0x8,%esp
+  802a7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a84:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a88:	8b 50 04             	mov    0x4(%eax),%edx
+  802a8b:	85 d2                	test   %edx,%edx
+  802a8d:	75 02                	jne    802a91 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a8f:	c9                   	leave
+  802a90:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a91:	83 ec 08             	sub    $0x8,%esp
+  802a94:	6a 01                	push   $0x1
+  802a96:	50                   	push   %eax
+  802a97:	e8 93 da ff ff       	call   80052f <sys_futex_wake>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+}
+  802a9f:	eb ee                	jmp    802a8f <sem_post+0x19>
+
+00802aa1 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802aa1:	55                   	push   %ebp
+  802aa2:	89 e5                	mov    %esp,%ebp
+  802aa4:	57                   	push   %edi
+  802aa5:	56                   	push   %esi
+  802aa6:	53                   	push   %ebx
+  802aa7:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802aaa:	68 20 60 80 00       	push   $0x806020
+  802aaf:	e8 97 fd ff ff       	call   80284b <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802ab4:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ab9:	83 c4 10             	add    $0x10,%esp
+  802abc:	85 c0                	test   %eax,%eax
+  802abe:	75 19                	jne    802ad9 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802ac0:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802ac5:	8b 00                	mov    (%eax),%eax
+  802ac7:	8b 40 48             	mov    0x48(%eax),%eax
+  802aca:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802acf:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802ad6:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ad9:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ade:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ae1:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ae8:	8b 40 04             	mov    0x4(%eax),%eax
+  802aeb:	85 c0                	test   %eax,%eax
+  802aed:	0f 84 e4 00 00 00    	je     802bd7 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802af3:	83 c3 01             	add    $0x1,%ebx
+  802af6:	83 fb 20             	cmp    $0x20,%ebx
+  802af9:	75 e3                	jne    802ade <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802afb:	83 ec 0c             	sub    $0xc,%esp
+  802afe:	68 20 60 80 00       	push   $0x806020
+  802b03:	e8 b0 fd ff ff       	call   8028b8 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802b08:	83 c4 10             	add    $0x10,%esp
+  802b0b:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b10:	e9 b8 00 00 00       	jmp    802bcd <pthread_create+0x12c>
+  802b15:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b18:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b1b:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b1d:	39 f3                	cmp    %esi,%ebx
+  802b1f:	73 16                	jae    802b37 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b21:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b27:	83 ec 08             	sub    $0x8,%esp
+  802b2a:	56                   	push   %esi
+  802b2b:	6a 00                	push   $0x0
+  802b2d:	e8 52 d7 ff ff       	call   800284 <sys_page_unmap>
+  802b32:	83 c4 10             	add    $0x10,%esp
+  802b35:	eb e6                	jmp    802b1d <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b37:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b3a:	83 ec 08             	sub    $0x8,%esp
+  802b3d:	ff 75 e4             	push   -0x1c(%ebp)
+  802b40:	6a 00                	push   $0x0
+  802b42:	e8 3d d7 ff ff       	call   800284 <sys_page_unmap>
+	return r;
+  802b47:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b4a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b4d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b54:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b5b:	eb 70                	jmp    802bcd <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b5d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b60:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b6a:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b70:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b73:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b7a:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b7f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b82:	29 c8                	sub    %ecx,%eax
+  802b84:	85 db                	test   %ebx,%ebx
+  802b86:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b8d:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b90:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b97:	83 ec 04             	sub    $0x4,%esp
+  802b9a:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b9f:	29 ca                	sub    %ecx,%edx
+  802ba1:	52                   	push   %edx
+	*--esp = 0;
+  802ba2:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802ba5:	50                   	push   %eax
+  802ba6:	68 fe 2d 80 00       	push   $0x802dfe
+  802bab:	e8 24 da ff ff       	call   8005d4 <sys_thread_create>
+  802bb0:	89 c7                	mov    %eax,%edi
+  802bb2:	83 c4 10             	add    $0x10,%esp
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 91                	js     802b4a <pthread_create+0xa9>
+	th->th_env = id;
+  802bb9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bbc:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc6:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bc8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bcd:	89 f8                	mov    %edi,%eax
+  802bcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd2:	5b                   	pop    %ebx
+  802bd3:	5e                   	pop    %esi
+  802bd4:	5f                   	pop    %edi
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bd7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bda:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802be1:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802be8:	83 ec 0c             	sub    $0xc,%esp
+  802beb:	68 20 60 80 00       	push   $0x806020
+  802bf0:	e8 c3 fc ff ff       	call   8028b8 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802bf5:	89 d9                	mov    %ebx,%ecx
+  802bf7:	c1 e1 10             	shl    $0x10,%ecx
+  802bfa:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802bfd:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802c02:	29 c8                	sub    %ecx,%eax
+  802c04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802c07:	c1 e8 16             	shr    $0x16,%eax
+  802c0a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c11:	83 c4 10             	add    $0x10,%esp
+  802c14:	a8 01                	test   $0x1,%al
+  802c16:	74 15                	je     802c2d <pthread_create+0x18c>
+  802c18:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c1b:	c1 e8 0c             	shr    $0xc,%eax
+  802c1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c25:	a8 01                	test   $0x1,%al
+  802c27:	0f 85 30 ff ff ff    	jne    802b5d <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c2d:	83 ec 04             	sub    $0x4,%esp
+  802c30:	6a 07                	push   $0x7
+  802c32:	ff 75 e4             	push   -0x1c(%ebp)
+  802c35:	6a 00                	push   $0x0
+  802c37:	e8 af d5 ff ff       	call   8001eb <sys_page_alloc>
+  802c3c:	89 c7                	mov    %eax,%edi
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	0f 88 01 ff ff ff    	js     802b4a <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c49:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c4e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c51:	29 d0                	sub    %edx,%eax
+  802c53:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c56:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c58:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c5d:	29 d0                	sub    %edx,%eax
+  802c5f:	89 c7                	mov    %eax,%edi
+  802c61:	39 fe                	cmp    %edi,%esi
+  802c63:	0f 83 f4 fe ff ff    	jae    802b5d <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c69:	83 ec 04             	sub    $0x4,%esp
+  802c6c:	6a 07                	push   $0x7
+  802c6e:	56                   	push   %esi
+  802c6f:	6a 00                	push   $0x0
+  802c71:	e8 75 d5 ff ff       	call   8001eb <sys_page_alloc>
+  802c76:	83 c4 10             	add    $0x10,%esp
+  802c79:	85 c0                	test   %eax,%eax
+  802c7b:	0f 88 94 fe ff ff    	js     802b15 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c81:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c87:	eb d8                	jmp    802c61 <pthread_create+0x1c0>
+
+00802c89 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	57                   	push   %edi
+  802c8d:	56                   	push   %esi
+  802c8e:	53                   	push   %ebx
+  802c8f:	83 ec 0c             	sub    $0xc,%esp
+  802c92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c95:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c98:	83 f8 1e             	cmp    $0x1e,%eax
+  802c9b:	0f 87 c7 00 00 00    	ja     802d68 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802ca1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ca3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ca9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802cae:	77 12                	ja     802cc2 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802cb0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802cb5:	29 d0                	sub    %edx,%eax
+  802cb7:	c1 e8 10             	shr    $0x10,%eax
+  802cba:	39 c3                	cmp    %eax,%ebx
+  802cbc:	0f 84 ad 00 00 00    	je     802d6f <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cc2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cc5:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ccc:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cd3:	eb 10                	jmp    802ce5 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cd5:	83 ec 04             	sub    $0x4,%esp
+  802cd8:	6a 00                	push   $0x0
+  802cda:	6a 01                	push   $0x1
+  802cdc:	57                   	push   %edi
+  802cdd:	e8 1e d8 ff ff       	call   800500 <sys_futex_wait>
+  802ce2:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ce5:	8b 46 04             	mov    0x4(%esi),%eax
+  802ce8:	83 f8 01             	cmp    $0x1,%eax
+  802ceb:	74 e8                	je     802cd5 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802ced:	83 f8 02             	cmp    $0x2,%eax
+  802cf0:	0f 85 80 00 00 00    	jne    802d76 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cf6:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802cf9:	c1 e6 02             	shl    $0x2,%esi
+  802cfc:	eb 05                	jmp    802d03 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802cfe:	e8 bc d4 ff ff       	call   8001bf <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802d03:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802d09:	89 ca                	mov    %ecx,%edx
+  802d0b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d11:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d14:	c1 e0 04             	shl    $0x4,%eax
+  802d17:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d1c:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d1f:	39 c1                	cmp    %eax,%ecx
+  802d21:	75 12                	jne    802d35 <pthread_join+0xac>
+  802d23:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d26:	c1 e0 04             	shl    $0x4,%eax
+  802d29:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d2e:	8b 40 54             	mov    0x54(%eax),%eax
+  802d31:	85 c0                	test   %eax,%eax
+  802d33:	75 c9                	jne    802cfe <pthread_join+0x75>
+	if (ret_store)
+  802d35:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d39:	74 0f                	je     802d4a <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d3b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d3e:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d48:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d4a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d4d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d54:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+		return -E_INVAL;
+  802d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6d:	eb f1                	jmp    802d60 <pthread_join+0xd7>
+  802d6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d74:	eb ea                	jmp    802d60 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d7b:	eb e3                	jmp    802d60 <pthread_join+0xd7>
+
+00802d7d <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d7d:	55                   	push   %ebp
+  802d7e:	89 e5                	mov    %esp,%ebp
+  802d80:	53                   	push   %ebx
+  802d81:	83 ec 04             	sub    $0x4,%esp
+  802d84:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d86:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d8c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d91:	77 0c                	ja     802d9f <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d93:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d98:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d9a:	c1 e8 10             	shr    $0x10,%eax
+  802d9d:	75 0a                	jne    802da9 <pthread_exit+0x2c>
+		exit();
+  802d9f:	e8 25 d3 ff ff       	call   8000c9 <exit>
+  802da4:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802da9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802db0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802db3:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802dba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dbd:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802dc0:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802dc7:	83 ec 08             	sub    $0x8,%esp
+  802dca:	6a 20                	push   $0x20
+  802dcc:	01 c2                	add    %eax,%edx
+  802dce:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dd5:	50                   	push   %eax
+  802dd6:	e8 54 d7 ff ff       	call   80052f <sys_futex_wake>
+	sys_env_destroy(0);
+  802ddb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802de2:	e8 61 d3 ff ff       	call   800148 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802de7:	83 c4 0c             	add    $0xc,%esp
+  802dea:	68 aa 48 80 00       	push   $0x8048aa
+  802def:	68 a5 00 00 00       	push   $0xa5
+  802df4:	68 c4 48 80 00       	push   $0x8048c4
+  802df9:	e8 cd 03 00 00       	call   8031cb <_panic>
+
+00802dfe <pthread_start>:
+{
+  802dfe:	55                   	push   %ebp
+  802dff:	89 e5                	mov    %esp,%ebp
+  802e01:	53                   	push   %ebx
+  802e02:	83 ec 04             	sub    $0x4,%esp
+  802e05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802e08:	e8 86 d3 ff ff       	call   800193 <sys_getenvid>
+  802e0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e12:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e18:	85 db                	test   %ebx,%ebx
+  802e1a:	74 0c                	je     802e28 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e1c:	89 d9                	mov    %ebx,%ecx
+  802e1e:	c1 e1 10             	shl    $0x10,%ecx
+  802e21:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e26:	29 ca                	sub    %ecx,%edx
+  802e28:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e2b:	c1 e0 04             	shl    $0x4,%eax
+  802e2e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e33:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e35:	83 ec 0c             	sub    $0xc,%esp
+  802e38:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e3f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e42:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e49:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e50:	89 04 24             	mov    %eax,(%esp)
+  802e53:	e8 25 ff ff ff       	call   802d7d <pthread_exit>
+
+00802e58 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e58:	55                   	push   %ebp
+  802e59:	89 e5                	mov    %esp,%ebp
+  802e5b:	57                   	push   %edi
+  802e5c:	56                   	push   %esi
+  802e5d:	53                   	push   %ebx
+  802e5e:	83 ec 1c             	sub    $0x1c,%esp
+  802e61:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e63:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e69:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e70:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e75:	77 0d                	ja     802e84 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e77:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e7c:	29 d0                	sub    %edx,%eax
+  802e7e:	c1 e8 10             	shr    $0x10,%eax
+  802e81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e89:	eb 2f                	jmp    802eba <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e8b:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e91:	8b 01                	mov    (%ecx),%eax
+  802e93:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e96:	39 c2                	cmp    %eax,%edx
+  802e98:	75 14                	jne    802eae <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e9a:	83 ec 0c             	sub    $0xc,%esp
+  802e9d:	57                   	push   %edi
+  802e9e:	e8 a5 d2 ff ff       	call   800148 <sys_env_destroy>
+  802ea3:	83 c4 10             	add    $0x10,%esp
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	0f 88 97 00 00 00    	js     802f45 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802eae:	83 c3 01             	add    $0x1,%ebx
+  802eb1:	83 fb 20             	cmp    $0x20,%ebx
+  802eb4:	0f 84 d2 00 00 00    	je     802f8c <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802eba:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ebd:	74 ef                	je     802eae <pthread_kill_others+0x56>
+  802ebf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ec2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ec9:	8b 40 04             	mov    0x4(%eax),%eax
+  802ecc:	83 f8 01             	cmp    $0x1,%eax
+  802ecf:	75 dd                	jne    802eae <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802ed1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ed4:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802edb:	89 fe                	mov    %edi,%esi
+  802edd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ee3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ee6:	c1 e0 04             	shl    $0x4,%eax
+  802ee9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eee:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ef1:	39 c7                	cmp    %eax,%edi
+  802ef3:	75 b9                	jne    802eae <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ef5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef8:	c1 e0 04             	shl    $0x4,%eax
+  802efb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f00:	8b 40 54             	mov    0x54(%eax),%eax
+  802f03:	85 c0                	test   %eax,%eax
+  802f05:	74 a7                	je     802eae <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f07:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f0a:	c1 e0 04             	shl    $0x4,%eax
+  802f0d:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f13:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f15:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f1b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f20:	0f 87 65 ff ff ff    	ja     802e8b <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f26:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f2b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f2d:	c1 e8 10             	shr    $0x10,%eax
+  802f30:	0f 84 55 ff ff ff    	je     802e8b <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f36:	c1 e0 10             	shl    $0x10,%eax
+  802f39:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f3e:	29 c1                	sub    %eax,%ecx
+  802f40:	e9 4c ff ff ff       	jmp    802e91 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f45:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f48:	c1 e2 04             	shl    $0x4,%edx
+  802f4b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f51:	8b 52 48             	mov    0x48(%edx),%edx
+  802f54:	39 fa                	cmp    %edi,%edx
+  802f56:	0f 85 52 ff ff ff    	jne    802eae <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f5c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f5f:	c1 e2 04             	shl    $0x4,%edx
+  802f62:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f68:	8b 52 54             	mov    0x54(%edx),%edx
+  802f6b:	85 d2                	test   %edx,%edx
+  802f6d:	0f 84 3b ff ff ff    	je     802eae <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f73:	83 ec 0c             	sub    $0xc,%esp
+  802f76:	50                   	push   %eax
+  802f77:	57                   	push   %edi
+  802f78:	68 d4 48 80 00       	push   $0x8048d4
+  802f7d:	68 bb 00 00 00       	push   $0xbb
+  802f82:	68 c4 48 80 00       	push   $0x8048c4
+  802f87:	e8 3f 02 00 00       	call   8031cb <_panic>
+	}
+}
+  802f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8f:	5b                   	pop    %ebx
+  802f90:	5e                   	pop    %esi
+  802f91:	5f                   	pop    %edi
+  802f92:	5d                   	pop    %ebp
+  802f93:	c3                   	ret
+
+00802f94 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f94:	55                   	push   %ebp
+  802f95:	89 e5                	mov    %esp,%ebp
+  802f97:	53                   	push   %ebx
+  802f98:	83 ec 04             	sub    $0x4,%esp
+  802f9b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f9d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802fa3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fa9:	0f 87 85 00 00 00    	ja     803034 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802faf:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fb4:	29 c3                	sub    %eax,%ebx
+  802fb6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fb9:	83 ec 04             	sub    $0x4,%esp
+  802fbc:	68 80 02 00 00       	push   $0x280
+  802fc1:	6a 00                	push   $0x0
+  802fc3:	68 40 60 80 00       	push   $0x806040
+  802fc8:	e8 0e 0a 00 00       	call   8039db <memset>
+	threads_mu.m_state = 0;
+  802fcd:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fd4:	00 00 00 
+	if (self != 0) {
+  802fd7:	83 c4 10             	add    $0x10,%esp
+  802fda:	85 db                	test   %ebx,%ebx
+  802fdc:	74 51                	je     80302f <pthread_fork_child+0x9b>
+  802fde:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fe0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fe6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802feb:	77 18                	ja     803005 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fed:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ff2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ff4:	c1 e8 10             	shr    $0x10,%eax
+  802ff7:	74 0c                	je     803005 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ff9:	c1 e0 10             	shl    $0x10,%eax
+  802ffc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803001:	29 c2                	sub    %eax,%edx
+  803003:	eb 06                	jmp    80300b <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803005:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  80300b:	8b 02                	mov    (%edx),%eax
+  80300d:	8b 48 48             	mov    0x48(%eax),%ecx
+  803010:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803017:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80301a:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803021:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803028:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80302f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803032:	c9                   	leave
+  803033:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803034:	83 ec 04             	sub    $0x4,%esp
+  803037:	68 80 02 00 00       	push   $0x280
+  80303c:	6a 00                	push   $0x0
+  80303e:	68 40 60 80 00       	push   $0x806040
+  803043:	e8 93 09 00 00       	call   8039db <memset>
+	threads_mu.m_state = 0;
+  803048:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80304f:	00 00 00 
+  803052:	83 c4 10             	add    $0x10,%esp
+  803055:	eb d8                	jmp    80302f <pthread_fork_child+0x9b>
+
+00803057 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	c3                   	ret
+
+0080305d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803063:	68 f9 48 80 00       	push   $0x8048f9
+  803068:	ff 75 0c             	push   0xc(%ebp)
+  80306b:	e8 1a 08 00 00       	call   80388a <strcpy>
+	return 0;
+}
+  803070:	b8 00 00 00 00       	mov    $0x0,%eax
+  803075:	c9                   	leave
+  803076:	c3                   	ret
+
+00803077 <devcons_write>:
+{
+  803077:	55                   	push   %ebp
+  803078:	89 e5                	mov    %esp,%ebp
+  80307a:	57                   	push   %edi
+  80307b:	56                   	push   %esi
+  80307c:	53                   	push   %ebx
+  80307d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803083:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803088:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80308e:	eb 2e                	jmp    8030be <devcons_write+0x47>
+		m = n - tot;
+  803090:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803093:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803095:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80309a:	39 c3                	cmp    %eax,%ebx
+  80309c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80309f:	83 ec 04             	sub    $0x4,%esp
+  8030a2:	53                   	push   %ebx
+  8030a3:	89 f0                	mov    %esi,%eax
+  8030a5:	03 45 0c             	add    0xc(%ebp),%eax
+  8030a8:	50                   	push   %eax
+  8030a9:	57                   	push   %edi
+  8030aa:	e8 61 09 00 00       	call   803a10 <memmove>
+		sys_cputs(buf, m);
+  8030af:	83 c4 08             	add    $0x8,%esp
+  8030b2:	53                   	push   %ebx
+  8030b3:	57                   	push   %edi
+  8030b4:	e8 38 d0 ff ff       	call   8000f1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030b9:	01 de                	add    %ebx,%esi
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030c1:	72 cd                	jb     803090 <devcons_write+0x19>
+}
+  8030c3:	89 f0                	mov    %esi,%eax
+  8030c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c8:	5b                   	pop    %ebx
+  8030c9:	5e                   	pop    %esi
+  8030ca:	5f                   	pop    %edi
+  8030cb:	5d                   	pop    %ebp
+  8030cc:	c3                   	ret
+
+008030cd <devcons_read>:
+{
+  8030cd:	55                   	push   %ebp
+  8030ce:	89 e5                	mov    %esp,%ebp
+  8030d0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030dc:	75 07                	jne    8030e5 <devcons_read+0x18>
+  8030de:	eb 1f                	jmp    8030ff <devcons_read+0x32>
+		sys_yield();
+  8030e0:	e8 da d0 ff ff       	call   8001bf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030e5:	e8 32 d0 ff ff       	call   80011c <sys_cgetc>
+  8030ea:	85 c0                	test   %eax,%eax
+  8030ec:	74 f2                	je     8030e0 <devcons_read+0x13>
+	if (c < 0)
+  8030ee:	78 0f                	js     8030ff <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030f0:	83 f8 04             	cmp    $0x4,%eax
+  8030f3:	74 0c                	je     803101 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030f8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030fa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030ff:	c9                   	leave
+  803100:	c3                   	ret
+		return 0;
+  803101:	b8 00 00 00 00       	mov    $0x0,%eax
+  803106:	eb f7                	jmp    8030ff <devcons_read+0x32>
+
+00803108 <cputchar>:
+{
+  803108:	55                   	push   %ebp
+  803109:	89 e5                	mov    %esp,%ebp
+  80310b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80310e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803111:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803114:	6a 01                	push   $0x1
+  803116:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803119:	50                   	push   %eax
+  80311a:	e8 d2 cf ff ff       	call   8000f1 <sys_cputs>
+}
+  80311f:	83 c4 10             	add    $0x10,%esp
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+
+00803124 <getchar>:
+{
+  803124:	55                   	push   %ebp
+  803125:	89 e5                	mov    %esp,%ebp
+  803127:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80312a:	6a 01                	push   $0x1
+  80312c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80312f:	50                   	push   %eax
+  803130:	6a 00                	push   $0x0
+  803132:	e8 63 d8 ff ff       	call   80099a <read>
+	if (r < 0)
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	85 c0                	test   %eax,%eax
+  80313c:	78 06                	js     803144 <getchar+0x20>
+	if (r < 1)
+  80313e:	74 06                	je     803146 <getchar+0x22>
+	return c;
+  803140:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803144:	c9                   	leave
+  803145:	c3                   	ret
+		return -E_EOF;
+  803146:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80314b:	eb f7                	jmp    803144 <getchar+0x20>
+
+0080314d <iscons>:
+{
+  80314d:	55                   	push   %ebp
+  80314e:	89 e5                	mov    %esp,%ebp
+  803150:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803153:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803156:	50                   	push   %eax
+  803157:	ff 75 08             	push   0x8(%ebp)
+  80315a:	e8 ab d5 ff ff       	call   80070a <fd_lookup>
+  80315f:	83 c4 10             	add    $0x10,%esp
+  803162:	85 c0                	test   %eax,%eax
+  803164:	78 11                	js     803177 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803166:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803169:	8b 15 b8 52 80 00    	mov    0x8052b8,%edx
+  80316f:	39 10                	cmp    %edx,(%eax)
+  803171:	0f 94 c0             	sete   %al
+  803174:	0f b6 c0             	movzbl %al,%eax
+}
+  803177:	c9                   	leave
+  803178:	c3                   	ret
+
+00803179 <opencons>:
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80317f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803182:	50                   	push   %eax
+  803183:	e8 2c d5 ff ff       	call   8006b4 <fd_alloc>
+  803188:	83 c4 10             	add    $0x10,%esp
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	78 3a                	js     8031c9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80318f:	83 ec 04             	sub    $0x4,%esp
+  803192:	68 07 04 00 00       	push   $0x407
+  803197:	ff 75 f4             	push   -0xc(%ebp)
+  80319a:	6a 00                	push   $0x0
+  80319c:	e8 4a d0 ff ff       	call   8001eb <sys_page_alloc>
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	78 21                	js     8031c9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031ab:	8b 15 b8 52 80 00    	mov    0x8052b8,%edx
+  8031b1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031bd:	83 ec 0c             	sub    $0xc,%esp
+  8031c0:	50                   	push   %eax
+  8031c1:	e8 c7 d4 ff ff       	call   80068d <fd2num>
+  8031c6:	83 c4 10             	add    $0x10,%esp
+}
+  8031c9:	c9                   	leave
+  8031ca:	c3                   	ret
+
+008031cb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031cb:	55                   	push   %ebp
+  8031cc:	89 e5                	mov    %esp,%ebp
+  8031ce:	56                   	push   %esi
+  8031cf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031d0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031d3:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  8031d9:	e8 b5 cf ff ff       	call   800193 <sys_getenvid>
+  8031de:	83 ec 0c             	sub    $0xc,%esp
+  8031e1:	ff 75 0c             	push   0xc(%ebp)
+  8031e4:	ff 75 08             	push   0x8(%ebp)
+  8031e7:	56                   	push   %esi
+  8031e8:	50                   	push   %eax
+  8031e9:	68 08 49 80 00       	push   $0x804908
+  8031ee:	e8 b3 00 00 00       	call   8032a6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031f3:	83 c4 18             	add    $0x18,%esp
+  8031f6:	53                   	push   %ebx
+  8031f7:	ff 75 10             	push   0x10(%ebp)
+  8031fa:	e8 56 00 00 00       	call   803255 <vcprintf>
+	cprintf("\n");
+  8031ff:	c7 04 24 d2 4d 80 00 	movl   $0x804dd2,(%esp)
+  803206:	e8 9b 00 00 00       	call   8032a6 <cprintf>
+  80320b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80320e:	cc                   	int3
+	while (1)
+  80320f:	eb fd                	jmp    80320e <_panic+0x43>
+
+00803211 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803211:	55                   	push   %ebp
+  803212:	89 e5                	mov    %esp,%ebp
+  803214:	53                   	push   %ebx
+  803215:	83 ec 04             	sub    $0x4,%esp
+  803218:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80321b:	8b 13                	mov    (%ebx),%edx
+  80321d:	8d 42 01             	lea    0x1(%edx),%eax
+  803220:	89 03                	mov    %eax,(%ebx)
+  803222:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803225:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803229:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80322e:	74 09                	je     803239 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803230:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803239:	83 ec 08             	sub    $0x8,%esp
+  80323c:	68 ff 00 00 00       	push   $0xff
+  803241:	8d 43 08             	lea    0x8(%ebx),%eax
+  803244:	50                   	push   %eax
+  803245:	e8 a7 ce ff ff       	call   8000f1 <sys_cputs>
+		b->idx = 0;
+  80324a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803250:	83 c4 10             	add    $0x10,%esp
+  803253:	eb db                	jmp    803230 <putch+0x1f>
+
+00803255 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803255:	55                   	push   %ebp
+  803256:	89 e5                	mov    %esp,%ebp
+  803258:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80325e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803265:	00 00 00 
+	b.cnt = 0;
+  803268:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80326f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803272:	ff 75 0c             	push   0xc(%ebp)
+  803275:	ff 75 08             	push   0x8(%ebp)
+  803278:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80327e:	50                   	push   %eax
+  80327f:	68 11 32 80 00       	push   $0x803211
+  803284:	e8 14 01 00 00       	call   80339d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803289:	83 c4 08             	add    $0x8,%esp
+  80328c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  803292:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803298:	50                   	push   %eax
+  803299:	e8 53 ce ff ff       	call   8000f1 <sys_cputs>
+
+	return b.cnt;
+}
+  80329e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+008032a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8032ac:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8032af:	50                   	push   %eax
+  8032b0:	ff 75 08             	push   0x8(%ebp)
+  8032b3:	e8 9d ff ff ff       	call   803255 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032b8:	c9                   	leave
+  8032b9:	c3                   	ret
+
+008032ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	57                   	push   %edi
+  8032be:	56                   	push   %esi
+  8032bf:	53                   	push   %ebx
+  8032c0:	83 ec 1c             	sub    $0x1c,%esp
+  8032c3:	89 c7                	mov    %eax,%edi
+  8032c5:	89 d6                	mov    %edx,%esi
+  8032c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032cd:	89 d1                	mov    %edx,%ecx
+  8032cf:	89 c2                	mov    %eax,%edx
+  8032d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032d4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032d7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032da:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032e7:	39 c2                	cmp    %eax,%edx
+  8032e9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032ec:	72 3e                	jb     80332c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032ee:	83 ec 0c             	sub    $0xc,%esp
+  8032f1:	ff 75 18             	push   0x18(%ebp)
+  8032f4:	83 eb 01             	sub    $0x1,%ebx
+  8032f7:	53                   	push   %ebx
+  8032f8:	50                   	push   %eax
+  8032f9:	83 ec 08             	sub    $0x8,%esp
+  8032fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8032ff:	ff 75 e0             	push   -0x20(%ebp)
+  803302:	ff 75 dc             	push   -0x24(%ebp)
+  803305:	ff 75 d8             	push   -0x28(%ebp)
+  803308:	e8 47 12 00 00       	call   804554 <__udivdi3>
+  80330d:	83 c4 18             	add    $0x18,%esp
+  803310:	52                   	push   %edx
+  803311:	50                   	push   %eax
+  803312:	89 f2                	mov    %esi,%edx
+  803314:	89 f8                	mov    %edi,%eax
+  803316:	e8 9f ff ff ff       	call   8032ba <printnum>
+  80331b:	83 c4 20             	add    $0x20,%esp
+  80331e:	eb 13                	jmp    803333 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803320:	83 ec 08             	sub    $0x8,%esp
+  803323:	56                   	push   %esi
+  803324:	ff 75 18             	push   0x18(%ebp)
+  803327:	ff d7                	call   *%edi
+  803329:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80332c:	83 eb 01             	sub    $0x1,%ebx
+  80332f:	85 db                	test   %ebx,%ebx
+  803331:	7f ed                	jg     803320 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  803333:	83 ec 08             	sub    $0x8,%esp
+  803336:	56                   	push   %esi
+  803337:	83 ec 04             	sub    $0x4,%esp
+  80333a:	ff 75 e4             	push   -0x1c(%ebp)
+  80333d:	ff 75 e0             	push   -0x20(%ebp)
+  803340:	ff 75 dc             	push   -0x24(%ebp)
+  803343:	ff 75 d8             	push   -0x28(%ebp)
+  803346:	e8 2a 12 00 00       	call   804575 <__umoddi3>
+  80334b:	83 c4 14             	add    $0x14,%esp
+  80334e:	0f be 80 2b 49 80 00 	movsbl 0x80492b(%eax),%eax
+  803355:	50                   	push   %eax
+  803356:	ff d7                	call   *%edi
+}
+  803358:	83 c4 10             	add    $0x10,%esp
+  80335b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80335e:	5b                   	pop    %ebx
+  80335f:	5e                   	pop    %esi
+  803360:	5f                   	pop    %edi
+  803361:	5d                   	pop    %ebp
+  803362:	c3                   	ret
+
+00803363 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803363:	55                   	push   %ebp
+  803364:	89 e5                	mov    %esp,%ebp
+  803366:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803369:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80336d:	8b 10                	mov    (%eax),%edx
+  80336f:	3b 50 04             	cmp    0x4(%eax),%edx
+  803372:	73 0a                	jae    80337e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803374:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803377:	89 08                	mov    %ecx,(%eax)
+  803379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337c:	88 02                	mov    %al,(%edx)
+}
+  80337e:	5d                   	pop    %ebp
+  80337f:	c3                   	ret
+
+00803380 <printfmt>:
+{
+  803380:	55                   	push   %ebp
+  803381:	89 e5                	mov    %esp,%ebp
+  803383:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803386:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803389:	50                   	push   %eax
+  80338a:	ff 75 10             	push   0x10(%ebp)
+  80338d:	ff 75 0c             	push   0xc(%ebp)
+  803390:	ff 75 08             	push   0x8(%ebp)
+  803393:	e8 05 00 00 00       	call   80339d <vprintfmt>
+}
+  803398:	83 c4 10             	add    $0x10,%esp
+  80339b:	c9                   	leave
+  80339c:	c3                   	ret
+
+0080339d <vprintfmt>:
+{
+  80339d:	55                   	push   %ebp
+  80339e:	89 e5                	mov    %esp,%ebp
+  8033a0:	57                   	push   %edi
+  8033a1:	56                   	push   %esi
+  8033a2:	53                   	push   %ebx
+  8033a3:	83 ec 2c             	sub    $0x2c,%esp
+  8033a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8033ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033af:	eb 0a                	jmp    8033bb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033b1:	83 ec 08             	sub    $0x8,%esp
+  8033b4:	53                   	push   %ebx
+  8033b5:	50                   	push   %eax
+  8033b6:	ff d6                	call   *%esi
+  8033b8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033bb:	83 c7 01             	add    $0x1,%edi
+  8033be:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033c2:	83 f8 25             	cmp    $0x25,%eax
+  8033c5:	74 0c                	je     8033d3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8033c7:	85 c0                	test   %eax,%eax
+  8033c9:	75 e6                	jne    8033b1 <vprintfmt+0x14>
+}
+  8033cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ce:	5b                   	pop    %ebx
+  8033cf:	5e                   	pop    %esi
+  8033d0:	5f                   	pop    %edi
+  8033d1:	5d                   	pop    %ebp
+  8033d2:	c3                   	ret
+		padc = ' ';
+  8033d3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033de:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033e5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033f1:	8d 47 01             	lea    0x1(%edi),%eax
+  8033f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033f7:	0f b6 17             	movzbl (%edi),%edx
+  8033fa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033fd:	3c 55                	cmp    $0x55,%al
+  8033ff:	0f 87 c5 03 00 00    	ja     8037ca <vprintfmt+0x42d>
+  803405:	0f b6 c0             	movzbl %al,%eax
+  803408:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  80340f:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  803412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803415:	eb da                	jmp    8033f1 <vprintfmt+0x54>
+  803417:	0f be d2             	movsbl %dl,%edx
+  80341a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80341d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803425:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803428:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80342c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80342f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803432:	83 f9 09             	cmp    $0x9,%ecx
+  803435:	77 55                	ja     80348c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803437:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80343a:	eb e9                	jmp    803425 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80343c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80343f:	8b 00                	mov    (%eax),%eax
+  803441:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803444:	8b 45 14             	mov    0x14(%ebp),%eax
+  803447:	8d 40 04             	lea    0x4(%eax),%eax
+  80344a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80344d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803450:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803454:	79 9b                	jns    8033f1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803456:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80345c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  803463:	eb 8c                	jmp    8033f1 <vprintfmt+0x54>
+			if (width < 0)
+  803465:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803468:	85 d2                	test   %edx,%edx
+  80346a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346f:	0f 49 c2             	cmovns %edx,%eax
+  803472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  803475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803478:	e9 74 ff ff ff       	jmp    8033f1 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80347d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803480:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803487:	e9 65 ff ff ff       	jmp    8033f1 <vprintfmt+0x54>
+  80348c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80348f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803492:	eb bc                	jmp    803450 <vprintfmt+0xb3>
+			lflag++;
+  803494:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  803497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80349a:	e9 52 ff ff ff       	jmp    8033f1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80349f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8034a5:	83 ec 08             	sub    $0x8,%esp
+  8034a8:	53                   	push   %ebx
+  8034a9:	ff 30                	push   (%eax)
+  8034ab:	ff d6                	call   *%esi
+			break;
+  8034ad:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034b3:	e9 b1 02 00 00       	jmp    803769 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034bb:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034be:	8b 10                	mov    (%eax),%edx
+  8034c0:	89 d0                	mov    %edx,%eax
+  8034c2:	f7 d8                	neg    %eax
+  8034c4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034c7:	83 f8 14             	cmp    $0x14,%eax
+  8034ca:	7f 23                	jg     8034ef <vprintfmt+0x152>
+  8034cc:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  8034d3:	85 d2                	test   %edx,%edx
+  8034d5:	74 18                	je     8034ef <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034d7:	52                   	push   %edx
+  8034d8:	68 d3 47 80 00       	push   $0x8047d3
+  8034dd:	53                   	push   %ebx
+  8034de:	56                   	push   %esi
+  8034df:	e8 9c fe ff ff       	call   803380 <printfmt>
+  8034e4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034ea:	e9 7a 02 00 00       	jmp    803769 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034ef:	50                   	push   %eax
+  8034f0:	68 43 49 80 00       	push   $0x804943
+  8034f5:	53                   	push   %ebx
+  8034f6:	56                   	push   %esi
+  8034f7:	e8 84 fe ff ff       	call   803380 <printfmt>
+  8034fc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  803502:	e9 62 02 00 00       	jmp    803769 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80350a:	83 c0 04             	add    $0x4,%eax
+  80350d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803510:	8b 45 14             	mov    0x14(%ebp),%eax
+  803513:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803515:	85 c9                	test   %ecx,%ecx
+  803517:	b8 3c 49 80 00       	mov    $0x80493c,%eax
+  80351c:	0f 45 c1             	cmovne %ecx,%eax
+  80351f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803526:	7e 06                	jle    80352e <vprintfmt+0x191>
+  803528:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80352c:	75 0b                	jne    803539 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80352e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803531:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803534:	89 75 08             	mov    %esi,0x8(%ebp)
+  803537:	eb 5c                	jmp    803595 <vprintfmt+0x1f8>
+  803539:	83 ec 08             	sub    $0x8,%esp
+  80353c:	ff 75 d0             	push   -0x30(%ebp)
+  80353f:	ff 75 cc             	push   -0x34(%ebp)
+  803542:	e8 20 03 00 00       	call   803867 <strnlen>
+  803547:	89 c2                	mov    %eax,%edx
+  803549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80354c:	29 d0                	sub    %edx,%eax
+  80354e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803551:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80355b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80355d:	eb 0e                	jmp    80356d <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80355f:	83 ec 08             	sub    $0x8,%esp
+  803562:	53                   	push   %ebx
+  803563:	57                   	push   %edi
+  803564:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803567:	83 ee 01             	sub    $0x1,%esi
+  80356a:	83 c4 10             	add    $0x10,%esp
+  80356d:	85 f6                	test   %esi,%esi
+  80356f:	7f ee                	jg     80355f <vprintfmt+0x1c2>
+  803571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803574:	8b 75 08             	mov    0x8(%ebp),%esi
+  803577:	85 c0                	test   %eax,%eax
+  803579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357e:	0f 49 d0             	cmovns %eax,%edx
+  803581:	29 d0                	sub    %edx,%eax
+  803583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803586:	eb a6                	jmp    80352e <vprintfmt+0x191>
+					putch(ch, putdat);
+  803588:	83 ec 08             	sub    $0x8,%esp
+  80358b:	53                   	push   %ebx
+  80358c:	52                   	push   %edx
+  80358d:	ff 55 08             	call   *0x8(%ebp)
+  803590:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803593:	89 f1                	mov    %esi,%ecx
+  803595:	8d 71 01             	lea    0x1(%ecx),%esi
+  803598:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80359c:	0f be d0             	movsbl %al,%edx
+  80359f:	85 d2                	test   %edx,%edx
+  8035a1:	74 28                	je     8035cb <vprintfmt+0x22e>
+  8035a3:	85 ff                	test   %edi,%edi
+  8035a5:	78 05                	js     8035ac <vprintfmt+0x20f>
+  8035a7:	83 ef 01             	sub    $0x1,%edi
+  8035aa:	78 30                	js     8035dc <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8035ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035b0:	74 d6                	je     803588 <vprintfmt+0x1eb>
+  8035b2:	0f be c0             	movsbl %al,%eax
+  8035b5:	83 e8 20             	sub    $0x20,%eax
+  8035b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8035bb:	76 cb                	jbe    803588 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035bd:	83 ec 08             	sub    $0x8,%esp
+  8035c0:	53                   	push   %ebx
+  8035c1:	6a 3f                	push   $0x3f
+  8035c3:	ff 55 08             	call   *0x8(%ebp)
+  8035c6:	83 c4 10             	add    $0x10,%esp
+  8035c9:	eb c8                	jmp    803593 <vprintfmt+0x1f6>
+  8035cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035d4:	01 d0                	add    %edx,%eax
+  8035d6:	29 c8                	sub    %ecx,%eax
+  8035d8:	89 c7                	mov    %eax,%edi
+  8035da:	eb 13                	jmp    8035ef <vprintfmt+0x252>
+  8035dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035df:	eb ed                	jmp    8035ce <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035e1:	83 ec 08             	sub    $0x8,%esp
+  8035e4:	53                   	push   %ebx
+  8035e5:	6a 20                	push   $0x20
+  8035e7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035e9:	83 ef 01             	sub    $0x1,%edi
+  8035ec:	83 c4 10             	add    $0x10,%esp
+  8035ef:	85 ff                	test   %edi,%edi
+  8035f1:	7f ee                	jg     8035e1 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035f9:	e9 6b 01 00 00       	jmp    803769 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035fe:	83 f9 01             	cmp    $0x1,%ecx
+  803601:	7f 1f                	jg     803622 <vprintfmt+0x285>
+	else if (lflag)
+  803603:	85 c9                	test   %ecx,%ecx
+  803605:	74 67                	je     80366e <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  803607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80360a:	8b 00                	mov    (%eax),%eax
+  80360c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80360f:	89 c1                	mov    %eax,%ecx
+  803611:	c1 f9 1f             	sar    $0x1f,%ecx
+  803614:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80361a:	8d 40 04             	lea    0x4(%eax),%eax
+  80361d:	89 45 14             	mov    %eax,0x14(%ebp)
+  803620:	eb 17                	jmp    803639 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  803622:	8b 45 14             	mov    0x14(%ebp),%eax
+  803625:	8b 50 04             	mov    0x4(%eax),%edx
+  803628:	8b 00                	mov    (%eax),%eax
+  80362a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80362d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803630:	8b 45 14             	mov    0x14(%ebp),%eax
+  803633:	8d 40 08             	lea    0x8(%eax),%eax
+  803636:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80363c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80363f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803644:	85 c9                	test   %ecx,%ecx
+  803646:	0f 89 03 01 00 00    	jns    80374f <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80364c:	83 ec 08             	sub    $0x8,%esp
+  80364f:	53                   	push   %ebx
+  803650:	6a 2d                	push   $0x2d
+  803652:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80365a:	f7 da                	neg    %edx
+  80365c:	83 d1 00             	adc    $0x0,%ecx
+  80365f:	f7 d9                	neg    %ecx
+  803661:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803664:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803669:	e9 e1 00 00 00       	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80366e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803671:	8b 00                	mov    (%eax),%eax
+  803673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803676:	89 c1                	mov    %eax,%ecx
+  803678:	c1 f9 1f             	sar    $0x1f,%ecx
+  80367b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80367e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803681:	8d 40 04             	lea    0x4(%eax),%eax
+  803684:	89 45 14             	mov    %eax,0x14(%ebp)
+  803687:	eb b0                	jmp    803639 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803689:	83 f9 01             	cmp    $0x1,%ecx
+  80368c:	7f 1e                	jg     8036ac <vprintfmt+0x30f>
+	else if (lflag)
+  80368e:	85 c9                	test   %ecx,%ecx
+  803690:	74 32                	je     8036c4 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  803692:	8b 45 14             	mov    0x14(%ebp),%eax
+  803695:	8b 10                	mov    (%eax),%edx
+  803697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80369c:	8d 40 04             	lea    0x4(%eax),%eax
+  80369f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8036a7:	e9 a3 00 00 00       	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036af:	8b 10                	mov    (%eax),%edx
+  8036b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8036b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036bf:	e9 8b 00 00 00       	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036c7:	8b 10                	mov    (%eax),%edx
+  8036c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8036d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036d9:	eb 74                	jmp    80374f <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036db:	83 f9 01             	cmp    $0x1,%ecx
+  8036de:	7f 1b                	jg     8036fb <vprintfmt+0x35e>
+	else if (lflag)
+  8036e0:	85 c9                	test   %ecx,%ecx
+  8036e2:	74 2c                	je     803710 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036e7:	8b 10                	mov    (%eax),%edx
+  8036e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8036f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036f9:	eb 54                	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036fe:	8b 10                	mov    (%eax),%edx
+  803700:	8b 48 04             	mov    0x4(%eax),%ecx
+  803703:	8d 40 08             	lea    0x8(%eax),%eax
+  803706:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803709:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80370e:	eb 3f                	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803710:	8b 45 14             	mov    0x14(%ebp),%eax
+  803713:	8b 10                	mov    (%eax),%edx
+  803715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80371a:	8d 40 04             	lea    0x4(%eax),%eax
+  80371d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803720:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803725:	eb 28                	jmp    80374f <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803727:	83 ec 08             	sub    $0x8,%esp
+  80372a:	53                   	push   %ebx
+  80372b:	6a 30                	push   $0x30
+  80372d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80372f:	83 c4 08             	add    $0x8,%esp
+  803732:	53                   	push   %ebx
+  803733:	6a 78                	push   $0x78
+  803735:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80373a:	8b 10                	mov    (%eax),%edx
+  80373c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803741:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803744:	8d 40 04             	lea    0x4(%eax),%eax
+  803747:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80374a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80374f:	83 ec 0c             	sub    $0xc,%esp
+  803752:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803756:	50                   	push   %eax
+  803757:	ff 75 e0             	push   -0x20(%ebp)
+  80375a:	57                   	push   %edi
+  80375b:	51                   	push   %ecx
+  80375c:	52                   	push   %edx
+  80375d:	89 da                	mov    %ebx,%edx
+  80375f:	89 f0                	mov    %esi,%eax
+  803761:	e8 54 fb ff ff       	call   8032ba <printnum>
+			break;
+  803766:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803769:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80376c:	e9 4a fc ff ff       	jmp    8033bb <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803771:	83 f9 01             	cmp    $0x1,%ecx
+  803774:	7f 1b                	jg     803791 <vprintfmt+0x3f4>
+	else if (lflag)
+  803776:	85 c9                	test   %ecx,%ecx
+  803778:	74 2c                	je     8037a6 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80377a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80377d:	8b 10                	mov    (%eax),%edx
+  80377f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803784:	8d 40 04             	lea    0x4(%eax),%eax
+  803787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80378a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80378f:	eb be                	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803791:	8b 45 14             	mov    0x14(%ebp),%eax
+  803794:	8b 10                	mov    (%eax),%edx
+  803796:	8b 48 04             	mov    0x4(%eax),%ecx
+  803799:	8d 40 08             	lea    0x8(%eax),%eax
+  80379c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80379f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8037a4:	eb a9                	jmp    80374f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8037a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037a9:	8b 10                	mov    (%eax),%edx
+  8037ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8037b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037bb:	eb 92                	jmp    80374f <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037bd:	83 ec 08             	sub    $0x8,%esp
+  8037c0:	53                   	push   %ebx
+  8037c1:	6a 25                	push   $0x25
+  8037c3:	ff d6                	call   *%esi
+			break;
+  8037c5:	83 c4 10             	add    $0x10,%esp
+  8037c8:	eb 9f                	jmp    803769 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037ca:	83 ec 08             	sub    $0x8,%esp
+  8037cd:	53                   	push   %ebx
+  8037ce:	6a 25                	push   $0x25
+  8037d0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037d2:	83 c4 10             	add    $0x10,%esp
+  8037d5:	89 f8                	mov    %edi,%eax
+  8037d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037db:	74 05                	je     8037e2 <vprintfmt+0x445>
+  8037dd:	83 e8 01             	sub    $0x1,%eax
+  8037e0:	eb f5                	jmp    8037d7 <vprintfmt+0x43a>
+  8037e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037e5:	eb 82                	jmp    803769 <vprintfmt+0x3cc>
+
+008037e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037e7:	55                   	push   %ebp
+  8037e8:	89 e5                	mov    %esp,%ebp
+  8037ea:	83 ec 18             	sub    $0x18,%esp
+  8037ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037f6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803804:	85 c0                	test   %eax,%eax
+  803806:	74 26                	je     80382e <vsnprintf+0x47>
+  803808:	85 d2                	test   %edx,%edx
+  80380a:	7e 22                	jle    80382e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80380c:	ff 75 14             	push   0x14(%ebp)
+  80380f:	ff 75 10             	push   0x10(%ebp)
+  803812:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803815:	50                   	push   %eax
+  803816:	68 63 33 80 00       	push   $0x803363
+  80381b:	e8 7d fb ff ff       	call   80339d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803820:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803823:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803829:	83 c4 10             	add    $0x10,%esp
+}
+  80382c:	c9                   	leave
+  80382d:	c3                   	ret
+		return -E_INVAL;
+  80382e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803833:	eb f7                	jmp    80382c <vsnprintf+0x45>
+
+00803835 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803835:	55                   	push   %ebp
+  803836:	89 e5                	mov    %esp,%ebp
+  803838:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80383b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80383e:	50                   	push   %eax
+  80383f:	ff 75 10             	push   0x10(%ebp)
+  803842:	ff 75 0c             	push   0xc(%ebp)
+  803845:	ff 75 08             	push   0x8(%ebp)
+  803848:	e8 9a ff ff ff       	call   8037e7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80384d:	c9                   	leave
+  80384e:	c3                   	ret
+
+0080384f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80384f:	55                   	push   %ebp
+  803850:	89 e5                	mov    %esp,%ebp
+  803852:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385a:	eb 03                	jmp    80385f <strlen+0x10>
+		n++;
+  80385c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80385f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803863:	75 f7                	jne    80385c <strlen+0xd>
+	return n;
+}
+  803865:	5d                   	pop    %ebp
+  803866:	c3                   	ret
+
+00803867 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803867:	55                   	push   %ebp
+  803868:	89 e5                	mov    %esp,%ebp
+  80386a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80386d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803870:	b8 00 00 00 00       	mov    $0x0,%eax
+  803875:	eb 03                	jmp    80387a <strnlen+0x13>
+		n++;
+  803877:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80387a:	39 d0                	cmp    %edx,%eax
+  80387c:	74 08                	je     803886 <strnlen+0x1f>
+  80387e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803882:	75 f3                	jne    803877 <strnlen+0x10>
+  803884:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  803886:	89 d0                	mov    %edx,%eax
+  803888:	5d                   	pop    %ebp
+  803889:	c3                   	ret
+
+0080388a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80388a:	55                   	push   %ebp
+  80388b:	89 e5                	mov    %esp,%ebp
+  80388d:	53                   	push   %ebx
+  80388e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803891:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  803894:	b8 00 00 00 00       	mov    $0x0,%eax
+  803899:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80389d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8038a0:	83 c0 01             	add    $0x1,%eax
+  8038a3:	84 d2                	test   %dl,%dl
+  8038a5:	75 f2                	jne    803899 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8038a7:	89 c8                	mov    %ecx,%eax
+  8038a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038ac:	c9                   	leave
+  8038ad:	c3                   	ret
+
+008038ae <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8038ae:	55                   	push   %ebp
+  8038af:	89 e5                	mov    %esp,%ebp
+  8038b1:	53                   	push   %ebx
+  8038b2:	83 ec 10             	sub    $0x10,%esp
+  8038b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038b8:	53                   	push   %ebx
+  8038b9:	e8 91 ff ff ff       	call   80384f <strlen>
+  8038be:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038c1:	ff 75 0c             	push   0xc(%ebp)
+  8038c4:	01 d8                	add    %ebx,%eax
+  8038c6:	50                   	push   %eax
+  8038c7:	e8 be ff ff ff       	call   80388a <strcpy>
+	return dst;
+}
+  8038cc:	89 d8                	mov    %ebx,%eax
+  8038ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038d1:	c9                   	leave
+  8038d2:	c3                   	ret
+
+008038d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038d3:	55                   	push   %ebp
+  8038d4:	89 e5                	mov    %esp,%ebp
+  8038d6:	56                   	push   %esi
+  8038d7:	53                   	push   %ebx
+  8038d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038db:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038de:	89 f3                	mov    %esi,%ebx
+  8038e0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038e3:	89 f0                	mov    %esi,%eax
+  8038e5:	eb 0f                	jmp    8038f6 <strncpy+0x23>
+		*dst++ = *src;
+  8038e7:	83 c0 01             	add    $0x1,%eax
+  8038ea:	0f b6 0a             	movzbl (%edx),%ecx
+  8038ed:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038f0:	80 f9 01             	cmp    $0x1,%cl
+  8038f3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038f6:	39 d8                	cmp    %ebx,%eax
+  8038f8:	75 ed                	jne    8038e7 <strncpy+0x14>
+	}
+	return ret;
+}
+  8038fa:	89 f0                	mov    %esi,%eax
+  8038fc:	5b                   	pop    %ebx
+  8038fd:	5e                   	pop    %esi
+  8038fe:	5d                   	pop    %ebp
+  8038ff:	c3                   	ret
+
+00803900 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803900:	55                   	push   %ebp
+  803901:	89 e5                	mov    %esp,%ebp
+  803903:	56                   	push   %esi
+  803904:	53                   	push   %ebx
+  803905:	8b 75 08             	mov    0x8(%ebp),%esi
+  803908:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80390b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80390e:	89 f0                	mov    %esi,%eax
+  803910:	85 d2                	test   %edx,%edx
+  803912:	74 21                	je     803935 <strlcpy+0x35>
+  803914:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803918:	89 f2                	mov    %esi,%edx
+  80391a:	eb 09                	jmp    803925 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80391c:	83 c1 01             	add    $0x1,%ecx
+  80391f:	83 c2 01             	add    $0x1,%edx
+  803922:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803925:	39 c2                	cmp    %eax,%edx
+  803927:	74 09                	je     803932 <strlcpy+0x32>
+  803929:	0f b6 19             	movzbl (%ecx),%ebx
+  80392c:	84 db                	test   %bl,%bl
+  80392e:	75 ec                	jne    80391c <strlcpy+0x1c>
+  803930:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  803932:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803935:	29 f0                	sub    %esi,%eax
+}
+  803937:	5b                   	pop    %ebx
+  803938:	5e                   	pop    %esi
+  803939:	5d                   	pop    %ebp
+  80393a:	c3                   	ret
+
+0080393b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80393b:	55                   	push   %ebp
+  80393c:	89 e5                	mov    %esp,%ebp
+  80393e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803941:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803944:	eb 06                	jmp    80394c <strcmp+0x11>
+		p++, q++;
+  803946:	83 c1 01             	add    $0x1,%ecx
+  803949:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80394c:	0f b6 01             	movzbl (%ecx),%eax
+  80394f:	84 c0                	test   %al,%al
+  803951:	74 04                	je     803957 <strcmp+0x1c>
+  803953:	3a 02                	cmp    (%edx),%al
+  803955:	74 ef                	je     803946 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803957:	0f b6 c0             	movzbl %al,%eax
+  80395a:	0f b6 12             	movzbl (%edx),%edx
+  80395d:	29 d0                	sub    %edx,%eax
+}
+  80395f:	5d                   	pop    %ebp
+  803960:	c3                   	ret
+
+00803961 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803961:	55                   	push   %ebp
+  803962:	89 e5                	mov    %esp,%ebp
+  803964:	53                   	push   %ebx
+  803965:	8b 45 08             	mov    0x8(%ebp),%eax
+  803968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80396b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80396e:	eb 09                	jmp    803979 <strncmp+0x18>
+		n--, p++, q++;
+  803970:	83 ea 01             	sub    $0x1,%edx
+  803973:	83 c0 01             	add    $0x1,%eax
+  803976:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803979:	85 d2                	test   %edx,%edx
+  80397b:	74 18                	je     803995 <strncmp+0x34>
+  80397d:	0f b6 18             	movzbl (%eax),%ebx
+  803980:	84 db                	test   %bl,%bl
+  803982:	74 04                	je     803988 <strncmp+0x27>
+  803984:	3a 19                	cmp    (%ecx),%bl
+  803986:	74 e8                	je     803970 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803988:	0f b6 00             	movzbl (%eax),%eax
+  80398b:	0f b6 11             	movzbl (%ecx),%edx
+  80398e:	29 d0                	sub    %edx,%eax
+}
+  803990:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803993:	c9                   	leave
+  803994:	c3                   	ret
+		return 0;
+  803995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399a:	eb f4                	jmp    803990 <strncmp+0x2f>
+
+0080399c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80399c:	55                   	push   %ebp
+  80399d:	89 e5                	mov    %esp,%ebp
+  80399f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039a2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039a6:	eb 03                	jmp    8039ab <strchr+0xf>
+  8039a8:	83 c0 01             	add    $0x1,%eax
+  8039ab:	0f b6 10             	movzbl (%eax),%edx
+  8039ae:	84 d2                	test   %dl,%dl
+  8039b0:	74 06                	je     8039b8 <strchr+0x1c>
+		if (*s == c)
+  8039b2:	38 ca                	cmp    %cl,%dl
+  8039b4:	75 f2                	jne    8039a8 <strchr+0xc>
+  8039b6:	eb 05                	jmp    8039bd <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039bd:	5d                   	pop    %ebp
+  8039be:	c3                   	ret
+
+008039bf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039bf:	55                   	push   %ebp
+  8039c0:	89 e5                	mov    %esp,%ebp
+  8039c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039c9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039cc:	38 ca                	cmp    %cl,%dl
+  8039ce:	74 09                	je     8039d9 <strfind+0x1a>
+  8039d0:	84 d2                	test   %dl,%dl
+  8039d2:	74 05                	je     8039d9 <strfind+0x1a>
+	for (; *s; s++)
+  8039d4:	83 c0 01             	add    $0x1,%eax
+  8039d7:	eb f0                	jmp    8039c9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039d9:	5d                   	pop    %ebp
+  8039da:	c3                   	ret
+
+008039db <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039db:	55                   	push   %ebp
+  8039dc:	89 e5                	mov    %esp,%ebp
+  8039de:	57                   	push   %edi
+  8039df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039e5:	85 c9                	test   %ecx,%ecx
+  8039e7:	74 20                	je     803a09 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039e9:	89 f8                	mov    %edi,%eax
+  8039eb:	09 c8                	or     %ecx,%eax
+  8039ed:	a8 03                	test   $0x3,%al
+  8039ef:	75 12                	jne    803a03 <memset+0x28>
+		c &= 0xFF;
+  8039f1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039f5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039fb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039fe:	fc                   	cld
+  8039ff:	f3 ab                	rep stos %eax,%es:(%edi)
+  803a01:	eb 06                	jmp    803a09 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803a03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a06:	fc                   	cld
+  803a07:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803a09:	89 f8                	mov    %edi,%eax
+  803a0b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803a0e:	c9                   	leave
+  803a0f:	c3                   	ret
+
+00803a10 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a10:	55                   	push   %ebp
+  803a11:	89 e5                	mov    %esp,%ebp
+  803a13:	57                   	push   %edi
+  803a14:	56                   	push   %esi
+  803a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a1b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a1e:	39 c6                	cmp    %eax,%esi
+  803a20:	73 32                	jae    803a54 <memmove+0x44>
+  803a22:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a25:	39 d0                	cmp    %edx,%eax
+  803a27:	73 2b                	jae    803a54 <memmove+0x44>
+		s += n;
+		d += n;
+  803a29:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a2c:	89 d6                	mov    %edx,%esi
+  803a2e:	09 fe                	or     %edi,%esi
+  803a30:	09 ce                	or     %ecx,%esi
+  803a32:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a38:	75 0e                	jne    803a48 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a3a:	83 ef 04             	sub    $0x4,%edi
+  803a3d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a40:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a43:	fd                   	std
+  803a44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a46:	eb 09                	jmp    803a51 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a48:	83 ef 01             	sub    $0x1,%edi
+  803a4b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a4e:	fd                   	std
+  803a4f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a51:	fc                   	cld
+  803a52:	eb 1a                	jmp    803a6e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a54:	89 f2                	mov    %esi,%edx
+  803a56:	09 c2                	or     %eax,%edx
+  803a58:	09 ca                	or     %ecx,%edx
+  803a5a:	f6 c2 03             	test   $0x3,%dl
+  803a5d:	75 0a                	jne    803a69 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a5f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a62:	89 c7                	mov    %eax,%edi
+  803a64:	fc                   	cld
+  803a65:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a67:	eb 05                	jmp    803a6e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a69:	89 c7                	mov    %eax,%edi
+  803a6b:	fc                   	cld
+  803a6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a6e:	5e                   	pop    %esi
+  803a6f:	5f                   	pop    %edi
+  803a70:	5d                   	pop    %ebp
+  803a71:	c3                   	ret
+
+00803a72 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a72:	55                   	push   %ebp
+  803a73:	89 e5                	mov    %esp,%ebp
+  803a75:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a78:	ff 75 10             	push   0x10(%ebp)
+  803a7b:	ff 75 0c             	push   0xc(%ebp)
+  803a7e:	ff 75 08             	push   0x8(%ebp)
+  803a81:	e8 8a ff ff ff       	call   803a10 <memmove>
+}
+  803a86:	c9                   	leave
+  803a87:	c3                   	ret
+
+00803a88 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a88:	55                   	push   %ebp
+  803a89:	89 e5                	mov    %esp,%ebp
+  803a8b:	56                   	push   %esi
+  803a8c:	53                   	push   %ebx
+  803a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a93:	89 c6                	mov    %eax,%esi
+  803a95:	03 75 10             	add    0x10(%ebp),%esi
+  803a98:	eb 06                	jmp    803aa0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a9a:	83 c0 01             	add    $0x1,%eax
+  803a9d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803aa0:	39 f0                	cmp    %esi,%eax
+  803aa2:	74 14                	je     803ab8 <memcmp+0x30>
+		if (*s1 != *s2)
+  803aa4:	0f b6 08             	movzbl (%eax),%ecx
+  803aa7:	0f b6 1a             	movzbl (%edx),%ebx
+  803aaa:	38 d9                	cmp    %bl,%cl
+  803aac:	74 ec                	je     803a9a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803aae:	0f b6 c1             	movzbl %cl,%eax
+  803ab1:	0f b6 db             	movzbl %bl,%ebx
+  803ab4:	29 d8                	sub    %ebx,%eax
+  803ab6:	eb 05                	jmp    803abd <memcmp+0x35>
+	}
+
+	return 0;
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803abd:	5b                   	pop    %ebx
+  803abe:	5e                   	pop    %esi
+  803abf:	5d                   	pop    %ebp
+  803ac0:	c3                   	ret
+
+00803ac1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803ac1:	55                   	push   %ebp
+  803ac2:	89 e5                	mov    %esp,%ebp
+  803ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803aca:	89 c2                	mov    %eax,%edx
+  803acc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803acf:	eb 03                	jmp    803ad4 <memfind+0x13>
+  803ad1:	83 c0 01             	add    $0x1,%eax
+  803ad4:	39 d0                	cmp    %edx,%eax
+  803ad6:	73 04                	jae    803adc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ad8:	38 08                	cmp    %cl,(%eax)
+  803ada:	75 f5                	jne    803ad1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803adc:	5d                   	pop    %ebp
+  803add:	c3                   	ret
+
+00803ade <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ade:	55                   	push   %ebp
+  803adf:	89 e5                	mov    %esp,%ebp
+  803ae1:	57                   	push   %edi
+  803ae2:	56                   	push   %esi
+  803ae3:	53                   	push   %ebx
+  803ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ae7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803aea:	eb 03                	jmp    803aef <strtol+0x11>
+		s++;
+  803aec:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803aef:	0f b6 02             	movzbl (%edx),%eax
+  803af2:	3c 20                	cmp    $0x20,%al
+  803af4:	74 f6                	je     803aec <strtol+0xe>
+  803af6:	3c 09                	cmp    $0x9,%al
+  803af8:	74 f2                	je     803aec <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803afa:	3c 2b                	cmp    $0x2b,%al
+  803afc:	74 2a                	je     803b28 <strtol+0x4a>
+	int neg = 0;
+  803afe:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803b03:	3c 2d                	cmp    $0x2d,%al
+  803b05:	74 2b                	je     803b32 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b07:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803b0d:	75 0f                	jne    803b1e <strtol+0x40>
+  803b0f:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b12:	74 28                	je     803b3c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b14:	85 db                	test   %ebx,%ebx
+  803b16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b1b:	0f 44 d8             	cmove  %eax,%ebx
+  803b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b23:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b26:	eb 46                	jmp    803b6e <strtol+0x90>
+		s++;
+  803b28:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b30:	eb d5                	jmp    803b07 <strtol+0x29>
+		s++, neg = 1;
+  803b32:	83 c2 01             	add    $0x1,%edx
+  803b35:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b3a:	eb cb                	jmp    803b07 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b3c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b40:	74 0e                	je     803b50 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b42:	85 db                	test   %ebx,%ebx
+  803b44:	75 d8                	jne    803b1e <strtol+0x40>
+		s++, base = 8;
+  803b46:	83 c2 01             	add    $0x1,%edx
+  803b49:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b4e:	eb ce                	jmp    803b1e <strtol+0x40>
+		s += 2, base = 16;
+  803b50:	83 c2 02             	add    $0x2,%edx
+  803b53:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b58:	eb c4                	jmp    803b1e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b5a:	0f be c0             	movsbl %al,%eax
+  803b5d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b60:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b63:	7d 3a                	jge    803b9f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b65:	83 c2 01             	add    $0x1,%edx
+  803b68:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b6c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b6e:	0f b6 02             	movzbl (%edx),%eax
+  803b71:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b74:	89 f3                	mov    %esi,%ebx
+  803b76:	80 fb 09             	cmp    $0x9,%bl
+  803b79:	76 df                	jbe    803b5a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b7b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b7e:	89 f3                	mov    %esi,%ebx
+  803b80:	80 fb 19             	cmp    $0x19,%bl
+  803b83:	77 08                	ja     803b8d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b85:	0f be c0             	movsbl %al,%eax
+  803b88:	83 e8 57             	sub    $0x57,%eax
+  803b8b:	eb d3                	jmp    803b60 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b8d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b90:	89 f3                	mov    %esi,%ebx
+  803b92:	80 fb 19             	cmp    $0x19,%bl
+  803b95:	77 08                	ja     803b9f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b97:	0f be c0             	movsbl %al,%eax
+  803b9a:	83 e8 37             	sub    $0x37,%eax
+  803b9d:	eb c1                	jmp    803b60 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b9f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ba3:	74 05                	je     803baa <strtol+0xcc>
+		*endptr = (char *) s;
+  803ba5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ba8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803baa:	89 c8                	mov    %ecx,%eax
+  803bac:	f7 d8                	neg    %eax
+  803bae:	85 ff                	test   %edi,%edi
+  803bb0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803bb3:	89 c8                	mov    %ecx,%eax
+  803bb5:	5b                   	pop    %ebx
+  803bb6:	5e                   	pop    %esi
+  803bb7:	5f                   	pop    %edi
+  803bb8:	5d                   	pop    %ebp
+  803bb9:	c3                   	ret
+
+00803bba <atoi>:
+
+int
+atoi(const char* s)
+{
+  803bba:	55                   	push   %ebp
+  803bbb:	89 e5                	mov    %esp,%ebp
+  803bbd:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bc0:	6a 00                	push   $0x0
+  803bc2:	6a 00                	push   $0x0
+  803bc4:	ff 75 08             	push   0x8(%ebp)
+  803bc7:	e8 12 ff ff ff       	call   803ade <strtol>
+}
+  803bcc:	c9                   	leave
+  803bcd:	c3                   	ret
+
+00803bce <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bce:	55                   	push   %ebp
+  803bcf:	89 e5                	mov    %esp,%ebp
+  803bd1:	57                   	push   %edi
+  803bd2:	56                   	push   %esi
+  803bd3:	53                   	push   %ebx
+  803bd4:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bd7:	89 d6                	mov    %edx,%esi
+  803bd9:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bdc:	89 cf                	mov    %ecx,%edi
+  803bde:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803be1:	89 fa                	mov    %edi,%edx
+  803be3:	80 ce 08             	or     $0x8,%dh
+  803be6:	f6 c5 08             	test   $0x8,%ch
+  803be9:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bec:	57                   	push   %edi
+  803bed:	56                   	push   %esi
+  803bee:	50                   	push   %eax
+  803bef:	56                   	push   %esi
+  803bf0:	6a 00                	push   $0x0
+  803bf2:	e8 41 c6 ff ff       	call   800238 <sys_page_map>
+	if (r < 0) {
+  803bf7:	83 c4 20             	add    $0x20,%esp
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	78 27                	js     803c25 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bfe:	83 ec 0c             	sub    $0xc,%esp
+  803c01:	57                   	push   %edi
+  803c02:	56                   	push   %esi
+  803c03:	6a 00                	push   $0x0
+  803c05:	56                   	push   %esi
+  803c06:	6a 00                	push   $0x0
+  803c08:	e8 2b c6 ff ff       	call   800238 <sys_page_map>
+  803c0d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c0f:	83 c4 20             	add    $0x20,%esp
+  803c12:	85 c0                	test   %eax,%eax
+  803c14:	78 24                	js     803c3a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c16:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c1b:	89 d8                	mov    %ebx,%eax
+  803c1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c20:	5b                   	pop    %ebx
+  803c21:	5e                   	pop    %esi
+  803c22:	5f                   	pop    %edi
+  803c23:	5d                   	pop    %ebp
+  803c24:	c3                   	ret
+  803c25:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c27:	83 ec 08             	sub    $0x8,%esp
+  803c2a:	50                   	push   %eax
+  803c2b:	68 98 4c 80 00       	push   $0x804c98
+  803c30:	e8 71 f6 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803c35:	83 c4 10             	add    $0x10,%esp
+  803c38:	eb e1                	jmp    803c1b <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c3a:	83 ec 08             	sub    $0x8,%esp
+  803c3d:	50                   	push   %eax
+  803c3e:	68 c8 4c 80 00       	push   $0x804cc8
+  803c43:	e8 5e f6 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803c48:	83 c4 10             	add    $0x10,%esp
+  803c4b:	eb ce                	jmp    803c1b <duppage_cow+0x4d>
+
+00803c4d <duppage>:
+{
+  803c4d:	55                   	push   %ebp
+  803c4e:	89 e5                	mov    %esp,%ebp
+  803c50:	53                   	push   %ebx
+  803c51:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c54:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c57:	51                   	push   %ecx
+  803c58:	52                   	push   %edx
+  803c59:	50                   	push   %eax
+  803c5a:	52                   	push   %edx
+  803c5b:	6a 00                	push   $0x0
+  803c5d:	e8 d6 c5 ff ff       	call   800238 <sys_page_map>
+	if (r < 0) {
+  803c62:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c65:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c6a:	85 c0                	test   %eax,%eax
+  803c6c:	78 07                	js     803c75 <duppage+0x28>
+}
+  803c6e:	89 d8                	mov    %ebx,%eax
+  803c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c73:	c9                   	leave
+  803c74:	c3                   	ret
+  803c75:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c77:	83 ec 08             	sub    $0x8,%esp
+  803c7a:	50                   	push   %eax
+  803c7b:	68 98 4c 80 00       	push   $0x804c98
+  803c80:	e8 21 f6 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803c85:	83 c4 10             	add    $0x10,%esp
+  803c88:	eb e4                	jmp    803c6e <duppage+0x21>
+
+00803c8a <cow_copy>:
+{
+  803c8a:	55                   	push   %ebp
+  803c8b:	89 e5                	mov    %esp,%ebp
+  803c8d:	56                   	push   %esi
+  803c8e:	53                   	push   %ebx
+  803c8f:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c91:	83 ec 04             	sub    $0x4,%esp
+  803c94:	6a 07                	push   $0x7
+  803c96:	68 00 f0 7f 00       	push   $0x7ff000
+  803c9b:	6a 00                	push   $0x0
+  803c9d:	e8 49 c5 ff ff       	call   8001eb <sys_page_alloc>
+	if (r < 0) {
+  803ca2:	83 c4 10             	add    $0x10,%esp
+  803ca5:	85 c0                	test   %eax,%eax
+  803ca7:	78 58                	js     803d01 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803ca9:	83 ec 04             	sub    $0x4,%esp
+  803cac:	68 00 10 00 00       	push   $0x1000
+  803cb1:	56                   	push   %esi
+  803cb2:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb7:	e8 54 fd ff ff       	call   803a10 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cbc:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cc3:	56                   	push   %esi
+  803cc4:	6a 00                	push   $0x0
+  803cc6:	68 00 f0 7f 00       	push   $0x7ff000
+  803ccb:	6a 00                	push   $0x0
+  803ccd:	e8 66 c5 ff ff       	call   800238 <sys_page_map>
+  803cd2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd4:	83 c4 20             	add    $0x20,%esp
+  803cd7:	85 c0                	test   %eax,%eax
+  803cd9:	78 3b                	js     803d16 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cdb:	83 ec 08             	sub    $0x8,%esp
+  803cde:	68 00 f0 7f 00       	push   $0x7ff000
+  803ce3:	6a 00                	push   $0x0
+  803ce5:	e8 9a c5 ff ff       	call   800284 <sys_page_unmap>
+  803cea:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cec:	83 c4 10             	add    $0x10,%esp
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	78 45                	js     803d38 <cow_copy+0xae>
+	return 0;
+  803cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf8:	89 d8                	mov    %ebx,%eax
+  803cfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cfd:	5b                   	pop    %ebx
+  803cfe:	5e                   	pop    %esi
+  803cff:	5d                   	pop    %ebp
+  803d00:	c3                   	ret
+  803d01:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d03:	83 ec 08             	sub    $0x8,%esp
+  803d06:	50                   	push   %eax
+  803d07:	68 b8 4d 80 00       	push   $0x804db8
+  803d0c:	e8 95 f5 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803d11:	83 c4 10             	add    $0x10,%esp
+  803d14:	eb e2                	jmp    803cf8 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d16:	83 ec 08             	sub    $0x8,%esp
+  803d19:	50                   	push   %eax
+  803d1a:	68 d4 4d 80 00       	push   $0x804dd4
+  803d1f:	e8 82 f5 ff ff       	call   8032a6 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d24:	83 c4 08             	add    $0x8,%esp
+  803d27:	68 00 f0 7f 00       	push   $0x7ff000
+  803d2c:	6a 00                	push   $0x0
+  803d2e:	e8 51 c5 ff ff       	call   800284 <sys_page_unmap>
+		return r;
+  803d33:	83 c4 10             	add    $0x10,%esp
+  803d36:	eb c0                	jmp    803cf8 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d38:	83 ec 08             	sub    $0x8,%esp
+  803d3b:	50                   	push   %eax
+  803d3c:	68 f0 4c 80 00       	push   $0x804cf0
+  803d41:	e8 60 f5 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803d46:	83 c4 10             	add    $0x10,%esp
+  803d49:	eb ad                	jmp    803cf8 <cow_copy+0x6e>
+
+00803d4b <pgfault>:
+{
+  803d4b:	55                   	push   %ebp
+  803d4c:	89 e5                	mov    %esp,%ebp
+  803d4e:	56                   	push   %esi
+  803d4f:	53                   	push   %ebx
+  803d50:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d53:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d55:	89 d8                	mov    %ebx,%eax
+  803d57:	c1 e8 16             	shr    $0x16,%eax
+  803d5a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d61:	89 de                	mov    %ebx,%esi
+  803d63:	c1 ee 0c             	shr    $0xc,%esi
+  803d66:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d6d:	a8 07                	test   $0x7,%al
+  803d6f:	74 3b                	je     803dac <pgfault+0x61>
+  803d71:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d77:	74 33                	je     803dac <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d79:	83 ec 0c             	sub    $0xc,%esp
+  803d7c:	68 00 f0 bf ee       	push   $0xeebff000
+  803d81:	e8 c5 ea ff ff       	call   80284b <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d86:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d8d:	83 c4 10             	add    $0x10,%esp
+  803d90:	f6 c4 08             	test   $0x8,%ah
+  803d93:	75 30                	jne    803dc5 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d95:	83 ec 0c             	sub    $0xc,%esp
+  803d98:	68 00 f0 bf ee       	push   $0xeebff000
+  803d9d:	e8 16 eb ff ff       	call   8028b8 <mutex_unlock>
+}
+  803da2:	83 c4 10             	add    $0x10,%esp
+  803da5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da8:	5b                   	pop    %ebx
+  803da9:	5e                   	pop    %esi
+  803daa:	5d                   	pop    %ebp
+  803dab:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803dac:	83 ec 08             	sub    $0x8,%esp
+  803daf:	ff 72 28             	push   0x28(%edx)
+  803db2:	51                   	push   %ecx
+  803db3:	50                   	push   %eax
+  803db4:	68 14 4d 80 00       	push   $0x804d14
+  803db9:	6a 3f                	push   $0x3f
+  803dbb:	68 ee 4d 80 00       	push   $0x804dee
+  803dc0:	e8 06 f4 ff ff       	call   8031cb <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dc5:	89 d8                	mov    %ebx,%eax
+  803dc7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dcc:	e8 b9 fe ff ff       	call   803c8a <cow_copy>
+  803dd1:	eb c2                	jmp    803d95 <pgfault+0x4a>
+
+00803dd3 <cow_enable>:
+{
+  803dd3:	55                   	push   %ebp
+  803dd4:	89 e5                	mov    %esp,%ebp
+  803dd6:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dd9:	68 4b 3d 80 00       	push   $0x803d4b
+  803dde:	e8 28 06 00 00       	call   80440b <set_pgfault_handler>
+}
+  803de3:	83 c4 10             	add    $0x10,%esp
+  803de6:	c9                   	leave
+  803de7:	c3                   	ret
+
+00803de8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803de8:	55                   	push   %ebp
+  803de9:	89 e5                	mov    %esp,%ebp
+  803deb:	57                   	push   %edi
+  803dec:	56                   	push   %esi
+  803ded:	53                   	push   %ebx
+  803dee:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803df1:	68 4b 3d 80 00       	push   $0x803d4b
+  803df6:	e8 10 06 00 00       	call   80440b <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803dfb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e00:	cd 30                	int    $0x30
+  803e02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	85 c0                	test   %eax,%eax
+  803e0a:	78 4b                	js     803e57 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e0c:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e16:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e19:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e1d:	0f 85 16 01 00 00    	jne    803f39 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e23:	e8 6b c3 ff ff       	call   800193 <sys_getenvid>
+  803e28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e2d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e2f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e35:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e3b:	77 32                	ja     803e6f <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e3d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e42:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e44:	c1 ea 10             	shr    $0x10,%edx
+  803e47:	74 26                	je     803e6f <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e49:	c1 e2 10             	shl    $0x10,%edx
+  803e4c:	89 d1                	mov    %edx,%ecx
+  803e4e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e53:	29 ca                	sub    %ecx,%edx
+  803e55:	eb 1e                	jmp    803e75 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e57:	83 ec 08             	sub    $0x8,%esp
+  803e5a:	89 c7                	mov    %eax,%edi
+  803e5c:	50                   	push   %eax
+  803e5d:	68 f9 4d 80 00       	push   $0x804df9
+  803e62:	e8 3f f4 ff ff       	call   8032a6 <cprintf>
+		return eid;
+  803e67:	83 c4 10             	add    $0x10,%esp
+  803e6a:	e9 6c 01 00 00       	jmp    803fdb <fork+0x1f3>
+		return pthread_main_tls;
+  803e6f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e75:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e78:	c1 e0 04             	shl    $0x4,%eax
+  803e7b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e80:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e82:	e8 0d f1 ff ff       	call   802f94 <pthread_fork_child>
+		return eid;
+  803e87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e8a:	e9 4c 01 00 00       	jmp    803fdb <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e8f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e95:	89 da                	mov    %ebx,%edx
+  803e97:	89 f8                	mov    %edi,%eax
+  803e99:	e8 af fd ff ff       	call   803c4d <duppage>
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	79 28                	jns    803eca <fork+0xe2>
+  803ea2:	89 c7                	mov    %eax,%edi
+  803ea4:	e9 32 01 00 00       	jmp    803fdb <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ea9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eaf:	83 f9 05             	cmp    $0x5,%ecx
+  803eb2:	75 58                	jne    803f0c <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803eb4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803eb9:	89 da                	mov    %ebx,%edx
+  803ebb:	89 f8                	mov    %edi,%eax
+  803ebd:	e8 8b fd ff ff       	call   803c4d <duppage>
+  803ec2:	85 c0                	test   %eax,%eax
+  803ec4:	0f 88 0f 01 00 00    	js     803fd9 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eca:	83 c3 01             	add    $0x1,%ebx
+  803ecd:	39 de                	cmp    %ebx,%esi
+  803ecf:	74 54                	je     803f25 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ed1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ed8:	f6 c1 05             	test   $0x5,%cl
+  803edb:	74 ed                	je     803eca <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803edd:	f6 c5 04             	test   $0x4,%ch
+  803ee0:	75 ad                	jne    803e8f <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ee2:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ee8:	74 bf                	je     803ea9 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803eea:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ef0:	74 d8                	je     803eca <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ef2:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ef8:	89 da                	mov    %ebx,%edx
+  803efa:	89 f8                	mov    %edi,%eax
+  803efc:	e8 cd fc ff ff       	call   803bce <duppage_cow>
+  803f01:	85 c0                	test   %eax,%eax
+  803f03:	79 c5                	jns    803eca <fork+0xe2>
+  803f05:	89 c7                	mov    %eax,%edi
+  803f07:	e9 cf 00 00 00       	jmp    803fdb <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f0c:	68 44 4d 80 00       	push   $0x804d44
+  803f11:	68 c1 47 80 00       	push   $0x8047c1
+  803f16:	68 c6 00 00 00       	push   $0xc6
+  803f1b:	68 ee 4d 80 00       	push   $0x804dee
+  803f20:	e8 a6 f2 ff ff       	call   8031cb <_panic>
+  803f25:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f28:	83 c1 01             	add    $0x1,%ecx
+  803f2b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f31:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f37:	74 18                	je     803f51 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f39:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f40:	a8 07                	test   $0x7,%al
+  803f42:	74 e4                	je     803f28 <fork+0x140>
+  803f44:	89 cb                	mov    %ecx,%ebx
+  803f46:	c1 e3 0a             	shl    $0xa,%ebx
+  803f49:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f4c:	e9 7c ff ff ff       	jmp    803ecd <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f51:	83 ec 04             	sub    $0x4,%esp
+  803f54:	6a 07                	push   $0x7
+  803f56:	68 00 f0 bf ee       	push   $0xeebff000
+  803f5b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5e:	e8 88 c2 ff ff       	call   8001eb <sys_page_alloc>
+  803f63:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	78 34                	js     803fa0 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f6c:	83 ec 08             	sub    $0x8,%esp
+  803f6f:	68 49 44 80 00       	push   $0x804449
+  803f74:	ff 75 e4             	push   -0x1c(%ebp)
+  803f77:	e8 ec c3 ff ff       	call   800368 <sys_env_set_pgfault_upcall>
+  803f7c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7e:	83 c4 10             	add    $0x10,%esp
+  803f81:	85 c0                	test   %eax,%eax
+  803f83:	78 2e                	js     803fb3 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f85:	83 ec 08             	sub    $0x8,%esp
+  803f88:	6a 02                	push   $0x2
+  803f8a:	ff 75 e4             	push   -0x1c(%ebp)
+  803f8d:	e8 3e c3 ff ff       	call   8002d0 <sys_env_set_status>
+  803f92:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f94:	83 c4 10             	add    $0x10,%esp
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	78 2b                	js     803fc6 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f9b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f9e:	eb 3b                	jmp    803fdb <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fa0:	83 ec 08             	sub    $0x8,%esp
+  803fa3:	50                   	push   %eax
+  803fa4:	68 6c 4d 80 00       	push   $0x804d6c
+  803fa9:	e8 f8 f2 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803fae:	83 c4 10             	add    $0x10,%esp
+  803fb1:	eb 28                	jmp    803fdb <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fb3:	83 ec 08             	sub    $0x8,%esp
+  803fb6:	50                   	push   %eax
+  803fb7:	68 94 4d 80 00       	push   $0x804d94
+  803fbc:	e8 e5 f2 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803fc1:	83 c4 10             	add    $0x10,%esp
+  803fc4:	eb 15                	jmp    803fdb <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fc6:	83 ec 08             	sub    $0x8,%esp
+  803fc9:	50                   	push   %eax
+  803fca:	68 09 4e 80 00       	push   $0x804e09
+  803fcf:	e8 d2 f2 ff ff       	call   8032a6 <cprintf>
+		return r;
+  803fd4:	83 c4 10             	add    $0x10,%esp
+  803fd7:	eb 02                	jmp    803fdb <fork+0x1f3>
+  803fd9:	89 c7                	mov    %eax,%edi
+}
+  803fdb:	89 f8                	mov    %edi,%eax
+  803fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fe0:	5b                   	pop    %ebx
+  803fe1:	5e                   	pop    %esi
+  803fe2:	5f                   	pop    %edi
+  803fe3:	5d                   	pop    %ebp
+  803fe4:	c3                   	ret
+
+00803fe5 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fe5:	55                   	push   %ebp
+  803fe6:	89 e5                	mov    %esp,%ebp
+  803fe8:	57                   	push   %edi
+  803fe9:	56                   	push   %esi
+  803fea:	53                   	push   %ebx
+  803feb:	83 ec 2c             	sub    $0x2c,%esp
+  803fee:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ff0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ffb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804001:	77 0a                	ja     80400d <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804003:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804008:	29 c3                	sub    %eax,%ebx
+  80400a:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80400d:	83 ec 0c             	sub    $0xc,%esp
+  804010:	68 4b 3d 80 00       	push   $0x803d4b
+  804015:	e8 f1 03 00 00       	call   80440b <set_pgfault_handler>
+  80401a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80401f:	cd 30                	int    $0x30
+  804021:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804024:	83 c4 10             	add    $0x10,%esp
+  804027:	85 c0                	test   %eax,%eax
+  804029:	78 30                	js     80405b <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80402b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80402f:	74 42                	je     804073 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804031:	c1 e3 10             	shl    $0x10,%ebx
+  804034:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804039:	29 d8                	sub    %ebx,%eax
+  80403b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80403e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804043:	29 d8                	sub    %ebx,%eax
+  804045:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804048:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80404d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804052:	89 f7                	mov    %esi,%edi
+  804054:	89 d6                	mov    %edx,%esi
+  804056:	e9 2c 01 00 00       	jmp    804187 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	89 c7                	mov    %eax,%edi
+  804060:	50                   	push   %eax
+  804061:	68 f9 4d 80 00       	push   $0x804df9
+  804066:	e8 3b f2 ff ff       	call   8032a6 <cprintf>
+		return eid;
+  80406b:	83 c4 10             	add    $0x10,%esp
+  80406e:	e9 d5 00 00 00       	jmp    804148 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804073:	e8 1b c1 ff ff       	call   800193 <sys_getenvid>
+  804078:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80407d:	89 c2                	mov    %eax,%edx
+  80407f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804081:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804087:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80408c:	77 18                	ja     8040a6 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80408e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804093:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804095:	c1 e8 10             	shr    $0x10,%eax
+  804098:	74 0c                	je     8040a6 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80409a:	c1 e0 10             	shl    $0x10,%eax
+  80409d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040a2:	29 c1                	sub    %eax,%ecx
+  8040a4:	eb 06                	jmp    8040ac <sfork+0xc7>
+		return pthread_main_tls;
+  8040a6:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040ac:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040af:	c1 e0 04             	shl    $0x4,%eax
+  8040b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040b7:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040b9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040bc:	e9 87 00 00 00       	jmp    804148 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040c1:	f6 c5 04             	test   $0x4,%ch
+  8040c4:	74 6c                	je     804132 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040c6:	89 ca                	mov    %ecx,%edx
+  8040c8:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040ce:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040d4:	74 7c                	je     804152 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040d6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040dc:	89 da                	mov    %ebx,%edx
+  8040de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040e1:	e8 67 fb ff ff       	call   803c4d <duppage>
+  8040e6:	85 c0                	test   %eax,%eax
+  8040e8:	0f 88 4f 01 00 00    	js     80423d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040ee:	83 c3 01             	add    $0x1,%ebx
+  8040f1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040f4:	74 7a                	je     804170 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040f6:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040f8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040ff:	f6 c1 01             	test   $0x1,%cl
+  804102:	74 ea                	je     8040ee <sfork+0x109>
+  804104:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80410a:	74 e2                	je     8040ee <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80410c:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804112:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804115:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80411a:	76 a5                	jbe    8040c1 <sfork+0xdc>
+  80411c:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804122:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804125:	39 fa                	cmp    %edi,%edx
+  804127:	73 9d                	jae    8040c6 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804129:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80412c:	39 fa                	cmp    %edi,%edx
+  80412e:	72 96                	jb     8040c6 <sfork+0xe1>
+  804130:	eb 8f                	jmp    8040c1 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804132:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804138:	89 da                	mov    %ebx,%edx
+  80413a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80413d:	e8 8c fa ff ff       	call   803bce <duppage_cow>
+  804142:	85 c0                	test   %eax,%eax
+  804144:	79 a8                	jns    8040ee <sfork+0x109>
+  804146:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804148:	89 f8                	mov    %edi,%eax
+  80414a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80414d:	5b                   	pop    %ebx
+  80414e:	5e                   	pop    %esi
+  80414f:	5f                   	pop    %edi
+  804150:	5d                   	pop    %ebp
+  804151:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804152:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804157:	e8 2e fb ff ff       	call   803c8a <cow_copy>
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	0f 88 d2 00 00 00    	js     804236 <sfork+0x251>
+				pte = uvpt[pn];
+  804164:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80416b:	e9 66 ff ff ff       	jmp    8040d6 <sfork+0xf1>
+  804170:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804173:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804176:	83 c6 01             	add    $0x1,%esi
+  804179:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80417f:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804185:	74 1b                	je     8041a2 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804187:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80418e:	a8 01                	test   $0x1,%al
+  804190:	74 e4                	je     804176 <sfork+0x191>
+  804192:	89 f3                	mov    %esi,%ebx
+  804194:	c1 e3 0a             	shl    $0xa,%ebx
+  804197:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80419a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80419d:	e9 4f ff ff ff       	jmp    8040f1 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041a2:	83 ec 04             	sub    $0x4,%esp
+  8041a5:	6a 07                	push   $0x7
+  8041a7:	68 00 f0 bf ee       	push   $0xeebff000
+  8041ac:	ff 75 e0             	push   -0x20(%ebp)
+  8041af:	e8 37 c0 ff ff       	call   8001eb <sys_page_alloc>
+  8041b4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041b6:	83 c4 10             	add    $0x10,%esp
+  8041b9:	85 c0                	test   %eax,%eax
+  8041bb:	78 37                	js     8041f4 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041bd:	83 ec 08             	sub    $0x8,%esp
+  8041c0:	68 49 44 80 00       	push   $0x804449
+  8041c5:	ff 75 e0             	push   -0x20(%ebp)
+  8041c8:	e8 9b c1 ff ff       	call   800368 <sys_env_set_pgfault_upcall>
+  8041cd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cf:	83 c4 10             	add    $0x10,%esp
+  8041d2:	85 c0                	test   %eax,%eax
+  8041d4:	78 34                	js     80420a <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041d6:	83 ec 08             	sub    $0x8,%esp
+  8041d9:	6a 02                	push   $0x2
+  8041db:	ff 75 e0             	push   -0x20(%ebp)
+  8041de:	e8 ed c0 ff ff       	call   8002d0 <sys_env_set_status>
+  8041e3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041e5:	83 c4 10             	add    $0x10,%esp
+  8041e8:	85 c0                	test   %eax,%eax
+  8041ea:	78 34                	js     804220 <sfork+0x23b>
+	return eid;
+  8041ec:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041ef:	e9 54 ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041f4:	83 ec 08             	sub    $0x8,%esp
+  8041f7:	50                   	push   %eax
+  8041f8:	68 6c 4d 80 00       	push   $0x804d6c
+  8041fd:	e8 a4 f0 ff ff       	call   8032a6 <cprintf>
+		return r;
+  804202:	83 c4 10             	add    $0x10,%esp
+  804205:	e9 3e ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80420a:	83 ec 08             	sub    $0x8,%esp
+  80420d:	50                   	push   %eax
+  80420e:	68 94 4d 80 00       	push   $0x804d94
+  804213:	e8 8e f0 ff ff       	call   8032a6 <cprintf>
+		return r;
+  804218:	83 c4 10             	add    $0x10,%esp
+  80421b:	e9 28 ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804220:	83 ec 08             	sub    $0x8,%esp
+  804223:	50                   	push   %eax
+  804224:	68 09 4e 80 00       	push   $0x804e09
+  804229:	e8 78 f0 ff ff       	call   8032a6 <cprintf>
+		return r;
+  80422e:	83 c4 10             	add    $0x10,%esp
+  804231:	e9 12 ff ff ff       	jmp    804148 <sfork+0x163>
+  804236:	89 c7                	mov    %eax,%edi
+  804238:	e9 0b ff ff ff       	jmp    804148 <sfork+0x163>
+  80423d:	89 c7                	mov    %eax,%edi
+  80423f:	e9 04 ff ff ff       	jmp    804148 <sfork+0x163>
+
+00804244 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804244:	55                   	push   %ebp
+  804245:	89 e5                	mov    %esp,%ebp
+  804247:	57                   	push   %edi
+  804248:	56                   	push   %esi
+  804249:	53                   	push   %ebx
+  80424a:	83 ec 18             	sub    $0x18,%esp
+  80424d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804250:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804253:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804256:	85 c0                	test   %eax,%eax
+  804258:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80425d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804260:	50                   	push   %eax
+  804261:	e8 7b c1 ff ff       	call   8003e1 <sys_ipc_recv>
+	if (r < 0) {
+  804266:	83 c4 10             	add    $0x10,%esp
+  804269:	85 c0                	test   %eax,%eax
+  80426b:	78 2b                	js     804298 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80426d:	85 ff                	test   %edi,%edi
+  80426f:	74 55                	je     8042c6 <ipc_recv+0x82>
+  804271:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804273:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804279:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80427e:	77 39                	ja     8042b9 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804280:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804285:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804287:	c1 e8 10             	shr    $0x10,%eax
+  80428a:	74 2d                	je     8042b9 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80428c:	c1 e0 10             	shl    $0x10,%eax
+  80428f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804294:	29 c2                	sub    %eax,%edx
+  804296:	eb 27                	jmp    8042bf <ipc_recv+0x7b>
+  804298:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80429a:	83 ec 08             	sub    $0x8,%esp
+  80429d:	50                   	push   %eax
+  80429e:	68 27 4e 80 00       	push   $0x804e27
+  8042a3:	e8 fe ef ff ff       	call   8032a6 <cprintf>
+		*from_env_store = 0;
+  8042a8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042ae:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042b4:	83 c4 10             	add    $0x10,%esp
+  8042b7:	eb 77                	jmp    804330 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042b9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042bf:	8b 02                	mov    (%edx),%eax
+  8042c1:	8b 40 78             	mov    0x78(%eax),%eax
+  8042c4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042c6:	85 f6                	test   %esi,%esi
+  8042c8:	74 34                	je     8042fe <ipc_recv+0xba>
+  8042ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d7:	77 18                	ja     8042f1 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042e0:	c1 e8 10             	shr    $0x10,%eax
+  8042e3:	74 0c                	je     8042f1 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042e5:	c1 e0 10             	shl    $0x10,%eax
+  8042e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042ed:	29 c2                	sub    %eax,%edx
+  8042ef:	eb 06                	jmp    8042f7 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042f1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042f7:	8b 02                	mov    (%edx),%eax
+  8042f9:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042fc:	89 06                	mov    %eax,(%esi)
+  8042fe:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804300:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804306:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80430b:	77 18                	ja     804325 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80430d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804312:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804314:	c1 e8 10             	shr    $0x10,%eax
+  804317:	74 0c                	je     804325 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804319:	c1 e0 10             	shl    $0x10,%eax
+  80431c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804321:	29 c2                	sub    %eax,%edx
+  804323:	eb 06                	jmp    80432b <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804325:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80432b:	8b 02                	mov    (%edx),%eax
+  80432d:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804330:	89 d8                	mov    %ebx,%eax
+  804332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804335:	5b                   	pop    %ebx
+  804336:	5e                   	pop    %esi
+  804337:	5f                   	pop    %edi
+  804338:	5d                   	pop    %ebp
+  804339:	c3                   	ret
+
+0080433a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80433a:	55                   	push   %ebp
+  80433b:	89 e5                	mov    %esp,%ebp
+  80433d:	57                   	push   %edi
+  80433e:	56                   	push   %esi
+  80433f:	53                   	push   %ebx
+  804340:	83 ec 0c             	sub    $0xc,%esp
+  804343:	8b 75 08             	mov    0x8(%ebp),%esi
+  804346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804349:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80434c:	85 db                	test   %ebx,%ebx
+  80434e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804353:	0f 44 d8             	cmove  %eax,%ebx
+  804356:	eb 05                	jmp    80435d <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804358:	e8 62 be ff ff       	call   8001bf <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80435d:	57                   	push   %edi
+  80435e:	53                   	push   %ebx
+  80435f:	ff 75 0c             	push   0xc(%ebp)
+  804362:	56                   	push   %esi
+  804363:	e8 4c c0 ff ff       	call   8003b4 <sys_ipc_try_send>
+		if (r == 0) {
+  804368:	83 c4 10             	add    $0x10,%esp
+  80436b:	85 c0                	test   %eax,%eax
+  80436d:	74 19                	je     804388 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80436f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804372:	74 e4                	je     804358 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804374:	83 ec 0c             	sub    $0xc,%esp
+  804377:	50                   	push   %eax
+  804378:	57                   	push   %edi
+  804379:	53                   	push   %ebx
+  80437a:	56                   	push   %esi
+  80437b:	68 40 4e 80 00       	push   $0x804e40
+  804380:	e8 21 ef ff ff       	call   8032a6 <cprintf>
+			return;
+  804385:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80438b:	5b                   	pop    %ebx
+  80438c:	5e                   	pop    %esi
+  80438d:	5f                   	pop    %edi
+  80438e:	5d                   	pop    %ebp
+  80438f:	c3                   	ret
+
+00804390 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804390:	55                   	push   %ebp
+  804391:	89 e5                	mov    %esp,%ebp
+  804393:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804396:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80439b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80439e:	c1 e0 04             	shl    $0x4,%eax
+  8043a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043a6:	8b 40 50             	mov    0x50(%eax),%eax
+  8043a9:	39 c8                	cmp    %ecx,%eax
+  8043ab:	74 12                	je     8043bf <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043ad:	83 c2 01             	add    $0x1,%edx
+  8043b0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043b6:	75 e3                	jne    80439b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bd:	eb 0e                	jmp    8043cd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043bf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043c2:	c1 e0 04             	shl    $0x4,%eax
+  8043c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043ca:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043cd:	5d                   	pop    %ebp
+  8043ce:	c3                   	ret
+
+008043cf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043cf:	55                   	push   %ebp
+  8043d0:	89 e5                	mov    %esp,%ebp
+  8043d2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043d5:	89 c2                	mov    %eax,%edx
+  8043d7:	c1 ea 16             	shr    $0x16,%edx
+  8043da:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043e6:	f6 c1 01             	test   $0x1,%cl
+  8043e9:	74 1c                	je     804407 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043eb:	c1 e8 0c             	shr    $0xc,%eax
+  8043ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043f5:	a8 01                	test   $0x1,%al
+  8043f7:	74 0e                	je     804407 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043f9:	c1 e8 0c             	shr    $0xc,%eax
+  8043fc:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804403:	ef 
+  804404:	0f b7 d2             	movzwl %dx,%edx
+}
+  804407:	89 d0                	mov    %edx,%eax
+  804409:	5d                   	pop    %ebp
+  80440a:	c3                   	ret
+
+0080440b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80440b:	55                   	push   %ebp
+  80440c:	89 e5                	mov    %esp,%ebp
+  80440e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804411:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804418:	74 0a                	je     804424 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80441a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80441d:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804422:	c9                   	leave
+  804423:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804424:	83 ec 04             	sub    $0x4,%esp
+  804427:	6a 07                	push   $0x7
+  804429:	68 00 f0 bf ee       	push   $0xeebff000
+  80442e:	6a 00                	push   $0x0
+  804430:	e8 b6 bd ff ff       	call   8001eb <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804435:	83 c4 08             	add    $0x8,%esp
+  804438:	68 49 44 80 00       	push   $0x804449
+  80443d:	6a 00                	push   $0x0
+  80443f:	e8 24 bf ff ff       	call   800368 <sys_env_set_pgfault_upcall>
+  804444:	83 c4 10             	add    $0x10,%esp
+  804447:	eb d1                	jmp    80441a <set_pgfault_handler+0xf>
+
+00804449 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804449:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80444a:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80444f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804451:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804454:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804458:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80445c:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80445f:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804463:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804465:	83 c4 08             	add    $0x8,%esp
+	popal
+  804468:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804469:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80446c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80446d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80446e:	c3                   	ret
+
+0080446f <udm>:
+  80446f:	57                   	push   %edi
+  804470:	56                   	push   %esi
+  804471:	53                   	push   %ebx
+  804472:	83 ec 20             	sub    $0x20,%esp
+  804475:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804479:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80447d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804481:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804485:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804489:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80448d:	89 d1                	mov    %edx,%ecx
+  80448f:	09 c1                	or     %eax,%ecx
+  804491:	0f 84 91 00 00 00    	je     804528 <udm+0xb9>
+  804497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044a6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044ad:	00 
+  8044ae:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044b5:	00 
+  8044b6:	eb 08                	jmp    8044c0 <udm+0x51>
+  8044b8:	83 e9 01             	sub    $0x1,%ecx
+  8044bb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044be:	74 7c                	je     80453c <udm+0xcd>
+  8044c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044c4:	01 c0                	add    %eax,%eax
+  8044c6:	89 c6                	mov    %eax,%esi
+  8044c8:	89 d7                	mov    %edx,%edi
+  8044ca:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044ce:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044d5:	d3 ea                	shr    %cl,%edx
+  8044d7:	f6 c1 20             	test   $0x20,%cl
+  8044da:	74 04                	je     8044e0 <udm+0x71>
+  8044dc:	89 d0                	mov    %edx,%eax
+  8044de:	31 d2                	xor    %edx,%edx
+  8044e0:	83 e0 01             	and    $0x1,%eax
+  8044e3:	89 04 24             	mov    %eax,(%esp)
+  8044e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044ed:	00 
+  8044ee:	8b 04 24             	mov    (%esp),%eax
+  8044f1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044f5:	09 f0                	or     %esi,%eax
+  8044f7:	09 fa                	or     %edi,%edx
+  8044f9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044fd:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804501:	39 f0                	cmp    %esi,%eax
+  804503:	89 d3                	mov    %edx,%ebx
+  804505:	19 fb                	sbb    %edi,%ebx
+  804507:	72 af                	jb     8044b8 <udm+0x49>
+  804509:	29 f0                	sub    %esi,%eax
+  80450b:	19 fa                	sbb    %edi,%edx
+  80450d:	89 cf                	mov    %ecx,%edi
+  80450f:	c1 ef 05             	shr    $0x5,%edi
+  804512:	83 e7 01             	and    $0x1,%edi
+  804515:	89 fe                	mov    %edi,%esi
+  804517:	83 f6 01             	xor    $0x1,%esi
+  80451a:	d3 e6                	shl    %cl,%esi
+  80451c:	d3 e7                	shl    %cl,%edi
+  80451e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804522:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804526:	eb 90                	jmp    8044b8 <udm+0x49>
+  804528:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80452c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804530:	89 f0                	mov    %esi,%eax
+  804532:	89 fa                	mov    %edi,%edx
+  804534:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804538:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80453c:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804540:	89 01                	mov    %eax,(%ecx)
+  804542:	89 51 04             	mov    %edx,0x4(%ecx)
+  804545:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804549:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80454d:	83 c4 20             	add    $0x20,%esp
+  804550:	5b                   	pop    %ebx
+  804551:	5e                   	pop    %esi
+  804552:	5f                   	pop    %edi
+  804553:	c3                   	ret
+
+00804554 <__udivdi3>:
+  804554:	83 ec 18             	sub    $0x18,%esp
+  804557:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80455b:	50                   	push   %eax
+  80455c:	ff 74 24 2c          	push   0x2c(%esp)
+  804560:	ff 74 24 2c          	push   0x2c(%esp)
+  804564:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804568:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80456c:	e8 fe fe ff ff       	call   80446f <udm>
+  804571:	83 c4 24             	add    $0x24,%esp
+  804574:	c3                   	ret
+
+00804575 <__umoddi3>:
+  804575:	83 ec 18             	sub    $0x18,%esp
+  804578:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80457c:	50                   	push   %eax
+  80457d:	ff 74 24 2c          	push   0x2c(%esp)
+  804581:	ff 74 24 2c          	push   0x2c(%esp)
+  804585:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804589:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80458d:	e8 dd fe ff ff       	call   80446f <udm>
+  804592:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804596:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80459a:	83 c4 24             	add    $0x24,%esp
+  80459d:	c3                   	ret
+
+0080459e <__divdi3>:
+  80459e:	56                   	push   %esi
+  80459f:	53                   	push   %ebx
+  8045a0:	83 ec 14             	sub    $0x14,%esp
+  8045a3:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045a7:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045ab:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045af:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045b3:	85 d2                	test   %edx,%edx
+  8045b5:	78 18                	js     8045cf <__divdi3+0x31>
+  8045b7:	85 db                	test   %ebx,%ebx
+  8045b9:	78 3e                	js     8045f9 <__divdi3+0x5b>
+  8045bb:	83 ec 04             	sub    $0x4,%esp
+  8045be:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c2:	56                   	push   %esi
+  8045c3:	53                   	push   %ebx
+  8045c4:	51                   	push   %ecx
+  8045c5:	e8 a5 fe ff ff       	call   80446f <udm>
+  8045ca:	83 c4 10             	add    $0x10,%esp
+  8045cd:	eb 24                	jmp    8045f3 <__divdi3+0x55>
+  8045cf:	f7 d8                	neg    %eax
+  8045d1:	83 d2 00             	adc    $0x0,%edx
+  8045d4:	f7 da                	neg    %edx
+  8045d6:	85 db                	test   %ebx,%ebx
+  8045d8:	78 3a                	js     804614 <__divdi3+0x76>
+  8045da:	83 ec 04             	sub    $0x4,%esp
+  8045dd:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e1:	56                   	push   %esi
+  8045e2:	53                   	push   %ebx
+  8045e3:	51                   	push   %ecx
+  8045e4:	e8 86 fe ff ff       	call   80446f <udm>
+  8045e9:	83 c4 10             	add    $0x10,%esp
+  8045ec:	f7 d8                	neg    %eax
+  8045ee:	83 d2 00             	adc    $0x0,%edx
+  8045f1:	f7 da                	neg    %edx
+  8045f3:	83 c4 14             	add    $0x14,%esp
+  8045f6:	5b                   	pop    %ebx
+  8045f7:	5e                   	pop    %esi
+  8045f8:	c3                   	ret
+  8045f9:	83 ec 04             	sub    $0x4,%esp
+  8045fc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804600:	56                   	push   %esi
+  804601:	f7 d9                	neg    %ecx
+  804603:	83 d3 00             	adc    $0x0,%ebx
+  804606:	f7 db                	neg    %ebx
+  804608:	53                   	push   %ebx
+  804609:	51                   	push   %ecx
+  80460a:	e8 60 fe ff ff       	call   80446f <udm>
+  80460f:	83 c4 10             	add    $0x10,%esp
+  804612:	eb d8                	jmp    8045ec <__divdi3+0x4e>
+  804614:	83 ec 04             	sub    $0x4,%esp
+  804617:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80461b:	56                   	push   %esi
+  80461c:	f7 d9                	neg    %ecx
+  80461e:	83 d3 00             	adc    $0x0,%ebx
+  804621:	f7 db                	neg    %ebx
+  804623:	53                   	push   %ebx
+  804624:	51                   	push   %ecx
+  804625:	e8 45 fe ff ff       	call   80446f <udm>
+  80462a:	83 c4 10             	add    $0x10,%esp
+  80462d:	eb c4                	jmp    8045f3 <__divdi3+0x55>
+
+0080462f <__moddi3>:
+  80462f:	55                   	push   %ebp
+  804630:	57                   	push   %edi
+  804631:	56                   	push   %esi
+  804632:	53                   	push   %ebx
+  804633:	83 ec 24             	sub    $0x24,%esp
+  804636:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80463a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80463e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804642:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804646:	85 d2                	test   %edx,%edx
+  804648:	78 3b                	js     804685 <__moddi3+0x56>
+  80464a:	83 ec 04             	sub    $0x4,%esp
+  80464d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804651:	56                   	push   %esi
+  804652:	89 ce                	mov    %ecx,%esi
+  804654:	f7 de                	neg    %esi
+  804656:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80465a:	89 de                	mov    %ebx,%esi
+  80465c:	83 d6 00             	adc    $0x0,%esi
+  80465f:	f7 de                	neg    %esi
+  804661:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804665:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804669:	0f 48 f1             	cmovs  %ecx,%esi
+  80466c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804671:	53                   	push   %ebx
+  804672:	56                   	push   %esi
+  804673:	e8 f7 fd ff ff       	call   80446f <udm>
+  804678:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80467c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804680:	83 c4 10             	add    $0x10,%esp
+  804683:	eb 47                	jmp    8046cc <__moddi3+0x9d>
+  804685:	f7 d8                	neg    %eax
+  804687:	83 d2 00             	adc    $0x0,%edx
+  80468a:	f7 da                	neg    %edx
+  80468c:	83 ec 04             	sub    $0x4,%esp
+  80468f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804693:	56                   	push   %esi
+  804694:	89 cf                	mov    %ecx,%edi
+  804696:	f7 df                	neg    %edi
+  804698:	89 de                	mov    %ebx,%esi
+  80469a:	83 d6 00             	adc    $0x0,%esi
+  80469d:	f7 de                	neg    %esi
+  80469f:	0f 49 cf             	cmovns %edi,%ecx
+  8046a2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046a6:	0f 49 de             	cmovns %esi,%ebx
+  8046a9:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046ad:	ff 74 24 0c          	push   0xc(%esp)
+  8046b1:	ff 74 24 0c          	push   0xc(%esp)
+  8046b5:	e8 b5 fd ff ff       	call   80446f <udm>
+  8046ba:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046be:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046c2:	f7 d8                	neg    %eax
+  8046c4:	83 d2 00             	adc    $0x0,%edx
+  8046c7:	f7 da                	neg    %edx
+  8046c9:	83 c4 10             	add    $0x10,%esp
+  8046cc:	83 c4 24             	add    $0x24,%esp
+  8046cf:	5b                   	pop    %ebx
+  8046d0:	5e                   	pop    %esi
+  8046d1:	5f                   	pop    %edi
+  8046d2:	5d                   	pop    %ebp
+  8046d3:	c3                   	ret
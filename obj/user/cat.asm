@@ -0,0 +1,9978 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 c0 72 80 00       	push   $0x8072c0
+  800048:	56                   	push   %esi
+  800049:	e8 2e 14 00 00       	call   80147c <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 c0 72 80 00       	push   $0x8072c0
+  800060:	6a 01                	push   $0x1
+  800062:	e8 0d 15 00 00       	call   801574 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 e0 48 80 00       	push   $0x8048e0
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 fb 48 80 00       	push   $0x8048fb
+  800081:	e8 4a 01 00 00       	call   8001d0 <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 06 49 80 00       	push   $0x804906
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 fb 48 80 00       	push   $0x8048fb
+  8000a2:	e8 29 01 00 00       	call   8001d0 <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 60 80 00 1b 	movl   $0x80491b,0x806000
+  8000ba:	49 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 1f 49 80 00       	push   $0x80491f
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 27 49 80 00       	push   $0x804927
+  8000ee:	e8 12 1f 00 00       	call   802005 <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 b9 19 00 00       	call   801ac4 <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 18 12 00 00       	call   801340 <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	57                   	push   %edi
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	83 ec 1c             	sub    $0x1c,%esp
+  800136:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800139:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80013c:	e8 34 0b 00 00       	call   800c75 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800141:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800144:	89 15 c0 92 80 00    	mov    %edx,0x8092c0
+	thisenv = &envs[ENVX(eid)];
+  80014a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80014f:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800151:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800153:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800159:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80015e:	77 16                	ja     800176 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800160:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800165:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800167:	c1 e8 10             	shr    $0x10,%eax
+  80016a:	74 0a                	je     800176 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80016c:	c1 e0 10             	shl    $0x10,%eax
+  80016f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800174:	29 c2                	sub    %eax,%edx
+  800176:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800179:	c1 e0 04             	shl    $0x4,%eax
+  80017c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800181:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800183:	85 db                	test   %ebx,%ebx
+  800185:	7e 07                	jle    80018e <libmain+0x61>
+		binaryname = argv[0];
+  800187:	8b 06                	mov    (%esi),%eax
+  800189:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	56                   	push   %esi
+  800192:	53                   	push   %ebx
+  800193:	e8 0f ff ff ff       	call   8000a7 <umain>
+
+	// exit gracefully
+	exit();
+  800198:	e8 0b 00 00 00       	call   8001a8 <exit>
+}
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a3:	5b                   	pop    %ebx
+  8001a4:	5e                   	pop    %esi
+  8001a5:	5f                   	pop    %edi
+  8001a6:	5d                   	pop    %ebp
+  8001a7:	c3                   	ret
+
+008001a8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8001ae:	6a 00                	push   $0x0
+  8001b0:	e8 29 22 00 00       	call   8023de <fflush>
+	pthread_kill_others();
+  8001b5:	e8 94 38 00 00       	call   803a4e <pthread_kill_others>
+	close_all();
+  8001ba:	e8 ae 11 00 00       	call   80136d <close_all>
+	sys_env_destroy(0);
+  8001bf:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001c6:	e8 5f 0a 00 00       	call   800c2a <sys_env_destroy>
+}
+  8001cb:	83 c4 10             	add    $0x10,%esp
+  8001ce:	c9                   	leave
+  8001cf:	c3                   	ret
+
+008001d0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001d0:	55                   	push   %ebp
+  8001d1:	89 e5                	mov    %esp,%ebp
+  8001d3:	56                   	push   %esi
+  8001d4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001d5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001d8:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8001de:	e8 92 0a 00 00       	call   800c75 <sys_getenvid>
+  8001e3:	83 ec 0c             	sub    $0xc,%esp
+  8001e6:	ff 75 0c             	push   0xc(%ebp)
+  8001e9:	ff 75 08             	push   0x8(%ebp)
+  8001ec:	56                   	push   %esi
+  8001ed:	50                   	push   %eax
+  8001ee:	68 44 49 80 00       	push   $0x804944
+  8001f3:	e8 b3 00 00 00       	call   8002ab <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001f8:	83 c4 18             	add    $0x18,%esp
+  8001fb:	53                   	push   %ebx
+  8001fc:	ff 75 10             	push   0x10(%ebp)
+  8001ff:	e8 56 00 00 00       	call   80025a <vcprintf>
+	cprintf("\n");
+  800204:	c7 04 24 1e 50 80 00 	movl   $0x80501e,(%esp)
+  80020b:	e8 9b 00 00 00       	call   8002ab <cprintf>
+  800210:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800213:	cc                   	int3
+	while (1)
+  800214:	eb fd                	jmp    800213 <_panic+0x43>
+
+00800216 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	53                   	push   %ebx
+  80021a:	83 ec 04             	sub    $0x4,%esp
+  80021d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800220:	8b 13                	mov    (%ebx),%edx
+  800222:	8d 42 01             	lea    0x1(%edx),%eax
+  800225:	89 03                	mov    %eax,(%ebx)
+  800227:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80022a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80022e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800233:	74 09                	je     80023e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800235:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800239:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80023c:	c9                   	leave
+  80023d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80023e:	83 ec 08             	sub    $0x8,%esp
+  800241:	68 ff 00 00 00       	push   $0xff
+  800246:	8d 43 08             	lea    0x8(%ebx),%eax
+  800249:	50                   	push   %eax
+  80024a:	e8 84 09 00 00       	call   800bd3 <sys_cputs>
+		b->idx = 0;
+  80024f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	eb db                	jmp    800235 <putch+0x1f>
+
+0080025a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800263:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80026a:	00 00 00 
+	b.cnt = 0;
+  80026d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800274:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800277:	ff 75 0c             	push   0xc(%ebp)
+  80027a:	ff 75 08             	push   0x8(%ebp)
+  80027d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800283:	50                   	push   %eax
+  800284:	68 16 02 80 00       	push   $0x800216
+  800289:	e8 14 01 00 00       	call   8003a2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80028e:	83 c4 08             	add    $0x8,%esp
+  800291:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800297:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80029d:	50                   	push   %eax
+  80029e:	e8 30 09 00 00       	call   800bd3 <sys_cputs>
+
+	return b.cnt;
+}
+  8002a3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002a9:	c9                   	leave
+  8002aa:	c3                   	ret
+
+008002ab <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002ab:	55                   	push   %ebp
+  8002ac:	89 e5                	mov    %esp,%ebp
+  8002ae:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002b1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002b4:	50                   	push   %eax
+  8002b5:	ff 75 08             	push   0x8(%ebp)
+  8002b8:	e8 9d ff ff ff       	call   80025a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+
+008002bf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	57                   	push   %edi
+  8002c3:	56                   	push   %esi
+  8002c4:	53                   	push   %ebx
+  8002c5:	83 ec 1c             	sub    $0x1c,%esp
+  8002c8:	89 c7                	mov    %eax,%edi
+  8002ca:	89 d6                	mov    %edx,%esi
+  8002cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002d2:	89 d1                	mov    %edx,%ecx
+  8002d4:	89 c2                	mov    %eax,%edx
+  8002d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002d9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002df:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002e5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002ec:	39 c2                	cmp    %eax,%edx
+  8002ee:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002f1:	72 3e                	jb     800331 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f3:	83 ec 0c             	sub    $0xc,%esp
+  8002f6:	ff 75 18             	push   0x18(%ebp)
+  8002f9:	83 eb 01             	sub    $0x1,%ebx
+  8002fc:	53                   	push   %ebx
+  8002fd:	50                   	push   %eax
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	ff 75 e4             	push   -0x1c(%ebp)
+  800304:	ff 75 e0             	push   -0x20(%ebp)
+  800307:	ff 75 dc             	push   -0x24(%ebp)
+  80030a:	ff 75 d8             	push   -0x28(%ebp)
+  80030d:	e8 35 44 00 00       	call   804747 <__udivdi3>
+  800312:	83 c4 18             	add    $0x18,%esp
+  800315:	52                   	push   %edx
+  800316:	50                   	push   %eax
+  800317:	89 f2                	mov    %esi,%edx
+  800319:	89 f8                	mov    %edi,%eax
+  80031b:	e8 9f ff ff ff       	call   8002bf <printnum>
+  800320:	83 c4 20             	add    $0x20,%esp
+  800323:	eb 13                	jmp    800338 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	56                   	push   %esi
+  800329:	ff 75 18             	push   0x18(%ebp)
+  80032c:	ff d7                	call   *%edi
+  80032e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800331:	83 eb 01             	sub    $0x1,%ebx
+  800334:	85 db                	test   %ebx,%ebx
+  800336:	7f ed                	jg     800325 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800338:	83 ec 08             	sub    $0x8,%esp
+  80033b:	56                   	push   %esi
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	ff 75 e4             	push   -0x1c(%ebp)
+  800342:	ff 75 e0             	push   -0x20(%ebp)
+  800345:	ff 75 dc             	push   -0x24(%ebp)
+  800348:	ff 75 d8             	push   -0x28(%ebp)
+  80034b:	e8 18 44 00 00       	call   804768 <__umoddi3>
+  800350:	83 c4 14             	add    $0x14,%esp
+  800353:	0f be 80 67 49 80 00 	movsbl 0x804967(%eax),%eax
+  80035a:	50                   	push   %eax
+  80035b:	ff d7                	call   *%edi
+}
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800363:	5b                   	pop    %ebx
+  800364:	5e                   	pop    %esi
+  800365:	5f                   	pop    %edi
+  800366:	5d                   	pop    %ebp
+  800367:	c3                   	ret
+
+00800368 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800368:	55                   	push   %ebp
+  800369:	89 e5                	mov    %esp,%ebp
+  80036b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80036e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800372:	8b 10                	mov    (%eax),%edx
+  800374:	3b 50 04             	cmp    0x4(%eax),%edx
+  800377:	73 0a                	jae    800383 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800379:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80037c:	89 08                	mov    %ecx,(%eax)
+  80037e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800381:	88 02                	mov    %al,(%edx)
+}
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <printfmt>:
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80038b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80038e:	50                   	push   %eax
+  80038f:	ff 75 10             	push   0x10(%ebp)
+  800392:	ff 75 0c             	push   0xc(%ebp)
+  800395:	ff 75 08             	push   0x8(%ebp)
+  800398:	e8 05 00 00 00       	call   8003a2 <vprintfmt>
+}
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	c9                   	leave
+  8003a1:	c3                   	ret
+
+008003a2 <vprintfmt>:
+{
+  8003a2:	55                   	push   %ebp
+  8003a3:	89 e5                	mov    %esp,%ebp
+  8003a5:	57                   	push   %edi
+  8003a6:	56                   	push   %esi
+  8003a7:	53                   	push   %ebx
+  8003a8:	83 ec 2c             	sub    $0x2c,%esp
+  8003ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003b1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003b4:	eb 0a                	jmp    8003c0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	53                   	push   %ebx
+  8003ba:	50                   	push   %eax
+  8003bb:	ff d6                	call   *%esi
+  8003bd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8003c0:	83 c7 01             	add    $0x1,%edi
+  8003c3:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8003c7:	83 f8 25             	cmp    $0x25,%eax
+  8003ca:	74 0c                	je     8003d8 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003cc:	85 c0                	test   %eax,%eax
+  8003ce:	75 e6                	jne    8003b6 <vprintfmt+0x14>
+}
+  8003d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d3:	5b                   	pop    %ebx
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5f                   	pop    %edi
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	c3                   	ret
+		padc = ' ';
+  8003d8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003dc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003e3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ea:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003f6:	8d 47 01             	lea    0x1(%edi),%eax
+  8003f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003fc:	0f b6 17             	movzbl (%edi),%edx
+  8003ff:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800402:	3c 55                	cmp    $0x55,%al
+  800404:	0f 87 c5 03 00 00    	ja     8007cf <vprintfmt+0x42d>
+  80040a:	0f b6 c0             	movzbl %al,%eax
+  80040d:	ff 24 85 e0 4a 80 00 	jmp    *0x804ae0(,%eax,4)
+  800414:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800417:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041a:	eb da                	jmp    8003f6 <vprintfmt+0x54>
+  80041c:	0f be d2             	movsbl %dl,%edx
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800422:	b8 00 00 00 00       	mov    $0x0,%eax
+  800427:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80042a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80042d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800431:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800434:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800437:	83 f9 09             	cmp    $0x9,%ecx
+  80043a:	77 55                	ja     800491 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80043c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80043f:	eb e9                	jmp    80042a <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8b 00                	mov    (%eax),%eax
+  800446:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044c:	8d 40 04             	lea    0x4(%eax),%eax
+  80044f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800452:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800455:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800459:	79 9b                	jns    8003f6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80045b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80045e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800461:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800468:	eb 8c                	jmp    8003f6 <vprintfmt+0x54>
+			if (width < 0)
+  80046a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80046d:	85 d2                	test   %edx,%edx
+  80046f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800474:	0f 49 c2             	cmovns %edx,%eax
+  800477:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80047d:	e9 74 ff ff ff       	jmp    8003f6 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800482:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800485:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80048c:	e9 65 ff ff ff       	jmp    8003f6 <vprintfmt+0x54>
+  800491:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800494:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800497:	eb bc                	jmp    800455 <vprintfmt+0xb3>
+			lflag++;
+  800499:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80049c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80049f:	e9 52 ff ff ff       	jmp    8003f6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a7:	8d 78 04             	lea    0x4(%eax),%edi
+  8004aa:	83 ec 08             	sub    $0x8,%esp
+  8004ad:	53                   	push   %ebx
+  8004ae:	ff 30                	push   (%eax)
+  8004b0:	ff d6                	call   *%esi
+			break;
+  8004b2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004b5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004b8:	e9 b1 02 00 00       	jmp    80076e <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004c3:	8b 10                	mov    (%eax),%edx
+  8004c5:	89 d0                	mov    %edx,%eax
+  8004c7:	f7 d8                	neg    %eax
+  8004c9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004cc:	83 f8 14             	cmp    $0x14,%eax
+  8004cf:	7f 23                	jg     8004f4 <vprintfmt+0x152>
+  8004d1:	8b 14 85 40 4c 80 00 	mov    0x804c40(,%eax,4),%edx
+  8004d8:	85 d2                	test   %edx,%edx
+  8004da:	74 18                	je     8004f4 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8004dc:	52                   	push   %edx
+  8004dd:	68 af 4d 80 00       	push   $0x804daf
+  8004e2:	53                   	push   %ebx
+  8004e3:	56                   	push   %esi
+  8004e4:	e8 9c fe ff ff       	call   800385 <printfmt>
+  8004e9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ec:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ef:	e9 7a 02 00 00       	jmp    80076e <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004f4:	50                   	push   %eax
+  8004f5:	68 7f 49 80 00       	push   $0x80497f
+  8004fa:	53                   	push   %ebx
+  8004fb:	56                   	push   %esi
+  8004fc:	e8 84 fe ff ff       	call   800385 <printfmt>
+  800501:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800504:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800507:	e9 62 02 00 00       	jmp    80076e <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	83 c0 04             	add    $0x4,%eax
+  800512:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80051a:	85 c9                	test   %ecx,%ecx
+  80051c:	b8 78 49 80 00       	mov    $0x804978,%eax
+  800521:	0f 45 c1             	cmovne %ecx,%eax
+  800524:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800527:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052b:	7e 06                	jle    800533 <vprintfmt+0x191>
+  80052d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800531:	75 0b                	jne    80053e <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800533:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800536:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800539:	89 75 08             	mov    %esi,0x8(%ebp)
+  80053c:	eb 5c                	jmp    80059a <vprintfmt+0x1f8>
+  80053e:	83 ec 08             	sub    $0x8,%esp
+  800541:	ff 75 d0             	push   -0x30(%ebp)
+  800544:	ff 75 cc             	push   -0x34(%ebp)
+  800547:	e8 20 03 00 00       	call   80086c <strnlen>
+  80054c:	89 c2                	mov    %eax,%edx
+  80054e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800551:	29 d0                	sub    %edx,%eax
+  800553:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800556:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80055a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800560:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800562:	eb 0e                	jmp    800572 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	53                   	push   %ebx
+  800568:	57                   	push   %edi
+  800569:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80056c:	83 ee 01             	sub    $0x1,%esi
+  80056f:	83 c4 10             	add    $0x10,%esp
+  800572:	85 f6                	test   %esi,%esi
+  800574:	7f ee                	jg     800564 <vprintfmt+0x1c2>
+  800576:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800579:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057c:	85 c0                	test   %eax,%eax
+  80057e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800583:	0f 49 d0             	cmovns %eax,%edx
+  800586:	29 d0                	sub    %edx,%eax
+  800588:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058b:	eb a6                	jmp    800533 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80058d:	83 ec 08             	sub    $0x8,%esp
+  800590:	53                   	push   %ebx
+  800591:	52                   	push   %edx
+  800592:	ff 55 08             	call   *0x8(%ebp)
+  800595:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800598:	89 f1                	mov    %esi,%ecx
+  80059a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80059d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005a1:	0f be d0             	movsbl %al,%edx
+  8005a4:	85 d2                	test   %edx,%edx
+  8005a6:	74 28                	je     8005d0 <vprintfmt+0x22e>
+  8005a8:	85 ff                	test   %edi,%edi
+  8005aa:	78 05                	js     8005b1 <vprintfmt+0x20f>
+  8005ac:	83 ef 01             	sub    $0x1,%edi
+  8005af:	78 30                	js     8005e1 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005b1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b5:	74 d6                	je     80058d <vprintfmt+0x1eb>
+  8005b7:	0f be c0             	movsbl %al,%eax
+  8005ba:	83 e8 20             	sub    $0x20,%eax
+  8005bd:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c0:	76 cb                	jbe    80058d <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8005c2:	83 ec 08             	sub    $0x8,%esp
+  8005c5:	53                   	push   %ebx
+  8005c6:	6a 3f                	push   $0x3f
+  8005c8:	ff 55 08             	call   *0x8(%ebp)
+  8005cb:	83 c4 10             	add    $0x10,%esp
+  8005ce:	eb c8                	jmp    800598 <vprintfmt+0x1f6>
+  8005d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d9:	01 d0                	add    %edx,%eax
+  8005db:	29 c8                	sub    %ecx,%eax
+  8005dd:	89 c7                	mov    %eax,%edi
+  8005df:	eb 13                	jmp    8005f4 <vprintfmt+0x252>
+  8005e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e4:	eb ed                	jmp    8005d3 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8005e6:	83 ec 08             	sub    $0x8,%esp
+  8005e9:	53                   	push   %ebx
+  8005ea:	6a 20                	push   $0x20
+  8005ec:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005ee:	83 ef 01             	sub    $0x1,%edi
+  8005f1:	83 c4 10             	add    $0x10,%esp
+  8005f4:	85 ff                	test   %edi,%edi
+  8005f6:	7f ee                	jg     8005e6 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fe:	e9 6b 01 00 00       	jmp    80076e <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800603:	83 f9 01             	cmp    $0x1,%ecx
+  800606:	7f 1f                	jg     800627 <vprintfmt+0x285>
+	else if (lflag)
+  800608:	85 c9                	test   %ecx,%ecx
+  80060a:	74 67                	je     800673 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8b 00                	mov    (%eax),%eax
+  800611:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800614:	89 c1                	mov    %eax,%ecx
+  800616:	c1 f9 1f             	sar    $0x1f,%ecx
+  800619:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80061c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061f:	8d 40 04             	lea    0x4(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+  800625:	eb 17                	jmp    80063e <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 50 04             	mov    0x4(%eax),%edx
+  80062d:	8b 00                	mov    (%eax),%eax
+  80062f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800632:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8d 40 08             	lea    0x8(%eax),%eax
+  80063b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80063e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800641:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800644:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800649:	85 c9                	test   %ecx,%ecx
+  80064b:	0f 89 03 01 00 00    	jns    800754 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 2d                	push   $0x2d
+  800657:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800659:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80065c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065f:	f7 da                	neg    %edx
+  800661:	83 d1 00             	adc    $0x0,%ecx
+  800664:	f7 d9                	neg    %ecx
+  800666:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800669:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80066e:	e9 e1 00 00 00       	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	89 c1                	mov    %eax,%ecx
+  80067d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800680:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	eb b0                	jmp    80063e <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80068e:	83 f9 01             	cmp    $0x1,%ecx
+  800691:	7f 1e                	jg     8006b1 <vprintfmt+0x30f>
+	else if (lflag)
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	74 32                	je     8006c9 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006ac:	e9 a3 00 00 00       	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c4:	e9 8b 00 00 00       	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006de:	eb 74                	jmp    800754 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8006e0:	83 f9 01             	cmp    $0x1,%ecx
+  8006e3:	7f 1b                	jg     800700 <vprintfmt+0x35e>
+	else if (lflag)
+  8006e5:	85 c9                	test   %ecx,%ecx
+  8006e7:	74 2c                	je     800715 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8b 10                	mov    (%eax),%edx
+  8006ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006fe:	eb 54                	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800700:	8b 45 14             	mov    0x14(%ebp),%eax
+  800703:	8b 10                	mov    (%eax),%edx
+  800705:	8b 48 04             	mov    0x4(%eax),%ecx
+  800708:	8d 40 08             	lea    0x8(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800713:	eb 3f                	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071f:	8d 40 04             	lea    0x4(%eax),%eax
+  800722:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800725:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80072a:	eb 28                	jmp    800754 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80072c:	83 ec 08             	sub    $0x8,%esp
+  80072f:	53                   	push   %ebx
+  800730:	6a 30                	push   $0x30
+  800732:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800734:	83 c4 08             	add    $0x8,%esp
+  800737:	53                   	push   %ebx
+  800738:	6a 78                	push   $0x78
+  80073a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80073c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073f:	8b 10                	mov    (%eax),%edx
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800746:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800749:	8d 40 04             	lea    0x4(%eax),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074f:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800754:	83 ec 0c             	sub    $0xc,%esp
+  800757:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80075b:	50                   	push   %eax
+  80075c:	ff 75 e0             	push   -0x20(%ebp)
+  80075f:	57                   	push   %edi
+  800760:	51                   	push   %ecx
+  800761:	52                   	push   %edx
+  800762:	89 da                	mov    %ebx,%edx
+  800764:	89 f0                	mov    %esi,%eax
+  800766:	e8 54 fb ff ff       	call   8002bf <printnum>
+			break;
+  80076b:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80076e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800771:	e9 4a fc ff ff       	jmp    8003c0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800776:	83 f9 01             	cmp    $0x1,%ecx
+  800779:	7f 1b                	jg     800796 <vprintfmt+0x3f4>
+	else if (lflag)
+  80077b:	85 c9                	test   %ecx,%ecx
+  80077d:	74 2c                	je     8007ab <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 10                	mov    (%eax),%edx
+  800784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800789:	8d 40 04             	lea    0x4(%eax),%eax
+  80078c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800794:	eb be                	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80079e:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a9:	eb a9                	jmp    800754 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	8b 10                	mov    (%eax),%edx
+  8007b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007c0:	eb 92                	jmp    800754 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8007c2:	83 ec 08             	sub    $0x8,%esp
+  8007c5:	53                   	push   %ebx
+  8007c6:	6a 25                	push   $0x25
+  8007c8:	ff d6                	call   *%esi
+			break;
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	eb 9f                	jmp    80076e <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8007cf:	83 ec 08             	sub    $0x8,%esp
+  8007d2:	53                   	push   %ebx
+  8007d3:	6a 25                	push   $0x25
+  8007d5:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d7:	83 c4 10             	add    $0x10,%esp
+  8007da:	89 f8                	mov    %edi,%eax
+  8007dc:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007e0:	74 05                	je     8007e7 <vprintfmt+0x445>
+  8007e2:	83 e8 01             	sub    $0x1,%eax
+  8007e5:	eb f5                	jmp    8007dc <vprintfmt+0x43a>
+  8007e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ea:	eb 82                	jmp    80076e <vprintfmt+0x3cc>
+
+008007ec <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007ec:	55                   	push   %ebp
+  8007ed:	89 e5                	mov    %esp,%ebp
+  8007ef:	83 ec 18             	sub    $0x18,%esp
+  8007f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007fb:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007ff:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800802:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800809:	85 c0                	test   %eax,%eax
+  80080b:	74 26                	je     800833 <vsnprintf+0x47>
+  80080d:	85 d2                	test   %edx,%edx
+  80080f:	7e 22                	jle    800833 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800811:	ff 75 14             	push   0x14(%ebp)
+  800814:	ff 75 10             	push   0x10(%ebp)
+  800817:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80081a:	50                   	push   %eax
+  80081b:	68 68 03 80 00       	push   $0x800368
+  800820:	e8 7d fb ff ff       	call   8003a2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800825:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800828:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80082b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082e:	83 c4 10             	add    $0x10,%esp
+}
+  800831:	c9                   	leave
+  800832:	c3                   	ret
+		return -E_INVAL;
+  800833:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800838:	eb f7                	jmp    800831 <vsnprintf+0x45>
+
+0080083a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800840:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800843:	50                   	push   %eax
+  800844:	ff 75 10             	push   0x10(%ebp)
+  800847:	ff 75 0c             	push   0xc(%ebp)
+  80084a:	ff 75 08             	push   0x8(%ebp)
+  80084d:	e8 9a ff ff ff       	call   8007ec <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+00800854 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085f:	eb 03                	jmp    800864 <strlen+0x10>
+		n++;
+  800861:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800864:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800868:	75 f7                	jne    800861 <strlen+0xd>
+	return n;
+}
+  80086a:	5d                   	pop    %ebp
+  80086b:	c3                   	ret
+
+0080086c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800872:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087a:	eb 03                	jmp    80087f <strnlen+0x13>
+		n++;
+  80087c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087f:	39 d0                	cmp    %edx,%eax
+  800881:	74 08                	je     80088b <strnlen+0x1f>
+  800883:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800887:	75 f3                	jne    80087c <strnlen+0x10>
+  800889:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80088b:	89 d0                	mov    %edx,%eax
+  80088d:	5d                   	pop    %ebp
+  80088e:	c3                   	ret
+
+0080088f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	53                   	push   %ebx
+  800893:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800896:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008a2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a5:	83 c0 01             	add    $0x1,%eax
+  8008a8:	84 d2                	test   %dl,%dl
+  8008aa:	75 f2                	jne    80089e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008ac:	89 c8                	mov    %ecx,%eax
+  8008ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b1:	c9                   	leave
+  8008b2:	c3                   	ret
+
+008008b3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	53                   	push   %ebx
+  8008b7:	83 ec 10             	sub    $0x10,%esp
+  8008ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008bd:	53                   	push   %ebx
+  8008be:	e8 91 ff ff ff       	call   800854 <strlen>
+  8008c3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008c6:	ff 75 0c             	push   0xc(%ebp)
+  8008c9:	01 d8                	add    %ebx,%eax
+  8008cb:	50                   	push   %eax
+  8008cc:	e8 be ff ff ff       	call   80088f <strcpy>
+	return dst;
+}
+  8008d1:	89 d8                	mov    %ebx,%eax
+  8008d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+
+008008d8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	56                   	push   %esi
+  8008dc:	53                   	push   %ebx
+  8008dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008e3:	89 f3                	mov    %esi,%ebx
+  8008e5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e8:	89 f0                	mov    %esi,%eax
+  8008ea:	eb 0f                	jmp    8008fb <strncpy+0x23>
+		*dst++ = *src;
+  8008ec:	83 c0 01             	add    $0x1,%eax
+  8008ef:	0f b6 0a             	movzbl (%edx),%ecx
+  8008f2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008f5:	80 f9 01             	cmp    $0x1,%cl
+  8008f8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008fb:	39 d8                	cmp    %ebx,%eax
+  8008fd:	75 ed                	jne    8008ec <strncpy+0x14>
+	}
+	return ret;
+}
+  8008ff:	89 f0                	mov    %esi,%eax
+  800901:	5b                   	pop    %ebx
+  800902:	5e                   	pop    %esi
+  800903:	5d                   	pop    %ebp
+  800904:	c3                   	ret
+
+00800905 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	56                   	push   %esi
+  800909:	53                   	push   %ebx
+  80090a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800910:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800913:	89 f0                	mov    %esi,%eax
+  800915:	85 d2                	test   %edx,%edx
+  800917:	74 21                	je     80093a <strlcpy+0x35>
+  800919:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80091d:	89 f2                	mov    %esi,%edx
+  80091f:	eb 09                	jmp    80092a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800921:	83 c1 01             	add    $0x1,%ecx
+  800924:	83 c2 01             	add    $0x1,%edx
+  800927:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80092a:	39 c2                	cmp    %eax,%edx
+  80092c:	74 09                	je     800937 <strlcpy+0x32>
+  80092e:	0f b6 19             	movzbl (%ecx),%ebx
+  800931:	84 db                	test   %bl,%bl
+  800933:	75 ec                	jne    800921 <strlcpy+0x1c>
+  800935:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800937:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80093a:	29 f0                	sub    %esi,%eax
+}
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5d                   	pop    %ebp
+  80093f:	c3                   	ret
+
+00800940 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800946:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800949:	eb 06                	jmp    800951 <strcmp+0x11>
+		p++, q++;
+  80094b:	83 c1 01             	add    $0x1,%ecx
+  80094e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800951:	0f b6 01             	movzbl (%ecx),%eax
+  800954:	84 c0                	test   %al,%al
+  800956:	74 04                	je     80095c <strcmp+0x1c>
+  800958:	3a 02                	cmp    (%edx),%al
+  80095a:	74 ef                	je     80094b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80095c:	0f b6 c0             	movzbl %al,%eax
+  80095f:	0f b6 12             	movzbl (%edx),%edx
+  800962:	29 d0                	sub    %edx,%eax
+}
+  800964:	5d                   	pop    %ebp
+  800965:	c3                   	ret
+
+00800966 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	53                   	push   %ebx
+  80096a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800970:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800973:	eb 09                	jmp    80097e <strncmp+0x18>
+		n--, p++, q++;
+  800975:	83 ea 01             	sub    $0x1,%edx
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80097e:	85 d2                	test   %edx,%edx
+  800980:	74 18                	je     80099a <strncmp+0x34>
+  800982:	0f b6 18             	movzbl (%eax),%ebx
+  800985:	84 db                	test   %bl,%bl
+  800987:	74 04                	je     80098d <strncmp+0x27>
+  800989:	3a 19                	cmp    (%ecx),%bl
+  80098b:	74 e8                	je     800975 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098d:	0f b6 00             	movzbl (%eax),%eax
+  800990:	0f b6 11             	movzbl (%ecx),%edx
+  800993:	29 d0                	sub    %edx,%eax
+}
+  800995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800998:	c9                   	leave
+  800999:	c3                   	ret
+		return 0;
+  80099a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099f:	eb f4                	jmp    800995 <strncmp+0x2f>
+
+008009a1 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ab:	eb 03                	jmp    8009b0 <strchr+0xf>
+  8009ad:	83 c0 01             	add    $0x1,%eax
+  8009b0:	0f b6 10             	movzbl (%eax),%edx
+  8009b3:	84 d2                	test   %dl,%dl
+  8009b5:	74 06                	je     8009bd <strchr+0x1c>
+		if (*s == c)
+  8009b7:	38 ca                	cmp    %cl,%dl
+  8009b9:	75 f2                	jne    8009ad <strchr+0xc>
+  8009bb:	eb 05                	jmp    8009c2 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+
+008009c4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ca:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ce:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009d1:	38 ca                	cmp    %cl,%dl
+  8009d3:	74 09                	je     8009de <strfind+0x1a>
+  8009d5:	84 d2                	test   %dl,%dl
+  8009d7:	74 05                	je     8009de <strfind+0x1a>
+	for (; *s; s++)
+  8009d9:	83 c0 01             	add    $0x1,%eax
+  8009dc:	eb f0                	jmp    8009ce <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009de:	5d                   	pop    %ebp
+  8009df:	c3                   	ret
+
+008009e0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	57                   	push   %edi
+  8009e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009ea:	85 c9                	test   %ecx,%ecx
+  8009ec:	74 20                	je     800a0e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009ee:	89 f8                	mov    %edi,%eax
+  8009f0:	09 c8                	or     %ecx,%eax
+  8009f2:	a8 03                	test   $0x3,%al
+  8009f4:	75 12                	jne    800a08 <memset+0x28>
+		c &= 0xFF;
+  8009f6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009fa:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a00:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a03:	fc                   	cld
+  800a04:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a06:	eb 06                	jmp    800a0e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a0b:	fc                   	cld
+  800a0c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a0e:	89 f8                	mov    %edi,%eax
+  800a10:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a20:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a23:	39 c6                	cmp    %eax,%esi
+  800a25:	73 32                	jae    800a59 <memmove+0x44>
+  800a27:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a2a:	39 d0                	cmp    %edx,%eax
+  800a2c:	73 2b                	jae    800a59 <memmove+0x44>
+		s += n;
+		d += n;
+  800a2e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a31:	89 d6                	mov    %edx,%esi
+  800a33:	09 fe                	or     %edi,%esi
+  800a35:	09 ce                	or     %ecx,%esi
+  800a37:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a3d:	75 0e                	jne    800a4d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a3f:	83 ef 04             	sub    $0x4,%edi
+  800a42:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a45:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a48:	fd                   	std
+  800a49:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a4b:	eb 09                	jmp    800a56 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a4d:	83 ef 01             	sub    $0x1,%edi
+  800a50:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a53:	fd                   	std
+  800a54:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a56:	fc                   	cld
+  800a57:	eb 1a                	jmp    800a73 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a59:	89 f2                	mov    %esi,%edx
+  800a5b:	09 c2                	or     %eax,%edx
+  800a5d:	09 ca                	or     %ecx,%edx
+  800a5f:	f6 c2 03             	test   $0x3,%dl
+  800a62:	75 0a                	jne    800a6e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a64:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a67:	89 c7                	mov    %eax,%edi
+  800a69:	fc                   	cld
+  800a6a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6c:	eb 05                	jmp    800a73 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a6e:	89 c7                	mov    %eax,%edi
+  800a70:	fc                   	cld
+  800a71:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a73:	5e                   	pop    %esi
+  800a74:	5f                   	pop    %edi
+  800a75:	5d                   	pop    %ebp
+  800a76:	c3                   	ret
+
+00800a77 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a7d:	ff 75 10             	push   0x10(%ebp)
+  800a80:	ff 75 0c             	push   0xc(%ebp)
+  800a83:	ff 75 08             	push   0x8(%ebp)
+  800a86:	e8 8a ff ff ff       	call   800a15 <memmove>
+}
+  800a8b:	c9                   	leave
+  800a8c:	c3                   	ret
+
+00800a8d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	56                   	push   %esi
+  800a91:	53                   	push   %ebx
+  800a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a95:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a98:	89 c6                	mov    %eax,%esi
+  800a9a:	03 75 10             	add    0x10(%ebp),%esi
+  800a9d:	eb 06                	jmp    800aa5 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a9f:	83 c0 01             	add    $0x1,%eax
+  800aa2:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aa5:	39 f0                	cmp    %esi,%eax
+  800aa7:	74 14                	je     800abd <memcmp+0x30>
+		if (*s1 != *s2)
+  800aa9:	0f b6 08             	movzbl (%eax),%ecx
+  800aac:	0f b6 1a             	movzbl (%edx),%ebx
+  800aaf:	38 d9                	cmp    %bl,%cl
+  800ab1:	74 ec                	je     800a9f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ab3:	0f b6 c1             	movzbl %cl,%eax
+  800ab6:	0f b6 db             	movzbl %bl,%ebx
+  800ab9:	29 d8                	sub    %ebx,%eax
+  800abb:	eb 05                	jmp    800ac2 <memcmp+0x35>
+	}
+
+	return 0;
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac2:	5b                   	pop    %ebx
+  800ac3:	5e                   	pop    %esi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800acf:	89 c2                	mov    %eax,%edx
+  800ad1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ad4:	eb 03                	jmp    800ad9 <memfind+0x13>
+  800ad6:	83 c0 01             	add    $0x1,%eax
+  800ad9:	39 d0                	cmp    %edx,%eax
+  800adb:	73 04                	jae    800ae1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800add:	38 08                	cmp    %cl,(%eax)
+  800adf:	75 f5                	jne    800ad6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+
+00800ae3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	57                   	push   %edi
+  800ae7:	56                   	push   %esi
+  800ae8:	53                   	push   %ebx
+  800ae9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aef:	eb 03                	jmp    800af4 <strtol+0x11>
+		s++;
+  800af1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800af4:	0f b6 02             	movzbl (%edx),%eax
+  800af7:	3c 20                	cmp    $0x20,%al
+  800af9:	74 f6                	je     800af1 <strtol+0xe>
+  800afb:	3c 09                	cmp    $0x9,%al
+  800afd:	74 f2                	je     800af1 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aff:	3c 2b                	cmp    $0x2b,%al
+  800b01:	74 2a                	je     800b2d <strtol+0x4a>
+	int neg = 0;
+  800b03:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b08:	3c 2d                	cmp    $0x2d,%al
+  800b0a:	74 2b                	je     800b37 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b12:	75 0f                	jne    800b23 <strtol+0x40>
+  800b14:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b17:	74 28                	je     800b41 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b19:	85 db                	test   %ebx,%ebx
+  800b1b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b20:	0f 44 d8             	cmove  %eax,%ebx
+  800b23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b28:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b2b:	eb 46                	jmp    800b73 <strtol+0x90>
+		s++;
+  800b2d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b35:	eb d5                	jmp    800b0c <strtol+0x29>
+		s++, neg = 1;
+  800b37:	83 c2 01             	add    $0x1,%edx
+  800b3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3f:	eb cb                	jmp    800b0c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b41:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b45:	74 0e                	je     800b55 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b47:	85 db                	test   %ebx,%ebx
+  800b49:	75 d8                	jne    800b23 <strtol+0x40>
+		s++, base = 8;
+  800b4b:	83 c2 01             	add    $0x1,%edx
+  800b4e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b53:	eb ce                	jmp    800b23 <strtol+0x40>
+		s += 2, base = 16;
+  800b55:	83 c2 02             	add    $0x2,%edx
+  800b58:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b5d:	eb c4                	jmp    800b23 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b5f:	0f be c0             	movsbl %al,%eax
+  800b62:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b65:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b68:	7d 3a                	jge    800ba4 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b6a:	83 c2 01             	add    $0x1,%edx
+  800b6d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b71:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b73:	0f b6 02             	movzbl (%edx),%eax
+  800b76:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b79:	89 f3                	mov    %esi,%ebx
+  800b7b:	80 fb 09             	cmp    $0x9,%bl
+  800b7e:	76 df                	jbe    800b5f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b80:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b83:	89 f3                	mov    %esi,%ebx
+  800b85:	80 fb 19             	cmp    $0x19,%bl
+  800b88:	77 08                	ja     800b92 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b8a:	0f be c0             	movsbl %al,%eax
+  800b8d:	83 e8 57             	sub    $0x57,%eax
+  800b90:	eb d3                	jmp    800b65 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b92:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b95:	89 f3                	mov    %esi,%ebx
+  800b97:	80 fb 19             	cmp    $0x19,%bl
+  800b9a:	77 08                	ja     800ba4 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b9c:	0f be c0             	movsbl %al,%eax
+  800b9f:	83 e8 37             	sub    $0x37,%eax
+  800ba2:	eb c1                	jmp    800b65 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ba4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba8:	74 05                	je     800baf <strtol+0xcc>
+		*endptr = (char *) s;
+  800baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bad:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800baf:	89 c8                	mov    %ecx,%eax
+  800bb1:	f7 d8                	neg    %eax
+  800bb3:	85 ff                	test   %edi,%edi
+  800bb5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb8:	89 c8                	mov    %ecx,%eax
+  800bba:	5b                   	pop    %ebx
+  800bbb:	5e                   	pop    %esi
+  800bbc:	5f                   	pop    %edi
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <atoi>:
+
+int
+atoi(const char* s)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800bc5:	6a 00                	push   $0x0
+  800bc7:	6a 00                	push   $0x0
+  800bc9:	ff 75 08             	push   0x8(%ebp)
+  800bcc:	e8 12 ff ff ff       	call   800ae3 <strtol>
+}
+  800bd1:	c9                   	leave
+  800bd2:	c3                   	ret
+
+00800bd3 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	57                   	push   %edi
+  800bd7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be3:	89 c3                	mov    %eax,%ebx
+  800be5:	89 c7                	mov    %eax,%edi
+  800be7:	6a 00                	push   $0x0
+  800be9:	55                   	push   %ebp
+  800bea:	56                   	push   %esi
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8d 35 f5 0b 80 00    	lea    0x800bf5,%esi
+  800bf3:	0f 34                	sysenter
+
+00800bf5 <after_sysenter_label_47>:
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5f                   	pop    %edi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c08:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0d:	89 d1                	mov    %edx,%ecx
+  800c0f:	89 d3                	mov    %edx,%ebx
+  800c11:	89 d7                	mov    %edx,%edi
+  800c13:	6a 00                	push   $0x0
+  800c15:	55                   	push   %ebp
+  800c16:	56                   	push   %esi
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	8d 35 21 0c 80 00    	lea    0x800c21,%esi
+  800c1f:	0f 34                	sysenter
+
+00800c21 <after_sysenter_label_128>:
+  800c21:	5e                   	pop    %esi
+  800c22:	5d                   	pop    %ebp
+  800c23:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c26:	5b                   	pop    %ebx
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c37:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c3c:	89 cb                	mov    %ecx,%ebx
+  800c3e:	89 cf                	mov    %ecx,%edi
+  800c40:	6a 00                	push   $0x0
+  800c42:	55                   	push   %ebp
+  800c43:	56                   	push   %esi
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	8d 35 4e 0c 80 00    	lea    0x800c4e,%esi
+  800c4c:	0f 34                	sysenter
+
+00800c4e <after_sysenter_label_212>:
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c53:	85 c0                	test   %eax,%eax
+  800c55:	7f 07                	jg     800c5e <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c5a:	5b                   	pop    %ebx
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5e:	83 ec 0c             	sub    $0xc,%esp
+  800c61:	50                   	push   %eax
+  800c62:	6a 03                	push   $0x3
+  800c64:	68 d5 4c 80 00       	push   $0x804cd5
+  800c69:	6a 54                	push   $0x54
+  800c6b:	68 f2 4c 80 00       	push   $0x804cf2
+  800c70:	e8 5b f5 ff ff       	call   8001d0 <_panic>
+
+00800c75 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	57                   	push   %edi
+  800c79:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c84:	89 d1                	mov    %edx,%ecx
+  800c86:	89 d3                	mov    %edx,%ebx
+  800c88:	89 d7                	mov    %edx,%edi
+  800c8a:	6a 00                	push   $0x0
+  800c8c:	55                   	push   %ebp
+  800c8d:	56                   	push   %esi
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	8d 35 98 0c 80 00    	lea    0x800c98,%esi
+  800c96:	0f 34                	sysenter
+
+00800c98 <after_sysenter_label_309>:
+  800c98:	5e                   	pop    %esi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cab:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cb0:	89 d1                	mov    %edx,%ecx
+  800cb2:	89 d3                	mov    %edx,%ebx
+  800cb4:	89 d7                	mov    %edx,%edi
+  800cb6:	6a 00                	push   $0x0
+  800cb8:	55                   	push   %ebp
+  800cb9:	56                   	push   %esi
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	8d 35 c4 0c 80 00    	lea    0x800cc4,%esi
+  800cc2:	0f 34                	sysenter
+
+00800cc4 <after_sysenter_label_391>:
+  800cc4:	5e                   	pop    %esi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cc9:	5b                   	pop    %ebx
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ce2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce5:	6a 00                	push   $0x0
+  800ce7:	55                   	push   %ebp
+  800ce8:	56                   	push   %esi
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	8d 35 f3 0c 80 00    	lea    0x800cf3,%esi
+  800cf1:	0f 34                	sysenter
+
+00800cf3 <after_sysenter_label_479>:
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 07                	jg     800d03 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d03:	83 ec 0c             	sub    $0xc,%esp
+  800d06:	50                   	push   %eax
+  800d07:	6a 04                	push   $0x4
+  800d09:	68 d5 4c 80 00       	push   $0x804cd5
+  800d0e:	6a 54                	push   $0x54
+  800d10:	68 f2 4c 80 00       	push   $0x804cf2
+  800d15:	e8 b6 f4 ff ff       	call   8001d0 <_panic>
+
+00800d1a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d25:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d30:	ff 75 18             	push   0x18(%ebp)
+  800d33:	55                   	push   %ebp
+  800d34:	56                   	push   %esi
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	8d 35 3f 0d 80 00    	lea    0x800d3f,%esi
+  800d3d:	0f 34                	sysenter
+
+00800d3f <after_sysenter_label_593>:
+  800d3f:	5e                   	pop    %esi
+  800d40:	5d                   	pop    %ebp
+  800d41:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d44:	85 c0                	test   %eax,%eax
+  800d46:	7f 07                	jg     800d4f <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4f:	83 ec 0c             	sub    $0xc,%esp
+  800d52:	50                   	push   %eax
+  800d53:	6a 05                	push   $0x5
+  800d55:	68 d5 4c 80 00       	push   $0x804cd5
+  800d5a:	6a 54                	push   $0x54
+  800d5c:	68 f2 4c 80 00       	push   $0x804cf2
+  800d61:	e8 6a f4 ff ff       	call   8001d0 <_panic>
+
+00800d66 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d76:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d7b:	89 df                	mov    %ebx,%edi
+  800d7d:	6a 00                	push   $0x0
+  800d7f:	55                   	push   %ebp
+  800d80:	56                   	push   %esi
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	8d 35 8b 0d 80 00    	lea    0x800d8b,%esi
+  800d89:	0f 34                	sysenter
+
+00800d8b <after_sysenter_label_704>:
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d90:	85 c0                	test   %eax,%eax
+  800d92:	7f 07                	jg     800d9b <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d97:	5b                   	pop    %ebx
+  800d98:	5f                   	pop    %edi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d9b:	83 ec 0c             	sub    $0xc,%esp
+  800d9e:	50                   	push   %eax
+  800d9f:	6a 06                	push   $0x6
+  800da1:	68 d5 4c 80 00       	push   $0x804cd5
+  800da6:	6a 54                	push   $0x54
+  800da8:	68 f2 4c 80 00       	push   $0x804cf2
+  800dad:	e8 1e f4 ff ff       	call   8001d0 <_panic>
+
+00800db2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800db7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dc7:	89 df                	mov    %ebx,%edi
+  800dc9:	6a 00                	push   $0x0
+  800dcb:	55                   	push   %ebp
+  800dcc:	56                   	push   %esi
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	8d 35 d7 0d 80 00    	lea    0x800dd7,%esi
+  800dd5:	0f 34                	sysenter
+
+00800dd7 <after_sysenter_label_808>:
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ddc:	85 c0                	test   %eax,%eax
+  800dde:	7f 07                	jg     800de7 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800de0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 08                	push   $0x8
+  800ded:	68 d5 4c 80 00       	push   $0x804cd5
+  800df2:	6a 54                	push   $0x54
+  800df4:	68 f2 4c 80 00       	push   $0x804cf2
+  800df9:	e8 d2 f3 ff ff       	call   8001d0 <_panic>
+
+00800dfe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e13:	89 df                	mov    %ebx,%edi
+  800e15:	6a 00                	push   $0x0
+  800e17:	55                   	push   %ebp
+  800e18:	56                   	push   %esi
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	8d 35 23 0e 80 00    	lea    0x800e23,%esi
+  800e21:	0f 34                	sysenter
+
+00800e23 <after_sysenter_label_912>:
+  800e23:	5e                   	pop    %esi
+  800e24:	5d                   	pop    %ebp
+  800e25:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e28:	85 c0                	test   %eax,%eax
+  800e2a:	7f 07                	jg     800e33 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e2f:	5b                   	pop    %ebx
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+  800e36:	50                   	push   %eax
+  800e37:	6a 09                	push   $0x9
+  800e39:	68 d5 4c 80 00       	push   $0x804cd5
+  800e3e:	6a 54                	push   $0x54
+  800e40:	68 f2 4c 80 00       	push   $0x804cf2
+  800e45:	e8 86 f3 ff ff       	call   8001d0 <_panic>
+
+00800e4a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	57                   	push   %edi
+  800e4e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e5f:	89 df                	mov    %ebx,%edi
+  800e61:	6a 00                	push   $0x0
+  800e63:	55                   	push   %ebp
+  800e64:	56                   	push   %esi
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	8d 35 6f 0e 80 00    	lea    0x800e6f,%esi
+  800e6d:	0f 34                	sysenter
+
+00800e6f <after_sysenter_label_1016>:
+  800e6f:	5e                   	pop    %esi
+  800e70:	5d                   	pop    %ebp
+  800e71:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 07                	jg     800e7f <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	50                   	push   %eax
+  800e83:	6a 0a                	push   $0xa
+  800e85:	68 d5 4c 80 00       	push   $0x804cd5
+  800e8a:	6a 54                	push   $0x54
+  800e8c:	68 f2 4c 80 00       	push   $0x804cf2
+  800e91:	e8 3a f3 ff ff       	call   8001d0 <_panic>
+
+00800e96 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eac:	6a 00                	push   $0x0
+  800eae:	55                   	push   %ebp
+  800eaf:	56                   	push   %esi
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	8d 35 ba 0e 80 00    	lea    0x800eba,%esi
+  800eb8:	0f 34                	sysenter
+
+00800eba <after_sysenter_label_1126>:
+  800eba:	5e                   	pop    %esi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed5:	89 cb                	mov    %ecx,%ebx
+  800ed7:	89 cf                	mov    %ecx,%edi
+  800ed9:	6a 00                	push   $0x0
+  800edb:	55                   	push   %ebp
+  800edc:	56                   	push   %esi
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	8d 35 e7 0e 80 00    	lea    0x800ee7,%esi
+  800ee5:	0f 34                	sysenter
+
+00800ee7 <after_sysenter_label_1210>:
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eec:	85 c0                	test   %eax,%eax
+  800eee:	7f 07                	jg     800ef7 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ef0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	50                   	push   %eax
+  800efb:	6a 0d                	push   $0xd
+  800efd:	68 d5 4c 80 00       	push   $0x804cd5
+  800f02:	6a 54                	push   $0x54
+  800f04:	68 f2 4c 80 00       	push   $0x804cf2
+  800f09:	e8 c2 f2 ff ff       	call   8001d0 <_panic>
+
+00800f0e <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	6a 00                	push   $0x0
+  800f27:	55                   	push   %ebp
+  800f28:	56                   	push   %esi
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	8d 35 33 0f 80 00    	lea    0x800f33,%esi
+  800f31:	0f 34                	sysenter
+
+00800f33 <after_sysenter_label_1311>:
+  800f33:	5e                   	pop    %esi
+  800f34:	5d                   	pop    %ebp
+  800f35:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	7f 07                	jg     800f43 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 42                	push   $0x42
+  800f49:	68 d5 4c 80 00       	push   $0x804cd5
+  800f4e:	6a 54                	push   $0x54
+  800f50:	68 f2 4c 80 00       	push   $0x804cf2
+  800f55:	e8 76 f2 ff ff       	call   8001d0 <_panic>
+
+00800f5a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f64:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f69:	89 d1                	mov    %edx,%ecx
+  800f6b:	89 d3                	mov    %edx,%ebx
+  800f6d:	89 d7                	mov    %edx,%edi
+  800f6f:	6a 00                	push   $0x0
+  800f71:	55                   	push   %ebp
+  800f72:	56                   	push   %esi
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	8d 35 7d 0f 80 00    	lea    0x800f7d,%esi
+  800f7b:	0f 34                	sysenter
+
+00800f7d <after_sysenter_label_1411>:
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f82:	5b                   	pop    %ebx
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+
+00800f86 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f9b:	89 df                	mov    %ebx,%edi
+  800f9d:	6a 00                	push   $0x0
+  800f9f:	55                   	push   %ebp
+  800fa0:	56                   	push   %esi
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	8d 35 ab 0f 80 00    	lea    0x800fab,%esi
+  800fa9:	0f 34                	sysenter
+
+00800fab <after_sysenter_label_1497>:
+  800fab:	5e                   	pop    %esi
+  800fac:	5d                   	pop    %ebp
+  800fad:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fc9:	89 df                	mov    %ebx,%edi
+  800fcb:	6a 00                	push   $0x0
+  800fcd:	55                   	push   %ebp
+  800fce:	56                   	push   %esi
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	8d 35 d9 0f 80 00    	lea    0x800fd9,%esi
+  800fd7:	0f 34                	sysenter
+
+00800fd9 <after_sysenter_label_1583>:
+  800fd9:	5e                   	pop    %esi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+
+00800fe2 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	57                   	push   %edi
+  800fe6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffa:	6a 00                	push   $0x0
+  800ffc:	55                   	push   %ebp
+  800ffd:	56                   	push   %esi
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	8d 35 08 10 80 00    	lea    0x801008,%esi
+  801006:	0f 34                	sysenter
+
+00801008 <after_sysenter_label_1672>:
+  801008:	5e                   	pop    %esi
+  801009:	5d                   	pop    %ebp
+  80100a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80100d:	5b                   	pop    %ebx
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+
+00801011 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801021:	b8 12 00 00 00       	mov    $0x12,%eax
+  801026:	89 df                	mov    %ebx,%edi
+  801028:	6a 00                	push   $0x0
+  80102a:	55                   	push   %ebp
+  80102b:	56                   	push   %esi
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	8d 35 36 10 80 00    	lea    0x801036,%esi
+  801034:	0f 34                	sysenter
+
+00801036 <after_sysenter_label_1758>:
+  801036:	5e                   	pop    %esi
+  801037:	5d                   	pop    %ebp
+  801038:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80103b:	5b                   	pop    %ebx
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+
+0080103f <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801051:	89 cb                	mov    %ecx,%ebx
+  801053:	89 cf                	mov    %ecx,%edi
+  801055:	6a 00                	push   $0x0
+  801057:	55                   	push   %ebp
+  801058:	56                   	push   %esi
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	8d 35 63 10 80 00    	lea    0x801063,%esi
+  801061:	0f 34                	sysenter
+
+00801063 <after_sysenter_label_1842>:
+  801063:	5e                   	pop    %esi
+  801064:	5d                   	pop    %ebp
+  801065:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	7f 07                	jg     801073 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80106c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5f                   	pop    %edi
+  801071:	5d                   	pop    %ebp
+  801072:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801073:	83 ec 0c             	sub    $0xc,%esp
+  801076:	50                   	push   %eax
+  801077:	6a 13                	push   $0x13
+  801079:	68 d5 4c 80 00       	push   $0x804cd5
+  80107e:	6a 54                	push   $0x54
+  801080:	68 f2 4c 80 00       	push   $0x804cf2
+  801085:	e8 46 f1 ff ff       	call   8001d0 <_panic>
+
+0080108a <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80108f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801094:	b8 14 00 00 00       	mov    $0x14,%eax
+  801099:	89 d1                	mov    %edx,%ecx
+  80109b:	89 d3                	mov    %edx,%ebx
+  80109d:	89 d7                	mov    %edx,%edi
+  80109f:	6a 00                	push   $0x0
+  8010a1:	55                   	push   %ebp
+  8010a2:	56                   	push   %esi
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	8d 35 ad 10 80 00    	lea    0x8010ad,%esi
+  8010ab:	0f 34                	sysenter
+
+008010ad <after_sysenter_label_1939>:
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ce:	6a 00                	push   $0x0
+  8010d0:	55                   	push   %ebp
+  8010d1:	56                   	push   %esi
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	8d 35 dc 10 80 00    	lea    0x8010dc,%esi
+  8010da:	0f 34                	sysenter
+
+008010dc <after_sysenter_label_2028>:
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5d                   	pop    %ebp
+  8010de:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010fa:	89 df                	mov    %ebx,%edi
+  8010fc:	6a 00                	push   $0x0
+  8010fe:	55                   	push   %ebp
+  8010ff:	56                   	push   %esi
+  801100:	89 e5                	mov    %esp,%ebp
+  801102:	8d 35 0a 11 80 00    	lea    0x80110a,%esi
+  801108:	0f 34                	sysenter
+
+0080110a <after_sysenter_label_2114>:
+  80110a:	5e                   	pop    %esi
+  80110b:	5d                   	pop    %ebp
+  80110c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80110f:	5b                   	pop    %ebx
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+
+00801113 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801118:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801123:	b8 17 00 00 00       	mov    $0x17,%eax
+  801128:	89 df                	mov    %ebx,%edi
+  80112a:	6a 00                	push   $0x0
+  80112c:	55                   	push   %ebp
+  80112d:	56                   	push   %esi
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	8d 35 38 11 80 00    	lea    0x801138,%esi
+  801136:	0f 34                	sysenter
+
+00801138 <after_sysenter_label_2200>:
+  801138:	5e                   	pop    %esi
+  801139:	5d                   	pop    %ebp
+  80113a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80113d:	5b                   	pop    %ebx
+  80113e:	5f                   	pop    %edi
+  80113f:	5d                   	pop    %ebp
+  801140:	c3                   	ret
+
+00801141 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	57                   	push   %edi
+  801145:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801146:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	b8 18 00 00 00       	mov    $0x18,%eax
+  801156:	89 df                	mov    %ebx,%edi
+  801158:	6a 00                	push   $0x0
+  80115a:	55                   	push   %ebp
+  80115b:	56                   	push   %esi
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	8d 35 66 11 80 00    	lea    0x801166,%esi
+  801164:	0f 34                	sysenter
+
+00801166 <after_sysenter_label_2286>:
+  801166:	5e                   	pop    %esi
+  801167:	5d                   	pop    %ebp
+  801168:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80116b:	5b                   	pop    %ebx
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801172:	8b 45 08             	mov    0x8(%ebp),%eax
+  801175:	05 00 00 00 30       	add    $0x30000000,%eax
+  80117a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+
+0080117f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801182:	8b 45 08             	mov    0x8(%ebp),%eax
+  801185:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80118a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80118f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+
+00801196 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801199:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80119e:	eb 02                	jmp    8011a2 <fd_alloc+0xc>
+  8011a0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011a2:	89 c2                	mov    %eax,%edx
+  8011a4:	c1 ea 16             	shr    $0x16,%edx
+  8011a7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011ae:	f6 c2 01             	test   $0x1,%dl
+  8011b1:	74 2b                	je     8011de <fd_alloc+0x48>
+  8011b3:	89 c2                	mov    %eax,%edx
+  8011b5:	c1 ea 0c             	shr    $0xc,%edx
+  8011b8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011bf:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011c5:	f6 c1 01             	test   $0x1,%cl
+  8011c8:	74 14                	je     8011de <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011ca:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011d0:	75 ce                	jne    8011a0 <fd_alloc+0xa>
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011d7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011dc:	eb 05                	jmp    8011e3 <fd_alloc+0x4d>
+			return 0;
+  8011de:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	89 02                	mov    %eax,(%edx)
+}
+  8011e8:	89 c8                	mov    %ecx,%eax
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+
+008011ec <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011f2:	83 f8 1f             	cmp    $0x1f,%eax
+  8011f5:	77 30                	ja     801227 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011f7:	c1 e0 0c             	shl    $0xc,%eax
+  8011fa:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011ff:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801205:	f6 c2 01             	test   $0x1,%dl
+  801208:	74 24                	je     80122e <fd_lookup+0x42>
+  80120a:	89 c2                	mov    %eax,%edx
+  80120c:	c1 ea 0c             	shr    $0xc,%edx
+  80120f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801216:	f6 c2 01             	test   $0x1,%dl
+  801219:	74 1a                	je     801235 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80121b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+		return -E_INVAL;
+  801227:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80122c:	eb f7                	jmp    801225 <fd_lookup+0x39>
+		return -E_INVAL;
+  80122e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801233:	eb f0                	jmp    801225 <fd_lookup+0x39>
+  801235:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80123a:	eb e9                	jmp    801225 <fd_lookup+0x39>
+
+0080123c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 04             	sub    $0x4,%esp
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124b:	eb 03                	jmp    801250 <dev_lookup+0x14>
+  80124d:	83 c0 01             	add    $0x1,%eax
+  801250:	8b 1c 85 7c 4d 80 00 	mov    0x804d7c(,%eax,4),%ebx
+  801257:	85 db                	test   %ebx,%ebx
+  801259:	74 0b                	je     801266 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80125b:	39 13                	cmp    %edx,(%ebx)
+  80125d:	75 ee                	jne    80124d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80125f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801264:	eb 49                	jmp    8012af <dev_lookup+0x73>
+  801266:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801268:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80126e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801273:	77 18                	ja     80128d <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801275:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80127a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80127c:	c1 e8 10             	shr    $0x10,%eax
+  80127f:	74 0c                	je     80128d <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801281:	c1 e0 10             	shl    $0x10,%eax
+  801284:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801289:	29 c1                	sub    %eax,%ecx
+  80128b:	eb 06                	jmp    801293 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80128d:	8b 0d c0 92 80 00    	mov    0x8092c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801293:	8b 01                	mov    (%ecx),%eax
+  801295:	8b 40 48             	mov    0x48(%eax),%eax
+  801298:	83 ec 04             	sub    $0x4,%esp
+  80129b:	52                   	push   %edx
+  80129c:	50                   	push   %eax
+  80129d:	68 00 4d 80 00       	push   $0x804d00
+  8012a2:	e8 04 f0 ff ff       	call   8002ab <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b2:	89 1a                	mov    %ebx,(%edx)
+}
+  8012b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+
+008012b9 <fd_close>:
+{
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 24             	sub    $0x24,%esp
+  8012c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012c5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012c8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012cb:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012cc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012d2:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012d5:	50                   	push   %eax
+  8012d6:	e8 11 ff ff ff       	call   8011ec <fd_lookup>
+  8012db:	89 c3                	mov    %eax,%ebx
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	78 05                	js     8012e9 <fd_close+0x30>
+	    || fd != fd2)
+  8012e4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012e7:	74 16                	je     8012ff <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012e9:	89 f8                	mov    %edi,%eax
+  8012eb:	84 c0                	test   %al,%al
+  8012ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f2:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012f5:	89 d8                	mov    %ebx,%eax
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012ff:	83 ec 08             	sub    $0x8,%esp
+  801302:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801305:	50                   	push   %eax
+  801306:	ff 36                	push   (%esi)
+  801308:	e8 2f ff ff ff       	call   80123c <dev_lookup>
+  80130d:	89 c3                	mov    %eax,%ebx
+  80130f:	83 c4 10             	add    $0x10,%esp
+  801312:	85 c0                	test   %eax,%eax
+  801314:	78 1a                	js     801330 <fd_close+0x77>
+		if (dev->dev_close)
+  801316:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801319:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80131c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801321:	85 c0                	test   %eax,%eax
+  801323:	74 0b                	je     801330 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	56                   	push   %esi
+  801329:	ff d0                	call   *%eax
+  80132b:	89 c3                	mov    %eax,%ebx
+  80132d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801330:	83 ec 08             	sub    $0x8,%esp
+  801333:	56                   	push   %esi
+  801334:	6a 00                	push   $0x0
+  801336:	e8 2b fa ff ff       	call   800d66 <sys_page_unmap>
+	return r;
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	eb b5                	jmp    8012f5 <fd_close+0x3c>
+
+00801340 <close>:
+
+int
+close(int fdnum)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801346:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801349:	50                   	push   %eax
+  80134a:	ff 75 08             	push   0x8(%ebp)
+  80134d:	e8 9a fe ff ff       	call   8011ec <fd_lookup>
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	79 02                	jns    80135b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+		return fd_close(fd, 1);
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	6a 01                	push   $0x1
+  801360:	ff 75 f4             	push   -0xc(%ebp)
+  801363:	e8 51 ff ff ff       	call   8012b9 <fd_close>
+  801368:	83 c4 10             	add    $0x10,%esp
+  80136b:	eb ec                	jmp    801359 <close+0x19>
+
+0080136d <close_all>:
+
+void
+close_all(void)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	53                   	push   %ebx
+  801371:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801374:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  80137c:	53                   	push   %ebx
+  80137d:	e8 be ff ff ff       	call   801340 <close>
+	for (i = 0; i < MAXFD; i++)
+  801382:	83 c3 01             	add    $0x1,%ebx
+  801385:	83 c4 10             	add    $0x10,%esp
+  801388:	83 fb 20             	cmp    $0x20,%ebx
+  80138b:	75 ec                	jne    801379 <close_all+0xc>
+}
+  80138d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801390:	c9                   	leave
+  801391:	c3                   	ret
+
+00801392 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+  801398:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80139b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80139e:	50                   	push   %eax
+  80139f:	ff 75 08             	push   0x8(%ebp)
+  8013a2:	e8 45 fe ff ff       	call   8011ec <fd_lookup>
+  8013a7:	89 c3                	mov    %eax,%ebx
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 7f                	js     80142f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	ff 75 0c             	push   0xc(%ebp)
+  8013b6:	e8 85 ff ff ff       	call   801340 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013be:	c1 e6 0c             	shl    $0xc,%esi
+  8013c1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013ca:	89 3c 24             	mov    %edi,(%esp)
+  8013cd:	e8 ad fd ff ff       	call   80117f <fd2data>
+  8013d2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013d4:	89 34 24             	mov    %esi,(%esp)
+  8013d7:	e8 a3 fd ff ff       	call   80117f <fd2data>
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013e2:	89 d8                	mov    %ebx,%eax
+  8013e4:	c1 e8 16             	shr    $0x16,%eax
+  8013e7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013ee:	a8 01                	test   $0x1,%al
+  8013f0:	74 11                	je     801403 <dup+0x71>
+  8013f2:	89 d8                	mov    %ebx,%eax
+  8013f4:	c1 e8 0c             	shr    $0xc,%eax
+  8013f7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013fe:	f6 c2 01             	test   $0x1,%dl
+  801401:	75 36                	jne    801439 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801403:	89 f8                	mov    %edi,%eax
+  801405:	c1 e8 0c             	shr    $0xc,%eax
+  801408:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80140f:	83 ec 0c             	sub    $0xc,%esp
+  801412:	25 07 0e 00 00       	and    $0xe07,%eax
+  801417:	50                   	push   %eax
+  801418:	56                   	push   %esi
+  801419:	6a 00                	push   $0x0
+  80141b:	57                   	push   %edi
+  80141c:	6a 00                	push   $0x0
+  80141e:	e8 f7 f8 ff ff       	call   800d1a <sys_page_map>
+  801423:	89 c3                	mov    %eax,%ebx
+  801425:	83 c4 20             	add    $0x20,%esp
+  801428:	85 c0                	test   %eax,%eax
+  80142a:	78 33                	js     80145f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80142c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80142f:	89 d8                	mov    %ebx,%eax
+  801431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801439:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	25 07 0e 00 00       	and    $0xe07,%eax
+  801448:	50                   	push   %eax
+  801449:	ff 75 d4             	push   -0x2c(%ebp)
+  80144c:	6a 00                	push   $0x0
+  80144e:	53                   	push   %ebx
+  80144f:	6a 00                	push   $0x0
+  801451:	e8 c4 f8 ff ff       	call   800d1a <sys_page_map>
+  801456:	89 c3                	mov    %eax,%ebx
+  801458:	83 c4 20             	add    $0x20,%esp
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	79 a4                	jns    801403 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80145f:	83 ec 08             	sub    $0x8,%esp
+  801462:	56                   	push   %esi
+  801463:	6a 00                	push   $0x0
+  801465:	e8 fc f8 ff ff       	call   800d66 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80146a:	83 c4 08             	add    $0x8,%esp
+  80146d:	ff 75 d4             	push   -0x2c(%ebp)
+  801470:	6a 00                	push   $0x0
+  801472:	e8 ef f8 ff ff       	call   800d66 <sys_page_unmap>
+	return r;
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	eb b3                	jmp    80142f <dup+0x9d>
+
+0080147c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+  801481:	83 ec 18             	sub    $0x18,%esp
+  801484:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801487:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80148a:	50                   	push   %eax
+  80148b:	53                   	push   %ebx
+  80148c:	e8 5b fd ff ff       	call   8011ec <fd_lookup>
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	85 c0                	test   %eax,%eax
+  801496:	78 3c                	js     8014d4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801498:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80149b:	83 ec 08             	sub    $0x8,%esp
+  80149e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a1:	50                   	push   %eax
+  8014a2:	ff 36                	push   (%esi)
+  8014a4:	e8 93 fd ff ff       	call   80123c <dev_lookup>
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	78 24                	js     8014d4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014b0:	8b 46 08             	mov    0x8(%esi),%eax
+  8014b3:	83 e0 03             	and    $0x3,%eax
+  8014b6:	83 f8 01             	cmp    $0x1,%eax
+  8014b9:	74 20                	je     8014db <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014be:	8b 40 08             	mov    0x8(%eax),%eax
+  8014c1:	85 c0                	test   %eax,%eax
+  8014c3:	74 61                	je     801526 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014c5:	83 ec 04             	sub    $0x4,%esp
+  8014c8:	ff 75 10             	push   0x10(%ebp)
+  8014cb:	ff 75 0c             	push   0xc(%ebp)
+  8014ce:	56                   	push   %esi
+  8014cf:	ff d0                	call   *%eax
+  8014d1:	83 c4 10             	add    $0x10,%esp
+}
+  8014d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d7:	5b                   	pop    %ebx
+  8014d8:	5e                   	pop    %esi
+  8014d9:	5d                   	pop    %ebp
+  8014da:	c3                   	ret
+  8014db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014e8:	77 18                	ja     801502 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014ef:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014f1:	c1 e8 10             	shr    $0x10,%eax
+  8014f4:	74 0c                	je     801502 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014f6:	c1 e0 10             	shl    $0x10,%eax
+  8014f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014fe:	29 c2                	sub    %eax,%edx
+  801500:	eb 06                	jmp    801508 <read+0x8c>
+		return pthread_main_tls;
+  801502:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801508:	8b 02                	mov    (%edx),%eax
+  80150a:	8b 40 48             	mov    0x48(%eax),%eax
+  80150d:	83 ec 04             	sub    $0x4,%esp
+  801510:	53                   	push   %ebx
+  801511:	50                   	push   %eax
+  801512:	68 41 4d 80 00       	push   $0x804d41
+  801517:	e8 8f ed ff ff       	call   8002ab <cprintf>
+		return -E_INVAL;
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801524:	eb ae                	jmp    8014d4 <read+0x58>
+		return -E_NOT_SUPP;
+  801526:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80152b:	eb a7                	jmp    8014d4 <read+0x58>
+
+0080152d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	57                   	push   %edi
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	83 ec 0c             	sub    $0xc,%esp
+  801536:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801539:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801541:	eb 02                	jmp    801545 <readn+0x18>
+  801543:	01 c3                	add    %eax,%ebx
+  801545:	39 f3                	cmp    %esi,%ebx
+  801547:	73 21                	jae    80156a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801549:	83 ec 04             	sub    $0x4,%esp
+  80154c:	89 f0                	mov    %esi,%eax
+  80154e:	29 d8                	sub    %ebx,%eax
+  801550:	50                   	push   %eax
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	03 45 0c             	add    0xc(%ebp),%eax
+  801556:	50                   	push   %eax
+  801557:	57                   	push   %edi
+  801558:	e8 1f ff ff ff       	call   80147c <read>
+		if (m < 0)
+  80155d:	83 c4 10             	add    $0x10,%esp
+  801560:	85 c0                	test   %eax,%eax
+  801562:	78 04                	js     801568 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801564:	75 dd                	jne    801543 <readn+0x16>
+  801566:	eb 02                	jmp    80156a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801568:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80156a:	89 d8                	mov    %ebx,%eax
+  80156c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	83 ec 18             	sub    $0x18,%esp
+  80157c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801582:	50                   	push   %eax
+  801583:	53                   	push   %ebx
+  801584:	e8 63 fc ff ff       	call   8011ec <fd_lookup>
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	78 37                	js     8015c7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801590:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801593:	83 ec 08             	sub    $0x8,%esp
+  801596:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801599:	50                   	push   %eax
+  80159a:	ff 36                	push   (%esi)
+  80159c:	e8 9b fc ff ff       	call   80123c <dev_lookup>
+  8015a1:	83 c4 10             	add    $0x10,%esp
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	78 1f                	js     8015c7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015a8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ac:	74 20                	je     8015ce <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	74 61                	je     801619 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015b8:	83 ec 04             	sub    $0x4,%esp
+  8015bb:	ff 75 10             	push   0x10(%ebp)
+  8015be:	ff 75 0c             	push   0xc(%ebp)
+  8015c1:	56                   	push   %esi
+  8015c2:	ff d0                	call   *%eax
+  8015c4:	83 c4 10             	add    $0x10,%esp
+}
+  8015c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5d                   	pop    %ebp
+  8015cd:	c3                   	ret
+  8015ce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015d0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015d6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015db:	77 18                	ja     8015f5 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015dd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015e2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015e4:	c1 e8 10             	shr    $0x10,%eax
+  8015e7:	74 0c                	je     8015f5 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015e9:	c1 e0 10             	shl    $0x10,%eax
+  8015ec:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015f1:	29 c2                	sub    %eax,%edx
+  8015f3:	eb 06                	jmp    8015fb <write+0x87>
+		return pthread_main_tls;
+  8015f5:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015fb:	8b 02                	mov    (%edx),%eax
+  8015fd:	8b 40 48             	mov    0x48(%eax),%eax
+  801600:	83 ec 04             	sub    $0x4,%esp
+  801603:	53                   	push   %ebx
+  801604:	50                   	push   %eax
+  801605:	68 5d 4d 80 00       	push   $0x804d5d
+  80160a:	e8 9c ec ff ff       	call   8002ab <cprintf>
+		return -E_INVAL;
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801617:	eb ae                	jmp    8015c7 <write+0x53>
+		return -E_NOT_SUPP;
+  801619:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80161e:	eb a7                	jmp    8015c7 <write+0x53>
+
+00801620 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801620:	55                   	push   %ebp
+  801621:	89 e5                	mov    %esp,%ebp
+  801623:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801626:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801629:	50                   	push   %eax
+  80162a:	ff 75 08             	push   0x8(%ebp)
+  80162d:	e8 ba fb ff ff       	call   8011ec <fd_lookup>
+  801632:	83 c4 10             	add    $0x10,%esp
+  801635:	85 c0                	test   %eax,%eax
+  801637:	78 0e                	js     801647 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801639:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80163f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+
+00801649 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	56                   	push   %esi
+  80164d:	53                   	push   %ebx
+  80164e:	83 ec 18             	sub    $0x18,%esp
+  801651:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801654:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801657:	50                   	push   %eax
+  801658:	53                   	push   %ebx
+  801659:	e8 8e fb ff ff       	call   8011ec <fd_lookup>
+  80165e:	83 c4 10             	add    $0x10,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	78 34                	js     801699 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801665:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801668:	83 ec 08             	sub    $0x8,%esp
+  80166b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166e:	50                   	push   %eax
+  80166f:	ff 36                	push   (%esi)
+  801671:	e8 c6 fb ff ff       	call   80123c <dev_lookup>
+  801676:	83 c4 10             	add    $0x10,%esp
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	78 1c                	js     801699 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80167d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801681:	74 1d                	je     8016a0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801683:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801686:	8b 40 18             	mov    0x18(%eax),%eax
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	74 5e                	je     8016eb <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80168d:	83 ec 08             	sub    $0x8,%esp
+  801690:	ff 75 0c             	push   0xc(%ebp)
+  801693:	56                   	push   %esi
+  801694:	ff d0                	call   *%eax
+  801696:	83 c4 10             	add    $0x10,%esp
+}
+  801699:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169c:	5b                   	pop    %ebx
+  80169d:	5e                   	pop    %esi
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+  8016a0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016a2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016a8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016ad:	77 18                	ja     8016c7 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016af:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016b4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016b6:	c1 e8 10             	shr    $0x10,%eax
+  8016b9:	74 0c                	je     8016c7 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016bb:	c1 e0 10             	shl    $0x10,%eax
+  8016be:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016c3:	29 c2                	sub    %eax,%edx
+  8016c5:	eb 06                	jmp    8016cd <ftruncate+0x84>
+		return pthread_main_tls;
+  8016c7:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+			thisenv->env_id, fdnum);
+  8016cd:	8b 02                	mov    (%edx),%eax
+  8016cf:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016d2:	83 ec 04             	sub    $0x4,%esp
+  8016d5:	53                   	push   %ebx
+  8016d6:	50                   	push   %eax
+  8016d7:	68 20 4d 80 00       	push   $0x804d20
+  8016dc:	e8 ca eb ff ff       	call   8002ab <cprintf>
+		return -E_INVAL;
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e9:	eb ae                	jmp    801699 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f0:	eb a7                	jmp    801699 <ftruncate+0x50>
+
+008016f2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	56                   	push   %esi
+  8016f6:	53                   	push   %ebx
+  8016f7:	83 ec 18             	sub    $0x18,%esp
+  8016fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801700:	50                   	push   %eax
+  801701:	ff 75 08             	push   0x8(%ebp)
+  801704:	e8 e3 fa ff ff       	call   8011ec <fd_lookup>
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	78 49                	js     801759 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801710:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801713:	83 ec 08             	sub    $0x8,%esp
+  801716:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801719:	50                   	push   %eax
+  80171a:	ff 36                	push   (%esi)
+  80171c:	e8 1b fb ff ff       	call   80123c <dev_lookup>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 31                	js     801759 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80172f:	74 2f                	je     801760 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801731:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801734:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80173b:	00 00 00 
+	stat->st_isdir = 0;
+  80173e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801745:	00 00 00 
+	stat->st_dev = dev;
+  801748:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80174e:	83 ec 08             	sub    $0x8,%esp
+  801751:	53                   	push   %ebx
+  801752:	56                   	push   %esi
+  801753:	ff 50 14             	call   *0x14(%eax)
+  801756:	83 c4 10             	add    $0x10,%esp
+}
+  801759:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175c:	5b                   	pop    %ebx
+  80175d:	5e                   	pop    %esi
+  80175e:	5d                   	pop    %ebp
+  80175f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801760:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801765:	eb f2                	jmp    801759 <fstat+0x67>
+
+00801767 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801767:	55                   	push   %ebp
+  801768:	89 e5                	mov    %esp,%ebp
+  80176a:	56                   	push   %esi
+  80176b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	6a 00                	push   $0x0
+  801771:	ff 75 08             	push   0x8(%ebp)
+  801774:	e8 4b 03 00 00       	call   801ac4 <open>
+  801779:	89 c3                	mov    %eax,%ebx
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	85 c0                	test   %eax,%eax
+  801780:	78 1b                	js     80179d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	ff 75 0c             	push   0xc(%ebp)
+  801788:	50                   	push   %eax
+  801789:	e8 64 ff ff ff       	call   8016f2 <fstat>
+  80178e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801790:	89 1c 24             	mov    %ebx,(%esp)
+  801793:	e8 a8 fb ff ff       	call   801340 <close>
+	return r;
+  801798:	83 c4 10             	add    $0x10,%esp
+  80179b:	89 f3                	mov    %esi,%ebx
+}
+  80179d:	89 d8                	mov    %ebx,%eax
+  80179f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a2:	5b                   	pop    %ebx
+  8017a3:	5e                   	pop    %esi
+  8017a4:	5d                   	pop    %ebp
+  8017a5:	c3                   	ret
+
+008017a6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	56                   	push   %esi
+  8017aa:	53                   	push   %ebx
+  8017ab:	89 c6                	mov    %eax,%esi
+  8017ad:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017af:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8017b6:	74 27                	je     8017df <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017b8:	6a 07                	push   $0x7
+  8017ba:	68 00 a0 80 00       	push   $0x80a000
+  8017bf:	56                   	push   %esi
+  8017c0:	ff 35 00 70 80 00    	push   0x807000
+  8017c6:	e8 62 2d 00 00       	call   80452d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017cb:	83 c4 0c             	add    $0xc,%esp
+  8017ce:	6a 00                	push   $0x0
+  8017d0:	53                   	push   %ebx
+  8017d1:	6a 00                	push   $0x0
+  8017d3:	e8 5f 2c 00 00       	call   804437 <ipc_recv>
+}
+  8017d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017db:	5b                   	pop    %ebx
+  8017dc:	5e                   	pop    %esi
+  8017dd:	5d                   	pop    %ebp
+  8017de:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017df:	83 ec 0c             	sub    $0xc,%esp
+  8017e2:	6a 01                	push   $0x1
+  8017e4:	e8 9a 2d 00 00       	call   804583 <ipc_find_env>
+  8017e9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	eb c5                	jmp    8017b8 <fsipc+0x12>
+
+008017f3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017fa:	68 04 70 80 00       	push   $0x807004
+  8017ff:	e8 3d 1c 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801804:	8b 45 08             	mov    0x8(%ebp),%eax
+  801807:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  80180f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801812:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801821:	e8 80 ff ff ff       	call   8017a6 <fsipc>
+  801826:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801828:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80182f:	e8 7a 1c 00 00       	call   8034ae <mutex_unlock>
+	return r;
+}
+  801834:	89 d8                	mov    %ebx,%eax
+  801836:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801839:	c9                   	leave
+  80183a:	c3                   	ret
+
+0080183b <devfile_flush>:
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801842:	68 04 70 80 00       	push   $0x807004
+  801847:	e8 f5 1b 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80184c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801852:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801857:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801861:	e8 40 ff ff ff       	call   8017a6 <fsipc>
+  801866:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801868:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80186f:	e8 3a 1c 00 00       	call   8034ae <mutex_unlock>
+}
+  801874:	89 d8                	mov    %ebx,%eax
+  801876:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801879:	c9                   	leave
+  80187a:	c3                   	ret
+
+0080187b <devfile_stat>:
+{
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	56                   	push   %esi
+  80187f:	53                   	push   %ebx
+  801880:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801883:	83 ec 0c             	sub    $0xc,%esp
+  801886:	68 04 70 80 00       	push   $0x807004
+  80188b:	e8 b1 1b 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801890:	8b 45 08             	mov    0x8(%ebp),%eax
+  801893:	8b 40 0c             	mov    0xc(%eax),%eax
+  801896:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80189b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a5:	e8 fc fe ff ff       	call   8017a6 <fsipc>
+  8018aa:	89 c3                	mov    %eax,%ebx
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	79 16                	jns    8018c9 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8018b3:	83 ec 0c             	sub    $0xc,%esp
+  8018b6:	68 04 70 80 00       	push   $0x807004
+  8018bb:	e8 ee 1b 00 00       	call   8034ae <mutex_unlock>
+}
+  8018c0:	89 d8                	mov    %ebx,%eax
+  8018c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c5:	5b                   	pop    %ebx
+  8018c6:	5e                   	pop    %esi
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	68 00 a0 80 00       	push   $0x80a000
+  8018d1:	56                   	push   %esi
+  8018d2:	e8 b8 ef ff ff       	call   80088f <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8018d7:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  8018dc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018e2:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  8018e7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018ed:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f5:	eb bc                	jmp    8018b3 <devfile_stat+0x38>
+
+008018f7 <devfile_write>:
+{
+  8018f7:	55                   	push   %ebp
+  8018f8:	89 e5                	mov    %esp,%ebp
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 10             	sub    $0x10,%esp
+  8018fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801901:	68 04 70 80 00       	push   $0x807004
+  801906:	e8 36 1b 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80190b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801911:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80191f:	76 3d                	jbe    80195e <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801921:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801926:	39 c3                	cmp    %eax,%ebx
+  801928:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80192b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192e:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	fsipcbuf.write.req_n = n;
+  801933:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801943:	e8 5e fe ff ff       	call   8017a6 <fsipc>
+  801948:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	68 04 70 80 00       	push   $0x807004
+  801952:	e8 57 1b 00 00       	call   8034ae <mutex_unlock>
+}
+  801957:	89 d8                	mov    %ebx,%eax
+  801959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80195e:	83 ec 04             	sub    $0x4,%esp
+  801961:	53                   	push   %ebx
+  801962:	ff 75 0c             	push   0xc(%ebp)
+  801965:	68 0c a0 80 00       	push   $0x80a00c
+  80196a:	e8 a6 f0 ff ff       	call   800a15 <memmove>
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	eb b5                	jmp    80192e <devfile_write+0x37>
+
+00801979 <devfile_read>:
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	57                   	push   %edi
+  80197d:	56                   	push   %esi
+  80197e:	53                   	push   %ebx
+  80197f:	83 ec 0c             	sub    $0xc,%esp
+  801982:	8b 75 08             	mov    0x8(%ebp),%esi
+  801985:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801988:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80198b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801991:	0f 86 8c 00 00 00    	jbe    801a23 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801997:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80199c:	39 c3                	cmp    %eax,%ebx
+  80199e:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019a1:	89 f8                	mov    %edi,%eax
+  8019a3:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019a6:	eb 0f                	jmp    8019b7 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8019a8:	0f b6 08             	movzbl (%eax),%ecx
+  8019ab:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8019ad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019b2:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019b7:	39 d0                	cmp    %edx,%eax
+  8019b9:	72 ed                	jb     8019a8 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8019bb:	83 ec 0c             	sub    $0xc,%esp
+  8019be:	68 04 70 80 00       	push   $0x807004
+  8019c3:	e8 79 1a 00 00       	call   803441 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019c8:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019cb:	a3 00 a0 80 00       	mov    %eax,0x80a000
+		fsipcbuf.read.req_n = n;
+  8019d0:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8019d6:	89 3d 08 a0 80 00    	mov    %edi,0x80a008
+		r = fsipc(FSREQ_READ, NULL);
+  8019dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019e6:	e8 bb fd ff ff       	call   8017a6 <fsipc>
+  8019eb:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019ed:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8019f4:	e8 b5 1a 00 00       	call   8034ae <mutex_unlock>
+		assert(r <= (int) n);
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	39 f3                	cmp    %esi,%ebx
+  8019fe:	7c 0a                	jl     801a0a <devfile_read+0x91>
+}
+  801a00:	89 f0                	mov    %esi,%eax
+  801a02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a05:	5b                   	pop    %ebx
+  801a06:	5e                   	pop    %esi
+  801a07:	5f                   	pop    %edi
+  801a08:	5d                   	pop    %ebp
+  801a09:	c3                   	ret
+		assert(r <= (int) n);
+  801a0a:	68 90 4d 80 00       	push   $0x804d90
+  801a0f:	68 9d 4d 80 00       	push   $0x804d9d
+  801a14:	68 90 00 00 00       	push   $0x90
+  801a19:	68 b2 4d 80 00       	push   $0x804db2
+  801a1e:	e8 ad e7 ff ff       	call   8001d0 <_panic>
+	mutex_lock(&fsipc_mu);
+  801a23:	83 ec 0c             	sub    $0xc,%esp
+  801a26:	68 04 70 80 00       	push   $0x807004
+  801a2b:	e8 11 1a 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a30:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a33:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  801a38:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	fsipcbuf.read.req_va = 0;
+  801a3e:	c7 05 08 a0 80 00 00 	movl   $0x0,0x80a008
+  801a45:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801a48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a52:	e8 4f fd ff ff       	call   8017a6 <fsipc>
+  801a57:	89 c6                	mov    %eax,%esi
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 1d                	js     801a7d <devfile_read+0x104>
+		assert(r <= n);
+  801a60:	39 c3                	cmp    %eax,%ebx
+  801a62:	72 2e                	jb     801a92 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a64:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a69:	7f 40                	jg     801aab <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a6b:	83 ec 04             	sub    $0x4,%esp
+  801a6e:	50                   	push   %eax
+  801a6f:	68 00 a0 80 00       	push   $0x80a000
+  801a74:	57                   	push   %edi
+  801a75:	e8 9b ef ff ff       	call   800a15 <memmove>
+  801a7a:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a7d:	83 ec 0c             	sub    $0xc,%esp
+  801a80:	68 04 70 80 00       	push   $0x807004
+  801a85:	e8 24 1a 00 00       	call   8034ae <mutex_unlock>
+	return r;
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	e9 6e ff ff ff       	jmp    801a00 <devfile_read+0x87>
+		assert(r <= n);
+  801a92:	68 bd 4d 80 00       	push   $0x804dbd
+  801a97:	68 9d 4d 80 00       	push   $0x804d9d
+  801a9c:	68 99 00 00 00       	push   $0x99
+  801aa1:	68 b2 4d 80 00       	push   $0x804db2
+  801aa6:	e8 25 e7 ff ff       	call   8001d0 <_panic>
+		assert(r <= PGSIZE);
+  801aab:	68 c4 4d 80 00       	push   $0x804dc4
+  801ab0:	68 9d 4d 80 00       	push   $0x804d9d
+  801ab5:	68 9a 00 00 00       	push   $0x9a
+  801aba:	68 b2 4d 80 00       	push   $0x804db2
+  801abf:	e8 0c e7 ff ff       	call   8001d0 <_panic>
+
+00801ac4 <open>:
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	56                   	push   %esi
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 1c             	sub    $0x1c,%esp
+  801acc:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801acf:	56                   	push   %esi
+  801ad0:	e8 7f ed ff ff       	call   800854 <strlen>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801add:	0f 8f 85 00 00 00    	jg     801b68 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ae3:	83 ec 0c             	sub    $0xc,%esp
+  801ae6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae9:	50                   	push   %eax
+  801aea:	e8 a7 f6 ff ff       	call   801196 <fd_alloc>
+  801aef:	89 c3                	mov    %eax,%ebx
+  801af1:	83 c4 10             	add    $0x10,%esp
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	78 55                	js     801b4d <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801af8:	83 ec 0c             	sub    $0xc,%esp
+  801afb:	68 04 70 80 00       	push   $0x807004
+  801b00:	e8 3c 19 00 00       	call   803441 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b05:	83 c4 08             	add    $0x8,%esp
+  801b08:	56                   	push   %esi
+  801b09:	68 00 a0 80 00       	push   $0x80a000
+  801b0e:	e8 7c ed ff ff       	call   80088f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b16:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b1b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b23:	e8 7e fc ff ff       	call   8017a6 <fsipc>
+  801b28:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b2a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b31:	e8 78 19 00 00       	call   8034ae <mutex_unlock>
+	if (r < 0) {
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 db                	test   %ebx,%ebx
+  801b3b:	78 19                	js     801b56 <open+0x92>
+	return fd2num(fd);
+  801b3d:	83 ec 0c             	sub    $0xc,%esp
+  801b40:	ff 75 f4             	push   -0xc(%ebp)
+  801b43:	e8 27 f6 ff ff       	call   80116f <fd2num>
+  801b48:	89 c3                	mov    %eax,%ebx
+  801b4a:	83 c4 10             	add    $0x10,%esp
+}
+  801b4d:	89 d8                	mov    %ebx,%eax
+  801b4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5d                   	pop    %ebp
+  801b55:	c3                   	ret
+		fd_close(fd, 0);
+  801b56:	83 ec 08             	sub    $0x8,%esp
+  801b59:	6a 00                	push   $0x0
+  801b5b:	ff 75 f4             	push   -0xc(%ebp)
+  801b5e:	e8 56 f7 ff ff       	call   8012b9 <fd_close>
+		return r;
+  801b63:	83 c4 10             	add    $0x10,%esp
+  801b66:	eb e5                	jmp    801b4d <open+0x89>
+		return -E_BAD_PATH;
+  801b68:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b6d:	eb de                	jmp    801b4d <open+0x89>
+
+00801b6f <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	53                   	push   %ebx
+  801b73:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b79:	50                   	push   %eax
+  801b7a:	ff 75 08             	push   0x8(%ebp)
+  801b7d:	e8 6a f6 ff ff       	call   8011ec <fd_lookup>
+  801b82:	89 c3                	mov    %eax,%ebx
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 5b                	js     801be6 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b8e:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801b94:	39 08                	cmp    %ecx,(%eax)
+  801b96:	75 55                	jne    801bed <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b98:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b9c:	74 56                	je     801bf4 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b9e:	83 ec 0c             	sub    $0xc,%esp
+  801ba1:	68 04 70 80 00       	push   $0x807004
+  801ba6:	e8 96 18 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bae:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.allocate.req_offset = offset;
+  801bb6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bb9:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.allocate.req_len = len;
+  801bbe:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc1:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801bd0:	e8 d1 fb ff ff       	call   8017a6 <fsipc>
+  801bd5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bd7:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801bde:	e8 cb 18 00 00       	call   8034ae <mutex_unlock>
+	return r;
+  801be3:	83 c4 10             	add    $0x10,%esp
+}
+  801be6:	89 d8                	mov    %ebx,%eax
+  801be8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801beb:	c9                   	leave
+  801bec:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bed:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801bf2:	eb f2                	jmp    801be6 <fallocate+0x77>
+		return -E_INVAL;
+  801bf4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801bf9:	eb eb                	jmp    801be6 <fallocate+0x77>
+
+00801bfb <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801bfb:	55                   	push   %ebp
+  801bfc:	89 e5                	mov    %esp,%ebp
+  801bfe:	56                   	push   %esi
+  801bff:	53                   	push   %ebx
+  801c00:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c03:	89 f3                	mov    %esi,%ebx
+  801c05:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c0b:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c0e:	eb 06                	jmp    801c16 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c10:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c16:	39 f3                	cmp    %esi,%ebx
+  801c18:	73 14                	jae    801c2e <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c1a:	83 ec 08             	sub    $0x8,%esp
+  801c1d:	53                   	push   %ebx
+  801c1e:	6a 00                	push   $0x0
+  801c20:	e8 41 f1 ff ff       	call   800d66 <sys_page_unmap>
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	79 e4                	jns    801c10 <munmap+0x15>
+  801c2c:	eb 05                	jmp    801c33 <munmap+0x38>
+			return r;
+	return 0;
+  801c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c36:	5b                   	pop    %ebx
+  801c37:	5e                   	pop    %esi
+  801c38:	5d                   	pop    %ebp
+  801c39:	c3                   	ret
+
+00801c3a <mmap>:
+{
+  801c3a:	55                   	push   %ebp
+  801c3b:	89 e5                	mov    %esp,%ebp
+  801c3d:	57                   	push   %edi
+  801c3e:	56                   	push   %esi
+  801c3f:	53                   	push   %ebx
+  801c40:	83 ec 24             	sub    $0x24,%esp
+  801c43:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c46:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c49:	50                   	push   %eax
+  801c4a:	ff 75 08             	push   0x8(%ebp)
+  801c4d:	e8 9a f5 ff ff       	call   8011ec <fd_lookup>
+  801c52:	83 c4 10             	add    $0x10,%esp
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	0f 88 37 01 00 00    	js     801d94 <mmap+0x15a>
+		return NULL;
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c62:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c65:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801c6b:	39 0a                	cmp    %ecx,(%edx)
+  801c6d:	0f 85 05 01 00 00    	jne    801d78 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c73:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c7a:	0f 85 1b 01 00 00    	jne    801d9b <mmap+0x161>
+  801c80:	89 f0                	mov    %esi,%eax
+  801c82:	83 e8 01             	sub    $0x1,%eax
+  801c85:	0f 88 17 01 00 00    	js     801da2 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c8b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c8f:	75 28                	jne    801cb9 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c91:	83 ec 0c             	sub    $0xc,%esp
+  801c94:	68 04 70 80 00       	push   $0x807004
+  801c99:	e8 a3 17 00 00       	call   803441 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c9e:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801ca4:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801cb2:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801cb7:	eb 2b                	jmp    801ce4 <mmap+0xaa>
+		cow_enable();
+  801cb9:	e8 08 23 00 00       	call   803fc6 <cow_enable>
+  801cbe:	eb d1                	jmp    801c91 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801cc0:	89 c2                	mov    %eax,%edx
+  801cc2:	c1 ea 0c             	shr    $0xc,%edx
+  801cc5:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801ccc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801cd2:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801cd8:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801cdb:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801cdd:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801ce2:	77 25                	ja     801d09 <mmap+0xcf>
+  801ce4:	89 c2                	mov    %eax,%edx
+  801ce6:	29 da                	sub    %ebx,%edx
+  801ce8:	39 ca                	cmp    %ecx,%edx
+  801cea:	73 3a                	jae    801d26 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801cec:	89 c2                	mov    %eax,%edx
+  801cee:	c1 ea 16             	shr    $0x16,%edx
+  801cf1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cf8:	f6 c2 01             	test   $0x1,%dl
+  801cfb:	75 c3                	jne    801cc0 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801cfd:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801d02:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801d07:	eb d4                	jmp    801cdd <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801d09:	29 d8                	sub    %ebx,%eax
+  801d0b:	39 c8                	cmp    %ecx,%eax
+  801d0d:	73 17                	jae    801d26 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801d0f:	83 ec 0c             	sub    $0xc,%esp
+  801d12:	68 04 70 80 00       	push   $0x807004
+  801d17:	e8 92 17 00 00       	call   8034ae <mutex_unlock>
+		return NULL;
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d24:	eb 52                	jmp    801d78 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d26:	85 db                	test   %ebx,%ebx
+  801d28:	74 e5                	je     801d0f <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d30:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.map.req_offset = offset;
+  801d35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d38:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.map.req_len = len;
+  801d3d:	89 35 08 a0 80 00    	mov    %esi,0x80a008
+	fsipcbuf.map.req_va = va;
+  801d43:	89 1d 0c a0 80 00    	mov    %ebx,0x80a00c
+	fsipcbuf.map.req_prot = prot;
+  801d49:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d4c:	a3 10 a0 80 00       	mov    %eax,0x80a010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d56:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d5b:	e8 46 fa ff ff       	call   8017a6 <fsipc>
+  801d60:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	68 04 70 80 00       	push   $0x807004
+  801d6a:	e8 3f 17 00 00       	call   8034ae <mutex_unlock>
+	if (r < 0) {
+  801d6f:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d72:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d74:	85 ff                	test   %edi,%edi
+  801d76:	78 08                	js     801d80 <mmap+0x146>
+}
+  801d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7b:	5b                   	pop    %ebx
+  801d7c:	5e                   	pop    %esi
+  801d7d:	5f                   	pop    %edi
+  801d7e:	5d                   	pop    %ebp
+  801d7f:	c3                   	ret
+		munmap((void*) va, len);
+  801d80:	83 ec 08             	sub    $0x8,%esp
+  801d83:	56                   	push   %esi
+  801d84:	53                   	push   %ebx
+  801d85:	e8 71 fe ff ff       	call   801bfb <munmap>
+		return NULL;
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d92:	eb e4                	jmp    801d78 <mmap+0x13e>
+		return NULL;
+  801d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d99:	eb dd                	jmp    801d78 <mmap+0x13e>
+		return NULL;
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	eb d6                	jmp    801d78 <mmap+0x13e>
+  801da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da7:	eb cf                	jmp    801d78 <mmap+0x13e>
+
+00801da9 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801da9:	55                   	push   %ebp
+  801daa:	89 e5                	mov    %esp,%ebp
+  801dac:	53                   	push   %ebx
+  801dad:	83 ec 10             	sub    $0x10,%esp
+  801db0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801db3:	53                   	push   %ebx
+  801db4:	e8 9b ea ff ff       	call   800854 <strlen>
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dc1:	7f 42                	jg     801e05 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801dc3:	83 ec 0c             	sub    $0xc,%esp
+  801dc6:	68 04 70 80 00       	push   $0x807004
+  801dcb:	e8 71 16 00 00       	call   803441 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dd0:	83 c4 08             	add    $0x8,%esp
+  801dd3:	53                   	push   %ebx
+  801dd4:	68 00 a0 80 00       	push   $0x80a000
+  801dd9:	e8 b1 ea ff ff       	call   80088f <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de3:	b8 07 00 00 00       	mov    $0x7,%eax
+  801de8:	e8 b9 f9 ff ff       	call   8017a6 <fsipc>
+  801ded:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801def:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801df6:	e8 b3 16 00 00       	call   8034ae <mutex_unlock>
+	return r;
+  801dfb:	83 c4 10             	add    $0x10,%esp
+}
+  801dfe:	89 d8                	mov    %ebx,%eax
+  801e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+		return -E_BAD_PATH;
+  801e05:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e0a:	eb f2                	jmp    801dfe <remove+0x55>
+
+00801e0c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e13:	68 04 70 80 00       	push   $0x807004
+  801e18:	e8 24 16 00 00       	call   803441 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e22:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e27:	e8 7a f9 ff ff       	call   8017a6 <fsipc>
+  801e2c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e2e:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801e35:	e8 74 16 00 00       	call   8034ae <mutex_unlock>
+	return r;
+}
+  801e3a:	89 d8                	mov    %ebx,%eax
+  801e3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e49:	83 ec 0c             	sub    $0xc,%esp
+  801e4c:	68 04 70 80 00       	push   $0x807004
+  801e51:	e8 eb 15 00 00       	call   803441 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e59:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e63:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e68:	e8 39 f9 ff ff       	call   8017a6 <fsipc>
+  801e6d:	89 c6                	mov    %eax,%esi
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	85 db                	test   %ebx,%ebx
+  801e74:	74 7b                	je     801ef1 <fs_bcstat+0xb0>
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 77                	js     801ef1 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e7a:	a1 00 a0 80 00       	mov    0x80a000,%eax
+  801e7f:	89 03                	mov    %eax,(%ebx)
+  801e81:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801e86:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e89:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  801e8e:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e91:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  801e96:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e99:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  801e9e:	89 43 10             	mov    %eax,0x10(%ebx)
+  801ea1:	a1 14 a0 80 00       	mov    0x80a014,%eax
+  801ea6:	89 43 14             	mov    %eax,0x14(%ebx)
+  801ea9:	a1 18 a0 80 00       	mov    0x80a018,%eax
+  801eae:	89 43 18             	mov    %eax,0x18(%ebx)
+  801eb1:	a1 1c a0 80 00       	mov    0x80a01c,%eax
+  801eb6:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801eb9:	a1 20 a0 80 00       	mov    0x80a020,%eax
+  801ebe:	89 43 20             	mov    %eax,0x20(%ebx)
+  801ec1:	a1 24 a0 80 00       	mov    0x80a024,%eax
+  801ec6:	89 43 24             	mov    %eax,0x24(%ebx)
+  801ec9:	a1 28 a0 80 00       	mov    0x80a028,%eax
+  801ece:	89 43 28             	mov    %eax,0x28(%ebx)
+  801ed1:	a1 2c a0 80 00       	mov    0x80a02c,%eax
+  801ed6:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801ed9:	a1 30 a0 80 00       	mov    0x80a030,%eax
+  801ede:	89 43 30             	mov    %eax,0x30(%ebx)
+  801ee1:	a1 34 a0 80 00       	mov    0x80a034,%eax
+  801ee6:	89 43 34             	mov    %eax,0x34(%ebx)
+  801ee9:	a1 38 a0 80 00       	mov    0x80a038,%eax
+  801eee:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ef1:	83 ec 0c             	sub    $0xc,%esp
+  801ef4:	68 04 70 80 00       	push   $0x807004
+  801ef9:	e8 b0 15 00 00       	call   8034ae <mutex_unlock>
+	return r;
+}
+  801efe:	89 f0                	mov    %esi,%eax
+  801f00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f03:	5b                   	pop    %ebx
+  801f04:	5e                   	pop    %esi
+  801f05:	5d                   	pop    %ebp
+  801f06:	c3                   	ret
+
+00801f07 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801f07:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801f0b:	7f 01                	jg     801f0e <writebuf+0x7>
+  801f0d:	c3                   	ret
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	53                   	push   %ebx
+  801f12:	83 ec 08             	sub    $0x8,%esp
+  801f15:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801f17:	ff 70 04             	push   0x4(%eax)
+  801f1a:	8d 40 10             	lea    0x10(%eax),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	ff 33                	push   (%ebx)
+  801f20:	e8 4f f6 ff ff       	call   801574 <write>
+		if (result > 0)
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	7e 03                	jle    801f2f <writebuf+0x28>
+			b->result += result;
+  801f2c:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801f2f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801f32:	74 0d                	je     801f41 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3b:	0f 4f c2             	cmovg  %edx,%eax
+  801f3e:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801f41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+00801f46 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	53                   	push   %ebx
+  801f4a:	83 ec 04             	sub    $0x4,%esp
+  801f4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801f50:	8b 53 04             	mov    0x4(%ebx),%edx
+  801f53:	8d 42 01             	lea    0x1(%edx),%eax
+  801f56:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f5c:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801f60:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801f65:	74 05                	je     801f6c <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801f67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6a:	c9                   	leave
+  801f6b:	c3                   	ret
+		writebuf(b);
+  801f6c:	89 d8                	mov    %ebx,%eax
+  801f6e:	e8 94 ff ff ff       	call   801f07 <writebuf>
+		b->idx = 0;
+  801f73:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801f7a:	eb eb                	jmp    801f67 <putch+0x21>
+
+00801f7c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801f7c:	55                   	push   %ebp
+  801f7d:	89 e5                	mov    %esp,%ebp
+  801f7f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801f8e:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801f95:	00 00 00 
+	b.result = 0;
+  801f98:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801f9f:	00 00 00 
+	b.error = 1;
+  801fa2:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801fa9:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801fac:	ff 75 10             	push   0x10(%ebp)
+  801faf:	ff 75 0c             	push   0xc(%ebp)
+  801fb2:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801fb8:	50                   	push   %eax
+  801fb9:	68 46 1f 80 00       	push   $0x801f46
+  801fbe:	e8 df e3 ff ff       	call   8003a2 <vprintfmt>
+	if (b.idx > 0)
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801fcd:	7f 12                	jg     801fe1 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801fcf:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	75 06                	jne    801fdf <vfprintf+0x63>
+  801fd9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801fdf:	c9                   	leave
+  801fe0:	c3                   	ret
+		writebuf(&b);
+  801fe1:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801fe7:	e8 1b ff ff ff       	call   801f07 <writebuf>
+  801fec:	eb e1                	jmp    801fcf <vfprintf+0x53>
+
+00801fee <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801ff4:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801ff7:	50                   	push   %eax
+  801ff8:	ff 75 0c             	push   0xc(%ebp)
+  801ffb:	ff 75 08             	push   0x8(%ebp)
+  801ffe:	e8 79 ff ff ff       	call   801f7c <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+
+00802005 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80200b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  80200e:	50                   	push   %eax
+  80200f:	ff 75 08             	push   0x8(%ebp)
+  802012:	6a 01                	push   $0x1
+  802014:	e8 63 ff ff ff       	call   801f7c <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+
+0080201b <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	56                   	push   %esi
+  80201f:	53                   	push   %ebx
+  802020:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802022:	0f b6 10             	movzbl (%eax),%edx
+  802025:	80 fa 72             	cmp    $0x72,%dl
+  802028:	74 44                	je     80206e <parse_mode+0x53>
+  80202a:	80 fa 77             	cmp    $0x77,%dl
+  80202d:	74 4b                	je     80207a <parse_mode+0x5f>
+  80202f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802034:	80 fa 61             	cmp    $0x61,%dl
+  802037:	74 09                	je     802042 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802039:	89 d8                	mov    %ebx,%eax
+  80203b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203e:	5b                   	pop    %ebx
+  80203f:	5e                   	pop    %esi
+  802040:	5d                   	pop    %ebp
+  802041:	c3                   	ret
+	switch (mode[0]) {
+  802042:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802047:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80204c:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80204e:	83 ec 08             	sub    $0x8,%esp
+  802051:	6a 2b                	push   $0x2b
+  802053:	50                   	push   %eax
+  802054:	e8 48 e9 ff ff       	call   8009a1 <strchr>
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	74 d9                	je     802039 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802060:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802063:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802066:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80206c:	eb cb                	jmp    802039 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80206e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802073:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802078:	eb d2                	jmp    80204c <parse_mode+0x31>
+  80207a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80207f:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802084:	eb c6                	jmp    80204c <parse_mode+0x31>
+
+00802086 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	57                   	push   %edi
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 1c             	sub    $0x1c,%esp
+  80208f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802092:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802095:	b8 24 60 80 00       	mov    $0x806024,%eax
+  80209a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80209f:	83 c0 24             	add    $0x24,%eax
+  8020a2:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8020a6:	74 17                	je     8020bf <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8020a8:	83 c3 01             	add    $0x1,%ebx
+  8020ab:	83 fb 10             	cmp    $0x10,%ebx
+  8020ae:	75 ef                	jne    80209f <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8020b0:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8020b5:	89 f0                	mov    %esi,%eax
+  8020b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ba:	5b                   	pop    %ebx
+  8020bb:	5e                   	pop    %esi
+  8020bc:	5f                   	pop    %edi
+  8020bd:	5d                   	pop    %ebp
+  8020be:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8020bf:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8020c6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8020c9:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8020cc:	c1 e7 02             	shl    $0x2,%edi
+  8020cf:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8020d5:	83 ec 04             	sub    $0x4,%esp
+  8020d8:	6a 24                	push   $0x24
+  8020da:	6a 00                	push   $0x0
+  8020dc:	56                   	push   %esi
+  8020dd:	e8 fe e8 ff ff       	call   8009e0 <memset>
+			streams[i].f_fd = fd;
+  8020e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8020e5:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8020eb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8020ee:	01 d8                	add    %ebx,%eax
+  8020f0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020f3:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	eb b6                	jmp    8020b5 <stream_alloc+0x2f>
+
+008020ff <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8020ff:	55                   	push   %ebp
+  802100:	89 e5                	mov    %esp,%ebp
+  802102:	53                   	push   %ebx
+  802103:	83 ec 14             	sub    $0x14,%esp
+  802106:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802108:	8b 40 18             	mov    0x18(%eax),%eax
+  80210b:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80210e:	74 4a                	je     80215a <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802110:	83 ec 08             	sub    $0x8,%esp
+  802113:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802116:	50                   	push   %eax
+  802117:	ff 33                	push   (%ebx)
+  802119:	e8 ce f0 ff ff       	call   8011ec <fd_lookup>
+  80211e:	89 c2                	mov    %eax,%edx
+  802120:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802123:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802128:	85 d2                	test   %edx,%edx
+  80212a:	78 41                	js     80216d <stream_unread+0x6e>
+  80212c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80212f:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802135:	39 0a                	cmp    %ecx,(%edx)
+  802137:	75 34                	jne    80216d <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802139:	8b 43 14             	mov    0x14(%ebx),%eax
+  80213c:	03 42 04             	add    0x4(%edx),%eax
+  80213f:	2b 43 18             	sub    0x18(%ebx),%eax
+  802142:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802145:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80214c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802153:	b8 01 00 00 00       	mov    $0x1,%eax
+  802158:	eb 13                	jmp    80216d <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80215a:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802161:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802168:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80216d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+00802172 <stream_drain>:
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	56                   	push   %esi
+  802176:	53                   	push   %ebx
+  802177:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802179:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217e:	eb 02                	jmp    802182 <stream_drain+0x10>
+  802180:	01 c3                	add    %eax,%ebx
+  802182:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802185:	39 c3                	cmp    %eax,%ebx
+  802187:	73 43                	jae    8021cc <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802189:	83 ec 04             	sub    $0x4,%esp
+  80218c:	29 d8                	sub    %ebx,%eax
+  80218e:	50                   	push   %eax
+  80218f:	89 d8                	mov    %ebx,%eax
+  802191:	03 46 0c             	add    0xc(%esi),%eax
+  802194:	50                   	push   %eax
+  802195:	ff 36                	push   (%esi)
+  802197:	e8 d8 f3 ff ff       	call   801574 <write>
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	7f dd                	jg     802180 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8021a3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8021a7:	8b 56 0c             	mov    0xc(%esi),%edx
+  8021aa:	83 ec 04             	sub    $0x4,%esp
+  8021ad:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8021b0:	29 d8                	sub    %ebx,%eax
+  8021b2:	50                   	push   %eax
+  8021b3:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8021b6:	50                   	push   %eax
+  8021b7:	52                   	push   %edx
+  8021b8:	e8 58 e8 ff ff       	call   800a15 <memmove>
+			f->f_wend -= done;
+  8021bd:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8021c0:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8021ca:	eb 0a                	jmp    8021d6 <stream_drain+0x64>
+  8021cc:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8021d1:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8021d6:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8021d9:	89 d0                	mov    %edx,%eax
+  8021db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021de:	5b                   	pop    %ebx
+  8021df:	5e                   	pop    %esi
+  8021e0:	5d                   	pop    %ebp
+  8021e1:	c3                   	ret
+
+008021e2 <stream_setup>:
+	if (f->f_buf)
+  8021e2:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021e6:	74 01                	je     8021e9 <stream_setup+0x7>
+  8021e8:	c3                   	ret
+{
+  8021e9:	55                   	push   %ebp
+  8021ea:	89 e5                	mov    %esp,%ebp
+  8021ec:	53                   	push   %ebx
+  8021ed:	83 ec 04             	sub    $0x4,%esp
+  8021f0:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8021f2:	8b 40 08             	mov    0x8(%eax),%eax
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	74 17                	je     802210 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8021f9:	83 f8 03             	cmp    $0x3,%eax
+  8021fc:	75 2d                	jne    80222b <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8021fe:	8d 43 20             	lea    0x20(%ebx),%eax
+  802201:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802204:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80220b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220e:	c9                   	leave
+  80220f:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802210:	83 ec 0c             	sub    $0xc,%esp
+  802213:	ff 33                	push   (%ebx)
+  802215:	e8 29 1b 00 00       	call   803d43 <iscons>
+  80221a:	83 c4 10             	add    $0x10,%esp
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	0f 9f c0             	setg   %al
+  802222:	0f b6 c0             	movzbl %al,%eax
+  802225:	83 c0 01             	add    $0x1,%eax
+  802228:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80222b:	83 ec 0c             	sub    $0xc,%esp
+  80222e:	68 00 10 00 00       	push   $0x1000
+  802233:	e8 6e 0b 00 00       	call   802da6 <malloc>
+  802238:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80223b:	83 c4 10             	add    $0x10,%esp
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	74 bc                	je     8021fe <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802242:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802249:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80224d:	eb bc                	jmp    80220b <stream_setup+0x29>
+
+0080224f <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	53                   	push   %ebx
+  802253:	83 ec 04             	sub    $0x4,%esp
+  802256:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802258:	e8 85 ff ff ff       	call   8021e2 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80225d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802262:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802266:	74 3d                	je     8022a5 <stream_fill+0x56>
+  802268:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80226c:	74 10                	je     80227e <stream_fill+0x2f>
+  80226e:	89 d8                	mov    %ebx,%eax
+  802270:	e8 fd fe ff ff       	call   802172 <stream_drain>
+		return 0;
+  802275:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 27                	js     8022a5 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80227e:	83 ec 04             	sub    $0x4,%esp
+  802281:	ff 73 10             	push   0x10(%ebx)
+  802284:	ff 73 0c             	push   0xc(%ebx)
+  802287:	ff 33                	push   (%ebx)
+  802289:	e8 ee f1 ff ff       	call   80147c <read>
+  80228e:	83 c4 10             	add    $0x10,%esp
+  802291:	85 c0                	test   %eax,%eax
+  802293:	7e 17                	jle    8022ac <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802295:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802299:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8022a0:	89 c2                	mov    %eax,%edx
+  8022a2:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8022a5:	89 d0                	mov    %edx,%eax
+  8022a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8022ac:	c1 f8 1f             	sar    $0x1f,%eax
+  8022af:	83 e0 04             	and    $0x4,%eax
+  8022b2:	83 c0 04             	add    $0x4,%eax
+  8022b5:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8022b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022bd:	eb e6                	jmp    8022a5 <stream_fill+0x56>
+
+008022bf <fopen>:
+{
+  8022bf:	55                   	push   %ebp
+  8022c0:	89 e5                	mov    %esp,%ebp
+  8022c2:	57                   	push   %edi
+  8022c3:	56                   	push   %esi
+  8022c4:	53                   	push   %ebx
+  8022c5:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8022cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8022ce:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8022d4:	89 f0                	mov    %esi,%eax
+  8022d6:	e8 40 fd ff ff       	call   80201b <parse_mode>
+		return 0;
+  8022db:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8022e0:	85 c0                	test   %eax,%eax
+  8022e2:	78 2d                	js     802311 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8022e4:	83 ec 08             	sub    $0x8,%esp
+  8022e7:	50                   	push   %eax
+  8022e8:	ff 75 08             	push   0x8(%ebp)
+  8022eb:	e8 d4 f7 ff ff       	call   801ac4 <open>
+  8022f0:	89 c7                	mov    %eax,%edi
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	78 58                	js     802351 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8022f9:	80 3e 61             	cmpb   $0x61,(%esi)
+  8022fc:	74 1d                	je     80231b <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8022fe:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802304:	89 f8                	mov    %edi,%eax
+  802306:	e8 7b fd ff ff       	call   802086 <stream_alloc>
+  80230b:	89 c3                	mov    %eax,%ebx
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	74 32                	je     802343 <fopen+0x84>
+}
+  802311:	89 d8                	mov    %ebx,%eax
+  802313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5f                   	pop    %edi
+  802319:	5d                   	pop    %ebp
+  80231a:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80231b:	83 ec 08             	sub    $0x8,%esp
+  80231e:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802324:	50                   	push   %eax
+  802325:	57                   	push   %edi
+  802326:	e8 c7 f3 ff ff       	call   8016f2 <fstat>
+  80232b:	83 c4 10             	add    $0x10,%esp
+  80232e:	85 c0                	test   %eax,%eax
+  802330:	78 cc                	js     8022fe <fopen+0x3f>
+		seek(fd, st.st_size);
+  802332:	83 ec 08             	sub    $0x8,%esp
+  802335:	ff 75 dc             	push   -0x24(%ebp)
+  802338:	57                   	push   %edi
+  802339:	e8 e2 f2 ff ff       	call   801620 <seek>
+  80233e:	83 c4 10             	add    $0x10,%esp
+  802341:	eb bb                	jmp    8022fe <fopen+0x3f>
+		close(fd);
+  802343:	83 ec 0c             	sub    $0xc,%esp
+  802346:	57                   	push   %edi
+  802347:	e8 f4 ef ff ff       	call   801340 <close>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	eb c0                	jmp    802311 <fopen+0x52>
+		return 0;
+  802351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802356:	eb b9                	jmp    802311 <fopen+0x52>
+
+00802358 <fdopen>:
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80235e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802361:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802364:	e8 b2 fc ff ff       	call   80201b <parse_mode>
+  802369:	89 c2                	mov    %eax,%edx
+		return 0;
+  80236b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802370:	85 d2                	test   %edx,%edx
+  802372:	78 0b                	js     80237f <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802374:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802377:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237a:	e8 07 fd ff ff       	call   802086 <stream_alloc>
+}
+  80237f:	c9                   	leave
+  802380:	c3                   	ret
+
+00802381 <setvbuf>:
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	57                   	push   %edi
+  802385:	56                   	push   %esi
+  802386:	53                   	push   %ebx
+  802387:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80238d:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802390:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802394:	75 3a                	jne    8023d0 <setvbuf+0x4f>
+  802396:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802399:	83 fe 02             	cmp    $0x2,%esi
+  80239c:	77 39                	ja     8023d7 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80239e:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8023a1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8023a5:	0f 95 c3             	setne  %bl
+  8023a8:	85 ff                	test   %edi,%edi
+  8023aa:	0f 95 c1             	setne  %cl
+  8023ad:	84 cb                	test   %cl,%bl
+  8023af:	74 05                	je     8023b6 <setvbuf+0x35>
+  8023b1:	83 fa 03             	cmp    $0x3,%edx
+  8023b4:	75 0a                	jne    8023c0 <setvbuf+0x3f>
+	return 0;
+  8023b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bb:	5b                   	pop    %ebx
+  8023bc:	5e                   	pop    %esi
+  8023bd:	5f                   	pop    %edi
+  8023be:	5d                   	pop    %ebp
+  8023bf:	c3                   	ret
+		f->f_buf = buf;
+  8023c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023c3:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8023c6:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8023c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ce:	eb eb                	jmp    8023bb <setvbuf+0x3a>
+		return EOF;
+  8023d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023d5:	eb e4                	jmp    8023bb <setvbuf+0x3a>
+  8023d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023dc:	eb dd                	jmp    8023bb <setvbuf+0x3a>
+
+008023de <fflush>:
+{
+  8023de:	55                   	push   %ebp
+  8023df:	89 e5                	mov    %esp,%ebp
+  8023e1:	57                   	push   %edi
+  8023e2:	56                   	push   %esi
+  8023e3:	53                   	push   %ebx
+  8023e4:	83 ec 0c             	sub    $0xc,%esp
+  8023e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8023ea:	85 db                	test   %ebx,%ebx
+  8023ec:	74 1a                	je     802408 <fflush+0x2a>
+	stream_unread(f);
+  8023ee:	89 d8                	mov    %ebx,%eax
+  8023f0:	e8 0a fd ff ff       	call   8020ff <stream_unread>
+	return stream_drain(f);
+  8023f5:	89 d8                	mov    %ebx,%eax
+  8023f7:	e8 76 fd ff ff       	call   802172 <stream_drain>
+  8023fc:	89 c7                	mov    %eax,%edi
+}
+  8023fe:	89 f8                	mov    %edi,%eax
+  802400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5f                   	pop    %edi
+  802406:	5d                   	pop    %ebp
+  802407:	c3                   	ret
+  802408:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  80240d:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802412:	bf 00 00 00 00       	mov    $0x0,%edi
+  802417:	eb 03                	jmp    80241c <fflush+0x3e>
+  802419:	83 c3 24             	add    $0x24,%ebx
+  80241c:	39 f3                	cmp    %esi,%ebx
+  80241e:	74 de                	je     8023fe <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802420:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802424:	74 f3                	je     802419 <fflush+0x3b>
+  802426:	83 ec 0c             	sub    $0xc,%esp
+  802429:	53                   	push   %ebx
+  80242a:	e8 af ff ff ff       	call   8023de <fflush>
+  80242f:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802432:	85 c0                	test   %eax,%eax
+  802434:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802439:	0f 48 f8             	cmovs  %eax,%edi
+  80243c:	eb db                	jmp    802419 <fflush+0x3b>
+
+0080243e <fclose>:
+{
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	56                   	push   %esi
+  802442:	53                   	push   %ebx
+  802443:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802446:	83 ec 0c             	sub    $0xc,%esp
+  802449:	56                   	push   %esi
+  80244a:	e8 8f ff ff ff       	call   8023de <fflush>
+  80244f:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802451:	83 c4 04             	add    $0x4,%esp
+  802454:	ff 36                	push   (%esi)
+  802456:	e8 e5 ee ff ff       	call   801340 <close>
+  80245b:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802465:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802468:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80246c:	75 10                	jne    80247e <fclose+0x40>
+	f->f_flags = 0;
+  80246e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802475:	89 d8                	mov    %ebx,%eax
+  802477:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80247a:	5b                   	pop    %ebx
+  80247b:	5e                   	pop    %esi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+		free(f->f_buf);
+  80247e:	83 ec 0c             	sub    $0xc,%esp
+  802481:	ff 76 0c             	push   0xc(%esi)
+  802484:	e8 54 08 00 00       	call   802cdd <free>
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	eb e0                	jmp    80246e <fclose+0x30>
+
+0080248e <fileno>:
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802491:	8b 45 08             	mov    0x8(%ebp),%eax
+  802494:	8b 00                	mov    (%eax),%eax
+}
+  802496:	5d                   	pop    %ebp
+  802497:	c3                   	ret
+
+00802498 <feof>:
+{
+  802498:	55                   	push   %ebp
+  802499:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80249b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249e:	8b 40 04             	mov    0x4(%eax),%eax
+  8024a1:	c1 e8 02             	shr    $0x2,%eax
+  8024a4:	83 e0 01             	and    $0x1,%eax
+}
+  8024a7:	5d                   	pop    %ebp
+  8024a8:	c3                   	ret
+
+008024a9 <ferror>:
+{
+  8024a9:	55                   	push   %ebp
+  8024aa:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8024ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024af:	8b 40 04             	mov    0x4(%eax),%eax
+  8024b2:	c1 e8 03             	shr    $0x3,%eax
+  8024b5:	83 e0 01             	and    $0x1,%eax
+}
+  8024b8:	5d                   	pop    %ebp
+  8024b9:	c3                   	ret
+
+008024ba <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8024ba:	55                   	push   %ebp
+  8024bb:	89 e5                	mov    %esp,%ebp
+  8024bd:	53                   	push   %ebx
+  8024be:	83 ec 04             	sub    $0x4,%esp
+  8024c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8024c4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8024c7:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8024ca:	74 15                	je     8024e1 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8024cc:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8024cf:	8b 43 14             	mov    0x14(%ebx),%eax
+  8024d2:	8d 48 01             	lea    0x1(%eax),%ecx
+  8024d5:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8024d8:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8024dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024df:	c9                   	leave
+  8024e0:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8024e1:	89 d8                	mov    %ebx,%eax
+  8024e3:	e8 67 fd ff ff       	call   80224f <stream_fill>
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	75 e0                	jne    8024cc <fgetc+0x12>
+		return EOF;
+  8024ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024f1:	eb e9                	jmp    8024dc <fgetc+0x22>
+
+008024f3 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	57                   	push   %edi
+  8024f7:	56                   	push   %esi
+  8024f8:	53                   	push   %ebx
+  8024f9:	83 ec 1c             	sub    $0x1c,%esp
+  8024fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8024ff:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802504:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802507:	83 e8 01             	sub    $0x1,%eax
+  80250a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80250d:	eb 66                	jmp    802575 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80250f:	8b 46 14             	mov    0x14(%esi),%eax
+  802512:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802515:	29 c3                	sub    %eax,%ebx
+  802517:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80251a:	29 fa                	sub    %edi,%edx
+  80251c:	39 d3                	cmp    %edx,%ebx
+  80251e:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	53                   	push   %ebx
+  802525:	6a 0a                	push   $0xa
+  802527:	03 46 0c             	add    0xc(%esi),%eax
+  80252a:	50                   	push   %eax
+  80252b:	e8 96 e5 ff ff       	call   800ac6 <memfind>
+  802530:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802533:	8b 46 0c             	mov    0xc(%esi),%eax
+  802536:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802539:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80253c:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802544:	74 0b                	je     802551 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802546:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802549:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80254c:	29 d3                	sub    %edx,%ebx
+  80254e:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802551:	83 ec 04             	sub    $0x4,%esp
+  802554:	53                   	push   %ebx
+  802555:	01 c8                	add    %ecx,%eax
+  802557:	50                   	push   %eax
+  802558:	89 f8                	mov    %edi,%eax
+  80255a:	03 45 08             	add    0x8(%ebp),%eax
+  80255d:	50                   	push   %eax
+  80255e:	e8 b2 e4 ff ff       	call   800a15 <memmove>
+		f->f_rpos += m;
+  802563:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802566:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80256e:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802573:	74 1f                	je     802594 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802575:	8d 47 01             	lea    0x1(%edi),%eax
+  802578:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80257b:	73 17                	jae    802594 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80257d:	8b 46 18             	mov    0x18(%esi),%eax
+  802580:	39 46 14             	cmp    %eax,0x14(%esi)
+  802583:	75 8a                	jne    80250f <fgets+0x1c>
+  802585:	89 f0                	mov    %esi,%eax
+  802587:	e8 c3 fc ff ff       	call   80224f <stream_fill>
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	0f 85 7b ff ff ff    	jne    80250f <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802594:	85 ff                	test   %edi,%edi
+  802596:	74 0f                	je     8025a7 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802598:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259b:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80259f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025a2:	5b                   	pop    %ebx
+  8025a3:	5e                   	pop    %esi
+  8025a4:	5f                   	pop    %edi
+  8025a5:	5d                   	pop    %ebp
+  8025a6:	c3                   	ret
+		return 0;
+  8025a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ac:	eb f1                	jmp    80259f <fgets+0xac>
+
+008025ae <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8025ae:	55                   	push   %ebp
+  8025af:	89 e5                	mov    %esp,%ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 1c             	sub    $0x1c,%esp
+  8025b7:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8025ba:	89 f0                	mov    %esi,%eax
+  8025bc:	e8 21 fc ff ff       	call   8021e2 <stream_setup>
+	want = size * n;
+  8025c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025c4:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8025c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8025cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d0:	eb 43                	jmp    802615 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8025d2:	29 d3                	sub    %edx,%ebx
+  8025d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025d7:	29 f8                	sub    %edi,%eax
+  8025d9:	39 c3                	cmp    %eax,%ebx
+  8025db:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8025de:	83 ec 04             	sub    $0x4,%esp
+  8025e1:	53                   	push   %ebx
+  8025e2:	03 56 0c             	add    0xc(%esi),%edx
+  8025e5:	52                   	push   %edx
+  8025e6:	89 f8                	mov    %edi,%eax
+  8025e8:	03 45 08             	add    0x8(%ebp),%eax
+  8025eb:	50                   	push   %eax
+  8025ec:	e8 24 e4 ff ff       	call   800a15 <memmove>
+			f->f_rpos += m;
+  8025f1:	01 5e 14             	add    %ebx,0x14(%esi)
+  8025f4:	83 c4 10             	add    $0x10,%esp
+  8025f7:	eb 1a                	jmp    802613 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8025f9:	83 ec 04             	sub    $0x4,%esp
+  8025fc:	53                   	push   %ebx
+  8025fd:	89 f8                	mov    %edi,%eax
+  8025ff:	03 45 08             	add    0x8(%ebp),%eax
+  802602:	50                   	push   %eax
+  802603:	ff 36                	push   (%esi)
+  802605:	e8 72 ee ff ff       	call   80147c <read>
+  80260a:	89 c3                	mov    %eax,%ebx
+  80260c:	83 c4 10             	add    $0x10,%esp
+  80260f:	85 c0                	test   %eax,%eax
+  802611:	7e 36                	jle    802649 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802613:	01 df                	add    %ebx,%edi
+  802615:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802618:	39 c7                	cmp    %eax,%edi
+  80261a:	73 39                	jae    802655 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80261c:	8b 56 14             	mov    0x14(%esi),%edx
+  80261f:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802622:	39 da                	cmp    %ebx,%edx
+  802624:	72 ac                	jb     8025d2 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802626:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802629:	29 fb                	sub    %edi,%ebx
+  80262b:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80262e:	72 3e                	jb     80266e <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802630:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802634:	74 1f                	je     802655 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802636:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80263a:	74 bd                	je     8025f9 <fread+0x4b>
+  80263c:	89 f0                	mov    %esi,%eax
+  80263e:	e8 2f fb ff ff       	call   802172 <stream_drain>
+  802643:	85 c0                	test   %eax,%eax
+  802645:	79 b2                	jns    8025f9 <fread+0x4b>
+  802647:	eb 0c                	jmp    802655 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802649:	c1 fb 1f             	sar    $0x1f,%ebx
+  80264c:	83 e3 04             	and    $0x4,%ebx
+  80264f:	83 c3 04             	add    $0x4,%ebx
+  802652:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802655:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	74 0a                	je     802666 <fread+0xb8>
+  80265c:	89 f8                	mov    %edi,%eax
+  80265e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802663:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802669:	5b                   	pop    %ebx
+  80266a:	5e                   	pop    %esi
+  80266b:	5f                   	pop    %edi
+  80266c:	5d                   	pop    %ebp
+  80266d:	c3                   	ret
+		} else if (!stream_fill(f))
+  80266e:	89 f0                	mov    %esi,%eax
+  802670:	e8 da fb ff ff       	call   80224f <stream_fill>
+  802675:	85 c0                	test   %eax,%eax
+  802677:	74 dc                	je     802655 <fread+0xa7>
+			m = 0;
+  802679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80267e:	eb 93                	jmp    802613 <fread+0x65>
+
+00802680 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	57                   	push   %edi
+  802684:	56                   	push   %esi
+  802685:	53                   	push   %ebx
+  802686:	83 ec 1c             	sub    $0x1c,%esp
+  802689:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  80268c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80268f:	a8 02                	test   $0x2,%al
+  802691:	75 13                	jne    8026a6 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802693:	83 c8 08             	or     $0x8,%eax
+  802696:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802699:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80269e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a1:	5b                   	pop    %ebx
+  8026a2:	5e                   	pop    %esi
+  8026a3:	5f                   	pop    %edi
+  8026a4:	5d                   	pop    %ebp
+  8026a5:	c3                   	ret
+	stream_setup(f);
+  8026a6:	89 d8                	mov    %ebx,%eax
+  8026a8:	e8 35 fb ff ff       	call   8021e2 <stream_setup>
+	want = size * n;
+  8026ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b0:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8026b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8026b7:	89 d8                	mov    %ebx,%eax
+  8026b9:	e8 41 fa ff ff       	call   8020ff <stream_unread>
+	for (done = 0; done < want; ) {
+  8026be:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8026c3:	84 c0                	test   %al,%al
+  8026c5:	75 7b                	jne    802742 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8026c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8026cf:	39 fe                	cmp    %edi,%esi
+  8026d1:	73 24                	jae    8026f7 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8026d3:	83 ec 04             	sub    $0x4,%esp
+  8026d6:	89 f8                	mov    %edi,%eax
+  8026d8:	29 f0                	sub    %esi,%eax
+  8026da:	50                   	push   %eax
+  8026db:	89 f0                	mov    %esi,%eax
+  8026dd:	03 45 08             	add    0x8(%ebp),%eax
+  8026e0:	50                   	push   %eax
+  8026e1:	ff 33                	push   (%ebx)
+  8026e3:	e8 8c ee ff ff       	call   801574 <write>
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	7e 04                	jle    8026f3 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8026ef:	01 c6                	add    %eax,%esi
+  8026f1:	eb dc                	jmp    8026cf <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8026f3:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8026f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	74 a0                	je     80269e <fwrite+0x1e>
+  8026fe:	89 f0                	mov    %esi,%eax
+  802700:	ba 00 00 00 00       	mov    $0x0,%edx
+  802705:	f7 75 0c             	divl   0xc(%ebp)
+  802708:	eb 94                	jmp    80269e <fwrite+0x1e>
+			done += r;
+  80270a:	01 c7                	add    %eax,%edi
+			continue;
+  80270c:	eb 34                	jmp    802742 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80270e:	8b 73 10             	mov    0x10(%ebx),%esi
+  802711:	29 c6                	sub    %eax,%esi
+  802713:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802716:	29 fa                	sub    %edi,%edx
+  802718:	39 d6                	cmp    %edx,%esi
+  80271a:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80271d:	83 ec 04             	sub    $0x4,%esp
+  802720:	56                   	push   %esi
+  802721:	89 fa                	mov    %edi,%edx
+  802723:	03 55 08             	add    0x8(%ebp),%edx
+  802726:	52                   	push   %edx
+  802727:	03 43 0c             	add    0xc(%ebx),%eax
+  80272a:	50                   	push   %eax
+  80272b:	e8 e5 e2 ff ff       	call   800a15 <memmove>
+		f->f_wend += m;
+  802730:	89 f0                	mov    %esi,%eax
+  802732:	03 43 1c             	add    0x1c(%ebx),%eax
+  802735:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802738:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80273a:	83 c4 10             	add    $0x10,%esp
+  80273d:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802740:	74 5b                	je     80279d <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802742:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802745:	39 c7                	cmp    %eax,%edi
+  802747:	73 2d                	jae    802776 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802749:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	75 be                	jne    80270e <fwrite+0x8e>
+  802750:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802753:	29 fa                	sub    %edi,%edx
+  802755:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802758:	72 b4                	jb     80270e <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80275a:	83 ec 04             	sub    $0x4,%esp
+  80275d:	52                   	push   %edx
+  80275e:	89 f8                	mov    %edi,%eax
+  802760:	03 45 08             	add    0x8(%ebp),%eax
+  802763:	50                   	push   %eax
+  802764:	ff 33                	push   (%ebx)
+  802766:	e8 09 ee ff ff       	call   801574 <write>
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	7f 98                	jg     80270a <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802772:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802776:	8b 43 08             	mov    0x8(%ebx),%eax
+  802779:	83 f8 03             	cmp    $0x3,%eax
+  80277c:	74 48                	je     8027c6 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80277e:	83 f8 02             	cmp    $0x2,%eax
+  802781:	74 27                	je     8027aa <fwrite+0x12a>
+	return size ? done / size : 0;
+  802783:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802786:	85 c0                	test   %eax,%eax
+  802788:	0f 84 10 ff ff ff    	je     80269e <fwrite+0x1e>
+  80278e:	89 f8                	mov    %edi,%eax
+  802790:	ba 00 00 00 00       	mov    $0x0,%edx
+  802795:	f7 75 0c             	divl   0xc(%ebp)
+  802798:	e9 01 ff ff ff       	jmp    80269e <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80279d:	89 d8                	mov    %ebx,%eax
+  80279f:	e8 ce f9 ff ff       	call   802172 <stream_drain>
+  8027a4:	85 c0                	test   %eax,%eax
+  8027a6:	79 9a                	jns    802742 <fwrite+0xc2>
+  8027a8:	eb cc                	jmp    802776 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8027aa:	83 ec 04             	sub    $0x4,%esp
+  8027ad:	57                   	push   %edi
+  8027ae:	6a 0a                	push   $0xa
+  8027b0:	ff 75 08             	push   0x8(%ebp)
+  8027b3:	e8 0e e3 ff ff       	call   800ac6 <memfind>
+  8027b8:	89 c2                	mov    %eax,%edx
+  8027ba:	89 f8                	mov    %edi,%eax
+  8027bc:	03 45 08             	add    0x8(%ebp),%eax
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	39 c2                	cmp    %eax,%edx
+  8027c4:	74 bd                	je     802783 <fwrite+0x103>
+		stream_drain(f);
+  8027c6:	89 d8                	mov    %ebx,%eax
+  8027c8:	e8 a5 f9 ff ff       	call   802172 <stream_drain>
+  8027cd:	eb b4                	jmp    802783 <fwrite+0x103>
+
+008027cf <fputc>:
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	53                   	push   %ebx
+  8027d3:	83 ec 14             	sub    $0x14,%esp
+  8027d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8027d9:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8027dc:	ff 75 0c             	push   0xc(%ebp)
+  8027df:	6a 01                	push   $0x1
+  8027e1:	6a 01                	push   $0x1
+  8027e3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8027e6:	50                   	push   %eax
+  8027e7:	e8 94 fe ff ff       	call   802680 <fwrite>
+  8027ec:	83 c4 10             	add    $0x10,%esp
+  8027ef:	0f b6 db             	movzbl %bl,%ebx
+  8027f2:	83 f8 01             	cmp    $0x1,%eax
+  8027f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027fa:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8027fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+00802802 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802808:	ff 75 0c             	push   0xc(%ebp)
+  80280b:	ff 75 08             	push   0x8(%ebp)
+  80280e:	e8 bc ff ff ff       	call   8027cf <fputc>
+}
+  802813:	83 c4 10             	add    $0x10,%esp
+  802816:	c9                   	leave
+  802817:	c3                   	ret
+
+00802818 <fputs>:
+{
+  802818:	55                   	push   %ebp
+  802819:	89 e5                	mov    %esp,%ebp
+  80281b:	56                   	push   %esi
+  80281c:	53                   	push   %ebx
+  80281d:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802820:	83 ec 0c             	sub    $0xc,%esp
+  802823:	56                   	push   %esi
+  802824:	e8 2b e0 ff ff       	call   800854 <strlen>
+  802829:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80282b:	ff 75 0c             	push   0xc(%ebp)
+  80282e:	50                   	push   %eax
+  80282f:	6a 01                	push   $0x1
+  802831:	56                   	push   %esi
+  802832:	e8 49 fe ff ff       	call   802680 <fwrite>
+  802837:	83 c4 20             	add    $0x20,%esp
+  80283a:	39 d8                	cmp    %ebx,%eax
+  80283c:	0f 95 c0             	setne  %al
+  80283f:	0f b6 c0             	movzbl %al,%eax
+  802842:	f7 d8                	neg    %eax
+}
+  802844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802847:	5b                   	pop    %ebx
+  802848:	5e                   	pop    %esi
+  802849:	5d                   	pop    %ebp
+  80284a:	c3                   	ret
+
+0080284b <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80284b:	55                   	push   %ebp
+  80284c:	89 e5                	mov    %esp,%ebp
+  80284e:	53                   	push   %ebx
+  80284f:	83 ec 04             	sub    $0x4,%esp
+  802852:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802855:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802858:	50                   	push   %eax
+  802859:	ff 75 0c             	push   0xc(%ebp)
+  80285c:	53                   	push   %ebx
+  80285d:	68 02 28 80 00       	push   $0x802802
+  802862:	e8 3b db ff ff       	call   8003a2 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802867:	8b 43 04             	mov    0x4(%ebx),%eax
+  80286a:	c1 e0 1c             	shl    $0x1c,%eax
+  80286d:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+
+00802875 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802875:	55                   	push   %ebp
+  802876:	89 e5                	mov    %esp,%ebp
+  802878:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80287b:	68 d8 4d 80 00       	push   $0x804dd8
+  802880:	ff 75 0c             	push   0xc(%ebp)
+  802883:	e8 07 e0 ff ff       	call   80088f <strcpy>
+	return 0;
+}
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288d:	c9                   	leave
+  80288e:	c3                   	ret
+
+0080288f <devsock_close>:
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	53                   	push   %ebx
+  802893:	83 ec 10             	sub    $0x10,%esp
+  802896:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802899:	53                   	push   %ebx
+  80289a:	e8 23 1d 00 00       	call   8045c2 <pageref>
+  80289f:	89 c2                	mov    %eax,%edx
+  8028a1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8028a9:	83 fa 01             	cmp    $0x1,%edx
+  8028ac:	74 05                	je     8028b3 <devsock_close+0x24>
+}
+  8028ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b1:	c9                   	leave
+  8028b2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8028b3:	83 ec 0c             	sub    $0xc,%esp
+  8028b6:	ff 73 0c             	push   0xc(%ebx)
+  8028b9:	e8 b7 02 00 00       	call   802b75 <nsipc_close>
+  8028be:	83 c4 10             	add    $0x10,%esp
+  8028c1:	eb eb                	jmp    8028ae <devsock_close+0x1f>
+
+008028c3 <devsock_write>:
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028c9:	6a 00                	push   $0x0
+  8028cb:	ff 75 10             	push   0x10(%ebp)
+  8028ce:	ff 75 0c             	push   0xc(%ebp)
+  8028d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d4:	ff 70 0c             	push   0xc(%eax)
+  8028d7:	e8 79 03 00 00       	call   802c55 <nsipc_send>
+}
+  8028dc:	c9                   	leave
+  8028dd:	c3                   	ret
+
+008028de <devsock_read>:
+{
+  8028de:	55                   	push   %ebp
+  8028df:	89 e5                	mov    %esp,%ebp
+  8028e1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8028e4:	6a 00                	push   $0x0
+  8028e6:	ff 75 10             	push   0x10(%ebp)
+  8028e9:	ff 75 0c             	push   0xc(%ebp)
+  8028ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ef:	ff 70 0c             	push   0xc(%eax)
+  8028f2:	e8 ef 02 00 00       	call   802be6 <nsipc_recv>
+}
+  8028f7:	c9                   	leave
+  8028f8:	c3                   	ret
+
+008028f9 <fd2sockid>:
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8028ff:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802902:	52                   	push   %edx
+  802903:	50                   	push   %eax
+  802904:	e8 e3 e8 ff ff       	call   8011ec <fd_lookup>
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	78 10                	js     802920 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802913:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802919:	39 08                	cmp    %ecx,(%eax)
+  80291b:	75 05                	jne    802922 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80291d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802920:	c9                   	leave
+  802921:	c3                   	ret
+		return -E_NOT_SUPP;
+  802922:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802927:	eb f7                	jmp    802920 <fd2sockid+0x27>
+
+00802929 <alloc_sockfd>:
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	56                   	push   %esi
+  80292d:	53                   	push   %ebx
+  80292e:	83 ec 1c             	sub    $0x1c,%esp
+  802931:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802933:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802936:	50                   	push   %eax
+  802937:	e8 5a e8 ff ff       	call   801196 <fd_alloc>
+  80293c:	89 c3                	mov    %eax,%ebx
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	85 c0                	test   %eax,%eax
+  802943:	78 43                	js     802988 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802945:	83 ec 04             	sub    $0x4,%esp
+  802948:	68 07 04 00 00       	push   $0x407
+  80294d:	ff 75 f4             	push   -0xc(%ebp)
+  802950:	6a 00                	push   $0x0
+  802952:	e8 76 e3 ff ff       	call   800ccd <sys_page_alloc>
+  802957:	89 c3                	mov    %eax,%ebx
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	78 28                	js     802988 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802963:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802969:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80296b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802975:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802978:	83 ec 0c             	sub    $0xc,%esp
+  80297b:	50                   	push   %eax
+  80297c:	e8 ee e7 ff ff       	call   80116f <fd2num>
+  802981:	89 c3                	mov    %eax,%ebx
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	eb 0c                	jmp    802994 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802988:	83 ec 0c             	sub    $0xc,%esp
+  80298b:	56                   	push   %esi
+  80298c:	e8 e4 01 00 00       	call   802b75 <nsipc_close>
+		return r;
+  802991:	83 c4 10             	add    $0x10,%esp
+}
+  802994:	89 d8                	mov    %ebx,%eax
+  802996:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802999:	5b                   	pop    %ebx
+  80299a:	5e                   	pop    %esi
+  80299b:	5d                   	pop    %ebp
+  80299c:	c3                   	ret
+
+0080299d <accept>:
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a6:	e8 4e ff ff ff       	call   8028f9 <fd2sockid>
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	78 1b                	js     8029ca <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8029af:	83 ec 04             	sub    $0x4,%esp
+  8029b2:	ff 75 10             	push   0x10(%ebp)
+  8029b5:	ff 75 0c             	push   0xc(%ebp)
+  8029b8:	50                   	push   %eax
+  8029b9:	e8 0e 01 00 00       	call   802acc <nsipc_accept>
+  8029be:	83 c4 10             	add    $0x10,%esp
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	78 05                	js     8029ca <accept+0x2d>
+	return alloc_sockfd(r);
+  8029c5:	e8 5f ff ff ff       	call   802929 <alloc_sockfd>
+}
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+
+008029cc <bind>:
+{
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d5:	e8 1f ff ff ff       	call   8028f9 <fd2sockid>
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 12                	js     8029f0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8029de:	83 ec 04             	sub    $0x4,%esp
+  8029e1:	ff 75 10             	push   0x10(%ebp)
+  8029e4:	ff 75 0c             	push   0xc(%ebp)
+  8029e7:	50                   	push   %eax
+  8029e8:	e8 31 01 00 00       	call   802b1e <nsipc_bind>
+  8029ed:	83 c4 10             	add    $0x10,%esp
+}
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+
+008029f2 <shutdown>:
+{
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fb:	e8 f9 fe ff ff       	call   8028f9 <fd2sockid>
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	78 0f                	js     802a13 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a04:	83 ec 08             	sub    $0x8,%esp
+  802a07:	ff 75 0c             	push   0xc(%ebp)
+  802a0a:	50                   	push   %eax
+  802a0b:	e8 43 01 00 00       	call   802b53 <nsipc_shutdown>
+  802a10:	83 c4 10             	add    $0x10,%esp
+}
+  802a13:	c9                   	leave
+  802a14:	c3                   	ret
+
+00802a15 <connect>:
+{
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1e:	e8 d6 fe ff ff       	call   8028f9 <fd2sockid>
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 12                	js     802a39 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802a27:	83 ec 04             	sub    $0x4,%esp
+  802a2a:	ff 75 10             	push   0x10(%ebp)
+  802a2d:	ff 75 0c             	push   0xc(%ebp)
+  802a30:	50                   	push   %eax
+  802a31:	e8 59 01 00 00       	call   802b8f <nsipc_connect>
+  802a36:	83 c4 10             	add    $0x10,%esp
+}
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+00802a3b <listen>:
+{
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a44:	e8 b0 fe ff ff       	call   8028f9 <fd2sockid>
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	78 0f                	js     802a5c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a4d:	83 ec 08             	sub    $0x8,%esp
+  802a50:	ff 75 0c             	push   0xc(%ebp)
+  802a53:	50                   	push   %eax
+  802a54:	e8 6b 01 00 00       	call   802bc4 <nsipc_listen>
+  802a59:	83 c4 10             	add    $0x10,%esp
+}
+  802a5c:	c9                   	leave
+  802a5d:	c3                   	ret
+
+00802a5e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a64:	ff 75 10             	push   0x10(%ebp)
+  802a67:	ff 75 0c             	push   0xc(%ebp)
+  802a6a:	ff 75 08             	push   0x8(%ebp)
+  802a6d:	e8 41 02 00 00       	call   802cb3 <nsipc_socket>
+  802a72:	83 c4 10             	add    $0x10,%esp
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	78 05                	js     802a7e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a79:	e8 ab fe ff ff       	call   802929 <alloc_sockfd>
+}
+  802a7e:	c9                   	leave
+  802a7f:	c3                   	ret
+
+00802a80 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a80:	55                   	push   %ebp
+  802a81:	89 e5                	mov    %esp,%ebp
+  802a83:	53                   	push   %ebx
+  802a84:	83 ec 04             	sub    $0x4,%esp
+  802a87:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a89:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802a90:	74 26                	je     802ab8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a92:	6a 07                	push   $0x7
+  802a94:	68 00 b0 80 00       	push   $0x80b000
+  802a99:	53                   	push   %ebx
+  802a9a:	ff 35 08 70 80 00    	push   0x807008
+  802aa0:	e8 88 1a 00 00       	call   80452d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802aa5:	83 c4 0c             	add    $0xc,%esp
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	6a 00                	push   $0x0
+  802aac:	6a 00                	push   $0x0
+  802aae:	e8 84 19 00 00       	call   804437 <ipc_recv>
+}
+  802ab3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab6:	c9                   	leave
+  802ab7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ab8:	83 ec 0c             	sub    $0xc,%esp
+  802abb:	6a 02                	push   $0x2
+  802abd:	e8 c1 1a 00 00       	call   804583 <ipc_find_env>
+  802ac2:	a3 08 70 80 00       	mov    %eax,0x807008
+  802ac7:	83 c4 10             	add    $0x10,%esp
+  802aca:	eb c6                	jmp    802a92 <nsipc+0x12>
+
+00802acc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	56                   	push   %esi
+  802ad0:	53                   	push   %ebx
+  802ad1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802adc:	8b 06                	mov    (%esi),%eax
+  802ade:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ae3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ae8:	e8 93 ff ff ff       	call   802a80 <nsipc>
+  802aed:	89 c3                	mov    %eax,%ebx
+  802aef:	85 c0                	test   %eax,%eax
+  802af1:	79 09                	jns    802afc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802af3:	89 d8                	mov    %ebx,%eax
+  802af5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af8:	5b                   	pop    %ebx
+  802af9:	5e                   	pop    %esi
+  802afa:	5d                   	pop    %ebp
+  802afb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802afc:	83 ec 04             	sub    $0x4,%esp
+  802aff:	ff 35 10 b0 80 00    	push   0x80b010
+  802b05:	68 00 b0 80 00       	push   $0x80b000
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	e8 03 df ff ff       	call   800a15 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b12:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  802b17:	89 06                	mov    %eax,(%esi)
+  802b19:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b1c:	eb d5                	jmp    802af3 <nsipc_accept+0x27>
+
+00802b1e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	53                   	push   %ebx
+  802b22:	83 ec 08             	sub    $0x8,%esp
+  802b25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b30:	53                   	push   %ebx
+  802b31:	ff 75 0c             	push   0xc(%ebp)
+  802b34:	68 04 b0 80 00       	push   $0x80b004
+  802b39:	e8 d7 de ff ff       	call   800a15 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b3e:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  802b44:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b49:	e8 32 ff ff ff       	call   802a80 <nsipc>
+}
+  802b4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b51:	c9                   	leave
+  802b52:	c3                   	ret
+
+00802b53 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b53:	55                   	push   %ebp
+  802b54:	89 e5                	mov    %esp,%ebp
+  802b56:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  802b61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b64:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b69:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b6e:	e8 0d ff ff ff       	call   802a80 <nsipc>
+}
+  802b73:	c9                   	leave
+  802b74:	c3                   	ret
+
+00802b75 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b75:	55                   	push   %ebp
+  802b76:	89 e5                	mov    %esp,%ebp
+  802b78:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  802b83:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b88:	e8 f3 fe ff ff       	call   802a80 <nsipc>
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+00802b8f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b8f:	55                   	push   %ebp
+  802b90:	89 e5                	mov    %esp,%ebp
+  802b92:	53                   	push   %ebx
+  802b93:	83 ec 08             	sub    $0x8,%esp
+  802b96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ba1:	53                   	push   %ebx
+  802ba2:	ff 75 0c             	push   0xc(%ebp)
+  802ba5:	68 04 b0 80 00       	push   $0x80b004
+  802baa:	e8 66 de ff ff       	call   800a15 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802baf:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  802bb5:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bba:	e8 c1 fe ff ff       	call   802a80 <nsipc>
+}
+  802bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+
+00802bc4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bd2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bd5:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  802bda:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bdf:	e8 9c fe ff ff       	call   802a80 <nsipc>
+}
+  802be4:	c9                   	leave
+  802be5:	c3                   	ret
+
+00802be6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	56                   	push   %esi
+  802bea:	53                   	push   %ebx
+  802beb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  802bf6:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  802bfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bff:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c04:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c09:	e8 72 fe ff ff       	call   802a80 <nsipc>
+  802c0e:	89 c3                	mov    %eax,%ebx
+  802c10:	85 c0                	test   %eax,%eax
+  802c12:	78 22                	js     802c36 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c14:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c19:	39 c6                	cmp    %eax,%esi
+  802c1b:	0f 4e c6             	cmovle %esi,%eax
+  802c1e:	39 c3                	cmp    %eax,%ebx
+  802c20:	7f 1d                	jg     802c3f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c22:	83 ec 04             	sub    $0x4,%esp
+  802c25:	53                   	push   %ebx
+  802c26:	68 00 b0 80 00       	push   $0x80b000
+  802c2b:	ff 75 0c             	push   0xc(%ebp)
+  802c2e:	e8 e2 dd ff ff       	call   800a15 <memmove>
+  802c33:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c36:	89 d8                	mov    %ebx,%eax
+  802c38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3b:	5b                   	pop    %ebx
+  802c3c:	5e                   	pop    %esi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c3f:	68 e4 4d 80 00       	push   $0x804de4
+  802c44:	68 9d 4d 80 00       	push   $0x804d9d
+  802c49:	6a 62                	push   $0x62
+  802c4b:	68 f9 4d 80 00       	push   $0x804df9
+  802c50:	e8 7b d5 ff ff       	call   8001d0 <_panic>
+
+00802c55 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c55:	55                   	push   %ebp
+  802c56:	89 e5                	mov    %esp,%ebp
+  802c58:	53                   	push   %ebx
+  802c59:	83 ec 04             	sub    $0x4,%esp
+  802c5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c62:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  802c67:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c6d:	7f 2e                	jg     802c9d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c6f:	83 ec 04             	sub    $0x4,%esp
+  802c72:	53                   	push   %ebx
+  802c73:	ff 75 0c             	push   0xc(%ebp)
+  802c76:	68 0c b0 80 00       	push   $0x80b00c
+  802c7b:	e8 95 dd ff ff       	call   800a15 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c80:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  802c86:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c89:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  802c8e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c93:	e8 e8 fd ff ff       	call   802a80 <nsipc>
+}
+  802c98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c9b:	c9                   	leave
+  802c9c:	c3                   	ret
+	assert(size < 1600);
+  802c9d:	68 05 4e 80 00       	push   $0x804e05
+  802ca2:	68 9d 4d 80 00       	push   $0x804d9d
+  802ca7:	6a 6d                	push   $0x6d
+  802ca9:	68 f9 4d 80 00       	push   $0x804df9
+  802cae:	e8 1d d5 ff ff       	call   8001d0 <_panic>
+
+00802cb3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802cb3:	55                   	push   %ebp
+  802cb4:	89 e5                	mov    %esp,%ebp
+  802cb6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cbc:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  802cc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc4:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  802cc9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ccc:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  802cd1:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cd6:	e8 a5 fd ff ff       	call   802a80 <nsipc>
+}
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+
+00802cdd <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802cdd:	55                   	push   %ebp
+  802cde:	89 e5                	mov    %esp,%ebp
+  802ce0:	53                   	push   %ebx
+  802ce1:	83 ec 10             	sub    $0x10,%esp
+  802ce4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802ce7:	68 0c 70 80 00       	push   $0x80700c
+  802cec:	e8 50 07 00 00       	call   803441 <mutex_lock>
+	if (v == 0)
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	85 db                	test   %ebx,%ebx
+  802cf6:	0f 84 85 00 00 00    	je     802d81 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802cfc:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802d02:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802d07:	77 51                	ja     802d5a <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802d09:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802d0f:	89 d8                	mov    %ebx,%eax
+  802d11:	c1 e8 0c             	shr    $0xc,%eax
+  802d14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802d1b:	f6 c4 02             	test   $0x2,%ah
+  802d1e:	74 50                	je     802d70 <free+0x93>
+		sys_page_unmap(0, c);
+  802d20:	83 ec 08             	sub    $0x8,%esp
+  802d23:	53                   	push   %ebx
+  802d24:	6a 00                	push   $0x0
+  802d26:	e8 3b e0 ff ff       	call   800d66 <sys_page_unmap>
+		c += PGSIZE;
+  802d2b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802d31:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802d37:	83 c4 10             	add    $0x10,%esp
+  802d3a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802d3f:	76 ce                	jbe    802d0f <free+0x32>
+  802d41:	68 4f 4e 80 00       	push   $0x804e4f
+  802d46:	68 9d 4d 80 00       	push   $0x804d9d
+  802d4b:	68 82 00 00 00       	push   $0x82
+  802d50:	68 42 4e 80 00       	push   $0x804e42
+  802d55:	e8 76 d4 ff ff       	call   8001d0 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802d5a:	68 14 4e 80 00       	push   $0x804e14
+  802d5f:	68 9d 4d 80 00       	push   $0x804d9d
+  802d64:	6a 7b                	push   $0x7b
+  802d66:	68 42 4e 80 00       	push   $0x804e42
+  802d6b:	e8 60 d4 ff ff       	call   8001d0 <_panic>
+	if (--(*ref) == 0)
+  802d70:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802d76:	83 e8 01             	sub    $0x1,%eax
+  802d79:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802d7f:	74 15                	je     802d96 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802d81:	83 ec 0c             	sub    $0xc,%esp
+  802d84:	68 0c 70 80 00       	push   $0x80700c
+  802d89:	e8 20 07 00 00       	call   8034ae <mutex_unlock>
+}
+  802d8e:	83 c4 10             	add    $0x10,%esp
+  802d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d94:	c9                   	leave
+  802d95:	c3                   	ret
+		sys_page_unmap(0, c);
+  802d96:	83 ec 08             	sub    $0x8,%esp
+  802d99:	53                   	push   %ebx
+  802d9a:	6a 00                	push   $0x0
+  802d9c:	e8 c5 df ff ff       	call   800d66 <sys_page_unmap>
+  802da1:	83 c4 10             	add    $0x10,%esp
+  802da4:	eb db                	jmp    802d81 <free+0xa4>
+
+00802da6 <malloc>:
+{
+  802da6:	55                   	push   %ebp
+  802da7:	89 e5                	mov    %esp,%ebp
+  802da9:	57                   	push   %edi
+  802daa:	56                   	push   %esi
+  802dab:	53                   	push   %ebx
+  802dac:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802daf:	68 0c 70 80 00       	push   $0x80700c
+  802db4:	e8 88 06 00 00       	call   803441 <mutex_lock>
+	if (mptr == 0)
+  802db9:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802dbf:	83 c4 10             	add    $0x10,%esp
+  802dc2:	85 ff                	test   %edi,%edi
+  802dc4:	74 6c                	je     802e32 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc9:	83 c0 03             	add    $0x3,%eax
+  802dcc:	83 e0 fc             	and    $0xfffffffc,%eax
+  802dcf:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802dd1:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802dd6:	0f 87 64 01 00 00    	ja     802f40 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802ddc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802de2:	74 30                	je     802e14 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802de4:	89 f9                	mov    %edi,%ecx
+  802de6:	c1 e9 0c             	shr    $0xc,%ecx
+  802de9:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802ded:	c1 e8 0c             	shr    $0xc,%eax
+  802df0:	39 c1                	cmp    %eax,%ecx
+  802df2:	74 5f                	je     802e53 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802df4:	83 ec 0c             	sub    $0xc,%esp
+  802df7:	57                   	push   %edi
+  802df8:	e8 e0 fe ff ff       	call   802cdd <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802dfd:	a1 10 70 80 00       	mov    0x807010,%eax
+  802e02:	05 00 10 00 00       	add    $0x1000,%eax
+  802e07:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e0c:	a3 10 70 80 00       	mov    %eax,0x807010
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802e1a:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e1f:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802e23:	8d 7e 04             	lea    0x4(%esi),%edi
+  802e26:	89 cb                	mov    %ecx,%ebx
+  802e28:	01 f9                	add    %edi,%ecx
+  802e2a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802e2d:	e9 8b 00 00 00       	jmp    802ebd <malloc+0x117>
+		mptr = mbegin;
+  802e32:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802e39:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3f:	83 c0 03             	add    $0x3,%eax
+  802e42:	83 e0 fc             	and    $0xfffffffc,%eax
+  802e45:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802e47:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802e4c:	76 c6                	jbe    802e14 <malloc+0x6e>
+  802e4e:	e9 d6 00 00 00       	jmp    802f29 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802e53:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e59:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802e5e:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802e62:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e65:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802e6a:	e9 ba 00 00 00       	jmp    802f29 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e6f:	05 00 10 00 00       	add    $0x1000,%eax
+  802e74:	39 c8                	cmp    %ecx,%eax
+  802e76:	0f 83 cb 00 00 00    	jae    802f47 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802e7c:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802e81:	77 22                	ja     802ea5 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802e83:	89 c2                	mov    %eax,%edx
+  802e85:	c1 ea 16             	shr    $0x16,%edx
+  802e88:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802e8f:	f6 c2 01             	test   $0x1,%dl
+  802e92:	74 db                	je     802e6f <malloc+0xc9>
+  802e94:	89 c2                	mov    %eax,%edx
+  802e96:	c1 ea 0c             	shr    $0xc,%edx
+  802e99:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ea0:	f6 c2 01             	test   $0x1,%dl
+  802ea3:	74 ca                	je     802e6f <malloc+0xc9>
+		if (mptr == mend) {
+  802ea5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802eab:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802eb1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802eb5:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802ebb:	74 04                	je     802ec1 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ebd:	89 d8                	mov    %ebx,%eax
+  802ebf:	eb b3                	jmp    802e74 <malloc+0xce>
+  802ec1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802ec4:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802ec9:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802ecd:	83 ea 01             	sub    $0x1,%edx
+  802ed0:	0f 85 50 ff ff ff    	jne    802e26 <malloc+0x80>
+  802ed6:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802edd:	00 00 08 
+				return 0;	/* out of address space */
+  802ee0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee5:	eb 42                	jmp    802f29 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802ee7:	85 db                	test   %ebx,%ebx
+  802ee9:	78 1e                	js     802f09 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802eeb:	83 ec 08             	sub    $0x8,%esp
+  802eee:	89 d8                	mov    %ebx,%eax
+  802ef0:	03 05 10 70 80 00    	add    0x807010,%eax
+  802ef6:	50                   	push   %eax
+  802ef7:	6a 00                	push   $0x0
+  802ef9:	e8 68 de ff ff       	call   800d66 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802efe:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802f04:	83 c4 10             	add    $0x10,%esp
+  802f07:	eb de                	jmp    802ee7 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802f09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0e:	eb 19                	jmp    802f29 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802f10:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f13:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802f19:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802f20:	00 
+	mptr += n;
+  802f21:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802f24:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  802f29:	83 ec 0c             	sub    $0xc,%esp
+  802f2c:	68 0c 70 80 00       	push   $0x80700c
+  802f31:	e8 78 05 00 00       	call   8034ae <mutex_unlock>
+}
+  802f36:	89 f8                	mov    %edi,%eax
+  802f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f3b:	5b                   	pop    %ebx
+  802f3c:	5e                   	pop    %esi
+  802f3d:	5f                   	pop    %edi
+  802f3e:	5d                   	pop    %ebp
+  802f3f:	c3                   	ret
+		return 0;
+  802f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f45:	eb e2                	jmp    802f29 <malloc+0x183>
+  802f47:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802f4b:	74 06                	je     802f53 <malloc+0x1ad>
+  802f4d:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f58:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802f5b:	39 fb                	cmp    %edi,%ebx
+  802f5d:	73 b1                	jae    802f10 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f5f:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f65:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f68:	39 fe                	cmp    %edi,%esi
+  802f6a:	0f 92 c0             	setb   %al
+  802f6d:	0f b6 c0             	movzbl %al,%eax
+  802f70:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f73:	83 c8 07             	or     $0x7,%eax
+  802f76:	50                   	push   %eax
+  802f77:	89 d8                	mov    %ebx,%eax
+  802f79:	03 05 10 70 80 00    	add    0x807010,%eax
+  802f7f:	50                   	push   %eax
+  802f80:	6a 00                	push   $0x0
+  802f82:	e8 46 dd ff ff       	call   800ccd <sys_page_alloc>
+  802f87:	83 c4 10             	add    $0x10,%esp
+  802f8a:	85 c0                	test   %eax,%eax
+  802f8c:	0f 88 55 ff ff ff    	js     802ee7 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f92:	89 f3                	mov    %esi,%ebx
+  802f94:	eb c5                	jmp    802f5b <malloc+0x1b5>
+
+00802f96 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	56                   	push   %esi
+  802f9a:	53                   	push   %ebx
+  802f9b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f9e:	83 ec 0c             	sub    $0xc,%esp
+  802fa1:	ff 75 08             	push   0x8(%ebp)
+  802fa4:	e8 d6 e1 ff ff       	call   80117f <fd2data>
+  802fa9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fab:	83 c4 08             	add    $0x8,%esp
+  802fae:	68 67 4e 80 00       	push   $0x804e67
+  802fb3:	53                   	push   %ebx
+  802fb4:	e8 d6 d8 ff ff       	call   80088f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fb9:	8b 46 04             	mov    0x4(%esi),%eax
+  802fbc:	2b 06                	sub    (%esi),%eax
+  802fbe:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fc4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fcb:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fce:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  802fd5:	62 80 00 
+	return 0;
+}
+  802fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fe0:	5b                   	pop    %ebx
+  802fe1:	5e                   	pop    %esi
+  802fe2:	5d                   	pop    %ebp
+  802fe3:	c3                   	ret
+
+00802fe4 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fe9:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802fed:	85 c9                	test   %ecx,%ecx
+  802fef:	75 01                	jne    802ff2 <pipewake+0xe>
+  802ff1:	c3                   	ret
+{
+  802ff2:	55                   	push   %ebp
+  802ff3:	89 e5                	mov    %esp,%ebp
+  802ff5:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802ff8:	68 00 04 00 00       	push   $0x400
+  802ffd:	52                   	push   %edx
+  802ffe:	e8 0e e0 ff ff       	call   801011 <sys_futex_wake>
+  803003:	83 c4 10             	add    $0x10,%esp
+}
+  803006:	c9                   	leave
+  803007:	c3                   	ret
+
+00803008 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803008:	55                   	push   %ebp
+  803009:	89 e5                	mov    %esp,%ebp
+  80300b:	56                   	push   %esi
+  80300c:	53                   	push   %ebx
+  80300d:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803010:	83 ec 0c             	sub    $0xc,%esp
+  803013:	56                   	push   %esi
+  803014:	e8 66 e1 ff ff       	call   80117f <fd2data>
+  803019:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80301b:	83 c4 08             	add    $0x8,%esp
+  80301e:	56                   	push   %esi
+  80301f:	6a 00                	push   $0x0
+  803021:	e8 40 dd ff ff       	call   800d66 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803026:	8d 53 04             	lea    0x4(%ebx),%edx
+  803029:	8d 43 08             	lea    0x8(%ebx),%eax
+  80302c:	e8 b3 ff ff ff       	call   802fe4 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803031:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803034:	89 da                	mov    %ebx,%edx
+  803036:	e8 a9 ff ff ff       	call   802fe4 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80303b:	89 34 24             	mov    %esi,(%esp)
+  80303e:	e8 3c e1 ff ff       	call   80117f <fd2data>
+  803043:	83 c4 08             	add    $0x8,%esp
+  803046:	50                   	push   %eax
+  803047:	6a 00                	push   $0x0
+  803049:	e8 18 dd ff ff       	call   800d66 <sys_page_unmap>
+}
+  80304e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803051:	5b                   	pop    %ebx
+  803052:	5e                   	pop    %esi
+  803053:	5d                   	pop    %ebp
+  803054:	c3                   	ret
+
+00803055 <_pipeisclosed>:
+{
+  803055:	55                   	push   %ebp
+  803056:	89 e5                	mov    %esp,%ebp
+  803058:	57                   	push   %edi
+  803059:	56                   	push   %esi
+  80305a:	53                   	push   %ebx
+  80305b:	83 ec 1c             	sub    $0x1c,%esp
+  80305e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803061:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803063:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803068:	eb 5d                	jmp    8030c7 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80306a:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		n = thisenv->env_runs;
+  803070:	8b 02                	mov    (%edx),%eax
+  803072:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803075:	83 ec 0c             	sub    $0xc,%esp
+  803078:	ff 75 e0             	push   -0x20(%ebp)
+  80307b:	e8 42 15 00 00       	call   8045c2 <pageref>
+  803080:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803083:	89 3c 24             	mov    %edi,(%esp)
+  803086:	e8 37 15 00 00       	call   8045c2 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80308b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80308d:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803093:	83 c4 10             	add    $0x10,%esp
+  803096:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80309c:	77 15                	ja     8030b3 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80309e:	89 f2                	mov    %esi,%edx
+  8030a0:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8030a2:	c1 ea 10             	shr    $0x10,%edx
+  8030a5:	74 0c                	je     8030b3 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8030a7:	c1 e2 10             	shl    $0x10,%edx
+  8030aa:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8030af:	29 d1                	sub    %edx,%ecx
+  8030b1:	eb 06                	jmp    8030b9 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8030b3:	8b 0d c0 92 80 00    	mov    0x8092c0,%ecx
+		nn = thisenv->env_runs;
+  8030b9:	8b 11                	mov    (%ecx),%edx
+  8030bb:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8030be:	39 d3                	cmp    %edx,%ebx
+  8030c0:	74 6e                	je     803130 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8030c2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030c5:	74 24                	je     8030eb <_pipeisclosed+0x96>
+  8030c7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8030c9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8030cf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030d4:	77 94                	ja     80306a <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030d6:	89 f0                	mov    %esi,%eax
+  8030d8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8030da:	c1 e8 10             	shr    $0x10,%eax
+  8030dd:	74 8b                	je     80306a <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8030df:	c1 e0 10             	shl    $0x10,%eax
+  8030e2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8030e7:	29 c2                	sub    %eax,%edx
+  8030e9:	eb 85                	jmp    803070 <_pipeisclosed+0x1b>
+  8030eb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8030ed:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8030f3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030f8:	77 18                	ja     803112 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030fa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8030ff:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803101:	c1 e8 10             	shr    $0x10,%eax
+  803104:	74 0c                	je     803112 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803106:	c1 e0 10             	shl    $0x10,%eax
+  803109:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80310e:	29 c2                	sub    %eax,%edx
+  803110:	eb 06                	jmp    803118 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803112:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803118:	8b 02                	mov    (%edx),%eax
+  80311a:	8b 40 58             	mov    0x58(%eax),%eax
+  80311d:	6a 01                	push   $0x1
+  80311f:	50                   	push   %eax
+  803120:	53                   	push   %ebx
+  803121:	68 6e 4e 80 00       	push   $0x804e6e
+  803126:	e8 80 d1 ff ff       	call   8002ab <cprintf>
+  80312b:	83 c4 10             	add    $0x10,%esp
+  80312e:	eb 97                	jmp    8030c7 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803130:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803133:	0f 94 c0             	sete   %al
+  803136:	0f b6 c0             	movzbl %al,%eax
+}
+  803139:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80313c:	5b                   	pop    %ebx
+  80313d:	5e                   	pop    %esi
+  80313e:	5f                   	pop    %edi
+  80313f:	5d                   	pop    %ebp
+  803140:	c3                   	ret
+
+00803141 <devpipe_write>:
+{
+  803141:	55                   	push   %ebp
+  803142:	89 e5                	mov    %esp,%ebp
+  803144:	57                   	push   %edi
+  803145:	56                   	push   %esi
+  803146:	53                   	push   %ebx
+  803147:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80314a:	ff 75 08             	push   0x8(%ebp)
+  80314d:	e8 2d e0 ff ff       	call   80117f <fd2data>
+  803152:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80315e:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803161:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803164:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803167:	0f 84 96 00 00 00    	je     803203 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80316d:	8d 73 08             	lea    0x8(%ebx),%esi
+  803170:	eb 32                	jmp    8031a4 <devpipe_write+0x63>
+  803172:	89 fa                	mov    %edi,%edx
+  803174:	89 f0                	mov    %esi,%eax
+  803176:	e8 69 fe ff ff       	call   802fe4 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80317b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80317e:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803181:	ba 01 00 00 00       	mov    $0x1,%edx
+  803186:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	6a 0a                	push   $0xa
+  803190:	50                   	push   %eax
+  803191:	53                   	push   %ebx
+  803192:	e8 4b de ff ff       	call   800fe2 <sys_futex_wait>
+  803197:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80319c:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8031a1:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8031a4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031a7:	8b 0b                	mov    (%ebx),%ecx
+  8031a9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8031ac:	39 d0                	cmp    %edx,%eax
+  8031ae:	72 1b                	jb     8031cb <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8031b0:	89 da                	mov    %ebx,%edx
+  8031b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b5:	e8 9b fe ff ff       	call   803055 <_pipeisclosed>
+  8031ba:	85 c0                	test   %eax,%eax
+  8031bc:	74 b4                	je     803172 <devpipe_write+0x31>
+				return 0;
+  8031be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031c6:	5b                   	pop    %ebx
+  8031c7:	5e                   	pop    %esi
+  8031c8:	5f                   	pop    %edi
+  8031c9:	5d                   	pop    %ebp
+  8031ca:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031ce:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8031d1:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8031d5:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8031d8:	89 c2                	mov    %eax,%edx
+  8031da:	c1 fa 1f             	sar    $0x1f,%edx
+  8031dd:	89 d1                	mov    %edx,%ecx
+  8031df:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031e2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031e5:	83 e2 1f             	and    $0x1f,%edx
+  8031e8:	29 ca                	sub    %ecx,%edx
+  8031ea:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8031ee:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8031f2:	83 c0 01             	add    $0x1,%eax
+  8031f5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031f8:	83 c6 01             	add    $0x1,%esi
+  8031fb:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8031fe:	e9 5e ff ff ff       	jmp    803161 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803203:	8d 53 04             	lea    0x4(%ebx),%edx
+  803206:	8d 43 08             	lea    0x8(%ebx),%eax
+  803209:	e8 d6 fd ff ff       	call   802fe4 <pipewake>
+	return i;
+  80320e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803211:	eb b0                	jmp    8031c3 <devpipe_write+0x82>
+
+00803213 <devpipe_read>:
+{
+  803213:	55                   	push   %ebp
+  803214:	89 e5                	mov    %esp,%ebp
+  803216:	57                   	push   %edi
+  803217:	56                   	push   %esi
+  803218:	53                   	push   %ebx
+  803219:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80321c:	ff 75 08             	push   0x8(%ebp)
+  80321f:	e8 5b df ff ff       	call   80117f <fd2data>
+  803224:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803226:	83 c4 10             	add    $0x10,%esp
+  803229:	be 00 00 00 00       	mov    $0x0,%esi
+  80322e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803231:	74 6c                	je     80329f <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803233:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803236:	eb 25                	jmp    80325d <devpipe_read+0x4a>
+  803238:	8b 13                	mov    (%ebx),%edx
+  80323a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80323f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803244:	83 ec 04             	sub    $0x4,%esp
+  803247:	6a 0a                	push   $0xa
+  803249:	52                   	push   %edx
+  80324a:	57                   	push   %edi
+  80324b:	e8 92 dd ff ff       	call   800fe2 <sys_futex_wait>
+  803250:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803255:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80325a:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80325d:	8b 03                	mov    (%ebx),%eax
+  80325f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803262:	75 19                	jne    80327d <devpipe_read+0x6a>
+			if (i > 0)
+  803264:	85 f6                	test   %esi,%esi
+  803266:	75 3a                	jne    8032a2 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803268:	89 da                	mov    %ebx,%edx
+  80326a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326d:	e8 e3 fd ff ff       	call   803055 <_pipeisclosed>
+  803272:	85 c0                	test   %eax,%eax
+  803274:	74 c2                	je     803238 <devpipe_read+0x25>
+				return 0;
+  803276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327b:	eb 31                	jmp    8032ae <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80327d:	89 c1                	mov    %eax,%ecx
+  80327f:	c1 f9 1f             	sar    $0x1f,%ecx
+  803282:	c1 e9 1b             	shr    $0x1b,%ecx
+  803285:	01 c8                	add    %ecx,%eax
+  803287:	83 e0 1f             	and    $0x1f,%eax
+  80328a:	29 c8                	sub    %ecx,%eax
+  80328c:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803294:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803297:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80329a:	83 c6 01             	add    $0x1,%esi
+  80329d:	eb 8f                	jmp    80322e <devpipe_read+0x1b>
+out:
+  80329f:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8032a2:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8032a5:	89 da                	mov    %ebx,%edx
+  8032a7:	e8 38 fd ff ff       	call   802fe4 <pipewake>
+	return i;
+  8032ac:	89 f0                	mov    %esi,%eax
+}
+  8032ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032b1:	5b                   	pop    %ebx
+  8032b2:	5e                   	pop    %esi
+  8032b3:	5f                   	pop    %edi
+  8032b4:	5d                   	pop    %ebp
+  8032b5:	c3                   	ret
+
+008032b6 <pipe>:
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	56                   	push   %esi
+  8032ba:	53                   	push   %ebx
+  8032bb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8032be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032c1:	50                   	push   %eax
+  8032c2:	e8 cf de ff ff       	call   801196 <fd_alloc>
+  8032c7:	89 c3                	mov    %eax,%ebx
+  8032c9:	83 c4 10             	add    $0x10,%esp
+  8032cc:	85 c0                	test   %eax,%eax
+  8032ce:	0f 88 23 01 00 00    	js     8033f7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032d4:	83 ec 04             	sub    $0x4,%esp
+  8032d7:	68 07 04 00 00       	push   $0x407
+  8032dc:	ff 75 f4             	push   -0xc(%ebp)
+  8032df:	6a 00                	push   $0x0
+  8032e1:	e8 e7 d9 ff ff       	call   800ccd <sys_page_alloc>
+  8032e6:	89 c3                	mov    %eax,%ebx
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	0f 88 04 01 00 00    	js     8033f7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032f3:	83 ec 0c             	sub    $0xc,%esp
+  8032f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032f9:	50                   	push   %eax
+  8032fa:	e8 97 de ff ff       	call   801196 <fd_alloc>
+  8032ff:	89 c3                	mov    %eax,%ebx
+  803301:	83 c4 10             	add    $0x10,%esp
+  803304:	85 c0                	test   %eax,%eax
+  803306:	0f 88 db 00 00 00    	js     8033e7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80330c:	83 ec 04             	sub    $0x4,%esp
+  80330f:	68 07 04 00 00       	push   $0x407
+  803314:	ff 75 f0             	push   -0x10(%ebp)
+  803317:	6a 00                	push   $0x0
+  803319:	e8 af d9 ff ff       	call   800ccd <sys_page_alloc>
+  80331e:	89 c3                	mov    %eax,%ebx
+  803320:	83 c4 10             	add    $0x10,%esp
+  803323:	85 c0                	test   %eax,%eax
+  803325:	0f 88 bc 00 00 00    	js     8033e7 <pipe+0x131>
+	va = fd2data(fd0);
+  80332b:	83 ec 0c             	sub    $0xc,%esp
+  80332e:	ff 75 f4             	push   -0xc(%ebp)
+  803331:	e8 49 de ff ff       	call   80117f <fd2data>
+  803336:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803338:	83 c4 0c             	add    $0xc,%esp
+  80333b:	68 07 04 00 00       	push   $0x407
+  803340:	50                   	push   %eax
+  803341:	6a 00                	push   $0x0
+  803343:	e8 85 d9 ff ff       	call   800ccd <sys_page_alloc>
+  803348:	89 c3                	mov    %eax,%ebx
+  80334a:	83 c4 10             	add    $0x10,%esp
+  80334d:	85 c0                	test   %eax,%eax
+  80334f:	0f 88 82 00 00 00    	js     8033d7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803355:	83 ec 0c             	sub    $0xc,%esp
+  803358:	ff 75 f0             	push   -0x10(%ebp)
+  80335b:	e8 1f de ff ff       	call   80117f <fd2data>
+  803360:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803367:	50                   	push   %eax
+  803368:	6a 00                	push   $0x0
+  80336a:	56                   	push   %esi
+  80336b:	6a 00                	push   $0x0
+  80336d:	e8 a8 d9 ff ff       	call   800d1a <sys_page_map>
+  803372:	89 c3                	mov    %eax,%ebx
+  803374:	83 c4 20             	add    $0x20,%esp
+  803377:	85 c0                	test   %eax,%eax
+  803379:	78 4e                	js     8033c9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80337b:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803380:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803383:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803385:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803388:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80338f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803392:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803394:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803397:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80339e:	83 ec 0c             	sub    $0xc,%esp
+  8033a1:	ff 75 f4             	push   -0xc(%ebp)
+  8033a4:	e8 c6 dd ff ff       	call   80116f <fd2num>
+  8033a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033ac:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8033ae:	83 c4 04             	add    $0x4,%esp
+  8033b1:	ff 75 f0             	push   -0x10(%ebp)
+  8033b4:	e8 b6 dd ff ff       	call   80116f <fd2num>
+  8033b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033bc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8033bf:	83 c4 10             	add    $0x10,%esp
+  8033c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033c7:	eb 2e                	jmp    8033f7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8033c9:	83 ec 08             	sub    $0x8,%esp
+  8033cc:	56                   	push   %esi
+  8033cd:	6a 00                	push   $0x0
+  8033cf:	e8 92 d9 ff ff       	call   800d66 <sys_page_unmap>
+  8033d4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033d7:	83 ec 08             	sub    $0x8,%esp
+  8033da:	ff 75 f0             	push   -0x10(%ebp)
+  8033dd:	6a 00                	push   $0x0
+  8033df:	e8 82 d9 ff ff       	call   800d66 <sys_page_unmap>
+  8033e4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033e7:	83 ec 08             	sub    $0x8,%esp
+  8033ea:	ff 75 f4             	push   -0xc(%ebp)
+  8033ed:	6a 00                	push   $0x0
+  8033ef:	e8 72 d9 ff ff       	call   800d66 <sys_page_unmap>
+  8033f4:	83 c4 10             	add    $0x10,%esp
+}
+  8033f7:	89 d8                	mov    %ebx,%eax
+  8033f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033fc:	5b                   	pop    %ebx
+  8033fd:	5e                   	pop    %esi
+  8033fe:	5d                   	pop    %ebp
+  8033ff:	c3                   	ret
+
+00803400 <pipeisclosed>:
+{
+  803400:	55                   	push   %ebp
+  803401:	89 e5                	mov    %esp,%ebp
+  803403:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803406:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803409:	50                   	push   %eax
+  80340a:	ff 75 08             	push   0x8(%ebp)
+  80340d:	e8 da dd ff ff       	call   8011ec <fd_lookup>
+  803412:	83 c4 10             	add    $0x10,%esp
+  803415:	85 c0                	test   %eax,%eax
+  803417:	78 18                	js     803431 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803419:	83 ec 0c             	sub    $0xc,%esp
+  80341c:	ff 75 f4             	push   -0xc(%ebp)
+  80341f:	e8 5b dd ff ff       	call   80117f <fd2data>
+  803424:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803426:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803429:	e8 27 fc ff ff       	call   803055 <_pipeisclosed>
+  80342e:	83 c4 10             	add    $0x10,%esp
+}
+  803431:	c9                   	leave
+  803432:	c3                   	ret
+
+00803433 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803433:	55                   	push   %ebp
+  803434:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803436:	8b 45 08             	mov    0x8(%ebp),%eax
+  803439:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80343f:	5d                   	pop    %ebp
+  803440:	c3                   	ret
+
+00803441 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803441:	55                   	push   %ebp
+  803442:	89 e5                	mov    %esp,%ebp
+  803444:	56                   	push   %esi
+  803445:	53                   	push   %ebx
+  803446:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80344e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803453:	89 d0                	mov    %edx,%eax
+  803455:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803459:	85 c0                	test   %eax,%eax
+  80345b:	74 2d                	je     80348a <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80345d:	83 f8 02             	cmp    $0x2,%eax
+  803460:	74 08                	je     80346a <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803462:	b8 02 00 00 00       	mov    $0x2,%eax
+  803467:	f0 87 03             	lock xchg %eax,(%ebx)
+  80346a:	be 02 00 00 00       	mov    $0x2,%esi
+  80346f:	eb 15                	jmp    803486 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803471:	83 ec 04             	sub    $0x4,%esp
+  803474:	6a 00                	push   $0x0
+  803476:	6a 02                	push   $0x2
+  803478:	53                   	push   %ebx
+  803479:	e8 64 db ff ff       	call   800fe2 <sys_futex_wait>
+  80347e:	89 f0                	mov    %esi,%eax
+  803480:	f0 87 03             	lock xchg %eax,(%ebx)
+  803483:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803486:	85 c0                	test   %eax,%eax
+  803488:	75 e7                	jne    803471 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80348a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80348d:	5b                   	pop    %ebx
+  80348e:	5e                   	pop    %esi
+  80348f:	5d                   	pop    %ebp
+  803490:	c3                   	ret
+
+00803491 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803491:	55                   	push   %ebp
+  803492:	89 e5                	mov    %esp,%ebp
+  803494:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8034a1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8034a5:	f7 d8                	neg    %eax
+  8034a7:	19 c0                	sbb    %eax,%eax
+  8034a9:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8034ac:	5d                   	pop    %ebp
+  8034ad:	c3                   	ret
+
+008034ae <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8034ae:	55                   	push   %ebp
+  8034af:	89 e5                	mov    %esp,%ebp
+  8034b1:	83 ec 08             	sub    $0x8,%esp
+  8034b4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8034b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034bc:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8034bf:	83 f8 02             	cmp    $0x2,%eax
+  8034c2:	74 02                	je     8034c6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8034c4:	c9                   	leave
+  8034c5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8034c6:	83 ec 08             	sub    $0x8,%esp
+  8034c9:	6a 01                	push   $0x1
+  8034cb:	52                   	push   %edx
+  8034cc:	e8 40 db ff ff       	call   801011 <sys_futex_wake>
+  8034d1:	83 c4 10             	add    $0x10,%esp
+}
+  8034d4:	eb ee                	jmp    8034c4 <mutex_unlock+0x16>
+
+008034d6 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8034d6:	55                   	push   %ebp
+  8034d7:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8034d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034dc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8034e2:	5d                   	pop    %ebp
+  8034e3:	c3                   	ret
+
+008034e4 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8034e4:	55                   	push   %ebp
+  8034e5:	89 e5                	mov    %esp,%ebp
+  8034e7:	57                   	push   %edi
+  8034e8:	56                   	push   %esi
+  8034e9:	53                   	push   %ebx
+  8034ea:	83 ec 18             	sub    $0x18,%esp
+  8034ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8034f3:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8034f5:	53                   	push   %ebx
+  8034f6:	e8 b3 ff ff ff       	call   8034ae <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8034fb:	83 c4 0c             	add    $0xc,%esp
+  8034fe:	ff 75 10             	push   0x10(%ebp)
+  803501:	57                   	push   %edi
+  803502:	56                   	push   %esi
+  803503:	e8 da da ff ff       	call   800fe2 <sys_futex_wait>
+  803508:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80350a:	83 c4 10             	add    $0x10,%esp
+  80350d:	be 02 00 00 00       	mov    $0x2,%esi
+  803512:	eb 10                	jmp    803524 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803514:	83 ec 04             	sub    $0x4,%esp
+  803517:	6a 00                	push   $0x0
+  803519:	6a 02                	push   $0x2
+  80351b:	53                   	push   %ebx
+  80351c:	e8 c1 da ff ff       	call   800fe2 <sys_futex_wait>
+  803521:	83 c4 10             	add    $0x10,%esp
+  803524:	89 f0                	mov    %esi,%eax
+  803526:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803529:	85 c0                	test   %eax,%eax
+  80352b:	75 e7                	jne    803514 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80352d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803530:	74 05                	je     803537 <cond_timedwait+0x53>
+  803532:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803537:	89 f8                	mov    %edi,%eax
+  803539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80353c:	5b                   	pop    %ebx
+  80353d:	5e                   	pop    %esi
+  80353e:	5f                   	pop    %edi
+  80353f:	5d                   	pop    %ebp
+  803540:	c3                   	ret
+
+00803541 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803541:	55                   	push   %ebp
+  803542:	89 e5                	mov    %esp,%ebp
+  803544:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803547:	6a 00                	push   $0x0
+  803549:	ff 75 0c             	push   0xc(%ebp)
+  80354c:	ff 75 08             	push   0x8(%ebp)
+  80354f:	e8 90 ff ff ff       	call   8034e4 <cond_timedwait>
+}
+  803554:	83 c4 10             	add    $0x10,%esp
+  803557:	c9                   	leave
+  803558:	c3                   	ret
+
+00803559 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803559:	55                   	push   %ebp
+  80355a:	89 e5                	mov    %esp,%ebp
+  80355c:	83 ec 10             	sub    $0x10,%esp
+  80355f:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803562:	ba 01 00 00 00       	mov    $0x1,%edx
+  803567:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80356b:	6a 01                	push   $0x1
+  80356d:	50                   	push   %eax
+  80356e:	e8 9e da ff ff       	call   801011 <sys_futex_wake>
+}
+  803573:	83 c4 10             	add    $0x10,%esp
+  803576:	c9                   	leave
+  803577:	c3                   	ret
+
+00803578 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803578:	55                   	push   %ebp
+  803579:	89 e5                	mov    %esp,%ebp
+  80357b:	83 ec 10             	sub    $0x10,%esp
+  80357e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803581:	ba 01 00 00 00       	mov    $0x1,%edx
+  803586:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80358a:	68 00 04 00 00       	push   $0x400
+  80358f:	50                   	push   %eax
+  803590:	e8 7c da ff ff       	call   801011 <sys_futex_wake>
+}
+  803595:	83 c4 10             	add    $0x10,%esp
+  803598:	c9                   	leave
+  803599:	c3                   	ret
+
+0080359a <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80359a:	55                   	push   %ebp
+  80359b:	89 e5                	mov    %esp,%ebp
+  80359d:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8035a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035a3:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8035a5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8035ac:	5d                   	pop    %ebp
+  8035ad:	c3                   	ret
+
+008035ae <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8035ae:	55                   	push   %ebp
+  8035af:	89 e5                	mov    %esp,%ebp
+  8035b1:	53                   	push   %ebx
+  8035b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8035b5:	8b 11                	mov    (%ecx),%edx
+  8035b7:	85 d2                	test   %edx,%edx
+  8035b9:	74 14                	je     8035cf <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8035bb:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8035be:	89 d0                	mov    %edx,%eax
+  8035c0:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8035c4:	39 c2                	cmp    %eax,%edx
+  8035c6:	75 ed                	jne    8035b5 <sem_trywait+0x7>
+			return 0;
+  8035c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035cd:	eb 05                	jmp    8035d4 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8035cf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8035d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+
+008035d9 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	57                   	push   %edi
+  8035dd:	56                   	push   %esi
+  8035de:	53                   	push   %ebx
+  8035df:	83 ec 1c             	sub    $0x1c,%esp
+  8035e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8035e5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8035e8:	e8 6d d9 ff ff       	call   800f5a <sys_time_msec>
+  8035ed:	01 f8                	add    %edi,%eax
+  8035ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8035f2:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8035f7:	eb 28                	jmp    803621 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8035f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035fe:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803603:	83 ec 04             	sub    $0x4,%esp
+  803606:	56                   	push   %esi
+  803607:	6a 00                	push   $0x0
+  803609:	53                   	push   %ebx
+  80360a:	e8 d3 d9 ff ff       	call   800fe2 <sys_futex_wait>
+  80360f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803614:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803619:	83 c4 10             	add    $0x10,%esp
+  80361c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80361f:	74 2e                	je     80364f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803621:	83 ec 0c             	sub    $0xc,%esp
+  803624:	53                   	push   %ebx
+  803625:	e8 84 ff ff ff       	call   8035ae <sem_trywait>
+  80362a:	83 c4 10             	add    $0x10,%esp
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	79 19                	jns    80364a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803631:	85 ff                	test   %edi,%edi
+  803633:	74 c4                	je     8035f9 <sem_timedwait+0x20>
+  803635:	e8 20 d9 ff ff       	call   800f5a <sys_time_msec>
+  80363a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80363d:	29 c6                	sub    %eax,%esi
+  80363f:	85 f6                	test   %esi,%esi
+  803641:	7f b6                	jg     8035f9 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803643:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803648:	eb 05                	jmp    80364f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  80364a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80364f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803652:	5b                   	pop    %ebx
+  803653:	5e                   	pop    %esi
+  803654:	5f                   	pop    %edi
+  803655:	5d                   	pop    %ebp
+  803656:	c3                   	ret
+
+00803657 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803657:	55                   	push   %ebp
+  803658:	89 e5                	mov    %esp,%ebp
+  80365a:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80365d:	6a 00                	push   $0x0
+  80365f:	ff 75 08             	push   0x8(%ebp)
+  803662:	e8 72 ff ff ff       	call   8035d9 <sem_timedwait>
+}
+  803667:	83 c4 10             	add    $0x10,%esp
+  80366a:	c9                   	leave
+  80366b:	c3                   	ret
+
+0080366c <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80366c:	55                   	push   %ebp
+  80366d:	89 e5                	mov    %esp,%ebp
+  80366f:	83 ec 08             	sub    $0x8,%esp
+  803672:	8b 45 08             	mov    0x8(%ebp),%eax
+  803675:	ba 01 00 00 00       	mov    $0x1,%edx
+  80367a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80367e:	8b 50 04             	mov    0x4(%eax),%edx
+  803681:	85 d2                	test   %edx,%edx
+  803683:	75 02                	jne    803687 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803687:	83 ec 08             	sub    $0x8,%esp
+  80368a:	6a 01                	push   $0x1
+  80368c:	50                   	push   %eax
+  80368d:	e8 7f d9 ff ff       	call   801011 <sys_futex_wake>
+  803692:	83 c4 10             	add    $0x10,%esp
+}
+  803695:	eb ee                	jmp    803685 <sem_post+0x19>
+
+00803697 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803697:	55                   	push   %ebp
+  803698:	89 e5                	mov    %esp,%ebp
+  80369a:	57                   	push   %edi
+  80369b:	56                   	push   %esi
+  80369c:	53                   	push   %ebx
+  80369d:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8036a0:	68 20 70 80 00       	push   $0x807020
+  8036a5:	e8 97 fd ff ff       	call   803441 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8036aa:	a1 44 70 80 00       	mov    0x807044,%eax
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	75 19                	jne    8036cf <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8036b6:	a1 c0 92 80 00       	mov    0x8092c0,%eax
+  8036bb:	8b 00                	mov    (%eax),%eax
+  8036bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8036c0:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8036c5:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  8036cc:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8036cf:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8036d4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036d7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8036de:	8b 40 04             	mov    0x4(%eax),%eax
+  8036e1:	85 c0                	test   %eax,%eax
+  8036e3:	0f 84 e4 00 00 00    	je     8037cd <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8036e9:	83 c3 01             	add    $0x1,%ebx
+  8036ec:	83 fb 20             	cmp    $0x20,%ebx
+  8036ef:	75 e3                	jne    8036d4 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8036f1:	83 ec 0c             	sub    $0xc,%esp
+  8036f4:	68 20 70 80 00       	push   $0x807020
+  8036f9:	e8 b0 fd ff ff       	call   8034ae <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8036fe:	83 c4 10             	add    $0x10,%esp
+  803701:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803706:	e9 b8 00 00 00       	jmp    8037c3 <pthread_create+0x12c>
+  80370b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80370e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803711:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803713:	39 f3                	cmp    %esi,%ebx
+  803715:	73 16                	jae    80372d <pthread_create+0x96>
+		va -= PGSIZE;
+  803717:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80371d:	83 ec 08             	sub    $0x8,%esp
+  803720:	56                   	push   %esi
+  803721:	6a 00                	push   $0x0
+  803723:	e8 3e d6 ff ff       	call   800d66 <sys_page_unmap>
+  803728:	83 c4 10             	add    $0x10,%esp
+  80372b:	eb e6                	jmp    803713 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80372d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803730:	83 ec 08             	sub    $0x8,%esp
+  803733:	ff 75 e4             	push   -0x1c(%ebp)
+  803736:	6a 00                	push   $0x0
+  803738:	e8 29 d6 ff ff       	call   800d66 <sys_page_unmap>
+	return r;
+  80373d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803740:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803743:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80374a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803751:	eb 70                	jmp    8037c3 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803753:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803756:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80375d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803760:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803763:	8b 55 10             	mov    0x10(%ebp),%edx
+  803766:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803769:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803770:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803775:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803778:	29 c8                	sub    %ecx,%eax
+  80377a:	85 db                	test   %ebx,%ebx
+  80377c:	0f 44 05 c0 92 80 00 	cmove  0x8092c0,%eax
+	*--esp = t;
+  803783:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803786:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80378d:	83 ec 04             	sub    $0x4,%esp
+  803790:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803795:	29 ca                	sub    %ecx,%edx
+  803797:	52                   	push   %edx
+	*--esp = 0;
+  803798:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80379b:	50                   	push   %eax
+  80379c:	68 f4 39 80 00       	push   $0x8039f4
+  8037a1:	e8 10 d9 ff ff       	call   8010b6 <sys_thread_create>
+  8037a6:	89 c7                	mov    %eax,%edi
+  8037a8:	83 c4 10             	add    $0x10,%esp
+  8037ab:	85 c0                	test   %eax,%eax
+  8037ad:	78 91                	js     803740 <pthread_create+0xa9>
+	th->th_env = id;
+  8037af:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037b2:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8037b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037bc:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8037be:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8037c3:	89 f8                	mov    %edi,%eax
+  8037c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c8:	5b                   	pop    %ebx
+  8037c9:	5e                   	pop    %esi
+  8037ca:	5f                   	pop    %edi
+  8037cb:	5d                   	pop    %ebp
+  8037cc:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8037cd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037d0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8037d7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8037de:	83 ec 0c             	sub    $0xc,%esp
+  8037e1:	68 20 70 80 00       	push   $0x807020
+  8037e6:	e8 c3 fc ff ff       	call   8034ae <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8037eb:	89 d9                	mov    %ebx,%ecx
+  8037ed:	c1 e1 10             	shl    $0x10,%ecx
+  8037f0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8037f3:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8037f8:	29 c8                	sub    %ecx,%eax
+  8037fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8037fd:	c1 e8 16             	shr    $0x16,%eax
+  803800:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803807:	83 c4 10             	add    $0x10,%esp
+  80380a:	a8 01                	test   $0x1,%al
+  80380c:	74 15                	je     803823 <pthread_create+0x18c>
+  80380e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803811:	c1 e8 0c             	shr    $0xc,%eax
+  803814:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80381b:	a8 01                	test   $0x1,%al
+  80381d:	0f 85 30 ff ff ff    	jne    803753 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803823:	83 ec 04             	sub    $0x4,%esp
+  803826:	6a 07                	push   $0x7
+  803828:	ff 75 e4             	push   -0x1c(%ebp)
+  80382b:	6a 00                	push   $0x0
+  80382d:	e8 9b d4 ff ff       	call   800ccd <sys_page_alloc>
+  803832:	89 c7                	mov    %eax,%edi
+  803834:	83 c4 10             	add    $0x10,%esp
+  803837:	85 c0                	test   %eax,%eax
+  803839:	0f 88 01 ff ff ff    	js     803740 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80383f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803844:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803847:	29 d0                	sub    %edx,%eax
+  803849:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80384c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80384e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803853:	29 d0                	sub    %edx,%eax
+  803855:	89 c7                	mov    %eax,%edi
+  803857:	39 fe                	cmp    %edi,%esi
+  803859:	0f 83 f4 fe ff ff    	jae    803753 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80385f:	83 ec 04             	sub    $0x4,%esp
+  803862:	6a 07                	push   $0x7
+  803864:	56                   	push   %esi
+  803865:	6a 00                	push   $0x0
+  803867:	e8 61 d4 ff ff       	call   800ccd <sys_page_alloc>
+  80386c:	83 c4 10             	add    $0x10,%esp
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	0f 88 94 fe ff ff    	js     80370b <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803877:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80387d:	eb d8                	jmp    803857 <pthread_create+0x1c0>
+
+0080387f <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80387f:	55                   	push   %ebp
+  803880:	89 e5                	mov    %esp,%ebp
+  803882:	57                   	push   %edi
+  803883:	56                   	push   %esi
+  803884:	53                   	push   %ebx
+  803885:	83 ec 0c             	sub    $0xc,%esp
+  803888:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80388b:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80388e:	83 f8 1e             	cmp    $0x1e,%eax
+  803891:	0f 87 c7 00 00 00    	ja     80395e <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803897:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803899:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80389f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038a4:	77 12                	ja     8038b8 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038a6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038ab:	29 d0                	sub    %edx,%eax
+  8038ad:	c1 e8 10             	shr    $0x10,%eax
+  8038b0:	39 c3                	cmp    %eax,%ebx
+  8038b2:	0f 84 ad 00 00 00    	je     803965 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8038b8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038bb:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8038c2:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8038c9:	eb 10                	jmp    8038db <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8038cb:	83 ec 04             	sub    $0x4,%esp
+  8038ce:	6a 00                	push   $0x0
+  8038d0:	6a 01                	push   $0x1
+  8038d2:	57                   	push   %edi
+  8038d3:	e8 0a d7 ff ff       	call   800fe2 <sys_futex_wait>
+  8038d8:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8038db:	8b 46 04             	mov    0x4(%esi),%eax
+  8038de:	83 f8 01             	cmp    $0x1,%eax
+  8038e1:	74 e8                	je     8038cb <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8038e3:	83 f8 02             	cmp    $0x2,%eax
+  8038e6:	0f 85 80 00 00 00    	jne    80396c <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038ec:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8038ef:	c1 e6 02             	shl    $0x2,%esi
+  8038f2:	eb 05                	jmp    8038f9 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8038f4:	e8 a8 d3 ff ff       	call   800ca1 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038f9:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8038ff:	89 ca                	mov    %ecx,%edx
+  803901:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803907:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80390a:	c1 e0 04             	shl    $0x4,%eax
+  80390d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803912:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803915:	39 c1                	cmp    %eax,%ecx
+  803917:	75 12                	jne    80392b <pthread_join+0xac>
+  803919:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80391c:	c1 e0 04             	shl    $0x4,%eax
+  80391f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803924:	8b 40 54             	mov    0x54(%eax),%eax
+  803927:	85 c0                	test   %eax,%eax
+  803929:	75 c9                	jne    8038f4 <pthread_join+0x75>
+	if (ret_store)
+  80392b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80392f:	74 0f                	je     803940 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803931:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803934:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80393b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80393e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803940:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803943:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80394a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803951:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803959:	5b                   	pop    %ebx
+  80395a:	5e                   	pop    %esi
+  80395b:	5f                   	pop    %edi
+  80395c:	5d                   	pop    %ebp
+  80395d:	c3                   	ret
+		return -E_INVAL;
+  80395e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803963:	eb f1                	jmp    803956 <pthread_join+0xd7>
+  803965:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80396a:	eb ea                	jmp    803956 <pthread_join+0xd7>
+		return -E_INVAL;
+  80396c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803971:	eb e3                	jmp    803956 <pthread_join+0xd7>
+
+00803973 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803973:	55                   	push   %ebp
+  803974:	89 e5                	mov    %esp,%ebp
+  803976:	53                   	push   %ebx
+  803977:	83 ec 04             	sub    $0x4,%esp
+  80397a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80397c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803982:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803987:	77 0c                	ja     803995 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803989:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80398e:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803990:	c1 e8 10             	shr    $0x10,%eax
+  803993:	75 0a                	jne    80399f <pthread_exit+0x2c>
+		exit();
+  803995:	e8 0e c8 ff ff       	call   8001a8 <exit>
+  80399a:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80399f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8039a6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8039a9:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8039b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8039b3:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8039b6:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8039bd:	83 ec 08             	sub    $0x8,%esp
+  8039c0:	6a 20                	push   $0x20
+  8039c2:	01 c2                	add    %eax,%edx
+  8039c4:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8039cb:	50                   	push   %eax
+  8039cc:	e8 40 d6 ff ff       	call   801011 <sys_futex_wake>
+	sys_env_destroy(0);
+  8039d1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8039d8:	e8 4d d2 ff ff       	call   800c2a <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8039dd:	83 c4 0c             	add    $0xc,%esp
+  8039e0:	68 86 4e 80 00       	push   $0x804e86
+  8039e5:	68 a5 00 00 00       	push   $0xa5
+  8039ea:	68 a0 4e 80 00       	push   $0x804ea0
+  8039ef:	e8 dc c7 ff ff       	call   8001d0 <_panic>
+
+008039f4 <pthread_start>:
+{
+  8039f4:	55                   	push   %ebp
+  8039f5:	89 e5                	mov    %esp,%ebp
+  8039f7:	53                   	push   %ebx
+  8039f8:	83 ec 04             	sub    $0x4,%esp
+  8039fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8039fe:	e8 72 d2 ff ff       	call   800c75 <sys_getenvid>
+  803a03:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803a08:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+	if (t == 0)
+  803a0e:	85 db                	test   %ebx,%ebx
+  803a10:	74 0c                	je     803a1e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a12:	89 d9                	mov    %ebx,%ecx
+  803a14:	c1 e1 10             	shl    $0x10,%ecx
+  803a17:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803a1c:	29 ca                	sub    %ecx,%edx
+  803a1e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803a21:	c1 e0 04             	shl    $0x4,%eax
+  803a24:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a29:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803a2b:	83 ec 0c             	sub    $0xc,%esp
+  803a2e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803a35:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803a38:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803a3f:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803a46:	89 04 24             	mov    %eax,(%esp)
+  803a49:	e8 25 ff ff ff       	call   803973 <pthread_exit>
+
+00803a4e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803a4e:	55                   	push   %ebp
+  803a4f:	89 e5                	mov    %esp,%ebp
+  803a51:	57                   	push   %edi
+  803a52:	56                   	push   %esi
+  803a53:	53                   	push   %ebx
+  803a54:	83 ec 1c             	sub    $0x1c,%esp
+  803a57:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a59:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803a5f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a66:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a6b:	77 0d                	ja     803a7a <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a6d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a72:	29 d0                	sub    %edx,%eax
+  803a74:	c1 e8 10             	shr    $0x10,%eax
+  803a77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a7f:	eb 2f                	jmp    803ab0 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803a81:	8b 0d c0 92 80 00    	mov    0x8092c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a87:	8b 01                	mov    (%ecx),%eax
+  803a89:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803a8c:	39 c2                	cmp    %eax,%edx
+  803a8e:	75 14                	jne    803aa4 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803a90:	83 ec 0c             	sub    $0xc,%esp
+  803a93:	57                   	push   %edi
+  803a94:	e8 91 d1 ff ff       	call   800c2a <sys_env_destroy>
+  803a99:	83 c4 10             	add    $0x10,%esp
+  803a9c:	85 c0                	test   %eax,%eax
+  803a9e:	0f 88 97 00 00 00    	js     803b3b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803aa4:	83 c3 01             	add    $0x1,%ebx
+  803aa7:	83 fb 20             	cmp    $0x20,%ebx
+  803aaa:	0f 84 d2 00 00 00    	je     803b82 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803ab0:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803ab3:	74 ef                	je     803aa4 <pthread_kill_others+0x56>
+  803ab5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ab8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803abf:	8b 40 04             	mov    0x4(%eax),%eax
+  803ac2:	83 f8 01             	cmp    $0x1,%eax
+  803ac5:	75 dd                	jne    803aa4 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803ac7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803aca:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803ad1:	89 fe                	mov    %edi,%esi
+  803ad3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803ad9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803adc:	c1 e0 04             	shl    $0x4,%eax
+  803adf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ae4:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803ae7:	39 c7                	cmp    %eax,%edi
+  803ae9:	75 b9                	jne    803aa4 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803aeb:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803aee:	c1 e0 04             	shl    $0x4,%eax
+  803af1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803af6:	8b 40 54             	mov    0x54(%eax),%eax
+  803af9:	85 c0                	test   %eax,%eax
+  803afb:	74 a7                	je     803aa4 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803afd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803b00:	c1 e0 04             	shl    $0x4,%eax
+  803b03:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803b09:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b0b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803b11:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b16:	0f 87 65 ff ff ff    	ja     803a81 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b1c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b21:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803b23:	c1 e8 10             	shr    $0x10,%eax
+  803b26:	0f 84 55 ff ff ff    	je     803a81 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b2c:	c1 e0 10             	shl    $0x10,%eax
+  803b2f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803b34:	29 c1                	sub    %eax,%ecx
+  803b36:	e9 4c ff ff ff       	jmp    803a87 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803b3b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803b3e:	c1 e2 04             	shl    $0x4,%edx
+  803b41:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b47:	8b 52 48             	mov    0x48(%edx),%edx
+  803b4a:	39 fa                	cmp    %edi,%edx
+  803b4c:	0f 85 52 ff ff ff    	jne    803aa4 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803b52:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803b55:	c1 e2 04             	shl    $0x4,%edx
+  803b58:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b5e:	8b 52 54             	mov    0x54(%edx),%edx
+  803b61:	85 d2                	test   %edx,%edx
+  803b63:	0f 84 3b ff ff ff    	je     803aa4 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803b69:	83 ec 0c             	sub    $0xc,%esp
+  803b6c:	50                   	push   %eax
+  803b6d:	57                   	push   %edi
+  803b6e:	68 b0 4e 80 00       	push   $0x804eb0
+  803b73:	68 bb 00 00 00       	push   $0xbb
+  803b78:	68 a0 4e 80 00       	push   $0x804ea0
+  803b7d:	e8 4e c6 ff ff       	call   8001d0 <_panic>
+	}
+}
+  803b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b85:	5b                   	pop    %ebx
+  803b86:	5e                   	pop    %esi
+  803b87:	5f                   	pop    %edi
+  803b88:	5d                   	pop    %ebp
+  803b89:	c3                   	ret
+
+00803b8a <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803b8a:	55                   	push   %ebp
+  803b8b:	89 e5                	mov    %esp,%ebp
+  803b8d:	53                   	push   %ebx
+  803b8e:	83 ec 04             	sub    $0x4,%esp
+  803b91:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b93:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803b99:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803b9f:	0f 87 85 00 00 00    	ja     803c2a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ba5:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803baa:	29 c3                	sub    %eax,%ebx
+  803bac:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803baf:	83 ec 04             	sub    $0x4,%esp
+  803bb2:	68 80 02 00 00       	push   $0x280
+  803bb7:	6a 00                	push   $0x0
+  803bb9:	68 40 70 80 00       	push   $0x807040
+  803bbe:	e8 1d ce ff ff       	call   8009e0 <memset>
+	threads_mu.m_state = 0;
+  803bc3:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803bca:	00 00 00 
+	if (self != 0) {
+  803bcd:	83 c4 10             	add    $0x10,%esp
+  803bd0:	85 db                	test   %ebx,%ebx
+  803bd2:	74 51                	je     803c25 <pthread_fork_child+0x9b>
+  803bd4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803bd6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803bdc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803be1:	77 18                	ja     803bfb <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803be3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803be8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803bea:	c1 e8 10             	shr    $0x10,%eax
+  803bed:	74 0c                	je     803bfb <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803bef:	c1 e0 10             	shl    $0x10,%eax
+  803bf2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803bf7:	29 c2                	sub    %eax,%edx
+  803bf9:	eb 06                	jmp    803c01 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803bfb:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803c01:	8b 02                	mov    (%edx),%eax
+  803c03:	8b 48 48             	mov    0x48(%eax),%ecx
+  803c06:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c0d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803c10:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803c17:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803c1e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803c25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c28:	c9                   	leave
+  803c29:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803c2a:	83 ec 04             	sub    $0x4,%esp
+  803c2d:	68 80 02 00 00       	push   $0x280
+  803c32:	6a 00                	push   $0x0
+  803c34:	68 40 70 80 00       	push   $0x807040
+  803c39:	e8 a2 cd ff ff       	call   8009e0 <memset>
+	threads_mu.m_state = 0;
+  803c3e:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803c45:	00 00 00 
+  803c48:	83 c4 10             	add    $0x10,%esp
+  803c4b:	eb d8                	jmp    803c25 <pthread_fork_child+0x9b>
+
+00803c4d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c52:	c3                   	ret
+
+00803c53 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c53:	55                   	push   %ebp
+  803c54:	89 e5                	mov    %esp,%ebp
+  803c56:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803c59:	68 d5 4e 80 00       	push   $0x804ed5
+  803c5e:	ff 75 0c             	push   0xc(%ebp)
+  803c61:	e8 29 cc ff ff       	call   80088f <strcpy>
+	return 0;
+}
+  803c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c6b:	c9                   	leave
+  803c6c:	c3                   	ret
+
+00803c6d <devcons_write>:
+{
+  803c6d:	55                   	push   %ebp
+  803c6e:	89 e5                	mov    %esp,%ebp
+  803c70:	57                   	push   %edi
+  803c71:	56                   	push   %esi
+  803c72:	53                   	push   %ebx
+  803c73:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803c79:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803c7e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803c84:	eb 2e                	jmp    803cb4 <devcons_write+0x47>
+		m = n - tot;
+  803c86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c89:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803c8b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c90:	39 c3                	cmp    %eax,%ebx
+  803c92:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c95:	83 ec 04             	sub    $0x4,%esp
+  803c98:	53                   	push   %ebx
+  803c99:	89 f0                	mov    %esi,%eax
+  803c9b:	03 45 0c             	add    0xc(%ebp),%eax
+  803c9e:	50                   	push   %eax
+  803c9f:	57                   	push   %edi
+  803ca0:	e8 70 cd ff ff       	call   800a15 <memmove>
+		sys_cputs(buf, m);
+  803ca5:	83 c4 08             	add    $0x8,%esp
+  803ca8:	53                   	push   %ebx
+  803ca9:	57                   	push   %edi
+  803caa:	e8 24 cf ff ff       	call   800bd3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803caf:	01 de                	add    %ebx,%esi
+  803cb1:	83 c4 10             	add    $0x10,%esp
+  803cb4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803cb7:	72 cd                	jb     803c86 <devcons_write+0x19>
+}
+  803cb9:	89 f0                	mov    %esi,%eax
+  803cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cbe:	5b                   	pop    %ebx
+  803cbf:	5e                   	pop    %esi
+  803cc0:	5f                   	pop    %edi
+  803cc1:	5d                   	pop    %ebp
+  803cc2:	c3                   	ret
+
+00803cc3 <devcons_read>:
+{
+  803cc3:	55                   	push   %ebp
+  803cc4:	89 e5                	mov    %esp,%ebp
+  803cc6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803cd2:	75 07                	jne    803cdb <devcons_read+0x18>
+  803cd4:	eb 1f                	jmp    803cf5 <devcons_read+0x32>
+		sys_yield();
+  803cd6:	e8 c6 cf ff ff       	call   800ca1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803cdb:	e8 1e cf ff ff       	call   800bfe <sys_cgetc>
+  803ce0:	85 c0                	test   %eax,%eax
+  803ce2:	74 f2                	je     803cd6 <devcons_read+0x13>
+	if (c < 0)
+  803ce4:	78 0f                	js     803cf5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803ce6:	83 f8 04             	cmp    $0x4,%eax
+  803ce9:	74 0c                	je     803cf7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ceb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cee:	88 02                	mov    %al,(%edx)
+	return 1;
+  803cf0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803cf5:	c9                   	leave
+  803cf6:	c3                   	ret
+		return 0;
+  803cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cfc:	eb f7                	jmp    803cf5 <devcons_read+0x32>
+
+00803cfe <cputchar>:
+{
+  803cfe:	55                   	push   %ebp
+  803cff:	89 e5                	mov    %esp,%ebp
+  803d01:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d07:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803d0a:	6a 01                	push   $0x1
+  803d0c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d0f:	50                   	push   %eax
+  803d10:	e8 be ce ff ff       	call   800bd3 <sys_cputs>
+}
+  803d15:	83 c4 10             	add    $0x10,%esp
+  803d18:	c9                   	leave
+  803d19:	c3                   	ret
+
+00803d1a <getchar>:
+{
+  803d1a:	55                   	push   %ebp
+  803d1b:	89 e5                	mov    %esp,%ebp
+  803d1d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803d20:	6a 01                	push   $0x1
+  803d22:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d25:	50                   	push   %eax
+  803d26:	6a 00                	push   $0x0
+  803d28:	e8 4f d7 ff ff       	call   80147c <read>
+	if (r < 0)
+  803d2d:	83 c4 10             	add    $0x10,%esp
+  803d30:	85 c0                	test   %eax,%eax
+  803d32:	78 06                	js     803d3a <getchar+0x20>
+	if (r < 1)
+  803d34:	74 06                	je     803d3c <getchar+0x22>
+	return c;
+  803d36:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803d3a:	c9                   	leave
+  803d3b:	c3                   	ret
+		return -E_EOF;
+  803d3c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d41:	eb f7                	jmp    803d3a <getchar+0x20>
+
+00803d43 <iscons>:
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d4c:	50                   	push   %eax
+  803d4d:	ff 75 08             	push   0x8(%ebp)
+  803d50:	e8 97 d4 ff ff       	call   8011ec <fd_lookup>
+  803d55:	83 c4 10             	add    $0x10,%esp
+  803d58:	85 c0                	test   %eax,%eax
+  803d5a:	78 11                	js     803d6d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d5f:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803d65:	39 10                	cmp    %edx,(%eax)
+  803d67:	0f 94 c0             	sete   %al
+  803d6a:	0f b6 c0             	movzbl %al,%eax
+}
+  803d6d:	c9                   	leave
+  803d6e:	c3                   	ret
+
+00803d6f <opencons>:
+{
+  803d6f:	55                   	push   %ebp
+  803d70:	89 e5                	mov    %esp,%ebp
+  803d72:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803d75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d78:	50                   	push   %eax
+  803d79:	e8 18 d4 ff ff       	call   801196 <fd_alloc>
+  803d7e:	83 c4 10             	add    $0x10,%esp
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	78 3a                	js     803dbf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803d85:	83 ec 04             	sub    $0x4,%esp
+  803d88:	68 07 04 00 00       	push   $0x407
+  803d8d:	ff 75 f4             	push   -0xc(%ebp)
+  803d90:	6a 00                	push   $0x0
+  803d92:	e8 36 cf ff ff       	call   800ccd <sys_page_alloc>
+  803d97:	83 c4 10             	add    $0x10,%esp
+  803d9a:	85 c0                	test   %eax,%eax
+  803d9c:	78 21                	js     803dbf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803da1:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803da7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803da9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dac:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803db3:	83 ec 0c             	sub    $0xc,%esp
+  803db6:	50                   	push   %eax
+  803db7:	e8 b3 d3 ff ff       	call   80116f <fd2num>
+  803dbc:	83 c4 10             	add    $0x10,%esp
+}
+  803dbf:	c9                   	leave
+  803dc0:	c3                   	ret
+
+00803dc1 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803dc1:	55                   	push   %ebp
+  803dc2:	89 e5                	mov    %esp,%ebp
+  803dc4:	57                   	push   %edi
+  803dc5:	56                   	push   %esi
+  803dc6:	53                   	push   %ebx
+  803dc7:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803dca:	89 d6                	mov    %edx,%esi
+  803dcc:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803dcf:	89 cf                	mov    %ecx,%edi
+  803dd1:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803dd4:	89 fa                	mov    %edi,%edx
+  803dd6:	80 ce 08             	or     $0x8,%dh
+  803dd9:	f6 c5 08             	test   $0x8,%ch
+  803ddc:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803ddf:	57                   	push   %edi
+  803de0:	56                   	push   %esi
+  803de1:	50                   	push   %eax
+  803de2:	56                   	push   %esi
+  803de3:	6a 00                	push   $0x0
+  803de5:	e8 30 cf ff ff       	call   800d1a <sys_page_map>
+	if (r < 0) {
+  803dea:	83 c4 20             	add    $0x20,%esp
+  803ded:	85 c0                	test   %eax,%eax
+  803def:	78 27                	js     803e18 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803df1:	83 ec 0c             	sub    $0xc,%esp
+  803df4:	57                   	push   %edi
+  803df5:	56                   	push   %esi
+  803df6:	6a 00                	push   $0x0
+  803df8:	56                   	push   %esi
+  803df9:	6a 00                	push   $0x0
+  803dfb:	e8 1a cf ff ff       	call   800d1a <sys_page_map>
+  803e00:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e02:	83 c4 20             	add    $0x20,%esp
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	78 24                	js     803e2d <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e0e:	89 d8                	mov    %ebx,%eax
+  803e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e13:	5b                   	pop    %ebx
+  803e14:	5e                   	pop    %esi
+  803e15:	5f                   	pop    %edi
+  803e16:	5d                   	pop    %ebp
+  803e17:	c3                   	ret
+  803e18:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e1a:	83 ec 08             	sub    $0x8,%esp
+  803e1d:	50                   	push   %eax
+  803e1e:	68 e4 4e 80 00       	push   $0x804ee4
+  803e23:	e8 83 c4 ff ff       	call   8002ab <cprintf>
+		return r;
+  803e28:	83 c4 10             	add    $0x10,%esp
+  803e2b:	eb e1                	jmp    803e0e <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803e2d:	83 ec 08             	sub    $0x8,%esp
+  803e30:	50                   	push   %eax
+  803e31:	68 14 4f 80 00       	push   $0x804f14
+  803e36:	e8 70 c4 ff ff       	call   8002ab <cprintf>
+		return r;
+  803e3b:	83 c4 10             	add    $0x10,%esp
+  803e3e:	eb ce                	jmp    803e0e <duppage_cow+0x4d>
+
+00803e40 <duppage>:
+{
+  803e40:	55                   	push   %ebp
+  803e41:	89 e5                	mov    %esp,%ebp
+  803e43:	53                   	push   %ebx
+  803e44:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803e47:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803e4a:	51                   	push   %ecx
+  803e4b:	52                   	push   %edx
+  803e4c:	50                   	push   %eax
+  803e4d:	52                   	push   %edx
+  803e4e:	6a 00                	push   $0x0
+  803e50:	e8 c5 ce ff ff       	call   800d1a <sys_page_map>
+	if (r < 0) {
+  803e55:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803e58:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803e5d:	85 c0                	test   %eax,%eax
+  803e5f:	78 07                	js     803e68 <duppage+0x28>
+}
+  803e61:	89 d8                	mov    %ebx,%eax
+  803e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e66:	c9                   	leave
+  803e67:	c3                   	ret
+  803e68:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e6a:	83 ec 08             	sub    $0x8,%esp
+  803e6d:	50                   	push   %eax
+  803e6e:	68 e4 4e 80 00       	push   $0x804ee4
+  803e73:	e8 33 c4 ff ff       	call   8002ab <cprintf>
+		return r;
+  803e78:	83 c4 10             	add    $0x10,%esp
+  803e7b:	eb e4                	jmp    803e61 <duppage+0x21>
+
+00803e7d <cow_copy>:
+{
+  803e7d:	55                   	push   %ebp
+  803e7e:	89 e5                	mov    %esp,%ebp
+  803e80:	56                   	push   %esi
+  803e81:	53                   	push   %ebx
+  803e82:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803e84:	83 ec 04             	sub    $0x4,%esp
+  803e87:	6a 07                	push   $0x7
+  803e89:	68 00 f0 7f 00       	push   $0x7ff000
+  803e8e:	6a 00                	push   $0x0
+  803e90:	e8 38 ce ff ff       	call   800ccd <sys_page_alloc>
+	if (r < 0) {
+  803e95:	83 c4 10             	add    $0x10,%esp
+  803e98:	85 c0                	test   %eax,%eax
+  803e9a:	78 58                	js     803ef4 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803e9c:	83 ec 04             	sub    $0x4,%esp
+  803e9f:	68 00 10 00 00       	push   $0x1000
+  803ea4:	56                   	push   %esi
+  803ea5:	68 00 f0 7f 00       	push   $0x7ff000
+  803eaa:	e8 66 cb ff ff       	call   800a15 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803eaf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803eb6:	56                   	push   %esi
+  803eb7:	6a 00                	push   $0x0
+  803eb9:	68 00 f0 7f 00       	push   $0x7ff000
+  803ebe:	6a 00                	push   $0x0
+  803ec0:	e8 55 ce ff ff       	call   800d1a <sys_page_map>
+  803ec5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ec7:	83 c4 20             	add    $0x20,%esp
+  803eca:	85 c0                	test   %eax,%eax
+  803ecc:	78 3b                	js     803f09 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803ece:	83 ec 08             	sub    $0x8,%esp
+  803ed1:	68 00 f0 7f 00       	push   $0x7ff000
+  803ed6:	6a 00                	push   $0x0
+  803ed8:	e8 89 ce ff ff       	call   800d66 <sys_page_unmap>
+  803edd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803edf:	83 c4 10             	add    $0x10,%esp
+  803ee2:	85 c0                	test   %eax,%eax
+  803ee4:	78 45                	js     803f2b <cow_copy+0xae>
+	return 0;
+  803ee6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803eeb:	89 d8                	mov    %ebx,%eax
+  803eed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ef0:	5b                   	pop    %ebx
+  803ef1:	5e                   	pop    %esi
+  803ef2:	5d                   	pop    %ebp
+  803ef3:	c3                   	ret
+  803ef4:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803ef6:	83 ec 08             	sub    $0x8,%esp
+  803ef9:	50                   	push   %eax
+  803efa:	68 04 50 80 00       	push   $0x805004
+  803eff:	e8 a7 c3 ff ff       	call   8002ab <cprintf>
+		return r;
+  803f04:	83 c4 10             	add    $0x10,%esp
+  803f07:	eb e2                	jmp    803eeb <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803f09:	83 ec 08             	sub    $0x8,%esp
+  803f0c:	50                   	push   %eax
+  803f0d:	68 20 50 80 00       	push   $0x805020
+  803f12:	e8 94 c3 ff ff       	call   8002ab <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803f17:	83 c4 08             	add    $0x8,%esp
+  803f1a:	68 00 f0 7f 00       	push   $0x7ff000
+  803f1f:	6a 00                	push   $0x0
+  803f21:	e8 40 ce ff ff       	call   800d66 <sys_page_unmap>
+		return r;
+  803f26:	83 c4 10             	add    $0x10,%esp
+  803f29:	eb c0                	jmp    803eeb <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803f2b:	83 ec 08             	sub    $0x8,%esp
+  803f2e:	50                   	push   %eax
+  803f2f:	68 3c 4f 80 00       	push   $0x804f3c
+  803f34:	e8 72 c3 ff ff       	call   8002ab <cprintf>
+		return r;
+  803f39:	83 c4 10             	add    $0x10,%esp
+  803f3c:	eb ad                	jmp    803eeb <cow_copy+0x6e>
+
+00803f3e <pgfault>:
+{
+  803f3e:	55                   	push   %ebp
+  803f3f:	89 e5                	mov    %esp,%ebp
+  803f41:	56                   	push   %esi
+  803f42:	53                   	push   %ebx
+  803f43:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803f46:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803f48:	89 d8                	mov    %ebx,%eax
+  803f4a:	c1 e8 16             	shr    $0x16,%eax
+  803f4d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803f54:	89 de                	mov    %ebx,%esi
+  803f56:	c1 ee 0c             	shr    $0xc,%esi
+  803f59:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803f60:	a8 07                	test   $0x7,%al
+  803f62:	74 3b                	je     803f9f <pgfault+0x61>
+  803f64:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803f6a:	74 33                	je     803f9f <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803f6c:	83 ec 0c             	sub    $0xc,%esp
+  803f6f:	68 00 f0 bf ee       	push   $0xeebff000
+  803f74:	e8 c8 f4 ff ff       	call   803441 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803f79:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803f80:	83 c4 10             	add    $0x10,%esp
+  803f83:	f6 c4 08             	test   $0x8,%ah
+  803f86:	75 30                	jne    803fb8 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803f88:	83 ec 0c             	sub    $0xc,%esp
+  803f8b:	68 00 f0 bf ee       	push   $0xeebff000
+  803f90:	e8 19 f5 ff ff       	call   8034ae <mutex_unlock>
+}
+  803f95:	83 c4 10             	add    $0x10,%esp
+  803f98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f9b:	5b                   	pop    %ebx
+  803f9c:	5e                   	pop    %esi
+  803f9d:	5d                   	pop    %ebp
+  803f9e:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803f9f:	83 ec 08             	sub    $0x8,%esp
+  803fa2:	ff 72 28             	push   0x28(%edx)
+  803fa5:	51                   	push   %ecx
+  803fa6:	50                   	push   %eax
+  803fa7:	68 60 4f 80 00       	push   $0x804f60
+  803fac:	6a 3f                	push   $0x3f
+  803fae:	68 3a 50 80 00       	push   $0x80503a
+  803fb3:	e8 18 c2 ff ff       	call   8001d0 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803fb8:	89 d8                	mov    %ebx,%eax
+  803fba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803fbf:	e8 b9 fe ff ff       	call   803e7d <cow_copy>
+  803fc4:	eb c2                	jmp    803f88 <pgfault+0x4a>
+
+00803fc6 <cow_enable>:
+{
+  803fc6:	55                   	push   %ebp
+  803fc7:	89 e5                	mov    %esp,%ebp
+  803fc9:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803fcc:	68 3e 3f 80 00       	push   $0x803f3e
+  803fd1:	e8 28 06 00 00       	call   8045fe <set_pgfault_handler>
+}
+  803fd6:	83 c4 10             	add    $0x10,%esp
+  803fd9:	c9                   	leave
+  803fda:	c3                   	ret
+
+00803fdb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803fdb:	55                   	push   %ebp
+  803fdc:	89 e5                	mov    %esp,%ebp
+  803fde:	57                   	push   %edi
+  803fdf:	56                   	push   %esi
+  803fe0:	53                   	push   %ebx
+  803fe1:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803fe4:	68 3e 3f 80 00       	push   $0x803f3e
+  803fe9:	e8 10 06 00 00       	call   8045fe <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803fee:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ff3:	cd 30                	int    $0x30
+  803ff5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803ff8:	83 c4 10             	add    $0x10,%esp
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	78 4b                	js     80404a <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803fff:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804004:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804009:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80400c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804010:	0f 85 16 01 00 00    	jne    80412c <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804016:	e8 5a cc ff ff       	call   800c75 <sys_getenvid>
+  80401b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804020:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804022:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  804028:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80402e:	77 32                	ja     804062 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804030:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804035:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  804037:	c1 ea 10             	shr    $0x10,%edx
+  80403a:	74 26                	je     804062 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80403c:	c1 e2 10             	shl    $0x10,%edx
+  80403f:	89 d1                	mov    %edx,%ecx
+  804041:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804046:	29 ca                	sub    %ecx,%edx
+  804048:	eb 1e                	jmp    804068 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80404a:	83 ec 08             	sub    $0x8,%esp
+  80404d:	89 c7                	mov    %eax,%edi
+  80404f:	50                   	push   %eax
+  804050:	68 45 50 80 00       	push   $0x805045
+  804055:	e8 51 c2 ff ff       	call   8002ab <cprintf>
+		return eid;
+  80405a:	83 c4 10             	add    $0x10,%esp
+  80405d:	e9 6c 01 00 00       	jmp    8041ce <fork+0x1f3>
+		return pthread_main_tls;
+  804062:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804068:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80406b:	c1 e0 04             	shl    $0x4,%eax
+  80406e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804073:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804075:	e8 10 fb ff ff       	call   803b8a <pthread_fork_child>
+		return eid;
+  80407a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80407d:	e9 4c 01 00 00       	jmp    8041ce <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804082:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804088:	89 da                	mov    %ebx,%edx
+  80408a:	89 f8                	mov    %edi,%eax
+  80408c:	e8 af fd ff ff       	call   803e40 <duppage>
+  804091:	85 c0                	test   %eax,%eax
+  804093:	79 28                	jns    8040bd <fork+0xe2>
+  804095:	89 c7                	mov    %eax,%edi
+  804097:	e9 32 01 00 00       	jmp    8041ce <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80409c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040a2:	83 f9 05             	cmp    $0x5,%ecx
+  8040a5:	75 58                	jne    8040ff <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040a7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8040ac:	89 da                	mov    %ebx,%edx
+  8040ae:	89 f8                	mov    %edi,%eax
+  8040b0:	e8 8b fd ff ff       	call   803e40 <duppage>
+  8040b5:	85 c0                	test   %eax,%eax
+  8040b7:	0f 88 0f 01 00 00    	js     8041cc <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040bd:	83 c3 01             	add    $0x1,%ebx
+  8040c0:	39 de                	cmp    %ebx,%esi
+  8040c2:	74 54                	je     804118 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8040c4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8040cb:	f6 c1 05             	test   $0x5,%cl
+  8040ce:	74 ed                	je     8040bd <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8040d0:	f6 c5 04             	test   $0x4,%ch
+  8040d3:	75 ad                	jne    804082 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8040d5:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8040db:	74 bf                	je     80409c <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040dd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040e3:	74 d8                	je     8040bd <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8040e5:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8040eb:	89 da                	mov    %ebx,%edx
+  8040ed:	89 f8                	mov    %edi,%eax
+  8040ef:	e8 cd fc ff ff       	call   803dc1 <duppage_cow>
+  8040f4:	85 c0                	test   %eax,%eax
+  8040f6:	79 c5                	jns    8040bd <fork+0xe2>
+  8040f8:	89 c7                	mov    %eax,%edi
+  8040fa:	e9 cf 00 00 00       	jmp    8041ce <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8040ff:	68 90 4f 80 00       	push   $0x804f90
+  804104:	68 9d 4d 80 00       	push   $0x804d9d
+  804109:	68 c6 00 00 00       	push   $0xc6
+  80410e:	68 3a 50 80 00       	push   $0x80503a
+  804113:	e8 b8 c0 ff ff       	call   8001d0 <_panic>
+  804118:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80411b:	83 c1 01             	add    $0x1,%ecx
+  80411e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804124:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80412a:	74 18                	je     804144 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80412c:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804133:	a8 07                	test   $0x7,%al
+  804135:	74 e4                	je     80411b <fork+0x140>
+  804137:	89 cb                	mov    %ecx,%ebx
+  804139:	c1 e3 0a             	shl    $0xa,%ebx
+  80413c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80413f:	e9 7c ff ff ff       	jmp    8040c0 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804144:	83 ec 04             	sub    $0x4,%esp
+  804147:	6a 07                	push   $0x7
+  804149:	68 00 f0 bf ee       	push   $0xeebff000
+  80414e:	ff 75 e4             	push   -0x1c(%ebp)
+  804151:	e8 77 cb ff ff       	call   800ccd <sys_page_alloc>
+  804156:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804158:	83 c4 10             	add    $0x10,%esp
+  80415b:	85 c0                	test   %eax,%eax
+  80415d:	78 34                	js     804193 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80415f:	83 ec 08             	sub    $0x8,%esp
+  804162:	68 3c 46 80 00       	push   $0x80463c
+  804167:	ff 75 e4             	push   -0x1c(%ebp)
+  80416a:	e8 db cc ff ff       	call   800e4a <sys_env_set_pgfault_upcall>
+  80416f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804171:	83 c4 10             	add    $0x10,%esp
+  804174:	85 c0                	test   %eax,%eax
+  804176:	78 2e                	js     8041a6 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804178:	83 ec 08             	sub    $0x8,%esp
+  80417b:	6a 02                	push   $0x2
+  80417d:	ff 75 e4             	push   -0x1c(%ebp)
+  804180:	e8 2d cc ff ff       	call   800db2 <sys_env_set_status>
+  804185:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804187:	83 c4 10             	add    $0x10,%esp
+  80418a:	85 c0                	test   %eax,%eax
+  80418c:	78 2b                	js     8041b9 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80418e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804191:	eb 3b                	jmp    8041ce <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804193:	83 ec 08             	sub    $0x8,%esp
+  804196:	50                   	push   %eax
+  804197:	68 b8 4f 80 00       	push   $0x804fb8
+  80419c:	e8 0a c1 ff ff       	call   8002ab <cprintf>
+		return r;
+  8041a1:	83 c4 10             	add    $0x10,%esp
+  8041a4:	eb 28                	jmp    8041ce <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041a6:	83 ec 08             	sub    $0x8,%esp
+  8041a9:	50                   	push   %eax
+  8041aa:	68 e0 4f 80 00       	push   $0x804fe0
+  8041af:	e8 f7 c0 ff ff       	call   8002ab <cprintf>
+		return r;
+  8041b4:	83 c4 10             	add    $0x10,%esp
+  8041b7:	eb 15                	jmp    8041ce <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8041b9:	83 ec 08             	sub    $0x8,%esp
+  8041bc:	50                   	push   %eax
+  8041bd:	68 55 50 80 00       	push   $0x805055
+  8041c2:	e8 e4 c0 ff ff       	call   8002ab <cprintf>
+		return r;
+  8041c7:	83 c4 10             	add    $0x10,%esp
+  8041ca:	eb 02                	jmp    8041ce <fork+0x1f3>
+  8041cc:	89 c7                	mov    %eax,%edi
+}
+  8041ce:	89 f8                	mov    %edi,%eax
+  8041d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041d3:	5b                   	pop    %ebx
+  8041d4:	5e                   	pop    %esi
+  8041d5:	5f                   	pop    %edi
+  8041d6:	5d                   	pop    %ebp
+  8041d7:	c3                   	ret
+
+008041d8 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8041d8:	55                   	push   %ebp
+  8041d9:	89 e5                	mov    %esp,%ebp
+  8041db:	57                   	push   %edi
+  8041dc:	56                   	push   %esi
+  8041dd:	53                   	push   %ebx
+  8041de:	83 ec 2c             	sub    $0x2c,%esp
+  8041e1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041e3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8041e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041ee:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8041f4:	77 0a                	ja     804200 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041f6:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8041fb:	29 c3                	sub    %eax,%ebx
+  8041fd:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804200:	83 ec 0c             	sub    $0xc,%esp
+  804203:	68 3e 3f 80 00       	push   $0x803f3e
+  804208:	e8 f1 03 00 00       	call   8045fe <set_pgfault_handler>
+  80420d:	b8 07 00 00 00       	mov    $0x7,%eax
+  804212:	cd 30                	int    $0x30
+  804214:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804217:	83 c4 10             	add    $0x10,%esp
+  80421a:	85 c0                	test   %eax,%eax
+  80421c:	78 30                	js     80424e <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80421e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804222:	74 42                	je     804266 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804224:	c1 e3 10             	shl    $0x10,%ebx
+  804227:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80422c:	29 d8                	sub    %ebx,%eax
+  80422e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804231:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804236:	29 d8                	sub    %ebx,%eax
+  804238:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80423b:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804240:	ba 00 00 00 00       	mov    $0x0,%edx
+  804245:	89 f7                	mov    %esi,%edi
+  804247:	89 d6                	mov    %edx,%esi
+  804249:	e9 2c 01 00 00       	jmp    80437a <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80424e:	83 ec 08             	sub    $0x8,%esp
+  804251:	89 c7                	mov    %eax,%edi
+  804253:	50                   	push   %eax
+  804254:	68 45 50 80 00       	push   $0x805045
+  804259:	e8 4d c0 ff ff       	call   8002ab <cprintf>
+		return eid;
+  80425e:	83 c4 10             	add    $0x10,%esp
+  804261:	e9 d5 00 00 00       	jmp    80433b <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804266:	e8 0a ca ff ff       	call   800c75 <sys_getenvid>
+  80426b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804270:	89 c2                	mov    %eax,%edx
+  804272:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804274:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80427a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80427f:	77 18                	ja     804299 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804281:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804286:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804288:	c1 e8 10             	shr    $0x10,%eax
+  80428b:	74 0c                	je     804299 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80428d:	c1 e0 10             	shl    $0x10,%eax
+  804290:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804295:	29 c1                	sub    %eax,%ecx
+  804297:	eb 06                	jmp    80429f <sfork+0xc7>
+		return pthread_main_tls;
+  804299:	8b 0d c0 92 80 00    	mov    0x8092c0,%ecx
+  80429f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8042a2:	c1 e0 04             	shl    $0x4,%eax
+  8042a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042aa:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8042ac:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8042af:	e9 87 00 00 00       	jmp    80433b <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8042b4:	f6 c5 04             	test   $0x4,%ch
+  8042b7:	74 6c                	je     804325 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8042b9:	89 ca                	mov    %ecx,%edx
+  8042bb:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8042c1:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8042c7:	74 7c                	je     804345 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8042c9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8042cf:	89 da                	mov    %ebx,%edx
+  8042d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8042d4:	e8 67 fb ff ff       	call   803e40 <duppage>
+  8042d9:	85 c0                	test   %eax,%eax
+  8042db:	0f 88 4f 01 00 00    	js     804430 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8042e1:	83 c3 01             	add    $0x1,%ebx
+  8042e4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8042e7:	74 7a                	je     804363 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8042e9:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8042eb:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8042f2:	f6 c1 01             	test   $0x1,%cl
+  8042f5:	74 ea                	je     8042e1 <sfork+0x109>
+  8042f7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8042fd:	74 e2                	je     8042e1 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8042ff:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804305:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804308:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80430d:	76 a5                	jbe    8042b4 <sfork+0xdc>
+  80430f:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804315:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804318:	39 fa                	cmp    %edi,%edx
+  80431a:	73 9d                	jae    8042b9 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80431c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80431f:	39 fa                	cmp    %edi,%edx
+  804321:	72 96                	jb     8042b9 <sfork+0xe1>
+  804323:	eb 8f                	jmp    8042b4 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804325:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80432b:	89 da                	mov    %ebx,%edx
+  80432d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804330:	e8 8c fa ff ff       	call   803dc1 <duppage_cow>
+  804335:	85 c0                	test   %eax,%eax
+  804337:	79 a8                	jns    8042e1 <sfork+0x109>
+  804339:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80433b:	89 f8                	mov    %edi,%eax
+  80433d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804340:	5b                   	pop    %ebx
+  804341:	5e                   	pop    %esi
+  804342:	5f                   	pop    %edi
+  804343:	5d                   	pop    %ebp
+  804344:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804345:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80434a:	e8 2e fb ff ff       	call   803e7d <cow_copy>
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	0f 88 d2 00 00 00    	js     804429 <sfork+0x251>
+				pte = uvpt[pn];
+  804357:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80435e:	e9 66 ff ff ff       	jmp    8042c9 <sfork+0xf1>
+  804363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804366:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804369:	83 c6 01             	add    $0x1,%esi
+  80436c:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804372:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804378:	74 1b                	je     804395 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80437a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804381:	a8 01                	test   $0x1,%al
+  804383:	74 e4                	je     804369 <sfork+0x191>
+  804385:	89 f3                	mov    %esi,%ebx
+  804387:	c1 e3 0a             	shl    $0xa,%ebx
+  80438a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80438d:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804390:	e9 4f ff ff ff       	jmp    8042e4 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804395:	83 ec 04             	sub    $0x4,%esp
+  804398:	6a 07                	push   $0x7
+  80439a:	68 00 f0 bf ee       	push   $0xeebff000
+  80439f:	ff 75 e0             	push   -0x20(%ebp)
+  8043a2:	e8 26 c9 ff ff       	call   800ccd <sys_page_alloc>
+  8043a7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043a9:	83 c4 10             	add    $0x10,%esp
+  8043ac:	85 c0                	test   %eax,%eax
+  8043ae:	78 37                	js     8043e7 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8043b0:	83 ec 08             	sub    $0x8,%esp
+  8043b3:	68 3c 46 80 00       	push   $0x80463c
+  8043b8:	ff 75 e0             	push   -0x20(%ebp)
+  8043bb:	e8 8a ca ff ff       	call   800e4a <sys_env_set_pgfault_upcall>
+  8043c0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043c2:	83 c4 10             	add    $0x10,%esp
+  8043c5:	85 c0                	test   %eax,%eax
+  8043c7:	78 34                	js     8043fd <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8043c9:	83 ec 08             	sub    $0x8,%esp
+  8043cc:	6a 02                	push   $0x2
+  8043ce:	ff 75 e0             	push   -0x20(%ebp)
+  8043d1:	e8 dc c9 ff ff       	call   800db2 <sys_env_set_status>
+  8043d6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043d8:	83 c4 10             	add    $0x10,%esp
+  8043db:	85 c0                	test   %eax,%eax
+  8043dd:	78 34                	js     804413 <sfork+0x23b>
+	return eid;
+  8043df:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8043e2:	e9 54 ff ff ff       	jmp    80433b <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8043e7:	83 ec 08             	sub    $0x8,%esp
+  8043ea:	50                   	push   %eax
+  8043eb:	68 b8 4f 80 00       	push   $0x804fb8
+  8043f0:	e8 b6 be ff ff       	call   8002ab <cprintf>
+		return r;
+  8043f5:	83 c4 10             	add    $0x10,%esp
+  8043f8:	e9 3e ff ff ff       	jmp    80433b <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8043fd:	83 ec 08             	sub    $0x8,%esp
+  804400:	50                   	push   %eax
+  804401:	68 e0 4f 80 00       	push   $0x804fe0
+  804406:	e8 a0 be ff ff       	call   8002ab <cprintf>
+		return r;
+  80440b:	83 c4 10             	add    $0x10,%esp
+  80440e:	e9 28 ff ff ff       	jmp    80433b <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804413:	83 ec 08             	sub    $0x8,%esp
+  804416:	50                   	push   %eax
+  804417:	68 55 50 80 00       	push   $0x805055
+  80441c:	e8 8a be ff ff       	call   8002ab <cprintf>
+		return r;
+  804421:	83 c4 10             	add    $0x10,%esp
+  804424:	e9 12 ff ff ff       	jmp    80433b <sfork+0x163>
+  804429:	89 c7                	mov    %eax,%edi
+  80442b:	e9 0b ff ff ff       	jmp    80433b <sfork+0x163>
+  804430:	89 c7                	mov    %eax,%edi
+  804432:	e9 04 ff ff ff       	jmp    80433b <sfork+0x163>
+
+00804437 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804437:	55                   	push   %ebp
+  804438:	89 e5                	mov    %esp,%ebp
+  80443a:	57                   	push   %edi
+  80443b:	56                   	push   %esi
+  80443c:	53                   	push   %ebx
+  80443d:	83 ec 18             	sub    $0x18,%esp
+  804440:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804443:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804446:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804449:	85 c0                	test   %eax,%eax
+  80444b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804450:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804453:	50                   	push   %eax
+  804454:	e8 6a ca ff ff       	call   800ec3 <sys_ipc_recv>
+	if (r < 0) {
+  804459:	83 c4 10             	add    $0x10,%esp
+  80445c:	85 c0                	test   %eax,%eax
+  80445e:	78 2b                	js     80448b <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804460:	85 ff                	test   %edi,%edi
+  804462:	74 55                	je     8044b9 <ipc_recv+0x82>
+  804464:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804466:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80446c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804471:	77 39                	ja     8044ac <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804473:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804478:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80447a:	c1 e8 10             	shr    $0x10,%eax
+  80447d:	74 2d                	je     8044ac <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80447f:	c1 e0 10             	shl    $0x10,%eax
+  804482:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804487:	29 c2                	sub    %eax,%edx
+  804489:	eb 27                	jmp    8044b2 <ipc_recv+0x7b>
+  80448b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80448d:	83 ec 08             	sub    $0x8,%esp
+  804490:	50                   	push   %eax
+  804491:	68 73 50 80 00       	push   $0x805073
+  804496:	e8 10 be ff ff       	call   8002ab <cprintf>
+		*from_env_store = 0;
+  80449b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8044a1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8044a7:	83 c4 10             	add    $0x10,%esp
+  8044aa:	eb 77                	jmp    804523 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8044ac:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8044b2:	8b 02                	mov    (%edx),%eax
+  8044b4:	8b 40 78             	mov    0x78(%eax),%eax
+  8044b7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8044b9:	85 f6                	test   %esi,%esi
+  8044bb:	74 34                	je     8044f1 <ipc_recv+0xba>
+  8044bd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044bf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044ca:	77 18                	ja     8044e4 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044d1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044d3:	c1 e8 10             	shr    $0x10,%eax
+  8044d6:	74 0c                	je     8044e4 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044d8:	c1 e0 10             	shl    $0x10,%eax
+  8044db:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044e0:	29 c2                	sub    %eax,%edx
+  8044e2:	eb 06                	jmp    8044ea <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8044e4:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8044ea:	8b 02                	mov    (%edx),%eax
+  8044ec:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8044ef:	89 06                	mov    %eax,(%esi)
+  8044f1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044f3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044f9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044fe:	77 18                	ja     804518 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804500:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804505:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804507:	c1 e8 10             	shr    $0x10,%eax
+  80450a:	74 0c                	je     804518 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80450c:	c1 e0 10             	shl    $0x10,%eax
+  80450f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804514:	29 c2                	sub    %eax,%edx
+  804516:	eb 06                	jmp    80451e <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804518:	8b 15 c0 92 80 00    	mov    0x8092c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80451e:	8b 02                	mov    (%edx),%eax
+  804520:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804523:	89 d8                	mov    %ebx,%eax
+  804525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804528:	5b                   	pop    %ebx
+  804529:	5e                   	pop    %esi
+  80452a:	5f                   	pop    %edi
+  80452b:	5d                   	pop    %ebp
+  80452c:	c3                   	ret
+
+0080452d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80452d:	55                   	push   %ebp
+  80452e:	89 e5                	mov    %esp,%ebp
+  804530:	57                   	push   %edi
+  804531:	56                   	push   %esi
+  804532:	53                   	push   %ebx
+  804533:	83 ec 0c             	sub    $0xc,%esp
+  804536:	8b 75 08             	mov    0x8(%ebp),%esi
+  804539:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80453c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80453f:	85 db                	test   %ebx,%ebx
+  804541:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804546:	0f 44 d8             	cmove  %eax,%ebx
+  804549:	eb 05                	jmp    804550 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80454b:	e8 51 c7 ff ff       	call   800ca1 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804550:	57                   	push   %edi
+  804551:	53                   	push   %ebx
+  804552:	ff 75 0c             	push   0xc(%ebp)
+  804555:	56                   	push   %esi
+  804556:	e8 3b c9 ff ff       	call   800e96 <sys_ipc_try_send>
+		if (r == 0) {
+  80455b:	83 c4 10             	add    $0x10,%esp
+  80455e:	85 c0                	test   %eax,%eax
+  804560:	74 19                	je     80457b <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804562:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804565:	74 e4                	je     80454b <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804567:	83 ec 0c             	sub    $0xc,%esp
+  80456a:	50                   	push   %eax
+  80456b:	57                   	push   %edi
+  80456c:	53                   	push   %ebx
+  80456d:	56                   	push   %esi
+  80456e:	68 8c 50 80 00       	push   $0x80508c
+  804573:	e8 33 bd ff ff       	call   8002ab <cprintf>
+			return;
+  804578:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80457b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80457e:	5b                   	pop    %ebx
+  80457f:	5e                   	pop    %esi
+  804580:	5f                   	pop    %edi
+  804581:	5d                   	pop    %ebp
+  804582:	c3                   	ret
+
+00804583 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804583:	55                   	push   %ebp
+  804584:	89 e5                	mov    %esp,%ebp
+  804586:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804589:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80458e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804591:	c1 e0 04             	shl    $0x4,%eax
+  804594:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804599:	8b 40 50             	mov    0x50(%eax),%eax
+  80459c:	39 c8                	cmp    %ecx,%eax
+  80459e:	74 12                	je     8045b2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8045a0:	83 c2 01             	add    $0x1,%edx
+  8045a3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8045a9:	75 e3                	jne    80458e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8045ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b0:	eb 0e                	jmp    8045c0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8045b2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8045b5:	c1 e0 04             	shl    $0x4,%eax
+  8045b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045bd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8045c0:	5d                   	pop    %ebp
+  8045c1:	c3                   	ret
+
+008045c2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8045c2:	55                   	push   %ebp
+  8045c3:	89 e5                	mov    %esp,%ebp
+  8045c5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045c8:	89 c2                	mov    %eax,%edx
+  8045ca:	c1 ea 16             	shr    $0x16,%edx
+  8045cd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8045d4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045d9:	f6 c1 01             	test   $0x1,%cl
+  8045dc:	74 1c                	je     8045fa <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8045de:	c1 e8 0c             	shr    $0xc,%eax
+  8045e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045e8:	a8 01                	test   $0x1,%al
+  8045ea:	74 0e                	je     8045fa <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045ec:	c1 e8 0c             	shr    $0xc,%eax
+  8045ef:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8045f6:	ef 
+  8045f7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045fa:	89 d0                	mov    %edx,%eax
+  8045fc:	5d                   	pop    %ebp
+  8045fd:	c3                   	ret
+
+008045fe <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8045fe:	55                   	push   %ebp
+  8045ff:	89 e5                	mov    %esp,%ebp
+  804601:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804604:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  80460b:	74 0a                	je     804617 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80460d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804610:	a3 00 c0 80 00       	mov    %eax,0x80c000
+}
+  804615:	c9                   	leave
+  804616:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804617:	83 ec 04             	sub    $0x4,%esp
+  80461a:	6a 07                	push   $0x7
+  80461c:	68 00 f0 bf ee       	push   $0xeebff000
+  804621:	6a 00                	push   $0x0
+  804623:	e8 a5 c6 ff ff       	call   800ccd <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804628:	83 c4 08             	add    $0x8,%esp
+  80462b:	68 3c 46 80 00       	push   $0x80463c
+  804630:	6a 00                	push   $0x0
+  804632:	e8 13 c8 ff ff       	call   800e4a <sys_env_set_pgfault_upcall>
+  804637:	83 c4 10             	add    $0x10,%esp
+  80463a:	eb d1                	jmp    80460d <set_pgfault_handler+0xf>
+
+0080463c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80463c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80463d:	a1 00 c0 80 00       	mov    0x80c000,%eax
+	call *%eax
+  804642:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804644:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804647:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80464b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80464f:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804652:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804656:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804658:	83 c4 08             	add    $0x8,%esp
+	popal
+  80465b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80465c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80465f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804660:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804661:	c3                   	ret
+
+00804662 <udm>:
+  804662:	57                   	push   %edi
+  804663:	56                   	push   %esi
+  804664:	53                   	push   %ebx
+  804665:	83 ec 20             	sub    $0x20,%esp
+  804668:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80466c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804670:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804674:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804678:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80467c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804680:	89 d1                	mov    %edx,%ecx
+  804682:	09 c1                	or     %eax,%ecx
+  804684:	0f 84 91 00 00 00    	je     80471b <udm+0xb9>
+  80468a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804694:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804699:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8046a0:	00 
+  8046a1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8046a8:	00 
+  8046a9:	eb 08                	jmp    8046b3 <udm+0x51>
+  8046ab:	83 e9 01             	sub    $0x1,%ecx
+  8046ae:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8046b1:	74 7c                	je     80472f <udm+0xcd>
+  8046b3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8046b7:	01 c0                	add    %eax,%eax
+  8046b9:	89 c6                	mov    %eax,%esi
+  8046bb:	89 d7                	mov    %edx,%edi
+  8046bd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8046c1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8046c5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8046c8:	d3 ea                	shr    %cl,%edx
+  8046ca:	f6 c1 20             	test   $0x20,%cl
+  8046cd:	74 04                	je     8046d3 <udm+0x71>
+  8046cf:	89 d0                	mov    %edx,%eax
+  8046d1:	31 d2                	xor    %edx,%edx
+  8046d3:	83 e0 01             	and    $0x1,%eax
+  8046d6:	89 04 24             	mov    %eax,(%esp)
+  8046d9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8046e0:	00 
+  8046e1:	8b 04 24             	mov    (%esp),%eax
+  8046e4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8046e8:	09 f0                	or     %esi,%eax
+  8046ea:	09 fa                	or     %edi,%edx
+  8046ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046f0:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046f4:	39 f0                	cmp    %esi,%eax
+  8046f6:	89 d3                	mov    %edx,%ebx
+  8046f8:	19 fb                	sbb    %edi,%ebx
+  8046fa:	72 af                	jb     8046ab <udm+0x49>
+  8046fc:	29 f0                	sub    %esi,%eax
+  8046fe:	19 fa                	sbb    %edi,%edx
+  804700:	89 cf                	mov    %ecx,%edi
+  804702:	c1 ef 05             	shr    $0x5,%edi
+  804705:	83 e7 01             	and    $0x1,%edi
+  804708:	89 fe                	mov    %edi,%esi
+  80470a:	83 f6 01             	xor    $0x1,%esi
+  80470d:	d3 e6                	shl    %cl,%esi
+  80470f:	d3 e7                	shl    %cl,%edi
+  804711:	09 74 24 18          	or     %esi,0x18(%esp)
+  804715:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804719:	eb 90                	jmp    8046ab <udm+0x49>
+  80471b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80471f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804723:	89 f0                	mov    %esi,%eax
+  804725:	89 fa                	mov    %edi,%edx
+  804727:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80472b:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80472f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804733:	89 01                	mov    %eax,(%ecx)
+  804735:	89 51 04             	mov    %edx,0x4(%ecx)
+  804738:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80473c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804740:	83 c4 20             	add    $0x20,%esp
+  804743:	5b                   	pop    %ebx
+  804744:	5e                   	pop    %esi
+  804745:	5f                   	pop    %edi
+  804746:	c3                   	ret
+
+00804747 <__udivdi3>:
+  804747:	83 ec 18             	sub    $0x18,%esp
+  80474a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80474e:	50                   	push   %eax
+  80474f:	ff 74 24 2c          	push   0x2c(%esp)
+  804753:	ff 74 24 2c          	push   0x2c(%esp)
+  804757:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80475b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80475f:	e8 fe fe ff ff       	call   804662 <udm>
+  804764:	83 c4 24             	add    $0x24,%esp
+  804767:	c3                   	ret
+
+00804768 <__umoddi3>:
+  804768:	83 ec 18             	sub    $0x18,%esp
+  80476b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80476f:	50                   	push   %eax
+  804770:	ff 74 24 2c          	push   0x2c(%esp)
+  804774:	ff 74 24 2c          	push   0x2c(%esp)
+  804778:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80477c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804780:	e8 dd fe ff ff       	call   804662 <udm>
+  804785:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804789:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80478d:	83 c4 24             	add    $0x24,%esp
+  804790:	c3                   	ret
+
+00804791 <__divdi3>:
+  804791:	56                   	push   %esi
+  804792:	53                   	push   %ebx
+  804793:	83 ec 14             	sub    $0x14,%esp
+  804796:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80479a:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80479e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8047a2:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8047a6:	85 d2                	test   %edx,%edx
+  8047a8:	78 18                	js     8047c2 <__divdi3+0x31>
+  8047aa:	85 db                	test   %ebx,%ebx
+  8047ac:	78 3e                	js     8047ec <__divdi3+0x5b>
+  8047ae:	83 ec 04             	sub    $0x4,%esp
+  8047b1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047b5:	56                   	push   %esi
+  8047b6:	53                   	push   %ebx
+  8047b7:	51                   	push   %ecx
+  8047b8:	e8 a5 fe ff ff       	call   804662 <udm>
+  8047bd:	83 c4 10             	add    $0x10,%esp
+  8047c0:	eb 24                	jmp    8047e6 <__divdi3+0x55>
+  8047c2:	f7 d8                	neg    %eax
+  8047c4:	83 d2 00             	adc    $0x0,%edx
+  8047c7:	f7 da                	neg    %edx
+  8047c9:	85 db                	test   %ebx,%ebx
+  8047cb:	78 3a                	js     804807 <__divdi3+0x76>
+  8047cd:	83 ec 04             	sub    $0x4,%esp
+  8047d0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047d4:	56                   	push   %esi
+  8047d5:	53                   	push   %ebx
+  8047d6:	51                   	push   %ecx
+  8047d7:	e8 86 fe ff ff       	call   804662 <udm>
+  8047dc:	83 c4 10             	add    $0x10,%esp
+  8047df:	f7 d8                	neg    %eax
+  8047e1:	83 d2 00             	adc    $0x0,%edx
+  8047e4:	f7 da                	neg    %edx
+  8047e6:	83 c4 14             	add    $0x14,%esp
+  8047e9:	5b                   	pop    %ebx
+  8047ea:	5e                   	pop    %esi
+  8047eb:	c3                   	ret
+  8047ec:	83 ec 04             	sub    $0x4,%esp
+  8047ef:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047f3:	56                   	push   %esi
+  8047f4:	f7 d9                	neg    %ecx
+  8047f6:	83 d3 00             	adc    $0x0,%ebx
+  8047f9:	f7 db                	neg    %ebx
+  8047fb:	53                   	push   %ebx
+  8047fc:	51                   	push   %ecx
+  8047fd:	e8 60 fe ff ff       	call   804662 <udm>
+  804802:	83 c4 10             	add    $0x10,%esp
+  804805:	eb d8                	jmp    8047df <__divdi3+0x4e>
+  804807:	83 ec 04             	sub    $0x4,%esp
+  80480a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80480e:	56                   	push   %esi
+  80480f:	f7 d9                	neg    %ecx
+  804811:	83 d3 00             	adc    $0x0,%ebx
+  804814:	f7 db                	neg    %ebx
+  804816:	53                   	push   %ebx
+  804817:	51                   	push   %ecx
+  804818:	e8 45 fe ff ff       	call   804662 <udm>
+  80481d:	83 c4 10             	add    $0x10,%esp
+  804820:	eb c4                	jmp    8047e6 <__divdi3+0x55>
+
+00804822 <__moddi3>:
+  804822:	55                   	push   %ebp
+  804823:	57                   	push   %edi
+  804824:	56                   	push   %esi
+  804825:	53                   	push   %ebx
+  804826:	83 ec 24             	sub    $0x24,%esp
+  804829:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80482d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804831:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804835:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804839:	85 d2                	test   %edx,%edx
+  80483b:	78 3b                	js     804878 <__moddi3+0x56>
+  80483d:	83 ec 04             	sub    $0x4,%esp
+  804840:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804844:	56                   	push   %esi
+  804845:	89 ce                	mov    %ecx,%esi
+  804847:	f7 de                	neg    %esi
+  804849:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80484d:	89 de                	mov    %ebx,%esi
+  80484f:	83 d6 00             	adc    $0x0,%esi
+  804852:	f7 de                	neg    %esi
+  804854:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804858:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80485c:	0f 48 f1             	cmovs  %ecx,%esi
+  80485f:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804864:	53                   	push   %ebx
+  804865:	56                   	push   %esi
+  804866:	e8 f7 fd ff ff       	call   804662 <udm>
+  80486b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80486f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804873:	83 c4 10             	add    $0x10,%esp
+  804876:	eb 47                	jmp    8048bf <__moddi3+0x9d>
+  804878:	f7 d8                	neg    %eax
+  80487a:	83 d2 00             	adc    $0x0,%edx
+  80487d:	f7 da                	neg    %edx
+  80487f:	83 ec 04             	sub    $0x4,%esp
+  804882:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804886:	56                   	push   %esi
+  804887:	89 cf                	mov    %ecx,%edi
+  804889:	f7 df                	neg    %edi
+  80488b:	89 de                	mov    %ebx,%esi
+  80488d:	83 d6 00             	adc    $0x0,%esi
+  804890:	f7 de                	neg    %esi
+  804892:	0f 49 cf             	cmovns %edi,%ecx
+  804895:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804899:	0f 49 de             	cmovns %esi,%ebx
+  80489c:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8048a0:	ff 74 24 0c          	push   0xc(%esp)
+  8048a4:	ff 74 24 0c          	push   0xc(%esp)
+  8048a8:	e8 b5 fd ff ff       	call   804662 <udm>
+  8048ad:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048b1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048b5:	f7 d8                	neg    %eax
+  8048b7:	83 d2 00             	adc    $0x0,%edx
+  8048ba:	f7 da                	neg    %edx
+  8048bc:	83 c4 10             	add    $0x10,%esp
+  8048bf:	83 c4 24             	add    $0x24,%esp
+  8048c2:	5b                   	pop    %ebx
+  8048c3:	5e                   	pop    %esi
+  8048c4:	5f                   	pop    %edi
+  8048c5:	5d                   	pop    %ebp
+  8048c6:	c3                   	ret
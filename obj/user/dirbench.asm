@@ -0,0 +1,9936 @@
+
+obj/user/dirbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8a 02 00 00       	call   8002bb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+		what, n, (uint32_t) (cycles / n), msec);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec ac 00 00 00    	sub    $0xac,%esp
+	char path[MAXNAMELEN];
+	uint64_t tsc;
+	unsigned start;
+	int i, n, fd;
+
+	n = argc > 1 ? strtol(argv[1], 0, 0) : NFILES;
+  80003f:	be 10 27 00 00       	mov    $0x2710,%esi
+  800044:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800048:	7f 5f                	jg     8000a9 <umain+0x76>
+
+	start = sys_time_msec();
+  80004a:	e8 99 10 00 00       	call   8010e8 <sys_time_msec>
+  80004f:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  800055:	0f 31                	rdtsc
+  800057:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  80005d:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+	tsc = read_tsc();
+	for (i = 0; i < n; i++) {
+  800063:	bb 00 00 00 00       	mov    $0x0,%ebx
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+  800068:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (i = 0; i < n; i++) {
+  80006e:	39 f3                	cmp    %esi,%ebx
+  800070:	7d 6c                	jge    8000de <umain+0xab>
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+  800072:	53                   	push   %ebx
+  800073:	68 60 49 80 00       	push   $0x804960
+  800078:	68 80 00 00 00       	push   $0x80
+  80007d:	57                   	push   %edi
+  80007e:	e8 45 09 00 00       	call   8009c8 <snprintf>
+		if ((fd = open(path, O_RDWR|O_CREAT|O_EXCL)) < 0)
+  800083:	83 c4 08             	add    $0x8,%esp
+  800086:	68 02 05 00 00       	push   $0x502
+  80008b:	57                   	push   %edi
+  80008c:	e8 c1 1b 00 00       	call   801c52 <open>
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	78 2a                	js     8000c2 <umain+0x8f>
+			panic("create %s: %e", path, fd);
+		close(fd);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	50                   	push   %eax
+  80009c:	e8 2d 14 00 00       	call   8014ce <close>
+	for (i = 0; i < n; i++) {
+  8000a1:	83 c3 01             	add    $0x1,%ebx
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	eb c5                	jmp    80006e <umain+0x3b>
+	n = argc > 1 ? strtol(argv[1], 0, 0) : NFILES;
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	6a 00                	push   $0x0
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000b3:	ff 70 04             	push   0x4(%eax)
+  8000b6:	e8 b6 0b 00 00       	call   800c71 <strtol>
+  8000bb:	89 c6                	mov    %eax,%esi
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	eb 88                	jmp    80004a <umain+0x17>
+			panic("create %s: %e", path, fd);
+  8000c2:	83 ec 0c             	sub    $0xc,%esp
+  8000c5:	50                   	push   %eax
+  8000c6:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8000cc:	50                   	push   %eax
+  8000cd:	68 6d 49 80 00       	push   $0x80496d
+  8000d2:	6a 1f                	push   $0x1f
+  8000d4:	68 7b 49 80 00       	push   $0x80497b
+  8000d9:	e8 80 02 00 00       	call   80035e <_panic>
+	}
+	report("create", n, read_tsc() - tsc, sys_time_msec() - start);
+  8000de:	e8 05 10 00 00       	call   8010e8 <sys_time_msec>
+  8000e3:	89 c1                	mov    %eax,%ecx
+  8000e5:	0f 31                	rdtsc
+		what, n, (uint32_t) (cycles / n), msec);
+  8000e7:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+  8000ed:	89 f7                	mov    %esi,%edi
+  8000ef:	c1 ff 1f             	sar    $0x1f,%edi
+  8000f2:	89 bd 64 ff ff ff    	mov    %edi,-0x9c(%ebp)
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  8000f8:	83 ec 0c             	sub    $0xc,%esp
+	report("create", n, read_tsc() - tsc, sys_time_msec() - start);
+  8000fb:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+  800101:	29 f9                	sub    %edi,%ecx
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  800103:	51                   	push   %ecx
+	report("create", n, read_tsc() - tsc, sys_time_msec() - start);
+  800104:	2b 85 50 ff ff ff    	sub    -0xb0(%ebp),%eax
+  80010a:	1b 95 54 ff ff ff    	sbb    -0xac(%ebp),%edx
+		what, n, (uint32_t) (cycles / n), msec);
+  800110:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  800116:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  80011c:	52                   	push   %edx
+  80011d:	50                   	push   %eax
+  80011e:	e8 9e 46 00 00       	call   8047c1 <__udivdi3>
+  800123:	83 c4 10             	add    $0x10,%esp
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  800126:	50                   	push   %eax
+  800127:	56                   	push   %esi
+  800128:	68 8b 49 80 00       	push   $0x80498b
+  80012d:	68 d4 49 80 00       	push   $0x8049d4
+  800132:	e8 02 03 00 00       	call   800439 <cprintf>
+
+	start = sys_time_msec();
+  800137:	83 c4 20             	add    $0x20,%esp
+  80013a:	e8 a9 0f 00 00       	call   8010e8 <sys_time_msec>
+  80013f:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  800145:	0f 31                	rdtsc
+  800147:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  80014d:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+	tsc = read_tsc();
+	for (i = n - 1; i >= 0; i--) {
+  800153:	8d 5e ff             	lea    -0x1(%esi),%ebx
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+  800156:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (i = n - 1; i >= 0; i--) {
+  80015c:	85 db                	test   %ebx,%ebx
+  80015e:	78 50                	js     8001b0 <umain+0x17d>
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+  800160:	53                   	push   %ebx
+  800161:	68 60 49 80 00       	push   $0x804960
+  800166:	68 80 00 00 00       	push   $0x80
+  80016b:	57                   	push   %edi
+  80016c:	e8 57 08 00 00       	call   8009c8 <snprintf>
+		if ((fd = open(path, O_RDONLY)) < 0)
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 00                	push   $0x0
+  800176:	57                   	push   %edi
+  800177:	e8 d6 1a 00 00       	call   801c52 <open>
+  80017c:	83 c4 10             	add    $0x10,%esp
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	78 11                	js     800194 <umain+0x161>
+			panic("open %s: %e", path, fd);
+		close(fd);
+  800183:	83 ec 0c             	sub    $0xc,%esp
+  800186:	50                   	push   %eax
+  800187:	e8 42 13 00 00       	call   8014ce <close>
+	for (i = n - 1; i >= 0; i--) {
+  80018c:	83 eb 01             	sub    $0x1,%ebx
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	eb c8                	jmp    80015c <umain+0x129>
+			panic("open %s: %e", path, fd);
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	50                   	push   %eax
+  800198:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80019e:	50                   	push   %eax
+  80019f:	68 92 49 80 00       	push   $0x804992
+  8001a4:	6a 29                	push   $0x29
+  8001a6:	68 7b 49 80 00       	push   $0x80497b
+  8001ab:	e8 ae 01 00 00       	call   80035e <_panic>
+	}
+	report("lookup", n, read_tsc() - tsc, sys_time_msec() - start);
+  8001b0:	e8 33 0f 00 00       	call   8010e8 <sys_time_msec>
+  8001b5:	89 c1                	mov    %eax,%ecx
+  8001b7:	0f 31                	rdtsc
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  8001b9:	83 ec 0c             	sub    $0xc,%esp
+	report("lookup", n, read_tsc() - tsc, sys_time_msec() - start);
+  8001bc:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+  8001c2:	29 f9                	sub    %edi,%ecx
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  8001c4:	51                   	push   %ecx
+	report("lookup", n, read_tsc() - tsc, sys_time_msec() - start);
+  8001c5:	2b 85 50 ff ff ff    	sub    -0xb0(%ebp),%eax
+  8001cb:	1b 95 54 ff ff ff    	sbb    -0xac(%ebp),%edx
+		what, n, (uint32_t) (cycles / n), msec);
+  8001d1:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  8001d7:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  8001dd:	52                   	push   %edx
+  8001de:	50                   	push   %eax
+  8001df:	e8 dd 45 00 00       	call   8047c1 <__udivdi3>
+  8001e4:	83 c4 10             	add    $0x10,%esp
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  8001e7:	50                   	push   %eax
+  8001e8:	56                   	push   %esi
+  8001e9:	68 9e 49 80 00       	push   $0x80499e
+  8001ee:	68 d4 49 80 00       	push   $0x8049d4
+  8001f3:	e8 41 02 00 00       	call   800439 <cprintf>
+
+	start = sys_time_msec();
+  8001f8:	83 c4 20             	add    $0x20,%esp
+  8001fb:	e8 e8 0e 00 00       	call   8010e8 <sys_time_msec>
+  800200:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  800206:	0f 31                	rdtsc
+  800208:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  80020e:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+	tsc = read_tsc();
+	for (i = 0; i < n; i++) {
+  800214:	bb 00 00 00 00       	mov    $0x0,%ebx
+		snprintf(path, sizeof path, "/dirbench.missing.%d", i);
+  800219:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (i = 0; i < n; i++) {
+  80021f:	39 f3                	cmp    %esi,%ebx
+  800221:	7d 45                	jge    800268 <umain+0x235>
+		snprintf(path, sizeof path, "/dirbench.missing.%d", i);
+  800223:	53                   	push   %ebx
+  800224:	68 a5 49 80 00       	push   $0x8049a5
+  800229:	68 80 00 00 00       	push   $0x80
+  80022e:	57                   	push   %edi
+  80022f:	e8 94 07 00 00       	call   8009c8 <snprintf>
+		if ((fd = open(path, O_RDONLY)) != -E_NOT_FOUND)
+  800234:	83 c4 08             	add    $0x8,%esp
+  800237:	6a 00                	push   $0x0
+  800239:	57                   	push   %edi
+  80023a:	e8 13 1a 00 00       	call   801c52 <open>
+  80023f:	83 c4 10             	add    $0x10,%esp
+  800242:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  800245:	75 05                	jne    80024c <umain+0x219>
+	for (i = 0; i < n; i++) {
+  800247:	83 c3 01             	add    $0x1,%ebx
+  80024a:	eb d3                	jmp    80021f <umain+0x1ec>
+			panic("open %s: got %e", path, fd);
+  80024c:	83 ec 0c             	sub    $0xc,%esp
+  80024f:	50                   	push   %eax
+  800250:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800256:	50                   	push   %eax
+  800257:	68 ba 49 80 00       	push   $0x8049ba
+  80025c:	6a 33                	push   $0x33
+  80025e:	68 7b 49 80 00       	push   $0x80497b
+  800263:	e8 f6 00 00 00       	call   80035e <_panic>
+	}
+	report("miss  ", n, read_tsc() - tsc, sys_time_msec() - start);
+  800268:	e8 7b 0e 00 00       	call   8010e8 <sys_time_msec>
+  80026d:	89 c1                	mov    %eax,%ecx
+  80026f:	0f 31                	rdtsc
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  800271:	83 ec 0c             	sub    $0xc,%esp
+	report("miss  ", n, read_tsc() - tsc, sys_time_msec() - start);
+  800274:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+  80027a:	29 f9                	sub    %edi,%ecx
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  80027c:	51                   	push   %ecx
+	report("miss  ", n, read_tsc() - tsc, sys_time_msec() - start);
+  80027d:	2b 85 50 ff ff ff    	sub    -0xb0(%ebp),%eax
+  800283:	1b 95 54 ff ff ff    	sbb    -0xac(%ebp),%edx
+		what, n, (uint32_t) (cycles / n), msec);
+  800289:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  80028f:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  800295:	52                   	push   %edx
+  800296:	50                   	push   %eax
+  800297:	e8 25 45 00 00       	call   8047c1 <__udivdi3>
+  80029c:	83 c4 10             	add    $0x10,%esp
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+  80029f:	50                   	push   %eax
+  8002a0:	56                   	push   %esi
+  8002a1:	68 ca 49 80 00       	push   $0x8049ca
+  8002a6:	68 d4 49 80 00       	push   $0x8049d4
+  8002ab:	e8 89 01 00 00       	call   800439 <cprintf>
+}
+  8002b0:	83 c4 20             	add    $0x20,%esp
+  8002b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b6:	5b                   	pop    %ebx
+  8002b7:	5e                   	pop    %esi
+  8002b8:	5f                   	pop    %edi
+  8002b9:	5d                   	pop    %ebp
+  8002ba:	c3                   	ret
+
+008002bb <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	57                   	push   %edi
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+  8002c1:	83 ec 1c             	sub    $0x1c,%esp
+  8002c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8002ca:	e8 34 0b 00 00       	call   800e03 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8002cf:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8002d2:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8002d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002dd:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8002df:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8002e1:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8002e7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8002ec:	77 16                	ja     800304 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8002ee:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8002f3:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8002f5:	c1 e8 10             	shr    $0x10,%eax
+  8002f8:	74 0a                	je     800304 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8002fa:	c1 e0 10             	shl    $0x10,%eax
+  8002fd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800302:	29 c2                	sub    %eax,%edx
+  800304:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800307:	c1 e0 04             	shl    $0x4,%eax
+  80030a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80030f:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800311:	85 db                	test   %ebx,%ebx
+  800313:	7e 07                	jle    80031c <libmain+0x61>
+		binaryname = argv[0];
+  800315:	8b 06                	mov    (%esi),%eax
+  800317:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80031c:	83 ec 08             	sub    $0x8,%esp
+  80031f:	56                   	push   %esi
+  800320:	53                   	push   %ebx
+  800321:	e8 0d fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800326:	e8 0b 00 00 00       	call   800336 <exit>
+}
+  80032b:	83 c4 10             	add    $0x10,%esp
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+
+00800336 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800336:	55                   	push   %ebp
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80033c:	6a 00                	push   $0x0
+  80033e:	e8 15 21 00 00       	call   802458 <fflush>
+	pthread_kill_others();
+  800343:	e8 80 37 00 00       	call   803ac8 <pthread_kill_others>
+	close_all();
+  800348:	e8 ae 11 00 00       	call   8014fb <close_all>
+	sys_env_destroy(0);
+  80034d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800354:	e8 5f 0a 00 00       	call   800db8 <sys_env_destroy>
+}
+  800359:	83 c4 10             	add    $0x10,%esp
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+
+0080035e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80035e:	55                   	push   %ebp
+  80035f:	89 e5                	mov    %esp,%ebp
+  800361:	56                   	push   %esi
+  800362:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800363:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800366:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80036c:	e8 92 0a 00 00       	call   800e03 <sys_getenvid>
+  800371:	83 ec 0c             	sub    $0xc,%esp
+  800374:	ff 75 0c             	push   0xc(%ebp)
+  800377:	ff 75 08             	push   0x8(%ebp)
+  80037a:	56                   	push   %esi
+  80037b:	50                   	push   %eax
+  80037c:	68 04 4a 80 00       	push   $0x804a04
+  800381:	e8 b3 00 00 00       	call   800439 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800386:	83 c4 18             	add    $0x18,%esp
+  800389:	53                   	push   %ebx
+  80038a:	ff 75 10             	push   0x10(%ebp)
+  80038d:	e8 56 00 00 00       	call   8003e8 <vcprintf>
+	cprintf("\n");
+  800392:	c7 04 24 de 50 80 00 	movl   $0x8050de,(%esp)
+  800399:	e8 9b 00 00 00       	call   800439 <cprintf>
+  80039e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003a1:	cc                   	int3
+	while (1)
+  8003a2:	eb fd                	jmp    8003a1 <_panic+0x43>
+
+008003a4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	53                   	push   %ebx
+  8003a8:	83 ec 04             	sub    $0x4,%esp
+  8003ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003ae:	8b 13                	mov    (%ebx),%edx
+  8003b0:	8d 42 01             	lea    0x1(%edx),%eax
+  8003b3:	89 03                	mov    %eax,(%ebx)
+  8003b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003b8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003bc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003c1:	74 09                	je     8003cc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003c3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003ca:	c9                   	leave
+  8003cb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003cc:	83 ec 08             	sub    $0x8,%esp
+  8003cf:	68 ff 00 00 00       	push   $0xff
+  8003d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003d7:	50                   	push   %eax
+  8003d8:	e8 84 09 00 00       	call   800d61 <sys_cputs>
+		b->idx = 0;
+  8003dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003e3:	83 c4 10             	add    $0x10,%esp
+  8003e6:	eb db                	jmp    8003c3 <putch+0x1f>
+
+008003e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003e8:	55                   	push   %ebp
+  8003e9:	89 e5                	mov    %esp,%ebp
+  8003eb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003f8:	00 00 00 
+	b.cnt = 0;
+  8003fb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800402:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800405:	ff 75 0c             	push   0xc(%ebp)
+  800408:	ff 75 08             	push   0x8(%ebp)
+  80040b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800411:	50                   	push   %eax
+  800412:	68 a4 03 80 00       	push   $0x8003a4
+  800417:	e8 14 01 00 00       	call   800530 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80041c:	83 c4 08             	add    $0x8,%esp
+  80041f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800425:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80042b:	50                   	push   %eax
+  80042c:	e8 30 09 00 00       	call   800d61 <sys_cputs>
+
+	return b.cnt;
+}
+  800431:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800437:	c9                   	leave
+  800438:	c3                   	ret
+
+00800439 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80043f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800442:	50                   	push   %eax
+  800443:	ff 75 08             	push   0x8(%ebp)
+  800446:	e8 9d ff ff ff       	call   8003e8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80044b:	c9                   	leave
+  80044c:	c3                   	ret
+
+0080044d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80044d:	55                   	push   %ebp
+  80044e:	89 e5                	mov    %esp,%ebp
+  800450:	57                   	push   %edi
+  800451:	56                   	push   %esi
+  800452:	53                   	push   %ebx
+  800453:	83 ec 1c             	sub    $0x1c,%esp
+  800456:	89 c7                	mov    %eax,%edi
+  800458:	89 d6                	mov    %edx,%esi
+  80045a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800460:	89 d1                	mov    %edx,%ecx
+  800462:	89 c2                	mov    %eax,%edx
+  800464:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800467:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80046a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80046d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800470:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800473:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80047a:	39 c2                	cmp    %eax,%edx
+  80047c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80047f:	72 3e                	jb     8004bf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800481:	83 ec 0c             	sub    $0xc,%esp
+  800484:	ff 75 18             	push   0x18(%ebp)
+  800487:	83 eb 01             	sub    $0x1,%ebx
+  80048a:	53                   	push   %ebx
+  80048b:	50                   	push   %eax
+  80048c:	83 ec 08             	sub    $0x8,%esp
+  80048f:	ff 75 e4             	push   -0x1c(%ebp)
+  800492:	ff 75 e0             	push   -0x20(%ebp)
+  800495:	ff 75 dc             	push   -0x24(%ebp)
+  800498:	ff 75 d8             	push   -0x28(%ebp)
+  80049b:	e8 21 43 00 00       	call   8047c1 <__udivdi3>
+  8004a0:	83 c4 18             	add    $0x18,%esp
+  8004a3:	52                   	push   %edx
+  8004a4:	50                   	push   %eax
+  8004a5:	89 f2                	mov    %esi,%edx
+  8004a7:	89 f8                	mov    %edi,%eax
+  8004a9:	e8 9f ff ff ff       	call   80044d <printnum>
+  8004ae:	83 c4 20             	add    $0x20,%esp
+  8004b1:	eb 13                	jmp    8004c6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	56                   	push   %esi
+  8004b7:	ff 75 18             	push   0x18(%ebp)
+  8004ba:	ff d7                	call   *%edi
+  8004bc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004bf:	83 eb 01             	sub    $0x1,%ebx
+  8004c2:	85 db                	test   %ebx,%ebx
+  8004c4:	7f ed                	jg     8004b3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	56                   	push   %esi
+  8004ca:	83 ec 04             	sub    $0x4,%esp
+  8004cd:	ff 75 e4             	push   -0x1c(%ebp)
+  8004d0:	ff 75 e0             	push   -0x20(%ebp)
+  8004d3:	ff 75 dc             	push   -0x24(%ebp)
+  8004d6:	ff 75 d8             	push   -0x28(%ebp)
+  8004d9:	e8 04 43 00 00       	call   8047e2 <__umoddi3>
+  8004de:	83 c4 14             	add    $0x14,%esp
+  8004e1:	0f be 80 27 4a 80 00 	movsbl 0x804a27(%eax),%eax
+  8004e8:	50                   	push   %eax
+  8004e9:	ff d7                	call   *%edi
+}
+  8004eb:	83 c4 10             	add    $0x10,%esp
+  8004ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f1:	5b                   	pop    %ebx
+  8004f2:	5e                   	pop    %esi
+  8004f3:	5f                   	pop    %edi
+  8004f4:	5d                   	pop    %ebp
+  8004f5:	c3                   	ret
+
+008004f6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004f6:	55                   	push   %ebp
+  8004f7:	89 e5                	mov    %esp,%ebp
+  8004f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004fc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800500:	8b 10                	mov    (%eax),%edx
+  800502:	3b 50 04             	cmp    0x4(%eax),%edx
+  800505:	73 0a                	jae    800511 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800507:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80050a:	89 08                	mov    %ecx,(%eax)
+  80050c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80050f:	88 02                	mov    %al,(%edx)
+}
+  800511:	5d                   	pop    %ebp
+  800512:	c3                   	ret
+
+00800513 <printfmt>:
+{
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800519:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80051c:	50                   	push   %eax
+  80051d:	ff 75 10             	push   0x10(%ebp)
+  800520:	ff 75 0c             	push   0xc(%ebp)
+  800523:	ff 75 08             	push   0x8(%ebp)
+  800526:	e8 05 00 00 00       	call   800530 <vprintfmt>
+}
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	c9                   	leave
+  80052f:	c3                   	ret
+
+00800530 <vprintfmt>:
+{
+  800530:	55                   	push   %ebp
+  800531:	89 e5                	mov    %esp,%ebp
+  800533:	57                   	push   %edi
+  800534:	56                   	push   %esi
+  800535:	53                   	push   %ebx
+  800536:	83 ec 2c             	sub    $0x2c,%esp
+  800539:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80053f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800542:	eb 0a                	jmp    80054e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800544:	83 ec 08             	sub    $0x8,%esp
+  800547:	53                   	push   %ebx
+  800548:	50                   	push   %eax
+  800549:	ff d6                	call   *%esi
+  80054b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80054e:	83 c7 01             	add    $0x1,%edi
+  800551:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800555:	83 f8 25             	cmp    $0x25,%eax
+  800558:	74 0c                	je     800566 <vprintfmt+0x36>
+			if (ch == '\0')
+  80055a:	85 c0                	test   %eax,%eax
+  80055c:	75 e6                	jne    800544 <vprintfmt+0x14>
+}
+  80055e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800561:	5b                   	pop    %ebx
+  800562:	5e                   	pop    %esi
+  800563:	5f                   	pop    %edi
+  800564:	5d                   	pop    %ebp
+  800565:	c3                   	ret
+		padc = ' ';
+  800566:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80056a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800571:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800578:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80057f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800584:	8d 47 01             	lea    0x1(%edi),%eax
+  800587:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80058a:	0f b6 17             	movzbl (%edi),%edx
+  80058d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800590:	3c 55                	cmp    $0x55,%al
+  800592:	0f 87 c5 03 00 00    	ja     80095d <vprintfmt+0x42d>
+  800598:	0f b6 c0             	movzbl %al,%eax
+  80059b:	ff 24 85 a0 4b 80 00 	jmp    *0x804ba0(,%eax,4)
+  8005a2:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8005a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005a8:	eb da                	jmp    800584 <vprintfmt+0x54>
+  8005aa:	0f be d2             	movsbl %dl,%edx
+  8005ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005b8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005bb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005bf:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005c2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005c5:	83 f9 09             	cmp    $0x9,%ecx
+  8005c8:	77 55                	ja     80061f <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8005ca:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005cd:	eb e9                	jmp    8005b8 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8b 00                	mov    (%eax),%eax
+  8005d4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8d 40 04             	lea    0x4(%eax),%eax
+  8005dd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8005e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005e3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005e7:	79 9b                	jns    800584 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005e9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ef:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005f6:	eb 8c                	jmp    800584 <vprintfmt+0x54>
+			if (width < 0)
+  8005f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005fb:	85 d2                	test   %edx,%edx
+  8005fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800602:	0f 49 c2             	cmovns %edx,%eax
+  800605:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800608:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060b:	e9 74 ff ff ff       	jmp    800584 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800613:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80061a:	e9 65 ff ff ff       	jmp    800584 <vprintfmt+0x54>
+  80061f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800622:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800625:	eb bc                	jmp    8005e3 <vprintfmt+0xb3>
+			lflag++;
+  800627:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80062a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80062d:	e9 52 ff ff ff       	jmp    800584 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8d 78 04             	lea    0x4(%eax),%edi
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	ff 30                	push   (%eax)
+  80063e:	ff d6                	call   *%esi
+			break;
+  800640:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800643:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800646:	e9 b1 02 00 00       	jmp    8008fc <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800651:	8b 10                	mov    (%eax),%edx
+  800653:	89 d0                	mov    %edx,%eax
+  800655:	f7 d8                	neg    %eax
+  800657:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80065a:	83 f8 14             	cmp    $0x14,%eax
+  80065d:	7f 23                	jg     800682 <vprintfmt+0x152>
+  80065f:	8b 14 85 00 4d 80 00 	mov    0x804d00(,%eax,4),%edx
+  800666:	85 d2                	test   %edx,%edx
+  800668:	74 18                	je     800682 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80066a:	52                   	push   %edx
+  80066b:	68 6f 4e 80 00       	push   $0x804e6f
+  800670:	53                   	push   %ebx
+  800671:	56                   	push   %esi
+  800672:	e8 9c fe ff ff       	call   800513 <printfmt>
+  800677:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80067a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80067d:	e9 7a 02 00 00       	jmp    8008fc <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800682:	50                   	push   %eax
+  800683:	68 3f 4a 80 00       	push   $0x804a3f
+  800688:	53                   	push   %ebx
+  800689:	56                   	push   %esi
+  80068a:	e8 84 fe ff ff       	call   800513 <printfmt>
+  80068f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800692:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800695:	e9 62 02 00 00       	jmp    8008fc <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	83 c0 04             	add    $0x4,%eax
+  8006a0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006a8:	85 c9                	test   %ecx,%ecx
+  8006aa:	b8 38 4a 80 00       	mov    $0x804a38,%eax
+  8006af:	0f 45 c1             	cmovne %ecx,%eax
+  8006b2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006b5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006b9:	7e 06                	jle    8006c1 <vprintfmt+0x191>
+  8006bb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006bf:	75 0b                	jne    8006cc <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006c1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006c4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006c7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ca:	eb 5c                	jmp    800728 <vprintfmt+0x1f8>
+  8006cc:	83 ec 08             	sub    $0x8,%esp
+  8006cf:	ff 75 d0             	push   -0x30(%ebp)
+  8006d2:	ff 75 cc             	push   -0x34(%ebp)
+  8006d5:	e8 20 03 00 00       	call   8009fa <strnlen>
+  8006da:	89 c2                	mov    %eax,%edx
+  8006dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006df:	29 d0                	sub    %edx,%eax
+  8006e1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006e4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006eb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ee:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f0:	eb 0e                	jmp    800700 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	57                   	push   %edi
+  8006f7:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006fa:	83 ee 01             	sub    $0x1,%esi
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 f6                	test   %esi,%esi
+  800702:	7f ee                	jg     8006f2 <vprintfmt+0x1c2>
+  800704:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800707:	8b 75 08             	mov    0x8(%ebp),%esi
+  80070a:	85 c0                	test   %eax,%eax
+  80070c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800711:	0f 49 d0             	cmovns %eax,%edx
+  800714:	29 d0                	sub    %edx,%eax
+  800716:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800719:	eb a6                	jmp    8006c1 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80071b:	83 ec 08             	sub    $0x8,%esp
+  80071e:	53                   	push   %ebx
+  80071f:	52                   	push   %edx
+  800720:	ff 55 08             	call   *0x8(%ebp)
+  800723:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800726:	89 f1                	mov    %esi,%ecx
+  800728:	8d 71 01             	lea    0x1(%ecx),%esi
+  80072b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80072f:	0f be d0             	movsbl %al,%edx
+  800732:	85 d2                	test   %edx,%edx
+  800734:	74 28                	je     80075e <vprintfmt+0x22e>
+  800736:	85 ff                	test   %edi,%edi
+  800738:	78 05                	js     80073f <vprintfmt+0x20f>
+  80073a:	83 ef 01             	sub    $0x1,%edi
+  80073d:	78 30                	js     80076f <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80073f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800743:	74 d6                	je     80071b <vprintfmt+0x1eb>
+  800745:	0f be c0             	movsbl %al,%eax
+  800748:	83 e8 20             	sub    $0x20,%eax
+  80074b:	83 f8 5e             	cmp    $0x5e,%eax
+  80074e:	76 cb                	jbe    80071b <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 3f                	push   $0x3f
+  800756:	ff 55 08             	call   *0x8(%ebp)
+  800759:	83 c4 10             	add    $0x10,%esp
+  80075c:	eb c8                	jmp    800726 <vprintfmt+0x1f6>
+  80075e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800761:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800764:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800767:	01 d0                	add    %edx,%eax
+  800769:	29 c8                	sub    %ecx,%eax
+  80076b:	89 c7                	mov    %eax,%edi
+  80076d:	eb 13                	jmp    800782 <vprintfmt+0x252>
+  80076f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800772:	eb ed                	jmp    800761 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800774:	83 ec 08             	sub    $0x8,%esp
+  800777:	53                   	push   %ebx
+  800778:	6a 20                	push   $0x20
+  80077a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80077c:	83 ef 01             	sub    $0x1,%edi
+  80077f:	83 c4 10             	add    $0x10,%esp
+  800782:	85 ff                	test   %edi,%edi
+  800784:	7f ee                	jg     800774 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800786:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078c:	e9 6b 01 00 00       	jmp    8008fc <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800791:	83 f9 01             	cmp    $0x1,%ecx
+  800794:	7f 1f                	jg     8007b5 <vprintfmt+0x285>
+	else if (lflag)
+  800796:	85 c9                	test   %ecx,%ecx
+  800798:	74 67                	je     800801 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 00                	mov    (%eax),%eax
+  80079f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a2:	89 c1                	mov    %eax,%ecx
+  8007a4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b3:	eb 17                	jmp    8007cc <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 50 04             	mov    0x4(%eax),%edx
+  8007bb:	8b 00                	mov    (%eax),%eax
+  8007bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007c0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007cc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007d2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007d7:	85 c9                	test   %ecx,%ecx
+  8007d9:	0f 89 03 01 00 00    	jns    8008e2 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	53                   	push   %ebx
+  8007e3:	6a 2d                	push   $0x2d
+  8007e5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007e7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ed:	f7 da                	neg    %edx
+  8007ef:	83 d1 00             	adc    $0x0,%ecx
+  8007f2:	f7 d9                	neg    %ecx
+  8007f4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007f7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007fc:	e9 e1 00 00 00       	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800801:	8b 45 14             	mov    0x14(%ebp),%eax
+  800804:	8b 00                	mov    (%eax),%eax
+  800806:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800809:	89 c1                	mov    %eax,%ecx
+  80080b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80080e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800811:	8b 45 14             	mov    0x14(%ebp),%eax
+  800814:	8d 40 04             	lea    0x4(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081a:	eb b0                	jmp    8007cc <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80081c:	83 f9 01             	cmp    $0x1,%ecx
+  80081f:	7f 1e                	jg     80083f <vprintfmt+0x30f>
+	else if (lflag)
+  800821:	85 c9                	test   %ecx,%ecx
+  800823:	74 32                	je     800857 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800825:	8b 45 14             	mov    0x14(%ebp),%eax
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082f:	8d 40 04             	lea    0x4(%eax),%eax
+  800832:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800835:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80083a:	e9 a3 00 00 00       	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80083f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800842:	8b 10                	mov    (%eax),%edx
+  800844:	8b 48 04             	mov    0x4(%eax),%ecx
+  800847:	8d 40 08             	lea    0x8(%eax),%eax
+  80084a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80084d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800852:	e9 8b 00 00 00       	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800857:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085a:	8b 10                	mov    (%eax),%edx
+  80085c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800861:	8d 40 04             	lea    0x4(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800867:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80086c:	eb 74                	jmp    8008e2 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80086e:	83 f9 01             	cmp    $0x1,%ecx
+  800871:	7f 1b                	jg     80088e <vprintfmt+0x35e>
+	else if (lflag)
+  800873:	85 c9                	test   %ecx,%ecx
+  800875:	74 2c                	je     8008a3 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800877:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087a:	8b 10                	mov    (%eax),%edx
+  80087c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800881:	8d 40 04             	lea    0x4(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800887:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80088c:	eb 54                	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8b 10                	mov    (%eax),%edx
+  800893:	8b 48 04             	mov    0x4(%eax),%ecx
+  800896:	8d 40 08             	lea    0x8(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80089c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008a1:	eb 3f                	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a6:	8b 10                	mov    (%eax),%edx
+  8008a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008b3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008b8:	eb 28                	jmp    8008e2 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8008ba:	83 ec 08             	sub    $0x8,%esp
+  8008bd:	53                   	push   %ebx
+  8008be:	6a 30                	push   $0x30
+  8008c0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008c2:	83 c4 08             	add    $0x8,%esp
+  8008c5:	53                   	push   %ebx
+  8008c6:	6a 78                	push   $0x78
+  8008c8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 10                	mov    (%eax),%edx
+  8008cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008d4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008dd:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008e2:	83 ec 0c             	sub    $0xc,%esp
+  8008e5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008e9:	50                   	push   %eax
+  8008ea:	ff 75 e0             	push   -0x20(%ebp)
+  8008ed:	57                   	push   %edi
+  8008ee:	51                   	push   %ecx
+  8008ef:	52                   	push   %edx
+  8008f0:	89 da                	mov    %ebx,%edx
+  8008f2:	89 f0                	mov    %esi,%eax
+  8008f4:	e8 54 fb ff ff       	call   80044d <printnum>
+			break;
+  8008f9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8008ff:	e9 4a fc ff ff       	jmp    80054e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800904:	83 f9 01             	cmp    $0x1,%ecx
+  800907:	7f 1b                	jg     800924 <vprintfmt+0x3f4>
+	else if (lflag)
+  800909:	85 c9                	test   %ecx,%ecx
+  80090b:	74 2c                	je     800939 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8b 10                	mov    (%eax),%edx
+  800912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800917:	8d 40 04             	lea    0x4(%eax),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80091d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800922:	eb be                	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	8b 48 04             	mov    0x4(%eax),%ecx
+  80092c:	8d 40 08             	lea    0x8(%eax),%eax
+  80092f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800932:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800937:	eb a9                	jmp    8008e2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800939:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093c:	8b 10                	mov    (%eax),%edx
+  80093e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800943:	8d 40 04             	lea    0x4(%eax),%eax
+  800946:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800949:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80094e:	eb 92                	jmp    8008e2 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800950:	83 ec 08             	sub    $0x8,%esp
+  800953:	53                   	push   %ebx
+  800954:	6a 25                	push   $0x25
+  800956:	ff d6                	call   *%esi
+			break;
+  800958:	83 c4 10             	add    $0x10,%esp
+  80095b:	eb 9f                	jmp    8008fc <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80095d:	83 ec 08             	sub    $0x8,%esp
+  800960:	53                   	push   %ebx
+  800961:	6a 25                	push   $0x25
+  800963:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800965:	83 c4 10             	add    $0x10,%esp
+  800968:	89 f8                	mov    %edi,%eax
+  80096a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80096e:	74 05                	je     800975 <vprintfmt+0x445>
+  800970:	83 e8 01             	sub    $0x1,%eax
+  800973:	eb f5                	jmp    80096a <vprintfmt+0x43a>
+  800975:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800978:	eb 82                	jmp    8008fc <vprintfmt+0x3cc>
+
+0080097a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	83 ec 18             	sub    $0x18,%esp
+  800980:	8b 45 08             	mov    0x8(%ebp),%eax
+  800983:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800986:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800989:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80098d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800990:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800997:	85 c0                	test   %eax,%eax
+  800999:	74 26                	je     8009c1 <vsnprintf+0x47>
+  80099b:	85 d2                	test   %edx,%edx
+  80099d:	7e 22                	jle    8009c1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80099f:	ff 75 14             	push   0x14(%ebp)
+  8009a2:	ff 75 10             	push   0x10(%ebp)
+  8009a5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a8:	50                   	push   %eax
+  8009a9:	68 f6 04 80 00       	push   $0x8004f6
+  8009ae:	e8 7d fb ff ff       	call   800530 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009b6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bc:	83 c4 10             	add    $0x10,%esp
+}
+  8009bf:	c9                   	leave
+  8009c0:	c3                   	ret
+		return -E_INVAL;
+  8009c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c6:	eb f7                	jmp    8009bf <vsnprintf+0x45>
+
+008009c8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009ce:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009d1:	50                   	push   %eax
+  8009d2:	ff 75 10             	push   0x10(%ebp)
+  8009d5:	ff 75 0c             	push   0xc(%ebp)
+  8009d8:	ff 75 08             	push   0x8(%ebp)
+  8009db:	e8 9a ff ff ff       	call   80097a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+
+008009e2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	eb 03                	jmp    8009f2 <strlen+0x10>
+		n++;
+  8009ef:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009f2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009f6:	75 f7                	jne    8009ef <strlen+0xd>
+	return n;
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a08:	eb 03                	jmp    800a0d <strnlen+0x13>
+		n++;
+  800a0a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a0d:	39 d0                	cmp    %edx,%eax
+  800a0f:	74 08                	je     800a19 <strnlen+0x1f>
+  800a11:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a15:	75 f3                	jne    800a0a <strnlen+0x10>
+  800a17:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a19:	89 d0                	mov    %edx,%eax
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	53                   	push   %ebx
+  800a21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a30:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a33:	83 c0 01             	add    $0x1,%eax
+  800a36:	84 d2                	test   %dl,%dl
+  800a38:	75 f2                	jne    800a2c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a3a:	89 c8                	mov    %ecx,%eax
+  800a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3f:	c9                   	leave
+  800a40:	c3                   	ret
+
+00800a41 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	53                   	push   %ebx
+  800a45:	83 ec 10             	sub    $0x10,%esp
+  800a48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a4b:	53                   	push   %ebx
+  800a4c:	e8 91 ff ff ff       	call   8009e2 <strlen>
+  800a51:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a54:	ff 75 0c             	push   0xc(%ebp)
+  800a57:	01 d8                	add    %ebx,%eax
+  800a59:	50                   	push   %eax
+  800a5a:	e8 be ff ff ff       	call   800a1d <strcpy>
+	return dst;
+}
+  800a5f:	89 d8                	mov    %ebx,%eax
+  800a61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a64:	c9                   	leave
+  800a65:	c3                   	ret
+
+00800a66 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	56                   	push   %esi
+  800a6a:	53                   	push   %ebx
+  800a6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a71:	89 f3                	mov    %esi,%ebx
+  800a73:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a76:	89 f0                	mov    %esi,%eax
+  800a78:	eb 0f                	jmp    800a89 <strncpy+0x23>
+		*dst++ = *src;
+  800a7a:	83 c0 01             	add    $0x1,%eax
+  800a7d:	0f b6 0a             	movzbl (%edx),%ecx
+  800a80:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a83:	80 f9 01             	cmp    $0x1,%cl
+  800a86:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a89:	39 d8                	cmp    %ebx,%eax
+  800a8b:	75 ed                	jne    800a7a <strncpy+0x14>
+	}
+	return ret;
+}
+  800a8d:	89 f0                	mov    %esi,%eax
+  800a8f:	5b                   	pop    %ebx
+  800a90:	5e                   	pop    %esi
+  800a91:	5d                   	pop    %ebp
+  800a92:	c3                   	ret
+
+00800a93 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	56                   	push   %esi
+  800a97:	53                   	push   %ebx
+  800a98:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a9e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800aa1:	89 f0                	mov    %esi,%eax
+  800aa3:	85 d2                	test   %edx,%edx
+  800aa5:	74 21                	je     800ac8 <strlcpy+0x35>
+  800aa7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800aab:	89 f2                	mov    %esi,%edx
+  800aad:	eb 09                	jmp    800ab8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800aaf:	83 c1 01             	add    $0x1,%ecx
+  800ab2:	83 c2 01             	add    $0x1,%edx
+  800ab5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ab8:	39 c2                	cmp    %eax,%edx
+  800aba:	74 09                	je     800ac5 <strlcpy+0x32>
+  800abc:	0f b6 19             	movzbl (%ecx),%ebx
+  800abf:	84 db                	test   %bl,%bl
+  800ac1:	75 ec                	jne    800aaf <strlcpy+0x1c>
+  800ac3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ac5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ac8:	29 f0                	sub    %esi,%eax
+}
+  800aca:	5b                   	pop    %ebx
+  800acb:	5e                   	pop    %esi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ad7:	eb 06                	jmp    800adf <strcmp+0x11>
+		p++, q++;
+  800ad9:	83 c1 01             	add    $0x1,%ecx
+  800adc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800adf:	0f b6 01             	movzbl (%ecx),%eax
+  800ae2:	84 c0                	test   %al,%al
+  800ae4:	74 04                	je     800aea <strcmp+0x1c>
+  800ae6:	3a 02                	cmp    (%edx),%al
+  800ae8:	74 ef                	je     800ad9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aea:	0f b6 c0             	movzbl %al,%eax
+  800aed:	0f b6 12             	movzbl (%edx),%edx
+  800af0:	29 d0                	sub    %edx,%eax
+}
+  800af2:	5d                   	pop    %ebp
+  800af3:	c3                   	ret
+
+00800af4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	53                   	push   %ebx
+  800af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800afe:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b01:	eb 09                	jmp    800b0c <strncmp+0x18>
+		n--, p++, q++;
+  800b03:	83 ea 01             	sub    $0x1,%edx
+  800b06:	83 c0 01             	add    $0x1,%eax
+  800b09:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b0c:	85 d2                	test   %edx,%edx
+  800b0e:	74 18                	je     800b28 <strncmp+0x34>
+  800b10:	0f b6 18             	movzbl (%eax),%ebx
+  800b13:	84 db                	test   %bl,%bl
+  800b15:	74 04                	je     800b1b <strncmp+0x27>
+  800b17:	3a 19                	cmp    (%ecx),%bl
+  800b19:	74 e8                	je     800b03 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b1b:	0f b6 00             	movzbl (%eax),%eax
+  800b1e:	0f b6 11             	movzbl (%ecx),%edx
+  800b21:	29 d0                	sub    %edx,%eax
+}
+  800b23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b26:	c9                   	leave
+  800b27:	c3                   	ret
+		return 0;
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2d:	eb f4                	jmp    800b23 <strncmp+0x2f>
+
+00800b2f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b35:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b39:	eb 03                	jmp    800b3e <strchr+0xf>
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	0f b6 10             	movzbl (%eax),%edx
+  800b41:	84 d2                	test   %dl,%dl
+  800b43:	74 06                	je     800b4b <strchr+0x1c>
+		if (*s == c)
+  800b45:	38 ca                	cmp    %cl,%dl
+  800b47:	75 f2                	jne    800b3b <strchr+0xc>
+  800b49:	eb 05                	jmp    800b50 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+
+00800b52 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b58:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b5c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b5f:	38 ca                	cmp    %cl,%dl
+  800b61:	74 09                	je     800b6c <strfind+0x1a>
+  800b63:	84 d2                	test   %dl,%dl
+  800b65:	74 05                	je     800b6c <strfind+0x1a>
+	for (; *s; s++)
+  800b67:	83 c0 01             	add    $0x1,%eax
+  800b6a:	eb f0                	jmp    800b5c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b6c:	5d                   	pop    %ebp
+  800b6d:	c3                   	ret
+
+00800b6e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	57                   	push   %edi
+  800b72:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b75:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b78:	85 c9                	test   %ecx,%ecx
+  800b7a:	74 20                	je     800b9c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b7c:	89 f8                	mov    %edi,%eax
+  800b7e:	09 c8                	or     %ecx,%eax
+  800b80:	a8 03                	test   $0x3,%al
+  800b82:	75 12                	jne    800b96 <memset+0x28>
+		c &= 0xFF;
+  800b84:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b88:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b8e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b91:	fc                   	cld
+  800b92:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b94:	eb 06                	jmp    800b9c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b99:	fc                   	cld
+  800b9a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b9c:	89 f8                	mov    %edi,%eax
+  800b9e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ba1:	c9                   	leave
+  800ba2:	c3                   	ret
+
+00800ba3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	57                   	push   %edi
+  800ba7:	56                   	push   %esi
+  800ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bb1:	39 c6                	cmp    %eax,%esi
+  800bb3:	73 32                	jae    800be7 <memmove+0x44>
+  800bb5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bb8:	39 d0                	cmp    %edx,%eax
+  800bba:	73 2b                	jae    800be7 <memmove+0x44>
+		s += n;
+		d += n;
+  800bbc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbf:	89 d6                	mov    %edx,%esi
+  800bc1:	09 fe                	or     %edi,%esi
+  800bc3:	09 ce                	or     %ecx,%esi
+  800bc5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bcb:	75 0e                	jne    800bdb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bcd:	83 ef 04             	sub    $0x4,%edi
+  800bd0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bd3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bd6:	fd                   	std
+  800bd7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd9:	eb 09                	jmp    800be4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bdb:	83 ef 01             	sub    $0x1,%edi
+  800bde:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800be1:	fd                   	std
+  800be2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800be4:	fc                   	cld
+  800be5:	eb 1a                	jmp    800c01 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be7:	89 f2                	mov    %esi,%edx
+  800be9:	09 c2                	or     %eax,%edx
+  800beb:	09 ca                	or     %ecx,%edx
+  800bed:	f6 c2 03             	test   $0x3,%dl
+  800bf0:	75 0a                	jne    800bfc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bf2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bf5:	89 c7                	mov    %eax,%edi
+  800bf7:	fc                   	cld
+  800bf8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bfa:	eb 05                	jmp    800c01 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bfc:	89 c7                	mov    %eax,%edi
+  800bfe:	fc                   	cld
+  800bff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c01:	5e                   	pop    %esi
+  800c02:	5f                   	pop    %edi
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+
+00800c05 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c0b:	ff 75 10             	push   0x10(%ebp)
+  800c0e:	ff 75 0c             	push   0xc(%ebp)
+  800c11:	ff 75 08             	push   0x8(%ebp)
+  800c14:	e8 8a ff ff ff       	call   800ba3 <memmove>
+}
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+
+00800c1b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c26:	89 c6                	mov    %eax,%esi
+  800c28:	03 75 10             	add    0x10(%ebp),%esi
+  800c2b:	eb 06                	jmp    800c33 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c2d:	83 c0 01             	add    $0x1,%eax
+  800c30:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c33:	39 f0                	cmp    %esi,%eax
+  800c35:	74 14                	je     800c4b <memcmp+0x30>
+		if (*s1 != *s2)
+  800c37:	0f b6 08             	movzbl (%eax),%ecx
+  800c3a:	0f b6 1a             	movzbl (%edx),%ebx
+  800c3d:	38 d9                	cmp    %bl,%cl
+  800c3f:	74 ec                	je     800c2d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c41:	0f b6 c1             	movzbl %cl,%eax
+  800c44:	0f b6 db             	movzbl %bl,%ebx
+  800c47:	29 d8                	sub    %ebx,%eax
+  800c49:	eb 05                	jmp    800c50 <memcmp+0x35>
+	}
+
+	return 0;
+  800c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c5d:	89 c2                	mov    %eax,%edx
+  800c5f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c62:	eb 03                	jmp    800c67 <memfind+0x13>
+  800c64:	83 c0 01             	add    $0x1,%eax
+  800c67:	39 d0                	cmp    %edx,%eax
+  800c69:	73 04                	jae    800c6f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c6b:	38 08                	cmp    %cl,(%eax)
+  800c6d:	75 f5                	jne    800c64 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c7d:	eb 03                	jmp    800c82 <strtol+0x11>
+		s++;
+  800c7f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c82:	0f b6 02             	movzbl (%edx),%eax
+  800c85:	3c 20                	cmp    $0x20,%al
+  800c87:	74 f6                	je     800c7f <strtol+0xe>
+  800c89:	3c 09                	cmp    $0x9,%al
+  800c8b:	74 f2                	je     800c7f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c8d:	3c 2b                	cmp    $0x2b,%al
+  800c8f:	74 2a                	je     800cbb <strtol+0x4a>
+	int neg = 0;
+  800c91:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c96:	3c 2d                	cmp    $0x2d,%al
+  800c98:	74 2b                	je     800cc5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c9a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ca0:	75 0f                	jne    800cb1 <strtol+0x40>
+  800ca2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ca5:	74 28                	je     800ccf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ca7:	85 db                	test   %ebx,%ebx
+  800ca9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cae:	0f 44 d8             	cmove  %eax,%ebx
+  800cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cb9:	eb 46                	jmp    800d01 <strtol+0x90>
+		s++;
+  800cbb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cc3:	eb d5                	jmp    800c9a <strtol+0x29>
+		s++, neg = 1;
+  800cc5:	83 c2 01             	add    $0x1,%edx
+  800cc8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ccd:	eb cb                	jmp    800c9a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ccf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cd3:	74 0e                	je     800ce3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cd5:	85 db                	test   %ebx,%ebx
+  800cd7:	75 d8                	jne    800cb1 <strtol+0x40>
+		s++, base = 8;
+  800cd9:	83 c2 01             	add    $0x1,%edx
+  800cdc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ce1:	eb ce                	jmp    800cb1 <strtol+0x40>
+		s += 2, base = 16;
+  800ce3:	83 c2 02             	add    $0x2,%edx
+  800ce6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ceb:	eb c4                	jmp    800cb1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ced:	0f be c0             	movsbl %al,%eax
+  800cf0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cf3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cf6:	7d 3a                	jge    800d32 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cf8:	83 c2 01             	add    $0x1,%edx
+  800cfb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cff:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d01:	0f b6 02             	movzbl (%edx),%eax
+  800d04:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d07:	89 f3                	mov    %esi,%ebx
+  800d09:	80 fb 09             	cmp    $0x9,%bl
+  800d0c:	76 df                	jbe    800ced <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d0e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d11:	89 f3                	mov    %esi,%ebx
+  800d13:	80 fb 19             	cmp    $0x19,%bl
+  800d16:	77 08                	ja     800d20 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d18:	0f be c0             	movsbl %al,%eax
+  800d1b:	83 e8 57             	sub    $0x57,%eax
+  800d1e:	eb d3                	jmp    800cf3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d20:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d23:	89 f3                	mov    %esi,%ebx
+  800d25:	80 fb 19             	cmp    $0x19,%bl
+  800d28:	77 08                	ja     800d32 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d2a:	0f be c0             	movsbl %al,%eax
+  800d2d:	83 e8 37             	sub    $0x37,%eax
+  800d30:	eb c1                	jmp    800cf3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d32:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d36:	74 05                	je     800d3d <strtol+0xcc>
+		*endptr = (char *) s;
+  800d38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d3b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d3d:	89 c8                	mov    %ecx,%eax
+  800d3f:	f7 d8                	neg    %eax
+  800d41:	85 ff                	test   %edi,%edi
+  800d43:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d46:	89 c8                	mov    %ecx,%eax
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+
+00800d4d <atoi>:
+
+int
+atoi(const char* s)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800d53:	6a 00                	push   $0x0
+  800d55:	6a 00                	push   $0x0
+  800d57:	ff 75 08             	push   0x8(%ebp)
+  800d5a:	e8 12 ff ff ff       	call   800c71 <strtol>
+}
+  800d5f:	c9                   	leave
+  800d60:	c3                   	ret
+
+00800d61 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d71:	89 c3                	mov    %eax,%ebx
+  800d73:	89 c7                	mov    %eax,%edi
+  800d75:	6a 00                	push   $0x0
+  800d77:	55                   	push   %ebp
+  800d78:	56                   	push   %esi
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	8d 35 83 0d 80 00    	lea    0x800d83,%esi
+  800d81:	0f 34                	sysenter
+
+00800d83 <after_sysenter_label_47>:
+  800d83:	5e                   	pop    %esi
+  800d84:	5d                   	pop    %ebp
+  800d85:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d88:	5b                   	pop    %ebx
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+
+00800d8c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d96:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9b:	89 d1                	mov    %edx,%ecx
+  800d9d:	89 d3                	mov    %edx,%ebx
+  800d9f:	89 d7                	mov    %edx,%edi
+  800da1:	6a 00                	push   $0x0
+  800da3:	55                   	push   %ebp
+  800da4:	56                   	push   %esi
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	8d 35 af 0d 80 00    	lea    0x800daf,%esi
+  800dad:	0f 34                	sysenter
+
+00800daf <after_sysenter_label_128>:
+  800daf:	5e                   	pop    %esi
+  800db0:	5d                   	pop    %ebp
+  800db1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800db4:	5b                   	pop    %ebx
+  800db5:	5f                   	pop    %edi
+  800db6:	5d                   	pop    %ebp
+  800db7:	c3                   	ret
+
+00800db8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dca:	89 cb                	mov    %ecx,%ebx
+  800dcc:	89 cf                	mov    %ecx,%edi
+  800dce:	6a 00                	push   $0x0
+  800dd0:	55                   	push   %ebp
+  800dd1:	56                   	push   %esi
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	8d 35 dc 0d 80 00    	lea    0x800ddc,%esi
+  800dda:	0f 34                	sysenter
+
+00800ddc <after_sysenter_label_212>:
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	7f 07                	jg     800dec <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800de8:	5b                   	pop    %ebx
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	50                   	push   %eax
+  800df0:	6a 03                	push   $0x3
+  800df2:	68 95 4d 80 00       	push   $0x804d95
+  800df7:	6a 54                	push   $0x54
+  800df9:	68 b2 4d 80 00       	push   $0x804db2
+  800dfe:	e8 5b f5 ff ff       	call   80035e <_panic>
+
+00800e03 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e12:	89 d1                	mov    %edx,%ecx
+  800e14:	89 d3                	mov    %edx,%ebx
+  800e16:	89 d7                	mov    %edx,%edi
+  800e18:	6a 00                	push   $0x0
+  800e1a:	55                   	push   %ebp
+  800e1b:	56                   	push   %esi
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	8d 35 26 0e 80 00    	lea    0x800e26,%esi
+  800e24:	0f 34                	sysenter
+
+00800e26 <after_sysenter_label_309>:
+  800e26:	5e                   	pop    %esi
+  800e27:	5d                   	pop    %ebp
+  800e28:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+
+00800e2f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e39:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e3e:	89 d1                	mov    %edx,%ecx
+  800e40:	89 d3                	mov    %edx,%ebx
+  800e42:	89 d7                	mov    %edx,%edi
+  800e44:	6a 00                	push   $0x0
+  800e46:	55                   	push   %ebp
+  800e47:	56                   	push   %esi
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	8d 35 52 0e 80 00    	lea    0x800e52,%esi
+  800e50:	0f 34                	sysenter
+
+00800e52 <after_sysenter_label_391>:
+  800e52:	5e                   	pop    %esi
+  800e53:	5d                   	pop    %ebp
+  800e54:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e57:	5b                   	pop    %ebx
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+
+00800e5b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	57                   	push   %edi
+  800e5f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e73:	6a 00                	push   $0x0
+  800e75:	55                   	push   %ebp
+  800e76:	56                   	push   %esi
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	8d 35 81 0e 80 00    	lea    0x800e81,%esi
+  800e7f:	0f 34                	sysenter
+
+00800e81 <after_sysenter_label_479>:
+  800e81:	5e                   	pop    %esi
+  800e82:	5d                   	pop    %ebp
+  800e83:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	7f 07                	jg     800e91 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5f                   	pop    %edi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e91:	83 ec 0c             	sub    $0xc,%esp
+  800e94:	50                   	push   %eax
+  800e95:	6a 04                	push   $0x4
+  800e97:	68 95 4d 80 00       	push   $0x804d95
+  800e9c:	6a 54                	push   $0x54
+  800e9e:	68 b2 4d 80 00       	push   $0x804db2
+  800ea3:	e8 b6 f4 ff ff       	call   80035e <_panic>
+
+00800ea8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ebe:	ff 75 18             	push   0x18(%ebp)
+  800ec1:	55                   	push   %ebp
+  800ec2:	56                   	push   %esi
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	8d 35 cd 0e 80 00    	lea    0x800ecd,%esi
+  800ecb:	0f 34                	sysenter
+
+00800ecd <after_sysenter_label_593>:
+  800ecd:	5e                   	pop    %esi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 07                	jg     800edd <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ed6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	50                   	push   %eax
+  800ee1:	6a 05                	push   $0x5
+  800ee3:	68 95 4d 80 00       	push   $0x804d95
+  800ee8:	6a 54                	push   $0x54
+  800eea:	68 b2 4d 80 00       	push   $0x804db2
+  800eef:	e8 6a f4 ff ff       	call   80035e <_panic>
+
+00800ef4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	6a 00                	push   $0x0
+  800f0d:	55                   	push   %ebp
+  800f0e:	56                   	push   %esi
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	8d 35 19 0f 80 00    	lea    0x800f19,%esi
+  800f17:	0f 34                	sysenter
+
+00800f19 <after_sysenter_label_704>:
+  800f19:	5e                   	pop    %esi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f1e:	85 c0                	test   %eax,%eax
+  800f20:	7f 07                	jg     800f29 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f25:	5b                   	pop    %ebx
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 06                	push   $0x6
+  800f2f:	68 95 4d 80 00       	push   $0x804d95
+  800f34:	6a 54                	push   $0x54
+  800f36:	68 b2 4d 80 00       	push   $0x804db2
+  800f3b:	e8 1e f4 ff ff       	call   80035e <_panic>
+
+00800f40 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f50:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f55:	89 df                	mov    %ebx,%edi
+  800f57:	6a 00                	push   $0x0
+  800f59:	55                   	push   %ebp
+  800f5a:	56                   	push   %esi
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	8d 35 65 0f 80 00    	lea    0x800f65,%esi
+  800f63:	0f 34                	sysenter
+
+00800f65 <after_sysenter_label_808>:
+  800f65:	5e                   	pop    %esi
+  800f66:	5d                   	pop    %ebp
+  800f67:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	7f 07                	jg     800f75 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5f                   	pop    %edi
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+  800f78:	50                   	push   %eax
+  800f79:	6a 08                	push   $0x8
+  800f7b:	68 95 4d 80 00       	push   $0x804d95
+  800f80:	6a 54                	push   $0x54
+  800f82:	68 b2 4d 80 00       	push   $0x804db2
+  800f87:	e8 d2 f3 ff ff       	call   80035e <_panic>
+
+00800f8c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fa1:	89 df                	mov    %ebx,%edi
+  800fa3:	6a 00                	push   $0x0
+  800fa5:	55                   	push   %ebp
+  800fa6:	56                   	push   %esi
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	8d 35 b1 0f 80 00    	lea    0x800fb1,%esi
+  800faf:	0f 34                	sysenter
+
+00800fb1 <after_sysenter_label_912>:
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	7f 07                	jg     800fc1 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  800fc4:	50                   	push   %eax
+  800fc5:	6a 09                	push   $0x9
+  800fc7:	68 95 4d 80 00       	push   $0x804d95
+  800fcc:	6a 54                	push   $0x54
+  800fce:	68 b2 4d 80 00       	push   $0x804db2
+  800fd3:	e8 86 f3 ff ff       	call   80035e <_panic>
+
+00800fd8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fed:	89 df                	mov    %ebx,%edi
+  800fef:	6a 00                	push   $0x0
+  800ff1:	55                   	push   %ebp
+  800ff2:	56                   	push   %esi
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	8d 35 fd 0f 80 00    	lea    0x800ffd,%esi
+  800ffb:	0f 34                	sysenter
+
+00800ffd <after_sysenter_label_1016>:
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 07                	jg     80100d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801006:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+  801010:	50                   	push   %eax
+  801011:	6a 0a                	push   $0xa
+  801013:	68 95 4d 80 00       	push   $0x804d95
+  801018:	6a 54                	push   $0x54
+  80101a:	68 b2 4d 80 00       	push   $0x804db2
+  80101f:	e8 3a f3 ff ff       	call   80035e <_panic>
+
+00801024 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	57                   	push   %edi
+  801028:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801034:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801037:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103a:	6a 00                	push   $0x0
+  80103c:	55                   	push   %ebp
+  80103d:	56                   	push   %esi
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	8d 35 48 10 80 00    	lea    0x801048,%esi
+  801046:	0f 34                	sysenter
+
+00801048 <after_sysenter_label_1126>:
+  801048:	5e                   	pop    %esi
+  801049:	5d                   	pop    %ebp
+  80104a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80104d:	5b                   	pop    %ebx
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+
+00801051 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801056:	8b 55 08             	mov    0x8(%ebp),%edx
+  801059:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801063:	89 cb                	mov    %ecx,%ebx
+  801065:	89 cf                	mov    %ecx,%edi
+  801067:	6a 00                	push   $0x0
+  801069:	55                   	push   %ebp
+  80106a:	56                   	push   %esi
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	8d 35 75 10 80 00    	lea    0x801075,%esi
+  801073:	0f 34                	sysenter
+
+00801075 <after_sysenter_label_1210>:
+  801075:	5e                   	pop    %esi
+  801076:	5d                   	pop    %ebp
+  801077:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	7f 07                	jg     801085 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80107e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801081:	5b                   	pop    %ebx
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801085:	83 ec 0c             	sub    $0xc,%esp
+  801088:	50                   	push   %eax
+  801089:	6a 0d                	push   $0xd
+  80108b:	68 95 4d 80 00       	push   $0x804d95
+  801090:	6a 54                	push   $0x54
+  801092:	68 b2 4d 80 00       	push   $0x804db2
+  801097:	e8 c2 f2 ff ff       	call   80035e <_panic>
+
+0080109c <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ac:	b8 42 00 00 00       	mov    $0x42,%eax
+  8010b1:	89 df                	mov    %ebx,%edi
+  8010b3:	6a 00                	push   $0x0
+  8010b5:	55                   	push   %ebp
+  8010b6:	56                   	push   %esi
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	8d 35 c1 10 80 00    	lea    0x8010c1,%esi
+  8010bf:	0f 34                	sysenter
+
+008010c1 <after_sysenter_label_1311>:
+  8010c1:	5e                   	pop    %esi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	7f 07                	jg     8010d1 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8010ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d1:	83 ec 0c             	sub    $0xc,%esp
+  8010d4:	50                   	push   %eax
+  8010d5:	6a 42                	push   $0x42
+  8010d7:	68 95 4d 80 00       	push   $0x804d95
+  8010dc:	6a 54                	push   $0x54
+  8010de:	68 b2 4d 80 00       	push   $0x804db2
+  8010e3:	e8 76 f2 ff ff       	call   80035e <_panic>
+
+008010e8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010f7:	89 d1                	mov    %edx,%ecx
+  8010f9:	89 d3                	mov    %edx,%ebx
+  8010fb:	89 d7                	mov    %edx,%edi
+  8010fd:	6a 00                	push   $0x0
+  8010ff:	55                   	push   %ebp
+  801100:	56                   	push   %esi
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	8d 35 0b 11 80 00    	lea    0x80110b,%esi
+  801109:	0f 34                	sysenter
+
+0080110b <after_sysenter_label_1411>:
+  80110b:	5e                   	pop    %esi
+  80110c:	5d                   	pop    %ebp
+  80110d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801110:	5b                   	pop    %ebx
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801119:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801121:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801124:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801129:	89 df                	mov    %ebx,%edi
+  80112b:	6a 00                	push   $0x0
+  80112d:	55                   	push   %ebp
+  80112e:	56                   	push   %esi
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	8d 35 39 11 80 00    	lea    0x801139,%esi
+  801137:	0f 34                	sysenter
+
+00801139 <after_sysenter_label_1497>:
+  801139:	5e                   	pop    %esi
+  80113a:	5d                   	pop    %ebp
+  80113b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80113e:	5b                   	pop    %ebx
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+
+00801142 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801147:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	b8 10 00 00 00       	mov    $0x10,%eax
+  801157:	89 df                	mov    %ebx,%edi
+  801159:	6a 00                	push   $0x0
+  80115b:	55                   	push   %ebp
+  80115c:	56                   	push   %esi
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	8d 35 67 11 80 00    	lea    0x801167,%esi
+  801165:	0f 34                	sysenter
+
+00801167 <after_sysenter_label_1583>:
+  801167:	5e                   	pop    %esi
+  801168:	5d                   	pop    %ebp
+  801169:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80116c:	5b                   	pop    %ebx
+  80116d:	5f                   	pop    %edi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+
+00801170 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801180:	bf 00 00 00 00       	mov    $0x0,%edi
+  801185:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801188:	6a 00                	push   $0x0
+  80118a:	55                   	push   %ebp
+  80118b:	56                   	push   %esi
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	8d 35 96 11 80 00    	lea    0x801196,%esi
+  801194:	0f 34                	sysenter
+
+00801196 <after_sysenter_label_1672>:
+  801196:	5e                   	pop    %esi
+  801197:	5d                   	pop    %ebp
+  801198:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80119b:	5b                   	pop    %ebx
+  80119c:	5f                   	pop    %edi
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011b4:	89 df                	mov    %ebx,%edi
+  8011b6:	6a 00                	push   $0x0
+  8011b8:	55                   	push   %ebp
+  8011b9:	56                   	push   %esi
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	8d 35 c4 11 80 00    	lea    0x8011c4,%esi
+  8011c2:	0f 34                	sysenter
+
+008011c4 <after_sysenter_label_1758>:
+  8011c4:	5e                   	pop    %esi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8011c9:	5b                   	pop    %ebx
+  8011ca:	5f                   	pop    %edi
+  8011cb:	5d                   	pop    %ebp
+  8011cc:	c3                   	ret
+
+008011cd <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	57                   	push   %edi
+  8011d1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011da:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011df:	89 cb                	mov    %ecx,%ebx
+  8011e1:	89 cf                	mov    %ecx,%edi
+  8011e3:	6a 00                	push   $0x0
+  8011e5:	55                   	push   %ebp
+  8011e6:	56                   	push   %esi
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	8d 35 f1 11 80 00    	lea    0x8011f1,%esi
+  8011ef:	0f 34                	sysenter
+
+008011f1 <after_sysenter_label_1842>:
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	7f 07                	jg     801201 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8011fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	50                   	push   %eax
+  801205:	6a 13                	push   $0x13
+  801207:	68 95 4d 80 00       	push   $0x804d95
+  80120c:	6a 54                	push   $0x54
+  80120e:	68 b2 4d 80 00       	push   $0x804db2
+  801213:	e8 46 f1 ff ff       	call   80035e <_panic>
+
+00801218 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	57                   	push   %edi
+  80121c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80121d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801222:	b8 14 00 00 00       	mov    $0x14,%eax
+  801227:	89 d1                	mov    %edx,%ecx
+  801229:	89 d3                	mov    %edx,%ebx
+  80122b:	89 d7                	mov    %edx,%edi
+  80122d:	6a 00                	push   $0x0
+  80122f:	55                   	push   %ebp
+  801230:	56                   	push   %esi
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	8d 35 3b 12 80 00    	lea    0x80123b,%esi
+  801239:	0f 34                	sysenter
+
+0080123b <after_sysenter_label_1939>:
+  80123b:	5e                   	pop    %esi
+  80123c:	5d                   	pop    %ebp
+  80123d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5f                   	pop    %edi
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+
+00801244 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801254:	bf 00 00 00 00       	mov    $0x0,%edi
+  801259:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125c:	6a 00                	push   $0x0
+  80125e:	55                   	push   %ebp
+  80125f:	56                   	push   %esi
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	8d 35 6a 12 80 00    	lea    0x80126a,%esi
+  801268:	0f 34                	sysenter
+
+0080126a <after_sysenter_label_2028>:
+  80126a:	5e                   	pop    %esi
+  80126b:	5d                   	pop    %ebp
+  80126c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80126f:	5b                   	pop    %ebx
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+
+00801273 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	b8 16 00 00 00       	mov    $0x16,%eax
+  801288:	89 df                	mov    %ebx,%edi
+  80128a:	6a 00                	push   $0x0
+  80128c:	55                   	push   %ebp
+  80128d:	56                   	push   %esi
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	8d 35 98 12 80 00    	lea    0x801298,%esi
+  801296:	0f 34                	sysenter
+
+00801298 <after_sysenter_label_2114>:
+  801298:	5e                   	pop    %esi
+  801299:	5d                   	pop    %ebp
+  80129a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80129d:	5b                   	pop    %ebx
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012b6:	89 df                	mov    %ebx,%edi
+  8012b8:	6a 00                	push   $0x0
+  8012ba:	55                   	push   %ebp
+  8012bb:	56                   	push   %esi
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	8d 35 c6 12 80 00    	lea    0x8012c6,%esi
+  8012c4:	0f 34                	sysenter
+
+008012c6 <after_sysenter_label_2200>:
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+
+008012cf <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012df:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	6a 00                	push   $0x0
+  8012e8:	55                   	push   %ebp
+  8012e9:	56                   	push   %esi
+  8012ea:	89 e5                	mov    %esp,%ebp
+  8012ec:	8d 35 f4 12 80 00    	lea    0x8012f4,%esi
+  8012f2:	0f 34                	sysenter
+
+008012f4 <after_sysenter_label_2286>:
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8012f9:	5b                   	pop    %ebx
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+
+008012fd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801300:	8b 45 08             	mov    0x8(%ebp),%eax
+  801303:	05 00 00 00 30       	add    $0x30000000,%eax
+  801308:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+
+0080130d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801310:	8b 45 08             	mov    0x8(%ebp),%eax
+  801313:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801318:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80131d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+
+00801324 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801327:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80132c:	eb 02                	jmp    801330 <fd_alloc+0xc>
+  80132e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801330:	89 c2                	mov    %eax,%edx
+  801332:	c1 ea 16             	shr    $0x16,%edx
+  801335:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80133c:	f6 c2 01             	test   $0x1,%dl
+  80133f:	74 2b                	je     80136c <fd_alloc+0x48>
+  801341:	89 c2                	mov    %eax,%edx
+  801343:	c1 ea 0c             	shr    $0xc,%edx
+  801346:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80134d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801353:	f6 c1 01             	test   $0x1,%cl
+  801356:	74 14                	je     80136c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801358:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80135e:	75 ce                	jne    80132e <fd_alloc+0xa>
+  801360:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801365:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80136a:	eb 05                	jmp    801371 <fd_alloc+0x4d>
+			return 0;
+  80136c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	89 02                	mov    %eax,(%edx)
+}
+  801376:	89 c8                	mov    %ecx,%eax
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+
+0080137a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801380:	83 f8 1f             	cmp    $0x1f,%eax
+  801383:	77 30                	ja     8013b5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801385:	c1 e0 0c             	shl    $0xc,%eax
+  801388:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80138d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801393:	f6 c2 01             	test   $0x1,%dl
+  801396:	74 24                	je     8013bc <fd_lookup+0x42>
+  801398:	89 c2                	mov    %eax,%edx
+  80139a:	c1 ea 0c             	shr    $0xc,%edx
+  80139d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013a4:	f6 c2 01             	test   $0x1,%dl
+  8013a7:	74 1a                	je     8013c3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013ac:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+		return -E_INVAL;
+  8013b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ba:	eb f7                	jmp    8013b3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8013bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c1:	eb f0                	jmp    8013b3 <fd_lookup+0x39>
+  8013c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c8:	eb e9                	jmp    8013b3 <fd_lookup+0x39>
+
+008013ca <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	53                   	push   %ebx
+  8013ce:	83 ec 04             	sub    $0x4,%esp
+  8013d1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d9:	eb 03                	jmp    8013de <dev_lookup+0x14>
+  8013db:	83 c0 01             	add    $0x1,%eax
+  8013de:	8b 1c 85 3c 4e 80 00 	mov    0x804e3c(,%eax,4),%ebx
+  8013e5:	85 db                	test   %ebx,%ebx
+  8013e7:	74 0b                	je     8013f4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013e9:	39 13                	cmp    %edx,(%ebx)
+  8013eb:	75 ee                	jne    8013db <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f2:	eb 49                	jmp    80143d <dev_lookup+0x73>
+  8013f4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013f6:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8013fc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801401:	77 18                	ja     80141b <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801403:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801408:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80140a:	c1 e8 10             	shr    $0x10,%eax
+  80140d:	74 0c                	je     80141b <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80140f:	c1 e0 10             	shl    $0x10,%eax
+  801412:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801417:	29 c1                	sub    %eax,%ecx
+  801419:	eb 06                	jmp    801421 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80141b:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801421:	8b 01                	mov    (%ecx),%eax
+  801423:	8b 40 48             	mov    0x48(%eax),%eax
+  801426:	83 ec 04             	sub    $0x4,%esp
+  801429:	52                   	push   %edx
+  80142a:	50                   	push   %eax
+  80142b:	68 c0 4d 80 00       	push   $0x804dc0
+  801430:	e8 04 f0 ff ff       	call   800439 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801435:	83 c4 10             	add    $0x10,%esp
+  801438:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80143d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801440:	89 1a                	mov    %ebx,(%edx)
+}
+  801442:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801445:	c9                   	leave
+  801446:	c3                   	ret
+
+00801447 <fd_close>:
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	57                   	push   %edi
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+  80144d:	83 ec 24             	sub    $0x24,%esp
+  801450:	8b 75 08             	mov    0x8(%ebp),%esi
+  801453:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801456:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801459:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80145a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801460:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801463:	50                   	push   %eax
+  801464:	e8 11 ff ff ff       	call   80137a <fd_lookup>
+  801469:	89 c3                	mov    %eax,%ebx
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	78 05                	js     801477 <fd_close+0x30>
+	    || fd != fd2)
+  801472:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801475:	74 16                	je     80148d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801477:	89 f8                	mov    %edi,%eax
+  801479:	84 c0                	test   %al,%al
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801480:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801483:	89 d8                	mov    %ebx,%eax
+  801485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80148d:	83 ec 08             	sub    $0x8,%esp
+  801490:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801493:	50                   	push   %eax
+  801494:	ff 36                	push   (%esi)
+  801496:	e8 2f ff ff ff       	call   8013ca <dev_lookup>
+  80149b:	89 c3                	mov    %eax,%ebx
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	78 1a                	js     8014be <fd_close+0x77>
+		if (dev->dev_close)
+  8014a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014a7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014af:	85 c0                	test   %eax,%eax
+  8014b1:	74 0b                	je     8014be <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+  8014b6:	56                   	push   %esi
+  8014b7:	ff d0                	call   *%eax
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014be:	83 ec 08             	sub    $0x8,%esp
+  8014c1:	56                   	push   %esi
+  8014c2:	6a 00                	push   $0x0
+  8014c4:	e8 2b fa ff ff       	call   800ef4 <sys_page_unmap>
+	return r;
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	eb b5                	jmp    801483 <fd_close+0x3c>
+
+008014ce <close>:
+
+int
+close(int fdnum)
+{
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d7:	50                   	push   %eax
+  8014d8:	ff 75 08             	push   0x8(%ebp)
+  8014db:	e8 9a fe ff ff       	call   80137a <fd_lookup>
+  8014e0:	83 c4 10             	add    $0x10,%esp
+  8014e3:	85 c0                	test   %eax,%eax
+  8014e5:	79 02                	jns    8014e9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014e7:	c9                   	leave
+  8014e8:	c3                   	ret
+		return fd_close(fd, 1);
+  8014e9:	83 ec 08             	sub    $0x8,%esp
+  8014ec:	6a 01                	push   $0x1
+  8014ee:	ff 75 f4             	push   -0xc(%ebp)
+  8014f1:	e8 51 ff ff ff       	call   801447 <fd_close>
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	eb ec                	jmp    8014e7 <close+0x19>
+
+008014fb <close_all>:
+
+void
+close_all(void)
+{
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+  8014fe:	53                   	push   %ebx
+  8014ff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801502:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801507:	83 ec 0c             	sub    $0xc,%esp
+  80150a:	53                   	push   %ebx
+  80150b:	e8 be ff ff ff       	call   8014ce <close>
+	for (i = 0; i < MAXFD; i++)
+  801510:	83 c3 01             	add    $0x1,%ebx
+  801513:	83 c4 10             	add    $0x10,%esp
+  801516:	83 fb 20             	cmp    $0x20,%ebx
+  801519:	75 ec                	jne    801507 <close_all+0xc>
+}
+  80151b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151e:	c9                   	leave
+  80151f:	c3                   	ret
+
+00801520 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	57                   	push   %edi
+  801524:	56                   	push   %esi
+  801525:	53                   	push   %ebx
+  801526:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801529:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152c:	50                   	push   %eax
+  80152d:	ff 75 08             	push   0x8(%ebp)
+  801530:	e8 45 fe ff ff       	call   80137a <fd_lookup>
+  801535:	89 c3                	mov    %eax,%ebx
+  801537:	83 c4 10             	add    $0x10,%esp
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	78 7f                	js     8015bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	ff 75 0c             	push   0xc(%ebp)
+  801544:	e8 85 ff ff ff       	call   8014ce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801549:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80154c:	c1 e6 0c             	shl    $0xc,%esi
+  80154f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801555:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801558:	89 3c 24             	mov    %edi,(%esp)
+  80155b:	e8 ad fd ff ff       	call   80130d <fd2data>
+  801560:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801562:	89 34 24             	mov    %esi,(%esp)
+  801565:	e8 a3 fd ff ff       	call   80130d <fd2data>
+  80156a:	83 c4 10             	add    $0x10,%esp
+  80156d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801570:	89 d8                	mov    %ebx,%eax
+  801572:	c1 e8 16             	shr    $0x16,%eax
+  801575:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80157c:	a8 01                	test   $0x1,%al
+  80157e:	74 11                	je     801591 <dup+0x71>
+  801580:	89 d8                	mov    %ebx,%eax
+  801582:	c1 e8 0c             	shr    $0xc,%eax
+  801585:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80158c:	f6 c2 01             	test   $0x1,%dl
+  80158f:	75 36                	jne    8015c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801591:	89 f8                	mov    %edi,%eax
+  801593:	c1 e8 0c             	shr    $0xc,%eax
+  801596:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80159d:	83 ec 0c             	sub    $0xc,%esp
+  8015a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015a5:	50                   	push   %eax
+  8015a6:	56                   	push   %esi
+  8015a7:	6a 00                	push   $0x0
+  8015a9:	57                   	push   %edi
+  8015aa:	6a 00                	push   $0x0
+  8015ac:	e8 f7 f8 ff ff       	call   800ea8 <sys_page_map>
+  8015b1:	89 c3                	mov    %eax,%ebx
+  8015b3:	83 c4 20             	add    $0x20,%esp
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	78 33                	js     8015ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015bd:	89 d8                	mov    %ebx,%eax
+  8015bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ce:	83 ec 0c             	sub    $0xc,%esp
+  8015d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015d6:	50                   	push   %eax
+  8015d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8015da:	6a 00                	push   $0x0
+  8015dc:	53                   	push   %ebx
+  8015dd:	6a 00                	push   $0x0
+  8015df:	e8 c4 f8 ff ff       	call   800ea8 <sys_page_map>
+  8015e4:	89 c3                	mov    %eax,%ebx
+  8015e6:	83 c4 20             	add    $0x20,%esp
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	79 a4                	jns    801591 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015ed:	83 ec 08             	sub    $0x8,%esp
+  8015f0:	56                   	push   %esi
+  8015f1:	6a 00                	push   $0x0
+  8015f3:	e8 fc f8 ff ff       	call   800ef4 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015f8:	83 c4 08             	add    $0x8,%esp
+  8015fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8015fe:	6a 00                	push   $0x0
+  801600:	e8 ef f8 ff ff       	call   800ef4 <sys_page_unmap>
+	return r;
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	eb b3                	jmp    8015bd <dup+0x9d>
+
+0080160a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	83 ec 18             	sub    $0x18,%esp
+  801612:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801615:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801618:	50                   	push   %eax
+  801619:	53                   	push   %ebx
+  80161a:	e8 5b fd ff ff       	call   80137a <fd_lookup>
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	85 c0                	test   %eax,%eax
+  801624:	78 3c                	js     801662 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801626:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801629:	83 ec 08             	sub    $0x8,%esp
+  80162c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162f:	50                   	push   %eax
+  801630:	ff 36                	push   (%esi)
+  801632:	e8 93 fd ff ff       	call   8013ca <dev_lookup>
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	78 24                	js     801662 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80163e:	8b 46 08             	mov    0x8(%esi),%eax
+  801641:	83 e0 03             	and    $0x3,%eax
+  801644:	83 f8 01             	cmp    $0x1,%eax
+  801647:	74 20                	je     801669 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801649:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164c:	8b 40 08             	mov    0x8(%eax),%eax
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	74 61                	je     8016b4 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801653:	83 ec 04             	sub    $0x4,%esp
+  801656:	ff 75 10             	push   0x10(%ebp)
+  801659:	ff 75 0c             	push   0xc(%ebp)
+  80165c:	56                   	push   %esi
+  80165d:	ff d0                	call   *%eax
+  80165f:	83 c4 10             	add    $0x10,%esp
+}
+  801662:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801665:	5b                   	pop    %ebx
+  801666:	5e                   	pop    %esi
+  801667:	5d                   	pop    %ebp
+  801668:	c3                   	ret
+  801669:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80166b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801671:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801676:	77 18                	ja     801690 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801678:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80167d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80167f:	c1 e8 10             	shr    $0x10,%eax
+  801682:	74 0c                	je     801690 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801684:	c1 e0 10             	shl    $0x10,%eax
+  801687:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80168c:	29 c2                	sub    %eax,%edx
+  80168e:	eb 06                	jmp    801696 <read+0x8c>
+		return pthread_main_tls;
+  801690:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801696:	8b 02                	mov    (%edx),%eax
+  801698:	8b 40 48             	mov    0x48(%eax),%eax
+  80169b:	83 ec 04             	sub    $0x4,%esp
+  80169e:	53                   	push   %ebx
+  80169f:	50                   	push   %eax
+  8016a0:	68 01 4e 80 00       	push   $0x804e01
+  8016a5:	e8 8f ed ff ff       	call   800439 <cprintf>
+		return -E_INVAL;
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b2:	eb ae                	jmp    801662 <read+0x58>
+		return -E_NOT_SUPP;
+  8016b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b9:	eb a7                	jmp    801662 <read+0x58>
+
+008016bb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	57                   	push   %edi
+  8016bf:	56                   	push   %esi
+  8016c0:	53                   	push   %ebx
+  8016c1:	83 ec 0c             	sub    $0xc,%esp
+  8016c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016c7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cf:	eb 02                	jmp    8016d3 <readn+0x18>
+  8016d1:	01 c3                	add    %eax,%ebx
+  8016d3:	39 f3                	cmp    %esi,%ebx
+  8016d5:	73 21                	jae    8016f8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016d7:	83 ec 04             	sub    $0x4,%esp
+  8016da:	89 f0                	mov    %esi,%eax
+  8016dc:	29 d8                	sub    %ebx,%eax
+  8016de:	50                   	push   %eax
+  8016df:	89 d8                	mov    %ebx,%eax
+  8016e1:	03 45 0c             	add    0xc(%ebp),%eax
+  8016e4:	50                   	push   %eax
+  8016e5:	57                   	push   %edi
+  8016e6:	e8 1f ff ff ff       	call   80160a <read>
+		if (m < 0)
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 04                	js     8016f6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016f2:	75 dd                	jne    8016d1 <readn+0x16>
+  8016f4:	eb 02                	jmp    8016f8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016f6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016f8:	89 d8                	mov    %ebx,%eax
+  8016fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5f                   	pop    %edi
+  801700:	5d                   	pop    %ebp
+  801701:	c3                   	ret
+
+00801702 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	56                   	push   %esi
+  801706:	53                   	push   %ebx
+  801707:	83 ec 18             	sub    $0x18,%esp
+  80170a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80170d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801710:	50                   	push   %eax
+  801711:	53                   	push   %ebx
+  801712:	e8 63 fc ff ff       	call   80137a <fd_lookup>
+  801717:	83 c4 10             	add    $0x10,%esp
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	78 37                	js     801755 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801721:	83 ec 08             	sub    $0x8,%esp
+  801724:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801727:	50                   	push   %eax
+  801728:	ff 36                	push   (%esi)
+  80172a:	e8 9b fc ff ff       	call   8013ca <dev_lookup>
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 1f                	js     801755 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801736:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80173a:	74 20                	je     80175c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80173c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80173f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801742:	85 c0                	test   %eax,%eax
+  801744:	74 61                	je     8017a7 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801746:	83 ec 04             	sub    $0x4,%esp
+  801749:	ff 75 10             	push   0x10(%ebp)
+  80174c:	ff 75 0c             	push   0xc(%ebp)
+  80174f:	56                   	push   %esi
+  801750:	ff d0                	call   *%eax
+  801752:	83 c4 10             	add    $0x10,%esp
+}
+  801755:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801758:	5b                   	pop    %ebx
+  801759:	5e                   	pop    %esi
+  80175a:	5d                   	pop    %ebp
+  80175b:	c3                   	ret
+  80175c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80175e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801764:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801769:	77 18                	ja     801783 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80176b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801770:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801772:	c1 e8 10             	shr    $0x10,%eax
+  801775:	74 0c                	je     801783 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801777:	c1 e0 10             	shl    $0x10,%eax
+  80177a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80177f:	29 c2                	sub    %eax,%edx
+  801781:	eb 06                	jmp    801789 <write+0x87>
+		return pthread_main_tls;
+  801783:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801789:	8b 02                	mov    (%edx),%eax
+  80178b:	8b 40 48             	mov    0x48(%eax),%eax
+  80178e:	83 ec 04             	sub    $0x4,%esp
+  801791:	53                   	push   %ebx
+  801792:	50                   	push   %eax
+  801793:	68 1d 4e 80 00       	push   $0x804e1d
+  801798:	e8 9c ec ff ff       	call   800439 <cprintf>
+		return -E_INVAL;
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a5:	eb ae                	jmp    801755 <write+0x53>
+		return -E_NOT_SUPP;
+  8017a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ac:	eb a7                	jmp    801755 <write+0x53>
+
+008017ae <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b7:	50                   	push   %eax
+  8017b8:	ff 75 08             	push   0x8(%ebp)
+  8017bb:	e8 ba fb ff ff       	call   80137a <fd_lookup>
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 0e                	js     8017d5 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017cd:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017d5:	c9                   	leave
+  8017d6:	c3                   	ret
+
+008017d7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	56                   	push   %esi
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 18             	sub    $0x18,%esp
+  8017df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	53                   	push   %ebx
+  8017e7:	e8 8e fb ff ff       	call   80137a <fd_lookup>
+  8017ec:	83 c4 10             	add    $0x10,%esp
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 34                	js     801827 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f6:	83 ec 08             	sub    $0x8,%esp
+  8017f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fc:	50                   	push   %eax
+  8017fd:	ff 36                	push   (%esi)
+  8017ff:	e8 c6 fb ff ff       	call   8013ca <dev_lookup>
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 1c                	js     801827 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80180b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180f:	74 1d                	je     80182e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	8b 40 18             	mov    0x18(%eax),%eax
+  801817:	85 c0                	test   %eax,%eax
+  801819:	74 5e                	je     801879 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	ff 75 0c             	push   0xc(%ebp)
+  801821:	56                   	push   %esi
+  801822:	ff d0                	call   *%eax
+  801824:	83 c4 10             	add    $0x10,%esp
+}
+  801827:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182a:	5b                   	pop    %ebx
+  80182b:	5e                   	pop    %esi
+  80182c:	5d                   	pop    %ebp
+  80182d:	c3                   	ret
+  80182e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801830:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801836:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80183b:	77 18                	ja     801855 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80183d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801842:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801844:	c1 e8 10             	shr    $0x10,%eax
+  801847:	74 0c                	je     801855 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801849:	c1 e0 10             	shl    $0x10,%eax
+  80184c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801851:	29 c2                	sub    %eax,%edx
+  801853:	eb 06                	jmp    80185b <ftruncate+0x84>
+		return pthread_main_tls;
+  801855:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80185b:	8b 02                	mov    (%edx),%eax
+  80185d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801860:	83 ec 04             	sub    $0x4,%esp
+  801863:	53                   	push   %ebx
+  801864:	50                   	push   %eax
+  801865:	68 e0 4d 80 00       	push   $0x804de0
+  80186a:	e8 ca eb ff ff       	call   800439 <cprintf>
+		return -E_INVAL;
+  80186f:	83 c4 10             	add    $0x10,%esp
+  801872:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801877:	eb ae                	jmp    801827 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801879:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187e:	eb a7                	jmp    801827 <ftruncate+0x50>
+
+00801880 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	83 ec 18             	sub    $0x18,%esp
+  801888:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80188b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80188e:	50                   	push   %eax
+  80188f:	ff 75 08             	push   0x8(%ebp)
+  801892:	e8 e3 fa ff ff       	call   80137a <fd_lookup>
+  801897:	83 c4 10             	add    $0x10,%esp
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	78 49                	js     8018e7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80189e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018a1:	83 ec 08             	sub    $0x8,%esp
+  8018a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a7:	50                   	push   %eax
+  8018a8:	ff 36                	push   (%esi)
+  8018aa:	e8 1b fb ff ff       	call   8013ca <dev_lookup>
+  8018af:	83 c4 10             	add    $0x10,%esp
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 31                	js     8018e7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018bd:	74 2f                	je     8018ee <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018bf:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018c2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018c9:	00 00 00 
+	stat->st_isdir = 0;
+  8018cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018d3:	00 00 00 
+	stat->st_dev = dev;
+  8018d6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018dc:	83 ec 08             	sub    $0x8,%esp
+  8018df:	53                   	push   %ebx
+  8018e0:	56                   	push   %esi
+  8018e1:	ff 50 14             	call   *0x14(%eax)
+  8018e4:	83 c4 10             	add    $0x10,%esp
+}
+  8018e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ea:	5b                   	pop    %ebx
+  8018eb:	5e                   	pop    %esi
+  8018ec:	5d                   	pop    %ebp
+  8018ed:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018f3:	eb f2                	jmp    8018e7 <fstat+0x67>
+
+008018f5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	56                   	push   %esi
+  8018f9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	6a 00                	push   $0x0
+  8018ff:	ff 75 08             	push   0x8(%ebp)
+  801902:	e8 4b 03 00 00       	call   801c52 <open>
+  801907:	89 c3                	mov    %eax,%ebx
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	78 1b                	js     80192b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801910:	83 ec 08             	sub    $0x8,%esp
+  801913:	ff 75 0c             	push   0xc(%ebp)
+  801916:	50                   	push   %eax
+  801917:	e8 64 ff ff ff       	call   801880 <fstat>
+  80191c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80191e:	89 1c 24             	mov    %ebx,(%esp)
+  801921:	e8 a8 fb ff ff       	call   8014ce <close>
+	return r;
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	89 f3                	mov    %esi,%ebx
+}
+  80192b:	89 d8                	mov    %ebx,%eax
+  80192d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801930:	5b                   	pop    %ebx
+  801931:	5e                   	pop    %esi
+  801932:	5d                   	pop    %ebp
+  801933:	c3                   	ret
+
+00801934 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801934:	55                   	push   %ebp
+  801935:	89 e5                	mov    %esp,%ebp
+  801937:	56                   	push   %esi
+  801938:	53                   	push   %ebx
+  801939:	89 c6                	mov    %eax,%esi
+  80193b:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80193d:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801944:	74 27                	je     80196d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801946:	6a 07                	push   $0x7
+  801948:	68 00 80 80 00       	push   $0x808000
+  80194d:	56                   	push   %esi
+  80194e:	ff 35 00 70 80 00    	push   0x807000
+  801954:	e8 4e 2c 00 00       	call   8045a7 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801959:	83 c4 0c             	add    $0xc,%esp
+  80195c:	6a 00                	push   $0x0
+  80195e:	53                   	push   %ebx
+  80195f:	6a 00                	push   $0x0
+  801961:	e8 4b 2b 00 00       	call   8044b1 <ipc_recv>
+}
+  801966:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801969:	5b                   	pop    %ebx
+  80196a:	5e                   	pop    %esi
+  80196b:	5d                   	pop    %ebp
+  80196c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80196d:	83 ec 0c             	sub    $0xc,%esp
+  801970:	6a 01                	push   $0x1
+  801972:	e8 86 2c 00 00       	call   8045fd <ipc_find_env>
+  801977:	a3 00 70 80 00       	mov    %eax,0x807000
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	eb c5                	jmp    801946 <fsipc+0x12>
+
+00801981 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	53                   	push   %ebx
+  801985:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801988:	68 04 70 80 00       	push   $0x807004
+  80198d:	e8 29 1b 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801992:	8b 45 08             	mov    0x8(%ebp),%eax
+  801995:	8b 40 0c             	mov    0xc(%eax),%eax
+  801998:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  80199d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019a0:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8019a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019aa:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019af:	e8 80 ff ff ff       	call   801934 <fsipc>
+  8019b4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8019b6:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8019bd:	e8 66 1b 00 00       	call   803528 <mutex_unlock>
+	return r;
+}
+  8019c2:	89 d8                	mov    %ebx,%eax
+  8019c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c7:	c9                   	leave
+  8019c8:	c3                   	ret
+
+008019c9 <devfile_flush>:
+{
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	53                   	push   %ebx
+  8019cd:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8019d0:	68 04 70 80 00       	push   $0x807004
+  8019d5:	e8 e1 1a 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019dd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e0:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8019e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ea:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019ef:	e8 40 ff ff ff       	call   801934 <fsipc>
+  8019f4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8019f6:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8019fd:	e8 26 1b 00 00       	call   803528 <mutex_unlock>
+}
+  801a02:	89 d8                	mov    %ebx,%eax
+  801a04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a07:	c9                   	leave
+  801a08:	c3                   	ret
+
+00801a09 <devfile_stat>:
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	56                   	push   %esi
+  801a0d:	53                   	push   %ebx
+  801a0e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801a11:	83 ec 0c             	sub    $0xc,%esp
+  801a14:	68 04 70 80 00       	push   $0x807004
+  801a19:	e8 9d 1a 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a21:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a24:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801a29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a33:	e8 fc fe ff ff       	call   801934 <fsipc>
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	79 16                	jns    801a57 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801a41:	83 ec 0c             	sub    $0xc,%esp
+  801a44:	68 04 70 80 00       	push   $0x807004
+  801a49:	e8 da 1a 00 00       	call   803528 <mutex_unlock>
+}
+  801a4e:	89 d8                	mov    %ebx,%eax
+  801a50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a53:	5b                   	pop    %ebx
+  801a54:	5e                   	pop    %esi
+  801a55:	5d                   	pop    %ebp
+  801a56:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a57:	83 ec 08             	sub    $0x8,%esp
+  801a5a:	68 00 80 80 00       	push   $0x808000
+  801a5f:	56                   	push   %esi
+  801a60:	e8 b8 ef ff ff       	call   800a1d <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801a65:	a1 80 80 80 00       	mov    0x808080,%eax
+  801a6a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a70:	a1 84 80 80 00       	mov    0x808084,%eax
+  801a75:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801a7b:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a83:	eb bc                	jmp    801a41 <devfile_stat+0x38>
+
+00801a85 <devfile_write>:
+{
+  801a85:	55                   	push   %ebp
+  801a86:	89 e5                	mov    %esp,%ebp
+  801a88:	53                   	push   %ebx
+  801a89:	83 ec 10             	sub    $0x10,%esp
+  801a8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801a8f:	68 04 70 80 00       	push   $0x807004
+  801a94:	e8 22 1a 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a9f:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801aad:	76 3d                	jbe    801aec <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801aaf:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801ab4:	39 c3                	cmp    %eax,%ebx
+  801ab6:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801ab9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801abc:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801ac1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801ac7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ad1:	e8 5e fe ff ff       	call   801934 <fsipc>
+  801ad6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ad8:	83 ec 0c             	sub    $0xc,%esp
+  801adb:	68 04 70 80 00       	push   $0x807004
+  801ae0:	e8 43 1a 00 00       	call   803528 <mutex_unlock>
+}
+  801ae5:	89 d8                	mov    %ebx,%eax
+  801ae7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aea:	c9                   	leave
+  801aeb:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801aec:	83 ec 04             	sub    $0x4,%esp
+  801aef:	53                   	push   %ebx
+  801af0:	ff 75 0c             	push   0xc(%ebp)
+  801af3:	68 0c 80 80 00       	push   $0x80800c
+  801af8:	e8 a6 f0 ff ff       	call   800ba3 <memmove>
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b05:	eb b5                	jmp    801abc <devfile_write+0x37>
+
+00801b07 <devfile_read>:
+{
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	57                   	push   %edi
+  801b0b:	56                   	push   %esi
+  801b0c:	53                   	push   %ebx
+  801b0d:	83 ec 0c             	sub    $0xc,%esp
+  801b10:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801b19:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801b1f:	0f 86 8c 00 00 00    	jbe    801bb1 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801b25:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801b2a:	39 c3                	cmp    %eax,%ebx
+  801b2c:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801b2f:	89 f8                	mov    %edi,%eax
+  801b31:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801b34:	eb 0f                	jmp    801b45 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801b36:	0f b6 08             	movzbl (%eax),%ecx
+  801b39:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801b3b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b40:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801b45:	39 d0                	cmp    %edx,%eax
+  801b47:	72 ed                	jb     801b36 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801b49:	83 ec 0c             	sub    $0xc,%esp
+  801b4c:	68 04 70 80 00       	push   $0x807004
+  801b51:	e8 65 19 00 00       	call   8034bb <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b56:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b59:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801b5e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801b64:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b74:	e8 bb fd ff ff       	call   801934 <fsipc>
+  801b79:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801b7b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b82:	e8 a1 19 00 00       	call   803528 <mutex_unlock>
+		assert(r <= (int) n);
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	39 f3                	cmp    %esi,%ebx
+  801b8c:	7c 0a                	jl     801b98 <devfile_read+0x91>
+}
+  801b8e:	89 f0                	mov    %esi,%eax
+  801b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b93:	5b                   	pop    %ebx
+  801b94:	5e                   	pop    %esi
+  801b95:	5f                   	pop    %edi
+  801b96:	5d                   	pop    %ebp
+  801b97:	c3                   	ret
+		assert(r <= (int) n);
+  801b98:	68 50 4e 80 00       	push   $0x804e50
+  801b9d:	68 5d 4e 80 00       	push   $0x804e5d
+  801ba2:	68 90 00 00 00       	push   $0x90
+  801ba7:	68 72 4e 80 00       	push   $0x804e72
+  801bac:	e8 ad e7 ff ff       	call   80035e <_panic>
+	mutex_lock(&fsipc_mu);
+  801bb1:	83 ec 0c             	sub    $0xc,%esp
+  801bb4:	68 04 70 80 00       	push   $0x807004
+  801bb9:	e8 fd 18 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bbe:	8b 46 0c             	mov    0xc(%esi),%eax
+  801bc1:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801bc6:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801bcc:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801bd3:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdb:	b8 03 00 00 00       	mov    $0x3,%eax
+  801be0:	e8 4f fd ff ff       	call   801934 <fsipc>
+  801be5:	89 c6                	mov    %eax,%esi
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 1d                	js     801c0b <devfile_read+0x104>
+		assert(r <= n);
+  801bee:	39 c3                	cmp    %eax,%ebx
+  801bf0:	72 2e                	jb     801c20 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801bf2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bf7:	7f 40                	jg     801c39 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bf9:	83 ec 04             	sub    $0x4,%esp
+  801bfc:	50                   	push   %eax
+  801bfd:	68 00 80 80 00       	push   $0x808000
+  801c02:	57                   	push   %edi
+  801c03:	e8 9b ef ff ff       	call   800ba3 <memmove>
+  801c08:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801c0b:	83 ec 0c             	sub    $0xc,%esp
+  801c0e:	68 04 70 80 00       	push   $0x807004
+  801c13:	e8 10 19 00 00       	call   803528 <mutex_unlock>
+	return r;
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	e9 6e ff ff ff       	jmp    801b8e <devfile_read+0x87>
+		assert(r <= n);
+  801c20:	68 7d 4e 80 00       	push   $0x804e7d
+  801c25:	68 5d 4e 80 00       	push   $0x804e5d
+  801c2a:	68 99 00 00 00       	push   $0x99
+  801c2f:	68 72 4e 80 00       	push   $0x804e72
+  801c34:	e8 25 e7 ff ff       	call   80035e <_panic>
+		assert(r <= PGSIZE);
+  801c39:	68 84 4e 80 00       	push   $0x804e84
+  801c3e:	68 5d 4e 80 00       	push   $0x804e5d
+  801c43:	68 9a 00 00 00       	push   $0x9a
+  801c48:	68 72 4e 80 00       	push   $0x804e72
+  801c4d:	e8 0c e7 ff ff       	call   80035e <_panic>
+
+00801c52 <open>:
+{
+  801c52:	55                   	push   %ebp
+  801c53:	89 e5                	mov    %esp,%ebp
+  801c55:	56                   	push   %esi
+  801c56:	53                   	push   %ebx
+  801c57:	83 ec 1c             	sub    $0x1c,%esp
+  801c5a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c5d:	56                   	push   %esi
+  801c5e:	e8 7f ed ff ff       	call   8009e2 <strlen>
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c6b:	0f 8f 85 00 00 00    	jg     801cf6 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c71:	83 ec 0c             	sub    $0xc,%esp
+  801c74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c77:	50                   	push   %eax
+  801c78:	e8 a7 f6 ff ff       	call   801324 <fd_alloc>
+  801c7d:	89 c3                	mov    %eax,%ebx
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 55                	js     801cdb <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801c86:	83 ec 0c             	sub    $0xc,%esp
+  801c89:	68 04 70 80 00       	push   $0x807004
+  801c8e:	e8 28 18 00 00       	call   8034bb <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c93:	83 c4 08             	add    $0x8,%esp
+  801c96:	56                   	push   %esi
+  801c97:	68 00 80 80 00       	push   $0x808000
+  801c9c:	e8 7c ed ff ff       	call   800a1d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ca1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ca4:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801ca9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cac:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cb1:	e8 7e fc ff ff       	call   801934 <fsipc>
+  801cb6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cb8:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801cbf:	e8 64 18 00 00       	call   803528 <mutex_unlock>
+	if (r < 0) {
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	85 db                	test   %ebx,%ebx
+  801cc9:	78 19                	js     801ce4 <open+0x92>
+	return fd2num(fd);
+  801ccb:	83 ec 0c             	sub    $0xc,%esp
+  801cce:	ff 75 f4             	push   -0xc(%ebp)
+  801cd1:	e8 27 f6 ff ff       	call   8012fd <fd2num>
+  801cd6:	89 c3                	mov    %eax,%ebx
+  801cd8:	83 c4 10             	add    $0x10,%esp
+}
+  801cdb:	89 d8                	mov    %ebx,%eax
+  801cdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce0:	5b                   	pop    %ebx
+  801ce1:	5e                   	pop    %esi
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+		fd_close(fd, 0);
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+  801ce7:	6a 00                	push   $0x0
+  801ce9:	ff 75 f4             	push   -0xc(%ebp)
+  801cec:	e8 56 f7 ff ff       	call   801447 <fd_close>
+		return r;
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	eb e5                	jmp    801cdb <open+0x89>
+		return -E_BAD_PATH;
+  801cf6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801cfb:	eb de                	jmp    801cdb <open+0x89>
+
+00801cfd <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	53                   	push   %ebx
+  801d01:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d07:	50                   	push   %eax
+  801d08:	ff 75 08             	push   0x8(%ebp)
+  801d0b:	e8 6a f6 ff ff       	call   80137a <fd_lookup>
+  801d10:	89 c3                	mov    %eax,%ebx
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 5b                	js     801d74 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801d22:	39 08                	cmp    %ecx,(%eax)
+  801d24:	75 55                	jne    801d7b <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801d26:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801d2a:	74 56                	je     801d82 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801d2c:	83 ec 0c             	sub    $0xc,%esp
+  801d2f:	68 04 70 80 00       	push   $0x807004
+  801d34:	e8 82 17 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d3f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d47:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801d4c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d4f:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801d54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d59:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801d5e:	e8 d1 fb ff ff       	call   801934 <fsipc>
+  801d63:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d65:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801d6c:	e8 b7 17 00 00       	call   803528 <mutex_unlock>
+	return r;
+  801d71:	83 c4 10             	add    $0x10,%esp
+}
+  801d74:	89 d8                	mov    %ebx,%eax
+  801d76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d79:	c9                   	leave
+  801d7a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d7b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801d80:	eb f2                	jmp    801d74 <fallocate+0x77>
+		return -E_INVAL;
+  801d82:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801d87:	eb eb                	jmp    801d74 <fallocate+0x77>
+
+00801d89 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	56                   	push   %esi
+  801d8d:	53                   	push   %ebx
+  801d8e:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801d91:	89 f3                	mov    %esi,%ebx
+  801d93:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801d99:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801d9c:	eb 06                	jmp    801da4 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801d9e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801da4:	39 f3                	cmp    %esi,%ebx
+  801da6:	73 14                	jae    801dbc <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	53                   	push   %ebx
+  801dac:	6a 00                	push   $0x0
+  801dae:	e8 41 f1 ff ff       	call   800ef4 <sys_page_unmap>
+  801db3:	83 c4 10             	add    $0x10,%esp
+  801db6:	85 c0                	test   %eax,%eax
+  801db8:	79 e4                	jns    801d9e <munmap+0x15>
+  801dba:	eb 05                	jmp    801dc1 <munmap+0x38>
+			return r;
+	return 0;
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc4:	5b                   	pop    %ebx
+  801dc5:	5e                   	pop    %esi
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+
+00801dc8 <mmap>:
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	57                   	push   %edi
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	83 ec 24             	sub    $0x24,%esp
+  801dd1:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801dd4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dd7:	50                   	push   %eax
+  801dd8:	ff 75 08             	push   0x8(%ebp)
+  801ddb:	e8 9a f5 ff ff       	call   80137a <fd_lookup>
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	0f 88 37 01 00 00    	js     801f22 <mmap+0x15a>
+		return NULL;
+  801deb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801df0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801df3:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801df9:	39 0a                	cmp    %ecx,(%edx)
+  801dfb:	0f 85 05 01 00 00    	jne    801f06 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801e01:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801e08:	0f 85 1b 01 00 00    	jne    801f29 <mmap+0x161>
+  801e0e:	89 f0                	mov    %esi,%eax
+  801e10:	83 e8 01             	sub    $0x1,%eax
+  801e13:	0f 88 17 01 00 00    	js     801f30 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801e19:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801e1d:	75 28                	jne    801e47 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801e1f:	83 ec 0c             	sub    $0xc,%esp
+  801e22:	68 04 70 80 00       	push   $0x807004
+  801e27:	e8 8f 16 00 00       	call   8034bb <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801e2c:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801e32:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801e40:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801e45:	eb 2b                	jmp    801e72 <mmap+0xaa>
+		cow_enable();
+  801e47:	e8 f4 21 00 00       	call   804040 <cow_enable>
+  801e4c:	eb d1                	jmp    801e1f <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801e4e:	89 c2                	mov    %eax,%edx
+  801e50:	c1 ea 0c             	shr    $0xc,%edx
+  801e53:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801e5a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801e60:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801e66:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801e69:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801e6b:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801e70:	77 25                	ja     801e97 <mmap+0xcf>
+  801e72:	89 c2                	mov    %eax,%edx
+  801e74:	29 da                	sub    %ebx,%edx
+  801e76:	39 ca                	cmp    %ecx,%edx
+  801e78:	73 3a                	jae    801eb4 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801e7a:	89 c2                	mov    %eax,%edx
+  801e7c:	c1 ea 16             	shr    $0x16,%edx
+  801e7f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e86:	f6 c2 01             	test   $0x1,%dl
+  801e89:	75 c3                	jne    801e4e <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801e8b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801e90:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801e95:	eb d4                	jmp    801e6b <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801e97:	29 d8                	sub    %ebx,%eax
+  801e99:	39 c8                	cmp    %ecx,%eax
+  801e9b:	73 17                	jae    801eb4 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801e9d:	83 ec 0c             	sub    $0xc,%esp
+  801ea0:	68 04 70 80 00       	push   $0x807004
+  801ea5:	e8 7e 16 00 00       	call   803528 <mutex_unlock>
+		return NULL;
+  801eaa:	83 c4 10             	add    $0x10,%esp
+  801ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb2:	eb 52                	jmp    801f06 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801eb4:	85 db                	test   %ebx,%ebx
+  801eb6:	74 e5                	je     801e9d <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801eb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ebb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebe:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801ec3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec6:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801ecb:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801ed1:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801ed7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eda:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ee9:	e8 46 fa ff ff       	call   801934 <fsipc>
+  801eee:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801ef0:	83 ec 0c             	sub    $0xc,%esp
+  801ef3:	68 04 70 80 00       	push   $0x807004
+  801ef8:	e8 2b 16 00 00       	call   803528 <mutex_unlock>
+	if (r < 0) {
+  801efd:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801f00:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801f02:	85 ff                	test   %edi,%edi
+  801f04:	78 08                	js     801f0e <mmap+0x146>
+}
+  801f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f09:	5b                   	pop    %ebx
+  801f0a:	5e                   	pop    %esi
+  801f0b:	5f                   	pop    %edi
+  801f0c:	5d                   	pop    %ebp
+  801f0d:	c3                   	ret
+		munmap((void*) va, len);
+  801f0e:	83 ec 08             	sub    $0x8,%esp
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	e8 71 fe ff ff       	call   801d89 <munmap>
+		return NULL;
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	eb e4                	jmp    801f06 <mmap+0x13e>
+		return NULL;
+  801f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f27:	eb dd                	jmp    801f06 <mmap+0x13e>
+		return NULL;
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	eb d6                	jmp    801f06 <mmap+0x13e>
+  801f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f35:	eb cf                	jmp    801f06 <mmap+0x13e>
+
+00801f37 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	53                   	push   %ebx
+  801f3b:	83 ec 10             	sub    $0x10,%esp
+  801f3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801f41:	53                   	push   %ebx
+  801f42:	e8 9b ea ff ff       	call   8009e2 <strlen>
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f4f:	7f 42                	jg     801f93 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801f51:	83 ec 0c             	sub    $0xc,%esp
+  801f54:	68 04 70 80 00       	push   $0x807004
+  801f59:	e8 5d 15 00 00       	call   8034bb <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801f5e:	83 c4 08             	add    $0x8,%esp
+  801f61:	53                   	push   %ebx
+  801f62:	68 00 80 80 00       	push   $0x808000
+  801f67:	e8 b1 ea ff ff       	call   800a1d <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f71:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f76:	e8 b9 f9 ff ff       	call   801934 <fsipc>
+  801f7b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f7d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f84:	e8 9f 15 00 00       	call   803528 <mutex_unlock>
+	return r;
+  801f89:	83 c4 10             	add    $0x10,%esp
+}
+  801f8c:	89 d8                	mov    %ebx,%eax
+  801f8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f91:	c9                   	leave
+  801f92:	c3                   	ret
+		return -E_BAD_PATH;
+  801f93:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f98:	eb f2                	jmp    801f8c <remove+0x55>
+
+00801f9a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	53                   	push   %ebx
+  801f9e:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801fa1:	68 04 70 80 00       	push   $0x807004
+  801fa6:	e8 10 15 00 00       	call   8034bb <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb0:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fb5:	e8 7a f9 ff ff       	call   801934 <fsipc>
+  801fba:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fbc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801fc3:	e8 60 15 00 00       	call   803528 <mutex_unlock>
+	return r;
+}
+  801fc8:	89 d8                	mov    %ebx,%eax
+  801fca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	56                   	push   %esi
+  801fd3:	53                   	push   %ebx
+  801fd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801fd7:	83 ec 0c             	sub    $0xc,%esp
+  801fda:	68 04 70 80 00       	push   $0x807004
+  801fdf:	e8 d7 14 00 00       	call   8034bb <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe7:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ff6:	e8 39 f9 ff ff       	call   801934 <fsipc>
+  801ffb:	89 c6                	mov    %eax,%esi
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 db                	test   %ebx,%ebx
+  802002:	74 7b                	je     80207f <fs_bcstat+0xb0>
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 77                	js     80207f <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802008:	a1 00 80 80 00       	mov    0x808000,%eax
+  80200d:	89 03                	mov    %eax,(%ebx)
+  80200f:	a1 04 80 80 00       	mov    0x808004,%eax
+  802014:	89 43 04             	mov    %eax,0x4(%ebx)
+  802017:	a1 08 80 80 00       	mov    0x808008,%eax
+  80201c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80201f:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802024:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802027:	a1 10 80 80 00       	mov    0x808010,%eax
+  80202c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80202f:	a1 14 80 80 00       	mov    0x808014,%eax
+  802034:	89 43 14             	mov    %eax,0x14(%ebx)
+  802037:	a1 18 80 80 00       	mov    0x808018,%eax
+  80203c:	89 43 18             	mov    %eax,0x18(%ebx)
+  80203f:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802044:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802047:	a1 20 80 80 00       	mov    0x808020,%eax
+  80204c:	89 43 20             	mov    %eax,0x20(%ebx)
+  80204f:	a1 24 80 80 00       	mov    0x808024,%eax
+  802054:	89 43 24             	mov    %eax,0x24(%ebx)
+  802057:	a1 28 80 80 00       	mov    0x808028,%eax
+  80205c:	89 43 28             	mov    %eax,0x28(%ebx)
+  80205f:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802064:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802067:	a1 30 80 80 00       	mov    0x808030,%eax
+  80206c:	89 43 30             	mov    %eax,0x30(%ebx)
+  80206f:	a1 34 80 80 00       	mov    0x808034,%eax
+  802074:	89 43 34             	mov    %eax,0x34(%ebx)
+  802077:	a1 38 80 80 00       	mov    0x808038,%eax
+  80207c:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80207f:	83 ec 0c             	sub    $0xc,%esp
+  802082:	68 04 70 80 00       	push   $0x807004
+  802087:	e8 9c 14 00 00       	call   803528 <mutex_unlock>
+	return r;
+}
+  80208c:	89 f0                	mov    %esi,%eax
+  80208e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802091:	5b                   	pop    %ebx
+  802092:	5e                   	pop    %esi
+  802093:	5d                   	pop    %ebp
+  802094:	c3                   	ret
+
+00802095 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80209c:	0f b6 10             	movzbl (%eax),%edx
+  80209f:	80 fa 72             	cmp    $0x72,%dl
+  8020a2:	74 44                	je     8020e8 <parse_mode+0x53>
+  8020a4:	80 fa 77             	cmp    $0x77,%dl
+  8020a7:	74 4b                	je     8020f4 <parse_mode+0x5f>
+  8020a9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020ae:	80 fa 61             	cmp    $0x61,%dl
+  8020b1:	74 09                	je     8020bc <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8020b3:	89 d8                	mov    %ebx,%eax
+  8020b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b8:	5b                   	pop    %ebx
+  8020b9:	5e                   	pop    %esi
+  8020ba:	5d                   	pop    %ebp
+  8020bb:	c3                   	ret
+	switch (mode[0]) {
+  8020bc:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8020c1:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8020c6:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8020c8:	83 ec 08             	sub    $0x8,%esp
+  8020cb:	6a 2b                	push   $0x2b
+  8020cd:	50                   	push   %eax
+  8020ce:	e8 5c ea ff ff       	call   800b2f <strchr>
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	74 d9                	je     8020b3 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8020da:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8020dd:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8020e0:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8020e6:	eb cb                	jmp    8020b3 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8020e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f2:	eb d2                	jmp    8020c6 <parse_mode+0x31>
+  8020f4:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8020f9:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8020fe:	eb c6                	jmp    8020c6 <parse_mode+0x31>
+
+00802100 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	57                   	push   %edi
+  802104:	56                   	push   %esi
+  802105:	53                   	push   %ebx
+  802106:	83 ec 1c             	sub    $0x1c,%esp
+  802109:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80210c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80210f:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802114:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802119:	83 c0 24             	add    $0x24,%eax
+  80211c:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802120:	74 17                	je     802139 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802122:	83 c3 01             	add    $0x1,%ebx
+  802125:	83 fb 10             	cmp    $0x10,%ebx
+  802128:	75 ef                	jne    802119 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80212a:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80212f:	89 f0                	mov    %esi,%eax
+  802131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802134:	5b                   	pop    %ebx
+  802135:	5e                   	pop    %esi
+  802136:	5f                   	pop    %edi
+  802137:	5d                   	pop    %ebp
+  802138:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802139:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802140:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802143:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802146:	c1 e7 02             	shl    $0x2,%edi
+  802149:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  80214f:	83 ec 04             	sub    $0x4,%esp
+  802152:	6a 24                	push   $0x24
+  802154:	6a 00                	push   $0x0
+  802156:	56                   	push   %esi
+  802157:	e8 12 ea ff ff       	call   800b6e <memset>
+			streams[i].f_fd = fd;
+  80215c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80215f:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802165:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802168:	01 d8                	add    %ebx,%eax
+  80216a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80216d:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	eb b6                	jmp    80212f <stream_alloc+0x2f>
+
+00802179 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802179:	55                   	push   %ebp
+  80217a:	89 e5                	mov    %esp,%ebp
+  80217c:	53                   	push   %ebx
+  80217d:	83 ec 14             	sub    $0x14,%esp
+  802180:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802182:	8b 40 18             	mov    0x18(%eax),%eax
+  802185:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802188:	74 4a                	je     8021d4 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80218a:	83 ec 08             	sub    $0x8,%esp
+  80218d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802190:	50                   	push   %eax
+  802191:	ff 33                	push   (%ebx)
+  802193:	e8 e2 f1 ff ff       	call   80137a <fd_lookup>
+  802198:	89 c2                	mov    %eax,%edx
+  80219a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80219d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8021a2:	85 d2                	test   %edx,%edx
+  8021a4:	78 41                	js     8021e7 <stream_unread+0x6e>
+  8021a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a9:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8021af:	39 0a                	cmp    %ecx,(%edx)
+  8021b1:	75 34                	jne    8021e7 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8021b3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8021b6:	03 42 04             	add    0x4(%edx),%eax
+  8021b9:	2b 43 18             	sub    0x18(%ebx),%eax
+  8021bc:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8021bf:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8021c6:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8021cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021d2:	eb 13                	jmp    8021e7 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8021d4:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8021db:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8021e2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8021e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+
+008021ec <stream_drain>:
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	56                   	push   %esi
+  8021f0:	53                   	push   %ebx
+  8021f1:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8021f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f8:	eb 02                	jmp    8021fc <stream_drain+0x10>
+  8021fa:	01 c3                	add    %eax,%ebx
+  8021fc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8021ff:	39 c3                	cmp    %eax,%ebx
+  802201:	73 43                	jae    802246 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802203:	83 ec 04             	sub    $0x4,%esp
+  802206:	29 d8                	sub    %ebx,%eax
+  802208:	50                   	push   %eax
+  802209:	89 d8                	mov    %ebx,%eax
+  80220b:	03 46 0c             	add    0xc(%esi),%eax
+  80220e:	50                   	push   %eax
+  80220f:	ff 36                	push   (%esi)
+  802211:	e8 ec f4 ff ff       	call   801702 <write>
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	7f dd                	jg     8021fa <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80221d:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802221:	8b 56 0c             	mov    0xc(%esi),%edx
+  802224:	83 ec 04             	sub    $0x4,%esp
+  802227:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80222a:	29 d8                	sub    %ebx,%eax
+  80222c:	50                   	push   %eax
+  80222d:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802230:	50                   	push   %eax
+  802231:	52                   	push   %edx
+  802232:	e8 6c e9 ff ff       	call   800ba3 <memmove>
+			f->f_wend -= done;
+  802237:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80223a:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80223c:	83 c4 10             	add    $0x10,%esp
+  80223f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802244:	eb 0a                	jmp    802250 <stream_drain+0x64>
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80224b:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802250:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802253:	89 d0                	mov    %edx,%eax
+  802255:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802258:	5b                   	pop    %ebx
+  802259:	5e                   	pop    %esi
+  80225a:	5d                   	pop    %ebp
+  80225b:	c3                   	ret
+
+0080225c <stream_setup>:
+	if (f->f_buf)
+  80225c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802260:	74 01                	je     802263 <stream_setup+0x7>
+  802262:	c3                   	ret
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	53                   	push   %ebx
+  802267:	83 ec 04             	sub    $0x4,%esp
+  80226a:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80226c:	8b 40 08             	mov    0x8(%eax),%eax
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	74 17                	je     80228a <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802273:	83 f8 03             	cmp    $0x3,%eax
+  802276:	75 2d                	jne    8022a5 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802278:	8d 43 20             	lea    0x20(%ebx),%eax
+  80227b:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80227e:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80228a:	83 ec 0c             	sub    $0xc,%esp
+  80228d:	ff 33                	push   (%ebx)
+  80228f:	e8 29 1b 00 00       	call   803dbd <iscons>
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	85 c0                	test   %eax,%eax
+  802299:	0f 9f c0             	setg   %al
+  80229c:	0f b6 c0             	movzbl %al,%eax
+  80229f:	83 c0 01             	add    $0x1,%eax
+  8022a2:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8022a5:	83 ec 0c             	sub    $0xc,%esp
+  8022a8:	68 00 10 00 00       	push   $0x1000
+  8022ad:	e8 6e 0b 00 00       	call   802e20 <malloc>
+  8022b2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	74 bc                	je     802278 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8022bc:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8022c3:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8022c7:	eb bc                	jmp    802285 <stream_setup+0x29>
+
+008022c9 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	53                   	push   %ebx
+  8022cd:	83 ec 04             	sub    $0x4,%esp
+  8022d0:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8022d2:	e8 85 ff ff ff       	call   80225c <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8022d7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8022dc:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8022e0:	74 3d                	je     80231f <stream_fill+0x56>
+  8022e2:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8022e6:	74 10                	je     8022f8 <stream_fill+0x2f>
+  8022e8:	89 d8                	mov    %ebx,%eax
+  8022ea:	e8 fd fe ff ff       	call   8021ec <stream_drain>
+		return 0;
+  8022ef:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	78 27                	js     80231f <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8022f8:	83 ec 04             	sub    $0x4,%esp
+  8022fb:	ff 73 10             	push   0x10(%ebx)
+  8022fe:	ff 73 0c             	push   0xc(%ebx)
+  802301:	ff 33                	push   (%ebx)
+  802303:	e8 02 f3 ff ff       	call   80160a <read>
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	7e 17                	jle    802326 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80230f:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802313:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80231a:	89 c2                	mov    %eax,%edx
+  80231c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80231f:	89 d0                	mov    %edx,%eax
+  802321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802324:	c9                   	leave
+  802325:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802326:	c1 f8 1f             	sar    $0x1f,%eax
+  802329:	83 e0 04             	and    $0x4,%eax
+  80232c:	83 c0 04             	add    $0x4,%eax
+  80232f:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802332:	ba 00 00 00 00       	mov    $0x0,%edx
+  802337:	eb e6                	jmp    80231f <stream_fill+0x56>
+
+00802339 <fopen>:
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	57                   	push   %edi
+  80233d:	56                   	push   %esi
+  80233e:	53                   	push   %ebx
+  80233f:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802345:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802348:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80234e:	89 f0                	mov    %esi,%eax
+  802350:	e8 40 fd ff ff       	call   802095 <parse_mode>
+		return 0;
+  802355:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80235a:	85 c0                	test   %eax,%eax
+  80235c:	78 2d                	js     80238b <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80235e:	83 ec 08             	sub    $0x8,%esp
+  802361:	50                   	push   %eax
+  802362:	ff 75 08             	push   0x8(%ebp)
+  802365:	e8 e8 f8 ff ff       	call   801c52 <open>
+  80236a:	89 c7                	mov    %eax,%edi
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 58                	js     8023cb <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802373:	80 3e 61             	cmpb   $0x61,(%esi)
+  802376:	74 1d                	je     802395 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802378:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80237e:	89 f8                	mov    %edi,%eax
+  802380:	e8 7b fd ff ff       	call   802100 <stream_alloc>
+  802385:	89 c3                	mov    %eax,%ebx
+  802387:	85 c0                	test   %eax,%eax
+  802389:	74 32                	je     8023bd <fopen+0x84>
+}
+  80238b:	89 d8                	mov    %ebx,%eax
+  80238d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802390:	5b                   	pop    %ebx
+  802391:	5e                   	pop    %esi
+  802392:	5f                   	pop    %edi
+  802393:	5d                   	pop    %ebp
+  802394:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802395:	83 ec 08             	sub    $0x8,%esp
+  802398:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80239e:	50                   	push   %eax
+  80239f:	57                   	push   %edi
+  8023a0:	e8 db f4 ff ff       	call   801880 <fstat>
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	78 cc                	js     802378 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	ff 75 dc             	push   -0x24(%ebp)
+  8023b2:	57                   	push   %edi
+  8023b3:	e8 f6 f3 ff ff       	call   8017ae <seek>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	eb bb                	jmp    802378 <fopen+0x3f>
+		close(fd);
+  8023bd:	83 ec 0c             	sub    $0xc,%esp
+  8023c0:	57                   	push   %edi
+  8023c1:	e8 08 f1 ff ff       	call   8014ce <close>
+  8023c6:	83 c4 10             	add    $0x10,%esp
+  8023c9:	eb c0                	jmp    80238b <fopen+0x52>
+		return 0;
+  8023cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023d0:	eb b9                	jmp    80238b <fopen+0x52>
+
+008023d2 <fdopen>:
+{
+  8023d2:	55                   	push   %ebp
+  8023d3:	89 e5                	mov    %esp,%ebp
+  8023d5:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8023d8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023de:	e8 b2 fc ff ff       	call   802095 <parse_mode>
+  8023e3:	89 c2                	mov    %eax,%edx
+		return 0;
+  8023e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8023ea:	85 d2                	test   %edx,%edx
+  8023ec:	78 0b                	js     8023f9 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8023ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	e8 07 fd ff ff       	call   802100 <stream_alloc>
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+008023fb <setvbuf>:
+{
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+  8023fe:	57                   	push   %edi
+  8023ff:	56                   	push   %esi
+  802400:	53                   	push   %ebx
+  802401:	8b 45 08             	mov    0x8(%ebp),%eax
+  802404:	8b 55 10             	mov    0x10(%ebp),%edx
+  802407:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80240a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80240e:	75 3a                	jne    80244a <setvbuf+0x4f>
+  802410:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802413:	83 fe 02             	cmp    $0x2,%esi
+  802416:	77 39                	ja     802451 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802418:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80241b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80241f:	0f 95 c3             	setne  %bl
+  802422:	85 ff                	test   %edi,%edi
+  802424:	0f 95 c1             	setne  %cl
+  802427:	84 cb                	test   %cl,%bl
+  802429:	74 05                	je     802430 <setvbuf+0x35>
+  80242b:	83 fa 03             	cmp    $0x3,%edx
+  80242e:	75 0a                	jne    80243a <setvbuf+0x3f>
+	return 0;
+  802430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802435:	5b                   	pop    %ebx
+  802436:	5e                   	pop    %esi
+  802437:	5f                   	pop    %edi
+  802438:	5d                   	pop    %ebp
+  802439:	c3                   	ret
+		f->f_buf = buf;
+  80243a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243d:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802440:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+  802448:	eb eb                	jmp    802435 <setvbuf+0x3a>
+		return EOF;
+  80244a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80244f:	eb e4                	jmp    802435 <setvbuf+0x3a>
+  802451:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802456:	eb dd                	jmp    802435 <setvbuf+0x3a>
+
+00802458 <fflush>:
+{
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	57                   	push   %edi
+  80245c:	56                   	push   %esi
+  80245d:	53                   	push   %ebx
+  80245e:	83 ec 0c             	sub    $0xc,%esp
+  802461:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802464:	85 db                	test   %ebx,%ebx
+  802466:	74 1a                	je     802482 <fflush+0x2a>
+	stream_unread(f);
+  802468:	89 d8                	mov    %ebx,%eax
+  80246a:	e8 0a fd ff ff       	call   802179 <stream_unread>
+	return stream_drain(f);
+  80246f:	89 d8                	mov    %ebx,%eax
+  802471:	e8 76 fd ff ff       	call   8021ec <stream_drain>
+  802476:	89 c7                	mov    %eax,%edi
+}
+  802478:	89 f8                	mov    %edi,%eax
+  80247a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247d:	5b                   	pop    %ebx
+  80247e:	5e                   	pop    %esi
+  80247f:	5f                   	pop    %edi
+  802480:	5d                   	pop    %ebp
+  802481:	c3                   	ret
+  802482:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802487:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80248c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802491:	eb 03                	jmp    802496 <fflush+0x3e>
+  802493:	83 c3 24             	add    $0x24,%ebx
+  802496:	39 f3                	cmp    %esi,%ebx
+  802498:	74 de                	je     802478 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80249a:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80249e:	74 f3                	je     802493 <fflush+0x3b>
+  8024a0:	83 ec 0c             	sub    $0xc,%esp
+  8024a3:	53                   	push   %ebx
+  8024a4:	e8 af ff ff ff       	call   802458 <fflush>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8024ac:	85 c0                	test   %eax,%eax
+  8024ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024b3:	0f 48 f8             	cmovs  %eax,%edi
+  8024b6:	eb db                	jmp    802493 <fflush+0x3b>
+
+008024b8 <fclose>:
+{
+  8024b8:	55                   	push   %ebp
+  8024b9:	89 e5                	mov    %esp,%ebp
+  8024bb:	56                   	push   %esi
+  8024bc:	53                   	push   %ebx
+  8024bd:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8024c0:	83 ec 0c             	sub    $0xc,%esp
+  8024c3:	56                   	push   %esi
+  8024c4:	e8 8f ff ff ff       	call   802458 <fflush>
+  8024c9:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8024cb:	83 c4 04             	add    $0x4,%esp
+  8024ce:	ff 36                	push   (%esi)
+  8024d0:	e8 f9 ef ff ff       	call   8014ce <close>
+  8024d5:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024df:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8024e2:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8024e6:	75 10                	jne    8024f8 <fclose+0x40>
+	f->f_flags = 0;
+  8024e8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8024ef:	89 d8                	mov    %ebx,%eax
+  8024f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f4:	5b                   	pop    %ebx
+  8024f5:	5e                   	pop    %esi
+  8024f6:	5d                   	pop    %ebp
+  8024f7:	c3                   	ret
+		free(f->f_buf);
+  8024f8:	83 ec 0c             	sub    $0xc,%esp
+  8024fb:	ff 76 0c             	push   0xc(%esi)
+  8024fe:	e8 54 08 00 00       	call   802d57 <free>
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	eb e0                	jmp    8024e8 <fclose+0x30>
+
+00802508 <fileno>:
+{
+  802508:	55                   	push   %ebp
+  802509:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80250b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250e:	8b 00                	mov    (%eax),%eax
+}
+  802510:	5d                   	pop    %ebp
+  802511:	c3                   	ret
+
+00802512 <feof>:
+{
+  802512:	55                   	push   %ebp
+  802513:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802515:	8b 45 08             	mov    0x8(%ebp),%eax
+  802518:	8b 40 04             	mov    0x4(%eax),%eax
+  80251b:	c1 e8 02             	shr    $0x2,%eax
+  80251e:	83 e0 01             	and    $0x1,%eax
+}
+  802521:	5d                   	pop    %ebp
+  802522:	c3                   	ret
+
+00802523 <ferror>:
+{
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802526:	8b 45 08             	mov    0x8(%ebp),%eax
+  802529:	8b 40 04             	mov    0x4(%eax),%eax
+  80252c:	c1 e8 03             	shr    $0x3,%eax
+  80252f:	83 e0 01             	and    $0x1,%eax
+}
+  802532:	5d                   	pop    %ebp
+  802533:	c3                   	ret
+
+00802534 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802534:	55                   	push   %ebp
+  802535:	89 e5                	mov    %esp,%ebp
+  802537:	53                   	push   %ebx
+  802538:	83 ec 04             	sub    $0x4,%esp
+  80253b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80253e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802541:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802544:	74 15                	je     80255b <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802546:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802549:	8b 43 14             	mov    0x14(%ebx),%eax
+  80254c:	8d 48 01             	lea    0x1(%eax),%ecx
+  80254f:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802552:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802556:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802559:	c9                   	leave
+  80255a:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80255b:	89 d8                	mov    %ebx,%eax
+  80255d:	e8 67 fd ff ff       	call   8022c9 <stream_fill>
+  802562:	85 c0                	test   %eax,%eax
+  802564:	75 e0                	jne    802546 <fgetc+0x12>
+		return EOF;
+  802566:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80256b:	eb e9                	jmp    802556 <fgetc+0x22>
+
+0080256d <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	57                   	push   %edi
+  802571:	56                   	push   %esi
+  802572:	53                   	push   %ebx
+  802573:	83 ec 1c             	sub    $0x1c,%esp
+  802576:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802579:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80257e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802581:	83 e8 01             	sub    $0x1,%eax
+  802584:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802587:	eb 66                	jmp    8025ef <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802589:	8b 46 14             	mov    0x14(%esi),%eax
+  80258c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80258f:	29 c3                	sub    %eax,%ebx
+  802591:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802594:	29 fa                	sub    %edi,%edx
+  802596:	39 d3                	cmp    %edx,%ebx
+  802598:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80259b:	83 ec 04             	sub    $0x4,%esp
+  80259e:	53                   	push   %ebx
+  80259f:	6a 0a                	push   $0xa
+  8025a1:	03 46 0c             	add    0xc(%esi),%eax
+  8025a4:	50                   	push   %eax
+  8025a5:	e8 aa e6 ff ff       	call   800c54 <memfind>
+  8025aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8025ad:	8b 46 0c             	mov    0xc(%esi),%eax
+  8025b0:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8025b3:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8025b6:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025be:	74 0b                	je     8025cb <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8025c0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025c3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025c6:	29 d3                	sub    %edx,%ebx
+  8025c8:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8025cb:	83 ec 04             	sub    $0x4,%esp
+  8025ce:	53                   	push   %ebx
+  8025cf:	01 c8                	add    %ecx,%eax
+  8025d1:	50                   	push   %eax
+  8025d2:	89 f8                	mov    %edi,%eax
+  8025d4:	03 45 08             	add    0x8(%ebp),%eax
+  8025d7:	50                   	push   %eax
+  8025d8:	e8 c6 e5 ff ff       	call   800ba3 <memmove>
+		f->f_rpos += m;
+  8025dd:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8025e0:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8025e2:	83 c4 10             	add    $0x10,%esp
+  8025e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e8:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8025ed:	74 1f                	je     80260e <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8025ef:	8d 47 01             	lea    0x1(%edi),%eax
+  8025f2:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8025f5:	73 17                	jae    80260e <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8025f7:	8b 46 18             	mov    0x18(%esi),%eax
+  8025fa:	39 46 14             	cmp    %eax,0x14(%esi)
+  8025fd:	75 8a                	jne    802589 <fgets+0x1c>
+  8025ff:	89 f0                	mov    %esi,%eax
+  802601:	e8 c3 fc ff ff       	call   8022c9 <stream_fill>
+  802606:	85 c0                	test   %eax,%eax
+  802608:	0f 85 7b ff ff ff    	jne    802589 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80260e:	85 ff                	test   %edi,%edi
+  802610:	74 0f                	je     802621 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802612:	8b 45 08             	mov    0x8(%ebp),%eax
+  802615:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80261c:	5b                   	pop    %ebx
+  80261d:	5e                   	pop    %esi
+  80261e:	5f                   	pop    %edi
+  80261f:	5d                   	pop    %ebp
+  802620:	c3                   	ret
+		return 0;
+  802621:	b8 00 00 00 00       	mov    $0x0,%eax
+  802626:	eb f1                	jmp    802619 <fgets+0xac>
+
+00802628 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802628:	55                   	push   %ebp
+  802629:	89 e5                	mov    %esp,%ebp
+  80262b:	57                   	push   %edi
+  80262c:	56                   	push   %esi
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 1c             	sub    $0x1c,%esp
+  802631:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802634:	89 f0                	mov    %esi,%eax
+  802636:	e8 21 fc ff ff       	call   80225c <stream_setup>
+	want = size * n;
+  80263b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80263e:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802642:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802645:	bf 00 00 00 00       	mov    $0x0,%edi
+  80264a:	eb 43                	jmp    80268f <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80264c:	29 d3                	sub    %edx,%ebx
+  80264e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802651:	29 f8                	sub    %edi,%eax
+  802653:	39 c3                	cmp    %eax,%ebx
+  802655:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802658:	83 ec 04             	sub    $0x4,%esp
+  80265b:	53                   	push   %ebx
+  80265c:	03 56 0c             	add    0xc(%esi),%edx
+  80265f:	52                   	push   %edx
+  802660:	89 f8                	mov    %edi,%eax
+  802662:	03 45 08             	add    0x8(%ebp),%eax
+  802665:	50                   	push   %eax
+  802666:	e8 38 e5 ff ff       	call   800ba3 <memmove>
+			f->f_rpos += m;
+  80266b:	01 5e 14             	add    %ebx,0x14(%esi)
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	eb 1a                	jmp    80268d <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802673:	83 ec 04             	sub    $0x4,%esp
+  802676:	53                   	push   %ebx
+  802677:	89 f8                	mov    %edi,%eax
+  802679:	03 45 08             	add    0x8(%ebp),%eax
+  80267c:	50                   	push   %eax
+  80267d:	ff 36                	push   (%esi)
+  80267f:	e8 86 ef ff ff       	call   80160a <read>
+  802684:	89 c3                	mov    %eax,%ebx
+  802686:	83 c4 10             	add    $0x10,%esp
+  802689:	85 c0                	test   %eax,%eax
+  80268b:	7e 36                	jle    8026c3 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80268d:	01 df                	add    %ebx,%edi
+  80268f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802692:	39 c7                	cmp    %eax,%edi
+  802694:	73 39                	jae    8026cf <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802696:	8b 56 14             	mov    0x14(%esi),%edx
+  802699:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80269c:	39 da                	cmp    %ebx,%edx
+  80269e:	72 ac                	jb     80264c <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8026a0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8026a3:	29 fb                	sub    %edi,%ebx
+  8026a5:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8026a8:	72 3e                	jb     8026e8 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8026aa:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8026ae:	74 1f                	je     8026cf <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8026b0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8026b4:	74 bd                	je     802673 <fread+0x4b>
+  8026b6:	89 f0                	mov    %esi,%eax
+  8026b8:	e8 2f fb ff ff       	call   8021ec <stream_drain>
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	79 b2                	jns    802673 <fread+0x4b>
+  8026c1:	eb 0c                	jmp    8026cf <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8026c3:	c1 fb 1f             	sar    $0x1f,%ebx
+  8026c6:	83 e3 04             	and    $0x4,%ebx
+  8026c9:	83 c3 04             	add    $0x4,%ebx
+  8026cc:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8026cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	74 0a                	je     8026e0 <fread+0xb8>
+  8026d6:	89 f8                	mov    %edi,%eax
+  8026d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026dd:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8026e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e3:	5b                   	pop    %ebx
+  8026e4:	5e                   	pop    %esi
+  8026e5:	5f                   	pop    %edi
+  8026e6:	5d                   	pop    %ebp
+  8026e7:	c3                   	ret
+		} else if (!stream_fill(f))
+  8026e8:	89 f0                	mov    %esi,%eax
+  8026ea:	e8 da fb ff ff       	call   8022c9 <stream_fill>
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	74 dc                	je     8026cf <fread+0xa7>
+			m = 0;
+  8026f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026f8:	eb 93                	jmp    80268d <fread+0x65>
+
+008026fa <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8026fa:	55                   	push   %ebp
+  8026fb:	89 e5                	mov    %esp,%ebp
+  8026fd:	57                   	push   %edi
+  8026fe:	56                   	push   %esi
+  8026ff:	53                   	push   %ebx
+  802700:	83 ec 1c             	sub    $0x1c,%esp
+  802703:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802706:	8b 43 04             	mov    0x4(%ebx),%eax
+  802709:	a8 02                	test   $0x2,%al
+  80270b:	75 13                	jne    802720 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80270d:	83 c8 08             	or     $0x8,%eax
+  802710:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802713:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271b:	5b                   	pop    %ebx
+  80271c:	5e                   	pop    %esi
+  80271d:	5f                   	pop    %edi
+  80271e:	5d                   	pop    %ebp
+  80271f:	c3                   	ret
+	stream_setup(f);
+  802720:	89 d8                	mov    %ebx,%eax
+  802722:	e8 35 fb ff ff       	call   80225c <stream_setup>
+	want = size * n;
+  802727:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80272a:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80272e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802731:	89 d8                	mov    %ebx,%eax
+  802733:	e8 41 fa ff ff       	call   802179 <stream_unread>
+	for (done = 0; done < want; ) {
+  802738:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80273d:	84 c0                	test   %al,%al
+  80273f:	75 7b                	jne    8027bc <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802741:	be 00 00 00 00       	mov    $0x0,%esi
+  802746:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802749:	39 fe                	cmp    %edi,%esi
+  80274b:	73 24                	jae    802771 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80274d:	83 ec 04             	sub    $0x4,%esp
+  802750:	89 f8                	mov    %edi,%eax
+  802752:	29 f0                	sub    %esi,%eax
+  802754:	50                   	push   %eax
+  802755:	89 f0                	mov    %esi,%eax
+  802757:	03 45 08             	add    0x8(%ebp),%eax
+  80275a:	50                   	push   %eax
+  80275b:	ff 33                	push   (%ebx)
+  80275d:	e8 a0 ef ff ff       	call   801702 <write>
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	85 c0                	test   %eax,%eax
+  802767:	7e 04                	jle    80276d <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802769:	01 c6                	add    %eax,%esi
+  80276b:	eb dc                	jmp    802749 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80276d:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802771:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802774:	85 c0                	test   %eax,%eax
+  802776:	74 a0                	je     802718 <fwrite+0x1e>
+  802778:	89 f0                	mov    %esi,%eax
+  80277a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80277f:	f7 75 0c             	divl   0xc(%ebp)
+  802782:	eb 94                	jmp    802718 <fwrite+0x1e>
+			done += r;
+  802784:	01 c7                	add    %eax,%edi
+			continue;
+  802786:	eb 34                	jmp    8027bc <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802788:	8b 73 10             	mov    0x10(%ebx),%esi
+  80278b:	29 c6                	sub    %eax,%esi
+  80278d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802790:	29 fa                	sub    %edi,%edx
+  802792:	39 d6                	cmp    %edx,%esi
+  802794:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802797:	83 ec 04             	sub    $0x4,%esp
+  80279a:	56                   	push   %esi
+  80279b:	89 fa                	mov    %edi,%edx
+  80279d:	03 55 08             	add    0x8(%ebp),%edx
+  8027a0:	52                   	push   %edx
+  8027a1:	03 43 0c             	add    0xc(%ebx),%eax
+  8027a4:	50                   	push   %eax
+  8027a5:	e8 f9 e3 ff ff       	call   800ba3 <memmove>
+		f->f_wend += m;
+  8027aa:	89 f0                	mov    %esi,%eax
+  8027ac:	03 43 1c             	add    0x1c(%ebx),%eax
+  8027af:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8027b2:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8027b4:	83 c4 10             	add    $0x10,%esp
+  8027b7:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8027ba:	74 5b                	je     802817 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8027bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027bf:	39 c7                	cmp    %eax,%edi
+  8027c1:	73 2d                	jae    8027f0 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8027c3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	75 be                	jne    802788 <fwrite+0x8e>
+  8027ca:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027cd:	29 fa                	sub    %edi,%edx
+  8027cf:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8027d2:	72 b4                	jb     802788 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8027d4:	83 ec 04             	sub    $0x4,%esp
+  8027d7:	52                   	push   %edx
+  8027d8:	89 f8                	mov    %edi,%eax
+  8027da:	03 45 08             	add    0x8(%ebp),%eax
+  8027dd:	50                   	push   %eax
+  8027de:	ff 33                	push   (%ebx)
+  8027e0:	e8 1d ef ff ff       	call   801702 <write>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	7f 98                	jg     802784 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8027ec:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8027f0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8027f3:	83 f8 03             	cmp    $0x3,%eax
+  8027f6:	74 48                	je     802840 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8027f8:	83 f8 02             	cmp    $0x2,%eax
+  8027fb:	74 27                	je     802824 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8027fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802800:	85 c0                	test   %eax,%eax
+  802802:	0f 84 10 ff ff ff    	je     802718 <fwrite+0x1e>
+  802808:	89 f8                	mov    %edi,%eax
+  80280a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280f:	f7 75 0c             	divl   0xc(%ebp)
+  802812:	e9 01 ff ff ff       	jmp    802718 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802817:	89 d8                	mov    %ebx,%eax
+  802819:	e8 ce f9 ff ff       	call   8021ec <stream_drain>
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	79 9a                	jns    8027bc <fwrite+0xc2>
+  802822:	eb cc                	jmp    8027f0 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802824:	83 ec 04             	sub    $0x4,%esp
+  802827:	57                   	push   %edi
+  802828:	6a 0a                	push   $0xa
+  80282a:	ff 75 08             	push   0x8(%ebp)
+  80282d:	e8 22 e4 ff ff       	call   800c54 <memfind>
+  802832:	89 c2                	mov    %eax,%edx
+  802834:	89 f8                	mov    %edi,%eax
+  802836:	03 45 08             	add    0x8(%ebp),%eax
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	39 c2                	cmp    %eax,%edx
+  80283e:	74 bd                	je     8027fd <fwrite+0x103>
+		stream_drain(f);
+  802840:	89 d8                	mov    %ebx,%eax
+  802842:	e8 a5 f9 ff ff       	call   8021ec <stream_drain>
+  802847:	eb b4                	jmp    8027fd <fwrite+0x103>
+
+00802849 <fputc>:
+{
+  802849:	55                   	push   %ebp
+  80284a:	89 e5                	mov    %esp,%ebp
+  80284c:	53                   	push   %ebx
+  80284d:	83 ec 14             	sub    $0x14,%esp
+  802850:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802853:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802856:	ff 75 0c             	push   0xc(%ebp)
+  802859:	6a 01                	push   $0x1
+  80285b:	6a 01                	push   $0x1
+  80285d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802860:	50                   	push   %eax
+  802861:	e8 94 fe ff ff       	call   8026fa <fwrite>
+  802866:	83 c4 10             	add    $0x10,%esp
+  802869:	0f b6 db             	movzbl %bl,%ebx
+  80286c:	83 f8 01             	cmp    $0x1,%eax
+  80286f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802874:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+
+0080287c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802882:	ff 75 0c             	push   0xc(%ebp)
+  802885:	ff 75 08             	push   0x8(%ebp)
+  802888:	e8 bc ff ff ff       	call   802849 <fputc>
+}
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	c9                   	leave
+  802891:	c3                   	ret
+
+00802892 <fputs>:
+{
+  802892:	55                   	push   %ebp
+  802893:	89 e5                	mov    %esp,%ebp
+  802895:	56                   	push   %esi
+  802896:	53                   	push   %ebx
+  802897:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80289a:	83 ec 0c             	sub    $0xc,%esp
+  80289d:	56                   	push   %esi
+  80289e:	e8 3f e1 ff ff       	call   8009e2 <strlen>
+  8028a3:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8028a5:	ff 75 0c             	push   0xc(%ebp)
+  8028a8:	50                   	push   %eax
+  8028a9:	6a 01                	push   $0x1
+  8028ab:	56                   	push   %esi
+  8028ac:	e8 49 fe ff ff       	call   8026fa <fwrite>
+  8028b1:	83 c4 20             	add    $0x20,%esp
+  8028b4:	39 d8                	cmp    %ebx,%eax
+  8028b6:	0f 95 c0             	setne  %al
+  8028b9:	0f b6 c0             	movzbl %al,%eax
+  8028bc:	f7 d8                	neg    %eax
+}
+  8028be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c1:	5b                   	pop    %ebx
+  8028c2:	5e                   	pop    %esi
+  8028c3:	5d                   	pop    %ebp
+  8028c4:	c3                   	ret
+
+008028c5 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	53                   	push   %ebx
+  8028c9:	83 ec 04             	sub    $0x4,%esp
+  8028cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8028cf:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8028d2:	50                   	push   %eax
+  8028d3:	ff 75 0c             	push   0xc(%ebp)
+  8028d6:	53                   	push   %ebx
+  8028d7:	68 7c 28 80 00       	push   $0x80287c
+  8028dc:	e8 4f dc ff ff       	call   800530 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8028e1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028e4:	c1 e0 1c             	shl    $0x1c,%eax
+  8028e7:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8028ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ed:	c9                   	leave
+  8028ee:	c3                   	ret
+
+008028ef <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8028f5:	68 98 4e 80 00       	push   $0x804e98
+  8028fa:	ff 75 0c             	push   0xc(%ebp)
+  8028fd:	e8 1b e1 ff ff       	call   800a1d <strcpy>
+	return 0;
+}
+  802902:	b8 00 00 00 00       	mov    $0x0,%eax
+  802907:	c9                   	leave
+  802908:	c3                   	ret
+
+00802909 <devsock_close>:
+{
+  802909:	55                   	push   %ebp
+  80290a:	89 e5                	mov    %esp,%ebp
+  80290c:	53                   	push   %ebx
+  80290d:	83 ec 10             	sub    $0x10,%esp
+  802910:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802913:	53                   	push   %ebx
+  802914:	e8 23 1d 00 00       	call   80463c <pageref>
+  802919:	89 c2                	mov    %eax,%edx
+  80291b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802923:	83 fa 01             	cmp    $0x1,%edx
+  802926:	74 05                	je     80292d <devsock_close+0x24>
+}
+  802928:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80292b:	c9                   	leave
+  80292c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80292d:	83 ec 0c             	sub    $0xc,%esp
+  802930:	ff 73 0c             	push   0xc(%ebx)
+  802933:	e8 b7 02 00 00       	call   802bef <nsipc_close>
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	eb eb                	jmp    802928 <devsock_close+0x1f>
+
+0080293d <devsock_write>:
+{
+  80293d:	55                   	push   %ebp
+  80293e:	89 e5                	mov    %esp,%ebp
+  802940:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802943:	6a 00                	push   $0x0
+  802945:	ff 75 10             	push   0x10(%ebp)
+  802948:	ff 75 0c             	push   0xc(%ebp)
+  80294b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294e:	ff 70 0c             	push   0xc(%eax)
+  802951:	e8 79 03 00 00       	call   802ccf <nsipc_send>
+}
+  802956:	c9                   	leave
+  802957:	c3                   	ret
+
+00802958 <devsock_read>:
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80295e:	6a 00                	push   $0x0
+  802960:	ff 75 10             	push   0x10(%ebp)
+  802963:	ff 75 0c             	push   0xc(%ebp)
+  802966:	8b 45 08             	mov    0x8(%ebp),%eax
+  802969:	ff 70 0c             	push   0xc(%eax)
+  80296c:	e8 ef 02 00 00       	call   802c60 <nsipc_recv>
+}
+  802971:	c9                   	leave
+  802972:	c3                   	ret
+
+00802973 <fd2sockid>:
+{
+  802973:	55                   	push   %ebp
+  802974:	89 e5                	mov    %esp,%ebp
+  802976:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802979:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80297c:	52                   	push   %edx
+  80297d:	50                   	push   %eax
+  80297e:	e8 f7 e9 ff ff       	call   80137a <fd_lookup>
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	85 c0                	test   %eax,%eax
+  802988:	78 10                	js     80299a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80298a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298d:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802993:	39 08                	cmp    %ecx,(%eax)
+  802995:	75 05                	jne    80299c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802997:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80299c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029a1:	eb f7                	jmp    80299a <fd2sockid+0x27>
+
+008029a3 <alloc_sockfd>:
+{
+  8029a3:	55                   	push   %ebp
+  8029a4:	89 e5                	mov    %esp,%ebp
+  8029a6:	56                   	push   %esi
+  8029a7:	53                   	push   %ebx
+  8029a8:	83 ec 1c             	sub    $0x1c,%esp
+  8029ab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8029ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b0:	50                   	push   %eax
+  8029b1:	e8 6e e9 ff ff       	call   801324 <fd_alloc>
+  8029b6:	89 c3                	mov    %eax,%ebx
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	78 43                	js     802a02 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8029bf:	83 ec 04             	sub    $0x4,%esp
+  8029c2:	68 07 04 00 00       	push   $0x407
+  8029c7:	ff 75 f4             	push   -0xc(%ebp)
+  8029ca:	6a 00                	push   $0x0
+  8029cc:	e8 8a e4 ff ff       	call   800e5b <sys_page_alloc>
+  8029d1:	89 c3                	mov    %eax,%ebx
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	85 c0                	test   %eax,%eax
+  8029d8:	78 28                	js     802a02 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8029da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029dd:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8029e3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8029e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8029ef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8029f2:	83 ec 0c             	sub    $0xc,%esp
+  8029f5:	50                   	push   %eax
+  8029f6:	e8 02 e9 ff ff       	call   8012fd <fd2num>
+  8029fb:	89 c3                	mov    %eax,%ebx
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	eb 0c                	jmp    802a0e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	56                   	push   %esi
+  802a06:	e8 e4 01 00 00       	call   802bef <nsipc_close>
+		return r;
+  802a0b:	83 c4 10             	add    $0x10,%esp
+}
+  802a0e:	89 d8                	mov    %ebx,%eax
+  802a10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a13:	5b                   	pop    %ebx
+  802a14:	5e                   	pop    %esi
+  802a15:	5d                   	pop    %ebp
+  802a16:	c3                   	ret
+
+00802a17 <accept>:
+{
+  802a17:	55                   	push   %ebp
+  802a18:	89 e5                	mov    %esp,%ebp
+  802a1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a20:	e8 4e ff ff ff       	call   802973 <fd2sockid>
+  802a25:	85 c0                	test   %eax,%eax
+  802a27:	78 1b                	js     802a44 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a29:	83 ec 04             	sub    $0x4,%esp
+  802a2c:	ff 75 10             	push   0x10(%ebp)
+  802a2f:	ff 75 0c             	push   0xc(%ebp)
+  802a32:	50                   	push   %eax
+  802a33:	e8 0e 01 00 00       	call   802b46 <nsipc_accept>
+  802a38:	83 c4 10             	add    $0x10,%esp
+  802a3b:	85 c0                	test   %eax,%eax
+  802a3d:	78 05                	js     802a44 <accept+0x2d>
+	return alloc_sockfd(r);
+  802a3f:	e8 5f ff ff ff       	call   8029a3 <alloc_sockfd>
+}
+  802a44:	c9                   	leave
+  802a45:	c3                   	ret
+
+00802a46 <bind>:
+{
+  802a46:	55                   	push   %ebp
+  802a47:	89 e5                	mov    %esp,%ebp
+  802a49:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4f:	e8 1f ff ff ff       	call   802973 <fd2sockid>
+  802a54:	85 c0                	test   %eax,%eax
+  802a56:	78 12                	js     802a6a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a58:	83 ec 04             	sub    $0x4,%esp
+  802a5b:	ff 75 10             	push   0x10(%ebp)
+  802a5e:	ff 75 0c             	push   0xc(%ebp)
+  802a61:	50                   	push   %eax
+  802a62:	e8 31 01 00 00       	call   802b98 <nsipc_bind>
+  802a67:	83 c4 10             	add    $0x10,%esp
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+00802a6c <shutdown>:
+{
+  802a6c:	55                   	push   %ebp
+  802a6d:	89 e5                	mov    %esp,%ebp
+  802a6f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a75:	e8 f9 fe ff ff       	call   802973 <fd2sockid>
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	78 0f                	js     802a8d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a7e:	83 ec 08             	sub    $0x8,%esp
+  802a81:	ff 75 0c             	push   0xc(%ebp)
+  802a84:	50                   	push   %eax
+  802a85:	e8 43 01 00 00       	call   802bcd <nsipc_shutdown>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+}
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <connect>:
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a98:	e8 d6 fe ff ff       	call   802973 <fd2sockid>
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	78 12                	js     802ab3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802aa1:	83 ec 04             	sub    $0x4,%esp
+  802aa4:	ff 75 10             	push   0x10(%ebp)
+  802aa7:	ff 75 0c             	push   0xc(%ebp)
+  802aaa:	50                   	push   %eax
+  802aab:	e8 59 01 00 00       	call   802c09 <nsipc_connect>
+  802ab0:	83 c4 10             	add    $0x10,%esp
+}
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+00802ab5 <listen>:
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802abb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abe:	e8 b0 fe ff ff       	call   802973 <fd2sockid>
+  802ac3:	85 c0                	test   %eax,%eax
+  802ac5:	78 0f                	js     802ad6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ac7:	83 ec 08             	sub    $0x8,%esp
+  802aca:	ff 75 0c             	push   0xc(%ebp)
+  802acd:	50                   	push   %eax
+  802ace:	e8 6b 01 00 00       	call   802c3e <nsipc_listen>
+  802ad3:	83 c4 10             	add    $0x10,%esp
+}
+  802ad6:	c9                   	leave
+  802ad7:	c3                   	ret
+
+00802ad8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ad8:	55                   	push   %ebp
+  802ad9:	89 e5                	mov    %esp,%ebp
+  802adb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802ade:	ff 75 10             	push   0x10(%ebp)
+  802ae1:	ff 75 0c             	push   0xc(%ebp)
+  802ae4:	ff 75 08             	push   0x8(%ebp)
+  802ae7:	e8 41 02 00 00       	call   802d2d <nsipc_socket>
+  802aec:	83 c4 10             	add    $0x10,%esp
+  802aef:	85 c0                	test   %eax,%eax
+  802af1:	78 05                	js     802af8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802af3:	e8 ab fe ff ff       	call   8029a3 <alloc_sockfd>
+}
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	53                   	push   %ebx
+  802afe:	83 ec 04             	sub    $0x4,%esp
+  802b01:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b03:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802b0a:	74 26                	je     802b32 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b0c:	6a 07                	push   $0x7
+  802b0e:	68 00 90 80 00       	push   $0x809000
+  802b13:	53                   	push   %ebx
+  802b14:	ff 35 08 70 80 00    	push   0x807008
+  802b1a:	e8 88 1a 00 00       	call   8045a7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b1f:	83 c4 0c             	add    $0xc,%esp
+  802b22:	6a 00                	push   $0x0
+  802b24:	6a 00                	push   $0x0
+  802b26:	6a 00                	push   $0x0
+  802b28:	e8 84 19 00 00       	call   8044b1 <ipc_recv>
+}
+  802b2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b30:	c9                   	leave
+  802b31:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b32:	83 ec 0c             	sub    $0xc,%esp
+  802b35:	6a 02                	push   $0x2
+  802b37:	e8 c1 1a 00 00       	call   8045fd <ipc_find_env>
+  802b3c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	eb c6                	jmp    802b0c <nsipc+0x12>
+
+00802b46 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	56                   	push   %esi
+  802b4a:	53                   	push   %ebx
+  802b4b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b51:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802b56:	8b 06                	mov    (%esi),%eax
+  802b58:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b62:	e8 93 ff ff ff       	call   802afa <nsipc>
+  802b67:	89 c3                	mov    %eax,%ebx
+  802b69:	85 c0                	test   %eax,%eax
+  802b6b:	79 09                	jns    802b76 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b6d:	89 d8                	mov    %ebx,%eax
+  802b6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b72:	5b                   	pop    %ebx
+  802b73:	5e                   	pop    %esi
+  802b74:	5d                   	pop    %ebp
+  802b75:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b76:	83 ec 04             	sub    $0x4,%esp
+  802b79:	ff 35 10 90 80 00    	push   0x809010
+  802b7f:	68 00 90 80 00       	push   $0x809000
+  802b84:	ff 75 0c             	push   0xc(%ebp)
+  802b87:	e8 17 e0 ff ff       	call   800ba3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b8c:	a1 10 90 80 00       	mov    0x809010,%eax
+  802b91:	89 06                	mov    %eax,(%esi)
+  802b93:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b96:	eb d5                	jmp    802b6d <nsipc_accept+0x27>
+
+00802b98 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b98:	55                   	push   %ebp
+  802b99:	89 e5                	mov    %esp,%ebp
+  802b9b:	53                   	push   %ebx
+  802b9c:	83 ec 08             	sub    $0x8,%esp
+  802b9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba5:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802baa:	53                   	push   %ebx
+  802bab:	ff 75 0c             	push   0xc(%ebp)
+  802bae:	68 04 90 80 00       	push   $0x809004
+  802bb3:	e8 eb df ff ff       	call   800ba3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802bb8:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802bbe:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bc3:	e8 32 ff ff ff       	call   802afa <nsipc>
+}
+  802bc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+00802bcd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802bdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bde:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802be3:	b8 03 00 00 00       	mov    $0x3,%eax
+  802be8:	e8 0d ff ff ff       	call   802afa <nsipc>
+}
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+
+00802bef <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802bf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf8:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802bfd:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c02:	e8 f3 fe ff ff       	call   802afa <nsipc>
+}
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+00802c09 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	53                   	push   %ebx
+  802c0d:	83 ec 08             	sub    $0x8,%esp
+  802c10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c16:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c1b:	53                   	push   %ebx
+  802c1c:	ff 75 0c             	push   0xc(%ebp)
+  802c1f:	68 04 90 80 00       	push   $0x809004
+  802c24:	e8 7a df ff ff       	call   800ba3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c29:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802c2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c34:	e8 c1 fe ff ff       	call   802afa <nsipc>
+}
+  802c39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3c:	c9                   	leave
+  802c3d:	c3                   	ret
+
+00802c3e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c47:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c4f:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802c54:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c59:	e8 9c fe ff ff       	call   802afa <nsipc>
+}
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+
+00802c60 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	56                   	push   %esi
+  802c64:	53                   	push   %ebx
+  802c65:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802c70:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802c76:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c79:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c7e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c83:	e8 72 fe ff ff       	call   802afa <nsipc>
+  802c88:	89 c3                	mov    %eax,%ebx
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	78 22                	js     802cb0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c8e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c93:	39 c6                	cmp    %eax,%esi
+  802c95:	0f 4e c6             	cmovle %esi,%eax
+  802c98:	39 c3                	cmp    %eax,%ebx
+  802c9a:	7f 1d                	jg     802cb9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c9c:	83 ec 04             	sub    $0x4,%esp
+  802c9f:	53                   	push   %ebx
+  802ca0:	68 00 90 80 00       	push   $0x809000
+  802ca5:	ff 75 0c             	push   0xc(%ebp)
+  802ca8:	e8 f6 de ff ff       	call   800ba3 <memmove>
+  802cad:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802cb0:	89 d8                	mov    %ebx,%eax
+  802cb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cb5:	5b                   	pop    %ebx
+  802cb6:	5e                   	pop    %esi
+  802cb7:	5d                   	pop    %ebp
+  802cb8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802cb9:	68 a4 4e 80 00       	push   $0x804ea4
+  802cbe:	68 5d 4e 80 00       	push   $0x804e5d
+  802cc3:	6a 62                	push   $0x62
+  802cc5:	68 b9 4e 80 00       	push   $0x804eb9
+  802cca:	e8 8f d6 ff ff       	call   80035e <_panic>
+
+00802ccf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ccf:	55                   	push   %ebp
+  802cd0:	89 e5                	mov    %esp,%ebp
+  802cd2:	53                   	push   %ebx
+  802cd3:	83 ec 04             	sub    $0x4,%esp
+  802cd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdc:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802ce1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ce7:	7f 2e                	jg     802d17 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ce9:	83 ec 04             	sub    $0x4,%esp
+  802cec:	53                   	push   %ebx
+  802ced:	ff 75 0c             	push   0xc(%ebp)
+  802cf0:	68 0c 90 80 00       	push   $0x80900c
+  802cf5:	e8 a9 de ff ff       	call   800ba3 <memmove>
+	nsipcbuf.send.req_size = size;
+  802cfa:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802d00:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d03:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802d08:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d0d:	e8 e8 fd ff ff       	call   802afa <nsipc>
+}
+  802d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d15:	c9                   	leave
+  802d16:	c3                   	ret
+	assert(size < 1600);
+  802d17:	68 c5 4e 80 00       	push   $0x804ec5
+  802d1c:	68 5d 4e 80 00       	push   $0x804e5d
+  802d21:	6a 6d                	push   $0x6d
+  802d23:	68 b9 4e 80 00       	push   $0x804eb9
+  802d28:	e8 31 d6 ff ff       	call   80035e <_panic>
+
+00802d2d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d36:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802d3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d3e:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d43:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d46:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802d4b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d50:	e8 a5 fd ff ff       	call   802afa <nsipc>
+}
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+
+00802d57 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802d57:	55                   	push   %ebp
+  802d58:	89 e5                	mov    %esp,%ebp
+  802d5a:	53                   	push   %ebx
+  802d5b:	83 ec 10             	sub    $0x10,%esp
+  802d5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802d61:	68 0c 70 80 00       	push   $0x80700c
+  802d66:	e8 50 07 00 00       	call   8034bb <mutex_lock>
+	if (v == 0)
+  802d6b:	83 c4 10             	add    $0x10,%esp
+  802d6e:	85 db                	test   %ebx,%ebx
+  802d70:	0f 84 85 00 00 00    	je     802dfb <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802d76:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802d7c:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802d81:	77 51                	ja     802dd4 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802d83:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802d89:	89 d8                	mov    %ebx,%eax
+  802d8b:	c1 e8 0c             	shr    $0xc,%eax
+  802d8e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802d95:	f6 c4 02             	test   $0x2,%ah
+  802d98:	74 50                	je     802dea <free+0x93>
+		sys_page_unmap(0, c);
+  802d9a:	83 ec 08             	sub    $0x8,%esp
+  802d9d:	53                   	push   %ebx
+  802d9e:	6a 00                	push   $0x0
+  802da0:	e8 4f e1 ff ff       	call   800ef4 <sys_page_unmap>
+		c += PGSIZE;
+  802da5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802dab:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802db1:	83 c4 10             	add    $0x10,%esp
+  802db4:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802db9:	76 ce                	jbe    802d89 <free+0x32>
+  802dbb:	68 0f 4f 80 00       	push   $0x804f0f
+  802dc0:	68 5d 4e 80 00       	push   $0x804e5d
+  802dc5:	68 82 00 00 00       	push   $0x82
+  802dca:	68 02 4f 80 00       	push   $0x804f02
+  802dcf:	e8 8a d5 ff ff       	call   80035e <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802dd4:	68 d4 4e 80 00       	push   $0x804ed4
+  802dd9:	68 5d 4e 80 00       	push   $0x804e5d
+  802dde:	6a 7b                	push   $0x7b
+  802de0:	68 02 4f 80 00       	push   $0x804f02
+  802de5:	e8 74 d5 ff ff       	call   80035e <_panic>
+	if (--(*ref) == 0)
+  802dea:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802df0:	83 e8 01             	sub    $0x1,%eax
+  802df3:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802df9:	74 15                	je     802e10 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802dfb:	83 ec 0c             	sub    $0xc,%esp
+  802dfe:	68 0c 70 80 00       	push   $0x80700c
+  802e03:	e8 20 07 00 00       	call   803528 <mutex_unlock>
+}
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e0e:	c9                   	leave
+  802e0f:	c3                   	ret
+		sys_page_unmap(0, c);
+  802e10:	83 ec 08             	sub    $0x8,%esp
+  802e13:	53                   	push   %ebx
+  802e14:	6a 00                	push   $0x0
+  802e16:	e8 d9 e0 ff ff       	call   800ef4 <sys_page_unmap>
+  802e1b:	83 c4 10             	add    $0x10,%esp
+  802e1e:	eb db                	jmp    802dfb <free+0xa4>
+
+00802e20 <malloc>:
+{
+  802e20:	55                   	push   %ebp
+  802e21:	89 e5                	mov    %esp,%ebp
+  802e23:	57                   	push   %edi
+  802e24:	56                   	push   %esi
+  802e25:	53                   	push   %ebx
+  802e26:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802e29:	68 0c 70 80 00       	push   $0x80700c
+  802e2e:	e8 88 06 00 00       	call   8034bb <mutex_lock>
+	if (mptr == 0)
+  802e33:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802e39:	83 c4 10             	add    $0x10,%esp
+  802e3c:	85 ff                	test   %edi,%edi
+  802e3e:	74 6c                	je     802eac <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e43:	83 c0 03             	add    $0x3,%eax
+  802e46:	83 e0 fc             	and    $0xfffffffc,%eax
+  802e49:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802e4b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802e50:	0f 87 64 01 00 00    	ja     802fba <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802e56:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802e5c:	74 30                	je     802e8e <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802e5e:	89 f9                	mov    %edi,%ecx
+  802e60:	c1 e9 0c             	shr    $0xc,%ecx
+  802e63:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802e67:	c1 e8 0c             	shr    $0xc,%eax
+  802e6a:	39 c1                	cmp    %eax,%ecx
+  802e6c:	74 5f                	je     802ecd <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802e6e:	83 ec 0c             	sub    $0xc,%esp
+  802e71:	57                   	push   %edi
+  802e72:	e8 e0 fe ff ff       	call   802d57 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802e77:	a1 10 70 80 00       	mov    0x807010,%eax
+  802e7c:	05 00 10 00 00       	add    $0x1000,%eax
+  802e81:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e86:	a3 10 70 80 00       	mov    %eax,0x807010
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802e94:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e99:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802e9d:	8d 7e 04             	lea    0x4(%esi),%edi
+  802ea0:	89 cb                	mov    %ecx,%ebx
+  802ea2:	01 f9                	add    %edi,%ecx
+  802ea4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802ea7:	e9 8b 00 00 00       	jmp    802f37 <malloc+0x117>
+		mptr = mbegin;
+  802eac:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802eb3:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802eb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb9:	83 c0 03             	add    $0x3,%eax
+  802ebc:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ebf:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ec1:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ec6:	76 c6                	jbe    802e8e <malloc+0x6e>
+  802ec8:	e9 d6 00 00 00       	jmp    802fa3 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802ecd:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ed3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802ed8:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802edc:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802edf:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802ee4:	e9 ba 00 00 00       	jmp    802fa3 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ee9:	05 00 10 00 00       	add    $0x1000,%eax
+  802eee:	39 c8                	cmp    %ecx,%eax
+  802ef0:	0f 83 cb 00 00 00    	jae    802fc1 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802ef6:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802efb:	77 22                	ja     802f1f <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802efd:	89 c2                	mov    %eax,%edx
+  802eff:	c1 ea 16             	shr    $0x16,%edx
+  802f02:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f09:	f6 c2 01             	test   $0x1,%dl
+  802f0c:	74 db                	je     802ee9 <malloc+0xc9>
+  802f0e:	89 c2                	mov    %eax,%edx
+  802f10:	c1 ea 0c             	shr    $0xc,%edx
+  802f13:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802f1a:	f6 c2 01             	test   $0x1,%dl
+  802f1d:	74 ca                	je     802ee9 <malloc+0xc9>
+		if (mptr == mend) {
+  802f1f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802f25:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802f2b:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802f2f:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802f35:	74 04                	je     802f3b <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802f37:	89 d8                	mov    %ebx,%eax
+  802f39:	eb b3                	jmp    802eee <malloc+0xce>
+  802f3b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802f3e:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802f43:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802f47:	83 ea 01             	sub    $0x1,%edx
+  802f4a:	0f 85 50 ff ff ff    	jne    802ea0 <malloc+0x80>
+  802f50:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802f57:	00 00 08 
+				return 0;	/* out of address space */
+  802f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5f:	eb 42                	jmp    802fa3 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802f61:	85 db                	test   %ebx,%ebx
+  802f63:	78 1e                	js     802f83 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802f65:	83 ec 08             	sub    $0x8,%esp
+  802f68:	89 d8                	mov    %ebx,%eax
+  802f6a:	03 05 10 70 80 00    	add    0x807010,%eax
+  802f70:	50                   	push   %eax
+  802f71:	6a 00                	push   $0x0
+  802f73:	e8 7c df ff ff       	call   800ef4 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802f78:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802f7e:	83 c4 10             	add    $0x10,%esp
+  802f81:	eb de                	jmp    802f61 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802f83:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f88:	eb 19                	jmp    802fa3 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802f8a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f8d:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802f93:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802f9a:	00 
+	mptr += n;
+  802f9b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802f9e:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  802fa3:	83 ec 0c             	sub    $0xc,%esp
+  802fa6:	68 0c 70 80 00       	push   $0x80700c
+  802fab:	e8 78 05 00 00       	call   803528 <mutex_unlock>
+}
+  802fb0:	89 f8                	mov    %edi,%eax
+  802fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb5:	5b                   	pop    %ebx
+  802fb6:	5e                   	pop    %esi
+  802fb7:	5f                   	pop    %edi
+  802fb8:	5d                   	pop    %ebp
+  802fb9:	c3                   	ret
+		return 0;
+  802fba:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fbf:	eb e2                	jmp    802fa3 <malloc+0x183>
+  802fc1:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802fc5:	74 06                	je     802fcd <malloc+0x1ad>
+  802fc7:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802fd5:	39 fb                	cmp    %edi,%ebx
+  802fd7:	73 b1                	jae    802f8a <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802fd9:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802fdf:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802fe2:	39 fe                	cmp    %edi,%esi
+  802fe4:	0f 92 c0             	setb   %al
+  802fe7:	0f b6 c0             	movzbl %al,%eax
+  802fea:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802fed:	83 c8 07             	or     $0x7,%eax
+  802ff0:	50                   	push   %eax
+  802ff1:	89 d8                	mov    %ebx,%eax
+  802ff3:	03 05 10 70 80 00    	add    0x807010,%eax
+  802ff9:	50                   	push   %eax
+  802ffa:	6a 00                	push   $0x0
+  802ffc:	e8 5a de ff ff       	call   800e5b <sys_page_alloc>
+  803001:	83 c4 10             	add    $0x10,%esp
+  803004:	85 c0                	test   %eax,%eax
+  803006:	0f 88 55 ff ff ff    	js     802f61 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80300c:	89 f3                	mov    %esi,%ebx
+  80300e:	eb c5                	jmp    802fd5 <malloc+0x1b5>
+
+00803010 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803010:	55                   	push   %ebp
+  803011:	89 e5                	mov    %esp,%ebp
+  803013:	56                   	push   %esi
+  803014:	53                   	push   %ebx
+  803015:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803018:	83 ec 0c             	sub    $0xc,%esp
+  80301b:	ff 75 08             	push   0x8(%ebp)
+  80301e:	e8 ea e2 ff ff       	call   80130d <fd2data>
+  803023:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803025:	83 c4 08             	add    $0x8,%esp
+  803028:	68 27 4f 80 00       	push   $0x804f27
+  80302d:	53                   	push   %ebx
+  80302e:	e8 ea d9 ff ff       	call   800a1d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803033:	8b 46 04             	mov    0x4(%esi),%eax
+  803036:	2b 06                	sub    (%esi),%eax
+  803038:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80303e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803045:	00 00 00 
+	stat->st_dev = &devpipe;
+  803048:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  80304f:	62 80 00 
+	return 0;
+}
+  803052:	b8 00 00 00 00       	mov    $0x0,%eax
+  803057:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80305a:	5b                   	pop    %ebx
+  80305b:	5e                   	pop    %esi
+  80305c:	5d                   	pop    %ebp
+  80305d:	c3                   	ret
+
+0080305e <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80305e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803063:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803067:	85 c9                	test   %ecx,%ecx
+  803069:	75 01                	jne    80306c <pipewake+0xe>
+  80306b:	c3                   	ret
+{
+  80306c:	55                   	push   %ebp
+  80306d:	89 e5                	mov    %esp,%ebp
+  80306f:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803072:	68 00 04 00 00       	push   $0x400
+  803077:	52                   	push   %edx
+  803078:	e8 22 e1 ff ff       	call   80119f <sys_futex_wake>
+  80307d:	83 c4 10             	add    $0x10,%esp
+}
+  803080:	c9                   	leave
+  803081:	c3                   	ret
+
+00803082 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803082:	55                   	push   %ebp
+  803083:	89 e5                	mov    %esp,%ebp
+  803085:	56                   	push   %esi
+  803086:	53                   	push   %ebx
+  803087:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80308a:	83 ec 0c             	sub    $0xc,%esp
+  80308d:	56                   	push   %esi
+  80308e:	e8 7a e2 ff ff       	call   80130d <fd2data>
+  803093:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803095:	83 c4 08             	add    $0x8,%esp
+  803098:	56                   	push   %esi
+  803099:	6a 00                	push   $0x0
+  80309b:	e8 54 de ff ff       	call   800ef4 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8030a0:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030a6:	e8 b3 ff ff ff       	call   80305e <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8030ab:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8030ae:	89 da                	mov    %ebx,%edx
+  8030b0:	e8 a9 ff ff ff       	call   80305e <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8030b5:	89 34 24             	mov    %esi,(%esp)
+  8030b8:	e8 50 e2 ff ff       	call   80130d <fd2data>
+  8030bd:	83 c4 08             	add    $0x8,%esp
+  8030c0:	50                   	push   %eax
+  8030c1:	6a 00                	push   $0x0
+  8030c3:	e8 2c de ff ff       	call   800ef4 <sys_page_unmap>
+}
+  8030c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030cb:	5b                   	pop    %ebx
+  8030cc:	5e                   	pop    %esi
+  8030cd:	5d                   	pop    %ebp
+  8030ce:	c3                   	ret
+
+008030cf <_pipeisclosed>:
+{
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	57                   	push   %edi
+  8030d3:	56                   	push   %esi
+  8030d4:	53                   	push   %ebx
+  8030d5:	83 ec 1c             	sub    $0x1c,%esp
+  8030d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030db:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030dd:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8030e2:	eb 5d                	jmp    803141 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8030e4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8030ea:	8b 02                	mov    (%edx),%eax
+  8030ec:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8030ef:	83 ec 0c             	sub    $0xc,%esp
+  8030f2:	ff 75 e0             	push   -0x20(%ebp)
+  8030f5:	e8 42 15 00 00       	call   80463c <pageref>
+  8030fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030fd:	89 3c 24             	mov    %edi,(%esp)
+  803100:	e8 37 15 00 00       	call   80463c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803105:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803107:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80310d:	83 c4 10             	add    $0x10,%esp
+  803110:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803116:	77 15                	ja     80312d <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803118:	89 f2                	mov    %esi,%edx
+  80311a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80311c:	c1 ea 10             	shr    $0x10,%edx
+  80311f:	74 0c                	je     80312d <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803121:	c1 e2 10             	shl    $0x10,%edx
+  803124:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803129:	29 d1                	sub    %edx,%ecx
+  80312b:	eb 06                	jmp    803133 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80312d:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803133:	8b 11                	mov    (%ecx),%edx
+  803135:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803138:	39 d3                	cmp    %edx,%ebx
+  80313a:	74 6e                	je     8031aa <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80313c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80313f:	74 24                	je     803165 <_pipeisclosed+0x96>
+  803141:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803143:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803149:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80314e:	77 94                	ja     8030e4 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803150:	89 f0                	mov    %esi,%eax
+  803152:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803154:	c1 e8 10             	shr    $0x10,%eax
+  803157:	74 8b                	je     8030e4 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803159:	c1 e0 10             	shl    $0x10,%eax
+  80315c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803161:	29 c2                	sub    %eax,%edx
+  803163:	eb 85                	jmp    8030ea <_pipeisclosed+0x1b>
+  803165:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803167:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80316d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803172:	77 18                	ja     80318c <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803174:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803179:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80317b:	c1 e8 10             	shr    $0x10,%eax
+  80317e:	74 0c                	je     80318c <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803180:	c1 e0 10             	shl    $0x10,%eax
+  803183:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803188:	29 c2                	sub    %eax,%edx
+  80318a:	eb 06                	jmp    803192 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80318c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803192:	8b 02                	mov    (%edx),%eax
+  803194:	8b 40 58             	mov    0x58(%eax),%eax
+  803197:	6a 01                	push   $0x1
+  803199:	50                   	push   %eax
+  80319a:	53                   	push   %ebx
+  80319b:	68 2e 4f 80 00       	push   $0x804f2e
+  8031a0:	e8 94 d2 ff ff       	call   800439 <cprintf>
+  8031a5:	83 c4 10             	add    $0x10,%esp
+  8031a8:	eb 97                	jmp    803141 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8031aa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8031ad:	0f 94 c0             	sete   %al
+  8031b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8031b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031b6:	5b                   	pop    %ebx
+  8031b7:	5e                   	pop    %esi
+  8031b8:	5f                   	pop    %edi
+  8031b9:	5d                   	pop    %ebp
+  8031ba:	c3                   	ret
+
+008031bb <devpipe_write>:
+{
+  8031bb:	55                   	push   %ebp
+  8031bc:	89 e5                	mov    %esp,%ebp
+  8031be:	57                   	push   %edi
+  8031bf:	56                   	push   %esi
+  8031c0:	53                   	push   %ebx
+  8031c1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8031c4:	ff 75 08             	push   0x8(%ebp)
+  8031c7:	e8 41 e1 ff ff       	call   80130d <fd2data>
+  8031cc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031ce:	83 c4 10             	add    $0x10,%esp
+  8031d1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8031d8:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8031db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031de:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8031e1:	0f 84 96 00 00 00    	je     80327d <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8031e7:	8d 73 08             	lea    0x8(%ebx),%esi
+  8031ea:	eb 32                	jmp    80321e <devpipe_write+0x63>
+  8031ec:	89 fa                	mov    %edi,%edx
+  8031ee:	89 f0                	mov    %esi,%eax
+  8031f0:	e8 69 fe ff ff       	call   80305e <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8031f5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031f8:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8031fb:	ba 01 00 00 00       	mov    $0x1,%edx
+  803200:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803205:	83 ec 04             	sub    $0x4,%esp
+  803208:	6a 0a                	push   $0xa
+  80320a:	50                   	push   %eax
+  80320b:	53                   	push   %ebx
+  80320c:	e8 5f df ff ff       	call   801170 <sys_futex_wait>
+  803211:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803216:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80321b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80321e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803221:	8b 0b                	mov    (%ebx),%ecx
+  803223:	8d 51 20             	lea    0x20(%ecx),%edx
+  803226:	39 d0                	cmp    %edx,%eax
+  803228:	72 1b                	jb     803245 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80322a:	89 da                	mov    %ebx,%edx
+  80322c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80322f:	e8 9b fe ff ff       	call   8030cf <_pipeisclosed>
+  803234:	85 c0                	test   %eax,%eax
+  803236:	74 b4                	je     8031ec <devpipe_write+0x31>
+				return 0;
+  803238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80323d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803240:	5b                   	pop    %ebx
+  803241:	5e                   	pop    %esi
+  803242:	5f                   	pop    %edi
+  803243:	5d                   	pop    %ebp
+  803244:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803248:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80324b:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80324f:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803252:	89 c2                	mov    %eax,%edx
+  803254:	c1 fa 1f             	sar    $0x1f,%edx
+  803257:	89 d1                	mov    %edx,%ecx
+  803259:	c1 e9 1b             	shr    $0x1b,%ecx
+  80325c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80325f:	83 e2 1f             	and    $0x1f,%edx
+  803262:	29 ca                	sub    %ecx,%edx
+  803264:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803268:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80326c:	83 c0 01             	add    $0x1,%eax
+  80326f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803272:	83 c6 01             	add    $0x1,%esi
+  803275:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803278:	e9 5e ff ff ff       	jmp    8031db <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80327d:	8d 53 04             	lea    0x4(%ebx),%edx
+  803280:	8d 43 08             	lea    0x8(%ebx),%eax
+  803283:	e8 d6 fd ff ff       	call   80305e <pipewake>
+	return i;
+  803288:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80328b:	eb b0                	jmp    80323d <devpipe_write+0x82>
+
+0080328d <devpipe_read>:
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	57                   	push   %edi
+  803291:	56                   	push   %esi
+  803292:	53                   	push   %ebx
+  803293:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803296:	ff 75 08             	push   0x8(%ebp)
+  803299:	e8 6f e0 ff ff       	call   80130d <fd2data>
+  80329e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8032a0:	83 c4 10             	add    $0x10,%esp
+  8032a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032a8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032ab:	74 6c                	je     803319 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8032ad:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8032b0:	eb 25                	jmp    8032d7 <devpipe_read+0x4a>
+  8032b2:	8b 13                	mov    (%ebx),%edx
+  8032b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032b9:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8032be:	83 ec 04             	sub    $0x4,%esp
+  8032c1:	6a 0a                	push   $0xa
+  8032c3:	52                   	push   %edx
+  8032c4:	57                   	push   %edi
+  8032c5:	e8 a6 de ff ff       	call   801170 <sys_futex_wait>
+  8032ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8032cf:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8032d4:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8032d7:	8b 03                	mov    (%ebx),%eax
+  8032d9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8032dc:	75 19                	jne    8032f7 <devpipe_read+0x6a>
+			if (i > 0)
+  8032de:	85 f6                	test   %esi,%esi
+  8032e0:	75 3a                	jne    80331c <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8032e2:	89 da                	mov    %ebx,%edx
+  8032e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e7:	e8 e3 fd ff ff       	call   8030cf <_pipeisclosed>
+  8032ec:	85 c0                	test   %eax,%eax
+  8032ee:	74 c2                	je     8032b2 <devpipe_read+0x25>
+				return 0;
+  8032f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f5:	eb 31                	jmp    803328 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8032f7:	89 c1                	mov    %eax,%ecx
+  8032f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8032fc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8032ff:	01 c8                	add    %ecx,%eax
+  803301:	83 e0 1f             	and    $0x1f,%eax
+  803304:	29 c8                	sub    %ecx,%eax
+  803306:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80330b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80330e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803311:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803314:	83 c6 01             	add    $0x1,%esi
+  803317:	eb 8f                	jmp    8032a8 <devpipe_read+0x1b>
+out:
+  803319:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80331c:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80331f:	89 da                	mov    %ebx,%edx
+  803321:	e8 38 fd ff ff       	call   80305e <pipewake>
+	return i;
+  803326:	89 f0                	mov    %esi,%eax
+}
+  803328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80332b:	5b                   	pop    %ebx
+  80332c:	5e                   	pop    %esi
+  80332d:	5f                   	pop    %edi
+  80332e:	5d                   	pop    %ebp
+  80332f:	c3                   	ret
+
+00803330 <pipe>:
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	56                   	push   %esi
+  803334:	53                   	push   %ebx
+  803335:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803338:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80333b:	50                   	push   %eax
+  80333c:	e8 e3 df ff ff       	call   801324 <fd_alloc>
+  803341:	89 c3                	mov    %eax,%ebx
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	0f 88 23 01 00 00    	js     803471 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80334e:	83 ec 04             	sub    $0x4,%esp
+  803351:	68 07 04 00 00       	push   $0x407
+  803356:	ff 75 f4             	push   -0xc(%ebp)
+  803359:	6a 00                	push   $0x0
+  80335b:	e8 fb da ff ff       	call   800e5b <sys_page_alloc>
+  803360:	89 c3                	mov    %eax,%ebx
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	85 c0                	test   %eax,%eax
+  803367:	0f 88 04 01 00 00    	js     803471 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80336d:	83 ec 0c             	sub    $0xc,%esp
+  803370:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803373:	50                   	push   %eax
+  803374:	e8 ab df ff ff       	call   801324 <fd_alloc>
+  803379:	89 c3                	mov    %eax,%ebx
+  80337b:	83 c4 10             	add    $0x10,%esp
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	0f 88 db 00 00 00    	js     803461 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803386:	83 ec 04             	sub    $0x4,%esp
+  803389:	68 07 04 00 00       	push   $0x407
+  80338e:	ff 75 f0             	push   -0x10(%ebp)
+  803391:	6a 00                	push   $0x0
+  803393:	e8 c3 da ff ff       	call   800e5b <sys_page_alloc>
+  803398:	89 c3                	mov    %eax,%ebx
+  80339a:	83 c4 10             	add    $0x10,%esp
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	0f 88 bc 00 00 00    	js     803461 <pipe+0x131>
+	va = fd2data(fd0);
+  8033a5:	83 ec 0c             	sub    $0xc,%esp
+  8033a8:	ff 75 f4             	push   -0xc(%ebp)
+  8033ab:	e8 5d df ff ff       	call   80130d <fd2data>
+  8033b0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033b2:	83 c4 0c             	add    $0xc,%esp
+  8033b5:	68 07 04 00 00       	push   $0x407
+  8033ba:	50                   	push   %eax
+  8033bb:	6a 00                	push   $0x0
+  8033bd:	e8 99 da ff ff       	call   800e5b <sys_page_alloc>
+  8033c2:	89 c3                	mov    %eax,%ebx
+  8033c4:	83 c4 10             	add    $0x10,%esp
+  8033c7:	85 c0                	test   %eax,%eax
+  8033c9:	0f 88 82 00 00 00    	js     803451 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033cf:	83 ec 0c             	sub    $0xc,%esp
+  8033d2:	ff 75 f0             	push   -0x10(%ebp)
+  8033d5:	e8 33 df ff ff       	call   80130d <fd2data>
+  8033da:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8033e1:	50                   	push   %eax
+  8033e2:	6a 00                	push   $0x0
+  8033e4:	56                   	push   %esi
+  8033e5:	6a 00                	push   $0x0
+  8033e7:	e8 bc da ff ff       	call   800ea8 <sys_page_map>
+  8033ec:	89 c3                	mov    %eax,%ebx
+  8033ee:	83 c4 20             	add    $0x20,%esp
+  8033f1:	85 c0                	test   %eax,%eax
+  8033f3:	78 4e                	js     803443 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8033f5:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  8033fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033fd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8033ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803402:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803409:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80340c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80340e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803411:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803418:	83 ec 0c             	sub    $0xc,%esp
+  80341b:	ff 75 f4             	push   -0xc(%ebp)
+  80341e:	e8 da de ff ff       	call   8012fd <fd2num>
+  803423:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803426:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803428:	83 c4 04             	add    $0x4,%esp
+  80342b:	ff 75 f0             	push   -0x10(%ebp)
+  80342e:	e8 ca de ff ff       	call   8012fd <fd2num>
+  803433:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803436:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803439:	83 c4 10             	add    $0x10,%esp
+  80343c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803441:	eb 2e                	jmp    803471 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803443:	83 ec 08             	sub    $0x8,%esp
+  803446:	56                   	push   %esi
+  803447:	6a 00                	push   $0x0
+  803449:	e8 a6 da ff ff       	call   800ef4 <sys_page_unmap>
+  80344e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803451:	83 ec 08             	sub    $0x8,%esp
+  803454:	ff 75 f0             	push   -0x10(%ebp)
+  803457:	6a 00                	push   $0x0
+  803459:	e8 96 da ff ff       	call   800ef4 <sys_page_unmap>
+  80345e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803461:	83 ec 08             	sub    $0x8,%esp
+  803464:	ff 75 f4             	push   -0xc(%ebp)
+  803467:	6a 00                	push   $0x0
+  803469:	e8 86 da ff ff       	call   800ef4 <sys_page_unmap>
+  80346e:	83 c4 10             	add    $0x10,%esp
+}
+  803471:	89 d8                	mov    %ebx,%eax
+  803473:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803476:	5b                   	pop    %ebx
+  803477:	5e                   	pop    %esi
+  803478:	5d                   	pop    %ebp
+  803479:	c3                   	ret
+
+0080347a <pipeisclosed>:
+{
+  80347a:	55                   	push   %ebp
+  80347b:	89 e5                	mov    %esp,%ebp
+  80347d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803483:	50                   	push   %eax
+  803484:	ff 75 08             	push   0x8(%ebp)
+  803487:	e8 ee de ff ff       	call   80137a <fd_lookup>
+  80348c:	83 c4 10             	add    $0x10,%esp
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	78 18                	js     8034ab <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803493:	83 ec 0c             	sub    $0xc,%esp
+  803496:	ff 75 f4             	push   -0xc(%ebp)
+  803499:	e8 6f de ff ff       	call   80130d <fd2data>
+  80349e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8034a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a3:	e8 27 fc ff ff       	call   8030cf <_pipeisclosed>
+  8034a8:	83 c4 10             	add    $0x10,%esp
+}
+  8034ab:	c9                   	leave
+  8034ac:	c3                   	ret
+
+008034ad <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8034ad:	55                   	push   %ebp
+  8034ae:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8034b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8034b9:	5d                   	pop    %ebp
+  8034ba:	c3                   	ret
+
+008034bb <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8034bb:	55                   	push   %ebp
+  8034bc:	89 e5                	mov    %esp,%ebp
+  8034be:	56                   	push   %esi
+  8034bf:	53                   	push   %ebx
+  8034c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8034c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8034cd:	89 d0                	mov    %edx,%eax
+  8034cf:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	74 2d                	je     803504 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8034d7:	83 f8 02             	cmp    $0x2,%eax
+  8034da:	74 08                	je     8034e4 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8034dc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8034e1:	f0 87 03             	lock xchg %eax,(%ebx)
+  8034e4:	be 02 00 00 00       	mov    $0x2,%esi
+  8034e9:	eb 15                	jmp    803500 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8034eb:	83 ec 04             	sub    $0x4,%esp
+  8034ee:	6a 00                	push   $0x0
+  8034f0:	6a 02                	push   $0x2
+  8034f2:	53                   	push   %ebx
+  8034f3:	e8 78 dc ff ff       	call   801170 <sys_futex_wait>
+  8034f8:	89 f0                	mov    %esi,%eax
+  8034fa:	f0 87 03             	lock xchg %eax,(%ebx)
+  8034fd:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803500:	85 c0                	test   %eax,%eax
+  803502:	75 e7                	jne    8034eb <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803507:	5b                   	pop    %ebx
+  803508:	5e                   	pop    %esi
+  803509:	5d                   	pop    %ebp
+  80350a:	c3                   	ret
+
+0080350b <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803511:	b8 00 00 00 00       	mov    $0x0,%eax
+  803516:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80351b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80351f:	f7 d8                	neg    %eax
+  803521:	19 c0                	sbb    %eax,%eax
+  803523:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803526:	5d                   	pop    %ebp
+  803527:	c3                   	ret
+
+00803528 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803528:	55                   	push   %ebp
+  803529:	89 e5                	mov    %esp,%ebp
+  80352b:	83 ec 08             	sub    $0x8,%esp
+  80352e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803531:	b8 00 00 00 00       	mov    $0x0,%eax
+  803536:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803539:	83 f8 02             	cmp    $0x2,%eax
+  80353c:	74 02                	je     803540 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80353e:	c9                   	leave
+  80353f:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803540:	83 ec 08             	sub    $0x8,%esp
+  803543:	6a 01                	push   $0x1
+  803545:	52                   	push   %edx
+  803546:	e8 54 dc ff ff       	call   80119f <sys_futex_wake>
+  80354b:	83 c4 10             	add    $0x10,%esp
+}
+  80354e:	eb ee                	jmp    80353e <mutex_unlock+0x16>
+
+00803550 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803550:	55                   	push   %ebp
+  803551:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803553:	8b 45 08             	mov    0x8(%ebp),%eax
+  803556:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80355c:	5d                   	pop    %ebp
+  80355d:	c3                   	ret
+
+0080355e <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80355e:	55                   	push   %ebp
+  80355f:	89 e5                	mov    %esp,%ebp
+  803561:	57                   	push   %edi
+  803562:	56                   	push   %esi
+  803563:	53                   	push   %ebx
+  803564:	83 ec 18             	sub    $0x18,%esp
+  803567:	8b 75 08             	mov    0x8(%ebp),%esi
+  80356a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80356d:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80356f:	53                   	push   %ebx
+  803570:	e8 b3 ff ff ff       	call   803528 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803575:	83 c4 0c             	add    $0xc,%esp
+  803578:	ff 75 10             	push   0x10(%ebp)
+  80357b:	57                   	push   %edi
+  80357c:	56                   	push   %esi
+  80357d:	e8 ee db ff ff       	call   801170 <sys_futex_wait>
+  803582:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803584:	83 c4 10             	add    $0x10,%esp
+  803587:	be 02 00 00 00       	mov    $0x2,%esi
+  80358c:	eb 10                	jmp    80359e <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80358e:	83 ec 04             	sub    $0x4,%esp
+  803591:	6a 00                	push   $0x0
+  803593:	6a 02                	push   $0x2
+  803595:	53                   	push   %ebx
+  803596:	e8 d5 db ff ff       	call   801170 <sys_futex_wait>
+  80359b:	83 c4 10             	add    $0x10,%esp
+  80359e:	89 f0                	mov    %esi,%eax
+  8035a0:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8035a3:	85 c0                	test   %eax,%eax
+  8035a5:	75 e7                	jne    80358e <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8035a7:	83 ff ec             	cmp    $0xffffffec,%edi
+  8035aa:	74 05                	je     8035b1 <cond_timedwait+0x53>
+  8035ac:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8035b1:	89 f8                	mov    %edi,%eax
+  8035b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b6:	5b                   	pop    %ebx
+  8035b7:	5e                   	pop    %esi
+  8035b8:	5f                   	pop    %edi
+  8035b9:	5d                   	pop    %ebp
+  8035ba:	c3                   	ret
+
+008035bb <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8035bb:	55                   	push   %ebp
+  8035bc:	89 e5                	mov    %esp,%ebp
+  8035be:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8035c1:	6a 00                	push   $0x0
+  8035c3:	ff 75 0c             	push   0xc(%ebp)
+  8035c6:	ff 75 08             	push   0x8(%ebp)
+  8035c9:	e8 90 ff ff ff       	call   80355e <cond_timedwait>
+}
+  8035ce:	83 c4 10             	add    $0x10,%esp
+  8035d1:	c9                   	leave
+  8035d2:	c3                   	ret
+
+008035d3 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8035d3:	55                   	push   %ebp
+  8035d4:	89 e5                	mov    %esp,%ebp
+  8035d6:	83 ec 10             	sub    $0x10,%esp
+  8035d9:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8035dc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035e1:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8035e5:	6a 01                	push   $0x1
+  8035e7:	50                   	push   %eax
+  8035e8:	e8 b2 db ff ff       	call   80119f <sys_futex_wake>
+}
+  8035ed:	83 c4 10             	add    $0x10,%esp
+  8035f0:	c9                   	leave
+  8035f1:	c3                   	ret
+
+008035f2 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8035f2:	55                   	push   %ebp
+  8035f3:	89 e5                	mov    %esp,%ebp
+  8035f5:	83 ec 10             	sub    $0x10,%esp
+  8035f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035fb:	ba 01 00 00 00       	mov    $0x1,%edx
+  803600:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803604:	68 00 04 00 00       	push   $0x400
+  803609:	50                   	push   %eax
+  80360a:	e8 90 db ff ff       	call   80119f <sys_futex_wake>
+}
+  80360f:	83 c4 10             	add    $0x10,%esp
+  803612:	c9                   	leave
+  803613:	c3                   	ret
+
+00803614 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803614:	55                   	push   %ebp
+  803615:	89 e5                	mov    %esp,%ebp
+  803617:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80361a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80361d:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80361f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803626:	5d                   	pop    %ebp
+  803627:	c3                   	ret
+
+00803628 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803628:	55                   	push   %ebp
+  803629:	89 e5                	mov    %esp,%ebp
+  80362b:	53                   	push   %ebx
+  80362c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80362f:	8b 11                	mov    (%ecx),%edx
+  803631:	85 d2                	test   %edx,%edx
+  803633:	74 14                	je     803649 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803635:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803638:	89 d0                	mov    %edx,%eax
+  80363a:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80363e:	39 c2                	cmp    %eax,%edx
+  803640:	75 ed                	jne    80362f <sem_trywait+0x7>
+			return 0;
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+  803647:	eb 05                	jmp    80364e <sem_trywait+0x26>
+	return -E_AGAIN;
+  803649:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80364e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803651:	c9                   	leave
+  803652:	c3                   	ret
+
+00803653 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803653:	55                   	push   %ebp
+  803654:	89 e5                	mov    %esp,%ebp
+  803656:	57                   	push   %edi
+  803657:	56                   	push   %esi
+  803658:	53                   	push   %ebx
+  803659:	83 ec 1c             	sub    $0x1c,%esp
+  80365c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80365f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803662:	e8 81 da ff ff       	call   8010e8 <sys_time_msec>
+  803667:	01 f8                	add    %edi,%eax
+  803669:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80366c:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803671:	eb 28                	jmp    80369b <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803673:	b8 01 00 00 00       	mov    $0x1,%eax
+  803678:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80367d:	83 ec 04             	sub    $0x4,%esp
+  803680:	56                   	push   %esi
+  803681:	6a 00                	push   $0x0
+  803683:	53                   	push   %ebx
+  803684:	e8 e7 da ff ff       	call   801170 <sys_futex_wait>
+  803689:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80368e:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803693:	83 c4 10             	add    $0x10,%esp
+  803696:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803699:	74 2e                	je     8036c9 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80369b:	83 ec 0c             	sub    $0xc,%esp
+  80369e:	53                   	push   %ebx
+  80369f:	e8 84 ff ff ff       	call   803628 <sem_trywait>
+  8036a4:	83 c4 10             	add    $0x10,%esp
+  8036a7:	85 c0                	test   %eax,%eax
+  8036a9:	79 19                	jns    8036c4 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8036ab:	85 ff                	test   %edi,%edi
+  8036ad:	74 c4                	je     803673 <sem_timedwait+0x20>
+  8036af:	e8 34 da ff ff       	call   8010e8 <sys_time_msec>
+  8036b4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8036b7:	29 c6                	sub    %eax,%esi
+  8036b9:	85 f6                	test   %esi,%esi
+  8036bb:	7f b6                	jg     803673 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8036bd:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8036c2:	eb 05                	jmp    8036c9 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8036c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036cc:	5b                   	pop    %ebx
+  8036cd:	5e                   	pop    %esi
+  8036ce:	5f                   	pop    %edi
+  8036cf:	5d                   	pop    %ebp
+  8036d0:	c3                   	ret
+
+008036d1 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8036d1:	55                   	push   %ebp
+  8036d2:	89 e5                	mov    %esp,%ebp
+  8036d4:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8036d7:	6a 00                	push   $0x0
+  8036d9:	ff 75 08             	push   0x8(%ebp)
+  8036dc:	e8 72 ff ff ff       	call   803653 <sem_timedwait>
+}
+  8036e1:	83 c4 10             	add    $0x10,%esp
+  8036e4:	c9                   	leave
+  8036e5:	c3                   	ret
+
+008036e6 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8036e6:	55                   	push   %ebp
+  8036e7:	89 e5                	mov    %esp,%ebp
+  8036e9:	83 ec 08             	sub    $0x8,%esp
+  8036ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ef:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036f4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8036f8:	8b 50 04             	mov    0x4(%eax),%edx
+  8036fb:	85 d2                	test   %edx,%edx
+  8036fd:	75 02                	jne    803701 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8036ff:	c9                   	leave
+  803700:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803701:	83 ec 08             	sub    $0x8,%esp
+  803704:	6a 01                	push   $0x1
+  803706:	50                   	push   %eax
+  803707:	e8 93 da ff ff       	call   80119f <sys_futex_wake>
+  80370c:	83 c4 10             	add    $0x10,%esp
+}
+  80370f:	eb ee                	jmp    8036ff <sem_post+0x19>
+
+00803711 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803711:	55                   	push   %ebp
+  803712:	89 e5                	mov    %esp,%ebp
+  803714:	57                   	push   %edi
+  803715:	56                   	push   %esi
+  803716:	53                   	push   %ebx
+  803717:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80371a:	68 20 70 80 00       	push   $0x807020
+  80371f:	e8 97 fd ff ff       	call   8034bb <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803724:	a1 44 70 80 00       	mov    0x807044,%eax
+  803729:	83 c4 10             	add    $0x10,%esp
+  80372c:	85 c0                	test   %eax,%eax
+  80372e:	75 19                	jne    803749 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803730:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803735:	8b 00                	mov    (%eax),%eax
+  803737:	8b 40 48             	mov    0x48(%eax),%eax
+  80373a:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  80373f:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803746:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803749:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80374e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803751:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803758:	8b 40 04             	mov    0x4(%eax),%eax
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	0f 84 e4 00 00 00    	je     803847 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803763:	83 c3 01             	add    $0x1,%ebx
+  803766:	83 fb 20             	cmp    $0x20,%ebx
+  803769:	75 e3                	jne    80374e <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  80376b:	83 ec 0c             	sub    $0xc,%esp
+  80376e:	68 20 70 80 00       	push   $0x807020
+  803773:	e8 b0 fd ff ff       	call   803528 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803778:	83 c4 10             	add    $0x10,%esp
+  80377b:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803780:	e9 b8 00 00 00       	jmp    80383d <pthread_create+0x12c>
+  803785:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803788:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80378b:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  80378d:	39 f3                	cmp    %esi,%ebx
+  80378f:	73 16                	jae    8037a7 <pthread_create+0x96>
+		va -= PGSIZE;
+  803791:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803797:	83 ec 08             	sub    $0x8,%esp
+  80379a:	56                   	push   %esi
+  80379b:	6a 00                	push   $0x0
+  80379d:	e8 52 d7 ff ff       	call   800ef4 <sys_page_unmap>
+  8037a2:	83 c4 10             	add    $0x10,%esp
+  8037a5:	eb e6                	jmp    80378d <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8037a7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8037aa:	83 ec 08             	sub    $0x8,%esp
+  8037ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8037b0:	6a 00                	push   $0x0
+  8037b2:	e8 3d d7 ff ff       	call   800ef4 <sys_page_unmap>
+	return r;
+  8037b7:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8037ba:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037bd:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8037c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8037cb:	eb 70                	jmp    80383d <pthread_create+0x12c>
+	th->th_fn = fn;
+  8037cd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037d0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8037d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037da:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8037dd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037e0:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8037e3:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8037ea:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8037ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8037f2:	29 c8                	sub    %ecx,%eax
+  8037f4:	85 db                	test   %ebx,%ebx
+  8037f6:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  8037fd:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803800:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803807:	83 ec 04             	sub    $0x4,%esp
+  80380a:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80380f:	29 ca                	sub    %ecx,%edx
+  803811:	52                   	push   %edx
+	*--esp = 0;
+  803812:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803815:	50                   	push   %eax
+  803816:	68 6e 3a 80 00       	push   $0x803a6e
+  80381b:	e8 24 da ff ff       	call   801244 <sys_thread_create>
+  803820:	89 c7                	mov    %eax,%edi
+  803822:	83 c4 10             	add    $0x10,%esp
+  803825:	85 c0                	test   %eax,%eax
+  803827:	78 91                	js     8037ba <pthread_create+0xa9>
+	th->th_env = id;
+  803829:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80382c:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803833:	8b 45 08             	mov    0x8(%ebp),%eax
+  803836:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803838:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80383d:	89 f8                	mov    %edi,%eax
+  80383f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803842:	5b                   	pop    %ebx
+  803843:	5e                   	pop    %esi
+  803844:	5f                   	pop    %edi
+  803845:	5d                   	pop    %ebp
+  803846:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803847:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80384a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803851:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803858:	83 ec 0c             	sub    $0xc,%esp
+  80385b:	68 20 70 80 00       	push   $0x807020
+  803860:	e8 c3 fc ff ff       	call   803528 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803865:	89 d9                	mov    %ebx,%ecx
+  803867:	c1 e1 10             	shl    $0x10,%ecx
+  80386a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  80386d:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803872:	29 c8                	sub    %ecx,%eax
+  803874:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803877:	c1 e8 16             	shr    $0x16,%eax
+  80387a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803881:	83 c4 10             	add    $0x10,%esp
+  803884:	a8 01                	test   $0x1,%al
+  803886:	74 15                	je     80389d <pthread_create+0x18c>
+  803888:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80388b:	c1 e8 0c             	shr    $0xc,%eax
+  80388e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803895:	a8 01                	test   $0x1,%al
+  803897:	0f 85 30 ff ff ff    	jne    8037cd <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80389d:	83 ec 04             	sub    $0x4,%esp
+  8038a0:	6a 07                	push   $0x7
+  8038a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8038a5:	6a 00                	push   $0x0
+  8038a7:	e8 af d5 ff ff       	call   800e5b <sys_page_alloc>
+  8038ac:	89 c7                	mov    %eax,%edi
+  8038ae:	83 c4 10             	add    $0x10,%esp
+  8038b1:	85 c0                	test   %eax,%eax
+  8038b3:	0f 88 01 ff ff ff    	js     8037ba <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8038b9:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8038be:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8038c1:	29 d0                	sub    %edx,%eax
+  8038c3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8038c6:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8038c8:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8038cd:	29 d0                	sub    %edx,%eax
+  8038cf:	89 c7                	mov    %eax,%edi
+  8038d1:	39 fe                	cmp    %edi,%esi
+  8038d3:	0f 83 f4 fe ff ff    	jae    8037cd <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8038d9:	83 ec 04             	sub    $0x4,%esp
+  8038dc:	6a 07                	push   $0x7
+  8038de:	56                   	push   %esi
+  8038df:	6a 00                	push   $0x0
+  8038e1:	e8 75 d5 ff ff       	call   800e5b <sys_page_alloc>
+  8038e6:	83 c4 10             	add    $0x10,%esp
+  8038e9:	85 c0                	test   %eax,%eax
+  8038eb:	0f 88 94 fe ff ff    	js     803785 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8038f1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8038f7:	eb d8                	jmp    8038d1 <pthread_create+0x1c0>
+
+008038f9 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8038f9:	55                   	push   %ebp
+  8038fa:	89 e5                	mov    %esp,%ebp
+  8038fc:	57                   	push   %edi
+  8038fd:	56                   	push   %esi
+  8038fe:	53                   	push   %ebx
+  8038ff:	83 ec 0c             	sub    $0xc,%esp
+  803902:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803905:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803908:	83 f8 1e             	cmp    $0x1e,%eax
+  80390b:	0f 87 c7 00 00 00    	ja     8039d8 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803911:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803913:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803919:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80391e:	77 12                	ja     803932 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803920:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803925:	29 d0                	sub    %edx,%eax
+  803927:	c1 e8 10             	shr    $0x10,%eax
+  80392a:	39 c3                	cmp    %eax,%ebx
+  80392c:	0f 84 ad 00 00 00    	je     8039df <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803932:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803935:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80393c:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803943:	eb 10                	jmp    803955 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803945:	83 ec 04             	sub    $0x4,%esp
+  803948:	6a 00                	push   $0x0
+  80394a:	6a 01                	push   $0x1
+  80394c:	57                   	push   %edi
+  80394d:	e8 1e d8 ff ff       	call   801170 <sys_futex_wait>
+  803952:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803955:	8b 46 04             	mov    0x4(%esi),%eax
+  803958:	83 f8 01             	cmp    $0x1,%eax
+  80395b:	74 e8                	je     803945 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80395d:	83 f8 02             	cmp    $0x2,%eax
+  803960:	0f 85 80 00 00 00    	jne    8039e6 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803966:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803969:	c1 e6 02             	shl    $0x2,%esi
+  80396c:	eb 05                	jmp    803973 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80396e:	e8 bc d4 ff ff       	call   800e2f <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803973:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803979:	89 ca                	mov    %ecx,%edx
+  80397b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803981:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803984:	c1 e0 04             	shl    $0x4,%eax
+  803987:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80398c:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80398f:	39 c1                	cmp    %eax,%ecx
+  803991:	75 12                	jne    8039a5 <pthread_join+0xac>
+  803993:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803996:	c1 e0 04             	shl    $0x4,%eax
+  803999:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80399e:	8b 40 54             	mov    0x54(%eax),%eax
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	75 c9                	jne    80396e <pthread_join+0x75>
+	if (ret_store)
+  8039a5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8039a9:	74 0f                	je     8039ba <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8039ab:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039ae:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  8039b5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039b8:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8039ba:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039bd:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8039c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8039cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039d3:	5b                   	pop    %ebx
+  8039d4:	5e                   	pop    %esi
+  8039d5:	5f                   	pop    %edi
+  8039d6:	5d                   	pop    %ebp
+  8039d7:	c3                   	ret
+		return -E_INVAL;
+  8039d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039dd:	eb f1                	jmp    8039d0 <pthread_join+0xd7>
+  8039df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039e4:	eb ea                	jmp    8039d0 <pthread_join+0xd7>
+		return -E_INVAL;
+  8039e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039eb:	eb e3                	jmp    8039d0 <pthread_join+0xd7>
+
+008039ed <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8039ed:	55                   	push   %ebp
+  8039ee:	89 e5                	mov    %esp,%ebp
+  8039f0:	53                   	push   %ebx
+  8039f1:	83 ec 04             	sub    $0x4,%esp
+  8039f4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039f6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039fc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a01:	77 0c                	ja     803a0f <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a03:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a08:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803a0a:	c1 e8 10             	shr    $0x10,%eax
+  803a0d:	75 0a                	jne    803a19 <pthread_exit+0x2c>
+		exit();
+  803a0f:	e8 22 c9 ff ff       	call   800336 <exit>
+  803a14:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803a19:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803a20:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803a23:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803a2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803a2d:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803a30:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803a37:	83 ec 08             	sub    $0x8,%esp
+  803a3a:	6a 20                	push   $0x20
+  803a3c:	01 c2                	add    %eax,%edx
+  803a3e:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803a45:	50                   	push   %eax
+  803a46:	e8 54 d7 ff ff       	call   80119f <sys_futex_wake>
+	sys_env_destroy(0);
+  803a4b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803a52:	e8 61 d3 ff ff       	call   800db8 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803a57:	83 c4 0c             	add    $0xc,%esp
+  803a5a:	68 46 4f 80 00       	push   $0x804f46
+  803a5f:	68 a5 00 00 00       	push   $0xa5
+  803a64:	68 60 4f 80 00       	push   $0x804f60
+  803a69:	e8 f0 c8 ff ff       	call   80035e <_panic>
+
+00803a6e <pthread_start>:
+{
+  803a6e:	55                   	push   %ebp
+  803a6f:	89 e5                	mov    %esp,%ebp
+  803a71:	53                   	push   %ebx
+  803a72:	83 ec 04             	sub    $0x4,%esp
+  803a75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803a78:	e8 86 d3 ff ff       	call   800e03 <sys_getenvid>
+  803a7d:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803a82:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803a88:	85 db                	test   %ebx,%ebx
+  803a8a:	74 0c                	je     803a98 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a8c:	89 d9                	mov    %ebx,%ecx
+  803a8e:	c1 e1 10             	shl    $0x10,%ecx
+  803a91:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803a96:	29 ca                	sub    %ecx,%edx
+  803a98:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803a9b:	c1 e0 04             	shl    $0x4,%eax
+  803a9e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803aa3:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803aa5:	83 ec 0c             	sub    $0xc,%esp
+  803aa8:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803aaf:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ab2:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803ab9:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803ac0:	89 04 24             	mov    %eax,(%esp)
+  803ac3:	e8 25 ff ff ff       	call   8039ed <pthread_exit>
+
+00803ac8 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803ac8:	55                   	push   %ebp
+  803ac9:	89 e5                	mov    %esp,%ebp
+  803acb:	57                   	push   %edi
+  803acc:	56                   	push   %esi
+  803acd:	53                   	push   %ebx
+  803ace:	83 ec 1c             	sub    $0x1c,%esp
+  803ad1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ad3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803ad9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ae0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ae5:	77 0d                	ja     803af4 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ae7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803aec:	29 d0                	sub    %edx,%eax
+  803aee:	c1 e8 10             	shr    $0x10,%eax
+  803af1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803af9:	eb 2f                	jmp    803b2a <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803afb:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803b01:	8b 01                	mov    (%ecx),%eax
+  803b03:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803b06:	39 c2                	cmp    %eax,%edx
+  803b08:	75 14                	jne    803b1e <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803b0a:	83 ec 0c             	sub    $0xc,%esp
+  803b0d:	57                   	push   %edi
+  803b0e:	e8 a5 d2 ff ff       	call   800db8 <sys_env_destroy>
+  803b13:	83 c4 10             	add    $0x10,%esp
+  803b16:	85 c0                	test   %eax,%eax
+  803b18:	0f 88 97 00 00 00    	js     803bb5 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803b1e:	83 c3 01             	add    $0x1,%ebx
+  803b21:	83 fb 20             	cmp    $0x20,%ebx
+  803b24:	0f 84 d2 00 00 00    	je     803bfc <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803b2a:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803b2d:	74 ef                	je     803b1e <pthread_kill_others+0x56>
+  803b2f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b32:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803b39:	8b 40 04             	mov    0x4(%eax),%eax
+  803b3c:	83 f8 01             	cmp    $0x1,%eax
+  803b3f:	75 dd                	jne    803b1e <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803b41:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b44:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803b4b:	89 fe                	mov    %edi,%esi
+  803b4d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803b53:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803b56:	c1 e0 04             	shl    $0x4,%eax
+  803b59:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b5e:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803b61:	39 c7                	cmp    %eax,%edi
+  803b63:	75 b9                	jne    803b1e <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803b65:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803b68:	c1 e0 04             	shl    $0x4,%eax
+  803b6b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b70:	8b 40 54             	mov    0x54(%eax),%eax
+  803b73:	85 c0                	test   %eax,%eax
+  803b75:	74 a7                	je     803b1e <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803b77:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803b7a:	c1 e0 04             	shl    $0x4,%eax
+  803b7d:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803b83:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b85:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803b8b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b90:	0f 87 65 ff ff ff    	ja     803afb <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b96:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b9b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803b9d:	c1 e8 10             	shr    $0x10,%eax
+  803ba0:	0f 84 55 ff ff ff    	je     803afb <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ba6:	c1 e0 10             	shl    $0x10,%eax
+  803ba9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803bae:	29 c1                	sub    %eax,%ecx
+  803bb0:	e9 4c ff ff ff       	jmp    803b01 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803bb5:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803bb8:	c1 e2 04             	shl    $0x4,%edx
+  803bbb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803bc1:	8b 52 48             	mov    0x48(%edx),%edx
+  803bc4:	39 fa                	cmp    %edi,%edx
+  803bc6:	0f 85 52 ff ff ff    	jne    803b1e <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803bcc:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803bcf:	c1 e2 04             	shl    $0x4,%edx
+  803bd2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803bd8:	8b 52 54             	mov    0x54(%edx),%edx
+  803bdb:	85 d2                	test   %edx,%edx
+  803bdd:	0f 84 3b ff ff ff    	je     803b1e <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803be3:	83 ec 0c             	sub    $0xc,%esp
+  803be6:	50                   	push   %eax
+  803be7:	57                   	push   %edi
+  803be8:	68 70 4f 80 00       	push   $0x804f70
+  803bed:	68 bb 00 00 00       	push   $0xbb
+  803bf2:	68 60 4f 80 00       	push   $0x804f60
+  803bf7:	e8 62 c7 ff ff       	call   80035e <_panic>
+	}
+}
+  803bfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bff:	5b                   	pop    %ebx
+  803c00:	5e                   	pop    %esi
+  803c01:	5f                   	pop    %edi
+  803c02:	5d                   	pop    %ebp
+  803c03:	c3                   	ret
+
+00803c04 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803c04:	55                   	push   %ebp
+  803c05:	89 e5                	mov    %esp,%ebp
+  803c07:	53                   	push   %ebx
+  803c08:	83 ec 04             	sub    $0x4,%esp
+  803c0b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c0d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803c13:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803c19:	0f 87 85 00 00 00    	ja     803ca4 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c1f:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803c24:	29 c3                	sub    %eax,%ebx
+  803c26:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803c29:	83 ec 04             	sub    $0x4,%esp
+  803c2c:	68 80 02 00 00       	push   $0x280
+  803c31:	6a 00                	push   $0x0
+  803c33:	68 40 70 80 00       	push   $0x807040
+  803c38:	e8 31 cf ff ff       	call   800b6e <memset>
+	threads_mu.m_state = 0;
+  803c3d:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803c44:	00 00 00 
+	if (self != 0) {
+  803c47:	83 c4 10             	add    $0x10,%esp
+  803c4a:	85 db                	test   %ebx,%ebx
+  803c4c:	74 51                	je     803c9f <pthread_fork_child+0x9b>
+  803c4e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c50:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803c56:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803c5b:	77 18                	ja     803c75 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c5d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803c62:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803c64:	c1 e8 10             	shr    $0x10,%eax
+  803c67:	74 0c                	je     803c75 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c69:	c1 e0 10             	shl    $0x10,%eax
+  803c6c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803c71:	29 c2                	sub    %eax,%edx
+  803c73:	eb 06                	jmp    803c7b <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803c75:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803c7b:	8b 02                	mov    (%edx),%eax
+  803c7d:	8b 48 48             	mov    0x48(%eax),%ecx
+  803c80:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c87:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803c8a:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803c91:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803c98:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803c9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ca2:	c9                   	leave
+  803ca3:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803ca4:	83 ec 04             	sub    $0x4,%esp
+  803ca7:	68 80 02 00 00       	push   $0x280
+  803cac:	6a 00                	push   $0x0
+  803cae:	68 40 70 80 00       	push   $0x807040
+  803cb3:	e8 b6 ce ff ff       	call   800b6e <memset>
+	threads_mu.m_state = 0;
+  803cb8:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803cbf:	00 00 00 
+  803cc2:	83 c4 10             	add    $0x10,%esp
+  803cc5:	eb d8                	jmp    803c9f <pthread_fork_child+0x9b>
+
+00803cc7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccc:	c3                   	ret
+
+00803ccd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ccd:	55                   	push   %ebp
+  803cce:	89 e5                	mov    %esp,%ebp
+  803cd0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803cd3:	68 95 4f 80 00       	push   $0x804f95
+  803cd8:	ff 75 0c             	push   0xc(%ebp)
+  803cdb:	e8 3d cd ff ff       	call   800a1d <strcpy>
+	return 0;
+}
+  803ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce5:	c9                   	leave
+  803ce6:	c3                   	ret
+
+00803ce7 <devcons_write>:
+{
+  803ce7:	55                   	push   %ebp
+  803ce8:	89 e5                	mov    %esp,%ebp
+  803cea:	57                   	push   %edi
+  803ceb:	56                   	push   %esi
+  803cec:	53                   	push   %ebx
+  803ced:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803cf3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803cf8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803cfe:	eb 2e                	jmp    803d2e <devcons_write+0x47>
+		m = n - tot;
+  803d00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d03:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803d05:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d0a:	39 c3                	cmp    %eax,%ebx
+  803d0c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803d0f:	83 ec 04             	sub    $0x4,%esp
+  803d12:	53                   	push   %ebx
+  803d13:	89 f0                	mov    %esi,%eax
+  803d15:	03 45 0c             	add    0xc(%ebp),%eax
+  803d18:	50                   	push   %eax
+  803d19:	57                   	push   %edi
+  803d1a:	e8 84 ce ff ff       	call   800ba3 <memmove>
+		sys_cputs(buf, m);
+  803d1f:	83 c4 08             	add    $0x8,%esp
+  803d22:	53                   	push   %ebx
+  803d23:	57                   	push   %edi
+  803d24:	e8 38 d0 ff ff       	call   800d61 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d29:	01 de                	add    %ebx,%esi
+  803d2b:	83 c4 10             	add    $0x10,%esp
+  803d2e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803d31:	72 cd                	jb     803d00 <devcons_write+0x19>
+}
+  803d33:	89 f0                	mov    %esi,%eax
+  803d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d38:	5b                   	pop    %ebx
+  803d39:	5e                   	pop    %esi
+  803d3a:	5f                   	pop    %edi
+  803d3b:	5d                   	pop    %ebp
+  803d3c:	c3                   	ret
+
+00803d3d <devcons_read>:
+{
+  803d3d:	55                   	push   %ebp
+  803d3e:	89 e5                	mov    %esp,%ebp
+  803d40:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d48:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d4c:	75 07                	jne    803d55 <devcons_read+0x18>
+  803d4e:	eb 1f                	jmp    803d6f <devcons_read+0x32>
+		sys_yield();
+  803d50:	e8 da d0 ff ff       	call   800e2f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803d55:	e8 32 d0 ff ff       	call   800d8c <sys_cgetc>
+  803d5a:	85 c0                	test   %eax,%eax
+  803d5c:	74 f2                	je     803d50 <devcons_read+0x13>
+	if (c < 0)
+  803d5e:	78 0f                	js     803d6f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803d60:	83 f8 04             	cmp    $0x4,%eax
+  803d63:	74 0c                	je     803d71 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803d65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d68:	88 02                	mov    %al,(%edx)
+	return 1;
+  803d6a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803d6f:	c9                   	leave
+  803d70:	c3                   	ret
+		return 0;
+  803d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d76:	eb f7                	jmp    803d6f <devcons_read+0x32>
+
+00803d78 <cputchar>:
+{
+  803d78:	55                   	push   %ebp
+  803d79:	89 e5                	mov    %esp,%ebp
+  803d7b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d81:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803d84:	6a 01                	push   $0x1
+  803d86:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d89:	50                   	push   %eax
+  803d8a:	e8 d2 cf ff ff       	call   800d61 <sys_cputs>
+}
+  803d8f:	83 c4 10             	add    $0x10,%esp
+  803d92:	c9                   	leave
+  803d93:	c3                   	ret
+
+00803d94 <getchar>:
+{
+  803d94:	55                   	push   %ebp
+  803d95:	89 e5                	mov    %esp,%ebp
+  803d97:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803d9a:	6a 01                	push   $0x1
+  803d9c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d9f:	50                   	push   %eax
+  803da0:	6a 00                	push   $0x0
+  803da2:	e8 63 d8 ff ff       	call   80160a <read>
+	if (r < 0)
+  803da7:	83 c4 10             	add    $0x10,%esp
+  803daa:	85 c0                	test   %eax,%eax
+  803dac:	78 06                	js     803db4 <getchar+0x20>
+	if (r < 1)
+  803dae:	74 06                	je     803db6 <getchar+0x22>
+	return c;
+  803db0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803db4:	c9                   	leave
+  803db5:	c3                   	ret
+		return -E_EOF;
+  803db6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803dbb:	eb f7                	jmp    803db4 <getchar+0x20>
+
+00803dbd <iscons>:
+{
+  803dbd:	55                   	push   %ebp
+  803dbe:	89 e5                	mov    %esp,%ebp
+  803dc0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803dc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803dc6:	50                   	push   %eax
+  803dc7:	ff 75 08             	push   0x8(%ebp)
+  803dca:	e8 ab d5 ff ff       	call   80137a <fd_lookup>
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	85 c0                	test   %eax,%eax
+  803dd4:	78 11                	js     803de7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803dd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dd9:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803ddf:	39 10                	cmp    %edx,(%eax)
+  803de1:	0f 94 c0             	sete   %al
+  803de4:	0f b6 c0             	movzbl %al,%eax
+}
+  803de7:	c9                   	leave
+  803de8:	c3                   	ret
+
+00803de9 <opencons>:
+{
+  803de9:	55                   	push   %ebp
+  803dea:	89 e5                	mov    %esp,%ebp
+  803dec:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803def:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803df2:	50                   	push   %eax
+  803df3:	e8 2c d5 ff ff       	call   801324 <fd_alloc>
+  803df8:	83 c4 10             	add    $0x10,%esp
+  803dfb:	85 c0                	test   %eax,%eax
+  803dfd:	78 3a                	js     803e39 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803dff:	83 ec 04             	sub    $0x4,%esp
+  803e02:	68 07 04 00 00       	push   $0x407
+  803e07:	ff 75 f4             	push   -0xc(%ebp)
+  803e0a:	6a 00                	push   $0x0
+  803e0c:	e8 4a d0 ff ff       	call   800e5b <sys_page_alloc>
+  803e11:	83 c4 10             	add    $0x10,%esp
+  803e14:	85 c0                	test   %eax,%eax
+  803e16:	78 21                	js     803e39 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803e18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e1b:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803e21:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803e23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e26:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803e2d:	83 ec 0c             	sub    $0xc,%esp
+  803e30:	50                   	push   %eax
+  803e31:	e8 c7 d4 ff ff       	call   8012fd <fd2num>
+  803e36:	83 c4 10             	add    $0x10,%esp
+}
+  803e39:	c9                   	leave
+  803e3a:	c3                   	ret
+
+00803e3b <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803e3b:	55                   	push   %ebp
+  803e3c:	89 e5                	mov    %esp,%ebp
+  803e3e:	57                   	push   %edi
+  803e3f:	56                   	push   %esi
+  803e40:	53                   	push   %ebx
+  803e41:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803e44:	89 d6                	mov    %edx,%esi
+  803e46:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803e49:	89 cf                	mov    %ecx,%edi
+  803e4b:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803e4e:	89 fa                	mov    %edi,%edx
+  803e50:	80 ce 08             	or     $0x8,%dh
+  803e53:	f6 c5 08             	test   $0x8,%ch
+  803e56:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803e59:	57                   	push   %edi
+  803e5a:	56                   	push   %esi
+  803e5b:	50                   	push   %eax
+  803e5c:	56                   	push   %esi
+  803e5d:	6a 00                	push   $0x0
+  803e5f:	e8 44 d0 ff ff       	call   800ea8 <sys_page_map>
+	if (r < 0) {
+  803e64:	83 c4 20             	add    $0x20,%esp
+  803e67:	85 c0                	test   %eax,%eax
+  803e69:	78 27                	js     803e92 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803e6b:	83 ec 0c             	sub    $0xc,%esp
+  803e6e:	57                   	push   %edi
+  803e6f:	56                   	push   %esi
+  803e70:	6a 00                	push   $0x0
+  803e72:	56                   	push   %esi
+  803e73:	6a 00                	push   $0x0
+  803e75:	e8 2e d0 ff ff       	call   800ea8 <sys_page_map>
+  803e7a:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e7c:	83 c4 20             	add    $0x20,%esp
+  803e7f:	85 c0                	test   %eax,%eax
+  803e81:	78 24                	js     803ea7 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803e83:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e88:	89 d8                	mov    %ebx,%eax
+  803e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e8d:	5b                   	pop    %ebx
+  803e8e:	5e                   	pop    %esi
+  803e8f:	5f                   	pop    %edi
+  803e90:	5d                   	pop    %ebp
+  803e91:	c3                   	ret
+  803e92:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e94:	83 ec 08             	sub    $0x8,%esp
+  803e97:	50                   	push   %eax
+  803e98:	68 a4 4f 80 00       	push   $0x804fa4
+  803e9d:	e8 97 c5 ff ff       	call   800439 <cprintf>
+		return r;
+  803ea2:	83 c4 10             	add    $0x10,%esp
+  803ea5:	eb e1                	jmp    803e88 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803ea7:	83 ec 08             	sub    $0x8,%esp
+  803eaa:	50                   	push   %eax
+  803eab:	68 d4 4f 80 00       	push   $0x804fd4
+  803eb0:	e8 84 c5 ff ff       	call   800439 <cprintf>
+		return r;
+  803eb5:	83 c4 10             	add    $0x10,%esp
+  803eb8:	eb ce                	jmp    803e88 <duppage_cow+0x4d>
+
+00803eba <duppage>:
+{
+  803eba:	55                   	push   %ebp
+  803ebb:	89 e5                	mov    %esp,%ebp
+  803ebd:	53                   	push   %ebx
+  803ebe:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803ec1:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803ec4:	51                   	push   %ecx
+  803ec5:	52                   	push   %edx
+  803ec6:	50                   	push   %eax
+  803ec7:	52                   	push   %edx
+  803ec8:	6a 00                	push   $0x0
+  803eca:	e8 d9 cf ff ff       	call   800ea8 <sys_page_map>
+	if (r < 0) {
+  803ecf:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803ed7:	85 c0                	test   %eax,%eax
+  803ed9:	78 07                	js     803ee2 <duppage+0x28>
+}
+  803edb:	89 d8                	mov    %ebx,%eax
+  803edd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ee0:	c9                   	leave
+  803ee1:	c3                   	ret
+  803ee2:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803ee4:	83 ec 08             	sub    $0x8,%esp
+  803ee7:	50                   	push   %eax
+  803ee8:	68 a4 4f 80 00       	push   $0x804fa4
+  803eed:	e8 47 c5 ff ff       	call   800439 <cprintf>
+		return r;
+  803ef2:	83 c4 10             	add    $0x10,%esp
+  803ef5:	eb e4                	jmp    803edb <duppage+0x21>
+
+00803ef7 <cow_copy>:
+{
+  803ef7:	55                   	push   %ebp
+  803ef8:	89 e5                	mov    %esp,%ebp
+  803efa:	56                   	push   %esi
+  803efb:	53                   	push   %ebx
+  803efc:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803efe:	83 ec 04             	sub    $0x4,%esp
+  803f01:	6a 07                	push   $0x7
+  803f03:	68 00 f0 7f 00       	push   $0x7ff000
+  803f08:	6a 00                	push   $0x0
+  803f0a:	e8 4c cf ff ff       	call   800e5b <sys_page_alloc>
+	if (r < 0) {
+  803f0f:	83 c4 10             	add    $0x10,%esp
+  803f12:	85 c0                	test   %eax,%eax
+  803f14:	78 58                	js     803f6e <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803f16:	83 ec 04             	sub    $0x4,%esp
+  803f19:	68 00 10 00 00       	push   $0x1000
+  803f1e:	56                   	push   %esi
+  803f1f:	68 00 f0 7f 00       	push   $0x7ff000
+  803f24:	e8 7a cc ff ff       	call   800ba3 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803f29:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803f30:	56                   	push   %esi
+  803f31:	6a 00                	push   $0x0
+  803f33:	68 00 f0 7f 00       	push   $0x7ff000
+  803f38:	6a 00                	push   $0x0
+  803f3a:	e8 69 cf ff ff       	call   800ea8 <sys_page_map>
+  803f3f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803f41:	83 c4 20             	add    $0x20,%esp
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	78 3b                	js     803f83 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803f48:	83 ec 08             	sub    $0x8,%esp
+  803f4b:	68 00 f0 7f 00       	push   $0x7ff000
+  803f50:	6a 00                	push   $0x0
+  803f52:	e8 9d cf ff ff       	call   800ef4 <sys_page_unmap>
+  803f57:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803f59:	83 c4 10             	add    $0x10,%esp
+  803f5c:	85 c0                	test   %eax,%eax
+  803f5e:	78 45                	js     803fa5 <cow_copy+0xae>
+	return 0;
+  803f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803f65:	89 d8                	mov    %ebx,%eax
+  803f67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f6a:	5b                   	pop    %ebx
+  803f6b:	5e                   	pop    %esi
+  803f6c:	5d                   	pop    %ebp
+  803f6d:	c3                   	ret
+  803f6e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803f70:	83 ec 08             	sub    $0x8,%esp
+  803f73:	50                   	push   %eax
+  803f74:	68 c4 50 80 00       	push   $0x8050c4
+  803f79:	e8 bb c4 ff ff       	call   800439 <cprintf>
+		return r;
+  803f7e:	83 c4 10             	add    $0x10,%esp
+  803f81:	eb e2                	jmp    803f65 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803f83:	83 ec 08             	sub    $0x8,%esp
+  803f86:	50                   	push   %eax
+  803f87:	68 e0 50 80 00       	push   $0x8050e0
+  803f8c:	e8 a8 c4 ff ff       	call   800439 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803f91:	83 c4 08             	add    $0x8,%esp
+  803f94:	68 00 f0 7f 00       	push   $0x7ff000
+  803f99:	6a 00                	push   $0x0
+  803f9b:	e8 54 cf ff ff       	call   800ef4 <sys_page_unmap>
+		return r;
+  803fa0:	83 c4 10             	add    $0x10,%esp
+  803fa3:	eb c0                	jmp    803f65 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803fa5:	83 ec 08             	sub    $0x8,%esp
+  803fa8:	50                   	push   %eax
+  803fa9:	68 fc 4f 80 00       	push   $0x804ffc
+  803fae:	e8 86 c4 ff ff       	call   800439 <cprintf>
+		return r;
+  803fb3:	83 c4 10             	add    $0x10,%esp
+  803fb6:	eb ad                	jmp    803f65 <cow_copy+0x6e>
+
+00803fb8 <pgfault>:
+{
+  803fb8:	55                   	push   %ebp
+  803fb9:	89 e5                	mov    %esp,%ebp
+  803fbb:	56                   	push   %esi
+  803fbc:	53                   	push   %ebx
+  803fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803fc0:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803fc2:	89 d8                	mov    %ebx,%eax
+  803fc4:	c1 e8 16             	shr    $0x16,%eax
+  803fc7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803fce:	89 de                	mov    %ebx,%esi
+  803fd0:	c1 ee 0c             	shr    $0xc,%esi
+  803fd3:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803fda:	a8 07                	test   $0x7,%al
+  803fdc:	74 3b                	je     804019 <pgfault+0x61>
+  803fde:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803fe4:	74 33                	je     804019 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803fe6:	83 ec 0c             	sub    $0xc,%esp
+  803fe9:	68 00 f0 bf ee       	push   $0xeebff000
+  803fee:	e8 c8 f4 ff ff       	call   8034bb <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803ff3:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803ffa:	83 c4 10             	add    $0x10,%esp
+  803ffd:	f6 c4 08             	test   $0x8,%ah
+  804000:	75 30                	jne    804032 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804002:	83 ec 0c             	sub    $0xc,%esp
+  804005:	68 00 f0 bf ee       	push   $0xeebff000
+  80400a:	e8 19 f5 ff ff       	call   803528 <mutex_unlock>
+}
+  80400f:	83 c4 10             	add    $0x10,%esp
+  804012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804015:	5b                   	pop    %ebx
+  804016:	5e                   	pop    %esi
+  804017:	5d                   	pop    %ebp
+  804018:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804019:	83 ec 08             	sub    $0x8,%esp
+  80401c:	ff 72 28             	push   0x28(%edx)
+  80401f:	51                   	push   %ecx
+  804020:	50                   	push   %eax
+  804021:	68 20 50 80 00       	push   $0x805020
+  804026:	6a 3f                	push   $0x3f
+  804028:	68 fa 50 80 00       	push   $0x8050fa
+  80402d:	e8 2c c3 ff ff       	call   80035e <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804032:	89 d8                	mov    %ebx,%eax
+  804034:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804039:	e8 b9 fe ff ff       	call   803ef7 <cow_copy>
+  80403e:	eb c2                	jmp    804002 <pgfault+0x4a>
+
+00804040 <cow_enable>:
+{
+  804040:	55                   	push   %ebp
+  804041:	89 e5                	mov    %esp,%ebp
+  804043:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804046:	68 b8 3f 80 00       	push   $0x803fb8
+  80404b:	e8 28 06 00 00       	call   804678 <set_pgfault_handler>
+}
+  804050:	83 c4 10             	add    $0x10,%esp
+  804053:	c9                   	leave
+  804054:	c3                   	ret
+
+00804055 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804055:	55                   	push   %ebp
+  804056:	89 e5                	mov    %esp,%ebp
+  804058:	57                   	push   %edi
+  804059:	56                   	push   %esi
+  80405a:	53                   	push   %ebx
+  80405b:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80405e:	68 b8 3f 80 00       	push   $0x803fb8
+  804063:	e8 10 06 00 00       	call   804678 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804068:	b8 07 00 00 00       	mov    $0x7,%eax
+  80406d:	cd 30                	int    $0x30
+  80406f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804072:	83 c4 10             	add    $0x10,%esp
+  804075:	85 c0                	test   %eax,%eax
+  804077:	78 4b                	js     8040c4 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804079:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80407e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804083:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804086:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80408a:	0f 85 16 01 00 00    	jne    8041a6 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804090:	e8 6e cd ff ff       	call   800e03 <sys_getenvid>
+  804095:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80409a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80409c:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8040a2:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040a8:	77 32                	ja     8040dc <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040aa:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8040af:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8040b1:	c1 ea 10             	shr    $0x10,%edx
+  8040b4:	74 26                	je     8040dc <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040b6:	c1 e2 10             	shl    $0x10,%edx
+  8040b9:	89 d1                	mov    %edx,%ecx
+  8040bb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8040c0:	29 ca                	sub    %ecx,%edx
+  8040c2:	eb 1e                	jmp    8040e2 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8040c4:	83 ec 08             	sub    $0x8,%esp
+  8040c7:	89 c7                	mov    %eax,%edi
+  8040c9:	50                   	push   %eax
+  8040ca:	68 05 51 80 00       	push   $0x805105
+  8040cf:	e8 65 c3 ff ff       	call   800439 <cprintf>
+		return eid;
+  8040d4:	83 c4 10             	add    $0x10,%esp
+  8040d7:	e9 6c 01 00 00       	jmp    804248 <fork+0x1f3>
+		return pthread_main_tls;
+  8040dc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8040e2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8040e5:	c1 e0 04             	shl    $0x4,%eax
+  8040e8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040ed:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8040ef:	e8 10 fb ff ff       	call   803c04 <pthread_fork_child>
+		return eid;
+  8040f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8040f7:	e9 4c 01 00 00       	jmp    804248 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040fc:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804102:	89 da                	mov    %ebx,%edx
+  804104:	89 f8                	mov    %edi,%eax
+  804106:	e8 af fd ff ff       	call   803eba <duppage>
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	79 28                	jns    804137 <fork+0xe2>
+  80410f:	89 c7                	mov    %eax,%edi
+  804111:	e9 32 01 00 00       	jmp    804248 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804116:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80411c:	83 f9 05             	cmp    $0x5,%ecx
+  80411f:	75 58                	jne    804179 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804121:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804126:	89 da                	mov    %ebx,%edx
+  804128:	89 f8                	mov    %edi,%eax
+  80412a:	e8 8b fd ff ff       	call   803eba <duppage>
+  80412f:	85 c0                	test   %eax,%eax
+  804131:	0f 88 0f 01 00 00    	js     804246 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804137:	83 c3 01             	add    $0x1,%ebx
+  80413a:	39 de                	cmp    %ebx,%esi
+  80413c:	74 54                	je     804192 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80413e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804145:	f6 c1 05             	test   $0x5,%cl
+  804148:	74 ed                	je     804137 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80414a:	f6 c5 04             	test   $0x4,%ch
+  80414d:	75 ad                	jne    8040fc <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80414f:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804155:	74 bf                	je     804116 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804157:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80415d:	74 d8                	je     804137 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80415f:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804165:	89 da                	mov    %ebx,%edx
+  804167:	89 f8                	mov    %edi,%eax
+  804169:	e8 cd fc ff ff       	call   803e3b <duppage_cow>
+  80416e:	85 c0                	test   %eax,%eax
+  804170:	79 c5                	jns    804137 <fork+0xe2>
+  804172:	89 c7                	mov    %eax,%edi
+  804174:	e9 cf 00 00 00       	jmp    804248 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804179:	68 50 50 80 00       	push   $0x805050
+  80417e:	68 5d 4e 80 00       	push   $0x804e5d
+  804183:	68 c6 00 00 00       	push   $0xc6
+  804188:	68 fa 50 80 00       	push   $0x8050fa
+  80418d:	e8 cc c1 ff ff       	call   80035e <_panic>
+  804192:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804195:	83 c1 01             	add    $0x1,%ecx
+  804198:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80419e:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8041a4:	74 18                	je     8041be <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8041a6:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8041ad:	a8 07                	test   $0x7,%al
+  8041af:	74 e4                	je     804195 <fork+0x140>
+  8041b1:	89 cb                	mov    %ecx,%ebx
+  8041b3:	c1 e3 0a             	shl    $0xa,%ebx
+  8041b6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8041b9:	e9 7c ff ff ff       	jmp    80413a <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041be:	83 ec 04             	sub    $0x4,%esp
+  8041c1:	6a 07                	push   $0x7
+  8041c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8041c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8041cb:	e8 8b cc ff ff       	call   800e5b <sys_page_alloc>
+  8041d0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041d2:	83 c4 10             	add    $0x10,%esp
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	78 34                	js     80420d <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041d9:	83 ec 08             	sub    $0x8,%esp
+  8041dc:	68 b6 46 80 00       	push   $0x8046b6
+  8041e1:	ff 75 e4             	push   -0x1c(%ebp)
+  8041e4:	e8 ef cd ff ff       	call   800fd8 <sys_env_set_pgfault_upcall>
+  8041e9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041eb:	83 c4 10             	add    $0x10,%esp
+  8041ee:	85 c0                	test   %eax,%eax
+  8041f0:	78 2e                	js     804220 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041f2:	83 ec 08             	sub    $0x8,%esp
+  8041f5:	6a 02                	push   $0x2
+  8041f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8041fa:	e8 41 cd ff ff       	call   800f40 <sys_env_set_status>
+  8041ff:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804201:	83 c4 10             	add    $0x10,%esp
+  804204:	85 c0                	test   %eax,%eax
+  804206:	78 2b                	js     804233 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804208:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80420b:	eb 3b                	jmp    804248 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80420d:	83 ec 08             	sub    $0x8,%esp
+  804210:	50                   	push   %eax
+  804211:	68 78 50 80 00       	push   $0x805078
+  804216:	e8 1e c2 ff ff       	call   800439 <cprintf>
+		return r;
+  80421b:	83 c4 10             	add    $0x10,%esp
+  80421e:	eb 28                	jmp    804248 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804220:	83 ec 08             	sub    $0x8,%esp
+  804223:	50                   	push   %eax
+  804224:	68 a0 50 80 00       	push   $0x8050a0
+  804229:	e8 0b c2 ff ff       	call   800439 <cprintf>
+		return r;
+  80422e:	83 c4 10             	add    $0x10,%esp
+  804231:	eb 15                	jmp    804248 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804233:	83 ec 08             	sub    $0x8,%esp
+  804236:	50                   	push   %eax
+  804237:	68 15 51 80 00       	push   $0x805115
+  80423c:	e8 f8 c1 ff ff       	call   800439 <cprintf>
+		return r;
+  804241:	83 c4 10             	add    $0x10,%esp
+  804244:	eb 02                	jmp    804248 <fork+0x1f3>
+  804246:	89 c7                	mov    %eax,%edi
+}
+  804248:	89 f8                	mov    %edi,%eax
+  80424a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80424d:	5b                   	pop    %ebx
+  80424e:	5e                   	pop    %esi
+  80424f:	5f                   	pop    %edi
+  804250:	5d                   	pop    %ebp
+  804251:	c3                   	ret
+
+00804252 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804252:	55                   	push   %ebp
+  804253:	89 e5                	mov    %esp,%ebp
+  804255:	57                   	push   %edi
+  804256:	56                   	push   %esi
+  804257:	53                   	push   %ebx
+  804258:	83 ec 2c             	sub    $0x2c,%esp
+  80425b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80425d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804263:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804268:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80426e:	77 0a                	ja     80427a <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804270:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804275:	29 c3                	sub    %eax,%ebx
+  804277:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80427a:	83 ec 0c             	sub    $0xc,%esp
+  80427d:	68 b8 3f 80 00       	push   $0x803fb8
+  804282:	e8 f1 03 00 00       	call   804678 <set_pgfault_handler>
+  804287:	b8 07 00 00 00       	mov    $0x7,%eax
+  80428c:	cd 30                	int    $0x30
+  80428e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804291:	83 c4 10             	add    $0x10,%esp
+  804294:	85 c0                	test   %eax,%eax
+  804296:	78 30                	js     8042c8 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804298:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80429c:	74 42                	je     8042e0 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80429e:	c1 e3 10             	shl    $0x10,%ebx
+  8042a1:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8042a6:	29 d8                	sub    %ebx,%eax
+  8042a8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8042ab:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8042b0:	29 d8                	sub    %ebx,%eax
+  8042b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8042b5:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042bf:	89 f7                	mov    %esi,%edi
+  8042c1:	89 d6                	mov    %edx,%esi
+  8042c3:	e9 2c 01 00 00       	jmp    8043f4 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8042c8:	83 ec 08             	sub    $0x8,%esp
+  8042cb:	89 c7                	mov    %eax,%edi
+  8042cd:	50                   	push   %eax
+  8042ce:	68 05 51 80 00       	push   $0x805105
+  8042d3:	e8 61 c1 ff ff       	call   800439 <cprintf>
+		return eid;
+  8042d8:	83 c4 10             	add    $0x10,%esp
+  8042db:	e9 d5 00 00 00       	jmp    8043b5 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8042e0:	e8 1e cb ff ff       	call   800e03 <sys_getenvid>
+  8042e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042ea:	89 c2                	mov    %eax,%edx
+  8042ec:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042ee:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8042f4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f9:	77 18                	ja     804313 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042fb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804300:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804302:	c1 e8 10             	shr    $0x10,%eax
+  804305:	74 0c                	je     804313 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804307:	c1 e0 10             	shl    $0x10,%eax
+  80430a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80430f:	29 c1                	sub    %eax,%ecx
+  804311:	eb 06                	jmp    804319 <sfork+0xc7>
+		return pthread_main_tls;
+  804313:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  804319:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80431c:	c1 e0 04             	shl    $0x4,%eax
+  80431f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804324:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804326:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804329:	e9 87 00 00 00       	jmp    8043b5 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80432e:	f6 c5 04             	test   $0x4,%ch
+  804331:	74 6c                	je     80439f <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804333:	89 ca                	mov    %ecx,%edx
+  804335:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80433b:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804341:	74 7c                	je     8043bf <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804343:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804349:	89 da                	mov    %ebx,%edx
+  80434b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80434e:	e8 67 fb ff ff       	call   803eba <duppage>
+  804353:	85 c0                	test   %eax,%eax
+  804355:	0f 88 4f 01 00 00    	js     8044aa <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80435b:	83 c3 01             	add    $0x1,%ebx
+  80435e:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804361:	74 7a                	je     8043dd <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804363:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804365:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80436c:	f6 c1 01             	test   $0x1,%cl
+  80436f:	74 ea                	je     80435b <sfork+0x109>
+  804371:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804377:	74 e2                	je     80435b <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804379:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80437f:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804382:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804387:	76 a5                	jbe    80432e <sfork+0xdc>
+  804389:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80438f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804392:	39 fa                	cmp    %edi,%edx
+  804394:	73 9d                	jae    804333 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804396:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804399:	39 fa                	cmp    %edi,%edx
+  80439b:	72 96                	jb     804333 <sfork+0xe1>
+  80439d:	eb 8f                	jmp    80432e <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80439f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8043a5:	89 da                	mov    %ebx,%edx
+  8043a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8043aa:	e8 8c fa ff ff       	call   803e3b <duppage_cow>
+  8043af:	85 c0                	test   %eax,%eax
+  8043b1:	79 a8                	jns    80435b <sfork+0x109>
+  8043b3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8043b5:	89 f8                	mov    %edi,%eax
+  8043b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ba:	5b                   	pop    %ebx
+  8043bb:	5e                   	pop    %esi
+  8043bc:	5f                   	pop    %edi
+  8043bd:	5d                   	pop    %ebp
+  8043be:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8043bf:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8043c4:	e8 2e fb ff ff       	call   803ef7 <cow_copy>
+  8043c9:	85 c0                	test   %eax,%eax
+  8043cb:	0f 88 d2 00 00 00    	js     8044a3 <sfork+0x251>
+				pte = uvpt[pn];
+  8043d1:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8043d8:	e9 66 ff ff ff       	jmp    804343 <sfork+0xf1>
+  8043dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8043e0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8043e3:	83 c6 01             	add    $0x1,%esi
+  8043e6:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8043ec:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8043f2:	74 1b                	je     80440f <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8043f4:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8043fb:	a8 01                	test   $0x1,%al
+  8043fd:	74 e4                	je     8043e3 <sfork+0x191>
+  8043ff:	89 f3                	mov    %esi,%ebx
+  804401:	c1 e3 0a             	shl    $0xa,%ebx
+  804404:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804407:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80440a:	e9 4f ff ff ff       	jmp    80435e <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80440f:	83 ec 04             	sub    $0x4,%esp
+  804412:	6a 07                	push   $0x7
+  804414:	68 00 f0 bf ee       	push   $0xeebff000
+  804419:	ff 75 e0             	push   -0x20(%ebp)
+  80441c:	e8 3a ca ff ff       	call   800e5b <sys_page_alloc>
+  804421:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804423:	83 c4 10             	add    $0x10,%esp
+  804426:	85 c0                	test   %eax,%eax
+  804428:	78 37                	js     804461 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80442a:	83 ec 08             	sub    $0x8,%esp
+  80442d:	68 b6 46 80 00       	push   $0x8046b6
+  804432:	ff 75 e0             	push   -0x20(%ebp)
+  804435:	e8 9e cb ff ff       	call   800fd8 <sys_env_set_pgfault_upcall>
+  80443a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80443c:	83 c4 10             	add    $0x10,%esp
+  80443f:	85 c0                	test   %eax,%eax
+  804441:	78 34                	js     804477 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804443:	83 ec 08             	sub    $0x8,%esp
+  804446:	6a 02                	push   $0x2
+  804448:	ff 75 e0             	push   -0x20(%ebp)
+  80444b:	e8 f0 ca ff ff       	call   800f40 <sys_env_set_status>
+  804450:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804452:	83 c4 10             	add    $0x10,%esp
+  804455:	85 c0                	test   %eax,%eax
+  804457:	78 34                	js     80448d <sfork+0x23b>
+	return eid;
+  804459:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80445c:	e9 54 ff ff ff       	jmp    8043b5 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804461:	83 ec 08             	sub    $0x8,%esp
+  804464:	50                   	push   %eax
+  804465:	68 78 50 80 00       	push   $0x805078
+  80446a:	e8 ca bf ff ff       	call   800439 <cprintf>
+		return r;
+  80446f:	83 c4 10             	add    $0x10,%esp
+  804472:	e9 3e ff ff ff       	jmp    8043b5 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804477:	83 ec 08             	sub    $0x8,%esp
+  80447a:	50                   	push   %eax
+  80447b:	68 a0 50 80 00       	push   $0x8050a0
+  804480:	e8 b4 bf ff ff       	call   800439 <cprintf>
+		return r;
+  804485:	83 c4 10             	add    $0x10,%esp
+  804488:	e9 28 ff ff ff       	jmp    8043b5 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80448d:	83 ec 08             	sub    $0x8,%esp
+  804490:	50                   	push   %eax
+  804491:	68 15 51 80 00       	push   $0x805115
+  804496:	e8 9e bf ff ff       	call   800439 <cprintf>
+		return r;
+  80449b:	83 c4 10             	add    $0x10,%esp
+  80449e:	e9 12 ff ff ff       	jmp    8043b5 <sfork+0x163>
+  8044a3:	89 c7                	mov    %eax,%edi
+  8044a5:	e9 0b ff ff ff       	jmp    8043b5 <sfork+0x163>
+  8044aa:	89 c7                	mov    %eax,%edi
+  8044ac:	e9 04 ff ff ff       	jmp    8043b5 <sfork+0x163>
+
+008044b1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8044b1:	55                   	push   %ebp
+  8044b2:	89 e5                	mov    %esp,%ebp
+  8044b4:	57                   	push   %edi
+  8044b5:	56                   	push   %esi
+  8044b6:	53                   	push   %ebx
+  8044b7:	83 ec 18             	sub    $0x18,%esp
+  8044ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8044bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044c3:	85 c0                	test   %eax,%eax
+  8044c5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8044ca:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8044cd:	50                   	push   %eax
+  8044ce:	e8 7e cb ff ff       	call   801051 <sys_ipc_recv>
+	if (r < 0) {
+  8044d3:	83 c4 10             	add    $0x10,%esp
+  8044d6:	85 c0                	test   %eax,%eax
+  8044d8:	78 2b                	js     804505 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8044da:	85 ff                	test   %edi,%edi
+  8044dc:	74 55                	je     804533 <ipc_recv+0x82>
+  8044de:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044e0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044e6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044eb:	77 39                	ja     804526 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044ed:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044f2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044f4:	c1 e8 10             	shr    $0x10,%eax
+  8044f7:	74 2d                	je     804526 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044f9:	c1 e0 10             	shl    $0x10,%eax
+  8044fc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804501:	29 c2                	sub    %eax,%edx
+  804503:	eb 27                	jmp    80452c <ipc_recv+0x7b>
+  804505:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804507:	83 ec 08             	sub    $0x8,%esp
+  80450a:	50                   	push   %eax
+  80450b:	68 33 51 80 00       	push   $0x805133
+  804510:	e8 24 bf ff ff       	call   800439 <cprintf>
+		*from_env_store = 0;
+  804515:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80451b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804521:	83 c4 10             	add    $0x10,%esp
+  804524:	eb 77                	jmp    80459d <ipc_recv+0xec>
+		return pthread_main_tls;
+  804526:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80452c:	8b 02                	mov    (%edx),%eax
+  80452e:	8b 40 78             	mov    0x78(%eax),%eax
+  804531:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804533:	85 f6                	test   %esi,%esi
+  804535:	74 34                	je     80456b <ipc_recv+0xba>
+  804537:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804539:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80453f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804544:	77 18                	ja     80455e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804546:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80454b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80454d:	c1 e8 10             	shr    $0x10,%eax
+  804550:	74 0c                	je     80455e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804552:	c1 e0 10             	shl    $0x10,%eax
+  804555:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80455a:	29 c2                	sub    %eax,%edx
+  80455c:	eb 06                	jmp    804564 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80455e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804564:	8b 02                	mov    (%edx),%eax
+  804566:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804569:	89 06                	mov    %eax,(%esi)
+  80456b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80456d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804573:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804578:	77 18                	ja     804592 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80457a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80457f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804581:	c1 e8 10             	shr    $0x10,%eax
+  804584:	74 0c                	je     804592 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804586:	c1 e0 10             	shl    $0x10,%eax
+  804589:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80458e:	29 c2                	sub    %eax,%edx
+  804590:	eb 06                	jmp    804598 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804592:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804598:	8b 02                	mov    (%edx),%eax
+  80459a:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80459d:	89 d8                	mov    %ebx,%eax
+  80459f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045a2:	5b                   	pop    %ebx
+  8045a3:	5e                   	pop    %esi
+  8045a4:	5f                   	pop    %edi
+  8045a5:	5d                   	pop    %ebp
+  8045a6:	c3                   	ret
+
+008045a7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8045a7:	55                   	push   %ebp
+  8045a8:	89 e5                	mov    %esp,%ebp
+  8045aa:	57                   	push   %edi
+  8045ab:	56                   	push   %esi
+  8045ac:	53                   	push   %ebx
+  8045ad:	83 ec 0c             	sub    $0xc,%esp
+  8045b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8045b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8045b9:	85 db                	test   %ebx,%ebx
+  8045bb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8045c0:	0f 44 d8             	cmove  %eax,%ebx
+  8045c3:	eb 05                	jmp    8045ca <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8045c5:	e8 65 c8 ff ff       	call   800e2f <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8045ca:	57                   	push   %edi
+  8045cb:	53                   	push   %ebx
+  8045cc:	ff 75 0c             	push   0xc(%ebp)
+  8045cf:	56                   	push   %esi
+  8045d0:	e8 4f ca ff ff       	call   801024 <sys_ipc_try_send>
+		if (r == 0) {
+  8045d5:	83 c4 10             	add    $0x10,%esp
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	74 19                	je     8045f5 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8045dc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8045df:	74 e4                	je     8045c5 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8045e1:	83 ec 0c             	sub    $0xc,%esp
+  8045e4:	50                   	push   %eax
+  8045e5:	57                   	push   %edi
+  8045e6:	53                   	push   %ebx
+  8045e7:	56                   	push   %esi
+  8045e8:	68 4c 51 80 00       	push   $0x80514c
+  8045ed:	e8 47 be ff ff       	call   800439 <cprintf>
+			return;
+  8045f2:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8045f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045f8:	5b                   	pop    %ebx
+  8045f9:	5e                   	pop    %esi
+  8045fa:	5f                   	pop    %edi
+  8045fb:	5d                   	pop    %ebp
+  8045fc:	c3                   	ret
+
+008045fd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8045fd:	55                   	push   %ebp
+  8045fe:	89 e5                	mov    %esp,%ebp
+  804600:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804603:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804608:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80460b:	c1 e0 04             	shl    $0x4,%eax
+  80460e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804613:	8b 40 50             	mov    0x50(%eax),%eax
+  804616:	39 c8                	cmp    %ecx,%eax
+  804618:	74 12                	je     80462c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80461a:	83 c2 01             	add    $0x1,%edx
+  80461d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804623:	75 e3                	jne    804608 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80462a:	eb 0e                	jmp    80463a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80462c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80462f:	c1 e0 04             	shl    $0x4,%eax
+  804632:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804637:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80463a:	5d                   	pop    %ebp
+  80463b:	c3                   	ret
+
+0080463c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80463c:	55                   	push   %ebp
+  80463d:	89 e5                	mov    %esp,%ebp
+  80463f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804642:	89 c2                	mov    %eax,%edx
+  804644:	c1 ea 16             	shr    $0x16,%edx
+  804647:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80464e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804653:	f6 c1 01             	test   $0x1,%cl
+  804656:	74 1c                	je     804674 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804658:	c1 e8 0c             	shr    $0xc,%eax
+  80465b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804662:	a8 01                	test   $0x1,%al
+  804664:	74 0e                	je     804674 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804666:	c1 e8 0c             	shr    $0xc,%eax
+  804669:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804670:	ef 
+  804671:	0f b7 d2             	movzwl %dx,%edx
+}
+  804674:	89 d0                	mov    %edx,%eax
+  804676:	5d                   	pop    %ebp
+  804677:	c3                   	ret
+
+00804678 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804678:	55                   	push   %ebp
+  804679:	89 e5                	mov    %esp,%ebp
+  80467b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80467e:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804685:	74 0a                	je     804691 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804687:	8b 45 08             	mov    0x8(%ebp),%eax
+  80468a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  80468f:	c9                   	leave
+  804690:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804691:	83 ec 04             	sub    $0x4,%esp
+  804694:	6a 07                	push   $0x7
+  804696:	68 00 f0 bf ee       	push   $0xeebff000
+  80469b:	6a 00                	push   $0x0
+  80469d:	e8 b9 c7 ff ff       	call   800e5b <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8046a2:	83 c4 08             	add    $0x8,%esp
+  8046a5:	68 b6 46 80 00       	push   $0x8046b6
+  8046aa:	6a 00                	push   $0x0
+  8046ac:	e8 27 c9 ff ff       	call   800fd8 <sys_env_set_pgfault_upcall>
+  8046b1:	83 c4 10             	add    $0x10,%esp
+  8046b4:	eb d1                	jmp    804687 <set_pgfault_handler+0xf>
+
+008046b6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8046b6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8046b7:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8046bc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8046be:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8046c1:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8046c5:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8046c9:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8046cc:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8046d0:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8046d2:	83 c4 08             	add    $0x8,%esp
+	popal
+  8046d5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8046d6:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8046d9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8046da:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8046db:	c3                   	ret
+
+008046dc <udm>:
+  8046dc:	57                   	push   %edi
+  8046dd:	56                   	push   %esi
+  8046de:	53                   	push   %ebx
+  8046df:	83 ec 20             	sub    $0x20,%esp
+  8046e2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8046e6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8046ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8046ee:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8046f2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046f6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046fa:	89 d1                	mov    %edx,%ecx
+  8046fc:	09 c1                	or     %eax,%ecx
+  8046fe:	0f 84 91 00 00 00    	je     804795 <udm+0xb9>
+  804704:	b8 00 00 00 00       	mov    $0x0,%eax
+  804709:	ba 00 00 00 00       	mov    $0x0,%edx
+  80470e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804713:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80471a:	00 
+  80471b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804722:	00 
+  804723:	eb 08                	jmp    80472d <udm+0x51>
+  804725:	83 e9 01             	sub    $0x1,%ecx
+  804728:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80472b:	74 7c                	je     8047a9 <udm+0xcd>
+  80472d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804731:	01 c0                	add    %eax,%eax
+  804733:	89 c6                	mov    %eax,%esi
+  804735:	89 d7                	mov    %edx,%edi
+  804737:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80473b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80473f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804742:	d3 ea                	shr    %cl,%edx
+  804744:	f6 c1 20             	test   $0x20,%cl
+  804747:	74 04                	je     80474d <udm+0x71>
+  804749:	89 d0                	mov    %edx,%eax
+  80474b:	31 d2                	xor    %edx,%edx
+  80474d:	83 e0 01             	and    $0x1,%eax
+  804750:	89 04 24             	mov    %eax,(%esp)
+  804753:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80475a:	00 
+  80475b:	8b 04 24             	mov    (%esp),%eax
+  80475e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804762:	09 f0                	or     %esi,%eax
+  804764:	09 fa                	or     %edi,%edx
+  804766:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80476a:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80476e:	39 f0                	cmp    %esi,%eax
+  804770:	89 d3                	mov    %edx,%ebx
+  804772:	19 fb                	sbb    %edi,%ebx
+  804774:	72 af                	jb     804725 <udm+0x49>
+  804776:	29 f0                	sub    %esi,%eax
+  804778:	19 fa                	sbb    %edi,%edx
+  80477a:	89 cf                	mov    %ecx,%edi
+  80477c:	c1 ef 05             	shr    $0x5,%edi
+  80477f:	83 e7 01             	and    $0x1,%edi
+  804782:	89 fe                	mov    %edi,%esi
+  804784:	83 f6 01             	xor    $0x1,%esi
+  804787:	d3 e6                	shl    %cl,%esi
+  804789:	d3 e7                	shl    %cl,%edi
+  80478b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80478f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804793:	eb 90                	jmp    804725 <udm+0x49>
+  804795:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804799:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80479d:	89 f0                	mov    %esi,%eax
+  80479f:	89 fa                	mov    %edi,%edx
+  8047a1:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8047a5:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8047a9:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8047ad:	89 01                	mov    %eax,(%ecx)
+  8047af:	89 51 04             	mov    %edx,0x4(%ecx)
+  8047b2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8047b6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8047ba:	83 c4 20             	add    $0x20,%esp
+  8047bd:	5b                   	pop    %ebx
+  8047be:	5e                   	pop    %esi
+  8047bf:	5f                   	pop    %edi
+  8047c0:	c3                   	ret
+
+008047c1 <__udivdi3>:
+  8047c1:	83 ec 18             	sub    $0x18,%esp
+  8047c4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8047c8:	50                   	push   %eax
+  8047c9:	ff 74 24 2c          	push   0x2c(%esp)
+  8047cd:	ff 74 24 2c          	push   0x2c(%esp)
+  8047d1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047d5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047d9:	e8 fe fe ff ff       	call   8046dc <udm>
+  8047de:	83 c4 24             	add    $0x24,%esp
+  8047e1:	c3                   	ret
+
+008047e2 <__umoddi3>:
+  8047e2:	83 ec 18             	sub    $0x18,%esp
+  8047e5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8047e9:	50                   	push   %eax
+  8047ea:	ff 74 24 2c          	push   0x2c(%esp)
+  8047ee:	ff 74 24 2c          	push   0x2c(%esp)
+  8047f2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047f6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047fa:	e8 dd fe ff ff       	call   8046dc <udm>
+  8047ff:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804803:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804807:	83 c4 24             	add    $0x24,%esp
+  80480a:	c3                   	ret
+
+0080480b <__divdi3>:
+  80480b:	56                   	push   %esi
+  80480c:	53                   	push   %ebx
+  80480d:	83 ec 14             	sub    $0x14,%esp
+  804810:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804814:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804818:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80481c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804820:	85 d2                	test   %edx,%edx
+  804822:	78 18                	js     80483c <__divdi3+0x31>
+  804824:	85 db                	test   %ebx,%ebx
+  804826:	78 3e                	js     804866 <__divdi3+0x5b>
+  804828:	83 ec 04             	sub    $0x4,%esp
+  80482b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80482f:	56                   	push   %esi
+  804830:	53                   	push   %ebx
+  804831:	51                   	push   %ecx
+  804832:	e8 a5 fe ff ff       	call   8046dc <udm>
+  804837:	83 c4 10             	add    $0x10,%esp
+  80483a:	eb 24                	jmp    804860 <__divdi3+0x55>
+  80483c:	f7 d8                	neg    %eax
+  80483e:	83 d2 00             	adc    $0x0,%edx
+  804841:	f7 da                	neg    %edx
+  804843:	85 db                	test   %ebx,%ebx
+  804845:	78 3a                	js     804881 <__divdi3+0x76>
+  804847:	83 ec 04             	sub    $0x4,%esp
+  80484a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80484e:	56                   	push   %esi
+  80484f:	53                   	push   %ebx
+  804850:	51                   	push   %ecx
+  804851:	e8 86 fe ff ff       	call   8046dc <udm>
+  804856:	83 c4 10             	add    $0x10,%esp
+  804859:	f7 d8                	neg    %eax
+  80485b:	83 d2 00             	adc    $0x0,%edx
+  80485e:	f7 da                	neg    %edx
+  804860:	83 c4 14             	add    $0x14,%esp
+  804863:	5b                   	pop    %ebx
+  804864:	5e                   	pop    %esi
+  804865:	c3                   	ret
+  804866:	83 ec 04             	sub    $0x4,%esp
+  804869:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80486d:	56                   	push   %esi
+  80486e:	f7 d9                	neg    %ecx
+  804870:	83 d3 00             	adc    $0x0,%ebx
+  804873:	f7 db                	neg    %ebx
+  804875:	53                   	push   %ebx
+  804876:	51                   	push   %ecx
+  804877:	e8 60 fe ff ff       	call   8046dc <udm>
+  80487c:	83 c4 10             	add    $0x10,%esp
+  80487f:	eb d8                	jmp    804859 <__divdi3+0x4e>
+  804881:	83 ec 04             	sub    $0x4,%esp
+  804884:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804888:	56                   	push   %esi
+  804889:	f7 d9                	neg    %ecx
+  80488b:	83 d3 00             	adc    $0x0,%ebx
+  80488e:	f7 db                	neg    %ebx
+  804890:	53                   	push   %ebx
+  804891:	51                   	push   %ecx
+  804892:	e8 45 fe ff ff       	call   8046dc <udm>
+  804897:	83 c4 10             	add    $0x10,%esp
+  80489a:	eb c4                	jmp    804860 <__divdi3+0x55>
+
+0080489c <__moddi3>:
+  80489c:	55                   	push   %ebp
+  80489d:	57                   	push   %edi
+  80489e:	56                   	push   %esi
+  80489f:	53                   	push   %ebx
+  8048a0:	83 ec 24             	sub    $0x24,%esp
+  8048a3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8048a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8048ab:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8048af:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8048b3:	85 d2                	test   %edx,%edx
+  8048b5:	78 3b                	js     8048f2 <__moddi3+0x56>
+  8048b7:	83 ec 04             	sub    $0x4,%esp
+  8048ba:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8048be:	56                   	push   %esi
+  8048bf:	89 ce                	mov    %ecx,%esi
+  8048c1:	f7 de                	neg    %esi
+  8048c3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8048c7:	89 de                	mov    %ebx,%esi
+  8048c9:	83 d6 00             	adc    $0x0,%esi
+  8048cc:	f7 de                	neg    %esi
+  8048ce:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8048d2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8048d6:	0f 48 f1             	cmovs  %ecx,%esi
+  8048d9:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8048de:	53                   	push   %ebx
+  8048df:	56                   	push   %esi
+  8048e0:	e8 f7 fd ff ff       	call   8046dc <udm>
+  8048e5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048e9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048ed:	83 c4 10             	add    $0x10,%esp
+  8048f0:	eb 47                	jmp    804939 <__moddi3+0x9d>
+  8048f2:	f7 d8                	neg    %eax
+  8048f4:	83 d2 00             	adc    $0x0,%edx
+  8048f7:	f7 da                	neg    %edx
+  8048f9:	83 ec 04             	sub    $0x4,%esp
+  8048fc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804900:	56                   	push   %esi
+  804901:	89 cf                	mov    %ecx,%edi
+  804903:	f7 df                	neg    %edi
+  804905:	89 de                	mov    %ebx,%esi
+  804907:	83 d6 00             	adc    $0x0,%esi
+  80490a:	f7 de                	neg    %esi
+  80490c:	0f 49 cf             	cmovns %edi,%ecx
+  80490f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804913:	0f 49 de             	cmovns %esi,%ebx
+  804916:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80491a:	ff 74 24 0c          	push   0xc(%esp)
+  80491e:	ff 74 24 0c          	push   0xc(%esp)
+  804922:	e8 b5 fd ff ff       	call   8046dc <udm>
+  804927:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80492b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80492f:	f7 d8                	neg    %eax
+  804931:	83 d2 00             	adc    $0x0,%edx
+  804934:	f7 da                	neg    %edx
+  804936:	83 c4 10             	add    $0x10,%esp
+  804939:	83 c4 24             	add    $0x24,%esp
+  80493c:	5b                   	pop    %ebx
+  80493d:	5e                   	pop    %esi
+  80493e:	5f                   	pop    %edi
+  80493f:	5d                   	pop    %ebp
+  804940:	c3                   	ret
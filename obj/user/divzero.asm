@@ -0,0 +1,9690 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 c0 62 80 00 00 	movl   $0x0,0x8062c0
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 e0 46 80 00       	push   $0x8046e0
+  80004a:	e8 3d 01 00 00       	call   80018c <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	57                   	push   %edi
+  800058:	56                   	push   %esi
+  800059:	53                   	push   %ebx
+  80005a:	83 ec 1c             	sub    $0x1c,%esp
+  80005d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800060:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800063:	e8 ee 0a 00 00       	call   800b56 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800068:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80006b:	89 15 c4 62 80 00    	mov    %edx,0x8062c4
+	thisenv = &envs[ENVX(eid)];
+  800071:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800076:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800078:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80007a:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800080:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800085:	77 16                	ja     80009d <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800087:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80008c:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80008e:	c1 e8 10             	shr    $0x10,%eax
+  800091:	74 0a                	je     80009d <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800093:	c1 e0 10             	shl    $0x10,%eax
+  800096:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80009b:	29 c2                	sub    %eax,%edx
+  80009d:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000a0:	c1 e0 04             	shl    $0x4,%eax
+  8000a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a8:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000aa:	85 db                	test   %ebx,%ebx
+  8000ac:	7e 07                	jle    8000b5 <libmain+0x61>
+		binaryname = argv[0];
+  8000ae:	8b 06                	mov    (%esi),%eax
+  8000b0:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b5:	83 ec 08             	sub    $0x8,%esp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	e8 74 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000bf:	e8 0b 00 00 00       	call   8000cf <exit>
+}
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  8000c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ca:	5b                   	pop    %ebx
+  8000cb:	5e                   	pop    %esi
+  8000cc:	5f                   	pop    %edi
+  8000cd:	5d                   	pop    %ebp
+  8000ce:	c3                   	ret
+
+008000cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000cf:	55                   	push   %ebp
+  8000d0:	89 e5                	mov    %esp,%ebp
+  8000d2:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000d5:	6a 00                	push   $0x0
+  8000d7:	e8 cf 20 00 00       	call   8021ab <fflush>
+	pthread_kill_others();
+  8000dc:	e8 3a 37 00 00       	call   80381b <pthread_kill_others>
+	close_all();
+  8000e1:	e8 68 11 00 00       	call   80124e <close_all>
+	sys_env_destroy(0);
+  8000e6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000ed:	e8 19 0a 00 00       	call   800b0b <sys_env_destroy>
+}
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	c9                   	leave
+  8000f6:	c3                   	ret
+
+008000f7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	53                   	push   %ebx
+  8000fb:	83 ec 04             	sub    $0x4,%esp
+  8000fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800101:	8b 13                	mov    (%ebx),%edx
+  800103:	8d 42 01             	lea    0x1(%edx),%eax
+  800106:	89 03                	mov    %eax,(%ebx)
+  800108:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80010b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80010f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800114:	74 09                	je     80011f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800116:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80011a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80011d:	c9                   	leave
+  80011e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80011f:	83 ec 08             	sub    $0x8,%esp
+  800122:	68 ff 00 00 00       	push   $0xff
+  800127:	8d 43 08             	lea    0x8(%ebx),%eax
+  80012a:	50                   	push   %eax
+  80012b:	e8 84 09 00 00       	call   800ab4 <sys_cputs>
+		b->idx = 0;
+  800130:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800136:	83 c4 10             	add    $0x10,%esp
+  800139:	eb db                	jmp    800116 <putch+0x1f>
+
+0080013b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80013b:	55                   	push   %ebp
+  80013c:	89 e5                	mov    %esp,%ebp
+  80013e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800144:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80014b:	00 00 00 
+	b.cnt = 0;
+  80014e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800155:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800158:	ff 75 0c             	push   0xc(%ebp)
+  80015b:	ff 75 08             	push   0x8(%ebp)
+  80015e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800164:	50                   	push   %eax
+  800165:	68 f7 00 80 00       	push   $0x8000f7
+  80016a:	e8 14 01 00 00       	call   800283 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80016f:	83 c4 08             	add    $0x8,%esp
+  800172:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800178:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80017e:	50                   	push   %eax
+  80017f:	e8 30 09 00 00       	call   800ab4 <sys_cputs>
+
+	return b.cnt;
+}
+  800184:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800192:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800195:	50                   	push   %eax
+  800196:	ff 75 08             	push   0x8(%ebp)
+  800199:	e8 9d ff ff ff       	call   80013b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+
+008001a0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	57                   	push   %edi
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 1c             	sub    $0x1c,%esp
+  8001a9:	89 c7                	mov    %eax,%edi
+  8001ab:	89 d6                	mov    %edx,%esi
+  8001ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b3:	89 d1                	mov    %edx,%ecx
+  8001b5:	89 c2                	mov    %eax,%edx
+  8001b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001cd:	39 c2                	cmp    %eax,%edx
+  8001cf:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d2:	72 3e                	jb     800212 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	ff 75 18             	push   0x18(%ebp)
+  8001da:	83 eb 01             	sub    $0x1,%ebx
+  8001dd:	53                   	push   %ebx
+  8001de:	50                   	push   %eax
+  8001df:	83 ec 08             	sub    $0x8,%esp
+  8001e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e5:	ff 75 e0             	push   -0x20(%ebp)
+  8001e8:	ff 75 dc             	push   -0x24(%ebp)
+  8001eb:	ff 75 d8             	push   -0x28(%ebp)
+  8001ee:	e8 67 43 00 00       	call   80455a <__udivdi3>
+  8001f3:	83 c4 18             	add    $0x18,%esp
+  8001f6:	52                   	push   %edx
+  8001f7:	50                   	push   %eax
+  8001f8:	89 f2                	mov    %esi,%edx
+  8001fa:	89 f8                	mov    %edi,%eax
+  8001fc:	e8 9f ff ff ff       	call   8001a0 <printnum>
+  800201:	83 c4 20             	add    $0x20,%esp
+  800204:	eb 13                	jmp    800219 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800206:	83 ec 08             	sub    $0x8,%esp
+  800209:	56                   	push   %esi
+  80020a:	ff 75 18             	push   0x18(%ebp)
+  80020d:	ff d7                	call   *%edi
+  80020f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800212:	83 eb 01             	sub    $0x1,%ebx
+  800215:	85 db                	test   %ebx,%ebx
+  800217:	7f ed                	jg     800206 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800219:	83 ec 08             	sub    $0x8,%esp
+  80021c:	56                   	push   %esi
+  80021d:	83 ec 04             	sub    $0x4,%esp
+  800220:	ff 75 e4             	push   -0x1c(%ebp)
+  800223:	ff 75 e0             	push   -0x20(%ebp)
+  800226:	ff 75 dc             	push   -0x24(%ebp)
+  800229:	ff 75 d8             	push   -0x28(%ebp)
+  80022c:	e8 4a 43 00 00       	call   80457b <__umoddi3>
+  800231:	83 c4 14             	add    $0x14,%esp
+  800234:	0f be 80 f8 46 80 00 	movsbl 0x8046f8(%eax),%eax
+  80023b:	50                   	push   %eax
+  80023c:	ff d7                	call   *%edi
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800244:	5b                   	pop    %ebx
+  800245:	5e                   	pop    %esi
+  800246:	5f                   	pop    %edi
+  800247:	5d                   	pop    %ebp
+  800248:	c3                   	ret
+
+00800249 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800249:	55                   	push   %ebp
+  80024a:	89 e5                	mov    %esp,%ebp
+  80024c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80024f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800253:	8b 10                	mov    (%eax),%edx
+  800255:	3b 50 04             	cmp    0x4(%eax),%edx
+  800258:	73 0a                	jae    800264 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80025a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80025d:	89 08                	mov    %ecx,(%eax)
+  80025f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800262:	88 02                	mov    %al,(%edx)
+}
+  800264:	5d                   	pop    %ebp
+  800265:	c3                   	ret
+
+00800266 <printfmt>:
+{
+  800266:	55                   	push   %ebp
+  800267:	89 e5                	mov    %esp,%ebp
+  800269:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80026c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80026f:	50                   	push   %eax
+  800270:	ff 75 10             	push   0x10(%ebp)
+  800273:	ff 75 0c             	push   0xc(%ebp)
+  800276:	ff 75 08             	push   0x8(%ebp)
+  800279:	e8 05 00 00 00       	call   800283 <vprintfmt>
+}
+  80027e:	83 c4 10             	add    $0x10,%esp
+  800281:	c9                   	leave
+  800282:	c3                   	ret
+
+00800283 <vprintfmt>:
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	57                   	push   %edi
+  800287:	56                   	push   %esi
+  800288:	53                   	push   %ebx
+  800289:	83 ec 2c             	sub    $0x2c,%esp
+  80028c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80028f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800292:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800295:	eb 0a                	jmp    8002a1 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800297:	83 ec 08             	sub    $0x8,%esp
+  80029a:	53                   	push   %ebx
+  80029b:	50                   	push   %eax
+  80029c:	ff d6                	call   *%esi
+  80029e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8002a1:	83 c7 01             	add    $0x1,%edi
+  8002a4:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8002a8:	83 f8 25             	cmp    $0x25,%eax
+  8002ab:	74 0c                	je     8002b9 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ad:	85 c0                	test   %eax,%eax
+  8002af:	75 e6                	jne    800297 <vprintfmt+0x14>
+}
+  8002b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b4:	5b                   	pop    %ebx
+  8002b5:	5e                   	pop    %esi
+  8002b6:	5f                   	pop    %edi
+  8002b7:	5d                   	pop    %ebp
+  8002b8:	c3                   	ret
+		padc = ' ';
+  8002b9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002bd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002c4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002cb:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8002d7:	8d 47 01             	lea    0x1(%edi),%eax
+  8002da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002dd:	0f b6 17             	movzbl (%edi),%edx
+  8002e0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e3:	3c 55                	cmp    $0x55,%al
+  8002e5:	0f 87 c5 03 00 00    	ja     8006b0 <vprintfmt+0x42d>
+  8002eb:	0f b6 c0             	movzbl %al,%eax
+  8002ee:	ff 24 85 80 48 80 00 	jmp    *0x804880(,%eax,4)
+  8002f5:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8002f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002fb:	eb da                	jmp    8002d7 <vprintfmt+0x54>
+  8002fd:	0f be d2             	movsbl %dl,%edx
+  800300:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80030b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80030e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800312:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800315:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800318:	83 f9 09             	cmp    $0x9,%ecx
+  80031b:	77 55                	ja     800372 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80031d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800320:	eb e9                	jmp    80030b <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800322:	8b 45 14             	mov    0x14(%ebp),%eax
+  800325:	8b 00                	mov    (%eax),%eax
+  800327:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80032a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032d:	8d 40 04             	lea    0x4(%eax),%eax
+  800330:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800333:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800336:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80033a:	79 9b                	jns    8002d7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80033c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800349:	eb 8c                	jmp    8002d7 <vprintfmt+0x54>
+			if (width < 0)
+  80034b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80034e:	85 d2                	test   %edx,%edx
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	0f 49 c2             	cmovns %edx,%eax
+  800358:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80035e:	e9 74 ff ff ff       	jmp    8002d7 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800366:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80036d:	e9 65 ff ff ff       	jmp    8002d7 <vprintfmt+0x54>
+  800372:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800375:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800378:	eb bc                	jmp    800336 <vprintfmt+0xb3>
+			lflag++;
+  80037a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80037d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800380:	e9 52 ff ff ff       	jmp    8002d7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800385:	8b 45 14             	mov    0x14(%ebp),%eax
+  800388:	8d 78 04             	lea    0x4(%eax),%edi
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	53                   	push   %ebx
+  80038f:	ff 30                	push   (%eax)
+  800391:	ff d6                	call   *%esi
+			break;
+  800393:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800396:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800399:	e9 b1 02 00 00       	jmp    80064f <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80039e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003a4:	8b 10                	mov    (%eax),%edx
+  8003a6:	89 d0                	mov    %edx,%eax
+  8003a8:	f7 d8                	neg    %eax
+  8003aa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ad:	83 f8 14             	cmp    $0x14,%eax
+  8003b0:	7f 23                	jg     8003d5 <vprintfmt+0x152>
+  8003b2:	8b 14 85 e0 49 80 00 	mov    0x8049e0(,%eax,4),%edx
+  8003b9:	85 d2                	test   %edx,%edx
+  8003bb:	74 18                	je     8003d5 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8003bd:	52                   	push   %edx
+  8003be:	68 4f 4b 80 00       	push   $0x804b4f
+  8003c3:	53                   	push   %ebx
+  8003c4:	56                   	push   %esi
+  8003c5:	e8 9c fe ff ff       	call   800266 <printfmt>
+  8003ca:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003d0:	e9 7a 02 00 00       	jmp    80064f <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8003d5:	50                   	push   %eax
+  8003d6:	68 10 47 80 00       	push   $0x804710
+  8003db:	53                   	push   %ebx
+  8003dc:	56                   	push   %esi
+  8003dd:	e8 84 fe ff ff       	call   800266 <printfmt>
+  8003e2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003e8:	e9 62 02 00 00       	jmp    80064f <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f0:	83 c0 04             	add    $0x4,%eax
+  8003f3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003fb:	85 c9                	test   %ecx,%ecx
+  8003fd:	b8 09 47 80 00       	mov    $0x804709,%eax
+  800402:	0f 45 c1             	cmovne %ecx,%eax
+  800405:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800408:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80040c:	7e 06                	jle    800414 <vprintfmt+0x191>
+  80040e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800412:	75 0b                	jne    80041f <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800414:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800417:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80041a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80041d:	eb 5c                	jmp    80047b <vprintfmt+0x1f8>
+  80041f:	83 ec 08             	sub    $0x8,%esp
+  800422:	ff 75 d0             	push   -0x30(%ebp)
+  800425:	ff 75 cc             	push   -0x34(%ebp)
+  800428:	e8 20 03 00 00       	call   80074d <strnlen>
+  80042d:	89 c2                	mov    %eax,%edx
+  80042f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800432:	29 d0                	sub    %edx,%eax
+  800434:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800437:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80043b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800441:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800443:	eb 0e                	jmp    800453 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	53                   	push   %ebx
+  800449:	57                   	push   %edi
+  80044a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044d:	83 ee 01             	sub    $0x1,%esi
+  800450:	83 c4 10             	add    $0x10,%esp
+  800453:	85 f6                	test   %esi,%esi
+  800455:	7f ee                	jg     800445 <vprintfmt+0x1c2>
+  800457:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80045d:	85 c0                	test   %eax,%eax
+  80045f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800464:	0f 49 d0             	cmovns %eax,%edx
+  800467:	29 d0                	sub    %edx,%eax
+  800469:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80046c:	eb a6                	jmp    800414 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80046e:	83 ec 08             	sub    $0x8,%esp
+  800471:	53                   	push   %ebx
+  800472:	52                   	push   %edx
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800479:	89 f1                	mov    %esi,%ecx
+  80047b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80047e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800482:	0f be d0             	movsbl %al,%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	74 28                	je     8004b1 <vprintfmt+0x22e>
+  800489:	85 ff                	test   %edi,%edi
+  80048b:	78 05                	js     800492 <vprintfmt+0x20f>
+  80048d:	83 ef 01             	sub    $0x1,%edi
+  800490:	78 30                	js     8004c2 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800492:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800496:	74 d6                	je     80046e <vprintfmt+0x1eb>
+  800498:	0f be c0             	movsbl %al,%eax
+  80049b:	83 e8 20             	sub    $0x20,%eax
+  80049e:	83 f8 5e             	cmp    $0x5e,%eax
+  8004a1:	76 cb                	jbe    80046e <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	53                   	push   %ebx
+  8004a7:	6a 3f                	push   $0x3f
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	eb c8                	jmp    800479 <vprintfmt+0x1f6>
+  8004b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ba:	01 d0                	add    %edx,%eax
+  8004bc:	29 c8                	sub    %ecx,%eax
+  8004be:	89 c7                	mov    %eax,%edi
+  8004c0:	eb 13                	jmp    8004d5 <vprintfmt+0x252>
+  8004c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c5:	eb ed                	jmp    8004b4 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	6a 20                	push   $0x20
+  8004cd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004cf:	83 ef 01             	sub    $0x1,%edi
+  8004d2:	83 c4 10             	add    $0x10,%esp
+  8004d5:	85 ff                	test   %edi,%edi
+  8004d7:	7f ee                	jg     8004c7 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004df:	e9 6b 01 00 00       	jmp    80064f <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8004e4:	83 f9 01             	cmp    $0x1,%ecx
+  8004e7:	7f 1f                	jg     800508 <vprintfmt+0x285>
+	else if (lflag)
+  8004e9:	85 c9                	test   %ecx,%ecx
+  8004eb:	74 67                	je     800554 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8b 00                	mov    (%eax),%eax
+  8004f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f5:	89 c1                	mov    %eax,%ecx
+  8004f7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8d 40 04             	lea    0x4(%eax),%eax
+  800503:	89 45 14             	mov    %eax,0x14(%ebp)
+  800506:	eb 17                	jmp    80051f <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050b:	8b 50 04             	mov    0x4(%eax),%edx
+  80050e:	8b 00                	mov    (%eax),%eax
+  800510:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800513:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8d 40 08             	lea    0x8(%eax),%eax
+  80051c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80051f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800522:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800525:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80052a:	85 c9                	test   %ecx,%ecx
+  80052c:	0f 89 03 01 00 00    	jns    800635 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	53                   	push   %ebx
+  800536:	6a 2d                	push   $0x2d
+  800538:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80053a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80053d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800540:	f7 da                	neg    %edx
+  800542:	83 d1 00             	adc    $0x0,%ecx
+  800545:	f7 d9                	neg    %ecx
+  800547:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80054a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80054f:	e9 e1 00 00 00       	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8b 00                	mov    (%eax),%eax
+  800559:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80055c:	89 c1                	mov    %eax,%ecx
+  80055e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800561:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8d 40 04             	lea    0x4(%eax),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056d:	eb b0                	jmp    80051f <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80056f:	83 f9 01             	cmp    $0x1,%ecx
+  800572:	7f 1e                	jg     800592 <vprintfmt+0x30f>
+	else if (lflag)
+  800574:	85 c9                	test   %ecx,%ecx
+  800576:	74 32                	je     8005aa <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 10                	mov    (%eax),%edx
+  80057d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800582:	8d 40 04             	lea    0x4(%eax),%eax
+  800585:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800588:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80058d:	e9 a3 00 00 00       	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	8b 48 04             	mov    0x4(%eax),%ecx
+  80059a:	8d 40 08             	lea    0x8(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005a5:	e9 8b 00 00 00       	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 10                	mov    (%eax),%edx
+  8005af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005bf:	eb 74                	jmp    800635 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8005c1:	83 f9 01             	cmp    $0x1,%ecx
+  8005c4:	7f 1b                	jg     8005e1 <vprintfmt+0x35e>
+	else if (lflag)
+  8005c6:	85 c9                	test   %ecx,%ecx
+  8005c8:	74 2c                	je     8005f6 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005df:	eb 54                	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005e9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ef:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005f4:	eb 3f                	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f9:	8b 10                	mov    (%eax),%edx
+  8005fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800600:	8d 40 04             	lea    0x4(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800606:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80060b:	eb 28                	jmp    800635 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80060d:	83 ec 08             	sub    $0x8,%esp
+  800610:	53                   	push   %ebx
+  800611:	6a 30                	push   $0x30
+  800613:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800615:	83 c4 08             	add    $0x8,%esp
+  800618:	53                   	push   %ebx
+  800619:	6a 78                	push   $0x78
+  80061b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800627:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800630:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80063c:	50                   	push   %eax
+  80063d:	ff 75 e0             	push   -0x20(%ebp)
+  800640:	57                   	push   %edi
+  800641:	51                   	push   %ecx
+  800642:	52                   	push   %edx
+  800643:	89 da                	mov    %ebx,%edx
+  800645:	89 f0                	mov    %esi,%eax
+  800647:	e8 54 fb ff ff       	call   8001a0 <printnum>
+			break;
+  80064c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80064f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800652:	e9 4a fc ff ff       	jmp    8002a1 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800657:	83 f9 01             	cmp    $0x1,%ecx
+  80065a:	7f 1b                	jg     800677 <vprintfmt+0x3f4>
+	else if (lflag)
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	74 2c                	je     80068c <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800675:	eb be                	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067f:	8d 40 08             	lea    0x8(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800685:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80068a:	eb a9                	jmp    800635 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a1:	eb 92                	jmp    800635 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8006a3:	83 ec 08             	sub    $0x8,%esp
+  8006a6:	53                   	push   %ebx
+  8006a7:	6a 25                	push   $0x25
+  8006a9:	ff d6                	call   *%esi
+			break;
+  8006ab:	83 c4 10             	add    $0x10,%esp
+  8006ae:	eb 9f                	jmp    80064f <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8006b0:	83 ec 08             	sub    $0x8,%esp
+  8006b3:	53                   	push   %ebx
+  8006b4:	6a 25                	push   $0x25
+  8006b6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006b8:	83 c4 10             	add    $0x10,%esp
+  8006bb:	89 f8                	mov    %edi,%eax
+  8006bd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c1:	74 05                	je     8006c8 <vprintfmt+0x445>
+  8006c3:	83 e8 01             	sub    $0x1,%eax
+  8006c6:	eb f5                	jmp    8006bd <vprintfmt+0x43a>
+  8006c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006cb:	eb 82                	jmp    80064f <vprintfmt+0x3cc>
+
+008006cd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	83 ec 18             	sub    $0x18,%esp
+  8006d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006dc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ea:	85 c0                	test   %eax,%eax
+  8006ec:	74 26                	je     800714 <vsnprintf+0x47>
+  8006ee:	85 d2                	test   %edx,%edx
+  8006f0:	7e 22                	jle    800714 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006f2:	ff 75 14             	push   0x14(%ebp)
+  8006f5:	ff 75 10             	push   0x10(%ebp)
+  8006f8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006fb:	50                   	push   %eax
+  8006fc:	68 49 02 80 00       	push   $0x800249
+  800701:	e8 7d fb ff ff       	call   800283 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800706:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800709:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80070c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80070f:	83 c4 10             	add    $0x10,%esp
+}
+  800712:	c9                   	leave
+  800713:	c3                   	ret
+		return -E_INVAL;
+  800714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800719:	eb f7                	jmp    800712 <vsnprintf+0x45>
+
+0080071b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80071b:	55                   	push   %ebp
+  80071c:	89 e5                	mov    %esp,%ebp
+  80071e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800721:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800724:	50                   	push   %eax
+  800725:	ff 75 10             	push   0x10(%ebp)
+  800728:	ff 75 0c             	push   0xc(%ebp)
+  80072b:	ff 75 08             	push   0x8(%ebp)
+  80072e:	e8 9a ff ff ff       	call   8006cd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800733:	c9                   	leave
+  800734:	c3                   	ret
+
+00800735 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800735:	55                   	push   %ebp
+  800736:	89 e5                	mov    %esp,%ebp
+  800738:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	eb 03                	jmp    800745 <strlen+0x10>
+		n++;
+  800742:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800745:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800749:	75 f7                	jne    800742 <strlen+0xd>
+	return n;
+}
+  80074b:	5d                   	pop    %ebp
+  80074c:	c3                   	ret
+
+0080074d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+  800750:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800753:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075b:	eb 03                	jmp    800760 <strnlen+0x13>
+		n++;
+  80075d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800760:	39 d0                	cmp    %edx,%eax
+  800762:	74 08                	je     80076c <strnlen+0x1f>
+  800764:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800768:	75 f3                	jne    80075d <strnlen+0x10>
+  80076a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80076c:	89 d0                	mov    %edx,%eax
+  80076e:	5d                   	pop    %ebp
+  80076f:	c3                   	ret
+
+00800770 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	53                   	push   %ebx
+  800774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800777:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800783:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800786:	83 c0 01             	add    $0x1,%eax
+  800789:	84 d2                	test   %dl,%dl
+  80078b:	75 f2                	jne    80077f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80078d:	89 c8                	mov    %ecx,%eax
+  80078f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+
+00800794 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	53                   	push   %ebx
+  800798:	83 ec 10             	sub    $0x10,%esp
+  80079b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80079e:	53                   	push   %ebx
+  80079f:	e8 91 ff ff ff       	call   800735 <strlen>
+  8007a4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007a7:	ff 75 0c             	push   0xc(%ebp)
+  8007aa:	01 d8                	add    %ebx,%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	e8 be ff ff ff       	call   800770 <strcpy>
+	return dst;
+}
+  8007b2:	89 d8                	mov    %ebx,%eax
+  8007b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b7:	c9                   	leave
+  8007b8:	c3                   	ret
+
+008007b9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	56                   	push   %esi
+  8007bd:	53                   	push   %ebx
+  8007be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007c4:	89 f3                	mov    %esi,%ebx
+  8007c6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007c9:	89 f0                	mov    %esi,%eax
+  8007cb:	eb 0f                	jmp    8007dc <strncpy+0x23>
+		*dst++ = *src;
+  8007cd:	83 c0 01             	add    $0x1,%eax
+  8007d0:	0f b6 0a             	movzbl (%edx),%ecx
+  8007d3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007d6:	80 f9 01             	cmp    $0x1,%cl
+  8007d9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007dc:	39 d8                	cmp    %ebx,%eax
+  8007de:	75 ed                	jne    8007cd <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	5b                   	pop    %ebx
+  8007e3:	5e                   	pop    %esi
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+
+008007e6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	56                   	push   %esi
+  8007ea:	53                   	push   %ebx
+  8007eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007f4:	89 f0                	mov    %esi,%eax
+  8007f6:	85 d2                	test   %edx,%edx
+  8007f8:	74 21                	je     80081b <strlcpy+0x35>
+  8007fa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007fe:	89 f2                	mov    %esi,%edx
+  800800:	eb 09                	jmp    80080b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800802:	83 c1 01             	add    $0x1,%ecx
+  800805:	83 c2 01             	add    $0x1,%edx
+  800808:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80080b:	39 c2                	cmp    %eax,%edx
+  80080d:	74 09                	je     800818 <strlcpy+0x32>
+  80080f:	0f b6 19             	movzbl (%ecx),%ebx
+  800812:	84 db                	test   %bl,%bl
+  800814:	75 ec                	jne    800802 <strlcpy+0x1c>
+  800816:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800818:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80081b:	29 f0                	sub    %esi,%eax
+}
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800827:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80082a:	eb 06                	jmp    800832 <strcmp+0x11>
+		p++, q++;
+  80082c:	83 c1 01             	add    $0x1,%ecx
+  80082f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800832:	0f b6 01             	movzbl (%ecx),%eax
+  800835:	84 c0                	test   %al,%al
+  800837:	74 04                	je     80083d <strcmp+0x1c>
+  800839:	3a 02                	cmp    (%edx),%al
+  80083b:	74 ef                	je     80082c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083d:	0f b6 c0             	movzbl %al,%eax
+  800840:	0f b6 12             	movzbl (%edx),%edx
+  800843:	29 d0                	sub    %edx,%eax
+}
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+
+00800847 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	53                   	push   %ebx
+  80084b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800851:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800854:	eb 09                	jmp    80085f <strncmp+0x18>
+		n--, p++, q++;
+  800856:	83 ea 01             	sub    $0x1,%edx
+  800859:	83 c0 01             	add    $0x1,%eax
+  80085c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80085f:	85 d2                	test   %edx,%edx
+  800861:	74 18                	je     80087b <strncmp+0x34>
+  800863:	0f b6 18             	movzbl (%eax),%ebx
+  800866:	84 db                	test   %bl,%bl
+  800868:	74 04                	je     80086e <strncmp+0x27>
+  80086a:	3a 19                	cmp    (%ecx),%bl
+  80086c:	74 e8                	je     800856 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80086e:	0f b6 00             	movzbl (%eax),%eax
+  800871:	0f b6 11             	movzbl (%ecx),%edx
+  800874:	29 d0                	sub    %edx,%eax
+}
+  800876:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800879:	c9                   	leave
+  80087a:	c3                   	ret
+		return 0;
+  80087b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800880:	eb f4                	jmp    800876 <strncmp+0x2f>
+
+00800882 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	8b 45 08             	mov    0x8(%ebp),%eax
+  800888:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80088c:	eb 03                	jmp    800891 <strchr+0xf>
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	0f b6 10             	movzbl (%eax),%edx
+  800894:	84 d2                	test   %dl,%dl
+  800896:	74 06                	je     80089e <strchr+0x1c>
+		if (*s == c)
+  800898:	38 ca                	cmp    %cl,%dl
+  80089a:	75 f2                	jne    80088e <strchr+0xc>
+  80089c:	eb 05                	jmp    8008a3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008a3:	5d                   	pop    %ebp
+  8008a4:	c3                   	ret
+
+008008a5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ab:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008af:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008b2:	38 ca                	cmp    %cl,%dl
+  8008b4:	74 09                	je     8008bf <strfind+0x1a>
+  8008b6:	84 d2                	test   %dl,%dl
+  8008b8:	74 05                	je     8008bf <strfind+0x1a>
+	for (; *s; s++)
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	eb f0                	jmp    8008af <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	57                   	push   %edi
+  8008c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008cb:	85 c9                	test   %ecx,%ecx
+  8008cd:	74 20                	je     8008ef <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008cf:	89 f8                	mov    %edi,%eax
+  8008d1:	09 c8                	or     %ecx,%eax
+  8008d3:	a8 03                	test   $0x3,%al
+  8008d5:	75 12                	jne    8008e9 <memset+0x28>
+		c &= 0xFF;
+  8008d7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008db:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008e1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008e4:	fc                   	cld
+  8008e5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008e7:	eb 06                	jmp    8008ef <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ec:	fc                   	cld
+  8008ed:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ef:	89 f8                	mov    %edi,%eax
+  8008f1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+
+008008f6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	57                   	push   %edi
+  8008fa:	56                   	push   %esi
+  8008fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800901:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800904:	39 c6                	cmp    %eax,%esi
+  800906:	73 32                	jae    80093a <memmove+0x44>
+  800908:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80090b:	39 d0                	cmp    %edx,%eax
+  80090d:	73 2b                	jae    80093a <memmove+0x44>
+		s += n;
+		d += n;
+  80090f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800912:	89 d6                	mov    %edx,%esi
+  800914:	09 fe                	or     %edi,%esi
+  800916:	09 ce                	or     %ecx,%esi
+  800918:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80091e:	75 0e                	jne    80092e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800920:	83 ef 04             	sub    $0x4,%edi
+  800923:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800926:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800929:	fd                   	std
+  80092a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092c:	eb 09                	jmp    800937 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80092e:	83 ef 01             	sub    $0x1,%edi
+  800931:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800934:	fd                   	std
+  800935:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800937:	fc                   	cld
+  800938:	eb 1a                	jmp    800954 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093a:	89 f2                	mov    %esi,%edx
+  80093c:	09 c2                	or     %eax,%edx
+  80093e:	09 ca                	or     %ecx,%edx
+  800940:	f6 c2 03             	test   $0x3,%dl
+  800943:	75 0a                	jne    80094f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800945:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800948:	89 c7                	mov    %eax,%edi
+  80094a:	fc                   	cld
+  80094b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094d:	eb 05                	jmp    800954 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80094f:	89 c7                	mov    %eax,%edi
+  800951:	fc                   	cld
+  800952:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800954:	5e                   	pop    %esi
+  800955:	5f                   	pop    %edi
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80095e:	ff 75 10             	push   0x10(%ebp)
+  800961:	ff 75 0c             	push   0xc(%ebp)
+  800964:	ff 75 08             	push   0x8(%ebp)
+  800967:	e8 8a ff ff ff       	call   8008f6 <memmove>
+}
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+0080096e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	56                   	push   %esi
+  800972:	53                   	push   %ebx
+  800973:	8b 45 08             	mov    0x8(%ebp),%eax
+  800976:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800979:	89 c6                	mov    %eax,%esi
+  80097b:	03 75 10             	add    0x10(%ebp),%esi
+  80097e:	eb 06                	jmp    800986 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800980:	83 c0 01             	add    $0x1,%eax
+  800983:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800986:	39 f0                	cmp    %esi,%eax
+  800988:	74 14                	je     80099e <memcmp+0x30>
+		if (*s1 != *s2)
+  80098a:	0f b6 08             	movzbl (%eax),%ecx
+  80098d:	0f b6 1a             	movzbl (%edx),%ebx
+  800990:	38 d9                	cmp    %bl,%cl
+  800992:	74 ec                	je     800980 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800994:	0f b6 c1             	movzbl %cl,%eax
+  800997:	0f b6 db             	movzbl %bl,%ebx
+  80099a:	29 d8                	sub    %ebx,%eax
+  80099c:	eb 05                	jmp    8009a3 <memcmp+0x35>
+	}
+
+	return 0;
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a3:	5b                   	pop    %ebx
+  8009a4:	5e                   	pop    %esi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009b5:	eb 03                	jmp    8009ba <memfind+0x13>
+  8009b7:	83 c0 01             	add    $0x1,%eax
+  8009ba:	39 d0                	cmp    %edx,%eax
+  8009bc:	73 04                	jae    8009c2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009be:	38 08                	cmp    %cl,(%eax)
+  8009c0:	75 f5                	jne    8009b7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+
+008009c4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	57                   	push   %edi
+  8009c8:	56                   	push   %esi
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d0:	eb 03                	jmp    8009d5 <strtol+0x11>
+		s++;
+  8009d2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009d5:	0f b6 02             	movzbl (%edx),%eax
+  8009d8:	3c 20                	cmp    $0x20,%al
+  8009da:	74 f6                	je     8009d2 <strtol+0xe>
+  8009dc:	3c 09                	cmp    $0x9,%al
+  8009de:	74 f2                	je     8009d2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e0:	3c 2b                	cmp    $0x2b,%al
+  8009e2:	74 2a                	je     800a0e <strtol+0x4a>
+	int neg = 0;
+  8009e4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009e9:	3c 2d                	cmp    $0x2d,%al
+  8009eb:	74 2b                	je     800a18 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ed:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009f3:	75 0f                	jne    800a04 <strtol+0x40>
+  8009f5:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009f8:	74 28                	je     800a22 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009fa:	85 db                	test   %ebx,%ebx
+  8009fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a01:	0f 44 d8             	cmove  %eax,%ebx
+  800a04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a09:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a0c:	eb 46                	jmp    800a54 <strtol+0x90>
+		s++;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a16:	eb d5                	jmp    8009ed <strtol+0x29>
+		s++, neg = 1;
+  800a18:	83 c2 01             	add    $0x1,%edx
+  800a1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a20:	eb cb                	jmp    8009ed <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a22:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a26:	74 0e                	je     800a36 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a28:	85 db                	test   %ebx,%ebx
+  800a2a:	75 d8                	jne    800a04 <strtol+0x40>
+		s++, base = 8;
+  800a2c:	83 c2 01             	add    $0x1,%edx
+  800a2f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a34:	eb ce                	jmp    800a04 <strtol+0x40>
+		s += 2, base = 16;
+  800a36:	83 c2 02             	add    $0x2,%edx
+  800a39:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a3e:	eb c4                	jmp    800a04 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a40:	0f be c0             	movsbl %al,%eax
+  800a43:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a46:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a49:	7d 3a                	jge    800a85 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a4b:	83 c2 01             	add    $0x1,%edx
+  800a4e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a52:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a54:	0f b6 02             	movzbl (%edx),%eax
+  800a57:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a5a:	89 f3                	mov    %esi,%ebx
+  800a5c:	80 fb 09             	cmp    $0x9,%bl
+  800a5f:	76 df                	jbe    800a40 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a61:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a64:	89 f3                	mov    %esi,%ebx
+  800a66:	80 fb 19             	cmp    $0x19,%bl
+  800a69:	77 08                	ja     800a73 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a6b:	0f be c0             	movsbl %al,%eax
+  800a6e:	83 e8 57             	sub    $0x57,%eax
+  800a71:	eb d3                	jmp    800a46 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a73:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a76:	89 f3                	mov    %esi,%ebx
+  800a78:	80 fb 19             	cmp    $0x19,%bl
+  800a7b:	77 08                	ja     800a85 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a7d:	0f be c0             	movsbl %al,%eax
+  800a80:	83 e8 37             	sub    $0x37,%eax
+  800a83:	eb c1                	jmp    800a46 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a85:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a89:	74 05                	je     800a90 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a90:	89 c8                	mov    %ecx,%eax
+  800a92:	f7 d8                	neg    %eax
+  800a94:	85 ff                	test   %edi,%edi
+  800a96:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a99:	89 c8                	mov    %ecx,%eax
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800aa6:	6a 00                	push   $0x0
+  800aa8:	6a 00                	push   $0x0
+  800aaa:	ff 75 08             	push   0x8(%ebp)
+  800aad:	e8 12 ff ff ff       	call   8009c4 <strtol>
+}
+  800ab2:	c9                   	leave
+  800ab3:	c3                   	ret
+
+00800ab4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac4:	89 c3                	mov    %eax,%ebx
+  800ac6:	89 c7                	mov    %eax,%edi
+  800ac8:	6a 00                	push   $0x0
+  800aca:	55                   	push   %ebp
+  800acb:	56                   	push   %esi
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	8d 35 d6 0a 80 00    	lea    0x800ad6,%esi
+  800ad4:	0f 34                	sysenter
+
+00800ad6 <after_sysenter_label_47>:
+  800ad6:	5e                   	pop    %esi
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800adb:	5b                   	pop    %ebx
+  800adc:	5f                   	pop    %edi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ae4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aee:	89 d1                	mov    %edx,%ecx
+  800af0:	89 d3                	mov    %edx,%ebx
+  800af2:	89 d7                	mov    %edx,%edi
+  800af4:	6a 00                	push   $0x0
+  800af6:	55                   	push   %ebp
+  800af7:	56                   	push   %esi
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	8d 35 02 0b 80 00    	lea    0x800b02,%esi
+  800b00:	0f 34                	sysenter
+
+00800b02 <after_sysenter_label_128>:
+  800b02:	5e                   	pop    %esi
+  800b03:	5d                   	pop    %ebp
+  800b04:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b07:	5b                   	pop    %ebx
+  800b08:	5f                   	pop    %edi
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	57                   	push   %edi
+  800b0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b18:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b1d:	89 cb                	mov    %ecx,%ebx
+  800b1f:	89 cf                	mov    %ecx,%edi
+  800b21:	6a 00                	push   $0x0
+  800b23:	55                   	push   %ebp
+  800b24:	56                   	push   %esi
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	8d 35 2f 0b 80 00    	lea    0x800b2f,%esi
+  800b2d:	0f 34                	sysenter
+
+00800b2f <after_sysenter_label_212>:
+  800b2f:	5e                   	pop    %esi
+  800b30:	5d                   	pop    %ebp
+  800b31:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b34:	85 c0                	test   %eax,%eax
+  800b36:	7f 07                	jg     800b3f <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5f                   	pop    %edi
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b3f:	83 ec 0c             	sub    $0xc,%esp
+  800b42:	50                   	push   %eax
+  800b43:	6a 03                	push   $0x3
+  800b45:	68 75 4a 80 00       	push   $0x804a75
+  800b4a:	6a 54                	push   $0x54
+  800b4c:	68 92 4a 80 00       	push   $0x804a92
+  800b51:	e8 38 30 00 00       	call   803b8e <_panic>
+
+00800b56 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	57                   	push   %edi
+  800b5a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b60:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b65:	89 d1                	mov    %edx,%ecx
+  800b67:	89 d3                	mov    %edx,%ebx
+  800b69:	89 d7                	mov    %edx,%edi
+  800b6b:	6a 00                	push   $0x0
+  800b6d:	55                   	push   %ebp
+  800b6e:	56                   	push   %esi
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	8d 35 79 0b 80 00    	lea    0x800b79,%esi
+  800b77:	0f 34                	sysenter
+
+00800b79 <after_sysenter_label_309>:
+  800b79:	5e                   	pop    %esi
+  800b7a:	5d                   	pop    %ebp
+  800b7b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b7e:	5b                   	pop    %ebx
+  800b7f:	5f                   	pop    %edi
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+
+00800b82 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b91:	89 d1                	mov    %edx,%ecx
+  800b93:	89 d3                	mov    %edx,%ebx
+  800b95:	89 d7                	mov    %edx,%edi
+  800b97:	6a 00                	push   $0x0
+  800b99:	55                   	push   %ebp
+  800b9a:	56                   	push   %esi
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8d 35 a5 0b 80 00    	lea    0x800ba5,%esi
+  800ba3:	0f 34                	sysenter
+
+00800ba5 <after_sysenter_label_391>:
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc6:	6a 00                	push   $0x0
+  800bc8:	55                   	push   %ebp
+  800bc9:	56                   	push   %esi
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	8d 35 d4 0b 80 00    	lea    0x800bd4,%esi
+  800bd2:	0f 34                	sysenter
+
+00800bd4 <after_sysenter_label_479>:
+  800bd4:	5e                   	pop    %esi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bd9:	85 c0                	test   %eax,%eax
+  800bdb:	7f 07                	jg     800be4 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be0:	5b                   	pop    %ebx
+  800be1:	5f                   	pop    %edi
+  800be2:	5d                   	pop    %ebp
+  800be3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800be4:	83 ec 0c             	sub    $0xc,%esp
+  800be7:	50                   	push   %eax
+  800be8:	6a 04                	push   $0x4
+  800bea:	68 75 4a 80 00       	push   $0x804a75
+  800bef:	6a 54                	push   $0x54
+  800bf1:	68 92 4a 80 00       	push   $0x804a92
+  800bf6:	e8 93 2f 00 00       	call   803b8e <_panic>
+
+00800bfb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	57                   	push   %edi
+  800bff:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c06:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c0e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c11:	ff 75 18             	push   0x18(%ebp)
+  800c14:	55                   	push   %ebp
+  800c15:	56                   	push   %esi
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	8d 35 20 0c 80 00    	lea    0x800c20,%esi
+  800c1e:	0f 34                	sysenter
+
+00800c20 <after_sysenter_label_593>:
+  800c20:	5e                   	pop    %esi
+  800c21:	5d                   	pop    %ebp
+  800c22:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c25:	85 c0                	test   %eax,%eax
+  800c27:	7f 07                	jg     800c30 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c2c:	5b                   	pop    %ebx
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+  800c33:	50                   	push   %eax
+  800c34:	6a 05                	push   $0x5
+  800c36:	68 75 4a 80 00       	push   $0x804a75
+  800c3b:	6a 54                	push   $0x54
+  800c3d:	68 92 4a 80 00       	push   $0x804a92
+  800c42:	e8 47 2f 00 00       	call   803b8e <_panic>
+
+00800c47 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c47:	55                   	push   %ebp
+  800c48:	89 e5                	mov    %esp,%ebp
+  800c4a:	57                   	push   %edi
+  800c4b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c57:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c5c:	89 df                	mov    %ebx,%edi
+  800c5e:	6a 00                	push   $0x0
+  800c60:	55                   	push   %ebp
+  800c61:	56                   	push   %esi
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	8d 35 6c 0c 80 00    	lea    0x800c6c,%esi
+  800c6a:	0f 34                	sysenter
+
+00800c6c <after_sysenter_label_704>:
+  800c6c:	5e                   	pop    %esi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c71:	85 c0                	test   %eax,%eax
+  800c73:	7f 07                	jg     800c7c <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c78:	5b                   	pop    %ebx
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  800c7f:	50                   	push   %eax
+  800c80:	6a 06                	push   $0x6
+  800c82:	68 75 4a 80 00       	push   $0x804a75
+  800c87:	6a 54                	push   $0x54
+  800c89:	68 92 4a 80 00       	push   $0x804a92
+  800c8e:	e8 fb 2e 00 00       	call   803b8e <_panic>
+
+00800c93 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca3:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ca8:	89 df                	mov    %ebx,%edi
+  800caa:	6a 00                	push   $0x0
+  800cac:	55                   	push   %ebp
+  800cad:	56                   	push   %esi
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	8d 35 b8 0c 80 00    	lea    0x800cb8,%esi
+  800cb6:	0f 34                	sysenter
+
+00800cb8 <after_sysenter_label_808>:
+  800cb8:	5e                   	pop    %esi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	7f 07                	jg     800cc8 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5f                   	pop    %edi
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc8:	83 ec 0c             	sub    $0xc,%esp
+  800ccb:	50                   	push   %eax
+  800ccc:	6a 08                	push   $0x8
+  800cce:	68 75 4a 80 00       	push   $0x804a75
+  800cd3:	6a 54                	push   $0x54
+  800cd5:	68 92 4a 80 00       	push   $0x804a92
+  800cda:	e8 af 2e 00 00       	call   803b8e <_panic>
+
+00800cdf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	57                   	push   %edi
+  800ce3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cef:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf4:	89 df                	mov    %ebx,%edi
+  800cf6:	6a 00                	push   $0x0
+  800cf8:	55                   	push   %ebp
+  800cf9:	56                   	push   %esi
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	8d 35 04 0d 80 00    	lea    0x800d04,%esi
+  800d02:	0f 34                	sysenter
+
+00800d04 <after_sysenter_label_912>:
+  800d04:	5e                   	pop    %esi
+  800d05:	5d                   	pop    %ebp
+  800d06:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d09:	85 c0                	test   %eax,%eax
+  800d0b:	7f 07                	jg     800d14 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d10:	5b                   	pop    %ebx
+  800d11:	5f                   	pop    %edi
+  800d12:	5d                   	pop    %ebp
+  800d13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+  800d17:	50                   	push   %eax
+  800d18:	6a 09                	push   $0x9
+  800d1a:	68 75 4a 80 00       	push   $0x804a75
+  800d1f:	6a 54                	push   $0x54
+  800d21:	68 92 4a 80 00       	push   $0x804a92
+  800d26:	e8 63 2e 00 00       	call   803b8e <_panic>
+
+00800d2b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d40:	89 df                	mov    %ebx,%edi
+  800d42:	6a 00                	push   $0x0
+  800d44:	55                   	push   %ebp
+  800d45:	56                   	push   %esi
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	8d 35 50 0d 80 00    	lea    0x800d50,%esi
+  800d4e:	0f 34                	sysenter
+
+00800d50 <after_sysenter_label_1016>:
+  800d50:	5e                   	pop    %esi
+  800d51:	5d                   	pop    %ebp
+  800d52:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d55:	85 c0                	test   %eax,%eax
+  800d57:	7f 07                	jg     800d60 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d5c:	5b                   	pop    %ebx
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+  800d63:	50                   	push   %eax
+  800d64:	6a 0a                	push   $0xa
+  800d66:	68 75 4a 80 00       	push   $0x804a75
+  800d6b:	6a 54                	push   $0x54
+  800d6d:	68 92 4a 80 00       	push   $0x804a92
+  800d72:	e8 17 2e 00 00       	call   803b8e <_panic>
+
+00800d77 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8d:	6a 00                	push   $0x0
+  800d8f:	55                   	push   %ebp
+  800d90:	56                   	push   %esi
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	8d 35 9b 0d 80 00    	lea    0x800d9b,%esi
+  800d99:	0f 34                	sysenter
+
+00800d9b <after_sysenter_label_1126>:
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800db6:	89 cb                	mov    %ecx,%ebx
+  800db8:	89 cf                	mov    %ecx,%edi
+  800dba:	6a 00                	push   $0x0
+  800dbc:	55                   	push   %ebp
+  800dbd:	56                   	push   %esi
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	8d 35 c8 0d 80 00    	lea    0x800dc8,%esi
+  800dc6:	0f 34                	sysenter
+
+00800dc8 <after_sysenter_label_1210>:
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	7f 07                	jg     800dd8 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800dd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  800ddb:	50                   	push   %eax
+  800ddc:	6a 0d                	push   $0xd
+  800dde:	68 75 4a 80 00       	push   $0x804a75
+  800de3:	6a 54                	push   $0x54
+  800de5:	68 92 4a 80 00       	push   $0x804a92
+  800dea:	e8 9f 2d 00 00       	call   803b8e <_panic>
+
+00800def <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	57                   	push   %edi
+  800df3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dff:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e04:	89 df                	mov    %ebx,%edi
+  800e06:	6a 00                	push   $0x0
+  800e08:	55                   	push   %ebp
+  800e09:	56                   	push   %esi
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	8d 35 14 0e 80 00    	lea    0x800e14,%esi
+  800e12:	0f 34                	sysenter
+
+00800e14 <after_sysenter_label_1311>:
+  800e14:	5e                   	pop    %esi
+  800e15:	5d                   	pop    %ebp
+  800e16:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 07                	jg     800e24 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5f                   	pop    %edi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e24:	83 ec 0c             	sub    $0xc,%esp
+  800e27:	50                   	push   %eax
+  800e28:	6a 42                	push   $0x42
+  800e2a:	68 75 4a 80 00       	push   $0x804a75
+  800e2f:	6a 54                	push   $0x54
+  800e31:	68 92 4a 80 00       	push   $0x804a92
+  800e36:	e8 53 2d 00 00       	call   803b8e <_panic>
+
+00800e3b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	57                   	push   %edi
+  800e3f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e45:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e4a:	89 d1                	mov    %edx,%ecx
+  800e4c:	89 d3                	mov    %edx,%ebx
+  800e4e:	89 d7                	mov    %edx,%edi
+  800e50:	6a 00                	push   $0x0
+  800e52:	55                   	push   %ebp
+  800e53:	56                   	push   %esi
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	8d 35 5e 0e 80 00    	lea    0x800e5e,%esi
+  800e5c:	0f 34                	sysenter
+
+00800e5e <after_sysenter_label_1411>:
+  800e5e:	5e                   	pop    %esi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e63:	5b                   	pop    %ebx
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+
+00800e67 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e77:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e7c:	89 df                	mov    %ebx,%edi
+  800e7e:	6a 00                	push   $0x0
+  800e80:	55                   	push   %ebp
+  800e81:	56                   	push   %esi
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	8d 35 8c 0e 80 00    	lea    0x800e8c,%esi
+  800e8a:	0f 34                	sysenter
+
+00800e8c <after_sysenter_label_1497>:
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800e91:	5b                   	pop    %ebx
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+
+00800e95 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eaa:	89 df                	mov    %ebx,%edi
+  800eac:	6a 00                	push   $0x0
+  800eae:	55                   	push   %ebp
+  800eaf:	56                   	push   %esi
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	8d 35 ba 0e 80 00    	lea    0x800eba,%esi
+  800eb8:	0f 34                	sysenter
+
+00800eba <after_sysenter_label_1583>:
+  800eba:	5e                   	pop    %esi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ece:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ed3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edb:	6a 00                	push   $0x0
+  800edd:	55                   	push   %ebp
+  800ede:	56                   	push   %esi
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	8d 35 e9 0e 80 00    	lea    0x800ee9,%esi
+  800ee7:	0f 34                	sysenter
+
+00800ee9 <after_sysenter_label_1672>:
+  800ee9:	5e                   	pop    %esi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800eee:	5b                   	pop    %ebx
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f07:	89 df                	mov    %ebx,%edi
+  800f09:	6a 00                	push   $0x0
+  800f0b:	55                   	push   %ebp
+  800f0c:	56                   	push   %esi
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	8d 35 17 0f 80 00    	lea    0x800f17,%esi
+  800f15:	0f 34                	sysenter
+
+00800f17 <after_sysenter_label_1758>:
+  800f17:	5e                   	pop    %esi
+  800f18:	5d                   	pop    %ebp
+  800f19:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+
+00800f20 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	57                   	push   %edi
+  800f24:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f32:	89 cb                	mov    %ecx,%ebx
+  800f34:	89 cf                	mov    %ecx,%edi
+  800f36:	6a 00                	push   $0x0
+  800f38:	55                   	push   %ebp
+  800f39:	56                   	push   %esi
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	8d 35 44 0f 80 00    	lea    0x800f44,%esi
+  800f42:	0f 34                	sysenter
+
+00800f44 <after_sysenter_label_1842>:
+  800f44:	5e                   	pop    %esi
+  800f45:	5d                   	pop    %ebp
+  800f46:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	7f 07                	jg     800f54 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f50:	5b                   	pop    %ebx
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	50                   	push   %eax
+  800f58:	6a 13                	push   $0x13
+  800f5a:	68 75 4a 80 00       	push   $0x804a75
+  800f5f:	6a 54                	push   $0x54
+  800f61:	68 92 4a 80 00       	push   $0x804a92
+  800f66:	e8 23 2c 00 00       	call   803b8e <_panic>
+
+00800f6b <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f7a:	89 d1                	mov    %edx,%ecx
+  800f7c:	89 d3                	mov    %edx,%ebx
+  800f7e:	89 d7                	mov    %edx,%edi
+  800f80:	6a 00                	push   $0x0
+  800f82:	55                   	push   %ebp
+  800f83:	56                   	push   %esi
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+
+00800f8e <after_sysenter_label_1939>:
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800faf:	6a 00                	push   $0x0
+  800fb1:	55                   	push   %ebp
+  800fb2:	56                   	push   %esi
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	8d 35 bd 0f 80 00    	lea    0x800fbd,%esi
+  800fbb:	0f 34                	sysenter
+
+00800fbd <after_sysenter_label_2028>:
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800fc2:	5b                   	pop    %ebx
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd6:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fdb:	89 df                	mov    %ebx,%edi
+  800fdd:	6a 00                	push   $0x0
+  800fdf:	55                   	push   %ebp
+  800fe0:	56                   	push   %esi
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	8d 35 eb 0f 80 00    	lea    0x800feb,%esi
+  800fe9:	0f 34                	sysenter
+
+00800feb <after_sysenter_label_2114>:
+  800feb:	5e                   	pop    %esi
+  800fec:	5d                   	pop    %ebp
+  800fed:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5f                   	pop    %edi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	c3                   	ret
+
+00800ff4 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	57                   	push   %edi
+  800ff8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 17 00 00 00       	mov    $0x17,%eax
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	6a 00                	push   $0x0
+  80100d:	55                   	push   %ebp
+  80100e:	56                   	push   %esi
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	8d 35 19 10 80 00    	lea    0x801019,%esi
+  801017:	0f 34                	sysenter
+
+00801019 <after_sysenter_label_2200>:
+  801019:	5e                   	pop    %esi
+  80101a:	5d                   	pop    %ebp
+  80101b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5f                   	pop    %edi
+  801020:	5d                   	pop    %ebp
+  801021:	c3                   	ret
+
+00801022 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801022:	55                   	push   %ebp
+  801023:	89 e5                	mov    %esp,%ebp
+  801025:	57                   	push   %edi
+  801026:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 18 00 00 00       	mov    $0x18,%eax
+  801037:	89 df                	mov    %ebx,%edi
+  801039:	6a 00                	push   $0x0
+  80103b:	55                   	push   %ebp
+  80103c:	56                   	push   %esi
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	8d 35 47 10 80 00    	lea    0x801047,%esi
+  801045:	0f 34                	sysenter
+
+00801047 <after_sysenter_label_2286>:
+  801047:	5e                   	pop    %esi
+  801048:	5d                   	pop    %ebp
+  801049:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+
+00801050 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+  801056:	05 00 00 00 30       	add    $0x30000000,%eax
+  80105b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801063:	8b 45 08             	mov    0x8(%ebp),%eax
+  801066:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80106b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801070:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80107a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80107f:	eb 02                	jmp    801083 <fd_alloc+0xc>
+  801081:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801083:	89 c2                	mov    %eax,%edx
+  801085:	c1 ea 16             	shr    $0x16,%edx
+  801088:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80108f:	f6 c2 01             	test   $0x1,%dl
+  801092:	74 2b                	je     8010bf <fd_alloc+0x48>
+  801094:	89 c2                	mov    %eax,%edx
+  801096:	c1 ea 0c             	shr    $0xc,%edx
+  801099:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010a0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010a6:	f6 c1 01             	test   $0x1,%cl
+  8010a9:	74 14                	je     8010bf <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010ab:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010b1:	75 ce                	jne    801081 <fd_alloc+0xa>
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010b8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010bd:	eb 05                	jmp    8010c4 <fd_alloc+0x4d>
+			return 0;
+  8010bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	89 02                	mov    %eax,(%edx)
+}
+  8010c9:	89 c8                	mov    %ecx,%eax
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+
+008010cd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010d3:	83 f8 1f             	cmp    $0x1f,%eax
+  8010d6:	77 30                	ja     801108 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010d8:	c1 e0 0c             	shl    $0xc,%eax
+  8010db:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010e0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010e6:	f6 c2 01             	test   $0x1,%dl
+  8010e9:	74 24                	je     80110f <fd_lookup+0x42>
+  8010eb:	89 c2                	mov    %eax,%edx
+  8010ed:	c1 ea 0c             	shr    $0xc,%edx
+  8010f0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010f7:	f6 c2 01             	test   $0x1,%dl
+  8010fa:	74 1a                	je     801116 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010ff:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+		return -E_INVAL;
+  801108:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80110d:	eb f7                	jmp    801106 <fd_lookup+0x39>
+		return -E_INVAL;
+  80110f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801114:	eb f0                	jmp    801106 <fd_lookup+0x39>
+  801116:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80111b:	eb e9                	jmp    801106 <fd_lookup+0x39>
+
+0080111d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	53                   	push   %ebx
+  801121:	83 ec 04             	sub    $0x4,%esp
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112c:	eb 03                	jmp    801131 <dev_lookup+0x14>
+  80112e:	83 c0 01             	add    $0x1,%eax
+  801131:	8b 1c 85 1c 4b 80 00 	mov    0x804b1c(,%eax,4),%ebx
+  801138:	85 db                	test   %ebx,%ebx
+  80113a:	74 0b                	je     801147 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80113c:	39 13                	cmp    %edx,(%ebx)
+  80113e:	75 ee                	jne    80112e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801140:	b8 00 00 00 00       	mov    $0x0,%eax
+  801145:	eb 49                	jmp    801190 <dev_lookup+0x73>
+  801147:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801149:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80114f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801154:	77 18                	ja     80116e <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801156:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80115b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80115d:	c1 e8 10             	shr    $0x10,%eax
+  801160:	74 0c                	je     80116e <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801162:	c1 e0 10             	shl    $0x10,%eax
+  801165:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80116a:	29 c1                	sub    %eax,%ecx
+  80116c:	eb 06                	jmp    801174 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80116e:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801174:	8b 01                	mov    (%ecx),%eax
+  801176:	8b 40 48             	mov    0x48(%eax),%eax
+  801179:	83 ec 04             	sub    $0x4,%esp
+  80117c:	52                   	push   %edx
+  80117d:	50                   	push   %eax
+  80117e:	68 a0 4a 80 00       	push   $0x804aa0
+  801183:	e8 04 f0 ff ff       	call   80018c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801188:	83 c4 10             	add    $0x10,%esp
+  80118b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801193:	89 1a                	mov    %ebx,(%edx)
+}
+  801195:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801198:	c9                   	leave
+  801199:	c3                   	ret
+
+0080119a <fd_close>:
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 24             	sub    $0x24,%esp
+  8011a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011ac:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ad:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011b3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011b6:	50                   	push   %eax
+  8011b7:	e8 11 ff ff ff       	call   8010cd <fd_lookup>
+  8011bc:	89 c3                	mov    %eax,%ebx
+  8011be:	83 c4 10             	add    $0x10,%esp
+  8011c1:	85 c0                	test   %eax,%eax
+  8011c3:	78 05                	js     8011ca <fd_close+0x30>
+	    || fd != fd2)
+  8011c5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011c8:	74 16                	je     8011e0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011ca:	89 f8                	mov    %edi,%eax
+  8011cc:	84 c0                	test   %al,%al
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011d6:	89 d8                	mov    %ebx,%eax
+  8011d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011e0:	83 ec 08             	sub    $0x8,%esp
+  8011e3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011e6:	50                   	push   %eax
+  8011e7:	ff 36                	push   (%esi)
+  8011e9:	e8 2f ff ff ff       	call   80111d <dev_lookup>
+  8011ee:	89 c3                	mov    %eax,%ebx
+  8011f0:	83 c4 10             	add    $0x10,%esp
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	78 1a                	js     801211 <fd_close+0x77>
+		if (dev->dev_close)
+  8011f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011fa:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801202:	85 c0                	test   %eax,%eax
+  801204:	74 0b                	je     801211 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	56                   	push   %esi
+  80120a:	ff d0                	call   *%eax
+  80120c:	89 c3                	mov    %eax,%ebx
+  80120e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801211:	83 ec 08             	sub    $0x8,%esp
+  801214:	56                   	push   %esi
+  801215:	6a 00                	push   $0x0
+  801217:	e8 2b fa ff ff       	call   800c47 <sys_page_unmap>
+	return r;
+  80121c:	83 c4 10             	add    $0x10,%esp
+  80121f:	eb b5                	jmp    8011d6 <fd_close+0x3c>
+
+00801221 <close>:
+
+int
+close(int fdnum)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801227:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80122a:	50                   	push   %eax
+  80122b:	ff 75 08             	push   0x8(%ebp)
+  80122e:	e8 9a fe ff ff       	call   8010cd <fd_lookup>
+  801233:	83 c4 10             	add    $0x10,%esp
+  801236:	85 c0                	test   %eax,%eax
+  801238:	79 02                	jns    80123c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80123a:	c9                   	leave
+  80123b:	c3                   	ret
+		return fd_close(fd, 1);
+  80123c:	83 ec 08             	sub    $0x8,%esp
+  80123f:	6a 01                	push   $0x1
+  801241:	ff 75 f4             	push   -0xc(%ebp)
+  801244:	e8 51 ff ff ff       	call   80119a <fd_close>
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	eb ec                	jmp    80123a <close+0x19>
+
+0080124e <close_all>:
+
+void
+close_all(void)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	53                   	push   %ebx
+  801252:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	53                   	push   %ebx
+  80125e:	e8 be ff ff ff       	call   801221 <close>
+	for (i = 0; i < MAXFD; i++)
+  801263:	83 c3 01             	add    $0x1,%ebx
+  801266:	83 c4 10             	add    $0x10,%esp
+  801269:	83 fb 20             	cmp    $0x20,%ebx
+  80126c:	75 ec                	jne    80125a <close_all+0xc>
+}
+  80126e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+
+00801273 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80127c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80127f:	50                   	push   %eax
+  801280:	ff 75 08             	push   0x8(%ebp)
+  801283:	e8 45 fe ff ff       	call   8010cd <fd_lookup>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	78 7f                	js     801310 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	ff 75 0c             	push   0xc(%ebp)
+  801297:	e8 85 ff ff ff       	call   801221 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80129c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80129f:	c1 e6 0c             	shl    $0xc,%esi
+  8012a2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012ab:	89 3c 24             	mov    %edi,(%esp)
+  8012ae:	e8 ad fd ff ff       	call   801060 <fd2data>
+  8012b3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012b5:	89 34 24             	mov    %esi,(%esp)
+  8012b8:	e8 a3 fd ff ff       	call   801060 <fd2data>
+  8012bd:	83 c4 10             	add    $0x10,%esp
+  8012c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012c3:	89 d8                	mov    %ebx,%eax
+  8012c5:	c1 e8 16             	shr    $0x16,%eax
+  8012c8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012cf:	a8 01                	test   $0x1,%al
+  8012d1:	74 11                	je     8012e4 <dup+0x71>
+  8012d3:	89 d8                	mov    %ebx,%eax
+  8012d5:	c1 e8 0c             	shr    $0xc,%eax
+  8012d8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012df:	f6 c2 01             	test   $0x1,%dl
+  8012e2:	75 36                	jne    80131a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012e4:	89 f8                	mov    %edi,%eax
+  8012e6:	c1 e8 0c             	shr    $0xc,%eax
+  8012e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+  8012f3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012f8:	50                   	push   %eax
+  8012f9:	56                   	push   %esi
+  8012fa:	6a 00                	push   $0x0
+  8012fc:	57                   	push   %edi
+  8012fd:	6a 00                	push   $0x0
+  8012ff:	e8 f7 f8 ff ff       	call   800bfb <sys_page_map>
+  801304:	89 c3                	mov    %eax,%ebx
+  801306:	83 c4 20             	add    $0x20,%esp
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	78 33                	js     801340 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80130d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801310:	89 d8                	mov    %ebx,%eax
+  801312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801315:	5b                   	pop    %ebx
+  801316:	5e                   	pop    %esi
+  801317:	5f                   	pop    %edi
+  801318:	5d                   	pop    %ebp
+  801319:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80131a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	25 07 0e 00 00       	and    $0xe07,%eax
+  801329:	50                   	push   %eax
+  80132a:	ff 75 d4             	push   -0x2c(%ebp)
+  80132d:	6a 00                	push   $0x0
+  80132f:	53                   	push   %ebx
+  801330:	6a 00                	push   $0x0
+  801332:	e8 c4 f8 ff ff       	call   800bfb <sys_page_map>
+  801337:	89 c3                	mov    %eax,%ebx
+  801339:	83 c4 20             	add    $0x20,%esp
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	79 a4                	jns    8012e4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801340:	83 ec 08             	sub    $0x8,%esp
+  801343:	56                   	push   %esi
+  801344:	6a 00                	push   $0x0
+  801346:	e8 fc f8 ff ff       	call   800c47 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80134b:	83 c4 08             	add    $0x8,%esp
+  80134e:	ff 75 d4             	push   -0x2c(%ebp)
+  801351:	6a 00                	push   $0x0
+  801353:	e8 ef f8 ff ff       	call   800c47 <sys_page_unmap>
+	return r;
+  801358:	83 c4 10             	add    $0x10,%esp
+  80135b:	eb b3                	jmp    801310 <dup+0x9d>
+
+0080135d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+  801362:	83 ec 18             	sub    $0x18,%esp
+  801365:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801368:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80136b:	50                   	push   %eax
+  80136c:	53                   	push   %ebx
+  80136d:	e8 5b fd ff ff       	call   8010cd <fd_lookup>
+  801372:	83 c4 10             	add    $0x10,%esp
+  801375:	85 c0                	test   %eax,%eax
+  801377:	78 3c                	js     8013b5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801379:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80137c:	83 ec 08             	sub    $0x8,%esp
+  80137f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801382:	50                   	push   %eax
+  801383:	ff 36                	push   (%esi)
+  801385:	e8 93 fd ff ff       	call   80111d <dev_lookup>
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	78 24                	js     8013b5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801391:	8b 46 08             	mov    0x8(%esi),%eax
+  801394:	83 e0 03             	and    $0x3,%eax
+  801397:	83 f8 01             	cmp    $0x1,%eax
+  80139a:	74 20                	je     8013bc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80139c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80139f:	8b 40 08             	mov    0x8(%eax),%eax
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	74 61                	je     801407 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013a6:	83 ec 04             	sub    $0x4,%esp
+  8013a9:	ff 75 10             	push   0x10(%ebp)
+  8013ac:	ff 75 0c             	push   0xc(%ebp)
+  8013af:	56                   	push   %esi
+  8013b0:	ff d0                	call   *%eax
+  8013b2:	83 c4 10             	add    $0x10,%esp
+}
+  8013b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+  8013bc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013be:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8013c4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8013c9:	77 18                	ja     8013e3 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8013cb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8013d0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8013d2:	c1 e8 10             	shr    $0x10,%eax
+  8013d5:	74 0c                	je     8013e3 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8013d7:	c1 e0 10             	shl    $0x10,%eax
+  8013da:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8013df:	29 c2                	sub    %eax,%edx
+  8013e1:	eb 06                	jmp    8013e9 <read+0x8c>
+		return pthread_main_tls;
+  8013e3:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013e9:	8b 02                	mov    (%edx),%eax
+  8013eb:	8b 40 48             	mov    0x48(%eax),%eax
+  8013ee:	83 ec 04             	sub    $0x4,%esp
+  8013f1:	53                   	push   %ebx
+  8013f2:	50                   	push   %eax
+  8013f3:	68 e1 4a 80 00       	push   $0x804ae1
+  8013f8:	e8 8f ed ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  8013fd:	83 c4 10             	add    $0x10,%esp
+  801400:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801405:	eb ae                	jmp    8013b5 <read+0x58>
+		return -E_NOT_SUPP;
+  801407:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80140c:	eb a7                	jmp    8013b5 <read+0x58>
+
+0080140e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	57                   	push   %edi
+  801412:	56                   	push   %esi
+  801413:	53                   	push   %ebx
+  801414:	83 ec 0c             	sub    $0xc,%esp
+  801417:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80141a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80141d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801422:	eb 02                	jmp    801426 <readn+0x18>
+  801424:	01 c3                	add    %eax,%ebx
+  801426:	39 f3                	cmp    %esi,%ebx
+  801428:	73 21                	jae    80144b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80142a:	83 ec 04             	sub    $0x4,%esp
+  80142d:	89 f0                	mov    %esi,%eax
+  80142f:	29 d8                	sub    %ebx,%eax
+  801431:	50                   	push   %eax
+  801432:	89 d8                	mov    %ebx,%eax
+  801434:	03 45 0c             	add    0xc(%ebp),%eax
+  801437:	50                   	push   %eax
+  801438:	57                   	push   %edi
+  801439:	e8 1f ff ff ff       	call   80135d <read>
+		if (m < 0)
+  80143e:	83 c4 10             	add    $0x10,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 04                	js     801449 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801445:	75 dd                	jne    801424 <readn+0x16>
+  801447:	eb 02                	jmp    80144b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801449:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80144b:	89 d8                	mov    %ebx,%eax
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+
+00801455 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	56                   	push   %esi
+  801459:	53                   	push   %ebx
+  80145a:	83 ec 18             	sub    $0x18,%esp
+  80145d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801460:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801463:	50                   	push   %eax
+  801464:	53                   	push   %ebx
+  801465:	e8 63 fc ff ff       	call   8010cd <fd_lookup>
+  80146a:	83 c4 10             	add    $0x10,%esp
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	78 37                	js     8014a8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801471:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801474:	83 ec 08             	sub    $0x8,%esp
+  801477:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80147a:	50                   	push   %eax
+  80147b:	ff 36                	push   (%esi)
+  80147d:	e8 9b fc ff ff       	call   80111d <dev_lookup>
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	78 1f                	js     8014a8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801489:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80148d:	74 20                	je     8014af <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80148f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801492:	8b 40 0c             	mov    0xc(%eax),%eax
+  801495:	85 c0                	test   %eax,%eax
+  801497:	74 61                	je     8014fa <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	ff 75 10             	push   0x10(%ebp)
+  80149f:	ff 75 0c             	push   0xc(%ebp)
+  8014a2:	56                   	push   %esi
+  8014a3:	ff d0                	call   *%eax
+  8014a5:	83 c4 10             	add    $0x10,%esp
+}
+  8014a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ab:	5b                   	pop    %ebx
+  8014ac:	5e                   	pop    %esi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+  8014af:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014b1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014b7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014bc:	77 18                	ja     8014d6 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014be:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014c3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014c5:	c1 e8 10             	shr    $0x10,%eax
+  8014c8:	74 0c                	je     8014d6 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014ca:	c1 e0 10             	shl    $0x10,%eax
+  8014cd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014d2:	29 c2                	sub    %eax,%edx
+  8014d4:	eb 06                	jmp    8014dc <write+0x87>
+		return pthread_main_tls;
+  8014d6:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014dc:	8b 02                	mov    (%edx),%eax
+  8014de:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e1:	83 ec 04             	sub    $0x4,%esp
+  8014e4:	53                   	push   %ebx
+  8014e5:	50                   	push   %eax
+  8014e6:	68 fd 4a 80 00       	push   $0x804afd
+  8014eb:	e8 9c ec ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f8:	eb ae                	jmp    8014a8 <write+0x53>
+		return -E_NOT_SUPP;
+  8014fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014ff:	eb a7                	jmp    8014a8 <write+0x53>
+
+00801501 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801507:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150a:	50                   	push   %eax
+  80150b:	ff 75 08             	push   0x8(%ebp)
+  80150e:	e8 ba fb ff ff       	call   8010cd <fd_lookup>
+  801513:	83 c4 10             	add    $0x10,%esp
+  801516:	85 c0                	test   %eax,%eax
+  801518:	78 0e                	js     801528 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80151a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80151d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801520:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801523:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+
+0080152a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80152a:	55                   	push   %ebp
+  80152b:	89 e5                	mov    %esp,%ebp
+  80152d:	56                   	push   %esi
+  80152e:	53                   	push   %ebx
+  80152f:	83 ec 18             	sub    $0x18,%esp
+  801532:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801535:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801538:	50                   	push   %eax
+  801539:	53                   	push   %ebx
+  80153a:	e8 8e fb ff ff       	call   8010cd <fd_lookup>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	78 34                	js     80157a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801546:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801549:	83 ec 08             	sub    $0x8,%esp
+  80154c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154f:	50                   	push   %eax
+  801550:	ff 36                	push   (%esi)
+  801552:	e8 c6 fb ff ff       	call   80111d <dev_lookup>
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	78 1c                	js     80157a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80155e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801562:	74 1d                	je     801581 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801567:	8b 40 18             	mov    0x18(%eax),%eax
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	74 5e                	je     8015cc <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80156e:	83 ec 08             	sub    $0x8,%esp
+  801571:	ff 75 0c             	push   0xc(%ebp)
+  801574:	56                   	push   %esi
+  801575:	ff d0                	call   *%eax
+  801577:	83 c4 10             	add    $0x10,%esp
+}
+  80157a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5d                   	pop    %ebp
+  801580:	c3                   	ret
+  801581:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801583:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801589:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80158e:	77 18                	ja     8015a8 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801590:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801595:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801597:	c1 e8 10             	shr    $0x10,%eax
+  80159a:	74 0c                	je     8015a8 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80159c:	c1 e0 10             	shl    $0x10,%eax
+  80159f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015a4:	29 c2                	sub    %eax,%edx
+  8015a6:	eb 06                	jmp    8015ae <ftruncate+0x84>
+		return pthread_main_tls;
+  8015a8:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+			thisenv->env_id, fdnum);
+  8015ae:	8b 02                	mov    (%edx),%eax
+  8015b0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015b3:	83 ec 04             	sub    $0x4,%esp
+  8015b6:	53                   	push   %ebx
+  8015b7:	50                   	push   %eax
+  8015b8:	68 c0 4a 80 00       	push   $0x804ac0
+  8015bd:	e8 ca eb ff ff       	call   80018c <cprintf>
+		return -E_INVAL;
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ca:	eb ae                	jmp    80157a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d1:	eb a7                	jmp    80157a <ftruncate+0x50>
+
+008015d3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 18             	sub    $0x18,%esp
+  8015db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e1:	50                   	push   %eax
+  8015e2:	ff 75 08             	push   0x8(%ebp)
+  8015e5:	e8 e3 fa ff ff       	call   8010cd <fd_lookup>
+  8015ea:	83 c4 10             	add    $0x10,%esp
+  8015ed:	85 c0                	test   %eax,%eax
+  8015ef:	78 49                	js     80163a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f4:	83 ec 08             	sub    $0x8,%esp
+  8015f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fa:	50                   	push   %eax
+  8015fb:	ff 36                	push   (%esi)
+  8015fd:	e8 1b fb ff ff       	call   80111d <dev_lookup>
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	85 c0                	test   %eax,%eax
+  801607:	78 31                	js     80163a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801609:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80160c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801610:	74 2f                	je     801641 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801612:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801615:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80161c:	00 00 00 
+	stat->st_isdir = 0;
+  80161f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801626:	00 00 00 
+	stat->st_dev = dev;
+  801629:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80162f:	83 ec 08             	sub    $0x8,%esp
+  801632:	53                   	push   %ebx
+  801633:	56                   	push   %esi
+  801634:	ff 50 14             	call   *0x14(%eax)
+  801637:	83 c4 10             	add    $0x10,%esp
+}
+  80163a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163d:	5b                   	pop    %ebx
+  80163e:	5e                   	pop    %esi
+  80163f:	5d                   	pop    %ebp
+  801640:	c3                   	ret
+		return -E_NOT_SUPP;
+  801641:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801646:	eb f2                	jmp    80163a <fstat+0x67>
+
+00801648 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	6a 00                	push   $0x0
+  801652:	ff 75 08             	push   0x8(%ebp)
+  801655:	e8 4b 03 00 00       	call   8019a5 <open>
+  80165a:	89 c3                	mov    %eax,%ebx
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 1b                	js     80167e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	ff 75 0c             	push   0xc(%ebp)
+  801669:	50                   	push   %eax
+  80166a:	e8 64 ff ff ff       	call   8015d3 <fstat>
+  80166f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801671:	89 1c 24             	mov    %ebx,(%esp)
+  801674:	e8 a8 fb ff ff       	call   801221 <close>
+	return r;
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	89 f3                	mov    %esi,%ebx
+}
+  80167e:	89 d8                	mov    %ebx,%eax
+  801680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+
+00801687 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	56                   	push   %esi
+  80168b:	53                   	push   %ebx
+  80168c:	89 c6                	mov    %eax,%esi
+  80168e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801690:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801697:	74 27                	je     8016c0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801699:	6a 07                	push   $0x7
+  80169b:	68 00 70 80 00       	push   $0x807000
+  8016a0:	56                   	push   %esi
+  8016a1:	ff 35 00 60 80 00    	push   0x806000
+  8016a7:	e8 94 2c 00 00       	call   804340 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016ac:	83 c4 0c             	add    $0xc,%esp
+  8016af:	6a 00                	push   $0x0
+  8016b1:	53                   	push   %ebx
+  8016b2:	6a 00                	push   $0x0
+  8016b4:	e8 91 2b 00 00       	call   80424a <ipc_recv>
+}
+  8016b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016bc:	5b                   	pop    %ebx
+  8016bd:	5e                   	pop    %esi
+  8016be:	5d                   	pop    %ebp
+  8016bf:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016c0:	83 ec 0c             	sub    $0xc,%esp
+  8016c3:	6a 01                	push   $0x1
+  8016c5:	e8 cc 2c 00 00       	call   804396 <ipc_find_env>
+  8016ca:	a3 00 60 80 00       	mov    %eax,0x806000
+  8016cf:	83 c4 10             	add    $0x10,%esp
+  8016d2:	eb c5                	jmp    801699 <fsipc+0x12>
+
+008016d4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8016db:	68 04 60 80 00       	push   $0x806004
+  8016e0:	e8 29 1b 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016eb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8016f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016f3:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8016f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fd:	b8 02 00 00 00       	mov    $0x2,%eax
+  801702:	e8 80 ff ff ff       	call   801687 <fsipc>
+  801707:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801709:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801710:	e8 66 1b 00 00       	call   80327b <mutex_unlock>
+	return r;
+}
+  801715:	89 d8                	mov    %ebx,%eax
+  801717:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+0080171c <devfile_flush>:
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	53                   	push   %ebx
+  801720:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801723:	68 04 60 80 00       	push   $0x806004
+  801728:	e8 e1 1a 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80172d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801730:	8b 40 0c             	mov    0xc(%eax),%eax
+  801733:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801742:	e8 40 ff ff ff       	call   801687 <fsipc>
+  801747:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801749:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801750:	e8 26 1b 00 00       	call   80327b <mutex_unlock>
+}
+  801755:	89 d8                	mov    %ebx,%eax
+  801757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+0080175c <devfile_stat>:
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801764:	83 ec 0c             	sub    $0xc,%esp
+  801767:	68 04 60 80 00       	push   $0x806004
+  80176c:	e8 9d 1a 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801771:	8b 45 08             	mov    0x8(%ebp),%eax
+  801774:	8b 40 0c             	mov    0xc(%eax),%eax
+  801777:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80177c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801781:	b8 05 00 00 00       	mov    $0x5,%eax
+  801786:	e8 fc fe ff ff       	call   801687 <fsipc>
+  80178b:	89 c3                	mov    %eax,%ebx
+  80178d:	83 c4 10             	add    $0x10,%esp
+  801790:	85 c0                	test   %eax,%eax
+  801792:	79 16                	jns    8017aa <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801794:	83 ec 0c             	sub    $0xc,%esp
+  801797:	68 04 60 80 00       	push   $0x806004
+  80179c:	e8 da 1a 00 00       	call   80327b <mutex_unlock>
+}
+  8017a1:	89 d8                	mov    %ebx,%eax
+  8017a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017aa:	83 ec 08             	sub    $0x8,%esp
+  8017ad:	68 00 70 80 00       	push   $0x807000
+  8017b2:	56                   	push   %esi
+  8017b3:	e8 b8 ef ff ff       	call   800770 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8017b8:	a1 80 70 80 00       	mov    0x807080,%eax
+  8017bd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017c3:	a1 84 70 80 00       	mov    0x807084,%eax
+  8017c8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8017ce:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	eb bc                	jmp    801794 <devfile_stat+0x38>
+
+008017d8 <devfile_write>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 10             	sub    $0x10,%esp
+  8017df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8017e2:	68 04 60 80 00       	push   $0x806004
+  8017e7:	e8 22 1a 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f2:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8017f7:	83 c4 10             	add    $0x10,%esp
+  8017fa:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801800:	76 3d                	jbe    80183f <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801802:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801807:	39 c3                	cmp    %eax,%ebx
+  801809:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80180c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80180f:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801814:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80181a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801824:	e8 5e fe ff ff       	call   801687 <fsipc>
+  801829:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80182b:	83 ec 0c             	sub    $0xc,%esp
+  80182e:	68 04 60 80 00       	push   $0x806004
+  801833:	e8 43 1a 00 00       	call   80327b <mutex_unlock>
+}
+  801838:	89 d8                	mov    %ebx,%eax
+  80183a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80183d:	c9                   	leave
+  80183e:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80183f:	83 ec 04             	sub    $0x4,%esp
+  801842:	53                   	push   %ebx
+  801843:	ff 75 0c             	push   0xc(%ebp)
+  801846:	68 0c 70 80 00       	push   $0x80700c
+  80184b:	e8 a6 f0 ff ff       	call   8008f6 <memmove>
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	eb b5                	jmp    80180f <devfile_write+0x37>
+
+0080185a <devfile_read>:
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	57                   	push   %edi
+  80185e:	56                   	push   %esi
+  80185f:	53                   	push   %ebx
+  801860:	83 ec 0c             	sub    $0xc,%esp
+  801863:	8b 75 08             	mov    0x8(%ebp),%esi
+  801866:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80186c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801872:	0f 86 8c 00 00 00    	jbe    801904 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801878:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80187d:	39 c3                	cmp    %eax,%ebx
+  80187f:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801882:	89 f8                	mov    %edi,%eax
+  801884:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801887:	eb 0f                	jmp    801898 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801889:	0f b6 08             	movzbl (%eax),%ecx
+  80188c:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80188e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801893:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801898:	39 d0                	cmp    %edx,%eax
+  80189a:	72 ed                	jb     801889 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80189c:	83 ec 0c             	sub    $0xc,%esp
+  80189f:	68 04 60 80 00       	push   $0x806004
+  8018a4:	e8 65 19 00 00       	call   80320e <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018a9:	8b 46 0c             	mov    0xc(%esi),%eax
+  8018ac:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8018b1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8018b7:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8018bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018c7:	e8 bb fd ff ff       	call   801687 <fsipc>
+  8018cc:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8018ce:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8018d5:	e8 a1 19 00 00       	call   80327b <mutex_unlock>
+		assert(r <= (int) n);
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	39 f3                	cmp    %esi,%ebx
+  8018df:	7c 0a                	jl     8018eb <devfile_read+0x91>
+}
+  8018e1:	89 f0                	mov    %esi,%eax
+  8018e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e6:	5b                   	pop    %ebx
+  8018e7:	5e                   	pop    %esi
+  8018e8:	5f                   	pop    %edi
+  8018e9:	5d                   	pop    %ebp
+  8018ea:	c3                   	ret
+		assert(r <= (int) n);
+  8018eb:	68 30 4b 80 00       	push   $0x804b30
+  8018f0:	68 3d 4b 80 00       	push   $0x804b3d
+  8018f5:	68 90 00 00 00       	push   $0x90
+  8018fa:	68 52 4b 80 00       	push   $0x804b52
+  8018ff:	e8 8a 22 00 00       	call   803b8e <_panic>
+	mutex_lock(&fsipc_mu);
+  801904:	83 ec 0c             	sub    $0xc,%esp
+  801907:	68 04 60 80 00       	push   $0x806004
+  80190c:	e8 fd 18 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801911:	8b 46 0c             	mov    0xc(%esi),%eax
+  801914:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801919:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  80191f:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801926:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801929:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801933:	e8 4f fd ff ff       	call   801687 <fsipc>
+  801938:	89 c6                	mov    %eax,%esi
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 1d                	js     80195e <devfile_read+0x104>
+		assert(r <= n);
+  801941:	39 c3                	cmp    %eax,%ebx
+  801943:	72 2e                	jb     801973 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801945:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80194a:	7f 40                	jg     80198c <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80194c:	83 ec 04             	sub    $0x4,%esp
+  80194f:	50                   	push   %eax
+  801950:	68 00 70 80 00       	push   $0x807000
+  801955:	57                   	push   %edi
+  801956:	e8 9b ef ff ff       	call   8008f6 <memmove>
+  80195b:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80195e:	83 ec 0c             	sub    $0xc,%esp
+  801961:	68 04 60 80 00       	push   $0x806004
+  801966:	e8 10 19 00 00       	call   80327b <mutex_unlock>
+	return r;
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	e9 6e ff ff ff       	jmp    8018e1 <devfile_read+0x87>
+		assert(r <= n);
+  801973:	68 5d 4b 80 00       	push   $0x804b5d
+  801978:	68 3d 4b 80 00       	push   $0x804b3d
+  80197d:	68 99 00 00 00       	push   $0x99
+  801982:	68 52 4b 80 00       	push   $0x804b52
+  801987:	e8 02 22 00 00       	call   803b8e <_panic>
+		assert(r <= PGSIZE);
+  80198c:	68 64 4b 80 00       	push   $0x804b64
+  801991:	68 3d 4b 80 00       	push   $0x804b3d
+  801996:	68 9a 00 00 00       	push   $0x9a
+  80199b:	68 52 4b 80 00       	push   $0x804b52
+  8019a0:	e8 e9 21 00 00       	call   803b8e <_panic>
+
+008019a5 <open>:
+{
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 1c             	sub    $0x1c,%esp
+  8019ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019b0:	56                   	push   %esi
+  8019b1:	e8 7f ed ff ff       	call   800735 <strlen>
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019be:	0f 8f 85 00 00 00    	jg     801a49 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019c4:	83 ec 0c             	sub    $0xc,%esp
+  8019c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ca:	50                   	push   %eax
+  8019cb:	e8 a7 f6 ff ff       	call   801077 <fd_alloc>
+  8019d0:	89 c3                	mov    %eax,%ebx
+  8019d2:	83 c4 10             	add    $0x10,%esp
+  8019d5:	85 c0                	test   %eax,%eax
+  8019d7:	78 55                	js     801a2e <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8019d9:	83 ec 0c             	sub    $0xc,%esp
+  8019dc:	68 04 60 80 00       	push   $0x806004
+  8019e1:	e8 28 18 00 00       	call   80320e <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8019e6:	83 c4 08             	add    $0x8,%esp
+  8019e9:	56                   	push   %esi
+  8019ea:	68 00 70 80 00       	push   $0x807000
+  8019ef:	e8 7c ed ff ff       	call   800770 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8019f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f7:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  8019fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a04:	e8 7e fc ff ff       	call   801687 <fsipc>
+  801a09:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a0b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801a12:	e8 64 18 00 00       	call   80327b <mutex_unlock>
+	if (r < 0) {
+  801a17:	83 c4 10             	add    $0x10,%esp
+  801a1a:	85 db                	test   %ebx,%ebx
+  801a1c:	78 19                	js     801a37 <open+0x92>
+	return fd2num(fd);
+  801a1e:	83 ec 0c             	sub    $0xc,%esp
+  801a21:	ff 75 f4             	push   -0xc(%ebp)
+  801a24:	e8 27 f6 ff ff       	call   801050 <fd2num>
+  801a29:	89 c3                	mov    %eax,%ebx
+  801a2b:	83 c4 10             	add    $0x10,%esp
+}
+  801a2e:	89 d8                	mov    %ebx,%eax
+  801a30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a33:	5b                   	pop    %ebx
+  801a34:	5e                   	pop    %esi
+  801a35:	5d                   	pop    %ebp
+  801a36:	c3                   	ret
+		fd_close(fd, 0);
+  801a37:	83 ec 08             	sub    $0x8,%esp
+  801a3a:	6a 00                	push   $0x0
+  801a3c:	ff 75 f4             	push   -0xc(%ebp)
+  801a3f:	e8 56 f7 ff ff       	call   80119a <fd_close>
+		return r;
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	eb e5                	jmp    801a2e <open+0x89>
+		return -E_BAD_PATH;
+  801a49:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a4e:	eb de                	jmp    801a2e <open+0x89>
+
+00801a50 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	53                   	push   %ebx
+  801a54:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	ff 75 08             	push   0x8(%ebp)
+  801a5e:	e8 6a f6 ff ff       	call   8010cd <fd_lookup>
+  801a63:	89 c3                	mov    %eax,%ebx
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 5b                	js     801ac7 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a6f:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801a75:	39 08                	cmp    %ecx,(%eax)
+  801a77:	75 55                	jne    801ace <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801a79:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801a7d:	74 56                	je     801ad5 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801a7f:	83 ec 0c             	sub    $0xc,%esp
+  801a82:	68 04 60 80 00       	push   $0x806004
+  801a87:	e8 82 17 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a92:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801a97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a9a:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801a9f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aa2:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aac:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ab1:	e8 d1 fb ff ff       	call   801687 <fsipc>
+  801ab6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ab8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801abf:	e8 b7 17 00 00       	call   80327b <mutex_unlock>
+	return r;
+  801ac4:	83 c4 10             	add    $0x10,%esp
+}
+  801ac7:	89 d8                	mov    %ebx,%eax
+  801ac9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ace:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ad3:	eb f2                	jmp    801ac7 <fallocate+0x77>
+		return -E_INVAL;
+  801ad5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ada:	eb eb                	jmp    801ac7 <fallocate+0x77>
+
+00801adc <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801adc:	55                   	push   %ebp
+  801add:	89 e5                	mov    %esp,%ebp
+  801adf:	56                   	push   %esi
+  801ae0:	53                   	push   %ebx
+  801ae1:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ae4:	89 f3                	mov    %esi,%ebx
+  801ae6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801aec:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801aef:	eb 06                	jmp    801af7 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801af1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801af7:	39 f3                	cmp    %esi,%ebx
+  801af9:	73 14                	jae    801b0f <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801afb:	83 ec 08             	sub    $0x8,%esp
+  801afe:	53                   	push   %ebx
+  801aff:	6a 00                	push   $0x0
+  801b01:	e8 41 f1 ff ff       	call   800c47 <sys_page_unmap>
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	79 e4                	jns    801af1 <munmap+0x15>
+  801b0d:	eb 05                	jmp    801b14 <munmap+0x38>
+			return r;
+	return 0;
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b17:	5b                   	pop    %ebx
+  801b18:	5e                   	pop    %esi
+  801b19:	5d                   	pop    %ebp
+  801b1a:	c3                   	ret
+
+00801b1b <mmap>:
+{
+  801b1b:	55                   	push   %ebp
+  801b1c:	89 e5                	mov    %esp,%ebp
+  801b1e:	57                   	push   %edi
+  801b1f:	56                   	push   %esi
+  801b20:	53                   	push   %ebx
+  801b21:	83 ec 24             	sub    $0x24,%esp
+  801b24:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b27:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	ff 75 08             	push   0x8(%ebp)
+  801b2e:	e8 9a f5 ff ff       	call   8010cd <fd_lookup>
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	0f 88 37 01 00 00    	js     801c75 <mmap+0x15a>
+		return NULL;
+  801b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b43:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b46:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b4c:	39 0a                	cmp    %ecx,(%edx)
+  801b4e:	0f 85 05 01 00 00    	jne    801c59 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801b54:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801b5b:	0f 85 1b 01 00 00    	jne    801c7c <mmap+0x161>
+  801b61:	89 f0                	mov    %esi,%eax
+  801b63:	83 e8 01             	sub    $0x1,%eax
+  801b66:	0f 88 17 01 00 00    	js     801c83 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801b6c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801b70:	75 28                	jne    801b9a <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801b72:	83 ec 0c             	sub    $0xc,%esp
+  801b75:	68 04 60 80 00       	push   $0x806004
+  801b7a:	e8 8f 16 00 00       	call   80320e <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801b7f:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801b85:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801b8b:	83 c4 10             	add    $0x10,%esp
+  801b8e:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801b93:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801b98:	eb 2b                	jmp    801bc5 <mmap+0xaa>
+		cow_enable();
+  801b9a:	e8 3a 22 00 00       	call   803dd9 <cow_enable>
+  801b9f:	eb d1                	jmp    801b72 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801ba1:	89 c2                	mov    %eax,%edx
+  801ba3:	c1 ea 0c             	shr    $0xc,%edx
+  801ba6:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801bad:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bb3:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801bb9:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801bbc:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801bbe:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801bc3:	77 25                	ja     801bea <mmap+0xcf>
+  801bc5:	89 c2                	mov    %eax,%edx
+  801bc7:	29 da                	sub    %ebx,%edx
+  801bc9:	39 ca                	cmp    %ecx,%edx
+  801bcb:	73 3a                	jae    801c07 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801bcd:	89 c2                	mov    %eax,%edx
+  801bcf:	c1 ea 16             	shr    $0x16,%edx
+  801bd2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bd9:	f6 c2 01             	test   $0x1,%dl
+  801bdc:	75 c3                	jne    801ba1 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801bde:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801be3:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801be8:	eb d4                	jmp    801bbe <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801bea:	29 d8                	sub    %ebx,%eax
+  801bec:	39 c8                	cmp    %ecx,%eax
+  801bee:	73 17                	jae    801c07 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801bf0:	83 ec 0c             	sub    $0xc,%esp
+  801bf3:	68 04 60 80 00       	push   $0x806004
+  801bf8:	e8 7e 16 00 00       	call   80327b <mutex_unlock>
+		return NULL;
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c05:	eb 52                	jmp    801c59 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c07:	85 db                	test   %ebx,%ebx
+  801c09:	74 e5                	je     801bf0 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c11:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801c16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c19:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801c1e:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801c24:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801c2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c2d:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c37:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c3c:	e8 46 fa ff ff       	call   801687 <fsipc>
+  801c41:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+  801c46:	68 04 60 80 00       	push   $0x806004
+  801c4b:	e8 2b 16 00 00       	call   80327b <mutex_unlock>
+	if (r < 0) {
+  801c50:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801c53:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801c55:	85 ff                	test   %edi,%edi
+  801c57:	78 08                	js     801c61 <mmap+0x146>
+}
+  801c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5c:	5b                   	pop    %ebx
+  801c5d:	5e                   	pop    %esi
+  801c5e:	5f                   	pop    %edi
+  801c5f:	5d                   	pop    %ebp
+  801c60:	c3                   	ret
+		munmap((void*) va, len);
+  801c61:	83 ec 08             	sub    $0x8,%esp
+  801c64:	56                   	push   %esi
+  801c65:	53                   	push   %ebx
+  801c66:	e8 71 fe ff ff       	call   801adc <munmap>
+		return NULL;
+  801c6b:	83 c4 10             	add    $0x10,%esp
+  801c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c73:	eb e4                	jmp    801c59 <mmap+0x13e>
+		return NULL;
+  801c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7a:	eb dd                	jmp    801c59 <mmap+0x13e>
+		return NULL;
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	eb d6                	jmp    801c59 <mmap+0x13e>
+  801c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c88:	eb cf                	jmp    801c59 <mmap+0x13e>
+
+00801c8a <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	53                   	push   %ebx
+  801c8e:	83 ec 10             	sub    $0x10,%esp
+  801c91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801c94:	53                   	push   %ebx
+  801c95:	e8 9b ea ff ff       	call   800735 <strlen>
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ca2:	7f 42                	jg     801ce6 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801ca4:	83 ec 0c             	sub    $0xc,%esp
+  801ca7:	68 04 60 80 00       	push   $0x806004
+  801cac:	e8 5d 15 00 00       	call   80320e <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801cb1:	83 c4 08             	add    $0x8,%esp
+  801cb4:	53                   	push   %ebx
+  801cb5:	68 00 70 80 00       	push   $0x807000
+  801cba:	e8 b1 ea ff ff       	call   800770 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cc9:	e8 b9 f9 ff ff       	call   801687 <fsipc>
+  801cce:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cd0:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801cd7:	e8 9f 15 00 00       	call   80327b <mutex_unlock>
+	return r;
+  801cdc:	83 c4 10             	add    $0x10,%esp
+}
+  801cdf:	89 d8                	mov    %ebx,%eax
+  801ce1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce4:	c9                   	leave
+  801ce5:	c3                   	ret
+		return -E_BAD_PATH;
+  801ce6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ceb:	eb f2                	jmp    801cdf <remove+0x55>
+
+00801ced <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ced:	55                   	push   %ebp
+  801cee:	89 e5                	mov    %esp,%ebp
+  801cf0:	53                   	push   %ebx
+  801cf1:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801cf4:	68 04 60 80 00       	push   $0x806004
+  801cf9:	e8 10 15 00 00       	call   80320e <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d03:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d08:	e8 7a f9 ff ff       	call   801687 <fsipc>
+  801d0d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d0f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d16:	e8 60 15 00 00       	call   80327b <mutex_unlock>
+	return r;
+}
+  801d1b:	89 d8                	mov    %ebx,%eax
+  801d1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d20:	c9                   	leave
+  801d21:	c3                   	ret
+
+00801d22 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	56                   	push   %esi
+  801d26:	53                   	push   %ebx
+  801d27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d2a:	83 ec 0c             	sub    $0xc,%esp
+  801d2d:	68 04 60 80 00       	push   $0x806004
+  801d32:	e8 d7 14 00 00       	call   80320e <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801d3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d49:	e8 39 f9 ff ff       	call   801687 <fsipc>
+  801d4e:	89 c6                	mov    %eax,%esi
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	85 db                	test   %ebx,%ebx
+  801d55:	74 7b                	je     801dd2 <fs_bcstat+0xb0>
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 77                	js     801dd2 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801d5b:	a1 00 70 80 00       	mov    0x807000,%eax
+  801d60:	89 03                	mov    %eax,(%ebx)
+  801d62:	a1 04 70 80 00       	mov    0x807004,%eax
+  801d67:	89 43 04             	mov    %eax,0x4(%ebx)
+  801d6a:	a1 08 70 80 00       	mov    0x807008,%eax
+  801d6f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801d72:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801d77:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801d7a:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d7f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801d82:	a1 14 70 80 00       	mov    0x807014,%eax
+  801d87:	89 43 14             	mov    %eax,0x14(%ebx)
+  801d8a:	a1 18 70 80 00       	mov    0x807018,%eax
+  801d8f:	89 43 18             	mov    %eax,0x18(%ebx)
+  801d92:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801d97:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801d9a:	a1 20 70 80 00       	mov    0x807020,%eax
+  801d9f:	89 43 20             	mov    %eax,0x20(%ebx)
+  801da2:	a1 24 70 80 00       	mov    0x807024,%eax
+  801da7:	89 43 24             	mov    %eax,0x24(%ebx)
+  801daa:	a1 28 70 80 00       	mov    0x807028,%eax
+  801daf:	89 43 28             	mov    %eax,0x28(%ebx)
+  801db2:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801db7:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801dba:	a1 30 70 80 00       	mov    0x807030,%eax
+  801dbf:	89 43 30             	mov    %eax,0x30(%ebx)
+  801dc2:	a1 34 70 80 00       	mov    0x807034,%eax
+  801dc7:	89 43 34             	mov    %eax,0x34(%ebx)
+  801dca:	a1 38 70 80 00       	mov    0x807038,%eax
+  801dcf:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801dd2:	83 ec 0c             	sub    $0xc,%esp
+  801dd5:	68 04 60 80 00       	push   $0x806004
+  801dda:	e8 9c 14 00 00       	call   80327b <mutex_unlock>
+	return r;
+}
+  801ddf:	89 f0                	mov    %esi,%eax
+  801de1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de4:	5b                   	pop    %ebx
+  801de5:	5e                   	pop    %esi
+  801de6:	5d                   	pop    %ebp
+  801de7:	c3                   	ret
+
+00801de8 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	56                   	push   %esi
+  801dec:	53                   	push   %ebx
+  801ded:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801def:	0f b6 10             	movzbl (%eax),%edx
+  801df2:	80 fa 72             	cmp    $0x72,%dl
+  801df5:	74 44                	je     801e3b <parse_mode+0x53>
+  801df7:	80 fa 77             	cmp    $0x77,%dl
+  801dfa:	74 4b                	je     801e47 <parse_mode+0x5f>
+  801dfc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e01:	80 fa 61             	cmp    $0x61,%dl
+  801e04:	74 09                	je     801e0f <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801e06:	89 d8                	mov    %ebx,%eax
+  801e08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e0b:	5b                   	pop    %ebx
+  801e0c:	5e                   	pop    %esi
+  801e0d:	5d                   	pop    %ebp
+  801e0e:	c3                   	ret
+	switch (mode[0]) {
+  801e0f:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801e14:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801e19:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801e1b:	83 ec 08             	sub    $0x8,%esp
+  801e1e:	6a 2b                	push   $0x2b
+  801e20:	50                   	push   %eax
+  801e21:	e8 5c ea ff ff       	call   800882 <strchr>
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	74 d9                	je     801e06 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801e2d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801e30:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801e33:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801e39:	eb cb                	jmp    801e06 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801e3b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e45:	eb d2                	jmp    801e19 <parse_mode+0x31>
+  801e47:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801e4c:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801e51:	eb c6                	jmp    801e19 <parse_mode+0x31>
+
+00801e53 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	57                   	push   %edi
+  801e57:	56                   	push   %esi
+  801e58:	53                   	push   %ebx
+  801e59:	83 ec 1c             	sub    $0x1c,%esp
+  801e5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e5f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e62:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801e6c:	83 c0 24             	add    $0x24,%eax
+  801e6f:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801e73:	74 17                	je     801e8c <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e75:	83 c3 01             	add    $0x1,%ebx
+  801e78:	83 fb 10             	cmp    $0x10,%ebx
+  801e7b:	75 ef                	jne    801e6c <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801e7d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801e82:	89 f0                	mov    %esi,%eax
+  801e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801e8c:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801e93:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e96:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801e99:	c1 e7 02             	shl    $0x2,%edi
+  801e9c:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801ea2:	83 ec 04             	sub    $0x4,%esp
+  801ea5:	6a 24                	push   $0x24
+  801ea7:	6a 00                	push   $0x0
+  801ea9:	56                   	push   %esi
+  801eaa:	e8 12 ea ff ff       	call   8008c1 <memset>
+			streams[i].f_fd = fd;
+  801eaf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801eb2:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801eb8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801ebb:	01 d8                	add    %ebx,%eax
+  801ebd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ec0:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	eb b6                	jmp    801e82 <stream_alloc+0x2f>
+
+00801ecc <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	53                   	push   %ebx
+  801ed0:	83 ec 14             	sub    $0x14,%esp
+  801ed3:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801ed5:	8b 40 18             	mov    0x18(%eax),%eax
+  801ed8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801edb:	74 4a                	je     801f27 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801edd:	83 ec 08             	sub    $0x8,%esp
+  801ee0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ee3:	50                   	push   %eax
+  801ee4:	ff 33                	push   (%ebx)
+  801ee6:	e8 e2 f1 ff ff       	call   8010cd <fd_lookup>
+  801eeb:	89 c2                	mov    %eax,%edx
+  801eed:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ef5:	85 d2                	test   %edx,%edx
+  801ef7:	78 41                	js     801f3a <stream_unread+0x6e>
+  801ef9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801efc:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801f02:	39 0a                	cmp    %ecx,(%edx)
+  801f04:	75 34                	jne    801f3a <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801f06:	8b 43 14             	mov    0x14(%ebx),%eax
+  801f09:	03 42 04             	add    0x4(%edx),%eax
+  801f0c:	2b 43 18             	sub    0x18(%ebx),%eax
+  801f0f:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801f12:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f19:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f25:	eb 13                	jmp    801f3a <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801f27:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f2e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801f35:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+
+00801f3f <stream_drain>:
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	56                   	push   %esi
+  801f43:	53                   	push   %ebx
+  801f44:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801f46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f4b:	eb 02                	jmp    801f4f <stream_drain+0x10>
+  801f4d:	01 c3                	add    %eax,%ebx
+  801f4f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f52:	39 c3                	cmp    %eax,%ebx
+  801f54:	73 43                	jae    801f99 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801f56:	83 ec 04             	sub    $0x4,%esp
+  801f59:	29 d8                	sub    %ebx,%eax
+  801f5b:	50                   	push   %eax
+  801f5c:	89 d8                	mov    %ebx,%eax
+  801f5e:	03 46 0c             	add    0xc(%esi),%eax
+  801f61:	50                   	push   %eax
+  801f62:	ff 36                	push   (%esi)
+  801f64:	e8 ec f4 ff ff       	call   801455 <write>
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	7f dd                	jg     801f4d <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801f70:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801f74:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f77:	83 ec 04             	sub    $0x4,%esp
+  801f7a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f7d:	29 d8                	sub    %ebx,%eax
+  801f7f:	50                   	push   %eax
+  801f80:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  801f83:	50                   	push   %eax
+  801f84:	52                   	push   %edx
+  801f85:	e8 6c e9 ff ff       	call   8008f6 <memmove>
+			f->f_wend -= done;
+  801f8a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f8d:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801f97:	eb 0a                	jmp    801fa3 <stream_drain+0x64>
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  801f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  801fa3:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  801fa6:	89 d0                	mov    %edx,%eax
+  801fa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fab:	5b                   	pop    %ebx
+  801fac:	5e                   	pop    %esi
+  801fad:	5d                   	pop    %ebp
+  801fae:	c3                   	ret
+
+00801faf <stream_setup>:
+	if (f->f_buf)
+  801faf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801fb3:	74 01                	je     801fb6 <stream_setup+0x7>
+  801fb5:	c3                   	ret
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	53                   	push   %ebx
+  801fba:	83 ec 04             	sub    $0x4,%esp
+  801fbd:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801fbf:	8b 40 08             	mov    0x8(%eax),%eax
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	74 17                	je     801fdd <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801fc6:	83 f8 03             	cmp    $0x3,%eax
+  801fc9:	75 2d                	jne    801ff8 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801fcb:	8d 43 20             	lea    0x20(%ebx),%eax
+  801fce:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801fd1:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801fd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fdb:	c9                   	leave
+  801fdc:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801fdd:	83 ec 0c             	sub    $0xc,%esp
+  801fe0:	ff 33                	push   (%ebx)
+  801fe2:	e8 29 1b 00 00       	call   803b10 <iscons>
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	0f 9f c0             	setg   %al
+  801fef:	0f b6 c0             	movzbl %al,%eax
+  801ff2:	83 c0 01             	add    $0x1,%eax
+  801ff5:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801ff8:	83 ec 0c             	sub    $0xc,%esp
+  801ffb:	68 00 10 00 00       	push   $0x1000
+  802000:	e8 6e 0b 00 00       	call   802b73 <malloc>
+  802005:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	85 c0                	test   %eax,%eax
+  80200d:	74 bc                	je     801fcb <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80200f:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802016:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80201a:	eb bc                	jmp    801fd8 <stream_setup+0x29>
+
+0080201c <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	53                   	push   %ebx
+  802020:	83 ec 04             	sub    $0x4,%esp
+  802023:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802025:	e8 85 ff ff ff       	call   801faf <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80202f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802033:	74 3d                	je     802072 <stream_fill+0x56>
+  802035:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802039:	74 10                	je     80204b <stream_fill+0x2f>
+  80203b:	89 d8                	mov    %ebx,%eax
+  80203d:	e8 fd fe ff ff       	call   801f3f <stream_drain>
+		return 0;
+  802042:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 27                	js     802072 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80204b:	83 ec 04             	sub    $0x4,%esp
+  80204e:	ff 73 10             	push   0x10(%ebx)
+  802051:	ff 73 0c             	push   0xc(%ebx)
+  802054:	ff 33                	push   (%ebx)
+  802056:	e8 02 f3 ff ff       	call   80135d <read>
+  80205b:	83 c4 10             	add    $0x10,%esp
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	7e 17                	jle    802079 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802062:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802066:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80206d:	89 c2                	mov    %eax,%edx
+  80206f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802072:	89 d0                	mov    %edx,%eax
+  802074:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802079:	c1 f8 1f             	sar    $0x1f,%eax
+  80207c:	83 e0 04             	and    $0x4,%eax
+  80207f:	83 c0 04             	add    $0x4,%eax
+  802082:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208a:	eb e6                	jmp    802072 <stream_fill+0x56>
+
+0080208c <fopen>:
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	57                   	push   %edi
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802098:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80209b:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8020a1:	89 f0                	mov    %esi,%eax
+  8020a3:	e8 40 fd ff ff       	call   801de8 <parse_mode>
+		return 0;
+  8020a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	78 2d                	js     8020de <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8020b1:	83 ec 08             	sub    $0x8,%esp
+  8020b4:	50                   	push   %eax
+  8020b5:	ff 75 08             	push   0x8(%ebp)
+  8020b8:	e8 e8 f8 ff ff       	call   8019a5 <open>
+  8020bd:	89 c7                	mov    %eax,%edi
+  8020bf:	83 c4 10             	add    $0x10,%esp
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 58                	js     80211e <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020c6:	80 3e 61             	cmpb   $0x61,(%esi)
+  8020c9:	74 1d                	je     8020e8 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8020cb:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8020d1:	89 f8                	mov    %edi,%eax
+  8020d3:	e8 7b fd ff ff       	call   801e53 <stream_alloc>
+  8020d8:	89 c3                	mov    %eax,%ebx
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	74 32                	je     802110 <fopen+0x84>
+}
+  8020de:	89 d8                	mov    %ebx,%eax
+  8020e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e3:	5b                   	pop    %ebx
+  8020e4:	5e                   	pop    %esi
+  8020e5:	5f                   	pop    %edi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020e8:	83 ec 08             	sub    $0x8,%esp
+  8020eb:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8020f1:	50                   	push   %eax
+  8020f2:	57                   	push   %edi
+  8020f3:	e8 db f4 ff ff       	call   8015d3 <fstat>
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 cc                	js     8020cb <fopen+0x3f>
+		seek(fd, st.st_size);
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	ff 75 dc             	push   -0x24(%ebp)
+  802105:	57                   	push   %edi
+  802106:	e8 f6 f3 ff ff       	call   801501 <seek>
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	eb bb                	jmp    8020cb <fopen+0x3f>
+		close(fd);
+  802110:	83 ec 0c             	sub    $0xc,%esp
+  802113:	57                   	push   %edi
+  802114:	e8 08 f1 ff ff       	call   801221 <close>
+  802119:	83 c4 10             	add    $0x10,%esp
+  80211c:	eb c0                	jmp    8020de <fopen+0x52>
+		return 0;
+  80211e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802123:	eb b9                	jmp    8020de <fopen+0x52>
+
+00802125 <fdopen>:
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80212b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80212e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802131:	e8 b2 fc ff ff       	call   801de8 <parse_mode>
+  802136:	89 c2                	mov    %eax,%edx
+		return 0;
+  802138:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80213d:	85 d2                	test   %edx,%edx
+  80213f:	78 0b                	js     80214c <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802141:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802144:	8b 45 08             	mov    0x8(%ebp),%eax
+  802147:	e8 07 fd ff ff       	call   801e53 <stream_alloc>
+}
+  80214c:	c9                   	leave
+  80214d:	c3                   	ret
+
+0080214e <setvbuf>:
+{
+  80214e:	55                   	push   %ebp
+  80214f:	89 e5                	mov    %esp,%ebp
+  802151:	57                   	push   %edi
+  802152:	56                   	push   %esi
+  802153:	53                   	push   %ebx
+  802154:	8b 45 08             	mov    0x8(%ebp),%eax
+  802157:	8b 55 10             	mov    0x10(%ebp),%edx
+  80215a:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80215d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802161:	75 3a                	jne    80219d <setvbuf+0x4f>
+  802163:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802166:	83 fe 02             	cmp    $0x2,%esi
+  802169:	77 39                	ja     8021a4 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80216b:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80216e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802172:	0f 95 c3             	setne  %bl
+  802175:	85 ff                	test   %edi,%edi
+  802177:	0f 95 c1             	setne  %cl
+  80217a:	84 cb                	test   %cl,%bl
+  80217c:	74 05                	je     802183 <setvbuf+0x35>
+  80217e:	83 fa 03             	cmp    $0x3,%edx
+  802181:	75 0a                	jne    80218d <setvbuf+0x3f>
+	return 0;
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802188:	5b                   	pop    %ebx
+  802189:	5e                   	pop    %esi
+  80218a:	5f                   	pop    %edi
+  80218b:	5d                   	pop    %ebp
+  80218c:	c3                   	ret
+		f->f_buf = buf;
+  80218d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802190:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802193:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219b:	eb eb                	jmp    802188 <setvbuf+0x3a>
+		return EOF;
+  80219d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021a2:	eb e4                	jmp    802188 <setvbuf+0x3a>
+  8021a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021a9:	eb dd                	jmp    802188 <setvbuf+0x3a>
+
+008021ab <fflush>:
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	57                   	push   %edi
+  8021af:	56                   	push   %esi
+  8021b0:	53                   	push   %ebx
+  8021b1:	83 ec 0c             	sub    $0xc,%esp
+  8021b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8021b7:	85 db                	test   %ebx,%ebx
+  8021b9:	74 1a                	je     8021d5 <fflush+0x2a>
+	stream_unread(f);
+  8021bb:	89 d8                	mov    %ebx,%eax
+  8021bd:	e8 0a fd ff ff       	call   801ecc <stream_unread>
+	return stream_drain(f);
+  8021c2:	89 d8                	mov    %ebx,%eax
+  8021c4:	e8 76 fd ff ff       	call   801f3f <stream_drain>
+  8021c9:	89 c7                	mov    %eax,%edi
+}
+  8021cb:	89 f8                	mov    %edi,%eax
+  8021cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d0:	5b                   	pop    %ebx
+  8021d1:	5e                   	pop    %esi
+  8021d2:	5f                   	pop    %edi
+  8021d3:	5d                   	pop    %ebp
+  8021d4:	c3                   	ret
+  8021d5:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8021da:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8021df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021e4:	eb 03                	jmp    8021e9 <fflush+0x3e>
+  8021e6:	83 c3 24             	add    $0x24,%ebx
+  8021e9:	39 f3                	cmp    %esi,%ebx
+  8021eb:	74 de                	je     8021cb <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8021ed:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8021f1:	74 f3                	je     8021e6 <fflush+0x3b>
+  8021f3:	83 ec 0c             	sub    $0xc,%esp
+  8021f6:	53                   	push   %ebx
+  8021f7:	e8 af ff ff ff       	call   8021ab <fflush>
+  8021fc:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8021ff:	85 c0                	test   %eax,%eax
+  802201:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802206:	0f 48 f8             	cmovs  %eax,%edi
+  802209:	eb db                	jmp    8021e6 <fflush+0x3b>
+
+0080220b <fclose>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	56                   	push   %esi
+  80220f:	53                   	push   %ebx
+  802210:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802213:	83 ec 0c             	sub    $0xc,%esp
+  802216:	56                   	push   %esi
+  802217:	e8 8f ff ff ff       	call   8021ab <fflush>
+  80221c:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80221e:	83 c4 04             	add    $0x4,%esp
+  802221:	ff 36                	push   (%esi)
+  802223:	e8 f9 ef ff ff       	call   801221 <close>
+  802228:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802232:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802235:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802239:	75 10                	jne    80224b <fclose+0x40>
+	f->f_flags = 0;
+  80223b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802242:	89 d8                	mov    %ebx,%eax
+  802244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802247:	5b                   	pop    %ebx
+  802248:	5e                   	pop    %esi
+  802249:	5d                   	pop    %ebp
+  80224a:	c3                   	ret
+		free(f->f_buf);
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	ff 76 0c             	push   0xc(%esi)
+  802251:	e8 54 08 00 00       	call   802aaa <free>
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	eb e0                	jmp    80223b <fclose+0x30>
+
+0080225b <fileno>:
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	8b 00                	mov    (%eax),%eax
+}
+  802263:	5d                   	pop    %ebp
+  802264:	c3                   	ret
+
+00802265 <feof>:
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802268:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226b:	8b 40 04             	mov    0x4(%eax),%eax
+  80226e:	c1 e8 02             	shr    $0x2,%eax
+  802271:	83 e0 01             	and    $0x1,%eax
+}
+  802274:	5d                   	pop    %ebp
+  802275:	c3                   	ret
+
+00802276 <ferror>:
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227c:	8b 40 04             	mov    0x4(%eax),%eax
+  80227f:	c1 e8 03             	shr    $0x3,%eax
+  802282:	83 e0 01             	and    $0x1,%eax
+}
+  802285:	5d                   	pop    %ebp
+  802286:	c3                   	ret
+
+00802287 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	53                   	push   %ebx
+  80228b:	83 ec 04             	sub    $0x4,%esp
+  80228e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802291:	8b 43 18             	mov    0x18(%ebx),%eax
+  802294:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802297:	74 15                	je     8022ae <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802299:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80229c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80229f:	8d 48 01             	lea    0x1(%eax),%ecx
+  8022a2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8022a5:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8022a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022ae:	89 d8                	mov    %ebx,%eax
+  8022b0:	e8 67 fd ff ff       	call   80201c <stream_fill>
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	75 e0                	jne    802299 <fgetc+0x12>
+		return EOF;
+  8022b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022be:	eb e9                	jmp    8022a9 <fgetc+0x22>
+
+008022c0 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	57                   	push   %edi
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+  8022c6:	83 ec 1c             	sub    $0x1c,%esp
+  8022c9:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8022cc:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d4:	83 e8 01             	sub    $0x1,%eax
+  8022d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8022da:	eb 66                	jmp    802342 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022dc:	8b 46 14             	mov    0x14(%esi),%eax
+  8022df:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8022e2:	29 c3                	sub    %eax,%ebx
+  8022e4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8022e7:	29 fa                	sub    %edi,%edx
+  8022e9:	39 d3                	cmp    %edx,%ebx
+  8022eb:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8022ee:	83 ec 04             	sub    $0x4,%esp
+  8022f1:	53                   	push   %ebx
+  8022f2:	6a 0a                	push   $0xa
+  8022f4:	03 46 0c             	add    0xc(%esi),%eax
+  8022f7:	50                   	push   %eax
+  8022f8:	e8 aa e6 ff ff       	call   8009a7 <memfind>
+  8022fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802300:	8b 46 0c             	mov    0xc(%esi),%eax
+  802303:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802306:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802309:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80230b:	83 c4 10             	add    $0x10,%esp
+  80230e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802311:	74 0b                	je     80231e <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802313:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802316:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802319:	29 d3                	sub    %edx,%ebx
+  80231b:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80231e:	83 ec 04             	sub    $0x4,%esp
+  802321:	53                   	push   %ebx
+  802322:	01 c8                	add    %ecx,%eax
+  802324:	50                   	push   %eax
+  802325:	89 f8                	mov    %edi,%eax
+  802327:	03 45 08             	add    0x8(%ebp),%eax
+  80232a:	50                   	push   %eax
+  80232b:	e8 c6 e5 ff ff       	call   8008f6 <memmove>
+		f->f_rpos += m;
+  802330:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802333:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233b:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802340:	74 1f                	je     802361 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802342:	8d 47 01             	lea    0x1(%edi),%eax
+  802345:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802348:	73 17                	jae    802361 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80234a:	8b 46 18             	mov    0x18(%esi),%eax
+  80234d:	39 46 14             	cmp    %eax,0x14(%esi)
+  802350:	75 8a                	jne    8022dc <fgets+0x1c>
+  802352:	89 f0                	mov    %esi,%eax
+  802354:	e8 c3 fc ff ff       	call   80201c <stream_fill>
+  802359:	85 c0                	test   %eax,%eax
+  80235b:	0f 85 7b ff ff ff    	jne    8022dc <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802361:	85 ff                	test   %edi,%edi
+  802363:	74 0f                	je     802374 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802365:	8b 45 08             	mov    0x8(%ebp),%eax
+  802368:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80236c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236f:	5b                   	pop    %ebx
+  802370:	5e                   	pop    %esi
+  802371:	5f                   	pop    %edi
+  802372:	5d                   	pop    %ebp
+  802373:	c3                   	ret
+		return 0;
+  802374:	b8 00 00 00 00       	mov    $0x0,%eax
+  802379:	eb f1                	jmp    80236c <fgets+0xac>
+
+0080237b <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	57                   	push   %edi
+  80237f:	56                   	push   %esi
+  802380:	53                   	push   %ebx
+  802381:	83 ec 1c             	sub    $0x1c,%esp
+  802384:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802387:	89 f0                	mov    %esi,%eax
+  802389:	e8 21 fc ff ff       	call   801faf <stream_setup>
+	want = size * n;
+  80238e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802391:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802398:	bf 00 00 00 00       	mov    $0x0,%edi
+  80239d:	eb 43                	jmp    8023e2 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80239f:	29 d3                	sub    %edx,%ebx
+  8023a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023a4:	29 f8                	sub    %edi,%eax
+  8023a6:	39 c3                	cmp    %eax,%ebx
+  8023a8:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8023ab:	83 ec 04             	sub    $0x4,%esp
+  8023ae:	53                   	push   %ebx
+  8023af:	03 56 0c             	add    0xc(%esi),%edx
+  8023b2:	52                   	push   %edx
+  8023b3:	89 f8                	mov    %edi,%eax
+  8023b5:	03 45 08             	add    0x8(%ebp),%eax
+  8023b8:	50                   	push   %eax
+  8023b9:	e8 38 e5 ff ff       	call   8008f6 <memmove>
+			f->f_rpos += m;
+  8023be:	01 5e 14             	add    %ebx,0x14(%esi)
+  8023c1:	83 c4 10             	add    $0x10,%esp
+  8023c4:	eb 1a                	jmp    8023e0 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8023c6:	83 ec 04             	sub    $0x4,%esp
+  8023c9:	53                   	push   %ebx
+  8023ca:	89 f8                	mov    %edi,%eax
+  8023cc:	03 45 08             	add    0x8(%ebp),%eax
+  8023cf:	50                   	push   %eax
+  8023d0:	ff 36                	push   (%esi)
+  8023d2:	e8 86 ef ff ff       	call   80135d <read>
+  8023d7:	89 c3                	mov    %eax,%ebx
+  8023d9:	83 c4 10             	add    $0x10,%esp
+  8023dc:	85 c0                	test   %eax,%eax
+  8023de:	7e 36                	jle    802416 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8023e0:	01 df                	add    %ebx,%edi
+  8023e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023e5:	39 c7                	cmp    %eax,%edi
+  8023e7:	73 39                	jae    802422 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8023e9:	8b 56 14             	mov    0x14(%esi),%edx
+  8023ec:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023ef:	39 da                	cmp    %ebx,%edx
+  8023f1:	72 ac                	jb     80239f <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8023f3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023f6:	29 fb                	sub    %edi,%ebx
+  8023f8:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8023fb:	72 3e                	jb     80243b <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8023fd:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802401:	74 1f                	je     802422 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802403:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802407:	74 bd                	je     8023c6 <fread+0x4b>
+  802409:	89 f0                	mov    %esi,%eax
+  80240b:	e8 2f fb ff ff       	call   801f3f <stream_drain>
+  802410:	85 c0                	test   %eax,%eax
+  802412:	79 b2                	jns    8023c6 <fread+0x4b>
+  802414:	eb 0c                	jmp    802422 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802416:	c1 fb 1f             	sar    $0x1f,%ebx
+  802419:	83 e3 04             	and    $0x4,%ebx
+  80241c:	83 c3 04             	add    $0x4,%ebx
+  80241f:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802422:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802425:	85 c0                	test   %eax,%eax
+  802427:	74 0a                	je     802433 <fread+0xb8>
+  802429:	89 f8                	mov    %edi,%eax
+  80242b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802430:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802436:	5b                   	pop    %ebx
+  802437:	5e                   	pop    %esi
+  802438:	5f                   	pop    %edi
+  802439:	5d                   	pop    %ebp
+  80243a:	c3                   	ret
+		} else if (!stream_fill(f))
+  80243b:	89 f0                	mov    %esi,%eax
+  80243d:	e8 da fb ff ff       	call   80201c <stream_fill>
+  802442:	85 c0                	test   %eax,%eax
+  802444:	74 dc                	je     802422 <fread+0xa7>
+			m = 0;
+  802446:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80244b:	eb 93                	jmp    8023e0 <fread+0x65>
+
+0080244d <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80244d:	55                   	push   %ebp
+  80244e:	89 e5                	mov    %esp,%ebp
+  802450:	57                   	push   %edi
+  802451:	56                   	push   %esi
+  802452:	53                   	push   %ebx
+  802453:	83 ec 1c             	sub    $0x1c,%esp
+  802456:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802459:	8b 43 04             	mov    0x4(%ebx),%eax
+  80245c:	a8 02                	test   $0x2,%al
+  80245e:	75 13                	jne    802473 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802460:	83 c8 08             	or     $0x8,%eax
+  802463:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802466:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80246b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246e:	5b                   	pop    %ebx
+  80246f:	5e                   	pop    %esi
+  802470:	5f                   	pop    %edi
+  802471:	5d                   	pop    %ebp
+  802472:	c3                   	ret
+	stream_setup(f);
+  802473:	89 d8                	mov    %ebx,%eax
+  802475:	e8 35 fb ff ff       	call   801faf <stream_setup>
+	want = size * n;
+  80247a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802481:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802484:	89 d8                	mov    %ebx,%eax
+  802486:	e8 41 fa ff ff       	call   801ecc <stream_unread>
+	for (done = 0; done < want; ) {
+  80248b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802490:	84 c0                	test   %al,%al
+  802492:	75 7b                	jne    80250f <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802494:	be 00 00 00 00       	mov    $0x0,%esi
+  802499:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80249c:	39 fe                	cmp    %edi,%esi
+  80249e:	73 24                	jae    8024c4 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8024a0:	83 ec 04             	sub    $0x4,%esp
+  8024a3:	89 f8                	mov    %edi,%eax
+  8024a5:	29 f0                	sub    %esi,%eax
+  8024a7:	50                   	push   %eax
+  8024a8:	89 f0                	mov    %esi,%eax
+  8024aa:	03 45 08             	add    0x8(%ebp),%eax
+  8024ad:	50                   	push   %eax
+  8024ae:	ff 33                	push   (%ebx)
+  8024b0:	e8 a0 ef ff ff       	call   801455 <write>
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	7e 04                	jle    8024c0 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8024bc:	01 c6                	add    %eax,%esi
+  8024be:	eb dc                	jmp    80249c <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8024c0:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8024c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	74 a0                	je     80246b <fwrite+0x1e>
+  8024cb:	89 f0                	mov    %esi,%eax
+  8024cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d2:	f7 75 0c             	divl   0xc(%ebp)
+  8024d5:	eb 94                	jmp    80246b <fwrite+0x1e>
+			done += r;
+  8024d7:	01 c7                	add    %eax,%edi
+			continue;
+  8024d9:	eb 34                	jmp    80250f <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8024db:	8b 73 10             	mov    0x10(%ebx),%esi
+  8024de:	29 c6                	sub    %eax,%esi
+  8024e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024e3:	29 fa                	sub    %edi,%edx
+  8024e5:	39 d6                	cmp    %edx,%esi
+  8024e7:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8024ea:	83 ec 04             	sub    $0x4,%esp
+  8024ed:	56                   	push   %esi
+  8024ee:	89 fa                	mov    %edi,%edx
+  8024f0:	03 55 08             	add    0x8(%ebp),%edx
+  8024f3:	52                   	push   %edx
+  8024f4:	03 43 0c             	add    0xc(%ebx),%eax
+  8024f7:	50                   	push   %eax
+  8024f8:	e8 f9 e3 ff ff       	call   8008f6 <memmove>
+		f->f_wend += m;
+  8024fd:	89 f0                	mov    %esi,%eax
+  8024ff:	03 43 1c             	add    0x1c(%ebx),%eax
+  802502:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802505:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80250d:	74 5b                	je     80256a <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80250f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802512:	39 c7                	cmp    %eax,%edi
+  802514:	73 2d                	jae    802543 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802516:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	75 be                	jne    8024db <fwrite+0x8e>
+  80251d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802520:	29 fa                	sub    %edi,%edx
+  802522:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802525:	72 b4                	jb     8024db <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802527:	83 ec 04             	sub    $0x4,%esp
+  80252a:	52                   	push   %edx
+  80252b:	89 f8                	mov    %edi,%eax
+  80252d:	03 45 08             	add    0x8(%ebp),%eax
+  802530:	50                   	push   %eax
+  802531:	ff 33                	push   (%ebx)
+  802533:	e8 1d ef ff ff       	call   801455 <write>
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	7f 98                	jg     8024d7 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80253f:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802543:	8b 43 08             	mov    0x8(%ebx),%eax
+  802546:	83 f8 03             	cmp    $0x3,%eax
+  802549:	74 48                	je     802593 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80254b:	83 f8 02             	cmp    $0x2,%eax
+  80254e:	74 27                	je     802577 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802550:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802553:	85 c0                	test   %eax,%eax
+  802555:	0f 84 10 ff ff ff    	je     80246b <fwrite+0x1e>
+  80255b:	89 f8                	mov    %edi,%eax
+  80255d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802562:	f7 75 0c             	divl   0xc(%ebp)
+  802565:	e9 01 ff ff ff       	jmp    80246b <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80256a:	89 d8                	mov    %ebx,%eax
+  80256c:	e8 ce f9 ff ff       	call   801f3f <stream_drain>
+  802571:	85 c0                	test   %eax,%eax
+  802573:	79 9a                	jns    80250f <fwrite+0xc2>
+  802575:	eb cc                	jmp    802543 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802577:	83 ec 04             	sub    $0x4,%esp
+  80257a:	57                   	push   %edi
+  80257b:	6a 0a                	push   $0xa
+  80257d:	ff 75 08             	push   0x8(%ebp)
+  802580:	e8 22 e4 ff ff       	call   8009a7 <memfind>
+  802585:	89 c2                	mov    %eax,%edx
+  802587:	89 f8                	mov    %edi,%eax
+  802589:	03 45 08             	add    0x8(%ebp),%eax
+  80258c:	83 c4 10             	add    $0x10,%esp
+  80258f:	39 c2                	cmp    %eax,%edx
+  802591:	74 bd                	je     802550 <fwrite+0x103>
+		stream_drain(f);
+  802593:	89 d8                	mov    %ebx,%eax
+  802595:	e8 a5 f9 ff ff       	call   801f3f <stream_drain>
+  80259a:	eb b4                	jmp    802550 <fwrite+0x103>
+
+0080259c <fputc>:
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	53                   	push   %ebx
+  8025a0:	83 ec 14             	sub    $0x14,%esp
+  8025a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8025a6:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8025a9:	ff 75 0c             	push   0xc(%ebp)
+  8025ac:	6a 01                	push   $0x1
+  8025ae:	6a 01                	push   $0x1
+  8025b0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025b3:	50                   	push   %eax
+  8025b4:	e8 94 fe ff ff       	call   80244d <fwrite>
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	0f b6 db             	movzbl %bl,%ebx
+  8025bf:	83 f8 01             	cmp    $0x1,%eax
+  8025c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025c7:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8025ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cd:	c9                   	leave
+  8025ce:	c3                   	ret
+
+008025cf <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8025d5:	ff 75 0c             	push   0xc(%ebp)
+  8025d8:	ff 75 08             	push   0x8(%ebp)
+  8025db:	e8 bc ff ff ff       	call   80259c <fputc>
+}
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	c9                   	leave
+  8025e4:	c3                   	ret
+
+008025e5 <fputs>:
+{
+  8025e5:	55                   	push   %ebp
+  8025e6:	89 e5                	mov    %esp,%ebp
+  8025e8:	56                   	push   %esi
+  8025e9:	53                   	push   %ebx
+  8025ea:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8025ed:	83 ec 0c             	sub    $0xc,%esp
+  8025f0:	56                   	push   %esi
+  8025f1:	e8 3f e1 ff ff       	call   800735 <strlen>
+  8025f6:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8025f8:	ff 75 0c             	push   0xc(%ebp)
+  8025fb:	50                   	push   %eax
+  8025fc:	6a 01                	push   $0x1
+  8025fe:	56                   	push   %esi
+  8025ff:	e8 49 fe ff ff       	call   80244d <fwrite>
+  802604:	83 c4 20             	add    $0x20,%esp
+  802607:	39 d8                	cmp    %ebx,%eax
+  802609:	0f 95 c0             	setne  %al
+  80260c:	0f b6 c0             	movzbl %al,%eax
+  80260f:	f7 d8                	neg    %eax
+}
+  802611:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802614:	5b                   	pop    %ebx
+  802615:	5e                   	pop    %esi
+  802616:	5d                   	pop    %ebp
+  802617:	c3                   	ret
+
+00802618 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802618:	55                   	push   %ebp
+  802619:	89 e5                	mov    %esp,%ebp
+  80261b:	53                   	push   %ebx
+  80261c:	83 ec 04             	sub    $0x4,%esp
+  80261f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802622:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802625:	50                   	push   %eax
+  802626:	ff 75 0c             	push   0xc(%ebp)
+  802629:	53                   	push   %ebx
+  80262a:	68 cf 25 80 00       	push   $0x8025cf
+  80262f:	e8 4f dc ff ff       	call   800283 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802634:	8b 43 04             	mov    0x4(%ebx),%eax
+  802637:	c1 e0 1c             	shl    $0x1c,%eax
+  80263a:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80263d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802640:	c9                   	leave
+  802641:	c3                   	ret
+
+00802642 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802642:	55                   	push   %ebp
+  802643:	89 e5                	mov    %esp,%ebp
+  802645:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802648:	68 78 4b 80 00       	push   $0x804b78
+  80264d:	ff 75 0c             	push   0xc(%ebp)
+  802650:	e8 1b e1 ff ff       	call   800770 <strcpy>
+	return 0;
+}
+  802655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265a:	c9                   	leave
+  80265b:	c3                   	ret
+
+0080265c <devsock_close>:
+{
+  80265c:	55                   	push   %ebp
+  80265d:	89 e5                	mov    %esp,%ebp
+  80265f:	53                   	push   %ebx
+  802660:	83 ec 10             	sub    $0x10,%esp
+  802663:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802666:	53                   	push   %ebx
+  802667:	e8 69 1d 00 00       	call   8043d5 <pageref>
+  80266c:	89 c2                	mov    %eax,%edx
+  80266e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802671:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802676:	83 fa 01             	cmp    $0x1,%edx
+  802679:	74 05                	je     802680 <devsock_close+0x24>
+}
+  80267b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802680:	83 ec 0c             	sub    $0xc,%esp
+  802683:	ff 73 0c             	push   0xc(%ebx)
+  802686:	e8 b7 02 00 00       	call   802942 <nsipc_close>
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	eb eb                	jmp    80267b <devsock_close+0x1f>
+
+00802690 <devsock_write>:
+{
+  802690:	55                   	push   %ebp
+  802691:	89 e5                	mov    %esp,%ebp
+  802693:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802696:	6a 00                	push   $0x0
+  802698:	ff 75 10             	push   0x10(%ebp)
+  80269b:	ff 75 0c             	push   0xc(%ebp)
+  80269e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a1:	ff 70 0c             	push   0xc(%eax)
+  8026a4:	e8 79 03 00 00       	call   802a22 <nsipc_send>
+}
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+
+008026ab <devsock_read>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8026b1:	6a 00                	push   $0x0
+  8026b3:	ff 75 10             	push   0x10(%ebp)
+  8026b6:	ff 75 0c             	push   0xc(%ebp)
+  8026b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bc:	ff 70 0c             	push   0xc(%eax)
+  8026bf:	e8 ef 02 00 00       	call   8029b3 <nsipc_recv>
+}
+  8026c4:	c9                   	leave
+  8026c5:	c3                   	ret
+
+008026c6 <fd2sockid>:
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026cc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026cf:	52                   	push   %edx
+  8026d0:	50                   	push   %eax
+  8026d1:	e8 f7 e9 ff ff       	call   8010cd <fd_lookup>
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 10                	js     8026ed <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e0:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8026e6:	39 08                	cmp    %ecx,(%eax)
+  8026e8:	75 05                	jne    8026ef <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026ea:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026f4:	eb f7                	jmp    8026ed <fd2sockid+0x27>
+
+008026f6 <alloc_sockfd>:
+{
+  8026f6:	55                   	push   %ebp
+  8026f7:	89 e5                	mov    %esp,%ebp
+  8026f9:	56                   	push   %esi
+  8026fa:	53                   	push   %ebx
+  8026fb:	83 ec 1c             	sub    $0x1c,%esp
+  8026fe:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802700:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802703:	50                   	push   %eax
+  802704:	e8 6e e9 ff ff       	call   801077 <fd_alloc>
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	78 43                	js     802755 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802712:	83 ec 04             	sub    $0x4,%esp
+  802715:	68 07 04 00 00       	push   $0x407
+  80271a:	ff 75 f4             	push   -0xc(%ebp)
+  80271d:	6a 00                	push   $0x0
+  80271f:	e8 8a e4 ff ff       	call   800bae <sys_page_alloc>
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	78 28                	js     802755 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80272d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802730:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802736:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802742:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802745:	83 ec 0c             	sub    $0xc,%esp
+  802748:	50                   	push   %eax
+  802749:	e8 02 e9 ff ff       	call   801050 <fd2num>
+  80274e:	89 c3                	mov    %eax,%ebx
+  802750:	83 c4 10             	add    $0x10,%esp
+  802753:	eb 0c                	jmp    802761 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802755:	83 ec 0c             	sub    $0xc,%esp
+  802758:	56                   	push   %esi
+  802759:	e8 e4 01 00 00       	call   802942 <nsipc_close>
+		return r;
+  80275e:	83 c4 10             	add    $0x10,%esp
+}
+  802761:	89 d8                	mov    %ebx,%eax
+  802763:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5d                   	pop    %ebp
+  802769:	c3                   	ret
+
+0080276a <accept>:
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802770:	8b 45 08             	mov    0x8(%ebp),%eax
+  802773:	e8 4e ff ff ff       	call   8026c6 <fd2sockid>
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	78 1b                	js     802797 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80277c:	83 ec 04             	sub    $0x4,%esp
+  80277f:	ff 75 10             	push   0x10(%ebp)
+  802782:	ff 75 0c             	push   0xc(%ebp)
+  802785:	50                   	push   %eax
+  802786:	e8 0e 01 00 00       	call   802899 <nsipc_accept>
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 05                	js     802797 <accept+0x2d>
+	return alloc_sockfd(r);
+  802792:	e8 5f ff ff ff       	call   8026f6 <alloc_sockfd>
+}
+  802797:	c9                   	leave
+  802798:	c3                   	ret
+
+00802799 <bind>:
+{
+  802799:	55                   	push   %ebp
+  80279a:	89 e5                	mov    %esp,%ebp
+  80279c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80279f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a2:	e8 1f ff ff ff       	call   8026c6 <fd2sockid>
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	78 12                	js     8027bd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027ab:	83 ec 04             	sub    $0x4,%esp
+  8027ae:	ff 75 10             	push   0x10(%ebp)
+  8027b1:	ff 75 0c             	push   0xc(%ebp)
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 31 01 00 00       	call   8028eb <nsipc_bind>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+}
+  8027bd:	c9                   	leave
+  8027be:	c3                   	ret
+
+008027bf <shutdown>:
+{
+  8027bf:	55                   	push   %ebp
+  8027c0:	89 e5                	mov    %esp,%ebp
+  8027c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c8:	e8 f9 fe ff ff       	call   8026c6 <fd2sockid>
+  8027cd:	85 c0                	test   %eax,%eax
+  8027cf:	78 0f                	js     8027e0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027d1:	83 ec 08             	sub    $0x8,%esp
+  8027d4:	ff 75 0c             	push   0xc(%ebp)
+  8027d7:	50                   	push   %eax
+  8027d8:	e8 43 01 00 00       	call   802920 <nsipc_shutdown>
+  8027dd:	83 c4 10             	add    $0x10,%esp
+}
+  8027e0:	c9                   	leave
+  8027e1:	c3                   	ret
+
+008027e2 <connect>:
+{
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027eb:	e8 d6 fe ff ff       	call   8026c6 <fd2sockid>
+  8027f0:	85 c0                	test   %eax,%eax
+  8027f2:	78 12                	js     802806 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027f4:	83 ec 04             	sub    $0x4,%esp
+  8027f7:	ff 75 10             	push   0x10(%ebp)
+  8027fa:	ff 75 0c             	push   0xc(%ebp)
+  8027fd:	50                   	push   %eax
+  8027fe:	e8 59 01 00 00       	call   80295c <nsipc_connect>
+  802803:	83 c4 10             	add    $0x10,%esp
+}
+  802806:	c9                   	leave
+  802807:	c3                   	ret
+
+00802808 <listen>:
+{
+  802808:	55                   	push   %ebp
+  802809:	89 e5                	mov    %esp,%ebp
+  80280b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80280e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802811:	e8 b0 fe ff ff       	call   8026c6 <fd2sockid>
+  802816:	85 c0                	test   %eax,%eax
+  802818:	78 0f                	js     802829 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80281a:	83 ec 08             	sub    $0x8,%esp
+  80281d:	ff 75 0c             	push   0xc(%ebp)
+  802820:	50                   	push   %eax
+  802821:	e8 6b 01 00 00       	call   802991 <nsipc_listen>
+  802826:	83 c4 10             	add    $0x10,%esp
+}
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+
+0080282b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80282b:	55                   	push   %ebp
+  80282c:	89 e5                	mov    %esp,%ebp
+  80282e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802831:	ff 75 10             	push   0x10(%ebp)
+  802834:	ff 75 0c             	push   0xc(%ebp)
+  802837:	ff 75 08             	push   0x8(%ebp)
+  80283a:	e8 41 02 00 00       	call   802a80 <nsipc_socket>
+  80283f:	83 c4 10             	add    $0x10,%esp
+  802842:	85 c0                	test   %eax,%eax
+  802844:	78 05                	js     80284b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802846:	e8 ab fe ff ff       	call   8026f6 <alloc_sockfd>
+}
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+
+0080284d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80284d:	55                   	push   %ebp
+  80284e:	89 e5                	mov    %esp,%ebp
+  802850:	53                   	push   %ebx
+  802851:	83 ec 04             	sub    $0x4,%esp
+  802854:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802856:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80285d:	74 26                	je     802885 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80285f:	6a 07                	push   $0x7
+  802861:	68 00 80 80 00       	push   $0x808000
+  802866:	53                   	push   %ebx
+  802867:	ff 35 08 60 80 00    	push   0x806008
+  80286d:	e8 ce 1a 00 00       	call   804340 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802872:	83 c4 0c             	add    $0xc,%esp
+  802875:	6a 00                	push   $0x0
+  802877:	6a 00                	push   $0x0
+  802879:	6a 00                	push   $0x0
+  80287b:	e8 ca 19 00 00       	call   80424a <ipc_recv>
+}
+  802880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802883:	c9                   	leave
+  802884:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802885:	83 ec 0c             	sub    $0xc,%esp
+  802888:	6a 02                	push   $0x2
+  80288a:	e8 07 1b 00 00       	call   804396 <ipc_find_env>
+  80288f:	a3 08 60 80 00       	mov    %eax,0x806008
+  802894:	83 c4 10             	add    $0x10,%esp
+  802897:	eb c6                	jmp    80285f <nsipc+0x12>
+
+00802899 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	56                   	push   %esi
+  80289d:	53                   	push   %ebx
+  80289e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8028a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8028a9:	8b 06                	mov    (%esi),%eax
+  8028ab:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8028b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028b5:	e8 93 ff ff ff       	call   80284d <nsipc>
+  8028ba:	89 c3                	mov    %eax,%ebx
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	79 09                	jns    8028c9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028c0:	89 d8                	mov    %ebx,%eax
+  8028c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c5:	5b                   	pop    %ebx
+  8028c6:	5e                   	pop    %esi
+  8028c7:	5d                   	pop    %ebp
+  8028c8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028c9:	83 ec 04             	sub    $0x4,%esp
+  8028cc:	ff 35 10 80 80 00    	push   0x808010
+  8028d2:	68 00 80 80 00       	push   $0x808000
+  8028d7:	ff 75 0c             	push   0xc(%ebp)
+  8028da:	e8 17 e0 ff ff       	call   8008f6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028df:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028e4:	89 06                	mov    %eax,(%esi)
+  8028e6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028e9:	eb d5                	jmp    8028c0 <nsipc_accept+0x27>
+
+008028eb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028eb:	55                   	push   %ebp
+  8028ec:	89 e5                	mov    %esp,%ebp
+  8028ee:	53                   	push   %ebx
+  8028ef:	83 ec 08             	sub    $0x8,%esp
+  8028f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028fd:	53                   	push   %ebx
+  8028fe:	ff 75 0c             	push   0xc(%ebp)
+  802901:	68 04 80 80 00       	push   $0x808004
+  802906:	e8 eb df ff ff       	call   8008f6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80290b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802911:	b8 02 00 00 00       	mov    $0x2,%eax
+  802916:	e8 32 ff ff ff       	call   80284d <nsipc>
+}
+  80291b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+
+00802920 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802926:	8b 45 08             	mov    0x8(%ebp),%eax
+  802929:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80292e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802931:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802936:	b8 03 00 00 00       	mov    $0x3,%eax
+  80293b:	e8 0d ff ff ff       	call   80284d <nsipc>
+}
+  802940:	c9                   	leave
+  802941:	c3                   	ret
+
+00802942 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802942:	55                   	push   %ebp
+  802943:	89 e5                	mov    %esp,%ebp
+  802945:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802950:	b8 04 00 00 00       	mov    $0x4,%eax
+  802955:	e8 f3 fe ff ff       	call   80284d <nsipc>
+}
+  80295a:	c9                   	leave
+  80295b:	c3                   	ret
+
+0080295c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80295c:	55                   	push   %ebp
+  80295d:	89 e5                	mov    %esp,%ebp
+  80295f:	53                   	push   %ebx
+  802960:	83 ec 08             	sub    $0x8,%esp
+  802963:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802966:	8b 45 08             	mov    0x8(%ebp),%eax
+  802969:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80296e:	53                   	push   %ebx
+  80296f:	ff 75 0c             	push   0xc(%ebp)
+  802972:	68 04 80 80 00       	push   $0x808004
+  802977:	e8 7a df ff ff       	call   8008f6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80297c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802982:	b8 05 00 00 00       	mov    $0x5,%eax
+  802987:	e8 c1 fe ff ff       	call   80284d <nsipc>
+}
+  80298c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+
+00802991 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802991:	55                   	push   %ebp
+  802992:	89 e5                	mov    %esp,%ebp
+  802994:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80299f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8029a7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029ac:	e8 9c fe ff ff       	call   80284d <nsipc>
+}
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+008029b3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029be:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029c3:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8029c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029cc:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029d1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029d6:	e8 72 fe ff ff       	call   80284d <nsipc>
+  8029db:	89 c3                	mov    %eax,%ebx
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 22                	js     802a03 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029e1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029e6:	39 c6                	cmp    %eax,%esi
+  8029e8:	0f 4e c6             	cmovle %esi,%eax
+  8029eb:	39 c3                	cmp    %eax,%ebx
+  8029ed:	7f 1d                	jg     802a0c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029ef:	83 ec 04             	sub    $0x4,%esp
+  8029f2:	53                   	push   %ebx
+  8029f3:	68 00 80 80 00       	push   $0x808000
+  8029f8:	ff 75 0c             	push   0xc(%ebp)
+  8029fb:	e8 f6 de ff ff       	call   8008f6 <memmove>
+  802a00:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a03:	89 d8                	mov    %ebx,%eax
+  802a05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a08:	5b                   	pop    %ebx
+  802a09:	5e                   	pop    %esi
+  802a0a:	5d                   	pop    %ebp
+  802a0b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a0c:	68 84 4b 80 00       	push   $0x804b84
+  802a11:	68 3d 4b 80 00       	push   $0x804b3d
+  802a16:	6a 62                	push   $0x62
+  802a18:	68 99 4b 80 00       	push   $0x804b99
+  802a1d:	e8 6c 11 00 00       	call   803b8e <_panic>
+
+00802a22 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a22:	55                   	push   %ebp
+  802a23:	89 e5                	mov    %esp,%ebp
+  802a25:	53                   	push   %ebx
+  802a26:	83 ec 04             	sub    $0x4,%esp
+  802a29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a34:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a3a:	7f 2e                	jg     802a6a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a3c:	83 ec 04             	sub    $0x4,%esp
+  802a3f:	53                   	push   %ebx
+  802a40:	ff 75 0c             	push   0xc(%ebp)
+  802a43:	68 0c 80 80 00       	push   $0x80800c
+  802a48:	e8 a9 de ff ff       	call   8008f6 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a4d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a56:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a5b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a60:	e8 e8 fd ff ff       	call   80284d <nsipc>
+}
+  802a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a68:	c9                   	leave
+  802a69:	c3                   	ret
+	assert(size < 1600);
+  802a6a:	68 a5 4b 80 00       	push   $0x804ba5
+  802a6f:	68 3d 4b 80 00       	push   $0x804b3d
+  802a74:	6a 6d                	push   $0x6d
+  802a76:	68 99 4b 80 00       	push   $0x804b99
+  802a7b:	e8 0e 11 00 00       	call   803b8e <_panic>
+
+00802a80 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a80:	55                   	push   %ebp
+  802a81:	89 e5                	mov    %esp,%ebp
+  802a83:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a89:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a91:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a96:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a99:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a9e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802aa3:	e8 a5 fd ff ff       	call   80284d <nsipc>
+}
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+
+00802aaa <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802aaa:	55                   	push   %ebp
+  802aab:	89 e5                	mov    %esp,%ebp
+  802aad:	53                   	push   %ebx
+  802aae:	83 ec 10             	sub    $0x10,%esp
+  802ab1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802ab4:	68 0c 60 80 00       	push   $0x80600c
+  802ab9:	e8 50 07 00 00       	call   80320e <mutex_lock>
+	if (v == 0)
+  802abe:	83 c4 10             	add    $0x10,%esp
+  802ac1:	85 db                	test   %ebx,%ebx
+  802ac3:	0f 84 85 00 00 00    	je     802b4e <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802ac9:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802acf:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802ad4:	77 51                	ja     802b27 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802ad6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802adc:	89 d8                	mov    %ebx,%eax
+  802ade:	c1 e8 0c             	shr    $0xc,%eax
+  802ae1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ae8:	f6 c4 02             	test   $0x2,%ah
+  802aeb:	74 50                	je     802b3d <free+0x93>
+		sys_page_unmap(0, c);
+  802aed:	83 ec 08             	sub    $0x8,%esp
+  802af0:	53                   	push   %ebx
+  802af1:	6a 00                	push   $0x0
+  802af3:	e8 4f e1 ff ff       	call   800c47 <sys_page_unmap>
+		c += PGSIZE;
+  802af8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802afe:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b04:	83 c4 10             	add    $0x10,%esp
+  802b07:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b0c:	76 ce                	jbe    802adc <free+0x32>
+  802b0e:	68 ef 4b 80 00       	push   $0x804bef
+  802b13:	68 3d 4b 80 00       	push   $0x804b3d
+  802b18:	68 82 00 00 00       	push   $0x82
+  802b1d:	68 e2 4b 80 00       	push   $0x804be2
+  802b22:	e8 67 10 00 00       	call   803b8e <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b27:	68 b4 4b 80 00       	push   $0x804bb4
+  802b2c:	68 3d 4b 80 00       	push   $0x804b3d
+  802b31:	6a 7b                	push   $0x7b
+  802b33:	68 e2 4b 80 00       	push   $0x804be2
+  802b38:	e8 51 10 00 00       	call   803b8e <_panic>
+	if (--(*ref) == 0)
+  802b3d:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802b43:	83 e8 01             	sub    $0x1,%eax
+  802b46:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802b4c:	74 15                	je     802b63 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802b4e:	83 ec 0c             	sub    $0xc,%esp
+  802b51:	68 0c 60 80 00       	push   $0x80600c
+  802b56:	e8 20 07 00 00       	call   80327b <mutex_unlock>
+}
+  802b5b:	83 c4 10             	add    $0x10,%esp
+  802b5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b61:	c9                   	leave
+  802b62:	c3                   	ret
+		sys_page_unmap(0, c);
+  802b63:	83 ec 08             	sub    $0x8,%esp
+  802b66:	53                   	push   %ebx
+  802b67:	6a 00                	push   $0x0
+  802b69:	e8 d9 e0 ff ff       	call   800c47 <sys_page_unmap>
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	eb db                	jmp    802b4e <free+0xa4>
+
+00802b73 <malloc>:
+{
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	57                   	push   %edi
+  802b77:	56                   	push   %esi
+  802b78:	53                   	push   %ebx
+  802b79:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802b7c:	68 0c 60 80 00       	push   $0x80600c
+  802b81:	e8 88 06 00 00       	call   80320e <mutex_lock>
+	if (mptr == 0)
+  802b86:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	85 ff                	test   %edi,%edi
+  802b91:	74 6c                	je     802bff <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802b93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b96:	83 c0 03             	add    $0x3,%eax
+  802b99:	83 e0 fc             	and    $0xfffffffc,%eax
+  802b9c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802b9e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ba3:	0f 87 64 01 00 00    	ja     802d0d <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802ba9:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802baf:	74 30                	je     802be1 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802bb1:	89 f9                	mov    %edi,%ecx
+  802bb3:	c1 e9 0c             	shr    $0xc,%ecx
+  802bb6:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802bba:	c1 e8 0c             	shr    $0xc,%eax
+  802bbd:	39 c1                	cmp    %eax,%ecx
+  802bbf:	74 5f                	je     802c20 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	57                   	push   %edi
+  802bc5:	e8 e0 fe ff ff       	call   802aaa <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802bca:	a1 10 60 80 00       	mov    0x806010,%eax
+  802bcf:	05 00 10 00 00       	add    $0x1000,%eax
+  802bd4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802bd9:	a3 10 60 80 00       	mov    %eax,0x806010
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802be7:	ba 02 00 00 00       	mov    $0x2,%edx
+  802bec:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802bf0:	8d 7e 04             	lea    0x4(%esi),%edi
+  802bf3:	89 cb                	mov    %ecx,%ebx
+  802bf5:	01 f9                	add    %edi,%ecx
+  802bf7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802bfa:	e9 8b 00 00 00       	jmp    802c8a <malloc+0x117>
+		mptr = mbegin;
+  802bff:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802c06:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0c:	83 c0 03             	add    $0x3,%eax
+  802c0f:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c12:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c14:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c19:	76 c6                	jbe    802be1 <malloc+0x6e>
+  802c1b:	e9 d6 00 00 00       	jmp    802cf6 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802c20:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c26:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802c2b:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802c2f:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802c32:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802c37:	e9 ba 00 00 00       	jmp    802cf6 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c3c:	05 00 10 00 00       	add    $0x1000,%eax
+  802c41:	39 c8                	cmp    %ecx,%eax
+  802c43:	0f 83 cb 00 00 00    	jae    802d14 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802c49:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802c4e:	77 22                	ja     802c72 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802c50:	89 c2                	mov    %eax,%edx
+  802c52:	c1 ea 16             	shr    $0x16,%edx
+  802c55:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802c5c:	f6 c2 01             	test   $0x1,%dl
+  802c5f:	74 db                	je     802c3c <malloc+0xc9>
+  802c61:	89 c2                	mov    %eax,%edx
+  802c63:	c1 ea 0c             	shr    $0xc,%edx
+  802c66:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802c6d:	f6 c2 01             	test   $0x1,%dl
+  802c70:	74 ca                	je     802c3c <malloc+0xc9>
+		if (mptr == mend) {
+  802c72:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c78:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802c7e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802c82:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802c88:	74 04                	je     802c8e <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c8a:	89 d8                	mov    %ebx,%eax
+  802c8c:	eb b3                	jmp    802c41 <malloc+0xce>
+  802c8e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802c91:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802c96:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802c9a:	83 ea 01             	sub    $0x1,%edx
+  802c9d:	0f 85 50 ff ff ff    	jne    802bf3 <malloc+0x80>
+  802ca3:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802caa:	00 00 08 
+				return 0;	/* out of address space */
+  802cad:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb2:	eb 42                	jmp    802cf6 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802cb4:	85 db                	test   %ebx,%ebx
+  802cb6:	78 1e                	js     802cd6 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802cb8:	83 ec 08             	sub    $0x8,%esp
+  802cbb:	89 d8                	mov    %ebx,%eax
+  802cbd:	03 05 10 60 80 00    	add    0x806010,%eax
+  802cc3:	50                   	push   %eax
+  802cc4:	6a 00                	push   $0x0
+  802cc6:	e8 7c df ff ff       	call   800c47 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802ccb:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802cd1:	83 c4 10             	add    $0x10,%esp
+  802cd4:	eb de                	jmp    802cb4 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cdb:	eb 19                	jmp    802cf6 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802cdd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ce0:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802ce6:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802ced:	00 
+	mptr += n;
+  802cee:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802cf1:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802cf6:	83 ec 0c             	sub    $0xc,%esp
+  802cf9:	68 0c 60 80 00       	push   $0x80600c
+  802cfe:	e8 78 05 00 00       	call   80327b <mutex_unlock>
+}
+  802d03:	89 f8                	mov    %edi,%eax
+  802d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d08:	5b                   	pop    %ebx
+  802d09:	5e                   	pop    %esi
+  802d0a:	5f                   	pop    %edi
+  802d0b:	5d                   	pop    %ebp
+  802d0c:	c3                   	ret
+		return 0;
+  802d0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d12:	eb e2                	jmp    802cf6 <malloc+0x183>
+  802d14:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802d18:	74 06                	je     802d20 <malloc+0x1ad>
+  802d1a:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d25:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d28:	39 fb                	cmp    %edi,%ebx
+  802d2a:	73 b1                	jae    802cdd <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d2c:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d32:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d35:	39 fe                	cmp    %edi,%esi
+  802d37:	0f 92 c0             	setb   %al
+  802d3a:	0f b6 c0             	movzbl %al,%eax
+  802d3d:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d40:	83 c8 07             	or     $0x7,%eax
+  802d43:	50                   	push   %eax
+  802d44:	89 d8                	mov    %ebx,%eax
+  802d46:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d4c:	50                   	push   %eax
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	e8 5a de ff ff       	call   800bae <sys_page_alloc>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	0f 88 55 ff ff ff    	js     802cb4 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d5f:	89 f3                	mov    %esi,%ebx
+  802d61:	eb c5                	jmp    802d28 <malloc+0x1b5>
+
+00802d63 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d63:	55                   	push   %ebp
+  802d64:	89 e5                	mov    %esp,%ebp
+  802d66:	56                   	push   %esi
+  802d67:	53                   	push   %ebx
+  802d68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d6b:	83 ec 0c             	sub    $0xc,%esp
+  802d6e:	ff 75 08             	push   0x8(%ebp)
+  802d71:	e8 ea e2 ff ff       	call   801060 <fd2data>
+  802d76:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d78:	83 c4 08             	add    $0x8,%esp
+  802d7b:	68 07 4c 80 00       	push   $0x804c07
+  802d80:	53                   	push   %ebx
+  802d81:	e8 ea d9 ff ff       	call   800770 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d86:	8b 46 04             	mov    0x4(%esi),%eax
+  802d89:	2b 06                	sub    (%esi),%eax
+  802d8b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d91:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d98:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d9b:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802da2:	52 80 00 
+	return 0;
+}
+  802da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dad:	5b                   	pop    %ebx
+  802dae:	5e                   	pop    %esi
+  802daf:	5d                   	pop    %ebp
+  802db0:	c3                   	ret
+
+00802db1 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db6:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802dba:	85 c9                	test   %ecx,%ecx
+  802dbc:	75 01                	jne    802dbf <pipewake+0xe>
+  802dbe:	c3                   	ret
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802dc5:	68 00 04 00 00       	push   $0x400
+  802dca:	52                   	push   %edx
+  802dcb:	e8 22 e1 ff ff       	call   800ef2 <sys_futex_wake>
+  802dd0:	83 c4 10             	add    $0x10,%esp
+}
+  802dd3:	c9                   	leave
+  802dd4:	c3                   	ret
+
+00802dd5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802dd5:	55                   	push   %ebp
+  802dd6:	89 e5                	mov    %esp,%ebp
+  802dd8:	56                   	push   %esi
+  802dd9:	53                   	push   %ebx
+  802dda:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ddd:	83 ec 0c             	sub    $0xc,%esp
+  802de0:	56                   	push   %esi
+  802de1:	e8 7a e2 ff ff       	call   801060 <fd2data>
+  802de6:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802de8:	83 c4 08             	add    $0x8,%esp
+  802deb:	56                   	push   %esi
+  802dec:	6a 00                	push   $0x0
+  802dee:	e8 54 de ff ff       	call   800c47 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802df3:	8d 53 04             	lea    0x4(%ebx),%edx
+  802df6:	8d 43 08             	lea    0x8(%ebx),%eax
+  802df9:	e8 b3 ff ff ff       	call   802db1 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802dfe:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802e01:	89 da                	mov    %ebx,%edx
+  802e03:	e8 a9 ff ff ff       	call   802db1 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802e08:	89 34 24             	mov    %esi,(%esp)
+  802e0b:	e8 50 e2 ff ff       	call   801060 <fd2data>
+  802e10:	83 c4 08             	add    $0x8,%esp
+  802e13:	50                   	push   %eax
+  802e14:	6a 00                	push   $0x0
+  802e16:	e8 2c de ff ff       	call   800c47 <sys_page_unmap>
+}
+  802e1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e1e:	5b                   	pop    %ebx
+  802e1f:	5e                   	pop    %esi
+  802e20:	5d                   	pop    %ebp
+  802e21:	c3                   	ret
+
+00802e22 <_pipeisclosed>:
+{
+  802e22:	55                   	push   %ebp
+  802e23:	89 e5                	mov    %esp,%ebp
+  802e25:	57                   	push   %edi
+  802e26:	56                   	push   %esi
+  802e27:	53                   	push   %ebx
+  802e28:	83 ec 1c             	sub    $0x1c,%esp
+  802e2b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e2e:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e30:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802e35:	eb 5d                	jmp    802e94 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802e37:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		n = thisenv->env_runs;
+  802e3d:	8b 02                	mov    (%edx),%eax
+  802e3f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e42:	83 ec 0c             	sub    $0xc,%esp
+  802e45:	ff 75 e0             	push   -0x20(%ebp)
+  802e48:	e8 88 15 00 00       	call   8043d5 <pageref>
+  802e4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e50:	89 3c 24             	mov    %edi,(%esp)
+  802e53:	e8 7d 15 00 00       	call   8043d5 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802e58:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e5a:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802e60:	83 c4 10             	add    $0x10,%esp
+  802e63:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802e69:	77 15                	ja     802e80 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e6b:	89 f2                	mov    %esi,%edx
+  802e6d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802e6f:	c1 ea 10             	shr    $0x10,%edx
+  802e72:	74 0c                	je     802e80 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e74:	c1 e2 10             	shl    $0x10,%edx
+  802e77:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802e7c:	29 d1                	sub    %edx,%ecx
+  802e7e:	eb 06                	jmp    802e86 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802e80:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		nn = thisenv->env_runs;
+  802e86:	8b 11                	mov    (%ecx),%edx
+  802e88:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e8b:	39 d3                	cmp    %edx,%ebx
+  802e8d:	74 6e                	je     802efd <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802e8f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e92:	74 24                	je     802eb8 <_pipeisclosed+0x96>
+  802e94:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e96:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802e9c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ea1:	77 94                	ja     802e37 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ea3:	89 f0                	mov    %esi,%eax
+  802ea5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ea7:	c1 e8 10             	shr    $0x10,%eax
+  802eaa:	74 8b                	je     802e37 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802eac:	c1 e0 10             	shl    $0x10,%eax
+  802eaf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802eb4:	29 c2                	sub    %eax,%edx
+  802eb6:	eb 85                	jmp    802e3d <_pipeisclosed+0x1b>
+  802eb8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802eba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ec0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ec5:	77 18                	ja     802edf <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ec7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ecc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ece:	c1 e8 10             	shr    $0x10,%eax
+  802ed1:	74 0c                	je     802edf <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ed3:	c1 e0 10             	shl    $0x10,%eax
+  802ed6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802edb:	29 c2                	sub    %eax,%edx
+  802edd:	eb 06                	jmp    802ee5 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802edf:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ee5:	8b 02                	mov    (%edx),%eax
+  802ee7:	8b 40 58             	mov    0x58(%eax),%eax
+  802eea:	6a 01                	push   $0x1
+  802eec:	50                   	push   %eax
+  802eed:	53                   	push   %ebx
+  802eee:	68 0e 4c 80 00       	push   $0x804c0e
+  802ef3:	e8 94 d2 ff ff       	call   80018c <cprintf>
+  802ef8:	83 c4 10             	add    $0x10,%esp
+  802efb:	eb 97                	jmp    802e94 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802efd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f00:	0f 94 c0             	sete   %al
+  802f03:	0f b6 c0             	movzbl %al,%eax
+}
+  802f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5f                   	pop    %edi
+  802f0c:	5d                   	pop    %ebp
+  802f0d:	c3                   	ret
+
+00802f0e <devpipe_write>:
+{
+  802f0e:	55                   	push   %ebp
+  802f0f:	89 e5                	mov    %esp,%ebp
+  802f11:	57                   	push   %edi
+  802f12:	56                   	push   %esi
+  802f13:	53                   	push   %ebx
+  802f14:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f17:	ff 75 08             	push   0x8(%ebp)
+  802f1a:	e8 41 e1 ff ff       	call   801060 <fd2data>
+  802f1f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f21:	83 c4 10             	add    $0x10,%esp
+  802f24:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f2b:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802f2e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f31:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f34:	0f 84 96 00 00 00    	je     802fd0 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f3a:	8d 73 08             	lea    0x8(%ebx),%esi
+  802f3d:	eb 32                	jmp    802f71 <devpipe_write+0x63>
+  802f3f:	89 fa                	mov    %edi,%edx
+  802f41:	89 f0                	mov    %esi,%eax
+  802f43:	e8 69 fe ff ff       	call   802db1 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802f48:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f4b:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802f4e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f53:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802f58:	83 ec 04             	sub    $0x4,%esp
+  802f5b:	6a 0a                	push   $0xa
+  802f5d:	50                   	push   %eax
+  802f5e:	53                   	push   %ebx
+  802f5f:	e8 5f df ff ff       	call   800ec3 <sys_futex_wait>
+  802f64:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f69:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802f6e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f71:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f74:	8b 0b                	mov    (%ebx),%ecx
+  802f76:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f79:	39 d0                	cmp    %edx,%eax
+  802f7b:	72 1b                	jb     802f98 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  802f7d:	89 da                	mov    %ebx,%edx
+  802f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f82:	e8 9b fe ff ff       	call   802e22 <_pipeisclosed>
+  802f87:	85 c0                	test   %eax,%eax
+  802f89:	74 b4                	je     802f3f <devpipe_write+0x31>
+				return 0;
+  802f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f93:	5b                   	pop    %ebx
+  802f94:	5e                   	pop    %esi
+  802f95:	5f                   	pop    %edi
+  802f96:	5d                   	pop    %ebp
+  802f97:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f9b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f9e:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  802fa2:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  802fa5:	89 c2                	mov    %eax,%edx
+  802fa7:	c1 fa 1f             	sar    $0x1f,%edx
+  802faa:	89 d1                	mov    %edx,%ecx
+  802fac:	c1 e9 1b             	shr    $0x1b,%ecx
+  802faf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fb2:	83 e2 1f             	and    $0x1f,%edx
+  802fb5:	29 ca                	sub    %ecx,%edx
+  802fb7:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802fbb:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802fbf:	83 c0 01             	add    $0x1,%eax
+  802fc2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802fc5:	83 c6 01             	add    $0x1,%esi
+  802fc8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802fcb:	e9 5e ff ff ff       	jmp    802f2e <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802fd0:	8d 53 04             	lea    0x4(%ebx),%edx
+  802fd3:	8d 43 08             	lea    0x8(%ebx),%eax
+  802fd6:	e8 d6 fd ff ff       	call   802db1 <pipewake>
+	return i;
+  802fdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fde:	eb b0                	jmp    802f90 <devpipe_write+0x82>
+
+00802fe0 <devpipe_read>:
+{
+  802fe0:	55                   	push   %ebp
+  802fe1:	89 e5                	mov    %esp,%ebp
+  802fe3:	57                   	push   %edi
+  802fe4:	56                   	push   %esi
+  802fe5:	53                   	push   %ebx
+  802fe6:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802fe9:	ff 75 08             	push   0x8(%ebp)
+  802fec:	e8 6f e0 ff ff       	call   801060 <fd2data>
+  802ff1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ffb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ffe:	74 6c                	je     80306c <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803000:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803003:	eb 25                	jmp    80302a <devpipe_read+0x4a>
+  803005:	8b 13                	mov    (%ebx),%edx
+  803007:	b8 01 00 00 00       	mov    $0x1,%eax
+  80300c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803011:	83 ec 04             	sub    $0x4,%esp
+  803014:	6a 0a                	push   $0xa
+  803016:	52                   	push   %edx
+  803017:	57                   	push   %edi
+  803018:	e8 a6 de ff ff       	call   800ec3 <sys_futex_wait>
+  80301d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803022:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803027:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80302a:	8b 03                	mov    (%ebx),%eax
+  80302c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80302f:	75 19                	jne    80304a <devpipe_read+0x6a>
+			if (i > 0)
+  803031:	85 f6                	test   %esi,%esi
+  803033:	75 3a                	jne    80306f <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803035:	89 da                	mov    %ebx,%edx
+  803037:	8b 45 08             	mov    0x8(%ebp),%eax
+  80303a:	e8 e3 fd ff ff       	call   802e22 <_pipeisclosed>
+  80303f:	85 c0                	test   %eax,%eax
+  803041:	74 c2                	je     803005 <devpipe_read+0x25>
+				return 0;
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	eb 31                	jmp    80307b <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80304a:	89 c1                	mov    %eax,%ecx
+  80304c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80304f:	c1 e9 1b             	shr    $0x1b,%ecx
+  803052:	01 c8                	add    %ecx,%eax
+  803054:	83 e0 1f             	and    $0x1f,%eax
+  803057:	29 c8                	sub    %ecx,%eax
+  803059:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80305e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803061:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803064:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803067:	83 c6 01             	add    $0x1,%esi
+  80306a:	eb 8f                	jmp    802ffb <devpipe_read+0x1b>
+out:
+  80306c:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80306f:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803072:	89 da                	mov    %ebx,%edx
+  803074:	e8 38 fd ff ff       	call   802db1 <pipewake>
+	return i;
+  803079:	89 f0                	mov    %esi,%eax
+}
+  80307b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80307e:	5b                   	pop    %ebx
+  80307f:	5e                   	pop    %esi
+  803080:	5f                   	pop    %edi
+  803081:	5d                   	pop    %ebp
+  803082:	c3                   	ret
+
+00803083 <pipe>:
+{
+  803083:	55                   	push   %ebp
+  803084:	89 e5                	mov    %esp,%ebp
+  803086:	56                   	push   %esi
+  803087:	53                   	push   %ebx
+  803088:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80308b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80308e:	50                   	push   %eax
+  80308f:	e8 e3 df ff ff       	call   801077 <fd_alloc>
+  803094:	89 c3                	mov    %eax,%ebx
+  803096:	83 c4 10             	add    $0x10,%esp
+  803099:	85 c0                	test   %eax,%eax
+  80309b:	0f 88 23 01 00 00    	js     8031c4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030a1:	83 ec 04             	sub    $0x4,%esp
+  8030a4:	68 07 04 00 00       	push   $0x407
+  8030a9:	ff 75 f4             	push   -0xc(%ebp)
+  8030ac:	6a 00                	push   $0x0
+  8030ae:	e8 fb da ff ff       	call   800bae <sys_page_alloc>
+  8030b3:	89 c3                	mov    %eax,%ebx
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	85 c0                	test   %eax,%eax
+  8030ba:	0f 88 04 01 00 00    	js     8031c4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030c0:	83 ec 0c             	sub    $0xc,%esp
+  8030c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030c6:	50                   	push   %eax
+  8030c7:	e8 ab df ff ff       	call   801077 <fd_alloc>
+  8030cc:	89 c3                	mov    %eax,%ebx
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	85 c0                	test   %eax,%eax
+  8030d3:	0f 88 db 00 00 00    	js     8031b4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030d9:	83 ec 04             	sub    $0x4,%esp
+  8030dc:	68 07 04 00 00       	push   $0x407
+  8030e1:	ff 75 f0             	push   -0x10(%ebp)
+  8030e4:	6a 00                	push   $0x0
+  8030e6:	e8 c3 da ff ff       	call   800bae <sys_page_alloc>
+  8030eb:	89 c3                	mov    %eax,%ebx
+  8030ed:	83 c4 10             	add    $0x10,%esp
+  8030f0:	85 c0                	test   %eax,%eax
+  8030f2:	0f 88 bc 00 00 00    	js     8031b4 <pipe+0x131>
+	va = fd2data(fd0);
+  8030f8:	83 ec 0c             	sub    $0xc,%esp
+  8030fb:	ff 75 f4             	push   -0xc(%ebp)
+  8030fe:	e8 5d df ff ff       	call   801060 <fd2data>
+  803103:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803105:	83 c4 0c             	add    $0xc,%esp
+  803108:	68 07 04 00 00       	push   $0x407
+  80310d:	50                   	push   %eax
+  80310e:	6a 00                	push   $0x0
+  803110:	e8 99 da ff ff       	call   800bae <sys_page_alloc>
+  803115:	89 c3                	mov    %eax,%ebx
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	0f 88 82 00 00 00    	js     8031a4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803122:	83 ec 0c             	sub    $0xc,%esp
+  803125:	ff 75 f0             	push   -0x10(%ebp)
+  803128:	e8 33 df ff ff       	call   801060 <fd2data>
+  80312d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803134:	50                   	push   %eax
+  803135:	6a 00                	push   $0x0
+  803137:	56                   	push   %esi
+  803138:	6a 00                	push   $0x0
+  80313a:	e8 bc da ff ff       	call   800bfb <sys_page_map>
+  80313f:	89 c3                	mov    %eax,%ebx
+  803141:	83 c4 20             	add    $0x20,%esp
+  803144:	85 c0                	test   %eax,%eax
+  803146:	78 4e                	js     803196 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803148:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80314d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803150:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803152:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803155:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80315c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80315f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803161:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803164:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80316b:	83 ec 0c             	sub    $0xc,%esp
+  80316e:	ff 75 f4             	push   -0xc(%ebp)
+  803171:	e8 da de ff ff       	call   801050 <fd2num>
+  803176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803179:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80317b:	83 c4 04             	add    $0x4,%esp
+  80317e:	ff 75 f0             	push   -0x10(%ebp)
+  803181:	e8 ca de ff ff       	call   801050 <fd2num>
+  803186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803189:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80318c:	83 c4 10             	add    $0x10,%esp
+  80318f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803194:	eb 2e                	jmp    8031c4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803196:	83 ec 08             	sub    $0x8,%esp
+  803199:	56                   	push   %esi
+  80319a:	6a 00                	push   $0x0
+  80319c:	e8 a6 da ff ff       	call   800c47 <sys_page_unmap>
+  8031a1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031a4:	83 ec 08             	sub    $0x8,%esp
+  8031a7:	ff 75 f0             	push   -0x10(%ebp)
+  8031aa:	6a 00                	push   $0x0
+  8031ac:	e8 96 da ff ff       	call   800c47 <sys_page_unmap>
+  8031b1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031b4:	83 ec 08             	sub    $0x8,%esp
+  8031b7:	ff 75 f4             	push   -0xc(%ebp)
+  8031ba:	6a 00                	push   $0x0
+  8031bc:	e8 86 da ff ff       	call   800c47 <sys_page_unmap>
+  8031c1:	83 c4 10             	add    $0x10,%esp
+}
+  8031c4:	89 d8                	mov    %ebx,%eax
+  8031c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031c9:	5b                   	pop    %ebx
+  8031ca:	5e                   	pop    %esi
+  8031cb:	5d                   	pop    %ebp
+  8031cc:	c3                   	ret
+
+008031cd <pipeisclosed>:
+{
+  8031cd:	55                   	push   %ebp
+  8031ce:	89 e5                	mov    %esp,%ebp
+  8031d0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d6:	50                   	push   %eax
+  8031d7:	ff 75 08             	push   0x8(%ebp)
+  8031da:	e8 ee de ff ff       	call   8010cd <fd_lookup>
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	85 c0                	test   %eax,%eax
+  8031e4:	78 18                	js     8031fe <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031e6:	83 ec 0c             	sub    $0xc,%esp
+  8031e9:	ff 75 f4             	push   -0xc(%ebp)
+  8031ec:	e8 6f de ff ff       	call   801060 <fd2data>
+  8031f1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f6:	e8 27 fc ff ff       	call   802e22 <_pipeisclosed>
+  8031fb:	83 c4 10             	add    $0x10,%esp
+}
+  8031fe:	c9                   	leave
+  8031ff:	c3                   	ret
+
+00803200 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803200:	55                   	push   %ebp
+  803201:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803203:	8b 45 08             	mov    0x8(%ebp),%eax
+  803206:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80320c:	5d                   	pop    %ebp
+  80320d:	c3                   	ret
+
+0080320e <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80320e:	55                   	push   %ebp
+  80320f:	89 e5                	mov    %esp,%ebp
+  803211:	56                   	push   %esi
+  803212:	53                   	push   %ebx
+  803213:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80321b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803220:	89 d0                	mov    %edx,%eax
+  803222:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803226:	85 c0                	test   %eax,%eax
+  803228:	74 2d                	je     803257 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80322a:	83 f8 02             	cmp    $0x2,%eax
+  80322d:	74 08                	je     803237 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80322f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803234:	f0 87 03             	lock xchg %eax,(%ebx)
+  803237:	be 02 00 00 00       	mov    $0x2,%esi
+  80323c:	eb 15                	jmp    803253 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80323e:	83 ec 04             	sub    $0x4,%esp
+  803241:	6a 00                	push   $0x0
+  803243:	6a 02                	push   $0x2
+  803245:	53                   	push   %ebx
+  803246:	e8 78 dc ff ff       	call   800ec3 <sys_futex_wait>
+  80324b:	89 f0                	mov    %esi,%eax
+  80324d:	f0 87 03             	lock xchg %eax,(%ebx)
+  803250:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803253:	85 c0                	test   %eax,%eax
+  803255:	75 e7                	jne    80323e <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803257:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80325a:	5b                   	pop    %ebx
+  80325b:	5e                   	pop    %esi
+  80325c:	5d                   	pop    %ebp
+  80325d:	c3                   	ret
+
+0080325e <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80325e:	55                   	push   %ebp
+  80325f:	89 e5                	mov    %esp,%ebp
+  803261:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803264:	b8 00 00 00 00       	mov    $0x0,%eax
+  803269:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80326e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803272:	f7 d8                	neg    %eax
+  803274:	19 c0                	sbb    %eax,%eax
+  803276:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803279:	5d                   	pop    %ebp
+  80327a:	c3                   	ret
+
+0080327b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80327b:	55                   	push   %ebp
+  80327c:	89 e5                	mov    %esp,%ebp
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803284:	b8 00 00 00 00       	mov    $0x0,%eax
+  803289:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80328c:	83 f8 02             	cmp    $0x2,%eax
+  80328f:	74 02                	je     803293 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803291:	c9                   	leave
+  803292:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803293:	83 ec 08             	sub    $0x8,%esp
+  803296:	6a 01                	push   $0x1
+  803298:	52                   	push   %edx
+  803299:	e8 54 dc ff ff       	call   800ef2 <sys_futex_wake>
+  80329e:	83 c4 10             	add    $0x10,%esp
+}
+  8032a1:	eb ee                	jmp    803291 <mutex_unlock+0x16>
+
+008032a3 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8032a3:	55                   	push   %ebp
+  8032a4:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8032a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032af:	5d                   	pop    %ebp
+  8032b0:	c3                   	ret
+
+008032b1 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	57                   	push   %edi
+  8032b5:	56                   	push   %esi
+  8032b6:	53                   	push   %ebx
+  8032b7:	83 ec 18             	sub    $0x18,%esp
+  8032ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8032c0:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8032c2:	53                   	push   %ebx
+  8032c3:	e8 b3 ff ff ff       	call   80327b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8032c8:	83 c4 0c             	add    $0xc,%esp
+  8032cb:	ff 75 10             	push   0x10(%ebp)
+  8032ce:	57                   	push   %edi
+  8032cf:	56                   	push   %esi
+  8032d0:	e8 ee db ff ff       	call   800ec3 <sys_futex_wait>
+  8032d5:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8032d7:	83 c4 10             	add    $0x10,%esp
+  8032da:	be 02 00 00 00       	mov    $0x2,%esi
+  8032df:	eb 10                	jmp    8032f1 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8032e1:	83 ec 04             	sub    $0x4,%esp
+  8032e4:	6a 00                	push   $0x0
+  8032e6:	6a 02                	push   $0x2
+  8032e8:	53                   	push   %ebx
+  8032e9:	e8 d5 db ff ff       	call   800ec3 <sys_futex_wait>
+  8032ee:	83 c4 10             	add    $0x10,%esp
+  8032f1:	89 f0                	mov    %esi,%eax
+  8032f3:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8032f6:	85 c0                	test   %eax,%eax
+  8032f8:	75 e7                	jne    8032e1 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8032fa:	83 ff ec             	cmp    $0xffffffec,%edi
+  8032fd:	74 05                	je     803304 <cond_timedwait+0x53>
+  8032ff:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803304:	89 f8                	mov    %edi,%eax
+  803306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803309:	5b                   	pop    %ebx
+  80330a:	5e                   	pop    %esi
+  80330b:	5f                   	pop    %edi
+  80330c:	5d                   	pop    %ebp
+  80330d:	c3                   	ret
+
+0080330e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80330e:	55                   	push   %ebp
+  80330f:	89 e5                	mov    %esp,%ebp
+  803311:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803314:	6a 00                	push   $0x0
+  803316:	ff 75 0c             	push   0xc(%ebp)
+  803319:	ff 75 08             	push   0x8(%ebp)
+  80331c:	e8 90 ff ff ff       	call   8032b1 <cond_timedwait>
+}
+  803321:	83 c4 10             	add    $0x10,%esp
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+00803326 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803326:	55                   	push   %ebp
+  803327:	89 e5                	mov    %esp,%ebp
+  803329:	83 ec 10             	sub    $0x10,%esp
+  80332c:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80332f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803334:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803338:	6a 01                	push   $0x1
+  80333a:	50                   	push   %eax
+  80333b:	e8 b2 db ff ff       	call   800ef2 <sys_futex_wake>
+}
+  803340:	83 c4 10             	add    $0x10,%esp
+  803343:	c9                   	leave
+  803344:	c3                   	ret
+
+00803345 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803345:	55                   	push   %ebp
+  803346:	89 e5                	mov    %esp,%ebp
+  803348:	83 ec 10             	sub    $0x10,%esp
+  80334b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803353:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803357:	68 00 04 00 00       	push   $0x400
+  80335c:	50                   	push   %eax
+  80335d:	e8 90 db ff ff       	call   800ef2 <sys_futex_wake>
+}
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	c9                   	leave
+  803366:	c3                   	ret
+
+00803367 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80336d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803370:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803372:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803379:	5d                   	pop    %ebp
+  80337a:	c3                   	ret
+
+0080337b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80337b:	55                   	push   %ebp
+  80337c:	89 e5                	mov    %esp,%ebp
+  80337e:	53                   	push   %ebx
+  80337f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803382:	8b 11                	mov    (%ecx),%edx
+  803384:	85 d2                	test   %edx,%edx
+  803386:	74 14                	je     80339c <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803388:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80338b:	89 d0                	mov    %edx,%eax
+  80338d:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803391:	39 c2                	cmp    %eax,%edx
+  803393:	75 ed                	jne    803382 <sem_trywait+0x7>
+			return 0;
+  803395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339a:	eb 05                	jmp    8033a1 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80339c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8033a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033a4:	c9                   	leave
+  8033a5:	c3                   	ret
+
+008033a6 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8033a6:	55                   	push   %ebp
+  8033a7:	89 e5                	mov    %esp,%ebp
+  8033a9:	57                   	push   %edi
+  8033aa:	56                   	push   %esi
+  8033ab:	53                   	push   %ebx
+  8033ac:	83 ec 1c             	sub    $0x1c,%esp
+  8033af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8033b5:	e8 81 da ff ff       	call   800e3b <sys_time_msec>
+  8033ba:	01 f8                	add    %edi,%eax
+  8033bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8033bf:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8033c4:	eb 28                	jmp    8033ee <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8033c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033cb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8033d0:	83 ec 04             	sub    $0x4,%esp
+  8033d3:	56                   	push   %esi
+  8033d4:	6a 00                	push   $0x0
+  8033d6:	53                   	push   %ebx
+  8033d7:	e8 e7 da ff ff       	call   800ec3 <sys_futex_wait>
+  8033dc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8033e1:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8033e6:	83 c4 10             	add    $0x10,%esp
+  8033e9:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8033ec:	74 2e                	je     80341c <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8033ee:	83 ec 0c             	sub    $0xc,%esp
+  8033f1:	53                   	push   %ebx
+  8033f2:	e8 84 ff ff ff       	call   80337b <sem_trywait>
+  8033f7:	83 c4 10             	add    $0x10,%esp
+  8033fa:	85 c0                	test   %eax,%eax
+  8033fc:	79 19                	jns    803417 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8033fe:	85 ff                	test   %edi,%edi
+  803400:	74 c4                	je     8033c6 <sem_timedwait+0x20>
+  803402:	e8 34 da ff ff       	call   800e3b <sys_time_msec>
+  803407:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80340a:	29 c6                	sub    %eax,%esi
+  80340c:	85 f6                	test   %esi,%esi
+  80340e:	7f b6                	jg     8033c6 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803410:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803415:	eb 05                	jmp    80341c <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803417:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80341f:	5b                   	pop    %ebx
+  803420:	5e                   	pop    %esi
+  803421:	5f                   	pop    %edi
+  803422:	5d                   	pop    %ebp
+  803423:	c3                   	ret
+
+00803424 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80342a:	6a 00                	push   $0x0
+  80342c:	ff 75 08             	push   0x8(%ebp)
+  80342f:	e8 72 ff ff ff       	call   8033a6 <sem_timedwait>
+}
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	c9                   	leave
+  803438:	c3                   	ret
+
+00803439 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803439:	55                   	push   %ebp
+  80343a:	89 e5                	mov    %esp,%ebp
+  80343c:	83 ec 08             	sub    $0x8,%esp
+  80343f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803442:	ba 01 00 00 00       	mov    $0x1,%edx
+  803447:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80344b:	8b 50 04             	mov    0x4(%eax),%edx
+  80344e:	85 d2                	test   %edx,%edx
+  803450:	75 02                	jne    803454 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803452:	c9                   	leave
+  803453:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803454:	83 ec 08             	sub    $0x8,%esp
+  803457:	6a 01                	push   $0x1
+  803459:	50                   	push   %eax
+  80345a:	e8 93 da ff ff       	call   800ef2 <sys_futex_wake>
+  80345f:	83 c4 10             	add    $0x10,%esp
+}
+  803462:	eb ee                	jmp    803452 <sem_post+0x19>
+
+00803464 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803464:	55                   	push   %ebp
+  803465:	89 e5                	mov    %esp,%ebp
+  803467:	57                   	push   %edi
+  803468:	56                   	push   %esi
+  803469:	53                   	push   %ebx
+  80346a:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80346d:	68 20 60 80 00       	push   $0x806020
+  803472:	e8 97 fd ff ff       	call   80320e <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803477:	a1 44 60 80 00       	mov    0x806044,%eax
+  80347c:	83 c4 10             	add    $0x10,%esp
+  80347f:	85 c0                	test   %eax,%eax
+  803481:	75 19                	jne    80349c <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803483:	a1 c4 62 80 00       	mov    0x8062c4,%eax
+  803488:	8b 00                	mov    (%eax),%eax
+  80348a:	8b 40 48             	mov    0x48(%eax),%eax
+  80348d:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803492:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803499:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80349c:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8034a1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8034a4:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8034ab:	8b 40 04             	mov    0x4(%eax),%eax
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	0f 84 e4 00 00 00    	je     80359a <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034b6:	83 c3 01             	add    $0x1,%ebx
+  8034b9:	83 fb 20             	cmp    $0x20,%ebx
+  8034bc:	75 e3                	jne    8034a1 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8034be:	83 ec 0c             	sub    $0xc,%esp
+  8034c1:	68 20 60 80 00       	push   $0x806020
+  8034c6:	e8 b0 fd ff ff       	call   80327b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8034cb:	83 c4 10             	add    $0x10,%esp
+  8034ce:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8034d3:	e9 b8 00 00 00       	jmp    803590 <pthread_create+0x12c>
+  8034d8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8034db:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8034de:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8034e0:	39 f3                	cmp    %esi,%ebx
+  8034e2:	73 16                	jae    8034fa <pthread_create+0x96>
+		va -= PGSIZE;
+  8034e4:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8034ea:	83 ec 08             	sub    $0x8,%esp
+  8034ed:	56                   	push   %esi
+  8034ee:	6a 00                	push   $0x0
+  8034f0:	e8 52 d7 ff ff       	call   800c47 <sys_page_unmap>
+  8034f5:	83 c4 10             	add    $0x10,%esp
+  8034f8:	eb e6                	jmp    8034e0 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8034fa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8034fd:	83 ec 08             	sub    $0x8,%esp
+  803500:	ff 75 e4             	push   -0x1c(%ebp)
+  803503:	6a 00                	push   $0x0
+  803505:	e8 3d d7 ff ff       	call   800c47 <sys_page_unmap>
+	return r;
+  80350a:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80350d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803510:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803517:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80351e:	eb 70                	jmp    803590 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803520:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803523:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80352a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80352d:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803530:	8b 55 10             	mov    0x10(%ebp),%edx
+  803533:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803536:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80353d:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803542:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803545:	29 c8                	sub    %ecx,%eax
+  803547:	85 db                	test   %ebx,%ebx
+  803549:	0f 44 05 c4 62 80 00 	cmove  0x8062c4,%eax
+	*--esp = t;
+  803550:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803553:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80355a:	83 ec 04             	sub    $0x4,%esp
+  80355d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803562:	29 ca                	sub    %ecx,%edx
+  803564:	52                   	push   %edx
+	*--esp = 0;
+  803565:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803568:	50                   	push   %eax
+  803569:	68 c1 37 80 00       	push   $0x8037c1
+  80356e:	e8 24 da ff ff       	call   800f97 <sys_thread_create>
+  803573:	89 c7                	mov    %eax,%edi
+  803575:	83 c4 10             	add    $0x10,%esp
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	78 91                	js     80350d <pthread_create+0xa9>
+	th->th_env = id;
+  80357c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80357f:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803586:	8b 45 08             	mov    0x8(%ebp),%eax
+  803589:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  80358b:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803590:	89 f8                	mov    %edi,%eax
+  803592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803595:	5b                   	pop    %ebx
+  803596:	5e                   	pop    %esi
+  803597:	5f                   	pop    %edi
+  803598:	5d                   	pop    %ebp
+  803599:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  80359a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80359d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035a4:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8035ab:	83 ec 0c             	sub    $0xc,%esp
+  8035ae:	68 20 60 80 00       	push   $0x806020
+  8035b3:	e8 c3 fc ff ff       	call   80327b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8035b8:	89 d9                	mov    %ebx,%ecx
+  8035ba:	c1 e1 10             	shl    $0x10,%ecx
+  8035bd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8035c0:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8035c5:	29 c8                	sub    %ecx,%eax
+  8035c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8035ca:	c1 e8 16             	shr    $0x16,%eax
+  8035cd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035d4:	83 c4 10             	add    $0x10,%esp
+  8035d7:	a8 01                	test   $0x1,%al
+  8035d9:	74 15                	je     8035f0 <pthread_create+0x18c>
+  8035db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035de:	c1 e8 0c             	shr    $0xc,%eax
+  8035e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035e8:	a8 01                	test   $0x1,%al
+  8035ea:	0f 85 30 ff ff ff    	jne    803520 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8035f0:	83 ec 04             	sub    $0x4,%esp
+  8035f3:	6a 07                	push   $0x7
+  8035f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8035f8:	6a 00                	push   $0x0
+  8035fa:	e8 af d5 ff ff       	call   800bae <sys_page_alloc>
+  8035ff:	89 c7                	mov    %eax,%edi
+  803601:	83 c4 10             	add    $0x10,%esp
+  803604:	85 c0                	test   %eax,%eax
+  803606:	0f 88 01 ff ff ff    	js     80350d <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80360c:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803611:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803614:	29 d0                	sub    %edx,%eax
+  803616:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803619:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80361b:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803620:	29 d0                	sub    %edx,%eax
+  803622:	89 c7                	mov    %eax,%edi
+  803624:	39 fe                	cmp    %edi,%esi
+  803626:	0f 83 f4 fe ff ff    	jae    803520 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80362c:	83 ec 04             	sub    $0x4,%esp
+  80362f:	6a 07                	push   $0x7
+  803631:	56                   	push   %esi
+  803632:	6a 00                	push   $0x0
+  803634:	e8 75 d5 ff ff       	call   800bae <sys_page_alloc>
+  803639:	83 c4 10             	add    $0x10,%esp
+  80363c:	85 c0                	test   %eax,%eax
+  80363e:	0f 88 94 fe ff ff    	js     8034d8 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803644:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80364a:	eb d8                	jmp    803624 <pthread_create+0x1c0>
+
+0080364c <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80364c:	55                   	push   %ebp
+  80364d:	89 e5                	mov    %esp,%ebp
+  80364f:	57                   	push   %edi
+  803650:	56                   	push   %esi
+  803651:	53                   	push   %ebx
+  803652:	83 ec 0c             	sub    $0xc,%esp
+  803655:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803658:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80365b:	83 f8 1e             	cmp    $0x1e,%eax
+  80365e:	0f 87 c7 00 00 00    	ja     80372b <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803664:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803666:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80366c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803671:	77 12                	ja     803685 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803673:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803678:	29 d0                	sub    %edx,%eax
+  80367a:	c1 e8 10             	shr    $0x10,%eax
+  80367d:	39 c3                	cmp    %eax,%ebx
+  80367f:	0f 84 ad 00 00 00    	je     803732 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803685:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803688:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80368f:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803696:	eb 10                	jmp    8036a8 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803698:	83 ec 04             	sub    $0x4,%esp
+  80369b:	6a 00                	push   $0x0
+  80369d:	6a 01                	push   $0x1
+  80369f:	57                   	push   %edi
+  8036a0:	e8 1e d8 ff ff       	call   800ec3 <sys_futex_wait>
+  8036a5:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036a8:	8b 46 04             	mov    0x4(%esi),%eax
+  8036ab:	83 f8 01             	cmp    $0x1,%eax
+  8036ae:	74 e8                	je     803698 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8036b0:	83 f8 02             	cmp    $0x2,%eax
+  8036b3:	0f 85 80 00 00 00    	jne    803739 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036b9:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8036bc:	c1 e6 02             	shl    $0x2,%esi
+  8036bf:	eb 05                	jmp    8036c6 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8036c1:	e8 bc d4 ff ff       	call   800b82 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036c6:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8036cc:	89 ca                	mov    %ecx,%edx
+  8036ce:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8036d4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036d7:	c1 e0 04             	shl    $0x4,%eax
+  8036da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036df:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8036e2:	39 c1                	cmp    %eax,%ecx
+  8036e4:	75 12                	jne    8036f8 <pthread_join+0xac>
+  8036e6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036e9:	c1 e0 04             	shl    $0x4,%eax
+  8036ec:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036f1:	8b 40 54             	mov    0x54(%eax),%eax
+  8036f4:	85 c0                	test   %eax,%eax
+  8036f6:	75 c9                	jne    8036c1 <pthread_join+0x75>
+	if (ret_store)
+  8036f8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8036fc:	74 0f                	je     80370d <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8036fe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803701:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803708:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80370b:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80370d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803710:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803717:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80371e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803726:	5b                   	pop    %ebx
+  803727:	5e                   	pop    %esi
+  803728:	5f                   	pop    %edi
+  803729:	5d                   	pop    %ebp
+  80372a:	c3                   	ret
+		return -E_INVAL;
+  80372b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803730:	eb f1                	jmp    803723 <pthread_join+0xd7>
+  803732:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803737:	eb ea                	jmp    803723 <pthread_join+0xd7>
+		return -E_INVAL;
+  803739:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80373e:	eb e3                	jmp    803723 <pthread_join+0xd7>
+
+00803740 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803740:	55                   	push   %ebp
+  803741:	89 e5                	mov    %esp,%ebp
+  803743:	53                   	push   %ebx
+  803744:	83 ec 04             	sub    $0x4,%esp
+  803747:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803749:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80374f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803754:	77 0c                	ja     803762 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803756:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80375b:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80375d:	c1 e8 10             	shr    $0x10,%eax
+  803760:	75 0a                	jne    80376c <pthread_exit+0x2c>
+		exit();
+  803762:	e8 68 c9 ff ff       	call   8000cf <exit>
+  803767:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80376c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803773:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803776:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80377d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803780:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803783:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80378a:	83 ec 08             	sub    $0x8,%esp
+  80378d:	6a 20                	push   $0x20
+  80378f:	01 c2                	add    %eax,%edx
+  803791:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803798:	50                   	push   %eax
+  803799:	e8 54 d7 ff ff       	call   800ef2 <sys_futex_wake>
+	sys_env_destroy(0);
+  80379e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8037a5:	e8 61 d3 ff ff       	call   800b0b <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8037aa:	83 c4 0c             	add    $0xc,%esp
+  8037ad:	68 26 4c 80 00       	push   $0x804c26
+  8037b2:	68 a5 00 00 00       	push   $0xa5
+  8037b7:	68 40 4c 80 00       	push   $0x804c40
+  8037bc:	e8 cd 03 00 00       	call   803b8e <_panic>
+
+008037c1 <pthread_start>:
+{
+  8037c1:	55                   	push   %ebp
+  8037c2:	89 e5                	mov    %esp,%ebp
+  8037c4:	53                   	push   %ebx
+  8037c5:	83 ec 04             	sub    $0x4,%esp
+  8037c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8037cb:	e8 86 d3 ff ff       	call   800b56 <sys_getenvid>
+  8037d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8037d5:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+	if (t == 0)
+  8037db:	85 db                	test   %ebx,%ebx
+  8037dd:	74 0c                	je     8037eb <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037df:	89 d9                	mov    %ebx,%ecx
+  8037e1:	c1 e1 10             	shl    $0x10,%ecx
+  8037e4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037e9:	29 ca                	sub    %ecx,%edx
+  8037eb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8037ee:	c1 e0 04             	shl    $0x4,%eax
+  8037f1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037f6:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8037f8:	83 ec 0c             	sub    $0xc,%esp
+  8037fb:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803802:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803805:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  80380c:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803813:	89 04 24             	mov    %eax,(%esp)
+  803816:	e8 25 ff ff ff       	call   803740 <pthread_exit>
+
+0080381b <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80381b:	55                   	push   %ebp
+  80381c:	89 e5                	mov    %esp,%ebp
+  80381e:	57                   	push   %edi
+  80381f:	56                   	push   %esi
+  803820:	53                   	push   %ebx
+  803821:	83 ec 1c             	sub    $0x1c,%esp
+  803824:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803826:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80382c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803833:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803838:	77 0d                	ja     803847 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80383a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80383f:	29 d0                	sub    %edx,%eax
+  803841:	c1 e8 10             	shr    $0x10,%eax
+  803844:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803847:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80384c:	eb 2f                	jmp    80387d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80384e:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803854:	8b 01                	mov    (%ecx),%eax
+  803856:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803859:	39 c2                	cmp    %eax,%edx
+  80385b:	75 14                	jne    803871 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80385d:	83 ec 0c             	sub    $0xc,%esp
+  803860:	57                   	push   %edi
+  803861:	e8 a5 d2 ff ff       	call   800b0b <sys_env_destroy>
+  803866:	83 c4 10             	add    $0x10,%esp
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	0f 88 97 00 00 00    	js     803908 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803871:	83 c3 01             	add    $0x1,%ebx
+  803874:	83 fb 20             	cmp    $0x20,%ebx
+  803877:	0f 84 d2 00 00 00    	je     80394f <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80387d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803880:	74 ef                	je     803871 <pthread_kill_others+0x56>
+  803882:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803885:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80388c:	8b 40 04             	mov    0x4(%eax),%eax
+  80388f:	83 f8 01             	cmp    $0x1,%eax
+  803892:	75 dd                	jne    803871 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803894:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803897:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  80389e:	89 fe                	mov    %edi,%esi
+  8038a0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038a6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038a9:	c1 e0 04             	shl    $0x4,%eax
+  8038ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038b1:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038b4:	39 c7                	cmp    %eax,%edi
+  8038b6:	75 b9                	jne    803871 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038b8:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038bb:	c1 e0 04             	shl    $0x4,%eax
+  8038be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038c3:	8b 40 54             	mov    0x54(%eax),%eax
+  8038c6:	85 c0                	test   %eax,%eax
+  8038c8:	74 a7                	je     803871 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038ca:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038cd:	c1 e0 04             	shl    $0x4,%eax
+  8038d0:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8038d6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038d8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8038de:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038e3:	0f 87 65 ff ff ff    	ja     80384e <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038e9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038ee:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8038f0:	c1 e8 10             	shr    $0x10,%eax
+  8038f3:	0f 84 55 ff ff ff    	je     80384e <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038f9:	c1 e0 10             	shl    $0x10,%eax
+  8038fc:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803901:	29 c1                	sub    %eax,%ecx
+  803903:	e9 4c ff ff ff       	jmp    803854 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803908:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80390b:	c1 e2 04             	shl    $0x4,%edx
+  80390e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803914:	8b 52 48             	mov    0x48(%edx),%edx
+  803917:	39 fa                	cmp    %edi,%edx
+  803919:	0f 85 52 ff ff ff    	jne    803871 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80391f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803922:	c1 e2 04             	shl    $0x4,%edx
+  803925:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80392b:	8b 52 54             	mov    0x54(%edx),%edx
+  80392e:	85 d2                	test   %edx,%edx
+  803930:	0f 84 3b ff ff ff    	je     803871 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803936:	83 ec 0c             	sub    $0xc,%esp
+  803939:	50                   	push   %eax
+  80393a:	57                   	push   %edi
+  80393b:	68 50 4c 80 00       	push   $0x804c50
+  803940:	68 bb 00 00 00       	push   $0xbb
+  803945:	68 40 4c 80 00       	push   $0x804c40
+  80394a:	e8 3f 02 00 00       	call   803b8e <_panic>
+	}
+}
+  80394f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803952:	5b                   	pop    %ebx
+  803953:	5e                   	pop    %esi
+  803954:	5f                   	pop    %edi
+  803955:	5d                   	pop    %ebp
+  803956:	c3                   	ret
+
+00803957 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803957:	55                   	push   %ebp
+  803958:	89 e5                	mov    %esp,%ebp
+  80395a:	53                   	push   %ebx
+  80395b:	83 ec 04             	sub    $0x4,%esp
+  80395e:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803960:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803966:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80396c:	0f 87 85 00 00 00    	ja     8039f7 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803972:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803977:	29 c3                	sub    %eax,%ebx
+  803979:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80397c:	83 ec 04             	sub    $0x4,%esp
+  80397f:	68 80 02 00 00       	push   $0x280
+  803984:	6a 00                	push   $0x0
+  803986:	68 40 60 80 00       	push   $0x806040
+  80398b:	e8 31 cf ff ff       	call   8008c1 <memset>
+	threads_mu.m_state = 0;
+  803990:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803997:	00 00 00 
+	if (self != 0) {
+  80399a:	83 c4 10             	add    $0x10,%esp
+  80399d:	85 db                	test   %ebx,%ebx
+  80399f:	74 51                	je     8039f2 <pthread_fork_child+0x9b>
+  8039a1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039a3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039a9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039ae:	77 18                	ja     8039c8 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039b0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039b5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039b7:	c1 e8 10             	shr    $0x10,%eax
+  8039ba:	74 0c                	je     8039c8 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039bc:	c1 e0 10             	shl    $0x10,%eax
+  8039bf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039c4:	29 c2                	sub    %eax,%edx
+  8039c6:	eb 06                	jmp    8039ce <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8039c8:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		threads[self].th_env = thisenv->env_id;
+  8039ce:	8b 02                	mov    (%edx),%eax
+  8039d0:	8b 48 48             	mov    0x48(%eax),%ecx
+  8039d3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8039da:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8039dd:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8039e4:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  8039eb:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8039f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039f5:	c9                   	leave
+  8039f6:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8039f7:	83 ec 04             	sub    $0x4,%esp
+  8039fa:	68 80 02 00 00       	push   $0x280
+  8039ff:	6a 00                	push   $0x0
+  803a01:	68 40 60 80 00       	push   $0x806040
+  803a06:	e8 b6 ce ff ff       	call   8008c1 <memset>
+	threads_mu.m_state = 0;
+  803a0b:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a12:	00 00 00 
+  803a15:	83 c4 10             	add    $0x10,%esp
+  803a18:	eb d8                	jmp    8039f2 <pthread_fork_child+0x9b>
+
+00803a1a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1f:	c3                   	ret
+
+00803a20 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a20:	55                   	push   %ebp
+  803a21:	89 e5                	mov    %esp,%ebp
+  803a23:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803a26:	68 75 4c 80 00       	push   $0x804c75
+  803a2b:	ff 75 0c             	push   0xc(%ebp)
+  803a2e:	e8 3d cd ff ff       	call   800770 <strcpy>
+	return 0;
+}
+  803a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a38:	c9                   	leave
+  803a39:	c3                   	ret
+
+00803a3a <devcons_write>:
+{
+  803a3a:	55                   	push   %ebp
+  803a3b:	89 e5                	mov    %esp,%ebp
+  803a3d:	57                   	push   %edi
+  803a3e:	56                   	push   %esi
+  803a3f:	53                   	push   %ebx
+  803a40:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803a46:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803a4b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803a51:	eb 2e                	jmp    803a81 <devcons_write+0x47>
+		m = n - tot;
+  803a53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a56:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803a58:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a5d:	39 c3                	cmp    %eax,%ebx
+  803a5f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a62:	83 ec 04             	sub    $0x4,%esp
+  803a65:	53                   	push   %ebx
+  803a66:	89 f0                	mov    %esi,%eax
+  803a68:	03 45 0c             	add    0xc(%ebp),%eax
+  803a6b:	50                   	push   %eax
+  803a6c:	57                   	push   %edi
+  803a6d:	e8 84 ce ff ff       	call   8008f6 <memmove>
+		sys_cputs(buf, m);
+  803a72:	83 c4 08             	add    $0x8,%esp
+  803a75:	53                   	push   %ebx
+  803a76:	57                   	push   %edi
+  803a77:	e8 38 d0 ff ff       	call   800ab4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803a7c:	01 de                	add    %ebx,%esi
+  803a7e:	83 c4 10             	add    $0x10,%esp
+  803a81:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a84:	72 cd                	jb     803a53 <devcons_write+0x19>
+}
+  803a86:	89 f0                	mov    %esi,%eax
+  803a88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a8b:	5b                   	pop    %ebx
+  803a8c:	5e                   	pop    %esi
+  803a8d:	5f                   	pop    %edi
+  803a8e:	5d                   	pop    %ebp
+  803a8f:	c3                   	ret
+
+00803a90 <devcons_read>:
+{
+  803a90:	55                   	push   %ebp
+  803a91:	89 e5                	mov    %esp,%ebp
+  803a93:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a9f:	75 07                	jne    803aa8 <devcons_read+0x18>
+  803aa1:	eb 1f                	jmp    803ac2 <devcons_read+0x32>
+		sys_yield();
+  803aa3:	e8 da d0 ff ff       	call   800b82 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803aa8:	e8 32 d0 ff ff       	call   800adf <sys_cgetc>
+  803aad:	85 c0                	test   %eax,%eax
+  803aaf:	74 f2                	je     803aa3 <devcons_read+0x13>
+	if (c < 0)
+  803ab1:	78 0f                	js     803ac2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803ab3:	83 f8 04             	cmp    $0x4,%eax
+  803ab6:	74 0c                	je     803ac4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ab8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803abb:	88 02                	mov    %al,(%edx)
+	return 1;
+  803abd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803ac2:	c9                   	leave
+  803ac3:	c3                   	ret
+		return 0;
+  803ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac9:	eb f7                	jmp    803ac2 <devcons_read+0x32>
+
+00803acb <cputchar>:
+{
+  803acb:	55                   	push   %ebp
+  803acc:	89 e5                	mov    %esp,%ebp
+  803ace:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ad4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803ad7:	6a 01                	push   $0x1
+  803ad9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803adc:	50                   	push   %eax
+  803add:	e8 d2 cf ff ff       	call   800ab4 <sys_cputs>
+}
+  803ae2:	83 c4 10             	add    $0x10,%esp
+  803ae5:	c9                   	leave
+  803ae6:	c3                   	ret
+
+00803ae7 <getchar>:
+{
+  803ae7:	55                   	push   %ebp
+  803ae8:	89 e5                	mov    %esp,%ebp
+  803aea:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803aed:	6a 01                	push   $0x1
+  803aef:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803af2:	50                   	push   %eax
+  803af3:	6a 00                	push   $0x0
+  803af5:	e8 63 d8 ff ff       	call   80135d <read>
+	if (r < 0)
+  803afa:	83 c4 10             	add    $0x10,%esp
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	78 06                	js     803b07 <getchar+0x20>
+	if (r < 1)
+  803b01:	74 06                	je     803b09 <getchar+0x22>
+	return c;
+  803b03:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b07:	c9                   	leave
+  803b08:	c3                   	ret
+		return -E_EOF;
+  803b09:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b0e:	eb f7                	jmp    803b07 <getchar+0x20>
+
+00803b10 <iscons>:
+{
+  803b10:	55                   	push   %ebp
+  803b11:	89 e5                	mov    %esp,%ebp
+  803b13:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b19:	50                   	push   %eax
+  803b1a:	ff 75 08             	push   0x8(%ebp)
+  803b1d:	e8 ab d5 ff ff       	call   8010cd <fd_lookup>
+  803b22:	83 c4 10             	add    $0x10,%esp
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	78 11                	js     803b3a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b2c:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b32:	39 10                	cmp    %edx,(%eax)
+  803b34:	0f 94 c0             	sete   %al
+  803b37:	0f b6 c0             	movzbl %al,%eax
+}
+  803b3a:	c9                   	leave
+  803b3b:	c3                   	ret
+
+00803b3c <opencons>:
+{
+  803b3c:	55                   	push   %ebp
+  803b3d:	89 e5                	mov    %esp,%ebp
+  803b3f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803b42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b45:	50                   	push   %eax
+  803b46:	e8 2c d5 ff ff       	call   801077 <fd_alloc>
+  803b4b:	83 c4 10             	add    $0x10,%esp
+  803b4e:	85 c0                	test   %eax,%eax
+  803b50:	78 3a                	js     803b8c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803b52:	83 ec 04             	sub    $0x4,%esp
+  803b55:	68 07 04 00 00       	push   $0x407
+  803b5a:	ff 75 f4             	push   -0xc(%ebp)
+  803b5d:	6a 00                	push   $0x0
+  803b5f:	e8 4a d0 ff ff       	call   800bae <sys_page_alloc>
+  803b64:	83 c4 10             	add    $0x10,%esp
+  803b67:	85 c0                	test   %eax,%eax
+  803b69:	78 21                	js     803b8c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b6e:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b74:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b79:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b80:	83 ec 0c             	sub    $0xc,%esp
+  803b83:	50                   	push   %eax
+  803b84:	e8 c7 d4 ff ff       	call   801050 <fd2num>
+  803b89:	83 c4 10             	add    $0x10,%esp
+}
+  803b8c:	c9                   	leave
+  803b8d:	c3                   	ret
+
+00803b8e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803b8e:	55                   	push   %ebp
+  803b8f:	89 e5                	mov    %esp,%ebp
+  803b91:	56                   	push   %esi
+  803b92:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803b93:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803b96:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803b9c:	e8 b5 cf ff ff       	call   800b56 <sys_getenvid>
+  803ba1:	83 ec 0c             	sub    $0xc,%esp
+  803ba4:	ff 75 0c             	push   0xc(%ebp)
+  803ba7:	ff 75 08             	push   0x8(%ebp)
+  803baa:	56                   	push   %esi
+  803bab:	50                   	push   %eax
+  803bac:	68 84 4c 80 00       	push   $0x804c84
+  803bb1:	e8 d6 c5 ff ff       	call   80018c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803bb6:	83 c4 18             	add    $0x18,%esp
+  803bb9:	53                   	push   %ebx
+  803bba:	ff 75 10             	push   0x10(%ebp)
+  803bbd:	e8 79 c5 ff ff       	call   80013b <vcprintf>
+	cprintf("\n");
+  803bc2:	c7 04 24 ec 46 80 00 	movl   $0x8046ec,(%esp)
+  803bc9:	e8 be c5 ff ff       	call   80018c <cprintf>
+  803bce:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803bd1:	cc                   	int3
+	while (1)
+  803bd2:	eb fd                	jmp    803bd1 <_panic+0x43>
+
+00803bd4 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bd4:	55                   	push   %ebp
+  803bd5:	89 e5                	mov    %esp,%ebp
+  803bd7:	57                   	push   %edi
+  803bd8:	56                   	push   %esi
+  803bd9:	53                   	push   %ebx
+  803bda:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bdd:	89 d6                	mov    %edx,%esi
+  803bdf:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803be2:	89 cf                	mov    %ecx,%edi
+  803be4:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803be7:	89 fa                	mov    %edi,%edx
+  803be9:	80 ce 08             	or     $0x8,%dh
+  803bec:	f6 c5 08             	test   $0x8,%ch
+  803bef:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bf2:	57                   	push   %edi
+  803bf3:	56                   	push   %esi
+  803bf4:	50                   	push   %eax
+  803bf5:	56                   	push   %esi
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	e8 fe cf ff ff       	call   800bfb <sys_page_map>
+	if (r < 0) {
+  803bfd:	83 c4 20             	add    $0x20,%esp
+  803c00:	85 c0                	test   %eax,%eax
+  803c02:	78 27                	js     803c2b <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c04:	83 ec 0c             	sub    $0xc,%esp
+  803c07:	57                   	push   %edi
+  803c08:	56                   	push   %esi
+  803c09:	6a 00                	push   $0x0
+  803c0b:	56                   	push   %esi
+  803c0c:	6a 00                	push   $0x0
+  803c0e:	e8 e8 cf ff ff       	call   800bfb <sys_page_map>
+  803c13:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c15:	83 c4 20             	add    $0x20,%esp
+  803c18:	85 c0                	test   %eax,%eax
+  803c1a:	78 24                	js     803c40 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c21:	89 d8                	mov    %ebx,%eax
+  803c23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c26:	5b                   	pop    %ebx
+  803c27:	5e                   	pop    %esi
+  803c28:	5f                   	pop    %edi
+  803c29:	5d                   	pop    %ebp
+  803c2a:	c3                   	ret
+  803c2b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c2d:	83 ec 08             	sub    $0x8,%esp
+  803c30:	50                   	push   %eax
+  803c31:	68 a8 4c 80 00       	push   $0x804ca8
+  803c36:	e8 51 c5 ff ff       	call   80018c <cprintf>
+		return r;
+  803c3b:	83 c4 10             	add    $0x10,%esp
+  803c3e:	eb e1                	jmp    803c21 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c40:	83 ec 08             	sub    $0x8,%esp
+  803c43:	50                   	push   %eax
+  803c44:	68 d8 4c 80 00       	push   $0x804cd8
+  803c49:	e8 3e c5 ff ff       	call   80018c <cprintf>
+		return r;
+  803c4e:	83 c4 10             	add    $0x10,%esp
+  803c51:	eb ce                	jmp    803c21 <duppage_cow+0x4d>
+
+00803c53 <duppage>:
+{
+  803c53:	55                   	push   %ebp
+  803c54:	89 e5                	mov    %esp,%ebp
+  803c56:	53                   	push   %ebx
+  803c57:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c5a:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c5d:	51                   	push   %ecx
+  803c5e:	52                   	push   %edx
+  803c5f:	50                   	push   %eax
+  803c60:	52                   	push   %edx
+  803c61:	6a 00                	push   $0x0
+  803c63:	e8 93 cf ff ff       	call   800bfb <sys_page_map>
+	if (r < 0) {
+  803c68:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	78 07                	js     803c7b <duppage+0x28>
+}
+  803c74:	89 d8                	mov    %ebx,%eax
+  803c76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c79:	c9                   	leave
+  803c7a:	c3                   	ret
+  803c7b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c7d:	83 ec 08             	sub    $0x8,%esp
+  803c80:	50                   	push   %eax
+  803c81:	68 a8 4c 80 00       	push   $0x804ca8
+  803c86:	e8 01 c5 ff ff       	call   80018c <cprintf>
+		return r;
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	eb e4                	jmp    803c74 <duppage+0x21>
+
+00803c90 <cow_copy>:
+{
+  803c90:	55                   	push   %ebp
+  803c91:	89 e5                	mov    %esp,%ebp
+  803c93:	56                   	push   %esi
+  803c94:	53                   	push   %ebx
+  803c95:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c97:	83 ec 04             	sub    $0x4,%esp
+  803c9a:	6a 07                	push   $0x7
+  803c9c:	68 00 f0 7f 00       	push   $0x7ff000
+  803ca1:	6a 00                	push   $0x0
+  803ca3:	e8 06 cf ff ff       	call   800bae <sys_page_alloc>
+	if (r < 0) {
+  803ca8:	83 c4 10             	add    $0x10,%esp
+  803cab:	85 c0                	test   %eax,%eax
+  803cad:	78 58                	js     803d07 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803caf:	83 ec 04             	sub    $0x4,%esp
+  803cb2:	68 00 10 00 00       	push   $0x1000
+  803cb7:	56                   	push   %esi
+  803cb8:	68 00 f0 7f 00       	push   $0x7ff000
+  803cbd:	e8 34 cc ff ff       	call   8008f6 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cc2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cc9:	56                   	push   %esi
+  803cca:	6a 00                	push   $0x0
+  803ccc:	68 00 f0 7f 00       	push   $0x7ff000
+  803cd1:	6a 00                	push   $0x0
+  803cd3:	e8 23 cf ff ff       	call   800bfb <sys_page_map>
+  803cd8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cda:	83 c4 20             	add    $0x20,%esp
+  803cdd:	85 c0                	test   %eax,%eax
+  803cdf:	78 3b                	js     803d1c <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803ce1:	83 ec 08             	sub    $0x8,%esp
+  803ce4:	68 00 f0 7f 00       	push   $0x7ff000
+  803ce9:	6a 00                	push   $0x0
+  803ceb:	e8 57 cf ff ff       	call   800c47 <sys_page_unmap>
+  803cf0:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cf2:	83 c4 10             	add    $0x10,%esp
+  803cf5:	85 c0                	test   %eax,%eax
+  803cf7:	78 45                	js     803d3e <cow_copy+0xae>
+	return 0;
+  803cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cfe:	89 d8                	mov    %ebx,%eax
+  803d00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d03:	5b                   	pop    %ebx
+  803d04:	5e                   	pop    %esi
+  803d05:	5d                   	pop    %ebp
+  803d06:	c3                   	ret
+  803d07:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d09:	83 ec 08             	sub    $0x8,%esp
+  803d0c:	50                   	push   %eax
+  803d0d:	68 c8 4d 80 00       	push   $0x804dc8
+  803d12:	e8 75 c4 ff ff       	call   80018c <cprintf>
+		return r;
+  803d17:	83 c4 10             	add    $0x10,%esp
+  803d1a:	eb e2                	jmp    803cfe <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d1c:	83 ec 08             	sub    $0x8,%esp
+  803d1f:	50                   	push   %eax
+  803d20:	68 e4 4d 80 00       	push   $0x804de4
+  803d25:	e8 62 c4 ff ff       	call   80018c <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d2a:	83 c4 08             	add    $0x8,%esp
+  803d2d:	68 00 f0 7f 00       	push   $0x7ff000
+  803d32:	6a 00                	push   $0x0
+  803d34:	e8 0e cf ff ff       	call   800c47 <sys_page_unmap>
+		return r;
+  803d39:	83 c4 10             	add    $0x10,%esp
+  803d3c:	eb c0                	jmp    803cfe <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d3e:	83 ec 08             	sub    $0x8,%esp
+  803d41:	50                   	push   %eax
+  803d42:	68 00 4d 80 00       	push   $0x804d00
+  803d47:	e8 40 c4 ff ff       	call   80018c <cprintf>
+		return r;
+  803d4c:	83 c4 10             	add    $0x10,%esp
+  803d4f:	eb ad                	jmp    803cfe <cow_copy+0x6e>
+
+00803d51 <pgfault>:
+{
+  803d51:	55                   	push   %ebp
+  803d52:	89 e5                	mov    %esp,%ebp
+  803d54:	56                   	push   %esi
+  803d55:	53                   	push   %ebx
+  803d56:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d59:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d5b:	89 d8                	mov    %ebx,%eax
+  803d5d:	c1 e8 16             	shr    $0x16,%eax
+  803d60:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d67:	89 de                	mov    %ebx,%esi
+  803d69:	c1 ee 0c             	shr    $0xc,%esi
+  803d6c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d73:	a8 07                	test   $0x7,%al
+  803d75:	74 3b                	je     803db2 <pgfault+0x61>
+  803d77:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d7d:	74 33                	je     803db2 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d7f:	83 ec 0c             	sub    $0xc,%esp
+  803d82:	68 00 f0 bf ee       	push   $0xeebff000
+  803d87:	e8 82 f4 ff ff       	call   80320e <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d8c:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d93:	83 c4 10             	add    $0x10,%esp
+  803d96:	f6 c4 08             	test   $0x8,%ah
+  803d99:	75 30                	jne    803dcb <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d9b:	83 ec 0c             	sub    $0xc,%esp
+  803d9e:	68 00 f0 bf ee       	push   $0xeebff000
+  803da3:	e8 d3 f4 ff ff       	call   80327b <mutex_unlock>
+}
+  803da8:	83 c4 10             	add    $0x10,%esp
+  803dab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dae:	5b                   	pop    %ebx
+  803daf:	5e                   	pop    %esi
+  803db0:	5d                   	pop    %ebp
+  803db1:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803db2:	83 ec 08             	sub    $0x8,%esp
+  803db5:	ff 72 28             	push   0x28(%edx)
+  803db8:	51                   	push   %ecx
+  803db9:	50                   	push   %eax
+  803dba:	68 24 4d 80 00       	push   $0x804d24
+  803dbf:	6a 3f                	push   $0x3f
+  803dc1:	68 fe 4d 80 00       	push   $0x804dfe
+  803dc6:	e8 c3 fd ff ff       	call   803b8e <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dcb:	89 d8                	mov    %ebx,%eax
+  803dcd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dd2:	e8 b9 fe ff ff       	call   803c90 <cow_copy>
+  803dd7:	eb c2                	jmp    803d9b <pgfault+0x4a>
+
+00803dd9 <cow_enable>:
+{
+  803dd9:	55                   	push   %ebp
+  803dda:	89 e5                	mov    %esp,%ebp
+  803ddc:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803ddf:	68 51 3d 80 00       	push   $0x803d51
+  803de4:	e8 28 06 00 00       	call   804411 <set_pgfault_handler>
+}
+  803de9:	83 c4 10             	add    $0x10,%esp
+  803dec:	c9                   	leave
+  803ded:	c3                   	ret
+
+00803dee <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dee:	55                   	push   %ebp
+  803def:	89 e5                	mov    %esp,%ebp
+  803df1:	57                   	push   %edi
+  803df2:	56                   	push   %esi
+  803df3:	53                   	push   %ebx
+  803df4:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803df7:	68 51 3d 80 00       	push   $0x803d51
+  803dfc:	e8 10 06 00 00       	call   804411 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e01:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e06:	cd 30                	int    $0x30
+  803e08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e0b:	83 c4 10             	add    $0x10,%esp
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	78 4b                	js     803e5d <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e12:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e1c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e1f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e23:	0f 85 16 01 00 00    	jne    803f3f <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e29:	e8 28 cd ff ff       	call   800b56 <sys_getenvid>
+  803e2e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e33:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e35:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e3b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e41:	77 32                	ja     803e75 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e43:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e48:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e4a:	c1 ea 10             	shr    $0x10,%edx
+  803e4d:	74 26                	je     803e75 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e4f:	c1 e2 10             	shl    $0x10,%edx
+  803e52:	89 d1                	mov    %edx,%ecx
+  803e54:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e59:	29 ca                	sub    %ecx,%edx
+  803e5b:	eb 1e                	jmp    803e7b <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e5d:	83 ec 08             	sub    $0x8,%esp
+  803e60:	89 c7                	mov    %eax,%edi
+  803e62:	50                   	push   %eax
+  803e63:	68 09 4e 80 00       	push   $0x804e09
+  803e68:	e8 1f c3 ff ff       	call   80018c <cprintf>
+		return eid;
+  803e6d:	83 c4 10             	add    $0x10,%esp
+  803e70:	e9 6c 01 00 00       	jmp    803fe1 <fork+0x1f3>
+		return pthread_main_tls;
+  803e75:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e7b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e7e:	c1 e0 04             	shl    $0x4,%eax
+  803e81:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e86:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e88:	e8 ca fa ff ff       	call   803957 <pthread_fork_child>
+		return eid;
+  803e8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e90:	e9 4c 01 00 00       	jmp    803fe1 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e95:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e9b:	89 da                	mov    %ebx,%edx
+  803e9d:	89 f8                	mov    %edi,%eax
+  803e9f:	e8 af fd ff ff       	call   803c53 <duppage>
+  803ea4:	85 c0                	test   %eax,%eax
+  803ea6:	79 28                	jns    803ed0 <fork+0xe2>
+  803ea8:	89 c7                	mov    %eax,%edi
+  803eaa:	e9 32 01 00 00       	jmp    803fe1 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803eaf:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eb5:	83 f9 05             	cmp    $0x5,%ecx
+  803eb8:	75 58                	jne    803f12 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803eba:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ebf:	89 da                	mov    %ebx,%edx
+  803ec1:	89 f8                	mov    %edi,%eax
+  803ec3:	e8 8b fd ff ff       	call   803c53 <duppage>
+  803ec8:	85 c0                	test   %eax,%eax
+  803eca:	0f 88 0f 01 00 00    	js     803fdf <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803ed0:	83 c3 01             	add    $0x1,%ebx
+  803ed3:	39 de                	cmp    %ebx,%esi
+  803ed5:	74 54                	je     803f2b <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ed7:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ede:	f6 c1 05             	test   $0x5,%cl
+  803ee1:	74 ed                	je     803ed0 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ee3:	f6 c5 04             	test   $0x4,%ch
+  803ee6:	75 ad                	jne    803e95 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ee8:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803eee:	74 bf                	je     803eaf <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ef0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ef6:	74 d8                	je     803ed0 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ef8:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803efe:	89 da                	mov    %ebx,%edx
+  803f00:	89 f8                	mov    %edi,%eax
+  803f02:	e8 cd fc ff ff       	call   803bd4 <duppage_cow>
+  803f07:	85 c0                	test   %eax,%eax
+  803f09:	79 c5                	jns    803ed0 <fork+0xe2>
+  803f0b:	89 c7                	mov    %eax,%edi
+  803f0d:	e9 cf 00 00 00       	jmp    803fe1 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f12:	68 54 4d 80 00       	push   $0x804d54
+  803f17:	68 3d 4b 80 00       	push   $0x804b3d
+  803f1c:	68 c6 00 00 00       	push   $0xc6
+  803f21:	68 fe 4d 80 00       	push   $0x804dfe
+  803f26:	e8 63 fc ff ff       	call   803b8e <_panic>
+  803f2b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f2e:	83 c1 01             	add    $0x1,%ecx
+  803f31:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f37:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f3d:	74 18                	je     803f57 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f3f:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f46:	a8 07                	test   $0x7,%al
+  803f48:	74 e4                	je     803f2e <fork+0x140>
+  803f4a:	89 cb                	mov    %ecx,%ebx
+  803f4c:	c1 e3 0a             	shl    $0xa,%ebx
+  803f4f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f52:	e9 7c ff ff ff       	jmp    803ed3 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f57:	83 ec 04             	sub    $0x4,%esp
+  803f5a:	6a 07                	push   $0x7
+  803f5c:	68 00 f0 bf ee       	push   $0xeebff000
+  803f61:	ff 75 e4             	push   -0x1c(%ebp)
+  803f64:	e8 45 cc ff ff       	call   800bae <sys_page_alloc>
+  803f69:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f6b:	83 c4 10             	add    $0x10,%esp
+  803f6e:	85 c0                	test   %eax,%eax
+  803f70:	78 34                	js     803fa6 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f72:	83 ec 08             	sub    $0x8,%esp
+  803f75:	68 4f 44 80 00       	push   $0x80444f
+  803f7a:	ff 75 e4             	push   -0x1c(%ebp)
+  803f7d:	e8 a9 cd ff ff       	call   800d2b <sys_env_set_pgfault_upcall>
+  803f82:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f84:	83 c4 10             	add    $0x10,%esp
+  803f87:	85 c0                	test   %eax,%eax
+  803f89:	78 2e                	js     803fb9 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f8b:	83 ec 08             	sub    $0x8,%esp
+  803f8e:	6a 02                	push   $0x2
+  803f90:	ff 75 e4             	push   -0x1c(%ebp)
+  803f93:	e8 fb cc ff ff       	call   800c93 <sys_env_set_status>
+  803f98:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f9a:	83 c4 10             	add    $0x10,%esp
+  803f9d:	85 c0                	test   %eax,%eax
+  803f9f:	78 2b                	js     803fcc <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803fa1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fa4:	eb 3b                	jmp    803fe1 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fa6:	83 ec 08             	sub    $0x8,%esp
+  803fa9:	50                   	push   %eax
+  803faa:	68 7c 4d 80 00       	push   $0x804d7c
+  803faf:	e8 d8 c1 ff ff       	call   80018c <cprintf>
+		return r;
+  803fb4:	83 c4 10             	add    $0x10,%esp
+  803fb7:	eb 28                	jmp    803fe1 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fb9:	83 ec 08             	sub    $0x8,%esp
+  803fbc:	50                   	push   %eax
+  803fbd:	68 a4 4d 80 00       	push   $0x804da4
+  803fc2:	e8 c5 c1 ff ff       	call   80018c <cprintf>
+		return r;
+  803fc7:	83 c4 10             	add    $0x10,%esp
+  803fca:	eb 15                	jmp    803fe1 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fcc:	83 ec 08             	sub    $0x8,%esp
+  803fcf:	50                   	push   %eax
+  803fd0:	68 19 4e 80 00       	push   $0x804e19
+  803fd5:	e8 b2 c1 ff ff       	call   80018c <cprintf>
+		return r;
+  803fda:	83 c4 10             	add    $0x10,%esp
+  803fdd:	eb 02                	jmp    803fe1 <fork+0x1f3>
+  803fdf:	89 c7                	mov    %eax,%edi
+}
+  803fe1:	89 f8                	mov    %edi,%eax
+  803fe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fe6:	5b                   	pop    %ebx
+  803fe7:	5e                   	pop    %esi
+  803fe8:	5f                   	pop    %edi
+  803fe9:	5d                   	pop    %ebp
+  803fea:	c3                   	ret
+
+00803feb <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803feb:	55                   	push   %ebp
+  803fec:	89 e5                	mov    %esp,%ebp
+  803fee:	57                   	push   %edi
+  803fef:	56                   	push   %esi
+  803ff0:	53                   	push   %ebx
+  803ff1:	83 ec 2c             	sub    $0x2c,%esp
+  803ff4:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ff6:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803ffc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804001:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804007:	77 0a                	ja     804013 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804009:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80400e:	29 c3                	sub    %eax,%ebx
+  804010:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804013:	83 ec 0c             	sub    $0xc,%esp
+  804016:	68 51 3d 80 00       	push   $0x803d51
+  80401b:	e8 f1 03 00 00       	call   804411 <set_pgfault_handler>
+  804020:	b8 07 00 00 00       	mov    $0x7,%eax
+  804025:	cd 30                	int    $0x30
+  804027:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	85 c0                	test   %eax,%eax
+  80402f:	78 30                	js     804061 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804031:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804035:	74 42                	je     804079 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804037:	c1 e3 10             	shl    $0x10,%ebx
+  80403a:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80403f:	29 d8                	sub    %ebx,%eax
+  804041:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804044:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804049:	29 d8                	sub    %ebx,%eax
+  80404b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80404e:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804053:	ba 00 00 00 00       	mov    $0x0,%edx
+  804058:	89 f7                	mov    %esi,%edi
+  80405a:	89 d6                	mov    %edx,%esi
+  80405c:	e9 2c 01 00 00       	jmp    80418d <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804061:	83 ec 08             	sub    $0x8,%esp
+  804064:	89 c7                	mov    %eax,%edi
+  804066:	50                   	push   %eax
+  804067:	68 09 4e 80 00       	push   $0x804e09
+  80406c:	e8 1b c1 ff ff       	call   80018c <cprintf>
+		return eid;
+  804071:	83 c4 10             	add    $0x10,%esp
+  804074:	e9 d5 00 00 00       	jmp    80414e <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804079:	e8 d8 ca ff ff       	call   800b56 <sys_getenvid>
+  80407e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804083:	89 c2                	mov    %eax,%edx
+  804085:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804087:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80408d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804092:	77 18                	ja     8040ac <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804094:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804099:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80409b:	c1 e8 10             	shr    $0x10,%eax
+  80409e:	74 0c                	je     8040ac <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040a0:	c1 e0 10             	shl    $0x10,%eax
+  8040a3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040a8:	29 c1                	sub    %eax,%ecx
+  8040aa:	eb 06                	jmp    8040b2 <sfork+0xc7>
+		return pthread_main_tls;
+  8040ac:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+  8040b2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040b5:	c1 e0 04             	shl    $0x4,%eax
+  8040b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040bd:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040bf:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040c2:	e9 87 00 00 00       	jmp    80414e <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040c7:	f6 c5 04             	test   $0x4,%ch
+  8040ca:	74 6c                	je     804138 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040cc:	89 ca                	mov    %ecx,%edx
+  8040ce:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040d4:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040da:	74 7c                	je     804158 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040dc:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040e2:	89 da                	mov    %ebx,%edx
+  8040e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040e7:	e8 67 fb ff ff       	call   803c53 <duppage>
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	0f 88 4f 01 00 00    	js     804243 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040f4:	83 c3 01             	add    $0x1,%ebx
+  8040f7:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040fa:	74 7a                	je     804176 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040fc:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040fe:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804105:	f6 c1 01             	test   $0x1,%cl
+  804108:	74 ea                	je     8040f4 <sfork+0x109>
+  80410a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804110:	74 e2                	je     8040f4 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804112:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804118:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80411b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804120:	76 a5                	jbe    8040c7 <sfork+0xdc>
+  804122:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804128:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80412b:	39 fa                	cmp    %edi,%edx
+  80412d:	73 9d                	jae    8040cc <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80412f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804132:	39 fa                	cmp    %edi,%edx
+  804134:	72 96                	jb     8040cc <sfork+0xe1>
+  804136:	eb 8f                	jmp    8040c7 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804138:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80413e:	89 da                	mov    %ebx,%edx
+  804140:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804143:	e8 8c fa ff ff       	call   803bd4 <duppage_cow>
+  804148:	85 c0                	test   %eax,%eax
+  80414a:	79 a8                	jns    8040f4 <sfork+0x109>
+  80414c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80414e:	89 f8                	mov    %edi,%eax
+  804150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804153:	5b                   	pop    %ebx
+  804154:	5e                   	pop    %esi
+  804155:	5f                   	pop    %edi
+  804156:	5d                   	pop    %ebp
+  804157:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804158:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80415d:	e8 2e fb ff ff       	call   803c90 <cow_copy>
+  804162:	85 c0                	test   %eax,%eax
+  804164:	0f 88 d2 00 00 00    	js     80423c <sfork+0x251>
+				pte = uvpt[pn];
+  80416a:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804171:	e9 66 ff ff ff       	jmp    8040dc <sfork+0xf1>
+  804176:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804179:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80417c:	83 c6 01             	add    $0x1,%esi
+  80417f:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804185:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80418b:	74 1b                	je     8041a8 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80418d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804194:	a8 01                	test   $0x1,%al
+  804196:	74 e4                	je     80417c <sfork+0x191>
+  804198:	89 f3                	mov    %esi,%ebx
+  80419a:	c1 e3 0a             	shl    $0xa,%ebx
+  80419d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8041a0:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8041a3:	e9 4f ff ff ff       	jmp    8040f7 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041a8:	83 ec 04             	sub    $0x4,%esp
+  8041ab:	6a 07                	push   $0x7
+  8041ad:	68 00 f0 bf ee       	push   $0xeebff000
+  8041b2:	ff 75 e0             	push   -0x20(%ebp)
+  8041b5:	e8 f4 c9 ff ff       	call   800bae <sys_page_alloc>
+  8041ba:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041bc:	83 c4 10             	add    $0x10,%esp
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	78 37                	js     8041fa <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041c3:	83 ec 08             	sub    $0x8,%esp
+  8041c6:	68 4f 44 80 00       	push   $0x80444f
+  8041cb:	ff 75 e0             	push   -0x20(%ebp)
+  8041ce:	e8 58 cb ff ff       	call   800d2b <sys_env_set_pgfault_upcall>
+  8041d3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041d5:	83 c4 10             	add    $0x10,%esp
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	78 34                	js     804210 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041dc:	83 ec 08             	sub    $0x8,%esp
+  8041df:	6a 02                	push   $0x2
+  8041e1:	ff 75 e0             	push   -0x20(%ebp)
+  8041e4:	e8 aa ca ff ff       	call   800c93 <sys_env_set_status>
+  8041e9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041eb:	83 c4 10             	add    $0x10,%esp
+  8041ee:	85 c0                	test   %eax,%eax
+  8041f0:	78 34                	js     804226 <sfork+0x23b>
+	return eid;
+  8041f2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041f5:	e9 54 ff ff ff       	jmp    80414e <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041fa:	83 ec 08             	sub    $0x8,%esp
+  8041fd:	50                   	push   %eax
+  8041fe:	68 7c 4d 80 00       	push   $0x804d7c
+  804203:	e8 84 bf ff ff       	call   80018c <cprintf>
+		return r;
+  804208:	83 c4 10             	add    $0x10,%esp
+  80420b:	e9 3e ff ff ff       	jmp    80414e <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804210:	83 ec 08             	sub    $0x8,%esp
+  804213:	50                   	push   %eax
+  804214:	68 a4 4d 80 00       	push   $0x804da4
+  804219:	e8 6e bf ff ff       	call   80018c <cprintf>
+		return r;
+  80421e:	83 c4 10             	add    $0x10,%esp
+  804221:	e9 28 ff ff ff       	jmp    80414e <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804226:	83 ec 08             	sub    $0x8,%esp
+  804229:	50                   	push   %eax
+  80422a:	68 19 4e 80 00       	push   $0x804e19
+  80422f:	e8 58 bf ff ff       	call   80018c <cprintf>
+		return r;
+  804234:	83 c4 10             	add    $0x10,%esp
+  804237:	e9 12 ff ff ff       	jmp    80414e <sfork+0x163>
+  80423c:	89 c7                	mov    %eax,%edi
+  80423e:	e9 0b ff ff ff       	jmp    80414e <sfork+0x163>
+  804243:	89 c7                	mov    %eax,%edi
+  804245:	e9 04 ff ff ff       	jmp    80414e <sfork+0x163>
+
+0080424a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80424a:	55                   	push   %ebp
+  80424b:	89 e5                	mov    %esp,%ebp
+  80424d:	57                   	push   %edi
+  80424e:	56                   	push   %esi
+  80424f:	53                   	push   %ebx
+  804250:	83 ec 18             	sub    $0x18,%esp
+  804253:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804256:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804259:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80425c:	85 c0                	test   %eax,%eax
+  80425e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804263:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804266:	50                   	push   %eax
+  804267:	e8 38 cb ff ff       	call   800da4 <sys_ipc_recv>
+	if (r < 0) {
+  80426c:	83 c4 10             	add    $0x10,%esp
+  80426f:	85 c0                	test   %eax,%eax
+  804271:	78 2b                	js     80429e <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804273:	85 ff                	test   %edi,%edi
+  804275:	74 55                	je     8042cc <ipc_recv+0x82>
+  804277:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804279:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80427f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804284:	77 39                	ja     8042bf <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804286:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80428b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80428d:	c1 e8 10             	shr    $0x10,%eax
+  804290:	74 2d                	je     8042bf <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804292:	c1 e0 10             	shl    $0x10,%eax
+  804295:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80429a:	29 c2                	sub    %eax,%edx
+  80429c:	eb 27                	jmp    8042c5 <ipc_recv+0x7b>
+  80429e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8042a0:	83 ec 08             	sub    $0x8,%esp
+  8042a3:	50                   	push   %eax
+  8042a4:	68 37 4e 80 00       	push   $0x804e37
+  8042a9:	e8 de be ff ff       	call   80018c <cprintf>
+		*from_env_store = 0;
+  8042ae:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042b4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042ba:	83 c4 10             	add    $0x10,%esp
+  8042bd:	eb 77                	jmp    804336 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042bf:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042c5:	8b 02                	mov    (%edx),%eax
+  8042c7:	8b 40 78             	mov    0x78(%eax),%eax
+  8042ca:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042cc:	85 f6                	test   %esi,%esi
+  8042ce:	74 34                	je     804304 <ipc_recv+0xba>
+  8042d0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042d2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042d8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042dd:	77 18                	ja     8042f7 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042df:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042e4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042e6:	c1 e8 10             	shr    $0x10,%eax
+  8042e9:	74 0c                	je     8042f7 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042eb:	c1 e0 10             	shl    $0x10,%eax
+  8042ee:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042f3:	29 c2                	sub    %eax,%edx
+  8042f5:	eb 06                	jmp    8042fd <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042f7:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042fd:	8b 02                	mov    (%edx),%eax
+  8042ff:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804302:	89 06                	mov    %eax,(%esi)
+  804304:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804306:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80430c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804311:	77 18                	ja     80432b <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804313:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804318:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80431a:	c1 e8 10             	shr    $0x10,%eax
+  80431d:	74 0c                	je     80432b <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80431f:	c1 e0 10             	shl    $0x10,%eax
+  804322:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804327:	29 c2                	sub    %eax,%edx
+  804329:	eb 06                	jmp    804331 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80432b:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+	}
+	return thisenv->env_ipc_value;
+  804331:	8b 02                	mov    (%edx),%eax
+  804333:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804336:	89 d8                	mov    %ebx,%eax
+  804338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80433b:	5b                   	pop    %ebx
+  80433c:	5e                   	pop    %esi
+  80433d:	5f                   	pop    %edi
+  80433e:	5d                   	pop    %ebp
+  80433f:	c3                   	ret
+
+00804340 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804340:	55                   	push   %ebp
+  804341:	89 e5                	mov    %esp,%ebp
+  804343:	57                   	push   %edi
+  804344:	56                   	push   %esi
+  804345:	53                   	push   %ebx
+  804346:	83 ec 0c             	sub    $0xc,%esp
+  804349:	8b 75 08             	mov    0x8(%ebp),%esi
+  80434c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80434f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804352:	85 db                	test   %ebx,%ebx
+  804354:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804359:	0f 44 d8             	cmove  %eax,%ebx
+  80435c:	eb 05                	jmp    804363 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80435e:	e8 1f c8 ff ff       	call   800b82 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804363:	57                   	push   %edi
+  804364:	53                   	push   %ebx
+  804365:	ff 75 0c             	push   0xc(%ebp)
+  804368:	56                   	push   %esi
+  804369:	e8 09 ca ff ff       	call   800d77 <sys_ipc_try_send>
+		if (r == 0) {
+  80436e:	83 c4 10             	add    $0x10,%esp
+  804371:	85 c0                	test   %eax,%eax
+  804373:	74 19                	je     80438e <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804375:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804378:	74 e4                	je     80435e <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80437a:	83 ec 0c             	sub    $0xc,%esp
+  80437d:	50                   	push   %eax
+  80437e:	57                   	push   %edi
+  80437f:	53                   	push   %ebx
+  804380:	56                   	push   %esi
+  804381:	68 50 4e 80 00       	push   $0x804e50
+  804386:	e8 01 be ff ff       	call   80018c <cprintf>
+			return;
+  80438b:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80438e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804391:	5b                   	pop    %ebx
+  804392:	5e                   	pop    %esi
+  804393:	5f                   	pop    %edi
+  804394:	5d                   	pop    %ebp
+  804395:	c3                   	ret
+
+00804396 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804396:	55                   	push   %ebp
+  804397:	89 e5                	mov    %esp,%ebp
+  804399:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80439c:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8043a1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043a4:	c1 e0 04             	shl    $0x4,%eax
+  8043a7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043ac:	8b 40 50             	mov    0x50(%eax),%eax
+  8043af:	39 c8                	cmp    %ecx,%eax
+  8043b1:	74 12                	je     8043c5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043b3:	83 c2 01             	add    $0x1,%edx
+  8043b6:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043bc:	75 e3                	jne    8043a1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c3:	eb 0e                	jmp    8043d3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043c5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043c8:	c1 e0 04             	shl    $0x4,%eax
+  8043cb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043d0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043d3:	5d                   	pop    %ebp
+  8043d4:	c3                   	ret
+
+008043d5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043d5:	55                   	push   %ebp
+  8043d6:	89 e5                	mov    %esp,%ebp
+  8043d8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043db:	89 c2                	mov    %eax,%edx
+  8043dd:	c1 ea 16             	shr    $0x16,%edx
+  8043e0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043e7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043ec:	f6 c1 01             	test   $0x1,%cl
+  8043ef:	74 1c                	je     80440d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043f1:	c1 e8 0c             	shr    $0xc,%eax
+  8043f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043fb:	a8 01                	test   $0x1,%al
+  8043fd:	74 0e                	je     80440d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043ff:	c1 e8 0c             	shr    $0xc,%eax
+  804402:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804409:	ef 
+  80440a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80440d:	89 d0                	mov    %edx,%eax
+  80440f:	5d                   	pop    %ebp
+  804410:	c3                   	ret
+
+00804411 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804411:	55                   	push   %ebp
+  804412:	89 e5                	mov    %esp,%ebp
+  804414:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804417:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80441e:	74 0a                	je     80442a <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804420:	8b 45 08             	mov    0x8(%ebp),%eax
+  804423:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804428:	c9                   	leave
+  804429:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80442a:	83 ec 04             	sub    $0x4,%esp
+  80442d:	6a 07                	push   $0x7
+  80442f:	68 00 f0 bf ee       	push   $0xeebff000
+  804434:	6a 00                	push   $0x0
+  804436:	e8 73 c7 ff ff       	call   800bae <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80443b:	83 c4 08             	add    $0x8,%esp
+  80443e:	68 4f 44 80 00       	push   $0x80444f
+  804443:	6a 00                	push   $0x0
+  804445:	e8 e1 c8 ff ff       	call   800d2b <sys_env_set_pgfault_upcall>
+  80444a:	83 c4 10             	add    $0x10,%esp
+  80444d:	eb d1                	jmp    804420 <set_pgfault_handler+0xf>
+
+0080444f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80444f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804450:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804455:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804457:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80445a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80445e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804462:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804465:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804469:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80446b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80446e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80446f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804472:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804473:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804474:	c3                   	ret
+
+00804475 <udm>:
+  804475:	57                   	push   %edi
+  804476:	56                   	push   %esi
+  804477:	53                   	push   %ebx
+  804478:	83 ec 20             	sub    $0x20,%esp
+  80447b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80447f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804483:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804487:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80448b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80448f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804493:	89 d1                	mov    %edx,%ecx
+  804495:	09 c1                	or     %eax,%ecx
+  804497:	0f 84 91 00 00 00    	je     80452e <udm+0xb9>
+  80449d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044ac:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044b3:	00 
+  8044b4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044bb:	00 
+  8044bc:	eb 08                	jmp    8044c6 <udm+0x51>
+  8044be:	83 e9 01             	sub    $0x1,%ecx
+  8044c1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044c4:	74 7c                	je     804542 <udm+0xcd>
+  8044c6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044ca:	01 c0                	add    %eax,%eax
+  8044cc:	89 c6                	mov    %eax,%esi
+  8044ce:	89 d7                	mov    %edx,%edi
+  8044d0:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044d4:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044d8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044db:	d3 ea                	shr    %cl,%edx
+  8044dd:	f6 c1 20             	test   $0x20,%cl
+  8044e0:	74 04                	je     8044e6 <udm+0x71>
+  8044e2:	89 d0                	mov    %edx,%eax
+  8044e4:	31 d2                	xor    %edx,%edx
+  8044e6:	83 e0 01             	and    $0x1,%eax
+  8044e9:	89 04 24             	mov    %eax,(%esp)
+  8044ec:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044f3:	00 
+  8044f4:	8b 04 24             	mov    (%esp),%eax
+  8044f7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044fb:	09 f0                	or     %esi,%eax
+  8044fd:	09 fa                	or     %edi,%edx
+  8044ff:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804503:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804507:	39 f0                	cmp    %esi,%eax
+  804509:	89 d3                	mov    %edx,%ebx
+  80450b:	19 fb                	sbb    %edi,%ebx
+  80450d:	72 af                	jb     8044be <udm+0x49>
+  80450f:	29 f0                	sub    %esi,%eax
+  804511:	19 fa                	sbb    %edi,%edx
+  804513:	89 cf                	mov    %ecx,%edi
+  804515:	c1 ef 05             	shr    $0x5,%edi
+  804518:	83 e7 01             	and    $0x1,%edi
+  80451b:	89 fe                	mov    %edi,%esi
+  80451d:	83 f6 01             	xor    $0x1,%esi
+  804520:	d3 e6                	shl    %cl,%esi
+  804522:	d3 e7                	shl    %cl,%edi
+  804524:	09 74 24 18          	or     %esi,0x18(%esp)
+  804528:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80452c:	eb 90                	jmp    8044be <udm+0x49>
+  80452e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804532:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804536:	89 f0                	mov    %esi,%eax
+  804538:	89 fa                	mov    %edi,%edx
+  80453a:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80453e:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804542:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804546:	89 01                	mov    %eax,(%ecx)
+  804548:	89 51 04             	mov    %edx,0x4(%ecx)
+  80454b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80454f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804553:	83 c4 20             	add    $0x20,%esp
+  804556:	5b                   	pop    %ebx
+  804557:	5e                   	pop    %esi
+  804558:	5f                   	pop    %edi
+  804559:	c3                   	ret
+
+0080455a <__udivdi3>:
+  80455a:	83 ec 18             	sub    $0x18,%esp
+  80455d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804561:	50                   	push   %eax
+  804562:	ff 74 24 2c          	push   0x2c(%esp)
+  804566:	ff 74 24 2c          	push   0x2c(%esp)
+  80456a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80456e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804572:	e8 fe fe ff ff       	call   804475 <udm>
+  804577:	83 c4 24             	add    $0x24,%esp
+  80457a:	c3                   	ret
+
+0080457b <__umoddi3>:
+  80457b:	83 ec 18             	sub    $0x18,%esp
+  80457e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804582:	50                   	push   %eax
+  804583:	ff 74 24 2c          	push   0x2c(%esp)
+  804587:	ff 74 24 2c          	push   0x2c(%esp)
+  80458b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80458f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804593:	e8 dd fe ff ff       	call   804475 <udm>
+  804598:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80459c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045a0:	83 c4 24             	add    $0x24,%esp
+  8045a3:	c3                   	ret
+
+008045a4 <__divdi3>:
+  8045a4:	56                   	push   %esi
+  8045a5:	53                   	push   %ebx
+  8045a6:	83 ec 14             	sub    $0x14,%esp
+  8045a9:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045ad:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045b1:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045b5:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045b9:	85 d2                	test   %edx,%edx
+  8045bb:	78 18                	js     8045d5 <__divdi3+0x31>
+  8045bd:	85 db                	test   %ebx,%ebx
+  8045bf:	78 3e                	js     8045ff <__divdi3+0x5b>
+  8045c1:	83 ec 04             	sub    $0x4,%esp
+  8045c4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c8:	56                   	push   %esi
+  8045c9:	53                   	push   %ebx
+  8045ca:	51                   	push   %ecx
+  8045cb:	e8 a5 fe ff ff       	call   804475 <udm>
+  8045d0:	83 c4 10             	add    $0x10,%esp
+  8045d3:	eb 24                	jmp    8045f9 <__divdi3+0x55>
+  8045d5:	f7 d8                	neg    %eax
+  8045d7:	83 d2 00             	adc    $0x0,%edx
+  8045da:	f7 da                	neg    %edx
+  8045dc:	85 db                	test   %ebx,%ebx
+  8045de:	78 3a                	js     80461a <__divdi3+0x76>
+  8045e0:	83 ec 04             	sub    $0x4,%esp
+  8045e3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e7:	56                   	push   %esi
+  8045e8:	53                   	push   %ebx
+  8045e9:	51                   	push   %ecx
+  8045ea:	e8 86 fe ff ff       	call   804475 <udm>
+  8045ef:	83 c4 10             	add    $0x10,%esp
+  8045f2:	f7 d8                	neg    %eax
+  8045f4:	83 d2 00             	adc    $0x0,%edx
+  8045f7:	f7 da                	neg    %edx
+  8045f9:	83 c4 14             	add    $0x14,%esp
+  8045fc:	5b                   	pop    %ebx
+  8045fd:	5e                   	pop    %esi
+  8045fe:	c3                   	ret
+  8045ff:	83 ec 04             	sub    $0x4,%esp
+  804602:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804606:	56                   	push   %esi
+  804607:	f7 d9                	neg    %ecx
+  804609:	83 d3 00             	adc    $0x0,%ebx
+  80460c:	f7 db                	neg    %ebx
+  80460e:	53                   	push   %ebx
+  80460f:	51                   	push   %ecx
+  804610:	e8 60 fe ff ff       	call   804475 <udm>
+  804615:	83 c4 10             	add    $0x10,%esp
+  804618:	eb d8                	jmp    8045f2 <__divdi3+0x4e>
+  80461a:	83 ec 04             	sub    $0x4,%esp
+  80461d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804621:	56                   	push   %esi
+  804622:	f7 d9                	neg    %ecx
+  804624:	83 d3 00             	adc    $0x0,%ebx
+  804627:	f7 db                	neg    %ebx
+  804629:	53                   	push   %ebx
+  80462a:	51                   	push   %ecx
+  80462b:	e8 45 fe ff ff       	call   804475 <udm>
+  804630:	83 c4 10             	add    $0x10,%esp
+  804633:	eb c4                	jmp    8045f9 <__divdi3+0x55>
+
+00804635 <__moddi3>:
+  804635:	55                   	push   %ebp
+  804636:	57                   	push   %edi
+  804637:	56                   	push   %esi
+  804638:	53                   	push   %ebx
+  804639:	83 ec 24             	sub    $0x24,%esp
+  80463c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804640:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804644:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804648:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80464c:	85 d2                	test   %edx,%edx
+  80464e:	78 3b                	js     80468b <__moddi3+0x56>
+  804650:	83 ec 04             	sub    $0x4,%esp
+  804653:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804657:	56                   	push   %esi
+  804658:	89 ce                	mov    %ecx,%esi
+  80465a:	f7 de                	neg    %esi
+  80465c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804660:	89 de                	mov    %ebx,%esi
+  804662:	83 d6 00             	adc    $0x0,%esi
+  804665:	f7 de                	neg    %esi
+  804667:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80466b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80466f:	0f 48 f1             	cmovs  %ecx,%esi
+  804672:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804677:	53                   	push   %ebx
+  804678:	56                   	push   %esi
+  804679:	e8 f7 fd ff ff       	call   804475 <udm>
+  80467e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804682:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804686:	83 c4 10             	add    $0x10,%esp
+  804689:	eb 47                	jmp    8046d2 <__moddi3+0x9d>
+  80468b:	f7 d8                	neg    %eax
+  80468d:	83 d2 00             	adc    $0x0,%edx
+  804690:	f7 da                	neg    %edx
+  804692:	83 ec 04             	sub    $0x4,%esp
+  804695:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804699:	56                   	push   %esi
+  80469a:	89 cf                	mov    %ecx,%edi
+  80469c:	f7 df                	neg    %edi
+  80469e:	89 de                	mov    %ebx,%esi
+  8046a0:	83 d6 00             	adc    $0x0,%esi
+  8046a3:	f7 de                	neg    %esi
+  8046a5:	0f 49 cf             	cmovns %edi,%ecx
+  8046a8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046ac:	0f 49 de             	cmovns %esi,%ebx
+  8046af:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046b3:	ff 74 24 0c          	push   0xc(%esp)
+  8046b7:	ff 74 24 0c          	push   0xc(%esp)
+  8046bb:	e8 b5 fd ff ff       	call   804475 <udm>
+  8046c0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046c4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046c8:	f7 d8                	neg    %eax
+  8046ca:	83 d2 00             	adc    $0x0,%edx
+  8046cd:	f7 da                	neg    %edx
+  8046cf:	83 c4 10             	add    $0x10,%esp
+  8046d2:	83 c4 24             	add    $0x24,%esp
+  8046d5:	5b                   	pop    %ebx
+  8046d6:	5e                   	pop    %esi
+  8046d7:	5f                   	pop    %edi
+  8046d8:	5d                   	pop    %ebp
+  8046d9:	c3                   	ret
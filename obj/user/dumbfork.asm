@@ -0,0 +1,9903 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c9 01 00 00       	call   8001fa <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 50 0d 00 00       	call   800d9a <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 83 0d 00 00       	call   800de7 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 64 0a 00 00       	call   800ae2 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 a6 0d 00 00       	call   800e33 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 80 48 80 00       	push   $0x804880
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 93 48 80 00       	push   $0x804893
+  8000a8:	e8 f0 01 00 00       	call   80029d <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 a3 48 80 00       	push   $0x8048a3
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 93 48 80 00       	push   $0x804893
+  8000ba:	e8 de 01 00 00       	call   80029d <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 b4 48 80 00       	push   $0x8048b4
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 93 48 80 00       	push   $0x804893
+  8000cc:	e8 cc 01 00 00       	call   80029d <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 3a                	js     80011f <dumbfork+0x4e>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 70                	jne    80015c <dumbfork+0x8b>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 51 0c 00 00       	call   800d42 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	89 c2                	mov    %eax,%edx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000f8:	89 e1                	mov    %esp,%ecx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000fa:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800100:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800105:	77 2a                	ja     800131 <dumbfork+0x60>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800107:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80010c:	29 c8                	sub    %ecx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80010e:	c1 e8 10             	shr    $0x10,%eax
+  800111:	74 1e                	je     800131 <dumbfork+0x60>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800113:	c1 e0 10             	shl    $0x10,%eax
+  800116:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80011b:	29 c1                	sub    %eax,%ecx
+  80011d:	eb 18                	jmp    800137 <dumbfork+0x66>
+		panic("sys_exofork: %e", envid);
+  80011f:	50                   	push   %eax
+  800120:	68 c7 48 80 00       	push   $0x8048c7
+  800125:	6a 37                	push   $0x37
+  800127:	68 93 48 80 00       	push   $0x804893
+  80012c:	e8 6c 01 00 00       	call   80029d <_panic>
+		return pthread_main_tls;
+  800131:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  800137:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80013a:	c1 e0 04             	shl    $0x4,%eax
+  80013d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800142:	89 01                	mov    %eax,(%ecx)
+		return 0;
+  800144:	eb 45                	jmp    80018b <dumbfork+0xba>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  800146:	83 ec 08             	sub    $0x8,%esp
+  800149:	52                   	push   %edx
+  80014a:	53                   	push   %ebx
+  80014b:	e8 e3 fe ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800150:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800153:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  80015f:	81 fa 04 a0 80 00    	cmp    $0x80a004,%edx
+  800165:	72 df                	jb     800146 <dumbfork+0x75>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  800167:	83 ec 08             	sub    $0x8,%esp
+  80016a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80016d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800172:	50                   	push   %eax
+  800173:	53                   	push   %ebx
+  800174:	e8 ba fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  800179:	83 c4 08             	add    $0x8,%esp
+  80017c:	6a 02                	push   $0x2
+  80017e:	53                   	push   %ebx
+  80017f:	e8 fb 0c 00 00       	call   800e7f <sys_env_set_status>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	85 c0                	test   %eax,%eax
+  800189:	78 07                	js     800192 <dumbfork+0xc1>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80018b:	89 d8                	mov    %ebx,%eax
+  80018d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800192:	50                   	push   %eax
+  800193:	68 d7 48 80 00       	push   $0x8048d7
+  800198:	6a 4c                	push   $0x4c
+  80019a:	68 93 48 80 00       	push   $0x804893
+  80019f:	e8 f9 00 00 00       	call   80029d <_panic>
+
+008001a4 <umain>:
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	57                   	push   %edi
+  8001a8:	56                   	push   %esi
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  8001ad:	e8 1f ff ff ff       	call   8000d1 <dumbfork>
+  8001b2:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b4:	85 c0                	test   %eax,%eax
+  8001b6:	bf ee 48 80 00       	mov    $0x8048ee,%edi
+  8001bb:	b8 f5 48 80 00       	mov    $0x8048f5,%eax
+  8001c0:	0f 44 f8             	cmove  %eax,%edi
+  8001c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001c8:	eb 1f                	jmp    8001e9 <umain+0x45>
+  8001ca:	83 fb 13             	cmp    $0x13,%ebx
+  8001cd:	7f 23                	jg     8001f2 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001cf:	83 ec 04             	sub    $0x4,%esp
+  8001d2:	57                   	push   %edi
+  8001d3:	53                   	push   %ebx
+  8001d4:	68 fb 48 80 00       	push   $0x8048fb
+  8001d9:	e8 9a 01 00 00       	call   800378 <cprintf>
+		sys_yield();
+  8001de:	e8 8b 0b 00 00       	call   800d6e <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001e3:	83 c3 01             	add    $0x1,%ebx
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 f6                	test   %esi,%esi
+  8001eb:	74 dd                	je     8001ca <umain+0x26>
+  8001ed:	83 fb 09             	cmp    $0x9,%ebx
+  8001f0:	7e dd                	jle    8001cf <umain+0x2b>
+}
+  8001f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f5:	5b                   	pop    %ebx
+  8001f6:	5e                   	pop    %esi
+  8001f7:	5f                   	pop    %edi
+  8001f8:	5d                   	pop    %ebp
+  8001f9:	c3                   	ret
+
+008001fa <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	83 ec 1c             	sub    $0x1c,%esp
+  800203:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800206:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800209:	e8 34 0b 00 00       	call   800d42 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80020e:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800211:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  800217:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021c:	89 c1                	mov    %eax,%ecx
+  80021e:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800220:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800226:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80022b:	77 16                	ja     800243 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80022d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800232:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800234:	c1 e8 10             	shr    $0x10,%eax
+  800237:	74 0a                	je     800243 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800239:	c1 e0 10             	shl    $0x10,%eax
+  80023c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800241:	29 c2                	sub    %eax,%edx
+  800243:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800246:	c1 e0 04             	shl    $0x4,%eax
+  800249:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80024e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800250:	85 db                	test   %ebx,%ebx
+  800252:	7e 07                	jle    80025b <libmain+0x61>
+		binaryname = argv[0];
+  800254:	8b 06                	mov    (%esi),%eax
+  800256:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	e8 3f ff ff ff       	call   8001a4 <umain>
+
+	// exit gracefully
+	exit();
+  800265:	e8 0b 00 00 00       	call   800275 <exit>
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80027b:	6a 00                	push   $0x0
+  80027d:	e8 15 21 00 00       	call   802397 <fflush>
+	pthread_kill_others();
+  800282:	e8 80 37 00 00       	call   803a07 <pthread_kill_others>
+	close_all();
+  800287:	e8 ae 11 00 00       	call   80143a <close_all>
+	sys_env_destroy(0);
+  80028c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800293:	e8 5f 0a 00 00       	call   800cf7 <sys_env_destroy>
+}
+  800298:	83 c4 10             	add    $0x10,%esp
+  80029b:	c9                   	leave
+  80029c:	c3                   	ret
+
+0080029d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	56                   	push   %esi
+  8002a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a5:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8002ab:	e8 92 0a 00 00       	call   800d42 <sys_getenvid>
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	ff 75 0c             	push   0xc(%ebp)
+  8002b6:	ff 75 08             	push   0x8(%ebp)
+  8002b9:	56                   	push   %esi
+  8002ba:	50                   	push   %eax
+  8002bb:	68 18 49 80 00       	push   $0x804918
+  8002c0:	e8 b3 00 00 00       	call   800378 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002c5:	83 c4 18             	add    $0x18,%esp
+  8002c8:	53                   	push   %ebx
+  8002c9:	ff 75 10             	push   0x10(%ebp)
+  8002cc:	e8 56 00 00 00       	call   800327 <vcprintf>
+	cprintf("\n");
+  8002d1:	c7 04 24 0b 49 80 00 	movl   $0x80490b,(%esp)
+  8002d8:	e8 9b 00 00 00       	call   800378 <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002e0:	cc                   	int3
+	while (1)
+  8002e1:	eb fd                	jmp    8002e0 <_panic+0x43>
+
+008002e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	53                   	push   %ebx
+  8002e7:	83 ec 04             	sub    $0x4,%esp
+  8002ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002ed:	8b 13                	mov    (%ebx),%edx
+  8002ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8002f2:	89 03                	mov    %eax,(%ebx)
+  8002f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800300:	74 09                	je     80030b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800302:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80030b:	83 ec 08             	sub    $0x8,%esp
+  80030e:	68 ff 00 00 00       	push   $0xff
+  800313:	8d 43 08             	lea    0x8(%ebx),%eax
+  800316:	50                   	push   %eax
+  800317:	e8 84 09 00 00       	call   800ca0 <sys_cputs>
+		b->idx = 0;
+  80031c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800322:	83 c4 10             	add    $0x10,%esp
+  800325:	eb db                	jmp    800302 <putch+0x1f>
+
+00800327 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800330:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800337:	00 00 00 
+	b.cnt = 0;
+  80033a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800341:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800344:	ff 75 0c             	push   0xc(%ebp)
+  800347:	ff 75 08             	push   0x8(%ebp)
+  80034a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800350:	50                   	push   %eax
+  800351:	68 e3 02 80 00       	push   $0x8002e3
+  800356:	e8 14 01 00 00       	call   80046f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80035b:	83 c4 08             	add    $0x8,%esp
+  80035e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800364:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80036a:	50                   	push   %eax
+  80036b:	e8 30 09 00 00       	call   800ca0 <sys_cputs>
+
+	return b.cnt;
+}
+  800370:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800376:	c9                   	leave
+  800377:	c3                   	ret
+
+00800378 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80037e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800381:	50                   	push   %eax
+  800382:	ff 75 08             	push   0x8(%ebp)
+  800385:	e8 9d ff ff ff       	call   800327 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80038a:	c9                   	leave
+  80038b:	c3                   	ret
+
+0080038c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	57                   	push   %edi
+  800390:	56                   	push   %esi
+  800391:	53                   	push   %ebx
+  800392:	83 ec 1c             	sub    $0x1c,%esp
+  800395:	89 c7                	mov    %eax,%edi
+  800397:	89 d6                	mov    %edx,%esi
+  800399:	8b 45 08             	mov    0x8(%ebp),%eax
+  80039c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80039f:	89 d1                	mov    %edx,%ecx
+  8003a1:	89 c2                	mov    %eax,%edx
+  8003a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b9:	39 c2                	cmp    %eax,%edx
+  8003bb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003be:	72 3e                	jb     8003fe <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003c0:	83 ec 0c             	sub    $0xc,%esp
+  8003c3:	ff 75 18             	push   0x18(%ebp)
+  8003c6:	83 eb 01             	sub    $0x1,%ebx
+  8003c9:	53                   	push   %ebx
+  8003ca:	50                   	push   %eax
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d1:	ff 75 e0             	push   -0x20(%ebp)
+  8003d4:	ff 75 dc             	push   -0x24(%ebp)
+  8003d7:	ff 75 d8             	push   -0x28(%ebp)
+  8003da:	e8 21 43 00 00       	call   804700 <__udivdi3>
+  8003df:	83 c4 18             	add    $0x18,%esp
+  8003e2:	52                   	push   %edx
+  8003e3:	50                   	push   %eax
+  8003e4:	89 f2                	mov    %esi,%edx
+  8003e6:	89 f8                	mov    %edi,%eax
+  8003e8:	e8 9f ff ff ff       	call   80038c <printnum>
+  8003ed:	83 c4 20             	add    $0x20,%esp
+  8003f0:	eb 13                	jmp    800405 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003f2:	83 ec 08             	sub    $0x8,%esp
+  8003f5:	56                   	push   %esi
+  8003f6:	ff 75 18             	push   0x18(%ebp)
+  8003f9:	ff d7                	call   *%edi
+  8003fb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003fe:	83 eb 01             	sub    $0x1,%ebx
+  800401:	85 db                	test   %ebx,%ebx
+  800403:	7f ed                	jg     8003f2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800405:	83 ec 08             	sub    $0x8,%esp
+  800408:	56                   	push   %esi
+  800409:	83 ec 04             	sub    $0x4,%esp
+  80040c:	ff 75 e4             	push   -0x1c(%ebp)
+  80040f:	ff 75 e0             	push   -0x20(%ebp)
+  800412:	ff 75 dc             	push   -0x24(%ebp)
+  800415:	ff 75 d8             	push   -0x28(%ebp)
+  800418:	e8 04 43 00 00       	call   804721 <__umoddi3>
+  80041d:	83 c4 14             	add    $0x14,%esp
+  800420:	0f be 80 3b 49 80 00 	movsbl 0x80493b(%eax),%eax
+  800427:	50                   	push   %eax
+  800428:	ff d7                	call   *%edi
+}
+  80042a:	83 c4 10             	add    $0x10,%esp
+  80042d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800430:	5b                   	pop    %ebx
+  800431:	5e                   	pop    %esi
+  800432:	5f                   	pop    %edi
+  800433:	5d                   	pop    %ebp
+  800434:	c3                   	ret
+
+00800435 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800435:	55                   	push   %ebp
+  800436:	89 e5                	mov    %esp,%ebp
+  800438:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80043b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80043f:	8b 10                	mov    (%eax),%edx
+  800441:	3b 50 04             	cmp    0x4(%eax),%edx
+  800444:	73 0a                	jae    800450 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800446:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800449:	89 08                	mov    %ecx,(%eax)
+  80044b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044e:	88 02                	mov    %al,(%edx)
+}
+  800450:	5d                   	pop    %ebp
+  800451:	c3                   	ret
+
+00800452 <printfmt>:
+{
+  800452:	55                   	push   %ebp
+  800453:	89 e5                	mov    %esp,%ebp
+  800455:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800458:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80045b:	50                   	push   %eax
+  80045c:	ff 75 10             	push   0x10(%ebp)
+  80045f:	ff 75 0c             	push   0xc(%ebp)
+  800462:	ff 75 08             	push   0x8(%ebp)
+  800465:	e8 05 00 00 00       	call   80046f <vprintfmt>
+}
+  80046a:	83 c4 10             	add    $0x10,%esp
+  80046d:	c9                   	leave
+  80046e:	c3                   	ret
+
+0080046f <vprintfmt>:
+{
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	57                   	push   %edi
+  800473:	56                   	push   %esi
+  800474:	53                   	push   %ebx
+  800475:	83 ec 2c             	sub    $0x2c,%esp
+  800478:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80047e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800481:	eb 0a                	jmp    80048d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800483:	83 ec 08             	sub    $0x8,%esp
+  800486:	53                   	push   %ebx
+  800487:	50                   	push   %eax
+  800488:	ff d6                	call   *%esi
+  80048a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80048d:	83 c7 01             	add    $0x1,%edi
+  800490:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800494:	83 f8 25             	cmp    $0x25,%eax
+  800497:	74 0c                	je     8004a5 <vprintfmt+0x36>
+			if (ch == '\0')
+  800499:	85 c0                	test   %eax,%eax
+  80049b:	75 e6                	jne    800483 <vprintfmt+0x14>
+}
+  80049d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a0:	5b                   	pop    %ebx
+  8004a1:	5e                   	pop    %esi
+  8004a2:	5f                   	pop    %edi
+  8004a3:	5d                   	pop    %ebp
+  8004a4:	c3                   	ret
+		padc = ' ';
+  8004a5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004be:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8004c3:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c9:	0f b6 17             	movzbl (%edi),%edx
+  8004cc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004cf:	3c 55                	cmp    $0x55,%al
+  8004d1:	0f 87 c5 03 00 00    	ja     80089c <vprintfmt+0x42d>
+  8004d7:	0f b6 c0             	movzbl %al,%eax
+  8004da:	ff 24 85 c0 4a 80 00 	jmp    *0x804ac0(,%eax,4)
+  8004e1:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004e7:	eb da                	jmp    8004c3 <vprintfmt+0x54>
+  8004e9:	0f be d2             	movsbl %dl,%edx
+  8004ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004f7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004fa:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004fe:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800501:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800504:	83 f9 09             	cmp    $0x9,%ecx
+  800507:	77 55                	ja     80055e <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800509:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80050c:	eb e9                	jmp    8004f7 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80050e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800511:	8b 00                	mov    (%eax),%eax
+  800513:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8d 40 04             	lea    0x4(%eax),%eax
+  80051c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80051f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800526:	79 9b                	jns    8004c3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800528:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80052b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800535:	eb 8c                	jmp    8004c3 <vprintfmt+0x54>
+			if (width < 0)
+  800537:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053a:	85 d2                	test   %edx,%edx
+  80053c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800541:	0f 49 c2             	cmovns %edx,%eax
+  800544:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800547:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80054a:	e9 74 ff ff ff       	jmp    8004c3 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80054f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800552:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800559:	e9 65 ff ff ff       	jmp    8004c3 <vprintfmt+0x54>
+  80055e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800561:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800564:	eb bc                	jmp    800522 <vprintfmt+0xb3>
+			lflag++;
+  800566:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800569:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80056c:	e9 52 ff ff ff       	jmp    8004c3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800571:	8b 45 14             	mov    0x14(%ebp),%eax
+  800574:	8d 78 04             	lea    0x4(%eax),%edi
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	53                   	push   %ebx
+  80057b:	ff 30                	push   (%eax)
+  80057d:	ff d6                	call   *%esi
+			break;
+  80057f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800582:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800585:	e9 b1 02 00 00       	jmp    80083b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800590:	8b 10                	mov    (%eax),%edx
+  800592:	89 d0                	mov    %edx,%eax
+  800594:	f7 d8                	neg    %eax
+  800596:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800599:	83 f8 14             	cmp    $0x14,%eax
+  80059c:	7f 23                	jg     8005c1 <vprintfmt+0x152>
+  80059e:	8b 14 85 20 4c 80 00 	mov    0x804c20(,%eax,4),%edx
+  8005a5:	85 d2                	test   %edx,%edx
+  8005a7:	74 18                	je     8005c1 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8005a9:	52                   	push   %edx
+  8005aa:	68 8f 4d 80 00       	push   $0x804d8f
+  8005af:	53                   	push   %ebx
+  8005b0:	56                   	push   %esi
+  8005b1:	e8 9c fe ff ff       	call   800452 <printfmt>
+  8005b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005bc:	e9 7a 02 00 00       	jmp    80083b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8005c1:	50                   	push   %eax
+  8005c2:	68 53 49 80 00       	push   $0x804953
+  8005c7:	53                   	push   %ebx
+  8005c8:	56                   	push   %esi
+  8005c9:	e8 84 fe ff ff       	call   800452 <printfmt>
+  8005ce:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005d4:	e9 62 02 00 00       	jmp    80083b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	83 c0 04             	add    $0x4,%eax
+  8005df:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005e7:	85 c9                	test   %ecx,%ecx
+  8005e9:	b8 4c 49 80 00       	mov    $0x80494c,%eax
+  8005ee:	0f 45 c1             	cmovne %ecx,%eax
+  8005f1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005f4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005f8:	7e 06                	jle    800600 <vprintfmt+0x191>
+  8005fa:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005fe:	75 0b                	jne    80060b <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800600:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800603:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800606:	89 75 08             	mov    %esi,0x8(%ebp)
+  800609:	eb 5c                	jmp    800667 <vprintfmt+0x1f8>
+  80060b:	83 ec 08             	sub    $0x8,%esp
+  80060e:	ff 75 d0             	push   -0x30(%ebp)
+  800611:	ff 75 cc             	push   -0x34(%ebp)
+  800614:	e8 20 03 00 00       	call   800939 <strnlen>
+  800619:	89 c2                	mov    %eax,%edx
+  80061b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80061e:	29 d0                	sub    %edx,%eax
+  800620:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800623:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800627:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80062a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80062d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062f:	eb 0e                	jmp    80063f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	57                   	push   %edi
+  800636:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800639:	83 ee 01             	sub    $0x1,%esi
+  80063c:	83 c4 10             	add    $0x10,%esp
+  80063f:	85 f6                	test   %esi,%esi
+  800641:	7f ee                	jg     800631 <vprintfmt+0x1c2>
+  800643:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800646:	8b 75 08             	mov    0x8(%ebp),%esi
+  800649:	85 c0                	test   %eax,%eax
+  80064b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800650:	0f 49 d0             	cmovns %eax,%edx
+  800653:	29 d0                	sub    %edx,%eax
+  800655:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800658:	eb a6                	jmp    800600 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	53                   	push   %ebx
+  80065e:	52                   	push   %edx
+  80065f:	ff 55 08             	call   *0x8(%ebp)
+  800662:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800665:	89 f1                	mov    %esi,%ecx
+  800667:	8d 71 01             	lea    0x1(%ecx),%esi
+  80066a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80066e:	0f be d0             	movsbl %al,%edx
+  800671:	85 d2                	test   %edx,%edx
+  800673:	74 28                	je     80069d <vprintfmt+0x22e>
+  800675:	85 ff                	test   %edi,%edi
+  800677:	78 05                	js     80067e <vprintfmt+0x20f>
+  800679:	83 ef 01             	sub    $0x1,%edi
+  80067c:	78 30                	js     8006ae <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80067e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800682:	74 d6                	je     80065a <vprintfmt+0x1eb>
+  800684:	0f be c0             	movsbl %al,%eax
+  800687:	83 e8 20             	sub    $0x20,%eax
+  80068a:	83 f8 5e             	cmp    $0x5e,%eax
+  80068d:	76 cb                	jbe    80065a <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80068f:	83 ec 08             	sub    $0x8,%esp
+  800692:	53                   	push   %ebx
+  800693:	6a 3f                	push   $0x3f
+  800695:	ff 55 08             	call   *0x8(%ebp)
+  800698:	83 c4 10             	add    $0x10,%esp
+  80069b:	eb c8                	jmp    800665 <vprintfmt+0x1f6>
+  80069d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006a6:	01 d0                	add    %edx,%eax
+  8006a8:	29 c8                	sub    %ecx,%eax
+  8006aa:	89 c7                	mov    %eax,%edi
+  8006ac:	eb 13                	jmp    8006c1 <vprintfmt+0x252>
+  8006ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b1:	eb ed                	jmp    8006a0 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	6a 20                	push   $0x20
+  8006b9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006bb:	83 ef 01             	sub    $0x1,%edi
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	85 ff                	test   %edi,%edi
+  8006c3:	7f ee                	jg     8006b3 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cb:	e9 6b 01 00 00       	jmp    80083b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8006d0:	83 f9 01             	cmp    $0x1,%ecx
+  8006d3:	7f 1f                	jg     8006f4 <vprintfmt+0x285>
+	else if (lflag)
+  8006d5:	85 c9                	test   %ecx,%ecx
+  8006d7:	74 67                	je     800740 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 00                	mov    (%eax),%eax
+  8006de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e1:	89 c1                	mov    %eax,%ecx
+  8006e3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f2:	eb 17                	jmp    80070b <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 50 04             	mov    0x4(%eax),%edx
+  8006fa:	8b 00                	mov    (%eax),%eax
+  8006fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ff:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8d 40 08             	lea    0x8(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80070b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80070e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800711:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	0f 89 03 01 00 00    	jns    800821 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 2d                	push   $0x2d
+  800724:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800726:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800729:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072c:	f7 da                	neg    %edx
+  80072e:	83 d1 00             	adc    $0x0,%ecx
+  800731:	f7 d9                	neg    %ecx
+  800733:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800736:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80073b:	e9 e1 00 00 00       	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 00                	mov    (%eax),%eax
+  800745:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800748:	89 c1                	mov    %eax,%ecx
+  80074a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80074d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+  800759:	eb b0                	jmp    80070b <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80075b:	83 f9 01             	cmp    $0x1,%ecx
+  80075e:	7f 1e                	jg     80077e <vprintfmt+0x30f>
+	else if (lflag)
+  800760:	85 c9                	test   %ecx,%ecx
+  800762:	74 32                	je     800796 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800774:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800779:	e9 a3 00 00 00       	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80077e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800781:	8b 10                	mov    (%eax),%edx
+  800783:	8b 48 04             	mov    0x4(%eax),%ecx
+  800786:	8d 40 08             	lea    0x8(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80078c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800791:	e9 8b 00 00 00       	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007ab:	eb 74                	jmp    800821 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8007ad:	83 f9 01             	cmp    $0x1,%ecx
+  8007b0:	7f 1b                	jg     8007cd <vprintfmt+0x35e>
+	else if (lflag)
+  8007b2:	85 c9                	test   %ecx,%ecx
+  8007b4:	74 2c                	je     8007e2 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007cb:	eb 54                	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007db:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e0:	eb 3f                	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007f7:	eb 28                	jmp    800821 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	53                   	push   %ebx
+  8007fd:	6a 30                	push   $0x30
+  8007ff:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800801:	83 c4 08             	add    $0x8,%esp
+  800804:	53                   	push   %ebx
+  800805:	6a 78                	push   $0x78
+  800807:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800809:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080c:	8b 10                	mov    (%eax),%edx
+  80080e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800813:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800816:	8d 40 04             	lea    0x4(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800821:	83 ec 0c             	sub    $0xc,%esp
+  800824:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800828:	50                   	push   %eax
+  800829:	ff 75 e0             	push   -0x20(%ebp)
+  80082c:	57                   	push   %edi
+  80082d:	51                   	push   %ecx
+  80082e:	52                   	push   %edx
+  80082f:	89 da                	mov    %ebx,%edx
+  800831:	89 f0                	mov    %esi,%eax
+  800833:	e8 54 fb ff ff       	call   80038c <printnum>
+			break;
+  800838:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80083b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80083e:	e9 4a fc ff ff       	jmp    80048d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800843:	83 f9 01             	cmp    $0x1,%ecx
+  800846:	7f 1b                	jg     800863 <vprintfmt+0x3f4>
+	else if (lflag)
+  800848:	85 c9                	test   %ecx,%ecx
+  80084a:	74 2c                	je     800878 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80084c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084f:	8b 10                	mov    (%eax),%edx
+  800851:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800856:	8d 40 04             	lea    0x4(%eax),%eax
+  800859:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80085c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800861:	eb be                	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800863:	8b 45 14             	mov    0x14(%ebp),%eax
+  800866:	8b 10                	mov    (%eax),%edx
+  800868:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086b:	8d 40 08             	lea    0x8(%eax),%eax
+  80086e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800871:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800876:	eb a9                	jmp    800821 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8b 10                	mov    (%eax),%edx
+  80087d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800882:	8d 40 04             	lea    0x4(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800888:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80088d:	eb 92                	jmp    800821 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80088f:	83 ec 08             	sub    $0x8,%esp
+  800892:	53                   	push   %ebx
+  800893:	6a 25                	push   $0x25
+  800895:	ff d6                	call   *%esi
+			break;
+  800897:	83 c4 10             	add    $0x10,%esp
+  80089a:	eb 9f                	jmp    80083b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80089c:	83 ec 08             	sub    $0x8,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	6a 25                	push   $0x25
+  8008a2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a4:	83 c4 10             	add    $0x10,%esp
+  8008a7:	89 f8                	mov    %edi,%eax
+  8008a9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ad:	74 05                	je     8008b4 <vprintfmt+0x445>
+  8008af:	83 e8 01             	sub    $0x1,%eax
+  8008b2:	eb f5                	jmp    8008a9 <vprintfmt+0x43a>
+  8008b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b7:	eb 82                	jmp    80083b <vprintfmt+0x3cc>
+
+008008b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	83 ec 18             	sub    $0x18,%esp
+  8008bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008c8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008cc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d6:	85 c0                	test   %eax,%eax
+  8008d8:	74 26                	je     800900 <vsnprintf+0x47>
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	7e 22                	jle    800900 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008de:	ff 75 14             	push   0x14(%ebp)
+  8008e1:	ff 75 10             	push   0x10(%ebp)
+  8008e4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008e7:	50                   	push   %eax
+  8008e8:	68 35 04 80 00       	push   $0x800435
+  8008ed:	e8 7d fb ff ff       	call   80046f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008fb:	83 c4 10             	add    $0x10,%esp
+}
+  8008fe:	c9                   	leave
+  8008ff:	c3                   	ret
+		return -E_INVAL;
+  800900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800905:	eb f7                	jmp    8008fe <vsnprintf+0x45>
+
+00800907 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800907:	55                   	push   %ebp
+  800908:	89 e5                	mov    %esp,%ebp
+  80090a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80090d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800910:	50                   	push   %eax
+  800911:	ff 75 10             	push   0x10(%ebp)
+  800914:	ff 75 0c             	push   0xc(%ebp)
+  800917:	ff 75 08             	push   0x8(%ebp)
+  80091a:	e8 9a ff ff ff       	call   8008b9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+00800921 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	eb 03                	jmp    800931 <strlen+0x10>
+		n++;
+  80092e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800931:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800935:	75 f7                	jne    80092e <strlen+0xd>
+	return n;
+}
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800942:	b8 00 00 00 00       	mov    $0x0,%eax
+  800947:	eb 03                	jmp    80094c <strnlen+0x13>
+		n++;
+  800949:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094c:	39 d0                	cmp    %edx,%eax
+  80094e:	74 08                	je     800958 <strnlen+0x1f>
+  800950:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800954:	75 f3                	jne    800949 <strnlen+0x10>
+  800956:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800958:	89 d0                	mov    %edx,%eax
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	53                   	push   %ebx
+  800960:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800963:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800966:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80096f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800972:	83 c0 01             	add    $0x1,%eax
+  800975:	84 d2                	test   %dl,%dl
+  800977:	75 f2                	jne    80096b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800979:	89 c8                	mov    %ecx,%eax
+  80097b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097e:	c9                   	leave
+  80097f:	c3                   	ret
+
+00800980 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	83 ec 10             	sub    $0x10,%esp
+  800987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80098a:	53                   	push   %ebx
+  80098b:	e8 91 ff ff ff       	call   800921 <strlen>
+  800990:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800993:	ff 75 0c             	push   0xc(%ebp)
+  800996:	01 d8                	add    %ebx,%eax
+  800998:	50                   	push   %eax
+  800999:	e8 be ff ff ff       	call   80095c <strcpy>
+	return dst;
+}
+  80099e:	89 d8                	mov    %ebx,%eax
+  8009a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b0:	89 f3                	mov    %esi,%ebx
+  8009b2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b5:	89 f0                	mov    %esi,%eax
+  8009b7:	eb 0f                	jmp    8009c8 <strncpy+0x23>
+		*dst++ = *src;
+  8009b9:	83 c0 01             	add    $0x1,%eax
+  8009bc:	0f b6 0a             	movzbl (%edx),%ecx
+  8009bf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c2:	80 f9 01             	cmp    $0x1,%cl
+  8009c5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009c8:	39 d8                	cmp    %ebx,%eax
+  8009ca:	75 ed                	jne    8009b9 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009cc:	89 f0                	mov    %esi,%eax
+  8009ce:	5b                   	pop    %ebx
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5d                   	pop    %ebp
+  8009d1:	c3                   	ret
+
+008009d2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	56                   	push   %esi
+  8009d6:	53                   	push   %ebx
+  8009d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009dd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e0:	89 f0                	mov    %esi,%eax
+  8009e2:	85 d2                	test   %edx,%edx
+  8009e4:	74 21                	je     800a07 <strlcpy+0x35>
+  8009e6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ea:	89 f2                	mov    %esi,%edx
+  8009ec:	eb 09                	jmp    8009f7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ee:	83 c1 01             	add    $0x1,%ecx
+  8009f1:	83 c2 01             	add    $0x1,%edx
+  8009f4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009f7:	39 c2                	cmp    %eax,%edx
+  8009f9:	74 09                	je     800a04 <strlcpy+0x32>
+  8009fb:	0f b6 19             	movzbl (%ecx),%ebx
+  8009fe:	84 db                	test   %bl,%bl
+  800a00:	75 ec                	jne    8009ee <strlcpy+0x1c>
+  800a02:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a04:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a07:	29 f0                	sub    %esi,%eax
+}
+  800a09:	5b                   	pop    %ebx
+  800a0a:	5e                   	pop    %esi
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a13:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a16:	eb 06                	jmp    800a1e <strcmp+0x11>
+		p++, q++;
+  800a18:	83 c1 01             	add    $0x1,%ecx
+  800a1b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a1e:	0f b6 01             	movzbl (%ecx),%eax
+  800a21:	84 c0                	test   %al,%al
+  800a23:	74 04                	je     800a29 <strcmp+0x1c>
+  800a25:	3a 02                	cmp    (%edx),%al
+  800a27:	74 ef                	je     800a18 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a29:	0f b6 c0             	movzbl %al,%eax
+  800a2c:	0f b6 12             	movzbl (%edx),%edx
+  800a2f:	29 d0                	sub    %edx,%eax
+}
+  800a31:	5d                   	pop    %ebp
+  800a32:	c3                   	ret
+
+00800a33 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	53                   	push   %ebx
+  800a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a40:	eb 09                	jmp    800a4b <strncmp+0x18>
+		n--, p++, q++;
+  800a42:	83 ea 01             	sub    $0x1,%edx
+  800a45:	83 c0 01             	add    $0x1,%eax
+  800a48:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a4b:	85 d2                	test   %edx,%edx
+  800a4d:	74 18                	je     800a67 <strncmp+0x34>
+  800a4f:	0f b6 18             	movzbl (%eax),%ebx
+  800a52:	84 db                	test   %bl,%bl
+  800a54:	74 04                	je     800a5a <strncmp+0x27>
+  800a56:	3a 19                	cmp    (%ecx),%bl
+  800a58:	74 e8                	je     800a42 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5a:	0f b6 00             	movzbl (%eax),%eax
+  800a5d:	0f b6 11             	movzbl (%ecx),%edx
+  800a60:	29 d0                	sub    %edx,%eax
+}
+  800a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+		return 0;
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	eb f4                	jmp    800a62 <strncmp+0x2f>
+
+00800a6e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a78:	eb 03                	jmp    800a7d <strchr+0xf>
+  800a7a:	83 c0 01             	add    $0x1,%eax
+  800a7d:	0f b6 10             	movzbl (%eax),%edx
+  800a80:	84 d2                	test   %dl,%dl
+  800a82:	74 06                	je     800a8a <strchr+0x1c>
+		if (*s == c)
+  800a84:	38 ca                	cmp    %cl,%dl
+  800a86:	75 f2                	jne    800a7a <strchr+0xc>
+  800a88:	eb 05                	jmp    800a8f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a97:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9e:	38 ca                	cmp    %cl,%dl
+  800aa0:	74 09                	je     800aab <strfind+0x1a>
+  800aa2:	84 d2                	test   %dl,%dl
+  800aa4:	74 05                	je     800aab <strfind+0x1a>
+	for (; *s; s++)
+  800aa6:	83 c0 01             	add    $0x1,%eax
+  800aa9:	eb f0                	jmp    800a9b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab7:	85 c9                	test   %ecx,%ecx
+  800ab9:	74 20                	je     800adb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800abb:	89 f8                	mov    %edi,%eax
+  800abd:	09 c8                	or     %ecx,%eax
+  800abf:	a8 03                	test   $0x3,%al
+  800ac1:	75 12                	jne    800ad5 <memset+0x28>
+		c &= 0xFF;
+  800ac3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800acd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad0:	fc                   	cld
+  800ad1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad3:	eb 06                	jmp    800adb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad8:	fc                   	cld
+  800ad9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800adb:	89 f8                	mov    %edi,%eax
+  800add:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae0:	c9                   	leave
+  800ae1:	c3                   	ret
+
+00800ae2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	57                   	push   %edi
+  800ae6:	56                   	push   %esi
+  800ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af0:	39 c6                	cmp    %eax,%esi
+  800af2:	73 32                	jae    800b26 <memmove+0x44>
+  800af4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af7:	39 d0                	cmp    %edx,%eax
+  800af9:	73 2b                	jae    800b26 <memmove+0x44>
+		s += n;
+		d += n;
+  800afb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afe:	89 d6                	mov    %edx,%esi
+  800b00:	09 fe                	or     %edi,%esi
+  800b02:	09 ce                	or     %ecx,%esi
+  800b04:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b0a:	75 0e                	jne    800b1a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b0c:	83 ef 04             	sub    $0x4,%edi
+  800b0f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b12:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b15:	fd                   	std
+  800b16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b18:	eb 09                	jmp    800b23 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b1a:	83 ef 01             	sub    $0x1,%edi
+  800b1d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b20:	fd                   	std
+  800b21:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b23:	fc                   	cld
+  800b24:	eb 1a                	jmp    800b40 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b26:	89 f2                	mov    %esi,%edx
+  800b28:	09 c2                	or     %eax,%edx
+  800b2a:	09 ca                	or     %ecx,%edx
+  800b2c:	f6 c2 03             	test   $0x3,%dl
+  800b2f:	75 0a                	jne    800b3b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b31:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b34:	89 c7                	mov    %eax,%edi
+  800b36:	fc                   	cld
+  800b37:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b39:	eb 05                	jmp    800b40 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b3b:	89 c7                	mov    %eax,%edi
+  800b3d:	fc                   	cld
+  800b3e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b40:	5e                   	pop    %esi
+  800b41:	5f                   	pop    %edi
+  800b42:	5d                   	pop    %ebp
+  800b43:	c3                   	ret
+
+00800b44 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b4a:	ff 75 10             	push   0x10(%ebp)
+  800b4d:	ff 75 0c             	push   0xc(%ebp)
+  800b50:	ff 75 08             	push   0x8(%ebp)
+  800b53:	e8 8a ff ff ff       	call   800ae2 <memmove>
+}
+  800b58:	c9                   	leave
+  800b59:	c3                   	ret
+
+00800b5a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	56                   	push   %esi
+  800b5e:	53                   	push   %ebx
+  800b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b62:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b65:	89 c6                	mov    %eax,%esi
+  800b67:	03 75 10             	add    0x10(%ebp),%esi
+  800b6a:	eb 06                	jmp    800b72 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b6c:	83 c0 01             	add    $0x1,%eax
+  800b6f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b72:	39 f0                	cmp    %esi,%eax
+  800b74:	74 14                	je     800b8a <memcmp+0x30>
+		if (*s1 != *s2)
+  800b76:	0f b6 08             	movzbl (%eax),%ecx
+  800b79:	0f b6 1a             	movzbl (%edx),%ebx
+  800b7c:	38 d9                	cmp    %bl,%cl
+  800b7e:	74 ec                	je     800b6c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b80:	0f b6 c1             	movzbl %cl,%eax
+  800b83:	0f b6 db             	movzbl %bl,%ebx
+  800b86:	29 d8                	sub    %ebx,%eax
+  800b88:	eb 05                	jmp    800b8f <memcmp+0x35>
+	}
+
+	return 0;
+  800b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b9c:	89 c2                	mov    %eax,%edx
+  800b9e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba1:	eb 03                	jmp    800ba6 <memfind+0x13>
+  800ba3:	83 c0 01             	add    $0x1,%eax
+  800ba6:	39 d0                	cmp    %edx,%eax
+  800ba8:	73 04                	jae    800bae <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800baa:	38 08                	cmp    %cl,(%eax)
+  800bac:	75 f5                	jne    800ba3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bae:	5d                   	pop    %ebp
+  800baf:	c3                   	ret
+
+00800bb0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	57                   	push   %edi
+  800bb4:	56                   	push   %esi
+  800bb5:	53                   	push   %ebx
+  800bb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bbc:	eb 03                	jmp    800bc1 <strtol+0x11>
+		s++;
+  800bbe:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc1:	0f b6 02             	movzbl (%edx),%eax
+  800bc4:	3c 20                	cmp    $0x20,%al
+  800bc6:	74 f6                	je     800bbe <strtol+0xe>
+  800bc8:	3c 09                	cmp    $0x9,%al
+  800bca:	74 f2                	je     800bbe <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bcc:	3c 2b                	cmp    $0x2b,%al
+  800bce:	74 2a                	je     800bfa <strtol+0x4a>
+	int neg = 0;
+  800bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd5:	3c 2d                	cmp    $0x2d,%al
+  800bd7:	74 2b                	je     800c04 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bdf:	75 0f                	jne    800bf0 <strtol+0x40>
+  800be1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be4:	74 28                	je     800c0e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800be6:	85 db                	test   %ebx,%ebx
+  800be8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bed:	0f 44 d8             	cmove  %eax,%ebx
+  800bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bf8:	eb 46                	jmp    800c40 <strtol+0x90>
+		s++;
+  800bfa:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c02:	eb d5                	jmp    800bd9 <strtol+0x29>
+		s++, neg = 1;
+  800c04:	83 c2 01             	add    $0x1,%edx
+  800c07:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0c:	eb cb                	jmp    800bd9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c12:	74 0e                	je     800c22 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c14:	85 db                	test   %ebx,%ebx
+  800c16:	75 d8                	jne    800bf0 <strtol+0x40>
+		s++, base = 8;
+  800c18:	83 c2 01             	add    $0x1,%edx
+  800c1b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c20:	eb ce                	jmp    800bf0 <strtol+0x40>
+		s += 2, base = 16;
+  800c22:	83 c2 02             	add    $0x2,%edx
+  800c25:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2a:	eb c4                	jmp    800bf0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c2c:	0f be c0             	movsbl %al,%eax
+  800c2f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c32:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c35:	7d 3a                	jge    800c71 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c37:	83 c2 01             	add    $0x1,%edx
+  800c3a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c3e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c40:	0f b6 02             	movzbl (%edx),%eax
+  800c43:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c46:	89 f3                	mov    %esi,%ebx
+  800c48:	80 fb 09             	cmp    $0x9,%bl
+  800c4b:	76 df                	jbe    800c2c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c4d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c50:	89 f3                	mov    %esi,%ebx
+  800c52:	80 fb 19             	cmp    $0x19,%bl
+  800c55:	77 08                	ja     800c5f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c57:	0f be c0             	movsbl %al,%eax
+  800c5a:	83 e8 57             	sub    $0x57,%eax
+  800c5d:	eb d3                	jmp    800c32 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c5f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c62:	89 f3                	mov    %esi,%ebx
+  800c64:	80 fb 19             	cmp    $0x19,%bl
+  800c67:	77 08                	ja     800c71 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c69:	0f be c0             	movsbl %al,%eax
+  800c6c:	83 e8 37             	sub    $0x37,%eax
+  800c6f:	eb c1                	jmp    800c32 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c71:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c75:	74 05                	je     800c7c <strtol+0xcc>
+		*endptr = (char *) s;
+  800c77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c7c:	89 c8                	mov    %ecx,%eax
+  800c7e:	f7 d8                	neg    %eax
+  800c80:	85 ff                	test   %edi,%edi
+  800c82:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c85:	89 c8                	mov    %ecx,%eax
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+
+00800c8c <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c92:	6a 00                	push   $0x0
+  800c94:	6a 00                	push   $0x0
+  800c96:	ff 75 08             	push   0x8(%ebp)
+  800c99:	e8 12 ff ff ff       	call   800bb0 <strtol>
+}
+  800c9e:	c9                   	leave
+  800c9f:	c3                   	ret
+
+00800ca0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	57                   	push   %edi
+  800ca4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb0:	89 c3                	mov    %eax,%ebx
+  800cb2:	89 c7                	mov    %eax,%edi
+  800cb4:	6a 00                	push   $0x0
+  800cb6:	55                   	push   %ebp
+  800cb7:	56                   	push   %esi
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	8d 35 c2 0c 80 00    	lea    0x800cc2,%esi
+  800cc0:	0f 34                	sysenter
+
+00800cc2 <after_sysenter_label_47>:
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cc7:	5b                   	pop    %ebx
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cda:	89 d1                	mov    %edx,%ecx
+  800cdc:	89 d3                	mov    %edx,%ebx
+  800cde:	89 d7                	mov    %edx,%edi
+  800ce0:	6a 00                	push   $0x0
+  800ce2:	55                   	push   %ebp
+  800ce3:	56                   	push   %esi
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+
+00800cee <after_sysenter_label_128>:
+  800cee:	5e                   	pop    %esi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cf3:	5b                   	pop    %ebx
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+
+00800cf7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	57                   	push   %edi
+  800cfb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d04:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d09:	89 cb                	mov    %ecx,%ebx
+  800d0b:	89 cf                	mov    %ecx,%edi
+  800d0d:	6a 00                	push   $0x0
+  800d0f:	55                   	push   %ebp
+  800d10:	56                   	push   %esi
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	8d 35 1b 0d 80 00    	lea    0x800d1b,%esi
+  800d19:	0f 34                	sysenter
+
+00800d1b <after_sysenter_label_212>:
+  800d1b:	5e                   	pop    %esi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	7f 07                	jg     800d2b <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d27:	5b                   	pop    %ebx
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	50                   	push   %eax
+  800d2f:	6a 03                	push   $0x3
+  800d31:	68 b5 4c 80 00       	push   $0x804cb5
+  800d36:	6a 54                	push   $0x54
+  800d38:	68 d2 4c 80 00       	push   $0x804cd2
+  800d3d:	e8 5b f5 ff ff       	call   80029d <_panic>
+
+00800d42 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d51:	89 d1                	mov    %edx,%ecx
+  800d53:	89 d3                	mov    %edx,%ebx
+  800d55:	89 d7                	mov    %edx,%edi
+  800d57:	6a 00                	push   $0x0
+  800d59:	55                   	push   %ebp
+  800d5a:	56                   	push   %esi
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	8d 35 65 0d 80 00    	lea    0x800d65,%esi
+  800d63:	0f 34                	sysenter
+
+00800d65 <after_sysenter_label_309>:
+  800d65:	5e                   	pop    %esi
+  800d66:	5d                   	pop    %ebp
+  800d67:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d78:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d7d:	89 d1                	mov    %edx,%ecx
+  800d7f:	89 d3                	mov    %edx,%ebx
+  800d81:	89 d7                	mov    %edx,%edi
+  800d83:	6a 00                	push   $0x0
+  800d85:	55                   	push   %ebp
+  800d86:	56                   	push   %esi
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	8d 35 91 0d 80 00    	lea    0x800d91,%esi
+  800d8f:	0f 34                	sysenter
+
+00800d91 <after_sysenter_label_391>:
+  800d91:	5e                   	pop    %esi
+  800d92:	5d                   	pop    %ebp
+  800d93:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d96:	5b                   	pop    %ebx
+  800d97:	5f                   	pop    %edi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+
+00800d9a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	57                   	push   %edi
+  800d9e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800daa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800daf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db2:	6a 00                	push   $0x0
+  800db4:	55                   	push   %ebp
+  800db5:	56                   	push   %esi
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8d 35 c0 0d 80 00    	lea    0x800dc0,%esi
+  800dbe:	0f 34                	sysenter
+
+00800dc0 <after_sysenter_label_479>:
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	7f 07                	jg     800dd0 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 04                	push   $0x4
+  800dd6:	68 b5 4c 80 00       	push   $0x804cb5
+  800ddb:	6a 54                	push   $0x54
+  800ddd:	68 d2 4c 80 00       	push   $0x804cd2
+  800de2:	e8 b6 f4 ff ff       	call   80029d <_panic>
+
+00800de7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800def:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dfd:	ff 75 18             	push   0x18(%ebp)
+  800e00:	55                   	push   %ebp
+  800e01:	56                   	push   %esi
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	8d 35 0c 0e 80 00    	lea    0x800e0c,%esi
+  800e0a:	0f 34                	sysenter
+
+00800e0c <after_sysenter_label_593>:
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 07                	jg     800e1c <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	50                   	push   %eax
+  800e20:	6a 05                	push   $0x5
+  800e22:	68 b5 4c 80 00       	push   $0x804cb5
+  800e27:	6a 54                	push   $0x54
+  800e29:	68 d2 4c 80 00       	push   $0x804cd2
+  800e2e:	e8 6a f4 ff ff       	call   80029d <_panic>
+
+00800e33 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	55                   	push   %ebp
+  800e4d:	56                   	push   %esi
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	8d 35 58 0e 80 00    	lea    0x800e58,%esi
+  800e56:	0f 34                	sysenter
+
+00800e58 <after_sysenter_label_704>:
+  800e58:	5e                   	pop    %esi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e5d:	85 c0                	test   %eax,%eax
+  800e5f:	7f 07                	jg     800e68 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e64:	5b                   	pop    %ebx
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+  800e6b:	50                   	push   %eax
+  800e6c:	6a 06                	push   $0x6
+  800e6e:	68 b5 4c 80 00       	push   $0x804cb5
+  800e73:	6a 54                	push   $0x54
+  800e75:	68 d2 4c 80 00       	push   $0x804cd2
+  800e7a:	e8 1e f4 ff ff       	call   80029d <_panic>
+
+00800e7f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	6a 00                	push   $0x0
+  800e98:	55                   	push   %ebp
+  800e99:	56                   	push   %esi
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	8d 35 a4 0e 80 00    	lea    0x800ea4,%esi
+  800ea2:	0f 34                	sysenter
+
+00800ea4 <after_sysenter_label_808>:
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	7f 07                	jg     800eb4 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ead:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 08                	push   $0x8
+  800eba:	68 b5 4c 80 00       	push   $0x804cb5
+  800ebf:	6a 54                	push   $0x54
+  800ec1:	68 d2 4c 80 00       	push   $0x804cd2
+  800ec6:	e8 d2 f3 ff ff       	call   80029d <_panic>
+
+00800ecb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ed0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee0:	89 df                	mov    %ebx,%edi
+  800ee2:	6a 00                	push   $0x0
+  800ee4:	55                   	push   %ebp
+  800ee5:	56                   	push   %esi
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	8d 35 f0 0e 80 00    	lea    0x800ef0,%esi
+  800eee:	0f 34                	sysenter
+
+00800ef0 <after_sysenter_label_912>:
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	7f 07                	jg     800f00 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800efc:	5b                   	pop    %ebx
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 09                	push   $0x9
+  800f06:	68 b5 4c 80 00       	push   $0x804cb5
+  800f0b:	6a 54                	push   $0x54
+  800f0d:	68 d2 4c 80 00       	push   $0x804cd2
+  800f12:	e8 86 f3 ff ff       	call   80029d <_panic>
+
+00800f17 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f2c:	89 df                	mov    %ebx,%edi
+  800f2e:	6a 00                	push   $0x0
+  800f30:	55                   	push   %ebp
+  800f31:	56                   	push   %esi
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	8d 35 3c 0f 80 00    	lea    0x800f3c,%esi
+  800f3a:	0f 34                	sysenter
+
+00800f3c <after_sysenter_label_1016>:
+  800f3c:	5e                   	pop    %esi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 07                	jg     800f4c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4c:	83 ec 0c             	sub    $0xc,%esp
+  800f4f:	50                   	push   %eax
+  800f50:	6a 0a                	push   $0xa
+  800f52:	68 b5 4c 80 00       	push   $0x804cb5
+  800f57:	6a 54                	push   $0x54
+  800f59:	68 d2 4c 80 00       	push   $0x804cd2
+  800f5e:	e8 3a f3 ff ff       	call   80029d <_panic>
+
+00800f63 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f79:	6a 00                	push   $0x0
+  800f7b:	55                   	push   %ebp
+  800f7c:	56                   	push   %esi
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	8d 35 87 0f 80 00    	lea    0x800f87,%esi
+  800f85:	0f 34                	sysenter
+
+00800f87 <after_sysenter_label_1126>:
+  800f87:	5e                   	pop    %esi
+  800f88:	5d                   	pop    %ebp
+  800f89:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5f                   	pop    %edi
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	c3                   	ret
+
+00800f90 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	57                   	push   %edi
+  800f94:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fa2:	89 cb                	mov    %ecx,%ebx
+  800fa4:	89 cf                	mov    %ecx,%edi
+  800fa6:	6a 00                	push   $0x0
+  800fa8:	55                   	push   %ebp
+  800fa9:	56                   	push   %esi
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	8d 35 b4 0f 80 00    	lea    0x800fb4,%esi
+  800fb2:	0f 34                	sysenter
+
+00800fb4 <after_sysenter_label_1210>:
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	7f 07                	jg     800fc4 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc0:	5b                   	pop    %ebx
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 0d                	push   $0xd
+  800fca:	68 b5 4c 80 00       	push   $0x804cb5
+  800fcf:	6a 54                	push   $0x54
+  800fd1:	68 d2 4c 80 00       	push   $0x804cd2
+  800fd6:	e8 c2 f2 ff ff       	call   80029d <_panic>
+
+00800fdb <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800feb:	b8 42 00 00 00       	mov    $0x42,%eax
+  800ff0:	89 df                	mov    %ebx,%edi
+  800ff2:	6a 00                	push   $0x0
+  800ff4:	55                   	push   %ebp
+  800ff5:	56                   	push   %esi
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	8d 35 00 10 80 00    	lea    0x801000,%esi
+  800ffe:	0f 34                	sysenter
+
+00801000 <after_sysenter_label_1311>:
+  801000:	5e                   	pop    %esi
+  801001:	5d                   	pop    %ebp
+  801002:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801005:	85 c0                	test   %eax,%eax
+  801007:	7f 07                	jg     801010 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80100c:	5b                   	pop    %ebx
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 42                	push   $0x42
+  801016:	68 b5 4c 80 00       	push   $0x804cb5
+  80101b:	6a 54                	push   $0x54
+  80101d:	68 d2 4c 80 00       	push   $0x804cd2
+  801022:	e8 76 f2 ff ff       	call   80029d <_panic>
+
+00801027 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801031:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801036:	89 d1                	mov    %edx,%ecx
+  801038:	89 d3                	mov    %edx,%ebx
+  80103a:	89 d7                	mov    %edx,%edi
+  80103c:	6a 00                	push   $0x0
+  80103e:	55                   	push   %ebp
+  80103f:	56                   	push   %esi
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	8d 35 4a 10 80 00    	lea    0x80104a,%esi
+  801048:	0f 34                	sysenter
+
+0080104a <after_sysenter_label_1411>:
+  80104a:	5e                   	pop    %esi
+  80104b:	5d                   	pop    %ebp
+  80104c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80104f:	5b                   	pop    %ebx
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+
+00801053 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801068:	89 df                	mov    %ebx,%edi
+  80106a:	6a 00                	push   $0x0
+  80106c:	55                   	push   %ebp
+  80106d:	56                   	push   %esi
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	8d 35 78 10 80 00    	lea    0x801078,%esi
+  801076:	0f 34                	sysenter
+
+00801078 <after_sysenter_label_1497>:
+  801078:	5e                   	pop    %esi
+  801079:	5d                   	pop    %ebp
+  80107a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80107d:	5b                   	pop    %ebx
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+
+00801081 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	57                   	push   %edi
+  801085:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 10 00 00 00       	mov    $0x10,%eax
+  801096:	89 df                	mov    %ebx,%edi
+  801098:	6a 00                	push   $0x0
+  80109a:	55                   	push   %ebp
+  80109b:	56                   	push   %esi
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	8d 35 a6 10 80 00    	lea    0x8010a6,%esi
+  8010a4:	0f 34                	sysenter
+
+008010a6 <after_sysenter_label_1583>:
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	57                   	push   %edi
+  8010b3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c7:	6a 00                	push   $0x0
+  8010c9:	55                   	push   %ebp
+  8010ca:	56                   	push   %esi
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	8d 35 d5 10 80 00    	lea    0x8010d5,%esi
+  8010d3:	0f 34                	sysenter
+
+008010d5 <after_sysenter_label_1672>:
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8010da:	5b                   	pop    %ebx
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+
+008010de <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010f3:	89 df                	mov    %ebx,%edi
+  8010f5:	6a 00                	push   $0x0
+  8010f7:	55                   	push   %ebp
+  8010f8:	56                   	push   %esi
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	8d 35 03 11 80 00    	lea    0x801103,%esi
+  801101:	0f 34                	sysenter
+
+00801103 <after_sysenter_label_1758>:
+  801103:	5e                   	pop    %esi
+  801104:	5d                   	pop    %ebp
+  801105:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801108:	5b                   	pop    %ebx
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+
+0080110c <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	57                   	push   %edi
+  801110:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801119:	b8 13 00 00 00       	mov    $0x13,%eax
+  80111e:	89 cb                	mov    %ecx,%ebx
+  801120:	89 cf                	mov    %ecx,%edi
+  801122:	6a 00                	push   $0x0
+  801124:	55                   	push   %ebp
+  801125:	56                   	push   %esi
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	8d 35 30 11 80 00    	lea    0x801130,%esi
+  80112e:	0f 34                	sysenter
+
+00801130 <after_sysenter_label_1842>:
+  801130:	5e                   	pop    %esi
+  801131:	5d                   	pop    %ebp
+  801132:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801135:	85 c0                	test   %eax,%eax
+  801137:	7f 07                	jg     801140 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801139:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113c:	5b                   	pop    %ebx
+  80113d:	5f                   	pop    %edi
+  80113e:	5d                   	pop    %ebp
+  80113f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801140:	83 ec 0c             	sub    $0xc,%esp
+  801143:	50                   	push   %eax
+  801144:	6a 13                	push   $0x13
+  801146:	68 b5 4c 80 00       	push   $0x804cb5
+  80114b:	6a 54                	push   $0x54
+  80114d:	68 d2 4c 80 00       	push   $0x804cd2
+  801152:	e8 46 f1 ff ff       	call   80029d <_panic>
+
+00801157 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80115c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801161:	b8 14 00 00 00       	mov    $0x14,%eax
+  801166:	89 d1                	mov    %edx,%ecx
+  801168:	89 d3                	mov    %edx,%ebx
+  80116a:	89 d7                	mov    %edx,%edi
+  80116c:	6a 00                	push   $0x0
+  80116e:	55                   	push   %ebp
+  80116f:	56                   	push   %esi
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	8d 35 7a 11 80 00    	lea    0x80117a,%esi
+  801178:	0f 34                	sysenter
+
+0080117a <after_sysenter_label_1939>:
+  80117a:	5e                   	pop    %esi
+  80117b:	5d                   	pop    %ebp
+  80117c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80117f:	5b                   	pop    %ebx
+  801180:	5f                   	pop    %edi
+  801181:	5d                   	pop    %ebp
+  801182:	c3                   	ret
+
+00801183 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801193:	bf 00 00 00 00       	mov    $0x0,%edi
+  801198:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119b:	6a 00                	push   $0x0
+  80119d:	55                   	push   %ebp
+  80119e:	56                   	push   %esi
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	8d 35 a9 11 80 00    	lea    0x8011a9,%esi
+  8011a7:	0f 34                	sysenter
+
+008011a9 <after_sysenter_label_2028>:
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+
+008011b2 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011c7:	89 df                	mov    %ebx,%edi
+  8011c9:	6a 00                	push   $0x0
+  8011cb:	55                   	push   %ebp
+  8011cc:	56                   	push   %esi
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	8d 35 d7 11 80 00    	lea    0x8011d7,%esi
+  8011d5:	0f 34                	sysenter
+
+008011d7 <after_sysenter_label_2114>:
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8011dc:	5b                   	pop    %ebx
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+
+008011e0 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	57                   	push   %edi
+  8011e4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011f5:	89 df                	mov    %ebx,%edi
+  8011f7:	6a 00                	push   $0x0
+  8011f9:	55                   	push   %ebp
+  8011fa:	56                   	push   %esi
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8d 35 05 12 80 00    	lea    0x801205,%esi
+  801203:	0f 34                	sysenter
+
+00801205 <after_sysenter_label_2200>:
+  801205:	5e                   	pop    %esi
+  801206:	5d                   	pop    %ebp
+  801207:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80120a:	5b                   	pop    %ebx
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+
+0080120e <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801223:	89 df                	mov    %ebx,%edi
+  801225:	6a 00                	push   $0x0
+  801227:	55                   	push   %ebp
+  801228:	56                   	push   %esi
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	8d 35 33 12 80 00    	lea    0x801233,%esi
+  801231:	0f 34                	sysenter
+
+00801233 <after_sysenter_label_2286>:
+  801233:	5e                   	pop    %esi
+  801234:	5d                   	pop    %ebp
+  801235:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801238:	5b                   	pop    %ebx
+  801239:	5f                   	pop    %edi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80123f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801242:	05 00 00 00 30       	add    $0x30000000,%eax
+  801247:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80124f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801252:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801257:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80125c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801266:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80126b:	eb 02                	jmp    80126f <fd_alloc+0xc>
+  80126d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80126f:	89 c2                	mov    %eax,%edx
+  801271:	c1 ea 16             	shr    $0x16,%edx
+  801274:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80127b:	f6 c2 01             	test   $0x1,%dl
+  80127e:	74 2b                	je     8012ab <fd_alloc+0x48>
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	c1 ea 0c             	shr    $0xc,%edx
+  801285:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80128c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801292:	f6 c1 01             	test   $0x1,%cl
+  801295:	74 14                	je     8012ab <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801297:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80129d:	75 ce                	jne    80126d <fd_alloc+0xa>
+  80129f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012a9:	eb 05                	jmp    8012b0 <fd_alloc+0x4d>
+			return 0;
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b3:	89 02                	mov    %eax,(%edx)
+}
+  8012b5:	89 c8                	mov    %ecx,%eax
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	c3                   	ret
+
+008012b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012bf:	83 f8 1f             	cmp    $0x1f,%eax
+  8012c2:	77 30                	ja     8012f4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012c4:	c1 e0 0c             	shl    $0xc,%eax
+  8012c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012d2:	f6 c2 01             	test   $0x1,%dl
+  8012d5:	74 24                	je     8012fb <fd_lookup+0x42>
+  8012d7:	89 c2                	mov    %eax,%edx
+  8012d9:	c1 ea 0c             	shr    $0xc,%edx
+  8012dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012e3:	f6 c2 01             	test   $0x1,%dl
+  8012e6:	74 1a                	je     801302 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		return -E_INVAL;
+  8012f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f9:	eb f7                	jmp    8012f2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801300:	eb f0                	jmp    8012f2 <fd_lookup+0x39>
+  801302:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801307:	eb e9                	jmp    8012f2 <fd_lookup+0x39>
+
+00801309 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801313:	b8 00 00 00 00       	mov    $0x0,%eax
+  801318:	eb 03                	jmp    80131d <dev_lookup+0x14>
+  80131a:	83 c0 01             	add    $0x1,%eax
+  80131d:	8b 1c 85 5c 4d 80 00 	mov    0x804d5c(,%eax,4),%ebx
+  801324:	85 db                	test   %ebx,%ebx
+  801326:	74 0b                	je     801333 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801328:	39 13                	cmp    %edx,(%ebx)
+  80132a:	75 ee                	jne    80131a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80132c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801331:	eb 49                	jmp    80137c <dev_lookup+0x73>
+  801333:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801335:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80133b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801340:	77 18                	ja     80135a <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801342:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801347:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801349:	c1 e8 10             	shr    $0x10,%eax
+  80134c:	74 0c                	je     80135a <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80134e:	c1 e0 10             	shl    $0x10,%eax
+  801351:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801356:	29 c1                	sub    %eax,%ecx
+  801358:	eb 06                	jmp    801360 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80135a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801360:	8b 01                	mov    (%ecx),%eax
+  801362:	8b 40 48             	mov    0x48(%eax),%eax
+  801365:	83 ec 04             	sub    $0x4,%esp
+  801368:	52                   	push   %edx
+  801369:	50                   	push   %eax
+  80136a:	68 e0 4c 80 00       	push   $0x804ce0
+  80136f:	e8 04 f0 ff ff       	call   800378 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80137c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80137f:	89 1a                	mov    %ebx,(%edx)
+}
+  801381:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801384:	c9                   	leave
+  801385:	c3                   	ret
+
+00801386 <fd_close>:
+{
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	57                   	push   %edi
+  80138a:	56                   	push   %esi
+  80138b:	53                   	push   %ebx
+  80138c:	83 ec 24             	sub    $0x24,%esp
+  80138f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801392:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801395:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801398:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801399:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80139f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013a2:	50                   	push   %eax
+  8013a3:	e8 11 ff ff ff       	call   8012b9 <fd_lookup>
+  8013a8:	89 c3                	mov    %eax,%ebx
+  8013aa:	83 c4 10             	add    $0x10,%esp
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	78 05                	js     8013b6 <fd_close+0x30>
+	    || fd != fd2)
+  8013b1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013b4:	74 16                	je     8013cc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013b6:	89 f8                	mov    %edi,%eax
+  8013b8:	84 c0                	test   %al,%al
+  8013ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013c2:	89 d8                	mov    %ebx,%eax
+  8013c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c7:	5b                   	pop    %ebx
+  8013c8:	5e                   	pop    %esi
+  8013c9:	5f                   	pop    %edi
+  8013ca:	5d                   	pop    %ebp
+  8013cb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013cc:	83 ec 08             	sub    $0x8,%esp
+  8013cf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013d2:	50                   	push   %eax
+  8013d3:	ff 36                	push   (%esi)
+  8013d5:	e8 2f ff ff ff       	call   801309 <dev_lookup>
+  8013da:	89 c3                	mov    %eax,%ebx
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	78 1a                	js     8013fd <fd_close+0x77>
+		if (dev->dev_close)
+  8013e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013e6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	74 0b                	je     8013fd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013f2:	83 ec 0c             	sub    $0xc,%esp
+  8013f5:	56                   	push   %esi
+  8013f6:	ff d0                	call   *%eax
+  8013f8:	89 c3                	mov    %eax,%ebx
+  8013fa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013fd:	83 ec 08             	sub    $0x8,%esp
+  801400:	56                   	push   %esi
+  801401:	6a 00                	push   $0x0
+  801403:	e8 2b fa ff ff       	call   800e33 <sys_page_unmap>
+	return r;
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	eb b5                	jmp    8013c2 <fd_close+0x3c>
+
+0080140d <close>:
+
+int
+close(int fdnum)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801413:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801416:	50                   	push   %eax
+  801417:	ff 75 08             	push   0x8(%ebp)
+  80141a:	e8 9a fe ff ff       	call   8012b9 <fd_lookup>
+  80141f:	83 c4 10             	add    $0x10,%esp
+  801422:	85 c0                	test   %eax,%eax
+  801424:	79 02                	jns    801428 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+		return fd_close(fd, 1);
+  801428:	83 ec 08             	sub    $0x8,%esp
+  80142b:	6a 01                	push   $0x1
+  80142d:	ff 75 f4             	push   -0xc(%ebp)
+  801430:	e8 51 ff ff ff       	call   801386 <fd_close>
+  801435:	83 c4 10             	add    $0x10,%esp
+  801438:	eb ec                	jmp    801426 <close+0x19>
+
+0080143a <close_all>:
+
+void
+close_all(void)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	53                   	push   %ebx
+  80143e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801441:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	53                   	push   %ebx
+  80144a:	e8 be ff ff ff       	call   80140d <close>
+	for (i = 0; i < MAXFD; i++)
+  80144f:	83 c3 01             	add    $0x1,%ebx
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	83 fb 20             	cmp    $0x20,%ebx
+  801458:	75 ec                	jne    801446 <close_all+0xc>
+}
+  80145a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80145d:	c9                   	leave
+  80145e:	c3                   	ret
+
+0080145f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	57                   	push   %edi
+  801463:	56                   	push   %esi
+  801464:	53                   	push   %ebx
+  801465:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801468:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80146b:	50                   	push   %eax
+  80146c:	ff 75 08             	push   0x8(%ebp)
+  80146f:	e8 45 fe ff ff       	call   8012b9 <fd_lookup>
+  801474:	89 c3                	mov    %eax,%ebx
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 7f                	js     8014fc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80147d:	83 ec 0c             	sub    $0xc,%esp
+  801480:	ff 75 0c             	push   0xc(%ebp)
+  801483:	e8 85 ff ff ff       	call   80140d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801488:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80148b:	c1 e6 0c             	shl    $0xc,%esi
+  80148e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801494:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801497:	89 3c 24             	mov    %edi,(%esp)
+  80149a:	e8 ad fd ff ff       	call   80124c <fd2data>
+  80149f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014a1:	89 34 24             	mov    %esi,(%esp)
+  8014a4:	e8 a3 fd ff ff       	call   80124c <fd2data>
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014af:	89 d8                	mov    %ebx,%eax
+  8014b1:	c1 e8 16             	shr    $0x16,%eax
+  8014b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014bb:	a8 01                	test   $0x1,%al
+  8014bd:	74 11                	je     8014d0 <dup+0x71>
+  8014bf:	89 d8                	mov    %ebx,%eax
+  8014c1:	c1 e8 0c             	shr    $0xc,%eax
+  8014c4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014cb:	f6 c2 01             	test   $0x1,%dl
+  8014ce:	75 36                	jne    801506 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014d0:	89 f8                	mov    %edi,%eax
+  8014d2:	c1 e8 0c             	shr    $0xc,%eax
+  8014d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+  8014df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014e4:	50                   	push   %eax
+  8014e5:	56                   	push   %esi
+  8014e6:	6a 00                	push   $0x0
+  8014e8:	57                   	push   %edi
+  8014e9:	6a 00                	push   $0x0
+  8014eb:	e8 f7 f8 ff ff       	call   800de7 <sys_page_map>
+  8014f0:	89 c3                	mov    %eax,%ebx
+  8014f2:	83 c4 20             	add    $0x20,%esp
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	78 33                	js     80152c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014fc:	89 d8                	mov    %ebx,%eax
+  8014fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801501:	5b                   	pop    %ebx
+  801502:	5e                   	pop    %esi
+  801503:	5f                   	pop    %edi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801506:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80150d:	83 ec 0c             	sub    $0xc,%esp
+  801510:	25 07 0e 00 00       	and    $0xe07,%eax
+  801515:	50                   	push   %eax
+  801516:	ff 75 d4             	push   -0x2c(%ebp)
+  801519:	6a 00                	push   $0x0
+  80151b:	53                   	push   %ebx
+  80151c:	6a 00                	push   $0x0
+  80151e:	e8 c4 f8 ff ff       	call   800de7 <sys_page_map>
+  801523:	89 c3                	mov    %eax,%ebx
+  801525:	83 c4 20             	add    $0x20,%esp
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	79 a4                	jns    8014d0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80152c:	83 ec 08             	sub    $0x8,%esp
+  80152f:	56                   	push   %esi
+  801530:	6a 00                	push   $0x0
+  801532:	e8 fc f8 ff ff       	call   800e33 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801537:	83 c4 08             	add    $0x8,%esp
+  80153a:	ff 75 d4             	push   -0x2c(%ebp)
+  80153d:	6a 00                	push   $0x0
+  80153f:	e8 ef f8 ff ff       	call   800e33 <sys_page_unmap>
+	return r;
+  801544:	83 c4 10             	add    $0x10,%esp
+  801547:	eb b3                	jmp    8014fc <dup+0x9d>
+
+00801549 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	56                   	push   %esi
+  80154d:	53                   	push   %ebx
+  80154e:	83 ec 18             	sub    $0x18,%esp
+  801551:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801554:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801557:	50                   	push   %eax
+  801558:	53                   	push   %ebx
+  801559:	e8 5b fd ff ff       	call   8012b9 <fd_lookup>
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	85 c0                	test   %eax,%eax
+  801563:	78 3c                	js     8015a1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801565:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156e:	50                   	push   %eax
+  80156f:	ff 36                	push   (%esi)
+  801571:	e8 93 fd ff ff       	call   801309 <dev_lookup>
+  801576:	83 c4 10             	add    $0x10,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 24                	js     8015a1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80157d:	8b 46 08             	mov    0x8(%esi),%eax
+  801580:	83 e0 03             	and    $0x3,%eax
+  801583:	83 f8 01             	cmp    $0x1,%eax
+  801586:	74 20                	je     8015a8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801588:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158b:	8b 40 08             	mov    0x8(%eax),%eax
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	74 61                	je     8015f3 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801592:	83 ec 04             	sub    $0x4,%esp
+  801595:	ff 75 10             	push   0x10(%ebp)
+  801598:	ff 75 0c             	push   0xc(%ebp)
+  80159b:	56                   	push   %esi
+  80159c:	ff d0                	call   *%eax
+  80159e:	83 c4 10             	add    $0x10,%esp
+}
+  8015a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a4:	5b                   	pop    %ebx
+  8015a5:	5e                   	pop    %esi
+  8015a6:	5d                   	pop    %ebp
+  8015a7:	c3                   	ret
+  8015a8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015aa:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015b0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015b5:	77 18                	ja     8015cf <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015b7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015bc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015be:	c1 e8 10             	shr    $0x10,%eax
+  8015c1:	74 0c                	je     8015cf <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015c3:	c1 e0 10             	shl    $0x10,%eax
+  8015c6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015cb:	29 c2                	sub    %eax,%edx
+  8015cd:	eb 06                	jmp    8015d5 <read+0x8c>
+		return pthread_main_tls;
+  8015cf:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015d5:	8b 02                	mov    (%edx),%eax
+  8015d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015da:	83 ec 04             	sub    $0x4,%esp
+  8015dd:	53                   	push   %ebx
+  8015de:	50                   	push   %eax
+  8015df:	68 21 4d 80 00       	push   $0x804d21
+  8015e4:	e8 8f ed ff ff       	call   800378 <cprintf>
+		return -E_INVAL;
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f1:	eb ae                	jmp    8015a1 <read+0x58>
+		return -E_NOT_SUPP;
+  8015f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f8:	eb a7                	jmp    8015a1 <read+0x58>
+
+008015fa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	57                   	push   %edi
+  8015fe:	56                   	push   %esi
+  8015ff:	53                   	push   %ebx
+  801600:	83 ec 0c             	sub    $0xc,%esp
+  801603:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801606:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160e:	eb 02                	jmp    801612 <readn+0x18>
+  801610:	01 c3                	add    %eax,%ebx
+  801612:	39 f3                	cmp    %esi,%ebx
+  801614:	73 21                	jae    801637 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801616:	83 ec 04             	sub    $0x4,%esp
+  801619:	89 f0                	mov    %esi,%eax
+  80161b:	29 d8                	sub    %ebx,%eax
+  80161d:	50                   	push   %eax
+  80161e:	89 d8                	mov    %ebx,%eax
+  801620:	03 45 0c             	add    0xc(%ebp),%eax
+  801623:	50                   	push   %eax
+  801624:	57                   	push   %edi
+  801625:	e8 1f ff ff ff       	call   801549 <read>
+		if (m < 0)
+  80162a:	83 c4 10             	add    $0x10,%esp
+  80162d:	85 c0                	test   %eax,%eax
+  80162f:	78 04                	js     801635 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801631:	75 dd                	jne    801610 <readn+0x16>
+  801633:	eb 02                	jmp    801637 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801635:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801637:	89 d8                	mov    %ebx,%eax
+  801639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5f                   	pop    %edi
+  80163f:	5d                   	pop    %ebp
+  801640:	c3                   	ret
+
+00801641 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	56                   	push   %esi
+  801645:	53                   	push   %ebx
+  801646:	83 ec 18             	sub    $0x18,%esp
+  801649:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80164c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80164f:	50                   	push   %eax
+  801650:	53                   	push   %ebx
+  801651:	e8 63 fc ff ff       	call   8012b9 <fd_lookup>
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	78 37                	js     801694 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80165d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801660:	83 ec 08             	sub    $0x8,%esp
+  801663:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801666:	50                   	push   %eax
+  801667:	ff 36                	push   (%esi)
+  801669:	e8 9b fc ff ff       	call   801309 <dev_lookup>
+  80166e:	83 c4 10             	add    $0x10,%esp
+  801671:	85 c0                	test   %eax,%eax
+  801673:	78 1f                	js     801694 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801675:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801679:	74 20                	je     80169b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80167b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80167e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801681:	85 c0                	test   %eax,%eax
+  801683:	74 61                	je     8016e6 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801685:	83 ec 04             	sub    $0x4,%esp
+  801688:	ff 75 10             	push   0x10(%ebp)
+  80168b:	ff 75 0c             	push   0xc(%ebp)
+  80168e:	56                   	push   %esi
+  80168f:	ff d0                	call   *%eax
+  801691:	83 c4 10             	add    $0x10,%esp
+}
+  801694:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5d                   	pop    %ebp
+  80169a:	c3                   	ret
+  80169b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80169d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016a3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016a8:	77 18                	ja     8016c2 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016aa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016af:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016b1:	c1 e8 10             	shr    $0x10,%eax
+  8016b4:	74 0c                	je     8016c2 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016b6:	c1 e0 10             	shl    $0x10,%eax
+  8016b9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016be:	29 c2                	sub    %eax,%edx
+  8016c0:	eb 06                	jmp    8016c8 <write+0x87>
+		return pthread_main_tls;
+  8016c2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016c8:	8b 02                	mov    (%edx),%eax
+  8016ca:	8b 40 48             	mov    0x48(%eax),%eax
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+  8016d0:	53                   	push   %ebx
+  8016d1:	50                   	push   %eax
+  8016d2:	68 3d 4d 80 00       	push   $0x804d3d
+  8016d7:	e8 9c ec ff ff       	call   800378 <cprintf>
+		return -E_INVAL;
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e4:	eb ae                	jmp    801694 <write+0x53>
+		return -E_NOT_SUPP;
+  8016e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016eb:	eb a7                	jmp    801694 <write+0x53>
+
+008016ed <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f6:	50                   	push   %eax
+  8016f7:	ff 75 08             	push   0x8(%ebp)
+  8016fa:	e8 ba fb ff ff       	call   8012b9 <fd_lookup>
+  8016ff:	83 c4 10             	add    $0x10,%esp
+  801702:	85 c0                	test   %eax,%eax
+  801704:	78 0e                	js     801714 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801706:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80170f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+00801716 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+  80171b:	83 ec 18             	sub    $0x18,%esp
+  80171e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801721:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801724:	50                   	push   %eax
+  801725:	53                   	push   %ebx
+  801726:	e8 8e fb ff ff       	call   8012b9 <fd_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 34                	js     801766 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801732:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173b:	50                   	push   %eax
+  80173c:	ff 36                	push   (%esi)
+  80173e:	e8 c6 fb ff ff       	call   801309 <dev_lookup>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	85 c0                	test   %eax,%eax
+  801748:	78 1c                	js     801766 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80174a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80174e:	74 1d                	je     80176d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801753:	8b 40 18             	mov    0x18(%eax),%eax
+  801756:	85 c0                	test   %eax,%eax
+  801758:	74 5e                	je     8017b8 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80175a:	83 ec 08             	sub    $0x8,%esp
+  80175d:	ff 75 0c             	push   0xc(%ebp)
+  801760:	56                   	push   %esi
+  801761:	ff d0                	call   *%eax
+  801763:	83 c4 10             	add    $0x10,%esp
+}
+  801766:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801769:	5b                   	pop    %ebx
+  80176a:	5e                   	pop    %esi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+  80176d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80176f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801775:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80177a:	77 18                	ja     801794 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80177c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801781:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801783:	c1 e8 10             	shr    $0x10,%eax
+  801786:	74 0c                	je     801794 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801788:	c1 e0 10             	shl    $0x10,%eax
+  80178b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801790:	29 c2                	sub    %eax,%edx
+  801792:	eb 06                	jmp    80179a <ftruncate+0x84>
+		return pthread_main_tls;
+  801794:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80179a:	8b 02                	mov    (%edx),%eax
+  80179c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80179f:	83 ec 04             	sub    $0x4,%esp
+  8017a2:	53                   	push   %ebx
+  8017a3:	50                   	push   %eax
+  8017a4:	68 00 4d 80 00       	push   $0x804d00
+  8017a9:	e8 ca eb ff ff       	call   800378 <cprintf>
+		return -E_INVAL;
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b6:	eb ae                	jmp    801766 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017bd:	eb a7                	jmp    801766 <ftruncate+0x50>
+
+008017bf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	56                   	push   %esi
+  8017c3:	53                   	push   %ebx
+  8017c4:	83 ec 18             	sub    $0x18,%esp
+  8017c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017cd:	50                   	push   %eax
+  8017ce:	ff 75 08             	push   0x8(%ebp)
+  8017d1:	e8 e3 fa ff ff       	call   8012b9 <fd_lookup>
+  8017d6:	83 c4 10             	add    $0x10,%esp
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	78 49                	js     801826 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017dd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e0:	83 ec 08             	sub    $0x8,%esp
+  8017e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e6:	50                   	push   %eax
+  8017e7:	ff 36                	push   (%esi)
+  8017e9:	e8 1b fb ff ff       	call   801309 <dev_lookup>
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	85 c0                	test   %eax,%eax
+  8017f3:	78 31                	js     801826 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017fc:	74 2f                	je     80182d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017fe:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801801:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801808:	00 00 00 
+	stat->st_isdir = 0;
+  80180b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801812:	00 00 00 
+	stat->st_dev = dev;
+  801815:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	53                   	push   %ebx
+  80181f:	56                   	push   %esi
+  801820:	ff 50 14             	call   *0x14(%eax)
+  801823:	83 c4 10             	add    $0x10,%esp
+}
+  801826:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801829:	5b                   	pop    %ebx
+  80182a:	5e                   	pop    %esi
+  80182b:	5d                   	pop    %ebp
+  80182c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80182d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801832:	eb f2                	jmp    801826 <fstat+0x67>
+
+00801834 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	56                   	push   %esi
+  801838:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801839:	83 ec 08             	sub    $0x8,%esp
+  80183c:	6a 00                	push   $0x0
+  80183e:	ff 75 08             	push   0x8(%ebp)
+  801841:	e8 4b 03 00 00       	call   801b91 <open>
+  801846:	89 c3                	mov    %eax,%ebx
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 1b                	js     80186a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80184f:	83 ec 08             	sub    $0x8,%esp
+  801852:	ff 75 0c             	push   0xc(%ebp)
+  801855:	50                   	push   %eax
+  801856:	e8 64 ff ff ff       	call   8017bf <fstat>
+  80185b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80185d:	89 1c 24             	mov    %ebx,(%esp)
+  801860:	e8 a8 fb ff ff       	call   80140d <close>
+	return r;
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	89 f3                	mov    %esi,%ebx
+}
+  80186a:	89 d8                	mov    %ebx,%eax
+  80186c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186f:	5b                   	pop    %ebx
+  801870:	5e                   	pop    %esi
+  801871:	5d                   	pop    %ebp
+  801872:	c3                   	ret
+
+00801873 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	56                   	push   %esi
+  801877:	53                   	push   %ebx
+  801878:	89 c6                	mov    %eax,%esi
+  80187a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80187c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801883:	74 27                	je     8018ac <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801885:	6a 07                	push   $0x7
+  801887:	68 00 80 80 00       	push   $0x808000
+  80188c:	56                   	push   %esi
+  80188d:	ff 35 00 70 80 00    	push   0x807000
+  801893:	e8 4e 2c 00 00       	call   8044e6 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801898:	83 c4 0c             	add    $0xc,%esp
+  80189b:	6a 00                	push   $0x0
+  80189d:	53                   	push   %ebx
+  80189e:	6a 00                	push   $0x0
+  8018a0:	e8 4b 2b 00 00       	call   8043f0 <ipc_recv>
+}
+  8018a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a8:	5b                   	pop    %ebx
+  8018a9:	5e                   	pop    %esi
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  8018af:	6a 01                	push   $0x1
+  8018b1:	e8 86 2c 00 00       	call   80453c <ipc_find_env>
+  8018b6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	eb c5                	jmp    801885 <fsipc+0x12>
+
+008018c0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8018c7:	68 04 70 80 00       	push   $0x807004
+  8018cc:	e8 29 1b 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d7:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8018dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018df:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8018e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018ee:	e8 80 ff ff ff       	call   801873 <fsipc>
+  8018f3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018f5:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8018fc:	e8 66 1b 00 00       	call   803467 <mutex_unlock>
+	return r;
+}
+  801901:	89 d8                	mov    %ebx,%eax
+  801903:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801906:	c9                   	leave
+  801907:	c3                   	ret
+
+00801908 <devfile_flush>:
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	53                   	push   %ebx
+  80190c:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80190f:	68 04 70 80 00       	push   $0x807004
+  801914:	e8 e1 1a 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80191f:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801924:	ba 00 00 00 00       	mov    $0x0,%edx
+  801929:	b8 06 00 00 00       	mov    $0x6,%eax
+  80192e:	e8 40 ff ff ff       	call   801873 <fsipc>
+  801933:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801935:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80193c:	e8 26 1b 00 00       	call   803467 <mutex_unlock>
+}
+  801941:	89 d8                	mov    %ebx,%eax
+  801943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+00801948 <devfile_stat>:
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	56                   	push   %esi
+  80194c:	53                   	push   %ebx
+  80194d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801950:	83 ec 0c             	sub    $0xc,%esp
+  801953:	68 04 70 80 00       	push   $0x807004
+  801958:	e8 9d 1a 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	8b 40 0c             	mov    0xc(%eax),%eax
+  801963:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801968:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801972:	e8 fc fe ff ff       	call   801873 <fsipc>
+  801977:	89 c3                	mov    %eax,%ebx
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	79 16                	jns    801996 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	68 04 70 80 00       	push   $0x807004
+  801988:	e8 da 1a 00 00       	call   803467 <mutex_unlock>
+}
+  80198d:	89 d8                	mov    %ebx,%eax
+  80198f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801992:	5b                   	pop    %ebx
+  801993:	5e                   	pop    %esi
+  801994:	5d                   	pop    %ebp
+  801995:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801996:	83 ec 08             	sub    $0x8,%esp
+  801999:	68 00 80 80 00       	push   $0x808000
+  80199e:	56                   	push   %esi
+  80199f:	e8 b8 ef ff ff       	call   80095c <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8019a4:	a1 80 80 80 00       	mov    0x808080,%eax
+  8019a9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019af:	a1 84 80 80 00       	mov    0x808084,%eax
+  8019b4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8019ba:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8019bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c2:	eb bc                	jmp    801980 <devfile_stat+0x38>
+
+008019c4 <devfile_write>:
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	53                   	push   %ebx
+  8019c8:	83 ec 10             	sub    $0x10,%esp
+  8019cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8019ce:	68 04 70 80 00       	push   $0x807004
+  8019d3:	e8 22 1a 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019de:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8019e3:	83 c4 10             	add    $0x10,%esp
+  8019e6:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8019ec:	76 3d                	jbe    801a2b <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8019ee:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019f3:	39 c3                	cmp    %eax,%ebx
+  8019f5:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8019f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019fb:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801a00:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801a06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a10:	e8 5e fe ff ff       	call   801873 <fsipc>
+  801a15:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a17:	83 ec 0c             	sub    $0xc,%esp
+  801a1a:	68 04 70 80 00       	push   $0x807004
+  801a1f:	e8 43 1a 00 00       	call   803467 <mutex_unlock>
+}
+  801a24:	89 d8                	mov    %ebx,%eax
+  801a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a29:	c9                   	leave
+  801a2a:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801a2b:	83 ec 04             	sub    $0x4,%esp
+  801a2e:	53                   	push   %ebx
+  801a2f:	ff 75 0c             	push   0xc(%ebp)
+  801a32:	68 0c 80 80 00       	push   $0x80800c
+  801a37:	e8 a6 f0 ff ff       	call   800ae2 <memmove>
+  801a3c:	83 c4 10             	add    $0x10,%esp
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a44:	eb b5                	jmp    8019fb <devfile_write+0x37>
+
+00801a46 <devfile_read>:
+{
+  801a46:	55                   	push   %ebp
+  801a47:	89 e5                	mov    %esp,%ebp
+  801a49:	57                   	push   %edi
+  801a4a:	56                   	push   %esi
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 0c             	sub    $0xc,%esp
+  801a4f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a52:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801a58:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a5e:	0f 86 8c 00 00 00    	jbe    801af0 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801a64:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a69:	39 c3                	cmp    %eax,%ebx
+  801a6b:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a6e:	89 f8                	mov    %edi,%eax
+  801a70:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801a73:	eb 0f                	jmp    801a84 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801a75:	0f b6 08             	movzbl (%eax),%ecx
+  801a78:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801a7a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a7f:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a84:	39 d0                	cmp    %edx,%eax
+  801a86:	72 ed                	jb     801a75 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	68 04 70 80 00       	push   $0x807004
+  801a90:	e8 65 19 00 00       	call   8033fa <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a95:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a98:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801a9d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801aa3:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801aa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aae:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ab3:	e8 bb fd ff ff       	call   801873 <fsipc>
+  801ab8:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801aba:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ac1:	e8 a1 19 00 00       	call   803467 <mutex_unlock>
+		assert(r <= (int) n);
+  801ac6:	83 c4 10             	add    $0x10,%esp
+  801ac9:	39 f3                	cmp    %esi,%ebx
+  801acb:	7c 0a                	jl     801ad7 <devfile_read+0x91>
+}
+  801acd:	89 f0                	mov    %esi,%eax
+  801acf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad2:	5b                   	pop    %ebx
+  801ad3:	5e                   	pop    %esi
+  801ad4:	5f                   	pop    %edi
+  801ad5:	5d                   	pop    %ebp
+  801ad6:	c3                   	ret
+		assert(r <= (int) n);
+  801ad7:	68 70 4d 80 00       	push   $0x804d70
+  801adc:	68 7d 4d 80 00       	push   $0x804d7d
+  801ae1:	68 90 00 00 00       	push   $0x90
+  801ae6:	68 92 4d 80 00       	push   $0x804d92
+  801aeb:	e8 ad e7 ff ff       	call   80029d <_panic>
+	mutex_lock(&fsipc_mu);
+  801af0:	83 ec 0c             	sub    $0xc,%esp
+  801af3:	68 04 70 80 00       	push   $0x807004
+  801af8:	e8 fd 18 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801afd:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b00:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801b05:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801b0b:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801b12:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801b15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b1f:	e8 4f fd ff ff       	call   801873 <fsipc>
+  801b24:	89 c6                	mov    %eax,%esi
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 1d                	js     801b4a <devfile_read+0x104>
+		assert(r <= n);
+  801b2d:	39 c3                	cmp    %eax,%ebx
+  801b2f:	72 2e                	jb     801b5f <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801b31:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b36:	7f 40                	jg     801b78 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b38:	83 ec 04             	sub    $0x4,%esp
+  801b3b:	50                   	push   %eax
+  801b3c:	68 00 80 80 00       	push   $0x808000
+  801b41:	57                   	push   %edi
+  801b42:	e8 9b ef ff ff       	call   800ae2 <memmove>
+  801b47:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801b4a:	83 ec 0c             	sub    $0xc,%esp
+  801b4d:	68 04 70 80 00       	push   $0x807004
+  801b52:	e8 10 19 00 00       	call   803467 <mutex_unlock>
+	return r;
+  801b57:	83 c4 10             	add    $0x10,%esp
+  801b5a:	e9 6e ff ff ff       	jmp    801acd <devfile_read+0x87>
+		assert(r <= n);
+  801b5f:	68 9d 4d 80 00       	push   $0x804d9d
+  801b64:	68 7d 4d 80 00       	push   $0x804d7d
+  801b69:	68 99 00 00 00       	push   $0x99
+  801b6e:	68 92 4d 80 00       	push   $0x804d92
+  801b73:	e8 25 e7 ff ff       	call   80029d <_panic>
+		assert(r <= PGSIZE);
+  801b78:	68 a4 4d 80 00       	push   $0x804da4
+  801b7d:	68 7d 4d 80 00       	push   $0x804d7d
+  801b82:	68 9a 00 00 00       	push   $0x9a
+  801b87:	68 92 4d 80 00       	push   $0x804d92
+  801b8c:	e8 0c e7 ff ff       	call   80029d <_panic>
+
+00801b91 <open>:
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	56                   	push   %esi
+  801b95:	53                   	push   %ebx
+  801b96:	83 ec 1c             	sub    $0x1c,%esp
+  801b99:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b9c:	56                   	push   %esi
+  801b9d:	e8 7f ed ff ff       	call   800921 <strlen>
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801baa:	0f 8f 85 00 00 00    	jg     801c35 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bb0:	83 ec 0c             	sub    $0xc,%esp
+  801bb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb6:	50                   	push   %eax
+  801bb7:	e8 a7 f6 ff ff       	call   801263 <fd_alloc>
+  801bbc:	89 c3                	mov    %eax,%ebx
+  801bbe:	83 c4 10             	add    $0x10,%esp
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 55                	js     801c1a <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801bc5:	83 ec 0c             	sub    $0xc,%esp
+  801bc8:	68 04 70 80 00       	push   $0x807004
+  801bcd:	e8 28 18 00 00       	call   8033fa <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bd2:	83 c4 08             	add    $0x8,%esp
+  801bd5:	56                   	push   %esi
+  801bd6:	68 00 80 80 00       	push   $0x808000
+  801bdb:	e8 7c ed ff ff       	call   80095c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801be0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be3:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801be8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801beb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bf0:	e8 7e fc ff ff       	call   801873 <fsipc>
+  801bf5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bf7:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801bfe:	e8 64 18 00 00       	call   803467 <mutex_unlock>
+	if (r < 0) {
+  801c03:	83 c4 10             	add    $0x10,%esp
+  801c06:	85 db                	test   %ebx,%ebx
+  801c08:	78 19                	js     801c23 <open+0x92>
+	return fd2num(fd);
+  801c0a:	83 ec 0c             	sub    $0xc,%esp
+  801c0d:	ff 75 f4             	push   -0xc(%ebp)
+  801c10:	e8 27 f6 ff ff       	call   80123c <fd2num>
+  801c15:	89 c3                	mov    %eax,%ebx
+  801c17:	83 c4 10             	add    $0x10,%esp
+}
+  801c1a:	89 d8                	mov    %ebx,%eax
+  801c1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1f:	5b                   	pop    %ebx
+  801c20:	5e                   	pop    %esi
+  801c21:	5d                   	pop    %ebp
+  801c22:	c3                   	ret
+		fd_close(fd, 0);
+  801c23:	83 ec 08             	sub    $0x8,%esp
+  801c26:	6a 00                	push   $0x0
+  801c28:	ff 75 f4             	push   -0xc(%ebp)
+  801c2b:	e8 56 f7 ff ff       	call   801386 <fd_close>
+		return r;
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	eb e5                	jmp    801c1a <open+0x89>
+		return -E_BAD_PATH;
+  801c35:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c3a:	eb de                	jmp    801c1a <open+0x89>
+
+00801c3c <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	53                   	push   %ebx
+  801c40:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c46:	50                   	push   %eax
+  801c47:	ff 75 08             	push   0x8(%ebp)
+  801c4a:	e8 6a f6 ff ff       	call   8012b9 <fd_lookup>
+  801c4f:	89 c3                	mov    %eax,%ebx
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 5b                	js     801cb3 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c5b:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801c61:	39 08                	cmp    %ecx,(%eax)
+  801c63:	75 55                	jne    801cba <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801c65:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801c69:	74 56                	je     801cc1 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801c6b:	83 ec 0c             	sub    $0xc,%esp
+  801c6e:	68 04 70 80 00       	push   $0x807004
+  801c73:	e8 82 17 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801c78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801c83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c86:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801c8b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c8e:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801c93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c98:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801c9d:	e8 d1 fb ff ff       	call   801873 <fsipc>
+  801ca2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ca4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801cab:	e8 b7 17 00 00       	call   803467 <mutex_unlock>
+	return r;
+  801cb0:	83 c4 10             	add    $0x10,%esp
+}
+  801cb3:	89 d8                	mov    %ebx,%eax
+  801cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb8:	c9                   	leave
+  801cb9:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cba:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801cbf:	eb f2                	jmp    801cb3 <fallocate+0x77>
+		return -E_INVAL;
+  801cc1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801cc6:	eb eb                	jmp    801cb3 <fallocate+0x77>
+
+00801cc8 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	56                   	push   %esi
+  801ccc:	53                   	push   %ebx
+  801ccd:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801cd0:	89 f3                	mov    %esi,%ebx
+  801cd2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801cd8:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801cdb:	eb 06                	jmp    801ce3 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801cdd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ce3:	39 f3                	cmp    %esi,%ebx
+  801ce5:	73 14                	jae    801cfb <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801ce7:	83 ec 08             	sub    $0x8,%esp
+  801cea:	53                   	push   %ebx
+  801ceb:	6a 00                	push   $0x0
+  801ced:	e8 41 f1 ff ff       	call   800e33 <sys_page_unmap>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	79 e4                	jns    801cdd <munmap+0x15>
+  801cf9:	eb 05                	jmp    801d00 <munmap+0x38>
+			return r;
+	return 0;
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d03:	5b                   	pop    %ebx
+  801d04:	5e                   	pop    %esi
+  801d05:	5d                   	pop    %ebp
+  801d06:	c3                   	ret
+
+00801d07 <mmap>:
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	57                   	push   %edi
+  801d0b:	56                   	push   %esi
+  801d0c:	53                   	push   %ebx
+  801d0d:	83 ec 24             	sub    $0x24,%esp
+  801d10:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d13:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d16:	50                   	push   %eax
+  801d17:	ff 75 08             	push   0x8(%ebp)
+  801d1a:	e8 9a f5 ff ff       	call   8012b9 <fd_lookup>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	0f 88 37 01 00 00    	js     801e61 <mmap+0x15a>
+		return NULL;
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d2f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d32:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801d38:	39 0a                	cmp    %ecx,(%edx)
+  801d3a:	0f 85 05 01 00 00    	jne    801e45 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801d40:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801d47:	0f 85 1b 01 00 00    	jne    801e68 <mmap+0x161>
+  801d4d:	89 f0                	mov    %esi,%eax
+  801d4f:	83 e8 01             	sub    $0x1,%eax
+  801d52:	0f 88 17 01 00 00    	js     801e6f <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801d58:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801d5c:	75 28                	jne    801d86 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801d5e:	83 ec 0c             	sub    $0xc,%esp
+  801d61:	68 04 70 80 00       	push   $0x807004
+  801d66:	e8 8f 16 00 00       	call   8033fa <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d6b:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801d71:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801d7f:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801d84:	eb 2b                	jmp    801db1 <mmap+0xaa>
+		cow_enable();
+  801d86:	e8 f4 21 00 00       	call   803f7f <cow_enable>
+  801d8b:	eb d1                	jmp    801d5e <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801d8d:	89 c2                	mov    %eax,%edx
+  801d8f:	c1 ea 0c             	shr    $0xc,%edx
+  801d92:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801d99:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801d9f:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801da5:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801da8:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801daa:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801daf:	77 25                	ja     801dd6 <mmap+0xcf>
+  801db1:	89 c2                	mov    %eax,%edx
+  801db3:	29 da                	sub    %ebx,%edx
+  801db5:	39 ca                	cmp    %ecx,%edx
+  801db7:	73 3a                	jae    801df3 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801db9:	89 c2                	mov    %eax,%edx
+  801dbb:	c1 ea 16             	shr    $0x16,%edx
+  801dbe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801dc5:	f6 c2 01             	test   $0x1,%dl
+  801dc8:	75 c3                	jne    801d8d <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801dca:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801dcf:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801dd4:	eb d4                	jmp    801daa <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801dd6:	29 d8                	sub    %ebx,%eax
+  801dd8:	39 c8                	cmp    %ecx,%eax
+  801dda:	73 17                	jae    801df3 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801ddc:	83 ec 0c             	sub    $0xc,%esp
+  801ddf:	68 04 70 80 00       	push   $0x807004
+  801de4:	e8 7e 16 00 00       	call   803467 <mutex_unlock>
+		return NULL;
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df1:	eb 52                	jmp    801e45 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801df3:	85 db                	test   %ebx,%ebx
+  801df5:	74 e5                	je     801ddc <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801df7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dfa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dfd:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801e02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e05:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801e0a:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801e10:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801e16:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e19:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e23:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e28:	e8 46 fa ff ff       	call   801873 <fsipc>
+  801e2d:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801e2f:	83 ec 0c             	sub    $0xc,%esp
+  801e32:	68 04 70 80 00       	push   $0x807004
+  801e37:	e8 2b 16 00 00       	call   803467 <mutex_unlock>
+	if (r < 0) {
+  801e3c:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801e3f:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801e41:	85 ff                	test   %edi,%edi
+  801e43:	78 08                	js     801e4d <mmap+0x146>
+}
+  801e45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e48:	5b                   	pop    %ebx
+  801e49:	5e                   	pop    %esi
+  801e4a:	5f                   	pop    %edi
+  801e4b:	5d                   	pop    %ebp
+  801e4c:	c3                   	ret
+		munmap((void*) va, len);
+  801e4d:	83 ec 08             	sub    $0x8,%esp
+  801e50:	56                   	push   %esi
+  801e51:	53                   	push   %ebx
+  801e52:	e8 71 fe ff ff       	call   801cc8 <munmap>
+		return NULL;
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5f:	eb e4                	jmp    801e45 <mmap+0x13e>
+		return NULL;
+  801e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e66:	eb dd                	jmp    801e45 <mmap+0x13e>
+		return NULL;
+  801e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6d:	eb d6                	jmp    801e45 <mmap+0x13e>
+  801e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e74:	eb cf                	jmp    801e45 <mmap+0x13e>
+
+00801e76 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801e76:	55                   	push   %ebp
+  801e77:	89 e5                	mov    %esp,%ebp
+  801e79:	53                   	push   %ebx
+  801e7a:	83 ec 10             	sub    $0x10,%esp
+  801e7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801e80:	53                   	push   %ebx
+  801e81:	e8 9b ea ff ff       	call   800921 <strlen>
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e8e:	7f 42                	jg     801ed2 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801e90:	83 ec 0c             	sub    $0xc,%esp
+  801e93:	68 04 70 80 00       	push   $0x807004
+  801e98:	e8 5d 15 00 00       	call   8033fa <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e9d:	83 c4 08             	add    $0x8,%esp
+  801ea0:	53                   	push   %ebx
+  801ea1:	68 00 80 80 00       	push   $0x808000
+  801ea6:	e8 b1 ea ff ff       	call   80095c <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801eab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb0:	b8 07 00 00 00       	mov    $0x7,%eax
+  801eb5:	e8 b9 f9 ff ff       	call   801873 <fsipc>
+  801eba:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ebc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ec3:	e8 9f 15 00 00       	call   803467 <mutex_unlock>
+	return r;
+  801ec8:	83 c4 10             	add    $0x10,%esp
+}
+  801ecb:	89 d8                	mov    %ebx,%eax
+  801ecd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed0:	c9                   	leave
+  801ed1:	c3                   	ret
+		return -E_BAD_PATH;
+  801ed2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ed7:	eb f2                	jmp    801ecb <remove+0x55>
+
+00801ed9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	53                   	push   %ebx
+  801edd:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ee0:	68 04 70 80 00       	push   $0x807004
+  801ee5:	e8 10 15 00 00       	call   8033fa <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eef:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ef4:	e8 7a f9 ff ff       	call   801873 <fsipc>
+  801ef9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801efb:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f02:	e8 60 15 00 00       	call   803467 <mutex_unlock>
+	return r;
+}
+  801f07:	89 d8                	mov    %ebx,%eax
+  801f09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0c:	c9                   	leave
+  801f0d:	c3                   	ret
+
+00801f0e <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f16:	83 ec 0c             	sub    $0xc,%esp
+  801f19:	68 04 70 80 00       	push   $0x807004
+  801f1e:	e8 d7 14 00 00       	call   8033fa <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801f23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f26:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f30:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f35:	e8 39 f9 ff ff       	call   801873 <fsipc>
+  801f3a:	89 c6                	mov    %eax,%esi
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 db                	test   %ebx,%ebx
+  801f41:	74 7b                	je     801fbe <fs_bcstat+0xb0>
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 77                	js     801fbe <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801f47:	a1 00 80 80 00       	mov    0x808000,%eax
+  801f4c:	89 03                	mov    %eax,(%ebx)
+  801f4e:	a1 04 80 80 00       	mov    0x808004,%eax
+  801f53:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f56:	a1 08 80 80 00       	mov    0x808008,%eax
+  801f5b:	89 43 08             	mov    %eax,0x8(%ebx)
+  801f5e:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801f63:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801f66:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f6b:	89 43 10             	mov    %eax,0x10(%ebx)
+  801f6e:	a1 14 80 80 00       	mov    0x808014,%eax
+  801f73:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f76:	a1 18 80 80 00       	mov    0x808018,%eax
+  801f7b:	89 43 18             	mov    %eax,0x18(%ebx)
+  801f7e:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801f83:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801f86:	a1 20 80 80 00       	mov    0x808020,%eax
+  801f8b:	89 43 20             	mov    %eax,0x20(%ebx)
+  801f8e:	a1 24 80 80 00       	mov    0x808024,%eax
+  801f93:	89 43 24             	mov    %eax,0x24(%ebx)
+  801f96:	a1 28 80 80 00       	mov    0x808028,%eax
+  801f9b:	89 43 28             	mov    %eax,0x28(%ebx)
+  801f9e:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801fa3:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801fa6:	a1 30 80 80 00       	mov    0x808030,%eax
+  801fab:	89 43 30             	mov    %eax,0x30(%ebx)
+  801fae:	a1 34 80 80 00       	mov    0x808034,%eax
+  801fb3:	89 43 34             	mov    %eax,0x34(%ebx)
+  801fb6:	a1 38 80 80 00       	mov    0x808038,%eax
+  801fbb:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801fbe:	83 ec 0c             	sub    $0xc,%esp
+  801fc1:	68 04 70 80 00       	push   $0x807004
+  801fc6:	e8 9c 14 00 00       	call   803467 <mutex_unlock>
+	return r;
+}
+  801fcb:	89 f0                	mov    %esi,%eax
+  801fcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd0:	5b                   	pop    %ebx
+  801fd1:	5e                   	pop    %esi
+  801fd2:	5d                   	pop    %ebp
+  801fd3:	c3                   	ret
+
+00801fd4 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	56                   	push   %esi
+  801fd8:	53                   	push   %ebx
+  801fd9:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801fdb:	0f b6 10             	movzbl (%eax),%edx
+  801fde:	80 fa 72             	cmp    $0x72,%dl
+  801fe1:	74 44                	je     802027 <parse_mode+0x53>
+  801fe3:	80 fa 77             	cmp    $0x77,%dl
+  801fe6:	74 4b                	je     802033 <parse_mode+0x5f>
+  801fe8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801fed:	80 fa 61             	cmp    $0x61,%dl
+  801ff0:	74 09                	je     801ffb <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801ff2:	89 d8                	mov    %ebx,%eax
+  801ff4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff7:	5b                   	pop    %ebx
+  801ff8:	5e                   	pop    %esi
+  801ff9:	5d                   	pop    %ebp
+  801ffa:	c3                   	ret
+	switch (mode[0]) {
+  801ffb:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802000:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802005:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802007:	83 ec 08             	sub    $0x8,%esp
+  80200a:	6a 2b                	push   $0x2b
+  80200c:	50                   	push   %eax
+  80200d:	e8 5c ea ff ff       	call   800a6e <strchr>
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	74 d9                	je     801ff2 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802019:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80201c:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80201f:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802025:	eb cb                	jmp    801ff2 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802027:	ba 01 00 00 00       	mov    $0x1,%edx
+  80202c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802031:	eb d2                	jmp    802005 <parse_mode+0x31>
+  802033:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802038:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80203d:	eb c6                	jmp    802005 <parse_mode+0x31>
+
+0080203f <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	57                   	push   %edi
+  802043:	56                   	push   %esi
+  802044:	53                   	push   %ebx
+  802045:	83 ec 1c             	sub    $0x1c,%esp
+  802048:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80204b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80204e:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802053:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802058:	83 c0 24             	add    $0x24,%eax
+  80205b:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80205f:	74 17                	je     802078 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802061:	83 c3 01             	add    $0x1,%ebx
+  802064:	83 fb 10             	cmp    $0x10,%ebx
+  802067:	75 ef                	jne    802058 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802069:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80206e:	89 f0                	mov    %esi,%eax
+  802070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802073:	5b                   	pop    %ebx
+  802074:	5e                   	pop    %esi
+  802075:	5f                   	pop    %edi
+  802076:	5d                   	pop    %ebp
+  802077:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802078:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80207f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802082:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802085:	c1 e7 02             	shl    $0x2,%edi
+  802088:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  80208e:	83 ec 04             	sub    $0x4,%esp
+  802091:	6a 24                	push   $0x24
+  802093:	6a 00                	push   $0x0
+  802095:	56                   	push   %esi
+  802096:	e8 12 ea ff ff       	call   800aad <memset>
+			streams[i].f_fd = fd;
+  80209b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80209e:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8020a4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8020a7:	01 d8                	add    %ebx,%eax
+  8020a9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020ac:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8020b3:	83 c4 10             	add    $0x10,%esp
+  8020b6:	eb b6                	jmp    80206e <stream_alloc+0x2f>
+
+008020b8 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	53                   	push   %ebx
+  8020bc:	83 ec 14             	sub    $0x14,%esp
+  8020bf:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8020c1:	8b 40 18             	mov    0x18(%eax),%eax
+  8020c4:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8020c7:	74 4a                	je     802113 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8020c9:	83 ec 08             	sub    $0x8,%esp
+  8020cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cf:	50                   	push   %eax
+  8020d0:	ff 33                	push   (%ebx)
+  8020d2:	e8 e2 f1 ff ff       	call   8012b9 <fd_lookup>
+  8020d7:	89 c2                	mov    %eax,%edx
+  8020d9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020dc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8020e1:	85 d2                	test   %edx,%edx
+  8020e3:	78 41                	js     802126 <stream_unread+0x6e>
+  8020e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020e8:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8020ee:	39 0a                	cmp    %ecx,(%edx)
+  8020f0:	75 34                	jne    802126 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8020f2:	8b 43 14             	mov    0x14(%ebx),%eax
+  8020f5:	03 42 04             	add    0x4(%edx),%eax
+  8020f8:	2b 43 18             	sub    0x18(%ebx),%eax
+  8020fb:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8020fe:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802105:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80210c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802111:	eb 13                	jmp    802126 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802113:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80211a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802121:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802126:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802129:	c9                   	leave
+  80212a:	c3                   	ret
+
+0080212b <stream_drain>:
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	56                   	push   %esi
+  80212f:	53                   	push   %ebx
+  802130:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802137:	eb 02                	jmp    80213b <stream_drain+0x10>
+  802139:	01 c3                	add    %eax,%ebx
+  80213b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80213e:	39 c3                	cmp    %eax,%ebx
+  802140:	73 43                	jae    802185 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802142:	83 ec 04             	sub    $0x4,%esp
+  802145:	29 d8                	sub    %ebx,%eax
+  802147:	50                   	push   %eax
+  802148:	89 d8                	mov    %ebx,%eax
+  80214a:	03 46 0c             	add    0xc(%esi),%eax
+  80214d:	50                   	push   %eax
+  80214e:	ff 36                	push   (%esi)
+  802150:	e8 ec f4 ff ff       	call   801641 <write>
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	7f dd                	jg     802139 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80215c:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802160:	8b 56 0c             	mov    0xc(%esi),%edx
+  802163:	83 ec 04             	sub    $0x4,%esp
+  802166:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802169:	29 d8                	sub    %ebx,%eax
+  80216b:	50                   	push   %eax
+  80216c:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80216f:	50                   	push   %eax
+  802170:	52                   	push   %edx
+  802171:	e8 6c e9 ff ff       	call   800ae2 <memmove>
+			f->f_wend -= done;
+  802176:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802179:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802183:	eb 0a                	jmp    80218f <stream_drain+0x64>
+  802185:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80218a:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80218f:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802192:	89 d0                	mov    %edx,%eax
+  802194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802197:	5b                   	pop    %ebx
+  802198:	5e                   	pop    %esi
+  802199:	5d                   	pop    %ebp
+  80219a:	c3                   	ret
+
+0080219b <stream_setup>:
+	if (f->f_buf)
+  80219b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80219f:	74 01                	je     8021a2 <stream_setup+0x7>
+  8021a1:	c3                   	ret
+{
+  8021a2:	55                   	push   %ebp
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 04             	sub    $0x4,%esp
+  8021a9:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8021ab:	8b 40 08             	mov    0x8(%eax),%eax
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	74 17                	je     8021c9 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8021b2:	83 f8 03             	cmp    $0x3,%eax
+  8021b5:	75 2d                	jne    8021e4 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8021b7:	8d 43 20             	lea    0x20(%ebx),%eax
+  8021ba:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8021bd:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8021c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c7:	c9                   	leave
+  8021c8:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8021c9:	83 ec 0c             	sub    $0xc,%esp
+  8021cc:	ff 33                	push   (%ebx)
+  8021ce:	e8 29 1b 00 00       	call   803cfc <iscons>
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	85 c0                	test   %eax,%eax
+  8021d8:	0f 9f c0             	setg   %al
+  8021db:	0f b6 c0             	movzbl %al,%eax
+  8021de:	83 c0 01             	add    $0x1,%eax
+  8021e1:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	68 00 10 00 00       	push   $0x1000
+  8021ec:	e8 6e 0b 00 00       	call   802d5f <malloc>
+  8021f1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021f4:	83 c4 10             	add    $0x10,%esp
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	74 bc                	je     8021b7 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8021fb:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802202:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802206:	eb bc                	jmp    8021c4 <stream_setup+0x29>
+
+00802208 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802208:	55                   	push   %ebp
+  802209:	89 e5                	mov    %esp,%ebp
+  80220b:	53                   	push   %ebx
+  80220c:	83 ec 04             	sub    $0x4,%esp
+  80220f:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802211:	e8 85 ff ff ff       	call   80219b <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802216:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80221b:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80221f:	74 3d                	je     80225e <stream_fill+0x56>
+  802221:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802225:	74 10                	je     802237 <stream_fill+0x2f>
+  802227:	89 d8                	mov    %ebx,%eax
+  802229:	e8 fd fe ff ff       	call   80212b <stream_drain>
+		return 0;
+  80222e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 27                	js     80225e <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802237:	83 ec 04             	sub    $0x4,%esp
+  80223a:	ff 73 10             	push   0x10(%ebx)
+  80223d:	ff 73 0c             	push   0xc(%ebx)
+  802240:	ff 33                	push   (%ebx)
+  802242:	e8 02 f3 ff ff       	call   801549 <read>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	7e 17                	jle    802265 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80224e:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802252:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802259:	89 c2                	mov    %eax,%edx
+  80225b:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80225e:	89 d0                	mov    %edx,%eax
+  802260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802263:	c9                   	leave
+  802264:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802265:	c1 f8 1f             	sar    $0x1f,%eax
+  802268:	83 e0 04             	and    $0x4,%eax
+  80226b:	83 c0 04             	add    $0x4,%eax
+  80226e:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802271:	ba 00 00 00 00       	mov    $0x0,%edx
+  802276:	eb e6                	jmp    80225e <stream_fill+0x56>
+
+00802278 <fopen>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	57                   	push   %edi
+  80227c:	56                   	push   %esi
+  80227d:	53                   	push   %ebx
+  80227e:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802284:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802287:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80228d:	89 f0                	mov    %esi,%eax
+  80228f:	e8 40 fd ff ff       	call   801fd4 <parse_mode>
+		return 0;
+  802294:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	78 2d                	js     8022ca <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80229d:	83 ec 08             	sub    $0x8,%esp
+  8022a0:	50                   	push   %eax
+  8022a1:	ff 75 08             	push   0x8(%ebp)
+  8022a4:	e8 e8 f8 ff ff       	call   801b91 <open>
+  8022a9:	89 c7                	mov    %eax,%edi
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 58                	js     80230a <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8022b2:	80 3e 61             	cmpb   $0x61,(%esi)
+  8022b5:	74 1d                	je     8022d4 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8022b7:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8022bd:	89 f8                	mov    %edi,%eax
+  8022bf:	e8 7b fd ff ff       	call   80203f <stream_alloc>
+  8022c4:	89 c3                	mov    %eax,%ebx
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	74 32                	je     8022fc <fopen+0x84>
+}
+  8022ca:	89 d8                	mov    %ebx,%eax
+  8022cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022cf:	5b                   	pop    %ebx
+  8022d0:	5e                   	pop    %esi
+  8022d1:	5f                   	pop    %edi
+  8022d2:	5d                   	pop    %ebp
+  8022d3:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8022d4:	83 ec 08             	sub    $0x8,%esp
+  8022d7:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8022dd:	50                   	push   %eax
+  8022de:	57                   	push   %edi
+  8022df:	e8 db f4 ff ff       	call   8017bf <fstat>
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 cc                	js     8022b7 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8022eb:	83 ec 08             	sub    $0x8,%esp
+  8022ee:	ff 75 dc             	push   -0x24(%ebp)
+  8022f1:	57                   	push   %edi
+  8022f2:	e8 f6 f3 ff ff       	call   8016ed <seek>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+  8022fa:	eb bb                	jmp    8022b7 <fopen+0x3f>
+		close(fd);
+  8022fc:	83 ec 0c             	sub    $0xc,%esp
+  8022ff:	57                   	push   %edi
+  802300:	e8 08 f1 ff ff       	call   80140d <close>
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	eb c0                	jmp    8022ca <fopen+0x52>
+		return 0;
+  80230a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80230f:	eb b9                	jmp    8022ca <fopen+0x52>
+
+00802311 <fdopen>:
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802317:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80231a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231d:	e8 b2 fc ff ff       	call   801fd4 <parse_mode>
+  802322:	89 c2                	mov    %eax,%edx
+		return 0;
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802329:	85 d2                	test   %edx,%edx
+  80232b:	78 0b                	js     802338 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80232d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802330:	8b 45 08             	mov    0x8(%ebp),%eax
+  802333:	e8 07 fd ff ff       	call   80203f <stream_alloc>
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+0080233a <setvbuf>:
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	57                   	push   %edi
+  80233e:	56                   	push   %esi
+  80233f:	53                   	push   %ebx
+  802340:	8b 45 08             	mov    0x8(%ebp),%eax
+  802343:	8b 55 10             	mov    0x10(%ebp),%edx
+  802346:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802349:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80234d:	75 3a                	jne    802389 <setvbuf+0x4f>
+  80234f:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802352:	83 fe 02             	cmp    $0x2,%esi
+  802355:	77 39                	ja     802390 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802357:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80235a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80235e:	0f 95 c3             	setne  %bl
+  802361:	85 ff                	test   %edi,%edi
+  802363:	0f 95 c1             	setne  %cl
+  802366:	84 cb                	test   %cl,%bl
+  802368:	74 05                	je     80236f <setvbuf+0x35>
+  80236a:	83 fa 03             	cmp    $0x3,%edx
+  80236d:	75 0a                	jne    802379 <setvbuf+0x3f>
+	return 0;
+  80236f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802374:	5b                   	pop    %ebx
+  802375:	5e                   	pop    %esi
+  802376:	5f                   	pop    %edi
+  802377:	5d                   	pop    %ebp
+  802378:	c3                   	ret
+		f->f_buf = buf;
+  802379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80237c:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80237f:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802382:	b8 00 00 00 00       	mov    $0x0,%eax
+  802387:	eb eb                	jmp    802374 <setvbuf+0x3a>
+		return EOF;
+  802389:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80238e:	eb e4                	jmp    802374 <setvbuf+0x3a>
+  802390:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802395:	eb dd                	jmp    802374 <setvbuf+0x3a>
+
+00802397 <fflush>:
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	57                   	push   %edi
+  80239b:	56                   	push   %esi
+  80239c:	53                   	push   %ebx
+  80239d:	83 ec 0c             	sub    $0xc,%esp
+  8023a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8023a3:	85 db                	test   %ebx,%ebx
+  8023a5:	74 1a                	je     8023c1 <fflush+0x2a>
+	stream_unread(f);
+  8023a7:	89 d8                	mov    %ebx,%eax
+  8023a9:	e8 0a fd ff ff       	call   8020b8 <stream_unread>
+	return stream_drain(f);
+  8023ae:	89 d8                	mov    %ebx,%eax
+  8023b0:	e8 76 fd ff ff       	call   80212b <stream_drain>
+  8023b5:	89 c7                	mov    %eax,%edi
+}
+  8023b7:	89 f8                	mov    %edi,%eax
+  8023b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023bc:	5b                   	pop    %ebx
+  8023bd:	5e                   	pop    %esi
+  8023be:	5f                   	pop    %edi
+  8023bf:	5d                   	pop    %ebp
+  8023c0:	c3                   	ret
+  8023c1:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  8023c6:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8023cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d0:	eb 03                	jmp    8023d5 <fflush+0x3e>
+  8023d2:	83 c3 24             	add    $0x24,%ebx
+  8023d5:	39 f3                	cmp    %esi,%ebx
+  8023d7:	74 de                	je     8023b7 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8023d9:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8023dd:	74 f3                	je     8023d2 <fflush+0x3b>
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	53                   	push   %ebx
+  8023e3:	e8 af ff ff ff       	call   802397 <fflush>
+  8023e8:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8023eb:	85 c0                	test   %eax,%eax
+  8023ed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023f2:	0f 48 f8             	cmovs  %eax,%edi
+  8023f5:	eb db                	jmp    8023d2 <fflush+0x3b>
+
+008023f7 <fclose>:
+{
+  8023f7:	55                   	push   %ebp
+  8023f8:	89 e5                	mov    %esp,%ebp
+  8023fa:	56                   	push   %esi
+  8023fb:	53                   	push   %ebx
+  8023fc:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8023ff:	83 ec 0c             	sub    $0xc,%esp
+  802402:	56                   	push   %esi
+  802403:	e8 8f ff ff ff       	call   802397 <fflush>
+  802408:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80240a:	83 c4 04             	add    $0x4,%esp
+  80240d:	ff 36                	push   (%esi)
+  80240f:	e8 f9 ef ff ff       	call   80140d <close>
+  802414:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802417:	85 c0                	test   %eax,%eax
+  802419:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80241e:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802421:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802425:	75 10                	jne    802437 <fclose+0x40>
+	f->f_flags = 0;
+  802427:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80242e:	89 d8                	mov    %ebx,%eax
+  802430:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802433:	5b                   	pop    %ebx
+  802434:	5e                   	pop    %esi
+  802435:	5d                   	pop    %ebp
+  802436:	c3                   	ret
+		free(f->f_buf);
+  802437:	83 ec 0c             	sub    $0xc,%esp
+  80243a:	ff 76 0c             	push   0xc(%esi)
+  80243d:	e8 54 08 00 00       	call   802c96 <free>
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	eb e0                	jmp    802427 <fclose+0x30>
+
+00802447 <fileno>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80244a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244d:	8b 00                	mov    (%eax),%eax
+}
+  80244f:	5d                   	pop    %ebp
+  802450:	c3                   	ret
+
+00802451 <feof>:
+{
+  802451:	55                   	push   %ebp
+  802452:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802454:	8b 45 08             	mov    0x8(%ebp),%eax
+  802457:	8b 40 04             	mov    0x4(%eax),%eax
+  80245a:	c1 e8 02             	shr    $0x2,%eax
+  80245d:	83 e0 01             	and    $0x1,%eax
+}
+  802460:	5d                   	pop    %ebp
+  802461:	c3                   	ret
+
+00802462 <ferror>:
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802465:	8b 45 08             	mov    0x8(%ebp),%eax
+  802468:	8b 40 04             	mov    0x4(%eax),%eax
+  80246b:	c1 e8 03             	shr    $0x3,%eax
+  80246e:	83 e0 01             	and    $0x1,%eax
+}
+  802471:	5d                   	pop    %ebp
+  802472:	c3                   	ret
+
+00802473 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	53                   	push   %ebx
+  802477:	83 ec 04             	sub    $0x4,%esp
+  80247a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80247d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802480:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802483:	74 15                	je     80249a <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802485:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802488:	8b 43 14             	mov    0x14(%ebx),%eax
+  80248b:	8d 48 01             	lea    0x1(%eax),%ecx
+  80248e:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802491:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80249a:	89 d8                	mov    %ebx,%eax
+  80249c:	e8 67 fd ff ff       	call   802208 <stream_fill>
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	75 e0                	jne    802485 <fgetc+0x12>
+		return EOF;
+  8024a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024aa:	eb e9                	jmp    802495 <fgetc+0x22>
+
+008024ac <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	57                   	push   %edi
+  8024b0:	56                   	push   %esi
+  8024b1:	53                   	push   %ebx
+  8024b2:	83 ec 1c             	sub    $0x1c,%esp
+  8024b5:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8024b8:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8024bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c0:	83 e8 01             	sub    $0x1,%eax
+  8024c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8024c6:	eb 66                	jmp    80252e <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8024c8:	8b 46 14             	mov    0x14(%esi),%eax
+  8024cb:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024ce:	29 c3                	sub    %eax,%ebx
+  8024d0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8024d3:	29 fa                	sub    %edi,%edx
+  8024d5:	39 d3                	cmp    %edx,%ebx
+  8024d7:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8024da:	83 ec 04             	sub    $0x4,%esp
+  8024dd:	53                   	push   %ebx
+  8024de:	6a 0a                	push   $0xa
+  8024e0:	03 46 0c             	add    0xc(%esi),%eax
+  8024e3:	50                   	push   %eax
+  8024e4:	e8 aa e6 ff ff       	call   800b93 <memfind>
+  8024e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8024ec:	8b 46 0c             	mov    0xc(%esi),%eax
+  8024ef:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8024f2:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8024f5:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8024fd:	74 0b                	je     80250a <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8024ff:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802502:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802505:	29 d3                	sub    %edx,%ebx
+  802507:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80250a:	83 ec 04             	sub    $0x4,%esp
+  80250d:	53                   	push   %ebx
+  80250e:	01 c8                	add    %ecx,%eax
+  802510:	50                   	push   %eax
+  802511:	89 f8                	mov    %edi,%eax
+  802513:	03 45 08             	add    0x8(%ebp),%eax
+  802516:	50                   	push   %eax
+  802517:	e8 c6 e5 ff ff       	call   800ae2 <memmove>
+		f->f_rpos += m;
+  80251c:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80251f:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802521:	83 c4 10             	add    $0x10,%esp
+  802524:	8b 45 08             	mov    0x8(%ebp),%eax
+  802527:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80252c:	74 1f                	je     80254d <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80252e:	8d 47 01             	lea    0x1(%edi),%eax
+  802531:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802534:	73 17                	jae    80254d <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802536:	8b 46 18             	mov    0x18(%esi),%eax
+  802539:	39 46 14             	cmp    %eax,0x14(%esi)
+  80253c:	75 8a                	jne    8024c8 <fgets+0x1c>
+  80253e:	89 f0                	mov    %esi,%eax
+  802540:	e8 c3 fc ff ff       	call   802208 <stream_fill>
+  802545:	85 c0                	test   %eax,%eax
+  802547:	0f 85 7b ff ff ff    	jne    8024c8 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80254d:	85 ff                	test   %edi,%edi
+  80254f:	74 0f                	je     802560 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802551:	8b 45 08             	mov    0x8(%ebp),%eax
+  802554:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255b:	5b                   	pop    %ebx
+  80255c:	5e                   	pop    %esi
+  80255d:	5f                   	pop    %edi
+  80255e:	5d                   	pop    %ebp
+  80255f:	c3                   	ret
+		return 0;
+  802560:	b8 00 00 00 00       	mov    $0x0,%eax
+  802565:	eb f1                	jmp    802558 <fgets+0xac>
+
+00802567 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	57                   	push   %edi
+  80256b:	56                   	push   %esi
+  80256c:	53                   	push   %ebx
+  80256d:	83 ec 1c             	sub    $0x1c,%esp
+  802570:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802573:	89 f0                	mov    %esi,%eax
+  802575:	e8 21 fc ff ff       	call   80219b <stream_setup>
+	want = size * n;
+  80257a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802581:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802584:	bf 00 00 00 00       	mov    $0x0,%edi
+  802589:	eb 43                	jmp    8025ce <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80258b:	29 d3                	sub    %edx,%ebx
+  80258d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802590:	29 f8                	sub    %edi,%eax
+  802592:	39 c3                	cmp    %eax,%ebx
+  802594:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	53                   	push   %ebx
+  80259b:	03 56 0c             	add    0xc(%esi),%edx
+  80259e:	52                   	push   %edx
+  80259f:	89 f8                	mov    %edi,%eax
+  8025a1:	03 45 08             	add    0x8(%ebp),%eax
+  8025a4:	50                   	push   %eax
+  8025a5:	e8 38 e5 ff ff       	call   800ae2 <memmove>
+			f->f_rpos += m;
+  8025aa:	01 5e 14             	add    %ebx,0x14(%esi)
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	eb 1a                	jmp    8025cc <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8025b2:	83 ec 04             	sub    $0x4,%esp
+  8025b5:	53                   	push   %ebx
+  8025b6:	89 f8                	mov    %edi,%eax
+  8025b8:	03 45 08             	add    0x8(%ebp),%eax
+  8025bb:	50                   	push   %eax
+  8025bc:	ff 36                	push   (%esi)
+  8025be:	e8 86 ef ff ff       	call   801549 <read>
+  8025c3:	89 c3                	mov    %eax,%ebx
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	85 c0                	test   %eax,%eax
+  8025ca:	7e 36                	jle    802602 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8025cc:	01 df                	add    %ebx,%edi
+  8025ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025d1:	39 c7                	cmp    %eax,%edi
+  8025d3:	73 39                	jae    80260e <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8025d5:	8b 56 14             	mov    0x14(%esi),%edx
+  8025d8:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8025db:	39 da                	cmp    %ebx,%edx
+  8025dd:	72 ac                	jb     80258b <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8025df:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025e2:	29 fb                	sub    %edi,%ebx
+  8025e4:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8025e7:	72 3e                	jb     802627 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8025e9:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8025ed:	74 1f                	je     80260e <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8025ef:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8025f3:	74 bd                	je     8025b2 <fread+0x4b>
+  8025f5:	89 f0                	mov    %esi,%eax
+  8025f7:	e8 2f fb ff ff       	call   80212b <stream_drain>
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	79 b2                	jns    8025b2 <fread+0x4b>
+  802600:	eb 0c                	jmp    80260e <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802602:	c1 fb 1f             	sar    $0x1f,%ebx
+  802605:	83 e3 04             	and    $0x4,%ebx
+  802608:	83 c3 04             	add    $0x4,%ebx
+  80260b:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80260e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802611:	85 c0                	test   %eax,%eax
+  802613:	74 0a                	je     80261f <fread+0xb8>
+  802615:	89 f8                	mov    %edi,%eax
+  802617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261c:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80261f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802622:	5b                   	pop    %ebx
+  802623:	5e                   	pop    %esi
+  802624:	5f                   	pop    %edi
+  802625:	5d                   	pop    %ebp
+  802626:	c3                   	ret
+		} else if (!stream_fill(f))
+  802627:	89 f0                	mov    %esi,%eax
+  802629:	e8 da fb ff ff       	call   802208 <stream_fill>
+  80262e:	85 c0                	test   %eax,%eax
+  802630:	74 dc                	je     80260e <fread+0xa7>
+			m = 0;
+  802632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802637:	eb 93                	jmp    8025cc <fread+0x65>
+
+00802639 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802639:	55                   	push   %ebp
+  80263a:	89 e5                	mov    %esp,%ebp
+  80263c:	57                   	push   %edi
+  80263d:	56                   	push   %esi
+  80263e:	53                   	push   %ebx
+  80263f:	83 ec 1c             	sub    $0x1c,%esp
+  802642:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802645:	8b 43 04             	mov    0x4(%ebx),%eax
+  802648:	a8 02                	test   $0x2,%al
+  80264a:	75 13                	jne    80265f <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80264c:	83 c8 08             	or     $0x8,%eax
+  80264f:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802652:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265a:	5b                   	pop    %ebx
+  80265b:	5e                   	pop    %esi
+  80265c:	5f                   	pop    %edi
+  80265d:	5d                   	pop    %ebp
+  80265e:	c3                   	ret
+	stream_setup(f);
+  80265f:	89 d8                	mov    %ebx,%eax
+  802661:	e8 35 fb ff ff       	call   80219b <stream_setup>
+	want = size * n;
+  802666:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802669:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80266d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802670:	89 d8                	mov    %ebx,%eax
+  802672:	e8 41 fa ff ff       	call   8020b8 <stream_unread>
+	for (done = 0; done < want; ) {
+  802677:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80267c:	84 c0                	test   %al,%al
+  80267e:	75 7b                	jne    8026fb <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802680:	be 00 00 00 00       	mov    $0x0,%esi
+  802685:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802688:	39 fe                	cmp    %edi,%esi
+  80268a:	73 24                	jae    8026b0 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80268c:	83 ec 04             	sub    $0x4,%esp
+  80268f:	89 f8                	mov    %edi,%eax
+  802691:	29 f0                	sub    %esi,%eax
+  802693:	50                   	push   %eax
+  802694:	89 f0                	mov    %esi,%eax
+  802696:	03 45 08             	add    0x8(%ebp),%eax
+  802699:	50                   	push   %eax
+  80269a:	ff 33                	push   (%ebx)
+  80269c:	e8 a0 ef ff ff       	call   801641 <write>
+  8026a1:	83 c4 10             	add    $0x10,%esp
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	7e 04                	jle    8026ac <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8026a8:	01 c6                	add    %eax,%esi
+  8026aa:	eb dc                	jmp    802688 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8026ac:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8026b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b3:	85 c0                	test   %eax,%eax
+  8026b5:	74 a0                	je     802657 <fwrite+0x1e>
+  8026b7:	89 f0                	mov    %esi,%eax
+  8026b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026be:	f7 75 0c             	divl   0xc(%ebp)
+  8026c1:	eb 94                	jmp    802657 <fwrite+0x1e>
+			done += r;
+  8026c3:	01 c7                	add    %eax,%edi
+			continue;
+  8026c5:	eb 34                	jmp    8026fb <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8026c7:	8b 73 10             	mov    0x10(%ebx),%esi
+  8026ca:	29 c6                	sub    %eax,%esi
+  8026cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026cf:	29 fa                	sub    %edi,%edx
+  8026d1:	39 d6                	cmp    %edx,%esi
+  8026d3:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8026d6:	83 ec 04             	sub    $0x4,%esp
+  8026d9:	56                   	push   %esi
+  8026da:	89 fa                	mov    %edi,%edx
+  8026dc:	03 55 08             	add    0x8(%ebp),%edx
+  8026df:	52                   	push   %edx
+  8026e0:	03 43 0c             	add    0xc(%ebx),%eax
+  8026e3:	50                   	push   %eax
+  8026e4:	e8 f9 e3 ff ff       	call   800ae2 <memmove>
+		f->f_wend += m;
+  8026e9:	89 f0                	mov    %esi,%eax
+  8026eb:	03 43 1c             	add    0x1c(%ebx),%eax
+  8026ee:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8026f1:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8026f9:	74 5b                	je     802756 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8026fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026fe:	39 c7                	cmp    %eax,%edi
+  802700:	73 2d                	jae    80272f <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802702:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802705:	85 c0                	test   %eax,%eax
+  802707:	75 be                	jne    8026c7 <fwrite+0x8e>
+  802709:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80270c:	29 fa                	sub    %edi,%edx
+  80270e:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802711:	72 b4                	jb     8026c7 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802713:	83 ec 04             	sub    $0x4,%esp
+  802716:	52                   	push   %edx
+  802717:	89 f8                	mov    %edi,%eax
+  802719:	03 45 08             	add    0x8(%ebp),%eax
+  80271c:	50                   	push   %eax
+  80271d:	ff 33                	push   (%ebx)
+  80271f:	e8 1d ef ff ff       	call   801641 <write>
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	85 c0                	test   %eax,%eax
+  802729:	7f 98                	jg     8026c3 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80272b:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80272f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802732:	83 f8 03             	cmp    $0x3,%eax
+  802735:	74 48                	je     80277f <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802737:	83 f8 02             	cmp    $0x2,%eax
+  80273a:	74 27                	je     802763 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80273c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	0f 84 10 ff ff ff    	je     802657 <fwrite+0x1e>
+  802747:	89 f8                	mov    %edi,%eax
+  802749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274e:	f7 75 0c             	divl   0xc(%ebp)
+  802751:	e9 01 ff ff ff       	jmp    802657 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802756:	89 d8                	mov    %ebx,%eax
+  802758:	e8 ce f9 ff ff       	call   80212b <stream_drain>
+  80275d:	85 c0                	test   %eax,%eax
+  80275f:	79 9a                	jns    8026fb <fwrite+0xc2>
+  802761:	eb cc                	jmp    80272f <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802763:	83 ec 04             	sub    $0x4,%esp
+  802766:	57                   	push   %edi
+  802767:	6a 0a                	push   $0xa
+  802769:	ff 75 08             	push   0x8(%ebp)
+  80276c:	e8 22 e4 ff ff       	call   800b93 <memfind>
+  802771:	89 c2                	mov    %eax,%edx
+  802773:	89 f8                	mov    %edi,%eax
+  802775:	03 45 08             	add    0x8(%ebp),%eax
+  802778:	83 c4 10             	add    $0x10,%esp
+  80277b:	39 c2                	cmp    %eax,%edx
+  80277d:	74 bd                	je     80273c <fwrite+0x103>
+		stream_drain(f);
+  80277f:	89 d8                	mov    %ebx,%eax
+  802781:	e8 a5 f9 ff ff       	call   80212b <stream_drain>
+  802786:	eb b4                	jmp    80273c <fwrite+0x103>
+
+00802788 <fputc>:
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	53                   	push   %ebx
+  80278c:	83 ec 14             	sub    $0x14,%esp
+  80278f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802792:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802795:	ff 75 0c             	push   0xc(%ebp)
+  802798:	6a 01                	push   $0x1
+  80279a:	6a 01                	push   $0x1
+  80279c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80279f:	50                   	push   %eax
+  8027a0:	e8 94 fe ff ff       	call   802639 <fwrite>
+  8027a5:	83 c4 10             	add    $0x10,%esp
+  8027a8:	0f b6 db             	movzbl %bl,%ebx
+  8027ab:	83 f8 01             	cmp    $0x1,%eax
+  8027ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027b3:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8027b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b9:	c9                   	leave
+  8027ba:	c3                   	ret
+
+008027bb <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8027c1:	ff 75 0c             	push   0xc(%ebp)
+  8027c4:	ff 75 08             	push   0x8(%ebp)
+  8027c7:	e8 bc ff ff ff       	call   802788 <fputc>
+}
+  8027cc:	83 c4 10             	add    $0x10,%esp
+  8027cf:	c9                   	leave
+  8027d0:	c3                   	ret
+
+008027d1 <fputs>:
+{
+  8027d1:	55                   	push   %ebp
+  8027d2:	89 e5                	mov    %esp,%ebp
+  8027d4:	56                   	push   %esi
+  8027d5:	53                   	push   %ebx
+  8027d6:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8027d9:	83 ec 0c             	sub    $0xc,%esp
+  8027dc:	56                   	push   %esi
+  8027dd:	e8 3f e1 ff ff       	call   800921 <strlen>
+  8027e2:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8027e4:	ff 75 0c             	push   0xc(%ebp)
+  8027e7:	50                   	push   %eax
+  8027e8:	6a 01                	push   $0x1
+  8027ea:	56                   	push   %esi
+  8027eb:	e8 49 fe ff ff       	call   802639 <fwrite>
+  8027f0:	83 c4 20             	add    $0x20,%esp
+  8027f3:	39 d8                	cmp    %ebx,%eax
+  8027f5:	0f 95 c0             	setne  %al
+  8027f8:	0f b6 c0             	movzbl %al,%eax
+  8027fb:	f7 d8                	neg    %eax
+}
+  8027fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802800:	5b                   	pop    %ebx
+  802801:	5e                   	pop    %esi
+  802802:	5d                   	pop    %ebp
+  802803:	c3                   	ret
+
+00802804 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	53                   	push   %ebx
+  802808:	83 ec 04             	sub    $0x4,%esp
+  80280b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80280e:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802811:	50                   	push   %eax
+  802812:	ff 75 0c             	push   0xc(%ebp)
+  802815:	53                   	push   %ebx
+  802816:	68 bb 27 80 00       	push   $0x8027bb
+  80281b:	e8 4f dc ff ff       	call   80046f <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802820:	8b 43 04             	mov    0x4(%ebx),%eax
+  802823:	c1 e0 1c             	shl    $0x1c,%eax
+  802826:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+0080282e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80282e:	55                   	push   %ebp
+  80282f:	89 e5                	mov    %esp,%ebp
+  802831:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802834:	68 b8 4d 80 00       	push   $0x804db8
+  802839:	ff 75 0c             	push   0xc(%ebp)
+  80283c:	e8 1b e1 ff ff       	call   80095c <strcpy>
+	return 0;
+}
+  802841:	b8 00 00 00 00       	mov    $0x0,%eax
+  802846:	c9                   	leave
+  802847:	c3                   	ret
+
+00802848 <devsock_close>:
+{
+  802848:	55                   	push   %ebp
+  802849:	89 e5                	mov    %esp,%ebp
+  80284b:	53                   	push   %ebx
+  80284c:	83 ec 10             	sub    $0x10,%esp
+  80284f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802852:	53                   	push   %ebx
+  802853:	e8 23 1d 00 00       	call   80457b <pageref>
+  802858:	89 c2                	mov    %eax,%edx
+  80285a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80285d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802862:	83 fa 01             	cmp    $0x1,%edx
+  802865:	74 05                	je     80286c <devsock_close+0x24>
+}
+  802867:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80286c:	83 ec 0c             	sub    $0xc,%esp
+  80286f:	ff 73 0c             	push   0xc(%ebx)
+  802872:	e8 b7 02 00 00       	call   802b2e <nsipc_close>
+  802877:	83 c4 10             	add    $0x10,%esp
+  80287a:	eb eb                	jmp    802867 <devsock_close+0x1f>
+
+0080287c <devsock_write>:
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802882:	6a 00                	push   $0x0
+  802884:	ff 75 10             	push   0x10(%ebp)
+  802887:	ff 75 0c             	push   0xc(%ebp)
+  80288a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288d:	ff 70 0c             	push   0xc(%eax)
+  802890:	e8 79 03 00 00       	call   802c0e <nsipc_send>
+}
+  802895:	c9                   	leave
+  802896:	c3                   	ret
+
+00802897 <devsock_read>:
+{
+  802897:	55                   	push   %ebp
+  802898:	89 e5                	mov    %esp,%ebp
+  80289a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80289d:	6a 00                	push   $0x0
+  80289f:	ff 75 10             	push   0x10(%ebp)
+  8028a2:	ff 75 0c             	push   0xc(%ebp)
+  8028a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a8:	ff 70 0c             	push   0xc(%eax)
+  8028ab:	e8 ef 02 00 00       	call   802b9f <nsipc_recv>
+}
+  8028b0:	c9                   	leave
+  8028b1:	c3                   	ret
+
+008028b2 <fd2sockid>:
+{
+  8028b2:	55                   	push   %ebp
+  8028b3:	89 e5                	mov    %esp,%ebp
+  8028b5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8028b8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028bb:	52                   	push   %edx
+  8028bc:	50                   	push   %eax
+  8028bd:	e8 f7 e9 ff ff       	call   8012b9 <fd_lookup>
+  8028c2:	83 c4 10             	add    $0x10,%esp
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	78 10                	js     8028d9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028cc:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  8028d2:	39 08                	cmp    %ecx,(%eax)
+  8028d4:	75 05                	jne    8028db <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028d6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028d9:	c9                   	leave
+  8028da:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028e0:	eb f7                	jmp    8028d9 <fd2sockid+0x27>
+
+008028e2 <alloc_sockfd>:
+{
+  8028e2:	55                   	push   %ebp
+  8028e3:	89 e5                	mov    %esp,%ebp
+  8028e5:	56                   	push   %esi
+  8028e6:	53                   	push   %ebx
+  8028e7:	83 ec 1c             	sub    $0x1c,%esp
+  8028ea:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ef:	50                   	push   %eax
+  8028f0:	e8 6e e9 ff ff       	call   801263 <fd_alloc>
+  8028f5:	89 c3                	mov    %eax,%ebx
+  8028f7:	83 c4 10             	add    $0x10,%esp
+  8028fa:	85 c0                	test   %eax,%eax
+  8028fc:	78 43                	js     802941 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028fe:	83 ec 04             	sub    $0x4,%esp
+  802901:	68 07 04 00 00       	push   $0x407
+  802906:	ff 75 f4             	push   -0xc(%ebp)
+  802909:	6a 00                	push   $0x0
+  80290b:	e8 8a e4 ff ff       	call   800d9a <sys_page_alloc>
+  802910:	89 c3                	mov    %eax,%ebx
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	85 c0                	test   %eax,%eax
+  802917:	78 28                	js     802941 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802919:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80291c:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802922:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802924:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802927:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80292e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802931:	83 ec 0c             	sub    $0xc,%esp
+  802934:	50                   	push   %eax
+  802935:	e8 02 e9 ff ff       	call   80123c <fd2num>
+  80293a:	89 c3                	mov    %eax,%ebx
+  80293c:	83 c4 10             	add    $0x10,%esp
+  80293f:	eb 0c                	jmp    80294d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802941:	83 ec 0c             	sub    $0xc,%esp
+  802944:	56                   	push   %esi
+  802945:	e8 e4 01 00 00       	call   802b2e <nsipc_close>
+		return r;
+  80294a:	83 c4 10             	add    $0x10,%esp
+}
+  80294d:	89 d8                	mov    %ebx,%eax
+  80294f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802952:	5b                   	pop    %ebx
+  802953:	5e                   	pop    %esi
+  802954:	5d                   	pop    %ebp
+  802955:	c3                   	ret
+
+00802956 <accept>:
+{
+  802956:	55                   	push   %ebp
+  802957:	89 e5                	mov    %esp,%ebp
+  802959:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80295c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80295f:	e8 4e ff ff ff       	call   8028b2 <fd2sockid>
+  802964:	85 c0                	test   %eax,%eax
+  802966:	78 1b                	js     802983 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802968:	83 ec 04             	sub    $0x4,%esp
+  80296b:	ff 75 10             	push   0x10(%ebp)
+  80296e:	ff 75 0c             	push   0xc(%ebp)
+  802971:	50                   	push   %eax
+  802972:	e8 0e 01 00 00       	call   802a85 <nsipc_accept>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 05                	js     802983 <accept+0x2d>
+	return alloc_sockfd(r);
+  80297e:	e8 5f ff ff ff       	call   8028e2 <alloc_sockfd>
+}
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+
+00802985 <bind>:
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80298b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298e:	e8 1f ff ff ff       	call   8028b2 <fd2sockid>
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 12                	js     8029a9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802997:	83 ec 04             	sub    $0x4,%esp
+  80299a:	ff 75 10             	push   0x10(%ebp)
+  80299d:	ff 75 0c             	push   0xc(%ebp)
+  8029a0:	50                   	push   %eax
+  8029a1:	e8 31 01 00 00       	call   802ad7 <nsipc_bind>
+  8029a6:	83 c4 10             	add    $0x10,%esp
+}
+  8029a9:	c9                   	leave
+  8029aa:	c3                   	ret
+
+008029ab <shutdown>:
+{
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b4:	e8 f9 fe ff ff       	call   8028b2 <fd2sockid>
+  8029b9:	85 c0                	test   %eax,%eax
+  8029bb:	78 0f                	js     8029cc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+  8029c0:	ff 75 0c             	push   0xc(%ebp)
+  8029c3:	50                   	push   %eax
+  8029c4:	e8 43 01 00 00       	call   802b0c <nsipc_shutdown>
+  8029c9:	83 c4 10             	add    $0x10,%esp
+}
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+
+008029ce <connect>:
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d7:	e8 d6 fe ff ff       	call   8028b2 <fd2sockid>
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	78 12                	js     8029f2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029e0:	83 ec 04             	sub    $0x4,%esp
+  8029e3:	ff 75 10             	push   0x10(%ebp)
+  8029e6:	ff 75 0c             	push   0xc(%ebp)
+  8029e9:	50                   	push   %eax
+  8029ea:	e8 59 01 00 00       	call   802b48 <nsipc_connect>
+  8029ef:	83 c4 10             	add    $0x10,%esp
+}
+  8029f2:	c9                   	leave
+  8029f3:	c3                   	ret
+
+008029f4 <listen>:
+{
+  8029f4:	55                   	push   %ebp
+  8029f5:	89 e5                	mov    %esp,%ebp
+  8029f7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fd:	e8 b0 fe ff ff       	call   8028b2 <fd2sockid>
+  802a02:	85 c0                	test   %eax,%eax
+  802a04:	78 0f                	js     802a15 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a06:	83 ec 08             	sub    $0x8,%esp
+  802a09:	ff 75 0c             	push   0xc(%ebp)
+  802a0c:	50                   	push   %eax
+  802a0d:	e8 6b 01 00 00       	call   802b7d <nsipc_listen>
+  802a12:	83 c4 10             	add    $0x10,%esp
+}
+  802a15:	c9                   	leave
+  802a16:	c3                   	ret
+
+00802a17 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a17:	55                   	push   %ebp
+  802a18:	89 e5                	mov    %esp,%ebp
+  802a1a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a1d:	ff 75 10             	push   0x10(%ebp)
+  802a20:	ff 75 0c             	push   0xc(%ebp)
+  802a23:	ff 75 08             	push   0x8(%ebp)
+  802a26:	e8 41 02 00 00       	call   802c6c <nsipc_socket>
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	78 05                	js     802a37 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a32:	e8 ab fe ff ff       	call   8028e2 <alloc_sockfd>
+}
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+00802a39 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a39:	55                   	push   %ebp
+  802a3a:	89 e5                	mov    %esp,%ebp
+  802a3c:	53                   	push   %ebx
+  802a3d:	83 ec 04             	sub    $0x4,%esp
+  802a40:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a42:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802a49:	74 26                	je     802a71 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a4b:	6a 07                	push   $0x7
+  802a4d:	68 00 90 80 00       	push   $0x809000
+  802a52:	53                   	push   %ebx
+  802a53:	ff 35 08 70 80 00    	push   0x807008
+  802a59:	e8 88 1a 00 00       	call   8044e6 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a5e:	83 c4 0c             	add    $0xc,%esp
+  802a61:	6a 00                	push   $0x0
+  802a63:	6a 00                	push   $0x0
+  802a65:	6a 00                	push   $0x0
+  802a67:	e8 84 19 00 00       	call   8043f0 <ipc_recv>
+}
+  802a6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a71:	83 ec 0c             	sub    $0xc,%esp
+  802a74:	6a 02                	push   $0x2
+  802a76:	e8 c1 1a 00 00       	call   80453c <ipc_find_env>
+  802a7b:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a80:	83 c4 10             	add    $0x10,%esp
+  802a83:	eb c6                	jmp    802a4b <nsipc+0x12>
+
+00802a85 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	56                   	push   %esi
+  802a89:	53                   	push   %ebx
+  802a8a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a90:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a95:	8b 06                	mov    (%esi),%eax
+  802a97:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aa1:	e8 93 ff ff ff       	call   802a39 <nsipc>
+  802aa6:	89 c3                	mov    %eax,%ebx
+  802aa8:	85 c0                	test   %eax,%eax
+  802aaa:	79 09                	jns    802ab5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802aac:	89 d8                	mov    %ebx,%eax
+  802aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab1:	5b                   	pop    %ebx
+  802ab2:	5e                   	pop    %esi
+  802ab3:	5d                   	pop    %ebp
+  802ab4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ab5:	83 ec 04             	sub    $0x4,%esp
+  802ab8:	ff 35 10 90 80 00    	push   0x809010
+  802abe:	68 00 90 80 00       	push   $0x809000
+  802ac3:	ff 75 0c             	push   0xc(%ebp)
+  802ac6:	e8 17 e0 ff ff       	call   800ae2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802acb:	a1 10 90 80 00       	mov    0x809010,%eax
+  802ad0:	89 06                	mov    %eax,(%esi)
+  802ad2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ad5:	eb d5                	jmp    802aac <nsipc_accept+0x27>
+
+00802ad7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	53                   	push   %ebx
+  802adb:	83 ec 08             	sub    $0x8,%esp
+  802ade:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae4:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ae9:	53                   	push   %ebx
+  802aea:	ff 75 0c             	push   0xc(%ebp)
+  802aed:	68 04 90 80 00       	push   $0x809004
+  802af2:	e8 eb df ff ff       	call   800ae2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802af7:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802afd:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b02:	e8 32 ff ff ff       	call   802a39 <nsipc>
+}
+  802b07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+
+00802b0c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b0c:	55                   	push   %ebp
+  802b0d:	89 e5                	mov    %esp,%ebp
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b15:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802b1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b1d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b22:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b27:	e8 0d ff ff ff       	call   802a39 <nsipc>
+}
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+
+00802b2e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b37:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802b3c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b41:	e8 f3 fe ff ff       	call   802a39 <nsipc>
+}
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+00802b48 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b48:	55                   	push   %ebp
+  802b49:	89 e5                	mov    %esp,%ebp
+  802b4b:	53                   	push   %ebx
+  802b4c:	83 ec 08             	sub    $0x8,%esp
+  802b4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b52:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b55:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b5a:	53                   	push   %ebx
+  802b5b:	ff 75 0c             	push   0xc(%ebp)
+  802b5e:	68 04 90 80 00       	push   $0x809004
+  802b63:	e8 7a df ff ff       	call   800ae2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b68:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802b6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b73:	e8 c1 fe ff ff       	call   802a39 <nsipc>
+}
+  802b78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+00802b7d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b86:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802b93:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b98:	e8 9c fe ff ff       	call   802a39 <nsipc>
+}
+  802b9d:	c9                   	leave
+  802b9e:	c3                   	ret
+
+00802b9f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	56                   	push   %esi
+  802ba3:	53                   	push   %ebx
+  802ba4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baa:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802baf:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802bb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bb8:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bbd:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bc2:	e8 72 fe ff ff       	call   802a39 <nsipc>
+  802bc7:	89 c3                	mov    %eax,%ebx
+  802bc9:	85 c0                	test   %eax,%eax
+  802bcb:	78 22                	js     802bef <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bcd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802bd2:	39 c6                	cmp    %eax,%esi
+  802bd4:	0f 4e c6             	cmovle %esi,%eax
+  802bd7:	39 c3                	cmp    %eax,%ebx
+  802bd9:	7f 1d                	jg     802bf8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802bdb:	83 ec 04             	sub    $0x4,%esp
+  802bde:	53                   	push   %ebx
+  802bdf:	68 00 90 80 00       	push   $0x809000
+  802be4:	ff 75 0c             	push   0xc(%ebp)
+  802be7:	e8 f6 de ff ff       	call   800ae2 <memmove>
+  802bec:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bef:	89 d8                	mov    %ebx,%eax
+  802bf1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bf4:	5b                   	pop    %ebx
+  802bf5:	5e                   	pop    %esi
+  802bf6:	5d                   	pop    %ebp
+  802bf7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bf8:	68 c4 4d 80 00       	push   $0x804dc4
+  802bfd:	68 7d 4d 80 00       	push   $0x804d7d
+  802c02:	6a 62                	push   $0x62
+  802c04:	68 d9 4d 80 00       	push   $0x804dd9
+  802c09:	e8 8f d6 ff ff       	call   80029d <_panic>
+
+00802c0e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c0e:	55                   	push   %ebp
+  802c0f:	89 e5                	mov    %esp,%ebp
+  802c11:	53                   	push   %ebx
+  802c12:	83 ec 04             	sub    $0x4,%esp
+  802c15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1b:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802c20:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c26:	7f 2e                	jg     802c56 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c28:	83 ec 04             	sub    $0x4,%esp
+  802c2b:	53                   	push   %ebx
+  802c2c:	ff 75 0c             	push   0xc(%ebp)
+  802c2f:	68 0c 90 80 00       	push   $0x80900c
+  802c34:	e8 a9 de ff ff       	call   800ae2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c39:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802c3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c42:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802c47:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c4c:	e8 e8 fd ff ff       	call   802a39 <nsipc>
+}
+  802c51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+	assert(size < 1600);
+  802c56:	68 e5 4d 80 00       	push   $0x804de5
+  802c5b:	68 7d 4d 80 00       	push   $0x804d7d
+  802c60:	6a 6d                	push   $0x6d
+  802c62:	68 d9 4d 80 00       	push   $0x804dd9
+  802c67:	e8 31 d6 ff ff       	call   80029d <_panic>
+
+00802c6c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c6c:	55                   	push   %ebp
+  802c6d:	89 e5                	mov    %esp,%ebp
+  802c6f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c75:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802c7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c7d:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c82:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c85:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802c8a:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c8f:	e8 a5 fd ff ff       	call   802a39 <nsipc>
+}
+  802c94:	c9                   	leave
+  802c95:	c3                   	ret
+
+00802c96 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	53                   	push   %ebx
+  802c9a:	83 ec 10             	sub    $0x10,%esp
+  802c9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802ca0:	68 0c 70 80 00       	push   $0x80700c
+  802ca5:	e8 50 07 00 00       	call   8033fa <mutex_lock>
+	if (v == 0)
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	85 db                	test   %ebx,%ebx
+  802caf:	0f 84 85 00 00 00    	je     802d3a <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802cb5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802cbb:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802cc0:	77 51                	ja     802d13 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802cc2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802cc8:	89 d8                	mov    %ebx,%eax
+  802cca:	c1 e8 0c             	shr    $0xc,%eax
+  802ccd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802cd4:	f6 c4 02             	test   $0x2,%ah
+  802cd7:	74 50                	je     802d29 <free+0x93>
+		sys_page_unmap(0, c);
+  802cd9:	83 ec 08             	sub    $0x8,%esp
+  802cdc:	53                   	push   %ebx
+  802cdd:	6a 00                	push   $0x0
+  802cdf:	e8 4f e1 ff ff       	call   800e33 <sys_page_unmap>
+		c += PGSIZE;
+  802ce4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802cea:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802cf0:	83 c4 10             	add    $0x10,%esp
+  802cf3:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802cf8:	76 ce                	jbe    802cc8 <free+0x32>
+  802cfa:	68 2f 4e 80 00       	push   $0x804e2f
+  802cff:	68 7d 4d 80 00       	push   $0x804d7d
+  802d04:	68 82 00 00 00       	push   $0x82
+  802d09:	68 22 4e 80 00       	push   $0x804e22
+  802d0e:	e8 8a d5 ff ff       	call   80029d <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802d13:	68 f4 4d 80 00       	push   $0x804df4
+  802d18:	68 7d 4d 80 00       	push   $0x804d7d
+  802d1d:	6a 7b                	push   $0x7b
+  802d1f:	68 22 4e 80 00       	push   $0x804e22
+  802d24:	e8 74 d5 ff ff       	call   80029d <_panic>
+	if (--(*ref) == 0)
+  802d29:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802d2f:	83 e8 01             	sub    $0x1,%eax
+  802d32:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802d38:	74 15                	je     802d4f <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802d3a:	83 ec 0c             	sub    $0xc,%esp
+  802d3d:	68 0c 70 80 00       	push   $0x80700c
+  802d42:	e8 20 07 00 00       	call   803467 <mutex_unlock>
+}
+  802d47:	83 c4 10             	add    $0x10,%esp
+  802d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+		sys_page_unmap(0, c);
+  802d4f:	83 ec 08             	sub    $0x8,%esp
+  802d52:	53                   	push   %ebx
+  802d53:	6a 00                	push   $0x0
+  802d55:	e8 d9 e0 ff ff       	call   800e33 <sys_page_unmap>
+  802d5a:	83 c4 10             	add    $0x10,%esp
+  802d5d:	eb db                	jmp    802d3a <free+0xa4>
+
+00802d5f <malloc>:
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	57                   	push   %edi
+  802d63:	56                   	push   %esi
+  802d64:	53                   	push   %ebx
+  802d65:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802d68:	68 0c 70 80 00       	push   $0x80700c
+  802d6d:	e8 88 06 00 00       	call   8033fa <mutex_lock>
+	if (mptr == 0)
+  802d72:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802d78:	83 c4 10             	add    $0x10,%esp
+  802d7b:	85 ff                	test   %edi,%edi
+  802d7d:	74 6c                	je     802deb <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d82:	83 c0 03             	add    $0x3,%eax
+  802d85:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d88:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d8a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d8f:	0f 87 64 01 00 00    	ja     802ef9 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802d95:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802d9b:	74 30                	je     802dcd <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802d9d:	89 f9                	mov    %edi,%ecx
+  802d9f:	c1 e9 0c             	shr    $0xc,%ecx
+  802da2:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802da6:	c1 e8 0c             	shr    $0xc,%eax
+  802da9:	39 c1                	cmp    %eax,%ecx
+  802dab:	74 5f                	je     802e0c <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802dad:	83 ec 0c             	sub    $0xc,%esp
+  802db0:	57                   	push   %edi
+  802db1:	e8 e0 fe ff ff       	call   802c96 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802db6:	a1 10 70 80 00       	mov    0x807010,%eax
+  802dbb:	05 00 10 00 00       	add    $0x1000,%eax
+  802dc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802dc5:	a3 10 70 80 00       	mov    %eax,0x807010
+  802dca:	83 c4 10             	add    $0x10,%esp
+  802dcd:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802dd3:	ba 02 00 00 00       	mov    $0x2,%edx
+  802dd8:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802ddc:	8d 7e 04             	lea    0x4(%esi),%edi
+  802ddf:	89 cb                	mov    %ecx,%ebx
+  802de1:	01 f9                	add    %edi,%ecx
+  802de3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802de6:	e9 8b 00 00 00       	jmp    802e76 <malloc+0x117>
+		mptr = mbegin;
+  802deb:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802df2:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df8:	83 c0 03             	add    $0x3,%eax
+  802dfb:	83 e0 fc             	and    $0xfffffffc,%eax
+  802dfe:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802e00:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802e05:	76 c6                	jbe    802dcd <malloc+0x6e>
+  802e07:	e9 d6 00 00 00       	jmp    802ee2 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802e0c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e12:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802e17:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802e1b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e1e:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802e23:	e9 ba 00 00 00       	jmp    802ee2 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e28:	05 00 10 00 00       	add    $0x1000,%eax
+  802e2d:	39 c8                	cmp    %ecx,%eax
+  802e2f:	0f 83 cb 00 00 00    	jae    802f00 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802e35:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802e3a:	77 22                	ja     802e5e <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802e3c:	89 c2                	mov    %eax,%edx
+  802e3e:	c1 ea 16             	shr    $0x16,%edx
+  802e41:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802e48:	f6 c2 01             	test   $0x1,%dl
+  802e4b:	74 db                	je     802e28 <malloc+0xc9>
+  802e4d:	89 c2                	mov    %eax,%edx
+  802e4f:	c1 ea 0c             	shr    $0xc,%edx
+  802e52:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802e59:	f6 c2 01             	test   $0x1,%dl
+  802e5c:	74 ca                	je     802e28 <malloc+0xc9>
+		if (mptr == mend) {
+  802e5e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e64:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802e6a:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802e6e:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802e74:	74 04                	je     802e7a <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e76:	89 d8                	mov    %ebx,%eax
+  802e78:	eb b3                	jmp    802e2d <malloc+0xce>
+  802e7a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802e7d:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802e82:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802e86:	83 ea 01             	sub    $0x1,%edx
+  802e89:	0f 85 50 ff ff ff    	jne    802ddf <malloc+0x80>
+  802e8f:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802e96:	00 00 08 
+				return 0;	/* out of address space */
+  802e99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e9e:	eb 42                	jmp    802ee2 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802ea0:	85 db                	test   %ebx,%ebx
+  802ea2:	78 1e                	js     802ec2 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802ea4:	83 ec 08             	sub    $0x8,%esp
+  802ea7:	89 d8                	mov    %ebx,%eax
+  802ea9:	03 05 10 70 80 00    	add    0x807010,%eax
+  802eaf:	50                   	push   %eax
+  802eb0:	6a 00                	push   $0x0
+  802eb2:	e8 7c df ff ff       	call   800e33 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802eb7:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ebd:	83 c4 10             	add    $0x10,%esp
+  802ec0:	eb de                	jmp    802ea0 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec7:	eb 19                	jmp    802ee2 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802ec9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ecc:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802ed2:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802ed9:	00 
+	mptr += n;
+  802eda:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802edd:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  802ee2:	83 ec 0c             	sub    $0xc,%esp
+  802ee5:	68 0c 70 80 00       	push   $0x80700c
+  802eea:	e8 78 05 00 00       	call   803467 <mutex_unlock>
+}
+  802eef:	89 f8                	mov    %edi,%eax
+  802ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef4:	5b                   	pop    %ebx
+  802ef5:	5e                   	pop    %esi
+  802ef6:	5f                   	pop    %edi
+  802ef7:	5d                   	pop    %ebp
+  802ef8:	c3                   	ret
+		return 0;
+  802ef9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efe:	eb e2                	jmp    802ee2 <malloc+0x183>
+  802f00:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802f04:	74 06                	je     802f0c <malloc+0x1ad>
+  802f06:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f11:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802f14:	39 fb                	cmp    %edi,%ebx
+  802f16:	73 b1                	jae    802ec9 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f18:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f1e:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f21:	39 fe                	cmp    %edi,%esi
+  802f23:	0f 92 c0             	setb   %al
+  802f26:	0f b6 c0             	movzbl %al,%eax
+  802f29:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f2c:	83 c8 07             	or     $0x7,%eax
+  802f2f:	50                   	push   %eax
+  802f30:	89 d8                	mov    %ebx,%eax
+  802f32:	03 05 10 70 80 00    	add    0x807010,%eax
+  802f38:	50                   	push   %eax
+  802f39:	6a 00                	push   $0x0
+  802f3b:	e8 5a de ff ff       	call   800d9a <sys_page_alloc>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	85 c0                	test   %eax,%eax
+  802f45:	0f 88 55 ff ff ff    	js     802ea0 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f4b:	89 f3                	mov    %esi,%ebx
+  802f4d:	eb c5                	jmp    802f14 <malloc+0x1b5>
+
+00802f4f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f4f:	55                   	push   %ebp
+  802f50:	89 e5                	mov    %esp,%ebp
+  802f52:	56                   	push   %esi
+  802f53:	53                   	push   %ebx
+  802f54:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f57:	83 ec 0c             	sub    $0xc,%esp
+  802f5a:	ff 75 08             	push   0x8(%ebp)
+  802f5d:	e8 ea e2 ff ff       	call   80124c <fd2data>
+  802f62:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f64:	83 c4 08             	add    $0x8,%esp
+  802f67:	68 47 4e 80 00       	push   $0x804e47
+  802f6c:	53                   	push   %ebx
+  802f6d:	e8 ea d9 ff ff       	call   80095c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f72:	8b 46 04             	mov    0x4(%esi),%eax
+  802f75:	2b 06                	sub    (%esi),%eax
+  802f77:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f7d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f84:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f87:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  802f8e:	62 80 00 
+	return 0;
+}
+  802f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f99:	5b                   	pop    %ebx
+  802f9a:	5e                   	pop    %esi
+  802f9b:	5d                   	pop    %ebp
+  802f9c:	c3                   	ret
+
+00802f9d <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa2:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802fa6:	85 c9                	test   %ecx,%ecx
+  802fa8:	75 01                	jne    802fab <pipewake+0xe>
+  802faa:	c3                   	ret
+{
+  802fab:	55                   	push   %ebp
+  802fac:	89 e5                	mov    %esp,%ebp
+  802fae:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802fb1:	68 00 04 00 00       	push   $0x400
+  802fb6:	52                   	push   %edx
+  802fb7:	e8 22 e1 ff ff       	call   8010de <sys_futex_wake>
+  802fbc:	83 c4 10             	add    $0x10,%esp
+}
+  802fbf:	c9                   	leave
+  802fc0:	c3                   	ret
+
+00802fc1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fc1:	55                   	push   %ebp
+  802fc2:	89 e5                	mov    %esp,%ebp
+  802fc4:	56                   	push   %esi
+  802fc5:	53                   	push   %ebx
+  802fc6:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fc9:	83 ec 0c             	sub    $0xc,%esp
+  802fcc:	56                   	push   %esi
+  802fcd:	e8 7a e2 ff ff       	call   80124c <fd2data>
+  802fd2:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802fd4:	83 c4 08             	add    $0x8,%esp
+  802fd7:	56                   	push   %esi
+  802fd8:	6a 00                	push   $0x0
+  802fda:	e8 54 de ff ff       	call   800e33 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802fdf:	8d 53 04             	lea    0x4(%ebx),%edx
+  802fe2:	8d 43 08             	lea    0x8(%ebx),%eax
+  802fe5:	e8 b3 ff ff ff       	call   802f9d <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802fea:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802fed:	89 da                	mov    %ebx,%edx
+  802fef:	e8 a9 ff ff ff       	call   802f9d <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802ff4:	89 34 24             	mov    %esi,(%esp)
+  802ff7:	e8 50 e2 ff ff       	call   80124c <fd2data>
+  802ffc:	83 c4 08             	add    $0x8,%esp
+  802fff:	50                   	push   %eax
+  803000:	6a 00                	push   $0x0
+  803002:	e8 2c de ff ff       	call   800e33 <sys_page_unmap>
+}
+  803007:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80300a:	5b                   	pop    %ebx
+  80300b:	5e                   	pop    %esi
+  80300c:	5d                   	pop    %ebp
+  80300d:	c3                   	ret
+
+0080300e <_pipeisclosed>:
+{
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	57                   	push   %edi
+  803012:	56                   	push   %esi
+  803013:	53                   	push   %ebx
+  803014:	83 ec 1c             	sub    $0x1c,%esp
+  803017:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80301a:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80301c:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803021:	eb 5d                	jmp    803080 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803023:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803029:	8b 02                	mov    (%edx),%eax
+  80302b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80302e:	83 ec 0c             	sub    $0xc,%esp
+  803031:	ff 75 e0             	push   -0x20(%ebp)
+  803034:	e8 42 15 00 00       	call   80457b <pageref>
+  803039:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80303c:	89 3c 24             	mov    %edi,(%esp)
+  80303f:	e8 37 15 00 00       	call   80457b <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803044:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803046:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80304c:	83 c4 10             	add    $0x10,%esp
+  80304f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803055:	77 15                	ja     80306c <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803057:	89 f2                	mov    %esi,%edx
+  803059:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80305b:	c1 ea 10             	shr    $0x10,%edx
+  80305e:	74 0c                	je     80306c <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803060:	c1 e2 10             	shl    $0x10,%edx
+  803063:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803068:	29 d1                	sub    %edx,%ecx
+  80306a:	eb 06                	jmp    803072 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80306c:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803072:	8b 11                	mov    (%ecx),%edx
+  803074:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803077:	39 d3                	cmp    %edx,%ebx
+  803079:	74 6e                	je     8030e9 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80307b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80307e:	74 24                	je     8030a4 <_pipeisclosed+0x96>
+  803080:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803082:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803088:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80308d:	77 94                	ja     803023 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80308f:	89 f0                	mov    %esi,%eax
+  803091:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803093:	c1 e8 10             	shr    $0x10,%eax
+  803096:	74 8b                	je     803023 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803098:	c1 e0 10             	shl    $0x10,%eax
+  80309b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8030a0:	29 c2                	sub    %eax,%edx
+  8030a2:	eb 85                	jmp    803029 <_pipeisclosed+0x1b>
+  8030a4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8030a6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8030ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030b1:	77 18                	ja     8030cb <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030b3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8030b8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8030ba:	c1 e8 10             	shr    $0x10,%eax
+  8030bd:	74 0c                	je     8030cb <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8030bf:	c1 e0 10             	shl    $0x10,%eax
+  8030c2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8030c7:	29 c2                	sub    %eax,%edx
+  8030c9:	eb 06                	jmp    8030d1 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8030cb:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030d1:	8b 02                	mov    (%edx),%eax
+  8030d3:	8b 40 58             	mov    0x58(%eax),%eax
+  8030d6:	6a 01                	push   $0x1
+  8030d8:	50                   	push   %eax
+  8030d9:	53                   	push   %ebx
+  8030da:	68 4e 4e 80 00       	push   $0x804e4e
+  8030df:	e8 94 d2 ff ff       	call   800378 <cprintf>
+  8030e4:	83 c4 10             	add    $0x10,%esp
+  8030e7:	eb 97                	jmp    803080 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8030e9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030ec:	0f 94 c0             	sete   %al
+  8030ef:	0f b6 c0             	movzbl %al,%eax
+}
+  8030f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f5:	5b                   	pop    %ebx
+  8030f6:	5e                   	pop    %esi
+  8030f7:	5f                   	pop    %edi
+  8030f8:	5d                   	pop    %ebp
+  8030f9:	c3                   	ret
+
+008030fa <devpipe_write>:
+{
+  8030fa:	55                   	push   %ebp
+  8030fb:	89 e5                	mov    %esp,%ebp
+  8030fd:	57                   	push   %edi
+  8030fe:	56                   	push   %esi
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803103:	ff 75 08             	push   0x8(%ebp)
+  803106:	e8 41 e1 ff ff       	call   80124c <fd2data>
+  80310b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80310d:	83 c4 10             	add    $0x10,%esp
+  803110:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803117:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80311a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80311d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803120:	0f 84 96 00 00 00    	je     8031bc <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803126:	8d 73 08             	lea    0x8(%ebx),%esi
+  803129:	eb 32                	jmp    80315d <devpipe_write+0x63>
+  80312b:	89 fa                	mov    %edi,%edx
+  80312d:	89 f0                	mov    %esi,%eax
+  80312f:	e8 69 fe ff ff       	call   802f9d <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803134:	8b 43 04             	mov    0x4(%ebx),%eax
+  803137:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80313a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80313f:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803144:	83 ec 04             	sub    $0x4,%esp
+  803147:	6a 0a                	push   $0xa
+  803149:	50                   	push   %eax
+  80314a:	53                   	push   %ebx
+  80314b:	e8 5f df ff ff       	call   8010af <sys_futex_wait>
+  803150:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803155:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80315a:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80315d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803160:	8b 0b                	mov    (%ebx),%ecx
+  803162:	8d 51 20             	lea    0x20(%ecx),%edx
+  803165:	39 d0                	cmp    %edx,%eax
+  803167:	72 1b                	jb     803184 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803169:	89 da                	mov    %ebx,%edx
+  80316b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80316e:	e8 9b fe ff ff       	call   80300e <_pipeisclosed>
+  803173:	85 c0                	test   %eax,%eax
+  803175:	74 b4                	je     80312b <devpipe_write+0x31>
+				return 0;
+  803177:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80317c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80317f:	5b                   	pop    %ebx
+  803180:	5e                   	pop    %esi
+  803181:	5f                   	pop    %edi
+  803182:	5d                   	pop    %ebp
+  803183:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803187:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80318a:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80318e:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803191:	89 c2                	mov    %eax,%edx
+  803193:	c1 fa 1f             	sar    $0x1f,%edx
+  803196:	89 d1                	mov    %edx,%ecx
+  803198:	c1 e9 1b             	shr    $0x1b,%ecx
+  80319b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80319e:	83 e2 1f             	and    $0x1f,%edx
+  8031a1:	29 ca                	sub    %ecx,%edx
+  8031a3:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8031a7:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8031ab:	83 c0 01             	add    $0x1,%eax
+  8031ae:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031b1:	83 c6 01             	add    $0x1,%esi
+  8031b4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8031b7:	e9 5e ff ff ff       	jmp    80311a <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8031bc:	8d 53 04             	lea    0x4(%ebx),%edx
+  8031bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8031c2:	e8 d6 fd ff ff       	call   802f9d <pipewake>
+	return i;
+  8031c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031ca:	eb b0                	jmp    80317c <devpipe_write+0x82>
+
+008031cc <devpipe_read>:
+{
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	57                   	push   %edi
+  8031d0:	56                   	push   %esi
+  8031d1:	53                   	push   %ebx
+  8031d2:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8031d5:	ff 75 08             	push   0x8(%ebp)
+  8031d8:	e8 6f e0 ff ff       	call   80124c <fd2data>
+  8031dd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031ea:	74 6c                	je     803258 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8031ec:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8031ef:	eb 25                	jmp    803216 <devpipe_read+0x4a>
+  8031f1:	8b 13                	mov    (%ebx),%edx
+  8031f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031f8:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8031fd:	83 ec 04             	sub    $0x4,%esp
+  803200:	6a 0a                	push   $0xa
+  803202:	52                   	push   %edx
+  803203:	57                   	push   %edi
+  803204:	e8 a6 de ff ff       	call   8010af <sys_futex_wait>
+  803209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80320e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803213:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803216:	8b 03                	mov    (%ebx),%eax
+  803218:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80321b:	75 19                	jne    803236 <devpipe_read+0x6a>
+			if (i > 0)
+  80321d:	85 f6                	test   %esi,%esi
+  80321f:	75 3a                	jne    80325b <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803221:	89 da                	mov    %ebx,%edx
+  803223:	8b 45 08             	mov    0x8(%ebp),%eax
+  803226:	e8 e3 fd ff ff       	call   80300e <_pipeisclosed>
+  80322b:	85 c0                	test   %eax,%eax
+  80322d:	74 c2                	je     8031f1 <devpipe_read+0x25>
+				return 0;
+  80322f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803234:	eb 31                	jmp    803267 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803236:	89 c1                	mov    %eax,%ecx
+  803238:	c1 f9 1f             	sar    $0x1f,%ecx
+  80323b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80323e:	01 c8                	add    %ecx,%eax
+  803240:	83 e0 1f             	and    $0x1f,%eax
+  803243:	29 c8                	sub    %ecx,%eax
+  803245:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80324a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80324d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803250:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803253:	83 c6 01             	add    $0x1,%esi
+  803256:	eb 8f                	jmp    8031e7 <devpipe_read+0x1b>
+out:
+  803258:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80325b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80325e:	89 da                	mov    %ebx,%edx
+  803260:	e8 38 fd ff ff       	call   802f9d <pipewake>
+	return i;
+  803265:	89 f0                	mov    %esi,%eax
+}
+  803267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80326a:	5b                   	pop    %ebx
+  80326b:	5e                   	pop    %esi
+  80326c:	5f                   	pop    %edi
+  80326d:	5d                   	pop    %ebp
+  80326e:	c3                   	ret
+
+0080326f <pipe>:
+{
+  80326f:	55                   	push   %ebp
+  803270:	89 e5                	mov    %esp,%ebp
+  803272:	56                   	push   %esi
+  803273:	53                   	push   %ebx
+  803274:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803277:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80327a:	50                   	push   %eax
+  80327b:	e8 e3 df ff ff       	call   801263 <fd_alloc>
+  803280:	89 c3                	mov    %eax,%ebx
+  803282:	83 c4 10             	add    $0x10,%esp
+  803285:	85 c0                	test   %eax,%eax
+  803287:	0f 88 23 01 00 00    	js     8033b0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80328d:	83 ec 04             	sub    $0x4,%esp
+  803290:	68 07 04 00 00       	push   $0x407
+  803295:	ff 75 f4             	push   -0xc(%ebp)
+  803298:	6a 00                	push   $0x0
+  80329a:	e8 fb da ff ff       	call   800d9a <sys_page_alloc>
+  80329f:	89 c3                	mov    %eax,%ebx
+  8032a1:	83 c4 10             	add    $0x10,%esp
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	0f 88 04 01 00 00    	js     8033b0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032ac:	83 ec 0c             	sub    $0xc,%esp
+  8032af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032b2:	50                   	push   %eax
+  8032b3:	e8 ab df ff ff       	call   801263 <fd_alloc>
+  8032b8:	89 c3                	mov    %eax,%ebx
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	0f 88 db 00 00 00    	js     8033a0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032c5:	83 ec 04             	sub    $0x4,%esp
+  8032c8:	68 07 04 00 00       	push   $0x407
+  8032cd:	ff 75 f0             	push   -0x10(%ebp)
+  8032d0:	6a 00                	push   $0x0
+  8032d2:	e8 c3 da ff ff       	call   800d9a <sys_page_alloc>
+  8032d7:	89 c3                	mov    %eax,%ebx
+  8032d9:	83 c4 10             	add    $0x10,%esp
+  8032dc:	85 c0                	test   %eax,%eax
+  8032de:	0f 88 bc 00 00 00    	js     8033a0 <pipe+0x131>
+	va = fd2data(fd0);
+  8032e4:	83 ec 0c             	sub    $0xc,%esp
+  8032e7:	ff 75 f4             	push   -0xc(%ebp)
+  8032ea:	e8 5d df ff ff       	call   80124c <fd2data>
+  8032ef:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032f1:	83 c4 0c             	add    $0xc,%esp
+  8032f4:	68 07 04 00 00       	push   $0x407
+  8032f9:	50                   	push   %eax
+  8032fa:	6a 00                	push   $0x0
+  8032fc:	e8 99 da ff ff       	call   800d9a <sys_page_alloc>
+  803301:	89 c3                	mov    %eax,%ebx
+  803303:	83 c4 10             	add    $0x10,%esp
+  803306:	85 c0                	test   %eax,%eax
+  803308:	0f 88 82 00 00 00    	js     803390 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80330e:	83 ec 0c             	sub    $0xc,%esp
+  803311:	ff 75 f0             	push   -0x10(%ebp)
+  803314:	e8 33 df ff ff       	call   80124c <fd2data>
+  803319:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803320:	50                   	push   %eax
+  803321:	6a 00                	push   $0x0
+  803323:	56                   	push   %esi
+  803324:	6a 00                	push   $0x0
+  803326:	e8 bc da ff ff       	call   800de7 <sys_page_map>
+  80332b:	89 c3                	mov    %eax,%ebx
+  80332d:	83 c4 20             	add    $0x20,%esp
+  803330:	85 c0                	test   %eax,%eax
+  803332:	78 4e                	js     803382 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803334:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803339:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80333c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80333e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803341:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803348:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80334b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80334d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803350:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803357:	83 ec 0c             	sub    $0xc,%esp
+  80335a:	ff 75 f4             	push   -0xc(%ebp)
+  80335d:	e8 da de ff ff       	call   80123c <fd2num>
+  803362:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803365:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803367:	83 c4 04             	add    $0x4,%esp
+  80336a:	ff 75 f0             	push   -0x10(%ebp)
+  80336d:	e8 ca de ff ff       	call   80123c <fd2num>
+  803372:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803375:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803378:	83 c4 10             	add    $0x10,%esp
+  80337b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803380:	eb 2e                	jmp    8033b0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803382:	83 ec 08             	sub    $0x8,%esp
+  803385:	56                   	push   %esi
+  803386:	6a 00                	push   $0x0
+  803388:	e8 a6 da ff ff       	call   800e33 <sys_page_unmap>
+  80338d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803390:	83 ec 08             	sub    $0x8,%esp
+  803393:	ff 75 f0             	push   -0x10(%ebp)
+  803396:	6a 00                	push   $0x0
+  803398:	e8 96 da ff ff       	call   800e33 <sys_page_unmap>
+  80339d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033a0:	83 ec 08             	sub    $0x8,%esp
+  8033a3:	ff 75 f4             	push   -0xc(%ebp)
+  8033a6:	6a 00                	push   $0x0
+  8033a8:	e8 86 da ff ff       	call   800e33 <sys_page_unmap>
+  8033ad:	83 c4 10             	add    $0x10,%esp
+}
+  8033b0:	89 d8                	mov    %ebx,%eax
+  8033b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033b5:	5b                   	pop    %ebx
+  8033b6:	5e                   	pop    %esi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <pipeisclosed>:
+{
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033c2:	50                   	push   %eax
+  8033c3:	ff 75 08             	push   0x8(%ebp)
+  8033c6:	e8 ee de ff ff       	call   8012b9 <fd_lookup>
+  8033cb:	83 c4 10             	add    $0x10,%esp
+  8033ce:	85 c0                	test   %eax,%eax
+  8033d0:	78 18                	js     8033ea <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033d2:	83 ec 0c             	sub    $0xc,%esp
+  8033d5:	ff 75 f4             	push   -0xc(%ebp)
+  8033d8:	e8 6f de ff ff       	call   80124c <fd2data>
+  8033dd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e2:	e8 27 fc ff ff       	call   80300e <_pipeisclosed>
+  8033e7:	83 c4 10             	add    $0x10,%esp
+}
+  8033ea:	c9                   	leave
+  8033eb:	c3                   	ret
+
+008033ec <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8033ec:	55                   	push   %ebp
+  8033ed:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8033ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8033f8:	5d                   	pop    %ebp
+  8033f9:	c3                   	ret
+
+008033fa <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8033fa:	55                   	push   %ebp
+  8033fb:	89 e5                	mov    %esp,%ebp
+  8033fd:	56                   	push   %esi
+  8033fe:	53                   	push   %ebx
+  8033ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803402:	ba 00 00 00 00       	mov    $0x0,%edx
+  803407:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80340c:	89 d0                	mov    %edx,%eax
+  80340e:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803412:	85 c0                	test   %eax,%eax
+  803414:	74 2d                	je     803443 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803416:	83 f8 02             	cmp    $0x2,%eax
+  803419:	74 08                	je     803423 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80341b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803420:	f0 87 03             	lock xchg %eax,(%ebx)
+  803423:	be 02 00 00 00       	mov    $0x2,%esi
+  803428:	eb 15                	jmp    80343f <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80342a:	83 ec 04             	sub    $0x4,%esp
+  80342d:	6a 00                	push   $0x0
+  80342f:	6a 02                	push   $0x2
+  803431:	53                   	push   %ebx
+  803432:	e8 78 dc ff ff       	call   8010af <sys_futex_wait>
+  803437:	89 f0                	mov    %esi,%eax
+  803439:	f0 87 03             	lock xchg %eax,(%ebx)
+  80343c:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	75 e7                	jne    80342a <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803446:	5b                   	pop    %ebx
+  803447:	5e                   	pop    %esi
+  803448:	5d                   	pop    %ebp
+  803449:	c3                   	ret
+
+0080344a <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80344a:	55                   	push   %ebp
+  80344b:	89 e5                	mov    %esp,%ebp
+  80344d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+  803455:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80345a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80345e:	f7 d8                	neg    %eax
+  803460:	19 c0                	sbb    %eax,%eax
+  803462:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803465:	5d                   	pop    %ebp
+  803466:	c3                   	ret
+
+00803467 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803467:	55                   	push   %ebp
+  803468:	89 e5                	mov    %esp,%ebp
+  80346a:	83 ec 08             	sub    $0x8,%esp
+  80346d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803470:	b8 00 00 00 00       	mov    $0x0,%eax
+  803475:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803478:	83 f8 02             	cmp    $0x2,%eax
+  80347b:	74 02                	je     80347f <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80347d:	c9                   	leave
+  80347e:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80347f:	83 ec 08             	sub    $0x8,%esp
+  803482:	6a 01                	push   $0x1
+  803484:	52                   	push   %edx
+  803485:	e8 54 dc ff ff       	call   8010de <sys_futex_wake>
+  80348a:	83 c4 10             	add    $0x10,%esp
+}
+  80348d:	eb ee                	jmp    80347d <mutex_unlock+0x16>
+
+0080348f <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80348f:	55                   	push   %ebp
+  803490:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803492:	8b 45 08             	mov    0x8(%ebp),%eax
+  803495:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80349b:	5d                   	pop    %ebp
+  80349c:	c3                   	ret
+
+0080349d <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	57                   	push   %edi
+  8034a1:	56                   	push   %esi
+  8034a2:	53                   	push   %ebx
+  8034a3:	83 ec 18             	sub    $0x18,%esp
+  8034a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8034ac:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8034ae:	53                   	push   %ebx
+  8034af:	e8 b3 ff ff ff       	call   803467 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8034b4:	83 c4 0c             	add    $0xc,%esp
+  8034b7:	ff 75 10             	push   0x10(%ebp)
+  8034ba:	57                   	push   %edi
+  8034bb:	56                   	push   %esi
+  8034bc:	e8 ee db ff ff       	call   8010af <sys_futex_wait>
+  8034c1:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8034c3:	83 c4 10             	add    $0x10,%esp
+  8034c6:	be 02 00 00 00       	mov    $0x2,%esi
+  8034cb:	eb 10                	jmp    8034dd <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8034cd:	83 ec 04             	sub    $0x4,%esp
+  8034d0:	6a 00                	push   $0x0
+  8034d2:	6a 02                	push   $0x2
+  8034d4:	53                   	push   %ebx
+  8034d5:	e8 d5 db ff ff       	call   8010af <sys_futex_wait>
+  8034da:	83 c4 10             	add    $0x10,%esp
+  8034dd:	89 f0                	mov    %esi,%eax
+  8034df:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	75 e7                	jne    8034cd <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8034e6:	83 ff ec             	cmp    $0xffffffec,%edi
+  8034e9:	74 05                	je     8034f0 <cond_timedwait+0x53>
+  8034eb:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8034f0:	89 f8                	mov    %edi,%eax
+  8034f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f5:	5b                   	pop    %ebx
+  8034f6:	5e                   	pop    %esi
+  8034f7:	5f                   	pop    %edi
+  8034f8:	5d                   	pop    %ebp
+  8034f9:	c3                   	ret
+
+008034fa <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8034fa:	55                   	push   %ebp
+  8034fb:	89 e5                	mov    %esp,%ebp
+  8034fd:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803500:	6a 00                	push   $0x0
+  803502:	ff 75 0c             	push   0xc(%ebp)
+  803505:	ff 75 08             	push   0x8(%ebp)
+  803508:	e8 90 ff ff ff       	call   80349d <cond_timedwait>
+}
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	c9                   	leave
+  803511:	c3                   	ret
+
+00803512 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803512:	55                   	push   %ebp
+  803513:	89 e5                	mov    %esp,%ebp
+  803515:	83 ec 10             	sub    $0x10,%esp
+  803518:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80351b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803520:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803524:	6a 01                	push   $0x1
+  803526:	50                   	push   %eax
+  803527:	e8 b2 db ff ff       	call   8010de <sys_futex_wake>
+}
+  80352c:	83 c4 10             	add    $0x10,%esp
+  80352f:	c9                   	leave
+  803530:	c3                   	ret
+
+00803531 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803531:	55                   	push   %ebp
+  803532:	89 e5                	mov    %esp,%ebp
+  803534:	83 ec 10             	sub    $0x10,%esp
+  803537:	8b 45 08             	mov    0x8(%ebp),%eax
+  80353a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80353f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803543:	68 00 04 00 00       	push   $0x400
+  803548:	50                   	push   %eax
+  803549:	e8 90 db ff ff       	call   8010de <sys_futex_wake>
+}
+  80354e:	83 c4 10             	add    $0x10,%esp
+  803551:	c9                   	leave
+  803552:	c3                   	ret
+
+00803553 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803553:	55                   	push   %ebp
+  803554:	89 e5                	mov    %esp,%ebp
+  803556:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803559:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80355c:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80355e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803565:	5d                   	pop    %ebp
+  803566:	c3                   	ret
+
+00803567 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803567:	55                   	push   %ebp
+  803568:	89 e5                	mov    %esp,%ebp
+  80356a:	53                   	push   %ebx
+  80356b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80356e:	8b 11                	mov    (%ecx),%edx
+  803570:	85 d2                	test   %edx,%edx
+  803572:	74 14                	je     803588 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803574:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803577:	89 d0                	mov    %edx,%eax
+  803579:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80357d:	39 c2                	cmp    %eax,%edx
+  80357f:	75 ed                	jne    80356e <sem_trywait+0x7>
+			return 0;
+  803581:	b8 00 00 00 00       	mov    $0x0,%eax
+  803586:	eb 05                	jmp    80358d <sem_trywait+0x26>
+	return -E_AGAIN;
+  803588:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80358d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803590:	c9                   	leave
+  803591:	c3                   	ret
+
+00803592 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803592:	55                   	push   %ebp
+  803593:	89 e5                	mov    %esp,%ebp
+  803595:	57                   	push   %edi
+  803596:	56                   	push   %esi
+  803597:	53                   	push   %ebx
+  803598:	83 ec 1c             	sub    $0x1c,%esp
+  80359b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80359e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8035a1:	e8 81 da ff ff       	call   801027 <sys_time_msec>
+  8035a6:	01 f8                	add    %edi,%eax
+  8035a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8035ab:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8035b0:	eb 28                	jmp    8035da <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8035b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035b7:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8035bc:	83 ec 04             	sub    $0x4,%esp
+  8035bf:	56                   	push   %esi
+  8035c0:	6a 00                	push   $0x0
+  8035c2:	53                   	push   %ebx
+  8035c3:	e8 e7 da ff ff       	call   8010af <sys_futex_wait>
+  8035c8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8035cd:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8035d2:	83 c4 10             	add    $0x10,%esp
+  8035d5:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8035d8:	74 2e                	je     803608 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8035da:	83 ec 0c             	sub    $0xc,%esp
+  8035dd:	53                   	push   %ebx
+  8035de:	e8 84 ff ff ff       	call   803567 <sem_trywait>
+  8035e3:	83 c4 10             	add    $0x10,%esp
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	79 19                	jns    803603 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8035ea:	85 ff                	test   %edi,%edi
+  8035ec:	74 c4                	je     8035b2 <sem_timedwait+0x20>
+  8035ee:	e8 34 da ff ff       	call   801027 <sys_time_msec>
+  8035f3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8035f6:	29 c6                	sub    %eax,%esi
+  8035f8:	85 f6                	test   %esi,%esi
+  8035fa:	7f b6                	jg     8035b2 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8035fc:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803601:	eb 05                	jmp    803608 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80360b:	5b                   	pop    %ebx
+  80360c:	5e                   	pop    %esi
+  80360d:	5f                   	pop    %edi
+  80360e:	5d                   	pop    %ebp
+  80360f:	c3                   	ret
+
+00803610 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803610:	55                   	push   %ebp
+  803611:	89 e5                	mov    %esp,%ebp
+  803613:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803616:	6a 00                	push   $0x0
+  803618:	ff 75 08             	push   0x8(%ebp)
+  80361b:	e8 72 ff ff ff       	call   803592 <sem_timedwait>
+}
+  803620:	83 c4 10             	add    $0x10,%esp
+  803623:	c9                   	leave
+  803624:	c3                   	ret
+
+00803625 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803625:	55                   	push   %ebp
+  803626:	89 e5                	mov    %esp,%ebp
+  803628:	83 ec 08             	sub    $0x8,%esp
+  80362b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80362e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803633:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803637:	8b 50 04             	mov    0x4(%eax),%edx
+  80363a:	85 d2                	test   %edx,%edx
+  80363c:	75 02                	jne    803640 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80363e:	c9                   	leave
+  80363f:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803640:	83 ec 08             	sub    $0x8,%esp
+  803643:	6a 01                	push   $0x1
+  803645:	50                   	push   %eax
+  803646:	e8 93 da ff ff       	call   8010de <sys_futex_wake>
+  80364b:	83 c4 10             	add    $0x10,%esp
+}
+  80364e:	eb ee                	jmp    80363e <sem_post+0x19>
+
+00803650 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803650:	55                   	push   %ebp
+  803651:	89 e5                	mov    %esp,%ebp
+  803653:	57                   	push   %edi
+  803654:	56                   	push   %esi
+  803655:	53                   	push   %ebx
+  803656:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803659:	68 20 70 80 00       	push   $0x807020
+  80365e:	e8 97 fd ff ff       	call   8033fa <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803663:	a1 44 70 80 00       	mov    0x807044,%eax
+  803668:	83 c4 10             	add    $0x10,%esp
+  80366b:	85 c0                	test   %eax,%eax
+  80366d:	75 19                	jne    803688 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80366f:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803674:	8b 00                	mov    (%eax),%eax
+  803676:	8b 40 48             	mov    0x48(%eax),%eax
+  803679:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  80367e:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803685:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803688:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80368d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803690:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803697:	8b 40 04             	mov    0x4(%eax),%eax
+  80369a:	85 c0                	test   %eax,%eax
+  80369c:	0f 84 e4 00 00 00    	je     803786 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8036a2:	83 c3 01             	add    $0x1,%ebx
+  8036a5:	83 fb 20             	cmp    $0x20,%ebx
+  8036a8:	75 e3                	jne    80368d <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8036aa:	83 ec 0c             	sub    $0xc,%esp
+  8036ad:	68 20 70 80 00       	push   $0x807020
+  8036b2:	e8 b0 fd ff ff       	call   803467 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8036b7:	83 c4 10             	add    $0x10,%esp
+  8036ba:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8036bf:	e9 b8 00 00 00       	jmp    80377c <pthread_create+0x12c>
+  8036c4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8036c7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8036ca:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8036cc:	39 f3                	cmp    %esi,%ebx
+  8036ce:	73 16                	jae    8036e6 <pthread_create+0x96>
+		va -= PGSIZE;
+  8036d0:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8036d6:	83 ec 08             	sub    $0x8,%esp
+  8036d9:	56                   	push   %esi
+  8036da:	6a 00                	push   $0x0
+  8036dc:	e8 52 d7 ff ff       	call   800e33 <sys_page_unmap>
+  8036e1:	83 c4 10             	add    $0x10,%esp
+  8036e4:	eb e6                	jmp    8036cc <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8036e6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8036e9:	83 ec 08             	sub    $0x8,%esp
+  8036ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8036ef:	6a 00                	push   $0x0
+  8036f1:	e8 3d d7 ff ff       	call   800e33 <sys_page_unmap>
+	return r;
+  8036f6:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8036f9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036fc:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803703:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80370a:	eb 70                	jmp    80377c <pthread_create+0x12c>
+	th->th_fn = fn;
+  80370c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80370f:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803719:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80371c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80371f:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803722:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803729:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80372e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803731:	29 c8                	sub    %ecx,%eax
+  803733:	85 db                	test   %ebx,%ebx
+  803735:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  80373c:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80373f:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803746:	83 ec 04             	sub    $0x4,%esp
+  803749:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80374e:	29 ca                	sub    %ecx,%edx
+  803750:	52                   	push   %edx
+	*--esp = 0;
+  803751:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803754:	50                   	push   %eax
+  803755:	68 ad 39 80 00       	push   $0x8039ad
+  80375a:	e8 24 da ff ff       	call   801183 <sys_thread_create>
+  80375f:	89 c7                	mov    %eax,%edi
+  803761:	83 c4 10             	add    $0x10,%esp
+  803764:	85 c0                	test   %eax,%eax
+  803766:	78 91                	js     8036f9 <pthread_create+0xa9>
+	th->th_env = id;
+  803768:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80376b:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803772:	8b 45 08             	mov    0x8(%ebp),%eax
+  803775:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803777:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80377c:	89 f8                	mov    %edi,%eax
+  80377e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803781:	5b                   	pop    %ebx
+  803782:	5e                   	pop    %esi
+  803783:	5f                   	pop    %edi
+  803784:	5d                   	pop    %ebp
+  803785:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803786:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803789:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803790:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803797:	83 ec 0c             	sub    $0xc,%esp
+  80379a:	68 20 70 80 00       	push   $0x807020
+  80379f:	e8 c3 fc ff ff       	call   803467 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8037a4:	89 d9                	mov    %ebx,%ecx
+  8037a6:	c1 e1 10             	shl    $0x10,%ecx
+  8037a9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8037ac:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8037b1:	29 c8                	sub    %ecx,%eax
+  8037b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8037b6:	c1 e8 16             	shr    $0x16,%eax
+  8037b9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8037c0:	83 c4 10             	add    $0x10,%esp
+  8037c3:	a8 01                	test   $0x1,%al
+  8037c5:	74 15                	je     8037dc <pthread_create+0x18c>
+  8037c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037ca:	c1 e8 0c             	shr    $0xc,%eax
+  8037cd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037d4:	a8 01                	test   $0x1,%al
+  8037d6:	0f 85 30 ff ff ff    	jne    80370c <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8037dc:	83 ec 04             	sub    $0x4,%esp
+  8037df:	6a 07                	push   $0x7
+  8037e1:	ff 75 e4             	push   -0x1c(%ebp)
+  8037e4:	6a 00                	push   $0x0
+  8037e6:	e8 af d5 ff ff       	call   800d9a <sys_page_alloc>
+  8037eb:	89 c7                	mov    %eax,%edi
+  8037ed:	83 c4 10             	add    $0x10,%esp
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	0f 88 01 ff ff ff    	js     8036f9 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8037f8:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8037fd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803800:	29 d0                	sub    %edx,%eax
+  803802:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803805:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803807:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80380c:	29 d0                	sub    %edx,%eax
+  80380e:	89 c7                	mov    %eax,%edi
+  803810:	39 fe                	cmp    %edi,%esi
+  803812:	0f 83 f4 fe ff ff    	jae    80370c <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803818:	83 ec 04             	sub    $0x4,%esp
+  80381b:	6a 07                	push   $0x7
+  80381d:	56                   	push   %esi
+  80381e:	6a 00                	push   $0x0
+  803820:	e8 75 d5 ff ff       	call   800d9a <sys_page_alloc>
+  803825:	83 c4 10             	add    $0x10,%esp
+  803828:	85 c0                	test   %eax,%eax
+  80382a:	0f 88 94 fe ff ff    	js     8036c4 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803830:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803836:	eb d8                	jmp    803810 <pthread_create+0x1c0>
+
+00803838 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803838:	55                   	push   %ebp
+  803839:	89 e5                	mov    %esp,%ebp
+  80383b:	57                   	push   %edi
+  80383c:	56                   	push   %esi
+  80383d:	53                   	push   %ebx
+  80383e:	83 ec 0c             	sub    $0xc,%esp
+  803841:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803844:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803847:	83 f8 1e             	cmp    $0x1e,%eax
+  80384a:	0f 87 c7 00 00 00    	ja     803917 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803850:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803852:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803858:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80385d:	77 12                	ja     803871 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80385f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803864:	29 d0                	sub    %edx,%eax
+  803866:	c1 e8 10             	shr    $0x10,%eax
+  803869:	39 c3                	cmp    %eax,%ebx
+  80386b:	0f 84 ad 00 00 00    	je     80391e <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803871:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803874:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80387b:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803882:	eb 10                	jmp    803894 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803884:	83 ec 04             	sub    $0x4,%esp
+  803887:	6a 00                	push   $0x0
+  803889:	6a 01                	push   $0x1
+  80388b:	57                   	push   %edi
+  80388c:	e8 1e d8 ff ff       	call   8010af <sys_futex_wait>
+  803891:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803894:	8b 46 04             	mov    0x4(%esi),%eax
+  803897:	83 f8 01             	cmp    $0x1,%eax
+  80389a:	74 e8                	je     803884 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80389c:	83 f8 02             	cmp    $0x2,%eax
+  80389f:	0f 85 80 00 00 00    	jne    803925 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038a5:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8038a8:	c1 e6 02             	shl    $0x2,%esi
+  8038ab:	eb 05                	jmp    8038b2 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8038ad:	e8 bc d4 ff ff       	call   800d6e <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038b2:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8038b8:	89 ca                	mov    %ecx,%edx
+  8038ba:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8038c0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8038c3:	c1 e0 04             	shl    $0x4,%eax
+  8038c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038cb:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8038ce:	39 c1                	cmp    %eax,%ecx
+  8038d0:	75 12                	jne    8038e4 <pthread_join+0xac>
+  8038d2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8038d5:	c1 e0 04             	shl    $0x4,%eax
+  8038d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038dd:	8b 40 54             	mov    0x54(%eax),%eax
+  8038e0:	85 c0                	test   %eax,%eax
+  8038e2:	75 c9                	jne    8038ad <pthread_join+0x75>
+	if (ret_store)
+  8038e4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8038e8:	74 0f                	je     8038f9 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8038ea:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038ed:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  8038f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8038f7:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8038f9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038fc:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803903:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80390a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80390f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803912:	5b                   	pop    %ebx
+  803913:	5e                   	pop    %esi
+  803914:	5f                   	pop    %edi
+  803915:	5d                   	pop    %ebp
+  803916:	c3                   	ret
+		return -E_INVAL;
+  803917:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80391c:	eb f1                	jmp    80390f <pthread_join+0xd7>
+  80391e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803923:	eb ea                	jmp    80390f <pthread_join+0xd7>
+		return -E_INVAL;
+  803925:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80392a:	eb e3                	jmp    80390f <pthread_join+0xd7>
+
+0080392c <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80392c:	55                   	push   %ebp
+  80392d:	89 e5                	mov    %esp,%ebp
+  80392f:	53                   	push   %ebx
+  803930:	83 ec 04             	sub    $0x4,%esp
+  803933:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803935:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80393b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803940:	77 0c                	ja     80394e <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803942:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803947:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803949:	c1 e8 10             	shr    $0x10,%eax
+  80394c:	75 0a                	jne    803958 <pthread_exit+0x2c>
+		exit();
+  80394e:	e8 22 c9 ff ff       	call   800275 <exit>
+  803953:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803958:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80395f:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803962:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803969:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80396c:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80396f:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803976:	83 ec 08             	sub    $0x8,%esp
+  803979:	6a 20                	push   $0x20
+  80397b:	01 c2                	add    %eax,%edx
+  80397d:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803984:	50                   	push   %eax
+  803985:	e8 54 d7 ff ff       	call   8010de <sys_futex_wake>
+	sys_env_destroy(0);
+  80398a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803991:	e8 61 d3 ff ff       	call   800cf7 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803996:	83 c4 0c             	add    $0xc,%esp
+  803999:	68 66 4e 80 00       	push   $0x804e66
+  80399e:	68 a5 00 00 00       	push   $0xa5
+  8039a3:	68 80 4e 80 00       	push   $0x804e80
+  8039a8:	e8 f0 c8 ff ff       	call   80029d <_panic>
+
+008039ad <pthread_start>:
+{
+  8039ad:	55                   	push   %ebp
+  8039ae:	89 e5                	mov    %esp,%ebp
+  8039b0:	53                   	push   %ebx
+  8039b1:	83 ec 04             	sub    $0x4,%esp
+  8039b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8039b7:	e8 86 d3 ff ff       	call   800d42 <sys_getenvid>
+  8039bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8039c1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8039c7:	85 db                	test   %ebx,%ebx
+  8039c9:	74 0c                	je     8039d7 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039cb:	89 d9                	mov    %ebx,%ecx
+  8039cd:	c1 e1 10             	shl    $0x10,%ecx
+  8039d0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039d5:	29 ca                	sub    %ecx,%edx
+  8039d7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8039da:	c1 e0 04             	shl    $0x4,%eax
+  8039dd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039e2:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8039e4:	83 ec 0c             	sub    $0xc,%esp
+  8039e7:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8039ee:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8039f1:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  8039f8:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  8039ff:	89 04 24             	mov    %eax,(%esp)
+  803a02:	e8 25 ff ff ff       	call   80392c <pthread_exit>
+
+00803a07 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803a07:	55                   	push   %ebp
+  803a08:	89 e5                	mov    %esp,%ebp
+  803a0a:	57                   	push   %edi
+  803a0b:	56                   	push   %esi
+  803a0c:	53                   	push   %ebx
+  803a0d:	83 ec 1c             	sub    $0x1c,%esp
+  803a10:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a12:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803a18:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a1f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a24:	77 0d                	ja     803a33 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a26:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a2b:	29 d0                	sub    %edx,%eax
+  803a2d:	c1 e8 10             	shr    $0x10,%eax
+  803a30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a38:	eb 2f                	jmp    803a69 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803a3a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a40:	8b 01                	mov    (%ecx),%eax
+  803a42:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803a45:	39 c2                	cmp    %eax,%edx
+  803a47:	75 14                	jne    803a5d <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803a49:	83 ec 0c             	sub    $0xc,%esp
+  803a4c:	57                   	push   %edi
+  803a4d:	e8 a5 d2 ff ff       	call   800cf7 <sys_env_destroy>
+  803a52:	83 c4 10             	add    $0x10,%esp
+  803a55:	85 c0                	test   %eax,%eax
+  803a57:	0f 88 97 00 00 00    	js     803af4 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a5d:	83 c3 01             	add    $0x1,%ebx
+  803a60:	83 fb 20             	cmp    $0x20,%ebx
+  803a63:	0f 84 d2 00 00 00    	je     803b3b <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803a69:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803a6c:	74 ef                	je     803a5d <pthread_kill_others+0x56>
+  803a6e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a71:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a78:	8b 40 04             	mov    0x4(%eax),%eax
+  803a7b:	83 f8 01             	cmp    $0x1,%eax
+  803a7e:	75 dd                	jne    803a5d <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803a80:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a83:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803a8a:	89 fe                	mov    %edi,%esi
+  803a8c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a92:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a95:	c1 e0 04             	shl    $0x4,%eax
+  803a98:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a9d:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803aa0:	39 c7                	cmp    %eax,%edi
+  803aa2:	75 b9                	jne    803a5d <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803aa4:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803aa7:	c1 e0 04             	shl    $0x4,%eax
+  803aaa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803aaf:	8b 40 54             	mov    0x54(%eax),%eax
+  803ab2:	85 c0                	test   %eax,%eax
+  803ab4:	74 a7                	je     803a5d <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803ab6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ab9:	c1 e0 04             	shl    $0x4,%eax
+  803abc:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803ac2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ac4:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803aca:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803acf:	0f 87 65 ff ff ff    	ja     803a3a <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ad5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ada:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803adc:	c1 e8 10             	shr    $0x10,%eax
+  803adf:	0f 84 55 ff ff ff    	je     803a3a <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ae5:	c1 e0 10             	shl    $0x10,%eax
+  803ae8:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803aed:	29 c1                	sub    %eax,%ecx
+  803aef:	e9 4c ff ff ff       	jmp    803a40 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803af4:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803af7:	c1 e2 04             	shl    $0x4,%edx
+  803afa:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b00:	8b 52 48             	mov    0x48(%edx),%edx
+  803b03:	39 fa                	cmp    %edi,%edx
+  803b05:	0f 85 52 ff ff ff    	jne    803a5d <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803b0b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803b0e:	c1 e2 04             	shl    $0x4,%edx
+  803b11:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b17:	8b 52 54             	mov    0x54(%edx),%edx
+  803b1a:	85 d2                	test   %edx,%edx
+  803b1c:	0f 84 3b ff ff ff    	je     803a5d <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803b22:	83 ec 0c             	sub    $0xc,%esp
+  803b25:	50                   	push   %eax
+  803b26:	57                   	push   %edi
+  803b27:	68 90 4e 80 00       	push   $0x804e90
+  803b2c:	68 bb 00 00 00       	push   $0xbb
+  803b31:	68 80 4e 80 00       	push   $0x804e80
+  803b36:	e8 62 c7 ff ff       	call   80029d <_panic>
+	}
+}
+  803b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b3e:	5b                   	pop    %ebx
+  803b3f:	5e                   	pop    %esi
+  803b40:	5f                   	pop    %edi
+  803b41:	5d                   	pop    %ebp
+  803b42:	c3                   	ret
+
+00803b43 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803b43:	55                   	push   %ebp
+  803b44:	89 e5                	mov    %esp,%ebp
+  803b46:	53                   	push   %ebx
+  803b47:	83 ec 04             	sub    $0x4,%esp
+  803b4a:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b4c:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803b52:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803b58:	0f 87 85 00 00 00    	ja     803be3 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b5e:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803b63:	29 c3                	sub    %eax,%ebx
+  803b65:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803b68:	83 ec 04             	sub    $0x4,%esp
+  803b6b:	68 80 02 00 00       	push   $0x280
+  803b70:	6a 00                	push   $0x0
+  803b72:	68 40 70 80 00       	push   $0x807040
+  803b77:	e8 31 cf ff ff       	call   800aad <memset>
+	threads_mu.m_state = 0;
+  803b7c:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803b83:	00 00 00 
+	if (self != 0) {
+  803b86:	83 c4 10             	add    $0x10,%esp
+  803b89:	85 db                	test   %ebx,%ebx
+  803b8b:	74 51                	je     803bde <pthread_fork_child+0x9b>
+  803b8d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b8f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b95:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b9a:	77 18                	ja     803bb4 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b9c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ba1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803ba3:	c1 e8 10             	shr    $0x10,%eax
+  803ba6:	74 0c                	je     803bb4 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ba8:	c1 e0 10             	shl    $0x10,%eax
+  803bab:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803bb0:	29 c2                	sub    %eax,%edx
+  803bb2:	eb 06                	jmp    803bba <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803bb4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803bba:	8b 02                	mov    (%edx),%eax
+  803bbc:	8b 48 48             	mov    0x48(%eax),%ecx
+  803bbf:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803bc6:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803bc9:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803bd0:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803bd7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803be1:	c9                   	leave
+  803be2:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803be3:	83 ec 04             	sub    $0x4,%esp
+  803be6:	68 80 02 00 00       	push   $0x280
+  803beb:	6a 00                	push   $0x0
+  803bed:	68 40 70 80 00       	push   $0x807040
+  803bf2:	e8 b6 ce ff ff       	call   800aad <memset>
+	threads_mu.m_state = 0;
+  803bf7:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803bfe:	00 00 00 
+  803c01:	83 c4 10             	add    $0x10,%esp
+  803c04:	eb d8                	jmp    803bde <pthread_fork_child+0x9b>
+
+00803c06 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c0b:	c3                   	ret
+
+00803c0c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c0c:	55                   	push   %ebp
+  803c0d:	89 e5                	mov    %esp,%ebp
+  803c0f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803c12:	68 b5 4e 80 00       	push   $0x804eb5
+  803c17:	ff 75 0c             	push   0xc(%ebp)
+  803c1a:	e8 3d cd ff ff       	call   80095c <strcpy>
+	return 0;
+}
+  803c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c24:	c9                   	leave
+  803c25:	c3                   	ret
+
+00803c26 <devcons_write>:
+{
+  803c26:	55                   	push   %ebp
+  803c27:	89 e5                	mov    %esp,%ebp
+  803c29:	57                   	push   %edi
+  803c2a:	56                   	push   %esi
+  803c2b:	53                   	push   %ebx
+  803c2c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803c32:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803c37:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803c3d:	eb 2e                	jmp    803c6d <devcons_write+0x47>
+		m = n - tot;
+  803c3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c42:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803c44:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c49:	39 c3                	cmp    %eax,%ebx
+  803c4b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c4e:	83 ec 04             	sub    $0x4,%esp
+  803c51:	53                   	push   %ebx
+  803c52:	89 f0                	mov    %esi,%eax
+  803c54:	03 45 0c             	add    0xc(%ebp),%eax
+  803c57:	50                   	push   %eax
+  803c58:	57                   	push   %edi
+  803c59:	e8 84 ce ff ff       	call   800ae2 <memmove>
+		sys_cputs(buf, m);
+  803c5e:	83 c4 08             	add    $0x8,%esp
+  803c61:	53                   	push   %ebx
+  803c62:	57                   	push   %edi
+  803c63:	e8 38 d0 ff ff       	call   800ca0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803c68:	01 de                	add    %ebx,%esi
+  803c6a:	83 c4 10             	add    $0x10,%esp
+  803c6d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803c70:	72 cd                	jb     803c3f <devcons_write+0x19>
+}
+  803c72:	89 f0                	mov    %esi,%eax
+  803c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c77:	5b                   	pop    %ebx
+  803c78:	5e                   	pop    %esi
+  803c79:	5f                   	pop    %edi
+  803c7a:	5d                   	pop    %ebp
+  803c7b:	c3                   	ret
+
+00803c7c <devcons_read>:
+{
+  803c7c:	55                   	push   %ebp
+  803c7d:	89 e5                	mov    %esp,%ebp
+  803c7f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c87:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c8b:	75 07                	jne    803c94 <devcons_read+0x18>
+  803c8d:	eb 1f                	jmp    803cae <devcons_read+0x32>
+		sys_yield();
+  803c8f:	e8 da d0 ff ff       	call   800d6e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803c94:	e8 32 d0 ff ff       	call   800ccb <sys_cgetc>
+  803c99:	85 c0                	test   %eax,%eax
+  803c9b:	74 f2                	je     803c8f <devcons_read+0x13>
+	if (c < 0)
+  803c9d:	78 0f                	js     803cae <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803c9f:	83 f8 04             	cmp    $0x4,%eax
+  803ca2:	74 0c                	je     803cb0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ca4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ca7:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ca9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803cae:	c9                   	leave
+  803caf:	c3                   	ret
+		return 0;
+  803cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb5:	eb f7                	jmp    803cae <devcons_read+0x32>
+
+00803cb7 <cputchar>:
+{
+  803cb7:	55                   	push   %ebp
+  803cb8:	89 e5                	mov    %esp,%ebp
+  803cba:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803cc3:	6a 01                	push   $0x1
+  803cc5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cc8:	50                   	push   %eax
+  803cc9:	e8 d2 cf ff ff       	call   800ca0 <sys_cputs>
+}
+  803cce:	83 c4 10             	add    $0x10,%esp
+  803cd1:	c9                   	leave
+  803cd2:	c3                   	ret
+
+00803cd3 <getchar>:
+{
+  803cd3:	55                   	push   %ebp
+  803cd4:	89 e5                	mov    %esp,%ebp
+  803cd6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803cd9:	6a 01                	push   $0x1
+  803cdb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cde:	50                   	push   %eax
+  803cdf:	6a 00                	push   $0x0
+  803ce1:	e8 63 d8 ff ff       	call   801549 <read>
+	if (r < 0)
+  803ce6:	83 c4 10             	add    $0x10,%esp
+  803ce9:	85 c0                	test   %eax,%eax
+  803ceb:	78 06                	js     803cf3 <getchar+0x20>
+	if (r < 1)
+  803ced:	74 06                	je     803cf5 <getchar+0x22>
+	return c;
+  803cef:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803cf3:	c9                   	leave
+  803cf4:	c3                   	ret
+		return -E_EOF;
+  803cf5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803cfa:	eb f7                	jmp    803cf3 <getchar+0x20>
+
+00803cfc <iscons>:
+{
+  803cfc:	55                   	push   %ebp
+  803cfd:	89 e5                	mov    %esp,%ebp
+  803cff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d05:	50                   	push   %eax
+  803d06:	ff 75 08             	push   0x8(%ebp)
+  803d09:	e8 ab d5 ff ff       	call   8012b9 <fd_lookup>
+  803d0e:	83 c4 10             	add    $0x10,%esp
+  803d11:	85 c0                	test   %eax,%eax
+  803d13:	78 11                	js     803d26 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803d15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d18:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803d1e:	39 10                	cmp    %edx,(%eax)
+  803d20:	0f 94 c0             	sete   %al
+  803d23:	0f b6 c0             	movzbl %al,%eax
+}
+  803d26:	c9                   	leave
+  803d27:	c3                   	ret
+
+00803d28 <opencons>:
+{
+  803d28:	55                   	push   %ebp
+  803d29:	89 e5                	mov    %esp,%ebp
+  803d2b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803d2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d31:	50                   	push   %eax
+  803d32:	e8 2c d5 ff ff       	call   801263 <fd_alloc>
+  803d37:	83 c4 10             	add    $0x10,%esp
+  803d3a:	85 c0                	test   %eax,%eax
+  803d3c:	78 3a                	js     803d78 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803d3e:	83 ec 04             	sub    $0x4,%esp
+  803d41:	68 07 04 00 00       	push   $0x407
+  803d46:	ff 75 f4             	push   -0xc(%ebp)
+  803d49:	6a 00                	push   $0x0
+  803d4b:	e8 4a d0 ff ff       	call   800d9a <sys_page_alloc>
+  803d50:	83 c4 10             	add    $0x10,%esp
+  803d53:	85 c0                	test   %eax,%eax
+  803d55:	78 21                	js     803d78 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d5a:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803d60:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d65:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d6c:	83 ec 0c             	sub    $0xc,%esp
+  803d6f:	50                   	push   %eax
+  803d70:	e8 c7 d4 ff ff       	call   80123c <fd2num>
+  803d75:	83 c4 10             	add    $0x10,%esp
+}
+  803d78:	c9                   	leave
+  803d79:	c3                   	ret
+
+00803d7a <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803d7a:	55                   	push   %ebp
+  803d7b:	89 e5                	mov    %esp,%ebp
+  803d7d:	57                   	push   %edi
+  803d7e:	56                   	push   %esi
+  803d7f:	53                   	push   %ebx
+  803d80:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803d83:	89 d6                	mov    %edx,%esi
+  803d85:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803d88:	89 cf                	mov    %ecx,%edi
+  803d8a:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803d8d:	89 fa                	mov    %edi,%edx
+  803d8f:	80 ce 08             	or     $0x8,%dh
+  803d92:	f6 c5 08             	test   $0x8,%ch
+  803d95:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803d98:	57                   	push   %edi
+  803d99:	56                   	push   %esi
+  803d9a:	50                   	push   %eax
+  803d9b:	56                   	push   %esi
+  803d9c:	6a 00                	push   $0x0
+  803d9e:	e8 44 d0 ff ff       	call   800de7 <sys_page_map>
+	if (r < 0) {
+  803da3:	83 c4 20             	add    $0x20,%esp
+  803da6:	85 c0                	test   %eax,%eax
+  803da8:	78 27                	js     803dd1 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803daa:	83 ec 0c             	sub    $0xc,%esp
+  803dad:	57                   	push   %edi
+  803dae:	56                   	push   %esi
+  803daf:	6a 00                	push   $0x0
+  803db1:	56                   	push   %esi
+  803db2:	6a 00                	push   $0x0
+  803db4:	e8 2e d0 ff ff       	call   800de7 <sys_page_map>
+  803db9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803dbb:	83 c4 20             	add    $0x20,%esp
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	78 24                	js     803de6 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dc7:	89 d8                	mov    %ebx,%eax
+  803dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dcc:	5b                   	pop    %ebx
+  803dcd:	5e                   	pop    %esi
+  803dce:	5f                   	pop    %edi
+  803dcf:	5d                   	pop    %ebp
+  803dd0:	c3                   	ret
+  803dd1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803dd3:	83 ec 08             	sub    $0x8,%esp
+  803dd6:	50                   	push   %eax
+  803dd7:	68 c4 4e 80 00       	push   $0x804ec4
+  803ddc:	e8 97 c5 ff ff       	call   800378 <cprintf>
+		return r;
+  803de1:	83 c4 10             	add    $0x10,%esp
+  803de4:	eb e1                	jmp    803dc7 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803de6:	83 ec 08             	sub    $0x8,%esp
+  803de9:	50                   	push   %eax
+  803dea:	68 f4 4e 80 00       	push   $0x804ef4
+  803def:	e8 84 c5 ff ff       	call   800378 <cprintf>
+		return r;
+  803df4:	83 c4 10             	add    $0x10,%esp
+  803df7:	eb ce                	jmp    803dc7 <duppage_cow+0x4d>
+
+00803df9 <duppage>:
+{
+  803df9:	55                   	push   %ebp
+  803dfa:	89 e5                	mov    %esp,%ebp
+  803dfc:	53                   	push   %ebx
+  803dfd:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803e00:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803e03:	51                   	push   %ecx
+  803e04:	52                   	push   %edx
+  803e05:	50                   	push   %eax
+  803e06:	52                   	push   %edx
+  803e07:	6a 00                	push   $0x0
+  803e09:	e8 d9 cf ff ff       	call   800de7 <sys_page_map>
+	if (r < 0) {
+  803e0e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803e16:	85 c0                	test   %eax,%eax
+  803e18:	78 07                	js     803e21 <duppage+0x28>
+}
+  803e1a:	89 d8                	mov    %ebx,%eax
+  803e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e1f:	c9                   	leave
+  803e20:	c3                   	ret
+  803e21:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e23:	83 ec 08             	sub    $0x8,%esp
+  803e26:	50                   	push   %eax
+  803e27:	68 c4 4e 80 00       	push   $0x804ec4
+  803e2c:	e8 47 c5 ff ff       	call   800378 <cprintf>
+		return r;
+  803e31:	83 c4 10             	add    $0x10,%esp
+  803e34:	eb e4                	jmp    803e1a <duppage+0x21>
+
+00803e36 <cow_copy>:
+{
+  803e36:	55                   	push   %ebp
+  803e37:	89 e5                	mov    %esp,%ebp
+  803e39:	56                   	push   %esi
+  803e3a:	53                   	push   %ebx
+  803e3b:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803e3d:	83 ec 04             	sub    $0x4,%esp
+  803e40:	6a 07                	push   $0x7
+  803e42:	68 00 f0 7f 00       	push   $0x7ff000
+  803e47:	6a 00                	push   $0x0
+  803e49:	e8 4c cf ff ff       	call   800d9a <sys_page_alloc>
+	if (r < 0) {
+  803e4e:	83 c4 10             	add    $0x10,%esp
+  803e51:	85 c0                	test   %eax,%eax
+  803e53:	78 58                	js     803ead <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803e55:	83 ec 04             	sub    $0x4,%esp
+  803e58:	68 00 10 00 00       	push   $0x1000
+  803e5d:	56                   	push   %esi
+  803e5e:	68 00 f0 7f 00       	push   $0x7ff000
+  803e63:	e8 7a cc ff ff       	call   800ae2 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803e68:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803e6f:	56                   	push   %esi
+  803e70:	6a 00                	push   $0x0
+  803e72:	68 00 f0 7f 00       	push   $0x7ff000
+  803e77:	6a 00                	push   $0x0
+  803e79:	e8 69 cf ff ff       	call   800de7 <sys_page_map>
+  803e7e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e80:	83 c4 20             	add    $0x20,%esp
+  803e83:	85 c0                	test   %eax,%eax
+  803e85:	78 3b                	js     803ec2 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803e87:	83 ec 08             	sub    $0x8,%esp
+  803e8a:	68 00 f0 7f 00       	push   $0x7ff000
+  803e8f:	6a 00                	push   $0x0
+  803e91:	e8 9d cf ff ff       	call   800e33 <sys_page_unmap>
+  803e96:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e98:	83 c4 10             	add    $0x10,%esp
+  803e9b:	85 c0                	test   %eax,%eax
+  803e9d:	78 45                	js     803ee4 <cow_copy+0xae>
+	return 0;
+  803e9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ea4:	89 d8                	mov    %ebx,%eax
+  803ea6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ea9:	5b                   	pop    %ebx
+  803eaa:	5e                   	pop    %esi
+  803eab:	5d                   	pop    %ebp
+  803eac:	c3                   	ret
+  803ead:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803eaf:	83 ec 08             	sub    $0x8,%esp
+  803eb2:	50                   	push   %eax
+  803eb3:	68 e4 4f 80 00       	push   $0x804fe4
+  803eb8:	e8 bb c4 ff ff       	call   800378 <cprintf>
+		return r;
+  803ebd:	83 c4 10             	add    $0x10,%esp
+  803ec0:	eb e2                	jmp    803ea4 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803ec2:	83 ec 08             	sub    $0x8,%esp
+  803ec5:	50                   	push   %eax
+  803ec6:	68 00 50 80 00       	push   $0x805000
+  803ecb:	e8 a8 c4 ff ff       	call   800378 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803ed0:	83 c4 08             	add    $0x8,%esp
+  803ed3:	68 00 f0 7f 00       	push   $0x7ff000
+  803ed8:	6a 00                	push   $0x0
+  803eda:	e8 54 cf ff ff       	call   800e33 <sys_page_unmap>
+		return r;
+  803edf:	83 c4 10             	add    $0x10,%esp
+  803ee2:	eb c0                	jmp    803ea4 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803ee4:	83 ec 08             	sub    $0x8,%esp
+  803ee7:	50                   	push   %eax
+  803ee8:	68 1c 4f 80 00       	push   $0x804f1c
+  803eed:	e8 86 c4 ff ff       	call   800378 <cprintf>
+		return r;
+  803ef2:	83 c4 10             	add    $0x10,%esp
+  803ef5:	eb ad                	jmp    803ea4 <cow_copy+0x6e>
+
+00803ef7 <pgfault>:
+{
+  803ef7:	55                   	push   %ebp
+  803ef8:	89 e5                	mov    %esp,%ebp
+  803efa:	56                   	push   %esi
+  803efb:	53                   	push   %ebx
+  803efc:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803eff:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803f01:	89 d8                	mov    %ebx,%eax
+  803f03:	c1 e8 16             	shr    $0x16,%eax
+  803f06:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803f0d:	89 de                	mov    %ebx,%esi
+  803f0f:	c1 ee 0c             	shr    $0xc,%esi
+  803f12:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803f19:	a8 07                	test   $0x7,%al
+  803f1b:	74 3b                	je     803f58 <pgfault+0x61>
+  803f1d:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803f23:	74 33                	je     803f58 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803f25:	83 ec 0c             	sub    $0xc,%esp
+  803f28:	68 00 f0 bf ee       	push   $0xeebff000
+  803f2d:	e8 c8 f4 ff ff       	call   8033fa <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803f32:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803f39:	83 c4 10             	add    $0x10,%esp
+  803f3c:	f6 c4 08             	test   $0x8,%ah
+  803f3f:	75 30                	jne    803f71 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803f41:	83 ec 0c             	sub    $0xc,%esp
+  803f44:	68 00 f0 bf ee       	push   $0xeebff000
+  803f49:	e8 19 f5 ff ff       	call   803467 <mutex_unlock>
+}
+  803f4e:	83 c4 10             	add    $0x10,%esp
+  803f51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f54:	5b                   	pop    %ebx
+  803f55:	5e                   	pop    %esi
+  803f56:	5d                   	pop    %ebp
+  803f57:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803f58:	83 ec 08             	sub    $0x8,%esp
+  803f5b:	ff 72 28             	push   0x28(%edx)
+  803f5e:	51                   	push   %ecx
+  803f5f:	50                   	push   %eax
+  803f60:	68 40 4f 80 00       	push   $0x804f40
+  803f65:	6a 3f                	push   $0x3f
+  803f67:	68 1a 50 80 00       	push   $0x80501a
+  803f6c:	e8 2c c3 ff ff       	call   80029d <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803f71:	89 d8                	mov    %ebx,%eax
+  803f73:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803f78:	e8 b9 fe ff ff       	call   803e36 <cow_copy>
+  803f7d:	eb c2                	jmp    803f41 <pgfault+0x4a>
+
+00803f7f <cow_enable>:
+{
+  803f7f:	55                   	push   %ebp
+  803f80:	89 e5                	mov    %esp,%ebp
+  803f82:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803f85:	68 f7 3e 80 00       	push   $0x803ef7
+  803f8a:	e8 28 06 00 00       	call   8045b7 <set_pgfault_handler>
+}
+  803f8f:	83 c4 10             	add    $0x10,%esp
+  803f92:	c9                   	leave
+  803f93:	c3                   	ret
+
+00803f94 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803f94:	55                   	push   %ebp
+  803f95:	89 e5                	mov    %esp,%ebp
+  803f97:	57                   	push   %edi
+  803f98:	56                   	push   %esi
+  803f99:	53                   	push   %ebx
+  803f9a:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803f9d:	68 f7 3e 80 00       	push   $0x803ef7
+  803fa2:	e8 10 06 00 00       	call   8045b7 <set_pgfault_handler>
+  803fa7:	b8 07 00 00 00       	mov    $0x7,%eax
+  803fac:	cd 30                	int    $0x30
+  803fae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803fb1:	83 c4 10             	add    $0x10,%esp
+  803fb4:	85 c0                	test   %eax,%eax
+  803fb6:	78 4b                	js     804003 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803fb8:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803fc2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803fc5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803fc9:	0f 85 16 01 00 00    	jne    8040e5 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803fcf:	e8 6e cd ff ff       	call   800d42 <sys_getenvid>
+  803fd4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fd9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fdb:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803fe1:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803fe7:	77 32                	ja     80401b <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fe9:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803fee:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803ff0:	c1 ea 10             	shr    $0x10,%edx
+  803ff3:	74 26                	je     80401b <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ff5:	c1 e2 10             	shl    $0x10,%edx
+  803ff8:	89 d1                	mov    %edx,%ecx
+  803ffa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803fff:	29 ca                	sub    %ecx,%edx
+  804001:	eb 1e                	jmp    804021 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  804003:	83 ec 08             	sub    $0x8,%esp
+  804006:	89 c7                	mov    %eax,%edi
+  804008:	50                   	push   %eax
+  804009:	68 25 50 80 00       	push   $0x805025
+  80400e:	e8 65 c3 ff ff       	call   800378 <cprintf>
+		return eid;
+  804013:	83 c4 10             	add    $0x10,%esp
+  804016:	e9 6c 01 00 00       	jmp    804187 <fork+0x1f3>
+		return pthread_main_tls;
+  80401b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804021:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804024:	c1 e0 04             	shl    $0x4,%eax
+  804027:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80402c:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80402e:	e8 10 fb ff ff       	call   803b43 <pthread_fork_child>
+		return eid;
+  804033:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804036:	e9 4c 01 00 00       	jmp    804187 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80403b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804041:	89 da                	mov    %ebx,%edx
+  804043:	89 f8                	mov    %edi,%eax
+  804045:	e8 af fd ff ff       	call   803df9 <duppage>
+  80404a:	85 c0                	test   %eax,%eax
+  80404c:	79 28                	jns    804076 <fork+0xe2>
+  80404e:	89 c7                	mov    %eax,%edi
+  804050:	e9 32 01 00 00       	jmp    804187 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804055:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80405b:	83 f9 05             	cmp    $0x5,%ecx
+  80405e:	75 58                	jne    8040b8 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804060:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804065:	89 da                	mov    %ebx,%edx
+  804067:	89 f8                	mov    %edi,%eax
+  804069:	e8 8b fd ff ff       	call   803df9 <duppage>
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	0f 88 0f 01 00 00    	js     804185 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804076:	83 c3 01             	add    $0x1,%ebx
+  804079:	39 de                	cmp    %ebx,%esi
+  80407b:	74 54                	je     8040d1 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80407d:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804084:	f6 c1 05             	test   $0x5,%cl
+  804087:	74 ed                	je     804076 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804089:	f6 c5 04             	test   $0x4,%ch
+  80408c:	75 ad                	jne    80403b <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80408e:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804094:	74 bf                	je     804055 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804096:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80409c:	74 d8                	je     804076 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80409e:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8040a4:	89 da                	mov    %ebx,%edx
+  8040a6:	89 f8                	mov    %edi,%eax
+  8040a8:	e8 cd fc ff ff       	call   803d7a <duppage_cow>
+  8040ad:	85 c0                	test   %eax,%eax
+  8040af:	79 c5                	jns    804076 <fork+0xe2>
+  8040b1:	89 c7                	mov    %eax,%edi
+  8040b3:	e9 cf 00 00 00       	jmp    804187 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8040b8:	68 70 4f 80 00       	push   $0x804f70
+  8040bd:	68 7d 4d 80 00       	push   $0x804d7d
+  8040c2:	68 c6 00 00 00       	push   $0xc6
+  8040c7:	68 1a 50 80 00       	push   $0x80501a
+  8040cc:	e8 cc c1 ff ff       	call   80029d <_panic>
+  8040d1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040d4:	83 c1 01             	add    $0x1,%ecx
+  8040d7:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8040dd:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8040e3:	74 18                	je     8040fd <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8040e5:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8040ec:	a8 07                	test   $0x7,%al
+  8040ee:	74 e4                	je     8040d4 <fork+0x140>
+  8040f0:	89 cb                	mov    %ecx,%ebx
+  8040f2:	c1 e3 0a             	shl    $0xa,%ebx
+  8040f5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8040f8:	e9 7c ff ff ff       	jmp    804079 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8040fd:	83 ec 04             	sub    $0x4,%esp
+  804100:	6a 07                	push   $0x7
+  804102:	68 00 f0 bf ee       	push   $0xeebff000
+  804107:	ff 75 e4             	push   -0x1c(%ebp)
+  80410a:	e8 8b cc ff ff       	call   800d9a <sys_page_alloc>
+  80410f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804111:	83 c4 10             	add    $0x10,%esp
+  804114:	85 c0                	test   %eax,%eax
+  804116:	78 34                	js     80414c <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804118:	83 ec 08             	sub    $0x8,%esp
+  80411b:	68 f5 45 80 00       	push   $0x8045f5
+  804120:	ff 75 e4             	push   -0x1c(%ebp)
+  804123:	e8 ef cd ff ff       	call   800f17 <sys_env_set_pgfault_upcall>
+  804128:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80412a:	83 c4 10             	add    $0x10,%esp
+  80412d:	85 c0                	test   %eax,%eax
+  80412f:	78 2e                	js     80415f <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804131:	83 ec 08             	sub    $0x8,%esp
+  804134:	6a 02                	push   $0x2
+  804136:	ff 75 e4             	push   -0x1c(%ebp)
+  804139:	e8 41 cd ff ff       	call   800e7f <sys_env_set_status>
+  80413e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804140:	83 c4 10             	add    $0x10,%esp
+  804143:	85 c0                	test   %eax,%eax
+  804145:	78 2b                	js     804172 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804147:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80414a:	eb 3b                	jmp    804187 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80414c:	83 ec 08             	sub    $0x8,%esp
+  80414f:	50                   	push   %eax
+  804150:	68 98 4f 80 00       	push   $0x804f98
+  804155:	e8 1e c2 ff ff       	call   800378 <cprintf>
+		return r;
+  80415a:	83 c4 10             	add    $0x10,%esp
+  80415d:	eb 28                	jmp    804187 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80415f:	83 ec 08             	sub    $0x8,%esp
+  804162:	50                   	push   %eax
+  804163:	68 c0 4f 80 00       	push   $0x804fc0
+  804168:	e8 0b c2 ff ff       	call   800378 <cprintf>
+		return r;
+  80416d:	83 c4 10             	add    $0x10,%esp
+  804170:	eb 15                	jmp    804187 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804172:	83 ec 08             	sub    $0x8,%esp
+  804175:	50                   	push   %eax
+  804176:	68 35 50 80 00       	push   $0x805035
+  80417b:	e8 f8 c1 ff ff       	call   800378 <cprintf>
+		return r;
+  804180:	83 c4 10             	add    $0x10,%esp
+  804183:	eb 02                	jmp    804187 <fork+0x1f3>
+  804185:	89 c7                	mov    %eax,%edi
+}
+  804187:	89 f8                	mov    %edi,%eax
+  804189:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80418c:	5b                   	pop    %ebx
+  80418d:	5e                   	pop    %esi
+  80418e:	5f                   	pop    %edi
+  80418f:	5d                   	pop    %ebp
+  804190:	c3                   	ret
+
+00804191 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804191:	55                   	push   %ebp
+  804192:	89 e5                	mov    %esp,%ebp
+  804194:	57                   	push   %edi
+  804195:	56                   	push   %esi
+  804196:	53                   	push   %ebx
+  804197:	83 ec 2c             	sub    $0x2c,%esp
+  80419a:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80419c:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8041a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041a7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8041ad:	77 0a                	ja     8041b9 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041af:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8041b4:	29 c3                	sub    %eax,%ebx
+  8041b6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8041b9:	83 ec 0c             	sub    $0xc,%esp
+  8041bc:	68 f7 3e 80 00       	push   $0x803ef7
+  8041c1:	e8 f1 03 00 00       	call   8045b7 <set_pgfault_handler>
+  8041c6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8041cb:	cd 30                	int    $0x30
+  8041cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8041d0:	83 c4 10             	add    $0x10,%esp
+  8041d3:	85 c0                	test   %eax,%eax
+  8041d5:	78 30                	js     804207 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8041d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8041db:	74 42                	je     80421f <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041dd:	c1 e3 10             	shl    $0x10,%ebx
+  8041e0:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8041e5:	29 d8                	sub    %ebx,%eax
+  8041e7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8041ea:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8041ef:	29 d8                	sub    %ebx,%eax
+  8041f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8041f4:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041fe:	89 f7                	mov    %esi,%edi
+  804200:	89 d6                	mov    %edx,%esi
+  804202:	e9 2c 01 00 00       	jmp    804333 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804207:	83 ec 08             	sub    $0x8,%esp
+  80420a:	89 c7                	mov    %eax,%edi
+  80420c:	50                   	push   %eax
+  80420d:	68 25 50 80 00       	push   $0x805025
+  804212:	e8 61 c1 ff ff       	call   800378 <cprintf>
+		return eid;
+  804217:	83 c4 10             	add    $0x10,%esp
+  80421a:	e9 d5 00 00 00       	jmp    8042f4 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80421f:	e8 1e cb ff ff       	call   800d42 <sys_getenvid>
+  804224:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804229:	89 c2                	mov    %eax,%edx
+  80422b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80422d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804233:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804238:	77 18                	ja     804252 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80423a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80423f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804241:	c1 e8 10             	shr    $0x10,%eax
+  804244:	74 0c                	je     804252 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804246:	c1 e0 10             	shl    $0x10,%eax
+  804249:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80424e:	29 c1                	sub    %eax,%ecx
+  804250:	eb 06                	jmp    804258 <sfork+0xc7>
+		return pthread_main_tls;
+  804252:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  804258:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80425b:	c1 e0 04             	shl    $0x4,%eax
+  80425e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804263:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804265:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804268:	e9 87 00 00 00       	jmp    8042f4 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80426d:	f6 c5 04             	test   $0x4,%ch
+  804270:	74 6c                	je     8042de <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804272:	89 ca                	mov    %ecx,%edx
+  804274:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80427a:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804280:	74 7c                	je     8042fe <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804282:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804288:	89 da                	mov    %ebx,%edx
+  80428a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80428d:	e8 67 fb ff ff       	call   803df9 <duppage>
+  804292:	85 c0                	test   %eax,%eax
+  804294:	0f 88 4f 01 00 00    	js     8043e9 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80429a:	83 c3 01             	add    $0x1,%ebx
+  80429d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8042a0:	74 7a                	je     80431c <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8042a2:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8042a4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8042ab:	f6 c1 01             	test   $0x1,%cl
+  8042ae:	74 ea                	je     80429a <sfork+0x109>
+  8042b0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8042b6:	74 e2                	je     80429a <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8042b8:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8042be:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8042c1:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8042c6:	76 a5                	jbe    80426d <sfork+0xdc>
+  8042c8:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8042ce:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8042d1:	39 fa                	cmp    %edi,%edx
+  8042d3:	73 9d                	jae    804272 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8042d5:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8042d8:	39 fa                	cmp    %edi,%edx
+  8042da:	72 96                	jb     804272 <sfork+0xe1>
+  8042dc:	eb 8f                	jmp    80426d <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8042de:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8042e4:	89 da                	mov    %ebx,%edx
+  8042e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8042e9:	e8 8c fa ff ff       	call   803d7a <duppage_cow>
+  8042ee:	85 c0                	test   %eax,%eax
+  8042f0:	79 a8                	jns    80429a <sfork+0x109>
+  8042f2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8042f4:	89 f8                	mov    %edi,%eax
+  8042f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042f9:	5b                   	pop    %ebx
+  8042fa:	5e                   	pop    %esi
+  8042fb:	5f                   	pop    %edi
+  8042fc:	5d                   	pop    %ebp
+  8042fd:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8042fe:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804303:	e8 2e fb ff ff       	call   803e36 <cow_copy>
+  804308:	85 c0                	test   %eax,%eax
+  80430a:	0f 88 d2 00 00 00    	js     8043e2 <sfork+0x251>
+				pte = uvpt[pn];
+  804310:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804317:	e9 66 ff ff ff       	jmp    804282 <sfork+0xf1>
+  80431c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80431f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804322:	83 c6 01             	add    $0x1,%esi
+  804325:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80432b:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804331:	74 1b                	je     80434e <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804333:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80433a:	a8 01                	test   $0x1,%al
+  80433c:	74 e4                	je     804322 <sfork+0x191>
+  80433e:	89 f3                	mov    %esi,%ebx
+  804340:	c1 e3 0a             	shl    $0xa,%ebx
+  804343:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804346:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804349:	e9 4f ff ff ff       	jmp    80429d <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80434e:	83 ec 04             	sub    $0x4,%esp
+  804351:	6a 07                	push   $0x7
+  804353:	68 00 f0 bf ee       	push   $0xeebff000
+  804358:	ff 75 e0             	push   -0x20(%ebp)
+  80435b:	e8 3a ca ff ff       	call   800d9a <sys_page_alloc>
+  804360:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804362:	83 c4 10             	add    $0x10,%esp
+  804365:	85 c0                	test   %eax,%eax
+  804367:	78 37                	js     8043a0 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804369:	83 ec 08             	sub    $0x8,%esp
+  80436c:	68 f5 45 80 00       	push   $0x8045f5
+  804371:	ff 75 e0             	push   -0x20(%ebp)
+  804374:	e8 9e cb ff ff       	call   800f17 <sys_env_set_pgfault_upcall>
+  804379:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80437b:	83 c4 10             	add    $0x10,%esp
+  80437e:	85 c0                	test   %eax,%eax
+  804380:	78 34                	js     8043b6 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804382:	83 ec 08             	sub    $0x8,%esp
+  804385:	6a 02                	push   $0x2
+  804387:	ff 75 e0             	push   -0x20(%ebp)
+  80438a:	e8 f0 ca ff ff       	call   800e7f <sys_env_set_status>
+  80438f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804391:	83 c4 10             	add    $0x10,%esp
+  804394:	85 c0                	test   %eax,%eax
+  804396:	78 34                	js     8043cc <sfork+0x23b>
+	return eid;
+  804398:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80439b:	e9 54 ff ff ff       	jmp    8042f4 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8043a0:	83 ec 08             	sub    $0x8,%esp
+  8043a3:	50                   	push   %eax
+  8043a4:	68 98 4f 80 00       	push   $0x804f98
+  8043a9:	e8 ca bf ff ff       	call   800378 <cprintf>
+		return r;
+  8043ae:	83 c4 10             	add    $0x10,%esp
+  8043b1:	e9 3e ff ff ff       	jmp    8042f4 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8043b6:	83 ec 08             	sub    $0x8,%esp
+  8043b9:	50                   	push   %eax
+  8043ba:	68 c0 4f 80 00       	push   $0x804fc0
+  8043bf:	e8 b4 bf ff ff       	call   800378 <cprintf>
+		return r;
+  8043c4:	83 c4 10             	add    $0x10,%esp
+  8043c7:	e9 28 ff ff ff       	jmp    8042f4 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8043cc:	83 ec 08             	sub    $0x8,%esp
+  8043cf:	50                   	push   %eax
+  8043d0:	68 35 50 80 00       	push   $0x805035
+  8043d5:	e8 9e bf ff ff       	call   800378 <cprintf>
+		return r;
+  8043da:	83 c4 10             	add    $0x10,%esp
+  8043dd:	e9 12 ff ff ff       	jmp    8042f4 <sfork+0x163>
+  8043e2:	89 c7                	mov    %eax,%edi
+  8043e4:	e9 0b ff ff ff       	jmp    8042f4 <sfork+0x163>
+  8043e9:	89 c7                	mov    %eax,%edi
+  8043eb:	e9 04 ff ff ff       	jmp    8042f4 <sfork+0x163>
+
+008043f0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8043f0:	55                   	push   %ebp
+  8043f1:	89 e5                	mov    %esp,%ebp
+  8043f3:	57                   	push   %edi
+  8043f4:	56                   	push   %esi
+  8043f5:	53                   	push   %ebx
+  8043f6:	83 ec 18             	sub    $0x18,%esp
+  8043f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8043fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043ff:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804402:	85 c0                	test   %eax,%eax
+  804404:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804409:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80440c:	50                   	push   %eax
+  80440d:	e8 7e cb ff ff       	call   800f90 <sys_ipc_recv>
+	if (r < 0) {
+  804412:	83 c4 10             	add    $0x10,%esp
+  804415:	85 c0                	test   %eax,%eax
+  804417:	78 2b                	js     804444 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804419:	85 ff                	test   %edi,%edi
+  80441b:	74 55                	je     804472 <ipc_recv+0x82>
+  80441d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80441f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804425:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80442a:	77 39                	ja     804465 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80442c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804431:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804433:	c1 e8 10             	shr    $0x10,%eax
+  804436:	74 2d                	je     804465 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804438:	c1 e0 10             	shl    $0x10,%eax
+  80443b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804440:	29 c2                	sub    %eax,%edx
+  804442:	eb 27                	jmp    80446b <ipc_recv+0x7b>
+  804444:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804446:	83 ec 08             	sub    $0x8,%esp
+  804449:	50                   	push   %eax
+  80444a:	68 53 50 80 00       	push   $0x805053
+  80444f:	e8 24 bf ff ff       	call   800378 <cprintf>
+		*from_env_store = 0;
+  804454:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80445a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804460:	83 c4 10             	add    $0x10,%esp
+  804463:	eb 77                	jmp    8044dc <ipc_recv+0xec>
+		return pthread_main_tls;
+  804465:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80446b:	8b 02                	mov    (%edx),%eax
+  80446d:	8b 40 78             	mov    0x78(%eax),%eax
+  804470:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804472:	85 f6                	test   %esi,%esi
+  804474:	74 34                	je     8044aa <ipc_recv+0xba>
+  804476:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804478:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80447e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804483:	77 18                	ja     80449d <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804485:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80448a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80448c:	c1 e8 10             	shr    $0x10,%eax
+  80448f:	74 0c                	je     80449d <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804491:	c1 e0 10             	shl    $0x10,%eax
+  804494:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804499:	29 c2                	sub    %eax,%edx
+  80449b:	eb 06                	jmp    8044a3 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80449d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8044a3:	8b 02                	mov    (%edx),%eax
+  8044a5:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8044a8:	89 06                	mov    %eax,(%esi)
+  8044aa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044ac:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044b2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044b7:	77 18                	ja     8044d1 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044b9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044be:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044c0:	c1 e8 10             	shr    $0x10,%eax
+  8044c3:	74 0c                	je     8044d1 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044c5:	c1 e0 10             	shl    $0x10,%eax
+  8044c8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044cd:	29 c2                	sub    %eax,%edx
+  8044cf:	eb 06                	jmp    8044d7 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8044d1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8044d7:	8b 02                	mov    (%edx),%eax
+  8044d9:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8044dc:	89 d8                	mov    %ebx,%eax
+  8044de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044e1:	5b                   	pop    %ebx
+  8044e2:	5e                   	pop    %esi
+  8044e3:	5f                   	pop    %edi
+  8044e4:	5d                   	pop    %ebp
+  8044e5:	c3                   	ret
+
+008044e6 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8044e6:	55                   	push   %ebp
+  8044e7:	89 e5                	mov    %esp,%ebp
+  8044e9:	57                   	push   %edi
+  8044ea:	56                   	push   %esi
+  8044eb:	53                   	push   %ebx
+  8044ec:	83 ec 0c             	sub    $0xc,%esp
+  8044ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8044f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8044f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044f8:	85 db                	test   %ebx,%ebx
+  8044fa:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8044ff:	0f 44 d8             	cmove  %eax,%ebx
+  804502:	eb 05                	jmp    804509 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804504:	e8 65 c8 ff ff       	call   800d6e <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804509:	57                   	push   %edi
+  80450a:	53                   	push   %ebx
+  80450b:	ff 75 0c             	push   0xc(%ebp)
+  80450e:	56                   	push   %esi
+  80450f:	e8 4f ca ff ff       	call   800f63 <sys_ipc_try_send>
+		if (r == 0) {
+  804514:	83 c4 10             	add    $0x10,%esp
+  804517:	85 c0                	test   %eax,%eax
+  804519:	74 19                	je     804534 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80451b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80451e:	74 e4                	je     804504 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804520:	83 ec 0c             	sub    $0xc,%esp
+  804523:	50                   	push   %eax
+  804524:	57                   	push   %edi
+  804525:	53                   	push   %ebx
+  804526:	56                   	push   %esi
+  804527:	68 6c 50 80 00       	push   $0x80506c
+  80452c:	e8 47 be ff ff       	call   800378 <cprintf>
+			return;
+  804531:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804537:	5b                   	pop    %ebx
+  804538:	5e                   	pop    %esi
+  804539:	5f                   	pop    %edi
+  80453a:	5d                   	pop    %ebp
+  80453b:	c3                   	ret
+
+0080453c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80453c:	55                   	push   %ebp
+  80453d:	89 e5                	mov    %esp,%ebp
+  80453f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804542:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804547:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80454a:	c1 e0 04             	shl    $0x4,%eax
+  80454d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804552:	8b 40 50             	mov    0x50(%eax),%eax
+  804555:	39 c8                	cmp    %ecx,%eax
+  804557:	74 12                	je     80456b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804559:	83 c2 01             	add    $0x1,%edx
+  80455c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804562:	75 e3                	jne    804547 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804564:	b8 00 00 00 00       	mov    $0x0,%eax
+  804569:	eb 0e                	jmp    804579 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80456b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80456e:	c1 e0 04             	shl    $0x4,%eax
+  804571:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804576:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804579:	5d                   	pop    %ebp
+  80457a:	c3                   	ret
+
+0080457b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80457b:	55                   	push   %ebp
+  80457c:	89 e5                	mov    %esp,%ebp
+  80457e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804581:	89 c2                	mov    %eax,%edx
+  804583:	c1 ea 16             	shr    $0x16,%edx
+  804586:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80458d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804592:	f6 c1 01             	test   $0x1,%cl
+  804595:	74 1c                	je     8045b3 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804597:	c1 e8 0c             	shr    $0xc,%eax
+  80459a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045a1:	a8 01                	test   $0x1,%al
+  8045a3:	74 0e                	je     8045b3 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045a5:	c1 e8 0c             	shr    $0xc,%eax
+  8045a8:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8045af:	ef 
+  8045b0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045b3:	89 d0                	mov    %edx,%eax
+  8045b5:	5d                   	pop    %ebp
+  8045b6:	c3                   	ret
+
+008045b7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8045b7:	55                   	push   %ebp
+  8045b8:	89 e5                	mov    %esp,%ebp
+  8045ba:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8045bd:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8045c4:	74 0a                	je     8045d0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8045c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045c9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8045ce:	c9                   	leave
+  8045cf:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8045d0:	83 ec 04             	sub    $0x4,%esp
+  8045d3:	6a 07                	push   $0x7
+  8045d5:	68 00 f0 bf ee       	push   $0xeebff000
+  8045da:	6a 00                	push   $0x0
+  8045dc:	e8 b9 c7 ff ff       	call   800d9a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8045e1:	83 c4 08             	add    $0x8,%esp
+  8045e4:	68 f5 45 80 00       	push   $0x8045f5
+  8045e9:	6a 00                	push   $0x0
+  8045eb:	e8 27 c9 ff ff       	call   800f17 <sys_env_set_pgfault_upcall>
+  8045f0:	83 c4 10             	add    $0x10,%esp
+  8045f3:	eb d1                	jmp    8045c6 <set_pgfault_handler+0xf>
+
+008045f5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8045f5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8045f6:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8045fb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8045fd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804600:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804604:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804608:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80460b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80460f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804611:	83 c4 08             	add    $0x8,%esp
+	popal
+  804614:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804615:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804618:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804619:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80461a:	c3                   	ret
+
+0080461b <udm>:
+  80461b:	57                   	push   %edi
+  80461c:	56                   	push   %esi
+  80461d:	53                   	push   %ebx
+  80461e:	83 ec 20             	sub    $0x20,%esp
+  804621:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804625:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804629:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80462d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804631:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804635:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804639:	89 d1                	mov    %edx,%ecx
+  80463b:	09 c1                	or     %eax,%ecx
+  80463d:	0f 84 91 00 00 00    	je     8046d4 <udm+0xb9>
+  804643:	b8 00 00 00 00       	mov    $0x0,%eax
+  804648:	ba 00 00 00 00       	mov    $0x0,%edx
+  80464d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804652:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804659:	00 
+  80465a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804661:	00 
+  804662:	eb 08                	jmp    80466c <udm+0x51>
+  804664:	83 e9 01             	sub    $0x1,%ecx
+  804667:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80466a:	74 7c                	je     8046e8 <udm+0xcd>
+  80466c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804670:	01 c0                	add    %eax,%eax
+  804672:	89 c6                	mov    %eax,%esi
+  804674:	89 d7                	mov    %edx,%edi
+  804676:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80467a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80467e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804681:	d3 ea                	shr    %cl,%edx
+  804683:	f6 c1 20             	test   $0x20,%cl
+  804686:	74 04                	je     80468c <udm+0x71>
+  804688:	89 d0                	mov    %edx,%eax
+  80468a:	31 d2                	xor    %edx,%edx
+  80468c:	83 e0 01             	and    $0x1,%eax
+  80468f:	89 04 24             	mov    %eax,(%esp)
+  804692:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804699:	00 
+  80469a:	8b 04 24             	mov    (%esp),%eax
+  80469d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8046a1:	09 f0                	or     %esi,%eax
+  8046a3:	09 fa                	or     %edi,%edx
+  8046a5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046a9:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046ad:	39 f0                	cmp    %esi,%eax
+  8046af:	89 d3                	mov    %edx,%ebx
+  8046b1:	19 fb                	sbb    %edi,%ebx
+  8046b3:	72 af                	jb     804664 <udm+0x49>
+  8046b5:	29 f0                	sub    %esi,%eax
+  8046b7:	19 fa                	sbb    %edi,%edx
+  8046b9:	89 cf                	mov    %ecx,%edi
+  8046bb:	c1 ef 05             	shr    $0x5,%edi
+  8046be:	83 e7 01             	and    $0x1,%edi
+  8046c1:	89 fe                	mov    %edi,%esi
+  8046c3:	83 f6 01             	xor    $0x1,%esi
+  8046c6:	d3 e6                	shl    %cl,%esi
+  8046c8:	d3 e7                	shl    %cl,%edi
+  8046ca:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046ce:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046d2:	eb 90                	jmp    804664 <udm+0x49>
+  8046d4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046d8:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046dc:	89 f0                	mov    %esi,%eax
+  8046de:	89 fa                	mov    %edi,%edx
+  8046e0:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8046e4:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8046e8:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8046ec:	89 01                	mov    %eax,(%ecx)
+  8046ee:	89 51 04             	mov    %edx,0x4(%ecx)
+  8046f1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046f5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046f9:	83 c4 20             	add    $0x20,%esp
+  8046fc:	5b                   	pop    %ebx
+  8046fd:	5e                   	pop    %esi
+  8046fe:	5f                   	pop    %edi
+  8046ff:	c3                   	ret
+
+00804700 <__udivdi3>:
+  804700:	83 ec 18             	sub    $0x18,%esp
+  804703:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804707:	50                   	push   %eax
+  804708:	ff 74 24 2c          	push   0x2c(%esp)
+  80470c:	ff 74 24 2c          	push   0x2c(%esp)
+  804710:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804714:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804718:	e8 fe fe ff ff       	call   80461b <udm>
+  80471d:	83 c4 24             	add    $0x24,%esp
+  804720:	c3                   	ret
+
+00804721 <__umoddi3>:
+  804721:	83 ec 18             	sub    $0x18,%esp
+  804724:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804728:	50                   	push   %eax
+  804729:	ff 74 24 2c          	push   0x2c(%esp)
+  80472d:	ff 74 24 2c          	push   0x2c(%esp)
+  804731:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804735:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804739:	e8 dd fe ff ff       	call   80461b <udm>
+  80473e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804742:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804746:	83 c4 24             	add    $0x24,%esp
+  804749:	c3                   	ret
+
+0080474a <__divdi3>:
+  80474a:	56                   	push   %esi
+  80474b:	53                   	push   %ebx
+  80474c:	83 ec 14             	sub    $0x14,%esp
+  80474f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804753:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804757:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80475b:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80475f:	85 d2                	test   %edx,%edx
+  804761:	78 18                	js     80477b <__divdi3+0x31>
+  804763:	85 db                	test   %ebx,%ebx
+  804765:	78 3e                	js     8047a5 <__divdi3+0x5b>
+  804767:	83 ec 04             	sub    $0x4,%esp
+  80476a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80476e:	56                   	push   %esi
+  80476f:	53                   	push   %ebx
+  804770:	51                   	push   %ecx
+  804771:	e8 a5 fe ff ff       	call   80461b <udm>
+  804776:	83 c4 10             	add    $0x10,%esp
+  804779:	eb 24                	jmp    80479f <__divdi3+0x55>
+  80477b:	f7 d8                	neg    %eax
+  80477d:	83 d2 00             	adc    $0x0,%edx
+  804780:	f7 da                	neg    %edx
+  804782:	85 db                	test   %ebx,%ebx
+  804784:	78 3a                	js     8047c0 <__divdi3+0x76>
+  804786:	83 ec 04             	sub    $0x4,%esp
+  804789:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80478d:	56                   	push   %esi
+  80478e:	53                   	push   %ebx
+  80478f:	51                   	push   %ecx
+  804790:	e8 86 fe ff ff       	call   80461b <udm>
+  804795:	83 c4 10             	add    $0x10,%esp
+  804798:	f7 d8                	neg    %eax
+  80479a:	83 d2 00             	adc    $0x0,%edx
+  80479d:	f7 da                	neg    %edx
+  80479f:	83 c4 14             	add    $0x14,%esp
+  8047a2:	5b                   	pop    %ebx
+  8047a3:	5e                   	pop    %esi
+  8047a4:	c3                   	ret
+  8047a5:	83 ec 04             	sub    $0x4,%esp
+  8047a8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047ac:	56                   	push   %esi
+  8047ad:	f7 d9                	neg    %ecx
+  8047af:	83 d3 00             	adc    $0x0,%ebx
+  8047b2:	f7 db                	neg    %ebx
+  8047b4:	53                   	push   %ebx
+  8047b5:	51                   	push   %ecx
+  8047b6:	e8 60 fe ff ff       	call   80461b <udm>
+  8047bb:	83 c4 10             	add    $0x10,%esp
+  8047be:	eb d8                	jmp    804798 <__divdi3+0x4e>
+  8047c0:	83 ec 04             	sub    $0x4,%esp
+  8047c3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047c7:	56                   	push   %esi
+  8047c8:	f7 d9                	neg    %ecx
+  8047ca:	83 d3 00             	adc    $0x0,%ebx
+  8047cd:	f7 db                	neg    %ebx
+  8047cf:	53                   	push   %ebx
+  8047d0:	51                   	push   %ecx
+  8047d1:	e8 45 fe ff ff       	call   80461b <udm>
+  8047d6:	83 c4 10             	add    $0x10,%esp
+  8047d9:	eb c4                	jmp    80479f <__divdi3+0x55>
+
+008047db <__moddi3>:
+  8047db:	55                   	push   %ebp
+  8047dc:	57                   	push   %edi
+  8047dd:	56                   	push   %esi
+  8047de:	53                   	push   %ebx
+  8047df:	83 ec 24             	sub    $0x24,%esp
+  8047e2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8047e6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8047ea:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8047ee:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8047f2:	85 d2                	test   %edx,%edx
+  8047f4:	78 3b                	js     804831 <__moddi3+0x56>
+  8047f6:	83 ec 04             	sub    $0x4,%esp
+  8047f9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047fd:	56                   	push   %esi
+  8047fe:	89 ce                	mov    %ecx,%esi
+  804800:	f7 de                	neg    %esi
+  804802:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804806:	89 de                	mov    %ebx,%esi
+  804808:	83 d6 00             	adc    $0x0,%esi
+  80480b:	f7 de                	neg    %esi
+  80480d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804811:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804815:	0f 48 f1             	cmovs  %ecx,%esi
+  804818:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80481d:	53                   	push   %ebx
+  80481e:	56                   	push   %esi
+  80481f:	e8 f7 fd ff ff       	call   80461b <udm>
+  804824:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804828:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80482c:	83 c4 10             	add    $0x10,%esp
+  80482f:	eb 47                	jmp    804878 <__moddi3+0x9d>
+  804831:	f7 d8                	neg    %eax
+  804833:	83 d2 00             	adc    $0x0,%edx
+  804836:	f7 da                	neg    %edx
+  804838:	83 ec 04             	sub    $0x4,%esp
+  80483b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80483f:	56                   	push   %esi
+  804840:	89 cf                	mov    %ecx,%edi
+  804842:	f7 df                	neg    %edi
+  804844:	89 de                	mov    %ebx,%esi
+  804846:	83 d6 00             	adc    $0x0,%esi
+  804849:	f7 de                	neg    %esi
+  80484b:	0f 49 cf             	cmovns %edi,%ecx
+  80484e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804852:	0f 49 de             	cmovns %esi,%ebx
+  804855:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804859:	ff 74 24 0c          	push   0xc(%esp)
+  80485d:	ff 74 24 0c          	push   0xc(%esp)
+  804861:	e8 b5 fd ff ff       	call   80461b <udm>
+  804866:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80486a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80486e:	f7 d8                	neg    %eax
+  804870:	83 d2 00             	adc    $0x0,%edx
+  804873:	f7 da                	neg    %edx
+  804875:	83 c4 10             	add    $0x10,%esp
+  804878:	83 c4 24             	add    $0x24,%esp
+  80487b:	5b                   	pop    %ebx
+  80487c:	5e                   	pop    %esi
+  80487d:	5f                   	pop    %edi
+  80487e:	5d                   	pop    %ebp
+  80487f:	c3                   	ret
@@ -0,0 +1,9763 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 80 47 80 00       	push   $0x804780
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 0e 02 00 00       	call   800273 <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 fa 00 00 00       	call   800187 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 0c 0e 00 00       	call   800ea7 <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 83 47 80 00       	push   $0x804783
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 ec 0d 00 00       	call   800ea7 <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 72 4e 80 00       	push   $0x804e72
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 c8 0d 00 00       	call   800ea7 <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	57                   	push   %edi
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	83 ec 1c             	sub    $0x1c,%esp
+  8000ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000f3:	e8 b0 04 00 00       	call   8005a8 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000f8:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000fb:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800101:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800106:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800108:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80010a:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800110:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800115:	77 16                	ja     80012d <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800117:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80011c:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80011e:	c1 e8 10             	shr    $0x10,%eax
+  800121:	74 0a                	je     80012d <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800123:	c1 e0 10             	shl    $0x10,%eax
+  800126:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80012b:	29 c2                	sub    %eax,%edx
+  80012d:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800130:	c1 e0 04             	shl    $0x4,%eax
+  800133:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800138:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80013a:	85 db                	test   %ebx,%ebx
+  80013c:	7e 07                	jle    800145 <libmain+0x61>
+		binaryname = argv[0];
+  80013e:	8b 06                	mov    (%esi),%eax
+  800140:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800145:	83 ec 08             	sub    $0x8,%esp
+  800148:	56                   	push   %esi
+  800149:	53                   	push   %ebx
+  80014a:	e8 e4 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80014f:	e8 0b 00 00 00       	call   80015f <exit>
+}
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80015a:	5b                   	pop    %ebx
+  80015b:	5e                   	pop    %esi
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800165:	6a 00                	push   $0x0
+  800167:	e8 91 1a 00 00       	call   801bfd <fflush>
+	pthread_kill_others();
+  80016c:	e8 fc 30 00 00       	call   80326d <pthread_kill_others>
+	close_all();
+  800171:	e8 2a 0b 00 00       	call   800ca0 <close_all>
+	sys_env_destroy(0);
+  800176:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80017d:	e8 db 03 00 00       	call   80055d <sys_env_destroy>
+}
+  800182:	83 c4 10             	add    $0x10,%esp
+  800185:	c9                   	leave
+  800186:	c3                   	ret
+
+00800187 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800187:	55                   	push   %ebp
+  800188:	89 e5                	mov    %esp,%ebp
+  80018a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80018d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800192:	eb 03                	jmp    800197 <strlen+0x10>
+		n++;
+  800194:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800197:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80019b:	75 f7                	jne    800194 <strlen+0xd>
+	return n;
+}
+  80019d:	5d                   	pop    %ebp
+  80019e:	c3                   	ret
+
+0080019f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8001a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	eb 03                	jmp    8001b2 <strnlen+0x13>
+		n++;
+  8001af:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8001b2:	39 d0                	cmp    %edx,%eax
+  8001b4:	74 08                	je     8001be <strnlen+0x1f>
+  8001b6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8001ba:	75 f3                	jne    8001af <strnlen+0x10>
+  8001bc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8001be:	89 d0                	mov    %edx,%eax
+  8001c0:	5d                   	pop    %ebp
+  8001c1:	c3                   	ret
+
+008001c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8001c2:	55                   	push   %ebp
+  8001c3:	89 e5                	mov    %esp,%ebp
+  8001c5:	53                   	push   %ebx
+  8001c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8001d5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8001d8:	83 c0 01             	add    $0x1,%eax
+  8001db:	84 d2                	test   %dl,%dl
+  8001dd:	75 f2                	jne    8001d1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8001df:	89 c8                	mov    %ecx,%eax
+  8001e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e4:	c9                   	leave
+  8001e5:	c3                   	ret
+
+008001e6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	53                   	push   %ebx
+  8001ea:	83 ec 10             	sub    $0x10,%esp
+  8001ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8001f0:	53                   	push   %ebx
+  8001f1:	e8 91 ff ff ff       	call   800187 <strlen>
+  8001f6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8001f9:	ff 75 0c             	push   0xc(%ebp)
+  8001fc:	01 d8                	add    %ebx,%eax
+  8001fe:	50                   	push   %eax
+  8001ff:	e8 be ff ff ff       	call   8001c2 <strcpy>
+	return dst;
+}
+  800204:	89 d8                	mov    %ebx,%eax
+  800206:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800209:	c9                   	leave
+  80020a:	c3                   	ret
+
+0080020b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80020b:	55                   	push   %ebp
+  80020c:	89 e5                	mov    %esp,%ebp
+  80020e:	56                   	push   %esi
+  80020f:	53                   	push   %ebx
+  800210:	8b 75 08             	mov    0x8(%ebp),%esi
+  800213:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800216:	89 f3                	mov    %esi,%ebx
+  800218:	03 5d 10             	add    0x10(%ebp),%ebx
+  80021b:	89 f0                	mov    %esi,%eax
+  80021d:	eb 0f                	jmp    80022e <strncpy+0x23>
+		*dst++ = *src;
+  80021f:	83 c0 01             	add    $0x1,%eax
+  800222:	0f b6 0a             	movzbl (%edx),%ecx
+  800225:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800228:	80 f9 01             	cmp    $0x1,%cl
+  80022b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80022e:	39 d8                	cmp    %ebx,%eax
+  800230:	75 ed                	jne    80021f <strncpy+0x14>
+	}
+	return ret;
+}
+  800232:	89 f0                	mov    %esi,%eax
+  800234:	5b                   	pop    %ebx
+  800235:	5e                   	pop    %esi
+  800236:	5d                   	pop    %ebp
+  800237:	c3                   	ret
+
+00800238 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	56                   	push   %esi
+  80023c:	53                   	push   %ebx
+  80023d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800243:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800246:	89 f0                	mov    %esi,%eax
+  800248:	85 d2                	test   %edx,%edx
+  80024a:	74 21                	je     80026d <strlcpy+0x35>
+  80024c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800250:	89 f2                	mov    %esi,%edx
+  800252:	eb 09                	jmp    80025d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800254:	83 c1 01             	add    $0x1,%ecx
+  800257:	83 c2 01             	add    $0x1,%edx
+  80025a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80025d:	39 c2                	cmp    %eax,%edx
+  80025f:	74 09                	je     80026a <strlcpy+0x32>
+  800261:	0f b6 19             	movzbl (%ecx),%ebx
+  800264:	84 db                	test   %bl,%bl
+  800266:	75 ec                	jne    800254 <strlcpy+0x1c>
+  800268:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80026a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80026d:	29 f0                	sub    %esi,%eax
+}
+  80026f:	5b                   	pop    %ebx
+  800270:	5e                   	pop    %esi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800279:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80027c:	eb 06                	jmp    800284 <strcmp+0x11>
+		p++, q++;
+  80027e:	83 c1 01             	add    $0x1,%ecx
+  800281:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800284:	0f b6 01             	movzbl (%ecx),%eax
+  800287:	84 c0                	test   %al,%al
+  800289:	74 04                	je     80028f <strcmp+0x1c>
+  80028b:	3a 02                	cmp    (%edx),%al
+  80028d:	74 ef                	je     80027e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80028f:	0f b6 c0             	movzbl %al,%eax
+  800292:	0f b6 12             	movzbl (%edx),%edx
+  800295:	29 d0                	sub    %edx,%eax
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	53                   	push   %ebx
+  80029d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8002a6:	eb 09                	jmp    8002b1 <strncmp+0x18>
+		n--, p++, q++;
+  8002a8:	83 ea 01             	sub    $0x1,%edx
+  8002ab:	83 c0 01             	add    $0x1,%eax
+  8002ae:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8002b1:	85 d2                	test   %edx,%edx
+  8002b3:	74 18                	je     8002cd <strncmp+0x34>
+  8002b5:	0f b6 18             	movzbl (%eax),%ebx
+  8002b8:	84 db                	test   %bl,%bl
+  8002ba:	74 04                	je     8002c0 <strncmp+0x27>
+  8002bc:	3a 19                	cmp    (%ecx),%bl
+  8002be:	74 e8                	je     8002a8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8002c0:	0f b6 00             	movzbl (%eax),%eax
+  8002c3:	0f b6 11             	movzbl (%ecx),%edx
+  8002c6:	29 d0                	sub    %edx,%eax
+}
+  8002c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+		return 0;
+  8002cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d2:	eb f4                	jmp    8002c8 <strncmp+0x2f>
+
+008002d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8002d4:	55                   	push   %ebp
+  8002d5:	89 e5                	mov    %esp,%ebp
+  8002d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8002de:	eb 03                	jmp    8002e3 <strchr+0xf>
+  8002e0:	83 c0 01             	add    $0x1,%eax
+  8002e3:	0f b6 10             	movzbl (%eax),%edx
+  8002e6:	84 d2                	test   %dl,%dl
+  8002e8:	74 06                	je     8002f0 <strchr+0x1c>
+		if (*s == c)
+  8002ea:	38 ca                	cmp    %cl,%dl
+  8002ec:	75 f2                	jne    8002e0 <strchr+0xc>
+  8002ee:	eb 05                	jmp    8002f5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002f5:	5d                   	pop    %ebp
+  8002f6:	c3                   	ret
+
+008002f7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002f7:	55                   	push   %ebp
+  8002f8:	89 e5                	mov    %esp,%ebp
+  8002fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800301:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800304:	38 ca                	cmp    %cl,%dl
+  800306:	74 09                	je     800311 <strfind+0x1a>
+  800308:	84 d2                	test   %dl,%dl
+  80030a:	74 05                	je     800311 <strfind+0x1a>
+	for (; *s; s++)
+  80030c:	83 c0 01             	add    $0x1,%eax
+  80030f:	eb f0                	jmp    800301 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+
+00800313 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	57                   	push   %edi
+  800317:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80031a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80031d:	85 c9                	test   %ecx,%ecx
+  80031f:	74 20                	je     800341 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800321:	89 f8                	mov    %edi,%eax
+  800323:	09 c8                	or     %ecx,%eax
+  800325:	a8 03                	test   $0x3,%al
+  800327:	75 12                	jne    80033b <memset+0x28>
+		c &= 0xFF;
+  800329:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80032d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800333:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800336:	fc                   	cld
+  800337:	f3 ab                	rep stos %eax,%es:(%edi)
+  800339:	eb 06                	jmp    800341 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80033b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80033e:	fc                   	cld
+  80033f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800341:	89 f8                	mov    %edi,%eax
+  800343:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+
+00800348 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	57                   	push   %edi
+  80034c:	56                   	push   %esi
+  80034d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800350:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800353:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800356:	39 c6                	cmp    %eax,%esi
+  800358:	73 32                	jae    80038c <memmove+0x44>
+  80035a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80035d:	39 d0                	cmp    %edx,%eax
+  80035f:	73 2b                	jae    80038c <memmove+0x44>
+		s += n;
+		d += n;
+  800361:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800364:	89 d6                	mov    %edx,%esi
+  800366:	09 fe                	or     %edi,%esi
+  800368:	09 ce                	or     %ecx,%esi
+  80036a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800370:	75 0e                	jne    800380 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800372:	83 ef 04             	sub    $0x4,%edi
+  800375:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800378:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80037b:	fd                   	std
+  80037c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80037e:	eb 09                	jmp    800389 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800380:	83 ef 01             	sub    $0x1,%edi
+  800383:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800386:	fd                   	std
+  800387:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800389:	fc                   	cld
+  80038a:	eb 1a                	jmp    8003a6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80038c:	89 f2                	mov    %esi,%edx
+  80038e:	09 c2                	or     %eax,%edx
+  800390:	09 ca                	or     %ecx,%edx
+  800392:	f6 c2 03             	test   $0x3,%dl
+  800395:	75 0a                	jne    8003a1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800397:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80039a:	89 c7                	mov    %eax,%edi
+  80039c:	fc                   	cld
+  80039d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80039f:	eb 05                	jmp    8003a6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8003a1:	89 c7                	mov    %eax,%edi
+  8003a3:	fc                   	cld
+  8003a4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8003a6:	5e                   	pop    %esi
+  8003a7:	5f                   	pop    %edi
+  8003a8:	5d                   	pop    %ebp
+  8003a9:	c3                   	ret
+
+008003aa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8003b0:	ff 75 10             	push   0x10(%ebp)
+  8003b3:	ff 75 0c             	push   0xc(%ebp)
+  8003b6:	ff 75 08             	push   0x8(%ebp)
+  8003b9:	e8 8a ff ff ff       	call   800348 <memmove>
+}
+  8003be:	c9                   	leave
+  8003bf:	c3                   	ret
+
+008003c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8003c0:	55                   	push   %ebp
+  8003c1:	89 e5                	mov    %esp,%ebp
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8003cb:	89 c6                	mov    %eax,%esi
+  8003cd:	03 75 10             	add    0x10(%ebp),%esi
+  8003d0:	eb 06                	jmp    8003d8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8003d2:	83 c0 01             	add    $0x1,%eax
+  8003d5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8003d8:	39 f0                	cmp    %esi,%eax
+  8003da:	74 14                	je     8003f0 <memcmp+0x30>
+		if (*s1 != *s2)
+  8003dc:	0f b6 08             	movzbl (%eax),%ecx
+  8003df:	0f b6 1a             	movzbl (%edx),%ebx
+  8003e2:	38 d9                	cmp    %bl,%cl
+  8003e4:	74 ec                	je     8003d2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8003e6:	0f b6 c1             	movzbl %cl,%eax
+  8003e9:	0f b6 db             	movzbl %bl,%ebx
+  8003ec:	29 d8                	sub    %ebx,%eax
+  8003ee:	eb 05                	jmp    8003f5 <memcmp+0x35>
+	}
+
+	return 0;
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003f5:	5b                   	pop    %ebx
+  8003f6:	5e                   	pop    %esi
+  8003f7:	5d                   	pop    %ebp
+  8003f8:	c3                   	ret
+
+008003f9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003f9:	55                   	push   %ebp
+  8003fa:	89 e5                	mov    %esp,%ebp
+  8003fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800402:	89 c2                	mov    %eax,%edx
+  800404:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800407:	eb 03                	jmp    80040c <memfind+0x13>
+  800409:	83 c0 01             	add    $0x1,%eax
+  80040c:	39 d0                	cmp    %edx,%eax
+  80040e:	73 04                	jae    800414 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800410:	38 08                	cmp    %cl,(%eax)
+  800412:	75 f5                	jne    800409 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800414:	5d                   	pop    %ebp
+  800415:	c3                   	ret
+
+00800416 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800416:	55                   	push   %ebp
+  800417:	89 e5                	mov    %esp,%ebp
+  800419:	57                   	push   %edi
+  80041a:	56                   	push   %esi
+  80041b:	53                   	push   %ebx
+  80041c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800422:	eb 03                	jmp    800427 <strtol+0x11>
+		s++;
+  800424:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800427:	0f b6 02             	movzbl (%edx),%eax
+  80042a:	3c 20                	cmp    $0x20,%al
+  80042c:	74 f6                	je     800424 <strtol+0xe>
+  80042e:	3c 09                	cmp    $0x9,%al
+  800430:	74 f2                	je     800424 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800432:	3c 2b                	cmp    $0x2b,%al
+  800434:	74 2a                	je     800460 <strtol+0x4a>
+	int neg = 0;
+  800436:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80043b:	3c 2d                	cmp    $0x2d,%al
+  80043d:	74 2b                	je     80046a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80043f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800445:	75 0f                	jne    800456 <strtol+0x40>
+  800447:	80 3a 30             	cmpb   $0x30,(%edx)
+  80044a:	74 28                	je     800474 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80044c:	85 db                	test   %ebx,%ebx
+  80044e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800453:	0f 44 d8             	cmove  %eax,%ebx
+  800456:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80045e:	eb 46                	jmp    8004a6 <strtol+0x90>
+		s++;
+  800460:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800463:	bf 00 00 00 00       	mov    $0x0,%edi
+  800468:	eb d5                	jmp    80043f <strtol+0x29>
+		s++, neg = 1;
+  80046a:	83 c2 01             	add    $0x1,%edx
+  80046d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800472:	eb cb                	jmp    80043f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800474:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800478:	74 0e                	je     800488 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80047a:	85 db                	test   %ebx,%ebx
+  80047c:	75 d8                	jne    800456 <strtol+0x40>
+		s++, base = 8;
+  80047e:	83 c2 01             	add    $0x1,%edx
+  800481:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800486:	eb ce                	jmp    800456 <strtol+0x40>
+		s += 2, base = 16;
+  800488:	83 c2 02             	add    $0x2,%edx
+  80048b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800490:	eb c4                	jmp    800456 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800492:	0f be c0             	movsbl %al,%eax
+  800495:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800498:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80049b:	7d 3a                	jge    8004d7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80049d:	83 c2 01             	add    $0x1,%edx
+  8004a0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8004a4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8004a6:	0f b6 02             	movzbl (%edx),%eax
+  8004a9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004ac:	89 f3                	mov    %esi,%ebx
+  8004ae:	80 fb 09             	cmp    $0x9,%bl
+  8004b1:	76 df                	jbe    800492 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8004b3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8004b6:	89 f3                	mov    %esi,%ebx
+  8004b8:	80 fb 19             	cmp    $0x19,%bl
+  8004bb:	77 08                	ja     8004c5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8004bd:	0f be c0             	movsbl %al,%eax
+  8004c0:	83 e8 57             	sub    $0x57,%eax
+  8004c3:	eb d3                	jmp    800498 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8004c5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8004c8:	89 f3                	mov    %esi,%ebx
+  8004ca:	80 fb 19             	cmp    $0x19,%bl
+  8004cd:	77 08                	ja     8004d7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8004cf:	0f be c0             	movsbl %al,%eax
+  8004d2:	83 e8 37             	sub    $0x37,%eax
+  8004d5:	eb c1                	jmp    800498 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8004d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8004db:	74 05                	je     8004e2 <strtol+0xcc>
+		*endptr = (char *) s;
+  8004dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004e0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8004e2:	89 c8                	mov    %ecx,%eax
+  8004e4:	f7 d8                	neg    %eax
+  8004e6:	85 ff                	test   %edi,%edi
+  8004e8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004eb:	89 c8                	mov    %ecx,%eax
+  8004ed:	5b                   	pop    %ebx
+  8004ee:	5e                   	pop    %esi
+  8004ef:	5f                   	pop    %edi
+  8004f0:	5d                   	pop    %ebp
+  8004f1:	c3                   	ret
+
+008004f2 <atoi>:
+
+int
+atoi(const char* s)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  8004f8:	6a 00                	push   $0x0
+  8004fa:	6a 00                	push   $0x0
+  8004fc:	ff 75 08             	push   0x8(%ebp)
+  8004ff:	e8 12 ff ff ff       	call   800416 <strtol>
+}
+  800504:	c9                   	leave
+  800505:	c3                   	ret
+
+00800506 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80050b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800510:	8b 55 08             	mov    0x8(%ebp),%edx
+  800513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800516:	89 c3                	mov    %eax,%ebx
+  800518:	89 c7                	mov    %eax,%edi
+  80051a:	6a 00                	push   $0x0
+  80051c:	55                   	push   %ebp
+  80051d:	56                   	push   %esi
+  80051e:	89 e5                	mov    %esp,%ebp
+  800520:	8d 35 28 05 80 00    	lea    0x800528,%esi
+  800526:	0f 34                	sysenter
+
+00800528 <after_sysenter_label_47>:
+  800528:	5e                   	pop    %esi
+  800529:	5d                   	pop    %ebp
+  80052a:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80052d:	5b                   	pop    %ebx
+  80052e:	5f                   	pop    %edi
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+
+00800531 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800531:	55                   	push   %ebp
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	57                   	push   %edi
+  800535:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800540:	89 d1                	mov    %edx,%ecx
+  800542:	89 d3                	mov    %edx,%ebx
+  800544:	89 d7                	mov    %edx,%edi
+  800546:	6a 00                	push   $0x0
+  800548:	55                   	push   %ebp
+  800549:	56                   	push   %esi
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	8d 35 54 05 80 00    	lea    0x800554,%esi
+  800552:	0f 34                	sysenter
+
+00800554 <after_sysenter_label_128>:
+  800554:	5e                   	pop    %esi
+  800555:	5d                   	pop    %ebp
+  800556:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800559:	5b                   	pop    %ebx
+  80055a:	5f                   	pop    %edi
+  80055b:	5d                   	pop    %ebp
+  80055c:	c3                   	ret
+
+0080055d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80055d:	55                   	push   %ebp
+  80055e:	89 e5                	mov    %esp,%ebp
+  800560:	57                   	push   %edi
+  800561:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800562:	8b 55 08             	mov    0x8(%ebp),%edx
+  800565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80056f:	89 cb                	mov    %ecx,%ebx
+  800571:	89 cf                	mov    %ecx,%edi
+  800573:	6a 00                	push   $0x0
+  800575:	55                   	push   %ebp
+  800576:	56                   	push   %esi
+  800577:	89 e5                	mov    %esp,%ebp
+  800579:	8d 35 81 05 80 00    	lea    0x800581,%esi
+  80057f:	0f 34                	sysenter
+
+00800581 <after_sysenter_label_212>:
+  800581:	5e                   	pop    %esi
+  800582:	5d                   	pop    %ebp
+  800583:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800586:	85 c0                	test   %eax,%eax
+  800588:	7f 07                	jg     800591 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80058a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80058d:	5b                   	pop    %ebx
+  80058e:	5f                   	pop    %edi
+  80058f:	5d                   	pop    %ebp
+  800590:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800591:	83 ec 0c             	sub    $0xc,%esp
+  800594:	50                   	push   %eax
+  800595:	6a 03                	push   $0x3
+  800597:	68 8f 47 80 00       	push   $0x80478f
+  80059c:	6a 54                	push   $0x54
+  80059e:	68 ac 47 80 00       	push   $0x8047ac
+  8005a3:	e8 38 30 00 00       	call   8035e0 <_panic>
+
+008005a8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	57                   	push   %edi
+  8005ac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8005b7:	89 d1                	mov    %edx,%ecx
+  8005b9:	89 d3                	mov    %edx,%ebx
+  8005bb:	89 d7                	mov    %edx,%edi
+  8005bd:	6a 00                	push   $0x0
+  8005bf:	55                   	push   %ebp
+  8005c0:	56                   	push   %esi
+  8005c1:	89 e5                	mov    %esp,%ebp
+  8005c3:	8d 35 cb 05 80 00    	lea    0x8005cb,%esi
+  8005c9:	0f 34                	sysenter
+
+008005cb <after_sysenter_label_309>:
+  8005cb:	5e                   	pop    %esi
+  8005cc:	5d                   	pop    %ebp
+  8005cd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8005d0:	5b                   	pop    %ebx
+  8005d1:	5f                   	pop    %edi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	57                   	push   %edi
+  8005d8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005de:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8005e3:	89 d1                	mov    %edx,%ecx
+  8005e5:	89 d3                	mov    %edx,%ebx
+  8005e7:	89 d7                	mov    %edx,%edi
+  8005e9:	6a 00                	push   $0x0
+  8005eb:	55                   	push   %ebp
+  8005ec:	56                   	push   %esi
+  8005ed:	89 e5                	mov    %esp,%ebp
+  8005ef:	8d 35 f7 05 80 00    	lea    0x8005f7,%esi
+  8005f5:	0f 34                	sysenter
+
+008005f7 <after_sysenter_label_391>:
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5d                   	pop    %ebp
+  8005f9:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8005fc:	5b                   	pop    %ebx
+  8005fd:	5f                   	pop    %edi
+  8005fe:	5d                   	pop    %ebp
+  8005ff:	c3                   	ret
+
+00800600 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800600:	55                   	push   %ebp
+  800601:	89 e5                	mov    %esp,%ebp
+  800603:	57                   	push   %edi
+  800604:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800605:	8b 55 08             	mov    0x8(%ebp),%edx
+  800608:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80060b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800610:	bf 00 00 00 00       	mov    $0x0,%edi
+  800615:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800618:	6a 00                	push   $0x0
+  80061a:	55                   	push   %ebp
+  80061b:	56                   	push   %esi
+  80061c:	89 e5                	mov    %esp,%ebp
+  80061e:	8d 35 26 06 80 00    	lea    0x800626,%esi
+  800624:	0f 34                	sysenter
+
+00800626 <after_sysenter_label_479>:
+  800626:	5e                   	pop    %esi
+  800627:	5d                   	pop    %ebp
+  800628:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80062b:	85 c0                	test   %eax,%eax
+  80062d:	7f 07                	jg     800636 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80062f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800632:	5b                   	pop    %ebx
+  800633:	5f                   	pop    %edi
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800636:	83 ec 0c             	sub    $0xc,%esp
+  800639:	50                   	push   %eax
+  80063a:	6a 04                	push   $0x4
+  80063c:	68 8f 47 80 00       	push   $0x80478f
+  800641:	6a 54                	push   $0x54
+  800643:	68 ac 47 80 00       	push   $0x8047ac
+  800648:	e8 93 2f 00 00       	call   8035e0 <_panic>
+
+0080064d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80064d:	55                   	push   %ebp
+  80064e:	89 e5                	mov    %esp,%ebp
+  800650:	57                   	push   %edi
+  800651:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800652:	8b 55 08             	mov    0x8(%ebp),%edx
+  800655:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800658:	b8 05 00 00 00       	mov    $0x5,%eax
+  80065d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800660:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800663:	ff 75 18             	push   0x18(%ebp)
+  800666:	55                   	push   %ebp
+  800667:	56                   	push   %esi
+  800668:	89 e5                	mov    %esp,%ebp
+  80066a:	8d 35 72 06 80 00    	lea    0x800672,%esi
+  800670:	0f 34                	sysenter
+
+00800672 <after_sysenter_label_593>:
+  800672:	5e                   	pop    %esi
+  800673:	5d                   	pop    %ebp
+  800674:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800677:	85 c0                	test   %eax,%eax
+  800679:	7f 07                	jg     800682 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80067b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80067e:	5b                   	pop    %ebx
+  80067f:	5f                   	pop    %edi
+  800680:	5d                   	pop    %ebp
+  800681:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800682:	83 ec 0c             	sub    $0xc,%esp
+  800685:	50                   	push   %eax
+  800686:	6a 05                	push   $0x5
+  800688:	68 8f 47 80 00       	push   $0x80478f
+  80068d:	6a 54                	push   $0x54
+  80068f:	68 ac 47 80 00       	push   $0x8047ac
+  800694:	e8 47 2f 00 00       	call   8035e0 <_panic>
+
+00800699 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800699:	55                   	push   %ebp
+  80069a:	89 e5                	mov    %esp,%ebp
+  80069c:	57                   	push   %edi
+  80069d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80069e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006a9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8006ae:	89 df                	mov    %ebx,%edi
+  8006b0:	6a 00                	push   $0x0
+  8006b2:	55                   	push   %ebp
+  8006b3:	56                   	push   %esi
+  8006b4:	89 e5                	mov    %esp,%ebp
+  8006b6:	8d 35 be 06 80 00    	lea    0x8006be,%esi
+  8006bc:	0f 34                	sysenter
+
+008006be <after_sysenter_label_704>:
+  8006be:	5e                   	pop    %esi
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8006c3:	85 c0                	test   %eax,%eax
+  8006c5:	7f 07                	jg     8006ce <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8006c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006ca:	5b                   	pop    %ebx
+  8006cb:	5f                   	pop    %edi
+  8006cc:	5d                   	pop    %ebp
+  8006cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006ce:	83 ec 0c             	sub    $0xc,%esp
+  8006d1:	50                   	push   %eax
+  8006d2:	6a 06                	push   $0x6
+  8006d4:	68 8f 47 80 00       	push   $0x80478f
+  8006d9:	6a 54                	push   $0x54
+  8006db:	68 ac 47 80 00       	push   $0x8047ac
+  8006e0:	e8 fb 2e 00 00       	call   8035e0 <_panic>
+
+008006e5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	57                   	push   %edi
+  8006e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8006ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8006fa:	89 df                	mov    %ebx,%edi
+  8006fc:	6a 00                	push   $0x0
+  8006fe:	55                   	push   %ebp
+  8006ff:	56                   	push   %esi
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	8d 35 0a 07 80 00    	lea    0x80070a,%esi
+  800708:	0f 34                	sysenter
+
+0080070a <after_sysenter_label_808>:
+  80070a:	5e                   	pop    %esi
+  80070b:	5d                   	pop    %ebp
+  80070c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80070f:	85 c0                	test   %eax,%eax
+  800711:	7f 07                	jg     80071a <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800713:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800716:	5b                   	pop    %ebx
+  800717:	5f                   	pop    %edi
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+  80071d:	50                   	push   %eax
+  80071e:	6a 08                	push   $0x8
+  800720:	68 8f 47 80 00       	push   $0x80478f
+  800725:	6a 54                	push   $0x54
+  800727:	68 ac 47 80 00       	push   $0x8047ac
+  80072c:	e8 af 2e 00 00       	call   8035e0 <_panic>
+
+00800731 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	57                   	push   %edi
+  800735:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800736:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80073e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800741:	b8 09 00 00 00       	mov    $0x9,%eax
+  800746:	89 df                	mov    %ebx,%edi
+  800748:	6a 00                	push   $0x0
+  80074a:	55                   	push   %ebp
+  80074b:	56                   	push   %esi
+  80074c:	89 e5                	mov    %esp,%ebp
+  80074e:	8d 35 56 07 80 00    	lea    0x800756,%esi
+  800754:	0f 34                	sysenter
+
+00800756 <after_sysenter_label_912>:
+  800756:	5e                   	pop    %esi
+  800757:	5d                   	pop    %ebp
+  800758:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	7f 07                	jg     800766 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80075f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800762:	5b                   	pop    %ebx
+  800763:	5f                   	pop    %edi
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800766:	83 ec 0c             	sub    $0xc,%esp
+  800769:	50                   	push   %eax
+  80076a:	6a 09                	push   $0x9
+  80076c:	68 8f 47 80 00       	push   $0x80478f
+  800771:	6a 54                	push   $0x54
+  800773:	68 ac 47 80 00       	push   $0x8047ac
+  800778:	e8 63 2e 00 00       	call   8035e0 <_panic>
+
+0080077d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80077d:	55                   	push   %ebp
+  80077e:	89 e5                	mov    %esp,%ebp
+  800780:	57                   	push   %edi
+  800781:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800782:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800787:	8b 55 08             	mov    0x8(%ebp),%edx
+  80078a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80078d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800792:	89 df                	mov    %ebx,%edi
+  800794:	6a 00                	push   $0x0
+  800796:	55                   	push   %ebp
+  800797:	56                   	push   %esi
+  800798:	89 e5                	mov    %esp,%ebp
+  80079a:	8d 35 a2 07 80 00    	lea    0x8007a2,%esi
+  8007a0:	0f 34                	sysenter
+
+008007a2 <after_sysenter_label_1016>:
+  8007a2:	5e                   	pop    %esi
+  8007a3:	5d                   	pop    %ebp
+  8007a4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8007a7:	85 c0                	test   %eax,%eax
+  8007a9:	7f 07                	jg     8007b2 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8007ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007ae:	5b                   	pop    %ebx
+  8007af:	5f                   	pop    %edi
+  8007b0:	5d                   	pop    %ebp
+  8007b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007b2:	83 ec 0c             	sub    $0xc,%esp
+  8007b5:	50                   	push   %eax
+  8007b6:	6a 0a                	push   $0xa
+  8007b8:	68 8f 47 80 00       	push   $0x80478f
+  8007bd:	6a 54                	push   $0x54
+  8007bf:	68 ac 47 80 00       	push   $0x8047ac
+  8007c4:	e8 17 2e 00 00       	call   8035e0 <_panic>
+
+008007c9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	57                   	push   %edi
+  8007cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8007ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8007d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007df:	6a 00                	push   $0x0
+  8007e1:	55                   	push   %ebp
+  8007e2:	56                   	push   %esi
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8d 35 ed 07 80 00    	lea    0x8007ed,%esi
+  8007eb:	0f 34                	sysenter
+
+008007ed <after_sysenter_label_1126>:
+  8007ed:	5e                   	pop    %esi
+  8007ee:	5d                   	pop    %ebp
+  8007ef:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5f                   	pop    %edi
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	57                   	push   %edi
+  8007fa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8007fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800803:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800808:	89 cb                	mov    %ecx,%ebx
+  80080a:	89 cf                	mov    %ecx,%edi
+  80080c:	6a 00                	push   $0x0
+  80080e:	55                   	push   %ebp
+  80080f:	56                   	push   %esi
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	8d 35 1a 08 80 00    	lea    0x80081a,%esi
+  800818:	0f 34                	sysenter
+
+0080081a <after_sysenter_label_1210>:
+  80081a:	5e                   	pop    %esi
+  80081b:	5d                   	pop    %ebp
+  80081c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80081f:	85 c0                	test   %eax,%eax
+  800821:	7f 07                	jg     80082a <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800826:	5b                   	pop    %ebx
+  800827:	5f                   	pop    %edi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80082a:	83 ec 0c             	sub    $0xc,%esp
+  80082d:	50                   	push   %eax
+  80082e:	6a 0d                	push   $0xd
+  800830:	68 8f 47 80 00       	push   $0x80478f
+  800835:	6a 54                	push   $0x54
+  800837:	68 ac 47 80 00       	push   $0x8047ac
+  80083c:	e8 9f 2d 00 00       	call   8035e0 <_panic>
+
+00800841 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	57                   	push   %edi
+  800845:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80084b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80084e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800851:	b8 42 00 00 00       	mov    $0x42,%eax
+  800856:	89 df                	mov    %ebx,%edi
+  800858:	6a 00                	push   $0x0
+  80085a:	55                   	push   %ebp
+  80085b:	56                   	push   %esi
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	8d 35 66 08 80 00    	lea    0x800866,%esi
+  800864:	0f 34                	sysenter
+
+00800866 <after_sysenter_label_1311>:
+  800866:	5e                   	pop    %esi
+  800867:	5d                   	pop    %ebp
+  800868:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	7f 07                	jg     800876 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80086f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800872:	5b                   	pop    %ebx
+  800873:	5f                   	pop    %edi
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800876:	83 ec 0c             	sub    $0xc,%esp
+  800879:	50                   	push   %eax
+  80087a:	6a 42                	push   $0x42
+  80087c:	68 8f 47 80 00       	push   $0x80478f
+  800881:	6a 54                	push   $0x54
+  800883:	68 ac 47 80 00       	push   $0x8047ac
+  800888:	e8 53 2d 00 00       	call   8035e0 <_panic>
+
+0080088d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80088d:	55                   	push   %ebp
+  80088e:	89 e5                	mov    %esp,%ebp
+  800890:	57                   	push   %edi
+  800891:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800892:	ba 00 00 00 00       	mov    $0x0,%edx
+  800897:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80089c:	89 d1                	mov    %edx,%ecx
+  80089e:	89 d3                	mov    %edx,%ebx
+  8008a0:	89 d7                	mov    %edx,%edi
+  8008a2:	6a 00                	push   $0x0
+  8008a4:	55                   	push   %ebp
+  8008a5:	56                   	push   %esi
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	8d 35 b0 08 80 00    	lea    0x8008b0,%esi
+  8008ae:	0f 34                	sysenter
+
+008008b0 <after_sysenter_label_1411>:
+  8008b0:	5e                   	pop    %esi
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8008b5:	5b                   	pop    %ebx
+  8008b6:	5f                   	pop    %edi
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	57                   	push   %edi
+  8008bd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8008be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8008ce:	89 df                	mov    %ebx,%edi
+  8008d0:	6a 00                	push   $0x0
+  8008d2:	55                   	push   %ebp
+  8008d3:	56                   	push   %esi
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8d 35 de 08 80 00    	lea    0x8008de,%esi
+  8008dc:	0f 34                	sysenter
+
+008008de <after_sysenter_label_1497>:
+  8008de:	5e                   	pop    %esi
+  8008df:	5d                   	pop    %ebp
+  8008e0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8008e3:	5b                   	pop    %ebx
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	57                   	push   %edi
+  8008eb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8008ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8008fc:	89 df                	mov    %ebx,%edi
+  8008fe:	6a 00                	push   $0x0
+  800900:	55                   	push   %ebp
+  800901:	56                   	push   %esi
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	8d 35 0c 09 80 00    	lea    0x80090c,%esi
+  80090a:	0f 34                	sysenter
+
+0080090c <after_sysenter_label_1583>:
+  80090c:	5e                   	pop    %esi
+  80090d:	5d                   	pop    %ebp
+  80090e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800911:	5b                   	pop    %ebx
+  800912:	5f                   	pop    %edi
+  800913:	5d                   	pop    %ebp
+  800914:	c3                   	ret
+
+00800915 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	57                   	push   %edi
+  800919:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80091a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80091d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800920:	b8 11 00 00 00       	mov    $0x11,%eax
+  800925:	bf 00 00 00 00       	mov    $0x0,%edi
+  80092a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80092d:	6a 00                	push   $0x0
+  80092f:	55                   	push   %ebp
+  800930:	56                   	push   %esi
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	8d 35 3b 09 80 00    	lea    0x80093b,%esi
+  800939:	0f 34                	sysenter
+
+0080093b <after_sysenter_label_1672>:
+  80093b:	5e                   	pop    %esi
+  80093c:	5d                   	pop    %ebp
+  80093d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800940:	5b                   	pop    %ebx
+  800941:	5f                   	pop    %edi
+  800942:	5d                   	pop    %ebp
+  800943:	c3                   	ret
+
+00800944 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800949:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80094e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800951:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800954:	b8 12 00 00 00       	mov    $0x12,%eax
+  800959:	89 df                	mov    %ebx,%edi
+  80095b:	6a 00                	push   $0x0
+  80095d:	55                   	push   %ebp
+  80095e:	56                   	push   %esi
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	8d 35 69 09 80 00    	lea    0x800969,%esi
+  800967:	0f 34                	sysenter
+
+00800969 <after_sysenter_label_1758>:
+  800969:	5e                   	pop    %esi
+  80096a:	5d                   	pop    %ebp
+  80096b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80096e:	5b                   	pop    %ebx
+  80096f:	5f                   	pop    %edi
+  800970:	5d                   	pop    %ebp
+  800971:	c3                   	ret
+
+00800972 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	57                   	push   %edi
+  800976:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800977:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800984:	89 cb                	mov    %ecx,%ebx
+  800986:	89 cf                	mov    %ecx,%edi
+  800988:	6a 00                	push   $0x0
+  80098a:	55                   	push   %ebp
+  80098b:	56                   	push   %esi
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	8d 35 96 09 80 00    	lea    0x800996,%esi
+  800994:	0f 34                	sysenter
+
+00800996 <after_sysenter_label_1842>:
+  800996:	5e                   	pop    %esi
+  800997:	5d                   	pop    %ebp
+  800998:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80099b:	85 c0                	test   %eax,%eax
+  80099d:	7f 07                	jg     8009a6 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80099f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009a2:	5b                   	pop    %ebx
+  8009a3:	5f                   	pop    %edi
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009a6:	83 ec 0c             	sub    $0xc,%esp
+  8009a9:	50                   	push   %eax
+  8009aa:	6a 13                	push   $0x13
+  8009ac:	68 8f 47 80 00       	push   $0x80478f
+  8009b1:	6a 54                	push   $0x54
+  8009b3:	68 ac 47 80 00       	push   $0x8047ac
+  8009b8:	e8 23 2c 00 00       	call   8035e0 <_panic>
+
+008009bd <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	57                   	push   %edi
+  8009c1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8009c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8009cc:	89 d1                	mov    %edx,%ecx
+  8009ce:	89 d3                	mov    %edx,%ebx
+  8009d0:	89 d7                	mov    %edx,%edi
+  8009d2:	6a 00                	push   $0x0
+  8009d4:	55                   	push   %ebp
+  8009d5:	56                   	push   %esi
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	8d 35 e0 09 80 00    	lea    0x8009e0,%esi
+  8009de:	0f 34                	sysenter
+
+008009e0 <after_sysenter_label_1939>:
+  8009e0:	5e                   	pop    %esi
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8009e5:	5b                   	pop    %ebx
+  8009e6:	5f                   	pop    %edi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	57                   	push   %edi
+  8009ed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8009ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8009f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a01:	6a 00                	push   $0x0
+  800a03:	55                   	push   %ebp
+  800a04:	56                   	push   %esi
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	8d 35 0f 0a 80 00    	lea    0x800a0f,%esi
+  800a0d:	0f 34                	sysenter
+
+00800a0f <after_sysenter_label_2028>:
+  800a0f:	5e                   	pop    %esi
+  800a10:	5d                   	pop    %ebp
+  800a11:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800a14:	5b                   	pop    %ebx
+  800a15:	5f                   	pop    %edi
+  800a16:	5d                   	pop    %ebp
+  800a17:	c3                   	ret
+
+00800a18 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800a18:	55                   	push   %ebp
+  800a19:	89 e5                	mov    %esp,%ebp
+  800a1b:	57                   	push   %edi
+  800a1c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800a1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a28:	b8 16 00 00 00       	mov    $0x16,%eax
+  800a2d:	89 df                	mov    %ebx,%edi
+  800a2f:	6a 00                	push   $0x0
+  800a31:	55                   	push   %ebp
+  800a32:	56                   	push   %esi
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	8d 35 3d 0a 80 00    	lea    0x800a3d,%esi
+  800a3b:	0f 34                	sysenter
+
+00800a3d <after_sysenter_label_2114>:
+  800a3d:	5e                   	pop    %esi
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800a42:	5b                   	pop    %ebx
+  800a43:	5f                   	pop    %edi
+  800a44:	5d                   	pop    %ebp
+  800a45:	c3                   	ret
+
+00800a46 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	57                   	push   %edi
+  800a4a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a56:	b8 17 00 00 00       	mov    $0x17,%eax
+  800a5b:	89 df                	mov    %ebx,%edi
+  800a5d:	6a 00                	push   $0x0
+  800a5f:	55                   	push   %ebp
+  800a60:	56                   	push   %esi
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	8d 35 6b 0a 80 00    	lea    0x800a6b,%esi
+  800a69:	0f 34                	sysenter
+
+00800a6b <after_sysenter_label_2200>:
+  800a6b:	5e                   	pop    %esi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800a70:	5b                   	pop    %ebx
+  800a71:	5f                   	pop    %edi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a84:	b8 18 00 00 00       	mov    $0x18,%eax
+  800a89:	89 df                	mov    %ebx,%edi
+  800a8b:	6a 00                	push   $0x0
+  800a8d:	55                   	push   %ebp
+  800a8e:	56                   	push   %esi
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	8d 35 99 0a 80 00    	lea    0x800a99,%esi
+  800a97:	0f 34                	sysenter
+
+00800a99 <after_sysenter_label_2286>:
+  800a99:	5e                   	pop    %esi
+  800a9a:	5d                   	pop    %ebp
+  800a9b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800a9e:	5b                   	pop    %ebx
+  800a9f:	5f                   	pop    %edi
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+
+00800aa2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa8:	05 00 00 00 30       	add    $0x30000000,%eax
+  800aad:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800abd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ac2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ac7:	5d                   	pop    %ebp
+  800ac8:	c3                   	ret
+
+00800ac9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ac9:	55                   	push   %ebp
+  800aca:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800acc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ad1:	eb 02                	jmp    800ad5 <fd_alloc+0xc>
+  800ad3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ad5:	89 c2                	mov    %eax,%edx
+  800ad7:	c1 ea 16             	shr    $0x16,%edx
+  800ada:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800ae1:	f6 c2 01             	test   $0x1,%dl
+  800ae4:	74 2b                	je     800b11 <fd_alloc+0x48>
+  800ae6:	89 c2                	mov    %eax,%edx
+  800ae8:	c1 ea 0c             	shr    $0xc,%edx
+  800aeb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800af2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800af8:	f6 c1 01             	test   $0x1,%cl
+  800afb:	74 14                	je     800b11 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800afd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800b03:	75 ce                	jne    800ad3 <fd_alloc+0xa>
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800b0a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800b0f:	eb 05                	jmp    800b16 <fd_alloc+0x4d>
+			return 0;
+  800b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800b16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b19:	89 02                	mov    %eax,(%edx)
+}
+  800b1b:	89 c8                	mov    %ecx,%eax
+  800b1d:	5d                   	pop    %ebp
+  800b1e:	c3                   	ret
+
+00800b1f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800b25:	83 f8 1f             	cmp    $0x1f,%eax
+  800b28:	77 30                	ja     800b5a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800b2a:	c1 e0 0c             	shl    $0xc,%eax
+  800b2d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800b32:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800b38:	f6 c2 01             	test   $0x1,%dl
+  800b3b:	74 24                	je     800b61 <fd_lookup+0x42>
+  800b3d:	89 c2                	mov    %eax,%edx
+  800b3f:	c1 ea 0c             	shr    $0xc,%edx
+  800b42:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800b49:	f6 c2 01             	test   $0x1,%dl
+  800b4c:	74 1a                	je     800b68 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800b4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b51:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+		return -E_INVAL;
+  800b5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5f:	eb f7                	jmp    800b58 <fd_lookup+0x39>
+		return -E_INVAL;
+  800b61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b66:	eb f0                	jmp    800b58 <fd_lookup+0x39>
+  800b68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6d:	eb e9                	jmp    800b58 <fd_lookup+0x39>
+
+00800b6f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 04             	sub    $0x4,%esp
+  800b76:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800b79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7e:	eb 03                	jmp    800b83 <dev_lookup+0x14>
+  800b80:	83 c0 01             	add    $0x1,%eax
+  800b83:	8b 1c 85 38 48 80 00 	mov    0x804838(,%eax,4),%ebx
+  800b8a:	85 db                	test   %ebx,%ebx
+  800b8c:	74 0b                	je     800b99 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800b8e:	39 13                	cmp    %edx,(%ebx)
+  800b90:	75 ee                	jne    800b80 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b97:	eb 49                	jmp    800be2 <dev_lookup+0x73>
+  800b99:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800b9b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800ba1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800ba6:	77 18                	ja     800bc0 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800ba8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bad:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800baf:	c1 e8 10             	shr    $0x10,%eax
+  800bb2:	74 0c                	je     800bc0 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bb4:	c1 e0 10             	shl    $0x10,%eax
+  800bb7:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  800bbc:	29 c1                	sub    %eax,%ecx
+  800bbe:	eb 06                	jmp    800bc6 <dev_lookup+0x57>
+		return pthread_main_tls;
+  800bc0:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800bc6:	8b 01                	mov    (%ecx),%eax
+  800bc8:	8b 40 48             	mov    0x48(%eax),%eax
+  800bcb:	83 ec 04             	sub    $0x4,%esp
+  800bce:	52                   	push   %edx
+  800bcf:	50                   	push   %eax
+  800bd0:	68 bc 47 80 00       	push   $0x8047bc
+  800bd5:	e8 e1 2a 00 00       	call   8036bb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800bda:	83 c4 10             	add    $0x10,%esp
+  800bdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800be2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be5:	89 1a                	mov    %ebx,(%edx)
+}
+  800be7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bea:	c9                   	leave
+  800beb:	c3                   	ret
+
+00800bec <fd_close>:
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	57                   	push   %edi
+  800bf0:	56                   	push   %esi
+  800bf1:	53                   	push   %ebx
+  800bf2:	83 ec 24             	sub    $0x24,%esp
+  800bf5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800bfb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800bfe:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800bff:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800c05:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800c08:	50                   	push   %eax
+  800c09:	e8 11 ff ff ff       	call   800b1f <fd_lookup>
+  800c0e:	89 c3                	mov    %eax,%ebx
+  800c10:	83 c4 10             	add    $0x10,%esp
+  800c13:	85 c0                	test   %eax,%eax
+  800c15:	78 05                	js     800c1c <fd_close+0x30>
+	    || fd != fd2)
+  800c17:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800c1a:	74 16                	je     800c32 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800c1c:	89 f8                	mov    %edi,%eax
+  800c1e:	84 c0                	test   %al,%al
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c25:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800c28:	89 d8                	mov    %ebx,%eax
+  800c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800c32:	83 ec 08             	sub    $0x8,%esp
+  800c35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800c38:	50                   	push   %eax
+  800c39:	ff 36                	push   (%esi)
+  800c3b:	e8 2f ff ff ff       	call   800b6f <dev_lookup>
+  800c40:	89 c3                	mov    %eax,%ebx
+  800c42:	83 c4 10             	add    $0x10,%esp
+  800c45:	85 c0                	test   %eax,%eax
+  800c47:	78 1a                	js     800c63 <fd_close+0x77>
+		if (dev->dev_close)
+  800c49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c4c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800c4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	74 0b                	je     800c63 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800c58:	83 ec 0c             	sub    $0xc,%esp
+  800c5b:	56                   	push   %esi
+  800c5c:	ff d0                	call   *%eax
+  800c5e:	89 c3                	mov    %eax,%ebx
+  800c60:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800c63:	83 ec 08             	sub    $0x8,%esp
+  800c66:	56                   	push   %esi
+  800c67:	6a 00                	push   $0x0
+  800c69:	e8 2b fa ff ff       	call   800699 <sys_page_unmap>
+	return r;
+  800c6e:	83 c4 10             	add    $0x10,%esp
+  800c71:	eb b5                	jmp    800c28 <fd_close+0x3c>
+
+00800c73 <close>:
+
+int
+close(int fdnum)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800c79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c7c:	50                   	push   %eax
+  800c7d:	ff 75 08             	push   0x8(%ebp)
+  800c80:	e8 9a fe ff ff       	call   800b1f <fd_lookup>
+  800c85:	83 c4 10             	add    $0x10,%esp
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	79 02                	jns    800c8e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+		return fd_close(fd, 1);
+  800c8e:	83 ec 08             	sub    $0x8,%esp
+  800c91:	6a 01                	push   $0x1
+  800c93:	ff 75 f4             	push   -0xc(%ebp)
+  800c96:	e8 51 ff ff ff       	call   800bec <fd_close>
+  800c9b:	83 c4 10             	add    $0x10,%esp
+  800c9e:	eb ec                	jmp    800c8c <close+0x19>
+
+00800ca0 <close_all>:
+
+void
+close_all(void)
+{
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	53                   	push   %ebx
+  800ca4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800ca7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800cac:	83 ec 0c             	sub    $0xc,%esp
+  800caf:	53                   	push   %ebx
+  800cb0:	e8 be ff ff ff       	call   800c73 <close>
+	for (i = 0; i < MAXFD; i++)
+  800cb5:	83 c3 01             	add    $0x1,%ebx
+  800cb8:	83 c4 10             	add    $0x10,%esp
+  800cbb:	83 fb 20             	cmp    $0x20,%ebx
+  800cbe:	75 ec                	jne    800cac <close_all+0xc>
+}
+  800cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+00800cc5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+  800ccb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800cce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800cd1:	50                   	push   %eax
+  800cd2:	ff 75 08             	push   0x8(%ebp)
+  800cd5:	e8 45 fe ff ff       	call   800b1f <fd_lookup>
+  800cda:	89 c3                	mov    %eax,%ebx
+  800cdc:	83 c4 10             	add    $0x10,%esp
+  800cdf:	85 c0                	test   %eax,%eax
+  800ce1:	78 7f                	js     800d62 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800ce3:	83 ec 0c             	sub    $0xc,%esp
+  800ce6:	ff 75 0c             	push   0xc(%ebp)
+  800ce9:	e8 85 ff ff ff       	call   800c73 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800cee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cf1:	c1 e6 0c             	shl    $0xc,%esi
+  800cf4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800cfa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cfd:	89 3c 24             	mov    %edi,(%esp)
+  800d00:	e8 ad fd ff ff       	call   800ab2 <fd2data>
+  800d05:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800d07:	89 34 24             	mov    %esi,(%esp)
+  800d0a:	e8 a3 fd ff ff       	call   800ab2 <fd2data>
+  800d0f:	83 c4 10             	add    $0x10,%esp
+  800d12:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800d15:	89 d8                	mov    %ebx,%eax
+  800d17:	c1 e8 16             	shr    $0x16,%eax
+  800d1a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800d21:	a8 01                	test   $0x1,%al
+  800d23:	74 11                	je     800d36 <dup+0x71>
+  800d25:	89 d8                	mov    %ebx,%eax
+  800d27:	c1 e8 0c             	shr    $0xc,%eax
+  800d2a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800d31:	f6 c2 01             	test   $0x1,%dl
+  800d34:	75 36                	jne    800d6c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800d36:	89 f8                	mov    %edi,%eax
+  800d38:	c1 e8 0c             	shr    $0xc,%eax
+  800d3b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+  800d45:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d4a:	50                   	push   %eax
+  800d4b:	56                   	push   %esi
+  800d4c:	6a 00                	push   $0x0
+  800d4e:	57                   	push   %edi
+  800d4f:	6a 00                	push   $0x0
+  800d51:	e8 f7 f8 ff ff       	call   80064d <sys_page_map>
+  800d56:	89 c3                	mov    %eax,%ebx
+  800d58:	83 c4 20             	add    $0x20,%esp
+  800d5b:	85 c0                	test   %eax,%eax
+  800d5d:	78 33                	js     800d92 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800d5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800d62:	89 d8                	mov    %ebx,%eax
+  800d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800d6c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d7b:	50                   	push   %eax
+  800d7c:	ff 75 d4             	push   -0x2c(%ebp)
+  800d7f:	6a 00                	push   $0x0
+  800d81:	53                   	push   %ebx
+  800d82:	6a 00                	push   $0x0
+  800d84:	e8 c4 f8 ff ff       	call   80064d <sys_page_map>
+  800d89:	89 c3                	mov    %eax,%ebx
+  800d8b:	83 c4 20             	add    $0x20,%esp
+  800d8e:	85 c0                	test   %eax,%eax
+  800d90:	79 a4                	jns    800d36 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800d92:	83 ec 08             	sub    $0x8,%esp
+  800d95:	56                   	push   %esi
+  800d96:	6a 00                	push   $0x0
+  800d98:	e8 fc f8 ff ff       	call   800699 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800d9d:	83 c4 08             	add    $0x8,%esp
+  800da0:	ff 75 d4             	push   -0x2c(%ebp)
+  800da3:	6a 00                	push   $0x0
+  800da5:	e8 ef f8 ff ff       	call   800699 <sys_page_unmap>
+	return r;
+  800daa:	83 c4 10             	add    $0x10,%esp
+  800dad:	eb b3                	jmp    800d62 <dup+0x9d>
+
+00800daf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  800db4:	83 ec 18             	sub    $0x18,%esp
+  800db7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800dba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dbd:	50                   	push   %eax
+  800dbe:	53                   	push   %ebx
+  800dbf:	e8 5b fd ff ff       	call   800b1f <fd_lookup>
+  800dc4:	83 c4 10             	add    $0x10,%esp
+  800dc7:	85 c0                	test   %eax,%eax
+  800dc9:	78 3c                	js     800e07 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800dcb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800dce:	83 ec 08             	sub    $0x8,%esp
+  800dd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800dd4:	50                   	push   %eax
+  800dd5:	ff 36                	push   (%esi)
+  800dd7:	e8 93 fd ff ff       	call   800b6f <dev_lookup>
+  800ddc:	83 c4 10             	add    $0x10,%esp
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	78 24                	js     800e07 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800de3:	8b 46 08             	mov    0x8(%esi),%eax
+  800de6:	83 e0 03             	and    $0x3,%eax
+  800de9:	83 f8 01             	cmp    $0x1,%eax
+  800dec:	74 20                	je     800e0e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800dee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800df1:	8b 40 08             	mov    0x8(%eax),%eax
+  800df4:	85 c0                	test   %eax,%eax
+  800df6:	74 61                	je     800e59 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800df8:	83 ec 04             	sub    $0x4,%esp
+  800dfb:	ff 75 10             	push   0x10(%ebp)
+  800dfe:	ff 75 0c             	push   0xc(%ebp)
+  800e01:	56                   	push   %esi
+  800e02:	ff d0                	call   *%eax
+  800e04:	83 c4 10             	add    $0x10,%esp
+}
+  800e07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+  800e0e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800e10:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800e16:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800e1b:	77 18                	ja     800e35 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800e1d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800e22:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800e24:	c1 e8 10             	shr    $0x10,%eax
+  800e27:	74 0c                	je     800e35 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800e29:	c1 e0 10             	shl    $0x10,%eax
+  800e2c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800e31:	29 c2                	sub    %eax,%edx
+  800e33:	eb 06                	jmp    800e3b <read+0x8c>
+		return pthread_main_tls;
+  800e35:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e3b:	8b 02                	mov    (%edx),%eax
+  800e3d:	8b 40 48             	mov    0x48(%eax),%eax
+  800e40:	83 ec 04             	sub    $0x4,%esp
+  800e43:	53                   	push   %ebx
+  800e44:	50                   	push   %eax
+  800e45:	68 fd 47 80 00       	push   $0x8047fd
+  800e4a:	e8 6c 28 00 00       	call   8036bb <cprintf>
+		return -E_INVAL;
+  800e4f:	83 c4 10             	add    $0x10,%esp
+  800e52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e57:	eb ae                	jmp    800e07 <read+0x58>
+		return -E_NOT_SUPP;
+  800e59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e5e:	eb a7                	jmp    800e07 <read+0x58>
+
+00800e60 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  800e66:	83 ec 0c             	sub    $0xc,%esp
+  800e69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e6c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800e6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e74:	eb 02                	jmp    800e78 <readn+0x18>
+  800e76:	01 c3                	add    %eax,%ebx
+  800e78:	39 f3                	cmp    %esi,%ebx
+  800e7a:	73 21                	jae    800e9d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800e7c:	83 ec 04             	sub    $0x4,%esp
+  800e7f:	89 f0                	mov    %esi,%eax
+  800e81:	29 d8                	sub    %ebx,%eax
+  800e83:	50                   	push   %eax
+  800e84:	89 d8                	mov    %ebx,%eax
+  800e86:	03 45 0c             	add    0xc(%ebp),%eax
+  800e89:	50                   	push   %eax
+  800e8a:	57                   	push   %edi
+  800e8b:	e8 1f ff ff ff       	call   800daf <read>
+		if (m < 0)
+  800e90:	83 c4 10             	add    $0x10,%esp
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	78 04                	js     800e9b <readn+0x3b>
+			return m;
+		if (m == 0)
+  800e97:	75 dd                	jne    800e76 <readn+0x16>
+  800e99:	eb 02                	jmp    800e9d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800e9b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800e9d:	89 d8                	mov    %ebx,%eax
+  800e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+
+00800ea7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	83 ec 18             	sub    $0x18,%esp
+  800eaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800eb2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800eb5:	50                   	push   %eax
+  800eb6:	53                   	push   %ebx
+  800eb7:	e8 63 fc ff ff       	call   800b1f <fd_lookup>
+  800ebc:	83 c4 10             	add    $0x10,%esp
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	78 37                	js     800efa <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ec3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ec6:	83 ec 08             	sub    $0x8,%esp
+  800ec9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ecc:	50                   	push   %eax
+  800ecd:	ff 36                	push   (%esi)
+  800ecf:	e8 9b fc ff ff       	call   800b6f <dev_lookup>
+  800ed4:	83 c4 10             	add    $0x10,%esp
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	78 1f                	js     800efa <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800edb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800edf:	74 20                	je     800f01 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee4:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	74 61                	je     800f4c <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800eeb:	83 ec 04             	sub    $0x4,%esp
+  800eee:	ff 75 10             	push   0x10(%ebp)
+  800ef1:	ff 75 0c             	push   0xc(%ebp)
+  800ef4:	56                   	push   %esi
+  800ef5:	ff d0                	call   *%eax
+  800ef7:	83 c4 10             	add    $0x10,%esp
+}
+  800efa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+  800f01:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800f03:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800f09:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800f0e:	77 18                	ja     800f28 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800f10:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800f15:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800f17:	c1 e8 10             	shr    $0x10,%eax
+  800f1a:	74 0c                	je     800f28 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800f1c:	c1 e0 10             	shl    $0x10,%eax
+  800f1f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800f24:	29 c2                	sub    %eax,%edx
+  800f26:	eb 06                	jmp    800f2e <write+0x87>
+		return pthread_main_tls;
+  800f28:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f2e:	8b 02                	mov    (%edx),%eax
+  800f30:	8b 40 48             	mov    0x48(%eax),%eax
+  800f33:	83 ec 04             	sub    $0x4,%esp
+  800f36:	53                   	push   %ebx
+  800f37:	50                   	push   %eax
+  800f38:	68 19 48 80 00       	push   $0x804819
+  800f3d:	e8 79 27 00 00       	call   8036bb <cprintf>
+		return -E_INVAL;
+  800f42:	83 c4 10             	add    $0x10,%esp
+  800f45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f4a:	eb ae                	jmp    800efa <write+0x53>
+		return -E_NOT_SUPP;
+  800f4c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f51:	eb a7                	jmp    800efa <write+0x53>
+
+00800f53 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f5c:	50                   	push   %eax
+  800f5d:	ff 75 08             	push   0x8(%ebp)
+  800f60:	e8 ba fb ff ff       	call   800b1f <fd_lookup>
+  800f65:	83 c4 10             	add    $0x10,%esp
+  800f68:	85 c0                	test   %eax,%eax
+  800f6a:	78 0e                	js     800f7a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800f6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f72:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800f75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7a:	c9                   	leave
+  800f7b:	c3                   	ret
+
+00800f7c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 18             	sub    $0x18,%esp
+  800f84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800f87:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f8a:	50                   	push   %eax
+  800f8b:	53                   	push   %ebx
+  800f8c:	e8 8e fb ff ff       	call   800b1f <fd_lookup>
+  800f91:	83 c4 10             	add    $0x10,%esp
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	78 34                	js     800fcc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f98:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f9b:	83 ec 08             	sub    $0x8,%esp
+  800f9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fa1:	50                   	push   %eax
+  800fa2:	ff 36                	push   (%esi)
+  800fa4:	e8 c6 fb ff ff       	call   800b6f <dev_lookup>
+  800fa9:	83 c4 10             	add    $0x10,%esp
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	78 1c                	js     800fcc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800fb0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800fb4:	74 1d                	je     800fd3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800fb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800fb9:	8b 40 18             	mov    0x18(%eax),%eax
+  800fbc:	85 c0                	test   %eax,%eax
+  800fbe:	74 5e                	je     80101e <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800fc0:	83 ec 08             	sub    $0x8,%esp
+  800fc3:	ff 75 0c             	push   0xc(%ebp)
+  800fc6:	56                   	push   %esi
+  800fc7:	ff d0                	call   *%eax
+  800fc9:	83 c4 10             	add    $0x10,%esp
+}
+  800fcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+  800fd3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800fd5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800fdb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800fe0:	77 18                	ja     800ffa <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800fe2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800fe7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800fe9:	c1 e8 10             	shr    $0x10,%eax
+  800fec:	74 0c                	je     800ffa <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800fee:	c1 e0 10             	shl    $0x10,%eax
+  800ff1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800ff6:	29 c2                	sub    %eax,%edx
+  800ff8:	eb 06                	jmp    801000 <ftruncate+0x84>
+		return pthread_main_tls;
+  800ffa:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801000:	8b 02                	mov    (%edx),%eax
+  801002:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801005:	83 ec 04             	sub    $0x4,%esp
+  801008:	53                   	push   %ebx
+  801009:	50                   	push   %eax
+  80100a:	68 dc 47 80 00       	push   $0x8047dc
+  80100f:	e8 a7 26 00 00       	call   8036bb <cprintf>
+		return -E_INVAL;
+  801014:	83 c4 10             	add    $0x10,%esp
+  801017:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101c:	eb ae                	jmp    800fcc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80101e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801023:	eb a7                	jmp    800fcc <ftruncate+0x50>
+
+00801025 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	56                   	push   %esi
+  801029:	53                   	push   %ebx
+  80102a:	83 ec 18             	sub    $0x18,%esp
+  80102d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801030:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801033:	50                   	push   %eax
+  801034:	ff 75 08             	push   0x8(%ebp)
+  801037:	e8 e3 fa ff ff       	call   800b1f <fd_lookup>
+  80103c:	83 c4 10             	add    $0x10,%esp
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	78 49                	js     80108c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801043:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801046:	83 ec 08             	sub    $0x8,%esp
+  801049:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80104c:	50                   	push   %eax
+  80104d:	ff 36                	push   (%esi)
+  80104f:	e8 1b fb ff ff       	call   800b6f <dev_lookup>
+  801054:	83 c4 10             	add    $0x10,%esp
+  801057:	85 c0                	test   %eax,%eax
+  801059:	78 31                	js     80108c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80105b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80105e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801062:	74 2f                	je     801093 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801064:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801067:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80106e:	00 00 00 
+	stat->st_isdir = 0;
+  801071:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801078:	00 00 00 
+	stat->st_dev = dev;
+  80107b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801081:	83 ec 08             	sub    $0x8,%esp
+  801084:	53                   	push   %ebx
+  801085:	56                   	push   %esi
+  801086:	ff 50 14             	call   *0x14(%eax)
+  801089:	83 c4 10             	add    $0x10,%esp
+}
+  80108c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80108f:	5b                   	pop    %ebx
+  801090:	5e                   	pop    %esi
+  801091:	5d                   	pop    %ebp
+  801092:	c3                   	ret
+		return -E_NOT_SUPP;
+  801093:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801098:	eb f2                	jmp    80108c <fstat+0x67>
+
+0080109a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80109f:	83 ec 08             	sub    $0x8,%esp
+  8010a2:	6a 00                	push   $0x0
+  8010a4:	ff 75 08             	push   0x8(%ebp)
+  8010a7:	e8 4b 03 00 00       	call   8013f7 <open>
+  8010ac:	89 c3                	mov    %eax,%ebx
+  8010ae:	83 c4 10             	add    $0x10,%esp
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	78 1b                	js     8010d0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8010b5:	83 ec 08             	sub    $0x8,%esp
+  8010b8:	ff 75 0c             	push   0xc(%ebp)
+  8010bb:	50                   	push   %eax
+  8010bc:	e8 64 ff ff ff       	call   801025 <fstat>
+  8010c1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8010c3:	89 1c 24             	mov    %ebx,(%esp)
+  8010c6:	e8 a8 fb ff ff       	call   800c73 <close>
+	return r;
+  8010cb:	83 c4 10             	add    $0x10,%esp
+  8010ce:	89 f3                	mov    %esi,%ebx
+}
+  8010d0:	89 d8                	mov    %ebx,%eax
+  8010d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d5:	5b                   	pop    %ebx
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+
+008010d9 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	89 c6                	mov    %eax,%esi
+  8010e0:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8010e2:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8010e9:	74 27                	je     801112 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8010eb:	6a 07                	push   $0x7
+  8010ed:	68 00 70 80 00       	push   $0x807000
+  8010f2:	56                   	push   %esi
+  8010f3:	ff 35 00 60 80 00    	push   0x806000
+  8010f9:	e8 d2 32 00 00       	call   8043d0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8010fe:	83 c4 0c             	add    $0xc,%esp
+  801101:	6a 00                	push   $0x0
+  801103:	53                   	push   %ebx
+  801104:	6a 00                	push   $0x0
+  801106:	e8 cf 31 00 00       	call   8042da <ipc_recv>
+}
+  80110b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801112:	83 ec 0c             	sub    $0xc,%esp
+  801115:	6a 01                	push   $0x1
+  801117:	e8 0a 33 00 00       	call   804426 <ipc_find_env>
+  80111c:	a3 00 60 80 00       	mov    %eax,0x806000
+  801121:	83 c4 10             	add    $0x10,%esp
+  801124:	eb c5                	jmp    8010eb <fsipc+0x12>
+
+00801126 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80112d:	68 04 60 80 00       	push   $0x806004
+  801132:	e8 29 1b 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801137:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80113d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801142:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801145:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801154:	e8 80 ff ff ff       	call   8010d9 <fsipc>
+  801159:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80115b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801162:	e8 66 1b 00 00       	call   802ccd <mutex_unlock>
+	return r;
+}
+  801167:	89 d8                	mov    %ebx,%eax
+  801169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80116c:	c9                   	leave
+  80116d:	c3                   	ret
+
+0080116e <devfile_flush>:
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	53                   	push   %ebx
+  801172:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801175:	68 04 60 80 00       	push   $0x806004
+  80117a:	e8 e1 1a 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80117f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801182:	8b 40 0c             	mov    0xc(%eax),%eax
+  801185:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80118a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801194:	e8 40 ff ff ff       	call   8010d9 <fsipc>
+  801199:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80119b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8011a2:	e8 26 1b 00 00       	call   802ccd <mutex_unlock>
+}
+  8011a7:	89 d8                	mov    %ebx,%eax
+  8011a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ac:	c9                   	leave
+  8011ad:	c3                   	ret
+
+008011ae <devfile_stat>:
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	56                   	push   %esi
+  8011b2:	53                   	push   %ebx
+  8011b3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	68 04 60 80 00       	push   $0x806004
+  8011be:	e8 9d 1a 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8011c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011c9:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8011ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011d8:	e8 fc fe ff ff       	call   8010d9 <fsipc>
+  8011dd:	89 c3                	mov    %eax,%ebx
+  8011df:	83 c4 10             	add    $0x10,%esp
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	79 16                	jns    8011fc <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8011e6:	83 ec 0c             	sub    $0xc,%esp
+  8011e9:	68 04 60 80 00       	push   $0x806004
+  8011ee:	e8 da 1a 00 00       	call   802ccd <mutex_unlock>
+}
+  8011f3:	89 d8                	mov    %ebx,%eax
+  8011f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8011fc:	83 ec 08             	sub    $0x8,%esp
+  8011ff:	68 00 70 80 00       	push   $0x807000
+  801204:	56                   	push   %esi
+  801205:	e8 b8 ef ff ff       	call   8001c2 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80120a:	a1 80 70 80 00       	mov    0x807080,%eax
+  80120f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801215:	a1 84 70 80 00       	mov    0x807084,%eax
+  80121a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801220:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801228:	eb bc                	jmp    8011e6 <devfile_stat+0x38>
+
+0080122a <devfile_write>:
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	53                   	push   %ebx
+  80122e:	83 ec 10             	sub    $0x10,%esp
+  801231:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801234:	68 04 60 80 00       	push   $0x806004
+  801239:	e8 22 1a 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80123e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801241:	8b 40 0c             	mov    0xc(%eax),%eax
+  801244:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801252:	76 3d                	jbe    801291 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801254:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801259:	39 c3                	cmp    %eax,%ebx
+  80125b:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80125e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801261:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801266:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80126c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801271:	b8 04 00 00 00       	mov    $0x4,%eax
+  801276:	e8 5e fe ff ff       	call   8010d9 <fsipc>
+  80127b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	68 04 60 80 00       	push   $0x806004
+  801285:	e8 43 1a 00 00       	call   802ccd <mutex_unlock>
+}
+  80128a:	89 d8                	mov    %ebx,%eax
+  80128c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	53                   	push   %ebx
+  801295:	ff 75 0c             	push   0xc(%ebp)
+  801298:	68 0c 70 80 00       	push   $0x80700c
+  80129d:	e8 a6 f0 ff ff       	call   800348 <memmove>
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012aa:	eb b5                	jmp    801261 <devfile_write+0x37>
+
+008012ac <devfile_read>:
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012b8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8012bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8012be:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8012c4:	0f 86 8c 00 00 00    	jbe    801356 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8012ca:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8012cf:	39 c3                	cmp    %eax,%ebx
+  8012d1:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8012d4:	89 f8                	mov    %edi,%eax
+  8012d6:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8012d9:	eb 0f                	jmp    8012ea <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8012db:	0f b6 08             	movzbl (%eax),%ecx
+  8012de:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8012e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012e5:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8012ea:	39 d0                	cmp    %edx,%eax
+  8012ec:	72 ed                	jb     8012db <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8012ee:	83 ec 0c             	sub    $0xc,%esp
+  8012f1:	68 04 60 80 00       	push   $0x806004
+  8012f6:	e8 65 19 00 00       	call   802c60 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8012fb:	8b 46 0c             	mov    0xc(%esi),%eax
+  8012fe:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801303:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801309:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  80130f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801314:	b8 03 00 00 00       	mov    $0x3,%eax
+  801319:	e8 bb fd ff ff       	call   8010d9 <fsipc>
+  80131e:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801320:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801327:	e8 a1 19 00 00       	call   802ccd <mutex_unlock>
+		assert(r <= (int) n);
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	39 f3                	cmp    %esi,%ebx
+  801331:	7c 0a                	jl     80133d <devfile_read+0x91>
+}
+  801333:	89 f0                	mov    %esi,%eax
+  801335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801338:	5b                   	pop    %ebx
+  801339:	5e                   	pop    %esi
+  80133a:	5f                   	pop    %edi
+  80133b:	5d                   	pop    %ebp
+  80133c:	c3                   	ret
+		assert(r <= (int) n);
+  80133d:	68 4c 48 80 00       	push   $0x80484c
+  801342:	68 59 48 80 00       	push   $0x804859
+  801347:	68 90 00 00 00       	push   $0x90
+  80134c:	68 6e 48 80 00       	push   $0x80486e
+  801351:	e8 8a 22 00 00       	call   8035e0 <_panic>
+	mutex_lock(&fsipc_mu);
+  801356:	83 ec 0c             	sub    $0xc,%esp
+  801359:	68 04 60 80 00       	push   $0x806004
+  80135e:	e8 fd 18 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801363:	8b 46 0c             	mov    0xc(%esi),%eax
+  801366:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80136b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801371:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801378:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80137b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801380:	b8 03 00 00 00       	mov    $0x3,%eax
+  801385:	e8 4f fd ff ff       	call   8010d9 <fsipc>
+  80138a:	89 c6                	mov    %eax,%esi
+  80138c:	83 c4 10             	add    $0x10,%esp
+  80138f:	85 c0                	test   %eax,%eax
+  801391:	78 1d                	js     8013b0 <devfile_read+0x104>
+		assert(r <= n);
+  801393:	39 c3                	cmp    %eax,%ebx
+  801395:	72 2e                	jb     8013c5 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801397:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80139c:	7f 40                	jg     8013de <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80139e:	83 ec 04             	sub    $0x4,%esp
+  8013a1:	50                   	push   %eax
+  8013a2:	68 00 70 80 00       	push   $0x807000
+  8013a7:	57                   	push   %edi
+  8013a8:	e8 9b ef ff ff       	call   800348 <memmove>
+  8013ad:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	68 04 60 80 00       	push   $0x806004
+  8013b8:	e8 10 19 00 00       	call   802ccd <mutex_unlock>
+	return r;
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	e9 6e ff ff ff       	jmp    801333 <devfile_read+0x87>
+		assert(r <= n);
+  8013c5:	68 79 48 80 00       	push   $0x804879
+  8013ca:	68 59 48 80 00       	push   $0x804859
+  8013cf:	68 99 00 00 00       	push   $0x99
+  8013d4:	68 6e 48 80 00       	push   $0x80486e
+  8013d9:	e8 02 22 00 00       	call   8035e0 <_panic>
+		assert(r <= PGSIZE);
+  8013de:	68 80 48 80 00       	push   $0x804880
+  8013e3:	68 59 48 80 00       	push   $0x804859
+  8013e8:	68 9a 00 00 00       	push   $0x9a
+  8013ed:	68 6e 48 80 00       	push   $0x80486e
+  8013f2:	e8 e9 21 00 00       	call   8035e0 <_panic>
+
+008013f7 <open>:
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 1c             	sub    $0x1c,%esp
+  8013ff:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801402:	56                   	push   %esi
+  801403:	e8 7f ed ff ff       	call   800187 <strlen>
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801410:	0f 8f 85 00 00 00    	jg     80149b <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801416:	83 ec 0c             	sub    $0xc,%esp
+  801419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141c:	50                   	push   %eax
+  80141d:	e8 a7 f6 ff ff       	call   800ac9 <fd_alloc>
+  801422:	89 c3                	mov    %eax,%ebx
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 55                	js     801480 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+  80142e:	68 04 60 80 00       	push   $0x806004
+  801433:	e8 28 18 00 00       	call   802c60 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801438:	83 c4 08             	add    $0x8,%esp
+  80143b:	56                   	push   %esi
+  80143c:	68 00 70 80 00       	push   $0x807000
+  801441:	e8 7c ed ff ff       	call   8001c2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801446:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801449:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  80144e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801451:	b8 01 00 00 00       	mov    $0x1,%eax
+  801456:	e8 7e fc ff ff       	call   8010d9 <fsipc>
+  80145b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80145d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801464:	e8 64 18 00 00       	call   802ccd <mutex_unlock>
+	if (r < 0) {
+  801469:	83 c4 10             	add    $0x10,%esp
+  80146c:	85 db                	test   %ebx,%ebx
+  80146e:	78 19                	js     801489 <open+0x92>
+	return fd2num(fd);
+  801470:	83 ec 0c             	sub    $0xc,%esp
+  801473:	ff 75 f4             	push   -0xc(%ebp)
+  801476:	e8 27 f6 ff ff       	call   800aa2 <fd2num>
+  80147b:	89 c3                	mov    %eax,%ebx
+  80147d:	83 c4 10             	add    $0x10,%esp
+}
+  801480:	89 d8                	mov    %ebx,%eax
+  801482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5d                   	pop    %ebp
+  801488:	c3                   	ret
+		fd_close(fd, 0);
+  801489:	83 ec 08             	sub    $0x8,%esp
+  80148c:	6a 00                	push   $0x0
+  80148e:	ff 75 f4             	push   -0xc(%ebp)
+  801491:	e8 56 f7 ff ff       	call   800bec <fd_close>
+		return r;
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	eb e5                	jmp    801480 <open+0x89>
+		return -E_BAD_PATH;
+  80149b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8014a0:	eb de                	jmp    801480 <open+0x89>
+
+008014a2 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	53                   	push   %ebx
+  8014a6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ac:	50                   	push   %eax
+  8014ad:	ff 75 08             	push   0x8(%ebp)
+  8014b0:	e8 6a f6 ff ff       	call   800b1f <fd_lookup>
+  8014b5:	89 c3                	mov    %eax,%ebx
+  8014b7:	83 c4 10             	add    $0x10,%esp
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	78 5b                	js     801519 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8014be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014c1:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8014c7:	39 08                	cmp    %ecx,(%eax)
+  8014c9:	75 55                	jne    801520 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8014cb:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8014cf:	74 56                	je     801527 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8014d1:	83 ec 0c             	sub    $0xc,%esp
+  8014d4:	68 04 60 80 00       	push   $0x806004
+  8014d9:	e8 82 17 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8014de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014e4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8014e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ec:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8014f1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8014f4:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8014f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801503:	e8 d1 fb ff ff       	call   8010d9 <fsipc>
+  801508:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80150a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801511:	e8 b7 17 00 00       	call   802ccd <mutex_unlock>
+	return r;
+  801516:	83 c4 10             	add    $0x10,%esp
+}
+  801519:	89 d8                	mov    %ebx,%eax
+  80151b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151e:	c9                   	leave
+  80151f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801520:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801525:	eb f2                	jmp    801519 <fallocate+0x77>
+		return -E_INVAL;
+  801527:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80152c:	eb eb                	jmp    801519 <fallocate+0x77>
+
+0080152e <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801536:	89 f3                	mov    %esi,%ebx
+  801538:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80153e:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801541:	eb 06                	jmp    801549 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801543:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801549:	39 f3                	cmp    %esi,%ebx
+  80154b:	73 14                	jae    801561 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80154d:	83 ec 08             	sub    $0x8,%esp
+  801550:	53                   	push   %ebx
+  801551:	6a 00                	push   $0x0
+  801553:	e8 41 f1 ff ff       	call   800699 <sys_page_unmap>
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	79 e4                	jns    801543 <munmap+0x15>
+  80155f:	eb 05                	jmp    801566 <munmap+0x38>
+			return r;
+	return 0;
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801566:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801569:	5b                   	pop    %ebx
+  80156a:	5e                   	pop    %esi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+
+0080156d <mmap>:
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+  801573:	83 ec 24             	sub    $0x24,%esp
+  801576:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801579:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157c:	50                   	push   %eax
+  80157d:	ff 75 08             	push   0x8(%ebp)
+  801580:	e8 9a f5 ff ff       	call   800b1f <fd_lookup>
+  801585:	83 c4 10             	add    $0x10,%esp
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	0f 88 37 01 00 00    	js     8016c7 <mmap+0x15a>
+		return NULL;
+  801590:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801595:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801598:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80159e:	39 0a                	cmp    %ecx,(%edx)
+  8015a0:	0f 85 05 01 00 00    	jne    8016ab <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8015a6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8015ad:	0f 85 1b 01 00 00    	jne    8016ce <mmap+0x161>
+  8015b3:	89 f0                	mov    %esi,%eax
+  8015b5:	83 e8 01             	sub    $0x1,%eax
+  8015b8:	0f 88 17 01 00 00    	js     8016d5 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8015be:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8015c2:	75 28                	jne    8015ec <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8015c4:	83 ec 0c             	sub    $0xc,%esp
+  8015c7:	68 04 60 80 00       	push   $0x806004
+  8015cc:	e8 8f 16 00 00       	call   802c60 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8015d1:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8015d7:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8015dd:	83 c4 10             	add    $0x10,%esp
+  8015e0:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8015e5:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8015ea:	eb 2b                	jmp    801617 <mmap+0xaa>
+		cow_enable();
+  8015ec:	e8 78 28 00 00       	call   803e69 <cow_enable>
+  8015f1:	eb d1                	jmp    8015c4 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8015f3:	89 c2                	mov    %eax,%edx
+  8015f5:	c1 ea 0c             	shr    $0xc,%edx
+  8015f8:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8015ff:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801605:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80160b:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80160e:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801610:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801615:	77 25                	ja     80163c <mmap+0xcf>
+  801617:	89 c2                	mov    %eax,%edx
+  801619:	29 da                	sub    %ebx,%edx
+  80161b:	39 ca                	cmp    %ecx,%edx
+  80161d:	73 3a                	jae    801659 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80161f:	89 c2                	mov    %eax,%edx
+  801621:	c1 ea 16             	shr    $0x16,%edx
+  801624:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80162b:	f6 c2 01             	test   $0x1,%dl
+  80162e:	75 c3                	jne    8015f3 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801630:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801635:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80163a:	eb d4                	jmp    801610 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80163c:	29 d8                	sub    %ebx,%eax
+  80163e:	39 c8                	cmp    %ecx,%eax
+  801640:	73 17                	jae    801659 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801642:	83 ec 0c             	sub    $0xc,%esp
+  801645:	68 04 60 80 00       	push   $0x806004
+  80164a:	e8 7e 16 00 00       	call   802ccd <mutex_unlock>
+		return NULL;
+  80164f:	83 c4 10             	add    $0x10,%esp
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+  801657:	eb 52                	jmp    8016ab <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801659:	85 db                	test   %ebx,%ebx
+  80165b:	74 e5                	je     801642 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80165d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801660:	8b 40 0c             	mov    0xc(%eax),%eax
+  801663:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801668:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80166b:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801670:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801676:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  80167c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80167f:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801684:	ba 00 00 00 00       	mov    $0x0,%edx
+  801689:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80168e:	e8 46 fa ff ff       	call   8010d9 <fsipc>
+  801693:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801695:	83 ec 0c             	sub    $0xc,%esp
+  801698:	68 04 60 80 00       	push   $0x806004
+  80169d:	e8 2b 16 00 00       	call   802ccd <mutex_unlock>
+	if (r < 0) {
+  8016a2:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8016a5:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8016a7:	85 ff                	test   %edi,%edi
+  8016a9:	78 08                	js     8016b3 <mmap+0x146>
+}
+  8016ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ae:	5b                   	pop    %ebx
+  8016af:	5e                   	pop    %esi
+  8016b0:	5f                   	pop    %edi
+  8016b1:	5d                   	pop    %ebp
+  8016b2:	c3                   	ret
+		munmap((void*) va, len);
+  8016b3:	83 ec 08             	sub    $0x8,%esp
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	e8 71 fe ff ff       	call   80152e <munmap>
+		return NULL;
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c5:	eb e4                	jmp    8016ab <mmap+0x13e>
+		return NULL;
+  8016c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cc:	eb dd                	jmp    8016ab <mmap+0x13e>
+		return NULL;
+  8016ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d3:	eb d6                	jmp    8016ab <mmap+0x13e>
+  8016d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016da:	eb cf                	jmp    8016ab <mmap+0x13e>
+
+008016dc <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	53                   	push   %ebx
+  8016e0:	83 ec 10             	sub    $0x10,%esp
+  8016e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8016e6:	53                   	push   %ebx
+  8016e7:	e8 9b ea ff ff       	call   800187 <strlen>
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8016f4:	7f 42                	jg     801738 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	68 04 60 80 00       	push   $0x806004
+  8016fe:	e8 5d 15 00 00       	call   802c60 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801703:	83 c4 08             	add    $0x8,%esp
+  801706:	53                   	push   %ebx
+  801707:	68 00 70 80 00       	push   $0x807000
+  80170c:	e8 b1 ea ff ff       	call   8001c2 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801711:	ba 00 00 00 00       	mov    $0x0,%edx
+  801716:	b8 07 00 00 00       	mov    $0x7,%eax
+  80171b:	e8 b9 f9 ff ff       	call   8010d9 <fsipc>
+  801720:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801722:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801729:	e8 9f 15 00 00       	call   802ccd <mutex_unlock>
+	return r;
+  80172e:	83 c4 10             	add    $0x10,%esp
+}
+  801731:	89 d8                	mov    %ebx,%eax
+  801733:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+		return -E_BAD_PATH;
+  801738:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80173d:	eb f2                	jmp    801731 <remove+0x55>
+
+0080173f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80173f:	55                   	push   %ebp
+  801740:	89 e5                	mov    %esp,%ebp
+  801742:	53                   	push   %ebx
+  801743:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801746:	68 04 60 80 00       	push   $0x806004
+  80174b:	e8 10 15 00 00       	call   802c60 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801750:	ba 00 00 00 00       	mov    $0x0,%edx
+  801755:	b8 08 00 00 00       	mov    $0x8,%eax
+  80175a:	e8 7a f9 ff ff       	call   8010d9 <fsipc>
+  80175f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801761:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801768:	e8 60 15 00 00       	call   802ccd <mutex_unlock>
+	return r;
+}
+  80176d:	89 d8                	mov    %ebx,%eax
+  80176f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801772:	c9                   	leave
+  801773:	c3                   	ret
+
+00801774 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801774:	55                   	push   %ebp
+  801775:	89 e5                	mov    %esp,%ebp
+  801777:	56                   	push   %esi
+  801778:	53                   	push   %ebx
+  801779:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80177c:	83 ec 0c             	sub    $0xc,%esp
+  80177f:	68 04 60 80 00       	push   $0x806004
+  801784:	e8 d7 14 00 00       	call   802c60 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801789:	8b 45 08             	mov    0x8(%ebp),%eax
+  80178c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801791:	ba 00 00 00 00       	mov    $0x0,%edx
+  801796:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80179b:	e8 39 f9 ff ff       	call   8010d9 <fsipc>
+  8017a0:	89 c6                	mov    %eax,%esi
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 db                	test   %ebx,%ebx
+  8017a7:	74 7b                	je     801824 <fs_bcstat+0xb0>
+  8017a9:	85 c0                	test   %eax,%eax
+  8017ab:	78 77                	js     801824 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8017ad:	a1 00 70 80 00       	mov    0x807000,%eax
+  8017b2:	89 03                	mov    %eax,(%ebx)
+  8017b4:	a1 04 70 80 00       	mov    0x807004,%eax
+  8017b9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8017bc:	a1 08 70 80 00       	mov    0x807008,%eax
+  8017c1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8017c4:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8017c9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8017cc:	a1 10 70 80 00       	mov    0x807010,%eax
+  8017d1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8017d4:	a1 14 70 80 00       	mov    0x807014,%eax
+  8017d9:	89 43 14             	mov    %eax,0x14(%ebx)
+  8017dc:	a1 18 70 80 00       	mov    0x807018,%eax
+  8017e1:	89 43 18             	mov    %eax,0x18(%ebx)
+  8017e4:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8017e9:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8017ec:	a1 20 70 80 00       	mov    0x807020,%eax
+  8017f1:	89 43 20             	mov    %eax,0x20(%ebx)
+  8017f4:	a1 24 70 80 00       	mov    0x807024,%eax
+  8017f9:	89 43 24             	mov    %eax,0x24(%ebx)
+  8017fc:	a1 28 70 80 00       	mov    0x807028,%eax
+  801801:	89 43 28             	mov    %eax,0x28(%ebx)
+  801804:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801809:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80180c:	a1 30 70 80 00       	mov    0x807030,%eax
+  801811:	89 43 30             	mov    %eax,0x30(%ebx)
+  801814:	a1 34 70 80 00       	mov    0x807034,%eax
+  801819:	89 43 34             	mov    %eax,0x34(%ebx)
+  80181c:	a1 38 70 80 00       	mov    0x807038,%eax
+  801821:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801824:	83 ec 0c             	sub    $0xc,%esp
+  801827:	68 04 60 80 00       	push   $0x806004
+  80182c:	e8 9c 14 00 00       	call   802ccd <mutex_unlock>
+	return r;
+}
+  801831:	89 f0                	mov    %esi,%eax
+  801833:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801836:	5b                   	pop    %ebx
+  801837:	5e                   	pop    %esi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+
+0080183a <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	56                   	push   %esi
+  80183e:	53                   	push   %ebx
+  80183f:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801841:	0f b6 10             	movzbl (%eax),%edx
+  801844:	80 fa 72             	cmp    $0x72,%dl
+  801847:	74 44                	je     80188d <parse_mode+0x53>
+  801849:	80 fa 77             	cmp    $0x77,%dl
+  80184c:	74 4b                	je     801899 <parse_mode+0x5f>
+  80184e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801853:	80 fa 61             	cmp    $0x61,%dl
+  801856:	74 09                	je     801861 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801858:	89 d8                	mov    %ebx,%eax
+  80185a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185d:	5b                   	pop    %ebx
+  80185e:	5e                   	pop    %esi
+  80185f:	5d                   	pop    %ebp
+  801860:	c3                   	ret
+	switch (mode[0]) {
+  801861:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801866:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80186b:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80186d:	83 ec 08             	sub    $0x8,%esp
+  801870:	6a 2b                	push   $0x2b
+  801872:	50                   	push   %eax
+  801873:	e8 5c ea ff ff       	call   8002d4 <strchr>
+  801878:	83 c4 10             	add    $0x10,%esp
+  80187b:	85 c0                	test   %eax,%eax
+  80187d:	74 d9                	je     801858 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80187f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801882:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801885:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80188b:	eb cb                	jmp    801858 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80188d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801897:	eb d2                	jmp    80186b <parse_mode+0x31>
+  801899:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80189e:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8018a3:	eb c6                	jmp    80186b <parse_mode+0x31>
+
+008018a5 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	57                   	push   %edi
+  8018a9:	56                   	push   %esi
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 1c             	sub    $0x1c,%esp
+  8018ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8018b1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8018b4:	b8 24 50 80 00       	mov    $0x805024,%eax
+  8018b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8018be:	83 c0 24             	add    $0x24,%eax
+  8018c1:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8018c5:	74 17                	je     8018de <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8018c7:	83 c3 01             	add    $0x1,%ebx
+  8018ca:	83 fb 10             	cmp    $0x10,%ebx
+  8018cd:	75 ef                	jne    8018be <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8018cf:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8018d4:	89 f0                	mov    %esi,%eax
+  8018d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d9:	5b                   	pop    %ebx
+  8018da:	5e                   	pop    %esi
+  8018db:	5f                   	pop    %edi
+  8018dc:	5d                   	pop    %ebp
+  8018dd:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8018de:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8018e5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8018e8:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8018eb:	c1 e7 02             	shl    $0x2,%edi
+  8018ee:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8018f4:	83 ec 04             	sub    $0x4,%esp
+  8018f7:	6a 24                	push   $0x24
+  8018f9:	6a 00                	push   $0x0
+  8018fb:	56                   	push   %esi
+  8018fc:	e8 12 ea ff ff       	call   800313 <memset>
+			streams[i].f_fd = fd;
+  801901:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801904:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  80190a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80190d:	01 d8                	add    %ebx,%eax
+  80190f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801912:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801919:	83 c4 10             	add    $0x10,%esp
+  80191c:	eb b6                	jmp    8018d4 <stream_alloc+0x2f>
+
+0080191e <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	53                   	push   %ebx
+  801922:	83 ec 14             	sub    $0x14,%esp
+  801925:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801927:	8b 40 18             	mov    0x18(%eax),%eax
+  80192a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80192d:	74 4a                	je     801979 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80192f:	83 ec 08             	sub    $0x8,%esp
+  801932:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	ff 33                	push   (%ebx)
+  801938:	e8 e2 f1 ff ff       	call   800b1f <fd_lookup>
+  80193d:	89 c2                	mov    %eax,%edx
+  80193f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801947:	85 d2                	test   %edx,%edx
+  801949:	78 41                	js     80198c <stream_unread+0x6e>
+  80194b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80194e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801954:	39 0a                	cmp    %ecx,(%edx)
+  801956:	75 34                	jne    80198c <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801958:	8b 43 14             	mov    0x14(%ebx),%eax
+  80195b:	03 42 04             	add    0x4(%edx),%eax
+  80195e:	2b 43 18             	sub    0x18(%ebx),%eax
+  801961:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801964:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80196b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801972:	b8 01 00 00 00       	mov    $0x1,%eax
+  801977:	eb 13                	jmp    80198c <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801979:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801980:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801987:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80198c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80198f:	c9                   	leave
+  801990:	c3                   	ret
+
+00801991 <stream_drain>:
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	56                   	push   %esi
+  801995:	53                   	push   %ebx
+  801996:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801998:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80199d:	eb 02                	jmp    8019a1 <stream_drain+0x10>
+  80199f:	01 c3                	add    %eax,%ebx
+  8019a1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8019a4:	39 c3                	cmp    %eax,%ebx
+  8019a6:	73 43                	jae    8019eb <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8019a8:	83 ec 04             	sub    $0x4,%esp
+  8019ab:	29 d8                	sub    %ebx,%eax
+  8019ad:	50                   	push   %eax
+  8019ae:	89 d8                	mov    %ebx,%eax
+  8019b0:	03 46 0c             	add    0xc(%esi),%eax
+  8019b3:	50                   	push   %eax
+  8019b4:	ff 36                	push   (%esi)
+  8019b6:	e8 ec f4 ff ff       	call   800ea7 <write>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	7f dd                	jg     80199f <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8019c2:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8019c6:	8b 56 0c             	mov    0xc(%esi),%edx
+  8019c9:	83 ec 04             	sub    $0x4,%esp
+  8019cc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8019cf:	29 d8                	sub    %ebx,%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8019d5:	50                   	push   %eax
+  8019d6:	52                   	push   %edx
+  8019d7:	e8 6c e9 ff ff       	call   800348 <memmove>
+			f->f_wend -= done;
+  8019dc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8019df:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8019e1:	83 c4 10             	add    $0x10,%esp
+  8019e4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8019e9:	eb 0a                	jmp    8019f5 <stream_drain+0x64>
+  8019eb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8019f0:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8019f5:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8019f8:	89 d0                	mov    %edx,%eax
+  8019fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019fd:	5b                   	pop    %ebx
+  8019fe:	5e                   	pop    %esi
+  8019ff:	5d                   	pop    %ebp
+  801a00:	c3                   	ret
+
+00801a01 <stream_setup>:
+	if (f->f_buf)
+  801a01:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801a05:	74 01                	je     801a08 <stream_setup+0x7>
+  801a07:	c3                   	ret
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	53                   	push   %ebx
+  801a0c:	83 ec 04             	sub    $0x4,%esp
+  801a0f:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801a11:	8b 40 08             	mov    0x8(%eax),%eax
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	74 17                	je     801a2f <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801a18:	83 f8 03             	cmp    $0x3,%eax
+  801a1b:	75 2d                	jne    801a4a <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801a1d:	8d 43 20             	lea    0x20(%ebx),%eax
+  801a20:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801a23:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801a2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801a2f:	83 ec 0c             	sub    $0xc,%esp
+  801a32:	ff 33                	push   (%ebx)
+  801a34:	e8 29 1b 00 00       	call   803562 <iscons>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	0f 9f c0             	setg   %al
+  801a41:	0f b6 c0             	movzbl %al,%eax
+  801a44:	83 c0 01             	add    $0x1,%eax
+  801a47:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801a4a:	83 ec 0c             	sub    $0xc,%esp
+  801a4d:	68 00 10 00 00       	push   $0x1000
+  801a52:	e8 6e 0b 00 00       	call   8025c5 <malloc>
+  801a57:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801a5a:	83 c4 10             	add    $0x10,%esp
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	74 bc                	je     801a1d <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801a61:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  801a68:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801a6c:	eb bc                	jmp    801a2a <stream_setup+0x29>
+
+00801a6e <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801a6e:	55                   	push   %ebp
+  801a6f:	89 e5                	mov    %esp,%ebp
+  801a71:	53                   	push   %ebx
+  801a72:	83 ec 04             	sub    $0x4,%esp
+  801a75:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  801a77:	e8 85 ff ff ff       	call   801a01 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801a81:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801a85:	74 3d                	je     801ac4 <stream_fill+0x56>
+  801a87:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801a8b:	74 10                	je     801a9d <stream_fill+0x2f>
+  801a8d:	89 d8                	mov    %ebx,%eax
+  801a8f:	e8 fd fe ff ff       	call   801991 <stream_drain>
+		return 0;
+  801a94:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	78 27                	js     801ac4 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801a9d:	83 ec 04             	sub    $0x4,%esp
+  801aa0:	ff 73 10             	push   0x10(%ebx)
+  801aa3:	ff 73 0c             	push   0xc(%ebx)
+  801aa6:	ff 33                	push   (%ebx)
+  801aa8:	e8 02 f3 ff ff       	call   800daf <read>
+  801aad:	83 c4 10             	add    $0x10,%esp
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	7e 17                	jle    801acb <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  801ab4:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  801ab8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  801abf:	89 c2                	mov    %eax,%edx
+  801ac1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  801ac4:	89 d0                	mov    %edx,%eax
+  801ac6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac9:	c9                   	leave
+  801aca:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801acb:	c1 f8 1f             	sar    $0x1f,%eax
+  801ace:	83 e0 04             	and    $0x4,%eax
+  801ad1:	83 c0 04             	add    $0x4,%eax
+  801ad4:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  801ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adc:	eb e6                	jmp    801ac4 <stream_fill+0x56>
+
+00801ade <fopen>:
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	57                   	push   %edi
+  801ae2:	56                   	push   %esi
+  801ae3:	53                   	push   %ebx
+  801ae4:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  801aea:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  801aed:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  801af3:	89 f0                	mov    %esi,%eax
+  801af5:	e8 40 fd ff ff       	call   80183a <parse_mode>
+		return 0;
+  801afa:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  801aff:	85 c0                	test   %eax,%eax
+  801b01:	78 2d                	js     801b30 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  801b03:	83 ec 08             	sub    $0x8,%esp
+  801b06:	50                   	push   %eax
+  801b07:	ff 75 08             	push   0x8(%ebp)
+  801b0a:	e8 e8 f8 ff ff       	call   8013f7 <open>
+  801b0f:	89 c7                	mov    %eax,%edi
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 58                	js     801b70 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801b18:	80 3e 61             	cmpb   $0x61,(%esi)
+  801b1b:	74 1d                	je     801b3a <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  801b1d:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  801b23:	89 f8                	mov    %edi,%eax
+  801b25:	e8 7b fd ff ff       	call   8018a5 <stream_alloc>
+  801b2a:	89 c3                	mov    %eax,%ebx
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	74 32                	je     801b62 <fopen+0x84>
+}
+  801b30:	89 d8                	mov    %ebx,%eax
+  801b32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b35:	5b                   	pop    %ebx
+  801b36:	5e                   	pop    %esi
+  801b37:	5f                   	pop    %edi
+  801b38:	5d                   	pop    %ebp
+  801b39:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801b3a:	83 ec 08             	sub    $0x8,%esp
+  801b3d:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801b43:	50                   	push   %eax
+  801b44:	57                   	push   %edi
+  801b45:	e8 db f4 ff ff       	call   801025 <fstat>
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 cc                	js     801b1d <fopen+0x3f>
+		seek(fd, st.st_size);
+  801b51:	83 ec 08             	sub    $0x8,%esp
+  801b54:	ff 75 dc             	push   -0x24(%ebp)
+  801b57:	57                   	push   %edi
+  801b58:	e8 f6 f3 ff ff       	call   800f53 <seek>
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	eb bb                	jmp    801b1d <fopen+0x3f>
+		close(fd);
+  801b62:	83 ec 0c             	sub    $0xc,%esp
+  801b65:	57                   	push   %edi
+  801b66:	e8 08 f1 ff ff       	call   800c73 <close>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	eb c0                	jmp    801b30 <fopen+0x52>
+		return 0;
+  801b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b75:	eb b9                	jmp    801b30 <fopen+0x52>
+
+00801b77 <fdopen>:
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801b7d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b83:	e8 b2 fc ff ff       	call   80183a <parse_mode>
+  801b88:	89 c2                	mov    %eax,%edx
+		return 0;
+  801b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801b8f:	85 d2                	test   %edx,%edx
+  801b91:	78 0b                	js     801b9e <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  801b93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b99:	e8 07 fd ff ff       	call   8018a5 <stream_alloc>
+}
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+
+00801ba0 <setvbuf>:
+{
+  801ba0:	55                   	push   %ebp
+  801ba1:	89 e5                	mov    %esp,%ebp
+  801ba3:	57                   	push   %edi
+  801ba4:	56                   	push   %esi
+  801ba5:	53                   	push   %ebx
+  801ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba9:	8b 55 10             	mov    0x10(%ebp),%edx
+  801bac:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801baf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801bb3:	75 3a                	jne    801bef <setvbuf+0x4f>
+  801bb5:	8d 72 ff             	lea    -0x1(%edx),%esi
+  801bb8:	83 fe 02             	cmp    $0x2,%esi
+  801bbb:	77 39                	ja     801bf6 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  801bbd:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  801bc0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801bc4:	0f 95 c3             	setne  %bl
+  801bc7:	85 ff                	test   %edi,%edi
+  801bc9:	0f 95 c1             	setne  %cl
+  801bcc:	84 cb                	test   %cl,%bl
+  801bce:	74 05                	je     801bd5 <setvbuf+0x35>
+  801bd0:	83 fa 03             	cmp    $0x3,%edx
+  801bd3:	75 0a                	jne    801bdf <setvbuf+0x3f>
+	return 0;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bda:	5b                   	pop    %ebx
+  801bdb:	5e                   	pop    %esi
+  801bdc:	5f                   	pop    %edi
+  801bdd:	5d                   	pop    %ebp
+  801bde:	c3                   	ret
+		f->f_buf = buf;
+  801bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801be2:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  801be5:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  801be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bed:	eb eb                	jmp    801bda <setvbuf+0x3a>
+		return EOF;
+  801bef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bf4:	eb e4                	jmp    801bda <setvbuf+0x3a>
+  801bf6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bfb:	eb dd                	jmp    801bda <setvbuf+0x3a>
+
+00801bfd <fflush>:
+{
+  801bfd:	55                   	push   %ebp
+  801bfe:	89 e5                	mov    %esp,%ebp
+  801c00:	57                   	push   %edi
+  801c01:	56                   	push   %esi
+  801c02:	53                   	push   %ebx
+  801c03:	83 ec 0c             	sub    $0xc,%esp
+  801c06:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  801c09:	85 db                	test   %ebx,%ebx
+  801c0b:	74 1a                	je     801c27 <fflush+0x2a>
+	stream_unread(f);
+  801c0d:	89 d8                	mov    %ebx,%eax
+  801c0f:	e8 0a fd ff ff       	call   80191e <stream_unread>
+	return stream_drain(f);
+  801c14:	89 d8                	mov    %ebx,%eax
+  801c16:	e8 76 fd ff ff       	call   801991 <stream_drain>
+  801c1b:	89 c7                	mov    %eax,%edi
+}
+  801c1d:	89 f8                	mov    %edi,%eax
+  801c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c22:	5b                   	pop    %ebx
+  801c23:	5e                   	pop    %esi
+  801c24:	5f                   	pop    %edi
+  801c25:	5d                   	pop    %ebp
+  801c26:	c3                   	ret
+  801c27:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801c2c:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801c31:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c36:	eb 03                	jmp    801c3b <fflush+0x3e>
+  801c38:	83 c3 24             	add    $0x24,%ebx
+  801c3b:	39 f3                	cmp    %esi,%ebx
+  801c3d:	74 de                	je     801c1d <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801c3f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  801c43:	74 f3                	je     801c38 <fflush+0x3b>
+  801c45:	83 ec 0c             	sub    $0xc,%esp
+  801c48:	53                   	push   %ebx
+  801c49:	e8 af ff ff ff       	call   801bfd <fflush>
+  801c4e:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c58:	0f 48 f8             	cmovs  %eax,%edi
+  801c5b:	eb db                	jmp    801c38 <fflush+0x3b>
+
+00801c5d <fclose>:
+{
+  801c5d:	55                   	push   %ebp
+  801c5e:	89 e5                	mov    %esp,%ebp
+  801c60:	56                   	push   %esi
+  801c61:	53                   	push   %ebx
+  801c62:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801c65:	83 ec 0c             	sub    $0xc,%esp
+  801c68:	56                   	push   %esi
+  801c69:	e8 8f ff ff ff       	call   801bfd <fflush>
+  801c6e:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801c70:	83 c4 04             	add    $0x4,%esp
+  801c73:	ff 36                	push   (%esi)
+  801c75:	e8 f9 ef ff ff       	call   800c73 <close>
+  801c7a:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c84:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  801c87:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  801c8b:	75 10                	jne    801c9d <fclose+0x40>
+	f->f_flags = 0;
+  801c8d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  801c94:	89 d8                	mov    %ebx,%eax
+  801c96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c99:	5b                   	pop    %ebx
+  801c9a:	5e                   	pop    %esi
+  801c9b:	5d                   	pop    %ebp
+  801c9c:	c3                   	ret
+		free(f->f_buf);
+  801c9d:	83 ec 0c             	sub    $0xc,%esp
+  801ca0:	ff 76 0c             	push   0xc(%esi)
+  801ca3:	e8 54 08 00 00       	call   8024fc <free>
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	eb e0                	jmp    801c8d <fclose+0x30>
+
+00801cad <fileno>:
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb3:	8b 00                	mov    (%eax),%eax
+}
+  801cb5:	5d                   	pop    %ebp
+  801cb6:	c3                   	ret
+
+00801cb7 <feof>:
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  801cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbd:	8b 40 04             	mov    0x4(%eax),%eax
+  801cc0:	c1 e8 02             	shr    $0x2,%eax
+  801cc3:	83 e0 01             	and    $0x1,%eax
+}
+  801cc6:	5d                   	pop    %ebp
+  801cc7:	c3                   	ret
+
+00801cc8 <ferror>:
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  801ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cce:	8b 40 04             	mov    0x4(%eax),%eax
+  801cd1:	c1 e8 03             	shr    $0x3,%eax
+  801cd4:	83 e0 01             	and    $0x1,%eax
+}
+  801cd7:	5d                   	pop    %ebp
+  801cd8:	c3                   	ret
+
+00801cd9 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	53                   	push   %ebx
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801ce3:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ce6:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801ce9:	74 15                	je     801d00 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  801ceb:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801cee:	8b 43 14             	mov    0x14(%ebx),%eax
+  801cf1:	8d 48 01             	lea    0x1(%eax),%ecx
+  801cf4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  801cf7:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  801cfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cfe:	c9                   	leave
+  801cff:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	e8 67 fd ff ff       	call   801a6e <stream_fill>
+  801d07:	85 c0                	test   %eax,%eax
+  801d09:	75 e0                	jne    801ceb <fgetc+0x12>
+		return EOF;
+  801d0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d10:	eb e9                	jmp    801cfb <fgetc+0x22>
+
+00801d12 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+  801d15:	57                   	push   %edi
+  801d16:	56                   	push   %esi
+  801d17:	53                   	push   %ebx
+  801d18:	83 ec 1c             	sub    $0x1c,%esp
+  801d1b:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801d23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d26:	83 e8 01             	sub    $0x1,%eax
+  801d29:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801d2c:	eb 66                	jmp    801d94 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801d2e:	8b 46 14             	mov    0x14(%esi),%eax
+  801d31:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801d34:	29 c3                	sub    %eax,%ebx
+  801d36:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801d39:	29 fa                	sub    %edi,%edx
+  801d3b:	39 d3                	cmp    %edx,%ebx
+  801d3d:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801d40:	83 ec 04             	sub    $0x4,%esp
+  801d43:	53                   	push   %ebx
+  801d44:	6a 0a                	push   $0xa
+  801d46:	03 46 0c             	add    0xc(%esi),%eax
+  801d49:	50                   	push   %eax
+  801d4a:	e8 aa e6 ff ff       	call   8003f9 <memfind>
+  801d4f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801d52:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d55:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801d58:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801d5b:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  801d63:	74 0b                	je     801d70 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801d65:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d68:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801d6b:	29 d3                	sub    %edx,%ebx
+  801d6d:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801d70:	83 ec 04             	sub    $0x4,%esp
+  801d73:	53                   	push   %ebx
+  801d74:	01 c8                	add    %ecx,%eax
+  801d76:	50                   	push   %eax
+  801d77:	89 f8                	mov    %edi,%eax
+  801d79:	03 45 08             	add    0x8(%ebp),%eax
+  801d7c:	50                   	push   %eax
+  801d7d:	e8 c6 e5 ff ff       	call   800348 <memmove>
+		f->f_rpos += m;
+  801d82:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801d85:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8d:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801d92:	74 1f                	je     801db3 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  801d94:	8d 47 01             	lea    0x1(%edi),%eax
+  801d97:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801d9a:	73 17                	jae    801db3 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801d9c:	8b 46 18             	mov    0x18(%esi),%eax
+  801d9f:	39 46 14             	cmp    %eax,0x14(%esi)
+  801da2:	75 8a                	jne    801d2e <fgets+0x1c>
+  801da4:	89 f0                	mov    %esi,%eax
+  801da6:	e8 c3 fc ff ff       	call   801a6e <stream_fill>
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	0f 85 7b ff ff ff    	jne    801d2e <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  801db3:	85 ff                	test   %edi,%edi
+  801db5:	74 0f                	je     801dc6 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  801db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dba:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  801dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc1:	5b                   	pop    %ebx
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5f                   	pop    %edi
+  801dc4:	5d                   	pop    %ebp
+  801dc5:	c3                   	ret
+		return 0;
+  801dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcb:	eb f1                	jmp    801dbe <fgets+0xac>
+
+00801dcd <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 1c             	sub    $0x1c,%esp
+  801dd6:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  801dd9:	89 f0                	mov    %esi,%eax
+  801ddb:	e8 21 fc ff ff       	call   801a01 <stream_setup>
+	want = size * n;
+  801de0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801de3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801de7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  801dea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801def:	eb 43                	jmp    801e34 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  801df1:	29 d3                	sub    %edx,%ebx
+  801df3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801df6:	29 f8                	sub    %edi,%eax
+  801df8:	39 c3                	cmp    %eax,%ebx
+  801dfa:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  801dfd:	83 ec 04             	sub    $0x4,%esp
+  801e00:	53                   	push   %ebx
+  801e01:	03 56 0c             	add    0xc(%esi),%edx
+  801e04:	52                   	push   %edx
+  801e05:	89 f8                	mov    %edi,%eax
+  801e07:	03 45 08             	add    0x8(%ebp),%eax
+  801e0a:	50                   	push   %eax
+  801e0b:	e8 38 e5 ff ff       	call   800348 <memmove>
+			f->f_rpos += m;
+  801e10:	01 5e 14             	add    %ebx,0x14(%esi)
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	eb 1a                	jmp    801e32 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  801e18:	83 ec 04             	sub    $0x4,%esp
+  801e1b:	53                   	push   %ebx
+  801e1c:	89 f8                	mov    %edi,%eax
+  801e1e:	03 45 08             	add    0x8(%ebp),%eax
+  801e21:	50                   	push   %eax
+  801e22:	ff 36                	push   (%esi)
+  801e24:	e8 86 ef ff ff       	call   800daf <read>
+  801e29:	89 c3                	mov    %eax,%ebx
+  801e2b:	83 c4 10             	add    $0x10,%esp
+  801e2e:	85 c0                	test   %eax,%eax
+  801e30:	7e 36                	jle    801e68 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801e32:	01 df                	add    %ebx,%edi
+  801e34:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e37:	39 c7                	cmp    %eax,%edi
+  801e39:	73 39                	jae    801e74 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801e3b:	8b 56 14             	mov    0x14(%esi),%edx
+  801e3e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801e41:	39 da                	cmp    %ebx,%edx
+  801e43:	72 ac                	jb     801df1 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801e45:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801e48:	29 fb                	sub    %edi,%ebx
+  801e4a:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801e4d:	72 3e                	jb     801e8d <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801e4f:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801e53:	74 1f                	je     801e74 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801e55:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801e59:	74 bd                	je     801e18 <fread+0x4b>
+  801e5b:	89 f0                	mov    %esi,%eax
+  801e5d:	e8 2f fb ff ff       	call   801991 <stream_drain>
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	79 b2                	jns    801e18 <fread+0x4b>
+  801e66:	eb 0c                	jmp    801e74 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801e68:	c1 fb 1f             	sar    $0x1f,%ebx
+  801e6b:	83 e3 04             	and    $0x4,%ebx
+  801e6e:	83 c3 04             	add    $0x4,%ebx
+  801e71:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801e74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	74 0a                	je     801e85 <fread+0xb8>
+  801e7b:	89 f8                	mov    %edi,%eax
+  801e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e82:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5f                   	pop    %edi
+  801e8b:	5d                   	pop    %ebp
+  801e8c:	c3                   	ret
+		} else if (!stream_fill(f))
+  801e8d:	89 f0                	mov    %esi,%eax
+  801e8f:	e8 da fb ff ff       	call   801a6e <stream_fill>
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	74 dc                	je     801e74 <fread+0xa7>
+			m = 0;
+  801e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e9d:	eb 93                	jmp    801e32 <fread+0x65>
+
+00801e9f <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	57                   	push   %edi
+  801ea3:	56                   	push   %esi
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 1c             	sub    $0x1c,%esp
+  801ea8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801eab:	8b 43 04             	mov    0x4(%ebx),%eax
+  801eae:	a8 02                	test   $0x2,%al
+  801eb0:	75 13                	jne    801ec5 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801eb2:	83 c8 08             	or     $0x8,%eax
+  801eb5:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec0:	5b                   	pop    %ebx
+  801ec1:	5e                   	pop    %esi
+  801ec2:	5f                   	pop    %edi
+  801ec3:	5d                   	pop    %ebp
+  801ec4:	c3                   	ret
+	stream_setup(f);
+  801ec5:	89 d8                	mov    %ebx,%eax
+  801ec7:	e8 35 fb ff ff       	call   801a01 <stream_setup>
+	want = size * n;
+  801ecc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ecf:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801ed3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801ed6:	89 d8                	mov    %ebx,%eax
+  801ed8:	e8 41 fa ff ff       	call   80191e <stream_unread>
+	for (done = 0; done < want; ) {
+  801edd:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ee2:	84 c0                	test   %al,%al
+  801ee4:	75 7b                	jne    801f61 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  801eeb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801eee:	39 fe                	cmp    %edi,%esi
+  801ef0:	73 24                	jae    801f16 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ef2:	83 ec 04             	sub    $0x4,%esp
+  801ef5:	89 f8                	mov    %edi,%eax
+  801ef7:	29 f0                	sub    %esi,%eax
+  801ef9:	50                   	push   %eax
+  801efa:	89 f0                	mov    %esi,%eax
+  801efc:	03 45 08             	add    0x8(%ebp),%eax
+  801eff:	50                   	push   %eax
+  801f00:	ff 33                	push   (%ebx)
+  801f02:	e8 a0 ef ff ff       	call   800ea7 <write>
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	7e 04                	jle    801f12 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801f0e:	01 c6                	add    %eax,%esi
+  801f10:	eb dc                	jmp    801eee <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801f12:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801f16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	74 a0                	je     801ebd <fwrite+0x1e>
+  801f1d:	89 f0                	mov    %esi,%eax
+  801f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f24:	f7 75 0c             	divl   0xc(%ebp)
+  801f27:	eb 94                	jmp    801ebd <fwrite+0x1e>
+			done += r;
+  801f29:	01 c7                	add    %eax,%edi
+			continue;
+  801f2b:	eb 34                	jmp    801f61 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801f2d:	8b 73 10             	mov    0x10(%ebx),%esi
+  801f30:	29 c6                	sub    %eax,%esi
+  801f32:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f35:	29 fa                	sub    %edi,%edx
+  801f37:	39 d6                	cmp    %edx,%esi
+  801f39:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801f3c:	83 ec 04             	sub    $0x4,%esp
+  801f3f:	56                   	push   %esi
+  801f40:	89 fa                	mov    %edi,%edx
+  801f42:	03 55 08             	add    0x8(%ebp),%edx
+  801f45:	52                   	push   %edx
+  801f46:	03 43 0c             	add    0xc(%ebx),%eax
+  801f49:	50                   	push   %eax
+  801f4a:	e8 f9 e3 ff ff       	call   800348 <memmove>
+		f->f_wend += m;
+  801f4f:	89 f0                	mov    %esi,%eax
+  801f51:	03 43 1c             	add    0x1c(%ebx),%eax
+  801f54:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801f57:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801f5f:	74 5b                	je     801fbc <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801f61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f64:	39 c7                	cmp    %eax,%edi
+  801f66:	73 2d                	jae    801f95 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801f68:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	75 be                	jne    801f2d <fwrite+0x8e>
+  801f6f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f72:	29 fa                	sub    %edi,%edx
+  801f74:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801f77:	72 b4                	jb     801f2d <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801f79:	83 ec 04             	sub    $0x4,%esp
+  801f7c:	52                   	push   %edx
+  801f7d:	89 f8                	mov    %edi,%eax
+  801f7f:	03 45 08             	add    0x8(%ebp),%eax
+  801f82:	50                   	push   %eax
+  801f83:	ff 33                	push   (%ebx)
+  801f85:	e8 1d ef ff ff       	call   800ea7 <write>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	7f 98                	jg     801f29 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801f91:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801f95:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f98:	83 f8 03             	cmp    $0x3,%eax
+  801f9b:	74 48                	je     801fe5 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801f9d:	83 f8 02             	cmp    $0x2,%eax
+  801fa0:	74 27                	je     801fc9 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801fa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	0f 84 10 ff ff ff    	je     801ebd <fwrite+0x1e>
+  801fad:	89 f8                	mov    %edi,%eax
+  801faf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb4:	f7 75 0c             	divl   0xc(%ebp)
+  801fb7:	e9 01 ff ff ff       	jmp    801ebd <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801fbc:	89 d8                	mov    %ebx,%eax
+  801fbe:	e8 ce f9 ff ff       	call   801991 <stream_drain>
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	79 9a                	jns    801f61 <fwrite+0xc2>
+  801fc7:	eb cc                	jmp    801f95 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801fc9:	83 ec 04             	sub    $0x4,%esp
+  801fcc:	57                   	push   %edi
+  801fcd:	6a 0a                	push   $0xa
+  801fcf:	ff 75 08             	push   0x8(%ebp)
+  801fd2:	e8 22 e4 ff ff       	call   8003f9 <memfind>
+  801fd7:	89 c2                	mov    %eax,%edx
+  801fd9:	89 f8                	mov    %edi,%eax
+  801fdb:	03 45 08             	add    0x8(%ebp),%eax
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	39 c2                	cmp    %eax,%edx
+  801fe3:	74 bd                	je     801fa2 <fwrite+0x103>
+		stream_drain(f);
+  801fe5:	89 d8                	mov    %ebx,%eax
+  801fe7:	e8 a5 f9 ff ff       	call   801991 <stream_drain>
+  801fec:	eb b4                	jmp    801fa2 <fwrite+0x103>
+
+00801fee <fputc>:
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	53                   	push   %ebx
+  801ff2:	83 ec 14             	sub    $0x14,%esp
+  801ff5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801ff8:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801ffb:	ff 75 0c             	push   0xc(%ebp)
+  801ffe:	6a 01                	push   $0x1
+  802000:	6a 01                	push   $0x1
+  802002:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802005:	50                   	push   %eax
+  802006:	e8 94 fe ff ff       	call   801e9f <fwrite>
+  80200b:	83 c4 10             	add    $0x10,%esp
+  80200e:	0f b6 db             	movzbl %bl,%ebx
+  802011:	83 f8 01             	cmp    $0x1,%eax
+  802014:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802019:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80201c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802027:	ff 75 0c             	push   0xc(%ebp)
+  80202a:	ff 75 08             	push   0x8(%ebp)
+  80202d:	e8 bc ff ff ff       	call   801fee <fputc>
+}
+  802032:	83 c4 10             	add    $0x10,%esp
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+00802037 <fputs>:
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+  80203a:	56                   	push   %esi
+  80203b:	53                   	push   %ebx
+  80203c:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80203f:	83 ec 0c             	sub    $0xc,%esp
+  802042:	56                   	push   %esi
+  802043:	e8 3f e1 ff ff       	call   800187 <strlen>
+  802048:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80204a:	ff 75 0c             	push   0xc(%ebp)
+  80204d:	50                   	push   %eax
+  80204e:	6a 01                	push   $0x1
+  802050:	56                   	push   %esi
+  802051:	e8 49 fe ff ff       	call   801e9f <fwrite>
+  802056:	83 c4 20             	add    $0x20,%esp
+  802059:	39 d8                	cmp    %ebx,%eax
+  80205b:	0f 95 c0             	setne  %al
+  80205e:	0f b6 c0             	movzbl %al,%eax
+  802061:	f7 d8                	neg    %eax
+}
+  802063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802066:	5b                   	pop    %ebx
+  802067:	5e                   	pop    %esi
+  802068:	5d                   	pop    %ebp
+  802069:	c3                   	ret
+
+0080206a <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	53                   	push   %ebx
+  80206e:	83 ec 04             	sub    $0x4,%esp
+  802071:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802074:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802077:	50                   	push   %eax
+  802078:	ff 75 0c             	push   0xc(%ebp)
+  80207b:	53                   	push   %ebx
+  80207c:	68 21 20 80 00       	push   $0x802021
+  802081:	e8 2c 17 00 00       	call   8037b2 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802086:	8b 43 04             	mov    0x4(%ebx),%eax
+  802089:	c1 e0 1c             	shl    $0x1c,%eax
+  80208c:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80208f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802092:	c9                   	leave
+  802093:	c3                   	ret
+
+00802094 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80209a:	68 94 48 80 00       	push   $0x804894
+  80209f:	ff 75 0c             	push   0xc(%ebp)
+  8020a2:	e8 1b e1 ff ff       	call   8001c2 <strcpy>
+	return 0;
+}
+  8020a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ac:	c9                   	leave
+  8020ad:	c3                   	ret
+
+008020ae <devsock_close>:
+{
+  8020ae:	55                   	push   %ebp
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	53                   	push   %ebx
+  8020b2:	83 ec 10             	sub    $0x10,%esp
+  8020b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020b8:	53                   	push   %ebx
+  8020b9:	e8 a7 23 00 00       	call   804465 <pageref>
+  8020be:	89 c2                	mov    %eax,%edx
+  8020c0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020c8:	83 fa 01             	cmp    $0x1,%edx
+  8020cb:	74 05                	je     8020d2 <devsock_close+0x24>
+}
+  8020cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d0:	c9                   	leave
+  8020d1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	ff 73 0c             	push   0xc(%ebx)
+  8020d8:	e8 b7 02 00 00       	call   802394 <nsipc_close>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	eb eb                	jmp    8020cd <devsock_close+0x1f>
+
+008020e2 <devsock_write>:
+{
+  8020e2:	55                   	push   %ebp
+  8020e3:	89 e5                	mov    %esp,%ebp
+  8020e5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8020e8:	6a 00                	push   $0x0
+  8020ea:	ff 75 10             	push   0x10(%ebp)
+  8020ed:	ff 75 0c             	push   0xc(%ebp)
+  8020f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f3:	ff 70 0c             	push   0xc(%eax)
+  8020f6:	e8 79 03 00 00       	call   802474 <nsipc_send>
+}
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+
+008020fd <devsock_read>:
+{
+  8020fd:	55                   	push   %ebp
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802103:	6a 00                	push   $0x0
+  802105:	ff 75 10             	push   0x10(%ebp)
+  802108:	ff 75 0c             	push   0xc(%ebp)
+  80210b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210e:	ff 70 0c             	push   0xc(%eax)
+  802111:	e8 ef 02 00 00       	call   802405 <nsipc_recv>
+}
+  802116:	c9                   	leave
+  802117:	c3                   	ret
+
+00802118 <fd2sockid>:
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80211e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802121:	52                   	push   %edx
+  802122:	50                   	push   %eax
+  802123:	e8 f7 e9 ff ff       	call   800b1f <fd_lookup>
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	78 10                	js     80213f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80212f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802132:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802138:	39 08                	cmp    %ecx,(%eax)
+  80213a:	75 05                	jne    802141 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80213c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+		return -E_NOT_SUPP;
+  802141:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802146:	eb f7                	jmp    80213f <fd2sockid+0x27>
+
+00802148 <alloc_sockfd>:
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	56                   	push   %esi
+  80214c:	53                   	push   %ebx
+  80214d:	83 ec 1c             	sub    $0x1c,%esp
+  802150:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802152:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802155:	50                   	push   %eax
+  802156:	e8 6e e9 ff ff       	call   800ac9 <fd_alloc>
+  80215b:	89 c3                	mov    %eax,%ebx
+  80215d:	83 c4 10             	add    $0x10,%esp
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 43                	js     8021a7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802164:	83 ec 04             	sub    $0x4,%esp
+  802167:	68 07 04 00 00       	push   $0x407
+  80216c:	ff 75 f4             	push   -0xc(%ebp)
+  80216f:	6a 00                	push   $0x0
+  802171:	e8 8a e4 ff ff       	call   800600 <sys_page_alloc>
+  802176:	89 c3                	mov    %eax,%ebx
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 28                	js     8021a7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80217f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802182:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802188:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80218a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802194:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802197:	83 ec 0c             	sub    $0xc,%esp
+  80219a:	50                   	push   %eax
+  80219b:	e8 02 e9 ff ff       	call   800aa2 <fd2num>
+  8021a0:	89 c3                	mov    %eax,%ebx
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	eb 0c                	jmp    8021b3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+  8021aa:	56                   	push   %esi
+  8021ab:	e8 e4 01 00 00       	call   802394 <nsipc_close>
+		return r;
+  8021b0:	83 c4 10             	add    $0x10,%esp
+}
+  8021b3:	89 d8                	mov    %ebx,%eax
+  8021b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b8:	5b                   	pop    %ebx
+  8021b9:	5e                   	pop    %esi
+  8021ba:	5d                   	pop    %ebp
+  8021bb:	c3                   	ret
+
+008021bc <accept>:
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c5:	e8 4e ff ff ff       	call   802118 <fd2sockid>
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 1b                	js     8021e9 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8021ce:	83 ec 04             	sub    $0x4,%esp
+  8021d1:	ff 75 10             	push   0x10(%ebp)
+  8021d4:	ff 75 0c             	push   0xc(%ebp)
+  8021d7:	50                   	push   %eax
+  8021d8:	e8 0e 01 00 00       	call   8022eb <nsipc_accept>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	78 05                	js     8021e9 <accept+0x2d>
+	return alloc_sockfd(r);
+  8021e4:	e8 5f ff ff ff       	call   802148 <alloc_sockfd>
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+008021eb <bind>:
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f4:	e8 1f ff ff ff       	call   802118 <fd2sockid>
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	78 12                	js     80220f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8021fd:	83 ec 04             	sub    $0x4,%esp
+  802200:	ff 75 10             	push   0x10(%ebp)
+  802203:	ff 75 0c             	push   0xc(%ebp)
+  802206:	50                   	push   %eax
+  802207:	e8 31 01 00 00       	call   80233d <nsipc_bind>
+  80220c:	83 c4 10             	add    $0x10,%esp
+}
+  80220f:	c9                   	leave
+  802210:	c3                   	ret
+
+00802211 <shutdown>:
+{
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802217:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221a:	e8 f9 fe ff ff       	call   802118 <fd2sockid>
+  80221f:	85 c0                	test   %eax,%eax
+  802221:	78 0f                	js     802232 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802223:	83 ec 08             	sub    $0x8,%esp
+  802226:	ff 75 0c             	push   0xc(%ebp)
+  802229:	50                   	push   %eax
+  80222a:	e8 43 01 00 00       	call   802372 <nsipc_shutdown>
+  80222f:	83 c4 10             	add    $0x10,%esp
+}
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <connect>:
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80223a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223d:	e8 d6 fe ff ff       	call   802118 <fd2sockid>
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 12                	js     802258 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802246:	83 ec 04             	sub    $0x4,%esp
+  802249:	ff 75 10             	push   0x10(%ebp)
+  80224c:	ff 75 0c             	push   0xc(%ebp)
+  80224f:	50                   	push   %eax
+  802250:	e8 59 01 00 00       	call   8023ae <nsipc_connect>
+  802255:	83 c4 10             	add    $0x10,%esp
+}
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+0080225a <listen>:
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802260:	8b 45 08             	mov    0x8(%ebp),%eax
+  802263:	e8 b0 fe ff ff       	call   802118 <fd2sockid>
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	78 0f                	js     80227b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80226c:	83 ec 08             	sub    $0x8,%esp
+  80226f:	ff 75 0c             	push   0xc(%ebp)
+  802272:	50                   	push   %eax
+  802273:	e8 6b 01 00 00       	call   8023e3 <nsipc_listen>
+  802278:	83 c4 10             	add    $0x10,%esp
+}
+  80227b:	c9                   	leave
+  80227c:	c3                   	ret
+
+0080227d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802283:	ff 75 10             	push   0x10(%ebp)
+  802286:	ff 75 0c             	push   0xc(%ebp)
+  802289:	ff 75 08             	push   0x8(%ebp)
+  80228c:	e8 41 02 00 00       	call   8024d2 <nsipc_socket>
+  802291:	83 c4 10             	add    $0x10,%esp
+  802294:	85 c0                	test   %eax,%eax
+  802296:	78 05                	js     80229d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802298:	e8 ab fe ff ff       	call   802148 <alloc_sockfd>
+}
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+
+0080229f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	53                   	push   %ebx
+  8022a3:	83 ec 04             	sub    $0x4,%esp
+  8022a6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022a8:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8022af:	74 26                	je     8022d7 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022b1:	6a 07                	push   $0x7
+  8022b3:	68 00 80 80 00       	push   $0x808000
+  8022b8:	53                   	push   %ebx
+  8022b9:	ff 35 08 60 80 00    	push   0x806008
+  8022bf:	e8 0c 21 00 00       	call   8043d0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022c4:	83 c4 0c             	add    $0xc,%esp
+  8022c7:	6a 00                	push   $0x0
+  8022c9:	6a 00                	push   $0x0
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	e8 08 20 00 00       	call   8042da <ipc_recv>
+}
+  8022d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022d7:	83 ec 0c             	sub    $0xc,%esp
+  8022da:	6a 02                	push   $0x2
+  8022dc:	e8 45 21 00 00       	call   804426 <ipc_find_env>
+  8022e1:	a3 08 60 80 00       	mov    %eax,0x806008
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	eb c6                	jmp    8022b1 <nsipc+0x12>
+
+008022eb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	56                   	push   %esi
+  8022ef:	53                   	push   %ebx
+  8022f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8022f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8022fb:	8b 06                	mov    (%esi),%eax
+  8022fd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802302:	b8 01 00 00 00       	mov    $0x1,%eax
+  802307:	e8 93 ff ff ff       	call   80229f <nsipc>
+  80230c:	89 c3                	mov    %eax,%ebx
+  80230e:	85 c0                	test   %eax,%eax
+  802310:	79 09                	jns    80231b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802312:	89 d8                	mov    %ebx,%eax
+  802314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802317:	5b                   	pop    %ebx
+  802318:	5e                   	pop    %esi
+  802319:	5d                   	pop    %ebp
+  80231a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80231b:	83 ec 04             	sub    $0x4,%esp
+  80231e:	ff 35 10 80 80 00    	push   0x808010
+  802324:	68 00 80 80 00       	push   $0x808000
+  802329:	ff 75 0c             	push   0xc(%ebp)
+  80232c:	e8 17 e0 ff ff       	call   800348 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802331:	a1 10 80 80 00       	mov    0x808010,%eax
+  802336:	89 06                	mov    %eax,(%esi)
+  802338:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80233b:	eb d5                	jmp    802312 <nsipc_accept+0x27>
+
+0080233d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	53                   	push   %ebx
+  802341:	83 ec 08             	sub    $0x8,%esp
+  802344:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80234f:	53                   	push   %ebx
+  802350:	ff 75 0c             	push   0xc(%ebp)
+  802353:	68 04 80 80 00       	push   $0x808004
+  802358:	e8 eb df ff ff       	call   800348 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80235d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802363:	b8 02 00 00 00       	mov    $0x2,%eax
+  802368:	e8 32 ff ff ff       	call   80229f <nsipc>
+}
+  80236d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802370:	c9                   	leave
+  802371:	c3                   	ret
+
+00802372 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802372:	55                   	push   %ebp
+  802373:	89 e5                	mov    %esp,%ebp
+  802375:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802378:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802380:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802383:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802388:	b8 03 00 00 00       	mov    $0x3,%eax
+  80238d:	e8 0d ff ff ff       	call   80229f <nsipc>
+}
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+
+00802394 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80239a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8023a2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023a7:	e8 f3 fe ff ff       	call   80229f <nsipc>
+}
+  8023ac:	c9                   	leave
+  8023ad:	c3                   	ret
+
+008023ae <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023ae:	55                   	push   %ebp
+  8023af:	89 e5                	mov    %esp,%ebp
+  8023b1:	53                   	push   %ebx
+  8023b2:	83 ec 08             	sub    $0x8,%esp
+  8023b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bb:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023c0:	53                   	push   %ebx
+  8023c1:	ff 75 0c             	push   0xc(%ebp)
+  8023c4:	68 04 80 80 00       	push   $0x808004
+  8023c9:	e8 7a df ff ff       	call   800348 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023ce:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8023d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023d9:	e8 c1 fe ff ff       	call   80229f <nsipc>
+}
+  8023de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+008023e3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8023e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ec:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8023f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f4:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8023f9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023fe:	e8 9c fe ff ff       	call   80229f <nsipc>
+}
+  802403:	c9                   	leave
+  802404:	c3                   	ret
+
+00802405 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	56                   	push   %esi
+  802409:	53                   	push   %ebx
+  80240a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80240d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802410:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802415:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80241b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241e:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802423:	b8 07 00 00 00       	mov    $0x7,%eax
+  802428:	e8 72 fe ff ff       	call   80229f <nsipc>
+  80242d:	89 c3                	mov    %eax,%ebx
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	78 22                	js     802455 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802433:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802438:	39 c6                	cmp    %eax,%esi
+  80243a:	0f 4e c6             	cmovle %esi,%eax
+  80243d:	39 c3                	cmp    %eax,%ebx
+  80243f:	7f 1d                	jg     80245e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802441:	83 ec 04             	sub    $0x4,%esp
+  802444:	53                   	push   %ebx
+  802445:	68 00 80 80 00       	push   $0x808000
+  80244a:	ff 75 0c             	push   0xc(%ebp)
+  80244d:	e8 f6 de ff ff       	call   800348 <memmove>
+  802452:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802455:	89 d8                	mov    %ebx,%eax
+  802457:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245a:	5b                   	pop    %ebx
+  80245b:	5e                   	pop    %esi
+  80245c:	5d                   	pop    %ebp
+  80245d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80245e:	68 a0 48 80 00       	push   $0x8048a0
+  802463:	68 59 48 80 00       	push   $0x804859
+  802468:	6a 62                	push   $0x62
+  80246a:	68 b5 48 80 00       	push   $0x8048b5
+  80246f:	e8 6c 11 00 00       	call   8035e0 <_panic>
+
+00802474 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	53                   	push   %ebx
+  802478:	83 ec 04             	sub    $0x4,%esp
+  80247b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80247e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802481:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802486:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80248c:	7f 2e                	jg     8024bc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80248e:	83 ec 04             	sub    $0x4,%esp
+  802491:	53                   	push   %ebx
+  802492:	ff 75 0c             	push   0xc(%ebp)
+  802495:	68 0c 80 80 00       	push   $0x80800c
+  80249a:	e8 a9 de ff ff       	call   800348 <memmove>
+	nsipcbuf.send.req_size = size;
+  80249f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8024a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024a8:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8024ad:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024b2:	e8 e8 fd ff ff       	call   80229f <nsipc>
+}
+  8024b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ba:	c9                   	leave
+  8024bb:	c3                   	ret
+	assert(size < 1600);
+  8024bc:	68 c1 48 80 00       	push   $0x8048c1
+  8024c1:	68 59 48 80 00       	push   $0x804859
+  8024c6:	6a 6d                	push   $0x6d
+  8024c8:	68 b5 48 80 00       	push   $0x8048b5
+  8024cd:	e8 0e 11 00 00       	call   8035e0 <_panic>
+
+008024d2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8024d2:	55                   	push   %ebp
+  8024d3:	89 e5                	mov    %esp,%ebp
+  8024d5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8024d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024db:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8024e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e3:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8024e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024eb:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8024f0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024f5:	e8 a5 fd ff ff       	call   80229f <nsipc>
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+
+008024fc <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8024fc:	55                   	push   %ebp
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	53                   	push   %ebx
+  802500:	83 ec 10             	sub    $0x10,%esp
+  802503:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802506:	68 0c 60 80 00       	push   $0x80600c
+  80250b:	e8 50 07 00 00       	call   802c60 <mutex_lock>
+	if (v == 0)
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 db                	test   %ebx,%ebx
+  802515:	0f 84 85 00 00 00    	je     8025a0 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80251b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802521:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802526:	77 51                	ja     802579 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802528:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80252e:	89 d8                	mov    %ebx,%eax
+  802530:	c1 e8 0c             	shr    $0xc,%eax
+  802533:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80253a:	f6 c4 02             	test   $0x2,%ah
+  80253d:	74 50                	je     80258f <free+0x93>
+		sys_page_unmap(0, c);
+  80253f:	83 ec 08             	sub    $0x8,%esp
+  802542:	53                   	push   %ebx
+  802543:	6a 00                	push   $0x0
+  802545:	e8 4f e1 ff ff       	call   800699 <sys_page_unmap>
+		c += PGSIZE;
+  80254a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802550:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80255e:	76 ce                	jbe    80252e <free+0x32>
+  802560:	68 0b 49 80 00       	push   $0x80490b
+  802565:	68 59 48 80 00       	push   $0x804859
+  80256a:	68 82 00 00 00       	push   $0x82
+  80256f:	68 fe 48 80 00       	push   $0x8048fe
+  802574:	e8 67 10 00 00       	call   8035e0 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802579:	68 d0 48 80 00       	push   $0x8048d0
+  80257e:	68 59 48 80 00       	push   $0x804859
+  802583:	6a 7b                	push   $0x7b
+  802585:	68 fe 48 80 00       	push   $0x8048fe
+  80258a:	e8 51 10 00 00       	call   8035e0 <_panic>
+	if (--(*ref) == 0)
+  80258f:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802595:	83 e8 01             	sub    $0x1,%eax
+  802598:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80259e:	74 15                	je     8025b5 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8025a0:	83 ec 0c             	sub    $0xc,%esp
+  8025a3:	68 0c 60 80 00       	push   $0x80600c
+  8025a8:	e8 20 07 00 00       	call   802ccd <mutex_unlock>
+}
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b3:	c9                   	leave
+  8025b4:	c3                   	ret
+		sys_page_unmap(0, c);
+  8025b5:	83 ec 08             	sub    $0x8,%esp
+  8025b8:	53                   	push   %ebx
+  8025b9:	6a 00                	push   $0x0
+  8025bb:	e8 d9 e0 ff ff       	call   800699 <sys_page_unmap>
+  8025c0:	83 c4 10             	add    $0x10,%esp
+  8025c3:	eb db                	jmp    8025a0 <free+0xa4>
+
+008025c5 <malloc>:
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	57                   	push   %edi
+  8025c9:	56                   	push   %esi
+  8025ca:	53                   	push   %ebx
+  8025cb:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8025ce:	68 0c 60 80 00       	push   $0x80600c
+  8025d3:	e8 88 06 00 00       	call   802c60 <mutex_lock>
+	if (mptr == 0)
+  8025d8:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8025de:	83 c4 10             	add    $0x10,%esp
+  8025e1:	85 ff                	test   %edi,%edi
+  8025e3:	74 6c                	je     802651 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8025e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e8:	83 c0 03             	add    $0x3,%eax
+  8025eb:	83 e0 fc             	and    $0xfffffffc,%eax
+  8025ee:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8025f0:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8025f5:	0f 87 64 01 00 00    	ja     80275f <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8025fb:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802601:	74 30                	je     802633 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802603:	89 f9                	mov    %edi,%ecx
+  802605:	c1 e9 0c             	shr    $0xc,%ecx
+  802608:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80260c:	c1 e8 0c             	shr    $0xc,%eax
+  80260f:	39 c1                	cmp    %eax,%ecx
+  802611:	74 5f                	je     802672 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802613:	83 ec 0c             	sub    $0xc,%esp
+  802616:	57                   	push   %edi
+  802617:	e8 e0 fe ff ff       	call   8024fc <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80261c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802621:	05 00 10 00 00       	add    $0x1000,%eax
+  802626:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80262b:	a3 10 60 80 00       	mov    %eax,0x806010
+  802630:	83 c4 10             	add    $0x10,%esp
+  802633:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802639:	ba 02 00 00 00       	mov    $0x2,%edx
+  80263e:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802642:	8d 7e 04             	lea    0x4(%esi),%edi
+  802645:	89 cb                	mov    %ecx,%ebx
+  802647:	01 f9                	add    %edi,%ecx
+  802649:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80264c:	e9 8b 00 00 00       	jmp    8026dc <malloc+0x117>
+		mptr = mbegin;
+  802651:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802658:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80265b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265e:	83 c0 03             	add    $0x3,%eax
+  802661:	83 e0 fc             	and    $0xfffffffc,%eax
+  802664:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802666:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80266b:	76 c6                	jbe    802633 <malloc+0x6e>
+  80266d:	e9 d6 00 00 00       	jmp    802748 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802672:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802678:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80267d:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802681:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802684:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802689:	e9 ba 00 00 00       	jmp    802748 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80268e:	05 00 10 00 00       	add    $0x1000,%eax
+  802693:	39 c8                	cmp    %ecx,%eax
+  802695:	0f 83 cb 00 00 00    	jae    802766 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80269b:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8026a0:	77 22                	ja     8026c4 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8026a2:	89 c2                	mov    %eax,%edx
+  8026a4:	c1 ea 16             	shr    $0x16,%edx
+  8026a7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8026ae:	f6 c2 01             	test   $0x1,%dl
+  8026b1:	74 db                	je     80268e <malloc+0xc9>
+  8026b3:	89 c2                	mov    %eax,%edx
+  8026b5:	c1 ea 0c             	shr    $0xc,%edx
+  8026b8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8026bf:	f6 c2 01             	test   $0x1,%dl
+  8026c2:	74 ca                	je     80268e <malloc+0xc9>
+		if (mptr == mend) {
+  8026c4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026ca:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8026d0:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8026d4:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8026da:	74 04                	je     8026e0 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8026dc:	89 d8                	mov    %ebx,%eax
+  8026de:	eb b3                	jmp    802693 <malloc+0xce>
+  8026e0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8026e3:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8026e8:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8026ec:	83 ea 01             	sub    $0x1,%edx
+  8026ef:	0f 85 50 ff ff ff    	jne    802645 <malloc+0x80>
+  8026f5:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8026fc:	00 00 08 
+				return 0;	/* out of address space */
+  8026ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802704:	eb 42                	jmp    802748 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802706:	85 db                	test   %ebx,%ebx
+  802708:	78 1e                	js     802728 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80270a:	83 ec 08             	sub    $0x8,%esp
+  80270d:	89 d8                	mov    %ebx,%eax
+  80270f:	03 05 10 60 80 00    	add    0x806010,%eax
+  802715:	50                   	push   %eax
+  802716:	6a 00                	push   $0x0
+  802718:	e8 7c df ff ff       	call   800699 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80271d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802723:	83 c4 10             	add    $0x10,%esp
+  802726:	eb de                	jmp    802706 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802728:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272d:	eb 19                	jmp    802748 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80272f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802732:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802738:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80273f:	00 
+	mptr += n;
+  802740:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802743:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802748:	83 ec 0c             	sub    $0xc,%esp
+  80274b:	68 0c 60 80 00       	push   $0x80600c
+  802750:	e8 78 05 00 00       	call   802ccd <mutex_unlock>
+}
+  802755:	89 f8                	mov    %edi,%eax
+  802757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275a:	5b                   	pop    %ebx
+  80275b:	5e                   	pop    %esi
+  80275c:	5f                   	pop    %edi
+  80275d:	5d                   	pop    %ebp
+  80275e:	c3                   	ret
+		return 0;
+  80275f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802764:	eb e2                	jmp    802748 <malloc+0x183>
+  802766:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80276a:	74 06                	je     802772 <malloc+0x1ad>
+  80276c:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802777:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80277a:	39 fb                	cmp    %edi,%ebx
+  80277c:	73 b1                	jae    80272f <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80277e:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802784:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802787:	39 fe                	cmp    %edi,%esi
+  802789:	0f 92 c0             	setb   %al
+  80278c:	0f b6 c0             	movzbl %al,%eax
+  80278f:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802792:	83 c8 07             	or     $0x7,%eax
+  802795:	50                   	push   %eax
+  802796:	89 d8                	mov    %ebx,%eax
+  802798:	03 05 10 60 80 00    	add    0x806010,%eax
+  80279e:	50                   	push   %eax
+  80279f:	6a 00                	push   $0x0
+  8027a1:	e8 5a de ff ff       	call   800600 <sys_page_alloc>
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	0f 88 55 ff ff ff    	js     802706 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8027b1:	89 f3                	mov    %esi,%ebx
+  8027b3:	eb c5                	jmp    80277a <malloc+0x1b5>
+
+008027b5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	56                   	push   %esi
+  8027b9:	53                   	push   %ebx
+  8027ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8027bd:	83 ec 0c             	sub    $0xc,%esp
+  8027c0:	ff 75 08             	push   0x8(%ebp)
+  8027c3:	e8 ea e2 ff ff       	call   800ab2 <fd2data>
+  8027c8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8027ca:	83 c4 08             	add    $0x8,%esp
+  8027cd:	68 23 49 80 00       	push   $0x804923
+  8027d2:	53                   	push   %ebx
+  8027d3:	e8 ea d9 ff ff       	call   8001c2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8027d8:	8b 46 04             	mov    0x4(%esi),%eax
+  8027db:	2b 06                	sub    (%esi),%eax
+  8027dd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8027e3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027ea:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027ed:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8027f4:	52 80 00 
+	return 0;
+}
+  8027f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ff:	5b                   	pop    %ebx
+  802800:	5e                   	pop    %esi
+  802801:	5d                   	pop    %ebp
+  802802:	c3                   	ret
+
+00802803 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802808:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80280c:	85 c9                	test   %ecx,%ecx
+  80280e:	75 01                	jne    802811 <pipewake+0xe>
+  802810:	c3                   	ret
+{
+  802811:	55                   	push   %ebp
+  802812:	89 e5                	mov    %esp,%ebp
+  802814:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802817:	68 00 04 00 00       	push   $0x400
+  80281c:	52                   	push   %edx
+  80281d:	e8 22 e1 ff ff       	call   800944 <sys_futex_wake>
+  802822:	83 c4 10             	add    $0x10,%esp
+}
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+00802827 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	56                   	push   %esi
+  80282b:	53                   	push   %ebx
+  80282c:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80282f:	83 ec 0c             	sub    $0xc,%esp
+  802832:	56                   	push   %esi
+  802833:	e8 7a e2 ff ff       	call   800ab2 <fd2data>
+  802838:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80283a:	83 c4 08             	add    $0x8,%esp
+  80283d:	56                   	push   %esi
+  80283e:	6a 00                	push   $0x0
+  802840:	e8 54 de ff ff       	call   800699 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802845:	8d 53 04             	lea    0x4(%ebx),%edx
+  802848:	8d 43 08             	lea    0x8(%ebx),%eax
+  80284b:	e8 b3 ff ff ff       	call   802803 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802850:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802853:	89 da                	mov    %ebx,%edx
+  802855:	e8 a9 ff ff ff       	call   802803 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80285a:	89 34 24             	mov    %esi,(%esp)
+  80285d:	e8 50 e2 ff ff       	call   800ab2 <fd2data>
+  802862:	83 c4 08             	add    $0x8,%esp
+  802865:	50                   	push   %eax
+  802866:	6a 00                	push   $0x0
+  802868:	e8 2c de ff ff       	call   800699 <sys_page_unmap>
+}
+  80286d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802870:	5b                   	pop    %ebx
+  802871:	5e                   	pop    %esi
+  802872:	5d                   	pop    %ebp
+  802873:	c3                   	ret
+
+00802874 <_pipeisclosed>:
+{
+  802874:	55                   	push   %ebp
+  802875:	89 e5                	mov    %esp,%ebp
+  802877:	57                   	push   %edi
+  802878:	56                   	push   %esi
+  802879:	53                   	push   %ebx
+  80287a:	83 ec 1c             	sub    $0x1c,%esp
+  80287d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802880:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802882:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802887:	eb 5d                	jmp    8028e6 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802889:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  80288f:	8b 02                	mov    (%edx),%eax
+  802891:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802894:	83 ec 0c             	sub    $0xc,%esp
+  802897:	ff 75 e0             	push   -0x20(%ebp)
+  80289a:	e8 c6 1b 00 00       	call   804465 <pageref>
+  80289f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028a2:	89 3c 24             	mov    %edi,(%esp)
+  8028a5:	e8 bb 1b 00 00       	call   804465 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8028aa:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8028ac:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8028b2:	83 c4 10             	add    $0x10,%esp
+  8028b5:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8028bb:	77 15                	ja     8028d2 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8028bd:	89 f2                	mov    %esi,%edx
+  8028bf:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8028c1:	c1 ea 10             	shr    $0x10,%edx
+  8028c4:	74 0c                	je     8028d2 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8028c6:	c1 e2 10             	shl    $0x10,%edx
+  8028c9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8028ce:	29 d1                	sub    %edx,%ecx
+  8028d0:	eb 06                	jmp    8028d8 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8028d2:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8028d8:	8b 11                	mov    (%ecx),%edx
+  8028da:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8028dd:	39 d3                	cmp    %edx,%ebx
+  8028df:	74 6e                	je     80294f <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8028e1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028e4:	74 24                	je     80290a <_pipeisclosed+0x96>
+  8028e6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8028e8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8028ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8028f3:	77 94                	ja     802889 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8028f5:	89 f0                	mov    %esi,%eax
+  8028f7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8028f9:	c1 e8 10             	shr    $0x10,%eax
+  8028fc:	74 8b                	je     802889 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8028fe:	c1 e0 10             	shl    $0x10,%eax
+  802901:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802906:	29 c2                	sub    %eax,%edx
+  802908:	eb 85                	jmp    80288f <_pipeisclosed+0x1b>
+  80290a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80290c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802912:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802917:	77 18                	ja     802931 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802919:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80291e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802920:	c1 e8 10             	shr    $0x10,%eax
+  802923:	74 0c                	je     802931 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802925:	c1 e0 10             	shl    $0x10,%eax
+  802928:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80292d:	29 c2                	sub    %eax,%edx
+  80292f:	eb 06                	jmp    802937 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802931:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802937:	8b 02                	mov    (%edx),%eax
+  802939:	8b 40 58             	mov    0x58(%eax),%eax
+  80293c:	6a 01                	push   $0x1
+  80293e:	50                   	push   %eax
+  80293f:	53                   	push   %ebx
+  802940:	68 2a 49 80 00       	push   $0x80492a
+  802945:	e8 71 0d 00 00       	call   8036bb <cprintf>
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	eb 97                	jmp    8028e6 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80294f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802952:	0f 94 c0             	sete   %al
+  802955:	0f b6 c0             	movzbl %al,%eax
+}
+  802958:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295b:	5b                   	pop    %ebx
+  80295c:	5e                   	pop    %esi
+  80295d:	5f                   	pop    %edi
+  80295e:	5d                   	pop    %ebp
+  80295f:	c3                   	ret
+
+00802960 <devpipe_write>:
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	57                   	push   %edi
+  802964:	56                   	push   %esi
+  802965:	53                   	push   %ebx
+  802966:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802969:	ff 75 08             	push   0x8(%ebp)
+  80296c:	e8 41 e1 ff ff       	call   800ab2 <fd2data>
+  802971:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802973:	83 c4 10             	add    $0x10,%esp
+  802976:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80297d:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802980:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802983:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802986:	0f 84 96 00 00 00    	je     802a22 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80298c:	8d 73 08             	lea    0x8(%ebx),%esi
+  80298f:	eb 32                	jmp    8029c3 <devpipe_write+0x63>
+  802991:	89 fa                	mov    %edi,%edx
+  802993:	89 f0                	mov    %esi,%eax
+  802995:	e8 69 fe ff ff       	call   802803 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80299a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80299d:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8029a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029a5:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8029aa:	83 ec 04             	sub    $0x4,%esp
+  8029ad:	6a 0a                	push   $0xa
+  8029af:	50                   	push   %eax
+  8029b0:	53                   	push   %ebx
+  8029b1:	e8 5f df ff ff       	call   800915 <sys_futex_wait>
+  8029b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029bb:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8029c0:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8029c3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029c6:	8b 0b                	mov    (%ebx),%ecx
+  8029c8:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029cb:	39 d0                	cmp    %edx,%eax
+  8029cd:	72 1b                	jb     8029ea <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8029cf:	89 da                	mov    %ebx,%edx
+  8029d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d4:	e8 9b fe ff ff       	call   802874 <_pipeisclosed>
+  8029d9:	85 c0                	test   %eax,%eax
+  8029db:	74 b4                	je     802991 <devpipe_write+0x31>
+				return 0;
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e5:	5b                   	pop    %ebx
+  8029e6:	5e                   	pop    %esi
+  8029e7:	5f                   	pop    %edi
+  8029e8:	5d                   	pop    %ebp
+  8029e9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ed:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8029f0:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8029f4:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8029f7:	89 c2                	mov    %eax,%edx
+  8029f9:	c1 fa 1f             	sar    $0x1f,%edx
+  8029fc:	89 d1                	mov    %edx,%ecx
+  8029fe:	c1 e9 1b             	shr    $0x1b,%ecx
+  802a01:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802a04:	83 e2 1f             	and    $0x1f,%edx
+  802a07:	29 ca                	sub    %ecx,%edx
+  802a09:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802a0d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802a11:	83 c0 01             	add    $0x1,%eax
+  802a14:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802a17:	83 c6 01             	add    $0x1,%esi
+  802a1a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802a1d:	e9 5e ff ff ff       	jmp    802980 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802a22:	8d 53 04             	lea    0x4(%ebx),%edx
+  802a25:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a28:	e8 d6 fd ff ff       	call   802803 <pipewake>
+	return i;
+  802a2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a30:	eb b0                	jmp    8029e2 <devpipe_write+0x82>
+
+00802a32 <devpipe_read>:
+{
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	57                   	push   %edi
+  802a36:	56                   	push   %esi
+  802a37:	53                   	push   %ebx
+  802a38:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802a3b:	ff 75 08             	push   0x8(%ebp)
+  802a3e:	e8 6f e0 ff ff       	call   800ab2 <fd2data>
+  802a43:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	be 00 00 00 00       	mov    $0x0,%esi
+  802a4d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a50:	74 6c                	je     802abe <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802a52:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802a55:	eb 25                	jmp    802a7c <devpipe_read+0x4a>
+  802a57:	8b 13                	mov    (%ebx),%edx
+  802a59:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a5e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802a63:	83 ec 04             	sub    $0x4,%esp
+  802a66:	6a 0a                	push   $0xa
+  802a68:	52                   	push   %edx
+  802a69:	57                   	push   %edi
+  802a6a:	e8 a6 de ff ff       	call   800915 <sys_futex_wait>
+  802a6f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a74:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802a79:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802a7c:	8b 03                	mov    (%ebx),%eax
+  802a7e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a81:	75 19                	jne    802a9c <devpipe_read+0x6a>
+			if (i > 0)
+  802a83:	85 f6                	test   %esi,%esi
+  802a85:	75 3a                	jne    802ac1 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  802a87:	89 da                	mov    %ebx,%edx
+  802a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8c:	e8 e3 fd ff ff       	call   802874 <_pipeisclosed>
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	74 c2                	je     802a57 <devpipe_read+0x25>
+				return 0;
+  802a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9a:	eb 31                	jmp    802acd <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a9c:	89 c1                	mov    %eax,%ecx
+  802a9e:	c1 f9 1f             	sar    $0x1f,%ecx
+  802aa1:	c1 e9 1b             	shr    $0x1b,%ecx
+  802aa4:	01 c8                	add    %ecx,%eax
+  802aa6:	83 e0 1f             	and    $0x1f,%eax
+  802aa9:	29 c8                	sub    %ecx,%eax
+  802aab:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802ab0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ab3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ab6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ab9:	83 c6 01             	add    $0x1,%esi
+  802abc:	eb 8f                	jmp    802a4d <devpipe_read+0x1b>
+out:
+  802abe:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802ac1:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802ac4:	89 da                	mov    %ebx,%edx
+  802ac6:	e8 38 fd ff ff       	call   802803 <pipewake>
+	return i;
+  802acb:	89 f0                	mov    %esi,%eax
+}
+  802acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad0:	5b                   	pop    %ebx
+  802ad1:	5e                   	pop    %esi
+  802ad2:	5f                   	pop    %edi
+  802ad3:	5d                   	pop    %ebp
+  802ad4:	c3                   	ret
+
+00802ad5 <pipe>:
+{
+  802ad5:	55                   	push   %ebp
+  802ad6:	89 e5                	mov    %esp,%ebp
+  802ad8:	56                   	push   %esi
+  802ad9:	53                   	push   %ebx
+  802ada:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802add:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ae0:	50                   	push   %eax
+  802ae1:	e8 e3 df ff ff       	call   800ac9 <fd_alloc>
+  802ae6:	89 c3                	mov    %eax,%ebx
+  802ae8:	83 c4 10             	add    $0x10,%esp
+  802aeb:	85 c0                	test   %eax,%eax
+  802aed:	0f 88 23 01 00 00    	js     802c16 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802af3:	83 ec 04             	sub    $0x4,%esp
+  802af6:	68 07 04 00 00       	push   $0x407
+  802afb:	ff 75 f4             	push   -0xc(%ebp)
+  802afe:	6a 00                	push   $0x0
+  802b00:	e8 fb da ff ff       	call   800600 <sys_page_alloc>
+  802b05:	89 c3                	mov    %eax,%ebx
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	85 c0                	test   %eax,%eax
+  802b0c:	0f 88 04 01 00 00    	js     802c16 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802b12:	83 ec 0c             	sub    $0xc,%esp
+  802b15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b18:	50                   	push   %eax
+  802b19:	e8 ab df ff ff       	call   800ac9 <fd_alloc>
+  802b1e:	89 c3                	mov    %eax,%ebx
+  802b20:	83 c4 10             	add    $0x10,%esp
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	0f 88 db 00 00 00    	js     802c06 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b2b:	83 ec 04             	sub    $0x4,%esp
+  802b2e:	68 07 04 00 00       	push   $0x407
+  802b33:	ff 75 f0             	push   -0x10(%ebp)
+  802b36:	6a 00                	push   $0x0
+  802b38:	e8 c3 da ff ff       	call   800600 <sys_page_alloc>
+  802b3d:	89 c3                	mov    %eax,%ebx
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	85 c0                	test   %eax,%eax
+  802b44:	0f 88 bc 00 00 00    	js     802c06 <pipe+0x131>
+	va = fd2data(fd0);
+  802b4a:	83 ec 0c             	sub    $0xc,%esp
+  802b4d:	ff 75 f4             	push   -0xc(%ebp)
+  802b50:	e8 5d df ff ff       	call   800ab2 <fd2data>
+  802b55:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b57:	83 c4 0c             	add    $0xc,%esp
+  802b5a:	68 07 04 00 00       	push   $0x407
+  802b5f:	50                   	push   %eax
+  802b60:	6a 00                	push   $0x0
+  802b62:	e8 99 da ff ff       	call   800600 <sys_page_alloc>
+  802b67:	89 c3                	mov    %eax,%ebx
+  802b69:	83 c4 10             	add    $0x10,%esp
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	0f 88 82 00 00 00    	js     802bf6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b74:	83 ec 0c             	sub    $0xc,%esp
+  802b77:	ff 75 f0             	push   -0x10(%ebp)
+  802b7a:	e8 33 df ff ff       	call   800ab2 <fd2data>
+  802b7f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b86:	50                   	push   %eax
+  802b87:	6a 00                	push   $0x0
+  802b89:	56                   	push   %esi
+  802b8a:	6a 00                	push   $0x0
+  802b8c:	e8 bc da ff ff       	call   80064d <sys_page_map>
+  802b91:	89 c3                	mov    %eax,%ebx
+  802b93:	83 c4 20             	add    $0x20,%esp
+  802b96:	85 c0                	test   %eax,%eax
+  802b98:	78 4e                	js     802be8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802b9a:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802b9f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ba2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802ba4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ba7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802bae:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802bb1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802bb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802bb6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802bbd:	83 ec 0c             	sub    $0xc,%esp
+  802bc0:	ff 75 f4             	push   -0xc(%ebp)
+  802bc3:	e8 da de ff ff       	call   800aa2 <fd2num>
+  802bc8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bcb:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802bcd:	83 c4 04             	add    $0x4,%esp
+  802bd0:	ff 75 f0             	push   -0x10(%ebp)
+  802bd3:	e8 ca de ff ff       	call   800aa2 <fd2num>
+  802bd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bdb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be6:	eb 2e                	jmp    802c16 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802be8:	83 ec 08             	sub    $0x8,%esp
+  802beb:	56                   	push   %esi
+  802bec:	6a 00                	push   $0x0
+  802bee:	e8 a6 da ff ff       	call   800699 <sys_page_unmap>
+  802bf3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802bf6:	83 ec 08             	sub    $0x8,%esp
+  802bf9:	ff 75 f0             	push   -0x10(%ebp)
+  802bfc:	6a 00                	push   $0x0
+  802bfe:	e8 96 da ff ff       	call   800699 <sys_page_unmap>
+  802c03:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802c06:	83 ec 08             	sub    $0x8,%esp
+  802c09:	ff 75 f4             	push   -0xc(%ebp)
+  802c0c:	6a 00                	push   $0x0
+  802c0e:	e8 86 da ff ff       	call   800699 <sys_page_unmap>
+  802c13:	83 c4 10             	add    $0x10,%esp
+}
+  802c16:	89 d8                	mov    %ebx,%eax
+  802c18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c1b:	5b                   	pop    %ebx
+  802c1c:	5e                   	pop    %esi
+  802c1d:	5d                   	pop    %ebp
+  802c1e:	c3                   	ret
+
+00802c1f <pipeisclosed>:
+{
+  802c1f:	55                   	push   %ebp
+  802c20:	89 e5                	mov    %esp,%ebp
+  802c22:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c28:	50                   	push   %eax
+  802c29:	ff 75 08             	push   0x8(%ebp)
+  802c2c:	e8 ee de ff ff       	call   800b1f <fd_lookup>
+  802c31:	83 c4 10             	add    $0x10,%esp
+  802c34:	85 c0                	test   %eax,%eax
+  802c36:	78 18                	js     802c50 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802c38:	83 ec 0c             	sub    $0xc,%esp
+  802c3b:	ff 75 f4             	push   -0xc(%ebp)
+  802c3e:	e8 6f de ff ff       	call   800ab2 <fd2data>
+  802c43:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802c45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c48:	e8 27 fc ff ff       	call   802874 <_pipeisclosed>
+  802c4d:	83 c4 10             	add    $0x10,%esp
+}
+  802c50:	c9                   	leave
+  802c51:	c3                   	ret
+
+00802c52 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802c52:	55                   	push   %ebp
+  802c53:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c58:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802c5e:	5d                   	pop    %ebp
+  802c5f:	c3                   	ret
+
+00802c60 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	56                   	push   %esi
+  802c64:	53                   	push   %ebx
+  802c65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802c72:	89 d0                	mov    %edx,%eax
+  802c74:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	74 2d                	je     802ca9 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802c7c:	83 f8 02             	cmp    $0x2,%eax
+  802c7f:	74 08                	je     802c89 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802c81:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c86:	f0 87 03             	lock xchg %eax,(%ebx)
+  802c89:	be 02 00 00 00       	mov    $0x2,%esi
+  802c8e:	eb 15                	jmp    802ca5 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802c90:	83 ec 04             	sub    $0x4,%esp
+  802c93:	6a 00                	push   $0x0
+  802c95:	6a 02                	push   $0x2
+  802c97:	53                   	push   %ebx
+  802c98:	e8 78 dc ff ff       	call   800915 <sys_futex_wait>
+  802c9d:	89 f0                	mov    %esi,%eax
+  802c9f:	f0 87 03             	lock xchg %eax,(%ebx)
+  802ca2:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	75 e7                	jne    802c90 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  802ca9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cac:	5b                   	pop    %ebx
+  802cad:	5e                   	pop    %esi
+  802cae:	5d                   	pop    %ebp
+  802caf:	c3                   	ret
+
+00802cb0 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802cc0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  802cc4:	f7 d8                	neg    %eax
+  802cc6:	19 c0                	sbb    %eax,%eax
+  802cc8:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  802ccb:	5d                   	pop    %ebp
+  802ccc:	c3                   	ret
+
+00802ccd <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	83 ec 08             	sub    $0x8,%esp
+  802cd3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  802cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdb:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  802cde:	83 f8 02             	cmp    $0x2,%eax
+  802ce1:	74 02                	je     802ce5 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  802ce5:	83 ec 08             	sub    $0x8,%esp
+  802ce8:	6a 01                	push   $0x1
+  802cea:	52                   	push   %edx
+  802ceb:	e8 54 dc ff ff       	call   800944 <sys_futex_wake>
+  802cf0:	83 c4 10             	add    $0x10,%esp
+}
+  802cf3:	eb ee                	jmp    802ce3 <mutex_unlock+0x16>
+
+00802cf5 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  802cf5:	55                   	push   %ebp
+  802cf6:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  802cf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802d01:	5d                   	pop    %ebp
+  802d02:	c3                   	ret
+
+00802d03 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  802d03:	55                   	push   %ebp
+  802d04:	89 e5                	mov    %esp,%ebp
+  802d06:	57                   	push   %edi
+  802d07:	56                   	push   %esi
+  802d08:	53                   	push   %ebx
+  802d09:	83 ec 18             	sub    $0x18,%esp
+  802d0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  802d12:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  802d14:	53                   	push   %ebx
+  802d15:	e8 b3 ff ff ff       	call   802ccd <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  802d1a:	83 c4 0c             	add    $0xc,%esp
+  802d1d:	ff 75 10             	push   0x10(%ebp)
+  802d20:	57                   	push   %edi
+  802d21:	56                   	push   %esi
+  802d22:	e8 ee db ff ff       	call   800915 <sys_futex_wait>
+  802d27:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	be 02 00 00 00       	mov    $0x2,%esi
+  802d31:	eb 10                	jmp    802d43 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802d33:	83 ec 04             	sub    $0x4,%esp
+  802d36:	6a 00                	push   $0x0
+  802d38:	6a 02                	push   $0x2
+  802d3a:	53                   	push   %ebx
+  802d3b:	e8 d5 db ff ff       	call   800915 <sys_futex_wait>
+  802d40:	83 c4 10             	add    $0x10,%esp
+  802d43:	89 f0                	mov    %esi,%eax
+  802d45:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	75 e7                	jne    802d33 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802d4c:	83 ff ec             	cmp    $0xffffffec,%edi
+  802d4f:	74 05                	je     802d56 <cond_timedwait+0x53>
+  802d51:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802d56:	89 f8                	mov    %edi,%eax
+  802d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d5b:	5b                   	pop    %ebx
+  802d5c:	5e                   	pop    %esi
+  802d5d:	5f                   	pop    %edi
+  802d5e:	5d                   	pop    %ebp
+  802d5f:	c3                   	ret
+
+00802d60 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802d66:	6a 00                	push   $0x0
+  802d68:	ff 75 0c             	push   0xc(%ebp)
+  802d6b:	ff 75 08             	push   0x8(%ebp)
+  802d6e:	e8 90 ff ff ff       	call   802d03 <cond_timedwait>
+}
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+
+00802d78 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  802d78:	55                   	push   %ebp
+  802d79:	89 e5                	mov    %esp,%ebp
+  802d7b:	83 ec 10             	sub    $0x10,%esp
+  802d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802d81:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d86:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  802d8a:	6a 01                	push   $0x1
+  802d8c:	50                   	push   %eax
+  802d8d:	e8 b2 db ff ff       	call   800944 <sys_futex_wake>
+}
+  802d92:	83 c4 10             	add    $0x10,%esp
+  802d95:	c9                   	leave
+  802d96:	c3                   	ret
+
+00802d97 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	83 ec 10             	sub    $0x10,%esp
+  802d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da0:	ba 01 00 00 00       	mov    $0x1,%edx
+  802da5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  802da9:	68 00 04 00 00       	push   $0x400
+  802dae:	50                   	push   %eax
+  802daf:	e8 90 db ff ff       	call   800944 <sys_futex_wake>
+}
+  802db4:	83 c4 10             	add    $0x10,%esp
+  802db7:	c9                   	leave
+  802db8:	c3                   	ret
+
+00802db9 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  802db9:	55                   	push   %ebp
+  802dba:	89 e5                	mov    %esp,%ebp
+  802dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  802dbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802dc2:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  802dc4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  802dcb:	5d                   	pop    %ebp
+  802dcc:	c3                   	ret
+
+00802dcd <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  802dcd:	55                   	push   %ebp
+  802dce:	89 e5                	mov    %esp,%ebp
+  802dd0:	53                   	push   %ebx
+  802dd1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  802dd4:	8b 11                	mov    (%ecx),%edx
+  802dd6:	85 d2                	test   %edx,%edx
+  802dd8:	74 14                	je     802dee <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  802dda:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802ddd:	89 d0                	mov    %edx,%eax
+  802ddf:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  802de3:	39 c2                	cmp    %eax,%edx
+  802de5:	75 ed                	jne    802dd4 <sem_trywait+0x7>
+			return 0;
+  802de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dec:	eb 05                	jmp    802df3 <sem_trywait+0x26>
+	return -E_AGAIN;
+  802dee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  802df3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+
+00802df8 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	57                   	push   %edi
+  802dfc:	56                   	push   %esi
+  802dfd:	53                   	push   %ebx
+  802dfe:	83 ec 1c             	sub    $0x1c,%esp
+  802e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e04:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  802e07:	e8 81 da ff ff       	call   80088d <sys_time_msec>
+  802e0c:	01 f8                	add    %edi,%eax
+  802e0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  802e11:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  802e16:	eb 28                	jmp    802e40 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  802e18:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e1d:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802e22:	83 ec 04             	sub    $0x4,%esp
+  802e25:	56                   	push   %esi
+  802e26:	6a 00                	push   $0x0
+  802e28:	53                   	push   %ebx
+  802e29:	e8 e7 da ff ff       	call   800915 <sys_futex_wait>
+  802e2e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802e33:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802e38:	83 c4 10             	add    $0x10,%esp
+  802e3b:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802e3e:	74 2e                	je     802e6e <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802e40:	83 ec 0c             	sub    $0xc,%esp
+  802e43:	53                   	push   %ebx
+  802e44:	e8 84 ff ff ff       	call   802dcd <sem_trywait>
+  802e49:	83 c4 10             	add    $0x10,%esp
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	79 19                	jns    802e69 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802e50:	85 ff                	test   %edi,%edi
+  802e52:	74 c4                	je     802e18 <sem_timedwait+0x20>
+  802e54:	e8 34 da ff ff       	call   80088d <sys_time_msec>
+  802e59:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e5c:	29 c6                	sub    %eax,%esi
+  802e5e:	85 f6                	test   %esi,%esi
+  802e60:	7f b6                	jg     802e18 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802e62:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802e67:	eb 05                	jmp    802e6e <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802e69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e71:	5b                   	pop    %ebx
+  802e72:	5e                   	pop    %esi
+  802e73:	5f                   	pop    %edi
+  802e74:	5d                   	pop    %ebp
+  802e75:	c3                   	ret
+
+00802e76 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802e76:	55                   	push   %ebp
+  802e77:	89 e5                	mov    %esp,%ebp
+  802e79:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802e7c:	6a 00                	push   $0x0
+  802e7e:	ff 75 08             	push   0x8(%ebp)
+  802e81:	e8 72 ff ff ff       	call   802df8 <sem_timedwait>
+}
+  802e86:	83 c4 10             	add    $0x10,%esp
+  802e89:	c9                   	leave
+  802e8a:	c3                   	ret
+
+00802e8b <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802e8b:	55                   	push   %ebp
+  802e8c:	89 e5                	mov    %esp,%ebp
+  802e8e:	83 ec 08             	sub    $0x8,%esp
+  802e91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e94:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e99:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802e9d:	8b 50 04             	mov    0x4(%eax),%edx
+  802ea0:	85 d2                	test   %edx,%edx
+  802ea2:	75 02                	jne    802ea6 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802ea4:	c9                   	leave
+  802ea5:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802ea6:	83 ec 08             	sub    $0x8,%esp
+  802ea9:	6a 01                	push   $0x1
+  802eab:	50                   	push   %eax
+  802eac:	e8 93 da ff ff       	call   800944 <sys_futex_wake>
+  802eb1:	83 c4 10             	add    $0x10,%esp
+}
+  802eb4:	eb ee                	jmp    802ea4 <sem_post+0x19>
+
+00802eb6 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802eb6:	55                   	push   %ebp
+  802eb7:	89 e5                	mov    %esp,%ebp
+  802eb9:	57                   	push   %edi
+  802eba:	56                   	push   %esi
+  802ebb:	53                   	push   %ebx
+  802ebc:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802ebf:	68 20 60 80 00       	push   $0x806020
+  802ec4:	e8 97 fd ff ff       	call   802c60 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802ec9:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ece:	83 c4 10             	add    $0x10,%esp
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	75 19                	jne    802eee <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802ed5:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802eda:	8b 00                	mov    (%eax),%eax
+  802edc:	8b 40 48             	mov    0x48(%eax),%eax
+  802edf:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802ee4:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802eeb:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802eee:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ef3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ef6:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802efd:	8b 40 04             	mov    0x4(%eax),%eax
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	0f 84 e4 00 00 00    	je     802fec <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802f08:	83 c3 01             	add    $0x1,%ebx
+  802f0b:	83 fb 20             	cmp    $0x20,%ebx
+  802f0e:	75 e3                	jne    802ef3 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802f10:	83 ec 0c             	sub    $0xc,%esp
+  802f13:	68 20 60 80 00       	push   $0x806020
+  802f18:	e8 b0 fd ff ff       	call   802ccd <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802f1d:	83 c4 10             	add    $0x10,%esp
+  802f20:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802f25:	e9 b8 00 00 00       	jmp    802fe2 <pthread_create+0x12c>
+  802f2a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f2d:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802f30:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802f32:	39 f3                	cmp    %esi,%ebx
+  802f34:	73 16                	jae    802f4c <pthread_create+0x96>
+		va -= PGSIZE;
+  802f36:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802f3c:	83 ec 08             	sub    $0x8,%esp
+  802f3f:	56                   	push   %esi
+  802f40:	6a 00                	push   $0x0
+  802f42:	e8 52 d7 ff ff       	call   800699 <sys_page_unmap>
+  802f47:	83 c4 10             	add    $0x10,%esp
+  802f4a:	eb e6                	jmp    802f32 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802f4c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f4f:	83 ec 08             	sub    $0x8,%esp
+  802f52:	ff 75 e4             	push   -0x1c(%ebp)
+  802f55:	6a 00                	push   $0x0
+  802f57:	e8 3d d7 ff ff       	call   800699 <sys_page_unmap>
+	return r;
+  802f5c:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802f5f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f62:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802f69:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802f70:	eb 70                	jmp    802fe2 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802f72:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f75:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802f7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f7f:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802f82:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f85:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802f88:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802f8f:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802f94:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f97:	29 c8                	sub    %ecx,%eax
+  802f99:	85 db                	test   %ebx,%ebx
+  802f9b:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802fa2:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802fa5:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802fac:	83 ec 04             	sub    $0x4,%esp
+  802faf:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802fb4:	29 ca                	sub    %ecx,%edx
+  802fb6:	52                   	push   %edx
+	*--esp = 0;
+  802fb7:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802fba:	50                   	push   %eax
+  802fbb:	68 13 32 80 00       	push   $0x803213
+  802fc0:	e8 24 da ff ff       	call   8009e9 <sys_thread_create>
+  802fc5:	89 c7                	mov    %eax,%edi
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	78 91                	js     802f5f <pthread_create+0xa9>
+	th->th_env = id;
+  802fce:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802fd1:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802fd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fdb:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802fdd:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802fe2:	89 f8                	mov    %edi,%eax
+  802fe4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe7:	5b                   	pop    %ebx
+  802fe8:	5e                   	pop    %esi
+  802fe9:	5f                   	pop    %edi
+  802fea:	5d                   	pop    %ebp
+  802feb:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802fec:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802fef:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ff6:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802ffd:	83 ec 0c             	sub    $0xc,%esp
+  803000:	68 20 60 80 00       	push   $0x806020
+  803005:	e8 c3 fc ff ff       	call   802ccd <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80300a:	89 d9                	mov    %ebx,%ecx
+  80300c:	c1 e1 10             	shl    $0x10,%ecx
+  80300f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803012:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803017:	29 c8                	sub    %ecx,%eax
+  803019:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80301c:	c1 e8 16             	shr    $0x16,%eax
+  80301f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803026:	83 c4 10             	add    $0x10,%esp
+  803029:	a8 01                	test   $0x1,%al
+  80302b:	74 15                	je     803042 <pthread_create+0x18c>
+  80302d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803030:	c1 e8 0c             	shr    $0xc,%eax
+  803033:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80303a:	a8 01                	test   $0x1,%al
+  80303c:	0f 85 30 ff ff ff    	jne    802f72 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803042:	83 ec 04             	sub    $0x4,%esp
+  803045:	6a 07                	push   $0x7
+  803047:	ff 75 e4             	push   -0x1c(%ebp)
+  80304a:	6a 00                	push   $0x0
+  80304c:	e8 af d5 ff ff       	call   800600 <sys_page_alloc>
+  803051:	89 c7                	mov    %eax,%edi
+  803053:	83 c4 10             	add    $0x10,%esp
+  803056:	85 c0                	test   %eax,%eax
+  803058:	0f 88 01 ff ff ff    	js     802f5f <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80305e:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803063:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803066:	29 d0                	sub    %edx,%eax
+  803068:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80306b:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80306d:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803072:	29 d0                	sub    %edx,%eax
+  803074:	89 c7                	mov    %eax,%edi
+  803076:	39 fe                	cmp    %edi,%esi
+  803078:	0f 83 f4 fe ff ff    	jae    802f72 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80307e:	83 ec 04             	sub    $0x4,%esp
+  803081:	6a 07                	push   $0x7
+  803083:	56                   	push   %esi
+  803084:	6a 00                	push   $0x0
+  803086:	e8 75 d5 ff ff       	call   800600 <sys_page_alloc>
+  80308b:	83 c4 10             	add    $0x10,%esp
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	0f 88 94 fe ff ff    	js     802f2a <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803096:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80309c:	eb d8                	jmp    803076 <pthread_create+0x1c0>
+
+0080309e <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80309e:	55                   	push   %ebp
+  80309f:	89 e5                	mov    %esp,%ebp
+  8030a1:	57                   	push   %edi
+  8030a2:	56                   	push   %esi
+  8030a3:	53                   	push   %ebx
+  8030a4:	83 ec 0c             	sub    $0xc,%esp
+  8030a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8030aa:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8030ad:	83 f8 1e             	cmp    $0x1e,%eax
+  8030b0:	0f 87 c7 00 00 00    	ja     80317d <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8030b6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8030b8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8030be:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030c3:	77 12                	ja     8030d7 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030c5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8030ca:	29 d0                	sub    %edx,%eax
+  8030cc:	c1 e8 10             	shr    $0x10,%eax
+  8030cf:	39 c3                	cmp    %eax,%ebx
+  8030d1:	0f 84 ad 00 00 00    	je     803184 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8030d7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8030da:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8030e1:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8030e8:	eb 10                	jmp    8030fa <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8030ea:	83 ec 04             	sub    $0x4,%esp
+  8030ed:	6a 00                	push   $0x0
+  8030ef:	6a 01                	push   $0x1
+  8030f1:	57                   	push   %edi
+  8030f2:	e8 1e d8 ff ff       	call   800915 <sys_futex_wait>
+  8030f7:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8030fa:	8b 46 04             	mov    0x4(%esi),%eax
+  8030fd:	83 f8 01             	cmp    $0x1,%eax
+  803100:	74 e8                	je     8030ea <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803102:	83 f8 02             	cmp    $0x2,%eax
+  803105:	0f 85 80 00 00 00    	jne    80318b <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80310b:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80310e:	c1 e6 02             	shl    $0x2,%esi
+  803111:	eb 05                	jmp    803118 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803113:	e8 bc d4 ff ff       	call   8005d4 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803118:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  80311e:	89 ca                	mov    %ecx,%edx
+  803120:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803126:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803129:	c1 e0 04             	shl    $0x4,%eax
+  80312c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803131:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803134:	39 c1                	cmp    %eax,%ecx
+  803136:	75 12                	jne    80314a <pthread_join+0xac>
+  803138:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80313b:	c1 e0 04             	shl    $0x4,%eax
+  80313e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803143:	8b 40 54             	mov    0x54(%eax),%eax
+  803146:	85 c0                	test   %eax,%eax
+  803148:	75 c9                	jne    803113 <pthread_join+0x75>
+	if (ret_store)
+  80314a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80314e:	74 0f                	je     80315f <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803150:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803153:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  80315a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80315d:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80315f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803162:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803169:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803178:	5b                   	pop    %ebx
+  803179:	5e                   	pop    %esi
+  80317a:	5f                   	pop    %edi
+  80317b:	5d                   	pop    %ebp
+  80317c:	c3                   	ret
+		return -E_INVAL;
+  80317d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803182:	eb f1                	jmp    803175 <pthread_join+0xd7>
+  803184:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803189:	eb ea                	jmp    803175 <pthread_join+0xd7>
+		return -E_INVAL;
+  80318b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803190:	eb e3                	jmp    803175 <pthread_join+0xd7>
+
+00803192 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803192:	55                   	push   %ebp
+  803193:	89 e5                	mov    %esp,%ebp
+  803195:	53                   	push   %ebx
+  803196:	83 ec 04             	sub    $0x4,%esp
+  803199:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80319b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8031a1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8031a6:	77 0c                	ja     8031b4 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8031a8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8031ad:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8031af:	c1 e8 10             	shr    $0x10,%eax
+  8031b2:	75 0a                	jne    8031be <pthread_exit+0x2c>
+		exit();
+  8031b4:	e8 a6 cf ff ff       	call   80015f <exit>
+  8031b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8031be:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8031c5:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8031c8:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  8031cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031d2:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8031d5:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8031dc:	83 ec 08             	sub    $0x8,%esp
+  8031df:	6a 20                	push   $0x20
+  8031e1:	01 c2                	add    %eax,%edx
+  8031e3:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8031ea:	50                   	push   %eax
+  8031eb:	e8 54 d7 ff ff       	call   800944 <sys_futex_wake>
+	sys_env_destroy(0);
+  8031f0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8031f7:	e8 61 d3 ff ff       	call   80055d <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8031fc:	83 c4 0c             	add    $0xc,%esp
+  8031ff:	68 42 49 80 00       	push   $0x804942
+  803204:	68 a5 00 00 00       	push   $0xa5
+  803209:	68 5c 49 80 00       	push   $0x80495c
+  80320e:	e8 cd 03 00 00       	call   8035e0 <_panic>
+
+00803213 <pthread_start>:
+{
+  803213:	55                   	push   %ebp
+  803214:	89 e5                	mov    %esp,%ebp
+  803216:	53                   	push   %ebx
+  803217:	83 ec 04             	sub    $0x4,%esp
+  80321a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80321d:	e8 86 d3 ff ff       	call   8005a8 <sys_getenvid>
+  803222:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803227:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  80322d:	85 db                	test   %ebx,%ebx
+  80322f:	74 0c                	je     80323d <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803231:	89 d9                	mov    %ebx,%ecx
+  803233:	c1 e1 10             	shl    $0x10,%ecx
+  803236:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80323b:	29 ca                	sub    %ecx,%edx
+  80323d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803240:	c1 e0 04             	shl    $0x4,%eax
+  803243:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803248:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80324a:	83 ec 0c             	sub    $0xc,%esp
+  80324d:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803254:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803257:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  80325e:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803265:	89 04 24             	mov    %eax,(%esp)
+  803268:	e8 25 ff ff ff       	call   803192 <pthread_exit>
+
+0080326d <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80326d:	55                   	push   %ebp
+  80326e:	89 e5                	mov    %esp,%ebp
+  803270:	57                   	push   %edi
+  803271:	56                   	push   %esi
+  803272:	53                   	push   %ebx
+  803273:	83 ec 1c             	sub    $0x1c,%esp
+  803276:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803278:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80327e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803285:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80328a:	77 0d                	ja     803299 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80328c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803291:	29 d0                	sub    %edx,%eax
+  803293:	c1 e8 10             	shr    $0x10,%eax
+  803296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80329e:	eb 2f                	jmp    8032cf <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8032a0:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8032a6:	8b 01                	mov    (%ecx),%eax
+  8032a8:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8032ab:	39 c2                	cmp    %eax,%edx
+  8032ad:	75 14                	jne    8032c3 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8032af:	83 ec 0c             	sub    $0xc,%esp
+  8032b2:	57                   	push   %edi
+  8032b3:	e8 a5 d2 ff ff       	call   80055d <sys_env_destroy>
+  8032b8:	83 c4 10             	add    $0x10,%esp
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	0f 88 97 00 00 00    	js     80335a <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8032c3:	83 c3 01             	add    $0x1,%ebx
+  8032c6:	83 fb 20             	cmp    $0x20,%ebx
+  8032c9:	0f 84 d2 00 00 00    	je     8033a1 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8032cf:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8032d2:	74 ef                	je     8032c3 <pthread_kill_others+0x56>
+  8032d4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8032d7:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8032de:	8b 40 04             	mov    0x4(%eax),%eax
+  8032e1:	83 f8 01             	cmp    $0x1,%eax
+  8032e4:	75 dd                	jne    8032c3 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8032e6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8032e9:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8032f0:	89 fe                	mov    %edi,%esi
+  8032f2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8032f8:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8032fb:	c1 e0 04             	shl    $0x4,%eax
+  8032fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803303:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803306:	39 c7                	cmp    %eax,%edi
+  803308:	75 b9                	jne    8032c3 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80330a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80330d:	c1 e0 04             	shl    $0x4,%eax
+  803310:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803315:	8b 40 54             	mov    0x54(%eax),%eax
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	74 a7                	je     8032c3 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80331c:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80331f:	c1 e0 04             	shl    $0x4,%eax
+  803322:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803328:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80332a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803330:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803335:	0f 87 65 ff ff ff    	ja     8032a0 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80333b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803340:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803342:	c1 e8 10             	shr    $0x10,%eax
+  803345:	0f 84 55 ff ff ff    	je     8032a0 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80334b:	c1 e0 10             	shl    $0x10,%eax
+  80334e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803353:	29 c1                	sub    %eax,%ecx
+  803355:	e9 4c ff ff ff       	jmp    8032a6 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80335a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80335d:	c1 e2 04             	shl    $0x4,%edx
+  803360:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803366:	8b 52 48             	mov    0x48(%edx),%edx
+  803369:	39 fa                	cmp    %edi,%edx
+  80336b:	0f 85 52 ff ff ff    	jne    8032c3 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803371:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803374:	c1 e2 04             	shl    $0x4,%edx
+  803377:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80337d:	8b 52 54             	mov    0x54(%edx),%edx
+  803380:	85 d2                	test   %edx,%edx
+  803382:	0f 84 3b ff ff ff    	je     8032c3 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803388:	83 ec 0c             	sub    $0xc,%esp
+  80338b:	50                   	push   %eax
+  80338c:	57                   	push   %edi
+  80338d:	68 6c 49 80 00       	push   $0x80496c
+  803392:	68 bb 00 00 00       	push   $0xbb
+  803397:	68 5c 49 80 00       	push   $0x80495c
+  80339c:	e8 3f 02 00 00       	call   8035e0 <_panic>
+	}
+}
+  8033a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a4:	5b                   	pop    %ebx
+  8033a5:	5e                   	pop    %esi
+  8033a6:	5f                   	pop    %edi
+  8033a7:	5d                   	pop    %ebp
+  8033a8:	c3                   	ret
+
+008033a9 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8033a9:	55                   	push   %ebp
+  8033aa:	89 e5                	mov    %esp,%ebp
+  8033ac:	53                   	push   %ebx
+  8033ad:	83 ec 04             	sub    $0x4,%esp
+  8033b0:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8033b2:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8033b8:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8033be:	0f 87 85 00 00 00    	ja     803449 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8033c4:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8033c9:	29 c3                	sub    %eax,%ebx
+  8033cb:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8033ce:	83 ec 04             	sub    $0x4,%esp
+  8033d1:	68 80 02 00 00       	push   $0x280
+  8033d6:	6a 00                	push   $0x0
+  8033d8:	68 40 60 80 00       	push   $0x806040
+  8033dd:	e8 31 cf ff ff       	call   800313 <memset>
+	threads_mu.m_state = 0;
+  8033e2:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8033e9:	00 00 00 
+	if (self != 0) {
+  8033ec:	83 c4 10             	add    $0x10,%esp
+  8033ef:	85 db                	test   %ebx,%ebx
+  8033f1:	74 51                	je     803444 <pthread_fork_child+0x9b>
+  8033f3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8033f5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8033fb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803400:	77 18                	ja     80341a <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803402:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803407:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803409:	c1 e8 10             	shr    $0x10,%eax
+  80340c:	74 0c                	je     80341a <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80340e:	c1 e0 10             	shl    $0x10,%eax
+  803411:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803416:	29 c2                	sub    %eax,%edx
+  803418:	eb 06                	jmp    803420 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80341a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803420:	8b 02                	mov    (%edx),%eax
+  803422:	8b 48 48             	mov    0x48(%eax),%ecx
+  803425:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80342c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80342f:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803436:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  80343d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803444:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803447:	c9                   	leave
+  803448:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803449:	83 ec 04             	sub    $0x4,%esp
+  80344c:	68 80 02 00 00       	push   $0x280
+  803451:	6a 00                	push   $0x0
+  803453:	68 40 60 80 00       	push   $0x806040
+  803458:	e8 b6 ce ff ff       	call   800313 <memset>
+	threads_mu.m_state = 0;
+  80345d:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803464:	00 00 00 
+  803467:	83 c4 10             	add    $0x10,%esp
+  80346a:	eb d8                	jmp    803444 <pthread_fork_child+0x9b>
+
+0080346c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80346c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803471:	c3                   	ret
+
+00803472 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803472:	55                   	push   %ebp
+  803473:	89 e5                	mov    %esp,%ebp
+  803475:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803478:	68 91 49 80 00       	push   $0x804991
+  80347d:	ff 75 0c             	push   0xc(%ebp)
+  803480:	e8 3d cd ff ff       	call   8001c2 <strcpy>
+	return 0;
+}
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	c9                   	leave
+  80348b:	c3                   	ret
+
+0080348c <devcons_write>:
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	57                   	push   %edi
+  803490:	56                   	push   %esi
+  803491:	53                   	push   %ebx
+  803492:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803498:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80349d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8034a3:	eb 2e                	jmp    8034d3 <devcons_write+0x47>
+		m = n - tot;
+  8034a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034a8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8034aa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034af:	39 c3                	cmp    %eax,%ebx
+  8034b1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8034b4:	83 ec 04             	sub    $0x4,%esp
+  8034b7:	53                   	push   %ebx
+  8034b8:	89 f0                	mov    %esi,%eax
+  8034ba:	03 45 0c             	add    0xc(%ebp),%eax
+  8034bd:	50                   	push   %eax
+  8034be:	57                   	push   %edi
+  8034bf:	e8 84 ce ff ff       	call   800348 <memmove>
+		sys_cputs(buf, m);
+  8034c4:	83 c4 08             	add    $0x8,%esp
+  8034c7:	53                   	push   %ebx
+  8034c8:	57                   	push   %edi
+  8034c9:	e8 38 d0 ff ff       	call   800506 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8034ce:	01 de                	add    %ebx,%esi
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8034d6:	72 cd                	jb     8034a5 <devcons_write+0x19>
+}
+  8034d8:	89 f0                	mov    %esi,%eax
+  8034da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034dd:	5b                   	pop    %ebx
+  8034de:	5e                   	pop    %esi
+  8034df:	5f                   	pop    %edi
+  8034e0:	5d                   	pop    %ebp
+  8034e1:	c3                   	ret
+
+008034e2 <devcons_read>:
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8034e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ed:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034f1:	75 07                	jne    8034fa <devcons_read+0x18>
+  8034f3:	eb 1f                	jmp    803514 <devcons_read+0x32>
+		sys_yield();
+  8034f5:	e8 da d0 ff ff       	call   8005d4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8034fa:	e8 32 d0 ff ff       	call   800531 <sys_cgetc>
+  8034ff:	85 c0                	test   %eax,%eax
+  803501:	74 f2                	je     8034f5 <devcons_read+0x13>
+	if (c < 0)
+  803503:	78 0f                	js     803514 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803505:	83 f8 04             	cmp    $0x4,%eax
+  803508:	74 0c                	je     803516 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80350a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80350d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80350f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803514:	c9                   	leave
+  803515:	c3                   	ret
+		return 0;
+  803516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351b:	eb f7                	jmp    803514 <devcons_read+0x32>
+
+0080351d <cputchar>:
+{
+  80351d:	55                   	push   %ebp
+  80351e:	89 e5                	mov    %esp,%ebp
+  803520:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803523:	8b 45 08             	mov    0x8(%ebp),%eax
+  803526:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803529:	6a 01                	push   $0x1
+  80352b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80352e:	50                   	push   %eax
+  80352f:	e8 d2 cf ff ff       	call   800506 <sys_cputs>
+}
+  803534:	83 c4 10             	add    $0x10,%esp
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+
+00803539 <getchar>:
+{
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80353f:	6a 01                	push   $0x1
+  803541:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803544:	50                   	push   %eax
+  803545:	6a 00                	push   $0x0
+  803547:	e8 63 d8 ff ff       	call   800daf <read>
+	if (r < 0)
+  80354c:	83 c4 10             	add    $0x10,%esp
+  80354f:	85 c0                	test   %eax,%eax
+  803551:	78 06                	js     803559 <getchar+0x20>
+	if (r < 1)
+  803553:	74 06                	je     80355b <getchar+0x22>
+	return c;
+  803555:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803559:	c9                   	leave
+  80355a:	c3                   	ret
+		return -E_EOF;
+  80355b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803560:	eb f7                	jmp    803559 <getchar+0x20>
+
+00803562 <iscons>:
+{
+  803562:	55                   	push   %ebp
+  803563:	89 e5                	mov    %esp,%ebp
+  803565:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803568:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80356b:	50                   	push   %eax
+  80356c:	ff 75 08             	push   0x8(%ebp)
+  80356f:	e8 ab d5 ff ff       	call   800b1f <fd_lookup>
+  803574:	83 c4 10             	add    $0x10,%esp
+  803577:	85 c0                	test   %eax,%eax
+  803579:	78 11                	js     80358c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80357b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357e:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803584:	39 10                	cmp    %edx,(%eax)
+  803586:	0f 94 c0             	sete   %al
+  803589:	0f b6 c0             	movzbl %al,%eax
+}
+  80358c:	c9                   	leave
+  80358d:	c3                   	ret
+
+0080358e <opencons>:
+{
+  80358e:	55                   	push   %ebp
+  80358f:	89 e5                	mov    %esp,%ebp
+  803591:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803594:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803597:	50                   	push   %eax
+  803598:	e8 2c d5 ff ff       	call   800ac9 <fd_alloc>
+  80359d:	83 c4 10             	add    $0x10,%esp
+  8035a0:	85 c0                	test   %eax,%eax
+  8035a2:	78 3a                	js     8035de <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035a4:	83 ec 04             	sub    $0x4,%esp
+  8035a7:	68 07 04 00 00       	push   $0x407
+  8035ac:	ff 75 f4             	push   -0xc(%ebp)
+  8035af:	6a 00                	push   $0x0
+  8035b1:	e8 4a d0 ff ff       	call   800600 <sys_page_alloc>
+  8035b6:	83 c4 10             	add    $0x10,%esp
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	78 21                	js     8035de <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c0:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8035c6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8035c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035cb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8035d2:	83 ec 0c             	sub    $0xc,%esp
+  8035d5:	50                   	push   %eax
+  8035d6:	e8 c7 d4 ff ff       	call   800aa2 <fd2num>
+  8035db:	83 c4 10             	add    $0x10,%esp
+}
+  8035de:	c9                   	leave
+  8035df:	c3                   	ret
+
+008035e0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8035e0:	55                   	push   %ebp
+  8035e1:	89 e5                	mov    %esp,%ebp
+  8035e3:	56                   	push   %esi
+  8035e4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8035e5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8035e8:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8035ee:	e8 b5 cf ff ff       	call   8005a8 <sys_getenvid>
+  8035f3:	83 ec 0c             	sub    $0xc,%esp
+  8035f6:	ff 75 0c             	push   0xc(%ebp)
+  8035f9:	ff 75 08             	push   0x8(%ebp)
+  8035fc:	56                   	push   %esi
+  8035fd:	50                   	push   %eax
+  8035fe:	68 a0 49 80 00       	push   $0x8049a0
+  803603:	e8 b3 00 00 00       	call   8036bb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803608:	83 c4 18             	add    $0x18,%esp
+  80360b:	53                   	push   %ebx
+  80360c:	ff 75 10             	push   0x10(%ebp)
+  80360f:	e8 56 00 00 00       	call   80366a <vcprintf>
+	cprintf("\n");
+  803614:	c7 04 24 72 4e 80 00 	movl   $0x804e72,(%esp)
+  80361b:	e8 9b 00 00 00       	call   8036bb <cprintf>
+  803620:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803623:	cc                   	int3
+	while (1)
+  803624:	eb fd                	jmp    803623 <_panic+0x43>
+
+00803626 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803626:	55                   	push   %ebp
+  803627:	89 e5                	mov    %esp,%ebp
+  803629:	53                   	push   %ebx
+  80362a:	83 ec 04             	sub    $0x4,%esp
+  80362d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803630:	8b 13                	mov    (%ebx),%edx
+  803632:	8d 42 01             	lea    0x1(%edx),%eax
+  803635:	89 03                	mov    %eax,(%ebx)
+  803637:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80363a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80363e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803643:	74 09                	je     80364e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803645:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803649:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80364c:	c9                   	leave
+  80364d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80364e:	83 ec 08             	sub    $0x8,%esp
+  803651:	68 ff 00 00 00       	push   $0xff
+  803656:	8d 43 08             	lea    0x8(%ebx),%eax
+  803659:	50                   	push   %eax
+  80365a:	e8 a7 ce ff ff       	call   800506 <sys_cputs>
+		b->idx = 0;
+  80365f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803665:	83 c4 10             	add    $0x10,%esp
+  803668:	eb db                	jmp    803645 <putch+0x1f>
+
+0080366a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80366a:	55                   	push   %ebp
+  80366b:	89 e5                	mov    %esp,%ebp
+  80366d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803673:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80367a:	00 00 00 
+	b.cnt = 0;
+  80367d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803684:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803687:	ff 75 0c             	push   0xc(%ebp)
+  80368a:	ff 75 08             	push   0x8(%ebp)
+  80368d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803693:	50                   	push   %eax
+  803694:	68 26 36 80 00       	push   $0x803626
+  803699:	e8 14 01 00 00       	call   8037b2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80369e:	83 c4 08             	add    $0x8,%esp
+  8036a1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8036a7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8036ad:	50                   	push   %eax
+  8036ae:	e8 53 ce ff ff       	call   800506 <sys_cputs>
+
+	return b.cnt;
+}
+  8036b3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8036b9:	c9                   	leave
+  8036ba:	c3                   	ret
+
+008036bb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8036bb:	55                   	push   %ebp
+  8036bc:	89 e5                	mov    %esp,%ebp
+  8036be:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8036c1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8036c4:	50                   	push   %eax
+  8036c5:	ff 75 08             	push   0x8(%ebp)
+  8036c8:	e8 9d ff ff ff       	call   80366a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8036cd:	c9                   	leave
+  8036ce:	c3                   	ret
+
+008036cf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8036cf:	55                   	push   %ebp
+  8036d0:	89 e5                	mov    %esp,%ebp
+  8036d2:	57                   	push   %edi
+  8036d3:	56                   	push   %esi
+  8036d4:	53                   	push   %ebx
+  8036d5:	83 ec 1c             	sub    $0x1c,%esp
+  8036d8:	89 c7                	mov    %eax,%edi
+  8036da:	89 d6                	mov    %edx,%esi
+  8036dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036e2:	89 d1                	mov    %edx,%ecx
+  8036e4:	89 c2                	mov    %eax,%edx
+  8036e6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8036e9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8036ec:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036ef:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8036f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8036f5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8036fc:	39 c2                	cmp    %eax,%edx
+  8036fe:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803701:	72 3e                	jb     803741 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  803703:	83 ec 0c             	sub    $0xc,%esp
+  803706:	ff 75 18             	push   0x18(%ebp)
+  803709:	83 eb 01             	sub    $0x1,%ebx
+  80370c:	53                   	push   %ebx
+  80370d:	50                   	push   %eax
+  80370e:	83 ec 08             	sub    $0x8,%esp
+  803711:	ff 75 e4             	push   -0x1c(%ebp)
+  803714:	ff 75 e0             	push   -0x20(%ebp)
+  803717:	ff 75 dc             	push   -0x24(%ebp)
+  80371a:	ff 75 d8             	push   -0x28(%ebp)
+  80371d:	e8 c8 0e 00 00       	call   8045ea <__udivdi3>
+  803722:	83 c4 18             	add    $0x18,%esp
+  803725:	52                   	push   %edx
+  803726:	50                   	push   %eax
+  803727:	89 f2                	mov    %esi,%edx
+  803729:	89 f8                	mov    %edi,%eax
+  80372b:	e8 9f ff ff ff       	call   8036cf <printnum>
+  803730:	83 c4 20             	add    $0x20,%esp
+  803733:	eb 13                	jmp    803748 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803735:	83 ec 08             	sub    $0x8,%esp
+  803738:	56                   	push   %esi
+  803739:	ff 75 18             	push   0x18(%ebp)
+  80373c:	ff d7                	call   *%edi
+  80373e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803741:	83 eb 01             	sub    $0x1,%ebx
+  803744:	85 db                	test   %ebx,%ebx
+  803746:	7f ed                	jg     803735 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  803748:	83 ec 08             	sub    $0x8,%esp
+  80374b:	56                   	push   %esi
+  80374c:	83 ec 04             	sub    $0x4,%esp
+  80374f:	ff 75 e4             	push   -0x1c(%ebp)
+  803752:	ff 75 e0             	push   -0x20(%ebp)
+  803755:	ff 75 dc             	push   -0x24(%ebp)
+  803758:	ff 75 d8             	push   -0x28(%ebp)
+  80375b:	e8 ab 0e 00 00       	call   80460b <__umoddi3>
+  803760:	83 c4 14             	add    $0x14,%esp
+  803763:	0f be 80 c3 49 80 00 	movsbl 0x8049c3(%eax),%eax
+  80376a:	50                   	push   %eax
+  80376b:	ff d7                	call   *%edi
+}
+  80376d:	83 c4 10             	add    $0x10,%esp
+  803770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803773:	5b                   	pop    %ebx
+  803774:	5e                   	pop    %esi
+  803775:	5f                   	pop    %edi
+  803776:	5d                   	pop    %ebp
+  803777:	c3                   	ret
+
+00803778 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803778:	55                   	push   %ebp
+  803779:	89 e5                	mov    %esp,%ebp
+  80377b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80377e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803782:	8b 10                	mov    (%eax),%edx
+  803784:	3b 50 04             	cmp    0x4(%eax),%edx
+  803787:	73 0a                	jae    803793 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803789:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80378c:	89 08                	mov    %ecx,(%eax)
+  80378e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803791:	88 02                	mov    %al,(%edx)
+}
+  803793:	5d                   	pop    %ebp
+  803794:	c3                   	ret
+
+00803795 <printfmt>:
+{
+  803795:	55                   	push   %ebp
+  803796:	89 e5                	mov    %esp,%ebp
+  803798:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80379b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80379e:	50                   	push   %eax
+  80379f:	ff 75 10             	push   0x10(%ebp)
+  8037a2:	ff 75 0c             	push   0xc(%ebp)
+  8037a5:	ff 75 08             	push   0x8(%ebp)
+  8037a8:	e8 05 00 00 00       	call   8037b2 <vprintfmt>
+}
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	c9                   	leave
+  8037b1:	c3                   	ret
+
+008037b2 <vprintfmt>:
+{
+  8037b2:	55                   	push   %ebp
+  8037b3:	89 e5                	mov    %esp,%ebp
+  8037b5:	57                   	push   %edi
+  8037b6:	56                   	push   %esi
+  8037b7:	53                   	push   %ebx
+  8037b8:	83 ec 2c             	sub    $0x2c,%esp
+  8037bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8037c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8037c4:	eb 0a                	jmp    8037d0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8037c6:	83 ec 08             	sub    $0x8,%esp
+  8037c9:	53                   	push   %ebx
+  8037ca:	50                   	push   %eax
+  8037cb:	ff d6                	call   *%esi
+  8037cd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8037d0:	83 c7 01             	add    $0x1,%edi
+  8037d3:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8037d7:	83 f8 25             	cmp    $0x25,%eax
+  8037da:	74 0c                	je     8037e8 <vprintfmt+0x36>
+			if (ch == '\0')
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	75 e6                	jne    8037c6 <vprintfmt+0x14>
+}
+  8037e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037e3:	5b                   	pop    %ebx
+  8037e4:	5e                   	pop    %esi
+  8037e5:	5f                   	pop    %edi
+  8037e6:	5d                   	pop    %ebp
+  8037e7:	c3                   	ret
+		padc = ' ';
+  8037e8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8037ec:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8037f3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8037fa:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  803801:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  803806:	8d 47 01             	lea    0x1(%edi),%eax
+  803809:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80380c:	0f b6 17             	movzbl (%edi),%edx
+  80380f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  803812:	3c 55                	cmp    $0x55,%al
+  803814:	0f 87 c5 03 00 00    	ja     803bdf <vprintfmt+0x42d>
+  80381a:	0f b6 c0             	movzbl %al,%eax
+  80381d:	ff 24 85 40 4b 80 00 	jmp    *0x804b40(,%eax,4)
+  803824:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  803827:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80382a:	eb da                	jmp    803806 <vprintfmt+0x54>
+  80382c:	0f be d2             	movsbl %dl,%edx
+  80382f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803832:	b8 00 00 00 00       	mov    $0x0,%eax
+  803837:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80383a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80383d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803841:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803844:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803847:	83 f9 09             	cmp    $0x9,%ecx
+  80384a:	77 55                	ja     8038a1 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80384c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80384f:	eb e9                	jmp    80383a <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803851:	8b 45 14             	mov    0x14(%ebp),%eax
+  803854:	8b 00                	mov    (%eax),%eax
+  803856:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80385c:	8d 40 04             	lea    0x4(%eax),%eax
+  80385f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803862:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803865:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803869:	79 9b                	jns    803806 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80386b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80386e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803871:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  803878:	eb 8c                	jmp    803806 <vprintfmt+0x54>
+			if (width < 0)
+  80387a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80387d:	85 d2                	test   %edx,%edx
+  80387f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803884:	0f 49 c2             	cmovns %edx,%eax
+  803887:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80388a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80388d:	e9 74 ff ff ff       	jmp    803806 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803892:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803895:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80389c:	e9 65 ff ff ff       	jmp    803806 <vprintfmt+0x54>
+  8038a1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8038a7:	eb bc                	jmp    803865 <vprintfmt+0xb3>
+			lflag++;
+  8038a9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8038ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8038af:	e9 52 ff ff ff       	jmp    803806 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8038b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8038b7:	8d 78 04             	lea    0x4(%eax),%edi
+  8038ba:	83 ec 08             	sub    $0x8,%esp
+  8038bd:	53                   	push   %ebx
+  8038be:	ff 30                	push   (%eax)
+  8038c0:	ff d6                	call   *%esi
+			break;
+  8038c2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8038c5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8038c8:	e9 b1 02 00 00       	jmp    803b7e <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8038cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8038d0:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8038d3:	8b 10                	mov    (%eax),%edx
+  8038d5:	89 d0                	mov    %edx,%eax
+  8038d7:	f7 d8                	neg    %eax
+  8038d9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8038dc:	83 f8 14             	cmp    $0x14,%eax
+  8038df:	7f 23                	jg     803904 <vprintfmt+0x152>
+  8038e1:	8b 14 85 a0 4c 80 00 	mov    0x804ca0(,%eax,4),%edx
+  8038e8:	85 d2                	test   %edx,%edx
+  8038ea:	74 18                	je     803904 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8038ec:	52                   	push   %edx
+  8038ed:	68 6b 48 80 00       	push   $0x80486b
+  8038f2:	53                   	push   %ebx
+  8038f3:	56                   	push   %esi
+  8038f4:	e8 9c fe ff ff       	call   803795 <printfmt>
+  8038f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8038fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8038ff:	e9 7a 02 00 00       	jmp    803b7e <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  803904:	50                   	push   %eax
+  803905:	68 db 49 80 00       	push   $0x8049db
+  80390a:	53                   	push   %ebx
+  80390b:	56                   	push   %esi
+  80390c:	e8 84 fe ff ff       	call   803795 <printfmt>
+  803911:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803914:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  803917:	e9 62 02 00 00       	jmp    803b7e <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80391c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80391f:	83 c0 04             	add    $0x4,%eax
+  803922:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803925:	8b 45 14             	mov    0x14(%ebp),%eax
+  803928:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80392a:	85 c9                	test   %ecx,%ecx
+  80392c:	b8 d4 49 80 00       	mov    $0x8049d4,%eax
+  803931:	0f 45 c1             	cmovne %ecx,%eax
+  803934:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803937:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80393b:	7e 06                	jle    803943 <vprintfmt+0x191>
+  80393d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803941:	75 0b                	jne    80394e <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803943:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803946:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803949:	89 75 08             	mov    %esi,0x8(%ebp)
+  80394c:	eb 5c                	jmp    8039aa <vprintfmt+0x1f8>
+  80394e:	83 ec 08             	sub    $0x8,%esp
+  803951:	ff 75 d0             	push   -0x30(%ebp)
+  803954:	ff 75 cc             	push   -0x34(%ebp)
+  803957:	e8 43 c8 ff ff       	call   80019f <strnlen>
+  80395c:	89 c2                	mov    %eax,%edx
+  80395e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803961:	29 d0                	sub    %edx,%eax
+  803963:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803966:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80396a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80396d:	89 75 08             	mov    %esi,0x8(%ebp)
+  803970:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803972:	eb 0e                	jmp    803982 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  803974:	83 ec 08             	sub    $0x8,%esp
+  803977:	53                   	push   %ebx
+  803978:	57                   	push   %edi
+  803979:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80397c:	83 ee 01             	sub    $0x1,%esi
+  80397f:	83 c4 10             	add    $0x10,%esp
+  803982:	85 f6                	test   %esi,%esi
+  803984:	7f ee                	jg     803974 <vprintfmt+0x1c2>
+  803986:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803989:	8b 75 08             	mov    0x8(%ebp),%esi
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803993:	0f 49 d0             	cmovns %eax,%edx
+  803996:	29 d0                	sub    %edx,%eax
+  803998:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80399b:	eb a6                	jmp    803943 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80399d:	83 ec 08             	sub    $0x8,%esp
+  8039a0:	53                   	push   %ebx
+  8039a1:	52                   	push   %edx
+  8039a2:	ff 55 08             	call   *0x8(%ebp)
+  8039a5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8039a8:	89 f1                	mov    %esi,%ecx
+  8039aa:	8d 71 01             	lea    0x1(%ecx),%esi
+  8039ad:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8039b1:	0f be d0             	movsbl %al,%edx
+  8039b4:	85 d2                	test   %edx,%edx
+  8039b6:	74 28                	je     8039e0 <vprintfmt+0x22e>
+  8039b8:	85 ff                	test   %edi,%edi
+  8039ba:	78 05                	js     8039c1 <vprintfmt+0x20f>
+  8039bc:	83 ef 01             	sub    $0x1,%edi
+  8039bf:	78 30                	js     8039f1 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8039c1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8039c5:	74 d6                	je     80399d <vprintfmt+0x1eb>
+  8039c7:	0f be c0             	movsbl %al,%eax
+  8039ca:	83 e8 20             	sub    $0x20,%eax
+  8039cd:	83 f8 5e             	cmp    $0x5e,%eax
+  8039d0:	76 cb                	jbe    80399d <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8039d2:	83 ec 08             	sub    $0x8,%esp
+  8039d5:	53                   	push   %ebx
+  8039d6:	6a 3f                	push   $0x3f
+  8039d8:	ff 55 08             	call   *0x8(%ebp)
+  8039db:	83 c4 10             	add    $0x10,%esp
+  8039de:	eb c8                	jmp    8039a8 <vprintfmt+0x1f6>
+  8039e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039e3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8039e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8039e9:	01 d0                	add    %edx,%eax
+  8039eb:	29 c8                	sub    %ecx,%eax
+  8039ed:	89 c7                	mov    %eax,%edi
+  8039ef:	eb 13                	jmp    803a04 <vprintfmt+0x252>
+  8039f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039f4:	eb ed                	jmp    8039e3 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8039f6:	83 ec 08             	sub    $0x8,%esp
+  8039f9:	53                   	push   %ebx
+  8039fa:	6a 20                	push   $0x20
+  8039fc:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8039fe:	83 ef 01             	sub    $0x1,%edi
+  803a01:	83 c4 10             	add    $0x10,%esp
+  803a04:	85 ff                	test   %edi,%edi
+  803a06:	7f ee                	jg     8039f6 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803a08:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  803a0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  803a0e:	e9 6b 01 00 00       	jmp    803b7e <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  803a13:	83 f9 01             	cmp    $0x1,%ecx
+  803a16:	7f 1f                	jg     803a37 <vprintfmt+0x285>
+	else if (lflag)
+  803a18:	85 c9                	test   %ecx,%ecx
+  803a1a:	74 67                	je     803a83 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  803a1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a1f:	8b 00                	mov    (%eax),%eax
+  803a21:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803a24:	89 c1                	mov    %eax,%ecx
+  803a26:	c1 f9 1f             	sar    $0x1f,%ecx
+  803a29:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803a2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a2f:	8d 40 04             	lea    0x4(%eax),%eax
+  803a32:	89 45 14             	mov    %eax,0x14(%ebp)
+  803a35:	eb 17                	jmp    803a4e <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  803a37:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a3a:	8b 50 04             	mov    0x4(%eax),%edx
+  803a3d:	8b 00                	mov    (%eax),%eax
+  803a3f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803a42:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803a45:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a48:	8d 40 08             	lea    0x8(%eax),%eax
+  803a4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803a4e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803a51:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803a54:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803a59:	85 c9                	test   %ecx,%ecx
+  803a5b:	0f 89 03 01 00 00    	jns    803b64 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803a61:	83 ec 08             	sub    $0x8,%esp
+  803a64:	53                   	push   %ebx
+  803a65:	6a 2d                	push   $0x2d
+  803a67:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803a69:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803a6c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803a6f:	f7 da                	neg    %edx
+  803a71:	83 d1 00             	adc    $0x0,%ecx
+  803a74:	f7 d9                	neg    %ecx
+  803a76:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803a79:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803a7e:	e9 e1 00 00 00       	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  803a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a86:	8b 00                	mov    (%eax),%eax
+  803a88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803a8b:	89 c1                	mov    %eax,%ecx
+  803a8d:	c1 f9 1f             	sar    $0x1f,%ecx
+  803a90:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803a93:	8b 45 14             	mov    0x14(%ebp),%eax
+  803a96:	8d 40 04             	lea    0x4(%eax),%eax
+  803a99:	89 45 14             	mov    %eax,0x14(%ebp)
+  803a9c:	eb b0                	jmp    803a4e <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803a9e:	83 f9 01             	cmp    $0x1,%ecx
+  803aa1:	7f 1e                	jg     803ac1 <vprintfmt+0x30f>
+	else if (lflag)
+  803aa3:	85 c9                	test   %ecx,%ecx
+  803aa5:	74 32                	je     803ad9 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  803aa7:	8b 45 14             	mov    0x14(%ebp),%eax
+  803aaa:	8b 10                	mov    (%eax),%edx
+  803aac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ab1:	8d 40 04             	lea    0x4(%eax),%eax
+  803ab4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803ab7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  803abc:	e9 a3 00 00 00       	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803ac1:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ac4:	8b 10                	mov    (%eax),%edx
+  803ac6:	8b 48 04             	mov    0x4(%eax),%ecx
+  803ac9:	8d 40 08             	lea    0x8(%eax),%eax
+  803acc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803acf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  803ad4:	e9 8b 00 00 00       	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803ad9:	8b 45 14             	mov    0x14(%ebp),%eax
+  803adc:	8b 10                	mov    (%eax),%edx
+  803ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ae3:	8d 40 04             	lea    0x4(%eax),%eax
+  803ae6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803ae9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  803aee:	eb 74                	jmp    803b64 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  803af0:	83 f9 01             	cmp    $0x1,%ecx
+  803af3:	7f 1b                	jg     803b10 <vprintfmt+0x35e>
+	else if (lflag)
+  803af5:	85 c9                	test   %ecx,%ecx
+  803af7:	74 2c                	je     803b25 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  803af9:	8b 45 14             	mov    0x14(%ebp),%eax
+  803afc:	8b 10                	mov    (%eax),%edx
+  803afe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b03:	8d 40 04             	lea    0x4(%eax),%eax
+  803b06:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803b09:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  803b0e:	eb 54                	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803b10:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b13:	8b 10                	mov    (%eax),%edx
+  803b15:	8b 48 04             	mov    0x4(%eax),%ecx
+  803b18:	8d 40 08             	lea    0x8(%eax),%eax
+  803b1b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803b1e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  803b23:	eb 3f                	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803b25:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b28:	8b 10                	mov    (%eax),%edx
+  803b2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b2f:	8d 40 04             	lea    0x4(%eax),%eax
+  803b32:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803b35:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803b3a:	eb 28                	jmp    803b64 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803b3c:	83 ec 08             	sub    $0x8,%esp
+  803b3f:	53                   	push   %ebx
+  803b40:	6a 30                	push   $0x30
+  803b42:	ff d6                	call   *%esi
+			putch('x', putdat);
+  803b44:	83 c4 08             	add    $0x8,%esp
+  803b47:	53                   	push   %ebx
+  803b48:	6a 78                	push   $0x78
+  803b4a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803b4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b4f:	8b 10                	mov    (%eax),%edx
+  803b51:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803b56:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803b59:	8d 40 04             	lea    0x4(%eax),%eax
+  803b5c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803b5f:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803b64:	83 ec 0c             	sub    $0xc,%esp
+  803b67:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803b6b:	50                   	push   %eax
+  803b6c:	ff 75 e0             	push   -0x20(%ebp)
+  803b6f:	57                   	push   %edi
+  803b70:	51                   	push   %ecx
+  803b71:	52                   	push   %edx
+  803b72:	89 da                	mov    %ebx,%edx
+  803b74:	89 f0                	mov    %esi,%eax
+  803b76:	e8 54 fb ff ff       	call   8036cf <printnum>
+			break;
+  803b7b:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803b7e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803b81:	e9 4a fc ff ff       	jmp    8037d0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803b86:	83 f9 01             	cmp    $0x1,%ecx
+  803b89:	7f 1b                	jg     803ba6 <vprintfmt+0x3f4>
+	else if (lflag)
+  803b8b:	85 c9                	test   %ecx,%ecx
+  803b8d:	74 2c                	je     803bbb <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803b8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b92:	8b 10                	mov    (%eax),%edx
+  803b94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b99:	8d 40 04             	lea    0x4(%eax),%eax
+  803b9c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803b9f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  803ba4:	eb be                	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803ba6:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ba9:	8b 10                	mov    (%eax),%edx
+  803bab:	8b 48 04             	mov    0x4(%eax),%ecx
+  803bae:	8d 40 08             	lea    0x8(%eax),%eax
+  803bb1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803bb4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  803bb9:	eb a9                	jmp    803b64 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803bbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  803bbe:	8b 10                	mov    (%eax),%edx
+  803bc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bc5:	8d 40 04             	lea    0x4(%eax),%eax
+  803bc8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803bcb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  803bd0:	eb 92                	jmp    803b64 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  803bd2:	83 ec 08             	sub    $0x8,%esp
+  803bd5:	53                   	push   %ebx
+  803bd6:	6a 25                	push   $0x25
+  803bd8:	ff d6                	call   *%esi
+			break;
+  803bda:	83 c4 10             	add    $0x10,%esp
+  803bdd:	eb 9f                	jmp    803b7e <vprintfmt+0x3cc>
+			putch('%', putdat);
+  803bdf:	83 ec 08             	sub    $0x8,%esp
+  803be2:	53                   	push   %ebx
+  803be3:	6a 25                	push   $0x25
+  803be5:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803be7:	83 c4 10             	add    $0x10,%esp
+  803bea:	89 f8                	mov    %edi,%eax
+  803bec:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  803bf0:	74 05                	je     803bf7 <vprintfmt+0x445>
+  803bf2:	83 e8 01             	sub    $0x1,%eax
+  803bf5:	eb f5                	jmp    803bec <vprintfmt+0x43a>
+  803bf7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803bfa:	eb 82                	jmp    803b7e <vprintfmt+0x3cc>
+
+00803bfc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803bfc:	55                   	push   %ebp
+  803bfd:	89 e5                	mov    %esp,%ebp
+  803bff:	83 ec 18             	sub    $0x18,%esp
+  803c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c05:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803c08:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803c0b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803c0f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803c12:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803c19:	85 c0                	test   %eax,%eax
+  803c1b:	74 26                	je     803c43 <vsnprintf+0x47>
+  803c1d:	85 d2                	test   %edx,%edx
+  803c1f:	7e 22                	jle    803c43 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803c21:	ff 75 14             	push   0x14(%ebp)
+  803c24:	ff 75 10             	push   0x10(%ebp)
+  803c27:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803c2a:	50                   	push   %eax
+  803c2b:	68 78 37 80 00       	push   $0x803778
+  803c30:	e8 7d fb ff ff       	call   8037b2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803c35:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803c38:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803c3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c3e:	83 c4 10             	add    $0x10,%esp
+}
+  803c41:	c9                   	leave
+  803c42:	c3                   	ret
+		return -E_INVAL;
+  803c43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c48:	eb f7                	jmp    803c41 <vsnprintf+0x45>
+
+00803c4a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803c4a:	55                   	push   %ebp
+  803c4b:	89 e5                	mov    %esp,%ebp
+  803c4d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803c50:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803c53:	50                   	push   %eax
+  803c54:	ff 75 10             	push   0x10(%ebp)
+  803c57:	ff 75 0c             	push   0xc(%ebp)
+  803c5a:	ff 75 08             	push   0x8(%ebp)
+  803c5d:	e8 9a ff ff ff       	call   803bfc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803c62:	c9                   	leave
+  803c63:	c3                   	ret
+
+00803c64 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c64:	55                   	push   %ebp
+  803c65:	89 e5                	mov    %esp,%ebp
+  803c67:	57                   	push   %edi
+  803c68:	56                   	push   %esi
+  803c69:	53                   	push   %ebx
+  803c6a:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c6d:	89 d6                	mov    %edx,%esi
+  803c6f:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c72:	89 cf                	mov    %ecx,%edi
+  803c74:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c77:	89 fa                	mov    %edi,%edx
+  803c79:	80 ce 08             	or     $0x8,%dh
+  803c7c:	f6 c5 08             	test   $0x8,%ch
+  803c7f:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c82:	57                   	push   %edi
+  803c83:	56                   	push   %esi
+  803c84:	50                   	push   %eax
+  803c85:	56                   	push   %esi
+  803c86:	6a 00                	push   $0x0
+  803c88:	e8 c0 c9 ff ff       	call   80064d <sys_page_map>
+	if (r < 0) {
+  803c8d:	83 c4 20             	add    $0x20,%esp
+  803c90:	85 c0                	test   %eax,%eax
+  803c92:	78 27                	js     803cbb <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c94:	83 ec 0c             	sub    $0xc,%esp
+  803c97:	57                   	push   %edi
+  803c98:	56                   	push   %esi
+  803c99:	6a 00                	push   $0x0
+  803c9b:	56                   	push   %esi
+  803c9c:	6a 00                	push   $0x0
+  803c9e:	e8 aa c9 ff ff       	call   80064d <sys_page_map>
+  803ca3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ca5:	83 c4 20             	add    $0x20,%esp
+  803ca8:	85 c0                	test   %eax,%eax
+  803caa:	78 24                	js     803cd0 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803cac:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cb1:	89 d8                	mov    %ebx,%eax
+  803cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cb6:	5b                   	pop    %ebx
+  803cb7:	5e                   	pop    %esi
+  803cb8:	5f                   	pop    %edi
+  803cb9:	5d                   	pop    %ebp
+  803cba:	c3                   	ret
+  803cbb:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cbd:	83 ec 08             	sub    $0x8,%esp
+  803cc0:	50                   	push   %eax
+  803cc1:	68 38 4d 80 00       	push   $0x804d38
+  803cc6:	e8 f0 f9 ff ff       	call   8036bb <cprintf>
+		return r;
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	eb e1                	jmp    803cb1 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803cd0:	83 ec 08             	sub    $0x8,%esp
+  803cd3:	50                   	push   %eax
+  803cd4:	68 68 4d 80 00       	push   $0x804d68
+  803cd9:	e8 dd f9 ff ff       	call   8036bb <cprintf>
+		return r;
+  803cde:	83 c4 10             	add    $0x10,%esp
+  803ce1:	eb ce                	jmp    803cb1 <duppage_cow+0x4d>
+
+00803ce3 <duppage>:
+{
+  803ce3:	55                   	push   %ebp
+  803ce4:	89 e5                	mov    %esp,%ebp
+  803ce6:	53                   	push   %ebx
+  803ce7:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803cea:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803ced:	51                   	push   %ecx
+  803cee:	52                   	push   %edx
+  803cef:	50                   	push   %eax
+  803cf0:	52                   	push   %edx
+  803cf1:	6a 00                	push   $0x0
+  803cf3:	e8 55 c9 ff ff       	call   80064d <sys_page_map>
+	if (r < 0) {
+  803cf8:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d00:	85 c0                	test   %eax,%eax
+  803d02:	78 07                	js     803d0b <duppage+0x28>
+}
+  803d04:	89 d8                	mov    %ebx,%eax
+  803d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+  803d0b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d0d:	83 ec 08             	sub    $0x8,%esp
+  803d10:	50                   	push   %eax
+  803d11:	68 38 4d 80 00       	push   $0x804d38
+  803d16:	e8 a0 f9 ff ff       	call   8036bb <cprintf>
+		return r;
+  803d1b:	83 c4 10             	add    $0x10,%esp
+  803d1e:	eb e4                	jmp    803d04 <duppage+0x21>
+
+00803d20 <cow_copy>:
+{
+  803d20:	55                   	push   %ebp
+  803d21:	89 e5                	mov    %esp,%ebp
+  803d23:	56                   	push   %esi
+  803d24:	53                   	push   %ebx
+  803d25:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d27:	83 ec 04             	sub    $0x4,%esp
+  803d2a:	6a 07                	push   $0x7
+  803d2c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d31:	6a 00                	push   $0x0
+  803d33:	e8 c8 c8 ff ff       	call   800600 <sys_page_alloc>
+	if (r < 0) {
+  803d38:	83 c4 10             	add    $0x10,%esp
+  803d3b:	85 c0                	test   %eax,%eax
+  803d3d:	78 58                	js     803d97 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d3f:	83 ec 04             	sub    $0x4,%esp
+  803d42:	68 00 10 00 00       	push   $0x1000
+  803d47:	56                   	push   %esi
+  803d48:	68 00 f0 7f 00       	push   $0x7ff000
+  803d4d:	e8 f6 c5 ff ff       	call   800348 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d52:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d59:	56                   	push   %esi
+  803d5a:	6a 00                	push   $0x0
+  803d5c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d61:	6a 00                	push   $0x0
+  803d63:	e8 e5 c8 ff ff       	call   80064d <sys_page_map>
+  803d68:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d6a:	83 c4 20             	add    $0x20,%esp
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	78 3b                	js     803dac <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d71:	83 ec 08             	sub    $0x8,%esp
+  803d74:	68 00 f0 7f 00       	push   $0x7ff000
+  803d79:	6a 00                	push   $0x0
+  803d7b:	e8 19 c9 ff ff       	call   800699 <sys_page_unmap>
+  803d80:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d82:	83 c4 10             	add    $0x10,%esp
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 45                	js     803dce <cow_copy+0xae>
+	return 0;
+  803d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d8e:	89 d8                	mov    %ebx,%eax
+  803d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d93:	5b                   	pop    %ebx
+  803d94:	5e                   	pop    %esi
+  803d95:	5d                   	pop    %ebp
+  803d96:	c3                   	ret
+  803d97:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d99:	83 ec 08             	sub    $0x8,%esp
+  803d9c:	50                   	push   %eax
+  803d9d:	68 58 4e 80 00       	push   $0x804e58
+  803da2:	e8 14 f9 ff ff       	call   8036bb <cprintf>
+		return r;
+  803da7:	83 c4 10             	add    $0x10,%esp
+  803daa:	eb e2                	jmp    803d8e <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803dac:	83 ec 08             	sub    $0x8,%esp
+  803daf:	50                   	push   %eax
+  803db0:	68 74 4e 80 00       	push   $0x804e74
+  803db5:	e8 01 f9 ff ff       	call   8036bb <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803dba:	83 c4 08             	add    $0x8,%esp
+  803dbd:	68 00 f0 7f 00       	push   $0x7ff000
+  803dc2:	6a 00                	push   $0x0
+  803dc4:	e8 d0 c8 ff ff       	call   800699 <sys_page_unmap>
+		return r;
+  803dc9:	83 c4 10             	add    $0x10,%esp
+  803dcc:	eb c0                	jmp    803d8e <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803dce:	83 ec 08             	sub    $0x8,%esp
+  803dd1:	50                   	push   %eax
+  803dd2:	68 90 4d 80 00       	push   $0x804d90
+  803dd7:	e8 df f8 ff ff       	call   8036bb <cprintf>
+		return r;
+  803ddc:	83 c4 10             	add    $0x10,%esp
+  803ddf:	eb ad                	jmp    803d8e <cow_copy+0x6e>
+
+00803de1 <pgfault>:
+{
+  803de1:	55                   	push   %ebp
+  803de2:	89 e5                	mov    %esp,%ebp
+  803de4:	56                   	push   %esi
+  803de5:	53                   	push   %ebx
+  803de6:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803de9:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803deb:	89 d8                	mov    %ebx,%eax
+  803ded:	c1 e8 16             	shr    $0x16,%eax
+  803df0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803df7:	89 de                	mov    %ebx,%esi
+  803df9:	c1 ee 0c             	shr    $0xc,%esi
+  803dfc:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e03:	a8 07                	test   $0x7,%al
+  803e05:	74 3b                	je     803e42 <pgfault+0x61>
+  803e07:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e0d:	74 33                	je     803e42 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e0f:	83 ec 0c             	sub    $0xc,%esp
+  803e12:	68 00 f0 bf ee       	push   $0xeebff000
+  803e17:	e8 44 ee ff ff       	call   802c60 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e1c:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e23:	83 c4 10             	add    $0x10,%esp
+  803e26:	f6 c4 08             	test   $0x8,%ah
+  803e29:	75 30                	jne    803e5b <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e2b:	83 ec 0c             	sub    $0xc,%esp
+  803e2e:	68 00 f0 bf ee       	push   $0xeebff000
+  803e33:	e8 95 ee ff ff       	call   802ccd <mutex_unlock>
+}
+  803e38:	83 c4 10             	add    $0x10,%esp
+  803e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e3e:	5b                   	pop    %ebx
+  803e3f:	5e                   	pop    %esi
+  803e40:	5d                   	pop    %ebp
+  803e41:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e42:	83 ec 08             	sub    $0x8,%esp
+  803e45:	ff 72 28             	push   0x28(%edx)
+  803e48:	51                   	push   %ecx
+  803e49:	50                   	push   %eax
+  803e4a:	68 b4 4d 80 00       	push   $0x804db4
+  803e4f:	6a 3f                	push   $0x3f
+  803e51:	68 8e 4e 80 00       	push   $0x804e8e
+  803e56:	e8 85 f7 ff ff       	call   8035e0 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e5b:	89 d8                	mov    %ebx,%eax
+  803e5d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e62:	e8 b9 fe ff ff       	call   803d20 <cow_copy>
+  803e67:	eb c2                	jmp    803e2b <pgfault+0x4a>
+
+00803e69 <cow_enable>:
+{
+  803e69:	55                   	push   %ebp
+  803e6a:	89 e5                	mov    %esp,%ebp
+  803e6c:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e6f:	68 e1 3d 80 00       	push   $0x803de1
+  803e74:	e8 28 06 00 00       	call   8044a1 <set_pgfault_handler>
+}
+  803e79:	83 c4 10             	add    $0x10,%esp
+  803e7c:	c9                   	leave
+  803e7d:	c3                   	ret
+
+00803e7e <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e7e:	55                   	push   %ebp
+  803e7f:	89 e5                	mov    %esp,%ebp
+  803e81:	57                   	push   %edi
+  803e82:	56                   	push   %esi
+  803e83:	53                   	push   %ebx
+  803e84:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e87:	68 e1 3d 80 00       	push   $0x803de1
+  803e8c:	e8 10 06 00 00       	call   8044a1 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e91:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e96:	cd 30                	int    $0x30
+  803e98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e9b:	83 c4 10             	add    $0x10,%esp
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	78 4b                	js     803eed <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803ea2:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803ea7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803eac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803eaf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803eb3:	0f 85 16 01 00 00    	jne    803fcf <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803eb9:	e8 ea c6 ff ff       	call   8005a8 <sys_getenvid>
+  803ebe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ec3:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ec5:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803ecb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ed1:	77 32                	ja     803f05 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ed3:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803ed8:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803eda:	c1 ea 10             	shr    $0x10,%edx
+  803edd:	74 26                	je     803f05 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803edf:	c1 e2 10             	shl    $0x10,%edx
+  803ee2:	89 d1                	mov    %edx,%ecx
+  803ee4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ee9:	29 ca                	sub    %ecx,%edx
+  803eeb:	eb 1e                	jmp    803f0b <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803eed:	83 ec 08             	sub    $0x8,%esp
+  803ef0:	89 c7                	mov    %eax,%edi
+  803ef2:	50                   	push   %eax
+  803ef3:	68 99 4e 80 00       	push   $0x804e99
+  803ef8:	e8 be f7 ff ff       	call   8036bb <cprintf>
+		return eid;
+  803efd:	83 c4 10             	add    $0x10,%esp
+  803f00:	e9 6c 01 00 00       	jmp    804071 <fork+0x1f3>
+		return pthread_main_tls;
+  803f05:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f0b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f0e:	c1 e0 04             	shl    $0x4,%eax
+  803f11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f16:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f18:	e8 8c f4 ff ff       	call   8033a9 <pthread_fork_child>
+		return eid;
+  803f1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f20:	e9 4c 01 00 00       	jmp    804071 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f25:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f2b:	89 da                	mov    %ebx,%edx
+  803f2d:	89 f8                	mov    %edi,%eax
+  803f2f:	e8 af fd ff ff       	call   803ce3 <duppage>
+  803f34:	85 c0                	test   %eax,%eax
+  803f36:	79 28                	jns    803f60 <fork+0xe2>
+  803f38:	89 c7                	mov    %eax,%edi
+  803f3a:	e9 32 01 00 00       	jmp    804071 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f3f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f45:	83 f9 05             	cmp    $0x5,%ecx
+  803f48:	75 58                	jne    803fa2 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f4a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f4f:	89 da                	mov    %ebx,%edx
+  803f51:	89 f8                	mov    %edi,%eax
+  803f53:	e8 8b fd ff ff       	call   803ce3 <duppage>
+  803f58:	85 c0                	test   %eax,%eax
+  803f5a:	0f 88 0f 01 00 00    	js     80406f <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f60:	83 c3 01             	add    $0x1,%ebx
+  803f63:	39 de                	cmp    %ebx,%esi
+  803f65:	74 54                	je     803fbb <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f67:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f6e:	f6 c1 05             	test   $0x5,%cl
+  803f71:	74 ed                	je     803f60 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f73:	f6 c5 04             	test   $0x4,%ch
+  803f76:	75 ad                	jne    803f25 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f78:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f7e:	74 bf                	je     803f3f <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f80:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f86:	74 d8                	je     803f60 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f88:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f8e:	89 da                	mov    %ebx,%edx
+  803f90:	89 f8                	mov    %edi,%eax
+  803f92:	e8 cd fc ff ff       	call   803c64 <duppage_cow>
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	79 c5                	jns    803f60 <fork+0xe2>
+  803f9b:	89 c7                	mov    %eax,%edi
+  803f9d:	e9 cf 00 00 00       	jmp    804071 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fa2:	68 e4 4d 80 00       	push   $0x804de4
+  803fa7:	68 59 48 80 00       	push   $0x804859
+  803fac:	68 c6 00 00 00       	push   $0xc6
+  803fb1:	68 8e 4e 80 00       	push   $0x804e8e
+  803fb6:	e8 25 f6 ff ff       	call   8035e0 <_panic>
+  803fbb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fbe:	83 c1 01             	add    $0x1,%ecx
+  803fc1:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803fc7:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803fcd:	74 18                	je     803fe7 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803fcf:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803fd6:	a8 07                	test   $0x7,%al
+  803fd8:	74 e4                	je     803fbe <fork+0x140>
+  803fda:	89 cb                	mov    %ecx,%ebx
+  803fdc:	c1 e3 0a             	shl    $0xa,%ebx
+  803fdf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803fe2:	e9 7c ff ff ff       	jmp    803f63 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803fe7:	83 ec 04             	sub    $0x4,%esp
+  803fea:	6a 07                	push   $0x7
+  803fec:	68 00 f0 bf ee       	push   $0xeebff000
+  803ff1:	ff 75 e4             	push   -0x1c(%ebp)
+  803ff4:	e8 07 c6 ff ff       	call   800600 <sys_page_alloc>
+  803ff9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803ffb:	83 c4 10             	add    $0x10,%esp
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	78 34                	js     804036 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804002:	83 ec 08             	sub    $0x8,%esp
+  804005:	68 df 44 80 00       	push   $0x8044df
+  80400a:	ff 75 e4             	push   -0x1c(%ebp)
+  80400d:	e8 6b c7 ff ff       	call   80077d <sys_env_set_pgfault_upcall>
+  804012:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804014:	83 c4 10             	add    $0x10,%esp
+  804017:	85 c0                	test   %eax,%eax
+  804019:	78 2e                	js     804049 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80401b:	83 ec 08             	sub    $0x8,%esp
+  80401e:	6a 02                	push   $0x2
+  804020:	ff 75 e4             	push   -0x1c(%ebp)
+  804023:	e8 bd c6 ff ff       	call   8006e5 <sys_env_set_status>
+  804028:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	85 c0                	test   %eax,%eax
+  80402f:	78 2b                	js     80405c <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804031:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804034:	eb 3b                	jmp    804071 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804036:	83 ec 08             	sub    $0x8,%esp
+  804039:	50                   	push   %eax
+  80403a:	68 0c 4e 80 00       	push   $0x804e0c
+  80403f:	e8 77 f6 ff ff       	call   8036bb <cprintf>
+		return r;
+  804044:	83 c4 10             	add    $0x10,%esp
+  804047:	eb 28                	jmp    804071 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804049:	83 ec 08             	sub    $0x8,%esp
+  80404c:	50                   	push   %eax
+  80404d:	68 34 4e 80 00       	push   $0x804e34
+  804052:	e8 64 f6 ff ff       	call   8036bb <cprintf>
+		return r;
+  804057:	83 c4 10             	add    $0x10,%esp
+  80405a:	eb 15                	jmp    804071 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80405c:	83 ec 08             	sub    $0x8,%esp
+  80405f:	50                   	push   %eax
+  804060:	68 a9 4e 80 00       	push   $0x804ea9
+  804065:	e8 51 f6 ff ff       	call   8036bb <cprintf>
+		return r;
+  80406a:	83 c4 10             	add    $0x10,%esp
+  80406d:	eb 02                	jmp    804071 <fork+0x1f3>
+  80406f:	89 c7                	mov    %eax,%edi
+}
+  804071:	89 f8                	mov    %edi,%eax
+  804073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804076:	5b                   	pop    %ebx
+  804077:	5e                   	pop    %esi
+  804078:	5f                   	pop    %edi
+  804079:	5d                   	pop    %ebp
+  80407a:	c3                   	ret
+
+0080407b <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80407b:	55                   	push   %ebp
+  80407c:	89 e5                	mov    %esp,%ebp
+  80407e:	57                   	push   %edi
+  80407f:	56                   	push   %esi
+  804080:	53                   	push   %ebx
+  804081:	83 ec 2c             	sub    $0x2c,%esp
+  804084:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804086:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80408c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804091:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804097:	77 0a                	ja     8040a3 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804099:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80409e:	29 c3                	sub    %eax,%ebx
+  8040a0:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040a3:	83 ec 0c             	sub    $0xc,%esp
+  8040a6:	68 e1 3d 80 00       	push   $0x803de1
+  8040ab:	e8 f1 03 00 00       	call   8044a1 <set_pgfault_handler>
+  8040b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040b5:	cd 30                	int    $0x30
+  8040b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040ba:	83 c4 10             	add    $0x10,%esp
+  8040bd:	85 c0                	test   %eax,%eax
+  8040bf:	78 30                	js     8040f1 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8040c5:	74 42                	je     804109 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040c7:	c1 e3 10             	shl    $0x10,%ebx
+  8040ca:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8040cf:	29 d8                	sub    %ebx,%eax
+  8040d1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040d4:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8040d9:	29 d8                	sub    %ebx,%eax
+  8040db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040de:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040e8:	89 f7                	mov    %esi,%edi
+  8040ea:	89 d6                	mov    %edx,%esi
+  8040ec:	e9 2c 01 00 00       	jmp    80421d <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8040f1:	83 ec 08             	sub    $0x8,%esp
+  8040f4:	89 c7                	mov    %eax,%edi
+  8040f6:	50                   	push   %eax
+  8040f7:	68 99 4e 80 00       	push   $0x804e99
+  8040fc:	e8 ba f5 ff ff       	call   8036bb <cprintf>
+		return eid;
+  804101:	83 c4 10             	add    $0x10,%esp
+  804104:	e9 d5 00 00 00       	jmp    8041de <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804109:	e8 9a c4 ff ff       	call   8005a8 <sys_getenvid>
+  80410e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804113:	89 c2                	mov    %eax,%edx
+  804115:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804117:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80411d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804122:	77 18                	ja     80413c <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804124:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804129:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80412b:	c1 e8 10             	shr    $0x10,%eax
+  80412e:	74 0c                	je     80413c <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804130:	c1 e0 10             	shl    $0x10,%eax
+  804133:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804138:	29 c1                	sub    %eax,%ecx
+  80413a:	eb 06                	jmp    804142 <sfork+0xc7>
+		return pthread_main_tls;
+  80413c:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804142:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804145:	c1 e0 04             	shl    $0x4,%eax
+  804148:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80414d:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80414f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804152:	e9 87 00 00 00       	jmp    8041de <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804157:	f6 c5 04             	test   $0x4,%ch
+  80415a:	74 6c                	je     8041c8 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80415c:	89 ca                	mov    %ecx,%edx
+  80415e:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804164:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80416a:	74 7c                	je     8041e8 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80416c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804172:	89 da                	mov    %ebx,%edx
+  804174:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804177:	e8 67 fb ff ff       	call   803ce3 <duppage>
+  80417c:	85 c0                	test   %eax,%eax
+  80417e:	0f 88 4f 01 00 00    	js     8042d3 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804184:	83 c3 01             	add    $0x1,%ebx
+  804187:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80418a:	74 7a                	je     804206 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80418c:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80418e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804195:	f6 c1 01             	test   $0x1,%cl
+  804198:	74 ea                	je     804184 <sfork+0x109>
+  80419a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041a0:	74 e2                	je     804184 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041a2:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041a8:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041ab:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041b0:	76 a5                	jbe    804157 <sfork+0xdc>
+  8041b2:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041b8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041bb:	39 fa                	cmp    %edi,%edx
+  8041bd:	73 9d                	jae    80415c <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041bf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8041c2:	39 fa                	cmp    %edi,%edx
+  8041c4:	72 96                	jb     80415c <sfork+0xe1>
+  8041c6:	eb 8f                	jmp    804157 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041c8:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041ce:	89 da                	mov    %ebx,%edx
+  8041d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041d3:	e8 8c fa ff ff       	call   803c64 <duppage_cow>
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	79 a8                	jns    804184 <sfork+0x109>
+  8041dc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8041de:	89 f8                	mov    %edi,%eax
+  8041e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e3:	5b                   	pop    %ebx
+  8041e4:	5e                   	pop    %esi
+  8041e5:	5f                   	pop    %edi
+  8041e6:	5d                   	pop    %ebp
+  8041e7:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8041e8:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8041ed:	e8 2e fb ff ff       	call   803d20 <cow_copy>
+  8041f2:	85 c0                	test   %eax,%eax
+  8041f4:	0f 88 d2 00 00 00    	js     8042cc <sfork+0x251>
+				pte = uvpt[pn];
+  8041fa:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804201:	e9 66 ff ff ff       	jmp    80416c <sfork+0xf1>
+  804206:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804209:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80420c:	83 c6 01             	add    $0x1,%esi
+  80420f:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804215:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80421b:	74 1b                	je     804238 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80421d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804224:	a8 01                	test   $0x1,%al
+  804226:	74 e4                	je     80420c <sfork+0x191>
+  804228:	89 f3                	mov    %esi,%ebx
+  80422a:	c1 e3 0a             	shl    $0xa,%ebx
+  80422d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804230:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804233:	e9 4f ff ff ff       	jmp    804187 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804238:	83 ec 04             	sub    $0x4,%esp
+  80423b:	6a 07                	push   $0x7
+  80423d:	68 00 f0 bf ee       	push   $0xeebff000
+  804242:	ff 75 e0             	push   -0x20(%ebp)
+  804245:	e8 b6 c3 ff ff       	call   800600 <sys_page_alloc>
+  80424a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80424c:	83 c4 10             	add    $0x10,%esp
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	78 37                	js     80428a <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804253:	83 ec 08             	sub    $0x8,%esp
+  804256:	68 df 44 80 00       	push   $0x8044df
+  80425b:	ff 75 e0             	push   -0x20(%ebp)
+  80425e:	e8 1a c5 ff ff       	call   80077d <sys_env_set_pgfault_upcall>
+  804263:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804265:	83 c4 10             	add    $0x10,%esp
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	78 34                	js     8042a0 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80426c:	83 ec 08             	sub    $0x8,%esp
+  80426f:	6a 02                	push   $0x2
+  804271:	ff 75 e0             	push   -0x20(%ebp)
+  804274:	e8 6c c4 ff ff       	call   8006e5 <sys_env_set_status>
+  804279:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80427b:	83 c4 10             	add    $0x10,%esp
+  80427e:	85 c0                	test   %eax,%eax
+  804280:	78 34                	js     8042b6 <sfork+0x23b>
+	return eid;
+  804282:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804285:	e9 54 ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80428a:	83 ec 08             	sub    $0x8,%esp
+  80428d:	50                   	push   %eax
+  80428e:	68 0c 4e 80 00       	push   $0x804e0c
+  804293:	e8 23 f4 ff ff       	call   8036bb <cprintf>
+		return r;
+  804298:	83 c4 10             	add    $0x10,%esp
+  80429b:	e9 3e ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042a0:	83 ec 08             	sub    $0x8,%esp
+  8042a3:	50                   	push   %eax
+  8042a4:	68 34 4e 80 00       	push   $0x804e34
+  8042a9:	e8 0d f4 ff ff       	call   8036bb <cprintf>
+		return r;
+  8042ae:	83 c4 10             	add    $0x10,%esp
+  8042b1:	e9 28 ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042b6:	83 ec 08             	sub    $0x8,%esp
+  8042b9:	50                   	push   %eax
+  8042ba:	68 a9 4e 80 00       	push   $0x804ea9
+  8042bf:	e8 f7 f3 ff ff       	call   8036bb <cprintf>
+		return r;
+  8042c4:	83 c4 10             	add    $0x10,%esp
+  8042c7:	e9 12 ff ff ff       	jmp    8041de <sfork+0x163>
+  8042cc:	89 c7                	mov    %eax,%edi
+  8042ce:	e9 0b ff ff ff       	jmp    8041de <sfork+0x163>
+  8042d3:	89 c7                	mov    %eax,%edi
+  8042d5:	e9 04 ff ff ff       	jmp    8041de <sfork+0x163>
+
+008042da <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042da:	55                   	push   %ebp
+  8042db:	89 e5                	mov    %esp,%ebp
+  8042dd:	57                   	push   %edi
+  8042de:	56                   	push   %esi
+  8042df:	53                   	push   %ebx
+  8042e0:	83 ec 18             	sub    $0x18,%esp
+  8042e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8042f3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8042f6:	50                   	push   %eax
+  8042f7:	e8 fa c4 ff ff       	call   8007f6 <sys_ipc_recv>
+	if (r < 0) {
+  8042fc:	83 c4 10             	add    $0x10,%esp
+  8042ff:	85 c0                	test   %eax,%eax
+  804301:	78 2b                	js     80432e <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804303:	85 ff                	test   %edi,%edi
+  804305:	74 55                	je     80435c <ipc_recv+0x82>
+  804307:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804309:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80430f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804314:	77 39                	ja     80434f <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804316:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80431b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80431d:	c1 e8 10             	shr    $0x10,%eax
+  804320:	74 2d                	je     80434f <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804322:	c1 e0 10             	shl    $0x10,%eax
+  804325:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80432a:	29 c2                	sub    %eax,%edx
+  80432c:	eb 27                	jmp    804355 <ipc_recv+0x7b>
+  80432e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804330:	83 ec 08             	sub    $0x8,%esp
+  804333:	50                   	push   %eax
+  804334:	68 c7 4e 80 00       	push   $0x804ec7
+  804339:	e8 7d f3 ff ff       	call   8036bb <cprintf>
+		*from_env_store = 0;
+  80433e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804344:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80434a:	83 c4 10             	add    $0x10,%esp
+  80434d:	eb 77                	jmp    8043c6 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80434f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804355:	8b 02                	mov    (%edx),%eax
+  804357:	8b 40 78             	mov    0x78(%eax),%eax
+  80435a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80435c:	85 f6                	test   %esi,%esi
+  80435e:	74 34                	je     804394 <ipc_recv+0xba>
+  804360:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804362:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804368:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80436d:	77 18                	ja     804387 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80436f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804374:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804376:	c1 e8 10             	shr    $0x10,%eax
+  804379:	74 0c                	je     804387 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80437b:	c1 e0 10             	shl    $0x10,%eax
+  80437e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804383:	29 c2                	sub    %eax,%edx
+  804385:	eb 06                	jmp    80438d <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804387:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80438d:	8b 02                	mov    (%edx),%eax
+  80438f:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804392:	89 06                	mov    %eax,(%esi)
+  804394:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804396:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80439c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043a1:	77 18                	ja     8043bb <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043aa:	c1 e8 10             	shr    $0x10,%eax
+  8043ad:	74 0c                	je     8043bb <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043af:	c1 e0 10             	shl    $0x10,%eax
+  8043b2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043b7:	29 c2                	sub    %eax,%edx
+  8043b9:	eb 06                	jmp    8043c1 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043bb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043c1:	8b 02                	mov    (%edx),%eax
+  8043c3:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043c6:	89 d8                	mov    %ebx,%eax
+  8043c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cb:	5b                   	pop    %ebx
+  8043cc:	5e                   	pop    %esi
+  8043cd:	5f                   	pop    %edi
+  8043ce:	5d                   	pop    %ebp
+  8043cf:	c3                   	ret
+
+008043d0 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8043d0:	55                   	push   %ebp
+  8043d1:	89 e5                	mov    %esp,%ebp
+  8043d3:	57                   	push   %edi
+  8043d4:	56                   	push   %esi
+  8043d5:	53                   	push   %ebx
+  8043d6:	83 ec 0c             	sub    $0xc,%esp
+  8043d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043df:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043e2:	85 db                	test   %ebx,%ebx
+  8043e4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8043e9:	0f 44 d8             	cmove  %eax,%ebx
+  8043ec:	eb 05                	jmp    8043f3 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8043ee:	e8 e1 c1 ff ff       	call   8005d4 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8043f3:	57                   	push   %edi
+  8043f4:	53                   	push   %ebx
+  8043f5:	ff 75 0c             	push   0xc(%ebp)
+  8043f8:	56                   	push   %esi
+  8043f9:	e8 cb c3 ff ff       	call   8007c9 <sys_ipc_try_send>
+		if (r == 0) {
+  8043fe:	83 c4 10             	add    $0x10,%esp
+  804401:	85 c0                	test   %eax,%eax
+  804403:	74 19                	je     80441e <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804405:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804408:	74 e4                	je     8043ee <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80440a:	83 ec 0c             	sub    $0xc,%esp
+  80440d:	50                   	push   %eax
+  80440e:	57                   	push   %edi
+  80440f:	53                   	push   %ebx
+  804410:	56                   	push   %esi
+  804411:	68 e0 4e 80 00       	push   $0x804ee0
+  804416:	e8 a0 f2 ff ff       	call   8036bb <cprintf>
+			return;
+  80441b:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80441e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804421:	5b                   	pop    %ebx
+  804422:	5e                   	pop    %esi
+  804423:	5f                   	pop    %edi
+  804424:	5d                   	pop    %ebp
+  804425:	c3                   	ret
+
+00804426 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804426:	55                   	push   %ebp
+  804427:	89 e5                	mov    %esp,%ebp
+  804429:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80442c:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804431:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804434:	c1 e0 04             	shl    $0x4,%eax
+  804437:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80443c:	8b 40 50             	mov    0x50(%eax),%eax
+  80443f:	39 c8                	cmp    %ecx,%eax
+  804441:	74 12                	je     804455 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804443:	83 c2 01             	add    $0x1,%edx
+  804446:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80444c:	75 e3                	jne    804431 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80444e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804453:	eb 0e                	jmp    804463 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804455:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804458:	c1 e0 04             	shl    $0x4,%eax
+  80445b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804460:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804463:	5d                   	pop    %ebp
+  804464:	c3                   	ret
+
+00804465 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804465:	55                   	push   %ebp
+  804466:	89 e5                	mov    %esp,%ebp
+  804468:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80446b:	89 c2                	mov    %eax,%edx
+  80446d:	c1 ea 16             	shr    $0x16,%edx
+  804470:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804477:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80447c:	f6 c1 01             	test   $0x1,%cl
+  80447f:	74 1c                	je     80449d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804481:	c1 e8 0c             	shr    $0xc,%eax
+  804484:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80448b:	a8 01                	test   $0x1,%al
+  80448d:	74 0e                	je     80449d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80448f:	c1 e8 0c             	shr    $0xc,%eax
+  804492:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804499:	ef 
+  80449a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80449d:	89 d0                	mov    %edx,%eax
+  80449f:	5d                   	pop    %ebp
+  8044a0:	c3                   	ret
+
+008044a1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8044a1:	55                   	push   %ebp
+  8044a2:	89 e5                	mov    %esp,%ebp
+  8044a4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8044a7:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8044ae:	74 0a                	je     8044ba <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b3:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8044b8:	c9                   	leave
+  8044b9:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044ba:	83 ec 04             	sub    $0x4,%esp
+  8044bd:	6a 07                	push   $0x7
+  8044bf:	68 00 f0 bf ee       	push   $0xeebff000
+  8044c4:	6a 00                	push   $0x0
+  8044c6:	e8 35 c1 ff ff       	call   800600 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044cb:	83 c4 08             	add    $0x8,%esp
+  8044ce:	68 df 44 80 00       	push   $0x8044df
+  8044d3:	6a 00                	push   $0x0
+  8044d5:	e8 a3 c2 ff ff       	call   80077d <sys_env_set_pgfault_upcall>
+  8044da:	83 c4 10             	add    $0x10,%esp
+  8044dd:	eb d1                	jmp    8044b0 <set_pgfault_handler+0xf>
+
+008044df <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044df:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044e0:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8044e5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044e7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8044ee:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8044f2:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8044f5:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044f9:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044fb:	83 c4 08             	add    $0x8,%esp
+	popal
+  8044fe:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8044ff:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804502:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804503:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804504:	c3                   	ret
+
+00804505 <udm>:
+  804505:	57                   	push   %edi
+  804506:	56                   	push   %esi
+  804507:	53                   	push   %ebx
+  804508:	83 ec 20             	sub    $0x20,%esp
+  80450b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80450f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804513:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804517:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80451b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80451f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804523:	89 d1                	mov    %edx,%ecx
+  804525:	09 c1                	or     %eax,%ecx
+  804527:	0f 84 91 00 00 00    	je     8045be <udm+0xb9>
+  80452d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804532:	ba 00 00 00 00       	mov    $0x0,%edx
+  804537:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80453c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804543:	00 
+  804544:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80454b:	00 
+  80454c:	eb 08                	jmp    804556 <udm+0x51>
+  80454e:	83 e9 01             	sub    $0x1,%ecx
+  804551:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804554:	74 7c                	je     8045d2 <udm+0xcd>
+  804556:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80455a:	01 c0                	add    %eax,%eax
+  80455c:	89 c6                	mov    %eax,%esi
+  80455e:	89 d7                	mov    %edx,%edi
+  804560:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804564:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804568:	0f ad d0             	shrd   %cl,%edx,%eax
+  80456b:	d3 ea                	shr    %cl,%edx
+  80456d:	f6 c1 20             	test   $0x20,%cl
+  804570:	74 04                	je     804576 <udm+0x71>
+  804572:	89 d0                	mov    %edx,%eax
+  804574:	31 d2                	xor    %edx,%edx
+  804576:	83 e0 01             	and    $0x1,%eax
+  804579:	89 04 24             	mov    %eax,(%esp)
+  80457c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804583:	00 
+  804584:	8b 04 24             	mov    (%esp),%eax
+  804587:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80458b:	09 f0                	or     %esi,%eax
+  80458d:	09 fa                	or     %edi,%edx
+  80458f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804593:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804597:	39 f0                	cmp    %esi,%eax
+  804599:	89 d3                	mov    %edx,%ebx
+  80459b:	19 fb                	sbb    %edi,%ebx
+  80459d:	72 af                	jb     80454e <udm+0x49>
+  80459f:	29 f0                	sub    %esi,%eax
+  8045a1:	19 fa                	sbb    %edi,%edx
+  8045a3:	89 cf                	mov    %ecx,%edi
+  8045a5:	c1 ef 05             	shr    $0x5,%edi
+  8045a8:	83 e7 01             	and    $0x1,%edi
+  8045ab:	89 fe                	mov    %edi,%esi
+  8045ad:	83 f6 01             	xor    $0x1,%esi
+  8045b0:	d3 e6                	shl    %cl,%esi
+  8045b2:	d3 e7                	shl    %cl,%edi
+  8045b4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045b8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045bc:	eb 90                	jmp    80454e <udm+0x49>
+  8045be:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045c2:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045c6:	89 f0                	mov    %esi,%eax
+  8045c8:	89 fa                	mov    %edi,%edx
+  8045ca:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045ce:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045d2:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045d6:	89 01                	mov    %eax,(%ecx)
+  8045d8:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045db:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045df:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045e3:	83 c4 20             	add    $0x20,%esp
+  8045e6:	5b                   	pop    %ebx
+  8045e7:	5e                   	pop    %esi
+  8045e8:	5f                   	pop    %edi
+  8045e9:	c3                   	ret
+
+008045ea <__udivdi3>:
+  8045ea:	83 ec 18             	sub    $0x18,%esp
+  8045ed:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045f1:	50                   	push   %eax
+  8045f2:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f6:	ff 74 24 2c          	push   0x2c(%esp)
+  8045fa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045fe:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804602:	e8 fe fe ff ff       	call   804505 <udm>
+  804607:	83 c4 24             	add    $0x24,%esp
+  80460a:	c3                   	ret
+
+0080460b <__umoddi3>:
+  80460b:	83 ec 18             	sub    $0x18,%esp
+  80460e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804612:	50                   	push   %eax
+  804613:	ff 74 24 2c          	push   0x2c(%esp)
+  804617:	ff 74 24 2c          	push   0x2c(%esp)
+  80461b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80461f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804623:	e8 dd fe ff ff       	call   804505 <udm>
+  804628:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80462c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804630:	83 c4 24             	add    $0x24,%esp
+  804633:	c3                   	ret
+
+00804634 <__divdi3>:
+  804634:	56                   	push   %esi
+  804635:	53                   	push   %ebx
+  804636:	83 ec 14             	sub    $0x14,%esp
+  804639:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80463d:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804641:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804645:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804649:	85 d2                	test   %edx,%edx
+  80464b:	78 18                	js     804665 <__divdi3+0x31>
+  80464d:	85 db                	test   %ebx,%ebx
+  80464f:	78 3e                	js     80468f <__divdi3+0x5b>
+  804651:	83 ec 04             	sub    $0x4,%esp
+  804654:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804658:	56                   	push   %esi
+  804659:	53                   	push   %ebx
+  80465a:	51                   	push   %ecx
+  80465b:	e8 a5 fe ff ff       	call   804505 <udm>
+  804660:	83 c4 10             	add    $0x10,%esp
+  804663:	eb 24                	jmp    804689 <__divdi3+0x55>
+  804665:	f7 d8                	neg    %eax
+  804667:	83 d2 00             	adc    $0x0,%edx
+  80466a:	f7 da                	neg    %edx
+  80466c:	85 db                	test   %ebx,%ebx
+  80466e:	78 3a                	js     8046aa <__divdi3+0x76>
+  804670:	83 ec 04             	sub    $0x4,%esp
+  804673:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804677:	56                   	push   %esi
+  804678:	53                   	push   %ebx
+  804679:	51                   	push   %ecx
+  80467a:	e8 86 fe ff ff       	call   804505 <udm>
+  80467f:	83 c4 10             	add    $0x10,%esp
+  804682:	f7 d8                	neg    %eax
+  804684:	83 d2 00             	adc    $0x0,%edx
+  804687:	f7 da                	neg    %edx
+  804689:	83 c4 14             	add    $0x14,%esp
+  80468c:	5b                   	pop    %ebx
+  80468d:	5e                   	pop    %esi
+  80468e:	c3                   	ret
+  80468f:	83 ec 04             	sub    $0x4,%esp
+  804692:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804696:	56                   	push   %esi
+  804697:	f7 d9                	neg    %ecx
+  804699:	83 d3 00             	adc    $0x0,%ebx
+  80469c:	f7 db                	neg    %ebx
+  80469e:	53                   	push   %ebx
+  80469f:	51                   	push   %ecx
+  8046a0:	e8 60 fe ff ff       	call   804505 <udm>
+  8046a5:	83 c4 10             	add    $0x10,%esp
+  8046a8:	eb d8                	jmp    804682 <__divdi3+0x4e>
+  8046aa:	83 ec 04             	sub    $0x4,%esp
+  8046ad:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046b1:	56                   	push   %esi
+  8046b2:	f7 d9                	neg    %ecx
+  8046b4:	83 d3 00             	adc    $0x0,%ebx
+  8046b7:	f7 db                	neg    %ebx
+  8046b9:	53                   	push   %ebx
+  8046ba:	51                   	push   %ecx
+  8046bb:	e8 45 fe ff ff       	call   804505 <udm>
+  8046c0:	83 c4 10             	add    $0x10,%esp
+  8046c3:	eb c4                	jmp    804689 <__divdi3+0x55>
+
+008046c5 <__moddi3>:
+  8046c5:	55                   	push   %ebp
+  8046c6:	57                   	push   %edi
+  8046c7:	56                   	push   %esi
+  8046c8:	53                   	push   %ebx
+  8046c9:	83 ec 24             	sub    $0x24,%esp
+  8046cc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046d0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046d4:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046d8:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046dc:	85 d2                	test   %edx,%edx
+  8046de:	78 3b                	js     80471b <__moddi3+0x56>
+  8046e0:	83 ec 04             	sub    $0x4,%esp
+  8046e3:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046e7:	56                   	push   %esi
+  8046e8:	89 ce                	mov    %ecx,%esi
+  8046ea:	f7 de                	neg    %esi
+  8046ec:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046f0:	89 de                	mov    %ebx,%esi
+  8046f2:	83 d6 00             	adc    $0x0,%esi
+  8046f5:	f7 de                	neg    %esi
+  8046f7:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046fb:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046ff:	0f 48 f1             	cmovs  %ecx,%esi
+  804702:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804707:	53                   	push   %ebx
+  804708:	56                   	push   %esi
+  804709:	e8 f7 fd ff ff       	call   804505 <udm>
+  80470e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804712:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804716:	83 c4 10             	add    $0x10,%esp
+  804719:	eb 47                	jmp    804762 <__moddi3+0x9d>
+  80471b:	f7 d8                	neg    %eax
+  80471d:	83 d2 00             	adc    $0x0,%edx
+  804720:	f7 da                	neg    %edx
+  804722:	83 ec 04             	sub    $0x4,%esp
+  804725:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804729:	56                   	push   %esi
+  80472a:	89 cf                	mov    %ecx,%edi
+  80472c:	f7 df                	neg    %edi
+  80472e:	89 de                	mov    %ebx,%esi
+  804730:	83 d6 00             	adc    $0x0,%esi
+  804733:	f7 de                	neg    %esi
+  804735:	0f 49 cf             	cmovns %edi,%ecx
+  804738:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80473c:	0f 49 de             	cmovns %esi,%ebx
+  80473f:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804743:	ff 74 24 0c          	push   0xc(%esp)
+  804747:	ff 74 24 0c          	push   0xc(%esp)
+  80474b:	e8 b5 fd ff ff       	call   804505 <udm>
+  804750:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804754:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804758:	f7 d8                	neg    %eax
+  80475a:	83 d2 00             	adc    $0x0,%edx
+  80475d:	f7 da                	neg    %edx
+  80475f:	83 c4 10             	add    $0x10,%esp
+  804762:	83 c4 24             	add    $0x24,%esp
+  804765:	5b                   	pop    %ebx
+  804766:	5e                   	pop    %esi
+  804767:	5f                   	pop    %edi
+  804768:	5d                   	pop    %ebp
+  804769:	c3                   	ret
@@ -0,0 +1,10330 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 be 04 00 00       	call   8004ef <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 d0 4b 80 00       	push   $0x804bd0
+  80003f:	e8 e3 05 00 00       	call   800627 <cprintf>
+	exit();
+  800044:	e8 21 05 00 00       	call   80056a <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+
+void
+handle_client(int sock)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1;
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 92 17 00 00       	call   8017f8 <read>
+  800066:	89 c3                	mov    %eax,%ebx
+  800068:	83 c4 10             	add    $0x10,%esp
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  80006b:	8d 7d c8             	lea    -0x38(%ebp),%edi
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	79 33                	jns    8000a5 <handle_client+0x57>
+		die("Failed to receive initial bytes from client");
+  800072:	b8 d4 4b 80 00       	mov    $0x804bd4,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	56                   	push   %esi
+  800080:	e8 37 16 00 00       	call   8016bc <close>
+}
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5f                   	pop    %edi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	6a 20                	push   $0x20
+  800095:	57                   	push   %edi
+  800096:	56                   	push   %esi
+  800097:	e8 5c 17 00 00       	call   8017f8 <read>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 22                	js     8000c7 <handle_client+0x79>
+	while (received > 0) {
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e d3                	jle    80007c <handle_client+0x2e>
+		if (write(sock, buffer, received) != received)
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	e8 3c 18 00 00       	call   8018f0 <write>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	39 d8                	cmp    %ebx,%eax
+  8000b9:	74 d5                	je     800090 <handle_client+0x42>
+			die("Failed to send bytes to client");
+  8000bb:	b8 00 4c 80 00       	mov    $0x804c00,%eax
+  8000c0:	e8 6e ff ff ff       	call   800033 <die>
+  8000c5:	eb c9                	jmp    800090 <handle_client+0x42>
+			die("Failed to receive additional bytes from client");
+  8000c7:	b8 20 4c 80 00       	mov    $0x804c20,%eax
+  8000cc:	e8 62 ff ff ff       	call   800033 <die>
+  8000d1:	eb d2                	jmp    8000a5 <handle_client+0x57>
+
+008000d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	83 ec 40             	sub    $0x40,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8000dc:	6a 06                	push   $0x6
+  8000de:	6a 01                	push   $0x1
+  8000e0:	6a 02                	push   $0x2
+  8000e2:	e8 df 2b 00 00       	call   802cc6 <socket>
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 86 00 00 00    	js     80017a <umain+0xa7>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 98 4b 80 00       	push   $0x804b98
+  8000fc:	e8 26 05 00 00       	call   800627 <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	6a 10                	push   $0x10
+  800106:	6a 00                	push   $0x0
+  800108:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010b:	53                   	push   %ebx
+  80010c:	e8 4b 0c 00 00       	call   800d5c <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  800111:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  800115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011c:	e8 90 01 00 00       	call   8002b1 <htonl>
+  800121:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800124:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012b:	e8 67 01 00 00       	call   800297 <htons>
+  800130:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  800134:	c7 04 24 a7 4b 80 00 	movl   $0x804ba7,(%esp)
+  80013b:	e8 e7 04 00 00       	call   800627 <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800140:	83 c4 0c             	add    $0xc,%esp
+  800143:	6a 10                	push   $0x10
+  800145:	53                   	push   %ebx
+  800146:	56                   	push   %esi
+  800147:	e8 e8 2a 00 00       	call   802c34 <bind>
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	85 c0                	test   %eax,%eax
+  800151:	78 36                	js     800189 <umain+0xb6>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	6a 05                	push   $0x5
+  800158:	56                   	push   %esi
+  800159:	e8 45 2b 00 00       	call   802ca3 <listen>
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	78 30                	js     800195 <umain+0xc2>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	68 b7 4b 80 00       	push   $0x804bb7
+  80016d:	e8 b5 04 00 00       	call   800627 <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800175:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800178:	eb 55                	jmp    8001cf <umain+0xfc>
+		die("Failed to create socket");
+  80017a:	b8 80 4b 80 00       	mov    $0x804b80,%eax
+  80017f:	e8 af fe ff ff       	call   800033 <die>
+  800184:	e9 6b ff ff ff       	jmp    8000f4 <umain+0x21>
+		die("Failed to bind the server socket");
+  800189:	b8 50 4c 80 00       	mov    $0x804c50,%eax
+  80018e:	e8 a0 fe ff ff       	call   800033 <die>
+  800193:	eb be                	jmp    800153 <umain+0x80>
+		die("Failed to listen on server socket");
+  800195:	b8 74 4c 80 00       	mov    $0x804c74,%eax
+  80019a:	e8 94 fe ff ff       	call   800033 <die>
+  80019f:	eb c4                	jmp    800165 <umain+0x92>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8001a1:	b8 98 4c 80 00       	mov    $0x804c98,%eax
+  8001a6:	e8 88 fe ff ff       	call   800033 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	ff 75 cc             	push   -0x34(%ebp)
+  8001b1:	e8 39 00 00 00       	call   8001ef <inet_ntoa>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	50                   	push   %eax
+  8001ba:	68 be 4b 80 00       	push   $0x804bbe
+  8001bf:	e8 63 04 00 00       	call   800627 <cprintf>
+		handle_client(clientsock);
+  8001c4:	89 1c 24             	mov    %ebx,(%esp)
+  8001c7:	e8 82 fe ff ff       	call   80004e <handle_client>
+	while (1) {
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  8001cf:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	56                   	push   %esi
+  8001df:	e8 21 2a 00 00       	call   802c05 <accept>
+  8001e4:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 b4                	js     8001a1 <umain+0xce>
+  8001ed:	eb bc                	jmp    8001ab <umain+0xd8>
+
+008001ef <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001fe:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800201:	b9 00 70 80 00       	mov    $0x807000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800206:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80020b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020e:	eb 31                	jmp    800241 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800210:	0f b6 c8             	movzbl %al,%ecx
+  800213:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800218:	88 0a                	mov    %cl,(%edx)
+  80021a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80021d:	83 e8 01             	sub    $0x1,%eax
+  800220:	3c ff                	cmp    $0xff,%al
+  800222:	75 ec                	jne    800210 <inet_ntoa+0x21>
+  800224:	0f b6 db             	movzbl %bl,%ebx
+  800227:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022a:	01 d8                	add    %ebx,%eax
+  80022c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80022e:	8d 40 01             	lea    0x1(%eax),%eax
+  800231:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800234:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800237:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80023a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80023d:	39 c7                	cmp    %eax,%edi
+  80023f:	74 46                	je     800287 <inet_ntoa+0x98>
+  800241:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	f6 e2                	mul    %dl
+  800250:	66 c1 e8 0b          	shr    $0xb,%ax
+  800254:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800257:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80025a:	01 c9                	add    %ecx,%ecx
+  80025c:	89 d0                	mov    %edx,%eax
+  80025e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800260:	89 d7                	mov    %edx,%edi
+  800262:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800266:	89 d9                	mov    %ebx,%ecx
+  800268:	83 c3 01             	add    $0x1,%ebx
+  80026b:	0f b6 c9             	movzbl %cl,%ecx
+  80026e:	83 c0 30             	add    $0x30,%eax
+  800271:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800275:	89 f8                	mov    %edi,%eax
+  800277:	3c 09                	cmp    $0x9,%al
+  800279:	77 d1                	ja     80024c <inet_ntoa+0x5d>
+  80027b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80027e:	88 17                	mov    %dl,(%edi)
+  800280:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800283:	89 d8                	mov    %ebx,%eax
+  800285:	eb 96                	jmp    80021d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800287:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80028a:	b8 00 70 80 00       	mov    $0x807000,%eax
+  80028f:	83 c4 1c             	add    $0x1c,%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80029a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80029e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8002a7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8002ab:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8002b7:	89 d0                	mov    %edx,%eax
+  8002b9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002bc:	89 d1                	mov    %edx,%ecx
+  8002be:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002c1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	c1 e1 08             	shl    $0x8,%ecx
+  8002c8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002ce:	09 c8                	or     %ecx,%eax
+  8002d0:	c1 ea 08             	shr    $0x8,%edx
+  8002d3:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002d9:	09 d0                	or     %edx,%eax
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <inet_aton>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+  8002e3:	83 ec 2c             	sub    $0x2c,%esp
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002e9:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002ef:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002f2:	e9 9b 00 00 00       	jmp    800392 <inet_aton+0xb5>
+      c = *++cp;
+  8002f7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	83 e1 df             	and    $0xffffffdf,%ecx
+  800300:	80 f9 58             	cmp    $0x58,%cl
+  800303:	74 10                	je     800315 <inet_aton+0x38>
+      c = *++cp;
+  800305:	83 c2 01             	add    $0x1,%edx
+  800308:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80030b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800310:	e9 97 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        c = *++cp;
+  800315:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800319:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80031c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800321:	e9 86 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800326:	0f af d7             	imul   %edi,%edx
+  800329:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80032d:	0f be 01             	movsbl (%ecx),%eax
+  800330:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800333:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800336:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800339:	80 fb 09             	cmp    $0x9,%bl
+  80033c:	76 e8                	jbe    800326 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80033e:	83 ff 10             	cmp    $0x10,%edi
+  800341:	75 2e                	jne    800371 <inet_aton+0x94>
+  800343:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800347:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80034a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80034d:	83 eb 41             	sub    $0x41,%ebx
+  800350:	80 fb 05             	cmp    $0x5,%bl
+  800353:	77 1c                	ja     800371 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800355:	c1 e2 04             	shl    $0x4,%edx
+  800358:	83 c0 0a             	add    $0xa,%eax
+  80035b:	89 f3                	mov    %esi,%ebx
+  80035d:	80 fb 1a             	cmp    $0x1a,%bl
+  800360:	19 db                	sbb    %ebx,%ebx
+  800362:	83 e3 20             	and    $0x20,%ebx
+  800365:	83 c3 41             	add    $0x41,%ebx
+  800368:	29 d8                	sub    %ebx,%eax
+  80036a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80036c:	0f be 01             	movsbl (%ecx),%eax
+  80036f:	eb bf                	jmp    800330 <inet_aton+0x53>
+    if (c == '.') {
+  800371:	83 f8 2e             	cmp    $0x2e,%eax
+  800374:	75 43                	jne    8003b9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800376:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800379:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80037c:	39 f0                	cmp    %esi,%eax
+  80037e:	0f 84 22 01 00 00    	je     8004a6 <inet_aton+0x1c9>
+      *pp++ = val;
+  800384:	83 c0 04             	add    $0x4,%eax
+  800387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80038d:	89 ca                	mov    %ecx,%edx
+  80038f:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800392:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800395:	80 f9 09             	cmp    $0x9,%cl
+  800398:	0f 87 01 01 00 00    	ja     80049f <inet_aton+0x1c2>
+    base = 10;
+  80039e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8003a3:	83 f8 30             	cmp    $0x30,%eax
+  8003a6:	0f 84 4b ff ff ff    	je     8002f7 <inet_aton+0x1a>
+  8003ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	e9 7a ff ff ff       	jmp    800333 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003bd:	89 d6                	mov    %edx,%esi
+  8003bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	74 2e                	je     8003f4 <inet_aton+0x117>
+    return (0);
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003cb:	89 fa                	mov    %edi,%edx
+  8003cd:	80 fa 1f             	cmp    $0x1f,%dl
+  8003d0:	0f 86 d5 00 00 00    	jbe    8004ab <inet_aton+0x1ce>
+  8003d6:	84 c0                	test   %al,%al
+  8003d8:	0f 88 cd 00 00 00    	js     8004ab <inet_aton+0x1ce>
+  8003de:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003e1:	83 f9 04             	cmp    $0x4,%ecx
+  8003e4:	76 0e                	jbe    8003f4 <inet_aton+0x117>
+    return (0);
+  8003e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003eb:	83 f8 20             	cmp    $0x20,%eax
+  8003ee:	0f 85 b7 00 00 00    	jne    8004ab <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003f4:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003f7:	89 d8                	mov    %ebx,%eax
+  8003f9:	29 c8                	sub    %ecx,%eax
+  8003fb:	c1 f8 02             	sar    $0x2,%eax
+  8003fe:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800401:	83 f8 02             	cmp    $0x2,%eax
+  800404:	74 7a                	je     800480 <inet_aton+0x1a3>
+  800406:	83 f9 03             	cmp    $0x3,%ecx
+  800409:	7f 49                	jg     800454 <inet_aton+0x177>
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	0f 84 98 00 00 00    	je     8004ab <inet_aton+0x1ce>
+  800413:	83 f9 02             	cmp    $0x2,%ecx
+  800416:	75 19                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80041d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800423:	0f 87 82 00 00 00    	ja     8004ab <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80042c:	c1 e0 18             	shl    $0x18,%eax
+  80042f:	09 c6                	or     %eax,%esi
+  return (1);
+  800431:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800436:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80043a:	74 6f                	je     8004ab <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80043c:	83 ec 0c             	sub    $0xc,%esp
+  80043f:	56                   	push   %esi
+  800440:	e8 6c fe ff ff       	call   8002b1 <htonl>
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80044d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800452:	eb 57                	jmp    8004ab <inet_aton+0x1ce>
+  switch (n) {
+  800454:	83 f9 04             	cmp    $0x4,%ecx
+  800457:	75 d8                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800459:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80045e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800464:	77 45                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800466:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800469:	c1 e0 18             	shl    $0x18,%eax
+  80046c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80046f:	c1 e1 10             	shl    $0x10,%ecx
+  800472:	09 c8                	or     %ecx,%eax
+  800474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800477:	c1 e1 08             	shl    $0x8,%ecx
+  80047a:	09 c8                	or     %ecx,%eax
+  80047c:	09 c6                	or     %eax,%esi
+    break;
+  80047e:	eb b1                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800485:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80048b:	77 1e                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80048d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800490:	c1 e0 18             	shl    $0x18,%eax
+  800493:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800496:	c1 e1 10             	shl    $0x10,%ecx
+  800499:	09 c8                	or     %ecx,%eax
+  80049b:	09 c6                	or     %eax,%esi
+    break;
+  80049d:	eb 92                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	eb 05                	jmp    8004ab <inet_aton+0x1ce>
+        return (0);
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <inet_addr>:
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff 75 08             	push   0x8(%ebp)
+  8004c2:	e8 16 fe ff ff       	call   8002dd <inet_aton>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	75 02                	jne    8004d7 <inet_addr+0x22>
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+    return (val.s_addr);
+  8004d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004da:	eb f9                	jmp    8004d5 <inet_addr+0x20>
+
+008004dc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 c7 fd ff ff       	call   8002b1 <htonl>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	57                   	push   %edi
+  8004f3:	56                   	push   %esi
+  8004f4:	53                   	push   %ebx
+  8004f5:	83 ec 1c             	sub    $0x1c,%esp
+  8004f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8004fe:	e8 ee 0a 00 00       	call   800ff1 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800503:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800506:	89 15 e0 72 80 00    	mov    %edx,0x8072e0
+	thisenv = &envs[ENVX(eid)];
+  80050c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800511:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800513:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800515:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80051b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800520:	77 16                	ja     800538 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800522:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800527:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800529:	c1 e8 10             	shr    $0x10,%eax
+  80052c:	74 0a                	je     800538 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80052e:	c1 e0 10             	shl    $0x10,%eax
+  800531:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800536:	29 c2                	sub    %eax,%edx
+  800538:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80053b:	c1 e0 04             	shl    $0x4,%eax
+  80053e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800543:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800545:	85 db                	test   %ebx,%ebx
+  800547:	7e 07                	jle    800550 <libmain+0x61>
+		binaryname = argv[0];
+  800549:	8b 06                	mov    (%esi),%eax
+  80054b:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	56                   	push   %esi
+  800554:	53                   	push   %ebx
+  800555:	e8 79 fb ff ff       	call   8000d3 <umain>
+
+	// exit gracefully
+	exit();
+  80055a:	e8 0b 00 00 00       	call   80056a <exit>
+}
+  80055f:	83 c4 10             	add    $0x10,%esp
+  800562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800565:	5b                   	pop    %ebx
+  800566:	5e                   	pop    %esi
+  800567:	5f                   	pop    %edi
+  800568:	5d                   	pop    %ebp
+  800569:	c3                   	ret
+
+0080056a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80056a:	55                   	push   %ebp
+  80056b:	89 e5                	mov    %esp,%ebp
+  80056d:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800570:	6a 00                	push   $0x0
+  800572:	e8 cf 20 00 00       	call   802646 <fflush>
+	pthread_kill_others();
+  800577:	e8 3a 37 00 00       	call   803cb6 <pthread_kill_others>
+	close_all();
+  80057c:	e8 68 11 00 00       	call   8016e9 <close_all>
+	sys_env_destroy(0);
+  800581:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800588:	e8 19 0a 00 00       	call   800fa6 <sys_env_destroy>
+}
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	c9                   	leave
+  800591:	c3                   	ret
+
+00800592 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800592:	55                   	push   %ebp
+  800593:	89 e5                	mov    %esp,%ebp
+  800595:	53                   	push   %ebx
+  800596:	83 ec 04             	sub    $0x4,%esp
+  800599:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80059c:	8b 13                	mov    (%ebx),%edx
+  80059e:	8d 42 01             	lea    0x1(%edx),%eax
+  8005a1:	89 03                	mov    %eax,(%ebx)
+  8005a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005a6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8005aa:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005af:	74 09                	je     8005ba <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005b1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005b8:	c9                   	leave
+  8005b9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	68 ff 00 00 00       	push   $0xff
+  8005c2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005c5:	50                   	push   %eax
+  8005c6:	e8 84 09 00 00       	call   800f4f <sys_cputs>
+		b->idx = 0;
+  8005cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005d1:	83 c4 10             	add    $0x10,%esp
+  8005d4:	eb db                	jmp    8005b1 <putch+0x1f>
+
+008005d6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005d6:	55                   	push   %ebp
+  8005d7:	89 e5                	mov    %esp,%ebp
+  8005d9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005df:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005e6:	00 00 00 
+	b.cnt = 0;
+  8005e9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005f0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005f3:	ff 75 0c             	push   0xc(%ebp)
+  8005f6:	ff 75 08             	push   0x8(%ebp)
+  8005f9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005ff:	50                   	push   %eax
+  800600:	68 92 05 80 00       	push   $0x800592
+  800605:	e8 14 01 00 00       	call   80071e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80060a:	83 c4 08             	add    $0x8,%esp
+  80060d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800613:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800619:	50                   	push   %eax
+  80061a:	e8 30 09 00 00       	call   800f4f <sys_cputs>
+
+	return b.cnt;
+}
+  80061f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+00800627 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800627:	55                   	push   %ebp
+  800628:	89 e5                	mov    %esp,%ebp
+  80062a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80062d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800630:	50                   	push   %eax
+  800631:	ff 75 08             	push   0x8(%ebp)
+  800634:	e8 9d ff ff ff       	call   8005d6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800639:	c9                   	leave
+  80063a:	c3                   	ret
+
+0080063b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80063b:	55                   	push   %ebp
+  80063c:	89 e5                	mov    %esp,%ebp
+  80063e:	57                   	push   %edi
+  80063f:	56                   	push   %esi
+  800640:	53                   	push   %ebx
+  800641:	83 ec 1c             	sub    $0x1c,%esp
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	89 d6                	mov    %edx,%esi
+  800648:	8b 45 08             	mov    0x8(%ebp),%eax
+  80064b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80064e:	89 d1                	mov    %edx,%ecx
+  800650:	89 c2                	mov    %eax,%edx
+  800652:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800655:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800658:	8b 45 10             	mov    0x10(%ebp),%eax
+  80065b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80065e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800661:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800668:	39 c2                	cmp    %eax,%edx
+  80066a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80066d:	72 3e                	jb     8006ad <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80066f:	83 ec 0c             	sub    $0xc,%esp
+  800672:	ff 75 18             	push   0x18(%ebp)
+  800675:	83 eb 01             	sub    $0x1,%ebx
+  800678:	53                   	push   %ebx
+  800679:	50                   	push   %eax
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	ff 75 e4             	push   -0x1c(%ebp)
+  800680:	ff 75 e0             	push   -0x20(%ebp)
+  800683:	ff 75 dc             	push   -0x24(%ebp)
+  800686:	ff 75 d8             	push   -0x28(%ebp)
+  800689:	e8 67 43 00 00       	call   8049f5 <__udivdi3>
+  80068e:	83 c4 18             	add    $0x18,%esp
+  800691:	52                   	push   %edx
+  800692:	50                   	push   %eax
+  800693:	89 f2                	mov    %esi,%edx
+  800695:	89 f8                	mov    %edi,%eax
+  800697:	e8 9f ff ff ff       	call   80063b <printnum>
+  80069c:	83 c4 20             	add    $0x20,%esp
+  80069f:	eb 13                	jmp    8006b4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	56                   	push   %esi
+  8006a5:	ff 75 18             	push   0x18(%ebp)
+  8006a8:	ff d7                	call   *%edi
+  8006aa:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8006ad:	83 eb 01             	sub    $0x1,%ebx
+  8006b0:	85 db                	test   %ebx,%ebx
+  8006b2:	7f ed                	jg     8006a1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	56                   	push   %esi
+  8006b8:	83 ec 04             	sub    $0x4,%esp
+  8006bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006be:	ff 75 e0             	push   -0x20(%ebp)
+  8006c1:	ff 75 dc             	push   -0x24(%ebp)
+  8006c4:	ff 75 d8             	push   -0x28(%ebp)
+  8006c7:	e8 4a 43 00 00       	call   804a16 <__umoddi3>
+  8006cc:	83 c4 14             	add    $0x14,%esp
+  8006cf:	0f be 80 c5 4c 80 00 	movsbl 0x804cc5(%eax),%eax
+  8006d6:	50                   	push   %eax
+  8006d7:	ff d7                	call   *%edi
+}
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006df:	5b                   	pop    %ebx
+  8006e0:	5e                   	pop    %esi
+  8006e1:	5f                   	pop    %edi
+  8006e2:	5d                   	pop    %ebp
+  8006e3:	c3                   	ret
+
+008006e4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006e4:	55                   	push   %ebp
+  8006e5:	89 e5                	mov    %esp,%ebp
+  8006e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006ea:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006f3:	73 0a                	jae    8006ff <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006f5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006f8:	89 08                	mov    %ecx,(%eax)
+  8006fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006fd:	88 02                	mov    %al,(%edx)
+}
+  8006ff:	5d                   	pop    %ebp
+  800700:	c3                   	ret
+
+00800701 <printfmt>:
+{
+  800701:	55                   	push   %ebp
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800707:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80070a:	50                   	push   %eax
+  80070b:	ff 75 10             	push   0x10(%ebp)
+  80070e:	ff 75 0c             	push   0xc(%ebp)
+  800711:	ff 75 08             	push   0x8(%ebp)
+  800714:	e8 05 00 00 00       	call   80071e <vprintfmt>
+}
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	c9                   	leave
+  80071d:	c3                   	ret
+
+0080071e <vprintfmt>:
+{
+  80071e:	55                   	push   %ebp
+  80071f:	89 e5                	mov    %esp,%ebp
+  800721:	57                   	push   %edi
+  800722:	56                   	push   %esi
+  800723:	53                   	push   %ebx
+  800724:	83 ec 2c             	sub    $0x2c,%esp
+  800727:	8b 75 08             	mov    0x8(%ebp),%esi
+  80072a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80072d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800730:	eb 0a                	jmp    80073c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800732:	83 ec 08             	sub    $0x8,%esp
+  800735:	53                   	push   %ebx
+  800736:	50                   	push   %eax
+  800737:	ff d6                	call   *%esi
+  800739:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80073c:	83 c7 01             	add    $0x1,%edi
+  80073f:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800743:	83 f8 25             	cmp    $0x25,%eax
+  800746:	74 0c                	je     800754 <vprintfmt+0x36>
+			if (ch == '\0')
+  800748:	85 c0                	test   %eax,%eax
+  80074a:	75 e6                	jne    800732 <vprintfmt+0x14>
+}
+  80074c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80074f:	5b                   	pop    %ebx
+  800750:	5e                   	pop    %esi
+  800751:	5f                   	pop    %edi
+  800752:	5d                   	pop    %ebp
+  800753:	c3                   	ret
+		padc = ' ';
+  800754:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800758:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80075f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800766:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80076d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800772:	8d 47 01             	lea    0x1(%edi),%eax
+  800775:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800778:	0f b6 17             	movzbl (%edi),%edx
+  80077b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80077e:	3c 55                	cmp    $0x55,%al
+  800780:	0f 87 c5 03 00 00    	ja     800b4b <vprintfmt+0x42d>
+  800786:	0f b6 c0             	movzbl %al,%eax
+  800789:	ff 24 85 40 4e 80 00 	jmp    *0x804e40(,%eax,4)
+  800790:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800793:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800796:	eb da                	jmp    800772 <vprintfmt+0x54>
+  800798:	0f be d2             	movsbl %dl,%edx
+  80079b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8007a6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8007a9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8007ad:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8007b0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8007b3:	83 f9 09             	cmp    $0x9,%ecx
+  8007b6:	77 55                	ja     80080d <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8007b8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8007bb:	eb e9                	jmp    8007a6 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 00                	mov    (%eax),%eax
+  8007c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8007ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8007d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007d5:	79 9b                	jns    800772 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007e4:	eb 8c                	jmp    800772 <vprintfmt+0x54>
+			if (width < 0)
+  8007e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	0f 49 c2             	cmovns %edx,%eax
+  8007f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8007f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007f9:	e9 74 ff ff ff       	jmp    800772 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8007fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800801:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800808:	e9 65 ff ff ff       	jmp    800772 <vprintfmt+0x54>
+  80080d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800810:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800813:	eb bc                	jmp    8007d1 <vprintfmt+0xb3>
+			lflag++;
+  800815:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800818:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80081b:	e9 52 ff ff ff       	jmp    800772 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8d 78 04             	lea    0x4(%eax),%edi
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	53                   	push   %ebx
+  80082a:	ff 30                	push   (%eax)
+  80082c:	ff d6                	call   *%esi
+			break;
+  80082e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800831:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800834:	e9 b1 02 00 00       	jmp    800aea <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80083f:	8b 10                	mov    (%eax),%edx
+  800841:	89 d0                	mov    %edx,%eax
+  800843:	f7 d8                	neg    %eax
+  800845:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800848:	83 f8 14             	cmp    $0x14,%eax
+  80084b:	7f 23                	jg     800870 <vprintfmt+0x152>
+  80084d:	8b 14 85 a0 4f 80 00 	mov    0x804fa0(,%eax,4),%edx
+  800854:	85 d2                	test   %edx,%edx
+  800856:	74 18                	je     800870 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800858:	52                   	push   %edx
+  800859:	68 0f 51 80 00       	push   $0x80510f
+  80085e:	53                   	push   %ebx
+  80085f:	56                   	push   %esi
+  800860:	e8 9c fe ff ff       	call   800701 <printfmt>
+  800865:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800868:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80086b:	e9 7a 02 00 00       	jmp    800aea <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800870:	50                   	push   %eax
+  800871:	68 dd 4c 80 00       	push   $0x804cdd
+  800876:	53                   	push   %ebx
+  800877:	56                   	push   %esi
+  800878:	e8 84 fe ff ff       	call   800701 <printfmt>
+  80087d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800880:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800883:	e9 62 02 00 00       	jmp    800aea <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	83 c0 04             	add    $0x4,%eax
+  80088e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800891:	8b 45 14             	mov    0x14(%ebp),%eax
+  800894:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800896:	85 c9                	test   %ecx,%ecx
+  800898:	b8 d6 4c 80 00       	mov    $0x804cd6,%eax
+  80089d:	0f 45 c1             	cmovne %ecx,%eax
+  8008a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8008a3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008a7:	7e 06                	jle    8008af <vprintfmt+0x191>
+  8008a9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8008ad:	75 0b                	jne    8008ba <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8008b2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8008b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008b8:	eb 5c                	jmp    800916 <vprintfmt+0x1f8>
+  8008ba:	83 ec 08             	sub    $0x8,%esp
+  8008bd:	ff 75 d0             	push   -0x30(%ebp)
+  8008c0:	ff 75 cc             	push   -0x34(%ebp)
+  8008c3:	e8 20 03 00 00       	call   800be8 <strnlen>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008cd:	29 d0                	sub    %edx,%eax
+  8008cf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8008d2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008dc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008de:	eb 0e                	jmp    8008ee <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	53                   	push   %ebx
+  8008e4:	57                   	push   %edi
+  8008e5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008e8:	83 ee 01             	sub    $0x1,%esi
+  8008eb:	83 c4 10             	add    $0x10,%esp
+  8008ee:	85 f6                	test   %esi,%esi
+  8008f0:	7f ee                	jg     8008e0 <vprintfmt+0x1c2>
+  8008f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f8:	85 c0                	test   %eax,%eax
+  8008fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ff:	0f 49 d0             	cmovns %eax,%edx
+  800902:	29 d0                	sub    %edx,%eax
+  800904:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800907:	eb a6                	jmp    8008af <vprintfmt+0x191>
+					putch(ch, putdat);
+  800909:	83 ec 08             	sub    $0x8,%esp
+  80090c:	53                   	push   %ebx
+  80090d:	52                   	push   %edx
+  80090e:	ff 55 08             	call   *0x8(%ebp)
+  800911:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800914:	89 f1                	mov    %esi,%ecx
+  800916:	8d 71 01             	lea    0x1(%ecx),%esi
+  800919:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80091d:	0f be d0             	movsbl %al,%edx
+  800920:	85 d2                	test   %edx,%edx
+  800922:	74 28                	je     80094c <vprintfmt+0x22e>
+  800924:	85 ff                	test   %edi,%edi
+  800926:	78 05                	js     80092d <vprintfmt+0x20f>
+  800928:	83 ef 01             	sub    $0x1,%edi
+  80092b:	78 30                	js     80095d <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80092d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800931:	74 d6                	je     800909 <vprintfmt+0x1eb>
+  800933:	0f be c0             	movsbl %al,%eax
+  800936:	83 e8 20             	sub    $0x20,%eax
+  800939:	83 f8 5e             	cmp    $0x5e,%eax
+  80093c:	76 cb                	jbe    800909 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 3f                	push   $0x3f
+  800944:	ff 55 08             	call   *0x8(%ebp)
+  800947:	83 c4 10             	add    $0x10,%esp
+  80094a:	eb c8                	jmp    800914 <vprintfmt+0x1f6>
+  80094c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80094f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800952:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800955:	01 d0                	add    %edx,%eax
+  800957:	29 c8                	sub    %ecx,%eax
+  800959:	89 c7                	mov    %eax,%edi
+  80095b:	eb 13                	jmp    800970 <vprintfmt+0x252>
+  80095d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800960:	eb ed                	jmp    80094f <vprintfmt+0x231>
+				putch(' ', putdat);
+  800962:	83 ec 08             	sub    $0x8,%esp
+  800965:	53                   	push   %ebx
+  800966:	6a 20                	push   $0x20
+  800968:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80096a:	83 ef 01             	sub    $0x1,%edi
+  80096d:	83 c4 10             	add    $0x10,%esp
+  800970:	85 ff                	test   %edi,%edi
+  800972:	7f ee                	jg     800962 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800974:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800977:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097a:	e9 6b 01 00 00       	jmp    800aea <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80097f:	83 f9 01             	cmp    $0x1,%ecx
+  800982:	7f 1f                	jg     8009a3 <vprintfmt+0x285>
+	else if (lflag)
+  800984:	85 c9                	test   %ecx,%ecx
+  800986:	74 67                	je     8009ef <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098b:	8b 00                	mov    (%eax),%eax
+  80098d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800990:	89 c1                	mov    %eax,%ecx
+  800992:	c1 f9 1f             	sar    $0x1f,%ecx
+  800995:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8d 40 04             	lea    0x4(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a1:	eb 17                	jmp    8009ba <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8009a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8009a9:	8b 00                	mov    (%eax),%eax
+  8009ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009ae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8009ba:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009bd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8009c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8009c5:	85 c9                	test   %ecx,%ecx
+  8009c7:	0f 89 03 01 00 00    	jns    800ad0 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8009cd:	83 ec 08             	sub    $0x8,%esp
+  8009d0:	53                   	push   %ebx
+  8009d1:	6a 2d                	push   $0x2d
+  8009d3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8009d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009db:	f7 da                	neg    %edx
+  8009dd:	83 d1 00             	adc    $0x0,%ecx
+  8009e0:	f7 d9                	neg    %ecx
+  8009e2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009ea:	e9 e1 00 00 00       	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8b 00                	mov    (%eax),%eax
+  8009f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009f7:	89 c1                	mov    %eax,%ecx
+  8009f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a02:	8d 40 04             	lea    0x4(%eax),%eax
+  800a05:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a08:	eb b0                	jmp    8009ba <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800a0a:	83 f9 01             	cmp    $0x1,%ecx
+  800a0d:	7f 1e                	jg     800a2d <vprintfmt+0x30f>
+	else if (lflag)
+  800a0f:	85 c9                	test   %ecx,%ecx
+  800a11:	74 32                	je     800a45 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800a13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a16:	8b 10                	mov    (%eax),%edx
+  800a18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a23:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800a28:	e9 a3 00 00 00       	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a30:	8b 10                	mov    (%eax),%edx
+  800a32:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a35:	8d 40 08             	lea    0x8(%eax),%eax
+  800a38:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a3b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a40:	e9 8b 00 00 00       	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a45:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a48:	8b 10                	mov    (%eax),%edx
+  800a4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a55:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a5a:	eb 74                	jmp    800ad0 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800a5c:	83 f9 01             	cmp    $0x1,%ecx
+  800a5f:	7f 1b                	jg     800a7c <vprintfmt+0x35e>
+	else if (lflag)
+  800a61:	85 c9                	test   %ecx,%ecx
+  800a63:	74 2c                	je     800a91 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a68:	8b 10                	mov    (%eax),%edx
+  800a6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a72:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a75:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a7a:	eb 54                	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7f:	8b 10                	mov    (%eax),%edx
+  800a81:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a84:	8d 40 08             	lea    0x8(%eax),%eax
+  800a87:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a8a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a8f:	eb 3f                	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a91:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a94:	8b 10                	mov    (%eax),%edx
+  800a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800aa1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800aa6:	eb 28                	jmp    800ad0 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800aa8:	83 ec 08             	sub    $0x8,%esp
+  800aab:	53                   	push   %ebx
+  800aac:	6a 30                	push   $0x30
+  800aae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ab0:	83 c4 08             	add    $0x8,%esp
+  800ab3:	53                   	push   %ebx
+  800ab4:	6a 78                	push   $0x78
+  800ab6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abb:	8b 10                	mov    (%eax),%edx
+  800abd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800ac2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800ac5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800acb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800ad0:	83 ec 0c             	sub    $0xc,%esp
+  800ad3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ad7:	50                   	push   %eax
+  800ad8:	ff 75 e0             	push   -0x20(%ebp)
+  800adb:	57                   	push   %edi
+  800adc:	51                   	push   %ecx
+  800add:	52                   	push   %edx
+  800ade:	89 da                	mov    %ebx,%edx
+  800ae0:	89 f0                	mov    %esi,%eax
+  800ae2:	e8 54 fb ff ff       	call   80063b <printnum>
+			break;
+  800ae7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800aea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800aed:	e9 4a fc ff ff       	jmp    80073c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800af2:	83 f9 01             	cmp    $0x1,%ecx
+  800af5:	7f 1b                	jg     800b12 <vprintfmt+0x3f4>
+	else if (lflag)
+  800af7:	85 c9                	test   %ecx,%ecx
+  800af9:	74 2c                	je     800b27 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800afb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afe:	8b 10                	mov    (%eax),%edx
+  800b00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b05:	8d 40 04             	lea    0x4(%eax),%eax
+  800b08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b0b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800b10:	eb be                	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800b12:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b15:	8b 10                	mov    (%eax),%edx
+  800b17:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b1a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b20:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800b25:	eb a9                	jmp    800ad0 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2a:	8b 10                	mov    (%eax),%edx
+  800b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b31:	8d 40 04             	lea    0x4(%eax),%eax
+  800b34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b37:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b3c:	eb 92                	jmp    800ad0 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800b3e:	83 ec 08             	sub    $0x8,%esp
+  800b41:	53                   	push   %ebx
+  800b42:	6a 25                	push   $0x25
+  800b44:	ff d6                	call   *%esi
+			break;
+  800b46:	83 c4 10             	add    $0x10,%esp
+  800b49:	eb 9f                	jmp    800aea <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800b4b:	83 ec 08             	sub    $0x8,%esp
+  800b4e:	53                   	push   %ebx
+  800b4f:	6a 25                	push   $0x25
+  800b51:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b53:	83 c4 10             	add    $0x10,%esp
+  800b56:	89 f8                	mov    %edi,%eax
+  800b58:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b5c:	74 05                	je     800b63 <vprintfmt+0x445>
+  800b5e:	83 e8 01             	sub    $0x1,%eax
+  800b61:	eb f5                	jmp    800b58 <vprintfmt+0x43a>
+  800b63:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b66:	eb 82                	jmp    800aea <vprintfmt+0x3cc>
+
+00800b68 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	83 ec 18             	sub    $0x18,%esp
+  800b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b74:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b77:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b7b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b7e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b85:	85 c0                	test   %eax,%eax
+  800b87:	74 26                	je     800baf <vsnprintf+0x47>
+  800b89:	85 d2                	test   %edx,%edx
+  800b8b:	7e 22                	jle    800baf <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b8d:	ff 75 14             	push   0x14(%ebp)
+  800b90:	ff 75 10             	push   0x10(%ebp)
+  800b93:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b96:	50                   	push   %eax
+  800b97:	68 e4 06 80 00       	push   $0x8006e4
+  800b9c:	e8 7d fb ff ff       	call   80071e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ba1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ba4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ba7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800baa:	83 c4 10             	add    $0x10,%esp
+}
+  800bad:	c9                   	leave
+  800bae:	c3                   	ret
+		return -E_INVAL;
+  800baf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb4:	eb f7                	jmp    800bad <vsnprintf+0x45>
+
+00800bb6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bbc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bbf:	50                   	push   %eax
+  800bc0:	ff 75 10             	push   0x10(%ebp)
+  800bc3:	ff 75 0c             	push   0xc(%ebp)
+  800bc6:	ff 75 08             	push   0x8(%ebp)
+  800bc9:	e8 9a ff ff ff       	call   800b68 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bce:	c9                   	leave
+  800bcf:	c3                   	ret
+
+00800bd0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdb:	eb 03                	jmp    800be0 <strlen+0x10>
+		n++;
+  800bdd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800be0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800be4:	75 f7                	jne    800bdd <strlen+0xd>
+	return n;
+}
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+
+00800be8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf6:	eb 03                	jmp    800bfb <strnlen+0x13>
+		n++;
+  800bf8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bfb:	39 d0                	cmp    %edx,%eax
+  800bfd:	74 08                	je     800c07 <strnlen+0x1f>
+  800bff:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c03:	75 f3                	jne    800bf8 <strnlen+0x10>
+  800c05:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800c07:	89 d0                	mov    %edx,%eax
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+
+00800c0b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c0b:	55                   	push   %ebp
+  800c0c:	89 e5                	mov    %esp,%ebp
+  800c0e:	53                   	push   %ebx
+  800c0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c1e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c21:	83 c0 01             	add    $0x1,%eax
+  800c24:	84 d2                	test   %dl,%dl
+  800c26:	75 f2                	jne    800c1a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c28:	89 c8                	mov    %ecx,%eax
+  800c2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2d:	c9                   	leave
+  800c2e:	c3                   	ret
+
+00800c2f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	53                   	push   %ebx
+  800c33:	83 ec 10             	sub    $0x10,%esp
+  800c36:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c39:	53                   	push   %ebx
+  800c3a:	e8 91 ff ff ff       	call   800bd0 <strlen>
+  800c3f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c42:	ff 75 0c             	push   0xc(%ebp)
+  800c45:	01 d8                	add    %ebx,%eax
+  800c47:	50                   	push   %eax
+  800c48:	e8 be ff ff ff       	call   800c0b <strcpy>
+	return dst;
+}
+  800c4d:	89 d8                	mov    %ebx,%eax
+  800c4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+
+00800c54 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c5f:	89 f3                	mov    %esi,%ebx
+  800c61:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c64:	89 f0                	mov    %esi,%eax
+  800c66:	eb 0f                	jmp    800c77 <strncpy+0x23>
+		*dst++ = *src;
+  800c68:	83 c0 01             	add    $0x1,%eax
+  800c6b:	0f b6 0a             	movzbl (%edx),%ecx
+  800c6e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c71:	80 f9 01             	cmp    $0x1,%cl
+  800c74:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c77:	39 d8                	cmp    %ebx,%eax
+  800c79:	75 ed                	jne    800c68 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c7b:	89 f0                	mov    %esi,%eax
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  800c86:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c8f:	89 f0                	mov    %esi,%eax
+  800c91:	85 d2                	test   %edx,%edx
+  800c93:	74 21                	je     800cb6 <strlcpy+0x35>
+  800c95:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c99:	89 f2                	mov    %esi,%edx
+  800c9b:	eb 09                	jmp    800ca6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c9d:	83 c1 01             	add    $0x1,%ecx
+  800ca0:	83 c2 01             	add    $0x1,%edx
+  800ca3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ca6:	39 c2                	cmp    %eax,%edx
+  800ca8:	74 09                	je     800cb3 <strlcpy+0x32>
+  800caa:	0f b6 19             	movzbl (%ecx),%ebx
+  800cad:	84 db                	test   %bl,%bl
+  800caf:	75 ec                	jne    800c9d <strlcpy+0x1c>
+  800cb1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800cb3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800cb6:	29 f0                	sub    %esi,%eax
+}
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+
+00800cbc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cc5:	eb 06                	jmp    800ccd <strcmp+0x11>
+		p++, q++;
+  800cc7:	83 c1 01             	add    $0x1,%ecx
+  800cca:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ccd:	0f b6 01             	movzbl (%ecx),%eax
+  800cd0:	84 c0                	test   %al,%al
+  800cd2:	74 04                	je     800cd8 <strcmp+0x1c>
+  800cd4:	3a 02                	cmp    (%edx),%al
+  800cd6:	74 ef                	je     800cc7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd8:	0f b6 c0             	movzbl %al,%eax
+  800cdb:	0f b6 12             	movzbl (%edx),%edx
+  800cde:	29 d0                	sub    %edx,%eax
+}
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+
+00800ce2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	53                   	push   %ebx
+  800ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cec:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cef:	eb 09                	jmp    800cfa <strncmp+0x18>
+		n--, p++, q++;
+  800cf1:	83 ea 01             	sub    $0x1,%edx
+  800cf4:	83 c0 01             	add    $0x1,%eax
+  800cf7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cfa:	85 d2                	test   %edx,%edx
+  800cfc:	74 18                	je     800d16 <strncmp+0x34>
+  800cfe:	0f b6 18             	movzbl (%eax),%ebx
+  800d01:	84 db                	test   %bl,%bl
+  800d03:	74 04                	je     800d09 <strncmp+0x27>
+  800d05:	3a 19                	cmp    (%ecx),%bl
+  800d07:	74 e8                	je     800cf1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d09:	0f b6 00             	movzbl (%eax),%eax
+  800d0c:	0f b6 11             	movzbl (%ecx),%edx
+  800d0f:	29 d0                	sub    %edx,%eax
+}
+  800d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d14:	c9                   	leave
+  800d15:	c3                   	ret
+		return 0;
+  800d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1b:	eb f4                	jmp    800d11 <strncmp+0x2f>
+
+00800d1d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d23:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d27:	eb 03                	jmp    800d2c <strchr+0xf>
+  800d29:	83 c0 01             	add    $0x1,%eax
+  800d2c:	0f b6 10             	movzbl (%eax),%edx
+  800d2f:	84 d2                	test   %dl,%dl
+  800d31:	74 06                	je     800d39 <strchr+0x1c>
+		if (*s == c)
+  800d33:	38 ca                	cmp    %cl,%dl
+  800d35:	75 f2                	jne    800d29 <strchr+0xc>
+  800d37:	eb 05                	jmp    800d3e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d3e:	5d                   	pop    %ebp
+  800d3f:	c3                   	ret
+
+00800d40 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d4a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d4d:	38 ca                	cmp    %cl,%dl
+  800d4f:	74 09                	je     800d5a <strfind+0x1a>
+  800d51:	84 d2                	test   %dl,%dl
+  800d53:	74 05                	je     800d5a <strfind+0x1a>
+	for (; *s; s++)
+  800d55:	83 c0 01             	add    $0x1,%eax
+  800d58:	eb f0                	jmp    800d4a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	c3                   	ret
+
+00800d5c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	57                   	push   %edi
+  800d60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d66:	85 c9                	test   %ecx,%ecx
+  800d68:	74 20                	je     800d8a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d6a:	89 f8                	mov    %edi,%eax
+  800d6c:	09 c8                	or     %ecx,%eax
+  800d6e:	a8 03                	test   $0x3,%al
+  800d70:	75 12                	jne    800d84 <memset+0x28>
+		c &= 0xFF;
+  800d72:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d76:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d7c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d7f:	fc                   	cld
+  800d80:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d82:	eb 06                	jmp    800d8a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d87:	fc                   	cld
+  800d88:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d8a:	89 f8                	mov    %edi,%eax
+  800d8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d8f:	c9                   	leave
+  800d90:	c3                   	ret
+
+00800d91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	57                   	push   %edi
+  800d95:	56                   	push   %esi
+  800d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d9f:	39 c6                	cmp    %eax,%esi
+  800da1:	73 32                	jae    800dd5 <memmove+0x44>
+  800da3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800da6:	39 d0                	cmp    %edx,%eax
+  800da8:	73 2b                	jae    800dd5 <memmove+0x44>
+		s += n;
+		d += n;
+  800daa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dad:	89 d6                	mov    %edx,%esi
+  800daf:	09 fe                	or     %edi,%esi
+  800db1:	09 ce                	or     %ecx,%esi
+  800db3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800db9:	75 0e                	jne    800dc9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800dbb:	83 ef 04             	sub    $0x4,%edi
+  800dbe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800dc1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800dc4:	fd                   	std
+  800dc5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc7:	eb 09                	jmp    800dd2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dc9:	83 ef 01             	sub    $0x1,%edi
+  800dcc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dcf:	fd                   	std
+  800dd0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dd2:	fc                   	cld
+  800dd3:	eb 1a                	jmp    800def <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dd5:	89 f2                	mov    %esi,%edx
+  800dd7:	09 c2                	or     %eax,%edx
+  800dd9:	09 ca                	or     %ecx,%edx
+  800ddb:	f6 c2 03             	test   $0x3,%dl
+  800dde:	75 0a                	jne    800dea <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800de0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800de3:	89 c7                	mov    %eax,%edi
+  800de5:	fc                   	cld
+  800de6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800de8:	eb 05                	jmp    800def <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dea:	89 c7                	mov    %eax,%edi
+  800dec:	fc                   	cld
+  800ded:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+
+00800df3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800df9:	ff 75 10             	push   0x10(%ebp)
+  800dfc:	ff 75 0c             	push   0xc(%ebp)
+  800dff:	ff 75 08             	push   0x8(%ebp)
+  800e02:	e8 8a ff ff ff       	call   800d91 <memmove>
+}
+  800e07:	c9                   	leave
+  800e08:	c3                   	ret
+
+00800e09 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e11:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e14:	89 c6                	mov    %eax,%esi
+  800e16:	03 75 10             	add    0x10(%ebp),%esi
+  800e19:	eb 06                	jmp    800e21 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e1b:	83 c0 01             	add    $0x1,%eax
+  800e1e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e21:	39 f0                	cmp    %esi,%eax
+  800e23:	74 14                	je     800e39 <memcmp+0x30>
+		if (*s1 != *s2)
+  800e25:	0f b6 08             	movzbl (%eax),%ecx
+  800e28:	0f b6 1a             	movzbl (%edx),%ebx
+  800e2b:	38 d9                	cmp    %bl,%cl
+  800e2d:	74 ec                	je     800e1b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e2f:	0f b6 c1             	movzbl %cl,%eax
+  800e32:	0f b6 db             	movzbl %bl,%ebx
+  800e35:	29 d8                	sub    %ebx,%eax
+  800e37:	eb 05                	jmp    800e3e <memcmp+0x35>
+	}
+
+	return 0;
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e4b:	89 c2                	mov    %eax,%edx
+  800e4d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e50:	eb 03                	jmp    800e55 <memfind+0x13>
+  800e52:	83 c0 01             	add    $0x1,%eax
+  800e55:	39 d0                	cmp    %edx,%eax
+  800e57:	73 04                	jae    800e5d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e59:	38 08                	cmp    %cl,(%eax)
+  800e5b:	75 f5                	jne    800e52 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+
+00800e5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	56                   	push   %esi
+  800e64:	53                   	push   %ebx
+  800e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e6b:	eb 03                	jmp    800e70 <strtol+0x11>
+		s++;
+  800e6d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e70:	0f b6 02             	movzbl (%edx),%eax
+  800e73:	3c 20                	cmp    $0x20,%al
+  800e75:	74 f6                	je     800e6d <strtol+0xe>
+  800e77:	3c 09                	cmp    $0x9,%al
+  800e79:	74 f2                	je     800e6d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e7b:	3c 2b                	cmp    $0x2b,%al
+  800e7d:	74 2a                	je     800ea9 <strtol+0x4a>
+	int neg = 0;
+  800e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e84:	3c 2d                	cmp    $0x2d,%al
+  800e86:	74 2b                	je     800eb3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e88:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e8e:	75 0f                	jne    800e9f <strtol+0x40>
+  800e90:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e93:	74 28                	je     800ebd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e95:	85 db                	test   %ebx,%ebx
+  800e97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9c:	0f 44 d8             	cmove  %eax,%ebx
+  800e9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ea7:	eb 46                	jmp    800eef <strtol+0x90>
+		s++;
+  800ea9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb1:	eb d5                	jmp    800e88 <strtol+0x29>
+		s++, neg = 1;
+  800eb3:	83 c2 01             	add    $0x1,%edx
+  800eb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ebb:	eb cb                	jmp    800e88 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ebd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ec1:	74 0e                	je     800ed1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ec3:	85 db                	test   %ebx,%ebx
+  800ec5:	75 d8                	jne    800e9f <strtol+0x40>
+		s++, base = 8;
+  800ec7:	83 c2 01             	add    $0x1,%edx
+  800eca:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ecf:	eb ce                	jmp    800e9f <strtol+0x40>
+		s += 2, base = 16;
+  800ed1:	83 c2 02             	add    $0x2,%edx
+  800ed4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ed9:	eb c4                	jmp    800e9f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800edb:	0f be c0             	movsbl %al,%eax
+  800ede:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ee1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ee4:	7d 3a                	jge    800f20 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ee6:	83 c2 01             	add    $0x1,%edx
+  800ee9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eed:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eef:	0f b6 02             	movzbl (%edx),%eax
+  800ef2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ef5:	89 f3                	mov    %esi,%ebx
+  800ef7:	80 fb 09             	cmp    $0x9,%bl
+  800efa:	76 df                	jbe    800edb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800efc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800eff:	89 f3                	mov    %esi,%ebx
+  800f01:	80 fb 19             	cmp    $0x19,%bl
+  800f04:	77 08                	ja     800f0e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800f06:	0f be c0             	movsbl %al,%eax
+  800f09:	83 e8 57             	sub    $0x57,%eax
+  800f0c:	eb d3                	jmp    800ee1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f0e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f11:	89 f3                	mov    %esi,%ebx
+  800f13:	80 fb 19             	cmp    $0x19,%bl
+  800f16:	77 08                	ja     800f20 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800f18:	0f be c0             	movsbl %al,%eax
+  800f1b:	83 e8 37             	sub    $0x37,%eax
+  800f1e:	eb c1                	jmp    800ee1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f20:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f24:	74 05                	je     800f2b <strtol+0xcc>
+		*endptr = (char *) s;
+  800f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f29:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f2b:	89 c8                	mov    %ecx,%eax
+  800f2d:	f7 d8                	neg    %eax
+  800f2f:	85 ff                	test   %edi,%edi
+  800f31:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f34:	89 c8                	mov    %ecx,%eax
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <atoi>:
+
+int
+atoi(const char* s)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800f41:	6a 00                	push   $0x0
+  800f43:	6a 00                	push   $0x0
+  800f45:	ff 75 08             	push   0x8(%ebp)
+  800f48:	e8 12 ff ff ff       	call   800e5f <strtol>
+}
+  800f4d:	c9                   	leave
+  800f4e:	c3                   	ret
+
+00800f4f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	89 c3                	mov    %eax,%ebx
+  800f61:	89 c7                	mov    %eax,%edi
+  800f63:	6a 00                	push   $0x0
+  800f65:	55                   	push   %ebp
+  800f66:	56                   	push   %esi
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	8d 35 71 0f 80 00    	lea    0x800f71,%esi
+  800f6f:	0f 34                	sysenter
+
+00800f71 <after_sysenter_label_47>:
+  800f71:	5e                   	pop    %esi
+  800f72:	5d                   	pop    %ebp
+  800f73:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f76:	5b                   	pop    %ebx
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+
+00800f7a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f89:	89 d1                	mov    %edx,%ecx
+  800f8b:	89 d3                	mov    %edx,%ebx
+  800f8d:	89 d7                	mov    %edx,%edi
+  800f8f:	6a 00                	push   $0x0
+  800f91:	55                   	push   %ebp
+  800f92:	56                   	push   %esi
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	8d 35 9d 0f 80 00    	lea    0x800f9d,%esi
+  800f9b:	0f 34                	sysenter
+
+00800f9d <after_sysenter_label_128>:
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5f                   	pop    %edi
+  800fa4:	5d                   	pop    %ebp
+  800fa5:	c3                   	ret
+
+00800fa6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fb8:	89 cb                	mov    %ecx,%ebx
+  800fba:	89 cf                	mov    %ecx,%edi
+  800fbc:	6a 00                	push   $0x0
+  800fbe:	55                   	push   %ebp
+  800fbf:	56                   	push   %esi
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	8d 35 ca 0f 80 00    	lea    0x800fca,%esi
+  800fc8:	0f 34                	sysenter
+
+00800fca <after_sysenter_label_212>:
+  800fca:	5e                   	pop    %esi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	7f 07                	jg     800fda <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 03                	push   $0x3
+  800fe0:	68 35 50 80 00       	push   $0x805035
+  800fe5:	6a 54                	push   $0x54
+  800fe7:	68 52 50 80 00       	push   $0x805052
+  800fec:	e8 38 30 00 00       	call   804029 <_panic>
+
+00800ff1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801000:	89 d1                	mov    %edx,%ecx
+  801002:	89 d3                	mov    %edx,%ebx
+  801004:	89 d7                	mov    %edx,%edi
+  801006:	6a 00                	push   $0x0
+  801008:	55                   	push   %ebp
+  801009:	56                   	push   %esi
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	8d 35 14 10 80 00    	lea    0x801014,%esi
+  801012:	0f 34                	sysenter
+
+00801014 <after_sysenter_label_309>:
+  801014:	5e                   	pop    %esi
+  801015:	5d                   	pop    %ebp
+  801016:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801019:	5b                   	pop    %ebx
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801022:	ba 00 00 00 00       	mov    $0x0,%edx
+  801027:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80102c:	89 d1                	mov    %edx,%ecx
+  80102e:	89 d3                	mov    %edx,%ebx
+  801030:	89 d7                	mov    %edx,%edi
+  801032:	6a 00                	push   $0x0
+  801034:	55                   	push   %ebp
+  801035:	56                   	push   %esi
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+
+00801040 <after_sysenter_label_391>:
+  801040:	5e                   	pop    %esi
+  801041:	5d                   	pop    %ebp
+  801042:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801045:	5b                   	pop    %ebx
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+
+00801049 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 04 00 00 00       	mov    $0x4,%eax
+  801059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801061:	6a 00                	push   $0x0
+  801063:	55                   	push   %ebp
+  801064:	56                   	push   %esi
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	8d 35 6f 10 80 00    	lea    0x80106f,%esi
+  80106d:	0f 34                	sysenter
+
+0080106f <after_sysenter_label_479>:
+  80106f:	5e                   	pop    %esi
+  801070:	5d                   	pop    %ebp
+  801071:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801074:	85 c0                	test   %eax,%eax
+  801076:	7f 07                	jg     80107f <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80107b:	5b                   	pop    %ebx
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107f:	83 ec 0c             	sub    $0xc,%esp
+  801082:	50                   	push   %eax
+  801083:	6a 04                	push   $0x4
+  801085:	68 35 50 80 00       	push   $0x805035
+  80108a:	6a 54                	push   $0x54
+  80108c:	68 52 50 80 00       	push   $0x805052
+  801091:	e8 93 2f 00 00       	call   804029 <_panic>
+
+00801096 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ac:	ff 75 18             	push   0x18(%ebp)
+  8010af:	55                   	push   %ebp
+  8010b0:	56                   	push   %esi
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	8d 35 bb 10 80 00    	lea    0x8010bb,%esi
+  8010b9:	0f 34                	sysenter
+
+008010bb <after_sysenter_label_593>:
+  8010bb:	5e                   	pop    %esi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 07                	jg     8010cb <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 05                	push   $0x5
+  8010d1:	68 35 50 80 00       	push   $0x805035
+  8010d6:	6a 54                	push   $0x54
+  8010d8:	68 52 50 80 00       	push   $0x805052
+  8010dd:	e8 47 2f 00 00       	call   804029 <_panic>
+
+008010e2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010f7:	89 df                	mov    %ebx,%edi
+  8010f9:	6a 00                	push   $0x0
+  8010fb:	55                   	push   %ebp
+  8010fc:	56                   	push   %esi
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	8d 35 07 11 80 00    	lea    0x801107,%esi
+  801105:	0f 34                	sysenter
+
+00801107 <after_sysenter_label_704>:
+  801107:	5e                   	pop    %esi
+  801108:	5d                   	pop    %ebp
+  801109:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80110c:	85 c0                	test   %eax,%eax
+  80110e:	7f 07                	jg     801117 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801110:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801113:	5b                   	pop    %ebx
+  801114:	5f                   	pop    %edi
+  801115:	5d                   	pop    %ebp
+  801116:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801117:	83 ec 0c             	sub    $0xc,%esp
+  80111a:	50                   	push   %eax
+  80111b:	6a 06                	push   $0x6
+  80111d:	68 35 50 80 00       	push   $0x805035
+  801122:	6a 54                	push   $0x54
+  801124:	68 52 50 80 00       	push   $0x805052
+  801129:	e8 fb 2e 00 00       	call   804029 <_panic>
+
+0080112e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801133:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801143:	89 df                	mov    %ebx,%edi
+  801145:	6a 00                	push   $0x0
+  801147:	55                   	push   %ebp
+  801148:	56                   	push   %esi
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	8d 35 53 11 80 00    	lea    0x801153,%esi
+  801151:	0f 34                	sysenter
+
+00801153 <after_sysenter_label_808>:
+  801153:	5e                   	pop    %esi
+  801154:	5d                   	pop    %ebp
+  801155:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	7f 07                	jg     801163 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80115c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80115f:	5b                   	pop    %ebx
+  801160:	5f                   	pop    %edi
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	50                   	push   %eax
+  801167:	6a 08                	push   $0x8
+  801169:	68 35 50 80 00       	push   $0x805035
+  80116e:	6a 54                	push   $0x54
+  801170:	68 52 50 80 00       	push   $0x805052
+  801175:	e8 af 2e 00 00       	call   804029 <_panic>
+
+0080117a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	6a 00                	push   $0x0
+  801193:	55                   	push   %ebp
+  801194:	56                   	push   %esi
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	8d 35 9f 11 80 00    	lea    0x80119f,%esi
+  80119d:	0f 34                	sysenter
+
+0080119f <after_sysenter_label_912>:
+  80119f:	5e                   	pop    %esi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011a4:	85 c0                	test   %eax,%eax
+  8011a6:	7f 07                	jg     8011af <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011af:	83 ec 0c             	sub    $0xc,%esp
+  8011b2:	50                   	push   %eax
+  8011b3:	6a 09                	push   $0x9
+  8011b5:	68 35 50 80 00       	push   $0x805035
+  8011ba:	6a 54                	push   $0x54
+  8011bc:	68 52 50 80 00       	push   $0x805052
+  8011c1:	e8 63 2e 00 00       	call   804029 <_panic>
+
+008011c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011db:	89 df                	mov    %ebx,%edi
+  8011dd:	6a 00                	push   $0x0
+  8011df:	55                   	push   %ebp
+  8011e0:	56                   	push   %esi
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	8d 35 eb 11 80 00    	lea    0x8011eb,%esi
+  8011e9:	0f 34                	sysenter
+
+008011eb <after_sysenter_label_1016>:
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011f0:	85 c0                	test   %eax,%eax
+  8011f2:	7f 07                	jg     8011fb <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011f7:	5b                   	pop    %ebx
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fb:	83 ec 0c             	sub    $0xc,%esp
+  8011fe:	50                   	push   %eax
+  8011ff:	6a 0a                	push   $0xa
+  801201:	68 35 50 80 00       	push   $0x805035
+  801206:	6a 54                	push   $0x54
+  801208:	68 52 50 80 00       	push   $0x805052
+  80120d:	e8 17 2e 00 00       	call   804029 <_panic>
+
+00801212 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801228:	6a 00                	push   $0x0
+  80122a:	55                   	push   %ebp
+  80122b:	56                   	push   %esi
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	8d 35 36 12 80 00    	lea    0x801236,%esi
+  801234:	0f 34                	sysenter
+
+00801236 <after_sysenter_label_1126>:
+  801236:	5e                   	pop    %esi
+  801237:	5d                   	pop    %ebp
+  801238:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80123b:	5b                   	pop    %ebx
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801244:	8b 55 08             	mov    0x8(%ebp),%edx
+  801247:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801251:	89 cb                	mov    %ecx,%ebx
+  801253:	89 cf                	mov    %ecx,%edi
+  801255:	6a 00                	push   $0x0
+  801257:	55                   	push   %ebp
+  801258:	56                   	push   %esi
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	8d 35 63 12 80 00    	lea    0x801263,%esi
+  801261:	0f 34                	sysenter
+
+00801263 <after_sysenter_label_1210>:
+  801263:	5e                   	pop    %esi
+  801264:	5d                   	pop    %ebp
+  801265:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	7f 07                	jg     801273 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80126c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80126f:	5b                   	pop    %ebx
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801273:	83 ec 0c             	sub    $0xc,%esp
+  801276:	50                   	push   %eax
+  801277:	6a 0d                	push   $0xd
+  801279:	68 35 50 80 00       	push   $0x805035
+  80127e:	6a 54                	push   $0x54
+  801280:	68 52 50 80 00       	push   $0x805052
+  801285:	e8 9f 2d 00 00       	call   804029 <_panic>
+
+0080128a <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80128f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129a:	b8 42 00 00 00       	mov    $0x42,%eax
+  80129f:	89 df                	mov    %ebx,%edi
+  8012a1:	6a 00                	push   $0x0
+  8012a3:	55                   	push   %ebp
+  8012a4:	56                   	push   %esi
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	8d 35 af 12 80 00    	lea    0x8012af,%esi
+  8012ad:	0f 34                	sysenter
+
+008012af <after_sysenter_label_1311>:
+  8012af:	5e                   	pop    %esi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	7f 07                	jg     8012bf <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8012b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5f                   	pop    %edi
+  8012bd:	5d                   	pop    %ebp
+  8012be:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+  8012c2:	50                   	push   %eax
+  8012c3:	6a 42                	push   $0x42
+  8012c5:	68 35 50 80 00       	push   $0x805035
+  8012ca:	6a 54                	push   $0x54
+  8012cc:	68 52 50 80 00       	push   $0x805052
+  8012d1:	e8 53 2d 00 00       	call   804029 <_panic>
+
+008012d6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e5:	89 d1                	mov    %edx,%ecx
+  8012e7:	89 d3                	mov    %edx,%ebx
+  8012e9:	89 d7                	mov    %edx,%edi
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	55                   	push   %ebp
+  8012ee:	56                   	push   %esi
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	8d 35 f9 12 80 00    	lea    0x8012f9,%esi
+  8012f7:	0f 34                	sysenter
+
+008012f9 <after_sysenter_label_1411>:
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801317:	89 df                	mov    %ebx,%edi
+  801319:	6a 00                	push   $0x0
+  80131b:	55                   	push   %ebp
+  80131c:	56                   	push   %esi
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8d 35 27 13 80 00    	lea    0x801327,%esi
+  801325:	0f 34                	sysenter
+
+00801327 <after_sysenter_label_1497>:
+  801327:	5e                   	pop    %esi
+  801328:	5d                   	pop    %ebp
+  801329:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 10 00 00 00       	mov    $0x10,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	6a 00                	push   $0x0
+  801349:	55                   	push   %ebp
+  80134a:	56                   	push   %esi
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	8d 35 55 13 80 00    	lea    0x801355,%esi
+  801353:	0f 34                	sysenter
+
+00801355 <after_sysenter_label_1583>:
+  801355:	5e                   	pop    %esi
+  801356:	5d                   	pop    %ebp
+  801357:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80135a:	5b                   	pop    %ebx
+  80135b:	5f                   	pop    %edi
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+
+0080135e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801369:	b8 11 00 00 00       	mov    $0x11,%eax
+  80136e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801373:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801376:	6a 00                	push   $0x0
+  801378:	55                   	push   %ebp
+  801379:	56                   	push   %esi
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	8d 35 84 13 80 00    	lea    0x801384,%esi
+  801382:	0f 34                	sysenter
+
+00801384 <after_sysenter_label_1672>:
+  801384:	5e                   	pop    %esi
+  801385:	5d                   	pop    %ebp
+  801386:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801389:	5b                   	pop    %ebx
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013a2:	89 df                	mov    %ebx,%edi
+  8013a4:	6a 00                	push   $0x0
+  8013a6:	55                   	push   %ebp
+  8013a7:	56                   	push   %esi
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	8d 35 b2 13 80 00    	lea    0x8013b2,%esi
+  8013b0:	0f 34                	sysenter
+
+008013b2 <after_sysenter_label_1758>:
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8013b7:	5b                   	pop    %ebx
+  8013b8:	5f                   	pop    %edi
+  8013b9:	5d                   	pop    %ebp
+  8013ba:	c3                   	ret
+
+008013bb <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013cd:	89 cb                	mov    %ecx,%ebx
+  8013cf:	89 cf                	mov    %ecx,%edi
+  8013d1:	6a 00                	push   $0x0
+  8013d3:	55                   	push   %ebp
+  8013d4:	56                   	push   %esi
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	8d 35 df 13 80 00    	lea    0x8013df,%esi
+  8013dd:	0f 34                	sysenter
+
+008013df <after_sysenter_label_1842>:
+  8013df:	5e                   	pop    %esi
+  8013e0:	5d                   	pop    %ebp
+  8013e1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	7f 07                	jg     8013ef <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8013e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013eb:	5b                   	pop    %ebx
+  8013ec:	5f                   	pop    %edi
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+  8013f2:	50                   	push   %eax
+  8013f3:	6a 13                	push   $0x13
+  8013f5:	68 35 50 80 00       	push   $0x805035
+  8013fa:	6a 54                	push   $0x54
+  8013fc:	68 52 50 80 00       	push   $0x805052
+  801401:	e8 23 2c 00 00       	call   804029 <_panic>
+
+00801406 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	57                   	push   %edi
+  80140a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	b8 14 00 00 00       	mov    $0x14,%eax
+  801415:	89 d1                	mov    %edx,%ecx
+  801417:	89 d3                	mov    %edx,%ebx
+  801419:	89 d7                	mov    %edx,%edi
+  80141b:	6a 00                	push   $0x0
+  80141d:	55                   	push   %ebp
+  80141e:	56                   	push   %esi
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	8d 35 29 14 80 00    	lea    0x801429,%esi
+  801427:	0f 34                	sysenter
+
+00801429 <after_sysenter_label_1939>:
+  801429:	5e                   	pop    %esi
+  80142a:	5d                   	pop    %ebp
+  80142b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80142e:	5b                   	pop    %ebx
+  80142f:	5f                   	pop    %edi
+  801430:	5d                   	pop    %ebp
+  801431:	c3                   	ret
+
+00801432 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	57                   	push   %edi
+  801436:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801437:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801442:	bf 00 00 00 00       	mov    $0x0,%edi
+  801447:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80144a:	6a 00                	push   $0x0
+  80144c:	55                   	push   %ebp
+  80144d:	56                   	push   %esi
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	8d 35 58 14 80 00    	lea    0x801458,%esi
+  801456:	0f 34                	sysenter
+
+00801458 <after_sysenter_label_2028>:
+  801458:	5e                   	pop    %esi
+  801459:	5d                   	pop    %ebp
+  80145a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80145d:	5b                   	pop    %ebx
+  80145e:	5f                   	pop    %edi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+
+00801461 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801471:	b8 16 00 00 00       	mov    $0x16,%eax
+  801476:	89 df                	mov    %ebx,%edi
+  801478:	6a 00                	push   $0x0
+  80147a:	55                   	push   %ebp
+  80147b:	56                   	push   %esi
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	8d 35 86 14 80 00    	lea    0x801486,%esi
+  801484:	0f 34                	sysenter
+
+00801486 <after_sysenter_label_2114>:
+  801486:	5e                   	pop    %esi
+  801487:	5d                   	pop    %ebp
+  801488:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80148b:	5b                   	pop    %ebx
+  80148c:	5f                   	pop    %edi
+  80148d:	5d                   	pop    %ebp
+  80148e:	c3                   	ret
+
+0080148f <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149f:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014a4:	89 df                	mov    %ebx,%edi
+  8014a6:	6a 00                	push   $0x0
+  8014a8:	55                   	push   %ebp
+  8014a9:	56                   	push   %esi
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	8d 35 b4 14 80 00    	lea    0x8014b4,%esi
+  8014b2:	0f 34                	sysenter
+
+008014b4 <after_sysenter_label_2200>:
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5f                   	pop    %edi
+  8014bb:	5d                   	pop    %ebp
+  8014bc:	c3                   	ret
+
+008014bd <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	57                   	push   %edi
+  8014c1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014d2:	89 df                	mov    %ebx,%edi
+  8014d4:	6a 00                	push   $0x0
+  8014d6:	55                   	push   %ebp
+  8014d7:	56                   	push   %esi
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	8d 35 e2 14 80 00    	lea    0x8014e2,%esi
+  8014e0:	0f 34                	sysenter
+
+008014e2 <after_sysenter_label_2286>:
+  8014e2:	5e                   	pop    %esi
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8014e7:	5b                   	pop    %ebx
+  8014e8:	5f                   	pop    %edi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+
+008014eb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014f9:	5d                   	pop    %ebp
+  8014fa:	c3                   	ret
+
+008014fb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801501:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801506:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80150b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+
+00801512 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801515:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80151a:	eb 02                	jmp    80151e <fd_alloc+0xc>
+  80151c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80151e:	89 c2                	mov    %eax,%edx
+  801520:	c1 ea 16             	shr    $0x16,%edx
+  801523:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80152a:	f6 c2 01             	test   $0x1,%dl
+  80152d:	74 2b                	je     80155a <fd_alloc+0x48>
+  80152f:	89 c2                	mov    %eax,%edx
+  801531:	c1 ea 0c             	shr    $0xc,%edx
+  801534:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80153b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801541:	f6 c1 01             	test   $0x1,%cl
+  801544:	74 14                	je     80155a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801546:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80154c:	75 ce                	jne    80151c <fd_alloc+0xa>
+  80154e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801553:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801558:	eb 05                	jmp    80155f <fd_alloc+0x4d>
+			return 0;
+  80155a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	89 02                	mov    %eax,(%edx)
+}
+  801564:	89 c8                	mov    %ecx,%eax
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80156e:	83 f8 1f             	cmp    $0x1f,%eax
+  801571:	77 30                	ja     8015a3 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801573:	c1 e0 0c             	shl    $0xc,%eax
+  801576:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80157b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801581:	f6 c2 01             	test   $0x1,%dl
+  801584:	74 24                	je     8015aa <fd_lookup+0x42>
+  801586:	89 c2                	mov    %eax,%edx
+  801588:	c1 ea 0c             	shr    $0xc,%edx
+  80158b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801592:	f6 c2 01             	test   $0x1,%dl
+  801595:	74 1a                	je     8015b1 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801597:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80159a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80159c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a1:	5d                   	pop    %ebp
+  8015a2:	c3                   	ret
+		return -E_INVAL;
+  8015a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a8:	eb f7                	jmp    8015a1 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015af:	eb f0                	jmp    8015a1 <fd_lookup+0x39>
+  8015b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b6:	eb e9                	jmp    8015a1 <fd_lookup+0x39>
+
+008015b8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	53                   	push   %ebx
+  8015bc:	83 ec 04             	sub    $0x4,%esp
+  8015bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	eb 03                	jmp    8015cc <dev_lookup+0x14>
+  8015c9:	83 c0 01             	add    $0x1,%eax
+  8015cc:	8b 1c 85 dc 50 80 00 	mov    0x8050dc(,%eax,4),%ebx
+  8015d3:	85 db                	test   %ebx,%ebx
+  8015d5:	74 0b                	je     8015e2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015d7:	39 13                	cmp    %edx,(%ebx)
+  8015d9:	75 ee                	jne    8015c9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e0:	eb 49                	jmp    80162b <dev_lookup+0x73>
+  8015e2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015e4:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8015ea:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015ef:	77 18                	ja     801609 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015f1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015f6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8015f8:	c1 e8 10             	shr    $0x10,%eax
+  8015fb:	74 0c                	je     801609 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015fd:	c1 e0 10             	shl    $0x10,%eax
+  801600:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801605:	29 c1                	sub    %eax,%ecx
+  801607:	eb 06                	jmp    80160f <dev_lookup+0x57>
+		return pthread_main_tls;
+  801609:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80160f:	8b 01                	mov    (%ecx),%eax
+  801611:	8b 40 48             	mov    0x48(%eax),%eax
+  801614:	83 ec 04             	sub    $0x4,%esp
+  801617:	52                   	push   %edx
+  801618:	50                   	push   %eax
+  801619:	68 60 50 80 00       	push   $0x805060
+  80161e:	e8 04 f0 ff ff       	call   800627 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80162b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80162e:	89 1a                	mov    %ebx,(%edx)
+}
+  801630:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+00801635 <fd_close>:
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	57                   	push   %edi
+  801639:	56                   	push   %esi
+  80163a:	53                   	push   %ebx
+  80163b:	83 ec 24             	sub    $0x24,%esp
+  80163e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801641:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801644:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801647:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801648:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80164e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801651:	50                   	push   %eax
+  801652:	e8 11 ff ff ff       	call   801568 <fd_lookup>
+  801657:	89 c3                	mov    %eax,%ebx
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	78 05                	js     801665 <fd_close+0x30>
+	    || fd != fd2)
+  801660:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801663:	74 16                	je     80167b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801665:	89 f8                	mov    %edi,%eax
+  801667:	84 c0                	test   %al,%al
+  801669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801671:	89 d8                	mov    %ebx,%eax
+  801673:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801676:	5b                   	pop    %ebx
+  801677:	5e                   	pop    %esi
+  801678:	5f                   	pop    %edi
+  801679:	5d                   	pop    %ebp
+  80167a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80167b:	83 ec 08             	sub    $0x8,%esp
+  80167e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801681:	50                   	push   %eax
+  801682:	ff 36                	push   (%esi)
+  801684:	e8 2f ff ff ff       	call   8015b8 <dev_lookup>
+  801689:	89 c3                	mov    %eax,%ebx
+  80168b:	83 c4 10             	add    $0x10,%esp
+  80168e:	85 c0                	test   %eax,%eax
+  801690:	78 1a                	js     8016ac <fd_close+0x77>
+		if (dev->dev_close)
+  801692:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801695:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801698:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	74 0b                	je     8016ac <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016a1:	83 ec 0c             	sub    $0xc,%esp
+  8016a4:	56                   	push   %esi
+  8016a5:	ff d0                	call   *%eax
+  8016a7:	89 c3                	mov    %eax,%ebx
+  8016a9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016ac:	83 ec 08             	sub    $0x8,%esp
+  8016af:	56                   	push   %esi
+  8016b0:	6a 00                	push   $0x0
+  8016b2:	e8 2b fa ff ff       	call   8010e2 <sys_page_unmap>
+	return r;
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	eb b5                	jmp    801671 <fd_close+0x3c>
+
+008016bc <close>:
+
+int
+close(int fdnum)
+{
+  8016bc:	55                   	push   %ebp
+  8016bd:	89 e5                	mov    %esp,%ebp
+  8016bf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c5:	50                   	push   %eax
+  8016c6:	ff 75 08             	push   0x8(%ebp)
+  8016c9:	e8 9a fe ff ff       	call   801568 <fd_lookup>
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	79 02                	jns    8016d7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016d5:	c9                   	leave
+  8016d6:	c3                   	ret
+		return fd_close(fd, 1);
+  8016d7:	83 ec 08             	sub    $0x8,%esp
+  8016da:	6a 01                	push   $0x1
+  8016dc:	ff 75 f4             	push   -0xc(%ebp)
+  8016df:	e8 51 ff ff ff       	call   801635 <fd_close>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	eb ec                	jmp    8016d5 <close+0x19>
+
+008016e9 <close_all>:
+
+void
+close_all(void)
+{
+  8016e9:	55                   	push   %ebp
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	53                   	push   %ebx
+  8016ed:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016f5:	83 ec 0c             	sub    $0xc,%esp
+  8016f8:	53                   	push   %ebx
+  8016f9:	e8 be ff ff ff       	call   8016bc <close>
+	for (i = 0; i < MAXFD; i++)
+  8016fe:	83 c3 01             	add    $0x1,%ebx
+  801701:	83 c4 10             	add    $0x10,%esp
+  801704:	83 fb 20             	cmp    $0x20,%ebx
+  801707:	75 ec                	jne    8016f5 <close_all+0xc>
+}
+  801709:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170c:	c9                   	leave
+  80170d:	c3                   	ret
+
+0080170e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801717:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	ff 75 08             	push   0x8(%ebp)
+  80171e:	e8 45 fe ff ff       	call   801568 <fd_lookup>
+  801723:	89 c3                	mov    %eax,%ebx
+  801725:	83 c4 10             	add    $0x10,%esp
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	78 7f                	js     8017ab <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	ff 75 0c             	push   0xc(%ebp)
+  801732:	e8 85 ff ff ff       	call   8016bc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801737:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80173a:	c1 e6 0c             	shl    $0xc,%esi
+  80173d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801743:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801746:	89 3c 24             	mov    %edi,(%esp)
+  801749:	e8 ad fd ff ff       	call   8014fb <fd2data>
+  80174e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801750:	89 34 24             	mov    %esi,(%esp)
+  801753:	e8 a3 fd ff ff       	call   8014fb <fd2data>
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80175e:	89 d8                	mov    %ebx,%eax
+  801760:	c1 e8 16             	shr    $0x16,%eax
+  801763:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80176a:	a8 01                	test   $0x1,%al
+  80176c:	74 11                	je     80177f <dup+0x71>
+  80176e:	89 d8                	mov    %ebx,%eax
+  801770:	c1 e8 0c             	shr    $0xc,%eax
+  801773:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80177a:	f6 c2 01             	test   $0x1,%dl
+  80177d:	75 36                	jne    8017b5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80177f:	89 f8                	mov    %edi,%eax
+  801781:	c1 e8 0c             	shr    $0xc,%eax
+  801784:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80178b:	83 ec 0c             	sub    $0xc,%esp
+  80178e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801793:	50                   	push   %eax
+  801794:	56                   	push   %esi
+  801795:	6a 00                	push   $0x0
+  801797:	57                   	push   %edi
+  801798:	6a 00                	push   $0x0
+  80179a:	e8 f7 f8 ff ff       	call   801096 <sys_page_map>
+  80179f:	89 c3                	mov    %eax,%ebx
+  8017a1:	83 c4 20             	add    $0x20,%esp
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	78 33                	js     8017db <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017ab:	89 d8                	mov    %ebx,%eax
+  8017ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b0:	5b                   	pop    %ebx
+  8017b1:	5e                   	pop    %esi
+  8017b2:	5f                   	pop    %edi
+  8017b3:	5d                   	pop    %ebp
+  8017b4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+  8017bf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017c4:	50                   	push   %eax
+  8017c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8017c8:	6a 00                	push   $0x0
+  8017ca:	53                   	push   %ebx
+  8017cb:	6a 00                	push   $0x0
+  8017cd:	e8 c4 f8 ff ff       	call   801096 <sys_page_map>
+  8017d2:	89 c3                	mov    %eax,%ebx
+  8017d4:	83 c4 20             	add    $0x20,%esp
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	79 a4                	jns    80177f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	56                   	push   %esi
+  8017df:	6a 00                	push   $0x0
+  8017e1:	e8 fc f8 ff ff       	call   8010e2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017e6:	83 c4 08             	add    $0x8,%esp
+  8017e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ec:	6a 00                	push   $0x0
+  8017ee:	e8 ef f8 ff ff       	call   8010e2 <sys_page_unmap>
+	return r;
+  8017f3:	83 c4 10             	add    $0x10,%esp
+  8017f6:	eb b3                	jmp    8017ab <dup+0x9d>
+
+008017f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	56                   	push   %esi
+  8017fc:	53                   	push   %ebx
+  8017fd:	83 ec 18             	sub    $0x18,%esp
+  801800:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801803:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801806:	50                   	push   %eax
+  801807:	53                   	push   %ebx
+  801808:	e8 5b fd ff ff       	call   801568 <fd_lookup>
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 3c                	js     801850 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801814:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801817:	83 ec 08             	sub    $0x8,%esp
+  80181a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80181d:	50                   	push   %eax
+  80181e:	ff 36                	push   (%esi)
+  801820:	e8 93 fd ff ff       	call   8015b8 <dev_lookup>
+  801825:	83 c4 10             	add    $0x10,%esp
+  801828:	85 c0                	test   %eax,%eax
+  80182a:	78 24                	js     801850 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80182c:	8b 46 08             	mov    0x8(%esi),%eax
+  80182f:	83 e0 03             	and    $0x3,%eax
+  801832:	83 f8 01             	cmp    $0x1,%eax
+  801835:	74 20                	je     801857 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80183a:	8b 40 08             	mov    0x8(%eax),%eax
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	74 61                	je     8018a2 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801841:	83 ec 04             	sub    $0x4,%esp
+  801844:	ff 75 10             	push   0x10(%ebp)
+  801847:	ff 75 0c             	push   0xc(%ebp)
+  80184a:	56                   	push   %esi
+  80184b:	ff d0                	call   *%eax
+  80184d:	83 c4 10             	add    $0x10,%esp
+}
+  801850:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801853:	5b                   	pop    %ebx
+  801854:	5e                   	pop    %esi
+  801855:	5d                   	pop    %ebp
+  801856:	c3                   	ret
+  801857:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801859:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80185f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801864:	77 18                	ja     80187e <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801866:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80186b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80186d:	c1 e8 10             	shr    $0x10,%eax
+  801870:	74 0c                	je     80187e <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801872:	c1 e0 10             	shl    $0x10,%eax
+  801875:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80187a:	29 c2                	sub    %eax,%edx
+  80187c:	eb 06                	jmp    801884 <read+0x8c>
+		return pthread_main_tls;
+  80187e:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801884:	8b 02                	mov    (%edx),%eax
+  801886:	8b 40 48             	mov    0x48(%eax),%eax
+  801889:	83 ec 04             	sub    $0x4,%esp
+  80188c:	53                   	push   %ebx
+  80188d:	50                   	push   %eax
+  80188e:	68 a1 50 80 00       	push   $0x8050a1
+  801893:	e8 8f ed ff ff       	call   800627 <cprintf>
+		return -E_INVAL;
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a0:	eb ae                	jmp    801850 <read+0x58>
+		return -E_NOT_SUPP;
+  8018a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a7:	eb a7                	jmp    801850 <read+0x58>
+
+008018a9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	57                   	push   %edi
+  8018ad:	56                   	push   %esi
+  8018ae:	53                   	push   %ebx
+  8018af:	83 ec 0c             	sub    $0xc,%esp
+  8018b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018b5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bd:	eb 02                	jmp    8018c1 <readn+0x18>
+  8018bf:	01 c3                	add    %eax,%ebx
+  8018c1:	39 f3                	cmp    %esi,%ebx
+  8018c3:	73 21                	jae    8018e6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018c5:	83 ec 04             	sub    $0x4,%esp
+  8018c8:	89 f0                	mov    %esi,%eax
+  8018ca:	29 d8                	sub    %ebx,%eax
+  8018cc:	50                   	push   %eax
+  8018cd:	89 d8                	mov    %ebx,%eax
+  8018cf:	03 45 0c             	add    0xc(%ebp),%eax
+  8018d2:	50                   	push   %eax
+  8018d3:	57                   	push   %edi
+  8018d4:	e8 1f ff ff ff       	call   8017f8 <read>
+		if (m < 0)
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 04                	js     8018e4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018e0:	75 dd                	jne    8018bf <readn+0x16>
+  8018e2:	eb 02                	jmp    8018e6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018e4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018e6:	89 d8                	mov    %ebx,%eax
+  8018e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5f                   	pop    %edi
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+
+008018f0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	56                   	push   %esi
+  8018f4:	53                   	push   %ebx
+  8018f5:	83 ec 18             	sub    $0x18,%esp
+  8018f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018fb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018fe:	50                   	push   %eax
+  8018ff:	53                   	push   %ebx
+  801900:	e8 63 fc ff ff       	call   801568 <fd_lookup>
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 37                	js     801943 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80190c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80190f:	83 ec 08             	sub    $0x8,%esp
+  801912:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801915:	50                   	push   %eax
+  801916:	ff 36                	push   (%esi)
+  801918:	e8 9b fc ff ff       	call   8015b8 <dev_lookup>
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	78 1f                	js     801943 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801924:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801928:	74 20                	je     80194a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80192a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80192d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801930:	85 c0                	test   %eax,%eax
+  801932:	74 61                	je     801995 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801934:	83 ec 04             	sub    $0x4,%esp
+  801937:	ff 75 10             	push   0x10(%ebp)
+  80193a:	ff 75 0c             	push   0xc(%ebp)
+  80193d:	56                   	push   %esi
+  80193e:	ff d0                	call   *%eax
+  801940:	83 c4 10             	add    $0x10,%esp
+}
+  801943:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+  80194a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80194c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801952:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801957:	77 18                	ja     801971 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801959:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80195e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801960:	c1 e8 10             	shr    $0x10,%eax
+  801963:	74 0c                	je     801971 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801965:	c1 e0 10             	shl    $0x10,%eax
+  801968:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80196d:	29 c2                	sub    %eax,%edx
+  80196f:	eb 06                	jmp    801977 <write+0x87>
+		return pthread_main_tls;
+  801971:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801977:	8b 02                	mov    (%edx),%eax
+  801979:	8b 40 48             	mov    0x48(%eax),%eax
+  80197c:	83 ec 04             	sub    $0x4,%esp
+  80197f:	53                   	push   %ebx
+  801980:	50                   	push   %eax
+  801981:	68 bd 50 80 00       	push   $0x8050bd
+  801986:	e8 9c ec ff ff       	call   800627 <cprintf>
+		return -E_INVAL;
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801993:	eb ae                	jmp    801943 <write+0x53>
+		return -E_NOT_SUPP;
+  801995:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80199a:	eb a7                	jmp    801943 <write+0x53>
+
+0080199c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80199c:	55                   	push   %ebp
+  80199d:	89 e5                	mov    %esp,%ebp
+  80199f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a5:	50                   	push   %eax
+  8019a6:	ff 75 08             	push   0x8(%ebp)
+  8019a9:	e8 ba fb ff ff       	call   801568 <fd_lookup>
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 0e                	js     8019c3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8019b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019bb:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c3:	c9                   	leave
+  8019c4:	c3                   	ret
+
+008019c5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	56                   	push   %esi
+  8019c9:	53                   	push   %ebx
+  8019ca:	83 ec 18             	sub    $0x18,%esp
+  8019cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d3:	50                   	push   %eax
+  8019d4:	53                   	push   %ebx
+  8019d5:	e8 8e fb ff ff       	call   801568 <fd_lookup>
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	78 34                	js     801a15 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019e4:	83 ec 08             	sub    $0x8,%esp
+  8019e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ea:	50                   	push   %eax
+  8019eb:	ff 36                	push   (%esi)
+  8019ed:	e8 c6 fb ff ff       	call   8015b8 <dev_lookup>
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	85 c0                	test   %eax,%eax
+  8019f7:	78 1c                	js     801a15 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019f9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019fd:	74 1d                	je     801a1c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a02:	8b 40 18             	mov    0x18(%eax),%eax
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	74 5e                	je     801a67 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a09:	83 ec 08             	sub    $0x8,%esp
+  801a0c:	ff 75 0c             	push   0xc(%ebp)
+  801a0f:	56                   	push   %esi
+  801a10:	ff d0                	call   *%eax
+  801a12:	83 c4 10             	add    $0x10,%esp
+}
+  801a15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a18:	5b                   	pop    %ebx
+  801a19:	5e                   	pop    %esi
+  801a1a:	5d                   	pop    %ebp
+  801a1b:	c3                   	ret
+  801a1c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a1e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a24:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a29:	77 18                	ja     801a43 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a2b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a30:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a32:	c1 e8 10             	shr    $0x10,%eax
+  801a35:	74 0c                	je     801a43 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a37:	c1 e0 10             	shl    $0x10,%eax
+  801a3a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a3f:	29 c2                	sub    %eax,%edx
+  801a41:	eb 06                	jmp    801a49 <ftruncate+0x84>
+		return pthread_main_tls;
+  801a43:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			thisenv->env_id, fdnum);
+  801a49:	8b 02                	mov    (%edx),%eax
+  801a4b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a4e:	83 ec 04             	sub    $0x4,%esp
+  801a51:	53                   	push   %ebx
+  801a52:	50                   	push   %eax
+  801a53:	68 80 50 80 00       	push   $0x805080
+  801a58:	e8 ca eb ff ff       	call   800627 <cprintf>
+		return -E_INVAL;
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a65:	eb ae                	jmp    801a15 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a6c:	eb a7                	jmp    801a15 <ftruncate+0x50>
+
+00801a6e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a6e:	55                   	push   %ebp
+  801a6f:	89 e5                	mov    %esp,%ebp
+  801a71:	56                   	push   %esi
+  801a72:	53                   	push   %ebx
+  801a73:	83 ec 18             	sub    $0x18,%esp
+  801a76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a79:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a7c:	50                   	push   %eax
+  801a7d:	ff 75 08             	push   0x8(%ebp)
+  801a80:	e8 e3 fa ff ff       	call   801568 <fd_lookup>
+  801a85:	83 c4 10             	add    $0x10,%esp
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 49                	js     801ad5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a8c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a95:	50                   	push   %eax
+  801a96:	ff 36                	push   (%esi)
+  801a98:	e8 1b fb ff ff       	call   8015b8 <dev_lookup>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 31                	js     801ad5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801aab:	74 2f                	je     801adc <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801aad:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ab0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ab7:	00 00 00 
+	stat->st_isdir = 0;
+  801aba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ac1:	00 00 00 
+	stat->st_dev = dev;
+  801ac4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801aca:	83 ec 08             	sub    $0x8,%esp
+  801acd:	53                   	push   %ebx
+  801ace:	56                   	push   %esi
+  801acf:	ff 50 14             	call   *0x14(%eax)
+  801ad2:	83 c4 10             	add    $0x10,%esp
+}
+  801ad5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad8:	5b                   	pop    %ebx
+  801ad9:	5e                   	pop    %esi
+  801ada:	5d                   	pop    %ebp
+  801adb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801adc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae1:	eb f2                	jmp    801ad5 <fstat+0x67>
+
+00801ae3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	56                   	push   %esi
+  801ae7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ae8:	83 ec 08             	sub    $0x8,%esp
+  801aeb:	6a 00                	push   $0x0
+  801aed:	ff 75 08             	push   0x8(%ebp)
+  801af0:	e8 4b 03 00 00       	call   801e40 <open>
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 1b                	js     801b19 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801afe:	83 ec 08             	sub    $0x8,%esp
+  801b01:	ff 75 0c             	push   0xc(%ebp)
+  801b04:	50                   	push   %eax
+  801b05:	e8 64 ff ff ff       	call   801a6e <fstat>
+  801b0a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b0c:	89 1c 24             	mov    %ebx,(%esp)
+  801b0f:	e8 a8 fb ff ff       	call   8016bc <close>
+	return r;
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	89 f3                	mov    %esi,%ebx
+}
+  801b19:	89 d8                	mov    %ebx,%eax
+  801b1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1e:	5b                   	pop    %ebx
+  801b1f:	5e                   	pop    %esi
+  801b20:	5d                   	pop    %ebp
+  801b21:	c3                   	ret
+
+00801b22 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	56                   	push   %esi
+  801b26:	53                   	push   %ebx
+  801b27:	89 c6                	mov    %eax,%esi
+  801b29:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801b2b:	83 3d 10 70 80 00 00 	cmpl   $0x0,0x807010
+  801b32:	74 27                	je     801b5b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b34:	6a 07                	push   $0x7
+  801b36:	68 00 80 80 00       	push   $0x808000
+  801b3b:	56                   	push   %esi
+  801b3c:	ff 35 10 70 80 00    	push   0x807010
+  801b42:	e8 94 2c 00 00       	call   8047db <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b47:	83 c4 0c             	add    $0xc,%esp
+  801b4a:	6a 00                	push   $0x0
+  801b4c:	53                   	push   %ebx
+  801b4d:	6a 00                	push   $0x0
+  801b4f:	e8 91 2b 00 00       	call   8046e5 <ipc_recv>
+}
+  801b54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b57:	5b                   	pop    %ebx
+  801b58:	5e                   	pop    %esi
+  801b59:	5d                   	pop    %ebp
+  801b5a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b5b:	83 ec 0c             	sub    $0xc,%esp
+  801b5e:	6a 01                	push   $0x1
+  801b60:	e8 cc 2c 00 00       	call   804831 <ipc_find_env>
+  801b65:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	eb c5                	jmp    801b34 <fsipc+0x12>
+
+00801b6f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	53                   	push   %ebx
+  801b73:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801b76:	68 14 70 80 00       	push   $0x807014
+  801b7b:	e8 29 1b 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b83:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b86:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801b8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8e:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b9d:	e8 80 ff ff ff       	call   801b22 <fsipc>
+  801ba2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ba4:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801bab:	e8 66 1b 00 00       	call   803716 <mutex_unlock>
+	return r;
+}
+  801bb0:	89 d8                	mov    %ebx,%eax
+  801bb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+00801bb7 <devfile_flush>:
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801bbe:	68 14 70 80 00       	push   $0x807014
+  801bc3:	e8 e1 1a 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bcb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bce:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801bd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bdd:	e8 40 ff ff ff       	call   801b22 <fsipc>
+  801be2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801be4:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801beb:	e8 26 1b 00 00       	call   803716 <mutex_unlock>
+}
+  801bf0:	89 d8                	mov    %ebx,%eax
+  801bf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+00801bf7 <devfile_stat>:
+{
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	56                   	push   %esi
+  801bfb:	53                   	push   %ebx
+  801bfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801bff:	83 ec 0c             	sub    $0xc,%esp
+  801c02:	68 14 70 80 00       	push   $0x807014
+  801c07:	e8 9d 1a 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c12:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c21:	e8 fc fe ff ff       	call   801b22 <fsipc>
+  801c26:	89 c3                	mov    %eax,%ebx
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	79 16                	jns    801c45 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801c2f:	83 ec 0c             	sub    $0xc,%esp
+  801c32:	68 14 70 80 00       	push   $0x807014
+  801c37:	e8 da 1a 00 00       	call   803716 <mutex_unlock>
+}
+  801c3c:	89 d8                	mov    %ebx,%eax
+  801c3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c41:	5b                   	pop    %ebx
+  801c42:	5e                   	pop    %esi
+  801c43:	5d                   	pop    %ebp
+  801c44:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	68 00 80 80 00       	push   $0x808000
+  801c4d:	56                   	push   %esi
+  801c4e:	e8 b8 ef ff ff       	call   800c0b <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801c53:	a1 80 80 80 00       	mov    0x808080,%eax
+  801c58:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c5e:	a1 84 80 80 00       	mov    0x808084,%eax
+  801c63:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801c69:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801c6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c71:	eb bc                	jmp    801c2f <devfile_stat+0x38>
+
+00801c73 <devfile_write>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	53                   	push   %ebx
+  801c77:	83 ec 10             	sub    $0x10,%esp
+  801c7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801c7d:	68 14 70 80 00       	push   $0x807014
+  801c82:	e8 22 1a 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c8d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801c9b:	76 3d                	jbe    801cda <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801c9d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801ca2:	39 c3                	cmp    %eax,%ebx
+  801ca4:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801ca7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801caa:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801caf:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801cb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cba:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cbf:	e8 5e fe ff ff       	call   801b22 <fsipc>
+  801cc4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	68 14 70 80 00       	push   $0x807014
+  801cce:	e8 43 1a 00 00       	call   803716 <mutex_unlock>
+}
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801cda:	83 ec 04             	sub    $0x4,%esp
+  801cdd:	53                   	push   %ebx
+  801cde:	ff 75 0c             	push   0xc(%ebp)
+  801ce1:	68 0c 80 80 00       	push   $0x80800c
+  801ce6:	e8 a6 f0 ff ff       	call   800d91 <memmove>
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf3:	eb b5                	jmp    801caa <devfile_write+0x37>
+
+00801cf5 <devfile_read>:
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	57                   	push   %edi
+  801cf9:	56                   	push   %esi
+  801cfa:	53                   	push   %ebx
+  801cfb:	83 ec 0c             	sub    $0xc,%esp
+  801cfe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801d07:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801d0d:	0f 86 8c 00 00 00    	jbe    801d9f <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801d13:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801d18:	39 c3                	cmp    %eax,%ebx
+  801d1a:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801d1d:	89 f8                	mov    %edi,%eax
+  801d1f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d22:	eb 0f                	jmp    801d33 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801d24:	0f b6 08             	movzbl (%eax),%ecx
+  801d27:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801d29:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d2e:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801d33:	39 d0                	cmp    %edx,%eax
+  801d35:	72 ed                	jb     801d24 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801d37:	83 ec 0c             	sub    $0xc,%esp
+  801d3a:	68 14 70 80 00       	push   $0x807014
+  801d3f:	e8 65 19 00 00       	call   8036a9 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d44:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d47:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801d4c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801d52:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d62:	e8 bb fd ff ff       	call   801b22 <fsipc>
+  801d67:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801d69:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801d70:	e8 a1 19 00 00       	call   803716 <mutex_unlock>
+		assert(r <= (int) n);
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	39 f3                	cmp    %esi,%ebx
+  801d7a:	7c 0a                	jl     801d86 <devfile_read+0x91>
+}
+  801d7c:	89 f0                	mov    %esi,%eax
+  801d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d81:	5b                   	pop    %ebx
+  801d82:	5e                   	pop    %esi
+  801d83:	5f                   	pop    %edi
+  801d84:	5d                   	pop    %ebp
+  801d85:	c3                   	ret
+		assert(r <= (int) n);
+  801d86:	68 f0 50 80 00       	push   $0x8050f0
+  801d8b:	68 fd 50 80 00       	push   $0x8050fd
+  801d90:	68 90 00 00 00       	push   $0x90
+  801d95:	68 12 51 80 00       	push   $0x805112
+  801d9a:	e8 8a 22 00 00       	call   804029 <_panic>
+	mutex_lock(&fsipc_mu);
+  801d9f:	83 ec 0c             	sub    $0xc,%esp
+  801da2:	68 14 70 80 00       	push   $0x807014
+  801da7:	e8 fd 18 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801dac:	8b 46 0c             	mov    0xc(%esi),%eax
+  801daf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801db4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801dba:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801dc1:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dce:	e8 4f fd ff ff       	call   801b22 <fsipc>
+  801dd3:	89 c6                	mov    %eax,%esi
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 1d                	js     801df9 <devfile_read+0x104>
+		assert(r <= n);
+  801ddc:	39 c3                	cmp    %eax,%ebx
+  801dde:	72 2e                	jb     801e0e <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801de0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801de5:	7f 40                	jg     801e27 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801de7:	83 ec 04             	sub    $0x4,%esp
+  801dea:	50                   	push   %eax
+  801deb:	68 00 80 80 00       	push   $0x808000
+  801df0:	57                   	push   %edi
+  801df1:	e8 9b ef ff ff       	call   800d91 <memmove>
+  801df6:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801df9:	83 ec 0c             	sub    $0xc,%esp
+  801dfc:	68 14 70 80 00       	push   $0x807014
+  801e01:	e8 10 19 00 00       	call   803716 <mutex_unlock>
+	return r;
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	e9 6e ff ff ff       	jmp    801d7c <devfile_read+0x87>
+		assert(r <= n);
+  801e0e:	68 1d 51 80 00       	push   $0x80511d
+  801e13:	68 fd 50 80 00       	push   $0x8050fd
+  801e18:	68 99 00 00 00       	push   $0x99
+  801e1d:	68 12 51 80 00       	push   $0x805112
+  801e22:	e8 02 22 00 00       	call   804029 <_panic>
+		assert(r <= PGSIZE);
+  801e27:	68 24 51 80 00       	push   $0x805124
+  801e2c:	68 fd 50 80 00       	push   $0x8050fd
+  801e31:	68 9a 00 00 00       	push   $0x9a
+  801e36:	68 12 51 80 00       	push   $0x805112
+  801e3b:	e8 e9 21 00 00       	call   804029 <_panic>
+
+00801e40 <open>:
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	83 ec 1c             	sub    $0x1c,%esp
+  801e48:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e4b:	56                   	push   %esi
+  801e4c:	e8 7f ed ff ff       	call   800bd0 <strlen>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e59:	0f 8f 85 00 00 00    	jg     801ee4 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e5f:	83 ec 0c             	sub    $0xc,%esp
+  801e62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e65:	50                   	push   %eax
+  801e66:	e8 a7 f6 ff ff       	call   801512 <fd_alloc>
+  801e6b:	89 c3                	mov    %eax,%ebx
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 55                	js     801ec9 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801e74:	83 ec 0c             	sub    $0xc,%esp
+  801e77:	68 14 70 80 00       	push   $0x807014
+  801e7c:	e8 28 18 00 00       	call   8036a9 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e81:	83 c4 08             	add    $0x8,%esp
+  801e84:	56                   	push   %esi
+  801e85:	68 00 80 80 00       	push   $0x808000
+  801e8a:	e8 7c ed ff ff       	call   800c0b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e92:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801e97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e9f:	e8 7e fc ff ff       	call   801b22 <fsipc>
+  801ea4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ea6:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801ead:	e8 64 18 00 00       	call   803716 <mutex_unlock>
+	if (r < 0) {
+  801eb2:	83 c4 10             	add    $0x10,%esp
+  801eb5:	85 db                	test   %ebx,%ebx
+  801eb7:	78 19                	js     801ed2 <open+0x92>
+	return fd2num(fd);
+  801eb9:	83 ec 0c             	sub    $0xc,%esp
+  801ebc:	ff 75 f4             	push   -0xc(%ebp)
+  801ebf:	e8 27 f6 ff ff       	call   8014eb <fd2num>
+  801ec4:	89 c3                	mov    %eax,%ebx
+  801ec6:	83 c4 10             	add    $0x10,%esp
+}
+  801ec9:	89 d8                	mov    %ebx,%eax
+  801ecb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ece:	5b                   	pop    %ebx
+  801ecf:	5e                   	pop    %esi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+		fd_close(fd, 0);
+  801ed2:	83 ec 08             	sub    $0x8,%esp
+  801ed5:	6a 00                	push   $0x0
+  801ed7:	ff 75 f4             	push   -0xc(%ebp)
+  801eda:	e8 56 f7 ff ff       	call   801635 <fd_close>
+		return r;
+  801edf:	83 c4 10             	add    $0x10,%esp
+  801ee2:	eb e5                	jmp    801ec9 <open+0x89>
+		return -E_BAD_PATH;
+  801ee4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ee9:	eb de                	jmp    801ec9 <open+0x89>
+
+00801eeb <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	53                   	push   %ebx
+  801eef:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ef2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	ff 75 08             	push   0x8(%ebp)
+  801ef9:	e8 6a f6 ff ff       	call   801568 <fd_lookup>
+  801efe:	89 c3                	mov    %eax,%ebx
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 5b                	js     801f62 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f0a:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801f10:	39 08                	cmp    %ecx,(%eax)
+  801f12:	75 55                	jne    801f69 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801f14:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801f18:	74 56                	je     801f70 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801f1a:	83 ec 0c             	sub    $0xc,%esp
+  801f1d:	68 14 70 80 00       	push   $0x807014
+  801f22:	e8 82 17 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f2a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801f32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f35:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801f3a:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f3d:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801f42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f47:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f4c:	e8 d1 fb ff ff       	call   801b22 <fsipc>
+  801f51:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f53:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801f5a:	e8 b7 17 00 00       	call   803716 <mutex_unlock>
+	return r;
+  801f5f:	83 c4 10             	add    $0x10,%esp
+}
+  801f62:	89 d8                	mov    %ebx,%eax
+  801f64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f69:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f6e:	eb f2                	jmp    801f62 <fallocate+0x77>
+		return -E_INVAL;
+  801f70:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f75:	eb eb                	jmp    801f62 <fallocate+0x77>
+
+00801f77 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	56                   	push   %esi
+  801f7b:	53                   	push   %ebx
+  801f7c:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f7f:	89 f3                	mov    %esi,%ebx
+  801f81:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f87:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f8a:	eb 06                	jmp    801f92 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f8c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f92:	39 f3                	cmp    %esi,%ebx
+  801f94:	73 14                	jae    801faa <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  801f99:	53                   	push   %ebx
+  801f9a:	6a 00                	push   $0x0
+  801f9c:	e8 41 f1 ff ff       	call   8010e2 <sys_page_unmap>
+  801fa1:	83 c4 10             	add    $0x10,%esp
+  801fa4:	85 c0                	test   %eax,%eax
+  801fa6:	79 e4                	jns    801f8c <munmap+0x15>
+  801fa8:	eb 05                	jmp    801faf <munmap+0x38>
+			return r;
+	return 0;
+  801faa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801faf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb2:	5b                   	pop    %ebx
+  801fb3:	5e                   	pop    %esi
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+
+00801fb6 <mmap>:
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	57                   	push   %edi
+  801fba:	56                   	push   %esi
+  801fbb:	53                   	push   %ebx
+  801fbc:	83 ec 24             	sub    $0x24,%esp
+  801fbf:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fc2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	ff 75 08             	push   0x8(%ebp)
+  801fc9:	e8 9a f5 ff ff       	call   801568 <fd_lookup>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	0f 88 37 01 00 00    	js     802110 <mmap+0x15a>
+		return NULL;
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fde:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fe1:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801fe7:	39 0a                	cmp    %ecx,(%edx)
+  801fe9:	0f 85 05 01 00 00    	jne    8020f4 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801fef:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ff6:	0f 85 1b 01 00 00    	jne    802117 <mmap+0x161>
+  801ffc:	89 f0                	mov    %esi,%eax
+  801ffe:	83 e8 01             	sub    $0x1,%eax
+  802001:	0f 88 17 01 00 00    	js     80211e <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802007:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80200b:	75 28                	jne    802035 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	68 14 70 80 00       	push   $0x807014
+  802015:	e8 8f 16 00 00       	call   8036a9 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80201a:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802020:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80202e:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802033:	eb 2b                	jmp    802060 <mmap+0xaa>
+		cow_enable();
+  802035:	e8 3a 22 00 00       	call   804274 <cow_enable>
+  80203a:	eb d1                	jmp    80200d <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80203c:	89 c2                	mov    %eax,%edx
+  80203e:	c1 ea 0c             	shr    $0xc,%edx
+  802041:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802048:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80204e:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802054:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802057:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802059:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80205e:	77 25                	ja     802085 <mmap+0xcf>
+  802060:	89 c2                	mov    %eax,%edx
+  802062:	29 da                	sub    %ebx,%edx
+  802064:	39 ca                	cmp    %ecx,%edx
+  802066:	73 3a                	jae    8020a2 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802068:	89 c2                	mov    %eax,%edx
+  80206a:	c1 ea 16             	shr    $0x16,%edx
+  80206d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802074:	f6 c2 01             	test   $0x1,%dl
+  802077:	75 c3                	jne    80203c <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802079:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80207e:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802083:	eb d4                	jmp    802059 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802085:	29 d8                	sub    %ebx,%eax
+  802087:	39 c8                	cmp    %ecx,%eax
+  802089:	73 17                	jae    8020a2 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80208b:	83 ec 0c             	sub    $0xc,%esp
+  80208e:	68 14 70 80 00       	push   $0x807014
+  802093:	e8 7e 16 00 00       	call   803716 <mutex_unlock>
+		return NULL;
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a0:	eb 52                	jmp    8020f4 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8020a2:	85 db                	test   %ebx,%ebx
+  8020a4:	74 e5                	je     80208b <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8020a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020ac:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8020b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b4:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8020b9:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8020bf:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8020c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c8:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8020cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8020d7:	e8 46 fa ff ff       	call   801b22 <fsipc>
+  8020dc:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	68 14 70 80 00       	push   $0x807014
+  8020e6:	e8 2b 16 00 00       	call   803716 <mutex_unlock>
+	if (r < 0) {
+  8020eb:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8020ee:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8020f0:	85 ff                	test   %edi,%edi
+  8020f2:	78 08                	js     8020fc <mmap+0x146>
+}
+  8020f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f7:	5b                   	pop    %ebx
+  8020f8:	5e                   	pop    %esi
+  8020f9:	5f                   	pop    %edi
+  8020fa:	5d                   	pop    %ebp
+  8020fb:	c3                   	ret
+		munmap((void*) va, len);
+  8020fc:	83 ec 08             	sub    $0x8,%esp
+  8020ff:	56                   	push   %esi
+  802100:	53                   	push   %ebx
+  802101:	e8 71 fe ff ff       	call   801f77 <munmap>
+		return NULL;
+  802106:	83 c4 10             	add    $0x10,%esp
+  802109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210e:	eb e4                	jmp    8020f4 <mmap+0x13e>
+		return NULL;
+  802110:	b8 00 00 00 00       	mov    $0x0,%eax
+  802115:	eb dd                	jmp    8020f4 <mmap+0x13e>
+		return NULL;
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	eb d6                	jmp    8020f4 <mmap+0x13e>
+  80211e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802123:	eb cf                	jmp    8020f4 <mmap+0x13e>
+
+00802125 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	53                   	push   %ebx
+  802129:	83 ec 10             	sub    $0x10,%esp
+  80212c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80212f:	53                   	push   %ebx
+  802130:	e8 9b ea ff ff       	call   800bd0 <strlen>
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80213d:	7f 42                	jg     802181 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	68 14 70 80 00       	push   $0x807014
+  802147:	e8 5d 15 00 00       	call   8036a9 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80214c:	83 c4 08             	add    $0x8,%esp
+  80214f:	53                   	push   %ebx
+  802150:	68 00 80 80 00       	push   $0x808000
+  802155:	e8 b1 ea ff ff       	call   800c0b <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80215a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802164:	e8 b9 f9 ff ff       	call   801b22 <fsipc>
+  802169:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80216b:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  802172:	e8 9f 15 00 00       	call   803716 <mutex_unlock>
+	return r;
+  802177:	83 c4 10             	add    $0x10,%esp
+}
+  80217a:	89 d8                	mov    %ebx,%eax
+  80217c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+		return -E_BAD_PATH;
+  802181:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802186:	eb f2                	jmp    80217a <remove+0x55>
+
+00802188 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802188:	55                   	push   %ebp
+  802189:	89 e5                	mov    %esp,%ebp
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80218f:	68 14 70 80 00       	push   $0x807014
+  802194:	e8 10 15 00 00       	call   8036a9 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021a3:	e8 7a f9 ff ff       	call   801b22 <fsipc>
+  8021a8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021aa:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  8021b1:	e8 60 15 00 00       	call   803716 <mutex_unlock>
+	return r;
+}
+  8021b6:	89 d8                	mov    %ebx,%eax
+  8021b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+008021bd <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8021bd:	55                   	push   %ebp
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	56                   	push   %esi
+  8021c1:	53                   	push   %ebx
+  8021c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8021c5:	83 ec 0c             	sub    $0xc,%esp
+  8021c8:	68 14 70 80 00       	push   $0x807014
+  8021cd:	e8 d7 14 00 00       	call   8036a9 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021e4:	e8 39 f9 ff ff       	call   801b22 <fsipc>
+  8021e9:	89 c6                	mov    %eax,%esi
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	85 db                	test   %ebx,%ebx
+  8021f0:	74 7b                	je     80226d <fs_bcstat+0xb0>
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	78 77                	js     80226d <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8021f6:	a1 00 80 80 00       	mov    0x808000,%eax
+  8021fb:	89 03                	mov    %eax,(%ebx)
+  8021fd:	a1 04 80 80 00       	mov    0x808004,%eax
+  802202:	89 43 04             	mov    %eax,0x4(%ebx)
+  802205:	a1 08 80 80 00       	mov    0x808008,%eax
+  80220a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80220d:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802212:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802215:	a1 10 80 80 00       	mov    0x808010,%eax
+  80221a:	89 43 10             	mov    %eax,0x10(%ebx)
+  80221d:	a1 14 80 80 00       	mov    0x808014,%eax
+  802222:	89 43 14             	mov    %eax,0x14(%ebx)
+  802225:	a1 18 80 80 00       	mov    0x808018,%eax
+  80222a:	89 43 18             	mov    %eax,0x18(%ebx)
+  80222d:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802232:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802235:	a1 20 80 80 00       	mov    0x808020,%eax
+  80223a:	89 43 20             	mov    %eax,0x20(%ebx)
+  80223d:	a1 24 80 80 00       	mov    0x808024,%eax
+  802242:	89 43 24             	mov    %eax,0x24(%ebx)
+  802245:	a1 28 80 80 00       	mov    0x808028,%eax
+  80224a:	89 43 28             	mov    %eax,0x28(%ebx)
+  80224d:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802252:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802255:	a1 30 80 80 00       	mov    0x808030,%eax
+  80225a:	89 43 30             	mov    %eax,0x30(%ebx)
+  80225d:	a1 34 80 80 00       	mov    0x808034,%eax
+  802262:	89 43 34             	mov    %eax,0x34(%ebx)
+  802265:	a1 38 80 80 00       	mov    0x808038,%eax
+  80226a:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80226d:	83 ec 0c             	sub    $0xc,%esp
+  802270:	68 14 70 80 00       	push   $0x807014
+  802275:	e8 9c 14 00 00       	call   803716 <mutex_unlock>
+	return r;
+}
+  80227a:	89 f0                	mov    %esi,%eax
+  80227c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227f:	5b                   	pop    %ebx
+  802280:	5e                   	pop    %esi
+  802281:	5d                   	pop    %ebp
+  802282:	c3                   	ret
+
+00802283 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802283:	55                   	push   %ebp
+  802284:	89 e5                	mov    %esp,%ebp
+  802286:	56                   	push   %esi
+  802287:	53                   	push   %ebx
+  802288:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80228a:	0f b6 10             	movzbl (%eax),%edx
+  80228d:	80 fa 72             	cmp    $0x72,%dl
+  802290:	74 44                	je     8022d6 <parse_mode+0x53>
+  802292:	80 fa 77             	cmp    $0x77,%dl
+  802295:	74 4b                	je     8022e2 <parse_mode+0x5f>
+  802297:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80229c:	80 fa 61             	cmp    $0x61,%dl
+  80229f:	74 09                	je     8022aa <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8022a1:	89 d8                	mov    %ebx,%eax
+  8022a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a6:	5b                   	pop    %ebx
+  8022a7:	5e                   	pop    %esi
+  8022a8:	5d                   	pop    %ebp
+  8022a9:	c3                   	ret
+	switch (mode[0]) {
+  8022aa:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8022af:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8022b4:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8022b6:	83 ec 08             	sub    $0x8,%esp
+  8022b9:	6a 2b                	push   $0x2b
+  8022bb:	50                   	push   %eax
+  8022bc:	e8 5c ea ff ff       	call   800d1d <strchr>
+  8022c1:	83 c4 10             	add    $0x10,%esp
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	74 d9                	je     8022a1 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8022c8:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8022cb:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8022ce:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8022d4:	eb cb                	jmp    8022a1 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8022d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022e0:	eb d2                	jmp    8022b4 <parse_mode+0x31>
+  8022e2:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8022e7:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8022ec:	eb c6                	jmp    8022b4 <parse_mode+0x31>
+
+008022ee <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 1c             	sub    $0x1c,%esp
+  8022f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022fa:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022fd:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802302:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802307:	83 c0 24             	add    $0x24,%eax
+  80230a:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80230e:	74 17                	je     802327 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802310:	83 c3 01             	add    $0x1,%ebx
+  802313:	83 fb 10             	cmp    $0x10,%ebx
+  802316:	75 ef                	jne    802307 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802318:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80231d:	89 f0                	mov    %esi,%eax
+  80231f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802322:	5b                   	pop    %ebx
+  802323:	5e                   	pop    %esi
+  802324:	5f                   	pop    %edi
+  802325:	5d                   	pop    %ebp
+  802326:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802327:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80232e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802331:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802334:	c1 e7 02             	shl    $0x2,%edi
+  802337:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	6a 24                	push   $0x24
+  802342:	6a 00                	push   $0x0
+  802344:	56                   	push   %esi
+  802345:	e8 12 ea ff ff       	call   800d5c <memset>
+			streams[i].f_fd = fd;
+  80234a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80234d:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802353:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802356:	01 d8                	add    %ebx,%eax
+  802358:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80235b:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	eb b6                	jmp    80231d <stream_alloc+0x2f>
+
+00802367 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802367:	55                   	push   %ebp
+  802368:	89 e5                	mov    %esp,%ebp
+  80236a:	53                   	push   %ebx
+  80236b:	83 ec 14             	sub    $0x14,%esp
+  80236e:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802370:	8b 40 18             	mov    0x18(%eax),%eax
+  802373:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802376:	74 4a                	je     8023c2 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802378:	83 ec 08             	sub    $0x8,%esp
+  80237b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237e:	50                   	push   %eax
+  80237f:	ff 33                	push   (%ebx)
+  802381:	e8 e2 f1 ff ff       	call   801568 <fd_lookup>
+  802386:	89 c2                	mov    %eax,%edx
+  802388:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802390:	85 d2                	test   %edx,%edx
+  802392:	78 41                	js     8023d5 <stream_unread+0x6e>
+  802394:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802397:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80239d:	39 0a                	cmp    %ecx,(%edx)
+  80239f:	75 34                	jne    8023d5 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8023a1:	8b 43 14             	mov    0x14(%ebx),%eax
+  8023a4:	03 42 04             	add    0x4(%edx),%eax
+  8023a7:	2b 43 18             	sub    0x18(%ebx),%eax
+  8023aa:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8023ad:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8023b4:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8023bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c0:	eb 13                	jmp    8023d5 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8023c2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8023c9:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8023d0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023d8:	c9                   	leave
+  8023d9:	c3                   	ret
+
+008023da <stream_drain>:
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	56                   	push   %esi
+  8023de:	53                   	push   %ebx
+  8023df:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8023e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e6:	eb 02                	jmp    8023ea <stream_drain+0x10>
+  8023e8:	01 c3                	add    %eax,%ebx
+  8023ea:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023ed:	39 c3                	cmp    %eax,%ebx
+  8023ef:	73 43                	jae    802434 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8023f1:	83 ec 04             	sub    $0x4,%esp
+  8023f4:	29 d8                	sub    %ebx,%eax
+  8023f6:	50                   	push   %eax
+  8023f7:	89 d8                	mov    %ebx,%eax
+  8023f9:	03 46 0c             	add    0xc(%esi),%eax
+  8023fc:	50                   	push   %eax
+  8023fd:	ff 36                	push   (%esi)
+  8023ff:	e8 ec f4 ff ff       	call   8018f0 <write>
+  802404:	83 c4 10             	add    $0x10,%esp
+  802407:	85 c0                	test   %eax,%eax
+  802409:	7f dd                	jg     8023e8 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80240b:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80240f:	8b 56 0c             	mov    0xc(%esi),%edx
+  802412:	83 ec 04             	sub    $0x4,%esp
+  802415:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802418:	29 d8                	sub    %ebx,%eax
+  80241a:	50                   	push   %eax
+  80241b:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80241e:	50                   	push   %eax
+  80241f:	52                   	push   %edx
+  802420:	e8 6c e9 ff ff       	call   800d91 <memmove>
+			f->f_wend -= done;
+  802425:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802428:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802432:	eb 0a                	jmp    80243e <stream_drain+0x64>
+  802434:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802439:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80243e:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802441:	89 d0                	mov    %edx,%eax
+  802443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802446:	5b                   	pop    %ebx
+  802447:	5e                   	pop    %esi
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+
+0080244a <stream_setup>:
+	if (f->f_buf)
+  80244a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80244e:	74 01                	je     802451 <stream_setup+0x7>
+  802450:	c3                   	ret
+{
+  802451:	55                   	push   %ebp
+  802452:	89 e5                	mov    %esp,%ebp
+  802454:	53                   	push   %ebx
+  802455:	83 ec 04             	sub    $0x4,%esp
+  802458:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80245a:	8b 40 08             	mov    0x8(%eax),%eax
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	74 17                	je     802478 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802461:	83 f8 03             	cmp    $0x3,%eax
+  802464:	75 2d                	jne    802493 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802466:	8d 43 20             	lea    0x20(%ebx),%eax
+  802469:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80246c:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802473:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802478:	83 ec 0c             	sub    $0xc,%esp
+  80247b:	ff 33                	push   (%ebx)
+  80247d:	e8 29 1b 00 00       	call   803fab <iscons>
+  802482:	83 c4 10             	add    $0x10,%esp
+  802485:	85 c0                	test   %eax,%eax
+  802487:	0f 9f c0             	setg   %al
+  80248a:	0f b6 c0             	movzbl %al,%eax
+  80248d:	83 c0 01             	add    $0x1,%eax
+  802490:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802493:	83 ec 0c             	sub    $0xc,%esp
+  802496:	68 00 10 00 00       	push   $0x1000
+  80249b:	e8 6e 0b 00 00       	call   80300e <malloc>
+  8024a0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	74 bc                	je     802466 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8024aa:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8024b1:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8024b5:	eb bc                	jmp    802473 <stream_setup+0x29>
+
+008024b7 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	53                   	push   %ebx
+  8024bb:	83 ec 04             	sub    $0x4,%esp
+  8024be:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8024c0:	e8 85 ff ff ff       	call   80244a <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8024c5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8024ca:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8024ce:	74 3d                	je     80250d <stream_fill+0x56>
+  8024d0:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8024d4:	74 10                	je     8024e6 <stream_fill+0x2f>
+  8024d6:	89 d8                	mov    %ebx,%eax
+  8024d8:	e8 fd fe ff ff       	call   8023da <stream_drain>
+		return 0;
+  8024dd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	78 27                	js     80250d <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8024e6:	83 ec 04             	sub    $0x4,%esp
+  8024e9:	ff 73 10             	push   0x10(%ebx)
+  8024ec:	ff 73 0c             	push   0xc(%ebx)
+  8024ef:	ff 33                	push   (%ebx)
+  8024f1:	e8 02 f3 ff ff       	call   8017f8 <read>
+  8024f6:	83 c4 10             	add    $0x10,%esp
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	7e 17                	jle    802514 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8024fd:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802501:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802508:	89 c2                	mov    %eax,%edx
+  80250a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80250d:	89 d0                	mov    %edx,%eax
+  80250f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802512:	c9                   	leave
+  802513:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802514:	c1 f8 1f             	sar    $0x1f,%eax
+  802517:	83 e0 04             	and    $0x4,%eax
+  80251a:	83 c0 04             	add    $0x4,%eax
+  80251d:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802520:	ba 00 00 00 00       	mov    $0x0,%edx
+  802525:	eb e6                	jmp    80250d <stream_fill+0x56>
+
+00802527 <fopen>:
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	57                   	push   %edi
+  80252b:	56                   	push   %esi
+  80252c:	53                   	push   %ebx
+  80252d:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802533:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802536:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80253c:	89 f0                	mov    %esi,%eax
+  80253e:	e8 40 fd ff ff       	call   802283 <parse_mode>
+		return 0;
+  802543:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802548:	85 c0                	test   %eax,%eax
+  80254a:	78 2d                	js     802579 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80254c:	83 ec 08             	sub    $0x8,%esp
+  80254f:	50                   	push   %eax
+  802550:	ff 75 08             	push   0x8(%ebp)
+  802553:	e8 e8 f8 ff ff       	call   801e40 <open>
+  802558:	89 c7                	mov    %eax,%edi
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 58                	js     8025b9 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802561:	80 3e 61             	cmpb   $0x61,(%esi)
+  802564:	74 1d                	je     802583 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802566:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80256c:	89 f8                	mov    %edi,%eax
+  80256e:	e8 7b fd ff ff       	call   8022ee <stream_alloc>
+  802573:	89 c3                	mov    %eax,%ebx
+  802575:	85 c0                	test   %eax,%eax
+  802577:	74 32                	je     8025ab <fopen+0x84>
+}
+  802579:	89 d8                	mov    %ebx,%eax
+  80257b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80257e:	5b                   	pop    %ebx
+  80257f:	5e                   	pop    %esi
+  802580:	5f                   	pop    %edi
+  802581:	5d                   	pop    %ebp
+  802582:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802583:	83 ec 08             	sub    $0x8,%esp
+  802586:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80258c:	50                   	push   %eax
+  80258d:	57                   	push   %edi
+  80258e:	e8 db f4 ff ff       	call   801a6e <fstat>
+  802593:	83 c4 10             	add    $0x10,%esp
+  802596:	85 c0                	test   %eax,%eax
+  802598:	78 cc                	js     802566 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80259a:	83 ec 08             	sub    $0x8,%esp
+  80259d:	ff 75 dc             	push   -0x24(%ebp)
+  8025a0:	57                   	push   %edi
+  8025a1:	e8 f6 f3 ff ff       	call   80199c <seek>
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	eb bb                	jmp    802566 <fopen+0x3f>
+		close(fd);
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	57                   	push   %edi
+  8025af:	e8 08 f1 ff ff       	call   8016bc <close>
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	eb c0                	jmp    802579 <fopen+0x52>
+		return 0;
+  8025b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025be:	eb b9                	jmp    802579 <fopen+0x52>
+
+008025c0 <fdopen>:
+{
+  8025c0:	55                   	push   %ebp
+  8025c1:	89 e5                	mov    %esp,%ebp
+  8025c3:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8025c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025cc:	e8 b2 fc ff ff       	call   802283 <parse_mode>
+  8025d1:	89 c2                	mov    %eax,%edx
+		return 0;
+  8025d3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8025d8:	85 d2                	test   %edx,%edx
+  8025da:	78 0b                	js     8025e7 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8025dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e2:	e8 07 fd ff ff       	call   8022ee <stream_alloc>
+}
+  8025e7:	c9                   	leave
+  8025e8:	c3                   	ret
+
+008025e9 <setvbuf>:
+{
+  8025e9:	55                   	push   %ebp
+  8025ea:	89 e5                	mov    %esp,%ebp
+  8025ec:	57                   	push   %edi
+  8025ed:	56                   	push   %esi
+  8025ee:	53                   	push   %ebx
+  8025ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8025f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8025f8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8025fc:	75 3a                	jne    802638 <setvbuf+0x4f>
+  8025fe:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802601:	83 fe 02             	cmp    $0x2,%esi
+  802604:	77 39                	ja     80263f <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802606:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802609:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80260d:	0f 95 c3             	setne  %bl
+  802610:	85 ff                	test   %edi,%edi
+  802612:	0f 95 c1             	setne  %cl
+  802615:	84 cb                	test   %cl,%bl
+  802617:	74 05                	je     80261e <setvbuf+0x35>
+  802619:	83 fa 03             	cmp    $0x3,%edx
+  80261c:	75 0a                	jne    802628 <setvbuf+0x3f>
+	return 0;
+  80261e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802623:	5b                   	pop    %ebx
+  802624:	5e                   	pop    %esi
+  802625:	5f                   	pop    %edi
+  802626:	5d                   	pop    %ebp
+  802627:	c3                   	ret
+		f->f_buf = buf;
+  802628:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80262b:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80262e:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802631:	b8 00 00 00 00       	mov    $0x0,%eax
+  802636:	eb eb                	jmp    802623 <setvbuf+0x3a>
+		return EOF;
+  802638:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80263d:	eb e4                	jmp    802623 <setvbuf+0x3a>
+  80263f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802644:	eb dd                	jmp    802623 <setvbuf+0x3a>
+
+00802646 <fflush>:
+{
+  802646:	55                   	push   %ebp
+  802647:	89 e5                	mov    %esp,%ebp
+  802649:	57                   	push   %edi
+  80264a:	56                   	push   %esi
+  80264b:	53                   	push   %ebx
+  80264c:	83 ec 0c             	sub    $0xc,%esp
+  80264f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802652:	85 db                	test   %ebx,%ebx
+  802654:	74 1a                	je     802670 <fflush+0x2a>
+	stream_unread(f);
+  802656:	89 d8                	mov    %ebx,%eax
+  802658:	e8 0a fd ff ff       	call   802367 <stream_unread>
+	return stream_drain(f);
+  80265d:	89 d8                	mov    %ebx,%eax
+  80265f:	e8 76 fd ff ff       	call   8023da <stream_drain>
+  802664:	89 c7                	mov    %eax,%edi
+}
+  802666:	89 f8                	mov    %edi,%eax
+  802668:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266b:	5b                   	pop    %ebx
+  80266c:	5e                   	pop    %esi
+  80266d:	5f                   	pop    %edi
+  80266e:	5d                   	pop    %ebp
+  80266f:	c3                   	ret
+  802670:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802675:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80267a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267f:	eb 03                	jmp    802684 <fflush+0x3e>
+  802681:	83 c3 24             	add    $0x24,%ebx
+  802684:	39 f3                	cmp    %esi,%ebx
+  802686:	74 de                	je     802666 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802688:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80268c:	74 f3                	je     802681 <fflush+0x3b>
+  80268e:	83 ec 0c             	sub    $0xc,%esp
+  802691:	53                   	push   %ebx
+  802692:	e8 af ff ff ff       	call   802646 <fflush>
+  802697:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80269a:	85 c0                	test   %eax,%eax
+  80269c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026a1:	0f 48 f8             	cmovs  %eax,%edi
+  8026a4:	eb db                	jmp    802681 <fflush+0x3b>
+
+008026a6 <fclose>:
+{
+  8026a6:	55                   	push   %ebp
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	56                   	push   %esi
+  8026aa:	53                   	push   %ebx
+  8026ab:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8026ae:	83 ec 0c             	sub    $0xc,%esp
+  8026b1:	56                   	push   %esi
+  8026b2:	e8 8f ff ff ff       	call   802646 <fflush>
+  8026b7:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8026b9:	83 c4 04             	add    $0x4,%esp
+  8026bc:	ff 36                	push   (%esi)
+  8026be:	e8 f9 ef ff ff       	call   8016bc <close>
+  8026c3:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8026c6:	85 c0                	test   %eax,%eax
+  8026c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026cd:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8026d0:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8026d4:	75 10                	jne    8026e6 <fclose+0x40>
+	f->f_flags = 0;
+  8026d6:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8026dd:	89 d8                	mov    %ebx,%eax
+  8026df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+		free(f->f_buf);
+  8026e6:	83 ec 0c             	sub    $0xc,%esp
+  8026e9:	ff 76 0c             	push   0xc(%esi)
+  8026ec:	e8 54 08 00 00       	call   802f45 <free>
+  8026f1:	83 c4 10             	add    $0x10,%esp
+  8026f4:	eb e0                	jmp    8026d6 <fclose+0x30>
+
+008026f6 <fileno>:
+{
+  8026f6:	55                   	push   %ebp
+  8026f7:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8026f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026fc:	8b 00                	mov    (%eax),%eax
+}
+  8026fe:	5d                   	pop    %ebp
+  8026ff:	c3                   	ret
+
+00802700 <feof>:
+{
+  802700:	55                   	push   %ebp
+  802701:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802703:	8b 45 08             	mov    0x8(%ebp),%eax
+  802706:	8b 40 04             	mov    0x4(%eax),%eax
+  802709:	c1 e8 02             	shr    $0x2,%eax
+  80270c:	83 e0 01             	and    $0x1,%eax
+}
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+
+00802711 <ferror>:
+{
+  802711:	55                   	push   %ebp
+  802712:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802714:	8b 45 08             	mov    0x8(%ebp),%eax
+  802717:	8b 40 04             	mov    0x4(%eax),%eax
+  80271a:	c1 e8 03             	shr    $0x3,%eax
+  80271d:	83 e0 01             	and    $0x1,%eax
+}
+  802720:	5d                   	pop    %ebp
+  802721:	c3                   	ret
+
+00802722 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802722:	55                   	push   %ebp
+  802723:	89 e5                	mov    %esp,%ebp
+  802725:	53                   	push   %ebx
+  802726:	83 ec 04             	sub    $0x4,%esp
+  802729:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80272c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80272f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802732:	74 15                	je     802749 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802734:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802737:	8b 43 14             	mov    0x14(%ebx),%eax
+  80273a:	8d 48 01             	lea    0x1(%eax),%ecx
+  80273d:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802740:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802747:	c9                   	leave
+  802748:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802749:	89 d8                	mov    %ebx,%eax
+  80274b:	e8 67 fd ff ff       	call   8024b7 <stream_fill>
+  802750:	85 c0                	test   %eax,%eax
+  802752:	75 e0                	jne    802734 <fgetc+0x12>
+		return EOF;
+  802754:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802759:	eb e9                	jmp    802744 <fgetc+0x22>
+
+0080275b <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	57                   	push   %edi
+  80275f:	56                   	push   %esi
+  802760:	53                   	push   %ebx
+  802761:	83 ec 1c             	sub    $0x1c,%esp
+  802764:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802767:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80276c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80276f:	83 e8 01             	sub    $0x1,%eax
+  802772:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802775:	eb 66                	jmp    8027dd <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802777:	8b 46 14             	mov    0x14(%esi),%eax
+  80277a:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80277d:	29 c3                	sub    %eax,%ebx
+  80277f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802782:	29 fa                	sub    %edi,%edx
+  802784:	39 d3                	cmp    %edx,%ebx
+  802786:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802789:	83 ec 04             	sub    $0x4,%esp
+  80278c:	53                   	push   %ebx
+  80278d:	6a 0a                	push   $0xa
+  80278f:	03 46 0c             	add    0xc(%esi),%eax
+  802792:	50                   	push   %eax
+  802793:	e8 aa e6 ff ff       	call   800e42 <memfind>
+  802798:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80279b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80279e:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8027a1:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8027a4:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027ac:	74 0b                	je     8027b9 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8027ae:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8027b1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8027b4:	29 d3                	sub    %edx,%ebx
+  8027b6:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8027b9:	83 ec 04             	sub    $0x4,%esp
+  8027bc:	53                   	push   %ebx
+  8027bd:	01 c8                	add    %ecx,%eax
+  8027bf:	50                   	push   %eax
+  8027c0:	89 f8                	mov    %edi,%eax
+  8027c2:	03 45 08             	add    0x8(%ebp),%eax
+  8027c5:	50                   	push   %eax
+  8027c6:	e8 c6 e5 ff ff       	call   800d91 <memmove>
+		f->f_rpos += m;
+  8027cb:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8027ce:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8027d0:	83 c4 10             	add    $0x10,%esp
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8027db:	74 1f                	je     8027fc <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8027dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8027e0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8027e3:	73 17                	jae    8027fc <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8027e5:	8b 46 18             	mov    0x18(%esi),%eax
+  8027e8:	39 46 14             	cmp    %eax,0x14(%esi)
+  8027eb:	75 8a                	jne    802777 <fgets+0x1c>
+  8027ed:	89 f0                	mov    %esi,%eax
+  8027ef:	e8 c3 fc ff ff       	call   8024b7 <stream_fill>
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	0f 85 7b ff ff ff    	jne    802777 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8027fc:	85 ff                	test   %edi,%edi
+  8027fe:	74 0f                	je     80280f <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802800:	8b 45 08             	mov    0x8(%ebp),%eax
+  802803:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80280a:	5b                   	pop    %ebx
+  80280b:	5e                   	pop    %esi
+  80280c:	5f                   	pop    %edi
+  80280d:	5d                   	pop    %ebp
+  80280e:	c3                   	ret
+		return 0;
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	eb f1                	jmp    802807 <fgets+0xac>
+
+00802816 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	57                   	push   %edi
+  80281a:	56                   	push   %esi
+  80281b:	53                   	push   %ebx
+  80281c:	83 ec 1c             	sub    $0x1c,%esp
+  80281f:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802822:	89 f0                	mov    %esi,%eax
+  802824:	e8 21 fc ff ff       	call   80244a <stream_setup>
+	want = size * n;
+  802829:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80282c:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802830:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802833:	bf 00 00 00 00       	mov    $0x0,%edi
+  802838:	eb 43                	jmp    80287d <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80283a:	29 d3                	sub    %edx,%ebx
+  80283c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80283f:	29 f8                	sub    %edi,%eax
+  802841:	39 c3                	cmp    %eax,%ebx
+  802843:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802846:	83 ec 04             	sub    $0x4,%esp
+  802849:	53                   	push   %ebx
+  80284a:	03 56 0c             	add    0xc(%esi),%edx
+  80284d:	52                   	push   %edx
+  80284e:	89 f8                	mov    %edi,%eax
+  802850:	03 45 08             	add    0x8(%ebp),%eax
+  802853:	50                   	push   %eax
+  802854:	e8 38 e5 ff ff       	call   800d91 <memmove>
+			f->f_rpos += m;
+  802859:	01 5e 14             	add    %ebx,0x14(%esi)
+  80285c:	83 c4 10             	add    $0x10,%esp
+  80285f:	eb 1a                	jmp    80287b <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802861:	83 ec 04             	sub    $0x4,%esp
+  802864:	53                   	push   %ebx
+  802865:	89 f8                	mov    %edi,%eax
+  802867:	03 45 08             	add    0x8(%ebp),%eax
+  80286a:	50                   	push   %eax
+  80286b:	ff 36                	push   (%esi)
+  80286d:	e8 86 ef ff ff       	call   8017f8 <read>
+  802872:	89 c3                	mov    %eax,%ebx
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	7e 36                	jle    8028b1 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80287b:	01 df                	add    %ebx,%edi
+  80287d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802880:	39 c7                	cmp    %eax,%edi
+  802882:	73 39                	jae    8028bd <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802884:	8b 56 14             	mov    0x14(%esi),%edx
+  802887:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80288a:	39 da                	cmp    %ebx,%edx
+  80288c:	72 ac                	jb     80283a <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80288e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802891:	29 fb                	sub    %edi,%ebx
+  802893:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802896:	72 3e                	jb     8028d6 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802898:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80289c:	74 1f                	je     8028bd <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80289e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8028a2:	74 bd                	je     802861 <fread+0x4b>
+  8028a4:	89 f0                	mov    %esi,%eax
+  8028a6:	e8 2f fb ff ff       	call   8023da <stream_drain>
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	79 b2                	jns    802861 <fread+0x4b>
+  8028af:	eb 0c                	jmp    8028bd <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8028b1:	c1 fb 1f             	sar    $0x1f,%ebx
+  8028b4:	83 e3 04             	and    $0x4,%ebx
+  8028b7:	83 c3 04             	add    $0x4,%ebx
+  8028ba:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8028bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	74 0a                	je     8028ce <fread+0xb8>
+  8028c4:	89 f8                	mov    %edi,%eax
+  8028c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cb:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8028ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d1:	5b                   	pop    %ebx
+  8028d2:	5e                   	pop    %esi
+  8028d3:	5f                   	pop    %edi
+  8028d4:	5d                   	pop    %ebp
+  8028d5:	c3                   	ret
+		} else if (!stream_fill(f))
+  8028d6:	89 f0                	mov    %esi,%eax
+  8028d8:	e8 da fb ff ff       	call   8024b7 <stream_fill>
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	74 dc                	je     8028bd <fread+0xa7>
+			m = 0;
+  8028e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028e6:	eb 93                	jmp    80287b <fread+0x65>
+
+008028e8 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8028e8:	55                   	push   %ebp
+  8028e9:	89 e5                	mov    %esp,%ebp
+  8028eb:	57                   	push   %edi
+  8028ec:	56                   	push   %esi
+  8028ed:	53                   	push   %ebx
+  8028ee:	83 ec 1c             	sub    $0x1c,%esp
+  8028f1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8028f4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028f7:	a8 02                	test   $0x2,%al
+  8028f9:	75 13                	jne    80290e <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8028fb:	83 c8 08             	or     $0x8,%eax
+  8028fe:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802901:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802909:	5b                   	pop    %ebx
+  80290a:	5e                   	pop    %esi
+  80290b:	5f                   	pop    %edi
+  80290c:	5d                   	pop    %ebp
+  80290d:	c3                   	ret
+	stream_setup(f);
+  80290e:	89 d8                	mov    %ebx,%eax
+  802910:	e8 35 fb ff ff       	call   80244a <stream_setup>
+	want = size * n;
+  802915:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802918:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80291c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80291f:	89 d8                	mov    %ebx,%eax
+  802921:	e8 41 fa ff ff       	call   802367 <stream_unread>
+	for (done = 0; done < want; ) {
+  802926:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80292b:	84 c0                	test   %al,%al
+  80292d:	75 7b                	jne    8029aa <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80292f:	be 00 00 00 00       	mov    $0x0,%esi
+  802934:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802937:	39 fe                	cmp    %edi,%esi
+  802939:	73 24                	jae    80295f <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80293b:	83 ec 04             	sub    $0x4,%esp
+  80293e:	89 f8                	mov    %edi,%eax
+  802940:	29 f0                	sub    %esi,%eax
+  802942:	50                   	push   %eax
+  802943:	89 f0                	mov    %esi,%eax
+  802945:	03 45 08             	add    0x8(%ebp),%eax
+  802948:	50                   	push   %eax
+  802949:	ff 33                	push   (%ebx)
+  80294b:	e8 a0 ef ff ff       	call   8018f0 <write>
+  802950:	83 c4 10             	add    $0x10,%esp
+  802953:	85 c0                	test   %eax,%eax
+  802955:	7e 04                	jle    80295b <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802957:	01 c6                	add    %eax,%esi
+  802959:	eb dc                	jmp    802937 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80295b:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  80295f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802962:	85 c0                	test   %eax,%eax
+  802964:	74 a0                	je     802906 <fwrite+0x1e>
+  802966:	89 f0                	mov    %esi,%eax
+  802968:	ba 00 00 00 00       	mov    $0x0,%edx
+  80296d:	f7 75 0c             	divl   0xc(%ebp)
+  802970:	eb 94                	jmp    802906 <fwrite+0x1e>
+			done += r;
+  802972:	01 c7                	add    %eax,%edi
+			continue;
+  802974:	eb 34                	jmp    8029aa <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802976:	8b 73 10             	mov    0x10(%ebx),%esi
+  802979:	29 c6                	sub    %eax,%esi
+  80297b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80297e:	29 fa                	sub    %edi,%edx
+  802980:	39 d6                	cmp    %edx,%esi
+  802982:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802985:	83 ec 04             	sub    $0x4,%esp
+  802988:	56                   	push   %esi
+  802989:	89 fa                	mov    %edi,%edx
+  80298b:	03 55 08             	add    0x8(%ebp),%edx
+  80298e:	52                   	push   %edx
+  80298f:	03 43 0c             	add    0xc(%ebx),%eax
+  802992:	50                   	push   %eax
+  802993:	e8 f9 e3 ff ff       	call   800d91 <memmove>
+		f->f_wend += m;
+  802998:	89 f0                	mov    %esi,%eax
+  80299a:	03 43 1c             	add    0x1c(%ebx),%eax
+  80299d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8029a0:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8029a2:	83 c4 10             	add    $0x10,%esp
+  8029a5:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8029a8:	74 5b                	je     802a05 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8029aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ad:	39 c7                	cmp    %eax,%edi
+  8029af:	73 2d                	jae    8029de <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8029b1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	75 be                	jne    802976 <fwrite+0x8e>
+  8029b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029bb:	29 fa                	sub    %edi,%edx
+  8029bd:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8029c0:	72 b4                	jb     802976 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8029c2:	83 ec 04             	sub    $0x4,%esp
+  8029c5:	52                   	push   %edx
+  8029c6:	89 f8                	mov    %edi,%eax
+  8029c8:	03 45 08             	add    0x8(%ebp),%eax
+  8029cb:	50                   	push   %eax
+  8029cc:	ff 33                	push   (%ebx)
+  8029ce:	e8 1d ef ff ff       	call   8018f0 <write>
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	85 c0                	test   %eax,%eax
+  8029d8:	7f 98                	jg     802972 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8029da:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8029de:	8b 43 08             	mov    0x8(%ebx),%eax
+  8029e1:	83 f8 03             	cmp    $0x3,%eax
+  8029e4:	74 48                	je     802a2e <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8029e6:	83 f8 02             	cmp    $0x2,%eax
+  8029e9:	74 27                	je     802a12 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8029eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	0f 84 10 ff ff ff    	je     802906 <fwrite+0x1e>
+  8029f6:	89 f8                	mov    %edi,%eax
+  8029f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029fd:	f7 75 0c             	divl   0xc(%ebp)
+  802a00:	e9 01 ff ff ff       	jmp    802906 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802a05:	89 d8                	mov    %ebx,%eax
+  802a07:	e8 ce f9 ff ff       	call   8023da <stream_drain>
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	79 9a                	jns    8029aa <fwrite+0xc2>
+  802a10:	eb cc                	jmp    8029de <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802a12:	83 ec 04             	sub    $0x4,%esp
+  802a15:	57                   	push   %edi
+  802a16:	6a 0a                	push   $0xa
+  802a18:	ff 75 08             	push   0x8(%ebp)
+  802a1b:	e8 22 e4 ff ff       	call   800e42 <memfind>
+  802a20:	89 c2                	mov    %eax,%edx
+  802a22:	89 f8                	mov    %edi,%eax
+  802a24:	03 45 08             	add    0x8(%ebp),%eax
+  802a27:	83 c4 10             	add    $0x10,%esp
+  802a2a:	39 c2                	cmp    %eax,%edx
+  802a2c:	74 bd                	je     8029eb <fwrite+0x103>
+		stream_drain(f);
+  802a2e:	89 d8                	mov    %ebx,%eax
+  802a30:	e8 a5 f9 ff ff       	call   8023da <stream_drain>
+  802a35:	eb b4                	jmp    8029eb <fwrite+0x103>
+
+00802a37 <fputc>:
+{
+  802a37:	55                   	push   %ebp
+  802a38:	89 e5                	mov    %esp,%ebp
+  802a3a:	53                   	push   %ebx
+  802a3b:	83 ec 14             	sub    $0x14,%esp
+  802a3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802a41:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802a44:	ff 75 0c             	push   0xc(%ebp)
+  802a47:	6a 01                	push   $0x1
+  802a49:	6a 01                	push   $0x1
+  802a4b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a4e:	50                   	push   %eax
+  802a4f:	e8 94 fe ff ff       	call   8028e8 <fwrite>
+  802a54:	83 c4 10             	add    $0x10,%esp
+  802a57:	0f b6 db             	movzbl %bl,%ebx
+  802a5a:	83 f8 01             	cmp    $0x1,%eax
+  802a5d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a62:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a68:	c9                   	leave
+  802a69:	c3                   	ret
+
+00802a6a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802a6a:	55                   	push   %ebp
+  802a6b:	89 e5                	mov    %esp,%ebp
+  802a6d:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802a70:	ff 75 0c             	push   0xc(%ebp)
+  802a73:	ff 75 08             	push   0x8(%ebp)
+  802a76:	e8 bc ff ff ff       	call   802a37 <fputc>
+}
+  802a7b:	83 c4 10             	add    $0x10,%esp
+  802a7e:	c9                   	leave
+  802a7f:	c3                   	ret
+
+00802a80 <fputs>:
+{
+  802a80:	55                   	push   %ebp
+  802a81:	89 e5                	mov    %esp,%ebp
+  802a83:	56                   	push   %esi
+  802a84:	53                   	push   %ebx
+  802a85:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+  802a8b:	56                   	push   %esi
+  802a8c:	e8 3f e1 ff ff       	call   800bd0 <strlen>
+  802a91:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802a93:	ff 75 0c             	push   0xc(%ebp)
+  802a96:	50                   	push   %eax
+  802a97:	6a 01                	push   $0x1
+  802a99:	56                   	push   %esi
+  802a9a:	e8 49 fe ff ff       	call   8028e8 <fwrite>
+  802a9f:	83 c4 20             	add    $0x20,%esp
+  802aa2:	39 d8                	cmp    %ebx,%eax
+  802aa4:	0f 95 c0             	setne  %al
+  802aa7:	0f b6 c0             	movzbl %al,%eax
+  802aaa:	f7 d8                	neg    %eax
+}
+  802aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aaf:	5b                   	pop    %ebx
+  802ab0:	5e                   	pop    %esi
+  802ab1:	5d                   	pop    %ebp
+  802ab2:	c3                   	ret
+
+00802ab3 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	53                   	push   %ebx
+  802ab7:	83 ec 04             	sub    $0x4,%esp
+  802aba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802abd:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802ac0:	50                   	push   %eax
+  802ac1:	ff 75 0c             	push   0xc(%ebp)
+  802ac4:	53                   	push   %ebx
+  802ac5:	68 6a 2a 80 00       	push   $0x802a6a
+  802aca:	e8 4f dc ff ff       	call   80071e <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802acf:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ad2:	c1 e0 1c             	shl    $0x1c,%eax
+  802ad5:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802ad8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+00802add <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802ae3:	68 38 51 80 00       	push   $0x805138
+  802ae8:	ff 75 0c             	push   0xc(%ebp)
+  802aeb:	e8 1b e1 ff ff       	call   800c0b <strcpy>
+	return 0;
+}
+  802af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+00802af7 <devsock_close>:
+{
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	53                   	push   %ebx
+  802afb:	83 ec 10             	sub    $0x10,%esp
+  802afe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b01:	53                   	push   %ebx
+  802b02:	e8 69 1d 00 00       	call   804870 <pageref>
+  802b07:	89 c2                	mov    %eax,%edx
+  802b09:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b11:	83 fa 01             	cmp    $0x1,%edx
+  802b14:	74 05                	je     802b1b <devsock_close+0x24>
+}
+  802b16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b1b:	83 ec 0c             	sub    $0xc,%esp
+  802b1e:	ff 73 0c             	push   0xc(%ebx)
+  802b21:	e8 b7 02 00 00       	call   802ddd <nsipc_close>
+  802b26:	83 c4 10             	add    $0x10,%esp
+  802b29:	eb eb                	jmp    802b16 <devsock_close+0x1f>
+
+00802b2b <devsock_write>:
+{
+  802b2b:	55                   	push   %ebp
+  802b2c:	89 e5                	mov    %esp,%ebp
+  802b2e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b31:	6a 00                	push   $0x0
+  802b33:	ff 75 10             	push   0x10(%ebp)
+  802b36:	ff 75 0c             	push   0xc(%ebp)
+  802b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3c:	ff 70 0c             	push   0xc(%eax)
+  802b3f:	e8 79 03 00 00       	call   802ebd <nsipc_send>
+}
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+00802b46 <devsock_read>:
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b4c:	6a 00                	push   $0x0
+  802b4e:	ff 75 10             	push   0x10(%ebp)
+  802b51:	ff 75 0c             	push   0xc(%ebp)
+  802b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b57:	ff 70 0c             	push   0xc(%eax)
+  802b5a:	e8 ef 02 00 00       	call   802e4e <nsipc_recv>
+}
+  802b5f:	c9                   	leave
+  802b60:	c3                   	ret
+
+00802b61 <fd2sockid>:
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b67:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b6a:	52                   	push   %edx
+  802b6b:	50                   	push   %eax
+  802b6c:	e8 f7 e9 ff ff       	call   801568 <fd_lookup>
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 10                	js     802b88 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b7b:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802b81:	39 08                	cmp    %ecx,(%eax)
+  802b83:	75 05                	jne    802b8a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b85:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b8a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b8f:	eb f7                	jmp    802b88 <fd2sockid+0x27>
+
+00802b91 <alloc_sockfd>:
+{
+  802b91:	55                   	push   %ebp
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	56                   	push   %esi
+  802b95:	53                   	push   %ebx
+  802b96:	83 ec 1c             	sub    $0x1c,%esp
+  802b99:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b9b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b9e:	50                   	push   %eax
+  802b9f:	e8 6e e9 ff ff       	call   801512 <fd_alloc>
+  802ba4:	89 c3                	mov    %eax,%ebx
+  802ba6:	83 c4 10             	add    $0x10,%esp
+  802ba9:	85 c0                	test   %eax,%eax
+  802bab:	78 43                	js     802bf0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802bad:	83 ec 04             	sub    $0x4,%esp
+  802bb0:	68 07 04 00 00       	push   $0x407
+  802bb5:	ff 75 f4             	push   -0xc(%ebp)
+  802bb8:	6a 00                	push   $0x0
+  802bba:	e8 8a e4 ff ff       	call   801049 <sys_page_alloc>
+  802bbf:	89 c3                	mov    %eax,%ebx
+  802bc1:	83 c4 10             	add    $0x10,%esp
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	78 28                	js     802bf0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802bc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bcb:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802bd1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802bd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bd6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802bdd:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802be0:	83 ec 0c             	sub    $0xc,%esp
+  802be3:	50                   	push   %eax
+  802be4:	e8 02 e9 ff ff       	call   8014eb <fd2num>
+  802be9:	89 c3                	mov    %eax,%ebx
+  802beb:	83 c4 10             	add    $0x10,%esp
+  802bee:	eb 0c                	jmp    802bfc <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bf0:	83 ec 0c             	sub    $0xc,%esp
+  802bf3:	56                   	push   %esi
+  802bf4:	e8 e4 01 00 00       	call   802ddd <nsipc_close>
+		return r;
+  802bf9:	83 c4 10             	add    $0x10,%esp
+}
+  802bfc:	89 d8                	mov    %ebx,%eax
+  802bfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c01:	5b                   	pop    %ebx
+  802c02:	5e                   	pop    %esi
+  802c03:	5d                   	pop    %ebp
+  802c04:	c3                   	ret
+
+00802c05 <accept>:
+{
+  802c05:	55                   	push   %ebp
+  802c06:	89 e5                	mov    %esp,%ebp
+  802c08:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0e:	e8 4e ff ff ff       	call   802b61 <fd2sockid>
+  802c13:	85 c0                	test   %eax,%eax
+  802c15:	78 1b                	js     802c32 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c17:	83 ec 04             	sub    $0x4,%esp
+  802c1a:	ff 75 10             	push   0x10(%ebp)
+  802c1d:	ff 75 0c             	push   0xc(%ebp)
+  802c20:	50                   	push   %eax
+  802c21:	e8 0e 01 00 00       	call   802d34 <nsipc_accept>
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	85 c0                	test   %eax,%eax
+  802c2b:	78 05                	js     802c32 <accept+0x2d>
+	return alloc_sockfd(r);
+  802c2d:	e8 5f ff ff ff       	call   802b91 <alloc_sockfd>
+}
+  802c32:	c9                   	leave
+  802c33:	c3                   	ret
+
+00802c34 <bind>:
+{
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c3d:	e8 1f ff ff ff       	call   802b61 <fd2sockid>
+  802c42:	85 c0                	test   %eax,%eax
+  802c44:	78 12                	js     802c58 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c46:	83 ec 04             	sub    $0x4,%esp
+  802c49:	ff 75 10             	push   0x10(%ebp)
+  802c4c:	ff 75 0c             	push   0xc(%ebp)
+  802c4f:	50                   	push   %eax
+  802c50:	e8 31 01 00 00       	call   802d86 <nsipc_bind>
+  802c55:	83 c4 10             	add    $0x10,%esp
+}
+  802c58:	c9                   	leave
+  802c59:	c3                   	ret
+
+00802c5a <shutdown>:
+{
+  802c5a:	55                   	push   %ebp
+  802c5b:	89 e5                	mov    %esp,%ebp
+  802c5d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c63:	e8 f9 fe ff ff       	call   802b61 <fd2sockid>
+  802c68:	85 c0                	test   %eax,%eax
+  802c6a:	78 0f                	js     802c7b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c6c:	83 ec 08             	sub    $0x8,%esp
+  802c6f:	ff 75 0c             	push   0xc(%ebp)
+  802c72:	50                   	push   %eax
+  802c73:	e8 43 01 00 00       	call   802dbb <nsipc_shutdown>
+  802c78:	83 c4 10             	add    $0x10,%esp
+}
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+
+00802c7d <connect>:
+{
+  802c7d:	55                   	push   %ebp
+  802c7e:	89 e5                	mov    %esp,%ebp
+  802c80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c86:	e8 d6 fe ff ff       	call   802b61 <fd2sockid>
+  802c8b:	85 c0                	test   %eax,%eax
+  802c8d:	78 12                	js     802ca1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c8f:	83 ec 04             	sub    $0x4,%esp
+  802c92:	ff 75 10             	push   0x10(%ebp)
+  802c95:	ff 75 0c             	push   0xc(%ebp)
+  802c98:	50                   	push   %eax
+  802c99:	e8 59 01 00 00       	call   802df7 <nsipc_connect>
+  802c9e:	83 c4 10             	add    $0x10,%esp
+}
+  802ca1:	c9                   	leave
+  802ca2:	c3                   	ret
+
+00802ca3 <listen>:
+{
+  802ca3:	55                   	push   %ebp
+  802ca4:	89 e5                	mov    %esp,%ebp
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	e8 b0 fe ff ff       	call   802b61 <fd2sockid>
+  802cb1:	85 c0                	test   %eax,%eax
+  802cb3:	78 0f                	js     802cc4 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802cb5:	83 ec 08             	sub    $0x8,%esp
+  802cb8:	ff 75 0c             	push   0xc(%ebp)
+  802cbb:	50                   	push   %eax
+  802cbc:	e8 6b 01 00 00       	call   802e2c <nsipc_listen>
+  802cc1:	83 c4 10             	add    $0x10,%esp
+}
+  802cc4:	c9                   	leave
+  802cc5:	c3                   	ret
+
+00802cc6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802cc6:	55                   	push   %ebp
+  802cc7:	89 e5                	mov    %esp,%ebp
+  802cc9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802ccc:	ff 75 10             	push   0x10(%ebp)
+  802ccf:	ff 75 0c             	push   0xc(%ebp)
+  802cd2:	ff 75 08             	push   0x8(%ebp)
+  802cd5:	e8 41 02 00 00       	call   802f1b <nsipc_socket>
+  802cda:	83 c4 10             	add    $0x10,%esp
+  802cdd:	85 c0                	test   %eax,%eax
+  802cdf:	78 05                	js     802ce6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802ce1:	e8 ab fe ff ff       	call   802b91 <alloc_sockfd>
+}
+  802ce6:	c9                   	leave
+  802ce7:	c3                   	ret
+
+00802ce8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	53                   	push   %ebx
+  802cec:	83 ec 04             	sub    $0x4,%esp
+  802cef:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cf1:	83 3d 18 70 80 00 00 	cmpl   $0x0,0x807018
+  802cf8:	74 26                	je     802d20 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cfa:	6a 07                	push   $0x7
+  802cfc:	68 00 90 80 00       	push   $0x809000
+  802d01:	53                   	push   %ebx
+  802d02:	ff 35 18 70 80 00    	push   0x807018
+  802d08:	e8 ce 1a 00 00       	call   8047db <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d0d:	83 c4 0c             	add    $0xc,%esp
+  802d10:	6a 00                	push   $0x0
+  802d12:	6a 00                	push   $0x0
+  802d14:	6a 00                	push   $0x0
+  802d16:	e8 ca 19 00 00       	call   8046e5 <ipc_recv>
+}
+  802d1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1e:	c9                   	leave
+  802d1f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d20:	83 ec 0c             	sub    $0xc,%esp
+  802d23:	6a 02                	push   $0x2
+  802d25:	e8 07 1b 00 00       	call   804831 <ipc_find_env>
+  802d2a:	a3 18 70 80 00       	mov    %eax,0x807018
+  802d2f:	83 c4 10             	add    $0x10,%esp
+  802d32:	eb c6                	jmp    802cfa <nsipc+0x12>
+
+00802d34 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d34:	55                   	push   %ebp
+  802d35:	89 e5                	mov    %esp,%ebp
+  802d37:	56                   	push   %esi
+  802d38:	53                   	push   %ebx
+  802d39:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d44:	8b 06                	mov    (%esi),%eax
+  802d46:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d50:	e8 93 ff ff ff       	call   802ce8 <nsipc>
+  802d55:	89 c3                	mov    %eax,%ebx
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	79 09                	jns    802d64 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d5b:	89 d8                	mov    %ebx,%eax
+  802d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d60:	5b                   	pop    %ebx
+  802d61:	5e                   	pop    %esi
+  802d62:	5d                   	pop    %ebp
+  802d63:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	ff 35 10 90 80 00    	push   0x809010
+  802d6d:	68 00 90 80 00       	push   $0x809000
+  802d72:	ff 75 0c             	push   0xc(%ebp)
+  802d75:	e8 17 e0 ff ff       	call   800d91 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d7a:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d7f:	89 06                	mov    %eax,(%esi)
+  802d81:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d84:	eb d5                	jmp    802d5b <nsipc_accept+0x27>
+
+00802d86 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d86:	55                   	push   %ebp
+  802d87:	89 e5                	mov    %esp,%ebp
+  802d89:	53                   	push   %ebx
+  802d8a:	83 ec 08             	sub    $0x8,%esp
+  802d8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d93:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d98:	53                   	push   %ebx
+  802d99:	ff 75 0c             	push   0xc(%ebp)
+  802d9c:	68 04 90 80 00       	push   $0x809004
+  802da1:	e8 eb df ff ff       	call   800d91 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802da6:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802dac:	b8 02 00 00 00       	mov    $0x2,%eax
+  802db1:	e8 32 ff ff ff       	call   802ce8 <nsipc>
+}
+  802db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802db9:	c9                   	leave
+  802dba:	c3                   	ret
+
+00802dbb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802dbb:	55                   	push   %ebp
+  802dbc:	89 e5                	mov    %esp,%ebp
+  802dbe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802dc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dcc:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802dd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  802dd6:	e8 0d ff ff ff       	call   802ce8 <nsipc>
+}
+  802ddb:	c9                   	leave
+  802ddc:	c3                   	ret
+
+00802ddd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ddd:	55                   	push   %ebp
+  802dde:	89 e5                	mov    %esp,%ebp
+  802de0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802de3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de6:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802deb:	b8 04 00 00 00       	mov    $0x4,%eax
+  802df0:	e8 f3 fe ff ff       	call   802ce8 <nsipc>
+}
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+
+00802df7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	53                   	push   %ebx
+  802dfb:	83 ec 08             	sub    $0x8,%esp
+  802dfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e04:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e09:	53                   	push   %ebx
+  802e0a:	ff 75 0c             	push   0xc(%ebp)
+  802e0d:	68 04 90 80 00       	push   $0x809004
+  802e12:	e8 7a df ff ff       	call   800d91 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e17:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802e1d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e22:	e8 c1 fe ff ff       	call   802ce8 <nsipc>
+}
+  802e27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e2a:	c9                   	leave
+  802e2b:	c3                   	ret
+
+00802e2c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e2c:	55                   	push   %ebp
+  802e2d:	89 e5                	mov    %esp,%ebp
+  802e2f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e35:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e3d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802e42:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e47:	e8 9c fe ff ff       	call   802ce8 <nsipc>
+}
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+
+00802e4e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e4e:	55                   	push   %ebp
+  802e4f:	89 e5                	mov    %esp,%ebp
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e59:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e5e:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802e64:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e67:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e71:	e8 72 fe ff ff       	call   802ce8 <nsipc>
+  802e76:	89 c3                	mov    %eax,%ebx
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	78 22                	js     802e9e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e7c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e81:	39 c6                	cmp    %eax,%esi
+  802e83:	0f 4e c6             	cmovle %esi,%eax
+  802e86:	39 c3                	cmp    %eax,%ebx
+  802e88:	7f 1d                	jg     802ea7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e8a:	83 ec 04             	sub    $0x4,%esp
+  802e8d:	53                   	push   %ebx
+  802e8e:	68 00 90 80 00       	push   $0x809000
+  802e93:	ff 75 0c             	push   0xc(%ebp)
+  802e96:	e8 f6 de ff ff       	call   800d91 <memmove>
+  802e9b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e9e:	89 d8                	mov    %ebx,%eax
+  802ea0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea3:	5b                   	pop    %ebx
+  802ea4:	5e                   	pop    %esi
+  802ea5:	5d                   	pop    %ebp
+  802ea6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ea7:	68 44 51 80 00       	push   $0x805144
+  802eac:	68 fd 50 80 00       	push   $0x8050fd
+  802eb1:	6a 62                	push   $0x62
+  802eb3:	68 59 51 80 00       	push   $0x805159
+  802eb8:	e8 6c 11 00 00       	call   804029 <_panic>
+
+00802ebd <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ebd:	55                   	push   %ebp
+  802ebe:	89 e5                	mov    %esp,%ebp
+  802ec0:	53                   	push   %ebx
+  802ec1:	83 ec 04             	sub    $0x4,%esp
+  802ec4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eca:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802ecf:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ed5:	7f 2e                	jg     802f05 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ed7:	83 ec 04             	sub    $0x4,%esp
+  802eda:	53                   	push   %ebx
+  802edb:	ff 75 0c             	push   0xc(%ebp)
+  802ede:	68 0c 90 80 00       	push   $0x80900c
+  802ee3:	e8 a9 de ff ff       	call   800d91 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ee8:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802eee:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef1:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802ef6:	b8 08 00 00 00       	mov    $0x8,%eax
+  802efb:	e8 e8 fd ff ff       	call   802ce8 <nsipc>
+}
+  802f00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f03:	c9                   	leave
+  802f04:	c3                   	ret
+	assert(size < 1600);
+  802f05:	68 65 51 80 00       	push   $0x805165
+  802f0a:	68 fd 50 80 00       	push   $0x8050fd
+  802f0f:	6a 6d                	push   $0x6d
+  802f11:	68 59 51 80 00       	push   $0x805159
+  802f16:	e8 0e 11 00 00       	call   804029 <_panic>
+
+00802f1b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f1b:	55                   	push   %ebp
+  802f1c:	89 e5                	mov    %esp,%ebp
+  802f1e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f24:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802f29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f2c:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f31:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f34:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802f39:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f3e:	e8 a5 fd ff ff       	call   802ce8 <nsipc>
+}
+  802f43:	c9                   	leave
+  802f44:	c3                   	ret
+
+00802f45 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802f45:	55                   	push   %ebp
+  802f46:	89 e5                	mov    %esp,%ebp
+  802f48:	53                   	push   %ebx
+  802f49:	83 ec 10             	sub    $0x10,%esp
+  802f4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802f4f:	68 1c 70 80 00       	push   $0x80701c
+  802f54:	e8 50 07 00 00       	call   8036a9 <mutex_lock>
+	if (v == 0)
+  802f59:	83 c4 10             	add    $0x10,%esp
+  802f5c:	85 db                	test   %ebx,%ebx
+  802f5e:	0f 84 85 00 00 00    	je     802fe9 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802f64:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f6a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f6f:	77 51                	ja     802fc2 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802f71:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802f77:	89 d8                	mov    %ebx,%eax
+  802f79:	c1 e8 0c             	shr    $0xc,%eax
+  802f7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f83:	f6 c4 02             	test   $0x2,%ah
+  802f86:	74 50                	je     802fd8 <free+0x93>
+		sys_page_unmap(0, c);
+  802f88:	83 ec 08             	sub    $0x8,%esp
+  802f8b:	53                   	push   %ebx
+  802f8c:	6a 00                	push   $0x0
+  802f8e:	e8 4f e1 ff ff       	call   8010e2 <sys_page_unmap>
+		c += PGSIZE;
+  802f93:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802f99:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f9f:	83 c4 10             	add    $0x10,%esp
+  802fa2:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802fa7:	76 ce                	jbe    802f77 <free+0x32>
+  802fa9:	68 af 51 80 00       	push   $0x8051af
+  802fae:	68 fd 50 80 00       	push   $0x8050fd
+  802fb3:	68 82 00 00 00       	push   $0x82
+  802fb8:	68 a2 51 80 00       	push   $0x8051a2
+  802fbd:	e8 67 10 00 00       	call   804029 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802fc2:	68 74 51 80 00       	push   $0x805174
+  802fc7:	68 fd 50 80 00       	push   $0x8050fd
+  802fcc:	6a 7b                	push   $0x7b
+  802fce:	68 a2 51 80 00       	push   $0x8051a2
+  802fd3:	e8 51 10 00 00       	call   804029 <_panic>
+	if (--(*ref) == 0)
+  802fd8:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802fde:	83 e8 01             	sub    $0x1,%eax
+  802fe1:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802fe7:	74 15                	je     802ffe <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802fe9:	83 ec 0c             	sub    $0xc,%esp
+  802fec:	68 1c 70 80 00       	push   $0x80701c
+  802ff1:	e8 20 07 00 00       	call   803716 <mutex_unlock>
+}
+  802ff6:	83 c4 10             	add    $0x10,%esp
+  802ff9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffc:	c9                   	leave
+  802ffd:	c3                   	ret
+		sys_page_unmap(0, c);
+  802ffe:	83 ec 08             	sub    $0x8,%esp
+  803001:	53                   	push   %ebx
+  803002:	6a 00                	push   $0x0
+  803004:	e8 d9 e0 ff ff       	call   8010e2 <sys_page_unmap>
+  803009:	83 c4 10             	add    $0x10,%esp
+  80300c:	eb db                	jmp    802fe9 <free+0xa4>
+
+0080300e <malloc>:
+{
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	57                   	push   %edi
+  803012:	56                   	push   %esi
+  803013:	53                   	push   %ebx
+  803014:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803017:	68 1c 70 80 00       	push   $0x80701c
+  80301c:	e8 88 06 00 00       	call   8036a9 <mutex_lock>
+	if (mptr == 0)
+  803021:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+  803027:	83 c4 10             	add    $0x10,%esp
+  80302a:	85 ff                	test   %edi,%edi
+  80302c:	74 6c                	je     80309a <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80302e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803031:	83 c0 03             	add    $0x3,%eax
+  803034:	83 e0 fc             	and    $0xfffffffc,%eax
+  803037:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803039:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80303e:	0f 87 64 01 00 00    	ja     8031a8 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803044:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80304a:	74 30                	je     80307c <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80304c:	89 f9                	mov    %edi,%ecx
+  80304e:	c1 e9 0c             	shr    $0xc,%ecx
+  803051:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803055:	c1 e8 0c             	shr    $0xc,%eax
+  803058:	39 c1                	cmp    %eax,%ecx
+  80305a:	74 5f                	je     8030bb <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  80305c:	83 ec 0c             	sub    $0xc,%esp
+  80305f:	57                   	push   %edi
+  803060:	e8 e0 fe ff ff       	call   802f45 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803065:	a1 20 70 80 00       	mov    0x807020,%eax
+  80306a:	05 00 10 00 00       	add    $0x1000,%eax
+  80306f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803074:	a3 20 70 80 00       	mov    %eax,0x807020
+  803079:	83 c4 10             	add    $0x10,%esp
+  80307c:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+{
+  803082:	ba 02 00 00 00       	mov    $0x2,%edx
+  803087:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80308b:	8d 7e 04             	lea    0x4(%esi),%edi
+  80308e:	89 cb                	mov    %ecx,%ebx
+  803090:	01 f9                	add    %edi,%ecx
+  803092:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803095:	e9 8b 00 00 00       	jmp    803125 <malloc+0x117>
+		mptr = mbegin;
+  80309a:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  8030a1:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8030a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a7:	83 c0 03             	add    $0x3,%eax
+  8030aa:	83 e0 fc             	and    $0xfffffffc,%eax
+  8030ad:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8030af:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8030b4:	76 c6                	jbe    80307c <malloc+0x6e>
+  8030b6:	e9 d6 00 00 00       	jmp    803191 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8030bb:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8030c1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8030c6:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8030ca:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8030cd:	a3 20 70 80 00       	mov    %eax,0x807020
+			return v;
+  8030d2:	e9 ba 00 00 00       	jmp    803191 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8030d7:	05 00 10 00 00       	add    $0x1000,%eax
+  8030dc:	39 c8                	cmp    %ecx,%eax
+  8030de:	0f 83 cb 00 00 00    	jae    8031af <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8030e4:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8030e9:	77 22                	ja     80310d <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8030eb:	89 c2                	mov    %eax,%edx
+  8030ed:	c1 ea 16             	shr    $0x16,%edx
+  8030f0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8030f7:	f6 c2 01             	test   $0x1,%dl
+  8030fa:	74 db                	je     8030d7 <malloc+0xc9>
+  8030fc:	89 c2                	mov    %eax,%edx
+  8030fe:	c1 ea 0c             	shr    $0xc,%edx
+  803101:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803108:	f6 c2 01             	test   $0x1,%dl
+  80310b:	74 ca                	je     8030d7 <malloc+0xc9>
+		if (mptr == mend) {
+  80310d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803113:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803119:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80311d:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803123:	74 04                	je     803129 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803125:	89 d8                	mov    %ebx,%eax
+  803127:	eb b3                	jmp    8030dc <malloc+0xce>
+  803129:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80312c:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803131:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803135:	83 ea 01             	sub    $0x1,%edx
+  803138:	0f 85 50 ff ff ff    	jne    80308e <malloc+0x80>
+  80313e:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  803145:	00 00 08 
+				return 0;	/* out of address space */
+  803148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80314d:	eb 42                	jmp    803191 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80314f:	85 db                	test   %ebx,%ebx
+  803151:	78 1e                	js     803171 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803153:	83 ec 08             	sub    $0x8,%esp
+  803156:	89 d8                	mov    %ebx,%eax
+  803158:	03 05 20 70 80 00    	add    0x807020,%eax
+  80315e:	50                   	push   %eax
+  80315f:	6a 00                	push   $0x0
+  803161:	e8 7c df ff ff       	call   8010e2 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803166:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80316c:	83 c4 10             	add    $0x10,%esp
+  80316f:	eb de                	jmp    80314f <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803171:	bf 00 00 00 00       	mov    $0x0,%edi
+  803176:	eb 19                	jmp    803191 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803178:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80317b:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803181:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803188:	00 
+	mptr += n;
+  803189:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80318c:	a3 20 70 80 00       	mov    %eax,0x807020
+	mutex_unlock(&malloc_mu);
+  803191:	83 ec 0c             	sub    $0xc,%esp
+  803194:	68 1c 70 80 00       	push   $0x80701c
+  803199:	e8 78 05 00 00       	call   803716 <mutex_unlock>
+}
+  80319e:	89 f8                	mov    %edi,%eax
+  8031a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a3:	5b                   	pop    %ebx
+  8031a4:	5e                   	pop    %esi
+  8031a5:	5f                   	pop    %edi
+  8031a6:	5d                   	pop    %ebp
+  8031a7:	c3                   	ret
+		return 0;
+  8031a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ad:	eb e2                	jmp    803191 <malloc+0x183>
+  8031af:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8031b3:	74 06                	je     8031bb <malloc+0x1ad>
+  8031b5:	89 1d 20 70 80 00    	mov    %ebx,0x807020
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8031bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031c0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8031c3:	39 fb                	cmp    %edi,%ebx
+  8031c5:	73 b1                	jae    803178 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8031c7:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8031cd:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8031d0:	39 fe                	cmp    %edi,%esi
+  8031d2:	0f 92 c0             	setb   %al
+  8031d5:	0f b6 c0             	movzbl %al,%eax
+  8031d8:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8031db:	83 c8 07             	or     $0x7,%eax
+  8031de:	50                   	push   %eax
+  8031df:	89 d8                	mov    %ebx,%eax
+  8031e1:	03 05 20 70 80 00    	add    0x807020,%eax
+  8031e7:	50                   	push   %eax
+  8031e8:	6a 00                	push   $0x0
+  8031ea:	e8 5a de ff ff       	call   801049 <sys_page_alloc>
+  8031ef:	83 c4 10             	add    $0x10,%esp
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	0f 88 55 ff ff ff    	js     80314f <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8031fa:	89 f3                	mov    %esi,%ebx
+  8031fc:	eb c5                	jmp    8031c3 <malloc+0x1b5>
+
+008031fe <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8031fe:	55                   	push   %ebp
+  8031ff:	89 e5                	mov    %esp,%ebp
+  803201:	56                   	push   %esi
+  803202:	53                   	push   %ebx
+  803203:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803206:	83 ec 0c             	sub    $0xc,%esp
+  803209:	ff 75 08             	push   0x8(%ebp)
+  80320c:	e8 ea e2 ff ff       	call   8014fb <fd2data>
+  803211:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803213:	83 c4 08             	add    $0x8,%esp
+  803216:	68 c7 51 80 00       	push   $0x8051c7
+  80321b:	53                   	push   %ebx
+  80321c:	e8 ea d9 ff ff       	call   800c0b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803221:	8b 46 04             	mov    0x4(%esi),%eax
+  803224:	2b 06                	sub    (%esi),%eax
+  803226:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80322c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803233:	00 00 00 
+	stat->st_dev = &devpipe;
+  803236:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  80323d:	62 80 00 
+	return 0;
+}
+  803240:	b8 00 00 00 00       	mov    $0x0,%eax
+  803245:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803248:	5b                   	pop    %ebx
+  803249:	5e                   	pop    %esi
+  80324a:	5d                   	pop    %ebp
+  80324b:	c3                   	ret
+
+0080324c <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80324c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803251:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803255:	85 c9                	test   %ecx,%ecx
+  803257:	75 01                	jne    80325a <pipewake+0xe>
+  803259:	c3                   	ret
+{
+  80325a:	55                   	push   %ebp
+  80325b:	89 e5                	mov    %esp,%ebp
+  80325d:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803260:	68 00 04 00 00       	push   $0x400
+  803265:	52                   	push   %edx
+  803266:	e8 22 e1 ff ff       	call   80138d <sys_futex_wake>
+  80326b:	83 c4 10             	add    $0x10,%esp
+}
+  80326e:	c9                   	leave
+  80326f:	c3                   	ret
+
+00803270 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803270:	55                   	push   %ebp
+  803271:	89 e5                	mov    %esp,%ebp
+  803273:	56                   	push   %esi
+  803274:	53                   	push   %ebx
+  803275:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803278:	83 ec 0c             	sub    $0xc,%esp
+  80327b:	56                   	push   %esi
+  80327c:	e8 7a e2 ff ff       	call   8014fb <fd2data>
+  803281:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803283:	83 c4 08             	add    $0x8,%esp
+  803286:	56                   	push   %esi
+  803287:	6a 00                	push   $0x0
+  803289:	e8 54 de ff ff       	call   8010e2 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80328e:	8d 53 04             	lea    0x4(%ebx),%edx
+  803291:	8d 43 08             	lea    0x8(%ebx),%eax
+  803294:	e8 b3 ff ff ff       	call   80324c <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803299:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80329c:	89 da                	mov    %ebx,%edx
+  80329e:	e8 a9 ff ff ff       	call   80324c <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8032a3:	89 34 24             	mov    %esi,(%esp)
+  8032a6:	e8 50 e2 ff ff       	call   8014fb <fd2data>
+  8032ab:	83 c4 08             	add    $0x8,%esp
+  8032ae:	50                   	push   %eax
+  8032af:	6a 00                	push   $0x0
+  8032b1:	e8 2c de ff ff       	call   8010e2 <sys_page_unmap>
+}
+  8032b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b9:	5b                   	pop    %ebx
+  8032ba:	5e                   	pop    %esi
+  8032bb:	5d                   	pop    %ebp
+  8032bc:	c3                   	ret
+
+008032bd <_pipeisclosed>:
+{
+  8032bd:	55                   	push   %ebp
+  8032be:	89 e5                	mov    %esp,%ebp
+  8032c0:	57                   	push   %edi
+  8032c1:	56                   	push   %esi
+  8032c2:	53                   	push   %ebx
+  8032c3:	83 ec 1c             	sub    $0x1c,%esp
+  8032c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032c9:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032cb:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8032d0:	eb 5d                	jmp    80332f <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8032d2:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		n = thisenv->env_runs;
+  8032d8:	8b 02                	mov    (%edx),%eax
+  8032da:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8032dd:	83 ec 0c             	sub    $0xc,%esp
+  8032e0:	ff 75 e0             	push   -0x20(%ebp)
+  8032e3:	e8 88 15 00 00       	call   804870 <pageref>
+  8032e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032eb:	89 3c 24             	mov    %edi,(%esp)
+  8032ee:	e8 7d 15 00 00       	call   804870 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8032f3:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032f5:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8032fb:	83 c4 10             	add    $0x10,%esp
+  8032fe:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803304:	77 15                	ja     80331b <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803306:	89 f2                	mov    %esi,%edx
+  803308:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80330a:	c1 ea 10             	shr    $0x10,%edx
+  80330d:	74 0c                	je     80331b <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80330f:	c1 e2 10             	shl    $0x10,%edx
+  803312:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803317:	29 d1                	sub    %edx,%ecx
+  803319:	eb 06                	jmp    803321 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80331b:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		nn = thisenv->env_runs;
+  803321:	8b 11                	mov    (%ecx),%edx
+  803323:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803326:	39 d3                	cmp    %edx,%ebx
+  803328:	74 6e                	je     803398 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80332a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80332d:	74 24                	je     803353 <_pipeisclosed+0x96>
+  80332f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803331:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803337:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80333c:	77 94                	ja     8032d2 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80333e:	89 f0                	mov    %esi,%eax
+  803340:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803342:	c1 e8 10             	shr    $0x10,%eax
+  803345:	74 8b                	je     8032d2 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803347:	c1 e0 10             	shl    $0x10,%eax
+  80334a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80334f:	29 c2                	sub    %eax,%edx
+  803351:	eb 85                	jmp    8032d8 <_pipeisclosed+0x1b>
+  803353:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803355:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80335b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803360:	77 18                	ja     80337a <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803362:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803367:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803369:	c1 e8 10             	shr    $0x10,%eax
+  80336c:	74 0c                	je     80337a <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80336e:	c1 e0 10             	shl    $0x10,%eax
+  803371:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803376:	29 c2                	sub    %eax,%edx
+  803378:	eb 06                	jmp    803380 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80337a:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803380:	8b 02                	mov    (%edx),%eax
+  803382:	8b 40 58             	mov    0x58(%eax),%eax
+  803385:	6a 01                	push   $0x1
+  803387:	50                   	push   %eax
+  803388:	53                   	push   %ebx
+  803389:	68 ce 51 80 00       	push   $0x8051ce
+  80338e:	e8 94 d2 ff ff       	call   800627 <cprintf>
+  803393:	83 c4 10             	add    $0x10,%esp
+  803396:	eb 97                	jmp    80332f <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803398:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80339b:	0f 94 c0             	sete   %al
+  80339e:	0f b6 c0             	movzbl %al,%eax
+}
+  8033a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a4:	5b                   	pop    %ebx
+  8033a5:	5e                   	pop    %esi
+  8033a6:	5f                   	pop    %edi
+  8033a7:	5d                   	pop    %ebp
+  8033a8:	c3                   	ret
+
+008033a9 <devpipe_write>:
+{
+  8033a9:	55                   	push   %ebp
+  8033aa:	89 e5                	mov    %esp,%ebp
+  8033ac:	57                   	push   %edi
+  8033ad:	56                   	push   %esi
+  8033ae:	53                   	push   %ebx
+  8033af:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8033b2:	ff 75 08             	push   0x8(%ebp)
+  8033b5:	e8 41 e1 ff ff       	call   8014fb <fd2data>
+  8033ba:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033bc:	83 c4 10             	add    $0x10,%esp
+  8033bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8033c6:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8033c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033cc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8033cf:	0f 84 96 00 00 00    	je     80346b <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8033d5:	8d 73 08             	lea    0x8(%ebx),%esi
+  8033d8:	eb 32                	jmp    80340c <devpipe_write+0x63>
+  8033da:	89 fa                	mov    %edi,%edx
+  8033dc:	89 f0                	mov    %esi,%eax
+  8033de:	e8 69 fe ff ff       	call   80324c <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8033e3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033e6:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8033e9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033ee:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8033f3:	83 ec 04             	sub    $0x4,%esp
+  8033f6:	6a 0a                	push   $0xa
+  8033f8:	50                   	push   %eax
+  8033f9:	53                   	push   %ebx
+  8033fa:	e8 5f df ff ff       	call   80135e <sys_futex_wait>
+  8033ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803404:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803409:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80340c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80340f:	8b 0b                	mov    (%ebx),%ecx
+  803411:	8d 51 20             	lea    0x20(%ecx),%edx
+  803414:	39 d0                	cmp    %edx,%eax
+  803416:	72 1b                	jb     803433 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803418:	89 da                	mov    %ebx,%edx
+  80341a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341d:	e8 9b fe ff ff       	call   8032bd <_pipeisclosed>
+  803422:	85 c0                	test   %eax,%eax
+  803424:	74 b4                	je     8033da <devpipe_write+0x31>
+				return 0;
+  803426:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80342b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342e:	5b                   	pop    %ebx
+  80342f:	5e                   	pop    %esi
+  803430:	5f                   	pop    %edi
+  803431:	5d                   	pop    %ebp
+  803432:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803433:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803436:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803439:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80343d:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803440:	89 c2                	mov    %eax,%edx
+  803442:	c1 fa 1f             	sar    $0x1f,%edx
+  803445:	89 d1                	mov    %edx,%ecx
+  803447:	c1 e9 1b             	shr    $0x1b,%ecx
+  80344a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80344d:	83 e2 1f             	and    $0x1f,%edx
+  803450:	29 ca                	sub    %ecx,%edx
+  803452:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803456:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80345a:	83 c0 01             	add    $0x1,%eax
+  80345d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803460:	83 c6 01             	add    $0x1,%esi
+  803463:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803466:	e9 5e ff ff ff       	jmp    8033c9 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80346b:	8d 53 04             	lea    0x4(%ebx),%edx
+  80346e:	8d 43 08             	lea    0x8(%ebx),%eax
+  803471:	e8 d6 fd ff ff       	call   80324c <pipewake>
+	return i;
+  803476:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803479:	eb b0                	jmp    80342b <devpipe_write+0x82>
+
+0080347b <devpipe_read>:
+{
+  80347b:	55                   	push   %ebp
+  80347c:	89 e5                	mov    %esp,%ebp
+  80347e:	57                   	push   %edi
+  80347f:	56                   	push   %esi
+  803480:	53                   	push   %ebx
+  803481:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803484:	ff 75 08             	push   0x8(%ebp)
+  803487:	e8 6f e0 ff ff       	call   8014fb <fd2data>
+  80348c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	be 00 00 00 00       	mov    $0x0,%esi
+  803496:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803499:	74 6c                	je     803507 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80349b:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80349e:	eb 25                	jmp    8034c5 <devpipe_read+0x4a>
+  8034a0:	8b 13                	mov    (%ebx),%edx
+  8034a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034a7:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8034ac:	83 ec 04             	sub    $0x4,%esp
+  8034af:	6a 0a                	push   $0xa
+  8034b1:	52                   	push   %edx
+  8034b2:	57                   	push   %edi
+  8034b3:	e8 a6 de ff ff       	call   80135e <sys_futex_wait>
+  8034b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8034bd:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8034c2:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8034c5:	8b 03                	mov    (%ebx),%eax
+  8034c7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8034ca:	75 19                	jne    8034e5 <devpipe_read+0x6a>
+			if (i > 0)
+  8034cc:	85 f6                	test   %esi,%esi
+  8034ce:	75 3a                	jne    80350a <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8034d0:	89 da                	mov    %ebx,%edx
+  8034d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d5:	e8 e3 fd ff ff       	call   8032bd <_pipeisclosed>
+  8034da:	85 c0                	test   %eax,%eax
+  8034dc:	74 c2                	je     8034a0 <devpipe_read+0x25>
+				return 0;
+  8034de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e3:	eb 31                	jmp    803516 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8034e5:	89 c1                	mov    %eax,%ecx
+  8034e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8034ea:	c1 e9 1b             	shr    $0x1b,%ecx
+  8034ed:	01 c8                	add    %ecx,%eax
+  8034ef:	83 e0 1f             	and    $0x1f,%eax
+  8034f2:	29 c8                	sub    %ecx,%eax
+  8034f4:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8034f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034fc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8034ff:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803502:	83 c6 01             	add    $0x1,%esi
+  803505:	eb 8f                	jmp    803496 <devpipe_read+0x1b>
+out:
+  803507:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80350a:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80350d:	89 da                	mov    %ebx,%edx
+  80350f:	e8 38 fd ff ff       	call   80324c <pipewake>
+	return i;
+  803514:	89 f0                	mov    %esi,%eax
+}
+  803516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803519:	5b                   	pop    %ebx
+  80351a:	5e                   	pop    %esi
+  80351b:	5f                   	pop    %edi
+  80351c:	5d                   	pop    %ebp
+  80351d:	c3                   	ret
+
+0080351e <pipe>:
+{
+  80351e:	55                   	push   %ebp
+  80351f:	89 e5                	mov    %esp,%ebp
+  803521:	56                   	push   %esi
+  803522:	53                   	push   %ebx
+  803523:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803526:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803529:	50                   	push   %eax
+  80352a:	e8 e3 df ff ff       	call   801512 <fd_alloc>
+  80352f:	89 c3                	mov    %eax,%ebx
+  803531:	83 c4 10             	add    $0x10,%esp
+  803534:	85 c0                	test   %eax,%eax
+  803536:	0f 88 23 01 00 00    	js     80365f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80353c:	83 ec 04             	sub    $0x4,%esp
+  80353f:	68 07 04 00 00       	push   $0x407
+  803544:	ff 75 f4             	push   -0xc(%ebp)
+  803547:	6a 00                	push   $0x0
+  803549:	e8 fb da ff ff       	call   801049 <sys_page_alloc>
+  80354e:	89 c3                	mov    %eax,%ebx
+  803550:	83 c4 10             	add    $0x10,%esp
+  803553:	85 c0                	test   %eax,%eax
+  803555:	0f 88 04 01 00 00    	js     80365f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80355b:	83 ec 0c             	sub    $0xc,%esp
+  80355e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803561:	50                   	push   %eax
+  803562:	e8 ab df ff ff       	call   801512 <fd_alloc>
+  803567:	89 c3                	mov    %eax,%ebx
+  803569:	83 c4 10             	add    $0x10,%esp
+  80356c:	85 c0                	test   %eax,%eax
+  80356e:	0f 88 db 00 00 00    	js     80364f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803574:	83 ec 04             	sub    $0x4,%esp
+  803577:	68 07 04 00 00       	push   $0x407
+  80357c:	ff 75 f0             	push   -0x10(%ebp)
+  80357f:	6a 00                	push   $0x0
+  803581:	e8 c3 da ff ff       	call   801049 <sys_page_alloc>
+  803586:	89 c3                	mov    %eax,%ebx
+  803588:	83 c4 10             	add    $0x10,%esp
+  80358b:	85 c0                	test   %eax,%eax
+  80358d:	0f 88 bc 00 00 00    	js     80364f <pipe+0x131>
+	va = fd2data(fd0);
+  803593:	83 ec 0c             	sub    $0xc,%esp
+  803596:	ff 75 f4             	push   -0xc(%ebp)
+  803599:	e8 5d df ff ff       	call   8014fb <fd2data>
+  80359e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035a0:	83 c4 0c             	add    $0xc,%esp
+  8035a3:	68 07 04 00 00       	push   $0x407
+  8035a8:	50                   	push   %eax
+  8035a9:	6a 00                	push   $0x0
+  8035ab:	e8 99 da ff ff       	call   801049 <sys_page_alloc>
+  8035b0:	89 c3                	mov    %eax,%ebx
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	85 c0                	test   %eax,%eax
+  8035b7:	0f 88 82 00 00 00    	js     80363f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035bd:	83 ec 0c             	sub    $0xc,%esp
+  8035c0:	ff 75 f0             	push   -0x10(%ebp)
+  8035c3:	e8 33 df ff ff       	call   8014fb <fd2data>
+  8035c8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035cf:	50                   	push   %eax
+  8035d0:	6a 00                	push   $0x0
+  8035d2:	56                   	push   %esi
+  8035d3:	6a 00                	push   $0x0
+  8035d5:	e8 bc da ff ff       	call   801096 <sys_page_map>
+  8035da:	89 c3                	mov    %eax,%ebx
+  8035dc:	83 c4 20             	add    $0x20,%esp
+  8035df:	85 c0                	test   %eax,%eax
+  8035e1:	78 4e                	js     803631 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8035e3:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  8035e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035eb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8035ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8035f7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8035fa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8035fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035ff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803606:	83 ec 0c             	sub    $0xc,%esp
+  803609:	ff 75 f4             	push   -0xc(%ebp)
+  80360c:	e8 da de ff ff       	call   8014eb <fd2num>
+  803611:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803614:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803616:	83 c4 04             	add    $0x4,%esp
+  803619:	ff 75 f0             	push   -0x10(%ebp)
+  80361c:	e8 ca de ff ff       	call   8014eb <fd2num>
+  803621:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803624:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803627:	83 c4 10             	add    $0x10,%esp
+  80362a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80362f:	eb 2e                	jmp    80365f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803631:	83 ec 08             	sub    $0x8,%esp
+  803634:	56                   	push   %esi
+  803635:	6a 00                	push   $0x0
+  803637:	e8 a6 da ff ff       	call   8010e2 <sys_page_unmap>
+  80363c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80363f:	83 ec 08             	sub    $0x8,%esp
+  803642:	ff 75 f0             	push   -0x10(%ebp)
+  803645:	6a 00                	push   $0x0
+  803647:	e8 96 da ff ff       	call   8010e2 <sys_page_unmap>
+  80364c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80364f:	83 ec 08             	sub    $0x8,%esp
+  803652:	ff 75 f4             	push   -0xc(%ebp)
+  803655:	6a 00                	push   $0x0
+  803657:	e8 86 da ff ff       	call   8010e2 <sys_page_unmap>
+  80365c:	83 c4 10             	add    $0x10,%esp
+}
+  80365f:	89 d8                	mov    %ebx,%eax
+  803661:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803664:	5b                   	pop    %ebx
+  803665:	5e                   	pop    %esi
+  803666:	5d                   	pop    %ebp
+  803667:	c3                   	ret
+
+00803668 <pipeisclosed>:
+{
+  803668:	55                   	push   %ebp
+  803669:	89 e5                	mov    %esp,%ebp
+  80366b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80366e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803671:	50                   	push   %eax
+  803672:	ff 75 08             	push   0x8(%ebp)
+  803675:	e8 ee de ff ff       	call   801568 <fd_lookup>
+  80367a:	83 c4 10             	add    $0x10,%esp
+  80367d:	85 c0                	test   %eax,%eax
+  80367f:	78 18                	js     803699 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803681:	83 ec 0c             	sub    $0xc,%esp
+  803684:	ff 75 f4             	push   -0xc(%ebp)
+  803687:	e8 6f de ff ff       	call   8014fb <fd2data>
+  80368c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80368e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803691:	e8 27 fc ff ff       	call   8032bd <_pipeisclosed>
+  803696:	83 c4 10             	add    $0x10,%esp
+}
+  803699:	c9                   	leave
+  80369a:	c3                   	ret
+
+0080369b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80369b:	55                   	push   %ebp
+  80369c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80369e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8036a7:	5d                   	pop    %ebp
+  8036a8:	c3                   	ret
+
+008036a9 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8036a9:	55                   	push   %ebp
+  8036aa:	89 e5                	mov    %esp,%ebp
+  8036ac:	56                   	push   %esi
+  8036ad:	53                   	push   %ebx
+  8036ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8036b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036b6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8036bb:	89 d0                	mov    %edx,%eax
+  8036bd:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8036c1:	85 c0                	test   %eax,%eax
+  8036c3:	74 2d                	je     8036f2 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8036c5:	83 f8 02             	cmp    $0x2,%eax
+  8036c8:	74 08                	je     8036d2 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8036ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8036cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  8036d2:	be 02 00 00 00       	mov    $0x2,%esi
+  8036d7:	eb 15                	jmp    8036ee <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8036d9:	83 ec 04             	sub    $0x4,%esp
+  8036dc:	6a 00                	push   $0x0
+  8036de:	6a 02                	push   $0x2
+  8036e0:	53                   	push   %ebx
+  8036e1:	e8 78 dc ff ff       	call   80135e <sys_futex_wait>
+  8036e6:	89 f0                	mov    %esi,%eax
+  8036e8:	f0 87 03             	lock xchg %eax,(%ebx)
+  8036eb:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	75 e7                	jne    8036d9 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8036f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f5:	5b                   	pop    %ebx
+  8036f6:	5e                   	pop    %esi
+  8036f7:	5d                   	pop    %ebp
+  8036f8:	c3                   	ret
+
+008036f9 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8036f9:	55                   	push   %ebp
+  8036fa:	89 e5                	mov    %esp,%ebp
+  8036fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8036ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803704:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803709:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80370d:	f7 d8                	neg    %eax
+  80370f:	19 c0                	sbb    %eax,%eax
+  803711:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803714:	5d                   	pop    %ebp
+  803715:	c3                   	ret
+
+00803716 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803716:	55                   	push   %ebp
+  803717:	89 e5                	mov    %esp,%ebp
+  803719:	83 ec 08             	sub    $0x8,%esp
+  80371c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80371f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803724:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803727:	83 f8 02             	cmp    $0x2,%eax
+  80372a:	74 02                	je     80372e <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80372c:	c9                   	leave
+  80372d:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80372e:	83 ec 08             	sub    $0x8,%esp
+  803731:	6a 01                	push   $0x1
+  803733:	52                   	push   %edx
+  803734:	e8 54 dc ff ff       	call   80138d <sys_futex_wake>
+  803739:	83 c4 10             	add    $0x10,%esp
+}
+  80373c:	eb ee                	jmp    80372c <mutex_unlock+0x16>
+
+0080373e <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80373e:	55                   	push   %ebp
+  80373f:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803741:	8b 45 08             	mov    0x8(%ebp),%eax
+  803744:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80374a:	5d                   	pop    %ebp
+  80374b:	c3                   	ret
+
+0080374c <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80374c:	55                   	push   %ebp
+  80374d:	89 e5                	mov    %esp,%ebp
+  80374f:	57                   	push   %edi
+  803750:	56                   	push   %esi
+  803751:	53                   	push   %ebx
+  803752:	83 ec 18             	sub    $0x18,%esp
+  803755:	8b 75 08             	mov    0x8(%ebp),%esi
+  803758:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80375b:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80375d:	53                   	push   %ebx
+  80375e:	e8 b3 ff ff ff       	call   803716 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803763:	83 c4 0c             	add    $0xc,%esp
+  803766:	ff 75 10             	push   0x10(%ebp)
+  803769:	57                   	push   %edi
+  80376a:	56                   	push   %esi
+  80376b:	e8 ee db ff ff       	call   80135e <sys_futex_wait>
+  803770:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803772:	83 c4 10             	add    $0x10,%esp
+  803775:	be 02 00 00 00       	mov    $0x2,%esi
+  80377a:	eb 10                	jmp    80378c <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80377c:	83 ec 04             	sub    $0x4,%esp
+  80377f:	6a 00                	push   $0x0
+  803781:	6a 02                	push   $0x2
+  803783:	53                   	push   %ebx
+  803784:	e8 d5 db ff ff       	call   80135e <sys_futex_wait>
+  803789:	83 c4 10             	add    $0x10,%esp
+  80378c:	89 f0                	mov    %esi,%eax
+  80378e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803791:	85 c0                	test   %eax,%eax
+  803793:	75 e7                	jne    80377c <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803795:	83 ff ec             	cmp    $0xffffffec,%edi
+  803798:	74 05                	je     80379f <cond_timedwait+0x53>
+  80379a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80379f:	89 f8                	mov    %edi,%eax
+  8037a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037a4:	5b                   	pop    %ebx
+  8037a5:	5e                   	pop    %esi
+  8037a6:	5f                   	pop    %edi
+  8037a7:	5d                   	pop    %ebp
+  8037a8:	c3                   	ret
+
+008037a9 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8037a9:	55                   	push   %ebp
+  8037aa:	89 e5                	mov    %esp,%ebp
+  8037ac:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8037af:	6a 00                	push   $0x0
+  8037b1:	ff 75 0c             	push   0xc(%ebp)
+  8037b4:	ff 75 08             	push   0x8(%ebp)
+  8037b7:	e8 90 ff ff ff       	call   80374c <cond_timedwait>
+}
+  8037bc:	83 c4 10             	add    $0x10,%esp
+  8037bf:	c9                   	leave
+  8037c0:	c3                   	ret
+
+008037c1 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8037c1:	55                   	push   %ebp
+  8037c2:	89 e5                	mov    %esp,%ebp
+  8037c4:	83 ec 10             	sub    $0x10,%esp
+  8037c7:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8037ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037cf:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8037d3:	6a 01                	push   $0x1
+  8037d5:	50                   	push   %eax
+  8037d6:	e8 b2 db ff ff       	call   80138d <sys_futex_wake>
+}
+  8037db:	83 c4 10             	add    $0x10,%esp
+  8037de:	c9                   	leave
+  8037df:	c3                   	ret
+
+008037e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8037e0:	55                   	push   %ebp
+  8037e1:	89 e5                	mov    %esp,%ebp
+  8037e3:	83 ec 10             	sub    $0x10,%esp
+  8037e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037e9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037ee:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8037f2:	68 00 04 00 00       	push   $0x400
+  8037f7:	50                   	push   %eax
+  8037f8:	e8 90 db ff ff       	call   80138d <sys_futex_wake>
+}
+  8037fd:	83 c4 10             	add    $0x10,%esp
+  803800:	c9                   	leave
+  803801:	c3                   	ret
+
+00803802 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803802:	55                   	push   %ebp
+  803803:	89 e5                	mov    %esp,%ebp
+  803805:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803808:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80380b:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80380d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803814:	5d                   	pop    %ebp
+  803815:	c3                   	ret
+
+00803816 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803816:	55                   	push   %ebp
+  803817:	89 e5                	mov    %esp,%ebp
+  803819:	53                   	push   %ebx
+  80381a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80381d:	8b 11                	mov    (%ecx),%edx
+  80381f:	85 d2                	test   %edx,%edx
+  803821:	74 14                	je     803837 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803823:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803826:	89 d0                	mov    %edx,%eax
+  803828:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80382c:	39 c2                	cmp    %eax,%edx
+  80382e:	75 ed                	jne    80381d <sem_trywait+0x7>
+			return 0;
+  803830:	b8 00 00 00 00       	mov    $0x0,%eax
+  803835:	eb 05                	jmp    80383c <sem_trywait+0x26>
+	return -E_AGAIN;
+  803837:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80383c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80383f:	c9                   	leave
+  803840:	c3                   	ret
+
+00803841 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803841:	55                   	push   %ebp
+  803842:	89 e5                	mov    %esp,%ebp
+  803844:	57                   	push   %edi
+  803845:	56                   	push   %esi
+  803846:	53                   	push   %ebx
+  803847:	83 ec 1c             	sub    $0x1c,%esp
+  80384a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80384d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803850:	e8 81 da ff ff       	call   8012d6 <sys_time_msec>
+  803855:	01 f8                	add    %edi,%eax
+  803857:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80385a:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  80385f:	eb 28                	jmp    803889 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803861:	b8 01 00 00 00       	mov    $0x1,%eax
+  803866:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80386b:	83 ec 04             	sub    $0x4,%esp
+  80386e:	56                   	push   %esi
+  80386f:	6a 00                	push   $0x0
+  803871:	53                   	push   %ebx
+  803872:	e8 e7 da ff ff       	call   80135e <sys_futex_wait>
+  803877:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80387c:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803881:	83 c4 10             	add    $0x10,%esp
+  803884:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803887:	74 2e                	je     8038b7 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803889:	83 ec 0c             	sub    $0xc,%esp
+  80388c:	53                   	push   %ebx
+  80388d:	e8 84 ff ff ff       	call   803816 <sem_trywait>
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	85 c0                	test   %eax,%eax
+  803897:	79 19                	jns    8038b2 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803899:	85 ff                	test   %edi,%edi
+  80389b:	74 c4                	je     803861 <sem_timedwait+0x20>
+  80389d:	e8 34 da ff ff       	call   8012d6 <sys_time_msec>
+  8038a2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8038a5:	29 c6                	sub    %eax,%esi
+  8038a7:	85 f6                	test   %esi,%esi
+  8038a9:	7f b6                	jg     803861 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8038ab:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8038b0:	eb 05                	jmp    8038b7 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8038b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038ba:	5b                   	pop    %ebx
+  8038bb:	5e                   	pop    %esi
+  8038bc:	5f                   	pop    %edi
+  8038bd:	5d                   	pop    %ebp
+  8038be:	c3                   	ret
+
+008038bf <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8038bf:	55                   	push   %ebp
+  8038c0:	89 e5                	mov    %esp,%ebp
+  8038c2:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8038c5:	6a 00                	push   $0x0
+  8038c7:	ff 75 08             	push   0x8(%ebp)
+  8038ca:	e8 72 ff ff ff       	call   803841 <sem_timedwait>
+}
+  8038cf:	83 c4 10             	add    $0x10,%esp
+  8038d2:	c9                   	leave
+  8038d3:	c3                   	ret
+
+008038d4 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8038d4:	55                   	push   %ebp
+  8038d5:	89 e5                	mov    %esp,%ebp
+  8038d7:	83 ec 08             	sub    $0x8,%esp
+  8038da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038dd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038e2:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8038e6:	8b 50 04             	mov    0x4(%eax),%edx
+  8038e9:	85 d2                	test   %edx,%edx
+  8038eb:	75 02                	jne    8038ef <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8038ed:	c9                   	leave
+  8038ee:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8038ef:	83 ec 08             	sub    $0x8,%esp
+  8038f2:	6a 01                	push   $0x1
+  8038f4:	50                   	push   %eax
+  8038f5:	e8 93 da ff ff       	call   80138d <sys_futex_wake>
+  8038fa:	83 c4 10             	add    $0x10,%esp
+}
+  8038fd:	eb ee                	jmp    8038ed <sem_post+0x19>
+
+008038ff <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8038ff:	55                   	push   %ebp
+  803900:	89 e5                	mov    %esp,%ebp
+  803902:	57                   	push   %edi
+  803903:	56                   	push   %esi
+  803904:	53                   	push   %ebx
+  803905:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803908:	68 40 70 80 00       	push   $0x807040
+  80390d:	e8 97 fd ff ff       	call   8036a9 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803912:	a1 64 70 80 00       	mov    0x807064,%eax
+  803917:	83 c4 10             	add    $0x10,%esp
+  80391a:	85 c0                	test   %eax,%eax
+  80391c:	75 19                	jne    803937 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80391e:	a1 e0 72 80 00       	mov    0x8072e0,%eax
+  803923:	8b 00                	mov    (%eax),%eax
+  803925:	8b 40 48             	mov    0x48(%eax),%eax
+  803928:	a3 60 70 80 00       	mov    %eax,0x807060
+		threads[0].th_state = PTH_RUNNING;
+  80392d:	c7 05 64 70 80 00 01 	movl   $0x1,0x807064
+  803934:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803937:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80393c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80393f:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803946:	8b 40 04             	mov    0x4(%eax),%eax
+  803949:	85 c0                	test   %eax,%eax
+  80394b:	0f 84 e4 00 00 00    	je     803a35 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803951:	83 c3 01             	add    $0x1,%ebx
+  803954:	83 fb 20             	cmp    $0x20,%ebx
+  803957:	75 e3                	jne    80393c <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803959:	83 ec 0c             	sub    $0xc,%esp
+  80395c:	68 40 70 80 00       	push   $0x807040
+  803961:	e8 b0 fd ff ff       	call   803716 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803966:	83 c4 10             	add    $0x10,%esp
+  803969:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80396e:	e9 b8 00 00 00       	jmp    803a2b <pthread_create+0x12c>
+  803973:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803976:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803979:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  80397b:	39 f3                	cmp    %esi,%ebx
+  80397d:	73 16                	jae    803995 <pthread_create+0x96>
+		va -= PGSIZE;
+  80397f:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803985:	83 ec 08             	sub    $0x8,%esp
+  803988:	56                   	push   %esi
+  803989:	6a 00                	push   $0x0
+  80398b:	e8 52 d7 ff ff       	call   8010e2 <sys_page_unmap>
+  803990:	83 c4 10             	add    $0x10,%esp
+  803993:	eb e6                	jmp    80397b <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803995:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803998:	83 ec 08             	sub    $0x8,%esp
+  80399b:	ff 75 e4             	push   -0x1c(%ebp)
+  80399e:	6a 00                	push   $0x0
+  8039a0:	e8 3d d7 ff ff       	call   8010e2 <sys_page_unmap>
+	return r;
+  8039a5:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8039a8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039ab:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8039b2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8039b9:	eb 70                	jmp    803a2b <pthread_create+0x12c>
+	th->th_fn = fn;
+  8039bb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039be:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8039c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039c8:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8039cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039ce:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8039d1:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8039d8:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8039dd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8039e0:	29 c8                	sub    %ecx,%eax
+  8039e2:	85 db                	test   %ebx,%ebx
+  8039e4:	0f 44 05 e0 72 80 00 	cmove  0x8072e0,%eax
+	*--esp = t;
+  8039eb:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8039ee:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8039f5:	83 ec 04             	sub    $0x4,%esp
+  8039f8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8039fd:	29 ca                	sub    %ecx,%edx
+  8039ff:	52                   	push   %edx
+	*--esp = 0;
+  803a00:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803a03:	50                   	push   %eax
+  803a04:	68 5c 3c 80 00       	push   $0x803c5c
+  803a09:	e8 24 da ff ff       	call   801432 <sys_thread_create>
+  803a0e:	89 c7                	mov    %eax,%edi
+  803a10:	83 c4 10             	add    $0x10,%esp
+  803a13:	85 c0                	test   %eax,%eax
+  803a15:	78 91                	js     8039a8 <pthread_create+0xa9>
+	th->th_env = id;
+  803a17:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a1a:	89 3c 85 60 70 80 00 	mov    %edi,0x807060(,%eax,4)
+	*tp = t;
+  803a21:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a24:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803a26:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803a2b:	89 f8                	mov    %edi,%eax
+  803a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a30:	5b                   	pop    %ebx
+  803a31:	5e                   	pop    %esi
+  803a32:	5f                   	pop    %edi
+  803a33:	5d                   	pop    %ebp
+  803a34:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803a35:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a38:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803a3f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803a46:	83 ec 0c             	sub    $0xc,%esp
+  803a49:	68 40 70 80 00       	push   $0x807040
+  803a4e:	e8 c3 fc ff ff       	call   803716 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803a53:	89 d9                	mov    %ebx,%ecx
+  803a55:	c1 e1 10             	shl    $0x10,%ecx
+  803a58:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803a5b:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803a60:	29 c8                	sub    %ecx,%eax
+  803a62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803a65:	c1 e8 16             	shr    $0x16,%eax
+  803a68:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a6f:	83 c4 10             	add    $0x10,%esp
+  803a72:	a8 01                	test   $0x1,%al
+  803a74:	74 15                	je     803a8b <pthread_create+0x18c>
+  803a76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a79:	c1 e8 0c             	shr    $0xc,%eax
+  803a7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a83:	a8 01                	test   $0x1,%al
+  803a85:	0f 85 30 ff ff ff    	jne    8039bb <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a8b:	83 ec 04             	sub    $0x4,%esp
+  803a8e:	6a 07                	push   $0x7
+  803a90:	ff 75 e4             	push   -0x1c(%ebp)
+  803a93:	6a 00                	push   $0x0
+  803a95:	e8 af d5 ff ff       	call   801049 <sys_page_alloc>
+  803a9a:	89 c7                	mov    %eax,%edi
+  803a9c:	83 c4 10             	add    $0x10,%esp
+  803a9f:	85 c0                	test   %eax,%eax
+  803aa1:	0f 88 01 ff ff ff    	js     8039a8 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803aa7:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803aac:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803aaf:	29 d0                	sub    %edx,%eax
+  803ab1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803ab4:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803ab6:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803abb:	29 d0                	sub    %edx,%eax
+  803abd:	89 c7                	mov    %eax,%edi
+  803abf:	39 fe                	cmp    %edi,%esi
+  803ac1:	0f 83 f4 fe ff ff    	jae    8039bb <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ac7:	83 ec 04             	sub    $0x4,%esp
+  803aca:	6a 07                	push   $0x7
+  803acc:	56                   	push   %esi
+  803acd:	6a 00                	push   $0x0
+  803acf:	e8 75 d5 ff ff       	call   801049 <sys_page_alloc>
+  803ad4:	83 c4 10             	add    $0x10,%esp
+  803ad7:	85 c0                	test   %eax,%eax
+  803ad9:	0f 88 94 fe ff ff    	js     803973 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803adf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ae5:	eb d8                	jmp    803abf <pthread_create+0x1c0>
+
+00803ae7 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803ae7:	55                   	push   %ebp
+  803ae8:	89 e5                	mov    %esp,%ebp
+  803aea:	57                   	push   %edi
+  803aeb:	56                   	push   %esi
+  803aec:	53                   	push   %ebx
+  803aed:	83 ec 0c             	sub    $0xc,%esp
+  803af0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803af3:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803af6:	83 f8 1e             	cmp    $0x1e,%eax
+  803af9:	0f 87 c7 00 00 00    	ja     803bc6 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803aff:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b01:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b07:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b0c:	77 12                	ja     803b20 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b0e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b13:	29 d0                	sub    %edx,%eax
+  803b15:	c1 e8 10             	shr    $0x10,%eax
+  803b18:	39 c3                	cmp    %eax,%ebx
+  803b1a:	0f 84 ad 00 00 00    	je     803bcd <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b20:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b23:	8d 3c 85 64 70 80 00 	lea    0x807064(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803b2a:	8d 34 85 60 70 80 00 	lea    0x807060(,%eax,4),%esi
+  803b31:	eb 10                	jmp    803b43 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b33:	83 ec 04             	sub    $0x4,%esp
+  803b36:	6a 00                	push   $0x0
+  803b38:	6a 01                	push   $0x1
+  803b3a:	57                   	push   %edi
+  803b3b:	e8 1e d8 ff ff       	call   80135e <sys_futex_wait>
+  803b40:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803b43:	8b 46 04             	mov    0x4(%esi),%eax
+  803b46:	83 f8 01             	cmp    $0x1,%eax
+  803b49:	74 e8                	je     803b33 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803b4b:	83 f8 02             	cmp    $0x2,%eax
+  803b4e:	0f 85 80 00 00 00    	jne    803bd4 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b54:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803b57:	c1 e6 02             	shl    $0x2,%esi
+  803b5a:	eb 05                	jmp    803b61 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803b5c:	e8 bc d4 ff ff       	call   80101d <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b61:	8b 8e 60 70 80 00    	mov    0x807060(%esi),%ecx
+  803b67:	89 ca                	mov    %ecx,%edx
+  803b69:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803b6f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b72:	c1 e0 04             	shl    $0x4,%eax
+  803b75:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b7a:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803b7d:	39 c1                	cmp    %eax,%ecx
+  803b7f:	75 12                	jne    803b93 <pthread_join+0xac>
+  803b81:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b84:	c1 e0 04             	shl    $0x4,%eax
+  803b87:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b8c:	8b 40 54             	mov    0x54(%eax),%eax
+  803b8f:	85 c0                	test   %eax,%eax
+  803b91:	75 c9                	jne    803b5c <pthread_join+0x75>
+	if (ret_store)
+  803b93:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b97:	74 0f                	je     803ba8 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803b99:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b9c:	8b 04 85 70 70 80 00 	mov    0x807070(,%eax,4),%eax
+  803ba3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803ba6:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803ba8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bab:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803bb2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bc1:	5b                   	pop    %ebx
+  803bc2:	5e                   	pop    %esi
+  803bc3:	5f                   	pop    %edi
+  803bc4:	5d                   	pop    %ebp
+  803bc5:	c3                   	ret
+		return -E_INVAL;
+  803bc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bcb:	eb f1                	jmp    803bbe <pthread_join+0xd7>
+  803bcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bd2:	eb ea                	jmp    803bbe <pthread_join+0xd7>
+		return -E_INVAL;
+  803bd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bd9:	eb e3                	jmp    803bbe <pthread_join+0xd7>
+
+00803bdb <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803bdb:	55                   	push   %ebp
+  803bdc:	89 e5                	mov    %esp,%ebp
+  803bde:	53                   	push   %ebx
+  803bdf:	83 ec 04             	sub    $0x4,%esp
+  803be2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803be4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803bea:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803bef:	77 0c                	ja     803bfd <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803bf1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803bf6:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803bf8:	c1 e8 10             	shr    $0x10,%eax
+  803bfb:	75 0a                	jne    803c07 <pthread_exit+0x2c>
+		exit();
+  803bfd:	e8 68 c9 ff ff       	call   80056a <exit>
+  803c02:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803c07:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803c0e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803c11:	8d 0c 8d 60 70 80 00 	lea    0x807060(,%ecx,4),%ecx
+  803c18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c1b:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803c1e:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803c25:	83 ec 08             	sub    $0x8,%esp
+  803c28:	6a 20                	push   $0x20
+  803c2a:	01 c2                	add    %eax,%edx
+  803c2c:	8d 04 95 64 70 80 00 	lea    0x807064(,%edx,4),%eax
+  803c33:	50                   	push   %eax
+  803c34:	e8 54 d7 ff ff       	call   80138d <sys_futex_wake>
+	sys_env_destroy(0);
+  803c39:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803c40:	e8 61 d3 ff ff       	call   800fa6 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803c45:	83 c4 0c             	add    $0xc,%esp
+  803c48:	68 e6 51 80 00       	push   $0x8051e6
+  803c4d:	68 a5 00 00 00       	push   $0xa5
+  803c52:	68 00 52 80 00       	push   $0x805200
+  803c57:	e8 cd 03 00 00       	call   804029 <_panic>
+
+00803c5c <pthread_start>:
+{
+  803c5c:	55                   	push   %ebp
+  803c5d:	89 e5                	mov    %esp,%ebp
+  803c5f:	53                   	push   %ebx
+  803c60:	83 ec 04             	sub    $0x4,%esp
+  803c63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803c66:	e8 86 d3 ff ff       	call   800ff1 <sys_getenvid>
+  803c6b:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803c70:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	if (t == 0)
+  803c76:	85 db                	test   %ebx,%ebx
+  803c78:	74 0c                	je     803c86 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c7a:	89 d9                	mov    %ebx,%ecx
+  803c7c:	c1 e1 10             	shl    $0x10,%ecx
+  803c7f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803c84:	29 ca                	sub    %ecx,%edx
+  803c86:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803c89:	c1 e0 04             	shl    $0x4,%eax
+  803c8c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c91:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803c93:	83 ec 0c             	sub    $0xc,%esp
+  803c96:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c9d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ca0:	ff 34 95 6c 70 80 00 	push   0x80706c(,%edx,4)
+  803ca7:	ff 14 95 68 70 80 00 	call   *0x807068(,%edx,4)
+  803cae:	89 04 24             	mov    %eax,(%esp)
+  803cb1:	e8 25 ff ff ff       	call   803bdb <pthread_exit>
+
+00803cb6 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803cb6:	55                   	push   %ebp
+  803cb7:	89 e5                	mov    %esp,%ebp
+  803cb9:	57                   	push   %edi
+  803cba:	56                   	push   %esi
+  803cbb:	53                   	push   %ebx
+  803cbc:	83 ec 1c             	sub    $0x1c,%esp
+  803cbf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803cc1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803cc7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803cce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803cd3:	77 0d                	ja     803ce2 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803cd5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803cda:	29 d0                	sub    %edx,%eax
+  803cdc:	c1 e8 10             	shr    $0x10,%eax
+  803cdf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ce7:	eb 2f                	jmp    803d18 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803ce9:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803cef:	8b 01                	mov    (%ecx),%eax
+  803cf1:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803cf4:	39 c2                	cmp    %eax,%edx
+  803cf6:	75 14                	jne    803d0c <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803cf8:	83 ec 0c             	sub    $0xc,%esp
+  803cfb:	57                   	push   %edi
+  803cfc:	e8 a5 d2 ff ff       	call   800fa6 <sys_env_destroy>
+  803d01:	83 c4 10             	add    $0x10,%esp
+  803d04:	85 c0                	test   %eax,%eax
+  803d06:	0f 88 97 00 00 00    	js     803da3 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803d0c:	83 c3 01             	add    $0x1,%ebx
+  803d0f:	83 fb 20             	cmp    $0x20,%ebx
+  803d12:	0f 84 d2 00 00 00    	je     803dea <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803d18:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803d1b:	74 ef                	je     803d0c <pthread_kill_others+0x56>
+  803d1d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d20:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803d27:	8b 40 04             	mov    0x4(%eax),%eax
+  803d2a:	83 f8 01             	cmp    $0x1,%eax
+  803d2d:	75 dd                	jne    803d0c <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803d2f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d32:	8b 3c 85 60 70 80 00 	mov    0x807060(,%eax,4),%edi
+  803d39:	89 fe                	mov    %edi,%esi
+  803d3b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d41:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d44:	c1 e0 04             	shl    $0x4,%eax
+  803d47:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d4c:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d4f:	39 c7                	cmp    %eax,%edi
+  803d51:	75 b9                	jne    803d0c <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d53:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d56:	c1 e0 04             	shl    $0x4,%eax
+  803d59:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d5e:	8b 40 54             	mov    0x54(%eax),%eax
+  803d61:	85 c0                	test   %eax,%eax
+  803d63:	74 a7                	je     803d0c <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d65:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d68:	c1 e0 04             	shl    $0x4,%eax
+  803d6b:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803d71:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d73:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803d79:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d7e:	0f 87 65 ff ff ff    	ja     803ce9 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d84:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d89:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803d8b:	c1 e8 10             	shr    $0x10,%eax
+  803d8e:	0f 84 55 ff ff ff    	je     803ce9 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803d94:	c1 e0 10             	shl    $0x10,%eax
+  803d97:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803d9c:	29 c1                	sub    %eax,%ecx
+  803d9e:	e9 4c ff ff ff       	jmp    803cef <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803da3:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803da6:	c1 e2 04             	shl    $0x4,%edx
+  803da9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803daf:	8b 52 48             	mov    0x48(%edx),%edx
+  803db2:	39 fa                	cmp    %edi,%edx
+  803db4:	0f 85 52 ff ff ff    	jne    803d0c <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803dba:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803dbd:	c1 e2 04             	shl    $0x4,%edx
+  803dc0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803dc6:	8b 52 54             	mov    0x54(%edx),%edx
+  803dc9:	85 d2                	test   %edx,%edx
+  803dcb:	0f 84 3b ff ff ff    	je     803d0c <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803dd1:	83 ec 0c             	sub    $0xc,%esp
+  803dd4:	50                   	push   %eax
+  803dd5:	57                   	push   %edi
+  803dd6:	68 10 52 80 00       	push   $0x805210
+  803ddb:	68 bb 00 00 00       	push   $0xbb
+  803de0:	68 00 52 80 00       	push   $0x805200
+  803de5:	e8 3f 02 00 00       	call   804029 <_panic>
+	}
+}
+  803dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ded:	5b                   	pop    %ebx
+  803dee:	5e                   	pop    %esi
+  803def:	5f                   	pop    %edi
+  803df0:	5d                   	pop    %ebp
+  803df1:	c3                   	ret
+
+00803df2 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803df2:	55                   	push   %ebp
+  803df3:	89 e5                	mov    %esp,%ebp
+  803df5:	53                   	push   %ebx
+  803df6:	83 ec 04             	sub    $0x4,%esp
+  803df9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803dfb:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803e01:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e07:	0f 87 85 00 00 00    	ja     803e92 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e0d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803e12:	29 c3                	sub    %eax,%ebx
+  803e14:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803e17:	83 ec 04             	sub    $0x4,%esp
+  803e1a:	68 80 02 00 00       	push   $0x280
+  803e1f:	6a 00                	push   $0x0
+  803e21:	68 60 70 80 00       	push   $0x807060
+  803e26:	e8 31 cf ff ff       	call   800d5c <memset>
+	threads_mu.m_state = 0;
+  803e2b:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  803e32:	00 00 00 
+	if (self != 0) {
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	85 db                	test   %ebx,%ebx
+  803e3a:	74 51                	je     803e8d <pthread_fork_child+0x9b>
+  803e3c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e3e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e44:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e49:	77 18                	ja     803e63 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e4b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e50:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803e52:	c1 e8 10             	shr    $0x10,%eax
+  803e55:	74 0c                	je     803e63 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e57:	c1 e0 10             	shl    $0x10,%eax
+  803e5a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e5f:	29 c2                	sub    %eax,%edx
+  803e61:	eb 06                	jmp    803e69 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803e63:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803e69:	8b 02                	mov    (%edx),%eax
+  803e6b:	8b 48 48             	mov    0x48(%eax),%ecx
+  803e6e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803e75:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803e78:	89 0c 95 60 70 80 00 	mov    %ecx,0x807060(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803e7f:	8d 04 95 60 70 80 00 	lea    0x807060(,%edx,4),%eax
+  803e86:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803e8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e90:	c9                   	leave
+  803e91:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803e92:	83 ec 04             	sub    $0x4,%esp
+  803e95:	68 80 02 00 00       	push   $0x280
+  803e9a:	6a 00                	push   $0x0
+  803e9c:	68 60 70 80 00       	push   $0x807060
+  803ea1:	e8 b6 ce ff ff       	call   800d5c <memset>
+	threads_mu.m_state = 0;
+  803ea6:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  803ead:	00 00 00 
+  803eb0:	83 c4 10             	add    $0x10,%esp
+  803eb3:	eb d8                	jmp    803e8d <pthread_fork_child+0x9b>
+
+00803eb5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eba:	c3                   	ret
+
+00803ebb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ebb:	55                   	push   %ebp
+  803ebc:	89 e5                	mov    %esp,%ebp
+  803ebe:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803ec1:	68 35 52 80 00       	push   $0x805235
+  803ec6:	ff 75 0c             	push   0xc(%ebp)
+  803ec9:	e8 3d cd ff ff       	call   800c0b <strcpy>
+	return 0;
+}
+  803ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed3:	c9                   	leave
+  803ed4:	c3                   	ret
+
+00803ed5 <devcons_write>:
+{
+  803ed5:	55                   	push   %ebp
+  803ed6:	89 e5                	mov    %esp,%ebp
+  803ed8:	57                   	push   %edi
+  803ed9:	56                   	push   %esi
+  803eda:	53                   	push   %ebx
+  803edb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803ee1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803ee6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803eec:	eb 2e                	jmp    803f1c <devcons_write+0x47>
+		m = n - tot;
+  803eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ef1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803ef3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ef8:	39 c3                	cmp    %eax,%ebx
+  803efa:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803efd:	83 ec 04             	sub    $0x4,%esp
+  803f00:	53                   	push   %ebx
+  803f01:	89 f0                	mov    %esi,%eax
+  803f03:	03 45 0c             	add    0xc(%ebp),%eax
+  803f06:	50                   	push   %eax
+  803f07:	57                   	push   %edi
+  803f08:	e8 84 ce ff ff       	call   800d91 <memmove>
+		sys_cputs(buf, m);
+  803f0d:	83 c4 08             	add    $0x8,%esp
+  803f10:	53                   	push   %ebx
+  803f11:	57                   	push   %edi
+  803f12:	e8 38 d0 ff ff       	call   800f4f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803f17:	01 de                	add    %ebx,%esi
+  803f19:	83 c4 10             	add    $0x10,%esp
+  803f1c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803f1f:	72 cd                	jb     803eee <devcons_write+0x19>
+}
+  803f21:	89 f0                	mov    %esi,%eax
+  803f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f26:	5b                   	pop    %ebx
+  803f27:	5e                   	pop    %esi
+  803f28:	5f                   	pop    %edi
+  803f29:	5d                   	pop    %ebp
+  803f2a:	c3                   	ret
+
+00803f2b <devcons_read>:
+{
+  803f2b:	55                   	push   %ebp
+  803f2c:	89 e5                	mov    %esp,%ebp
+  803f2e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f36:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803f3a:	75 07                	jne    803f43 <devcons_read+0x18>
+  803f3c:	eb 1f                	jmp    803f5d <devcons_read+0x32>
+		sys_yield();
+  803f3e:	e8 da d0 ff ff       	call   80101d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803f43:	e8 32 d0 ff ff       	call   800f7a <sys_cgetc>
+  803f48:	85 c0                	test   %eax,%eax
+  803f4a:	74 f2                	je     803f3e <devcons_read+0x13>
+	if (c < 0)
+  803f4c:	78 0f                	js     803f5d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803f4e:	83 f8 04             	cmp    $0x4,%eax
+  803f51:	74 0c                	je     803f5f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803f53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f56:	88 02                	mov    %al,(%edx)
+	return 1;
+  803f58:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803f5d:	c9                   	leave
+  803f5e:	c3                   	ret
+		return 0;
+  803f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f64:	eb f7                	jmp    803f5d <devcons_read+0x32>
+
+00803f66 <cputchar>:
+{
+  803f66:	55                   	push   %ebp
+  803f67:	89 e5                	mov    %esp,%ebp
+  803f69:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f6f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803f72:	6a 01                	push   $0x1
+  803f74:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f77:	50                   	push   %eax
+  803f78:	e8 d2 cf ff ff       	call   800f4f <sys_cputs>
+}
+  803f7d:	83 c4 10             	add    $0x10,%esp
+  803f80:	c9                   	leave
+  803f81:	c3                   	ret
+
+00803f82 <getchar>:
+{
+  803f82:	55                   	push   %ebp
+  803f83:	89 e5                	mov    %esp,%ebp
+  803f85:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803f88:	6a 01                	push   $0x1
+  803f8a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f8d:	50                   	push   %eax
+  803f8e:	6a 00                	push   $0x0
+  803f90:	e8 63 d8 ff ff       	call   8017f8 <read>
+	if (r < 0)
+  803f95:	83 c4 10             	add    $0x10,%esp
+  803f98:	85 c0                	test   %eax,%eax
+  803f9a:	78 06                	js     803fa2 <getchar+0x20>
+	if (r < 1)
+  803f9c:	74 06                	je     803fa4 <getchar+0x22>
+	return c;
+  803f9e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803fa2:	c9                   	leave
+  803fa3:	c3                   	ret
+		return -E_EOF;
+  803fa4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803fa9:	eb f7                	jmp    803fa2 <getchar+0x20>
+
+00803fab <iscons>:
+{
+  803fab:	55                   	push   %ebp
+  803fac:	89 e5                	mov    %esp,%ebp
+  803fae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803fb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fb4:	50                   	push   %eax
+  803fb5:	ff 75 08             	push   0x8(%ebp)
+  803fb8:	e8 ab d5 ff ff       	call   801568 <fd_lookup>
+  803fbd:	83 c4 10             	add    $0x10,%esp
+  803fc0:	85 c0                	test   %eax,%eax
+  803fc2:	78 11                	js     803fd5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803fc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fc7:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803fcd:	39 10                	cmp    %edx,(%eax)
+  803fcf:	0f 94 c0             	sete   %al
+  803fd2:	0f b6 c0             	movzbl %al,%eax
+}
+  803fd5:	c9                   	leave
+  803fd6:	c3                   	ret
+
+00803fd7 <opencons>:
+{
+  803fd7:	55                   	push   %ebp
+  803fd8:	89 e5                	mov    %esp,%ebp
+  803fda:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803fdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fe0:	50                   	push   %eax
+  803fe1:	e8 2c d5 ff ff       	call   801512 <fd_alloc>
+  803fe6:	83 c4 10             	add    $0x10,%esp
+  803fe9:	85 c0                	test   %eax,%eax
+  803feb:	78 3a                	js     804027 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803fed:	83 ec 04             	sub    $0x4,%esp
+  803ff0:	68 07 04 00 00       	push   $0x407
+  803ff5:	ff 75 f4             	push   -0xc(%ebp)
+  803ff8:	6a 00                	push   $0x0
+  803ffa:	e8 4a d0 ff ff       	call   801049 <sys_page_alloc>
+  803fff:	83 c4 10             	add    $0x10,%esp
+  804002:	85 c0                	test   %eax,%eax
+  804004:	78 21                	js     804027 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804006:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804009:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80400f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804014:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80401b:	83 ec 0c             	sub    $0xc,%esp
+  80401e:	50                   	push   %eax
+  80401f:	e8 c7 d4 ff ff       	call   8014eb <fd2num>
+  804024:	83 c4 10             	add    $0x10,%esp
+}
+  804027:	c9                   	leave
+  804028:	c3                   	ret
+
+00804029 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804029:	55                   	push   %ebp
+  80402a:	89 e5                	mov    %esp,%ebp
+  80402c:	56                   	push   %esi
+  80402d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80402e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804031:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  804037:	e8 b5 cf ff ff       	call   800ff1 <sys_getenvid>
+  80403c:	83 ec 0c             	sub    $0xc,%esp
+  80403f:	ff 75 0c             	push   0xc(%ebp)
+  804042:	ff 75 08             	push   0x8(%ebp)
+  804045:	56                   	push   %esi
+  804046:	50                   	push   %eax
+  804047:	68 44 52 80 00       	push   $0x805244
+  80404c:	e8 d6 c5 ff ff       	call   800627 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804051:	83 c4 18             	add    $0x18,%esp
+  804054:	53                   	push   %ebx
+  804055:	ff 75 10             	push   0x10(%ebp)
+  804058:	e8 79 c5 ff ff       	call   8005d6 <vcprintf>
+	cprintf("\n");
+  80405d:	c7 04 24 a2 53 80 00 	movl   $0x8053a2,(%esp)
+  804064:	e8 be c5 ff ff       	call   800627 <cprintf>
+  804069:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80406c:	cc                   	int3
+	while (1)
+  80406d:	eb fd                	jmp    80406c <_panic+0x43>
+
+0080406f <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80406f:	55                   	push   %ebp
+  804070:	89 e5                	mov    %esp,%ebp
+  804072:	57                   	push   %edi
+  804073:	56                   	push   %esi
+  804074:	53                   	push   %ebx
+  804075:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  804078:	89 d6                	mov    %edx,%esi
+  80407a:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80407d:	89 cf                	mov    %ecx,%edi
+  80407f:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  804082:	89 fa                	mov    %edi,%edx
+  804084:	80 ce 08             	or     $0x8,%dh
+  804087:	f6 c5 08             	test   $0x8,%ch
+  80408a:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80408d:	57                   	push   %edi
+  80408e:	56                   	push   %esi
+  80408f:	50                   	push   %eax
+  804090:	56                   	push   %esi
+  804091:	6a 00                	push   $0x0
+  804093:	e8 fe cf ff ff       	call   801096 <sys_page_map>
+	if (r < 0) {
+  804098:	83 c4 20             	add    $0x20,%esp
+  80409b:	85 c0                	test   %eax,%eax
+  80409d:	78 27                	js     8040c6 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80409f:	83 ec 0c             	sub    $0xc,%esp
+  8040a2:	57                   	push   %edi
+  8040a3:	56                   	push   %esi
+  8040a4:	6a 00                	push   $0x0
+  8040a6:	56                   	push   %esi
+  8040a7:	6a 00                	push   $0x0
+  8040a9:	e8 e8 cf ff ff       	call   801096 <sys_page_map>
+  8040ae:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8040b0:	83 c4 20             	add    $0x20,%esp
+  8040b3:	85 c0                	test   %eax,%eax
+  8040b5:	78 24                	js     8040db <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8040b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8040bc:	89 d8                	mov    %ebx,%eax
+  8040be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040c1:	5b                   	pop    %ebx
+  8040c2:	5e                   	pop    %esi
+  8040c3:	5f                   	pop    %edi
+  8040c4:	5d                   	pop    %ebp
+  8040c5:	c3                   	ret
+  8040c6:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8040c8:	83 ec 08             	sub    $0x8,%esp
+  8040cb:	50                   	push   %eax
+  8040cc:	68 68 52 80 00       	push   $0x805268
+  8040d1:	e8 51 c5 ff ff       	call   800627 <cprintf>
+		return r;
+  8040d6:	83 c4 10             	add    $0x10,%esp
+  8040d9:	eb e1                	jmp    8040bc <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8040db:	83 ec 08             	sub    $0x8,%esp
+  8040de:	50                   	push   %eax
+  8040df:	68 98 52 80 00       	push   $0x805298
+  8040e4:	e8 3e c5 ff ff       	call   800627 <cprintf>
+		return r;
+  8040e9:	83 c4 10             	add    $0x10,%esp
+  8040ec:	eb ce                	jmp    8040bc <duppage_cow+0x4d>
+
+008040ee <duppage>:
+{
+  8040ee:	55                   	push   %ebp
+  8040ef:	89 e5                	mov    %esp,%ebp
+  8040f1:	53                   	push   %ebx
+  8040f2:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8040f5:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8040f8:	51                   	push   %ecx
+  8040f9:	52                   	push   %edx
+  8040fa:	50                   	push   %eax
+  8040fb:	52                   	push   %edx
+  8040fc:	6a 00                	push   $0x0
+  8040fe:	e8 93 cf ff ff       	call   801096 <sys_page_map>
+	if (r < 0) {
+  804103:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  804106:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	78 07                	js     804116 <duppage+0x28>
+}
+  80410f:	89 d8                	mov    %ebx,%eax
+  804111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804114:	c9                   	leave
+  804115:	c3                   	ret
+  804116:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804118:	83 ec 08             	sub    $0x8,%esp
+  80411b:	50                   	push   %eax
+  80411c:	68 68 52 80 00       	push   $0x805268
+  804121:	e8 01 c5 ff ff       	call   800627 <cprintf>
+		return r;
+  804126:	83 c4 10             	add    $0x10,%esp
+  804129:	eb e4                	jmp    80410f <duppage+0x21>
+
+0080412b <cow_copy>:
+{
+  80412b:	55                   	push   %ebp
+  80412c:	89 e5                	mov    %esp,%ebp
+  80412e:	56                   	push   %esi
+  80412f:	53                   	push   %ebx
+  804130:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804132:	83 ec 04             	sub    $0x4,%esp
+  804135:	6a 07                	push   $0x7
+  804137:	68 00 f0 7f 00       	push   $0x7ff000
+  80413c:	6a 00                	push   $0x0
+  80413e:	e8 06 cf ff ff       	call   801049 <sys_page_alloc>
+	if (r < 0) {
+  804143:	83 c4 10             	add    $0x10,%esp
+  804146:	85 c0                	test   %eax,%eax
+  804148:	78 58                	js     8041a2 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80414a:	83 ec 04             	sub    $0x4,%esp
+  80414d:	68 00 10 00 00       	push   $0x1000
+  804152:	56                   	push   %esi
+  804153:	68 00 f0 7f 00       	push   $0x7ff000
+  804158:	e8 34 cc ff ff       	call   800d91 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80415d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804164:	56                   	push   %esi
+  804165:	6a 00                	push   $0x0
+  804167:	68 00 f0 7f 00       	push   $0x7ff000
+  80416c:	6a 00                	push   $0x0
+  80416e:	e8 23 cf ff ff       	call   801096 <sys_page_map>
+  804173:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804175:	83 c4 20             	add    $0x20,%esp
+  804178:	85 c0                	test   %eax,%eax
+  80417a:	78 3b                	js     8041b7 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80417c:	83 ec 08             	sub    $0x8,%esp
+  80417f:	68 00 f0 7f 00       	push   $0x7ff000
+  804184:	6a 00                	push   $0x0
+  804186:	e8 57 cf ff ff       	call   8010e2 <sys_page_unmap>
+  80418b:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80418d:	83 c4 10             	add    $0x10,%esp
+  804190:	85 c0                	test   %eax,%eax
+  804192:	78 45                	js     8041d9 <cow_copy+0xae>
+	return 0;
+  804194:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804199:	89 d8                	mov    %ebx,%eax
+  80419b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80419e:	5b                   	pop    %ebx
+  80419f:	5e                   	pop    %esi
+  8041a0:	5d                   	pop    %ebp
+  8041a1:	c3                   	ret
+  8041a2:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8041a4:	83 ec 08             	sub    $0x8,%esp
+  8041a7:	50                   	push   %eax
+  8041a8:	68 88 53 80 00       	push   $0x805388
+  8041ad:	e8 75 c4 ff ff       	call   800627 <cprintf>
+		return r;
+  8041b2:	83 c4 10             	add    $0x10,%esp
+  8041b5:	eb e2                	jmp    804199 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8041b7:	83 ec 08             	sub    $0x8,%esp
+  8041ba:	50                   	push   %eax
+  8041bb:	68 a4 53 80 00       	push   $0x8053a4
+  8041c0:	e8 62 c4 ff ff       	call   800627 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8041c5:	83 c4 08             	add    $0x8,%esp
+  8041c8:	68 00 f0 7f 00       	push   $0x7ff000
+  8041cd:	6a 00                	push   $0x0
+  8041cf:	e8 0e cf ff ff       	call   8010e2 <sys_page_unmap>
+		return r;
+  8041d4:	83 c4 10             	add    $0x10,%esp
+  8041d7:	eb c0                	jmp    804199 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8041d9:	83 ec 08             	sub    $0x8,%esp
+  8041dc:	50                   	push   %eax
+  8041dd:	68 c0 52 80 00       	push   $0x8052c0
+  8041e2:	e8 40 c4 ff ff       	call   800627 <cprintf>
+		return r;
+  8041e7:	83 c4 10             	add    $0x10,%esp
+  8041ea:	eb ad                	jmp    804199 <cow_copy+0x6e>
+
+008041ec <pgfault>:
+{
+  8041ec:	55                   	push   %ebp
+  8041ed:	89 e5                	mov    %esp,%ebp
+  8041ef:	56                   	push   %esi
+  8041f0:	53                   	push   %ebx
+  8041f1:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8041f4:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8041f6:	89 d8                	mov    %ebx,%eax
+  8041f8:	c1 e8 16             	shr    $0x16,%eax
+  8041fb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804202:	89 de                	mov    %ebx,%esi
+  804204:	c1 ee 0c             	shr    $0xc,%esi
+  804207:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80420e:	a8 07                	test   $0x7,%al
+  804210:	74 3b                	je     80424d <pgfault+0x61>
+  804212:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804218:	74 33                	je     80424d <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80421a:	83 ec 0c             	sub    $0xc,%esp
+  80421d:	68 00 f0 bf ee       	push   $0xeebff000
+  804222:	e8 82 f4 ff ff       	call   8036a9 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  804227:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80422e:	83 c4 10             	add    $0x10,%esp
+  804231:	f6 c4 08             	test   $0x8,%ah
+  804234:	75 30                	jne    804266 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804236:	83 ec 0c             	sub    $0xc,%esp
+  804239:	68 00 f0 bf ee       	push   $0xeebff000
+  80423e:	e8 d3 f4 ff ff       	call   803716 <mutex_unlock>
+}
+  804243:	83 c4 10             	add    $0x10,%esp
+  804246:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804249:	5b                   	pop    %ebx
+  80424a:	5e                   	pop    %esi
+  80424b:	5d                   	pop    %ebp
+  80424c:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80424d:	83 ec 08             	sub    $0x8,%esp
+  804250:	ff 72 28             	push   0x28(%edx)
+  804253:	51                   	push   %ecx
+  804254:	50                   	push   %eax
+  804255:	68 e4 52 80 00       	push   $0x8052e4
+  80425a:	6a 3f                	push   $0x3f
+  80425c:	68 be 53 80 00       	push   $0x8053be
+  804261:	e8 c3 fd ff ff       	call   804029 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804266:	89 d8                	mov    %ebx,%eax
+  804268:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80426d:	e8 b9 fe ff ff       	call   80412b <cow_copy>
+  804272:	eb c2                	jmp    804236 <pgfault+0x4a>
+
+00804274 <cow_enable>:
+{
+  804274:	55                   	push   %ebp
+  804275:	89 e5                	mov    %esp,%ebp
+  804277:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80427a:	68 ec 41 80 00       	push   $0x8041ec
+  80427f:	e8 28 06 00 00       	call   8048ac <set_pgfault_handler>
+}
+  804284:	83 c4 10             	add    $0x10,%esp
+  804287:	c9                   	leave
+  804288:	c3                   	ret
+
+00804289 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804289:	55                   	push   %ebp
+  80428a:	89 e5                	mov    %esp,%ebp
+  80428c:	57                   	push   %edi
+  80428d:	56                   	push   %esi
+  80428e:	53                   	push   %ebx
+  80428f:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804292:	68 ec 41 80 00       	push   $0x8041ec
+  804297:	e8 10 06 00 00       	call   8048ac <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80429c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8042a1:	cd 30                	int    $0x30
+  8042a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8042a6:	83 c4 10             	add    $0x10,%esp
+  8042a9:	85 c0                	test   %eax,%eax
+  8042ab:	78 4b                	js     8042f8 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8042ad:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8042ba:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8042be:	0f 85 16 01 00 00    	jne    8043da <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8042c4:	e8 28 cd ff ff       	call   800ff1 <sys_getenvid>
+  8042c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042ce:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042d0:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8042d6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8042dc:	77 32                	ja     804310 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042de:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8042e3:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8042e5:	c1 ea 10             	shr    $0x10,%edx
+  8042e8:	74 26                	je     804310 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042ea:	c1 e2 10             	shl    $0x10,%edx
+  8042ed:	89 d1                	mov    %edx,%ecx
+  8042ef:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042f4:	29 ca                	sub    %ecx,%edx
+  8042f6:	eb 1e                	jmp    804316 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8042f8:	83 ec 08             	sub    $0x8,%esp
+  8042fb:	89 c7                	mov    %eax,%edi
+  8042fd:	50                   	push   %eax
+  8042fe:	68 c9 53 80 00       	push   $0x8053c9
+  804303:	e8 1f c3 ff ff       	call   800627 <cprintf>
+		return eid;
+  804308:	83 c4 10             	add    $0x10,%esp
+  80430b:	e9 6c 01 00 00       	jmp    80447c <fork+0x1f3>
+		return pthread_main_tls;
+  804310:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804316:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804319:	c1 e0 04             	shl    $0x4,%eax
+  80431c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804321:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804323:	e8 ca fa ff ff       	call   803df2 <pthread_fork_child>
+		return eid;
+  804328:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80432b:	e9 4c 01 00 00       	jmp    80447c <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804330:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804336:	89 da                	mov    %ebx,%edx
+  804338:	89 f8                	mov    %edi,%eax
+  80433a:	e8 af fd ff ff       	call   8040ee <duppage>
+  80433f:	85 c0                	test   %eax,%eax
+  804341:	79 28                	jns    80436b <fork+0xe2>
+  804343:	89 c7                	mov    %eax,%edi
+  804345:	e9 32 01 00 00       	jmp    80447c <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80434a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804350:	83 f9 05             	cmp    $0x5,%ecx
+  804353:	75 58                	jne    8043ad <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804355:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80435a:	89 da                	mov    %ebx,%edx
+  80435c:	89 f8                	mov    %edi,%eax
+  80435e:	e8 8b fd ff ff       	call   8040ee <duppage>
+  804363:	85 c0                	test   %eax,%eax
+  804365:	0f 88 0f 01 00 00    	js     80447a <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80436b:	83 c3 01             	add    $0x1,%ebx
+  80436e:	39 de                	cmp    %ebx,%esi
+  804370:	74 54                	je     8043c6 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804372:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804379:	f6 c1 05             	test   $0x5,%cl
+  80437c:	74 ed                	je     80436b <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80437e:	f6 c5 04             	test   $0x4,%ch
+  804381:	75 ad                	jne    804330 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804383:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804389:	74 bf                	je     80434a <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80438b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804391:	74 d8                	je     80436b <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804393:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804399:	89 da                	mov    %ebx,%edx
+  80439b:	89 f8                	mov    %edi,%eax
+  80439d:	e8 cd fc ff ff       	call   80406f <duppage_cow>
+  8043a2:	85 c0                	test   %eax,%eax
+  8043a4:	79 c5                	jns    80436b <fork+0xe2>
+  8043a6:	89 c7                	mov    %eax,%edi
+  8043a8:	e9 cf 00 00 00       	jmp    80447c <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8043ad:	68 14 53 80 00       	push   $0x805314
+  8043b2:	68 fd 50 80 00       	push   $0x8050fd
+  8043b7:	68 c6 00 00 00       	push   $0xc6
+  8043bc:	68 be 53 80 00       	push   $0x8053be
+  8043c1:	e8 63 fc ff ff       	call   804029 <_panic>
+  8043c6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8043c9:	83 c1 01             	add    $0x1,%ecx
+  8043cc:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8043d2:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8043d8:	74 18                	je     8043f2 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8043da:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8043e1:	a8 07                	test   $0x7,%al
+  8043e3:	74 e4                	je     8043c9 <fork+0x140>
+  8043e5:	89 cb                	mov    %ecx,%ebx
+  8043e7:	c1 e3 0a             	shl    $0xa,%ebx
+  8043ea:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8043ed:	e9 7c ff ff ff       	jmp    80436e <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8043f2:	83 ec 04             	sub    $0x4,%esp
+  8043f5:	6a 07                	push   $0x7
+  8043f7:	68 00 f0 bf ee       	push   $0xeebff000
+  8043fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8043ff:	e8 45 cc ff ff       	call   801049 <sys_page_alloc>
+  804404:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804406:	83 c4 10             	add    $0x10,%esp
+  804409:	85 c0                	test   %eax,%eax
+  80440b:	78 34                	js     804441 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80440d:	83 ec 08             	sub    $0x8,%esp
+  804410:	68 ea 48 80 00       	push   $0x8048ea
+  804415:	ff 75 e4             	push   -0x1c(%ebp)
+  804418:	e8 a9 cd ff ff       	call   8011c6 <sys_env_set_pgfault_upcall>
+  80441d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80441f:	83 c4 10             	add    $0x10,%esp
+  804422:	85 c0                	test   %eax,%eax
+  804424:	78 2e                	js     804454 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804426:	83 ec 08             	sub    $0x8,%esp
+  804429:	6a 02                	push   $0x2
+  80442b:	ff 75 e4             	push   -0x1c(%ebp)
+  80442e:	e8 fb cc ff ff       	call   80112e <sys_env_set_status>
+  804433:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804435:	83 c4 10             	add    $0x10,%esp
+  804438:	85 c0                	test   %eax,%eax
+  80443a:	78 2b                	js     804467 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80443c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80443f:	eb 3b                	jmp    80447c <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804441:	83 ec 08             	sub    $0x8,%esp
+  804444:	50                   	push   %eax
+  804445:	68 3c 53 80 00       	push   $0x80533c
+  80444a:	e8 d8 c1 ff ff       	call   800627 <cprintf>
+		return r;
+  80444f:	83 c4 10             	add    $0x10,%esp
+  804452:	eb 28                	jmp    80447c <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804454:	83 ec 08             	sub    $0x8,%esp
+  804457:	50                   	push   %eax
+  804458:	68 64 53 80 00       	push   $0x805364
+  80445d:	e8 c5 c1 ff ff       	call   800627 <cprintf>
+		return r;
+  804462:	83 c4 10             	add    $0x10,%esp
+  804465:	eb 15                	jmp    80447c <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804467:	83 ec 08             	sub    $0x8,%esp
+  80446a:	50                   	push   %eax
+  80446b:	68 d9 53 80 00       	push   $0x8053d9
+  804470:	e8 b2 c1 ff ff       	call   800627 <cprintf>
+		return r;
+  804475:	83 c4 10             	add    $0x10,%esp
+  804478:	eb 02                	jmp    80447c <fork+0x1f3>
+  80447a:	89 c7                	mov    %eax,%edi
+}
+  80447c:	89 f8                	mov    %edi,%eax
+  80447e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804481:	5b                   	pop    %ebx
+  804482:	5e                   	pop    %esi
+  804483:	5f                   	pop    %edi
+  804484:	5d                   	pop    %ebp
+  804485:	c3                   	ret
+
+00804486 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804486:	55                   	push   %ebp
+  804487:	89 e5                	mov    %esp,%ebp
+  804489:	57                   	push   %edi
+  80448a:	56                   	push   %esi
+  80448b:	53                   	push   %ebx
+  80448c:	83 ec 2c             	sub    $0x2c,%esp
+  80448f:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804491:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804497:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80449c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8044a2:	77 0a                	ja     8044ae <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044a4:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8044a9:	29 c3                	sub    %eax,%ebx
+  8044ab:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8044ae:	83 ec 0c             	sub    $0xc,%esp
+  8044b1:	68 ec 41 80 00       	push   $0x8041ec
+  8044b6:	e8 f1 03 00 00       	call   8048ac <set_pgfault_handler>
+  8044bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8044c0:	cd 30                	int    $0x30
+  8044c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8044c5:	83 c4 10             	add    $0x10,%esp
+  8044c8:	85 c0                	test   %eax,%eax
+  8044ca:	78 30                	js     8044fc <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8044cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8044d0:	74 42                	je     804514 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8044d2:	c1 e3 10             	shl    $0x10,%ebx
+  8044d5:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8044da:	29 d8                	sub    %ebx,%eax
+  8044dc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8044df:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8044e4:	29 d8                	sub    %ebx,%eax
+  8044e6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8044e9:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8044ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044f3:	89 f7                	mov    %esi,%edi
+  8044f5:	89 d6                	mov    %edx,%esi
+  8044f7:	e9 2c 01 00 00       	jmp    804628 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8044fc:	83 ec 08             	sub    $0x8,%esp
+  8044ff:	89 c7                	mov    %eax,%edi
+  804501:	50                   	push   %eax
+  804502:	68 c9 53 80 00       	push   $0x8053c9
+  804507:	e8 1b c1 ff ff       	call   800627 <cprintf>
+		return eid;
+  80450c:	83 c4 10             	add    $0x10,%esp
+  80450f:	e9 d5 00 00 00       	jmp    8045e9 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804514:	e8 d8 ca ff ff       	call   800ff1 <sys_getenvid>
+  804519:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80451e:	89 c2                	mov    %eax,%edx
+  804520:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804522:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804528:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80452d:	77 18                	ja     804547 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80452f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804534:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804536:	c1 e8 10             	shr    $0x10,%eax
+  804539:	74 0c                	je     804547 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80453b:	c1 e0 10             	shl    $0x10,%eax
+  80453e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804543:	29 c1                	sub    %eax,%ecx
+  804545:	eb 06                	jmp    80454d <sfork+0xc7>
+		return pthread_main_tls;
+  804547:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+  80454d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804550:	c1 e0 04             	shl    $0x4,%eax
+  804553:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804558:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80455a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80455d:	e9 87 00 00 00       	jmp    8045e9 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804562:	f6 c5 04             	test   $0x4,%ch
+  804565:	74 6c                	je     8045d3 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804567:	89 ca                	mov    %ecx,%edx
+  804569:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80456f:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804575:	74 7c                	je     8045f3 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804577:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80457d:	89 da                	mov    %ebx,%edx
+  80457f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804582:	e8 67 fb ff ff       	call   8040ee <duppage>
+  804587:	85 c0                	test   %eax,%eax
+  804589:	0f 88 4f 01 00 00    	js     8046de <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80458f:	83 c3 01             	add    $0x1,%ebx
+  804592:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804595:	74 7a                	je     804611 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804597:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804599:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8045a0:	f6 c1 01             	test   $0x1,%cl
+  8045a3:	74 ea                	je     80458f <sfork+0x109>
+  8045a5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8045ab:	74 e2                	je     80458f <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8045ad:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8045b3:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8045b6:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8045bb:	76 a5                	jbe    804562 <sfork+0xdc>
+  8045bd:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8045c3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045c6:	39 fa                	cmp    %edi,%edx
+  8045c8:	73 9d                	jae    804567 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8045ca:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8045cd:	39 fa                	cmp    %edi,%edx
+  8045cf:	72 96                	jb     804567 <sfork+0xe1>
+  8045d1:	eb 8f                	jmp    804562 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8045d3:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8045d9:	89 da                	mov    %ebx,%edx
+  8045db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8045de:	e8 8c fa ff ff       	call   80406f <duppage_cow>
+  8045e3:	85 c0                	test   %eax,%eax
+  8045e5:	79 a8                	jns    80458f <sfork+0x109>
+  8045e7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8045e9:	89 f8                	mov    %edi,%eax
+  8045eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ee:	5b                   	pop    %ebx
+  8045ef:	5e                   	pop    %esi
+  8045f0:	5f                   	pop    %edi
+  8045f1:	5d                   	pop    %ebp
+  8045f2:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8045f3:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8045f8:	e8 2e fb ff ff       	call   80412b <cow_copy>
+  8045fd:	85 c0                	test   %eax,%eax
+  8045ff:	0f 88 d2 00 00 00    	js     8046d7 <sfork+0x251>
+				pte = uvpt[pn];
+  804605:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80460c:	e9 66 ff ff ff       	jmp    804577 <sfork+0xf1>
+  804611:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804614:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804617:	83 c6 01             	add    $0x1,%esi
+  80461a:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804620:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804626:	74 1b                	je     804643 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804628:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80462f:	a8 01                	test   $0x1,%al
+  804631:	74 e4                	je     804617 <sfork+0x191>
+  804633:	89 f3                	mov    %esi,%ebx
+  804635:	c1 e3 0a             	shl    $0xa,%ebx
+  804638:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80463b:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80463e:	e9 4f ff ff ff       	jmp    804592 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804643:	83 ec 04             	sub    $0x4,%esp
+  804646:	6a 07                	push   $0x7
+  804648:	68 00 f0 bf ee       	push   $0xeebff000
+  80464d:	ff 75 e0             	push   -0x20(%ebp)
+  804650:	e8 f4 c9 ff ff       	call   801049 <sys_page_alloc>
+  804655:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804657:	83 c4 10             	add    $0x10,%esp
+  80465a:	85 c0                	test   %eax,%eax
+  80465c:	78 37                	js     804695 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80465e:	83 ec 08             	sub    $0x8,%esp
+  804661:	68 ea 48 80 00       	push   $0x8048ea
+  804666:	ff 75 e0             	push   -0x20(%ebp)
+  804669:	e8 58 cb ff ff       	call   8011c6 <sys_env_set_pgfault_upcall>
+  80466e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804670:	83 c4 10             	add    $0x10,%esp
+  804673:	85 c0                	test   %eax,%eax
+  804675:	78 34                	js     8046ab <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804677:	83 ec 08             	sub    $0x8,%esp
+  80467a:	6a 02                	push   $0x2
+  80467c:	ff 75 e0             	push   -0x20(%ebp)
+  80467f:	e8 aa ca ff ff       	call   80112e <sys_env_set_status>
+  804684:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804686:	83 c4 10             	add    $0x10,%esp
+  804689:	85 c0                	test   %eax,%eax
+  80468b:	78 34                	js     8046c1 <sfork+0x23b>
+	return eid;
+  80468d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804690:	e9 54 ff ff ff       	jmp    8045e9 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804695:	83 ec 08             	sub    $0x8,%esp
+  804698:	50                   	push   %eax
+  804699:	68 3c 53 80 00       	push   $0x80533c
+  80469e:	e8 84 bf ff ff       	call   800627 <cprintf>
+		return r;
+  8046a3:	83 c4 10             	add    $0x10,%esp
+  8046a6:	e9 3e ff ff ff       	jmp    8045e9 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8046ab:	83 ec 08             	sub    $0x8,%esp
+  8046ae:	50                   	push   %eax
+  8046af:	68 64 53 80 00       	push   $0x805364
+  8046b4:	e8 6e bf ff ff       	call   800627 <cprintf>
+		return r;
+  8046b9:	83 c4 10             	add    $0x10,%esp
+  8046bc:	e9 28 ff ff ff       	jmp    8045e9 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8046c1:	83 ec 08             	sub    $0x8,%esp
+  8046c4:	50                   	push   %eax
+  8046c5:	68 d9 53 80 00       	push   $0x8053d9
+  8046ca:	e8 58 bf ff ff       	call   800627 <cprintf>
+		return r;
+  8046cf:	83 c4 10             	add    $0x10,%esp
+  8046d2:	e9 12 ff ff ff       	jmp    8045e9 <sfork+0x163>
+  8046d7:	89 c7                	mov    %eax,%edi
+  8046d9:	e9 0b ff ff ff       	jmp    8045e9 <sfork+0x163>
+  8046de:	89 c7                	mov    %eax,%edi
+  8046e0:	e9 04 ff ff ff       	jmp    8045e9 <sfork+0x163>
+
+008046e5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8046e5:	55                   	push   %ebp
+  8046e6:	89 e5                	mov    %esp,%ebp
+  8046e8:	57                   	push   %edi
+  8046e9:	56                   	push   %esi
+  8046ea:	53                   	push   %ebx
+  8046eb:	83 ec 18             	sub    $0x18,%esp
+  8046ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8046f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8046f4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8046f7:	85 c0                	test   %eax,%eax
+  8046f9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8046fe:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804701:	50                   	push   %eax
+  804702:	e8 38 cb ff ff       	call   80123f <sys_ipc_recv>
+	if (r < 0) {
+  804707:	83 c4 10             	add    $0x10,%esp
+  80470a:	85 c0                	test   %eax,%eax
+  80470c:	78 2b                	js     804739 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80470e:	85 ff                	test   %edi,%edi
+  804710:	74 55                	je     804767 <ipc_recv+0x82>
+  804712:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804714:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80471a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80471f:	77 39                	ja     80475a <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804721:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804726:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804728:	c1 e8 10             	shr    $0x10,%eax
+  80472b:	74 2d                	je     80475a <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80472d:	c1 e0 10             	shl    $0x10,%eax
+  804730:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804735:	29 c2                	sub    %eax,%edx
+  804737:	eb 27                	jmp    804760 <ipc_recv+0x7b>
+  804739:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80473b:	83 ec 08             	sub    $0x8,%esp
+  80473e:	50                   	push   %eax
+  80473f:	68 f7 53 80 00       	push   $0x8053f7
+  804744:	e8 de be ff ff       	call   800627 <cprintf>
+		*from_env_store = 0;
+  804749:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80474f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804755:	83 c4 10             	add    $0x10,%esp
+  804758:	eb 77                	jmp    8047d1 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80475a:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804760:	8b 02                	mov    (%edx),%eax
+  804762:	8b 40 78             	mov    0x78(%eax),%eax
+  804765:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804767:	85 f6                	test   %esi,%esi
+  804769:	74 34                	je     80479f <ipc_recv+0xba>
+  80476b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80476d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804773:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804778:	77 18                	ja     804792 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80477a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80477f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804781:	c1 e8 10             	shr    $0x10,%eax
+  804784:	74 0c                	je     804792 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804786:	c1 e0 10             	shl    $0x10,%eax
+  804789:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80478e:	29 c2                	sub    %eax,%edx
+  804790:	eb 06                	jmp    804798 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804792:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804798:	8b 02                	mov    (%edx),%eax
+  80479a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80479d:	89 06                	mov    %eax,(%esi)
+  80479f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047a1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8047a7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8047ac:	77 18                	ja     8047c6 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047ae:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8047b3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8047b5:	c1 e8 10             	shr    $0x10,%eax
+  8047b8:	74 0c                	je     8047c6 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8047ba:	c1 e0 10             	shl    $0x10,%eax
+  8047bd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8047c2:	29 c2                	sub    %eax,%edx
+  8047c4:	eb 06                	jmp    8047cc <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8047c6:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8047cc:	8b 02                	mov    (%edx),%eax
+  8047ce:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8047d1:	89 d8                	mov    %ebx,%eax
+  8047d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047d6:	5b                   	pop    %ebx
+  8047d7:	5e                   	pop    %esi
+  8047d8:	5f                   	pop    %edi
+  8047d9:	5d                   	pop    %ebp
+  8047da:	c3                   	ret
+
+008047db <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8047db:	55                   	push   %ebp
+  8047dc:	89 e5                	mov    %esp,%ebp
+  8047de:	57                   	push   %edi
+  8047df:	56                   	push   %esi
+  8047e0:	53                   	push   %ebx
+  8047e1:	83 ec 0c             	sub    $0xc,%esp
+  8047e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8047e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8047ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8047ed:	85 db                	test   %ebx,%ebx
+  8047ef:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8047f4:	0f 44 d8             	cmove  %eax,%ebx
+  8047f7:	eb 05                	jmp    8047fe <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8047f9:	e8 1f c8 ff ff       	call   80101d <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8047fe:	57                   	push   %edi
+  8047ff:	53                   	push   %ebx
+  804800:	ff 75 0c             	push   0xc(%ebp)
+  804803:	56                   	push   %esi
+  804804:	e8 09 ca ff ff       	call   801212 <sys_ipc_try_send>
+		if (r == 0) {
+  804809:	83 c4 10             	add    $0x10,%esp
+  80480c:	85 c0                	test   %eax,%eax
+  80480e:	74 19                	je     804829 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804810:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804813:	74 e4                	je     8047f9 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804815:	83 ec 0c             	sub    $0xc,%esp
+  804818:	50                   	push   %eax
+  804819:	57                   	push   %edi
+  80481a:	53                   	push   %ebx
+  80481b:	56                   	push   %esi
+  80481c:	68 10 54 80 00       	push   $0x805410
+  804821:	e8 01 be ff ff       	call   800627 <cprintf>
+			return;
+  804826:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80482c:	5b                   	pop    %ebx
+  80482d:	5e                   	pop    %esi
+  80482e:	5f                   	pop    %edi
+  80482f:	5d                   	pop    %ebp
+  804830:	c3                   	ret
+
+00804831 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804831:	55                   	push   %ebp
+  804832:	89 e5                	mov    %esp,%ebp
+  804834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804837:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80483c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80483f:	c1 e0 04             	shl    $0x4,%eax
+  804842:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804847:	8b 40 50             	mov    0x50(%eax),%eax
+  80484a:	39 c8                	cmp    %ecx,%eax
+  80484c:	74 12                	je     804860 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80484e:	83 c2 01             	add    $0x1,%edx
+  804851:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804857:	75 e3                	jne    80483c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80485e:	eb 0e                	jmp    80486e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804860:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804863:	c1 e0 04             	shl    $0x4,%eax
+  804866:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80486b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80486e:	5d                   	pop    %ebp
+  80486f:	c3                   	ret
+
+00804870 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804870:	55                   	push   %ebp
+  804871:	89 e5                	mov    %esp,%ebp
+  804873:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804876:	89 c2                	mov    %eax,%edx
+  804878:	c1 ea 16             	shr    $0x16,%edx
+  80487b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804882:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804887:	f6 c1 01             	test   $0x1,%cl
+  80488a:	74 1c                	je     8048a8 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80488c:	c1 e8 0c             	shr    $0xc,%eax
+  80488f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804896:	a8 01                	test   $0x1,%al
+  804898:	74 0e                	je     8048a8 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80489a:	c1 e8 0c             	shr    $0xc,%eax
+  80489d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8048a4:	ef 
+  8048a5:	0f b7 d2             	movzwl %dx,%edx
+}
+  8048a8:	89 d0                	mov    %edx,%eax
+  8048aa:	5d                   	pop    %ebp
+  8048ab:	c3                   	ret
+
+008048ac <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8048ac:	55                   	push   %ebp
+  8048ad:	89 e5                	mov    %esp,%ebp
+  8048af:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8048b2:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8048b9:	74 0a                	je     8048c5 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8048bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048be:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8048c3:	c9                   	leave
+  8048c4:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8048c5:	83 ec 04             	sub    $0x4,%esp
+  8048c8:	6a 07                	push   $0x7
+  8048ca:	68 00 f0 bf ee       	push   $0xeebff000
+  8048cf:	6a 00                	push   $0x0
+  8048d1:	e8 73 c7 ff ff       	call   801049 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8048d6:	83 c4 08             	add    $0x8,%esp
+  8048d9:	68 ea 48 80 00       	push   $0x8048ea
+  8048de:	6a 00                	push   $0x0
+  8048e0:	e8 e1 c8 ff ff       	call   8011c6 <sys_env_set_pgfault_upcall>
+  8048e5:	83 c4 10             	add    $0x10,%esp
+  8048e8:	eb d1                	jmp    8048bb <set_pgfault_handler+0xf>
+
+008048ea <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048ea:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048eb:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8048f0:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8048f2:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8048f5:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8048f9:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8048fd:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804900:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804904:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804906:	83 c4 08             	add    $0x8,%esp
+	popal
+  804909:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80490a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80490d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80490e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80490f:	c3                   	ret
+
+00804910 <udm>:
+  804910:	57                   	push   %edi
+  804911:	56                   	push   %esi
+  804912:	53                   	push   %ebx
+  804913:	83 ec 20             	sub    $0x20,%esp
+  804916:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80491a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80491e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804922:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804926:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80492a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80492e:	89 d1                	mov    %edx,%ecx
+  804930:	09 c1                	or     %eax,%ecx
+  804932:	0f 84 91 00 00 00    	je     8049c9 <udm+0xb9>
+  804938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80493d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804942:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804947:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80494e:	00 
+  80494f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804956:	00 
+  804957:	eb 08                	jmp    804961 <udm+0x51>
+  804959:	83 e9 01             	sub    $0x1,%ecx
+  80495c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80495f:	74 7c                	je     8049dd <udm+0xcd>
+  804961:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804965:	01 c0                	add    %eax,%eax
+  804967:	89 c6                	mov    %eax,%esi
+  804969:	89 d7                	mov    %edx,%edi
+  80496b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80496f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804973:	0f ad d0             	shrd   %cl,%edx,%eax
+  804976:	d3 ea                	shr    %cl,%edx
+  804978:	f6 c1 20             	test   $0x20,%cl
+  80497b:	74 04                	je     804981 <udm+0x71>
+  80497d:	89 d0                	mov    %edx,%eax
+  80497f:	31 d2                	xor    %edx,%edx
+  804981:	83 e0 01             	and    $0x1,%eax
+  804984:	89 04 24             	mov    %eax,(%esp)
+  804987:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80498e:	00 
+  80498f:	8b 04 24             	mov    (%esp),%eax
+  804992:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804996:	09 f0                	or     %esi,%eax
+  804998:	09 fa                	or     %edi,%edx
+  80499a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80499e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8049a2:	39 f0                	cmp    %esi,%eax
+  8049a4:	89 d3                	mov    %edx,%ebx
+  8049a6:	19 fb                	sbb    %edi,%ebx
+  8049a8:	72 af                	jb     804959 <udm+0x49>
+  8049aa:	29 f0                	sub    %esi,%eax
+  8049ac:	19 fa                	sbb    %edi,%edx
+  8049ae:	89 cf                	mov    %ecx,%edi
+  8049b0:	c1 ef 05             	shr    $0x5,%edi
+  8049b3:	83 e7 01             	and    $0x1,%edi
+  8049b6:	89 fe                	mov    %edi,%esi
+  8049b8:	83 f6 01             	xor    $0x1,%esi
+  8049bb:	d3 e6                	shl    %cl,%esi
+  8049bd:	d3 e7                	shl    %cl,%edi
+  8049bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8049c3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8049c7:	eb 90                	jmp    804959 <udm+0x49>
+  8049c9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049cd:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8049d1:	89 f0                	mov    %esi,%eax
+  8049d3:	89 fa                	mov    %edi,%edx
+  8049d5:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8049d9:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8049dd:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8049e1:	89 01                	mov    %eax,(%ecx)
+  8049e3:	89 51 04             	mov    %edx,0x4(%ecx)
+  8049e6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8049ea:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8049ee:	83 c4 20             	add    $0x20,%esp
+  8049f1:	5b                   	pop    %ebx
+  8049f2:	5e                   	pop    %esi
+  8049f3:	5f                   	pop    %edi
+  8049f4:	c3                   	ret
+
+008049f5 <__udivdi3>:
+  8049f5:	83 ec 18             	sub    $0x18,%esp
+  8049f8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8049fc:	50                   	push   %eax
+  8049fd:	ff 74 24 2c          	push   0x2c(%esp)
+  804a01:	ff 74 24 2c          	push   0x2c(%esp)
+  804a05:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a09:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a0d:	e8 fe fe ff ff       	call   804910 <udm>
+  804a12:	83 c4 24             	add    $0x24,%esp
+  804a15:	c3                   	ret
+
+00804a16 <__umoddi3>:
+  804a16:	83 ec 18             	sub    $0x18,%esp
+  804a19:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804a1d:	50                   	push   %eax
+  804a1e:	ff 74 24 2c          	push   0x2c(%esp)
+  804a22:	ff 74 24 2c          	push   0x2c(%esp)
+  804a26:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a2a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a2e:	e8 dd fe ff ff       	call   804910 <udm>
+  804a33:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a37:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a3b:	83 c4 24             	add    $0x24,%esp
+  804a3e:	c3                   	ret
+
+00804a3f <__divdi3>:
+  804a3f:	56                   	push   %esi
+  804a40:	53                   	push   %ebx
+  804a41:	83 ec 14             	sub    $0x14,%esp
+  804a44:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804a48:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804a4c:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804a50:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804a54:	85 d2                	test   %edx,%edx
+  804a56:	78 18                	js     804a70 <__divdi3+0x31>
+  804a58:	85 db                	test   %ebx,%ebx
+  804a5a:	78 3e                	js     804a9a <__divdi3+0x5b>
+  804a5c:	83 ec 04             	sub    $0x4,%esp
+  804a5f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a63:	56                   	push   %esi
+  804a64:	53                   	push   %ebx
+  804a65:	51                   	push   %ecx
+  804a66:	e8 a5 fe ff ff       	call   804910 <udm>
+  804a6b:	83 c4 10             	add    $0x10,%esp
+  804a6e:	eb 24                	jmp    804a94 <__divdi3+0x55>
+  804a70:	f7 d8                	neg    %eax
+  804a72:	83 d2 00             	adc    $0x0,%edx
+  804a75:	f7 da                	neg    %edx
+  804a77:	85 db                	test   %ebx,%ebx
+  804a79:	78 3a                	js     804ab5 <__divdi3+0x76>
+  804a7b:	83 ec 04             	sub    $0x4,%esp
+  804a7e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a82:	56                   	push   %esi
+  804a83:	53                   	push   %ebx
+  804a84:	51                   	push   %ecx
+  804a85:	e8 86 fe ff ff       	call   804910 <udm>
+  804a8a:	83 c4 10             	add    $0x10,%esp
+  804a8d:	f7 d8                	neg    %eax
+  804a8f:	83 d2 00             	adc    $0x0,%edx
+  804a92:	f7 da                	neg    %edx
+  804a94:	83 c4 14             	add    $0x14,%esp
+  804a97:	5b                   	pop    %ebx
+  804a98:	5e                   	pop    %esi
+  804a99:	c3                   	ret
+  804a9a:	83 ec 04             	sub    $0x4,%esp
+  804a9d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804aa1:	56                   	push   %esi
+  804aa2:	f7 d9                	neg    %ecx
+  804aa4:	83 d3 00             	adc    $0x0,%ebx
+  804aa7:	f7 db                	neg    %ebx
+  804aa9:	53                   	push   %ebx
+  804aaa:	51                   	push   %ecx
+  804aab:	e8 60 fe ff ff       	call   804910 <udm>
+  804ab0:	83 c4 10             	add    $0x10,%esp
+  804ab3:	eb d8                	jmp    804a8d <__divdi3+0x4e>
+  804ab5:	83 ec 04             	sub    $0x4,%esp
+  804ab8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804abc:	56                   	push   %esi
+  804abd:	f7 d9                	neg    %ecx
+  804abf:	83 d3 00             	adc    $0x0,%ebx
+  804ac2:	f7 db                	neg    %ebx
+  804ac4:	53                   	push   %ebx
+  804ac5:	51                   	push   %ecx
+  804ac6:	e8 45 fe ff ff       	call   804910 <udm>
+  804acb:	83 c4 10             	add    $0x10,%esp
+  804ace:	eb c4                	jmp    804a94 <__divdi3+0x55>
+
+00804ad0 <__moddi3>:
+  804ad0:	55                   	push   %ebp
+  804ad1:	57                   	push   %edi
+  804ad2:	56                   	push   %esi
+  804ad3:	53                   	push   %ebx
+  804ad4:	83 ec 24             	sub    $0x24,%esp
+  804ad7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804adb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804adf:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804ae3:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804ae7:	85 d2                	test   %edx,%edx
+  804ae9:	78 3b                	js     804b26 <__moddi3+0x56>
+  804aeb:	83 ec 04             	sub    $0x4,%esp
+  804aee:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804af2:	56                   	push   %esi
+  804af3:	89 ce                	mov    %ecx,%esi
+  804af5:	f7 de                	neg    %esi
+  804af7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804afb:	89 de                	mov    %ebx,%esi
+  804afd:	83 d6 00             	adc    $0x0,%esi
+  804b00:	f7 de                	neg    %esi
+  804b02:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804b06:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804b0a:	0f 48 f1             	cmovs  %ecx,%esi
+  804b0d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804b12:	53                   	push   %ebx
+  804b13:	56                   	push   %esi
+  804b14:	e8 f7 fd ff ff       	call   804910 <udm>
+  804b19:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b1d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b21:	83 c4 10             	add    $0x10,%esp
+  804b24:	eb 47                	jmp    804b6d <__moddi3+0x9d>
+  804b26:	f7 d8                	neg    %eax
+  804b28:	83 d2 00             	adc    $0x0,%edx
+  804b2b:	f7 da                	neg    %edx
+  804b2d:	83 ec 04             	sub    $0x4,%esp
+  804b30:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804b34:	56                   	push   %esi
+  804b35:	89 cf                	mov    %ecx,%edi
+  804b37:	f7 df                	neg    %edi
+  804b39:	89 de                	mov    %ebx,%esi
+  804b3b:	83 d6 00             	adc    $0x0,%esi
+  804b3e:	f7 de                	neg    %esi
+  804b40:	0f 49 cf             	cmovns %edi,%ecx
+  804b43:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804b47:	0f 49 de             	cmovns %esi,%ebx
+  804b4a:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804b4e:	ff 74 24 0c          	push   0xc(%esp)
+  804b52:	ff 74 24 0c          	push   0xc(%esp)
+  804b56:	e8 b5 fd ff ff       	call   804910 <udm>
+  804b5b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b5f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b63:	f7 d8                	neg    %eax
+  804b65:	83 d2 00             	adc    $0x0,%edx
+  804b68:	f7 da                	neg    %edx
+  804b6a:	83 c4 10             	add    $0x10,%esp
+  804b6d:	83 c4 24             	add    $0x24,%esp
+  804b70:	5b                   	pop    %ebx
+  804b71:	5e                   	pop    %esi
+  804b72:	5f                   	pop    %edi
+  804b73:	5d                   	pop    %ebp
+  804b74:	c3                   	ret
@@ -0,0 +1,10284 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 04 00 00       	call   8004d7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 60 4b 80 00       	push   $0x804b60
+  80003f:	e8 cb 05 00 00       	call   80060f <cprintf>
+	exit();
+  800044:	e8 09 05 00 00       	call   800552 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+
+void umain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800057:	68 64 4b 80 00       	push   $0x804b64
+  80005c:	e8 ae 05 00 00       	call   80060f <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800061:	c7 04 24 74 4b 80 00 	movl   $0x804b74,(%esp)
+  800068:	e8 30 04 00 00       	call   80049d <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 74 4b 80 00       	push   $0x804b74
+  800076:	68 7e 4b 80 00       	push   $0x804b7e
+  80007b:	e8 8f 05 00 00       	call   80060f <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 20 2c 00 00       	call   802cae <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 b4 00 00 00    	js     800150 <umain+0x102>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 ab 4b 80 00       	push   $0x804bab
+  8000a4:	e8 66 05 00 00       	call   80060f <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 8b 0c 00 00       	call   800d44 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bd:	c7 04 24 74 4b 80 00 	movl   $0x804b74,(%esp)
+  8000c4:	e8 d4 03 00 00       	call   80049d <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 a7 01 00 00       	call   80027f <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000dc:	c7 04 24 ba 4b 80 00 	movl   $0x804bba,(%esp)
+  8000e3:	e8 27 05 00 00       	call   80060f <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 6f 2b 00 00       	call   802c65 <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 62                	js     80015f <umain+0x111>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 f5 4b 80 00       	push   $0x804bf5
+  800105:	e8 05 05 00 00       	call   80060f <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 60 80 00    	push   0x806000
+  800113:	e8 a0 0a 00 00       	call   800bb8 <strlen>
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 60 80 00    	push   0x806000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 a9 17 00 00       	call   8018d8 <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c7                	cmp    %eax,%edi
+  800134:	75 35                	jne    80016b <umain+0x11d>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 0a 4c 80 00       	push   $0x804c0a
+  80013e:	e8 cc 04 00 00       	call   80060f <cprintf>
+	while (received < echolen) {
+  800143:	83 c4 10             	add    $0x10,%esp
+	int received = 0;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  80014b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+	while (received < echolen) {
+  80014e:	eb 3a                	jmp    80018a <umain+0x13c>
+		die("Failed to create socket");
+  800150:	b8 93 4b 80 00       	mov    $0x804b93,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <die>
+  80015a:	e9 3d ff ff ff       	jmp    80009c <umain+0x4e>
+		die("Failed to connect with server");
+  80015f:	b8 d7 4b 80 00       	mov    $0x804bd7,%eax
+  800164:	e8 ca fe ff ff       	call   800033 <die>
+  800169:	eb 92                	jmp    8000fd <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  80016b:	b8 24 4c 80 00       	mov    $0x804c24,%eax
+  800170:	e8 be fe ff ff       	call   800033 <die>
+  800175:	eb bf                	jmp    800136 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  800177:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800179:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	57                   	push   %edi
+  800182:	e8 88 04 00 00       	call   80060f <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+	while (received < echolen) {
+  80018a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80018d:	39 c6                	cmp    %eax,%esi
+  80018f:	73 23                	jae    8001b4 <umain+0x166>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	6a 1f                	push   $0x1f
+  800196:	57                   	push   %edi
+  800197:	ff 75 b4             	push   -0x4c(%ebp)
+  80019a:	e8 41 16 00 00       	call   8017e0 <read>
+  80019f:	89 c3                	mov    %eax,%ebx
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f cf                	jg     800177 <umain+0x129>
+			die("Failed to receive bytes from server");
+  8001a8:	b8 48 4c 80 00       	mov    $0x804c48,%eax
+  8001ad:	e8 81 fe ff ff       	call   800033 <die>
+  8001b2:	eb c3                	jmp    800177 <umain+0x129>
+	}
+	cprintf("\n");
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	68 14 4c 80 00       	push   $0x804c14
+  8001bc:	e8 4e 04 00 00       	call   80060f <cprintf>
+
+	close(sock);
+  8001c1:	83 c4 04             	add    $0x4,%esp
+  8001c4:	ff 75 b4             	push   -0x4c(%ebp)
+  8001c7:	e8 d8 14 00 00       	call   8016a4 <close>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001e6:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8001e9:	b9 00 70 80 00       	mov    $0x807000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8001ee:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8001f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f6:	eb 31                	jmp    800229 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8001f8:	0f b6 c8             	movzbl %al,%ecx
+  8001fb:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800200:	88 0a                	mov    %cl,(%edx)
+  800202:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800205:	83 e8 01             	sub    $0x1,%eax
+  800208:	3c ff                	cmp    $0xff,%al
+  80020a:	75 ec                	jne    8001f8 <inet_ntoa+0x21>
+  80020c:	0f b6 db             	movzbl %bl,%ebx
+  80020f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800212:	01 d8                	add    %ebx,%eax
+  800214:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800216:	8d 40 01             	lea    0x1(%eax),%eax
+  800219:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80021c:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80021f:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	39 c7                	cmp    %eax,%edi
+  800227:	74 46                	je     80026f <inet_ntoa+0x98>
+  800229:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80022c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800231:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800234:	89 f0                	mov    %esi,%eax
+  800236:	f6 e2                	mul    %dl
+  800238:	66 c1 e8 0b          	shr    $0xb,%ax
+  80023c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80023f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800242:	01 c9                	add    %ecx,%ecx
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800248:	89 d7                	mov    %edx,%edi
+  80024a:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80024e:	89 d9                	mov    %ebx,%ecx
+  800250:	83 c3 01             	add    $0x1,%ebx
+  800253:	0f b6 c9             	movzbl %cl,%ecx
+  800256:	83 c0 30             	add    $0x30,%eax
+  800259:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80025d:	89 f8                	mov    %edi,%eax
+  80025f:	3c 09                	cmp    $0x9,%al
+  800261:	77 d1                	ja     800234 <inet_ntoa+0x5d>
+  800263:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800266:	88 17                	mov    %dl,(%edi)
+  800268:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80026b:	89 d8                	mov    %ebx,%eax
+  80026d:	eb 96                	jmp    800205 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80026f:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800272:	b8 00 70 80 00       	mov    $0x807000,%eax
+  800277:	83 c4 1c             	add    $0x1c,%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800282:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800286:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+
+0080028c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80028f:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800293:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80029f:	89 d0                	mov    %edx,%eax
+  8002a1:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002a4:	89 d1                	mov    %edx,%ecx
+  8002a6:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002a9:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	c1 e1 08             	shl    $0x8,%ecx
+  8002b0:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002b6:	09 c8                	or     %ecx,%eax
+  8002b8:	c1 ea 08             	shr    $0x8,%edx
+  8002bb:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002c1:	09 d0                	or     %edx,%eax
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <inet_aton>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 2c             	sub    $0x2c,%esp
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002d1:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002d4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002d7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002da:	e9 9b 00 00 00       	jmp    80037a <inet_aton+0xb5>
+      c = *++cp;
+  8002df:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002e3:	89 c1                	mov    %eax,%ecx
+  8002e5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8002e8:	80 f9 58             	cmp    $0x58,%cl
+  8002eb:	74 10                	je     8002fd <inet_aton+0x38>
+      c = *++cp;
+  8002ed:	83 c2 01             	add    $0x1,%edx
+  8002f0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8002f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8002f8:	e9 97 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        c = *++cp;
+  8002fd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800301:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800304:	bf 10 00 00 00       	mov    $0x10,%edi
+  800309:	e9 86 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80030e:	0f af d7             	imul   %edi,%edx
+  800311:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800315:	0f be 01             	movsbl (%ecx),%eax
+  800318:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  80031b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80031e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800321:	80 fb 09             	cmp    $0x9,%bl
+  800324:	76 e8                	jbe    80030e <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800326:	83 ff 10             	cmp    $0x10,%edi
+  800329:	75 2e                	jne    800359 <inet_aton+0x94>
+  80032b:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80032f:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800332:	83 e3 df             	and    $0xffffffdf,%ebx
+  800335:	83 eb 41             	sub    $0x41,%ebx
+  800338:	80 fb 05             	cmp    $0x5,%bl
+  80033b:	77 1c                	ja     800359 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80033d:	c1 e2 04             	shl    $0x4,%edx
+  800340:	83 c0 0a             	add    $0xa,%eax
+  800343:	89 f3                	mov    %esi,%ebx
+  800345:	80 fb 1a             	cmp    $0x1a,%bl
+  800348:	19 db                	sbb    %ebx,%ebx
+  80034a:	83 e3 20             	and    $0x20,%ebx
+  80034d:	83 c3 41             	add    $0x41,%ebx
+  800350:	29 d8                	sub    %ebx,%eax
+  800352:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800354:	0f be 01             	movsbl (%ecx),%eax
+  800357:	eb bf                	jmp    800318 <inet_aton+0x53>
+    if (c == '.') {
+  800359:	83 f8 2e             	cmp    $0x2e,%eax
+  80035c:	75 43                	jne    8003a1 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80035e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800361:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800364:	39 f0                	cmp    %esi,%eax
+  800366:	0f 84 22 01 00 00    	je     80048e <inet_aton+0x1c9>
+      *pp++ = val;
+  80036c:	83 c0 04             	add    $0x4,%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800375:	89 ca                	mov    %ecx,%edx
+  800377:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80037a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80037d:	80 f9 09             	cmp    $0x9,%cl
+  800380:	0f 87 01 01 00 00    	ja     800487 <inet_aton+0x1c2>
+    base = 10;
+  800386:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80038b:	83 f8 30             	cmp    $0x30,%eax
+  80038e:	0f 84 4b ff ff ff    	je     8002df <inet_aton+0x1a>
+  800394:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	e9 7a ff ff ff       	jmp    80031b <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003a1:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	74 2e                	je     8003dc <inet_aton+0x117>
+    return (0);
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	80 fa 1f             	cmp    $0x1f,%dl
+  8003b8:	0f 86 d5 00 00 00    	jbe    800493 <inet_aton+0x1ce>
+  8003be:	84 c0                	test   %al,%al
+  8003c0:	0f 88 cd 00 00 00    	js     800493 <inet_aton+0x1ce>
+  8003c6:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003c9:	83 f9 04             	cmp    $0x4,%ecx
+  8003cc:	76 0e                	jbe    8003dc <inet_aton+0x117>
+    return (0);
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003d3:	83 f8 20             	cmp    $0x20,%eax
+  8003d6:	0f 85 b7 00 00 00    	jne    800493 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003dc:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003df:	89 d8                	mov    %ebx,%eax
+  8003e1:	29 c8                	sub    %ecx,%eax
+  8003e3:	c1 f8 02             	sar    $0x2,%eax
+  8003e6:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8003e9:	83 f8 02             	cmp    $0x2,%eax
+  8003ec:	74 7a                	je     800468 <inet_aton+0x1a3>
+  8003ee:	83 f9 03             	cmp    $0x3,%ecx
+  8003f1:	7f 49                	jg     80043c <inet_aton+0x177>
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	0f 84 98 00 00 00    	je     800493 <inet_aton+0x1ce>
+  8003fb:	83 f9 02             	cmp    $0x2,%ecx
+  8003fe:	75 19                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800405:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80040b:	0f 87 82 00 00 00    	ja     800493 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800411:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800414:	c1 e0 18             	shl    $0x18,%eax
+  800417:	09 c6                	or     %eax,%esi
+  return (1);
+  800419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80041e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800422:	74 6f                	je     800493 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	56                   	push   %esi
+  800428:	e8 6c fe ff ff       	call   800299 <htonl>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800433:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800435:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80043a:	eb 57                	jmp    800493 <inet_aton+0x1ce>
+  switch (n) {
+  80043c:	83 f9 04             	cmp    $0x4,%ecx
+  80043f:	75 d8                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800441:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800446:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80044c:	77 45                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80044e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800451:	c1 e0 18             	shl    $0x18,%eax
+  800454:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800457:	c1 e1 10             	shl    $0x10,%ecx
+  80045a:	09 c8                	or     %ecx,%eax
+  80045c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80045f:	c1 e1 08             	shl    $0x8,%ecx
+  800462:	09 c8                	or     %ecx,%eax
+  800464:	09 c6                	or     %eax,%esi
+    break;
+  800466:	eb b1                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80046d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800473:	77 1e                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800475:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800478:	c1 e0 18             	shl    $0x18,%eax
+  80047b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80047e:	c1 e1 10             	shl    $0x10,%ecx
+  800481:	09 c8                	or     %ecx,%eax
+  800483:	09 c6                	or     %eax,%esi
+    break;
+  800485:	eb 92                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048c:	eb 05                	jmp    800493 <inet_aton+0x1ce>
+        return (0);
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800493:	89 c8                	mov    %ecx,%eax
+  800495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <inet_addr>:
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 16 fe ff ff       	call   8002c5 <inet_aton>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	75 02                	jne    8004bf <inet_addr+0x22>
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+    return (val.s_addr);
+  8004bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004c2:	eb f9                	jmp    8004bd <inet_addr+0x20>
+
+008004c4 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004ca:	ff 75 08             	push   0x8(%ebp)
+  8004cd:	e8 c7 fd ff ff       	call   800299 <htonl>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+008004d7 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	57                   	push   %edi
+  8004db:	56                   	push   %esi
+  8004dc:	53                   	push   %ebx
+  8004dd:	83 ec 1c             	sub    $0x1c,%esp
+  8004e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8004e6:	e8 ee 0a 00 00       	call   800fd9 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8004eb:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8004ee:	89 15 e0 72 80 00    	mov    %edx,0x8072e0
+	thisenv = &envs[ENVX(eid)];
+  8004f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004f9:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8004fb:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8004fd:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800503:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800508:	77 16                	ja     800520 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80050a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80050f:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800511:	c1 e8 10             	shr    $0x10,%eax
+  800514:	74 0a                	je     800520 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800516:	c1 e0 10             	shl    $0x10,%eax
+  800519:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80051e:	29 c2                	sub    %eax,%edx
+  800520:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800523:	c1 e0 04             	shl    $0x4,%eax
+  800526:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80052b:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80052d:	85 db                	test   %ebx,%ebx
+  80052f:	7e 07                	jle    800538 <libmain+0x61>
+		binaryname = argv[0];
+  800531:	8b 06                	mov    (%esi),%eax
+  800533:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// call user main routine
+	umain(argc, argv);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	56                   	push   %esi
+  80053c:	53                   	push   %ebx
+  80053d:	e8 0c fb ff ff       	call   80004e <umain>
+
+	// exit gracefully
+	exit();
+  800542:	e8 0b 00 00 00       	call   800552 <exit>
+}
+  800547:	83 c4 10             	add    $0x10,%esp
+  80054a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80054d:	5b                   	pop    %ebx
+  80054e:	5e                   	pop    %esi
+  80054f:	5f                   	pop    %edi
+  800550:	5d                   	pop    %ebp
+  800551:	c3                   	ret
+
+00800552 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800558:	6a 00                	push   $0x0
+  80055a:	e8 cf 20 00 00       	call   80262e <fflush>
+	pthread_kill_others();
+  80055f:	e8 3a 37 00 00       	call   803c9e <pthread_kill_others>
+	close_all();
+  800564:	e8 68 11 00 00       	call   8016d1 <close_all>
+	sys_env_destroy(0);
+  800569:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800570:	e8 19 0a 00 00       	call   800f8e <sys_env_destroy>
+}
+  800575:	83 c4 10             	add    $0x10,%esp
+  800578:	c9                   	leave
+  800579:	c3                   	ret
+
+0080057a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80057a:	55                   	push   %ebp
+  80057b:	89 e5                	mov    %esp,%ebp
+  80057d:	53                   	push   %ebx
+  80057e:	83 ec 04             	sub    $0x4,%esp
+  800581:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800584:	8b 13                	mov    (%ebx),%edx
+  800586:	8d 42 01             	lea    0x1(%edx),%eax
+  800589:	89 03                	mov    %eax,(%ebx)
+  80058b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80058e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800592:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800597:	74 09                	je     8005a2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800599:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80059d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005a0:	c9                   	leave
+  8005a1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	68 ff 00 00 00       	push   $0xff
+  8005aa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005ad:	50                   	push   %eax
+  8005ae:	e8 84 09 00 00       	call   800f37 <sys_cputs>
+		b->idx = 0;
+  8005b3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005b9:	83 c4 10             	add    $0x10,%esp
+  8005bc:	eb db                	jmp    800599 <putch+0x1f>
+
+008005be <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005be:	55                   	push   %ebp
+  8005bf:	89 e5                	mov    %esp,%ebp
+  8005c1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005c7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005ce:	00 00 00 
+	b.cnt = 0;
+  8005d1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005d8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005db:	ff 75 0c             	push   0xc(%ebp)
+  8005de:	ff 75 08             	push   0x8(%ebp)
+  8005e1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005e7:	50                   	push   %eax
+  8005e8:	68 7a 05 80 00       	push   $0x80057a
+  8005ed:	e8 14 01 00 00       	call   800706 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005f2:	83 c4 08             	add    $0x8,%esp
+  8005f5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005fb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800601:	50                   	push   %eax
+  800602:	e8 30 09 00 00       	call   800f37 <sys_cputs>
+
+	return b.cnt;
+}
+  800607:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80060d:	c9                   	leave
+  80060e:	c3                   	ret
+
+0080060f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+  800612:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800615:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800618:	50                   	push   %eax
+  800619:	ff 75 08             	push   0x8(%ebp)
+  80061c:	e8 9d ff ff ff       	call   8005be <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800621:	c9                   	leave
+  800622:	c3                   	ret
+
+00800623 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800623:	55                   	push   %ebp
+  800624:	89 e5                	mov    %esp,%ebp
+  800626:	57                   	push   %edi
+  800627:	56                   	push   %esi
+  800628:	53                   	push   %ebx
+  800629:	83 ec 1c             	sub    $0x1c,%esp
+  80062c:	89 c7                	mov    %eax,%edi
+  80062e:	89 d6                	mov    %edx,%esi
+  800630:	8b 45 08             	mov    0x8(%ebp),%eax
+  800633:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800636:	89 d1                	mov    %edx,%ecx
+  800638:	89 c2                	mov    %eax,%edx
+  80063a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80063d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800640:	8b 45 10             	mov    0x10(%ebp),%eax
+  800643:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800646:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800649:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800650:	39 c2                	cmp    %eax,%edx
+  800652:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800655:	72 3e                	jb     800695 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	ff 75 18             	push   0x18(%ebp)
+  80065d:	83 eb 01             	sub    $0x1,%ebx
+  800660:	53                   	push   %ebx
+  800661:	50                   	push   %eax
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	ff 75 e4             	push   -0x1c(%ebp)
+  800668:	ff 75 e0             	push   -0x20(%ebp)
+  80066b:	ff 75 dc             	push   -0x24(%ebp)
+  80066e:	ff 75 d8             	push   -0x28(%ebp)
+  800671:	e8 67 43 00 00       	call   8049dd <__udivdi3>
+  800676:	83 c4 18             	add    $0x18,%esp
+  800679:	52                   	push   %edx
+  80067a:	50                   	push   %eax
+  80067b:	89 f2                	mov    %esi,%edx
+  80067d:	89 f8                	mov    %edi,%eax
+  80067f:	e8 9f ff ff ff       	call   800623 <printnum>
+  800684:	83 c4 20             	add    $0x20,%esp
+  800687:	eb 13                	jmp    80069c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800689:	83 ec 08             	sub    $0x8,%esp
+  80068c:	56                   	push   %esi
+  80068d:	ff 75 18             	push   0x18(%ebp)
+  800690:	ff d7                	call   *%edi
+  800692:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800695:	83 eb 01             	sub    $0x1,%ebx
+  800698:	85 db                	test   %ebx,%ebx
+  80069a:	7f ed                	jg     800689 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80069c:	83 ec 08             	sub    $0x8,%esp
+  80069f:	56                   	push   %esi
+  8006a0:	83 ec 04             	sub    $0x4,%esp
+  8006a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8006a6:	ff 75 e0             	push   -0x20(%ebp)
+  8006a9:	ff 75 dc             	push   -0x24(%ebp)
+  8006ac:	ff 75 d8             	push   -0x28(%ebp)
+  8006af:	e8 4a 43 00 00       	call   8049fe <__umoddi3>
+  8006b4:	83 c4 14             	add    $0x14,%esp
+  8006b7:	0f be 80 76 4c 80 00 	movsbl 0x804c76(%eax),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff d7                	call   *%edi
+}
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c7:	5b                   	pop    %ebx
+  8006c8:	5e                   	pop    %esi
+  8006c9:	5f                   	pop    %edi
+  8006ca:	5d                   	pop    %ebp
+  8006cb:	c3                   	ret
+
+008006cc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006cc:	55                   	push   %ebp
+  8006cd:	89 e5                	mov    %esp,%ebp
+  8006cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006d2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006d6:	8b 10                	mov    (%eax),%edx
+  8006d8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006db:	73 0a                	jae    8006e7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006dd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006e0:	89 08                	mov    %ecx,(%eax)
+  8006e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e5:	88 02                	mov    %al,(%edx)
+}
+  8006e7:	5d                   	pop    %ebp
+  8006e8:	c3                   	ret
+
+008006e9 <printfmt>:
+{
+  8006e9:	55                   	push   %ebp
+  8006ea:	89 e5                	mov    %esp,%ebp
+  8006ec:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006ef:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006f2:	50                   	push   %eax
+  8006f3:	ff 75 10             	push   0x10(%ebp)
+  8006f6:	ff 75 0c             	push   0xc(%ebp)
+  8006f9:	ff 75 08             	push   0x8(%ebp)
+  8006fc:	e8 05 00 00 00       	call   800706 <vprintfmt>
+}
+  800701:	83 c4 10             	add    $0x10,%esp
+  800704:	c9                   	leave
+  800705:	c3                   	ret
+
+00800706 <vprintfmt>:
+{
+  800706:	55                   	push   %ebp
+  800707:	89 e5                	mov    %esp,%ebp
+  800709:	57                   	push   %edi
+  80070a:	56                   	push   %esi
+  80070b:	53                   	push   %ebx
+  80070c:	83 ec 2c             	sub    $0x2c,%esp
+  80070f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800712:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800715:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800718:	eb 0a                	jmp    800724 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80071a:	83 ec 08             	sub    $0x8,%esp
+  80071d:	53                   	push   %ebx
+  80071e:	50                   	push   %eax
+  80071f:	ff d6                	call   *%esi
+  800721:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800724:	83 c7 01             	add    $0x1,%edi
+  800727:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80072b:	83 f8 25             	cmp    $0x25,%eax
+  80072e:	74 0c                	je     80073c <vprintfmt+0x36>
+			if (ch == '\0')
+  800730:	85 c0                	test   %eax,%eax
+  800732:	75 e6                	jne    80071a <vprintfmt+0x14>
+}
+  800734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800737:	5b                   	pop    %ebx
+  800738:	5e                   	pop    %esi
+  800739:	5f                   	pop    %edi
+  80073a:	5d                   	pop    %ebp
+  80073b:	c3                   	ret
+		padc = ' ';
+  80073c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800740:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800747:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80074e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80075a:	8d 47 01             	lea    0x1(%edi),%eax
+  80075d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800760:	0f b6 17             	movzbl (%edi),%edx
+  800763:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800766:	3c 55                	cmp    $0x55,%al
+  800768:	0f 87 c5 03 00 00    	ja     800b33 <vprintfmt+0x42d>
+  80076e:	0f b6 c0             	movzbl %al,%eax
+  800771:	ff 24 85 00 4e 80 00 	jmp    *0x804e00(,%eax,4)
+  800778:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80077b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80077e:	eb da                	jmp    80075a <vprintfmt+0x54>
+  800780:	0f be d2             	movsbl %dl,%edx
+  800783:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80078e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800791:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800795:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800798:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80079b:	83 f9 09             	cmp    $0x9,%ecx
+  80079e:	77 55                	ja     8007f5 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8007a0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8007a3:	eb e9                	jmp    80078e <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8007a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a8:	8b 00                	mov    (%eax),%eax
+  8007aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8007b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8007b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007bd:	79 9b                	jns    80075a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007cc:	eb 8c                	jmp    80075a <vprintfmt+0x54>
+			if (width < 0)
+  8007ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d8:	0f 49 c2             	cmovns %edx,%eax
+  8007db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8007de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007e1:	e9 74 ff ff ff       	jmp    80075a <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8007e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007f0:	e9 65 ff ff ff       	jmp    80075a <vprintfmt+0x54>
+  8007f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007fb:	eb bc                	jmp    8007b9 <vprintfmt+0xb3>
+			lflag++;
+  8007fd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800800:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800803:	e9 52 ff ff ff       	jmp    80075a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8d 78 04             	lea    0x4(%eax),%edi
+  80080e:	83 ec 08             	sub    $0x8,%esp
+  800811:	53                   	push   %ebx
+  800812:	ff 30                	push   (%eax)
+  800814:	ff d6                	call   *%esi
+			break;
+  800816:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800819:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80081c:	e9 b1 02 00 00       	jmp    800ad2 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	89 d0                	mov    %edx,%eax
+  80082b:	f7 d8                	neg    %eax
+  80082d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800830:	83 f8 14             	cmp    $0x14,%eax
+  800833:	7f 23                	jg     800858 <vprintfmt+0x152>
+  800835:	8b 14 85 60 4f 80 00 	mov    0x804f60(,%eax,4),%edx
+  80083c:	85 d2                	test   %edx,%edx
+  80083e:	74 18                	je     800858 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800840:	52                   	push   %edx
+  800841:	68 cf 50 80 00       	push   $0x8050cf
+  800846:	53                   	push   %ebx
+  800847:	56                   	push   %esi
+  800848:	e8 9c fe ff ff       	call   8006e9 <printfmt>
+  80084d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800850:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800853:	e9 7a 02 00 00       	jmp    800ad2 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800858:	50                   	push   %eax
+  800859:	68 8e 4c 80 00       	push   $0x804c8e
+  80085e:	53                   	push   %ebx
+  80085f:	56                   	push   %esi
+  800860:	e8 84 fe ff ff       	call   8006e9 <printfmt>
+  800865:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800868:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80086b:	e9 62 02 00 00       	jmp    800ad2 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800870:	8b 45 14             	mov    0x14(%ebp),%eax
+  800873:	83 c0 04             	add    $0x4,%eax
+  800876:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80087e:	85 c9                	test   %ecx,%ecx
+  800880:	b8 87 4c 80 00       	mov    $0x804c87,%eax
+  800885:	0f 45 c1             	cmovne %ecx,%eax
+  800888:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80088b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80088f:	7e 06                	jle    800897 <vprintfmt+0x191>
+  800891:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800895:	75 0b                	jne    8008a2 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800897:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80089a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80089d:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008a0:	eb 5c                	jmp    8008fe <vprintfmt+0x1f8>
+  8008a2:	83 ec 08             	sub    $0x8,%esp
+  8008a5:	ff 75 d0             	push   -0x30(%ebp)
+  8008a8:	ff 75 cc             	push   -0x34(%ebp)
+  8008ab:	e8 20 03 00 00       	call   800bd0 <strnlen>
+  8008b0:	89 c2                	mov    %eax,%edx
+  8008b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b5:	29 d0                	sub    %edx,%eax
+  8008b7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8008ba:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008c4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008c6:	eb 0e                	jmp    8008d6 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8008c8:	83 ec 08             	sub    $0x8,%esp
+  8008cb:	53                   	push   %ebx
+  8008cc:	57                   	push   %edi
+  8008cd:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008d0:	83 ee 01             	sub    $0x1,%esi
+  8008d3:	83 c4 10             	add    $0x10,%esp
+  8008d6:	85 f6                	test   %esi,%esi
+  8008d8:	7f ee                	jg     8008c8 <vprintfmt+0x1c2>
+  8008da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e0:	85 c0                	test   %eax,%eax
+  8008e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e7:	0f 49 d0             	cmovns %eax,%edx
+  8008ea:	29 d0                	sub    %edx,%eax
+  8008ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ef:	eb a6                	jmp    800897 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8008f1:	83 ec 08             	sub    $0x8,%esp
+  8008f4:	53                   	push   %ebx
+  8008f5:	52                   	push   %edx
+  8008f6:	ff 55 08             	call   *0x8(%ebp)
+  8008f9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008fc:	89 f1                	mov    %esi,%ecx
+  8008fe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800901:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800905:	0f be d0             	movsbl %al,%edx
+  800908:	85 d2                	test   %edx,%edx
+  80090a:	74 28                	je     800934 <vprintfmt+0x22e>
+  80090c:	85 ff                	test   %edi,%edi
+  80090e:	78 05                	js     800915 <vprintfmt+0x20f>
+  800910:	83 ef 01             	sub    $0x1,%edi
+  800913:	78 30                	js     800945 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800915:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800919:	74 d6                	je     8008f1 <vprintfmt+0x1eb>
+  80091b:	0f be c0             	movsbl %al,%eax
+  80091e:	83 e8 20             	sub    $0x20,%eax
+  800921:	83 f8 5e             	cmp    $0x5e,%eax
+  800924:	76 cb                	jbe    8008f1 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800926:	83 ec 08             	sub    $0x8,%esp
+  800929:	53                   	push   %ebx
+  80092a:	6a 3f                	push   $0x3f
+  80092c:	ff 55 08             	call   *0x8(%ebp)
+  80092f:	83 c4 10             	add    $0x10,%esp
+  800932:	eb c8                	jmp    8008fc <vprintfmt+0x1f6>
+  800934:	8b 75 08             	mov    0x8(%ebp),%esi
+  800937:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80093a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80093d:	01 d0                	add    %edx,%eax
+  80093f:	29 c8                	sub    %ecx,%eax
+  800941:	89 c7                	mov    %eax,%edi
+  800943:	eb 13                	jmp    800958 <vprintfmt+0x252>
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	eb ed                	jmp    800937 <vprintfmt+0x231>
+				putch(' ', putdat);
+  80094a:	83 ec 08             	sub    $0x8,%esp
+  80094d:	53                   	push   %ebx
+  80094e:	6a 20                	push   $0x20
+  800950:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800952:	83 ef 01             	sub    $0x1,%edi
+  800955:	83 c4 10             	add    $0x10,%esp
+  800958:	85 ff                	test   %edi,%edi
+  80095a:	7f ee                	jg     80094a <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80095c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80095f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800962:	e9 6b 01 00 00       	jmp    800ad2 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800967:	83 f9 01             	cmp    $0x1,%ecx
+  80096a:	7f 1f                	jg     80098b <vprintfmt+0x285>
+	else if (lflag)
+  80096c:	85 c9                	test   %ecx,%ecx
+  80096e:	74 67                	je     8009d7 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800970:	8b 45 14             	mov    0x14(%ebp),%eax
+  800973:	8b 00                	mov    (%eax),%eax
+  800975:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800978:	89 c1                	mov    %eax,%ecx
+  80097a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80097d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800980:	8b 45 14             	mov    0x14(%ebp),%eax
+  800983:	8d 40 04             	lea    0x4(%eax),%eax
+  800986:	89 45 14             	mov    %eax,0x14(%ebp)
+  800989:	eb 17                	jmp    8009a2 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80098b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098e:	8b 50 04             	mov    0x4(%eax),%edx
+  800991:	8b 00                	mov    (%eax),%eax
+  800993:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800996:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8d 40 08             	lea    0x8(%eax),%eax
+  80099f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8009a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8009a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8009ad:	85 c9                	test   %ecx,%ecx
+  8009af:	0f 89 03 01 00 00    	jns    800ab8 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8009b5:	83 ec 08             	sub    $0x8,%esp
+  8009b8:	53                   	push   %ebx
+  8009b9:	6a 2d                	push   $0x2d
+  8009bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8009bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009c3:	f7 da                	neg    %edx
+  8009c5:	83 d1 00             	adc    $0x0,%ecx
+  8009c8:	f7 d9                	neg    %ecx
+  8009ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009d2:	e9 e1 00 00 00       	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8009d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009da:	8b 00                	mov    (%eax),%eax
+  8009dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009df:	89 c1                	mov    %eax,%ecx
+  8009e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009f0:	eb b0                	jmp    8009a2 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8009f2:	83 f9 01             	cmp    $0x1,%ecx
+  8009f5:	7f 1e                	jg     800a15 <vprintfmt+0x30f>
+	else if (lflag)
+  8009f7:	85 c9                	test   %ecx,%ecx
+  8009f9:	74 32                	je     800a2d <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8009fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fe:	8b 10                	mov    (%eax),%edx
+  800a00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a05:	8d 40 04             	lea    0x4(%eax),%eax
+  800a08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a0b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800a10:	e9 a3 00 00 00       	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a18:	8b 10                	mov    (%eax),%edx
+  800a1a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a1d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a23:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a28:	e9 8b 00 00 00       	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a30:	8b 10                	mov    (%eax),%edx
+  800a32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a37:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a3d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a42:	eb 74                	jmp    800ab8 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800a44:	83 f9 01             	cmp    $0x1,%ecx
+  800a47:	7f 1b                	jg     800a64 <vprintfmt+0x35e>
+	else if (lflag)
+  800a49:	85 c9                	test   %ecx,%ecx
+  800a4b:	74 2c                	je     800a79 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a50:	8b 10                	mov    (%eax),%edx
+  800a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a57:	8d 40 04             	lea    0x4(%eax),%eax
+  800a5a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a5d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a62:	eb 54                	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a67:	8b 10                	mov    (%eax),%edx
+  800a69:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a6c:	8d 40 08             	lea    0x8(%eax),%eax
+  800a6f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a72:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a77:	eb 3f                	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a79:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7c:	8b 10                	mov    (%eax),%edx
+  800a7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a83:	8d 40 04             	lea    0x4(%eax),%eax
+  800a86:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a89:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a8e:	eb 28                	jmp    800ab8 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800a90:	83 ec 08             	sub    $0x8,%esp
+  800a93:	53                   	push   %ebx
+  800a94:	6a 30                	push   $0x30
+  800a96:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a98:	83 c4 08             	add    $0x8,%esp
+  800a9b:	53                   	push   %ebx
+  800a9c:	6a 78                	push   $0x78
+  800a9e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800aa0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa3:	8b 10                	mov    (%eax),%edx
+  800aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800aaa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800aad:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800ab8:	83 ec 0c             	sub    $0xc,%esp
+  800abb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800abf:	50                   	push   %eax
+  800ac0:	ff 75 e0             	push   -0x20(%ebp)
+  800ac3:	57                   	push   %edi
+  800ac4:	51                   	push   %ecx
+  800ac5:	52                   	push   %edx
+  800ac6:	89 da                	mov    %ebx,%edx
+  800ac8:	89 f0                	mov    %esi,%eax
+  800aca:	e8 54 fb ff ff       	call   800623 <printnum>
+			break;
+  800acf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ad2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800ad5:	e9 4a fc ff ff       	jmp    800724 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800ada:	83 f9 01             	cmp    $0x1,%ecx
+  800add:	7f 1b                	jg     800afa <vprintfmt+0x3f4>
+	else if (lflag)
+  800adf:	85 c9                	test   %ecx,%ecx
+  800ae1:	74 2c                	je     800b0f <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800ae3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae6:	8b 10                	mov    (%eax),%edx
+  800ae8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aed:	8d 40 04             	lea    0x4(%eax),%eax
+  800af0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800af3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800af8:	eb be                	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afd:	8b 10                	mov    (%eax),%edx
+  800aff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b02:	8d 40 08             	lea    0x8(%eax),%eax
+  800b05:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b08:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800b0d:	eb a9                	jmp    800ab8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800b0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b12:	8b 10                	mov    (%eax),%edx
+  800b14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b19:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b1f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b24:	eb 92                	jmp    800ab8 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800b26:	83 ec 08             	sub    $0x8,%esp
+  800b29:	53                   	push   %ebx
+  800b2a:	6a 25                	push   $0x25
+  800b2c:	ff d6                	call   *%esi
+			break;
+  800b2e:	83 c4 10             	add    $0x10,%esp
+  800b31:	eb 9f                	jmp    800ad2 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800b33:	83 ec 08             	sub    $0x8,%esp
+  800b36:	53                   	push   %ebx
+  800b37:	6a 25                	push   $0x25
+  800b39:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b3b:	83 c4 10             	add    $0x10,%esp
+  800b3e:	89 f8                	mov    %edi,%eax
+  800b40:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b44:	74 05                	je     800b4b <vprintfmt+0x445>
+  800b46:	83 e8 01             	sub    $0x1,%eax
+  800b49:	eb f5                	jmp    800b40 <vprintfmt+0x43a>
+  800b4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b4e:	eb 82                	jmp    800ad2 <vprintfmt+0x3cc>
+
+00800b50 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	83 ec 18             	sub    $0x18,%esp
+  800b56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b59:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b5c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b5f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b63:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b66:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b6d:	85 c0                	test   %eax,%eax
+  800b6f:	74 26                	je     800b97 <vsnprintf+0x47>
+  800b71:	85 d2                	test   %edx,%edx
+  800b73:	7e 22                	jle    800b97 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b75:	ff 75 14             	push   0x14(%ebp)
+  800b78:	ff 75 10             	push   0x10(%ebp)
+  800b7b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b7e:	50                   	push   %eax
+  800b7f:	68 cc 06 80 00       	push   $0x8006cc
+  800b84:	e8 7d fb ff ff       	call   800706 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b89:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b8c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b92:	83 c4 10             	add    $0x10,%esp
+}
+  800b95:	c9                   	leave
+  800b96:	c3                   	ret
+		return -E_INVAL;
+  800b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b9c:	eb f7                	jmp    800b95 <vsnprintf+0x45>
+
+00800b9e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ba4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ba7:	50                   	push   %eax
+  800ba8:	ff 75 10             	push   0x10(%ebp)
+  800bab:	ff 75 0c             	push   0xc(%ebp)
+  800bae:	ff 75 08             	push   0x8(%ebp)
+  800bb1:	e8 9a ff ff ff       	call   800b50 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bb6:	c9                   	leave
+  800bb7:	c3                   	ret
+
+00800bb8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc3:	eb 03                	jmp    800bc8 <strlen+0x10>
+		n++;
+  800bc5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bc8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bcc:	75 f7                	jne    800bc5 <strlen+0xd>
+	return n;
+}
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+
+00800bd0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bde:	eb 03                	jmp    800be3 <strnlen+0x13>
+		n++;
+  800be0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be3:	39 d0                	cmp    %edx,%eax
+  800be5:	74 08                	je     800bef <strnlen+0x1f>
+  800be7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800beb:	75 f3                	jne    800be0 <strnlen+0x10>
+  800bed:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bef:	89 d0                	mov    %edx,%eax
+  800bf1:	5d                   	pop    %ebp
+  800bf2:	c3                   	ret
+
+00800bf3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	53                   	push   %ebx
+  800bf7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c02:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c06:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c09:	83 c0 01             	add    $0x1,%eax
+  800c0c:	84 d2                	test   %dl,%dl
+  800c0e:	75 f2                	jne    800c02 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c10:	89 c8                	mov    %ecx,%eax
+  800c12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c15:	c9                   	leave
+  800c16:	c3                   	ret
+
+00800c17 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	53                   	push   %ebx
+  800c1b:	83 ec 10             	sub    $0x10,%esp
+  800c1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c21:	53                   	push   %ebx
+  800c22:	e8 91 ff ff ff       	call   800bb8 <strlen>
+  800c27:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c2a:	ff 75 0c             	push   0xc(%ebp)
+  800c2d:	01 d8                	add    %ebx,%eax
+  800c2f:	50                   	push   %eax
+  800c30:	e8 be ff ff ff       	call   800bf3 <strcpy>
+	return dst;
+}
+  800c35:	89 d8                	mov    %ebx,%eax
+  800c37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c3a:	c9                   	leave
+  800c3b:	c3                   	ret
+
+00800c3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	56                   	push   %esi
+  800c40:	53                   	push   %ebx
+  800c41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c47:	89 f3                	mov    %esi,%ebx
+  800c49:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c4c:	89 f0                	mov    %esi,%eax
+  800c4e:	eb 0f                	jmp    800c5f <strncpy+0x23>
+		*dst++ = *src;
+  800c50:	83 c0 01             	add    $0x1,%eax
+  800c53:	0f b6 0a             	movzbl (%edx),%ecx
+  800c56:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c59:	80 f9 01             	cmp    $0x1,%cl
+  800c5c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c5f:	39 d8                	cmp    %ebx,%eax
+  800c61:	75 ed                	jne    800c50 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c63:	89 f0                	mov    %esi,%eax
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5d                   	pop    %ebp
+  800c68:	c3                   	ret
+
+00800c69 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	56                   	push   %esi
+  800c6d:	53                   	push   %ebx
+  800c6e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c74:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c77:	89 f0                	mov    %esi,%eax
+  800c79:	85 d2                	test   %edx,%edx
+  800c7b:	74 21                	je     800c9e <strlcpy+0x35>
+  800c7d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c81:	89 f2                	mov    %esi,%edx
+  800c83:	eb 09                	jmp    800c8e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c85:	83 c1 01             	add    $0x1,%ecx
+  800c88:	83 c2 01             	add    $0x1,%edx
+  800c8b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c8e:	39 c2                	cmp    %eax,%edx
+  800c90:	74 09                	je     800c9b <strlcpy+0x32>
+  800c92:	0f b6 19             	movzbl (%ecx),%ebx
+  800c95:	84 db                	test   %bl,%bl
+  800c97:	75 ec                	jne    800c85 <strlcpy+0x1c>
+  800c99:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c9b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c9e:	29 f0                	sub    %esi,%eax
+}
+  800ca0:	5b                   	pop    %ebx
+  800ca1:	5e                   	pop    %esi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+
+00800ca4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800caa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cad:	eb 06                	jmp    800cb5 <strcmp+0x11>
+		p++, q++;
+  800caf:	83 c1 01             	add    $0x1,%ecx
+  800cb2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cb5:	0f b6 01             	movzbl (%ecx),%eax
+  800cb8:	84 c0                	test   %al,%al
+  800cba:	74 04                	je     800cc0 <strcmp+0x1c>
+  800cbc:	3a 02                	cmp    (%edx),%al
+  800cbe:	74 ef                	je     800caf <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cc0:	0f b6 c0             	movzbl %al,%eax
+  800cc3:	0f b6 12             	movzbl (%edx),%edx
+  800cc6:	29 d0                	sub    %edx,%eax
+}
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	53                   	push   %ebx
+  800cce:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cd7:	eb 09                	jmp    800ce2 <strncmp+0x18>
+		n--, p++, q++;
+  800cd9:	83 ea 01             	sub    $0x1,%edx
+  800cdc:	83 c0 01             	add    $0x1,%eax
+  800cdf:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ce2:	85 d2                	test   %edx,%edx
+  800ce4:	74 18                	je     800cfe <strncmp+0x34>
+  800ce6:	0f b6 18             	movzbl (%eax),%ebx
+  800ce9:	84 db                	test   %bl,%bl
+  800ceb:	74 04                	je     800cf1 <strncmp+0x27>
+  800ced:	3a 19                	cmp    (%ecx),%bl
+  800cef:	74 e8                	je     800cd9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cf1:	0f b6 00             	movzbl (%eax),%eax
+  800cf4:	0f b6 11             	movzbl (%ecx),%edx
+  800cf7:	29 d0                	sub    %edx,%eax
+}
+  800cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfc:	c9                   	leave
+  800cfd:	c3                   	ret
+		return 0;
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	eb f4                	jmp    800cf9 <strncmp+0x2f>
+
+00800d05 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d0f:	eb 03                	jmp    800d14 <strchr+0xf>
+  800d11:	83 c0 01             	add    $0x1,%eax
+  800d14:	0f b6 10             	movzbl (%eax),%edx
+  800d17:	84 d2                	test   %dl,%dl
+  800d19:	74 06                	je     800d21 <strchr+0x1c>
+		if (*s == c)
+  800d1b:	38 ca                	cmp    %cl,%dl
+  800d1d:	75 f2                	jne    800d11 <strchr+0xc>
+  800d1f:	eb 05                	jmp    800d26 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d26:	5d                   	pop    %ebp
+  800d27:	c3                   	ret
+
+00800d28 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d32:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d35:	38 ca                	cmp    %cl,%dl
+  800d37:	74 09                	je     800d42 <strfind+0x1a>
+  800d39:	84 d2                	test   %dl,%dl
+  800d3b:	74 05                	je     800d42 <strfind+0x1a>
+	for (; *s; s++)
+  800d3d:	83 c0 01             	add    $0x1,%eax
+  800d40:	eb f0                	jmp    800d32 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+
+00800d44 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	57                   	push   %edi
+  800d48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d4e:	85 c9                	test   %ecx,%ecx
+  800d50:	74 20                	je     800d72 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d52:	89 f8                	mov    %edi,%eax
+  800d54:	09 c8                	or     %ecx,%eax
+  800d56:	a8 03                	test   $0x3,%al
+  800d58:	75 12                	jne    800d6c <memset+0x28>
+		c &= 0xFF;
+  800d5a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d5e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d64:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d67:	fc                   	cld
+  800d68:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d6a:	eb 06                	jmp    800d72 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d6f:	fc                   	cld
+  800d70:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d72:	89 f8                	mov    %edi,%eax
+  800d74:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d77:	c9                   	leave
+  800d78:	c3                   	ret
+
+00800d79 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d84:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d87:	39 c6                	cmp    %eax,%esi
+  800d89:	73 32                	jae    800dbd <memmove+0x44>
+  800d8b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d8e:	39 d0                	cmp    %edx,%eax
+  800d90:	73 2b                	jae    800dbd <memmove+0x44>
+		s += n;
+		d += n;
+  800d92:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d95:	89 d6                	mov    %edx,%esi
+  800d97:	09 fe                	or     %edi,%esi
+  800d99:	09 ce                	or     %ecx,%esi
+  800d9b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800da1:	75 0e                	jne    800db1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800da3:	83 ef 04             	sub    $0x4,%edi
+  800da6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800da9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800dac:	fd                   	std
+  800dad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800daf:	eb 09                	jmp    800dba <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800db1:	83 ef 01             	sub    $0x1,%edi
+  800db4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800db7:	fd                   	std
+  800db8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dba:	fc                   	cld
+  800dbb:	eb 1a                	jmp    800dd7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dbd:	89 f2                	mov    %esi,%edx
+  800dbf:	09 c2                	or     %eax,%edx
+  800dc1:	09 ca                	or     %ecx,%edx
+  800dc3:	f6 c2 03             	test   $0x3,%dl
+  800dc6:	75 0a                	jne    800dd2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dc8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dcb:	89 c7                	mov    %eax,%edi
+  800dcd:	fc                   	cld
+  800dce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dd0:	eb 05                	jmp    800dd7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dd2:	89 c7                	mov    %eax,%edi
+  800dd4:	fc                   	cld
+  800dd5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+
+00800ddb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800de1:	ff 75 10             	push   0x10(%ebp)
+  800de4:	ff 75 0c             	push   0xc(%ebp)
+  800de7:	ff 75 08             	push   0x8(%ebp)
+  800dea:	e8 8a ff ff ff       	call   800d79 <memmove>
+}
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+00800df1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dfc:	89 c6                	mov    %eax,%esi
+  800dfe:	03 75 10             	add    0x10(%ebp),%esi
+  800e01:	eb 06                	jmp    800e09 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e03:	83 c0 01             	add    $0x1,%eax
+  800e06:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e09:	39 f0                	cmp    %esi,%eax
+  800e0b:	74 14                	je     800e21 <memcmp+0x30>
+		if (*s1 != *s2)
+  800e0d:	0f b6 08             	movzbl (%eax),%ecx
+  800e10:	0f b6 1a             	movzbl (%edx),%ebx
+  800e13:	38 d9                	cmp    %bl,%cl
+  800e15:	74 ec                	je     800e03 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e17:	0f b6 c1             	movzbl %cl,%eax
+  800e1a:	0f b6 db             	movzbl %bl,%ebx
+  800e1d:	29 d8                	sub    %ebx,%eax
+  800e1f:	eb 05                	jmp    800e26 <memcmp+0x35>
+	}
+
+	return 0;
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+
+00800e2a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e33:	89 c2                	mov    %eax,%edx
+  800e35:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e38:	eb 03                	jmp    800e3d <memfind+0x13>
+  800e3a:	83 c0 01             	add    $0x1,%eax
+  800e3d:	39 d0                	cmp    %edx,%eax
+  800e3f:	73 04                	jae    800e45 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e41:	38 08                	cmp    %cl,(%eax)
+  800e43:	75 f5                	jne    800e3a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+
+00800e47 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e53:	eb 03                	jmp    800e58 <strtol+0x11>
+		s++;
+  800e55:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e58:	0f b6 02             	movzbl (%edx),%eax
+  800e5b:	3c 20                	cmp    $0x20,%al
+  800e5d:	74 f6                	je     800e55 <strtol+0xe>
+  800e5f:	3c 09                	cmp    $0x9,%al
+  800e61:	74 f2                	je     800e55 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e63:	3c 2b                	cmp    $0x2b,%al
+  800e65:	74 2a                	je     800e91 <strtol+0x4a>
+	int neg = 0;
+  800e67:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e6c:	3c 2d                	cmp    $0x2d,%al
+  800e6e:	74 2b                	je     800e9b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e70:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e76:	75 0f                	jne    800e87 <strtol+0x40>
+  800e78:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e7b:	74 28                	je     800ea5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e7d:	85 db                	test   %ebx,%ebx
+  800e7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e84:	0f 44 d8             	cmove  %eax,%ebx
+  800e87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e8f:	eb 46                	jmp    800ed7 <strtol+0x90>
+		s++;
+  800e91:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e99:	eb d5                	jmp    800e70 <strtol+0x29>
+		s++, neg = 1;
+  800e9b:	83 c2 01             	add    $0x1,%edx
+  800e9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ea3:	eb cb                	jmp    800e70 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ea5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ea9:	74 0e                	je     800eb9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800eab:	85 db                	test   %ebx,%ebx
+  800ead:	75 d8                	jne    800e87 <strtol+0x40>
+		s++, base = 8;
+  800eaf:	83 c2 01             	add    $0x1,%edx
+  800eb2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800eb7:	eb ce                	jmp    800e87 <strtol+0x40>
+		s += 2, base = 16;
+  800eb9:	83 c2 02             	add    $0x2,%edx
+  800ebc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ec1:	eb c4                	jmp    800e87 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ec3:	0f be c0             	movsbl %al,%eax
+  800ec6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ec9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ecc:	7d 3a                	jge    800f08 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ece:	83 c2 01             	add    $0x1,%edx
+  800ed1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ed5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ed7:	0f b6 02             	movzbl (%edx),%eax
+  800eda:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800edd:	89 f3                	mov    %esi,%ebx
+  800edf:	80 fb 09             	cmp    $0x9,%bl
+  800ee2:	76 df                	jbe    800ec3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ee4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ee7:	89 f3                	mov    %esi,%ebx
+  800ee9:	80 fb 19             	cmp    $0x19,%bl
+  800eec:	77 08                	ja     800ef6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800eee:	0f be c0             	movsbl %al,%eax
+  800ef1:	83 e8 57             	sub    $0x57,%eax
+  800ef4:	eb d3                	jmp    800ec9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ef6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ef9:	89 f3                	mov    %esi,%ebx
+  800efb:	80 fb 19             	cmp    $0x19,%bl
+  800efe:	77 08                	ja     800f08 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800f00:	0f be c0             	movsbl %al,%eax
+  800f03:	83 e8 37             	sub    $0x37,%eax
+  800f06:	eb c1                	jmp    800ec9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f08:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f0c:	74 05                	je     800f13 <strtol+0xcc>
+		*endptr = (char *) s;
+  800f0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f11:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f13:	89 c8                	mov    %ecx,%eax
+  800f15:	f7 d8                	neg    %eax
+  800f17:	85 ff                	test   %edi,%edi
+  800f19:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f1c:	89 c8                	mov    %ecx,%eax
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800f29:	6a 00                	push   $0x0
+  800f2b:	6a 00                	push   $0x0
+  800f2d:	ff 75 08             	push   0x8(%ebp)
+  800f30:	e8 12 ff ff ff       	call   800e47 <strtol>
+}
+  800f35:	c9                   	leave
+  800f36:	c3                   	ret
+
+00800f37 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	57                   	push   %edi
+  800f3b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	89 c3                	mov    %eax,%ebx
+  800f49:	89 c7                	mov    %eax,%edi
+  800f4b:	6a 00                	push   $0x0
+  800f4d:	55                   	push   %ebp
+  800f4e:	56                   	push   %esi
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	8d 35 59 0f 80 00    	lea    0x800f59,%esi
+  800f57:	0f 34                	sysenter
+
+00800f59 <after_sysenter_label_47>:
+  800f59:	5e                   	pop    %esi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+
+00800f62 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f71:	89 d1                	mov    %edx,%ecx
+  800f73:	89 d3                	mov    %edx,%ebx
+  800f75:	89 d7                	mov    %edx,%edi
+  800f77:	6a 00                	push   $0x0
+  800f79:	55                   	push   %ebp
+  800f7a:	56                   	push   %esi
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	8d 35 85 0f 80 00    	lea    0x800f85,%esi
+  800f83:	0f 34                	sysenter
+
+00800f85 <after_sysenter_label_128>:
+  800f85:	5e                   	pop    %esi
+  800f86:	5d                   	pop    %ebp
+  800f87:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+
+00800f8e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fa0:	89 cb                	mov    %ecx,%ebx
+  800fa2:	89 cf                	mov    %ecx,%edi
+  800fa4:	6a 00                	push   $0x0
+  800fa6:	55                   	push   %ebp
+  800fa7:	56                   	push   %esi
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	8d 35 b2 0f 80 00    	lea    0x800fb2,%esi
+  800fb0:	0f 34                	sysenter
+
+00800fb2 <after_sysenter_label_212>:
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	7f 07                	jg     800fc2 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	50                   	push   %eax
+  800fc6:	6a 03                	push   $0x3
+  800fc8:	68 f5 4f 80 00       	push   $0x804ff5
+  800fcd:	6a 54                	push   $0x54
+  800fcf:	68 12 50 80 00       	push   $0x805012
+  800fd4:	e8 38 30 00 00       	call   804011 <_panic>
+
+00800fd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fe8:	89 d1                	mov    %edx,%ecx
+  800fea:	89 d3                	mov    %edx,%ebx
+  800fec:	89 d7                	mov    %edx,%edi
+  800fee:	6a 00                	push   $0x0
+  800ff0:	55                   	push   %ebp
+  800ff1:	56                   	push   %esi
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	8d 35 fc 0f 80 00    	lea    0x800ffc,%esi
+  800ffa:	0f 34                	sysenter
+
+00800ffc <after_sysenter_label_309>:
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801001:	5b                   	pop    %ebx
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+
+00801005 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801014:	89 d1                	mov    %edx,%ecx
+  801016:	89 d3                	mov    %edx,%ebx
+  801018:	89 d7                	mov    %edx,%edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	55                   	push   %ebp
+  80101d:	56                   	push   %esi
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	8d 35 28 10 80 00    	lea    0x801028,%esi
+  801026:	0f 34                	sysenter
+
+00801028 <after_sysenter_label_391>:
+  801028:	5e                   	pop    %esi
+  801029:	5d                   	pop    %ebp
+  80102a:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801041:	bf 00 00 00 00       	mov    $0x0,%edi
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	6a 00                	push   $0x0
+  80104b:	55                   	push   %ebp
+  80104c:	56                   	push   %esi
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+
+00801057 <after_sysenter_label_479>:
+  801057:	5e                   	pop    %esi
+  801058:	5d                   	pop    %ebp
+  801059:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	7f 07                	jg     801067 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801060:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801063:	5b                   	pop    %ebx
+  801064:	5f                   	pop    %edi
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801067:	83 ec 0c             	sub    $0xc,%esp
+  80106a:	50                   	push   %eax
+  80106b:	6a 04                	push   $0x4
+  80106d:	68 f5 4f 80 00       	push   $0x804ff5
+  801072:	6a 54                	push   $0x54
+  801074:	68 12 50 80 00       	push   $0x805012
+  801079:	e8 93 2f 00 00       	call   804011 <_panic>
+
+0080107e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 05 00 00 00       	mov    $0x5,%eax
+  80108e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801091:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801094:	ff 75 18             	push   0x18(%ebp)
+  801097:	55                   	push   %ebp
+  801098:	56                   	push   %esi
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	8d 35 a3 10 80 00    	lea    0x8010a3,%esi
+  8010a1:	0f 34                	sysenter
+
+008010a3 <after_sysenter_label_593>:
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010a8:	85 c0                	test   %eax,%eax
+  8010aa:	7f 07                	jg     8010b3 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+  8010b6:	50                   	push   %eax
+  8010b7:	6a 05                	push   $0x5
+  8010b9:	68 f5 4f 80 00       	push   $0x804ff5
+  8010be:	6a 54                	push   $0x54
+  8010c0:	68 12 50 80 00       	push   $0x805012
+  8010c5:	e8 47 2f 00 00       	call   804011 <_panic>
+
+008010ca <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	57                   	push   %edi
+  8010ce:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010df:	89 df                	mov    %ebx,%edi
+  8010e1:	6a 00                	push   $0x0
+  8010e3:	55                   	push   %ebp
+  8010e4:	56                   	push   %esi
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	8d 35 ef 10 80 00    	lea    0x8010ef,%esi
+  8010ed:	0f 34                	sysenter
+
+008010ef <after_sysenter_label_704>:
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	7f 07                	jg     8010ff <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010fb:	5b                   	pop    %ebx
+  8010fc:	5f                   	pop    %edi
+  8010fd:	5d                   	pop    %ebp
+  8010fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ff:	83 ec 0c             	sub    $0xc,%esp
+  801102:	50                   	push   %eax
+  801103:	6a 06                	push   $0x6
+  801105:	68 f5 4f 80 00       	push   $0x804ff5
+  80110a:	6a 54                	push   $0x54
+  80110c:	68 12 50 80 00       	push   $0x805012
+  801111:	e8 fb 2e 00 00       	call   804011 <_panic>
+
+00801116 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+  801119:	57                   	push   %edi
+  80111a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80111b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801126:	b8 08 00 00 00       	mov    $0x8,%eax
+  80112b:	89 df                	mov    %ebx,%edi
+  80112d:	6a 00                	push   $0x0
+  80112f:	55                   	push   %ebp
+  801130:	56                   	push   %esi
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	8d 35 3b 11 80 00    	lea    0x80113b,%esi
+  801139:	0f 34                	sysenter
+
+0080113b <after_sysenter_label_808>:
+  80113b:	5e                   	pop    %esi
+  80113c:	5d                   	pop    %ebp
+  80113d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801140:	85 c0                	test   %eax,%eax
+  801142:	7f 07                	jg     80114b <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801144:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801147:	5b                   	pop    %ebx
+  801148:	5f                   	pop    %edi
+  801149:	5d                   	pop    %ebp
+  80114a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+  80114e:	50                   	push   %eax
+  80114f:	6a 08                	push   $0x8
+  801151:	68 f5 4f 80 00       	push   $0x804ff5
+  801156:	6a 54                	push   $0x54
+  801158:	68 12 50 80 00       	push   $0x805012
+  80115d:	e8 af 2e 00 00       	call   804011 <_panic>
+
+00801162 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801172:	b8 09 00 00 00       	mov    $0x9,%eax
+  801177:	89 df                	mov    %ebx,%edi
+  801179:	6a 00                	push   $0x0
+  80117b:	55                   	push   %ebp
+  80117c:	56                   	push   %esi
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	8d 35 87 11 80 00    	lea    0x801187,%esi
+  801185:	0f 34                	sysenter
+
+00801187 <after_sysenter_label_912>:
+  801187:	5e                   	pop    %esi
+  801188:	5d                   	pop    %ebp
+  801189:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80118c:	85 c0                	test   %eax,%eax
+  80118e:	7f 07                	jg     801197 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801190:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801193:	5b                   	pop    %ebx
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	50                   	push   %eax
+  80119b:	6a 09                	push   $0x9
+  80119d:	68 f5 4f 80 00       	push   $0x804ff5
+  8011a2:	6a 54                	push   $0x54
+  8011a4:	68 12 50 80 00       	push   $0x805012
+  8011a9:	e8 63 2e 00 00       	call   804011 <_panic>
+
+008011ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	57                   	push   %edi
+  8011b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011be:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011c3:	89 df                	mov    %ebx,%edi
+  8011c5:	6a 00                	push   $0x0
+  8011c7:	55                   	push   %ebp
+  8011c8:	56                   	push   %esi
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	8d 35 d3 11 80 00    	lea    0x8011d3,%esi
+  8011d1:	0f 34                	sysenter
+
+008011d3 <after_sysenter_label_1016>:
+  8011d3:	5e                   	pop    %esi
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011d8:	85 c0                	test   %eax,%eax
+  8011da:	7f 07                	jg     8011e3 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e3:	83 ec 0c             	sub    $0xc,%esp
+  8011e6:	50                   	push   %eax
+  8011e7:	6a 0a                	push   $0xa
+  8011e9:	68 f5 4f 80 00       	push   $0x804ff5
+  8011ee:	6a 54                	push   $0x54
+  8011f0:	68 12 50 80 00       	push   $0x805012
+  8011f5:	e8 17 2e 00 00       	call   804011 <_panic>
+
+008011fa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	57                   	push   %edi
+  8011fe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801205:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80120a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801210:	6a 00                	push   $0x0
+  801212:	55                   	push   %ebp
+  801213:	56                   	push   %esi
+  801214:	89 e5                	mov    %esp,%ebp
+  801216:	8d 35 1e 12 80 00    	lea    0x80121e,%esi
+  80121c:	0f 34                	sysenter
+
+0080121e <after_sysenter_label_1126>:
+  80121e:	5e                   	pop    %esi
+  80121f:	5d                   	pop    %ebp
+  801220:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801223:	5b                   	pop    %ebx
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801234:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801239:	89 cb                	mov    %ecx,%ebx
+  80123b:	89 cf                	mov    %ecx,%edi
+  80123d:	6a 00                	push   $0x0
+  80123f:	55                   	push   %ebp
+  801240:	56                   	push   %esi
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	8d 35 4b 12 80 00    	lea    0x80124b,%esi
+  801249:	0f 34                	sysenter
+
+0080124b <after_sysenter_label_1210>:
+  80124b:	5e                   	pop    %esi
+  80124c:	5d                   	pop    %ebp
+  80124d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801250:	85 c0                	test   %eax,%eax
+  801252:	7f 07                	jg     80125b <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801257:	5b                   	pop    %ebx
+  801258:	5f                   	pop    %edi
+  801259:	5d                   	pop    %ebp
+  80125a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	50                   	push   %eax
+  80125f:	6a 0d                	push   $0xd
+  801261:	68 f5 4f 80 00       	push   $0x804ff5
+  801266:	6a 54                	push   $0x54
+  801268:	68 12 50 80 00       	push   $0x805012
+  80126d:	e8 9f 2d 00 00       	call   804011 <_panic>
+
+00801272 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801282:	b8 42 00 00 00       	mov    $0x42,%eax
+  801287:	89 df                	mov    %ebx,%edi
+  801289:	6a 00                	push   $0x0
+  80128b:	55                   	push   %ebp
+  80128c:	56                   	push   %esi
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	8d 35 97 12 80 00    	lea    0x801297,%esi
+  801295:	0f 34                	sysenter
+
+00801297 <after_sysenter_label_1311>:
+  801297:	5e                   	pop    %esi
+  801298:	5d                   	pop    %ebp
+  801299:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	7f 07                	jg     8012a7 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8012a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5f                   	pop    %edi
+  8012a5:	5d                   	pop    %ebp
+  8012a6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	50                   	push   %eax
+  8012ab:	6a 42                	push   $0x42
+  8012ad:	68 f5 4f 80 00       	push   $0x804ff5
+  8012b2:	6a 54                	push   $0x54
+  8012b4:	68 12 50 80 00       	push   $0x805012
+  8012b9:	e8 53 2d 00 00       	call   804011 <_panic>
+
+008012be <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012cd:	89 d1                	mov    %edx,%ecx
+  8012cf:	89 d3                	mov    %edx,%ebx
+  8012d1:	89 d7                	mov    %edx,%edi
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	55                   	push   %ebp
+  8012d6:	56                   	push   %esi
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	8d 35 e1 12 80 00    	lea    0x8012e1,%esi
+  8012df:	0f 34                	sysenter
+
+008012e1 <after_sysenter_label_1411>:
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5f                   	pop    %edi
+  8012e8:	5d                   	pop    %ebp
+  8012e9:	c3                   	ret
+
+008012ea <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	57                   	push   %edi
+  8012ee:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012ff:	89 df                	mov    %ebx,%edi
+  801301:	6a 00                	push   $0x0
+  801303:	55                   	push   %ebp
+  801304:	56                   	push   %esi
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	8d 35 0f 13 80 00    	lea    0x80130f,%esi
+  80130d:	0f 34                	sysenter
+
+0080130f <after_sysenter_label_1497>:
+  80130f:	5e                   	pop    %esi
+  801310:	5d                   	pop    %ebp
+  801311:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801314:	5b                   	pop    %ebx
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+
+00801318 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801318:	55                   	push   %ebp
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	57                   	push   %edi
+  80131c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801328:	b8 10 00 00 00       	mov    $0x10,%eax
+  80132d:	89 df                	mov    %ebx,%edi
+  80132f:	6a 00                	push   $0x0
+  801331:	55                   	push   %ebp
+  801332:	56                   	push   %esi
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	8d 35 3d 13 80 00    	lea    0x80133d,%esi
+  80133b:	0f 34                	sysenter
+
+0080133d <after_sysenter_label_1583>:
+  80133d:	5e                   	pop    %esi
+  80133e:	5d                   	pop    %ebp
+  80133f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801342:	5b                   	pop    %ebx
+  801343:	5f                   	pop    %edi
+  801344:	5d                   	pop    %ebp
+  801345:	c3                   	ret
+
+00801346 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	57                   	push   %edi
+  80134a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80134b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801351:	b8 11 00 00 00       	mov    $0x11,%eax
+  801356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80135b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135e:	6a 00                	push   $0x0
+  801360:	55                   	push   %ebp
+  801361:	56                   	push   %esi
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	8d 35 6c 13 80 00    	lea    0x80136c,%esi
+  80136a:	0f 34                	sysenter
+
+0080136c <after_sysenter_label_1672>:
+  80136c:	5e                   	pop    %esi
+  80136d:	5d                   	pop    %ebp
+  80136e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801371:	5b                   	pop    %ebx
+  801372:	5f                   	pop    %edi
+  801373:	5d                   	pop    %ebp
+  801374:	c3                   	ret
+
+00801375 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	57                   	push   %edi
+  801379:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80137a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801385:	b8 12 00 00 00       	mov    $0x12,%eax
+  80138a:	89 df                	mov    %ebx,%edi
+  80138c:	6a 00                	push   $0x0
+  80138e:	55                   	push   %ebp
+  80138f:	56                   	push   %esi
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	8d 35 9a 13 80 00    	lea    0x80139a,%esi
+  801398:	0f 34                	sysenter
+
+0080139a <after_sysenter_label_1758>:
+  80139a:	5e                   	pop    %esi
+  80139b:	5d                   	pop    %ebp
+  80139c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+
+008013a3 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	57                   	push   %edi
+  8013a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013b5:	89 cb                	mov    %ecx,%ebx
+  8013b7:	89 cf                	mov    %ecx,%edi
+  8013b9:	6a 00                	push   $0x0
+  8013bb:	55                   	push   %ebp
+  8013bc:	56                   	push   %esi
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	8d 35 c7 13 80 00    	lea    0x8013c7,%esi
+  8013c5:	0f 34                	sysenter
+
+008013c7 <after_sysenter_label_1842>:
+  8013c7:	5e                   	pop    %esi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	7f 07                	jg     8013d7 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8013d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	50                   	push   %eax
+  8013db:	6a 13                	push   $0x13
+  8013dd:	68 f5 4f 80 00       	push   $0x804ff5
+  8013e2:	6a 54                	push   $0x54
+  8013e4:	68 12 50 80 00       	push   $0x805012
+  8013e9:	e8 23 2c 00 00       	call   804011 <_panic>
+
+008013ee <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	57                   	push   %edi
+  8013f2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013fd:	89 d1                	mov    %edx,%ecx
+  8013ff:	89 d3                	mov    %edx,%ebx
+  801401:	89 d7                	mov    %edx,%edi
+  801403:	6a 00                	push   $0x0
+  801405:	55                   	push   %ebp
+  801406:	56                   	push   %esi
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	8d 35 11 14 80 00    	lea    0x801411,%esi
+  80140f:	0f 34                	sysenter
+
+00801411 <after_sysenter_label_1939>:
+  801411:	5e                   	pop    %esi
+  801412:	5d                   	pop    %ebp
+  801413:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801416:	5b                   	pop    %ebx
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+
+0080141a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80141f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801425:	b8 15 00 00 00       	mov    $0x15,%eax
+  80142a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801432:	6a 00                	push   $0x0
+  801434:	55                   	push   %ebp
+  801435:	56                   	push   %esi
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	8d 35 40 14 80 00    	lea    0x801440,%esi
+  80143e:	0f 34                	sysenter
+
+00801440 <after_sysenter_label_2028>:
+  801440:	5e                   	pop    %esi
+  801441:	5d                   	pop    %ebp
+  801442:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801445:	5b                   	pop    %ebx
+  801446:	5f                   	pop    %edi
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+
+00801449 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80144e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801453:	8b 55 08             	mov    0x8(%ebp),%edx
+  801456:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801459:	b8 16 00 00 00       	mov    $0x16,%eax
+  80145e:	89 df                	mov    %ebx,%edi
+  801460:	6a 00                	push   $0x0
+  801462:	55                   	push   %ebp
+  801463:	56                   	push   %esi
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	8d 35 6e 14 80 00    	lea    0x80146e,%esi
+  80146c:	0f 34                	sysenter
+
+0080146e <after_sysenter_label_2114>:
+  80146e:	5e                   	pop    %esi
+  80146f:	5d                   	pop    %ebp
+  801470:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801473:	5b                   	pop    %ebx
+  801474:	5f                   	pop    %edi
+  801475:	5d                   	pop    %ebp
+  801476:	c3                   	ret
+
+00801477 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80147c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801481:	8b 55 08             	mov    0x8(%ebp),%edx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 17 00 00 00       	mov    $0x17,%eax
+  80148c:	89 df                	mov    %ebx,%edi
+  80148e:	6a 00                	push   $0x0
+  801490:	55                   	push   %ebp
+  801491:	56                   	push   %esi
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	8d 35 9c 14 80 00    	lea    0x80149c,%esi
+  80149a:	0f 34                	sysenter
+
+0080149c <after_sysenter_label_2200>:
+  80149c:	5e                   	pop    %esi
+  80149d:	5d                   	pop    %ebp
+  80149e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+
+008014a5 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014ba:	89 df                	mov    %ebx,%edi
+  8014bc:	6a 00                	push   $0x0
+  8014be:	55                   	push   %ebp
+  8014bf:	56                   	push   %esi
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	8d 35 ca 14 80 00    	lea    0x8014ca,%esi
+  8014c8:	0f 34                	sysenter
+
+008014ca <after_sysenter_label_2286>:
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8014cf:	5b                   	pop    %ebx
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+
+008014d3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014de:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+
+008014e3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014ee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014f3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+
+008014fa <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014fa:	55                   	push   %ebp
+  8014fb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014fd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801502:	eb 02                	jmp    801506 <fd_alloc+0xc>
+  801504:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801506:	89 c2                	mov    %eax,%edx
+  801508:	c1 ea 16             	shr    $0x16,%edx
+  80150b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801512:	f6 c2 01             	test   $0x1,%dl
+  801515:	74 2b                	je     801542 <fd_alloc+0x48>
+  801517:	89 c2                	mov    %eax,%edx
+  801519:	c1 ea 0c             	shr    $0xc,%edx
+  80151c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801523:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801529:	f6 c1 01             	test   $0x1,%cl
+  80152c:	74 14                	je     801542 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80152e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801534:	75 ce                	jne    801504 <fd_alloc+0xa>
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80153b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801540:	eb 05                	jmp    801547 <fd_alloc+0x4d>
+			return 0;
+  801542:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	89 02                	mov    %eax,(%edx)
+}
+  80154c:	89 c8                	mov    %ecx,%eax
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+
+00801550 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801556:	83 f8 1f             	cmp    $0x1f,%eax
+  801559:	77 30                	ja     80158b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80155b:	c1 e0 0c             	shl    $0xc,%eax
+  80155e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801563:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801569:	f6 c2 01             	test   $0x1,%dl
+  80156c:	74 24                	je     801592 <fd_lookup+0x42>
+  80156e:	89 c2                	mov    %eax,%edx
+  801570:	c1 ea 0c             	shr    $0xc,%edx
+  801573:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80157a:	f6 c2 01             	test   $0x1,%dl
+  80157d:	74 1a                	je     801599 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80157f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801582:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+		return -E_INVAL;
+  80158b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801590:	eb f7                	jmp    801589 <fd_lookup+0x39>
+		return -E_INVAL;
+  801592:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801597:	eb f0                	jmp    801589 <fd_lookup+0x39>
+  801599:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159e:	eb e9                	jmp    801589 <fd_lookup+0x39>
+
+008015a0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	53                   	push   %ebx
+  8015a4:	83 ec 04             	sub    $0x4,%esp
+  8015a7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015af:	eb 03                	jmp    8015b4 <dev_lookup+0x14>
+  8015b1:	83 c0 01             	add    $0x1,%eax
+  8015b4:	8b 1c 85 9c 50 80 00 	mov    0x80509c(,%eax,4),%ebx
+  8015bb:	85 db                	test   %ebx,%ebx
+  8015bd:	74 0b                	je     8015ca <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015bf:	39 13                	cmp    %edx,(%ebx)
+  8015c1:	75 ee                	jne    8015b1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	eb 49                	jmp    801613 <dev_lookup+0x73>
+  8015ca:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015cc:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8015d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015d7:	77 18                	ja     8015f1 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015de:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8015e0:	c1 e8 10             	shr    $0x10,%eax
+  8015e3:	74 0c                	je     8015f1 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015e5:	c1 e0 10             	shl    $0x10,%eax
+  8015e8:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8015ed:	29 c1                	sub    %eax,%ecx
+  8015ef:	eb 06                	jmp    8015f7 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8015f1:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015f7:	8b 01                	mov    (%ecx),%eax
+  8015f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8015fc:	83 ec 04             	sub    $0x4,%esp
+  8015ff:	52                   	push   %edx
+  801600:	50                   	push   %eax
+  801601:	68 20 50 80 00       	push   $0x805020
+  801606:	e8 04 f0 ff ff       	call   80060f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801613:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801616:	89 1a                	mov    %ebx,(%edx)
+}
+  801618:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+
+0080161d <fd_close>:
+{
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	57                   	push   %edi
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	83 ec 24             	sub    $0x24,%esp
+  801626:	8b 75 08             	mov    0x8(%ebp),%esi
+  801629:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80162c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80162f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801630:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801636:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801639:	50                   	push   %eax
+  80163a:	e8 11 ff ff ff       	call   801550 <fd_lookup>
+  80163f:	89 c3                	mov    %eax,%ebx
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 05                	js     80164d <fd_close+0x30>
+	    || fd != fd2)
+  801648:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80164b:	74 16                	je     801663 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80164d:	89 f8                	mov    %edi,%eax
+  80164f:	84 c0                	test   %al,%al
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801659:	89 d8                	mov    %ebx,%eax
+  80165b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165e:	5b                   	pop    %ebx
+  80165f:	5e                   	pop    %esi
+  801660:	5f                   	pop    %edi
+  801661:	5d                   	pop    %ebp
+  801662:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	ff 36                	push   (%esi)
+  80166c:	e8 2f ff ff ff       	call   8015a0 <dev_lookup>
+  801671:	89 c3                	mov    %eax,%ebx
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	85 c0                	test   %eax,%eax
+  801678:	78 1a                	js     801694 <fd_close+0x77>
+		if (dev->dev_close)
+  80167a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80167d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801685:	85 c0                	test   %eax,%eax
+  801687:	74 0b                	je     801694 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	56                   	push   %esi
+  80168d:	ff d0                	call   *%eax
+  80168f:	89 c3                	mov    %eax,%ebx
+  801691:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801694:	83 ec 08             	sub    $0x8,%esp
+  801697:	56                   	push   %esi
+  801698:	6a 00                	push   $0x0
+  80169a:	e8 2b fa ff ff       	call   8010ca <sys_page_unmap>
+	return r;
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	eb b5                	jmp    801659 <fd_close+0x3c>
+
+008016a4 <close>:
+
+int
+close(int fdnum)
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ad:	50                   	push   %eax
+  8016ae:	ff 75 08             	push   0x8(%ebp)
+  8016b1:	e8 9a fe ff ff       	call   801550 <fd_lookup>
+  8016b6:	83 c4 10             	add    $0x10,%esp
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	79 02                	jns    8016bf <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+		return fd_close(fd, 1);
+  8016bf:	83 ec 08             	sub    $0x8,%esp
+  8016c2:	6a 01                	push   $0x1
+  8016c4:	ff 75 f4             	push   -0xc(%ebp)
+  8016c7:	e8 51 ff ff ff       	call   80161d <fd_close>
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	eb ec                	jmp    8016bd <close+0x19>
+
+008016d1 <close_all>:
+
+void
+close_all(void)
+{
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	53                   	push   %ebx
+  8016d5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016dd:	83 ec 0c             	sub    $0xc,%esp
+  8016e0:	53                   	push   %ebx
+  8016e1:	e8 be ff ff ff       	call   8016a4 <close>
+	for (i = 0; i < MAXFD; i++)
+  8016e6:	83 c3 01             	add    $0x1,%ebx
+  8016e9:	83 c4 10             	add    $0x10,%esp
+  8016ec:	83 fb 20             	cmp    $0x20,%ebx
+  8016ef:	75 ec                	jne    8016dd <close_all+0xc>
+}
+  8016f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016f4:	c9                   	leave
+  8016f5:	c3                   	ret
+
+008016f6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	57                   	push   %edi
+  8016fa:	56                   	push   %esi
+  8016fb:	53                   	push   %ebx
+  8016fc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016ff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801702:	50                   	push   %eax
+  801703:	ff 75 08             	push   0x8(%ebp)
+  801706:	e8 45 fe ff ff       	call   801550 <fd_lookup>
+  80170b:	89 c3                	mov    %eax,%ebx
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	78 7f                	js     801793 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801714:	83 ec 0c             	sub    $0xc,%esp
+  801717:	ff 75 0c             	push   0xc(%ebp)
+  80171a:	e8 85 ff ff ff       	call   8016a4 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80171f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801722:	c1 e6 0c             	shl    $0xc,%esi
+  801725:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80172b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80172e:	89 3c 24             	mov    %edi,(%esp)
+  801731:	e8 ad fd ff ff       	call   8014e3 <fd2data>
+  801736:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801738:	89 34 24             	mov    %esi,(%esp)
+  80173b:	e8 a3 fd ff ff       	call   8014e3 <fd2data>
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801746:	89 d8                	mov    %ebx,%eax
+  801748:	c1 e8 16             	shr    $0x16,%eax
+  80174b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801752:	a8 01                	test   $0x1,%al
+  801754:	74 11                	je     801767 <dup+0x71>
+  801756:	89 d8                	mov    %ebx,%eax
+  801758:	c1 e8 0c             	shr    $0xc,%eax
+  80175b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801762:	f6 c2 01             	test   $0x1,%dl
+  801765:	75 36                	jne    80179d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801767:	89 f8                	mov    %edi,%eax
+  801769:	c1 e8 0c             	shr    $0xc,%eax
+  80176c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801773:	83 ec 0c             	sub    $0xc,%esp
+  801776:	25 07 0e 00 00       	and    $0xe07,%eax
+  80177b:	50                   	push   %eax
+  80177c:	56                   	push   %esi
+  80177d:	6a 00                	push   $0x0
+  80177f:	57                   	push   %edi
+  801780:	6a 00                	push   $0x0
+  801782:	e8 f7 f8 ff ff       	call   80107e <sys_page_map>
+  801787:	89 c3                	mov    %eax,%ebx
+  801789:	83 c4 20             	add    $0x20,%esp
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 33                	js     8017c3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801790:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801793:	89 d8                	mov    %ebx,%eax
+  801795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801798:	5b                   	pop    %ebx
+  801799:	5e                   	pop    %esi
+  80179a:	5f                   	pop    %edi
+  80179b:	5d                   	pop    %ebp
+  80179c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80179d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+  8017a7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017ac:	50                   	push   %eax
+  8017ad:	ff 75 d4             	push   -0x2c(%ebp)
+  8017b0:	6a 00                	push   $0x0
+  8017b2:	53                   	push   %ebx
+  8017b3:	6a 00                	push   $0x0
+  8017b5:	e8 c4 f8 ff ff       	call   80107e <sys_page_map>
+  8017ba:	89 c3                	mov    %eax,%ebx
+  8017bc:	83 c4 20             	add    $0x20,%esp
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	79 a4                	jns    801767 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017c3:	83 ec 08             	sub    $0x8,%esp
+  8017c6:	56                   	push   %esi
+  8017c7:	6a 00                	push   $0x0
+  8017c9:	e8 fc f8 ff ff       	call   8010ca <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017ce:	83 c4 08             	add    $0x8,%esp
+  8017d1:	ff 75 d4             	push   -0x2c(%ebp)
+  8017d4:	6a 00                	push   $0x0
+  8017d6:	e8 ef f8 ff ff       	call   8010ca <sys_page_unmap>
+	return r;
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	eb b3                	jmp    801793 <dup+0x9d>
+
+008017e0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	56                   	push   %esi
+  8017e4:	53                   	push   %ebx
+  8017e5:	83 ec 18             	sub    $0x18,%esp
+  8017e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ee:	50                   	push   %eax
+  8017ef:	53                   	push   %ebx
+  8017f0:	e8 5b fd ff ff       	call   801550 <fd_lookup>
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 3c                	js     801838 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ff:	83 ec 08             	sub    $0x8,%esp
+  801802:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801805:	50                   	push   %eax
+  801806:	ff 36                	push   (%esi)
+  801808:	e8 93 fd ff ff       	call   8015a0 <dev_lookup>
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 24                	js     801838 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801814:	8b 46 08             	mov    0x8(%esi),%eax
+  801817:	83 e0 03             	and    $0x3,%eax
+  80181a:	83 f8 01             	cmp    $0x1,%eax
+  80181d:	74 20                	je     80183f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80181f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801822:	8b 40 08             	mov    0x8(%eax),%eax
+  801825:	85 c0                	test   %eax,%eax
+  801827:	74 61                	je     80188a <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801829:	83 ec 04             	sub    $0x4,%esp
+  80182c:	ff 75 10             	push   0x10(%ebp)
+  80182f:	ff 75 0c             	push   0xc(%ebp)
+  801832:	56                   	push   %esi
+  801833:	ff d0                	call   *%eax
+  801835:	83 c4 10             	add    $0x10,%esp
+}
+  801838:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5d                   	pop    %ebp
+  80183e:	c3                   	ret
+  80183f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801841:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801847:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80184c:	77 18                	ja     801866 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80184e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801853:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801855:	c1 e8 10             	shr    $0x10,%eax
+  801858:	74 0c                	je     801866 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80185a:	c1 e0 10             	shl    $0x10,%eax
+  80185d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801862:	29 c2                	sub    %eax,%edx
+  801864:	eb 06                	jmp    80186c <read+0x8c>
+		return pthread_main_tls;
+  801866:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80186c:	8b 02                	mov    (%edx),%eax
+  80186e:	8b 40 48             	mov    0x48(%eax),%eax
+  801871:	83 ec 04             	sub    $0x4,%esp
+  801874:	53                   	push   %ebx
+  801875:	50                   	push   %eax
+  801876:	68 61 50 80 00       	push   $0x805061
+  80187b:	e8 8f ed ff ff       	call   80060f <cprintf>
+		return -E_INVAL;
+  801880:	83 c4 10             	add    $0x10,%esp
+  801883:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801888:	eb ae                	jmp    801838 <read+0x58>
+		return -E_NOT_SUPP;
+  80188a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188f:	eb a7                	jmp    801838 <read+0x58>
+
+00801891 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	57                   	push   %edi
+  801895:	56                   	push   %esi
+  801896:	53                   	push   %ebx
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80189d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a5:	eb 02                	jmp    8018a9 <readn+0x18>
+  8018a7:	01 c3                	add    %eax,%ebx
+  8018a9:	39 f3                	cmp    %esi,%ebx
+  8018ab:	73 21                	jae    8018ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018ad:	83 ec 04             	sub    $0x4,%esp
+  8018b0:	89 f0                	mov    %esi,%eax
+  8018b2:	29 d8                	sub    %ebx,%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	89 d8                	mov    %ebx,%eax
+  8018b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8018ba:	50                   	push   %eax
+  8018bb:	57                   	push   %edi
+  8018bc:	e8 1f ff ff ff       	call   8017e0 <read>
+		if (m < 0)
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	78 04                	js     8018cc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018c8:	75 dd                	jne    8018a7 <readn+0x16>
+  8018ca:	eb 02                	jmp    8018ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018cc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018ce:	89 d8                	mov    %ebx,%eax
+  8018d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d3:	5b                   	pop    %ebx
+  8018d4:	5e                   	pop    %esi
+  8018d5:	5f                   	pop    %edi
+  8018d6:	5d                   	pop    %ebp
+  8018d7:	c3                   	ret
+
+008018d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	56                   	push   %esi
+  8018dc:	53                   	push   %ebx
+  8018dd:	83 ec 18             	sub    $0x18,%esp
+  8018e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e6:	50                   	push   %eax
+  8018e7:	53                   	push   %ebx
+  8018e8:	e8 63 fc ff ff       	call   801550 <fd_lookup>
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 37                	js     80192b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018fd:	50                   	push   %eax
+  8018fe:	ff 36                	push   (%esi)
+  801900:	e8 9b fc ff ff       	call   8015a0 <dev_lookup>
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 1f                	js     80192b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80190c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801910:	74 20                	je     801932 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801912:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	74 61                	je     80197d <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80191c:	83 ec 04             	sub    $0x4,%esp
+  80191f:	ff 75 10             	push   0x10(%ebp)
+  801922:	ff 75 0c             	push   0xc(%ebp)
+  801925:	56                   	push   %esi
+  801926:	ff d0                	call   *%eax
+  801928:	83 c4 10             	add    $0x10,%esp
+}
+  80192b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192e:	5b                   	pop    %ebx
+  80192f:	5e                   	pop    %esi
+  801930:	5d                   	pop    %ebp
+  801931:	c3                   	ret
+  801932:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801934:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80193a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80193f:	77 18                	ja     801959 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801941:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801946:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801948:	c1 e8 10             	shr    $0x10,%eax
+  80194b:	74 0c                	je     801959 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80194d:	c1 e0 10             	shl    $0x10,%eax
+  801950:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801955:	29 c2                	sub    %eax,%edx
+  801957:	eb 06                	jmp    80195f <write+0x87>
+		return pthread_main_tls;
+  801959:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80195f:	8b 02                	mov    (%edx),%eax
+  801961:	8b 40 48             	mov    0x48(%eax),%eax
+  801964:	83 ec 04             	sub    $0x4,%esp
+  801967:	53                   	push   %ebx
+  801968:	50                   	push   %eax
+  801969:	68 7d 50 80 00       	push   $0x80507d
+  80196e:	e8 9c ec ff ff       	call   80060f <cprintf>
+		return -E_INVAL;
+  801973:	83 c4 10             	add    $0x10,%esp
+  801976:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197b:	eb ae                	jmp    80192b <write+0x53>
+		return -E_NOT_SUPP;
+  80197d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801982:	eb a7                	jmp    80192b <write+0x53>
+
+00801984 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80198a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80198d:	50                   	push   %eax
+  80198e:	ff 75 08             	push   0x8(%ebp)
+  801991:	e8 ba fb ff ff       	call   801550 <fd_lookup>
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 0e                	js     8019ab <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80199d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ab:	c9                   	leave
+  8019ac:	c3                   	ret
+
+008019ad <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019ad:	55                   	push   %ebp
+  8019ae:	89 e5                	mov    %esp,%ebp
+  8019b0:	56                   	push   %esi
+  8019b1:	53                   	push   %ebx
+  8019b2:	83 ec 18             	sub    $0x18,%esp
+  8019b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019bb:	50                   	push   %eax
+  8019bc:	53                   	push   %ebx
+  8019bd:	e8 8e fb ff ff       	call   801550 <fd_lookup>
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	85 c0                	test   %eax,%eax
+  8019c7:	78 34                	js     8019fd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019cc:	83 ec 08             	sub    $0x8,%esp
+  8019cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	ff 36                	push   (%esi)
+  8019d5:	e8 c6 fb ff ff       	call   8015a0 <dev_lookup>
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	78 1c                	js     8019fd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e5:	74 1d                	je     801a04 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ea:	8b 40 18             	mov    0x18(%eax),%eax
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	74 5e                	je     801a4f <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019f1:	83 ec 08             	sub    $0x8,%esp
+  8019f4:	ff 75 0c             	push   0xc(%ebp)
+  8019f7:	56                   	push   %esi
+  8019f8:	ff d0                	call   *%eax
+  8019fa:	83 c4 10             	add    $0x10,%esp
+}
+  8019fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a00:	5b                   	pop    %ebx
+  801a01:	5e                   	pop    %esi
+  801a02:	5d                   	pop    %ebp
+  801a03:	c3                   	ret
+  801a04:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a06:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a0c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a11:	77 18                	ja     801a2b <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a13:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a18:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a1a:	c1 e8 10             	shr    $0x10,%eax
+  801a1d:	74 0c                	je     801a2b <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a1f:	c1 e0 10             	shl    $0x10,%eax
+  801a22:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a27:	29 c2                	sub    %eax,%edx
+  801a29:	eb 06                	jmp    801a31 <ftruncate+0x84>
+		return pthread_main_tls;
+  801a2b:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			thisenv->env_id, fdnum);
+  801a31:	8b 02                	mov    (%edx),%eax
+  801a33:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a36:	83 ec 04             	sub    $0x4,%esp
+  801a39:	53                   	push   %ebx
+  801a3a:	50                   	push   %eax
+  801a3b:	68 40 50 80 00       	push   $0x805040
+  801a40:	e8 ca eb ff ff       	call   80060f <cprintf>
+		return -E_INVAL;
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a4d:	eb ae                	jmp    8019fd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a54:	eb a7                	jmp    8019fd <ftruncate+0x50>
+
+00801a56 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+  801a5b:	83 ec 18             	sub    $0x18,%esp
+  801a5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	ff 75 08             	push   0x8(%ebp)
+  801a68:	e8 e3 fa ff ff       	call   801550 <fd_lookup>
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	78 49                	js     801abd <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a74:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a77:	83 ec 08             	sub    $0x8,%esp
+  801a7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7d:	50                   	push   %eax
+  801a7e:	ff 36                	push   (%esi)
+  801a80:	e8 1b fb ff ff       	call   8015a0 <dev_lookup>
+  801a85:	83 c4 10             	add    $0x10,%esp
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 31                	js     801abd <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a93:	74 2f                	je     801ac4 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a95:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a98:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a9f:	00 00 00 
+	stat->st_isdir = 0;
+  801aa2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aa9:	00 00 00 
+	stat->st_dev = dev;
+  801aac:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ab2:	83 ec 08             	sub    $0x8,%esp
+  801ab5:	53                   	push   %ebx
+  801ab6:	56                   	push   %esi
+  801ab7:	ff 50 14             	call   *0x14(%eax)
+  801aba:	83 c4 10             	add    $0x10,%esp
+}
+  801abd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5d                   	pop    %ebp
+  801ac3:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ac4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac9:	eb f2                	jmp    801abd <fstat+0x67>
+
+00801acb <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	56                   	push   %esi
+  801acf:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ad0:	83 ec 08             	sub    $0x8,%esp
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	ff 75 08             	push   0x8(%ebp)
+  801ad8:	e8 4b 03 00 00       	call   801e28 <open>
+  801add:	89 c3                	mov    %eax,%ebx
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	78 1b                	js     801b01 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ae6:	83 ec 08             	sub    $0x8,%esp
+  801ae9:	ff 75 0c             	push   0xc(%ebp)
+  801aec:	50                   	push   %eax
+  801aed:	e8 64 ff ff ff       	call   801a56 <fstat>
+  801af2:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801af4:	89 1c 24             	mov    %ebx,(%esp)
+  801af7:	e8 a8 fb ff ff       	call   8016a4 <close>
+	return r;
+  801afc:	83 c4 10             	add    $0x10,%esp
+  801aff:	89 f3                	mov    %esi,%ebx
+}
+  801b01:	89 d8                	mov    %ebx,%eax
+  801b03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b06:	5b                   	pop    %ebx
+  801b07:	5e                   	pop    %esi
+  801b08:	5d                   	pop    %ebp
+  801b09:	c3                   	ret
+
+00801b0a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b0a:	55                   	push   %ebp
+  801b0b:	89 e5                	mov    %esp,%ebp
+  801b0d:	56                   	push   %esi
+  801b0e:	53                   	push   %ebx
+  801b0f:	89 c6                	mov    %eax,%esi
+  801b11:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801b13:	83 3d 10 70 80 00 00 	cmpl   $0x0,0x807010
+  801b1a:	74 27                	je     801b43 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b1c:	6a 07                	push   $0x7
+  801b1e:	68 00 80 80 00       	push   $0x808000
+  801b23:	56                   	push   %esi
+  801b24:	ff 35 10 70 80 00    	push   0x807010
+  801b2a:	e8 94 2c 00 00       	call   8047c3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b2f:	83 c4 0c             	add    $0xc,%esp
+  801b32:	6a 00                	push   $0x0
+  801b34:	53                   	push   %ebx
+  801b35:	6a 00                	push   $0x0
+  801b37:	e8 91 2b 00 00       	call   8046cd <ipc_recv>
+}
+  801b3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3f:	5b                   	pop    %ebx
+  801b40:	5e                   	pop    %esi
+  801b41:	5d                   	pop    %ebp
+  801b42:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b43:	83 ec 0c             	sub    $0xc,%esp
+  801b46:	6a 01                	push   $0x1
+  801b48:	e8 cc 2c 00 00       	call   804819 <ipc_find_env>
+  801b4d:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	eb c5                	jmp    801b1c <fsipc+0x12>
+
+00801b57 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	53                   	push   %ebx
+  801b5b:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801b5e:	68 14 70 80 00       	push   $0x807014
+  801b63:	e8 29 1b 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b6e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801b73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b76:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801b7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b80:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b85:	e8 80 ff ff ff       	call   801b0a <fsipc>
+  801b8a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b8c:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801b93:	e8 66 1b 00 00       	call   8036fe <mutex_unlock>
+	return r;
+}
+  801b98:	89 d8                	mov    %ebx,%eax
+  801b9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+00801b9f <devfile_flush>:
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801ba6:	68 14 70 80 00       	push   $0x807014
+  801bab:	e8 e1 1a 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb6:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801bbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bc5:	e8 40 ff ff ff       	call   801b0a <fsipc>
+  801bca:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bcc:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801bd3:	e8 26 1b 00 00       	call   8036fe <mutex_unlock>
+}
+  801bd8:	89 d8                	mov    %ebx,%eax
+  801bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+00801bdf <devfile_stat>:
+{
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	56                   	push   %esi
+  801be3:	53                   	push   %ebx
+  801be4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801be7:	83 ec 0c             	sub    $0xc,%esp
+  801bea:	68 14 70 80 00       	push   $0x807014
+  801bef:	e8 9d 1a 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bfa:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c04:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c09:	e8 fc fe ff ff       	call   801b0a <fsipc>
+  801c0e:	89 c3                	mov    %eax,%ebx
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	79 16                	jns    801c2d <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801c17:	83 ec 0c             	sub    $0xc,%esp
+  801c1a:	68 14 70 80 00       	push   $0x807014
+  801c1f:	e8 da 1a 00 00       	call   8036fe <mutex_unlock>
+}
+  801c24:	89 d8                	mov    %ebx,%eax
+  801c26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c29:	5b                   	pop    %ebx
+  801c2a:	5e                   	pop    %esi
+  801c2b:	5d                   	pop    %ebp
+  801c2c:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c2d:	83 ec 08             	sub    $0x8,%esp
+  801c30:	68 00 80 80 00       	push   $0x808000
+  801c35:	56                   	push   %esi
+  801c36:	e8 b8 ef ff ff       	call   800bf3 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801c3b:	a1 80 80 80 00       	mov    0x808080,%eax
+  801c40:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c46:	a1 84 80 80 00       	mov    0x808084,%eax
+  801c4b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801c51:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801c54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c59:	eb bc                	jmp    801c17 <devfile_stat+0x38>
+
+00801c5b <devfile_write>:
+{
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	53                   	push   %ebx
+  801c5f:	83 ec 10             	sub    $0x10,%esp
+  801c62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801c65:	68 14 70 80 00       	push   $0x807014
+  801c6a:	e8 22 1a 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c72:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c75:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c7a:	83 c4 10             	add    $0x10,%esp
+  801c7d:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801c83:	76 3d                	jbe    801cc2 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801c85:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801c8a:	39 c3                	cmp    %eax,%ebx
+  801c8c:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c92:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801c97:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ca7:	e8 5e fe ff ff       	call   801b0a <fsipc>
+  801cac:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cae:	83 ec 0c             	sub    $0xc,%esp
+  801cb1:	68 14 70 80 00       	push   $0x807014
+  801cb6:	e8 43 1a 00 00       	call   8036fe <mutex_unlock>
+}
+  801cbb:	89 d8                	mov    %ebx,%eax
+  801cbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc0:	c9                   	leave
+  801cc1:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801cc2:	83 ec 04             	sub    $0x4,%esp
+  801cc5:	53                   	push   %ebx
+  801cc6:	ff 75 0c             	push   0xc(%ebp)
+  801cc9:	68 0c 80 80 00       	push   $0x80800c
+  801cce:	e8 a6 f0 ff ff       	call   800d79 <memmove>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	eb b5                	jmp    801c92 <devfile_write+0x37>
+
+00801cdd <devfile_read>:
+{
+  801cdd:	55                   	push   %ebp
+  801cde:	89 e5                	mov    %esp,%ebp
+  801ce0:	57                   	push   %edi
+  801ce1:	56                   	push   %esi
+  801ce2:	53                   	push   %ebx
+  801ce3:	83 ec 0c             	sub    $0xc,%esp
+  801ce6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ce9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801cec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801cef:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801cf5:	0f 86 8c 00 00 00    	jbe    801d87 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801cfb:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801d00:	39 c3                	cmp    %eax,%ebx
+  801d02:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801d05:	89 f8                	mov    %edi,%eax
+  801d07:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d0a:	eb 0f                	jmp    801d1b <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801d0c:	0f b6 08             	movzbl (%eax),%ecx
+  801d0f:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801d11:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d16:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801d1b:	39 d0                	cmp    %edx,%eax
+  801d1d:	72 ed                	jb     801d0c <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	68 14 70 80 00       	push   $0x807014
+  801d27:	e8 65 19 00 00       	call   803691 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d2c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d2f:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801d34:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801d3a:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801d40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d45:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d4a:	e8 bb fd ff ff       	call   801b0a <fsipc>
+  801d4f:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801d51:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801d58:	e8 a1 19 00 00       	call   8036fe <mutex_unlock>
+		assert(r <= (int) n);
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	39 f3                	cmp    %esi,%ebx
+  801d62:	7c 0a                	jl     801d6e <devfile_read+0x91>
+}
+  801d64:	89 f0                	mov    %esi,%eax
+  801d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d69:	5b                   	pop    %ebx
+  801d6a:	5e                   	pop    %esi
+  801d6b:	5f                   	pop    %edi
+  801d6c:	5d                   	pop    %ebp
+  801d6d:	c3                   	ret
+		assert(r <= (int) n);
+  801d6e:	68 b0 50 80 00       	push   $0x8050b0
+  801d73:	68 bd 50 80 00       	push   $0x8050bd
+  801d78:	68 90 00 00 00       	push   $0x90
+  801d7d:	68 d2 50 80 00       	push   $0x8050d2
+  801d82:	e8 8a 22 00 00       	call   804011 <_panic>
+	mutex_lock(&fsipc_mu);
+  801d87:	83 ec 0c             	sub    $0xc,%esp
+  801d8a:	68 14 70 80 00       	push   $0x807014
+  801d8f:	e8 fd 18 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d94:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d97:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801d9c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801da2:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801da9:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801db6:	e8 4f fd ff ff       	call   801b0a <fsipc>
+  801dbb:	89 c6                	mov    %eax,%esi
+  801dbd:	83 c4 10             	add    $0x10,%esp
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	78 1d                	js     801de1 <devfile_read+0x104>
+		assert(r <= n);
+  801dc4:	39 c3                	cmp    %eax,%ebx
+  801dc6:	72 2e                	jb     801df6 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801dc8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dcd:	7f 40                	jg     801e0f <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801dcf:	83 ec 04             	sub    $0x4,%esp
+  801dd2:	50                   	push   %eax
+  801dd3:	68 00 80 80 00       	push   $0x808000
+  801dd8:	57                   	push   %edi
+  801dd9:	e8 9b ef ff ff       	call   800d79 <memmove>
+  801dde:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	68 14 70 80 00       	push   $0x807014
+  801de9:	e8 10 19 00 00       	call   8036fe <mutex_unlock>
+	return r;
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	e9 6e ff ff ff       	jmp    801d64 <devfile_read+0x87>
+		assert(r <= n);
+  801df6:	68 dd 50 80 00       	push   $0x8050dd
+  801dfb:	68 bd 50 80 00       	push   $0x8050bd
+  801e00:	68 99 00 00 00       	push   $0x99
+  801e05:	68 d2 50 80 00       	push   $0x8050d2
+  801e0a:	e8 02 22 00 00       	call   804011 <_panic>
+		assert(r <= PGSIZE);
+  801e0f:	68 e4 50 80 00       	push   $0x8050e4
+  801e14:	68 bd 50 80 00       	push   $0x8050bd
+  801e19:	68 9a 00 00 00       	push   $0x9a
+  801e1e:	68 d2 50 80 00       	push   $0x8050d2
+  801e23:	e8 e9 21 00 00       	call   804011 <_panic>
+
+00801e28 <open>:
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	56                   	push   %esi
+  801e2c:	53                   	push   %ebx
+  801e2d:	83 ec 1c             	sub    $0x1c,%esp
+  801e30:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e33:	56                   	push   %esi
+  801e34:	e8 7f ed ff ff       	call   800bb8 <strlen>
+  801e39:	83 c4 10             	add    $0x10,%esp
+  801e3c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e41:	0f 8f 85 00 00 00    	jg     801ecc <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e47:	83 ec 0c             	sub    $0xc,%esp
+  801e4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e4d:	50                   	push   %eax
+  801e4e:	e8 a7 f6 ff ff       	call   8014fa <fd_alloc>
+  801e53:	89 c3                	mov    %eax,%ebx
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 55                	js     801eb1 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801e5c:	83 ec 0c             	sub    $0xc,%esp
+  801e5f:	68 14 70 80 00       	push   $0x807014
+  801e64:	e8 28 18 00 00       	call   803691 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e69:	83 c4 08             	add    $0x8,%esp
+  801e6c:	56                   	push   %esi
+  801e6d:	68 00 80 80 00       	push   $0x808000
+  801e72:	e8 7c ed ff ff       	call   800bf3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e7a:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801e7f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e82:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e87:	e8 7e fc ff ff       	call   801b0a <fsipc>
+  801e8c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e8e:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801e95:	e8 64 18 00 00       	call   8036fe <mutex_unlock>
+	if (r < 0) {
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	85 db                	test   %ebx,%ebx
+  801e9f:	78 19                	js     801eba <open+0x92>
+	return fd2num(fd);
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	ff 75 f4             	push   -0xc(%ebp)
+  801ea7:	e8 27 f6 ff ff       	call   8014d3 <fd2num>
+  801eac:	89 c3                	mov    %eax,%ebx
+  801eae:	83 c4 10             	add    $0x10,%esp
+}
+  801eb1:	89 d8                	mov    %ebx,%eax
+  801eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb6:	5b                   	pop    %ebx
+  801eb7:	5e                   	pop    %esi
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+		fd_close(fd, 0);
+  801eba:	83 ec 08             	sub    $0x8,%esp
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	ff 75 f4             	push   -0xc(%ebp)
+  801ec2:	e8 56 f7 ff ff       	call   80161d <fd_close>
+		return r;
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	eb e5                	jmp    801eb1 <open+0x89>
+		return -E_BAD_PATH;
+  801ecc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ed1:	eb de                	jmp    801eb1 <open+0x89>
+
+00801ed3 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801ed3:	55                   	push   %ebp
+  801ed4:	89 e5                	mov    %esp,%ebp
+  801ed6:	53                   	push   %ebx
+  801ed7:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edd:	50                   	push   %eax
+  801ede:	ff 75 08             	push   0x8(%ebp)
+  801ee1:	e8 6a f6 ff ff       	call   801550 <fd_lookup>
+  801ee6:	89 c3                	mov    %eax,%ebx
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	85 c0                	test   %eax,%eax
+  801eed:	78 5b                	js     801f4a <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801eef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef2:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  801ef8:	39 08                	cmp    %ecx,(%eax)
+  801efa:	75 55                	jne    801f51 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801efc:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801f00:	74 56                	je     801f58 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	68 14 70 80 00       	push   $0x807014
+  801f0a:	e8 82 17 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f12:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f15:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801f1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1d:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801f22:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f25:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801f2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f34:	e8 d1 fb ff ff       	call   801b0a <fsipc>
+  801f39:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f3b:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801f42:	e8 b7 17 00 00       	call   8036fe <mutex_unlock>
+	return r;
+  801f47:	83 c4 10             	add    $0x10,%esp
+}
+  801f4a:	89 d8                	mov    %ebx,%eax
+  801f4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f4f:	c9                   	leave
+  801f50:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f51:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f56:	eb f2                	jmp    801f4a <fallocate+0x77>
+		return -E_INVAL;
+  801f58:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f5d:	eb eb                	jmp    801f4a <fallocate+0x77>
+
+00801f5f <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	56                   	push   %esi
+  801f63:	53                   	push   %ebx
+  801f64:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f67:	89 f3                	mov    %esi,%ebx
+  801f69:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f6f:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f72:	eb 06                	jmp    801f7a <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f74:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f7a:	39 f3                	cmp    %esi,%ebx
+  801f7c:	73 14                	jae    801f92 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+  801f81:	53                   	push   %ebx
+  801f82:	6a 00                	push   $0x0
+  801f84:	e8 41 f1 ff ff       	call   8010ca <sys_page_unmap>
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	79 e4                	jns    801f74 <munmap+0x15>
+  801f90:	eb 05                	jmp    801f97 <munmap+0x38>
+			return r;
+	return 0;
+  801f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f9a:	5b                   	pop    %ebx
+  801f9b:	5e                   	pop    %esi
+  801f9c:	5d                   	pop    %ebp
+  801f9d:	c3                   	ret
+
+00801f9e <mmap>:
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	57                   	push   %edi
+  801fa2:	56                   	push   %esi
+  801fa3:	53                   	push   %ebx
+  801fa4:	83 ec 24             	sub    $0x24,%esp
+  801fa7:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801faa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fad:	50                   	push   %eax
+  801fae:	ff 75 08             	push   0x8(%ebp)
+  801fb1:	e8 9a f5 ff ff       	call   801550 <fd_lookup>
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	0f 88 37 01 00 00    	js     8020f8 <mmap+0x15a>
+		return NULL;
+  801fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fc6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fc9:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  801fcf:	39 0a                	cmp    %ecx,(%edx)
+  801fd1:	0f 85 05 01 00 00    	jne    8020dc <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801fd7:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801fde:	0f 85 1b 01 00 00    	jne    8020ff <mmap+0x161>
+  801fe4:	89 f0                	mov    %esi,%eax
+  801fe6:	83 e8 01             	sub    $0x1,%eax
+  801fe9:	0f 88 17 01 00 00    	js     802106 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801fef:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801ff3:	75 28                	jne    80201d <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801ff5:	83 ec 0c             	sub    $0xc,%esp
+  801ff8:	68 14 70 80 00       	push   $0x807014
+  801ffd:	e8 8f 16 00 00       	call   803691 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802002:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802008:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802016:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80201b:	eb 2b                	jmp    802048 <mmap+0xaa>
+		cow_enable();
+  80201d:	e8 3a 22 00 00       	call   80425c <cow_enable>
+  802022:	eb d1                	jmp    801ff5 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802024:	89 c2                	mov    %eax,%edx
+  802026:	c1 ea 0c             	shr    $0xc,%edx
+  802029:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802030:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802036:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80203c:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80203f:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802041:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802046:	77 25                	ja     80206d <mmap+0xcf>
+  802048:	89 c2                	mov    %eax,%edx
+  80204a:	29 da                	sub    %ebx,%edx
+  80204c:	39 ca                	cmp    %ecx,%edx
+  80204e:	73 3a                	jae    80208a <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802050:	89 c2                	mov    %eax,%edx
+  802052:	c1 ea 16             	shr    $0x16,%edx
+  802055:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80205c:	f6 c2 01             	test   $0x1,%dl
+  80205f:	75 c3                	jne    802024 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802061:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802066:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80206b:	eb d4                	jmp    802041 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80206d:	29 d8                	sub    %ebx,%eax
+  80206f:	39 c8                	cmp    %ecx,%eax
+  802071:	73 17                	jae    80208a <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802073:	83 ec 0c             	sub    $0xc,%esp
+  802076:	68 14 70 80 00       	push   $0x807014
+  80207b:	e8 7e 16 00 00       	call   8036fe <mutex_unlock>
+		return NULL;
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+  802088:	eb 52                	jmp    8020dc <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80208a:	85 db                	test   %ebx,%ebx
+  80208c:	74 e5                	je     802073 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80208e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802091:	8b 40 0c             	mov    0xc(%eax),%eax
+  802094:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802099:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80209c:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8020a1:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8020a7:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8020ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b0:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8020b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ba:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8020bf:	e8 46 fa ff ff       	call   801b0a <fsipc>
+  8020c4:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	68 14 70 80 00       	push   $0x807014
+  8020ce:	e8 2b 16 00 00       	call   8036fe <mutex_unlock>
+	if (r < 0) {
+  8020d3:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8020d6:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8020d8:	85 ff                	test   %edi,%edi
+  8020da:	78 08                	js     8020e4 <mmap+0x146>
+}
+  8020dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020df:	5b                   	pop    %ebx
+  8020e0:	5e                   	pop    %esi
+  8020e1:	5f                   	pop    %edi
+  8020e2:	5d                   	pop    %ebp
+  8020e3:	c3                   	ret
+		munmap((void*) va, len);
+  8020e4:	83 ec 08             	sub    $0x8,%esp
+  8020e7:	56                   	push   %esi
+  8020e8:	53                   	push   %ebx
+  8020e9:	e8 71 fe ff ff       	call   801f5f <munmap>
+		return NULL;
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  8020f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f6:	eb e4                	jmp    8020dc <mmap+0x13e>
+		return NULL;
+  8020f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fd:	eb dd                	jmp    8020dc <mmap+0x13e>
+		return NULL;
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802104:	eb d6                	jmp    8020dc <mmap+0x13e>
+  802106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210b:	eb cf                	jmp    8020dc <mmap+0x13e>
+
+0080210d <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	53                   	push   %ebx
+  802111:	83 ec 10             	sub    $0x10,%esp
+  802114:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802117:	53                   	push   %ebx
+  802118:	e8 9b ea ff ff       	call   800bb8 <strlen>
+  80211d:	83 c4 10             	add    $0x10,%esp
+  802120:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802125:	7f 42                	jg     802169 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802127:	83 ec 0c             	sub    $0xc,%esp
+  80212a:	68 14 70 80 00       	push   $0x807014
+  80212f:	e8 5d 15 00 00       	call   803691 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802134:	83 c4 08             	add    $0x8,%esp
+  802137:	53                   	push   %ebx
+  802138:	68 00 80 80 00       	push   $0x808000
+  80213d:	e8 b1 ea ff ff       	call   800bf3 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802142:	ba 00 00 00 00       	mov    $0x0,%edx
+  802147:	b8 07 00 00 00       	mov    $0x7,%eax
+  80214c:	e8 b9 f9 ff ff       	call   801b0a <fsipc>
+  802151:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802153:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  80215a:	e8 9f 15 00 00       	call   8036fe <mutex_unlock>
+	return r;
+  80215f:	83 c4 10             	add    $0x10,%esp
+}
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+		return -E_BAD_PATH;
+  802169:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80216e:	eb f2                	jmp    802162 <remove+0x55>
+
+00802170 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	53                   	push   %ebx
+  802174:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802177:	68 14 70 80 00       	push   $0x807014
+  80217c:	e8 10 15 00 00       	call   803691 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802181:	ba 00 00 00 00       	mov    $0x0,%edx
+  802186:	b8 08 00 00 00       	mov    $0x8,%eax
+  80218b:	e8 7a f9 ff ff       	call   801b0a <fsipc>
+  802190:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802192:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  802199:	e8 60 15 00 00       	call   8036fe <mutex_unlock>
+	return r;
+}
+  80219e:	89 d8                	mov    %ebx,%eax
+  8021a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a3:	c9                   	leave
+  8021a4:	c3                   	ret
+
+008021a5 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8021a5:	55                   	push   %ebp
+  8021a6:	89 e5                	mov    %esp,%ebp
+  8021a8:	56                   	push   %esi
+  8021a9:	53                   	push   %ebx
+  8021aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8021ad:	83 ec 0c             	sub    $0xc,%esp
+  8021b0:	68 14 70 80 00       	push   $0x807014
+  8021b5:	e8 d7 14 00 00       	call   803691 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8021ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bd:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8021c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021cc:	e8 39 f9 ff ff       	call   801b0a <fsipc>
+  8021d1:	89 c6                	mov    %eax,%esi
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	85 db                	test   %ebx,%ebx
+  8021d8:	74 7b                	je     802255 <fs_bcstat+0xb0>
+  8021da:	85 c0                	test   %eax,%eax
+  8021dc:	78 77                	js     802255 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8021de:	a1 00 80 80 00       	mov    0x808000,%eax
+  8021e3:	89 03                	mov    %eax,(%ebx)
+  8021e5:	a1 04 80 80 00       	mov    0x808004,%eax
+  8021ea:	89 43 04             	mov    %eax,0x4(%ebx)
+  8021ed:	a1 08 80 80 00       	mov    0x808008,%eax
+  8021f2:	89 43 08             	mov    %eax,0x8(%ebx)
+  8021f5:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8021fa:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021fd:	a1 10 80 80 00       	mov    0x808010,%eax
+  802202:	89 43 10             	mov    %eax,0x10(%ebx)
+  802205:	a1 14 80 80 00       	mov    0x808014,%eax
+  80220a:	89 43 14             	mov    %eax,0x14(%ebx)
+  80220d:	a1 18 80 80 00       	mov    0x808018,%eax
+  802212:	89 43 18             	mov    %eax,0x18(%ebx)
+  802215:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  80221a:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80221d:	a1 20 80 80 00       	mov    0x808020,%eax
+  802222:	89 43 20             	mov    %eax,0x20(%ebx)
+  802225:	a1 24 80 80 00       	mov    0x808024,%eax
+  80222a:	89 43 24             	mov    %eax,0x24(%ebx)
+  80222d:	a1 28 80 80 00       	mov    0x808028,%eax
+  802232:	89 43 28             	mov    %eax,0x28(%ebx)
+  802235:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  80223a:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80223d:	a1 30 80 80 00       	mov    0x808030,%eax
+  802242:	89 43 30             	mov    %eax,0x30(%ebx)
+  802245:	a1 34 80 80 00       	mov    0x808034,%eax
+  80224a:	89 43 34             	mov    %eax,0x34(%ebx)
+  80224d:	a1 38 80 80 00       	mov    0x808038,%eax
+  802252:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802255:	83 ec 0c             	sub    $0xc,%esp
+  802258:	68 14 70 80 00       	push   $0x807014
+  80225d:	e8 9c 14 00 00       	call   8036fe <mutex_unlock>
+	return r;
+}
+  802262:	89 f0                	mov    %esi,%eax
+  802264:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802267:	5b                   	pop    %ebx
+  802268:	5e                   	pop    %esi
+  802269:	5d                   	pop    %ebp
+  80226a:	c3                   	ret
+
+0080226b <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	56                   	push   %esi
+  80226f:	53                   	push   %ebx
+  802270:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802272:	0f b6 10             	movzbl (%eax),%edx
+  802275:	80 fa 72             	cmp    $0x72,%dl
+  802278:	74 44                	je     8022be <parse_mode+0x53>
+  80227a:	80 fa 77             	cmp    $0x77,%dl
+  80227d:	74 4b                	je     8022ca <parse_mode+0x5f>
+  80227f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802284:	80 fa 61             	cmp    $0x61,%dl
+  802287:	74 09                	je     802292 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802289:	89 d8                	mov    %ebx,%eax
+  80228b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228e:	5b                   	pop    %ebx
+  80228f:	5e                   	pop    %esi
+  802290:	5d                   	pop    %ebp
+  802291:	c3                   	ret
+	switch (mode[0]) {
+  802292:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802297:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80229c:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80229e:	83 ec 08             	sub    $0x8,%esp
+  8022a1:	6a 2b                	push   $0x2b
+  8022a3:	50                   	push   %eax
+  8022a4:	e8 5c ea ff ff       	call   800d05 <strchr>
+  8022a9:	83 c4 10             	add    $0x10,%esp
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	74 d9                	je     802289 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8022b0:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8022b3:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8022b6:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8022bc:	eb cb                	jmp    802289 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8022be:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c8:	eb d2                	jmp    80229c <parse_mode+0x31>
+  8022ca:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8022cf:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8022d4:	eb c6                	jmp    80229c <parse_mode+0x31>
+
+008022d6 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	57                   	push   %edi
+  8022da:	56                   	push   %esi
+  8022db:	53                   	push   %ebx
+  8022dc:	83 ec 1c             	sub    $0x1c,%esp
+  8022df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022e2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022e5:	b8 44 60 80 00       	mov    $0x806044,%eax
+  8022ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8022ef:	83 c0 24             	add    $0x24,%eax
+  8022f2:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8022f6:	74 17                	je     80230f <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022f8:	83 c3 01             	add    $0x1,%ebx
+  8022fb:	83 fb 10             	cmp    $0x10,%ebx
+  8022fe:	75 ef                	jne    8022ef <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802300:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802305:	89 f0                	mov    %esi,%eax
+  802307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80230a:	5b                   	pop    %ebx
+  80230b:	5e                   	pop    %esi
+  80230c:	5f                   	pop    %edi
+  80230d:	5d                   	pop    %ebp
+  80230e:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80230f:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802316:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802319:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80231c:	c1 e7 02             	shl    $0x2,%edi
+  80231f:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	6a 24                	push   $0x24
+  80232a:	6a 00                	push   $0x0
+  80232c:	56                   	push   %esi
+  80232d:	e8 12 ea ff ff       	call   800d44 <memset>
+			streams[i].f_fd = fd;
+  802332:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802335:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  80233b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80233e:	01 d8                	add    %ebx,%eax
+  802340:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802343:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	eb b6                	jmp    802305 <stream_alloc+0x2f>
+
+0080234f <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	53                   	push   %ebx
+  802353:	83 ec 14             	sub    $0x14,%esp
+  802356:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802358:	8b 40 18             	mov    0x18(%eax),%eax
+  80235b:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80235e:	74 4a                	je     8023aa <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802360:	83 ec 08             	sub    $0x8,%esp
+  802363:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802366:	50                   	push   %eax
+  802367:	ff 33                	push   (%ebx)
+  802369:	e8 e2 f1 ff ff       	call   801550 <fd_lookup>
+  80236e:	89 c2                	mov    %eax,%edx
+  802370:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802373:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802378:	85 d2                	test   %edx,%edx
+  80237a:	78 41                	js     8023bd <stream_unread+0x6e>
+  80237c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80237f:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802385:	39 0a                	cmp    %ecx,(%edx)
+  802387:	75 34                	jne    8023bd <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802389:	8b 43 14             	mov    0x14(%ebx),%eax
+  80238c:	03 42 04             	add    0x4(%edx),%eax
+  80238f:	2b 43 18             	sub    0x18(%ebx),%eax
+  802392:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802395:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80239c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8023a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a8:	eb 13                	jmp    8023bd <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8023aa:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8023b1:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8023b8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c0:	c9                   	leave
+  8023c1:	c3                   	ret
+
+008023c2 <stream_drain>:
+{
+  8023c2:	55                   	push   %ebp
+  8023c3:	89 e5                	mov    %esp,%ebp
+  8023c5:	56                   	push   %esi
+  8023c6:	53                   	push   %ebx
+  8023c7:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8023c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ce:	eb 02                	jmp    8023d2 <stream_drain+0x10>
+  8023d0:	01 c3                	add    %eax,%ebx
+  8023d2:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023d5:	39 c3                	cmp    %eax,%ebx
+  8023d7:	73 43                	jae    80241c <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8023d9:	83 ec 04             	sub    $0x4,%esp
+  8023dc:	29 d8                	sub    %ebx,%eax
+  8023de:	50                   	push   %eax
+  8023df:	89 d8                	mov    %ebx,%eax
+  8023e1:	03 46 0c             	add    0xc(%esi),%eax
+  8023e4:	50                   	push   %eax
+  8023e5:	ff 36                	push   (%esi)
+  8023e7:	e8 ec f4 ff ff       	call   8018d8 <write>
+  8023ec:	83 c4 10             	add    $0x10,%esp
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	7f dd                	jg     8023d0 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8023f3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8023f7:	8b 56 0c             	mov    0xc(%esi),%edx
+  8023fa:	83 ec 04             	sub    $0x4,%esp
+  8023fd:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802400:	29 d8                	sub    %ebx,%eax
+  802402:	50                   	push   %eax
+  802403:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802406:	50                   	push   %eax
+  802407:	52                   	push   %edx
+  802408:	e8 6c e9 ff ff       	call   800d79 <memmove>
+			f->f_wend -= done;
+  80240d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802410:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80241a:	eb 0a                	jmp    802426 <stream_drain+0x64>
+  80241c:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802421:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802426:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802429:	89 d0                	mov    %edx,%eax
+  80242b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242e:	5b                   	pop    %ebx
+  80242f:	5e                   	pop    %esi
+  802430:	5d                   	pop    %ebp
+  802431:	c3                   	ret
+
+00802432 <stream_setup>:
+	if (f->f_buf)
+  802432:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802436:	74 01                	je     802439 <stream_setup+0x7>
+  802438:	c3                   	ret
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 04             	sub    $0x4,%esp
+  802440:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802442:	8b 40 08             	mov    0x8(%eax),%eax
+  802445:	85 c0                	test   %eax,%eax
+  802447:	74 17                	je     802460 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802449:	83 f8 03             	cmp    $0x3,%eax
+  80244c:	75 2d                	jne    80247b <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80244e:	8d 43 20             	lea    0x20(%ebx),%eax
+  802451:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802454:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80245b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802460:	83 ec 0c             	sub    $0xc,%esp
+  802463:	ff 33                	push   (%ebx)
+  802465:	e8 29 1b 00 00       	call   803f93 <iscons>
+  80246a:	83 c4 10             	add    $0x10,%esp
+  80246d:	85 c0                	test   %eax,%eax
+  80246f:	0f 9f c0             	setg   %al
+  802472:	0f b6 c0             	movzbl %al,%eax
+  802475:	83 c0 01             	add    $0x1,%eax
+  802478:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80247b:	83 ec 0c             	sub    $0xc,%esp
+  80247e:	68 00 10 00 00       	push   $0x1000
+  802483:	e8 6e 0b 00 00       	call   802ff6 <malloc>
+  802488:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	74 bc                	je     80244e <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802492:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802499:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80249d:	eb bc                	jmp    80245b <stream_setup+0x29>
+
+0080249f <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80249f:	55                   	push   %ebp
+  8024a0:	89 e5                	mov    %esp,%ebp
+  8024a2:	53                   	push   %ebx
+  8024a3:	83 ec 04             	sub    $0x4,%esp
+  8024a6:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8024a8:	e8 85 ff ff ff       	call   802432 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8024ad:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8024b2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8024b6:	74 3d                	je     8024f5 <stream_fill+0x56>
+  8024b8:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8024bc:	74 10                	je     8024ce <stream_fill+0x2f>
+  8024be:	89 d8                	mov    %ebx,%eax
+  8024c0:	e8 fd fe ff ff       	call   8023c2 <stream_drain>
+		return 0;
+  8024c5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 27                	js     8024f5 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8024ce:	83 ec 04             	sub    $0x4,%esp
+  8024d1:	ff 73 10             	push   0x10(%ebx)
+  8024d4:	ff 73 0c             	push   0xc(%ebx)
+  8024d7:	ff 33                	push   (%ebx)
+  8024d9:	e8 02 f3 ff ff       	call   8017e0 <read>
+  8024de:	83 c4 10             	add    $0x10,%esp
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	7e 17                	jle    8024fc <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8024e5:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8024e9:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8024f0:	89 c2                	mov    %eax,%edx
+  8024f2:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8024f5:	89 d0                	mov    %edx,%eax
+  8024f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024fc:	c1 f8 1f             	sar    $0x1f,%eax
+  8024ff:	83 e0 04             	and    $0x4,%eax
+  802502:	83 c0 04             	add    $0x4,%eax
+  802505:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250d:	eb e6                	jmp    8024f5 <stream_fill+0x56>
+
+0080250f <fopen>:
+{
+  80250f:	55                   	push   %ebp
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	57                   	push   %edi
+  802513:	56                   	push   %esi
+  802514:	53                   	push   %ebx
+  802515:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80251b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80251e:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802524:	89 f0                	mov    %esi,%eax
+  802526:	e8 40 fd ff ff       	call   80226b <parse_mode>
+		return 0;
+  80252b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802530:	85 c0                	test   %eax,%eax
+  802532:	78 2d                	js     802561 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802534:	83 ec 08             	sub    $0x8,%esp
+  802537:	50                   	push   %eax
+  802538:	ff 75 08             	push   0x8(%ebp)
+  80253b:	e8 e8 f8 ff ff       	call   801e28 <open>
+  802540:	89 c7                	mov    %eax,%edi
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 58                	js     8025a1 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802549:	80 3e 61             	cmpb   $0x61,(%esi)
+  80254c:	74 1d                	je     80256b <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80254e:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802554:	89 f8                	mov    %edi,%eax
+  802556:	e8 7b fd ff ff       	call   8022d6 <stream_alloc>
+  80255b:	89 c3                	mov    %eax,%ebx
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	74 32                	je     802593 <fopen+0x84>
+}
+  802561:	89 d8                	mov    %ebx,%eax
+  802563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802566:	5b                   	pop    %ebx
+  802567:	5e                   	pop    %esi
+  802568:	5f                   	pop    %edi
+  802569:	5d                   	pop    %ebp
+  80256a:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802574:	50                   	push   %eax
+  802575:	57                   	push   %edi
+  802576:	e8 db f4 ff ff       	call   801a56 <fstat>
+  80257b:	83 c4 10             	add    $0x10,%esp
+  80257e:	85 c0                	test   %eax,%eax
+  802580:	78 cc                	js     80254e <fopen+0x3f>
+		seek(fd, st.st_size);
+  802582:	83 ec 08             	sub    $0x8,%esp
+  802585:	ff 75 dc             	push   -0x24(%ebp)
+  802588:	57                   	push   %edi
+  802589:	e8 f6 f3 ff ff       	call   801984 <seek>
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	eb bb                	jmp    80254e <fopen+0x3f>
+		close(fd);
+  802593:	83 ec 0c             	sub    $0xc,%esp
+  802596:	57                   	push   %edi
+  802597:	e8 08 f1 ff ff       	call   8016a4 <close>
+  80259c:	83 c4 10             	add    $0x10,%esp
+  80259f:	eb c0                	jmp    802561 <fopen+0x52>
+		return 0;
+  8025a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a6:	eb b9                	jmp    802561 <fopen+0x52>
+
+008025a8 <fdopen>:
+{
+  8025a8:	55                   	push   %ebp
+  8025a9:	89 e5                	mov    %esp,%ebp
+  8025ab:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8025ae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025b4:	e8 b2 fc ff ff       	call   80226b <parse_mode>
+  8025b9:	89 c2                	mov    %eax,%edx
+		return 0;
+  8025bb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8025c0:	85 d2                	test   %edx,%edx
+  8025c2:	78 0b                	js     8025cf <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8025c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ca:	e8 07 fd ff ff       	call   8022d6 <stream_alloc>
+}
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+008025d1 <setvbuf>:
+{
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	57                   	push   %edi
+  8025d5:	56                   	push   %esi
+  8025d6:	53                   	push   %ebx
+  8025d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025da:	8b 55 10             	mov    0x10(%ebp),%edx
+  8025dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8025e0:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8025e4:	75 3a                	jne    802620 <setvbuf+0x4f>
+  8025e6:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8025e9:	83 fe 02             	cmp    $0x2,%esi
+  8025ec:	77 39                	ja     802627 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8025ee:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8025f1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8025f5:	0f 95 c3             	setne  %bl
+  8025f8:	85 ff                	test   %edi,%edi
+  8025fa:	0f 95 c1             	setne  %cl
+  8025fd:	84 cb                	test   %cl,%bl
+  8025ff:	74 05                	je     802606 <setvbuf+0x35>
+  802601:	83 fa 03             	cmp    $0x3,%edx
+  802604:	75 0a                	jne    802610 <setvbuf+0x3f>
+	return 0;
+  802606:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80260b:	5b                   	pop    %ebx
+  80260c:	5e                   	pop    %esi
+  80260d:	5f                   	pop    %edi
+  80260e:	5d                   	pop    %ebp
+  80260f:	c3                   	ret
+		f->f_buf = buf;
+  802610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802613:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802616:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261e:	eb eb                	jmp    80260b <setvbuf+0x3a>
+		return EOF;
+  802620:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802625:	eb e4                	jmp    80260b <setvbuf+0x3a>
+  802627:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80262c:	eb dd                	jmp    80260b <setvbuf+0x3a>
+
+0080262e <fflush>:
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 0c             	sub    $0xc,%esp
+  802637:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80263a:	85 db                	test   %ebx,%ebx
+  80263c:	74 1a                	je     802658 <fflush+0x2a>
+	stream_unread(f);
+  80263e:	89 d8                	mov    %ebx,%eax
+  802640:	e8 0a fd ff ff       	call   80234f <stream_unread>
+	return stream_drain(f);
+  802645:	89 d8                	mov    %ebx,%eax
+  802647:	e8 76 fd ff ff       	call   8023c2 <stream_drain>
+  80264c:	89 c7                	mov    %eax,%edi
+}
+  80264e:	89 f8                	mov    %edi,%eax
+  802650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802653:	5b                   	pop    %ebx
+  802654:	5e                   	pop    %esi
+  802655:	5f                   	pop    %edi
+  802656:	5d                   	pop    %ebp
+  802657:	c3                   	ret
+  802658:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  80265d:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802662:	bf 00 00 00 00       	mov    $0x0,%edi
+  802667:	eb 03                	jmp    80266c <fflush+0x3e>
+  802669:	83 c3 24             	add    $0x24,%ebx
+  80266c:	39 f3                	cmp    %esi,%ebx
+  80266e:	74 de                	je     80264e <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802670:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802674:	74 f3                	je     802669 <fflush+0x3b>
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	53                   	push   %ebx
+  80267a:	e8 af ff ff ff       	call   80262e <fflush>
+  80267f:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802682:	85 c0                	test   %eax,%eax
+  802684:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802689:	0f 48 f8             	cmovs  %eax,%edi
+  80268c:	eb db                	jmp    802669 <fflush+0x3b>
+
+0080268e <fclose>:
+{
+  80268e:	55                   	push   %ebp
+  80268f:	89 e5                	mov    %esp,%ebp
+  802691:	56                   	push   %esi
+  802692:	53                   	push   %ebx
+  802693:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802696:	83 ec 0c             	sub    $0xc,%esp
+  802699:	56                   	push   %esi
+  80269a:	e8 8f ff ff ff       	call   80262e <fflush>
+  80269f:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8026a1:	83 c4 04             	add    $0x4,%esp
+  8026a4:	ff 36                	push   (%esi)
+  8026a6:	e8 f9 ef ff ff       	call   8016a4 <close>
+  8026ab:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8026ae:	85 c0                	test   %eax,%eax
+  8026b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026b5:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8026b8:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8026bc:	75 10                	jne    8026ce <fclose+0x40>
+	f->f_flags = 0;
+  8026be:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8026c5:	89 d8                	mov    %ebx,%eax
+  8026c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ca:	5b                   	pop    %ebx
+  8026cb:	5e                   	pop    %esi
+  8026cc:	5d                   	pop    %ebp
+  8026cd:	c3                   	ret
+		free(f->f_buf);
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	ff 76 0c             	push   0xc(%esi)
+  8026d4:	e8 54 08 00 00       	call   802f2d <free>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	eb e0                	jmp    8026be <fclose+0x30>
+
+008026de <fileno>:
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8026e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e4:	8b 00                	mov    (%eax),%eax
+}
+  8026e6:	5d                   	pop    %ebp
+  8026e7:	c3                   	ret
+
+008026e8 <feof>:
+{
+  8026e8:	55                   	push   %ebp
+  8026e9:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8026eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ee:	8b 40 04             	mov    0x4(%eax),%eax
+  8026f1:	c1 e8 02             	shr    $0x2,%eax
+  8026f4:	83 e0 01             	and    $0x1,%eax
+}
+  8026f7:	5d                   	pop    %ebp
+  8026f8:	c3                   	ret
+
+008026f9 <ferror>:
+{
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8026fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ff:	8b 40 04             	mov    0x4(%eax),%eax
+  802702:	c1 e8 03             	shr    $0x3,%eax
+  802705:	83 e0 01             	and    $0x1,%eax
+}
+  802708:	5d                   	pop    %ebp
+  802709:	c3                   	ret
+
+0080270a <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	53                   	push   %ebx
+  80270e:	83 ec 04             	sub    $0x4,%esp
+  802711:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802714:	8b 43 18             	mov    0x18(%ebx),%eax
+  802717:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80271a:	74 15                	je     802731 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  80271c:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80271f:	8b 43 14             	mov    0x14(%ebx),%eax
+  802722:	8d 48 01             	lea    0x1(%eax),%ecx
+  802725:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802728:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  80272c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802731:	89 d8                	mov    %ebx,%eax
+  802733:	e8 67 fd ff ff       	call   80249f <stream_fill>
+  802738:	85 c0                	test   %eax,%eax
+  80273a:	75 e0                	jne    80271c <fgetc+0x12>
+		return EOF;
+  80273c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802741:	eb e9                	jmp    80272c <fgetc+0x22>
+
+00802743 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802743:	55                   	push   %ebp
+  802744:	89 e5                	mov    %esp,%ebp
+  802746:	57                   	push   %edi
+  802747:	56                   	push   %esi
+  802748:	53                   	push   %ebx
+  802749:	83 ec 1c             	sub    $0x1c,%esp
+  80274c:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80274f:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802754:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802757:	83 e8 01             	sub    $0x1,%eax
+  80275a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80275d:	eb 66                	jmp    8027c5 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80275f:	8b 46 14             	mov    0x14(%esi),%eax
+  802762:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802765:	29 c3                	sub    %eax,%ebx
+  802767:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80276a:	29 fa                	sub    %edi,%edx
+  80276c:	39 d3                	cmp    %edx,%ebx
+  80276e:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802771:	83 ec 04             	sub    $0x4,%esp
+  802774:	53                   	push   %ebx
+  802775:	6a 0a                	push   $0xa
+  802777:	03 46 0c             	add    0xc(%esi),%eax
+  80277a:	50                   	push   %eax
+  80277b:	e8 aa e6 ff ff       	call   800e2a <memfind>
+  802780:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802783:	8b 46 0c             	mov    0xc(%esi),%eax
+  802786:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802789:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80278c:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802794:	74 0b                	je     8027a1 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802796:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802799:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80279c:	29 d3                	sub    %edx,%ebx
+  80279e:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8027a1:	83 ec 04             	sub    $0x4,%esp
+  8027a4:	53                   	push   %ebx
+  8027a5:	01 c8                	add    %ecx,%eax
+  8027a7:	50                   	push   %eax
+  8027a8:	89 f8                	mov    %edi,%eax
+  8027aa:	03 45 08             	add    0x8(%ebp),%eax
+  8027ad:	50                   	push   %eax
+  8027ae:	e8 c6 e5 ff ff       	call   800d79 <memmove>
+		f->f_rpos += m;
+  8027b3:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8027b6:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8027b8:	83 c4 10             	add    $0x10,%esp
+  8027bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027be:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8027c3:	74 1f                	je     8027e4 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8027c5:	8d 47 01             	lea    0x1(%edi),%eax
+  8027c8:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8027cb:	73 17                	jae    8027e4 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8027cd:	8b 46 18             	mov    0x18(%esi),%eax
+  8027d0:	39 46 14             	cmp    %eax,0x14(%esi)
+  8027d3:	75 8a                	jne    80275f <fgets+0x1c>
+  8027d5:	89 f0                	mov    %esi,%eax
+  8027d7:	e8 c3 fc ff ff       	call   80249f <stream_fill>
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	0f 85 7b ff ff ff    	jne    80275f <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8027e4:	85 ff                	test   %edi,%edi
+  8027e6:	74 0f                	je     8027f7 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8027e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027eb:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8027ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	5e                   	pop    %esi
+  8027f4:	5f                   	pop    %edi
+  8027f5:	5d                   	pop    %ebp
+  8027f6:	c3                   	ret
+		return 0;
+  8027f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fc:	eb f1                	jmp    8027ef <fgets+0xac>
+
+008027fe <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8027fe:	55                   	push   %ebp
+  8027ff:	89 e5                	mov    %esp,%ebp
+  802801:	57                   	push   %edi
+  802802:	56                   	push   %esi
+  802803:	53                   	push   %ebx
+  802804:	83 ec 1c             	sub    $0x1c,%esp
+  802807:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  80280a:	89 f0                	mov    %esi,%eax
+  80280c:	e8 21 fc ff ff       	call   802432 <stream_setup>
+	want = size * n;
+  802811:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802814:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802818:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  80281b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802820:	eb 43                	jmp    802865 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802822:	29 d3                	sub    %edx,%ebx
+  802824:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802827:	29 f8                	sub    %edi,%eax
+  802829:	39 c3                	cmp    %eax,%ebx
+  80282b:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80282e:	83 ec 04             	sub    $0x4,%esp
+  802831:	53                   	push   %ebx
+  802832:	03 56 0c             	add    0xc(%esi),%edx
+  802835:	52                   	push   %edx
+  802836:	89 f8                	mov    %edi,%eax
+  802838:	03 45 08             	add    0x8(%ebp),%eax
+  80283b:	50                   	push   %eax
+  80283c:	e8 38 e5 ff ff       	call   800d79 <memmove>
+			f->f_rpos += m;
+  802841:	01 5e 14             	add    %ebx,0x14(%esi)
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	eb 1a                	jmp    802863 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802849:	83 ec 04             	sub    $0x4,%esp
+  80284c:	53                   	push   %ebx
+  80284d:	89 f8                	mov    %edi,%eax
+  80284f:	03 45 08             	add    0x8(%ebp),%eax
+  802852:	50                   	push   %eax
+  802853:	ff 36                	push   (%esi)
+  802855:	e8 86 ef ff ff       	call   8017e0 <read>
+  80285a:	89 c3                	mov    %eax,%ebx
+  80285c:	83 c4 10             	add    $0x10,%esp
+  80285f:	85 c0                	test   %eax,%eax
+  802861:	7e 36                	jle    802899 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802863:	01 df                	add    %ebx,%edi
+  802865:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802868:	39 c7                	cmp    %eax,%edi
+  80286a:	73 39                	jae    8028a5 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80286c:	8b 56 14             	mov    0x14(%esi),%edx
+  80286f:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802872:	39 da                	cmp    %ebx,%edx
+  802874:	72 ac                	jb     802822 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802876:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802879:	29 fb                	sub    %edi,%ebx
+  80287b:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80287e:	72 3e                	jb     8028be <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802880:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802884:	74 1f                	je     8028a5 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802886:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80288a:	74 bd                	je     802849 <fread+0x4b>
+  80288c:	89 f0                	mov    %esi,%eax
+  80288e:	e8 2f fb ff ff       	call   8023c2 <stream_drain>
+  802893:	85 c0                	test   %eax,%eax
+  802895:	79 b2                	jns    802849 <fread+0x4b>
+  802897:	eb 0c                	jmp    8028a5 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802899:	c1 fb 1f             	sar    $0x1f,%ebx
+  80289c:	83 e3 04             	and    $0x4,%ebx
+  80289f:	83 c3 04             	add    $0x4,%ebx
+  8028a2:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8028a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a8:	85 c0                	test   %eax,%eax
+  8028aa:	74 0a                	je     8028b6 <fread+0xb8>
+  8028ac:	89 f8                	mov    %edi,%eax
+  8028ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b3:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8028b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b9:	5b                   	pop    %ebx
+  8028ba:	5e                   	pop    %esi
+  8028bb:	5f                   	pop    %edi
+  8028bc:	5d                   	pop    %ebp
+  8028bd:	c3                   	ret
+		} else if (!stream_fill(f))
+  8028be:	89 f0                	mov    %esi,%eax
+  8028c0:	e8 da fb ff ff       	call   80249f <stream_fill>
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	74 dc                	je     8028a5 <fread+0xa7>
+			m = 0;
+  8028c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ce:	eb 93                	jmp    802863 <fread+0x65>
+
+008028d0 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8028d0:	55                   	push   %ebp
+  8028d1:	89 e5                	mov    %esp,%ebp
+  8028d3:	57                   	push   %edi
+  8028d4:	56                   	push   %esi
+  8028d5:	53                   	push   %ebx
+  8028d6:	83 ec 1c             	sub    $0x1c,%esp
+  8028d9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8028dc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028df:	a8 02                	test   $0x2,%al
+  8028e1:	75 13                	jne    8028f6 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8028e3:	83 c8 08             	or     $0x8,%eax
+  8028e6:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8028ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f1:	5b                   	pop    %ebx
+  8028f2:	5e                   	pop    %esi
+  8028f3:	5f                   	pop    %edi
+  8028f4:	5d                   	pop    %ebp
+  8028f5:	c3                   	ret
+	stream_setup(f);
+  8028f6:	89 d8                	mov    %ebx,%eax
+  8028f8:	e8 35 fb ff ff       	call   802432 <stream_setup>
+	want = size * n;
+  8028fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802900:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802904:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802907:	89 d8                	mov    %ebx,%eax
+  802909:	e8 41 fa ff ff       	call   80234f <stream_unread>
+	for (done = 0; done < want; ) {
+  80290e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802913:	84 c0                	test   %al,%al
+  802915:	75 7b                	jne    802992 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802917:	be 00 00 00 00       	mov    $0x0,%esi
+  80291c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80291f:	39 fe                	cmp    %edi,%esi
+  802921:	73 24                	jae    802947 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802923:	83 ec 04             	sub    $0x4,%esp
+  802926:	89 f8                	mov    %edi,%eax
+  802928:	29 f0                	sub    %esi,%eax
+  80292a:	50                   	push   %eax
+  80292b:	89 f0                	mov    %esi,%eax
+  80292d:	03 45 08             	add    0x8(%ebp),%eax
+  802930:	50                   	push   %eax
+  802931:	ff 33                	push   (%ebx)
+  802933:	e8 a0 ef ff ff       	call   8018d8 <write>
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	7e 04                	jle    802943 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80293f:	01 c6                	add    %eax,%esi
+  802941:	eb dc                	jmp    80291f <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802943:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802947:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	74 a0                	je     8028ee <fwrite+0x1e>
+  80294e:	89 f0                	mov    %esi,%eax
+  802950:	ba 00 00 00 00       	mov    $0x0,%edx
+  802955:	f7 75 0c             	divl   0xc(%ebp)
+  802958:	eb 94                	jmp    8028ee <fwrite+0x1e>
+			done += r;
+  80295a:	01 c7                	add    %eax,%edi
+			continue;
+  80295c:	eb 34                	jmp    802992 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80295e:	8b 73 10             	mov    0x10(%ebx),%esi
+  802961:	29 c6                	sub    %eax,%esi
+  802963:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802966:	29 fa                	sub    %edi,%edx
+  802968:	39 d6                	cmp    %edx,%esi
+  80296a:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80296d:	83 ec 04             	sub    $0x4,%esp
+  802970:	56                   	push   %esi
+  802971:	89 fa                	mov    %edi,%edx
+  802973:	03 55 08             	add    0x8(%ebp),%edx
+  802976:	52                   	push   %edx
+  802977:	03 43 0c             	add    0xc(%ebx),%eax
+  80297a:	50                   	push   %eax
+  80297b:	e8 f9 e3 ff ff       	call   800d79 <memmove>
+		f->f_wend += m;
+  802980:	89 f0                	mov    %esi,%eax
+  802982:	03 43 1c             	add    0x1c(%ebx),%eax
+  802985:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802988:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80298a:	83 c4 10             	add    $0x10,%esp
+  80298d:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802990:	74 5b                	je     8029ed <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802992:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802995:	39 c7                	cmp    %eax,%edi
+  802997:	73 2d                	jae    8029c6 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802999:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	75 be                	jne    80295e <fwrite+0x8e>
+  8029a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029a3:	29 fa                	sub    %edi,%edx
+  8029a5:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8029a8:	72 b4                	jb     80295e <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8029aa:	83 ec 04             	sub    $0x4,%esp
+  8029ad:	52                   	push   %edx
+  8029ae:	89 f8                	mov    %edi,%eax
+  8029b0:	03 45 08             	add    0x8(%ebp),%eax
+  8029b3:	50                   	push   %eax
+  8029b4:	ff 33                	push   (%ebx)
+  8029b6:	e8 1d ef ff ff       	call   8018d8 <write>
+  8029bb:	83 c4 10             	add    $0x10,%esp
+  8029be:	85 c0                	test   %eax,%eax
+  8029c0:	7f 98                	jg     80295a <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8029c2:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8029c6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8029c9:	83 f8 03             	cmp    $0x3,%eax
+  8029cc:	74 48                	je     802a16 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8029ce:	83 f8 02             	cmp    $0x2,%eax
+  8029d1:	74 27                	je     8029fa <fwrite+0x12a>
+	return size ? done / size : 0;
+  8029d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d6:	85 c0                	test   %eax,%eax
+  8029d8:	0f 84 10 ff ff ff    	je     8028ee <fwrite+0x1e>
+  8029de:	89 f8                	mov    %edi,%eax
+  8029e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e5:	f7 75 0c             	divl   0xc(%ebp)
+  8029e8:	e9 01 ff ff ff       	jmp    8028ee <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8029ed:	89 d8                	mov    %ebx,%eax
+  8029ef:	e8 ce f9 ff ff       	call   8023c2 <stream_drain>
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	79 9a                	jns    802992 <fwrite+0xc2>
+  8029f8:	eb cc                	jmp    8029c6 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8029fa:	83 ec 04             	sub    $0x4,%esp
+  8029fd:	57                   	push   %edi
+  8029fe:	6a 0a                	push   $0xa
+  802a00:	ff 75 08             	push   0x8(%ebp)
+  802a03:	e8 22 e4 ff ff       	call   800e2a <memfind>
+  802a08:	89 c2                	mov    %eax,%edx
+  802a0a:	89 f8                	mov    %edi,%eax
+  802a0c:	03 45 08             	add    0x8(%ebp),%eax
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	39 c2                	cmp    %eax,%edx
+  802a14:	74 bd                	je     8029d3 <fwrite+0x103>
+		stream_drain(f);
+  802a16:	89 d8                	mov    %ebx,%eax
+  802a18:	e8 a5 f9 ff ff       	call   8023c2 <stream_drain>
+  802a1d:	eb b4                	jmp    8029d3 <fwrite+0x103>
+
+00802a1f <fputc>:
+{
+  802a1f:	55                   	push   %ebp
+  802a20:	89 e5                	mov    %esp,%ebp
+  802a22:	53                   	push   %ebx
+  802a23:	83 ec 14             	sub    $0x14,%esp
+  802a26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802a29:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802a2c:	ff 75 0c             	push   0xc(%ebp)
+  802a2f:	6a 01                	push   $0x1
+  802a31:	6a 01                	push   $0x1
+  802a33:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a36:	50                   	push   %eax
+  802a37:	e8 94 fe ff ff       	call   8028d0 <fwrite>
+  802a3c:	83 c4 10             	add    $0x10,%esp
+  802a3f:	0f b6 db             	movzbl %bl,%ebx
+  802a42:	83 f8 01             	cmp    $0x1,%eax
+  802a45:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a4a:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+
+00802a52 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802a52:	55                   	push   %ebp
+  802a53:	89 e5                	mov    %esp,%ebp
+  802a55:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802a58:	ff 75 0c             	push   0xc(%ebp)
+  802a5b:	ff 75 08             	push   0x8(%ebp)
+  802a5e:	e8 bc ff ff ff       	call   802a1f <fputc>
+}
+  802a63:	83 c4 10             	add    $0x10,%esp
+  802a66:	c9                   	leave
+  802a67:	c3                   	ret
+
+00802a68 <fputs>:
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	56                   	push   %esi
+  802a6c:	53                   	push   %ebx
+  802a6d:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802a70:	83 ec 0c             	sub    $0xc,%esp
+  802a73:	56                   	push   %esi
+  802a74:	e8 3f e1 ff ff       	call   800bb8 <strlen>
+  802a79:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802a7b:	ff 75 0c             	push   0xc(%ebp)
+  802a7e:	50                   	push   %eax
+  802a7f:	6a 01                	push   $0x1
+  802a81:	56                   	push   %esi
+  802a82:	e8 49 fe ff ff       	call   8028d0 <fwrite>
+  802a87:	83 c4 20             	add    $0x20,%esp
+  802a8a:	39 d8                	cmp    %ebx,%eax
+  802a8c:	0f 95 c0             	setne  %al
+  802a8f:	0f b6 c0             	movzbl %al,%eax
+  802a92:	f7 d8                	neg    %eax
+}
+  802a94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a97:	5b                   	pop    %ebx
+  802a98:	5e                   	pop    %esi
+  802a99:	5d                   	pop    %ebp
+  802a9a:	c3                   	ret
+
+00802a9b <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	53                   	push   %ebx
+  802a9f:	83 ec 04             	sub    $0x4,%esp
+  802aa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802aa5:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802aa8:	50                   	push   %eax
+  802aa9:	ff 75 0c             	push   0xc(%ebp)
+  802aac:	53                   	push   %ebx
+  802aad:	68 52 2a 80 00       	push   $0x802a52
+  802ab2:	e8 4f dc ff ff       	call   800706 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802ab7:	8b 43 04             	mov    0x4(%ebx),%eax
+  802aba:	c1 e0 1c             	shl    $0x1c,%eax
+  802abd:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802acb:	68 f8 50 80 00       	push   $0x8050f8
+  802ad0:	ff 75 0c             	push   0xc(%ebp)
+  802ad3:	e8 1b e1 ff ff       	call   800bf3 <strcpy>
+	return 0;
+}
+  802ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802add:	c9                   	leave
+  802ade:	c3                   	ret
+
+00802adf <devsock_close>:
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	53                   	push   %ebx
+  802ae3:	83 ec 10             	sub    $0x10,%esp
+  802ae6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ae9:	53                   	push   %ebx
+  802aea:	e8 69 1d 00 00       	call   804858 <pageref>
+  802aef:	89 c2                	mov    %eax,%edx
+  802af1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802af4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802af9:	83 fa 01             	cmp    $0x1,%edx
+  802afc:	74 05                	je     802b03 <devsock_close+0x24>
+}
+  802afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	ff 73 0c             	push   0xc(%ebx)
+  802b09:	e8 b7 02 00 00       	call   802dc5 <nsipc_close>
+  802b0e:	83 c4 10             	add    $0x10,%esp
+  802b11:	eb eb                	jmp    802afe <devsock_close+0x1f>
+
+00802b13 <devsock_write>:
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b19:	6a 00                	push   $0x0
+  802b1b:	ff 75 10             	push   0x10(%ebp)
+  802b1e:	ff 75 0c             	push   0xc(%ebp)
+  802b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b24:	ff 70 0c             	push   0xc(%eax)
+  802b27:	e8 79 03 00 00       	call   802ea5 <nsipc_send>
+}
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+
+00802b2e <devsock_read>:
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b34:	6a 00                	push   $0x0
+  802b36:	ff 75 10             	push   0x10(%ebp)
+  802b39:	ff 75 0c             	push   0xc(%ebp)
+  802b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3f:	ff 70 0c             	push   0xc(%eax)
+  802b42:	e8 ef 02 00 00       	call   802e36 <nsipc_recv>
+}
+  802b47:	c9                   	leave
+  802b48:	c3                   	ret
+
+00802b49 <fd2sockid>:
+{
+  802b49:	55                   	push   %ebp
+  802b4a:	89 e5                	mov    %esp,%ebp
+  802b4c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b4f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b52:	52                   	push   %edx
+  802b53:	50                   	push   %eax
+  802b54:	e8 f7 e9 ff ff       	call   801550 <fd_lookup>
+  802b59:	83 c4 10             	add    $0x10,%esp
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 10                	js     802b70 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b63:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  802b69:	39 08                	cmp    %ecx,(%eax)
+  802b6b:	75 05                	jne    802b72 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b6d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b70:	c9                   	leave
+  802b71:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b77:	eb f7                	jmp    802b70 <fd2sockid+0x27>
+
+00802b79 <alloc_sockfd>:
+{
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	56                   	push   %esi
+  802b7d:	53                   	push   %ebx
+  802b7e:	83 ec 1c             	sub    $0x1c,%esp
+  802b81:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b86:	50                   	push   %eax
+  802b87:	e8 6e e9 ff ff       	call   8014fa <fd_alloc>
+  802b8c:	89 c3                	mov    %eax,%ebx
+  802b8e:	83 c4 10             	add    $0x10,%esp
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	78 43                	js     802bd8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b95:	83 ec 04             	sub    $0x4,%esp
+  802b98:	68 07 04 00 00       	push   $0x407
+  802b9d:	ff 75 f4             	push   -0xc(%ebp)
+  802ba0:	6a 00                	push   $0x0
+  802ba2:	e8 8a e4 ff ff       	call   801031 <sys_page_alloc>
+  802ba7:	89 c3                	mov    %eax,%ebx
+  802ba9:	83 c4 10             	add    $0x10,%esp
+  802bac:	85 c0                	test   %eax,%eax
+  802bae:	78 28                	js     802bd8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb3:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  802bb9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802bbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bbe:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802bc5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802bc8:	83 ec 0c             	sub    $0xc,%esp
+  802bcb:	50                   	push   %eax
+  802bcc:	e8 02 e9 ff ff       	call   8014d3 <fd2num>
+  802bd1:	89 c3                	mov    %eax,%ebx
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	eb 0c                	jmp    802be4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bd8:	83 ec 0c             	sub    $0xc,%esp
+  802bdb:	56                   	push   %esi
+  802bdc:	e8 e4 01 00 00       	call   802dc5 <nsipc_close>
+		return r;
+  802be1:	83 c4 10             	add    $0x10,%esp
+}
+  802be4:	89 d8                	mov    %ebx,%eax
+  802be6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be9:	5b                   	pop    %ebx
+  802bea:	5e                   	pop    %esi
+  802beb:	5d                   	pop    %ebp
+  802bec:	c3                   	ret
+
+00802bed <accept>:
+{
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf6:	e8 4e ff ff ff       	call   802b49 <fd2sockid>
+  802bfb:	85 c0                	test   %eax,%eax
+  802bfd:	78 1b                	js     802c1a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bff:	83 ec 04             	sub    $0x4,%esp
+  802c02:	ff 75 10             	push   0x10(%ebp)
+  802c05:	ff 75 0c             	push   0xc(%ebp)
+  802c08:	50                   	push   %eax
+  802c09:	e8 0e 01 00 00       	call   802d1c <nsipc_accept>
+  802c0e:	83 c4 10             	add    $0x10,%esp
+  802c11:	85 c0                	test   %eax,%eax
+  802c13:	78 05                	js     802c1a <accept+0x2d>
+	return alloc_sockfd(r);
+  802c15:	e8 5f ff ff ff       	call   802b79 <alloc_sockfd>
+}
+  802c1a:	c9                   	leave
+  802c1b:	c3                   	ret
+
+00802c1c <bind>:
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c25:	e8 1f ff ff ff       	call   802b49 <fd2sockid>
+  802c2a:	85 c0                	test   %eax,%eax
+  802c2c:	78 12                	js     802c40 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c2e:	83 ec 04             	sub    $0x4,%esp
+  802c31:	ff 75 10             	push   0x10(%ebp)
+  802c34:	ff 75 0c             	push   0xc(%ebp)
+  802c37:	50                   	push   %eax
+  802c38:	e8 31 01 00 00       	call   802d6e <nsipc_bind>
+  802c3d:	83 c4 10             	add    $0x10,%esp
+}
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+
+00802c42 <shutdown>:
+{
+  802c42:	55                   	push   %ebp
+  802c43:	89 e5                	mov    %esp,%ebp
+  802c45:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4b:	e8 f9 fe ff ff       	call   802b49 <fd2sockid>
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	78 0f                	js     802c63 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c54:	83 ec 08             	sub    $0x8,%esp
+  802c57:	ff 75 0c             	push   0xc(%ebp)
+  802c5a:	50                   	push   %eax
+  802c5b:	e8 43 01 00 00       	call   802da3 <nsipc_shutdown>
+  802c60:	83 c4 10             	add    $0x10,%esp
+}
+  802c63:	c9                   	leave
+  802c64:	c3                   	ret
+
+00802c65 <connect>:
+{
+  802c65:	55                   	push   %ebp
+  802c66:	89 e5                	mov    %esp,%ebp
+  802c68:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6e:	e8 d6 fe ff ff       	call   802b49 <fd2sockid>
+  802c73:	85 c0                	test   %eax,%eax
+  802c75:	78 12                	js     802c89 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c77:	83 ec 04             	sub    $0x4,%esp
+  802c7a:	ff 75 10             	push   0x10(%ebp)
+  802c7d:	ff 75 0c             	push   0xc(%ebp)
+  802c80:	50                   	push   %eax
+  802c81:	e8 59 01 00 00       	call   802ddf <nsipc_connect>
+  802c86:	83 c4 10             	add    $0x10,%esp
+}
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+
+00802c8b <listen>:
+{
+  802c8b:	55                   	push   %ebp
+  802c8c:	89 e5                	mov    %esp,%ebp
+  802c8e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c94:	e8 b0 fe ff ff       	call   802b49 <fd2sockid>
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	78 0f                	js     802cac <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c9d:	83 ec 08             	sub    $0x8,%esp
+  802ca0:	ff 75 0c             	push   0xc(%ebp)
+  802ca3:	50                   	push   %eax
+  802ca4:	e8 6b 01 00 00       	call   802e14 <nsipc_listen>
+  802ca9:	83 c4 10             	add    $0x10,%esp
+}
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802cb4:	ff 75 10             	push   0x10(%ebp)
+  802cb7:	ff 75 0c             	push   0xc(%ebp)
+  802cba:	ff 75 08             	push   0x8(%ebp)
+  802cbd:	e8 41 02 00 00       	call   802f03 <nsipc_socket>
+  802cc2:	83 c4 10             	add    $0x10,%esp
+  802cc5:	85 c0                	test   %eax,%eax
+  802cc7:	78 05                	js     802cce <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802cc9:	e8 ab fe ff ff       	call   802b79 <alloc_sockfd>
+}
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+
+00802cd0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802cd0:	55                   	push   %ebp
+  802cd1:	89 e5                	mov    %esp,%ebp
+  802cd3:	53                   	push   %ebx
+  802cd4:	83 ec 04             	sub    $0x4,%esp
+  802cd7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cd9:	83 3d 18 70 80 00 00 	cmpl   $0x0,0x807018
+  802ce0:	74 26                	je     802d08 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802ce2:	6a 07                	push   $0x7
+  802ce4:	68 00 90 80 00       	push   $0x809000
+  802ce9:	53                   	push   %ebx
+  802cea:	ff 35 18 70 80 00    	push   0x807018
+  802cf0:	e8 ce 1a 00 00       	call   8047c3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802cf5:	83 c4 0c             	add    $0xc,%esp
+  802cf8:	6a 00                	push   $0x0
+  802cfa:	6a 00                	push   $0x0
+  802cfc:	6a 00                	push   $0x0
+  802cfe:	e8 ca 19 00 00       	call   8046cd <ipc_recv>
+}
+  802d03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d06:	c9                   	leave
+  802d07:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d08:	83 ec 0c             	sub    $0xc,%esp
+  802d0b:	6a 02                	push   $0x2
+  802d0d:	e8 07 1b 00 00       	call   804819 <ipc_find_env>
+  802d12:	a3 18 70 80 00       	mov    %eax,0x807018
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	eb c6                	jmp    802ce2 <nsipc+0x12>
+
+00802d1c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d1c:	55                   	push   %ebp
+  802d1d:	89 e5                	mov    %esp,%ebp
+  802d1f:	56                   	push   %esi
+  802d20:	53                   	push   %ebx
+  802d21:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d27:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d2c:	8b 06                	mov    (%esi),%eax
+  802d2e:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d33:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d38:	e8 93 ff ff ff       	call   802cd0 <nsipc>
+  802d3d:	89 c3                	mov    %eax,%ebx
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	79 09                	jns    802d4c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d43:	89 d8                	mov    %ebx,%eax
+  802d45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d48:	5b                   	pop    %ebx
+  802d49:	5e                   	pop    %esi
+  802d4a:	5d                   	pop    %ebp
+  802d4b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d4c:	83 ec 04             	sub    $0x4,%esp
+  802d4f:	ff 35 10 90 80 00    	push   0x809010
+  802d55:	68 00 90 80 00       	push   $0x809000
+  802d5a:	ff 75 0c             	push   0xc(%ebp)
+  802d5d:	e8 17 e0 ff ff       	call   800d79 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d62:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d67:	89 06                	mov    %eax,(%esi)
+  802d69:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d6c:	eb d5                	jmp    802d43 <nsipc_accept+0x27>
+
+00802d6e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	53                   	push   %ebx
+  802d72:	83 ec 08             	sub    $0x8,%esp
+  802d75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d80:	53                   	push   %ebx
+  802d81:	ff 75 0c             	push   0xc(%ebp)
+  802d84:	68 04 90 80 00       	push   $0x809004
+  802d89:	e8 eb df ff ff       	call   800d79 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d8e:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d94:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d99:	e8 32 ff ff ff       	call   802cd0 <nsipc>
+}
+  802d9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da1:	c9                   	leave
+  802da2:	c3                   	ret
+
+00802da3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802da3:	55                   	push   %ebp
+  802da4:	89 e5                	mov    %esp,%ebp
+  802da6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dac:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802db1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802db4:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802db9:	b8 03 00 00 00       	mov    $0x3,%eax
+  802dbe:	e8 0d ff ff ff       	call   802cd0 <nsipc>
+}
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+00802dc5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802dcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dce:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802dd3:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dd8:	e8 f3 fe ff ff       	call   802cd0 <nsipc>
+}
+  802ddd:	c9                   	leave
+  802dde:	c3                   	ret
+
+00802ddf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ddf:	55                   	push   %ebp
+  802de0:	89 e5                	mov    %esp,%ebp
+  802de2:	53                   	push   %ebx
+  802de3:	83 ec 08             	sub    $0x8,%esp
+  802de6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dec:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802df1:	53                   	push   %ebx
+  802df2:	ff 75 0c             	push   0xc(%ebp)
+  802df5:	68 04 90 80 00       	push   $0x809004
+  802dfa:	e8 7a df ff ff       	call   800d79 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802dff:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802e05:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e0a:	e8 c1 fe ff ff       	call   802cd0 <nsipc>
+}
+  802e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e12:	c9                   	leave
+  802e13:	c3                   	ret
+
+00802e14 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e25:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802e2a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e2f:	e8 9c fe ff ff       	call   802cd0 <nsipc>
+}
+  802e34:	c9                   	leave
+  802e35:	c3                   	ret
+
+00802e36 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e36:	55                   	push   %ebp
+  802e37:	89 e5                	mov    %esp,%ebp
+  802e39:	56                   	push   %esi
+  802e3a:	53                   	push   %ebx
+  802e3b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e41:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e46:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802e4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e4f:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e54:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e59:	e8 72 fe ff ff       	call   802cd0 <nsipc>
+  802e5e:	89 c3                	mov    %eax,%ebx
+  802e60:	85 c0                	test   %eax,%eax
+  802e62:	78 22                	js     802e86 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e64:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e69:	39 c6                	cmp    %eax,%esi
+  802e6b:	0f 4e c6             	cmovle %esi,%eax
+  802e6e:	39 c3                	cmp    %eax,%ebx
+  802e70:	7f 1d                	jg     802e8f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e72:	83 ec 04             	sub    $0x4,%esp
+  802e75:	53                   	push   %ebx
+  802e76:	68 00 90 80 00       	push   $0x809000
+  802e7b:	ff 75 0c             	push   0xc(%ebp)
+  802e7e:	e8 f6 de ff ff       	call   800d79 <memmove>
+  802e83:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e86:	89 d8                	mov    %ebx,%eax
+  802e88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e8b:	5b                   	pop    %ebx
+  802e8c:	5e                   	pop    %esi
+  802e8d:	5d                   	pop    %ebp
+  802e8e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e8f:	68 04 51 80 00       	push   $0x805104
+  802e94:	68 bd 50 80 00       	push   $0x8050bd
+  802e99:	6a 62                	push   $0x62
+  802e9b:	68 19 51 80 00       	push   $0x805119
+  802ea0:	e8 6c 11 00 00       	call   804011 <_panic>
+
+00802ea5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ea5:	55                   	push   %ebp
+  802ea6:	89 e5                	mov    %esp,%ebp
+  802ea8:	53                   	push   %ebx
+  802ea9:	83 ec 04             	sub    $0x4,%esp
+  802eac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802eaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb2:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802eb7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ebd:	7f 2e                	jg     802eed <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ebf:	83 ec 04             	sub    $0x4,%esp
+  802ec2:	53                   	push   %ebx
+  802ec3:	ff 75 0c             	push   0xc(%ebp)
+  802ec6:	68 0c 90 80 00       	push   $0x80900c
+  802ecb:	e8 a9 de ff ff       	call   800d79 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ed0:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802ed6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ed9:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802ede:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ee3:	e8 e8 fd ff ff       	call   802cd0 <nsipc>
+}
+  802ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eeb:	c9                   	leave
+  802eec:	c3                   	ret
+	assert(size < 1600);
+  802eed:	68 25 51 80 00       	push   $0x805125
+  802ef2:	68 bd 50 80 00       	push   $0x8050bd
+  802ef7:	6a 6d                	push   $0x6d
+  802ef9:	68 19 51 80 00       	push   $0x805119
+  802efe:	e8 0e 11 00 00       	call   804011 <_panic>
+
+00802f03 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f03:	55                   	push   %ebp
+  802f04:	89 e5                	mov    %esp,%ebp
+  802f06:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802f11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f14:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f19:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f1c:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802f21:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f26:	e8 a5 fd ff ff       	call   802cd0 <nsipc>
+}
+  802f2b:	c9                   	leave
+  802f2c:	c3                   	ret
+
+00802f2d <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802f2d:	55                   	push   %ebp
+  802f2e:	89 e5                	mov    %esp,%ebp
+  802f30:	53                   	push   %ebx
+  802f31:	83 ec 10             	sub    $0x10,%esp
+  802f34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802f37:	68 1c 70 80 00       	push   $0x80701c
+  802f3c:	e8 50 07 00 00       	call   803691 <mutex_lock>
+	if (v == 0)
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	85 db                	test   %ebx,%ebx
+  802f46:	0f 84 85 00 00 00    	je     802fd1 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802f4c:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f52:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f57:	77 51                	ja     802faa <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802f59:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802f5f:	89 d8                	mov    %ebx,%eax
+  802f61:	c1 e8 0c             	shr    $0xc,%eax
+  802f64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f6b:	f6 c4 02             	test   $0x2,%ah
+  802f6e:	74 50                	je     802fc0 <free+0x93>
+		sys_page_unmap(0, c);
+  802f70:	83 ec 08             	sub    $0x8,%esp
+  802f73:	53                   	push   %ebx
+  802f74:	6a 00                	push   $0x0
+  802f76:	e8 4f e1 ff ff       	call   8010ca <sys_page_unmap>
+		c += PGSIZE;
+  802f7b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802f81:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f87:	83 c4 10             	add    $0x10,%esp
+  802f8a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f8f:	76 ce                	jbe    802f5f <free+0x32>
+  802f91:	68 6f 51 80 00       	push   $0x80516f
+  802f96:	68 bd 50 80 00       	push   $0x8050bd
+  802f9b:	68 82 00 00 00       	push   $0x82
+  802fa0:	68 62 51 80 00       	push   $0x805162
+  802fa5:	e8 67 10 00 00       	call   804011 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802faa:	68 34 51 80 00       	push   $0x805134
+  802faf:	68 bd 50 80 00       	push   $0x8050bd
+  802fb4:	6a 7b                	push   $0x7b
+  802fb6:	68 62 51 80 00       	push   $0x805162
+  802fbb:	e8 51 10 00 00       	call   804011 <_panic>
+	if (--(*ref) == 0)
+  802fc0:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802fc6:	83 e8 01             	sub    $0x1,%eax
+  802fc9:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802fcf:	74 15                	je     802fe6 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802fd1:	83 ec 0c             	sub    $0xc,%esp
+  802fd4:	68 1c 70 80 00       	push   $0x80701c
+  802fd9:	e8 20 07 00 00       	call   8036fe <mutex_unlock>
+}
+  802fde:	83 c4 10             	add    $0x10,%esp
+  802fe1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+		sys_page_unmap(0, c);
+  802fe6:	83 ec 08             	sub    $0x8,%esp
+  802fe9:	53                   	push   %ebx
+  802fea:	6a 00                	push   $0x0
+  802fec:	e8 d9 e0 ff ff       	call   8010ca <sys_page_unmap>
+  802ff1:	83 c4 10             	add    $0x10,%esp
+  802ff4:	eb db                	jmp    802fd1 <free+0xa4>
+
+00802ff6 <malloc>:
+{
+  802ff6:	55                   	push   %ebp
+  802ff7:	89 e5                	mov    %esp,%ebp
+  802ff9:	57                   	push   %edi
+  802ffa:	56                   	push   %esi
+  802ffb:	53                   	push   %ebx
+  802ffc:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802fff:	68 1c 70 80 00       	push   $0x80701c
+  803004:	e8 88 06 00 00       	call   803691 <mutex_lock>
+	if (mptr == 0)
+  803009:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	85 ff                	test   %edi,%edi
+  803014:	74 6c                	je     803082 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803016:	8b 45 08             	mov    0x8(%ebp),%eax
+  803019:	83 c0 03             	add    $0x3,%eax
+  80301c:	83 e0 fc             	and    $0xfffffffc,%eax
+  80301f:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803021:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803026:	0f 87 64 01 00 00    	ja     803190 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80302c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803032:	74 30                	je     803064 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803034:	89 f9                	mov    %edi,%ecx
+  803036:	c1 e9 0c             	shr    $0xc,%ecx
+  803039:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80303d:	c1 e8 0c             	shr    $0xc,%eax
+  803040:	39 c1                	cmp    %eax,%ecx
+  803042:	74 5f                	je     8030a3 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803044:	83 ec 0c             	sub    $0xc,%esp
+  803047:	57                   	push   %edi
+  803048:	e8 e0 fe ff ff       	call   802f2d <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80304d:	a1 20 70 80 00       	mov    0x807020,%eax
+  803052:	05 00 10 00 00       	add    $0x1000,%eax
+  803057:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80305c:	a3 20 70 80 00       	mov    %eax,0x807020
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+{
+  80306a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80306f:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803073:	8d 7e 04             	lea    0x4(%esi),%edi
+  803076:	89 cb                	mov    %ecx,%ebx
+  803078:	01 f9                	add    %edi,%ecx
+  80307a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80307d:	e9 8b 00 00 00       	jmp    80310d <malloc+0x117>
+		mptr = mbegin;
+  803082:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  803089:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80308c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308f:	83 c0 03             	add    $0x3,%eax
+  803092:	83 e0 fc             	and    $0xfffffffc,%eax
+  803095:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803097:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80309c:	76 c6                	jbe    803064 <malloc+0x6e>
+  80309e:	e9 d6 00 00 00       	jmp    803179 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8030a3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8030a9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8030ae:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8030b2:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8030b5:	a3 20 70 80 00       	mov    %eax,0x807020
+			return v;
+  8030ba:	e9 ba 00 00 00       	jmp    803179 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8030bf:	05 00 10 00 00       	add    $0x1000,%eax
+  8030c4:	39 c8                	cmp    %ecx,%eax
+  8030c6:	0f 83 cb 00 00 00    	jae    803197 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8030cc:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8030d1:	77 22                	ja     8030f5 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8030d3:	89 c2                	mov    %eax,%edx
+  8030d5:	c1 ea 16             	shr    $0x16,%edx
+  8030d8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8030df:	f6 c2 01             	test   $0x1,%dl
+  8030e2:	74 db                	je     8030bf <malloc+0xc9>
+  8030e4:	89 c2                	mov    %eax,%edx
+  8030e6:	c1 ea 0c             	shr    $0xc,%edx
+  8030e9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8030f0:	f6 c2 01             	test   $0x1,%dl
+  8030f3:	74 ca                	je     8030bf <malloc+0xc9>
+		if (mptr == mend) {
+  8030f5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030fb:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803101:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803105:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80310b:	74 04                	je     803111 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80310d:	89 d8                	mov    %ebx,%eax
+  80310f:	eb b3                	jmp    8030c4 <malloc+0xce>
+  803111:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803114:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803119:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80311d:	83 ea 01             	sub    $0x1,%edx
+  803120:	0f 85 50 ff ff ff    	jne    803076 <malloc+0x80>
+  803126:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  80312d:	00 00 08 
+				return 0;	/* out of address space */
+  803130:	bf 00 00 00 00       	mov    $0x0,%edi
+  803135:	eb 42                	jmp    803179 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803137:	85 db                	test   %ebx,%ebx
+  803139:	78 1e                	js     803159 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80313b:	83 ec 08             	sub    $0x8,%esp
+  80313e:	89 d8                	mov    %ebx,%eax
+  803140:	03 05 20 70 80 00    	add    0x807020,%eax
+  803146:	50                   	push   %eax
+  803147:	6a 00                	push   $0x0
+  803149:	e8 7c df ff ff       	call   8010ca <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80314e:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	eb de                	jmp    803137 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315e:	eb 19                	jmp    803179 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803160:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803163:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803169:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803170:	00 
+	mptr += n;
+  803171:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803174:	a3 20 70 80 00       	mov    %eax,0x807020
+	mutex_unlock(&malloc_mu);
+  803179:	83 ec 0c             	sub    $0xc,%esp
+  80317c:	68 1c 70 80 00       	push   $0x80701c
+  803181:	e8 78 05 00 00       	call   8036fe <mutex_unlock>
+}
+  803186:	89 f8                	mov    %edi,%eax
+  803188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80318b:	5b                   	pop    %ebx
+  80318c:	5e                   	pop    %esi
+  80318d:	5f                   	pop    %edi
+  80318e:	5d                   	pop    %ebp
+  80318f:	c3                   	ret
+		return 0;
+  803190:	bf 00 00 00 00       	mov    $0x0,%edi
+  803195:	eb e2                	jmp    803179 <malloc+0x183>
+  803197:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80319b:	74 06                	je     8031a3 <malloc+0x1ad>
+  80319d:	89 1d 20 70 80 00    	mov    %ebx,0x807020
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8031a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8031ab:	39 fb                	cmp    %edi,%ebx
+  8031ad:	73 b1                	jae    803160 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8031af:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8031b5:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8031b8:	39 fe                	cmp    %edi,%esi
+  8031ba:	0f 92 c0             	setb   %al
+  8031bd:	0f b6 c0             	movzbl %al,%eax
+  8031c0:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8031c3:	83 c8 07             	or     $0x7,%eax
+  8031c6:	50                   	push   %eax
+  8031c7:	89 d8                	mov    %ebx,%eax
+  8031c9:	03 05 20 70 80 00    	add    0x807020,%eax
+  8031cf:	50                   	push   %eax
+  8031d0:	6a 00                	push   $0x0
+  8031d2:	e8 5a de ff ff       	call   801031 <sys_page_alloc>
+  8031d7:	83 c4 10             	add    $0x10,%esp
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 55 ff ff ff    	js     803137 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8031e2:	89 f3                	mov    %esi,%ebx
+  8031e4:	eb c5                	jmp    8031ab <malloc+0x1b5>
+
+008031e6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	56                   	push   %esi
+  8031ea:	53                   	push   %ebx
+  8031eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031ee:	83 ec 0c             	sub    $0xc,%esp
+  8031f1:	ff 75 08             	push   0x8(%ebp)
+  8031f4:	e8 ea e2 ff ff       	call   8014e3 <fd2data>
+  8031f9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031fb:	83 c4 08             	add    $0x8,%esp
+  8031fe:	68 87 51 80 00       	push   $0x805187
+  803203:	53                   	push   %ebx
+  803204:	e8 ea d9 ff ff       	call   800bf3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803209:	8b 46 04             	mov    0x4(%esi),%eax
+  80320c:	2b 06                	sub    (%esi),%eax
+  80320e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803214:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80321b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80321e:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  803225:	62 80 00 
+	return 0;
+}
+  803228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803230:	5b                   	pop    %ebx
+  803231:	5e                   	pop    %esi
+  803232:	5d                   	pop    %ebp
+  803233:	c3                   	ret
+
+00803234 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803234:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803239:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80323d:	85 c9                	test   %ecx,%ecx
+  80323f:	75 01                	jne    803242 <pipewake+0xe>
+  803241:	c3                   	ret
+{
+  803242:	55                   	push   %ebp
+  803243:	89 e5                	mov    %esp,%ebp
+  803245:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803248:	68 00 04 00 00       	push   $0x400
+  80324d:	52                   	push   %edx
+  80324e:	e8 22 e1 ff ff       	call   801375 <sys_futex_wake>
+  803253:	83 c4 10             	add    $0x10,%esp
+}
+  803256:	c9                   	leave
+  803257:	c3                   	ret
+
+00803258 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	56                   	push   %esi
+  80325c:	53                   	push   %ebx
+  80325d:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803260:	83 ec 0c             	sub    $0xc,%esp
+  803263:	56                   	push   %esi
+  803264:	e8 7a e2 ff ff       	call   8014e3 <fd2data>
+  803269:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80326b:	83 c4 08             	add    $0x8,%esp
+  80326e:	56                   	push   %esi
+  80326f:	6a 00                	push   $0x0
+  803271:	e8 54 de ff ff       	call   8010ca <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803276:	8d 53 04             	lea    0x4(%ebx),%edx
+  803279:	8d 43 08             	lea    0x8(%ebx),%eax
+  80327c:	e8 b3 ff ff ff       	call   803234 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803281:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803284:	89 da                	mov    %ebx,%edx
+  803286:	e8 a9 ff ff ff       	call   803234 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80328b:	89 34 24             	mov    %esi,(%esp)
+  80328e:	e8 50 e2 ff ff       	call   8014e3 <fd2data>
+  803293:	83 c4 08             	add    $0x8,%esp
+  803296:	50                   	push   %eax
+  803297:	6a 00                	push   $0x0
+  803299:	e8 2c de ff ff       	call   8010ca <sys_page_unmap>
+}
+  80329e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a1:	5b                   	pop    %ebx
+  8032a2:	5e                   	pop    %esi
+  8032a3:	5d                   	pop    %ebp
+  8032a4:	c3                   	ret
+
+008032a5 <_pipeisclosed>:
+{
+  8032a5:	55                   	push   %ebp
+  8032a6:	89 e5                	mov    %esp,%ebp
+  8032a8:	57                   	push   %edi
+  8032a9:	56                   	push   %esi
+  8032aa:	53                   	push   %ebx
+  8032ab:	83 ec 1c             	sub    $0x1c,%esp
+  8032ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032b1:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032b3:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8032b8:	eb 5d                	jmp    803317 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8032ba:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		n = thisenv->env_runs;
+  8032c0:	8b 02                	mov    (%edx),%eax
+  8032c2:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8032c5:	83 ec 0c             	sub    $0xc,%esp
+  8032c8:	ff 75 e0             	push   -0x20(%ebp)
+  8032cb:	e8 88 15 00 00       	call   804858 <pageref>
+  8032d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032d3:	89 3c 24             	mov    %edi,(%esp)
+  8032d6:	e8 7d 15 00 00       	call   804858 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8032db:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032dd:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8032e3:	83 c4 10             	add    $0x10,%esp
+  8032e6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8032ec:	77 15                	ja     803303 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032ee:	89 f2                	mov    %esi,%edx
+  8032f0:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8032f2:	c1 ea 10             	shr    $0x10,%edx
+  8032f5:	74 0c                	je     803303 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8032f7:	c1 e2 10             	shl    $0x10,%edx
+  8032fa:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8032ff:	29 d1                	sub    %edx,%ecx
+  803301:	eb 06                	jmp    803309 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803303:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		nn = thisenv->env_runs;
+  803309:	8b 11                	mov    (%ecx),%edx
+  80330b:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80330e:	39 d3                	cmp    %edx,%ebx
+  803310:	74 6e                	je     803380 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803312:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803315:	74 24                	je     80333b <_pipeisclosed+0x96>
+  803317:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803319:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80331f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803324:	77 94                	ja     8032ba <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803326:	89 f0                	mov    %esi,%eax
+  803328:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80332a:	c1 e8 10             	shr    $0x10,%eax
+  80332d:	74 8b                	je     8032ba <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80332f:	c1 e0 10             	shl    $0x10,%eax
+  803332:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803337:	29 c2                	sub    %eax,%edx
+  803339:	eb 85                	jmp    8032c0 <_pipeisclosed+0x1b>
+  80333b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80333d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803343:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803348:	77 18                	ja     803362 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80334a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80334f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803351:	c1 e8 10             	shr    $0x10,%eax
+  803354:	74 0c                	je     803362 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803356:	c1 e0 10             	shl    $0x10,%eax
+  803359:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80335e:	29 c2                	sub    %eax,%edx
+  803360:	eb 06                	jmp    803368 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803362:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803368:	8b 02                	mov    (%edx),%eax
+  80336a:	8b 40 58             	mov    0x58(%eax),%eax
+  80336d:	6a 01                	push   $0x1
+  80336f:	50                   	push   %eax
+  803370:	53                   	push   %ebx
+  803371:	68 8e 51 80 00       	push   $0x80518e
+  803376:	e8 94 d2 ff ff       	call   80060f <cprintf>
+  80337b:	83 c4 10             	add    $0x10,%esp
+  80337e:	eb 97                	jmp    803317 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803380:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803383:	0f 94 c0             	sete   %al
+  803386:	0f b6 c0             	movzbl %al,%eax
+}
+  803389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338c:	5b                   	pop    %ebx
+  80338d:	5e                   	pop    %esi
+  80338e:	5f                   	pop    %edi
+  80338f:	5d                   	pop    %ebp
+  803390:	c3                   	ret
+
+00803391 <devpipe_write>:
+{
+  803391:	55                   	push   %ebp
+  803392:	89 e5                	mov    %esp,%ebp
+  803394:	57                   	push   %edi
+  803395:	56                   	push   %esi
+  803396:	53                   	push   %ebx
+  803397:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80339a:	ff 75 08             	push   0x8(%ebp)
+  80339d:	e8 41 e1 ff ff       	call   8014e3 <fd2data>
+  8033a2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033a4:	83 c4 10             	add    $0x10,%esp
+  8033a7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8033ae:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8033b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033b4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8033b7:	0f 84 96 00 00 00    	je     803453 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8033bd:	8d 73 08             	lea    0x8(%ebx),%esi
+  8033c0:	eb 32                	jmp    8033f4 <devpipe_write+0x63>
+  8033c2:	89 fa                	mov    %edi,%edx
+  8033c4:	89 f0                	mov    %esi,%eax
+  8033c6:	e8 69 fe ff ff       	call   803234 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8033cb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033ce:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8033d1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033d6:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8033db:	83 ec 04             	sub    $0x4,%esp
+  8033de:	6a 0a                	push   $0xa
+  8033e0:	50                   	push   %eax
+  8033e1:	53                   	push   %ebx
+  8033e2:	e8 5f df ff ff       	call   801346 <sys_futex_wait>
+  8033e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8033ec:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8033f1:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8033f4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033f7:	8b 0b                	mov    (%ebx),%ecx
+  8033f9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8033fc:	39 d0                	cmp    %edx,%eax
+  8033fe:	72 1b                	jb     80341b <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803400:	89 da                	mov    %ebx,%edx
+  803402:	8b 45 08             	mov    0x8(%ebp),%eax
+  803405:	e8 9b fe ff ff       	call   8032a5 <_pipeisclosed>
+  80340a:	85 c0                	test   %eax,%eax
+  80340c:	74 b4                	je     8033c2 <devpipe_write+0x31>
+				return 0;
+  80340e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803413:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803416:	5b                   	pop    %ebx
+  803417:	5e                   	pop    %esi
+  803418:	5f                   	pop    %edi
+  803419:	5d                   	pop    %ebp
+  80341a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80341b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80341e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803421:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803425:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803428:	89 c2                	mov    %eax,%edx
+  80342a:	c1 fa 1f             	sar    $0x1f,%edx
+  80342d:	89 d1                	mov    %edx,%ecx
+  80342f:	c1 e9 1b             	shr    $0x1b,%ecx
+  803432:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803435:	83 e2 1f             	and    $0x1f,%edx
+  803438:	29 ca                	sub    %ecx,%edx
+  80343a:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80343e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803442:	83 c0 01             	add    $0x1,%eax
+  803445:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803448:	83 c6 01             	add    $0x1,%esi
+  80344b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80344e:	e9 5e ff ff ff       	jmp    8033b1 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803453:	8d 53 04             	lea    0x4(%ebx),%edx
+  803456:	8d 43 08             	lea    0x8(%ebx),%eax
+  803459:	e8 d6 fd ff ff       	call   803234 <pipewake>
+	return i;
+  80345e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803461:	eb b0                	jmp    803413 <devpipe_write+0x82>
+
+00803463 <devpipe_read>:
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	57                   	push   %edi
+  803467:	56                   	push   %esi
+  803468:	53                   	push   %ebx
+  803469:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80346c:	ff 75 08             	push   0x8(%ebp)
+  80346f:	e8 6f e0 ff ff       	call   8014e3 <fd2data>
+  803474:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803476:	83 c4 10             	add    $0x10,%esp
+  803479:	be 00 00 00 00       	mov    $0x0,%esi
+  80347e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803481:	74 6c                	je     8034ef <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803483:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803486:	eb 25                	jmp    8034ad <devpipe_read+0x4a>
+  803488:	8b 13                	mov    (%ebx),%edx
+  80348a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80348f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803494:	83 ec 04             	sub    $0x4,%esp
+  803497:	6a 0a                	push   $0xa
+  803499:	52                   	push   %edx
+  80349a:	57                   	push   %edi
+  80349b:	e8 a6 de ff ff       	call   801346 <sys_futex_wait>
+  8034a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8034a5:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8034aa:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8034ad:	8b 03                	mov    (%ebx),%eax
+  8034af:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8034b2:	75 19                	jne    8034cd <devpipe_read+0x6a>
+			if (i > 0)
+  8034b4:	85 f6                	test   %esi,%esi
+  8034b6:	75 3a                	jne    8034f2 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8034b8:	89 da                	mov    %ebx,%edx
+  8034ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034bd:	e8 e3 fd ff ff       	call   8032a5 <_pipeisclosed>
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	74 c2                	je     803488 <devpipe_read+0x25>
+				return 0;
+  8034c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cb:	eb 31                	jmp    8034fe <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8034cd:	89 c1                	mov    %eax,%ecx
+  8034cf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8034d2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8034d5:	01 c8                	add    %ecx,%eax
+  8034d7:	83 e0 1f             	and    $0x1f,%eax
+  8034da:	29 c8                	sub    %ecx,%eax
+  8034dc:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8034e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034e4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8034e7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8034ea:	83 c6 01             	add    $0x1,%esi
+  8034ed:	eb 8f                	jmp    80347e <devpipe_read+0x1b>
+out:
+  8034ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8034f2:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8034f5:	89 da                	mov    %ebx,%edx
+  8034f7:	e8 38 fd ff ff       	call   803234 <pipewake>
+	return i;
+  8034fc:	89 f0                	mov    %esi,%eax
+}
+  8034fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803501:	5b                   	pop    %ebx
+  803502:	5e                   	pop    %esi
+  803503:	5f                   	pop    %edi
+  803504:	5d                   	pop    %ebp
+  803505:	c3                   	ret
+
+00803506 <pipe>:
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	56                   	push   %esi
+  80350a:	53                   	push   %ebx
+  80350b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80350e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803511:	50                   	push   %eax
+  803512:	e8 e3 df ff ff       	call   8014fa <fd_alloc>
+  803517:	89 c3                	mov    %eax,%ebx
+  803519:	83 c4 10             	add    $0x10,%esp
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	0f 88 23 01 00 00    	js     803647 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803524:	83 ec 04             	sub    $0x4,%esp
+  803527:	68 07 04 00 00       	push   $0x407
+  80352c:	ff 75 f4             	push   -0xc(%ebp)
+  80352f:	6a 00                	push   $0x0
+  803531:	e8 fb da ff ff       	call   801031 <sys_page_alloc>
+  803536:	89 c3                	mov    %eax,%ebx
+  803538:	83 c4 10             	add    $0x10,%esp
+  80353b:	85 c0                	test   %eax,%eax
+  80353d:	0f 88 04 01 00 00    	js     803647 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803543:	83 ec 0c             	sub    $0xc,%esp
+  803546:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803549:	50                   	push   %eax
+  80354a:	e8 ab df ff ff       	call   8014fa <fd_alloc>
+  80354f:	89 c3                	mov    %eax,%ebx
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	85 c0                	test   %eax,%eax
+  803556:	0f 88 db 00 00 00    	js     803637 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80355c:	83 ec 04             	sub    $0x4,%esp
+  80355f:	68 07 04 00 00       	push   $0x407
+  803564:	ff 75 f0             	push   -0x10(%ebp)
+  803567:	6a 00                	push   $0x0
+  803569:	e8 c3 da ff ff       	call   801031 <sys_page_alloc>
+  80356e:	89 c3                	mov    %eax,%ebx
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	85 c0                	test   %eax,%eax
+  803575:	0f 88 bc 00 00 00    	js     803637 <pipe+0x131>
+	va = fd2data(fd0);
+  80357b:	83 ec 0c             	sub    $0xc,%esp
+  80357e:	ff 75 f4             	push   -0xc(%ebp)
+  803581:	e8 5d df ff ff       	call   8014e3 <fd2data>
+  803586:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803588:	83 c4 0c             	add    $0xc,%esp
+  80358b:	68 07 04 00 00       	push   $0x407
+  803590:	50                   	push   %eax
+  803591:	6a 00                	push   $0x0
+  803593:	e8 99 da ff ff       	call   801031 <sys_page_alloc>
+  803598:	89 c3                	mov    %eax,%ebx
+  80359a:	83 c4 10             	add    $0x10,%esp
+  80359d:	85 c0                	test   %eax,%eax
+  80359f:	0f 88 82 00 00 00    	js     803627 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035a5:	83 ec 0c             	sub    $0xc,%esp
+  8035a8:	ff 75 f0             	push   -0x10(%ebp)
+  8035ab:	e8 33 df ff ff       	call   8014e3 <fd2data>
+  8035b0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035b7:	50                   	push   %eax
+  8035b8:	6a 00                	push   $0x0
+  8035ba:	56                   	push   %esi
+  8035bb:	6a 00                	push   $0x0
+  8035bd:	e8 bc da ff ff       	call   80107e <sys_page_map>
+  8035c2:	89 c3                	mov    %eax,%ebx
+  8035c4:	83 c4 20             	add    $0x20,%esp
+  8035c7:	85 c0                	test   %eax,%eax
+  8035c9:	78 4e                	js     803619 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8035cb:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  8035d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035d3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8035d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035d8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8035df:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8035e2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8035e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8035ee:	83 ec 0c             	sub    $0xc,%esp
+  8035f1:	ff 75 f4             	push   -0xc(%ebp)
+  8035f4:	e8 da de ff ff       	call   8014d3 <fd2num>
+  8035f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035fc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8035fe:	83 c4 04             	add    $0x4,%esp
+  803601:	ff 75 f0             	push   -0x10(%ebp)
+  803604:	e8 ca de ff ff       	call   8014d3 <fd2num>
+  803609:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80360c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80360f:	83 c4 10             	add    $0x10,%esp
+  803612:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803617:	eb 2e                	jmp    803647 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803619:	83 ec 08             	sub    $0x8,%esp
+  80361c:	56                   	push   %esi
+  80361d:	6a 00                	push   $0x0
+  80361f:	e8 a6 da ff ff       	call   8010ca <sys_page_unmap>
+  803624:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803627:	83 ec 08             	sub    $0x8,%esp
+  80362a:	ff 75 f0             	push   -0x10(%ebp)
+  80362d:	6a 00                	push   $0x0
+  80362f:	e8 96 da ff ff       	call   8010ca <sys_page_unmap>
+  803634:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803637:	83 ec 08             	sub    $0x8,%esp
+  80363a:	ff 75 f4             	push   -0xc(%ebp)
+  80363d:	6a 00                	push   $0x0
+  80363f:	e8 86 da ff ff       	call   8010ca <sys_page_unmap>
+  803644:	83 c4 10             	add    $0x10,%esp
+}
+  803647:	89 d8                	mov    %ebx,%eax
+  803649:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80364c:	5b                   	pop    %ebx
+  80364d:	5e                   	pop    %esi
+  80364e:	5d                   	pop    %ebp
+  80364f:	c3                   	ret
+
+00803650 <pipeisclosed>:
+{
+  803650:	55                   	push   %ebp
+  803651:	89 e5                	mov    %esp,%ebp
+  803653:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803656:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803659:	50                   	push   %eax
+  80365a:	ff 75 08             	push   0x8(%ebp)
+  80365d:	e8 ee de ff ff       	call   801550 <fd_lookup>
+  803662:	83 c4 10             	add    $0x10,%esp
+  803665:	85 c0                	test   %eax,%eax
+  803667:	78 18                	js     803681 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803669:	83 ec 0c             	sub    $0xc,%esp
+  80366c:	ff 75 f4             	push   -0xc(%ebp)
+  80366f:	e8 6f de ff ff       	call   8014e3 <fd2data>
+  803674:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803676:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803679:	e8 27 fc ff ff       	call   8032a5 <_pipeisclosed>
+  80367e:	83 c4 10             	add    $0x10,%esp
+}
+  803681:	c9                   	leave
+  803682:	c3                   	ret
+
+00803683 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803683:	55                   	push   %ebp
+  803684:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803686:	8b 45 08             	mov    0x8(%ebp),%eax
+  803689:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80368f:	5d                   	pop    %ebp
+  803690:	c3                   	ret
+
+00803691 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803691:	55                   	push   %ebp
+  803692:	89 e5                	mov    %esp,%ebp
+  803694:	56                   	push   %esi
+  803695:	53                   	push   %ebx
+  803696:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80369e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8036a3:	89 d0                	mov    %edx,%eax
+  8036a5:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8036a9:	85 c0                	test   %eax,%eax
+  8036ab:	74 2d                	je     8036da <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8036ad:	83 f8 02             	cmp    $0x2,%eax
+  8036b0:	74 08                	je     8036ba <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8036b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8036b7:	f0 87 03             	lock xchg %eax,(%ebx)
+  8036ba:	be 02 00 00 00       	mov    $0x2,%esi
+  8036bf:	eb 15                	jmp    8036d6 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8036c1:	83 ec 04             	sub    $0x4,%esp
+  8036c4:	6a 00                	push   $0x0
+  8036c6:	6a 02                	push   $0x2
+  8036c8:	53                   	push   %ebx
+  8036c9:	e8 78 dc ff ff       	call   801346 <sys_futex_wait>
+  8036ce:	89 f0                	mov    %esi,%eax
+  8036d0:	f0 87 03             	lock xchg %eax,(%ebx)
+  8036d3:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	75 e7                	jne    8036c1 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8036da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036dd:	5b                   	pop    %ebx
+  8036de:	5e                   	pop    %esi
+  8036df:	5d                   	pop    %ebp
+  8036e0:	c3                   	ret
+
+008036e1 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8036e1:	55                   	push   %ebp
+  8036e2:	89 e5                	mov    %esp,%ebp
+  8036e4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8036f1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8036f5:	f7 d8                	neg    %eax
+  8036f7:	19 c0                	sbb    %eax,%eax
+  8036f9:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8036fc:	5d                   	pop    %ebp
+  8036fd:	c3                   	ret
+
+008036fe <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8036fe:	55                   	push   %ebp
+  8036ff:	89 e5                	mov    %esp,%ebp
+  803701:	83 ec 08             	sub    $0x8,%esp
+  803704:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370c:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80370f:	83 f8 02             	cmp    $0x2,%eax
+  803712:	74 02                	je     803716 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803714:	c9                   	leave
+  803715:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803716:	83 ec 08             	sub    $0x8,%esp
+  803719:	6a 01                	push   $0x1
+  80371b:	52                   	push   %edx
+  80371c:	e8 54 dc ff ff       	call   801375 <sys_futex_wake>
+  803721:	83 c4 10             	add    $0x10,%esp
+}
+  803724:	eb ee                	jmp    803714 <mutex_unlock+0x16>
+
+00803726 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803726:	55                   	push   %ebp
+  803727:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80372c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803732:	5d                   	pop    %ebp
+  803733:	c3                   	ret
+
+00803734 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803734:	55                   	push   %ebp
+  803735:	89 e5                	mov    %esp,%ebp
+  803737:	57                   	push   %edi
+  803738:	56                   	push   %esi
+  803739:	53                   	push   %ebx
+  80373a:	83 ec 18             	sub    $0x18,%esp
+  80373d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803740:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803743:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803745:	53                   	push   %ebx
+  803746:	e8 b3 ff ff ff       	call   8036fe <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80374b:	83 c4 0c             	add    $0xc,%esp
+  80374e:	ff 75 10             	push   0x10(%ebp)
+  803751:	57                   	push   %edi
+  803752:	56                   	push   %esi
+  803753:	e8 ee db ff ff       	call   801346 <sys_futex_wait>
+  803758:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80375a:	83 c4 10             	add    $0x10,%esp
+  80375d:	be 02 00 00 00       	mov    $0x2,%esi
+  803762:	eb 10                	jmp    803774 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803764:	83 ec 04             	sub    $0x4,%esp
+  803767:	6a 00                	push   $0x0
+  803769:	6a 02                	push   $0x2
+  80376b:	53                   	push   %ebx
+  80376c:	e8 d5 db ff ff       	call   801346 <sys_futex_wait>
+  803771:	83 c4 10             	add    $0x10,%esp
+  803774:	89 f0                	mov    %esi,%eax
+  803776:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	75 e7                	jne    803764 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80377d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803780:	74 05                	je     803787 <cond_timedwait+0x53>
+  803782:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803787:	89 f8                	mov    %edi,%eax
+  803789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80378c:	5b                   	pop    %ebx
+  80378d:	5e                   	pop    %esi
+  80378e:	5f                   	pop    %edi
+  80378f:	5d                   	pop    %ebp
+  803790:	c3                   	ret
+
+00803791 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803791:	55                   	push   %ebp
+  803792:	89 e5                	mov    %esp,%ebp
+  803794:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803797:	6a 00                	push   $0x0
+  803799:	ff 75 0c             	push   0xc(%ebp)
+  80379c:	ff 75 08             	push   0x8(%ebp)
+  80379f:	e8 90 ff ff ff       	call   803734 <cond_timedwait>
+}
+  8037a4:	83 c4 10             	add    $0x10,%esp
+  8037a7:	c9                   	leave
+  8037a8:	c3                   	ret
+
+008037a9 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8037a9:	55                   	push   %ebp
+  8037aa:	89 e5                	mov    %esp,%ebp
+  8037ac:	83 ec 10             	sub    $0x10,%esp
+  8037af:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8037b2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037b7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8037bb:	6a 01                	push   $0x1
+  8037bd:	50                   	push   %eax
+  8037be:	e8 b2 db ff ff       	call   801375 <sys_futex_wake>
+}
+  8037c3:	83 c4 10             	add    $0x10,%esp
+  8037c6:	c9                   	leave
+  8037c7:	c3                   	ret
+
+008037c8 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8037c8:	55                   	push   %ebp
+  8037c9:	89 e5                	mov    %esp,%ebp
+  8037cb:	83 ec 10             	sub    $0x10,%esp
+  8037ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037d6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8037da:	68 00 04 00 00       	push   $0x400
+  8037df:	50                   	push   %eax
+  8037e0:	e8 90 db ff ff       	call   801375 <sys_futex_wake>
+}
+  8037e5:	83 c4 10             	add    $0x10,%esp
+  8037e8:	c9                   	leave
+  8037e9:	c3                   	ret
+
+008037ea <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8037ea:	55                   	push   %ebp
+  8037eb:	89 e5                	mov    %esp,%ebp
+  8037ed:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8037f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037f3:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8037f5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8037fc:	5d                   	pop    %ebp
+  8037fd:	c3                   	ret
+
+008037fe <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8037fe:	55                   	push   %ebp
+  8037ff:	89 e5                	mov    %esp,%ebp
+  803801:	53                   	push   %ebx
+  803802:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803805:	8b 11                	mov    (%ecx),%edx
+  803807:	85 d2                	test   %edx,%edx
+  803809:	74 14                	je     80381f <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  80380b:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80380e:	89 d0                	mov    %edx,%eax
+  803810:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803814:	39 c2                	cmp    %eax,%edx
+  803816:	75 ed                	jne    803805 <sem_trywait+0x7>
+			return 0;
+  803818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381d:	eb 05                	jmp    803824 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80381f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803824:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803827:	c9                   	leave
+  803828:	c3                   	ret
+
+00803829 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803829:	55                   	push   %ebp
+  80382a:	89 e5                	mov    %esp,%ebp
+  80382c:	57                   	push   %edi
+  80382d:	56                   	push   %esi
+  80382e:	53                   	push   %ebx
+  80382f:	83 ec 1c             	sub    $0x1c,%esp
+  803832:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803835:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803838:	e8 81 da ff ff       	call   8012be <sys_time_msec>
+  80383d:	01 f8                	add    %edi,%eax
+  80383f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803842:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803847:	eb 28                	jmp    803871 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803849:	b8 01 00 00 00       	mov    $0x1,%eax
+  80384e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803853:	83 ec 04             	sub    $0x4,%esp
+  803856:	56                   	push   %esi
+  803857:	6a 00                	push   $0x0
+  803859:	53                   	push   %ebx
+  80385a:	e8 e7 da ff ff       	call   801346 <sys_futex_wait>
+  80385f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803864:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803869:	83 c4 10             	add    $0x10,%esp
+  80386c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80386f:	74 2e                	je     80389f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803871:	83 ec 0c             	sub    $0xc,%esp
+  803874:	53                   	push   %ebx
+  803875:	e8 84 ff ff ff       	call   8037fe <sem_trywait>
+  80387a:	83 c4 10             	add    $0x10,%esp
+  80387d:	85 c0                	test   %eax,%eax
+  80387f:	79 19                	jns    80389a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803881:	85 ff                	test   %edi,%edi
+  803883:	74 c4                	je     803849 <sem_timedwait+0x20>
+  803885:	e8 34 da ff ff       	call   8012be <sys_time_msec>
+  80388a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80388d:	29 c6                	sub    %eax,%esi
+  80388f:	85 f6                	test   %esi,%esi
+  803891:	7f b6                	jg     803849 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803893:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803898:	eb 05                	jmp    80389f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  80389a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80389f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038a2:	5b                   	pop    %ebx
+  8038a3:	5e                   	pop    %esi
+  8038a4:	5f                   	pop    %edi
+  8038a5:	5d                   	pop    %ebp
+  8038a6:	c3                   	ret
+
+008038a7 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8038a7:	55                   	push   %ebp
+  8038a8:	89 e5                	mov    %esp,%ebp
+  8038aa:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8038ad:	6a 00                	push   $0x0
+  8038af:	ff 75 08             	push   0x8(%ebp)
+  8038b2:	e8 72 ff ff ff       	call   803829 <sem_timedwait>
+}
+  8038b7:	83 c4 10             	add    $0x10,%esp
+  8038ba:	c9                   	leave
+  8038bb:	c3                   	ret
+
+008038bc <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8038bc:	55                   	push   %ebp
+  8038bd:	89 e5                	mov    %esp,%ebp
+  8038bf:	83 ec 08             	sub    $0x8,%esp
+  8038c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038ca:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8038ce:	8b 50 04             	mov    0x4(%eax),%edx
+  8038d1:	85 d2                	test   %edx,%edx
+  8038d3:	75 02                	jne    8038d7 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8038d5:	c9                   	leave
+  8038d6:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8038d7:	83 ec 08             	sub    $0x8,%esp
+  8038da:	6a 01                	push   $0x1
+  8038dc:	50                   	push   %eax
+  8038dd:	e8 93 da ff ff       	call   801375 <sys_futex_wake>
+  8038e2:	83 c4 10             	add    $0x10,%esp
+}
+  8038e5:	eb ee                	jmp    8038d5 <sem_post+0x19>
+
+008038e7 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8038e7:	55                   	push   %ebp
+  8038e8:	89 e5                	mov    %esp,%ebp
+  8038ea:	57                   	push   %edi
+  8038eb:	56                   	push   %esi
+  8038ec:	53                   	push   %ebx
+  8038ed:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8038f0:	68 40 70 80 00       	push   $0x807040
+  8038f5:	e8 97 fd ff ff       	call   803691 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8038fa:	a1 64 70 80 00       	mov    0x807064,%eax
+  8038ff:	83 c4 10             	add    $0x10,%esp
+  803902:	85 c0                	test   %eax,%eax
+  803904:	75 19                	jne    80391f <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803906:	a1 e0 72 80 00       	mov    0x8072e0,%eax
+  80390b:	8b 00                	mov    (%eax),%eax
+  80390d:	8b 40 48             	mov    0x48(%eax),%eax
+  803910:	a3 60 70 80 00       	mov    %eax,0x807060
+		threads[0].th_state = PTH_RUNNING;
+  803915:	c7 05 64 70 80 00 01 	movl   $0x1,0x807064
+  80391c:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80391f:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803924:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803927:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  80392e:	8b 40 04             	mov    0x4(%eax),%eax
+  803931:	85 c0                	test   %eax,%eax
+  803933:	0f 84 e4 00 00 00    	je     803a1d <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803939:	83 c3 01             	add    $0x1,%ebx
+  80393c:	83 fb 20             	cmp    $0x20,%ebx
+  80393f:	75 e3                	jne    803924 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803941:	83 ec 0c             	sub    $0xc,%esp
+  803944:	68 40 70 80 00       	push   $0x807040
+  803949:	e8 b0 fd ff ff       	call   8036fe <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80394e:	83 c4 10             	add    $0x10,%esp
+  803951:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803956:	e9 b8 00 00 00       	jmp    803a13 <pthread_create+0x12c>
+  80395b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80395e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803961:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803963:	39 f3                	cmp    %esi,%ebx
+  803965:	73 16                	jae    80397d <pthread_create+0x96>
+		va -= PGSIZE;
+  803967:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80396d:	83 ec 08             	sub    $0x8,%esp
+  803970:	56                   	push   %esi
+  803971:	6a 00                	push   $0x0
+  803973:	e8 52 d7 ff ff       	call   8010ca <sys_page_unmap>
+  803978:	83 c4 10             	add    $0x10,%esp
+  80397b:	eb e6                	jmp    803963 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80397d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803980:	83 ec 08             	sub    $0x8,%esp
+  803983:	ff 75 e4             	push   -0x1c(%ebp)
+  803986:	6a 00                	push   $0x0
+  803988:	e8 3d d7 ff ff       	call   8010ca <sys_page_unmap>
+	return r;
+  80398d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803990:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803993:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  80399a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8039a1:	eb 70                	jmp    803a13 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8039a3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039a6:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  8039ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039b0:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8039b3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039b6:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8039b9:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8039c0:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8039c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8039c8:	29 c8                	sub    %ecx,%eax
+  8039ca:	85 db                	test   %ebx,%ebx
+  8039cc:	0f 44 05 e0 72 80 00 	cmove  0x8072e0,%eax
+	*--esp = t;
+  8039d3:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8039d6:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8039dd:	83 ec 04             	sub    $0x4,%esp
+  8039e0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8039e5:	29 ca                	sub    %ecx,%edx
+  8039e7:	52                   	push   %edx
+	*--esp = 0;
+  8039e8:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8039eb:	50                   	push   %eax
+  8039ec:	68 44 3c 80 00       	push   $0x803c44
+  8039f1:	e8 24 da ff ff       	call   80141a <sys_thread_create>
+  8039f6:	89 c7                	mov    %eax,%edi
+  8039f8:	83 c4 10             	add    $0x10,%esp
+  8039fb:	85 c0                	test   %eax,%eax
+  8039fd:	78 91                	js     803990 <pthread_create+0xa9>
+	th->th_env = id;
+  8039ff:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a02:	89 3c 85 60 70 80 00 	mov    %edi,0x807060(,%eax,4)
+	*tp = t;
+  803a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a0c:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803a13:	89 f8                	mov    %edi,%eax
+  803a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a18:	5b                   	pop    %ebx
+  803a19:	5e                   	pop    %esi
+  803a1a:	5f                   	pop    %edi
+  803a1b:	5d                   	pop    %ebp
+  803a1c:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803a1d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a20:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803a27:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803a2e:	83 ec 0c             	sub    $0xc,%esp
+  803a31:	68 40 70 80 00       	push   $0x807040
+  803a36:	e8 c3 fc ff ff       	call   8036fe <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803a3b:	89 d9                	mov    %ebx,%ecx
+  803a3d:	c1 e1 10             	shl    $0x10,%ecx
+  803a40:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803a43:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803a48:	29 c8                	sub    %ecx,%eax
+  803a4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803a4d:	c1 e8 16             	shr    $0x16,%eax
+  803a50:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a57:	83 c4 10             	add    $0x10,%esp
+  803a5a:	a8 01                	test   $0x1,%al
+  803a5c:	74 15                	je     803a73 <pthread_create+0x18c>
+  803a5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a61:	c1 e8 0c             	shr    $0xc,%eax
+  803a64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a6b:	a8 01                	test   $0x1,%al
+  803a6d:	0f 85 30 ff ff ff    	jne    8039a3 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a73:	83 ec 04             	sub    $0x4,%esp
+  803a76:	6a 07                	push   $0x7
+  803a78:	ff 75 e4             	push   -0x1c(%ebp)
+  803a7b:	6a 00                	push   $0x0
+  803a7d:	e8 af d5 ff ff       	call   801031 <sys_page_alloc>
+  803a82:	89 c7                	mov    %eax,%edi
+  803a84:	83 c4 10             	add    $0x10,%esp
+  803a87:	85 c0                	test   %eax,%eax
+  803a89:	0f 88 01 ff ff ff    	js     803990 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803a8f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803a94:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803a97:	29 d0                	sub    %edx,%eax
+  803a99:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803a9c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803a9e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803aa3:	29 d0                	sub    %edx,%eax
+  803aa5:	89 c7                	mov    %eax,%edi
+  803aa7:	39 fe                	cmp    %edi,%esi
+  803aa9:	0f 83 f4 fe ff ff    	jae    8039a3 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803aaf:	83 ec 04             	sub    $0x4,%esp
+  803ab2:	6a 07                	push   $0x7
+  803ab4:	56                   	push   %esi
+  803ab5:	6a 00                	push   $0x0
+  803ab7:	e8 75 d5 ff ff       	call   801031 <sys_page_alloc>
+  803abc:	83 c4 10             	add    $0x10,%esp
+  803abf:	85 c0                	test   %eax,%eax
+  803ac1:	0f 88 94 fe ff ff    	js     80395b <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803ac7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803acd:	eb d8                	jmp    803aa7 <pthread_create+0x1c0>
+
+00803acf <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803acf:	55                   	push   %ebp
+  803ad0:	89 e5                	mov    %esp,%ebp
+  803ad2:	57                   	push   %edi
+  803ad3:	56                   	push   %esi
+  803ad4:	53                   	push   %ebx
+  803ad5:	83 ec 0c             	sub    $0xc,%esp
+  803ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803adb:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803ade:	83 f8 1e             	cmp    $0x1e,%eax
+  803ae1:	0f 87 c7 00 00 00    	ja     803bae <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803ae7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ae9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803aef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803af4:	77 12                	ja     803b08 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803af6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803afb:	29 d0                	sub    %edx,%eax
+  803afd:	c1 e8 10             	shr    $0x10,%eax
+  803b00:	39 c3                	cmp    %eax,%ebx
+  803b02:	0f 84 ad 00 00 00    	je     803bb5 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b08:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b0b:	8d 3c 85 64 70 80 00 	lea    0x807064(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803b12:	8d 34 85 60 70 80 00 	lea    0x807060(,%eax,4),%esi
+  803b19:	eb 10                	jmp    803b2b <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b1b:	83 ec 04             	sub    $0x4,%esp
+  803b1e:	6a 00                	push   $0x0
+  803b20:	6a 01                	push   $0x1
+  803b22:	57                   	push   %edi
+  803b23:	e8 1e d8 ff ff       	call   801346 <sys_futex_wait>
+  803b28:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803b2b:	8b 46 04             	mov    0x4(%esi),%eax
+  803b2e:	83 f8 01             	cmp    $0x1,%eax
+  803b31:	74 e8                	je     803b1b <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803b33:	83 f8 02             	cmp    $0x2,%eax
+  803b36:	0f 85 80 00 00 00    	jne    803bbc <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b3c:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803b3f:	c1 e6 02             	shl    $0x2,%esi
+  803b42:	eb 05                	jmp    803b49 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803b44:	e8 bc d4 ff ff       	call   801005 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b49:	8b 8e 60 70 80 00    	mov    0x807060(%esi),%ecx
+  803b4f:	89 ca                	mov    %ecx,%edx
+  803b51:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803b57:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b5a:	c1 e0 04             	shl    $0x4,%eax
+  803b5d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b62:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803b65:	39 c1                	cmp    %eax,%ecx
+  803b67:	75 12                	jne    803b7b <pthread_join+0xac>
+  803b69:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b6c:	c1 e0 04             	shl    $0x4,%eax
+  803b6f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b74:	8b 40 54             	mov    0x54(%eax),%eax
+  803b77:	85 c0                	test   %eax,%eax
+  803b79:	75 c9                	jne    803b44 <pthread_join+0x75>
+	if (ret_store)
+  803b7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b7f:	74 0f                	je     803b90 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803b81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b84:	8b 04 85 70 70 80 00 	mov    0x807070(,%eax,4),%eax
+  803b8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803b8e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803b90:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b93:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803b9a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba9:	5b                   	pop    %ebx
+  803baa:	5e                   	pop    %esi
+  803bab:	5f                   	pop    %edi
+  803bac:	5d                   	pop    %ebp
+  803bad:	c3                   	ret
+		return -E_INVAL;
+  803bae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bb3:	eb f1                	jmp    803ba6 <pthread_join+0xd7>
+  803bb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bba:	eb ea                	jmp    803ba6 <pthread_join+0xd7>
+		return -E_INVAL;
+  803bbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bc1:	eb e3                	jmp    803ba6 <pthread_join+0xd7>
+
+00803bc3 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803bc3:	55                   	push   %ebp
+  803bc4:	89 e5                	mov    %esp,%ebp
+  803bc6:	53                   	push   %ebx
+  803bc7:	83 ec 04             	sub    $0x4,%esp
+  803bca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803bcc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803bd2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803bd7:	77 0c                	ja     803be5 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803bd9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803bde:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803be0:	c1 e8 10             	shr    $0x10,%eax
+  803be3:	75 0a                	jne    803bef <pthread_exit+0x2c>
+		exit();
+  803be5:	e8 68 c9 ff ff       	call   800552 <exit>
+  803bea:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803bef:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803bf6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803bf9:	8d 0c 8d 60 70 80 00 	lea    0x807060(,%ecx,4),%ecx
+  803c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c03:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803c06:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803c0d:	83 ec 08             	sub    $0x8,%esp
+  803c10:	6a 20                	push   $0x20
+  803c12:	01 c2                	add    %eax,%edx
+  803c14:	8d 04 95 64 70 80 00 	lea    0x807064(,%edx,4),%eax
+  803c1b:	50                   	push   %eax
+  803c1c:	e8 54 d7 ff ff       	call   801375 <sys_futex_wake>
+	sys_env_destroy(0);
+  803c21:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803c28:	e8 61 d3 ff ff       	call   800f8e <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803c2d:	83 c4 0c             	add    $0xc,%esp
+  803c30:	68 a6 51 80 00       	push   $0x8051a6
+  803c35:	68 a5 00 00 00       	push   $0xa5
+  803c3a:	68 c0 51 80 00       	push   $0x8051c0
+  803c3f:	e8 cd 03 00 00       	call   804011 <_panic>
+
+00803c44 <pthread_start>:
+{
+  803c44:	55                   	push   %ebp
+  803c45:	89 e5                	mov    %esp,%ebp
+  803c47:	53                   	push   %ebx
+  803c48:	83 ec 04             	sub    $0x4,%esp
+  803c4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803c4e:	e8 86 d3 ff ff       	call   800fd9 <sys_getenvid>
+  803c53:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803c58:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	if (t == 0)
+  803c5e:	85 db                	test   %ebx,%ebx
+  803c60:	74 0c                	je     803c6e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c62:	89 d9                	mov    %ebx,%ecx
+  803c64:	c1 e1 10             	shl    $0x10,%ecx
+  803c67:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803c6c:	29 ca                	sub    %ecx,%edx
+  803c6e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803c71:	c1 e0 04             	shl    $0x4,%eax
+  803c74:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c79:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803c7b:	83 ec 0c             	sub    $0xc,%esp
+  803c7e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c85:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803c88:	ff 34 95 6c 70 80 00 	push   0x80706c(,%edx,4)
+  803c8f:	ff 14 95 68 70 80 00 	call   *0x807068(,%edx,4)
+  803c96:	89 04 24             	mov    %eax,(%esp)
+  803c99:	e8 25 ff ff ff       	call   803bc3 <pthread_exit>
+
+00803c9e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803c9e:	55                   	push   %ebp
+  803c9f:	89 e5                	mov    %esp,%ebp
+  803ca1:	57                   	push   %edi
+  803ca2:	56                   	push   %esi
+  803ca3:	53                   	push   %ebx
+  803ca4:	83 ec 1c             	sub    $0x1c,%esp
+  803ca7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ca9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803caf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803cb6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803cbb:	77 0d                	ja     803cca <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803cbd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803cc2:	29 d0                	sub    %edx,%eax
+  803cc4:	c1 e8 10             	shr    $0x10,%eax
+  803cc7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803cca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ccf:	eb 2f                	jmp    803d00 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803cd1:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803cd7:	8b 01                	mov    (%ecx),%eax
+  803cd9:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803cdc:	39 c2                	cmp    %eax,%edx
+  803cde:	75 14                	jne    803cf4 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803ce0:	83 ec 0c             	sub    $0xc,%esp
+  803ce3:	57                   	push   %edi
+  803ce4:	e8 a5 d2 ff ff       	call   800f8e <sys_env_destroy>
+  803ce9:	83 c4 10             	add    $0x10,%esp
+  803cec:	85 c0                	test   %eax,%eax
+  803cee:	0f 88 97 00 00 00    	js     803d8b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803cf4:	83 c3 01             	add    $0x1,%ebx
+  803cf7:	83 fb 20             	cmp    $0x20,%ebx
+  803cfa:	0f 84 d2 00 00 00    	je     803dd2 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803d00:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803d03:	74 ef                	je     803cf4 <pthread_kill_others+0x56>
+  803d05:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d08:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803d0f:	8b 40 04             	mov    0x4(%eax),%eax
+  803d12:	83 f8 01             	cmp    $0x1,%eax
+  803d15:	75 dd                	jne    803cf4 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803d17:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d1a:	8b 3c 85 60 70 80 00 	mov    0x807060(,%eax,4),%edi
+  803d21:	89 fe                	mov    %edi,%esi
+  803d23:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d29:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d2c:	c1 e0 04             	shl    $0x4,%eax
+  803d2f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d34:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d37:	39 c7                	cmp    %eax,%edi
+  803d39:	75 b9                	jne    803cf4 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d3b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d3e:	c1 e0 04             	shl    $0x4,%eax
+  803d41:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d46:	8b 40 54             	mov    0x54(%eax),%eax
+  803d49:	85 c0                	test   %eax,%eax
+  803d4b:	74 a7                	je     803cf4 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d4d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d50:	c1 e0 04             	shl    $0x4,%eax
+  803d53:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803d59:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d5b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803d61:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d66:	0f 87 65 ff ff ff    	ja     803cd1 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d6c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d71:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803d73:	c1 e8 10             	shr    $0x10,%eax
+  803d76:	0f 84 55 ff ff ff    	je     803cd1 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803d7c:	c1 e0 10             	shl    $0x10,%eax
+  803d7f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803d84:	29 c1                	sub    %eax,%ecx
+  803d86:	e9 4c ff ff ff       	jmp    803cd7 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803d8b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803d8e:	c1 e2 04             	shl    $0x4,%edx
+  803d91:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d97:	8b 52 48             	mov    0x48(%edx),%edx
+  803d9a:	39 fa                	cmp    %edi,%edx
+  803d9c:	0f 85 52 ff ff ff    	jne    803cf4 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803da2:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803da5:	c1 e2 04             	shl    $0x4,%edx
+  803da8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803dae:	8b 52 54             	mov    0x54(%edx),%edx
+  803db1:	85 d2                	test   %edx,%edx
+  803db3:	0f 84 3b ff ff ff    	je     803cf4 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803db9:	83 ec 0c             	sub    $0xc,%esp
+  803dbc:	50                   	push   %eax
+  803dbd:	57                   	push   %edi
+  803dbe:	68 d0 51 80 00       	push   $0x8051d0
+  803dc3:	68 bb 00 00 00       	push   $0xbb
+  803dc8:	68 c0 51 80 00       	push   $0x8051c0
+  803dcd:	e8 3f 02 00 00       	call   804011 <_panic>
+	}
+}
+  803dd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd5:	5b                   	pop    %ebx
+  803dd6:	5e                   	pop    %esi
+  803dd7:	5f                   	pop    %edi
+  803dd8:	5d                   	pop    %ebp
+  803dd9:	c3                   	ret
+
+00803dda <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803dda:	55                   	push   %ebp
+  803ddb:	89 e5                	mov    %esp,%ebp
+  803ddd:	53                   	push   %ebx
+  803dde:	83 ec 04             	sub    $0x4,%esp
+  803de1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803de3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803de9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803def:	0f 87 85 00 00 00    	ja     803e7a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803df5:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803dfa:	29 c3                	sub    %eax,%ebx
+  803dfc:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803dff:	83 ec 04             	sub    $0x4,%esp
+  803e02:	68 80 02 00 00       	push   $0x280
+  803e07:	6a 00                	push   $0x0
+  803e09:	68 60 70 80 00       	push   $0x807060
+  803e0e:	e8 31 cf ff ff       	call   800d44 <memset>
+	threads_mu.m_state = 0;
+  803e13:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  803e1a:	00 00 00 
+	if (self != 0) {
+  803e1d:	83 c4 10             	add    $0x10,%esp
+  803e20:	85 db                	test   %ebx,%ebx
+  803e22:	74 51                	je     803e75 <pthread_fork_child+0x9b>
+  803e24:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e26:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e2c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e31:	77 18                	ja     803e4b <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e33:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e38:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803e3a:	c1 e8 10             	shr    $0x10,%eax
+  803e3d:	74 0c                	je     803e4b <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e3f:	c1 e0 10             	shl    $0x10,%eax
+  803e42:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e47:	29 c2                	sub    %eax,%edx
+  803e49:	eb 06                	jmp    803e51 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803e4b:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803e51:	8b 02                	mov    (%edx),%eax
+  803e53:	8b 48 48             	mov    0x48(%eax),%ecx
+  803e56:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803e5d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803e60:	89 0c 95 60 70 80 00 	mov    %ecx,0x807060(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803e67:	8d 04 95 60 70 80 00 	lea    0x807060(,%edx,4),%eax
+  803e6e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e78:	c9                   	leave
+  803e79:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803e7a:	83 ec 04             	sub    $0x4,%esp
+  803e7d:	68 80 02 00 00       	push   $0x280
+  803e82:	6a 00                	push   $0x0
+  803e84:	68 60 70 80 00       	push   $0x807060
+  803e89:	e8 b6 ce ff ff       	call   800d44 <memset>
+	threads_mu.m_state = 0;
+  803e8e:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  803e95:	00 00 00 
+  803e98:	83 c4 10             	add    $0x10,%esp
+  803e9b:	eb d8                	jmp    803e75 <pthread_fork_child+0x9b>
+
+00803e9d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea2:	c3                   	ret
+
+00803ea3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ea3:	55                   	push   %ebp
+  803ea4:	89 e5                	mov    %esp,%ebp
+  803ea6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803ea9:	68 f5 51 80 00       	push   $0x8051f5
+  803eae:	ff 75 0c             	push   0xc(%ebp)
+  803eb1:	e8 3d cd ff ff       	call   800bf3 <strcpy>
+	return 0;
+}
+  803eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebb:	c9                   	leave
+  803ebc:	c3                   	ret
+
+00803ebd <devcons_write>:
+{
+  803ebd:	55                   	push   %ebp
+  803ebe:	89 e5                	mov    %esp,%ebp
+  803ec0:	57                   	push   %edi
+  803ec1:	56                   	push   %esi
+  803ec2:	53                   	push   %ebx
+  803ec3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803ec9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803ece:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803ed4:	eb 2e                	jmp    803f04 <devcons_write+0x47>
+		m = n - tot;
+  803ed6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ed9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803edb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ee0:	39 c3                	cmp    %eax,%ebx
+  803ee2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803ee5:	83 ec 04             	sub    $0x4,%esp
+  803ee8:	53                   	push   %ebx
+  803ee9:	89 f0                	mov    %esi,%eax
+  803eeb:	03 45 0c             	add    0xc(%ebp),%eax
+  803eee:	50                   	push   %eax
+  803eef:	57                   	push   %edi
+  803ef0:	e8 84 ce ff ff       	call   800d79 <memmove>
+		sys_cputs(buf, m);
+  803ef5:	83 c4 08             	add    $0x8,%esp
+  803ef8:	53                   	push   %ebx
+  803ef9:	57                   	push   %edi
+  803efa:	e8 38 d0 ff ff       	call   800f37 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803eff:	01 de                	add    %ebx,%esi
+  803f01:	83 c4 10             	add    $0x10,%esp
+  803f04:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803f07:	72 cd                	jb     803ed6 <devcons_write+0x19>
+}
+  803f09:	89 f0                	mov    %esi,%eax
+  803f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f0e:	5b                   	pop    %ebx
+  803f0f:	5e                   	pop    %esi
+  803f10:	5f                   	pop    %edi
+  803f11:	5d                   	pop    %ebp
+  803f12:	c3                   	ret
+
+00803f13 <devcons_read>:
+{
+  803f13:	55                   	push   %ebp
+  803f14:	89 e5                	mov    %esp,%ebp
+  803f16:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f1e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803f22:	75 07                	jne    803f2b <devcons_read+0x18>
+  803f24:	eb 1f                	jmp    803f45 <devcons_read+0x32>
+		sys_yield();
+  803f26:	e8 da d0 ff ff       	call   801005 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803f2b:	e8 32 d0 ff ff       	call   800f62 <sys_cgetc>
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	74 f2                	je     803f26 <devcons_read+0x13>
+	if (c < 0)
+  803f34:	78 0f                	js     803f45 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803f36:	83 f8 04             	cmp    $0x4,%eax
+  803f39:	74 0c                	je     803f47 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803f3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f3e:	88 02                	mov    %al,(%edx)
+	return 1;
+  803f40:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803f45:	c9                   	leave
+  803f46:	c3                   	ret
+		return 0;
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4c:	eb f7                	jmp    803f45 <devcons_read+0x32>
+
+00803f4e <cputchar>:
+{
+  803f4e:	55                   	push   %ebp
+  803f4f:	89 e5                	mov    %esp,%ebp
+  803f51:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f57:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803f5a:	6a 01                	push   $0x1
+  803f5c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f5f:	50                   	push   %eax
+  803f60:	e8 d2 cf ff ff       	call   800f37 <sys_cputs>
+}
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	c9                   	leave
+  803f69:	c3                   	ret
+
+00803f6a <getchar>:
+{
+  803f6a:	55                   	push   %ebp
+  803f6b:	89 e5                	mov    %esp,%ebp
+  803f6d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803f70:	6a 01                	push   $0x1
+  803f72:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f75:	50                   	push   %eax
+  803f76:	6a 00                	push   $0x0
+  803f78:	e8 63 d8 ff ff       	call   8017e0 <read>
+	if (r < 0)
+  803f7d:	83 c4 10             	add    $0x10,%esp
+  803f80:	85 c0                	test   %eax,%eax
+  803f82:	78 06                	js     803f8a <getchar+0x20>
+	if (r < 1)
+  803f84:	74 06                	je     803f8c <getchar+0x22>
+	return c;
+  803f86:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803f8a:	c9                   	leave
+  803f8b:	c3                   	ret
+		return -E_EOF;
+  803f8c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803f91:	eb f7                	jmp    803f8a <getchar+0x20>
+
+00803f93 <iscons>:
+{
+  803f93:	55                   	push   %ebp
+  803f94:	89 e5                	mov    %esp,%ebp
+  803f96:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f9c:	50                   	push   %eax
+  803f9d:	ff 75 08             	push   0x8(%ebp)
+  803fa0:	e8 ab d5 ff ff       	call   801550 <fd_lookup>
+  803fa5:	83 c4 10             	add    $0x10,%esp
+  803fa8:	85 c0                	test   %eax,%eax
+  803faa:	78 11                	js     803fbd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803fac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803faf:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  803fb5:	39 10                	cmp    %edx,(%eax)
+  803fb7:	0f 94 c0             	sete   %al
+  803fba:	0f b6 c0             	movzbl %al,%eax
+}
+  803fbd:	c9                   	leave
+  803fbe:	c3                   	ret
+
+00803fbf <opencons>:
+{
+  803fbf:	55                   	push   %ebp
+  803fc0:	89 e5                	mov    %esp,%ebp
+  803fc2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803fc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fc8:	50                   	push   %eax
+  803fc9:	e8 2c d5 ff ff       	call   8014fa <fd_alloc>
+  803fce:	83 c4 10             	add    $0x10,%esp
+  803fd1:	85 c0                	test   %eax,%eax
+  803fd3:	78 3a                	js     80400f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803fd5:	83 ec 04             	sub    $0x4,%esp
+  803fd8:	68 07 04 00 00       	push   $0x407
+  803fdd:	ff 75 f4             	push   -0xc(%ebp)
+  803fe0:	6a 00                	push   $0x0
+  803fe2:	e8 4a d0 ff ff       	call   801031 <sys_page_alloc>
+  803fe7:	83 c4 10             	add    $0x10,%esp
+  803fea:	85 c0                	test   %eax,%eax
+  803fec:	78 21                	js     80400f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803fee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ff1:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  803ff7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803ff9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ffc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804003:	83 ec 0c             	sub    $0xc,%esp
+  804006:	50                   	push   %eax
+  804007:	e8 c7 d4 ff ff       	call   8014d3 <fd2num>
+  80400c:	83 c4 10             	add    $0x10,%esp
+}
+  80400f:	c9                   	leave
+  804010:	c3                   	ret
+
+00804011 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804011:	55                   	push   %ebp
+  804012:	89 e5                	mov    %esp,%ebp
+  804014:	56                   	push   %esi
+  804015:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804016:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804019:	8b 35 04 60 80 00    	mov    0x806004,%esi
+  80401f:	e8 b5 cf ff ff       	call   800fd9 <sys_getenvid>
+  804024:	83 ec 0c             	sub    $0xc,%esp
+  804027:	ff 75 0c             	push   0xc(%ebp)
+  80402a:	ff 75 08             	push   0x8(%ebp)
+  80402d:	56                   	push   %esi
+  80402e:	50                   	push   %eax
+  80402f:	68 04 52 80 00       	push   $0x805204
+  804034:	e8 d6 c5 ff ff       	call   80060f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804039:	83 c4 18             	add    $0x18,%esp
+  80403c:	53                   	push   %ebx
+  80403d:	ff 75 10             	push   0x10(%ebp)
+  804040:	e8 79 c5 ff ff       	call   8005be <vcprintf>
+	cprintf("\n");
+  804045:	c7 04 24 14 4c 80 00 	movl   $0x804c14,(%esp)
+  80404c:	e8 be c5 ff ff       	call   80060f <cprintf>
+  804051:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804054:	cc                   	int3
+	while (1)
+  804055:	eb fd                	jmp    804054 <_panic+0x43>
+
+00804057 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  804057:	55                   	push   %ebp
+  804058:	89 e5                	mov    %esp,%ebp
+  80405a:	57                   	push   %edi
+  80405b:	56                   	push   %esi
+  80405c:	53                   	push   %ebx
+  80405d:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  804060:	89 d6                	mov    %edx,%esi
+  804062:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804065:	89 cf                	mov    %ecx,%edi
+  804067:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80406a:	89 fa                	mov    %edi,%edx
+  80406c:	80 ce 08             	or     $0x8,%dh
+  80406f:	f6 c5 08             	test   $0x8,%ch
+  804072:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  804075:	57                   	push   %edi
+  804076:	56                   	push   %esi
+  804077:	50                   	push   %eax
+  804078:	56                   	push   %esi
+  804079:	6a 00                	push   $0x0
+  80407b:	e8 fe cf ff ff       	call   80107e <sys_page_map>
+	if (r < 0) {
+  804080:	83 c4 20             	add    $0x20,%esp
+  804083:	85 c0                	test   %eax,%eax
+  804085:	78 27                	js     8040ae <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  804087:	83 ec 0c             	sub    $0xc,%esp
+  80408a:	57                   	push   %edi
+  80408b:	56                   	push   %esi
+  80408c:	6a 00                	push   $0x0
+  80408e:	56                   	push   %esi
+  80408f:	6a 00                	push   $0x0
+  804091:	e8 e8 cf ff ff       	call   80107e <sys_page_map>
+  804096:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804098:	83 c4 20             	add    $0x20,%esp
+  80409b:	85 c0                	test   %eax,%eax
+  80409d:	78 24                	js     8040c3 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80409f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8040a4:	89 d8                	mov    %ebx,%eax
+  8040a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040a9:	5b                   	pop    %ebx
+  8040aa:	5e                   	pop    %esi
+  8040ab:	5f                   	pop    %edi
+  8040ac:	5d                   	pop    %ebp
+  8040ad:	c3                   	ret
+  8040ae:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8040b0:	83 ec 08             	sub    $0x8,%esp
+  8040b3:	50                   	push   %eax
+  8040b4:	68 28 52 80 00       	push   $0x805228
+  8040b9:	e8 51 c5 ff ff       	call   80060f <cprintf>
+		return r;
+  8040be:	83 c4 10             	add    $0x10,%esp
+  8040c1:	eb e1                	jmp    8040a4 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8040c3:	83 ec 08             	sub    $0x8,%esp
+  8040c6:	50                   	push   %eax
+  8040c7:	68 58 52 80 00       	push   $0x805258
+  8040cc:	e8 3e c5 ff ff       	call   80060f <cprintf>
+		return r;
+  8040d1:	83 c4 10             	add    $0x10,%esp
+  8040d4:	eb ce                	jmp    8040a4 <duppage_cow+0x4d>
+
+008040d6 <duppage>:
+{
+  8040d6:	55                   	push   %ebp
+  8040d7:	89 e5                	mov    %esp,%ebp
+  8040d9:	53                   	push   %ebx
+  8040da:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8040dd:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8040e0:	51                   	push   %ecx
+  8040e1:	52                   	push   %edx
+  8040e2:	50                   	push   %eax
+  8040e3:	52                   	push   %edx
+  8040e4:	6a 00                	push   $0x0
+  8040e6:	e8 93 cf ff ff       	call   80107e <sys_page_map>
+	if (r < 0) {
+  8040eb:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8040ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8040f3:	85 c0                	test   %eax,%eax
+  8040f5:	78 07                	js     8040fe <duppage+0x28>
+}
+  8040f7:	89 d8                	mov    %ebx,%eax
+  8040f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040fc:	c9                   	leave
+  8040fd:	c3                   	ret
+  8040fe:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804100:	83 ec 08             	sub    $0x8,%esp
+  804103:	50                   	push   %eax
+  804104:	68 28 52 80 00       	push   $0x805228
+  804109:	e8 01 c5 ff ff       	call   80060f <cprintf>
+		return r;
+  80410e:	83 c4 10             	add    $0x10,%esp
+  804111:	eb e4                	jmp    8040f7 <duppage+0x21>
+
+00804113 <cow_copy>:
+{
+  804113:	55                   	push   %ebp
+  804114:	89 e5                	mov    %esp,%ebp
+  804116:	56                   	push   %esi
+  804117:	53                   	push   %ebx
+  804118:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80411a:	83 ec 04             	sub    $0x4,%esp
+  80411d:	6a 07                	push   $0x7
+  80411f:	68 00 f0 7f 00       	push   $0x7ff000
+  804124:	6a 00                	push   $0x0
+  804126:	e8 06 cf ff ff       	call   801031 <sys_page_alloc>
+	if (r < 0) {
+  80412b:	83 c4 10             	add    $0x10,%esp
+  80412e:	85 c0                	test   %eax,%eax
+  804130:	78 58                	js     80418a <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  804132:	83 ec 04             	sub    $0x4,%esp
+  804135:	68 00 10 00 00       	push   $0x1000
+  80413a:	56                   	push   %esi
+  80413b:	68 00 f0 7f 00       	push   $0x7ff000
+  804140:	e8 34 cc ff ff       	call   800d79 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  804145:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80414c:	56                   	push   %esi
+  80414d:	6a 00                	push   $0x0
+  80414f:	68 00 f0 7f 00       	push   $0x7ff000
+  804154:	6a 00                	push   $0x0
+  804156:	e8 23 cf ff ff       	call   80107e <sys_page_map>
+  80415b:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80415d:	83 c4 20             	add    $0x20,%esp
+  804160:	85 c0                	test   %eax,%eax
+  804162:	78 3b                	js     80419f <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804164:	83 ec 08             	sub    $0x8,%esp
+  804167:	68 00 f0 7f 00       	push   $0x7ff000
+  80416c:	6a 00                	push   $0x0
+  80416e:	e8 57 cf ff ff       	call   8010ca <sys_page_unmap>
+  804173:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804175:	83 c4 10             	add    $0x10,%esp
+  804178:	85 c0                	test   %eax,%eax
+  80417a:	78 45                	js     8041c1 <cow_copy+0xae>
+	return 0;
+  80417c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804181:	89 d8                	mov    %ebx,%eax
+  804183:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804186:	5b                   	pop    %ebx
+  804187:	5e                   	pop    %esi
+  804188:	5d                   	pop    %ebp
+  804189:	c3                   	ret
+  80418a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80418c:	83 ec 08             	sub    $0x8,%esp
+  80418f:	50                   	push   %eax
+  804190:	68 48 53 80 00       	push   $0x805348
+  804195:	e8 75 c4 ff ff       	call   80060f <cprintf>
+		return r;
+  80419a:	83 c4 10             	add    $0x10,%esp
+  80419d:	eb e2                	jmp    804181 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80419f:	83 ec 08             	sub    $0x8,%esp
+  8041a2:	50                   	push   %eax
+  8041a3:	68 64 53 80 00       	push   $0x805364
+  8041a8:	e8 62 c4 ff ff       	call   80060f <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8041ad:	83 c4 08             	add    $0x8,%esp
+  8041b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8041b5:	6a 00                	push   $0x0
+  8041b7:	e8 0e cf ff ff       	call   8010ca <sys_page_unmap>
+		return r;
+  8041bc:	83 c4 10             	add    $0x10,%esp
+  8041bf:	eb c0                	jmp    804181 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8041c1:	83 ec 08             	sub    $0x8,%esp
+  8041c4:	50                   	push   %eax
+  8041c5:	68 80 52 80 00       	push   $0x805280
+  8041ca:	e8 40 c4 ff ff       	call   80060f <cprintf>
+		return r;
+  8041cf:	83 c4 10             	add    $0x10,%esp
+  8041d2:	eb ad                	jmp    804181 <cow_copy+0x6e>
+
+008041d4 <pgfault>:
+{
+  8041d4:	55                   	push   %ebp
+  8041d5:	89 e5                	mov    %esp,%ebp
+  8041d7:	56                   	push   %esi
+  8041d8:	53                   	push   %ebx
+  8041d9:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8041dc:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8041de:	89 d8                	mov    %ebx,%eax
+  8041e0:	c1 e8 16             	shr    $0x16,%eax
+  8041e3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8041ea:	89 de                	mov    %ebx,%esi
+  8041ec:	c1 ee 0c             	shr    $0xc,%esi
+  8041ef:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8041f6:	a8 07                	test   $0x7,%al
+  8041f8:	74 3b                	je     804235 <pgfault+0x61>
+  8041fa:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804200:	74 33                	je     804235 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804202:	83 ec 0c             	sub    $0xc,%esp
+  804205:	68 00 f0 bf ee       	push   $0xeebff000
+  80420a:	e8 82 f4 ff ff       	call   803691 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80420f:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804216:	83 c4 10             	add    $0x10,%esp
+  804219:	f6 c4 08             	test   $0x8,%ah
+  80421c:	75 30                	jne    80424e <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80421e:	83 ec 0c             	sub    $0xc,%esp
+  804221:	68 00 f0 bf ee       	push   $0xeebff000
+  804226:	e8 d3 f4 ff ff       	call   8036fe <mutex_unlock>
+}
+  80422b:	83 c4 10             	add    $0x10,%esp
+  80422e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804231:	5b                   	pop    %ebx
+  804232:	5e                   	pop    %esi
+  804233:	5d                   	pop    %ebp
+  804234:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804235:	83 ec 08             	sub    $0x8,%esp
+  804238:	ff 72 28             	push   0x28(%edx)
+  80423b:	51                   	push   %ecx
+  80423c:	50                   	push   %eax
+  80423d:	68 a4 52 80 00       	push   $0x8052a4
+  804242:	6a 3f                	push   $0x3f
+  804244:	68 7e 53 80 00       	push   $0x80537e
+  804249:	e8 c3 fd ff ff       	call   804011 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80424e:	89 d8                	mov    %ebx,%eax
+  804250:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804255:	e8 b9 fe ff ff       	call   804113 <cow_copy>
+  80425a:	eb c2                	jmp    80421e <pgfault+0x4a>
+
+0080425c <cow_enable>:
+{
+  80425c:	55                   	push   %ebp
+  80425d:	89 e5                	mov    %esp,%ebp
+  80425f:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804262:	68 d4 41 80 00       	push   $0x8041d4
+  804267:	e8 28 06 00 00       	call   804894 <set_pgfault_handler>
+}
+  80426c:	83 c4 10             	add    $0x10,%esp
+  80426f:	c9                   	leave
+  804270:	c3                   	ret
+
+00804271 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804271:	55                   	push   %ebp
+  804272:	89 e5                	mov    %esp,%ebp
+  804274:	57                   	push   %edi
+  804275:	56                   	push   %esi
+  804276:	53                   	push   %ebx
+  804277:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80427a:	68 d4 41 80 00       	push   $0x8041d4
+  80427f:	e8 10 06 00 00       	call   804894 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804284:	b8 07 00 00 00       	mov    $0x7,%eax
+  804289:	cd 30                	int    $0x30
+  80428b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80428e:	83 c4 10             	add    $0x10,%esp
+  804291:	85 c0                	test   %eax,%eax
+  804293:	78 4b                	js     8042e0 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804295:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80429a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80429f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8042a2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8042a6:	0f 85 16 01 00 00    	jne    8043c2 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8042ac:	e8 28 cd ff ff       	call   800fd9 <sys_getenvid>
+  8042b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042b6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b8:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8042be:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8042c4:	77 32                	ja     8042f8 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c6:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8042cb:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8042cd:	c1 ea 10             	shr    $0x10,%edx
+  8042d0:	74 26                	je     8042f8 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042d2:	c1 e2 10             	shl    $0x10,%edx
+  8042d5:	89 d1                	mov    %edx,%ecx
+  8042d7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042dc:	29 ca                	sub    %ecx,%edx
+  8042de:	eb 1e                	jmp    8042fe <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8042e0:	83 ec 08             	sub    $0x8,%esp
+  8042e3:	89 c7                	mov    %eax,%edi
+  8042e5:	50                   	push   %eax
+  8042e6:	68 89 53 80 00       	push   $0x805389
+  8042eb:	e8 1f c3 ff ff       	call   80060f <cprintf>
+		return eid;
+  8042f0:	83 c4 10             	add    $0x10,%esp
+  8042f3:	e9 6c 01 00 00       	jmp    804464 <fork+0x1f3>
+		return pthread_main_tls;
+  8042f8:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8042fe:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804301:	c1 e0 04             	shl    $0x4,%eax
+  804304:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804309:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80430b:	e8 ca fa ff ff       	call   803dda <pthread_fork_child>
+		return eid;
+  804310:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804313:	e9 4c 01 00 00       	jmp    804464 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804318:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80431e:	89 da                	mov    %ebx,%edx
+  804320:	89 f8                	mov    %edi,%eax
+  804322:	e8 af fd ff ff       	call   8040d6 <duppage>
+  804327:	85 c0                	test   %eax,%eax
+  804329:	79 28                	jns    804353 <fork+0xe2>
+  80432b:	89 c7                	mov    %eax,%edi
+  80432d:	e9 32 01 00 00       	jmp    804464 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804332:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804338:	83 f9 05             	cmp    $0x5,%ecx
+  80433b:	75 58                	jne    804395 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80433d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804342:	89 da                	mov    %ebx,%edx
+  804344:	89 f8                	mov    %edi,%eax
+  804346:	e8 8b fd ff ff       	call   8040d6 <duppage>
+  80434b:	85 c0                	test   %eax,%eax
+  80434d:	0f 88 0f 01 00 00    	js     804462 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804353:	83 c3 01             	add    $0x1,%ebx
+  804356:	39 de                	cmp    %ebx,%esi
+  804358:	74 54                	je     8043ae <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80435a:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804361:	f6 c1 05             	test   $0x5,%cl
+  804364:	74 ed                	je     804353 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804366:	f6 c5 04             	test   $0x4,%ch
+  804369:	75 ad                	jne    804318 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80436b:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804371:	74 bf                	je     804332 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804373:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804379:	74 d8                	je     804353 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80437b:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804381:	89 da                	mov    %ebx,%edx
+  804383:	89 f8                	mov    %edi,%eax
+  804385:	e8 cd fc ff ff       	call   804057 <duppage_cow>
+  80438a:	85 c0                	test   %eax,%eax
+  80438c:	79 c5                	jns    804353 <fork+0xe2>
+  80438e:	89 c7                	mov    %eax,%edi
+  804390:	e9 cf 00 00 00       	jmp    804464 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804395:	68 d4 52 80 00       	push   $0x8052d4
+  80439a:	68 bd 50 80 00       	push   $0x8050bd
+  80439f:	68 c6 00 00 00       	push   $0xc6
+  8043a4:	68 7e 53 80 00       	push   $0x80537e
+  8043a9:	e8 63 fc ff ff       	call   804011 <_panic>
+  8043ae:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8043b1:	83 c1 01             	add    $0x1,%ecx
+  8043b4:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8043ba:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8043c0:	74 18                	je     8043da <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8043c2:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8043c9:	a8 07                	test   $0x7,%al
+  8043cb:	74 e4                	je     8043b1 <fork+0x140>
+  8043cd:	89 cb                	mov    %ecx,%ebx
+  8043cf:	c1 e3 0a             	shl    $0xa,%ebx
+  8043d2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8043d5:	e9 7c ff ff ff       	jmp    804356 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8043da:	83 ec 04             	sub    $0x4,%esp
+  8043dd:	6a 07                	push   $0x7
+  8043df:	68 00 f0 bf ee       	push   $0xeebff000
+  8043e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8043e7:	e8 45 cc ff ff       	call   801031 <sys_page_alloc>
+  8043ec:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043ee:	83 c4 10             	add    $0x10,%esp
+  8043f1:	85 c0                	test   %eax,%eax
+  8043f3:	78 34                	js     804429 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8043f5:	83 ec 08             	sub    $0x8,%esp
+  8043f8:	68 d2 48 80 00       	push   $0x8048d2
+  8043fd:	ff 75 e4             	push   -0x1c(%ebp)
+  804400:	e8 a9 cd ff ff       	call   8011ae <sys_env_set_pgfault_upcall>
+  804405:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804407:	83 c4 10             	add    $0x10,%esp
+  80440a:	85 c0                	test   %eax,%eax
+  80440c:	78 2e                	js     80443c <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80440e:	83 ec 08             	sub    $0x8,%esp
+  804411:	6a 02                	push   $0x2
+  804413:	ff 75 e4             	push   -0x1c(%ebp)
+  804416:	e8 fb cc ff ff       	call   801116 <sys_env_set_status>
+  80441b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80441d:	83 c4 10             	add    $0x10,%esp
+  804420:	85 c0                	test   %eax,%eax
+  804422:	78 2b                	js     80444f <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804427:	eb 3b                	jmp    804464 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804429:	83 ec 08             	sub    $0x8,%esp
+  80442c:	50                   	push   %eax
+  80442d:	68 fc 52 80 00       	push   $0x8052fc
+  804432:	e8 d8 c1 ff ff       	call   80060f <cprintf>
+		return r;
+  804437:	83 c4 10             	add    $0x10,%esp
+  80443a:	eb 28                	jmp    804464 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80443c:	83 ec 08             	sub    $0x8,%esp
+  80443f:	50                   	push   %eax
+  804440:	68 24 53 80 00       	push   $0x805324
+  804445:	e8 c5 c1 ff ff       	call   80060f <cprintf>
+		return r;
+  80444a:	83 c4 10             	add    $0x10,%esp
+  80444d:	eb 15                	jmp    804464 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80444f:	83 ec 08             	sub    $0x8,%esp
+  804452:	50                   	push   %eax
+  804453:	68 99 53 80 00       	push   $0x805399
+  804458:	e8 b2 c1 ff ff       	call   80060f <cprintf>
+		return r;
+  80445d:	83 c4 10             	add    $0x10,%esp
+  804460:	eb 02                	jmp    804464 <fork+0x1f3>
+  804462:	89 c7                	mov    %eax,%edi
+}
+  804464:	89 f8                	mov    %edi,%eax
+  804466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804469:	5b                   	pop    %ebx
+  80446a:	5e                   	pop    %esi
+  80446b:	5f                   	pop    %edi
+  80446c:	5d                   	pop    %ebp
+  80446d:	c3                   	ret
+
+0080446e <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80446e:	55                   	push   %ebp
+  80446f:	89 e5                	mov    %esp,%ebp
+  804471:	57                   	push   %edi
+  804472:	56                   	push   %esi
+  804473:	53                   	push   %ebx
+  804474:	83 ec 2c             	sub    $0x2c,%esp
+  804477:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804479:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80447f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804484:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80448a:	77 0a                	ja     804496 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80448c:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804491:	29 c3                	sub    %eax,%ebx
+  804493:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804496:	83 ec 0c             	sub    $0xc,%esp
+  804499:	68 d4 41 80 00       	push   $0x8041d4
+  80449e:	e8 f1 03 00 00       	call   804894 <set_pgfault_handler>
+  8044a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8044a8:	cd 30                	int    $0x30
+  8044aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8044ad:	83 c4 10             	add    $0x10,%esp
+  8044b0:	85 c0                	test   %eax,%eax
+  8044b2:	78 30                	js     8044e4 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8044b4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8044b8:	74 42                	je     8044fc <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8044ba:	c1 e3 10             	shl    $0x10,%ebx
+  8044bd:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8044c2:	29 d8                	sub    %ebx,%eax
+  8044c4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8044c7:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8044cc:	29 d8                	sub    %ebx,%eax
+  8044ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8044d1:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8044d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044db:	89 f7                	mov    %esi,%edi
+  8044dd:	89 d6                	mov    %edx,%esi
+  8044df:	e9 2c 01 00 00       	jmp    804610 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8044e4:	83 ec 08             	sub    $0x8,%esp
+  8044e7:	89 c7                	mov    %eax,%edi
+  8044e9:	50                   	push   %eax
+  8044ea:	68 89 53 80 00       	push   $0x805389
+  8044ef:	e8 1b c1 ff ff       	call   80060f <cprintf>
+		return eid;
+  8044f4:	83 c4 10             	add    $0x10,%esp
+  8044f7:	e9 d5 00 00 00       	jmp    8045d1 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8044fc:	e8 d8 ca ff ff       	call   800fd9 <sys_getenvid>
+  804501:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804506:	89 c2                	mov    %eax,%edx
+  804508:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80450a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804510:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804515:	77 18                	ja     80452f <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804517:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80451c:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80451e:	c1 e8 10             	shr    $0x10,%eax
+  804521:	74 0c                	je     80452f <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804523:	c1 e0 10             	shl    $0x10,%eax
+  804526:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80452b:	29 c1                	sub    %eax,%ecx
+  80452d:	eb 06                	jmp    804535 <sfork+0xc7>
+		return pthread_main_tls;
+  80452f:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+  804535:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804538:	c1 e0 04             	shl    $0x4,%eax
+  80453b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804540:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804542:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804545:	e9 87 00 00 00       	jmp    8045d1 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80454a:	f6 c5 04             	test   $0x4,%ch
+  80454d:	74 6c                	je     8045bb <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80454f:	89 ca                	mov    %ecx,%edx
+  804551:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804557:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80455d:	74 7c                	je     8045db <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80455f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804565:	89 da                	mov    %ebx,%edx
+  804567:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80456a:	e8 67 fb ff ff       	call   8040d6 <duppage>
+  80456f:	85 c0                	test   %eax,%eax
+  804571:	0f 88 4f 01 00 00    	js     8046c6 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804577:	83 c3 01             	add    $0x1,%ebx
+  80457a:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80457d:	74 7a                	je     8045f9 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80457f:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804581:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804588:	f6 c1 01             	test   $0x1,%cl
+  80458b:	74 ea                	je     804577 <sfork+0x109>
+  80458d:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804593:	74 e2                	je     804577 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804595:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80459b:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80459e:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8045a3:	76 a5                	jbe    80454a <sfork+0xdc>
+  8045a5:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8045ab:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045ae:	39 fa                	cmp    %edi,%edx
+  8045b0:	73 9d                	jae    80454f <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8045b2:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8045b5:	39 fa                	cmp    %edi,%edx
+  8045b7:	72 96                	jb     80454f <sfork+0xe1>
+  8045b9:	eb 8f                	jmp    80454a <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8045bb:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8045c1:	89 da                	mov    %ebx,%edx
+  8045c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8045c6:	e8 8c fa ff ff       	call   804057 <duppage_cow>
+  8045cb:	85 c0                	test   %eax,%eax
+  8045cd:	79 a8                	jns    804577 <sfork+0x109>
+  8045cf:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8045d1:	89 f8                	mov    %edi,%eax
+  8045d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045d6:	5b                   	pop    %ebx
+  8045d7:	5e                   	pop    %esi
+  8045d8:	5f                   	pop    %edi
+  8045d9:	5d                   	pop    %ebp
+  8045da:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8045db:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8045e0:	e8 2e fb ff ff       	call   804113 <cow_copy>
+  8045e5:	85 c0                	test   %eax,%eax
+  8045e7:	0f 88 d2 00 00 00    	js     8046bf <sfork+0x251>
+				pte = uvpt[pn];
+  8045ed:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8045f4:	e9 66 ff ff ff       	jmp    80455f <sfork+0xf1>
+  8045f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8045fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8045ff:	83 c6 01             	add    $0x1,%esi
+  804602:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804608:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80460e:	74 1b                	je     80462b <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804610:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804617:	a8 01                	test   $0x1,%al
+  804619:	74 e4                	je     8045ff <sfork+0x191>
+  80461b:	89 f3                	mov    %esi,%ebx
+  80461d:	c1 e3 0a             	shl    $0xa,%ebx
+  804620:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804626:	e9 4f ff ff ff       	jmp    80457a <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80462b:	83 ec 04             	sub    $0x4,%esp
+  80462e:	6a 07                	push   $0x7
+  804630:	68 00 f0 bf ee       	push   $0xeebff000
+  804635:	ff 75 e0             	push   -0x20(%ebp)
+  804638:	e8 f4 c9 ff ff       	call   801031 <sys_page_alloc>
+  80463d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80463f:	83 c4 10             	add    $0x10,%esp
+  804642:	85 c0                	test   %eax,%eax
+  804644:	78 37                	js     80467d <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804646:	83 ec 08             	sub    $0x8,%esp
+  804649:	68 d2 48 80 00       	push   $0x8048d2
+  80464e:	ff 75 e0             	push   -0x20(%ebp)
+  804651:	e8 58 cb ff ff       	call   8011ae <sys_env_set_pgfault_upcall>
+  804656:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804658:	83 c4 10             	add    $0x10,%esp
+  80465b:	85 c0                	test   %eax,%eax
+  80465d:	78 34                	js     804693 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80465f:	83 ec 08             	sub    $0x8,%esp
+  804662:	6a 02                	push   $0x2
+  804664:	ff 75 e0             	push   -0x20(%ebp)
+  804667:	e8 aa ca ff ff       	call   801116 <sys_env_set_status>
+  80466c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80466e:	83 c4 10             	add    $0x10,%esp
+  804671:	85 c0                	test   %eax,%eax
+  804673:	78 34                	js     8046a9 <sfork+0x23b>
+	return eid;
+  804675:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804678:	e9 54 ff ff ff       	jmp    8045d1 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80467d:	83 ec 08             	sub    $0x8,%esp
+  804680:	50                   	push   %eax
+  804681:	68 fc 52 80 00       	push   $0x8052fc
+  804686:	e8 84 bf ff ff       	call   80060f <cprintf>
+		return r;
+  80468b:	83 c4 10             	add    $0x10,%esp
+  80468e:	e9 3e ff ff ff       	jmp    8045d1 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804693:	83 ec 08             	sub    $0x8,%esp
+  804696:	50                   	push   %eax
+  804697:	68 24 53 80 00       	push   $0x805324
+  80469c:	e8 6e bf ff ff       	call   80060f <cprintf>
+		return r;
+  8046a1:	83 c4 10             	add    $0x10,%esp
+  8046a4:	e9 28 ff ff ff       	jmp    8045d1 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8046a9:	83 ec 08             	sub    $0x8,%esp
+  8046ac:	50                   	push   %eax
+  8046ad:	68 99 53 80 00       	push   $0x805399
+  8046b2:	e8 58 bf ff ff       	call   80060f <cprintf>
+		return r;
+  8046b7:	83 c4 10             	add    $0x10,%esp
+  8046ba:	e9 12 ff ff ff       	jmp    8045d1 <sfork+0x163>
+  8046bf:	89 c7                	mov    %eax,%edi
+  8046c1:	e9 0b ff ff ff       	jmp    8045d1 <sfork+0x163>
+  8046c6:	89 c7                	mov    %eax,%edi
+  8046c8:	e9 04 ff ff ff       	jmp    8045d1 <sfork+0x163>
+
+008046cd <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8046cd:	55                   	push   %ebp
+  8046ce:	89 e5                	mov    %esp,%ebp
+  8046d0:	57                   	push   %edi
+  8046d1:	56                   	push   %esi
+  8046d2:	53                   	push   %ebx
+  8046d3:	83 ec 18             	sub    $0x18,%esp
+  8046d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8046d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8046dc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8046df:	85 c0                	test   %eax,%eax
+  8046e1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8046e6:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8046e9:	50                   	push   %eax
+  8046ea:	e8 38 cb ff ff       	call   801227 <sys_ipc_recv>
+	if (r < 0) {
+  8046ef:	83 c4 10             	add    $0x10,%esp
+  8046f2:	85 c0                	test   %eax,%eax
+  8046f4:	78 2b                	js     804721 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8046f6:	85 ff                	test   %edi,%edi
+  8046f8:	74 55                	je     80474f <ipc_recv+0x82>
+  8046fa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046fc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804702:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804707:	77 39                	ja     804742 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804709:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80470e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804710:	c1 e8 10             	shr    $0x10,%eax
+  804713:	74 2d                	je     804742 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804715:	c1 e0 10             	shl    $0x10,%eax
+  804718:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80471d:	29 c2                	sub    %eax,%edx
+  80471f:	eb 27                	jmp    804748 <ipc_recv+0x7b>
+  804721:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804723:	83 ec 08             	sub    $0x8,%esp
+  804726:	50                   	push   %eax
+  804727:	68 b7 53 80 00       	push   $0x8053b7
+  80472c:	e8 de be ff ff       	call   80060f <cprintf>
+		*from_env_store = 0;
+  804731:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804737:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80473d:	83 c4 10             	add    $0x10,%esp
+  804740:	eb 77                	jmp    8047b9 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804742:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804748:	8b 02                	mov    (%edx),%eax
+  80474a:	8b 40 78             	mov    0x78(%eax),%eax
+  80474d:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80474f:	85 f6                	test   %esi,%esi
+  804751:	74 34                	je     804787 <ipc_recv+0xba>
+  804753:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804755:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80475b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804760:	77 18                	ja     80477a <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804762:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804767:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804769:	c1 e8 10             	shr    $0x10,%eax
+  80476c:	74 0c                	je     80477a <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80476e:	c1 e0 10             	shl    $0x10,%eax
+  804771:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804776:	29 c2                	sub    %eax,%edx
+  804778:	eb 06                	jmp    804780 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80477a:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804780:	8b 02                	mov    (%edx),%eax
+  804782:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804785:	89 06                	mov    %eax,(%esi)
+  804787:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804789:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80478f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804794:	77 18                	ja     8047ae <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804796:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80479b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80479d:	c1 e8 10             	shr    $0x10,%eax
+  8047a0:	74 0c                	je     8047ae <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8047a2:	c1 e0 10             	shl    $0x10,%eax
+  8047a5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8047aa:	29 c2                	sub    %eax,%edx
+  8047ac:	eb 06                	jmp    8047b4 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8047ae:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8047b4:	8b 02                	mov    (%edx),%eax
+  8047b6:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8047b9:	89 d8                	mov    %ebx,%eax
+  8047bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047be:	5b                   	pop    %ebx
+  8047bf:	5e                   	pop    %esi
+  8047c0:	5f                   	pop    %edi
+  8047c1:	5d                   	pop    %ebp
+  8047c2:	c3                   	ret
+
+008047c3 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8047c3:	55                   	push   %ebp
+  8047c4:	89 e5                	mov    %esp,%ebp
+  8047c6:	57                   	push   %edi
+  8047c7:	56                   	push   %esi
+  8047c8:	53                   	push   %ebx
+  8047c9:	83 ec 0c             	sub    $0xc,%esp
+  8047cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8047cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8047d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8047d5:	85 db                	test   %ebx,%ebx
+  8047d7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8047dc:	0f 44 d8             	cmove  %eax,%ebx
+  8047df:	eb 05                	jmp    8047e6 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8047e1:	e8 1f c8 ff ff       	call   801005 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8047e6:	57                   	push   %edi
+  8047e7:	53                   	push   %ebx
+  8047e8:	ff 75 0c             	push   0xc(%ebp)
+  8047eb:	56                   	push   %esi
+  8047ec:	e8 09 ca ff ff       	call   8011fa <sys_ipc_try_send>
+		if (r == 0) {
+  8047f1:	83 c4 10             	add    $0x10,%esp
+  8047f4:	85 c0                	test   %eax,%eax
+  8047f6:	74 19                	je     804811 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8047f8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8047fb:	74 e4                	je     8047e1 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8047fd:	83 ec 0c             	sub    $0xc,%esp
+  804800:	50                   	push   %eax
+  804801:	57                   	push   %edi
+  804802:	53                   	push   %ebx
+  804803:	56                   	push   %esi
+  804804:	68 d0 53 80 00       	push   $0x8053d0
+  804809:	e8 01 be ff ff       	call   80060f <cprintf>
+			return;
+  80480e:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804814:	5b                   	pop    %ebx
+  804815:	5e                   	pop    %esi
+  804816:	5f                   	pop    %edi
+  804817:	5d                   	pop    %ebp
+  804818:	c3                   	ret
+
+00804819 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804819:	55                   	push   %ebp
+  80481a:	89 e5                	mov    %esp,%ebp
+  80481c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80481f:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804824:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804827:	c1 e0 04             	shl    $0x4,%eax
+  80482a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80482f:	8b 40 50             	mov    0x50(%eax),%eax
+  804832:	39 c8                	cmp    %ecx,%eax
+  804834:	74 12                	je     804848 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804836:	83 c2 01             	add    $0x1,%edx
+  804839:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80483f:	75 e3                	jne    804824 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804841:	b8 00 00 00 00       	mov    $0x0,%eax
+  804846:	eb 0e                	jmp    804856 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804848:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80484b:	c1 e0 04             	shl    $0x4,%eax
+  80484e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804853:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804856:	5d                   	pop    %ebp
+  804857:	c3                   	ret
+
+00804858 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804858:	55                   	push   %ebp
+  804859:	89 e5                	mov    %esp,%ebp
+  80485b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80485e:	89 c2                	mov    %eax,%edx
+  804860:	c1 ea 16             	shr    $0x16,%edx
+  804863:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80486a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80486f:	f6 c1 01             	test   $0x1,%cl
+  804872:	74 1c                	je     804890 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804874:	c1 e8 0c             	shr    $0xc,%eax
+  804877:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80487e:	a8 01                	test   $0x1,%al
+  804880:	74 0e                	je     804890 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804882:	c1 e8 0c             	shr    $0xc,%eax
+  804885:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80488c:	ef 
+  80488d:	0f b7 d2             	movzwl %dx,%edx
+}
+  804890:	89 d0                	mov    %edx,%eax
+  804892:	5d                   	pop    %ebp
+  804893:	c3                   	ret
+
+00804894 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804894:	55                   	push   %ebp
+  804895:	89 e5                	mov    %esp,%ebp
+  804897:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80489a:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8048a1:	74 0a                	je     8048ad <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8048a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048a6:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8048ab:	c9                   	leave
+  8048ac:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8048ad:	83 ec 04             	sub    $0x4,%esp
+  8048b0:	6a 07                	push   $0x7
+  8048b2:	68 00 f0 bf ee       	push   $0xeebff000
+  8048b7:	6a 00                	push   $0x0
+  8048b9:	e8 73 c7 ff ff       	call   801031 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8048be:	83 c4 08             	add    $0x8,%esp
+  8048c1:	68 d2 48 80 00       	push   $0x8048d2
+  8048c6:	6a 00                	push   $0x0
+  8048c8:	e8 e1 c8 ff ff       	call   8011ae <sys_env_set_pgfault_upcall>
+  8048cd:	83 c4 10             	add    $0x10,%esp
+  8048d0:	eb d1                	jmp    8048a3 <set_pgfault_handler+0xf>
+
+008048d2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048d2:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048d3:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8048d8:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8048da:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8048dd:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8048e1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8048e5:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8048e8:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8048ec:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8048ee:	83 c4 08             	add    $0x8,%esp
+	popal
+  8048f1:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8048f2:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8048f5:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8048f6:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8048f7:	c3                   	ret
+
+008048f8 <udm>:
+  8048f8:	57                   	push   %edi
+  8048f9:	56                   	push   %esi
+  8048fa:	53                   	push   %ebx
+  8048fb:	83 ec 20             	sub    $0x20,%esp
+  8048fe:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804902:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804906:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80490a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80490e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804912:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804916:	89 d1                	mov    %edx,%ecx
+  804918:	09 c1                	or     %eax,%ecx
+  80491a:	0f 84 91 00 00 00    	je     8049b1 <udm+0xb9>
+  804920:	b8 00 00 00 00       	mov    $0x0,%eax
+  804925:	ba 00 00 00 00       	mov    $0x0,%edx
+  80492a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80492f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804936:	00 
+  804937:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80493e:	00 
+  80493f:	eb 08                	jmp    804949 <udm+0x51>
+  804941:	83 e9 01             	sub    $0x1,%ecx
+  804944:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804947:	74 7c                	je     8049c5 <udm+0xcd>
+  804949:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80494d:	01 c0                	add    %eax,%eax
+  80494f:	89 c6                	mov    %eax,%esi
+  804951:	89 d7                	mov    %edx,%edi
+  804953:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804957:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80495b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80495e:	d3 ea                	shr    %cl,%edx
+  804960:	f6 c1 20             	test   $0x20,%cl
+  804963:	74 04                	je     804969 <udm+0x71>
+  804965:	89 d0                	mov    %edx,%eax
+  804967:	31 d2                	xor    %edx,%edx
+  804969:	83 e0 01             	and    $0x1,%eax
+  80496c:	89 04 24             	mov    %eax,(%esp)
+  80496f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804976:	00 
+  804977:	8b 04 24             	mov    (%esp),%eax
+  80497a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80497e:	09 f0                	or     %esi,%eax
+  804980:	09 fa                	or     %edi,%edx
+  804982:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804986:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80498a:	39 f0                	cmp    %esi,%eax
+  80498c:	89 d3                	mov    %edx,%ebx
+  80498e:	19 fb                	sbb    %edi,%ebx
+  804990:	72 af                	jb     804941 <udm+0x49>
+  804992:	29 f0                	sub    %esi,%eax
+  804994:	19 fa                	sbb    %edi,%edx
+  804996:	89 cf                	mov    %ecx,%edi
+  804998:	c1 ef 05             	shr    $0x5,%edi
+  80499b:	83 e7 01             	and    $0x1,%edi
+  80499e:	89 fe                	mov    %edi,%esi
+  8049a0:	83 f6 01             	xor    $0x1,%esi
+  8049a3:	d3 e6                	shl    %cl,%esi
+  8049a5:	d3 e7                	shl    %cl,%edi
+  8049a7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8049ab:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8049af:	eb 90                	jmp    804941 <udm+0x49>
+  8049b1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049b5:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8049b9:	89 f0                	mov    %esi,%eax
+  8049bb:	89 fa                	mov    %edi,%edx
+  8049bd:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8049c1:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8049c5:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8049c9:	89 01                	mov    %eax,(%ecx)
+  8049cb:	89 51 04             	mov    %edx,0x4(%ecx)
+  8049ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8049d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8049d6:	83 c4 20             	add    $0x20,%esp
+  8049d9:	5b                   	pop    %ebx
+  8049da:	5e                   	pop    %esi
+  8049db:	5f                   	pop    %edi
+  8049dc:	c3                   	ret
+
+008049dd <__udivdi3>:
+  8049dd:	83 ec 18             	sub    $0x18,%esp
+  8049e0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8049e4:	50                   	push   %eax
+  8049e5:	ff 74 24 2c          	push   0x2c(%esp)
+  8049e9:	ff 74 24 2c          	push   0x2c(%esp)
+  8049ed:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049f1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049f5:	e8 fe fe ff ff       	call   8048f8 <udm>
+  8049fa:	83 c4 24             	add    $0x24,%esp
+  8049fd:	c3                   	ret
+
+008049fe <__umoddi3>:
+  8049fe:	83 ec 18             	sub    $0x18,%esp
+  804a01:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804a05:	50                   	push   %eax
+  804a06:	ff 74 24 2c          	push   0x2c(%esp)
+  804a0a:	ff 74 24 2c          	push   0x2c(%esp)
+  804a0e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a12:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a16:	e8 dd fe ff ff       	call   8048f8 <udm>
+  804a1b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a1f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a23:	83 c4 24             	add    $0x24,%esp
+  804a26:	c3                   	ret
+
+00804a27 <__divdi3>:
+  804a27:	56                   	push   %esi
+  804a28:	53                   	push   %ebx
+  804a29:	83 ec 14             	sub    $0x14,%esp
+  804a2c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804a30:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804a34:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804a38:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804a3c:	85 d2                	test   %edx,%edx
+  804a3e:	78 18                	js     804a58 <__divdi3+0x31>
+  804a40:	85 db                	test   %ebx,%ebx
+  804a42:	78 3e                	js     804a82 <__divdi3+0x5b>
+  804a44:	83 ec 04             	sub    $0x4,%esp
+  804a47:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a4b:	56                   	push   %esi
+  804a4c:	53                   	push   %ebx
+  804a4d:	51                   	push   %ecx
+  804a4e:	e8 a5 fe ff ff       	call   8048f8 <udm>
+  804a53:	83 c4 10             	add    $0x10,%esp
+  804a56:	eb 24                	jmp    804a7c <__divdi3+0x55>
+  804a58:	f7 d8                	neg    %eax
+  804a5a:	83 d2 00             	adc    $0x0,%edx
+  804a5d:	f7 da                	neg    %edx
+  804a5f:	85 db                	test   %ebx,%ebx
+  804a61:	78 3a                	js     804a9d <__divdi3+0x76>
+  804a63:	83 ec 04             	sub    $0x4,%esp
+  804a66:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a6a:	56                   	push   %esi
+  804a6b:	53                   	push   %ebx
+  804a6c:	51                   	push   %ecx
+  804a6d:	e8 86 fe ff ff       	call   8048f8 <udm>
+  804a72:	83 c4 10             	add    $0x10,%esp
+  804a75:	f7 d8                	neg    %eax
+  804a77:	83 d2 00             	adc    $0x0,%edx
+  804a7a:	f7 da                	neg    %edx
+  804a7c:	83 c4 14             	add    $0x14,%esp
+  804a7f:	5b                   	pop    %ebx
+  804a80:	5e                   	pop    %esi
+  804a81:	c3                   	ret
+  804a82:	83 ec 04             	sub    $0x4,%esp
+  804a85:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a89:	56                   	push   %esi
+  804a8a:	f7 d9                	neg    %ecx
+  804a8c:	83 d3 00             	adc    $0x0,%ebx
+  804a8f:	f7 db                	neg    %ebx
+  804a91:	53                   	push   %ebx
+  804a92:	51                   	push   %ecx
+  804a93:	e8 60 fe ff ff       	call   8048f8 <udm>
+  804a98:	83 c4 10             	add    $0x10,%esp
+  804a9b:	eb d8                	jmp    804a75 <__divdi3+0x4e>
+  804a9d:	83 ec 04             	sub    $0x4,%esp
+  804aa0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804aa4:	56                   	push   %esi
+  804aa5:	f7 d9                	neg    %ecx
+  804aa7:	83 d3 00             	adc    $0x0,%ebx
+  804aaa:	f7 db                	neg    %ebx
+  804aac:	53                   	push   %ebx
+  804aad:	51                   	push   %ecx
+  804aae:	e8 45 fe ff ff       	call   8048f8 <udm>
+  804ab3:	83 c4 10             	add    $0x10,%esp
+  804ab6:	eb c4                	jmp    804a7c <__divdi3+0x55>
+
+00804ab8 <__moddi3>:
+  804ab8:	55                   	push   %ebp
+  804ab9:	57                   	push   %edi
+  804aba:	56                   	push   %esi
+  804abb:	53                   	push   %ebx
+  804abc:	83 ec 24             	sub    $0x24,%esp
+  804abf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804ac3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804ac7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804acb:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804acf:	85 d2                	test   %edx,%edx
+  804ad1:	78 3b                	js     804b0e <__moddi3+0x56>
+  804ad3:	83 ec 04             	sub    $0x4,%esp
+  804ad6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804ada:	56                   	push   %esi
+  804adb:	89 ce                	mov    %ecx,%esi
+  804add:	f7 de                	neg    %esi
+  804adf:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804ae3:	89 de                	mov    %ebx,%esi
+  804ae5:	83 d6 00             	adc    $0x0,%esi
+  804ae8:	f7 de                	neg    %esi
+  804aea:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804aee:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804af2:	0f 48 f1             	cmovs  %ecx,%esi
+  804af5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804afa:	53                   	push   %ebx
+  804afb:	56                   	push   %esi
+  804afc:	e8 f7 fd ff ff       	call   8048f8 <udm>
+  804b01:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b05:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b09:	83 c4 10             	add    $0x10,%esp
+  804b0c:	eb 47                	jmp    804b55 <__moddi3+0x9d>
+  804b0e:	f7 d8                	neg    %eax
+  804b10:	83 d2 00             	adc    $0x0,%edx
+  804b13:	f7 da                	neg    %edx
+  804b15:	83 ec 04             	sub    $0x4,%esp
+  804b18:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804b1c:	56                   	push   %esi
+  804b1d:	89 cf                	mov    %ecx,%edi
+  804b1f:	f7 df                	neg    %edi
+  804b21:	89 de                	mov    %ebx,%esi
+  804b23:	83 d6 00             	adc    $0x0,%esi
+  804b26:	f7 de                	neg    %esi
+  804b28:	0f 49 cf             	cmovns %edi,%ecx
+  804b2b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804b2f:	0f 49 de             	cmovns %esi,%ebx
+  804b32:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804b36:	ff 74 24 0c          	push   0xc(%esp)
+  804b3a:	ff 74 24 0c          	push   0xc(%esp)
+  804b3e:	e8 b5 fd ff ff       	call   8048f8 <udm>
+  804b43:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b47:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b4b:	f7 d8                	neg    %eax
+  804b4d:	83 d2 00             	adc    $0x0,%edx
+  804b50:	f7 da                	neg    %edx
+  804b52:	83 c4 10             	add    $0x10,%esp
+  804b55:	83 c4 24             	add    $0x24,%esp
+  804b58:	5b                   	pop    %ebx
+  804b59:	5e                   	pop    %esi
+  804b5a:	5f                   	pop    %edi
+  804b5b:	5d                   	pop    %ebp
+  804b5c:	c3                   	ret
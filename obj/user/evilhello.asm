@@ -0,0 +1,9688 @@
+
+obj/user/evilhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	// try to print the kernel entry point as a string!  mua ha ha!
+	sys_cputs((char*)0xf010000c, 100);
+  800039:	6a 64                	push   $0x64
+  80003b:	68 0c 00 10 f0       	push   $0xf010000c
+  800040:	e8 a8 00 00 00       	call   8000ed <sys_cputs>
+}
+  800045:	83 c4 10             	add    $0x10,%esp
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+
+0080004a <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	57                   	push   %edi
+  80004e:	56                   	push   %esi
+  80004f:	53                   	push   %ebx
+  800050:	83 ec 1c             	sub    $0x1c,%esp
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800059:	e8 31 01 00 00       	call   80018f <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80005e:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800061:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006c:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80006e:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800070:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800076:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80007b:	77 16                	ja     800093 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80007d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800082:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800084:	c1 e8 10             	shr    $0x10,%eax
+  800087:	74 0a                	je     800093 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800089:	c1 e0 10             	shl    $0x10,%eax
+  80008c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800091:	29 c2                	sub    %eax,%edx
+  800093:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800096:	c1 e0 04             	shl    $0x4,%eax
+  800099:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a0:	85 db                	test   %ebx,%ebx
+  8000a2:	7e 07                	jle    8000ab <libmain+0x61>
+		binaryname = argv[0];
+  8000a4:	8b 06                	mov    (%esi),%eax
+  8000a6:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	e8 7e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b5:	e8 0b 00 00 00       	call   8000c5 <exit>
+}
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5f                   	pop    %edi
+  8000c3:	5d                   	pop    %ebp
+  8000c4:	c3                   	ret
+
+008000c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000cb:	6a 00                	push   $0x0
+  8000cd:	e8 12 17 00 00       	call   8017e4 <fflush>
+	pthread_kill_others();
+  8000d2:	e8 7d 2d 00 00       	call   802e54 <pthread_kill_others>
+	close_all();
+  8000d7:	e8 ab 07 00 00       	call   800887 <close_all>
+	sys_env_destroy(0);
+  8000dc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000e3:	e8 5c 00 00 00       	call   800144 <sys_env_destroy>
+}
+  8000e8:	83 c4 10             	add    $0x10,%esp
+  8000eb:	c9                   	leave
+  8000ec:	c3                   	ret
+
+008000ed <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	57                   	push   %edi
+  8000f1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000fd:	89 c3                	mov    %eax,%ebx
+  8000ff:	89 c7                	mov    %eax,%edi
+  800101:	6a 00                	push   $0x0
+  800103:	55                   	push   %ebp
+  800104:	56                   	push   %esi
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	8d 35 0f 01 80 00    	lea    0x80010f,%esi
+  80010d:	0f 34                	sysenter
+
+0080010f <after_sysenter_label_47>:
+  80010f:	5e                   	pop    %esi
+  800110:	5d                   	pop    %ebp
+  800111:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800114:	5b                   	pop    %ebx
+  800115:	5f                   	pop    %edi
+  800116:	5d                   	pop    %ebp
+  800117:	c3                   	ret
+
+00800118 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	57                   	push   %edi
+  80011c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80011d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800122:	b8 01 00 00 00       	mov    $0x1,%eax
+  800127:	89 d1                	mov    %edx,%ecx
+  800129:	89 d3                	mov    %edx,%ebx
+  80012b:	89 d7                	mov    %edx,%edi
+  80012d:	6a 00                	push   $0x0
+  80012f:	55                   	push   %ebp
+  800130:	56                   	push   %esi
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	8d 35 3b 01 80 00    	lea    0x80013b,%esi
+  800139:	0f 34                	sysenter
+
+0080013b <after_sysenter_label_128>:
+  80013b:	5e                   	pop    %esi
+  80013c:	5d                   	pop    %ebp
+  80013d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800140:	5b                   	pop    %ebx
+  800141:	5f                   	pop    %edi
+  800142:	5d                   	pop    %ebp
+  800143:	c3                   	ret
+
+00800144 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	57                   	push   %edi
+  800148:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80014c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800151:	b8 03 00 00 00       	mov    $0x3,%eax
+  800156:	89 cb                	mov    %ecx,%ebx
+  800158:	89 cf                	mov    %ecx,%edi
+  80015a:	6a 00                	push   $0x0
+  80015c:	55                   	push   %ebp
+  80015d:	56                   	push   %esi
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	8d 35 68 01 80 00    	lea    0x800168,%esi
+  800166:	0f 34                	sysenter
+
+00800168 <after_sysenter_label_212>:
+  800168:	5e                   	pop    %esi
+  800169:	5d                   	pop    %ebp
+  80016a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80016d:	85 c0                	test   %eax,%eax
+  80016f:	7f 07                	jg     800178 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800171:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800174:	5b                   	pop    %ebx
+  800175:	5f                   	pop    %edi
+  800176:	5d                   	pop    %ebp
+  800177:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800178:	83 ec 0c             	sub    $0xc,%esp
+  80017b:	50                   	push   %eax
+  80017c:	6a 03                	push   $0x3
+  80017e:	68 ea 46 80 00       	push   $0x8046ea
+  800183:	6a 54                	push   $0x54
+  800185:	68 07 47 80 00       	push   $0x804707
+  80018a:	e8 38 30 00 00       	call   8031c7 <_panic>
+
+0080018f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	57                   	push   %edi
+  800193:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800194:	ba 00 00 00 00       	mov    $0x0,%edx
+  800199:	b8 02 00 00 00       	mov    $0x2,%eax
+  80019e:	89 d1                	mov    %edx,%ecx
+  8001a0:	89 d3                	mov    %edx,%ebx
+  8001a2:	89 d7                	mov    %edx,%edi
+  8001a4:	6a 00                	push   $0x0
+  8001a6:	55                   	push   %ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	8d 35 b2 01 80 00    	lea    0x8001b2,%esi
+  8001b0:	0f 34                	sysenter
+
+008001b2 <after_sysenter_label_309>:
+  8001b2:	5e                   	pop    %esi
+  8001b3:	5d                   	pop    %ebp
+  8001b4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001b7:	5b                   	pop    %ebx
+  8001b8:	5f                   	pop    %edi
+  8001b9:	5d                   	pop    %ebp
+  8001ba:	c3                   	ret
+
+008001bb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001bb:	55                   	push   %ebp
+  8001bc:	89 e5                	mov    %esp,%ebp
+  8001be:	57                   	push   %edi
+  8001bf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001ca:	89 d1                	mov    %edx,%ecx
+  8001cc:	89 d3                	mov    %edx,%ebx
+  8001ce:	89 d7                	mov    %edx,%edi
+  8001d0:	6a 00                	push   $0x0
+  8001d2:	55                   	push   %ebp
+  8001d3:	56                   	push   %esi
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	8d 35 de 01 80 00    	lea    0x8001de,%esi
+  8001dc:	0f 34                	sysenter
+
+008001de <after_sysenter_label_391>:
+  8001de:	5e                   	pop    %esi
+  8001df:	5d                   	pop    %ebp
+  8001e0:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001e3:	5b                   	pop    %ebx
+  8001e4:	5f                   	pop    %edi
+  8001e5:	5d                   	pop    %ebp
+  8001e6:	c3                   	ret
+
+008001e7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	57                   	push   %edi
+  8001eb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ff:	6a 00                	push   $0x0
+  800201:	55                   	push   %ebp
+  800202:	56                   	push   %esi
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	8d 35 0d 02 80 00    	lea    0x80020d,%esi
+  80020b:	0f 34                	sysenter
+
+0080020d <after_sysenter_label_479>:
+  80020d:	5e                   	pop    %esi
+  80020e:	5d                   	pop    %ebp
+  80020f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800212:	85 c0                	test   %eax,%eax
+  800214:	7f 07                	jg     80021d <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800216:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800219:	5b                   	pop    %ebx
+  80021a:	5f                   	pop    %edi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021d:	83 ec 0c             	sub    $0xc,%esp
+  800220:	50                   	push   %eax
+  800221:	6a 04                	push   $0x4
+  800223:	68 ea 46 80 00       	push   $0x8046ea
+  800228:	6a 54                	push   $0x54
+  80022a:	68 07 47 80 00       	push   $0x804707
+  80022f:	e8 93 2f 00 00       	call   8031c7 <_panic>
+
+00800234 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	57                   	push   %edi
+  800238:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800247:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80024a:	ff 75 18             	push   0x18(%ebp)
+  80024d:	55                   	push   %ebp
+  80024e:	56                   	push   %esi
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	8d 35 59 02 80 00    	lea    0x800259,%esi
+  800257:	0f 34                	sysenter
+
+00800259 <after_sysenter_label_593>:
+  800259:	5e                   	pop    %esi
+  80025a:	5d                   	pop    %ebp
+  80025b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80025e:	85 c0                	test   %eax,%eax
+  800260:	7f 07                	jg     800269 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800262:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5f                   	pop    %edi
+  800267:	5d                   	pop    %ebp
+  800268:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800269:	83 ec 0c             	sub    $0xc,%esp
+  80026c:	50                   	push   %eax
+  80026d:	6a 05                	push   $0x5
+  80026f:	68 ea 46 80 00       	push   $0x8046ea
+  800274:	6a 54                	push   $0x54
+  800276:	68 07 47 80 00       	push   $0x804707
+  80027b:	e8 47 2f 00 00       	call   8031c7 <_panic>
+
+00800280 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	57                   	push   %edi
+  800284:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800285:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800290:	b8 06 00 00 00       	mov    $0x6,%eax
+  800295:	89 df                	mov    %ebx,%edi
+  800297:	6a 00                	push   $0x0
+  800299:	55                   	push   %ebp
+  80029a:	56                   	push   %esi
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	8d 35 a5 02 80 00    	lea    0x8002a5,%esi
+  8002a3:	0f 34                	sysenter
+
+008002a5 <after_sysenter_label_704>:
+  8002a5:	5e                   	pop    %esi
+  8002a6:	5d                   	pop    %ebp
+  8002a7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002aa:	85 c0                	test   %eax,%eax
+  8002ac:	7f 07                	jg     8002b5 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002b1:	5b                   	pop    %ebx
+  8002b2:	5f                   	pop    %edi
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002b5:	83 ec 0c             	sub    $0xc,%esp
+  8002b8:	50                   	push   %eax
+  8002b9:	6a 06                	push   $0x6
+  8002bb:	68 ea 46 80 00       	push   $0x8046ea
+  8002c0:	6a 54                	push   $0x54
+  8002c2:	68 07 47 80 00       	push   $0x804707
+  8002c7:	e8 fb 2e 00 00       	call   8031c7 <_panic>
+
+008002cc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	57                   	push   %edi
+  8002d0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002dc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e1:	89 df                	mov    %ebx,%edi
+  8002e3:	6a 00                	push   $0x0
+  8002e5:	55                   	push   %ebp
+  8002e6:	56                   	push   %esi
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	8d 35 f1 02 80 00    	lea    0x8002f1,%esi
+  8002ef:	0f 34                	sysenter
+
+008002f1 <after_sysenter_label_808>:
+  8002f1:	5e                   	pop    %esi
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002f6:	85 c0                	test   %eax,%eax
+  8002f8:	7f 07                	jg     800301 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002fd:	5b                   	pop    %ebx
+  8002fe:	5f                   	pop    %edi
+  8002ff:	5d                   	pop    %ebp
+  800300:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	50                   	push   %eax
+  800305:	6a 08                	push   $0x8
+  800307:	68 ea 46 80 00       	push   $0x8046ea
+  80030c:	6a 54                	push   $0x54
+  80030e:	68 07 47 80 00       	push   $0x804707
+  800313:	e8 af 2e 00 00       	call   8031c7 <_panic>
+
+00800318 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	57                   	push   %edi
+  80031c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80031d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800322:	8b 55 08             	mov    0x8(%ebp),%edx
+  800325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800328:	b8 09 00 00 00       	mov    $0x9,%eax
+  80032d:	89 df                	mov    %ebx,%edi
+  80032f:	6a 00                	push   $0x0
+  800331:	55                   	push   %ebp
+  800332:	56                   	push   %esi
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	8d 35 3d 03 80 00    	lea    0x80033d,%esi
+  80033b:	0f 34                	sysenter
+
+0080033d <after_sysenter_label_912>:
+  80033d:	5e                   	pop    %esi
+  80033e:	5d                   	pop    %ebp
+  80033f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800342:	85 c0                	test   %eax,%eax
+  800344:	7f 07                	jg     80034d <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800346:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800349:	5b                   	pop    %ebx
+  80034a:	5f                   	pop    %edi
+  80034b:	5d                   	pop    %ebp
+  80034c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80034d:	83 ec 0c             	sub    $0xc,%esp
+  800350:	50                   	push   %eax
+  800351:	6a 09                	push   $0x9
+  800353:	68 ea 46 80 00       	push   $0x8046ea
+  800358:	6a 54                	push   $0x54
+  80035a:	68 07 47 80 00       	push   $0x804707
+  80035f:	e8 63 2e 00 00       	call   8031c7 <_panic>
+
+00800364 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800364:	55                   	push   %ebp
+  800365:	89 e5                	mov    %esp,%ebp
+  800367:	57                   	push   %edi
+  800368:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800374:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800379:	89 df                	mov    %ebx,%edi
+  80037b:	6a 00                	push   $0x0
+  80037d:	55                   	push   %ebp
+  80037e:	56                   	push   %esi
+  80037f:	89 e5                	mov    %esp,%ebp
+  800381:	8d 35 89 03 80 00    	lea    0x800389,%esi
+  800387:	0f 34                	sysenter
+
+00800389 <after_sysenter_label_1016>:
+  800389:	5e                   	pop    %esi
+  80038a:	5d                   	pop    %ebp
+  80038b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80038e:	85 c0                	test   %eax,%eax
+  800390:	7f 07                	jg     800399 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800392:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800395:	5b                   	pop    %ebx
+  800396:	5f                   	pop    %edi
+  800397:	5d                   	pop    %ebp
+  800398:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800399:	83 ec 0c             	sub    $0xc,%esp
+  80039c:	50                   	push   %eax
+  80039d:	6a 0a                	push   $0xa
+  80039f:	68 ea 46 80 00       	push   $0x8046ea
+  8003a4:	6a 54                	push   $0x54
+  8003a6:	68 07 47 80 00       	push   $0x804707
+  8003ab:	e8 17 2e 00 00       	call   8031c7 <_panic>
+
+008003b0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	57                   	push   %edi
+  8003b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003c6:	6a 00                	push   $0x0
+  8003c8:	55                   	push   %ebp
+  8003c9:	56                   	push   %esi
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	8d 35 d4 03 80 00    	lea    0x8003d4,%esi
+  8003d2:	0f 34                	sysenter
+
+008003d4 <after_sysenter_label_1126>:
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003d9:	5b                   	pop    %ebx
+  8003da:	5f                   	pop    %edi
+  8003db:	5d                   	pop    %ebp
+  8003dc:	c3                   	ret
+
+008003dd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	57                   	push   %edi
+  8003e1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ef:	89 cb                	mov    %ecx,%ebx
+  8003f1:	89 cf                	mov    %ecx,%edi
+  8003f3:	6a 00                	push   $0x0
+  8003f5:	55                   	push   %ebp
+  8003f6:	56                   	push   %esi
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	8d 35 01 04 80 00    	lea    0x800401,%esi
+  8003ff:	0f 34                	sysenter
+
+00800401 <after_sysenter_label_1210>:
+  800401:	5e                   	pop    %esi
+  800402:	5d                   	pop    %ebp
+  800403:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800406:	85 c0                	test   %eax,%eax
+  800408:	7f 07                	jg     800411 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80040a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80040d:	5b                   	pop    %ebx
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800411:	83 ec 0c             	sub    $0xc,%esp
+  800414:	50                   	push   %eax
+  800415:	6a 0d                	push   $0xd
+  800417:	68 ea 46 80 00       	push   $0x8046ea
+  80041c:	6a 54                	push   $0x54
+  80041e:	68 07 47 80 00       	push   $0x804707
+  800423:	e8 9f 2d 00 00       	call   8031c7 <_panic>
+
+00800428 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	57                   	push   %edi
+  80042c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80042d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800432:	8b 55 08             	mov    0x8(%ebp),%edx
+  800435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800438:	b8 42 00 00 00       	mov    $0x42,%eax
+  80043d:	89 df                	mov    %ebx,%edi
+  80043f:	6a 00                	push   $0x0
+  800441:	55                   	push   %ebp
+  800442:	56                   	push   %esi
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	8d 35 4d 04 80 00    	lea    0x80044d,%esi
+  80044b:	0f 34                	sysenter
+
+0080044d <after_sysenter_label_1311>:
+  80044d:	5e                   	pop    %esi
+  80044e:	5d                   	pop    %ebp
+  80044f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800452:	85 c0                	test   %eax,%eax
+  800454:	7f 07                	jg     80045d <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800456:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800459:	5b                   	pop    %ebx
+  80045a:	5f                   	pop    %edi
+  80045b:	5d                   	pop    %ebp
+  80045c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80045d:	83 ec 0c             	sub    $0xc,%esp
+  800460:	50                   	push   %eax
+  800461:	6a 42                	push   $0x42
+  800463:	68 ea 46 80 00       	push   $0x8046ea
+  800468:	6a 54                	push   $0x54
+  80046a:	68 07 47 80 00       	push   $0x804707
+  80046f:	e8 53 2d 00 00       	call   8031c7 <_panic>
+
+00800474 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800474:	55                   	push   %ebp
+  800475:	89 e5                	mov    %esp,%ebp
+  800477:	57                   	push   %edi
+  800478:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800483:	89 d1                	mov    %edx,%ecx
+  800485:	89 d3                	mov    %edx,%ebx
+  800487:	89 d7                	mov    %edx,%edi
+  800489:	6a 00                	push   $0x0
+  80048b:	55                   	push   %ebp
+  80048c:	56                   	push   %esi
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	8d 35 97 04 80 00    	lea    0x800497,%esi
+  800495:	0f 34                	sysenter
+
+00800497 <after_sysenter_label_1411>:
+  800497:	5e                   	pop    %esi
+  800498:	5d                   	pop    %ebp
+  800499:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80049c:	5b                   	pop    %ebx
+  80049d:	5f                   	pop    %edi
+  80049e:	5d                   	pop    %ebp
+  80049f:	c3                   	ret
+
+008004a0 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8004a0:	55                   	push   %ebp
+  8004a1:	89 e5                	mov    %esp,%ebp
+  8004a3:	57                   	push   %edi
+  8004a4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004b5:	89 df                	mov    %ebx,%edi
+  8004b7:	6a 00                	push   $0x0
+  8004b9:	55                   	push   %ebp
+  8004ba:	56                   	push   %esi
+  8004bb:	89 e5                	mov    %esp,%ebp
+  8004bd:	8d 35 c5 04 80 00    	lea    0x8004c5,%esi
+  8004c3:	0f 34                	sysenter
+
+008004c5 <after_sysenter_label_1497>:
+  8004c5:	5e                   	pop    %esi
+  8004c6:	5d                   	pop    %ebp
+  8004c7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5f                   	pop    %edi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+
+008004ce <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	57                   	push   %edi
+  8004d2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004e3:	89 df                	mov    %ebx,%edi
+  8004e5:	6a 00                	push   $0x0
+  8004e7:	55                   	push   %ebp
+  8004e8:	56                   	push   %esi
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	8d 35 f3 04 80 00    	lea    0x8004f3,%esi
+  8004f1:	0f 34                	sysenter
+
+008004f3 <after_sysenter_label_1583>:
+  8004f3:	5e                   	pop    %esi
+  8004f4:	5d                   	pop    %ebp
+  8004f5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004f8:	5b                   	pop    %ebx
+  8004f9:	5f                   	pop    %edi
+  8004fa:	5d                   	pop    %ebp
+  8004fb:	c3                   	ret
+
+008004fc <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004fc:	55                   	push   %ebp
+  8004fd:	89 e5                	mov    %esp,%ebp
+  8004ff:	57                   	push   %edi
+  800500:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800501:	8b 55 08             	mov    0x8(%ebp),%edx
+  800504:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800507:	b8 11 00 00 00       	mov    $0x11,%eax
+  80050c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800511:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800514:	6a 00                	push   $0x0
+  800516:	55                   	push   %ebp
+  800517:	56                   	push   %esi
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	8d 35 22 05 80 00    	lea    0x800522,%esi
+  800520:	0f 34                	sysenter
+
+00800522 <after_sysenter_label_1672>:
+  800522:	5e                   	pop    %esi
+  800523:	5d                   	pop    %ebp
+  800524:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800527:	5b                   	pop    %ebx
+  800528:	5f                   	pop    %edi
+  800529:	5d                   	pop    %ebp
+  80052a:	c3                   	ret
+
+0080052b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80052b:	55                   	push   %ebp
+  80052c:	89 e5                	mov    %esp,%ebp
+  80052e:	57                   	push   %edi
+  80052f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800535:	8b 55 08             	mov    0x8(%ebp),%edx
+  800538:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800540:	89 df                	mov    %ebx,%edi
+  800542:	6a 00                	push   $0x0
+  800544:	55                   	push   %ebp
+  800545:	56                   	push   %esi
+  800546:	89 e5                	mov    %esp,%ebp
+  800548:	8d 35 50 05 80 00    	lea    0x800550,%esi
+  80054e:	0f 34                	sysenter
+
+00800550 <after_sysenter_label_1758>:
+  800550:	5e                   	pop    %esi
+  800551:	5d                   	pop    %ebp
+  800552:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800555:	5b                   	pop    %ebx
+  800556:	5f                   	pop    %edi
+  800557:	5d                   	pop    %ebp
+  800558:	c3                   	ret
+
+00800559 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	57                   	push   %edi
+  80055d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80055e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800561:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800566:	b8 13 00 00 00       	mov    $0x13,%eax
+  80056b:	89 cb                	mov    %ecx,%ebx
+  80056d:	89 cf                	mov    %ecx,%edi
+  80056f:	6a 00                	push   $0x0
+  800571:	55                   	push   %ebp
+  800572:	56                   	push   %esi
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	8d 35 7d 05 80 00    	lea    0x80057d,%esi
+  80057b:	0f 34                	sysenter
+
+0080057d <after_sysenter_label_1842>:
+  80057d:	5e                   	pop    %esi
+  80057e:	5d                   	pop    %ebp
+  80057f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800582:	85 c0                	test   %eax,%eax
+  800584:	7f 07                	jg     80058d <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800586:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800589:	5b                   	pop    %ebx
+  80058a:	5f                   	pop    %edi
+  80058b:	5d                   	pop    %ebp
+  80058c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80058d:	83 ec 0c             	sub    $0xc,%esp
+  800590:	50                   	push   %eax
+  800591:	6a 13                	push   $0x13
+  800593:	68 ea 46 80 00       	push   $0x8046ea
+  800598:	6a 54                	push   $0x54
+  80059a:	68 07 47 80 00       	push   $0x804707
+  80059f:	e8 23 2c 00 00       	call   8031c7 <_panic>
+
+008005a4 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8005a4:	55                   	push   %ebp
+  8005a5:	89 e5                	mov    %esp,%ebp
+  8005a7:	57                   	push   %edi
+  8005a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ae:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005b3:	89 d1                	mov    %edx,%ecx
+  8005b5:	89 d3                	mov    %edx,%ebx
+  8005b7:	89 d7                	mov    %edx,%edi
+  8005b9:	6a 00                	push   $0x0
+  8005bb:	55                   	push   %ebp
+  8005bc:	56                   	push   %esi
+  8005bd:	89 e5                	mov    %esp,%ebp
+  8005bf:	8d 35 c7 05 80 00    	lea    0x8005c7,%esi
+  8005c5:	0f 34                	sysenter
+
+008005c7 <after_sysenter_label_1939>:
+  8005c7:	5e                   	pop    %esi
+  8005c8:	5d                   	pop    %ebp
+  8005c9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005cc:	5b                   	pop    %ebx
+  8005cd:	5f                   	pop    %edi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+
+008005d0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005d0:	55                   	push   %ebp
+  8005d1:	89 e5                	mov    %esp,%ebp
+  8005d3:	57                   	push   %edi
+  8005d4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005db:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005e8:	6a 00                	push   $0x0
+  8005ea:	55                   	push   %ebp
+  8005eb:	56                   	push   %esi
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	8d 35 f6 05 80 00    	lea    0x8005f6,%esi
+  8005f4:	0f 34                	sysenter
+
+008005f6 <after_sysenter_label_2028>:
+  8005f6:	5e                   	pop    %esi
+  8005f7:	5d                   	pop    %ebp
+  8005f8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005fb:	5b                   	pop    %ebx
+  8005fc:	5f                   	pop    %edi
+  8005fd:	5d                   	pop    %ebp
+  8005fe:	c3                   	ret
+
+008005ff <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005ff:	55                   	push   %ebp
+  800600:	89 e5                	mov    %esp,%ebp
+  800602:	57                   	push   %edi
+  800603:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800609:	8b 55 08             	mov    0x8(%ebp),%edx
+  80060c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80060f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800614:	89 df                	mov    %ebx,%edi
+  800616:	6a 00                	push   $0x0
+  800618:	55                   	push   %ebp
+  800619:	56                   	push   %esi
+  80061a:	89 e5                	mov    %esp,%ebp
+  80061c:	8d 35 24 06 80 00    	lea    0x800624,%esi
+  800622:	0f 34                	sysenter
+
+00800624 <after_sysenter_label_2114>:
+  800624:	5e                   	pop    %esi
+  800625:	5d                   	pop    %ebp
+  800626:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800629:	5b                   	pop    %ebx
+  80062a:	5f                   	pop    %edi
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+
+0080062d <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+  800630:	57                   	push   %edi
+  800631:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80063d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800642:	89 df                	mov    %ebx,%edi
+  800644:	6a 00                	push   $0x0
+  800646:	55                   	push   %ebp
+  800647:	56                   	push   %esi
+  800648:	89 e5                	mov    %esp,%ebp
+  80064a:	8d 35 52 06 80 00    	lea    0x800652,%esi
+  800650:	0f 34                	sysenter
+
+00800652 <after_sysenter_label_2200>:
+  800652:	5e                   	pop    %esi
+  800653:	5d                   	pop    %ebp
+  800654:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800657:	5b                   	pop    %ebx
+  800658:	5f                   	pop    %edi
+  800659:	5d                   	pop    %ebp
+  80065a:	c3                   	ret
+
+0080065b <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80065b:	55                   	push   %ebp
+  80065c:	89 e5                	mov    %esp,%ebp
+  80065e:	57                   	push   %edi
+  80065f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800660:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800665:	8b 55 08             	mov    0x8(%ebp),%edx
+  800668:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800670:	89 df                	mov    %ebx,%edi
+  800672:	6a 00                	push   $0x0
+  800674:	55                   	push   %ebp
+  800675:	56                   	push   %esi
+  800676:	89 e5                	mov    %esp,%ebp
+  800678:	8d 35 80 06 80 00    	lea    0x800680,%esi
+  80067e:	0f 34                	sysenter
+
+00800680 <after_sysenter_label_2286>:
+  800680:	5e                   	pop    %esi
+  800681:	5d                   	pop    %ebp
+  800682:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800685:	5b                   	pop    %ebx
+  800686:	5f                   	pop    %edi
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80068c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80068f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800694:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800697:	5d                   	pop    %ebp
+  800698:	c3                   	ret
+
+00800699 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800699:	55                   	push   %ebp
+  80069a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80069c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8006a4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8006a9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006ae:	5d                   	pop    %ebp
+  8006af:	c3                   	ret
+
+008006b0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006b0:	55                   	push   %ebp
+  8006b1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006b3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006b8:	eb 02                	jmp    8006bc <fd_alloc+0xc>
+  8006ba:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006bc:	89 c2                	mov    %eax,%edx
+  8006be:	c1 ea 16             	shr    $0x16,%edx
+  8006c1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006c8:	f6 c2 01             	test   $0x1,%dl
+  8006cb:	74 2b                	je     8006f8 <fd_alloc+0x48>
+  8006cd:	89 c2                	mov    %eax,%edx
+  8006cf:	c1 ea 0c             	shr    $0xc,%edx
+  8006d2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006d9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006df:	f6 c1 01             	test   $0x1,%cl
+  8006e2:	74 14                	je     8006f8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006e4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006ea:	75 ce                	jne    8006ba <fd_alloc+0xa>
+  8006ec:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006f1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006f6:	eb 05                	jmp    8006fd <fd_alloc+0x4d>
+			return 0;
+  8006f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800700:	89 02                	mov    %eax,(%edx)
+}
+  800702:	89 c8                	mov    %ecx,%eax
+  800704:	5d                   	pop    %ebp
+  800705:	c3                   	ret
+
+00800706 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800706:	55                   	push   %ebp
+  800707:	89 e5                	mov    %esp,%ebp
+  800709:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80070c:	83 f8 1f             	cmp    $0x1f,%eax
+  80070f:	77 30                	ja     800741 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800711:	c1 e0 0c             	shl    $0xc,%eax
+  800714:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800719:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80071f:	f6 c2 01             	test   $0x1,%dl
+  800722:	74 24                	je     800748 <fd_lookup+0x42>
+  800724:	89 c2                	mov    %eax,%edx
+  800726:	c1 ea 0c             	shr    $0xc,%edx
+  800729:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800730:	f6 c2 01             	test   $0x1,%dl
+  800733:	74 1a                	je     80074f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800735:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800738:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80073a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80073f:	5d                   	pop    %ebp
+  800740:	c3                   	ret
+		return -E_INVAL;
+  800741:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800746:	eb f7                	jmp    80073f <fd_lookup+0x39>
+		return -E_INVAL;
+  800748:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074d:	eb f0                	jmp    80073f <fd_lookup+0x39>
+  80074f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800754:	eb e9                	jmp    80073f <fd_lookup+0x39>
+
+00800756 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	53                   	push   %ebx
+  80075a:	83 ec 04             	sub    $0x4,%esp
+  80075d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800760:	b8 00 00 00 00       	mov    $0x0,%eax
+  800765:	eb 03                	jmp    80076a <dev_lookup+0x14>
+  800767:	83 c0 01             	add    $0x1,%eax
+  80076a:	8b 1c 85 94 47 80 00 	mov    0x804794(,%eax,4),%ebx
+  800771:	85 db                	test   %ebx,%ebx
+  800773:	74 0b                	je     800780 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800775:	39 13                	cmp    %edx,(%ebx)
+  800777:	75 ee                	jne    800767 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077e:	eb 49                	jmp    8007c9 <dev_lookup+0x73>
+  800780:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800782:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800788:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80078d:	77 18                	ja     8007a7 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80078f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800794:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800796:	c1 e8 10             	shr    $0x10,%eax
+  800799:	74 0c                	je     8007a7 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80079b:	c1 e0 10             	shl    $0x10,%eax
+  80079e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8007a3:	29 c1                	sub    %eax,%ecx
+  8007a5:	eb 06                	jmp    8007ad <dev_lookup+0x57>
+		return pthread_main_tls;
+  8007a7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007ad:	8b 01                	mov    (%ecx),%eax
+  8007af:	8b 40 48             	mov    0x48(%eax),%eax
+  8007b2:	83 ec 04             	sub    $0x4,%esp
+  8007b5:	52                   	push   %edx
+  8007b6:	50                   	push   %eax
+  8007b7:	68 18 47 80 00       	push   $0x804718
+  8007bc:	e8 e1 2a 00 00       	call   8032a2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007c1:	83 c4 10             	add    $0x10,%esp
+  8007c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007cc:	89 1a                	mov    %ebx,(%edx)
+}
+  8007ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d1:	c9                   	leave
+  8007d2:	c3                   	ret
+
+008007d3 <fd_close>:
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	57                   	push   %edi
+  8007d7:	56                   	push   %esi
+  8007d8:	53                   	push   %ebx
+  8007d9:	83 ec 24             	sub    $0x24,%esp
+  8007dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007e5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007e6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007ec:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007ef:	50                   	push   %eax
+  8007f0:	e8 11 ff ff ff       	call   800706 <fd_lookup>
+  8007f5:	89 c3                	mov    %eax,%ebx
+  8007f7:	83 c4 10             	add    $0x10,%esp
+  8007fa:	85 c0                	test   %eax,%eax
+  8007fc:	78 05                	js     800803 <fd_close+0x30>
+	    || fd != fd2)
+  8007fe:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800801:	74 16                	je     800819 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800803:	89 f8                	mov    %edi,%eax
+  800805:	84 c0                	test   %al,%al
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80080f:	89 d8                	mov    %ebx,%eax
+  800811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800814:	5b                   	pop    %ebx
+  800815:	5e                   	pop    %esi
+  800816:	5f                   	pop    %edi
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800819:	83 ec 08             	sub    $0x8,%esp
+  80081c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80081f:	50                   	push   %eax
+  800820:	ff 36                	push   (%esi)
+  800822:	e8 2f ff ff ff       	call   800756 <dev_lookup>
+  800827:	89 c3                	mov    %eax,%ebx
+  800829:	83 c4 10             	add    $0x10,%esp
+  80082c:	85 c0                	test   %eax,%eax
+  80082e:	78 1a                	js     80084a <fd_close+0x77>
+		if (dev->dev_close)
+  800830:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800833:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800836:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80083b:	85 c0                	test   %eax,%eax
+  80083d:	74 0b                	je     80084a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80083f:	83 ec 0c             	sub    $0xc,%esp
+  800842:	56                   	push   %esi
+  800843:	ff d0                	call   *%eax
+  800845:	89 c3                	mov    %eax,%ebx
+  800847:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80084a:	83 ec 08             	sub    $0x8,%esp
+  80084d:	56                   	push   %esi
+  80084e:	6a 00                	push   $0x0
+  800850:	e8 2b fa ff ff       	call   800280 <sys_page_unmap>
+	return r;
+  800855:	83 c4 10             	add    $0x10,%esp
+  800858:	eb b5                	jmp    80080f <fd_close+0x3c>
+
+0080085a <close>:
+
+int
+close(int fdnum)
+{
+  80085a:	55                   	push   %ebp
+  80085b:	89 e5                	mov    %esp,%ebp
+  80085d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800860:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800863:	50                   	push   %eax
+  800864:	ff 75 08             	push   0x8(%ebp)
+  800867:	e8 9a fe ff ff       	call   800706 <fd_lookup>
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	79 02                	jns    800875 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800873:	c9                   	leave
+  800874:	c3                   	ret
+		return fd_close(fd, 1);
+  800875:	83 ec 08             	sub    $0x8,%esp
+  800878:	6a 01                	push   $0x1
+  80087a:	ff 75 f4             	push   -0xc(%ebp)
+  80087d:	e8 51 ff ff ff       	call   8007d3 <fd_close>
+  800882:	83 c4 10             	add    $0x10,%esp
+  800885:	eb ec                	jmp    800873 <close+0x19>
+
+00800887 <close_all>:
+
+void
+close_all(void)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	53                   	push   %ebx
+  80088b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80088e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800893:	83 ec 0c             	sub    $0xc,%esp
+  800896:	53                   	push   %ebx
+  800897:	e8 be ff ff ff       	call   80085a <close>
+	for (i = 0; i < MAXFD; i++)
+  80089c:	83 c3 01             	add    $0x1,%ebx
+  80089f:	83 c4 10             	add    $0x10,%esp
+  8008a2:	83 fb 20             	cmp    $0x20,%ebx
+  8008a5:	75 ec                	jne    800893 <close_all+0xc>
+}
+  8008a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+
+008008ac <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008ac:	55                   	push   %ebp
+  8008ad:	89 e5                	mov    %esp,%ebp
+  8008af:	57                   	push   %edi
+  8008b0:	56                   	push   %esi
+  8008b1:	53                   	push   %ebx
+  8008b2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008b8:	50                   	push   %eax
+  8008b9:	ff 75 08             	push   0x8(%ebp)
+  8008bc:	e8 45 fe ff ff       	call   800706 <fd_lookup>
+  8008c1:	89 c3                	mov    %eax,%ebx
+  8008c3:	83 c4 10             	add    $0x10,%esp
+  8008c6:	85 c0                	test   %eax,%eax
+  8008c8:	78 7f                	js     800949 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008ca:	83 ec 0c             	sub    $0xc,%esp
+  8008cd:	ff 75 0c             	push   0xc(%ebp)
+  8008d0:	e8 85 ff ff ff       	call   80085a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008d8:	c1 e6 0c             	shl    $0xc,%esi
+  8008db:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008e4:	89 3c 24             	mov    %edi,(%esp)
+  8008e7:	e8 ad fd ff ff       	call   800699 <fd2data>
+  8008ec:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008ee:	89 34 24             	mov    %esi,(%esp)
+  8008f1:	e8 a3 fd ff ff       	call   800699 <fd2data>
+  8008f6:	83 c4 10             	add    $0x10,%esp
+  8008f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008fc:	89 d8                	mov    %ebx,%eax
+  8008fe:	c1 e8 16             	shr    $0x16,%eax
+  800901:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800908:	a8 01                	test   $0x1,%al
+  80090a:	74 11                	je     80091d <dup+0x71>
+  80090c:	89 d8                	mov    %ebx,%eax
+  80090e:	c1 e8 0c             	shr    $0xc,%eax
+  800911:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800918:	f6 c2 01             	test   $0x1,%dl
+  80091b:	75 36                	jne    800953 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80091d:	89 f8                	mov    %edi,%eax
+  80091f:	c1 e8 0c             	shr    $0xc,%eax
+  800922:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800929:	83 ec 0c             	sub    $0xc,%esp
+  80092c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800931:	50                   	push   %eax
+  800932:	56                   	push   %esi
+  800933:	6a 00                	push   $0x0
+  800935:	57                   	push   %edi
+  800936:	6a 00                	push   $0x0
+  800938:	e8 f7 f8 ff ff       	call   800234 <sys_page_map>
+  80093d:	89 c3                	mov    %eax,%ebx
+  80093f:	83 c4 20             	add    $0x20,%esp
+  800942:	85 c0                	test   %eax,%eax
+  800944:	78 33                	js     800979 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800946:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800949:	89 d8                	mov    %ebx,%eax
+  80094b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80094e:	5b                   	pop    %ebx
+  80094f:	5e                   	pop    %esi
+  800950:	5f                   	pop    %edi
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800953:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80095a:	83 ec 0c             	sub    $0xc,%esp
+  80095d:	25 07 0e 00 00       	and    $0xe07,%eax
+  800962:	50                   	push   %eax
+  800963:	ff 75 d4             	push   -0x2c(%ebp)
+  800966:	6a 00                	push   $0x0
+  800968:	53                   	push   %ebx
+  800969:	6a 00                	push   $0x0
+  80096b:	e8 c4 f8 ff ff       	call   800234 <sys_page_map>
+  800970:	89 c3                	mov    %eax,%ebx
+  800972:	83 c4 20             	add    $0x20,%esp
+  800975:	85 c0                	test   %eax,%eax
+  800977:	79 a4                	jns    80091d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800979:	83 ec 08             	sub    $0x8,%esp
+  80097c:	56                   	push   %esi
+  80097d:	6a 00                	push   $0x0
+  80097f:	e8 fc f8 ff ff       	call   800280 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800984:	83 c4 08             	add    $0x8,%esp
+  800987:	ff 75 d4             	push   -0x2c(%ebp)
+  80098a:	6a 00                	push   $0x0
+  80098c:	e8 ef f8 ff ff       	call   800280 <sys_page_unmap>
+	return r;
+  800991:	83 c4 10             	add    $0x10,%esp
+  800994:	eb b3                	jmp    800949 <dup+0x9d>
+
+00800996 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	56                   	push   %esi
+  80099a:	53                   	push   %ebx
+  80099b:	83 ec 18             	sub    $0x18,%esp
+  80099e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009a4:	50                   	push   %eax
+  8009a5:	53                   	push   %ebx
+  8009a6:	e8 5b fd ff ff       	call   800706 <fd_lookup>
+  8009ab:	83 c4 10             	add    $0x10,%esp
+  8009ae:	85 c0                	test   %eax,%eax
+  8009b0:	78 3c                	js     8009ee <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009b2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009b5:	83 ec 08             	sub    $0x8,%esp
+  8009b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009bb:	50                   	push   %eax
+  8009bc:	ff 36                	push   (%esi)
+  8009be:	e8 93 fd ff ff       	call   800756 <dev_lookup>
+  8009c3:	83 c4 10             	add    $0x10,%esp
+  8009c6:	85 c0                	test   %eax,%eax
+  8009c8:	78 24                	js     8009ee <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009ca:	8b 46 08             	mov    0x8(%esi),%eax
+  8009cd:	83 e0 03             	and    $0x3,%eax
+  8009d0:	83 f8 01             	cmp    $0x1,%eax
+  8009d3:	74 20                	je     8009f5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009d8:	8b 40 08             	mov    0x8(%eax),%eax
+  8009db:	85 c0                	test   %eax,%eax
+  8009dd:	74 61                	je     800a40 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009df:	83 ec 04             	sub    $0x4,%esp
+  8009e2:	ff 75 10             	push   0x10(%ebp)
+  8009e5:	ff 75 0c             	push   0xc(%ebp)
+  8009e8:	56                   	push   %esi
+  8009e9:	ff d0                	call   *%eax
+  8009eb:	83 c4 10             	add    $0x10,%esp
+}
+  8009ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009f1:	5b                   	pop    %ebx
+  8009f2:	5e                   	pop    %esi
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+  8009f5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009f7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009fd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800a02:	77 18                	ja     800a1c <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800a04:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800a09:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800a0b:	c1 e8 10             	shr    $0x10,%eax
+  800a0e:	74 0c                	je     800a1c <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a10:	c1 e0 10             	shl    $0x10,%eax
+  800a13:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a18:	29 c2                	sub    %eax,%edx
+  800a1a:	eb 06                	jmp    800a22 <read+0x8c>
+		return pthread_main_tls;
+  800a1c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a22:	8b 02                	mov    (%edx),%eax
+  800a24:	8b 40 48             	mov    0x48(%eax),%eax
+  800a27:	83 ec 04             	sub    $0x4,%esp
+  800a2a:	53                   	push   %ebx
+  800a2b:	50                   	push   %eax
+  800a2c:	68 59 47 80 00       	push   $0x804759
+  800a31:	e8 6c 28 00 00       	call   8032a2 <cprintf>
+		return -E_INVAL;
+  800a36:	83 c4 10             	add    $0x10,%esp
+  800a39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a3e:	eb ae                	jmp    8009ee <read+0x58>
+		return -E_NOT_SUPP;
+  800a40:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a45:	eb a7                	jmp    8009ee <read+0x58>
+
+00800a47 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	83 ec 0c             	sub    $0xc,%esp
+  800a50:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a53:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a5b:	eb 02                	jmp    800a5f <readn+0x18>
+  800a5d:	01 c3                	add    %eax,%ebx
+  800a5f:	39 f3                	cmp    %esi,%ebx
+  800a61:	73 21                	jae    800a84 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a63:	83 ec 04             	sub    $0x4,%esp
+  800a66:	89 f0                	mov    %esi,%eax
+  800a68:	29 d8                	sub    %ebx,%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	89 d8                	mov    %ebx,%eax
+  800a6d:	03 45 0c             	add    0xc(%ebp),%eax
+  800a70:	50                   	push   %eax
+  800a71:	57                   	push   %edi
+  800a72:	e8 1f ff ff ff       	call   800996 <read>
+		if (m < 0)
+  800a77:	83 c4 10             	add    $0x10,%esp
+  800a7a:	85 c0                	test   %eax,%eax
+  800a7c:	78 04                	js     800a82 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a7e:	75 dd                	jne    800a5d <readn+0x16>
+  800a80:	eb 02                	jmp    800a84 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a82:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a84:	89 d8                	mov    %ebx,%eax
+  800a86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a89:	5b                   	pop    %ebx
+  800a8a:	5e                   	pop    %esi
+  800a8b:	5f                   	pop    %edi
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+
+00800a8e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	83 ec 18             	sub    $0x18,%esp
+  800a96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a9c:	50                   	push   %eax
+  800a9d:	53                   	push   %ebx
+  800a9e:	e8 63 fc ff ff       	call   800706 <fd_lookup>
+  800aa3:	83 c4 10             	add    $0x10,%esp
+  800aa6:	85 c0                	test   %eax,%eax
+  800aa8:	78 37                	js     800ae1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aaa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aad:	83 ec 08             	sub    $0x8,%esp
+  800ab0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	ff 36                	push   (%esi)
+  800ab6:	e8 9b fc ff ff       	call   800756 <dev_lookup>
+  800abb:	83 c4 10             	add    $0x10,%esp
+  800abe:	85 c0                	test   %eax,%eax
+  800ac0:	78 1f                	js     800ae1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ac2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ac6:	74 20                	je     800ae8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800acb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ace:	85 c0                	test   %eax,%eax
+  800ad0:	74 61                	je     800b33 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ad2:	83 ec 04             	sub    $0x4,%esp
+  800ad5:	ff 75 10             	push   0x10(%ebp)
+  800ad8:	ff 75 0c             	push   0xc(%ebp)
+  800adb:	56                   	push   %esi
+  800adc:	ff d0                	call   *%eax
+  800ade:	83 c4 10             	add    $0x10,%esp
+}
+  800ae1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+  800ae8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800aea:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800af0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800af5:	77 18                	ja     800b0f <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800af7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800afc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800afe:	c1 e8 10             	shr    $0x10,%eax
+  800b01:	74 0c                	je     800b0f <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800b03:	c1 e0 10             	shl    $0x10,%eax
+  800b06:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800b0b:	29 c2                	sub    %eax,%edx
+  800b0d:	eb 06                	jmp    800b15 <write+0x87>
+		return pthread_main_tls;
+  800b0f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b15:	8b 02                	mov    (%edx),%eax
+  800b17:	8b 40 48             	mov    0x48(%eax),%eax
+  800b1a:	83 ec 04             	sub    $0x4,%esp
+  800b1d:	53                   	push   %ebx
+  800b1e:	50                   	push   %eax
+  800b1f:	68 75 47 80 00       	push   $0x804775
+  800b24:	e8 79 27 00 00       	call   8032a2 <cprintf>
+		return -E_INVAL;
+  800b29:	83 c4 10             	add    $0x10,%esp
+  800b2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b31:	eb ae                	jmp    800ae1 <write+0x53>
+		return -E_NOT_SUPP;
+  800b33:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b38:	eb a7                	jmp    800ae1 <write+0x53>
+
+00800b3a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b43:	50                   	push   %eax
+  800b44:	ff 75 08             	push   0x8(%ebp)
+  800b47:	e8 ba fb ff ff       	call   800706 <fd_lookup>
+  800b4c:	83 c4 10             	add    $0x10,%esp
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	78 0e                	js     800b61 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b59:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b61:	c9                   	leave
+  800b62:	c3                   	ret
+
+00800b63 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	56                   	push   %esi
+  800b67:	53                   	push   %ebx
+  800b68:	83 ec 18             	sub    $0x18,%esp
+  800b6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b6e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b71:	50                   	push   %eax
+  800b72:	53                   	push   %ebx
+  800b73:	e8 8e fb ff ff       	call   800706 <fd_lookup>
+  800b78:	83 c4 10             	add    $0x10,%esp
+  800b7b:	85 c0                	test   %eax,%eax
+  800b7d:	78 34                	js     800bb3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b7f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b82:	83 ec 08             	sub    $0x8,%esp
+  800b85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b88:	50                   	push   %eax
+  800b89:	ff 36                	push   (%esi)
+  800b8b:	e8 c6 fb ff ff       	call   800756 <dev_lookup>
+  800b90:	83 c4 10             	add    $0x10,%esp
+  800b93:	85 c0                	test   %eax,%eax
+  800b95:	78 1c                	js     800bb3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b97:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b9b:	74 1d                	je     800bba <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba0:	8b 40 18             	mov    0x18(%eax),%eax
+  800ba3:	85 c0                	test   %eax,%eax
+  800ba5:	74 5e                	je     800c05 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ba7:	83 ec 08             	sub    $0x8,%esp
+  800baa:	ff 75 0c             	push   0xc(%ebp)
+  800bad:	56                   	push   %esi
+  800bae:	ff d0                	call   *%eax
+  800bb0:	83 c4 10             	add    $0x10,%esp
+}
+  800bb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bb6:	5b                   	pop    %ebx
+  800bb7:	5e                   	pop    %esi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+  800bba:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bbc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bc2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bc7:	77 18                	ja     800be1 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bc9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bce:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bd0:	c1 e8 10             	shr    $0x10,%eax
+  800bd3:	74 0c                	je     800be1 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bd5:	c1 e0 10             	shl    $0x10,%eax
+  800bd8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bdd:	29 c2                	sub    %eax,%edx
+  800bdf:	eb 06                	jmp    800be7 <ftruncate+0x84>
+		return pthread_main_tls;
+  800be1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800be7:	8b 02                	mov    (%edx),%eax
+  800be9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bec:	83 ec 04             	sub    $0x4,%esp
+  800bef:	53                   	push   %ebx
+  800bf0:	50                   	push   %eax
+  800bf1:	68 38 47 80 00       	push   $0x804738
+  800bf6:	e8 a7 26 00 00       	call   8032a2 <cprintf>
+		return -E_INVAL;
+  800bfb:	83 c4 10             	add    $0x10,%esp
+  800bfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c03:	eb ae                	jmp    800bb3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c05:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c0a:	eb a7                	jmp    800bb3 <ftruncate+0x50>
+
+00800c0c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c0c:	55                   	push   %ebp
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	56                   	push   %esi
+  800c10:	53                   	push   %ebx
+  800c11:	83 ec 18             	sub    $0x18,%esp
+  800c14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c17:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c1a:	50                   	push   %eax
+  800c1b:	ff 75 08             	push   0x8(%ebp)
+  800c1e:	e8 e3 fa ff ff       	call   800706 <fd_lookup>
+  800c23:	83 c4 10             	add    $0x10,%esp
+  800c26:	85 c0                	test   %eax,%eax
+  800c28:	78 49                	js     800c73 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c2a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c2d:	83 ec 08             	sub    $0x8,%esp
+  800c30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c33:	50                   	push   %eax
+  800c34:	ff 36                	push   (%esi)
+  800c36:	e8 1b fb ff ff       	call   800756 <dev_lookup>
+  800c3b:	83 c4 10             	add    $0x10,%esp
+  800c3e:	85 c0                	test   %eax,%eax
+  800c40:	78 31                	js     800c73 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c45:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c49:	74 2f                	je     800c7a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c4b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c4e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c55:	00 00 00 
+	stat->st_isdir = 0;
+  800c58:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c5f:	00 00 00 
+	stat->st_dev = dev;
+  800c62:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c68:	83 ec 08             	sub    $0x8,%esp
+  800c6b:	53                   	push   %ebx
+  800c6c:	56                   	push   %esi
+  800c6d:	ff 50 14             	call   *0x14(%eax)
+  800c70:	83 c4 10             	add    $0x10,%esp
+}
+  800c73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c76:	5b                   	pop    %ebx
+  800c77:	5e                   	pop    %esi
+  800c78:	5d                   	pop    %ebp
+  800c79:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c7f:	eb f2                	jmp    800c73 <fstat+0x67>
+
+00800c81 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c86:	83 ec 08             	sub    $0x8,%esp
+  800c89:	6a 00                	push   $0x0
+  800c8b:	ff 75 08             	push   0x8(%ebp)
+  800c8e:	e8 4b 03 00 00       	call   800fde <open>
+  800c93:	89 c3                	mov    %eax,%ebx
+  800c95:	83 c4 10             	add    $0x10,%esp
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	78 1b                	js     800cb7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c9c:	83 ec 08             	sub    $0x8,%esp
+  800c9f:	ff 75 0c             	push   0xc(%ebp)
+  800ca2:	50                   	push   %eax
+  800ca3:	e8 64 ff ff ff       	call   800c0c <fstat>
+  800ca8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800caa:	89 1c 24             	mov    %ebx,(%esp)
+  800cad:	e8 a8 fb ff ff       	call   80085a <close>
+	return r;
+  800cb2:	83 c4 10             	add    $0x10,%esp
+  800cb5:	89 f3                	mov    %esi,%ebx
+}
+  800cb7:	89 d8                	mov    %ebx,%eax
+  800cb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cbc:	5b                   	pop    %ebx
+  800cbd:	5e                   	pop    %esi
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+
+00800cc0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	56                   	push   %esi
+  800cc4:	53                   	push   %ebx
+  800cc5:	89 c6                	mov    %eax,%esi
+  800cc7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cc9:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cd0:	74 27                	je     800cf9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd2:	6a 07                	push   $0x7
+  800cd4:	68 00 70 80 00       	push   $0x807000
+  800cd9:	56                   	push   %esi
+  800cda:	ff 35 00 60 80 00    	push   0x806000
+  800ce0:	e8 51 36 00 00       	call   804336 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800ce5:	83 c4 0c             	add    $0xc,%esp
+  800ce8:	6a 00                	push   $0x0
+  800cea:	53                   	push   %ebx
+  800ceb:	6a 00                	push   $0x0
+  800ced:	e8 4e 35 00 00       	call   804240 <ipc_recv>
+}
+  800cf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cf9:	83 ec 0c             	sub    $0xc,%esp
+  800cfc:	6a 01                	push   $0x1
+  800cfe:	e8 89 36 00 00       	call   80438c <ipc_find_env>
+  800d03:	a3 00 60 80 00       	mov    %eax,0x806000
+  800d08:	83 c4 10             	add    $0x10,%esp
+  800d0b:	eb c5                	jmp    800cd2 <fsipc+0x12>
+
+00800d0d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	53                   	push   %ebx
+  800d11:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d14:	68 04 60 80 00       	push   $0x806004
+  800d19:	e8 29 1b 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d21:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d24:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2c:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3b:	e8 80 ff ff ff       	call   800cc0 <fsipc>
+  800d40:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d42:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d49:	e8 66 1b 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+}
+  800d4e:	89 d8                	mov    %ebx,%eax
+  800d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d53:	c9                   	leave
+  800d54:	c3                   	ret
+
+00800d55 <devfile_flush>:
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	53                   	push   %ebx
+  800d59:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d5c:	68 04 60 80 00       	push   $0x806004
+  800d61:	e8 e1 1a 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d69:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d6c:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d76:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d7b:	e8 40 ff ff ff       	call   800cc0 <fsipc>
+  800d80:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d82:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d89:	e8 26 1b 00 00       	call   8028b4 <mutex_unlock>
+}
+  800d8e:	89 d8                	mov    %ebx,%eax
+  800d90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+00800d95 <devfile_stat>:
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+  800da0:	68 04 60 80 00       	push   $0x806004
+  800da5:	e8 9d 1a 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800daa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dad:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dba:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbf:	e8 fc fe ff ff       	call   800cc0 <fsipc>
+  800dc4:	89 c3                	mov    %eax,%ebx
+  800dc6:	83 c4 10             	add    $0x10,%esp
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	79 16                	jns    800de3 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dcd:	83 ec 0c             	sub    $0xc,%esp
+  800dd0:	68 04 60 80 00       	push   $0x806004
+  800dd5:	e8 da 1a 00 00       	call   8028b4 <mutex_unlock>
+}
+  800dda:	89 d8                	mov    %ebx,%eax
+  800ddc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800de3:	83 ec 08             	sub    $0x8,%esp
+  800de6:	68 00 70 80 00       	push   $0x807000
+  800deb:	56                   	push   %esi
+  800dec:	e8 95 2a 00 00       	call   803886 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800df1:	a1 80 70 80 00       	mov    0x807080,%eax
+  800df6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dfc:	a1 84 70 80 00       	mov    0x807084,%eax
+  800e01:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800e07:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	eb bc                	jmp    800dcd <devfile_stat+0x38>
+
+00800e11 <devfile_write>:
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 10             	sub    $0x10,%esp
+  800e18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e1b:	68 04 60 80 00       	push   $0x806004
+  800e20:	e8 22 1a 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e28:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e2b:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e30:	83 c4 10             	add    $0x10,%esp
+  800e33:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e39:	76 3d                	jbe    800e78 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e3b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e40:	39 c3                	cmp    %eax,%ebx
+  800e42:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e48:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e4d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e58:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5d:	e8 5e fe ff ff       	call   800cc0 <fsipc>
+  800e62:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+  800e67:	68 04 60 80 00       	push   $0x806004
+  800e6c:	e8 43 1a 00 00       	call   8028b4 <mutex_unlock>
+}
+  800e71:	89 d8                	mov    %ebx,%eax
+  800e73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e78:	83 ec 04             	sub    $0x4,%esp
+  800e7b:	53                   	push   %ebx
+  800e7c:	ff 75 0c             	push   0xc(%ebp)
+  800e7f:	68 0c 70 80 00       	push   $0x80700c
+  800e84:	e8 83 2b 00 00       	call   803a0c <memmove>
+  800e89:	83 c4 10             	add    $0x10,%esp
+  800e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e91:	eb b5                	jmp    800e48 <devfile_write+0x37>
+
+00800e93 <devfile_read>:
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e9f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ea2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800ea5:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800eab:	0f 86 8c 00 00 00    	jbe    800f3d <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800eb1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800eb6:	39 c3                	cmp    %eax,%ebx
+  800eb8:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ebb:	89 f8                	mov    %edi,%eax
+  800ebd:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800ec0:	eb 0f                	jmp    800ed1 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800ec2:	0f b6 08             	movzbl (%eax),%ecx
+  800ec5:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ec7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ecc:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ed1:	39 d0                	cmp    %edx,%eax
+  800ed3:	72 ed                	jb     800ec2 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	68 04 60 80 00       	push   $0x806004
+  800edd:	e8 65 19 00 00       	call   802847 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ee2:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ee5:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800eea:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800ef0:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f00:	e8 bb fd ff ff       	call   800cc0 <fsipc>
+  800f05:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800f07:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f0e:	e8 a1 19 00 00       	call   8028b4 <mutex_unlock>
+		assert(r <= (int) n);
+  800f13:	83 c4 10             	add    $0x10,%esp
+  800f16:	39 f3                	cmp    %esi,%ebx
+  800f18:	7c 0a                	jl     800f24 <devfile_read+0x91>
+}
+  800f1a:	89 f0                	mov    %esi,%eax
+  800f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+		assert(r <= (int) n);
+  800f24:	68 a8 47 80 00       	push   $0x8047a8
+  800f29:	68 b5 47 80 00       	push   $0x8047b5
+  800f2e:	68 90 00 00 00       	push   $0x90
+  800f33:	68 ca 47 80 00       	push   $0x8047ca
+  800f38:	e8 8a 22 00 00       	call   8031c7 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	68 04 60 80 00       	push   $0x806004
+  800f45:	e8 fd 18 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f4a:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f4d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f52:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f58:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f5f:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f67:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f6c:	e8 4f fd ff ff       	call   800cc0 <fsipc>
+  800f71:	89 c6                	mov    %eax,%esi
+  800f73:	83 c4 10             	add    $0x10,%esp
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	78 1d                	js     800f97 <devfile_read+0x104>
+		assert(r <= n);
+  800f7a:	39 c3                	cmp    %eax,%ebx
+  800f7c:	72 2e                	jb     800fac <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f7e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f83:	7f 40                	jg     800fc5 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f85:	83 ec 04             	sub    $0x4,%esp
+  800f88:	50                   	push   %eax
+  800f89:	68 00 70 80 00       	push   $0x807000
+  800f8e:	57                   	push   %edi
+  800f8f:	e8 78 2a 00 00       	call   803a0c <memmove>
+  800f94:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	68 04 60 80 00       	push   $0x806004
+  800f9f:	e8 10 19 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+  800fa4:	83 c4 10             	add    $0x10,%esp
+  800fa7:	e9 6e ff ff ff       	jmp    800f1a <devfile_read+0x87>
+		assert(r <= n);
+  800fac:	68 d5 47 80 00       	push   $0x8047d5
+  800fb1:	68 b5 47 80 00       	push   $0x8047b5
+  800fb6:	68 99 00 00 00       	push   $0x99
+  800fbb:	68 ca 47 80 00       	push   $0x8047ca
+  800fc0:	e8 02 22 00 00       	call   8031c7 <_panic>
+		assert(r <= PGSIZE);
+  800fc5:	68 dc 47 80 00       	push   $0x8047dc
+  800fca:	68 b5 47 80 00       	push   $0x8047b5
+  800fcf:	68 9a 00 00 00       	push   $0x9a
+  800fd4:	68 ca 47 80 00       	push   $0x8047ca
+  800fd9:	e8 e9 21 00 00       	call   8031c7 <_panic>
+
+00800fde <open>:
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  800fe3:	83 ec 1c             	sub    $0x1c,%esp
+  800fe6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fe9:	56                   	push   %esi
+  800fea:	e8 5c 28 00 00       	call   80384b <strlen>
+  800fef:	83 c4 10             	add    $0x10,%esp
+  800ff2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ff7:	0f 8f 85 00 00 00    	jg     801082 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801003:	50                   	push   %eax
+  801004:	e8 a7 f6 ff ff       	call   8006b0 <fd_alloc>
+  801009:	89 c3                	mov    %eax,%ebx
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	78 55                	js     801067 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801012:	83 ec 0c             	sub    $0xc,%esp
+  801015:	68 04 60 80 00       	push   $0x806004
+  80101a:	e8 28 18 00 00       	call   802847 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80101f:	83 c4 08             	add    $0x8,%esp
+  801022:	56                   	push   %esi
+  801023:	68 00 70 80 00       	push   $0x807000
+  801028:	e8 59 28 00 00       	call   803886 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80102d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801030:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801035:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801038:	b8 01 00 00 00       	mov    $0x1,%eax
+  80103d:	e8 7e fc ff ff       	call   800cc0 <fsipc>
+  801042:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801044:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80104b:	e8 64 18 00 00       	call   8028b4 <mutex_unlock>
+	if (r < 0) {
+  801050:	83 c4 10             	add    $0x10,%esp
+  801053:	85 db                	test   %ebx,%ebx
+  801055:	78 19                	js     801070 <open+0x92>
+	return fd2num(fd);
+  801057:	83 ec 0c             	sub    $0xc,%esp
+  80105a:	ff 75 f4             	push   -0xc(%ebp)
+  80105d:	e8 27 f6 ff ff       	call   800689 <fd2num>
+  801062:	89 c3                	mov    %eax,%ebx
+  801064:	83 c4 10             	add    $0x10,%esp
+}
+  801067:	89 d8                	mov    %ebx,%eax
+  801069:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+		fd_close(fd, 0);
+  801070:	83 ec 08             	sub    $0x8,%esp
+  801073:	6a 00                	push   $0x0
+  801075:	ff 75 f4             	push   -0xc(%ebp)
+  801078:	e8 56 f7 ff ff       	call   8007d3 <fd_close>
+		return r;
+  80107d:	83 c4 10             	add    $0x10,%esp
+  801080:	eb e5                	jmp    801067 <open+0x89>
+		return -E_BAD_PATH;
+  801082:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801087:	eb de                	jmp    801067 <open+0x89>
+
+00801089 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	53                   	push   %ebx
+  80108d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801090:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801093:	50                   	push   %eax
+  801094:	ff 75 08             	push   0x8(%ebp)
+  801097:	e8 6a f6 ff ff       	call   800706 <fd_lookup>
+  80109c:	89 c3                	mov    %eax,%ebx
+  80109e:	83 c4 10             	add    $0x10,%esp
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	78 5b                	js     801100 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8010a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a8:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8010ae:	39 08                	cmp    %ecx,(%eax)
+  8010b0:	75 55                	jne    801107 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010b2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010b6:	74 56                	je     80110e <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010b8:	83 ec 0c             	sub    $0xc,%esp
+  8010bb:	68 04 60 80 00       	push   $0x806004
+  8010c0:	e8 82 17 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010cb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d3:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010d8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010db:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ea:	e8 d1 fb ff ff       	call   800cc0 <fsipc>
+  8010ef:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010f1:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010f8:	e8 b7 17 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+  8010fd:	83 c4 10             	add    $0x10,%esp
+}
+  801100:	89 d8                	mov    %ebx,%eax
+  801102:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+		return -E_NOT_SUPP;
+  801107:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80110c:	eb f2                	jmp    801100 <fallocate+0x77>
+		return -E_INVAL;
+  80110e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801113:	eb eb                	jmp    801100 <fallocate+0x77>
+
+00801115 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+  80111a:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80111d:	89 f3                	mov    %esi,%ebx
+  80111f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801125:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801128:	eb 06                	jmp    801130 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80112a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801130:	39 f3                	cmp    %esi,%ebx
+  801132:	73 14                	jae    801148 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801134:	83 ec 08             	sub    $0x8,%esp
+  801137:	53                   	push   %ebx
+  801138:	6a 00                	push   $0x0
+  80113a:	e8 41 f1 ff ff       	call   800280 <sys_page_unmap>
+  80113f:	83 c4 10             	add    $0x10,%esp
+  801142:	85 c0                	test   %eax,%eax
+  801144:	79 e4                	jns    80112a <munmap+0x15>
+  801146:	eb 05                	jmp    80114d <munmap+0x38>
+			return r;
+	return 0;
+  801148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801150:	5b                   	pop    %ebx
+  801151:	5e                   	pop    %esi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+
+00801154 <mmap>:
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	57                   	push   %edi
+  801158:	56                   	push   %esi
+  801159:	53                   	push   %ebx
+  80115a:	83 ec 24             	sub    $0x24,%esp
+  80115d:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801160:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801163:	50                   	push   %eax
+  801164:	ff 75 08             	push   0x8(%ebp)
+  801167:	e8 9a f5 ff ff       	call   800706 <fd_lookup>
+  80116c:	83 c4 10             	add    $0x10,%esp
+  80116f:	85 c0                	test   %eax,%eax
+  801171:	0f 88 37 01 00 00    	js     8012ae <mmap+0x15a>
+		return NULL;
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80117c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80117f:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801185:	39 0a                	cmp    %ecx,(%edx)
+  801187:	0f 85 05 01 00 00    	jne    801292 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80118d:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801194:	0f 85 1b 01 00 00    	jne    8012b5 <mmap+0x161>
+  80119a:	89 f0                	mov    %esi,%eax
+  80119c:	83 e8 01             	sub    $0x1,%eax
+  80119f:	0f 88 17 01 00 00    	js     8012bc <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8011a5:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8011a9:	75 28                	jne    8011d3 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8011ab:	83 ec 0c             	sub    $0xc,%esp
+  8011ae:	68 04 60 80 00       	push   $0x806004
+  8011b3:	e8 8f 16 00 00       	call   802847 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011b8:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011be:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011c4:	83 c4 10             	add    $0x10,%esp
+  8011c7:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011cc:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011d1:	eb 2b                	jmp    8011fe <mmap+0xaa>
+		cow_enable();
+  8011d3:	e8 f7 2b 00 00       	call   803dcf <cow_enable>
+  8011d8:	eb d1                	jmp    8011ab <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011da:	89 c2                	mov    %eax,%edx
+  8011dc:	c1 ea 0c             	shr    $0xc,%edx
+  8011df:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011e6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011ec:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011f2:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011f5:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011f7:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011fc:	77 25                	ja     801223 <mmap+0xcf>
+  8011fe:	89 c2                	mov    %eax,%edx
+  801200:	29 da                	sub    %ebx,%edx
+  801202:	39 ca                	cmp    %ecx,%edx
+  801204:	73 3a                	jae    801240 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801206:	89 c2                	mov    %eax,%edx
+  801208:	c1 ea 16             	shr    $0x16,%edx
+  80120b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801212:	f6 c2 01             	test   $0x1,%dl
+  801215:	75 c3                	jne    8011da <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801217:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80121c:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801221:	eb d4                	jmp    8011f7 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801223:	29 d8                	sub    %ebx,%eax
+  801225:	39 c8                	cmp    %ecx,%eax
+  801227:	73 17                	jae    801240 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801229:	83 ec 0c             	sub    $0xc,%esp
+  80122c:	68 04 60 80 00       	push   $0x806004
+  801231:	e8 7e 16 00 00       	call   8028b4 <mutex_unlock>
+		return NULL;
+  801236:	83 c4 10             	add    $0x10,%esp
+  801239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123e:	eb 52                	jmp    801292 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801240:	85 db                	test   %ebx,%ebx
+  801242:	74 e5                	je     801229 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801244:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801247:	8b 40 0c             	mov    0xc(%eax),%eax
+  80124a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80124f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801252:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801257:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  80125d:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801263:	8b 45 14             	mov    0x14(%ebp),%eax
+  801266:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80126b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801270:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801275:	e8 46 fa ff ff       	call   800cc0 <fsipc>
+  80127a:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+  80127f:	68 04 60 80 00       	push   $0x806004
+  801284:	e8 2b 16 00 00       	call   8028b4 <mutex_unlock>
+	if (r < 0) {
+  801289:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80128c:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80128e:	85 ff                	test   %edi,%edi
+  801290:	78 08                	js     80129a <mmap+0x146>
+}
+  801292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+		munmap((void*) va, len);
+  80129a:	83 ec 08             	sub    $0x8,%esp
+  80129d:	56                   	push   %esi
+  80129e:	53                   	push   %ebx
+  80129f:	e8 71 fe ff ff       	call   801115 <munmap>
+		return NULL;
+  8012a4:	83 c4 10             	add    $0x10,%esp
+  8012a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ac:	eb e4                	jmp    801292 <mmap+0x13e>
+		return NULL;
+  8012ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b3:	eb dd                	jmp    801292 <mmap+0x13e>
+		return NULL;
+  8012b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ba:	eb d6                	jmp    801292 <mmap+0x13e>
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c1:	eb cf                	jmp    801292 <mmap+0x13e>
+
+008012c3 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 10             	sub    $0x10,%esp
+  8012ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012cd:	53                   	push   %ebx
+  8012ce:	e8 78 25 00 00       	call   80384b <strlen>
+  8012d3:	83 c4 10             	add    $0x10,%esp
+  8012d6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012db:	7f 42                	jg     80131f <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012dd:	83 ec 0c             	sub    $0xc,%esp
+  8012e0:	68 04 60 80 00       	push   $0x806004
+  8012e5:	e8 5d 15 00 00       	call   802847 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012ea:	83 c4 08             	add    $0x8,%esp
+  8012ed:	53                   	push   %ebx
+  8012ee:	68 00 70 80 00       	push   $0x807000
+  8012f3:	e8 8e 25 00 00       	call   803886 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fd:	b8 07 00 00 00       	mov    $0x7,%eax
+  801302:	e8 b9 f9 ff ff       	call   800cc0 <fsipc>
+  801307:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801309:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801310:	e8 9f 15 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+  801315:	83 c4 10             	add    $0x10,%esp
+}
+  801318:	89 d8                	mov    %ebx,%eax
+  80131a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131d:	c9                   	leave
+  80131e:	c3                   	ret
+		return -E_BAD_PATH;
+  80131f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801324:	eb f2                	jmp    801318 <remove+0x55>
+
+00801326 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	53                   	push   %ebx
+  80132a:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80132d:	68 04 60 80 00       	push   $0x806004
+  801332:	e8 10 15 00 00       	call   802847 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801341:	e8 7a f9 ff ff       	call   800cc0 <fsipc>
+  801346:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801348:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80134f:	e8 60 15 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+}
+  801354:	89 d8                	mov    %ebx,%eax
+  801356:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+
+0080135b <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	56                   	push   %esi
+  80135f:	53                   	push   %ebx
+  801360:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801363:	83 ec 0c             	sub    $0xc,%esp
+  801366:	68 04 60 80 00       	push   $0x806004
+  80136b:	e8 d7 14 00 00       	call   802847 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801370:	8b 45 08             	mov    0x8(%ebp),%eax
+  801373:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801382:	e8 39 f9 ff ff       	call   800cc0 <fsipc>
+  801387:	89 c6                	mov    %eax,%esi
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 db                	test   %ebx,%ebx
+  80138e:	74 7b                	je     80140b <fs_bcstat+0xb0>
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 77                	js     80140b <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801394:	a1 00 70 80 00       	mov    0x807000,%eax
+  801399:	89 03                	mov    %eax,(%ebx)
+  80139b:	a1 04 70 80 00       	mov    0x807004,%eax
+  8013a0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8013a3:	a1 08 70 80 00       	mov    0x807008,%eax
+  8013a8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8013ab:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013b0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013b3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013bb:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013c0:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013c3:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013c8:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013cb:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013d0:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013d3:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013d8:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013db:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013e0:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013e3:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013e8:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013eb:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013f0:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013f3:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013f8:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013fb:	a1 34 70 80 00       	mov    0x807034,%eax
+  801400:	89 43 34             	mov    %eax,0x34(%ebx)
+  801403:	a1 38 70 80 00       	mov    0x807038,%eax
+  801408:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	68 04 60 80 00       	push   $0x806004
+  801413:	e8 9c 14 00 00       	call   8028b4 <mutex_unlock>
+	return r;
+}
+  801418:	89 f0                	mov    %esi,%eax
+  80141a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5d                   	pop    %ebp
+  801420:	c3                   	ret
+
+00801421 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801428:	0f b6 10             	movzbl (%eax),%edx
+  80142b:	80 fa 72             	cmp    $0x72,%dl
+  80142e:	74 44                	je     801474 <parse_mode+0x53>
+  801430:	80 fa 77             	cmp    $0x77,%dl
+  801433:	74 4b                	je     801480 <parse_mode+0x5f>
+  801435:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80143a:	80 fa 61             	cmp    $0x61,%dl
+  80143d:	74 09                	je     801448 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80143f:	89 d8                	mov    %ebx,%eax
+  801441:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801444:	5b                   	pop    %ebx
+  801445:	5e                   	pop    %esi
+  801446:	5d                   	pop    %ebp
+  801447:	c3                   	ret
+	switch (mode[0]) {
+  801448:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80144d:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801452:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801454:	83 ec 08             	sub    $0x8,%esp
+  801457:	6a 2b                	push   $0x2b
+  801459:	50                   	push   %eax
+  80145a:	e8 39 25 00 00       	call   803998 <strchr>
+  80145f:	83 c4 10             	add    $0x10,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	74 d9                	je     80143f <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801466:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801469:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80146c:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801472:	eb cb                	jmp    80143f <parse_mode+0x1e>
+	switch (mode[0]) {
+  801474:	ba 01 00 00 00       	mov    $0x1,%edx
+  801479:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147e:	eb d2                	jmp    801452 <parse_mode+0x31>
+  801480:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801485:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80148a:	eb c6                	jmp    801452 <parse_mode+0x31>
+
+0080148c <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	83 ec 1c             	sub    $0x1c,%esp
+  801495:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801498:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80149b:	b8 24 50 80 00       	mov    $0x805024,%eax
+  8014a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8014a5:	83 c0 24             	add    $0x24,%eax
+  8014a8:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014ac:	74 17                	je     8014c5 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014ae:	83 c3 01             	add    $0x1,%ebx
+  8014b1:	83 fb 10             	cmp    $0x10,%ebx
+  8014b4:	75 ef                	jne    8014a5 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014b6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014bb:	89 f0                	mov    %esi,%eax
+  8014bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014c5:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014cc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014cf:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014d2:	c1 e7 02             	shl    $0x2,%edi
+  8014d5:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014db:	83 ec 04             	sub    $0x4,%esp
+  8014de:	6a 24                	push   $0x24
+  8014e0:	6a 00                	push   $0x0
+  8014e2:	56                   	push   %esi
+  8014e3:	e8 ef 24 00 00       	call   8039d7 <memset>
+			streams[i].f_fd = fd;
+  8014e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014eb:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014f1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014f4:	01 d8                	add    %ebx,%eax
+  8014f6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014f9:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	eb b6                	jmp    8014bb <stream_alloc+0x2f>
+
+00801505 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	53                   	push   %ebx
+  801509:	83 ec 14             	sub    $0x14,%esp
+  80150c:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80150e:	8b 40 18             	mov    0x18(%eax),%eax
+  801511:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801514:	74 4a                	je     801560 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151c:	50                   	push   %eax
+  80151d:	ff 33                	push   (%ebx)
+  80151f:	e8 e2 f1 ff ff       	call   800706 <fd_lookup>
+  801524:	89 c2                	mov    %eax,%edx
+  801526:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80152e:	85 d2                	test   %edx,%edx
+  801530:	78 41                	js     801573 <stream_unread+0x6e>
+  801532:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801535:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80153b:	39 0a                	cmp    %ecx,(%edx)
+  80153d:	75 34                	jne    801573 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80153f:	8b 43 14             	mov    0x14(%ebx),%eax
+  801542:	03 42 04             	add    0x4(%edx),%eax
+  801545:	2b 43 18             	sub    0x18(%ebx),%eax
+  801548:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80154b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801552:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801559:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155e:	eb 13                	jmp    801573 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801560:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801567:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80156e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801573:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801576:	c9                   	leave
+  801577:	c3                   	ret
+
+00801578 <stream_drain>:
+{
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	56                   	push   %esi
+  80157c:	53                   	push   %ebx
+  80157d:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80157f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801584:	eb 02                	jmp    801588 <stream_drain+0x10>
+  801586:	01 c3                	add    %eax,%ebx
+  801588:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80158b:	39 c3                	cmp    %eax,%ebx
+  80158d:	73 43                	jae    8015d2 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80158f:	83 ec 04             	sub    $0x4,%esp
+  801592:	29 d8                	sub    %ebx,%eax
+  801594:	50                   	push   %eax
+  801595:	89 d8                	mov    %ebx,%eax
+  801597:	03 46 0c             	add    0xc(%esi),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 36                	push   (%esi)
+  80159d:	e8 ec f4 ff ff       	call   800a8e <write>
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	85 c0                	test   %eax,%eax
+  8015a7:	7f dd                	jg     801586 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8015a9:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015ad:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015b0:	83 ec 04             	sub    $0x4,%esp
+  8015b3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015b6:	29 d8                	sub    %ebx,%eax
+  8015b8:	50                   	push   %eax
+  8015b9:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015bc:	50                   	push   %eax
+  8015bd:	52                   	push   %edx
+  8015be:	e8 49 24 00 00       	call   803a0c <memmove>
+			f->f_wend -= done;
+  8015c3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015c6:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015d0:	eb 0a                	jmp    8015dc <stream_drain+0x64>
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015d7:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015dc:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015df:	89 d0                	mov    %edx,%eax
+  8015e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e4:	5b                   	pop    %ebx
+  8015e5:	5e                   	pop    %esi
+  8015e6:	5d                   	pop    %ebp
+  8015e7:	c3                   	ret
+
+008015e8 <stream_setup>:
+	if (f->f_buf)
+  8015e8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015ec:	74 01                	je     8015ef <stream_setup+0x7>
+  8015ee:	c3                   	ret
+{
+  8015ef:	55                   	push   %ebp
+  8015f0:	89 e5                	mov    %esp,%ebp
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  8015f6:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015f8:	8b 40 08             	mov    0x8(%eax),%eax
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	74 17                	je     801616 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015ff:	83 f8 03             	cmp    $0x3,%eax
+  801602:	75 2d                	jne    801631 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801604:	8d 43 20             	lea    0x20(%ebx),%eax
+  801607:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80160a:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801616:	83 ec 0c             	sub    $0xc,%esp
+  801619:	ff 33                	push   (%ebx)
+  80161b:	e8 29 1b 00 00       	call   803149 <iscons>
+  801620:	83 c4 10             	add    $0x10,%esp
+  801623:	85 c0                	test   %eax,%eax
+  801625:	0f 9f c0             	setg   %al
+  801628:	0f b6 c0             	movzbl %al,%eax
+  80162b:	83 c0 01             	add    $0x1,%eax
+  80162e:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801631:	83 ec 0c             	sub    $0xc,%esp
+  801634:	68 00 10 00 00       	push   $0x1000
+  801639:	e8 6e 0b 00 00       	call   8021ac <malloc>
+  80163e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	74 bc                	je     801604 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801648:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80164f:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801653:	eb bc                	jmp    801611 <stream_setup+0x29>
+
+00801655 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	53                   	push   %ebx
+  801659:	83 ec 04             	sub    $0x4,%esp
+  80165c:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80165e:	e8 85 ff ff ff       	call   8015e8 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801663:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801668:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80166c:	74 3d                	je     8016ab <stream_fill+0x56>
+  80166e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801672:	74 10                	je     801684 <stream_fill+0x2f>
+  801674:	89 d8                	mov    %ebx,%eax
+  801676:	e8 fd fe ff ff       	call   801578 <stream_drain>
+		return 0;
+  80167b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801680:	85 c0                	test   %eax,%eax
+  801682:	78 27                	js     8016ab <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801684:	83 ec 04             	sub    $0x4,%esp
+  801687:	ff 73 10             	push   0x10(%ebx)
+  80168a:	ff 73 0c             	push   0xc(%ebx)
+  80168d:	ff 33                	push   (%ebx)
+  80168f:	e8 02 f3 ff ff       	call   800996 <read>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	7e 17                	jle    8016b2 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80169b:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80169f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8016a6:	89 c2                	mov    %eax,%edx
+  8016a8:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8016ab:	89 d0                	mov    %edx,%eax
+  8016ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016b0:	c9                   	leave
+  8016b1:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016b2:	c1 f8 1f             	sar    $0x1f,%eax
+  8016b5:	83 e0 04             	and    $0x4,%eax
+  8016b8:	83 c0 04             	add    $0x4,%eax
+  8016bb:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c3:	eb e6                	jmp    8016ab <stream_fill+0x56>
+
+008016c5 <fopen>:
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	57                   	push   %edi
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d4:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016da:	89 f0                	mov    %esi,%eax
+  8016dc:	e8 40 fd ff ff       	call   801421 <parse_mode>
+		return 0;
+  8016e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 2d                	js     801717 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016ea:	83 ec 08             	sub    $0x8,%esp
+  8016ed:	50                   	push   %eax
+  8016ee:	ff 75 08             	push   0x8(%ebp)
+  8016f1:	e8 e8 f8 ff ff       	call   800fde <open>
+  8016f6:	89 c7                	mov    %eax,%edi
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	78 58                	js     801757 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016ff:	80 3e 61             	cmpb   $0x61,(%esi)
+  801702:	74 1d                	je     801721 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  801704:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80170a:	89 f8                	mov    %edi,%eax
+  80170c:	e8 7b fd ff ff       	call   80148c <stream_alloc>
+  801711:	89 c3                	mov    %eax,%ebx
+  801713:	85 c0                	test   %eax,%eax
+  801715:	74 32                	je     801749 <fopen+0x84>
+}
+  801717:	89 d8                	mov    %ebx,%eax
+  801719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171c:	5b                   	pop    %ebx
+  80171d:	5e                   	pop    %esi
+  80171e:	5f                   	pop    %edi
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801721:	83 ec 08             	sub    $0x8,%esp
+  801724:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80172a:	50                   	push   %eax
+  80172b:	57                   	push   %edi
+  80172c:	e8 db f4 ff ff       	call   800c0c <fstat>
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 cc                	js     801704 <fopen+0x3f>
+		seek(fd, st.st_size);
+  801738:	83 ec 08             	sub    $0x8,%esp
+  80173b:	ff 75 dc             	push   -0x24(%ebp)
+  80173e:	57                   	push   %edi
+  80173f:	e8 f6 f3 ff ff       	call   800b3a <seek>
+  801744:	83 c4 10             	add    $0x10,%esp
+  801747:	eb bb                	jmp    801704 <fopen+0x3f>
+		close(fd);
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	57                   	push   %edi
+  80174d:	e8 08 f1 ff ff       	call   80085a <close>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	eb c0                	jmp    801717 <fopen+0x52>
+		return 0;
+  801757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175c:	eb b9                	jmp    801717 <fopen+0x52>
+
+0080175e <fdopen>:
+{
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801764:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801767:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176a:	e8 b2 fc ff ff       	call   801421 <parse_mode>
+  80176f:	89 c2                	mov    %eax,%edx
+		return 0;
+  801771:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801776:	85 d2                	test   %edx,%edx
+  801778:	78 0b                	js     801785 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80177a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80177d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801780:	e8 07 fd ff ff       	call   80148c <stream_alloc>
+}
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+
+00801787 <setvbuf>:
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	57                   	push   %edi
+  80178b:	56                   	push   %esi
+  80178c:	53                   	push   %ebx
+  80178d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801790:	8b 55 10             	mov    0x10(%ebp),%edx
+  801793:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801796:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80179a:	75 3a                	jne    8017d6 <setvbuf+0x4f>
+  80179c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80179f:	83 fe 02             	cmp    $0x2,%esi
+  8017a2:	77 39                	ja     8017dd <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8017a4:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8017a7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8017ab:	0f 95 c3             	setne  %bl
+  8017ae:	85 ff                	test   %edi,%edi
+  8017b0:	0f 95 c1             	setne  %cl
+  8017b3:	84 cb                	test   %cl,%bl
+  8017b5:	74 05                	je     8017bc <setvbuf+0x35>
+  8017b7:	83 fa 03             	cmp    $0x3,%edx
+  8017ba:	75 0a                	jne    8017c6 <setvbuf+0x3f>
+	return 0;
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5f                   	pop    %edi
+  8017c4:	5d                   	pop    %ebp
+  8017c5:	c3                   	ret
+		f->f_buf = buf;
+  8017c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c9:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017cc:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d4:	eb eb                	jmp    8017c1 <setvbuf+0x3a>
+		return EOF;
+  8017d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017db:	eb e4                	jmp    8017c1 <setvbuf+0x3a>
+  8017dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017e2:	eb dd                	jmp    8017c1 <setvbuf+0x3a>
+
+008017e4 <fflush>:
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	57                   	push   %edi
+  8017e8:	56                   	push   %esi
+  8017e9:	53                   	push   %ebx
+  8017ea:	83 ec 0c             	sub    $0xc,%esp
+  8017ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017f0:	85 db                	test   %ebx,%ebx
+  8017f2:	74 1a                	je     80180e <fflush+0x2a>
+	stream_unread(f);
+  8017f4:	89 d8                	mov    %ebx,%eax
+  8017f6:	e8 0a fd ff ff       	call   801505 <stream_unread>
+	return stream_drain(f);
+  8017fb:	89 d8                	mov    %ebx,%eax
+  8017fd:	e8 76 fd ff ff       	call   801578 <stream_drain>
+  801802:	89 c7                	mov    %eax,%edi
+}
+  801804:	89 f8                	mov    %edi,%eax
+  801806:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801809:	5b                   	pop    %ebx
+  80180a:	5e                   	pop    %esi
+  80180b:	5f                   	pop    %edi
+  80180c:	5d                   	pop    %ebp
+  80180d:	c3                   	ret
+  80180e:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801813:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801818:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181d:	eb 03                	jmp    801822 <fflush+0x3e>
+  80181f:	83 c3 24             	add    $0x24,%ebx
+  801822:	39 f3                	cmp    %esi,%ebx
+  801824:	74 de                	je     801804 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801826:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80182a:	74 f3                	je     80181f <fflush+0x3b>
+  80182c:	83 ec 0c             	sub    $0xc,%esp
+  80182f:	53                   	push   %ebx
+  801830:	e8 af ff ff ff       	call   8017e4 <fflush>
+  801835:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80183f:	0f 48 f8             	cmovs  %eax,%edi
+  801842:	eb db                	jmp    80181f <fflush+0x3b>
+
+00801844 <fclose>:
+{
+  801844:	55                   	push   %ebp
+  801845:	89 e5                	mov    %esp,%ebp
+  801847:	56                   	push   %esi
+  801848:	53                   	push   %ebx
+  801849:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80184c:	83 ec 0c             	sub    $0xc,%esp
+  80184f:	56                   	push   %esi
+  801850:	e8 8f ff ff ff       	call   8017e4 <fflush>
+  801855:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801857:	83 c4 04             	add    $0x4,%esp
+  80185a:	ff 36                	push   (%esi)
+  80185c:	e8 f9 ef ff ff       	call   80085a <close>
+  801861:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801864:	85 c0                	test   %eax,%eax
+  801866:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80186b:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80186e:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  801872:	75 10                	jne    801884 <fclose+0x40>
+	f->f_flags = 0;
+  801874:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80187b:	89 d8                	mov    %ebx,%eax
+  80187d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801880:	5b                   	pop    %ebx
+  801881:	5e                   	pop    %esi
+  801882:	5d                   	pop    %ebp
+  801883:	c3                   	ret
+		free(f->f_buf);
+  801884:	83 ec 0c             	sub    $0xc,%esp
+  801887:	ff 76 0c             	push   0xc(%esi)
+  80188a:	e8 54 08 00 00       	call   8020e3 <free>
+  80188f:	83 c4 10             	add    $0x10,%esp
+  801892:	eb e0                	jmp    801874 <fclose+0x30>
+
+00801894 <fileno>:
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189a:	8b 00                	mov    (%eax),%eax
+}
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+
+0080189e <feof>:
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8018a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a4:	8b 40 04             	mov    0x4(%eax),%eax
+  8018a7:	c1 e8 02             	shr    $0x2,%eax
+  8018aa:	83 e0 01             	and    $0x1,%eax
+}
+  8018ad:	5d                   	pop    %ebp
+  8018ae:	c3                   	ret
+
+008018af <ferror>:
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b5:	8b 40 04             	mov    0x4(%eax),%eax
+  8018b8:	c1 e8 03             	shr    $0x3,%eax
+  8018bb:	83 e0 01             	and    $0x1,%eax
+}
+  8018be:	5d                   	pop    %ebp
+  8018bf:	c3                   	ret
+
+008018c0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 04             	sub    $0x4,%esp
+  8018c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018ca:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018cd:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018d0:	74 15                	je     8018e7 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018d2:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018d5:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018d8:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018db:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018de:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e5:	c9                   	leave
+  8018e6:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018e7:	89 d8                	mov    %ebx,%eax
+  8018e9:	e8 67 fd ff ff       	call   801655 <stream_fill>
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	75 e0                	jne    8018d2 <fgetc+0x12>
+		return EOF;
+  8018f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018f7:	eb e9                	jmp    8018e2 <fgetc+0x22>
+
+008018f9 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018f9:	55                   	push   %ebp
+  8018fa:	89 e5                	mov    %esp,%ebp
+  8018fc:	57                   	push   %edi
+  8018fd:	56                   	push   %esi
+  8018fe:	53                   	push   %ebx
+  8018ff:	83 ec 1c             	sub    $0x1c,%esp
+  801902:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801905:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80190a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190d:	83 e8 01             	sub    $0x1,%eax
+  801910:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801913:	eb 66                	jmp    80197b <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801915:	8b 46 14             	mov    0x14(%esi),%eax
+  801918:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80191b:	29 c3                	sub    %eax,%ebx
+  80191d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801920:	29 fa                	sub    %edi,%edx
+  801922:	39 d3                	cmp    %edx,%ebx
+  801924:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801927:	83 ec 04             	sub    $0x4,%esp
+  80192a:	53                   	push   %ebx
+  80192b:	6a 0a                	push   $0xa
+  80192d:	03 46 0c             	add    0xc(%esi),%eax
+  801930:	50                   	push   %eax
+  801931:	e8 87 21 00 00       	call   803abd <memfind>
+  801936:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801939:	8b 46 0c             	mov    0xc(%esi),%eax
+  80193c:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80193f:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801942:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80194a:	74 0b                	je     801957 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80194c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80194f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801952:	29 d3                	sub    %edx,%ebx
+  801954:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801957:	83 ec 04             	sub    $0x4,%esp
+  80195a:	53                   	push   %ebx
+  80195b:	01 c8                	add    %ecx,%eax
+  80195d:	50                   	push   %eax
+  80195e:	89 f8                	mov    %edi,%eax
+  801960:	03 45 08             	add    0x8(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	e8 a3 20 00 00       	call   803a0c <memmove>
+		f->f_rpos += m;
+  801969:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80196c:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80196e:	83 c4 10             	add    $0x10,%esp
+  801971:	8b 45 08             	mov    0x8(%ebp),%eax
+  801974:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801979:	74 1f                	je     80199a <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80197b:	8d 47 01             	lea    0x1(%edi),%eax
+  80197e:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801981:	73 17                	jae    80199a <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801983:	8b 46 18             	mov    0x18(%esi),%eax
+  801986:	39 46 14             	cmp    %eax,0x14(%esi)
+  801989:	75 8a                	jne    801915 <fgets+0x1c>
+  80198b:	89 f0                	mov    %esi,%eax
+  80198d:	e8 c3 fc ff ff       	call   801655 <stream_fill>
+  801992:	85 c0                	test   %eax,%eax
+  801994:	0f 85 7b ff ff ff    	jne    801915 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80199a:	85 ff                	test   %edi,%edi
+  80199c:	74 0f                	je     8019ad <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80199e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a1:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8019a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5f                   	pop    %edi
+  8019ab:	5d                   	pop    %ebp
+  8019ac:	c3                   	ret
+		return 0;
+  8019ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b2:	eb f1                	jmp    8019a5 <fgets+0xac>
+
+008019b4 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	57                   	push   %edi
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 1c             	sub    $0x1c,%esp
+  8019bd:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019c0:	89 f0                	mov    %esi,%eax
+  8019c2:	e8 21 fc ff ff       	call   8015e8 <stream_setup>
+	want = size * n;
+  8019c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ca:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d6:	eb 43                	jmp    801a1b <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019d8:	29 d3                	sub    %edx,%ebx
+  8019da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019dd:	29 f8                	sub    %edi,%eax
+  8019df:	39 c3                	cmp    %eax,%ebx
+  8019e1:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019e4:	83 ec 04             	sub    $0x4,%esp
+  8019e7:	53                   	push   %ebx
+  8019e8:	03 56 0c             	add    0xc(%esi),%edx
+  8019eb:	52                   	push   %edx
+  8019ec:	89 f8                	mov    %edi,%eax
+  8019ee:	03 45 08             	add    0x8(%ebp),%eax
+  8019f1:	50                   	push   %eax
+  8019f2:	e8 15 20 00 00       	call   803a0c <memmove>
+			f->f_rpos += m;
+  8019f7:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	eb 1a                	jmp    801a19 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019ff:	83 ec 04             	sub    $0x4,%esp
+  801a02:	53                   	push   %ebx
+  801a03:	89 f8                	mov    %edi,%eax
+  801a05:	03 45 08             	add    0x8(%ebp),%eax
+  801a08:	50                   	push   %eax
+  801a09:	ff 36                	push   (%esi)
+  801a0b:	e8 86 ef ff ff       	call   800996 <read>
+  801a10:	89 c3                	mov    %eax,%ebx
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	7e 36                	jle    801a4f <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a19:	01 df                	add    %ebx,%edi
+  801a1b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a1e:	39 c7                	cmp    %eax,%edi
+  801a20:	73 39                	jae    801a5b <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a22:	8b 56 14             	mov    0x14(%esi),%edx
+  801a25:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a28:	39 da                	cmp    %ebx,%edx
+  801a2a:	72 ac                	jb     8019d8 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a2c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a2f:	29 fb                	sub    %edi,%ebx
+  801a31:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a34:	72 3e                	jb     801a74 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a36:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a3a:	74 1f                	je     801a5b <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a3c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a40:	74 bd                	je     8019ff <fread+0x4b>
+  801a42:	89 f0                	mov    %esi,%eax
+  801a44:	e8 2f fb ff ff       	call   801578 <stream_drain>
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	79 b2                	jns    8019ff <fread+0x4b>
+  801a4d:	eb 0c                	jmp    801a5b <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a4f:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a52:	83 e3 04             	and    $0x4,%ebx
+  801a55:	83 c3 04             	add    $0x4,%ebx
+  801a58:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	74 0a                	je     801a6c <fread+0xb8>
+  801a62:	89 f8                	mov    %edi,%eax
+  801a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a69:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a6f:	5b                   	pop    %ebx
+  801a70:	5e                   	pop    %esi
+  801a71:	5f                   	pop    %edi
+  801a72:	5d                   	pop    %ebp
+  801a73:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a74:	89 f0                	mov    %esi,%eax
+  801a76:	e8 da fb ff ff       	call   801655 <stream_fill>
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	74 dc                	je     801a5b <fread+0xa7>
+			m = 0;
+  801a7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a84:	eb 93                	jmp    801a19 <fread+0x65>
+
+00801a86 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	57                   	push   %edi
+  801a8a:	56                   	push   %esi
+  801a8b:	53                   	push   %ebx
+  801a8c:	83 ec 1c             	sub    $0x1c,%esp
+  801a8f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a92:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a95:	a8 02                	test   $0x2,%al
+  801a97:	75 13                	jne    801aac <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a99:	83 c8 08             	or     $0x8,%eax
+  801a9c:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa7:	5b                   	pop    %ebx
+  801aa8:	5e                   	pop    %esi
+  801aa9:	5f                   	pop    %edi
+  801aaa:	5d                   	pop    %ebp
+  801aab:	c3                   	ret
+	stream_setup(f);
+  801aac:	89 d8                	mov    %ebx,%eax
+  801aae:	e8 35 fb ff ff       	call   8015e8 <stream_setup>
+	want = size * n;
+  801ab3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab6:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801abd:	89 d8                	mov    %ebx,%eax
+  801abf:	e8 41 fa ff ff       	call   801505 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ac9:	84 c0                	test   %al,%al
+  801acb:	75 7b                	jne    801b48 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801acd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad5:	39 fe                	cmp    %edi,%esi
+  801ad7:	73 24                	jae    801afd <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ad9:	83 ec 04             	sub    $0x4,%esp
+  801adc:	89 f8                	mov    %edi,%eax
+  801ade:	29 f0                	sub    %esi,%eax
+  801ae0:	50                   	push   %eax
+  801ae1:	89 f0                	mov    %esi,%eax
+  801ae3:	03 45 08             	add    0x8(%ebp),%eax
+  801ae6:	50                   	push   %eax
+  801ae7:	ff 33                	push   (%ebx)
+  801ae9:	e8 a0 ef ff ff       	call   800a8e <write>
+  801aee:	83 c4 10             	add    $0x10,%esp
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	7e 04                	jle    801af9 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801af5:	01 c6                	add    %eax,%esi
+  801af7:	eb dc                	jmp    801ad5 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801af9:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801afd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	74 a0                	je     801aa4 <fwrite+0x1e>
+  801b04:	89 f0                	mov    %esi,%eax
+  801b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0b:	f7 75 0c             	divl   0xc(%ebp)
+  801b0e:	eb 94                	jmp    801aa4 <fwrite+0x1e>
+			done += r;
+  801b10:	01 c7                	add    %eax,%edi
+			continue;
+  801b12:	eb 34                	jmp    801b48 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b14:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b17:	29 c6                	sub    %eax,%esi
+  801b19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b1c:	29 fa                	sub    %edi,%edx
+  801b1e:	39 d6                	cmp    %edx,%esi
+  801b20:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	56                   	push   %esi
+  801b27:	89 fa                	mov    %edi,%edx
+  801b29:	03 55 08             	add    0x8(%ebp),%edx
+  801b2c:	52                   	push   %edx
+  801b2d:	03 43 0c             	add    0xc(%ebx),%eax
+  801b30:	50                   	push   %eax
+  801b31:	e8 d6 1e 00 00       	call   803a0c <memmove>
+		f->f_wend += m;
+  801b36:	89 f0                	mov    %esi,%eax
+  801b38:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b3b:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b3e:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b46:	74 5b                	je     801ba3 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b4b:	39 c7                	cmp    %eax,%edi
+  801b4d:	73 2d                	jae    801b7c <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b4f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	75 be                	jne    801b14 <fwrite+0x8e>
+  801b56:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b59:	29 fa                	sub    %edi,%edx
+  801b5b:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b5e:	72 b4                	jb     801b14 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b60:	83 ec 04             	sub    $0x4,%esp
+  801b63:	52                   	push   %edx
+  801b64:	89 f8                	mov    %edi,%eax
+  801b66:	03 45 08             	add    0x8(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	ff 33                	push   (%ebx)
+  801b6c:	e8 1d ef ff ff       	call   800a8e <write>
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	7f 98                	jg     801b10 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b78:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b7c:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b7f:	83 f8 03             	cmp    $0x3,%eax
+  801b82:	74 48                	je     801bcc <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b84:	83 f8 02             	cmp    $0x2,%eax
+  801b87:	74 27                	je     801bb0 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	0f 84 10 ff ff ff    	je     801aa4 <fwrite+0x1e>
+  801b94:	89 f8                	mov    %edi,%eax
+  801b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9b:	f7 75 0c             	divl   0xc(%ebp)
+  801b9e:	e9 01 ff ff ff       	jmp    801aa4 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801ba3:	89 d8                	mov    %ebx,%eax
+  801ba5:	e8 ce f9 ff ff       	call   801578 <stream_drain>
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	79 9a                	jns    801b48 <fwrite+0xc2>
+  801bae:	eb cc                	jmp    801b7c <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801bb0:	83 ec 04             	sub    $0x4,%esp
+  801bb3:	57                   	push   %edi
+  801bb4:	6a 0a                	push   $0xa
+  801bb6:	ff 75 08             	push   0x8(%ebp)
+  801bb9:	e8 ff 1e 00 00       	call   803abd <memfind>
+  801bbe:	89 c2                	mov    %eax,%edx
+  801bc0:	89 f8                	mov    %edi,%eax
+  801bc2:	03 45 08             	add    0x8(%ebp),%eax
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	39 c2                	cmp    %eax,%edx
+  801bca:	74 bd                	je     801b89 <fwrite+0x103>
+		stream_drain(f);
+  801bcc:	89 d8                	mov    %ebx,%eax
+  801bce:	e8 a5 f9 ff ff       	call   801578 <stream_drain>
+  801bd3:	eb b4                	jmp    801b89 <fwrite+0x103>
+
+00801bd5 <fputc>:
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	53                   	push   %ebx
+  801bd9:	83 ec 14             	sub    $0x14,%esp
+  801bdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bdf:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801be2:	ff 75 0c             	push   0xc(%ebp)
+  801be5:	6a 01                	push   $0x1
+  801be7:	6a 01                	push   $0x1
+  801be9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801bec:	50                   	push   %eax
+  801bed:	e8 94 fe ff ff       	call   801a86 <fwrite>
+  801bf2:	83 c4 10             	add    $0x10,%esp
+  801bf5:	0f b6 db             	movzbl %bl,%ebx
+  801bf8:	83 f8 01             	cmp    $0x1,%eax
+  801bfb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c00:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801c03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c06:	c9                   	leave
+  801c07:	c3                   	ret
+
+00801c08 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c08:	55                   	push   %ebp
+  801c09:	89 e5                	mov    %esp,%ebp
+  801c0b:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c0e:	ff 75 0c             	push   0xc(%ebp)
+  801c11:	ff 75 08             	push   0x8(%ebp)
+  801c14:	e8 bc ff ff ff       	call   801bd5 <fputc>
+}
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+
+00801c1e <fputs>:
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	56                   	push   %esi
+  801c22:	53                   	push   %ebx
+  801c23:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	56                   	push   %esi
+  801c2a:	e8 1c 1c 00 00       	call   80384b <strlen>
+  801c2f:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c31:	ff 75 0c             	push   0xc(%ebp)
+  801c34:	50                   	push   %eax
+  801c35:	6a 01                	push   $0x1
+  801c37:	56                   	push   %esi
+  801c38:	e8 49 fe ff ff       	call   801a86 <fwrite>
+  801c3d:	83 c4 20             	add    $0x20,%esp
+  801c40:	39 d8                	cmp    %ebx,%eax
+  801c42:	0f 95 c0             	setne  %al
+  801c45:	0f b6 c0             	movzbl %al,%eax
+  801c48:	f7 d8                	neg    %eax
+}
+  801c4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c4d:	5b                   	pop    %ebx
+  801c4e:	5e                   	pop    %esi
+  801c4f:	5d                   	pop    %ebp
+  801c50:	c3                   	ret
+
+00801c51 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 04             	sub    $0x4,%esp
+  801c58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c5b:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c5e:	50                   	push   %eax
+  801c5f:	ff 75 0c             	push   0xc(%ebp)
+  801c62:	53                   	push   %ebx
+  801c63:	68 08 1c 80 00       	push   $0x801c08
+  801c68:	e8 2c 17 00 00       	call   803399 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c6d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c70:	c1 e0 1c             	shl    $0x1c,%eax
+  801c73:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c79:	c9                   	leave
+  801c7a:	c3                   	ret
+
+00801c7b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c7b:	55                   	push   %ebp
+  801c7c:	89 e5                	mov    %esp,%ebp
+  801c7e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c81:	68 f0 47 80 00       	push   $0x8047f0
+  801c86:	ff 75 0c             	push   0xc(%ebp)
+  801c89:	e8 f8 1b 00 00       	call   803886 <strcpy>
+	return 0;
+}
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	c9                   	leave
+  801c94:	c3                   	ret
+
+00801c95 <devsock_close>:
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	53                   	push   %ebx
+  801c99:	83 ec 10             	sub    $0x10,%esp
+  801c9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c9f:	53                   	push   %ebx
+  801ca0:	e8 26 27 00 00       	call   8043cb <pageref>
+  801ca5:	89 c2                	mov    %eax,%edx
+  801ca7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801caa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801caf:	83 fa 01             	cmp    $0x1,%edx
+  801cb2:	74 05                	je     801cb9 <devsock_close+0x24>
+}
+  801cb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb7:	c9                   	leave
+  801cb8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cb9:	83 ec 0c             	sub    $0xc,%esp
+  801cbc:	ff 73 0c             	push   0xc(%ebx)
+  801cbf:	e8 b7 02 00 00       	call   801f7b <nsipc_close>
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	eb eb                	jmp    801cb4 <devsock_close+0x1f>
+
+00801cc9 <devsock_write>:
+{
+  801cc9:	55                   	push   %ebp
+  801cca:	89 e5                	mov    %esp,%ebp
+  801ccc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ccf:	6a 00                	push   $0x0
+  801cd1:	ff 75 10             	push   0x10(%ebp)
+  801cd4:	ff 75 0c             	push   0xc(%ebp)
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	ff 70 0c             	push   0xc(%eax)
+  801cdd:	e8 79 03 00 00       	call   80205b <nsipc_send>
+}
+  801ce2:	c9                   	leave
+  801ce3:	c3                   	ret
+
+00801ce4 <devsock_read>:
+{
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cea:	6a 00                	push   $0x0
+  801cec:	ff 75 10             	push   0x10(%ebp)
+  801cef:	ff 75 0c             	push   0xc(%ebp)
+  801cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf5:	ff 70 0c             	push   0xc(%eax)
+  801cf8:	e8 ef 02 00 00       	call   801fec <nsipc_recv>
+}
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+
+00801cff <fd2sockid>:
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d05:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d08:	52                   	push   %edx
+  801d09:	50                   	push   %eax
+  801d0a:	e8 f7 e9 ff ff       	call   800706 <fd_lookup>
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 10                	js     801d26 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d19:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d1f:	39 08                	cmp    %ecx,(%eax)
+  801d21:	75 05                	jne    801d28 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d23:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d26:	c9                   	leave
+  801d27:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2d:	eb f7                	jmp    801d26 <fd2sockid+0x27>
+
+00801d2f <alloc_sockfd>:
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	83 ec 1c             	sub    $0x1c,%esp
+  801d37:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 6e e9 ff ff       	call   8006b0 <fd_alloc>
+  801d42:	89 c3                	mov    %eax,%ebx
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 43                	js     801d8e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d4b:	83 ec 04             	sub    $0x4,%esp
+  801d4e:	68 07 04 00 00       	push   $0x407
+  801d53:	ff 75 f4             	push   -0xc(%ebp)
+  801d56:	6a 00                	push   $0x0
+  801d58:	e8 8a e4 ff ff       	call   8001e7 <sys_page_alloc>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 28                	js     801d8e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d69:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d6f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d74:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d7b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	50                   	push   %eax
+  801d82:	e8 02 e9 ff ff       	call   800689 <fd2num>
+  801d87:	89 c3                	mov    %eax,%ebx
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	eb 0c                	jmp    801d9a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d8e:	83 ec 0c             	sub    $0xc,%esp
+  801d91:	56                   	push   %esi
+  801d92:	e8 e4 01 00 00       	call   801f7b <nsipc_close>
+		return r;
+  801d97:	83 c4 10             	add    $0x10,%esp
+}
+  801d9a:	89 d8                	mov    %ebx,%eax
+  801d9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9f:	5b                   	pop    %ebx
+  801da0:	5e                   	pop    %esi
+  801da1:	5d                   	pop    %ebp
+  801da2:	c3                   	ret
+
+00801da3 <accept>:
+{
+  801da3:	55                   	push   %ebp
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dac:	e8 4e ff ff ff       	call   801cff <fd2sockid>
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	78 1b                	js     801dd0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801db5:	83 ec 04             	sub    $0x4,%esp
+  801db8:	ff 75 10             	push   0x10(%ebp)
+  801dbb:	ff 75 0c             	push   0xc(%ebp)
+  801dbe:	50                   	push   %eax
+  801dbf:	e8 0e 01 00 00       	call   801ed2 <nsipc_accept>
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 05                	js     801dd0 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dcb:	e8 5f ff ff ff       	call   801d2f <alloc_sockfd>
+}
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+00801dd2 <bind>:
+{
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddb:	e8 1f ff ff ff       	call   801cff <fd2sockid>
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	78 12                	js     801df6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801de4:	83 ec 04             	sub    $0x4,%esp
+  801de7:	ff 75 10             	push   0x10(%ebp)
+  801dea:	ff 75 0c             	push   0xc(%ebp)
+  801ded:	50                   	push   %eax
+  801dee:	e8 31 01 00 00       	call   801f24 <nsipc_bind>
+  801df3:	83 c4 10             	add    $0x10,%esp
+}
+  801df6:	c9                   	leave
+  801df7:	c3                   	ret
+
+00801df8 <shutdown>:
+{
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e01:	e8 f9 fe ff ff       	call   801cff <fd2sockid>
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 0f                	js     801e19 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e0a:	83 ec 08             	sub    $0x8,%esp
+  801e0d:	ff 75 0c             	push   0xc(%ebp)
+  801e10:	50                   	push   %eax
+  801e11:	e8 43 01 00 00       	call   801f59 <nsipc_shutdown>
+  801e16:	83 c4 10             	add    $0x10,%esp
+}
+  801e19:	c9                   	leave
+  801e1a:	c3                   	ret
+
+00801e1b <connect>:
+{
+  801e1b:	55                   	push   %ebp
+  801e1c:	89 e5                	mov    %esp,%ebp
+  801e1e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e24:	e8 d6 fe ff ff       	call   801cff <fd2sockid>
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 12                	js     801e3f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e2d:	83 ec 04             	sub    $0x4,%esp
+  801e30:	ff 75 10             	push   0x10(%ebp)
+  801e33:	ff 75 0c             	push   0xc(%ebp)
+  801e36:	50                   	push   %eax
+  801e37:	e8 59 01 00 00       	call   801f95 <nsipc_connect>
+  801e3c:	83 c4 10             	add    $0x10,%esp
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <listen>:
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4a:	e8 b0 fe ff ff       	call   801cff <fd2sockid>
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 0f                	js     801e62 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e53:	83 ec 08             	sub    $0x8,%esp
+  801e56:	ff 75 0c             	push   0xc(%ebp)
+  801e59:	50                   	push   %eax
+  801e5a:	e8 6b 01 00 00       	call   801fca <nsipc_listen>
+  801e5f:	83 c4 10             	add    $0x10,%esp
+}
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+
+00801e64 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e6a:	ff 75 10             	push   0x10(%ebp)
+  801e6d:	ff 75 0c             	push   0xc(%ebp)
+  801e70:	ff 75 08             	push   0x8(%ebp)
+  801e73:	e8 41 02 00 00       	call   8020b9 <nsipc_socket>
+  801e78:	83 c4 10             	add    $0x10,%esp
+  801e7b:	85 c0                	test   %eax,%eax
+  801e7d:	78 05                	js     801e84 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e7f:	e8 ab fe ff ff       	call   801d2f <alloc_sockfd>
+}
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+
+00801e86 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e86:	55                   	push   %ebp
+  801e87:	89 e5                	mov    %esp,%ebp
+  801e89:	53                   	push   %ebx
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e8f:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e96:	74 26                	je     801ebe <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e98:	6a 07                	push   $0x7
+  801e9a:	68 00 80 80 00       	push   $0x808000
+  801e9f:	53                   	push   %ebx
+  801ea0:	ff 35 08 60 80 00    	push   0x806008
+  801ea6:	e8 8b 24 00 00       	call   804336 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801eab:	83 c4 0c             	add    $0xc,%esp
+  801eae:	6a 00                	push   $0x0
+  801eb0:	6a 00                	push   $0x0
+  801eb2:	6a 00                	push   $0x0
+  801eb4:	e8 87 23 00 00       	call   804240 <ipc_recv>
+}
+  801eb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	6a 02                	push   $0x2
+  801ec3:	e8 c4 24 00 00       	call   80438c <ipc_find_env>
+  801ec8:	a3 08 60 80 00       	mov    %eax,0x806008
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	eb c6                	jmp    801e98 <nsipc+0x12>
+
+00801ed2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	56                   	push   %esi
+  801ed6:	53                   	push   %ebx
+  801ed7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801eda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ee2:	8b 06                	mov    (%esi),%eax
+  801ee4:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eee:	e8 93 ff ff ff       	call   801e86 <nsipc>
+  801ef3:	89 c3                	mov    %eax,%ebx
+  801ef5:	85 c0                	test   %eax,%eax
+  801ef7:	79 09                	jns    801f02 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ef9:	89 d8                	mov    %ebx,%eax
+  801efb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801efe:	5b                   	pop    %ebx
+  801eff:	5e                   	pop    %esi
+  801f00:	5d                   	pop    %ebp
+  801f01:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f02:	83 ec 04             	sub    $0x4,%esp
+  801f05:	ff 35 10 80 80 00    	push   0x808010
+  801f0b:	68 00 80 80 00       	push   $0x808000
+  801f10:	ff 75 0c             	push   0xc(%ebp)
+  801f13:	e8 f4 1a 00 00       	call   803a0c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f18:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f1d:	89 06                	mov    %eax,(%esi)
+  801f1f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f22:	eb d5                	jmp    801ef9 <nsipc_accept+0x27>
+
+00801f24 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f24:	55                   	push   %ebp
+  801f25:	89 e5                	mov    %esp,%ebp
+  801f27:	53                   	push   %ebx
+  801f28:	83 ec 08             	sub    $0x8,%esp
+  801f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f31:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f36:	53                   	push   %ebx
+  801f37:	ff 75 0c             	push   0xc(%ebp)
+  801f3a:	68 04 80 80 00       	push   $0x808004
+  801f3f:	e8 c8 1a 00 00       	call   803a0c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f44:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f4f:	e8 32 ff ff ff       	call   801e86 <nsipc>
+}
+  801f54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+00801f59 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f62:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f74:	e8 0d ff ff ff       	call   801e86 <nsipc>
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+00801f7b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f84:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f89:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f8e:	e8 f3 fe ff ff       	call   801e86 <nsipc>
+}
+  801f93:	c9                   	leave
+  801f94:	c3                   	ret
+
+00801f95 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	53                   	push   %ebx
+  801f99:	83 ec 08             	sub    $0x8,%esp
+  801f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fa7:	53                   	push   %ebx
+  801fa8:	ff 75 0c             	push   0xc(%ebp)
+  801fab:	68 04 80 80 00       	push   $0x808004
+  801fb0:	e8 57 1a 00 00       	call   803a0c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fb5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fc0:	e8 c1 fe ff ff       	call   801e86 <nsipc>
+}
+  801fc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc8:	c9                   	leave
+  801fc9:	c3                   	ret
+
+00801fca <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fca:	55                   	push   %ebp
+  801fcb:	89 e5                	mov    %esp,%ebp
+  801fcd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fdb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fe0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fe5:	e8 9c fe ff ff       	call   801e86 <nsipc>
+}
+  801fea:	c9                   	leave
+  801feb:	c3                   	ret
+
+00801fec <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	56                   	push   %esi
+  801ff0:	53                   	push   %ebx
+  801ff1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801ffc:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802002:	8b 45 14             	mov    0x14(%ebp),%eax
+  802005:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80200a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80200f:	e8 72 fe ff ff       	call   801e86 <nsipc>
+  802014:	89 c3                	mov    %eax,%ebx
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 22                	js     80203c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80201a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80201f:	39 c6                	cmp    %eax,%esi
+  802021:	0f 4e c6             	cmovle %esi,%eax
+  802024:	39 c3                	cmp    %eax,%ebx
+  802026:	7f 1d                	jg     802045 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802028:	83 ec 04             	sub    $0x4,%esp
+  80202b:	53                   	push   %ebx
+  80202c:	68 00 80 80 00       	push   $0x808000
+  802031:	ff 75 0c             	push   0xc(%ebp)
+  802034:	e8 d3 19 00 00       	call   803a0c <memmove>
+  802039:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80203c:	89 d8                	mov    %ebx,%eax
+  80203e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5d                   	pop    %ebp
+  802044:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802045:	68 fc 47 80 00       	push   $0x8047fc
+  80204a:	68 b5 47 80 00       	push   $0x8047b5
+  80204f:	6a 62                	push   $0x62
+  802051:	68 11 48 80 00       	push   $0x804811
+  802056:	e8 6c 11 00 00       	call   8031c7 <_panic>
+
+0080205b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80205b:	55                   	push   %ebp
+  80205c:	89 e5                	mov    %esp,%ebp
+  80205e:	53                   	push   %ebx
+  80205f:	83 ec 04             	sub    $0x4,%esp
+  802062:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802065:	8b 45 08             	mov    0x8(%ebp),%eax
+  802068:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80206d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802073:	7f 2e                	jg     8020a3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802075:	83 ec 04             	sub    $0x4,%esp
+  802078:	53                   	push   %ebx
+  802079:	ff 75 0c             	push   0xc(%ebp)
+  80207c:	68 0c 80 80 00       	push   $0x80800c
+  802081:	e8 86 19 00 00       	call   803a0c <memmove>
+	nsipcbuf.send.req_size = size;
+  802086:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80208c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80208f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802094:	b8 08 00 00 00       	mov    $0x8,%eax
+  802099:	e8 e8 fd ff ff       	call   801e86 <nsipc>
+}
+  80209e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a1:	c9                   	leave
+  8020a2:	c3                   	ret
+	assert(size < 1600);
+  8020a3:	68 1d 48 80 00       	push   $0x80481d
+  8020a8:	68 b5 47 80 00       	push   $0x8047b5
+  8020ad:	6a 6d                	push   $0x6d
+  8020af:	68 11 48 80 00       	push   $0x804811
+  8020b4:	e8 0e 11 00 00       	call   8031c7 <_panic>
+
+008020b9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ca:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020d2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020d7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020dc:	e8 a5 fd ff ff       	call   801e86 <nsipc>
+}
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+
+008020e3 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	53                   	push   %ebx
+  8020e7:	83 ec 10             	sub    $0x10,%esp
+  8020ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020ed:	68 0c 60 80 00       	push   $0x80600c
+  8020f2:	e8 50 07 00 00       	call   802847 <mutex_lock>
+	if (v == 0)
+  8020f7:	83 c4 10             	add    $0x10,%esp
+  8020fa:	85 db                	test   %ebx,%ebx
+  8020fc:	0f 84 85 00 00 00    	je     802187 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802102:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802108:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80210d:	77 51                	ja     802160 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80210f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802115:	89 d8                	mov    %ebx,%eax
+  802117:	c1 e8 0c             	shr    $0xc,%eax
+  80211a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802121:	f6 c4 02             	test   $0x2,%ah
+  802124:	74 50                	je     802176 <free+0x93>
+		sys_page_unmap(0, c);
+  802126:	83 ec 08             	sub    $0x8,%esp
+  802129:	53                   	push   %ebx
+  80212a:	6a 00                	push   $0x0
+  80212c:	e8 4f e1 ff ff       	call   800280 <sys_page_unmap>
+		c += PGSIZE;
+  802131:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802137:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802145:	76 ce                	jbe    802115 <free+0x32>
+  802147:	68 67 48 80 00       	push   $0x804867
+  80214c:	68 b5 47 80 00       	push   $0x8047b5
+  802151:	68 82 00 00 00       	push   $0x82
+  802156:	68 5a 48 80 00       	push   $0x80485a
+  80215b:	e8 67 10 00 00       	call   8031c7 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802160:	68 2c 48 80 00       	push   $0x80482c
+  802165:	68 b5 47 80 00       	push   $0x8047b5
+  80216a:	6a 7b                	push   $0x7b
+  80216c:	68 5a 48 80 00       	push   $0x80485a
+  802171:	e8 51 10 00 00       	call   8031c7 <_panic>
+	if (--(*ref) == 0)
+  802176:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80217c:	83 e8 01             	sub    $0x1,%eax
+  80217f:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802185:	74 15                	je     80219c <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	68 0c 60 80 00       	push   $0x80600c
+  80218f:	e8 20 07 00 00       	call   8028b4 <mutex_unlock>
+}
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219a:	c9                   	leave
+  80219b:	c3                   	ret
+		sys_page_unmap(0, c);
+  80219c:	83 ec 08             	sub    $0x8,%esp
+  80219f:	53                   	push   %ebx
+  8021a0:	6a 00                	push   $0x0
+  8021a2:	e8 d9 e0 ff ff       	call   800280 <sys_page_unmap>
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	eb db                	jmp    802187 <free+0xa4>
+
+008021ac <malloc>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	57                   	push   %edi
+  8021b0:	56                   	push   %esi
+  8021b1:	53                   	push   %ebx
+  8021b2:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021b5:	68 0c 60 80 00       	push   $0x80600c
+  8021ba:	e8 88 06 00 00       	call   802847 <mutex_lock>
+	if (mptr == 0)
+  8021bf:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021c5:	83 c4 10             	add    $0x10,%esp
+  8021c8:	85 ff                	test   %edi,%edi
+  8021ca:	74 6c                	je     802238 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cf:	83 c0 03             	add    $0x3,%eax
+  8021d2:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021d5:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021d7:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021dc:	0f 87 64 01 00 00    	ja     802346 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021e2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021e8:	74 30                	je     80221a <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021ea:	89 f9                	mov    %edi,%ecx
+  8021ec:	c1 e9 0c             	shr    $0xc,%ecx
+  8021ef:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021f3:	c1 e8 0c             	shr    $0xc,%eax
+  8021f6:	39 c1                	cmp    %eax,%ecx
+  8021f8:	74 5f                	je     802259 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021fa:	83 ec 0c             	sub    $0xc,%esp
+  8021fd:	57                   	push   %edi
+  8021fe:	e8 e0 fe ff ff       	call   8020e3 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802203:	a1 10 60 80 00       	mov    0x806010,%eax
+  802208:	05 00 10 00 00       	add    $0x1000,%eax
+  80220d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802212:	a3 10 60 80 00       	mov    %eax,0x806010
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802220:	ba 02 00 00 00       	mov    $0x2,%edx
+  802225:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802229:	8d 7e 04             	lea    0x4(%esi),%edi
+  80222c:	89 cb                	mov    %ecx,%ebx
+  80222e:	01 f9                	add    %edi,%ecx
+  802230:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802233:	e9 8b 00 00 00       	jmp    8022c3 <malloc+0x117>
+		mptr = mbegin;
+  802238:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80223f:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	83 c0 03             	add    $0x3,%eax
+  802248:	83 e0 fc             	and    $0xfffffffc,%eax
+  80224b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80224d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802252:	76 c6                	jbe    80221a <malloc+0x6e>
+  802254:	e9 d6 00 00 00       	jmp    80232f <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802259:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80225f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802264:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802268:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80226b:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802270:	e9 ba 00 00 00       	jmp    80232f <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802275:	05 00 10 00 00       	add    $0x1000,%eax
+  80227a:	39 c8                	cmp    %ecx,%eax
+  80227c:	0f 83 cb 00 00 00    	jae    80234d <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802282:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802287:	77 22                	ja     8022ab <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802289:	89 c2                	mov    %eax,%edx
+  80228b:	c1 ea 16             	shr    $0x16,%edx
+  80228e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802295:	f6 c2 01             	test   $0x1,%dl
+  802298:	74 db                	je     802275 <malloc+0xc9>
+  80229a:	89 c2                	mov    %eax,%edx
+  80229c:	c1 ea 0c             	shr    $0xc,%edx
+  80229f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022a6:	f6 c2 01             	test   $0x1,%dl
+  8022a9:	74 ca                	je     802275 <malloc+0xc9>
+		if (mptr == mend) {
+  8022ab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022b1:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022b7:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022bb:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022c1:	74 04                	je     8022c7 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022c3:	89 d8                	mov    %ebx,%eax
+  8022c5:	eb b3                	jmp    80227a <malloc+0xce>
+  8022c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022ca:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022cf:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022d3:	83 ea 01             	sub    $0x1,%edx
+  8022d6:	0f 85 50 ff ff ff    	jne    80222c <malloc+0x80>
+  8022dc:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022e3:	00 00 08 
+				return 0;	/* out of address space */
+  8022e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022eb:	eb 42                	jmp    80232f <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022ed:	85 db                	test   %ebx,%ebx
+  8022ef:	78 1e                	js     80230f <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022f1:	83 ec 08             	sub    $0x8,%esp
+  8022f4:	89 d8                	mov    %ebx,%eax
+  8022f6:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022fc:	50                   	push   %eax
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	e8 7c df ff ff       	call   800280 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802304:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	eb de                	jmp    8022ed <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80230f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802314:	eb 19                	jmp    80232f <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802316:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802319:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80231f:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802326:	00 
+	mptr += n;
+  802327:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80232a:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80232f:	83 ec 0c             	sub    $0xc,%esp
+  802332:	68 0c 60 80 00       	push   $0x80600c
+  802337:	e8 78 05 00 00       	call   8028b4 <mutex_unlock>
+}
+  80233c:	89 f8                	mov    %edi,%eax
+  80233e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802341:	5b                   	pop    %ebx
+  802342:	5e                   	pop    %esi
+  802343:	5f                   	pop    %edi
+  802344:	5d                   	pop    %ebp
+  802345:	c3                   	ret
+		return 0;
+  802346:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234b:	eb e2                	jmp    80232f <malloc+0x183>
+  80234d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802351:	74 06                	je     802359 <malloc+0x1ad>
+  802353:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802359:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80235e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802361:	39 fb                	cmp    %edi,%ebx
+  802363:	73 b1                	jae    802316 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802365:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80236b:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80236e:	39 fe                	cmp    %edi,%esi
+  802370:	0f 92 c0             	setb   %al
+  802373:	0f b6 c0             	movzbl %al,%eax
+  802376:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802379:	83 c8 07             	or     $0x7,%eax
+  80237c:	50                   	push   %eax
+  80237d:	89 d8                	mov    %ebx,%eax
+  80237f:	03 05 10 60 80 00    	add    0x806010,%eax
+  802385:	50                   	push   %eax
+  802386:	6a 00                	push   $0x0
+  802388:	e8 5a de ff ff       	call   8001e7 <sys_page_alloc>
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	85 c0                	test   %eax,%eax
+  802392:	0f 88 55 ff ff ff    	js     8022ed <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802398:	89 f3                	mov    %esi,%ebx
+  80239a:	eb c5                	jmp    802361 <malloc+0x1b5>
+
+0080239c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	56                   	push   %esi
+  8023a0:	53                   	push   %ebx
+  8023a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023a4:	83 ec 0c             	sub    $0xc,%esp
+  8023a7:	ff 75 08             	push   0x8(%ebp)
+  8023aa:	e8 ea e2 ff ff       	call   800699 <fd2data>
+  8023af:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023b1:	83 c4 08             	add    $0x8,%esp
+  8023b4:	68 7f 48 80 00       	push   $0x80487f
+  8023b9:	53                   	push   %ebx
+  8023ba:	e8 c7 14 00 00       	call   803886 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023bf:	8b 46 04             	mov    0x4(%esi),%eax
+  8023c2:	2b 06                	sub    (%esi),%eax
+  8023c4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023ca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023d1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023d4:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023db:	52 80 00 
+	return 0;
+}
+  8023de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e6:	5b                   	pop    %ebx
+  8023e7:	5e                   	pop    %esi
+  8023e8:	5d                   	pop    %ebp
+  8023e9:	c3                   	ret
+
+008023ea <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ef:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023f3:	85 c9                	test   %ecx,%ecx
+  8023f5:	75 01                	jne    8023f8 <pipewake+0xe>
+  8023f7:	c3                   	ret
+{
+  8023f8:	55                   	push   %ebp
+  8023f9:	89 e5                	mov    %esp,%ebp
+  8023fb:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023fe:	68 00 04 00 00       	push   $0x400
+  802403:	52                   	push   %edx
+  802404:	e8 22 e1 ff ff       	call   80052b <sys_futex_wake>
+  802409:	83 c4 10             	add    $0x10,%esp
+}
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+
+0080240e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80240e:	55                   	push   %ebp
+  80240f:	89 e5                	mov    %esp,%ebp
+  802411:	56                   	push   %esi
+  802412:	53                   	push   %ebx
+  802413:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802416:	83 ec 0c             	sub    $0xc,%esp
+  802419:	56                   	push   %esi
+  80241a:	e8 7a e2 ff ff       	call   800699 <fd2data>
+  80241f:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802421:	83 c4 08             	add    $0x8,%esp
+  802424:	56                   	push   %esi
+  802425:	6a 00                	push   $0x0
+  802427:	e8 54 de ff ff       	call   800280 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80242c:	8d 53 04             	lea    0x4(%ebx),%edx
+  80242f:	8d 43 08             	lea    0x8(%ebx),%eax
+  802432:	e8 b3 ff ff ff       	call   8023ea <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802437:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80243a:	89 da                	mov    %ebx,%edx
+  80243c:	e8 a9 ff ff ff       	call   8023ea <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802441:	89 34 24             	mov    %esi,(%esp)
+  802444:	e8 50 e2 ff ff       	call   800699 <fd2data>
+  802449:	83 c4 08             	add    $0x8,%esp
+  80244c:	50                   	push   %eax
+  80244d:	6a 00                	push   $0x0
+  80244f:	e8 2c de ff ff       	call   800280 <sys_page_unmap>
+}
+  802454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802457:	5b                   	pop    %ebx
+  802458:	5e                   	pop    %esi
+  802459:	5d                   	pop    %ebp
+  80245a:	c3                   	ret
+
+0080245b <_pipeisclosed>:
+{
+  80245b:	55                   	push   %ebp
+  80245c:	89 e5                	mov    %esp,%ebp
+  80245e:	57                   	push   %edi
+  80245f:	56                   	push   %esi
+  802460:	53                   	push   %ebx
+  802461:	83 ec 1c             	sub    $0x1c,%esp
+  802464:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802467:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802469:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80246e:	eb 5d                	jmp    8024cd <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802470:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802476:	8b 02                	mov    (%edx),%eax
+  802478:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80247b:	83 ec 0c             	sub    $0xc,%esp
+  80247e:	ff 75 e0             	push   -0x20(%ebp)
+  802481:	e8 45 1f 00 00       	call   8043cb <pageref>
+  802486:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802489:	89 3c 24             	mov    %edi,(%esp)
+  80248c:	e8 3a 1f 00 00       	call   8043cb <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802491:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802493:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8024a2:	77 15                	ja     8024b9 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024a4:	89 f2                	mov    %esi,%edx
+  8024a6:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8024a8:	c1 ea 10             	shr    $0x10,%edx
+  8024ab:	74 0c                	je     8024b9 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024ad:	c1 e2 10             	shl    $0x10,%edx
+  8024b0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024b5:	29 d1                	sub    %edx,%ecx
+  8024b7:	eb 06                	jmp    8024bf <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024b9:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024bf:	8b 11                	mov    (%ecx),%edx
+  8024c1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024c4:	39 d3                	cmp    %edx,%ebx
+  8024c6:	74 6e                	je     802536 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024cb:	74 24                	je     8024f1 <_pipeisclosed+0x96>
+  8024cd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024cf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024d5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024da:	77 94                	ja     802470 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024dc:	89 f0                	mov    %esi,%eax
+  8024de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024e0:	c1 e8 10             	shr    $0x10,%eax
+  8024e3:	74 8b                	je     802470 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024e5:	c1 e0 10             	shl    $0x10,%eax
+  8024e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024ed:	29 c2                	sub    %eax,%edx
+  8024ef:	eb 85                	jmp    802476 <_pipeisclosed+0x1b>
+  8024f1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024f3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024f9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024fe:	77 18                	ja     802518 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802500:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802505:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802507:	c1 e8 10             	shr    $0x10,%eax
+  80250a:	74 0c                	je     802518 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80250c:	c1 e0 10             	shl    $0x10,%eax
+  80250f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802514:	29 c2                	sub    %eax,%edx
+  802516:	eb 06                	jmp    80251e <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802518:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80251e:	8b 02                	mov    (%edx),%eax
+  802520:	8b 40 58             	mov    0x58(%eax),%eax
+  802523:	6a 01                	push   $0x1
+  802525:	50                   	push   %eax
+  802526:	53                   	push   %ebx
+  802527:	68 86 48 80 00       	push   $0x804886
+  80252c:	e8 71 0d 00 00       	call   8032a2 <cprintf>
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	eb 97                	jmp    8024cd <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802536:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802539:	0f 94 c0             	sete   %al
+  80253c:	0f b6 c0             	movzbl %al,%eax
+}
+  80253f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802542:	5b                   	pop    %ebx
+  802543:	5e                   	pop    %esi
+  802544:	5f                   	pop    %edi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+
+00802547 <devpipe_write>:
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	57                   	push   %edi
+  80254b:	56                   	push   %esi
+  80254c:	53                   	push   %ebx
+  80254d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802550:	ff 75 08             	push   0x8(%ebp)
+  802553:	e8 41 e1 ff ff       	call   800699 <fd2data>
+  802558:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802564:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802567:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80256a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80256d:	0f 84 96 00 00 00    	je     802609 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802573:	8d 73 08             	lea    0x8(%ebx),%esi
+  802576:	eb 32                	jmp    8025aa <devpipe_write+0x63>
+  802578:	89 fa                	mov    %edi,%edx
+  80257a:	89 f0                	mov    %esi,%eax
+  80257c:	e8 69 fe ff ff       	call   8023ea <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802581:	8b 43 04             	mov    0x4(%ebx),%eax
+  802584:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802587:	ba 01 00 00 00       	mov    $0x1,%edx
+  80258c:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802591:	83 ec 04             	sub    $0x4,%esp
+  802594:	6a 0a                	push   $0xa
+  802596:	50                   	push   %eax
+  802597:	53                   	push   %ebx
+  802598:	e8 5f df ff ff       	call   8004fc <sys_futex_wait>
+  80259d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025a2:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8025a7:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025aa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025ad:	8b 0b                	mov    (%ebx),%ecx
+  8025af:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025b2:	39 d0                	cmp    %edx,%eax
+  8025b4:	72 1b                	jb     8025d1 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025b6:	89 da                	mov    %ebx,%edx
+  8025b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025bb:	e8 9b fe ff ff       	call   80245b <_pipeisclosed>
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	74 b4                	je     802578 <devpipe_write+0x31>
+				return 0;
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cc:	5b                   	pop    %ebx
+  8025cd:	5e                   	pop    %esi
+  8025ce:	5f                   	pop    %edi
+  8025cf:	5d                   	pop    %ebp
+  8025d0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025d7:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025db:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025de:	89 c2                	mov    %eax,%edx
+  8025e0:	c1 fa 1f             	sar    $0x1f,%edx
+  8025e3:	89 d1                	mov    %edx,%ecx
+  8025e5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025e8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025eb:	83 e2 1f             	and    $0x1f,%edx
+  8025ee:	29 ca                	sub    %ecx,%edx
+  8025f0:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025f4:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025f8:	83 c0 01             	add    $0x1,%eax
+  8025fb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025fe:	83 c6 01             	add    $0x1,%esi
+  802601:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802604:	e9 5e ff ff ff       	jmp    802567 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802609:	8d 53 04             	lea    0x4(%ebx),%edx
+  80260c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80260f:	e8 d6 fd ff ff       	call   8023ea <pipewake>
+	return i;
+  802614:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802617:	eb b0                	jmp    8025c9 <devpipe_write+0x82>
+
+00802619 <devpipe_read>:
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	57                   	push   %edi
+  80261d:	56                   	push   %esi
+  80261e:	53                   	push   %ebx
+  80261f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802622:	ff 75 08             	push   0x8(%ebp)
+  802625:	e8 6f e0 ff ff       	call   800699 <fd2data>
+  80262a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80262c:	83 c4 10             	add    $0x10,%esp
+  80262f:	be 00 00 00 00       	mov    $0x0,%esi
+  802634:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802637:	74 6c                	je     8026a5 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802639:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80263c:	eb 25                	jmp    802663 <devpipe_read+0x4a>
+  80263e:	8b 13                	mov    (%ebx),%edx
+  802640:	b8 01 00 00 00       	mov    $0x1,%eax
+  802645:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80264a:	83 ec 04             	sub    $0x4,%esp
+  80264d:	6a 0a                	push   $0xa
+  80264f:	52                   	push   %edx
+  802650:	57                   	push   %edi
+  802651:	e8 a6 de ff ff       	call   8004fc <sys_futex_wait>
+  802656:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80265b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802660:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802663:	8b 03                	mov    (%ebx),%eax
+  802665:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802668:	75 19                	jne    802683 <devpipe_read+0x6a>
+			if (i > 0)
+  80266a:	85 f6                	test   %esi,%esi
+  80266c:	75 3a                	jne    8026a8 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80266e:	89 da                	mov    %ebx,%edx
+  802670:	8b 45 08             	mov    0x8(%ebp),%eax
+  802673:	e8 e3 fd ff ff       	call   80245b <_pipeisclosed>
+  802678:	85 c0                	test   %eax,%eax
+  80267a:	74 c2                	je     80263e <devpipe_read+0x25>
+				return 0;
+  80267c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802681:	eb 31                	jmp    8026b4 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802683:	89 c1                	mov    %eax,%ecx
+  802685:	c1 f9 1f             	sar    $0x1f,%ecx
+  802688:	c1 e9 1b             	shr    $0x1b,%ecx
+  80268b:	01 c8                	add    %ecx,%eax
+  80268d:	83 e0 1f             	and    $0x1f,%eax
+  802690:	29 c8                	sub    %ecx,%eax
+  802692:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802697:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80269a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80269d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026a0:	83 c6 01             	add    $0x1,%esi
+  8026a3:	eb 8f                	jmp    802634 <devpipe_read+0x1b>
+out:
+  8026a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8026a8:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8026ab:	89 da                	mov    %ebx,%edx
+  8026ad:	e8 38 fd ff ff       	call   8023ea <pipewake>
+	return i;
+  8026b2:	89 f0                	mov    %esi,%eax
+}
+  8026b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b7:	5b                   	pop    %ebx
+  8026b8:	5e                   	pop    %esi
+  8026b9:	5f                   	pop    %edi
+  8026ba:	5d                   	pop    %ebp
+  8026bb:	c3                   	ret
+
+008026bc <pipe>:
+{
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	56                   	push   %esi
+  8026c0:	53                   	push   %ebx
+  8026c1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c7:	50                   	push   %eax
+  8026c8:	e8 e3 df ff ff       	call   8006b0 <fd_alloc>
+  8026cd:	89 c3                	mov    %eax,%ebx
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	0f 88 23 01 00 00    	js     8027fd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026da:	83 ec 04             	sub    $0x4,%esp
+  8026dd:	68 07 04 00 00       	push   $0x407
+  8026e2:	ff 75 f4             	push   -0xc(%ebp)
+  8026e5:	6a 00                	push   $0x0
+  8026e7:	e8 fb da ff ff       	call   8001e7 <sys_page_alloc>
+  8026ec:	89 c3                	mov    %eax,%ebx
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	0f 88 04 01 00 00    	js     8027fd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026f9:	83 ec 0c             	sub    $0xc,%esp
+  8026fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ff:	50                   	push   %eax
+  802700:	e8 ab df ff ff       	call   8006b0 <fd_alloc>
+  802705:	89 c3                	mov    %eax,%ebx
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	85 c0                	test   %eax,%eax
+  80270c:	0f 88 db 00 00 00    	js     8027ed <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802712:	83 ec 04             	sub    $0x4,%esp
+  802715:	68 07 04 00 00       	push   $0x407
+  80271a:	ff 75 f0             	push   -0x10(%ebp)
+  80271d:	6a 00                	push   $0x0
+  80271f:	e8 c3 da ff ff       	call   8001e7 <sys_page_alloc>
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	0f 88 bc 00 00 00    	js     8027ed <pipe+0x131>
+	va = fd2data(fd0);
+  802731:	83 ec 0c             	sub    $0xc,%esp
+  802734:	ff 75 f4             	push   -0xc(%ebp)
+  802737:	e8 5d df ff ff       	call   800699 <fd2data>
+  80273c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80273e:	83 c4 0c             	add    $0xc,%esp
+  802741:	68 07 04 00 00       	push   $0x407
+  802746:	50                   	push   %eax
+  802747:	6a 00                	push   $0x0
+  802749:	e8 99 da ff ff       	call   8001e7 <sys_page_alloc>
+  80274e:	89 c3                	mov    %eax,%ebx
+  802750:	83 c4 10             	add    $0x10,%esp
+  802753:	85 c0                	test   %eax,%eax
+  802755:	0f 88 82 00 00 00    	js     8027dd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80275b:	83 ec 0c             	sub    $0xc,%esp
+  80275e:	ff 75 f0             	push   -0x10(%ebp)
+  802761:	e8 33 df ff ff       	call   800699 <fd2data>
+  802766:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80276d:	50                   	push   %eax
+  80276e:	6a 00                	push   $0x0
+  802770:	56                   	push   %esi
+  802771:	6a 00                	push   $0x0
+  802773:	e8 bc da ff ff       	call   800234 <sys_page_map>
+  802778:	89 c3                	mov    %eax,%ebx
+  80277a:	83 c4 20             	add    $0x20,%esp
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	78 4e                	js     8027cf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802781:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802786:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802789:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80278b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80278e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802795:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802798:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80279a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80279d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027a4:	83 ec 0c             	sub    $0xc,%esp
+  8027a7:	ff 75 f4             	push   -0xc(%ebp)
+  8027aa:	e8 da de ff ff       	call   800689 <fd2num>
+  8027af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027b4:	83 c4 04             	add    $0x4,%esp
+  8027b7:	ff 75 f0             	push   -0x10(%ebp)
+  8027ba:	e8 ca de ff ff       	call   800689 <fd2num>
+  8027bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027c2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027cd:	eb 2e                	jmp    8027fd <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027cf:	83 ec 08             	sub    $0x8,%esp
+  8027d2:	56                   	push   %esi
+  8027d3:	6a 00                	push   $0x0
+  8027d5:	e8 a6 da ff ff       	call   800280 <sys_page_unmap>
+  8027da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027dd:	83 ec 08             	sub    $0x8,%esp
+  8027e0:	ff 75 f0             	push   -0x10(%ebp)
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	e8 96 da ff ff       	call   800280 <sys_page_unmap>
+  8027ea:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+  8027f0:	ff 75 f4             	push   -0xc(%ebp)
+  8027f3:	6a 00                	push   $0x0
+  8027f5:	e8 86 da ff ff       	call   800280 <sys_page_unmap>
+  8027fa:	83 c4 10             	add    $0x10,%esp
+}
+  8027fd:	89 d8                	mov    %ebx,%eax
+  8027ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802802:	5b                   	pop    %ebx
+  802803:	5e                   	pop    %esi
+  802804:	5d                   	pop    %ebp
+  802805:	c3                   	ret
+
+00802806 <pipeisclosed>:
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80280c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280f:	50                   	push   %eax
+  802810:	ff 75 08             	push   0x8(%ebp)
+  802813:	e8 ee de ff ff       	call   800706 <fd_lookup>
+  802818:	83 c4 10             	add    $0x10,%esp
+  80281b:	85 c0                	test   %eax,%eax
+  80281d:	78 18                	js     802837 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80281f:	83 ec 0c             	sub    $0xc,%esp
+  802822:	ff 75 f4             	push   -0xc(%ebp)
+  802825:	e8 6f de ff ff       	call   800699 <fd2data>
+  80282a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80282c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80282f:	e8 27 fc ff ff       	call   80245b <_pipeisclosed>
+  802834:	83 c4 10             	add    $0x10,%esp
+}
+  802837:	c9                   	leave
+  802838:	c3                   	ret
+
+00802839 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802839:	55                   	push   %ebp
+  80283a:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80283c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802845:	5d                   	pop    %ebp
+  802846:	c3                   	ret
+
+00802847 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	56                   	push   %esi
+  80284b:	53                   	push   %ebx
+  80284c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80284f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802854:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802859:	89 d0                	mov    %edx,%eax
+  80285b:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80285f:	85 c0                	test   %eax,%eax
+  802861:	74 2d                	je     802890 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802863:	83 f8 02             	cmp    $0x2,%eax
+  802866:	74 08                	je     802870 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802868:	b8 02 00 00 00       	mov    $0x2,%eax
+  80286d:	f0 87 03             	lock xchg %eax,(%ebx)
+  802870:	be 02 00 00 00       	mov    $0x2,%esi
+  802875:	eb 15                	jmp    80288c <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802877:	83 ec 04             	sub    $0x4,%esp
+  80287a:	6a 00                	push   $0x0
+  80287c:	6a 02                	push   $0x2
+  80287e:	53                   	push   %ebx
+  80287f:	e8 78 dc ff ff       	call   8004fc <sys_futex_wait>
+  802884:	89 f0                	mov    %esi,%eax
+  802886:	f0 87 03             	lock xchg %eax,(%ebx)
+  802889:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80288c:	85 c0                	test   %eax,%eax
+  80288e:	75 e7                	jne    802877 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  802890:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802893:	5b                   	pop    %ebx
+  802894:	5e                   	pop    %esi
+  802895:	5d                   	pop    %ebp
+  802896:	c3                   	ret
+
+00802897 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802897:	55                   	push   %ebp
+  802898:	89 e5                	mov    %esp,%ebp
+  80289a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028a7:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8028ab:	f7 d8                	neg    %eax
+  8028ad:	19 c0                	sbb    %eax,%eax
+  8028af:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028b2:	5d                   	pop    %ebp
+  8028b3:	c3                   	ret
+
+008028b4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028b4:	55                   	push   %ebp
+  8028b5:	89 e5                	mov    %esp,%ebp
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+  8028ba:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c2:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028c5:	83 f8 02             	cmp    $0x2,%eax
+  8028c8:	74 02                	je     8028cc <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028ca:	c9                   	leave
+  8028cb:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+  8028cf:	6a 01                	push   $0x1
+  8028d1:	52                   	push   %edx
+  8028d2:	e8 54 dc ff ff       	call   80052b <sys_futex_wake>
+  8028d7:	83 c4 10             	add    $0x10,%esp
+}
+  8028da:	eb ee                	jmp    8028ca <mutex_unlock+0x16>
+
+008028dc <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028e8:	5d                   	pop    %ebp
+  8028e9:	c3                   	ret
+
+008028ea <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028ea:	55                   	push   %ebp
+  8028eb:	89 e5                	mov    %esp,%ebp
+  8028ed:	57                   	push   %edi
+  8028ee:	56                   	push   %esi
+  8028ef:	53                   	push   %ebx
+  8028f0:	83 ec 18             	sub    $0x18,%esp
+  8028f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028f9:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028fb:	53                   	push   %ebx
+  8028fc:	e8 b3 ff ff ff       	call   8028b4 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  802901:	83 c4 0c             	add    $0xc,%esp
+  802904:	ff 75 10             	push   0x10(%ebp)
+  802907:	57                   	push   %edi
+  802908:	56                   	push   %esi
+  802909:	e8 ee db ff ff       	call   8004fc <sys_futex_wait>
+  80290e:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802910:	83 c4 10             	add    $0x10,%esp
+  802913:	be 02 00 00 00       	mov    $0x2,%esi
+  802918:	eb 10                	jmp    80292a <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80291a:	83 ec 04             	sub    $0x4,%esp
+  80291d:	6a 00                	push   $0x0
+  80291f:	6a 02                	push   $0x2
+  802921:	53                   	push   %ebx
+  802922:	e8 d5 db ff ff       	call   8004fc <sys_futex_wait>
+  802927:	83 c4 10             	add    $0x10,%esp
+  80292a:	89 f0                	mov    %esi,%eax
+  80292c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	75 e7                	jne    80291a <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802933:	83 ff ec             	cmp    $0xffffffec,%edi
+  802936:	74 05                	je     80293d <cond_timedwait+0x53>
+  802938:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80293d:	89 f8                	mov    %edi,%eax
+  80293f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802942:	5b                   	pop    %ebx
+  802943:	5e                   	pop    %esi
+  802944:	5f                   	pop    %edi
+  802945:	5d                   	pop    %ebp
+  802946:	c3                   	ret
+
+00802947 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80294d:	6a 00                	push   $0x0
+  80294f:	ff 75 0c             	push   0xc(%ebp)
+  802952:	ff 75 08             	push   0x8(%ebp)
+  802955:	e8 90 ff ff ff       	call   8028ea <cond_timedwait>
+}
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+
+0080295f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	83 ec 10             	sub    $0x10,%esp
+  802965:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802968:	ba 01 00 00 00       	mov    $0x1,%edx
+  80296d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  802971:	6a 01                	push   $0x1
+  802973:	50                   	push   %eax
+  802974:	e8 b2 db ff ff       	call   80052b <sys_futex_wake>
+}
+  802979:	83 c4 10             	add    $0x10,%esp
+  80297c:	c9                   	leave
+  80297d:	c3                   	ret
+
+0080297e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80297e:	55                   	push   %ebp
+  80297f:	89 e5                	mov    %esp,%ebp
+  802981:	83 ec 10             	sub    $0x10,%esp
+  802984:	8b 45 08             	mov    0x8(%ebp),%eax
+  802987:	ba 01 00 00 00       	mov    $0x1,%edx
+  80298c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  802990:	68 00 04 00 00       	push   $0x400
+  802995:	50                   	push   %eax
+  802996:	e8 90 db ff ff       	call   80052b <sys_futex_wake>
+}
+  80299b:	83 c4 10             	add    $0x10,%esp
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+008029a0 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8029a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a9:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8029ab:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029b2:	5d                   	pop    %ebp
+  8029b3:	c3                   	ret
+
+008029b4 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	53                   	push   %ebx
+  8029b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029bb:	8b 11                	mov    (%ecx),%edx
+  8029bd:	85 d2                	test   %edx,%edx
+  8029bf:	74 14                	je     8029d5 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029c1:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029c4:	89 d0                	mov    %edx,%eax
+  8029c6:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029ca:	39 c2                	cmp    %eax,%edx
+  8029cc:	75 ed                	jne    8029bb <sem_trywait+0x7>
+			return 0;
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d3:	eb 05                	jmp    8029da <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029dd:	c9                   	leave
+  8029de:	c3                   	ret
+
+008029df <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029df:	55                   	push   %ebp
+  8029e0:	89 e5                	mov    %esp,%ebp
+  8029e2:	57                   	push   %edi
+  8029e3:	56                   	push   %esi
+  8029e4:	53                   	push   %ebx
+  8029e5:	83 ec 1c             	sub    $0x1c,%esp
+  8029e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029eb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029ee:	e8 81 da ff ff       	call   800474 <sys_time_msec>
+  8029f3:	01 f8                	add    %edi,%eax
+  8029f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029f8:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029fd:	eb 28                	jmp    802a27 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a04:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802a09:	83 ec 04             	sub    $0x4,%esp
+  802a0c:	56                   	push   %esi
+  802a0d:	6a 00                	push   $0x0
+  802a0f:	53                   	push   %ebx
+  802a10:	e8 e7 da ff ff       	call   8004fc <sys_futex_wait>
+  802a15:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a1a:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a1f:	83 c4 10             	add    $0x10,%esp
+  802a22:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a25:	74 2e                	je     802a55 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a27:	83 ec 0c             	sub    $0xc,%esp
+  802a2a:	53                   	push   %ebx
+  802a2b:	e8 84 ff ff ff       	call   8029b4 <sem_trywait>
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	79 19                	jns    802a50 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a37:	85 ff                	test   %edi,%edi
+  802a39:	74 c4                	je     8029ff <sem_timedwait+0x20>
+  802a3b:	e8 34 da ff ff       	call   800474 <sys_time_msec>
+  802a40:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a43:	29 c6                	sub    %eax,%esi
+  802a45:	85 f6                	test   %esi,%esi
+  802a47:	7f b6                	jg     8029ff <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a49:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a4e:	eb 05                	jmp    802a55 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a58:	5b                   	pop    %ebx
+  802a59:	5e                   	pop    %esi
+  802a5a:	5f                   	pop    %edi
+  802a5b:	5d                   	pop    %ebp
+  802a5c:	c3                   	ret
+
+00802a5d <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a63:	6a 00                	push   $0x0
+  802a65:	ff 75 08             	push   0x8(%ebp)
+  802a68:	e8 72 ff ff ff       	call   8029df <sem_timedwait>
+}
+  802a6d:	83 c4 10             	add    $0x10,%esp
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+
+00802a72 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+  802a75:	83 ec 08             	sub    $0x8,%esp
+  802a78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a80:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a84:	8b 50 04             	mov    0x4(%eax),%edx
+  802a87:	85 d2                	test   %edx,%edx
+  802a89:	75 02                	jne    802a8d <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+  802a90:	6a 01                	push   $0x1
+  802a92:	50                   	push   %eax
+  802a93:	e8 93 da ff ff       	call   80052b <sys_futex_wake>
+  802a98:	83 c4 10             	add    $0x10,%esp
+}
+  802a9b:	eb ee                	jmp    802a8b <sem_post+0x19>
+
+00802a9d <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a9d:	55                   	push   %ebp
+  802a9e:	89 e5                	mov    %esp,%ebp
+  802aa0:	57                   	push   %edi
+  802aa1:	56                   	push   %esi
+  802aa2:	53                   	push   %ebx
+  802aa3:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802aa6:	68 20 60 80 00       	push   $0x806020
+  802aab:	e8 97 fd ff ff       	call   802847 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802ab0:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	75 19                	jne    802ad5 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802abc:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802ac1:	8b 00                	mov    (%eax),%eax
+  802ac3:	8b 40 48             	mov    0x48(%eax),%eax
+  802ac6:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802acb:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802ad2:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ad5:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ada:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802add:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ae4:	8b 40 04             	mov    0x4(%eax),%eax
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	0f 84 e4 00 00 00    	je     802bd3 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802aef:	83 c3 01             	add    $0x1,%ebx
+  802af2:	83 fb 20             	cmp    $0x20,%ebx
+  802af5:	75 e3                	jne    802ada <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802af7:	83 ec 0c             	sub    $0xc,%esp
+  802afa:	68 20 60 80 00       	push   $0x806020
+  802aff:	e8 b0 fd ff ff       	call   8028b4 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802b04:	83 c4 10             	add    $0x10,%esp
+  802b07:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b0c:	e9 b8 00 00 00       	jmp    802bc9 <pthread_create+0x12c>
+  802b11:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b14:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b17:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b19:	39 f3                	cmp    %esi,%ebx
+  802b1b:	73 16                	jae    802b33 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b1d:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b23:	83 ec 08             	sub    $0x8,%esp
+  802b26:	56                   	push   %esi
+  802b27:	6a 00                	push   $0x0
+  802b29:	e8 52 d7 ff ff       	call   800280 <sys_page_unmap>
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	eb e6                	jmp    802b19 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b33:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b36:	83 ec 08             	sub    $0x8,%esp
+  802b39:	ff 75 e4             	push   -0x1c(%ebp)
+  802b3c:	6a 00                	push   $0x0
+  802b3e:	e8 3d d7 ff ff       	call   800280 <sys_page_unmap>
+	return r;
+  802b43:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b46:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b49:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b50:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b57:	eb 70                	jmp    802bc9 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b59:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b5c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b66:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b69:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b6c:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b6f:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b76:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b7b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b7e:	29 c8                	sub    %ecx,%eax
+  802b80:	85 db                	test   %ebx,%ebx
+  802b82:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b89:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b8c:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b93:	83 ec 04             	sub    $0x4,%esp
+  802b96:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b9b:	29 ca                	sub    %ecx,%edx
+  802b9d:	52                   	push   %edx
+	*--esp = 0;
+  802b9e:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802ba1:	50                   	push   %eax
+  802ba2:	68 fa 2d 80 00       	push   $0x802dfa
+  802ba7:	e8 24 da ff ff       	call   8005d0 <sys_thread_create>
+  802bac:	89 c7                	mov    %eax,%edi
+  802bae:	83 c4 10             	add    $0x10,%esp
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	78 91                	js     802b46 <pthread_create+0xa9>
+	th->th_env = id;
+  802bb5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bb8:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc2:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bc4:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bc9:	89 f8                	mov    %edi,%eax
+  802bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bce:	5b                   	pop    %ebx
+  802bcf:	5e                   	pop    %esi
+  802bd0:	5f                   	pop    %edi
+  802bd1:	5d                   	pop    %ebp
+  802bd2:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bd3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bd6:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bdd:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802be4:	83 ec 0c             	sub    $0xc,%esp
+  802be7:	68 20 60 80 00       	push   $0x806020
+  802bec:	e8 c3 fc ff ff       	call   8028b4 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802bf1:	89 d9                	mov    %ebx,%ecx
+  802bf3:	c1 e1 10             	shl    $0x10,%ecx
+  802bf6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802bf9:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802bfe:	29 c8                	sub    %ecx,%eax
+  802c00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802c03:	c1 e8 16             	shr    $0x16,%eax
+  802c06:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c0d:	83 c4 10             	add    $0x10,%esp
+  802c10:	a8 01                	test   $0x1,%al
+  802c12:	74 15                	je     802c29 <pthread_create+0x18c>
+  802c14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c17:	c1 e8 0c             	shr    $0xc,%eax
+  802c1a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c21:	a8 01                	test   $0x1,%al
+  802c23:	0f 85 30 ff ff ff    	jne    802b59 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c29:	83 ec 04             	sub    $0x4,%esp
+  802c2c:	6a 07                	push   $0x7
+  802c2e:	ff 75 e4             	push   -0x1c(%ebp)
+  802c31:	6a 00                	push   $0x0
+  802c33:	e8 af d5 ff ff       	call   8001e7 <sys_page_alloc>
+  802c38:	89 c7                	mov    %eax,%edi
+  802c3a:	83 c4 10             	add    $0x10,%esp
+  802c3d:	85 c0                	test   %eax,%eax
+  802c3f:	0f 88 01 ff ff ff    	js     802b46 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c45:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c4a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c4d:	29 d0                	sub    %edx,%eax
+  802c4f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c52:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c54:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c59:	29 d0                	sub    %edx,%eax
+  802c5b:	89 c7                	mov    %eax,%edi
+  802c5d:	39 fe                	cmp    %edi,%esi
+  802c5f:	0f 83 f4 fe ff ff    	jae    802b59 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c65:	83 ec 04             	sub    $0x4,%esp
+  802c68:	6a 07                	push   $0x7
+  802c6a:	56                   	push   %esi
+  802c6b:	6a 00                	push   $0x0
+  802c6d:	e8 75 d5 ff ff       	call   8001e7 <sys_page_alloc>
+  802c72:	83 c4 10             	add    $0x10,%esp
+  802c75:	85 c0                	test   %eax,%eax
+  802c77:	0f 88 94 fe ff ff    	js     802b11 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c7d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c83:	eb d8                	jmp    802c5d <pthread_create+0x1c0>
+
+00802c85 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c85:	55                   	push   %ebp
+  802c86:	89 e5                	mov    %esp,%ebp
+  802c88:	57                   	push   %edi
+  802c89:	56                   	push   %esi
+  802c8a:	53                   	push   %ebx
+  802c8b:	83 ec 0c             	sub    $0xc,%esp
+  802c8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c91:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c94:	83 f8 1e             	cmp    $0x1e,%eax
+  802c97:	0f 87 c7 00 00 00    	ja     802d64 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c9d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c9f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ca5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802caa:	77 12                	ja     802cbe <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802cac:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802cb1:	29 d0                	sub    %edx,%eax
+  802cb3:	c1 e8 10             	shr    $0x10,%eax
+  802cb6:	39 c3                	cmp    %eax,%ebx
+  802cb8:	0f 84 ad 00 00 00    	je     802d6b <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cbe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cc1:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cc8:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802ccf:	eb 10                	jmp    802ce1 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cd1:	83 ec 04             	sub    $0x4,%esp
+  802cd4:	6a 00                	push   $0x0
+  802cd6:	6a 01                	push   $0x1
+  802cd8:	57                   	push   %edi
+  802cd9:	e8 1e d8 ff ff       	call   8004fc <sys_futex_wait>
+  802cde:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ce1:	8b 46 04             	mov    0x4(%esi),%eax
+  802ce4:	83 f8 01             	cmp    $0x1,%eax
+  802ce7:	74 e8                	je     802cd1 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802ce9:	83 f8 02             	cmp    $0x2,%eax
+  802cec:	0f 85 80 00 00 00    	jne    802d72 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cf2:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802cf5:	c1 e6 02             	shl    $0x2,%esi
+  802cf8:	eb 05                	jmp    802cff <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802cfa:	e8 bc d4 ff ff       	call   8001bb <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cff:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802d05:	89 ca                	mov    %ecx,%edx
+  802d07:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d0d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d10:	c1 e0 04             	shl    $0x4,%eax
+  802d13:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d18:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d1b:	39 c1                	cmp    %eax,%ecx
+  802d1d:	75 12                	jne    802d31 <pthread_join+0xac>
+  802d1f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d22:	c1 e0 04             	shl    $0x4,%eax
+  802d25:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d2a:	8b 40 54             	mov    0x54(%eax),%eax
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	75 c9                	jne    802cfa <pthread_join+0x75>
+	if (ret_store)
+  802d31:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d35:	74 0f                	je     802d46 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d37:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d3a:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d41:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d44:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d46:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d49:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d50:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d5f:	5b                   	pop    %ebx
+  802d60:	5e                   	pop    %esi
+  802d61:	5f                   	pop    %edi
+  802d62:	5d                   	pop    %ebp
+  802d63:	c3                   	ret
+		return -E_INVAL;
+  802d64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d69:	eb f1                	jmp    802d5c <pthread_join+0xd7>
+  802d6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d70:	eb ea                	jmp    802d5c <pthread_join+0xd7>
+		return -E_INVAL;
+  802d72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d77:	eb e3                	jmp    802d5c <pthread_join+0xd7>
+
+00802d79 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d79:	55                   	push   %ebp
+  802d7a:	89 e5                	mov    %esp,%ebp
+  802d7c:	53                   	push   %ebx
+  802d7d:	83 ec 04             	sub    $0x4,%esp
+  802d80:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d82:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d88:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d8d:	77 0c                	ja     802d9b <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d8f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d94:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d96:	c1 e8 10             	shr    $0x10,%eax
+  802d99:	75 0a                	jne    802da5 <pthread_exit+0x2c>
+		exit();
+  802d9b:	e8 25 d3 ff ff       	call   8000c5 <exit>
+  802da0:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802da5:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802dac:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802daf:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802db6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802db9:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802dbc:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802dc3:	83 ec 08             	sub    $0x8,%esp
+  802dc6:	6a 20                	push   $0x20
+  802dc8:	01 c2                	add    %eax,%edx
+  802dca:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dd1:	50                   	push   %eax
+  802dd2:	e8 54 d7 ff ff       	call   80052b <sys_futex_wake>
+	sys_env_destroy(0);
+  802dd7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802dde:	e8 61 d3 ff ff       	call   800144 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802de3:	83 c4 0c             	add    $0xc,%esp
+  802de6:	68 9e 48 80 00       	push   $0x80489e
+  802deb:	68 a5 00 00 00       	push   $0xa5
+  802df0:	68 b8 48 80 00       	push   $0x8048b8
+  802df5:	e8 cd 03 00 00       	call   8031c7 <_panic>
+
+00802dfa <pthread_start>:
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	53                   	push   %ebx
+  802dfe:	83 ec 04             	sub    $0x4,%esp
+  802e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802e04:	e8 86 d3 ff ff       	call   80018f <sys_getenvid>
+  802e09:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e0e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e14:	85 db                	test   %ebx,%ebx
+  802e16:	74 0c                	je     802e24 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e18:	89 d9                	mov    %ebx,%ecx
+  802e1a:	c1 e1 10             	shl    $0x10,%ecx
+  802e1d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e22:	29 ca                	sub    %ecx,%edx
+  802e24:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e27:	c1 e0 04             	shl    $0x4,%eax
+  802e2a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e2f:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e31:	83 ec 0c             	sub    $0xc,%esp
+  802e34:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e3b:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e3e:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e45:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e4c:	89 04 24             	mov    %eax,(%esp)
+  802e4f:	e8 25 ff ff ff       	call   802d79 <pthread_exit>
+
+00802e54 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e54:	55                   	push   %ebp
+  802e55:	89 e5                	mov    %esp,%ebp
+  802e57:	57                   	push   %edi
+  802e58:	56                   	push   %esi
+  802e59:	53                   	push   %ebx
+  802e5a:	83 ec 1c             	sub    $0x1c,%esp
+  802e5d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e5f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e6c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e71:	77 0d                	ja     802e80 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e73:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e78:	29 d0                	sub    %edx,%eax
+  802e7a:	c1 e8 10             	shr    $0x10,%eax
+  802e7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e85:	eb 2f                	jmp    802eb6 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e87:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e8d:	8b 01                	mov    (%ecx),%eax
+  802e8f:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e92:	39 c2                	cmp    %eax,%edx
+  802e94:	75 14                	jne    802eaa <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e96:	83 ec 0c             	sub    $0xc,%esp
+  802e99:	57                   	push   %edi
+  802e9a:	e8 a5 d2 ff ff       	call   800144 <sys_env_destroy>
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	85 c0                	test   %eax,%eax
+  802ea4:	0f 88 97 00 00 00    	js     802f41 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802eaa:	83 c3 01             	add    $0x1,%ebx
+  802ead:	83 fb 20             	cmp    $0x20,%ebx
+  802eb0:	0f 84 d2 00 00 00    	je     802f88 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802eb6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802eb9:	74 ef                	je     802eaa <pthread_kill_others+0x56>
+  802ebb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ebe:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ec5:	8b 40 04             	mov    0x4(%eax),%eax
+  802ec8:	83 f8 01             	cmp    $0x1,%eax
+  802ecb:	75 dd                	jne    802eaa <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802ecd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ed0:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ed7:	89 fe                	mov    %edi,%esi
+  802ed9:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802edf:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ee2:	c1 e0 04             	shl    $0x4,%eax
+  802ee5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eea:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802eed:	39 c7                	cmp    %eax,%edi
+  802eef:	75 b9                	jne    802eaa <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ef1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef4:	c1 e0 04             	shl    $0x4,%eax
+  802ef7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802efc:	8b 40 54             	mov    0x54(%eax),%eax
+  802eff:	85 c0                	test   %eax,%eax
+  802f01:	74 a7                	je     802eaa <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f03:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f06:	c1 e0 04             	shl    $0x4,%eax
+  802f09:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f0f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f11:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f17:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f1c:	0f 87 65 ff ff ff    	ja     802e87 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f22:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f27:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f29:	c1 e8 10             	shr    $0x10,%eax
+  802f2c:	0f 84 55 ff ff ff    	je     802e87 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f32:	c1 e0 10             	shl    $0x10,%eax
+  802f35:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f3a:	29 c1                	sub    %eax,%ecx
+  802f3c:	e9 4c ff ff ff       	jmp    802e8d <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f41:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f44:	c1 e2 04             	shl    $0x4,%edx
+  802f47:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f4d:	8b 52 48             	mov    0x48(%edx),%edx
+  802f50:	39 fa                	cmp    %edi,%edx
+  802f52:	0f 85 52 ff ff ff    	jne    802eaa <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f58:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f5b:	c1 e2 04             	shl    $0x4,%edx
+  802f5e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f64:	8b 52 54             	mov    0x54(%edx),%edx
+  802f67:	85 d2                	test   %edx,%edx
+  802f69:	0f 84 3b ff ff ff    	je     802eaa <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f6f:	83 ec 0c             	sub    $0xc,%esp
+  802f72:	50                   	push   %eax
+  802f73:	57                   	push   %edi
+  802f74:	68 c8 48 80 00       	push   $0x8048c8
+  802f79:	68 bb 00 00 00       	push   $0xbb
+  802f7e:	68 b8 48 80 00       	push   $0x8048b8
+  802f83:	e8 3f 02 00 00       	call   8031c7 <_panic>
+	}
+}
+  802f88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8b:	5b                   	pop    %ebx
+  802f8c:	5e                   	pop    %esi
+  802f8d:	5f                   	pop    %edi
+  802f8e:	5d                   	pop    %ebp
+  802f8f:	c3                   	ret
+
+00802f90 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f90:	55                   	push   %ebp
+  802f91:	89 e5                	mov    %esp,%ebp
+  802f93:	53                   	push   %ebx
+  802f94:	83 ec 04             	sub    $0x4,%esp
+  802f97:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f99:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f9f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fa5:	0f 87 85 00 00 00    	ja     803030 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fab:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fb0:	29 c3                	sub    %eax,%ebx
+  802fb2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fb5:	83 ec 04             	sub    $0x4,%esp
+  802fb8:	68 80 02 00 00       	push   $0x280
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	68 40 60 80 00       	push   $0x806040
+  802fc4:	e8 0e 0a 00 00       	call   8039d7 <memset>
+	threads_mu.m_state = 0;
+  802fc9:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fd0:	00 00 00 
+	if (self != 0) {
+  802fd3:	83 c4 10             	add    $0x10,%esp
+  802fd6:	85 db                	test   %ebx,%ebx
+  802fd8:	74 51                	je     80302b <pthread_fork_child+0x9b>
+  802fda:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fdc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fe2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fe7:	77 18                	ja     803001 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fe9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fee:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ff0:	c1 e8 10             	shr    $0x10,%eax
+  802ff3:	74 0c                	je     803001 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ff5:	c1 e0 10             	shl    $0x10,%eax
+  802ff8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ffd:	29 c2                	sub    %eax,%edx
+  802fff:	eb 06                	jmp    803007 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803001:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803007:	8b 02                	mov    (%edx),%eax
+  803009:	8b 48 48             	mov    0x48(%eax),%ecx
+  80300c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803013:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803016:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80301d:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803024:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80302b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80302e:	c9                   	leave
+  80302f:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803030:	83 ec 04             	sub    $0x4,%esp
+  803033:	68 80 02 00 00       	push   $0x280
+  803038:	6a 00                	push   $0x0
+  80303a:	68 40 60 80 00       	push   $0x806040
+  80303f:	e8 93 09 00 00       	call   8039d7 <memset>
+	threads_mu.m_state = 0;
+  803044:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80304b:	00 00 00 
+  80304e:	83 c4 10             	add    $0x10,%esp
+  803051:	eb d8                	jmp    80302b <pthread_fork_child+0x9b>
+
+00803053 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803053:	b8 00 00 00 00       	mov    $0x0,%eax
+  803058:	c3                   	ret
+
+00803059 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803059:	55                   	push   %ebp
+  80305a:	89 e5                	mov    %esp,%ebp
+  80305c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80305f:	68 ed 48 80 00       	push   $0x8048ed
+  803064:	ff 75 0c             	push   0xc(%ebp)
+  803067:	e8 1a 08 00 00       	call   803886 <strcpy>
+	return 0;
+}
+  80306c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803071:	c9                   	leave
+  803072:	c3                   	ret
+
+00803073 <devcons_write>:
+{
+  803073:	55                   	push   %ebp
+  803074:	89 e5                	mov    %esp,%ebp
+  803076:	57                   	push   %edi
+  803077:	56                   	push   %esi
+  803078:	53                   	push   %ebx
+  803079:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80307f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803084:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80308a:	eb 2e                	jmp    8030ba <devcons_write+0x47>
+		m = n - tot;
+  80308c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80308f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803091:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803096:	39 c3                	cmp    %eax,%ebx
+  803098:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80309b:	83 ec 04             	sub    $0x4,%esp
+  80309e:	53                   	push   %ebx
+  80309f:	89 f0                	mov    %esi,%eax
+  8030a1:	03 45 0c             	add    0xc(%ebp),%eax
+  8030a4:	50                   	push   %eax
+  8030a5:	57                   	push   %edi
+  8030a6:	e8 61 09 00 00       	call   803a0c <memmove>
+		sys_cputs(buf, m);
+  8030ab:	83 c4 08             	add    $0x8,%esp
+  8030ae:	53                   	push   %ebx
+  8030af:	57                   	push   %edi
+  8030b0:	e8 38 d0 ff ff       	call   8000ed <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030b5:	01 de                	add    %ebx,%esi
+  8030b7:	83 c4 10             	add    $0x10,%esp
+  8030ba:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030bd:	72 cd                	jb     80308c <devcons_write+0x19>
+}
+  8030bf:	89 f0                	mov    %esi,%eax
+  8030c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c4:	5b                   	pop    %ebx
+  8030c5:	5e                   	pop    %esi
+  8030c6:	5f                   	pop    %edi
+  8030c7:	5d                   	pop    %ebp
+  8030c8:	c3                   	ret
+
+008030c9 <devcons_read>:
+{
+  8030c9:	55                   	push   %ebp
+  8030ca:	89 e5                	mov    %esp,%ebp
+  8030cc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030d8:	75 07                	jne    8030e1 <devcons_read+0x18>
+  8030da:	eb 1f                	jmp    8030fb <devcons_read+0x32>
+		sys_yield();
+  8030dc:	e8 da d0 ff ff       	call   8001bb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030e1:	e8 32 d0 ff ff       	call   800118 <sys_cgetc>
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	74 f2                	je     8030dc <devcons_read+0x13>
+	if (c < 0)
+  8030ea:	78 0f                	js     8030fb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030ec:	83 f8 04             	cmp    $0x4,%eax
+  8030ef:	74 0c                	je     8030fd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030f4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030f6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030fb:	c9                   	leave
+  8030fc:	c3                   	ret
+		return 0;
+  8030fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803102:	eb f7                	jmp    8030fb <devcons_read+0x32>
+
+00803104 <cputchar>:
+{
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80310a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803110:	6a 01                	push   $0x1
+  803112:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803115:	50                   	push   %eax
+  803116:	e8 d2 cf ff ff       	call   8000ed <sys_cputs>
+}
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	c9                   	leave
+  80311f:	c3                   	ret
+
+00803120 <getchar>:
+{
+  803120:	55                   	push   %ebp
+  803121:	89 e5                	mov    %esp,%ebp
+  803123:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803126:	6a 01                	push   $0x1
+  803128:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80312b:	50                   	push   %eax
+  80312c:	6a 00                	push   $0x0
+  80312e:	e8 63 d8 ff ff       	call   800996 <read>
+	if (r < 0)
+  803133:	83 c4 10             	add    $0x10,%esp
+  803136:	85 c0                	test   %eax,%eax
+  803138:	78 06                	js     803140 <getchar+0x20>
+	if (r < 1)
+  80313a:	74 06                	je     803142 <getchar+0x22>
+	return c;
+  80313c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803140:	c9                   	leave
+  803141:	c3                   	ret
+		return -E_EOF;
+  803142:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803147:	eb f7                	jmp    803140 <getchar+0x20>
+
+00803149 <iscons>:
+{
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803152:	50                   	push   %eax
+  803153:	ff 75 08             	push   0x8(%ebp)
+  803156:	e8 ab d5 ff ff       	call   800706 <fd_lookup>
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	78 11                	js     803173 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803162:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803165:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80316b:	39 10                	cmp    %edx,(%eax)
+  80316d:	0f 94 c0             	sete   %al
+  803170:	0f b6 c0             	movzbl %al,%eax
+}
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+
+00803175 <opencons>:
+{
+  803175:	55                   	push   %ebp
+  803176:	89 e5                	mov    %esp,%ebp
+  803178:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80317b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80317e:	50                   	push   %eax
+  80317f:	e8 2c d5 ff ff       	call   8006b0 <fd_alloc>
+  803184:	83 c4 10             	add    $0x10,%esp
+  803187:	85 c0                	test   %eax,%eax
+  803189:	78 3a                	js     8031c5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	68 07 04 00 00       	push   $0x407
+  803193:	ff 75 f4             	push   -0xc(%ebp)
+  803196:	6a 00                	push   $0x0
+  803198:	e8 4a d0 ff ff       	call   8001e7 <sys_page_alloc>
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	78 21                	js     8031c5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a7:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8031ad:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031b9:	83 ec 0c             	sub    $0xc,%esp
+  8031bc:	50                   	push   %eax
+  8031bd:	e8 c7 d4 ff ff       	call   800689 <fd2num>
+  8031c2:	83 c4 10             	add    $0x10,%esp
+}
+  8031c5:	c9                   	leave
+  8031c6:	c3                   	ret
+
+008031c7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031c7:	55                   	push   %ebp
+  8031c8:	89 e5                	mov    %esp,%ebp
+  8031ca:	56                   	push   %esi
+  8031cb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031cc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031cf:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031d5:	e8 b5 cf ff ff       	call   80018f <sys_getenvid>
+  8031da:	83 ec 0c             	sub    $0xc,%esp
+  8031dd:	ff 75 0c             	push   0xc(%ebp)
+  8031e0:	ff 75 08             	push   0x8(%ebp)
+  8031e3:	56                   	push   %esi
+  8031e4:	50                   	push   %eax
+  8031e5:	68 fc 48 80 00       	push   $0x8048fc
+  8031ea:	e8 b3 00 00 00       	call   8032a2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031ef:	83 c4 18             	add    $0x18,%esp
+  8031f2:	53                   	push   %ebx
+  8031f3:	ff 75 10             	push   0x10(%ebp)
+  8031f6:	e8 56 00 00 00       	call   803251 <vcprintf>
+	cprintf("\n");
+  8031fb:	c7 04 24 d2 4d 80 00 	movl   $0x804dd2,(%esp)
+  803202:	e8 9b 00 00 00       	call   8032a2 <cprintf>
+  803207:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80320a:	cc                   	int3
+	while (1)
+  80320b:	eb fd                	jmp    80320a <_panic+0x43>
+
+0080320d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	53                   	push   %ebx
+  803211:	83 ec 04             	sub    $0x4,%esp
+  803214:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803217:	8b 13                	mov    (%ebx),%edx
+  803219:	8d 42 01             	lea    0x1(%edx),%eax
+  80321c:	89 03                	mov    %eax,(%ebx)
+  80321e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803221:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803225:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80322a:	74 09                	je     803235 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80322c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803233:	c9                   	leave
+  803234:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803235:	83 ec 08             	sub    $0x8,%esp
+  803238:	68 ff 00 00 00       	push   $0xff
+  80323d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803240:	50                   	push   %eax
+  803241:	e8 a7 ce ff ff       	call   8000ed <sys_cputs>
+		b->idx = 0;
+  803246:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80324c:	83 c4 10             	add    $0x10,%esp
+  80324f:	eb db                	jmp    80322c <putch+0x1f>
+
+00803251 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803251:	55                   	push   %ebp
+  803252:	89 e5                	mov    %esp,%ebp
+  803254:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80325a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803261:	00 00 00 
+	b.cnt = 0;
+  803264:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80326b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80326e:	ff 75 0c             	push   0xc(%ebp)
+  803271:	ff 75 08             	push   0x8(%ebp)
+  803274:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80327a:	50                   	push   %eax
+  80327b:	68 0d 32 80 00       	push   $0x80320d
+  803280:	e8 14 01 00 00       	call   803399 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803285:	83 c4 08             	add    $0x8,%esp
+  803288:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80328e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803294:	50                   	push   %eax
+  803295:	e8 53 ce ff ff       	call   8000ed <sys_cputs>
+
+	return b.cnt;
+}
+  80329a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8032a0:	c9                   	leave
+  8032a1:	c3                   	ret
+
+008032a2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8032a2:	55                   	push   %ebp
+  8032a3:	89 e5                	mov    %esp,%ebp
+  8032a5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8032a8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8032ab:	50                   	push   %eax
+  8032ac:	ff 75 08             	push   0x8(%ebp)
+  8032af:	e8 9d ff ff ff       	call   803251 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032b4:	c9                   	leave
+  8032b5:	c3                   	ret
+
+008032b6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	57                   	push   %edi
+  8032ba:	56                   	push   %esi
+  8032bb:	53                   	push   %ebx
+  8032bc:	83 ec 1c             	sub    $0x1c,%esp
+  8032bf:	89 c7                	mov    %eax,%edi
+  8032c1:	89 d6                	mov    %edx,%esi
+  8032c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032c9:	89 d1                	mov    %edx,%ecx
+  8032cb:	89 c2                	mov    %eax,%edx
+  8032cd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032d0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032d6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032dc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032e3:	39 c2                	cmp    %eax,%edx
+  8032e5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032e8:	72 3e                	jb     803328 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032ea:	83 ec 0c             	sub    $0xc,%esp
+  8032ed:	ff 75 18             	push   0x18(%ebp)
+  8032f0:	83 eb 01             	sub    $0x1,%ebx
+  8032f3:	53                   	push   %ebx
+  8032f4:	50                   	push   %eax
+  8032f5:	83 ec 08             	sub    $0x8,%esp
+  8032f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8032fb:	ff 75 e0             	push   -0x20(%ebp)
+  8032fe:	ff 75 dc             	push   -0x24(%ebp)
+  803301:	ff 75 d8             	push   -0x28(%ebp)
+  803304:	e8 47 12 00 00       	call   804550 <__udivdi3>
+  803309:	83 c4 18             	add    $0x18,%esp
+  80330c:	52                   	push   %edx
+  80330d:	50                   	push   %eax
+  80330e:	89 f2                	mov    %esi,%edx
+  803310:	89 f8                	mov    %edi,%eax
+  803312:	e8 9f ff ff ff       	call   8032b6 <printnum>
+  803317:	83 c4 20             	add    $0x20,%esp
+  80331a:	eb 13                	jmp    80332f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80331c:	83 ec 08             	sub    $0x8,%esp
+  80331f:	56                   	push   %esi
+  803320:	ff 75 18             	push   0x18(%ebp)
+  803323:	ff d7                	call   *%edi
+  803325:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803328:	83 eb 01             	sub    $0x1,%ebx
+  80332b:	85 db                	test   %ebx,%ebx
+  80332d:	7f ed                	jg     80331c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80332f:	83 ec 08             	sub    $0x8,%esp
+  803332:	56                   	push   %esi
+  803333:	83 ec 04             	sub    $0x4,%esp
+  803336:	ff 75 e4             	push   -0x1c(%ebp)
+  803339:	ff 75 e0             	push   -0x20(%ebp)
+  80333c:	ff 75 dc             	push   -0x24(%ebp)
+  80333f:	ff 75 d8             	push   -0x28(%ebp)
+  803342:	e8 2a 12 00 00       	call   804571 <__umoddi3>
+  803347:	83 c4 14             	add    $0x14,%esp
+  80334a:	0f be 80 1f 49 80 00 	movsbl 0x80491f(%eax),%eax
+  803351:	50                   	push   %eax
+  803352:	ff d7                	call   *%edi
+}
+  803354:	83 c4 10             	add    $0x10,%esp
+  803357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80335a:	5b                   	pop    %ebx
+  80335b:	5e                   	pop    %esi
+  80335c:	5f                   	pop    %edi
+  80335d:	5d                   	pop    %ebp
+  80335e:	c3                   	ret
+
+0080335f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80335f:	55                   	push   %ebp
+  803360:	89 e5                	mov    %esp,%ebp
+  803362:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803365:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803369:	8b 10                	mov    (%eax),%edx
+  80336b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80336e:	73 0a                	jae    80337a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803370:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803373:	89 08                	mov    %ecx,(%eax)
+  803375:	8b 45 08             	mov    0x8(%ebp),%eax
+  803378:	88 02                	mov    %al,(%edx)
+}
+  80337a:	5d                   	pop    %ebp
+  80337b:	c3                   	ret
+
+0080337c <printfmt>:
+{
+  80337c:	55                   	push   %ebp
+  80337d:	89 e5                	mov    %esp,%ebp
+  80337f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803382:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803385:	50                   	push   %eax
+  803386:	ff 75 10             	push   0x10(%ebp)
+  803389:	ff 75 0c             	push   0xc(%ebp)
+  80338c:	ff 75 08             	push   0x8(%ebp)
+  80338f:	e8 05 00 00 00       	call   803399 <vprintfmt>
+}
+  803394:	83 c4 10             	add    $0x10,%esp
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+
+00803399 <vprintfmt>:
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	57                   	push   %edi
+  80339d:	56                   	push   %esi
+  80339e:	53                   	push   %ebx
+  80339f:	83 ec 2c             	sub    $0x2c,%esp
+  8033a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8033a8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033ab:	eb 0a                	jmp    8033b7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033ad:	83 ec 08             	sub    $0x8,%esp
+  8033b0:	53                   	push   %ebx
+  8033b1:	50                   	push   %eax
+  8033b2:	ff d6                	call   *%esi
+  8033b4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033b7:	83 c7 01             	add    $0x1,%edi
+  8033ba:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033be:	83 f8 25             	cmp    $0x25,%eax
+  8033c1:	74 0c                	je     8033cf <vprintfmt+0x36>
+			if (ch == '\0')
+  8033c3:	85 c0                	test   %eax,%eax
+  8033c5:	75 e6                	jne    8033ad <vprintfmt+0x14>
+}
+  8033c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ca:	5b                   	pop    %ebx
+  8033cb:	5e                   	pop    %esi
+  8033cc:	5f                   	pop    %edi
+  8033cd:	5d                   	pop    %ebp
+  8033ce:	c3                   	ret
+		padc = ' ';
+  8033cf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033d3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033e1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033ed:	8d 47 01             	lea    0x1(%edi),%eax
+  8033f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033f3:	0f b6 17             	movzbl (%edi),%edx
+  8033f6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033f9:	3c 55                	cmp    $0x55,%al
+  8033fb:	0f 87 c5 03 00 00    	ja     8037c6 <vprintfmt+0x42d>
+  803401:	0f b6 c0             	movzbl %al,%eax
+  803404:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  80340b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80340e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803411:	eb da                	jmp    8033ed <vprintfmt+0x54>
+  803413:	0f be d2             	movsbl %dl,%edx
+  803416:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803421:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803424:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803428:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80342b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80342e:	83 f9 09             	cmp    $0x9,%ecx
+  803431:	77 55                	ja     803488 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803433:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803436:	eb e9                	jmp    803421 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803438:	8b 45 14             	mov    0x14(%ebp),%eax
+  80343b:	8b 00                	mov    (%eax),%eax
+  80343d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803440:	8b 45 14             	mov    0x14(%ebp),%eax
+  803443:	8d 40 04             	lea    0x4(%eax),%eax
+  803446:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803449:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80344c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803450:	79 9b                	jns    8033ed <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803452:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803455:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803458:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80345f:	eb 8c                	jmp    8033ed <vprintfmt+0x54>
+			if (width < 0)
+  803461:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803464:	85 d2                	test   %edx,%edx
+  803466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346b:	0f 49 c2             	cmovns %edx,%eax
+  80346e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  803471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803474:	e9 74 ff ff ff       	jmp    8033ed <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803479:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80347c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803483:	e9 65 ff ff ff       	jmp    8033ed <vprintfmt+0x54>
+  803488:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80348b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80348e:	eb bc                	jmp    80344c <vprintfmt+0xb3>
+			lflag++;
+  803490:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  803493:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803496:	e9 52 ff ff ff       	jmp    8033ed <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80349b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80349e:	8d 78 04             	lea    0x4(%eax),%edi
+  8034a1:	83 ec 08             	sub    $0x8,%esp
+  8034a4:	53                   	push   %ebx
+  8034a5:	ff 30                	push   (%eax)
+  8034a7:	ff d6                	call   *%esi
+			break;
+  8034a9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034ac:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034af:	e9 b1 02 00 00       	jmp    803765 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034b7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034ba:	8b 10                	mov    (%eax),%edx
+  8034bc:	89 d0                	mov    %edx,%eax
+  8034be:	f7 d8                	neg    %eax
+  8034c0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034c3:	83 f8 14             	cmp    $0x14,%eax
+  8034c6:	7f 23                	jg     8034eb <vprintfmt+0x152>
+  8034c8:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  8034cf:	85 d2                	test   %edx,%edx
+  8034d1:	74 18                	je     8034eb <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034d3:	52                   	push   %edx
+  8034d4:	68 c7 47 80 00       	push   $0x8047c7
+  8034d9:	53                   	push   %ebx
+  8034da:	56                   	push   %esi
+  8034db:	e8 9c fe ff ff       	call   80337c <printfmt>
+  8034e0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034e3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034e6:	e9 7a 02 00 00       	jmp    803765 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034eb:	50                   	push   %eax
+  8034ec:	68 37 49 80 00       	push   $0x804937
+  8034f1:	53                   	push   %ebx
+  8034f2:	56                   	push   %esi
+  8034f3:	e8 84 fe ff ff       	call   80337c <printfmt>
+  8034f8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034fb:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034fe:	e9 62 02 00 00       	jmp    803765 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803503:	8b 45 14             	mov    0x14(%ebp),%eax
+  803506:	83 c0 04             	add    $0x4,%eax
+  803509:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80350c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80350f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803511:	85 c9                	test   %ecx,%ecx
+  803513:	b8 30 49 80 00       	mov    $0x804930,%eax
+  803518:	0f 45 c1             	cmovne %ecx,%eax
+  80351b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80351e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803522:	7e 06                	jle    80352a <vprintfmt+0x191>
+  803524:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803528:	75 0b                	jne    803535 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80352a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80352d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803530:	89 75 08             	mov    %esi,0x8(%ebp)
+  803533:	eb 5c                	jmp    803591 <vprintfmt+0x1f8>
+  803535:	83 ec 08             	sub    $0x8,%esp
+  803538:	ff 75 d0             	push   -0x30(%ebp)
+  80353b:	ff 75 cc             	push   -0x34(%ebp)
+  80353e:	e8 20 03 00 00       	call   803863 <strnlen>
+  803543:	89 c2                	mov    %eax,%edx
+  803545:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803548:	29 d0                	sub    %edx,%eax
+  80354a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80354d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803551:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803554:	89 75 08             	mov    %esi,0x8(%ebp)
+  803557:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803559:	eb 0e                	jmp    803569 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80355b:	83 ec 08             	sub    $0x8,%esp
+  80355e:	53                   	push   %ebx
+  80355f:	57                   	push   %edi
+  803560:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803563:	83 ee 01             	sub    $0x1,%esi
+  803566:	83 c4 10             	add    $0x10,%esp
+  803569:	85 f6                	test   %esi,%esi
+  80356b:	7f ee                	jg     80355b <vprintfmt+0x1c2>
+  80356d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803570:	8b 75 08             	mov    0x8(%ebp),%esi
+  803573:	85 c0                	test   %eax,%eax
+  803575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357a:	0f 49 d0             	cmovns %eax,%edx
+  80357d:	29 d0                	sub    %edx,%eax
+  80357f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803582:	eb a6                	jmp    80352a <vprintfmt+0x191>
+					putch(ch, putdat);
+  803584:	83 ec 08             	sub    $0x8,%esp
+  803587:	53                   	push   %ebx
+  803588:	52                   	push   %edx
+  803589:	ff 55 08             	call   *0x8(%ebp)
+  80358c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80358f:	89 f1                	mov    %esi,%ecx
+  803591:	8d 71 01             	lea    0x1(%ecx),%esi
+  803594:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803598:	0f be d0             	movsbl %al,%edx
+  80359b:	85 d2                	test   %edx,%edx
+  80359d:	74 28                	je     8035c7 <vprintfmt+0x22e>
+  80359f:	85 ff                	test   %edi,%edi
+  8035a1:	78 05                	js     8035a8 <vprintfmt+0x20f>
+  8035a3:	83 ef 01             	sub    $0x1,%edi
+  8035a6:	78 30                	js     8035d8 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8035a8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035ac:	74 d6                	je     803584 <vprintfmt+0x1eb>
+  8035ae:	0f be c0             	movsbl %al,%eax
+  8035b1:	83 e8 20             	sub    $0x20,%eax
+  8035b4:	83 f8 5e             	cmp    $0x5e,%eax
+  8035b7:	76 cb                	jbe    803584 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035b9:	83 ec 08             	sub    $0x8,%esp
+  8035bc:	53                   	push   %ebx
+  8035bd:	6a 3f                	push   $0x3f
+  8035bf:	ff 55 08             	call   *0x8(%ebp)
+  8035c2:	83 c4 10             	add    $0x10,%esp
+  8035c5:	eb c8                	jmp    80358f <vprintfmt+0x1f6>
+  8035c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035ca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035cd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035d0:	01 d0                	add    %edx,%eax
+  8035d2:	29 c8                	sub    %ecx,%eax
+  8035d4:	89 c7                	mov    %eax,%edi
+  8035d6:	eb 13                	jmp    8035eb <vprintfmt+0x252>
+  8035d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035db:	eb ed                	jmp    8035ca <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035dd:	83 ec 08             	sub    $0x8,%esp
+  8035e0:	53                   	push   %ebx
+  8035e1:	6a 20                	push   $0x20
+  8035e3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035e5:	83 ef 01             	sub    $0x1,%edi
+  8035e8:	83 c4 10             	add    $0x10,%esp
+  8035eb:	85 ff                	test   %edi,%edi
+  8035ed:	7f ee                	jg     8035dd <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035ef:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035f5:	e9 6b 01 00 00       	jmp    803765 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035fa:	83 f9 01             	cmp    $0x1,%ecx
+  8035fd:	7f 1f                	jg     80361e <vprintfmt+0x285>
+	else if (lflag)
+  8035ff:	85 c9                	test   %ecx,%ecx
+  803601:	74 67                	je     80366a <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  803603:	8b 45 14             	mov    0x14(%ebp),%eax
+  803606:	8b 00                	mov    (%eax),%eax
+  803608:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80360b:	89 c1                	mov    %eax,%ecx
+  80360d:	c1 f9 1f             	sar    $0x1f,%ecx
+  803610:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803613:	8b 45 14             	mov    0x14(%ebp),%eax
+  803616:	8d 40 04             	lea    0x4(%eax),%eax
+  803619:	89 45 14             	mov    %eax,0x14(%ebp)
+  80361c:	eb 17                	jmp    803635 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80361e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803621:	8b 50 04             	mov    0x4(%eax),%edx
+  803624:	8b 00                	mov    (%eax),%eax
+  803626:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803629:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80362c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80362f:	8d 40 08             	lea    0x8(%eax),%eax
+  803632:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803635:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803638:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80363b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803640:	85 c9                	test   %ecx,%ecx
+  803642:	0f 89 03 01 00 00    	jns    80374b <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803648:	83 ec 08             	sub    $0x8,%esp
+  80364b:	53                   	push   %ebx
+  80364c:	6a 2d                	push   $0x2d
+  80364e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803650:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803653:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803656:	f7 da                	neg    %edx
+  803658:	83 d1 00             	adc    $0x0,%ecx
+  80365b:	f7 d9                	neg    %ecx
+  80365d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803660:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803665:	e9 e1 00 00 00       	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80366a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80366d:	8b 00                	mov    (%eax),%eax
+  80366f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803672:	89 c1                	mov    %eax,%ecx
+  803674:	c1 f9 1f             	sar    $0x1f,%ecx
+  803677:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80367a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80367d:	8d 40 04             	lea    0x4(%eax),%eax
+  803680:	89 45 14             	mov    %eax,0x14(%ebp)
+  803683:	eb b0                	jmp    803635 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803685:	83 f9 01             	cmp    $0x1,%ecx
+  803688:	7f 1e                	jg     8036a8 <vprintfmt+0x30f>
+	else if (lflag)
+  80368a:	85 c9                	test   %ecx,%ecx
+  80368c:	74 32                	je     8036c0 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80368e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803691:	8b 10                	mov    (%eax),%edx
+  803693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803698:	8d 40 04             	lea    0x4(%eax),%eax
+  80369b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80369e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8036a3:	e9 a3 00 00 00       	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ab:	8b 10                	mov    (%eax),%edx
+  8036ad:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8036b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036bb:	e9 8b 00 00 00       	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036c3:	8b 10                	mov    (%eax),%edx
+  8036c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8036cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036d5:	eb 74                	jmp    80374b <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036d7:	83 f9 01             	cmp    $0x1,%ecx
+  8036da:	7f 1b                	jg     8036f7 <vprintfmt+0x35e>
+	else if (lflag)
+  8036dc:	85 c9                	test   %ecx,%ecx
+  8036de:	74 2c                	je     80370c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036e3:	8b 10                	mov    (%eax),%edx
+  8036e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8036ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036f5:	eb 54                	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036fa:	8b 10                	mov    (%eax),%edx
+  8036fc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036ff:	8d 40 08             	lea    0x8(%eax),%eax
+  803702:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803705:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80370a:	eb 3f                	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80370c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80370f:	8b 10                	mov    (%eax),%edx
+  803711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803716:	8d 40 04             	lea    0x4(%eax),%eax
+  803719:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80371c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803721:	eb 28                	jmp    80374b <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803723:	83 ec 08             	sub    $0x8,%esp
+  803726:	53                   	push   %ebx
+  803727:	6a 30                	push   $0x30
+  803729:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80372b:	83 c4 08             	add    $0x8,%esp
+  80372e:	53                   	push   %ebx
+  80372f:	6a 78                	push   $0x78
+  803731:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803733:	8b 45 14             	mov    0x14(%ebp),%eax
+  803736:	8b 10                	mov    (%eax),%edx
+  803738:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80373d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803740:	8d 40 04             	lea    0x4(%eax),%eax
+  803743:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803746:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80374b:	83 ec 0c             	sub    $0xc,%esp
+  80374e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803752:	50                   	push   %eax
+  803753:	ff 75 e0             	push   -0x20(%ebp)
+  803756:	57                   	push   %edi
+  803757:	51                   	push   %ecx
+  803758:	52                   	push   %edx
+  803759:	89 da                	mov    %ebx,%edx
+  80375b:	89 f0                	mov    %esi,%eax
+  80375d:	e8 54 fb ff ff       	call   8032b6 <printnum>
+			break;
+  803762:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803765:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803768:	e9 4a fc ff ff       	jmp    8033b7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80376d:	83 f9 01             	cmp    $0x1,%ecx
+  803770:	7f 1b                	jg     80378d <vprintfmt+0x3f4>
+	else if (lflag)
+  803772:	85 c9                	test   %ecx,%ecx
+  803774:	74 2c                	je     8037a2 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803776:	8b 45 14             	mov    0x14(%ebp),%eax
+  803779:	8b 10                	mov    (%eax),%edx
+  80377b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803780:	8d 40 04             	lea    0x4(%eax),%eax
+  803783:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803786:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80378b:	eb be                	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80378d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803790:	8b 10                	mov    (%eax),%edx
+  803792:	8b 48 04             	mov    0x4(%eax),%ecx
+  803795:	8d 40 08             	lea    0x8(%eax),%eax
+  803798:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80379b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8037a0:	eb a9                	jmp    80374b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8037a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037a5:	8b 10                	mov    (%eax),%edx
+  8037a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8037af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037b2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037b7:	eb 92                	jmp    80374b <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037b9:	83 ec 08             	sub    $0x8,%esp
+  8037bc:	53                   	push   %ebx
+  8037bd:	6a 25                	push   $0x25
+  8037bf:	ff d6                	call   *%esi
+			break;
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	eb 9f                	jmp    803765 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037c6:	83 ec 08             	sub    $0x8,%esp
+  8037c9:	53                   	push   %ebx
+  8037ca:	6a 25                	push   $0x25
+  8037cc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037ce:	83 c4 10             	add    $0x10,%esp
+  8037d1:	89 f8                	mov    %edi,%eax
+  8037d3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037d7:	74 05                	je     8037de <vprintfmt+0x445>
+  8037d9:	83 e8 01             	sub    $0x1,%eax
+  8037dc:	eb f5                	jmp    8037d3 <vprintfmt+0x43a>
+  8037de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037e1:	eb 82                	jmp    803765 <vprintfmt+0x3cc>
+
+008037e3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037e3:	55                   	push   %ebp
+  8037e4:	89 e5                	mov    %esp,%ebp
+  8037e6:	83 ec 18             	sub    $0x18,%esp
+  8037e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037f2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037f6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803800:	85 c0                	test   %eax,%eax
+  803802:	74 26                	je     80382a <vsnprintf+0x47>
+  803804:	85 d2                	test   %edx,%edx
+  803806:	7e 22                	jle    80382a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803808:	ff 75 14             	push   0x14(%ebp)
+  80380b:	ff 75 10             	push   0x10(%ebp)
+  80380e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803811:	50                   	push   %eax
+  803812:	68 5f 33 80 00       	push   $0x80335f
+  803817:	e8 7d fb ff ff       	call   803399 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80381c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80381f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803825:	83 c4 10             	add    $0x10,%esp
+}
+  803828:	c9                   	leave
+  803829:	c3                   	ret
+		return -E_INVAL;
+  80382a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80382f:	eb f7                	jmp    803828 <vsnprintf+0x45>
+
+00803831 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803831:	55                   	push   %ebp
+  803832:	89 e5                	mov    %esp,%ebp
+  803834:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803837:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80383a:	50                   	push   %eax
+  80383b:	ff 75 10             	push   0x10(%ebp)
+  80383e:	ff 75 0c             	push   0xc(%ebp)
+  803841:	ff 75 08             	push   0x8(%ebp)
+  803844:	e8 9a ff ff ff       	call   8037e3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803849:	c9                   	leave
+  80384a:	c3                   	ret
+
+0080384b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80384b:	55                   	push   %ebp
+  80384c:	89 e5                	mov    %esp,%ebp
+  80384e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803851:	b8 00 00 00 00       	mov    $0x0,%eax
+  803856:	eb 03                	jmp    80385b <strlen+0x10>
+		n++;
+  803858:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80385b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80385f:	75 f7                	jne    803858 <strlen+0xd>
+	return n;
+}
+  803861:	5d                   	pop    %ebp
+  803862:	c3                   	ret
+
+00803863 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803863:	55                   	push   %ebp
+  803864:	89 e5                	mov    %esp,%ebp
+  803866:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803869:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80386c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803871:	eb 03                	jmp    803876 <strnlen+0x13>
+		n++;
+  803873:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803876:	39 d0                	cmp    %edx,%eax
+  803878:	74 08                	je     803882 <strnlen+0x1f>
+  80387a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80387e:	75 f3                	jne    803873 <strnlen+0x10>
+  803880:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  803882:	89 d0                	mov    %edx,%eax
+  803884:	5d                   	pop    %ebp
+  803885:	c3                   	ret
+
+00803886 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803886:	55                   	push   %ebp
+  803887:	89 e5                	mov    %esp,%ebp
+  803889:	53                   	push   %ebx
+  80388a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80388d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  803890:	b8 00 00 00 00       	mov    $0x0,%eax
+  803895:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  803899:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80389c:	83 c0 01             	add    $0x1,%eax
+  80389f:	84 d2                	test   %dl,%dl
+  8038a1:	75 f2                	jne    803895 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8038a3:	89 c8                	mov    %ecx,%eax
+  8038a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a8:	c9                   	leave
+  8038a9:	c3                   	ret
+
+008038aa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8038aa:	55                   	push   %ebp
+  8038ab:	89 e5                	mov    %esp,%ebp
+  8038ad:	53                   	push   %ebx
+  8038ae:	83 ec 10             	sub    $0x10,%esp
+  8038b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038b4:	53                   	push   %ebx
+  8038b5:	e8 91 ff ff ff       	call   80384b <strlen>
+  8038ba:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038bd:	ff 75 0c             	push   0xc(%ebp)
+  8038c0:	01 d8                	add    %ebx,%eax
+  8038c2:	50                   	push   %eax
+  8038c3:	e8 be ff ff ff       	call   803886 <strcpy>
+	return dst;
+}
+  8038c8:	89 d8                	mov    %ebx,%eax
+  8038ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038cd:	c9                   	leave
+  8038ce:	c3                   	ret
+
+008038cf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038cf:	55                   	push   %ebp
+  8038d0:	89 e5                	mov    %esp,%ebp
+  8038d2:	56                   	push   %esi
+  8038d3:	53                   	push   %ebx
+  8038d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038da:	89 f3                	mov    %esi,%ebx
+  8038dc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038df:	89 f0                	mov    %esi,%eax
+  8038e1:	eb 0f                	jmp    8038f2 <strncpy+0x23>
+		*dst++ = *src;
+  8038e3:	83 c0 01             	add    $0x1,%eax
+  8038e6:	0f b6 0a             	movzbl (%edx),%ecx
+  8038e9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038ec:	80 f9 01             	cmp    $0x1,%cl
+  8038ef:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038f2:	39 d8                	cmp    %ebx,%eax
+  8038f4:	75 ed                	jne    8038e3 <strncpy+0x14>
+	}
+	return ret;
+}
+  8038f6:	89 f0                	mov    %esi,%eax
+  8038f8:	5b                   	pop    %ebx
+  8038f9:	5e                   	pop    %esi
+  8038fa:	5d                   	pop    %ebp
+  8038fb:	c3                   	ret
+
+008038fc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038fc:	55                   	push   %ebp
+  8038fd:	89 e5                	mov    %esp,%ebp
+  8038ff:	56                   	push   %esi
+  803900:	53                   	push   %ebx
+  803901:	8b 75 08             	mov    0x8(%ebp),%esi
+  803904:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803907:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80390a:	89 f0                	mov    %esi,%eax
+  80390c:	85 d2                	test   %edx,%edx
+  80390e:	74 21                	je     803931 <strlcpy+0x35>
+  803910:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803914:	89 f2                	mov    %esi,%edx
+  803916:	eb 09                	jmp    803921 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803918:	83 c1 01             	add    $0x1,%ecx
+  80391b:	83 c2 01             	add    $0x1,%edx
+  80391e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803921:	39 c2                	cmp    %eax,%edx
+  803923:	74 09                	je     80392e <strlcpy+0x32>
+  803925:	0f b6 19             	movzbl (%ecx),%ebx
+  803928:	84 db                	test   %bl,%bl
+  80392a:	75 ec                	jne    803918 <strlcpy+0x1c>
+  80392c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80392e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803931:	29 f0                	sub    %esi,%eax
+}
+  803933:	5b                   	pop    %ebx
+  803934:	5e                   	pop    %esi
+  803935:	5d                   	pop    %ebp
+  803936:	c3                   	ret
+
+00803937 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803937:	55                   	push   %ebp
+  803938:	89 e5                	mov    %esp,%ebp
+  80393a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80393d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803940:	eb 06                	jmp    803948 <strcmp+0x11>
+		p++, q++;
+  803942:	83 c1 01             	add    $0x1,%ecx
+  803945:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803948:	0f b6 01             	movzbl (%ecx),%eax
+  80394b:	84 c0                	test   %al,%al
+  80394d:	74 04                	je     803953 <strcmp+0x1c>
+  80394f:	3a 02                	cmp    (%edx),%al
+  803951:	74 ef                	je     803942 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803953:	0f b6 c0             	movzbl %al,%eax
+  803956:	0f b6 12             	movzbl (%edx),%edx
+  803959:	29 d0                	sub    %edx,%eax
+}
+  80395b:	5d                   	pop    %ebp
+  80395c:	c3                   	ret
+
+0080395d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80395d:	55                   	push   %ebp
+  80395e:	89 e5                	mov    %esp,%ebp
+  803960:	53                   	push   %ebx
+  803961:	8b 45 08             	mov    0x8(%ebp),%eax
+  803964:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803967:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80396a:	eb 09                	jmp    803975 <strncmp+0x18>
+		n--, p++, q++;
+  80396c:	83 ea 01             	sub    $0x1,%edx
+  80396f:	83 c0 01             	add    $0x1,%eax
+  803972:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803975:	85 d2                	test   %edx,%edx
+  803977:	74 18                	je     803991 <strncmp+0x34>
+  803979:	0f b6 18             	movzbl (%eax),%ebx
+  80397c:	84 db                	test   %bl,%bl
+  80397e:	74 04                	je     803984 <strncmp+0x27>
+  803980:	3a 19                	cmp    (%ecx),%bl
+  803982:	74 e8                	je     80396c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803984:	0f b6 00             	movzbl (%eax),%eax
+  803987:	0f b6 11             	movzbl (%ecx),%edx
+  80398a:	29 d0                	sub    %edx,%eax
+}
+  80398c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398f:	c9                   	leave
+  803990:	c3                   	ret
+		return 0;
+  803991:	b8 00 00 00 00       	mov    $0x0,%eax
+  803996:	eb f4                	jmp    80398c <strncmp+0x2f>
+
+00803998 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803998:	55                   	push   %ebp
+  803999:	89 e5                	mov    %esp,%ebp
+  80399b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80399e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039a2:	eb 03                	jmp    8039a7 <strchr+0xf>
+  8039a4:	83 c0 01             	add    $0x1,%eax
+  8039a7:	0f b6 10             	movzbl (%eax),%edx
+  8039aa:	84 d2                	test   %dl,%dl
+  8039ac:	74 06                	je     8039b4 <strchr+0x1c>
+		if (*s == c)
+  8039ae:	38 ca                	cmp    %cl,%dl
+  8039b0:	75 f2                	jne    8039a4 <strchr+0xc>
+  8039b2:	eb 05                	jmp    8039b9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b9:	5d                   	pop    %ebp
+  8039ba:	c3                   	ret
+
+008039bb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039bb:	55                   	push   %ebp
+  8039bc:	89 e5                	mov    %esp,%ebp
+  8039be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039c1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039c5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039c8:	38 ca                	cmp    %cl,%dl
+  8039ca:	74 09                	je     8039d5 <strfind+0x1a>
+  8039cc:	84 d2                	test   %dl,%dl
+  8039ce:	74 05                	je     8039d5 <strfind+0x1a>
+	for (; *s; s++)
+  8039d0:	83 c0 01             	add    $0x1,%eax
+  8039d3:	eb f0                	jmp    8039c5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039d5:	5d                   	pop    %ebp
+  8039d6:	c3                   	ret
+
+008039d7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039d7:	55                   	push   %ebp
+  8039d8:	89 e5                	mov    %esp,%ebp
+  8039da:	57                   	push   %edi
+  8039db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039de:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039e1:	85 c9                	test   %ecx,%ecx
+  8039e3:	74 20                	je     803a05 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039e5:	89 f8                	mov    %edi,%eax
+  8039e7:	09 c8                	or     %ecx,%eax
+  8039e9:	a8 03                	test   $0x3,%al
+  8039eb:	75 12                	jne    8039ff <memset+0x28>
+		c &= 0xFF;
+  8039ed:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039f1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039f7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039fa:	fc                   	cld
+  8039fb:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039fd:	eb 06                	jmp    803a05 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a02:	fc                   	cld
+  803a03:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803a05:	89 f8                	mov    %edi,%eax
+  803a07:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803a0a:	c9                   	leave
+  803a0b:	c3                   	ret
+
+00803a0c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a0c:	55                   	push   %ebp
+  803a0d:	89 e5                	mov    %esp,%ebp
+  803a0f:	57                   	push   %edi
+  803a10:	56                   	push   %esi
+  803a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a14:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a17:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a1a:	39 c6                	cmp    %eax,%esi
+  803a1c:	73 32                	jae    803a50 <memmove+0x44>
+  803a1e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a21:	39 d0                	cmp    %edx,%eax
+  803a23:	73 2b                	jae    803a50 <memmove+0x44>
+		s += n;
+		d += n;
+  803a25:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a28:	89 d6                	mov    %edx,%esi
+  803a2a:	09 fe                	or     %edi,%esi
+  803a2c:	09 ce                	or     %ecx,%esi
+  803a2e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a34:	75 0e                	jne    803a44 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a36:	83 ef 04             	sub    $0x4,%edi
+  803a39:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a3c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a3f:	fd                   	std
+  803a40:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a42:	eb 09                	jmp    803a4d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a44:	83 ef 01             	sub    $0x1,%edi
+  803a47:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a4a:	fd                   	std
+  803a4b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a4d:	fc                   	cld
+  803a4e:	eb 1a                	jmp    803a6a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a50:	89 f2                	mov    %esi,%edx
+  803a52:	09 c2                	or     %eax,%edx
+  803a54:	09 ca                	or     %ecx,%edx
+  803a56:	f6 c2 03             	test   $0x3,%dl
+  803a59:	75 0a                	jne    803a65 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a5b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a5e:	89 c7                	mov    %eax,%edi
+  803a60:	fc                   	cld
+  803a61:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a63:	eb 05                	jmp    803a6a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a65:	89 c7                	mov    %eax,%edi
+  803a67:	fc                   	cld
+  803a68:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a6a:	5e                   	pop    %esi
+  803a6b:	5f                   	pop    %edi
+  803a6c:	5d                   	pop    %ebp
+  803a6d:	c3                   	ret
+
+00803a6e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a6e:	55                   	push   %ebp
+  803a6f:	89 e5                	mov    %esp,%ebp
+  803a71:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a74:	ff 75 10             	push   0x10(%ebp)
+  803a77:	ff 75 0c             	push   0xc(%ebp)
+  803a7a:	ff 75 08             	push   0x8(%ebp)
+  803a7d:	e8 8a ff ff ff       	call   803a0c <memmove>
+}
+  803a82:	c9                   	leave
+  803a83:	c3                   	ret
+
+00803a84 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a84:	55                   	push   %ebp
+  803a85:	89 e5                	mov    %esp,%ebp
+  803a87:	56                   	push   %esi
+  803a88:	53                   	push   %ebx
+  803a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a8f:	89 c6                	mov    %eax,%esi
+  803a91:	03 75 10             	add    0x10(%ebp),%esi
+  803a94:	eb 06                	jmp    803a9c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a96:	83 c0 01             	add    $0x1,%eax
+  803a99:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a9c:	39 f0                	cmp    %esi,%eax
+  803a9e:	74 14                	je     803ab4 <memcmp+0x30>
+		if (*s1 != *s2)
+  803aa0:	0f b6 08             	movzbl (%eax),%ecx
+  803aa3:	0f b6 1a             	movzbl (%edx),%ebx
+  803aa6:	38 d9                	cmp    %bl,%cl
+  803aa8:	74 ec                	je     803a96 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803aaa:	0f b6 c1             	movzbl %cl,%eax
+  803aad:	0f b6 db             	movzbl %bl,%ebx
+  803ab0:	29 d8                	sub    %ebx,%eax
+  803ab2:	eb 05                	jmp    803ab9 <memcmp+0x35>
+	}
+
+	return 0;
+  803ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab9:	5b                   	pop    %ebx
+  803aba:	5e                   	pop    %esi
+  803abb:	5d                   	pop    %ebp
+  803abc:	c3                   	ret
+
+00803abd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803abd:	55                   	push   %ebp
+  803abe:	89 e5                	mov    %esp,%ebp
+  803ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ac6:	89 c2                	mov    %eax,%edx
+  803ac8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803acb:	eb 03                	jmp    803ad0 <memfind+0x13>
+  803acd:	83 c0 01             	add    $0x1,%eax
+  803ad0:	39 d0                	cmp    %edx,%eax
+  803ad2:	73 04                	jae    803ad8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ad4:	38 08                	cmp    %cl,(%eax)
+  803ad6:	75 f5                	jne    803acd <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803ad8:	5d                   	pop    %ebp
+  803ad9:	c3                   	ret
+
+00803ada <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ada:	55                   	push   %ebp
+  803adb:	89 e5                	mov    %esp,%ebp
+  803add:	57                   	push   %edi
+  803ade:	56                   	push   %esi
+  803adf:	53                   	push   %ebx
+  803ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ae3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ae6:	eb 03                	jmp    803aeb <strtol+0x11>
+		s++;
+  803ae8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803aeb:	0f b6 02             	movzbl (%edx),%eax
+  803aee:	3c 20                	cmp    $0x20,%al
+  803af0:	74 f6                	je     803ae8 <strtol+0xe>
+  803af2:	3c 09                	cmp    $0x9,%al
+  803af4:	74 f2                	je     803ae8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803af6:	3c 2b                	cmp    $0x2b,%al
+  803af8:	74 2a                	je     803b24 <strtol+0x4a>
+	int neg = 0;
+  803afa:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803aff:	3c 2d                	cmp    $0x2d,%al
+  803b01:	74 2b                	je     803b2e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b03:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803b09:	75 0f                	jne    803b1a <strtol+0x40>
+  803b0b:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b0e:	74 28                	je     803b38 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b10:	85 db                	test   %ebx,%ebx
+  803b12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b17:	0f 44 d8             	cmove  %eax,%ebx
+  803b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b1f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b22:	eb 46                	jmp    803b6a <strtol+0x90>
+		s++;
+  803b24:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b27:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2c:	eb d5                	jmp    803b03 <strtol+0x29>
+		s++, neg = 1;
+  803b2e:	83 c2 01             	add    $0x1,%edx
+  803b31:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b36:	eb cb                	jmp    803b03 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b38:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b3c:	74 0e                	je     803b4c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b3e:	85 db                	test   %ebx,%ebx
+  803b40:	75 d8                	jne    803b1a <strtol+0x40>
+		s++, base = 8;
+  803b42:	83 c2 01             	add    $0x1,%edx
+  803b45:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b4a:	eb ce                	jmp    803b1a <strtol+0x40>
+		s += 2, base = 16;
+  803b4c:	83 c2 02             	add    $0x2,%edx
+  803b4f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b54:	eb c4                	jmp    803b1a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b56:	0f be c0             	movsbl %al,%eax
+  803b59:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b5c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b5f:	7d 3a                	jge    803b9b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b61:	83 c2 01             	add    $0x1,%edx
+  803b64:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b68:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b6a:	0f b6 02             	movzbl (%edx),%eax
+  803b6d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b70:	89 f3                	mov    %esi,%ebx
+  803b72:	80 fb 09             	cmp    $0x9,%bl
+  803b75:	76 df                	jbe    803b56 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b77:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b7a:	89 f3                	mov    %esi,%ebx
+  803b7c:	80 fb 19             	cmp    $0x19,%bl
+  803b7f:	77 08                	ja     803b89 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b81:	0f be c0             	movsbl %al,%eax
+  803b84:	83 e8 57             	sub    $0x57,%eax
+  803b87:	eb d3                	jmp    803b5c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b89:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b8c:	89 f3                	mov    %esi,%ebx
+  803b8e:	80 fb 19             	cmp    $0x19,%bl
+  803b91:	77 08                	ja     803b9b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b93:	0f be c0             	movsbl %al,%eax
+  803b96:	83 e8 37             	sub    $0x37,%eax
+  803b99:	eb c1                	jmp    803b5c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b9b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b9f:	74 05                	je     803ba6 <strtol+0xcc>
+		*endptr = (char *) s;
+  803ba1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ba4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803ba6:	89 c8                	mov    %ecx,%eax
+  803ba8:	f7 d8                	neg    %eax
+  803baa:	85 ff                	test   %edi,%edi
+  803bac:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803baf:	89 c8                	mov    %ecx,%eax
+  803bb1:	5b                   	pop    %ebx
+  803bb2:	5e                   	pop    %esi
+  803bb3:	5f                   	pop    %edi
+  803bb4:	5d                   	pop    %ebp
+  803bb5:	c3                   	ret
+
+00803bb6 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803bb6:	55                   	push   %ebp
+  803bb7:	89 e5                	mov    %esp,%ebp
+  803bb9:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bbc:	6a 00                	push   $0x0
+  803bbe:	6a 00                	push   $0x0
+  803bc0:	ff 75 08             	push   0x8(%ebp)
+  803bc3:	e8 12 ff ff ff       	call   803ada <strtol>
+}
+  803bc8:	c9                   	leave
+  803bc9:	c3                   	ret
+
+00803bca <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bca:	55                   	push   %ebp
+  803bcb:	89 e5                	mov    %esp,%ebp
+  803bcd:	57                   	push   %edi
+  803bce:	56                   	push   %esi
+  803bcf:	53                   	push   %ebx
+  803bd0:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bd3:	89 d6                	mov    %edx,%esi
+  803bd5:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bd8:	89 cf                	mov    %ecx,%edi
+  803bda:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bdd:	89 fa                	mov    %edi,%edx
+  803bdf:	80 ce 08             	or     $0x8,%dh
+  803be2:	f6 c5 08             	test   $0x8,%ch
+  803be5:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803be8:	57                   	push   %edi
+  803be9:	56                   	push   %esi
+  803bea:	50                   	push   %eax
+  803beb:	56                   	push   %esi
+  803bec:	6a 00                	push   $0x0
+  803bee:	e8 41 c6 ff ff       	call   800234 <sys_page_map>
+	if (r < 0) {
+  803bf3:	83 c4 20             	add    $0x20,%esp
+  803bf6:	85 c0                	test   %eax,%eax
+  803bf8:	78 27                	js     803c21 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bfa:	83 ec 0c             	sub    $0xc,%esp
+  803bfd:	57                   	push   %edi
+  803bfe:	56                   	push   %esi
+  803bff:	6a 00                	push   $0x0
+  803c01:	56                   	push   %esi
+  803c02:	6a 00                	push   $0x0
+  803c04:	e8 2b c6 ff ff       	call   800234 <sys_page_map>
+  803c09:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c0b:	83 c4 20             	add    $0x20,%esp
+  803c0e:	85 c0                	test   %eax,%eax
+  803c10:	78 24                	js     803c36 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c12:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c17:	89 d8                	mov    %ebx,%eax
+  803c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c1c:	5b                   	pop    %ebx
+  803c1d:	5e                   	pop    %esi
+  803c1e:	5f                   	pop    %edi
+  803c1f:	5d                   	pop    %ebp
+  803c20:	c3                   	ret
+  803c21:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c23:	83 ec 08             	sub    $0x8,%esp
+  803c26:	50                   	push   %eax
+  803c27:	68 98 4c 80 00       	push   $0x804c98
+  803c2c:	e8 71 f6 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	eb e1                	jmp    803c17 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c36:	83 ec 08             	sub    $0x8,%esp
+  803c39:	50                   	push   %eax
+  803c3a:	68 c8 4c 80 00       	push   $0x804cc8
+  803c3f:	e8 5e f6 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803c44:	83 c4 10             	add    $0x10,%esp
+  803c47:	eb ce                	jmp    803c17 <duppage_cow+0x4d>
+
+00803c49 <duppage>:
+{
+  803c49:	55                   	push   %ebp
+  803c4a:	89 e5                	mov    %esp,%ebp
+  803c4c:	53                   	push   %ebx
+  803c4d:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c50:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c53:	51                   	push   %ecx
+  803c54:	52                   	push   %edx
+  803c55:	50                   	push   %eax
+  803c56:	52                   	push   %edx
+  803c57:	6a 00                	push   $0x0
+  803c59:	e8 d6 c5 ff ff       	call   800234 <sys_page_map>
+	if (r < 0) {
+  803c5e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c61:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	78 07                	js     803c71 <duppage+0x28>
+}
+  803c6a:	89 d8                	mov    %ebx,%eax
+  803c6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c6f:	c9                   	leave
+  803c70:	c3                   	ret
+  803c71:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c73:	83 ec 08             	sub    $0x8,%esp
+  803c76:	50                   	push   %eax
+  803c77:	68 98 4c 80 00       	push   $0x804c98
+  803c7c:	e8 21 f6 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803c81:	83 c4 10             	add    $0x10,%esp
+  803c84:	eb e4                	jmp    803c6a <duppage+0x21>
+
+00803c86 <cow_copy>:
+{
+  803c86:	55                   	push   %ebp
+  803c87:	89 e5                	mov    %esp,%ebp
+  803c89:	56                   	push   %esi
+  803c8a:	53                   	push   %ebx
+  803c8b:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c8d:	83 ec 04             	sub    $0x4,%esp
+  803c90:	6a 07                	push   $0x7
+  803c92:	68 00 f0 7f 00       	push   $0x7ff000
+  803c97:	6a 00                	push   $0x0
+  803c99:	e8 49 c5 ff ff       	call   8001e7 <sys_page_alloc>
+	if (r < 0) {
+  803c9e:	83 c4 10             	add    $0x10,%esp
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	78 58                	js     803cfd <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803ca5:	83 ec 04             	sub    $0x4,%esp
+  803ca8:	68 00 10 00 00       	push   $0x1000
+  803cad:	56                   	push   %esi
+  803cae:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb3:	e8 54 fd ff ff       	call   803a0c <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cb8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cbf:	56                   	push   %esi
+  803cc0:	6a 00                	push   $0x0
+  803cc2:	68 00 f0 7f 00       	push   $0x7ff000
+  803cc7:	6a 00                	push   $0x0
+  803cc9:	e8 66 c5 ff ff       	call   800234 <sys_page_map>
+  803cce:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd0:	83 c4 20             	add    $0x20,%esp
+  803cd3:	85 c0                	test   %eax,%eax
+  803cd5:	78 3b                	js     803d12 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cd7:	83 ec 08             	sub    $0x8,%esp
+  803cda:	68 00 f0 7f 00       	push   $0x7ff000
+  803cdf:	6a 00                	push   $0x0
+  803ce1:	e8 9a c5 ff ff       	call   800280 <sys_page_unmap>
+  803ce6:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ce8:	83 c4 10             	add    $0x10,%esp
+  803ceb:	85 c0                	test   %eax,%eax
+  803ced:	78 45                	js     803d34 <cow_copy+0xae>
+	return 0;
+  803cef:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf4:	89 d8                	mov    %ebx,%eax
+  803cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cf9:	5b                   	pop    %ebx
+  803cfa:	5e                   	pop    %esi
+  803cfb:	5d                   	pop    %ebp
+  803cfc:	c3                   	ret
+  803cfd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803cff:	83 ec 08             	sub    $0x8,%esp
+  803d02:	50                   	push   %eax
+  803d03:	68 b8 4d 80 00       	push   $0x804db8
+  803d08:	e8 95 f5 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	eb e2                	jmp    803cf4 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d12:	83 ec 08             	sub    $0x8,%esp
+  803d15:	50                   	push   %eax
+  803d16:	68 d4 4d 80 00       	push   $0x804dd4
+  803d1b:	e8 82 f5 ff ff       	call   8032a2 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d20:	83 c4 08             	add    $0x8,%esp
+  803d23:	68 00 f0 7f 00       	push   $0x7ff000
+  803d28:	6a 00                	push   $0x0
+  803d2a:	e8 51 c5 ff ff       	call   800280 <sys_page_unmap>
+		return r;
+  803d2f:	83 c4 10             	add    $0x10,%esp
+  803d32:	eb c0                	jmp    803cf4 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d34:	83 ec 08             	sub    $0x8,%esp
+  803d37:	50                   	push   %eax
+  803d38:	68 f0 4c 80 00       	push   $0x804cf0
+  803d3d:	e8 60 f5 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803d42:	83 c4 10             	add    $0x10,%esp
+  803d45:	eb ad                	jmp    803cf4 <cow_copy+0x6e>
+
+00803d47 <pgfault>:
+{
+  803d47:	55                   	push   %ebp
+  803d48:	89 e5                	mov    %esp,%ebp
+  803d4a:	56                   	push   %esi
+  803d4b:	53                   	push   %ebx
+  803d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d4f:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d51:	89 d8                	mov    %ebx,%eax
+  803d53:	c1 e8 16             	shr    $0x16,%eax
+  803d56:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d5d:	89 de                	mov    %ebx,%esi
+  803d5f:	c1 ee 0c             	shr    $0xc,%esi
+  803d62:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d69:	a8 07                	test   $0x7,%al
+  803d6b:	74 3b                	je     803da8 <pgfault+0x61>
+  803d6d:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d73:	74 33                	je     803da8 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d75:	83 ec 0c             	sub    $0xc,%esp
+  803d78:	68 00 f0 bf ee       	push   $0xeebff000
+  803d7d:	e8 c5 ea ff ff       	call   802847 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d82:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d89:	83 c4 10             	add    $0x10,%esp
+  803d8c:	f6 c4 08             	test   $0x8,%ah
+  803d8f:	75 30                	jne    803dc1 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d91:	83 ec 0c             	sub    $0xc,%esp
+  803d94:	68 00 f0 bf ee       	push   $0xeebff000
+  803d99:	e8 16 eb ff ff       	call   8028b4 <mutex_unlock>
+}
+  803d9e:	83 c4 10             	add    $0x10,%esp
+  803da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da4:	5b                   	pop    %ebx
+  803da5:	5e                   	pop    %esi
+  803da6:	5d                   	pop    %ebp
+  803da7:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803da8:	83 ec 08             	sub    $0x8,%esp
+  803dab:	ff 72 28             	push   0x28(%edx)
+  803dae:	51                   	push   %ecx
+  803daf:	50                   	push   %eax
+  803db0:	68 14 4d 80 00       	push   $0x804d14
+  803db5:	6a 3f                	push   $0x3f
+  803db7:	68 ee 4d 80 00       	push   $0x804dee
+  803dbc:	e8 06 f4 ff ff       	call   8031c7 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dc1:	89 d8                	mov    %ebx,%eax
+  803dc3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dc8:	e8 b9 fe ff ff       	call   803c86 <cow_copy>
+  803dcd:	eb c2                	jmp    803d91 <pgfault+0x4a>
+
+00803dcf <cow_enable>:
+{
+  803dcf:	55                   	push   %ebp
+  803dd0:	89 e5                	mov    %esp,%ebp
+  803dd2:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dd5:	68 47 3d 80 00       	push   $0x803d47
+  803dda:	e8 28 06 00 00       	call   804407 <set_pgfault_handler>
+}
+  803ddf:	83 c4 10             	add    $0x10,%esp
+  803de2:	c9                   	leave
+  803de3:	c3                   	ret
+
+00803de4 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803de4:	55                   	push   %ebp
+  803de5:	89 e5                	mov    %esp,%ebp
+  803de7:	57                   	push   %edi
+  803de8:	56                   	push   %esi
+  803de9:	53                   	push   %ebx
+  803dea:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ded:	68 47 3d 80 00       	push   $0x803d47
+  803df2:	e8 10 06 00 00       	call   804407 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803df7:	b8 07 00 00 00       	mov    $0x7,%eax
+  803dfc:	cd 30                	int    $0x30
+  803dfe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e01:	83 c4 10             	add    $0x10,%esp
+  803e04:	85 c0                	test   %eax,%eax
+  803e06:	78 4b                	js     803e53 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e08:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e12:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e15:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e19:	0f 85 16 01 00 00    	jne    803f35 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e1f:	e8 6b c3 ff ff       	call   80018f <sys_getenvid>
+  803e24:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e29:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e2b:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e31:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e37:	77 32                	ja     803e6b <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e39:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e3e:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e40:	c1 ea 10             	shr    $0x10,%edx
+  803e43:	74 26                	je     803e6b <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e45:	c1 e2 10             	shl    $0x10,%edx
+  803e48:	89 d1                	mov    %edx,%ecx
+  803e4a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e4f:	29 ca                	sub    %ecx,%edx
+  803e51:	eb 1e                	jmp    803e71 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e53:	83 ec 08             	sub    $0x8,%esp
+  803e56:	89 c7                	mov    %eax,%edi
+  803e58:	50                   	push   %eax
+  803e59:	68 f9 4d 80 00       	push   $0x804df9
+  803e5e:	e8 3f f4 ff ff       	call   8032a2 <cprintf>
+		return eid;
+  803e63:	83 c4 10             	add    $0x10,%esp
+  803e66:	e9 6c 01 00 00       	jmp    803fd7 <fork+0x1f3>
+		return pthread_main_tls;
+  803e6b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e71:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e74:	c1 e0 04             	shl    $0x4,%eax
+  803e77:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e7c:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e7e:	e8 0d f1 ff ff       	call   802f90 <pthread_fork_child>
+		return eid;
+  803e83:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e86:	e9 4c 01 00 00       	jmp    803fd7 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e8b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e91:	89 da                	mov    %ebx,%edx
+  803e93:	89 f8                	mov    %edi,%eax
+  803e95:	e8 af fd ff ff       	call   803c49 <duppage>
+  803e9a:	85 c0                	test   %eax,%eax
+  803e9c:	79 28                	jns    803ec6 <fork+0xe2>
+  803e9e:	89 c7                	mov    %eax,%edi
+  803ea0:	e9 32 01 00 00       	jmp    803fd7 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ea5:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eab:	83 f9 05             	cmp    $0x5,%ecx
+  803eae:	75 58                	jne    803f08 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803eb0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803eb5:	89 da                	mov    %ebx,%edx
+  803eb7:	89 f8                	mov    %edi,%eax
+  803eb9:	e8 8b fd ff ff       	call   803c49 <duppage>
+  803ebe:	85 c0                	test   %eax,%eax
+  803ec0:	0f 88 0f 01 00 00    	js     803fd5 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803ec6:	83 c3 01             	add    $0x1,%ebx
+  803ec9:	39 de                	cmp    %ebx,%esi
+  803ecb:	74 54                	je     803f21 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ecd:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ed4:	f6 c1 05             	test   $0x5,%cl
+  803ed7:	74 ed                	je     803ec6 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ed9:	f6 c5 04             	test   $0x4,%ch
+  803edc:	75 ad                	jne    803e8b <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ede:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ee4:	74 bf                	je     803ea5 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ee6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803eec:	74 d8                	je     803ec6 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803eee:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ef4:	89 da                	mov    %ebx,%edx
+  803ef6:	89 f8                	mov    %edi,%eax
+  803ef8:	e8 cd fc ff ff       	call   803bca <duppage_cow>
+  803efd:	85 c0                	test   %eax,%eax
+  803eff:	79 c5                	jns    803ec6 <fork+0xe2>
+  803f01:	89 c7                	mov    %eax,%edi
+  803f03:	e9 cf 00 00 00       	jmp    803fd7 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f08:	68 44 4d 80 00       	push   $0x804d44
+  803f0d:	68 b5 47 80 00       	push   $0x8047b5
+  803f12:	68 c6 00 00 00       	push   $0xc6
+  803f17:	68 ee 4d 80 00       	push   $0x804dee
+  803f1c:	e8 a6 f2 ff ff       	call   8031c7 <_panic>
+  803f21:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f24:	83 c1 01             	add    $0x1,%ecx
+  803f27:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f2d:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f33:	74 18                	je     803f4d <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f35:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f3c:	a8 07                	test   $0x7,%al
+  803f3e:	74 e4                	je     803f24 <fork+0x140>
+  803f40:	89 cb                	mov    %ecx,%ebx
+  803f42:	c1 e3 0a             	shl    $0xa,%ebx
+  803f45:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f48:	e9 7c ff ff ff       	jmp    803ec9 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f4d:	83 ec 04             	sub    $0x4,%esp
+  803f50:	6a 07                	push   $0x7
+  803f52:	68 00 f0 bf ee       	push   $0xeebff000
+  803f57:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5a:	e8 88 c2 ff ff       	call   8001e7 <sys_page_alloc>
+  803f5f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f61:	83 c4 10             	add    $0x10,%esp
+  803f64:	85 c0                	test   %eax,%eax
+  803f66:	78 34                	js     803f9c <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f68:	83 ec 08             	sub    $0x8,%esp
+  803f6b:	68 45 44 80 00       	push   $0x804445
+  803f70:	ff 75 e4             	push   -0x1c(%ebp)
+  803f73:	e8 ec c3 ff ff       	call   800364 <sys_env_set_pgfault_upcall>
+  803f78:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7a:	83 c4 10             	add    $0x10,%esp
+  803f7d:	85 c0                	test   %eax,%eax
+  803f7f:	78 2e                	js     803faf <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f81:	83 ec 08             	sub    $0x8,%esp
+  803f84:	6a 02                	push   $0x2
+  803f86:	ff 75 e4             	push   -0x1c(%ebp)
+  803f89:	e8 3e c3 ff ff       	call   8002cc <sys_env_set_status>
+  803f8e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f90:	83 c4 10             	add    $0x10,%esp
+  803f93:	85 c0                	test   %eax,%eax
+  803f95:	78 2b                	js     803fc2 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f97:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f9a:	eb 3b                	jmp    803fd7 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f9c:	83 ec 08             	sub    $0x8,%esp
+  803f9f:	50                   	push   %eax
+  803fa0:	68 6c 4d 80 00       	push   $0x804d6c
+  803fa5:	e8 f8 f2 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803faa:	83 c4 10             	add    $0x10,%esp
+  803fad:	eb 28                	jmp    803fd7 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803faf:	83 ec 08             	sub    $0x8,%esp
+  803fb2:	50                   	push   %eax
+  803fb3:	68 94 4d 80 00       	push   $0x804d94
+  803fb8:	e8 e5 f2 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803fbd:	83 c4 10             	add    $0x10,%esp
+  803fc0:	eb 15                	jmp    803fd7 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fc2:	83 ec 08             	sub    $0x8,%esp
+  803fc5:	50                   	push   %eax
+  803fc6:	68 09 4e 80 00       	push   $0x804e09
+  803fcb:	e8 d2 f2 ff ff       	call   8032a2 <cprintf>
+		return r;
+  803fd0:	83 c4 10             	add    $0x10,%esp
+  803fd3:	eb 02                	jmp    803fd7 <fork+0x1f3>
+  803fd5:	89 c7                	mov    %eax,%edi
+}
+  803fd7:	89 f8                	mov    %edi,%eax
+  803fd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fdc:	5b                   	pop    %ebx
+  803fdd:	5e                   	pop    %esi
+  803fde:	5f                   	pop    %edi
+  803fdf:	5d                   	pop    %ebp
+  803fe0:	c3                   	ret
+
+00803fe1 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fe1:	55                   	push   %ebp
+  803fe2:	89 e5                	mov    %esp,%ebp
+  803fe4:	57                   	push   %edi
+  803fe5:	56                   	push   %esi
+  803fe6:	53                   	push   %ebx
+  803fe7:	83 ec 2c             	sub    $0x2c,%esp
+  803fea:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fec:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ff7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ffd:	77 0a                	ja     804009 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fff:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804004:	29 c3                	sub    %eax,%ebx
+  804006:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804009:	83 ec 0c             	sub    $0xc,%esp
+  80400c:	68 47 3d 80 00       	push   $0x803d47
+  804011:	e8 f1 03 00 00       	call   804407 <set_pgfault_handler>
+  804016:	b8 07 00 00 00       	mov    $0x7,%eax
+  80401b:	cd 30                	int    $0x30
+  80401d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804020:	83 c4 10             	add    $0x10,%esp
+  804023:	85 c0                	test   %eax,%eax
+  804025:	78 30                	js     804057 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804027:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80402b:	74 42                	je     80406f <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80402d:	c1 e3 10             	shl    $0x10,%ebx
+  804030:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804035:	29 d8                	sub    %ebx,%eax
+  804037:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80403a:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80403f:	29 d8                	sub    %ebx,%eax
+  804041:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804044:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80404e:	89 f7                	mov    %esi,%edi
+  804050:	89 d6                	mov    %edx,%esi
+  804052:	e9 2c 01 00 00       	jmp    804183 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804057:	83 ec 08             	sub    $0x8,%esp
+  80405a:	89 c7                	mov    %eax,%edi
+  80405c:	50                   	push   %eax
+  80405d:	68 f9 4d 80 00       	push   $0x804df9
+  804062:	e8 3b f2 ff ff       	call   8032a2 <cprintf>
+		return eid;
+  804067:	83 c4 10             	add    $0x10,%esp
+  80406a:	e9 d5 00 00 00       	jmp    804144 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80406f:	e8 1b c1 ff ff       	call   80018f <sys_getenvid>
+  804074:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804079:	89 c2                	mov    %eax,%edx
+  80407b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80407d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804083:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804088:	77 18                	ja     8040a2 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80408a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80408f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804091:	c1 e8 10             	shr    $0x10,%eax
+  804094:	74 0c                	je     8040a2 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804096:	c1 e0 10             	shl    $0x10,%eax
+  804099:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80409e:	29 c1                	sub    %eax,%ecx
+  8040a0:	eb 06                	jmp    8040a8 <sfork+0xc7>
+		return pthread_main_tls;
+  8040a2:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040a8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040ab:	c1 e0 04             	shl    $0x4,%eax
+  8040ae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040b3:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040b5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040b8:	e9 87 00 00 00       	jmp    804144 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040bd:	f6 c5 04             	test   $0x4,%ch
+  8040c0:	74 6c                	je     80412e <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040c2:	89 ca                	mov    %ecx,%edx
+  8040c4:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040ca:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040d0:	74 7c                	je     80414e <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040d2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040d8:	89 da                	mov    %ebx,%edx
+  8040da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040dd:	e8 67 fb ff ff       	call   803c49 <duppage>
+  8040e2:	85 c0                	test   %eax,%eax
+  8040e4:	0f 88 4f 01 00 00    	js     804239 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040ea:	83 c3 01             	add    $0x1,%ebx
+  8040ed:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040f0:	74 7a                	je     80416c <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040f2:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040f4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040fb:	f6 c1 01             	test   $0x1,%cl
+  8040fe:	74 ea                	je     8040ea <sfork+0x109>
+  804100:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804106:	74 e2                	je     8040ea <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804108:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80410e:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804111:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804116:	76 a5                	jbe    8040bd <sfork+0xdc>
+  804118:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80411e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804121:	39 fa                	cmp    %edi,%edx
+  804123:	73 9d                	jae    8040c2 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804125:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804128:	39 fa                	cmp    %edi,%edx
+  80412a:	72 96                	jb     8040c2 <sfork+0xe1>
+  80412c:	eb 8f                	jmp    8040bd <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80412e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804134:	89 da                	mov    %ebx,%edx
+  804136:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804139:	e8 8c fa ff ff       	call   803bca <duppage_cow>
+  80413e:	85 c0                	test   %eax,%eax
+  804140:	79 a8                	jns    8040ea <sfork+0x109>
+  804142:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804144:	89 f8                	mov    %edi,%eax
+  804146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804149:	5b                   	pop    %ebx
+  80414a:	5e                   	pop    %esi
+  80414b:	5f                   	pop    %edi
+  80414c:	5d                   	pop    %ebp
+  80414d:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80414e:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804153:	e8 2e fb ff ff       	call   803c86 <cow_copy>
+  804158:	85 c0                	test   %eax,%eax
+  80415a:	0f 88 d2 00 00 00    	js     804232 <sfork+0x251>
+				pte = uvpt[pn];
+  804160:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804167:	e9 66 ff ff ff       	jmp    8040d2 <sfork+0xf1>
+  80416c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80416f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804172:	83 c6 01             	add    $0x1,%esi
+  804175:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80417b:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804181:	74 1b                	je     80419e <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804183:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80418a:	a8 01                	test   $0x1,%al
+  80418c:	74 e4                	je     804172 <sfork+0x191>
+  80418e:	89 f3                	mov    %esi,%ebx
+  804190:	c1 e3 0a             	shl    $0xa,%ebx
+  804193:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804196:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804199:	e9 4f ff ff ff       	jmp    8040ed <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80419e:	83 ec 04             	sub    $0x4,%esp
+  8041a1:	6a 07                	push   $0x7
+  8041a3:	68 00 f0 bf ee       	push   $0xeebff000
+  8041a8:	ff 75 e0             	push   -0x20(%ebp)
+  8041ab:	e8 37 c0 ff ff       	call   8001e7 <sys_page_alloc>
+  8041b0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041b2:	83 c4 10             	add    $0x10,%esp
+  8041b5:	85 c0                	test   %eax,%eax
+  8041b7:	78 37                	js     8041f0 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041b9:	83 ec 08             	sub    $0x8,%esp
+  8041bc:	68 45 44 80 00       	push   $0x804445
+  8041c1:	ff 75 e0             	push   -0x20(%ebp)
+  8041c4:	e8 9b c1 ff ff       	call   800364 <sys_env_set_pgfault_upcall>
+  8041c9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cb:	83 c4 10             	add    $0x10,%esp
+  8041ce:	85 c0                	test   %eax,%eax
+  8041d0:	78 34                	js     804206 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041d2:	83 ec 08             	sub    $0x8,%esp
+  8041d5:	6a 02                	push   $0x2
+  8041d7:	ff 75 e0             	push   -0x20(%ebp)
+  8041da:	e8 ed c0 ff ff       	call   8002cc <sys_env_set_status>
+  8041df:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041e1:	83 c4 10             	add    $0x10,%esp
+  8041e4:	85 c0                	test   %eax,%eax
+  8041e6:	78 34                	js     80421c <sfork+0x23b>
+	return eid;
+  8041e8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041eb:	e9 54 ff ff ff       	jmp    804144 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041f0:	83 ec 08             	sub    $0x8,%esp
+  8041f3:	50                   	push   %eax
+  8041f4:	68 6c 4d 80 00       	push   $0x804d6c
+  8041f9:	e8 a4 f0 ff ff       	call   8032a2 <cprintf>
+		return r;
+  8041fe:	83 c4 10             	add    $0x10,%esp
+  804201:	e9 3e ff ff ff       	jmp    804144 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804206:	83 ec 08             	sub    $0x8,%esp
+  804209:	50                   	push   %eax
+  80420a:	68 94 4d 80 00       	push   $0x804d94
+  80420f:	e8 8e f0 ff ff       	call   8032a2 <cprintf>
+		return r;
+  804214:	83 c4 10             	add    $0x10,%esp
+  804217:	e9 28 ff ff ff       	jmp    804144 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80421c:	83 ec 08             	sub    $0x8,%esp
+  80421f:	50                   	push   %eax
+  804220:	68 09 4e 80 00       	push   $0x804e09
+  804225:	e8 78 f0 ff ff       	call   8032a2 <cprintf>
+		return r;
+  80422a:	83 c4 10             	add    $0x10,%esp
+  80422d:	e9 12 ff ff ff       	jmp    804144 <sfork+0x163>
+  804232:	89 c7                	mov    %eax,%edi
+  804234:	e9 0b ff ff ff       	jmp    804144 <sfork+0x163>
+  804239:	89 c7                	mov    %eax,%edi
+  80423b:	e9 04 ff ff ff       	jmp    804144 <sfork+0x163>
+
+00804240 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804240:	55                   	push   %ebp
+  804241:	89 e5                	mov    %esp,%ebp
+  804243:	57                   	push   %edi
+  804244:	56                   	push   %esi
+  804245:	53                   	push   %ebx
+  804246:	83 ec 18             	sub    $0x18,%esp
+  804249:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80424c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80424f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804252:	85 c0                	test   %eax,%eax
+  804254:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804259:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80425c:	50                   	push   %eax
+  80425d:	e8 7b c1 ff ff       	call   8003dd <sys_ipc_recv>
+	if (r < 0) {
+  804262:	83 c4 10             	add    $0x10,%esp
+  804265:	85 c0                	test   %eax,%eax
+  804267:	78 2b                	js     804294 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804269:	85 ff                	test   %edi,%edi
+  80426b:	74 55                	je     8042c2 <ipc_recv+0x82>
+  80426d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80426f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804275:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80427a:	77 39                	ja     8042b5 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80427c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804281:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804283:	c1 e8 10             	shr    $0x10,%eax
+  804286:	74 2d                	je     8042b5 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804288:	c1 e0 10             	shl    $0x10,%eax
+  80428b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804290:	29 c2                	sub    %eax,%edx
+  804292:	eb 27                	jmp    8042bb <ipc_recv+0x7b>
+  804294:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804296:	83 ec 08             	sub    $0x8,%esp
+  804299:	50                   	push   %eax
+  80429a:	68 27 4e 80 00       	push   $0x804e27
+  80429f:	e8 fe ef ff ff       	call   8032a2 <cprintf>
+		*from_env_store = 0;
+  8042a4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042aa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042b0:	83 c4 10             	add    $0x10,%esp
+  8042b3:	eb 77                	jmp    80432c <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042b5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042bb:	8b 02                	mov    (%edx),%eax
+  8042bd:	8b 40 78             	mov    0x78(%eax),%eax
+  8042c0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042c2:	85 f6                	test   %esi,%esi
+  8042c4:	74 34                	je     8042fa <ipc_recv+0xba>
+  8042c6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042c8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d3:	77 18                	ja     8042ed <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042da:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042dc:	c1 e8 10             	shr    $0x10,%eax
+  8042df:	74 0c                	je     8042ed <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042e1:	c1 e0 10             	shl    $0x10,%eax
+  8042e4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042e9:	29 c2                	sub    %eax,%edx
+  8042eb:	eb 06                	jmp    8042f3 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042ed:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042f3:	8b 02                	mov    (%edx),%eax
+  8042f5:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042f8:	89 06                	mov    %eax,(%esi)
+  8042fa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042fc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804302:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804307:	77 18                	ja     804321 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804309:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80430e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804310:	c1 e8 10             	shr    $0x10,%eax
+  804313:	74 0c                	je     804321 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804315:	c1 e0 10             	shl    $0x10,%eax
+  804318:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80431d:	29 c2                	sub    %eax,%edx
+  80431f:	eb 06                	jmp    804327 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804321:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804327:	8b 02                	mov    (%edx),%eax
+  804329:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80432c:	89 d8                	mov    %ebx,%eax
+  80432e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804331:	5b                   	pop    %ebx
+  804332:	5e                   	pop    %esi
+  804333:	5f                   	pop    %edi
+  804334:	5d                   	pop    %ebp
+  804335:	c3                   	ret
+
+00804336 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804336:	55                   	push   %ebp
+  804337:	89 e5                	mov    %esp,%ebp
+  804339:	57                   	push   %edi
+  80433a:	56                   	push   %esi
+  80433b:	53                   	push   %ebx
+  80433c:	83 ec 0c             	sub    $0xc,%esp
+  80433f:	8b 75 08             	mov    0x8(%ebp),%esi
+  804342:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804345:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804348:	85 db                	test   %ebx,%ebx
+  80434a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80434f:	0f 44 d8             	cmove  %eax,%ebx
+  804352:	eb 05                	jmp    804359 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804354:	e8 62 be ff ff       	call   8001bb <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804359:	57                   	push   %edi
+  80435a:	53                   	push   %ebx
+  80435b:	ff 75 0c             	push   0xc(%ebp)
+  80435e:	56                   	push   %esi
+  80435f:	e8 4c c0 ff ff       	call   8003b0 <sys_ipc_try_send>
+		if (r == 0) {
+  804364:	83 c4 10             	add    $0x10,%esp
+  804367:	85 c0                	test   %eax,%eax
+  804369:	74 19                	je     804384 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80436b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80436e:	74 e4                	je     804354 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804370:	83 ec 0c             	sub    $0xc,%esp
+  804373:	50                   	push   %eax
+  804374:	57                   	push   %edi
+  804375:	53                   	push   %ebx
+  804376:	56                   	push   %esi
+  804377:	68 40 4e 80 00       	push   $0x804e40
+  80437c:	e8 21 ef ff ff       	call   8032a2 <cprintf>
+			return;
+  804381:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804387:	5b                   	pop    %ebx
+  804388:	5e                   	pop    %esi
+  804389:	5f                   	pop    %edi
+  80438a:	5d                   	pop    %ebp
+  80438b:	c3                   	ret
+
+0080438c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80438c:	55                   	push   %ebp
+  80438d:	89 e5                	mov    %esp,%ebp
+  80438f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804392:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804397:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80439a:	c1 e0 04             	shl    $0x4,%eax
+  80439d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043a2:	8b 40 50             	mov    0x50(%eax),%eax
+  8043a5:	39 c8                	cmp    %ecx,%eax
+  8043a7:	74 12                	je     8043bb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043a9:	83 c2 01             	add    $0x1,%edx
+  8043ac:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043b2:	75 e3                	jne    804397 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b9:	eb 0e                	jmp    8043c9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043bb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043be:	c1 e0 04             	shl    $0x4,%eax
+  8043c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043c6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043c9:	5d                   	pop    %ebp
+  8043ca:	c3                   	ret
+
+008043cb <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043cb:	55                   	push   %ebp
+  8043cc:	89 e5                	mov    %esp,%ebp
+  8043ce:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043d1:	89 c2                	mov    %eax,%edx
+  8043d3:	c1 ea 16             	shr    $0x16,%edx
+  8043d6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043dd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043e2:	f6 c1 01             	test   $0x1,%cl
+  8043e5:	74 1c                	je     804403 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043e7:	c1 e8 0c             	shr    $0xc,%eax
+  8043ea:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043f1:	a8 01                	test   $0x1,%al
+  8043f3:	74 0e                	je     804403 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043f5:	c1 e8 0c             	shr    $0xc,%eax
+  8043f8:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043ff:	ef 
+  804400:	0f b7 d2             	movzwl %dx,%edx
+}
+  804403:	89 d0                	mov    %edx,%eax
+  804405:	5d                   	pop    %ebp
+  804406:	c3                   	ret
+
+00804407 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804407:	55                   	push   %ebp
+  804408:	89 e5                	mov    %esp,%ebp
+  80440a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80440d:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804414:	74 0a                	je     804420 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804416:	8b 45 08             	mov    0x8(%ebp),%eax
+  804419:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80441e:	c9                   	leave
+  80441f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804420:	83 ec 04             	sub    $0x4,%esp
+  804423:	6a 07                	push   $0x7
+  804425:	68 00 f0 bf ee       	push   $0xeebff000
+  80442a:	6a 00                	push   $0x0
+  80442c:	e8 b6 bd ff ff       	call   8001e7 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804431:	83 c4 08             	add    $0x8,%esp
+  804434:	68 45 44 80 00       	push   $0x804445
+  804439:	6a 00                	push   $0x0
+  80443b:	e8 24 bf ff ff       	call   800364 <sys_env_set_pgfault_upcall>
+  804440:	83 c4 10             	add    $0x10,%esp
+  804443:	eb d1                	jmp    804416 <set_pgfault_handler+0xf>
+
+00804445 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804445:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804446:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80444b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80444d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804450:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804454:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804458:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80445b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80445f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804461:	83 c4 08             	add    $0x8,%esp
+	popal
+  804464:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804465:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804468:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804469:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80446a:	c3                   	ret
+
+0080446b <udm>:
+  80446b:	57                   	push   %edi
+  80446c:	56                   	push   %esi
+  80446d:	53                   	push   %ebx
+  80446e:	83 ec 20             	sub    $0x20,%esp
+  804471:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804475:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804479:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80447d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804481:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804485:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804489:	89 d1                	mov    %edx,%ecx
+  80448b:	09 c1                	or     %eax,%ecx
+  80448d:	0f 84 91 00 00 00    	je     804524 <udm+0xb9>
+  804493:	b8 00 00 00 00       	mov    $0x0,%eax
+  804498:	ba 00 00 00 00       	mov    $0x0,%edx
+  80449d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044a2:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044a9:	00 
+  8044aa:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044b1:	00 
+  8044b2:	eb 08                	jmp    8044bc <udm+0x51>
+  8044b4:	83 e9 01             	sub    $0x1,%ecx
+  8044b7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044ba:	74 7c                	je     804538 <udm+0xcd>
+  8044bc:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044c0:	01 c0                	add    %eax,%eax
+  8044c2:	89 c6                	mov    %eax,%esi
+  8044c4:	89 d7                	mov    %edx,%edi
+  8044c6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044ca:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044ce:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044d1:	d3 ea                	shr    %cl,%edx
+  8044d3:	f6 c1 20             	test   $0x20,%cl
+  8044d6:	74 04                	je     8044dc <udm+0x71>
+  8044d8:	89 d0                	mov    %edx,%eax
+  8044da:	31 d2                	xor    %edx,%edx
+  8044dc:	83 e0 01             	and    $0x1,%eax
+  8044df:	89 04 24             	mov    %eax,(%esp)
+  8044e2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044e9:	00 
+  8044ea:	8b 04 24             	mov    (%esp),%eax
+  8044ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044f1:	09 f0                	or     %esi,%eax
+  8044f3:	09 fa                	or     %edi,%edx
+  8044f5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044f9:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044fd:	39 f0                	cmp    %esi,%eax
+  8044ff:	89 d3                	mov    %edx,%ebx
+  804501:	19 fb                	sbb    %edi,%ebx
+  804503:	72 af                	jb     8044b4 <udm+0x49>
+  804505:	29 f0                	sub    %esi,%eax
+  804507:	19 fa                	sbb    %edi,%edx
+  804509:	89 cf                	mov    %ecx,%edi
+  80450b:	c1 ef 05             	shr    $0x5,%edi
+  80450e:	83 e7 01             	and    $0x1,%edi
+  804511:	89 fe                	mov    %edi,%esi
+  804513:	83 f6 01             	xor    $0x1,%esi
+  804516:	d3 e6                	shl    %cl,%esi
+  804518:	d3 e7                	shl    %cl,%edi
+  80451a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80451e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804522:	eb 90                	jmp    8044b4 <udm+0x49>
+  804524:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804528:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80452c:	89 f0                	mov    %esi,%eax
+  80452e:	89 fa                	mov    %edi,%edx
+  804530:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804534:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804538:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80453c:	89 01                	mov    %eax,(%ecx)
+  80453e:	89 51 04             	mov    %edx,0x4(%ecx)
+  804541:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804545:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804549:	83 c4 20             	add    $0x20,%esp
+  80454c:	5b                   	pop    %ebx
+  80454d:	5e                   	pop    %esi
+  80454e:	5f                   	pop    %edi
+  80454f:	c3                   	ret
+
+00804550 <__udivdi3>:
+  804550:	83 ec 18             	sub    $0x18,%esp
+  804553:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804557:	50                   	push   %eax
+  804558:	ff 74 24 2c          	push   0x2c(%esp)
+  80455c:	ff 74 24 2c          	push   0x2c(%esp)
+  804560:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804564:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804568:	e8 fe fe ff ff       	call   80446b <udm>
+  80456d:	83 c4 24             	add    $0x24,%esp
+  804570:	c3                   	ret
+
+00804571 <__umoddi3>:
+  804571:	83 ec 18             	sub    $0x18,%esp
+  804574:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804578:	50                   	push   %eax
+  804579:	ff 74 24 2c          	push   0x2c(%esp)
+  80457d:	ff 74 24 2c          	push   0x2c(%esp)
+  804581:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804585:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804589:	e8 dd fe ff ff       	call   80446b <udm>
+  80458e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804592:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804596:	83 c4 24             	add    $0x24,%esp
+  804599:	c3                   	ret
+
+0080459a <__divdi3>:
+  80459a:	56                   	push   %esi
+  80459b:	53                   	push   %ebx
+  80459c:	83 ec 14             	sub    $0x14,%esp
+  80459f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045a3:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045a7:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045ab:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045af:	85 d2                	test   %edx,%edx
+  8045b1:	78 18                	js     8045cb <__divdi3+0x31>
+  8045b3:	85 db                	test   %ebx,%ebx
+  8045b5:	78 3e                	js     8045f5 <__divdi3+0x5b>
+  8045b7:	83 ec 04             	sub    $0x4,%esp
+  8045ba:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045be:	56                   	push   %esi
+  8045bf:	53                   	push   %ebx
+  8045c0:	51                   	push   %ecx
+  8045c1:	e8 a5 fe ff ff       	call   80446b <udm>
+  8045c6:	83 c4 10             	add    $0x10,%esp
+  8045c9:	eb 24                	jmp    8045ef <__divdi3+0x55>
+  8045cb:	f7 d8                	neg    %eax
+  8045cd:	83 d2 00             	adc    $0x0,%edx
+  8045d0:	f7 da                	neg    %edx
+  8045d2:	85 db                	test   %ebx,%ebx
+  8045d4:	78 3a                	js     804610 <__divdi3+0x76>
+  8045d6:	83 ec 04             	sub    $0x4,%esp
+  8045d9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045dd:	56                   	push   %esi
+  8045de:	53                   	push   %ebx
+  8045df:	51                   	push   %ecx
+  8045e0:	e8 86 fe ff ff       	call   80446b <udm>
+  8045e5:	83 c4 10             	add    $0x10,%esp
+  8045e8:	f7 d8                	neg    %eax
+  8045ea:	83 d2 00             	adc    $0x0,%edx
+  8045ed:	f7 da                	neg    %edx
+  8045ef:	83 c4 14             	add    $0x14,%esp
+  8045f2:	5b                   	pop    %ebx
+  8045f3:	5e                   	pop    %esi
+  8045f4:	c3                   	ret
+  8045f5:	83 ec 04             	sub    $0x4,%esp
+  8045f8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045fc:	56                   	push   %esi
+  8045fd:	f7 d9                	neg    %ecx
+  8045ff:	83 d3 00             	adc    $0x0,%ebx
+  804602:	f7 db                	neg    %ebx
+  804604:	53                   	push   %ebx
+  804605:	51                   	push   %ecx
+  804606:	e8 60 fe ff ff       	call   80446b <udm>
+  80460b:	83 c4 10             	add    $0x10,%esp
+  80460e:	eb d8                	jmp    8045e8 <__divdi3+0x4e>
+  804610:	83 ec 04             	sub    $0x4,%esp
+  804613:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804617:	56                   	push   %esi
+  804618:	f7 d9                	neg    %ecx
+  80461a:	83 d3 00             	adc    $0x0,%ebx
+  80461d:	f7 db                	neg    %ebx
+  80461f:	53                   	push   %ebx
+  804620:	51                   	push   %ecx
+  804621:	e8 45 fe ff ff       	call   80446b <udm>
+  804626:	83 c4 10             	add    $0x10,%esp
+  804629:	eb c4                	jmp    8045ef <__divdi3+0x55>
+
+0080462b <__moddi3>:
+  80462b:	55                   	push   %ebp
+  80462c:	57                   	push   %edi
+  80462d:	56                   	push   %esi
+  80462e:	53                   	push   %ebx
+  80462f:	83 ec 24             	sub    $0x24,%esp
+  804632:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804636:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80463a:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80463e:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804642:	85 d2                	test   %edx,%edx
+  804644:	78 3b                	js     804681 <__moddi3+0x56>
+  804646:	83 ec 04             	sub    $0x4,%esp
+  804649:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80464d:	56                   	push   %esi
+  80464e:	89 ce                	mov    %ecx,%esi
+  804650:	f7 de                	neg    %esi
+  804652:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804656:	89 de                	mov    %ebx,%esi
+  804658:	83 d6 00             	adc    $0x0,%esi
+  80465b:	f7 de                	neg    %esi
+  80465d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804661:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804665:	0f 48 f1             	cmovs  %ecx,%esi
+  804668:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80466d:	53                   	push   %ebx
+  80466e:	56                   	push   %esi
+  80466f:	e8 f7 fd ff ff       	call   80446b <udm>
+  804674:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804678:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80467c:	83 c4 10             	add    $0x10,%esp
+  80467f:	eb 47                	jmp    8046c8 <__moddi3+0x9d>
+  804681:	f7 d8                	neg    %eax
+  804683:	83 d2 00             	adc    $0x0,%edx
+  804686:	f7 da                	neg    %edx
+  804688:	83 ec 04             	sub    $0x4,%esp
+  80468b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80468f:	56                   	push   %esi
+  804690:	89 cf                	mov    %ecx,%edi
+  804692:	f7 df                	neg    %edi
+  804694:	89 de                	mov    %ebx,%esi
+  804696:	83 d6 00             	adc    $0x0,%esi
+  804699:	f7 de                	neg    %esi
+  80469b:	0f 49 cf             	cmovns %edi,%ecx
+  80469e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046a2:	0f 49 de             	cmovns %esi,%ebx
+  8046a5:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046a9:	ff 74 24 0c          	push   0xc(%esp)
+  8046ad:	ff 74 24 0c          	push   0xc(%esp)
+  8046b1:	e8 b5 fd ff ff       	call   80446b <udm>
+  8046b6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046ba:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046be:	f7 d8                	neg    %eax
+  8046c0:	83 d2 00             	adc    $0x0,%edx
+  8046c3:	f7 da                	neg    %edx
+  8046c5:	83 c4 10             	add    $0x10,%esp
+  8046c8:	83 c4 24             	add    $0x24,%esp
+  8046cb:	5b                   	pop    %ebx
+  8046cc:	5e                   	pop    %esi
+  8046cd:	5f                   	pop    %edi
+  8046ce:	5d                   	pop    %ebp
+  8046cf:	c3                   	ret
@@ -0,0 +1,9746 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 8c 0b 00 00       	call   800bcc <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800042:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800044:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80004a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80004f:	77 18                	ja     800069 <umain+0x36>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800051:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800056:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800058:	c1 e8 10             	shr    $0x10,%eax
+  80005b:	74 0c                	je     800069 <umain+0x36>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80005d:	c1 e0 10             	shl    $0x10,%eax
+  800060:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800065:	29 c2                	sub    %eax,%edx
+  800067:	eb 06                	jmp    80006f <umain+0x3c>
+		return pthread_main_tls;
+  800069:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+
+	if (thisenv == &envs[1]) {
+  80006f:	81 3a 90 00 c0 ee    	cmpl   $0xeec00090,(%edx)
+  800075:	74 2d                	je     8000a4 <umain+0x71>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  800077:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  80007c:	83 ec 04             	sub    $0x4,%esp
+  80007f:	50                   	push   %eax
+  800080:	53                   	push   %ebx
+  800081:	68 71 47 80 00       	push   $0x804771
+  800086:	e8 77 01 00 00       	call   800202 <cprintf>
+  80008b:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  80008e:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  800093:	6a 00                	push   $0x0
+  800095:	6a 00                	push   $0x0
+  800097:	6a 00                	push   $0x0
+  800099:	50                   	push   %eax
+  80009a:	e8 1d 11 00 00       	call   8011bc <ipc_send>
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb ea                	jmp    80008e <umain+0x5b>
+			ipc_recv(&who, 0, 0);
+  8000a4:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  8000a7:	83 ec 04             	sub    $0x4,%esp
+  8000aa:	6a 00                	push   $0x0
+  8000ac:	6a 00                	push   $0x0
+  8000ae:	56                   	push   %esi
+  8000af:	e8 12 10 00 00       	call   8010c6 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  8000b4:	83 c4 0c             	add    $0xc,%esp
+  8000b7:	ff 75 f4             	push   -0xc(%ebp)
+  8000ba:	53                   	push   %ebx
+  8000bb:	68 60 47 80 00       	push   $0x804760
+  8000c0:	e8 3d 01 00 00       	call   800202 <cprintf>
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	eb dd                	jmp    8000a7 <umain+0x74>
+
+008000ca <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	57                   	push   %edi
+  8000ce:	56                   	push   %esi
+  8000cf:	53                   	push   %ebx
+  8000d0:	83 ec 1c             	sub    $0x1c,%esp
+  8000d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000d9:	e8 ee 0a 00 00       	call   800bcc <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000de:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000e1:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ec:	89 c1                	mov    %eax,%ecx
+  8000ee:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000f0:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000fb:	77 16                	ja     800113 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800102:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800104:	c1 e8 10             	shr    $0x10,%eax
+  800107:	74 0a                	je     800113 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800109:	c1 e0 10             	shl    $0x10,%eax
+  80010c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800111:	29 c2                	sub    %eax,%edx
+  800113:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800116:	c1 e0 04             	shl    $0x4,%eax
+  800119:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800120:	85 db                	test   %ebx,%ebx
+  800122:	7e 07                	jle    80012b <libmain+0x61>
+		binaryname = argv[0];
+  800124:	8b 06                	mov    (%esi),%eax
+  800126:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80012b:	83 ec 08             	sub    $0x8,%esp
+  80012e:	56                   	push   %esi
+  80012f:	53                   	push   %ebx
+  800130:	e8 fe fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800135:	e8 0b 00 00 00       	call   800145 <exit>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5f                   	pop    %edi
+  800143:	5d                   	pop    %ebp
+  800144:	c3                   	ret
+
+00800145 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 5a 22 00 00       	call   8023ac <fflush>
+	pthread_kill_others();
+  800152:	e8 c5 38 00 00       	call   803a1c <pthread_kill_others>
+	close_all();
+  800157:	e8 f3 12 00 00       	call   80144f <close_all>
+	sys_env_destroy(0);
+  80015c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800163:	e8 19 0a 00 00       	call   800b81 <sys_env_destroy>
+}
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	c9                   	leave
+  80016c:	c3                   	ret
+
+0080016d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	53                   	push   %ebx
+  800171:	83 ec 04             	sub    $0x4,%esp
+  800174:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800177:	8b 13                	mov    (%ebx),%edx
+  800179:	8d 42 01             	lea    0x1(%edx),%eax
+  80017c:	89 03                	mov    %eax,(%ebx)
+  80017e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800181:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800185:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80018a:	74 09                	je     800195 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80018c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800190:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800193:	c9                   	leave
+  800194:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800195:	83 ec 08             	sub    $0x8,%esp
+  800198:	68 ff 00 00 00       	push   $0xff
+  80019d:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a0:	50                   	push   %eax
+  8001a1:	e8 84 09 00 00       	call   800b2a <sys_cputs>
+		b->idx = 0;
+  8001a6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001ac:	83 c4 10             	add    $0x10,%esp
+  8001af:	eb db                	jmp    80018c <putch+0x1f>
+
+008001b1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ba:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c1:	00 00 00 
+	b.cnt = 0;
+  8001c4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001cb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ce:	ff 75 0c             	push   0xc(%ebp)
+  8001d1:	ff 75 08             	push   0x8(%ebp)
+  8001d4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001da:	50                   	push   %eax
+  8001db:	68 6d 01 80 00       	push   $0x80016d
+  8001e0:	e8 14 01 00 00       	call   8002f9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001e5:	83 c4 08             	add    $0x8,%esp
+  8001e8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001ee:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f4:	50                   	push   %eax
+  8001f5:	e8 30 09 00 00       	call   800b2a <sys_cputs>
+
+	return b.cnt;
+}
+  8001fa:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800200:	c9                   	leave
+  800201:	c3                   	ret
+
+00800202 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800208:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80020b:	50                   	push   %eax
+  80020c:	ff 75 08             	push   0x8(%ebp)
+  80020f:	e8 9d ff ff ff       	call   8001b1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800214:	c9                   	leave
+  800215:	c3                   	ret
+
+00800216 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	57                   	push   %edi
+  80021a:	56                   	push   %esi
+  80021b:	53                   	push   %ebx
+  80021c:	83 ec 1c             	sub    $0x1c,%esp
+  80021f:	89 c7                	mov    %eax,%edi
+  800221:	89 d6                	mov    %edx,%esi
+  800223:	8b 45 08             	mov    0x8(%ebp),%eax
+  800226:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800229:	89 d1                	mov    %edx,%ecx
+  80022b:	89 c2                	mov    %eax,%edx
+  80022d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800230:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800233:	8b 45 10             	mov    0x10(%ebp),%eax
+  800236:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800239:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80023c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800243:	39 c2                	cmp    %eax,%edx
+  800245:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800248:	72 3e                	jb     800288 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024a:	83 ec 0c             	sub    $0xc,%esp
+  80024d:	ff 75 18             	push   0x18(%ebp)
+  800250:	83 eb 01             	sub    $0x1,%ebx
+  800253:	53                   	push   %ebx
+  800254:	50                   	push   %eax
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	ff 75 e4             	push   -0x1c(%ebp)
+  80025b:	ff 75 e0             	push   -0x20(%ebp)
+  80025e:	ff 75 dc             	push   -0x24(%ebp)
+  800261:	ff 75 d8             	push   -0x28(%ebp)
+  800264:	e8 67 43 00 00       	call   8045d0 <__udivdi3>
+  800269:	83 c4 18             	add    $0x18,%esp
+  80026c:	52                   	push   %edx
+  80026d:	50                   	push   %eax
+  80026e:	89 f2                	mov    %esi,%edx
+  800270:	89 f8                	mov    %edi,%eax
+  800272:	e8 9f ff ff ff       	call   800216 <printnum>
+  800277:	83 c4 20             	add    $0x20,%esp
+  80027a:	eb 13                	jmp    80028f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80027c:	83 ec 08             	sub    $0x8,%esp
+  80027f:	56                   	push   %esi
+  800280:	ff 75 18             	push   0x18(%ebp)
+  800283:	ff d7                	call   *%edi
+  800285:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800288:	83 eb 01             	sub    $0x1,%ebx
+  80028b:	85 db                	test   %ebx,%ebx
+  80028d:	7f ed                	jg     80027c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80028f:	83 ec 08             	sub    $0x8,%esp
+  800292:	56                   	push   %esi
+  800293:	83 ec 04             	sub    $0x4,%esp
+  800296:	ff 75 e4             	push   -0x1c(%ebp)
+  800299:	ff 75 e0             	push   -0x20(%ebp)
+  80029c:	ff 75 dc             	push   -0x24(%ebp)
+  80029f:	ff 75 d8             	push   -0x28(%ebp)
+  8002a2:	e8 4a 43 00 00       	call   8045f1 <__umoddi3>
+  8002a7:	83 c4 14             	add    $0x14,%esp
+  8002aa:	0f be 80 92 47 80 00 	movsbl 0x804792(%eax),%eax
+  8002b1:	50                   	push   %eax
+  8002b2:	ff d7                	call   *%edi
+}
+  8002b4:	83 c4 10             	add    $0x10,%esp
+  8002b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+
+008002bf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002c9:	8b 10                	mov    (%eax),%edx
+  8002cb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002ce:	73 0a                	jae    8002da <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d3:	89 08                	mov    %ecx,(%eax)
+  8002d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d8:	88 02                	mov    %al,(%edx)
+}
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+
+008002dc <printfmt>:
+{
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e5:	50                   	push   %eax
+  8002e6:	ff 75 10             	push   0x10(%ebp)
+  8002e9:	ff 75 0c             	push   0xc(%ebp)
+  8002ec:	ff 75 08             	push   0x8(%ebp)
+  8002ef:	e8 05 00 00 00       	call   8002f9 <vprintfmt>
+}
+  8002f4:	83 c4 10             	add    $0x10,%esp
+  8002f7:	c9                   	leave
+  8002f8:	c3                   	ret
+
+008002f9 <vprintfmt>:
+{
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	57                   	push   %edi
+  8002fd:	56                   	push   %esi
+  8002fe:	53                   	push   %ebx
+  8002ff:	83 ec 2c             	sub    $0x2c,%esp
+  800302:	8b 75 08             	mov    0x8(%ebp),%esi
+  800305:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800308:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80030b:	eb 0a                	jmp    800317 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80030d:	83 ec 08             	sub    $0x8,%esp
+  800310:	53                   	push   %ebx
+  800311:	50                   	push   %eax
+  800312:	ff d6                	call   *%esi
+  800314:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800317:	83 c7 01             	add    $0x1,%edi
+  80031a:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80031e:	83 f8 25             	cmp    $0x25,%eax
+  800321:	74 0c                	je     80032f <vprintfmt+0x36>
+			if (ch == '\0')
+  800323:	85 c0                	test   %eax,%eax
+  800325:	75 e6                	jne    80030d <vprintfmt+0x14>
+}
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+		padc = ' ';
+  80032f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800333:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80033a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800341:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800348:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80034d:	8d 47 01             	lea    0x1(%edi),%eax
+  800350:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800353:	0f b6 17             	movzbl (%edi),%edx
+  800356:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800359:	3c 55                	cmp    $0x55,%al
+  80035b:	0f 87 c5 03 00 00    	ja     800726 <vprintfmt+0x42d>
+  800361:	0f b6 c0             	movzbl %al,%eax
+  800364:	ff 24 85 20 49 80 00 	jmp    *0x804920(,%eax,4)
+  80036b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80036e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800371:	eb da                	jmp    80034d <vprintfmt+0x54>
+  800373:	0f be d2             	movsbl %dl,%edx
+  800376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800381:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800384:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800388:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80038b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80038e:	83 f9 09             	cmp    $0x9,%ecx
+  800391:	77 55                	ja     8003e8 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800393:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800396:	eb e9                	jmp    800381 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800398:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039b:	8b 00                	mov    (%eax),%eax
+  80039d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b0:	79 9b                	jns    80034d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003bf:	eb 8c                	jmp    80034d <vprintfmt+0x54>
+			if (width < 0)
+  8003c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c4:	85 d2                	test   %edx,%edx
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	0f 49 c2             	cmovns %edx,%eax
+  8003ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d4:	e9 74 ff ff ff       	jmp    80034d <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003dc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003e3:	e9 65 ff ff ff       	jmp    80034d <vprintfmt+0x54>
+  8003e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ee:	eb bc                	jmp    8003ac <vprintfmt+0xb3>
+			lflag++;
+  8003f0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f6:	e9 52 ff ff ff       	jmp    80034d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fe:	8d 78 04             	lea    0x4(%eax),%edi
+  800401:	83 ec 08             	sub    $0x8,%esp
+  800404:	53                   	push   %ebx
+  800405:	ff 30                	push   (%eax)
+  800407:	ff d6                	call   *%esi
+			break;
+  800409:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80040c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040f:	e9 b1 02 00 00       	jmp    8006c5 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80041a:	8b 10                	mov    (%eax),%edx
+  80041c:	89 d0                	mov    %edx,%eax
+  80041e:	f7 d8                	neg    %eax
+  800420:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800423:	83 f8 14             	cmp    $0x14,%eax
+  800426:	7f 23                	jg     80044b <vprintfmt+0x152>
+  800428:	8b 14 85 80 4a 80 00 	mov    0x804a80(,%eax,4),%edx
+  80042f:	85 d2                	test   %edx,%edx
+  800431:	74 18                	je     80044b <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800433:	52                   	push   %edx
+  800434:	68 43 4c 80 00       	push   $0x804c43
+  800439:	53                   	push   %ebx
+  80043a:	56                   	push   %esi
+  80043b:	e8 9c fe ff ff       	call   8002dc <printfmt>
+  800440:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800443:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800446:	e9 7a 02 00 00       	jmp    8006c5 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80044b:	50                   	push   %eax
+  80044c:	68 aa 47 80 00       	push   $0x8047aa
+  800451:	53                   	push   %ebx
+  800452:	56                   	push   %esi
+  800453:	e8 84 fe ff ff       	call   8002dc <printfmt>
+  800458:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80045e:	e9 62 02 00 00       	jmp    8006c5 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	83 c0 04             	add    $0x4,%eax
+  800469:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800471:	85 c9                	test   %ecx,%ecx
+  800473:	b8 a3 47 80 00       	mov    $0x8047a3,%eax
+  800478:	0f 45 c1             	cmovne %ecx,%eax
+  80047b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80047e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800482:	7e 06                	jle    80048a <vprintfmt+0x191>
+  800484:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800488:	75 0b                	jne    800495 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80048a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80048d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800490:	89 75 08             	mov    %esi,0x8(%ebp)
+  800493:	eb 5c                	jmp    8004f1 <vprintfmt+0x1f8>
+  800495:	83 ec 08             	sub    $0x8,%esp
+  800498:	ff 75 d0             	push   -0x30(%ebp)
+  80049b:	ff 75 cc             	push   -0x34(%ebp)
+  80049e:	e8 20 03 00 00       	call   8007c3 <strnlen>
+  8004a3:	89 c2                	mov    %eax,%edx
+  8004a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a8:	29 d0                	sub    %edx,%eax
+  8004aa:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004ad:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b9:	eb 0e                	jmp    8004c9 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	53                   	push   %ebx
+  8004bf:	57                   	push   %edi
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c3:	83 ee 01             	sub    $0x1,%esi
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	85 f6                	test   %esi,%esi
+  8004cb:	7f ee                	jg     8004bb <vprintfmt+0x1c2>
+  8004cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d3:	85 c0                	test   %eax,%eax
+  8004d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004da:	0f 49 d0             	cmovns %eax,%edx
+  8004dd:	29 d0                	sub    %edx,%eax
+  8004df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e2:	eb a6                	jmp    80048a <vprintfmt+0x191>
+					putch(ch, putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	53                   	push   %ebx
+  8004e8:	52                   	push   %edx
+  8004e9:	ff 55 08             	call   *0x8(%ebp)
+  8004ec:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ef:	89 f1                	mov    %esi,%ecx
+  8004f1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f8:	0f be d0             	movsbl %al,%edx
+  8004fb:	85 d2                	test   %edx,%edx
+  8004fd:	74 28                	je     800527 <vprintfmt+0x22e>
+  8004ff:	85 ff                	test   %edi,%edi
+  800501:	78 05                	js     800508 <vprintfmt+0x20f>
+  800503:	83 ef 01             	sub    $0x1,%edi
+  800506:	78 30                	js     800538 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800508:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050c:	74 d6                	je     8004e4 <vprintfmt+0x1eb>
+  80050e:	0f be c0             	movsbl %al,%eax
+  800511:	83 e8 20             	sub    $0x20,%eax
+  800514:	83 f8 5e             	cmp    $0x5e,%eax
+  800517:	76 cb                	jbe    8004e4 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	6a 3f                	push   $0x3f
+  80051f:	ff 55 08             	call   *0x8(%ebp)
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	eb c8                	jmp    8004ef <vprintfmt+0x1f6>
+  800527:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80052d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800530:	01 d0                	add    %edx,%eax
+  800532:	29 c8                	sub    %ecx,%eax
+  800534:	89 c7                	mov    %eax,%edi
+  800536:	eb 13                	jmp    80054b <vprintfmt+0x252>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	eb ed                	jmp    80052a <vprintfmt+0x231>
+				putch(' ', putdat);
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 20                	push   $0x20
+  800543:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800545:	83 ef 01             	sub    $0x1,%edi
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	85 ff                	test   %edi,%edi
+  80054d:	7f ee                	jg     80053d <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+  800555:	e9 6b 01 00 00       	jmp    8006c5 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80055a:	83 f9 01             	cmp    $0x1,%ecx
+  80055d:	7f 1f                	jg     80057e <vprintfmt+0x285>
+	else if (lflag)
+  80055f:	85 c9                	test   %ecx,%ecx
+  800561:	74 67                	je     8005ca <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 00                	mov    (%eax),%eax
+  800568:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056b:	89 c1                	mov    %eax,%ecx
+  80056d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800570:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	eb 17                	jmp    800595 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 50 04             	mov    0x4(%eax),%edx
+  800584:	8b 00                	mov    (%eax),%eax
+  800586:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800589:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8d 40 08             	lea    0x8(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800595:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800598:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80059b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005a0:	85 c9                	test   %ecx,%ecx
+  8005a2:	0f 89 03 01 00 00    	jns    8006ab <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	53                   	push   %ebx
+  8005ac:	6a 2d                	push   $0x2d
+  8005ae:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b6:	f7 da                	neg    %edx
+  8005b8:	83 d1 00             	adc    $0x0,%ecx
+  8005bb:	f7 d9                	neg    %ecx
+  8005bd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c5:	e9 e1 00 00 00       	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 00                	mov    (%eax),%eax
+  8005cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d2:	89 c1                	mov    %eax,%ecx
+  8005d4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e3:	eb b0                	jmp    800595 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8005e5:	83 f9 01             	cmp    $0x1,%ecx
+  8005e8:	7f 1e                	jg     800608 <vprintfmt+0x30f>
+	else if (lflag)
+  8005ea:	85 c9                	test   %ecx,%ecx
+  8005ec:	74 32                	je     800620 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800603:	e9 a3 00 00 00       	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800610:	8d 40 08             	lea    0x8(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800616:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80061b:	e9 8b 00 00 00       	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800635:	eb 74                	jmp    8006ab <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800637:	83 f9 01             	cmp    $0x1,%ecx
+  80063a:	7f 1b                	jg     800657 <vprintfmt+0x35e>
+	else if (lflag)
+  80063c:	85 c9                	test   %ecx,%ecx
+  80063e:	74 2c                	je     80066c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800650:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800655:	eb 54                	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065f:	8d 40 08             	lea    0x8(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800665:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80066a:	eb 3f                	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800681:	eb 28                	jmp    8006ab <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 30                	push   $0x30
+  800689:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80068b:	83 c4 08             	add    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 78                	push   $0x78
+  800691:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80069d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006ab:	83 ec 0c             	sub    $0xc,%esp
+  8006ae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b2:	50                   	push   %eax
+  8006b3:	ff 75 e0             	push   -0x20(%ebp)
+  8006b6:	57                   	push   %edi
+  8006b7:	51                   	push   %ecx
+  8006b8:	52                   	push   %edx
+  8006b9:	89 da                	mov    %ebx,%edx
+  8006bb:	89 f0                	mov    %esi,%eax
+  8006bd:	e8 54 fb ff ff       	call   800216 <printnum>
+			break;
+  8006c2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006c8:	e9 4a fc ff ff       	jmp    800317 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006cd:	83 f9 01             	cmp    $0x1,%ecx
+  8006d0:	7f 1b                	jg     8006ed <vprintfmt+0x3f4>
+	else if (lflag)
+  8006d2:	85 c9                	test   %ecx,%ecx
+  8006d4:	74 2c                	je     800702 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006eb:	eb be                	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800700:	eb a9                	jmp    8006ab <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800712:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800717:	eb 92                	jmp    8006ab <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800719:	83 ec 08             	sub    $0x8,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	6a 25                	push   $0x25
+  80071f:	ff d6                	call   *%esi
+			break;
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	eb 9f                	jmp    8006c5 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 25                	push   $0x25
+  80072c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	89 f8                	mov    %edi,%eax
+  800733:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800737:	74 05                	je     80073e <vprintfmt+0x445>
+  800739:	83 e8 01             	sub    $0x1,%eax
+  80073c:	eb f5                	jmp    800733 <vprintfmt+0x43a>
+  80073e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800741:	eb 82                	jmp    8006c5 <vprintfmt+0x3cc>
+
+00800743 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	83 ec 18             	sub    $0x18,%esp
+  800749:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800752:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800756:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800759:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800760:	85 c0                	test   %eax,%eax
+  800762:	74 26                	je     80078a <vsnprintf+0x47>
+  800764:	85 d2                	test   %edx,%edx
+  800766:	7e 22                	jle    80078a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800768:	ff 75 14             	push   0x14(%ebp)
+  80076b:	ff 75 10             	push   0x10(%ebp)
+  80076e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800771:	50                   	push   %eax
+  800772:	68 bf 02 80 00       	push   $0x8002bf
+  800777:	e8 7d fb ff ff       	call   8002f9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80077c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800785:	83 c4 10             	add    $0x10,%esp
+}
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+		return -E_INVAL;
+  80078a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078f:	eb f7                	jmp    800788 <vsnprintf+0x45>
+
+00800791 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800797:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80079a:	50                   	push   %eax
+  80079b:	ff 75 10             	push   0x10(%ebp)
+  80079e:	ff 75 0c             	push   0xc(%ebp)
+  8007a1:	ff 75 08             	push   0x8(%ebp)
+  8007a4:	e8 9a ff ff ff       	call   800743 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+008007ab <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b6:	eb 03                	jmp    8007bb <strlen+0x10>
+		n++;
+  8007b8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007bb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007bf:	75 f7                	jne    8007b8 <strlen+0xd>
+	return n;
+}
+  8007c1:	5d                   	pop    %ebp
+  8007c2:	c3                   	ret
+
+008007c3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb 03                	jmp    8007d6 <strnlen+0x13>
+		n++;
+  8007d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d6:	39 d0                	cmp    %edx,%eax
+  8007d8:	74 08                	je     8007e2 <strnlen+0x1f>
+  8007da:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007de:	75 f3                	jne    8007d3 <strnlen+0x10>
+  8007e0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007e2:	89 d0                	mov    %edx,%eax
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+
+008007e6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007fc:	83 c0 01             	add    $0x1,%eax
+  8007ff:	84 d2                	test   %dl,%dl
+  800801:	75 f2                	jne    8007f5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800803:	89 c8                	mov    %ecx,%eax
+  800805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800808:	c9                   	leave
+  800809:	c3                   	ret
+
+0080080a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	83 ec 10             	sub    $0x10,%esp
+  800811:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800814:	53                   	push   %ebx
+  800815:	e8 91 ff ff ff       	call   8007ab <strlen>
+  80081a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80081d:	ff 75 0c             	push   0xc(%ebp)
+  800820:	01 d8                	add    %ebx,%eax
+  800822:	50                   	push   %eax
+  800823:	e8 be ff ff ff       	call   8007e6 <strcpy>
+	return dst;
+}
+  800828:	89 d8                	mov    %ebx,%eax
+  80082a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082d:	c9                   	leave
+  80082e:	c3                   	ret
+
+0080082f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	56                   	push   %esi
+  800833:	53                   	push   %ebx
+  800834:	8b 75 08             	mov    0x8(%ebp),%esi
+  800837:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80083a:	89 f3                	mov    %esi,%ebx
+  80083c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083f:	89 f0                	mov    %esi,%eax
+  800841:	eb 0f                	jmp    800852 <strncpy+0x23>
+		*dst++ = *src;
+  800843:	83 c0 01             	add    $0x1,%eax
+  800846:	0f b6 0a             	movzbl (%edx),%ecx
+  800849:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80084c:	80 f9 01             	cmp    $0x1,%cl
+  80084f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800852:	39 d8                	cmp    %ebx,%eax
+  800854:	75 ed                	jne    800843 <strncpy+0x14>
+	}
+	return ret;
+}
+  800856:	89 f0                	mov    %esi,%eax
+  800858:	5b                   	pop    %ebx
+  800859:	5e                   	pop    %esi
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+
+0080085c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	56                   	push   %esi
+  800860:	53                   	push   %ebx
+  800861:	8b 75 08             	mov    0x8(%ebp),%esi
+  800864:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800867:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80086a:	89 f0                	mov    %esi,%eax
+  80086c:	85 d2                	test   %edx,%edx
+  80086e:	74 21                	je     800891 <strlcpy+0x35>
+  800870:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800874:	89 f2                	mov    %esi,%edx
+  800876:	eb 09                	jmp    800881 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800878:	83 c1 01             	add    $0x1,%ecx
+  80087b:	83 c2 01             	add    $0x1,%edx
+  80087e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800881:	39 c2                	cmp    %eax,%edx
+  800883:	74 09                	je     80088e <strlcpy+0x32>
+  800885:	0f b6 19             	movzbl (%ecx),%ebx
+  800888:	84 db                	test   %bl,%bl
+  80088a:	75 ec                	jne    800878 <strlcpy+0x1c>
+  80088c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80088e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800891:	29 f0                	sub    %esi,%eax
+}
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+
+00800897 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80089d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008a0:	eb 06                	jmp    8008a8 <strcmp+0x11>
+		p++, q++;
+  8008a2:	83 c1 01             	add    $0x1,%ecx
+  8008a5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a8:	0f b6 01             	movzbl (%ecx),%eax
+  8008ab:	84 c0                	test   %al,%al
+  8008ad:	74 04                	je     8008b3 <strcmp+0x1c>
+  8008af:	3a 02                	cmp    (%edx),%al
+  8008b1:	74 ef                	je     8008a2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008b3:	0f b6 c0             	movzbl %al,%eax
+  8008b6:	0f b6 12             	movzbl (%edx),%edx
+  8008b9:	29 d0                	sub    %edx,%eax
+}
+  8008bb:	5d                   	pop    %ebp
+  8008bc:	c3                   	ret
+
+008008bd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	53                   	push   %ebx
+  8008c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ca:	eb 09                	jmp    8008d5 <strncmp+0x18>
+		n--, p++, q++;
+  8008cc:	83 ea 01             	sub    $0x1,%edx
+  8008cf:	83 c0 01             	add    $0x1,%eax
+  8008d2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d5:	85 d2                	test   %edx,%edx
+  8008d7:	74 18                	je     8008f1 <strncmp+0x34>
+  8008d9:	0f b6 18             	movzbl (%eax),%ebx
+  8008dc:	84 db                	test   %bl,%bl
+  8008de:	74 04                	je     8008e4 <strncmp+0x27>
+  8008e0:	3a 19                	cmp    (%ecx),%bl
+  8008e2:	74 e8                	je     8008cc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e4:	0f b6 00             	movzbl (%eax),%eax
+  8008e7:	0f b6 11             	movzbl (%ecx),%edx
+  8008ea:	29 d0                	sub    %edx,%eax
+}
+  8008ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ef:	c9                   	leave
+  8008f0:	c3                   	ret
+		return 0;
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	eb f4                	jmp    8008ec <strncmp+0x2f>
+
+008008f8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800902:	eb 03                	jmp    800907 <strchr+0xf>
+  800904:	83 c0 01             	add    $0x1,%eax
+  800907:	0f b6 10             	movzbl (%eax),%edx
+  80090a:	84 d2                	test   %dl,%dl
+  80090c:	74 06                	je     800914 <strchr+0x1c>
+		if (*s == c)
+  80090e:	38 ca                	cmp    %cl,%dl
+  800910:	75 f2                	jne    800904 <strchr+0xc>
+  800912:	eb 05                	jmp    800919 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800914:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+
+0080091b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800921:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800925:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800928:	38 ca                	cmp    %cl,%dl
+  80092a:	74 09                	je     800935 <strfind+0x1a>
+  80092c:	84 d2                	test   %dl,%dl
+  80092e:	74 05                	je     800935 <strfind+0x1a>
+	for (; *s; s++)
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	eb f0                	jmp    800925 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800935:	5d                   	pop    %ebp
+  800936:	c3                   	ret
+
+00800937 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	57                   	push   %edi
+  80093b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80093e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800941:	85 c9                	test   %ecx,%ecx
+  800943:	74 20                	je     800965 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800945:	89 f8                	mov    %edi,%eax
+  800947:	09 c8                	or     %ecx,%eax
+  800949:	a8 03                	test   $0x3,%al
+  80094b:	75 12                	jne    80095f <memset+0x28>
+		c &= 0xFF;
+  80094d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800951:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800957:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80095a:	fc                   	cld
+  80095b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80095d:	eb 06                	jmp    800965 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800962:	fc                   	cld
+  800963:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800965:	89 f8                	mov    %edi,%eax
+  800967:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80096a:	c9                   	leave
+  80096b:	c3                   	ret
+
+0080096c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80096c:	55                   	push   %ebp
+  80096d:	89 e5                	mov    %esp,%ebp
+  80096f:	57                   	push   %edi
+  800970:	56                   	push   %esi
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800977:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80097a:	39 c6                	cmp    %eax,%esi
+  80097c:	73 32                	jae    8009b0 <memmove+0x44>
+  80097e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800981:	39 d0                	cmp    %edx,%eax
+  800983:	73 2b                	jae    8009b0 <memmove+0x44>
+		s += n;
+		d += n;
+  800985:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800988:	89 d6                	mov    %edx,%esi
+  80098a:	09 fe                	or     %edi,%esi
+  80098c:	09 ce                	or     %ecx,%esi
+  80098e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800994:	75 0e                	jne    8009a4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800996:	83 ef 04             	sub    $0x4,%edi
+  800999:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80099c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099f:	fd                   	std
+  8009a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a2:	eb 09                	jmp    8009ad <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a4:	83 ef 01             	sub    $0x1,%edi
+  8009a7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009aa:	fd                   	std
+  8009ab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009ad:	fc                   	cld
+  8009ae:	eb 1a                	jmp    8009ca <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b0:	89 f2                	mov    %esi,%edx
+  8009b2:	09 c2                	or     %eax,%edx
+  8009b4:	09 ca                	or     %ecx,%edx
+  8009b6:	f6 c2 03             	test   $0x3,%dl
+  8009b9:	75 0a                	jne    8009c5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009bb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009be:	89 c7                	mov    %eax,%edi
+  8009c0:	fc                   	cld
+  8009c1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c3:	eb 05                	jmp    8009ca <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c5:	89 c7                	mov    %eax,%edi
+  8009c7:	fc                   	cld
+  8009c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ca:	5e                   	pop    %esi
+  8009cb:	5f                   	pop    %edi
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d4:	ff 75 10             	push   0x10(%ebp)
+  8009d7:	ff 75 0c             	push   0xc(%ebp)
+  8009da:	ff 75 08             	push   0x8(%ebp)
+  8009dd:	e8 8a ff ff ff       	call   80096c <memmove>
+}
+  8009e2:	c9                   	leave
+  8009e3:	c3                   	ret
+
+008009e4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e4:	55                   	push   %ebp
+  8009e5:	89 e5                	mov    %esp,%ebp
+  8009e7:	56                   	push   %esi
+  8009e8:	53                   	push   %ebx
+  8009e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ef:	89 c6                	mov    %eax,%esi
+  8009f1:	03 75 10             	add    0x10(%ebp),%esi
+  8009f4:	eb 06                	jmp    8009fc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f6:	83 c0 01             	add    $0x1,%eax
+  8009f9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009fc:	39 f0                	cmp    %esi,%eax
+  8009fe:	74 14                	je     800a14 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a00:	0f b6 08             	movzbl (%eax),%ecx
+  800a03:	0f b6 1a             	movzbl (%edx),%ebx
+  800a06:	38 d9                	cmp    %bl,%cl
+  800a08:	74 ec                	je     8009f6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a0a:	0f b6 c1             	movzbl %cl,%eax
+  800a0d:	0f b6 db             	movzbl %bl,%ebx
+  800a10:	29 d8                	sub    %ebx,%eax
+  800a12:	eb 05                	jmp    800a19 <memcmp+0x35>
+	}
+
+	return 0;
+  800a14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a19:	5b                   	pop    %ebx
+  800a1a:	5e                   	pop    %esi
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a26:	89 c2                	mov    %eax,%edx
+  800a28:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a2b:	eb 03                	jmp    800a30 <memfind+0x13>
+  800a2d:	83 c0 01             	add    $0x1,%eax
+  800a30:	39 d0                	cmp    %edx,%eax
+  800a32:	73 04                	jae    800a38 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a34:	38 08                	cmp    %cl,(%eax)
+  800a36:	75 f5                	jne    800a2d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a38:	5d                   	pop    %ebp
+  800a39:	c3                   	ret
+
+00800a3a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	57                   	push   %edi
+  800a3e:	56                   	push   %esi
+  800a3f:	53                   	push   %ebx
+  800a40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a46:	eb 03                	jmp    800a4b <strtol+0x11>
+		s++;
+  800a48:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a4b:	0f b6 02             	movzbl (%edx),%eax
+  800a4e:	3c 20                	cmp    $0x20,%al
+  800a50:	74 f6                	je     800a48 <strtol+0xe>
+  800a52:	3c 09                	cmp    $0x9,%al
+  800a54:	74 f2                	je     800a48 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a56:	3c 2b                	cmp    $0x2b,%al
+  800a58:	74 2a                	je     800a84 <strtol+0x4a>
+	int neg = 0;
+  800a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5f:	3c 2d                	cmp    $0x2d,%al
+  800a61:	74 2b                	je     800a8e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a63:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a69:	75 0f                	jne    800a7a <strtol+0x40>
+  800a6b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a6e:	74 28                	je     800a98 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a70:	85 db                	test   %ebx,%ebx
+  800a72:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a77:	0f 44 d8             	cmove  %eax,%ebx
+  800a7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a82:	eb 46                	jmp    800aca <strtol+0x90>
+		s++;
+  800a84:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a87:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a8c:	eb d5                	jmp    800a63 <strtol+0x29>
+		s++, neg = 1;
+  800a8e:	83 c2 01             	add    $0x1,%edx
+  800a91:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a96:	eb cb                	jmp    800a63 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a98:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a9c:	74 0e                	je     800aac <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a9e:	85 db                	test   %ebx,%ebx
+  800aa0:	75 d8                	jne    800a7a <strtol+0x40>
+		s++, base = 8;
+  800aa2:	83 c2 01             	add    $0x1,%edx
+  800aa5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aaa:	eb ce                	jmp    800a7a <strtol+0x40>
+		s += 2, base = 16;
+  800aac:	83 c2 02             	add    $0x2,%edx
+  800aaf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab4:	eb c4                	jmp    800a7a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab6:	0f be c0             	movsbl %al,%eax
+  800ab9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800abc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800abf:	7d 3a                	jge    800afb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ac1:	83 c2 01             	add    $0x1,%edx
+  800ac4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aca:	0f b6 02             	movzbl (%edx),%eax
+  800acd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad0:	89 f3                	mov    %esi,%ebx
+  800ad2:	80 fb 09             	cmp    $0x9,%bl
+  800ad5:	76 df                	jbe    800ab6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ada:	89 f3                	mov    %esi,%ebx
+  800adc:	80 fb 19             	cmp    $0x19,%bl
+  800adf:	77 08                	ja     800ae9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ae1:	0f be c0             	movsbl %al,%eax
+  800ae4:	83 e8 57             	sub    $0x57,%eax
+  800ae7:	eb d3                	jmp    800abc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aec:	89 f3                	mov    %esi,%ebx
+  800aee:	80 fb 19             	cmp    $0x19,%bl
+  800af1:	77 08                	ja     800afb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800af3:	0f be c0             	movsbl %al,%eax
+  800af6:	83 e8 37             	sub    $0x37,%eax
+  800af9:	eb c1                	jmp    800abc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800afb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aff:	74 05                	je     800b06 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b04:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b06:	89 c8                	mov    %ecx,%eax
+  800b08:	f7 d8                	neg    %eax
+  800b0a:	85 ff                	test   %edi,%edi
+  800b0c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0f:	89 c8                	mov    %ecx,%eax
+  800b11:	5b                   	pop    %ebx
+  800b12:	5e                   	pop    %esi
+  800b13:	5f                   	pop    %edi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b1c:	6a 00                	push   $0x0
+  800b1e:	6a 00                	push   $0x0
+  800b20:	ff 75 08             	push   0x8(%ebp)
+  800b23:	e8 12 ff ff ff       	call   800a3a <strtol>
+}
+  800b28:	c9                   	leave
+  800b29:	c3                   	ret
+
+00800b2a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	57                   	push   %edi
+  800b2e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3a:	89 c3                	mov    %eax,%ebx
+  800b3c:	89 c7                	mov    %eax,%edi
+  800b3e:	6a 00                	push   $0x0
+  800b40:	55                   	push   %ebp
+  800b41:	56                   	push   %esi
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	8d 35 4c 0b 80 00    	lea    0x800b4c,%esi
+  800b4a:	0f 34                	sysenter
+
+00800b4c <after_sysenter_label_47>:
+  800b4c:	5e                   	pop    %esi
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b51:	5b                   	pop    %ebx
+  800b52:	5f                   	pop    %edi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+
+00800b55 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	57                   	push   %edi
+  800b59:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b64:	89 d1                	mov    %edx,%ecx
+  800b66:	89 d3                	mov    %edx,%ebx
+  800b68:	89 d7                	mov    %edx,%edi
+  800b6a:	6a 00                	push   $0x0
+  800b6c:	55                   	push   %ebp
+  800b6d:	56                   	push   %esi
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	8d 35 78 0b 80 00    	lea    0x800b78,%esi
+  800b76:	0f 34                	sysenter
+
+00800b78 <after_sysenter_label_128>:
+  800b78:	5e                   	pop    %esi
+  800b79:	5d                   	pop    %ebp
+  800b7a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b7d:	5b                   	pop    %ebx
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b93:	89 cb                	mov    %ecx,%ebx
+  800b95:	89 cf                	mov    %ecx,%edi
+  800b97:	6a 00                	push   $0x0
+  800b99:	55                   	push   %ebp
+  800b9a:	56                   	push   %esi
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8d 35 a5 0b 80 00    	lea    0x800ba5,%esi
+  800ba3:	0f 34                	sysenter
+
+00800ba5 <after_sysenter_label_212>:
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800baa:	85 c0                	test   %eax,%eax
+  800bac:	7f 07                	jg     800bb5 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bb1:	5b                   	pop    %ebx
+  800bb2:	5f                   	pop    %edi
+  800bb3:	5d                   	pop    %ebp
+  800bb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bb5:	83 ec 0c             	sub    $0xc,%esp
+  800bb8:	50                   	push   %eax
+  800bb9:	6a 03                	push   $0x3
+  800bbb:	68 15 4b 80 00       	push   $0x804b15
+  800bc0:	6a 54                	push   $0x54
+  800bc2:	68 32 4b 80 00       	push   $0x804b32
+  800bc7:	e8 c3 31 00 00       	call   803d8f <_panic>
+
+00800bcc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	57                   	push   %edi
+  800bd0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bdb:	89 d1                	mov    %edx,%ecx
+  800bdd:	89 d3                	mov    %edx,%ebx
+  800bdf:	89 d7                	mov    %edx,%edi
+  800be1:	6a 00                	push   $0x0
+  800be3:	55                   	push   %ebp
+  800be4:	56                   	push   %esi
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	8d 35 ef 0b 80 00    	lea    0x800bef,%esi
+  800bed:	0f 34                	sysenter
+
+00800bef <after_sysenter_label_309>:
+  800bef:	5e                   	pop    %esi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5f                   	pop    %edi
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	c3                   	ret
+
+00800bf8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c02:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c07:	89 d1                	mov    %edx,%ecx
+  800c09:	89 d3                	mov    %edx,%ebx
+  800c0b:	89 d7                	mov    %edx,%edi
+  800c0d:	6a 00                	push   $0x0
+  800c0f:	55                   	push   %ebp
+  800c10:	56                   	push   %esi
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	8d 35 1b 0c 80 00    	lea    0x800c1b,%esi
+  800c19:	0f 34                	sysenter
+
+00800c1b <after_sysenter_label_391>:
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c20:	5b                   	pop    %ebx
+  800c21:	5f                   	pop    %edi
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c34:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3c:	6a 00                	push   $0x0
+  800c3e:	55                   	push   %ebp
+  800c3f:	56                   	push   %esi
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	8d 35 4a 0c 80 00    	lea    0x800c4a,%esi
+  800c48:	0f 34                	sysenter
+
+00800c4a <after_sysenter_label_479>:
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c4f:	85 c0                	test   %eax,%eax
+  800c51:	7f 07                	jg     800c5a <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c56:	5b                   	pop    %ebx
+  800c57:	5f                   	pop    %edi
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+  800c5d:	50                   	push   %eax
+  800c5e:	6a 04                	push   $0x4
+  800c60:	68 15 4b 80 00       	push   $0x804b15
+  800c65:	6a 54                	push   $0x54
+  800c67:	68 32 4b 80 00       	push   $0x804b32
+  800c6c:	e8 1e 31 00 00       	call   803d8f <_panic>
+
+00800c71 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c87:	ff 75 18             	push   0x18(%ebp)
+  800c8a:	55                   	push   %ebp
+  800c8b:	56                   	push   %esi
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	8d 35 96 0c 80 00    	lea    0x800c96,%esi
+  800c94:	0f 34                	sysenter
+
+00800c96 <after_sysenter_label_593>:
+  800c96:	5e                   	pop    %esi
+  800c97:	5d                   	pop    %ebp
+  800c98:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	7f 07                	jg     800ca6 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca2:	5b                   	pop    %ebx
+  800ca3:	5f                   	pop    %edi
+  800ca4:	5d                   	pop    %ebp
+  800ca5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca6:	83 ec 0c             	sub    $0xc,%esp
+  800ca9:	50                   	push   %eax
+  800caa:	6a 05                	push   $0x5
+  800cac:	68 15 4b 80 00       	push   $0x804b15
+  800cb1:	6a 54                	push   $0x54
+  800cb3:	68 32 4b 80 00       	push   $0x804b32
+  800cb8:	e8 d2 30 00 00       	call   803d8f <_panic>
+
+00800cbd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cd2:	89 df                	mov    %ebx,%edi
+  800cd4:	6a 00                	push   $0x0
+  800cd6:	55                   	push   %ebp
+  800cd7:	56                   	push   %esi
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	8d 35 e2 0c 80 00    	lea    0x800ce2,%esi
+  800ce0:	0f 34                	sysenter
+
+00800ce2 <after_sysenter_label_704>:
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ce7:	85 c0                	test   %eax,%eax
+  800ce9:	7f 07                	jg     800cf2 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ceb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cee:	5b                   	pop    %ebx
+  800cef:	5f                   	pop    %edi
+  800cf0:	5d                   	pop    %ebp
+  800cf1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  800cf5:	50                   	push   %eax
+  800cf6:	6a 06                	push   $0x6
+  800cf8:	68 15 4b 80 00       	push   $0x804b15
+  800cfd:	6a 54                	push   $0x54
+  800cff:	68 32 4b 80 00       	push   $0x804b32
+  800d04:	e8 86 30 00 00       	call   803d8f <_panic>
+
+00800d09 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d19:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d1e:	89 df                	mov    %ebx,%edi
+  800d20:	6a 00                	push   $0x0
+  800d22:	55                   	push   %ebp
+  800d23:	56                   	push   %esi
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	8d 35 2e 0d 80 00    	lea    0x800d2e,%esi
+  800d2c:	0f 34                	sysenter
+
+00800d2e <after_sysenter_label_808>:
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5d                   	pop    %ebp
+  800d30:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d33:	85 c0                	test   %eax,%eax
+  800d35:	7f 07                	jg     800d3e <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3e:	83 ec 0c             	sub    $0xc,%esp
+  800d41:	50                   	push   %eax
+  800d42:	6a 08                	push   $0x8
+  800d44:	68 15 4b 80 00       	push   $0x804b15
+  800d49:	6a 54                	push   $0x54
+  800d4b:	68 32 4b 80 00       	push   $0x804b32
+  800d50:	e8 3a 30 00 00       	call   803d8f <_panic>
+
+00800d55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	57                   	push   %edi
+  800d59:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d65:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d6a:	89 df                	mov    %ebx,%edi
+  800d6c:	6a 00                	push   $0x0
+  800d6e:	55                   	push   %ebp
+  800d6f:	56                   	push   %esi
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	8d 35 7a 0d 80 00    	lea    0x800d7a,%esi
+  800d78:	0f 34                	sysenter
+
+00800d7a <after_sysenter_label_912>:
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5d                   	pop    %ebp
+  800d7c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d7f:	85 c0                	test   %eax,%eax
+  800d81:	7f 07                	jg     800d8a <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d86:	5b                   	pop    %ebx
+  800d87:	5f                   	pop    %edi
+  800d88:	5d                   	pop    %ebp
+  800d89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8a:	83 ec 0c             	sub    $0xc,%esp
+  800d8d:	50                   	push   %eax
+  800d8e:	6a 09                	push   $0x9
+  800d90:	68 15 4b 80 00       	push   $0x804b15
+  800d95:	6a 54                	push   $0x54
+  800d97:	68 32 4b 80 00       	push   $0x804b32
+  800d9c:	e8 ee 2f 00 00       	call   803d8f <_panic>
+
+00800da1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	57                   	push   %edi
+  800da5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db6:	89 df                	mov    %ebx,%edi
+  800db8:	6a 00                	push   $0x0
+  800dba:	55                   	push   %ebp
+  800dbb:	56                   	push   %esi
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	8d 35 c6 0d 80 00    	lea    0x800dc6,%esi
+  800dc4:	0f 34                	sysenter
+
+00800dc6 <after_sysenter_label_1016>:
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dcb:	85 c0                	test   %eax,%eax
+  800dcd:	7f 07                	jg     800dd6 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800dcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dd2:	5b                   	pop    %ebx
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 0a                	push   $0xa
+  800ddc:	68 15 4b 80 00       	push   $0x804b15
+  800de1:	6a 54                	push   $0x54
+  800de3:	68 32 4b 80 00       	push   $0x804b32
+  800de8:	e8 a2 2f 00 00       	call   803d8f <_panic>
+
+00800ded <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e00:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e03:	6a 00                	push   $0x0
+  800e05:	55                   	push   %ebp
+  800e06:	56                   	push   %esi
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	8d 35 11 0e 80 00    	lea    0x800e11,%esi
+  800e0f:	0f 34                	sysenter
+
+00800e11 <after_sysenter_label_1126>:
+  800e11:	5e                   	pop    %esi
+  800e12:	5d                   	pop    %ebp
+  800e13:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e16:	5b                   	pop    %ebx
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e27:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e2c:	89 cb                	mov    %ecx,%ebx
+  800e2e:	89 cf                	mov    %ecx,%edi
+  800e30:	6a 00                	push   $0x0
+  800e32:	55                   	push   %ebp
+  800e33:	56                   	push   %esi
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	8d 35 3e 0e 80 00    	lea    0x800e3e,%esi
+  800e3c:	0f 34                	sysenter
+
+00800e3e <after_sysenter_label_1210>:
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e43:	85 c0                	test   %eax,%eax
+  800e45:	7f 07                	jg     800e4e <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e4a:	5b                   	pop    %ebx
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	50                   	push   %eax
+  800e52:	6a 0d                	push   $0xd
+  800e54:	68 15 4b 80 00       	push   $0x804b15
+  800e59:	6a 54                	push   $0x54
+  800e5b:	68 32 4b 80 00       	push   $0x804b32
+  800e60:	e8 2a 2f 00 00       	call   803d8f <_panic>
+
+00800e65 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e75:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e7a:	89 df                	mov    %ebx,%edi
+  800e7c:	6a 00                	push   $0x0
+  800e7e:	55                   	push   %ebp
+  800e7f:	56                   	push   %esi
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+
+00800e8a <after_sysenter_label_1311>:
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 07                	jg     800e9a <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 42                	push   $0x42
+  800ea0:	68 15 4b 80 00       	push   $0x804b15
+  800ea5:	6a 54                	push   $0x54
+  800ea7:	68 32 4b 80 00       	push   $0x804b32
+  800eac:	e8 de 2e 00 00       	call   803d8f <_panic>
+
+00800eb1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ec0:	89 d1                	mov    %edx,%ecx
+  800ec2:	89 d3                	mov    %edx,%ebx
+  800ec4:	89 d7                	mov    %edx,%edi
+  800ec6:	6a 00                	push   $0x0
+  800ec8:	55                   	push   %ebp
+  800ec9:	56                   	push   %esi
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	8d 35 d4 0e 80 00    	lea    0x800ed4,%esi
+  800ed2:	0f 34                	sysenter
+
+00800ed4 <after_sysenter_label_1411>:
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+
+00800edd <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	57                   	push   %edi
+  800ee1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ee2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ef2:	89 df                	mov    %ebx,%edi
+  800ef4:	6a 00                	push   $0x0
+  800ef6:	55                   	push   %ebp
+  800ef7:	56                   	push   %esi
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	8d 35 02 0f 80 00    	lea    0x800f02,%esi
+  800f00:	0f 34                	sysenter
+
+00800f02 <after_sysenter_label_1497>:
+  800f02:	5e                   	pop    %esi
+  800f03:	5d                   	pop    %ebp
+  800f04:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f07:	5b                   	pop    %ebx
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+
+00800f0b <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	6a 00                	push   $0x0
+  800f24:	55                   	push   %ebp
+  800f25:	56                   	push   %esi
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	8d 35 30 0f 80 00    	lea    0x800f30,%esi
+  800f2e:	0f 34                	sysenter
+
+00800f30 <after_sysenter_label_1583>:
+  800f30:	5e                   	pop    %esi
+  800f31:	5d                   	pop    %ebp
+  800f32:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f49:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f51:	6a 00                	push   $0x0
+  800f53:	55                   	push   %ebp
+  800f54:	56                   	push   %esi
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	8d 35 5f 0f 80 00    	lea    0x800f5f,%esi
+  800f5d:	0f 34                	sysenter
+
+00800f5f <after_sysenter_label_1672>:
+  800f5f:	5e                   	pop    %esi
+  800f60:	5d                   	pop    %ebp
+  800f61:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f7d:	89 df                	mov    %ebx,%edi
+  800f7f:	6a 00                	push   $0x0
+  800f81:	55                   	push   %ebp
+  800f82:	56                   	push   %esi
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	8d 35 8d 0f 80 00    	lea    0x800f8d,%esi
+  800f8b:	0f 34                	sysenter
+
+00800f8d <after_sysenter_label_1758>:
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f92:	5b                   	pop    %ebx
+  800f93:	5f                   	pop    %edi
+  800f94:	5d                   	pop    %ebp
+  800f95:	c3                   	ret
+
+00800f96 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa3:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fa8:	89 cb                	mov    %ecx,%ebx
+  800faa:	89 cf                	mov    %ecx,%edi
+  800fac:	6a 00                	push   $0x0
+  800fae:	55                   	push   %ebp
+  800faf:	56                   	push   %esi
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	8d 35 ba 0f 80 00    	lea    0x800fba,%esi
+  800fb8:	0f 34                	sysenter
+
+00800fba <after_sysenter_label_1842>:
+  800fba:	5e                   	pop    %esi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7f 07                	jg     800fca <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fca:	83 ec 0c             	sub    $0xc,%esp
+  800fcd:	50                   	push   %eax
+  800fce:	6a 13                	push   $0x13
+  800fd0:	68 15 4b 80 00       	push   $0x804b15
+  800fd5:	6a 54                	push   $0x54
+  800fd7:	68 32 4b 80 00       	push   $0x804b32
+  800fdc:	e8 ae 2d 00 00       	call   803d8f <_panic>
+
+00800fe1 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800feb:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ff0:	89 d1                	mov    %edx,%ecx
+  800ff2:	89 d3                	mov    %edx,%ebx
+  800ff4:	89 d7                	mov    %edx,%edi
+  800ff6:	6a 00                	push   $0x0
+  800ff8:	55                   	push   %ebp
+  800ff9:	56                   	push   %esi
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	8d 35 04 10 80 00    	lea    0x801004,%esi
+  801002:	0f 34                	sysenter
+
+00801004 <after_sysenter_label_1939>:
+  801004:	5e                   	pop    %esi
+  801005:	5d                   	pop    %ebp
+  801006:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801009:	5b                   	pop    %ebx
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+
+0080100d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801012:	8b 55 08             	mov    0x8(%ebp),%edx
+  801015:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801018:	b8 15 00 00 00       	mov    $0x15,%eax
+  80101d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801022:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801025:	6a 00                	push   $0x0
+  801027:	55                   	push   %ebp
+  801028:	56                   	push   %esi
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	8d 35 33 10 80 00    	lea    0x801033,%esi
+  801031:	0f 34                	sysenter
+
+00801033 <after_sysenter_label_2028>:
+  801033:	5e                   	pop    %esi
+  801034:	5d                   	pop    %ebp
+  801035:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801038:	5b                   	pop    %ebx
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801041:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801051:	89 df                	mov    %ebx,%edi
+  801053:	6a 00                	push   $0x0
+  801055:	55                   	push   %ebp
+  801056:	56                   	push   %esi
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	8d 35 61 10 80 00    	lea    0x801061,%esi
+  80105f:	0f 34                	sysenter
+
+00801061 <after_sysenter_label_2114>:
+  801061:	5e                   	pop    %esi
+  801062:	5d                   	pop    %ebp
+  801063:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801066:	5b                   	pop    %ebx
+  801067:	5f                   	pop    %edi
+  801068:	5d                   	pop    %ebp
+  801069:	c3                   	ret
+
+0080106a <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	57                   	push   %edi
+  80106e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801074:	8b 55 08             	mov    0x8(%ebp),%edx
+  801077:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80107f:	89 df                	mov    %ebx,%edi
+  801081:	6a 00                	push   $0x0
+  801083:	55                   	push   %ebp
+  801084:	56                   	push   %esi
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	8d 35 8f 10 80 00    	lea    0x80108f,%esi
+  80108d:	0f 34                	sysenter
+
+0080108f <after_sysenter_label_2200>:
+  80108f:	5e                   	pop    %esi
+  801090:	5d                   	pop    %ebp
+  801091:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5f                   	pop    %edi
+  801096:	5d                   	pop    %ebp
+  801097:	c3                   	ret
+
+00801098 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	57                   	push   %edi
+  80109c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	6a 00                	push   $0x0
+  8010b1:	55                   	push   %ebp
+  8010b2:	56                   	push   %esi
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	8d 35 bd 10 80 00    	lea    0x8010bd,%esi
+  8010bb:	0f 34                	sysenter
+
+008010bd <after_sysenter_label_2286>:
+  8010bd:	5e                   	pop    %esi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 18             	sub    $0x18,%esp
+  8010cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8010d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8010d8:	85 c0                	test   %eax,%eax
+  8010da:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8010df:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8010e2:	50                   	push   %eax
+  8010e3:	e8 32 fd ff ff       	call   800e1a <sys_ipc_recv>
+	if (r < 0) {
+  8010e8:	83 c4 10             	add    $0x10,%esp
+  8010eb:	85 c0                	test   %eax,%eax
+  8010ed:	78 2b                	js     80111a <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8010ef:	85 ff                	test   %edi,%edi
+  8010f1:	74 55                	je     801148 <ipc_recv+0x82>
+  8010f3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8010f5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8010fb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801100:	77 39                	ja     80113b <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801102:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801107:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801109:	c1 e8 10             	shr    $0x10,%eax
+  80110c:	74 2d                	je     80113b <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80110e:	c1 e0 10             	shl    $0x10,%eax
+  801111:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801116:	29 c2                	sub    %eax,%edx
+  801118:	eb 27                	jmp    801141 <ipc_recv+0x7b>
+  80111a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80111c:	83 ec 08             	sub    $0x8,%esp
+  80111f:	50                   	push   %eax
+  801120:	68 40 4b 80 00       	push   $0x804b40
+  801125:	e8 d8 f0 ff ff       	call   800202 <cprintf>
+		*from_env_store = 0;
+  80112a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801130:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801136:	83 c4 10             	add    $0x10,%esp
+  801139:	eb 77                	jmp    8011b2 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80113b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801141:	8b 02                	mov    (%edx),%eax
+  801143:	8b 40 78             	mov    0x78(%eax),%eax
+  801146:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801148:	85 f6                	test   %esi,%esi
+  80114a:	74 34                	je     801180 <ipc_recv+0xba>
+  80114c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80114e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801154:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801159:	77 18                	ja     801173 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80115b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801160:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801162:	c1 e8 10             	shr    $0x10,%eax
+  801165:	74 0c                	je     801173 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801167:	c1 e0 10             	shl    $0x10,%eax
+  80116a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80116f:	29 c2                	sub    %eax,%edx
+  801171:	eb 06                	jmp    801179 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  801173:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  801179:	8b 02                	mov    (%edx),%eax
+  80117b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80117e:	89 06                	mov    %eax,(%esi)
+  801180:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801182:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801188:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80118d:	77 18                	ja     8011a7 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80118f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801194:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801196:	c1 e8 10             	shr    $0x10,%eax
+  801199:	74 0c                	je     8011a7 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80119b:	c1 e0 10             	shl    $0x10,%eax
+  80119e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8011a3:	29 c2                	sub    %eax,%edx
+  8011a5:	eb 06                	jmp    8011ad <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8011a7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8011ad:	8b 02                	mov    (%edx),%eax
+  8011af:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8011b2:	89 d8                	mov    %ebx,%eax
+  8011b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8011ce:	85 db                	test   %ebx,%ebx
+  8011d0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8011d5:	0f 44 d8             	cmove  %eax,%ebx
+  8011d8:	eb 05                	jmp    8011df <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8011da:	e8 19 fa ff ff       	call   800bf8 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8011df:	57                   	push   %edi
+  8011e0:	53                   	push   %ebx
+  8011e1:	ff 75 0c             	push   0xc(%ebp)
+  8011e4:	56                   	push   %esi
+  8011e5:	e8 03 fc ff ff       	call   800ded <sys_ipc_try_send>
+		if (r == 0) {
+  8011ea:	83 c4 10             	add    $0x10,%esp
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	74 19                	je     80120a <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8011f1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8011f4:	74 e4                	je     8011da <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8011f6:	83 ec 0c             	sub    $0xc,%esp
+  8011f9:	50                   	push   %eax
+  8011fa:	57                   	push   %edi
+  8011fb:	53                   	push   %ebx
+  8011fc:	56                   	push   %esi
+  8011fd:	68 5c 4b 80 00       	push   $0x804b5c
+  801202:	e8 fb ef ff ff       	call   800202 <cprintf>
+			return;
+  801207:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80120a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120d:	5b                   	pop    %ebx
+  80120e:	5e                   	pop    %esi
+  80120f:	5f                   	pop    %edi
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+
+00801212 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80121d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801220:	c1 e0 04             	shl    $0x4,%eax
+  801223:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801228:	8b 40 50             	mov    0x50(%eax),%eax
+  80122b:	39 c8                	cmp    %ecx,%eax
+  80122d:	74 12                	je     801241 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80122f:	83 c2 01             	add    $0x1,%edx
+  801232:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801238:	75 e3                	jne    80121d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80123a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123f:	eb 0e                	jmp    80124f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801241:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801244:	c1 e0 04             	shl    $0x4,%eax
+  801247:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80124c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+
+00801251 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801254:	8b 45 08             	mov    0x8(%ebp),%eax
+  801257:	05 00 00 00 30       	add    $0x30000000,%eax
+  80125c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+
+00801261 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801264:	8b 45 08             	mov    0x8(%ebp),%eax
+  801267:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80126c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801271:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+
+00801278 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80127b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801280:	eb 02                	jmp    801284 <fd_alloc+0xc>
+  801282:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801284:	89 c2                	mov    %eax,%edx
+  801286:	c1 ea 16             	shr    $0x16,%edx
+  801289:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801290:	f6 c2 01             	test   $0x1,%dl
+  801293:	74 2b                	je     8012c0 <fd_alloc+0x48>
+  801295:	89 c2                	mov    %eax,%edx
+  801297:	c1 ea 0c             	shr    $0xc,%edx
+  80129a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012a1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012a7:	f6 c1 01             	test   $0x1,%cl
+  8012aa:	74 14                	je     8012c0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012ac:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012b2:	75 ce                	jne    801282 <fd_alloc+0xa>
+  8012b4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012b9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012be:	eb 05                	jmp    8012c5 <fd_alloc+0x4d>
+			return 0;
+  8012c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c8:	89 02                	mov    %eax,(%edx)
+}
+  8012ca:	89 c8                	mov    %ecx,%eax
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+
+008012ce <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012d4:	83 f8 1f             	cmp    $0x1f,%eax
+  8012d7:	77 30                	ja     801309 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012d9:	c1 e0 0c             	shl    $0xc,%eax
+  8012dc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012e1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012e7:	f6 c2 01             	test   $0x1,%dl
+  8012ea:	74 24                	je     801310 <fd_lookup+0x42>
+  8012ec:	89 c2                	mov    %eax,%edx
+  8012ee:	c1 ea 0c             	shr    $0xc,%edx
+  8012f1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012f8:	f6 c2 01             	test   $0x1,%dl
+  8012fb:	74 1a                	je     801317 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801300:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801302:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+		return -E_INVAL;
+  801309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130e:	eb f7                	jmp    801307 <fd_lookup+0x39>
+		return -E_INVAL;
+  801310:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801315:	eb f0                	jmp    801307 <fd_lookup+0x39>
+  801317:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80131c:	eb e9                	jmp    801307 <fd_lookup+0x39>
+
+0080131e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	53                   	push   %ebx
+  801322:	83 ec 04             	sub    $0x4,%esp
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132d:	eb 03                	jmp    801332 <dev_lookup+0x14>
+  80132f:	83 c0 01             	add    $0x1,%eax
+  801332:	8b 1c 85 10 4c 80 00 	mov    0x804c10(,%eax,4),%ebx
+  801339:	85 db                	test   %ebx,%ebx
+  80133b:	74 0b                	je     801348 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80133d:	39 13                	cmp    %edx,(%ebx)
+  80133f:	75 ee                	jne    80132f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801341:	b8 00 00 00 00       	mov    $0x0,%eax
+  801346:	eb 49                	jmp    801391 <dev_lookup+0x73>
+  801348:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80134a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801350:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801355:	77 18                	ja     80136f <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801357:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80135c:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80135e:	c1 e8 10             	shr    $0x10,%eax
+  801361:	74 0c                	je     80136f <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801363:	c1 e0 10             	shl    $0x10,%eax
+  801366:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80136b:	29 c1                	sub    %eax,%ecx
+  80136d:	eb 06                	jmp    801375 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80136f:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801375:	8b 01                	mov    (%ecx),%eax
+  801377:	8b 40 48             	mov    0x48(%eax),%eax
+  80137a:	83 ec 04             	sub    $0x4,%esp
+  80137d:	52                   	push   %edx
+  80137e:	50                   	push   %eax
+  80137f:	68 94 4b 80 00       	push   $0x804b94
+  801384:	e8 79 ee ff ff       	call   800202 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801391:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801394:	89 1a                	mov    %ebx,(%edx)
+}
+  801396:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801399:	c9                   	leave
+  80139a:	c3                   	ret
+
+0080139b <fd_close>:
+{
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	57                   	push   %edi
+  80139f:	56                   	push   %esi
+  8013a0:	53                   	push   %ebx
+  8013a1:	83 ec 24             	sub    $0x24,%esp
+  8013a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013a7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013aa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013ad:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013ae:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013b4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013b7:	50                   	push   %eax
+  8013b8:	e8 11 ff ff ff       	call   8012ce <fd_lookup>
+  8013bd:	89 c3                	mov    %eax,%ebx
+  8013bf:	83 c4 10             	add    $0x10,%esp
+  8013c2:	85 c0                	test   %eax,%eax
+  8013c4:	78 05                	js     8013cb <fd_close+0x30>
+	    || fd != fd2)
+  8013c6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013c9:	74 16                	je     8013e1 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013cb:	89 f8                	mov    %edi,%eax
+  8013cd:	84 c0                	test   %al,%al
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013d7:	89 d8                	mov    %ebx,%eax
+  8013d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013dc:	5b                   	pop    %ebx
+  8013dd:	5e                   	pop    %esi
+  8013de:	5f                   	pop    %edi
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013e1:	83 ec 08             	sub    $0x8,%esp
+  8013e4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013e7:	50                   	push   %eax
+  8013e8:	ff 36                	push   (%esi)
+  8013ea:	e8 2f ff ff ff       	call   80131e <dev_lookup>
+  8013ef:	89 c3                	mov    %eax,%ebx
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 1a                	js     801412 <fd_close+0x77>
+		if (dev->dev_close)
+  8013f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013fb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801403:	85 c0                	test   %eax,%eax
+  801405:	74 0b                	je     801412 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801407:	83 ec 0c             	sub    $0xc,%esp
+  80140a:	56                   	push   %esi
+  80140b:	ff d0                	call   *%eax
+  80140d:	89 c3                	mov    %eax,%ebx
+  80140f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801412:	83 ec 08             	sub    $0x8,%esp
+  801415:	56                   	push   %esi
+  801416:	6a 00                	push   $0x0
+  801418:	e8 a0 f8 ff ff       	call   800cbd <sys_page_unmap>
+	return r;
+  80141d:	83 c4 10             	add    $0x10,%esp
+  801420:	eb b5                	jmp    8013d7 <fd_close+0x3c>
+
+00801422 <close>:
+
+int
+close(int fdnum)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80142b:	50                   	push   %eax
+  80142c:	ff 75 08             	push   0x8(%ebp)
+  80142f:	e8 9a fe ff ff       	call   8012ce <fd_lookup>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	79 02                	jns    80143d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+		return fd_close(fd, 1);
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	6a 01                	push   $0x1
+  801442:	ff 75 f4             	push   -0xc(%ebp)
+  801445:	e8 51 ff ff ff       	call   80139b <fd_close>
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	eb ec                	jmp    80143b <close+0x19>
+
+0080144f <close_all>:
+
+void
+close_all(void)
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	53                   	push   %ebx
+  801453:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	53                   	push   %ebx
+  80145f:	e8 be ff ff ff       	call   801422 <close>
+	for (i = 0; i < MAXFD; i++)
+  801464:	83 c3 01             	add    $0x1,%ebx
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	83 fb 20             	cmp    $0x20,%ebx
+  80146d:	75 ec                	jne    80145b <close_all+0xc>
+}
+  80146f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801472:	c9                   	leave
+  801473:	c3                   	ret
+
+00801474 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	57                   	push   %edi
+  801478:	56                   	push   %esi
+  801479:	53                   	push   %ebx
+  80147a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80147d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801480:	50                   	push   %eax
+  801481:	ff 75 08             	push   0x8(%ebp)
+  801484:	e8 45 fe ff ff       	call   8012ce <fd_lookup>
+  801489:	89 c3                	mov    %eax,%ebx
+  80148b:	83 c4 10             	add    $0x10,%esp
+  80148e:	85 c0                	test   %eax,%eax
+  801490:	78 7f                	js     801511 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	ff 75 0c             	push   0xc(%ebp)
+  801498:	e8 85 ff ff ff       	call   801422 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80149d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014a0:	c1 e6 0c             	shl    $0xc,%esi
+  8014a3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014ac:	89 3c 24             	mov    %edi,(%esp)
+  8014af:	e8 ad fd ff ff       	call   801261 <fd2data>
+  8014b4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014b6:	89 34 24             	mov    %esi,(%esp)
+  8014b9:	e8 a3 fd ff ff       	call   801261 <fd2data>
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014c4:	89 d8                	mov    %ebx,%eax
+  8014c6:	c1 e8 16             	shr    $0x16,%eax
+  8014c9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014d0:	a8 01                	test   $0x1,%al
+  8014d2:	74 11                	je     8014e5 <dup+0x71>
+  8014d4:	89 d8                	mov    %ebx,%eax
+  8014d6:	c1 e8 0c             	shr    $0xc,%eax
+  8014d9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014e0:	f6 c2 01             	test   $0x1,%dl
+  8014e3:	75 36                	jne    80151b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014e5:	89 f8                	mov    %edi,%eax
+  8014e7:	c1 e8 0c             	shr    $0xc,%eax
+  8014ea:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014f1:	83 ec 0c             	sub    $0xc,%esp
+  8014f4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014f9:	50                   	push   %eax
+  8014fa:	56                   	push   %esi
+  8014fb:	6a 00                	push   $0x0
+  8014fd:	57                   	push   %edi
+  8014fe:	6a 00                	push   $0x0
+  801500:	e8 6c f7 ff ff       	call   800c71 <sys_page_map>
+  801505:	89 c3                	mov    %eax,%ebx
+  801507:	83 c4 20             	add    $0x20,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 33                	js     801541 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80150e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801511:	89 d8                	mov    %ebx,%eax
+  801513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801516:	5b                   	pop    %ebx
+  801517:	5e                   	pop    %esi
+  801518:	5f                   	pop    %edi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80151b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801522:	83 ec 0c             	sub    $0xc,%esp
+  801525:	25 07 0e 00 00       	and    $0xe07,%eax
+  80152a:	50                   	push   %eax
+  80152b:	ff 75 d4             	push   -0x2c(%ebp)
+  80152e:	6a 00                	push   $0x0
+  801530:	53                   	push   %ebx
+  801531:	6a 00                	push   $0x0
+  801533:	e8 39 f7 ff ff       	call   800c71 <sys_page_map>
+  801538:	89 c3                	mov    %eax,%ebx
+  80153a:	83 c4 20             	add    $0x20,%esp
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	79 a4                	jns    8014e5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801541:	83 ec 08             	sub    $0x8,%esp
+  801544:	56                   	push   %esi
+  801545:	6a 00                	push   $0x0
+  801547:	e8 71 f7 ff ff       	call   800cbd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80154c:	83 c4 08             	add    $0x8,%esp
+  80154f:	ff 75 d4             	push   -0x2c(%ebp)
+  801552:	6a 00                	push   $0x0
+  801554:	e8 64 f7 ff ff       	call   800cbd <sys_page_unmap>
+	return r;
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	eb b3                	jmp    801511 <dup+0x9d>
+
+0080155e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	56                   	push   %esi
+  801562:	53                   	push   %ebx
+  801563:	83 ec 18             	sub    $0x18,%esp
+  801566:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801569:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156c:	50                   	push   %eax
+  80156d:	53                   	push   %ebx
+  80156e:	e8 5b fd ff ff       	call   8012ce <fd_lookup>
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	85 c0                	test   %eax,%eax
+  801578:	78 3c                	js     8015b6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80157a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80157d:	83 ec 08             	sub    $0x8,%esp
+  801580:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801583:	50                   	push   %eax
+  801584:	ff 36                	push   (%esi)
+  801586:	e8 93 fd ff ff       	call   80131e <dev_lookup>
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	78 24                	js     8015b6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801592:	8b 46 08             	mov    0x8(%esi),%eax
+  801595:	83 e0 03             	and    $0x3,%eax
+  801598:	83 f8 01             	cmp    $0x1,%eax
+  80159b:	74 20                	je     8015bd <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80159d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a0:	8b 40 08             	mov    0x8(%eax),%eax
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	74 61                	je     801608 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015a7:	83 ec 04             	sub    $0x4,%esp
+  8015aa:	ff 75 10             	push   0x10(%ebp)
+  8015ad:	ff 75 0c             	push   0xc(%ebp)
+  8015b0:	56                   	push   %esi
+  8015b1:	ff d0                	call   *%eax
+  8015b3:	83 c4 10             	add    $0x10,%esp
+}
+  8015b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b9:	5b                   	pop    %ebx
+  8015ba:	5e                   	pop    %esi
+  8015bb:	5d                   	pop    %ebp
+  8015bc:	c3                   	ret
+  8015bd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015bf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015ca:	77 18                	ja     8015e4 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015d1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015d3:	c1 e8 10             	shr    $0x10,%eax
+  8015d6:	74 0c                	je     8015e4 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015d8:	c1 e0 10             	shl    $0x10,%eax
+  8015db:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015e0:	29 c2                	sub    %eax,%edx
+  8015e2:	eb 06                	jmp    8015ea <read+0x8c>
+		return pthread_main_tls;
+  8015e4:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015ea:	8b 02                	mov    (%edx),%eax
+  8015ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  8015f2:	53                   	push   %ebx
+  8015f3:	50                   	push   %eax
+  8015f4:	68 d5 4b 80 00       	push   $0x804bd5
+  8015f9:	e8 04 ec ff ff       	call   800202 <cprintf>
+		return -E_INVAL;
+  8015fe:	83 c4 10             	add    $0x10,%esp
+  801601:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801606:	eb ae                	jmp    8015b6 <read+0x58>
+		return -E_NOT_SUPP;
+  801608:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160d:	eb a7                	jmp    8015b6 <read+0x58>
+
+0080160f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	57                   	push   %edi
+  801613:	56                   	push   %esi
+  801614:	53                   	push   %ebx
+  801615:	83 ec 0c             	sub    $0xc,%esp
+  801618:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80161b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80161e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801623:	eb 02                	jmp    801627 <readn+0x18>
+  801625:	01 c3                	add    %eax,%ebx
+  801627:	39 f3                	cmp    %esi,%ebx
+  801629:	73 21                	jae    80164c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80162b:	83 ec 04             	sub    $0x4,%esp
+  80162e:	89 f0                	mov    %esi,%eax
+  801630:	29 d8                	sub    %ebx,%eax
+  801632:	50                   	push   %eax
+  801633:	89 d8                	mov    %ebx,%eax
+  801635:	03 45 0c             	add    0xc(%ebp),%eax
+  801638:	50                   	push   %eax
+  801639:	57                   	push   %edi
+  80163a:	e8 1f ff ff ff       	call   80155e <read>
+		if (m < 0)
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 04                	js     80164a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801646:	75 dd                	jne    801625 <readn+0x16>
+  801648:	eb 02                	jmp    80164c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80164a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80164c:	89 d8                	mov    %ebx,%eax
+  80164e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801651:	5b                   	pop    %ebx
+  801652:	5e                   	pop    %esi
+  801653:	5f                   	pop    %edi
+  801654:	5d                   	pop    %ebp
+  801655:	c3                   	ret
+
+00801656 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 18             	sub    $0x18,%esp
+  80165e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801661:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801664:	50                   	push   %eax
+  801665:	53                   	push   %ebx
+  801666:	e8 63 fc ff ff       	call   8012ce <fd_lookup>
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 37                	js     8016a9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801672:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801675:	83 ec 08             	sub    $0x8,%esp
+  801678:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167b:	50                   	push   %eax
+  80167c:	ff 36                	push   (%esi)
+  80167e:	e8 9b fc ff ff       	call   80131e <dev_lookup>
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 1f                	js     8016a9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80168a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80168e:	74 20                	je     8016b0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801690:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801693:	8b 40 0c             	mov    0xc(%eax),%eax
+  801696:	85 c0                	test   %eax,%eax
+  801698:	74 61                	je     8016fb <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80169a:	83 ec 04             	sub    $0x4,%esp
+  80169d:	ff 75 10             	push   0x10(%ebp)
+  8016a0:	ff 75 0c             	push   0xc(%ebp)
+  8016a3:	56                   	push   %esi
+  8016a4:	ff d0                	call   *%eax
+  8016a6:	83 c4 10             	add    $0x10,%esp
+}
+  8016a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5d                   	pop    %ebp
+  8016af:	c3                   	ret
+  8016b0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016b2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016b8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016bd:	77 18                	ja     8016d7 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016bf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016c4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016c6:	c1 e8 10             	shr    $0x10,%eax
+  8016c9:	74 0c                	je     8016d7 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016cb:	c1 e0 10             	shl    $0x10,%eax
+  8016ce:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016d3:	29 c2                	sub    %eax,%edx
+  8016d5:	eb 06                	jmp    8016dd <write+0x87>
+		return pthread_main_tls;
+  8016d7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016dd:	8b 02                	mov    (%edx),%eax
+  8016df:	8b 40 48             	mov    0x48(%eax),%eax
+  8016e2:	83 ec 04             	sub    $0x4,%esp
+  8016e5:	53                   	push   %ebx
+  8016e6:	50                   	push   %eax
+  8016e7:	68 f1 4b 80 00       	push   $0x804bf1
+  8016ec:	e8 11 eb ff ff       	call   800202 <cprintf>
+		return -E_INVAL;
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f9:	eb ae                	jmp    8016a9 <write+0x53>
+		return -E_NOT_SUPP;
+  8016fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801700:	eb a7                	jmp    8016a9 <write+0x53>
+
+00801702 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801708:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170b:	50                   	push   %eax
+  80170c:	ff 75 08             	push   0x8(%ebp)
+  80170f:	e8 ba fb ff ff       	call   8012ce <fd_lookup>
+  801714:	83 c4 10             	add    $0x10,%esp
+  801717:	85 c0                	test   %eax,%eax
+  801719:	78 0e                	js     801729 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80171b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801721:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801724:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801729:	c9                   	leave
+  80172a:	c3                   	ret
+
+0080172b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	56                   	push   %esi
+  80172f:	53                   	push   %ebx
+  801730:	83 ec 18             	sub    $0x18,%esp
+  801733:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801736:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801739:	50                   	push   %eax
+  80173a:	53                   	push   %ebx
+  80173b:	e8 8e fb ff ff       	call   8012ce <fd_lookup>
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	85 c0                	test   %eax,%eax
+  801745:	78 34                	js     80177b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801747:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801750:	50                   	push   %eax
+  801751:	ff 36                	push   (%esi)
+  801753:	e8 c6 fb ff ff       	call   80131e <dev_lookup>
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	78 1c                	js     80177b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80175f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801763:	74 1d                	je     801782 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801768:	8b 40 18             	mov    0x18(%eax),%eax
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	74 5e                	je     8017cd <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80176f:	83 ec 08             	sub    $0x8,%esp
+  801772:	ff 75 0c             	push   0xc(%ebp)
+  801775:	56                   	push   %esi
+  801776:	ff d0                	call   *%eax
+  801778:	83 c4 10             	add    $0x10,%esp
+}
+  80177b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5d                   	pop    %ebp
+  801781:	c3                   	ret
+  801782:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801784:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80178a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80178f:	77 18                	ja     8017a9 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801791:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801796:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801798:	c1 e8 10             	shr    $0x10,%eax
+  80179b:	74 0c                	je     8017a9 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80179d:	c1 e0 10             	shl    $0x10,%eax
+  8017a0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8017a5:	29 c2                	sub    %eax,%edx
+  8017a7:	eb 06                	jmp    8017af <ftruncate+0x84>
+		return pthread_main_tls;
+  8017a9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8017af:	8b 02                	mov    (%edx),%eax
+  8017b1:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017b4:	83 ec 04             	sub    $0x4,%esp
+  8017b7:	53                   	push   %ebx
+  8017b8:	50                   	push   %eax
+  8017b9:	68 b4 4b 80 00       	push   $0x804bb4
+  8017be:	e8 3f ea ff ff       	call   800202 <cprintf>
+		return -E_INVAL;
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017cb:	eb ae                	jmp    80177b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d2:	eb a7                	jmp    80177b <ftruncate+0x50>
+
+008017d4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 18             	sub    $0x18,%esp
+  8017dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e2:	50                   	push   %eax
+  8017e3:	ff 75 08             	push   0x8(%ebp)
+  8017e6:	e8 e3 fa ff ff       	call   8012ce <fd_lookup>
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 49                	js     80183b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f5:	83 ec 08             	sub    $0x8,%esp
+  8017f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fb:	50                   	push   %eax
+  8017fc:	ff 36                	push   (%esi)
+  8017fe:	e8 1b fb ff ff       	call   80131e <dev_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 31                	js     80183b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80180a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801811:	74 2f                	je     801842 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801813:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801816:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80181d:	00 00 00 
+	stat->st_isdir = 0;
+  801820:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801827:	00 00 00 
+	stat->st_dev = dev;
+  80182a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801830:	83 ec 08             	sub    $0x8,%esp
+  801833:	53                   	push   %ebx
+  801834:	56                   	push   %esi
+  801835:	ff 50 14             	call   *0x14(%eax)
+  801838:	83 c4 10             	add    $0x10,%esp
+}
+  80183b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183e:	5b                   	pop    %ebx
+  80183f:	5e                   	pop    %esi
+  801840:	5d                   	pop    %ebp
+  801841:	c3                   	ret
+		return -E_NOT_SUPP;
+  801842:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801847:	eb f2                	jmp    80183b <fstat+0x67>
+
+00801849 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801849:	55                   	push   %ebp
+  80184a:	89 e5                	mov    %esp,%ebp
+  80184c:	56                   	push   %esi
+  80184d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80184e:	83 ec 08             	sub    $0x8,%esp
+  801851:	6a 00                	push   $0x0
+  801853:	ff 75 08             	push   0x8(%ebp)
+  801856:	e8 4b 03 00 00       	call   801ba6 <open>
+  80185b:	89 c3                	mov    %eax,%ebx
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	78 1b                	js     80187f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	ff 75 0c             	push   0xc(%ebp)
+  80186a:	50                   	push   %eax
+  80186b:	e8 64 ff ff ff       	call   8017d4 <fstat>
+  801870:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801872:	89 1c 24             	mov    %ebx,(%esp)
+  801875:	e8 a8 fb ff ff       	call   801422 <close>
+	return r;
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	89 f3                	mov    %esi,%ebx
+}
+  80187f:	89 d8                	mov    %ebx,%eax
+  801881:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801884:	5b                   	pop    %ebx
+  801885:	5e                   	pop    %esi
+  801886:	5d                   	pop    %ebp
+  801887:	c3                   	ret
+
+00801888 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	89 c6                	mov    %eax,%esi
+  80188f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801891:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801898:	74 27                	je     8018c1 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80189a:	6a 07                	push   $0x7
+  80189c:	68 00 70 80 00       	push   $0x807000
+  8018a1:	56                   	push   %esi
+  8018a2:	ff 35 00 60 80 00    	push   0x806000
+  8018a8:	e8 0f f9 ff ff       	call   8011bc <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018ad:	83 c4 0c             	add    $0xc,%esp
+  8018b0:	6a 00                	push   $0x0
+  8018b2:	53                   	push   %ebx
+  8018b3:	6a 00                	push   $0x0
+  8018b5:	e8 0c f8 ff ff       	call   8010c6 <ipc_recv>
+}
+  8018ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018bd:	5b                   	pop    %ebx
+  8018be:	5e                   	pop    %esi
+  8018bf:	5d                   	pop    %ebp
+  8018c0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018c1:	83 ec 0c             	sub    $0xc,%esp
+  8018c4:	6a 01                	push   $0x1
+  8018c6:	e8 47 f9 ff ff       	call   801212 <ipc_find_env>
+  8018cb:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018d0:	83 c4 10             	add    $0x10,%esp
+  8018d3:	eb c5                	jmp    80189a <fsipc+0x12>
+
+008018d5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	53                   	push   %ebx
+  8018d9:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8018dc:	68 04 60 80 00       	push   $0x806004
+  8018e1:	e8 29 1b 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ec:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8018f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f4:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8018f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801903:	e8 80 ff ff ff       	call   801888 <fsipc>
+  801908:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80190a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801911:	e8 66 1b 00 00       	call   80347c <mutex_unlock>
+	return r;
+}
+  801916:	89 d8                	mov    %ebx,%eax
+  801918:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+0080191d <devfile_flush>:
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	53                   	push   %ebx
+  801921:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801924:	68 04 60 80 00       	push   $0x806004
+  801929:	e8 e1 1a 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801931:	8b 40 0c             	mov    0xc(%eax),%eax
+  801934:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801943:	e8 40 ff ff ff       	call   801888 <fsipc>
+  801948:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80194a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801951:	e8 26 1b 00 00       	call   80347c <mutex_unlock>
+}
+  801956:	89 d8                	mov    %ebx,%eax
+  801958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195b:	c9                   	leave
+  80195c:	c3                   	ret
+
+0080195d <devfile_stat>:
+{
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	56                   	push   %esi
+  801961:	53                   	push   %ebx
+  801962:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801965:	83 ec 0c             	sub    $0xc,%esp
+  801968:	68 04 60 80 00       	push   $0x806004
+  80196d:	e8 9d 1a 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801972:	8b 45 08             	mov    0x8(%ebp),%eax
+  801975:	8b 40 0c             	mov    0xc(%eax),%eax
+  801978:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80197d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801982:	b8 05 00 00 00       	mov    $0x5,%eax
+  801987:	e8 fc fe ff ff       	call   801888 <fsipc>
+  80198c:	89 c3                	mov    %eax,%ebx
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	85 c0                	test   %eax,%eax
+  801993:	79 16                	jns    8019ab <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	68 04 60 80 00       	push   $0x806004
+  80199d:	e8 da 1a 00 00       	call   80347c <mutex_unlock>
+}
+  8019a2:	89 d8                	mov    %ebx,%eax
+  8019a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a7:	5b                   	pop    %ebx
+  8019a8:	5e                   	pop    %esi
+  8019a9:	5d                   	pop    %ebp
+  8019aa:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019ab:	83 ec 08             	sub    $0x8,%esp
+  8019ae:	68 00 70 80 00       	push   $0x807000
+  8019b3:	56                   	push   %esi
+  8019b4:	e8 2d ee ff ff       	call   8007e6 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8019b9:	a1 80 70 80 00       	mov    0x807080,%eax
+  8019be:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019c4:	a1 84 70 80 00       	mov    0x807084,%eax
+  8019c9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8019cf:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8019d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d7:	eb bc                	jmp    801995 <devfile_stat+0x38>
+
+008019d9 <devfile_write>:
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	53                   	push   %ebx
+  8019dd:	83 ec 10             	sub    $0x10,%esp
+  8019e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8019e3:	68 04 60 80 00       	push   $0x806004
+  8019e8:	e8 22 1a 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f3:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801a01:	76 3d                	jbe    801a40 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801a03:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a08:	39 c3                	cmp    %eax,%ebx
+  801a0a:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801a0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a10:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801a15:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a20:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a25:	e8 5e fe ff ff       	call   801888 <fsipc>
+  801a2a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+  801a2f:	68 04 60 80 00       	push   $0x806004
+  801a34:	e8 43 1a 00 00       	call   80347c <mutex_unlock>
+}
+  801a39:	89 d8                	mov    %ebx,%eax
+  801a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3e:	c9                   	leave
+  801a3f:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801a40:	83 ec 04             	sub    $0x4,%esp
+  801a43:	53                   	push   %ebx
+  801a44:	ff 75 0c             	push   0xc(%ebp)
+  801a47:	68 0c 70 80 00       	push   $0x80700c
+  801a4c:	e8 1b ef ff ff       	call   80096c <memmove>
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a59:	eb b5                	jmp    801a10 <devfile_write+0x37>
+
+00801a5b <devfile_read>:
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	57                   	push   %edi
+  801a5f:	56                   	push   %esi
+  801a60:	53                   	push   %ebx
+  801a61:	83 ec 0c             	sub    $0xc,%esp
+  801a64:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a67:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801a6d:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a73:	0f 86 8c 00 00 00    	jbe    801b05 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801a79:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a7e:	39 c3                	cmp    %eax,%ebx
+  801a80:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a83:	89 f8                	mov    %edi,%eax
+  801a85:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801a88:	eb 0f                	jmp    801a99 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801a8a:	0f b6 08             	movzbl (%eax),%ecx
+  801a8d:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801a8f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a94:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a99:	39 d0                	cmp    %edx,%eax
+  801a9b:	72 ed                	jb     801a8a <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801a9d:	83 ec 0c             	sub    $0xc,%esp
+  801aa0:	68 04 60 80 00       	push   $0x806004
+  801aa5:	e8 65 19 00 00       	call   80340f <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aaa:	8b 46 0c             	mov    0xc(%esi),%eax
+  801aad:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801ab2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801ab8:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  801abe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ac8:	e8 bb fd ff ff       	call   801888 <fsipc>
+  801acd:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801acf:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ad6:	e8 a1 19 00 00       	call   80347c <mutex_unlock>
+		assert(r <= (int) n);
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	39 f3                	cmp    %esi,%ebx
+  801ae0:	7c 0a                	jl     801aec <devfile_read+0x91>
+}
+  801ae2:	89 f0                	mov    %esi,%eax
+  801ae4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae7:	5b                   	pop    %ebx
+  801ae8:	5e                   	pop    %esi
+  801ae9:	5f                   	pop    %edi
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+		assert(r <= (int) n);
+  801aec:	68 24 4c 80 00       	push   $0x804c24
+  801af1:	68 31 4c 80 00       	push   $0x804c31
+  801af6:	68 90 00 00 00       	push   $0x90
+  801afb:	68 46 4c 80 00       	push   $0x804c46
+  801b00:	e8 8a 22 00 00       	call   803d8f <_panic>
+	mutex_lock(&fsipc_mu);
+  801b05:	83 ec 0c             	sub    $0xc,%esp
+  801b08:	68 04 60 80 00       	push   $0x806004
+  801b0d:	e8 fd 18 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b12:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b15:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801b1a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801b20:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801b27:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b34:	e8 4f fd ff ff       	call   801888 <fsipc>
+  801b39:	89 c6                	mov    %eax,%esi
+  801b3b:	83 c4 10             	add    $0x10,%esp
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	78 1d                	js     801b5f <devfile_read+0x104>
+		assert(r <= n);
+  801b42:	39 c3                	cmp    %eax,%ebx
+  801b44:	72 2e                	jb     801b74 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801b46:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b4b:	7f 40                	jg     801b8d <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b4d:	83 ec 04             	sub    $0x4,%esp
+  801b50:	50                   	push   %eax
+  801b51:	68 00 70 80 00       	push   $0x807000
+  801b56:	57                   	push   %edi
+  801b57:	e8 10 ee ff ff       	call   80096c <memmove>
+  801b5c:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801b5f:	83 ec 0c             	sub    $0xc,%esp
+  801b62:	68 04 60 80 00       	push   $0x806004
+  801b67:	e8 10 19 00 00       	call   80347c <mutex_unlock>
+	return r;
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	e9 6e ff ff ff       	jmp    801ae2 <devfile_read+0x87>
+		assert(r <= n);
+  801b74:	68 51 4c 80 00       	push   $0x804c51
+  801b79:	68 31 4c 80 00       	push   $0x804c31
+  801b7e:	68 99 00 00 00       	push   $0x99
+  801b83:	68 46 4c 80 00       	push   $0x804c46
+  801b88:	e8 02 22 00 00       	call   803d8f <_panic>
+		assert(r <= PGSIZE);
+  801b8d:	68 58 4c 80 00       	push   $0x804c58
+  801b92:	68 31 4c 80 00       	push   $0x804c31
+  801b97:	68 9a 00 00 00       	push   $0x9a
+  801b9c:	68 46 4c 80 00       	push   $0x804c46
+  801ba1:	e8 e9 21 00 00       	call   803d8f <_panic>
+
+00801ba6 <open>:
+{
+  801ba6:	55                   	push   %ebp
+  801ba7:	89 e5                	mov    %esp,%ebp
+  801ba9:	56                   	push   %esi
+  801baa:	53                   	push   %ebx
+  801bab:	83 ec 1c             	sub    $0x1c,%esp
+  801bae:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bb1:	56                   	push   %esi
+  801bb2:	e8 f4 eb ff ff       	call   8007ab <strlen>
+  801bb7:	83 c4 10             	add    $0x10,%esp
+  801bba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bbf:	0f 8f 85 00 00 00    	jg     801c4a <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bc5:	83 ec 0c             	sub    $0xc,%esp
+  801bc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	e8 a7 f6 ff ff       	call   801278 <fd_alloc>
+  801bd1:	89 c3                	mov    %eax,%ebx
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 55                	js     801c2f <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801bda:	83 ec 0c             	sub    $0xc,%esp
+  801bdd:	68 04 60 80 00       	push   $0x806004
+  801be2:	e8 28 18 00 00       	call   80340f <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801be7:	83 c4 08             	add    $0x8,%esp
+  801bea:	56                   	push   %esi
+  801beb:	68 00 70 80 00       	push   $0x807000
+  801bf0:	e8 f1 eb ff ff       	call   8007e6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf8:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801bfd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c00:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c05:	e8 7e fc ff ff       	call   801888 <fsipc>
+  801c0a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801c0c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801c13:	e8 64 18 00 00       	call   80347c <mutex_unlock>
+	if (r < 0) {
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	85 db                	test   %ebx,%ebx
+  801c1d:	78 19                	js     801c38 <open+0x92>
+	return fd2num(fd);
+  801c1f:	83 ec 0c             	sub    $0xc,%esp
+  801c22:	ff 75 f4             	push   -0xc(%ebp)
+  801c25:	e8 27 f6 ff ff       	call   801251 <fd2num>
+  801c2a:	89 c3                	mov    %eax,%ebx
+  801c2c:	83 c4 10             	add    $0x10,%esp
+}
+  801c2f:	89 d8                	mov    %ebx,%eax
+  801c31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c34:	5b                   	pop    %ebx
+  801c35:	5e                   	pop    %esi
+  801c36:	5d                   	pop    %ebp
+  801c37:	c3                   	ret
+		fd_close(fd, 0);
+  801c38:	83 ec 08             	sub    $0x8,%esp
+  801c3b:	6a 00                	push   $0x0
+  801c3d:	ff 75 f4             	push   -0xc(%ebp)
+  801c40:	e8 56 f7 ff ff       	call   80139b <fd_close>
+		return r;
+  801c45:	83 c4 10             	add    $0x10,%esp
+  801c48:	eb e5                	jmp    801c2f <open+0x89>
+		return -E_BAD_PATH;
+  801c4a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c4f:	eb de                	jmp    801c2f <open+0x89>
+
+00801c51 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5b:	50                   	push   %eax
+  801c5c:	ff 75 08             	push   0x8(%ebp)
+  801c5f:	e8 6a f6 ff ff       	call   8012ce <fd_lookup>
+  801c64:	89 c3                	mov    %eax,%ebx
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 5b                	js     801cc8 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c70:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c76:	39 08                	cmp    %ecx,(%eax)
+  801c78:	75 55                	jne    801ccf <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801c7a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801c7e:	74 56                	je     801cd6 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801c80:	83 ec 0c             	sub    $0xc,%esp
+  801c83:	68 04 60 80 00       	push   $0x806004
+  801c88:	e8 82 17 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801c8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c90:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c93:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801c98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c9b:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801ca0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ca3:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cad:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801cb2:	e8 d1 fb ff ff       	call   801888 <fsipc>
+  801cb7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cb9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801cc0:	e8 b7 17 00 00       	call   80347c <mutex_unlock>
+	return r;
+  801cc5:	83 c4 10             	add    $0x10,%esp
+}
+  801cc8:	89 d8                	mov    %ebx,%eax
+  801cca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ccf:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801cd4:	eb f2                	jmp    801cc8 <fallocate+0x77>
+		return -E_INVAL;
+  801cd6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801cdb:	eb eb                	jmp    801cc8 <fallocate+0x77>
+
+00801cdd <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801cdd:	55                   	push   %ebp
+  801cde:	89 e5                	mov    %esp,%ebp
+  801ce0:	56                   	push   %esi
+  801ce1:	53                   	push   %ebx
+  801ce2:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ce5:	89 f3                	mov    %esi,%ebx
+  801ce7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801ced:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801cf0:	eb 06                	jmp    801cf8 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801cf2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801cf8:	39 f3                	cmp    %esi,%ebx
+  801cfa:	73 14                	jae    801d10 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801cfc:	83 ec 08             	sub    $0x8,%esp
+  801cff:	53                   	push   %ebx
+  801d00:	6a 00                	push   $0x0
+  801d02:	e8 b6 ef ff ff       	call   800cbd <sys_page_unmap>
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	79 e4                	jns    801cf2 <munmap+0x15>
+  801d0e:	eb 05                	jmp    801d15 <munmap+0x38>
+			return r;
+	return 0;
+  801d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d18:	5b                   	pop    %ebx
+  801d19:	5e                   	pop    %esi
+  801d1a:	5d                   	pop    %ebp
+  801d1b:	c3                   	ret
+
+00801d1c <mmap>:
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	57                   	push   %edi
+  801d20:	56                   	push   %esi
+  801d21:	53                   	push   %ebx
+  801d22:	83 ec 24             	sub    $0x24,%esp
+  801d25:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d28:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d2b:	50                   	push   %eax
+  801d2c:	ff 75 08             	push   0x8(%ebp)
+  801d2f:	e8 9a f5 ff ff       	call   8012ce <fd_lookup>
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	0f 88 37 01 00 00    	js     801e76 <mmap+0x15a>
+		return NULL;
+  801d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d44:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d47:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801d4d:	39 0a                	cmp    %ecx,(%edx)
+  801d4f:	0f 85 05 01 00 00    	jne    801e5a <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801d55:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801d5c:	0f 85 1b 01 00 00    	jne    801e7d <mmap+0x161>
+  801d62:	89 f0                	mov    %esi,%eax
+  801d64:	83 e8 01             	sub    $0x1,%eax
+  801d67:	0f 88 17 01 00 00    	js     801e84 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801d6d:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801d71:	75 28                	jne    801d9b <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801d73:	83 ec 0c             	sub    $0xc,%esp
+  801d76:	68 04 60 80 00       	push   $0x806004
+  801d7b:	e8 8f 16 00 00       	call   80340f <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d80:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801d86:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801d94:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801d99:	eb 2b                	jmp    801dc6 <mmap+0xaa>
+		cow_enable();
+  801d9b:	e8 3a 22 00 00       	call   803fda <cow_enable>
+  801da0:	eb d1                	jmp    801d73 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801da2:	89 c2                	mov    %eax,%edx
+  801da4:	c1 ea 0c             	shr    $0xc,%edx
+  801da7:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801dae:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801db4:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801dba:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801dbd:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801dbf:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801dc4:	77 25                	ja     801deb <mmap+0xcf>
+  801dc6:	89 c2                	mov    %eax,%edx
+  801dc8:	29 da                	sub    %ebx,%edx
+  801dca:	39 ca                	cmp    %ecx,%edx
+  801dcc:	73 3a                	jae    801e08 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801dce:	89 c2                	mov    %eax,%edx
+  801dd0:	c1 ea 16             	shr    $0x16,%edx
+  801dd3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801dda:	f6 c2 01             	test   $0x1,%dl
+  801ddd:	75 c3                	jne    801da2 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801ddf:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801de4:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801de9:	eb d4                	jmp    801dbf <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801deb:	29 d8                	sub    %ebx,%eax
+  801ded:	39 c8                	cmp    %ecx,%eax
+  801def:	73 17                	jae    801e08 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+  801df4:	68 04 60 80 00       	push   $0x806004
+  801df9:	e8 7e 16 00 00       	call   80347c <mutex_unlock>
+		return NULL;
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e06:	eb 52                	jmp    801e5a <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801e08:	85 db                	test   %ebx,%ebx
+  801e0a:	74 e5                	je     801df1 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801e0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e0f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e12:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801e17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e1a:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801e1f:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801e25:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801e2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e2e:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e38:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e3d:	e8 46 fa ff ff       	call   801888 <fsipc>
+  801e42:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	68 04 60 80 00       	push   $0x806004
+  801e4c:	e8 2b 16 00 00       	call   80347c <mutex_unlock>
+	if (r < 0) {
+  801e51:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801e54:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801e56:	85 ff                	test   %edi,%edi
+  801e58:	78 08                	js     801e62 <mmap+0x146>
+}
+  801e5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5d:	5b                   	pop    %ebx
+  801e5e:	5e                   	pop    %esi
+  801e5f:	5f                   	pop    %edi
+  801e60:	5d                   	pop    %ebp
+  801e61:	c3                   	ret
+		munmap((void*) va, len);
+  801e62:	83 ec 08             	sub    $0x8,%esp
+  801e65:	56                   	push   %esi
+  801e66:	53                   	push   %ebx
+  801e67:	e8 71 fe ff ff       	call   801cdd <munmap>
+		return NULL;
+  801e6c:	83 c4 10             	add    $0x10,%esp
+  801e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e74:	eb e4                	jmp    801e5a <mmap+0x13e>
+		return NULL;
+  801e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7b:	eb dd                	jmp    801e5a <mmap+0x13e>
+		return NULL;
+  801e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e82:	eb d6                	jmp    801e5a <mmap+0x13e>
+  801e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e89:	eb cf                	jmp    801e5a <mmap+0x13e>
+
+00801e8b <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	53                   	push   %ebx
+  801e8f:	83 ec 10             	sub    $0x10,%esp
+  801e92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801e95:	53                   	push   %ebx
+  801e96:	e8 10 e9 ff ff       	call   8007ab <strlen>
+  801e9b:	83 c4 10             	add    $0x10,%esp
+  801e9e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ea3:	7f 42                	jg     801ee7 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801ea5:	83 ec 0c             	sub    $0xc,%esp
+  801ea8:	68 04 60 80 00       	push   $0x806004
+  801ead:	e8 5d 15 00 00       	call   80340f <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801eb2:	83 c4 08             	add    $0x8,%esp
+  801eb5:	53                   	push   %ebx
+  801eb6:	68 00 70 80 00       	push   $0x807000
+  801ebb:	e8 26 e9 ff ff       	call   8007e6 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801ec0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec5:	b8 07 00 00 00       	mov    $0x7,%eax
+  801eca:	e8 b9 f9 ff ff       	call   801888 <fsipc>
+  801ecf:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ed1:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ed8:	e8 9f 15 00 00       	call   80347c <mutex_unlock>
+	return r;
+  801edd:	83 c4 10             	add    $0x10,%esp
+}
+  801ee0:	89 d8                	mov    %ebx,%eax
+  801ee2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee5:	c9                   	leave
+  801ee6:	c3                   	ret
+		return -E_BAD_PATH;
+  801ee7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801eec:	eb f2                	jmp    801ee0 <remove+0x55>
+
+00801eee <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801eee:	55                   	push   %ebp
+  801eef:	89 e5                	mov    %esp,%ebp
+  801ef1:	53                   	push   %ebx
+  801ef2:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ef5:	68 04 60 80 00       	push   $0x806004
+  801efa:	e8 10 15 00 00       	call   80340f <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f04:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f09:	e8 7a f9 ff ff       	call   801888 <fsipc>
+  801f0e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f10:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801f17:	e8 60 15 00 00       	call   80347c <mutex_unlock>
+	return r;
+}
+  801f1c:	89 d8                	mov    %ebx,%eax
+  801f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	56                   	push   %esi
+  801f27:	53                   	push   %ebx
+  801f28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f2b:	83 ec 0c             	sub    $0xc,%esp
+  801f2e:	68 04 60 80 00       	push   $0x806004
+  801f33:	e8 d7 14 00 00       	call   80340f <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3b:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f45:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f4a:	e8 39 f9 ff ff       	call   801888 <fsipc>
+  801f4f:	89 c6                	mov    %eax,%esi
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 db                	test   %ebx,%ebx
+  801f56:	74 7b                	je     801fd3 <fs_bcstat+0xb0>
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 77                	js     801fd3 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801f5c:	a1 00 70 80 00       	mov    0x807000,%eax
+  801f61:	89 03                	mov    %eax,(%ebx)
+  801f63:	a1 04 70 80 00       	mov    0x807004,%eax
+  801f68:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f6b:	a1 08 70 80 00       	mov    0x807008,%eax
+  801f70:	89 43 08             	mov    %eax,0x8(%ebx)
+  801f73:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801f78:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801f7b:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f80:	89 43 10             	mov    %eax,0x10(%ebx)
+  801f83:	a1 14 70 80 00       	mov    0x807014,%eax
+  801f88:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f8b:	a1 18 70 80 00       	mov    0x807018,%eax
+  801f90:	89 43 18             	mov    %eax,0x18(%ebx)
+  801f93:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801f98:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801f9b:	a1 20 70 80 00       	mov    0x807020,%eax
+  801fa0:	89 43 20             	mov    %eax,0x20(%ebx)
+  801fa3:	a1 24 70 80 00       	mov    0x807024,%eax
+  801fa8:	89 43 24             	mov    %eax,0x24(%ebx)
+  801fab:	a1 28 70 80 00       	mov    0x807028,%eax
+  801fb0:	89 43 28             	mov    %eax,0x28(%ebx)
+  801fb3:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801fb8:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801fbb:	a1 30 70 80 00       	mov    0x807030,%eax
+  801fc0:	89 43 30             	mov    %eax,0x30(%ebx)
+  801fc3:	a1 34 70 80 00       	mov    0x807034,%eax
+  801fc8:	89 43 34             	mov    %eax,0x34(%ebx)
+  801fcb:	a1 38 70 80 00       	mov    0x807038,%eax
+  801fd0:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801fd3:	83 ec 0c             	sub    $0xc,%esp
+  801fd6:	68 04 60 80 00       	push   $0x806004
+  801fdb:	e8 9c 14 00 00       	call   80347c <mutex_unlock>
+	return r;
+}
+  801fe0:	89 f0                	mov    %esi,%eax
+  801fe2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe5:	5b                   	pop    %ebx
+  801fe6:	5e                   	pop    %esi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+
+00801fe9 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	56                   	push   %esi
+  801fed:	53                   	push   %ebx
+  801fee:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801ff0:	0f b6 10             	movzbl (%eax),%edx
+  801ff3:	80 fa 72             	cmp    $0x72,%dl
+  801ff6:	74 44                	je     80203c <parse_mode+0x53>
+  801ff8:	80 fa 77             	cmp    $0x77,%dl
+  801ffb:	74 4b                	je     802048 <parse_mode+0x5f>
+  801ffd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802002:	80 fa 61             	cmp    $0x61,%dl
+  802005:	74 09                	je     802010 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802007:	89 d8                	mov    %ebx,%eax
+  802009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80200c:	5b                   	pop    %ebx
+  80200d:	5e                   	pop    %esi
+  80200e:	5d                   	pop    %ebp
+  80200f:	c3                   	ret
+	switch (mode[0]) {
+  802010:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802015:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80201a:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80201c:	83 ec 08             	sub    $0x8,%esp
+  80201f:	6a 2b                	push   $0x2b
+  802021:	50                   	push   %eax
+  802022:	e8 d1 e8 ff ff       	call   8008f8 <strchr>
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	74 d9                	je     802007 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80202e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802031:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802034:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80203a:	eb cb                	jmp    802007 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80203c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802041:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802046:	eb d2                	jmp    80201a <parse_mode+0x31>
+  802048:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80204d:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802052:	eb c6                	jmp    80201a <parse_mode+0x31>
+
+00802054 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	57                   	push   %edi
+  802058:	56                   	push   %esi
+  802059:	53                   	push   %ebx
+  80205a:	83 ec 1c             	sub    $0x1c,%esp
+  80205d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802060:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802063:	b8 24 50 80 00       	mov    $0x805024,%eax
+  802068:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80206d:	83 c0 24             	add    $0x24,%eax
+  802070:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802074:	74 17                	je     80208d <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802076:	83 c3 01             	add    $0x1,%ebx
+  802079:	83 fb 10             	cmp    $0x10,%ebx
+  80207c:	75 ef                	jne    80206d <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80207e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802083:	89 f0                	mov    %esi,%eax
+  802085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802088:	5b                   	pop    %ebx
+  802089:	5e                   	pop    %esi
+  80208a:	5f                   	pop    %edi
+  80208b:	5d                   	pop    %ebp
+  80208c:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80208d:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802094:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802097:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80209a:	c1 e7 02             	shl    $0x2,%edi
+  80209d:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8020a3:	83 ec 04             	sub    $0x4,%esp
+  8020a6:	6a 24                	push   $0x24
+  8020a8:	6a 00                	push   $0x0
+  8020aa:	56                   	push   %esi
+  8020ab:	e8 87 e8 ff ff       	call   800937 <memset>
+			streams[i].f_fd = fd;
+  8020b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8020b3:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8020b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8020bc:	01 d8                	add    %ebx,%eax
+  8020be:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020c1:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8020c8:	83 c4 10             	add    $0x10,%esp
+  8020cb:	eb b6                	jmp    802083 <stream_alloc+0x2f>
+
+008020cd <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	53                   	push   %ebx
+  8020d1:	83 ec 14             	sub    $0x14,%esp
+  8020d4:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8020d6:	8b 40 18             	mov    0x18(%eax),%eax
+  8020d9:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8020dc:	74 4a                	je     802128 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8020de:	83 ec 08             	sub    $0x8,%esp
+  8020e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e4:	50                   	push   %eax
+  8020e5:	ff 33                	push   (%ebx)
+  8020e7:	e8 e2 f1 ff ff       	call   8012ce <fd_lookup>
+  8020ec:	89 c2                	mov    %eax,%edx
+  8020ee:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020f1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8020f6:	85 d2                	test   %edx,%edx
+  8020f8:	78 41                	js     80213b <stream_unread+0x6e>
+  8020fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020fd:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802103:	39 0a                	cmp    %ecx,(%edx)
+  802105:	75 34                	jne    80213b <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802107:	8b 43 14             	mov    0x14(%ebx),%eax
+  80210a:	03 42 04             	add    0x4(%edx),%eax
+  80210d:	2b 43 18             	sub    0x18(%ebx),%eax
+  802110:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802113:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80211a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802121:	b8 01 00 00 00       	mov    $0x1,%eax
+  802126:	eb 13                	jmp    80213b <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802128:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80212f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802136:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80213b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <stream_drain>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	56                   	push   %esi
+  802144:	53                   	push   %ebx
+  802145:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802147:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80214c:	eb 02                	jmp    802150 <stream_drain+0x10>
+  80214e:	01 c3                	add    %eax,%ebx
+  802150:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802153:	39 c3                	cmp    %eax,%ebx
+  802155:	73 43                	jae    80219a <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802157:	83 ec 04             	sub    $0x4,%esp
+  80215a:	29 d8                	sub    %ebx,%eax
+  80215c:	50                   	push   %eax
+  80215d:	89 d8                	mov    %ebx,%eax
+  80215f:	03 46 0c             	add    0xc(%esi),%eax
+  802162:	50                   	push   %eax
+  802163:	ff 36                	push   (%esi)
+  802165:	e8 ec f4 ff ff       	call   801656 <write>
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	7f dd                	jg     80214e <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802171:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802175:	8b 56 0c             	mov    0xc(%esi),%edx
+  802178:	83 ec 04             	sub    $0x4,%esp
+  80217b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80217e:	29 d8                	sub    %ebx,%eax
+  802180:	50                   	push   %eax
+  802181:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802184:	50                   	push   %eax
+  802185:	52                   	push   %edx
+  802186:	e8 e1 e7 ff ff       	call   80096c <memmove>
+			f->f_wend -= done;
+  80218b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80218e:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802198:	eb 0a                	jmp    8021a4 <stream_drain+0x64>
+  80219a:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80219f:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8021a4:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8021a7:	89 d0                	mov    %edx,%eax
+  8021a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ac:	5b                   	pop    %ebx
+  8021ad:	5e                   	pop    %esi
+  8021ae:	5d                   	pop    %ebp
+  8021af:	c3                   	ret
+
+008021b0 <stream_setup>:
+	if (f->f_buf)
+  8021b0:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021b4:	74 01                	je     8021b7 <stream_setup+0x7>
+  8021b6:	c3                   	ret
+{
+  8021b7:	55                   	push   %ebp
+  8021b8:	89 e5                	mov    %esp,%ebp
+  8021ba:	53                   	push   %ebx
+  8021bb:	83 ec 04             	sub    $0x4,%esp
+  8021be:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8021c0:	8b 40 08             	mov    0x8(%eax),%eax
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	74 17                	je     8021de <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8021c7:	83 f8 03             	cmp    $0x3,%eax
+  8021ca:	75 2d                	jne    8021f9 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8021cc:	8d 43 20             	lea    0x20(%ebx),%eax
+  8021cf:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8021d2:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8021d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021dc:	c9                   	leave
+  8021dd:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8021de:	83 ec 0c             	sub    $0xc,%esp
+  8021e1:	ff 33                	push   (%ebx)
+  8021e3:	e8 29 1b 00 00       	call   803d11 <iscons>
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	0f 9f c0             	setg   %al
+  8021f0:	0f b6 c0             	movzbl %al,%eax
+  8021f3:	83 c0 01             	add    $0x1,%eax
+  8021f6:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8021f9:	83 ec 0c             	sub    $0xc,%esp
+  8021fc:	68 00 10 00 00       	push   $0x1000
+  802201:	e8 6e 0b 00 00       	call   802d74 <malloc>
+  802206:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802209:	83 c4 10             	add    $0x10,%esp
+  80220c:	85 c0                	test   %eax,%eax
+  80220e:	74 bc                	je     8021cc <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802210:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802217:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80221b:	eb bc                	jmp    8021d9 <stream_setup+0x29>
+
+0080221d <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	53                   	push   %ebx
+  802221:	83 ec 04             	sub    $0x4,%esp
+  802224:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802226:	e8 85 ff ff ff       	call   8021b0 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80222b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802230:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802234:	74 3d                	je     802273 <stream_fill+0x56>
+  802236:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80223a:	74 10                	je     80224c <stream_fill+0x2f>
+  80223c:	89 d8                	mov    %ebx,%eax
+  80223e:	e8 fd fe ff ff       	call   802140 <stream_drain>
+		return 0;
+  802243:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 27                	js     802273 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80224c:	83 ec 04             	sub    $0x4,%esp
+  80224f:	ff 73 10             	push   0x10(%ebx)
+  802252:	ff 73 0c             	push   0xc(%ebx)
+  802255:	ff 33                	push   (%ebx)
+  802257:	e8 02 f3 ff ff       	call   80155e <read>
+  80225c:	83 c4 10             	add    $0x10,%esp
+  80225f:	85 c0                	test   %eax,%eax
+  802261:	7e 17                	jle    80227a <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802263:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802267:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80226e:	89 c2                	mov    %eax,%edx
+  802270:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802273:	89 d0                	mov    %edx,%eax
+  802275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80227a:	c1 f8 1f             	sar    $0x1f,%eax
+  80227d:	83 e0 04             	and    $0x4,%eax
+  802280:	83 c0 04             	add    $0x4,%eax
+  802283:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228b:	eb e6                	jmp    802273 <stream_fill+0x56>
+
+0080228d <fopen>:
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	57                   	push   %edi
+  802291:	56                   	push   %esi
+  802292:	53                   	push   %ebx
+  802293:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802299:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80229c:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8022a2:	89 f0                	mov    %esi,%eax
+  8022a4:	e8 40 fd ff ff       	call   801fe9 <parse_mode>
+		return 0;
+  8022a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 2d                	js     8022df <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8022b2:	83 ec 08             	sub    $0x8,%esp
+  8022b5:	50                   	push   %eax
+  8022b6:	ff 75 08             	push   0x8(%ebp)
+  8022b9:	e8 e8 f8 ff ff       	call   801ba6 <open>
+  8022be:	89 c7                	mov    %eax,%edi
+  8022c0:	83 c4 10             	add    $0x10,%esp
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	78 58                	js     80231f <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8022c7:	80 3e 61             	cmpb   $0x61,(%esi)
+  8022ca:	74 1d                	je     8022e9 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8022cc:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8022d2:	89 f8                	mov    %edi,%eax
+  8022d4:	e8 7b fd ff ff       	call   802054 <stream_alloc>
+  8022d9:	89 c3                	mov    %eax,%ebx
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	74 32                	je     802311 <fopen+0x84>
+}
+  8022df:	89 d8                	mov    %ebx,%eax
+  8022e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e4:	5b                   	pop    %ebx
+  8022e5:	5e                   	pop    %esi
+  8022e6:	5f                   	pop    %edi
+  8022e7:	5d                   	pop    %ebp
+  8022e8:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8022e9:	83 ec 08             	sub    $0x8,%esp
+  8022ec:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	57                   	push   %edi
+  8022f4:	e8 db f4 ff ff       	call   8017d4 <fstat>
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 cc                	js     8022cc <fopen+0x3f>
+		seek(fd, st.st_size);
+  802300:	83 ec 08             	sub    $0x8,%esp
+  802303:	ff 75 dc             	push   -0x24(%ebp)
+  802306:	57                   	push   %edi
+  802307:	e8 f6 f3 ff ff       	call   801702 <seek>
+  80230c:	83 c4 10             	add    $0x10,%esp
+  80230f:	eb bb                	jmp    8022cc <fopen+0x3f>
+		close(fd);
+  802311:	83 ec 0c             	sub    $0xc,%esp
+  802314:	57                   	push   %edi
+  802315:	e8 08 f1 ff ff       	call   801422 <close>
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	eb c0                	jmp    8022df <fopen+0x52>
+		return 0;
+  80231f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802324:	eb b9                	jmp    8022df <fopen+0x52>
+
+00802326 <fdopen>:
+{
+  802326:	55                   	push   %ebp
+  802327:	89 e5                	mov    %esp,%ebp
+  802329:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80232c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80232f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802332:	e8 b2 fc ff ff       	call   801fe9 <parse_mode>
+  802337:	89 c2                	mov    %eax,%edx
+		return 0;
+  802339:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80233e:	85 d2                	test   %edx,%edx
+  802340:	78 0b                	js     80234d <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802342:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802345:	8b 45 08             	mov    0x8(%ebp),%eax
+  802348:	e8 07 fd ff ff       	call   802054 <stream_alloc>
+}
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+
+0080234f <setvbuf>:
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	57                   	push   %edi
+  802353:	56                   	push   %esi
+  802354:	53                   	push   %ebx
+  802355:	8b 45 08             	mov    0x8(%ebp),%eax
+  802358:	8b 55 10             	mov    0x10(%ebp),%edx
+  80235b:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80235e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802362:	75 3a                	jne    80239e <setvbuf+0x4f>
+  802364:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802367:	83 fe 02             	cmp    $0x2,%esi
+  80236a:	77 39                	ja     8023a5 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80236c:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80236f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802373:	0f 95 c3             	setne  %bl
+  802376:	85 ff                	test   %edi,%edi
+  802378:	0f 95 c1             	setne  %cl
+  80237b:	84 cb                	test   %cl,%bl
+  80237d:	74 05                	je     802384 <setvbuf+0x35>
+  80237f:	83 fa 03             	cmp    $0x3,%edx
+  802382:	75 0a                	jne    80238e <setvbuf+0x3f>
+	return 0;
+  802384:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802389:	5b                   	pop    %ebx
+  80238a:	5e                   	pop    %esi
+  80238b:	5f                   	pop    %edi
+  80238c:	5d                   	pop    %ebp
+  80238d:	c3                   	ret
+		f->f_buf = buf;
+  80238e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802391:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802394:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239c:	eb eb                	jmp    802389 <setvbuf+0x3a>
+		return EOF;
+  80239e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023a3:	eb e4                	jmp    802389 <setvbuf+0x3a>
+  8023a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023aa:	eb dd                	jmp    802389 <setvbuf+0x3a>
+
+008023ac <fflush>:
+{
+  8023ac:	55                   	push   %ebp
+  8023ad:	89 e5                	mov    %esp,%ebp
+  8023af:	57                   	push   %edi
+  8023b0:	56                   	push   %esi
+  8023b1:	53                   	push   %ebx
+  8023b2:	83 ec 0c             	sub    $0xc,%esp
+  8023b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8023b8:	85 db                	test   %ebx,%ebx
+  8023ba:	74 1a                	je     8023d6 <fflush+0x2a>
+	stream_unread(f);
+  8023bc:	89 d8                	mov    %ebx,%eax
+  8023be:	e8 0a fd ff ff       	call   8020cd <stream_unread>
+	return stream_drain(f);
+  8023c3:	89 d8                	mov    %ebx,%eax
+  8023c5:	e8 76 fd ff ff       	call   802140 <stream_drain>
+  8023ca:	89 c7                	mov    %eax,%edi
+}
+  8023cc:	89 f8                	mov    %edi,%eax
+  8023ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d1:	5b                   	pop    %ebx
+  8023d2:	5e                   	pop    %esi
+  8023d3:	5f                   	pop    %edi
+  8023d4:	5d                   	pop    %ebp
+  8023d5:	c3                   	ret
+  8023d6:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8023db:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8023e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e5:	eb 03                	jmp    8023ea <fflush+0x3e>
+  8023e7:	83 c3 24             	add    $0x24,%ebx
+  8023ea:	39 f3                	cmp    %esi,%ebx
+  8023ec:	74 de                	je     8023cc <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8023ee:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8023f2:	74 f3                	je     8023e7 <fflush+0x3b>
+  8023f4:	83 ec 0c             	sub    $0xc,%esp
+  8023f7:	53                   	push   %ebx
+  8023f8:	e8 af ff ff ff       	call   8023ac <fflush>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802400:	85 c0                	test   %eax,%eax
+  802402:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802407:	0f 48 f8             	cmovs  %eax,%edi
+  80240a:	eb db                	jmp    8023e7 <fflush+0x3b>
+
+0080240c <fclose>:
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	56                   	push   %esi
+  802410:	53                   	push   %ebx
+  802411:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802414:	83 ec 0c             	sub    $0xc,%esp
+  802417:	56                   	push   %esi
+  802418:	e8 8f ff ff ff       	call   8023ac <fflush>
+  80241d:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80241f:	83 c4 04             	add    $0x4,%esp
+  802422:	ff 36                	push   (%esi)
+  802424:	e8 f9 ef ff ff       	call   801422 <close>
+  802429:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802433:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802436:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80243a:	75 10                	jne    80244c <fclose+0x40>
+	f->f_flags = 0;
+  80243c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802443:	89 d8                	mov    %ebx,%eax
+  802445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802448:	5b                   	pop    %ebx
+  802449:	5e                   	pop    %esi
+  80244a:	5d                   	pop    %ebp
+  80244b:	c3                   	ret
+		free(f->f_buf);
+  80244c:	83 ec 0c             	sub    $0xc,%esp
+  80244f:	ff 76 0c             	push   0xc(%esi)
+  802452:	e8 54 08 00 00       	call   802cab <free>
+  802457:	83 c4 10             	add    $0x10,%esp
+  80245a:	eb e0                	jmp    80243c <fclose+0x30>
+
+0080245c <fileno>:
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80245f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802462:	8b 00                	mov    (%eax),%eax
+}
+  802464:	5d                   	pop    %ebp
+  802465:	c3                   	ret
+
+00802466 <feof>:
+{
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802469:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246c:	8b 40 04             	mov    0x4(%eax),%eax
+  80246f:	c1 e8 02             	shr    $0x2,%eax
+  802472:	83 e0 01             	and    $0x1,%eax
+}
+  802475:	5d                   	pop    %ebp
+  802476:	c3                   	ret
+
+00802477 <ferror>:
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80247a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247d:	8b 40 04             	mov    0x4(%eax),%eax
+  802480:	c1 e8 03             	shr    $0x3,%eax
+  802483:	83 e0 01             	and    $0x1,%eax
+}
+  802486:	5d                   	pop    %ebp
+  802487:	c3                   	ret
+
+00802488 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802488:	55                   	push   %ebp
+  802489:	89 e5                	mov    %esp,%ebp
+  80248b:	53                   	push   %ebx
+  80248c:	83 ec 04             	sub    $0x4,%esp
+  80248f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802492:	8b 43 18             	mov    0x18(%ebx),%eax
+  802495:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802498:	74 15                	je     8024af <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  80249a:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80249d:	8b 43 14             	mov    0x14(%ebx),%eax
+  8024a0:	8d 48 01             	lea    0x1(%eax),%ecx
+  8024a3:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8024a6:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8024aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8024af:	89 d8                	mov    %ebx,%eax
+  8024b1:	e8 67 fd ff ff       	call   80221d <stream_fill>
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	75 e0                	jne    80249a <fgetc+0x12>
+		return EOF;
+  8024ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024bf:	eb e9                	jmp    8024aa <fgetc+0x22>
+
+008024c1 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	57                   	push   %edi
+  8024c5:	56                   	push   %esi
+  8024c6:	53                   	push   %ebx
+  8024c7:	83 ec 1c             	sub    $0x1c,%esp
+  8024ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8024cd:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8024d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024d5:	83 e8 01             	sub    $0x1,%eax
+  8024d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8024db:	eb 66                	jmp    802543 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8024dd:	8b 46 14             	mov    0x14(%esi),%eax
+  8024e0:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024e3:	29 c3                	sub    %eax,%ebx
+  8024e5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8024e8:	29 fa                	sub    %edi,%edx
+  8024ea:	39 d3                	cmp    %edx,%ebx
+  8024ec:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8024ef:	83 ec 04             	sub    $0x4,%esp
+  8024f2:	53                   	push   %ebx
+  8024f3:	6a 0a                	push   $0xa
+  8024f5:	03 46 0c             	add    0xc(%esi),%eax
+  8024f8:	50                   	push   %eax
+  8024f9:	e8 1f e5 ff ff       	call   800a1d <memfind>
+  8024fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802501:	8b 46 0c             	mov    0xc(%esi),%eax
+  802504:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802507:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80250a:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80250c:	83 c4 10             	add    $0x10,%esp
+  80250f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802512:	74 0b                	je     80251f <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802514:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802517:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80251a:	29 d3                	sub    %edx,%ebx
+  80251c:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80251f:	83 ec 04             	sub    $0x4,%esp
+  802522:	53                   	push   %ebx
+  802523:	01 c8                	add    %ecx,%eax
+  802525:	50                   	push   %eax
+  802526:	89 f8                	mov    %edi,%eax
+  802528:	03 45 08             	add    0x8(%ebp),%eax
+  80252b:	50                   	push   %eax
+  80252c:	e8 3b e4 ff ff       	call   80096c <memmove>
+		f->f_rpos += m;
+  802531:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802534:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253c:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802541:	74 1f                	je     802562 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802543:	8d 47 01             	lea    0x1(%edi),%eax
+  802546:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802549:	73 17                	jae    802562 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80254b:	8b 46 18             	mov    0x18(%esi),%eax
+  80254e:	39 46 14             	cmp    %eax,0x14(%esi)
+  802551:	75 8a                	jne    8024dd <fgets+0x1c>
+  802553:	89 f0                	mov    %esi,%eax
+  802555:	e8 c3 fc ff ff       	call   80221d <stream_fill>
+  80255a:	85 c0                	test   %eax,%eax
+  80255c:	0f 85 7b ff ff ff    	jne    8024dd <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802562:	85 ff                	test   %edi,%edi
+  802564:	74 0f                	je     802575 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802566:	8b 45 08             	mov    0x8(%ebp),%eax
+  802569:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80256d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802570:	5b                   	pop    %ebx
+  802571:	5e                   	pop    %esi
+  802572:	5f                   	pop    %edi
+  802573:	5d                   	pop    %ebp
+  802574:	c3                   	ret
+		return 0;
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257a:	eb f1                	jmp    80256d <fgets+0xac>
+
+0080257c <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	57                   	push   %edi
+  802580:	56                   	push   %esi
+  802581:	53                   	push   %ebx
+  802582:	83 ec 1c             	sub    $0x1c,%esp
+  802585:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802588:	89 f0                	mov    %esi,%eax
+  80258a:	e8 21 fc ff ff       	call   8021b0 <stream_setup>
+	want = size * n;
+  80258f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802592:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802596:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259e:	eb 43                	jmp    8025e3 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8025a0:	29 d3                	sub    %edx,%ebx
+  8025a2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025a5:	29 f8                	sub    %edi,%eax
+  8025a7:	39 c3                	cmp    %eax,%ebx
+  8025a9:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8025ac:	83 ec 04             	sub    $0x4,%esp
+  8025af:	53                   	push   %ebx
+  8025b0:	03 56 0c             	add    0xc(%esi),%edx
+  8025b3:	52                   	push   %edx
+  8025b4:	89 f8                	mov    %edi,%eax
+  8025b6:	03 45 08             	add    0x8(%ebp),%eax
+  8025b9:	50                   	push   %eax
+  8025ba:	e8 ad e3 ff ff       	call   80096c <memmove>
+			f->f_rpos += m;
+  8025bf:	01 5e 14             	add    %ebx,0x14(%esi)
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	eb 1a                	jmp    8025e1 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8025c7:	83 ec 04             	sub    $0x4,%esp
+  8025ca:	53                   	push   %ebx
+  8025cb:	89 f8                	mov    %edi,%eax
+  8025cd:	03 45 08             	add    0x8(%ebp),%eax
+  8025d0:	50                   	push   %eax
+  8025d1:	ff 36                	push   (%esi)
+  8025d3:	e8 86 ef ff ff       	call   80155e <read>
+  8025d8:	89 c3                	mov    %eax,%ebx
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	7e 36                	jle    802617 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8025e1:	01 df                	add    %ebx,%edi
+  8025e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e6:	39 c7                	cmp    %eax,%edi
+  8025e8:	73 39                	jae    802623 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8025ea:	8b 56 14             	mov    0x14(%esi),%edx
+  8025ed:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8025f0:	39 da                	cmp    %ebx,%edx
+  8025f2:	72 ac                	jb     8025a0 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8025f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025f7:	29 fb                	sub    %edi,%ebx
+  8025f9:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8025fc:	72 3e                	jb     80263c <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8025fe:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802602:	74 1f                	je     802623 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802604:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802608:	74 bd                	je     8025c7 <fread+0x4b>
+  80260a:	89 f0                	mov    %esi,%eax
+  80260c:	e8 2f fb ff ff       	call   802140 <stream_drain>
+  802611:	85 c0                	test   %eax,%eax
+  802613:	79 b2                	jns    8025c7 <fread+0x4b>
+  802615:	eb 0c                	jmp    802623 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802617:	c1 fb 1f             	sar    $0x1f,%ebx
+  80261a:	83 e3 04             	and    $0x4,%ebx
+  80261d:	83 c3 04             	add    $0x4,%ebx
+  802620:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802623:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802626:	85 c0                	test   %eax,%eax
+  802628:	74 0a                	je     802634 <fread+0xb8>
+  80262a:	89 f8                	mov    %edi,%eax
+  80262c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802631:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802637:	5b                   	pop    %ebx
+  802638:	5e                   	pop    %esi
+  802639:	5f                   	pop    %edi
+  80263a:	5d                   	pop    %ebp
+  80263b:	c3                   	ret
+		} else if (!stream_fill(f))
+  80263c:	89 f0                	mov    %esi,%eax
+  80263e:	e8 da fb ff ff       	call   80221d <stream_fill>
+  802643:	85 c0                	test   %eax,%eax
+  802645:	74 dc                	je     802623 <fread+0xa7>
+			m = 0;
+  802647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80264c:	eb 93                	jmp    8025e1 <fread+0x65>
+
+0080264e <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	57                   	push   %edi
+  802652:	56                   	push   %esi
+  802653:	53                   	push   %ebx
+  802654:	83 ec 1c             	sub    $0x1c,%esp
+  802657:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  80265a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80265d:	a8 02                	test   $0x2,%al
+  80265f:	75 13                	jne    802674 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802661:	83 c8 08             	or     $0x8,%eax
+  802664:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80266c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266f:	5b                   	pop    %ebx
+  802670:	5e                   	pop    %esi
+  802671:	5f                   	pop    %edi
+  802672:	5d                   	pop    %ebp
+  802673:	c3                   	ret
+	stream_setup(f);
+  802674:	89 d8                	mov    %ebx,%eax
+  802676:	e8 35 fb ff ff       	call   8021b0 <stream_setup>
+	want = size * n;
+  80267b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80267e:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802682:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802685:	89 d8                	mov    %ebx,%eax
+  802687:	e8 41 fa ff ff       	call   8020cd <stream_unread>
+	for (done = 0; done < want; ) {
+  80268c:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802691:	84 c0                	test   %al,%al
+  802693:	75 7b                	jne    802710 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802695:	be 00 00 00 00       	mov    $0x0,%esi
+  80269a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80269d:	39 fe                	cmp    %edi,%esi
+  80269f:	73 24                	jae    8026c5 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8026a1:	83 ec 04             	sub    $0x4,%esp
+  8026a4:	89 f8                	mov    %edi,%eax
+  8026a6:	29 f0                	sub    %esi,%eax
+  8026a8:	50                   	push   %eax
+  8026a9:	89 f0                	mov    %esi,%eax
+  8026ab:	03 45 08             	add    0x8(%ebp),%eax
+  8026ae:	50                   	push   %eax
+  8026af:	ff 33                	push   (%ebx)
+  8026b1:	e8 a0 ef ff ff       	call   801656 <write>
+  8026b6:	83 c4 10             	add    $0x10,%esp
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	7e 04                	jle    8026c1 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8026bd:	01 c6                	add    %eax,%esi
+  8026bf:	eb dc                	jmp    80269d <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8026c1:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8026c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	74 a0                	je     80266c <fwrite+0x1e>
+  8026cc:	89 f0                	mov    %esi,%eax
+  8026ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d3:	f7 75 0c             	divl   0xc(%ebp)
+  8026d6:	eb 94                	jmp    80266c <fwrite+0x1e>
+			done += r;
+  8026d8:	01 c7                	add    %eax,%edi
+			continue;
+  8026da:	eb 34                	jmp    802710 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8026dc:	8b 73 10             	mov    0x10(%ebx),%esi
+  8026df:	29 c6                	sub    %eax,%esi
+  8026e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026e4:	29 fa                	sub    %edi,%edx
+  8026e6:	39 d6                	cmp    %edx,%esi
+  8026e8:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8026eb:	83 ec 04             	sub    $0x4,%esp
+  8026ee:	56                   	push   %esi
+  8026ef:	89 fa                	mov    %edi,%edx
+  8026f1:	03 55 08             	add    0x8(%ebp),%edx
+  8026f4:	52                   	push   %edx
+  8026f5:	03 43 0c             	add    0xc(%ebx),%eax
+  8026f8:	50                   	push   %eax
+  8026f9:	e8 6e e2 ff ff       	call   80096c <memmove>
+		f->f_wend += m;
+  8026fe:	89 f0                	mov    %esi,%eax
+  802700:	03 43 1c             	add    0x1c(%ebx),%eax
+  802703:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802706:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802708:	83 c4 10             	add    $0x10,%esp
+  80270b:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80270e:	74 5b                	je     80276b <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802710:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802713:	39 c7                	cmp    %eax,%edi
+  802715:	73 2d                	jae    802744 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802717:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80271a:	85 c0                	test   %eax,%eax
+  80271c:	75 be                	jne    8026dc <fwrite+0x8e>
+  80271e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802721:	29 fa                	sub    %edi,%edx
+  802723:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802726:	72 b4                	jb     8026dc <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802728:	83 ec 04             	sub    $0x4,%esp
+  80272b:	52                   	push   %edx
+  80272c:	89 f8                	mov    %edi,%eax
+  80272e:	03 45 08             	add    0x8(%ebp),%eax
+  802731:	50                   	push   %eax
+  802732:	ff 33                	push   (%ebx)
+  802734:	e8 1d ef ff ff       	call   801656 <write>
+  802739:	83 c4 10             	add    $0x10,%esp
+  80273c:	85 c0                	test   %eax,%eax
+  80273e:	7f 98                	jg     8026d8 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802740:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802744:	8b 43 08             	mov    0x8(%ebx),%eax
+  802747:	83 f8 03             	cmp    $0x3,%eax
+  80274a:	74 48                	je     802794 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80274c:	83 f8 02             	cmp    $0x2,%eax
+  80274f:	74 27                	je     802778 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802751:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802754:	85 c0                	test   %eax,%eax
+  802756:	0f 84 10 ff ff ff    	je     80266c <fwrite+0x1e>
+  80275c:	89 f8                	mov    %edi,%eax
+  80275e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802763:	f7 75 0c             	divl   0xc(%ebp)
+  802766:	e9 01 ff ff ff       	jmp    80266c <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80276b:	89 d8                	mov    %ebx,%eax
+  80276d:	e8 ce f9 ff ff       	call   802140 <stream_drain>
+  802772:	85 c0                	test   %eax,%eax
+  802774:	79 9a                	jns    802710 <fwrite+0xc2>
+  802776:	eb cc                	jmp    802744 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802778:	83 ec 04             	sub    $0x4,%esp
+  80277b:	57                   	push   %edi
+  80277c:	6a 0a                	push   $0xa
+  80277e:	ff 75 08             	push   0x8(%ebp)
+  802781:	e8 97 e2 ff ff       	call   800a1d <memfind>
+  802786:	89 c2                	mov    %eax,%edx
+  802788:	89 f8                	mov    %edi,%eax
+  80278a:	03 45 08             	add    0x8(%ebp),%eax
+  80278d:	83 c4 10             	add    $0x10,%esp
+  802790:	39 c2                	cmp    %eax,%edx
+  802792:	74 bd                	je     802751 <fwrite+0x103>
+		stream_drain(f);
+  802794:	89 d8                	mov    %ebx,%eax
+  802796:	e8 a5 f9 ff ff       	call   802140 <stream_drain>
+  80279b:	eb b4                	jmp    802751 <fwrite+0x103>
+
+0080279d <fputc>:
+{
+  80279d:	55                   	push   %ebp
+  80279e:	89 e5                	mov    %esp,%ebp
+  8027a0:	53                   	push   %ebx
+  8027a1:	83 ec 14             	sub    $0x14,%esp
+  8027a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8027a7:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8027aa:	ff 75 0c             	push   0xc(%ebp)
+  8027ad:	6a 01                	push   $0x1
+  8027af:	6a 01                	push   $0x1
+  8027b1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 94 fe ff ff       	call   80264e <fwrite>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	0f b6 db             	movzbl %bl,%ebx
+  8027c0:	83 f8 01             	cmp    $0x1,%eax
+  8027c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027c8:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8027cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ce:	c9                   	leave
+  8027cf:	c3                   	ret
+
+008027d0 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8027d6:	ff 75 0c             	push   0xc(%ebp)
+  8027d9:	ff 75 08             	push   0x8(%ebp)
+  8027dc:	e8 bc ff ff ff       	call   80279d <fputc>
+}
+  8027e1:	83 c4 10             	add    $0x10,%esp
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+008027e6 <fputs>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	56                   	push   %esi
+  8027ea:	53                   	push   %ebx
+  8027eb:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8027ee:	83 ec 0c             	sub    $0xc,%esp
+  8027f1:	56                   	push   %esi
+  8027f2:	e8 b4 df ff ff       	call   8007ab <strlen>
+  8027f7:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8027f9:	ff 75 0c             	push   0xc(%ebp)
+  8027fc:	50                   	push   %eax
+  8027fd:	6a 01                	push   $0x1
+  8027ff:	56                   	push   %esi
+  802800:	e8 49 fe ff ff       	call   80264e <fwrite>
+  802805:	83 c4 20             	add    $0x20,%esp
+  802808:	39 d8                	cmp    %ebx,%eax
+  80280a:	0f 95 c0             	setne  %al
+  80280d:	0f b6 c0             	movzbl %al,%eax
+  802810:	f7 d8                	neg    %eax
+}
+  802812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802815:	5b                   	pop    %ebx
+  802816:	5e                   	pop    %esi
+  802817:	5d                   	pop    %ebp
+  802818:	c3                   	ret
+
+00802819 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	53                   	push   %ebx
+  80281d:	83 ec 04             	sub    $0x4,%esp
+  802820:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802823:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802826:	50                   	push   %eax
+  802827:	ff 75 0c             	push   0xc(%ebp)
+  80282a:	53                   	push   %ebx
+  80282b:	68 d0 27 80 00       	push   $0x8027d0
+  802830:	e8 c4 da ff ff       	call   8002f9 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802835:	8b 43 04             	mov    0x4(%ebx),%eax
+  802838:	c1 e0 1c             	shl    $0x1c,%eax
+  80283b:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80283e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802841:	c9                   	leave
+  802842:	c3                   	ret
+
+00802843 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802843:	55                   	push   %ebp
+  802844:	89 e5                	mov    %esp,%ebp
+  802846:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802849:	68 6c 4c 80 00       	push   $0x804c6c
+  80284e:	ff 75 0c             	push   0xc(%ebp)
+  802851:	e8 90 df ff ff       	call   8007e6 <strcpy>
+	return 0;
+}
+  802856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285b:	c9                   	leave
+  80285c:	c3                   	ret
+
+0080285d <devsock_close>:
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	53                   	push   %ebx
+  802861:	83 ec 10             	sub    $0x10,%esp
+  802864:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802867:	53                   	push   %ebx
+  802868:	e8 de 1b 00 00       	call   80444b <pageref>
+  80286d:	89 c2                	mov    %eax,%edx
+  80286f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802872:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802877:	83 fa 01             	cmp    $0x1,%edx
+  80287a:	74 05                	je     802881 <devsock_close+0x24>
+}
+  80287c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287f:	c9                   	leave
+  802880:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802881:	83 ec 0c             	sub    $0xc,%esp
+  802884:	ff 73 0c             	push   0xc(%ebx)
+  802887:	e8 b7 02 00 00       	call   802b43 <nsipc_close>
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	eb eb                	jmp    80287c <devsock_close+0x1f>
+
+00802891 <devsock_write>:
+{
+  802891:	55                   	push   %ebp
+  802892:	89 e5                	mov    %esp,%ebp
+  802894:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802897:	6a 00                	push   $0x0
+  802899:	ff 75 10             	push   0x10(%ebp)
+  80289c:	ff 75 0c             	push   0xc(%ebp)
+  80289f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a2:	ff 70 0c             	push   0xc(%eax)
+  8028a5:	e8 79 03 00 00       	call   802c23 <nsipc_send>
+}
+  8028aa:	c9                   	leave
+  8028ab:	c3                   	ret
+
+008028ac <devsock_read>:
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8028b2:	6a 00                	push   $0x0
+  8028b4:	ff 75 10             	push   0x10(%ebp)
+  8028b7:	ff 75 0c             	push   0xc(%ebp)
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	ff 70 0c             	push   0xc(%eax)
+  8028c0:	e8 ef 02 00 00       	call   802bb4 <nsipc_recv>
+}
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+008028c7 <fd2sockid>:
+{
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+  8028ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8028cd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028d0:	52                   	push   %edx
+  8028d1:	50                   	push   %eax
+  8028d2:	e8 f7 e9 ff ff       	call   8012ce <fd_lookup>
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	78 10                	js     8028ee <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e1:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8028e7:	39 08                	cmp    %ecx,(%eax)
+  8028e9:	75 05                	jne    8028f0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028eb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028ee:	c9                   	leave
+  8028ef:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028f5:	eb f7                	jmp    8028ee <fd2sockid+0x27>
+
+008028f7 <alloc_sockfd>:
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	56                   	push   %esi
+  8028fb:	53                   	push   %ebx
+  8028fc:	83 ec 1c             	sub    $0x1c,%esp
+  8028ff:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802901:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802904:	50                   	push   %eax
+  802905:	e8 6e e9 ff ff       	call   801278 <fd_alloc>
+  80290a:	89 c3                	mov    %eax,%ebx
+  80290c:	83 c4 10             	add    $0x10,%esp
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 43                	js     802956 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802913:	83 ec 04             	sub    $0x4,%esp
+  802916:	68 07 04 00 00       	push   $0x407
+  80291b:	ff 75 f4             	push   -0xc(%ebp)
+  80291e:	6a 00                	push   $0x0
+  802920:	e8 ff e2 ff ff       	call   800c24 <sys_page_alloc>
+  802925:	89 c3                	mov    %eax,%ebx
+  802927:	83 c4 10             	add    $0x10,%esp
+  80292a:	85 c0                	test   %eax,%eax
+  80292c:	78 28                	js     802956 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80292e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802931:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802937:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802939:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80293c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802943:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802946:	83 ec 0c             	sub    $0xc,%esp
+  802949:	50                   	push   %eax
+  80294a:	e8 02 e9 ff ff       	call   801251 <fd2num>
+  80294f:	89 c3                	mov    %eax,%ebx
+  802951:	83 c4 10             	add    $0x10,%esp
+  802954:	eb 0c                	jmp    802962 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802956:	83 ec 0c             	sub    $0xc,%esp
+  802959:	56                   	push   %esi
+  80295a:	e8 e4 01 00 00       	call   802b43 <nsipc_close>
+		return r;
+  80295f:	83 c4 10             	add    $0x10,%esp
+}
+  802962:	89 d8                	mov    %ebx,%eax
+  802964:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802967:	5b                   	pop    %ebx
+  802968:	5e                   	pop    %esi
+  802969:	5d                   	pop    %ebp
+  80296a:	c3                   	ret
+
+0080296b <accept>:
+{
+  80296b:	55                   	push   %ebp
+  80296c:	89 e5                	mov    %esp,%ebp
+  80296e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802971:	8b 45 08             	mov    0x8(%ebp),%eax
+  802974:	e8 4e ff ff ff       	call   8028c7 <fd2sockid>
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	78 1b                	js     802998 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80297d:	83 ec 04             	sub    $0x4,%esp
+  802980:	ff 75 10             	push   0x10(%ebp)
+  802983:	ff 75 0c             	push   0xc(%ebp)
+  802986:	50                   	push   %eax
+  802987:	e8 0e 01 00 00       	call   802a9a <nsipc_accept>
+  80298c:	83 c4 10             	add    $0x10,%esp
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	78 05                	js     802998 <accept+0x2d>
+	return alloc_sockfd(r);
+  802993:	e8 5f ff ff ff       	call   8028f7 <alloc_sockfd>
+}
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+0080299a <bind>:
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a3:	e8 1f ff ff ff       	call   8028c7 <fd2sockid>
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	78 12                	js     8029be <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8029ac:	83 ec 04             	sub    $0x4,%esp
+  8029af:	ff 75 10             	push   0x10(%ebp)
+  8029b2:	ff 75 0c             	push   0xc(%ebp)
+  8029b5:	50                   	push   %eax
+  8029b6:	e8 31 01 00 00       	call   802aec <nsipc_bind>
+  8029bb:	83 c4 10             	add    $0x10,%esp
+}
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+008029c0 <shutdown>:
+{
+  8029c0:	55                   	push   %ebp
+  8029c1:	89 e5                	mov    %esp,%ebp
+  8029c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c9:	e8 f9 fe ff ff       	call   8028c7 <fd2sockid>
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	78 0f                	js     8029e1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029d2:	83 ec 08             	sub    $0x8,%esp
+  8029d5:	ff 75 0c             	push   0xc(%ebp)
+  8029d8:	50                   	push   %eax
+  8029d9:	e8 43 01 00 00       	call   802b21 <nsipc_shutdown>
+  8029de:	83 c4 10             	add    $0x10,%esp
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+008029e3 <connect>:
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ec:	e8 d6 fe ff ff       	call   8028c7 <fd2sockid>
+  8029f1:	85 c0                	test   %eax,%eax
+  8029f3:	78 12                	js     802a07 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029f5:	83 ec 04             	sub    $0x4,%esp
+  8029f8:	ff 75 10             	push   0x10(%ebp)
+  8029fb:	ff 75 0c             	push   0xc(%ebp)
+  8029fe:	50                   	push   %eax
+  8029ff:	e8 59 01 00 00       	call   802b5d <nsipc_connect>
+  802a04:	83 c4 10             	add    $0x10,%esp
+}
+  802a07:	c9                   	leave
+  802a08:	c3                   	ret
+
+00802a09 <listen>:
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a12:	e8 b0 fe ff ff       	call   8028c7 <fd2sockid>
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	78 0f                	js     802a2a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+  802a1e:	ff 75 0c             	push   0xc(%ebp)
+  802a21:	50                   	push   %eax
+  802a22:	e8 6b 01 00 00       	call   802b92 <nsipc_listen>
+  802a27:	83 c4 10             	add    $0x10,%esp
+}
+  802a2a:	c9                   	leave
+  802a2b:	c3                   	ret
+
+00802a2c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a2c:	55                   	push   %ebp
+  802a2d:	89 e5                	mov    %esp,%ebp
+  802a2f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a32:	ff 75 10             	push   0x10(%ebp)
+  802a35:	ff 75 0c             	push   0xc(%ebp)
+  802a38:	ff 75 08             	push   0x8(%ebp)
+  802a3b:	e8 41 02 00 00       	call   802c81 <nsipc_socket>
+  802a40:	83 c4 10             	add    $0x10,%esp
+  802a43:	85 c0                	test   %eax,%eax
+  802a45:	78 05                	js     802a4c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a47:	e8 ab fe ff ff       	call   8028f7 <alloc_sockfd>
+}
+  802a4c:	c9                   	leave
+  802a4d:	c3                   	ret
+
+00802a4e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	53                   	push   %ebx
+  802a52:	83 ec 04             	sub    $0x4,%esp
+  802a55:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a57:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802a5e:	74 26                	je     802a86 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a60:	6a 07                	push   $0x7
+  802a62:	68 00 80 80 00       	push   $0x808000
+  802a67:	53                   	push   %ebx
+  802a68:	ff 35 08 60 80 00    	push   0x806008
+  802a6e:	e8 49 e7 ff ff       	call   8011bc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a73:	83 c4 0c             	add    $0xc,%esp
+  802a76:	6a 00                	push   $0x0
+  802a78:	6a 00                	push   $0x0
+  802a7a:	6a 00                	push   $0x0
+  802a7c:	e8 45 e6 ff ff       	call   8010c6 <ipc_recv>
+}
+  802a81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a86:	83 ec 0c             	sub    $0xc,%esp
+  802a89:	6a 02                	push   $0x2
+  802a8b:	e8 82 e7 ff ff       	call   801212 <ipc_find_env>
+  802a90:	a3 08 60 80 00       	mov    %eax,0x806008
+  802a95:	83 c4 10             	add    $0x10,%esp
+  802a98:	eb c6                	jmp    802a60 <nsipc+0x12>
+
+00802a9a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a9a:	55                   	push   %ebp
+  802a9b:	89 e5                	mov    %esp,%ebp
+  802a9d:	56                   	push   %esi
+  802a9e:	53                   	push   %ebx
+  802a9f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802aaa:	8b 06                	mov    (%esi),%eax
+  802aac:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ab1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ab6:	e8 93 ff ff ff       	call   802a4e <nsipc>
+  802abb:	89 c3                	mov    %eax,%ebx
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	79 09                	jns    802aca <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ac1:	89 d8                	mov    %ebx,%eax
+  802ac3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ac6:	5b                   	pop    %ebx
+  802ac7:	5e                   	pop    %esi
+  802ac8:	5d                   	pop    %ebp
+  802ac9:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802aca:	83 ec 04             	sub    $0x4,%esp
+  802acd:	ff 35 10 80 80 00    	push   0x808010
+  802ad3:	68 00 80 80 00       	push   $0x808000
+  802ad8:	ff 75 0c             	push   0xc(%ebp)
+  802adb:	e8 8c de ff ff       	call   80096c <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ae0:	a1 10 80 80 00       	mov    0x808010,%eax
+  802ae5:	89 06                	mov    %eax,(%esi)
+  802ae7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802aea:	eb d5                	jmp    802ac1 <nsipc_accept+0x27>
+
+00802aec <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802aec:	55                   	push   %ebp
+  802aed:	89 e5                	mov    %esp,%ebp
+  802aef:	53                   	push   %ebx
+  802af0:	83 ec 08             	sub    $0x8,%esp
+  802af3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802afe:	53                   	push   %ebx
+  802aff:	ff 75 0c             	push   0xc(%ebp)
+  802b02:	68 04 80 80 00       	push   $0x808004
+  802b07:	e8 60 de ff ff       	call   80096c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b0c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802b12:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b17:	e8 32 ff ff ff       	call   802a4e <nsipc>
+}
+  802b1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1f:	c9                   	leave
+  802b20:	c3                   	ret
+
+00802b21 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802b2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b32:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b37:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b3c:	e8 0d ff ff ff       	call   802a4e <nsipc>
+}
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+00802b43 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b43:	55                   	push   %ebp
+  802b44:	89 e5                	mov    %esp,%ebp
+  802b46:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802b51:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b56:	e8 f3 fe ff ff       	call   802a4e <nsipc>
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	53                   	push   %ebx
+  802b61:	83 ec 08             	sub    $0x8,%esp
+  802b64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b6f:	53                   	push   %ebx
+  802b70:	ff 75 0c             	push   0xc(%ebp)
+  802b73:	68 04 80 80 00       	push   $0x808004
+  802b78:	e8 ef dd ff ff       	call   80096c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b7d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802b83:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b88:	e8 c1 fe ff ff       	call   802a4e <nsipc>
+}
+  802b8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+00802b92 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ba0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ba3:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ba8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bad:	e8 9c fe ff ff       	call   802a4e <nsipc>
+}
+  802bb2:	c9                   	leave
+  802bb3:	c3                   	ret
+
+00802bb4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	56                   	push   %esi
+  802bb8:	53                   	push   %ebx
+  802bb9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802bc4:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bcd:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bd2:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bd7:	e8 72 fe ff ff       	call   802a4e <nsipc>
+  802bdc:	89 c3                	mov    %eax,%ebx
+  802bde:	85 c0                	test   %eax,%eax
+  802be0:	78 22                	js     802c04 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802be2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802be7:	39 c6                	cmp    %eax,%esi
+  802be9:	0f 4e c6             	cmovle %esi,%eax
+  802bec:	39 c3                	cmp    %eax,%ebx
+  802bee:	7f 1d                	jg     802c0d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802bf0:	83 ec 04             	sub    $0x4,%esp
+  802bf3:	53                   	push   %ebx
+  802bf4:	68 00 80 80 00       	push   $0x808000
+  802bf9:	ff 75 0c             	push   0xc(%ebp)
+  802bfc:	e8 6b dd ff ff       	call   80096c <memmove>
+  802c01:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c04:	89 d8                	mov    %ebx,%eax
+  802c06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c09:	5b                   	pop    %ebx
+  802c0a:	5e                   	pop    %esi
+  802c0b:	5d                   	pop    %ebp
+  802c0c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c0d:	68 78 4c 80 00       	push   $0x804c78
+  802c12:	68 31 4c 80 00       	push   $0x804c31
+  802c17:	6a 62                	push   $0x62
+  802c19:	68 8d 4c 80 00       	push   $0x804c8d
+  802c1e:	e8 6c 11 00 00       	call   803d8f <_panic>
+
+00802c23 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c23:	55                   	push   %ebp
+  802c24:	89 e5                	mov    %esp,%ebp
+  802c26:	53                   	push   %ebx
+  802c27:	83 ec 04             	sub    $0x4,%esp
+  802c2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c30:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802c35:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c3b:	7f 2e                	jg     802c6b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c3d:	83 ec 04             	sub    $0x4,%esp
+  802c40:	53                   	push   %ebx
+  802c41:	ff 75 0c             	push   0xc(%ebp)
+  802c44:	68 0c 80 80 00       	push   $0x80800c
+  802c49:	e8 1e dd ff ff       	call   80096c <memmove>
+	nsipcbuf.send.req_size = size;
+  802c4e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802c54:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c57:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802c5c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c61:	e8 e8 fd ff ff       	call   802a4e <nsipc>
+}
+  802c66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c69:	c9                   	leave
+  802c6a:	c3                   	ret
+	assert(size < 1600);
+  802c6b:	68 99 4c 80 00       	push   $0x804c99
+  802c70:	68 31 4c 80 00       	push   $0x804c31
+  802c75:	6a 6d                	push   $0x6d
+  802c77:	68 8d 4c 80 00       	push   $0x804c8d
+  802c7c:	e8 0e 11 00 00       	call   803d8f <_panic>
+
+00802c81 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c92:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c97:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c9a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ca4:	e8 a5 fd ff ff       	call   802a4e <nsipc>
+}
+  802ca9:	c9                   	leave
+  802caa:	c3                   	ret
+
+00802cab <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	53                   	push   %ebx
+  802caf:	83 ec 10             	sub    $0x10,%esp
+  802cb2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802cb5:	68 0c 60 80 00       	push   $0x80600c
+  802cba:	e8 50 07 00 00       	call   80340f <mutex_lock>
+	if (v == 0)
+  802cbf:	83 c4 10             	add    $0x10,%esp
+  802cc2:	85 db                	test   %ebx,%ebx
+  802cc4:	0f 84 85 00 00 00    	je     802d4f <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802cca:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802cd0:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802cd5:	77 51                	ja     802d28 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802cd7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802cdd:	89 d8                	mov    %ebx,%eax
+  802cdf:	c1 e8 0c             	shr    $0xc,%eax
+  802ce2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ce9:	f6 c4 02             	test   $0x2,%ah
+  802cec:	74 50                	je     802d3e <free+0x93>
+		sys_page_unmap(0, c);
+  802cee:	83 ec 08             	sub    $0x8,%esp
+  802cf1:	53                   	push   %ebx
+  802cf2:	6a 00                	push   $0x0
+  802cf4:	e8 c4 df ff ff       	call   800cbd <sys_page_unmap>
+		c += PGSIZE;
+  802cf9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802cff:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802d05:	83 c4 10             	add    $0x10,%esp
+  802d08:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802d0d:	76 ce                	jbe    802cdd <free+0x32>
+  802d0f:	68 e3 4c 80 00       	push   $0x804ce3
+  802d14:	68 31 4c 80 00       	push   $0x804c31
+  802d19:	68 82 00 00 00       	push   $0x82
+  802d1e:	68 d6 4c 80 00       	push   $0x804cd6
+  802d23:	e8 67 10 00 00       	call   803d8f <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802d28:	68 a8 4c 80 00       	push   $0x804ca8
+  802d2d:	68 31 4c 80 00       	push   $0x804c31
+  802d32:	6a 7b                	push   $0x7b
+  802d34:	68 d6 4c 80 00       	push   $0x804cd6
+  802d39:	e8 51 10 00 00       	call   803d8f <_panic>
+	if (--(*ref) == 0)
+  802d3e:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802d44:	83 e8 01             	sub    $0x1,%eax
+  802d47:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802d4d:	74 15                	je     802d64 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802d4f:	83 ec 0c             	sub    $0xc,%esp
+  802d52:	68 0c 60 80 00       	push   $0x80600c
+  802d57:	e8 20 07 00 00       	call   80347c <mutex_unlock>
+}
+  802d5c:	83 c4 10             	add    $0x10,%esp
+  802d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+		sys_page_unmap(0, c);
+  802d64:	83 ec 08             	sub    $0x8,%esp
+  802d67:	53                   	push   %ebx
+  802d68:	6a 00                	push   $0x0
+  802d6a:	e8 4e df ff ff       	call   800cbd <sys_page_unmap>
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	eb db                	jmp    802d4f <free+0xa4>
+
+00802d74 <malloc>:
+{
+  802d74:	55                   	push   %ebp
+  802d75:	89 e5                	mov    %esp,%ebp
+  802d77:	57                   	push   %edi
+  802d78:	56                   	push   %esi
+  802d79:	53                   	push   %ebx
+  802d7a:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802d7d:	68 0c 60 80 00       	push   $0x80600c
+  802d82:	e8 88 06 00 00       	call   80340f <mutex_lock>
+	if (mptr == 0)
+  802d87:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	85 ff                	test   %edi,%edi
+  802d92:	74 6c                	je     802e00 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d97:	83 c0 03             	add    $0x3,%eax
+  802d9a:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d9d:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d9f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802da4:	0f 87 64 01 00 00    	ja     802f0e <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802daa:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802db0:	74 30                	je     802de2 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802db2:	89 f9                	mov    %edi,%ecx
+  802db4:	c1 e9 0c             	shr    $0xc,%ecx
+  802db7:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802dbb:	c1 e8 0c             	shr    $0xc,%eax
+  802dbe:	39 c1                	cmp    %eax,%ecx
+  802dc0:	74 5f                	je     802e21 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802dc2:	83 ec 0c             	sub    $0xc,%esp
+  802dc5:	57                   	push   %edi
+  802dc6:	e8 e0 fe ff ff       	call   802cab <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802dcb:	a1 10 60 80 00       	mov    0x806010,%eax
+  802dd0:	05 00 10 00 00       	add    $0x1000,%eax
+  802dd5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802dda:	a3 10 60 80 00       	mov    %eax,0x806010
+  802ddf:	83 c4 10             	add    $0x10,%esp
+  802de2:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802de8:	ba 02 00 00 00       	mov    $0x2,%edx
+  802ded:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802df1:	8d 7e 04             	lea    0x4(%esi),%edi
+  802df4:	89 cb                	mov    %ecx,%ebx
+  802df6:	01 f9                	add    %edi,%ecx
+  802df8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802dfb:	e9 8b 00 00 00       	jmp    802e8b <malloc+0x117>
+		mptr = mbegin;
+  802e00:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802e07:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e0d:	83 c0 03             	add    $0x3,%eax
+  802e10:	83 e0 fc             	and    $0xfffffffc,%eax
+  802e13:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802e15:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802e1a:	76 c6                	jbe    802de2 <malloc+0x6e>
+  802e1c:	e9 d6 00 00 00       	jmp    802ef7 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802e21:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e27:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802e2c:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802e30:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e33:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802e38:	e9 ba 00 00 00       	jmp    802ef7 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e3d:	05 00 10 00 00       	add    $0x1000,%eax
+  802e42:	39 c8                	cmp    %ecx,%eax
+  802e44:	0f 83 cb 00 00 00    	jae    802f15 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802e4a:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802e4f:	77 22                	ja     802e73 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802e51:	89 c2                	mov    %eax,%edx
+  802e53:	c1 ea 16             	shr    $0x16,%edx
+  802e56:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802e5d:	f6 c2 01             	test   $0x1,%dl
+  802e60:	74 db                	je     802e3d <malloc+0xc9>
+  802e62:	89 c2                	mov    %eax,%edx
+  802e64:	c1 ea 0c             	shr    $0xc,%edx
+  802e67:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802e6e:	f6 c2 01             	test   $0x1,%dl
+  802e71:	74 ca                	je     802e3d <malloc+0xc9>
+		if (mptr == mend) {
+  802e73:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e79:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802e7f:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802e83:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802e89:	74 04                	je     802e8f <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e8b:	89 d8                	mov    %ebx,%eax
+  802e8d:	eb b3                	jmp    802e42 <malloc+0xce>
+  802e8f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802e92:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802e97:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802e9b:	83 ea 01             	sub    $0x1,%edx
+  802e9e:	0f 85 50 ff ff ff    	jne    802df4 <malloc+0x80>
+  802ea4:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802eab:	00 00 08 
+				return 0;	/* out of address space */
+  802eae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb3:	eb 42                	jmp    802ef7 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802eb5:	85 db                	test   %ebx,%ebx
+  802eb7:	78 1e                	js     802ed7 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802eb9:	83 ec 08             	sub    $0x8,%esp
+  802ebc:	89 d8                	mov    %ebx,%eax
+  802ebe:	03 05 10 60 80 00    	add    0x806010,%eax
+  802ec4:	50                   	push   %eax
+  802ec5:	6a 00                	push   $0x0
+  802ec7:	e8 f1 dd ff ff       	call   800cbd <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802ecc:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ed2:	83 c4 10             	add    $0x10,%esp
+  802ed5:	eb de                	jmp    802eb5 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edc:	eb 19                	jmp    802ef7 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802ede:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ee1:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802ee7:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802eee:	00 
+	mptr += n;
+  802eef:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802ef2:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802ef7:	83 ec 0c             	sub    $0xc,%esp
+  802efa:	68 0c 60 80 00       	push   $0x80600c
+  802eff:	e8 78 05 00 00       	call   80347c <mutex_unlock>
+}
+  802f04:	89 f8                	mov    %edi,%eax
+  802f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5f                   	pop    %edi
+  802f0c:	5d                   	pop    %ebp
+  802f0d:	c3                   	ret
+		return 0;
+  802f0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f13:	eb e2                	jmp    802ef7 <malloc+0x183>
+  802f15:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802f19:	74 06                	je     802f21 <malloc+0x1ad>
+  802f1b:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f26:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802f29:	39 fb                	cmp    %edi,%ebx
+  802f2b:	73 b1                	jae    802ede <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f2d:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f33:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802f36:	39 fe                	cmp    %edi,%esi
+  802f38:	0f 92 c0             	setb   %al
+  802f3b:	0f b6 c0             	movzbl %al,%eax
+  802f3e:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802f41:	83 c8 07             	or     $0x7,%eax
+  802f44:	50                   	push   %eax
+  802f45:	89 d8                	mov    %ebx,%eax
+  802f47:	03 05 10 60 80 00    	add    0x806010,%eax
+  802f4d:	50                   	push   %eax
+  802f4e:	6a 00                	push   $0x0
+  802f50:	e8 cf dc ff ff       	call   800c24 <sys_page_alloc>
+  802f55:	83 c4 10             	add    $0x10,%esp
+  802f58:	85 c0                	test   %eax,%eax
+  802f5a:	0f 88 55 ff ff ff    	js     802eb5 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802f60:	89 f3                	mov    %esi,%ebx
+  802f62:	eb c5                	jmp    802f29 <malloc+0x1b5>
+
+00802f64 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f64:	55                   	push   %ebp
+  802f65:	89 e5                	mov    %esp,%ebp
+  802f67:	56                   	push   %esi
+  802f68:	53                   	push   %ebx
+  802f69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f6c:	83 ec 0c             	sub    $0xc,%esp
+  802f6f:	ff 75 08             	push   0x8(%ebp)
+  802f72:	e8 ea e2 ff ff       	call   801261 <fd2data>
+  802f77:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f79:	83 c4 08             	add    $0x8,%esp
+  802f7c:	68 fb 4c 80 00       	push   $0x804cfb
+  802f81:	53                   	push   %ebx
+  802f82:	e8 5f d8 ff ff       	call   8007e6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f87:	8b 46 04             	mov    0x4(%esi),%eax
+  802f8a:	2b 06                	sub    (%esi),%eax
+  802f8c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f99:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f9c:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802fa3:	52 80 00 
+	return 0;
+}
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fae:	5b                   	pop    %ebx
+  802faf:	5e                   	pop    %esi
+  802fb0:	5d                   	pop    %ebp
+  802fb1:	c3                   	ret
+
+00802fb2 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802fb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb7:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802fbb:	85 c9                	test   %ecx,%ecx
+  802fbd:	75 01                	jne    802fc0 <pipewake+0xe>
+  802fbf:	c3                   	ret
+{
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802fc6:	68 00 04 00 00       	push   $0x400
+  802fcb:	52                   	push   %edx
+  802fcc:	e8 97 df ff ff       	call   800f68 <sys_futex_wake>
+  802fd1:	83 c4 10             	add    $0x10,%esp
+}
+  802fd4:	c9                   	leave
+  802fd5:	c3                   	ret
+
+00802fd6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fd6:	55                   	push   %ebp
+  802fd7:	89 e5                	mov    %esp,%ebp
+  802fd9:	56                   	push   %esi
+  802fda:	53                   	push   %ebx
+  802fdb:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fde:	83 ec 0c             	sub    $0xc,%esp
+  802fe1:	56                   	push   %esi
+  802fe2:	e8 7a e2 ff ff       	call   801261 <fd2data>
+  802fe7:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802fe9:	83 c4 08             	add    $0x8,%esp
+  802fec:	56                   	push   %esi
+  802fed:	6a 00                	push   $0x0
+  802fef:	e8 c9 dc ff ff       	call   800cbd <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802ff4:	8d 53 04             	lea    0x4(%ebx),%edx
+  802ff7:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ffa:	e8 b3 ff ff ff       	call   802fb2 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802fff:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803002:	89 da                	mov    %ebx,%edx
+  803004:	e8 a9 ff ff ff       	call   802fb2 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803009:	89 34 24             	mov    %esi,(%esp)
+  80300c:	e8 50 e2 ff ff       	call   801261 <fd2data>
+  803011:	83 c4 08             	add    $0x8,%esp
+  803014:	50                   	push   %eax
+  803015:	6a 00                	push   $0x0
+  803017:	e8 a1 dc ff ff       	call   800cbd <sys_page_unmap>
+}
+  80301c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80301f:	5b                   	pop    %ebx
+  803020:	5e                   	pop    %esi
+  803021:	5d                   	pop    %ebp
+  803022:	c3                   	ret
+
+00803023 <_pipeisclosed>:
+{
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	57                   	push   %edi
+  803027:	56                   	push   %esi
+  803028:	53                   	push   %ebx
+  803029:	83 ec 1c             	sub    $0x1c,%esp
+  80302c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80302f:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803031:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803036:	eb 5d                	jmp    803095 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803038:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  80303e:	8b 02                	mov    (%edx),%eax
+  803040:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803043:	83 ec 0c             	sub    $0xc,%esp
+  803046:	ff 75 e0             	push   -0x20(%ebp)
+  803049:	e8 fd 13 00 00       	call   80444b <pageref>
+  80304e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803051:	89 3c 24             	mov    %edi,(%esp)
+  803054:	e8 f2 13 00 00       	call   80444b <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803059:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80305b:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80306a:	77 15                	ja     803081 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80306c:	89 f2                	mov    %esi,%edx
+  80306e:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803070:	c1 ea 10             	shr    $0x10,%edx
+  803073:	74 0c                	je     803081 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803075:	c1 e2 10             	shl    $0x10,%edx
+  803078:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80307d:	29 d1                	sub    %edx,%ecx
+  80307f:	eb 06                	jmp    803087 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803081:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  803087:	8b 11                	mov    (%ecx),%edx
+  803089:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80308c:	39 d3                	cmp    %edx,%ebx
+  80308e:	74 6e                	je     8030fe <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803090:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803093:	74 24                	je     8030b9 <_pipeisclosed+0x96>
+  803095:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803097:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80309d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030a2:	77 94                	ja     803038 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030a4:	89 f0                	mov    %esi,%eax
+  8030a6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8030a8:	c1 e8 10             	shr    $0x10,%eax
+  8030ab:	74 8b                	je     803038 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8030ad:	c1 e0 10             	shl    $0x10,%eax
+  8030b0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8030b5:	29 c2                	sub    %eax,%edx
+  8030b7:	eb 85                	jmp    80303e <_pipeisclosed+0x1b>
+  8030b9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8030bb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8030c1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8030c6:	77 18                	ja     8030e0 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8030c8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8030cd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8030cf:	c1 e8 10             	shr    $0x10,%eax
+  8030d2:	74 0c                	je     8030e0 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8030d4:	c1 e0 10             	shl    $0x10,%eax
+  8030d7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8030dc:	29 c2                	sub    %eax,%edx
+  8030de:	eb 06                	jmp    8030e6 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8030e0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030e6:	8b 02                	mov    (%edx),%eax
+  8030e8:	8b 40 58             	mov    0x58(%eax),%eax
+  8030eb:	6a 01                	push   $0x1
+  8030ed:	50                   	push   %eax
+  8030ee:	53                   	push   %ebx
+  8030ef:	68 02 4d 80 00       	push   $0x804d02
+  8030f4:	e8 09 d1 ff ff       	call   800202 <cprintf>
+  8030f9:	83 c4 10             	add    $0x10,%esp
+  8030fc:	eb 97                	jmp    803095 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8030fe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803101:	0f 94 c0             	sete   %al
+  803104:	0f b6 c0             	movzbl %al,%eax
+}
+  803107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310a:	5b                   	pop    %ebx
+  80310b:	5e                   	pop    %esi
+  80310c:	5f                   	pop    %edi
+  80310d:	5d                   	pop    %ebp
+  80310e:	c3                   	ret
+
+0080310f <devpipe_write>:
+{
+  80310f:	55                   	push   %ebp
+  803110:	89 e5                	mov    %esp,%ebp
+  803112:	57                   	push   %edi
+  803113:	56                   	push   %esi
+  803114:	53                   	push   %ebx
+  803115:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803118:	ff 75 08             	push   0x8(%ebp)
+  80311b:	e8 41 e1 ff ff       	call   801261 <fd2data>
+  803120:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803122:	83 c4 10             	add    $0x10,%esp
+  803125:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80312c:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80312f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803132:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803135:	0f 84 96 00 00 00    	je     8031d1 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80313b:	8d 73 08             	lea    0x8(%ebx),%esi
+  80313e:	eb 32                	jmp    803172 <devpipe_write+0x63>
+  803140:	89 fa                	mov    %edi,%edx
+  803142:	89 f0                	mov    %esi,%eax
+  803144:	e8 69 fe ff ff       	call   802fb2 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803149:	8b 43 04             	mov    0x4(%ebx),%eax
+  80314c:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80314f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803154:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803159:	83 ec 04             	sub    $0x4,%esp
+  80315c:	6a 0a                	push   $0xa
+  80315e:	50                   	push   %eax
+  80315f:	53                   	push   %ebx
+  803160:	e8 d4 dd ff ff       	call   800f39 <sys_futex_wait>
+  803165:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80316a:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80316f:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803172:	8b 43 04             	mov    0x4(%ebx),%eax
+  803175:	8b 0b                	mov    (%ebx),%ecx
+  803177:	8d 51 20             	lea    0x20(%ecx),%edx
+  80317a:	39 d0                	cmp    %edx,%eax
+  80317c:	72 1b                	jb     803199 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80317e:	89 da                	mov    %ebx,%edx
+  803180:	8b 45 08             	mov    0x8(%ebp),%eax
+  803183:	e8 9b fe ff ff       	call   803023 <_pipeisclosed>
+  803188:	85 c0                	test   %eax,%eax
+  80318a:	74 b4                	je     803140 <devpipe_write+0x31>
+				return 0;
+  80318c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803194:	5b                   	pop    %ebx
+  803195:	5e                   	pop    %esi
+  803196:	5f                   	pop    %edi
+  803197:	5d                   	pop    %ebp
+  803198:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80319c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80319f:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8031a3:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8031a6:	89 c2                	mov    %eax,%edx
+  8031a8:	c1 fa 1f             	sar    $0x1f,%edx
+  8031ab:	89 d1                	mov    %edx,%ecx
+  8031ad:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031b0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031b3:	83 e2 1f             	and    $0x1f,%edx
+  8031b6:	29 ca                	sub    %ecx,%edx
+  8031b8:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8031bc:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8031c0:	83 c0 01             	add    $0x1,%eax
+  8031c3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031c6:	83 c6 01             	add    $0x1,%esi
+  8031c9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8031cc:	e9 5e ff ff ff       	jmp    80312f <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8031d1:	8d 53 04             	lea    0x4(%ebx),%edx
+  8031d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8031d7:	e8 d6 fd ff ff       	call   802fb2 <pipewake>
+	return i;
+  8031dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031df:	eb b0                	jmp    803191 <devpipe_write+0x82>
+
+008031e1 <devpipe_read>:
+{
+  8031e1:	55                   	push   %ebp
+  8031e2:	89 e5                	mov    %esp,%ebp
+  8031e4:	57                   	push   %edi
+  8031e5:	56                   	push   %esi
+  8031e6:	53                   	push   %ebx
+  8031e7:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8031ea:	ff 75 08             	push   0x8(%ebp)
+  8031ed:	e8 6f e0 ff ff       	call   801261 <fd2data>
+  8031f2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031f4:	83 c4 10             	add    $0x10,%esp
+  8031f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031fc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031ff:	74 6c                	je     80326d <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803201:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803204:	eb 25                	jmp    80322b <devpipe_read+0x4a>
+  803206:	8b 13                	mov    (%ebx),%edx
+  803208:	b8 01 00 00 00       	mov    $0x1,%eax
+  80320d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803212:	83 ec 04             	sub    $0x4,%esp
+  803215:	6a 0a                	push   $0xa
+  803217:	52                   	push   %edx
+  803218:	57                   	push   %edi
+  803219:	e8 1b dd ff ff       	call   800f39 <sys_futex_wait>
+  80321e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803223:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803228:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80322b:	8b 03                	mov    (%ebx),%eax
+  80322d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803230:	75 19                	jne    80324b <devpipe_read+0x6a>
+			if (i > 0)
+  803232:	85 f6                	test   %esi,%esi
+  803234:	75 3a                	jne    803270 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803236:	89 da                	mov    %ebx,%edx
+  803238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323b:	e8 e3 fd ff ff       	call   803023 <_pipeisclosed>
+  803240:	85 c0                	test   %eax,%eax
+  803242:	74 c2                	je     803206 <devpipe_read+0x25>
+				return 0;
+  803244:	b8 00 00 00 00       	mov    $0x0,%eax
+  803249:	eb 31                	jmp    80327c <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80324b:	89 c1                	mov    %eax,%ecx
+  80324d:	c1 f9 1f             	sar    $0x1f,%ecx
+  803250:	c1 e9 1b             	shr    $0x1b,%ecx
+  803253:	01 c8                	add    %ecx,%eax
+  803255:	83 e0 1f             	and    $0x1f,%eax
+  803258:	29 c8                	sub    %ecx,%eax
+  80325a:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80325f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803262:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803265:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803268:	83 c6 01             	add    $0x1,%esi
+  80326b:	eb 8f                	jmp    8031fc <devpipe_read+0x1b>
+out:
+  80326d:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803270:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803273:	89 da                	mov    %ebx,%edx
+  803275:	e8 38 fd ff ff       	call   802fb2 <pipewake>
+	return i;
+  80327a:	89 f0                	mov    %esi,%eax
+}
+  80327c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80327f:	5b                   	pop    %ebx
+  803280:	5e                   	pop    %esi
+  803281:	5f                   	pop    %edi
+  803282:	5d                   	pop    %ebp
+  803283:	c3                   	ret
+
+00803284 <pipe>:
+{
+  803284:	55                   	push   %ebp
+  803285:	89 e5                	mov    %esp,%ebp
+  803287:	56                   	push   %esi
+  803288:	53                   	push   %ebx
+  803289:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80328c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80328f:	50                   	push   %eax
+  803290:	e8 e3 df ff ff       	call   801278 <fd_alloc>
+  803295:	89 c3                	mov    %eax,%ebx
+  803297:	83 c4 10             	add    $0x10,%esp
+  80329a:	85 c0                	test   %eax,%eax
+  80329c:	0f 88 23 01 00 00    	js     8033c5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a2:	83 ec 04             	sub    $0x4,%esp
+  8032a5:	68 07 04 00 00       	push   $0x407
+  8032aa:	ff 75 f4             	push   -0xc(%ebp)
+  8032ad:	6a 00                	push   $0x0
+  8032af:	e8 70 d9 ff ff       	call   800c24 <sys_page_alloc>
+  8032b4:	89 c3                	mov    %eax,%ebx
+  8032b6:	83 c4 10             	add    $0x10,%esp
+  8032b9:	85 c0                	test   %eax,%eax
+  8032bb:	0f 88 04 01 00 00    	js     8033c5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032c1:	83 ec 0c             	sub    $0xc,%esp
+  8032c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032c7:	50                   	push   %eax
+  8032c8:	e8 ab df ff ff       	call   801278 <fd_alloc>
+  8032cd:	89 c3                	mov    %eax,%ebx
+  8032cf:	83 c4 10             	add    $0x10,%esp
+  8032d2:	85 c0                	test   %eax,%eax
+  8032d4:	0f 88 db 00 00 00    	js     8033b5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032da:	83 ec 04             	sub    $0x4,%esp
+  8032dd:	68 07 04 00 00       	push   $0x407
+  8032e2:	ff 75 f0             	push   -0x10(%ebp)
+  8032e5:	6a 00                	push   $0x0
+  8032e7:	e8 38 d9 ff ff       	call   800c24 <sys_page_alloc>
+  8032ec:	89 c3                	mov    %eax,%ebx
+  8032ee:	83 c4 10             	add    $0x10,%esp
+  8032f1:	85 c0                	test   %eax,%eax
+  8032f3:	0f 88 bc 00 00 00    	js     8033b5 <pipe+0x131>
+	va = fd2data(fd0);
+  8032f9:	83 ec 0c             	sub    $0xc,%esp
+  8032fc:	ff 75 f4             	push   -0xc(%ebp)
+  8032ff:	e8 5d df ff ff       	call   801261 <fd2data>
+  803304:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803306:	83 c4 0c             	add    $0xc,%esp
+  803309:	68 07 04 00 00       	push   $0x407
+  80330e:	50                   	push   %eax
+  80330f:	6a 00                	push   $0x0
+  803311:	e8 0e d9 ff ff       	call   800c24 <sys_page_alloc>
+  803316:	89 c3                	mov    %eax,%ebx
+  803318:	83 c4 10             	add    $0x10,%esp
+  80331b:	85 c0                	test   %eax,%eax
+  80331d:	0f 88 82 00 00 00    	js     8033a5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803323:	83 ec 0c             	sub    $0xc,%esp
+  803326:	ff 75 f0             	push   -0x10(%ebp)
+  803329:	e8 33 df ff ff       	call   801261 <fd2data>
+  80332e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803335:	50                   	push   %eax
+  803336:	6a 00                	push   $0x0
+  803338:	56                   	push   %esi
+  803339:	6a 00                	push   $0x0
+  80333b:	e8 31 d9 ff ff       	call   800c71 <sys_page_map>
+  803340:	89 c3                	mov    %eax,%ebx
+  803342:	83 c4 20             	add    $0x20,%esp
+  803345:	85 c0                	test   %eax,%eax
+  803347:	78 4e                	js     803397 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803349:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80334e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803351:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803353:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803356:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80335d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803360:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803362:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803365:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80336c:	83 ec 0c             	sub    $0xc,%esp
+  80336f:	ff 75 f4             	push   -0xc(%ebp)
+  803372:	e8 da de ff ff       	call   801251 <fd2num>
+  803377:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80337a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80337c:	83 c4 04             	add    $0x4,%esp
+  80337f:	ff 75 f0             	push   -0x10(%ebp)
+  803382:	e8 ca de ff ff       	call   801251 <fd2num>
+  803387:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80338a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803395:	eb 2e                	jmp    8033c5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803397:	83 ec 08             	sub    $0x8,%esp
+  80339a:	56                   	push   %esi
+  80339b:	6a 00                	push   $0x0
+  80339d:	e8 1b d9 ff ff       	call   800cbd <sys_page_unmap>
+  8033a2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033a5:	83 ec 08             	sub    $0x8,%esp
+  8033a8:	ff 75 f0             	push   -0x10(%ebp)
+  8033ab:	6a 00                	push   $0x0
+  8033ad:	e8 0b d9 ff ff       	call   800cbd <sys_page_unmap>
+  8033b2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033b5:	83 ec 08             	sub    $0x8,%esp
+  8033b8:	ff 75 f4             	push   -0xc(%ebp)
+  8033bb:	6a 00                	push   $0x0
+  8033bd:	e8 fb d8 ff ff       	call   800cbd <sys_page_unmap>
+  8033c2:	83 c4 10             	add    $0x10,%esp
+}
+  8033c5:	89 d8                	mov    %ebx,%eax
+  8033c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033ca:	5b                   	pop    %ebx
+  8033cb:	5e                   	pop    %esi
+  8033cc:	5d                   	pop    %ebp
+  8033cd:	c3                   	ret
+
+008033ce <pipeisclosed>:
+{
+  8033ce:	55                   	push   %ebp
+  8033cf:	89 e5                	mov    %esp,%ebp
+  8033d1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033d7:	50                   	push   %eax
+  8033d8:	ff 75 08             	push   0x8(%ebp)
+  8033db:	e8 ee de ff ff       	call   8012ce <fd_lookup>
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	78 18                	js     8033ff <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033e7:	83 ec 0c             	sub    $0xc,%esp
+  8033ea:	ff 75 f4             	push   -0xc(%ebp)
+  8033ed:	e8 6f de ff ff       	call   801261 <fd2data>
+  8033f2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033f7:	e8 27 fc ff ff       	call   803023 <_pipeisclosed>
+  8033fc:	83 c4 10             	add    $0x10,%esp
+}
+  8033ff:	c9                   	leave
+  803400:	c3                   	ret
+
+00803401 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803401:	55                   	push   %ebp
+  803402:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803404:	8b 45 08             	mov    0x8(%ebp),%eax
+  803407:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80340d:	5d                   	pop    %ebp
+  80340e:	c3                   	ret
+
+0080340f <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80340f:	55                   	push   %ebp
+  803410:	89 e5                	mov    %esp,%ebp
+  803412:	56                   	push   %esi
+  803413:	53                   	push   %ebx
+  803414:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803417:	ba 00 00 00 00       	mov    $0x0,%edx
+  80341c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803421:	89 d0                	mov    %edx,%eax
+  803423:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803427:	85 c0                	test   %eax,%eax
+  803429:	74 2d                	je     803458 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80342b:	83 f8 02             	cmp    $0x2,%eax
+  80342e:	74 08                	je     803438 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803430:	b8 02 00 00 00       	mov    $0x2,%eax
+  803435:	f0 87 03             	lock xchg %eax,(%ebx)
+  803438:	be 02 00 00 00       	mov    $0x2,%esi
+  80343d:	eb 15                	jmp    803454 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80343f:	83 ec 04             	sub    $0x4,%esp
+  803442:	6a 00                	push   $0x0
+  803444:	6a 02                	push   $0x2
+  803446:	53                   	push   %ebx
+  803447:	e8 ed da ff ff       	call   800f39 <sys_futex_wait>
+  80344c:	89 f0                	mov    %esi,%eax
+  80344e:	f0 87 03             	lock xchg %eax,(%ebx)
+  803451:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803454:	85 c0                	test   %eax,%eax
+  803456:	75 e7                	jne    80343f <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803458:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80345b:	5b                   	pop    %ebx
+  80345c:	5e                   	pop    %esi
+  80345d:	5d                   	pop    %ebp
+  80345e:	c3                   	ret
+
+0080345f <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80345f:	55                   	push   %ebp
+  803460:	89 e5                	mov    %esp,%ebp
+  803462:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80346f:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803473:	f7 d8                	neg    %eax
+  803475:	19 c0                	sbb    %eax,%eax
+  803477:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  80347a:	5d                   	pop    %ebp
+  80347b:	c3                   	ret
+
+0080347c <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80347c:	55                   	push   %ebp
+  80347d:	89 e5                	mov    %esp,%ebp
+  80347f:	83 ec 08             	sub    $0x8,%esp
+  803482:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80348d:	83 f8 02             	cmp    $0x2,%eax
+  803490:	74 02                	je     803494 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803492:	c9                   	leave
+  803493:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803494:	83 ec 08             	sub    $0x8,%esp
+  803497:	6a 01                	push   $0x1
+  803499:	52                   	push   %edx
+  80349a:	e8 c9 da ff ff       	call   800f68 <sys_futex_wake>
+  80349f:	83 c4 10             	add    $0x10,%esp
+}
+  8034a2:	eb ee                	jmp    803492 <mutex_unlock+0x16>
+
+008034a4 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8034a4:	55                   	push   %ebp
+  8034a5:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8034a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034aa:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8034b0:	5d                   	pop    %ebp
+  8034b1:	c3                   	ret
+
+008034b2 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8034b2:	55                   	push   %ebp
+  8034b3:	89 e5                	mov    %esp,%ebp
+  8034b5:	57                   	push   %edi
+  8034b6:	56                   	push   %esi
+  8034b7:	53                   	push   %ebx
+  8034b8:	83 ec 18             	sub    $0x18,%esp
+  8034bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8034c1:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8034c3:	53                   	push   %ebx
+  8034c4:	e8 b3 ff ff ff       	call   80347c <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8034c9:	83 c4 0c             	add    $0xc,%esp
+  8034cc:	ff 75 10             	push   0x10(%ebp)
+  8034cf:	57                   	push   %edi
+  8034d0:	56                   	push   %esi
+  8034d1:	e8 63 da ff ff       	call   800f39 <sys_futex_wait>
+  8034d6:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8034d8:	83 c4 10             	add    $0x10,%esp
+  8034db:	be 02 00 00 00       	mov    $0x2,%esi
+  8034e0:	eb 10                	jmp    8034f2 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8034e2:	83 ec 04             	sub    $0x4,%esp
+  8034e5:	6a 00                	push   $0x0
+  8034e7:	6a 02                	push   $0x2
+  8034e9:	53                   	push   %ebx
+  8034ea:	e8 4a da ff ff       	call   800f39 <sys_futex_wait>
+  8034ef:	83 c4 10             	add    $0x10,%esp
+  8034f2:	89 f0                	mov    %esi,%eax
+  8034f4:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8034f7:	85 c0                	test   %eax,%eax
+  8034f9:	75 e7                	jne    8034e2 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8034fb:	83 ff ec             	cmp    $0xffffffec,%edi
+  8034fe:	74 05                	je     803505 <cond_timedwait+0x53>
+  803500:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803505:	89 f8                	mov    %edi,%eax
+  803507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80350a:	5b                   	pop    %ebx
+  80350b:	5e                   	pop    %esi
+  80350c:	5f                   	pop    %edi
+  80350d:	5d                   	pop    %ebp
+  80350e:	c3                   	ret
+
+0080350f <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80350f:	55                   	push   %ebp
+  803510:	89 e5                	mov    %esp,%ebp
+  803512:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803515:	6a 00                	push   $0x0
+  803517:	ff 75 0c             	push   0xc(%ebp)
+  80351a:	ff 75 08             	push   0x8(%ebp)
+  80351d:	e8 90 ff ff ff       	call   8034b2 <cond_timedwait>
+}
+  803522:	83 c4 10             	add    $0x10,%esp
+  803525:	c9                   	leave
+  803526:	c3                   	ret
+
+00803527 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803527:	55                   	push   %ebp
+  803528:	89 e5                	mov    %esp,%ebp
+  80352a:	83 ec 10             	sub    $0x10,%esp
+  80352d:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803530:	ba 01 00 00 00       	mov    $0x1,%edx
+  803535:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803539:	6a 01                	push   $0x1
+  80353b:	50                   	push   %eax
+  80353c:	e8 27 da ff ff       	call   800f68 <sys_futex_wake>
+}
+  803541:	83 c4 10             	add    $0x10,%esp
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+00803546 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803546:	55                   	push   %ebp
+  803547:	89 e5                	mov    %esp,%ebp
+  803549:	83 ec 10             	sub    $0x10,%esp
+  80354c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80354f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803554:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803558:	68 00 04 00 00       	push   $0x400
+  80355d:	50                   	push   %eax
+  80355e:	e8 05 da ff ff       	call   800f68 <sys_futex_wake>
+}
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	c9                   	leave
+  803567:	c3                   	ret
+
+00803568 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803568:	55                   	push   %ebp
+  803569:	89 e5                	mov    %esp,%ebp
+  80356b:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80356e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803571:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803573:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80357a:	5d                   	pop    %ebp
+  80357b:	c3                   	ret
+
+0080357c <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80357c:	55                   	push   %ebp
+  80357d:	89 e5                	mov    %esp,%ebp
+  80357f:	53                   	push   %ebx
+  803580:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803583:	8b 11                	mov    (%ecx),%edx
+  803585:	85 d2                	test   %edx,%edx
+  803587:	74 14                	je     80359d <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803589:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80358c:	89 d0                	mov    %edx,%eax
+  80358e:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803592:	39 c2                	cmp    %eax,%edx
+  803594:	75 ed                	jne    803583 <sem_trywait+0x7>
+			return 0;
+  803596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359b:	eb 05                	jmp    8035a2 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80359d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8035a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035a5:	c9                   	leave
+  8035a6:	c3                   	ret
+
+008035a7 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8035a7:	55                   	push   %ebp
+  8035a8:	89 e5                	mov    %esp,%ebp
+  8035aa:	57                   	push   %edi
+  8035ab:	56                   	push   %esi
+  8035ac:	53                   	push   %ebx
+  8035ad:	83 ec 1c             	sub    $0x1c,%esp
+  8035b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8035b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8035b6:	e8 f6 d8 ff ff       	call   800eb1 <sys_time_msec>
+  8035bb:	01 f8                	add    %edi,%eax
+  8035bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8035c0:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8035c5:	eb 28                	jmp    8035ef <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8035c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035cc:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8035d1:	83 ec 04             	sub    $0x4,%esp
+  8035d4:	56                   	push   %esi
+  8035d5:	6a 00                	push   $0x0
+  8035d7:	53                   	push   %ebx
+  8035d8:	e8 5c d9 ff ff       	call   800f39 <sys_futex_wait>
+  8035dd:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8035e2:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8035ed:	74 2e                	je     80361d <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8035ef:	83 ec 0c             	sub    $0xc,%esp
+  8035f2:	53                   	push   %ebx
+  8035f3:	e8 84 ff ff ff       	call   80357c <sem_trywait>
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	79 19                	jns    803618 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8035ff:	85 ff                	test   %edi,%edi
+  803601:	74 c4                	je     8035c7 <sem_timedwait+0x20>
+  803603:	e8 a9 d8 ff ff       	call   800eb1 <sys_time_msec>
+  803608:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80360b:	29 c6                	sub    %eax,%esi
+  80360d:	85 f6                	test   %esi,%esi
+  80360f:	7f b6                	jg     8035c7 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803611:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803616:	eb 05                	jmp    80361d <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803618:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80361d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803620:	5b                   	pop    %ebx
+  803621:	5e                   	pop    %esi
+  803622:	5f                   	pop    %edi
+  803623:	5d                   	pop    %ebp
+  803624:	c3                   	ret
+
+00803625 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803625:	55                   	push   %ebp
+  803626:	89 e5                	mov    %esp,%ebp
+  803628:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80362b:	6a 00                	push   $0x0
+  80362d:	ff 75 08             	push   0x8(%ebp)
+  803630:	e8 72 ff ff ff       	call   8035a7 <sem_timedwait>
+}
+  803635:	83 c4 10             	add    $0x10,%esp
+  803638:	c9                   	leave
+  803639:	c3                   	ret
+
+0080363a <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80363a:	55                   	push   %ebp
+  80363b:	89 e5                	mov    %esp,%ebp
+  80363d:	83 ec 08             	sub    $0x8,%esp
+  803640:	8b 45 08             	mov    0x8(%ebp),%eax
+  803643:	ba 01 00 00 00       	mov    $0x1,%edx
+  803648:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80364c:	8b 50 04             	mov    0x4(%eax),%edx
+  80364f:	85 d2                	test   %edx,%edx
+  803651:	75 02                	jne    803655 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803653:	c9                   	leave
+  803654:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803655:	83 ec 08             	sub    $0x8,%esp
+  803658:	6a 01                	push   $0x1
+  80365a:	50                   	push   %eax
+  80365b:	e8 08 d9 ff ff       	call   800f68 <sys_futex_wake>
+  803660:	83 c4 10             	add    $0x10,%esp
+}
+  803663:	eb ee                	jmp    803653 <sem_post+0x19>
+
+00803665 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803665:	55                   	push   %ebp
+  803666:	89 e5                	mov    %esp,%ebp
+  803668:	57                   	push   %edi
+  803669:	56                   	push   %esi
+  80366a:	53                   	push   %ebx
+  80366b:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80366e:	68 20 60 80 00       	push   $0x806020
+  803673:	e8 97 fd ff ff       	call   80340f <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803678:	a1 44 60 80 00       	mov    0x806044,%eax
+  80367d:	83 c4 10             	add    $0x10,%esp
+  803680:	85 c0                	test   %eax,%eax
+  803682:	75 19                	jne    80369d <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803684:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803689:	8b 00                	mov    (%eax),%eax
+  80368b:	8b 40 48             	mov    0x48(%eax),%eax
+  80368e:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803693:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  80369a:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80369d:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8036a2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036a5:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8036ac:	8b 40 04             	mov    0x4(%eax),%eax
+  8036af:	85 c0                	test   %eax,%eax
+  8036b1:	0f 84 e4 00 00 00    	je     80379b <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8036b7:	83 c3 01             	add    $0x1,%ebx
+  8036ba:	83 fb 20             	cmp    $0x20,%ebx
+  8036bd:	75 e3                	jne    8036a2 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8036bf:	83 ec 0c             	sub    $0xc,%esp
+  8036c2:	68 20 60 80 00       	push   $0x806020
+  8036c7:	e8 b0 fd ff ff       	call   80347c <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8036cc:	83 c4 10             	add    $0x10,%esp
+  8036cf:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8036d4:	e9 b8 00 00 00       	jmp    803791 <pthread_create+0x12c>
+  8036d9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8036dc:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8036df:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8036e1:	39 f3                	cmp    %esi,%ebx
+  8036e3:	73 16                	jae    8036fb <pthread_create+0x96>
+		va -= PGSIZE;
+  8036e5:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8036eb:	83 ec 08             	sub    $0x8,%esp
+  8036ee:	56                   	push   %esi
+  8036ef:	6a 00                	push   $0x0
+  8036f1:	e8 c7 d5 ff ff       	call   800cbd <sys_page_unmap>
+  8036f6:	83 c4 10             	add    $0x10,%esp
+  8036f9:	eb e6                	jmp    8036e1 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8036fb:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8036fe:	83 ec 08             	sub    $0x8,%esp
+  803701:	ff 75 e4             	push   -0x1c(%ebp)
+  803704:	6a 00                	push   $0x0
+  803706:	e8 b2 d5 ff ff       	call   800cbd <sys_page_unmap>
+	return r;
+  80370b:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80370e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803711:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803718:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80371f:	eb 70                	jmp    803791 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803721:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803724:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80372b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80372e:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803731:	8b 55 10             	mov    0x10(%ebp),%edx
+  803734:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803737:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80373e:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803743:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803746:	29 c8                	sub    %ecx,%eax
+  803748:	85 db                	test   %ebx,%ebx
+  80374a:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803751:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803754:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80375b:	83 ec 04             	sub    $0x4,%esp
+  80375e:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803763:	29 ca                	sub    %ecx,%edx
+  803765:	52                   	push   %edx
+	*--esp = 0;
+  803766:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803769:	50                   	push   %eax
+  80376a:	68 c2 39 80 00       	push   $0x8039c2
+  80376f:	e8 99 d8 ff ff       	call   80100d <sys_thread_create>
+  803774:	89 c7                	mov    %eax,%edi
+  803776:	83 c4 10             	add    $0x10,%esp
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	78 91                	js     80370e <pthread_create+0xa9>
+	th->th_env = id;
+  80377d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803780:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803787:	8b 45 08             	mov    0x8(%ebp),%eax
+  80378a:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  80378c:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803791:	89 f8                	mov    %edi,%eax
+  803793:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803796:	5b                   	pop    %ebx
+  803797:	5e                   	pop    %esi
+  803798:	5f                   	pop    %edi
+  803799:	5d                   	pop    %ebp
+  80379a:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  80379b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80379e:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8037a5:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8037ac:	83 ec 0c             	sub    $0xc,%esp
+  8037af:	68 20 60 80 00       	push   $0x806020
+  8037b4:	e8 c3 fc ff ff       	call   80347c <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8037b9:	89 d9                	mov    %ebx,%ecx
+  8037bb:	c1 e1 10             	shl    $0x10,%ecx
+  8037be:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8037c1:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8037c6:	29 c8                	sub    %ecx,%eax
+  8037c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8037cb:	c1 e8 16             	shr    $0x16,%eax
+  8037ce:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8037d5:	83 c4 10             	add    $0x10,%esp
+  8037d8:	a8 01                	test   $0x1,%al
+  8037da:	74 15                	je     8037f1 <pthread_create+0x18c>
+  8037dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037df:	c1 e8 0c             	shr    $0xc,%eax
+  8037e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037e9:	a8 01                	test   $0x1,%al
+  8037eb:	0f 85 30 ff ff ff    	jne    803721 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8037f1:	83 ec 04             	sub    $0x4,%esp
+  8037f4:	6a 07                	push   $0x7
+  8037f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8037f9:	6a 00                	push   $0x0
+  8037fb:	e8 24 d4 ff ff       	call   800c24 <sys_page_alloc>
+  803800:	89 c7                	mov    %eax,%edi
+  803802:	83 c4 10             	add    $0x10,%esp
+  803805:	85 c0                	test   %eax,%eax
+  803807:	0f 88 01 ff ff ff    	js     80370e <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80380d:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803812:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803815:	29 d0                	sub    %edx,%eax
+  803817:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80381a:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80381c:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803821:	29 d0                	sub    %edx,%eax
+  803823:	89 c7                	mov    %eax,%edi
+  803825:	39 fe                	cmp    %edi,%esi
+  803827:	0f 83 f4 fe ff ff    	jae    803721 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80382d:	83 ec 04             	sub    $0x4,%esp
+  803830:	6a 07                	push   $0x7
+  803832:	56                   	push   %esi
+  803833:	6a 00                	push   $0x0
+  803835:	e8 ea d3 ff ff       	call   800c24 <sys_page_alloc>
+  80383a:	83 c4 10             	add    $0x10,%esp
+  80383d:	85 c0                	test   %eax,%eax
+  80383f:	0f 88 94 fe ff ff    	js     8036d9 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803845:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80384b:	eb d8                	jmp    803825 <pthread_create+0x1c0>
+
+0080384d <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80384d:	55                   	push   %ebp
+  80384e:	89 e5                	mov    %esp,%ebp
+  803850:	57                   	push   %edi
+  803851:	56                   	push   %esi
+  803852:	53                   	push   %ebx
+  803853:	83 ec 0c             	sub    $0xc,%esp
+  803856:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803859:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80385c:	83 f8 1e             	cmp    $0x1e,%eax
+  80385f:	0f 87 c7 00 00 00    	ja     80392c <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803865:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803867:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80386d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803872:	77 12                	ja     803886 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803874:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803879:	29 d0                	sub    %edx,%eax
+  80387b:	c1 e8 10             	shr    $0x10,%eax
+  80387e:	39 c3                	cmp    %eax,%ebx
+  803880:	0f 84 ad 00 00 00    	je     803933 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803886:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803889:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803890:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803897:	eb 10                	jmp    8038a9 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803899:	83 ec 04             	sub    $0x4,%esp
+  80389c:	6a 00                	push   $0x0
+  80389e:	6a 01                	push   $0x1
+  8038a0:	57                   	push   %edi
+  8038a1:	e8 93 d6 ff ff       	call   800f39 <sys_futex_wait>
+  8038a6:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8038a9:	8b 46 04             	mov    0x4(%esi),%eax
+  8038ac:	83 f8 01             	cmp    $0x1,%eax
+  8038af:	74 e8                	je     803899 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8038b1:	83 f8 02             	cmp    $0x2,%eax
+  8038b4:	0f 85 80 00 00 00    	jne    80393a <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038ba:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8038bd:	c1 e6 02             	shl    $0x2,%esi
+  8038c0:	eb 05                	jmp    8038c7 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8038c2:	e8 31 d3 ff ff       	call   800bf8 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8038c7:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8038cd:	89 ca                	mov    %ecx,%edx
+  8038cf:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8038d5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8038d8:	c1 e0 04             	shl    $0x4,%eax
+  8038db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038e0:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8038e3:	39 c1                	cmp    %eax,%ecx
+  8038e5:	75 12                	jne    8038f9 <pthread_join+0xac>
+  8038e7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8038ea:	c1 e0 04             	shl    $0x4,%eax
+  8038ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038f2:	8b 40 54             	mov    0x54(%eax),%eax
+  8038f5:	85 c0                	test   %eax,%eax
+  8038f7:	75 c9                	jne    8038c2 <pthread_join+0x75>
+	if (ret_store)
+  8038f9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8038fd:	74 0f                	je     80390e <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8038ff:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803902:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803909:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80390c:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80390e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803911:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803918:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80391f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803927:	5b                   	pop    %ebx
+  803928:	5e                   	pop    %esi
+  803929:	5f                   	pop    %edi
+  80392a:	5d                   	pop    %ebp
+  80392b:	c3                   	ret
+		return -E_INVAL;
+  80392c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803931:	eb f1                	jmp    803924 <pthread_join+0xd7>
+  803933:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803938:	eb ea                	jmp    803924 <pthread_join+0xd7>
+		return -E_INVAL;
+  80393a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80393f:	eb e3                	jmp    803924 <pthread_join+0xd7>
+
+00803941 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803941:	55                   	push   %ebp
+  803942:	89 e5                	mov    %esp,%ebp
+  803944:	53                   	push   %ebx
+  803945:	83 ec 04             	sub    $0x4,%esp
+  803948:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80394a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803950:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803955:	77 0c                	ja     803963 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803957:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80395c:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80395e:	c1 e8 10             	shr    $0x10,%eax
+  803961:	75 0a                	jne    80396d <pthread_exit+0x2c>
+		exit();
+  803963:	e8 dd c7 ff ff       	call   800145 <exit>
+  803968:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80396d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803974:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803977:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80397e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803981:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803984:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80398b:	83 ec 08             	sub    $0x8,%esp
+  80398e:	6a 20                	push   $0x20
+  803990:	01 c2                	add    %eax,%edx
+  803992:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803999:	50                   	push   %eax
+  80399a:	e8 c9 d5 ff ff       	call   800f68 <sys_futex_wake>
+	sys_env_destroy(0);
+  80399f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8039a6:	e8 d6 d1 ff ff       	call   800b81 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8039ab:	83 c4 0c             	add    $0xc,%esp
+  8039ae:	68 1a 4d 80 00       	push   $0x804d1a
+  8039b3:	68 a5 00 00 00       	push   $0xa5
+  8039b8:	68 34 4d 80 00       	push   $0x804d34
+  8039bd:	e8 cd 03 00 00       	call   803d8f <_panic>
+
+008039c2 <pthread_start>:
+{
+  8039c2:	55                   	push   %ebp
+  8039c3:	89 e5                	mov    %esp,%ebp
+  8039c5:	53                   	push   %ebx
+  8039c6:	83 ec 04             	sub    $0x4,%esp
+  8039c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8039cc:	e8 fb d1 ff ff       	call   800bcc <sys_getenvid>
+  8039d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8039d6:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8039dc:	85 db                	test   %ebx,%ebx
+  8039de:	74 0c                	je     8039ec <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039e0:	89 d9                	mov    %ebx,%ecx
+  8039e2:	c1 e1 10             	shl    $0x10,%ecx
+  8039e5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039ea:	29 ca                	sub    %ecx,%edx
+  8039ec:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8039ef:	c1 e0 04             	shl    $0x4,%eax
+  8039f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039f7:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8039f9:	83 ec 0c             	sub    $0xc,%esp
+  8039fc:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803a03:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803a06:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803a0d:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803a14:	89 04 24             	mov    %eax,(%esp)
+  803a17:	e8 25 ff ff ff       	call   803941 <pthread_exit>
+
+00803a1c <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803a1c:	55                   	push   %ebp
+  803a1d:	89 e5                	mov    %esp,%ebp
+  803a1f:	57                   	push   %edi
+  803a20:	56                   	push   %esi
+  803a21:	53                   	push   %ebx
+  803a22:	83 ec 1c             	sub    $0x1c,%esp
+  803a25:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a27:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803a2d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a34:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a39:	77 0d                	ja     803a48 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a3b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a40:	29 d0                	sub    %edx,%eax
+  803a42:	c1 e8 10             	shr    $0x10,%eax
+  803a45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a4d:	eb 2f                	jmp    803a7e <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803a4f:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a55:	8b 01                	mov    (%ecx),%eax
+  803a57:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803a5a:	39 c2                	cmp    %eax,%edx
+  803a5c:	75 14                	jne    803a72 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803a5e:	83 ec 0c             	sub    $0xc,%esp
+  803a61:	57                   	push   %edi
+  803a62:	e8 1a d1 ff ff       	call   800b81 <sys_env_destroy>
+  803a67:	83 c4 10             	add    $0x10,%esp
+  803a6a:	85 c0                	test   %eax,%eax
+  803a6c:	0f 88 97 00 00 00    	js     803b09 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a72:	83 c3 01             	add    $0x1,%ebx
+  803a75:	83 fb 20             	cmp    $0x20,%ebx
+  803a78:	0f 84 d2 00 00 00    	je     803b50 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803a7e:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803a81:	74 ef                	je     803a72 <pthread_kill_others+0x56>
+  803a83:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a86:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803a8d:	8b 40 04             	mov    0x4(%eax),%eax
+  803a90:	83 f8 01             	cmp    $0x1,%eax
+  803a93:	75 dd                	jne    803a72 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803a95:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a98:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803a9f:	89 fe                	mov    %edi,%esi
+  803aa1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803aa7:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803aaa:	c1 e0 04             	shl    $0x4,%eax
+  803aad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ab2:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803ab5:	39 c7                	cmp    %eax,%edi
+  803ab7:	75 b9                	jne    803a72 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803ab9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803abc:	c1 e0 04             	shl    $0x4,%eax
+  803abf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ac4:	8b 40 54             	mov    0x54(%eax),%eax
+  803ac7:	85 c0                	test   %eax,%eax
+  803ac9:	74 a7                	je     803a72 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803acb:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ace:	c1 e0 04             	shl    $0x4,%eax
+  803ad1:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803ad7:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ad9:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803adf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ae4:	0f 87 65 ff ff ff    	ja     803a4f <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803aea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803aef:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803af1:	c1 e8 10             	shr    $0x10,%eax
+  803af4:	0f 84 55 ff ff ff    	je     803a4f <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803afa:	c1 e0 10             	shl    $0x10,%eax
+  803afd:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803b02:	29 c1                	sub    %eax,%ecx
+  803b04:	e9 4c ff ff ff       	jmp    803a55 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803b09:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803b0c:	c1 e2 04             	shl    $0x4,%edx
+  803b0f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b15:	8b 52 48             	mov    0x48(%edx),%edx
+  803b18:	39 fa                	cmp    %edi,%edx
+  803b1a:	0f 85 52 ff ff ff    	jne    803a72 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803b20:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803b23:	c1 e2 04             	shl    $0x4,%edx
+  803b26:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b2c:	8b 52 54             	mov    0x54(%edx),%edx
+  803b2f:	85 d2                	test   %edx,%edx
+  803b31:	0f 84 3b ff ff ff    	je     803a72 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803b37:	83 ec 0c             	sub    $0xc,%esp
+  803b3a:	50                   	push   %eax
+  803b3b:	57                   	push   %edi
+  803b3c:	68 44 4d 80 00       	push   $0x804d44
+  803b41:	68 bb 00 00 00       	push   $0xbb
+  803b46:	68 34 4d 80 00       	push   $0x804d34
+  803b4b:	e8 3f 02 00 00       	call   803d8f <_panic>
+	}
+}
+  803b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b53:	5b                   	pop    %ebx
+  803b54:	5e                   	pop    %esi
+  803b55:	5f                   	pop    %edi
+  803b56:	5d                   	pop    %ebp
+  803b57:	c3                   	ret
+
+00803b58 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803b58:	55                   	push   %ebp
+  803b59:	89 e5                	mov    %esp,%ebp
+  803b5b:	53                   	push   %ebx
+  803b5c:	83 ec 04             	sub    $0x4,%esp
+  803b5f:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b61:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803b67:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803b6d:	0f 87 85 00 00 00    	ja     803bf8 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b73:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803b78:	29 c3                	sub    %eax,%ebx
+  803b7a:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803b7d:	83 ec 04             	sub    $0x4,%esp
+  803b80:	68 80 02 00 00       	push   $0x280
+  803b85:	6a 00                	push   $0x0
+  803b87:	68 40 60 80 00       	push   $0x806040
+  803b8c:	e8 a6 cd ff ff       	call   800937 <memset>
+	threads_mu.m_state = 0;
+  803b91:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803b98:	00 00 00 
+	if (self != 0) {
+  803b9b:	83 c4 10             	add    $0x10,%esp
+  803b9e:	85 db                	test   %ebx,%ebx
+  803ba0:	74 51                	je     803bf3 <pthread_fork_child+0x9b>
+  803ba2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ba4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803baa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803baf:	77 18                	ja     803bc9 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803bb1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803bb6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803bb8:	c1 e8 10             	shr    $0x10,%eax
+  803bbb:	74 0c                	je     803bc9 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803bbd:	c1 e0 10             	shl    $0x10,%eax
+  803bc0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803bc5:	29 c2                	sub    %eax,%edx
+  803bc7:	eb 06                	jmp    803bcf <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803bc9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803bcf:	8b 02                	mov    (%edx),%eax
+  803bd1:	8b 48 48             	mov    0x48(%eax),%ecx
+  803bd4:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803bdb:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803bde:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803be5:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803bec:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bf6:	c9                   	leave
+  803bf7:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803bf8:	83 ec 04             	sub    $0x4,%esp
+  803bfb:	68 80 02 00 00       	push   $0x280
+  803c00:	6a 00                	push   $0x0
+  803c02:	68 40 60 80 00       	push   $0x806040
+  803c07:	e8 2b cd ff ff       	call   800937 <memset>
+	threads_mu.m_state = 0;
+  803c0c:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803c13:	00 00 00 
+  803c16:	83 c4 10             	add    $0x10,%esp
+  803c19:	eb d8                	jmp    803bf3 <pthread_fork_child+0x9b>
+
+00803c1b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c20:	c3                   	ret
+
+00803c21 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c21:	55                   	push   %ebp
+  803c22:	89 e5                	mov    %esp,%ebp
+  803c24:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803c27:	68 69 4d 80 00       	push   $0x804d69
+  803c2c:	ff 75 0c             	push   0xc(%ebp)
+  803c2f:	e8 b2 cb ff ff       	call   8007e6 <strcpy>
+	return 0;
+}
+  803c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c39:	c9                   	leave
+  803c3a:	c3                   	ret
+
+00803c3b <devcons_write>:
+{
+  803c3b:	55                   	push   %ebp
+  803c3c:	89 e5                	mov    %esp,%ebp
+  803c3e:	57                   	push   %edi
+  803c3f:	56                   	push   %esi
+  803c40:	53                   	push   %ebx
+  803c41:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803c47:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803c4c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803c52:	eb 2e                	jmp    803c82 <devcons_write+0x47>
+		m = n - tot;
+  803c54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c57:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803c59:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c5e:	39 c3                	cmp    %eax,%ebx
+  803c60:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c63:	83 ec 04             	sub    $0x4,%esp
+  803c66:	53                   	push   %ebx
+  803c67:	89 f0                	mov    %esi,%eax
+  803c69:	03 45 0c             	add    0xc(%ebp),%eax
+  803c6c:	50                   	push   %eax
+  803c6d:	57                   	push   %edi
+  803c6e:	e8 f9 cc ff ff       	call   80096c <memmove>
+		sys_cputs(buf, m);
+  803c73:	83 c4 08             	add    $0x8,%esp
+  803c76:	53                   	push   %ebx
+  803c77:	57                   	push   %edi
+  803c78:	e8 ad ce ff ff       	call   800b2a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803c7d:	01 de                	add    %ebx,%esi
+  803c7f:	83 c4 10             	add    $0x10,%esp
+  803c82:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803c85:	72 cd                	jb     803c54 <devcons_write+0x19>
+}
+  803c87:	89 f0                	mov    %esi,%eax
+  803c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c8c:	5b                   	pop    %ebx
+  803c8d:	5e                   	pop    %esi
+  803c8e:	5f                   	pop    %edi
+  803c8f:	5d                   	pop    %ebp
+  803c90:	c3                   	ret
+
+00803c91 <devcons_read>:
+{
+  803c91:	55                   	push   %ebp
+  803c92:	89 e5                	mov    %esp,%ebp
+  803c94:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c9c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803ca0:	75 07                	jne    803ca9 <devcons_read+0x18>
+  803ca2:	eb 1f                	jmp    803cc3 <devcons_read+0x32>
+		sys_yield();
+  803ca4:	e8 4f cf ff ff       	call   800bf8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803ca9:	e8 a7 ce ff ff       	call   800b55 <sys_cgetc>
+  803cae:	85 c0                	test   %eax,%eax
+  803cb0:	74 f2                	je     803ca4 <devcons_read+0x13>
+	if (c < 0)
+  803cb2:	78 0f                	js     803cc3 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803cb4:	83 f8 04             	cmp    $0x4,%eax
+  803cb7:	74 0c                	je     803cc5 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cbc:	88 02                	mov    %al,(%edx)
+	return 1;
+  803cbe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803cc3:	c9                   	leave
+  803cc4:	c3                   	ret
+		return 0;
+  803cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cca:	eb f7                	jmp    803cc3 <devcons_read+0x32>
+
+00803ccc <cputchar>:
+{
+  803ccc:	55                   	push   %ebp
+  803ccd:	89 e5                	mov    %esp,%ebp
+  803ccf:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cd5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803cd8:	6a 01                	push   $0x1
+  803cda:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cdd:	50                   	push   %eax
+  803cde:	e8 47 ce ff ff       	call   800b2a <sys_cputs>
+}
+  803ce3:	83 c4 10             	add    $0x10,%esp
+  803ce6:	c9                   	leave
+  803ce7:	c3                   	ret
+
+00803ce8 <getchar>:
+{
+  803ce8:	55                   	push   %ebp
+  803ce9:	89 e5                	mov    %esp,%ebp
+  803ceb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803cee:	6a 01                	push   $0x1
+  803cf0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cf3:	50                   	push   %eax
+  803cf4:	6a 00                	push   $0x0
+  803cf6:	e8 63 d8 ff ff       	call   80155e <read>
+	if (r < 0)
+  803cfb:	83 c4 10             	add    $0x10,%esp
+  803cfe:	85 c0                	test   %eax,%eax
+  803d00:	78 06                	js     803d08 <getchar+0x20>
+	if (r < 1)
+  803d02:	74 06                	je     803d0a <getchar+0x22>
+	return c;
+  803d04:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803d08:	c9                   	leave
+  803d09:	c3                   	ret
+		return -E_EOF;
+  803d0a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d0f:	eb f7                	jmp    803d08 <getchar+0x20>
+
+00803d11 <iscons>:
+{
+  803d11:	55                   	push   %ebp
+  803d12:	89 e5                	mov    %esp,%ebp
+  803d14:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d1a:	50                   	push   %eax
+  803d1b:	ff 75 08             	push   0x8(%ebp)
+  803d1e:	e8 ab d5 ff ff       	call   8012ce <fd_lookup>
+  803d23:	83 c4 10             	add    $0x10,%esp
+  803d26:	85 c0                	test   %eax,%eax
+  803d28:	78 11                	js     803d3b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803d2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d2d:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803d33:	39 10                	cmp    %edx,(%eax)
+  803d35:	0f 94 c0             	sete   %al
+  803d38:	0f b6 c0             	movzbl %al,%eax
+}
+  803d3b:	c9                   	leave
+  803d3c:	c3                   	ret
+
+00803d3d <opencons>:
+{
+  803d3d:	55                   	push   %ebp
+  803d3e:	89 e5                	mov    %esp,%ebp
+  803d40:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803d43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d46:	50                   	push   %eax
+  803d47:	e8 2c d5 ff ff       	call   801278 <fd_alloc>
+  803d4c:	83 c4 10             	add    $0x10,%esp
+  803d4f:	85 c0                	test   %eax,%eax
+  803d51:	78 3a                	js     803d8d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803d53:	83 ec 04             	sub    $0x4,%esp
+  803d56:	68 07 04 00 00       	push   $0x407
+  803d5b:	ff 75 f4             	push   -0xc(%ebp)
+  803d5e:	6a 00                	push   $0x0
+  803d60:	e8 bf ce ff ff       	call   800c24 <sys_page_alloc>
+  803d65:	83 c4 10             	add    $0x10,%esp
+  803d68:	85 c0                	test   %eax,%eax
+  803d6a:	78 21                	js     803d8d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d6f:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803d75:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d7a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d81:	83 ec 0c             	sub    $0xc,%esp
+  803d84:	50                   	push   %eax
+  803d85:	e8 c7 d4 ff ff       	call   801251 <fd2num>
+  803d8a:	83 c4 10             	add    $0x10,%esp
+}
+  803d8d:	c9                   	leave
+  803d8e:	c3                   	ret
+
+00803d8f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803d8f:	55                   	push   %ebp
+  803d90:	89 e5                	mov    %esp,%ebp
+  803d92:	56                   	push   %esi
+  803d93:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803d94:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d97:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803d9d:	e8 2a ce ff ff       	call   800bcc <sys_getenvid>
+  803da2:	83 ec 0c             	sub    $0xc,%esp
+  803da5:	ff 75 0c             	push   0xc(%ebp)
+  803da8:	ff 75 08             	push   0x8(%ebp)
+  803dab:	56                   	push   %esi
+  803dac:	50                   	push   %eax
+  803dad:	68 78 4d 80 00       	push   $0x804d78
+  803db2:	e8 4b c4 ff ff       	call   800202 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803db7:	83 c4 18             	add    $0x18,%esp
+  803dba:	53                   	push   %ebx
+  803dbb:	ff 75 10             	push   0x10(%ebp)
+  803dbe:	e8 ee c3 ff ff       	call   8001b1 <vcprintf>
+	cprintf("\n");
+  803dc3:	c7 04 24 d6 4e 80 00 	movl   $0x804ed6,(%esp)
+  803dca:	e8 33 c4 ff ff       	call   800202 <cprintf>
+  803dcf:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803dd2:	cc                   	int3
+	while (1)
+  803dd3:	eb fd                	jmp    803dd2 <_panic+0x43>
+
+00803dd5 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803dd5:	55                   	push   %ebp
+  803dd6:	89 e5                	mov    %esp,%ebp
+  803dd8:	57                   	push   %edi
+  803dd9:	56                   	push   %esi
+  803dda:	53                   	push   %ebx
+  803ddb:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803dde:	89 d6                	mov    %edx,%esi
+  803de0:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803de3:	89 cf                	mov    %ecx,%edi
+  803de5:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803de8:	89 fa                	mov    %edi,%edx
+  803dea:	80 ce 08             	or     $0x8,%dh
+  803ded:	f6 c5 08             	test   $0x8,%ch
+  803df0:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803df3:	57                   	push   %edi
+  803df4:	56                   	push   %esi
+  803df5:	50                   	push   %eax
+  803df6:	56                   	push   %esi
+  803df7:	6a 00                	push   $0x0
+  803df9:	e8 73 ce ff ff       	call   800c71 <sys_page_map>
+	if (r < 0) {
+  803dfe:	83 c4 20             	add    $0x20,%esp
+  803e01:	85 c0                	test   %eax,%eax
+  803e03:	78 27                	js     803e2c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803e05:	83 ec 0c             	sub    $0xc,%esp
+  803e08:	57                   	push   %edi
+  803e09:	56                   	push   %esi
+  803e0a:	6a 00                	push   $0x0
+  803e0c:	56                   	push   %esi
+  803e0d:	6a 00                	push   $0x0
+  803e0f:	e8 5d ce ff ff       	call   800c71 <sys_page_map>
+  803e14:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e16:	83 c4 20             	add    $0x20,%esp
+  803e19:	85 c0                	test   %eax,%eax
+  803e1b:	78 24                	js     803e41 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803e1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e22:	89 d8                	mov    %ebx,%eax
+  803e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e27:	5b                   	pop    %ebx
+  803e28:	5e                   	pop    %esi
+  803e29:	5f                   	pop    %edi
+  803e2a:	5d                   	pop    %ebp
+  803e2b:	c3                   	ret
+  803e2c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e2e:	83 ec 08             	sub    $0x8,%esp
+  803e31:	50                   	push   %eax
+  803e32:	68 9c 4d 80 00       	push   $0x804d9c
+  803e37:	e8 c6 c3 ff ff       	call   800202 <cprintf>
+		return r;
+  803e3c:	83 c4 10             	add    $0x10,%esp
+  803e3f:	eb e1                	jmp    803e22 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803e41:	83 ec 08             	sub    $0x8,%esp
+  803e44:	50                   	push   %eax
+  803e45:	68 cc 4d 80 00       	push   $0x804dcc
+  803e4a:	e8 b3 c3 ff ff       	call   800202 <cprintf>
+		return r;
+  803e4f:	83 c4 10             	add    $0x10,%esp
+  803e52:	eb ce                	jmp    803e22 <duppage_cow+0x4d>
+
+00803e54 <duppage>:
+{
+  803e54:	55                   	push   %ebp
+  803e55:	89 e5                	mov    %esp,%ebp
+  803e57:	53                   	push   %ebx
+  803e58:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803e5b:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803e5e:	51                   	push   %ecx
+  803e5f:	52                   	push   %edx
+  803e60:	50                   	push   %eax
+  803e61:	52                   	push   %edx
+  803e62:	6a 00                	push   $0x0
+  803e64:	e8 08 ce ff ff       	call   800c71 <sys_page_map>
+	if (r < 0) {
+  803e69:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803e6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	78 07                	js     803e7c <duppage+0x28>
+}
+  803e75:	89 d8                	mov    %ebx,%eax
+  803e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e7a:	c9                   	leave
+  803e7b:	c3                   	ret
+  803e7c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803e7e:	83 ec 08             	sub    $0x8,%esp
+  803e81:	50                   	push   %eax
+  803e82:	68 9c 4d 80 00       	push   $0x804d9c
+  803e87:	e8 76 c3 ff ff       	call   800202 <cprintf>
+		return r;
+  803e8c:	83 c4 10             	add    $0x10,%esp
+  803e8f:	eb e4                	jmp    803e75 <duppage+0x21>
+
+00803e91 <cow_copy>:
+{
+  803e91:	55                   	push   %ebp
+  803e92:	89 e5                	mov    %esp,%ebp
+  803e94:	56                   	push   %esi
+  803e95:	53                   	push   %ebx
+  803e96:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803e98:	83 ec 04             	sub    $0x4,%esp
+  803e9b:	6a 07                	push   $0x7
+  803e9d:	68 00 f0 7f 00       	push   $0x7ff000
+  803ea2:	6a 00                	push   $0x0
+  803ea4:	e8 7b cd ff ff       	call   800c24 <sys_page_alloc>
+	if (r < 0) {
+  803ea9:	83 c4 10             	add    $0x10,%esp
+  803eac:	85 c0                	test   %eax,%eax
+  803eae:	78 58                	js     803f08 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803eb0:	83 ec 04             	sub    $0x4,%esp
+  803eb3:	68 00 10 00 00       	push   $0x1000
+  803eb8:	56                   	push   %esi
+  803eb9:	68 00 f0 7f 00       	push   $0x7ff000
+  803ebe:	e8 a9 ca ff ff       	call   80096c <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803ec3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803eca:	56                   	push   %esi
+  803ecb:	6a 00                	push   $0x0
+  803ecd:	68 00 f0 7f 00       	push   $0x7ff000
+  803ed2:	6a 00                	push   $0x0
+  803ed4:	e8 98 cd ff ff       	call   800c71 <sys_page_map>
+  803ed9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803edb:	83 c4 20             	add    $0x20,%esp
+  803ede:	85 c0                	test   %eax,%eax
+  803ee0:	78 3b                	js     803f1d <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803ee2:	83 ec 08             	sub    $0x8,%esp
+  803ee5:	68 00 f0 7f 00       	push   $0x7ff000
+  803eea:	6a 00                	push   $0x0
+  803eec:	e8 cc cd ff ff       	call   800cbd <sys_page_unmap>
+  803ef1:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ef3:	83 c4 10             	add    $0x10,%esp
+  803ef6:	85 c0                	test   %eax,%eax
+  803ef8:	78 45                	js     803f3f <cow_copy+0xae>
+	return 0;
+  803efa:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803eff:	89 d8                	mov    %ebx,%eax
+  803f01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f04:	5b                   	pop    %ebx
+  803f05:	5e                   	pop    %esi
+  803f06:	5d                   	pop    %ebp
+  803f07:	c3                   	ret
+  803f08:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803f0a:	83 ec 08             	sub    $0x8,%esp
+  803f0d:	50                   	push   %eax
+  803f0e:	68 bc 4e 80 00       	push   $0x804ebc
+  803f13:	e8 ea c2 ff ff       	call   800202 <cprintf>
+		return r;
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	eb e2                	jmp    803eff <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803f1d:	83 ec 08             	sub    $0x8,%esp
+  803f20:	50                   	push   %eax
+  803f21:	68 d8 4e 80 00       	push   $0x804ed8
+  803f26:	e8 d7 c2 ff ff       	call   800202 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803f2b:	83 c4 08             	add    $0x8,%esp
+  803f2e:	68 00 f0 7f 00       	push   $0x7ff000
+  803f33:	6a 00                	push   $0x0
+  803f35:	e8 83 cd ff ff       	call   800cbd <sys_page_unmap>
+		return r;
+  803f3a:	83 c4 10             	add    $0x10,%esp
+  803f3d:	eb c0                	jmp    803eff <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803f3f:	83 ec 08             	sub    $0x8,%esp
+  803f42:	50                   	push   %eax
+  803f43:	68 f4 4d 80 00       	push   $0x804df4
+  803f48:	e8 b5 c2 ff ff       	call   800202 <cprintf>
+		return r;
+  803f4d:	83 c4 10             	add    $0x10,%esp
+  803f50:	eb ad                	jmp    803eff <cow_copy+0x6e>
+
+00803f52 <pgfault>:
+{
+  803f52:	55                   	push   %ebp
+  803f53:	89 e5                	mov    %esp,%ebp
+  803f55:	56                   	push   %esi
+  803f56:	53                   	push   %ebx
+  803f57:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803f5a:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803f5c:	89 d8                	mov    %ebx,%eax
+  803f5e:	c1 e8 16             	shr    $0x16,%eax
+  803f61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803f68:	89 de                	mov    %ebx,%esi
+  803f6a:	c1 ee 0c             	shr    $0xc,%esi
+  803f6d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803f74:	a8 07                	test   $0x7,%al
+  803f76:	74 3b                	je     803fb3 <pgfault+0x61>
+  803f78:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803f7e:	74 33                	je     803fb3 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803f80:	83 ec 0c             	sub    $0xc,%esp
+  803f83:	68 00 f0 bf ee       	push   $0xeebff000
+  803f88:	e8 82 f4 ff ff       	call   80340f <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803f8d:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803f94:	83 c4 10             	add    $0x10,%esp
+  803f97:	f6 c4 08             	test   $0x8,%ah
+  803f9a:	75 30                	jne    803fcc <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803f9c:	83 ec 0c             	sub    $0xc,%esp
+  803f9f:	68 00 f0 bf ee       	push   $0xeebff000
+  803fa4:	e8 d3 f4 ff ff       	call   80347c <mutex_unlock>
+}
+  803fa9:	83 c4 10             	add    $0x10,%esp
+  803fac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803faf:	5b                   	pop    %ebx
+  803fb0:	5e                   	pop    %esi
+  803fb1:	5d                   	pop    %ebp
+  803fb2:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803fb3:	83 ec 08             	sub    $0x8,%esp
+  803fb6:	ff 72 28             	push   0x28(%edx)
+  803fb9:	51                   	push   %ecx
+  803fba:	50                   	push   %eax
+  803fbb:	68 18 4e 80 00       	push   $0x804e18
+  803fc0:	6a 3f                	push   $0x3f
+  803fc2:	68 f2 4e 80 00       	push   $0x804ef2
+  803fc7:	e8 c3 fd ff ff       	call   803d8f <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803fcc:	89 d8                	mov    %ebx,%eax
+  803fce:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803fd3:	e8 b9 fe ff ff       	call   803e91 <cow_copy>
+  803fd8:	eb c2                	jmp    803f9c <pgfault+0x4a>
+
+00803fda <cow_enable>:
+{
+  803fda:	55                   	push   %ebp
+  803fdb:	89 e5                	mov    %esp,%ebp
+  803fdd:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803fe0:	68 52 3f 80 00       	push   $0x803f52
+  803fe5:	e8 9d 04 00 00       	call   804487 <set_pgfault_handler>
+}
+  803fea:	83 c4 10             	add    $0x10,%esp
+  803fed:	c9                   	leave
+  803fee:	c3                   	ret
+
+00803fef <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803fef:	55                   	push   %ebp
+  803ff0:	89 e5                	mov    %esp,%ebp
+  803ff2:	57                   	push   %edi
+  803ff3:	56                   	push   %esi
+  803ff4:	53                   	push   %ebx
+  803ff5:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ff8:	68 52 3f 80 00       	push   $0x803f52
+  803ffd:	e8 85 04 00 00       	call   804487 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804002:	b8 07 00 00 00       	mov    $0x7,%eax
+  804007:	cd 30                	int    $0x30
+  804009:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80400c:	83 c4 10             	add    $0x10,%esp
+  80400f:	85 c0                	test   %eax,%eax
+  804011:	78 4b                	js     80405e <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804013:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804018:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80401d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804020:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804024:	0f 85 16 01 00 00    	jne    804140 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80402a:	e8 9d cb ff ff       	call   800bcc <sys_getenvid>
+  80402f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804034:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804036:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80403c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804042:	77 32                	ja     804076 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804044:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804049:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80404b:	c1 ea 10             	shr    $0x10,%edx
+  80404e:	74 26                	je     804076 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804050:	c1 e2 10             	shl    $0x10,%edx
+  804053:	89 d1                	mov    %edx,%ecx
+  804055:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80405a:	29 ca                	sub    %ecx,%edx
+  80405c:	eb 1e                	jmp    80407c <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80405e:	83 ec 08             	sub    $0x8,%esp
+  804061:	89 c7                	mov    %eax,%edi
+  804063:	50                   	push   %eax
+  804064:	68 fd 4e 80 00       	push   $0x804efd
+  804069:	e8 94 c1 ff ff       	call   800202 <cprintf>
+		return eid;
+  80406e:	83 c4 10             	add    $0x10,%esp
+  804071:	e9 6c 01 00 00       	jmp    8041e2 <fork+0x1f3>
+		return pthread_main_tls;
+  804076:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80407c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80407f:	c1 e0 04             	shl    $0x4,%eax
+  804082:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804087:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804089:	e8 ca fa ff ff       	call   803b58 <pthread_fork_child>
+		return eid;
+  80408e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804091:	e9 4c 01 00 00       	jmp    8041e2 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804096:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80409c:	89 da                	mov    %ebx,%edx
+  80409e:	89 f8                	mov    %edi,%eax
+  8040a0:	e8 af fd ff ff       	call   803e54 <duppage>
+  8040a5:	85 c0                	test   %eax,%eax
+  8040a7:	79 28                	jns    8040d1 <fork+0xe2>
+  8040a9:	89 c7                	mov    %eax,%edi
+  8040ab:	e9 32 01 00 00       	jmp    8041e2 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8040b0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040b6:	83 f9 05             	cmp    $0x5,%ecx
+  8040b9:	75 58                	jne    804113 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040bb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8040c0:	89 da                	mov    %ebx,%edx
+  8040c2:	89 f8                	mov    %edi,%eax
+  8040c4:	e8 8b fd ff ff       	call   803e54 <duppage>
+  8040c9:	85 c0                	test   %eax,%eax
+  8040cb:	0f 88 0f 01 00 00    	js     8041e0 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040d1:	83 c3 01             	add    $0x1,%ebx
+  8040d4:	39 de                	cmp    %ebx,%esi
+  8040d6:	74 54                	je     80412c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8040d8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8040df:	f6 c1 05             	test   $0x5,%cl
+  8040e2:	74 ed                	je     8040d1 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8040e4:	f6 c5 04             	test   $0x4,%ch
+  8040e7:	75 ad                	jne    804096 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8040e9:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8040ef:	74 bf                	je     8040b0 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040f1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040f7:	74 d8                	je     8040d1 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8040f9:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8040ff:	89 da                	mov    %ebx,%edx
+  804101:	89 f8                	mov    %edi,%eax
+  804103:	e8 cd fc ff ff       	call   803dd5 <duppage_cow>
+  804108:	85 c0                	test   %eax,%eax
+  80410a:	79 c5                	jns    8040d1 <fork+0xe2>
+  80410c:	89 c7                	mov    %eax,%edi
+  80410e:	e9 cf 00 00 00       	jmp    8041e2 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804113:	68 48 4e 80 00       	push   $0x804e48
+  804118:	68 31 4c 80 00       	push   $0x804c31
+  80411d:	68 c6 00 00 00       	push   $0xc6
+  804122:	68 f2 4e 80 00       	push   $0x804ef2
+  804127:	e8 63 fc ff ff       	call   803d8f <_panic>
+  80412c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80412f:	83 c1 01             	add    $0x1,%ecx
+  804132:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804138:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80413e:	74 18                	je     804158 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804140:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804147:	a8 07                	test   $0x7,%al
+  804149:	74 e4                	je     80412f <fork+0x140>
+  80414b:	89 cb                	mov    %ecx,%ebx
+  80414d:	c1 e3 0a             	shl    $0xa,%ebx
+  804150:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804153:	e9 7c ff ff ff       	jmp    8040d4 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804158:	83 ec 04             	sub    $0x4,%esp
+  80415b:	6a 07                	push   $0x7
+  80415d:	68 00 f0 bf ee       	push   $0xeebff000
+  804162:	ff 75 e4             	push   -0x1c(%ebp)
+  804165:	e8 ba ca ff ff       	call   800c24 <sys_page_alloc>
+  80416a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80416c:	83 c4 10             	add    $0x10,%esp
+  80416f:	85 c0                	test   %eax,%eax
+  804171:	78 34                	js     8041a7 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804173:	83 ec 08             	sub    $0x8,%esp
+  804176:	68 c5 44 80 00       	push   $0x8044c5
+  80417b:	ff 75 e4             	push   -0x1c(%ebp)
+  80417e:	e8 1e cc ff ff       	call   800da1 <sys_env_set_pgfault_upcall>
+  804183:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804185:	83 c4 10             	add    $0x10,%esp
+  804188:	85 c0                	test   %eax,%eax
+  80418a:	78 2e                	js     8041ba <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80418c:	83 ec 08             	sub    $0x8,%esp
+  80418f:	6a 02                	push   $0x2
+  804191:	ff 75 e4             	push   -0x1c(%ebp)
+  804194:	e8 70 cb ff ff       	call   800d09 <sys_env_set_status>
+  804199:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80419b:	83 c4 10             	add    $0x10,%esp
+  80419e:	85 c0                	test   %eax,%eax
+  8041a0:	78 2b                	js     8041cd <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8041a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8041a5:	eb 3b                	jmp    8041e2 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041a7:	83 ec 08             	sub    $0x8,%esp
+  8041aa:	50                   	push   %eax
+  8041ab:	68 70 4e 80 00       	push   $0x804e70
+  8041b0:	e8 4d c0 ff ff       	call   800202 <cprintf>
+		return r;
+  8041b5:	83 c4 10             	add    $0x10,%esp
+  8041b8:	eb 28                	jmp    8041e2 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041ba:	83 ec 08             	sub    $0x8,%esp
+  8041bd:	50                   	push   %eax
+  8041be:	68 98 4e 80 00       	push   $0x804e98
+  8041c3:	e8 3a c0 ff ff       	call   800202 <cprintf>
+		return r;
+  8041c8:	83 c4 10             	add    $0x10,%esp
+  8041cb:	eb 15                	jmp    8041e2 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8041cd:	83 ec 08             	sub    $0x8,%esp
+  8041d0:	50                   	push   %eax
+  8041d1:	68 0d 4f 80 00       	push   $0x804f0d
+  8041d6:	e8 27 c0 ff ff       	call   800202 <cprintf>
+		return r;
+  8041db:	83 c4 10             	add    $0x10,%esp
+  8041de:	eb 02                	jmp    8041e2 <fork+0x1f3>
+  8041e0:	89 c7                	mov    %eax,%edi
+}
+  8041e2:	89 f8                	mov    %edi,%eax
+  8041e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e7:	5b                   	pop    %ebx
+  8041e8:	5e                   	pop    %esi
+  8041e9:	5f                   	pop    %edi
+  8041ea:	5d                   	pop    %ebp
+  8041eb:	c3                   	ret
+
+008041ec <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8041ec:	55                   	push   %ebp
+  8041ed:	89 e5                	mov    %esp,%ebp
+  8041ef:	57                   	push   %edi
+  8041f0:	56                   	push   %esi
+  8041f1:	53                   	push   %ebx
+  8041f2:	83 ec 2c             	sub    $0x2c,%esp
+  8041f5:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041f7:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8041fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804202:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804208:	77 0a                	ja     804214 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80420a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80420f:	29 c3                	sub    %eax,%ebx
+  804211:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804214:	83 ec 0c             	sub    $0xc,%esp
+  804217:	68 52 3f 80 00       	push   $0x803f52
+  80421c:	e8 66 02 00 00       	call   804487 <set_pgfault_handler>
+  804221:	b8 07 00 00 00       	mov    $0x7,%eax
+  804226:	cd 30                	int    $0x30
+  804228:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80422b:	83 c4 10             	add    $0x10,%esp
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	78 30                	js     804262 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804232:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804236:	74 42                	je     80427a <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804238:	c1 e3 10             	shl    $0x10,%ebx
+  80423b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804240:	29 d8                	sub    %ebx,%eax
+  804242:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804245:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80424a:	29 d8                	sub    %ebx,%eax
+  80424c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80424f:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804254:	ba 00 00 00 00       	mov    $0x0,%edx
+  804259:	89 f7                	mov    %esi,%edi
+  80425b:	89 d6                	mov    %edx,%esi
+  80425d:	e9 2c 01 00 00       	jmp    80438e <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804262:	83 ec 08             	sub    $0x8,%esp
+  804265:	89 c7                	mov    %eax,%edi
+  804267:	50                   	push   %eax
+  804268:	68 fd 4e 80 00       	push   $0x804efd
+  80426d:	e8 90 bf ff ff       	call   800202 <cprintf>
+		return eid;
+  804272:	83 c4 10             	add    $0x10,%esp
+  804275:	e9 d5 00 00 00       	jmp    80434f <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80427a:	e8 4d c9 ff ff       	call   800bcc <sys_getenvid>
+  80427f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804284:	89 c2                	mov    %eax,%edx
+  804286:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804288:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80428e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804293:	77 18                	ja     8042ad <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804295:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80429a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80429c:	c1 e8 10             	shr    $0x10,%eax
+  80429f:	74 0c                	je     8042ad <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042a1:	c1 e0 10             	shl    $0x10,%eax
+  8042a4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8042a9:	29 c1                	sub    %eax,%ecx
+  8042ab:	eb 06                	jmp    8042b3 <sfork+0xc7>
+		return pthread_main_tls;
+  8042ad:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8042b3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8042b6:	c1 e0 04             	shl    $0x4,%eax
+  8042b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042be:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8042c0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8042c3:	e9 87 00 00 00       	jmp    80434f <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8042c8:	f6 c5 04             	test   $0x4,%ch
+  8042cb:	74 6c                	je     804339 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8042cd:	89 ca                	mov    %ecx,%edx
+  8042cf:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8042d5:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8042db:	74 7c                	je     804359 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8042dd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8042e3:	89 da                	mov    %ebx,%edx
+  8042e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8042e8:	e8 67 fb ff ff       	call   803e54 <duppage>
+  8042ed:	85 c0                	test   %eax,%eax
+  8042ef:	0f 88 4f 01 00 00    	js     804444 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8042f5:	83 c3 01             	add    $0x1,%ebx
+  8042f8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8042fb:	74 7a                	je     804377 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8042fd:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8042ff:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804306:	f6 c1 01             	test   $0x1,%cl
+  804309:	74 ea                	je     8042f5 <sfork+0x109>
+  80430b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804311:	74 e2                	je     8042f5 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804313:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804319:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80431c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804321:	76 a5                	jbe    8042c8 <sfork+0xdc>
+  804323:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804329:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80432c:	39 fa                	cmp    %edi,%edx
+  80432e:	73 9d                	jae    8042cd <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804330:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804333:	39 fa                	cmp    %edi,%edx
+  804335:	72 96                	jb     8042cd <sfork+0xe1>
+  804337:	eb 8f                	jmp    8042c8 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804339:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80433f:	89 da                	mov    %ebx,%edx
+  804341:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804344:	e8 8c fa ff ff       	call   803dd5 <duppage_cow>
+  804349:	85 c0                	test   %eax,%eax
+  80434b:	79 a8                	jns    8042f5 <sfork+0x109>
+  80434d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80434f:	89 f8                	mov    %edi,%eax
+  804351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804354:	5b                   	pop    %ebx
+  804355:	5e                   	pop    %esi
+  804356:	5f                   	pop    %edi
+  804357:	5d                   	pop    %ebp
+  804358:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804359:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80435e:	e8 2e fb ff ff       	call   803e91 <cow_copy>
+  804363:	85 c0                	test   %eax,%eax
+  804365:	0f 88 d2 00 00 00    	js     80443d <sfork+0x251>
+				pte = uvpt[pn];
+  80436b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804372:	e9 66 ff ff ff       	jmp    8042dd <sfork+0xf1>
+  804377:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80437a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80437d:	83 c6 01             	add    $0x1,%esi
+  804380:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804386:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80438c:	74 1b                	je     8043a9 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80438e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804395:	a8 01                	test   $0x1,%al
+  804397:	74 e4                	je     80437d <sfork+0x191>
+  804399:	89 f3                	mov    %esi,%ebx
+  80439b:	c1 e3 0a             	shl    $0xa,%ebx
+  80439e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8043a1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8043a4:	e9 4f ff ff ff       	jmp    8042f8 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8043a9:	83 ec 04             	sub    $0x4,%esp
+  8043ac:	6a 07                	push   $0x7
+  8043ae:	68 00 f0 bf ee       	push   $0xeebff000
+  8043b3:	ff 75 e0             	push   -0x20(%ebp)
+  8043b6:	e8 69 c8 ff ff       	call   800c24 <sys_page_alloc>
+  8043bb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043bd:	83 c4 10             	add    $0x10,%esp
+  8043c0:	85 c0                	test   %eax,%eax
+  8043c2:	78 37                	js     8043fb <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8043c4:	83 ec 08             	sub    $0x8,%esp
+  8043c7:	68 c5 44 80 00       	push   $0x8044c5
+  8043cc:	ff 75 e0             	push   -0x20(%ebp)
+  8043cf:	e8 cd c9 ff ff       	call   800da1 <sys_env_set_pgfault_upcall>
+  8043d4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043d6:	83 c4 10             	add    $0x10,%esp
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	78 34                	js     804411 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8043dd:	83 ec 08             	sub    $0x8,%esp
+  8043e0:	6a 02                	push   $0x2
+  8043e2:	ff 75 e0             	push   -0x20(%ebp)
+  8043e5:	e8 1f c9 ff ff       	call   800d09 <sys_env_set_status>
+  8043ea:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8043ec:	83 c4 10             	add    $0x10,%esp
+  8043ef:	85 c0                	test   %eax,%eax
+  8043f1:	78 34                	js     804427 <sfork+0x23b>
+	return eid;
+  8043f3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8043f6:	e9 54 ff ff ff       	jmp    80434f <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8043fb:	83 ec 08             	sub    $0x8,%esp
+  8043fe:	50                   	push   %eax
+  8043ff:	68 70 4e 80 00       	push   $0x804e70
+  804404:	e8 f9 bd ff ff       	call   800202 <cprintf>
+		return r;
+  804409:	83 c4 10             	add    $0x10,%esp
+  80440c:	e9 3e ff ff ff       	jmp    80434f <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804411:	83 ec 08             	sub    $0x8,%esp
+  804414:	50                   	push   %eax
+  804415:	68 98 4e 80 00       	push   $0x804e98
+  80441a:	e8 e3 bd ff ff       	call   800202 <cprintf>
+		return r;
+  80441f:	83 c4 10             	add    $0x10,%esp
+  804422:	e9 28 ff ff ff       	jmp    80434f <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804427:	83 ec 08             	sub    $0x8,%esp
+  80442a:	50                   	push   %eax
+  80442b:	68 0d 4f 80 00       	push   $0x804f0d
+  804430:	e8 cd bd ff ff       	call   800202 <cprintf>
+		return r;
+  804435:	83 c4 10             	add    $0x10,%esp
+  804438:	e9 12 ff ff ff       	jmp    80434f <sfork+0x163>
+  80443d:	89 c7                	mov    %eax,%edi
+  80443f:	e9 0b ff ff ff       	jmp    80434f <sfork+0x163>
+  804444:	89 c7                	mov    %eax,%edi
+  804446:	e9 04 ff ff ff       	jmp    80434f <sfork+0x163>
+
+0080444b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80444b:	55                   	push   %ebp
+  80444c:	89 e5                	mov    %esp,%ebp
+  80444e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804451:	89 c2                	mov    %eax,%edx
+  804453:	c1 ea 16             	shr    $0x16,%edx
+  804456:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80445d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804462:	f6 c1 01             	test   $0x1,%cl
+  804465:	74 1c                	je     804483 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804467:	c1 e8 0c             	shr    $0xc,%eax
+  80446a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804471:	a8 01                	test   $0x1,%al
+  804473:	74 0e                	je     804483 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804475:	c1 e8 0c             	shr    $0xc,%eax
+  804478:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80447f:	ef 
+  804480:	0f b7 d2             	movzwl %dx,%edx
+}
+  804483:	89 d0                	mov    %edx,%eax
+  804485:	5d                   	pop    %ebp
+  804486:	c3                   	ret
+
+00804487 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804487:	55                   	push   %ebp
+  804488:	89 e5                	mov    %esp,%ebp
+  80448a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80448d:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804494:	74 0a                	je     8044a0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804496:	8b 45 08             	mov    0x8(%ebp),%eax
+  804499:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80449e:	c9                   	leave
+  80449f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044a0:	83 ec 04             	sub    $0x4,%esp
+  8044a3:	6a 07                	push   $0x7
+  8044a5:	68 00 f0 bf ee       	push   $0xeebff000
+  8044aa:	6a 00                	push   $0x0
+  8044ac:	e8 73 c7 ff ff       	call   800c24 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044b1:	83 c4 08             	add    $0x8,%esp
+  8044b4:	68 c5 44 80 00       	push   $0x8044c5
+  8044b9:	6a 00                	push   $0x0
+  8044bb:	e8 e1 c8 ff ff       	call   800da1 <sys_env_set_pgfault_upcall>
+  8044c0:	83 c4 10             	add    $0x10,%esp
+  8044c3:	eb d1                	jmp    804496 <set_pgfault_handler+0xf>
+
+008044c5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044c5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044c6:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8044cb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044cd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044d0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8044d4:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8044d8:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8044db:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044df:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044e1:	83 c4 08             	add    $0x8,%esp
+	popal
+  8044e4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8044e5:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8044e8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8044e9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8044ea:	c3                   	ret
+
+008044eb <udm>:
+  8044eb:	57                   	push   %edi
+  8044ec:	56                   	push   %esi
+  8044ed:	53                   	push   %ebx
+  8044ee:	83 ec 20             	sub    $0x20,%esp
+  8044f1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044f5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044f9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044fd:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804501:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804505:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804509:	89 d1                	mov    %edx,%ecx
+  80450b:	09 c1                	or     %eax,%ecx
+  80450d:	0f 84 91 00 00 00    	je     8045a4 <udm+0xb9>
+  804513:	b8 00 00 00 00       	mov    $0x0,%eax
+  804518:	ba 00 00 00 00       	mov    $0x0,%edx
+  80451d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804522:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804529:	00 
+  80452a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804531:	00 
+  804532:	eb 08                	jmp    80453c <udm+0x51>
+  804534:	83 e9 01             	sub    $0x1,%ecx
+  804537:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80453a:	74 7c                	je     8045b8 <udm+0xcd>
+  80453c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804540:	01 c0                	add    %eax,%eax
+  804542:	89 c6                	mov    %eax,%esi
+  804544:	89 d7                	mov    %edx,%edi
+  804546:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80454a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80454e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804551:	d3 ea                	shr    %cl,%edx
+  804553:	f6 c1 20             	test   $0x20,%cl
+  804556:	74 04                	je     80455c <udm+0x71>
+  804558:	89 d0                	mov    %edx,%eax
+  80455a:	31 d2                	xor    %edx,%edx
+  80455c:	83 e0 01             	and    $0x1,%eax
+  80455f:	89 04 24             	mov    %eax,(%esp)
+  804562:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804569:	00 
+  80456a:	8b 04 24             	mov    (%esp),%eax
+  80456d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804571:	09 f0                	or     %esi,%eax
+  804573:	09 fa                	or     %edi,%edx
+  804575:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804579:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80457d:	39 f0                	cmp    %esi,%eax
+  80457f:	89 d3                	mov    %edx,%ebx
+  804581:	19 fb                	sbb    %edi,%ebx
+  804583:	72 af                	jb     804534 <udm+0x49>
+  804585:	29 f0                	sub    %esi,%eax
+  804587:	19 fa                	sbb    %edi,%edx
+  804589:	89 cf                	mov    %ecx,%edi
+  80458b:	c1 ef 05             	shr    $0x5,%edi
+  80458e:	83 e7 01             	and    $0x1,%edi
+  804591:	89 fe                	mov    %edi,%esi
+  804593:	83 f6 01             	xor    $0x1,%esi
+  804596:	d3 e6                	shl    %cl,%esi
+  804598:	d3 e7                	shl    %cl,%edi
+  80459a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80459e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045a2:	eb 90                	jmp    804534 <udm+0x49>
+  8045a4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045a8:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045ac:	89 f0                	mov    %esi,%eax
+  8045ae:	89 fa                	mov    %edi,%edx
+  8045b0:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045b4:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045b8:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045bc:	89 01                	mov    %eax,(%ecx)
+  8045be:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045c9:	83 c4 20             	add    $0x20,%esp
+  8045cc:	5b                   	pop    %ebx
+  8045cd:	5e                   	pop    %esi
+  8045ce:	5f                   	pop    %edi
+  8045cf:	c3                   	ret
+
+008045d0 <__udivdi3>:
+  8045d0:	83 ec 18             	sub    $0x18,%esp
+  8045d3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045d7:	50                   	push   %eax
+  8045d8:	ff 74 24 2c          	push   0x2c(%esp)
+  8045dc:	ff 74 24 2c          	push   0x2c(%esp)
+  8045e0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045e4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045e8:	e8 fe fe ff ff       	call   8044eb <udm>
+  8045ed:	83 c4 24             	add    $0x24,%esp
+  8045f0:	c3                   	ret
+
+008045f1 <__umoddi3>:
+  8045f1:	83 ec 18             	sub    $0x18,%esp
+  8045f4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045f8:	50                   	push   %eax
+  8045f9:	ff 74 24 2c          	push   0x2c(%esp)
+  8045fd:	ff 74 24 2c          	push   0x2c(%esp)
+  804601:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804605:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804609:	e8 dd fe ff ff       	call   8044eb <udm>
+  80460e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804612:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804616:	83 c4 24             	add    $0x24,%esp
+  804619:	c3                   	ret
+
+0080461a <__divdi3>:
+  80461a:	56                   	push   %esi
+  80461b:	53                   	push   %ebx
+  80461c:	83 ec 14             	sub    $0x14,%esp
+  80461f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804623:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804627:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80462b:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80462f:	85 d2                	test   %edx,%edx
+  804631:	78 18                	js     80464b <__divdi3+0x31>
+  804633:	85 db                	test   %ebx,%ebx
+  804635:	78 3e                	js     804675 <__divdi3+0x5b>
+  804637:	83 ec 04             	sub    $0x4,%esp
+  80463a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80463e:	56                   	push   %esi
+  80463f:	53                   	push   %ebx
+  804640:	51                   	push   %ecx
+  804641:	e8 a5 fe ff ff       	call   8044eb <udm>
+  804646:	83 c4 10             	add    $0x10,%esp
+  804649:	eb 24                	jmp    80466f <__divdi3+0x55>
+  80464b:	f7 d8                	neg    %eax
+  80464d:	83 d2 00             	adc    $0x0,%edx
+  804650:	f7 da                	neg    %edx
+  804652:	85 db                	test   %ebx,%ebx
+  804654:	78 3a                	js     804690 <__divdi3+0x76>
+  804656:	83 ec 04             	sub    $0x4,%esp
+  804659:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80465d:	56                   	push   %esi
+  80465e:	53                   	push   %ebx
+  80465f:	51                   	push   %ecx
+  804660:	e8 86 fe ff ff       	call   8044eb <udm>
+  804665:	83 c4 10             	add    $0x10,%esp
+  804668:	f7 d8                	neg    %eax
+  80466a:	83 d2 00             	adc    $0x0,%edx
+  80466d:	f7 da                	neg    %edx
+  80466f:	83 c4 14             	add    $0x14,%esp
+  804672:	5b                   	pop    %ebx
+  804673:	5e                   	pop    %esi
+  804674:	c3                   	ret
+  804675:	83 ec 04             	sub    $0x4,%esp
+  804678:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80467c:	56                   	push   %esi
+  80467d:	f7 d9                	neg    %ecx
+  80467f:	83 d3 00             	adc    $0x0,%ebx
+  804682:	f7 db                	neg    %ebx
+  804684:	53                   	push   %ebx
+  804685:	51                   	push   %ecx
+  804686:	e8 60 fe ff ff       	call   8044eb <udm>
+  80468b:	83 c4 10             	add    $0x10,%esp
+  80468e:	eb d8                	jmp    804668 <__divdi3+0x4e>
+  804690:	83 ec 04             	sub    $0x4,%esp
+  804693:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804697:	56                   	push   %esi
+  804698:	f7 d9                	neg    %ecx
+  80469a:	83 d3 00             	adc    $0x0,%ebx
+  80469d:	f7 db                	neg    %ebx
+  80469f:	53                   	push   %ebx
+  8046a0:	51                   	push   %ecx
+  8046a1:	e8 45 fe ff ff       	call   8044eb <udm>
+  8046a6:	83 c4 10             	add    $0x10,%esp
+  8046a9:	eb c4                	jmp    80466f <__divdi3+0x55>
+
+008046ab <__moddi3>:
+  8046ab:	55                   	push   %ebp
+  8046ac:	57                   	push   %edi
+  8046ad:	56                   	push   %esi
+  8046ae:	53                   	push   %ebx
+  8046af:	83 ec 24             	sub    $0x24,%esp
+  8046b2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046b6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046ba:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046be:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046c2:	85 d2                	test   %edx,%edx
+  8046c4:	78 3b                	js     804701 <__moddi3+0x56>
+  8046c6:	83 ec 04             	sub    $0x4,%esp
+  8046c9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046cd:	56                   	push   %esi
+  8046ce:	89 ce                	mov    %ecx,%esi
+  8046d0:	f7 de                	neg    %esi
+  8046d2:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046d6:	89 de                	mov    %ebx,%esi
+  8046d8:	83 d6 00             	adc    $0x0,%esi
+  8046db:	f7 de                	neg    %esi
+  8046dd:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046e1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046e5:	0f 48 f1             	cmovs  %ecx,%esi
+  8046e8:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046ed:	53                   	push   %ebx
+  8046ee:	56                   	push   %esi
+  8046ef:	e8 f7 fd ff ff       	call   8044eb <udm>
+  8046f4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046f8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046fc:	83 c4 10             	add    $0x10,%esp
+  8046ff:	eb 47                	jmp    804748 <__moddi3+0x9d>
+  804701:	f7 d8                	neg    %eax
+  804703:	83 d2 00             	adc    $0x0,%edx
+  804706:	f7 da                	neg    %edx
+  804708:	83 ec 04             	sub    $0x4,%esp
+  80470b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80470f:	56                   	push   %esi
+  804710:	89 cf                	mov    %ecx,%edi
+  804712:	f7 df                	neg    %edi
+  804714:	89 de                	mov    %ebx,%esi
+  804716:	83 d6 00             	adc    $0x0,%esi
+  804719:	f7 de                	neg    %esi
+  80471b:	0f 49 cf             	cmovns %edi,%ecx
+  80471e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804722:	0f 49 de             	cmovns %esi,%ebx
+  804725:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804729:	ff 74 24 0c          	push   0xc(%esp)
+  80472d:	ff 74 24 0c          	push   0xc(%esp)
+  804731:	e8 b5 fd ff ff       	call   8044eb <udm>
+  804736:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80473a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80473e:	f7 d8                	neg    %eax
+  804740:	83 d2 00             	adc    $0x0,%edx
+  804743:	f7 da                	neg    %edx
+  804745:	83 c4 10             	add    $0x10,%esp
+  804748:	83 c4 24             	add    $0x24,%esp
+  80474b:	5b                   	pop    %ebx
+  80474c:	5e                   	pop    %esi
+  80474d:	5f                   	pop    %edi
+  80474e:	5d                   	pop    %ebp
+  80474f:	c3                   	ret
@@ -0,0 +1,9747 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 60 47 80 00       	push   $0x804760
+  800045:	e8 fe 01 00 00       	call   800248 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 0c 0c 00 00       	call   800c6a <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 ac 47 80 00       	push   $0x8047ac
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 64 07 00 00       	call   8007d7 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 80 47 80 00       	push   $0x804780
+  800085:	6a 0e                	push   $0xe
+  800087:	68 6a 47 80 00       	push   $0x80476a
+  80008c:	e8 dc 00 00 00       	call   80016d <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 6b 10 00 00       	call   80110c <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 7c 47 80 00       	push   $0x80477c
+  8000ae:	e8 95 01 00 00       	call   800248 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 7c 47 80 00       	push   $0x80477c
+  8000c0:	e8 83 01 00 00       	call   800248 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	57                   	push   %edi
+  8000ce:	56                   	push   %esi
+  8000cf:	53                   	push   %ebx
+  8000d0:	83 ec 1c             	sub    $0x1c,%esp
+  8000d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000d9:	e8 34 0b 00 00       	call   800c12 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000de:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000e1:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ec:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000ee:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000f0:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000fb:	77 16                	ja     800113 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800102:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800104:	c1 e8 10             	shr    $0x10,%eax
+  800107:	74 0a                	je     800113 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800109:	c1 e0 10             	shl    $0x10,%eax
+  80010c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800111:	29 c2                	sub    %eax,%edx
+  800113:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800116:	c1 e0 04             	shl    $0x4,%eax
+  800119:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800120:	85 db                	test   %ebx,%ebx
+  800122:	7e 07                	jle    80012b <libmain+0x61>
+		binaryname = argv[0];
+  800124:	8b 06                	mov    (%esi),%eax
+  800126:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80012b:	83 ec 08             	sub    $0x8,%esp
+  80012e:	56                   	push   %esi
+  80012f:	53                   	push   %ebx
+  800130:	e8 5c ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800135:	e8 0b 00 00 00       	call   800145 <exit>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5f                   	pop    %edi
+  800143:	5d                   	pop    %ebp
+  800144:	c3                   	ret
+
+00800145 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 79 21 00 00       	call   8022cb <fflush>
+	pthread_kill_others();
+  800152:	e8 e4 37 00 00       	call   80393b <pthread_kill_others>
+	close_all();
+  800157:	e8 12 12 00 00       	call   80136e <close_all>
+	sys_env_destroy(0);
+  80015c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800163:	e8 5f 0a 00 00       	call   800bc7 <sys_env_destroy>
+}
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	c9                   	leave
+  80016c:	c3                   	ret
+
+0080016d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	56                   	push   %esi
+  800171:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800172:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800175:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80017b:	e8 92 0a 00 00       	call   800c12 <sys_getenvid>
+  800180:	83 ec 0c             	sub    $0xc,%esp
+  800183:	ff 75 0c             	push   0xc(%ebp)
+  800186:	ff 75 08             	push   0x8(%ebp)
+  800189:	56                   	push   %esi
+  80018a:	50                   	push   %eax
+  80018b:	68 d8 47 80 00       	push   $0x8047d8
+  800190:	e8 b3 00 00 00       	call   800248 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800195:	83 c4 18             	add    $0x18,%esp
+  800198:	53                   	push   %ebx
+  800199:	ff 75 10             	push   0x10(%ebp)
+  80019c:	e8 56 00 00 00       	call   8001f7 <vcprintf>
+	cprintf("\n");
+  8001a1:	c7 04 24 be 4e 80 00 	movl   $0x804ebe,(%esp)
+  8001a8:	e8 9b 00 00 00       	call   800248 <cprintf>
+  8001ad:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001b0:	cc                   	int3
+	while (1)
+  8001b1:	eb fd                	jmp    8001b0 <_panic+0x43>
+
+008001b3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	53                   	push   %ebx
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001bd:	8b 13                	mov    (%ebx),%edx
+  8001bf:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c2:	89 03                	mov    %eax,(%ebx)
+  8001c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d0:	74 09                	je     8001db <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001db:	83 ec 08             	sub    $0x8,%esp
+  8001de:	68 ff 00 00 00       	push   $0xff
+  8001e3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	e8 84 09 00 00       	call   800b70 <sys_cputs>
+		b->idx = 0;
+  8001ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	eb db                	jmp    8001d2 <putch+0x1f>
+
+008001f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800200:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800207:	00 00 00 
+	b.cnt = 0;
+  80020a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800211:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	ff 75 08             	push   0x8(%ebp)
+  80021a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800220:	50                   	push   %eax
+  800221:	68 b3 01 80 00       	push   $0x8001b3
+  800226:	e8 14 01 00 00       	call   80033f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80022b:	83 c4 08             	add    $0x8,%esp
+  80022e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800234:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 30 09 00 00       	call   800b70 <sys_cputs>
+
+	return b.cnt;
+}
+  800240:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+00800248 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80024e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800251:	50                   	push   %eax
+  800252:	ff 75 08             	push   0x8(%ebp)
+  800255:	e8 9d ff ff ff       	call   8001f7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80025a:	c9                   	leave
+  80025b:	c3                   	ret
+
+0080025c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	57                   	push   %edi
+  800260:	56                   	push   %esi
+  800261:	53                   	push   %ebx
+  800262:	83 ec 1c             	sub    $0x1c,%esp
+  800265:	89 c7                	mov    %eax,%edi
+  800267:	89 d6                	mov    %edx,%esi
+  800269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80026f:	89 d1                	mov    %edx,%ecx
+  800271:	89 c2                	mov    %eax,%edx
+  800273:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800276:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800279:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80027f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800282:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800289:	39 c2                	cmp    %eax,%edx
+  80028b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80028e:	72 3e                	jb     8002ce <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800290:	83 ec 0c             	sub    $0xc,%esp
+  800293:	ff 75 18             	push   0x18(%ebp)
+  800296:	83 eb 01             	sub    $0x1,%ebx
+  800299:	53                   	push   %ebx
+  80029a:	50                   	push   %eax
+  80029b:	83 ec 08             	sub    $0x8,%esp
+  80029e:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a1:	ff 75 e0             	push   -0x20(%ebp)
+  8002a4:	ff 75 dc             	push   -0x24(%ebp)
+  8002a7:	ff 75 d8             	push   -0x28(%ebp)
+  8002aa:	e8 21 43 00 00       	call   8045d0 <__udivdi3>
+  8002af:	83 c4 18             	add    $0x18,%esp
+  8002b2:	52                   	push   %edx
+  8002b3:	50                   	push   %eax
+  8002b4:	89 f2                	mov    %esi,%edx
+  8002b6:	89 f8                	mov    %edi,%eax
+  8002b8:	e8 9f ff ff ff       	call   80025c <printnum>
+  8002bd:	83 c4 20             	add    $0x20,%esp
+  8002c0:	eb 13                	jmp    8002d5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  8002c5:	56                   	push   %esi
+  8002c6:	ff 75 18             	push   0x18(%ebp)
+  8002c9:	ff d7                	call   *%edi
+  8002cb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ce:	83 eb 01             	sub    $0x1,%ebx
+  8002d1:	85 db                	test   %ebx,%ebx
+  8002d3:	7f ed                	jg     8002c2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+  8002d8:	56                   	push   %esi
+  8002d9:	83 ec 04             	sub    $0x4,%esp
+  8002dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8002df:	ff 75 e0             	push   -0x20(%ebp)
+  8002e2:	ff 75 dc             	push   -0x24(%ebp)
+  8002e5:	ff 75 d8             	push   -0x28(%ebp)
+  8002e8:	e8 04 43 00 00       	call   8045f1 <__umoddi3>
+  8002ed:	83 c4 14             	add    $0x14,%esp
+  8002f0:	0f be 80 fb 47 80 00 	movsbl 0x8047fb(%eax),%eax
+  8002f7:	50                   	push   %eax
+  8002f8:	ff d7                	call   *%edi
+}
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800300:	5b                   	pop    %ebx
+  800301:	5e                   	pop    %esi
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+
+00800305 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80030b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80030f:	8b 10                	mov    (%eax),%edx
+  800311:	3b 50 04             	cmp    0x4(%eax),%edx
+  800314:	73 0a                	jae    800320 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800316:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800319:	89 08                	mov    %ecx,(%eax)
+  80031b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031e:	88 02                	mov    %al,(%edx)
+}
+  800320:	5d                   	pop    %ebp
+  800321:	c3                   	ret
+
+00800322 <printfmt>:
+{
+  800322:	55                   	push   %ebp
+  800323:	89 e5                	mov    %esp,%ebp
+  800325:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800328:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80032b:	50                   	push   %eax
+  80032c:	ff 75 10             	push   0x10(%ebp)
+  80032f:	ff 75 0c             	push   0xc(%ebp)
+  800332:	ff 75 08             	push   0x8(%ebp)
+  800335:	e8 05 00 00 00       	call   80033f <vprintfmt>
+}
+  80033a:	83 c4 10             	add    $0x10,%esp
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+
+0080033f <vprintfmt>:
+{
+  80033f:	55                   	push   %ebp
+  800340:	89 e5                	mov    %esp,%ebp
+  800342:	57                   	push   %edi
+  800343:	56                   	push   %esi
+  800344:	53                   	push   %ebx
+  800345:	83 ec 2c             	sub    $0x2c,%esp
+  800348:	8b 75 08             	mov    0x8(%ebp),%esi
+  80034b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80034e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800351:	eb 0a                	jmp    80035d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800353:	83 ec 08             	sub    $0x8,%esp
+  800356:	53                   	push   %ebx
+  800357:	50                   	push   %eax
+  800358:	ff d6                	call   *%esi
+  80035a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80035d:	83 c7 01             	add    $0x1,%edi
+  800360:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800364:	83 f8 25             	cmp    $0x25,%eax
+  800367:	74 0c                	je     800375 <vprintfmt+0x36>
+			if (ch == '\0')
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	75 e6                	jne    800353 <vprintfmt+0x14>
+}
+  80036d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800370:	5b                   	pop    %ebx
+  800371:	5e                   	pop    %esi
+  800372:	5f                   	pop    %edi
+  800373:	5d                   	pop    %ebp
+  800374:	c3                   	ret
+		padc = ' ';
+  800375:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800379:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800380:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800387:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80038e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800393:	8d 47 01             	lea    0x1(%edi),%eax
+  800396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800399:	0f b6 17             	movzbl (%edi),%edx
+  80039c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80039f:	3c 55                	cmp    $0x55,%al
+  8003a1:	0f 87 c5 03 00 00    	ja     80076c <vprintfmt+0x42d>
+  8003a7:	0f b6 c0             	movzbl %al,%eax
+  8003aa:	ff 24 85 80 49 80 00 	jmp    *0x804980(,%eax,4)
+  8003b1:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b7:	eb da                	jmp    800393 <vprintfmt+0x54>
+  8003b9:	0f be d2             	movsbl %dl,%edx
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003c7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003ca:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ce:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003d1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003d4:	83 f9 09             	cmp    $0x9,%ecx
+  8003d7:	77 55                	ja     80042e <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003d9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003dc:	eb e9                	jmp    8003c7 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8b 00                	mov    (%eax),%eax
+  8003e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ec:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f6:	79 9b                	jns    800393 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003f8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003fe:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800405:	eb 8c                	jmp    800393 <vprintfmt+0x54>
+			if (width < 0)
+  800407:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80040a:	85 d2                	test   %edx,%edx
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	0f 49 c2             	cmovns %edx,%eax
+  800414:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800417:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80041a:	e9 74 ff ff ff       	jmp    800393 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800422:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800429:	e9 65 ff ff ff       	jmp    800393 <vprintfmt+0x54>
+  80042e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800431:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800434:	eb bc                	jmp    8003f2 <vprintfmt+0xb3>
+			lflag++;
+  800436:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800439:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80043c:	e9 52 ff ff ff       	jmp    800393 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8d 78 04             	lea    0x4(%eax),%edi
+  800447:	83 ec 08             	sub    $0x8,%esp
+  80044a:	53                   	push   %ebx
+  80044b:	ff 30                	push   (%eax)
+  80044d:	ff d6                	call   *%esi
+			break;
+  80044f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800452:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800455:	e9 b1 02 00 00       	jmp    80070b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80045a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800460:	8b 10                	mov    (%eax),%edx
+  800462:	89 d0                	mov    %edx,%eax
+  800464:	f7 d8                	neg    %eax
+  800466:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800469:	83 f8 14             	cmp    $0x14,%eax
+  80046c:	7f 23                	jg     800491 <vprintfmt+0x152>
+  80046e:	8b 14 85 e0 4a 80 00 	mov    0x804ae0(,%eax,4),%edx
+  800475:	85 d2                	test   %edx,%edx
+  800477:	74 18                	je     800491 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800479:	52                   	push   %edx
+  80047a:	68 4f 4c 80 00       	push   $0x804c4f
+  80047f:	53                   	push   %ebx
+  800480:	56                   	push   %esi
+  800481:	e8 9c fe ff ff       	call   800322 <printfmt>
+  800486:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800489:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80048c:	e9 7a 02 00 00       	jmp    80070b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800491:	50                   	push   %eax
+  800492:	68 13 48 80 00       	push   $0x804813
+  800497:	53                   	push   %ebx
+  800498:	56                   	push   %esi
+  800499:	e8 84 fe ff ff       	call   800322 <printfmt>
+  80049e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004a4:	e9 62 02 00 00       	jmp    80070b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	83 c0 04             	add    $0x4,%eax
+  8004af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004b7:	85 c9                	test   %ecx,%ecx
+  8004b9:	b8 0c 48 80 00       	mov    $0x80480c,%eax
+  8004be:	0f 45 c1             	cmovne %ecx,%eax
+  8004c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c8:	7e 06                	jle    8004d0 <vprintfmt+0x191>
+  8004ca:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004ce:	75 0b                	jne    8004db <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004d3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d9:	eb 5c                	jmp    800537 <vprintfmt+0x1f8>
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	ff 75 d0             	push   -0x30(%ebp)
+  8004e1:	ff 75 cc             	push   -0x34(%ebp)
+  8004e4:	e8 20 03 00 00       	call   800809 <strnlen>
+  8004e9:	89 c2                	mov    %eax,%edx
+  8004eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ee:	29 d0                	sub    %edx,%eax
+  8004f0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004f3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004fd:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ff:	eb 0e                	jmp    80050f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	53                   	push   %ebx
+  800505:	57                   	push   %edi
+  800506:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800509:	83 ee 01             	sub    $0x1,%esi
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	85 f6                	test   %esi,%esi
+  800511:	7f ee                	jg     800501 <vprintfmt+0x1c2>
+  800513:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800516:	8b 75 08             	mov    0x8(%ebp),%esi
+  800519:	85 c0                	test   %eax,%eax
+  80051b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800520:	0f 49 d0             	cmovns %eax,%edx
+  800523:	29 d0                	sub    %edx,%eax
+  800525:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800528:	eb a6                	jmp    8004d0 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	52                   	push   %edx
+  80052f:	ff 55 08             	call   *0x8(%ebp)
+  800532:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800535:	89 f1                	mov    %esi,%ecx
+  800537:	8d 71 01             	lea    0x1(%ecx),%esi
+  80053a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80053e:	0f be d0             	movsbl %al,%edx
+  800541:	85 d2                	test   %edx,%edx
+  800543:	74 28                	je     80056d <vprintfmt+0x22e>
+  800545:	85 ff                	test   %edi,%edi
+  800547:	78 05                	js     80054e <vprintfmt+0x20f>
+  800549:	83 ef 01             	sub    $0x1,%edi
+  80054c:	78 30                	js     80057e <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80054e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800552:	74 d6                	je     80052a <vprintfmt+0x1eb>
+  800554:	0f be c0             	movsbl %al,%eax
+  800557:	83 e8 20             	sub    $0x20,%eax
+  80055a:	83 f8 5e             	cmp    $0x5e,%eax
+  80055d:	76 cb                	jbe    80052a <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 3f                	push   $0x3f
+  800565:	ff 55 08             	call   *0x8(%ebp)
+  800568:	83 c4 10             	add    $0x10,%esp
+  80056b:	eb c8                	jmp    800535 <vprintfmt+0x1f6>
+  80056d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800570:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800573:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800576:	01 d0                	add    %edx,%eax
+  800578:	29 c8                	sub    %ecx,%eax
+  80057a:	89 c7                	mov    %eax,%edi
+  80057c:	eb 13                	jmp    800591 <vprintfmt+0x252>
+  80057e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800581:	eb ed                	jmp    800570 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	6a 20                	push   $0x20
+  800589:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80058b:	83 ef 01             	sub    $0x1,%edi
+  80058e:	83 c4 10             	add    $0x10,%esp
+  800591:	85 ff                	test   %edi,%edi
+  800593:	7f ee                	jg     800583 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800595:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059b:	e9 6b 01 00 00       	jmp    80070b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005a0:	83 f9 01             	cmp    $0x1,%ecx
+  8005a3:	7f 1f                	jg     8005c4 <vprintfmt+0x285>
+	else if (lflag)
+  8005a5:	85 c9                	test   %ecx,%ecx
+  8005a7:	74 67                	je     800610 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 00                	mov    (%eax),%eax
+  8005ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b1:	89 c1                	mov    %eax,%ecx
+  8005b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c2:	eb 17                	jmp    8005db <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ca:	8b 00                	mov    (%eax),%eax
+  8005cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005db:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005de:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005e6:	85 c9                	test   %ecx,%ecx
+  8005e8:	0f 89 03 01 00 00    	jns    8006f1 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	53                   	push   %ebx
+  8005f2:	6a 2d                	push   $0x2d
+  8005f4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005f6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005fc:	f7 da                	neg    %edx
+  8005fe:	83 d1 00             	adc    $0x0,%ecx
+  800601:	f7 d9                	neg    %ecx
+  800603:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800606:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80060b:	e9 e1 00 00 00       	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 00                	mov    (%eax),%eax
+  800615:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800618:	89 c1                	mov    %eax,%ecx
+  80061a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8d 40 04             	lea    0x4(%eax),%eax
+  800626:	89 45 14             	mov    %eax,0x14(%ebp)
+  800629:	eb b0                	jmp    8005db <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80062b:	83 f9 01             	cmp    $0x1,%ecx
+  80062e:	7f 1e                	jg     80064e <vprintfmt+0x30f>
+	else if (lflag)
+  800630:	85 c9                	test   %ecx,%ecx
+  800632:	74 32                	je     800666 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800644:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800649:	e9 a3 00 00 00       	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 10                	mov    (%eax),%edx
+  800653:	8b 48 04             	mov    0x4(%eax),%ecx
+  800656:	8d 40 08             	lea    0x8(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800661:	e9 8b 00 00 00       	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8b 10                	mov    (%eax),%edx
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800670:	8d 40 04             	lea    0x4(%eax),%eax
+  800673:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800676:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80067b:	eb 74                	jmp    8006f1 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80067d:	83 f9 01             	cmp    $0x1,%ecx
+  800680:	7f 1b                	jg     80069d <vprintfmt+0x35e>
+	else if (lflag)
+  800682:	85 c9                	test   %ecx,%ecx
+  800684:	74 2c                	je     8006b2 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800696:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80069b:	eb 54                	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 10                	mov    (%eax),%edx
+  8006a2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ab:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b0:	eb 3f                	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006c7:	eb 28                	jmp    8006f1 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006c9:	83 ec 08             	sub    $0x8,%esp
+  8006cc:	53                   	push   %ebx
+  8006cd:	6a 30                	push   $0x30
+  8006cf:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006d1:	83 c4 08             	add    $0x8,%esp
+  8006d4:	53                   	push   %ebx
+  8006d5:	6a 78                	push   $0x78
+  8006d7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006e3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ec:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006f1:	83 ec 0c             	sub    $0xc,%esp
+  8006f4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f8:	50                   	push   %eax
+  8006f9:	ff 75 e0             	push   -0x20(%ebp)
+  8006fc:	57                   	push   %edi
+  8006fd:	51                   	push   %ecx
+  8006fe:	52                   	push   %edx
+  8006ff:	89 da                	mov    %ebx,%edx
+  800701:	89 f0                	mov    %esi,%eax
+  800703:	e8 54 fb ff ff       	call   80025c <printnum>
+			break;
+  800708:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80070b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80070e:	e9 4a fc ff ff       	jmp    80035d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800713:	83 f9 01             	cmp    $0x1,%ecx
+  800716:	7f 1b                	jg     800733 <vprintfmt+0x3f4>
+	else if (lflag)
+  800718:	85 c9                	test   %ecx,%ecx
+  80071a:	74 2c                	je     800748 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800731:	eb be                	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073b:	8d 40 08             	lea    0x8(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800741:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800746:	eb a9                	jmp    8006f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 10                	mov    (%eax),%edx
+  80074d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800758:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80075d:	eb 92                	jmp    8006f1 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	6a 25                	push   $0x25
+  800765:	ff d6                	call   *%esi
+			break;
+  800767:	83 c4 10             	add    $0x10,%esp
+  80076a:	eb 9f                	jmp    80070b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	53                   	push   %ebx
+  800770:	6a 25                	push   $0x25
+  800772:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800774:	83 c4 10             	add    $0x10,%esp
+  800777:	89 f8                	mov    %edi,%eax
+  800779:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80077d:	74 05                	je     800784 <vprintfmt+0x445>
+  80077f:	83 e8 01             	sub    $0x1,%eax
+  800782:	eb f5                	jmp    800779 <vprintfmt+0x43a>
+  800784:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800787:	eb 82                	jmp    80070b <vprintfmt+0x3cc>
+
+00800789 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800789:	55                   	push   %ebp
+  80078a:	89 e5                	mov    %esp,%ebp
+  80078c:	83 ec 18             	sub    $0x18,%esp
+  80078f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800792:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800795:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800798:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80079c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80079f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007a6:	85 c0                	test   %eax,%eax
+  8007a8:	74 26                	je     8007d0 <vsnprintf+0x47>
+  8007aa:	85 d2                	test   %edx,%edx
+  8007ac:	7e 22                	jle    8007d0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ae:	ff 75 14             	push   0x14(%ebp)
+  8007b1:	ff 75 10             	push   0x10(%ebp)
+  8007b4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b7:	50                   	push   %eax
+  8007b8:	68 05 03 80 00       	push   $0x800305
+  8007bd:	e8 7d fb ff ff       	call   80033f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007cb:	83 c4 10             	add    $0x10,%esp
+}
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+		return -E_INVAL;
+  8007d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d5:	eb f7                	jmp    8007ce <vsnprintf+0x45>
+
+008007d7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007e0:	50                   	push   %eax
+  8007e1:	ff 75 10             	push   0x10(%ebp)
+  8007e4:	ff 75 0c             	push   0xc(%ebp)
+  8007e7:	ff 75 08             	push   0x8(%ebp)
+  8007ea:	e8 9a ff ff ff       	call   800789 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ef:	c9                   	leave
+  8007f0:	c3                   	ret
+
+008007f1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb 03                	jmp    800801 <strlen+0x10>
+		n++;
+  8007fe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800801:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800805:	75 f7                	jne    8007fe <strlen+0xd>
+	return n;
+}
+  800807:	5d                   	pop    %ebp
+  800808:	c3                   	ret
+
+00800809 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800809:	55                   	push   %ebp
+  80080a:	89 e5                	mov    %esp,%ebp
+  80080c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	eb 03                	jmp    80081c <strnlen+0x13>
+		n++;
+  800819:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081c:	39 d0                	cmp    %edx,%eax
+  80081e:	74 08                	je     800828 <strnlen+0x1f>
+  800820:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800824:	75 f3                	jne    800819 <strnlen+0x10>
+  800826:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800828:	89 d0                	mov    %edx,%eax
+  80082a:	5d                   	pop    %ebp
+  80082b:	c3                   	ret
+
+0080082c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80082c:	55                   	push   %ebp
+  80082d:	89 e5                	mov    %esp,%ebp
+  80082f:	53                   	push   %ebx
+  800830:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800833:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80083f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800842:	83 c0 01             	add    $0x1,%eax
+  800845:	84 d2                	test   %dl,%dl
+  800847:	75 f2                	jne    80083b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800849:	89 c8                	mov    %ecx,%eax
+  80084b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084e:	c9                   	leave
+  80084f:	c3                   	ret
+
+00800850 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	53                   	push   %ebx
+  800854:	83 ec 10             	sub    $0x10,%esp
+  800857:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80085a:	53                   	push   %ebx
+  80085b:	e8 91 ff ff ff       	call   8007f1 <strlen>
+  800860:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800863:	ff 75 0c             	push   0xc(%ebp)
+  800866:	01 d8                	add    %ebx,%eax
+  800868:	50                   	push   %eax
+  800869:	e8 be ff ff ff       	call   80082c <strcpy>
+	return dst;
+}
+  80086e:	89 d8                	mov    %ebx,%eax
+  800870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800873:	c9                   	leave
+  800874:	c3                   	ret
+
+00800875 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	56                   	push   %esi
+  800879:	53                   	push   %ebx
+  80087a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800880:	89 f3                	mov    %esi,%ebx
+  800882:	03 5d 10             	add    0x10(%ebp),%ebx
+  800885:	89 f0                	mov    %esi,%eax
+  800887:	eb 0f                	jmp    800898 <strncpy+0x23>
+		*dst++ = *src;
+  800889:	83 c0 01             	add    $0x1,%eax
+  80088c:	0f b6 0a             	movzbl (%edx),%ecx
+  80088f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800892:	80 f9 01             	cmp    $0x1,%cl
+  800895:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800898:	39 d8                	cmp    %ebx,%eax
+  80089a:	75 ed                	jne    800889 <strncpy+0x14>
+	}
+	return ret;
+}
+  80089c:	89 f0                	mov    %esi,%eax
+  80089e:	5b                   	pop    %ebx
+  80089f:	5e                   	pop    %esi
+  8008a0:	5d                   	pop    %ebp
+  8008a1:	c3                   	ret
+
+008008a2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ad:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008b0:	89 f0                	mov    %esi,%eax
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	74 21                	je     8008d7 <strlcpy+0x35>
+  8008b6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ba:	89 f2                	mov    %esi,%edx
+  8008bc:	eb 09                	jmp    8008c7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008be:	83 c1 01             	add    $0x1,%ecx
+  8008c1:	83 c2 01             	add    $0x1,%edx
+  8008c4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c7:	39 c2                	cmp    %eax,%edx
+  8008c9:	74 09                	je     8008d4 <strlcpy+0x32>
+  8008cb:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ce:	84 db                	test   %bl,%bl
+  8008d0:	75 ec                	jne    8008be <strlcpy+0x1c>
+  8008d2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008d4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d7:	29 f0                	sub    %esi,%eax
+}
+  8008d9:	5b                   	pop    %ebx
+  8008da:	5e                   	pop    %esi
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008e6:	eb 06                	jmp    8008ee <strcmp+0x11>
+		p++, q++;
+  8008e8:	83 c1 01             	add    $0x1,%ecx
+  8008eb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ee:	0f b6 01             	movzbl (%ecx),%eax
+  8008f1:	84 c0                	test   %al,%al
+  8008f3:	74 04                	je     8008f9 <strcmp+0x1c>
+  8008f5:	3a 02                	cmp    (%edx),%al
+  8008f7:	74 ef                	je     8008e8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f9:	0f b6 c0             	movzbl %al,%eax
+  8008fc:	0f b6 12             	movzbl (%edx),%edx
+  8008ff:	29 d0                	sub    %edx,%eax
+}
+  800901:	5d                   	pop    %ebp
+  800902:	c3                   	ret
+
+00800903 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	53                   	push   %ebx
+  800907:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800910:	eb 09                	jmp    80091b <strncmp+0x18>
+		n--, p++, q++;
+  800912:	83 ea 01             	sub    $0x1,%edx
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80091b:	85 d2                	test   %edx,%edx
+  80091d:	74 18                	je     800937 <strncmp+0x34>
+  80091f:	0f b6 18             	movzbl (%eax),%ebx
+  800922:	84 db                	test   %bl,%bl
+  800924:	74 04                	je     80092a <strncmp+0x27>
+  800926:	3a 19                	cmp    (%ecx),%bl
+  800928:	74 e8                	je     800912 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092a:	0f b6 00             	movzbl (%eax),%eax
+  80092d:	0f b6 11             	movzbl (%ecx),%edx
+  800930:	29 d0                	sub    %edx,%eax
+}
+  800932:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800935:	c9                   	leave
+  800936:	c3                   	ret
+		return 0;
+  800937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093c:	eb f4                	jmp    800932 <strncmp+0x2f>
+
+0080093e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	8b 45 08             	mov    0x8(%ebp),%eax
+  800944:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800948:	eb 03                	jmp    80094d <strchr+0xf>
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	0f b6 10             	movzbl (%eax),%edx
+  800950:	84 d2                	test   %dl,%dl
+  800952:	74 06                	je     80095a <strchr+0x1c>
+		if (*s == c)
+  800954:	38 ca                	cmp    %cl,%dl
+  800956:	75 f2                	jne    80094a <strchr+0xc>
+  800958:	eb 05                	jmp    80095f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80095a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	8b 45 08             	mov    0x8(%ebp),%eax
+  800967:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80096e:	38 ca                	cmp    %cl,%dl
+  800970:	74 09                	je     80097b <strfind+0x1a>
+  800972:	84 d2                	test   %dl,%dl
+  800974:	74 05                	je     80097b <strfind+0x1a>
+	for (; *s; s++)
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	eb f0                	jmp    80096b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80097b:	5d                   	pop    %ebp
+  80097c:	c3                   	ret
+
+0080097d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	57                   	push   %edi
+  800981:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800984:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800987:	85 c9                	test   %ecx,%ecx
+  800989:	74 20                	je     8009ab <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80098b:	89 f8                	mov    %edi,%eax
+  80098d:	09 c8                	or     %ecx,%eax
+  80098f:	a8 03                	test   $0x3,%al
+  800991:	75 12                	jne    8009a5 <memset+0x28>
+		c &= 0xFF;
+  800993:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800997:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80099d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009a0:	fc                   	cld
+  8009a1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a3:	eb 06                	jmp    8009ab <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a8:	fc                   	cld
+  8009a9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ab:	89 f8                	mov    %edi,%eax
+  8009ad:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009b0:	c9                   	leave
+  8009b1:	c3                   	ret
+
+008009b2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	57                   	push   %edi
+  8009b6:	56                   	push   %esi
+  8009b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009bd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009c0:	39 c6                	cmp    %eax,%esi
+  8009c2:	73 32                	jae    8009f6 <memmove+0x44>
+  8009c4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c7:	39 d0                	cmp    %edx,%eax
+  8009c9:	73 2b                	jae    8009f6 <memmove+0x44>
+		s += n;
+		d += n;
+  8009cb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ce:	89 d6                	mov    %edx,%esi
+  8009d0:	09 fe                	or     %edi,%esi
+  8009d2:	09 ce                	or     %ecx,%esi
+  8009d4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009da:	75 0e                	jne    8009ea <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009dc:	83 ef 04             	sub    $0x4,%edi
+  8009df:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009e5:	fd                   	std
+  8009e6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e8:	eb 09                	jmp    8009f3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ea:	83 ef 01             	sub    $0x1,%edi
+  8009ed:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009f0:	fd                   	std
+  8009f1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009f3:	fc                   	cld
+  8009f4:	eb 1a                	jmp    800a10 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f6:	89 f2                	mov    %esi,%edx
+  8009f8:	09 c2                	or     %eax,%edx
+  8009fa:	09 ca                	or     %ecx,%edx
+  8009fc:	f6 c2 03             	test   $0x3,%dl
+  8009ff:	75 0a                	jne    800a0b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a01:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a04:	89 c7                	mov    %eax,%edi
+  800a06:	fc                   	cld
+  800a07:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a09:	eb 05                	jmp    800a10 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a0b:	89 c7                	mov    %eax,%edi
+  800a0d:	fc                   	cld
+  800a0e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a10:	5e                   	pop    %esi
+  800a11:	5f                   	pop    %edi
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a1a:	ff 75 10             	push   0x10(%ebp)
+  800a1d:	ff 75 0c             	push   0xc(%ebp)
+  800a20:	ff 75 08             	push   0x8(%ebp)
+  800a23:	e8 8a ff ff ff       	call   8009b2 <memmove>
+}
+  800a28:	c9                   	leave
+  800a29:	c3                   	ret
+
+00800a2a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	56                   	push   %esi
+  800a2e:	53                   	push   %ebx
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a35:	89 c6                	mov    %eax,%esi
+  800a37:	03 75 10             	add    0x10(%ebp),%esi
+  800a3a:	eb 06                	jmp    800a42 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a3c:	83 c0 01             	add    $0x1,%eax
+  800a3f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a42:	39 f0                	cmp    %esi,%eax
+  800a44:	74 14                	je     800a5a <memcmp+0x30>
+		if (*s1 != *s2)
+  800a46:	0f b6 08             	movzbl (%eax),%ecx
+  800a49:	0f b6 1a             	movzbl (%edx),%ebx
+  800a4c:	38 d9                	cmp    %bl,%cl
+  800a4e:	74 ec                	je     800a3c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a50:	0f b6 c1             	movzbl %cl,%eax
+  800a53:	0f b6 db             	movzbl %bl,%ebx
+  800a56:	29 d8                	sub    %ebx,%eax
+  800a58:	eb 05                	jmp    800a5f <memcmp+0x35>
+	}
+
+	return 0;
+  800a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5f:	5b                   	pop    %ebx
+  800a60:	5e                   	pop    %esi
+  800a61:	5d                   	pop    %ebp
+  800a62:	c3                   	ret
+
+00800a63 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a6c:	89 c2                	mov    %eax,%edx
+  800a6e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a71:	eb 03                	jmp    800a76 <memfind+0x13>
+  800a73:	83 c0 01             	add    $0x1,%eax
+  800a76:	39 d0                	cmp    %edx,%eax
+  800a78:	73 04                	jae    800a7e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a7a:	38 08                	cmp    %cl,(%eax)
+  800a7c:	75 f5                	jne    800a73 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a7e:	5d                   	pop    %ebp
+  800a7f:	c3                   	ret
+
+00800a80 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+  800a83:	57                   	push   %edi
+  800a84:	56                   	push   %esi
+  800a85:	53                   	push   %ebx
+  800a86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a8c:	eb 03                	jmp    800a91 <strtol+0x11>
+		s++;
+  800a8e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a91:	0f b6 02             	movzbl (%edx),%eax
+  800a94:	3c 20                	cmp    $0x20,%al
+  800a96:	74 f6                	je     800a8e <strtol+0xe>
+  800a98:	3c 09                	cmp    $0x9,%al
+  800a9a:	74 f2                	je     800a8e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a9c:	3c 2b                	cmp    $0x2b,%al
+  800a9e:	74 2a                	je     800aca <strtol+0x4a>
+	int neg = 0;
+  800aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aa5:	3c 2d                	cmp    $0x2d,%al
+  800aa7:	74 2b                	je     800ad4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aaf:	75 0f                	jne    800ac0 <strtol+0x40>
+  800ab1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ab4:	74 28                	je     800ade <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab6:	85 db                	test   %ebx,%ebx
+  800ab8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abd:	0f 44 d8             	cmove  %eax,%ebx
+  800ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac8:	eb 46                	jmp    800b10 <strtol+0x90>
+		s++;
+  800aca:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800acd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad2:	eb d5                	jmp    800aa9 <strtol+0x29>
+		s++, neg = 1;
+  800ad4:	83 c2 01             	add    $0x1,%edx
+  800ad7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800adc:	eb cb                	jmp    800aa9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ade:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ae2:	74 0e                	je     800af2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ae4:	85 db                	test   %ebx,%ebx
+  800ae6:	75 d8                	jne    800ac0 <strtol+0x40>
+		s++, base = 8;
+  800ae8:	83 c2 01             	add    $0x1,%edx
+  800aeb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800af0:	eb ce                	jmp    800ac0 <strtol+0x40>
+		s += 2, base = 16;
+  800af2:	83 c2 02             	add    $0x2,%edx
+  800af5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800afa:	eb c4                	jmp    800ac0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800afc:	0f be c0             	movsbl %al,%eax
+  800aff:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b02:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b05:	7d 3a                	jge    800b41 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b07:	83 c2 01             	add    $0x1,%edx
+  800b0a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b0e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b10:	0f b6 02             	movzbl (%edx),%eax
+  800b13:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b16:	89 f3                	mov    %esi,%ebx
+  800b18:	80 fb 09             	cmp    $0x9,%bl
+  800b1b:	76 df                	jbe    800afc <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b1d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b20:	89 f3                	mov    %esi,%ebx
+  800b22:	80 fb 19             	cmp    $0x19,%bl
+  800b25:	77 08                	ja     800b2f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b27:	0f be c0             	movsbl %al,%eax
+  800b2a:	83 e8 57             	sub    $0x57,%eax
+  800b2d:	eb d3                	jmp    800b02 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b2f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b32:	89 f3                	mov    %esi,%ebx
+  800b34:	80 fb 19             	cmp    $0x19,%bl
+  800b37:	77 08                	ja     800b41 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b39:	0f be c0             	movsbl %al,%eax
+  800b3c:	83 e8 37             	sub    $0x37,%eax
+  800b3f:	eb c1                	jmp    800b02 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b41:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b45:	74 05                	je     800b4c <strtol+0xcc>
+		*endptr = (char *) s;
+  800b47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b4a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b4c:	89 c8                	mov    %ecx,%eax
+  800b4e:	f7 d8                	neg    %eax
+  800b50:	85 ff                	test   %edi,%edi
+  800b52:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b55:	89 c8                	mov    %ecx,%eax
+  800b57:	5b                   	pop    %ebx
+  800b58:	5e                   	pop    %esi
+  800b59:	5f                   	pop    %edi
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+
+00800b5c <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b62:	6a 00                	push   $0x0
+  800b64:	6a 00                	push   $0x0
+  800b66:	ff 75 08             	push   0x8(%ebp)
+  800b69:	e8 12 ff ff ff       	call   800a80 <strtol>
+}
+  800b6e:	c9                   	leave
+  800b6f:	c3                   	ret
+
+00800b70 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	57                   	push   %edi
+  800b74:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b80:	89 c3                	mov    %eax,%ebx
+  800b82:	89 c7                	mov    %eax,%edi
+  800b84:	6a 00                	push   $0x0
+  800b86:	55                   	push   %ebp
+  800b87:	56                   	push   %esi
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	8d 35 92 0b 80 00    	lea    0x800b92,%esi
+  800b90:	0f 34                	sysenter
+
+00800b92 <after_sysenter_label_47>:
+  800b92:	5e                   	pop    %esi
+  800b93:	5d                   	pop    %ebp
+  800b94:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b97:	5b                   	pop    %ebx
+  800b98:	5f                   	pop    %edi
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+
+00800b9b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	57                   	push   %edi
+  800b9f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800baa:	89 d1                	mov    %edx,%ecx
+  800bac:	89 d3                	mov    %edx,%ebx
+  800bae:	89 d7                	mov    %edx,%edi
+  800bb0:	6a 00                	push   $0x0
+  800bb2:	55                   	push   %ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	8d 35 be 0b 80 00    	lea    0x800bbe,%esi
+  800bbc:	0f 34                	sysenter
+
+00800bbe <after_sysenter_label_128>:
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bc3:	5b                   	pop    %ebx
+  800bc4:	5f                   	pop    %edi
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+
+00800bc7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	57                   	push   %edi
+  800bcb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bd9:	89 cb                	mov    %ecx,%ebx
+  800bdb:	89 cf                	mov    %ecx,%edi
+  800bdd:	6a 00                	push   $0x0
+  800bdf:	55                   	push   %ebp
+  800be0:	56                   	push   %esi
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	8d 35 eb 0b 80 00    	lea    0x800beb,%esi
+  800be9:	0f 34                	sysenter
+
+00800beb <after_sysenter_label_212>:
+  800beb:	5e                   	pop    %esi
+  800bec:	5d                   	pop    %ebp
+  800bed:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bf0:	85 c0                	test   %eax,%eax
+  800bf2:	7f 07                	jg     800bfb <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf7:	5b                   	pop    %ebx
+  800bf8:	5f                   	pop    %edi
+  800bf9:	5d                   	pop    %ebp
+  800bfa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bfb:	83 ec 0c             	sub    $0xc,%esp
+  800bfe:	50                   	push   %eax
+  800bff:	6a 03                	push   $0x3
+  800c01:	68 75 4b 80 00       	push   $0x804b75
+  800c06:	6a 54                	push   $0x54
+  800c08:	68 92 4b 80 00       	push   $0x804b92
+  800c0d:	e8 5b f5 ff ff       	call   80016d <_panic>
+
+00800c12 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	57                   	push   %edi
+  800c16:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c21:	89 d1                	mov    %edx,%ecx
+  800c23:	89 d3                	mov    %edx,%ebx
+  800c25:	89 d7                	mov    %edx,%edi
+  800c27:	6a 00                	push   $0x0
+  800c29:	55                   	push   %ebp
+  800c2a:	56                   	push   %esi
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	8d 35 35 0c 80 00    	lea    0x800c35,%esi
+  800c33:	0f 34                	sysenter
+
+00800c35 <after_sysenter_label_309>:
+  800c35:	5e                   	pop    %esi
+  800c36:	5d                   	pop    %ebp
+  800c37:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c3a:	5b                   	pop    %ebx
+  800c3b:	5f                   	pop    %edi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+
+00800c3e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c48:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c4d:	89 d1                	mov    %edx,%ecx
+  800c4f:	89 d3                	mov    %edx,%ebx
+  800c51:	89 d7                	mov    %edx,%edi
+  800c53:	6a 00                	push   $0x0
+  800c55:	55                   	push   %ebp
+  800c56:	56                   	push   %esi
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	8d 35 61 0c 80 00    	lea    0x800c61,%esi
+  800c5f:	0f 34                	sysenter
+
+00800c61 <after_sysenter_label_391>:
+  800c61:	5e                   	pop    %esi
+  800c62:	5d                   	pop    %ebp
+  800c63:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c66:	5b                   	pop    %ebx
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c75:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c82:	6a 00                	push   $0x0
+  800c84:	55                   	push   %ebp
+  800c85:	56                   	push   %esi
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	8d 35 90 0c 80 00    	lea    0x800c90,%esi
+  800c8e:	0f 34                	sysenter
+
+00800c90 <after_sysenter_label_479>:
+  800c90:	5e                   	pop    %esi
+  800c91:	5d                   	pop    %ebp
+  800c92:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c95:	85 c0                	test   %eax,%eax
+  800c97:	7f 07                	jg     800ca0 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5f                   	pop    %edi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+  800ca3:	50                   	push   %eax
+  800ca4:	6a 04                	push   $0x4
+  800ca6:	68 75 4b 80 00       	push   $0x804b75
+  800cab:	6a 54                	push   $0x54
+  800cad:	68 92 4b 80 00       	push   $0x804b92
+  800cb2:	e8 b6 f4 ff ff       	call   80016d <_panic>
+
+00800cb7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ccd:	ff 75 18             	push   0x18(%ebp)
+  800cd0:	55                   	push   %ebp
+  800cd1:	56                   	push   %esi
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	8d 35 dc 0c 80 00    	lea    0x800cdc,%esi
+  800cda:	0f 34                	sysenter
+
+00800cdc <after_sysenter_label_593>:
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ce1:	85 c0                	test   %eax,%eax
+  800ce3:	7f 07                	jg     800cec <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ce5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce8:	5b                   	pop    %ebx
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+  800cef:	50                   	push   %eax
+  800cf0:	6a 05                	push   $0x5
+  800cf2:	68 75 4b 80 00       	push   $0x804b75
+  800cf7:	6a 54                	push   $0x54
+  800cf9:	68 92 4b 80 00       	push   $0x804b92
+  800cfe:	e8 6a f4 ff ff       	call   80016d <_panic>
+
+00800d03 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d13:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d18:	89 df                	mov    %ebx,%edi
+  800d1a:	6a 00                	push   $0x0
+  800d1c:	55                   	push   %ebp
+  800d1d:	56                   	push   %esi
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	8d 35 28 0d 80 00    	lea    0x800d28,%esi
+  800d26:	0f 34                	sysenter
+
+00800d28 <after_sysenter_label_704>:
+  800d28:	5e                   	pop    %esi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	7f 07                	jg     800d38 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d34:	5b                   	pop    %ebx
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 06                	push   $0x6
+  800d3e:	68 75 4b 80 00       	push   $0x804b75
+  800d43:	6a 54                	push   $0x54
+  800d45:	68 92 4b 80 00       	push   $0x804b92
+  800d4a:	e8 1e f4 ff ff       	call   80016d <_panic>
+
+00800d4f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d64:	89 df                	mov    %ebx,%edi
+  800d66:	6a 00                	push   $0x0
+  800d68:	55                   	push   %ebp
+  800d69:	56                   	push   %esi
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	8d 35 74 0d 80 00    	lea    0x800d74,%esi
+  800d72:	0f 34                	sysenter
+
+00800d74 <after_sysenter_label_808>:
+  800d74:	5e                   	pop    %esi
+  800d75:	5d                   	pop    %ebp
+  800d76:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 07                	jg     800d84 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  800d87:	50                   	push   %eax
+  800d88:	6a 08                	push   $0x8
+  800d8a:	68 75 4b 80 00       	push   $0x804b75
+  800d8f:	6a 54                	push   $0x54
+  800d91:	68 92 4b 80 00       	push   $0x804b92
+  800d96:	e8 d2 f3 ff ff       	call   80016d <_panic>
+
+00800d9b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	57                   	push   %edi
+  800d9f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dab:	b8 09 00 00 00       	mov    $0x9,%eax
+  800db0:	89 df                	mov    %ebx,%edi
+  800db2:	6a 00                	push   $0x0
+  800db4:	55                   	push   %ebp
+  800db5:	56                   	push   %esi
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8d 35 c0 0d 80 00    	lea    0x800dc0,%esi
+  800dbe:	0f 34                	sysenter
+
+00800dc0 <after_sysenter_label_912>:
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	7f 07                	jg     800dd0 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 09                	push   $0x9
+  800dd6:	68 75 4b 80 00       	push   $0x804b75
+  800ddb:	6a 54                	push   $0x54
+  800ddd:	68 92 4b 80 00       	push   $0x804b92
+  800de2:	e8 86 f3 ff ff       	call   80016d <_panic>
+
+00800de7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dfc:	89 df                	mov    %ebx,%edi
+  800dfe:	6a 00                	push   $0x0
+  800e00:	55                   	push   %ebp
+  800e01:	56                   	push   %esi
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	8d 35 0c 0e 80 00    	lea    0x800e0c,%esi
+  800e0a:	0f 34                	sysenter
+
+00800e0c <after_sysenter_label_1016>:
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 07                	jg     800e1c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	50                   	push   %eax
+  800e20:	6a 0a                	push   $0xa
+  800e22:	68 75 4b 80 00       	push   $0x804b75
+  800e27:	6a 54                	push   $0x54
+  800e29:	68 92 4b 80 00       	push   $0x804b92
+  800e2e:	e8 3a f3 ff ff       	call   80016d <_panic>
+
+00800e33 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e49:	6a 00                	push   $0x0
+  800e4b:	55                   	push   %ebp
+  800e4c:	56                   	push   %esi
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8d 35 57 0e 80 00    	lea    0x800e57,%esi
+  800e55:	0f 34                	sysenter
+
+00800e57 <after_sysenter_label_1126>:
+  800e57:	5e                   	pop    %esi
+  800e58:	5d                   	pop    %ebp
+  800e59:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+
+00800e60 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e72:	89 cb                	mov    %ecx,%ebx
+  800e74:	89 cf                	mov    %ecx,%edi
+  800e76:	6a 00                	push   $0x0
+  800e78:	55                   	push   %ebp
+  800e79:	56                   	push   %esi
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	8d 35 84 0e 80 00    	lea    0x800e84,%esi
+  800e82:	0f 34                	sysenter
+
+00800e84 <after_sysenter_label_1210>:
+  800e84:	5e                   	pop    %esi
+  800e85:	5d                   	pop    %ebp
+  800e86:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 07                	jg     800e94 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 0d                	push   $0xd
+  800e9a:	68 75 4b 80 00       	push   $0x804b75
+  800e9f:	6a 54                	push   $0x54
+  800ea1:	68 92 4b 80 00       	push   $0x804b92
+  800ea6:	e8 c2 f2 ff ff       	call   80016d <_panic>
+
+00800eab <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 42 00 00 00       	mov    $0x42,%eax
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	6a 00                	push   $0x0
+  800ec4:	55                   	push   %ebp
+  800ec5:	56                   	push   %esi
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	8d 35 d0 0e 80 00    	lea    0x800ed0,%esi
+  800ece:	0f 34                	sysenter
+
+00800ed0 <after_sysenter_label_1311>:
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 07                	jg     800ee0 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800ed9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5f                   	pop    %edi
+  800ede:	5d                   	pop    %ebp
+  800edf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+  800ee3:	50                   	push   %eax
+  800ee4:	6a 42                	push   $0x42
+  800ee6:	68 75 4b 80 00       	push   $0x804b75
+  800eeb:	6a 54                	push   $0x54
+  800eed:	68 92 4b 80 00       	push   $0x804b92
+  800ef2:	e8 76 f2 ff ff       	call   80016d <_panic>
+
+00800ef7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800efc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f01:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f06:	89 d1                	mov    %edx,%ecx
+  800f08:	89 d3                	mov    %edx,%ebx
+  800f0a:	89 d7                	mov    %edx,%edi
+  800f0c:	6a 00                	push   $0x0
+  800f0e:	55                   	push   %ebp
+  800f0f:	56                   	push   %esi
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	8d 35 1a 0f 80 00    	lea    0x800f1a,%esi
+  800f18:	0f 34                	sysenter
+
+00800f1a <after_sysenter_label_1411>:
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	6a 00                	push   $0x0
+  800f3c:	55                   	push   %ebp
+  800f3d:	56                   	push   %esi
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	8d 35 48 0f 80 00    	lea    0x800f48,%esi
+  800f46:	0f 34                	sysenter
+
+00800f48 <after_sysenter_label_1497>:
+  800f48:	5e                   	pop    %esi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f61:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f66:	89 df                	mov    %ebx,%edi
+  800f68:	6a 00                	push   $0x0
+  800f6a:	55                   	push   %ebp
+  800f6b:	56                   	push   %esi
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	8d 35 76 0f 80 00    	lea    0x800f76,%esi
+  800f74:	0f 34                	sysenter
+
+00800f76 <after_sysenter_label_1583>:
+  800f76:	5e                   	pop    %esi
+  800f77:	5d                   	pop    %ebp
+  800f78:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+
+00800f7f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	57                   	push   %edi
+  800f83:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f97:	6a 00                	push   $0x0
+  800f99:	55                   	push   %ebp
+  800f9a:	56                   	push   %esi
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	8d 35 a5 0f 80 00    	lea    0x800fa5,%esi
+  800fa3:	0f 34                	sysenter
+
+00800fa5 <after_sysenter_label_1672>:
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800faa:	5b                   	pop    %ebx
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc3:	89 df                	mov    %ebx,%edi
+  800fc5:	6a 00                	push   $0x0
+  800fc7:	55                   	push   %ebp
+  800fc8:	56                   	push   %esi
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	8d 35 d3 0f 80 00    	lea    0x800fd3,%esi
+  800fd1:	0f 34                	sysenter
+
+00800fd3 <after_sysenter_label_1758>:
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+
+00800fdc <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	57                   	push   %edi
+  800fe0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe9:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fee:	89 cb                	mov    %ecx,%ebx
+  800ff0:	89 cf                	mov    %ecx,%edi
+  800ff2:	6a 00                	push   $0x0
+  800ff4:	55                   	push   %ebp
+  800ff5:	56                   	push   %esi
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	8d 35 00 10 80 00    	lea    0x801000,%esi
+  800ffe:	0f 34                	sysenter
+
+00801000 <after_sysenter_label_1842>:
+  801000:	5e                   	pop    %esi
+  801001:	5d                   	pop    %ebp
+  801002:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801005:	85 c0                	test   %eax,%eax
+  801007:	7f 07                	jg     801010 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80100c:	5b                   	pop    %ebx
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 13                	push   $0x13
+  801016:	68 75 4b 80 00       	push   $0x804b75
+  80101b:	6a 54                	push   $0x54
+  80101d:	68 92 4b 80 00       	push   $0x804b92
+  801022:	e8 46 f1 ff ff       	call   80016d <_panic>
+
+00801027 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801031:	b8 14 00 00 00       	mov    $0x14,%eax
+  801036:	89 d1                	mov    %edx,%ecx
+  801038:	89 d3                	mov    %edx,%ebx
+  80103a:	89 d7                	mov    %edx,%edi
+  80103c:	6a 00                	push   $0x0
+  80103e:	55                   	push   %ebp
+  80103f:	56                   	push   %esi
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	8d 35 4a 10 80 00    	lea    0x80104a,%esi
+  801048:	0f 34                	sysenter
+
+0080104a <after_sysenter_label_1939>:
+  80104a:	5e                   	pop    %esi
+  80104b:	5d                   	pop    %ebp
+  80104c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80104f:	5b                   	pop    %ebx
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+
+00801053 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801063:	bf 00 00 00 00       	mov    $0x0,%edi
+  801068:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106b:	6a 00                	push   $0x0
+  80106d:	55                   	push   %ebp
+  80106e:	56                   	push   %esi
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	8d 35 79 10 80 00    	lea    0x801079,%esi
+  801077:	0f 34                	sysenter
+
+00801079 <after_sysenter_label_2028>:
+  801079:	5e                   	pop    %esi
+  80107a:	5d                   	pop    %ebp
+  80107b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80107e:	5b                   	pop    %ebx
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+
+00801082 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 16 00 00 00       	mov    $0x16,%eax
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	6a 00                	push   $0x0
+  80109b:	55                   	push   %ebp
+  80109c:	56                   	push   %esi
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	8d 35 a7 10 80 00    	lea    0x8010a7,%esi
+  8010a5:	0f 34                	sysenter
+
+008010a7 <after_sysenter_label_2114>:
+  8010a7:	5e                   	pop    %esi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+
+008010b0 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010c5:	89 df                	mov    %ebx,%edi
+  8010c7:	6a 00                	push   $0x0
+  8010c9:	55                   	push   %ebp
+  8010ca:	56                   	push   %esi
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	8d 35 d5 10 80 00    	lea    0x8010d5,%esi
+  8010d3:	0f 34                	sysenter
+
+008010d5 <after_sysenter_label_2200>:
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010da:	5b                   	pop    %ebx
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+
+008010de <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f3:	89 df                	mov    %ebx,%edi
+  8010f5:	6a 00                	push   $0x0
+  8010f7:	55                   	push   %ebp
+  8010f8:	56                   	push   %esi
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	8d 35 03 11 80 00    	lea    0x801103,%esi
+  801101:	0f 34                	sysenter
+
+00801103 <after_sysenter_label_2286>:
+  801103:	5e                   	pop    %esi
+  801104:	5d                   	pop    %ebp
+  801105:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801108:	5b                   	pop    %ebx
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+
+0080110c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801112:	83 3d c4 62 80 00 00 	cmpl   $0x0,0x8062c4
+  801119:	74 0a                	je     801125 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80111b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111e:	a3 c4 62 80 00       	mov    %eax,0x8062c4
+}
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  801125:	83 ec 04             	sub    $0x4,%esp
+  801128:	6a 07                	push   $0x7
+  80112a:	68 00 f0 bf ee       	push   $0xeebff000
+  80112f:	6a 00                	push   $0x0
+  801131:	e8 34 fb ff ff       	call   800c6a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801136:	83 c4 08             	add    $0x8,%esp
+  801139:	68 4a 11 80 00       	push   $0x80114a
+  80113e:	6a 00                	push   $0x0
+  801140:	e8 a2 fc ff ff       	call   800de7 <sys_env_set_pgfault_upcall>
+  801145:	83 c4 10             	add    $0x10,%esp
+  801148:	eb d1                	jmp    80111b <set_pgfault_handler+0xf>
+
+0080114a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80114a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80114b:	a1 c4 62 80 00       	mov    0x8062c4,%eax
+	call *%eax
+  801150:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801152:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  801155:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  801159:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80115d:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  801160:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  801164:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  801166:	83 c4 08             	add    $0x8,%esp
+	popal
+  801169:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80116a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80116d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80116e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80116f:	c3                   	ret
+
+00801170 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801173:	8b 45 08             	mov    0x8(%ebp),%eax
+  801176:	05 00 00 00 30       	add    $0x30000000,%eax
+  80117b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+
+00801180 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801183:	8b 45 08             	mov    0x8(%ebp),%eax
+  801186:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80118b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801190:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+
+00801197 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80119a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80119f:	eb 02                	jmp    8011a3 <fd_alloc+0xc>
+  8011a1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011a3:	89 c2                	mov    %eax,%edx
+  8011a5:	c1 ea 16             	shr    $0x16,%edx
+  8011a8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011af:	f6 c2 01             	test   $0x1,%dl
+  8011b2:	74 2b                	je     8011df <fd_alloc+0x48>
+  8011b4:	89 c2                	mov    %eax,%edx
+  8011b6:	c1 ea 0c             	shr    $0xc,%edx
+  8011b9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011c0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011c6:	f6 c1 01             	test   $0x1,%cl
+  8011c9:	74 14                	je     8011df <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011cb:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011d1:	75 ce                	jne    8011a1 <fd_alloc+0xa>
+  8011d3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011d8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011dd:	eb 05                	jmp    8011e4 <fd_alloc+0x4d>
+			return 0;
+  8011df:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	89 02                	mov    %eax,(%edx)
+}
+  8011e9:	89 c8                	mov    %ecx,%eax
+  8011eb:	5d                   	pop    %ebp
+  8011ec:	c3                   	ret
+
+008011ed <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011ed:	55                   	push   %ebp
+  8011ee:	89 e5                	mov    %esp,%ebp
+  8011f0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011f3:	83 f8 1f             	cmp    $0x1f,%eax
+  8011f6:	77 30                	ja     801228 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011f8:	c1 e0 0c             	shl    $0xc,%eax
+  8011fb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801200:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801206:	f6 c2 01             	test   $0x1,%dl
+  801209:	74 24                	je     80122f <fd_lookup+0x42>
+  80120b:	89 c2                	mov    %eax,%edx
+  80120d:	c1 ea 0c             	shr    $0xc,%edx
+  801210:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801217:	f6 c2 01             	test   $0x1,%dl
+  80121a:	74 1a                	je     801236 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80121c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801226:	5d                   	pop    %ebp
+  801227:	c3                   	ret
+		return -E_INVAL;
+  801228:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80122d:	eb f7                	jmp    801226 <fd_lookup+0x39>
+		return -E_INVAL;
+  80122f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801234:	eb f0                	jmp    801226 <fd_lookup+0x39>
+  801236:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80123b:	eb e9                	jmp    801226 <fd_lookup+0x39>
+
+0080123d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	53                   	push   %ebx
+  801241:	83 ec 04             	sub    $0x4,%esp
+  801244:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124c:	eb 03                	jmp    801251 <dev_lookup+0x14>
+  80124e:	83 c0 01             	add    $0x1,%eax
+  801251:	8b 1c 85 1c 4c 80 00 	mov    0x804c1c(,%eax,4),%ebx
+  801258:	85 db                	test   %ebx,%ebx
+  80125a:	74 0b                	je     801267 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80125c:	39 13                	cmp    %edx,(%ebx)
+  80125e:	75 ee                	jne    80124e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801260:	b8 00 00 00 00       	mov    $0x0,%eax
+  801265:	eb 49                	jmp    8012b0 <dev_lookup+0x73>
+  801267:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801269:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80126f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801274:	77 18                	ja     80128e <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801276:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80127b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80127d:	c1 e8 10             	shr    $0x10,%eax
+  801280:	74 0c                	je     80128e <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801282:	c1 e0 10             	shl    $0x10,%eax
+  801285:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80128a:	29 c1                	sub    %eax,%ecx
+  80128c:	eb 06                	jmp    801294 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80128e:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801294:	8b 01                	mov    (%ecx),%eax
+  801296:	8b 40 48             	mov    0x48(%eax),%eax
+  801299:	83 ec 04             	sub    $0x4,%esp
+  80129c:	52                   	push   %edx
+  80129d:	50                   	push   %eax
+  80129e:	68 a0 4b 80 00       	push   $0x804ba0
+  8012a3:	e8 a0 ef ff ff       	call   800248 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012a8:	83 c4 10             	add    $0x10,%esp
+  8012ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b3:	89 1a                	mov    %ebx,(%edx)
+}
+  8012b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012b8:	c9                   	leave
+  8012b9:	c3                   	ret
+
+008012ba <fd_close>:
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	57                   	push   %edi
+  8012be:	56                   	push   %esi
+  8012bf:	53                   	push   %ebx
+  8012c0:	83 ec 24             	sub    $0x24,%esp
+  8012c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012c9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012cc:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012cd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012d3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012d6:	50                   	push   %eax
+  8012d7:	e8 11 ff ff ff       	call   8011ed <fd_lookup>
+  8012dc:	89 c3                	mov    %eax,%ebx
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	78 05                	js     8012ea <fd_close+0x30>
+	    || fd != fd2)
+  8012e5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012e8:	74 16                	je     801300 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012ea:	89 f8                	mov    %edi,%eax
+  8012ec:	84 c0                	test   %al,%al
+  8012ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012f6:	89 d8                	mov    %ebx,%eax
+  8012f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fb:	5b                   	pop    %ebx
+  8012fc:	5e                   	pop    %esi
+  8012fd:	5f                   	pop    %edi
+  8012fe:	5d                   	pop    %ebp
+  8012ff:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801300:	83 ec 08             	sub    $0x8,%esp
+  801303:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801306:	50                   	push   %eax
+  801307:	ff 36                	push   (%esi)
+  801309:	e8 2f ff ff ff       	call   80123d <dev_lookup>
+  80130e:	89 c3                	mov    %eax,%ebx
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	85 c0                	test   %eax,%eax
+  801315:	78 1a                	js     801331 <fd_close+0x77>
+		if (dev->dev_close)
+  801317:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80131a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801322:	85 c0                	test   %eax,%eax
+  801324:	74 0b                	je     801331 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	56                   	push   %esi
+  80132a:	ff d0                	call   *%eax
+  80132c:	89 c3                	mov    %eax,%ebx
+  80132e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801331:	83 ec 08             	sub    $0x8,%esp
+  801334:	56                   	push   %esi
+  801335:	6a 00                	push   $0x0
+  801337:	e8 c7 f9 ff ff       	call   800d03 <sys_page_unmap>
+	return r;
+  80133c:	83 c4 10             	add    $0x10,%esp
+  80133f:	eb b5                	jmp    8012f6 <fd_close+0x3c>
+
+00801341 <close>:
+
+int
+close(int fdnum)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801347:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80134a:	50                   	push   %eax
+  80134b:	ff 75 08             	push   0x8(%ebp)
+  80134e:	e8 9a fe ff ff       	call   8011ed <fd_lookup>
+  801353:	83 c4 10             	add    $0x10,%esp
+  801356:	85 c0                	test   %eax,%eax
+  801358:	79 02                	jns    80135c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80135a:	c9                   	leave
+  80135b:	c3                   	ret
+		return fd_close(fd, 1);
+  80135c:	83 ec 08             	sub    $0x8,%esp
+  80135f:	6a 01                	push   $0x1
+  801361:	ff 75 f4             	push   -0xc(%ebp)
+  801364:	e8 51 ff ff ff       	call   8012ba <fd_close>
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	eb ec                	jmp    80135a <close+0x19>
+
+0080136e <close_all>:
+
+void
+close_all(void)
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	53                   	push   %ebx
+  801372:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80137a:	83 ec 0c             	sub    $0xc,%esp
+  80137d:	53                   	push   %ebx
+  80137e:	e8 be ff ff ff       	call   801341 <close>
+	for (i = 0; i < MAXFD; i++)
+  801383:	83 c3 01             	add    $0x1,%ebx
+  801386:	83 c4 10             	add    $0x10,%esp
+  801389:	83 fb 20             	cmp    $0x20,%ebx
+  80138c:	75 ec                	jne    80137a <close_all+0xc>
+}
+  80138e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801391:	c9                   	leave
+  801392:	c3                   	ret
+
+00801393 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	57                   	push   %edi
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+  801399:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80139c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 75 08             	push   0x8(%ebp)
+  8013a3:	e8 45 fe ff ff       	call   8011ed <fd_lookup>
+  8013a8:	89 c3                	mov    %eax,%ebx
+  8013aa:	83 c4 10             	add    $0x10,%esp
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	78 7f                	js     801430 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	ff 75 0c             	push   0xc(%ebp)
+  8013b7:	e8 85 ff ff ff       	call   801341 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013bf:	c1 e6 0c             	shl    $0xc,%esi
+  8013c2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013cb:	89 3c 24             	mov    %edi,(%esp)
+  8013ce:	e8 ad fd ff ff       	call   801180 <fd2data>
+  8013d3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013d5:	89 34 24             	mov    %esi,(%esp)
+  8013d8:	e8 a3 fd ff ff       	call   801180 <fd2data>
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013e3:	89 d8                	mov    %ebx,%eax
+  8013e5:	c1 e8 16             	shr    $0x16,%eax
+  8013e8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013ef:	a8 01                	test   $0x1,%al
+  8013f1:	74 11                	je     801404 <dup+0x71>
+  8013f3:	89 d8                	mov    %ebx,%eax
+  8013f5:	c1 e8 0c             	shr    $0xc,%eax
+  8013f8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ff:	f6 c2 01             	test   $0x1,%dl
+  801402:	75 36                	jne    80143a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801404:	89 f8                	mov    %edi,%eax
+  801406:	c1 e8 0c             	shr    $0xc,%eax
+  801409:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	25 07 0e 00 00       	and    $0xe07,%eax
+  801418:	50                   	push   %eax
+  801419:	56                   	push   %esi
+  80141a:	6a 00                	push   $0x0
+  80141c:	57                   	push   %edi
+  80141d:	6a 00                	push   $0x0
+  80141f:	e8 93 f8 ff ff       	call   800cb7 <sys_page_map>
+  801424:	89 c3                	mov    %eax,%ebx
+  801426:	83 c4 20             	add    $0x20,%esp
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	78 33                	js     801460 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80142d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801430:	89 d8                	mov    %ebx,%eax
+  801432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80143a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	25 07 0e 00 00       	and    $0xe07,%eax
+  801449:	50                   	push   %eax
+  80144a:	ff 75 d4             	push   -0x2c(%ebp)
+  80144d:	6a 00                	push   $0x0
+  80144f:	53                   	push   %ebx
+  801450:	6a 00                	push   $0x0
+  801452:	e8 60 f8 ff ff       	call   800cb7 <sys_page_map>
+  801457:	89 c3                	mov    %eax,%ebx
+  801459:	83 c4 20             	add    $0x20,%esp
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	79 a4                	jns    801404 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801460:	83 ec 08             	sub    $0x8,%esp
+  801463:	56                   	push   %esi
+  801464:	6a 00                	push   $0x0
+  801466:	e8 98 f8 ff ff       	call   800d03 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80146b:	83 c4 08             	add    $0x8,%esp
+  80146e:	ff 75 d4             	push   -0x2c(%ebp)
+  801471:	6a 00                	push   $0x0
+  801473:	e8 8b f8 ff ff       	call   800d03 <sys_page_unmap>
+	return r;
+  801478:	83 c4 10             	add    $0x10,%esp
+  80147b:	eb b3                	jmp    801430 <dup+0x9d>
+
+0080147d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+  801482:	83 ec 18             	sub    $0x18,%esp
+  801485:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801488:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80148b:	50                   	push   %eax
+  80148c:	53                   	push   %ebx
+  80148d:	e8 5b fd ff ff       	call   8011ed <fd_lookup>
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	78 3c                	js     8014d5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801499:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80149c:	83 ec 08             	sub    $0x8,%esp
+  80149f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a2:	50                   	push   %eax
+  8014a3:	ff 36                	push   (%esi)
+  8014a5:	e8 93 fd ff ff       	call   80123d <dev_lookup>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	78 24                	js     8014d5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014b1:	8b 46 08             	mov    0x8(%esi),%eax
+  8014b4:	83 e0 03             	and    $0x3,%eax
+  8014b7:	83 f8 01             	cmp    $0x1,%eax
+  8014ba:	74 20                	je     8014dc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014bf:	8b 40 08             	mov    0x8(%eax),%eax
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	74 61                	je     801527 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+  8014c9:	ff 75 10             	push   0x10(%ebp)
+  8014cc:	ff 75 0c             	push   0xc(%ebp)
+  8014cf:	56                   	push   %esi
+  8014d0:	ff d0                	call   *%eax
+  8014d2:	83 c4 10             	add    $0x10,%esp
+}
+  8014d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+  8014dc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014de:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014e4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014e9:	77 18                	ja     801503 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014eb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014f0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014f2:	c1 e8 10             	shr    $0x10,%eax
+  8014f5:	74 0c                	je     801503 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014f7:	c1 e0 10             	shl    $0x10,%eax
+  8014fa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014ff:	29 c2                	sub    %eax,%edx
+  801501:	eb 06                	jmp    801509 <read+0x8c>
+		return pthread_main_tls;
+  801503:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801509:	8b 02                	mov    (%edx),%eax
+  80150b:	8b 40 48             	mov    0x48(%eax),%eax
+  80150e:	83 ec 04             	sub    $0x4,%esp
+  801511:	53                   	push   %ebx
+  801512:	50                   	push   %eax
+  801513:	68 e1 4b 80 00       	push   $0x804be1
+  801518:	e8 2b ed ff ff       	call   800248 <cprintf>
+		return -E_INVAL;
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801525:	eb ae                	jmp    8014d5 <read+0x58>
+		return -E_NOT_SUPP;
+  801527:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80152c:	eb a7                	jmp    8014d5 <read+0x58>
+
+0080152e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	57                   	push   %edi
+  801532:	56                   	push   %esi
+  801533:	53                   	push   %ebx
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80153a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801542:	eb 02                	jmp    801546 <readn+0x18>
+  801544:	01 c3                	add    %eax,%ebx
+  801546:	39 f3                	cmp    %esi,%ebx
+  801548:	73 21                	jae    80156b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80154a:	83 ec 04             	sub    $0x4,%esp
+  80154d:	89 f0                	mov    %esi,%eax
+  80154f:	29 d8                	sub    %ebx,%eax
+  801551:	50                   	push   %eax
+  801552:	89 d8                	mov    %ebx,%eax
+  801554:	03 45 0c             	add    0xc(%ebp),%eax
+  801557:	50                   	push   %eax
+  801558:	57                   	push   %edi
+  801559:	e8 1f ff ff ff       	call   80147d <read>
+		if (m < 0)
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	85 c0                	test   %eax,%eax
+  801563:	78 04                	js     801569 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801565:	75 dd                	jne    801544 <readn+0x16>
+  801567:	eb 02                	jmp    80156b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801569:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80156b:	89 d8                	mov    %ebx,%eax
+  80156d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+
+00801575 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  80157a:	83 ec 18             	sub    $0x18,%esp
+  80157d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801580:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801583:	50                   	push   %eax
+  801584:	53                   	push   %ebx
+  801585:	e8 63 fc ff ff       	call   8011ed <fd_lookup>
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 37                	js     8015c8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801591:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801594:	83 ec 08             	sub    $0x8,%esp
+  801597:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 36                	push   (%esi)
+  80159d:	e8 9b fc ff ff       	call   80123d <dev_lookup>
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	85 c0                	test   %eax,%eax
+  8015a7:	78 1f                	js     8015c8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015a9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ad:	74 20                	je     8015cf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b5:	85 c0                	test   %eax,%eax
+  8015b7:	74 61                	je     80161a <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015b9:	83 ec 04             	sub    $0x4,%esp
+  8015bc:	ff 75 10             	push   0x10(%ebp)
+  8015bf:	ff 75 0c             	push   0xc(%ebp)
+  8015c2:	56                   	push   %esi
+  8015c3:	ff d0                	call   *%eax
+  8015c5:	83 c4 10             	add    $0x10,%esp
+}
+  8015c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cb:	5b                   	pop    %ebx
+  8015cc:	5e                   	pop    %esi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+  8015cf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015d1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015d7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015dc:	77 18                	ja     8015f6 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015de:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015e3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015e5:	c1 e8 10             	shr    $0x10,%eax
+  8015e8:	74 0c                	je     8015f6 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015ea:	c1 e0 10             	shl    $0x10,%eax
+  8015ed:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015f2:	29 c2                	sub    %eax,%edx
+  8015f4:	eb 06                	jmp    8015fc <write+0x87>
+		return pthread_main_tls;
+  8015f6:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015fc:	8b 02                	mov    (%edx),%eax
+  8015fe:	8b 40 48             	mov    0x48(%eax),%eax
+  801601:	83 ec 04             	sub    $0x4,%esp
+  801604:	53                   	push   %ebx
+  801605:	50                   	push   %eax
+  801606:	68 fd 4b 80 00       	push   $0x804bfd
+  80160b:	e8 38 ec ff ff       	call   800248 <cprintf>
+		return -E_INVAL;
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801618:	eb ae                	jmp    8015c8 <write+0x53>
+		return -E_NOT_SUPP;
+  80161a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80161f:	eb a7                	jmp    8015c8 <write+0x53>
+
+00801621 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801627:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162a:	50                   	push   %eax
+  80162b:	ff 75 08             	push   0x8(%ebp)
+  80162e:	e8 ba fb ff ff       	call   8011ed <fd_lookup>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	78 0e                	js     801648 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80163a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801640:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801643:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+
+0080164a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	56                   	push   %esi
+  80164e:	53                   	push   %ebx
+  80164f:	83 ec 18             	sub    $0x18,%esp
+  801652:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801655:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801658:	50                   	push   %eax
+  801659:	53                   	push   %ebx
+  80165a:	e8 8e fb ff ff       	call   8011ed <fd_lookup>
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	85 c0                	test   %eax,%eax
+  801664:	78 34                	js     80169a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801666:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801669:	83 ec 08             	sub    $0x8,%esp
+  80166c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	ff 36                	push   (%esi)
+  801672:	e8 c6 fb ff ff       	call   80123d <dev_lookup>
+  801677:	83 c4 10             	add    $0x10,%esp
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	78 1c                	js     80169a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80167e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801682:	74 1d                	je     8016a1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801687:	8b 40 18             	mov    0x18(%eax),%eax
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	74 5e                	je     8016ec <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	ff 75 0c             	push   0xc(%ebp)
+  801694:	56                   	push   %esi
+  801695:	ff d0                	call   *%eax
+  801697:	83 c4 10             	add    $0x10,%esp
+}
+  80169a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169d:	5b                   	pop    %ebx
+  80169e:	5e                   	pop    %esi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	c3                   	ret
+  8016a1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016a3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016a9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016ae:	77 18                	ja     8016c8 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016b0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016b5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016b7:	c1 e8 10             	shr    $0x10,%eax
+  8016ba:	74 0c                	je     8016c8 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016bc:	c1 e0 10             	shl    $0x10,%eax
+  8016bf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016c4:	29 c2                	sub    %eax,%edx
+  8016c6:	eb 06                	jmp    8016ce <ftruncate+0x84>
+		return pthread_main_tls;
+  8016c8:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8016ce:	8b 02                	mov    (%edx),%eax
+  8016d0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016d3:	83 ec 04             	sub    $0x4,%esp
+  8016d6:	53                   	push   %ebx
+  8016d7:	50                   	push   %eax
+  8016d8:	68 c0 4b 80 00       	push   $0x804bc0
+  8016dd:	e8 66 eb ff ff       	call   800248 <cprintf>
+		return -E_INVAL;
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ea:	eb ae                	jmp    80169a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f1:	eb a7                	jmp    80169a <ftruncate+0x50>
+
+008016f3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 18             	sub    $0x18,%esp
+  8016fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801701:	50                   	push   %eax
+  801702:	ff 75 08             	push   0x8(%ebp)
+  801705:	e8 e3 fa ff ff       	call   8011ed <fd_lookup>
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 49                	js     80175a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801711:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801714:	83 ec 08             	sub    $0x8,%esp
+  801717:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	ff 36                	push   (%esi)
+  80171d:	e8 1b fb ff ff       	call   80123d <dev_lookup>
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	85 c0                	test   %eax,%eax
+  801727:	78 31                	js     80175a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801730:	74 2f                	je     801761 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801732:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801735:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80173c:	00 00 00 
+	stat->st_isdir = 0;
+  80173f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801746:	00 00 00 
+	stat->st_dev = dev;
+  801749:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80174f:	83 ec 08             	sub    $0x8,%esp
+  801752:	53                   	push   %ebx
+  801753:	56                   	push   %esi
+  801754:	ff 50 14             	call   *0x14(%eax)
+  801757:	83 c4 10             	add    $0x10,%esp
+}
+  80175a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175d:	5b                   	pop    %ebx
+  80175e:	5e                   	pop    %esi
+  80175f:	5d                   	pop    %ebp
+  801760:	c3                   	ret
+		return -E_NOT_SUPP;
+  801761:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801766:	eb f2                	jmp    80175a <fstat+0x67>
+
+00801768 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	56                   	push   %esi
+  80176c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80176d:	83 ec 08             	sub    $0x8,%esp
+  801770:	6a 00                	push   $0x0
+  801772:	ff 75 08             	push   0x8(%ebp)
+  801775:	e8 4b 03 00 00       	call   801ac5 <open>
+  80177a:	89 c3                	mov    %eax,%ebx
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 1b                	js     80179e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801783:	83 ec 08             	sub    $0x8,%esp
+  801786:	ff 75 0c             	push   0xc(%ebp)
+  801789:	50                   	push   %eax
+  80178a:	e8 64 ff ff ff       	call   8016f3 <fstat>
+  80178f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801791:	89 1c 24             	mov    %ebx,(%esp)
+  801794:	e8 a8 fb ff ff       	call   801341 <close>
+	return r;
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	89 f3                	mov    %esi,%ebx
+}
+  80179e:	89 d8                	mov    %ebx,%eax
+  8017a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a3:	5b                   	pop    %ebx
+  8017a4:	5e                   	pop    %esi
+  8017a5:	5d                   	pop    %ebp
+  8017a6:	c3                   	ret
+
+008017a7 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+  8017ac:	89 c6                	mov    %eax,%esi
+  8017ae:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017b0:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8017b7:	74 27                	je     8017e0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017b9:	6a 07                	push   $0x7
+  8017bb:	68 00 70 80 00       	push   $0x807000
+  8017c0:	56                   	push   %esi
+  8017c1:	ff 35 00 60 80 00    	push   0x806000
+  8017c7:	e8 4e 2c 00 00       	call   80441a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017cc:	83 c4 0c             	add    $0xc,%esp
+  8017cf:	6a 00                	push   $0x0
+  8017d1:	53                   	push   %ebx
+  8017d2:	6a 00                	push   $0x0
+  8017d4:	e8 4b 2b 00 00       	call   804324 <ipc_recv>
+}
+  8017d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5d                   	pop    %ebp
+  8017df:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017e0:	83 ec 0c             	sub    $0xc,%esp
+  8017e3:	6a 01                	push   $0x1
+  8017e5:	e8 86 2c 00 00       	call   804470 <ipc_find_env>
+  8017ea:	a3 00 60 80 00       	mov    %eax,0x806000
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	eb c5                	jmp    8017b9 <fsipc+0x12>
+
+008017f4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017fb:	68 04 60 80 00       	push   $0x806004
+  801800:	e8 29 1b 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801805:	8b 45 08             	mov    0x8(%ebp),%eax
+  801808:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801810:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801813:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801822:	e8 80 ff ff ff       	call   8017a7 <fsipc>
+  801827:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801829:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801830:	e8 66 1b 00 00       	call   80339b <mutex_unlock>
+	return r;
+}
+  801835:	89 d8                	mov    %ebx,%eax
+  801837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+0080183c <devfile_flush>:
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	53                   	push   %ebx
+  801840:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801843:	68 04 60 80 00       	push   $0x806004
+  801848:	e8 e1 1a 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80184d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801850:	8b 40 0c             	mov    0xc(%eax),%eax
+  801853:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801862:	e8 40 ff ff ff       	call   8017a7 <fsipc>
+  801867:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801869:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801870:	e8 26 1b 00 00       	call   80339b <mutex_unlock>
+}
+  801875:	89 d8                	mov    %ebx,%eax
+  801877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+
+0080187c <devfile_stat>:
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+  801881:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801884:	83 ec 0c             	sub    $0xc,%esp
+  801887:	68 04 60 80 00       	push   $0x806004
+  80188c:	e8 9d 1a 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801891:	8b 45 08             	mov    0x8(%ebp),%eax
+  801894:	8b 40 0c             	mov    0xc(%eax),%eax
+  801897:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80189c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a6:	e8 fc fe ff ff       	call   8017a7 <fsipc>
+  8018ab:	89 c3                	mov    %eax,%ebx
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	79 16                	jns    8018ca <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8018b4:	83 ec 0c             	sub    $0xc,%esp
+  8018b7:	68 04 60 80 00       	push   $0x806004
+  8018bc:	e8 da 1a 00 00       	call   80339b <mutex_unlock>
+}
+  8018c1:	89 d8                	mov    %ebx,%eax
+  8018c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c6:	5b                   	pop    %ebx
+  8018c7:	5e                   	pop    %esi
+  8018c8:	5d                   	pop    %ebp
+  8018c9:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018ca:	83 ec 08             	sub    $0x8,%esp
+  8018cd:	68 00 70 80 00       	push   $0x807000
+  8018d2:	56                   	push   %esi
+  8018d3:	e8 54 ef ff ff       	call   80082c <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8018d8:	a1 80 70 80 00       	mov    0x807080,%eax
+  8018dd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018e3:	a1 84 70 80 00       	mov    0x807084,%eax
+  8018e8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018ee:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f6:	eb bc                	jmp    8018b4 <devfile_stat+0x38>
+
+008018f8 <devfile_write>:
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	53                   	push   %ebx
+  8018fc:	83 ec 10             	sub    $0x10,%esp
+  8018ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801902:	68 04 60 80 00       	push   $0x806004
+  801907:	e8 22 1a 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80190c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801912:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801917:	83 c4 10             	add    $0x10,%esp
+  80191a:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801920:	76 3d                	jbe    80195f <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801922:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801927:	39 c3                	cmp    %eax,%ebx
+  801929:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80192c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192f:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801934:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80193a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801944:	e8 5e fe ff ff       	call   8017a7 <fsipc>
+  801949:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+  80194e:	68 04 60 80 00       	push   $0x806004
+  801953:	e8 43 1a 00 00       	call   80339b <mutex_unlock>
+}
+  801958:	89 d8                	mov    %ebx,%eax
+  80195a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195d:	c9                   	leave
+  80195e:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80195f:	83 ec 04             	sub    $0x4,%esp
+  801962:	53                   	push   %ebx
+  801963:	ff 75 0c             	push   0xc(%ebp)
+  801966:	68 0c 70 80 00       	push   $0x80700c
+  80196b:	e8 42 f0 ff ff       	call   8009b2 <memmove>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	eb b5                	jmp    80192f <devfile_write+0x37>
+
+0080197a <devfile_read>:
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	57                   	push   %edi
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	8b 75 08             	mov    0x8(%ebp),%esi
+  801986:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801989:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80198c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801992:	0f 86 8c 00 00 00    	jbe    801a24 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801998:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80199d:	39 c3                	cmp    %eax,%ebx
+  80199f:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019a2:	89 f8                	mov    %edi,%eax
+  8019a4:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019a7:	eb 0f                	jmp    8019b8 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8019a9:	0f b6 08             	movzbl (%eax),%ecx
+  8019ac:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8019ae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019b3:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019b8:	39 d0                	cmp    %edx,%eax
+  8019ba:	72 ed                	jb     8019a9 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8019bc:	83 ec 0c             	sub    $0xc,%esp
+  8019bf:	68 04 60 80 00       	push   $0x806004
+  8019c4:	e8 65 19 00 00       	call   80332e <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019c9:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019cc:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8019d1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8019d7:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8019dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019e7:	e8 bb fd ff ff       	call   8017a7 <fsipc>
+  8019ec:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019ee:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8019f5:	e8 a1 19 00 00       	call   80339b <mutex_unlock>
+		assert(r <= (int) n);
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	39 f3                	cmp    %esi,%ebx
+  8019ff:	7c 0a                	jl     801a0b <devfile_read+0x91>
+}
+  801a01:	89 f0                	mov    %esi,%eax
+  801a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5f                   	pop    %edi
+  801a09:	5d                   	pop    %ebp
+  801a0a:	c3                   	ret
+		assert(r <= (int) n);
+  801a0b:	68 30 4c 80 00       	push   $0x804c30
+  801a10:	68 3d 4c 80 00       	push   $0x804c3d
+  801a15:	68 90 00 00 00       	push   $0x90
+  801a1a:	68 52 4c 80 00       	push   $0x804c52
+  801a1f:	e8 49 e7 ff ff       	call   80016d <_panic>
+	mutex_lock(&fsipc_mu);
+  801a24:	83 ec 0c             	sub    $0xc,%esp
+  801a27:	68 04 60 80 00       	push   $0x806004
+  801a2c:	e8 fd 18 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a31:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a34:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a39:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801a3f:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801a46:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a53:	e8 4f fd ff ff       	call   8017a7 <fsipc>
+  801a58:	89 c6                	mov    %eax,%esi
+  801a5a:	83 c4 10             	add    $0x10,%esp
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	78 1d                	js     801a7e <devfile_read+0x104>
+		assert(r <= n);
+  801a61:	39 c3                	cmp    %eax,%ebx
+  801a63:	72 2e                	jb     801a93 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a65:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a6a:	7f 40                	jg     801aac <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a6c:	83 ec 04             	sub    $0x4,%esp
+  801a6f:	50                   	push   %eax
+  801a70:	68 00 70 80 00       	push   $0x807000
+  801a75:	57                   	push   %edi
+  801a76:	e8 37 ef ff ff       	call   8009b2 <memmove>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a7e:	83 ec 0c             	sub    $0xc,%esp
+  801a81:	68 04 60 80 00       	push   $0x806004
+  801a86:	e8 10 19 00 00       	call   80339b <mutex_unlock>
+	return r;
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	e9 6e ff ff ff       	jmp    801a01 <devfile_read+0x87>
+		assert(r <= n);
+  801a93:	68 5d 4c 80 00       	push   $0x804c5d
+  801a98:	68 3d 4c 80 00       	push   $0x804c3d
+  801a9d:	68 99 00 00 00       	push   $0x99
+  801aa2:	68 52 4c 80 00       	push   $0x804c52
+  801aa7:	e8 c1 e6 ff ff       	call   80016d <_panic>
+		assert(r <= PGSIZE);
+  801aac:	68 64 4c 80 00       	push   $0x804c64
+  801ab1:	68 3d 4c 80 00       	push   $0x804c3d
+  801ab6:	68 9a 00 00 00       	push   $0x9a
+  801abb:	68 52 4c 80 00       	push   $0x804c52
+  801ac0:	e8 a8 e6 ff ff       	call   80016d <_panic>
+
+00801ac5 <open>:
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	56                   	push   %esi
+  801ac9:	53                   	push   %ebx
+  801aca:	83 ec 1c             	sub    $0x1c,%esp
+  801acd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ad0:	56                   	push   %esi
+  801ad1:	e8 1b ed ff ff       	call   8007f1 <strlen>
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ade:	0f 8f 85 00 00 00    	jg     801b69 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ae4:	83 ec 0c             	sub    $0xc,%esp
+  801ae7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aea:	50                   	push   %eax
+  801aeb:	e8 a7 f6 ff ff       	call   801197 <fd_alloc>
+  801af0:	89 c3                	mov    %eax,%ebx
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	78 55                	js     801b4e <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801af9:	83 ec 0c             	sub    $0xc,%esp
+  801afc:	68 04 60 80 00       	push   $0x806004
+  801b01:	e8 28 18 00 00       	call   80332e <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b06:	83 c4 08             	add    $0x8,%esp
+  801b09:	56                   	push   %esi
+  801b0a:	68 00 70 80 00       	push   $0x807000
+  801b0f:	e8 18 ed ff ff       	call   80082c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b17:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b1c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b24:	e8 7e fc ff ff       	call   8017a7 <fsipc>
+  801b29:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b2b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b32:	e8 64 18 00 00       	call   80339b <mutex_unlock>
+	if (r < 0) {
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	85 db                	test   %ebx,%ebx
+  801b3c:	78 19                	js     801b57 <open+0x92>
+	return fd2num(fd);
+  801b3e:	83 ec 0c             	sub    $0xc,%esp
+  801b41:	ff 75 f4             	push   -0xc(%ebp)
+  801b44:	e8 27 f6 ff ff       	call   801170 <fd2num>
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+}
+  801b4e:	89 d8                	mov    %ebx,%eax
+  801b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b53:	5b                   	pop    %ebx
+  801b54:	5e                   	pop    %esi
+  801b55:	5d                   	pop    %ebp
+  801b56:	c3                   	ret
+		fd_close(fd, 0);
+  801b57:	83 ec 08             	sub    $0x8,%esp
+  801b5a:	6a 00                	push   $0x0
+  801b5c:	ff 75 f4             	push   -0xc(%ebp)
+  801b5f:	e8 56 f7 ff ff       	call   8012ba <fd_close>
+		return r;
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	eb e5                	jmp    801b4e <open+0x89>
+		return -E_BAD_PATH;
+  801b69:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b6e:	eb de                	jmp    801b4e <open+0x89>
+
+00801b70 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	53                   	push   %ebx
+  801b74:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7a:	50                   	push   %eax
+  801b7b:	ff 75 08             	push   0x8(%ebp)
+  801b7e:	e8 6a f6 ff ff       	call   8011ed <fd_lookup>
+  801b83:	89 c3                	mov    %eax,%ebx
+  801b85:	83 c4 10             	add    $0x10,%esp
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 5b                	js     801be7 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b8f:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b95:	39 08                	cmp    %ecx,(%eax)
+  801b97:	75 55                	jne    801bee <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b99:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b9d:	74 56                	je     801bf5 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b9f:	83 ec 0c             	sub    $0xc,%esp
+  801ba2:	68 04 60 80 00       	push   $0x806004
+  801ba7:	e8 82 17 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801baf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801bb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bba:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801bbf:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc2:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801bd1:	e8 d1 fb ff ff       	call   8017a7 <fsipc>
+  801bd6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bd8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801bdf:	e8 b7 17 00 00       	call   80339b <mutex_unlock>
+	return r;
+  801be4:	83 c4 10             	add    $0x10,%esp
+}
+  801be7:	89 d8                	mov    %ebx,%eax
+  801be9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bec:	c9                   	leave
+  801bed:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bee:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801bf3:	eb f2                	jmp    801be7 <fallocate+0x77>
+		return -E_INVAL;
+  801bf5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801bfa:	eb eb                	jmp    801be7 <fallocate+0x77>
+
+00801bfc <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	56                   	push   %esi
+  801c00:	53                   	push   %ebx
+  801c01:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c04:	89 f3                	mov    %esi,%ebx
+  801c06:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c0c:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c0f:	eb 06                	jmp    801c17 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c11:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c17:	39 f3                	cmp    %esi,%ebx
+  801c19:	73 14                	jae    801c2f <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c1b:	83 ec 08             	sub    $0x8,%esp
+  801c1e:	53                   	push   %ebx
+  801c1f:	6a 00                	push   $0x0
+  801c21:	e8 dd f0 ff ff       	call   800d03 <sys_page_unmap>
+  801c26:	83 c4 10             	add    $0x10,%esp
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	79 e4                	jns    801c11 <munmap+0x15>
+  801c2d:	eb 05                	jmp    801c34 <munmap+0x38>
+			return r;
+	return 0;
+  801c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c37:	5b                   	pop    %ebx
+  801c38:	5e                   	pop    %esi
+  801c39:	5d                   	pop    %ebp
+  801c3a:	c3                   	ret
+
+00801c3b <mmap>:
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	57                   	push   %edi
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 24             	sub    $0x24,%esp
+  801c44:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c47:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c4a:	50                   	push   %eax
+  801c4b:	ff 75 08             	push   0x8(%ebp)
+  801c4e:	e8 9a f5 ff ff       	call   8011ed <fd_lookup>
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	0f 88 37 01 00 00    	js     801d95 <mmap+0x15a>
+		return NULL;
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c63:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c66:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c6c:	39 0a                	cmp    %ecx,(%edx)
+  801c6e:	0f 85 05 01 00 00    	jne    801d79 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c74:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c7b:	0f 85 1b 01 00 00    	jne    801d9c <mmap+0x161>
+  801c81:	89 f0                	mov    %esi,%eax
+  801c83:	83 e8 01             	sub    $0x1,%eax
+  801c86:	0f 88 17 01 00 00    	js     801da3 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c8c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c90:	75 28                	jne    801cba <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c92:	83 ec 0c             	sub    $0xc,%esp
+  801c95:	68 04 60 80 00       	push   $0x806004
+  801c9a:	e8 8f 16 00 00       	call   80332e <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c9f:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801ca5:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801cb3:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801cb8:	eb 2b                	jmp    801ce5 <mmap+0xaa>
+		cow_enable();
+  801cba:	e8 f4 21 00 00       	call   803eb3 <cow_enable>
+  801cbf:	eb d1                	jmp    801c92 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801cc1:	89 c2                	mov    %eax,%edx
+  801cc3:	c1 ea 0c             	shr    $0xc,%edx
+  801cc6:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801ccd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801cd3:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801cd9:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801cdc:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801cde:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801ce3:	77 25                	ja     801d0a <mmap+0xcf>
+  801ce5:	89 c2                	mov    %eax,%edx
+  801ce7:	29 da                	sub    %ebx,%edx
+  801ce9:	39 ca                	cmp    %ecx,%edx
+  801ceb:	73 3a                	jae    801d27 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801ced:	89 c2                	mov    %eax,%edx
+  801cef:	c1 ea 16             	shr    $0x16,%edx
+  801cf2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cf9:	f6 c2 01             	test   $0x1,%dl
+  801cfc:	75 c3                	jne    801cc1 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801cfe:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801d03:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801d08:	eb d4                	jmp    801cde <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801d0a:	29 d8                	sub    %ebx,%eax
+  801d0c:	39 c8                	cmp    %ecx,%eax
+  801d0e:	73 17                	jae    801d27 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801d10:	83 ec 0c             	sub    $0xc,%esp
+  801d13:	68 04 60 80 00       	push   $0x806004
+  801d18:	e8 7e 16 00 00       	call   80339b <mutex_unlock>
+		return NULL;
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d25:	eb 52                	jmp    801d79 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d27:	85 db                	test   %ebx,%ebx
+  801d29:	74 e5                	je     801d10 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d31:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801d36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d39:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801d3e:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801d44:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801d4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d4d:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d57:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d5c:	e8 46 fa ff ff       	call   8017a7 <fsipc>
+  801d61:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d63:	83 ec 0c             	sub    $0xc,%esp
+  801d66:	68 04 60 80 00       	push   $0x806004
+  801d6b:	e8 2b 16 00 00       	call   80339b <mutex_unlock>
+	if (r < 0) {
+  801d70:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d73:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d75:	85 ff                	test   %edi,%edi
+  801d77:	78 08                	js     801d81 <mmap+0x146>
+}
+  801d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7c:	5b                   	pop    %ebx
+  801d7d:	5e                   	pop    %esi
+  801d7e:	5f                   	pop    %edi
+  801d7f:	5d                   	pop    %ebp
+  801d80:	c3                   	ret
+		munmap((void*) va, len);
+  801d81:	83 ec 08             	sub    $0x8,%esp
+  801d84:	56                   	push   %esi
+  801d85:	53                   	push   %ebx
+  801d86:	e8 71 fe ff ff       	call   801bfc <munmap>
+		return NULL;
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	eb e4                	jmp    801d79 <mmap+0x13e>
+		return NULL;
+  801d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9a:	eb dd                	jmp    801d79 <mmap+0x13e>
+		return NULL;
+  801d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da1:	eb d6                	jmp    801d79 <mmap+0x13e>
+  801da3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da8:	eb cf                	jmp    801d79 <mmap+0x13e>
+
+00801daa <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+  801dad:	53                   	push   %ebx
+  801dae:	83 ec 10             	sub    $0x10,%esp
+  801db1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801db4:	53                   	push   %ebx
+  801db5:	e8 37 ea ff ff       	call   8007f1 <strlen>
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dc2:	7f 42                	jg     801e06 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	68 04 60 80 00       	push   $0x806004
+  801dcc:	e8 5d 15 00 00       	call   80332e <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dd1:	83 c4 08             	add    $0x8,%esp
+  801dd4:	53                   	push   %ebx
+  801dd5:	68 00 70 80 00       	push   $0x807000
+  801dda:	e8 4d ea ff ff       	call   80082c <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801de9:	e8 b9 f9 ff ff       	call   8017a7 <fsipc>
+  801dee:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801df0:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801df7:	e8 9f 15 00 00       	call   80339b <mutex_unlock>
+	return r;
+  801dfc:	83 c4 10             	add    $0x10,%esp
+}
+  801dff:	89 d8                	mov    %ebx,%eax
+  801e01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+		return -E_BAD_PATH;
+  801e06:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e0b:	eb f2                	jmp    801dff <remove+0x55>
+
+00801e0d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	53                   	push   %ebx
+  801e11:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e14:	68 04 60 80 00       	push   $0x806004
+  801e19:	e8 10 15 00 00       	call   80332e <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e23:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e28:	e8 7a f9 ff ff       	call   8017a7 <fsipc>
+  801e2d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e2f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801e36:	e8 60 15 00 00       	call   80339b <mutex_unlock>
+	return r;
+}
+  801e3b:	89 d8                	mov    %ebx,%eax
+  801e3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e40:	c9                   	leave
+  801e41:	c3                   	ret
+
+00801e42 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e42:	55                   	push   %ebp
+  801e43:	89 e5                	mov    %esp,%ebp
+  801e45:	56                   	push   %esi
+  801e46:	53                   	push   %ebx
+  801e47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+  801e4d:	68 04 60 80 00       	push   $0x806004
+  801e52:	e8 d7 14 00 00       	call   80332e <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e64:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e69:	e8 39 f9 ff ff       	call   8017a7 <fsipc>
+  801e6e:	89 c6                	mov    %eax,%esi
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	85 db                	test   %ebx,%ebx
+  801e75:	74 7b                	je     801ef2 <fs_bcstat+0xb0>
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 77                	js     801ef2 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e7b:	a1 00 70 80 00       	mov    0x807000,%eax
+  801e80:	89 03                	mov    %eax,(%ebx)
+  801e82:	a1 04 70 80 00       	mov    0x807004,%eax
+  801e87:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e8a:	a1 08 70 80 00       	mov    0x807008,%eax
+  801e8f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e92:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e97:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e9a:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e9f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801ea2:	a1 14 70 80 00       	mov    0x807014,%eax
+  801ea7:	89 43 14             	mov    %eax,0x14(%ebx)
+  801eaa:	a1 18 70 80 00       	mov    0x807018,%eax
+  801eaf:	89 43 18             	mov    %eax,0x18(%ebx)
+  801eb2:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801eb7:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801eba:	a1 20 70 80 00       	mov    0x807020,%eax
+  801ebf:	89 43 20             	mov    %eax,0x20(%ebx)
+  801ec2:	a1 24 70 80 00       	mov    0x807024,%eax
+  801ec7:	89 43 24             	mov    %eax,0x24(%ebx)
+  801eca:	a1 28 70 80 00       	mov    0x807028,%eax
+  801ecf:	89 43 28             	mov    %eax,0x28(%ebx)
+  801ed2:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801ed7:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801eda:	a1 30 70 80 00       	mov    0x807030,%eax
+  801edf:	89 43 30             	mov    %eax,0x30(%ebx)
+  801ee2:	a1 34 70 80 00       	mov    0x807034,%eax
+  801ee7:	89 43 34             	mov    %eax,0x34(%ebx)
+  801eea:	a1 38 70 80 00       	mov    0x807038,%eax
+  801eef:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	68 04 60 80 00       	push   $0x806004
+  801efa:	e8 9c 14 00 00       	call   80339b <mutex_unlock>
+	return r;
+}
+  801eff:	89 f0                	mov    %esi,%eax
+  801f01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f04:	5b                   	pop    %ebx
+  801f05:	5e                   	pop    %esi
+  801f06:	5d                   	pop    %ebp
+  801f07:	c3                   	ret
+
+00801f08 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	56                   	push   %esi
+  801f0c:	53                   	push   %ebx
+  801f0d:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801f0f:	0f b6 10             	movzbl (%eax),%edx
+  801f12:	80 fa 72             	cmp    $0x72,%dl
+  801f15:	74 44                	je     801f5b <parse_mode+0x53>
+  801f17:	80 fa 77             	cmp    $0x77,%dl
+  801f1a:	74 4b                	je     801f67 <parse_mode+0x5f>
+  801f1c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f21:	80 fa 61             	cmp    $0x61,%dl
+  801f24:	74 09                	je     801f2f <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801f26:	89 d8                	mov    %ebx,%eax
+  801f28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2b:	5b                   	pop    %ebx
+  801f2c:	5e                   	pop    %esi
+  801f2d:	5d                   	pop    %ebp
+  801f2e:	c3                   	ret
+	switch (mode[0]) {
+  801f2f:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801f34:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801f39:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801f3b:	83 ec 08             	sub    $0x8,%esp
+  801f3e:	6a 2b                	push   $0x2b
+  801f40:	50                   	push   %eax
+  801f41:	e8 f8 e9 ff ff       	call   80093e <strchr>
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	74 d9                	je     801f26 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801f4d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801f50:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f53:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f59:	eb cb                	jmp    801f26 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f5b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f65:	eb d2                	jmp    801f39 <parse_mode+0x31>
+  801f67:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f6c:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f71:	eb c6                	jmp    801f39 <parse_mode+0x31>
+
+00801f73 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f73:	55                   	push   %ebp
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	57                   	push   %edi
+  801f77:	56                   	push   %esi
+  801f78:	53                   	push   %ebx
+  801f79:	83 ec 1c             	sub    $0x1c,%esp
+  801f7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f7f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f82:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f8c:	83 c0 24             	add    $0x24,%eax
+  801f8f:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f93:	74 17                	je     801fac <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f95:	83 c3 01             	add    $0x1,%ebx
+  801f98:	83 fb 10             	cmp    $0x10,%ebx
+  801f9b:	75 ef                	jne    801f8c <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f9d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801fa2:	89 f0                	mov    %esi,%eax
+  801fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa7:	5b                   	pop    %ebx
+  801fa8:	5e                   	pop    %esi
+  801fa9:	5f                   	pop    %edi
+  801faa:	5d                   	pop    %ebp
+  801fab:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801fac:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801fb3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801fb6:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801fb9:	c1 e7 02             	shl    $0x2,%edi
+  801fbc:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801fc2:	83 ec 04             	sub    $0x4,%esp
+  801fc5:	6a 24                	push   $0x24
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	56                   	push   %esi
+  801fca:	e8 ae e9 ff ff       	call   80097d <memset>
+			streams[i].f_fd = fd;
+  801fcf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801fd2:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801fd8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801fdb:	01 d8                	add    %ebx,%eax
+  801fdd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fe0:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	eb b6                	jmp    801fa2 <stream_alloc+0x2f>
+
+00801fec <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	53                   	push   %ebx
+  801ff0:	83 ec 14             	sub    $0x14,%esp
+  801ff3:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801ff5:	8b 40 18             	mov    0x18(%eax),%eax
+  801ff8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801ffb:	74 4a                	je     802047 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ffd:	83 ec 08             	sub    $0x8,%esp
+  802000:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802003:	50                   	push   %eax
+  802004:	ff 33                	push   (%ebx)
+  802006:	e8 e2 f1 ff ff       	call   8011ed <fd_lookup>
+  80200b:	89 c2                	mov    %eax,%edx
+  80200d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802015:	85 d2                	test   %edx,%edx
+  802017:	78 41                	js     80205a <stream_unread+0x6e>
+  802019:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80201c:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802022:	39 0a                	cmp    %ecx,(%edx)
+  802024:	75 34                	jne    80205a <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802026:	8b 43 14             	mov    0x14(%ebx),%eax
+  802029:	03 42 04             	add    0x4(%edx),%eax
+  80202c:	2b 43 18             	sub    0x18(%ebx),%eax
+  80202f:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802032:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802039:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802040:	b8 01 00 00 00       	mov    $0x1,%eax
+  802045:	eb 13                	jmp    80205a <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802047:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80204e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802055:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80205a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+0080205f <stream_drain>:
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80206b:	eb 02                	jmp    80206f <stream_drain+0x10>
+  80206d:	01 c3                	add    %eax,%ebx
+  80206f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802072:	39 c3                	cmp    %eax,%ebx
+  802074:	73 43                	jae    8020b9 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802076:	83 ec 04             	sub    $0x4,%esp
+  802079:	29 d8                	sub    %ebx,%eax
+  80207b:	50                   	push   %eax
+  80207c:	89 d8                	mov    %ebx,%eax
+  80207e:	03 46 0c             	add    0xc(%esi),%eax
+  802081:	50                   	push   %eax
+  802082:	ff 36                	push   (%esi)
+  802084:	e8 ec f4 ff ff       	call   801575 <write>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	7f dd                	jg     80206d <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802090:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802094:	8b 56 0c             	mov    0xc(%esi),%edx
+  802097:	83 ec 04             	sub    $0x4,%esp
+  80209a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80209d:	29 d8                	sub    %ebx,%eax
+  80209f:	50                   	push   %eax
+  8020a0:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8020a3:	50                   	push   %eax
+  8020a4:	52                   	push   %edx
+  8020a5:	e8 08 e9 ff ff       	call   8009b2 <memmove>
+			f->f_wend -= done;
+  8020aa:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020ad:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8020af:	83 c4 10             	add    $0x10,%esp
+  8020b2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8020b7:	eb 0a                	jmp    8020c3 <stream_drain+0x64>
+  8020b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8020be:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8020c3:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8020c6:	89 d0                	mov    %edx,%eax
+  8020c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020cb:	5b                   	pop    %ebx
+  8020cc:	5e                   	pop    %esi
+  8020cd:	5d                   	pop    %ebp
+  8020ce:	c3                   	ret
+
+008020cf <stream_setup>:
+	if (f->f_buf)
+  8020cf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8020d3:	74 01                	je     8020d6 <stream_setup+0x7>
+  8020d5:	c3                   	ret
+{
+  8020d6:	55                   	push   %ebp
+  8020d7:	89 e5                	mov    %esp,%ebp
+  8020d9:	53                   	push   %ebx
+  8020da:	83 ec 04             	sub    $0x4,%esp
+  8020dd:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8020df:	8b 40 08             	mov    0x8(%eax),%eax
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	74 17                	je     8020fd <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8020e6:	83 f8 03             	cmp    $0x3,%eax
+  8020e9:	75 2d                	jne    802118 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8020eb:	8d 43 20             	lea    0x20(%ebx),%eax
+  8020ee:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8020f1:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8020fd:	83 ec 0c             	sub    $0xc,%esp
+  802100:	ff 33                	push   (%ebx)
+  802102:	e8 29 1b 00 00       	call   803c30 <iscons>
+  802107:	83 c4 10             	add    $0x10,%esp
+  80210a:	85 c0                	test   %eax,%eax
+  80210c:	0f 9f c0             	setg   %al
+  80210f:	0f b6 c0             	movzbl %al,%eax
+  802112:	83 c0 01             	add    $0x1,%eax
+  802115:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802118:	83 ec 0c             	sub    $0xc,%esp
+  80211b:	68 00 10 00 00       	push   $0x1000
+  802120:	e8 6e 0b 00 00       	call   802c93 <malloc>
+  802125:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	74 bc                	je     8020eb <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80212f:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802136:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80213a:	eb bc                	jmp    8020f8 <stream_setup+0x29>
+
+0080213c <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	53                   	push   %ebx
+  802140:	83 ec 04             	sub    $0x4,%esp
+  802143:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802145:	e8 85 ff ff ff       	call   8020cf <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80214a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80214f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802153:	74 3d                	je     802192 <stream_fill+0x56>
+  802155:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802159:	74 10                	je     80216b <stream_fill+0x2f>
+  80215b:	89 d8                	mov    %ebx,%eax
+  80215d:	e8 fd fe ff ff       	call   80205f <stream_drain>
+		return 0;
+  802162:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802167:	85 c0                	test   %eax,%eax
+  802169:	78 27                	js     802192 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80216b:	83 ec 04             	sub    $0x4,%esp
+  80216e:	ff 73 10             	push   0x10(%ebx)
+  802171:	ff 73 0c             	push   0xc(%ebx)
+  802174:	ff 33                	push   (%ebx)
+  802176:	e8 02 f3 ff ff       	call   80147d <read>
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	7e 17                	jle    802199 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802182:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802186:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80218d:	89 c2                	mov    %eax,%edx
+  80218f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802192:	89 d0                	mov    %edx,%eax
+  802194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802199:	c1 f8 1f             	sar    $0x1f,%eax
+  80219c:	83 e0 04             	and    $0x4,%eax
+  80219f:	83 c0 04             	add    $0x4,%eax
+  8021a2:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8021a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021aa:	eb e6                	jmp    802192 <stream_fill+0x56>
+
+008021ac <fopen>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	57                   	push   %edi
+  8021b0:	56                   	push   %esi
+  8021b1:	53                   	push   %ebx
+  8021b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8021b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021bb:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8021c1:	89 f0                	mov    %esi,%eax
+  8021c3:	e8 40 fd ff ff       	call   801f08 <parse_mode>
+		return 0;
+  8021c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 2d                	js     8021fe <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	50                   	push   %eax
+  8021d5:	ff 75 08             	push   0x8(%ebp)
+  8021d8:	e8 e8 f8 ff ff       	call   801ac5 <open>
+  8021dd:	89 c7                	mov    %eax,%edi
+  8021df:	83 c4 10             	add    $0x10,%esp
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	78 58                	js     80223e <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021e6:	80 3e 61             	cmpb   $0x61,(%esi)
+  8021e9:	74 1d                	je     802208 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8021eb:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8021f1:	89 f8                	mov    %edi,%eax
+  8021f3:	e8 7b fd ff ff       	call   801f73 <stream_alloc>
+  8021f8:	89 c3                	mov    %eax,%ebx
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	74 32                	je     802230 <fopen+0x84>
+}
+  8021fe:	89 d8                	mov    %ebx,%eax
+  802200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5f                   	pop    %edi
+  802206:	5d                   	pop    %ebp
+  802207:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802208:	83 ec 08             	sub    $0x8,%esp
+  80220b:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802211:	50                   	push   %eax
+  802212:	57                   	push   %edi
+  802213:	e8 db f4 ff ff       	call   8016f3 <fstat>
+  802218:	83 c4 10             	add    $0x10,%esp
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 cc                	js     8021eb <fopen+0x3f>
+		seek(fd, st.st_size);
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	ff 75 dc             	push   -0x24(%ebp)
+  802225:	57                   	push   %edi
+  802226:	e8 f6 f3 ff ff       	call   801621 <seek>
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	eb bb                	jmp    8021eb <fopen+0x3f>
+		close(fd);
+  802230:	83 ec 0c             	sub    $0xc,%esp
+  802233:	57                   	push   %edi
+  802234:	e8 08 f1 ff ff       	call   801341 <close>
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	eb c0                	jmp    8021fe <fopen+0x52>
+		return 0;
+  80223e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802243:	eb b9                	jmp    8021fe <fopen+0x52>
+
+00802245 <fdopen>:
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80224b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80224e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802251:	e8 b2 fc ff ff       	call   801f08 <parse_mode>
+  802256:	89 c2                	mov    %eax,%edx
+		return 0;
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80225d:	85 d2                	test   %edx,%edx
+  80225f:	78 0b                	js     80226c <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802261:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802264:	8b 45 08             	mov    0x8(%ebp),%eax
+  802267:	e8 07 fd ff ff       	call   801f73 <stream_alloc>
+}
+  80226c:	c9                   	leave
+  80226d:	c3                   	ret
+
+0080226e <setvbuf>:
+{
+  80226e:	55                   	push   %ebp
+  80226f:	89 e5                	mov    %esp,%ebp
+  802271:	57                   	push   %edi
+  802272:	56                   	push   %esi
+  802273:	53                   	push   %ebx
+  802274:	8b 45 08             	mov    0x8(%ebp),%eax
+  802277:	8b 55 10             	mov    0x10(%ebp),%edx
+  80227a:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80227d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802281:	75 3a                	jne    8022bd <setvbuf+0x4f>
+  802283:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802286:	83 fe 02             	cmp    $0x2,%esi
+  802289:	77 39                	ja     8022c4 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80228b:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80228e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802292:	0f 95 c3             	setne  %bl
+  802295:	85 ff                	test   %edi,%edi
+  802297:	0f 95 c1             	setne  %cl
+  80229a:	84 cb                	test   %cl,%bl
+  80229c:	74 05                	je     8022a3 <setvbuf+0x35>
+  80229e:	83 fa 03             	cmp    $0x3,%edx
+  8022a1:	75 0a                	jne    8022ad <setvbuf+0x3f>
+	return 0;
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a8:	5b                   	pop    %ebx
+  8022a9:	5e                   	pop    %esi
+  8022aa:	5f                   	pop    %edi
+  8022ab:	5d                   	pop    %ebp
+  8022ac:	c3                   	ret
+		f->f_buf = buf;
+  8022ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b0:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8022b3:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8022b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bb:	eb eb                	jmp    8022a8 <setvbuf+0x3a>
+		return EOF;
+  8022bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022c2:	eb e4                	jmp    8022a8 <setvbuf+0x3a>
+  8022c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022c9:	eb dd                	jmp    8022a8 <setvbuf+0x3a>
+
+008022cb <fflush>:
+{
+  8022cb:	55                   	push   %ebp
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	57                   	push   %edi
+  8022cf:	56                   	push   %esi
+  8022d0:	53                   	push   %ebx
+  8022d1:	83 ec 0c             	sub    $0xc,%esp
+  8022d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8022d7:	85 db                	test   %ebx,%ebx
+  8022d9:	74 1a                	je     8022f5 <fflush+0x2a>
+	stream_unread(f);
+  8022db:	89 d8                	mov    %ebx,%eax
+  8022dd:	e8 0a fd ff ff       	call   801fec <stream_unread>
+	return stream_drain(f);
+  8022e2:	89 d8                	mov    %ebx,%eax
+  8022e4:	e8 76 fd ff ff       	call   80205f <stream_drain>
+  8022e9:	89 c7                	mov    %eax,%edi
+}
+  8022eb:	89 f8                	mov    %edi,%eax
+  8022ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f0:	5b                   	pop    %ebx
+  8022f1:	5e                   	pop    %esi
+  8022f2:	5f                   	pop    %edi
+  8022f3:	5d                   	pop    %ebp
+  8022f4:	c3                   	ret
+  8022f5:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8022fa:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8022ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802304:	eb 03                	jmp    802309 <fflush+0x3e>
+  802306:	83 c3 24             	add    $0x24,%ebx
+  802309:	39 f3                	cmp    %esi,%ebx
+  80230b:	74 de                	je     8022eb <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80230d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802311:	74 f3                	je     802306 <fflush+0x3b>
+  802313:	83 ec 0c             	sub    $0xc,%esp
+  802316:	53                   	push   %ebx
+  802317:	e8 af ff ff ff       	call   8022cb <fflush>
+  80231c:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802326:	0f 48 f8             	cmovs  %eax,%edi
+  802329:	eb db                	jmp    802306 <fflush+0x3b>
+
+0080232b <fclose>:
+{
+  80232b:	55                   	push   %ebp
+  80232c:	89 e5                	mov    %esp,%ebp
+  80232e:	56                   	push   %esi
+  80232f:	53                   	push   %ebx
+  802330:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	56                   	push   %esi
+  802337:	e8 8f ff ff ff       	call   8022cb <fflush>
+  80233c:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80233e:	83 c4 04             	add    $0x4,%esp
+  802341:	ff 36                	push   (%esi)
+  802343:	e8 f9 ef ff ff       	call   801341 <close>
+  802348:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802352:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802355:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802359:	75 10                	jne    80236b <fclose+0x40>
+	f->f_flags = 0;
+  80235b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802362:	89 d8                	mov    %ebx,%eax
+  802364:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802367:	5b                   	pop    %ebx
+  802368:	5e                   	pop    %esi
+  802369:	5d                   	pop    %ebp
+  80236a:	c3                   	ret
+		free(f->f_buf);
+  80236b:	83 ec 0c             	sub    $0xc,%esp
+  80236e:	ff 76 0c             	push   0xc(%esi)
+  802371:	e8 54 08 00 00       	call   802bca <free>
+  802376:	83 c4 10             	add    $0x10,%esp
+  802379:	eb e0                	jmp    80235b <fclose+0x30>
+
+0080237b <fileno>:
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80237e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802381:	8b 00                	mov    (%eax),%eax
+}
+  802383:	5d                   	pop    %ebp
+  802384:	c3                   	ret
+
+00802385 <feof>:
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802388:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238b:	8b 40 04             	mov    0x4(%eax),%eax
+  80238e:	c1 e8 02             	shr    $0x2,%eax
+  802391:	83 e0 01             	and    $0x1,%eax
+}
+  802394:	5d                   	pop    %ebp
+  802395:	c3                   	ret
+
+00802396 <ferror>:
+{
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802399:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239c:	8b 40 04             	mov    0x4(%eax),%eax
+  80239f:	c1 e8 03             	shr    $0x3,%eax
+  8023a2:	83 e0 01             	and    $0x1,%eax
+}
+  8023a5:	5d                   	pop    %ebp
+  8023a6:	c3                   	ret
+
+008023a7 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	53                   	push   %ebx
+  8023ab:	83 ec 04             	sub    $0x4,%esp
+  8023ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023b1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8023b4:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8023b7:	74 15                	je     8023ce <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8023b9:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8023bc:	8b 43 14             	mov    0x14(%ebx),%eax
+  8023bf:	8d 48 01             	lea    0x1(%eax),%ecx
+  8023c2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8023c5:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8023c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023ce:	89 d8                	mov    %ebx,%eax
+  8023d0:	e8 67 fd ff ff       	call   80213c <stream_fill>
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	75 e0                	jne    8023b9 <fgetc+0x12>
+		return EOF;
+  8023d9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023de:	eb e9                	jmp    8023c9 <fgetc+0x22>
+
+008023e0 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8023e0:	55                   	push   %ebp
+  8023e1:	89 e5                	mov    %esp,%ebp
+  8023e3:	57                   	push   %edi
+  8023e4:	56                   	push   %esi
+  8023e5:	53                   	push   %ebx
+  8023e6:	83 ec 1c             	sub    $0x1c,%esp
+  8023e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8023ec:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f4:	83 e8 01             	sub    $0x1,%eax
+  8023f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8023fa:	eb 66                	jmp    802462 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023fc:	8b 46 14             	mov    0x14(%esi),%eax
+  8023ff:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802402:	29 c3                	sub    %eax,%ebx
+  802404:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802407:	29 fa                	sub    %edi,%edx
+  802409:	39 d3                	cmp    %edx,%ebx
+  80240b:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80240e:	83 ec 04             	sub    $0x4,%esp
+  802411:	53                   	push   %ebx
+  802412:	6a 0a                	push   $0xa
+  802414:	03 46 0c             	add    0xc(%esi),%eax
+  802417:	50                   	push   %eax
+  802418:	e8 46 e6 ff ff       	call   800a63 <memfind>
+  80241d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802420:	8b 46 0c             	mov    0xc(%esi),%eax
+  802423:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802426:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802429:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802431:	74 0b                	je     80243e <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802433:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802436:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802439:	29 d3                	sub    %edx,%ebx
+  80243b:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80243e:	83 ec 04             	sub    $0x4,%esp
+  802441:	53                   	push   %ebx
+  802442:	01 c8                	add    %ecx,%eax
+  802444:	50                   	push   %eax
+  802445:	89 f8                	mov    %edi,%eax
+  802447:	03 45 08             	add    0x8(%ebp),%eax
+  80244a:	50                   	push   %eax
+  80244b:	e8 62 e5 ff ff       	call   8009b2 <memmove>
+		f->f_rpos += m;
+  802450:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802453:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245b:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802460:	74 1f                	je     802481 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802462:	8d 47 01             	lea    0x1(%edi),%eax
+  802465:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802468:	73 17                	jae    802481 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80246a:	8b 46 18             	mov    0x18(%esi),%eax
+  80246d:	39 46 14             	cmp    %eax,0x14(%esi)
+  802470:	75 8a                	jne    8023fc <fgets+0x1c>
+  802472:	89 f0                	mov    %esi,%eax
+  802474:	e8 c3 fc ff ff       	call   80213c <stream_fill>
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	0f 85 7b ff ff ff    	jne    8023fc <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802481:	85 ff                	test   %edi,%edi
+  802483:	74 0f                	je     802494 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802485:	8b 45 08             	mov    0x8(%ebp),%eax
+  802488:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80248c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248f:	5b                   	pop    %ebx
+  802490:	5e                   	pop    %esi
+  802491:	5f                   	pop    %edi
+  802492:	5d                   	pop    %ebp
+  802493:	c3                   	ret
+		return 0;
+  802494:	b8 00 00 00 00       	mov    $0x0,%eax
+  802499:	eb f1                	jmp    80248c <fgets+0xac>
+
+0080249b <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80249b:	55                   	push   %ebp
+  80249c:	89 e5                	mov    %esp,%ebp
+  80249e:	57                   	push   %edi
+  80249f:	56                   	push   %esi
+  8024a0:	53                   	push   %ebx
+  8024a1:	83 ec 1c             	sub    $0x1c,%esp
+  8024a4:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8024a7:	89 f0                	mov    %esi,%eax
+  8024a9:	e8 21 fc ff ff       	call   8020cf <stream_setup>
+	want = size * n;
+  8024ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b1:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8024b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8024b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024bd:	eb 43                	jmp    802502 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8024bf:	29 d3                	sub    %edx,%ebx
+  8024c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024c4:	29 f8                	sub    %edi,%eax
+  8024c6:	39 c3                	cmp    %eax,%ebx
+  8024c8:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8024cb:	83 ec 04             	sub    $0x4,%esp
+  8024ce:	53                   	push   %ebx
+  8024cf:	03 56 0c             	add    0xc(%esi),%edx
+  8024d2:	52                   	push   %edx
+  8024d3:	89 f8                	mov    %edi,%eax
+  8024d5:	03 45 08             	add    0x8(%ebp),%eax
+  8024d8:	50                   	push   %eax
+  8024d9:	e8 d4 e4 ff ff       	call   8009b2 <memmove>
+			f->f_rpos += m;
+  8024de:	01 5e 14             	add    %ebx,0x14(%esi)
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	eb 1a                	jmp    802500 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8024e6:	83 ec 04             	sub    $0x4,%esp
+  8024e9:	53                   	push   %ebx
+  8024ea:	89 f8                	mov    %edi,%eax
+  8024ec:	03 45 08             	add    0x8(%ebp),%eax
+  8024ef:	50                   	push   %eax
+  8024f0:	ff 36                	push   (%esi)
+  8024f2:	e8 86 ef ff ff       	call   80147d <read>
+  8024f7:	89 c3                	mov    %eax,%ebx
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	7e 36                	jle    802536 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802500:	01 df                	add    %ebx,%edi
+  802502:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802505:	39 c7                	cmp    %eax,%edi
+  802507:	73 39                	jae    802542 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802509:	8b 56 14             	mov    0x14(%esi),%edx
+  80250c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80250f:	39 da                	cmp    %ebx,%edx
+  802511:	72 ac                	jb     8024bf <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802513:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802516:	29 fb                	sub    %edi,%ebx
+  802518:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80251b:	72 3e                	jb     80255b <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80251d:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802521:	74 1f                	je     802542 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802523:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802527:	74 bd                	je     8024e6 <fread+0x4b>
+  802529:	89 f0                	mov    %esi,%eax
+  80252b:	e8 2f fb ff ff       	call   80205f <stream_drain>
+  802530:	85 c0                	test   %eax,%eax
+  802532:	79 b2                	jns    8024e6 <fread+0x4b>
+  802534:	eb 0c                	jmp    802542 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802536:	c1 fb 1f             	sar    $0x1f,%ebx
+  802539:	83 e3 04             	and    $0x4,%ebx
+  80253c:	83 c3 04             	add    $0x4,%ebx
+  80253f:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802542:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802545:	85 c0                	test   %eax,%eax
+  802547:	74 0a                	je     802553 <fread+0xb8>
+  802549:	89 f8                	mov    %edi,%eax
+  80254b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802550:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5f                   	pop    %edi
+  802559:	5d                   	pop    %ebp
+  80255a:	c3                   	ret
+		} else if (!stream_fill(f))
+  80255b:	89 f0                	mov    %esi,%eax
+  80255d:	e8 da fb ff ff       	call   80213c <stream_fill>
+  802562:	85 c0                	test   %eax,%eax
+  802564:	74 dc                	je     802542 <fread+0xa7>
+			m = 0;
+  802566:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80256b:	eb 93                	jmp    802500 <fread+0x65>
+
+0080256d <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	57                   	push   %edi
+  802571:	56                   	push   %esi
+  802572:	53                   	push   %ebx
+  802573:	83 ec 1c             	sub    $0x1c,%esp
+  802576:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802579:	8b 43 04             	mov    0x4(%ebx),%eax
+  80257c:	a8 02                	test   $0x2,%al
+  80257e:	75 13                	jne    802593 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802580:	83 c8 08             	or     $0x8,%eax
+  802583:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802586:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80258b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258e:	5b                   	pop    %ebx
+  80258f:	5e                   	pop    %esi
+  802590:	5f                   	pop    %edi
+  802591:	5d                   	pop    %ebp
+  802592:	c3                   	ret
+	stream_setup(f);
+  802593:	89 d8                	mov    %ebx,%eax
+  802595:	e8 35 fb ff ff       	call   8020cf <stream_setup>
+	want = size * n;
+  80259a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8025a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8025a4:	89 d8                	mov    %ebx,%eax
+  8025a6:	e8 41 fa ff ff       	call   801fec <stream_unread>
+	for (done = 0; done < want; ) {
+  8025ab:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8025b0:	84 c0                	test   %al,%al
+  8025b2:	75 7b                	jne    80262f <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8025b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025bc:	39 fe                	cmp    %edi,%esi
+  8025be:	73 24                	jae    8025e4 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025c0:	83 ec 04             	sub    $0x4,%esp
+  8025c3:	89 f8                	mov    %edi,%eax
+  8025c5:	29 f0                	sub    %esi,%eax
+  8025c7:	50                   	push   %eax
+  8025c8:	89 f0                	mov    %esi,%eax
+  8025ca:	03 45 08             	add    0x8(%ebp),%eax
+  8025cd:	50                   	push   %eax
+  8025ce:	ff 33                	push   (%ebx)
+  8025d0:	e8 a0 ef ff ff       	call   801575 <write>
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	7e 04                	jle    8025e0 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8025dc:	01 c6                	add    %eax,%esi
+  8025de:	eb dc                	jmp    8025bc <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8025e0:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8025e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	74 a0                	je     80258b <fwrite+0x1e>
+  8025eb:	89 f0                	mov    %esi,%eax
+  8025ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f2:	f7 75 0c             	divl   0xc(%ebp)
+  8025f5:	eb 94                	jmp    80258b <fwrite+0x1e>
+			done += r;
+  8025f7:	01 c7                	add    %eax,%edi
+			continue;
+  8025f9:	eb 34                	jmp    80262f <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8025fb:	8b 73 10             	mov    0x10(%ebx),%esi
+  8025fe:	29 c6                	sub    %eax,%esi
+  802600:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802603:	29 fa                	sub    %edi,%edx
+  802605:	39 d6                	cmp    %edx,%esi
+  802607:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80260a:	83 ec 04             	sub    $0x4,%esp
+  80260d:	56                   	push   %esi
+  80260e:	89 fa                	mov    %edi,%edx
+  802610:	03 55 08             	add    0x8(%ebp),%edx
+  802613:	52                   	push   %edx
+  802614:	03 43 0c             	add    0xc(%ebx),%eax
+  802617:	50                   	push   %eax
+  802618:	e8 95 e3 ff ff       	call   8009b2 <memmove>
+		f->f_wend += m;
+  80261d:	89 f0                	mov    %esi,%eax
+  80261f:	03 43 1c             	add    0x1c(%ebx),%eax
+  802622:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802625:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802627:	83 c4 10             	add    $0x10,%esp
+  80262a:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80262d:	74 5b                	je     80268a <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80262f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802632:	39 c7                	cmp    %eax,%edi
+  802634:	73 2d                	jae    802663 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802636:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802639:	85 c0                	test   %eax,%eax
+  80263b:	75 be                	jne    8025fb <fwrite+0x8e>
+  80263d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802640:	29 fa                	sub    %edi,%edx
+  802642:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802645:	72 b4                	jb     8025fb <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802647:	83 ec 04             	sub    $0x4,%esp
+  80264a:	52                   	push   %edx
+  80264b:	89 f8                	mov    %edi,%eax
+  80264d:	03 45 08             	add    0x8(%ebp),%eax
+  802650:	50                   	push   %eax
+  802651:	ff 33                	push   (%ebx)
+  802653:	e8 1d ef ff ff       	call   801575 <write>
+  802658:	83 c4 10             	add    $0x10,%esp
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	7f 98                	jg     8025f7 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80265f:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802663:	8b 43 08             	mov    0x8(%ebx),%eax
+  802666:	83 f8 03             	cmp    $0x3,%eax
+  802669:	74 48                	je     8026b3 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80266b:	83 f8 02             	cmp    $0x2,%eax
+  80266e:	74 27                	je     802697 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802670:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802673:	85 c0                	test   %eax,%eax
+  802675:	0f 84 10 ff ff ff    	je     80258b <fwrite+0x1e>
+  80267b:	89 f8                	mov    %edi,%eax
+  80267d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802682:	f7 75 0c             	divl   0xc(%ebp)
+  802685:	e9 01 ff ff ff       	jmp    80258b <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80268a:	89 d8                	mov    %ebx,%eax
+  80268c:	e8 ce f9 ff ff       	call   80205f <stream_drain>
+  802691:	85 c0                	test   %eax,%eax
+  802693:	79 9a                	jns    80262f <fwrite+0xc2>
+  802695:	eb cc                	jmp    802663 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802697:	83 ec 04             	sub    $0x4,%esp
+  80269a:	57                   	push   %edi
+  80269b:	6a 0a                	push   $0xa
+  80269d:	ff 75 08             	push   0x8(%ebp)
+  8026a0:	e8 be e3 ff ff       	call   800a63 <memfind>
+  8026a5:	89 c2                	mov    %eax,%edx
+  8026a7:	89 f8                	mov    %edi,%eax
+  8026a9:	03 45 08             	add    0x8(%ebp),%eax
+  8026ac:	83 c4 10             	add    $0x10,%esp
+  8026af:	39 c2                	cmp    %eax,%edx
+  8026b1:	74 bd                	je     802670 <fwrite+0x103>
+		stream_drain(f);
+  8026b3:	89 d8                	mov    %ebx,%eax
+  8026b5:	e8 a5 f9 ff ff       	call   80205f <stream_drain>
+  8026ba:	eb b4                	jmp    802670 <fwrite+0x103>
+
+008026bc <fputc>:
+{
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	53                   	push   %ebx
+  8026c0:	83 ec 14             	sub    $0x14,%esp
+  8026c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8026c6:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8026c9:	ff 75 0c             	push   0xc(%ebp)
+  8026cc:	6a 01                	push   $0x1
+  8026ce:	6a 01                	push   $0x1
+  8026d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	e8 94 fe ff ff       	call   80256d <fwrite>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	0f b6 db             	movzbl %bl,%ebx
+  8026df:	83 f8 01             	cmp    $0x1,%eax
+  8026e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026e7:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8026ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+
+008026ef <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026f5:	ff 75 0c             	push   0xc(%ebp)
+  8026f8:	ff 75 08             	push   0x8(%ebp)
+  8026fb:	e8 bc ff ff ff       	call   8026bc <fputc>
+}
+  802700:	83 c4 10             	add    $0x10,%esp
+  802703:	c9                   	leave
+  802704:	c3                   	ret
+
+00802705 <fputs>:
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	56                   	push   %esi
+  802709:	53                   	push   %ebx
+  80270a:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80270d:	83 ec 0c             	sub    $0xc,%esp
+  802710:	56                   	push   %esi
+  802711:	e8 db e0 ff ff       	call   8007f1 <strlen>
+  802716:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802718:	ff 75 0c             	push   0xc(%ebp)
+  80271b:	50                   	push   %eax
+  80271c:	6a 01                	push   $0x1
+  80271e:	56                   	push   %esi
+  80271f:	e8 49 fe ff ff       	call   80256d <fwrite>
+  802724:	83 c4 20             	add    $0x20,%esp
+  802727:	39 d8                	cmp    %ebx,%eax
+  802729:	0f 95 c0             	setne  %al
+  80272c:	0f b6 c0             	movzbl %al,%eax
+  80272f:	f7 d8                	neg    %eax
+}
+  802731:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802734:	5b                   	pop    %ebx
+  802735:	5e                   	pop    %esi
+  802736:	5d                   	pop    %ebp
+  802737:	c3                   	ret
+
+00802738 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	53                   	push   %ebx
+  80273c:	83 ec 04             	sub    $0x4,%esp
+  80273f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802742:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802745:	50                   	push   %eax
+  802746:	ff 75 0c             	push   0xc(%ebp)
+  802749:	53                   	push   %ebx
+  80274a:	68 ef 26 80 00       	push   $0x8026ef
+  80274f:	e8 eb db ff ff       	call   80033f <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802754:	8b 43 04             	mov    0x4(%ebx),%eax
+  802757:	c1 e0 1c             	shl    $0x1c,%eax
+  80275a:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80275d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802760:	c9                   	leave
+  802761:	c3                   	ret
+
+00802762 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802768:	68 78 4c 80 00       	push   $0x804c78
+  80276d:	ff 75 0c             	push   0xc(%ebp)
+  802770:	e8 b7 e0 ff ff       	call   80082c <strcpy>
+	return 0;
+}
+  802775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+
+0080277c <devsock_close>:
+{
+  80277c:	55                   	push   %ebp
+  80277d:	89 e5                	mov    %esp,%ebp
+  80277f:	53                   	push   %ebx
+  802780:	83 ec 10             	sub    $0x10,%esp
+  802783:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802786:	53                   	push   %ebx
+  802787:	e8 23 1d 00 00       	call   8044af <pageref>
+  80278c:	89 c2                	mov    %eax,%edx
+  80278e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802796:	83 fa 01             	cmp    $0x1,%edx
+  802799:	74 05                	je     8027a0 <devsock_close+0x24>
+}
+  80279b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027a0:	83 ec 0c             	sub    $0xc,%esp
+  8027a3:	ff 73 0c             	push   0xc(%ebx)
+  8027a6:	e8 b7 02 00 00       	call   802a62 <nsipc_close>
+  8027ab:	83 c4 10             	add    $0x10,%esp
+  8027ae:	eb eb                	jmp    80279b <devsock_close+0x1f>
+
+008027b0 <devsock_write>:
+{
+  8027b0:	55                   	push   %ebp
+  8027b1:	89 e5                	mov    %esp,%ebp
+  8027b3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	ff 75 10             	push   0x10(%ebp)
+  8027bb:	ff 75 0c             	push   0xc(%ebp)
+  8027be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c1:	ff 70 0c             	push   0xc(%eax)
+  8027c4:	e8 79 03 00 00       	call   802b42 <nsipc_send>
+}
+  8027c9:	c9                   	leave
+  8027ca:	c3                   	ret
+
+008027cb <devsock_read>:
+{
+  8027cb:	55                   	push   %ebp
+  8027cc:	89 e5                	mov    %esp,%ebp
+  8027ce:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027d1:	6a 00                	push   $0x0
+  8027d3:	ff 75 10             	push   0x10(%ebp)
+  8027d6:	ff 75 0c             	push   0xc(%ebp)
+  8027d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027dc:	ff 70 0c             	push   0xc(%eax)
+  8027df:	e8 ef 02 00 00       	call   802ad3 <nsipc_recv>
+}
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+008027e6 <fd2sockid>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027ec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027ef:	52                   	push   %edx
+  8027f0:	50                   	push   %eax
+  8027f1:	e8 f7 e9 ff ff       	call   8011ed <fd_lookup>
+  8027f6:	83 c4 10             	add    $0x10,%esp
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	78 10                	js     80280d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802800:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802806:	39 08                	cmp    %ecx,(%eax)
+  802808:	75 05                	jne    80280f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80280a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80280f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802814:	eb f7                	jmp    80280d <fd2sockid+0x27>
+
+00802816 <alloc_sockfd>:
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	56                   	push   %esi
+  80281a:	53                   	push   %ebx
+  80281b:	83 ec 1c             	sub    $0x1c,%esp
+  80281e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802820:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802823:	50                   	push   %eax
+  802824:	e8 6e e9 ff ff       	call   801197 <fd_alloc>
+  802829:	89 c3                	mov    %eax,%ebx
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	78 43                	js     802875 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802832:	83 ec 04             	sub    $0x4,%esp
+  802835:	68 07 04 00 00       	push   $0x407
+  80283a:	ff 75 f4             	push   -0xc(%ebp)
+  80283d:	6a 00                	push   $0x0
+  80283f:	e8 26 e4 ff ff       	call   800c6a <sys_page_alloc>
+  802844:	89 c3                	mov    %eax,%ebx
+  802846:	83 c4 10             	add    $0x10,%esp
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	78 28                	js     802875 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80284d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802850:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802856:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80285b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802862:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802865:	83 ec 0c             	sub    $0xc,%esp
+  802868:	50                   	push   %eax
+  802869:	e8 02 e9 ff ff       	call   801170 <fd2num>
+  80286e:	89 c3                	mov    %eax,%ebx
+  802870:	83 c4 10             	add    $0x10,%esp
+  802873:	eb 0c                	jmp    802881 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802875:	83 ec 0c             	sub    $0xc,%esp
+  802878:	56                   	push   %esi
+  802879:	e8 e4 01 00 00       	call   802a62 <nsipc_close>
+		return r;
+  80287e:	83 c4 10             	add    $0x10,%esp
+}
+  802881:	89 d8                	mov    %ebx,%eax
+  802883:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802886:	5b                   	pop    %ebx
+  802887:	5e                   	pop    %esi
+  802888:	5d                   	pop    %ebp
+  802889:	c3                   	ret
+
+0080288a <accept>:
+{
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802890:	8b 45 08             	mov    0x8(%ebp),%eax
+  802893:	e8 4e ff ff ff       	call   8027e6 <fd2sockid>
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	78 1b                	js     8028b7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80289c:	83 ec 04             	sub    $0x4,%esp
+  80289f:	ff 75 10             	push   0x10(%ebp)
+  8028a2:	ff 75 0c             	push   0xc(%ebp)
+  8028a5:	50                   	push   %eax
+  8028a6:	e8 0e 01 00 00       	call   8029b9 <nsipc_accept>
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	85 c0                	test   %eax,%eax
+  8028b0:	78 05                	js     8028b7 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028b2:	e8 5f ff ff ff       	call   802816 <alloc_sockfd>
+}
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+
+008028b9 <bind>:
+{
+  8028b9:	55                   	push   %ebp
+  8028ba:	89 e5                	mov    %esp,%ebp
+  8028bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c2:	e8 1f ff ff ff       	call   8027e6 <fd2sockid>
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	78 12                	js     8028dd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028cb:	83 ec 04             	sub    $0x4,%esp
+  8028ce:	ff 75 10             	push   0x10(%ebp)
+  8028d1:	ff 75 0c             	push   0xc(%ebp)
+  8028d4:	50                   	push   %eax
+  8028d5:	e8 31 01 00 00       	call   802a0b <nsipc_bind>
+  8028da:	83 c4 10             	add    $0x10,%esp
+}
+  8028dd:	c9                   	leave
+  8028de:	c3                   	ret
+
+008028df <shutdown>:
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e8:	e8 f9 fe ff ff       	call   8027e6 <fd2sockid>
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	78 0f                	js     802900 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028f1:	83 ec 08             	sub    $0x8,%esp
+  8028f4:	ff 75 0c             	push   0xc(%ebp)
+  8028f7:	50                   	push   %eax
+  8028f8:	e8 43 01 00 00       	call   802a40 <nsipc_shutdown>
+  8028fd:	83 c4 10             	add    $0x10,%esp
+}
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+
+00802902 <connect>:
+{
+  802902:	55                   	push   %ebp
+  802903:	89 e5                	mov    %esp,%ebp
+  802905:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290b:	e8 d6 fe ff ff       	call   8027e6 <fd2sockid>
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 12                	js     802926 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802914:	83 ec 04             	sub    $0x4,%esp
+  802917:	ff 75 10             	push   0x10(%ebp)
+  80291a:	ff 75 0c             	push   0xc(%ebp)
+  80291d:	50                   	push   %eax
+  80291e:	e8 59 01 00 00       	call   802a7c <nsipc_connect>
+  802923:	83 c4 10             	add    $0x10,%esp
+}
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+00802928 <listen>:
+{
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80292e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802931:	e8 b0 fe ff ff       	call   8027e6 <fd2sockid>
+  802936:	85 c0                	test   %eax,%eax
+  802938:	78 0f                	js     802949 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80293a:	83 ec 08             	sub    $0x8,%esp
+  80293d:	ff 75 0c             	push   0xc(%ebp)
+  802940:	50                   	push   %eax
+  802941:	e8 6b 01 00 00       	call   802ab1 <nsipc_listen>
+  802946:	83 c4 10             	add    $0x10,%esp
+}
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+0080294b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802951:	ff 75 10             	push   0x10(%ebp)
+  802954:	ff 75 0c             	push   0xc(%ebp)
+  802957:	ff 75 08             	push   0x8(%ebp)
+  80295a:	e8 41 02 00 00       	call   802ba0 <nsipc_socket>
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 05                	js     80296b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802966:	e8 ab fe ff ff       	call   802816 <alloc_sockfd>
+}
+  80296b:	c9                   	leave
+  80296c:	c3                   	ret
+
+0080296d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80296d:	55                   	push   %ebp
+  80296e:	89 e5                	mov    %esp,%ebp
+  802970:	53                   	push   %ebx
+  802971:	83 ec 04             	sub    $0x4,%esp
+  802974:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802976:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80297d:	74 26                	je     8029a5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80297f:	6a 07                	push   $0x7
+  802981:	68 00 80 80 00       	push   $0x808000
+  802986:	53                   	push   %ebx
+  802987:	ff 35 08 60 80 00    	push   0x806008
+  80298d:	e8 88 1a 00 00       	call   80441a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802992:	83 c4 0c             	add    $0xc,%esp
+  802995:	6a 00                	push   $0x0
+  802997:	6a 00                	push   $0x0
+  802999:	6a 00                	push   $0x0
+  80299b:	e8 84 19 00 00       	call   804324 <ipc_recv>
+}
+  8029a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a3:	c9                   	leave
+  8029a4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029a5:	83 ec 0c             	sub    $0xc,%esp
+  8029a8:	6a 02                	push   $0x2
+  8029aa:	e8 c1 1a 00 00       	call   804470 <ipc_find_env>
+  8029af:	a3 08 60 80 00       	mov    %eax,0x806008
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  8029b7:	eb c6                	jmp    80297f <nsipc+0x12>
+
+008029b9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029b9:	55                   	push   %ebp
+  8029ba:	89 e5                	mov    %esp,%ebp
+  8029bc:	56                   	push   %esi
+  8029bd:	53                   	push   %ebx
+  8029be:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8029c9:	8b 06                	mov    (%esi),%eax
+  8029cb:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029d5:	e8 93 ff ff ff       	call   80296d <nsipc>
+  8029da:	89 c3                	mov    %eax,%ebx
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	79 09                	jns    8029e9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029e0:	89 d8                	mov    %ebx,%eax
+  8029e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029e5:	5b                   	pop    %ebx
+  8029e6:	5e                   	pop    %esi
+  8029e7:	5d                   	pop    %ebp
+  8029e8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029e9:	83 ec 04             	sub    $0x4,%esp
+  8029ec:	ff 35 10 80 80 00    	push   0x808010
+  8029f2:	68 00 80 80 00       	push   $0x808000
+  8029f7:	ff 75 0c             	push   0xc(%ebp)
+  8029fa:	e8 b3 df ff ff       	call   8009b2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029ff:	a1 10 80 80 00       	mov    0x808010,%eax
+  802a04:	89 06                	mov    %eax,(%esi)
+  802a06:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a09:	eb d5                	jmp    8029e0 <nsipc_accept+0x27>
+
+00802a0b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	53                   	push   %ebx
+  802a0f:	83 ec 08             	sub    $0x8,%esp
+  802a12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a18:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a1d:	53                   	push   %ebx
+  802a1e:	ff 75 0c             	push   0xc(%ebp)
+  802a21:	68 04 80 80 00       	push   $0x808004
+  802a26:	e8 87 df ff ff       	call   8009b2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a2b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a31:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a36:	e8 32 ff ff ff       	call   80296d <nsipc>
+}
+  802a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3e:	c9                   	leave
+  802a3f:	c3                   	ret
+
+00802a40 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a40:	55                   	push   %ebp
+  802a41:	89 e5                	mov    %esp,%ebp
+  802a43:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a49:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a51:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a56:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a5b:	e8 0d ff ff ff       	call   80296d <nsipc>
+}
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+00802a62 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a70:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a75:	e8 f3 fe ff ff       	call   80296d <nsipc>
+}
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+
+00802a7c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a7c:	55                   	push   %ebp
+  802a7d:	89 e5                	mov    %esp,%ebp
+  802a7f:	53                   	push   %ebx
+  802a80:	83 ec 08             	sub    $0x8,%esp
+  802a83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a89:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a8e:	53                   	push   %ebx
+  802a8f:	ff 75 0c             	push   0xc(%ebp)
+  802a92:	68 04 80 80 00       	push   $0x808004
+  802a97:	e8 16 df ff ff       	call   8009b2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a9c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802aa2:	b8 05 00 00 00       	mov    $0x5,%eax
+  802aa7:	e8 c1 fe ff ff       	call   80296d <nsipc>
+}
+  802aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aaf:	c9                   	leave
+  802ab0:	c3                   	ret
+
+00802ab1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aba:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802abf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ac2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ac7:	b8 06 00 00 00       	mov    $0x6,%eax
+  802acc:	e8 9c fe ff ff       	call   80296d <nsipc>
+}
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+
+00802ad3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	56                   	push   %esi
+  802ad7:	53                   	push   %ebx
+  802ad8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802adb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ade:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802ae3:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802ae9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aec:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802af1:	b8 07 00 00 00       	mov    $0x7,%eax
+  802af6:	e8 72 fe ff ff       	call   80296d <nsipc>
+  802afb:	89 c3                	mov    %eax,%ebx
+  802afd:	85 c0                	test   %eax,%eax
+  802aff:	78 22                	js     802b23 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b01:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b06:	39 c6                	cmp    %eax,%esi
+  802b08:	0f 4e c6             	cmovle %esi,%eax
+  802b0b:	39 c3                	cmp    %eax,%ebx
+  802b0d:	7f 1d                	jg     802b2c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b0f:	83 ec 04             	sub    $0x4,%esp
+  802b12:	53                   	push   %ebx
+  802b13:	68 00 80 80 00       	push   $0x808000
+  802b18:	ff 75 0c             	push   0xc(%ebp)
+  802b1b:	e8 92 de ff ff       	call   8009b2 <memmove>
+  802b20:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b23:	89 d8                	mov    %ebx,%eax
+  802b25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b28:	5b                   	pop    %ebx
+  802b29:	5e                   	pop    %esi
+  802b2a:	5d                   	pop    %ebp
+  802b2b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b2c:	68 84 4c 80 00       	push   $0x804c84
+  802b31:	68 3d 4c 80 00       	push   $0x804c3d
+  802b36:	6a 62                	push   $0x62
+  802b38:	68 99 4c 80 00       	push   $0x804c99
+  802b3d:	e8 2b d6 ff ff       	call   80016d <_panic>
+
+00802b42 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	53                   	push   %ebx
+  802b46:	83 ec 04             	sub    $0x4,%esp
+  802b49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b54:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b5a:	7f 2e                	jg     802b8a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b5c:	83 ec 04             	sub    $0x4,%esp
+  802b5f:	53                   	push   %ebx
+  802b60:	ff 75 0c             	push   0xc(%ebp)
+  802b63:	68 0c 80 80 00       	push   $0x80800c
+  802b68:	e8 45 de ff ff       	call   8009b2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802b6d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b73:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b76:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b7b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b80:	e8 e8 fd ff ff       	call   80296d <nsipc>
+}
+  802b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+	assert(size < 1600);
+  802b8a:	68 a5 4c 80 00       	push   $0x804ca5
+  802b8f:	68 3d 4c 80 00       	push   $0x804c3d
+  802b94:	6a 6d                	push   $0x6d
+  802b96:	68 99 4c 80 00       	push   $0x804c99
+  802b9b:	e8 cd d5 ff ff       	call   80016d <_panic>
+
+00802ba0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ba0:	55                   	push   %ebp
+  802ba1:	89 e5                	mov    %esp,%ebp
+  802ba3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802bae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bb1:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bb6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bb9:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802bbe:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bc3:	e8 a5 fd ff ff       	call   80296d <nsipc>
+}
+  802bc8:	c9                   	leave
+  802bc9:	c3                   	ret
+
+00802bca <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802bca:	55                   	push   %ebp
+  802bcb:	89 e5                	mov    %esp,%ebp
+  802bcd:	53                   	push   %ebx
+  802bce:	83 ec 10             	sub    $0x10,%esp
+  802bd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802bd4:	68 0c 60 80 00       	push   $0x80600c
+  802bd9:	e8 50 07 00 00       	call   80332e <mutex_lock>
+	if (v == 0)
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	85 db                	test   %ebx,%ebx
+  802be3:	0f 84 85 00 00 00    	je     802c6e <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802be9:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bef:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bf4:	77 51                	ja     802c47 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802bf6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802bfc:	89 d8                	mov    %ebx,%eax
+  802bfe:	c1 e8 0c             	shr    $0xc,%eax
+  802c01:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c08:	f6 c4 02             	test   $0x2,%ah
+  802c0b:	74 50                	je     802c5d <free+0x93>
+		sys_page_unmap(0, c);
+  802c0d:	83 ec 08             	sub    $0x8,%esp
+  802c10:	53                   	push   %ebx
+  802c11:	6a 00                	push   $0x0
+  802c13:	e8 eb e0 ff ff       	call   800d03 <sys_page_unmap>
+		c += PGSIZE;
+  802c18:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802c1e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c2c:	76 ce                	jbe    802bfc <free+0x32>
+  802c2e:	68 ef 4c 80 00       	push   $0x804cef
+  802c33:	68 3d 4c 80 00       	push   $0x804c3d
+  802c38:	68 82 00 00 00       	push   $0x82
+  802c3d:	68 e2 4c 80 00       	push   $0x804ce2
+  802c42:	e8 26 d5 ff ff       	call   80016d <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c47:	68 b4 4c 80 00       	push   $0x804cb4
+  802c4c:	68 3d 4c 80 00       	push   $0x804c3d
+  802c51:	6a 7b                	push   $0x7b
+  802c53:	68 e2 4c 80 00       	push   $0x804ce2
+  802c58:	e8 10 d5 ff ff       	call   80016d <_panic>
+	if (--(*ref) == 0)
+  802c5d:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c63:	83 e8 01             	sub    $0x1,%eax
+  802c66:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c6c:	74 15                	je     802c83 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802c6e:	83 ec 0c             	sub    $0xc,%esp
+  802c71:	68 0c 60 80 00       	push   $0x80600c
+  802c76:	e8 20 07 00 00       	call   80339b <mutex_unlock>
+}
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c81:	c9                   	leave
+  802c82:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c83:	83 ec 08             	sub    $0x8,%esp
+  802c86:	53                   	push   %ebx
+  802c87:	6a 00                	push   $0x0
+  802c89:	e8 75 e0 ff ff       	call   800d03 <sys_page_unmap>
+  802c8e:	83 c4 10             	add    $0x10,%esp
+  802c91:	eb db                	jmp    802c6e <free+0xa4>
+
+00802c93 <malloc>:
+{
+  802c93:	55                   	push   %ebp
+  802c94:	89 e5                	mov    %esp,%ebp
+  802c96:	57                   	push   %edi
+  802c97:	56                   	push   %esi
+  802c98:	53                   	push   %ebx
+  802c99:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c9c:	68 0c 60 80 00       	push   $0x80600c
+  802ca1:	e8 88 06 00 00       	call   80332e <mutex_lock>
+	if (mptr == 0)
+  802ca6:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802cac:	83 c4 10             	add    $0x10,%esp
+  802caf:	85 ff                	test   %edi,%edi
+  802cb1:	74 6c                	je     802d1f <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb6:	83 c0 03             	add    $0x3,%eax
+  802cb9:	83 e0 fc             	and    $0xfffffffc,%eax
+  802cbc:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802cbe:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802cc3:	0f 87 64 01 00 00    	ja     802e2d <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802cc9:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802ccf:	74 30                	je     802d01 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802cd1:	89 f9                	mov    %edi,%ecx
+  802cd3:	c1 e9 0c             	shr    $0xc,%ecx
+  802cd6:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802cda:	c1 e8 0c             	shr    $0xc,%eax
+  802cdd:	39 c1                	cmp    %eax,%ecx
+  802cdf:	74 5f                	je     802d40 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802ce1:	83 ec 0c             	sub    $0xc,%esp
+  802ce4:	57                   	push   %edi
+  802ce5:	e8 e0 fe ff ff       	call   802bca <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802cea:	a1 10 60 80 00       	mov    0x806010,%eax
+  802cef:	05 00 10 00 00       	add    $0x1000,%eax
+  802cf4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802cf9:	a3 10 60 80 00       	mov    %eax,0x806010
+  802cfe:	83 c4 10             	add    $0x10,%esp
+  802d01:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802d07:	ba 02 00 00 00       	mov    $0x2,%edx
+  802d0c:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802d10:	8d 7e 04             	lea    0x4(%esi),%edi
+  802d13:	89 cb                	mov    %ecx,%ebx
+  802d15:	01 f9                	add    %edi,%ecx
+  802d17:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d1a:	e9 8b 00 00 00       	jmp    802daa <malloc+0x117>
+		mptr = mbegin;
+  802d1f:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d26:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2c:	83 c0 03             	add    $0x3,%eax
+  802d2f:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d32:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d34:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d39:	76 c6                	jbe    802d01 <malloc+0x6e>
+  802d3b:	e9 d6 00 00 00       	jmp    802e16 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802d40:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d46:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802d4b:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802d4f:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d52:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802d57:	e9 ba 00 00 00       	jmp    802e16 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d5c:	05 00 10 00 00       	add    $0x1000,%eax
+  802d61:	39 c8                	cmp    %ecx,%eax
+  802d63:	0f 83 cb 00 00 00    	jae    802e34 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802d69:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d6e:	77 22                	ja     802d92 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d70:	89 c2                	mov    %eax,%edx
+  802d72:	c1 ea 16             	shr    $0x16,%edx
+  802d75:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d7c:	f6 c2 01             	test   $0x1,%dl
+  802d7f:	74 db                	je     802d5c <malloc+0xc9>
+  802d81:	89 c2                	mov    %eax,%edx
+  802d83:	c1 ea 0c             	shr    $0xc,%edx
+  802d86:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d8d:	f6 c2 01             	test   $0x1,%dl
+  802d90:	74 ca                	je     802d5c <malloc+0xc9>
+		if (mptr == mend) {
+  802d92:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d98:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d9e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802da2:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802da8:	74 04                	je     802dae <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802daa:	89 d8                	mov    %ebx,%eax
+  802dac:	eb b3                	jmp    802d61 <malloc+0xce>
+  802dae:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802db1:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802db6:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802dba:	83 ea 01             	sub    $0x1,%edx
+  802dbd:	0f 85 50 ff ff ff    	jne    802d13 <malloc+0x80>
+  802dc3:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802dca:	00 00 08 
+				return 0;	/* out of address space */
+  802dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd2:	eb 42                	jmp    802e16 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802dd4:	85 db                	test   %ebx,%ebx
+  802dd6:	78 1e                	js     802df6 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802dd8:	83 ec 08             	sub    $0x8,%esp
+  802ddb:	89 d8                	mov    %ebx,%eax
+  802ddd:	03 05 10 60 80 00    	add    0x806010,%eax
+  802de3:	50                   	push   %eax
+  802de4:	6a 00                	push   $0x0
+  802de6:	e8 18 df ff ff       	call   800d03 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802deb:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802df1:	83 c4 10             	add    $0x10,%esp
+  802df4:	eb de                	jmp    802dd4 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802df6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfb:	eb 19                	jmp    802e16 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802dfd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e00:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802e06:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802e0d:	00 
+	mptr += n;
+  802e0e:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e11:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802e16:	83 ec 0c             	sub    $0xc,%esp
+  802e19:	68 0c 60 80 00       	push   $0x80600c
+  802e1e:	e8 78 05 00 00       	call   80339b <mutex_unlock>
+}
+  802e23:	89 f8                	mov    %edi,%eax
+  802e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e28:	5b                   	pop    %ebx
+  802e29:	5e                   	pop    %esi
+  802e2a:	5f                   	pop    %edi
+  802e2b:	5d                   	pop    %ebp
+  802e2c:	c3                   	ret
+		return 0;
+  802e2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e32:	eb e2                	jmp    802e16 <malloc+0x183>
+  802e34:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e38:	74 06                	je     802e40 <malloc+0x1ad>
+  802e3a:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e45:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e48:	39 fb                	cmp    %edi,%ebx
+  802e4a:	73 b1                	jae    802dfd <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e4c:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e52:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e55:	39 fe                	cmp    %edi,%esi
+  802e57:	0f 92 c0             	setb   %al
+  802e5a:	0f b6 c0             	movzbl %al,%eax
+  802e5d:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e60:	83 c8 07             	or     $0x7,%eax
+  802e63:	50                   	push   %eax
+  802e64:	89 d8                	mov    %ebx,%eax
+  802e66:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e6c:	50                   	push   %eax
+  802e6d:	6a 00                	push   $0x0
+  802e6f:	e8 f6 dd ff ff       	call   800c6a <sys_page_alloc>
+  802e74:	83 c4 10             	add    $0x10,%esp
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	0f 88 55 ff ff ff    	js     802dd4 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e7f:	89 f3                	mov    %esi,%ebx
+  802e81:	eb c5                	jmp    802e48 <malloc+0x1b5>
+
+00802e83 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e83:	55                   	push   %ebp
+  802e84:	89 e5                	mov    %esp,%ebp
+  802e86:	56                   	push   %esi
+  802e87:	53                   	push   %ebx
+  802e88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e8b:	83 ec 0c             	sub    $0xc,%esp
+  802e8e:	ff 75 08             	push   0x8(%ebp)
+  802e91:	e8 ea e2 ff ff       	call   801180 <fd2data>
+  802e96:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e98:	83 c4 08             	add    $0x8,%esp
+  802e9b:	68 07 4d 80 00       	push   $0x804d07
+  802ea0:	53                   	push   %ebx
+  802ea1:	e8 86 d9 ff ff       	call   80082c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ea6:	8b 46 04             	mov    0x4(%esi),%eax
+  802ea9:	2b 06                	sub    (%esi),%eax
+  802eab:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802eb1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802eb8:	00 00 00 
+	stat->st_dev = &devpipe;
+  802ebb:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802ec2:	52 80 00 
+	return 0;
+}
+  802ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ecd:	5b                   	pop    %ebx
+  802ece:	5e                   	pop    %esi
+  802ecf:	5d                   	pop    %ebp
+  802ed0:	c3                   	ret
+
+00802ed1 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802ed1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed6:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802eda:	85 c9                	test   %ecx,%ecx
+  802edc:	75 01                	jne    802edf <pipewake+0xe>
+  802ede:	c3                   	ret
+{
+  802edf:	55                   	push   %ebp
+  802ee0:	89 e5                	mov    %esp,%ebp
+  802ee2:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802ee5:	68 00 04 00 00       	push   $0x400
+  802eea:	52                   	push   %edx
+  802eeb:	e8 be e0 ff ff       	call   800fae <sys_futex_wake>
+  802ef0:	83 c4 10             	add    $0x10,%esp
+}
+  802ef3:	c9                   	leave
+  802ef4:	c3                   	ret
+
+00802ef5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ef5:	55                   	push   %ebp
+  802ef6:	89 e5                	mov    %esp,%ebp
+  802ef8:	56                   	push   %esi
+  802ef9:	53                   	push   %ebx
+  802efa:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802efd:	83 ec 0c             	sub    $0xc,%esp
+  802f00:	56                   	push   %esi
+  802f01:	e8 7a e2 ff ff       	call   801180 <fd2data>
+  802f06:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802f08:	83 c4 08             	add    $0x8,%esp
+  802f0b:	56                   	push   %esi
+  802f0c:	6a 00                	push   $0x0
+  802f0e:	e8 f0 dd ff ff       	call   800d03 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802f13:	8d 53 04             	lea    0x4(%ebx),%edx
+  802f16:	8d 43 08             	lea    0x8(%ebx),%eax
+  802f19:	e8 b3 ff ff ff       	call   802ed1 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802f1e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802f21:	89 da                	mov    %ebx,%edx
+  802f23:	e8 a9 ff ff ff       	call   802ed1 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802f28:	89 34 24             	mov    %esi,(%esp)
+  802f2b:	e8 50 e2 ff ff       	call   801180 <fd2data>
+  802f30:	83 c4 08             	add    $0x8,%esp
+  802f33:	50                   	push   %eax
+  802f34:	6a 00                	push   $0x0
+  802f36:	e8 c8 dd ff ff       	call   800d03 <sys_page_unmap>
+}
+  802f3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f3e:	5b                   	pop    %ebx
+  802f3f:	5e                   	pop    %esi
+  802f40:	5d                   	pop    %ebp
+  802f41:	c3                   	ret
+
+00802f42 <_pipeisclosed>:
+{
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	57                   	push   %edi
+  802f46:	56                   	push   %esi
+  802f47:	53                   	push   %ebx
+  802f48:	83 ec 1c             	sub    $0x1c,%esp
+  802f4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f4e:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f50:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802f55:	eb 5d                	jmp    802fb4 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802f57:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802f5d:	8b 02                	mov    (%edx),%eax
+  802f5f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f62:	83 ec 0c             	sub    $0xc,%esp
+  802f65:	ff 75 e0             	push   -0x20(%ebp)
+  802f68:	e8 42 15 00 00       	call   8044af <pageref>
+  802f6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f70:	89 3c 24             	mov    %edi,(%esp)
+  802f73:	e8 37 15 00 00       	call   8044af <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802f78:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f7a:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802f80:	83 c4 10             	add    $0x10,%esp
+  802f83:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f89:	77 15                	ja     802fa0 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f8b:	89 f2                	mov    %esi,%edx
+  802f8d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f8f:	c1 ea 10             	shr    $0x10,%edx
+  802f92:	74 0c                	je     802fa0 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f94:	c1 e2 10             	shl    $0x10,%edx
+  802f97:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f9c:	29 d1                	sub    %edx,%ecx
+  802f9e:	eb 06                	jmp    802fa6 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802fa0:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802fa6:	8b 11                	mov    (%ecx),%edx
+  802fa8:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802fab:	39 d3                	cmp    %edx,%ebx
+  802fad:	74 6e                	je     80301d <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802faf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fb2:	74 24                	je     802fd8 <_pipeisclosed+0x96>
+  802fb4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fb6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fbc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fc1:	77 94                	ja     802f57 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fc3:	89 f0                	mov    %esi,%eax
+  802fc5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fc7:	c1 e8 10             	shr    $0x10,%eax
+  802fca:	74 8b                	je     802f57 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fcc:	c1 e0 10             	shl    $0x10,%eax
+  802fcf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fd4:	29 c2                	sub    %eax,%edx
+  802fd6:	eb 85                	jmp    802f5d <_pipeisclosed+0x1b>
+  802fd8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fda:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fe0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fe5:	77 18                	ja     802fff <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fe7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fec:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fee:	c1 e8 10             	shr    $0x10,%eax
+  802ff1:	74 0c                	je     802fff <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ff3:	c1 e0 10             	shl    $0x10,%eax
+  802ff6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ffb:	29 c2                	sub    %eax,%edx
+  802ffd:	eb 06                	jmp    803005 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802fff:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803005:	8b 02                	mov    (%edx),%eax
+  803007:	8b 40 58             	mov    0x58(%eax),%eax
+  80300a:	6a 01                	push   $0x1
+  80300c:	50                   	push   %eax
+  80300d:	53                   	push   %ebx
+  80300e:	68 0e 4d 80 00       	push   $0x804d0e
+  803013:	e8 30 d2 ff ff       	call   800248 <cprintf>
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	eb 97                	jmp    802fb4 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80301d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803020:	0f 94 c0             	sete   %al
+  803023:	0f b6 c0             	movzbl %al,%eax
+}
+  803026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803029:	5b                   	pop    %ebx
+  80302a:	5e                   	pop    %esi
+  80302b:	5f                   	pop    %edi
+  80302c:	5d                   	pop    %ebp
+  80302d:	c3                   	ret
+
+0080302e <devpipe_write>:
+{
+  80302e:	55                   	push   %ebp
+  80302f:	89 e5                	mov    %esp,%ebp
+  803031:	57                   	push   %edi
+  803032:	56                   	push   %esi
+  803033:	53                   	push   %ebx
+  803034:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803037:	ff 75 08             	push   0x8(%ebp)
+  80303a:	e8 41 e1 ff ff       	call   801180 <fd2data>
+  80303f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803041:	83 c4 10             	add    $0x10,%esp
+  803044:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80304b:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80304e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803051:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803054:	0f 84 96 00 00 00    	je     8030f0 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80305a:	8d 73 08             	lea    0x8(%ebx),%esi
+  80305d:	eb 32                	jmp    803091 <devpipe_write+0x63>
+  80305f:	89 fa                	mov    %edi,%edx
+  803061:	89 f0                	mov    %esi,%eax
+  803063:	e8 69 fe ff ff       	call   802ed1 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803068:	8b 43 04             	mov    0x4(%ebx),%eax
+  80306b:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80306e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803073:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803078:	83 ec 04             	sub    $0x4,%esp
+  80307b:	6a 0a                	push   $0xa
+  80307d:	50                   	push   %eax
+  80307e:	53                   	push   %ebx
+  80307f:	e8 fb de ff ff       	call   800f7f <sys_futex_wait>
+  803084:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803089:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80308e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803091:	8b 43 04             	mov    0x4(%ebx),%eax
+  803094:	8b 0b                	mov    (%ebx),%ecx
+  803096:	8d 51 20             	lea    0x20(%ecx),%edx
+  803099:	39 d0                	cmp    %edx,%eax
+  80309b:	72 1b                	jb     8030b8 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80309d:	89 da                	mov    %ebx,%edx
+  80309f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a2:	e8 9b fe ff ff       	call   802f42 <_pipeisclosed>
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	74 b4                	je     80305f <devpipe_write+0x31>
+				return 0;
+  8030ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b3:	5b                   	pop    %ebx
+  8030b4:	5e                   	pop    %esi
+  8030b5:	5f                   	pop    %edi
+  8030b6:	5d                   	pop    %ebp
+  8030b7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030bb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8030be:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8030c2:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8030c5:	89 c2                	mov    %eax,%edx
+  8030c7:	c1 fa 1f             	sar    $0x1f,%edx
+  8030ca:	89 d1                	mov    %edx,%ecx
+  8030cc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030cf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030d2:	83 e2 1f             	and    $0x1f,%edx
+  8030d5:	29 ca                	sub    %ecx,%edx
+  8030d7:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8030db:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8030df:	83 c0 01             	add    $0x1,%eax
+  8030e2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030e5:	83 c6 01             	add    $0x1,%esi
+  8030e8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8030eb:	e9 5e ff ff ff       	jmp    80304e <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8030f0:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030f3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030f6:	e8 d6 fd ff ff       	call   802ed1 <pipewake>
+	return i;
+  8030fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030fe:	eb b0                	jmp    8030b0 <devpipe_write+0x82>
+
+00803100 <devpipe_read>:
+{
+  803100:	55                   	push   %ebp
+  803101:	89 e5                	mov    %esp,%ebp
+  803103:	57                   	push   %edi
+  803104:	56                   	push   %esi
+  803105:	53                   	push   %ebx
+  803106:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803109:	ff 75 08             	push   0x8(%ebp)
+  80310c:	e8 6f e0 ff ff       	call   801180 <fd2data>
+  803111:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803113:	83 c4 10             	add    $0x10,%esp
+  803116:	be 00 00 00 00       	mov    $0x0,%esi
+  80311b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80311e:	74 6c                	je     80318c <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803120:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803123:	eb 25                	jmp    80314a <devpipe_read+0x4a>
+  803125:	8b 13                	mov    (%ebx),%edx
+  803127:	b8 01 00 00 00       	mov    $0x1,%eax
+  80312c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803131:	83 ec 04             	sub    $0x4,%esp
+  803134:	6a 0a                	push   $0xa
+  803136:	52                   	push   %edx
+  803137:	57                   	push   %edi
+  803138:	e8 42 de ff ff       	call   800f7f <sys_futex_wait>
+  80313d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803142:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803147:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80314a:	8b 03                	mov    (%ebx),%eax
+  80314c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80314f:	75 19                	jne    80316a <devpipe_read+0x6a>
+			if (i > 0)
+  803151:	85 f6                	test   %esi,%esi
+  803153:	75 3a                	jne    80318f <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803155:	89 da                	mov    %ebx,%edx
+  803157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80315a:	e8 e3 fd ff ff       	call   802f42 <_pipeisclosed>
+  80315f:	85 c0                	test   %eax,%eax
+  803161:	74 c2                	je     803125 <devpipe_read+0x25>
+				return 0;
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+  803168:	eb 31                	jmp    80319b <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80316a:	89 c1                	mov    %eax,%ecx
+  80316c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80316f:	c1 e9 1b             	shr    $0x1b,%ecx
+  803172:	01 c8                	add    %ecx,%eax
+  803174:	83 e0 1f             	and    $0x1f,%eax
+  803177:	29 c8                	sub    %ecx,%eax
+  803179:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80317e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803181:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803184:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803187:	83 c6 01             	add    $0x1,%esi
+  80318a:	eb 8f                	jmp    80311b <devpipe_read+0x1b>
+out:
+  80318c:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80318f:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803192:	89 da                	mov    %ebx,%edx
+  803194:	e8 38 fd ff ff       	call   802ed1 <pipewake>
+	return i;
+  803199:	89 f0                	mov    %esi,%eax
+}
+  80319b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80319e:	5b                   	pop    %ebx
+  80319f:	5e                   	pop    %esi
+  8031a0:	5f                   	pop    %edi
+  8031a1:	5d                   	pop    %ebp
+  8031a2:	c3                   	ret
+
+008031a3 <pipe>:
+{
+  8031a3:	55                   	push   %ebp
+  8031a4:	89 e5                	mov    %esp,%ebp
+  8031a6:	56                   	push   %esi
+  8031a7:	53                   	push   %ebx
+  8031a8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ae:	50                   	push   %eax
+  8031af:	e8 e3 df ff ff       	call   801197 <fd_alloc>
+  8031b4:	89 c3                	mov    %eax,%ebx
+  8031b6:	83 c4 10             	add    $0x10,%esp
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	0f 88 23 01 00 00    	js     8032e4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031c1:	83 ec 04             	sub    $0x4,%esp
+  8031c4:	68 07 04 00 00       	push   $0x407
+  8031c9:	ff 75 f4             	push   -0xc(%ebp)
+  8031cc:	6a 00                	push   $0x0
+  8031ce:	e8 97 da ff ff       	call   800c6a <sys_page_alloc>
+  8031d3:	89 c3                	mov    %eax,%ebx
+  8031d5:	83 c4 10             	add    $0x10,%esp
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	0f 88 04 01 00 00    	js     8032e4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031e0:	83 ec 0c             	sub    $0xc,%esp
+  8031e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031e6:	50                   	push   %eax
+  8031e7:	e8 ab df ff ff       	call   801197 <fd_alloc>
+  8031ec:	89 c3                	mov    %eax,%ebx
+  8031ee:	83 c4 10             	add    $0x10,%esp
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	0f 88 db 00 00 00    	js     8032d4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f9:	83 ec 04             	sub    $0x4,%esp
+  8031fc:	68 07 04 00 00       	push   $0x407
+  803201:	ff 75 f0             	push   -0x10(%ebp)
+  803204:	6a 00                	push   $0x0
+  803206:	e8 5f da ff ff       	call   800c6a <sys_page_alloc>
+  80320b:	89 c3                	mov    %eax,%ebx
+  80320d:	83 c4 10             	add    $0x10,%esp
+  803210:	85 c0                	test   %eax,%eax
+  803212:	0f 88 bc 00 00 00    	js     8032d4 <pipe+0x131>
+	va = fd2data(fd0);
+  803218:	83 ec 0c             	sub    $0xc,%esp
+  80321b:	ff 75 f4             	push   -0xc(%ebp)
+  80321e:	e8 5d df ff ff       	call   801180 <fd2data>
+  803223:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803225:	83 c4 0c             	add    $0xc,%esp
+  803228:	68 07 04 00 00       	push   $0x407
+  80322d:	50                   	push   %eax
+  80322e:	6a 00                	push   $0x0
+  803230:	e8 35 da ff ff       	call   800c6a <sys_page_alloc>
+  803235:	89 c3                	mov    %eax,%ebx
+  803237:	83 c4 10             	add    $0x10,%esp
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	0f 88 82 00 00 00    	js     8032c4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803242:	83 ec 0c             	sub    $0xc,%esp
+  803245:	ff 75 f0             	push   -0x10(%ebp)
+  803248:	e8 33 df ff ff       	call   801180 <fd2data>
+  80324d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803254:	50                   	push   %eax
+  803255:	6a 00                	push   $0x0
+  803257:	56                   	push   %esi
+  803258:	6a 00                	push   $0x0
+  80325a:	e8 58 da ff ff       	call   800cb7 <sys_page_map>
+  80325f:	89 c3                	mov    %eax,%ebx
+  803261:	83 c4 20             	add    $0x20,%esp
+  803264:	85 c0                	test   %eax,%eax
+  803266:	78 4e                	js     8032b6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803268:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80326d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803270:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803272:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803275:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80327c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80327f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803281:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803284:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80328b:	83 ec 0c             	sub    $0xc,%esp
+  80328e:	ff 75 f4             	push   -0xc(%ebp)
+  803291:	e8 da de ff ff       	call   801170 <fd2num>
+  803296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803299:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80329b:	83 c4 04             	add    $0x4,%esp
+  80329e:	ff 75 f0             	push   -0x10(%ebp)
+  8032a1:	e8 ca de ff ff       	call   801170 <fd2num>
+  8032a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032a9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032ac:	83 c4 10             	add    $0x10,%esp
+  8032af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b4:	eb 2e                	jmp    8032e4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032b6:	83 ec 08             	sub    $0x8,%esp
+  8032b9:	56                   	push   %esi
+  8032ba:	6a 00                	push   $0x0
+  8032bc:	e8 42 da ff ff       	call   800d03 <sys_page_unmap>
+  8032c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032c4:	83 ec 08             	sub    $0x8,%esp
+  8032c7:	ff 75 f0             	push   -0x10(%ebp)
+  8032ca:	6a 00                	push   $0x0
+  8032cc:	e8 32 da ff ff       	call   800d03 <sys_page_unmap>
+  8032d1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032d4:	83 ec 08             	sub    $0x8,%esp
+  8032d7:	ff 75 f4             	push   -0xc(%ebp)
+  8032da:	6a 00                	push   $0x0
+  8032dc:	e8 22 da ff ff       	call   800d03 <sys_page_unmap>
+  8032e1:	83 c4 10             	add    $0x10,%esp
+}
+  8032e4:	89 d8                	mov    %ebx,%eax
+  8032e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e9:	5b                   	pop    %ebx
+  8032ea:	5e                   	pop    %esi
+  8032eb:	5d                   	pop    %ebp
+  8032ec:	c3                   	ret
+
+008032ed <pipeisclosed>:
+{
+  8032ed:	55                   	push   %ebp
+  8032ee:	89 e5                	mov    %esp,%ebp
+  8032f0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032f6:	50                   	push   %eax
+  8032f7:	ff 75 08             	push   0x8(%ebp)
+  8032fa:	e8 ee de ff ff       	call   8011ed <fd_lookup>
+  8032ff:	83 c4 10             	add    $0x10,%esp
+  803302:	85 c0                	test   %eax,%eax
+  803304:	78 18                	js     80331e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803306:	83 ec 0c             	sub    $0xc,%esp
+  803309:	ff 75 f4             	push   -0xc(%ebp)
+  80330c:	e8 6f de ff ff       	call   801180 <fd2data>
+  803311:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803313:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803316:	e8 27 fc ff ff       	call   802f42 <_pipeisclosed>
+  80331b:	83 c4 10             	add    $0x10,%esp
+}
+  80331e:	c9                   	leave
+  80331f:	c3                   	ret
+
+00803320 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803320:	55                   	push   %ebp
+  803321:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803323:	8b 45 08             	mov    0x8(%ebp),%eax
+  803326:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80332c:	5d                   	pop    %ebp
+  80332d:	c3                   	ret
+
+0080332e <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80332e:	55                   	push   %ebp
+  80332f:	89 e5                	mov    %esp,%ebp
+  803331:	56                   	push   %esi
+  803332:	53                   	push   %ebx
+  803333:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803336:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803340:	89 d0                	mov    %edx,%eax
+  803342:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803346:	85 c0                	test   %eax,%eax
+  803348:	74 2d                	je     803377 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80334a:	83 f8 02             	cmp    $0x2,%eax
+  80334d:	74 08                	je     803357 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80334f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803354:	f0 87 03             	lock xchg %eax,(%ebx)
+  803357:	be 02 00 00 00       	mov    $0x2,%esi
+  80335c:	eb 15                	jmp    803373 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80335e:	83 ec 04             	sub    $0x4,%esp
+  803361:	6a 00                	push   $0x0
+  803363:	6a 02                	push   $0x2
+  803365:	53                   	push   %ebx
+  803366:	e8 14 dc ff ff       	call   800f7f <sys_futex_wait>
+  80336b:	89 f0                	mov    %esi,%eax
+  80336d:	f0 87 03             	lock xchg %eax,(%ebx)
+  803370:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803373:	85 c0                	test   %eax,%eax
+  803375:	75 e7                	jne    80335e <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803377:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80337a:	5b                   	pop    %ebx
+  80337b:	5e                   	pop    %esi
+  80337c:	5d                   	pop    %ebp
+  80337d:	c3                   	ret
+
+0080337e <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80337e:	55                   	push   %ebp
+  80337f:	89 e5                	mov    %esp,%ebp
+  803381:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803384:	b8 00 00 00 00       	mov    $0x0,%eax
+  803389:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80338e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803392:	f7 d8                	neg    %eax
+  803394:	19 c0                	sbb    %eax,%eax
+  803396:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803399:	5d                   	pop    %ebp
+  80339a:	c3                   	ret
+
+0080339b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80339b:	55                   	push   %ebp
+  80339c:	89 e5                	mov    %esp,%ebp
+  80339e:	83 ec 08             	sub    $0x8,%esp
+  8033a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8033a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a9:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8033ac:	83 f8 02             	cmp    $0x2,%eax
+  8033af:	74 02                	je     8033b3 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8033b1:	c9                   	leave
+  8033b2:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8033b3:	83 ec 08             	sub    $0x8,%esp
+  8033b6:	6a 01                	push   $0x1
+  8033b8:	52                   	push   %edx
+  8033b9:	e8 f0 db ff ff       	call   800fae <sys_futex_wake>
+  8033be:	83 c4 10             	add    $0x10,%esp
+}
+  8033c1:	eb ee                	jmp    8033b1 <mutex_unlock+0x16>
+
+008033c3 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8033c3:	55                   	push   %ebp
+  8033c4:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8033c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8033cf:	5d                   	pop    %ebp
+  8033d0:	c3                   	ret
+
+008033d1 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8033d1:	55                   	push   %ebp
+  8033d2:	89 e5                	mov    %esp,%ebp
+  8033d4:	57                   	push   %edi
+  8033d5:	56                   	push   %esi
+  8033d6:	53                   	push   %ebx
+  8033d7:	83 ec 18             	sub    $0x18,%esp
+  8033da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8033e0:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8033e2:	53                   	push   %ebx
+  8033e3:	e8 b3 ff ff ff       	call   80339b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8033e8:	83 c4 0c             	add    $0xc,%esp
+  8033eb:	ff 75 10             	push   0x10(%ebp)
+  8033ee:	57                   	push   %edi
+  8033ef:	56                   	push   %esi
+  8033f0:	e8 8a db ff ff       	call   800f7f <sys_futex_wait>
+  8033f5:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8033f7:	83 c4 10             	add    $0x10,%esp
+  8033fa:	be 02 00 00 00       	mov    $0x2,%esi
+  8033ff:	eb 10                	jmp    803411 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803401:	83 ec 04             	sub    $0x4,%esp
+  803404:	6a 00                	push   $0x0
+  803406:	6a 02                	push   $0x2
+  803408:	53                   	push   %ebx
+  803409:	e8 71 db ff ff       	call   800f7f <sys_futex_wait>
+  80340e:	83 c4 10             	add    $0x10,%esp
+  803411:	89 f0                	mov    %esi,%eax
+  803413:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803416:	85 c0                	test   %eax,%eax
+  803418:	75 e7                	jne    803401 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80341a:	83 ff ec             	cmp    $0xffffffec,%edi
+  80341d:	74 05                	je     803424 <cond_timedwait+0x53>
+  80341f:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803424:	89 f8                	mov    %edi,%eax
+  803426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803429:	5b                   	pop    %ebx
+  80342a:	5e                   	pop    %esi
+  80342b:	5f                   	pop    %edi
+  80342c:	5d                   	pop    %ebp
+  80342d:	c3                   	ret
+
+0080342e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80342e:	55                   	push   %ebp
+  80342f:	89 e5                	mov    %esp,%ebp
+  803431:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803434:	6a 00                	push   $0x0
+  803436:	ff 75 0c             	push   0xc(%ebp)
+  803439:	ff 75 08             	push   0x8(%ebp)
+  80343c:	e8 90 ff ff ff       	call   8033d1 <cond_timedwait>
+}
+  803441:	83 c4 10             	add    $0x10,%esp
+  803444:	c9                   	leave
+  803445:	c3                   	ret
+
+00803446 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803446:	55                   	push   %ebp
+  803447:	89 e5                	mov    %esp,%ebp
+  803449:	83 ec 10             	sub    $0x10,%esp
+  80344c:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80344f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803454:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803458:	6a 01                	push   $0x1
+  80345a:	50                   	push   %eax
+  80345b:	e8 4e db ff ff       	call   800fae <sys_futex_wake>
+}
+  803460:	83 c4 10             	add    $0x10,%esp
+  803463:	c9                   	leave
+  803464:	c3                   	ret
+
+00803465 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803465:	55                   	push   %ebp
+  803466:	89 e5                	mov    %esp,%ebp
+  803468:	83 ec 10             	sub    $0x10,%esp
+  80346b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803473:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803477:	68 00 04 00 00       	push   $0x400
+  80347c:	50                   	push   %eax
+  80347d:	e8 2c db ff ff       	call   800fae <sys_futex_wake>
+}
+  803482:	83 c4 10             	add    $0x10,%esp
+  803485:	c9                   	leave
+  803486:	c3                   	ret
+
+00803487 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803487:	55                   	push   %ebp
+  803488:	89 e5                	mov    %esp,%ebp
+  80348a:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80348d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803490:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803492:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803499:	5d                   	pop    %ebp
+  80349a:	c3                   	ret
+
+0080349b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80349b:	55                   	push   %ebp
+  80349c:	89 e5                	mov    %esp,%ebp
+  80349e:	53                   	push   %ebx
+  80349f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8034a2:	8b 11                	mov    (%ecx),%edx
+  8034a4:	85 d2                	test   %edx,%edx
+  8034a6:	74 14                	je     8034bc <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8034a8:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8034ab:	89 d0                	mov    %edx,%eax
+  8034ad:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8034b1:	39 c2                	cmp    %eax,%edx
+  8034b3:	75 ed                	jne    8034a2 <sem_trywait+0x7>
+			return 0;
+  8034b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ba:	eb 05                	jmp    8034c1 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8034bc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8034c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034c4:	c9                   	leave
+  8034c5:	c3                   	ret
+
+008034c6 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8034c6:	55                   	push   %ebp
+  8034c7:	89 e5                	mov    %esp,%ebp
+  8034c9:	57                   	push   %edi
+  8034ca:	56                   	push   %esi
+  8034cb:	53                   	push   %ebx
+  8034cc:	83 ec 1c             	sub    $0x1c,%esp
+  8034cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8034d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8034d5:	e8 1d da ff ff       	call   800ef7 <sys_time_msec>
+  8034da:	01 f8                	add    %edi,%eax
+  8034dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8034df:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8034e4:	eb 28                	jmp    80350e <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8034e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034eb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8034f0:	83 ec 04             	sub    $0x4,%esp
+  8034f3:	56                   	push   %esi
+  8034f4:	6a 00                	push   $0x0
+  8034f6:	53                   	push   %ebx
+  8034f7:	e8 83 da ff ff       	call   800f7f <sys_futex_wait>
+  8034fc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803501:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803506:	83 c4 10             	add    $0x10,%esp
+  803509:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80350c:	74 2e                	je     80353c <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80350e:	83 ec 0c             	sub    $0xc,%esp
+  803511:	53                   	push   %ebx
+  803512:	e8 84 ff ff ff       	call   80349b <sem_trywait>
+  803517:	83 c4 10             	add    $0x10,%esp
+  80351a:	85 c0                	test   %eax,%eax
+  80351c:	79 19                	jns    803537 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  80351e:	85 ff                	test   %edi,%edi
+  803520:	74 c4                	je     8034e6 <sem_timedwait+0x20>
+  803522:	e8 d0 d9 ff ff       	call   800ef7 <sys_time_msec>
+  803527:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80352a:	29 c6                	sub    %eax,%esi
+  80352c:	85 f6                	test   %esi,%esi
+  80352e:	7f b6                	jg     8034e6 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803530:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803535:	eb 05                	jmp    80353c <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803537:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80353c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80353f:	5b                   	pop    %ebx
+  803540:	5e                   	pop    %esi
+  803541:	5f                   	pop    %edi
+  803542:	5d                   	pop    %ebp
+  803543:	c3                   	ret
+
+00803544 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803544:	55                   	push   %ebp
+  803545:	89 e5                	mov    %esp,%ebp
+  803547:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80354a:	6a 00                	push   $0x0
+  80354c:	ff 75 08             	push   0x8(%ebp)
+  80354f:	e8 72 ff ff ff       	call   8034c6 <sem_timedwait>
+}
+  803554:	83 c4 10             	add    $0x10,%esp
+  803557:	c9                   	leave
+  803558:	c3                   	ret
+
+00803559 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803559:	55                   	push   %ebp
+  80355a:	89 e5                	mov    %esp,%ebp
+  80355c:	83 ec 08             	sub    $0x8,%esp
+  80355f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803562:	ba 01 00 00 00       	mov    $0x1,%edx
+  803567:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80356b:	8b 50 04             	mov    0x4(%eax),%edx
+  80356e:	85 d2                	test   %edx,%edx
+  803570:	75 02                	jne    803574 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803572:	c9                   	leave
+  803573:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803574:	83 ec 08             	sub    $0x8,%esp
+  803577:	6a 01                	push   $0x1
+  803579:	50                   	push   %eax
+  80357a:	e8 2f da ff ff       	call   800fae <sys_futex_wake>
+  80357f:	83 c4 10             	add    $0x10,%esp
+}
+  803582:	eb ee                	jmp    803572 <sem_post+0x19>
+
+00803584 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803584:	55                   	push   %ebp
+  803585:	89 e5                	mov    %esp,%ebp
+  803587:	57                   	push   %edi
+  803588:	56                   	push   %esi
+  803589:	53                   	push   %ebx
+  80358a:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80358d:	68 20 60 80 00       	push   $0x806020
+  803592:	e8 97 fd ff ff       	call   80332e <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803597:	a1 44 60 80 00       	mov    0x806044,%eax
+  80359c:	83 c4 10             	add    $0x10,%esp
+  80359f:	85 c0                	test   %eax,%eax
+  8035a1:	75 19                	jne    8035bc <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8035a3:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8035a8:	8b 00                	mov    (%eax),%eax
+  8035aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8035ad:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  8035b2:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  8035b9:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8035bc:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8035c1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035c4:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035cb:	8b 40 04             	mov    0x4(%eax),%eax
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	0f 84 e4 00 00 00    	je     8036ba <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8035d6:	83 c3 01             	add    $0x1,%ebx
+  8035d9:	83 fb 20             	cmp    $0x20,%ebx
+  8035dc:	75 e3                	jne    8035c1 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8035de:	83 ec 0c             	sub    $0xc,%esp
+  8035e1:	68 20 60 80 00       	push   $0x806020
+  8035e6:	e8 b0 fd ff ff       	call   80339b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8035eb:	83 c4 10             	add    $0x10,%esp
+  8035ee:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8035f3:	e9 b8 00 00 00       	jmp    8036b0 <pthread_create+0x12c>
+  8035f8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8035fb:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8035fe:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803600:	39 f3                	cmp    %esi,%ebx
+  803602:	73 16                	jae    80361a <pthread_create+0x96>
+		va -= PGSIZE;
+  803604:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80360a:	83 ec 08             	sub    $0x8,%esp
+  80360d:	56                   	push   %esi
+  80360e:	6a 00                	push   $0x0
+  803610:	e8 ee d6 ff ff       	call   800d03 <sys_page_unmap>
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	eb e6                	jmp    803600 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80361a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80361d:	83 ec 08             	sub    $0x8,%esp
+  803620:	ff 75 e4             	push   -0x1c(%ebp)
+  803623:	6a 00                	push   $0x0
+  803625:	e8 d9 d6 ff ff       	call   800d03 <sys_page_unmap>
+	return r;
+  80362a:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80362d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803630:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803637:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80363e:	eb 70                	jmp    8036b0 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803640:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803643:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80364a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80364d:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803650:	8b 55 10             	mov    0x10(%ebp),%edx
+  803653:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803656:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80365d:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803662:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803665:	29 c8                	sub    %ecx,%eax
+  803667:	85 db                	test   %ebx,%ebx
+  803669:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803670:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803673:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80367a:	83 ec 04             	sub    $0x4,%esp
+  80367d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803682:	29 ca                	sub    %ecx,%edx
+  803684:	52                   	push   %edx
+	*--esp = 0;
+  803685:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803688:	50                   	push   %eax
+  803689:	68 e1 38 80 00       	push   $0x8038e1
+  80368e:	e8 c0 d9 ff ff       	call   801053 <sys_thread_create>
+  803693:	89 c7                	mov    %eax,%edi
+  803695:	83 c4 10             	add    $0x10,%esp
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 91                	js     80362d <pthread_create+0xa9>
+	th->th_env = id;
+  80369c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80369f:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  8036a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a9:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8036ab:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8036b0:	89 f8                	mov    %edi,%eax
+  8036b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b5:	5b                   	pop    %ebx
+  8036b6:	5e                   	pop    %esi
+  8036b7:	5f                   	pop    %edi
+  8036b8:	5d                   	pop    %ebp
+  8036b9:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8036ba:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036bd:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8036c4:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8036cb:	83 ec 0c             	sub    $0xc,%esp
+  8036ce:	68 20 60 80 00       	push   $0x806020
+  8036d3:	e8 c3 fc ff ff       	call   80339b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8036d8:	89 d9                	mov    %ebx,%ecx
+  8036da:	c1 e1 10             	shl    $0x10,%ecx
+  8036dd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8036e0:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8036e5:	29 c8                	sub    %ecx,%eax
+  8036e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8036ea:	c1 e8 16             	shr    $0x16,%eax
+  8036ed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036f4:	83 c4 10             	add    $0x10,%esp
+  8036f7:	a8 01                	test   $0x1,%al
+  8036f9:	74 15                	je     803710 <pthread_create+0x18c>
+  8036fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036fe:	c1 e8 0c             	shr    $0xc,%eax
+  803701:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803708:	a8 01                	test   $0x1,%al
+  80370a:	0f 85 30 ff ff ff    	jne    803640 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803710:	83 ec 04             	sub    $0x4,%esp
+  803713:	6a 07                	push   $0x7
+  803715:	ff 75 e4             	push   -0x1c(%ebp)
+  803718:	6a 00                	push   $0x0
+  80371a:	e8 4b d5 ff ff       	call   800c6a <sys_page_alloc>
+  80371f:	89 c7                	mov    %eax,%edi
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	85 c0                	test   %eax,%eax
+  803726:	0f 88 01 ff ff ff    	js     80362d <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80372c:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803731:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803734:	29 d0                	sub    %edx,%eax
+  803736:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803739:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80373b:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803740:	29 d0                	sub    %edx,%eax
+  803742:	89 c7                	mov    %eax,%edi
+  803744:	39 fe                	cmp    %edi,%esi
+  803746:	0f 83 f4 fe ff ff    	jae    803640 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80374c:	83 ec 04             	sub    $0x4,%esp
+  80374f:	6a 07                	push   $0x7
+  803751:	56                   	push   %esi
+  803752:	6a 00                	push   $0x0
+  803754:	e8 11 d5 ff ff       	call   800c6a <sys_page_alloc>
+  803759:	83 c4 10             	add    $0x10,%esp
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	0f 88 94 fe ff ff    	js     8035f8 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803764:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80376a:	eb d8                	jmp    803744 <pthread_create+0x1c0>
+
+0080376c <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80376c:	55                   	push   %ebp
+  80376d:	89 e5                	mov    %esp,%ebp
+  80376f:	57                   	push   %edi
+  803770:	56                   	push   %esi
+  803771:	53                   	push   %ebx
+  803772:	83 ec 0c             	sub    $0xc,%esp
+  803775:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803778:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80377b:	83 f8 1e             	cmp    $0x1e,%eax
+  80377e:	0f 87 c7 00 00 00    	ja     80384b <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803784:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803786:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80378c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803791:	77 12                	ja     8037a5 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803793:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803798:	29 d0                	sub    %edx,%eax
+  80379a:	c1 e8 10             	shr    $0x10,%eax
+  80379d:	39 c3                	cmp    %eax,%ebx
+  80379f:	0f 84 ad 00 00 00    	je     803852 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037a8:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8037af:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8037b6:	eb 10                	jmp    8037c8 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037b8:	83 ec 04             	sub    $0x4,%esp
+  8037bb:	6a 00                	push   $0x0
+  8037bd:	6a 01                	push   $0x1
+  8037bf:	57                   	push   %edi
+  8037c0:	e8 ba d7 ff ff       	call   800f7f <sys_futex_wait>
+  8037c5:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8037c8:	8b 46 04             	mov    0x4(%esi),%eax
+  8037cb:	83 f8 01             	cmp    $0x1,%eax
+  8037ce:	74 e8                	je     8037b8 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8037d0:	83 f8 02             	cmp    $0x2,%eax
+  8037d3:	0f 85 80 00 00 00    	jne    803859 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037d9:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8037dc:	c1 e6 02             	shl    $0x2,%esi
+  8037df:	eb 05                	jmp    8037e6 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8037e1:	e8 58 d4 ff ff       	call   800c3e <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037e6:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8037ec:	89 ca                	mov    %ecx,%edx
+  8037ee:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8037f4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037f7:	c1 e0 04             	shl    $0x4,%eax
+  8037fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037ff:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803802:	39 c1                	cmp    %eax,%ecx
+  803804:	75 12                	jne    803818 <pthread_join+0xac>
+  803806:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803809:	c1 e0 04             	shl    $0x4,%eax
+  80380c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803811:	8b 40 54             	mov    0x54(%eax),%eax
+  803814:	85 c0                	test   %eax,%eax
+  803816:	75 c9                	jne    8037e1 <pthread_join+0x75>
+	if (ret_store)
+  803818:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80381c:	74 0f                	je     80382d <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  80381e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803821:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803828:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80382b:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80382d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803830:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803837:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80383e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803843:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803846:	5b                   	pop    %ebx
+  803847:	5e                   	pop    %esi
+  803848:	5f                   	pop    %edi
+  803849:	5d                   	pop    %ebp
+  80384a:	c3                   	ret
+		return -E_INVAL;
+  80384b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803850:	eb f1                	jmp    803843 <pthread_join+0xd7>
+  803852:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803857:	eb ea                	jmp    803843 <pthread_join+0xd7>
+		return -E_INVAL;
+  803859:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80385e:	eb e3                	jmp    803843 <pthread_join+0xd7>
+
+00803860 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803860:	55                   	push   %ebp
+  803861:	89 e5                	mov    %esp,%ebp
+  803863:	53                   	push   %ebx
+  803864:	83 ec 04             	sub    $0x4,%esp
+  803867:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803869:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80386f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803874:	77 0c                	ja     803882 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803876:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80387b:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80387d:	c1 e8 10             	shr    $0x10,%eax
+  803880:	75 0a                	jne    80388c <pthread_exit+0x2c>
+		exit();
+  803882:	e8 be c8 ff ff       	call   800145 <exit>
+  803887:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80388c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803893:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803896:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80389d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8038a0:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8038a3:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8038aa:	83 ec 08             	sub    $0x8,%esp
+  8038ad:	6a 20                	push   $0x20
+  8038af:	01 c2                	add    %eax,%edx
+  8038b1:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8038b8:	50                   	push   %eax
+  8038b9:	e8 f0 d6 ff ff       	call   800fae <sys_futex_wake>
+	sys_env_destroy(0);
+  8038be:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8038c5:	e8 fd d2 ff ff       	call   800bc7 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8038ca:	83 c4 0c             	add    $0xc,%esp
+  8038cd:	68 26 4d 80 00       	push   $0x804d26
+  8038d2:	68 a5 00 00 00       	push   $0xa5
+  8038d7:	68 40 4d 80 00       	push   $0x804d40
+  8038dc:	e8 8c c8 ff ff       	call   80016d <_panic>
+
+008038e1 <pthread_start>:
+{
+  8038e1:	55                   	push   %ebp
+  8038e2:	89 e5                	mov    %esp,%ebp
+  8038e4:	53                   	push   %ebx
+  8038e5:	83 ec 04             	sub    $0x4,%esp
+  8038e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8038eb:	e8 22 d3 ff ff       	call   800c12 <sys_getenvid>
+  8038f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8038f5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8038fb:	85 db                	test   %ebx,%ebx
+  8038fd:	74 0c                	je     80390b <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038ff:	89 d9                	mov    %ebx,%ecx
+  803901:	c1 e1 10             	shl    $0x10,%ecx
+  803904:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803909:	29 ca                	sub    %ecx,%edx
+  80390b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80390e:	c1 e0 04             	shl    $0x4,%eax
+  803911:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803916:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803918:	83 ec 0c             	sub    $0xc,%esp
+  80391b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803922:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803925:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  80392c:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803933:	89 04 24             	mov    %eax,(%esp)
+  803936:	e8 25 ff ff ff       	call   803860 <pthread_exit>
+
+0080393b <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80393b:	55                   	push   %ebp
+  80393c:	89 e5                	mov    %esp,%ebp
+  80393e:	57                   	push   %edi
+  80393f:	56                   	push   %esi
+  803940:	53                   	push   %ebx
+  803941:	83 ec 1c             	sub    $0x1c,%esp
+  803944:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803946:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80394c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803953:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803958:	77 0d                	ja     803967 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80395a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80395f:	29 d0                	sub    %edx,%eax
+  803961:	c1 e8 10             	shr    $0x10,%eax
+  803964:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803967:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80396c:	eb 2f                	jmp    80399d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80396e:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803974:	8b 01                	mov    (%ecx),%eax
+  803976:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803979:	39 c2                	cmp    %eax,%edx
+  80397b:	75 14                	jne    803991 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80397d:	83 ec 0c             	sub    $0xc,%esp
+  803980:	57                   	push   %edi
+  803981:	e8 41 d2 ff ff       	call   800bc7 <sys_env_destroy>
+  803986:	83 c4 10             	add    $0x10,%esp
+  803989:	85 c0                	test   %eax,%eax
+  80398b:	0f 88 97 00 00 00    	js     803a28 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803991:	83 c3 01             	add    $0x1,%ebx
+  803994:	83 fb 20             	cmp    $0x20,%ebx
+  803997:	0f 84 d2 00 00 00    	je     803a6f <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80399d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8039a0:	74 ef                	je     803991 <pthread_kill_others+0x56>
+  8039a2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039a5:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8039ac:	8b 40 04             	mov    0x4(%eax),%eax
+  8039af:	83 f8 01             	cmp    $0x1,%eax
+  8039b2:	75 dd                	jne    803991 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8039b4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039b7:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8039be:	89 fe                	mov    %edi,%esi
+  8039c0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039c6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039c9:	c1 e0 04             	shl    $0x4,%eax
+  8039cc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039d1:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039d4:	39 c7                	cmp    %eax,%edi
+  8039d6:	75 b9                	jne    803991 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039d8:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039db:	c1 e0 04             	shl    $0x4,%eax
+  8039de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039e3:	8b 40 54             	mov    0x54(%eax),%eax
+  8039e6:	85 c0                	test   %eax,%eax
+  8039e8:	74 a7                	je     803991 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039ea:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039ed:	c1 e0 04             	shl    $0x4,%eax
+  8039f0:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8039f6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039f8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8039fe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a03:	0f 87 65 ff ff ff    	ja     80396e <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a09:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a0e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803a10:	c1 e8 10             	shr    $0x10,%eax
+  803a13:	0f 84 55 ff ff ff    	je     80396e <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a19:	c1 e0 10             	shl    $0x10,%eax
+  803a1c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803a21:	29 c1                	sub    %eax,%ecx
+  803a23:	e9 4c ff ff ff       	jmp    803974 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803a28:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a2b:	c1 e2 04             	shl    $0x4,%edx
+  803a2e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a34:	8b 52 48             	mov    0x48(%edx),%edx
+  803a37:	39 fa                	cmp    %edi,%edx
+  803a39:	0f 85 52 ff ff ff    	jne    803991 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803a3f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a42:	c1 e2 04             	shl    $0x4,%edx
+  803a45:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a4b:	8b 52 54             	mov    0x54(%edx),%edx
+  803a4e:	85 d2                	test   %edx,%edx
+  803a50:	0f 84 3b ff ff ff    	je     803991 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a56:	83 ec 0c             	sub    $0xc,%esp
+  803a59:	50                   	push   %eax
+  803a5a:	57                   	push   %edi
+  803a5b:	68 50 4d 80 00       	push   $0x804d50
+  803a60:	68 bb 00 00 00       	push   $0xbb
+  803a65:	68 40 4d 80 00       	push   $0x804d40
+  803a6a:	e8 fe c6 ff ff       	call   80016d <_panic>
+	}
+}
+  803a6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a72:	5b                   	pop    %ebx
+  803a73:	5e                   	pop    %esi
+  803a74:	5f                   	pop    %edi
+  803a75:	5d                   	pop    %ebp
+  803a76:	c3                   	ret
+
+00803a77 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803a77:	55                   	push   %ebp
+  803a78:	89 e5                	mov    %esp,%ebp
+  803a7a:	53                   	push   %ebx
+  803a7b:	83 ec 04             	sub    $0x4,%esp
+  803a7e:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a80:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803a86:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803a8c:	0f 87 85 00 00 00    	ja     803b17 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a92:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a97:	29 c3                	sub    %eax,%ebx
+  803a99:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a9c:	83 ec 04             	sub    $0x4,%esp
+  803a9f:	68 80 02 00 00       	push   $0x280
+  803aa4:	6a 00                	push   $0x0
+  803aa6:	68 40 60 80 00       	push   $0x806040
+  803aab:	e8 cd ce ff ff       	call   80097d <memset>
+	threads_mu.m_state = 0;
+  803ab0:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803ab7:	00 00 00 
+	if (self != 0) {
+  803aba:	83 c4 10             	add    $0x10,%esp
+  803abd:	85 db                	test   %ebx,%ebx
+  803abf:	74 51                	je     803b12 <pthread_fork_child+0x9b>
+  803ac1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ac3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ac9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ace:	77 18                	ja     803ae8 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ad0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ad5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803ad7:	c1 e8 10             	shr    $0x10,%eax
+  803ada:	74 0c                	je     803ae8 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803adc:	c1 e0 10             	shl    $0x10,%eax
+  803adf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ae4:	29 c2                	sub    %eax,%edx
+  803ae6:	eb 06                	jmp    803aee <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803ae8:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803aee:	8b 02                	mov    (%edx),%eax
+  803af0:	8b 48 48             	mov    0x48(%eax),%ecx
+  803af3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803afa:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803afd:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803b04:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803b0b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803b12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b15:	c9                   	leave
+  803b16:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803b17:	83 ec 04             	sub    $0x4,%esp
+  803b1a:	68 80 02 00 00       	push   $0x280
+  803b1f:	6a 00                	push   $0x0
+  803b21:	68 40 60 80 00       	push   $0x806040
+  803b26:	e8 52 ce ff ff       	call   80097d <memset>
+	threads_mu.m_state = 0;
+  803b2b:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803b32:	00 00 00 
+  803b35:	83 c4 10             	add    $0x10,%esp
+  803b38:	eb d8                	jmp    803b12 <pthread_fork_child+0x9b>
+
+00803b3a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3f:	c3                   	ret
+
+00803b40 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b40:	55                   	push   %ebp
+  803b41:	89 e5                	mov    %esp,%ebp
+  803b43:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b46:	68 75 4d 80 00       	push   $0x804d75
+  803b4b:	ff 75 0c             	push   0xc(%ebp)
+  803b4e:	e8 d9 cc ff ff       	call   80082c <strcpy>
+	return 0;
+}
+  803b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b58:	c9                   	leave
+  803b59:	c3                   	ret
+
+00803b5a <devcons_write>:
+{
+  803b5a:	55                   	push   %ebp
+  803b5b:	89 e5                	mov    %esp,%ebp
+  803b5d:	57                   	push   %edi
+  803b5e:	56                   	push   %esi
+  803b5f:	53                   	push   %ebx
+  803b60:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b66:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b6b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b71:	eb 2e                	jmp    803ba1 <devcons_write+0x47>
+		m = n - tot;
+  803b73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b76:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b78:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b7d:	39 c3                	cmp    %eax,%ebx
+  803b7f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b82:	83 ec 04             	sub    $0x4,%esp
+  803b85:	53                   	push   %ebx
+  803b86:	89 f0                	mov    %esi,%eax
+  803b88:	03 45 0c             	add    0xc(%ebp),%eax
+  803b8b:	50                   	push   %eax
+  803b8c:	57                   	push   %edi
+  803b8d:	e8 20 ce ff ff       	call   8009b2 <memmove>
+		sys_cputs(buf, m);
+  803b92:	83 c4 08             	add    $0x8,%esp
+  803b95:	53                   	push   %ebx
+  803b96:	57                   	push   %edi
+  803b97:	e8 d4 cf ff ff       	call   800b70 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b9c:	01 de                	add    %ebx,%esi
+  803b9e:	83 c4 10             	add    $0x10,%esp
+  803ba1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803ba4:	72 cd                	jb     803b73 <devcons_write+0x19>
+}
+  803ba6:	89 f0                	mov    %esi,%eax
+  803ba8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bab:	5b                   	pop    %ebx
+  803bac:	5e                   	pop    %esi
+  803bad:	5f                   	pop    %edi
+  803bae:	5d                   	pop    %ebp
+  803baf:	c3                   	ret
+
+00803bb0 <devcons_read>:
+{
+  803bb0:	55                   	push   %ebp
+  803bb1:	89 e5                	mov    %esp,%ebp
+  803bb3:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803bbf:	75 07                	jne    803bc8 <devcons_read+0x18>
+  803bc1:	eb 1f                	jmp    803be2 <devcons_read+0x32>
+		sys_yield();
+  803bc3:	e8 76 d0 ff ff       	call   800c3e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803bc8:	e8 ce cf ff ff       	call   800b9b <sys_cgetc>
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	74 f2                	je     803bc3 <devcons_read+0x13>
+	if (c < 0)
+  803bd1:	78 0f                	js     803be2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803bd3:	83 f8 04             	cmp    $0x4,%eax
+  803bd6:	74 0c                	je     803be4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803bd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bdb:	88 02                	mov    %al,(%edx)
+	return 1;
+  803bdd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803be2:	c9                   	leave
+  803be3:	c3                   	ret
+		return 0;
+  803be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be9:	eb f7                	jmp    803be2 <devcons_read+0x32>
+
+00803beb <cputchar>:
+{
+  803beb:	55                   	push   %ebp
+  803bec:	89 e5                	mov    %esp,%ebp
+  803bee:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bf4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803bf7:	6a 01                	push   $0x1
+  803bf9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bfc:	50                   	push   %eax
+  803bfd:	e8 6e cf ff ff       	call   800b70 <sys_cputs>
+}
+  803c02:	83 c4 10             	add    $0x10,%esp
+  803c05:	c9                   	leave
+  803c06:	c3                   	ret
+
+00803c07 <getchar>:
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803c0d:	6a 01                	push   $0x1
+  803c0f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c12:	50                   	push   %eax
+  803c13:	6a 00                	push   $0x0
+  803c15:	e8 63 d8 ff ff       	call   80147d <read>
+	if (r < 0)
+  803c1a:	83 c4 10             	add    $0x10,%esp
+  803c1d:	85 c0                	test   %eax,%eax
+  803c1f:	78 06                	js     803c27 <getchar+0x20>
+	if (r < 1)
+  803c21:	74 06                	je     803c29 <getchar+0x22>
+	return c;
+  803c23:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803c27:	c9                   	leave
+  803c28:	c3                   	ret
+		return -E_EOF;
+  803c29:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803c2e:	eb f7                	jmp    803c27 <getchar+0x20>
+
+00803c30 <iscons>:
+{
+  803c30:	55                   	push   %ebp
+  803c31:	89 e5                	mov    %esp,%ebp
+  803c33:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c39:	50                   	push   %eax
+  803c3a:	ff 75 08             	push   0x8(%ebp)
+  803c3d:	e8 ab d5 ff ff       	call   8011ed <fd_lookup>
+  803c42:	83 c4 10             	add    $0x10,%esp
+  803c45:	85 c0                	test   %eax,%eax
+  803c47:	78 11                	js     803c5a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803c49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c4c:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c52:	39 10                	cmp    %edx,(%eax)
+  803c54:	0f 94 c0             	sete   %al
+  803c57:	0f b6 c0             	movzbl %al,%eax
+}
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+
+00803c5c <opencons>:
+{
+  803c5c:	55                   	push   %ebp
+  803c5d:	89 e5                	mov    %esp,%ebp
+  803c5f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c65:	50                   	push   %eax
+  803c66:	e8 2c d5 ff ff       	call   801197 <fd_alloc>
+  803c6b:	83 c4 10             	add    $0x10,%esp
+  803c6e:	85 c0                	test   %eax,%eax
+  803c70:	78 3a                	js     803cac <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c72:	83 ec 04             	sub    $0x4,%esp
+  803c75:	68 07 04 00 00       	push   $0x407
+  803c7a:	ff 75 f4             	push   -0xc(%ebp)
+  803c7d:	6a 00                	push   $0x0
+  803c7f:	e8 e6 cf ff ff       	call   800c6a <sys_page_alloc>
+  803c84:	83 c4 10             	add    $0x10,%esp
+  803c87:	85 c0                	test   %eax,%eax
+  803c89:	78 21                	js     803cac <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c8e:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c94:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c99:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803ca0:	83 ec 0c             	sub    $0xc,%esp
+  803ca3:	50                   	push   %eax
+  803ca4:	e8 c7 d4 ff ff       	call   801170 <fd2num>
+  803ca9:	83 c4 10             	add    $0x10,%esp
+}
+  803cac:	c9                   	leave
+  803cad:	c3                   	ret
+
+00803cae <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803cae:	55                   	push   %ebp
+  803caf:	89 e5                	mov    %esp,%ebp
+  803cb1:	57                   	push   %edi
+  803cb2:	56                   	push   %esi
+  803cb3:	53                   	push   %ebx
+  803cb4:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803cb7:	89 d6                	mov    %edx,%esi
+  803cb9:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803cbc:	89 cf                	mov    %ecx,%edi
+  803cbe:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803cc1:	89 fa                	mov    %edi,%edx
+  803cc3:	80 ce 08             	or     $0x8,%dh
+  803cc6:	f6 c5 08             	test   $0x8,%ch
+  803cc9:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803ccc:	57                   	push   %edi
+  803ccd:	56                   	push   %esi
+  803cce:	50                   	push   %eax
+  803ccf:	56                   	push   %esi
+  803cd0:	6a 00                	push   $0x0
+  803cd2:	e8 e0 cf ff ff       	call   800cb7 <sys_page_map>
+	if (r < 0) {
+  803cd7:	83 c4 20             	add    $0x20,%esp
+  803cda:	85 c0                	test   %eax,%eax
+  803cdc:	78 27                	js     803d05 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803cde:	83 ec 0c             	sub    $0xc,%esp
+  803ce1:	57                   	push   %edi
+  803ce2:	56                   	push   %esi
+  803ce3:	6a 00                	push   $0x0
+  803ce5:	56                   	push   %esi
+  803ce6:	6a 00                	push   $0x0
+  803ce8:	e8 ca cf ff ff       	call   800cb7 <sys_page_map>
+  803ced:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cef:	83 c4 20             	add    $0x20,%esp
+  803cf2:	85 c0                	test   %eax,%eax
+  803cf4:	78 24                	js     803d1a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cfb:	89 d8                	mov    %ebx,%eax
+  803cfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d00:	5b                   	pop    %ebx
+  803d01:	5e                   	pop    %esi
+  803d02:	5f                   	pop    %edi
+  803d03:	5d                   	pop    %ebp
+  803d04:	c3                   	ret
+  803d05:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d07:	83 ec 08             	sub    $0x8,%esp
+  803d0a:	50                   	push   %eax
+  803d0b:	68 84 4d 80 00       	push   $0x804d84
+  803d10:	e8 33 c5 ff ff       	call   800248 <cprintf>
+		return r;
+  803d15:	83 c4 10             	add    $0x10,%esp
+  803d18:	eb e1                	jmp    803cfb <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d1a:	83 ec 08             	sub    $0x8,%esp
+  803d1d:	50                   	push   %eax
+  803d1e:	68 b4 4d 80 00       	push   $0x804db4
+  803d23:	e8 20 c5 ff ff       	call   800248 <cprintf>
+		return r;
+  803d28:	83 c4 10             	add    $0x10,%esp
+  803d2b:	eb ce                	jmp    803cfb <duppage_cow+0x4d>
+
+00803d2d <duppage>:
+{
+  803d2d:	55                   	push   %ebp
+  803d2e:	89 e5                	mov    %esp,%ebp
+  803d30:	53                   	push   %ebx
+  803d31:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803d34:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803d37:	51                   	push   %ecx
+  803d38:	52                   	push   %edx
+  803d39:	50                   	push   %eax
+  803d3a:	52                   	push   %edx
+  803d3b:	6a 00                	push   $0x0
+  803d3d:	e8 75 cf ff ff       	call   800cb7 <sys_page_map>
+	if (r < 0) {
+  803d42:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	78 07                	js     803d55 <duppage+0x28>
+}
+  803d4e:	89 d8                	mov    %ebx,%eax
+  803d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d53:	c9                   	leave
+  803d54:	c3                   	ret
+  803d55:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d57:	83 ec 08             	sub    $0x8,%esp
+  803d5a:	50                   	push   %eax
+  803d5b:	68 84 4d 80 00       	push   $0x804d84
+  803d60:	e8 e3 c4 ff ff       	call   800248 <cprintf>
+		return r;
+  803d65:	83 c4 10             	add    $0x10,%esp
+  803d68:	eb e4                	jmp    803d4e <duppage+0x21>
+
+00803d6a <cow_copy>:
+{
+  803d6a:	55                   	push   %ebp
+  803d6b:	89 e5                	mov    %esp,%ebp
+  803d6d:	56                   	push   %esi
+  803d6e:	53                   	push   %ebx
+  803d6f:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d71:	83 ec 04             	sub    $0x4,%esp
+  803d74:	6a 07                	push   $0x7
+  803d76:	68 00 f0 7f 00       	push   $0x7ff000
+  803d7b:	6a 00                	push   $0x0
+  803d7d:	e8 e8 ce ff ff       	call   800c6a <sys_page_alloc>
+	if (r < 0) {
+  803d82:	83 c4 10             	add    $0x10,%esp
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 58                	js     803de1 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d89:	83 ec 04             	sub    $0x4,%esp
+  803d8c:	68 00 10 00 00       	push   $0x1000
+  803d91:	56                   	push   %esi
+  803d92:	68 00 f0 7f 00       	push   $0x7ff000
+  803d97:	e8 16 cc ff ff       	call   8009b2 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d9c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803da3:	56                   	push   %esi
+  803da4:	6a 00                	push   $0x0
+  803da6:	68 00 f0 7f 00       	push   $0x7ff000
+  803dab:	6a 00                	push   $0x0
+  803dad:	e8 05 cf ff ff       	call   800cb7 <sys_page_map>
+  803db2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803db4:	83 c4 20             	add    $0x20,%esp
+  803db7:	85 c0                	test   %eax,%eax
+  803db9:	78 3b                	js     803df6 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803dbb:	83 ec 08             	sub    $0x8,%esp
+  803dbe:	68 00 f0 7f 00       	push   $0x7ff000
+  803dc3:	6a 00                	push   $0x0
+  803dc5:	e8 39 cf ff ff       	call   800d03 <sys_page_unmap>
+  803dca:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803dcc:	83 c4 10             	add    $0x10,%esp
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	78 45                	js     803e18 <cow_copy+0xae>
+	return 0;
+  803dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dd8:	89 d8                	mov    %ebx,%eax
+  803dda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ddd:	5b                   	pop    %ebx
+  803dde:	5e                   	pop    %esi
+  803ddf:	5d                   	pop    %ebp
+  803de0:	c3                   	ret
+  803de1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803de3:	83 ec 08             	sub    $0x8,%esp
+  803de6:	50                   	push   %eax
+  803de7:	68 a4 4e 80 00       	push   $0x804ea4
+  803dec:	e8 57 c4 ff ff       	call   800248 <cprintf>
+		return r;
+  803df1:	83 c4 10             	add    $0x10,%esp
+  803df4:	eb e2                	jmp    803dd8 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803df6:	83 ec 08             	sub    $0x8,%esp
+  803df9:	50                   	push   %eax
+  803dfa:	68 c0 4e 80 00       	push   $0x804ec0
+  803dff:	e8 44 c4 ff ff       	call   800248 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803e04:	83 c4 08             	add    $0x8,%esp
+  803e07:	68 00 f0 7f 00       	push   $0x7ff000
+  803e0c:	6a 00                	push   $0x0
+  803e0e:	e8 f0 ce ff ff       	call   800d03 <sys_page_unmap>
+		return r;
+  803e13:	83 c4 10             	add    $0x10,%esp
+  803e16:	eb c0                	jmp    803dd8 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e18:	83 ec 08             	sub    $0x8,%esp
+  803e1b:	50                   	push   %eax
+  803e1c:	68 dc 4d 80 00       	push   $0x804ddc
+  803e21:	e8 22 c4 ff ff       	call   800248 <cprintf>
+		return r;
+  803e26:	83 c4 10             	add    $0x10,%esp
+  803e29:	eb ad                	jmp    803dd8 <cow_copy+0x6e>
+
+00803e2b <pgfault>:
+{
+  803e2b:	55                   	push   %ebp
+  803e2c:	89 e5                	mov    %esp,%ebp
+  803e2e:	56                   	push   %esi
+  803e2f:	53                   	push   %ebx
+  803e30:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803e33:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803e35:	89 d8                	mov    %ebx,%eax
+  803e37:	c1 e8 16             	shr    $0x16,%eax
+  803e3a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e41:	89 de                	mov    %ebx,%esi
+  803e43:	c1 ee 0c             	shr    $0xc,%esi
+  803e46:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e4d:	a8 07                	test   $0x7,%al
+  803e4f:	74 3b                	je     803e8c <pgfault+0x61>
+  803e51:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e57:	74 33                	je     803e8c <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e59:	83 ec 0c             	sub    $0xc,%esp
+  803e5c:	68 00 f0 bf ee       	push   $0xeebff000
+  803e61:	e8 c8 f4 ff ff       	call   80332e <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e66:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e6d:	83 c4 10             	add    $0x10,%esp
+  803e70:	f6 c4 08             	test   $0x8,%ah
+  803e73:	75 30                	jne    803ea5 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e75:	83 ec 0c             	sub    $0xc,%esp
+  803e78:	68 00 f0 bf ee       	push   $0xeebff000
+  803e7d:	e8 19 f5 ff ff       	call   80339b <mutex_unlock>
+}
+  803e82:	83 c4 10             	add    $0x10,%esp
+  803e85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e88:	5b                   	pop    %ebx
+  803e89:	5e                   	pop    %esi
+  803e8a:	5d                   	pop    %ebp
+  803e8b:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e8c:	83 ec 08             	sub    $0x8,%esp
+  803e8f:	ff 72 28             	push   0x28(%edx)
+  803e92:	51                   	push   %ecx
+  803e93:	50                   	push   %eax
+  803e94:	68 00 4e 80 00       	push   $0x804e00
+  803e99:	6a 3f                	push   $0x3f
+  803e9b:	68 da 4e 80 00       	push   $0x804eda
+  803ea0:	e8 c8 c2 ff ff       	call   80016d <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803ea5:	89 d8                	mov    %ebx,%eax
+  803ea7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803eac:	e8 b9 fe ff ff       	call   803d6a <cow_copy>
+  803eb1:	eb c2                	jmp    803e75 <pgfault+0x4a>
+
+00803eb3 <cow_enable>:
+{
+  803eb3:	55                   	push   %ebp
+  803eb4:	89 e5                	mov    %esp,%ebp
+  803eb6:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803eb9:	68 2b 3e 80 00       	push   $0x803e2b
+  803ebe:	e8 49 d2 ff ff       	call   80110c <set_pgfault_handler>
+}
+  803ec3:	83 c4 10             	add    $0x10,%esp
+  803ec6:	c9                   	leave
+  803ec7:	c3                   	ret
+
+00803ec8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803ec8:	55                   	push   %ebp
+  803ec9:	89 e5                	mov    %esp,%ebp
+  803ecb:	57                   	push   %edi
+  803ecc:	56                   	push   %esi
+  803ecd:	53                   	push   %ebx
+  803ece:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ed1:	68 2b 3e 80 00       	push   $0x803e2b
+  803ed6:	e8 31 d2 ff ff       	call   80110c <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803edb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ee0:	cd 30                	int    $0x30
+  803ee2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803ee5:	83 c4 10             	add    $0x10,%esp
+  803ee8:	85 c0                	test   %eax,%eax
+  803eea:	78 4b                	js     803f37 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803eec:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803ef1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ef6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803ef9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803efd:	0f 85 16 01 00 00    	jne    804019 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f03:	e8 0a cd ff ff       	call   800c12 <sys_getenvid>
+  803f08:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f0d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f0f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f15:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f1b:	77 32                	ja     803f4f <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f1d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803f22:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f24:	c1 ea 10             	shr    $0x10,%edx
+  803f27:	74 26                	je     803f4f <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f29:	c1 e2 10             	shl    $0x10,%edx
+  803f2c:	89 d1                	mov    %edx,%ecx
+  803f2e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f33:	29 ca                	sub    %ecx,%edx
+  803f35:	eb 1e                	jmp    803f55 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803f37:	83 ec 08             	sub    $0x8,%esp
+  803f3a:	89 c7                	mov    %eax,%edi
+  803f3c:	50                   	push   %eax
+  803f3d:	68 e5 4e 80 00       	push   $0x804ee5
+  803f42:	e8 01 c3 ff ff       	call   800248 <cprintf>
+		return eid;
+  803f47:	83 c4 10             	add    $0x10,%esp
+  803f4a:	e9 6c 01 00 00       	jmp    8040bb <fork+0x1f3>
+		return pthread_main_tls;
+  803f4f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f55:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f58:	c1 e0 04             	shl    $0x4,%eax
+  803f5b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f60:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f62:	e8 10 fb ff ff       	call   803a77 <pthread_fork_child>
+		return eid;
+  803f67:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f6a:	e9 4c 01 00 00       	jmp    8040bb <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f6f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f75:	89 da                	mov    %ebx,%edx
+  803f77:	89 f8                	mov    %edi,%eax
+  803f79:	e8 af fd ff ff       	call   803d2d <duppage>
+  803f7e:	85 c0                	test   %eax,%eax
+  803f80:	79 28                	jns    803faa <fork+0xe2>
+  803f82:	89 c7                	mov    %eax,%edi
+  803f84:	e9 32 01 00 00       	jmp    8040bb <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f89:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f8f:	83 f9 05             	cmp    $0x5,%ecx
+  803f92:	75 58                	jne    803fec <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f94:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f99:	89 da                	mov    %ebx,%edx
+  803f9b:	89 f8                	mov    %edi,%eax
+  803f9d:	e8 8b fd ff ff       	call   803d2d <duppage>
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	0f 88 0f 01 00 00    	js     8040b9 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803faa:	83 c3 01             	add    $0x1,%ebx
+  803fad:	39 de                	cmp    %ebx,%esi
+  803faf:	74 54                	je     804005 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803fb1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803fb8:	f6 c1 05             	test   $0x5,%cl
+  803fbb:	74 ed                	je     803faa <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803fbd:	f6 c5 04             	test   $0x4,%ch
+  803fc0:	75 ad                	jne    803f6f <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803fc2:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803fc8:	74 bf                	je     803f89 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803fca:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803fd0:	74 d8                	je     803faa <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803fd2:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803fd8:	89 da                	mov    %ebx,%edx
+  803fda:	89 f8                	mov    %edi,%eax
+  803fdc:	e8 cd fc ff ff       	call   803cae <duppage_cow>
+  803fe1:	85 c0                	test   %eax,%eax
+  803fe3:	79 c5                	jns    803faa <fork+0xe2>
+  803fe5:	89 c7                	mov    %eax,%edi
+  803fe7:	e9 cf 00 00 00       	jmp    8040bb <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fec:	68 30 4e 80 00       	push   $0x804e30
+  803ff1:	68 3d 4c 80 00       	push   $0x804c3d
+  803ff6:	68 c6 00 00 00       	push   $0xc6
+  803ffb:	68 da 4e 80 00       	push   $0x804eda
+  804000:	e8 68 c1 ff ff       	call   80016d <_panic>
+  804005:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804008:	83 c1 01             	add    $0x1,%ecx
+  80400b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804011:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804017:	74 18                	je     804031 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804019:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804020:	a8 07                	test   $0x7,%al
+  804022:	74 e4                	je     804008 <fork+0x140>
+  804024:	89 cb                	mov    %ecx,%ebx
+  804026:	c1 e3 0a             	shl    $0xa,%ebx
+  804029:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80402c:	e9 7c ff ff ff       	jmp    803fad <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804031:	83 ec 04             	sub    $0x4,%esp
+  804034:	6a 07                	push   $0x7
+  804036:	68 00 f0 bf ee       	push   $0xeebff000
+  80403b:	ff 75 e4             	push   -0x1c(%ebp)
+  80403e:	e8 27 cc ff ff       	call   800c6a <sys_page_alloc>
+  804043:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804045:	83 c4 10             	add    $0x10,%esp
+  804048:	85 c0                	test   %eax,%eax
+  80404a:	78 34                	js     804080 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80404c:	83 ec 08             	sub    $0x8,%esp
+  80404f:	68 4a 11 80 00       	push   $0x80114a
+  804054:	ff 75 e4             	push   -0x1c(%ebp)
+  804057:	e8 8b cd ff ff       	call   800de7 <sys_env_set_pgfault_upcall>
+  80405c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80405e:	83 c4 10             	add    $0x10,%esp
+  804061:	85 c0                	test   %eax,%eax
+  804063:	78 2e                	js     804093 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804065:	83 ec 08             	sub    $0x8,%esp
+  804068:	6a 02                	push   $0x2
+  80406a:	ff 75 e4             	push   -0x1c(%ebp)
+  80406d:	e8 dd cc ff ff       	call   800d4f <sys_env_set_status>
+  804072:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804074:	83 c4 10             	add    $0x10,%esp
+  804077:	85 c0                	test   %eax,%eax
+  804079:	78 2b                	js     8040a6 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80407b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80407e:	eb 3b                	jmp    8040bb <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804080:	83 ec 08             	sub    $0x8,%esp
+  804083:	50                   	push   %eax
+  804084:	68 58 4e 80 00       	push   $0x804e58
+  804089:	e8 ba c1 ff ff       	call   800248 <cprintf>
+		return r;
+  80408e:	83 c4 10             	add    $0x10,%esp
+  804091:	eb 28                	jmp    8040bb <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804093:	83 ec 08             	sub    $0x8,%esp
+  804096:	50                   	push   %eax
+  804097:	68 80 4e 80 00       	push   $0x804e80
+  80409c:	e8 a7 c1 ff ff       	call   800248 <cprintf>
+		return r;
+  8040a1:	83 c4 10             	add    $0x10,%esp
+  8040a4:	eb 15                	jmp    8040bb <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8040a6:	83 ec 08             	sub    $0x8,%esp
+  8040a9:	50                   	push   %eax
+  8040aa:	68 f5 4e 80 00       	push   $0x804ef5
+  8040af:	e8 94 c1 ff ff       	call   800248 <cprintf>
+		return r;
+  8040b4:	83 c4 10             	add    $0x10,%esp
+  8040b7:	eb 02                	jmp    8040bb <fork+0x1f3>
+  8040b9:	89 c7                	mov    %eax,%edi
+}
+  8040bb:	89 f8                	mov    %edi,%eax
+  8040bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040c0:	5b                   	pop    %ebx
+  8040c1:	5e                   	pop    %esi
+  8040c2:	5f                   	pop    %edi
+  8040c3:	5d                   	pop    %ebp
+  8040c4:	c3                   	ret
+
+008040c5 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8040c5:	55                   	push   %ebp
+  8040c6:	89 e5                	mov    %esp,%ebp
+  8040c8:	57                   	push   %edi
+  8040c9:	56                   	push   %esi
+  8040ca:	53                   	push   %ebx
+  8040cb:	83 ec 2c             	sub    $0x2c,%esp
+  8040ce:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040d0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8040d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040db:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040e1:	77 0a                	ja     8040ed <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040e3:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8040e8:	29 c3                	sub    %eax,%ebx
+  8040ea:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040ed:	83 ec 0c             	sub    $0xc,%esp
+  8040f0:	68 2b 3e 80 00       	push   $0x803e2b
+  8040f5:	e8 12 d0 ff ff       	call   80110c <set_pgfault_handler>
+  8040fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040ff:	cd 30                	int    $0x30
+  804101:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804104:	83 c4 10             	add    $0x10,%esp
+  804107:	85 c0                	test   %eax,%eax
+  804109:	78 30                	js     80413b <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80410b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80410f:	74 42                	je     804153 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804111:	c1 e3 10             	shl    $0x10,%ebx
+  804114:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804119:	29 d8                	sub    %ebx,%eax
+  80411b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80411e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804123:	29 d8                	sub    %ebx,%eax
+  804125:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804128:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80412d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804132:	89 f7                	mov    %esi,%edi
+  804134:	89 d6                	mov    %edx,%esi
+  804136:	e9 2c 01 00 00       	jmp    804267 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80413b:	83 ec 08             	sub    $0x8,%esp
+  80413e:	89 c7                	mov    %eax,%edi
+  804140:	50                   	push   %eax
+  804141:	68 e5 4e 80 00       	push   $0x804ee5
+  804146:	e8 fd c0 ff ff       	call   800248 <cprintf>
+		return eid;
+  80414b:	83 c4 10             	add    $0x10,%esp
+  80414e:	e9 d5 00 00 00       	jmp    804228 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804153:	e8 ba ca ff ff       	call   800c12 <sys_getenvid>
+  804158:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80415d:	89 c2                	mov    %eax,%edx
+  80415f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804161:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804167:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80416c:	77 18                	ja     804186 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80416e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804173:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804175:	c1 e8 10             	shr    $0x10,%eax
+  804178:	74 0c                	je     804186 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80417a:	c1 e0 10             	shl    $0x10,%eax
+  80417d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804182:	29 c1                	sub    %eax,%ecx
+  804184:	eb 06                	jmp    80418c <sfork+0xc7>
+		return pthread_main_tls;
+  804186:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  80418c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80418f:	c1 e0 04             	shl    $0x4,%eax
+  804192:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804197:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804199:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80419c:	e9 87 00 00 00       	jmp    804228 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041a1:	f6 c5 04             	test   $0x4,%ch
+  8041a4:	74 6c                	je     804212 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8041a6:	89 ca                	mov    %ecx,%edx
+  8041a8:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8041ae:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8041b4:	74 7c                	je     804232 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041b6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041bc:	89 da                	mov    %ebx,%edx
+  8041be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041c1:	e8 67 fb ff ff       	call   803d2d <duppage>
+  8041c6:	85 c0                	test   %eax,%eax
+  8041c8:	0f 88 4f 01 00 00    	js     80431d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8041ce:	83 c3 01             	add    $0x1,%ebx
+  8041d1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8041d4:	74 7a                	je     804250 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8041d6:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8041d8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8041df:	f6 c1 01             	test   $0x1,%cl
+  8041e2:	74 ea                	je     8041ce <sfork+0x109>
+  8041e4:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041ea:	74 e2                	je     8041ce <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041ec:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041f2:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041f5:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041fa:	76 a5                	jbe    8041a1 <sfork+0xdc>
+  8041fc:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804202:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804205:	39 fa                	cmp    %edi,%edx
+  804207:	73 9d                	jae    8041a6 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804209:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80420c:	39 fa                	cmp    %edi,%edx
+  80420e:	72 96                	jb     8041a6 <sfork+0xe1>
+  804210:	eb 8f                	jmp    8041a1 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804212:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804218:	89 da                	mov    %ebx,%edx
+  80421a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80421d:	e8 8c fa ff ff       	call   803cae <duppage_cow>
+  804222:	85 c0                	test   %eax,%eax
+  804224:	79 a8                	jns    8041ce <sfork+0x109>
+  804226:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804228:	89 f8                	mov    %edi,%eax
+  80422a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80422d:	5b                   	pop    %ebx
+  80422e:	5e                   	pop    %esi
+  80422f:	5f                   	pop    %edi
+  804230:	5d                   	pop    %ebp
+  804231:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804232:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804237:	e8 2e fb ff ff       	call   803d6a <cow_copy>
+  80423c:	85 c0                	test   %eax,%eax
+  80423e:	0f 88 d2 00 00 00    	js     804316 <sfork+0x251>
+				pte = uvpt[pn];
+  804244:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80424b:	e9 66 ff ff ff       	jmp    8041b6 <sfork+0xf1>
+  804250:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804253:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804256:	83 c6 01             	add    $0x1,%esi
+  804259:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80425f:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804265:	74 1b                	je     804282 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804267:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80426e:	a8 01                	test   $0x1,%al
+  804270:	74 e4                	je     804256 <sfork+0x191>
+  804272:	89 f3                	mov    %esi,%ebx
+  804274:	c1 e3 0a             	shl    $0xa,%ebx
+  804277:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80427a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80427d:	e9 4f ff ff ff       	jmp    8041d1 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804282:	83 ec 04             	sub    $0x4,%esp
+  804285:	6a 07                	push   $0x7
+  804287:	68 00 f0 bf ee       	push   $0xeebff000
+  80428c:	ff 75 e0             	push   -0x20(%ebp)
+  80428f:	e8 d6 c9 ff ff       	call   800c6a <sys_page_alloc>
+  804294:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804296:	83 c4 10             	add    $0x10,%esp
+  804299:	85 c0                	test   %eax,%eax
+  80429b:	78 37                	js     8042d4 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80429d:	83 ec 08             	sub    $0x8,%esp
+  8042a0:	68 4a 11 80 00       	push   $0x80114a
+  8042a5:	ff 75 e0             	push   -0x20(%ebp)
+  8042a8:	e8 3a cb ff ff       	call   800de7 <sys_env_set_pgfault_upcall>
+  8042ad:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042af:	83 c4 10             	add    $0x10,%esp
+  8042b2:	85 c0                	test   %eax,%eax
+  8042b4:	78 34                	js     8042ea <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8042b6:	83 ec 08             	sub    $0x8,%esp
+  8042b9:	6a 02                	push   $0x2
+  8042bb:	ff 75 e0             	push   -0x20(%ebp)
+  8042be:	e8 8c ca ff ff       	call   800d4f <sys_env_set_status>
+  8042c3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042c5:	83 c4 10             	add    $0x10,%esp
+  8042c8:	85 c0                	test   %eax,%eax
+  8042ca:	78 34                	js     804300 <sfork+0x23b>
+	return eid;
+  8042cc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8042cf:	e9 54 ff ff ff       	jmp    804228 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8042d4:	83 ec 08             	sub    $0x8,%esp
+  8042d7:	50                   	push   %eax
+  8042d8:	68 58 4e 80 00       	push   $0x804e58
+  8042dd:	e8 66 bf ff ff       	call   800248 <cprintf>
+		return r;
+  8042e2:	83 c4 10             	add    $0x10,%esp
+  8042e5:	e9 3e ff ff ff       	jmp    804228 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042ea:	83 ec 08             	sub    $0x8,%esp
+  8042ed:	50                   	push   %eax
+  8042ee:	68 80 4e 80 00       	push   $0x804e80
+  8042f3:	e8 50 bf ff ff       	call   800248 <cprintf>
+		return r;
+  8042f8:	83 c4 10             	add    $0x10,%esp
+  8042fb:	e9 28 ff ff ff       	jmp    804228 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804300:	83 ec 08             	sub    $0x8,%esp
+  804303:	50                   	push   %eax
+  804304:	68 f5 4e 80 00       	push   $0x804ef5
+  804309:	e8 3a bf ff ff       	call   800248 <cprintf>
+		return r;
+  80430e:	83 c4 10             	add    $0x10,%esp
+  804311:	e9 12 ff ff ff       	jmp    804228 <sfork+0x163>
+  804316:	89 c7                	mov    %eax,%edi
+  804318:	e9 0b ff ff ff       	jmp    804228 <sfork+0x163>
+  80431d:	89 c7                	mov    %eax,%edi
+  80431f:	e9 04 ff ff ff       	jmp    804228 <sfork+0x163>
+
+00804324 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804324:	55                   	push   %ebp
+  804325:	89 e5                	mov    %esp,%ebp
+  804327:	57                   	push   %edi
+  804328:	56                   	push   %esi
+  804329:	53                   	push   %ebx
+  80432a:	83 ec 18             	sub    $0x18,%esp
+  80432d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804330:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804333:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804336:	85 c0                	test   %eax,%eax
+  804338:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80433d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804340:	50                   	push   %eax
+  804341:	e8 1a cb ff ff       	call   800e60 <sys_ipc_recv>
+	if (r < 0) {
+  804346:	83 c4 10             	add    $0x10,%esp
+  804349:	85 c0                	test   %eax,%eax
+  80434b:	78 2b                	js     804378 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80434d:	85 ff                	test   %edi,%edi
+  80434f:	74 55                	je     8043a6 <ipc_recv+0x82>
+  804351:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804353:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804359:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80435e:	77 39                	ja     804399 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804360:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804365:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804367:	c1 e8 10             	shr    $0x10,%eax
+  80436a:	74 2d                	je     804399 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80436c:	c1 e0 10             	shl    $0x10,%eax
+  80436f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804374:	29 c2                	sub    %eax,%edx
+  804376:	eb 27                	jmp    80439f <ipc_recv+0x7b>
+  804378:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80437a:	83 ec 08             	sub    $0x8,%esp
+  80437d:	50                   	push   %eax
+  80437e:	68 13 4f 80 00       	push   $0x804f13
+  804383:	e8 c0 be ff ff       	call   800248 <cprintf>
+		*from_env_store = 0;
+  804388:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80438e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804394:	83 c4 10             	add    $0x10,%esp
+  804397:	eb 77                	jmp    804410 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804399:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80439f:	8b 02                	mov    (%edx),%eax
+  8043a1:	8b 40 78             	mov    0x78(%eax),%eax
+  8043a4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8043a6:	85 f6                	test   %esi,%esi
+  8043a8:	74 34                	je     8043de <ipc_recv+0xba>
+  8043aa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043ac:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043b2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b7:	77 18                	ja     8043d1 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043be:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043c0:	c1 e8 10             	shr    $0x10,%eax
+  8043c3:	74 0c                	je     8043d1 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043c5:	c1 e0 10             	shl    $0x10,%eax
+  8043c8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043cd:	29 c2                	sub    %eax,%edx
+  8043cf:	eb 06                	jmp    8043d7 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8043d1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8043d7:	8b 02                	mov    (%edx),%eax
+  8043d9:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043dc:	89 06                	mov    %eax,(%esi)
+  8043de:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043e0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043e6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043eb:	77 18                	ja     804405 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043ed:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043f2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043f4:	c1 e8 10             	shr    $0x10,%eax
+  8043f7:	74 0c                	je     804405 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043f9:	c1 e0 10             	shl    $0x10,%eax
+  8043fc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804401:	29 c2                	sub    %eax,%edx
+  804403:	eb 06                	jmp    80440b <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804405:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80440b:	8b 02                	mov    (%edx),%eax
+  80440d:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804410:	89 d8                	mov    %ebx,%eax
+  804412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804415:	5b                   	pop    %ebx
+  804416:	5e                   	pop    %esi
+  804417:	5f                   	pop    %edi
+  804418:	5d                   	pop    %ebp
+  804419:	c3                   	ret
+
+0080441a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80441a:	55                   	push   %ebp
+  80441b:	89 e5                	mov    %esp,%ebp
+  80441d:	57                   	push   %edi
+  80441e:	56                   	push   %esi
+  80441f:	53                   	push   %ebx
+  804420:	83 ec 0c             	sub    $0xc,%esp
+  804423:	8b 75 08             	mov    0x8(%ebp),%esi
+  804426:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804429:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80442c:	85 db                	test   %ebx,%ebx
+  80442e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804433:	0f 44 d8             	cmove  %eax,%ebx
+  804436:	eb 05                	jmp    80443d <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804438:	e8 01 c8 ff ff       	call   800c3e <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80443d:	57                   	push   %edi
+  80443e:	53                   	push   %ebx
+  80443f:	ff 75 0c             	push   0xc(%ebp)
+  804442:	56                   	push   %esi
+  804443:	e8 eb c9 ff ff       	call   800e33 <sys_ipc_try_send>
+		if (r == 0) {
+  804448:	83 c4 10             	add    $0x10,%esp
+  80444b:	85 c0                	test   %eax,%eax
+  80444d:	74 19                	je     804468 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80444f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804452:	74 e4                	je     804438 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804454:	83 ec 0c             	sub    $0xc,%esp
+  804457:	50                   	push   %eax
+  804458:	57                   	push   %edi
+  804459:	53                   	push   %ebx
+  80445a:	56                   	push   %esi
+  80445b:	68 2c 4f 80 00       	push   $0x804f2c
+  804460:	e8 e3 bd ff ff       	call   800248 <cprintf>
+			return;
+  804465:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80446b:	5b                   	pop    %ebx
+  80446c:	5e                   	pop    %esi
+  80446d:	5f                   	pop    %edi
+  80446e:	5d                   	pop    %ebp
+  80446f:	c3                   	ret
+
+00804470 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804470:	55                   	push   %ebp
+  804471:	89 e5                	mov    %esp,%ebp
+  804473:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804476:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80447b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80447e:	c1 e0 04             	shl    $0x4,%eax
+  804481:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804486:	8b 40 50             	mov    0x50(%eax),%eax
+  804489:	39 c8                	cmp    %ecx,%eax
+  80448b:	74 12                	je     80449f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80448d:	83 c2 01             	add    $0x1,%edx
+  804490:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804496:	75 e3                	jne    80447b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449d:	eb 0e                	jmp    8044ad <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80449f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044a2:	c1 e0 04             	shl    $0x4,%eax
+  8044a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044aa:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8044ad:	5d                   	pop    %ebp
+  8044ae:	c3                   	ret
+
+008044af <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044af:	55                   	push   %ebp
+  8044b0:	89 e5                	mov    %esp,%ebp
+  8044b2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044b5:	89 c2                	mov    %eax,%edx
+  8044b7:	c1 ea 16             	shr    $0x16,%edx
+  8044ba:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044c1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044c6:	f6 c1 01             	test   $0x1,%cl
+  8044c9:	74 1c                	je     8044e7 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044cb:	c1 e8 0c             	shr    $0xc,%eax
+  8044ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044d5:	a8 01                	test   $0x1,%al
+  8044d7:	74 0e                	je     8044e7 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044d9:	c1 e8 0c             	shr    $0xc,%eax
+  8044dc:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044e3:	ef 
+  8044e4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044e7:	89 d0                	mov    %edx,%eax
+  8044e9:	5d                   	pop    %ebp
+  8044ea:	c3                   	ret
+
+008044eb <udm>:
+  8044eb:	57                   	push   %edi
+  8044ec:	56                   	push   %esi
+  8044ed:	53                   	push   %ebx
+  8044ee:	83 ec 20             	sub    $0x20,%esp
+  8044f1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044f5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044f9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044fd:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804501:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804505:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804509:	89 d1                	mov    %edx,%ecx
+  80450b:	09 c1                	or     %eax,%ecx
+  80450d:	0f 84 91 00 00 00    	je     8045a4 <udm+0xb9>
+  804513:	b8 00 00 00 00       	mov    $0x0,%eax
+  804518:	ba 00 00 00 00       	mov    $0x0,%edx
+  80451d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804522:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804529:	00 
+  80452a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804531:	00 
+  804532:	eb 08                	jmp    80453c <udm+0x51>
+  804534:	83 e9 01             	sub    $0x1,%ecx
+  804537:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80453a:	74 7c                	je     8045b8 <udm+0xcd>
+  80453c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804540:	01 c0                	add    %eax,%eax
+  804542:	89 c6                	mov    %eax,%esi
+  804544:	89 d7                	mov    %edx,%edi
+  804546:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80454a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80454e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804551:	d3 ea                	shr    %cl,%edx
+  804553:	f6 c1 20             	test   $0x20,%cl
+  804556:	74 04                	je     80455c <udm+0x71>
+  804558:	89 d0                	mov    %edx,%eax
+  80455a:	31 d2                	xor    %edx,%edx
+  80455c:	83 e0 01             	and    $0x1,%eax
+  80455f:	89 04 24             	mov    %eax,(%esp)
+  804562:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804569:	00 
+  80456a:	8b 04 24             	mov    (%esp),%eax
+  80456d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804571:	09 f0                	or     %esi,%eax
+  804573:	09 fa                	or     %edi,%edx
+  804575:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804579:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80457d:	39 f0                	cmp    %esi,%eax
+  80457f:	89 d3                	mov    %edx,%ebx
+  804581:	19 fb                	sbb    %edi,%ebx
+  804583:	72 af                	jb     804534 <udm+0x49>
+  804585:	29 f0                	sub    %esi,%eax
+  804587:	19 fa                	sbb    %edi,%edx
+  804589:	89 cf                	mov    %ecx,%edi
+  80458b:	c1 ef 05             	shr    $0x5,%edi
+  80458e:	83 e7 01             	and    $0x1,%edi
+  804591:	89 fe                	mov    %edi,%esi
+  804593:	83 f6 01             	xor    $0x1,%esi
+  804596:	d3 e6                	shl    %cl,%esi
+  804598:	d3 e7                	shl    %cl,%edi
+  80459a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80459e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045a2:	eb 90                	jmp    804534 <udm+0x49>
+  8045a4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045a8:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045ac:	89 f0                	mov    %esi,%eax
+  8045ae:	89 fa                	mov    %edi,%edx
+  8045b0:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045b4:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045b8:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045bc:	89 01                	mov    %eax,(%ecx)
+  8045be:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045c9:	83 c4 20             	add    $0x20,%esp
+  8045cc:	5b                   	pop    %ebx
+  8045cd:	5e                   	pop    %esi
+  8045ce:	5f                   	pop    %edi
+  8045cf:	c3                   	ret
+
+008045d0 <__udivdi3>:
+  8045d0:	83 ec 18             	sub    $0x18,%esp
+  8045d3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045d7:	50                   	push   %eax
+  8045d8:	ff 74 24 2c          	push   0x2c(%esp)
+  8045dc:	ff 74 24 2c          	push   0x2c(%esp)
+  8045e0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045e4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045e8:	e8 fe fe ff ff       	call   8044eb <udm>
+  8045ed:	83 c4 24             	add    $0x24,%esp
+  8045f0:	c3                   	ret
+
+008045f1 <__umoddi3>:
+  8045f1:	83 ec 18             	sub    $0x18,%esp
+  8045f4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045f8:	50                   	push   %eax
+  8045f9:	ff 74 24 2c          	push   0x2c(%esp)
+  8045fd:	ff 74 24 2c          	push   0x2c(%esp)
+  804601:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804605:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804609:	e8 dd fe ff ff       	call   8044eb <udm>
+  80460e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804612:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804616:	83 c4 24             	add    $0x24,%esp
+  804619:	c3                   	ret
+
+0080461a <__divdi3>:
+  80461a:	56                   	push   %esi
+  80461b:	53                   	push   %ebx
+  80461c:	83 ec 14             	sub    $0x14,%esp
+  80461f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804623:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804627:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80462b:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80462f:	85 d2                	test   %edx,%edx
+  804631:	78 18                	js     80464b <__divdi3+0x31>
+  804633:	85 db                	test   %ebx,%ebx
+  804635:	78 3e                	js     804675 <__divdi3+0x5b>
+  804637:	83 ec 04             	sub    $0x4,%esp
+  80463a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80463e:	56                   	push   %esi
+  80463f:	53                   	push   %ebx
+  804640:	51                   	push   %ecx
+  804641:	e8 a5 fe ff ff       	call   8044eb <udm>
+  804646:	83 c4 10             	add    $0x10,%esp
+  804649:	eb 24                	jmp    80466f <__divdi3+0x55>
+  80464b:	f7 d8                	neg    %eax
+  80464d:	83 d2 00             	adc    $0x0,%edx
+  804650:	f7 da                	neg    %edx
+  804652:	85 db                	test   %ebx,%ebx
+  804654:	78 3a                	js     804690 <__divdi3+0x76>
+  804656:	83 ec 04             	sub    $0x4,%esp
+  804659:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80465d:	56                   	push   %esi
+  80465e:	53                   	push   %ebx
+  80465f:	51                   	push   %ecx
+  804660:	e8 86 fe ff ff       	call   8044eb <udm>
+  804665:	83 c4 10             	add    $0x10,%esp
+  804668:	f7 d8                	neg    %eax
+  80466a:	83 d2 00             	adc    $0x0,%edx
+  80466d:	f7 da                	neg    %edx
+  80466f:	83 c4 14             	add    $0x14,%esp
+  804672:	5b                   	pop    %ebx
+  804673:	5e                   	pop    %esi
+  804674:	c3                   	ret
+  804675:	83 ec 04             	sub    $0x4,%esp
+  804678:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80467c:	56                   	push   %esi
+  80467d:	f7 d9                	neg    %ecx
+  80467f:	83 d3 00             	adc    $0x0,%ebx
+  804682:	f7 db                	neg    %ebx
+  804684:	53                   	push   %ebx
+  804685:	51                   	push   %ecx
+  804686:	e8 60 fe ff ff       	call   8044eb <udm>
+  80468b:	83 c4 10             	add    $0x10,%esp
+  80468e:	eb d8                	jmp    804668 <__divdi3+0x4e>
+  804690:	83 ec 04             	sub    $0x4,%esp
+  804693:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804697:	56                   	push   %esi
+  804698:	f7 d9                	neg    %ecx
+  80469a:	83 d3 00             	adc    $0x0,%ebx
+  80469d:	f7 db                	neg    %ebx
+  80469f:	53                   	push   %ebx
+  8046a0:	51                   	push   %ecx
+  8046a1:	e8 45 fe ff ff       	call   8044eb <udm>
+  8046a6:	83 c4 10             	add    $0x10,%esp
+  8046a9:	eb c4                	jmp    80466f <__divdi3+0x55>
+
+008046ab <__moddi3>:
+  8046ab:	55                   	push   %ebp
+  8046ac:	57                   	push   %edi
+  8046ad:	56                   	push   %esi
+  8046ae:	53                   	push   %ebx
+  8046af:	83 ec 24             	sub    $0x24,%esp
+  8046b2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046b6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046ba:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046be:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046c2:	85 d2                	test   %edx,%edx
+  8046c4:	78 3b                	js     804701 <__moddi3+0x56>
+  8046c6:	83 ec 04             	sub    $0x4,%esp
+  8046c9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046cd:	56                   	push   %esi
+  8046ce:	89 ce                	mov    %ecx,%esi
+  8046d0:	f7 de                	neg    %esi
+  8046d2:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046d6:	89 de                	mov    %ebx,%esi
+  8046d8:	83 d6 00             	adc    $0x0,%esi
+  8046db:	f7 de                	neg    %esi
+  8046dd:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046e1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046e5:	0f 48 f1             	cmovs  %ecx,%esi
+  8046e8:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046ed:	53                   	push   %ebx
+  8046ee:	56                   	push   %esi
+  8046ef:	e8 f7 fd ff ff       	call   8044eb <udm>
+  8046f4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046f8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046fc:	83 c4 10             	add    $0x10,%esp
+  8046ff:	eb 47                	jmp    804748 <__moddi3+0x9d>
+  804701:	f7 d8                	neg    %eax
+  804703:	83 d2 00             	adc    $0x0,%edx
+  804706:	f7 da                	neg    %edx
+  804708:	83 ec 04             	sub    $0x4,%esp
+  80470b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80470f:	56                   	push   %esi
+  804710:	89 cf                	mov    %ecx,%edi
+  804712:	f7 df                	neg    %edi
+  804714:	89 de                	mov    %ebx,%esi
+  804716:	83 d6 00             	adc    $0x0,%esi
+  804719:	f7 de                	neg    %esi
+  80471b:	0f 49 cf             	cmovns %edi,%ecx
+  80471e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804722:	0f 49 de             	cmovns %esi,%ebx
+  804725:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804729:	ff 74 24 0c          	push   0xc(%esp)
+  80472d:	ff 74 24 0c          	push   0xc(%esp)
+  804731:	e8 b5 fd ff ff       	call   8044eb <udm>
+  804736:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80473a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80473e:	f7 d8                	neg    %eax
+  804740:	83 d2 00             	adc    $0x0,%edx
+  804743:	f7 da                	neg    %edx
+  804745:	83 c4 10             	add    $0x10,%esp
+  804748:	83 c4 24             	add    $0x24,%esp
+  80474b:	5b                   	pop    %ebx
+  80474c:	5e                   	pop    %esi
+  80474d:	5f                   	pop    %edi
+  80474e:	5d                   	pop    %ebp
+  80474f:	c3                   	ret
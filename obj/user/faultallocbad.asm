@@ -0,0 +1,9742 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 40 47 80 00       	push   $0x804740
+  800045:	e8 e9 01 00 00       	call   800233 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 f7 0b 00 00       	call   800c55 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 8c 47 80 00       	push   $0x80478c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 4f 07 00 00       	call   8007c2 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 60 47 80 00       	push   $0x804760
+  800085:	6a 0f                	push   $0xf
+  800087:	68 4a 47 80 00       	push   $0x80474a
+  80008c:	e8 c7 00 00 00       	call   800158 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 56 10 00 00       	call   8010f7 <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 ab 0a 00 00       	call   800b5b <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	57                   	push   %edi
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 1c             	sub    $0x1c,%esp
+  8000be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000c4:	e8 34 0b 00 00       	call   800bfd <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000c9:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000cc:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d7:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000d9:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000db:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000e1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000e6:	77 16                	ja     8000fe <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000e8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000ed:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000ef:	c1 e8 10             	shr    $0x10,%eax
+  8000f2:	74 0a                	je     8000fe <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000f4:	c1 e0 10             	shl    $0x10,%eax
+  8000f7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000fc:	29 c2                	sub    %eax,%edx
+  8000fe:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800101:	c1 e0 04             	shl    $0x4,%eax
+  800104:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800109:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010b:	85 db                	test   %ebx,%ebx
+  80010d:	7e 07                	jle    800116 <libmain+0x61>
+		binaryname = argv[0];
+  80010f:	8b 06                	mov    (%esi),%eax
+  800111:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  80011b:	e8 71 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800120:	e8 0b 00 00 00       	call   800130 <exit>
+}
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+
+00800130 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800136:	6a 00                	push   $0x0
+  800138:	e8 79 21 00 00       	call   8022b6 <fflush>
+	pthread_kill_others();
+  80013d:	e8 e4 37 00 00       	call   803926 <pthread_kill_others>
+	close_all();
+  800142:	e8 12 12 00 00       	call   801359 <close_all>
+	sys_env_destroy(0);
+  800147:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80014e:	e8 5f 0a 00 00       	call   800bb2 <sys_env_destroy>
+}
+  800153:	83 c4 10             	add    $0x10,%esp
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+
+00800158 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	56                   	push   %esi
+  80015c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800160:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800166:	e8 92 0a 00 00       	call   800bfd <sys_getenvid>
+  80016b:	83 ec 0c             	sub    $0xc,%esp
+  80016e:	ff 75 0c             	push   0xc(%ebp)
+  800171:	ff 75 08             	push   0x8(%ebp)
+  800174:	56                   	push   %esi
+  800175:	50                   	push   %eax
+  800176:	68 b8 47 80 00       	push   $0x8047b8
+  80017b:	e8 b3 00 00 00       	call   800233 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800180:	83 c4 18             	add    $0x18,%esp
+  800183:	53                   	push   %ebx
+  800184:	ff 75 10             	push   0x10(%ebp)
+  800187:	e8 56 00 00 00       	call   8001e2 <vcprintf>
+	cprintf("\n");
+  80018c:	c7 04 24 9e 4e 80 00 	movl   $0x804e9e,(%esp)
+  800193:	e8 9b 00 00 00       	call   800233 <cprintf>
+  800198:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019b:	cc                   	int3
+	while (1)
+  80019c:	eb fd                	jmp    80019b <_panic+0x43>
+
+0080019e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019e:	55                   	push   %ebp
+  80019f:	89 e5                	mov    %esp,%ebp
+  8001a1:	53                   	push   %ebx
+  8001a2:	83 ec 04             	sub    $0x4,%esp
+  8001a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a8:	8b 13                	mov    (%ebx),%edx
+  8001aa:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ad:	89 03                	mov    %eax,(%ebx)
+  8001af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bb:	74 09                	je     8001c6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001bd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c4:	c9                   	leave
+  8001c5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	68 ff 00 00 00       	push   $0xff
+  8001ce:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d1:	50                   	push   %eax
+  8001d2:	e8 84 09 00 00       	call   800b5b <sys_cputs>
+		b->idx = 0;
+  8001d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001dd:	83 c4 10             	add    $0x10,%esp
+  8001e0:	eb db                	jmp    8001bd <putch+0x1f>
+
+008001e2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001eb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f2:	00 00 00 
+	b.cnt = 0;
+  8001f5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ff:	ff 75 0c             	push   0xc(%ebp)
+  800202:	ff 75 08             	push   0x8(%ebp)
+  800205:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020b:	50                   	push   %eax
+  80020c:	68 9e 01 80 00       	push   $0x80019e
+  800211:	e8 14 01 00 00       	call   80032a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800216:	83 c4 08             	add    $0x8,%esp
+  800219:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800225:	50                   	push   %eax
+  800226:	e8 30 09 00 00       	call   800b5b <sys_cputs>
+
+	return b.cnt;
+}
+  80022b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800239:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023c:	50                   	push   %eax
+  80023d:	ff 75 08             	push   0x8(%ebp)
+  800240:	e8 9d ff ff ff       	call   8001e2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+00800247 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	57                   	push   %edi
+  80024b:	56                   	push   %esi
+  80024c:	53                   	push   %ebx
+  80024d:	83 ec 1c             	sub    $0x1c,%esp
+  800250:	89 c7                	mov    %eax,%edi
+  800252:	89 d6                	mov    %edx,%esi
+  800254:	8b 45 08             	mov    0x8(%ebp),%eax
+  800257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025a:	89 d1                	mov    %edx,%ecx
+  80025c:	89 c2                	mov    %eax,%edx
+  80025e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800261:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800264:	8b 45 10             	mov    0x10(%ebp),%eax
+  800267:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80026a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800274:	39 c2                	cmp    %eax,%edx
+  800276:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800279:	72 3e                	jb     8002b9 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027b:	83 ec 0c             	sub    $0xc,%esp
+  80027e:	ff 75 18             	push   0x18(%ebp)
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	53                   	push   %ebx
+  800285:	50                   	push   %eax
+  800286:	83 ec 08             	sub    $0x8,%esp
+  800289:	ff 75 e4             	push   -0x1c(%ebp)
+  80028c:	ff 75 e0             	push   -0x20(%ebp)
+  80028f:	ff 75 dc             	push   -0x24(%ebp)
+  800292:	ff 75 d8             	push   -0x28(%ebp)
+  800295:	e8 21 43 00 00       	call   8045bb <__udivdi3>
+  80029a:	83 c4 18             	add    $0x18,%esp
+  80029d:	52                   	push   %edx
+  80029e:	50                   	push   %eax
+  80029f:	89 f2                	mov    %esi,%edx
+  8002a1:	89 f8                	mov    %edi,%eax
+  8002a3:	e8 9f ff ff ff       	call   800247 <printnum>
+  8002a8:	83 c4 20             	add    $0x20,%esp
+  8002ab:	eb 13                	jmp    8002c0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+  8002b0:	56                   	push   %esi
+  8002b1:	ff 75 18             	push   0x18(%ebp)
+  8002b4:	ff d7                	call   *%edi
+  8002b6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b9:	83 eb 01             	sub    $0x1,%ebx
+  8002bc:	85 db                	test   %ebx,%ebx
+  8002be:	7f ed                	jg     8002ad <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	56                   	push   %esi
+  8002c4:	83 ec 04             	sub    $0x4,%esp
+  8002c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ca:	ff 75 e0             	push   -0x20(%ebp)
+  8002cd:	ff 75 dc             	push   -0x24(%ebp)
+  8002d0:	ff 75 d8             	push   -0x28(%ebp)
+  8002d3:	e8 04 43 00 00       	call   8045dc <__umoddi3>
+  8002d8:	83 c4 14             	add    $0x14,%esp
+  8002db:	0f be 80 db 47 80 00 	movsbl 0x8047db(%eax),%eax
+  8002e2:	50                   	push   %eax
+  8002e3:	ff d7                	call   *%edi
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+
+008002f0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002fa:	8b 10                	mov    (%eax),%edx
+  8002fc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002ff:	73 0a                	jae    80030b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800301:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800304:	89 08                	mov    %ecx,(%eax)
+  800306:	8b 45 08             	mov    0x8(%ebp),%eax
+  800309:	88 02                	mov    %al,(%edx)
+}
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+
+0080030d <printfmt>:
+{
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800313:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800316:	50                   	push   %eax
+  800317:	ff 75 10             	push   0x10(%ebp)
+  80031a:	ff 75 0c             	push   0xc(%ebp)
+  80031d:	ff 75 08             	push   0x8(%ebp)
+  800320:	e8 05 00 00 00       	call   80032a <vprintfmt>
+}
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	c9                   	leave
+  800329:	c3                   	ret
+
+0080032a <vprintfmt>:
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	57                   	push   %edi
+  80032e:	56                   	push   %esi
+  80032f:	53                   	push   %ebx
+  800330:	83 ec 2c             	sub    $0x2c,%esp
+  800333:	8b 75 08             	mov    0x8(%ebp),%esi
+  800336:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800339:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033c:	eb 0a                	jmp    800348 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033e:	83 ec 08             	sub    $0x8,%esp
+  800341:	53                   	push   %ebx
+  800342:	50                   	push   %eax
+  800343:	ff d6                	call   *%esi
+  800345:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800348:	83 c7 01             	add    $0x1,%edi
+  80034b:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80034f:	83 f8 25             	cmp    $0x25,%eax
+  800352:	74 0c                	je     800360 <vprintfmt+0x36>
+			if (ch == '\0')
+  800354:	85 c0                	test   %eax,%eax
+  800356:	75 e6                	jne    80033e <vprintfmt+0x14>
+}
+  800358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035b:	5b                   	pop    %ebx
+  80035c:	5e                   	pop    %esi
+  80035d:	5f                   	pop    %edi
+  80035e:	5d                   	pop    %ebp
+  80035f:	c3                   	ret
+		padc = ' ';
+  800360:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800364:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800372:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800379:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80037e:	8d 47 01             	lea    0x1(%edi),%eax
+  800381:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800384:	0f b6 17             	movzbl (%edi),%edx
+  800387:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80038a:	3c 55                	cmp    $0x55,%al
+  80038c:	0f 87 c5 03 00 00    	ja     800757 <vprintfmt+0x42d>
+  800392:	0f b6 c0             	movzbl %al,%eax
+  800395:	ff 24 85 60 49 80 00 	jmp    *0x804960(,%eax,4)
+  80039c:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80039f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a2:	eb da                	jmp    80037e <vprintfmt+0x54>
+  8003a4:	0f be d2             	movsbl %dl,%edx
+  8003a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003b2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003bc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003bf:	83 f9 09             	cmp    $0x9,%ecx
+  8003c2:	77 55                	ja     800419 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003c4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c7:	eb e9                	jmp    8003b2 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8b 00                	mov    (%eax),%eax
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003dd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e1:	79 9b                	jns    80037e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003e3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f0:	eb 8c                	jmp    80037e <vprintfmt+0x54>
+			if (width < 0)
+  8003f2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f5:	85 d2                	test   %edx,%edx
+  8003f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fc:	0f 49 c2             	cmovns %edx,%eax
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800405:	e9 74 ff ff ff       	jmp    80037e <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80040a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80040d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800414:	e9 65 ff ff ff       	jmp    80037e <vprintfmt+0x54>
+  800419:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041f:	eb bc                	jmp    8003dd <vprintfmt+0xb3>
+			lflag++;
+  800421:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800427:	e9 52 ff ff ff       	jmp    80037e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8d 78 04             	lea    0x4(%eax),%edi
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	ff 30                	push   (%eax)
+  800438:	ff d6                	call   *%esi
+			break;
+  80043a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80043d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800440:	e9 b1 02 00 00       	jmp    8006f6 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800445:	8b 45 14             	mov    0x14(%ebp),%eax
+  800448:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80044b:	8b 10                	mov    (%eax),%edx
+  80044d:	89 d0                	mov    %edx,%eax
+  80044f:	f7 d8                	neg    %eax
+  800451:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800454:	83 f8 14             	cmp    $0x14,%eax
+  800457:	7f 23                	jg     80047c <vprintfmt+0x152>
+  800459:	8b 14 85 c0 4a 80 00 	mov    0x804ac0(,%eax,4),%edx
+  800460:	85 d2                	test   %edx,%edx
+  800462:	74 18                	je     80047c <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800464:	52                   	push   %edx
+  800465:	68 2f 4c 80 00       	push   $0x804c2f
+  80046a:	53                   	push   %ebx
+  80046b:	56                   	push   %esi
+  80046c:	e8 9c fe ff ff       	call   80030d <printfmt>
+  800471:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800474:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800477:	e9 7a 02 00 00       	jmp    8006f6 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80047c:	50                   	push   %eax
+  80047d:	68 f3 47 80 00       	push   $0x8047f3
+  800482:	53                   	push   %ebx
+  800483:	56                   	push   %esi
+  800484:	e8 84 fe ff ff       	call   80030d <printfmt>
+  800489:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048f:	e9 62 02 00 00       	jmp    8006f6 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800494:	8b 45 14             	mov    0x14(%ebp),%eax
+  800497:	83 c0 04             	add    $0x4,%eax
+  80049a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004a2:	85 c9                	test   %ecx,%ecx
+  8004a4:	b8 ec 47 80 00       	mov    $0x8047ec,%eax
+  8004a9:	0f 45 c1             	cmovne %ecx,%eax
+  8004ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b3:	7e 06                	jle    8004bb <vprintfmt+0x191>
+  8004b5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b9:	75 0b                	jne    8004c6 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004be:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c4:	eb 5c                	jmp    800522 <vprintfmt+0x1f8>
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	ff 75 d0             	push   -0x30(%ebp)
+  8004cc:	ff 75 cc             	push   -0x34(%ebp)
+  8004cf:	e8 20 03 00 00       	call   8007f4 <strnlen>
+  8004d4:	89 c2                	mov    %eax,%edx
+  8004d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d9:	29 d0                	sub    %edx,%eax
+  8004db:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004de:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ea:	eb 0e                	jmp    8004fa <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004ec:	83 ec 08             	sub    $0x8,%esp
+  8004ef:	53                   	push   %ebx
+  8004f0:	57                   	push   %edi
+  8004f1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f4:	83 ee 01             	sub    $0x1,%esi
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	85 f6                	test   %esi,%esi
+  8004fc:	7f ee                	jg     8004ec <vprintfmt+0x1c2>
+  8004fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800501:	8b 75 08             	mov    0x8(%ebp),%esi
+  800504:	85 c0                	test   %eax,%eax
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	0f 49 d0             	cmovns %eax,%edx
+  80050e:	29 d0                	sub    %edx,%eax
+  800510:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800513:	eb a6                	jmp    8004bb <vprintfmt+0x191>
+					putch(ch, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	52                   	push   %edx
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800520:	89 f1                	mov    %esi,%ecx
+  800522:	8d 71 01             	lea    0x1(%ecx),%esi
+  800525:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800529:	0f be d0             	movsbl %al,%edx
+  80052c:	85 d2                	test   %edx,%edx
+  80052e:	74 28                	je     800558 <vprintfmt+0x22e>
+  800530:	85 ff                	test   %edi,%edi
+  800532:	78 05                	js     800539 <vprintfmt+0x20f>
+  800534:	83 ef 01             	sub    $0x1,%edi
+  800537:	78 30                	js     800569 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800539:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053d:	74 d6                	je     800515 <vprintfmt+0x1eb>
+  80053f:	0f be c0             	movsbl %al,%eax
+  800542:	83 e8 20             	sub    $0x20,%eax
+  800545:	83 f8 5e             	cmp    $0x5e,%eax
+  800548:	76 cb                	jbe    800515 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	6a 3f                	push   $0x3f
+  800550:	ff 55 08             	call   *0x8(%ebp)
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	eb c8                	jmp    800520 <vprintfmt+0x1f6>
+  800558:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800561:	01 d0                	add    %edx,%eax
+  800563:	29 c8                	sub    %ecx,%eax
+  800565:	89 c7                	mov    %eax,%edi
+  800567:	eb 13                	jmp    80057c <vprintfmt+0x252>
+  800569:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056c:	eb ed                	jmp    80055b <vprintfmt+0x231>
+				putch(' ', putdat);
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	53                   	push   %ebx
+  800572:	6a 20                	push   $0x20
+  800574:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	85 ff                	test   %edi,%edi
+  80057e:	7f ee                	jg     80056e <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800580:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800583:	89 45 14             	mov    %eax,0x14(%ebp)
+  800586:	e9 6b 01 00 00       	jmp    8006f6 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80058b:	83 f9 01             	cmp    $0x1,%ecx
+  80058e:	7f 1f                	jg     8005af <vprintfmt+0x285>
+	else if (lflag)
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	74 67                	je     8005fb <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	89 c1                	mov    %eax,%ecx
+  80059e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	eb 17                	jmp    8005c6 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ba:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005c6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d1:	85 c9                	test   %ecx,%ecx
+  8005d3:	0f 89 03 01 00 00    	jns    8006dc <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 2d                	push   $0x2d
+  8005df:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e7:	f7 da                	neg    %edx
+  8005e9:	83 d1 00             	adc    $0x0,%ecx
+  8005ec:	f7 d9                	neg    %ecx
+  8005ee:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f6:	e9 e1 00 00 00       	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800603:	89 c1                	mov    %eax,%ecx
+  800605:	c1 f9 1f             	sar    $0x1f,%ecx
+  800608:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8d 40 04             	lea    0x4(%eax),%eax
+  800611:	89 45 14             	mov    %eax,0x14(%ebp)
+  800614:	eb b0                	jmp    8005c6 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800616:	83 f9 01             	cmp    $0x1,%ecx
+  800619:	7f 1e                	jg     800639 <vprintfmt+0x30f>
+	else if (lflag)
+  80061b:	85 c9                	test   %ecx,%ecx
+  80061d:	74 32                	je     800651 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800634:	e9 a3 00 00 00       	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 10                	mov    (%eax),%edx
+  80063e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800641:	8d 40 08             	lea    0x8(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800647:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80064c:	e9 8b 00 00 00       	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800651:	8b 45 14             	mov    0x14(%ebp),%eax
+  800654:	8b 10                	mov    (%eax),%edx
+  800656:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065b:	8d 40 04             	lea    0x4(%eax),%eax
+  80065e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800661:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800666:	eb 74                	jmp    8006dc <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800668:	83 f9 01             	cmp    $0x1,%ecx
+  80066b:	7f 1b                	jg     800688 <vprintfmt+0x35e>
+	else if (lflag)
+  80066d:	85 c9                	test   %ecx,%ecx
+  80066f:	74 2c                	je     80069d <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800681:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800686:	eb 54                	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 10                	mov    (%eax),%edx
+  80068d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800690:	8d 40 08             	lea    0x8(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800696:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80069b:	eb 3f                	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 10                	mov    (%eax),%edx
+  8006a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ad:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006b2:	eb 28                	jmp    8006dc <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 30                	push   $0x30
+  8006ba:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006bc:	83 c4 08             	add    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	6a 78                	push   $0x78
+  8006c2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006ce:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006dc:	83 ec 0c             	sub    $0xc,%esp
+  8006df:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006e3:	50                   	push   %eax
+  8006e4:	ff 75 e0             	push   -0x20(%ebp)
+  8006e7:	57                   	push   %edi
+  8006e8:	51                   	push   %ecx
+  8006e9:	52                   	push   %edx
+  8006ea:	89 da                	mov    %ebx,%edx
+  8006ec:	89 f0                	mov    %esi,%eax
+  8006ee:	e8 54 fb ff ff       	call   800247 <printnum>
+			break;
+  8006f3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006f9:	e9 4a fc ff ff       	jmp    800348 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 1b                	jg     80071e <vprintfmt+0x3f4>
+	else if (lflag)
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 2c                	je     800733 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800717:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80071c:	eb be                	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8b 10                	mov    (%eax),%edx
+  800723:	8b 48 04             	mov    0x4(%eax),%ecx
+  800726:	8d 40 08             	lea    0x8(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800731:	eb a9                	jmp    8006dc <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073d:	8d 40 04             	lea    0x4(%eax),%eax
+  800740:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800743:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800748:	eb 92                	jmp    8006dc <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	6a 25                	push   $0x25
+  800750:	ff d6                	call   *%esi
+			break;
+  800752:	83 c4 10             	add    $0x10,%esp
+  800755:	eb 9f                	jmp    8006f6 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	53                   	push   %ebx
+  80075b:	6a 25                	push   $0x25
+  80075d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	89 f8                	mov    %edi,%eax
+  800764:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800768:	74 05                	je     80076f <vprintfmt+0x445>
+  80076a:	83 e8 01             	sub    $0x1,%eax
+  80076d:	eb f5                	jmp    800764 <vprintfmt+0x43a>
+  80076f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800772:	eb 82                	jmp    8006f6 <vprintfmt+0x3cc>
+
+00800774 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800774:	55                   	push   %ebp
+  800775:	89 e5                	mov    %esp,%ebp
+  800777:	83 ec 18             	sub    $0x18,%esp
+  80077a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800780:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800783:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800787:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80078a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800791:	85 c0                	test   %eax,%eax
+  800793:	74 26                	je     8007bb <vsnprintf+0x47>
+  800795:	85 d2                	test   %edx,%edx
+  800797:	7e 22                	jle    8007bb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800799:	ff 75 14             	push   0x14(%ebp)
+  80079c:	ff 75 10             	push   0x10(%ebp)
+  80079f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a2:	50                   	push   %eax
+  8007a3:	68 f0 02 80 00       	push   $0x8002f0
+  8007a8:	e8 7d fb ff ff       	call   80032a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ad:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b6:	83 c4 10             	add    $0x10,%esp
+}
+  8007b9:	c9                   	leave
+  8007ba:	c3                   	ret
+		return -E_INVAL;
+  8007bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c0:	eb f7                	jmp    8007b9 <vsnprintf+0x45>
+
+008007c2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007c8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007cb:	50                   	push   %eax
+  8007cc:	ff 75 10             	push   0x10(%ebp)
+  8007cf:	ff 75 0c             	push   0xc(%ebp)
+  8007d2:	ff 75 08             	push   0x8(%ebp)
+  8007d5:	e8 9a ff ff ff       	call   800774 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007da:	c9                   	leave
+  8007db:	c3                   	ret
+
+008007dc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e7:	eb 03                	jmp    8007ec <strlen+0x10>
+		n++;
+  8007e9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007ec:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f0:	75 f7                	jne    8007e9 <strlen+0xd>
+	return n;
+}
+  8007f2:	5d                   	pop    %ebp
+  8007f3:	c3                   	ret
+
+008007f4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800802:	eb 03                	jmp    800807 <strnlen+0x13>
+		n++;
+  800804:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800807:	39 d0                	cmp    %edx,%eax
+  800809:	74 08                	je     800813 <strnlen+0x1f>
+  80080b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80080f:	75 f3                	jne    800804 <strnlen+0x10>
+  800811:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800813:	89 d0                	mov    %edx,%eax
+  800815:	5d                   	pop    %ebp
+  800816:	c3                   	ret
+
+00800817 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	53                   	push   %ebx
+  80081b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800821:	b8 00 00 00 00       	mov    $0x0,%eax
+  800826:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80082a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80082d:	83 c0 01             	add    $0x1,%eax
+  800830:	84 d2                	test   %dl,%dl
+  800832:	75 f2                	jne    800826 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800834:	89 c8                	mov    %ecx,%eax
+  800836:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800839:	c9                   	leave
+  80083a:	c3                   	ret
+
+0080083b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	53                   	push   %ebx
+  80083f:	83 ec 10             	sub    $0x10,%esp
+  800842:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800845:	53                   	push   %ebx
+  800846:	e8 91 ff ff ff       	call   8007dc <strlen>
+  80084b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80084e:	ff 75 0c             	push   0xc(%ebp)
+  800851:	01 d8                	add    %ebx,%eax
+  800853:	50                   	push   %eax
+  800854:	e8 be ff ff ff       	call   800817 <strcpy>
+	return dst;
+}
+  800859:	89 d8                	mov    %ebx,%eax
+  80085b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085e:	c9                   	leave
+  80085f:	c3                   	ret
+
+00800860 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800860:	55                   	push   %ebp
+  800861:	89 e5                	mov    %esp,%ebp
+  800863:	56                   	push   %esi
+  800864:	53                   	push   %ebx
+  800865:	8b 75 08             	mov    0x8(%ebp),%esi
+  800868:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80086b:	89 f3                	mov    %esi,%ebx
+  80086d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800870:	89 f0                	mov    %esi,%eax
+  800872:	eb 0f                	jmp    800883 <strncpy+0x23>
+		*dst++ = *src;
+  800874:	83 c0 01             	add    $0x1,%eax
+  800877:	0f b6 0a             	movzbl (%edx),%ecx
+  80087a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80087d:	80 f9 01             	cmp    $0x1,%cl
+  800880:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800883:	39 d8                	cmp    %ebx,%eax
+  800885:	75 ed                	jne    800874 <strncpy+0x14>
+	}
+	return ret;
+}
+  800887:	89 f0                	mov    %esi,%eax
+  800889:	5b                   	pop    %ebx
+  80088a:	5e                   	pop    %esi
+  80088b:	5d                   	pop    %ebp
+  80088c:	c3                   	ret
+
+0080088d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80088d:	55                   	push   %ebp
+  80088e:	89 e5                	mov    %esp,%ebp
+  800890:	56                   	push   %esi
+  800891:	53                   	push   %ebx
+  800892:	8b 75 08             	mov    0x8(%ebp),%esi
+  800895:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800898:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80089b:	89 f0                	mov    %esi,%eax
+  80089d:	85 d2                	test   %edx,%edx
+  80089f:	74 21                	je     8008c2 <strlcpy+0x35>
+  8008a1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008a5:	89 f2                	mov    %esi,%edx
+  8008a7:	eb 09                	jmp    8008b2 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008a9:	83 c1 01             	add    $0x1,%ecx
+  8008ac:	83 c2 01             	add    $0x1,%edx
+  8008af:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b2:	39 c2                	cmp    %eax,%edx
+  8008b4:	74 09                	je     8008bf <strlcpy+0x32>
+  8008b6:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b9:	84 db                	test   %bl,%bl
+  8008bb:	75 ec                	jne    8008a9 <strlcpy+0x1c>
+  8008bd:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008bf:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c2:	29 f0                	sub    %esi,%eax
+}
+  8008c4:	5b                   	pop    %ebx
+  8008c5:	5e                   	pop    %esi
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+
+008008c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d1:	eb 06                	jmp    8008d9 <strcmp+0x11>
+		p++, q++;
+  8008d3:	83 c1 01             	add    $0x1,%ecx
+  8008d6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008d9:	0f b6 01             	movzbl (%ecx),%eax
+  8008dc:	84 c0                	test   %al,%al
+  8008de:	74 04                	je     8008e4 <strcmp+0x1c>
+  8008e0:	3a 02                	cmp    (%edx),%al
+  8008e2:	74 ef                	je     8008d3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e4:	0f b6 c0             	movzbl %al,%eax
+  8008e7:	0f b6 12             	movzbl (%edx),%edx
+  8008ea:	29 d0                	sub    %edx,%eax
+}
+  8008ec:	5d                   	pop    %ebp
+  8008ed:	c3                   	ret
+
+008008ee <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	53                   	push   %ebx
+  8008f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008fb:	eb 09                	jmp    800906 <strncmp+0x18>
+		n--, p++, q++;
+  8008fd:	83 ea 01             	sub    $0x1,%edx
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800906:	85 d2                	test   %edx,%edx
+  800908:	74 18                	je     800922 <strncmp+0x34>
+  80090a:	0f b6 18             	movzbl (%eax),%ebx
+  80090d:	84 db                	test   %bl,%bl
+  80090f:	74 04                	je     800915 <strncmp+0x27>
+  800911:	3a 19                	cmp    (%ecx),%bl
+  800913:	74 e8                	je     8008fd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800915:	0f b6 00             	movzbl (%eax),%eax
+  800918:	0f b6 11             	movzbl (%ecx),%edx
+  80091b:	29 d0                	sub    %edx,%eax
+}
+  80091d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800920:	c9                   	leave
+  800921:	c3                   	ret
+		return 0;
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+  800927:	eb f4                	jmp    80091d <strncmp+0x2f>
+
+00800929 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800933:	eb 03                	jmp    800938 <strchr+0xf>
+  800935:	83 c0 01             	add    $0x1,%eax
+  800938:	0f b6 10             	movzbl (%eax),%edx
+  80093b:	84 d2                	test   %dl,%dl
+  80093d:	74 06                	je     800945 <strchr+0x1c>
+		if (*s == c)
+  80093f:	38 ca                	cmp    %cl,%dl
+  800941:	75 f2                	jne    800935 <strchr+0xc>
+  800943:	eb 05                	jmp    80094a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80094a:	5d                   	pop    %ebp
+  80094b:	c3                   	ret
+
+0080094c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800952:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800956:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800959:	38 ca                	cmp    %cl,%dl
+  80095b:	74 09                	je     800966 <strfind+0x1a>
+  80095d:	84 d2                	test   %dl,%dl
+  80095f:	74 05                	je     800966 <strfind+0x1a>
+	for (; *s; s++)
+  800961:	83 c0 01             	add    $0x1,%eax
+  800964:	eb f0                	jmp    800956 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	57                   	push   %edi
+  80096c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80096f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800972:	85 c9                	test   %ecx,%ecx
+  800974:	74 20                	je     800996 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800976:	89 f8                	mov    %edi,%eax
+  800978:	09 c8                	or     %ecx,%eax
+  80097a:	a8 03                	test   $0x3,%al
+  80097c:	75 12                	jne    800990 <memset+0x28>
+		c &= 0xFF;
+  80097e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800982:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800988:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80098b:	fc                   	cld
+  80098c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80098e:	eb 06                	jmp    800996 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800990:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800993:	fc                   	cld
+  800994:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800996:	89 f8                	mov    %edi,%eax
+  800998:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80099b:	c9                   	leave
+  80099c:	c3                   	ret
+
+0080099d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	57                   	push   %edi
+  8009a1:	56                   	push   %esi
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ab:	39 c6                	cmp    %eax,%esi
+  8009ad:	73 32                	jae    8009e1 <memmove+0x44>
+  8009af:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b2:	39 d0                	cmp    %edx,%eax
+  8009b4:	73 2b                	jae    8009e1 <memmove+0x44>
+		s += n;
+		d += n;
+  8009b6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b9:	89 d6                	mov    %edx,%esi
+  8009bb:	09 fe                	or     %edi,%esi
+  8009bd:	09 ce                	or     %ecx,%esi
+  8009bf:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009c5:	75 0e                	jne    8009d5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c7:	83 ef 04             	sub    $0x4,%edi
+  8009ca:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009cd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d0:	fd                   	std
+  8009d1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d3:	eb 09                	jmp    8009de <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009d5:	83 ef 01             	sub    $0x1,%edi
+  8009d8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009db:	fd                   	std
+  8009dc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009de:	fc                   	cld
+  8009df:	eb 1a                	jmp    8009fb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e1:	89 f2                	mov    %esi,%edx
+  8009e3:	09 c2                	or     %eax,%edx
+  8009e5:	09 ca                	or     %ecx,%edx
+  8009e7:	f6 c2 03             	test   $0x3,%dl
+  8009ea:	75 0a                	jne    8009f6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009ec:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ef:	89 c7                	mov    %eax,%edi
+  8009f1:	fc                   	cld
+  8009f2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f4:	eb 05                	jmp    8009fb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009f6:	89 c7                	mov    %eax,%edi
+  8009f8:	fc                   	cld
+  8009f9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009fb:	5e                   	pop    %esi
+  8009fc:	5f                   	pop    %edi
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a05:	ff 75 10             	push   0x10(%ebp)
+  800a08:	ff 75 0c             	push   0xc(%ebp)
+  800a0b:	ff 75 08             	push   0x8(%ebp)
+  800a0e:	e8 8a ff ff ff       	call   80099d <memmove>
+}
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	56                   	push   %esi
+  800a19:	53                   	push   %ebx
+  800a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a20:	89 c6                	mov    %eax,%esi
+  800a22:	03 75 10             	add    0x10(%ebp),%esi
+  800a25:	eb 06                	jmp    800a2d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a27:	83 c0 01             	add    $0x1,%eax
+  800a2a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a2d:	39 f0                	cmp    %esi,%eax
+  800a2f:	74 14                	je     800a45 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a31:	0f b6 08             	movzbl (%eax),%ecx
+  800a34:	0f b6 1a             	movzbl (%edx),%ebx
+  800a37:	38 d9                	cmp    %bl,%cl
+  800a39:	74 ec                	je     800a27 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a3b:	0f b6 c1             	movzbl %cl,%eax
+  800a3e:	0f b6 db             	movzbl %bl,%ebx
+  800a41:	29 d8                	sub    %ebx,%eax
+  800a43:	eb 05                	jmp    800a4a <memcmp+0x35>
+	}
+
+	return 0;
+  800a45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a4a:	5b                   	pop    %ebx
+  800a4b:	5e                   	pop    %esi
+  800a4c:	5d                   	pop    %ebp
+  800a4d:	c3                   	ret
+
+00800a4e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a5c:	eb 03                	jmp    800a61 <memfind+0x13>
+  800a5e:	83 c0 01             	add    $0x1,%eax
+  800a61:	39 d0                	cmp    %edx,%eax
+  800a63:	73 04                	jae    800a69 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a65:	38 08                	cmp    %cl,(%eax)
+  800a67:	75 f5                	jne    800a5e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a69:	5d                   	pop    %ebp
+  800a6a:	c3                   	ret
+
+00800a6b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	57                   	push   %edi
+  800a6f:	56                   	push   %esi
+  800a70:	53                   	push   %ebx
+  800a71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a77:	eb 03                	jmp    800a7c <strtol+0x11>
+		s++;
+  800a79:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a7c:	0f b6 02             	movzbl (%edx),%eax
+  800a7f:	3c 20                	cmp    $0x20,%al
+  800a81:	74 f6                	je     800a79 <strtol+0xe>
+  800a83:	3c 09                	cmp    $0x9,%al
+  800a85:	74 f2                	je     800a79 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a87:	3c 2b                	cmp    $0x2b,%al
+  800a89:	74 2a                	je     800ab5 <strtol+0x4a>
+	int neg = 0;
+  800a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a90:	3c 2d                	cmp    $0x2d,%al
+  800a92:	74 2b                	je     800abf <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a94:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a9a:	75 0f                	jne    800aab <strtol+0x40>
+  800a9c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a9f:	74 28                	je     800ac9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa1:	85 db                	test   %ebx,%ebx
+  800aa3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa8:	0f 44 d8             	cmove  %eax,%ebx
+  800aab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ab3:	eb 46                	jmp    800afb <strtol+0x90>
+		s++;
+  800ab5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ab8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800abd:	eb d5                	jmp    800a94 <strtol+0x29>
+		s++, neg = 1;
+  800abf:	83 c2 01             	add    $0x1,%edx
+  800ac2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac7:	eb cb                	jmp    800a94 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800acd:	74 0e                	je     800add <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800acf:	85 db                	test   %ebx,%ebx
+  800ad1:	75 d8                	jne    800aab <strtol+0x40>
+		s++, base = 8;
+  800ad3:	83 c2 01             	add    $0x1,%edx
+  800ad6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800adb:	eb ce                	jmp    800aab <strtol+0x40>
+		s += 2, base = 16;
+  800add:	83 c2 02             	add    $0x2,%edx
+  800ae0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ae5:	eb c4                	jmp    800aab <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae7:	0f be c0             	movsbl %al,%eax
+  800aea:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aed:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800af0:	7d 3a                	jge    800b2c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800af2:	83 c2 01             	add    $0x1,%edx
+  800af5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800afb:	0f b6 02             	movzbl (%edx),%eax
+  800afe:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b01:	89 f3                	mov    %esi,%ebx
+  800b03:	80 fb 09             	cmp    $0x9,%bl
+  800b06:	76 df                	jbe    800ae7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b08:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b0b:	89 f3                	mov    %esi,%ebx
+  800b0d:	80 fb 19             	cmp    $0x19,%bl
+  800b10:	77 08                	ja     800b1a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b12:	0f be c0             	movsbl %al,%eax
+  800b15:	83 e8 57             	sub    $0x57,%eax
+  800b18:	eb d3                	jmp    800aed <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b1a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b1d:	89 f3                	mov    %esi,%ebx
+  800b1f:	80 fb 19             	cmp    $0x19,%bl
+  800b22:	77 08                	ja     800b2c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b24:	0f be c0             	movsbl %al,%eax
+  800b27:	83 e8 37             	sub    $0x37,%eax
+  800b2a:	eb c1                	jmp    800aed <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b2c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b30:	74 05                	je     800b37 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b35:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b37:	89 c8                	mov    %ecx,%eax
+  800b39:	f7 d8                	neg    %eax
+  800b3b:	85 ff                	test   %edi,%edi
+  800b3d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b40:	89 c8                	mov    %ecx,%eax
+  800b42:	5b                   	pop    %ebx
+  800b43:	5e                   	pop    %esi
+  800b44:	5f                   	pop    %edi
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+
+00800b47 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b4d:	6a 00                	push   $0x0
+  800b4f:	6a 00                	push   $0x0
+  800b51:	ff 75 08             	push   0x8(%ebp)
+  800b54:	e8 12 ff ff ff       	call   800a6b <strtol>
+}
+  800b59:	c9                   	leave
+  800b5a:	c3                   	ret
+
+00800b5b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	57                   	push   %edi
+  800b5f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6b:	89 c3                	mov    %eax,%ebx
+  800b6d:	89 c7                	mov    %eax,%edi
+  800b6f:	6a 00                	push   $0x0
+  800b71:	55                   	push   %ebp
+  800b72:	56                   	push   %esi
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	8d 35 7d 0b 80 00    	lea    0x800b7d,%esi
+  800b7b:	0f 34                	sysenter
+
+00800b7d <after_sysenter_label_47>:
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b82:	5b                   	pop    %ebx
+  800b83:	5f                   	pop    %edi
+  800b84:	5d                   	pop    %ebp
+  800b85:	c3                   	ret
+
+00800b86 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	57                   	push   %edi
+  800b8a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b90:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b95:	89 d1                	mov    %edx,%ecx
+  800b97:	89 d3                	mov    %edx,%ebx
+  800b99:	89 d7                	mov    %edx,%edi
+  800b9b:	6a 00                	push   $0x0
+  800b9d:	55                   	push   %ebp
+  800b9e:	56                   	push   %esi
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	8d 35 a9 0b 80 00    	lea    0x800ba9,%esi
+  800ba7:	0f 34                	sysenter
+
+00800ba9 <after_sysenter_label_128>:
+  800ba9:	5e                   	pop    %esi
+  800baa:	5d                   	pop    %ebp
+  800bab:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bae:	5b                   	pop    %ebx
+  800baf:	5f                   	pop    %edi
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	57                   	push   %edi
+  800bb6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bbf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bc4:	89 cb                	mov    %ecx,%ebx
+  800bc6:	89 cf                	mov    %ecx,%edi
+  800bc8:	6a 00                	push   $0x0
+  800bca:	55                   	push   %ebp
+  800bcb:	56                   	push   %esi
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	8d 35 d6 0b 80 00    	lea    0x800bd6,%esi
+  800bd4:	0f 34                	sysenter
+
+00800bd6 <after_sysenter_label_212>:
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	7f 07                	jg     800be6 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be2:	5b                   	pop    %ebx
+  800be3:	5f                   	pop    %edi
+  800be4:	5d                   	pop    %ebp
+  800be5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800be6:	83 ec 0c             	sub    $0xc,%esp
+  800be9:	50                   	push   %eax
+  800bea:	6a 03                	push   $0x3
+  800bec:	68 55 4b 80 00       	push   $0x804b55
+  800bf1:	6a 54                	push   $0x54
+  800bf3:	68 72 4b 80 00       	push   $0x804b72
+  800bf8:	e8 5b f5 ff ff       	call   800158 <_panic>
+
+00800bfd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c07:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c0c:	89 d1                	mov    %edx,%ecx
+  800c0e:	89 d3                	mov    %edx,%ebx
+  800c10:	89 d7                	mov    %edx,%edi
+  800c12:	6a 00                	push   $0x0
+  800c14:	55                   	push   %ebp
+  800c15:	56                   	push   %esi
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	8d 35 20 0c 80 00    	lea    0x800c20,%esi
+  800c1e:	0f 34                	sysenter
+
+00800c20 <after_sysenter_label_309>:
+  800c20:	5e                   	pop    %esi
+  800c21:	5d                   	pop    %ebp
+  800c22:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c25:	5b                   	pop    %ebx
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+
+00800c29 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	57                   	push   %edi
+  800c2d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c33:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c38:	89 d1                	mov    %edx,%ecx
+  800c3a:	89 d3                	mov    %edx,%ebx
+  800c3c:	89 d7                	mov    %edx,%edi
+  800c3e:	6a 00                	push   $0x0
+  800c40:	55                   	push   %ebp
+  800c41:	56                   	push   %esi
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	8d 35 4c 0c 80 00    	lea    0x800c4c,%esi
+  800c4a:	0f 34                	sysenter
+
+00800c4c <after_sysenter_label_391>:
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c60:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6d:	6a 00                	push   $0x0
+  800c6f:	55                   	push   %ebp
+  800c70:	56                   	push   %esi
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	8d 35 7b 0c 80 00    	lea    0x800c7b,%esi
+  800c79:	0f 34                	sysenter
+
+00800c7b <after_sysenter_label_479>:
+  800c7b:	5e                   	pop    %esi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c80:	85 c0                	test   %eax,%eax
+  800c82:	7f 07                	jg     800c8b <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c87:	5b                   	pop    %ebx
+  800c88:	5f                   	pop    %edi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8b:	83 ec 0c             	sub    $0xc,%esp
+  800c8e:	50                   	push   %eax
+  800c8f:	6a 04                	push   $0x4
+  800c91:	68 55 4b 80 00       	push   $0x804b55
+  800c96:	6a 54                	push   $0x54
+  800c98:	68 72 4b 80 00       	push   $0x804b72
+  800c9d:	e8 b6 f4 ff ff       	call   800158 <_panic>
+
+00800ca2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ca2:	55                   	push   %ebp
+  800ca3:	89 e5                	mov    %esp,%ebp
+  800ca5:	57                   	push   %edi
+  800ca6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cad:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb8:	ff 75 18             	push   0x18(%ebp)
+  800cbb:	55                   	push   %ebp
+  800cbc:	56                   	push   %esi
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	8d 35 c7 0c 80 00    	lea    0x800cc7,%esi
+  800cc5:	0f 34                	sysenter
+
+00800cc7 <after_sysenter_label_593>:
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ccc:	85 c0                	test   %eax,%eax
+  800cce:	7f 07                	jg     800cd7 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cd3:	5b                   	pop    %ebx
+  800cd4:	5f                   	pop    %edi
+  800cd5:	5d                   	pop    %ebp
+  800cd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+  800cda:	50                   	push   %eax
+  800cdb:	6a 05                	push   $0x5
+  800cdd:	68 55 4b 80 00       	push   $0x804b55
+  800ce2:	6a 54                	push   $0x54
+  800ce4:	68 72 4b 80 00       	push   $0x804b72
+  800ce9:	e8 6a f4 ff ff       	call   800158 <_panic>
+
+00800cee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	57                   	push   %edi
+  800cf2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfe:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d03:	89 df                	mov    %ebx,%edi
+  800d05:	6a 00                	push   $0x0
+  800d07:	55                   	push   %ebp
+  800d08:	56                   	push   %esi
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	8d 35 13 0d 80 00    	lea    0x800d13,%esi
+  800d11:	0f 34                	sysenter
+
+00800d13 <after_sysenter_label_704>:
+  800d13:	5e                   	pop    %esi
+  800d14:	5d                   	pop    %ebp
+  800d15:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d18:	85 c0                	test   %eax,%eax
+  800d1a:	7f 07                	jg     800d23 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 06                	push   $0x6
+  800d29:	68 55 4b 80 00       	push   $0x804b55
+  800d2e:	6a 54                	push   $0x54
+  800d30:	68 72 4b 80 00       	push   $0x804b72
+  800d35:	e8 1e f4 ff ff       	call   800158 <_panic>
+
+00800d3a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d4f:	89 df                	mov    %ebx,%edi
+  800d51:	6a 00                	push   $0x0
+  800d53:	55                   	push   %ebp
+  800d54:	56                   	push   %esi
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	8d 35 5f 0d 80 00    	lea    0x800d5f,%esi
+  800d5d:	0f 34                	sysenter
+
+00800d5f <after_sysenter_label_808>:
+  800d5f:	5e                   	pop    %esi
+  800d60:	5d                   	pop    %ebp
+  800d61:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d64:	85 c0                	test   %eax,%eax
+  800d66:	7f 07                	jg     800d6f <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 08                	push   $0x8
+  800d75:	68 55 4b 80 00       	push   $0x804b55
+  800d7a:	6a 54                	push   $0x54
+  800d7c:	68 72 4b 80 00       	push   $0x804b72
+  800d81:	e8 d2 f3 ff ff       	call   800158 <_panic>
+
+00800d86 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d96:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d9b:	89 df                	mov    %ebx,%edi
+  800d9d:	6a 00                	push   $0x0
+  800d9f:	55                   	push   %ebp
+  800da0:	56                   	push   %esi
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	8d 35 ab 0d 80 00    	lea    0x800dab,%esi
+  800da9:	0f 34                	sysenter
+
+00800dab <after_sysenter_label_912>:
+  800dab:	5e                   	pop    %esi
+  800dac:	5d                   	pop    %ebp
+  800dad:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	7f 07                	jg     800dbb <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800db7:	5b                   	pop    %ebx
+  800db8:	5f                   	pop    %edi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+  800dbe:	50                   	push   %eax
+  800dbf:	6a 09                	push   $0x9
+  800dc1:	68 55 4b 80 00       	push   $0x804b55
+  800dc6:	6a 54                	push   $0x54
+  800dc8:	68 72 4b 80 00       	push   $0x804b72
+  800dcd:	e8 86 f3 ff ff       	call   800158 <_panic>
+
+00800dd2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de7:	89 df                	mov    %ebx,%edi
+  800de9:	6a 00                	push   $0x0
+  800deb:	55                   	push   %ebp
+  800dec:	56                   	push   %esi
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	8d 35 f7 0d 80 00    	lea    0x800df7,%esi
+  800df5:	0f 34                	sysenter
+
+00800df7 <after_sysenter_label_1016>:
+  800df7:	5e                   	pop    %esi
+  800df8:	5d                   	pop    %ebp
+  800df9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dfc:	85 c0                	test   %eax,%eax
+  800dfe:	7f 07                	jg     800e07 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e03:	5b                   	pop    %ebx
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+  800e0a:	50                   	push   %eax
+  800e0b:	6a 0a                	push   $0xa
+  800e0d:	68 55 4b 80 00       	push   $0x804b55
+  800e12:	6a 54                	push   $0x54
+  800e14:	68 72 4b 80 00       	push   $0x804b72
+  800e19:	e8 3a f3 ff ff       	call   800158 <_panic>
+
+00800e1e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	57                   	push   %edi
+  800e22:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e29:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e34:	6a 00                	push   $0x0
+  800e36:	55                   	push   %ebp
+  800e37:	56                   	push   %esi
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	8d 35 42 0e 80 00    	lea    0x800e42,%esi
+  800e40:	0f 34                	sysenter
+
+00800e42 <after_sysenter_label_1126>:
+  800e42:	5e                   	pop    %esi
+  800e43:	5d                   	pop    %ebp
+  800e44:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e47:	5b                   	pop    %ebx
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+
+00800e4b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e58:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e5d:	89 cb                	mov    %ecx,%ebx
+  800e5f:	89 cf                	mov    %ecx,%edi
+  800e61:	6a 00                	push   $0x0
+  800e63:	55                   	push   %ebp
+  800e64:	56                   	push   %esi
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	8d 35 6f 0e 80 00    	lea    0x800e6f,%esi
+  800e6d:	0f 34                	sysenter
+
+00800e6f <after_sysenter_label_1210>:
+  800e6f:	5e                   	pop    %esi
+  800e70:	5d                   	pop    %ebp
+  800e71:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 07                	jg     800e7f <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	50                   	push   %eax
+  800e83:	6a 0d                	push   $0xd
+  800e85:	68 55 4b 80 00       	push   $0x804b55
+  800e8a:	6a 54                	push   $0x54
+  800e8c:	68 72 4b 80 00       	push   $0x804b72
+  800e91:	e8 c2 f2 ff ff       	call   800158 <_panic>
+
+00800e96 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea6:	b8 42 00 00 00       	mov    $0x42,%eax
+  800eab:	89 df                	mov    %ebx,%edi
+  800ead:	6a 00                	push   $0x0
+  800eaf:	55                   	push   %ebp
+  800eb0:	56                   	push   %esi
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	8d 35 bb 0e 80 00    	lea    0x800ebb,%esi
+  800eb9:	0f 34                	sysenter
+
+00800ebb <after_sysenter_label_1311>:
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	7f 07                	jg     800ecb <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800ec4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5f                   	pop    %edi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  800ece:	50                   	push   %eax
+  800ecf:	6a 42                	push   $0x42
+  800ed1:	68 55 4b 80 00       	push   $0x804b55
+  800ed6:	6a 54                	push   $0x54
+  800ed8:	68 72 4b 80 00       	push   $0x804b72
+  800edd:	e8 76 f2 ff ff       	call   800158 <_panic>
+
+00800ee2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	57                   	push   %edi
+  800ee6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ef1:	89 d1                	mov    %edx,%ecx
+  800ef3:	89 d3                	mov    %edx,%ebx
+  800ef5:	89 d7                	mov    %edx,%edi
+  800ef7:	6a 00                	push   $0x0
+  800ef9:	55                   	push   %ebp
+  800efa:	56                   	push   %esi
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	8d 35 05 0f 80 00    	lea    0x800f05,%esi
+  800f03:	0f 34                	sysenter
+
+00800f05 <after_sysenter_label_1411>:
+  800f05:	5e                   	pop    %esi
+  800f06:	5d                   	pop    %ebp
+  800f07:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+
+00800f0e <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	6a 00                	push   $0x0
+  800f27:	55                   	push   %ebp
+  800f28:	56                   	push   %esi
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	8d 35 33 0f 80 00    	lea    0x800f33,%esi
+  800f31:	0f 34                	sysenter
+
+00800f33 <after_sysenter_label_1497>:
+  800f33:	5e                   	pop    %esi
+  800f34:	5d                   	pop    %ebp
+  800f35:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f38:	5b                   	pop    %ebx
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+
+00800f3c <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	57                   	push   %edi
+  800f40:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f51:	89 df                	mov    %ebx,%edi
+  800f53:	6a 00                	push   $0x0
+  800f55:	55                   	push   %ebp
+  800f56:	56                   	push   %esi
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	8d 35 61 0f 80 00    	lea    0x800f61,%esi
+  800f5f:	0f 34                	sysenter
+
+00800f61 <after_sysenter_label_1583>:
+  800f61:	5e                   	pop    %esi
+  800f62:	5d                   	pop    %ebp
+  800f63:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f66:	5b                   	pop    %ebx
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+
+00800f6a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	6a 00                	push   $0x0
+  800f84:	55                   	push   %ebp
+  800f85:	56                   	push   %esi
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	8d 35 90 0f 80 00    	lea    0x800f90,%esi
+  800f8e:	0f 34                	sysenter
+
+00800f90 <after_sysenter_label_1672>:
+  800f90:	5e                   	pop    %esi
+  800f91:	5d                   	pop    %ebp
+  800f92:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f95:	5b                   	pop    %ebx
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+
+00800f99 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa9:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fae:	89 df                	mov    %ebx,%edi
+  800fb0:	6a 00                	push   $0x0
+  800fb2:	55                   	push   %ebp
+  800fb3:	56                   	push   %esi
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	8d 35 be 0f 80 00    	lea    0x800fbe,%esi
+  800fbc:	0f 34                	sysenter
+
+00800fbe <after_sysenter_label_1758>:
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fc3:	5b                   	pop    %ebx
+  800fc4:	5f                   	pop    %edi
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	c3                   	ret
+
+00800fc7 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd4:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fd9:	89 cb                	mov    %ecx,%ebx
+  800fdb:	89 cf                	mov    %ecx,%edi
+  800fdd:	6a 00                	push   $0x0
+  800fdf:	55                   	push   %ebp
+  800fe0:	56                   	push   %esi
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	8d 35 eb 0f 80 00    	lea    0x800feb,%esi
+  800fe9:	0f 34                	sysenter
+
+00800feb <after_sysenter_label_1842>:
+  800feb:	5e                   	pop    %esi
+  800fec:	5d                   	pop    %ebp
+  800fed:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ff0:	85 c0                	test   %eax,%eax
+  800ff2:	7f 07                	jg     800ffb <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800ff4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5f                   	pop    %edi
+  800ff9:	5d                   	pop    %ebp
+  800ffa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	50                   	push   %eax
+  800fff:	6a 13                	push   $0x13
+  801001:	68 55 4b 80 00       	push   $0x804b55
+  801006:	6a 54                	push   $0x54
+  801008:	68 72 4b 80 00       	push   $0x804b72
+  80100d:	e8 46 f1 ff ff       	call   800158 <_panic>
+
+00801012 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	57                   	push   %edi
+  801016:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801021:	89 d1                	mov    %edx,%ecx
+  801023:	89 d3                	mov    %edx,%ebx
+  801025:	89 d7                	mov    %edx,%edi
+  801027:	6a 00                	push   $0x0
+  801029:	55                   	push   %ebp
+  80102a:	56                   	push   %esi
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	8d 35 35 10 80 00    	lea    0x801035,%esi
+  801033:	0f 34                	sysenter
+
+00801035 <after_sysenter_label_1939>:
+  801035:	5e                   	pop    %esi
+  801036:	5d                   	pop    %ebp
+  801037:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80103a:	5b                   	pop    %ebx
+  80103b:	5f                   	pop    %edi
+  80103c:	5d                   	pop    %ebp
+  80103d:	c3                   	ret
+
+0080103e <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	57                   	push   %edi
+  801042:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801049:	b8 15 00 00 00       	mov    $0x15,%eax
+  80104e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801053:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801056:	6a 00                	push   $0x0
+  801058:	55                   	push   %ebp
+  801059:	56                   	push   %esi
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	8d 35 64 10 80 00    	lea    0x801064,%esi
+  801062:	0f 34                	sysenter
+
+00801064 <after_sysenter_label_2028>:
+  801064:	5e                   	pop    %esi
+  801065:	5d                   	pop    %ebp
+  801066:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801069:	5b                   	pop    %ebx
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+
+0080106d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801072:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801082:	89 df                	mov    %ebx,%edi
+  801084:	6a 00                	push   $0x0
+  801086:	55                   	push   %ebp
+  801087:	56                   	push   %esi
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	8d 35 92 10 80 00    	lea    0x801092,%esi
+  801090:	0f 34                	sysenter
+
+00801092 <after_sysenter_label_2114>:
+  801092:	5e                   	pop    %esi
+  801093:	5d                   	pop    %ebp
+  801094:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801097:	5b                   	pop    %ebx
+  801098:	5f                   	pop    %edi
+  801099:	5d                   	pop    %ebp
+  80109a:	c3                   	ret
+
+0080109b <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ab:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b0:	89 df                	mov    %ebx,%edi
+  8010b2:	6a 00                	push   $0x0
+  8010b4:	55                   	push   %ebp
+  8010b5:	56                   	push   %esi
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	8d 35 c0 10 80 00    	lea    0x8010c0,%esi
+  8010be:	0f 34                	sysenter
+
+008010c0 <after_sysenter_label_2200>:
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5f                   	pop    %edi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+
+008010c9 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	57                   	push   %edi
+  8010cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010de:	89 df                	mov    %ebx,%edi
+  8010e0:	6a 00                	push   $0x0
+  8010e2:	55                   	push   %ebp
+  8010e3:	56                   	push   %esi
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	8d 35 ee 10 80 00    	lea    0x8010ee,%esi
+  8010ec:	0f 34                	sysenter
+
+008010ee <after_sysenter_label_2286>:
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5f                   	pop    %edi
+  8010f5:	5d                   	pop    %ebp
+  8010f6:	c3                   	ret
+
+008010f7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8010fd:	83 3d c4 62 80 00 00 	cmpl   $0x0,0x8062c4
+  801104:	74 0a                	je     801110 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801106:	8b 45 08             	mov    0x8(%ebp),%eax
+  801109:	a3 c4 62 80 00       	mov    %eax,0x8062c4
+}
+  80110e:	c9                   	leave
+  80110f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  801110:	83 ec 04             	sub    $0x4,%esp
+  801113:	6a 07                	push   $0x7
+  801115:	68 00 f0 bf ee       	push   $0xeebff000
+  80111a:	6a 00                	push   $0x0
+  80111c:	e8 34 fb ff ff       	call   800c55 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801121:	83 c4 08             	add    $0x8,%esp
+  801124:	68 35 11 80 00       	push   $0x801135
+  801129:	6a 00                	push   $0x0
+  80112b:	e8 a2 fc ff ff       	call   800dd2 <sys_env_set_pgfault_upcall>
+  801130:	83 c4 10             	add    $0x10,%esp
+  801133:	eb d1                	jmp    801106 <set_pgfault_handler+0xf>
+
+00801135 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801135:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801136:	a1 c4 62 80 00       	mov    0x8062c4,%eax
+	call *%eax
+  80113b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80113d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  801140:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  801144:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  801148:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80114b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80114f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  801151:	83 c4 08             	add    $0x8,%esp
+	popal
+  801154:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  801155:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801158:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  801159:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80115a:	c3                   	ret
+
+0080115b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80115e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801161:	05 00 00 00 30       	add    $0x30000000,%eax
+  801166:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+
+0080116b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80116e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801171:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801176:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80117b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+
+00801182 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801185:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80118a:	eb 02                	jmp    80118e <fd_alloc+0xc>
+  80118c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80118e:	89 c2                	mov    %eax,%edx
+  801190:	c1 ea 16             	shr    $0x16,%edx
+  801193:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80119a:	f6 c2 01             	test   $0x1,%dl
+  80119d:	74 2b                	je     8011ca <fd_alloc+0x48>
+  80119f:	89 c2                	mov    %eax,%edx
+  8011a1:	c1 ea 0c             	shr    $0xc,%edx
+  8011a4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011ab:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011b1:	f6 c1 01             	test   $0x1,%cl
+  8011b4:	74 14                	je     8011ca <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011b6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011bc:	75 ce                	jne    80118c <fd_alloc+0xa>
+  8011be:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011c3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011c8:	eb 05                	jmp    8011cf <fd_alloc+0x4d>
+			return 0;
+  8011ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	89 02                	mov    %eax,(%edx)
+}
+  8011d4:	89 c8                	mov    %ecx,%eax
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+
+008011d8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011de:	83 f8 1f             	cmp    $0x1f,%eax
+  8011e1:	77 30                	ja     801213 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011e3:	c1 e0 0c             	shl    $0xc,%eax
+  8011e6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011eb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011f1:	f6 c2 01             	test   $0x1,%dl
+  8011f4:	74 24                	je     80121a <fd_lookup+0x42>
+  8011f6:	89 c2                	mov    %eax,%edx
+  8011f8:	c1 ea 0c             	shr    $0xc,%edx
+  8011fb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801202:	f6 c2 01             	test   $0x1,%dl
+  801205:	74 1a                	je     801221 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801207:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80120a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+		return -E_INVAL;
+  801213:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801218:	eb f7                	jmp    801211 <fd_lookup+0x39>
+		return -E_INVAL;
+  80121a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121f:	eb f0                	jmp    801211 <fd_lookup+0x39>
+  801221:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801226:	eb e9                	jmp    801211 <fd_lookup+0x39>
+
+00801228 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	53                   	push   %ebx
+  80122c:	83 ec 04             	sub    $0x4,%esp
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+  801237:	eb 03                	jmp    80123c <dev_lookup+0x14>
+  801239:	83 c0 01             	add    $0x1,%eax
+  80123c:	8b 1c 85 fc 4b 80 00 	mov    0x804bfc(,%eax,4),%ebx
+  801243:	85 db                	test   %ebx,%ebx
+  801245:	74 0b                	je     801252 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801247:	39 13                	cmp    %edx,(%ebx)
+  801249:	75 ee                	jne    801239 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801250:	eb 49                	jmp    80129b <dev_lookup+0x73>
+  801252:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801254:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80125a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80125f:	77 18                	ja     801279 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801261:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801266:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801268:	c1 e8 10             	shr    $0x10,%eax
+  80126b:	74 0c                	je     801279 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80126d:	c1 e0 10             	shl    $0x10,%eax
+  801270:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801275:	29 c1                	sub    %eax,%ecx
+  801277:	eb 06                	jmp    80127f <dev_lookup+0x57>
+		return pthread_main_tls;
+  801279:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80127f:	8b 01                	mov    (%ecx),%eax
+  801281:	8b 40 48             	mov    0x48(%eax),%eax
+  801284:	83 ec 04             	sub    $0x4,%esp
+  801287:	52                   	push   %edx
+  801288:	50                   	push   %eax
+  801289:	68 80 4b 80 00       	push   $0x804b80
+  80128e:	e8 a0 ef ff ff       	call   800233 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80129b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129e:	89 1a                	mov    %ebx,(%edx)
+}
+  8012a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a3:	c9                   	leave
+  8012a4:	c3                   	ret
+
+008012a5 <fd_close>:
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	83 ec 24             	sub    $0x24,%esp
+  8012ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012b8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012be:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012c1:	50                   	push   %eax
+  8012c2:	e8 11 ff ff ff       	call   8011d8 <fd_lookup>
+  8012c7:	89 c3                	mov    %eax,%ebx
+  8012c9:	83 c4 10             	add    $0x10,%esp
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	78 05                	js     8012d5 <fd_close+0x30>
+	    || fd != fd2)
+  8012d0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012d3:	74 16                	je     8012eb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012d5:	89 f8                	mov    %edi,%eax
+  8012d7:	84 c0                	test   %al,%al
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012e1:	89 d8                	mov    %ebx,%eax
+  8012e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012eb:	83 ec 08             	sub    $0x8,%esp
+  8012ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012f1:	50                   	push   %eax
+  8012f2:	ff 36                	push   (%esi)
+  8012f4:	e8 2f ff ff ff       	call   801228 <dev_lookup>
+  8012f9:	89 c3                	mov    %eax,%ebx
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	78 1a                	js     80131c <fd_close+0x77>
+		if (dev->dev_close)
+  801302:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801305:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801308:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	74 0b                	je     80131c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801311:	83 ec 0c             	sub    $0xc,%esp
+  801314:	56                   	push   %esi
+  801315:	ff d0                	call   *%eax
+  801317:	89 c3                	mov    %eax,%ebx
+  801319:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80131c:	83 ec 08             	sub    $0x8,%esp
+  80131f:	56                   	push   %esi
+  801320:	6a 00                	push   $0x0
+  801322:	e8 c7 f9 ff ff       	call   800cee <sys_page_unmap>
+	return r;
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	eb b5                	jmp    8012e1 <fd_close+0x3c>
+
+0080132c <close>:
+
+int
+close(int fdnum)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801332:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801335:	50                   	push   %eax
+  801336:	ff 75 08             	push   0x8(%ebp)
+  801339:	e8 9a fe ff ff       	call   8011d8 <fd_lookup>
+  80133e:	83 c4 10             	add    $0x10,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	79 02                	jns    801347 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+		return fd_close(fd, 1);
+  801347:	83 ec 08             	sub    $0x8,%esp
+  80134a:	6a 01                	push   $0x1
+  80134c:	ff 75 f4             	push   -0xc(%ebp)
+  80134f:	e8 51 ff ff ff       	call   8012a5 <fd_close>
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	eb ec                	jmp    801345 <close+0x19>
+
+00801359 <close_all>:
+
+void
+close_all(void)
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	53                   	push   %ebx
+  80135d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801360:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	53                   	push   %ebx
+  801369:	e8 be ff ff ff       	call   80132c <close>
+	for (i = 0; i < MAXFD; i++)
+  80136e:	83 c3 01             	add    $0x1,%ebx
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	83 fb 20             	cmp    $0x20,%ebx
+  801377:	75 ec                	jne    801365 <close_all+0xc>
+}
+  801379:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+
+0080137e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	57                   	push   %edi
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+  801384:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801387:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80138a:	50                   	push   %eax
+  80138b:	ff 75 08             	push   0x8(%ebp)
+  80138e:	e8 45 fe ff ff       	call   8011d8 <fd_lookup>
+  801393:	89 c3                	mov    %eax,%ebx
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	85 c0                	test   %eax,%eax
+  80139a:	78 7f                	js     80141b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80139c:	83 ec 0c             	sub    $0xc,%esp
+  80139f:	ff 75 0c             	push   0xc(%ebp)
+  8013a2:	e8 85 ff ff ff       	call   80132c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013aa:	c1 e6 0c             	shl    $0xc,%esi
+  8013ad:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013b6:	89 3c 24             	mov    %edi,(%esp)
+  8013b9:	e8 ad fd ff ff       	call   80116b <fd2data>
+  8013be:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013c0:	89 34 24             	mov    %esi,(%esp)
+  8013c3:	e8 a3 fd ff ff       	call   80116b <fd2data>
+  8013c8:	83 c4 10             	add    $0x10,%esp
+  8013cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013ce:	89 d8                	mov    %ebx,%eax
+  8013d0:	c1 e8 16             	shr    $0x16,%eax
+  8013d3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013da:	a8 01                	test   $0x1,%al
+  8013dc:	74 11                	je     8013ef <dup+0x71>
+  8013de:	89 d8                	mov    %ebx,%eax
+  8013e0:	c1 e8 0c             	shr    $0xc,%eax
+  8013e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ea:	f6 c2 01             	test   $0x1,%dl
+  8013ed:	75 36                	jne    801425 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013ef:	89 f8                	mov    %edi,%eax
+  8013f1:	c1 e8 0c             	shr    $0xc,%eax
+  8013f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801403:	50                   	push   %eax
+  801404:	56                   	push   %esi
+  801405:	6a 00                	push   $0x0
+  801407:	57                   	push   %edi
+  801408:	6a 00                	push   $0x0
+  80140a:	e8 93 f8 ff ff       	call   800ca2 <sys_page_map>
+  80140f:	89 c3                	mov    %eax,%ebx
+  801411:	83 c4 20             	add    $0x20,%esp
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 33                	js     80144b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801418:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80141b:	89 d8                	mov    %ebx,%eax
+  80141d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801420:	5b                   	pop    %ebx
+  801421:	5e                   	pop    %esi
+  801422:	5f                   	pop    %edi
+  801423:	5d                   	pop    %ebp
+  801424:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801425:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80142c:	83 ec 0c             	sub    $0xc,%esp
+  80142f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801434:	50                   	push   %eax
+  801435:	ff 75 d4             	push   -0x2c(%ebp)
+  801438:	6a 00                	push   $0x0
+  80143a:	53                   	push   %ebx
+  80143b:	6a 00                	push   $0x0
+  80143d:	e8 60 f8 ff ff       	call   800ca2 <sys_page_map>
+  801442:	89 c3                	mov    %eax,%ebx
+  801444:	83 c4 20             	add    $0x20,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	79 a4                	jns    8013ef <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80144b:	83 ec 08             	sub    $0x8,%esp
+  80144e:	56                   	push   %esi
+  80144f:	6a 00                	push   $0x0
+  801451:	e8 98 f8 ff ff       	call   800cee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801456:	83 c4 08             	add    $0x8,%esp
+  801459:	ff 75 d4             	push   -0x2c(%ebp)
+  80145c:	6a 00                	push   $0x0
+  80145e:	e8 8b f8 ff ff       	call   800cee <sys_page_unmap>
+	return r;
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	eb b3                	jmp    80141b <dup+0x9d>
+
+00801468 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	56                   	push   %esi
+  80146c:	53                   	push   %ebx
+  80146d:	83 ec 18             	sub    $0x18,%esp
+  801470:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801473:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801476:	50                   	push   %eax
+  801477:	53                   	push   %ebx
+  801478:	e8 5b fd ff ff       	call   8011d8 <fd_lookup>
+  80147d:	83 c4 10             	add    $0x10,%esp
+  801480:	85 c0                	test   %eax,%eax
+  801482:	78 3c                	js     8014c0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801484:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801487:	83 ec 08             	sub    $0x8,%esp
+  80148a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148d:	50                   	push   %eax
+  80148e:	ff 36                	push   (%esi)
+  801490:	e8 93 fd ff ff       	call   801228 <dev_lookup>
+  801495:	83 c4 10             	add    $0x10,%esp
+  801498:	85 c0                	test   %eax,%eax
+  80149a:	78 24                	js     8014c0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80149c:	8b 46 08             	mov    0x8(%esi),%eax
+  80149f:	83 e0 03             	and    $0x3,%eax
+  8014a2:	83 f8 01             	cmp    $0x1,%eax
+  8014a5:	74 20                	je     8014c7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014aa:	8b 40 08             	mov    0x8(%eax),%eax
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	74 61                	je     801512 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014b1:	83 ec 04             	sub    $0x4,%esp
+  8014b4:	ff 75 10             	push   0x10(%ebp)
+  8014b7:	ff 75 0c             	push   0xc(%ebp)
+  8014ba:	56                   	push   %esi
+  8014bb:	ff d0                	call   *%eax
+  8014bd:	83 c4 10             	add    $0x10,%esp
+}
+  8014c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c3:	5b                   	pop    %ebx
+  8014c4:	5e                   	pop    %esi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+  8014c7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014c9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014cf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014d4:	77 18                	ja     8014ee <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014d6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014db:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014dd:	c1 e8 10             	shr    $0x10,%eax
+  8014e0:	74 0c                	je     8014ee <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014e2:	c1 e0 10             	shl    $0x10,%eax
+  8014e5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014ea:	29 c2                	sub    %eax,%edx
+  8014ec:	eb 06                	jmp    8014f4 <read+0x8c>
+		return pthread_main_tls;
+  8014ee:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014f4:	8b 02                	mov    (%edx),%eax
+  8014f6:	8b 40 48             	mov    0x48(%eax),%eax
+  8014f9:	83 ec 04             	sub    $0x4,%esp
+  8014fc:	53                   	push   %ebx
+  8014fd:	50                   	push   %eax
+  8014fe:	68 c1 4b 80 00       	push   $0x804bc1
+  801503:	e8 2b ed ff ff       	call   800233 <cprintf>
+		return -E_INVAL;
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801510:	eb ae                	jmp    8014c0 <read+0x58>
+		return -E_NOT_SUPP;
+  801512:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801517:	eb a7                	jmp    8014c0 <read+0x58>
+
+00801519 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+  80151f:	83 ec 0c             	sub    $0xc,%esp
+  801522:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801525:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152d:	eb 02                	jmp    801531 <readn+0x18>
+  80152f:	01 c3                	add    %eax,%ebx
+  801531:	39 f3                	cmp    %esi,%ebx
+  801533:	73 21                	jae    801556 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801535:	83 ec 04             	sub    $0x4,%esp
+  801538:	89 f0                	mov    %esi,%eax
+  80153a:	29 d8                	sub    %ebx,%eax
+  80153c:	50                   	push   %eax
+  80153d:	89 d8                	mov    %ebx,%eax
+  80153f:	03 45 0c             	add    0xc(%ebp),%eax
+  801542:	50                   	push   %eax
+  801543:	57                   	push   %edi
+  801544:	e8 1f ff ff ff       	call   801468 <read>
+		if (m < 0)
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	78 04                	js     801554 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801550:	75 dd                	jne    80152f <readn+0x16>
+  801552:	eb 02                	jmp    801556 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801554:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801556:	89 d8                	mov    %ebx,%eax
+  801558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5f                   	pop    %edi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+
+00801560 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801560:	55                   	push   %ebp
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	56                   	push   %esi
+  801564:	53                   	push   %ebx
+  801565:	83 ec 18             	sub    $0x18,%esp
+  801568:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80156b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156e:	50                   	push   %eax
+  80156f:	53                   	push   %ebx
+  801570:	e8 63 fc ff ff       	call   8011d8 <fd_lookup>
+  801575:	83 c4 10             	add    $0x10,%esp
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	78 37                	js     8015b3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80157c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80157f:	83 ec 08             	sub    $0x8,%esp
+  801582:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801585:	50                   	push   %eax
+  801586:	ff 36                	push   (%esi)
+  801588:	e8 9b fc ff ff       	call   801228 <dev_lookup>
+  80158d:	83 c4 10             	add    $0x10,%esp
+  801590:	85 c0                	test   %eax,%eax
+  801592:	78 1f                	js     8015b3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801594:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801598:	74 20                	je     8015ba <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80159a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	74 61                	je     801605 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015a4:	83 ec 04             	sub    $0x4,%esp
+  8015a7:	ff 75 10             	push   0x10(%ebp)
+  8015aa:	ff 75 0c             	push   0xc(%ebp)
+  8015ad:	56                   	push   %esi
+  8015ae:	ff d0                	call   *%eax
+  8015b0:	83 c4 10             	add    $0x10,%esp
+}
+  8015b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5d                   	pop    %ebp
+  8015b9:	c3                   	ret
+  8015ba:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015bc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015c2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015c7:	77 18                	ja     8015e1 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015c9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015ce:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015d0:	c1 e8 10             	shr    $0x10,%eax
+  8015d3:	74 0c                	je     8015e1 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015d5:	c1 e0 10             	shl    $0x10,%eax
+  8015d8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015dd:	29 c2                	sub    %eax,%edx
+  8015df:	eb 06                	jmp    8015e7 <write+0x87>
+		return pthread_main_tls;
+  8015e1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015e7:	8b 02                	mov    (%edx),%eax
+  8015e9:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	53                   	push   %ebx
+  8015f0:	50                   	push   %eax
+  8015f1:	68 dd 4b 80 00       	push   $0x804bdd
+  8015f6:	e8 38 ec ff ff       	call   800233 <cprintf>
+		return -E_INVAL;
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801603:	eb ae                	jmp    8015b3 <write+0x53>
+		return -E_NOT_SUPP;
+  801605:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160a:	eb a7                	jmp    8015b3 <write+0x53>
+
+0080160c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	ff 75 08             	push   0x8(%ebp)
+  801619:	e8 ba fb ff ff       	call   8011d8 <fd_lookup>
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	85 c0                	test   %eax,%eax
+  801623:	78 0e                	js     801633 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801625:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801628:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80162b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+00801635 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 18             	sub    $0x18,%esp
+  80163d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801640:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	53                   	push   %ebx
+  801645:	e8 8e fb ff ff       	call   8011d8 <fd_lookup>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 34                	js     801685 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801651:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165a:	50                   	push   %eax
+  80165b:	ff 36                	push   (%esi)
+  80165d:	e8 c6 fb ff ff       	call   801228 <dev_lookup>
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 1c                	js     801685 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801669:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80166d:	74 1d                	je     80168c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80166f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801672:	8b 40 18             	mov    0x18(%eax),%eax
+  801675:	85 c0                	test   %eax,%eax
+  801677:	74 5e                	je     8016d7 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801679:	83 ec 08             	sub    $0x8,%esp
+  80167c:	ff 75 0c             	push   0xc(%ebp)
+  80167f:	56                   	push   %esi
+  801680:	ff d0                	call   *%eax
+  801682:	83 c4 10             	add    $0x10,%esp
+}
+  801685:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801688:	5b                   	pop    %ebx
+  801689:	5e                   	pop    %esi
+  80168a:	5d                   	pop    %ebp
+  80168b:	c3                   	ret
+  80168c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80168e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801694:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801699:	77 18                	ja     8016b3 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80169b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016a0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016a2:	c1 e8 10             	shr    $0x10,%eax
+  8016a5:	74 0c                	je     8016b3 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016a7:	c1 e0 10             	shl    $0x10,%eax
+  8016aa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016af:	29 c2                	sub    %eax,%edx
+  8016b1:	eb 06                	jmp    8016b9 <ftruncate+0x84>
+		return pthread_main_tls;
+  8016b3:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8016b9:	8b 02                	mov    (%edx),%eax
+  8016bb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016be:	83 ec 04             	sub    $0x4,%esp
+  8016c1:	53                   	push   %ebx
+  8016c2:	50                   	push   %eax
+  8016c3:	68 a0 4b 80 00       	push   $0x804ba0
+  8016c8:	e8 66 eb ff ff       	call   800233 <cprintf>
+		return -E_INVAL;
+  8016cd:	83 c4 10             	add    $0x10,%esp
+  8016d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d5:	eb ae                	jmp    801685 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016dc:	eb a7                	jmp    801685 <ftruncate+0x50>
+
+008016de <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	56                   	push   %esi
+  8016e2:	53                   	push   %ebx
+  8016e3:	83 ec 18             	sub    $0x18,%esp
+  8016e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016e9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ec:	50                   	push   %eax
+  8016ed:	ff 75 08             	push   0x8(%ebp)
+  8016f0:	e8 e3 fa ff ff       	call   8011d8 <fd_lookup>
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 49                	js     801745 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ff:	83 ec 08             	sub    $0x8,%esp
+  801702:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801705:	50                   	push   %eax
+  801706:	ff 36                	push   (%esi)
+  801708:	e8 1b fb ff ff       	call   801228 <dev_lookup>
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	78 31                	js     801745 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801717:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80171b:	74 2f                	je     80174c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80171d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801720:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801727:	00 00 00 
+	stat->st_isdir = 0;
+  80172a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801731:	00 00 00 
+	stat->st_dev = dev;
+  801734:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80173a:	83 ec 08             	sub    $0x8,%esp
+  80173d:	53                   	push   %ebx
+  80173e:	56                   	push   %esi
+  80173f:	ff 50 14             	call   *0x14(%eax)
+  801742:	83 c4 10             	add    $0x10,%esp
+}
+  801745:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801748:	5b                   	pop    %ebx
+  801749:	5e                   	pop    %esi
+  80174a:	5d                   	pop    %ebp
+  80174b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80174c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801751:	eb f2                	jmp    801745 <fstat+0x67>
+
+00801753 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	56                   	push   %esi
+  801757:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801758:	83 ec 08             	sub    $0x8,%esp
+  80175b:	6a 00                	push   $0x0
+  80175d:	ff 75 08             	push   0x8(%ebp)
+  801760:	e8 4b 03 00 00       	call   801ab0 <open>
+  801765:	89 c3                	mov    %eax,%ebx
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 1b                	js     801789 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80176e:	83 ec 08             	sub    $0x8,%esp
+  801771:	ff 75 0c             	push   0xc(%ebp)
+  801774:	50                   	push   %eax
+  801775:	e8 64 ff ff ff       	call   8016de <fstat>
+  80177a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80177c:	89 1c 24             	mov    %ebx,(%esp)
+  80177f:	e8 a8 fb ff ff       	call   80132c <close>
+	return r;
+  801784:	83 c4 10             	add    $0x10,%esp
+  801787:	89 f3                	mov    %esi,%ebx
+}
+  801789:	89 d8                	mov    %ebx,%eax
+  80178b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+
+00801792 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+  801797:	89 c6                	mov    %eax,%esi
+  801799:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80179b:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8017a2:	74 27                	je     8017cb <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017a4:	6a 07                	push   $0x7
+  8017a6:	68 00 70 80 00       	push   $0x807000
+  8017ab:	56                   	push   %esi
+  8017ac:	ff 35 00 60 80 00    	push   0x806000
+  8017b2:	e8 4e 2c 00 00       	call   804405 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017b7:	83 c4 0c             	add    $0xc,%esp
+  8017ba:	6a 00                	push   $0x0
+  8017bc:	53                   	push   %ebx
+  8017bd:	6a 00                	push   $0x0
+  8017bf:	e8 4b 2b 00 00       	call   80430f <ipc_recv>
+}
+  8017c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c7:	5b                   	pop    %ebx
+  8017c8:	5e                   	pop    %esi
+  8017c9:	5d                   	pop    %ebp
+  8017ca:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017cb:	83 ec 0c             	sub    $0xc,%esp
+  8017ce:	6a 01                	push   $0x1
+  8017d0:	e8 86 2c 00 00       	call   80445b <ipc_find_env>
+  8017d5:	a3 00 60 80 00       	mov    %eax,0x806000
+  8017da:	83 c4 10             	add    $0x10,%esp
+  8017dd:	eb c5                	jmp    8017a4 <fsipc+0x12>
+
+008017df <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017e6:	68 04 60 80 00       	push   $0x806004
+  8017eb:	e8 29 1b 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8017fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017fe:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801803:	ba 00 00 00 00       	mov    $0x0,%edx
+  801808:	b8 02 00 00 00       	mov    $0x2,%eax
+  80180d:	e8 80 ff ff ff       	call   801792 <fsipc>
+  801812:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801814:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80181b:	e8 66 1b 00 00       	call   803386 <mutex_unlock>
+	return r;
+}
+  801820:	89 d8                	mov    %ebx,%eax
+  801822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+00801827 <devfile_flush>:
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	53                   	push   %ebx
+  80182b:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80182e:	68 04 60 80 00       	push   $0x806004
+  801833:	e8 e1 1a 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801838:	8b 45 08             	mov    0x8(%ebp),%eax
+  80183b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80183e:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801843:	ba 00 00 00 00       	mov    $0x0,%edx
+  801848:	b8 06 00 00 00       	mov    $0x6,%eax
+  80184d:	e8 40 ff ff ff       	call   801792 <fsipc>
+  801852:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801854:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80185b:	e8 26 1b 00 00       	call   803386 <mutex_unlock>
+}
+  801860:	89 d8                	mov    %ebx,%eax
+  801862:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801865:	c9                   	leave
+  801866:	c3                   	ret
+
+00801867 <devfile_stat>:
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+  80186c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80186f:	83 ec 0c             	sub    $0xc,%esp
+  801872:	68 04 60 80 00       	push   $0x806004
+  801877:	e8 9d 1a 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80187c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801882:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801891:	e8 fc fe ff ff       	call   801792 <fsipc>
+  801896:	89 c3                	mov    %eax,%ebx
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	79 16                	jns    8018b5 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80189f:	83 ec 0c             	sub    $0xc,%esp
+  8018a2:	68 04 60 80 00       	push   $0x806004
+  8018a7:	e8 da 1a 00 00       	call   803386 <mutex_unlock>
+}
+  8018ac:	89 d8                	mov    %ebx,%eax
+  8018ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b1:	5b                   	pop    %ebx
+  8018b2:	5e                   	pop    %esi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	68 00 70 80 00       	push   $0x807000
+  8018bd:	56                   	push   %esi
+  8018be:	e8 54 ef ff ff       	call   800817 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8018c3:	a1 80 70 80 00       	mov    0x807080,%eax
+  8018c8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018ce:	a1 84 70 80 00       	mov    0x807084,%eax
+  8018d3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018d9:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e1:	eb bc                	jmp    80189f <devfile_stat+0x38>
+
+008018e3 <devfile_write>:
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	53                   	push   %ebx
+  8018e7:	83 ec 10             	sub    $0x10,%esp
+  8018ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8018ed:	68 04 60 80 00       	push   $0x806004
+  8018f2:	e8 22 1a 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018fd:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80190b:	76 3d                	jbe    80194a <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80190d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801912:	39 c3                	cmp    %eax,%ebx
+  801914:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801917:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80191a:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  80191f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801925:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80192f:	e8 5e fe ff ff       	call   801792 <fsipc>
+  801934:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	68 04 60 80 00       	push   $0x806004
+  80193e:	e8 43 1a 00 00       	call   803386 <mutex_unlock>
+}
+  801943:	89 d8                	mov    %ebx,%eax
+  801945:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80194a:	83 ec 04             	sub    $0x4,%esp
+  80194d:	53                   	push   %ebx
+  80194e:	ff 75 0c             	push   0xc(%ebp)
+  801951:	68 0c 70 80 00       	push   $0x80700c
+  801956:	e8 42 f0 ff ff       	call   80099d <memmove>
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	eb b5                	jmp    80191a <devfile_write+0x37>
+
+00801965 <devfile_read>:
+{
+  801965:	55                   	push   %ebp
+  801966:	89 e5                	mov    %esp,%ebp
+  801968:	57                   	push   %edi
+  801969:	56                   	push   %esi
+  80196a:	53                   	push   %ebx
+  80196b:	83 ec 0c             	sub    $0xc,%esp
+  80196e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801971:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801974:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801977:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80197d:	0f 86 8c 00 00 00    	jbe    801a0f <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801983:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801988:	39 c3                	cmp    %eax,%ebx
+  80198a:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80198d:	89 f8                	mov    %edi,%eax
+  80198f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801992:	eb 0f                	jmp    8019a3 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801994:	0f b6 08             	movzbl (%eax),%ecx
+  801997:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801999:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80199e:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019a3:	39 d0                	cmp    %edx,%eax
+  8019a5:	72 ed                	jb     801994 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8019a7:	83 ec 0c             	sub    $0xc,%esp
+  8019aa:	68 04 60 80 00       	push   $0x806004
+  8019af:	e8 65 19 00 00       	call   803319 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019b4:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019b7:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8019bc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8019c2:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8019c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019d2:	e8 bb fd ff ff       	call   801792 <fsipc>
+  8019d7:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019d9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8019e0:	e8 a1 19 00 00       	call   803386 <mutex_unlock>
+		assert(r <= (int) n);
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	39 f3                	cmp    %esi,%ebx
+  8019ea:	7c 0a                	jl     8019f6 <devfile_read+0x91>
+}
+  8019ec:	89 f0                	mov    %esi,%eax
+  8019ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5f                   	pop    %edi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+		assert(r <= (int) n);
+  8019f6:	68 10 4c 80 00       	push   $0x804c10
+  8019fb:	68 1d 4c 80 00       	push   $0x804c1d
+  801a00:	68 90 00 00 00       	push   $0x90
+  801a05:	68 32 4c 80 00       	push   $0x804c32
+  801a0a:	e8 49 e7 ff ff       	call   800158 <_panic>
+	mutex_lock(&fsipc_mu);
+  801a0f:	83 ec 0c             	sub    $0xc,%esp
+  801a12:	68 04 60 80 00       	push   $0x806004
+  801a17:	e8 fd 18 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a1c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a1f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a24:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801a2a:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801a31:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801a34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a39:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a3e:	e8 4f fd ff ff       	call   801792 <fsipc>
+  801a43:	89 c6                	mov    %eax,%esi
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 1d                	js     801a69 <devfile_read+0x104>
+		assert(r <= n);
+  801a4c:	39 c3                	cmp    %eax,%ebx
+  801a4e:	72 2e                	jb     801a7e <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a50:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a55:	7f 40                	jg     801a97 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a57:	83 ec 04             	sub    $0x4,%esp
+  801a5a:	50                   	push   %eax
+  801a5b:	68 00 70 80 00       	push   $0x807000
+  801a60:	57                   	push   %edi
+  801a61:	e8 37 ef ff ff       	call   80099d <memmove>
+  801a66:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a69:	83 ec 0c             	sub    $0xc,%esp
+  801a6c:	68 04 60 80 00       	push   $0x806004
+  801a71:	e8 10 19 00 00       	call   803386 <mutex_unlock>
+	return r;
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	e9 6e ff ff ff       	jmp    8019ec <devfile_read+0x87>
+		assert(r <= n);
+  801a7e:	68 3d 4c 80 00       	push   $0x804c3d
+  801a83:	68 1d 4c 80 00       	push   $0x804c1d
+  801a88:	68 99 00 00 00       	push   $0x99
+  801a8d:	68 32 4c 80 00       	push   $0x804c32
+  801a92:	e8 c1 e6 ff ff       	call   800158 <_panic>
+		assert(r <= PGSIZE);
+  801a97:	68 44 4c 80 00       	push   $0x804c44
+  801a9c:	68 1d 4c 80 00       	push   $0x804c1d
+  801aa1:	68 9a 00 00 00       	push   $0x9a
+  801aa6:	68 32 4c 80 00       	push   $0x804c32
+  801aab:	e8 a8 e6 ff ff       	call   800158 <_panic>
+
+00801ab0 <open>:
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 1c             	sub    $0x1c,%esp
+  801ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801abb:	56                   	push   %esi
+  801abc:	e8 1b ed ff ff       	call   8007dc <strlen>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ac9:	0f 8f 85 00 00 00    	jg     801b54 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+  801ad2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad5:	50                   	push   %eax
+  801ad6:	e8 a7 f6 ff ff       	call   801182 <fd_alloc>
+  801adb:	89 c3                	mov    %eax,%ebx
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 55                	js     801b39 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801ae4:	83 ec 0c             	sub    $0xc,%esp
+  801ae7:	68 04 60 80 00       	push   $0x806004
+  801aec:	e8 28 18 00 00       	call   803319 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801af1:	83 c4 08             	add    $0x8,%esp
+  801af4:	56                   	push   %esi
+  801af5:	68 00 70 80 00       	push   $0x807000
+  801afa:	e8 18 ed ff ff       	call   800817 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801aff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b02:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b0f:	e8 7e fc ff ff       	call   801792 <fsipc>
+  801b14:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b16:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b1d:	e8 64 18 00 00       	call   803386 <mutex_unlock>
+	if (r < 0) {
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	85 db                	test   %ebx,%ebx
+  801b27:	78 19                	js     801b42 <open+0x92>
+	return fd2num(fd);
+  801b29:	83 ec 0c             	sub    $0xc,%esp
+  801b2c:	ff 75 f4             	push   -0xc(%ebp)
+  801b2f:	e8 27 f6 ff ff       	call   80115b <fd2num>
+  801b34:	89 c3                	mov    %eax,%ebx
+  801b36:	83 c4 10             	add    $0x10,%esp
+}
+  801b39:	89 d8                	mov    %ebx,%eax
+  801b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5d                   	pop    %ebp
+  801b41:	c3                   	ret
+		fd_close(fd, 0);
+  801b42:	83 ec 08             	sub    $0x8,%esp
+  801b45:	6a 00                	push   $0x0
+  801b47:	ff 75 f4             	push   -0xc(%ebp)
+  801b4a:	e8 56 f7 ff ff       	call   8012a5 <fd_close>
+		return r;
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	eb e5                	jmp    801b39 <open+0x89>
+		return -E_BAD_PATH;
+  801b54:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b59:	eb de                	jmp    801b39 <open+0x89>
+
+00801b5b <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	53                   	push   %ebx
+  801b5f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b65:	50                   	push   %eax
+  801b66:	ff 75 08             	push   0x8(%ebp)
+  801b69:	e8 6a f6 ff ff       	call   8011d8 <fd_lookup>
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	78 5b                	js     801bd2 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b80:	39 08                	cmp    %ecx,(%eax)
+  801b82:	75 55                	jne    801bd9 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b84:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b88:	74 56                	je     801be0 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b8a:	83 ec 0c             	sub    $0xc,%esp
+  801b8d:	68 04 60 80 00       	push   $0x806004
+  801b92:	e8 82 17 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b9d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801ba2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ba5:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801baa:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bad:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801bbc:	e8 d1 fb ff ff       	call   801792 <fsipc>
+  801bc1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bc3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801bca:	e8 b7 17 00 00       	call   803386 <mutex_unlock>
+	return r;
+  801bcf:	83 c4 10             	add    $0x10,%esp
+}
+  801bd2:	89 d8                	mov    %ebx,%eax
+  801bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bd9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801bde:	eb f2                	jmp    801bd2 <fallocate+0x77>
+		return -E_INVAL;
+  801be0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801be5:	eb eb                	jmp    801bd2 <fallocate+0x77>
+
+00801be7 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+  801bea:	56                   	push   %esi
+  801beb:	53                   	push   %ebx
+  801bec:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bef:	89 f3                	mov    %esi,%ebx
+  801bf1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bf7:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bfa:	eb 06                	jmp    801c02 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bfc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c02:	39 f3                	cmp    %esi,%ebx
+  801c04:	73 14                	jae    801c1a <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c06:	83 ec 08             	sub    $0x8,%esp
+  801c09:	53                   	push   %ebx
+  801c0a:	6a 00                	push   $0x0
+  801c0c:	e8 dd f0 ff ff       	call   800cee <sys_page_unmap>
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	79 e4                	jns    801bfc <munmap+0x15>
+  801c18:	eb 05                	jmp    801c1f <munmap+0x38>
+			return r;
+	return 0;
+  801c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c22:	5b                   	pop    %ebx
+  801c23:	5e                   	pop    %esi
+  801c24:	5d                   	pop    %ebp
+  801c25:	c3                   	ret
+
+00801c26 <mmap>:
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	57                   	push   %edi
+  801c2a:	56                   	push   %esi
+  801c2b:	53                   	push   %ebx
+  801c2c:	83 ec 24             	sub    $0x24,%esp
+  801c2f:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c32:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c35:	50                   	push   %eax
+  801c36:	ff 75 08             	push   0x8(%ebp)
+  801c39:	e8 9a f5 ff ff       	call   8011d8 <fd_lookup>
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	0f 88 37 01 00 00    	js     801d80 <mmap+0x15a>
+		return NULL;
+  801c49:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c4e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c51:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c57:	39 0a                	cmp    %ecx,(%edx)
+  801c59:	0f 85 05 01 00 00    	jne    801d64 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c5f:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c66:	0f 85 1b 01 00 00    	jne    801d87 <mmap+0x161>
+  801c6c:	89 f0                	mov    %esi,%eax
+  801c6e:	83 e8 01             	sub    $0x1,%eax
+  801c71:	0f 88 17 01 00 00    	js     801d8e <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c77:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c7b:	75 28                	jne    801ca5 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	68 04 60 80 00       	push   $0x806004
+  801c85:	e8 8f 16 00 00       	call   803319 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c8a:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c90:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c96:	83 c4 10             	add    $0x10,%esp
+  801c99:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c9e:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801ca3:	eb 2b                	jmp    801cd0 <mmap+0xaa>
+		cow_enable();
+  801ca5:	e8 f4 21 00 00       	call   803e9e <cow_enable>
+  801caa:	eb d1                	jmp    801c7d <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801cac:	89 c2                	mov    %eax,%edx
+  801cae:	c1 ea 0c             	shr    $0xc,%edx
+  801cb1:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801cb8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801cbe:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801cc4:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801cc7:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801cc9:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801cce:	77 25                	ja     801cf5 <mmap+0xcf>
+  801cd0:	89 c2                	mov    %eax,%edx
+  801cd2:	29 da                	sub    %ebx,%edx
+  801cd4:	39 ca                	cmp    %ecx,%edx
+  801cd6:	73 3a                	jae    801d12 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801cd8:	89 c2                	mov    %eax,%edx
+  801cda:	c1 ea 16             	shr    $0x16,%edx
+  801cdd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ce4:	f6 c2 01             	test   $0x1,%dl
+  801ce7:	75 c3                	jne    801cac <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801ce9:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801cee:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801cf3:	eb d4                	jmp    801cc9 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801cf5:	29 d8                	sub    %ebx,%eax
+  801cf7:	39 c8                	cmp    %ecx,%eax
+  801cf9:	73 17                	jae    801d12 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801cfb:	83 ec 0c             	sub    $0xc,%esp
+  801cfe:	68 04 60 80 00       	push   $0x806004
+  801d03:	e8 7e 16 00 00       	call   803386 <mutex_unlock>
+		return NULL;
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d10:	eb 52                	jmp    801d64 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d12:	85 db                	test   %ebx,%ebx
+  801d14:	74 e5                	je     801cfb <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d19:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d1c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801d21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d24:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801d29:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801d2f:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801d35:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d38:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d42:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d47:	e8 46 fa ff ff       	call   801792 <fsipc>
+  801d4c:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d4e:	83 ec 0c             	sub    $0xc,%esp
+  801d51:	68 04 60 80 00       	push   $0x806004
+  801d56:	e8 2b 16 00 00       	call   803386 <mutex_unlock>
+	if (r < 0) {
+  801d5b:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d5e:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d60:	85 ff                	test   %edi,%edi
+  801d62:	78 08                	js     801d6c <mmap+0x146>
+}
+  801d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d67:	5b                   	pop    %ebx
+  801d68:	5e                   	pop    %esi
+  801d69:	5f                   	pop    %edi
+  801d6a:	5d                   	pop    %ebp
+  801d6b:	c3                   	ret
+		munmap((void*) va, len);
+  801d6c:	83 ec 08             	sub    $0x8,%esp
+  801d6f:	56                   	push   %esi
+  801d70:	53                   	push   %ebx
+  801d71:	e8 71 fe ff ff       	call   801be7 <munmap>
+		return NULL;
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	eb e4                	jmp    801d64 <mmap+0x13e>
+		return NULL;
+  801d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d85:	eb dd                	jmp    801d64 <mmap+0x13e>
+		return NULL;
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	eb d6                	jmp    801d64 <mmap+0x13e>
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	eb cf                	jmp    801d64 <mmap+0x13e>
+
+00801d95 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	53                   	push   %ebx
+  801d99:	83 ec 10             	sub    $0x10,%esp
+  801d9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d9f:	53                   	push   %ebx
+  801da0:	e8 37 ea ff ff       	call   8007dc <strlen>
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dad:	7f 42                	jg     801df1 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801daf:	83 ec 0c             	sub    $0xc,%esp
+  801db2:	68 04 60 80 00       	push   $0x806004
+  801db7:	e8 5d 15 00 00       	call   803319 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dbc:	83 c4 08             	add    $0x8,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	68 00 70 80 00       	push   $0x807000
+  801dc5:	e8 4d ea ff ff       	call   800817 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dcf:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dd4:	e8 b9 f9 ff ff       	call   801792 <fsipc>
+  801dd9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ddb:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801de2:	e8 9f 15 00 00       	call   803386 <mutex_unlock>
+	return r;
+  801de7:	83 c4 10             	add    $0x10,%esp
+}
+  801dea:	89 d8                	mov    %ebx,%eax
+  801dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+		return -E_BAD_PATH;
+  801df1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801df6:	eb f2                	jmp    801dea <remove+0x55>
+
+00801df8 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	53                   	push   %ebx
+  801dfc:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dff:	68 04 60 80 00       	push   $0x806004
+  801e04:	e8 10 15 00 00       	call   803319 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e13:	e8 7a f9 ff ff       	call   801792 <fsipc>
+  801e18:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e1a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801e21:	e8 60 15 00 00       	call   803386 <mutex_unlock>
+	return r;
+}
+  801e26:	89 d8                	mov    %ebx,%eax
+  801e28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2b:	c9                   	leave
+  801e2c:	c3                   	ret
+
+00801e2d <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	56                   	push   %esi
+  801e31:	53                   	push   %ebx
+  801e32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e35:	83 ec 0c             	sub    $0xc,%esp
+  801e38:	68 04 60 80 00       	push   $0x806004
+  801e3d:	e8 d7 14 00 00       	call   803319 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e45:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e54:	e8 39 f9 ff ff       	call   801792 <fsipc>
+  801e59:	89 c6                	mov    %eax,%esi
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	85 db                	test   %ebx,%ebx
+  801e60:	74 7b                	je     801edd <fs_bcstat+0xb0>
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 77                	js     801edd <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e66:	a1 00 70 80 00       	mov    0x807000,%eax
+  801e6b:	89 03                	mov    %eax,(%ebx)
+  801e6d:	a1 04 70 80 00       	mov    0x807004,%eax
+  801e72:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e75:	a1 08 70 80 00       	mov    0x807008,%eax
+  801e7a:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e7d:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e82:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e85:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e8a:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e8d:	a1 14 70 80 00       	mov    0x807014,%eax
+  801e92:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e95:	a1 18 70 80 00       	mov    0x807018,%eax
+  801e9a:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e9d:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801ea2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801ea5:	a1 20 70 80 00       	mov    0x807020,%eax
+  801eaa:	89 43 20             	mov    %eax,0x20(%ebx)
+  801ead:	a1 24 70 80 00       	mov    0x807024,%eax
+  801eb2:	89 43 24             	mov    %eax,0x24(%ebx)
+  801eb5:	a1 28 70 80 00       	mov    0x807028,%eax
+  801eba:	89 43 28             	mov    %eax,0x28(%ebx)
+  801ebd:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801ec2:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801ec5:	a1 30 70 80 00       	mov    0x807030,%eax
+  801eca:	89 43 30             	mov    %eax,0x30(%ebx)
+  801ecd:	a1 34 70 80 00       	mov    0x807034,%eax
+  801ed2:	89 43 34             	mov    %eax,0x34(%ebx)
+  801ed5:	a1 38 70 80 00       	mov    0x807038,%eax
+  801eda:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801edd:	83 ec 0c             	sub    $0xc,%esp
+  801ee0:	68 04 60 80 00       	push   $0x806004
+  801ee5:	e8 9c 14 00 00       	call   803386 <mutex_unlock>
+	return r;
+}
+  801eea:	89 f0                	mov    %esi,%eax
+  801eec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eef:	5b                   	pop    %ebx
+  801ef0:	5e                   	pop    %esi
+  801ef1:	5d                   	pop    %ebp
+  801ef2:	c3                   	ret
+
+00801ef3 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	56                   	push   %esi
+  801ef7:	53                   	push   %ebx
+  801ef8:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801efa:	0f b6 10             	movzbl (%eax),%edx
+  801efd:	80 fa 72             	cmp    $0x72,%dl
+  801f00:	74 44                	je     801f46 <parse_mode+0x53>
+  801f02:	80 fa 77             	cmp    $0x77,%dl
+  801f05:	74 4b                	je     801f52 <parse_mode+0x5f>
+  801f07:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f0c:	80 fa 61             	cmp    $0x61,%dl
+  801f0f:	74 09                	je     801f1a <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801f11:	89 d8                	mov    %ebx,%eax
+  801f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+	switch (mode[0]) {
+  801f1a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801f1f:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801f24:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801f26:	83 ec 08             	sub    $0x8,%esp
+  801f29:	6a 2b                	push   $0x2b
+  801f2b:	50                   	push   %eax
+  801f2c:	e8 f8 e9 ff ff       	call   800929 <strchr>
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	74 d9                	je     801f11 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801f38:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801f3b:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f3e:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f44:	eb cb                	jmp    801f11 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f46:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f50:	eb d2                	jmp    801f24 <parse_mode+0x31>
+  801f52:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f57:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f5c:	eb c6                	jmp    801f24 <parse_mode+0x31>
+
+00801f5e <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	57                   	push   %edi
+  801f62:	56                   	push   %esi
+  801f63:	53                   	push   %ebx
+  801f64:	83 ec 1c             	sub    $0x1c,%esp
+  801f67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f6a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f6d:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f77:	83 c0 24             	add    $0x24,%eax
+  801f7a:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f7e:	74 17                	je     801f97 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f80:	83 c3 01             	add    $0x1,%ebx
+  801f83:	83 fb 10             	cmp    $0x10,%ebx
+  801f86:	75 ef                	jne    801f77 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f88:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f8d:	89 f0                	mov    %esi,%eax
+  801f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f92:	5b                   	pop    %ebx
+  801f93:	5e                   	pop    %esi
+  801f94:	5f                   	pop    %edi
+  801f95:	5d                   	pop    %ebp
+  801f96:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f97:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f9e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801fa1:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801fa4:	c1 e7 02             	shl    $0x2,%edi
+  801fa7:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801fad:	83 ec 04             	sub    $0x4,%esp
+  801fb0:	6a 24                	push   $0x24
+  801fb2:	6a 00                	push   $0x0
+  801fb4:	56                   	push   %esi
+  801fb5:	e8 ae e9 ff ff       	call   800968 <memset>
+			streams[i].f_fd = fd;
+  801fba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801fbd:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801fc3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801fc6:	01 d8                	add    %ebx,%eax
+  801fc8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fcb:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	eb b6                	jmp    801f8d <stream_alloc+0x2f>
+
+00801fd7 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801fd7:	55                   	push   %ebp
+  801fd8:	89 e5                	mov    %esp,%ebp
+  801fda:	53                   	push   %ebx
+  801fdb:	83 ec 14             	sub    $0x14,%esp
+  801fde:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801fe0:	8b 40 18             	mov    0x18(%eax),%eax
+  801fe3:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801fe6:	74 4a                	je     802032 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fe8:	83 ec 08             	sub    $0x8,%esp
+  801feb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fee:	50                   	push   %eax
+  801fef:	ff 33                	push   (%ebx)
+  801ff1:	e8 e2 f1 ff ff       	call   8011d8 <fd_lookup>
+  801ff6:	89 c2                	mov    %eax,%edx
+  801ff8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802000:	85 d2                	test   %edx,%edx
+  802002:	78 41                	js     802045 <stream_unread+0x6e>
+  802004:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802007:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80200d:	39 0a                	cmp    %ecx,(%edx)
+  80200f:	75 34                	jne    802045 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802011:	8b 43 14             	mov    0x14(%ebx),%eax
+  802014:	03 42 04             	add    0x4(%edx),%eax
+  802017:	2b 43 18             	sub    0x18(%ebx),%eax
+  80201a:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80201d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802024:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80202b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802030:	eb 13                	jmp    802045 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802032:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802039:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802040:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802045:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802048:	c9                   	leave
+  802049:	c3                   	ret
+
+0080204a <stream_drain>:
+{
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	56                   	push   %esi
+  80204e:	53                   	push   %ebx
+  80204f:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802051:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802056:	eb 02                	jmp    80205a <stream_drain+0x10>
+  802058:	01 c3                	add    %eax,%ebx
+  80205a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80205d:	39 c3                	cmp    %eax,%ebx
+  80205f:	73 43                	jae    8020a4 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802061:	83 ec 04             	sub    $0x4,%esp
+  802064:	29 d8                	sub    %ebx,%eax
+  802066:	50                   	push   %eax
+  802067:	89 d8                	mov    %ebx,%eax
+  802069:	03 46 0c             	add    0xc(%esi),%eax
+  80206c:	50                   	push   %eax
+  80206d:	ff 36                	push   (%esi)
+  80206f:	e8 ec f4 ff ff       	call   801560 <write>
+  802074:	83 c4 10             	add    $0x10,%esp
+  802077:	85 c0                	test   %eax,%eax
+  802079:	7f dd                	jg     802058 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80207b:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80207f:	8b 56 0c             	mov    0xc(%esi),%edx
+  802082:	83 ec 04             	sub    $0x4,%esp
+  802085:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802088:	29 d8                	sub    %ebx,%eax
+  80208a:	50                   	push   %eax
+  80208b:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80208e:	50                   	push   %eax
+  80208f:	52                   	push   %edx
+  802090:	e8 08 e9 ff ff       	call   80099d <memmove>
+			f->f_wend -= done;
+  802095:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802098:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8020a2:	eb 0a                	jmp    8020ae <stream_drain+0x64>
+  8020a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8020a9:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8020ae:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8020b1:	89 d0                	mov    %edx,%eax
+  8020b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b6:	5b                   	pop    %ebx
+  8020b7:	5e                   	pop    %esi
+  8020b8:	5d                   	pop    %ebp
+  8020b9:	c3                   	ret
+
+008020ba <stream_setup>:
+	if (f->f_buf)
+  8020ba:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8020be:	74 01                	je     8020c1 <stream_setup+0x7>
+  8020c0:	c3                   	ret
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	53                   	push   %ebx
+  8020c5:	83 ec 04             	sub    $0x4,%esp
+  8020c8:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8020ca:	8b 40 08             	mov    0x8(%eax),%eax
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	74 17                	je     8020e8 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8020d1:	83 f8 03             	cmp    $0x3,%eax
+  8020d4:	75 2d                	jne    802103 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8020d6:	8d 43 20             	lea    0x20(%ebx),%eax
+  8020d9:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8020dc:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e6:	c9                   	leave
+  8020e7:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	ff 33                	push   (%ebx)
+  8020ed:	e8 29 1b 00 00       	call   803c1b <iscons>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	0f 9f c0             	setg   %al
+  8020fa:	0f b6 c0             	movzbl %al,%eax
+  8020fd:	83 c0 01             	add    $0x1,%eax
+  802100:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802103:	83 ec 0c             	sub    $0xc,%esp
+  802106:	68 00 10 00 00       	push   $0x1000
+  80210b:	e8 6e 0b 00 00       	call   802c7e <malloc>
+  802110:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	85 c0                	test   %eax,%eax
+  802118:	74 bc                	je     8020d6 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80211a:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802121:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802125:	eb bc                	jmp    8020e3 <stream_setup+0x29>
+
+00802127 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	53                   	push   %ebx
+  80212b:	83 ec 04             	sub    $0x4,%esp
+  80212e:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802130:	e8 85 ff ff ff       	call   8020ba <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802135:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80213a:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80213e:	74 3d                	je     80217d <stream_fill+0x56>
+  802140:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802144:	74 10                	je     802156 <stream_fill+0x2f>
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	e8 fd fe ff ff       	call   80204a <stream_drain>
+		return 0;
+  80214d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 27                	js     80217d <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	ff 73 10             	push   0x10(%ebx)
+  80215c:	ff 73 0c             	push   0xc(%ebx)
+  80215f:	ff 33                	push   (%ebx)
+  802161:	e8 02 f3 ff ff       	call   801468 <read>
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	7e 17                	jle    802184 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80216d:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802171:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802178:	89 c2                	mov    %eax,%edx
+  80217a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80217d:	89 d0                	mov    %edx,%eax
+  80217f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802184:	c1 f8 1f             	sar    $0x1f,%eax
+  802187:	83 e0 04             	and    $0x4,%eax
+  80218a:	83 c0 04             	add    $0x4,%eax
+  80218d:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802190:	ba 00 00 00 00       	mov    $0x0,%edx
+  802195:	eb e6                	jmp    80217d <stream_fill+0x56>
+
+00802197 <fopen>:
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	57                   	push   %edi
+  80219b:	56                   	push   %esi
+  80219c:	53                   	push   %ebx
+  80219d:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8021a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021a6:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8021ac:	89 f0                	mov    %esi,%eax
+  8021ae:	e8 40 fd ff ff       	call   801ef3 <parse_mode>
+		return 0;
+  8021b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	78 2d                	js     8021e9 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8021bc:	83 ec 08             	sub    $0x8,%esp
+  8021bf:	50                   	push   %eax
+  8021c0:	ff 75 08             	push   0x8(%ebp)
+  8021c3:	e8 e8 f8 ff ff       	call   801ab0 <open>
+  8021c8:	89 c7                	mov    %eax,%edi
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 58                	js     802229 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021d1:	80 3e 61             	cmpb   $0x61,(%esi)
+  8021d4:	74 1d                	je     8021f3 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8021d6:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8021dc:	89 f8                	mov    %edi,%eax
+  8021de:	e8 7b fd ff ff       	call   801f5e <stream_alloc>
+  8021e3:	89 c3                	mov    %eax,%ebx
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	74 32                	je     80221b <fopen+0x84>
+}
+  8021e9:	89 d8                	mov    %ebx,%eax
+  8021eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ee:	5b                   	pop    %ebx
+  8021ef:	5e                   	pop    %esi
+  8021f0:	5f                   	pop    %edi
+  8021f1:	5d                   	pop    %ebp
+  8021f2:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021f3:	83 ec 08             	sub    $0x8,%esp
+  8021f6:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8021fc:	50                   	push   %eax
+  8021fd:	57                   	push   %edi
+  8021fe:	e8 db f4 ff ff       	call   8016de <fstat>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 cc                	js     8021d6 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80220a:	83 ec 08             	sub    $0x8,%esp
+  80220d:	ff 75 dc             	push   -0x24(%ebp)
+  802210:	57                   	push   %edi
+  802211:	e8 f6 f3 ff ff       	call   80160c <seek>
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	eb bb                	jmp    8021d6 <fopen+0x3f>
+		close(fd);
+  80221b:	83 ec 0c             	sub    $0xc,%esp
+  80221e:	57                   	push   %edi
+  80221f:	e8 08 f1 ff ff       	call   80132c <close>
+  802224:	83 c4 10             	add    $0x10,%esp
+  802227:	eb c0                	jmp    8021e9 <fopen+0x52>
+		return 0;
+  802229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80222e:	eb b9                	jmp    8021e9 <fopen+0x52>
+
+00802230 <fdopen>:
+{
+  802230:	55                   	push   %ebp
+  802231:	89 e5                	mov    %esp,%ebp
+  802233:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802236:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802239:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80223c:	e8 b2 fc ff ff       	call   801ef3 <parse_mode>
+  802241:	89 c2                	mov    %eax,%edx
+		return 0;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802248:	85 d2                	test   %edx,%edx
+  80224a:	78 0b                	js     802257 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80224c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80224f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802252:	e8 07 fd ff ff       	call   801f5e <stream_alloc>
+}
+  802257:	c9                   	leave
+  802258:	c3                   	ret
+
+00802259 <setvbuf>:
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	57                   	push   %edi
+  80225d:	56                   	push   %esi
+  80225e:	53                   	push   %ebx
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802262:	8b 55 10             	mov    0x10(%ebp),%edx
+  802265:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802268:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80226c:	75 3a                	jne    8022a8 <setvbuf+0x4f>
+  80226e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802271:	83 fe 02             	cmp    $0x2,%esi
+  802274:	77 39                	ja     8022af <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802276:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802279:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80227d:	0f 95 c3             	setne  %bl
+  802280:	85 ff                	test   %edi,%edi
+  802282:	0f 95 c1             	setne  %cl
+  802285:	84 cb                	test   %cl,%bl
+  802287:	74 05                	je     80228e <setvbuf+0x35>
+  802289:	83 fa 03             	cmp    $0x3,%edx
+  80228c:	75 0a                	jne    802298 <setvbuf+0x3f>
+	return 0;
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802293:	5b                   	pop    %ebx
+  802294:	5e                   	pop    %esi
+  802295:	5f                   	pop    %edi
+  802296:	5d                   	pop    %ebp
+  802297:	c3                   	ret
+		f->f_buf = buf;
+  802298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80229b:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80229e:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8022a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a6:	eb eb                	jmp    802293 <setvbuf+0x3a>
+		return EOF;
+  8022a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022ad:	eb e4                	jmp    802293 <setvbuf+0x3a>
+  8022af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022b4:	eb dd                	jmp    802293 <setvbuf+0x3a>
+
+008022b6 <fflush>:
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	57                   	push   %edi
+  8022ba:	56                   	push   %esi
+  8022bb:	53                   	push   %ebx
+  8022bc:	83 ec 0c             	sub    $0xc,%esp
+  8022bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8022c2:	85 db                	test   %ebx,%ebx
+  8022c4:	74 1a                	je     8022e0 <fflush+0x2a>
+	stream_unread(f);
+  8022c6:	89 d8                	mov    %ebx,%eax
+  8022c8:	e8 0a fd ff ff       	call   801fd7 <stream_unread>
+	return stream_drain(f);
+  8022cd:	89 d8                	mov    %ebx,%eax
+  8022cf:	e8 76 fd ff ff       	call   80204a <stream_drain>
+  8022d4:	89 c7                	mov    %eax,%edi
+}
+  8022d6:	89 f8                	mov    %edi,%eax
+  8022d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022db:	5b                   	pop    %ebx
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5f                   	pop    %edi
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+  8022e0:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8022e5:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8022ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ef:	eb 03                	jmp    8022f4 <fflush+0x3e>
+  8022f1:	83 c3 24             	add    $0x24,%ebx
+  8022f4:	39 f3                	cmp    %esi,%ebx
+  8022f6:	74 de                	je     8022d6 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8022f8:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8022fc:	74 f3                	je     8022f1 <fflush+0x3b>
+  8022fe:	83 ec 0c             	sub    $0xc,%esp
+  802301:	53                   	push   %ebx
+  802302:	e8 af ff ff ff       	call   8022b6 <fflush>
+  802307:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802311:	0f 48 f8             	cmovs  %eax,%edi
+  802314:	eb db                	jmp    8022f1 <fflush+0x3b>
+
+00802316 <fclose>:
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	56                   	push   %esi
+  80231a:	53                   	push   %ebx
+  80231b:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80231e:	83 ec 0c             	sub    $0xc,%esp
+  802321:	56                   	push   %esi
+  802322:	e8 8f ff ff ff       	call   8022b6 <fflush>
+  802327:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802329:	83 c4 04             	add    $0x4,%esp
+  80232c:	ff 36                	push   (%esi)
+  80232e:	e8 f9 ef ff ff       	call   80132c <close>
+  802333:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802336:	85 c0                	test   %eax,%eax
+  802338:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80233d:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802340:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802344:	75 10                	jne    802356 <fclose+0x40>
+	f->f_flags = 0;
+  802346:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80234d:	89 d8                	mov    %ebx,%eax
+  80234f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802352:	5b                   	pop    %ebx
+  802353:	5e                   	pop    %esi
+  802354:	5d                   	pop    %ebp
+  802355:	c3                   	ret
+		free(f->f_buf);
+  802356:	83 ec 0c             	sub    $0xc,%esp
+  802359:	ff 76 0c             	push   0xc(%esi)
+  80235c:	e8 54 08 00 00       	call   802bb5 <free>
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	eb e0                	jmp    802346 <fclose+0x30>
+
+00802366 <fileno>:
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	8b 00                	mov    (%eax),%eax
+}
+  80236e:	5d                   	pop    %ebp
+  80236f:	c3                   	ret
+
+00802370 <feof>:
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	8b 40 04             	mov    0x4(%eax),%eax
+  802379:	c1 e8 02             	shr    $0x2,%eax
+  80237c:	83 e0 01             	and    $0x1,%eax
+}
+  80237f:	5d                   	pop    %ebp
+  802380:	c3                   	ret
+
+00802381 <ferror>:
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802384:	8b 45 08             	mov    0x8(%ebp),%eax
+  802387:	8b 40 04             	mov    0x4(%eax),%eax
+  80238a:	c1 e8 03             	shr    $0x3,%eax
+  80238d:	83 e0 01             	and    $0x1,%eax
+}
+  802390:	5d                   	pop    %ebp
+  802391:	c3                   	ret
+
+00802392 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802392:	55                   	push   %ebp
+  802393:	89 e5                	mov    %esp,%ebp
+  802395:	53                   	push   %ebx
+  802396:	83 ec 04             	sub    $0x4,%esp
+  802399:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80239c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80239f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8023a2:	74 15                	je     8023b9 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8023a4:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8023a7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8023aa:	8d 48 01             	lea    0x1(%eax),%ecx
+  8023ad:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8023b0:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8023b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b7:	c9                   	leave
+  8023b8:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023b9:	89 d8                	mov    %ebx,%eax
+  8023bb:	e8 67 fd ff ff       	call   802127 <stream_fill>
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	75 e0                	jne    8023a4 <fgetc+0x12>
+		return EOF;
+  8023c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023c9:	eb e9                	jmp    8023b4 <fgetc+0x22>
+
+008023cb <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	57                   	push   %edi
+  8023cf:	56                   	push   %esi
+  8023d0:	53                   	push   %ebx
+  8023d1:	83 ec 1c             	sub    $0x1c,%esp
+  8023d4:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8023d7:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023df:	83 e8 01             	sub    $0x1,%eax
+  8023e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8023e5:	eb 66                	jmp    80244d <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023e7:	8b 46 14             	mov    0x14(%esi),%eax
+  8023ea:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023ed:	29 c3                	sub    %eax,%ebx
+  8023ef:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8023f2:	29 fa                	sub    %edi,%edx
+  8023f4:	39 d3                	cmp    %edx,%ebx
+  8023f6:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023f9:	83 ec 04             	sub    $0x4,%esp
+  8023fc:	53                   	push   %ebx
+  8023fd:	6a 0a                	push   $0xa
+  8023ff:	03 46 0c             	add    0xc(%esi),%eax
+  802402:	50                   	push   %eax
+  802403:	e8 46 e6 ff ff       	call   800a4e <memfind>
+  802408:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80240b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80240e:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802411:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802414:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80241c:	74 0b                	je     802429 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80241e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802421:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802424:	29 d3                	sub    %edx,%ebx
+  802426:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802429:	83 ec 04             	sub    $0x4,%esp
+  80242c:	53                   	push   %ebx
+  80242d:	01 c8                	add    %ecx,%eax
+  80242f:	50                   	push   %eax
+  802430:	89 f8                	mov    %edi,%eax
+  802432:	03 45 08             	add    0x8(%ebp),%eax
+  802435:	50                   	push   %eax
+  802436:	e8 62 e5 ff ff       	call   80099d <memmove>
+		f->f_rpos += m;
+  80243b:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80243e:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802440:	83 c4 10             	add    $0x10,%esp
+  802443:	8b 45 08             	mov    0x8(%ebp),%eax
+  802446:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80244b:	74 1f                	je     80246c <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80244d:	8d 47 01             	lea    0x1(%edi),%eax
+  802450:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802453:	73 17                	jae    80246c <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802455:	8b 46 18             	mov    0x18(%esi),%eax
+  802458:	39 46 14             	cmp    %eax,0x14(%esi)
+  80245b:	75 8a                	jne    8023e7 <fgets+0x1c>
+  80245d:	89 f0                	mov    %esi,%eax
+  80245f:	e8 c3 fc ff ff       	call   802127 <stream_fill>
+  802464:	85 c0                	test   %eax,%eax
+  802466:	0f 85 7b ff ff ff    	jne    8023e7 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80246c:	85 ff                	test   %edi,%edi
+  80246e:	74 0f                	je     80247f <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802470:	8b 45 08             	mov    0x8(%ebp),%eax
+  802473:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802477:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247a:	5b                   	pop    %ebx
+  80247b:	5e                   	pop    %esi
+  80247c:	5f                   	pop    %edi
+  80247d:	5d                   	pop    %ebp
+  80247e:	c3                   	ret
+		return 0;
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	eb f1                	jmp    802477 <fgets+0xac>
+
+00802486 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	57                   	push   %edi
+  80248a:	56                   	push   %esi
+  80248b:	53                   	push   %ebx
+  80248c:	83 ec 1c             	sub    $0x1c,%esp
+  80248f:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802492:	89 f0                	mov    %esi,%eax
+  802494:	e8 21 fc ff ff       	call   8020ba <stream_setup>
+	want = size * n;
+  802499:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80249c:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8024a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8024a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a8:	eb 43                	jmp    8024ed <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8024aa:	29 d3                	sub    %edx,%ebx
+  8024ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024af:	29 f8                	sub    %edi,%eax
+  8024b1:	39 c3                	cmp    %eax,%ebx
+  8024b3:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8024b6:	83 ec 04             	sub    $0x4,%esp
+  8024b9:	53                   	push   %ebx
+  8024ba:	03 56 0c             	add    0xc(%esi),%edx
+  8024bd:	52                   	push   %edx
+  8024be:	89 f8                	mov    %edi,%eax
+  8024c0:	03 45 08             	add    0x8(%ebp),%eax
+  8024c3:	50                   	push   %eax
+  8024c4:	e8 d4 e4 ff ff       	call   80099d <memmove>
+			f->f_rpos += m;
+  8024c9:	01 5e 14             	add    %ebx,0x14(%esi)
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	eb 1a                	jmp    8024eb <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8024d1:	83 ec 04             	sub    $0x4,%esp
+  8024d4:	53                   	push   %ebx
+  8024d5:	89 f8                	mov    %edi,%eax
+  8024d7:	03 45 08             	add    0x8(%ebp),%eax
+  8024da:	50                   	push   %eax
+  8024db:	ff 36                	push   (%esi)
+  8024dd:	e8 86 ef ff ff       	call   801468 <read>
+  8024e2:	89 c3                	mov    %eax,%ebx
+  8024e4:	83 c4 10             	add    $0x10,%esp
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	7e 36                	jle    802521 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8024eb:	01 df                	add    %ebx,%edi
+  8024ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024f0:	39 c7                	cmp    %eax,%edi
+  8024f2:	73 39                	jae    80252d <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8024f4:	8b 56 14             	mov    0x14(%esi),%edx
+  8024f7:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024fa:	39 da                	cmp    %ebx,%edx
+  8024fc:	72 ac                	jb     8024aa <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8024fe:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802501:	29 fb                	sub    %edi,%ebx
+  802503:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802506:	72 3e                	jb     802546 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802508:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80250c:	74 1f                	je     80252d <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80250e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802512:	74 bd                	je     8024d1 <fread+0x4b>
+  802514:	89 f0                	mov    %esi,%eax
+  802516:	e8 2f fb ff ff       	call   80204a <stream_drain>
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	79 b2                	jns    8024d1 <fread+0x4b>
+  80251f:	eb 0c                	jmp    80252d <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802521:	c1 fb 1f             	sar    $0x1f,%ebx
+  802524:	83 e3 04             	and    $0x4,%ebx
+  802527:	83 c3 04             	add    $0x4,%ebx
+  80252a:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80252d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802530:	85 c0                	test   %eax,%eax
+  802532:	74 0a                	je     80253e <fread+0xb8>
+  802534:	89 f8                	mov    %edi,%eax
+  802536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253b:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80253e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802541:	5b                   	pop    %ebx
+  802542:	5e                   	pop    %esi
+  802543:	5f                   	pop    %edi
+  802544:	5d                   	pop    %ebp
+  802545:	c3                   	ret
+		} else if (!stream_fill(f))
+  802546:	89 f0                	mov    %esi,%eax
+  802548:	e8 da fb ff ff       	call   802127 <stream_fill>
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	74 dc                	je     80252d <fread+0xa7>
+			m = 0;
+  802551:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802556:	eb 93                	jmp    8024eb <fread+0x65>
+
+00802558 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	57                   	push   %edi
+  80255c:	56                   	push   %esi
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 1c             	sub    $0x1c,%esp
+  802561:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802564:	8b 43 04             	mov    0x4(%ebx),%eax
+  802567:	a8 02                	test   $0x2,%al
+  802569:	75 13                	jne    80257e <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80256b:	83 c8 08             	or     $0x8,%eax
+  80256e:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802571:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802579:	5b                   	pop    %ebx
+  80257a:	5e                   	pop    %esi
+  80257b:	5f                   	pop    %edi
+  80257c:	5d                   	pop    %ebp
+  80257d:	c3                   	ret
+	stream_setup(f);
+  80257e:	89 d8                	mov    %ebx,%eax
+  802580:	e8 35 fb ff ff       	call   8020ba <stream_setup>
+	want = size * n;
+  802585:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802588:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80258c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80258f:	89 d8                	mov    %ebx,%eax
+  802591:	e8 41 fa ff ff       	call   801fd7 <stream_unread>
+	for (done = 0; done < want; ) {
+  802596:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80259b:	84 c0                	test   %al,%al
+  80259d:	75 7b                	jne    80261a <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80259f:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025a7:	39 fe                	cmp    %edi,%esi
+  8025a9:	73 24                	jae    8025cf <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	89 f8                	mov    %edi,%eax
+  8025b0:	29 f0                	sub    %esi,%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	89 f0                	mov    %esi,%eax
+  8025b5:	03 45 08             	add    0x8(%ebp),%eax
+  8025b8:	50                   	push   %eax
+  8025b9:	ff 33                	push   (%ebx)
+  8025bb:	e8 a0 ef ff ff       	call   801560 <write>
+  8025c0:	83 c4 10             	add    $0x10,%esp
+  8025c3:	85 c0                	test   %eax,%eax
+  8025c5:	7e 04                	jle    8025cb <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8025c7:	01 c6                	add    %eax,%esi
+  8025c9:	eb dc                	jmp    8025a7 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8025cb:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8025cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	74 a0                	je     802576 <fwrite+0x1e>
+  8025d6:	89 f0                	mov    %esi,%eax
+  8025d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025dd:	f7 75 0c             	divl   0xc(%ebp)
+  8025e0:	eb 94                	jmp    802576 <fwrite+0x1e>
+			done += r;
+  8025e2:	01 c7                	add    %eax,%edi
+			continue;
+  8025e4:	eb 34                	jmp    80261a <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8025e6:	8b 73 10             	mov    0x10(%ebx),%esi
+  8025e9:	29 c6                	sub    %eax,%esi
+  8025eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ee:	29 fa                	sub    %edi,%edx
+  8025f0:	39 d6                	cmp    %edx,%esi
+  8025f2:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8025f5:	83 ec 04             	sub    $0x4,%esp
+  8025f8:	56                   	push   %esi
+  8025f9:	89 fa                	mov    %edi,%edx
+  8025fb:	03 55 08             	add    0x8(%ebp),%edx
+  8025fe:	52                   	push   %edx
+  8025ff:	03 43 0c             	add    0xc(%ebx),%eax
+  802602:	50                   	push   %eax
+  802603:	e8 95 e3 ff ff       	call   80099d <memmove>
+		f->f_wend += m;
+  802608:	89 f0                	mov    %esi,%eax
+  80260a:	03 43 1c             	add    0x1c(%ebx),%eax
+  80260d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802610:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802612:	83 c4 10             	add    $0x10,%esp
+  802615:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802618:	74 5b                	je     802675 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80261a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80261d:	39 c7                	cmp    %eax,%edi
+  80261f:	73 2d                	jae    80264e <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802621:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802624:	85 c0                	test   %eax,%eax
+  802626:	75 be                	jne    8025e6 <fwrite+0x8e>
+  802628:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80262b:	29 fa                	sub    %edi,%edx
+  80262d:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802630:	72 b4                	jb     8025e6 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802632:	83 ec 04             	sub    $0x4,%esp
+  802635:	52                   	push   %edx
+  802636:	89 f8                	mov    %edi,%eax
+  802638:	03 45 08             	add    0x8(%ebp),%eax
+  80263b:	50                   	push   %eax
+  80263c:	ff 33                	push   (%ebx)
+  80263e:	e8 1d ef ff ff       	call   801560 <write>
+  802643:	83 c4 10             	add    $0x10,%esp
+  802646:	85 c0                	test   %eax,%eax
+  802648:	7f 98                	jg     8025e2 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80264a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80264e:	8b 43 08             	mov    0x8(%ebx),%eax
+  802651:	83 f8 03             	cmp    $0x3,%eax
+  802654:	74 48                	je     80269e <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802656:	83 f8 02             	cmp    $0x2,%eax
+  802659:	74 27                	je     802682 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80265b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80265e:	85 c0                	test   %eax,%eax
+  802660:	0f 84 10 ff ff ff    	je     802576 <fwrite+0x1e>
+  802666:	89 f8                	mov    %edi,%eax
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266d:	f7 75 0c             	divl   0xc(%ebp)
+  802670:	e9 01 ff ff ff       	jmp    802576 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802675:	89 d8                	mov    %ebx,%eax
+  802677:	e8 ce f9 ff ff       	call   80204a <stream_drain>
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	79 9a                	jns    80261a <fwrite+0xc2>
+  802680:	eb cc                	jmp    80264e <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802682:	83 ec 04             	sub    $0x4,%esp
+  802685:	57                   	push   %edi
+  802686:	6a 0a                	push   $0xa
+  802688:	ff 75 08             	push   0x8(%ebp)
+  80268b:	e8 be e3 ff ff       	call   800a4e <memfind>
+  802690:	89 c2                	mov    %eax,%edx
+  802692:	89 f8                	mov    %edi,%eax
+  802694:	03 45 08             	add    0x8(%ebp),%eax
+  802697:	83 c4 10             	add    $0x10,%esp
+  80269a:	39 c2                	cmp    %eax,%edx
+  80269c:	74 bd                	je     80265b <fwrite+0x103>
+		stream_drain(f);
+  80269e:	89 d8                	mov    %ebx,%eax
+  8026a0:	e8 a5 f9 ff ff       	call   80204a <stream_drain>
+  8026a5:	eb b4                	jmp    80265b <fwrite+0x103>
+
+008026a7 <fputc>:
+{
+  8026a7:	55                   	push   %ebp
+  8026a8:	89 e5                	mov    %esp,%ebp
+  8026aa:	53                   	push   %ebx
+  8026ab:	83 ec 14             	sub    $0x14,%esp
+  8026ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8026b1:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8026b4:	ff 75 0c             	push   0xc(%ebp)
+  8026b7:	6a 01                	push   $0x1
+  8026b9:	6a 01                	push   $0x1
+  8026bb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026be:	50                   	push   %eax
+  8026bf:	e8 94 fe ff ff       	call   802558 <fwrite>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	0f b6 db             	movzbl %bl,%ebx
+  8026ca:	83 f8 01             	cmp    $0x1,%eax
+  8026cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026d2:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8026d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d8:	c9                   	leave
+  8026d9:	c3                   	ret
+
+008026da <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026da:	55                   	push   %ebp
+  8026db:	89 e5                	mov    %esp,%ebp
+  8026dd:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026e0:	ff 75 0c             	push   0xc(%ebp)
+  8026e3:	ff 75 08             	push   0x8(%ebp)
+  8026e6:	e8 bc ff ff ff       	call   8026a7 <fputc>
+}
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+008026f0 <fputs>:
+{
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	56                   	push   %esi
+  8026f4:	53                   	push   %ebx
+  8026f5:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8026f8:	83 ec 0c             	sub    $0xc,%esp
+  8026fb:	56                   	push   %esi
+  8026fc:	e8 db e0 ff ff       	call   8007dc <strlen>
+  802701:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802703:	ff 75 0c             	push   0xc(%ebp)
+  802706:	50                   	push   %eax
+  802707:	6a 01                	push   $0x1
+  802709:	56                   	push   %esi
+  80270a:	e8 49 fe ff ff       	call   802558 <fwrite>
+  80270f:	83 c4 20             	add    $0x20,%esp
+  802712:	39 d8                	cmp    %ebx,%eax
+  802714:	0f 95 c0             	setne  %al
+  802717:	0f b6 c0             	movzbl %al,%eax
+  80271a:	f7 d8                	neg    %eax
+}
+  80271c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80271f:	5b                   	pop    %ebx
+  802720:	5e                   	pop    %esi
+  802721:	5d                   	pop    %ebp
+  802722:	c3                   	ret
+
+00802723 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	53                   	push   %ebx
+  802727:	83 ec 04             	sub    $0x4,%esp
+  80272a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80272d:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802730:	50                   	push   %eax
+  802731:	ff 75 0c             	push   0xc(%ebp)
+  802734:	53                   	push   %ebx
+  802735:	68 da 26 80 00       	push   $0x8026da
+  80273a:	e8 eb db ff ff       	call   80032a <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80273f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802742:	c1 e0 1c             	shl    $0x1c,%eax
+  802745:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274b:	c9                   	leave
+  80274c:	c3                   	ret
+
+0080274d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80274d:	55                   	push   %ebp
+  80274e:	89 e5                	mov    %esp,%ebp
+  802750:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802753:	68 58 4c 80 00       	push   $0x804c58
+  802758:	ff 75 0c             	push   0xc(%ebp)
+  80275b:	e8 b7 e0 ff ff       	call   800817 <strcpy>
+	return 0;
+}
+  802760:	b8 00 00 00 00       	mov    $0x0,%eax
+  802765:	c9                   	leave
+  802766:	c3                   	ret
+
+00802767 <devsock_close>:
+{
+  802767:	55                   	push   %ebp
+  802768:	89 e5                	mov    %esp,%ebp
+  80276a:	53                   	push   %ebx
+  80276b:	83 ec 10             	sub    $0x10,%esp
+  80276e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802771:	53                   	push   %ebx
+  802772:	e8 23 1d 00 00       	call   80449a <pageref>
+  802777:	89 c2                	mov    %eax,%edx
+  802779:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802781:	83 fa 01             	cmp    $0x1,%edx
+  802784:	74 05                	je     80278b <devsock_close+0x24>
+}
+  802786:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	ff 73 0c             	push   0xc(%ebx)
+  802791:	e8 b7 02 00 00       	call   802a4d <nsipc_close>
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	eb eb                	jmp    802786 <devsock_close+0x1f>
+
+0080279b <devsock_write>:
+{
+  80279b:	55                   	push   %ebp
+  80279c:	89 e5                	mov    %esp,%ebp
+  80279e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	ff 75 10             	push   0x10(%ebp)
+  8027a6:	ff 75 0c             	push   0xc(%ebp)
+  8027a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ac:	ff 70 0c             	push   0xc(%eax)
+  8027af:	e8 79 03 00 00       	call   802b2d <nsipc_send>
+}
+  8027b4:	c9                   	leave
+  8027b5:	c3                   	ret
+
+008027b6 <devsock_read>:
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027bc:	6a 00                	push   $0x0
+  8027be:	ff 75 10             	push   0x10(%ebp)
+  8027c1:	ff 75 0c             	push   0xc(%ebp)
+  8027c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c7:	ff 70 0c             	push   0xc(%eax)
+  8027ca:	e8 ef 02 00 00       	call   802abe <nsipc_recv>
+}
+  8027cf:	c9                   	leave
+  8027d0:	c3                   	ret
+
+008027d1 <fd2sockid>:
+{
+  8027d1:	55                   	push   %ebp
+  8027d2:	89 e5                	mov    %esp,%ebp
+  8027d4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027d7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027da:	52                   	push   %edx
+  8027db:	50                   	push   %eax
+  8027dc:	e8 f7 e9 ff ff       	call   8011d8 <fd_lookup>
+  8027e1:	83 c4 10             	add    $0x10,%esp
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	78 10                	js     8027f8 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027eb:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8027f1:	39 08                	cmp    %ecx,(%eax)
+  8027f3:	75 05                	jne    8027fa <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027f5:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027f8:	c9                   	leave
+  8027f9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027ff:	eb f7                	jmp    8027f8 <fd2sockid+0x27>
+
+00802801 <alloc_sockfd>:
+{
+  802801:	55                   	push   %ebp
+  802802:	89 e5                	mov    %esp,%ebp
+  802804:	56                   	push   %esi
+  802805:	53                   	push   %ebx
+  802806:	83 ec 1c             	sub    $0x1c,%esp
+  802809:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80280b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280e:	50                   	push   %eax
+  80280f:	e8 6e e9 ff ff       	call   801182 <fd_alloc>
+  802814:	89 c3                	mov    %eax,%ebx
+  802816:	83 c4 10             	add    $0x10,%esp
+  802819:	85 c0                	test   %eax,%eax
+  80281b:	78 43                	js     802860 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80281d:	83 ec 04             	sub    $0x4,%esp
+  802820:	68 07 04 00 00       	push   $0x407
+  802825:	ff 75 f4             	push   -0xc(%ebp)
+  802828:	6a 00                	push   $0x0
+  80282a:	e8 26 e4 ff ff       	call   800c55 <sys_page_alloc>
+  80282f:	89 c3                	mov    %eax,%ebx
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	85 c0                	test   %eax,%eax
+  802836:	78 28                	js     802860 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80283b:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802841:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802846:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80284d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802850:	83 ec 0c             	sub    $0xc,%esp
+  802853:	50                   	push   %eax
+  802854:	e8 02 e9 ff ff       	call   80115b <fd2num>
+  802859:	89 c3                	mov    %eax,%ebx
+  80285b:	83 c4 10             	add    $0x10,%esp
+  80285e:	eb 0c                	jmp    80286c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802860:	83 ec 0c             	sub    $0xc,%esp
+  802863:	56                   	push   %esi
+  802864:	e8 e4 01 00 00       	call   802a4d <nsipc_close>
+		return r;
+  802869:	83 c4 10             	add    $0x10,%esp
+}
+  80286c:	89 d8                	mov    %ebx,%eax
+  80286e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802871:	5b                   	pop    %ebx
+  802872:	5e                   	pop    %esi
+  802873:	5d                   	pop    %ebp
+  802874:	c3                   	ret
+
+00802875 <accept>:
+{
+  802875:	55                   	push   %ebp
+  802876:	89 e5                	mov    %esp,%ebp
+  802878:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80287b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287e:	e8 4e ff ff ff       	call   8027d1 <fd2sockid>
+  802883:	85 c0                	test   %eax,%eax
+  802885:	78 1b                	js     8028a2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802887:	83 ec 04             	sub    $0x4,%esp
+  80288a:	ff 75 10             	push   0x10(%ebp)
+  80288d:	ff 75 0c             	push   0xc(%ebp)
+  802890:	50                   	push   %eax
+  802891:	e8 0e 01 00 00       	call   8029a4 <nsipc_accept>
+  802896:	83 c4 10             	add    $0x10,%esp
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	78 05                	js     8028a2 <accept+0x2d>
+	return alloc_sockfd(r);
+  80289d:	e8 5f ff ff ff       	call   802801 <alloc_sockfd>
+}
+  8028a2:	c9                   	leave
+  8028a3:	c3                   	ret
+
+008028a4 <bind>:
+{
+  8028a4:	55                   	push   %ebp
+  8028a5:	89 e5                	mov    %esp,%ebp
+  8028a7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ad:	e8 1f ff ff ff       	call   8027d1 <fd2sockid>
+  8028b2:	85 c0                	test   %eax,%eax
+  8028b4:	78 12                	js     8028c8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028b6:	83 ec 04             	sub    $0x4,%esp
+  8028b9:	ff 75 10             	push   0x10(%ebp)
+  8028bc:	ff 75 0c             	push   0xc(%ebp)
+  8028bf:	50                   	push   %eax
+  8028c0:	e8 31 01 00 00       	call   8029f6 <nsipc_bind>
+  8028c5:	83 c4 10             	add    $0x10,%esp
+}
+  8028c8:	c9                   	leave
+  8028c9:	c3                   	ret
+
+008028ca <shutdown>:
+{
+  8028ca:	55                   	push   %ebp
+  8028cb:	89 e5                	mov    %esp,%ebp
+  8028cd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d3:	e8 f9 fe ff ff       	call   8027d1 <fd2sockid>
+  8028d8:	85 c0                	test   %eax,%eax
+  8028da:	78 0f                	js     8028eb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028dc:	83 ec 08             	sub    $0x8,%esp
+  8028df:	ff 75 0c             	push   0xc(%ebp)
+  8028e2:	50                   	push   %eax
+  8028e3:	e8 43 01 00 00       	call   802a2b <nsipc_shutdown>
+  8028e8:	83 c4 10             	add    $0x10,%esp
+}
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+
+008028ed <connect>:
+{
+  8028ed:	55                   	push   %ebp
+  8028ee:	89 e5                	mov    %esp,%ebp
+  8028f0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f6:	e8 d6 fe ff ff       	call   8027d1 <fd2sockid>
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	78 12                	js     802911 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028ff:	83 ec 04             	sub    $0x4,%esp
+  802902:	ff 75 10             	push   0x10(%ebp)
+  802905:	ff 75 0c             	push   0xc(%ebp)
+  802908:	50                   	push   %eax
+  802909:	e8 59 01 00 00       	call   802a67 <nsipc_connect>
+  80290e:	83 c4 10             	add    $0x10,%esp
+}
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+
+00802913 <listen>:
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291c:	e8 b0 fe ff ff       	call   8027d1 <fd2sockid>
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 0f                	js     802934 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802925:	83 ec 08             	sub    $0x8,%esp
+  802928:	ff 75 0c             	push   0xc(%ebp)
+  80292b:	50                   	push   %eax
+  80292c:	e8 6b 01 00 00       	call   802a9c <nsipc_listen>
+  802931:	83 c4 10             	add    $0x10,%esp
+}
+  802934:	c9                   	leave
+  802935:	c3                   	ret
+
+00802936 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80293c:	ff 75 10             	push   0x10(%ebp)
+  80293f:	ff 75 0c             	push   0xc(%ebp)
+  802942:	ff 75 08             	push   0x8(%ebp)
+  802945:	e8 41 02 00 00       	call   802b8b <nsipc_socket>
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 05                	js     802956 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802951:	e8 ab fe ff ff       	call   802801 <alloc_sockfd>
+}
+  802956:	c9                   	leave
+  802957:	c3                   	ret
+
+00802958 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	53                   	push   %ebx
+  80295c:	83 ec 04             	sub    $0x4,%esp
+  80295f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802961:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802968:	74 26                	je     802990 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80296a:	6a 07                	push   $0x7
+  80296c:	68 00 80 80 00       	push   $0x808000
+  802971:	53                   	push   %ebx
+  802972:	ff 35 08 60 80 00    	push   0x806008
+  802978:	e8 88 1a 00 00       	call   804405 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80297d:	83 c4 0c             	add    $0xc,%esp
+  802980:	6a 00                	push   $0x0
+  802982:	6a 00                	push   $0x0
+  802984:	6a 00                	push   $0x0
+  802986:	e8 84 19 00 00       	call   80430f <ipc_recv>
+}
+  80298b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802990:	83 ec 0c             	sub    $0xc,%esp
+  802993:	6a 02                	push   $0x2
+  802995:	e8 c1 1a 00 00       	call   80445b <ipc_find_env>
+  80299a:	a3 08 60 80 00       	mov    %eax,0x806008
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	eb c6                	jmp    80296a <nsipc+0x12>
+
+008029a4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029a4:	55                   	push   %ebp
+  8029a5:	89 e5                	mov    %esp,%ebp
+  8029a7:	56                   	push   %esi
+  8029a8:	53                   	push   %ebx
+  8029a9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029af:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8029b4:	8b 06                	mov    (%esi),%eax
+  8029b6:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029c0:	e8 93 ff ff ff       	call   802958 <nsipc>
+  8029c5:	89 c3                	mov    %eax,%ebx
+  8029c7:	85 c0                	test   %eax,%eax
+  8029c9:	79 09                	jns    8029d4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029cb:	89 d8                	mov    %ebx,%eax
+  8029cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029d0:	5b                   	pop    %ebx
+  8029d1:	5e                   	pop    %esi
+  8029d2:	5d                   	pop    %ebp
+  8029d3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029d4:	83 ec 04             	sub    $0x4,%esp
+  8029d7:	ff 35 10 80 80 00    	push   0x808010
+  8029dd:	68 00 80 80 00       	push   $0x808000
+  8029e2:	ff 75 0c             	push   0xc(%ebp)
+  8029e5:	e8 b3 df ff ff       	call   80099d <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029ea:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029ef:	89 06                	mov    %eax,(%esi)
+  8029f1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029f4:	eb d5                	jmp    8029cb <nsipc_accept+0x27>
+
+008029f6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029f6:	55                   	push   %ebp
+  8029f7:	89 e5                	mov    %esp,%ebp
+  8029f9:	53                   	push   %ebx
+  8029fa:	83 ec 08             	sub    $0x8,%esp
+  8029fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a03:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a08:	53                   	push   %ebx
+  802a09:	ff 75 0c             	push   0xc(%ebp)
+  802a0c:	68 04 80 80 00       	push   $0x808004
+  802a11:	e8 87 df ff ff       	call   80099d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a16:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a21:	e8 32 ff ff ff       	call   802958 <nsipc>
+}
+  802a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a29:	c9                   	leave
+  802a2a:	c3                   	ret
+
+00802a2b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a2b:	55                   	push   %ebp
+  802a2c:	89 e5                	mov    %esp,%ebp
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a34:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a3c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a41:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a46:	e8 0d ff ff ff       	call   802958 <nsipc>
+}
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+
+00802a4d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a56:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a5b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a60:	e8 f3 fe ff ff       	call   802958 <nsipc>
+}
+  802a65:	c9                   	leave
+  802a66:	c3                   	ret
+
+00802a67 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a67:	55                   	push   %ebp
+  802a68:	89 e5                	mov    %esp,%ebp
+  802a6a:	53                   	push   %ebx
+  802a6b:	83 ec 08             	sub    $0x8,%esp
+  802a6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a74:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a79:	53                   	push   %ebx
+  802a7a:	ff 75 0c             	push   0xc(%ebp)
+  802a7d:	68 04 80 80 00       	push   $0x808004
+  802a82:	e8 16 df ff ff       	call   80099d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a87:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a8d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a92:	e8 c1 fe ff ff       	call   802958 <nsipc>
+}
+  802a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+
+00802a9c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a9c:	55                   	push   %ebp
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802aaa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aad:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ab2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ab7:	e8 9c fe ff ff       	call   802958 <nsipc>
+}
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+00802abe <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802abe:	55                   	push   %ebp
+  802abf:	89 e5                	mov    %esp,%ebp
+  802ac1:	56                   	push   %esi
+  802ac2:	53                   	push   %ebx
+  802ac3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802ace:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802ad4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ad7:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802adc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ae1:	e8 72 fe ff ff       	call   802958 <nsipc>
+  802ae6:	89 c3                	mov    %eax,%ebx
+  802ae8:	85 c0                	test   %eax,%eax
+  802aea:	78 22                	js     802b0e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802aec:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802af1:	39 c6                	cmp    %eax,%esi
+  802af3:	0f 4e c6             	cmovle %esi,%eax
+  802af6:	39 c3                	cmp    %eax,%ebx
+  802af8:	7f 1d                	jg     802b17 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802afa:	83 ec 04             	sub    $0x4,%esp
+  802afd:	53                   	push   %ebx
+  802afe:	68 00 80 80 00       	push   $0x808000
+  802b03:	ff 75 0c             	push   0xc(%ebp)
+  802b06:	e8 92 de ff ff       	call   80099d <memmove>
+  802b0b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b0e:	89 d8                	mov    %ebx,%eax
+  802b10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b13:	5b                   	pop    %ebx
+  802b14:	5e                   	pop    %esi
+  802b15:	5d                   	pop    %ebp
+  802b16:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b17:	68 64 4c 80 00       	push   $0x804c64
+  802b1c:	68 1d 4c 80 00       	push   $0x804c1d
+  802b21:	6a 62                	push   $0x62
+  802b23:	68 79 4c 80 00       	push   $0x804c79
+  802b28:	e8 2b d6 ff ff       	call   800158 <_panic>
+
+00802b2d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	53                   	push   %ebx
+  802b31:	83 ec 04             	sub    $0x4,%esp
+  802b34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b3f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b45:	7f 2e                	jg     802b75 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b47:	83 ec 04             	sub    $0x4,%esp
+  802b4a:	53                   	push   %ebx
+  802b4b:	ff 75 0c             	push   0xc(%ebp)
+  802b4e:	68 0c 80 80 00       	push   $0x80800c
+  802b53:	e8 45 de ff ff       	call   80099d <memmove>
+	nsipcbuf.send.req_size = size;
+  802b58:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b61:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b66:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b6b:	e8 e8 fd ff ff       	call   802958 <nsipc>
+}
+  802b70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b73:	c9                   	leave
+  802b74:	c3                   	ret
+	assert(size < 1600);
+  802b75:	68 85 4c 80 00       	push   $0x804c85
+  802b7a:	68 1d 4c 80 00       	push   $0x804c1d
+  802b7f:	6a 6d                	push   $0x6d
+  802b81:	68 79 4c 80 00       	push   $0x804c79
+  802b86:	e8 cd d5 ff ff       	call   800158 <_panic>
+
+00802b8b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b94:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9c:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ba1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ba4:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802ba9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bae:	e8 a5 fd ff ff       	call   802958 <nsipc>
+}
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+00802bb5 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	53                   	push   %ebx
+  802bb9:	83 ec 10             	sub    $0x10,%esp
+  802bbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802bbf:	68 0c 60 80 00       	push   $0x80600c
+  802bc4:	e8 50 07 00 00       	call   803319 <mutex_lock>
+	if (v == 0)
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	85 db                	test   %ebx,%ebx
+  802bce:	0f 84 85 00 00 00    	je     802c59 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bd4:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bda:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bdf:	77 51                	ja     802c32 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802be1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802be7:	89 d8                	mov    %ebx,%eax
+  802be9:	c1 e8 0c             	shr    $0xc,%eax
+  802bec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802bf3:	f6 c4 02             	test   $0x2,%ah
+  802bf6:	74 50                	je     802c48 <free+0x93>
+		sys_page_unmap(0, c);
+  802bf8:	83 ec 08             	sub    $0x8,%esp
+  802bfb:	53                   	push   %ebx
+  802bfc:	6a 00                	push   $0x0
+  802bfe:	e8 eb e0 ff ff       	call   800cee <sys_page_unmap>
+		c += PGSIZE;
+  802c03:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802c09:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c0f:	83 c4 10             	add    $0x10,%esp
+  802c12:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c17:	76 ce                	jbe    802be7 <free+0x32>
+  802c19:	68 cf 4c 80 00       	push   $0x804ccf
+  802c1e:	68 1d 4c 80 00       	push   $0x804c1d
+  802c23:	68 82 00 00 00       	push   $0x82
+  802c28:	68 c2 4c 80 00       	push   $0x804cc2
+  802c2d:	e8 26 d5 ff ff       	call   800158 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c32:	68 94 4c 80 00       	push   $0x804c94
+  802c37:	68 1d 4c 80 00       	push   $0x804c1d
+  802c3c:	6a 7b                	push   $0x7b
+  802c3e:	68 c2 4c 80 00       	push   $0x804cc2
+  802c43:	e8 10 d5 ff ff       	call   800158 <_panic>
+	if (--(*ref) == 0)
+  802c48:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c4e:	83 e8 01             	sub    $0x1,%eax
+  802c51:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c57:	74 15                	je     802c6e <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802c59:	83 ec 0c             	sub    $0xc,%esp
+  802c5c:	68 0c 60 80 00       	push   $0x80600c
+  802c61:	e8 20 07 00 00       	call   803386 <mutex_unlock>
+}
+  802c66:	83 c4 10             	add    $0x10,%esp
+  802c69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c6e:	83 ec 08             	sub    $0x8,%esp
+  802c71:	53                   	push   %ebx
+  802c72:	6a 00                	push   $0x0
+  802c74:	e8 75 e0 ff ff       	call   800cee <sys_page_unmap>
+  802c79:	83 c4 10             	add    $0x10,%esp
+  802c7c:	eb db                	jmp    802c59 <free+0xa4>
+
+00802c7e <malloc>:
+{
+  802c7e:	55                   	push   %ebp
+  802c7f:	89 e5                	mov    %esp,%ebp
+  802c81:	57                   	push   %edi
+  802c82:	56                   	push   %esi
+  802c83:	53                   	push   %ebx
+  802c84:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c87:	68 0c 60 80 00       	push   $0x80600c
+  802c8c:	e8 88 06 00 00       	call   803319 <mutex_lock>
+	if (mptr == 0)
+  802c91:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c97:	83 c4 10             	add    $0x10,%esp
+  802c9a:	85 ff                	test   %edi,%edi
+  802c9c:	74 6c                	je     802d0a <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca1:	83 c0 03             	add    $0x3,%eax
+  802ca4:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ca7:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ca9:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802cae:	0f 87 64 01 00 00    	ja     802e18 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802cb4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802cba:	74 30                	je     802cec <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802cbc:	89 f9                	mov    %edi,%ecx
+  802cbe:	c1 e9 0c             	shr    $0xc,%ecx
+  802cc1:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802cc5:	c1 e8 0c             	shr    $0xc,%eax
+  802cc8:	39 c1                	cmp    %eax,%ecx
+  802cca:	74 5f                	je     802d2b <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802ccc:	83 ec 0c             	sub    $0xc,%esp
+  802ccf:	57                   	push   %edi
+  802cd0:	e8 e0 fe ff ff       	call   802bb5 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802cd5:	a1 10 60 80 00       	mov    0x806010,%eax
+  802cda:	05 00 10 00 00       	add    $0x1000,%eax
+  802cdf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ce4:	a3 10 60 80 00       	mov    %eax,0x806010
+  802ce9:	83 c4 10             	add    $0x10,%esp
+  802cec:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802cf2:	ba 02 00 00 00       	mov    $0x2,%edx
+  802cf7:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802cfb:	8d 7e 04             	lea    0x4(%esi),%edi
+  802cfe:	89 cb                	mov    %ecx,%ebx
+  802d00:	01 f9                	add    %edi,%ecx
+  802d02:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d05:	e9 8b 00 00 00       	jmp    802d95 <malloc+0x117>
+		mptr = mbegin;
+  802d0a:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d11:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d17:	83 c0 03             	add    $0x3,%eax
+  802d1a:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d1d:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d1f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d24:	76 c6                	jbe    802cec <malloc+0x6e>
+  802d26:	e9 d6 00 00 00       	jmp    802e01 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802d2b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802d36:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802d3a:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d3d:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802d42:	e9 ba 00 00 00       	jmp    802e01 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d47:	05 00 10 00 00       	add    $0x1000,%eax
+  802d4c:	39 c8                	cmp    %ecx,%eax
+  802d4e:	0f 83 cb 00 00 00    	jae    802e1f <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802d54:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d59:	77 22                	ja     802d7d <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d5b:	89 c2                	mov    %eax,%edx
+  802d5d:	c1 ea 16             	shr    $0x16,%edx
+  802d60:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d67:	f6 c2 01             	test   $0x1,%dl
+  802d6a:	74 db                	je     802d47 <malloc+0xc9>
+  802d6c:	89 c2                	mov    %eax,%edx
+  802d6e:	c1 ea 0c             	shr    $0xc,%edx
+  802d71:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d78:	f6 c2 01             	test   $0x1,%dl
+  802d7b:	74 ca                	je     802d47 <malloc+0xc9>
+		if (mptr == mend) {
+  802d7d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d83:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d89:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d8d:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d93:	74 04                	je     802d99 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d95:	89 d8                	mov    %ebx,%eax
+  802d97:	eb b3                	jmp    802d4c <malloc+0xce>
+  802d99:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d9c:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802da1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802da5:	83 ea 01             	sub    $0x1,%edx
+  802da8:	0f 85 50 ff ff ff    	jne    802cfe <malloc+0x80>
+  802dae:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802db5:	00 00 08 
+				return 0;	/* out of address space */
+  802db8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dbd:	eb 42                	jmp    802e01 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802dbf:	85 db                	test   %ebx,%ebx
+  802dc1:	78 1e                	js     802de1 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802dc3:	83 ec 08             	sub    $0x8,%esp
+  802dc6:	89 d8                	mov    %ebx,%eax
+  802dc8:	03 05 10 60 80 00    	add    0x806010,%eax
+  802dce:	50                   	push   %eax
+  802dcf:	6a 00                	push   $0x0
+  802dd1:	e8 18 df ff ff       	call   800cee <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802dd6:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	eb de                	jmp    802dbf <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802de1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de6:	eb 19                	jmp    802e01 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802de8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802deb:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802df1:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802df8:	00 
+	mptr += n;
+  802df9:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802dfc:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	68 0c 60 80 00       	push   $0x80600c
+  802e09:	e8 78 05 00 00       	call   803386 <mutex_unlock>
+}
+  802e0e:	89 f8                	mov    %edi,%eax
+  802e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e13:	5b                   	pop    %ebx
+  802e14:	5e                   	pop    %esi
+  802e15:	5f                   	pop    %edi
+  802e16:	5d                   	pop    %ebp
+  802e17:	c3                   	ret
+		return 0;
+  802e18:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1d:	eb e2                	jmp    802e01 <malloc+0x183>
+  802e1f:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e23:	74 06                	je     802e2b <malloc+0x1ad>
+  802e25:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e30:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e33:	39 fb                	cmp    %edi,%ebx
+  802e35:	73 b1                	jae    802de8 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e37:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e3d:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e40:	39 fe                	cmp    %edi,%esi
+  802e42:	0f 92 c0             	setb   %al
+  802e45:	0f b6 c0             	movzbl %al,%eax
+  802e48:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e4b:	83 c8 07             	or     $0x7,%eax
+  802e4e:	50                   	push   %eax
+  802e4f:	89 d8                	mov    %ebx,%eax
+  802e51:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e57:	50                   	push   %eax
+  802e58:	6a 00                	push   $0x0
+  802e5a:	e8 f6 dd ff ff       	call   800c55 <sys_page_alloc>
+  802e5f:	83 c4 10             	add    $0x10,%esp
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	0f 88 55 ff ff ff    	js     802dbf <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e6a:	89 f3                	mov    %esi,%ebx
+  802e6c:	eb c5                	jmp    802e33 <malloc+0x1b5>
+
+00802e6e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e6e:	55                   	push   %ebp
+  802e6f:	89 e5                	mov    %esp,%ebp
+  802e71:	56                   	push   %esi
+  802e72:	53                   	push   %ebx
+  802e73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e76:	83 ec 0c             	sub    $0xc,%esp
+  802e79:	ff 75 08             	push   0x8(%ebp)
+  802e7c:	e8 ea e2 ff ff       	call   80116b <fd2data>
+  802e81:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e83:	83 c4 08             	add    $0x8,%esp
+  802e86:	68 e7 4c 80 00       	push   $0x804ce7
+  802e8b:	53                   	push   %ebx
+  802e8c:	e8 86 d9 ff ff       	call   800817 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e91:	8b 46 04             	mov    0x4(%esi),%eax
+  802e94:	2b 06                	sub    (%esi),%eax
+  802e96:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e9c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ea3:	00 00 00 
+	stat->st_dev = &devpipe;
+  802ea6:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802ead:	52 80 00 
+	return 0;
+}
+  802eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eb8:	5b                   	pop    %ebx
+  802eb9:	5e                   	pop    %esi
+  802eba:	5d                   	pop    %ebp
+  802ebb:	c3                   	ret
+
+00802ebc <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802ebc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec1:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802ec5:	85 c9                	test   %ecx,%ecx
+  802ec7:	75 01                	jne    802eca <pipewake+0xe>
+  802ec9:	c3                   	ret
+{
+  802eca:	55                   	push   %ebp
+  802ecb:	89 e5                	mov    %esp,%ebp
+  802ecd:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802ed0:	68 00 04 00 00       	push   $0x400
+  802ed5:	52                   	push   %edx
+  802ed6:	e8 be e0 ff ff       	call   800f99 <sys_futex_wake>
+  802edb:	83 c4 10             	add    $0x10,%esp
+}
+  802ede:	c9                   	leave
+  802edf:	c3                   	ret
+
+00802ee0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ee0:	55                   	push   %ebp
+  802ee1:	89 e5                	mov    %esp,%ebp
+  802ee3:	56                   	push   %esi
+  802ee4:	53                   	push   %ebx
+  802ee5:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ee8:	83 ec 0c             	sub    $0xc,%esp
+  802eeb:	56                   	push   %esi
+  802eec:	e8 7a e2 ff ff       	call   80116b <fd2data>
+  802ef1:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802ef3:	83 c4 08             	add    $0x8,%esp
+  802ef6:	56                   	push   %esi
+  802ef7:	6a 00                	push   $0x0
+  802ef9:	e8 f0 dd ff ff       	call   800cee <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802efe:	8d 53 04             	lea    0x4(%ebx),%edx
+  802f01:	8d 43 08             	lea    0x8(%ebx),%eax
+  802f04:	e8 b3 ff ff ff       	call   802ebc <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802f09:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802f0c:	89 da                	mov    %ebx,%edx
+  802f0e:	e8 a9 ff ff ff       	call   802ebc <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802f13:	89 34 24             	mov    %esi,(%esp)
+  802f16:	e8 50 e2 ff ff       	call   80116b <fd2data>
+  802f1b:	83 c4 08             	add    $0x8,%esp
+  802f1e:	50                   	push   %eax
+  802f1f:	6a 00                	push   $0x0
+  802f21:	e8 c8 dd ff ff       	call   800cee <sys_page_unmap>
+}
+  802f26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f29:	5b                   	pop    %ebx
+  802f2a:	5e                   	pop    %esi
+  802f2b:	5d                   	pop    %ebp
+  802f2c:	c3                   	ret
+
+00802f2d <_pipeisclosed>:
+{
+  802f2d:	55                   	push   %ebp
+  802f2e:	89 e5                	mov    %esp,%ebp
+  802f30:	57                   	push   %edi
+  802f31:	56                   	push   %esi
+  802f32:	53                   	push   %ebx
+  802f33:	83 ec 1c             	sub    $0x1c,%esp
+  802f36:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f39:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f3b:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802f40:	eb 5d                	jmp    802f9f <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802f42:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802f48:	8b 02                	mov    (%edx),%eax
+  802f4a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f4d:	83 ec 0c             	sub    $0xc,%esp
+  802f50:	ff 75 e0             	push   -0x20(%ebp)
+  802f53:	e8 42 15 00 00       	call   80449a <pageref>
+  802f58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f5b:	89 3c 24             	mov    %edi,(%esp)
+  802f5e:	e8 37 15 00 00       	call   80449a <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802f63:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f65:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f74:	77 15                	ja     802f8b <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f76:	89 f2                	mov    %esi,%edx
+  802f78:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f7a:	c1 ea 10             	shr    $0x10,%edx
+  802f7d:	74 0c                	je     802f8b <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f7f:	c1 e2 10             	shl    $0x10,%edx
+  802f82:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f87:	29 d1                	sub    %edx,%ecx
+  802f89:	eb 06                	jmp    802f91 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f8b:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802f91:	8b 11                	mov    (%ecx),%edx
+  802f93:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f96:	39 d3                	cmp    %edx,%ebx
+  802f98:	74 6e                	je     803008 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f9a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f9d:	74 24                	je     802fc3 <_pipeisclosed+0x96>
+  802f9f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fa1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fa7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fac:	77 94                	ja     802f42 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fae:	89 f0                	mov    %esi,%eax
+  802fb0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fb2:	c1 e8 10             	shr    $0x10,%eax
+  802fb5:	74 8b                	je     802f42 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fb7:	c1 e0 10             	shl    $0x10,%eax
+  802fba:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fbf:	29 c2                	sub    %eax,%edx
+  802fc1:	eb 85                	jmp    802f48 <_pipeisclosed+0x1b>
+  802fc3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fc5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fcb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fd0:	77 18                	ja     802fea <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fd2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fd7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fd9:	c1 e8 10             	shr    $0x10,%eax
+  802fdc:	74 0c                	je     802fea <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fde:	c1 e0 10             	shl    $0x10,%eax
+  802fe1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fe6:	29 c2                	sub    %eax,%edx
+  802fe8:	eb 06                	jmp    802ff0 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802fea:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ff0:	8b 02                	mov    (%edx),%eax
+  802ff2:	8b 40 58             	mov    0x58(%eax),%eax
+  802ff5:	6a 01                	push   $0x1
+  802ff7:	50                   	push   %eax
+  802ff8:	53                   	push   %ebx
+  802ff9:	68 ee 4c 80 00       	push   $0x804cee
+  802ffe:	e8 30 d2 ff ff       	call   800233 <cprintf>
+  803003:	83 c4 10             	add    $0x10,%esp
+  803006:	eb 97                	jmp    802f9f <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803008:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80300b:	0f 94 c0             	sete   %al
+  80300e:	0f b6 c0             	movzbl %al,%eax
+}
+  803011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803014:	5b                   	pop    %ebx
+  803015:	5e                   	pop    %esi
+  803016:	5f                   	pop    %edi
+  803017:	5d                   	pop    %ebp
+  803018:	c3                   	ret
+
+00803019 <devpipe_write>:
+{
+  803019:	55                   	push   %ebp
+  80301a:	89 e5                	mov    %esp,%ebp
+  80301c:	57                   	push   %edi
+  80301d:	56                   	push   %esi
+  80301e:	53                   	push   %ebx
+  80301f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803022:	ff 75 08             	push   0x8(%ebp)
+  803025:	e8 41 e1 ff ff       	call   80116b <fd2data>
+  80302a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803036:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803039:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80303c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80303f:	0f 84 96 00 00 00    	je     8030db <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803045:	8d 73 08             	lea    0x8(%ebx),%esi
+  803048:	eb 32                	jmp    80307c <devpipe_write+0x63>
+  80304a:	89 fa                	mov    %edi,%edx
+  80304c:	89 f0                	mov    %esi,%eax
+  80304e:	e8 69 fe ff ff       	call   802ebc <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803053:	8b 43 04             	mov    0x4(%ebx),%eax
+  803056:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803059:	ba 01 00 00 00       	mov    $0x1,%edx
+  80305e:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803063:	83 ec 04             	sub    $0x4,%esp
+  803066:	6a 0a                	push   $0xa
+  803068:	50                   	push   %eax
+  803069:	53                   	push   %ebx
+  80306a:	e8 fb de ff ff       	call   800f6a <sys_futex_wait>
+  80306f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803074:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803079:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80307c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80307f:	8b 0b                	mov    (%ebx),%ecx
+  803081:	8d 51 20             	lea    0x20(%ecx),%edx
+  803084:	39 d0                	cmp    %edx,%eax
+  803086:	72 1b                	jb     8030a3 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803088:	89 da                	mov    %ebx,%edx
+  80308a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308d:	e8 9b fe ff ff       	call   802f2d <_pipeisclosed>
+  803092:	85 c0                	test   %eax,%eax
+  803094:	74 b4                	je     80304a <devpipe_write+0x31>
+				return 0;
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309e:	5b                   	pop    %ebx
+  80309f:	5e                   	pop    %esi
+  8030a0:	5f                   	pop    %edi
+  8030a1:	5d                   	pop    %ebp
+  8030a2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030a6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8030a9:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8030ad:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8030b0:	89 c2                	mov    %eax,%edx
+  8030b2:	c1 fa 1f             	sar    $0x1f,%edx
+  8030b5:	89 d1                	mov    %edx,%ecx
+  8030b7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030ba:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030bd:	83 e2 1f             	and    $0x1f,%edx
+  8030c0:	29 ca                	sub    %ecx,%edx
+  8030c2:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8030c6:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8030ca:	83 c0 01             	add    $0x1,%eax
+  8030cd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030d0:	83 c6 01             	add    $0x1,%esi
+  8030d3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8030d6:	e9 5e ff ff ff       	jmp    803039 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8030db:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030de:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030e1:	e8 d6 fd ff ff       	call   802ebc <pipewake>
+	return i;
+  8030e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030e9:	eb b0                	jmp    80309b <devpipe_write+0x82>
+
+008030eb <devpipe_read>:
+{
+  8030eb:	55                   	push   %ebp
+  8030ec:	89 e5                	mov    %esp,%ebp
+  8030ee:	57                   	push   %edi
+  8030ef:	56                   	push   %esi
+  8030f0:	53                   	push   %ebx
+  8030f1:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8030f4:	ff 75 08             	push   0x8(%ebp)
+  8030f7:	e8 6f e0 ff ff       	call   80116b <fd2data>
+  8030fc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  803101:	be 00 00 00 00       	mov    $0x0,%esi
+  803106:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803109:	74 6c                	je     803177 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80310b:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80310e:	eb 25                	jmp    803135 <devpipe_read+0x4a>
+  803110:	8b 13                	mov    (%ebx),%edx
+  803112:	b8 01 00 00 00       	mov    $0x1,%eax
+  803117:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80311c:	83 ec 04             	sub    $0x4,%esp
+  80311f:	6a 0a                	push   $0xa
+  803121:	52                   	push   %edx
+  803122:	57                   	push   %edi
+  803123:	e8 42 de ff ff       	call   800f6a <sys_futex_wait>
+  803128:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80312d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803132:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803135:	8b 03                	mov    (%ebx),%eax
+  803137:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80313a:	75 19                	jne    803155 <devpipe_read+0x6a>
+			if (i > 0)
+  80313c:	85 f6                	test   %esi,%esi
+  80313e:	75 3a                	jne    80317a <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803140:	89 da                	mov    %ebx,%edx
+  803142:	8b 45 08             	mov    0x8(%ebp),%eax
+  803145:	e8 e3 fd ff ff       	call   802f2d <_pipeisclosed>
+  80314a:	85 c0                	test   %eax,%eax
+  80314c:	74 c2                	je     803110 <devpipe_read+0x25>
+				return 0;
+  80314e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803153:	eb 31                	jmp    803186 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803155:	89 c1                	mov    %eax,%ecx
+  803157:	c1 f9 1f             	sar    $0x1f,%ecx
+  80315a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80315d:	01 c8                	add    %ecx,%eax
+  80315f:	83 e0 1f             	and    $0x1f,%eax
+  803162:	29 c8                	sub    %ecx,%eax
+  803164:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80316c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80316f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803172:	83 c6 01             	add    $0x1,%esi
+  803175:	eb 8f                	jmp    803106 <devpipe_read+0x1b>
+out:
+  803177:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80317a:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80317d:	89 da                	mov    %ebx,%edx
+  80317f:	e8 38 fd ff ff       	call   802ebc <pipewake>
+	return i;
+  803184:	89 f0                	mov    %esi,%eax
+}
+  803186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803189:	5b                   	pop    %ebx
+  80318a:	5e                   	pop    %esi
+  80318b:	5f                   	pop    %edi
+  80318c:	5d                   	pop    %ebp
+  80318d:	c3                   	ret
+
+0080318e <pipe>:
+{
+  80318e:	55                   	push   %ebp
+  80318f:	89 e5                	mov    %esp,%ebp
+  803191:	56                   	push   %esi
+  803192:	53                   	push   %ebx
+  803193:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803196:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803199:	50                   	push   %eax
+  80319a:	e8 e3 df ff ff       	call   801182 <fd_alloc>
+  80319f:	89 c3                	mov    %eax,%ebx
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	0f 88 23 01 00 00    	js     8032cf <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ac:	83 ec 04             	sub    $0x4,%esp
+  8031af:	68 07 04 00 00       	push   $0x407
+  8031b4:	ff 75 f4             	push   -0xc(%ebp)
+  8031b7:	6a 00                	push   $0x0
+  8031b9:	e8 97 da ff ff       	call   800c55 <sys_page_alloc>
+  8031be:	89 c3                	mov    %eax,%ebx
+  8031c0:	83 c4 10             	add    $0x10,%esp
+  8031c3:	85 c0                	test   %eax,%eax
+  8031c5:	0f 88 04 01 00 00    	js     8032cf <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031cb:	83 ec 0c             	sub    $0xc,%esp
+  8031ce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031d1:	50                   	push   %eax
+  8031d2:	e8 ab df ff ff       	call   801182 <fd_alloc>
+  8031d7:	89 c3                	mov    %eax,%ebx
+  8031d9:	83 c4 10             	add    $0x10,%esp
+  8031dc:	85 c0                	test   %eax,%eax
+  8031de:	0f 88 db 00 00 00    	js     8032bf <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031e4:	83 ec 04             	sub    $0x4,%esp
+  8031e7:	68 07 04 00 00       	push   $0x407
+  8031ec:	ff 75 f0             	push   -0x10(%ebp)
+  8031ef:	6a 00                	push   $0x0
+  8031f1:	e8 5f da ff ff       	call   800c55 <sys_page_alloc>
+  8031f6:	89 c3                	mov    %eax,%ebx
+  8031f8:	83 c4 10             	add    $0x10,%esp
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	0f 88 bc 00 00 00    	js     8032bf <pipe+0x131>
+	va = fd2data(fd0);
+  803203:	83 ec 0c             	sub    $0xc,%esp
+  803206:	ff 75 f4             	push   -0xc(%ebp)
+  803209:	e8 5d df ff ff       	call   80116b <fd2data>
+  80320e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803210:	83 c4 0c             	add    $0xc,%esp
+  803213:	68 07 04 00 00       	push   $0x407
+  803218:	50                   	push   %eax
+  803219:	6a 00                	push   $0x0
+  80321b:	e8 35 da ff ff       	call   800c55 <sys_page_alloc>
+  803220:	89 c3                	mov    %eax,%ebx
+  803222:	83 c4 10             	add    $0x10,%esp
+  803225:	85 c0                	test   %eax,%eax
+  803227:	0f 88 82 00 00 00    	js     8032af <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80322d:	83 ec 0c             	sub    $0xc,%esp
+  803230:	ff 75 f0             	push   -0x10(%ebp)
+  803233:	e8 33 df ff ff       	call   80116b <fd2data>
+  803238:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80323f:	50                   	push   %eax
+  803240:	6a 00                	push   $0x0
+  803242:	56                   	push   %esi
+  803243:	6a 00                	push   $0x0
+  803245:	e8 58 da ff ff       	call   800ca2 <sys_page_map>
+  80324a:	89 c3                	mov    %eax,%ebx
+  80324c:	83 c4 20             	add    $0x20,%esp
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	78 4e                	js     8032a1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803253:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803258:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80325b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80325d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803260:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803267:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80326a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80326c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80326f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803276:	83 ec 0c             	sub    $0xc,%esp
+  803279:	ff 75 f4             	push   -0xc(%ebp)
+  80327c:	e8 da de ff ff       	call   80115b <fd2num>
+  803281:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803284:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803286:	83 c4 04             	add    $0x4,%esp
+  803289:	ff 75 f0             	push   -0x10(%ebp)
+  80328c:	e8 ca de ff ff       	call   80115b <fd2num>
+  803291:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803294:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803297:	83 c4 10             	add    $0x10,%esp
+  80329a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80329f:	eb 2e                	jmp    8032cf <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032a1:	83 ec 08             	sub    $0x8,%esp
+  8032a4:	56                   	push   %esi
+  8032a5:	6a 00                	push   $0x0
+  8032a7:	e8 42 da ff ff       	call   800cee <sys_page_unmap>
+  8032ac:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032af:	83 ec 08             	sub    $0x8,%esp
+  8032b2:	ff 75 f0             	push   -0x10(%ebp)
+  8032b5:	6a 00                	push   $0x0
+  8032b7:	e8 32 da ff ff       	call   800cee <sys_page_unmap>
+  8032bc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032bf:	83 ec 08             	sub    $0x8,%esp
+  8032c2:	ff 75 f4             	push   -0xc(%ebp)
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	e8 22 da ff ff       	call   800cee <sys_page_unmap>
+  8032cc:	83 c4 10             	add    $0x10,%esp
+}
+  8032cf:	89 d8                	mov    %ebx,%eax
+  8032d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032d4:	5b                   	pop    %ebx
+  8032d5:	5e                   	pop    %esi
+  8032d6:	5d                   	pop    %ebp
+  8032d7:	c3                   	ret
+
+008032d8 <pipeisclosed>:
+{
+  8032d8:	55                   	push   %ebp
+  8032d9:	89 e5                	mov    %esp,%ebp
+  8032db:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032e1:	50                   	push   %eax
+  8032e2:	ff 75 08             	push   0x8(%ebp)
+  8032e5:	e8 ee de ff ff       	call   8011d8 <fd_lookup>
+  8032ea:	83 c4 10             	add    $0x10,%esp
+  8032ed:	85 c0                	test   %eax,%eax
+  8032ef:	78 18                	js     803309 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032f1:	83 ec 0c             	sub    $0xc,%esp
+  8032f4:	ff 75 f4             	push   -0xc(%ebp)
+  8032f7:	e8 6f de ff ff       	call   80116b <fd2data>
+  8032fc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803301:	e8 27 fc ff ff       	call   802f2d <_pipeisclosed>
+  803306:	83 c4 10             	add    $0x10,%esp
+}
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+
+0080330b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80330b:	55                   	push   %ebp
+  80330c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80330e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803311:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803317:	5d                   	pop    %ebp
+  803318:	c3                   	ret
+
+00803319 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803319:	55                   	push   %ebp
+  80331a:	89 e5                	mov    %esp,%ebp
+  80331c:	56                   	push   %esi
+  80331d:	53                   	push   %ebx
+  80331e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803321:	ba 00 00 00 00       	mov    $0x0,%edx
+  803326:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80332b:	89 d0                	mov    %edx,%eax
+  80332d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803331:	85 c0                	test   %eax,%eax
+  803333:	74 2d                	je     803362 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803335:	83 f8 02             	cmp    $0x2,%eax
+  803338:	74 08                	je     803342 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80333a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80333f:	f0 87 03             	lock xchg %eax,(%ebx)
+  803342:	be 02 00 00 00       	mov    $0x2,%esi
+  803347:	eb 15                	jmp    80335e <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803349:	83 ec 04             	sub    $0x4,%esp
+  80334c:	6a 00                	push   $0x0
+  80334e:	6a 02                	push   $0x2
+  803350:	53                   	push   %ebx
+  803351:	e8 14 dc ff ff       	call   800f6a <sys_futex_wait>
+  803356:	89 f0                	mov    %esi,%eax
+  803358:	f0 87 03             	lock xchg %eax,(%ebx)
+  80335b:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	75 e7                	jne    803349 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803362:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803365:	5b                   	pop    %ebx
+  803366:	5e                   	pop    %esi
+  803367:	5d                   	pop    %ebp
+  803368:	c3                   	ret
+
+00803369 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803369:	55                   	push   %ebp
+  80336a:	89 e5                	mov    %esp,%ebp
+  80336c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80336f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803374:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803379:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80337d:	f7 d8                	neg    %eax
+  80337f:	19 c0                	sbb    %eax,%eax
+  803381:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803384:	5d                   	pop    %ebp
+  803385:	c3                   	ret
+
+00803386 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	83 ec 08             	sub    $0x8,%esp
+  80338c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803397:	83 f8 02             	cmp    $0x2,%eax
+  80339a:	74 02                	je     80339e <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80339c:	c9                   	leave
+  80339d:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80339e:	83 ec 08             	sub    $0x8,%esp
+  8033a1:	6a 01                	push   $0x1
+  8033a3:	52                   	push   %edx
+  8033a4:	e8 f0 db ff ff       	call   800f99 <sys_futex_wake>
+  8033a9:	83 c4 10             	add    $0x10,%esp
+}
+  8033ac:	eb ee                	jmp    80339c <mutex_unlock+0x16>
+
+008033ae <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8033ae:	55                   	push   %ebp
+  8033af:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8033b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8033ba:	5d                   	pop    %ebp
+  8033bb:	c3                   	ret
+
+008033bc <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8033bc:	55                   	push   %ebp
+  8033bd:	89 e5                	mov    %esp,%ebp
+  8033bf:	57                   	push   %edi
+  8033c0:	56                   	push   %esi
+  8033c1:	53                   	push   %ebx
+  8033c2:	83 ec 18             	sub    $0x18,%esp
+  8033c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8033cb:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8033cd:	53                   	push   %ebx
+  8033ce:	e8 b3 ff ff ff       	call   803386 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8033d3:	83 c4 0c             	add    $0xc,%esp
+  8033d6:	ff 75 10             	push   0x10(%ebp)
+  8033d9:	57                   	push   %edi
+  8033da:	56                   	push   %esi
+  8033db:	e8 8a db ff ff       	call   800f6a <sys_futex_wait>
+  8033e0:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8033e2:	83 c4 10             	add    $0x10,%esp
+  8033e5:	be 02 00 00 00       	mov    $0x2,%esi
+  8033ea:	eb 10                	jmp    8033fc <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033ec:	83 ec 04             	sub    $0x4,%esp
+  8033ef:	6a 00                	push   $0x0
+  8033f1:	6a 02                	push   $0x2
+  8033f3:	53                   	push   %ebx
+  8033f4:	e8 71 db ff ff       	call   800f6a <sys_futex_wait>
+  8033f9:	83 c4 10             	add    $0x10,%esp
+  8033fc:	89 f0                	mov    %esi,%eax
+  8033fe:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803401:	85 c0                	test   %eax,%eax
+  803403:	75 e7                	jne    8033ec <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803405:	83 ff ec             	cmp    $0xffffffec,%edi
+  803408:	74 05                	je     80340f <cond_timedwait+0x53>
+  80340a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80340f:	89 f8                	mov    %edi,%eax
+  803411:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803414:	5b                   	pop    %ebx
+  803415:	5e                   	pop    %esi
+  803416:	5f                   	pop    %edi
+  803417:	5d                   	pop    %ebp
+  803418:	c3                   	ret
+
+00803419 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803419:	55                   	push   %ebp
+  80341a:	89 e5                	mov    %esp,%ebp
+  80341c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80341f:	6a 00                	push   $0x0
+  803421:	ff 75 0c             	push   0xc(%ebp)
+  803424:	ff 75 08             	push   0x8(%ebp)
+  803427:	e8 90 ff ff ff       	call   8033bc <cond_timedwait>
+}
+  80342c:	83 c4 10             	add    $0x10,%esp
+  80342f:	c9                   	leave
+  803430:	c3                   	ret
+
+00803431 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803431:	55                   	push   %ebp
+  803432:	89 e5                	mov    %esp,%ebp
+  803434:	83 ec 10             	sub    $0x10,%esp
+  803437:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80343a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80343f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803443:	6a 01                	push   $0x1
+  803445:	50                   	push   %eax
+  803446:	e8 4e db ff ff       	call   800f99 <sys_futex_wake>
+}
+  80344b:	83 c4 10             	add    $0x10,%esp
+  80344e:	c9                   	leave
+  80344f:	c3                   	ret
+
+00803450 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803450:	55                   	push   %ebp
+  803451:	89 e5                	mov    %esp,%ebp
+  803453:	83 ec 10             	sub    $0x10,%esp
+  803456:	8b 45 08             	mov    0x8(%ebp),%eax
+  803459:	ba 01 00 00 00       	mov    $0x1,%edx
+  80345e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803462:	68 00 04 00 00       	push   $0x400
+  803467:	50                   	push   %eax
+  803468:	e8 2c db ff ff       	call   800f99 <sys_futex_wake>
+}
+  80346d:	83 c4 10             	add    $0x10,%esp
+  803470:	c9                   	leave
+  803471:	c3                   	ret
+
+00803472 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803472:	55                   	push   %ebp
+  803473:	89 e5                	mov    %esp,%ebp
+  803475:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803478:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80347b:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80347d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803484:	5d                   	pop    %ebp
+  803485:	c3                   	ret
+
+00803486 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	53                   	push   %ebx
+  80348a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80348d:	8b 11                	mov    (%ecx),%edx
+  80348f:	85 d2                	test   %edx,%edx
+  803491:	74 14                	je     8034a7 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803493:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803496:	89 d0                	mov    %edx,%eax
+  803498:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80349c:	39 c2                	cmp    %eax,%edx
+  80349e:	75 ed                	jne    80348d <sem_trywait+0x7>
+			return 0;
+  8034a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a5:	eb 05                	jmp    8034ac <sem_trywait+0x26>
+	return -E_AGAIN;
+  8034a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8034ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034af:	c9                   	leave
+  8034b0:	c3                   	ret
+
+008034b1 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8034b1:	55                   	push   %ebp
+  8034b2:	89 e5                	mov    %esp,%ebp
+  8034b4:	57                   	push   %edi
+  8034b5:	56                   	push   %esi
+  8034b6:	53                   	push   %ebx
+  8034b7:	83 ec 1c             	sub    $0x1c,%esp
+  8034ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8034bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8034c0:	e8 1d da ff ff       	call   800ee2 <sys_time_msec>
+  8034c5:	01 f8                	add    %edi,%eax
+  8034c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8034ca:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8034cf:	eb 28                	jmp    8034f9 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8034d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034d6:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8034db:	83 ec 04             	sub    $0x4,%esp
+  8034de:	56                   	push   %esi
+  8034df:	6a 00                	push   $0x0
+  8034e1:	53                   	push   %ebx
+  8034e2:	e8 83 da ff ff       	call   800f6a <sys_futex_wait>
+  8034e7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8034ec:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8034f7:	74 2e                	je     803527 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8034f9:	83 ec 0c             	sub    $0xc,%esp
+  8034fc:	53                   	push   %ebx
+  8034fd:	e8 84 ff ff ff       	call   803486 <sem_trywait>
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	85 c0                	test   %eax,%eax
+  803507:	79 19                	jns    803522 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803509:	85 ff                	test   %edi,%edi
+  80350b:	74 c4                	je     8034d1 <sem_timedwait+0x20>
+  80350d:	e8 d0 d9 ff ff       	call   800ee2 <sys_time_msec>
+  803512:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803515:	29 c6                	sub    %eax,%esi
+  803517:	85 f6                	test   %esi,%esi
+  803519:	7f b6                	jg     8034d1 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80351b:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803520:	eb 05                	jmp    803527 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803527:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80352a:	5b                   	pop    %ebx
+  80352b:	5e                   	pop    %esi
+  80352c:	5f                   	pop    %edi
+  80352d:	5d                   	pop    %ebp
+  80352e:	c3                   	ret
+
+0080352f <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80352f:	55                   	push   %ebp
+  803530:	89 e5                	mov    %esp,%ebp
+  803532:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803535:	6a 00                	push   $0x0
+  803537:	ff 75 08             	push   0x8(%ebp)
+  80353a:	e8 72 ff ff ff       	call   8034b1 <sem_timedwait>
+}
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	c9                   	leave
+  803543:	c3                   	ret
+
+00803544 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803544:	55                   	push   %ebp
+  803545:	89 e5                	mov    %esp,%ebp
+  803547:	83 ec 08             	sub    $0x8,%esp
+  80354a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80354d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803552:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803556:	8b 50 04             	mov    0x4(%eax),%edx
+  803559:	85 d2                	test   %edx,%edx
+  80355b:	75 02                	jne    80355f <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80355d:	c9                   	leave
+  80355e:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80355f:	83 ec 08             	sub    $0x8,%esp
+  803562:	6a 01                	push   $0x1
+  803564:	50                   	push   %eax
+  803565:	e8 2f da ff ff       	call   800f99 <sys_futex_wake>
+  80356a:	83 c4 10             	add    $0x10,%esp
+}
+  80356d:	eb ee                	jmp    80355d <sem_post+0x19>
+
+0080356f <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80356f:	55                   	push   %ebp
+  803570:	89 e5                	mov    %esp,%ebp
+  803572:	57                   	push   %edi
+  803573:	56                   	push   %esi
+  803574:	53                   	push   %ebx
+  803575:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803578:	68 20 60 80 00       	push   $0x806020
+  80357d:	e8 97 fd ff ff       	call   803319 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803582:	a1 44 60 80 00       	mov    0x806044,%eax
+  803587:	83 c4 10             	add    $0x10,%esp
+  80358a:	85 c0                	test   %eax,%eax
+  80358c:	75 19                	jne    8035a7 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80358e:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803593:	8b 00                	mov    (%eax),%eax
+  803595:	8b 40 48             	mov    0x48(%eax),%eax
+  803598:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  80359d:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  8035a4:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8035a7:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8035ac:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035af:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035b6:	8b 40 04             	mov    0x4(%eax),%eax
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	0f 84 e4 00 00 00    	je     8036a5 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8035c1:	83 c3 01             	add    $0x1,%ebx
+  8035c4:	83 fb 20             	cmp    $0x20,%ebx
+  8035c7:	75 e3                	jne    8035ac <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8035c9:	83 ec 0c             	sub    $0xc,%esp
+  8035cc:	68 20 60 80 00       	push   $0x806020
+  8035d1:	e8 b0 fd ff ff       	call   803386 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8035d6:	83 c4 10             	add    $0x10,%esp
+  8035d9:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8035de:	e9 b8 00 00 00       	jmp    80369b <pthread_create+0x12c>
+  8035e3:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8035e6:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8035e9:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8035eb:	39 f3                	cmp    %esi,%ebx
+  8035ed:	73 16                	jae    803605 <pthread_create+0x96>
+		va -= PGSIZE;
+  8035ef:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8035f5:	83 ec 08             	sub    $0x8,%esp
+  8035f8:	56                   	push   %esi
+  8035f9:	6a 00                	push   $0x0
+  8035fb:	e8 ee d6 ff ff       	call   800cee <sys_page_unmap>
+  803600:	83 c4 10             	add    $0x10,%esp
+  803603:	eb e6                	jmp    8035eb <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803605:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803608:	83 ec 08             	sub    $0x8,%esp
+  80360b:	ff 75 e4             	push   -0x1c(%ebp)
+  80360e:	6a 00                	push   $0x0
+  803610:	e8 d9 d6 ff ff       	call   800cee <sys_page_unmap>
+	return r;
+  803615:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803618:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80361b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803622:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803629:	eb 70                	jmp    80369b <pthread_create+0x12c>
+	th->th_fn = fn;
+  80362b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80362e:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803635:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803638:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80363b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80363e:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803641:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803648:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80364d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803650:	29 c8                	sub    %ecx,%eax
+  803652:	85 db                	test   %ebx,%ebx
+  803654:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  80365b:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80365e:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803665:	83 ec 04             	sub    $0x4,%esp
+  803668:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80366d:	29 ca                	sub    %ecx,%edx
+  80366f:	52                   	push   %edx
+	*--esp = 0;
+  803670:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803673:	50                   	push   %eax
+  803674:	68 cc 38 80 00       	push   $0x8038cc
+  803679:	e8 c0 d9 ff ff       	call   80103e <sys_thread_create>
+  80367e:	89 c7                	mov    %eax,%edi
+  803680:	83 c4 10             	add    $0x10,%esp
+  803683:	85 c0                	test   %eax,%eax
+  803685:	78 91                	js     803618 <pthread_create+0xa9>
+	th->th_env = id;
+  803687:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80368a:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803691:	8b 45 08             	mov    0x8(%ebp),%eax
+  803694:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803696:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80369b:	89 f8                	mov    %edi,%eax
+  80369d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a0:	5b                   	pop    %ebx
+  8036a1:	5e                   	pop    %esi
+  8036a2:	5f                   	pop    %edi
+  8036a3:	5d                   	pop    %ebp
+  8036a4:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8036a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036a8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8036af:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8036b6:	83 ec 0c             	sub    $0xc,%esp
+  8036b9:	68 20 60 80 00       	push   $0x806020
+  8036be:	e8 c3 fc ff ff       	call   803386 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8036c3:	89 d9                	mov    %ebx,%ecx
+  8036c5:	c1 e1 10             	shl    $0x10,%ecx
+  8036c8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8036cb:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8036d0:	29 c8                	sub    %ecx,%eax
+  8036d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8036d5:	c1 e8 16             	shr    $0x16,%eax
+  8036d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036df:	83 c4 10             	add    $0x10,%esp
+  8036e2:	a8 01                	test   $0x1,%al
+  8036e4:	74 15                	je     8036fb <pthread_create+0x18c>
+  8036e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e9:	c1 e8 0c             	shr    $0xc,%eax
+  8036ec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036f3:	a8 01                	test   $0x1,%al
+  8036f5:	0f 85 30 ff ff ff    	jne    80362b <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036fb:	83 ec 04             	sub    $0x4,%esp
+  8036fe:	6a 07                	push   $0x7
+  803700:	ff 75 e4             	push   -0x1c(%ebp)
+  803703:	6a 00                	push   $0x0
+  803705:	e8 4b d5 ff ff       	call   800c55 <sys_page_alloc>
+  80370a:	89 c7                	mov    %eax,%edi
+  80370c:	83 c4 10             	add    $0x10,%esp
+  80370f:	85 c0                	test   %eax,%eax
+  803711:	0f 88 01 ff ff ff    	js     803618 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803717:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80371c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80371f:	29 d0                	sub    %edx,%eax
+  803721:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803724:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803726:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80372b:	29 d0                	sub    %edx,%eax
+  80372d:	89 c7                	mov    %eax,%edi
+  80372f:	39 fe                	cmp    %edi,%esi
+  803731:	0f 83 f4 fe ff ff    	jae    80362b <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803737:	83 ec 04             	sub    $0x4,%esp
+  80373a:	6a 07                	push   $0x7
+  80373c:	56                   	push   %esi
+  80373d:	6a 00                	push   $0x0
+  80373f:	e8 11 d5 ff ff       	call   800c55 <sys_page_alloc>
+  803744:	83 c4 10             	add    $0x10,%esp
+  803747:	85 c0                	test   %eax,%eax
+  803749:	0f 88 94 fe ff ff    	js     8035e3 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80374f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803755:	eb d8                	jmp    80372f <pthread_create+0x1c0>
+
+00803757 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803757:	55                   	push   %ebp
+  803758:	89 e5                	mov    %esp,%ebp
+  80375a:	57                   	push   %edi
+  80375b:	56                   	push   %esi
+  80375c:	53                   	push   %ebx
+  80375d:	83 ec 0c             	sub    $0xc,%esp
+  803760:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803763:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803766:	83 f8 1e             	cmp    $0x1e,%eax
+  803769:	0f 87 c7 00 00 00    	ja     803836 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80376f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803771:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803777:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80377c:	77 12                	ja     803790 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80377e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803783:	29 d0                	sub    %edx,%eax
+  803785:	c1 e8 10             	shr    $0x10,%eax
+  803788:	39 c3                	cmp    %eax,%ebx
+  80378a:	0f 84 ad 00 00 00    	je     80383d <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803790:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803793:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80379a:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8037a1:	eb 10                	jmp    8037b3 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037a3:	83 ec 04             	sub    $0x4,%esp
+  8037a6:	6a 00                	push   $0x0
+  8037a8:	6a 01                	push   $0x1
+  8037aa:	57                   	push   %edi
+  8037ab:	e8 ba d7 ff ff       	call   800f6a <sys_futex_wait>
+  8037b0:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8037b3:	8b 46 04             	mov    0x4(%esi),%eax
+  8037b6:	83 f8 01             	cmp    $0x1,%eax
+  8037b9:	74 e8                	je     8037a3 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8037bb:	83 f8 02             	cmp    $0x2,%eax
+  8037be:	0f 85 80 00 00 00    	jne    803844 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037c4:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8037c7:	c1 e6 02             	shl    $0x2,%esi
+  8037ca:	eb 05                	jmp    8037d1 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8037cc:	e8 58 d4 ff ff       	call   800c29 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037d1:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8037d7:	89 ca                	mov    %ecx,%edx
+  8037d9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8037df:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037e2:	c1 e0 04             	shl    $0x4,%eax
+  8037e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037ea:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8037ed:	39 c1                	cmp    %eax,%ecx
+  8037ef:	75 12                	jne    803803 <pthread_join+0xac>
+  8037f1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037f4:	c1 e0 04             	shl    $0x4,%eax
+  8037f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037fc:	8b 40 54             	mov    0x54(%eax),%eax
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	75 c9                	jne    8037cc <pthread_join+0x75>
+	if (ret_store)
+  803803:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803807:	74 0f                	je     803818 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803809:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80380c:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803813:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803816:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803818:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80381b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803822:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80382e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803831:	5b                   	pop    %ebx
+  803832:	5e                   	pop    %esi
+  803833:	5f                   	pop    %edi
+  803834:	5d                   	pop    %ebp
+  803835:	c3                   	ret
+		return -E_INVAL;
+  803836:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80383b:	eb f1                	jmp    80382e <pthread_join+0xd7>
+  80383d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803842:	eb ea                	jmp    80382e <pthread_join+0xd7>
+		return -E_INVAL;
+  803844:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803849:	eb e3                	jmp    80382e <pthread_join+0xd7>
+
+0080384b <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80384b:	55                   	push   %ebp
+  80384c:	89 e5                	mov    %esp,%ebp
+  80384e:	53                   	push   %ebx
+  80384f:	83 ec 04             	sub    $0x4,%esp
+  803852:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803854:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80385a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80385f:	77 0c                	ja     80386d <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803861:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803866:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803868:	c1 e8 10             	shr    $0x10,%eax
+  80386b:	75 0a                	jne    803877 <pthread_exit+0x2c>
+		exit();
+  80386d:	e8 be c8 ff ff       	call   800130 <exit>
+  803872:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803877:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80387e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803881:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803888:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80388b:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80388e:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803895:	83 ec 08             	sub    $0x8,%esp
+  803898:	6a 20                	push   $0x20
+  80389a:	01 c2                	add    %eax,%edx
+  80389c:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8038a3:	50                   	push   %eax
+  8038a4:	e8 f0 d6 ff ff       	call   800f99 <sys_futex_wake>
+	sys_env_destroy(0);
+  8038a9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8038b0:	e8 fd d2 ff ff       	call   800bb2 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8038b5:	83 c4 0c             	add    $0xc,%esp
+  8038b8:	68 06 4d 80 00       	push   $0x804d06
+  8038bd:	68 a5 00 00 00       	push   $0xa5
+  8038c2:	68 20 4d 80 00       	push   $0x804d20
+  8038c7:	e8 8c c8 ff ff       	call   800158 <_panic>
+
+008038cc <pthread_start>:
+{
+  8038cc:	55                   	push   %ebp
+  8038cd:	89 e5                	mov    %esp,%ebp
+  8038cf:	53                   	push   %ebx
+  8038d0:	83 ec 04             	sub    $0x4,%esp
+  8038d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8038d6:	e8 22 d3 ff ff       	call   800bfd <sys_getenvid>
+  8038db:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8038e0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8038e6:	85 db                	test   %ebx,%ebx
+  8038e8:	74 0c                	je     8038f6 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038ea:	89 d9                	mov    %ebx,%ecx
+  8038ec:	c1 e1 10             	shl    $0x10,%ecx
+  8038ef:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038f4:	29 ca                	sub    %ecx,%edx
+  8038f6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8038f9:	c1 e0 04             	shl    $0x4,%eax
+  8038fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803901:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803903:	83 ec 0c             	sub    $0xc,%esp
+  803906:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80390d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803910:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803917:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  80391e:	89 04 24             	mov    %eax,(%esp)
+  803921:	e8 25 ff ff ff       	call   80384b <pthread_exit>
+
+00803926 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803926:	55                   	push   %ebp
+  803927:	89 e5                	mov    %esp,%ebp
+  803929:	57                   	push   %edi
+  80392a:	56                   	push   %esi
+  80392b:	53                   	push   %ebx
+  80392c:	83 ec 1c             	sub    $0x1c,%esp
+  80392f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803931:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803937:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80393e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803943:	77 0d                	ja     803952 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803945:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80394a:	29 d0                	sub    %edx,%eax
+  80394c:	c1 e8 10             	shr    $0x10,%eax
+  80394f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803952:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803957:	eb 2f                	jmp    803988 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803959:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80395f:	8b 01                	mov    (%ecx),%eax
+  803961:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803964:	39 c2                	cmp    %eax,%edx
+  803966:	75 14                	jne    80397c <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803968:	83 ec 0c             	sub    $0xc,%esp
+  80396b:	57                   	push   %edi
+  80396c:	e8 41 d2 ff ff       	call   800bb2 <sys_env_destroy>
+  803971:	83 c4 10             	add    $0x10,%esp
+  803974:	85 c0                	test   %eax,%eax
+  803976:	0f 88 97 00 00 00    	js     803a13 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80397c:	83 c3 01             	add    $0x1,%ebx
+  80397f:	83 fb 20             	cmp    $0x20,%ebx
+  803982:	0f 84 d2 00 00 00    	je     803a5a <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803988:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80398b:	74 ef                	je     80397c <pthread_kill_others+0x56>
+  80398d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803990:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803997:	8b 40 04             	mov    0x4(%eax),%eax
+  80399a:	83 f8 01             	cmp    $0x1,%eax
+  80399d:	75 dd                	jne    80397c <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80399f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039a2:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8039a9:	89 fe                	mov    %edi,%esi
+  8039ab:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039b1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039b4:	c1 e0 04             	shl    $0x4,%eax
+  8039b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039bc:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039bf:	39 c7                	cmp    %eax,%edi
+  8039c1:	75 b9                	jne    80397c <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039c3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039c6:	c1 e0 04             	shl    $0x4,%eax
+  8039c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039ce:	8b 40 54             	mov    0x54(%eax),%eax
+  8039d1:	85 c0                	test   %eax,%eax
+  8039d3:	74 a7                	je     80397c <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039d5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039d8:	c1 e0 04             	shl    $0x4,%eax
+  8039db:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8039e1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039e3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8039e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039ee:	0f 87 65 ff ff ff    	ja     803959 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039f9:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8039fb:	c1 e8 10             	shr    $0x10,%eax
+  8039fe:	0f 84 55 ff ff ff    	je     803959 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a04:	c1 e0 10             	shl    $0x10,%eax
+  803a07:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803a0c:	29 c1                	sub    %eax,%ecx
+  803a0e:	e9 4c ff ff ff       	jmp    80395f <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803a13:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a16:	c1 e2 04             	shl    $0x4,%edx
+  803a19:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a1f:	8b 52 48             	mov    0x48(%edx),%edx
+  803a22:	39 fa                	cmp    %edi,%edx
+  803a24:	0f 85 52 ff ff ff    	jne    80397c <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803a2a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a2d:	c1 e2 04             	shl    $0x4,%edx
+  803a30:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a36:	8b 52 54             	mov    0x54(%edx),%edx
+  803a39:	85 d2                	test   %edx,%edx
+  803a3b:	0f 84 3b ff ff ff    	je     80397c <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a41:	83 ec 0c             	sub    $0xc,%esp
+  803a44:	50                   	push   %eax
+  803a45:	57                   	push   %edi
+  803a46:	68 30 4d 80 00       	push   $0x804d30
+  803a4b:	68 bb 00 00 00       	push   $0xbb
+  803a50:	68 20 4d 80 00       	push   $0x804d20
+  803a55:	e8 fe c6 ff ff       	call   800158 <_panic>
+	}
+}
+  803a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a5d:	5b                   	pop    %ebx
+  803a5e:	5e                   	pop    %esi
+  803a5f:	5f                   	pop    %edi
+  803a60:	5d                   	pop    %ebp
+  803a61:	c3                   	ret
+
+00803a62 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803a62:	55                   	push   %ebp
+  803a63:	89 e5                	mov    %esp,%ebp
+  803a65:	53                   	push   %ebx
+  803a66:	83 ec 04             	sub    $0x4,%esp
+  803a69:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a6b:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803a71:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803a77:	0f 87 85 00 00 00    	ja     803b02 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a7d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a82:	29 c3                	sub    %eax,%ebx
+  803a84:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a87:	83 ec 04             	sub    $0x4,%esp
+  803a8a:	68 80 02 00 00       	push   $0x280
+  803a8f:	6a 00                	push   $0x0
+  803a91:	68 40 60 80 00       	push   $0x806040
+  803a96:	e8 cd ce ff ff       	call   800968 <memset>
+	threads_mu.m_state = 0;
+  803a9b:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803aa2:	00 00 00 
+	if (self != 0) {
+  803aa5:	83 c4 10             	add    $0x10,%esp
+  803aa8:	85 db                	test   %ebx,%ebx
+  803aaa:	74 51                	je     803afd <pthread_fork_child+0x9b>
+  803aac:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803aae:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ab4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ab9:	77 18                	ja     803ad3 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803abb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ac0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803ac2:	c1 e8 10             	shr    $0x10,%eax
+  803ac5:	74 0c                	je     803ad3 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ac7:	c1 e0 10             	shl    $0x10,%eax
+  803aca:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803acf:	29 c2                	sub    %eax,%edx
+  803ad1:	eb 06                	jmp    803ad9 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803ad3:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803ad9:	8b 02                	mov    (%edx),%eax
+  803adb:	8b 48 48             	mov    0x48(%eax),%ecx
+  803ade:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803ae5:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ae8:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803aef:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803af6:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b00:	c9                   	leave
+  803b01:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803b02:	83 ec 04             	sub    $0x4,%esp
+  803b05:	68 80 02 00 00       	push   $0x280
+  803b0a:	6a 00                	push   $0x0
+  803b0c:	68 40 60 80 00       	push   $0x806040
+  803b11:	e8 52 ce ff ff       	call   800968 <memset>
+	threads_mu.m_state = 0;
+  803b16:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803b1d:	00 00 00 
+  803b20:	83 c4 10             	add    $0x10,%esp
+  803b23:	eb d8                	jmp    803afd <pthread_fork_child+0x9b>
+
+00803b25 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2a:	c3                   	ret
+
+00803b2b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b2b:	55                   	push   %ebp
+  803b2c:	89 e5                	mov    %esp,%ebp
+  803b2e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b31:	68 55 4d 80 00       	push   $0x804d55
+  803b36:	ff 75 0c             	push   0xc(%ebp)
+  803b39:	e8 d9 cc ff ff       	call   800817 <strcpy>
+	return 0;
+}
+  803b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b43:	c9                   	leave
+  803b44:	c3                   	ret
+
+00803b45 <devcons_write>:
+{
+  803b45:	55                   	push   %ebp
+  803b46:	89 e5                	mov    %esp,%ebp
+  803b48:	57                   	push   %edi
+  803b49:	56                   	push   %esi
+  803b4a:	53                   	push   %ebx
+  803b4b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b51:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b56:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b5c:	eb 2e                	jmp    803b8c <devcons_write+0x47>
+		m = n - tot;
+  803b5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b61:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b63:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b68:	39 c3                	cmp    %eax,%ebx
+  803b6a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b6d:	83 ec 04             	sub    $0x4,%esp
+  803b70:	53                   	push   %ebx
+  803b71:	89 f0                	mov    %esi,%eax
+  803b73:	03 45 0c             	add    0xc(%ebp),%eax
+  803b76:	50                   	push   %eax
+  803b77:	57                   	push   %edi
+  803b78:	e8 20 ce ff ff       	call   80099d <memmove>
+		sys_cputs(buf, m);
+  803b7d:	83 c4 08             	add    $0x8,%esp
+  803b80:	53                   	push   %ebx
+  803b81:	57                   	push   %edi
+  803b82:	e8 d4 cf ff ff       	call   800b5b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b87:	01 de                	add    %ebx,%esi
+  803b89:	83 c4 10             	add    $0x10,%esp
+  803b8c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b8f:	72 cd                	jb     803b5e <devcons_write+0x19>
+}
+  803b91:	89 f0                	mov    %esi,%eax
+  803b93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b96:	5b                   	pop    %ebx
+  803b97:	5e                   	pop    %esi
+  803b98:	5f                   	pop    %edi
+  803b99:	5d                   	pop    %ebp
+  803b9a:	c3                   	ret
+
+00803b9b <devcons_read>:
+{
+  803b9b:	55                   	push   %ebp
+  803b9c:	89 e5                	mov    %esp,%ebp
+  803b9e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803baa:	75 07                	jne    803bb3 <devcons_read+0x18>
+  803bac:	eb 1f                	jmp    803bcd <devcons_read+0x32>
+		sys_yield();
+  803bae:	e8 76 d0 ff ff       	call   800c29 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803bb3:	e8 ce cf ff ff       	call   800b86 <sys_cgetc>
+  803bb8:	85 c0                	test   %eax,%eax
+  803bba:	74 f2                	je     803bae <devcons_read+0x13>
+	if (c < 0)
+  803bbc:	78 0f                	js     803bcd <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803bbe:	83 f8 04             	cmp    $0x4,%eax
+  803bc1:	74 0c                	je     803bcf <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803bc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bc6:	88 02                	mov    %al,(%edx)
+	return 1;
+  803bc8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803bcd:	c9                   	leave
+  803bce:	c3                   	ret
+		return 0;
+  803bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd4:	eb f7                	jmp    803bcd <devcons_read+0x32>
+
+00803bd6 <cputchar>:
+{
+  803bd6:	55                   	push   %ebp
+  803bd7:	89 e5                	mov    %esp,%ebp
+  803bd9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bdf:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803be2:	6a 01                	push   $0x1
+  803be4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803be7:	50                   	push   %eax
+  803be8:	e8 6e cf ff ff       	call   800b5b <sys_cputs>
+}
+  803bed:	83 c4 10             	add    $0x10,%esp
+  803bf0:	c9                   	leave
+  803bf1:	c3                   	ret
+
+00803bf2 <getchar>:
+{
+  803bf2:	55                   	push   %ebp
+  803bf3:	89 e5                	mov    %esp,%ebp
+  803bf5:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803bf8:	6a 01                	push   $0x1
+  803bfa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bfd:	50                   	push   %eax
+  803bfe:	6a 00                	push   $0x0
+  803c00:	e8 63 d8 ff ff       	call   801468 <read>
+	if (r < 0)
+  803c05:	83 c4 10             	add    $0x10,%esp
+  803c08:	85 c0                	test   %eax,%eax
+  803c0a:	78 06                	js     803c12 <getchar+0x20>
+	if (r < 1)
+  803c0c:	74 06                	je     803c14 <getchar+0x22>
+	return c;
+  803c0e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803c12:	c9                   	leave
+  803c13:	c3                   	ret
+		return -E_EOF;
+  803c14:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803c19:	eb f7                	jmp    803c12 <getchar+0x20>
+
+00803c1b <iscons>:
+{
+  803c1b:	55                   	push   %ebp
+  803c1c:	89 e5                	mov    %esp,%ebp
+  803c1e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c24:	50                   	push   %eax
+  803c25:	ff 75 08             	push   0x8(%ebp)
+  803c28:	e8 ab d5 ff ff       	call   8011d8 <fd_lookup>
+  803c2d:	83 c4 10             	add    $0x10,%esp
+  803c30:	85 c0                	test   %eax,%eax
+  803c32:	78 11                	js     803c45 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803c34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c37:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c3d:	39 10                	cmp    %edx,(%eax)
+  803c3f:	0f 94 c0             	sete   %al
+  803c42:	0f b6 c0             	movzbl %al,%eax
+}
+  803c45:	c9                   	leave
+  803c46:	c3                   	ret
+
+00803c47 <opencons>:
+{
+  803c47:	55                   	push   %ebp
+  803c48:	89 e5                	mov    %esp,%ebp
+  803c4a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c50:	50                   	push   %eax
+  803c51:	e8 2c d5 ff ff       	call   801182 <fd_alloc>
+  803c56:	83 c4 10             	add    $0x10,%esp
+  803c59:	85 c0                	test   %eax,%eax
+  803c5b:	78 3a                	js     803c97 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c5d:	83 ec 04             	sub    $0x4,%esp
+  803c60:	68 07 04 00 00       	push   $0x407
+  803c65:	ff 75 f4             	push   -0xc(%ebp)
+  803c68:	6a 00                	push   $0x0
+  803c6a:	e8 e6 cf ff ff       	call   800c55 <sys_page_alloc>
+  803c6f:	83 c4 10             	add    $0x10,%esp
+  803c72:	85 c0                	test   %eax,%eax
+  803c74:	78 21                	js     803c97 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c79:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c7f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c84:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c8b:	83 ec 0c             	sub    $0xc,%esp
+  803c8e:	50                   	push   %eax
+  803c8f:	e8 c7 d4 ff ff       	call   80115b <fd2num>
+  803c94:	83 c4 10             	add    $0x10,%esp
+}
+  803c97:	c9                   	leave
+  803c98:	c3                   	ret
+
+00803c99 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c99:	55                   	push   %ebp
+  803c9a:	89 e5                	mov    %esp,%ebp
+  803c9c:	57                   	push   %edi
+  803c9d:	56                   	push   %esi
+  803c9e:	53                   	push   %ebx
+  803c9f:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803ca2:	89 d6                	mov    %edx,%esi
+  803ca4:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803ca7:	89 cf                	mov    %ecx,%edi
+  803ca9:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803cac:	89 fa                	mov    %edi,%edx
+  803cae:	80 ce 08             	or     $0x8,%dh
+  803cb1:	f6 c5 08             	test   $0x8,%ch
+  803cb4:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803cb7:	57                   	push   %edi
+  803cb8:	56                   	push   %esi
+  803cb9:	50                   	push   %eax
+  803cba:	56                   	push   %esi
+  803cbb:	6a 00                	push   $0x0
+  803cbd:	e8 e0 cf ff ff       	call   800ca2 <sys_page_map>
+	if (r < 0) {
+  803cc2:	83 c4 20             	add    $0x20,%esp
+  803cc5:	85 c0                	test   %eax,%eax
+  803cc7:	78 27                	js     803cf0 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803cc9:	83 ec 0c             	sub    $0xc,%esp
+  803ccc:	57                   	push   %edi
+  803ccd:	56                   	push   %esi
+  803cce:	6a 00                	push   $0x0
+  803cd0:	56                   	push   %esi
+  803cd1:	6a 00                	push   $0x0
+  803cd3:	e8 ca cf ff ff       	call   800ca2 <sys_page_map>
+  803cd8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cda:	83 c4 20             	add    $0x20,%esp
+  803cdd:	85 c0                	test   %eax,%eax
+  803cdf:	78 24                	js     803d05 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803ce1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ce6:	89 d8                	mov    %ebx,%eax
+  803ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ceb:	5b                   	pop    %ebx
+  803cec:	5e                   	pop    %esi
+  803ced:	5f                   	pop    %edi
+  803cee:	5d                   	pop    %ebp
+  803cef:	c3                   	ret
+  803cf0:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cf2:	83 ec 08             	sub    $0x8,%esp
+  803cf5:	50                   	push   %eax
+  803cf6:	68 64 4d 80 00       	push   $0x804d64
+  803cfb:	e8 33 c5 ff ff       	call   800233 <cprintf>
+		return r;
+  803d00:	83 c4 10             	add    $0x10,%esp
+  803d03:	eb e1                	jmp    803ce6 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d05:	83 ec 08             	sub    $0x8,%esp
+  803d08:	50                   	push   %eax
+  803d09:	68 94 4d 80 00       	push   $0x804d94
+  803d0e:	e8 20 c5 ff ff       	call   800233 <cprintf>
+		return r;
+  803d13:	83 c4 10             	add    $0x10,%esp
+  803d16:	eb ce                	jmp    803ce6 <duppage_cow+0x4d>
+
+00803d18 <duppage>:
+{
+  803d18:	55                   	push   %ebp
+  803d19:	89 e5                	mov    %esp,%ebp
+  803d1b:	53                   	push   %ebx
+  803d1c:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803d1f:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803d22:	51                   	push   %ecx
+  803d23:	52                   	push   %edx
+  803d24:	50                   	push   %eax
+  803d25:	52                   	push   %edx
+  803d26:	6a 00                	push   $0x0
+  803d28:	e8 75 cf ff ff       	call   800ca2 <sys_page_map>
+	if (r < 0) {
+  803d2d:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d30:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d35:	85 c0                	test   %eax,%eax
+  803d37:	78 07                	js     803d40 <duppage+0x28>
+}
+  803d39:	89 d8                	mov    %ebx,%eax
+  803d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d3e:	c9                   	leave
+  803d3f:	c3                   	ret
+  803d40:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d42:	83 ec 08             	sub    $0x8,%esp
+  803d45:	50                   	push   %eax
+  803d46:	68 64 4d 80 00       	push   $0x804d64
+  803d4b:	e8 e3 c4 ff ff       	call   800233 <cprintf>
+		return r;
+  803d50:	83 c4 10             	add    $0x10,%esp
+  803d53:	eb e4                	jmp    803d39 <duppage+0x21>
+
+00803d55 <cow_copy>:
+{
+  803d55:	55                   	push   %ebp
+  803d56:	89 e5                	mov    %esp,%ebp
+  803d58:	56                   	push   %esi
+  803d59:	53                   	push   %ebx
+  803d5a:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d5c:	83 ec 04             	sub    $0x4,%esp
+  803d5f:	6a 07                	push   $0x7
+  803d61:	68 00 f0 7f 00       	push   $0x7ff000
+  803d66:	6a 00                	push   $0x0
+  803d68:	e8 e8 ce ff ff       	call   800c55 <sys_page_alloc>
+	if (r < 0) {
+  803d6d:	83 c4 10             	add    $0x10,%esp
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	78 58                	js     803dcc <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d74:	83 ec 04             	sub    $0x4,%esp
+  803d77:	68 00 10 00 00       	push   $0x1000
+  803d7c:	56                   	push   %esi
+  803d7d:	68 00 f0 7f 00       	push   $0x7ff000
+  803d82:	e8 16 cc ff ff       	call   80099d <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d87:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d8e:	56                   	push   %esi
+  803d8f:	6a 00                	push   $0x0
+  803d91:	68 00 f0 7f 00       	push   $0x7ff000
+  803d96:	6a 00                	push   $0x0
+  803d98:	e8 05 cf ff ff       	call   800ca2 <sys_page_map>
+  803d9d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d9f:	83 c4 20             	add    $0x20,%esp
+  803da2:	85 c0                	test   %eax,%eax
+  803da4:	78 3b                	js     803de1 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803da6:	83 ec 08             	sub    $0x8,%esp
+  803da9:	68 00 f0 7f 00       	push   $0x7ff000
+  803dae:	6a 00                	push   $0x0
+  803db0:	e8 39 cf ff ff       	call   800cee <sys_page_unmap>
+  803db5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803db7:	83 c4 10             	add    $0x10,%esp
+  803dba:	85 c0                	test   %eax,%eax
+  803dbc:	78 45                	js     803e03 <cow_copy+0xae>
+	return 0;
+  803dbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dc3:	89 d8                	mov    %ebx,%eax
+  803dc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dc8:	5b                   	pop    %ebx
+  803dc9:	5e                   	pop    %esi
+  803dca:	5d                   	pop    %ebp
+  803dcb:	c3                   	ret
+  803dcc:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803dce:	83 ec 08             	sub    $0x8,%esp
+  803dd1:	50                   	push   %eax
+  803dd2:	68 84 4e 80 00       	push   $0x804e84
+  803dd7:	e8 57 c4 ff ff       	call   800233 <cprintf>
+		return r;
+  803ddc:	83 c4 10             	add    $0x10,%esp
+  803ddf:	eb e2                	jmp    803dc3 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803de1:	83 ec 08             	sub    $0x8,%esp
+  803de4:	50                   	push   %eax
+  803de5:	68 a0 4e 80 00       	push   $0x804ea0
+  803dea:	e8 44 c4 ff ff       	call   800233 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803def:	83 c4 08             	add    $0x8,%esp
+  803df2:	68 00 f0 7f 00       	push   $0x7ff000
+  803df7:	6a 00                	push   $0x0
+  803df9:	e8 f0 ce ff ff       	call   800cee <sys_page_unmap>
+		return r;
+  803dfe:	83 c4 10             	add    $0x10,%esp
+  803e01:	eb c0                	jmp    803dc3 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e03:	83 ec 08             	sub    $0x8,%esp
+  803e06:	50                   	push   %eax
+  803e07:	68 bc 4d 80 00       	push   $0x804dbc
+  803e0c:	e8 22 c4 ff ff       	call   800233 <cprintf>
+		return r;
+  803e11:	83 c4 10             	add    $0x10,%esp
+  803e14:	eb ad                	jmp    803dc3 <cow_copy+0x6e>
+
+00803e16 <pgfault>:
+{
+  803e16:	55                   	push   %ebp
+  803e17:	89 e5                	mov    %esp,%ebp
+  803e19:	56                   	push   %esi
+  803e1a:	53                   	push   %ebx
+  803e1b:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803e1e:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803e20:	89 d8                	mov    %ebx,%eax
+  803e22:	c1 e8 16             	shr    $0x16,%eax
+  803e25:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e2c:	89 de                	mov    %ebx,%esi
+  803e2e:	c1 ee 0c             	shr    $0xc,%esi
+  803e31:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e38:	a8 07                	test   $0x7,%al
+  803e3a:	74 3b                	je     803e77 <pgfault+0x61>
+  803e3c:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e42:	74 33                	je     803e77 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e44:	83 ec 0c             	sub    $0xc,%esp
+  803e47:	68 00 f0 bf ee       	push   $0xeebff000
+  803e4c:	e8 c8 f4 ff ff       	call   803319 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e51:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e58:	83 c4 10             	add    $0x10,%esp
+  803e5b:	f6 c4 08             	test   $0x8,%ah
+  803e5e:	75 30                	jne    803e90 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e60:	83 ec 0c             	sub    $0xc,%esp
+  803e63:	68 00 f0 bf ee       	push   $0xeebff000
+  803e68:	e8 19 f5 ff ff       	call   803386 <mutex_unlock>
+}
+  803e6d:	83 c4 10             	add    $0x10,%esp
+  803e70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e73:	5b                   	pop    %ebx
+  803e74:	5e                   	pop    %esi
+  803e75:	5d                   	pop    %ebp
+  803e76:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e77:	83 ec 08             	sub    $0x8,%esp
+  803e7a:	ff 72 28             	push   0x28(%edx)
+  803e7d:	51                   	push   %ecx
+  803e7e:	50                   	push   %eax
+  803e7f:	68 e0 4d 80 00       	push   $0x804de0
+  803e84:	6a 3f                	push   $0x3f
+  803e86:	68 ba 4e 80 00       	push   $0x804eba
+  803e8b:	e8 c8 c2 ff ff       	call   800158 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e90:	89 d8                	mov    %ebx,%eax
+  803e92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e97:	e8 b9 fe ff ff       	call   803d55 <cow_copy>
+  803e9c:	eb c2                	jmp    803e60 <pgfault+0x4a>
+
+00803e9e <cow_enable>:
+{
+  803e9e:	55                   	push   %ebp
+  803e9f:	89 e5                	mov    %esp,%ebp
+  803ea1:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803ea4:	68 16 3e 80 00       	push   $0x803e16
+  803ea9:	e8 49 d2 ff ff       	call   8010f7 <set_pgfault_handler>
+}
+  803eae:	83 c4 10             	add    $0x10,%esp
+  803eb1:	c9                   	leave
+  803eb2:	c3                   	ret
+
+00803eb3 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803eb3:	55                   	push   %ebp
+  803eb4:	89 e5                	mov    %esp,%ebp
+  803eb6:	57                   	push   %edi
+  803eb7:	56                   	push   %esi
+  803eb8:	53                   	push   %ebx
+  803eb9:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ebc:	68 16 3e 80 00       	push   $0x803e16
+  803ec1:	e8 31 d2 ff ff       	call   8010f7 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803ec6:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ecb:	cd 30                	int    $0x30
+  803ecd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803ed0:	83 c4 10             	add    $0x10,%esp
+  803ed3:	85 c0                	test   %eax,%eax
+  803ed5:	78 4b                	js     803f22 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803ed7:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803edc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ee1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803ee4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803ee8:	0f 85 16 01 00 00    	jne    804004 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803eee:	e8 0a cd ff ff       	call   800bfd <sys_getenvid>
+  803ef3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ef8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803efa:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f00:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f06:	77 32                	ja     803f3a <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f08:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803f0d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f0f:	c1 ea 10             	shr    $0x10,%edx
+  803f12:	74 26                	je     803f3a <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f14:	c1 e2 10             	shl    $0x10,%edx
+  803f17:	89 d1                	mov    %edx,%ecx
+  803f19:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f1e:	29 ca                	sub    %ecx,%edx
+  803f20:	eb 1e                	jmp    803f40 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803f22:	83 ec 08             	sub    $0x8,%esp
+  803f25:	89 c7                	mov    %eax,%edi
+  803f27:	50                   	push   %eax
+  803f28:	68 c5 4e 80 00       	push   $0x804ec5
+  803f2d:	e8 01 c3 ff ff       	call   800233 <cprintf>
+		return eid;
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	e9 6c 01 00 00       	jmp    8040a6 <fork+0x1f3>
+		return pthread_main_tls;
+  803f3a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f40:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f43:	c1 e0 04             	shl    $0x4,%eax
+  803f46:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f4b:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f4d:	e8 10 fb ff ff       	call   803a62 <pthread_fork_child>
+		return eid;
+  803f52:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f55:	e9 4c 01 00 00       	jmp    8040a6 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f5a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f60:	89 da                	mov    %ebx,%edx
+  803f62:	89 f8                	mov    %edi,%eax
+  803f64:	e8 af fd ff ff       	call   803d18 <duppage>
+  803f69:	85 c0                	test   %eax,%eax
+  803f6b:	79 28                	jns    803f95 <fork+0xe2>
+  803f6d:	89 c7                	mov    %eax,%edi
+  803f6f:	e9 32 01 00 00       	jmp    8040a6 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f74:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f7a:	83 f9 05             	cmp    $0x5,%ecx
+  803f7d:	75 58                	jne    803fd7 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f7f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f84:	89 da                	mov    %ebx,%edx
+  803f86:	89 f8                	mov    %edi,%eax
+  803f88:	e8 8b fd ff ff       	call   803d18 <duppage>
+  803f8d:	85 c0                	test   %eax,%eax
+  803f8f:	0f 88 0f 01 00 00    	js     8040a4 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f95:	83 c3 01             	add    $0x1,%ebx
+  803f98:	39 de                	cmp    %ebx,%esi
+  803f9a:	74 54                	je     803ff0 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f9c:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803fa3:	f6 c1 05             	test   $0x5,%cl
+  803fa6:	74 ed                	je     803f95 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803fa8:	f6 c5 04             	test   $0x4,%ch
+  803fab:	75 ad                	jne    803f5a <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803fad:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803fb3:	74 bf                	je     803f74 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803fb5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803fbb:	74 d8                	je     803f95 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803fbd:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803fc3:	89 da                	mov    %ebx,%edx
+  803fc5:	89 f8                	mov    %edi,%eax
+  803fc7:	e8 cd fc ff ff       	call   803c99 <duppage_cow>
+  803fcc:	85 c0                	test   %eax,%eax
+  803fce:	79 c5                	jns    803f95 <fork+0xe2>
+  803fd0:	89 c7                	mov    %eax,%edi
+  803fd2:	e9 cf 00 00 00       	jmp    8040a6 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fd7:	68 10 4e 80 00       	push   $0x804e10
+  803fdc:	68 1d 4c 80 00       	push   $0x804c1d
+  803fe1:	68 c6 00 00 00       	push   $0xc6
+  803fe6:	68 ba 4e 80 00       	push   $0x804eba
+  803feb:	e8 68 c1 ff ff       	call   800158 <_panic>
+  803ff0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803ff3:	83 c1 01             	add    $0x1,%ecx
+  803ff6:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803ffc:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804002:	74 18                	je     80401c <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804004:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80400b:	a8 07                	test   $0x7,%al
+  80400d:	74 e4                	je     803ff3 <fork+0x140>
+  80400f:	89 cb                	mov    %ecx,%ebx
+  804011:	c1 e3 0a             	shl    $0xa,%ebx
+  804014:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804017:	e9 7c ff ff ff       	jmp    803f98 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80401c:	83 ec 04             	sub    $0x4,%esp
+  80401f:	6a 07                	push   $0x7
+  804021:	68 00 f0 bf ee       	push   $0xeebff000
+  804026:	ff 75 e4             	push   -0x1c(%ebp)
+  804029:	e8 27 cc ff ff       	call   800c55 <sys_page_alloc>
+  80402e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804030:	83 c4 10             	add    $0x10,%esp
+  804033:	85 c0                	test   %eax,%eax
+  804035:	78 34                	js     80406b <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804037:	83 ec 08             	sub    $0x8,%esp
+  80403a:	68 35 11 80 00       	push   $0x801135
+  80403f:	ff 75 e4             	push   -0x1c(%ebp)
+  804042:	e8 8b cd ff ff       	call   800dd2 <sys_env_set_pgfault_upcall>
+  804047:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804049:	83 c4 10             	add    $0x10,%esp
+  80404c:	85 c0                	test   %eax,%eax
+  80404e:	78 2e                	js     80407e <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804050:	83 ec 08             	sub    $0x8,%esp
+  804053:	6a 02                	push   $0x2
+  804055:	ff 75 e4             	push   -0x1c(%ebp)
+  804058:	e8 dd cc ff ff       	call   800d3a <sys_env_set_status>
+  80405d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80405f:	83 c4 10             	add    $0x10,%esp
+  804062:	85 c0                	test   %eax,%eax
+  804064:	78 2b                	js     804091 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804066:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804069:	eb 3b                	jmp    8040a6 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80406b:	83 ec 08             	sub    $0x8,%esp
+  80406e:	50                   	push   %eax
+  80406f:	68 38 4e 80 00       	push   $0x804e38
+  804074:	e8 ba c1 ff ff       	call   800233 <cprintf>
+		return r;
+  804079:	83 c4 10             	add    $0x10,%esp
+  80407c:	eb 28                	jmp    8040a6 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80407e:	83 ec 08             	sub    $0x8,%esp
+  804081:	50                   	push   %eax
+  804082:	68 60 4e 80 00       	push   $0x804e60
+  804087:	e8 a7 c1 ff ff       	call   800233 <cprintf>
+		return r;
+  80408c:	83 c4 10             	add    $0x10,%esp
+  80408f:	eb 15                	jmp    8040a6 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804091:	83 ec 08             	sub    $0x8,%esp
+  804094:	50                   	push   %eax
+  804095:	68 d5 4e 80 00       	push   $0x804ed5
+  80409a:	e8 94 c1 ff ff       	call   800233 <cprintf>
+		return r;
+  80409f:	83 c4 10             	add    $0x10,%esp
+  8040a2:	eb 02                	jmp    8040a6 <fork+0x1f3>
+  8040a4:	89 c7                	mov    %eax,%edi
+}
+  8040a6:	89 f8                	mov    %edi,%eax
+  8040a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040ab:	5b                   	pop    %ebx
+  8040ac:	5e                   	pop    %esi
+  8040ad:	5f                   	pop    %edi
+  8040ae:	5d                   	pop    %ebp
+  8040af:	c3                   	ret
+
+008040b0 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8040b0:	55                   	push   %ebp
+  8040b1:	89 e5                	mov    %esp,%ebp
+  8040b3:	57                   	push   %edi
+  8040b4:	56                   	push   %esi
+  8040b5:	53                   	push   %ebx
+  8040b6:	83 ec 2c             	sub    $0x2c,%esp
+  8040b9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040bb:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8040c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040c6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040cc:	77 0a                	ja     8040d8 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040ce:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8040d3:	29 c3                	sub    %eax,%ebx
+  8040d5:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040d8:	83 ec 0c             	sub    $0xc,%esp
+  8040db:	68 16 3e 80 00       	push   $0x803e16
+  8040e0:	e8 12 d0 ff ff       	call   8010f7 <set_pgfault_handler>
+  8040e5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040ea:	cd 30                	int    $0x30
+  8040ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040ef:	83 c4 10             	add    $0x10,%esp
+  8040f2:	85 c0                	test   %eax,%eax
+  8040f4:	78 30                	js     804126 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040f6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8040fa:	74 42                	je     80413e <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040fc:	c1 e3 10             	shl    $0x10,%ebx
+  8040ff:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804104:	29 d8                	sub    %ebx,%eax
+  804106:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804109:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80410e:	29 d8                	sub    %ebx,%eax
+  804110:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804113:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411d:	89 f7                	mov    %esi,%edi
+  80411f:	89 d6                	mov    %edx,%esi
+  804121:	e9 2c 01 00 00       	jmp    804252 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804126:	83 ec 08             	sub    $0x8,%esp
+  804129:	89 c7                	mov    %eax,%edi
+  80412b:	50                   	push   %eax
+  80412c:	68 c5 4e 80 00       	push   $0x804ec5
+  804131:	e8 fd c0 ff ff       	call   800233 <cprintf>
+		return eid;
+  804136:	83 c4 10             	add    $0x10,%esp
+  804139:	e9 d5 00 00 00       	jmp    804213 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80413e:	e8 ba ca ff ff       	call   800bfd <sys_getenvid>
+  804143:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804148:	89 c2                	mov    %eax,%edx
+  80414a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80414c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804152:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804157:	77 18                	ja     804171 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804159:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80415e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804160:	c1 e8 10             	shr    $0x10,%eax
+  804163:	74 0c                	je     804171 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804165:	c1 e0 10             	shl    $0x10,%eax
+  804168:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80416d:	29 c1                	sub    %eax,%ecx
+  80416f:	eb 06                	jmp    804177 <sfork+0xc7>
+		return pthread_main_tls;
+  804171:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804177:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80417a:	c1 e0 04             	shl    $0x4,%eax
+  80417d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804182:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804184:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804187:	e9 87 00 00 00       	jmp    804213 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80418c:	f6 c5 04             	test   $0x4,%ch
+  80418f:	74 6c                	je     8041fd <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804191:	89 ca                	mov    %ecx,%edx
+  804193:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804199:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80419f:	74 7c                	je     80421d <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041a1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041a7:	89 da                	mov    %ebx,%edx
+  8041a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041ac:	e8 67 fb ff ff       	call   803d18 <duppage>
+  8041b1:	85 c0                	test   %eax,%eax
+  8041b3:	0f 88 4f 01 00 00    	js     804308 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8041b9:	83 c3 01             	add    $0x1,%ebx
+  8041bc:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8041bf:	74 7a                	je     80423b <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8041c1:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8041c3:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8041ca:	f6 c1 01             	test   $0x1,%cl
+  8041cd:	74 ea                	je     8041b9 <sfork+0x109>
+  8041cf:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041d5:	74 e2                	je     8041b9 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041d7:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041dd:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041e0:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041e5:	76 a5                	jbe    80418c <sfork+0xdc>
+  8041e7:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041ed:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041f0:	39 fa                	cmp    %edi,%edx
+  8041f2:	73 9d                	jae    804191 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041f4:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8041f7:	39 fa                	cmp    %edi,%edx
+  8041f9:	72 96                	jb     804191 <sfork+0xe1>
+  8041fb:	eb 8f                	jmp    80418c <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041fd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804203:	89 da                	mov    %ebx,%edx
+  804205:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804208:	e8 8c fa ff ff       	call   803c99 <duppage_cow>
+  80420d:	85 c0                	test   %eax,%eax
+  80420f:	79 a8                	jns    8041b9 <sfork+0x109>
+  804211:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804213:	89 f8                	mov    %edi,%eax
+  804215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804218:	5b                   	pop    %ebx
+  804219:	5e                   	pop    %esi
+  80421a:	5f                   	pop    %edi
+  80421b:	5d                   	pop    %ebp
+  80421c:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80421d:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804222:	e8 2e fb ff ff       	call   803d55 <cow_copy>
+  804227:	85 c0                	test   %eax,%eax
+  804229:	0f 88 d2 00 00 00    	js     804301 <sfork+0x251>
+				pte = uvpt[pn];
+  80422f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804236:	e9 66 ff ff ff       	jmp    8041a1 <sfork+0xf1>
+  80423b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80423e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804241:	83 c6 01             	add    $0x1,%esi
+  804244:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80424a:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804250:	74 1b                	je     80426d <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804252:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804259:	a8 01                	test   $0x1,%al
+  80425b:	74 e4                	je     804241 <sfork+0x191>
+  80425d:	89 f3                	mov    %esi,%ebx
+  80425f:	c1 e3 0a             	shl    $0xa,%ebx
+  804262:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804265:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804268:	e9 4f ff ff ff       	jmp    8041bc <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80426d:	83 ec 04             	sub    $0x4,%esp
+  804270:	6a 07                	push   $0x7
+  804272:	68 00 f0 bf ee       	push   $0xeebff000
+  804277:	ff 75 e0             	push   -0x20(%ebp)
+  80427a:	e8 d6 c9 ff ff       	call   800c55 <sys_page_alloc>
+  80427f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804281:	83 c4 10             	add    $0x10,%esp
+  804284:	85 c0                	test   %eax,%eax
+  804286:	78 37                	js     8042bf <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804288:	83 ec 08             	sub    $0x8,%esp
+  80428b:	68 35 11 80 00       	push   $0x801135
+  804290:	ff 75 e0             	push   -0x20(%ebp)
+  804293:	e8 3a cb ff ff       	call   800dd2 <sys_env_set_pgfault_upcall>
+  804298:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80429a:	83 c4 10             	add    $0x10,%esp
+  80429d:	85 c0                	test   %eax,%eax
+  80429f:	78 34                	js     8042d5 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8042a1:	83 ec 08             	sub    $0x8,%esp
+  8042a4:	6a 02                	push   $0x2
+  8042a6:	ff 75 e0             	push   -0x20(%ebp)
+  8042a9:	e8 8c ca ff ff       	call   800d3a <sys_env_set_status>
+  8042ae:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042b0:	83 c4 10             	add    $0x10,%esp
+  8042b3:	85 c0                	test   %eax,%eax
+  8042b5:	78 34                	js     8042eb <sfork+0x23b>
+	return eid;
+  8042b7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8042ba:	e9 54 ff ff ff       	jmp    804213 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8042bf:	83 ec 08             	sub    $0x8,%esp
+  8042c2:	50                   	push   %eax
+  8042c3:	68 38 4e 80 00       	push   $0x804e38
+  8042c8:	e8 66 bf ff ff       	call   800233 <cprintf>
+		return r;
+  8042cd:	83 c4 10             	add    $0x10,%esp
+  8042d0:	e9 3e ff ff ff       	jmp    804213 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042d5:	83 ec 08             	sub    $0x8,%esp
+  8042d8:	50                   	push   %eax
+  8042d9:	68 60 4e 80 00       	push   $0x804e60
+  8042de:	e8 50 bf ff ff       	call   800233 <cprintf>
+		return r;
+  8042e3:	83 c4 10             	add    $0x10,%esp
+  8042e6:	e9 28 ff ff ff       	jmp    804213 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042eb:	83 ec 08             	sub    $0x8,%esp
+  8042ee:	50                   	push   %eax
+  8042ef:	68 d5 4e 80 00       	push   $0x804ed5
+  8042f4:	e8 3a bf ff ff       	call   800233 <cprintf>
+		return r;
+  8042f9:	83 c4 10             	add    $0x10,%esp
+  8042fc:	e9 12 ff ff ff       	jmp    804213 <sfork+0x163>
+  804301:	89 c7                	mov    %eax,%edi
+  804303:	e9 0b ff ff ff       	jmp    804213 <sfork+0x163>
+  804308:	89 c7                	mov    %eax,%edi
+  80430a:	e9 04 ff ff ff       	jmp    804213 <sfork+0x163>
+
+0080430f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80430f:	55                   	push   %ebp
+  804310:	89 e5                	mov    %esp,%ebp
+  804312:	57                   	push   %edi
+  804313:	56                   	push   %esi
+  804314:	53                   	push   %ebx
+  804315:	83 ec 18             	sub    $0x18,%esp
+  804318:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80431b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80431e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804321:	85 c0                	test   %eax,%eax
+  804323:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804328:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80432b:	50                   	push   %eax
+  80432c:	e8 1a cb ff ff       	call   800e4b <sys_ipc_recv>
+	if (r < 0) {
+  804331:	83 c4 10             	add    $0x10,%esp
+  804334:	85 c0                	test   %eax,%eax
+  804336:	78 2b                	js     804363 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804338:	85 ff                	test   %edi,%edi
+  80433a:	74 55                	je     804391 <ipc_recv+0x82>
+  80433c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80433e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804344:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804349:	77 39                	ja     804384 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80434b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804350:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804352:	c1 e8 10             	shr    $0x10,%eax
+  804355:	74 2d                	je     804384 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804357:	c1 e0 10             	shl    $0x10,%eax
+  80435a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80435f:	29 c2                	sub    %eax,%edx
+  804361:	eb 27                	jmp    80438a <ipc_recv+0x7b>
+  804363:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804365:	83 ec 08             	sub    $0x8,%esp
+  804368:	50                   	push   %eax
+  804369:	68 f3 4e 80 00       	push   $0x804ef3
+  80436e:	e8 c0 be ff ff       	call   800233 <cprintf>
+		*from_env_store = 0;
+  804373:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804379:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80437f:	83 c4 10             	add    $0x10,%esp
+  804382:	eb 77                	jmp    8043fb <ipc_recv+0xec>
+		return pthread_main_tls;
+  804384:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80438a:	8b 02                	mov    (%edx),%eax
+  80438c:	8b 40 78             	mov    0x78(%eax),%eax
+  80438f:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804391:	85 f6                	test   %esi,%esi
+  804393:	74 34                	je     8043c9 <ipc_recv+0xba>
+  804395:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804397:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80439d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043a2:	77 18                	ja     8043bc <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043ab:	c1 e8 10             	shr    $0x10,%eax
+  8043ae:	74 0c                	je     8043bc <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043b0:	c1 e0 10             	shl    $0x10,%eax
+  8043b3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043b8:	29 c2                	sub    %eax,%edx
+  8043ba:	eb 06                	jmp    8043c2 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8043bc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8043c2:	8b 02                	mov    (%edx),%eax
+  8043c4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043c7:	89 06                	mov    %eax,(%esi)
+  8043c9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043cb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043d1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043d6:	77 18                	ja     8043f0 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043d8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043dd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043df:	c1 e8 10             	shr    $0x10,%eax
+  8043e2:	74 0c                	je     8043f0 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043e4:	c1 e0 10             	shl    $0x10,%eax
+  8043e7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043ec:	29 c2                	sub    %eax,%edx
+  8043ee:	eb 06                	jmp    8043f6 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043f0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043f6:	8b 02                	mov    (%edx),%eax
+  8043f8:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043fb:	89 d8                	mov    %ebx,%eax
+  8043fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804400:	5b                   	pop    %ebx
+  804401:	5e                   	pop    %esi
+  804402:	5f                   	pop    %edi
+  804403:	5d                   	pop    %ebp
+  804404:	c3                   	ret
+
+00804405 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804405:	55                   	push   %ebp
+  804406:	89 e5                	mov    %esp,%ebp
+  804408:	57                   	push   %edi
+  804409:	56                   	push   %esi
+  80440a:	53                   	push   %ebx
+  80440b:	83 ec 0c             	sub    $0xc,%esp
+  80440e:	8b 75 08             	mov    0x8(%ebp),%esi
+  804411:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804414:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804417:	85 db                	test   %ebx,%ebx
+  804419:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80441e:	0f 44 d8             	cmove  %eax,%ebx
+  804421:	eb 05                	jmp    804428 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804423:	e8 01 c8 ff ff       	call   800c29 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804428:	57                   	push   %edi
+  804429:	53                   	push   %ebx
+  80442a:	ff 75 0c             	push   0xc(%ebp)
+  80442d:	56                   	push   %esi
+  80442e:	e8 eb c9 ff ff       	call   800e1e <sys_ipc_try_send>
+		if (r == 0) {
+  804433:	83 c4 10             	add    $0x10,%esp
+  804436:	85 c0                	test   %eax,%eax
+  804438:	74 19                	je     804453 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80443a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80443d:	74 e4                	je     804423 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80443f:	83 ec 0c             	sub    $0xc,%esp
+  804442:	50                   	push   %eax
+  804443:	57                   	push   %edi
+  804444:	53                   	push   %ebx
+  804445:	56                   	push   %esi
+  804446:	68 0c 4f 80 00       	push   $0x804f0c
+  80444b:	e8 e3 bd ff ff       	call   800233 <cprintf>
+			return;
+  804450:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804456:	5b                   	pop    %ebx
+  804457:	5e                   	pop    %esi
+  804458:	5f                   	pop    %edi
+  804459:	5d                   	pop    %ebp
+  80445a:	c3                   	ret
+
+0080445b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80445b:	55                   	push   %ebp
+  80445c:	89 e5                	mov    %esp,%ebp
+  80445e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804461:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804466:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804469:	c1 e0 04             	shl    $0x4,%eax
+  80446c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804471:	8b 40 50             	mov    0x50(%eax),%eax
+  804474:	39 c8                	cmp    %ecx,%eax
+  804476:	74 12                	je     80448a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804478:	83 c2 01             	add    $0x1,%edx
+  80447b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804481:	75 e3                	jne    804466 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+  804488:	eb 0e                	jmp    804498 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80448a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80448d:	c1 e0 04             	shl    $0x4,%eax
+  804490:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804495:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804498:	5d                   	pop    %ebp
+  804499:	c3                   	ret
+
+0080449a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80449a:	55                   	push   %ebp
+  80449b:	89 e5                	mov    %esp,%ebp
+  80449d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044a0:	89 c2                	mov    %eax,%edx
+  8044a2:	c1 ea 16             	shr    $0x16,%edx
+  8044a5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044ac:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044b1:	f6 c1 01             	test   $0x1,%cl
+  8044b4:	74 1c                	je     8044d2 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044b6:	c1 e8 0c             	shr    $0xc,%eax
+  8044b9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044c0:	a8 01                	test   $0x1,%al
+  8044c2:	74 0e                	je     8044d2 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044c4:	c1 e8 0c             	shr    $0xc,%eax
+  8044c7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044ce:	ef 
+  8044cf:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044d2:	89 d0                	mov    %edx,%eax
+  8044d4:	5d                   	pop    %ebp
+  8044d5:	c3                   	ret
+
+008044d6 <udm>:
+  8044d6:	57                   	push   %edi
+  8044d7:	56                   	push   %esi
+  8044d8:	53                   	push   %ebx
+  8044d9:	83 ec 20             	sub    $0x20,%esp
+  8044dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044e4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044e8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044ec:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044f0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044f4:	89 d1                	mov    %edx,%ecx
+  8044f6:	09 c1                	or     %eax,%ecx
+  8044f8:	0f 84 91 00 00 00    	je     80458f <udm+0xb9>
+  8044fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804503:	ba 00 00 00 00       	mov    $0x0,%edx
+  804508:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80450d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804514:	00 
+  804515:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80451c:	00 
+  80451d:	eb 08                	jmp    804527 <udm+0x51>
+  80451f:	83 e9 01             	sub    $0x1,%ecx
+  804522:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804525:	74 7c                	je     8045a3 <udm+0xcd>
+  804527:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80452b:	01 c0                	add    %eax,%eax
+  80452d:	89 c6                	mov    %eax,%esi
+  80452f:	89 d7                	mov    %edx,%edi
+  804531:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804535:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804539:	0f ad d0             	shrd   %cl,%edx,%eax
+  80453c:	d3 ea                	shr    %cl,%edx
+  80453e:	f6 c1 20             	test   $0x20,%cl
+  804541:	74 04                	je     804547 <udm+0x71>
+  804543:	89 d0                	mov    %edx,%eax
+  804545:	31 d2                	xor    %edx,%edx
+  804547:	83 e0 01             	and    $0x1,%eax
+  80454a:	89 04 24             	mov    %eax,(%esp)
+  80454d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804554:	00 
+  804555:	8b 04 24             	mov    (%esp),%eax
+  804558:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80455c:	09 f0                	or     %esi,%eax
+  80455e:	09 fa                	or     %edi,%edx
+  804560:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804564:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804568:	39 f0                	cmp    %esi,%eax
+  80456a:	89 d3                	mov    %edx,%ebx
+  80456c:	19 fb                	sbb    %edi,%ebx
+  80456e:	72 af                	jb     80451f <udm+0x49>
+  804570:	29 f0                	sub    %esi,%eax
+  804572:	19 fa                	sbb    %edi,%edx
+  804574:	89 cf                	mov    %ecx,%edi
+  804576:	c1 ef 05             	shr    $0x5,%edi
+  804579:	83 e7 01             	and    $0x1,%edi
+  80457c:	89 fe                	mov    %edi,%esi
+  80457e:	83 f6 01             	xor    $0x1,%esi
+  804581:	d3 e6                	shl    %cl,%esi
+  804583:	d3 e7                	shl    %cl,%edi
+  804585:	09 74 24 18          	or     %esi,0x18(%esp)
+  804589:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80458d:	eb 90                	jmp    80451f <udm+0x49>
+  80458f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804593:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804597:	89 f0                	mov    %esi,%eax
+  804599:	89 fa                	mov    %edi,%edx
+  80459b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80459f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045a3:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045a7:	89 01                	mov    %eax,(%ecx)
+  8045a9:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045b4:	83 c4 20             	add    $0x20,%esp
+  8045b7:	5b                   	pop    %ebx
+  8045b8:	5e                   	pop    %esi
+  8045b9:	5f                   	pop    %edi
+  8045ba:	c3                   	ret
+
+008045bb <__udivdi3>:
+  8045bb:	83 ec 18             	sub    $0x18,%esp
+  8045be:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045c2:	50                   	push   %eax
+  8045c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8045c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8045cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045d3:	e8 fe fe ff ff       	call   8044d6 <udm>
+  8045d8:	83 c4 24             	add    $0x24,%esp
+  8045db:	c3                   	ret
+
+008045dc <__umoddi3>:
+  8045dc:	83 ec 18             	sub    $0x18,%esp
+  8045df:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045e3:	50                   	push   %eax
+  8045e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8045e8:	ff 74 24 2c          	push   0x2c(%esp)
+  8045ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045f0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045f4:	e8 dd fe ff ff       	call   8044d6 <udm>
+  8045f9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045fd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804601:	83 c4 24             	add    $0x24,%esp
+  804604:	c3                   	ret
+
+00804605 <__divdi3>:
+  804605:	56                   	push   %esi
+  804606:	53                   	push   %ebx
+  804607:	83 ec 14             	sub    $0x14,%esp
+  80460a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80460e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804612:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804616:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80461a:	85 d2                	test   %edx,%edx
+  80461c:	78 18                	js     804636 <__divdi3+0x31>
+  80461e:	85 db                	test   %ebx,%ebx
+  804620:	78 3e                	js     804660 <__divdi3+0x5b>
+  804622:	83 ec 04             	sub    $0x4,%esp
+  804625:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804629:	56                   	push   %esi
+  80462a:	53                   	push   %ebx
+  80462b:	51                   	push   %ecx
+  80462c:	e8 a5 fe ff ff       	call   8044d6 <udm>
+  804631:	83 c4 10             	add    $0x10,%esp
+  804634:	eb 24                	jmp    80465a <__divdi3+0x55>
+  804636:	f7 d8                	neg    %eax
+  804638:	83 d2 00             	adc    $0x0,%edx
+  80463b:	f7 da                	neg    %edx
+  80463d:	85 db                	test   %ebx,%ebx
+  80463f:	78 3a                	js     80467b <__divdi3+0x76>
+  804641:	83 ec 04             	sub    $0x4,%esp
+  804644:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804648:	56                   	push   %esi
+  804649:	53                   	push   %ebx
+  80464a:	51                   	push   %ecx
+  80464b:	e8 86 fe ff ff       	call   8044d6 <udm>
+  804650:	83 c4 10             	add    $0x10,%esp
+  804653:	f7 d8                	neg    %eax
+  804655:	83 d2 00             	adc    $0x0,%edx
+  804658:	f7 da                	neg    %edx
+  80465a:	83 c4 14             	add    $0x14,%esp
+  80465d:	5b                   	pop    %ebx
+  80465e:	5e                   	pop    %esi
+  80465f:	c3                   	ret
+  804660:	83 ec 04             	sub    $0x4,%esp
+  804663:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804667:	56                   	push   %esi
+  804668:	f7 d9                	neg    %ecx
+  80466a:	83 d3 00             	adc    $0x0,%ebx
+  80466d:	f7 db                	neg    %ebx
+  80466f:	53                   	push   %ebx
+  804670:	51                   	push   %ecx
+  804671:	e8 60 fe ff ff       	call   8044d6 <udm>
+  804676:	83 c4 10             	add    $0x10,%esp
+  804679:	eb d8                	jmp    804653 <__divdi3+0x4e>
+  80467b:	83 ec 04             	sub    $0x4,%esp
+  80467e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804682:	56                   	push   %esi
+  804683:	f7 d9                	neg    %ecx
+  804685:	83 d3 00             	adc    $0x0,%ebx
+  804688:	f7 db                	neg    %ebx
+  80468a:	53                   	push   %ebx
+  80468b:	51                   	push   %ecx
+  80468c:	e8 45 fe ff ff       	call   8044d6 <udm>
+  804691:	83 c4 10             	add    $0x10,%esp
+  804694:	eb c4                	jmp    80465a <__divdi3+0x55>
+
+00804696 <__moddi3>:
+  804696:	55                   	push   %ebp
+  804697:	57                   	push   %edi
+  804698:	56                   	push   %esi
+  804699:	53                   	push   %ebx
+  80469a:	83 ec 24             	sub    $0x24,%esp
+  80469d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046a1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046a5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046a9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046ad:	85 d2                	test   %edx,%edx
+  8046af:	78 3b                	js     8046ec <__moddi3+0x56>
+  8046b1:	83 ec 04             	sub    $0x4,%esp
+  8046b4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046b8:	56                   	push   %esi
+  8046b9:	89 ce                	mov    %ecx,%esi
+  8046bb:	f7 de                	neg    %esi
+  8046bd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046c1:	89 de                	mov    %ebx,%esi
+  8046c3:	83 d6 00             	adc    $0x0,%esi
+  8046c6:	f7 de                	neg    %esi
+  8046c8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046d0:	0f 48 f1             	cmovs  %ecx,%esi
+  8046d3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046d8:	53                   	push   %ebx
+  8046d9:	56                   	push   %esi
+  8046da:	e8 f7 fd ff ff       	call   8044d6 <udm>
+  8046df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046e7:	83 c4 10             	add    $0x10,%esp
+  8046ea:	eb 47                	jmp    804733 <__moddi3+0x9d>
+  8046ec:	f7 d8                	neg    %eax
+  8046ee:	83 d2 00             	adc    $0x0,%edx
+  8046f1:	f7 da                	neg    %edx
+  8046f3:	83 ec 04             	sub    $0x4,%esp
+  8046f6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046fa:	56                   	push   %esi
+  8046fb:	89 cf                	mov    %ecx,%edi
+  8046fd:	f7 df                	neg    %edi
+  8046ff:	89 de                	mov    %ebx,%esi
+  804701:	83 d6 00             	adc    $0x0,%esi
+  804704:	f7 de                	neg    %esi
+  804706:	0f 49 cf             	cmovns %edi,%ecx
+  804709:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80470d:	0f 49 de             	cmovns %esi,%ebx
+  804710:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804714:	ff 74 24 0c          	push   0xc(%esp)
+  804718:	ff 74 24 0c          	push   0xc(%esp)
+  80471c:	e8 b5 fd ff ff       	call   8044d6 <udm>
+  804721:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804725:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804729:	f7 d8                	neg    %eax
+  80472b:	83 d2 00             	adc    $0x0,%edx
+  80472e:	f7 da                	neg    %edx
+  804730:	83 c4 10             	add    $0x10,%esp
+  804733:	83 c4 24             	add    $0x24,%esp
+  804736:	5b                   	pop    %ebx
+  804737:	5e                   	pop    %esi
+  804738:	5f                   	pop    %edi
+  804739:	5d                   	pop    %ebp
+  80473a:	c3                   	ret
@@ -0,0 +1,9696 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 bb 01 00 00       	call   800202 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 ef be ad de       	push   $0xdeadbeef
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 29 03 00 00       	call   80037f <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	57                   	push   %edi
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	83 ec 1c             	sub    $0x1c,%esp
+  80006e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800071:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800074:	e8 31 01 00 00       	call   8001aa <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800079:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80007c:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800082:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800087:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800089:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80008b:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800091:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800096:	77 16                	ja     8000ae <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800098:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80009d:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80009f:	c1 e8 10             	shr    $0x10,%eax
+  8000a2:	74 0a                	je     8000ae <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000a4:	c1 e0 10             	shl    $0x10,%eax
+  8000a7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000ac:	29 c2                	sub    %eax,%edx
+  8000ae:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000b1:	c1 e0 04             	shl    $0x4,%eax
+  8000b4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b9:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bb:	85 db                	test   %ebx,%ebx
+  8000bd:	7e 07                	jle    8000c6 <libmain+0x61>
+		binaryname = argv[0];
+  8000bf:	8b 06                	mov    (%esi),%eax
+  8000c1:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c6:	83 ec 08             	sub    $0x8,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	53                   	push   %ebx
+  8000cb:	e8 63 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d0:	e8 0b 00 00 00       	call   8000e0 <exit>
+}
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000db:	5b                   	pop    %ebx
+  8000dc:	5e                   	pop    %esi
+  8000dd:	5f                   	pop    %edi
+  8000de:	5d                   	pop    %ebp
+  8000df:	c3                   	ret
+
+008000e0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e0:	55                   	push   %ebp
+  8000e1:	89 e5                	mov    %esp,%ebp
+  8000e3:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000e6:	6a 00                	push   $0x0
+  8000e8:	e8 12 17 00 00       	call   8017ff <fflush>
+	pthread_kill_others();
+  8000ed:	e8 7d 2d 00 00       	call   802e6f <pthread_kill_others>
+	close_all();
+  8000f2:	e8 ab 07 00 00       	call   8008a2 <close_all>
+	sys_env_destroy(0);
+  8000f7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000fe:	e8 5c 00 00 00       	call   80015f <sys_env_destroy>
+}
+  800103:	83 c4 10             	add    $0x10,%esp
+  800106:	c9                   	leave
+  800107:	c3                   	ret
+
+00800108 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	57                   	push   %edi
+  80010c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800112:	8b 55 08             	mov    0x8(%ebp),%edx
+  800115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800118:	89 c3                	mov    %eax,%ebx
+  80011a:	89 c7                	mov    %eax,%edi
+  80011c:	6a 00                	push   $0x0
+  80011e:	55                   	push   %ebp
+  80011f:	56                   	push   %esi
+  800120:	89 e5                	mov    %esp,%ebp
+  800122:	8d 35 2a 01 80 00    	lea    0x80012a,%esi
+  800128:	0f 34                	sysenter
+
+0080012a <after_sysenter_label_47>:
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80012f:	5b                   	pop    %ebx
+  800130:	5f                   	pop    %edi
+  800131:	5d                   	pop    %ebp
+  800132:	c3                   	ret
+
+00800133 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800133:	55                   	push   %ebp
+  800134:	89 e5                	mov    %esp,%ebp
+  800136:	57                   	push   %edi
+  800137:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800142:	89 d1                	mov    %edx,%ecx
+  800144:	89 d3                	mov    %edx,%ebx
+  800146:	89 d7                	mov    %edx,%edi
+  800148:	6a 00                	push   $0x0
+  80014a:	55                   	push   %ebp
+  80014b:	56                   	push   %esi
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	8d 35 56 01 80 00    	lea    0x800156,%esi
+  800154:	0f 34                	sysenter
+
+00800156 <after_sysenter_label_128>:
+  800156:	5e                   	pop    %esi
+  800157:	5d                   	pop    %ebp
+  800158:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80015b:	5b                   	pop    %ebx
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	57                   	push   %edi
+  800163:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800164:	8b 55 08             	mov    0x8(%ebp),%edx
+  800167:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80016c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800171:	89 cb                	mov    %ecx,%ebx
+  800173:	89 cf                	mov    %ecx,%edi
+  800175:	6a 00                	push   $0x0
+  800177:	55                   	push   %ebp
+  800178:	56                   	push   %esi
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	8d 35 83 01 80 00    	lea    0x800183,%esi
+  800181:	0f 34                	sysenter
+
+00800183 <after_sysenter_label_212>:
+  800183:	5e                   	pop    %esi
+  800184:	5d                   	pop    %ebp
+  800185:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	7f 07                	jg     800193 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80018c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80018f:	5b                   	pop    %ebx
+  800190:	5f                   	pop    %edi
+  800191:	5d                   	pop    %ebp
+  800192:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800193:	83 ec 0c             	sub    $0xc,%esp
+  800196:	50                   	push   %eax
+  800197:	6a 03                	push   $0x3
+  800199:	68 0a 47 80 00       	push   $0x80470a
+  80019e:	6a 54                	push   $0x54
+  8001a0:	68 27 47 80 00       	push   $0x804727
+  8001a5:	e8 38 30 00 00       	call   8031e2 <_panic>
+
+008001aa <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	57                   	push   %edi
+  8001ae:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 d3                	mov    %edx,%ebx
+  8001bd:	89 d7                	mov    %edx,%edi
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	55                   	push   %ebp
+  8001c2:	56                   	push   %esi
+  8001c3:	89 e5                	mov    %esp,%ebp
+  8001c5:	8d 35 cd 01 80 00    	lea    0x8001cd,%esi
+  8001cb:	0f 34                	sysenter
+
+008001cd <after_sysenter_label_309>:
+  8001cd:	5e                   	pop    %esi
+  8001ce:	5d                   	pop    %ebp
+  8001cf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5f                   	pop    %edi
+  8001d4:	5d                   	pop    %ebp
+  8001d5:	c3                   	ret
+
+008001d6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001d6:	55                   	push   %ebp
+  8001d7:	89 e5                	mov    %esp,%ebp
+  8001d9:	57                   	push   %edi
+  8001da:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001e5:	89 d1                	mov    %edx,%ecx
+  8001e7:	89 d3                	mov    %edx,%ebx
+  8001e9:	89 d7                	mov    %edx,%edi
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	55                   	push   %ebp
+  8001ee:	56                   	push   %esi
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	8d 35 f9 01 80 00    	lea    0x8001f9,%esi
+  8001f7:	0f 34                	sysenter
+
+008001f9 <after_sysenter_label_391>:
+  8001f9:	5e                   	pop    %esi
+  8001fa:	5d                   	pop    %ebp
+  8001fb:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5f                   	pop    %edi
+  800200:	5d                   	pop    %ebp
+  800201:	c3                   	ret
+
+00800202 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	57                   	push   %edi
+  800206:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80020a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800212:	bf 00 00 00 00       	mov    $0x0,%edi
+  800217:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80021a:	6a 00                	push   $0x0
+  80021c:	55                   	push   %ebp
+  80021d:	56                   	push   %esi
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	8d 35 28 02 80 00    	lea    0x800228,%esi
+  800226:	0f 34                	sysenter
+
+00800228 <after_sysenter_label_479>:
+  800228:	5e                   	pop    %esi
+  800229:	5d                   	pop    %ebp
+  80022a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80022d:	85 c0                	test   %eax,%eax
+  80022f:	7f 07                	jg     800238 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800231:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800234:	5b                   	pop    %ebx
+  800235:	5f                   	pop    %edi
+  800236:	5d                   	pop    %ebp
+  800237:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	50                   	push   %eax
+  80023c:	6a 04                	push   $0x4
+  80023e:	68 0a 47 80 00       	push   $0x80470a
+  800243:	6a 54                	push   $0x54
+  800245:	68 27 47 80 00       	push   $0x804727
+  80024a:	e8 93 2f 00 00       	call   8031e2 <_panic>
+
+0080024f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	57                   	push   %edi
+  800253:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800254:	8b 55 08             	mov    0x8(%ebp),%edx
+  800257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80025a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80025f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800262:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800265:	ff 75 18             	push   0x18(%ebp)
+  800268:	55                   	push   %ebp
+  800269:	56                   	push   %esi
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	8d 35 74 02 80 00    	lea    0x800274,%esi
+  800272:	0f 34                	sysenter
+
+00800274 <after_sysenter_label_593>:
+  800274:	5e                   	pop    %esi
+  800275:	5d                   	pop    %ebp
+  800276:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800279:	85 c0                	test   %eax,%eax
+  80027b:	7f 07                	jg     800284 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80027d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800280:	5b                   	pop    %ebx
+  800281:	5f                   	pop    %edi
+  800282:	5d                   	pop    %ebp
+  800283:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800284:	83 ec 0c             	sub    $0xc,%esp
+  800287:	50                   	push   %eax
+  800288:	6a 05                	push   $0x5
+  80028a:	68 0a 47 80 00       	push   $0x80470a
+  80028f:	6a 54                	push   $0x54
+  800291:	68 27 47 80 00       	push   $0x804727
+  800296:	e8 47 2f 00 00       	call   8031e2 <_panic>
+
+0080029b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	57                   	push   %edi
+  80029f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ab:	b8 06 00 00 00       	mov    $0x6,%eax
+  8002b0:	89 df                	mov    %ebx,%edi
+  8002b2:	6a 00                	push   $0x0
+  8002b4:	55                   	push   %ebp
+  8002b5:	56                   	push   %esi
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	8d 35 c0 02 80 00    	lea    0x8002c0,%esi
+  8002be:	0f 34                	sysenter
+
+008002c0 <after_sysenter_label_704>:
+  8002c0:	5e                   	pop    %esi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	7f 07                	jg     8002d0 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002cc:	5b                   	pop    %ebx
+  8002cd:	5f                   	pop    %edi
+  8002ce:	5d                   	pop    %ebp
+  8002cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	50                   	push   %eax
+  8002d4:	6a 06                	push   $0x6
+  8002d6:	68 0a 47 80 00       	push   $0x80470a
+  8002db:	6a 54                	push   $0x54
+  8002dd:	68 27 47 80 00       	push   $0x804727
+  8002e2:	e8 fb 2e 00 00       	call   8031e2 <_panic>
+
+008002e7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	57                   	push   %edi
+  8002eb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002fc:	89 df                	mov    %ebx,%edi
+  8002fe:	6a 00                	push   $0x0
+  800300:	55                   	push   %ebp
+  800301:	56                   	push   %esi
+  800302:	89 e5                	mov    %esp,%ebp
+  800304:	8d 35 0c 03 80 00    	lea    0x80030c,%esi
+  80030a:	0f 34                	sysenter
+
+0080030c <after_sysenter_label_808>:
+  80030c:	5e                   	pop    %esi
+  80030d:	5d                   	pop    %ebp
+  80030e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800311:	85 c0                	test   %eax,%eax
+  800313:	7f 07                	jg     80031c <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800315:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800318:	5b                   	pop    %ebx
+  800319:	5f                   	pop    %edi
+  80031a:	5d                   	pop    %ebp
+  80031b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  80031f:	50                   	push   %eax
+  800320:	6a 08                	push   $0x8
+  800322:	68 0a 47 80 00       	push   $0x80470a
+  800327:	6a 54                	push   $0x54
+  800329:	68 27 47 80 00       	push   $0x804727
+  80032e:	e8 af 2e 00 00       	call   8031e2 <_panic>
+
+00800333 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	57                   	push   %edi
+  800337:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800338:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80033d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800343:	b8 09 00 00 00       	mov    $0x9,%eax
+  800348:	89 df                	mov    %ebx,%edi
+  80034a:	6a 00                	push   $0x0
+  80034c:	55                   	push   %ebp
+  80034d:	56                   	push   %esi
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	8d 35 58 03 80 00    	lea    0x800358,%esi
+  800356:	0f 34                	sysenter
+
+00800358 <after_sysenter_label_912>:
+  800358:	5e                   	pop    %esi
+  800359:	5d                   	pop    %ebp
+  80035a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80035d:	85 c0                	test   %eax,%eax
+  80035f:	7f 07                	jg     800368 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800361:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800364:	5b                   	pop    %ebx
+  800365:	5f                   	pop    %edi
+  800366:	5d                   	pop    %ebp
+  800367:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800368:	83 ec 0c             	sub    $0xc,%esp
+  80036b:	50                   	push   %eax
+  80036c:	6a 09                	push   $0x9
+  80036e:	68 0a 47 80 00       	push   $0x80470a
+  800373:	6a 54                	push   $0x54
+  800375:	68 27 47 80 00       	push   $0x804727
+  80037a:	e8 63 2e 00 00       	call   8031e2 <_panic>
+
+0080037f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	57                   	push   %edi
+  800383:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800384:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800389:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800394:	89 df                	mov    %ebx,%edi
+  800396:	6a 00                	push   $0x0
+  800398:	55                   	push   %ebp
+  800399:	56                   	push   %esi
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	8d 35 a4 03 80 00    	lea    0x8003a4,%esi
+  8003a2:	0f 34                	sysenter
+
+008003a4 <after_sysenter_label_1016>:
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5d                   	pop    %ebp
+  8003a6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8003a9:	85 c0                	test   %eax,%eax
+  8003ab:	7f 07                	jg     8003b4 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8003ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003b0:	5b                   	pop    %ebx
+  8003b1:	5f                   	pop    %edi
+  8003b2:	5d                   	pop    %ebp
+  8003b3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	50                   	push   %eax
+  8003b8:	6a 0a                	push   $0xa
+  8003ba:	68 0a 47 80 00       	push   $0x80470a
+  8003bf:	6a 54                	push   $0x54
+  8003c1:	68 27 47 80 00       	push   $0x804727
+  8003c6:	e8 17 2e 00 00       	call   8031e2 <_panic>
+
+008003cb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003cb:	55                   	push   %ebp
+  8003cc:	89 e5                	mov    %esp,%ebp
+  8003ce:	57                   	push   %edi
+  8003cf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003e1:	6a 00                	push   $0x0
+  8003e3:	55                   	push   %ebp
+  8003e4:	56                   	push   %esi
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	8d 35 ef 03 80 00    	lea    0x8003ef,%esi
+  8003ed:	0f 34                	sysenter
+
+008003ef <after_sysenter_label_1126>:
+  8003ef:	5e                   	pop    %esi
+  8003f0:	5d                   	pop    %ebp
+  8003f1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003f4:	5b                   	pop    %ebx
+  8003f5:	5f                   	pop    %edi
+  8003f6:	5d                   	pop    %ebp
+  8003f7:	c3                   	ret
+
+008003f8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003f8:	55                   	push   %ebp
+  8003f9:	89 e5                	mov    %esp,%ebp
+  8003fb:	57                   	push   %edi
+  8003fc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800405:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80040a:	89 cb                	mov    %ecx,%ebx
+  80040c:	89 cf                	mov    %ecx,%edi
+  80040e:	6a 00                	push   $0x0
+  800410:	55                   	push   %ebp
+  800411:	56                   	push   %esi
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	8d 35 1c 04 80 00    	lea    0x80041c,%esi
+  80041a:	0f 34                	sysenter
+
+0080041c <after_sysenter_label_1210>:
+  80041c:	5e                   	pop    %esi
+  80041d:	5d                   	pop    %ebp
+  80041e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800421:	85 c0                	test   %eax,%eax
+  800423:	7f 07                	jg     80042c <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800425:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800428:	5b                   	pop    %ebx
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80042c:	83 ec 0c             	sub    $0xc,%esp
+  80042f:	50                   	push   %eax
+  800430:	6a 0d                	push   $0xd
+  800432:	68 0a 47 80 00       	push   $0x80470a
+  800437:	6a 54                	push   $0x54
+  800439:	68 27 47 80 00       	push   $0x804727
+  80043e:	e8 9f 2d 00 00       	call   8031e2 <_panic>
+
+00800443 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	57                   	push   %edi
+  800447:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800450:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800453:	b8 42 00 00 00       	mov    $0x42,%eax
+  800458:	89 df                	mov    %ebx,%edi
+  80045a:	6a 00                	push   $0x0
+  80045c:	55                   	push   %ebp
+  80045d:	56                   	push   %esi
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	8d 35 68 04 80 00    	lea    0x800468,%esi
+  800466:	0f 34                	sysenter
+
+00800468 <after_sysenter_label_1311>:
+  800468:	5e                   	pop    %esi
+  800469:	5d                   	pop    %ebp
+  80046a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80046d:	85 c0                	test   %eax,%eax
+  80046f:	7f 07                	jg     800478 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800471:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800474:	5b                   	pop    %ebx
+  800475:	5f                   	pop    %edi
+  800476:	5d                   	pop    %ebp
+  800477:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800478:	83 ec 0c             	sub    $0xc,%esp
+  80047b:	50                   	push   %eax
+  80047c:	6a 42                	push   $0x42
+  80047e:	68 0a 47 80 00       	push   $0x80470a
+  800483:	6a 54                	push   $0x54
+  800485:	68 27 47 80 00       	push   $0x804727
+  80048a:	e8 53 2d 00 00       	call   8031e2 <_panic>
+
+0080048f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80048f:	55                   	push   %ebp
+  800490:	89 e5                	mov    %esp,%ebp
+  800492:	57                   	push   %edi
+  800493:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800494:	ba 00 00 00 00       	mov    $0x0,%edx
+  800499:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80049e:	89 d1                	mov    %edx,%ecx
+  8004a0:	89 d3                	mov    %edx,%ebx
+  8004a2:	89 d7                	mov    %edx,%edi
+  8004a4:	6a 00                	push   $0x0
+  8004a6:	55                   	push   %ebp
+  8004a7:	56                   	push   %esi
+  8004a8:	89 e5                	mov    %esp,%ebp
+  8004aa:	8d 35 b2 04 80 00    	lea    0x8004b2,%esi
+  8004b0:	0f 34                	sysenter
+
+008004b2 <after_sysenter_label_1411>:
+  8004b2:	5e                   	pop    %esi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004b7:	5b                   	pop    %ebx
+  8004b8:	5f                   	pop    %edi
+  8004b9:	5d                   	pop    %ebp
+  8004ba:	c3                   	ret
+
+008004bb <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	57                   	push   %edi
+  8004bf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004d0:	89 df                	mov    %ebx,%edi
+  8004d2:	6a 00                	push   $0x0
+  8004d4:	55                   	push   %ebp
+  8004d5:	56                   	push   %esi
+  8004d6:	89 e5                	mov    %esp,%ebp
+  8004d8:	8d 35 e0 04 80 00    	lea    0x8004e0,%esi
+  8004de:	0f 34                	sysenter
+
+008004e0 <after_sysenter_label_1497>:
+  8004e0:	5e                   	pop    %esi
+  8004e1:	5d                   	pop    %ebp
+  8004e2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004e5:	5b                   	pop    %ebx
+  8004e6:	5f                   	pop    %edi
+  8004e7:	5d                   	pop    %ebp
+  8004e8:	c3                   	ret
+
+008004e9 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004e9:	55                   	push   %ebp
+  8004ea:	89 e5                	mov    %esp,%ebp
+  8004ec:	57                   	push   %edi
+  8004ed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004fe:	89 df                	mov    %ebx,%edi
+  800500:	6a 00                	push   $0x0
+  800502:	55                   	push   %ebp
+  800503:	56                   	push   %esi
+  800504:	89 e5                	mov    %esp,%ebp
+  800506:	8d 35 0e 05 80 00    	lea    0x80050e,%esi
+  80050c:	0f 34                	sysenter
+
+0080050e <after_sysenter_label_1583>:
+  80050e:	5e                   	pop    %esi
+  80050f:	5d                   	pop    %ebp
+  800510:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800513:	5b                   	pop    %ebx
+  800514:	5f                   	pop    %edi
+  800515:	5d                   	pop    %ebp
+  800516:	c3                   	ret
+
+00800517 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800517:	55                   	push   %ebp
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	57                   	push   %edi
+  80051b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80051c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800522:	b8 11 00 00 00       	mov    $0x11,%eax
+  800527:	bf 00 00 00 00       	mov    $0x0,%edi
+  80052c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80052f:	6a 00                	push   $0x0
+  800531:	55                   	push   %ebp
+  800532:	56                   	push   %esi
+  800533:	89 e5                	mov    %esp,%ebp
+  800535:	8d 35 3d 05 80 00    	lea    0x80053d,%esi
+  80053b:	0f 34                	sysenter
+
+0080053d <after_sysenter_label_1672>:
+  80053d:	5e                   	pop    %esi
+  80053e:	5d                   	pop    %ebp
+  80053f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800542:	5b                   	pop    %ebx
+  800543:	5f                   	pop    %edi
+  800544:	5d                   	pop    %ebp
+  800545:	c3                   	ret
+
+00800546 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800546:	55                   	push   %ebp
+  800547:	89 e5                	mov    %esp,%ebp
+  800549:	57                   	push   %edi
+  80054a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80054b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800550:	8b 55 08             	mov    0x8(%ebp),%edx
+  800553:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800556:	b8 12 00 00 00       	mov    $0x12,%eax
+  80055b:	89 df                	mov    %ebx,%edi
+  80055d:	6a 00                	push   $0x0
+  80055f:	55                   	push   %ebp
+  800560:	56                   	push   %esi
+  800561:	89 e5                	mov    %esp,%ebp
+  800563:	8d 35 6b 05 80 00    	lea    0x80056b,%esi
+  800569:	0f 34                	sysenter
+
+0080056b <after_sysenter_label_1758>:
+  80056b:	5e                   	pop    %esi
+  80056c:	5d                   	pop    %ebp
+  80056d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800570:	5b                   	pop    %ebx
+  800571:	5f                   	pop    %edi
+  800572:	5d                   	pop    %ebp
+  800573:	c3                   	ret
+
+00800574 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800574:	55                   	push   %ebp
+  800575:	89 e5                	mov    %esp,%ebp
+  800577:	57                   	push   %edi
+  800578:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800579:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800581:	b8 13 00 00 00       	mov    $0x13,%eax
+  800586:	89 cb                	mov    %ecx,%ebx
+  800588:	89 cf                	mov    %ecx,%edi
+  80058a:	6a 00                	push   $0x0
+  80058c:	55                   	push   %ebp
+  80058d:	56                   	push   %esi
+  80058e:	89 e5                	mov    %esp,%ebp
+  800590:	8d 35 98 05 80 00    	lea    0x800598,%esi
+  800596:	0f 34                	sysenter
+
+00800598 <after_sysenter_label_1842>:
+  800598:	5e                   	pop    %esi
+  800599:	5d                   	pop    %ebp
+  80059a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80059d:	85 c0                	test   %eax,%eax
+  80059f:	7f 07                	jg     8005a8 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8005a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005a4:	5b                   	pop    %ebx
+  8005a5:	5f                   	pop    %edi
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005a8:	83 ec 0c             	sub    $0xc,%esp
+  8005ab:	50                   	push   %eax
+  8005ac:	6a 13                	push   $0x13
+  8005ae:	68 0a 47 80 00       	push   $0x80470a
+  8005b3:	6a 54                	push   $0x54
+  8005b5:	68 27 47 80 00       	push   $0x804727
+  8005ba:	e8 23 2c 00 00       	call   8031e2 <_panic>
+
+008005bf <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8005bf:	55                   	push   %ebp
+  8005c0:	89 e5                	mov    %esp,%ebp
+  8005c2:	57                   	push   %edi
+  8005c3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005ce:	89 d1                	mov    %edx,%ecx
+  8005d0:	89 d3                	mov    %edx,%ebx
+  8005d2:	89 d7                	mov    %edx,%edi
+  8005d4:	6a 00                	push   $0x0
+  8005d6:	55                   	push   %ebp
+  8005d7:	56                   	push   %esi
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	8d 35 e2 05 80 00    	lea    0x8005e2,%esi
+  8005e0:	0f 34                	sysenter
+
+008005e2 <after_sysenter_label_1939>:
+  8005e2:	5e                   	pop    %esi
+  8005e3:	5d                   	pop    %ebp
+  8005e4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005e7:	5b                   	pop    %ebx
+  8005e8:	5f                   	pop    %edi
+  8005e9:	5d                   	pop    %ebp
+  8005ea:	c3                   	ret
+
+008005eb <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005eb:	55                   	push   %ebp
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	57                   	push   %edi
+  8005ef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800600:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800603:	6a 00                	push   $0x0
+  800605:	55                   	push   %ebp
+  800606:	56                   	push   %esi
+  800607:	89 e5                	mov    %esp,%ebp
+  800609:	8d 35 11 06 80 00    	lea    0x800611,%esi
+  80060f:	0f 34                	sysenter
+
+00800611 <after_sysenter_label_2028>:
+  800611:	5e                   	pop    %esi
+  800612:	5d                   	pop    %ebp
+  800613:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800616:	5b                   	pop    %ebx
+  800617:	5f                   	pop    %edi
+  800618:	5d                   	pop    %ebp
+  800619:	c3                   	ret
+
+0080061a <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80061a:	55                   	push   %ebp
+  80061b:	89 e5                	mov    %esp,%ebp
+  80061d:	57                   	push   %edi
+  80061e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80061f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800624:	8b 55 08             	mov    0x8(%ebp),%edx
+  800627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80062f:	89 df                	mov    %ebx,%edi
+  800631:	6a 00                	push   $0x0
+  800633:	55                   	push   %ebp
+  800634:	56                   	push   %esi
+  800635:	89 e5                	mov    %esp,%ebp
+  800637:	8d 35 3f 06 80 00    	lea    0x80063f,%esi
+  80063d:	0f 34                	sysenter
+
+0080063f <after_sysenter_label_2114>:
+  80063f:	5e                   	pop    %esi
+  800640:	5d                   	pop    %ebp
+  800641:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800644:	5b                   	pop    %ebx
+  800645:	5f                   	pop    %edi
+  800646:	5d                   	pop    %ebp
+  800647:	c3                   	ret
+
+00800648 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800648:	55                   	push   %ebp
+  800649:	89 e5                	mov    %esp,%ebp
+  80064b:	57                   	push   %edi
+  80064c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80064d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800652:	8b 55 08             	mov    0x8(%ebp),%edx
+  800655:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800658:	b8 17 00 00 00       	mov    $0x17,%eax
+  80065d:	89 df                	mov    %ebx,%edi
+  80065f:	6a 00                	push   $0x0
+  800661:	55                   	push   %ebp
+  800662:	56                   	push   %esi
+  800663:	89 e5                	mov    %esp,%ebp
+  800665:	8d 35 6d 06 80 00    	lea    0x80066d,%esi
+  80066b:	0f 34                	sysenter
+
+0080066d <after_sysenter_label_2200>:
+  80066d:	5e                   	pop    %esi
+  80066e:	5d                   	pop    %ebp
+  80066f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800672:	5b                   	pop    %ebx
+  800673:	5f                   	pop    %edi
+  800674:	5d                   	pop    %ebp
+  800675:	c3                   	ret
+
+00800676 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800676:	55                   	push   %ebp
+  800677:	89 e5                	mov    %esp,%ebp
+  800679:	57                   	push   %edi
+  80067a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80067b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800680:	8b 55 08             	mov    0x8(%ebp),%edx
+  800683:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800686:	b8 18 00 00 00       	mov    $0x18,%eax
+  80068b:	89 df                	mov    %ebx,%edi
+  80068d:	6a 00                	push   $0x0
+  80068f:	55                   	push   %ebp
+  800690:	56                   	push   %esi
+  800691:	89 e5                	mov    %esp,%ebp
+  800693:	8d 35 9b 06 80 00    	lea    0x80069b,%esi
+  800699:	0f 34                	sysenter
+
+0080069b <after_sysenter_label_2286>:
+  80069b:	5e                   	pop    %esi
+  80069c:	5d                   	pop    %ebp
+  80069d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8006a0:	5b                   	pop    %ebx
+  8006a1:	5f                   	pop    %edi
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006aa:	05 00 00 00 30       	add    $0x30000000,%eax
+  8006af:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8006b2:	5d                   	pop    %ebp
+  8006b3:	c3                   	ret
+
+008006b4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8006b4:	55                   	push   %ebp
+  8006b5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ba:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8006bf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8006c4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006c9:	5d                   	pop    %ebp
+  8006ca:	c3                   	ret
+
+008006cb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006cb:	55                   	push   %ebp
+  8006cc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006ce:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006d3:	eb 02                	jmp    8006d7 <fd_alloc+0xc>
+  8006d5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006d7:	89 c2                	mov    %eax,%edx
+  8006d9:	c1 ea 16             	shr    $0x16,%edx
+  8006dc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006e3:	f6 c2 01             	test   $0x1,%dl
+  8006e6:	74 2b                	je     800713 <fd_alloc+0x48>
+  8006e8:	89 c2                	mov    %eax,%edx
+  8006ea:	c1 ea 0c             	shr    $0xc,%edx
+  8006ed:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006f4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006fa:	f6 c1 01             	test   $0x1,%cl
+  8006fd:	74 14                	je     800713 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006ff:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800705:	75 ce                	jne    8006d5 <fd_alloc+0xa>
+  800707:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80070c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800711:	eb 05                	jmp    800718 <fd_alloc+0x4d>
+			return 0;
+  800713:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800718:	8b 55 08             	mov    0x8(%ebp),%edx
+  80071b:	89 02                	mov    %eax,(%edx)
+}
+  80071d:	89 c8                	mov    %ecx,%eax
+  80071f:	5d                   	pop    %ebp
+  800720:	c3                   	ret
+
+00800721 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800721:	55                   	push   %ebp
+  800722:	89 e5                	mov    %esp,%ebp
+  800724:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800727:	83 f8 1f             	cmp    $0x1f,%eax
+  80072a:	77 30                	ja     80075c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80072c:	c1 e0 0c             	shl    $0xc,%eax
+  80072f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800734:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80073a:	f6 c2 01             	test   $0x1,%dl
+  80073d:	74 24                	je     800763 <fd_lookup+0x42>
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	c1 ea 0c             	shr    $0xc,%edx
+  800744:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80074b:	f6 c2 01             	test   $0x1,%dl
+  80074e:	74 1a                	je     80076a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800750:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800753:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80075a:	5d                   	pop    %ebp
+  80075b:	c3                   	ret
+		return -E_INVAL;
+  80075c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800761:	eb f7                	jmp    80075a <fd_lookup+0x39>
+		return -E_INVAL;
+  800763:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800768:	eb f0                	jmp    80075a <fd_lookup+0x39>
+  80076a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076f:	eb e9                	jmp    80075a <fd_lookup+0x39>
+
+00800771 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	53                   	push   %ebx
+  800775:	83 ec 04             	sub    $0x4,%esp
+  800778:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80077b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800780:	eb 03                	jmp    800785 <dev_lookup+0x14>
+  800782:	83 c0 01             	add    $0x1,%eax
+  800785:	8b 1c 85 b4 47 80 00 	mov    0x8047b4(,%eax,4),%ebx
+  80078c:	85 db                	test   %ebx,%ebx
+  80078e:	74 0b                	je     80079b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800790:	39 13                	cmp    %edx,(%ebx)
+  800792:	75 ee                	jne    800782 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	eb 49                	jmp    8007e4 <dev_lookup+0x73>
+  80079b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80079d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8007a3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8007a8:	77 18                	ja     8007c2 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8007aa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8007af:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8007b1:	c1 e8 10             	shr    $0x10,%eax
+  8007b4:	74 0c                	je     8007c2 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8007b6:	c1 e0 10             	shl    $0x10,%eax
+  8007b9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8007be:	29 c1                	sub    %eax,%ecx
+  8007c0:	eb 06                	jmp    8007c8 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8007c2:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007c8:	8b 01                	mov    (%ecx),%eax
+  8007ca:	8b 40 48             	mov    0x48(%eax),%eax
+  8007cd:	83 ec 04             	sub    $0x4,%esp
+  8007d0:	52                   	push   %edx
+  8007d1:	50                   	push   %eax
+  8007d2:	68 38 47 80 00       	push   $0x804738
+  8007d7:	e8 e1 2a 00 00       	call   8032bd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007dc:	83 c4 10             	add    $0x10,%esp
+  8007df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e7:	89 1a                	mov    %ebx,(%edx)
+}
+  8007e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ec:	c9                   	leave
+  8007ed:	c3                   	ret
+
+008007ee <fd_close>:
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	57                   	push   %edi
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	83 ec 24             	sub    $0x24,%esp
+  8007f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800800:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800801:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800807:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80080a:	50                   	push   %eax
+  80080b:	e8 11 ff ff ff       	call   800721 <fd_lookup>
+  800810:	89 c3                	mov    %eax,%ebx
+  800812:	83 c4 10             	add    $0x10,%esp
+  800815:	85 c0                	test   %eax,%eax
+  800817:	78 05                	js     80081e <fd_close+0x30>
+	    || fd != fd2)
+  800819:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80081c:	74 16                	je     800834 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80081e:	89 f8                	mov    %edi,%eax
+  800820:	84 c0                	test   %al,%al
+  800822:	b8 00 00 00 00       	mov    $0x0,%eax
+  800827:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80082a:	89 d8                	mov    %ebx,%eax
+  80082c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80082f:	5b                   	pop    %ebx
+  800830:	5e                   	pop    %esi
+  800831:	5f                   	pop    %edi
+  800832:	5d                   	pop    %ebp
+  800833:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800834:	83 ec 08             	sub    $0x8,%esp
+  800837:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80083a:	50                   	push   %eax
+  80083b:	ff 36                	push   (%esi)
+  80083d:	e8 2f ff ff ff       	call   800771 <dev_lookup>
+  800842:	89 c3                	mov    %eax,%ebx
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	85 c0                	test   %eax,%eax
+  800849:	78 1a                	js     800865 <fd_close+0x77>
+		if (dev->dev_close)
+  80084b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80084e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800851:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800856:	85 c0                	test   %eax,%eax
+  800858:	74 0b                	je     800865 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80085a:	83 ec 0c             	sub    $0xc,%esp
+  80085d:	56                   	push   %esi
+  80085e:	ff d0                	call   *%eax
+  800860:	89 c3                	mov    %eax,%ebx
+  800862:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800865:	83 ec 08             	sub    $0x8,%esp
+  800868:	56                   	push   %esi
+  800869:	6a 00                	push   $0x0
+  80086b:	e8 2b fa ff ff       	call   80029b <sys_page_unmap>
+	return r;
+  800870:	83 c4 10             	add    $0x10,%esp
+  800873:	eb b5                	jmp    80082a <fd_close+0x3c>
+
+00800875 <close>:
+
+int
+close(int fdnum)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80087b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80087e:	50                   	push   %eax
+  80087f:	ff 75 08             	push   0x8(%ebp)
+  800882:	e8 9a fe ff ff       	call   800721 <fd_lookup>
+  800887:	83 c4 10             	add    $0x10,%esp
+  80088a:	85 c0                	test   %eax,%eax
+  80088c:	79 02                	jns    800890 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80088e:	c9                   	leave
+  80088f:	c3                   	ret
+		return fd_close(fd, 1);
+  800890:	83 ec 08             	sub    $0x8,%esp
+  800893:	6a 01                	push   $0x1
+  800895:	ff 75 f4             	push   -0xc(%ebp)
+  800898:	e8 51 ff ff ff       	call   8007ee <fd_close>
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	eb ec                	jmp    80088e <close+0x19>
+
+008008a2 <close_all>:
+
+void
+close_all(void)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	53                   	push   %ebx
+  8008a6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8008a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8008ae:	83 ec 0c             	sub    $0xc,%esp
+  8008b1:	53                   	push   %ebx
+  8008b2:	e8 be ff ff ff       	call   800875 <close>
+	for (i = 0; i < MAXFD; i++)
+  8008b7:	83 c3 01             	add    $0x1,%ebx
+  8008ba:	83 c4 10             	add    $0x10,%esp
+  8008bd:	83 fb 20             	cmp    $0x20,%ebx
+  8008c0:	75 ec                	jne    8008ae <close_all+0xc>
+}
+  8008c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c5:	c9                   	leave
+  8008c6:	c3                   	ret
+
+008008c7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	57                   	push   %edi
+  8008cb:	56                   	push   %esi
+  8008cc:	53                   	push   %ebx
+  8008cd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008d3:	50                   	push   %eax
+  8008d4:	ff 75 08             	push   0x8(%ebp)
+  8008d7:	e8 45 fe ff ff       	call   800721 <fd_lookup>
+  8008dc:	89 c3                	mov    %eax,%ebx
+  8008de:	83 c4 10             	add    $0x10,%esp
+  8008e1:	85 c0                	test   %eax,%eax
+  8008e3:	78 7f                	js     800964 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008e5:	83 ec 0c             	sub    $0xc,%esp
+  8008e8:	ff 75 0c             	push   0xc(%ebp)
+  8008eb:	e8 85 ff ff ff       	call   800875 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f3:	c1 e6 0c             	shl    $0xc,%esi
+  8008f6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008ff:	89 3c 24             	mov    %edi,(%esp)
+  800902:	e8 ad fd ff ff       	call   8006b4 <fd2data>
+  800907:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800909:	89 34 24             	mov    %esi,(%esp)
+  80090c:	e8 a3 fd ff ff       	call   8006b4 <fd2data>
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800917:	89 d8                	mov    %ebx,%eax
+  800919:	c1 e8 16             	shr    $0x16,%eax
+  80091c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800923:	a8 01                	test   $0x1,%al
+  800925:	74 11                	je     800938 <dup+0x71>
+  800927:	89 d8                	mov    %ebx,%eax
+  800929:	c1 e8 0c             	shr    $0xc,%eax
+  80092c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800933:	f6 c2 01             	test   $0x1,%dl
+  800936:	75 36                	jne    80096e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800938:	89 f8                	mov    %edi,%eax
+  80093a:	c1 e8 0c             	shr    $0xc,%eax
+  80093d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800944:	83 ec 0c             	sub    $0xc,%esp
+  800947:	25 07 0e 00 00       	and    $0xe07,%eax
+  80094c:	50                   	push   %eax
+  80094d:	56                   	push   %esi
+  80094e:	6a 00                	push   $0x0
+  800950:	57                   	push   %edi
+  800951:	6a 00                	push   $0x0
+  800953:	e8 f7 f8 ff ff       	call   80024f <sys_page_map>
+  800958:	89 c3                	mov    %eax,%ebx
+  80095a:	83 c4 20             	add    $0x20,%esp
+  80095d:	85 c0                	test   %eax,%eax
+  80095f:	78 33                	js     800994 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800961:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800964:	89 d8                	mov    %ebx,%eax
+  800966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5f                   	pop    %edi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80096e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800975:	83 ec 0c             	sub    $0xc,%esp
+  800978:	25 07 0e 00 00       	and    $0xe07,%eax
+  80097d:	50                   	push   %eax
+  80097e:	ff 75 d4             	push   -0x2c(%ebp)
+  800981:	6a 00                	push   $0x0
+  800983:	53                   	push   %ebx
+  800984:	6a 00                	push   $0x0
+  800986:	e8 c4 f8 ff ff       	call   80024f <sys_page_map>
+  80098b:	89 c3                	mov    %eax,%ebx
+  80098d:	83 c4 20             	add    $0x20,%esp
+  800990:	85 c0                	test   %eax,%eax
+  800992:	79 a4                	jns    800938 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800994:	83 ec 08             	sub    $0x8,%esp
+  800997:	56                   	push   %esi
+  800998:	6a 00                	push   $0x0
+  80099a:	e8 fc f8 ff ff       	call   80029b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80099f:	83 c4 08             	add    $0x8,%esp
+  8009a2:	ff 75 d4             	push   -0x2c(%ebp)
+  8009a5:	6a 00                	push   $0x0
+  8009a7:	e8 ef f8 ff ff       	call   80029b <sys_page_unmap>
+	return r;
+  8009ac:	83 c4 10             	add    $0x10,%esp
+  8009af:	eb b3                	jmp    800964 <dup+0x9d>
+
+008009b1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	56                   	push   %esi
+  8009b5:	53                   	push   %ebx
+  8009b6:	83 ec 18             	sub    $0x18,%esp
+  8009b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009bf:	50                   	push   %eax
+  8009c0:	53                   	push   %ebx
+  8009c1:	e8 5b fd ff ff       	call   800721 <fd_lookup>
+  8009c6:	83 c4 10             	add    $0x10,%esp
+  8009c9:	85 c0                	test   %eax,%eax
+  8009cb:	78 3c                	js     800a09 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009d0:	83 ec 08             	sub    $0x8,%esp
+  8009d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009d6:	50                   	push   %eax
+  8009d7:	ff 36                	push   (%esi)
+  8009d9:	e8 93 fd ff ff       	call   800771 <dev_lookup>
+  8009de:	83 c4 10             	add    $0x10,%esp
+  8009e1:	85 c0                	test   %eax,%eax
+  8009e3:	78 24                	js     800a09 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009e5:	8b 46 08             	mov    0x8(%esi),%eax
+  8009e8:	83 e0 03             	and    $0x3,%eax
+  8009eb:	83 f8 01             	cmp    $0x1,%eax
+  8009ee:	74 20                	je     800a10 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f3:	8b 40 08             	mov    0x8(%eax),%eax
+  8009f6:	85 c0                	test   %eax,%eax
+  8009f8:	74 61                	je     800a5b <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009fa:	83 ec 04             	sub    $0x4,%esp
+  8009fd:	ff 75 10             	push   0x10(%ebp)
+  800a00:	ff 75 0c             	push   0xc(%ebp)
+  800a03:	56                   	push   %esi
+  800a04:	ff d0                	call   *%eax
+  800a06:	83 c4 10             	add    $0x10,%esp
+}
+  800a09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a0c:	5b                   	pop    %ebx
+  800a0d:	5e                   	pop    %esi
+  800a0e:	5d                   	pop    %ebp
+  800a0f:	c3                   	ret
+  800a10:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800a12:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800a18:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800a1d:	77 18                	ja     800a37 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800a1f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800a24:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800a26:	c1 e8 10             	shr    $0x10,%eax
+  800a29:	74 0c                	je     800a37 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a2b:	c1 e0 10             	shl    $0x10,%eax
+  800a2e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a33:	29 c2                	sub    %eax,%edx
+  800a35:	eb 06                	jmp    800a3d <read+0x8c>
+		return pthread_main_tls;
+  800a37:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a3d:	8b 02                	mov    (%edx),%eax
+  800a3f:	8b 40 48             	mov    0x48(%eax),%eax
+  800a42:	83 ec 04             	sub    $0x4,%esp
+  800a45:	53                   	push   %ebx
+  800a46:	50                   	push   %eax
+  800a47:	68 79 47 80 00       	push   $0x804779
+  800a4c:	e8 6c 28 00 00       	call   8032bd <cprintf>
+		return -E_INVAL;
+  800a51:	83 c4 10             	add    $0x10,%esp
+  800a54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a59:	eb ae                	jmp    800a09 <read+0x58>
+		return -E_NOT_SUPP;
+  800a5b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a60:	eb a7                	jmp    800a09 <read+0x58>
+
+00800a62 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	57                   	push   %edi
+  800a66:	56                   	push   %esi
+  800a67:	53                   	push   %ebx
+  800a68:	83 ec 0c             	sub    $0xc,%esp
+  800a6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a76:	eb 02                	jmp    800a7a <readn+0x18>
+  800a78:	01 c3                	add    %eax,%ebx
+  800a7a:	39 f3                	cmp    %esi,%ebx
+  800a7c:	73 21                	jae    800a9f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a7e:	83 ec 04             	sub    $0x4,%esp
+  800a81:	89 f0                	mov    %esi,%eax
+  800a83:	29 d8                	sub    %ebx,%eax
+  800a85:	50                   	push   %eax
+  800a86:	89 d8                	mov    %ebx,%eax
+  800a88:	03 45 0c             	add    0xc(%ebp),%eax
+  800a8b:	50                   	push   %eax
+  800a8c:	57                   	push   %edi
+  800a8d:	e8 1f ff ff ff       	call   8009b1 <read>
+		if (m < 0)
+  800a92:	83 c4 10             	add    $0x10,%esp
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	78 04                	js     800a9d <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a99:	75 dd                	jne    800a78 <readn+0x16>
+  800a9b:	eb 02                	jmp    800a9f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a9d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a9f:	89 d8                	mov    %ebx,%eax
+  800aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5f                   	pop    %edi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	56                   	push   %esi
+  800aad:	53                   	push   %ebx
+  800aae:	83 ec 18             	sub    $0x18,%esp
+  800ab1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ab4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ab7:	50                   	push   %eax
+  800ab8:	53                   	push   %ebx
+  800ab9:	e8 63 fc ff ff       	call   800721 <fd_lookup>
+  800abe:	83 c4 10             	add    $0x10,%esp
+  800ac1:	85 c0                	test   %eax,%eax
+  800ac3:	78 37                	js     800afc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ac5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ac8:	83 ec 08             	sub    $0x8,%esp
+  800acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ace:	50                   	push   %eax
+  800acf:	ff 36                	push   (%esi)
+  800ad1:	e8 9b fc ff ff       	call   800771 <dev_lookup>
+  800ad6:	83 c4 10             	add    $0x10,%esp
+  800ad9:	85 c0                	test   %eax,%eax
+  800adb:	78 1f                	js     800afc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800add:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ae1:	74 20                	je     800b03 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ae9:	85 c0                	test   %eax,%eax
+  800aeb:	74 61                	je     800b4e <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800aed:	83 ec 04             	sub    $0x4,%esp
+  800af0:	ff 75 10             	push   0x10(%ebp)
+  800af3:	ff 75 0c             	push   0xc(%ebp)
+  800af6:	56                   	push   %esi
+  800af7:	ff d0                	call   *%eax
+  800af9:	83 c4 10             	add    $0x10,%esp
+}
+  800afc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aff:	5b                   	pop    %ebx
+  800b00:	5e                   	pop    %esi
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+  800b03:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800b05:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800b0b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800b10:	77 18                	ja     800b2a <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800b12:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800b17:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800b19:	c1 e8 10             	shr    $0x10,%eax
+  800b1c:	74 0c                	je     800b2a <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800b1e:	c1 e0 10             	shl    $0x10,%eax
+  800b21:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800b26:	29 c2                	sub    %eax,%edx
+  800b28:	eb 06                	jmp    800b30 <write+0x87>
+		return pthread_main_tls;
+  800b2a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b30:	8b 02                	mov    (%edx),%eax
+  800b32:	8b 40 48             	mov    0x48(%eax),%eax
+  800b35:	83 ec 04             	sub    $0x4,%esp
+  800b38:	53                   	push   %ebx
+  800b39:	50                   	push   %eax
+  800b3a:	68 95 47 80 00       	push   $0x804795
+  800b3f:	e8 79 27 00 00       	call   8032bd <cprintf>
+		return -E_INVAL;
+  800b44:	83 c4 10             	add    $0x10,%esp
+  800b47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4c:	eb ae                	jmp    800afc <write+0x53>
+		return -E_NOT_SUPP;
+  800b4e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b53:	eb a7                	jmp    800afc <write+0x53>
+
+00800b55 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b5e:	50                   	push   %eax
+  800b5f:	ff 75 08             	push   0x8(%ebp)
+  800b62:	e8 ba fb ff ff       	call   800721 <fd_lookup>
+  800b67:	83 c4 10             	add    $0x10,%esp
+  800b6a:	85 c0                	test   %eax,%eax
+  800b6c:	78 0e                	js     800b7c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b74:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b7c:	c9                   	leave
+  800b7d:	c3                   	ret
+
+00800b7e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b7e:	55                   	push   %ebp
+  800b7f:	89 e5                	mov    %esp,%ebp
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 18             	sub    $0x18,%esp
+  800b86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b8c:	50                   	push   %eax
+  800b8d:	53                   	push   %ebx
+  800b8e:	e8 8e fb ff ff       	call   800721 <fd_lookup>
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	85 c0                	test   %eax,%eax
+  800b98:	78 34                	js     800bce <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b9d:	83 ec 08             	sub    $0x8,%esp
+  800ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba3:	50                   	push   %eax
+  800ba4:	ff 36                	push   (%esi)
+  800ba6:	e8 c6 fb ff ff       	call   800771 <dev_lookup>
+  800bab:	83 c4 10             	add    $0x10,%esp
+  800bae:	85 c0                	test   %eax,%eax
+  800bb0:	78 1c                	js     800bce <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bb2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bb6:	74 1d                	je     800bd5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bbb:	8b 40 18             	mov    0x18(%eax),%eax
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	74 5e                	je     800c20 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bc2:	83 ec 08             	sub    $0x8,%esp
+  800bc5:	ff 75 0c             	push   0xc(%ebp)
+  800bc8:	56                   	push   %esi
+  800bc9:	ff d0                	call   *%eax
+  800bcb:	83 c4 10             	add    $0x10,%esp
+}
+  800bce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+  800bd5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bd7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bdd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800be2:	77 18                	ja     800bfc <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800be4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800be9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800beb:	c1 e8 10             	shr    $0x10,%eax
+  800bee:	74 0c                	je     800bfc <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bf0:	c1 e0 10             	shl    $0x10,%eax
+  800bf3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bf8:	29 c2                	sub    %eax,%edx
+  800bfa:	eb 06                	jmp    800c02 <ftruncate+0x84>
+		return pthread_main_tls;
+  800bfc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800c02:	8b 02                	mov    (%edx),%eax
+  800c04:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800c07:	83 ec 04             	sub    $0x4,%esp
+  800c0a:	53                   	push   %ebx
+  800c0b:	50                   	push   %eax
+  800c0c:	68 58 47 80 00       	push   $0x804758
+  800c11:	e8 a7 26 00 00       	call   8032bd <cprintf>
+		return -E_INVAL;
+  800c16:	83 c4 10             	add    $0x10,%esp
+  800c19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c1e:	eb ae                	jmp    800bce <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c20:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c25:	eb a7                	jmp    800bce <ftruncate+0x50>
+
+00800c27 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+  800c2c:	83 ec 18             	sub    $0x18,%esp
+  800c2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c32:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c35:	50                   	push   %eax
+  800c36:	ff 75 08             	push   0x8(%ebp)
+  800c39:	e8 e3 fa ff ff       	call   800721 <fd_lookup>
+  800c3e:	83 c4 10             	add    $0x10,%esp
+  800c41:	85 c0                	test   %eax,%eax
+  800c43:	78 49                	js     800c8e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c45:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c48:	83 ec 08             	sub    $0x8,%esp
+  800c4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c4e:	50                   	push   %eax
+  800c4f:	ff 36                	push   (%esi)
+  800c51:	e8 1b fb ff ff       	call   800771 <dev_lookup>
+  800c56:	83 c4 10             	add    $0x10,%esp
+  800c59:	85 c0                	test   %eax,%eax
+  800c5b:	78 31                	js     800c8e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c60:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c64:	74 2f                	je     800c95 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c66:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c69:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c70:	00 00 00 
+	stat->st_isdir = 0;
+  800c73:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c7a:	00 00 00 
+	stat->st_dev = dev;
+  800c7d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c83:	83 ec 08             	sub    $0x8,%esp
+  800c86:	53                   	push   %ebx
+  800c87:	56                   	push   %esi
+  800c88:	ff 50 14             	call   *0x14(%eax)
+  800c8b:	83 c4 10             	add    $0x10,%esp
+}
+  800c8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5d                   	pop    %ebp
+  800c94:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c95:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c9a:	eb f2                	jmp    800c8e <fstat+0x67>
+
+00800c9c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800ca1:	83 ec 08             	sub    $0x8,%esp
+  800ca4:	6a 00                	push   $0x0
+  800ca6:	ff 75 08             	push   0x8(%ebp)
+  800ca9:	e8 4b 03 00 00       	call   800ff9 <open>
+  800cae:	89 c3                	mov    %eax,%ebx
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	85 c0                	test   %eax,%eax
+  800cb5:	78 1b                	js     800cd2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800cb7:	83 ec 08             	sub    $0x8,%esp
+  800cba:	ff 75 0c             	push   0xc(%ebp)
+  800cbd:	50                   	push   %eax
+  800cbe:	e8 64 ff ff ff       	call   800c27 <fstat>
+  800cc3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cc5:	89 1c 24             	mov    %ebx,(%esp)
+  800cc8:	e8 a8 fb ff ff       	call   800875 <close>
+	return r;
+  800ccd:	83 c4 10             	add    $0x10,%esp
+  800cd0:	89 f3                	mov    %esi,%ebx
+}
+  800cd2:	89 d8                	mov    %ebx,%eax
+  800cd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cd7:	5b                   	pop    %ebx
+  800cd8:	5e                   	pop    %esi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+
+00800cdb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	89 c6                	mov    %eax,%esi
+  800ce2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ce4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800ceb:	74 27                	je     800d14 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ced:	6a 07                	push   $0x7
+  800cef:	68 00 70 80 00       	push   $0x807000
+  800cf4:	56                   	push   %esi
+  800cf5:	ff 35 00 60 80 00    	push   0x806000
+  800cfb:	e8 51 36 00 00       	call   804351 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800d00:	83 c4 0c             	add    $0xc,%esp
+  800d03:	6a 00                	push   $0x0
+  800d05:	53                   	push   %ebx
+  800d06:	6a 00                	push   $0x0
+  800d08:	e8 4e 35 00 00       	call   80425b <ipc_recv>
+}
+  800d0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5d                   	pop    %ebp
+  800d13:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+  800d17:	6a 01                	push   $0x1
+  800d19:	e8 89 36 00 00       	call   8043a7 <ipc_find_env>
+  800d1e:	a3 00 60 80 00       	mov    %eax,0x806000
+  800d23:	83 c4 10             	add    $0x10,%esp
+  800d26:	eb c5                	jmp    800ced <fsipc+0x12>
+
+00800d28 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d2f:	68 04 60 80 00       	push   $0x806004
+  800d34:	e8 29 1b 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d3f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d47:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d51:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d56:	e8 80 ff ff ff       	call   800cdb <fsipc>
+  800d5b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d5d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d64:	e8 66 1b 00 00       	call   8028cf <mutex_unlock>
+	return r;
+}
+  800d69:	89 d8                	mov    %ebx,%eax
+  800d6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+00800d70 <devfile_flush>:
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d77:	68 04 60 80 00       	push   $0x806004
+  800d7c:	e8 e1 1a 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d84:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d87:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d91:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d96:	e8 40 ff ff ff       	call   800cdb <fsipc>
+  800d9b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d9d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800da4:	e8 26 1b 00 00       	call   8028cf <mutex_unlock>
+}
+  800da9:	89 d8                	mov    %ebx,%eax
+  800dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dae:	c9                   	leave
+  800daf:	c3                   	ret
+
+00800db0 <devfile_stat>:
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+  800db5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800db8:	83 ec 0c             	sub    $0xc,%esp
+  800dbb:	68 04 60 80 00       	push   $0x806004
+  800dc0:	e8 9d 1a 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dcb:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dda:	e8 fc fe ff ff       	call   800cdb <fsipc>
+  800ddf:	89 c3                	mov    %eax,%ebx
+  800de1:	83 c4 10             	add    $0x10,%esp
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	79 16                	jns    800dfe <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+  800deb:	68 04 60 80 00       	push   $0x806004
+  800df0:	e8 da 1a 00 00       	call   8028cf <mutex_unlock>
+}
+  800df5:	89 d8                	mov    %ebx,%eax
+  800df7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dfa:	5b                   	pop    %ebx
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dfe:	83 ec 08             	sub    $0x8,%esp
+  800e01:	68 00 70 80 00       	push   $0x807000
+  800e06:	56                   	push   %esi
+  800e07:	e8 95 2a 00 00       	call   8038a1 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800e0c:	a1 80 70 80 00       	mov    0x807080,%eax
+  800e11:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800e17:	a1 84 70 80 00       	mov    0x807084,%eax
+  800e1c:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800e22:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	eb bc                	jmp    800de8 <devfile_stat+0x38>
+
+00800e2c <devfile_write>:
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	53                   	push   %ebx
+  800e30:	83 ec 10             	sub    $0x10,%esp
+  800e33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e36:	68 04 60 80 00       	push   $0x806004
+  800e3b:	e8 22 1a 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e43:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e46:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e4b:	83 c4 10             	add    $0x10,%esp
+  800e4e:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e54:	76 3d                	jbe    800e93 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e56:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e5b:	39 c3                	cmp    %eax,%ebx
+  800e5d:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e63:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e68:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e73:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e78:	e8 5e fe ff ff       	call   800cdb <fsipc>
+  800e7d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	68 04 60 80 00       	push   $0x806004
+  800e87:	e8 43 1a 00 00       	call   8028cf <mutex_unlock>
+}
+  800e8c:	89 d8                	mov    %ebx,%eax
+  800e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e91:	c9                   	leave
+  800e92:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e93:	83 ec 04             	sub    $0x4,%esp
+  800e96:	53                   	push   %ebx
+  800e97:	ff 75 0c             	push   0xc(%ebp)
+  800e9a:	68 0c 70 80 00       	push   $0x80700c
+  800e9f:	e8 83 2b 00 00       	call   803a27 <memmove>
+  800ea4:	83 c4 10             	add    $0x10,%esp
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	eb b5                	jmp    800e63 <devfile_write+0x37>
+
+00800eae <devfile_read>:
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ebd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800ec0:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800ec6:	0f 86 8c 00 00 00    	jbe    800f58 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800ecc:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800ed1:	39 c3                	cmp    %eax,%ebx
+  800ed3:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ed6:	89 f8                	mov    %edi,%eax
+  800ed8:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800edb:	eb 0f                	jmp    800eec <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800edd:	0f b6 08             	movzbl (%eax),%ecx
+  800ee0:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ee2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ee7:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800eec:	39 d0                	cmp    %edx,%eax
+  800eee:	72 ed                	jb     800edd <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	68 04 60 80 00       	push   $0x806004
+  800ef8:	e8 65 19 00 00       	call   802862 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800efd:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f00:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800f05:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800f0b:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f16:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f1b:	e8 bb fd ff ff       	call   800cdb <fsipc>
+  800f20:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800f22:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f29:	e8 a1 19 00 00       	call   8028cf <mutex_unlock>
+		assert(r <= (int) n);
+  800f2e:	83 c4 10             	add    $0x10,%esp
+  800f31:	39 f3                	cmp    %esi,%ebx
+  800f33:	7c 0a                	jl     800f3f <devfile_read+0x91>
+}
+  800f35:	89 f0                	mov    %esi,%eax
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+		assert(r <= (int) n);
+  800f3f:	68 c8 47 80 00       	push   $0x8047c8
+  800f44:	68 d5 47 80 00       	push   $0x8047d5
+  800f49:	68 90 00 00 00       	push   $0x90
+  800f4e:	68 ea 47 80 00       	push   $0x8047ea
+  800f53:	e8 8a 22 00 00       	call   8031e2 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	68 04 60 80 00       	push   $0x806004
+  800f60:	e8 fd 18 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f65:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f68:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f6d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f73:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f7a:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f82:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f87:	e8 4f fd ff ff       	call   800cdb <fsipc>
+  800f8c:	89 c6                	mov    %eax,%esi
+  800f8e:	83 c4 10             	add    $0x10,%esp
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	78 1d                	js     800fb2 <devfile_read+0x104>
+		assert(r <= n);
+  800f95:	39 c3                	cmp    %eax,%ebx
+  800f97:	72 2e                	jb     800fc7 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f99:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f9e:	7f 40                	jg     800fe0 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800fa0:	83 ec 04             	sub    $0x4,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	68 00 70 80 00       	push   $0x807000
+  800fa9:	57                   	push   %edi
+  800faa:	e8 78 2a 00 00       	call   803a27 <memmove>
+  800faf:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	68 04 60 80 00       	push   $0x806004
+  800fba:	e8 10 19 00 00       	call   8028cf <mutex_unlock>
+	return r;
+  800fbf:	83 c4 10             	add    $0x10,%esp
+  800fc2:	e9 6e ff ff ff       	jmp    800f35 <devfile_read+0x87>
+		assert(r <= n);
+  800fc7:	68 f5 47 80 00       	push   $0x8047f5
+  800fcc:	68 d5 47 80 00       	push   $0x8047d5
+  800fd1:	68 99 00 00 00       	push   $0x99
+  800fd6:	68 ea 47 80 00       	push   $0x8047ea
+  800fdb:	e8 02 22 00 00       	call   8031e2 <_panic>
+		assert(r <= PGSIZE);
+  800fe0:	68 fc 47 80 00       	push   $0x8047fc
+  800fe5:	68 d5 47 80 00       	push   $0x8047d5
+  800fea:	68 9a 00 00 00       	push   $0x9a
+  800fef:	68 ea 47 80 00       	push   $0x8047ea
+  800ff4:	e8 e9 21 00 00       	call   8031e2 <_panic>
+
+00800ff9 <open>:
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	56                   	push   %esi
+  800ffd:	53                   	push   %ebx
+  800ffe:	83 ec 1c             	sub    $0x1c,%esp
+  801001:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801004:	56                   	push   %esi
+  801005:	e8 5c 28 00 00       	call   803866 <strlen>
+  80100a:	83 c4 10             	add    $0x10,%esp
+  80100d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801012:	0f 8f 85 00 00 00    	jg     80109d <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801018:	83 ec 0c             	sub    $0xc,%esp
+  80101b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80101e:	50                   	push   %eax
+  80101f:	e8 a7 f6 ff ff       	call   8006cb <fd_alloc>
+  801024:	89 c3                	mov    %eax,%ebx
+  801026:	83 c4 10             	add    $0x10,%esp
+  801029:	85 c0                	test   %eax,%eax
+  80102b:	78 55                	js     801082 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+  801030:	68 04 60 80 00       	push   $0x806004
+  801035:	e8 28 18 00 00       	call   802862 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80103a:	83 c4 08             	add    $0x8,%esp
+  80103d:	56                   	push   %esi
+  80103e:	68 00 70 80 00       	push   $0x807000
+  801043:	e8 59 28 00 00       	call   8038a1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801048:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80104b:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801050:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801053:	b8 01 00 00 00       	mov    $0x1,%eax
+  801058:	e8 7e fc ff ff       	call   800cdb <fsipc>
+  80105d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80105f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801066:	e8 64 18 00 00       	call   8028cf <mutex_unlock>
+	if (r < 0) {
+  80106b:	83 c4 10             	add    $0x10,%esp
+  80106e:	85 db                	test   %ebx,%ebx
+  801070:	78 19                	js     80108b <open+0x92>
+	return fd2num(fd);
+  801072:	83 ec 0c             	sub    $0xc,%esp
+  801075:	ff 75 f4             	push   -0xc(%ebp)
+  801078:	e8 27 f6 ff ff       	call   8006a4 <fd2num>
+  80107d:	89 c3                	mov    %eax,%ebx
+  80107f:	83 c4 10             	add    $0x10,%esp
+}
+  801082:	89 d8                	mov    %ebx,%eax
+  801084:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801087:	5b                   	pop    %ebx
+  801088:	5e                   	pop    %esi
+  801089:	5d                   	pop    %ebp
+  80108a:	c3                   	ret
+		fd_close(fd, 0);
+  80108b:	83 ec 08             	sub    $0x8,%esp
+  80108e:	6a 00                	push   $0x0
+  801090:	ff 75 f4             	push   -0xc(%ebp)
+  801093:	e8 56 f7 ff ff       	call   8007ee <fd_close>
+		return r;
+  801098:	83 c4 10             	add    $0x10,%esp
+  80109b:	eb e5                	jmp    801082 <open+0x89>
+		return -E_BAD_PATH;
+  80109d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8010a2:	eb de                	jmp    801082 <open+0x89>
+
+008010a4 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	53                   	push   %ebx
+  8010a8:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010ae:	50                   	push   %eax
+  8010af:	ff 75 08             	push   0x8(%ebp)
+  8010b2:	e8 6a f6 ff ff       	call   800721 <fd_lookup>
+  8010b7:	89 c3                	mov    %eax,%ebx
+  8010b9:	83 c4 10             	add    $0x10,%esp
+  8010bc:	85 c0                	test   %eax,%eax
+  8010be:	78 5b                	js     80111b <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8010c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010c3:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8010c9:	39 08                	cmp    %ecx,(%eax)
+  8010cb:	75 55                	jne    801122 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010cd:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010d1:	74 56                	je     801129 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010d3:	83 ec 0c             	sub    $0xc,%esp
+  8010d6:	68 04 60 80 00       	push   $0x806004
+  8010db:	e8 82 17 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010ee:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010f3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010f6:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801100:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801105:	e8 d1 fb ff ff       	call   800cdb <fsipc>
+  80110a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80110c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801113:	e8 b7 17 00 00       	call   8028cf <mutex_unlock>
+	return r;
+  801118:	83 c4 10             	add    $0x10,%esp
+}
+  80111b:	89 d8                	mov    %ebx,%eax
+  80111d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801120:	c9                   	leave
+  801121:	c3                   	ret
+		return -E_NOT_SUPP;
+  801122:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801127:	eb f2                	jmp    80111b <fallocate+0x77>
+		return -E_INVAL;
+  801129:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80112e:	eb eb                	jmp    80111b <fallocate+0x77>
+
+00801130 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	56                   	push   %esi
+  801134:	53                   	push   %ebx
+  801135:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801138:	89 f3                	mov    %esi,%ebx
+  80113a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801140:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801143:	eb 06                	jmp    80114b <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801145:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80114b:	39 f3                	cmp    %esi,%ebx
+  80114d:	73 14                	jae    801163 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80114f:	83 ec 08             	sub    $0x8,%esp
+  801152:	53                   	push   %ebx
+  801153:	6a 00                	push   $0x0
+  801155:	e8 41 f1 ff ff       	call   80029b <sys_page_unmap>
+  80115a:	83 c4 10             	add    $0x10,%esp
+  80115d:	85 c0                	test   %eax,%eax
+  80115f:	79 e4                	jns    801145 <munmap+0x15>
+  801161:	eb 05                	jmp    801168 <munmap+0x38>
+			return r;
+	return 0;
+  801163:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801168:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116b:	5b                   	pop    %ebx
+  80116c:	5e                   	pop    %esi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <mmap>:
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	57                   	push   %edi
+  801173:	56                   	push   %esi
+  801174:	53                   	push   %ebx
+  801175:	83 ec 24             	sub    $0x24,%esp
+  801178:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80117b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80117e:	50                   	push   %eax
+  80117f:	ff 75 08             	push   0x8(%ebp)
+  801182:	e8 9a f5 ff ff       	call   800721 <fd_lookup>
+  801187:	83 c4 10             	add    $0x10,%esp
+  80118a:	85 c0                	test   %eax,%eax
+  80118c:	0f 88 37 01 00 00    	js     8012c9 <mmap+0x15a>
+		return NULL;
+  801192:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801197:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80119a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8011a0:	39 0a                	cmp    %ecx,(%edx)
+  8011a2:	0f 85 05 01 00 00    	jne    8012ad <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8011a8:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8011af:	0f 85 1b 01 00 00    	jne    8012d0 <mmap+0x161>
+  8011b5:	89 f0                	mov    %esi,%eax
+  8011b7:	83 e8 01             	sub    $0x1,%eax
+  8011ba:	0f 88 17 01 00 00    	js     8012d7 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8011c0:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8011c4:	75 28                	jne    8011ee <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8011c6:	83 ec 0c             	sub    $0xc,%esp
+  8011c9:	68 04 60 80 00       	push   $0x806004
+  8011ce:	e8 8f 16 00 00       	call   802862 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011d3:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011d9:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011df:	83 c4 10             	add    $0x10,%esp
+  8011e2:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011e7:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011ec:	eb 2b                	jmp    801219 <mmap+0xaa>
+		cow_enable();
+  8011ee:	e8 f7 2b 00 00       	call   803dea <cow_enable>
+  8011f3:	eb d1                	jmp    8011c6 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011f5:	89 c2                	mov    %eax,%edx
+  8011f7:	c1 ea 0c             	shr    $0xc,%edx
+  8011fa:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801201:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801207:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80120d:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801210:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801212:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801217:	77 25                	ja     80123e <mmap+0xcf>
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	29 da                	sub    %ebx,%edx
+  80121d:	39 ca                	cmp    %ecx,%edx
+  80121f:	73 3a                	jae    80125b <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801221:	89 c2                	mov    %eax,%edx
+  801223:	c1 ea 16             	shr    $0x16,%edx
+  801226:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80122d:	f6 c2 01             	test   $0x1,%dl
+  801230:	75 c3                	jne    8011f5 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801232:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801237:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80123c:	eb d4                	jmp    801212 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80123e:	29 d8                	sub    %ebx,%eax
+  801240:	39 c8                	cmp    %ecx,%eax
+  801242:	73 17                	jae    80125b <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	68 04 60 80 00       	push   $0x806004
+  80124c:	e8 7e 16 00 00       	call   8028cf <mutex_unlock>
+		return NULL;
+  801251:	83 c4 10             	add    $0x10,%esp
+  801254:	b8 00 00 00 00       	mov    $0x0,%eax
+  801259:	eb 52                	jmp    8012ad <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80125b:	85 db                	test   %ebx,%ebx
+  80125d:	74 e5                	je     801244 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80125f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801262:	8b 40 0c             	mov    0xc(%eax),%eax
+  801265:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80126a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80126d:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801272:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801278:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  80127e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801281:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801290:	e8 46 fa ff ff       	call   800cdb <fsipc>
+  801295:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801297:	83 ec 0c             	sub    $0xc,%esp
+  80129a:	68 04 60 80 00       	push   $0x806004
+  80129f:	e8 2b 16 00 00       	call   8028cf <mutex_unlock>
+	if (r < 0) {
+  8012a4:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8012a7:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8012a9:	85 ff                	test   %edi,%edi
+  8012ab:	78 08                	js     8012b5 <mmap+0x146>
+}
+  8012ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b0:	5b                   	pop    %ebx
+  8012b1:	5e                   	pop    %esi
+  8012b2:	5f                   	pop    %edi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+		munmap((void*) va, len);
+  8012b5:	83 ec 08             	sub    $0x8,%esp
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+  8012ba:	e8 71 fe ff ff       	call   801130 <munmap>
+		return NULL;
+  8012bf:	83 c4 10             	add    $0x10,%esp
+  8012c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c7:	eb e4                	jmp    8012ad <mmap+0x13e>
+		return NULL;
+  8012c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ce:	eb dd                	jmp    8012ad <mmap+0x13e>
+		return NULL;
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d5:	eb d6                	jmp    8012ad <mmap+0x13e>
+  8012d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dc:	eb cf                	jmp    8012ad <mmap+0x13e>
+
+008012de <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 10             	sub    $0x10,%esp
+  8012e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012e8:	53                   	push   %ebx
+  8012e9:	e8 78 25 00 00       	call   803866 <strlen>
+  8012ee:	83 c4 10             	add    $0x10,%esp
+  8012f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012f6:	7f 42                	jg     80133a <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012f8:	83 ec 0c             	sub    $0xc,%esp
+  8012fb:	68 04 60 80 00       	push   $0x806004
+  801300:	e8 5d 15 00 00       	call   802862 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801305:	83 c4 08             	add    $0x8,%esp
+  801308:	53                   	push   %ebx
+  801309:	68 00 70 80 00       	push   $0x807000
+  80130e:	e8 8e 25 00 00       	call   8038a1 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801313:	ba 00 00 00 00       	mov    $0x0,%edx
+  801318:	b8 07 00 00 00       	mov    $0x7,%eax
+  80131d:	e8 b9 f9 ff ff       	call   800cdb <fsipc>
+  801322:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801324:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80132b:	e8 9f 15 00 00       	call   8028cf <mutex_unlock>
+	return r;
+  801330:	83 c4 10             	add    $0x10,%esp
+}
+  801333:	89 d8                	mov    %ebx,%eax
+  801335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+		return -E_BAD_PATH;
+  80133a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80133f:	eb f2                	jmp    801333 <remove+0x55>
+
+00801341 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	53                   	push   %ebx
+  801345:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801348:	68 04 60 80 00       	push   $0x806004
+  80134d:	e8 10 15 00 00       	call   802862 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801352:	ba 00 00 00 00       	mov    $0x0,%edx
+  801357:	b8 08 00 00 00       	mov    $0x8,%eax
+  80135c:	e8 7a f9 ff ff       	call   800cdb <fsipc>
+  801361:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801363:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80136a:	e8 60 15 00 00       	call   8028cf <mutex_unlock>
+	return r;
+}
+  80136f:	89 d8                	mov    %ebx,%eax
+  801371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801374:	c9                   	leave
+  801375:	c3                   	ret
+
+00801376 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	56                   	push   %esi
+  80137a:	53                   	push   %ebx
+  80137b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80137e:	83 ec 0c             	sub    $0xc,%esp
+  801381:	68 04 60 80 00       	push   $0x806004
+  801386:	e8 d7 14 00 00       	call   802862 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80138b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80138e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801393:	ba 00 00 00 00       	mov    $0x0,%edx
+  801398:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139d:	e8 39 f9 ff ff       	call   800cdb <fsipc>
+  8013a2:	89 c6                	mov    %eax,%esi
+  8013a4:	83 c4 10             	add    $0x10,%esp
+  8013a7:	85 db                	test   %ebx,%ebx
+  8013a9:	74 7b                	je     801426 <fs_bcstat+0xb0>
+  8013ab:	85 c0                	test   %eax,%eax
+  8013ad:	78 77                	js     801426 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8013af:	a1 00 70 80 00       	mov    0x807000,%eax
+  8013b4:	89 03                	mov    %eax,(%ebx)
+  8013b6:	a1 04 70 80 00       	mov    0x807004,%eax
+  8013bb:	89 43 04             	mov    %eax,0x4(%ebx)
+  8013be:	a1 08 70 80 00       	mov    0x807008,%eax
+  8013c3:	89 43 08             	mov    %eax,0x8(%ebx)
+  8013c6:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013cb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013ce:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013d3:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013d6:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013db:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013de:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013e3:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013e6:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013eb:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013ee:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013f3:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013f6:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013fb:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013fe:	a1 28 70 80 00       	mov    0x807028,%eax
+  801403:	89 43 28             	mov    %eax,0x28(%ebx)
+  801406:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  80140b:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80140e:	a1 30 70 80 00       	mov    0x807030,%eax
+  801413:	89 43 30             	mov    %eax,0x30(%ebx)
+  801416:	a1 34 70 80 00       	mov    0x807034,%eax
+  80141b:	89 43 34             	mov    %eax,0x34(%ebx)
+  80141e:	a1 38 70 80 00       	mov    0x807038,%eax
+  801423:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801426:	83 ec 0c             	sub    $0xc,%esp
+  801429:	68 04 60 80 00       	push   $0x806004
+  80142e:	e8 9c 14 00 00       	call   8028cf <mutex_unlock>
+	return r;
+}
+  801433:	89 f0                	mov    %esi,%eax
+  801435:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801438:	5b                   	pop    %ebx
+  801439:	5e                   	pop    %esi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+
+0080143c <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801443:	0f b6 10             	movzbl (%eax),%edx
+  801446:	80 fa 72             	cmp    $0x72,%dl
+  801449:	74 44                	je     80148f <parse_mode+0x53>
+  80144b:	80 fa 77             	cmp    $0x77,%dl
+  80144e:	74 4b                	je     80149b <parse_mode+0x5f>
+  801450:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801455:	80 fa 61             	cmp    $0x61,%dl
+  801458:	74 09                	je     801463 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80145a:	89 d8                	mov    %ebx,%eax
+  80145c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80145f:	5b                   	pop    %ebx
+  801460:	5e                   	pop    %esi
+  801461:	5d                   	pop    %ebp
+  801462:	c3                   	ret
+	switch (mode[0]) {
+  801463:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801468:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80146d:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80146f:	83 ec 08             	sub    $0x8,%esp
+  801472:	6a 2b                	push   $0x2b
+  801474:	50                   	push   %eax
+  801475:	e8 39 25 00 00       	call   8039b3 <strchr>
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	74 d9                	je     80145a <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801481:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801484:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801487:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80148d:	eb cb                	jmp    80145a <parse_mode+0x1e>
+	switch (mode[0]) {
+  80148f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	eb d2                	jmp    80146d <parse_mode+0x31>
+  80149b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8014a0:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8014a5:	eb c6                	jmp    80146d <parse_mode+0x31>
+
+008014a7 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	57                   	push   %edi
+  8014ab:	56                   	push   %esi
+  8014ac:	53                   	push   %ebx
+  8014ad:	83 ec 1c             	sub    $0x1c,%esp
+  8014b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014b3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014b6:	b8 24 50 80 00       	mov    $0x805024,%eax
+  8014bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8014c0:	83 c0 24             	add    $0x24,%eax
+  8014c3:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014c7:	74 17                	je     8014e0 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014c9:	83 c3 01             	add    $0x1,%ebx
+  8014cc:	83 fb 10             	cmp    $0x10,%ebx
+  8014cf:	75 ef                	jne    8014c0 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014d1:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014d6:	89 f0                	mov    %esi,%eax
+  8014d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014db:	5b                   	pop    %ebx
+  8014dc:	5e                   	pop    %esi
+  8014dd:	5f                   	pop    %edi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014e0:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014e7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014ea:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014ed:	c1 e7 02             	shl    $0x2,%edi
+  8014f0:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014f6:	83 ec 04             	sub    $0x4,%esp
+  8014f9:	6a 24                	push   $0x24
+  8014fb:	6a 00                	push   $0x0
+  8014fd:	56                   	push   %esi
+  8014fe:	e8 ef 24 00 00       	call   8039f2 <memset>
+			streams[i].f_fd = fd;
+  801503:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801506:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  80150c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80150f:	01 d8                	add    %ebx,%eax
+  801511:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801514:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	eb b6                	jmp    8014d6 <stream_alloc+0x2f>
+
+00801520 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	53                   	push   %ebx
+  801524:	83 ec 14             	sub    $0x14,%esp
+  801527:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801529:	8b 40 18             	mov    0x18(%eax),%eax
+  80152c:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80152f:	74 4a                	je     80157b <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	ff 33                	push   (%ebx)
+  80153a:	e8 e2 f1 ff ff       	call   800721 <fd_lookup>
+  80153f:	89 c2                	mov    %eax,%edx
+  801541:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801544:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801549:	85 d2                	test   %edx,%edx
+  80154b:	78 41                	js     80158e <stream_unread+0x6e>
+  80154d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801550:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801556:	39 0a                	cmp    %ecx,(%edx)
+  801558:	75 34                	jne    80158e <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80155a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80155d:	03 42 04             	add    0x4(%edx),%eax
+  801560:	2b 43 18             	sub    0x18(%ebx),%eax
+  801563:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801566:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80156d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801574:	b8 01 00 00 00       	mov    $0x1,%eax
+  801579:	eb 13                	jmp    80158e <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80157b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801582:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801589:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80158e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+
+00801593 <stream_drain>:
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	56                   	push   %esi
+  801597:	53                   	push   %ebx
+  801598:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80159a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159f:	eb 02                	jmp    8015a3 <stream_drain+0x10>
+  8015a1:	01 c3                	add    %eax,%ebx
+  8015a3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015a6:	39 c3                	cmp    %eax,%ebx
+  8015a8:	73 43                	jae    8015ed <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	29 d8                	sub    %ebx,%eax
+  8015af:	50                   	push   %eax
+  8015b0:	89 d8                	mov    %ebx,%eax
+  8015b2:	03 46 0c             	add    0xc(%esi),%eax
+  8015b5:	50                   	push   %eax
+  8015b6:	ff 36                	push   (%esi)
+  8015b8:	e8 ec f4 ff ff       	call   800aa9 <write>
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	7f dd                	jg     8015a1 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8015c4:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015c8:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015cb:	83 ec 04             	sub    $0x4,%esp
+  8015ce:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015d1:	29 d8                	sub    %ebx,%eax
+  8015d3:	50                   	push   %eax
+  8015d4:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015d7:	50                   	push   %eax
+  8015d8:	52                   	push   %edx
+  8015d9:	e8 49 24 00 00       	call   803a27 <memmove>
+			f->f_wend -= done;
+  8015de:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015e1:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015e3:	83 c4 10             	add    $0x10,%esp
+  8015e6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015eb:	eb 0a                	jmp    8015f7 <stream_drain+0x64>
+  8015ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015f2:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015f7:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015fa:	89 d0                	mov    %edx,%eax
+  8015fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ff:	5b                   	pop    %ebx
+  801600:	5e                   	pop    %esi
+  801601:	5d                   	pop    %ebp
+  801602:	c3                   	ret
+
+00801603 <stream_setup>:
+	if (f->f_buf)
+  801603:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801607:	74 01                	je     80160a <stream_setup+0x7>
+  801609:	c3                   	ret
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	53                   	push   %ebx
+  80160e:	83 ec 04             	sub    $0x4,%esp
+  801611:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801613:	8b 40 08             	mov    0x8(%eax),%eax
+  801616:	85 c0                	test   %eax,%eax
+  801618:	74 17                	je     801631 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80161a:	83 f8 03             	cmp    $0x3,%eax
+  80161d:	75 2d                	jne    80164c <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80161f:	8d 43 20             	lea    0x20(%ebx),%eax
+  801622:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801625:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80162c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801631:	83 ec 0c             	sub    $0xc,%esp
+  801634:	ff 33                	push   (%ebx)
+  801636:	e8 29 1b 00 00       	call   803164 <iscons>
+  80163b:	83 c4 10             	add    $0x10,%esp
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	0f 9f c0             	setg   %al
+  801643:	0f b6 c0             	movzbl %al,%eax
+  801646:	83 c0 01             	add    $0x1,%eax
+  801649:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	68 00 10 00 00       	push   $0x1000
+  801654:	e8 6e 0b 00 00       	call   8021c7 <malloc>
+  801659:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	74 bc                	je     80161f <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801663:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80166a:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80166e:	eb bc                	jmp    80162c <stream_setup+0x29>
+
+00801670 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	53                   	push   %ebx
+  801674:	83 ec 04             	sub    $0x4,%esp
+  801677:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  801679:	e8 85 ff ff ff       	call   801603 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80167e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801683:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801687:	74 3d                	je     8016c6 <stream_fill+0x56>
+  801689:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80168d:	74 10                	je     80169f <stream_fill+0x2f>
+  80168f:	89 d8                	mov    %ebx,%eax
+  801691:	e8 fd fe ff ff       	call   801593 <stream_drain>
+		return 0;
+  801696:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	78 27                	js     8016c6 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80169f:	83 ec 04             	sub    $0x4,%esp
+  8016a2:	ff 73 10             	push   0x10(%ebx)
+  8016a5:	ff 73 0c             	push   0xc(%ebx)
+  8016a8:	ff 33                	push   (%ebx)
+  8016aa:	e8 02 f3 ff ff       	call   8009b1 <read>
+  8016af:	83 c4 10             	add    $0x10,%esp
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	7e 17                	jle    8016cd <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8016b6:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8016ba:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8016c1:	89 c2                	mov    %eax,%edx
+  8016c3:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8016c6:	89 d0                	mov    %edx,%eax
+  8016c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016cd:	c1 f8 1f             	sar    $0x1f,%eax
+  8016d0:	83 e0 04             	and    $0x4,%eax
+  8016d3:	83 c0 04             	add    $0x4,%eax
+  8016d6:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016de:	eb e6                	jmp    8016c6 <stream_fill+0x56>
+
+008016e0 <fopen>:
+{
+  8016e0:	55                   	push   %ebp
+  8016e1:	89 e5                	mov    %esp,%ebp
+  8016e3:	57                   	push   %edi
+  8016e4:	56                   	push   %esi
+  8016e5:	53                   	push   %ebx
+  8016e6:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016ef:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016f5:	89 f0                	mov    %esi,%eax
+  8016f7:	e8 40 fd ff ff       	call   80143c <parse_mode>
+		return 0;
+  8016fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 2d                	js     801732 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  801705:	83 ec 08             	sub    $0x8,%esp
+  801708:	50                   	push   %eax
+  801709:	ff 75 08             	push   0x8(%ebp)
+  80170c:	e8 e8 f8 ff ff       	call   800ff9 <open>
+  801711:	89 c7                	mov    %eax,%edi
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 58                	js     801772 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80171a:	80 3e 61             	cmpb   $0x61,(%esi)
+  80171d:	74 1d                	je     80173c <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80171f:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  801725:	89 f8                	mov    %edi,%eax
+  801727:	e8 7b fd ff ff       	call   8014a7 <stream_alloc>
+  80172c:	89 c3                	mov    %eax,%ebx
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	74 32                	je     801764 <fopen+0x84>
+}
+  801732:	89 d8                	mov    %ebx,%eax
+  801734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801737:	5b                   	pop    %ebx
+  801738:	5e                   	pop    %esi
+  801739:	5f                   	pop    %edi
+  80173a:	5d                   	pop    %ebp
+  80173b:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80173c:	83 ec 08             	sub    $0x8,%esp
+  80173f:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801745:	50                   	push   %eax
+  801746:	57                   	push   %edi
+  801747:	e8 db f4 ff ff       	call   800c27 <fstat>
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	78 cc                	js     80171f <fopen+0x3f>
+		seek(fd, st.st_size);
+  801753:	83 ec 08             	sub    $0x8,%esp
+  801756:	ff 75 dc             	push   -0x24(%ebp)
+  801759:	57                   	push   %edi
+  80175a:	e8 f6 f3 ff ff       	call   800b55 <seek>
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	eb bb                	jmp    80171f <fopen+0x3f>
+		close(fd);
+  801764:	83 ec 0c             	sub    $0xc,%esp
+  801767:	57                   	push   %edi
+  801768:	e8 08 f1 ff ff       	call   800875 <close>
+  80176d:	83 c4 10             	add    $0x10,%esp
+  801770:	eb c0                	jmp    801732 <fopen+0x52>
+		return 0;
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	eb b9                	jmp    801732 <fopen+0x52>
+
+00801779 <fdopen>:
+{
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80177f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801782:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801785:	e8 b2 fc ff ff       	call   80143c <parse_mode>
+  80178a:	89 c2                	mov    %eax,%edx
+		return 0;
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801791:	85 d2                	test   %edx,%edx
+  801793:	78 0b                	js     8017a0 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  801795:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179b:	e8 07 fd ff ff       	call   8014a7 <stream_alloc>
+}
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+
+008017a2 <setvbuf>:
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	57                   	push   %edi
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+  8017a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  8017ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8017b1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8017b5:	75 3a                	jne    8017f1 <setvbuf+0x4f>
+  8017b7:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8017ba:	83 fe 02             	cmp    $0x2,%esi
+  8017bd:	77 39                	ja     8017f8 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8017bf:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8017c2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8017c6:	0f 95 c3             	setne  %bl
+  8017c9:	85 ff                	test   %edi,%edi
+  8017cb:	0f 95 c1             	setne  %cl
+  8017ce:	84 cb                	test   %cl,%bl
+  8017d0:	74 05                	je     8017d7 <setvbuf+0x35>
+  8017d2:	83 fa 03             	cmp    $0x3,%edx
+  8017d5:	75 0a                	jne    8017e1 <setvbuf+0x3f>
+	return 0;
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5f                   	pop    %edi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		f->f_buf = buf;
+  8017e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e4:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017e7:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ef:	eb eb                	jmp    8017dc <setvbuf+0x3a>
+		return EOF;
+  8017f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017f6:	eb e4                	jmp    8017dc <setvbuf+0x3a>
+  8017f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017fd:	eb dd                	jmp    8017dc <setvbuf+0x3a>
+
+008017ff <fflush>:
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	57                   	push   %edi
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80180b:	85 db                	test   %ebx,%ebx
+  80180d:	74 1a                	je     801829 <fflush+0x2a>
+	stream_unread(f);
+  80180f:	89 d8                	mov    %ebx,%eax
+  801811:	e8 0a fd ff ff       	call   801520 <stream_unread>
+	return stream_drain(f);
+  801816:	89 d8                	mov    %ebx,%eax
+  801818:	e8 76 fd ff ff       	call   801593 <stream_drain>
+  80181d:	89 c7                	mov    %eax,%edi
+}
+  80181f:	89 f8                	mov    %edi,%eax
+  801821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801824:	5b                   	pop    %ebx
+  801825:	5e                   	pop    %esi
+  801826:	5f                   	pop    %edi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+  801829:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  80182e:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801833:	bf 00 00 00 00       	mov    $0x0,%edi
+  801838:	eb 03                	jmp    80183d <fflush+0x3e>
+  80183a:	83 c3 24             	add    $0x24,%ebx
+  80183d:	39 f3                	cmp    %esi,%ebx
+  80183f:	74 de                	je     80181f <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801841:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  801845:	74 f3                	je     80183a <fflush+0x3b>
+  801847:	83 ec 0c             	sub    $0xc,%esp
+  80184a:	53                   	push   %ebx
+  80184b:	e8 af ff ff ff       	call   8017ff <fflush>
+  801850:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801853:	85 c0                	test   %eax,%eax
+  801855:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80185a:	0f 48 f8             	cmovs  %eax,%edi
+  80185d:	eb db                	jmp    80183a <fflush+0x3b>
+
+0080185f <fclose>:
+{
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	56                   	push   %esi
+  801863:	53                   	push   %ebx
+  801864:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801867:	83 ec 0c             	sub    $0xc,%esp
+  80186a:	56                   	push   %esi
+  80186b:	e8 8f ff ff ff       	call   8017ff <fflush>
+  801870:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801872:	83 c4 04             	add    $0x4,%esp
+  801875:	ff 36                	push   (%esi)
+  801877:	e8 f9 ef ff ff       	call   800875 <close>
+  80187c:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801886:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  801889:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80188d:	75 10                	jne    80189f <fclose+0x40>
+	f->f_flags = 0;
+  80188f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  801896:	89 d8                	mov    %ebx,%eax
+  801898:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189b:	5b                   	pop    %ebx
+  80189c:	5e                   	pop    %esi
+  80189d:	5d                   	pop    %ebp
+  80189e:	c3                   	ret
+		free(f->f_buf);
+  80189f:	83 ec 0c             	sub    $0xc,%esp
+  8018a2:	ff 76 0c             	push   0xc(%esi)
+  8018a5:	e8 54 08 00 00       	call   8020fe <free>
+  8018aa:	83 c4 10             	add    $0x10,%esp
+  8018ad:	eb e0                	jmp    80188f <fclose+0x30>
+
+008018af <fileno>:
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8018b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b5:	8b 00                	mov    (%eax),%eax
+}
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+
+008018b9 <feof>:
+{
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8018bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bf:	8b 40 04             	mov    0x4(%eax),%eax
+  8018c2:	c1 e8 02             	shr    $0x2,%eax
+  8018c5:	83 e0 01             	and    $0x1,%eax
+}
+  8018c8:	5d                   	pop    %ebp
+  8018c9:	c3                   	ret
+
+008018ca <ferror>:
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d0:	8b 40 04             	mov    0x4(%eax),%eax
+  8018d3:	c1 e8 03             	shr    $0x3,%eax
+  8018d6:	83 e0 01             	and    $0x1,%eax
+}
+  8018d9:	5d                   	pop    %ebp
+  8018da:	c3                   	ret
+
+008018db <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	53                   	push   %ebx
+  8018df:	83 ec 04             	sub    $0x4,%esp
+  8018e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018e5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018e8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018eb:	74 15                	je     801902 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018ed:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018f0:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018f3:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018f6:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018f9:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801900:	c9                   	leave
+  801901:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801902:	89 d8                	mov    %ebx,%eax
+  801904:	e8 67 fd ff ff       	call   801670 <stream_fill>
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	75 e0                	jne    8018ed <fgetc+0x12>
+		return EOF;
+  80190d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801912:	eb e9                	jmp    8018fd <fgetc+0x22>
+
+00801914 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  801914:	55                   	push   %ebp
+  801915:	89 e5                	mov    %esp,%ebp
+  801917:	57                   	push   %edi
+  801918:	56                   	push   %esi
+  801919:	53                   	push   %ebx
+  80191a:	83 ec 1c             	sub    $0x1c,%esp
+  80191d:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801920:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801925:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801928:	83 e8 01             	sub    $0x1,%eax
+  80192b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80192e:	eb 66                	jmp    801996 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801930:	8b 46 14             	mov    0x14(%esi),%eax
+  801933:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801936:	29 c3                	sub    %eax,%ebx
+  801938:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80193b:	29 fa                	sub    %edi,%edx
+  80193d:	39 d3                	cmp    %edx,%ebx
+  80193f:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801942:	83 ec 04             	sub    $0x4,%esp
+  801945:	53                   	push   %ebx
+  801946:	6a 0a                	push   $0xa
+  801948:	03 46 0c             	add    0xc(%esi),%eax
+  80194b:	50                   	push   %eax
+  80194c:	e8 87 21 00 00       	call   803ad8 <memfind>
+  801951:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801954:	8b 46 0c             	mov    0xc(%esi),%eax
+  801957:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80195a:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80195d:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  801965:	74 0b                	je     801972 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801967:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80196a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80196d:	29 d3                	sub    %edx,%ebx
+  80196f:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801972:	83 ec 04             	sub    $0x4,%esp
+  801975:	53                   	push   %ebx
+  801976:	01 c8                	add    %ecx,%eax
+  801978:	50                   	push   %eax
+  801979:	89 f8                	mov    %edi,%eax
+  80197b:	03 45 08             	add    0x8(%ebp),%eax
+  80197e:	50                   	push   %eax
+  80197f:	e8 a3 20 00 00       	call   803a27 <memmove>
+		f->f_rpos += m;
+  801984:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801987:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198f:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801994:	74 1f                	je     8019b5 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  801996:	8d 47 01             	lea    0x1(%edi),%eax
+  801999:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80199c:	73 17                	jae    8019b5 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80199e:	8b 46 18             	mov    0x18(%esi),%eax
+  8019a1:	39 46 14             	cmp    %eax,0x14(%esi)
+  8019a4:	75 8a                	jne    801930 <fgets+0x1c>
+  8019a6:	89 f0                	mov    %esi,%eax
+  8019a8:	e8 c3 fc ff ff       	call   801670 <stream_fill>
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	0f 85 7b ff ff ff    	jne    801930 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8019b5:	85 ff                	test   %edi,%edi
+  8019b7:	74 0f                	je     8019c8 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8019b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019bc:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8019c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c3:	5b                   	pop    %ebx
+  8019c4:	5e                   	pop    %esi
+  8019c5:	5f                   	pop    %edi
+  8019c6:	5d                   	pop    %ebp
+  8019c7:	c3                   	ret
+		return 0;
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cd:	eb f1                	jmp    8019c0 <fgets+0xac>
+
+008019cf <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019cf:	55                   	push   %ebp
+  8019d0:	89 e5                	mov    %esp,%ebp
+  8019d2:	57                   	push   %edi
+  8019d3:	56                   	push   %esi
+  8019d4:	53                   	push   %ebx
+  8019d5:	83 ec 1c             	sub    $0x1c,%esp
+  8019d8:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019db:	89 f0                	mov    %esi,%eax
+  8019dd:	e8 21 fc ff ff       	call   801603 <stream_setup>
+	want = size * n;
+  8019e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e5:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f1:	eb 43                	jmp    801a36 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019f3:	29 d3                	sub    %edx,%ebx
+  8019f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019f8:	29 f8                	sub    %edi,%eax
+  8019fa:	39 c3                	cmp    %eax,%ebx
+  8019fc:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019ff:	83 ec 04             	sub    $0x4,%esp
+  801a02:	53                   	push   %ebx
+  801a03:	03 56 0c             	add    0xc(%esi),%edx
+  801a06:	52                   	push   %edx
+  801a07:	89 f8                	mov    %edi,%eax
+  801a09:	03 45 08             	add    0x8(%ebp),%eax
+  801a0c:	50                   	push   %eax
+  801a0d:	e8 15 20 00 00       	call   803a27 <memmove>
+			f->f_rpos += m;
+  801a12:	01 5e 14             	add    %ebx,0x14(%esi)
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	eb 1a                	jmp    801a34 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  801a1a:	83 ec 04             	sub    $0x4,%esp
+  801a1d:	53                   	push   %ebx
+  801a1e:	89 f8                	mov    %edi,%eax
+  801a20:	03 45 08             	add    0x8(%ebp),%eax
+  801a23:	50                   	push   %eax
+  801a24:	ff 36                	push   (%esi)
+  801a26:	e8 86 ef ff ff       	call   8009b1 <read>
+  801a2b:	89 c3                	mov    %eax,%ebx
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	7e 36                	jle    801a6a <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a34:	01 df                	add    %ebx,%edi
+  801a36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a39:	39 c7                	cmp    %eax,%edi
+  801a3b:	73 39                	jae    801a76 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a3d:	8b 56 14             	mov    0x14(%esi),%edx
+  801a40:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a43:	39 da                	cmp    %ebx,%edx
+  801a45:	72 ac                	jb     8019f3 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a47:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a4a:	29 fb                	sub    %edi,%ebx
+  801a4c:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a4f:	72 3e                	jb     801a8f <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a51:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a55:	74 1f                	je     801a76 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a57:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a5b:	74 bd                	je     801a1a <fread+0x4b>
+  801a5d:	89 f0                	mov    %esi,%eax
+  801a5f:	e8 2f fb ff ff       	call   801593 <stream_drain>
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	79 b2                	jns    801a1a <fread+0x4b>
+  801a68:	eb 0c                	jmp    801a76 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a6a:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a6d:	83 e3 04             	and    $0x4,%ebx
+  801a70:	83 c3 04             	add    $0x4,%ebx
+  801a73:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	74 0a                	je     801a87 <fread+0xb8>
+  801a7d:	89 f8                	mov    %edi,%eax
+  801a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a84:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8a:	5b                   	pop    %ebx
+  801a8b:	5e                   	pop    %esi
+  801a8c:	5f                   	pop    %edi
+  801a8d:	5d                   	pop    %ebp
+  801a8e:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a8f:	89 f0                	mov    %esi,%eax
+  801a91:	e8 da fb ff ff       	call   801670 <stream_fill>
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	74 dc                	je     801a76 <fread+0xa7>
+			m = 0;
+  801a9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9f:	eb 93                	jmp    801a34 <fread+0x65>
+
+00801aa1 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801aa1:	55                   	push   %ebp
+  801aa2:	89 e5                	mov    %esp,%ebp
+  801aa4:	57                   	push   %edi
+  801aa5:	56                   	push   %esi
+  801aa6:	53                   	push   %ebx
+  801aa7:	83 ec 1c             	sub    $0x1c,%esp
+  801aaa:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801aad:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ab0:	a8 02                	test   $0x2,%al
+  801ab2:	75 13                	jne    801ac7 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801ab4:	83 c8 08             	or     $0x8,%eax
+  801ab7:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801aba:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac2:	5b                   	pop    %ebx
+  801ac3:	5e                   	pop    %esi
+  801ac4:	5f                   	pop    %edi
+  801ac5:	5d                   	pop    %ebp
+  801ac6:	c3                   	ret
+	stream_setup(f);
+  801ac7:	89 d8                	mov    %ebx,%eax
+  801ac9:	e8 35 fb ff ff       	call   801603 <stream_setup>
+	want = size * n;
+  801ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad1:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801ad5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801ad8:	89 d8                	mov    %ebx,%eax
+  801ada:	e8 41 fa ff ff       	call   801520 <stream_unread>
+	for (done = 0; done < want; ) {
+  801adf:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ae4:	84 c0                	test   %al,%al
+  801ae6:	75 7b                	jne    801b63 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ae8:	be 00 00 00 00       	mov    $0x0,%esi
+  801aed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801af0:	39 fe                	cmp    %edi,%esi
+  801af2:	73 24                	jae    801b18 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801af4:	83 ec 04             	sub    $0x4,%esp
+  801af7:	89 f8                	mov    %edi,%eax
+  801af9:	29 f0                	sub    %esi,%eax
+  801afb:	50                   	push   %eax
+  801afc:	89 f0                	mov    %esi,%eax
+  801afe:	03 45 08             	add    0x8(%ebp),%eax
+  801b01:	50                   	push   %eax
+  801b02:	ff 33                	push   (%ebx)
+  801b04:	e8 a0 ef ff ff       	call   800aa9 <write>
+  801b09:	83 c4 10             	add    $0x10,%esp
+  801b0c:	85 c0                	test   %eax,%eax
+  801b0e:	7e 04                	jle    801b14 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801b10:	01 c6                	add    %eax,%esi
+  801b12:	eb dc                	jmp    801af0 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801b14:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801b18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	74 a0                	je     801abf <fwrite+0x1e>
+  801b1f:	89 f0                	mov    %esi,%eax
+  801b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b26:	f7 75 0c             	divl   0xc(%ebp)
+  801b29:	eb 94                	jmp    801abf <fwrite+0x1e>
+			done += r;
+  801b2b:	01 c7                	add    %eax,%edi
+			continue;
+  801b2d:	eb 34                	jmp    801b63 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b2f:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b32:	29 c6                	sub    %eax,%esi
+  801b34:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b37:	29 fa                	sub    %edi,%edx
+  801b39:	39 d6                	cmp    %edx,%esi
+  801b3b:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b3e:	83 ec 04             	sub    $0x4,%esp
+  801b41:	56                   	push   %esi
+  801b42:	89 fa                	mov    %edi,%edx
+  801b44:	03 55 08             	add    0x8(%ebp),%edx
+  801b47:	52                   	push   %edx
+  801b48:	03 43 0c             	add    0xc(%ebx),%eax
+  801b4b:	50                   	push   %eax
+  801b4c:	e8 d6 1e 00 00       	call   803a27 <memmove>
+		f->f_wend += m;
+  801b51:	89 f0                	mov    %esi,%eax
+  801b53:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b56:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b59:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b61:	74 5b                	je     801bbe <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b66:	39 c7                	cmp    %eax,%edi
+  801b68:	73 2d                	jae    801b97 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b6a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	75 be                	jne    801b2f <fwrite+0x8e>
+  801b71:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b74:	29 fa                	sub    %edi,%edx
+  801b76:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b79:	72 b4                	jb     801b2f <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b7b:	83 ec 04             	sub    $0x4,%esp
+  801b7e:	52                   	push   %edx
+  801b7f:	89 f8                	mov    %edi,%eax
+  801b81:	03 45 08             	add    0x8(%ebp),%eax
+  801b84:	50                   	push   %eax
+  801b85:	ff 33                	push   (%ebx)
+  801b87:	e8 1d ef ff ff       	call   800aa9 <write>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	7f 98                	jg     801b2b <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b93:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b97:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b9a:	83 f8 03             	cmp    $0x3,%eax
+  801b9d:	74 48                	je     801be7 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b9f:	83 f8 02             	cmp    $0x2,%eax
+  801ba2:	74 27                	je     801bcb <fwrite+0x12a>
+	return size ? done / size : 0;
+  801ba4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ba7:	85 c0                	test   %eax,%eax
+  801ba9:	0f 84 10 ff ff ff    	je     801abf <fwrite+0x1e>
+  801baf:	89 f8                	mov    %edi,%eax
+  801bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb6:	f7 75 0c             	divl   0xc(%ebp)
+  801bb9:	e9 01 ff ff ff       	jmp    801abf <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801bbe:	89 d8                	mov    %ebx,%eax
+  801bc0:	e8 ce f9 ff ff       	call   801593 <stream_drain>
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	79 9a                	jns    801b63 <fwrite+0xc2>
+  801bc9:	eb cc                	jmp    801b97 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801bcb:	83 ec 04             	sub    $0x4,%esp
+  801bce:	57                   	push   %edi
+  801bcf:	6a 0a                	push   $0xa
+  801bd1:	ff 75 08             	push   0x8(%ebp)
+  801bd4:	e8 ff 1e 00 00       	call   803ad8 <memfind>
+  801bd9:	89 c2                	mov    %eax,%edx
+  801bdb:	89 f8                	mov    %edi,%eax
+  801bdd:	03 45 08             	add    0x8(%ebp),%eax
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	39 c2                	cmp    %eax,%edx
+  801be5:	74 bd                	je     801ba4 <fwrite+0x103>
+		stream_drain(f);
+  801be7:	89 d8                	mov    %ebx,%eax
+  801be9:	e8 a5 f9 ff ff       	call   801593 <stream_drain>
+  801bee:	eb b4                	jmp    801ba4 <fwrite+0x103>
+
+00801bf0 <fputc>:
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	53                   	push   %ebx
+  801bf4:	83 ec 14             	sub    $0x14,%esp
+  801bf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bfa:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bfd:	ff 75 0c             	push   0xc(%ebp)
+  801c00:	6a 01                	push   $0x1
+  801c02:	6a 01                	push   $0x1
+  801c04:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801c07:	50                   	push   %eax
+  801c08:	e8 94 fe ff ff       	call   801aa1 <fwrite>
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	0f b6 db             	movzbl %bl,%ebx
+  801c13:	83 f8 01             	cmp    $0x1,%eax
+  801c16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c1b:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+00801c23 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c29:	ff 75 0c             	push   0xc(%ebp)
+  801c2c:	ff 75 08             	push   0x8(%ebp)
+  801c2f:	e8 bc ff ff ff       	call   801bf0 <fputc>
+}
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	c9                   	leave
+  801c38:	c3                   	ret
+
+00801c39 <fputs>:
+{
+  801c39:	55                   	push   %ebp
+  801c3a:	89 e5                	mov    %esp,%ebp
+  801c3c:	56                   	push   %esi
+  801c3d:	53                   	push   %ebx
+  801c3e:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c41:	83 ec 0c             	sub    $0xc,%esp
+  801c44:	56                   	push   %esi
+  801c45:	e8 1c 1c 00 00       	call   803866 <strlen>
+  801c4a:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c4c:	ff 75 0c             	push   0xc(%ebp)
+  801c4f:	50                   	push   %eax
+  801c50:	6a 01                	push   $0x1
+  801c52:	56                   	push   %esi
+  801c53:	e8 49 fe ff ff       	call   801aa1 <fwrite>
+  801c58:	83 c4 20             	add    $0x20,%esp
+  801c5b:	39 d8                	cmp    %ebx,%eax
+  801c5d:	0f 95 c0             	setne  %al
+  801c60:	0f b6 c0             	movzbl %al,%eax
+  801c63:	f7 d8                	neg    %eax
+}
+  801c65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c68:	5b                   	pop    %ebx
+  801c69:	5e                   	pop    %esi
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+
+00801c6c <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	53                   	push   %ebx
+  801c70:	83 ec 04             	sub    $0x4,%esp
+  801c73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c76:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c79:	50                   	push   %eax
+  801c7a:	ff 75 0c             	push   0xc(%ebp)
+  801c7d:	53                   	push   %ebx
+  801c7e:	68 23 1c 80 00       	push   $0x801c23
+  801c83:	e8 2c 17 00 00       	call   8033b4 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c88:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c8b:	c1 e0 1c             	shl    $0x1c,%eax
+  801c8e:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+
+00801c96 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c96:	55                   	push   %ebp
+  801c97:	89 e5                	mov    %esp,%ebp
+  801c99:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c9c:	68 10 48 80 00       	push   $0x804810
+  801ca1:	ff 75 0c             	push   0xc(%ebp)
+  801ca4:	e8 f8 1b 00 00       	call   8038a1 <strcpy>
+	return 0;
+}
+  801ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cae:	c9                   	leave
+  801caf:	c3                   	ret
+
+00801cb0 <devsock_close>:
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 10             	sub    $0x10,%esp
+  801cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cba:	53                   	push   %ebx
+  801cbb:	e8 26 27 00 00       	call   8043e6 <pageref>
+  801cc0:	89 c2                	mov    %eax,%edx
+  801cc2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cca:	83 fa 01             	cmp    $0x1,%edx
+  801ccd:	74 05                	je     801cd4 <devsock_close+0x24>
+}
+  801ccf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd2:	c9                   	leave
+  801cd3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cd4:	83 ec 0c             	sub    $0xc,%esp
+  801cd7:	ff 73 0c             	push   0xc(%ebx)
+  801cda:	e8 b7 02 00 00       	call   801f96 <nsipc_close>
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	eb eb                	jmp    801ccf <devsock_close+0x1f>
+
+00801ce4 <devsock_write>:
+{
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cea:	6a 00                	push   $0x0
+  801cec:	ff 75 10             	push   0x10(%ebp)
+  801cef:	ff 75 0c             	push   0xc(%ebp)
+  801cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf5:	ff 70 0c             	push   0xc(%eax)
+  801cf8:	e8 79 03 00 00       	call   802076 <nsipc_send>
+}
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+
+00801cff <devsock_read>:
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d05:	6a 00                	push   $0x0
+  801d07:	ff 75 10             	push   0x10(%ebp)
+  801d0a:	ff 75 0c             	push   0xc(%ebp)
+  801d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d10:	ff 70 0c             	push   0xc(%eax)
+  801d13:	e8 ef 02 00 00       	call   802007 <nsipc_recv>
+}
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+
+00801d1a <fd2sockid>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d20:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d23:	52                   	push   %edx
+  801d24:	50                   	push   %eax
+  801d25:	e8 f7 e9 ff ff       	call   800721 <fd_lookup>
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	78 10                	js     801d41 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d34:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d3a:	39 08                	cmp    %ecx,(%eax)
+  801d3c:	75 05                	jne    801d43 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d3e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d41:	c9                   	leave
+  801d42:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d43:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d48:	eb f7                	jmp    801d41 <fd2sockid+0x27>
+
+00801d4a <alloc_sockfd>:
+{
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	56                   	push   %esi
+  801d4e:	53                   	push   %ebx
+  801d4f:	83 ec 1c             	sub    $0x1c,%esp
+  801d52:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d57:	50                   	push   %eax
+  801d58:	e8 6e e9 ff ff       	call   8006cb <fd_alloc>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 43                	js     801da9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d66:	83 ec 04             	sub    $0x4,%esp
+  801d69:	68 07 04 00 00       	push   $0x407
+  801d6e:	ff 75 f4             	push   -0xc(%ebp)
+  801d71:	6a 00                	push   $0x0
+  801d73:	e8 8a e4 ff ff       	call   800202 <sys_page_alloc>
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	83 c4 10             	add    $0x10,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 28                	js     801da9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d84:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d8a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d96:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d99:	83 ec 0c             	sub    $0xc,%esp
+  801d9c:	50                   	push   %eax
+  801d9d:	e8 02 e9 ff ff       	call   8006a4 <fd2num>
+  801da2:	89 c3                	mov    %eax,%ebx
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	eb 0c                	jmp    801db5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801da9:	83 ec 0c             	sub    $0xc,%esp
+  801dac:	56                   	push   %esi
+  801dad:	e8 e4 01 00 00       	call   801f96 <nsipc_close>
+		return r;
+  801db2:	83 c4 10             	add    $0x10,%esp
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dba:	5b                   	pop    %ebx
+  801dbb:	5e                   	pop    %esi
+  801dbc:	5d                   	pop    %ebp
+  801dbd:	c3                   	ret
+
+00801dbe <accept>:
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc7:	e8 4e ff ff ff       	call   801d1a <fd2sockid>
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	78 1b                	js     801deb <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801dd0:	83 ec 04             	sub    $0x4,%esp
+  801dd3:	ff 75 10             	push   0x10(%ebp)
+  801dd6:	ff 75 0c             	push   0xc(%ebp)
+  801dd9:	50                   	push   %eax
+  801dda:	e8 0e 01 00 00       	call   801eed <nsipc_accept>
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 05                	js     801deb <accept+0x2d>
+	return alloc_sockfd(r);
+  801de6:	e8 5f ff ff ff       	call   801d4a <alloc_sockfd>
+}
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+
+00801ded <bind>:
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df6:	e8 1f ff ff ff       	call   801d1a <fd2sockid>
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	78 12                	js     801e11 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dff:	83 ec 04             	sub    $0x4,%esp
+  801e02:	ff 75 10             	push   0x10(%ebp)
+  801e05:	ff 75 0c             	push   0xc(%ebp)
+  801e08:	50                   	push   %eax
+  801e09:	e8 31 01 00 00       	call   801f3f <nsipc_bind>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+}
+  801e11:	c9                   	leave
+  801e12:	c3                   	ret
+
+00801e13 <shutdown>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1c:	e8 f9 fe ff ff       	call   801d1a <fd2sockid>
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 0f                	js     801e34 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e25:	83 ec 08             	sub    $0x8,%esp
+  801e28:	ff 75 0c             	push   0xc(%ebp)
+  801e2b:	50                   	push   %eax
+  801e2c:	e8 43 01 00 00       	call   801f74 <nsipc_shutdown>
+  801e31:	83 c4 10             	add    $0x10,%esp
+}
+  801e34:	c9                   	leave
+  801e35:	c3                   	ret
+
+00801e36 <connect>:
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3f:	e8 d6 fe ff ff       	call   801d1a <fd2sockid>
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 12                	js     801e5a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e48:	83 ec 04             	sub    $0x4,%esp
+  801e4b:	ff 75 10             	push   0x10(%ebp)
+  801e4e:	ff 75 0c             	push   0xc(%ebp)
+  801e51:	50                   	push   %eax
+  801e52:	e8 59 01 00 00       	call   801fb0 <nsipc_connect>
+  801e57:	83 c4 10             	add    $0x10,%esp
+}
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+
+00801e5c <listen>:
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e65:	e8 b0 fe ff ff       	call   801d1a <fd2sockid>
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	78 0f                	js     801e7d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e6e:	83 ec 08             	sub    $0x8,%esp
+  801e71:	ff 75 0c             	push   0xc(%ebp)
+  801e74:	50                   	push   %eax
+  801e75:	e8 6b 01 00 00       	call   801fe5 <nsipc_listen>
+  801e7a:	83 c4 10             	add    $0x10,%esp
+}
+  801e7d:	c9                   	leave
+  801e7e:	c3                   	ret
+
+00801e7f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e85:	ff 75 10             	push   0x10(%ebp)
+  801e88:	ff 75 0c             	push   0xc(%ebp)
+  801e8b:	ff 75 08             	push   0x8(%ebp)
+  801e8e:	e8 41 02 00 00       	call   8020d4 <nsipc_socket>
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	78 05                	js     801e9f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e9a:	e8 ab fe ff ff       	call   801d4a <alloc_sockfd>
+}
+  801e9f:	c9                   	leave
+  801ea0:	c3                   	ret
+
+00801ea1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ea1:	55                   	push   %ebp
+  801ea2:	89 e5                	mov    %esp,%ebp
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 04             	sub    $0x4,%esp
+  801ea8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801eaa:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801eb1:	74 26                	je     801ed9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801eb3:	6a 07                	push   $0x7
+  801eb5:	68 00 80 80 00       	push   $0x808000
+  801eba:	53                   	push   %ebx
+  801ebb:	ff 35 08 60 80 00    	push   0x806008
+  801ec1:	e8 8b 24 00 00       	call   804351 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ec6:	83 c4 0c             	add    $0xc,%esp
+  801ec9:	6a 00                	push   $0x0
+  801ecb:	6a 00                	push   $0x0
+  801ecd:	6a 00                	push   $0x0
+  801ecf:	e8 87 23 00 00       	call   80425b <ipc_recv>
+}
+  801ed4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ed9:	83 ec 0c             	sub    $0xc,%esp
+  801edc:	6a 02                	push   $0x2
+  801ede:	e8 c4 24 00 00       	call   8043a7 <ipc_find_env>
+  801ee3:	a3 08 60 80 00       	mov    %eax,0x806008
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	eb c6                	jmp    801eb3 <nsipc+0x12>
+
+00801eed <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	56                   	push   %esi
+  801ef1:	53                   	push   %ebx
+  801ef2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801efd:	8b 06                	mov    (%esi),%eax
+  801eff:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f04:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f09:	e8 93 ff ff ff       	call   801ea1 <nsipc>
+  801f0e:	89 c3                	mov    %eax,%ebx
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	79 09                	jns    801f1d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f14:	89 d8                	mov    %ebx,%eax
+  801f16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f19:	5b                   	pop    %ebx
+  801f1a:	5e                   	pop    %esi
+  801f1b:	5d                   	pop    %ebp
+  801f1c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f1d:	83 ec 04             	sub    $0x4,%esp
+  801f20:	ff 35 10 80 80 00    	push   0x808010
+  801f26:	68 00 80 80 00       	push   $0x808000
+  801f2b:	ff 75 0c             	push   0xc(%ebp)
+  801f2e:	e8 f4 1a 00 00       	call   803a27 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f33:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f38:	89 06                	mov    %eax,(%esi)
+  801f3a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f3d:	eb d5                	jmp    801f14 <nsipc_accept+0x27>
+
+00801f3f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	53                   	push   %ebx
+  801f43:	83 ec 08             	sub    $0x8,%esp
+  801f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f51:	53                   	push   %ebx
+  801f52:	ff 75 0c             	push   0xc(%ebp)
+  801f55:	68 04 80 80 00       	push   $0x808004
+  801f5a:	e8 c8 1a 00 00       	call   803a27 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f5f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f65:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f6a:	e8 32 ff ff ff       	call   801ea1 <nsipc>
+}
+  801f6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f72:	c9                   	leave
+  801f73:	c3                   	ret
+
+00801f74 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f74:	55                   	push   %ebp
+  801f75:	89 e5                	mov    %esp,%ebp
+  801f77:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f85:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f8f:	e8 0d ff ff ff       	call   801ea1 <nsipc>
+}
+  801f94:	c9                   	leave
+  801f95:	c3                   	ret
+
+00801f96 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801fa4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fa9:	e8 f3 fe ff ff       	call   801ea1 <nsipc>
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+00801fb0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	53                   	push   %ebx
+  801fb4:	83 ec 08             	sub    $0x8,%esp
+  801fb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801fba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fc2:	53                   	push   %ebx
+  801fc3:	ff 75 0c             	push   0xc(%ebp)
+  801fc6:	68 04 80 80 00       	push   $0x808004
+  801fcb:	e8 57 1a 00 00       	call   803a27 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fd0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fd6:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fdb:	e8 c1 fe ff ff       	call   801ea1 <nsipc>
+}
+  801fe0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe3:	c9                   	leave
+  801fe4:	c3                   	ret
+
+00801fe5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fe5:	55                   	push   %ebp
+  801fe6:	89 e5                	mov    %esp,%ebp
+  801fe8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801feb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fee:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ff3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801ffb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802000:	e8 9c fe ff ff       	call   801ea1 <nsipc>
+}
+  802005:	c9                   	leave
+  802006:	c3                   	ret
+
+00802007 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	56                   	push   %esi
+  80200b:	53                   	push   %ebx
+  80200c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80200f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802012:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802017:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80201d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802020:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802025:	b8 07 00 00 00       	mov    $0x7,%eax
+  80202a:	e8 72 fe ff ff       	call   801ea1 <nsipc>
+  80202f:	89 c3                	mov    %eax,%ebx
+  802031:	85 c0                	test   %eax,%eax
+  802033:	78 22                	js     802057 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802035:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80203a:	39 c6                	cmp    %eax,%esi
+  80203c:	0f 4e c6             	cmovle %esi,%eax
+  80203f:	39 c3                	cmp    %eax,%ebx
+  802041:	7f 1d                	jg     802060 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802043:	83 ec 04             	sub    $0x4,%esp
+  802046:	53                   	push   %ebx
+  802047:	68 00 80 80 00       	push   $0x808000
+  80204c:	ff 75 0c             	push   0xc(%ebp)
+  80204f:	e8 d3 19 00 00       	call   803a27 <memmove>
+  802054:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802057:	89 d8                	mov    %ebx,%eax
+  802059:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205c:	5b                   	pop    %ebx
+  80205d:	5e                   	pop    %esi
+  80205e:	5d                   	pop    %ebp
+  80205f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802060:	68 1c 48 80 00       	push   $0x80481c
+  802065:	68 d5 47 80 00       	push   $0x8047d5
+  80206a:	6a 62                	push   $0x62
+  80206c:	68 31 48 80 00       	push   $0x804831
+  802071:	e8 6c 11 00 00       	call   8031e2 <_panic>
+
+00802076 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802080:	8b 45 08             	mov    0x8(%ebp),%eax
+  802083:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802088:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80208e:	7f 2e                	jg     8020be <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802090:	83 ec 04             	sub    $0x4,%esp
+  802093:	53                   	push   %ebx
+  802094:	ff 75 0c             	push   0xc(%ebp)
+  802097:	68 0c 80 80 00       	push   $0x80800c
+  80209c:	e8 86 19 00 00       	call   803a27 <memmove>
+	nsipcbuf.send.req_size = size;
+  8020a1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8020a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020aa:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8020af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020b4:	e8 e8 fd ff ff       	call   801ea1 <nsipc>
+}
+  8020b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+	assert(size < 1600);
+  8020be:	68 3d 48 80 00       	push   $0x80483d
+  8020c3:	68 d5 47 80 00       	push   $0x8047d5
+  8020c8:	6a 6d                	push   $0x6d
+  8020ca:	68 31 48 80 00       	push   $0x804831
+  8020cf:	e8 0e 11 00 00       	call   8031e2 <_panic>
+
+008020d4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020ed:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020f7:	e8 a5 fd ff ff       	call   801ea1 <nsipc>
+}
+  8020fc:	c9                   	leave
+  8020fd:	c3                   	ret
+
+008020fe <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020fe:	55                   	push   %ebp
+  8020ff:	89 e5                	mov    %esp,%ebp
+  802101:	53                   	push   %ebx
+  802102:	83 ec 10             	sub    $0x10,%esp
+  802105:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802108:	68 0c 60 80 00       	push   $0x80600c
+  80210d:	e8 50 07 00 00       	call   802862 <mutex_lock>
+	if (v == 0)
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 db                	test   %ebx,%ebx
+  802117:	0f 84 85 00 00 00    	je     8021a2 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80211d:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802123:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802128:	77 51                	ja     80217b <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80212a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802130:	89 d8                	mov    %ebx,%eax
+  802132:	c1 e8 0c             	shr    $0xc,%eax
+  802135:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80213c:	f6 c4 02             	test   $0x2,%ah
+  80213f:	74 50                	je     802191 <free+0x93>
+		sys_page_unmap(0, c);
+  802141:	83 ec 08             	sub    $0x8,%esp
+  802144:	53                   	push   %ebx
+  802145:	6a 00                	push   $0x0
+  802147:	e8 4f e1 ff ff       	call   80029b <sys_page_unmap>
+		c += PGSIZE;
+  80214c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802152:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802158:	83 c4 10             	add    $0x10,%esp
+  80215b:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802160:	76 ce                	jbe    802130 <free+0x32>
+  802162:	68 87 48 80 00       	push   $0x804887
+  802167:	68 d5 47 80 00       	push   $0x8047d5
+  80216c:	68 82 00 00 00       	push   $0x82
+  802171:	68 7a 48 80 00       	push   $0x80487a
+  802176:	e8 67 10 00 00       	call   8031e2 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80217b:	68 4c 48 80 00       	push   $0x80484c
+  802180:	68 d5 47 80 00       	push   $0x8047d5
+  802185:	6a 7b                	push   $0x7b
+  802187:	68 7a 48 80 00       	push   $0x80487a
+  80218c:	e8 51 10 00 00       	call   8031e2 <_panic>
+	if (--(*ref) == 0)
+  802191:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802197:	83 e8 01             	sub    $0x1,%eax
+  80219a:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8021a0:	74 15                	je     8021b7 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8021a2:	83 ec 0c             	sub    $0xc,%esp
+  8021a5:	68 0c 60 80 00       	push   $0x80600c
+  8021aa:	e8 20 07 00 00       	call   8028cf <mutex_unlock>
+}
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b5:	c9                   	leave
+  8021b6:	c3                   	ret
+		sys_page_unmap(0, c);
+  8021b7:	83 ec 08             	sub    $0x8,%esp
+  8021ba:	53                   	push   %ebx
+  8021bb:	6a 00                	push   $0x0
+  8021bd:	e8 d9 e0 ff ff       	call   80029b <sys_page_unmap>
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	eb db                	jmp    8021a2 <free+0xa4>
+
+008021c7 <malloc>:
+{
+  8021c7:	55                   	push   %ebp
+  8021c8:	89 e5                	mov    %esp,%ebp
+  8021ca:	57                   	push   %edi
+  8021cb:	56                   	push   %esi
+  8021cc:	53                   	push   %ebx
+  8021cd:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021d0:	68 0c 60 80 00       	push   $0x80600c
+  8021d5:	e8 88 06 00 00       	call   802862 <mutex_lock>
+	if (mptr == 0)
+  8021da:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	85 ff                	test   %edi,%edi
+  8021e5:	74 6c                	je     802253 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ea:	83 c0 03             	add    $0x3,%eax
+  8021ed:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021f0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021f2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021f7:	0f 87 64 01 00 00    	ja     802361 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021fd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802203:	74 30                	je     802235 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802205:	89 f9                	mov    %edi,%ecx
+  802207:	c1 e9 0c             	shr    $0xc,%ecx
+  80220a:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80220e:	c1 e8 0c             	shr    $0xc,%eax
+  802211:	39 c1                	cmp    %eax,%ecx
+  802213:	74 5f                	je     802274 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802215:	83 ec 0c             	sub    $0xc,%esp
+  802218:	57                   	push   %edi
+  802219:	e8 e0 fe ff ff       	call   8020fe <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80221e:	a1 10 60 80 00       	mov    0x806010,%eax
+  802223:	05 00 10 00 00       	add    $0x1000,%eax
+  802228:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80222d:	a3 10 60 80 00       	mov    %eax,0x806010
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  80223b:	ba 02 00 00 00       	mov    $0x2,%edx
+  802240:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802244:	8d 7e 04             	lea    0x4(%esi),%edi
+  802247:	89 cb                	mov    %ecx,%ebx
+  802249:	01 f9                	add    %edi,%ecx
+  80224b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80224e:	e9 8b 00 00 00       	jmp    8022de <malloc+0x117>
+		mptr = mbegin;
+  802253:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80225a:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80225d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802260:	83 c0 03             	add    $0x3,%eax
+  802263:	83 e0 fc             	and    $0xfffffffc,%eax
+  802266:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802268:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80226d:	76 c6                	jbe    802235 <malloc+0x6e>
+  80226f:	e9 d6 00 00 00       	jmp    80234a <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802274:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80227a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80227f:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802283:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802286:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80228b:	e9 ba 00 00 00       	jmp    80234a <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802290:	05 00 10 00 00       	add    $0x1000,%eax
+  802295:	39 c8                	cmp    %ecx,%eax
+  802297:	0f 83 cb 00 00 00    	jae    802368 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80229d:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8022a2:	77 22                	ja     8022c6 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	c1 ea 16             	shr    $0x16,%edx
+  8022a9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022b0:	f6 c2 01             	test   $0x1,%dl
+  8022b3:	74 db                	je     802290 <malloc+0xc9>
+  8022b5:	89 c2                	mov    %eax,%edx
+  8022b7:	c1 ea 0c             	shr    $0xc,%edx
+  8022ba:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022c1:	f6 c2 01             	test   $0x1,%dl
+  8022c4:	74 ca                	je     802290 <malloc+0xc9>
+		if (mptr == mend) {
+  8022c6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022cc:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022d2:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022d6:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022dc:	74 04                	je     8022e2 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022de:	89 d8                	mov    %ebx,%eax
+  8022e0:	eb b3                	jmp    802295 <malloc+0xce>
+  8022e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022e5:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022ea:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022ee:	83 ea 01             	sub    $0x1,%edx
+  8022f1:	0f 85 50 ff ff ff    	jne    802247 <malloc+0x80>
+  8022f7:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022fe:	00 00 08 
+				return 0;	/* out of address space */
+  802301:	bf 00 00 00 00       	mov    $0x0,%edi
+  802306:	eb 42                	jmp    80234a <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802308:	85 db                	test   %ebx,%ebx
+  80230a:	78 1e                	js     80232a <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80230c:	83 ec 08             	sub    $0x8,%esp
+  80230f:	89 d8                	mov    %ebx,%eax
+  802311:	03 05 10 60 80 00    	add    0x806010,%eax
+  802317:	50                   	push   %eax
+  802318:	6a 00                	push   $0x0
+  80231a:	e8 7c df ff ff       	call   80029b <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80231f:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802325:	83 c4 10             	add    $0x10,%esp
+  802328:	eb de                	jmp    802308 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80232a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80232f:	eb 19                	jmp    80234a <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802331:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802334:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80233a:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802341:	00 
+	mptr += n;
+  802342:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802345:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	68 0c 60 80 00       	push   $0x80600c
+  802352:	e8 78 05 00 00       	call   8028cf <mutex_unlock>
+}
+  802357:	89 f8                	mov    %edi,%eax
+  802359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80235c:	5b                   	pop    %ebx
+  80235d:	5e                   	pop    %esi
+  80235e:	5f                   	pop    %edi
+  80235f:	5d                   	pop    %ebp
+  802360:	c3                   	ret
+		return 0;
+  802361:	bf 00 00 00 00       	mov    $0x0,%edi
+  802366:	eb e2                	jmp    80234a <malloc+0x183>
+  802368:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80236c:	74 06                	je     802374 <malloc+0x1ad>
+  80236e:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802374:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802379:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80237c:	39 fb                	cmp    %edi,%ebx
+  80237e:	73 b1                	jae    802331 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802380:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802386:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802389:	39 fe                	cmp    %edi,%esi
+  80238b:	0f 92 c0             	setb   %al
+  80238e:	0f b6 c0             	movzbl %al,%eax
+  802391:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802394:	83 c8 07             	or     $0x7,%eax
+  802397:	50                   	push   %eax
+  802398:	89 d8                	mov    %ebx,%eax
+  80239a:	03 05 10 60 80 00    	add    0x806010,%eax
+  8023a0:	50                   	push   %eax
+  8023a1:	6a 00                	push   $0x0
+  8023a3:	e8 5a de ff ff       	call   800202 <sys_page_alloc>
+  8023a8:	83 c4 10             	add    $0x10,%esp
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	0f 88 55 ff ff ff    	js     802308 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8023b3:	89 f3                	mov    %esi,%ebx
+  8023b5:	eb c5                	jmp    80237c <malloc+0x1b5>
+
+008023b7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	56                   	push   %esi
+  8023bb:	53                   	push   %ebx
+  8023bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023bf:	83 ec 0c             	sub    $0xc,%esp
+  8023c2:	ff 75 08             	push   0x8(%ebp)
+  8023c5:	e8 ea e2 ff ff       	call   8006b4 <fd2data>
+  8023ca:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023cc:	83 c4 08             	add    $0x8,%esp
+  8023cf:	68 9f 48 80 00       	push   $0x80489f
+  8023d4:	53                   	push   %ebx
+  8023d5:	e8 c7 14 00 00       	call   8038a1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023da:	8b 46 04             	mov    0x4(%esi),%eax
+  8023dd:	2b 06                	sub    (%esi),%eax
+  8023df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023ef:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023f6:	52 80 00 
+	return 0;
+}
+  8023f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802401:	5b                   	pop    %ebx
+  802402:	5e                   	pop    %esi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+
+00802405 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802405:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240a:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80240e:	85 c9                	test   %ecx,%ecx
+  802410:	75 01                	jne    802413 <pipewake+0xe>
+  802412:	c3                   	ret
+{
+  802413:	55                   	push   %ebp
+  802414:	89 e5                	mov    %esp,%ebp
+  802416:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802419:	68 00 04 00 00       	push   $0x400
+  80241e:	52                   	push   %edx
+  80241f:	e8 22 e1 ff ff       	call   800546 <sys_futex_wake>
+  802424:	83 c4 10             	add    $0x10,%esp
+}
+  802427:	c9                   	leave
+  802428:	c3                   	ret
+
+00802429 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	56                   	push   %esi
+  80242d:	53                   	push   %ebx
+  80242e:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802431:	83 ec 0c             	sub    $0xc,%esp
+  802434:	56                   	push   %esi
+  802435:	e8 7a e2 ff ff       	call   8006b4 <fd2data>
+  80243a:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80243c:	83 c4 08             	add    $0x8,%esp
+  80243f:	56                   	push   %esi
+  802440:	6a 00                	push   $0x0
+  802442:	e8 54 de ff ff       	call   80029b <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802447:	8d 53 04             	lea    0x4(%ebx),%edx
+  80244a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80244d:	e8 b3 ff ff ff       	call   802405 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802452:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802455:	89 da                	mov    %ebx,%edx
+  802457:	e8 a9 ff ff ff       	call   802405 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80245c:	89 34 24             	mov    %esi,(%esp)
+  80245f:	e8 50 e2 ff ff       	call   8006b4 <fd2data>
+  802464:	83 c4 08             	add    $0x8,%esp
+  802467:	50                   	push   %eax
+  802468:	6a 00                	push   $0x0
+  80246a:	e8 2c de ff ff       	call   80029b <sys_page_unmap>
+}
+  80246f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802472:	5b                   	pop    %ebx
+  802473:	5e                   	pop    %esi
+  802474:	5d                   	pop    %ebp
+  802475:	c3                   	ret
+
+00802476 <_pipeisclosed>:
+{
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	57                   	push   %edi
+  80247a:	56                   	push   %esi
+  80247b:	53                   	push   %ebx
+  80247c:	83 ec 1c             	sub    $0x1c,%esp
+  80247f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802482:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802484:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802489:	eb 5d                	jmp    8024e8 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80248b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802491:	8b 02                	mov    (%edx),%eax
+  802493:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802496:	83 ec 0c             	sub    $0xc,%esp
+  802499:	ff 75 e0             	push   -0x20(%ebp)
+  80249c:	e8 45 1f 00 00       	call   8043e6 <pageref>
+  8024a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024a4:	89 3c 24             	mov    %edi,(%esp)
+  8024a7:	e8 3a 1f 00 00       	call   8043e6 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8024ac:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024ae:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8024bd:	77 15                	ja     8024d4 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024bf:	89 f2                	mov    %esi,%edx
+  8024c1:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8024c3:	c1 ea 10             	shr    $0x10,%edx
+  8024c6:	74 0c                	je     8024d4 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024c8:	c1 e2 10             	shl    $0x10,%edx
+  8024cb:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024d0:	29 d1                	sub    %edx,%ecx
+  8024d2:	eb 06                	jmp    8024da <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024d4:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024da:	8b 11                	mov    (%ecx),%edx
+  8024dc:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024df:	39 d3                	cmp    %edx,%ebx
+  8024e1:	74 6e                	je     802551 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024e3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024e6:	74 24                	je     80250c <_pipeisclosed+0x96>
+  8024e8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024ea:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024f0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024f5:	77 94                	ja     80248b <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024f7:	89 f0                	mov    %esi,%eax
+  8024f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024fb:	c1 e8 10             	shr    $0x10,%eax
+  8024fe:	74 8b                	je     80248b <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802500:	c1 e0 10             	shl    $0x10,%eax
+  802503:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802508:	29 c2                	sub    %eax,%edx
+  80250a:	eb 85                	jmp    802491 <_pipeisclosed+0x1b>
+  80250c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80250e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802514:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802519:	77 18                	ja     802533 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80251b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802520:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802522:	c1 e8 10             	shr    $0x10,%eax
+  802525:	74 0c                	je     802533 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802527:	c1 e0 10             	shl    $0x10,%eax
+  80252a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80252f:	29 c2                	sub    %eax,%edx
+  802531:	eb 06                	jmp    802539 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802533:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802539:	8b 02                	mov    (%edx),%eax
+  80253b:	8b 40 58             	mov    0x58(%eax),%eax
+  80253e:	6a 01                	push   $0x1
+  802540:	50                   	push   %eax
+  802541:	53                   	push   %ebx
+  802542:	68 a6 48 80 00       	push   $0x8048a6
+  802547:	e8 71 0d 00 00       	call   8032bd <cprintf>
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	eb 97                	jmp    8024e8 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802551:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802554:	0f 94 c0             	sete   %al
+  802557:	0f b6 c0             	movzbl %al,%eax
+}
+  80255a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255d:	5b                   	pop    %ebx
+  80255e:	5e                   	pop    %esi
+  80255f:	5f                   	pop    %edi
+  802560:	5d                   	pop    %ebp
+  802561:	c3                   	ret
+
+00802562 <devpipe_write>:
+{
+  802562:	55                   	push   %ebp
+  802563:	89 e5                	mov    %esp,%ebp
+  802565:	57                   	push   %edi
+  802566:	56                   	push   %esi
+  802567:	53                   	push   %ebx
+  802568:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80256b:	ff 75 08             	push   0x8(%ebp)
+  80256e:	e8 41 e1 ff ff       	call   8006b4 <fd2data>
+  802573:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80257f:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802582:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802585:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802588:	0f 84 96 00 00 00    	je     802624 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80258e:	8d 73 08             	lea    0x8(%ebx),%esi
+  802591:	eb 32                	jmp    8025c5 <devpipe_write+0x63>
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	89 f0                	mov    %esi,%eax
+  802597:	e8 69 fe ff ff       	call   802405 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80259c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80259f:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8025a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025a7:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8025ac:	83 ec 04             	sub    $0x4,%esp
+  8025af:	6a 0a                	push   $0xa
+  8025b1:	50                   	push   %eax
+  8025b2:	53                   	push   %ebx
+  8025b3:	e8 5f df ff ff       	call   800517 <sys_futex_wait>
+  8025b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025bd:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8025c2:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025c5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025c8:	8b 0b                	mov    (%ebx),%ecx
+  8025ca:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025cd:	39 d0                	cmp    %edx,%eax
+  8025cf:	72 1b                	jb     8025ec <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025d1:	89 da                	mov    %ebx,%edx
+  8025d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d6:	e8 9b fe ff ff       	call   802476 <_pipeisclosed>
+  8025db:	85 c0                	test   %eax,%eax
+  8025dd:	74 b4                	je     802593 <devpipe_write+0x31>
+				return 0;
+  8025df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e7:	5b                   	pop    %ebx
+  8025e8:	5e                   	pop    %esi
+  8025e9:	5f                   	pop    %edi
+  8025ea:	5d                   	pop    %ebp
+  8025eb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025ef:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025f2:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025f6:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025f9:	89 c2                	mov    %eax,%edx
+  8025fb:	c1 fa 1f             	sar    $0x1f,%edx
+  8025fe:	89 d1                	mov    %edx,%ecx
+  802600:	c1 e9 1b             	shr    $0x1b,%ecx
+  802603:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802606:	83 e2 1f             	and    $0x1f,%edx
+  802609:	29 ca                	sub    %ecx,%edx
+  80260b:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80260f:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802613:	83 c0 01             	add    $0x1,%eax
+  802616:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802619:	83 c6 01             	add    $0x1,%esi
+  80261c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80261f:	e9 5e ff ff ff       	jmp    802582 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802624:	8d 53 04             	lea    0x4(%ebx),%edx
+  802627:	8d 43 08             	lea    0x8(%ebx),%eax
+  80262a:	e8 d6 fd ff ff       	call   802405 <pipewake>
+	return i;
+  80262f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802632:	eb b0                	jmp    8025e4 <devpipe_write+0x82>
+
+00802634 <devpipe_read>:
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	57                   	push   %edi
+  802638:	56                   	push   %esi
+  802639:	53                   	push   %ebx
+  80263a:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80263d:	ff 75 08             	push   0x8(%ebp)
+  802640:	e8 6f e0 ff ff       	call   8006b4 <fd2data>
+  802645:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802647:	83 c4 10             	add    $0x10,%esp
+  80264a:	be 00 00 00 00       	mov    $0x0,%esi
+  80264f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802652:	74 6c                	je     8026c0 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802654:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802657:	eb 25                	jmp    80267e <devpipe_read+0x4a>
+  802659:	8b 13                	mov    (%ebx),%edx
+  80265b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802660:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802665:	83 ec 04             	sub    $0x4,%esp
+  802668:	6a 0a                	push   $0xa
+  80266a:	52                   	push   %edx
+  80266b:	57                   	push   %edi
+  80266c:	e8 a6 de ff ff       	call   800517 <sys_futex_wait>
+  802671:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802676:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80267b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80267e:	8b 03                	mov    (%ebx),%eax
+  802680:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802683:	75 19                	jne    80269e <devpipe_read+0x6a>
+			if (i > 0)
+  802685:	85 f6                	test   %esi,%esi
+  802687:	75 3a                	jne    8026c3 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  802689:	89 da                	mov    %ebx,%edx
+  80268b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268e:	e8 e3 fd ff ff       	call   802476 <_pipeisclosed>
+  802693:	85 c0                	test   %eax,%eax
+  802695:	74 c2                	je     802659 <devpipe_read+0x25>
+				return 0;
+  802697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269c:	eb 31                	jmp    8026cf <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80269e:	89 c1                	mov    %eax,%ecx
+  8026a0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8026a3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026a6:	01 c8                	add    %ecx,%eax
+  8026a8:	83 e0 1f             	and    $0x1f,%eax
+  8026ab:	29 c8                	sub    %ecx,%eax
+  8026ad:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8026b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026b8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026bb:	83 c6 01             	add    $0x1,%esi
+  8026be:	eb 8f                	jmp    80264f <devpipe_read+0x1b>
+out:
+  8026c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8026c3:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8026c6:	89 da                	mov    %ebx,%edx
+  8026c8:	e8 38 fd ff ff       	call   802405 <pipewake>
+	return i;
+  8026cd:	89 f0                	mov    %esi,%eax
+}
+  8026cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d2:	5b                   	pop    %ebx
+  8026d3:	5e                   	pop    %esi
+  8026d4:	5f                   	pop    %edi
+  8026d5:	5d                   	pop    %ebp
+  8026d6:	c3                   	ret
+
+008026d7 <pipe>:
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	56                   	push   %esi
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e2:	50                   	push   %eax
+  8026e3:	e8 e3 df ff ff       	call   8006cb <fd_alloc>
+  8026e8:	89 c3                	mov    %eax,%ebx
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	0f 88 23 01 00 00    	js     802818 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f5:	83 ec 04             	sub    $0x4,%esp
+  8026f8:	68 07 04 00 00       	push   $0x407
+  8026fd:	ff 75 f4             	push   -0xc(%ebp)
+  802700:	6a 00                	push   $0x0
+  802702:	e8 fb da ff ff       	call   800202 <sys_page_alloc>
+  802707:	89 c3                	mov    %eax,%ebx
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	0f 88 04 01 00 00    	js     802818 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802714:	83 ec 0c             	sub    $0xc,%esp
+  802717:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80271a:	50                   	push   %eax
+  80271b:	e8 ab df ff ff       	call   8006cb <fd_alloc>
+  802720:	89 c3                	mov    %eax,%ebx
+  802722:	83 c4 10             	add    $0x10,%esp
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 88 db 00 00 00    	js     802808 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272d:	83 ec 04             	sub    $0x4,%esp
+  802730:	68 07 04 00 00       	push   $0x407
+  802735:	ff 75 f0             	push   -0x10(%ebp)
+  802738:	6a 00                	push   $0x0
+  80273a:	e8 c3 da ff ff       	call   800202 <sys_page_alloc>
+  80273f:	89 c3                	mov    %eax,%ebx
+  802741:	83 c4 10             	add    $0x10,%esp
+  802744:	85 c0                	test   %eax,%eax
+  802746:	0f 88 bc 00 00 00    	js     802808 <pipe+0x131>
+	va = fd2data(fd0);
+  80274c:	83 ec 0c             	sub    $0xc,%esp
+  80274f:	ff 75 f4             	push   -0xc(%ebp)
+  802752:	e8 5d df ff ff       	call   8006b4 <fd2data>
+  802757:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802759:	83 c4 0c             	add    $0xc,%esp
+  80275c:	68 07 04 00 00       	push   $0x407
+  802761:	50                   	push   %eax
+  802762:	6a 00                	push   $0x0
+  802764:	e8 99 da ff ff       	call   800202 <sys_page_alloc>
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	0f 88 82 00 00 00    	js     8027f8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802776:	83 ec 0c             	sub    $0xc,%esp
+  802779:	ff 75 f0             	push   -0x10(%ebp)
+  80277c:	e8 33 df ff ff       	call   8006b4 <fd2data>
+  802781:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802788:	50                   	push   %eax
+  802789:	6a 00                	push   $0x0
+  80278b:	56                   	push   %esi
+  80278c:	6a 00                	push   $0x0
+  80278e:	e8 bc da ff ff       	call   80024f <sys_page_map>
+  802793:	89 c3                	mov    %eax,%ebx
+  802795:	83 c4 20             	add    $0x20,%esp
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	78 4e                	js     8027ea <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80279c:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8027a1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027a4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8027a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027a9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8027b0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8027b3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8027b5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027b8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027bf:	83 ec 0c             	sub    $0xc,%esp
+  8027c2:	ff 75 f4             	push   -0xc(%ebp)
+  8027c5:	e8 da de ff ff       	call   8006a4 <fd2num>
+  8027ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027cd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027cf:	83 c4 04             	add    $0x4,%esp
+  8027d2:	ff 75 f0             	push   -0x10(%ebp)
+  8027d5:	e8 ca de ff ff       	call   8006a4 <fd2num>
+  8027da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027dd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e8:	eb 2e                	jmp    802818 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ea:	83 ec 08             	sub    $0x8,%esp
+  8027ed:	56                   	push   %esi
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	e8 a6 da ff ff       	call   80029b <sys_page_unmap>
+  8027f5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027f8:	83 ec 08             	sub    $0x8,%esp
+  8027fb:	ff 75 f0             	push   -0x10(%ebp)
+  8027fe:	6a 00                	push   $0x0
+  802800:	e8 96 da ff ff       	call   80029b <sys_page_unmap>
+  802805:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802808:	83 ec 08             	sub    $0x8,%esp
+  80280b:	ff 75 f4             	push   -0xc(%ebp)
+  80280e:	6a 00                	push   $0x0
+  802810:	e8 86 da ff ff       	call   80029b <sys_page_unmap>
+  802815:	83 c4 10             	add    $0x10,%esp
+}
+  802818:	89 d8                	mov    %ebx,%eax
+  80281a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80281d:	5b                   	pop    %ebx
+  80281e:	5e                   	pop    %esi
+  80281f:	5d                   	pop    %ebp
+  802820:	c3                   	ret
+
+00802821 <pipeisclosed>:
+{
+  802821:	55                   	push   %ebp
+  802822:	89 e5                	mov    %esp,%ebp
+  802824:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802827:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80282a:	50                   	push   %eax
+  80282b:	ff 75 08             	push   0x8(%ebp)
+  80282e:	e8 ee de ff ff       	call   800721 <fd_lookup>
+  802833:	83 c4 10             	add    $0x10,%esp
+  802836:	85 c0                	test   %eax,%eax
+  802838:	78 18                	js     802852 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80283a:	83 ec 0c             	sub    $0xc,%esp
+  80283d:	ff 75 f4             	push   -0xc(%ebp)
+  802840:	e8 6f de ff ff       	call   8006b4 <fd2data>
+  802845:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80284a:	e8 27 fc ff ff       	call   802476 <_pipeisclosed>
+  80284f:	83 c4 10             	add    $0x10,%esp
+}
+  802852:	c9                   	leave
+  802853:	c3                   	ret
+
+00802854 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802854:	55                   	push   %ebp
+  802855:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802857:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802860:	5d                   	pop    %ebp
+  802861:	c3                   	ret
+
+00802862 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802862:	55                   	push   %ebp
+  802863:	89 e5                	mov    %esp,%ebp
+  802865:	56                   	push   %esi
+  802866:	53                   	push   %ebx
+  802867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80286a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802874:	89 d0                	mov    %edx,%eax
+  802876:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	74 2d                	je     8028ab <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80287e:	83 f8 02             	cmp    $0x2,%eax
+  802881:	74 08                	je     80288b <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802883:	b8 02 00 00 00       	mov    $0x2,%eax
+  802888:	f0 87 03             	lock xchg %eax,(%ebx)
+  80288b:	be 02 00 00 00       	mov    $0x2,%esi
+  802890:	eb 15                	jmp    8028a7 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802892:	83 ec 04             	sub    $0x4,%esp
+  802895:	6a 00                	push   $0x0
+  802897:	6a 02                	push   $0x2
+  802899:	53                   	push   %ebx
+  80289a:	e8 78 dc ff ff       	call   800517 <sys_futex_wait>
+  80289f:	89 f0                	mov    %esi,%eax
+  8028a1:	f0 87 03             	lock xchg %eax,(%ebx)
+  8028a4:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	75 e7                	jne    802892 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8028ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ae:	5b                   	pop    %ebx
+  8028af:	5e                   	pop    %esi
+  8028b0:	5d                   	pop    %ebp
+  8028b1:	c3                   	ret
+
+008028b2 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8028b2:	55                   	push   %ebp
+  8028b3:	89 e5                	mov    %esp,%ebp
+  8028b5:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028c2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8028c6:	f7 d8                	neg    %eax
+  8028c8:	19 c0                	sbb    %eax,%eax
+  8028ca:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028cd:	5d                   	pop    %ebp
+  8028ce:	c3                   	ret
+
+008028cf <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	83 ec 08             	sub    $0x8,%esp
+  8028d5:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dd:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028e0:	83 f8 02             	cmp    $0x2,%eax
+  8028e3:	74 02                	je     8028e7 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028e5:	c9                   	leave
+  8028e6:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	6a 01                	push   $0x1
+  8028ec:	52                   	push   %edx
+  8028ed:	e8 54 dc ff ff       	call   800546 <sys_futex_wake>
+  8028f2:	83 c4 10             	add    $0x10,%esp
+}
+  8028f5:	eb ee                	jmp    8028e5 <mutex_unlock+0x16>
+
+008028f7 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802903:	5d                   	pop    %ebp
+  802904:	c3                   	ret
+
+00802905 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	57                   	push   %edi
+  802909:	56                   	push   %esi
+  80290a:	53                   	push   %ebx
+  80290b:	83 ec 18             	sub    $0x18,%esp
+  80290e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802911:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  802914:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  802916:	53                   	push   %ebx
+  802917:	e8 b3 ff ff ff       	call   8028cf <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80291c:	83 c4 0c             	add    $0xc,%esp
+  80291f:	ff 75 10             	push   0x10(%ebp)
+  802922:	57                   	push   %edi
+  802923:	56                   	push   %esi
+  802924:	e8 ee db ff ff       	call   800517 <sys_futex_wait>
+  802929:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	be 02 00 00 00       	mov    $0x2,%esi
+  802933:	eb 10                	jmp    802945 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802935:	83 ec 04             	sub    $0x4,%esp
+  802938:	6a 00                	push   $0x0
+  80293a:	6a 02                	push   $0x2
+  80293c:	53                   	push   %ebx
+  80293d:	e8 d5 db ff ff       	call   800517 <sys_futex_wait>
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	89 f0                	mov    %esi,%eax
+  802947:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	75 e7                	jne    802935 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80294e:	83 ff ec             	cmp    $0xffffffec,%edi
+  802951:	74 05                	je     802958 <cond_timedwait+0x53>
+  802953:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802958:	89 f8                	mov    %edi,%eax
+  80295a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295d:	5b                   	pop    %ebx
+  80295e:	5e                   	pop    %esi
+  80295f:	5f                   	pop    %edi
+  802960:	5d                   	pop    %ebp
+  802961:	c3                   	ret
+
+00802962 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802968:	6a 00                	push   $0x0
+  80296a:	ff 75 0c             	push   0xc(%ebp)
+  80296d:	ff 75 08             	push   0x8(%ebp)
+  802970:	e8 90 ff ff ff       	call   802905 <cond_timedwait>
+}
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	c9                   	leave
+  802979:	c3                   	ret
+
+0080297a <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80297a:	55                   	push   %ebp
+  80297b:	89 e5                	mov    %esp,%ebp
+  80297d:	83 ec 10             	sub    $0x10,%esp
+  802980:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802983:	ba 01 00 00 00       	mov    $0x1,%edx
+  802988:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80298c:	6a 01                	push   $0x1
+  80298e:	50                   	push   %eax
+  80298f:	e8 b2 db ff ff       	call   800546 <sys_futex_wake>
+}
+  802994:	83 c4 10             	add    $0x10,%esp
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+
+00802999 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802999:	55                   	push   %ebp
+  80299a:	89 e5                	mov    %esp,%ebp
+  80299c:	83 ec 10             	sub    $0x10,%esp
+  80299f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029a7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8029ab:	68 00 04 00 00       	push   $0x400
+  8029b0:	50                   	push   %eax
+  8029b1:	e8 90 db ff ff       	call   800546 <sys_futex_wake>
+}
+  8029b6:	83 c4 10             	add    $0x10,%esp
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+008029bb <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8029bb:	55                   	push   %ebp
+  8029bc:	89 e5                	mov    %esp,%ebp
+  8029be:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8029c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029c4:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8029c6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029cd:	5d                   	pop    %ebp
+  8029ce:	c3                   	ret
+
+008029cf <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	53                   	push   %ebx
+  8029d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029d6:	8b 11                	mov    (%ecx),%edx
+  8029d8:	85 d2                	test   %edx,%edx
+  8029da:	74 14                	je     8029f0 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029dc:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029df:	89 d0                	mov    %edx,%eax
+  8029e1:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029e5:	39 c2                	cmp    %eax,%edx
+  8029e7:	75 ed                	jne    8029d6 <sem_trywait+0x7>
+			return 0;
+  8029e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ee:	eb 05                	jmp    8029f5 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+008029fa <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029fa:	55                   	push   %ebp
+  8029fb:	89 e5                	mov    %esp,%ebp
+  8029fd:	57                   	push   %edi
+  8029fe:	56                   	push   %esi
+  8029ff:	53                   	push   %ebx
+  802a00:	83 ec 1c             	sub    $0x1c,%esp
+  802a03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a06:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  802a09:	e8 81 da ff ff       	call   80048f <sys_time_msec>
+  802a0e:	01 f8                	add    %edi,%eax
+  802a10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  802a13:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  802a18:	eb 28                	jmp    802a42 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  802a1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1f:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802a24:	83 ec 04             	sub    $0x4,%esp
+  802a27:	56                   	push   %esi
+  802a28:	6a 00                	push   $0x0
+  802a2a:	53                   	push   %ebx
+  802a2b:	e8 e7 da ff ff       	call   800517 <sys_futex_wait>
+  802a30:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a35:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a40:	74 2e                	je     802a70 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a42:	83 ec 0c             	sub    $0xc,%esp
+  802a45:	53                   	push   %ebx
+  802a46:	e8 84 ff ff ff       	call   8029cf <sem_trywait>
+  802a4b:	83 c4 10             	add    $0x10,%esp
+  802a4e:	85 c0                	test   %eax,%eax
+  802a50:	79 19                	jns    802a6b <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a52:	85 ff                	test   %edi,%edi
+  802a54:	74 c4                	je     802a1a <sem_timedwait+0x20>
+  802a56:	e8 34 da ff ff       	call   80048f <sys_time_msec>
+  802a5b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a5e:	29 c6                	sub    %eax,%esi
+  802a60:	85 f6                	test   %esi,%esi
+  802a62:	7f b6                	jg     802a1a <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a64:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a69:	eb 05                	jmp    802a70 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a73:	5b                   	pop    %ebx
+  802a74:	5e                   	pop    %esi
+  802a75:	5f                   	pop    %edi
+  802a76:	5d                   	pop    %ebp
+  802a77:	c3                   	ret
+
+00802a78 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a78:	55                   	push   %ebp
+  802a79:	89 e5                	mov    %esp,%ebp
+  802a7b:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a7e:	6a 00                	push   $0x0
+  802a80:	ff 75 08             	push   0x8(%ebp)
+  802a83:	e8 72 ff ff ff       	call   8029fa <sem_timedwait>
+}
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+
+00802a8d <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	83 ec 08             	sub    $0x8,%esp
+  802a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a96:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a9b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a9f:	8b 50 04             	mov    0x4(%eax),%edx
+  802aa2:	85 d2                	test   %edx,%edx
+  802aa4:	75 02                	jne    802aa8 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802aa8:	83 ec 08             	sub    $0x8,%esp
+  802aab:	6a 01                	push   $0x1
+  802aad:	50                   	push   %eax
+  802aae:	e8 93 da ff ff       	call   800546 <sys_futex_wake>
+  802ab3:	83 c4 10             	add    $0x10,%esp
+}
+  802ab6:	eb ee                	jmp    802aa6 <sem_post+0x19>
+
+00802ab8 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	57                   	push   %edi
+  802abc:	56                   	push   %esi
+  802abd:	53                   	push   %ebx
+  802abe:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802ac1:	68 20 60 80 00       	push   $0x806020
+  802ac6:	e8 97 fd ff ff       	call   802862 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802acb:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	75 19                	jne    802af0 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802ad7:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802adc:	8b 00                	mov    (%eax),%eax
+  802ade:	8b 40 48             	mov    0x48(%eax),%eax
+  802ae1:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802ae6:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802aed:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802af0:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802af5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802af8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802aff:	8b 40 04             	mov    0x4(%eax),%eax
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	0f 84 e4 00 00 00    	je     802bee <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802b0a:	83 c3 01             	add    $0x1,%ebx
+  802b0d:	83 fb 20             	cmp    $0x20,%ebx
+  802b10:	75 e3                	jne    802af5 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802b12:	83 ec 0c             	sub    $0xc,%esp
+  802b15:	68 20 60 80 00       	push   $0x806020
+  802b1a:	e8 b0 fd ff ff       	call   8028cf <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802b1f:	83 c4 10             	add    $0x10,%esp
+  802b22:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b27:	e9 b8 00 00 00       	jmp    802be4 <pthread_create+0x12c>
+  802b2c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b2f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b32:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b34:	39 f3                	cmp    %esi,%ebx
+  802b36:	73 16                	jae    802b4e <pthread_create+0x96>
+		va -= PGSIZE;
+  802b38:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+  802b41:	56                   	push   %esi
+  802b42:	6a 00                	push   $0x0
+  802b44:	e8 52 d7 ff ff       	call   80029b <sys_page_unmap>
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	eb e6                	jmp    802b34 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b4e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b51:	83 ec 08             	sub    $0x8,%esp
+  802b54:	ff 75 e4             	push   -0x1c(%ebp)
+  802b57:	6a 00                	push   $0x0
+  802b59:	e8 3d d7 ff ff       	call   80029b <sys_page_unmap>
+	return r;
+  802b5e:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b61:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b64:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b6b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b72:	eb 70                	jmp    802be4 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b74:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b77:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b81:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b84:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b87:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b8a:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b91:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b96:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b99:	29 c8                	sub    %ecx,%eax
+  802b9b:	85 db                	test   %ebx,%ebx
+  802b9d:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802ba4:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802ba7:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802bae:	83 ec 04             	sub    $0x4,%esp
+  802bb1:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802bb6:	29 ca                	sub    %ecx,%edx
+  802bb8:	52                   	push   %edx
+	*--esp = 0;
+  802bb9:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802bbc:	50                   	push   %eax
+  802bbd:	68 15 2e 80 00       	push   $0x802e15
+  802bc2:	e8 24 da ff ff       	call   8005eb <sys_thread_create>
+  802bc7:	89 c7                	mov    %eax,%edi
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	78 91                	js     802b61 <pthread_create+0xa9>
+	th->th_env = id;
+  802bd0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bd3:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdd:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802be4:	89 f8                	mov    %edi,%eax
+  802be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be9:	5b                   	pop    %ebx
+  802bea:	5e                   	pop    %esi
+  802beb:	5f                   	pop    %edi
+  802bec:	5d                   	pop    %ebp
+  802bed:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bee:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bf1:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bf8:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802bff:	83 ec 0c             	sub    $0xc,%esp
+  802c02:	68 20 60 80 00       	push   $0x806020
+  802c07:	e8 c3 fc ff ff       	call   8028cf <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802c0c:	89 d9                	mov    %ebx,%ecx
+  802c0e:	c1 e1 10             	shl    $0x10,%ecx
+  802c11:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802c14:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802c19:	29 c8                	sub    %ecx,%eax
+  802c1b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802c1e:	c1 e8 16             	shr    $0x16,%eax
+  802c21:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c28:	83 c4 10             	add    $0x10,%esp
+  802c2b:	a8 01                	test   $0x1,%al
+  802c2d:	74 15                	je     802c44 <pthread_create+0x18c>
+  802c2f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c32:	c1 e8 0c             	shr    $0xc,%eax
+  802c35:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c3c:	a8 01                	test   $0x1,%al
+  802c3e:	0f 85 30 ff ff ff    	jne    802b74 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c44:	83 ec 04             	sub    $0x4,%esp
+  802c47:	6a 07                	push   $0x7
+  802c49:	ff 75 e4             	push   -0x1c(%ebp)
+  802c4c:	6a 00                	push   $0x0
+  802c4e:	e8 af d5 ff ff       	call   800202 <sys_page_alloc>
+  802c53:	89 c7                	mov    %eax,%edi
+  802c55:	83 c4 10             	add    $0x10,%esp
+  802c58:	85 c0                	test   %eax,%eax
+  802c5a:	0f 88 01 ff ff ff    	js     802b61 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c60:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c65:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c68:	29 d0                	sub    %edx,%eax
+  802c6a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c6d:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c6f:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c74:	29 d0                	sub    %edx,%eax
+  802c76:	89 c7                	mov    %eax,%edi
+  802c78:	39 fe                	cmp    %edi,%esi
+  802c7a:	0f 83 f4 fe ff ff    	jae    802b74 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c80:	83 ec 04             	sub    $0x4,%esp
+  802c83:	6a 07                	push   $0x7
+  802c85:	56                   	push   %esi
+  802c86:	6a 00                	push   $0x0
+  802c88:	e8 75 d5 ff ff       	call   800202 <sys_page_alloc>
+  802c8d:	83 c4 10             	add    $0x10,%esp
+  802c90:	85 c0                	test   %eax,%eax
+  802c92:	0f 88 94 fe ff ff    	js     802b2c <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c98:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c9e:	eb d8                	jmp    802c78 <pthread_create+0x1c0>
+
+00802ca0 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802ca0:	55                   	push   %ebp
+  802ca1:	89 e5                	mov    %esp,%ebp
+  802ca3:	57                   	push   %edi
+  802ca4:	56                   	push   %esi
+  802ca5:	53                   	push   %ebx
+  802ca6:	83 ec 0c             	sub    $0xc,%esp
+  802ca9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802cac:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802caf:	83 f8 1e             	cmp    $0x1e,%eax
+  802cb2:	0f 87 c7 00 00 00    	ja     802d7f <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802cb8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802cba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802cc0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802cc5:	77 12                	ja     802cd9 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802cc7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ccc:	29 d0                	sub    %edx,%eax
+  802cce:	c1 e8 10             	shr    $0x10,%eax
+  802cd1:	39 c3                	cmp    %eax,%ebx
+  802cd3:	0f 84 ad 00 00 00    	je     802d86 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cd9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cdc:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ce3:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cea:	eb 10                	jmp    802cfc <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cec:	83 ec 04             	sub    $0x4,%esp
+  802cef:	6a 00                	push   $0x0
+  802cf1:	6a 01                	push   $0x1
+  802cf3:	57                   	push   %edi
+  802cf4:	e8 1e d8 ff ff       	call   800517 <sys_futex_wait>
+  802cf9:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cfc:	8b 46 04             	mov    0x4(%esi),%eax
+  802cff:	83 f8 01             	cmp    $0x1,%eax
+  802d02:	74 e8                	je     802cec <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802d04:	83 f8 02             	cmp    $0x2,%eax
+  802d07:	0f 85 80 00 00 00    	jne    802d8d <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802d0d:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802d10:	c1 e6 02             	shl    $0x2,%esi
+  802d13:	eb 05                	jmp    802d1a <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802d15:	e8 bc d4 ff ff       	call   8001d6 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802d1a:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802d20:	89 ca                	mov    %ecx,%edx
+  802d22:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d28:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d2b:	c1 e0 04             	shl    $0x4,%eax
+  802d2e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d33:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d36:	39 c1                	cmp    %eax,%ecx
+  802d38:	75 12                	jne    802d4c <pthread_join+0xac>
+  802d3a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d3d:	c1 e0 04             	shl    $0x4,%eax
+  802d40:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d45:	8b 40 54             	mov    0x54(%eax),%eax
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	75 c9                	jne    802d15 <pthread_join+0x75>
+	if (ret_store)
+  802d4c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d50:	74 0f                	je     802d61 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d52:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d55:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d5c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d5f:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d61:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d64:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d6b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	5f                   	pop    %edi
+  802d7d:	5d                   	pop    %ebp
+  802d7e:	c3                   	ret
+		return -E_INVAL;
+  802d7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d84:	eb f1                	jmp    802d77 <pthread_join+0xd7>
+  802d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d8b:	eb ea                	jmp    802d77 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d92:	eb e3                	jmp    802d77 <pthread_join+0xd7>
+
+00802d94 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	53                   	push   %ebx
+  802d98:	83 ec 04             	sub    $0x4,%esp
+  802d9b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d9d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802da3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802da8:	77 0c                	ja     802db6 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802daa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802daf:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802db1:	c1 e8 10             	shr    $0x10,%eax
+  802db4:	75 0a                	jne    802dc0 <pthread_exit+0x2c>
+		exit();
+  802db6:	e8 25 d3 ff ff       	call   8000e0 <exit>
+  802dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802dc0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802dc7:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802dca:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802dd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dd4:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802dd7:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802dde:	83 ec 08             	sub    $0x8,%esp
+  802de1:	6a 20                	push   $0x20
+  802de3:	01 c2                	add    %eax,%edx
+  802de5:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dec:	50                   	push   %eax
+  802ded:	e8 54 d7 ff ff       	call   800546 <sys_futex_wake>
+	sys_env_destroy(0);
+  802df2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802df9:	e8 61 d3 ff ff       	call   80015f <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802dfe:	83 c4 0c             	add    $0xc,%esp
+  802e01:	68 be 48 80 00       	push   $0x8048be
+  802e06:	68 a5 00 00 00       	push   $0xa5
+  802e0b:	68 d8 48 80 00       	push   $0x8048d8
+  802e10:	e8 cd 03 00 00       	call   8031e2 <_panic>
+
+00802e15 <pthread_start>:
+{
+  802e15:	55                   	push   %ebp
+  802e16:	89 e5                	mov    %esp,%ebp
+  802e18:	53                   	push   %ebx
+  802e19:	83 ec 04             	sub    $0x4,%esp
+  802e1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802e1f:	e8 86 d3 ff ff       	call   8001aa <sys_getenvid>
+  802e24:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e29:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e2f:	85 db                	test   %ebx,%ebx
+  802e31:	74 0c                	je     802e3f <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e33:	89 d9                	mov    %ebx,%ecx
+  802e35:	c1 e1 10             	shl    $0x10,%ecx
+  802e38:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e3d:	29 ca                	sub    %ecx,%edx
+  802e3f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e42:	c1 e0 04             	shl    $0x4,%eax
+  802e45:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e4a:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e4c:	83 ec 0c             	sub    $0xc,%esp
+  802e4f:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e56:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e59:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e60:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e67:	89 04 24             	mov    %eax,(%esp)
+  802e6a:	e8 25 ff ff ff       	call   802d94 <pthread_exit>
+
+00802e6f <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e6f:	55                   	push   %ebp
+  802e70:	89 e5                	mov    %esp,%ebp
+  802e72:	57                   	push   %edi
+  802e73:	56                   	push   %esi
+  802e74:	53                   	push   %ebx
+  802e75:	83 ec 1c             	sub    $0x1c,%esp
+  802e78:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e7a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e80:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e87:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e8c:	77 0d                	ja     802e9b <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e8e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e93:	29 d0                	sub    %edx,%eax
+  802e95:	c1 e8 10             	shr    $0x10,%eax
+  802e98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea0:	eb 2f                	jmp    802ed1 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802ea2:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ea8:	8b 01                	mov    (%ecx),%eax
+  802eaa:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802ead:	39 c2                	cmp    %eax,%edx
+  802eaf:	75 14                	jne    802ec5 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802eb1:	83 ec 0c             	sub    $0xc,%esp
+  802eb4:	57                   	push   %edi
+  802eb5:	e8 a5 d2 ff ff       	call   80015f <sys_env_destroy>
+  802eba:	83 c4 10             	add    $0x10,%esp
+  802ebd:	85 c0                	test   %eax,%eax
+  802ebf:	0f 88 97 00 00 00    	js     802f5c <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802ec5:	83 c3 01             	add    $0x1,%ebx
+  802ec8:	83 fb 20             	cmp    $0x20,%ebx
+  802ecb:	0f 84 d2 00 00 00    	je     802fa3 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802ed1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ed4:	74 ef                	je     802ec5 <pthread_kill_others+0x56>
+  802ed6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ed9:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ee0:	8b 40 04             	mov    0x4(%eax),%eax
+  802ee3:	83 f8 01             	cmp    $0x1,%eax
+  802ee6:	75 dd                	jne    802ec5 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802ee8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802eeb:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ef2:	89 fe                	mov    %edi,%esi
+  802ef4:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802efa:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802efd:	c1 e0 04             	shl    $0x4,%eax
+  802f00:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f05:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f08:	39 c7                	cmp    %eax,%edi
+  802f0a:	75 b9                	jne    802ec5 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802f0c:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f0f:	c1 e0 04             	shl    $0x4,%eax
+  802f12:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f17:	8b 40 54             	mov    0x54(%eax),%eax
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	74 a7                	je     802ec5 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f1e:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f21:	c1 e0 04             	shl    $0x4,%eax
+  802f24:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f2a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f2c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f32:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f37:	0f 87 65 ff ff ff    	ja     802ea2 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f3d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f42:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f44:	c1 e8 10             	shr    $0x10,%eax
+  802f47:	0f 84 55 ff ff ff    	je     802ea2 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f4d:	c1 e0 10             	shl    $0x10,%eax
+  802f50:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f55:	29 c1                	sub    %eax,%ecx
+  802f57:	e9 4c ff ff ff       	jmp    802ea8 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f5c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f5f:	c1 e2 04             	shl    $0x4,%edx
+  802f62:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f68:	8b 52 48             	mov    0x48(%edx),%edx
+  802f6b:	39 fa                	cmp    %edi,%edx
+  802f6d:	0f 85 52 ff ff ff    	jne    802ec5 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f73:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f76:	c1 e2 04             	shl    $0x4,%edx
+  802f79:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f7f:	8b 52 54             	mov    0x54(%edx),%edx
+  802f82:	85 d2                	test   %edx,%edx
+  802f84:	0f 84 3b ff ff ff    	je     802ec5 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f8a:	83 ec 0c             	sub    $0xc,%esp
+  802f8d:	50                   	push   %eax
+  802f8e:	57                   	push   %edi
+  802f8f:	68 e8 48 80 00       	push   $0x8048e8
+  802f94:	68 bb 00 00 00       	push   $0xbb
+  802f99:	68 d8 48 80 00       	push   $0x8048d8
+  802f9e:	e8 3f 02 00 00       	call   8031e2 <_panic>
+	}
+}
+  802fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa6:	5b                   	pop    %ebx
+  802fa7:	5e                   	pop    %esi
+  802fa8:	5f                   	pop    %edi
+  802fa9:	5d                   	pop    %ebp
+  802faa:	c3                   	ret
+
+00802fab <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802fab:	55                   	push   %ebp
+  802fac:	89 e5                	mov    %esp,%ebp
+  802fae:	53                   	push   %ebx
+  802faf:	83 ec 04             	sub    $0x4,%esp
+  802fb2:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fb4:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802fba:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fc0:	0f 87 85 00 00 00    	ja     80304b <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fc6:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fcb:	29 c3                	sub    %eax,%ebx
+  802fcd:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fd0:	83 ec 04             	sub    $0x4,%esp
+  802fd3:	68 80 02 00 00       	push   $0x280
+  802fd8:	6a 00                	push   $0x0
+  802fda:	68 40 60 80 00       	push   $0x806040
+  802fdf:	e8 0e 0a 00 00       	call   8039f2 <memset>
+	threads_mu.m_state = 0;
+  802fe4:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802feb:	00 00 00 
+	if (self != 0) {
+  802fee:	83 c4 10             	add    $0x10,%esp
+  802ff1:	85 db                	test   %ebx,%ebx
+  802ff3:	74 51                	je     803046 <pthread_fork_child+0x9b>
+  802ff5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ff7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ffd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803002:	77 18                	ja     80301c <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803004:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803009:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80300b:	c1 e8 10             	shr    $0x10,%eax
+  80300e:	74 0c                	je     80301c <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803010:	c1 e0 10             	shl    $0x10,%eax
+  803013:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803018:	29 c2                	sub    %eax,%edx
+  80301a:	eb 06                	jmp    803022 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80301c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803022:	8b 02                	mov    (%edx),%eax
+  803024:	8b 48 48             	mov    0x48(%eax),%ecx
+  803027:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80302e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803031:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803038:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  80303f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803049:	c9                   	leave
+  80304a:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80304b:	83 ec 04             	sub    $0x4,%esp
+  80304e:	68 80 02 00 00       	push   $0x280
+  803053:	6a 00                	push   $0x0
+  803055:	68 40 60 80 00       	push   $0x806040
+  80305a:	e8 93 09 00 00       	call   8039f2 <memset>
+	threads_mu.m_state = 0;
+  80305f:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803066:	00 00 00 
+  803069:	83 c4 10             	add    $0x10,%esp
+  80306c:	eb d8                	jmp    803046 <pthread_fork_child+0x9b>
+
+0080306e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80306e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803073:	c3                   	ret
+
+00803074 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803074:	55                   	push   %ebp
+  803075:	89 e5                	mov    %esp,%ebp
+  803077:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80307a:	68 0d 49 80 00       	push   $0x80490d
+  80307f:	ff 75 0c             	push   0xc(%ebp)
+  803082:	e8 1a 08 00 00       	call   8038a1 <strcpy>
+	return 0;
+}
+  803087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308c:	c9                   	leave
+  80308d:	c3                   	ret
+
+0080308e <devcons_write>:
+{
+  80308e:	55                   	push   %ebp
+  80308f:	89 e5                	mov    %esp,%ebp
+  803091:	57                   	push   %edi
+  803092:	56                   	push   %esi
+  803093:	53                   	push   %ebx
+  803094:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80309a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80309f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8030a5:	eb 2e                	jmp    8030d5 <devcons_write+0x47>
+		m = n - tot;
+  8030a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030aa:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8030ac:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8030b1:	39 c3                	cmp    %eax,%ebx
+  8030b3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8030b6:	83 ec 04             	sub    $0x4,%esp
+  8030b9:	53                   	push   %ebx
+  8030ba:	89 f0                	mov    %esi,%eax
+  8030bc:	03 45 0c             	add    0xc(%ebp),%eax
+  8030bf:	50                   	push   %eax
+  8030c0:	57                   	push   %edi
+  8030c1:	e8 61 09 00 00       	call   803a27 <memmove>
+		sys_cputs(buf, m);
+  8030c6:	83 c4 08             	add    $0x8,%esp
+  8030c9:	53                   	push   %ebx
+  8030ca:	57                   	push   %edi
+  8030cb:	e8 38 d0 ff ff       	call   800108 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030d0:	01 de                	add    %ebx,%esi
+  8030d2:	83 c4 10             	add    $0x10,%esp
+  8030d5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030d8:	72 cd                	jb     8030a7 <devcons_write+0x19>
+}
+  8030da:	89 f0                	mov    %esi,%eax
+  8030dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030df:	5b                   	pop    %ebx
+  8030e0:	5e                   	pop    %esi
+  8030e1:	5f                   	pop    %edi
+  8030e2:	5d                   	pop    %ebp
+  8030e3:	c3                   	ret
+
+008030e4 <devcons_read>:
+{
+  8030e4:	55                   	push   %ebp
+  8030e5:	89 e5                	mov    %esp,%ebp
+  8030e7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ef:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030f3:	75 07                	jne    8030fc <devcons_read+0x18>
+  8030f5:	eb 1f                	jmp    803116 <devcons_read+0x32>
+		sys_yield();
+  8030f7:	e8 da d0 ff ff       	call   8001d6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030fc:	e8 32 d0 ff ff       	call   800133 <sys_cgetc>
+  803101:	85 c0                	test   %eax,%eax
+  803103:	74 f2                	je     8030f7 <devcons_read+0x13>
+	if (c < 0)
+  803105:	78 0f                	js     803116 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803107:	83 f8 04             	cmp    $0x4,%eax
+  80310a:	74 0c                	je     803118 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80310c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80310f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803111:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803116:	c9                   	leave
+  803117:	c3                   	ret
+		return 0;
+  803118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311d:	eb f7                	jmp    803116 <devcons_read+0x32>
+
+0080311f <cputchar>:
+{
+  80311f:	55                   	push   %ebp
+  803120:	89 e5                	mov    %esp,%ebp
+  803122:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803125:	8b 45 08             	mov    0x8(%ebp),%eax
+  803128:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80312b:	6a 01                	push   $0x1
+  80312d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803130:	50                   	push   %eax
+  803131:	e8 d2 cf ff ff       	call   800108 <sys_cputs>
+}
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	c9                   	leave
+  80313a:	c3                   	ret
+
+0080313b <getchar>:
+{
+  80313b:	55                   	push   %ebp
+  80313c:	89 e5                	mov    %esp,%ebp
+  80313e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803141:	6a 01                	push   $0x1
+  803143:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803146:	50                   	push   %eax
+  803147:	6a 00                	push   $0x0
+  803149:	e8 63 d8 ff ff       	call   8009b1 <read>
+	if (r < 0)
+  80314e:	83 c4 10             	add    $0x10,%esp
+  803151:	85 c0                	test   %eax,%eax
+  803153:	78 06                	js     80315b <getchar+0x20>
+	if (r < 1)
+  803155:	74 06                	je     80315d <getchar+0x22>
+	return c;
+  803157:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80315b:	c9                   	leave
+  80315c:	c3                   	ret
+		return -E_EOF;
+  80315d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803162:	eb f7                	jmp    80315b <getchar+0x20>
+
+00803164 <iscons>:
+{
+  803164:	55                   	push   %ebp
+  803165:	89 e5                	mov    %esp,%ebp
+  803167:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80316a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80316d:	50                   	push   %eax
+  80316e:	ff 75 08             	push   0x8(%ebp)
+  803171:	e8 ab d5 ff ff       	call   800721 <fd_lookup>
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	78 11                	js     80318e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80317d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803180:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803186:	39 10                	cmp    %edx,(%eax)
+  803188:	0f 94 c0             	sete   %al
+  80318b:	0f b6 c0             	movzbl %al,%eax
+}
+  80318e:	c9                   	leave
+  80318f:	c3                   	ret
+
+00803190 <opencons>:
+{
+  803190:	55                   	push   %ebp
+  803191:	89 e5                	mov    %esp,%ebp
+  803193:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803196:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803199:	50                   	push   %eax
+  80319a:	e8 2c d5 ff ff       	call   8006cb <fd_alloc>
+  80319f:	83 c4 10             	add    $0x10,%esp
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	78 3a                	js     8031e0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8031a6:	83 ec 04             	sub    $0x4,%esp
+  8031a9:	68 07 04 00 00       	push   $0x407
+  8031ae:	ff 75 f4             	push   -0xc(%ebp)
+  8031b1:	6a 00                	push   $0x0
+  8031b3:	e8 4a d0 ff ff       	call   800202 <sys_page_alloc>
+  8031b8:	83 c4 10             	add    $0x10,%esp
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	78 21                	js     8031e0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031c2:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8031c8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031cd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031d4:	83 ec 0c             	sub    $0xc,%esp
+  8031d7:	50                   	push   %eax
+  8031d8:	e8 c7 d4 ff ff       	call   8006a4 <fd2num>
+  8031dd:	83 c4 10             	add    $0x10,%esp
+}
+  8031e0:	c9                   	leave
+  8031e1:	c3                   	ret
+
+008031e2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031e2:	55                   	push   %ebp
+  8031e3:	89 e5                	mov    %esp,%ebp
+  8031e5:	56                   	push   %esi
+  8031e6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031e7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031ea:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031f0:	e8 b5 cf ff ff       	call   8001aa <sys_getenvid>
+  8031f5:	83 ec 0c             	sub    $0xc,%esp
+  8031f8:	ff 75 0c             	push   0xc(%ebp)
+  8031fb:	ff 75 08             	push   0x8(%ebp)
+  8031fe:	56                   	push   %esi
+  8031ff:	50                   	push   %eax
+  803200:	68 1c 49 80 00       	push   $0x80491c
+  803205:	e8 b3 00 00 00       	call   8032bd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80320a:	83 c4 18             	add    $0x18,%esp
+  80320d:	53                   	push   %ebx
+  80320e:	ff 75 10             	push   0x10(%ebp)
+  803211:	e8 56 00 00 00       	call   80326c <vcprintf>
+	cprintf("\n");
+  803216:	c7 04 24 f2 4d 80 00 	movl   $0x804df2,(%esp)
+  80321d:	e8 9b 00 00 00       	call   8032bd <cprintf>
+  803222:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803225:	cc                   	int3
+	while (1)
+  803226:	eb fd                	jmp    803225 <_panic+0x43>
+
+00803228 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803228:	55                   	push   %ebp
+  803229:	89 e5                	mov    %esp,%ebp
+  80322b:	53                   	push   %ebx
+  80322c:	83 ec 04             	sub    $0x4,%esp
+  80322f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803232:	8b 13                	mov    (%ebx),%edx
+  803234:	8d 42 01             	lea    0x1(%edx),%eax
+  803237:	89 03                	mov    %eax,(%ebx)
+  803239:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80323c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803240:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803245:	74 09                	je     803250 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803247:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80324b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80324e:	c9                   	leave
+  80324f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803250:	83 ec 08             	sub    $0x8,%esp
+  803253:	68 ff 00 00 00       	push   $0xff
+  803258:	8d 43 08             	lea    0x8(%ebx),%eax
+  80325b:	50                   	push   %eax
+  80325c:	e8 a7 ce ff ff       	call   800108 <sys_cputs>
+		b->idx = 0;
+  803261:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803267:	83 c4 10             	add    $0x10,%esp
+  80326a:	eb db                	jmp    803247 <putch+0x1f>
+
+0080326c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80326c:	55                   	push   %ebp
+  80326d:	89 e5                	mov    %esp,%ebp
+  80326f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803275:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80327c:	00 00 00 
+	b.cnt = 0;
+  80327f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803286:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803289:	ff 75 0c             	push   0xc(%ebp)
+  80328c:	ff 75 08             	push   0x8(%ebp)
+  80328f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803295:	50                   	push   %eax
+  803296:	68 28 32 80 00       	push   $0x803228
+  80329b:	e8 14 01 00 00       	call   8033b4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8032a0:	83 c4 08             	add    $0x8,%esp
+  8032a3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8032a9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8032af:	50                   	push   %eax
+  8032b0:	e8 53 ce ff ff       	call   800108 <sys_cputs>
+
+	return b.cnt;
+}
+  8032b5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8032bb:	c9                   	leave
+  8032bc:	c3                   	ret
+
+008032bd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8032bd:	55                   	push   %ebp
+  8032be:	89 e5                	mov    %esp,%ebp
+  8032c0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8032c3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8032c6:	50                   	push   %eax
+  8032c7:	ff 75 08             	push   0x8(%ebp)
+  8032ca:	e8 9d ff ff ff       	call   80326c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032cf:	c9                   	leave
+  8032d0:	c3                   	ret
+
+008032d1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	57                   	push   %edi
+  8032d5:	56                   	push   %esi
+  8032d6:	53                   	push   %ebx
+  8032d7:	83 ec 1c             	sub    $0x1c,%esp
+  8032da:	89 c7                	mov    %eax,%edi
+  8032dc:	89 d6                	mov    %edx,%esi
+  8032de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032e4:	89 d1                	mov    %edx,%ecx
+  8032e6:	89 c2                	mov    %eax,%edx
+  8032e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032eb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032ee:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032f1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032f7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032fe:	39 c2                	cmp    %eax,%edx
+  803300:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803303:	72 3e                	jb     803343 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  803305:	83 ec 0c             	sub    $0xc,%esp
+  803308:	ff 75 18             	push   0x18(%ebp)
+  80330b:	83 eb 01             	sub    $0x1,%ebx
+  80330e:	53                   	push   %ebx
+  80330f:	50                   	push   %eax
+  803310:	83 ec 08             	sub    $0x8,%esp
+  803313:	ff 75 e4             	push   -0x1c(%ebp)
+  803316:	ff 75 e0             	push   -0x20(%ebp)
+  803319:	ff 75 dc             	push   -0x24(%ebp)
+  80331c:	ff 75 d8             	push   -0x28(%ebp)
+  80331f:	e8 47 12 00 00       	call   80456b <__udivdi3>
+  803324:	83 c4 18             	add    $0x18,%esp
+  803327:	52                   	push   %edx
+  803328:	50                   	push   %eax
+  803329:	89 f2                	mov    %esi,%edx
+  80332b:	89 f8                	mov    %edi,%eax
+  80332d:	e8 9f ff ff ff       	call   8032d1 <printnum>
+  803332:	83 c4 20             	add    $0x20,%esp
+  803335:	eb 13                	jmp    80334a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803337:	83 ec 08             	sub    $0x8,%esp
+  80333a:	56                   	push   %esi
+  80333b:	ff 75 18             	push   0x18(%ebp)
+  80333e:	ff d7                	call   *%edi
+  803340:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803343:	83 eb 01             	sub    $0x1,%ebx
+  803346:	85 db                	test   %ebx,%ebx
+  803348:	7f ed                	jg     803337 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80334a:	83 ec 08             	sub    $0x8,%esp
+  80334d:	56                   	push   %esi
+  80334e:	83 ec 04             	sub    $0x4,%esp
+  803351:	ff 75 e4             	push   -0x1c(%ebp)
+  803354:	ff 75 e0             	push   -0x20(%ebp)
+  803357:	ff 75 dc             	push   -0x24(%ebp)
+  80335a:	ff 75 d8             	push   -0x28(%ebp)
+  80335d:	e8 2a 12 00 00       	call   80458c <__umoddi3>
+  803362:	83 c4 14             	add    $0x14,%esp
+  803365:	0f be 80 3f 49 80 00 	movsbl 0x80493f(%eax),%eax
+  80336c:	50                   	push   %eax
+  80336d:	ff d7                	call   *%edi
+}
+  80336f:	83 c4 10             	add    $0x10,%esp
+  803372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803375:	5b                   	pop    %ebx
+  803376:	5e                   	pop    %esi
+  803377:	5f                   	pop    %edi
+  803378:	5d                   	pop    %ebp
+  803379:	c3                   	ret
+
+0080337a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803380:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803384:	8b 10                	mov    (%eax),%edx
+  803386:	3b 50 04             	cmp    0x4(%eax),%edx
+  803389:	73 0a                	jae    803395 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80338b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80338e:	89 08                	mov    %ecx,(%eax)
+  803390:	8b 45 08             	mov    0x8(%ebp),%eax
+  803393:	88 02                	mov    %al,(%edx)
+}
+  803395:	5d                   	pop    %ebp
+  803396:	c3                   	ret
+
+00803397 <printfmt>:
+{
+  803397:	55                   	push   %ebp
+  803398:	89 e5                	mov    %esp,%ebp
+  80339a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80339d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8033a0:	50                   	push   %eax
+  8033a1:	ff 75 10             	push   0x10(%ebp)
+  8033a4:	ff 75 0c             	push   0xc(%ebp)
+  8033a7:	ff 75 08             	push   0x8(%ebp)
+  8033aa:	e8 05 00 00 00       	call   8033b4 <vprintfmt>
+}
+  8033af:	83 c4 10             	add    $0x10,%esp
+  8033b2:	c9                   	leave
+  8033b3:	c3                   	ret
+
+008033b4 <vprintfmt>:
+{
+  8033b4:	55                   	push   %ebp
+  8033b5:	89 e5                	mov    %esp,%ebp
+  8033b7:	57                   	push   %edi
+  8033b8:	56                   	push   %esi
+  8033b9:	53                   	push   %ebx
+  8033ba:	83 ec 2c             	sub    $0x2c,%esp
+  8033bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8033c3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033c6:	eb 0a                	jmp    8033d2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033c8:	83 ec 08             	sub    $0x8,%esp
+  8033cb:	53                   	push   %ebx
+  8033cc:	50                   	push   %eax
+  8033cd:	ff d6                	call   *%esi
+  8033cf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033d2:	83 c7 01             	add    $0x1,%edi
+  8033d5:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033d9:	83 f8 25             	cmp    $0x25,%eax
+  8033dc:	74 0c                	je     8033ea <vprintfmt+0x36>
+			if (ch == '\0')
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	75 e6                	jne    8033c8 <vprintfmt+0x14>
+}
+  8033e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e5:	5b                   	pop    %ebx
+  8033e6:	5e                   	pop    %esi
+  8033e7:	5f                   	pop    %edi
+  8033e8:	5d                   	pop    %ebp
+  8033e9:	c3                   	ret
+		padc = ' ';
+  8033ea:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033ee:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033f5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033fc:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  803403:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  803408:	8d 47 01             	lea    0x1(%edi),%eax
+  80340b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80340e:	0f b6 17             	movzbl (%edi),%edx
+  803411:	8d 42 dd             	lea    -0x23(%edx),%eax
+  803414:	3c 55                	cmp    $0x55,%al
+  803416:	0f 87 c5 03 00 00    	ja     8037e1 <vprintfmt+0x42d>
+  80341c:	0f b6 c0             	movzbl %al,%eax
+  80341f:	ff 24 85 c0 4a 80 00 	jmp    *0x804ac0(,%eax,4)
+  803426:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  803429:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80342c:	eb da                	jmp    803408 <vprintfmt+0x54>
+  80342e:	0f be d2             	movsbl %dl,%edx
+  803431:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803434:	b8 00 00 00 00       	mov    $0x0,%eax
+  803439:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80343c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80343f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803443:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803446:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803449:	83 f9 09             	cmp    $0x9,%ecx
+  80344c:	77 55                	ja     8034a3 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80344e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803451:	eb e9                	jmp    80343c <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803453:	8b 45 14             	mov    0x14(%ebp),%eax
+  803456:	8b 00                	mov    (%eax),%eax
+  803458:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80345b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80345e:	8d 40 04             	lea    0x4(%eax),%eax
+  803461:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803464:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803467:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80346b:	79 9b                	jns    803408 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80346d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803470:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803473:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80347a:	eb 8c                	jmp    803408 <vprintfmt+0x54>
+			if (width < 0)
+  80347c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80347f:	85 d2                	test   %edx,%edx
+  803481:	b8 00 00 00 00       	mov    $0x0,%eax
+  803486:	0f 49 c2             	cmovns %edx,%eax
+  803489:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80348c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80348f:	e9 74 ff ff ff       	jmp    803408 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803494:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803497:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80349e:	e9 65 ff ff ff       	jmp    803408 <vprintfmt+0x54>
+  8034a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034a6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8034a9:	eb bc                	jmp    803467 <vprintfmt+0xb3>
+			lflag++;
+  8034ab:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8034ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8034b1:	e9 52 ff ff ff       	jmp    803408 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8034b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034b9:	8d 78 04             	lea    0x4(%eax),%edi
+  8034bc:	83 ec 08             	sub    $0x8,%esp
+  8034bf:	53                   	push   %ebx
+  8034c0:	ff 30                	push   (%eax)
+  8034c2:	ff d6                	call   *%esi
+			break;
+  8034c4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034ca:	e9 b1 02 00 00       	jmp    803780 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034d2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034d5:	8b 10                	mov    (%eax),%edx
+  8034d7:	89 d0                	mov    %edx,%eax
+  8034d9:	f7 d8                	neg    %eax
+  8034db:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034de:	83 f8 14             	cmp    $0x14,%eax
+  8034e1:	7f 23                	jg     803506 <vprintfmt+0x152>
+  8034e3:	8b 14 85 20 4c 80 00 	mov    0x804c20(,%eax,4),%edx
+  8034ea:	85 d2                	test   %edx,%edx
+  8034ec:	74 18                	je     803506 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034ee:	52                   	push   %edx
+  8034ef:	68 e7 47 80 00       	push   $0x8047e7
+  8034f4:	53                   	push   %ebx
+  8034f5:	56                   	push   %esi
+  8034f6:	e8 9c fe ff ff       	call   803397 <printfmt>
+  8034fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034fe:	89 7d 14             	mov    %edi,0x14(%ebp)
+  803501:	e9 7a 02 00 00       	jmp    803780 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  803506:	50                   	push   %eax
+  803507:	68 57 49 80 00       	push   $0x804957
+  80350c:	53                   	push   %ebx
+  80350d:	56                   	push   %esi
+  80350e:	e8 84 fe ff ff       	call   803397 <printfmt>
+  803513:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803516:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  803519:	e9 62 02 00 00       	jmp    803780 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80351e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803521:	83 c0 04             	add    $0x4,%eax
+  803524:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80352a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80352c:	85 c9                	test   %ecx,%ecx
+  80352e:	b8 50 49 80 00       	mov    $0x804950,%eax
+  803533:	0f 45 c1             	cmovne %ecx,%eax
+  803536:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803539:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80353d:	7e 06                	jle    803545 <vprintfmt+0x191>
+  80353f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803543:	75 0b                	jne    803550 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803545:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803548:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80354b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80354e:	eb 5c                	jmp    8035ac <vprintfmt+0x1f8>
+  803550:	83 ec 08             	sub    $0x8,%esp
+  803553:	ff 75 d0             	push   -0x30(%ebp)
+  803556:	ff 75 cc             	push   -0x34(%ebp)
+  803559:	e8 20 03 00 00       	call   80387e <strnlen>
+  80355e:	89 c2                	mov    %eax,%edx
+  803560:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803563:	29 d0                	sub    %edx,%eax
+  803565:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803568:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80356c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80356f:	89 75 08             	mov    %esi,0x8(%ebp)
+  803572:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803574:	eb 0e                	jmp    803584 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  803576:	83 ec 08             	sub    $0x8,%esp
+  803579:	53                   	push   %ebx
+  80357a:	57                   	push   %edi
+  80357b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80357e:	83 ee 01             	sub    $0x1,%esi
+  803581:	83 c4 10             	add    $0x10,%esp
+  803584:	85 f6                	test   %esi,%esi
+  803586:	7f ee                	jg     803576 <vprintfmt+0x1c2>
+  803588:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80358b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80358e:	85 c0                	test   %eax,%eax
+  803590:	ba 00 00 00 00       	mov    $0x0,%edx
+  803595:	0f 49 d0             	cmovns %eax,%edx
+  803598:	29 d0                	sub    %edx,%eax
+  80359a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80359d:	eb a6                	jmp    803545 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80359f:	83 ec 08             	sub    $0x8,%esp
+  8035a2:	53                   	push   %ebx
+  8035a3:	52                   	push   %edx
+  8035a4:	ff 55 08             	call   *0x8(%ebp)
+  8035a7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8035aa:	89 f1                	mov    %esi,%ecx
+  8035ac:	8d 71 01             	lea    0x1(%ecx),%esi
+  8035af:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8035b3:	0f be d0             	movsbl %al,%edx
+  8035b6:	85 d2                	test   %edx,%edx
+  8035b8:	74 28                	je     8035e2 <vprintfmt+0x22e>
+  8035ba:	85 ff                	test   %edi,%edi
+  8035bc:	78 05                	js     8035c3 <vprintfmt+0x20f>
+  8035be:	83 ef 01             	sub    $0x1,%edi
+  8035c1:	78 30                	js     8035f3 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8035c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035c7:	74 d6                	je     80359f <vprintfmt+0x1eb>
+  8035c9:	0f be c0             	movsbl %al,%eax
+  8035cc:	83 e8 20             	sub    $0x20,%eax
+  8035cf:	83 f8 5e             	cmp    $0x5e,%eax
+  8035d2:	76 cb                	jbe    80359f <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035d4:	83 ec 08             	sub    $0x8,%esp
+  8035d7:	53                   	push   %ebx
+  8035d8:	6a 3f                	push   $0x3f
+  8035da:	ff 55 08             	call   *0x8(%ebp)
+  8035dd:	83 c4 10             	add    $0x10,%esp
+  8035e0:	eb c8                	jmp    8035aa <vprintfmt+0x1f6>
+  8035e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035e5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035eb:	01 d0                	add    %edx,%eax
+  8035ed:	29 c8                	sub    %ecx,%eax
+  8035ef:	89 c7                	mov    %eax,%edi
+  8035f1:	eb 13                	jmp    803606 <vprintfmt+0x252>
+  8035f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035f6:	eb ed                	jmp    8035e5 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035f8:	83 ec 08             	sub    $0x8,%esp
+  8035fb:	53                   	push   %ebx
+  8035fc:	6a 20                	push   $0x20
+  8035fe:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  803600:	83 ef 01             	sub    $0x1,%edi
+  803603:	83 c4 10             	add    $0x10,%esp
+  803606:	85 ff                	test   %edi,%edi
+  803608:	7f ee                	jg     8035f8 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80360a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80360d:	89 45 14             	mov    %eax,0x14(%ebp)
+  803610:	e9 6b 01 00 00       	jmp    803780 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  803615:	83 f9 01             	cmp    $0x1,%ecx
+  803618:	7f 1f                	jg     803639 <vprintfmt+0x285>
+	else if (lflag)
+  80361a:	85 c9                	test   %ecx,%ecx
+  80361c:	74 67                	je     803685 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80361e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803621:	8b 00                	mov    (%eax),%eax
+  803623:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803626:	89 c1                	mov    %eax,%ecx
+  803628:	c1 f9 1f             	sar    $0x1f,%ecx
+  80362b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80362e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803631:	8d 40 04             	lea    0x4(%eax),%eax
+  803634:	89 45 14             	mov    %eax,0x14(%ebp)
+  803637:	eb 17                	jmp    803650 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  803639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80363c:	8b 50 04             	mov    0x4(%eax),%edx
+  80363f:	8b 00                	mov    (%eax),%eax
+  803641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803644:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80364a:	8d 40 08             	lea    0x8(%eax),%eax
+  80364d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803650:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803653:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803656:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80365b:	85 c9                	test   %ecx,%ecx
+  80365d:	0f 89 03 01 00 00    	jns    803766 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803663:	83 ec 08             	sub    $0x8,%esp
+  803666:	53                   	push   %ebx
+  803667:	6a 2d                	push   $0x2d
+  803669:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80366b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80366e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803671:	f7 da                	neg    %edx
+  803673:	83 d1 00             	adc    $0x0,%ecx
+  803676:	f7 d9                	neg    %ecx
+  803678:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80367b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803680:	e9 e1 00 00 00       	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  803685:	8b 45 14             	mov    0x14(%ebp),%eax
+  803688:	8b 00                	mov    (%eax),%eax
+  80368a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80368d:	89 c1                	mov    %eax,%ecx
+  80368f:	c1 f9 1f             	sar    $0x1f,%ecx
+  803692:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803695:	8b 45 14             	mov    0x14(%ebp),%eax
+  803698:	8d 40 04             	lea    0x4(%eax),%eax
+  80369b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80369e:	eb b0                	jmp    803650 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8036a0:	83 f9 01             	cmp    $0x1,%ecx
+  8036a3:	7f 1e                	jg     8036c3 <vprintfmt+0x30f>
+	else if (lflag)
+  8036a5:	85 c9                	test   %ecx,%ecx
+  8036a7:	74 32                	je     8036db <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8036a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ac:	8b 10                	mov    (%eax),%edx
+  8036ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8036b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8036be:	e9 a3 00 00 00       	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036c6:	8b 10                	mov    (%eax),%edx
+  8036c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8036ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036d6:	e9 8b 00 00 00       	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036de:	8b 10                	mov    (%eax),%edx
+  8036e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8036e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036f0:	eb 74                	jmp    803766 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036f2:	83 f9 01             	cmp    $0x1,%ecx
+  8036f5:	7f 1b                	jg     803712 <vprintfmt+0x35e>
+	else if (lflag)
+  8036f7:	85 c9                	test   %ecx,%ecx
+  8036f9:	74 2c                	je     803727 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036fe:	8b 10                	mov    (%eax),%edx
+  803700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803705:	8d 40 04             	lea    0x4(%eax),%eax
+  803708:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80370b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  803710:	eb 54                	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803712:	8b 45 14             	mov    0x14(%ebp),%eax
+  803715:	8b 10                	mov    (%eax),%edx
+  803717:	8b 48 04             	mov    0x4(%eax),%ecx
+  80371a:	8d 40 08             	lea    0x8(%eax),%eax
+  80371d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803720:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  803725:	eb 3f                	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80372a:	8b 10                	mov    (%eax),%edx
+  80372c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803731:	8d 40 04             	lea    0x4(%eax),%eax
+  803734:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803737:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80373c:	eb 28                	jmp    803766 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80373e:	83 ec 08             	sub    $0x8,%esp
+  803741:	53                   	push   %ebx
+  803742:	6a 30                	push   $0x30
+  803744:	ff d6                	call   *%esi
+			putch('x', putdat);
+  803746:	83 c4 08             	add    $0x8,%esp
+  803749:	53                   	push   %ebx
+  80374a:	6a 78                	push   $0x78
+  80374c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80374e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803751:	8b 10                	mov    (%eax),%edx
+  803753:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803758:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80375b:	8d 40 04             	lea    0x4(%eax),%eax
+  80375e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803761:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803766:	83 ec 0c             	sub    $0xc,%esp
+  803769:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80376d:	50                   	push   %eax
+  80376e:	ff 75 e0             	push   -0x20(%ebp)
+  803771:	57                   	push   %edi
+  803772:	51                   	push   %ecx
+  803773:	52                   	push   %edx
+  803774:	89 da                	mov    %ebx,%edx
+  803776:	89 f0                	mov    %esi,%eax
+  803778:	e8 54 fb ff ff       	call   8032d1 <printnum>
+			break;
+  80377d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803783:	e9 4a fc ff ff       	jmp    8033d2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803788:	83 f9 01             	cmp    $0x1,%ecx
+  80378b:	7f 1b                	jg     8037a8 <vprintfmt+0x3f4>
+	else if (lflag)
+  80378d:	85 c9                	test   %ecx,%ecx
+  80378f:	74 2c                	je     8037bd <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803791:	8b 45 14             	mov    0x14(%ebp),%eax
+  803794:	8b 10                	mov    (%eax),%edx
+  803796:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80379b:	8d 40 04             	lea    0x4(%eax),%eax
+  80379e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037a1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8037a6:	eb be                	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8037a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037ab:	8b 10                	mov    (%eax),%edx
+  8037ad:	8b 48 04             	mov    0x4(%eax),%ecx
+  8037b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8037b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8037bb:	eb a9                	jmp    803766 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8037bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037c0:	8b 10                	mov    (%eax),%edx
+  8037c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8037ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037cd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037d2:	eb 92                	jmp    803766 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037d4:	83 ec 08             	sub    $0x8,%esp
+  8037d7:	53                   	push   %ebx
+  8037d8:	6a 25                	push   $0x25
+  8037da:	ff d6                	call   *%esi
+			break;
+  8037dc:	83 c4 10             	add    $0x10,%esp
+  8037df:	eb 9f                	jmp    803780 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037e1:	83 ec 08             	sub    $0x8,%esp
+  8037e4:	53                   	push   %ebx
+  8037e5:	6a 25                	push   $0x25
+  8037e7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037e9:	83 c4 10             	add    $0x10,%esp
+  8037ec:	89 f8                	mov    %edi,%eax
+  8037ee:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037f2:	74 05                	je     8037f9 <vprintfmt+0x445>
+  8037f4:	83 e8 01             	sub    $0x1,%eax
+  8037f7:	eb f5                	jmp    8037ee <vprintfmt+0x43a>
+  8037f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037fc:	eb 82                	jmp    803780 <vprintfmt+0x3cc>
+
+008037fe <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037fe:	55                   	push   %ebp
+  8037ff:	89 e5                	mov    %esp,%ebp
+  803801:	83 ec 18             	sub    $0x18,%esp
+  803804:	8b 45 08             	mov    0x8(%ebp),%eax
+  803807:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80380a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80380d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803811:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803814:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	74 26                	je     803845 <vsnprintf+0x47>
+  80381f:	85 d2                	test   %edx,%edx
+  803821:	7e 22                	jle    803845 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803823:	ff 75 14             	push   0x14(%ebp)
+  803826:	ff 75 10             	push   0x10(%ebp)
+  803829:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80382c:	50                   	push   %eax
+  80382d:	68 7a 33 80 00       	push   $0x80337a
+  803832:	e8 7d fb ff ff       	call   8033b4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803837:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80383a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80383d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803840:	83 c4 10             	add    $0x10,%esp
+}
+  803843:	c9                   	leave
+  803844:	c3                   	ret
+		return -E_INVAL;
+  803845:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80384a:	eb f7                	jmp    803843 <vsnprintf+0x45>
+
+0080384c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80384c:	55                   	push   %ebp
+  80384d:	89 e5                	mov    %esp,%ebp
+  80384f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803852:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803855:	50                   	push   %eax
+  803856:	ff 75 10             	push   0x10(%ebp)
+  803859:	ff 75 0c             	push   0xc(%ebp)
+  80385c:	ff 75 08             	push   0x8(%ebp)
+  80385f:	e8 9a ff ff ff       	call   8037fe <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803864:	c9                   	leave
+  803865:	c3                   	ret
+
+00803866 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803866:	55                   	push   %ebp
+  803867:	89 e5                	mov    %esp,%ebp
+  803869:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80386c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803871:	eb 03                	jmp    803876 <strlen+0x10>
+		n++;
+  803873:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803876:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80387a:	75 f7                	jne    803873 <strlen+0xd>
+	return n;
+}
+  80387c:	5d                   	pop    %ebp
+  80387d:	c3                   	ret
+
+0080387e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80387e:	55                   	push   %ebp
+  80387f:	89 e5                	mov    %esp,%ebp
+  803881:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803884:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388c:	eb 03                	jmp    803891 <strnlen+0x13>
+		n++;
+  80388e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803891:	39 d0                	cmp    %edx,%eax
+  803893:	74 08                	je     80389d <strnlen+0x1f>
+  803895:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803899:	75 f3                	jne    80388e <strnlen+0x10>
+  80389b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80389d:	89 d0                	mov    %edx,%eax
+  80389f:	5d                   	pop    %ebp
+  8038a0:	c3                   	ret
+
+008038a1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8038a1:	55                   	push   %ebp
+  8038a2:	89 e5                	mov    %esp,%ebp
+  8038a4:	53                   	push   %ebx
+  8038a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8038ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8038b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8038b7:	83 c0 01             	add    $0x1,%eax
+  8038ba:	84 d2                	test   %dl,%dl
+  8038bc:	75 f2                	jne    8038b0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8038be:	89 c8                	mov    %ecx,%eax
+  8038c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038c3:	c9                   	leave
+  8038c4:	c3                   	ret
+
+008038c5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8038c5:	55                   	push   %ebp
+  8038c6:	89 e5                	mov    %esp,%ebp
+  8038c8:	53                   	push   %ebx
+  8038c9:	83 ec 10             	sub    $0x10,%esp
+  8038cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038cf:	53                   	push   %ebx
+  8038d0:	e8 91 ff ff ff       	call   803866 <strlen>
+  8038d5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038d8:	ff 75 0c             	push   0xc(%ebp)
+  8038db:	01 d8                	add    %ebx,%eax
+  8038dd:	50                   	push   %eax
+  8038de:	e8 be ff ff ff       	call   8038a1 <strcpy>
+	return dst;
+}
+  8038e3:	89 d8                	mov    %ebx,%eax
+  8038e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+
+008038ea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038ea:	55                   	push   %ebp
+  8038eb:	89 e5                	mov    %esp,%ebp
+  8038ed:	56                   	push   %esi
+  8038ee:	53                   	push   %ebx
+  8038ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038f5:	89 f3                	mov    %esi,%ebx
+  8038f7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038fa:	89 f0                	mov    %esi,%eax
+  8038fc:	eb 0f                	jmp    80390d <strncpy+0x23>
+		*dst++ = *src;
+  8038fe:	83 c0 01             	add    $0x1,%eax
+  803901:	0f b6 0a             	movzbl (%edx),%ecx
+  803904:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803907:	80 f9 01             	cmp    $0x1,%cl
+  80390a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80390d:	39 d8                	cmp    %ebx,%eax
+  80390f:	75 ed                	jne    8038fe <strncpy+0x14>
+	}
+	return ret;
+}
+  803911:	89 f0                	mov    %esi,%eax
+  803913:	5b                   	pop    %ebx
+  803914:	5e                   	pop    %esi
+  803915:	5d                   	pop    %ebp
+  803916:	c3                   	ret
+
+00803917 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803917:	55                   	push   %ebp
+  803918:	89 e5                	mov    %esp,%ebp
+  80391a:	56                   	push   %esi
+  80391b:	53                   	push   %ebx
+  80391c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80391f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803922:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803925:	89 f0                	mov    %esi,%eax
+  803927:	85 d2                	test   %edx,%edx
+  803929:	74 21                	je     80394c <strlcpy+0x35>
+  80392b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80392f:	89 f2                	mov    %esi,%edx
+  803931:	eb 09                	jmp    80393c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803933:	83 c1 01             	add    $0x1,%ecx
+  803936:	83 c2 01             	add    $0x1,%edx
+  803939:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80393c:	39 c2                	cmp    %eax,%edx
+  80393e:	74 09                	je     803949 <strlcpy+0x32>
+  803940:	0f b6 19             	movzbl (%ecx),%ebx
+  803943:	84 db                	test   %bl,%bl
+  803945:	75 ec                	jne    803933 <strlcpy+0x1c>
+  803947:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  803949:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80394c:	29 f0                	sub    %esi,%eax
+}
+  80394e:	5b                   	pop    %ebx
+  80394f:	5e                   	pop    %esi
+  803950:	5d                   	pop    %ebp
+  803951:	c3                   	ret
+
+00803952 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803952:	55                   	push   %ebp
+  803953:	89 e5                	mov    %esp,%ebp
+  803955:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803958:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80395b:	eb 06                	jmp    803963 <strcmp+0x11>
+		p++, q++;
+  80395d:	83 c1 01             	add    $0x1,%ecx
+  803960:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803963:	0f b6 01             	movzbl (%ecx),%eax
+  803966:	84 c0                	test   %al,%al
+  803968:	74 04                	je     80396e <strcmp+0x1c>
+  80396a:	3a 02                	cmp    (%edx),%al
+  80396c:	74 ef                	je     80395d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80396e:	0f b6 c0             	movzbl %al,%eax
+  803971:	0f b6 12             	movzbl (%edx),%edx
+  803974:	29 d0                	sub    %edx,%eax
+}
+  803976:	5d                   	pop    %ebp
+  803977:	c3                   	ret
+
+00803978 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803978:	55                   	push   %ebp
+  803979:	89 e5                	mov    %esp,%ebp
+  80397b:	53                   	push   %ebx
+  80397c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80397f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803982:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  803985:	eb 09                	jmp    803990 <strncmp+0x18>
+		n--, p++, q++;
+  803987:	83 ea 01             	sub    $0x1,%edx
+  80398a:	83 c0 01             	add    $0x1,%eax
+  80398d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803990:	85 d2                	test   %edx,%edx
+  803992:	74 18                	je     8039ac <strncmp+0x34>
+  803994:	0f b6 18             	movzbl (%eax),%ebx
+  803997:	84 db                	test   %bl,%bl
+  803999:	74 04                	je     80399f <strncmp+0x27>
+  80399b:	3a 19                	cmp    (%ecx),%bl
+  80399d:	74 e8                	je     803987 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80399f:	0f b6 00             	movzbl (%eax),%eax
+  8039a2:	0f b6 11             	movzbl (%ecx),%edx
+  8039a5:	29 d0                	sub    %edx,%eax
+}
+  8039a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039aa:	c9                   	leave
+  8039ab:	c3                   	ret
+		return 0;
+  8039ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b1:	eb f4                	jmp    8039a7 <strncmp+0x2f>
+
+008039b3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8039b3:	55                   	push   %ebp
+  8039b4:	89 e5                	mov    %esp,%ebp
+  8039b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039bd:	eb 03                	jmp    8039c2 <strchr+0xf>
+  8039bf:	83 c0 01             	add    $0x1,%eax
+  8039c2:	0f b6 10             	movzbl (%eax),%edx
+  8039c5:	84 d2                	test   %dl,%dl
+  8039c7:	74 06                	je     8039cf <strchr+0x1c>
+		if (*s == c)
+  8039c9:	38 ca                	cmp    %cl,%dl
+  8039cb:	75 f2                	jne    8039bf <strchr+0xc>
+  8039cd:	eb 05                	jmp    8039d4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039d4:	5d                   	pop    %ebp
+  8039d5:	c3                   	ret
+
+008039d6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039d6:	55                   	push   %ebp
+  8039d7:	89 e5                	mov    %esp,%ebp
+  8039d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039dc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039e0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039e3:	38 ca                	cmp    %cl,%dl
+  8039e5:	74 09                	je     8039f0 <strfind+0x1a>
+  8039e7:	84 d2                	test   %dl,%dl
+  8039e9:	74 05                	je     8039f0 <strfind+0x1a>
+	for (; *s; s++)
+  8039eb:	83 c0 01             	add    $0x1,%eax
+  8039ee:	eb f0                	jmp    8039e0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039f0:	5d                   	pop    %ebp
+  8039f1:	c3                   	ret
+
+008039f2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039f2:	55                   	push   %ebp
+  8039f3:	89 e5                	mov    %esp,%ebp
+  8039f5:	57                   	push   %edi
+  8039f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039fc:	85 c9                	test   %ecx,%ecx
+  8039fe:	74 20                	je     803a20 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803a00:	89 f8                	mov    %edi,%eax
+  803a02:	09 c8                	or     %ecx,%eax
+  803a04:	a8 03                	test   $0x3,%al
+  803a06:	75 12                	jne    803a1a <memset+0x28>
+		c &= 0xFF;
+  803a08:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803a0c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803a12:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803a15:	fc                   	cld
+  803a16:	f3 ab                	rep stos %eax,%es:(%edi)
+  803a18:	eb 06                	jmp    803a20 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803a1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a1d:	fc                   	cld
+  803a1e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803a20:	89 f8                	mov    %edi,%eax
+  803a22:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803a25:	c9                   	leave
+  803a26:	c3                   	ret
+
+00803a27 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a27:	55                   	push   %ebp
+  803a28:	89 e5                	mov    %esp,%ebp
+  803a2a:	57                   	push   %edi
+  803a2b:	56                   	push   %esi
+  803a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a35:	39 c6                	cmp    %eax,%esi
+  803a37:	73 32                	jae    803a6b <memmove+0x44>
+  803a39:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a3c:	39 d0                	cmp    %edx,%eax
+  803a3e:	73 2b                	jae    803a6b <memmove+0x44>
+		s += n;
+		d += n;
+  803a40:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a43:	89 d6                	mov    %edx,%esi
+  803a45:	09 fe                	or     %edi,%esi
+  803a47:	09 ce                	or     %ecx,%esi
+  803a49:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a4f:	75 0e                	jne    803a5f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a51:	83 ef 04             	sub    $0x4,%edi
+  803a54:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a57:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a5a:	fd                   	std
+  803a5b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a5d:	eb 09                	jmp    803a68 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a5f:	83 ef 01             	sub    $0x1,%edi
+  803a62:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a65:	fd                   	std
+  803a66:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a68:	fc                   	cld
+  803a69:	eb 1a                	jmp    803a85 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a6b:	89 f2                	mov    %esi,%edx
+  803a6d:	09 c2                	or     %eax,%edx
+  803a6f:	09 ca                	or     %ecx,%edx
+  803a71:	f6 c2 03             	test   $0x3,%dl
+  803a74:	75 0a                	jne    803a80 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a76:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a79:	89 c7                	mov    %eax,%edi
+  803a7b:	fc                   	cld
+  803a7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a7e:	eb 05                	jmp    803a85 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a80:	89 c7                	mov    %eax,%edi
+  803a82:	fc                   	cld
+  803a83:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a85:	5e                   	pop    %esi
+  803a86:	5f                   	pop    %edi
+  803a87:	5d                   	pop    %ebp
+  803a88:	c3                   	ret
+
+00803a89 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a89:	55                   	push   %ebp
+  803a8a:	89 e5                	mov    %esp,%ebp
+  803a8c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a8f:	ff 75 10             	push   0x10(%ebp)
+  803a92:	ff 75 0c             	push   0xc(%ebp)
+  803a95:	ff 75 08             	push   0x8(%ebp)
+  803a98:	e8 8a ff ff ff       	call   803a27 <memmove>
+}
+  803a9d:	c9                   	leave
+  803a9e:	c3                   	ret
+
+00803a9f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a9f:	55                   	push   %ebp
+  803aa0:	89 e5                	mov    %esp,%ebp
+  803aa2:	56                   	push   %esi
+  803aa3:	53                   	push   %ebx
+  803aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803aaa:	89 c6                	mov    %eax,%esi
+  803aac:	03 75 10             	add    0x10(%ebp),%esi
+  803aaf:	eb 06                	jmp    803ab7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803ab1:	83 c0 01             	add    $0x1,%eax
+  803ab4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803ab7:	39 f0                	cmp    %esi,%eax
+  803ab9:	74 14                	je     803acf <memcmp+0x30>
+		if (*s1 != *s2)
+  803abb:	0f b6 08             	movzbl (%eax),%ecx
+  803abe:	0f b6 1a             	movzbl (%edx),%ebx
+  803ac1:	38 d9                	cmp    %bl,%cl
+  803ac3:	74 ec                	je     803ab1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803ac5:	0f b6 c1             	movzbl %cl,%eax
+  803ac8:	0f b6 db             	movzbl %bl,%ebx
+  803acb:	29 d8                	sub    %ebx,%eax
+  803acd:	eb 05                	jmp    803ad4 <memcmp+0x35>
+	}
+
+	return 0;
+  803acf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad4:	5b                   	pop    %ebx
+  803ad5:	5e                   	pop    %esi
+  803ad6:	5d                   	pop    %ebp
+  803ad7:	c3                   	ret
+
+00803ad8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803ad8:	55                   	push   %ebp
+  803ad9:	89 e5                	mov    %esp,%ebp
+  803adb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ade:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ae1:	89 c2                	mov    %eax,%edx
+  803ae3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803ae6:	eb 03                	jmp    803aeb <memfind+0x13>
+  803ae8:	83 c0 01             	add    $0x1,%eax
+  803aeb:	39 d0                	cmp    %edx,%eax
+  803aed:	73 04                	jae    803af3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803aef:	38 08                	cmp    %cl,(%eax)
+  803af1:	75 f5                	jne    803ae8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803af3:	5d                   	pop    %ebp
+  803af4:	c3                   	ret
+
+00803af5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803af5:	55                   	push   %ebp
+  803af6:	89 e5                	mov    %esp,%ebp
+  803af8:	57                   	push   %edi
+  803af9:	56                   	push   %esi
+  803afa:	53                   	push   %ebx
+  803afb:	8b 55 08             	mov    0x8(%ebp),%edx
+  803afe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803b01:	eb 03                	jmp    803b06 <strtol+0x11>
+		s++;
+  803b03:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803b06:	0f b6 02             	movzbl (%edx),%eax
+  803b09:	3c 20                	cmp    $0x20,%al
+  803b0b:	74 f6                	je     803b03 <strtol+0xe>
+  803b0d:	3c 09                	cmp    $0x9,%al
+  803b0f:	74 f2                	je     803b03 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803b11:	3c 2b                	cmp    $0x2b,%al
+  803b13:	74 2a                	je     803b3f <strtol+0x4a>
+	int neg = 0;
+  803b15:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803b1a:	3c 2d                	cmp    $0x2d,%al
+  803b1c:	74 2b                	je     803b49 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b1e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803b24:	75 0f                	jne    803b35 <strtol+0x40>
+  803b26:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b29:	74 28                	je     803b53 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b2b:	85 db                	test   %ebx,%ebx
+  803b2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b32:	0f 44 d8             	cmove  %eax,%ebx
+  803b35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b3a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b3d:	eb 46                	jmp    803b85 <strtol+0x90>
+		s++;
+  803b3f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b42:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b47:	eb d5                	jmp    803b1e <strtol+0x29>
+		s++, neg = 1;
+  803b49:	83 c2 01             	add    $0x1,%edx
+  803b4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b51:	eb cb                	jmp    803b1e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b53:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b57:	74 0e                	je     803b67 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b59:	85 db                	test   %ebx,%ebx
+  803b5b:	75 d8                	jne    803b35 <strtol+0x40>
+		s++, base = 8;
+  803b5d:	83 c2 01             	add    $0x1,%edx
+  803b60:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b65:	eb ce                	jmp    803b35 <strtol+0x40>
+		s += 2, base = 16;
+  803b67:	83 c2 02             	add    $0x2,%edx
+  803b6a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b6f:	eb c4                	jmp    803b35 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b71:	0f be c0             	movsbl %al,%eax
+  803b74:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b77:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b7a:	7d 3a                	jge    803bb6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b7c:	83 c2 01             	add    $0x1,%edx
+  803b7f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b83:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b85:	0f b6 02             	movzbl (%edx),%eax
+  803b88:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b8b:	89 f3                	mov    %esi,%ebx
+  803b8d:	80 fb 09             	cmp    $0x9,%bl
+  803b90:	76 df                	jbe    803b71 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b92:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b95:	89 f3                	mov    %esi,%ebx
+  803b97:	80 fb 19             	cmp    $0x19,%bl
+  803b9a:	77 08                	ja     803ba4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b9c:	0f be c0             	movsbl %al,%eax
+  803b9f:	83 e8 57             	sub    $0x57,%eax
+  803ba2:	eb d3                	jmp    803b77 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803ba4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803ba7:	89 f3                	mov    %esi,%ebx
+  803ba9:	80 fb 19             	cmp    $0x19,%bl
+  803bac:	77 08                	ja     803bb6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803bae:	0f be c0             	movsbl %al,%eax
+  803bb1:	83 e8 37             	sub    $0x37,%eax
+  803bb4:	eb c1                	jmp    803b77 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803bb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803bba:	74 05                	je     803bc1 <strtol+0xcc>
+		*endptr = (char *) s;
+  803bbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bbf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803bc1:	89 c8                	mov    %ecx,%eax
+  803bc3:	f7 d8                	neg    %eax
+  803bc5:	85 ff                	test   %edi,%edi
+  803bc7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803bca:	89 c8                	mov    %ecx,%eax
+  803bcc:	5b                   	pop    %ebx
+  803bcd:	5e                   	pop    %esi
+  803bce:	5f                   	pop    %edi
+  803bcf:	5d                   	pop    %ebp
+  803bd0:	c3                   	ret
+
+00803bd1 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803bd1:	55                   	push   %ebp
+  803bd2:	89 e5                	mov    %esp,%ebp
+  803bd4:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bd7:	6a 00                	push   $0x0
+  803bd9:	6a 00                	push   $0x0
+  803bdb:	ff 75 08             	push   0x8(%ebp)
+  803bde:	e8 12 ff ff ff       	call   803af5 <strtol>
+}
+  803be3:	c9                   	leave
+  803be4:	c3                   	ret
+
+00803be5 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803be5:	55                   	push   %ebp
+  803be6:	89 e5                	mov    %esp,%ebp
+  803be8:	57                   	push   %edi
+  803be9:	56                   	push   %esi
+  803bea:	53                   	push   %ebx
+  803beb:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bee:	89 d6                	mov    %edx,%esi
+  803bf0:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bf3:	89 cf                	mov    %ecx,%edi
+  803bf5:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bf8:	89 fa                	mov    %edi,%edx
+  803bfa:	80 ce 08             	or     $0x8,%dh
+  803bfd:	f6 c5 08             	test   $0x8,%ch
+  803c00:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c03:	57                   	push   %edi
+  803c04:	56                   	push   %esi
+  803c05:	50                   	push   %eax
+  803c06:	56                   	push   %esi
+  803c07:	6a 00                	push   $0x0
+  803c09:	e8 41 c6 ff ff       	call   80024f <sys_page_map>
+	if (r < 0) {
+  803c0e:	83 c4 20             	add    $0x20,%esp
+  803c11:	85 c0                	test   %eax,%eax
+  803c13:	78 27                	js     803c3c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c15:	83 ec 0c             	sub    $0xc,%esp
+  803c18:	57                   	push   %edi
+  803c19:	56                   	push   %esi
+  803c1a:	6a 00                	push   $0x0
+  803c1c:	56                   	push   %esi
+  803c1d:	6a 00                	push   $0x0
+  803c1f:	e8 2b c6 ff ff       	call   80024f <sys_page_map>
+  803c24:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c26:	83 c4 20             	add    $0x20,%esp
+  803c29:	85 c0                	test   %eax,%eax
+  803c2b:	78 24                	js     803c51 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c32:	89 d8                	mov    %ebx,%eax
+  803c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c37:	5b                   	pop    %ebx
+  803c38:	5e                   	pop    %esi
+  803c39:	5f                   	pop    %edi
+  803c3a:	5d                   	pop    %ebp
+  803c3b:	c3                   	ret
+  803c3c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c3e:	83 ec 08             	sub    $0x8,%esp
+  803c41:	50                   	push   %eax
+  803c42:	68 b8 4c 80 00       	push   $0x804cb8
+  803c47:	e8 71 f6 ff ff       	call   8032bd <cprintf>
+		return r;
+  803c4c:	83 c4 10             	add    $0x10,%esp
+  803c4f:	eb e1                	jmp    803c32 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c51:	83 ec 08             	sub    $0x8,%esp
+  803c54:	50                   	push   %eax
+  803c55:	68 e8 4c 80 00       	push   $0x804ce8
+  803c5a:	e8 5e f6 ff ff       	call   8032bd <cprintf>
+		return r;
+  803c5f:	83 c4 10             	add    $0x10,%esp
+  803c62:	eb ce                	jmp    803c32 <duppage_cow+0x4d>
+
+00803c64 <duppage>:
+{
+  803c64:	55                   	push   %ebp
+  803c65:	89 e5                	mov    %esp,%ebp
+  803c67:	53                   	push   %ebx
+  803c68:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c6b:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c6e:	51                   	push   %ecx
+  803c6f:	52                   	push   %edx
+  803c70:	50                   	push   %eax
+  803c71:	52                   	push   %edx
+  803c72:	6a 00                	push   $0x0
+  803c74:	e8 d6 c5 ff ff       	call   80024f <sys_page_map>
+	if (r < 0) {
+  803c79:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c81:	85 c0                	test   %eax,%eax
+  803c83:	78 07                	js     803c8c <duppage+0x28>
+}
+  803c85:	89 d8                	mov    %ebx,%eax
+  803c87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c8a:	c9                   	leave
+  803c8b:	c3                   	ret
+  803c8c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c8e:	83 ec 08             	sub    $0x8,%esp
+  803c91:	50                   	push   %eax
+  803c92:	68 b8 4c 80 00       	push   $0x804cb8
+  803c97:	e8 21 f6 ff ff       	call   8032bd <cprintf>
+		return r;
+  803c9c:	83 c4 10             	add    $0x10,%esp
+  803c9f:	eb e4                	jmp    803c85 <duppage+0x21>
+
+00803ca1 <cow_copy>:
+{
+  803ca1:	55                   	push   %ebp
+  803ca2:	89 e5                	mov    %esp,%ebp
+  803ca4:	56                   	push   %esi
+  803ca5:	53                   	push   %ebx
+  803ca6:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803ca8:	83 ec 04             	sub    $0x4,%esp
+  803cab:	6a 07                	push   $0x7
+  803cad:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 49 c5 ff ff       	call   800202 <sys_page_alloc>
+	if (r < 0) {
+  803cb9:	83 c4 10             	add    $0x10,%esp
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	78 58                	js     803d18 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803cc0:	83 ec 04             	sub    $0x4,%esp
+  803cc3:	68 00 10 00 00       	push   $0x1000
+  803cc8:	56                   	push   %esi
+  803cc9:	68 00 f0 7f 00       	push   $0x7ff000
+  803cce:	e8 54 fd ff ff       	call   803a27 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cd3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cda:	56                   	push   %esi
+  803cdb:	6a 00                	push   $0x0
+  803cdd:	68 00 f0 7f 00       	push   $0x7ff000
+  803ce2:	6a 00                	push   $0x0
+  803ce4:	e8 66 c5 ff ff       	call   80024f <sys_page_map>
+  803ce9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ceb:	83 c4 20             	add    $0x20,%esp
+  803cee:	85 c0                	test   %eax,%eax
+  803cf0:	78 3b                	js     803d2d <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cf2:	83 ec 08             	sub    $0x8,%esp
+  803cf5:	68 00 f0 7f 00       	push   $0x7ff000
+  803cfa:	6a 00                	push   $0x0
+  803cfc:	e8 9a c5 ff ff       	call   80029b <sys_page_unmap>
+  803d01:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d03:	83 c4 10             	add    $0x10,%esp
+  803d06:	85 c0                	test   %eax,%eax
+  803d08:	78 45                	js     803d4f <cow_copy+0xae>
+	return 0;
+  803d0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d0f:	89 d8                	mov    %ebx,%eax
+  803d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d14:	5b                   	pop    %ebx
+  803d15:	5e                   	pop    %esi
+  803d16:	5d                   	pop    %ebp
+  803d17:	c3                   	ret
+  803d18:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d1a:	83 ec 08             	sub    $0x8,%esp
+  803d1d:	50                   	push   %eax
+  803d1e:	68 d8 4d 80 00       	push   $0x804dd8
+  803d23:	e8 95 f5 ff ff       	call   8032bd <cprintf>
+		return r;
+  803d28:	83 c4 10             	add    $0x10,%esp
+  803d2b:	eb e2                	jmp    803d0f <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d2d:	83 ec 08             	sub    $0x8,%esp
+  803d30:	50                   	push   %eax
+  803d31:	68 f4 4d 80 00       	push   $0x804df4
+  803d36:	e8 82 f5 ff ff       	call   8032bd <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d3b:	83 c4 08             	add    $0x8,%esp
+  803d3e:	68 00 f0 7f 00       	push   $0x7ff000
+  803d43:	6a 00                	push   $0x0
+  803d45:	e8 51 c5 ff ff       	call   80029b <sys_page_unmap>
+		return r;
+  803d4a:	83 c4 10             	add    $0x10,%esp
+  803d4d:	eb c0                	jmp    803d0f <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d4f:	83 ec 08             	sub    $0x8,%esp
+  803d52:	50                   	push   %eax
+  803d53:	68 10 4d 80 00       	push   $0x804d10
+  803d58:	e8 60 f5 ff ff       	call   8032bd <cprintf>
+		return r;
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	eb ad                	jmp    803d0f <cow_copy+0x6e>
+
+00803d62 <pgfault>:
+{
+  803d62:	55                   	push   %ebp
+  803d63:	89 e5                	mov    %esp,%ebp
+  803d65:	56                   	push   %esi
+  803d66:	53                   	push   %ebx
+  803d67:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d6a:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d6c:	89 d8                	mov    %ebx,%eax
+  803d6e:	c1 e8 16             	shr    $0x16,%eax
+  803d71:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d78:	89 de                	mov    %ebx,%esi
+  803d7a:	c1 ee 0c             	shr    $0xc,%esi
+  803d7d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d84:	a8 07                	test   $0x7,%al
+  803d86:	74 3b                	je     803dc3 <pgfault+0x61>
+  803d88:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d8e:	74 33                	je     803dc3 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d90:	83 ec 0c             	sub    $0xc,%esp
+  803d93:	68 00 f0 bf ee       	push   $0xeebff000
+  803d98:	e8 c5 ea ff ff       	call   802862 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d9d:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803da4:	83 c4 10             	add    $0x10,%esp
+  803da7:	f6 c4 08             	test   $0x8,%ah
+  803daa:	75 30                	jne    803ddc <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803dac:	83 ec 0c             	sub    $0xc,%esp
+  803daf:	68 00 f0 bf ee       	push   $0xeebff000
+  803db4:	e8 16 eb ff ff       	call   8028cf <mutex_unlock>
+}
+  803db9:	83 c4 10             	add    $0x10,%esp
+  803dbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dbf:	5b                   	pop    %ebx
+  803dc0:	5e                   	pop    %esi
+  803dc1:	5d                   	pop    %ebp
+  803dc2:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803dc3:	83 ec 08             	sub    $0x8,%esp
+  803dc6:	ff 72 28             	push   0x28(%edx)
+  803dc9:	51                   	push   %ecx
+  803dca:	50                   	push   %eax
+  803dcb:	68 34 4d 80 00       	push   $0x804d34
+  803dd0:	6a 3f                	push   $0x3f
+  803dd2:	68 0e 4e 80 00       	push   $0x804e0e
+  803dd7:	e8 06 f4 ff ff       	call   8031e2 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803ddc:	89 d8                	mov    %ebx,%eax
+  803dde:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803de3:	e8 b9 fe ff ff       	call   803ca1 <cow_copy>
+  803de8:	eb c2                	jmp    803dac <pgfault+0x4a>
+
+00803dea <cow_enable>:
+{
+  803dea:	55                   	push   %ebp
+  803deb:	89 e5                	mov    %esp,%ebp
+  803ded:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803df0:	68 62 3d 80 00       	push   $0x803d62
+  803df5:	e8 28 06 00 00       	call   804422 <set_pgfault_handler>
+}
+  803dfa:	83 c4 10             	add    $0x10,%esp
+  803dfd:	c9                   	leave
+  803dfe:	c3                   	ret
+
+00803dff <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dff:	55                   	push   %ebp
+  803e00:	89 e5                	mov    %esp,%ebp
+  803e02:	57                   	push   %edi
+  803e03:	56                   	push   %esi
+  803e04:	53                   	push   %ebx
+  803e05:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e08:	68 62 3d 80 00       	push   $0x803d62
+  803e0d:	e8 10 06 00 00       	call   804422 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e12:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e17:	cd 30                	int    $0x30
+  803e19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e1c:	83 c4 10             	add    $0x10,%esp
+  803e1f:	85 c0                	test   %eax,%eax
+  803e21:	78 4b                	js     803e6e <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e23:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e2d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e30:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e34:	0f 85 16 01 00 00    	jne    803f50 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e3a:	e8 6b c3 ff ff       	call   8001aa <sys_getenvid>
+  803e3f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e44:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e46:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e4c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e52:	77 32                	ja     803e86 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e54:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e59:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e5b:	c1 ea 10             	shr    $0x10,%edx
+  803e5e:	74 26                	je     803e86 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e60:	c1 e2 10             	shl    $0x10,%edx
+  803e63:	89 d1                	mov    %edx,%ecx
+  803e65:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e6a:	29 ca                	sub    %ecx,%edx
+  803e6c:	eb 1e                	jmp    803e8c <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e6e:	83 ec 08             	sub    $0x8,%esp
+  803e71:	89 c7                	mov    %eax,%edi
+  803e73:	50                   	push   %eax
+  803e74:	68 19 4e 80 00       	push   $0x804e19
+  803e79:	e8 3f f4 ff ff       	call   8032bd <cprintf>
+		return eid;
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  803e81:	e9 6c 01 00 00       	jmp    803ff2 <fork+0x1f3>
+		return pthread_main_tls;
+  803e86:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e8c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e8f:	c1 e0 04             	shl    $0x4,%eax
+  803e92:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e97:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e99:	e8 0d f1 ff ff       	call   802fab <pthread_fork_child>
+		return eid;
+  803e9e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803ea1:	e9 4c 01 00 00       	jmp    803ff2 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ea6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eac:	89 da                	mov    %ebx,%edx
+  803eae:	89 f8                	mov    %edi,%eax
+  803eb0:	e8 af fd ff ff       	call   803c64 <duppage>
+  803eb5:	85 c0                	test   %eax,%eax
+  803eb7:	79 28                	jns    803ee1 <fork+0xe2>
+  803eb9:	89 c7                	mov    %eax,%edi
+  803ebb:	e9 32 01 00 00       	jmp    803ff2 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ec0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803ec6:	83 f9 05             	cmp    $0x5,%ecx
+  803ec9:	75 58                	jne    803f23 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ecb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ed0:	89 da                	mov    %ebx,%edx
+  803ed2:	89 f8                	mov    %edi,%eax
+  803ed4:	e8 8b fd ff ff       	call   803c64 <duppage>
+  803ed9:	85 c0                	test   %eax,%eax
+  803edb:	0f 88 0f 01 00 00    	js     803ff0 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803ee1:	83 c3 01             	add    $0x1,%ebx
+  803ee4:	39 de                	cmp    %ebx,%esi
+  803ee6:	74 54                	je     803f3c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ee8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803eef:	f6 c1 05             	test   $0x5,%cl
+  803ef2:	74 ed                	je     803ee1 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ef4:	f6 c5 04             	test   $0x4,%ch
+  803ef7:	75 ad                	jne    803ea6 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ef9:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803eff:	74 bf                	je     803ec0 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f01:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f07:	74 d8                	je     803ee1 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f09:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f0f:	89 da                	mov    %ebx,%edx
+  803f11:	89 f8                	mov    %edi,%eax
+  803f13:	e8 cd fc ff ff       	call   803be5 <duppage_cow>
+  803f18:	85 c0                	test   %eax,%eax
+  803f1a:	79 c5                	jns    803ee1 <fork+0xe2>
+  803f1c:	89 c7                	mov    %eax,%edi
+  803f1e:	e9 cf 00 00 00       	jmp    803ff2 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f23:	68 64 4d 80 00       	push   $0x804d64
+  803f28:	68 d5 47 80 00       	push   $0x8047d5
+  803f2d:	68 c6 00 00 00       	push   $0xc6
+  803f32:	68 0e 4e 80 00       	push   $0x804e0e
+  803f37:	e8 a6 f2 ff ff       	call   8031e2 <_panic>
+  803f3c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f3f:	83 c1 01             	add    $0x1,%ecx
+  803f42:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f48:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f4e:	74 18                	je     803f68 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f50:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f57:	a8 07                	test   $0x7,%al
+  803f59:	74 e4                	je     803f3f <fork+0x140>
+  803f5b:	89 cb                	mov    %ecx,%ebx
+  803f5d:	c1 e3 0a             	shl    $0xa,%ebx
+  803f60:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f63:	e9 7c ff ff ff       	jmp    803ee4 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f68:	83 ec 04             	sub    $0x4,%esp
+  803f6b:	6a 07                	push   $0x7
+  803f6d:	68 00 f0 bf ee       	push   $0xeebff000
+  803f72:	ff 75 e4             	push   -0x1c(%ebp)
+  803f75:	e8 88 c2 ff ff       	call   800202 <sys_page_alloc>
+  803f7a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7c:	83 c4 10             	add    $0x10,%esp
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	78 34                	js     803fb7 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f83:	83 ec 08             	sub    $0x8,%esp
+  803f86:	68 60 44 80 00       	push   $0x804460
+  803f8b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f8e:	e8 ec c3 ff ff       	call   80037f <sys_env_set_pgfault_upcall>
+  803f93:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f95:	83 c4 10             	add    $0x10,%esp
+  803f98:	85 c0                	test   %eax,%eax
+  803f9a:	78 2e                	js     803fca <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f9c:	83 ec 08             	sub    $0x8,%esp
+  803f9f:	6a 02                	push   $0x2
+  803fa1:	ff 75 e4             	push   -0x1c(%ebp)
+  803fa4:	e8 3e c3 ff ff       	call   8002e7 <sys_env_set_status>
+  803fa9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fab:	83 c4 10             	add    $0x10,%esp
+  803fae:	85 c0                	test   %eax,%eax
+  803fb0:	78 2b                	js     803fdd <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803fb2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fb5:	eb 3b                	jmp    803ff2 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fb7:	83 ec 08             	sub    $0x8,%esp
+  803fba:	50                   	push   %eax
+  803fbb:	68 8c 4d 80 00       	push   $0x804d8c
+  803fc0:	e8 f8 f2 ff ff       	call   8032bd <cprintf>
+		return r;
+  803fc5:	83 c4 10             	add    $0x10,%esp
+  803fc8:	eb 28                	jmp    803ff2 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fca:	83 ec 08             	sub    $0x8,%esp
+  803fcd:	50                   	push   %eax
+  803fce:	68 b4 4d 80 00       	push   $0x804db4
+  803fd3:	e8 e5 f2 ff ff       	call   8032bd <cprintf>
+		return r;
+  803fd8:	83 c4 10             	add    $0x10,%esp
+  803fdb:	eb 15                	jmp    803ff2 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fdd:	83 ec 08             	sub    $0x8,%esp
+  803fe0:	50                   	push   %eax
+  803fe1:	68 29 4e 80 00       	push   $0x804e29
+  803fe6:	e8 d2 f2 ff ff       	call   8032bd <cprintf>
+		return r;
+  803feb:	83 c4 10             	add    $0x10,%esp
+  803fee:	eb 02                	jmp    803ff2 <fork+0x1f3>
+  803ff0:	89 c7                	mov    %eax,%edi
+}
+  803ff2:	89 f8                	mov    %edi,%eax
+  803ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ff7:	5b                   	pop    %ebx
+  803ff8:	5e                   	pop    %esi
+  803ff9:	5f                   	pop    %edi
+  803ffa:	5d                   	pop    %ebp
+  803ffb:	c3                   	ret
+
+00803ffc <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803ffc:	55                   	push   %ebp
+  803ffd:	89 e5                	mov    %esp,%ebp
+  803fff:	57                   	push   %edi
+  804000:	56                   	push   %esi
+  804001:	53                   	push   %ebx
+  804002:	83 ec 2c             	sub    $0x2c,%esp
+  804005:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804007:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80400d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804012:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804018:	77 0a                	ja     804024 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80401a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80401f:	29 c3                	sub    %eax,%ebx
+  804021:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804024:	83 ec 0c             	sub    $0xc,%esp
+  804027:	68 62 3d 80 00       	push   $0x803d62
+  80402c:	e8 f1 03 00 00       	call   804422 <set_pgfault_handler>
+  804031:	b8 07 00 00 00       	mov    $0x7,%eax
+  804036:	cd 30                	int    $0x30
+  804038:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80403b:	83 c4 10             	add    $0x10,%esp
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	78 30                	js     804072 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804042:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804046:	74 42                	je     80408a <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804048:	c1 e3 10             	shl    $0x10,%ebx
+  80404b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804050:	29 d8                	sub    %ebx,%eax
+  804052:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804055:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80405a:	29 d8                	sub    %ebx,%eax
+  80405c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80405f:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804064:	ba 00 00 00 00       	mov    $0x0,%edx
+  804069:	89 f7                	mov    %esi,%edi
+  80406b:	89 d6                	mov    %edx,%esi
+  80406d:	e9 2c 01 00 00       	jmp    80419e <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804072:	83 ec 08             	sub    $0x8,%esp
+  804075:	89 c7                	mov    %eax,%edi
+  804077:	50                   	push   %eax
+  804078:	68 19 4e 80 00       	push   $0x804e19
+  80407d:	e8 3b f2 ff ff       	call   8032bd <cprintf>
+		return eid;
+  804082:	83 c4 10             	add    $0x10,%esp
+  804085:	e9 d5 00 00 00       	jmp    80415f <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80408a:	e8 1b c1 ff ff       	call   8001aa <sys_getenvid>
+  80408f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804094:	89 c2                	mov    %eax,%edx
+  804096:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804098:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80409e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040a3:	77 18                	ja     8040bd <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040a5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040aa:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040ac:	c1 e8 10             	shr    $0x10,%eax
+  8040af:	74 0c                	je     8040bd <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040b1:	c1 e0 10             	shl    $0x10,%eax
+  8040b4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040b9:	29 c1                	sub    %eax,%ecx
+  8040bb:	eb 06                	jmp    8040c3 <sfork+0xc7>
+		return pthread_main_tls;
+  8040bd:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040c3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040c6:	c1 e0 04             	shl    $0x4,%eax
+  8040c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040ce:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040d0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040d3:	e9 87 00 00 00       	jmp    80415f <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040d8:	f6 c5 04             	test   $0x4,%ch
+  8040db:	74 6c                	je     804149 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040dd:	89 ca                	mov    %ecx,%edx
+  8040df:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040e5:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040eb:	74 7c                	je     804169 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040ed:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040f3:	89 da                	mov    %ebx,%edx
+  8040f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040f8:	e8 67 fb ff ff       	call   803c64 <duppage>
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	0f 88 4f 01 00 00    	js     804254 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804105:	83 c3 01             	add    $0x1,%ebx
+  804108:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80410b:	74 7a                	je     804187 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80410d:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80410f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804116:	f6 c1 01             	test   $0x1,%cl
+  804119:	74 ea                	je     804105 <sfork+0x109>
+  80411b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804121:	74 e2                	je     804105 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804123:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804129:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80412c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804131:	76 a5                	jbe    8040d8 <sfork+0xdc>
+  804133:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804139:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80413c:	39 fa                	cmp    %edi,%edx
+  80413e:	73 9d                	jae    8040dd <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804140:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804143:	39 fa                	cmp    %edi,%edx
+  804145:	72 96                	jb     8040dd <sfork+0xe1>
+  804147:	eb 8f                	jmp    8040d8 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804149:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80414f:	89 da                	mov    %ebx,%edx
+  804151:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804154:	e8 8c fa ff ff       	call   803be5 <duppage_cow>
+  804159:	85 c0                	test   %eax,%eax
+  80415b:	79 a8                	jns    804105 <sfork+0x109>
+  80415d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80415f:	89 f8                	mov    %edi,%eax
+  804161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804164:	5b                   	pop    %ebx
+  804165:	5e                   	pop    %esi
+  804166:	5f                   	pop    %edi
+  804167:	5d                   	pop    %ebp
+  804168:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804169:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80416e:	e8 2e fb ff ff       	call   803ca1 <cow_copy>
+  804173:	85 c0                	test   %eax,%eax
+  804175:	0f 88 d2 00 00 00    	js     80424d <sfork+0x251>
+				pte = uvpt[pn];
+  80417b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804182:	e9 66 ff ff ff       	jmp    8040ed <sfork+0xf1>
+  804187:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80418a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80418d:	83 c6 01             	add    $0x1,%esi
+  804190:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804196:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80419c:	74 1b                	je     8041b9 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80419e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8041a5:	a8 01                	test   $0x1,%al
+  8041a7:	74 e4                	je     80418d <sfork+0x191>
+  8041a9:	89 f3                	mov    %esi,%ebx
+  8041ab:	c1 e3 0a             	shl    $0xa,%ebx
+  8041ae:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8041b1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8041b4:	e9 4f ff ff ff       	jmp    804108 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041b9:	83 ec 04             	sub    $0x4,%esp
+  8041bc:	6a 07                	push   $0x7
+  8041be:	68 00 f0 bf ee       	push   $0xeebff000
+  8041c3:	ff 75 e0             	push   -0x20(%ebp)
+  8041c6:	e8 37 c0 ff ff       	call   800202 <sys_page_alloc>
+  8041cb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cd:	83 c4 10             	add    $0x10,%esp
+  8041d0:	85 c0                	test   %eax,%eax
+  8041d2:	78 37                	js     80420b <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041d4:	83 ec 08             	sub    $0x8,%esp
+  8041d7:	68 60 44 80 00       	push   $0x804460
+  8041dc:	ff 75 e0             	push   -0x20(%ebp)
+  8041df:	e8 9b c1 ff ff       	call   80037f <sys_env_set_pgfault_upcall>
+  8041e4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041e6:	83 c4 10             	add    $0x10,%esp
+  8041e9:	85 c0                	test   %eax,%eax
+  8041eb:	78 34                	js     804221 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041ed:	83 ec 08             	sub    $0x8,%esp
+  8041f0:	6a 02                	push   $0x2
+  8041f2:	ff 75 e0             	push   -0x20(%ebp)
+  8041f5:	e8 ed c0 ff ff       	call   8002e7 <sys_env_set_status>
+  8041fa:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041fc:	83 c4 10             	add    $0x10,%esp
+  8041ff:	85 c0                	test   %eax,%eax
+  804201:	78 34                	js     804237 <sfork+0x23b>
+	return eid;
+  804203:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804206:	e9 54 ff ff ff       	jmp    80415f <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80420b:	83 ec 08             	sub    $0x8,%esp
+  80420e:	50                   	push   %eax
+  80420f:	68 8c 4d 80 00       	push   $0x804d8c
+  804214:	e8 a4 f0 ff ff       	call   8032bd <cprintf>
+		return r;
+  804219:	83 c4 10             	add    $0x10,%esp
+  80421c:	e9 3e ff ff ff       	jmp    80415f <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804221:	83 ec 08             	sub    $0x8,%esp
+  804224:	50                   	push   %eax
+  804225:	68 b4 4d 80 00       	push   $0x804db4
+  80422a:	e8 8e f0 ff ff       	call   8032bd <cprintf>
+		return r;
+  80422f:	83 c4 10             	add    $0x10,%esp
+  804232:	e9 28 ff ff ff       	jmp    80415f <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804237:	83 ec 08             	sub    $0x8,%esp
+  80423a:	50                   	push   %eax
+  80423b:	68 29 4e 80 00       	push   $0x804e29
+  804240:	e8 78 f0 ff ff       	call   8032bd <cprintf>
+		return r;
+  804245:	83 c4 10             	add    $0x10,%esp
+  804248:	e9 12 ff ff ff       	jmp    80415f <sfork+0x163>
+  80424d:	89 c7                	mov    %eax,%edi
+  80424f:	e9 0b ff ff ff       	jmp    80415f <sfork+0x163>
+  804254:	89 c7                	mov    %eax,%edi
+  804256:	e9 04 ff ff ff       	jmp    80415f <sfork+0x163>
+
+0080425b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80425b:	55                   	push   %ebp
+  80425c:	89 e5                	mov    %esp,%ebp
+  80425e:	57                   	push   %edi
+  80425f:	56                   	push   %esi
+  804260:	53                   	push   %ebx
+  804261:	83 ec 18             	sub    $0x18,%esp
+  804264:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804267:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80426a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80426d:	85 c0                	test   %eax,%eax
+  80426f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804274:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804277:	50                   	push   %eax
+  804278:	e8 7b c1 ff ff       	call   8003f8 <sys_ipc_recv>
+	if (r < 0) {
+  80427d:	83 c4 10             	add    $0x10,%esp
+  804280:	85 c0                	test   %eax,%eax
+  804282:	78 2b                	js     8042af <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804284:	85 ff                	test   %edi,%edi
+  804286:	74 55                	je     8042dd <ipc_recv+0x82>
+  804288:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80428a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804290:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804295:	77 39                	ja     8042d0 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804297:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80429c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80429e:	c1 e8 10             	shr    $0x10,%eax
+  8042a1:	74 2d                	je     8042d0 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042a3:	c1 e0 10             	shl    $0x10,%eax
+  8042a6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042ab:	29 c2                	sub    %eax,%edx
+  8042ad:	eb 27                	jmp    8042d6 <ipc_recv+0x7b>
+  8042af:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8042b1:	83 ec 08             	sub    $0x8,%esp
+  8042b4:	50                   	push   %eax
+  8042b5:	68 47 4e 80 00       	push   $0x804e47
+  8042ba:	e8 fe ef ff ff       	call   8032bd <cprintf>
+		*from_env_store = 0;
+  8042bf:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042c5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042cb:	83 c4 10             	add    $0x10,%esp
+  8042ce:	eb 77                	jmp    804347 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042d0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042d6:	8b 02                	mov    (%edx),%eax
+  8042d8:	8b 40 78             	mov    0x78(%eax),%eax
+  8042db:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042dd:	85 f6                	test   %esi,%esi
+  8042df:	74 34                	je     804315 <ipc_recv+0xba>
+  8042e1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042e3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042ee:	77 18                	ja     804308 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042f5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042f7:	c1 e8 10             	shr    $0x10,%eax
+  8042fa:	74 0c                	je     804308 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042fc:	c1 e0 10             	shl    $0x10,%eax
+  8042ff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804304:	29 c2                	sub    %eax,%edx
+  804306:	eb 06                	jmp    80430e <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804308:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80430e:	8b 02                	mov    (%edx),%eax
+  804310:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804313:	89 06                	mov    %eax,(%esi)
+  804315:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804317:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80431d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804322:	77 18                	ja     80433c <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804324:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804329:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80432b:	c1 e8 10             	shr    $0x10,%eax
+  80432e:	74 0c                	je     80433c <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804330:	c1 e0 10             	shl    $0x10,%eax
+  804333:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804338:	29 c2                	sub    %eax,%edx
+  80433a:	eb 06                	jmp    804342 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80433c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804342:	8b 02                	mov    (%edx),%eax
+  804344:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804347:	89 d8                	mov    %ebx,%eax
+  804349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80434c:	5b                   	pop    %ebx
+  80434d:	5e                   	pop    %esi
+  80434e:	5f                   	pop    %edi
+  80434f:	5d                   	pop    %ebp
+  804350:	c3                   	ret
+
+00804351 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804351:	55                   	push   %ebp
+  804352:	89 e5                	mov    %esp,%ebp
+  804354:	57                   	push   %edi
+  804355:	56                   	push   %esi
+  804356:	53                   	push   %ebx
+  804357:	83 ec 0c             	sub    $0xc,%esp
+  80435a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80435d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804360:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804363:	85 db                	test   %ebx,%ebx
+  804365:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80436a:	0f 44 d8             	cmove  %eax,%ebx
+  80436d:	eb 05                	jmp    804374 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80436f:	e8 62 be ff ff       	call   8001d6 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804374:	57                   	push   %edi
+  804375:	53                   	push   %ebx
+  804376:	ff 75 0c             	push   0xc(%ebp)
+  804379:	56                   	push   %esi
+  80437a:	e8 4c c0 ff ff       	call   8003cb <sys_ipc_try_send>
+		if (r == 0) {
+  80437f:	83 c4 10             	add    $0x10,%esp
+  804382:	85 c0                	test   %eax,%eax
+  804384:	74 19                	je     80439f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804386:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804389:	74 e4                	je     80436f <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80438b:	83 ec 0c             	sub    $0xc,%esp
+  80438e:	50                   	push   %eax
+  80438f:	57                   	push   %edi
+  804390:	53                   	push   %ebx
+  804391:	56                   	push   %esi
+  804392:	68 60 4e 80 00       	push   $0x804e60
+  804397:	e8 21 ef ff ff       	call   8032bd <cprintf>
+			return;
+  80439c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80439f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043a2:	5b                   	pop    %ebx
+  8043a3:	5e                   	pop    %esi
+  8043a4:	5f                   	pop    %edi
+  8043a5:	5d                   	pop    %ebp
+  8043a6:	c3                   	ret
+
+008043a7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8043a7:	55                   	push   %ebp
+  8043a8:	89 e5                	mov    %esp,%ebp
+  8043aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8043ad:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8043b2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043b5:	c1 e0 04             	shl    $0x4,%eax
+  8043b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043bd:	8b 40 50             	mov    0x50(%eax),%eax
+  8043c0:	39 c8                	cmp    %ecx,%eax
+  8043c2:	74 12                	je     8043d6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043c4:	83 c2 01             	add    $0x1,%edx
+  8043c7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043cd:	75 e3                	jne    8043b2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d4:	eb 0e                	jmp    8043e4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043d6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043d9:	c1 e0 04             	shl    $0x4,%eax
+  8043dc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043e1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043e4:	5d                   	pop    %ebp
+  8043e5:	c3                   	ret
+
+008043e6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043e6:	55                   	push   %ebp
+  8043e7:	89 e5                	mov    %esp,%ebp
+  8043e9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043ec:	89 c2                	mov    %eax,%edx
+  8043ee:	c1 ea 16             	shr    $0x16,%edx
+  8043f1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043f8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043fd:	f6 c1 01             	test   $0x1,%cl
+  804400:	74 1c                	je     80441e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804402:	c1 e8 0c             	shr    $0xc,%eax
+  804405:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80440c:	a8 01                	test   $0x1,%al
+  80440e:	74 0e                	je     80441e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804410:	c1 e8 0c             	shr    $0xc,%eax
+  804413:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80441a:	ef 
+  80441b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80441e:	89 d0                	mov    %edx,%eax
+  804420:	5d                   	pop    %ebp
+  804421:	c3                   	ret
+
+00804422 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804422:	55                   	push   %ebp
+  804423:	89 e5                	mov    %esp,%ebp
+  804425:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804428:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80442f:	74 0a                	je     80443b <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804431:	8b 45 08             	mov    0x8(%ebp),%eax
+  804434:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804439:	c9                   	leave
+  80443a:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80443b:	83 ec 04             	sub    $0x4,%esp
+  80443e:	6a 07                	push   $0x7
+  804440:	68 00 f0 bf ee       	push   $0xeebff000
+  804445:	6a 00                	push   $0x0
+  804447:	e8 b6 bd ff ff       	call   800202 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80444c:	83 c4 08             	add    $0x8,%esp
+  80444f:	68 60 44 80 00       	push   $0x804460
+  804454:	6a 00                	push   $0x0
+  804456:	e8 24 bf ff ff       	call   80037f <sys_env_set_pgfault_upcall>
+  80445b:	83 c4 10             	add    $0x10,%esp
+  80445e:	eb d1                	jmp    804431 <set_pgfault_handler+0xf>
+
+00804460 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804460:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804461:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804466:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804468:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80446b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80446f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804473:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804476:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80447a:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80447c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80447f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804480:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804483:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804484:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804485:	c3                   	ret
+
+00804486 <udm>:
+  804486:	57                   	push   %edi
+  804487:	56                   	push   %esi
+  804488:	53                   	push   %ebx
+  804489:	83 ec 20             	sub    $0x20,%esp
+  80448c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804490:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804494:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804498:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80449c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044a0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044a4:	89 d1                	mov    %edx,%ecx
+  8044a6:	09 c1                	or     %eax,%ecx
+  8044a8:	0f 84 91 00 00 00    	je     80453f <udm+0xb9>
+  8044ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044bd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044c4:	00 
+  8044c5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044cc:	00 
+  8044cd:	eb 08                	jmp    8044d7 <udm+0x51>
+  8044cf:	83 e9 01             	sub    $0x1,%ecx
+  8044d2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044d5:	74 7c                	je     804553 <udm+0xcd>
+  8044d7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044db:	01 c0                	add    %eax,%eax
+  8044dd:	89 c6                	mov    %eax,%esi
+  8044df:	89 d7                	mov    %edx,%edi
+  8044e1:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044e5:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044e9:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044ec:	d3 ea                	shr    %cl,%edx
+  8044ee:	f6 c1 20             	test   $0x20,%cl
+  8044f1:	74 04                	je     8044f7 <udm+0x71>
+  8044f3:	89 d0                	mov    %edx,%eax
+  8044f5:	31 d2                	xor    %edx,%edx
+  8044f7:	83 e0 01             	and    $0x1,%eax
+  8044fa:	89 04 24             	mov    %eax,(%esp)
+  8044fd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804504:	00 
+  804505:	8b 04 24             	mov    (%esp),%eax
+  804508:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80450c:	09 f0                	or     %esi,%eax
+  80450e:	09 fa                	or     %edi,%edx
+  804510:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804514:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804518:	39 f0                	cmp    %esi,%eax
+  80451a:	89 d3                	mov    %edx,%ebx
+  80451c:	19 fb                	sbb    %edi,%ebx
+  80451e:	72 af                	jb     8044cf <udm+0x49>
+  804520:	29 f0                	sub    %esi,%eax
+  804522:	19 fa                	sbb    %edi,%edx
+  804524:	89 cf                	mov    %ecx,%edi
+  804526:	c1 ef 05             	shr    $0x5,%edi
+  804529:	83 e7 01             	and    $0x1,%edi
+  80452c:	89 fe                	mov    %edi,%esi
+  80452e:	83 f6 01             	xor    $0x1,%esi
+  804531:	d3 e6                	shl    %cl,%esi
+  804533:	d3 e7                	shl    %cl,%edi
+  804535:	09 74 24 18          	or     %esi,0x18(%esp)
+  804539:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80453d:	eb 90                	jmp    8044cf <udm+0x49>
+  80453f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804543:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804547:	89 f0                	mov    %esi,%eax
+  804549:	89 fa                	mov    %edi,%edx
+  80454b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80454f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804553:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804557:	89 01                	mov    %eax,(%ecx)
+  804559:	89 51 04             	mov    %edx,0x4(%ecx)
+  80455c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804560:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804564:	83 c4 20             	add    $0x20,%esp
+  804567:	5b                   	pop    %ebx
+  804568:	5e                   	pop    %esi
+  804569:	5f                   	pop    %edi
+  80456a:	c3                   	ret
+
+0080456b <__udivdi3>:
+  80456b:	83 ec 18             	sub    $0x18,%esp
+  80456e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804572:	50                   	push   %eax
+  804573:	ff 74 24 2c          	push   0x2c(%esp)
+  804577:	ff 74 24 2c          	push   0x2c(%esp)
+  80457b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80457f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804583:	e8 fe fe ff ff       	call   804486 <udm>
+  804588:	83 c4 24             	add    $0x24,%esp
+  80458b:	c3                   	ret
+
+0080458c <__umoddi3>:
+  80458c:	83 ec 18             	sub    $0x18,%esp
+  80458f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804593:	50                   	push   %eax
+  804594:	ff 74 24 2c          	push   0x2c(%esp)
+  804598:	ff 74 24 2c          	push   0x2c(%esp)
+  80459c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045a0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045a4:	e8 dd fe ff ff       	call   804486 <udm>
+  8045a9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045ad:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045b1:	83 c4 24             	add    $0x24,%esp
+  8045b4:	c3                   	ret
+
+008045b5 <__divdi3>:
+  8045b5:	56                   	push   %esi
+  8045b6:	53                   	push   %ebx
+  8045b7:	83 ec 14             	sub    $0x14,%esp
+  8045ba:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045be:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045c2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045c6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045ca:	85 d2                	test   %edx,%edx
+  8045cc:	78 18                	js     8045e6 <__divdi3+0x31>
+  8045ce:	85 db                	test   %ebx,%ebx
+  8045d0:	78 3e                	js     804610 <__divdi3+0x5b>
+  8045d2:	83 ec 04             	sub    $0x4,%esp
+  8045d5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045d9:	56                   	push   %esi
+  8045da:	53                   	push   %ebx
+  8045db:	51                   	push   %ecx
+  8045dc:	e8 a5 fe ff ff       	call   804486 <udm>
+  8045e1:	83 c4 10             	add    $0x10,%esp
+  8045e4:	eb 24                	jmp    80460a <__divdi3+0x55>
+  8045e6:	f7 d8                	neg    %eax
+  8045e8:	83 d2 00             	adc    $0x0,%edx
+  8045eb:	f7 da                	neg    %edx
+  8045ed:	85 db                	test   %ebx,%ebx
+  8045ef:	78 3a                	js     80462b <__divdi3+0x76>
+  8045f1:	83 ec 04             	sub    $0x4,%esp
+  8045f4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045f8:	56                   	push   %esi
+  8045f9:	53                   	push   %ebx
+  8045fa:	51                   	push   %ecx
+  8045fb:	e8 86 fe ff ff       	call   804486 <udm>
+  804600:	83 c4 10             	add    $0x10,%esp
+  804603:	f7 d8                	neg    %eax
+  804605:	83 d2 00             	adc    $0x0,%edx
+  804608:	f7 da                	neg    %edx
+  80460a:	83 c4 14             	add    $0x14,%esp
+  80460d:	5b                   	pop    %ebx
+  80460e:	5e                   	pop    %esi
+  80460f:	c3                   	ret
+  804610:	83 ec 04             	sub    $0x4,%esp
+  804613:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804617:	56                   	push   %esi
+  804618:	f7 d9                	neg    %ecx
+  80461a:	83 d3 00             	adc    $0x0,%ebx
+  80461d:	f7 db                	neg    %ebx
+  80461f:	53                   	push   %ebx
+  804620:	51                   	push   %ecx
+  804621:	e8 60 fe ff ff       	call   804486 <udm>
+  804626:	83 c4 10             	add    $0x10,%esp
+  804629:	eb d8                	jmp    804603 <__divdi3+0x4e>
+  80462b:	83 ec 04             	sub    $0x4,%esp
+  80462e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804632:	56                   	push   %esi
+  804633:	f7 d9                	neg    %ecx
+  804635:	83 d3 00             	adc    $0x0,%ebx
+  804638:	f7 db                	neg    %ebx
+  80463a:	53                   	push   %ebx
+  80463b:	51                   	push   %ecx
+  80463c:	e8 45 fe ff ff       	call   804486 <udm>
+  804641:	83 c4 10             	add    $0x10,%esp
+  804644:	eb c4                	jmp    80460a <__divdi3+0x55>
+
+00804646 <__moddi3>:
+  804646:	55                   	push   %ebp
+  804647:	57                   	push   %edi
+  804648:	56                   	push   %esi
+  804649:	53                   	push   %ebx
+  80464a:	83 ec 24             	sub    $0x24,%esp
+  80464d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804651:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804655:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804659:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80465d:	85 d2                	test   %edx,%edx
+  80465f:	78 3b                	js     80469c <__moddi3+0x56>
+  804661:	83 ec 04             	sub    $0x4,%esp
+  804664:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804668:	56                   	push   %esi
+  804669:	89 ce                	mov    %ecx,%esi
+  80466b:	f7 de                	neg    %esi
+  80466d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804671:	89 de                	mov    %ebx,%esi
+  804673:	83 d6 00             	adc    $0x0,%esi
+  804676:	f7 de                	neg    %esi
+  804678:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80467c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804680:	0f 48 f1             	cmovs  %ecx,%esi
+  804683:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804688:	53                   	push   %ebx
+  804689:	56                   	push   %esi
+  80468a:	e8 f7 fd ff ff       	call   804486 <udm>
+  80468f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804693:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804697:	83 c4 10             	add    $0x10,%esp
+  80469a:	eb 47                	jmp    8046e3 <__moddi3+0x9d>
+  80469c:	f7 d8                	neg    %eax
+  80469e:	83 d2 00             	adc    $0x0,%edx
+  8046a1:	f7 da                	neg    %edx
+  8046a3:	83 ec 04             	sub    $0x4,%esp
+  8046a6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046aa:	56                   	push   %esi
+  8046ab:	89 cf                	mov    %ecx,%edi
+  8046ad:	f7 df                	neg    %edi
+  8046af:	89 de                	mov    %ebx,%esi
+  8046b1:	83 d6 00             	adc    $0x0,%esi
+  8046b4:	f7 de                	neg    %esi
+  8046b6:	0f 49 cf             	cmovns %edi,%ecx
+  8046b9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046bd:	0f 49 de             	cmovns %esi,%ebx
+  8046c0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046c4:	ff 74 24 0c          	push   0xc(%esp)
+  8046c8:	ff 74 24 0c          	push   0xc(%esp)
+  8046cc:	e8 b5 fd ff ff       	call   804486 <udm>
+  8046d1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046d5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046d9:	f7 d8                	neg    %eax
+  8046db:	83 d2 00             	adc    $0x0,%edx
+  8046de:	f7 da                	neg    %edx
+  8046e0:	83 c4 10             	add    $0x10,%esp
+  8046e3:	83 c4 24             	add    $0x24,%esp
+  8046e6:	5b                   	pop    %ebx
+  8046e7:	5e                   	pop    %esi
+  8046e8:	5f                   	pop    %edi
+  8046e9:	5d                   	pop    %ebp
+  8046ea:	c3                   	ret
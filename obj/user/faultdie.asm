@@ -0,0 +1,9716 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 20 47 80 00       	push   $0x804720
+  80004a:	e8 69 01 00 00       	call   8001b8 <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 2e 0b 00 00       	call   800b82 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 db 0a 00 00       	call   800b37 <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 0b 10 00 00       	call   80107c <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	57                   	push   %edi
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	83 ec 1c             	sub    $0x1c,%esp
+  800089:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80008c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80008f:	e8 ee 0a 00 00       	call   800b82 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800094:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800097:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  80009d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a2:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000a4:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000a6:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000b1:	77 16                	ja     8000c9 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000b3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000b8:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000ba:	c1 e8 10             	shr    $0x10,%eax
+  8000bd:	74 0a                	je     8000c9 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000bf:	c1 e0 10             	shl    $0x10,%eax
+  8000c2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000c7:	29 c2                	sub    %eax,%edx
+  8000c9:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000cc:	c1 e0 04             	shl    $0x4,%eax
+  8000cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d4:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d6:	85 db                	test   %ebx,%ebx
+  8000d8:	7e 07                	jle    8000e1 <libmain+0x61>
+		binaryname = argv[0];
+  8000da:	8b 06                	mov    (%esi),%eax
+  8000dc:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e1:	83 ec 08             	sub    $0x8,%esp
+  8000e4:	56                   	push   %esi
+  8000e5:	53                   	push   %ebx
+  8000e6:	e8 76 ff ff ff       	call   800061 <umain>
+
+	// exit gracefully
+	exit();
+  8000eb:	e8 0b 00 00 00       	call   8000fb <exit>
+}
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f6:	5b                   	pop    %ebx
+  8000f7:	5e                   	pop    %esi
+  8000f8:	5f                   	pop    %edi
+  8000f9:	5d                   	pop    %ebp
+  8000fa:	c3                   	ret
+
+008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800101:	6a 00                	push   $0x0
+  800103:	e8 33 21 00 00       	call   80223b <fflush>
+	pthread_kill_others();
+  800108:	e8 9e 37 00 00       	call   8038ab <pthread_kill_others>
+	close_all();
+  80010d:	e8 cc 11 00 00       	call   8012de <close_all>
+	sys_env_destroy(0);
+  800112:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800119:	e8 19 0a 00 00       	call   800b37 <sys_env_destroy>
+}
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+00800123 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	53                   	push   %ebx
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012d:	8b 13                	mov    (%ebx),%edx
+  80012f:	8d 42 01             	lea    0x1(%edx),%eax
+  800132:	89 03                	mov    %eax,(%ebx)
+  800134:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800137:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800140:	74 09                	je     80014b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800142:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	68 ff 00 00 00       	push   $0xff
+  800153:	8d 43 08             	lea    0x8(%ebx),%eax
+  800156:	50                   	push   %eax
+  800157:	e8 84 09 00 00       	call   800ae0 <sys_cputs>
+		b->idx = 0;
+  80015c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	eb db                	jmp    800142 <putch+0x1f>
+
+00800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800170:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800177:	00 00 00 
+	b.cnt = 0;
+  80017a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800181:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800184:	ff 75 0c             	push   0xc(%ebp)
+  800187:	ff 75 08             	push   0x8(%ebp)
+  80018a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800190:	50                   	push   %eax
+  800191:	68 23 01 80 00       	push   $0x800123
+  800196:	e8 14 01 00 00       	call   8002af <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019b:	83 c4 08             	add    $0x8,%esp
+  80019e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001aa:	50                   	push   %eax
+  8001ab:	e8 30 09 00 00       	call   800ae0 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+008001b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c1:	50                   	push   %eax
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	e8 9d ff ff ff       	call   800167 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+
+008001cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	57                   	push   %edi
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 1c             	sub    $0x1c,%esp
+  8001d5:	89 c7                	mov    %eax,%edi
+  8001d7:	89 d6                	mov    %edx,%esi
+  8001d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001df:	89 d1                	mov    %edx,%ecx
+  8001e1:	89 c2                	mov    %eax,%edx
+  8001e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f9:	39 c2                	cmp    %eax,%edx
+  8001fb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fe:	72 3e                	jb     80023e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800200:	83 ec 0c             	sub    $0xc,%esp
+  800203:	ff 75 18             	push   0x18(%ebp)
+  800206:	83 eb 01             	sub    $0x1,%ebx
+  800209:	53                   	push   %ebx
+  80020a:	50                   	push   %eax
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 67 43 00 00       	call   804586 <__udivdi3>
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	52                   	push   %edx
+  800223:	50                   	push   %eax
+  800224:	89 f2                	mov    %esi,%edx
+  800226:	89 f8                	mov    %edi,%eax
+  800228:	e8 9f ff ff ff       	call   8001cc <printnum>
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	eb 13                	jmp    800245 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	ff d7                	call   *%edi
+  80023b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7f ed                	jg     800232 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	56                   	push   %esi
+  800249:	83 ec 04             	sub    $0x4,%esp
+  80024c:	ff 75 e4             	push   -0x1c(%ebp)
+  80024f:	ff 75 e0             	push   -0x20(%ebp)
+  800252:	ff 75 dc             	push   -0x24(%ebp)
+  800255:	ff 75 d8             	push   -0x28(%ebp)
+  800258:	e8 4a 43 00 00       	call   8045a7 <__umoddi3>
+  80025d:	83 c4 14             	add    $0x14,%esp
+  800260:	0f be 80 46 47 80 00 	movsbl 0x804746(%eax),%eax
+  800267:	50                   	push   %eax
+  800268:	ff d7                	call   *%edi
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027f:	8b 10                	mov    (%eax),%edx
+  800281:	3b 50 04             	cmp    0x4(%eax),%edx
+  800284:	73 0a                	jae    800290 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800286:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800289:	89 08                	mov    %ecx,(%eax)
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	88 02                	mov    %al,(%edx)
+}
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <printfmt>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800298:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029b:	50                   	push   %eax
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	e8 05 00 00 00       	call   8002af <vprintfmt>
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+008002af <vprintfmt>:
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 2c             	sub    $0x2c,%esp
+  8002b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c1:	eb 0a                	jmp    8002cd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	ff d6                	call   *%esi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8002cd:	83 c7 01             	add    $0x1,%edi
+  8002d0:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8002d4:	83 f8 25             	cmp    $0x25,%eax
+  8002d7:	74 0c                	je     8002e5 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	75 e6                	jne    8002c3 <vprintfmt+0x14>
+}
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+		padc = ' ';
+  8002e5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800303:	8d 47 01             	lea    0x1(%edi),%eax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800309:	0f b6 17             	movzbl (%edi),%edx
+  80030c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030f:	3c 55                	cmp    $0x55,%al
+  800311:	0f 87 c5 03 00 00    	ja     8006dc <vprintfmt+0x42d>
+  800317:	0f b6 c0             	movzbl %al,%eax
+  80031a:	ff 24 85 c0 48 80 00 	jmp    *0x8048c0(,%eax,4)
+  800321:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800324:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800327:	eb da                	jmp    800303 <vprintfmt+0x54>
+  800329:	0f be d2             	movsbl %dl,%edx
+  80032c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800337:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80033a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800341:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800344:	83 f9 09             	cmp    $0x9,%ecx
+  800347:	77 55                	ja     80039e <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800349:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034c:	eb e9                	jmp    800337 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80034e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800351:	8b 00                	mov    (%eax),%eax
+  800353:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800356:	8b 45 14             	mov    0x14(%ebp),%eax
+  800359:	8d 40 04             	lea    0x4(%eax),%eax
+  80035c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80035f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800362:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800366:	79 9b                	jns    800303 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800368:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800375:	eb 8c                	jmp    800303 <vprintfmt+0x54>
+			if (width < 0)
+  800377:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80037a:	85 d2                	test   %edx,%edx
+  80037c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800381:	0f 49 c2             	cmovns %edx,%eax
+  800384:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80038a:	e9 74 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80038f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800392:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800399:	e9 65 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  80039e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a4:	eb bc                	jmp    800362 <vprintfmt+0xb3>
+			lflag++;
+  8003a6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8003a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ac:	e9 52 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b7:	83 ec 08             	sub    $0x8,%esp
+  8003ba:	53                   	push   %ebx
+  8003bb:	ff 30                	push   (%eax)
+  8003bd:	ff d6                	call   *%esi
+			break;
+  8003bf:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c5:	e9 b1 02 00 00       	jmp    80067b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003d0:	8b 10                	mov    (%eax),%edx
+  8003d2:	89 d0                	mov    %edx,%eax
+  8003d4:	f7 d8                	neg    %eax
+  8003d6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d9:	83 f8 14             	cmp    $0x14,%eax
+  8003dc:	7f 23                	jg     800401 <vprintfmt+0x152>
+  8003de:	8b 14 85 20 4a 80 00 	mov    0x804a20(,%eax,4),%edx
+  8003e5:	85 d2                	test   %edx,%edx
+  8003e7:	74 18                	je     800401 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8003e9:	52                   	push   %edx
+  8003ea:	68 8f 4b 80 00       	push   $0x804b8f
+  8003ef:	53                   	push   %ebx
+  8003f0:	56                   	push   %esi
+  8003f1:	e8 9c fe ff ff       	call   800292 <printfmt>
+  8003f6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fc:	e9 7a 02 00 00       	jmp    80067b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800401:	50                   	push   %eax
+  800402:	68 5e 47 80 00       	push   $0x80475e
+  800407:	53                   	push   %ebx
+  800408:	56                   	push   %esi
+  800409:	e8 84 fe ff ff       	call   800292 <printfmt>
+  80040e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800411:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800414:	e9 62 02 00 00       	jmp    80067b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800419:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041c:	83 c0 04             	add    $0x4,%eax
+  80041f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800422:	8b 45 14             	mov    0x14(%ebp),%eax
+  800425:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800427:	85 c9                	test   %ecx,%ecx
+  800429:	b8 57 47 80 00       	mov    $0x804757,%eax
+  80042e:	0f 45 c1             	cmovne %ecx,%eax
+  800431:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800434:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800438:	7e 06                	jle    800440 <vprintfmt+0x191>
+  80043a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043e:	75 0b                	jne    80044b <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800440:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800443:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800446:	89 75 08             	mov    %esi,0x8(%ebp)
+  800449:	eb 5c                	jmp    8004a7 <vprintfmt+0x1f8>
+  80044b:	83 ec 08             	sub    $0x8,%esp
+  80044e:	ff 75 d0             	push   -0x30(%ebp)
+  800451:	ff 75 cc             	push   -0x34(%ebp)
+  800454:	e8 20 03 00 00       	call   800779 <strnlen>
+  800459:	89 c2                	mov    %eax,%edx
+  80045b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045e:	29 d0                	sub    %edx,%eax
+  800460:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800463:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800467:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80046a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046f:	eb 0e                	jmp    80047f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	53                   	push   %ebx
+  800475:	57                   	push   %edi
+  800476:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800479:	83 ee 01             	sub    $0x1,%esi
+  80047c:	83 c4 10             	add    $0x10,%esp
+  80047f:	85 f6                	test   %esi,%esi
+  800481:	7f ee                	jg     800471 <vprintfmt+0x1c2>
+  800483:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800486:	8b 75 08             	mov    0x8(%ebp),%esi
+  800489:	85 c0                	test   %eax,%eax
+  80048b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800490:	0f 49 d0             	cmovns %eax,%edx
+  800493:	29 d0                	sub    %edx,%eax
+  800495:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800498:	eb a6                	jmp    800440 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80049a:	83 ec 08             	sub    $0x8,%esp
+  80049d:	53                   	push   %ebx
+  80049e:	52                   	push   %edx
+  80049f:	ff 55 08             	call   *0x8(%ebp)
+  8004a2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a5:	89 f1                	mov    %esi,%ecx
+  8004a7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004aa:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ae:	0f be d0             	movsbl %al,%edx
+  8004b1:	85 d2                	test   %edx,%edx
+  8004b3:	74 28                	je     8004dd <vprintfmt+0x22e>
+  8004b5:	85 ff                	test   %edi,%edi
+  8004b7:	78 05                	js     8004be <vprintfmt+0x20f>
+  8004b9:	83 ef 01             	sub    $0x1,%edi
+  8004bc:	78 30                	js     8004ee <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004be:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c2:	74 d6                	je     80049a <vprintfmt+0x1eb>
+  8004c4:	0f be c0             	movsbl %al,%eax
+  8004c7:	83 e8 20             	sub    $0x20,%eax
+  8004ca:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cd:	76 cb                	jbe    80049a <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	53                   	push   %ebx
+  8004d3:	6a 3f                	push   $0x3f
+  8004d5:	ff 55 08             	call   *0x8(%ebp)
+  8004d8:	83 c4 10             	add    $0x10,%esp
+  8004db:	eb c8                	jmp    8004a5 <vprintfmt+0x1f6>
+  8004dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e6:	01 d0                	add    %edx,%eax
+  8004e8:	29 c8                	sub    %ecx,%eax
+  8004ea:	89 c7                	mov    %eax,%edi
+  8004ec:	eb 13                	jmp    800501 <vprintfmt+0x252>
+  8004ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f1:	eb ed                	jmp    8004e0 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8004f3:	83 ec 08             	sub    $0x8,%esp
+  8004f6:	53                   	push   %ebx
+  8004f7:	6a 20                	push   $0x20
+  8004f9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fb:	83 ef 01             	sub    $0x1,%edi
+  8004fe:	83 c4 10             	add    $0x10,%esp
+  800501:	85 ff                	test   %edi,%edi
+  800503:	7f ee                	jg     8004f3 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800505:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800508:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050b:	e9 6b 01 00 00       	jmp    80067b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800510:	83 f9 01             	cmp    $0x1,%ecx
+  800513:	7f 1f                	jg     800534 <vprintfmt+0x285>
+	else if (lflag)
+  800515:	85 c9                	test   %ecx,%ecx
+  800517:	74 67                	je     800580 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800519:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051c:	8b 00                	mov    (%eax),%eax
+  80051e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800521:	89 c1                	mov    %eax,%ecx
+  800523:	c1 f9 1f             	sar    $0x1f,%ecx
+  800526:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800529:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052c:	8d 40 04             	lea    0x4(%eax),%eax
+  80052f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800532:	eb 17                	jmp    80054b <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8b 50 04             	mov    0x4(%eax),%edx
+  80053a:	8b 00                	mov    (%eax),%eax
+  80053c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8d 40 08             	lea    0x8(%eax),%eax
+  800548:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80054b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800551:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800556:	85 c9                	test   %ecx,%ecx
+  800558:	0f 89 03 01 00 00    	jns    800661 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	53                   	push   %ebx
+  800562:	6a 2d                	push   $0x2d
+  800564:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800566:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800569:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056c:	f7 da                	neg    %edx
+  80056e:	83 d1 00             	adc    $0x0,%ecx
+  800571:	f7 d9                	neg    %ecx
+  800573:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800576:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057b:	e9 e1 00 00 00       	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 00                	mov    (%eax),%eax
+  800585:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800588:	89 c1                	mov    %eax,%ecx
+  80058a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800590:	8b 45 14             	mov    0x14(%ebp),%eax
+  800593:	8d 40 04             	lea    0x4(%eax),%eax
+  800596:	89 45 14             	mov    %eax,0x14(%ebp)
+  800599:	eb b0                	jmp    80054b <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80059b:	83 f9 01             	cmp    $0x1,%ecx
+  80059e:	7f 1e                	jg     8005be <vprintfmt+0x30f>
+	else if (lflag)
+  8005a0:	85 c9                	test   %ecx,%ecx
+  8005a2:	74 32                	je     8005d6 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8b 10                	mov    (%eax),%edx
+  8005a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b9:	e9 a3 00 00 00       	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d1:	e9 8b 00 00 00       	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 10                	mov    (%eax),%edx
+  8005db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005eb:	eb 74                	jmp    800661 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8005ed:	83 f9 01             	cmp    $0x1,%ecx
+  8005f0:	7f 1b                	jg     80060d <vprintfmt+0x35e>
+	else if (lflag)
+  8005f2:	85 c9                	test   %ecx,%ecx
+  8005f4:	74 2c                	je     800622 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8005f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f9:	8b 10                	mov    (%eax),%edx
+  8005fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800600:	8d 40 04             	lea    0x4(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800606:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80060b:	eb 54                	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	8b 48 04             	mov    0x4(%eax),%ecx
+  800615:	8d 40 08             	lea    0x8(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80061b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800620:	eb 3f                	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062c:	8d 40 04             	lea    0x4(%eax),%eax
+  80062f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800632:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800637:	eb 28                	jmp    800661 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800639:	83 ec 08             	sub    $0x8,%esp
+  80063c:	53                   	push   %ebx
+  80063d:	6a 30                	push   $0x30
+  80063f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800641:	83 c4 08             	add    $0x8,%esp
+  800644:	53                   	push   %ebx
+  800645:	6a 78                	push   $0x78
+  800647:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8b 10                	mov    (%eax),%edx
+  80064e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800653:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800661:	83 ec 0c             	sub    $0xc,%esp
+  800664:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800668:	50                   	push   %eax
+  800669:	ff 75 e0             	push   -0x20(%ebp)
+  80066c:	57                   	push   %edi
+  80066d:	51                   	push   %ecx
+  80066e:	52                   	push   %edx
+  80066f:	89 da                	mov    %ebx,%edx
+  800671:	89 f0                	mov    %esi,%eax
+  800673:	e8 54 fb ff ff       	call   8001cc <printnum>
+			break;
+  800678:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80067b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80067e:	e9 4a fc ff ff       	jmp    8002cd <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800683:	83 f9 01             	cmp    $0x1,%ecx
+  800686:	7f 1b                	jg     8006a3 <vprintfmt+0x3f4>
+	else if (lflag)
+  800688:	85 c9                	test   %ecx,%ecx
+  80068a:	74 2c                	je     8006b8 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a1:	eb be                	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b6:	eb a9                	jmp    800661 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006cd:	eb 92                	jmp    800661 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8006cf:	83 ec 08             	sub    $0x8,%esp
+  8006d2:	53                   	push   %ebx
+  8006d3:	6a 25                	push   $0x25
+  8006d5:	ff d6                	call   *%esi
+			break;
+  8006d7:	83 c4 10             	add    $0x10,%esp
+  8006da:	eb 9f                	jmp    80067b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	53                   	push   %ebx
+  8006e0:	6a 25                	push   $0x25
+  8006e2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e4:	83 c4 10             	add    $0x10,%esp
+  8006e7:	89 f8                	mov    %edi,%eax
+  8006e9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ed:	74 05                	je     8006f4 <vprintfmt+0x445>
+  8006ef:	83 e8 01             	sub    $0x1,%eax
+  8006f2:	eb f5                	jmp    8006e9 <vprintfmt+0x43a>
+  8006f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f7:	eb 82                	jmp    80067b <vprintfmt+0x3cc>
+
+008006f9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f9:	55                   	push   %ebp
+  8006fa:	89 e5                	mov    %esp,%ebp
+  8006fc:	83 ec 18             	sub    $0x18,%esp
+  8006ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800702:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800705:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800708:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80070c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80070f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800716:	85 c0                	test   %eax,%eax
+  800718:	74 26                	je     800740 <vsnprintf+0x47>
+  80071a:	85 d2                	test   %edx,%edx
+  80071c:	7e 22                	jle    800740 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80071e:	ff 75 14             	push   0x14(%ebp)
+  800721:	ff 75 10             	push   0x10(%ebp)
+  800724:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800727:	50                   	push   %eax
+  800728:	68 75 02 80 00       	push   $0x800275
+  80072d:	e8 7d fb ff ff       	call   8002af <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800732:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800735:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073b:	83 c4 10             	add    $0x10,%esp
+}
+  80073e:	c9                   	leave
+  80073f:	c3                   	ret
+		return -E_INVAL;
+  800740:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800745:	eb f7                	jmp    80073e <vsnprintf+0x45>
+
+00800747 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800747:	55                   	push   %ebp
+  800748:	89 e5                	mov    %esp,%ebp
+  80074a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80074d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800750:	50                   	push   %eax
+  800751:	ff 75 10             	push   0x10(%ebp)
+  800754:	ff 75 0c             	push   0xc(%ebp)
+  800757:	ff 75 08             	push   0x8(%ebp)
+  80075a:	e8 9a ff ff ff       	call   8006f9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80075f:	c9                   	leave
+  800760:	c3                   	ret
+
+00800761 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076c:	eb 03                	jmp    800771 <strlen+0x10>
+		n++;
+  80076e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800771:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800775:	75 f7                	jne    80076e <strlen+0xd>
+	return n;
+}
+  800777:	5d                   	pop    %ebp
+  800778:	c3                   	ret
+
+00800779 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80077f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800782:	b8 00 00 00 00       	mov    $0x0,%eax
+  800787:	eb 03                	jmp    80078c <strnlen+0x13>
+		n++;
+  800789:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078c:	39 d0                	cmp    %edx,%eax
+  80078e:	74 08                	je     800798 <strnlen+0x1f>
+  800790:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800794:	75 f3                	jne    800789 <strnlen+0x10>
+  800796:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800798:	89 d0                	mov    %edx,%eax
+  80079a:	5d                   	pop    %ebp
+  80079b:	c3                   	ret
+
+0080079c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80079c:	55                   	push   %ebp
+  80079d:	89 e5                	mov    %esp,%ebp
+  80079f:	53                   	push   %ebx
+  8007a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ab:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007af:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b2:	83 c0 01             	add    $0x1,%eax
+  8007b5:	84 d2                	test   %dl,%dl
+  8007b7:	75 f2                	jne    8007ab <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b9:	89 c8                	mov    %ecx,%eax
+  8007bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007be:	c9                   	leave
+  8007bf:	c3                   	ret
+
+008007c0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	53                   	push   %ebx
+  8007c4:	83 ec 10             	sub    $0x10,%esp
+  8007c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ca:	53                   	push   %ebx
+  8007cb:	e8 91 ff ff ff       	call   800761 <strlen>
+  8007d0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007d3:	ff 75 0c             	push   0xc(%ebp)
+  8007d6:	01 d8                	add    %ebx,%eax
+  8007d8:	50                   	push   %eax
+  8007d9:	e8 be ff ff ff       	call   80079c <strcpy>
+	return dst;
+}
+  8007de:	89 d8                	mov    %ebx,%eax
+  8007e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+008007e5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	56                   	push   %esi
+  8007e9:	53                   	push   %ebx
+  8007ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f0:	89 f3                	mov    %esi,%ebx
+  8007f2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f5:	89 f0                	mov    %esi,%eax
+  8007f7:	eb 0f                	jmp    800808 <strncpy+0x23>
+		*dst++ = *src;
+  8007f9:	83 c0 01             	add    $0x1,%eax
+  8007fc:	0f b6 0a             	movzbl (%edx),%ecx
+  8007ff:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800802:	80 f9 01             	cmp    $0x1,%cl
+  800805:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800808:	39 d8                	cmp    %ebx,%eax
+  80080a:	75 ed                	jne    8007f9 <strncpy+0x14>
+	}
+	return ret;
+}
+  80080c:	89 f0                	mov    %esi,%eax
+  80080e:	5b                   	pop    %ebx
+  80080f:	5e                   	pop    %esi
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+
+00800812 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	56                   	push   %esi
+  800816:	53                   	push   %ebx
+  800817:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800820:	89 f0                	mov    %esi,%eax
+  800822:	85 d2                	test   %edx,%edx
+  800824:	74 21                	je     800847 <strlcpy+0x35>
+  800826:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80082a:	89 f2                	mov    %esi,%edx
+  80082c:	eb 09                	jmp    800837 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80082e:	83 c1 01             	add    $0x1,%ecx
+  800831:	83 c2 01             	add    $0x1,%edx
+  800834:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800837:	39 c2                	cmp    %eax,%edx
+  800839:	74 09                	je     800844 <strlcpy+0x32>
+  80083b:	0f b6 19             	movzbl (%ecx),%ebx
+  80083e:	84 db                	test   %bl,%bl
+  800840:	75 ec                	jne    80082e <strlcpy+0x1c>
+  800842:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800844:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800847:	29 f0                	sub    %esi,%eax
+}
+  800849:	5b                   	pop    %ebx
+  80084a:	5e                   	pop    %esi
+  80084b:	5d                   	pop    %ebp
+  80084c:	c3                   	ret
+
+0080084d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80084d:	55                   	push   %ebp
+  80084e:	89 e5                	mov    %esp,%ebp
+  800850:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800853:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800856:	eb 06                	jmp    80085e <strcmp+0x11>
+		p++, q++;
+  800858:	83 c1 01             	add    $0x1,%ecx
+  80085b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80085e:	0f b6 01             	movzbl (%ecx),%eax
+  800861:	84 c0                	test   %al,%al
+  800863:	74 04                	je     800869 <strcmp+0x1c>
+  800865:	3a 02                	cmp    (%edx),%al
+  800867:	74 ef                	je     800858 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800869:	0f b6 c0             	movzbl %al,%eax
+  80086c:	0f b6 12             	movzbl (%edx),%edx
+  80086f:	29 d0                	sub    %edx,%eax
+}
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	53                   	push   %ebx
+  800877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80087d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800880:	eb 09                	jmp    80088b <strncmp+0x18>
+		n--, p++, q++;
+  800882:	83 ea 01             	sub    $0x1,%edx
+  800885:	83 c0 01             	add    $0x1,%eax
+  800888:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80088b:	85 d2                	test   %edx,%edx
+  80088d:	74 18                	je     8008a7 <strncmp+0x34>
+  80088f:	0f b6 18             	movzbl (%eax),%ebx
+  800892:	84 db                	test   %bl,%bl
+  800894:	74 04                	je     80089a <strncmp+0x27>
+  800896:	3a 19                	cmp    (%ecx),%bl
+  800898:	74 e8                	je     800882 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80089a:	0f b6 00             	movzbl (%eax),%eax
+  80089d:	0f b6 11             	movzbl (%ecx),%edx
+  8008a0:	29 d0                	sub    %edx,%eax
+}
+  8008a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a5:	c9                   	leave
+  8008a6:	c3                   	ret
+		return 0;
+  8008a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ac:	eb f4                	jmp    8008a2 <strncmp+0x2f>
+
+008008ae <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b8:	eb 03                	jmp    8008bd <strchr+0xf>
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	0f b6 10             	movzbl (%eax),%edx
+  8008c0:	84 d2                	test   %dl,%dl
+  8008c2:	74 06                	je     8008ca <strchr+0x1c>
+		if (*s == c)
+  8008c4:	38 ca                	cmp    %cl,%dl
+  8008c6:	75 f2                	jne    8008ba <strchr+0xc>
+  8008c8:	eb 05                	jmp    8008cf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008db:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008de:	38 ca                	cmp    %cl,%dl
+  8008e0:	74 09                	je     8008eb <strfind+0x1a>
+  8008e2:	84 d2                	test   %dl,%dl
+  8008e4:	74 05                	je     8008eb <strfind+0x1a>
+	for (; *s; s++)
+  8008e6:	83 c0 01             	add    $0x1,%eax
+  8008e9:	eb f0                	jmp    8008db <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008eb:	5d                   	pop    %ebp
+  8008ec:	c3                   	ret
+
+008008ed <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	57                   	push   %edi
+  8008f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008f7:	85 c9                	test   %ecx,%ecx
+  8008f9:	74 20                	je     80091b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008fb:	89 f8                	mov    %edi,%eax
+  8008fd:	09 c8                	or     %ecx,%eax
+  8008ff:	a8 03                	test   $0x3,%al
+  800901:	75 12                	jne    800915 <memset+0x28>
+		c &= 0xFF;
+  800903:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800907:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80090d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800910:	fc                   	cld
+  800911:	f3 ab                	rep stos %eax,%es:(%edi)
+  800913:	eb 06                	jmp    80091b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800915:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800918:	fc                   	cld
+  800919:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80091b:	89 f8                	mov    %edi,%eax
+  80091d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800920:	c9                   	leave
+  800921:	c3                   	ret
+
+00800922 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	57                   	push   %edi
+  800926:	56                   	push   %esi
+  800927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80092d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800930:	39 c6                	cmp    %eax,%esi
+  800932:	73 32                	jae    800966 <memmove+0x44>
+  800934:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800937:	39 d0                	cmp    %edx,%eax
+  800939:	73 2b                	jae    800966 <memmove+0x44>
+		s += n;
+		d += n;
+  80093b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093e:	89 d6                	mov    %edx,%esi
+  800940:	09 fe                	or     %edi,%esi
+  800942:	09 ce                	or     %ecx,%esi
+  800944:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80094a:	75 0e                	jne    80095a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80094c:	83 ef 04             	sub    $0x4,%edi
+  80094f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800952:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800955:	fd                   	std
+  800956:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800958:	eb 09                	jmp    800963 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80095a:	83 ef 01             	sub    $0x1,%edi
+  80095d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800960:	fd                   	std
+  800961:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800963:	fc                   	cld
+  800964:	eb 1a                	jmp    800980 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800966:	89 f2                	mov    %esi,%edx
+  800968:	09 c2                	or     %eax,%edx
+  80096a:	09 ca                	or     %ecx,%edx
+  80096c:	f6 c2 03             	test   $0x3,%dl
+  80096f:	75 0a                	jne    80097b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800971:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800974:	89 c7                	mov    %eax,%edi
+  800976:	fc                   	cld
+  800977:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800979:	eb 05                	jmp    800980 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80097b:	89 c7                	mov    %eax,%edi
+  80097d:	fc                   	cld
+  80097e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800980:	5e                   	pop    %esi
+  800981:	5f                   	pop    %edi
+  800982:	5d                   	pop    %ebp
+  800983:	c3                   	ret
+
+00800984 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800984:	55                   	push   %ebp
+  800985:	89 e5                	mov    %esp,%ebp
+  800987:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80098a:	ff 75 10             	push   0x10(%ebp)
+  80098d:	ff 75 0c             	push   0xc(%ebp)
+  800990:	ff 75 08             	push   0x8(%ebp)
+  800993:	e8 8a ff ff ff       	call   800922 <memmove>
+}
+  800998:	c9                   	leave
+  800999:	c3                   	ret
+
+0080099a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	56                   	push   %esi
+  80099e:	53                   	push   %ebx
+  80099f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a5:	89 c6                	mov    %eax,%esi
+  8009a7:	03 75 10             	add    0x10(%ebp),%esi
+  8009aa:	eb 06                	jmp    8009b2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009ac:	83 c0 01             	add    $0x1,%eax
+  8009af:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b2:	39 f0                	cmp    %esi,%eax
+  8009b4:	74 14                	je     8009ca <memcmp+0x30>
+		if (*s1 != *s2)
+  8009b6:	0f b6 08             	movzbl (%eax),%ecx
+  8009b9:	0f b6 1a             	movzbl (%edx),%ebx
+  8009bc:	38 d9                	cmp    %bl,%cl
+  8009be:	74 ec                	je     8009ac <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c0:	0f b6 c1             	movzbl %cl,%eax
+  8009c3:	0f b6 db             	movzbl %bl,%ebx
+  8009c6:	29 d8                	sub    %ebx,%eax
+  8009c8:	eb 05                	jmp    8009cf <memcmp+0x35>
+	}
+
+	return 0;
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009cf:	5b                   	pop    %ebx
+  8009d0:	5e                   	pop    %esi
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e1:	eb 03                	jmp    8009e6 <memfind+0x13>
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	39 d0                	cmp    %edx,%eax
+  8009e8:	73 04                	jae    8009ee <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ea:	38 08                	cmp    %cl,(%eax)
+  8009ec:	75 f5                	jne    8009e3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	57                   	push   %edi
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009fc:	eb 03                	jmp    800a01 <strtol+0x11>
+		s++;
+  8009fe:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a01:	0f b6 02             	movzbl (%edx),%eax
+  800a04:	3c 20                	cmp    $0x20,%al
+  800a06:	74 f6                	je     8009fe <strtol+0xe>
+  800a08:	3c 09                	cmp    $0x9,%al
+  800a0a:	74 f2                	je     8009fe <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a0c:	3c 2b                	cmp    $0x2b,%al
+  800a0e:	74 2a                	je     800a3a <strtol+0x4a>
+	int neg = 0;
+  800a10:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a15:	3c 2d                	cmp    $0x2d,%al
+  800a17:	74 2b                	je     800a44 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a19:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a1f:	75 0f                	jne    800a30 <strtol+0x40>
+  800a21:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a24:	74 28                	je     800a4e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a26:	85 db                	test   %ebx,%ebx
+  800a28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a2d:	0f 44 d8             	cmove  %eax,%ebx
+  800a30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a35:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a38:	eb 46                	jmp    800a80 <strtol+0x90>
+		s++;
+  800a3a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a42:	eb d5                	jmp    800a19 <strtol+0x29>
+		s++, neg = 1;
+  800a44:	83 c2 01             	add    $0x1,%edx
+  800a47:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a4c:	eb cb                	jmp    800a19 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a4e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a52:	74 0e                	je     800a62 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a54:	85 db                	test   %ebx,%ebx
+  800a56:	75 d8                	jne    800a30 <strtol+0x40>
+		s++, base = 8;
+  800a58:	83 c2 01             	add    $0x1,%edx
+  800a5b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a60:	eb ce                	jmp    800a30 <strtol+0x40>
+		s += 2, base = 16;
+  800a62:	83 c2 02             	add    $0x2,%edx
+  800a65:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a6a:	eb c4                	jmp    800a30 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a6c:	0f be c0             	movsbl %al,%eax
+  800a6f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a72:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a75:	7d 3a                	jge    800ab1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a77:	83 c2 01             	add    $0x1,%edx
+  800a7a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a7e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a80:	0f b6 02             	movzbl (%edx),%eax
+  800a83:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a86:	89 f3                	mov    %esi,%ebx
+  800a88:	80 fb 09             	cmp    $0x9,%bl
+  800a8b:	76 df                	jbe    800a6c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a8d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a90:	89 f3                	mov    %esi,%ebx
+  800a92:	80 fb 19             	cmp    $0x19,%bl
+  800a95:	77 08                	ja     800a9f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a97:	0f be c0             	movsbl %al,%eax
+  800a9a:	83 e8 57             	sub    $0x57,%eax
+  800a9d:	eb d3                	jmp    800a72 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a9f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa2:	89 f3                	mov    %esi,%ebx
+  800aa4:	80 fb 19             	cmp    $0x19,%bl
+  800aa7:	77 08                	ja     800ab1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa9:	0f be c0             	movsbl %al,%eax
+  800aac:	83 e8 37             	sub    $0x37,%eax
+  800aaf:	eb c1                	jmp    800a72 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab5:	74 05                	je     800abc <strtol+0xcc>
+		*endptr = (char *) s;
+  800ab7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aba:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800abc:	89 c8                	mov    %ecx,%eax
+  800abe:	f7 d8                	neg    %eax
+  800ac0:	85 ff                	test   %edi,%edi
+  800ac2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac5:	89 c8                	mov    %ecx,%eax
+  800ac7:	5b                   	pop    %ebx
+  800ac8:	5e                   	pop    %esi
+  800ac9:	5f                   	pop    %edi
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <atoi>:
+
+int
+atoi(const char* s)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800ad2:	6a 00                	push   $0x0
+  800ad4:	6a 00                	push   $0x0
+  800ad6:	ff 75 08             	push   0x8(%ebp)
+  800ad9:	e8 12 ff ff ff       	call   8009f0 <strtol>
+}
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+00800ae0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	57                   	push   %edi
+  800ae4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af0:	89 c3                	mov    %eax,%ebx
+  800af2:	89 c7                	mov    %eax,%edi
+  800af4:	6a 00                	push   $0x0
+  800af6:	55                   	push   %ebp
+  800af7:	56                   	push   %esi
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	8d 35 02 0b 80 00    	lea    0x800b02,%esi
+  800b00:	0f 34                	sysenter
+
+00800b02 <after_sysenter_label_47>:
+  800b02:	5e                   	pop    %esi
+  800b03:	5d                   	pop    %ebp
+  800b04:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b07:	5b                   	pop    %ebx
+  800b08:	5f                   	pop    %edi
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	57                   	push   %edi
+  800b0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b15:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b1a:	89 d1                	mov    %edx,%ecx
+  800b1c:	89 d3                	mov    %edx,%ebx
+  800b1e:	89 d7                	mov    %edx,%edi
+  800b20:	6a 00                	push   $0x0
+  800b22:	55                   	push   %ebp
+  800b23:	56                   	push   %esi
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	8d 35 2e 0b 80 00    	lea    0x800b2e,%esi
+  800b2c:	0f 34                	sysenter
+
+00800b2e <after_sysenter_label_128>:
+  800b2e:	5e                   	pop    %esi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b33:	5b                   	pop    %ebx
+  800b34:	5f                   	pop    %edi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	57                   	push   %edi
+  800b3b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b44:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b49:	89 cb                	mov    %ecx,%ebx
+  800b4b:	89 cf                	mov    %ecx,%edi
+  800b4d:	6a 00                	push   $0x0
+  800b4f:	55                   	push   %ebp
+  800b50:	56                   	push   %esi
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	8d 35 5b 0b 80 00    	lea    0x800b5b,%esi
+  800b59:	0f 34                	sysenter
+
+00800b5b <after_sysenter_label_212>:
+  800b5b:	5e                   	pop    %esi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b60:	85 c0                	test   %eax,%eax
+  800b62:	7f 07                	jg     800b6b <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b67:	5b                   	pop    %ebx
+  800b68:	5f                   	pop    %edi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b6b:	83 ec 0c             	sub    $0xc,%esp
+  800b6e:	50                   	push   %eax
+  800b6f:	6a 03                	push   $0x3
+  800b71:	68 b5 4a 80 00       	push   $0x804ab5
+  800b76:	6a 54                	push   $0x54
+  800b78:	68 d2 4a 80 00       	push   $0x804ad2
+  800b7d:	e8 9c 30 00 00       	call   803c1e <_panic>
+
+00800b82 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b91:	89 d1                	mov    %edx,%ecx
+  800b93:	89 d3                	mov    %edx,%ebx
+  800b95:	89 d7                	mov    %edx,%edi
+  800b97:	6a 00                	push   $0x0
+  800b99:	55                   	push   %ebp
+  800b9a:	56                   	push   %esi
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8d 35 a5 0b 80 00    	lea    0x800ba5,%esi
+  800ba3:	0f 34                	sysenter
+
+00800ba5 <after_sysenter_label_309>:
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bbd:	89 d1                	mov    %edx,%ecx
+  800bbf:	89 d3                	mov    %edx,%ebx
+  800bc1:	89 d7                	mov    %edx,%edi
+  800bc3:	6a 00                	push   $0x0
+  800bc5:	55                   	push   %ebp
+  800bc6:	56                   	push   %esi
+  800bc7:	89 e5                	mov    %esp,%ebp
+  800bc9:	8d 35 d1 0b 80 00    	lea    0x800bd1,%esi
+  800bcf:	0f 34                	sysenter
+
+00800bd1 <after_sysenter_label_391>:
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+
+00800bda <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bda:	55                   	push   %ebp
+  800bdb:	89 e5                	mov    %esp,%ebp
+  800bdd:	57                   	push   %edi
+  800bde:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bea:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf2:	6a 00                	push   $0x0
+  800bf4:	55                   	push   %ebp
+  800bf5:	56                   	push   %esi
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	8d 35 00 0c 80 00    	lea    0x800c00,%esi
+  800bfe:	0f 34                	sysenter
+
+00800c00 <after_sysenter_label_479>:
+  800c00:	5e                   	pop    %esi
+  800c01:	5d                   	pop    %ebp
+  800c02:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c05:	85 c0                	test   %eax,%eax
+  800c07:	7f 07                	jg     800c10 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5f                   	pop    %edi
+  800c0e:	5d                   	pop    %ebp
+  800c0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c10:	83 ec 0c             	sub    $0xc,%esp
+  800c13:	50                   	push   %eax
+  800c14:	6a 04                	push   $0x4
+  800c16:	68 b5 4a 80 00       	push   $0x804ab5
+  800c1b:	6a 54                	push   $0x54
+  800c1d:	68 d2 4a 80 00       	push   $0x804ad2
+  800c22:	e8 f7 2f 00 00       	call   803c1e <_panic>
+
+00800c27 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	57                   	push   %edi
+  800c2b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c3d:	ff 75 18             	push   0x18(%ebp)
+  800c40:	55                   	push   %ebp
+  800c41:	56                   	push   %esi
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	8d 35 4c 0c 80 00    	lea    0x800c4c,%esi
+  800c4a:	0f 34                	sysenter
+
+00800c4c <after_sysenter_label_593>:
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c51:	85 c0                	test   %eax,%eax
+  800c53:	7f 07                	jg     800c5c <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c58:	5b                   	pop    %ebx
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+  800c5f:	50                   	push   %eax
+  800c60:	6a 05                	push   $0x5
+  800c62:	68 b5 4a 80 00       	push   $0x804ab5
+  800c67:	6a 54                	push   $0x54
+  800c69:	68 d2 4a 80 00       	push   $0x804ad2
+  800c6e:	e8 ab 2f 00 00       	call   803c1e <_panic>
+
+00800c73 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c83:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c88:	89 df                	mov    %ebx,%edi
+  800c8a:	6a 00                	push   $0x0
+  800c8c:	55                   	push   %ebp
+  800c8d:	56                   	push   %esi
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	8d 35 98 0c 80 00    	lea    0x800c98,%esi
+  800c96:	0f 34                	sysenter
+
+00800c98 <after_sysenter_label_704>:
+  800c98:	5e                   	pop    %esi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	7f 07                	jg     800ca8 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ca1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca4:	5b                   	pop    %ebx
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca8:	83 ec 0c             	sub    $0xc,%esp
+  800cab:	50                   	push   %eax
+  800cac:	6a 06                	push   $0x6
+  800cae:	68 b5 4a 80 00       	push   $0x804ab5
+  800cb3:	6a 54                	push   $0x54
+  800cb5:	68 d2 4a 80 00       	push   $0x804ad2
+  800cba:	e8 5f 2f 00 00       	call   803c1e <_panic>
+
+00800cbf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cbf:	55                   	push   %ebp
+  800cc0:	89 e5                	mov    %esp,%ebp
+  800cc2:	57                   	push   %edi
+  800cc3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cd4:	89 df                	mov    %ebx,%edi
+  800cd6:	6a 00                	push   $0x0
+  800cd8:	55                   	push   %ebp
+  800cd9:	56                   	push   %esi
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	8d 35 e4 0c 80 00    	lea    0x800ce4,%esi
+  800ce2:	0f 34                	sysenter
+
+00800ce4 <after_sysenter_label_808>:
+  800ce4:	5e                   	pop    %esi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ce9:	85 c0                	test   %eax,%eax
+  800ceb:	7f 07                	jg     800cf4 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ced:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf4:	83 ec 0c             	sub    $0xc,%esp
+  800cf7:	50                   	push   %eax
+  800cf8:	6a 08                	push   $0x8
+  800cfa:	68 b5 4a 80 00       	push   $0x804ab5
+  800cff:	6a 54                	push   $0x54
+  800d01:	68 d2 4a 80 00       	push   $0x804ad2
+  800d06:	e8 13 2f 00 00       	call   803c1e <_panic>
+
+00800d0b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	57                   	push   %edi
+  800d0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d20:	89 df                	mov    %ebx,%edi
+  800d22:	6a 00                	push   $0x0
+  800d24:	55                   	push   %ebp
+  800d25:	56                   	push   %esi
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	8d 35 30 0d 80 00    	lea    0x800d30,%esi
+  800d2e:	0f 34                	sysenter
+
+00800d30 <after_sysenter_label_912>:
+  800d30:	5e                   	pop    %esi
+  800d31:	5d                   	pop    %ebp
+  800d32:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d35:	85 c0                	test   %eax,%eax
+  800d37:	7f 07                	jg     800d40 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5f                   	pop    %edi
+  800d3e:	5d                   	pop    %ebp
+  800d3f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+  800d43:	50                   	push   %eax
+  800d44:	6a 09                	push   $0x9
+  800d46:	68 b5 4a 80 00       	push   $0x804ab5
+  800d4b:	6a 54                	push   $0x54
+  800d4d:	68 d2 4a 80 00       	push   $0x804ad2
+  800d52:	e8 c7 2e 00 00       	call   803c1e <_panic>
+
+00800d57 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	57                   	push   %edi
+  800d5b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d6c:	89 df                	mov    %ebx,%edi
+  800d6e:	6a 00                	push   $0x0
+  800d70:	55                   	push   %ebp
+  800d71:	56                   	push   %esi
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	8d 35 7c 0d 80 00    	lea    0x800d7c,%esi
+  800d7a:	0f 34                	sysenter
+
+00800d7c <after_sysenter_label_1016>:
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5d                   	pop    %ebp
+  800d7e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 07                	jg     800d8c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 0a                	push   $0xa
+  800d92:	68 b5 4a 80 00       	push   $0x804ab5
+  800d97:	6a 54                	push   $0x54
+  800d99:	68 d2 4a 80 00       	push   $0x804ad2
+  800d9e:	e8 7b 2e 00 00       	call   803c1e <_panic>
+
+00800da3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db9:	6a 00                	push   $0x0
+  800dbb:	55                   	push   %ebp
+  800dbc:	56                   	push   %esi
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	8d 35 c7 0d 80 00    	lea    0x800dc7,%esi
+  800dc5:	0f 34                	sysenter
+
+00800dc7 <after_sysenter_label_1126>:
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800de2:	89 cb                	mov    %ecx,%ebx
+  800de4:	89 cf                	mov    %ecx,%edi
+  800de6:	6a 00                	push   $0x0
+  800de8:	55                   	push   %ebp
+  800de9:	56                   	push   %esi
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	8d 35 f4 0d 80 00    	lea    0x800df4,%esi
+  800df2:	0f 34                	sysenter
+
+00800df4 <after_sysenter_label_1210>:
+  800df4:	5e                   	pop    %esi
+  800df5:	5d                   	pop    %ebp
+  800df6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	7f 07                	jg     800e04 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800dfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e00:	5b                   	pop    %ebx
+  800e01:	5f                   	pop    %edi
+  800e02:	5d                   	pop    %ebp
+  800e03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	50                   	push   %eax
+  800e08:	6a 0d                	push   $0xd
+  800e0a:	68 b5 4a 80 00       	push   $0x804ab5
+  800e0f:	6a 54                	push   $0x54
+  800e11:	68 d2 4a 80 00       	push   $0x804ad2
+  800e16:	e8 03 2e 00 00       	call   803c1e <_panic>
+
+00800e1b <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2b:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e30:	89 df                	mov    %ebx,%edi
+  800e32:	6a 00                	push   $0x0
+  800e34:	55                   	push   %ebp
+  800e35:	56                   	push   %esi
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	8d 35 40 0e 80 00    	lea    0x800e40,%esi
+  800e3e:	0f 34                	sysenter
+
+00800e40 <after_sysenter_label_1311>:
+  800e40:	5e                   	pop    %esi
+  800e41:	5d                   	pop    %ebp
+  800e42:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 07                	jg     800e50 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	50                   	push   %eax
+  800e54:	6a 42                	push   $0x42
+  800e56:	68 b5 4a 80 00       	push   $0x804ab5
+  800e5b:	6a 54                	push   $0x54
+  800e5d:	68 d2 4a 80 00       	push   $0x804ad2
+  800e62:	e8 b7 2d 00 00       	call   803c1e <_panic>
+
+00800e67 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e71:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e76:	89 d1                	mov    %edx,%ecx
+  800e78:	89 d3                	mov    %edx,%ebx
+  800e7a:	89 d7                	mov    %edx,%edi
+  800e7c:	6a 00                	push   $0x0
+  800e7e:	55                   	push   %ebp
+  800e7f:	56                   	push   %esi
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+
+00800e8a <after_sysenter_label_1411>:
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ea8:	89 df                	mov    %ebx,%edi
+  800eaa:	6a 00                	push   $0x0
+  800eac:	55                   	push   %ebp
+  800ead:	56                   	push   %esi
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	8d 35 b8 0e 80 00    	lea    0x800eb8,%esi
+  800eb6:	0f 34                	sysenter
+
+00800eb8 <after_sysenter_label_1497>:
+  800eb8:	5e                   	pop    %esi
+  800eb9:	5d                   	pop    %ebp
+  800eba:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5f                   	pop    %edi
+  800ebf:	5d                   	pop    %ebp
+  800ec0:	c3                   	ret
+
+00800ec1 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ed6:	89 df                	mov    %ebx,%edi
+  800ed8:	6a 00                	push   $0x0
+  800eda:	55                   	push   %ebp
+  800edb:	56                   	push   %esi
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	8d 35 e6 0e 80 00    	lea    0x800ee6,%esi
+  800ee4:	0f 34                	sysenter
+
+00800ee6 <after_sysenter_label_1583>:
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+
+00800eef <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efa:	b8 11 00 00 00       	mov    $0x11,%eax
+  800eff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f07:	6a 00                	push   $0x0
+  800f09:	55                   	push   %ebp
+  800f0a:	56                   	push   %esi
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	8d 35 15 0f 80 00    	lea    0x800f15,%esi
+  800f13:	0f 34                	sysenter
+
+00800f15 <after_sysenter_label_1672>:
+  800f15:	5e                   	pop    %esi
+  800f16:	5d                   	pop    %ebp
+  800f17:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+
+00800f1e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	57                   	push   %edi
+  800f22:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f33:	89 df                	mov    %ebx,%edi
+  800f35:	6a 00                	push   $0x0
+  800f37:	55                   	push   %ebp
+  800f38:	56                   	push   %esi
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	8d 35 43 0f 80 00    	lea    0x800f43,%esi
+  800f41:	0f 34                	sysenter
+
+00800f43 <after_sysenter_label_1758>:
+  800f43:	5e                   	pop    %esi
+  800f44:	5d                   	pop    %ebp
+  800f45:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f48:	5b                   	pop    %ebx
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+
+00800f4c <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f59:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f5e:	89 cb                	mov    %ecx,%ebx
+  800f60:	89 cf                	mov    %ecx,%edi
+  800f62:	6a 00                	push   $0x0
+  800f64:	55                   	push   %ebp
+  800f65:	56                   	push   %esi
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	8d 35 70 0f 80 00    	lea    0x800f70,%esi
+  800f6e:	0f 34                	sysenter
+
+00800f70 <after_sysenter_label_1842>:
+  800f70:	5e                   	pop    %esi
+  800f71:	5d                   	pop    %ebp
+  800f72:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 07                	jg     800f80 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f80:	83 ec 0c             	sub    $0xc,%esp
+  800f83:	50                   	push   %eax
+  800f84:	6a 13                	push   $0x13
+  800f86:	68 b5 4a 80 00       	push   $0x804ab5
+  800f8b:	6a 54                	push   $0x54
+  800f8d:	68 d2 4a 80 00       	push   $0x804ad2
+  800f92:	e8 87 2c 00 00       	call   803c1e <_panic>
+
+00800f97 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fa6:	89 d1                	mov    %edx,%ecx
+  800fa8:	89 d3                	mov    %edx,%ebx
+  800faa:	89 d7                	mov    %edx,%edi
+  800fac:	6a 00                	push   $0x0
+  800fae:	55                   	push   %ebp
+  800faf:	56                   	push   %esi
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	8d 35 ba 0f 80 00    	lea    0x800fba,%esi
+  800fb8:	0f 34                	sysenter
+
+00800fba <after_sysenter_label_1939>:
+  800fba:	5e                   	pop    %esi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800fbf:	5b                   	pop    %ebx
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+
+00800fc3 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	57                   	push   %edi
+  800fc7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fce:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdb:	6a 00                	push   $0x0
+  800fdd:	55                   	push   %ebp
+  800fde:	56                   	push   %esi
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	8d 35 e9 0f 80 00    	lea    0x800fe9,%esi
+  800fe7:	0f 34                	sysenter
+
+00800fe9 <after_sysenter_label_2028>:
+  800fe9:	5e                   	pop    %esi
+  800fea:	5d                   	pop    %ebp
+  800feb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801002:	b8 16 00 00 00       	mov    $0x16,%eax
+  801007:	89 df                	mov    %ebx,%edi
+  801009:	6a 00                	push   $0x0
+  80100b:	55                   	push   %ebp
+  80100c:	56                   	push   %esi
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	8d 35 17 10 80 00    	lea    0x801017,%esi
+  801015:	0f 34                	sysenter
+
+00801017 <after_sysenter_label_2114>:
+  801017:	5e                   	pop    %esi
+  801018:	5d                   	pop    %ebp
+  801019:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80101c:	5b                   	pop    %ebx
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+
+00801020 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 17 00 00 00       	mov    $0x17,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	6a 00                	push   $0x0
+  801039:	55                   	push   %ebp
+  80103a:	56                   	push   %esi
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	8d 35 45 10 80 00    	lea    0x801045,%esi
+  801043:	0f 34                	sysenter
+
+00801045 <after_sysenter_label_2200>:
+  801045:	5e                   	pop    %esi
+  801046:	5d                   	pop    %ebp
+  801047:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80104a:	5b                   	pop    %ebx
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+
+0080104e <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	57                   	push   %edi
+  801052:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801053:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801063:	89 df                	mov    %ebx,%edi
+  801065:	6a 00                	push   $0x0
+  801067:	55                   	push   %ebp
+  801068:	56                   	push   %esi
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	8d 35 73 10 80 00    	lea    0x801073,%esi
+  801071:	0f 34                	sysenter
+
+00801073 <after_sysenter_label_2286>:
+  801073:	5e                   	pop    %esi
+  801074:	5d                   	pop    %ebp
+  801075:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801078:	5b                   	pop    %ebx
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+
+0080107c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801082:	83 3d c4 62 80 00 00 	cmpl   $0x0,0x8062c4
+  801089:	74 0a                	je     801095 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80108b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108e:	a3 c4 62 80 00       	mov    %eax,0x8062c4
+}
+  801093:	c9                   	leave
+  801094:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  801095:	83 ec 04             	sub    $0x4,%esp
+  801098:	6a 07                	push   $0x7
+  80109a:	68 00 f0 bf ee       	push   $0xeebff000
+  80109f:	6a 00                	push   $0x0
+  8010a1:	e8 34 fb ff ff       	call   800bda <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8010a6:	83 c4 08             	add    $0x8,%esp
+  8010a9:	68 ba 10 80 00       	push   $0x8010ba
+  8010ae:	6a 00                	push   $0x0
+  8010b0:	e8 a2 fc ff ff       	call   800d57 <sys_env_set_pgfault_upcall>
+  8010b5:	83 c4 10             	add    $0x10,%esp
+  8010b8:	eb d1                	jmp    80108b <set_pgfault_handler+0xf>
+
+008010ba <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8010ba:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8010bb:	a1 c4 62 80 00       	mov    0x8062c4,%eax
+	call *%eax
+  8010c0:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8010c2:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8010c5:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8010c9:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8010cd:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8010d0:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8010d4:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8010d6:	83 c4 08             	add    $0x8,%esp
+	popal
+  8010d9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8010da:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8010dd:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8010de:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8010df:	c3                   	ret
+
+008010e0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010eb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+
+008010f0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801100:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801105:	5d                   	pop    %ebp
+  801106:	c3                   	ret
+
+00801107 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80110a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80110f:	eb 02                	jmp    801113 <fd_alloc+0xc>
+  801111:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801113:	89 c2                	mov    %eax,%edx
+  801115:	c1 ea 16             	shr    $0x16,%edx
+  801118:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80111f:	f6 c2 01             	test   $0x1,%dl
+  801122:	74 2b                	je     80114f <fd_alloc+0x48>
+  801124:	89 c2                	mov    %eax,%edx
+  801126:	c1 ea 0c             	shr    $0xc,%edx
+  801129:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801130:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801136:	f6 c1 01             	test   $0x1,%cl
+  801139:	74 14                	je     80114f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80113b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801141:	75 ce                	jne    801111 <fd_alloc+0xa>
+  801143:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801148:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80114d:	eb 05                	jmp    801154 <fd_alloc+0x4d>
+			return 0;
+  80114f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	89 02                	mov    %eax,(%edx)
+}
+  801159:	89 c8                	mov    %ecx,%eax
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+
+0080115d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801163:	83 f8 1f             	cmp    $0x1f,%eax
+  801166:	77 30                	ja     801198 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801168:	c1 e0 0c             	shl    $0xc,%eax
+  80116b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801170:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801176:	f6 c2 01             	test   $0x1,%dl
+  801179:	74 24                	je     80119f <fd_lookup+0x42>
+  80117b:	89 c2                	mov    %eax,%edx
+  80117d:	c1 ea 0c             	shr    $0xc,%edx
+  801180:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801187:	f6 c2 01             	test   $0x1,%dl
+  80118a:	74 1a                	je     8011a6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80118c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80118f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801196:	5d                   	pop    %ebp
+  801197:	c3                   	ret
+		return -E_INVAL;
+  801198:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80119d:	eb f7                	jmp    801196 <fd_lookup+0x39>
+		return -E_INVAL;
+  80119f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011a4:	eb f0                	jmp    801196 <fd_lookup+0x39>
+  8011a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ab:	eb e9                	jmp    801196 <fd_lookup+0x39>
+
+008011ad <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	53                   	push   %ebx
+  8011b1:	83 ec 04             	sub    $0x4,%esp
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bc:	eb 03                	jmp    8011c1 <dev_lookup+0x14>
+  8011be:	83 c0 01             	add    $0x1,%eax
+  8011c1:	8b 1c 85 5c 4b 80 00 	mov    0x804b5c(,%eax,4),%ebx
+  8011c8:	85 db                	test   %ebx,%ebx
+  8011ca:	74 0b                	je     8011d7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011cc:	39 13                	cmp    %edx,(%ebx)
+  8011ce:	75 ee                	jne    8011be <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d5:	eb 49                	jmp    801220 <dev_lookup+0x73>
+  8011d7:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8011d9:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8011df:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8011e4:	77 18                	ja     8011fe <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8011e6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8011eb:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8011ed:	c1 e8 10             	shr    $0x10,%eax
+  8011f0:	74 0c                	je     8011fe <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8011f2:	c1 e0 10             	shl    $0x10,%eax
+  8011f5:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8011fa:	29 c1                	sub    %eax,%ecx
+  8011fc:	eb 06                	jmp    801204 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8011fe:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801204:	8b 01                	mov    (%ecx),%eax
+  801206:	8b 40 48             	mov    0x48(%eax),%eax
+  801209:	83 ec 04             	sub    $0x4,%esp
+  80120c:	52                   	push   %edx
+  80120d:	50                   	push   %eax
+  80120e:	68 e0 4a 80 00       	push   $0x804ae0
+  801213:	e8 a0 ef ff ff       	call   8001b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801218:	83 c4 10             	add    $0x10,%esp
+  80121b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801220:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801223:	89 1a                	mov    %ebx,(%edx)
+}
+  801225:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801228:	c9                   	leave
+  801229:	c3                   	ret
+
+0080122a <fd_close>:
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	57                   	push   %edi
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+  801230:	83 ec 24             	sub    $0x24,%esp
+  801233:	8b 75 08             	mov    0x8(%ebp),%esi
+  801236:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801239:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80123c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80123d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801243:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801246:	50                   	push   %eax
+  801247:	e8 11 ff ff ff       	call   80115d <fd_lookup>
+  80124c:	89 c3                	mov    %eax,%ebx
+  80124e:	83 c4 10             	add    $0x10,%esp
+  801251:	85 c0                	test   %eax,%eax
+  801253:	78 05                	js     80125a <fd_close+0x30>
+	    || fd != fd2)
+  801255:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801258:	74 16                	je     801270 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80125a:	89 f8                	mov    %edi,%eax
+  80125c:	84 c0                	test   %al,%al
+  80125e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801263:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801266:	89 d8                	mov    %ebx,%eax
+  801268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801270:	83 ec 08             	sub    $0x8,%esp
+  801273:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801276:	50                   	push   %eax
+  801277:	ff 36                	push   (%esi)
+  801279:	e8 2f ff ff ff       	call   8011ad <dev_lookup>
+  80127e:	89 c3                	mov    %eax,%ebx
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	78 1a                	js     8012a1 <fd_close+0x77>
+		if (dev->dev_close)
+  801287:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80128a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80128d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801292:	85 c0                	test   %eax,%eax
+  801294:	74 0b                	je     8012a1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801296:	83 ec 0c             	sub    $0xc,%esp
+  801299:	56                   	push   %esi
+  80129a:	ff d0                	call   *%eax
+  80129c:	89 c3                	mov    %eax,%ebx
+  80129e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012a1:	83 ec 08             	sub    $0x8,%esp
+  8012a4:	56                   	push   %esi
+  8012a5:	6a 00                	push   $0x0
+  8012a7:	e8 c7 f9 ff ff       	call   800c73 <sys_page_unmap>
+	return r;
+  8012ac:	83 c4 10             	add    $0x10,%esp
+  8012af:	eb b5                	jmp    801266 <fd_close+0x3c>
+
+008012b1 <close>:
+
+int
+close(int fdnum)
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012ba:	50                   	push   %eax
+  8012bb:	ff 75 08             	push   0x8(%ebp)
+  8012be:	e8 9a fe ff ff       	call   80115d <fd_lookup>
+  8012c3:	83 c4 10             	add    $0x10,%esp
+  8012c6:	85 c0                	test   %eax,%eax
+  8012c8:	79 02                	jns    8012cc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012ca:	c9                   	leave
+  8012cb:	c3                   	ret
+		return fd_close(fd, 1);
+  8012cc:	83 ec 08             	sub    $0x8,%esp
+  8012cf:	6a 01                	push   $0x1
+  8012d1:	ff 75 f4             	push   -0xc(%ebp)
+  8012d4:	e8 51 ff ff ff       	call   80122a <fd_close>
+  8012d9:	83 c4 10             	add    $0x10,%esp
+  8012dc:	eb ec                	jmp    8012ca <close+0x19>
+
+008012de <close_all>:
+
+void
+close_all(void)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012ea:	83 ec 0c             	sub    $0xc,%esp
+  8012ed:	53                   	push   %ebx
+  8012ee:	e8 be ff ff ff       	call   8012b1 <close>
+	for (i = 0; i < MAXFD; i++)
+  8012f3:	83 c3 01             	add    $0x1,%ebx
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	83 fb 20             	cmp    $0x20,%ebx
+  8012fc:	75 ec                	jne    8012ea <close_all+0xc>
+}
+  8012fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801301:	c9                   	leave
+  801302:	c3                   	ret
+
+00801303 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	57                   	push   %edi
+  801307:	56                   	push   %esi
+  801308:	53                   	push   %ebx
+  801309:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80130c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80130f:	50                   	push   %eax
+  801310:	ff 75 08             	push   0x8(%ebp)
+  801313:	e8 45 fe ff ff       	call   80115d <fd_lookup>
+  801318:	89 c3                	mov    %eax,%ebx
+  80131a:	83 c4 10             	add    $0x10,%esp
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	78 7f                	js     8013a0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	ff 75 0c             	push   0xc(%ebp)
+  801327:	e8 85 ff ff ff       	call   8012b1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80132c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80132f:	c1 e6 0c             	shl    $0xc,%esi
+  801332:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801338:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80133b:	89 3c 24             	mov    %edi,(%esp)
+  80133e:	e8 ad fd ff ff       	call   8010f0 <fd2data>
+  801343:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801345:	89 34 24             	mov    %esi,(%esp)
+  801348:	e8 a3 fd ff ff       	call   8010f0 <fd2data>
+  80134d:	83 c4 10             	add    $0x10,%esp
+  801350:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801353:	89 d8                	mov    %ebx,%eax
+  801355:	c1 e8 16             	shr    $0x16,%eax
+  801358:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80135f:	a8 01                	test   $0x1,%al
+  801361:	74 11                	je     801374 <dup+0x71>
+  801363:	89 d8                	mov    %ebx,%eax
+  801365:	c1 e8 0c             	shr    $0xc,%eax
+  801368:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80136f:	f6 c2 01             	test   $0x1,%dl
+  801372:	75 36                	jne    8013aa <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801374:	89 f8                	mov    %edi,%eax
+  801376:	c1 e8 0c             	shr    $0xc,%eax
+  801379:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	25 07 0e 00 00       	and    $0xe07,%eax
+  801388:	50                   	push   %eax
+  801389:	56                   	push   %esi
+  80138a:	6a 00                	push   $0x0
+  80138c:	57                   	push   %edi
+  80138d:	6a 00                	push   $0x0
+  80138f:	e8 93 f8 ff ff       	call   800c27 <sys_page_map>
+  801394:	89 c3                	mov    %eax,%ebx
+  801396:	83 c4 20             	add    $0x20,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	78 33                	js     8013d0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80139d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013a0:	89 d8                	mov    %ebx,%eax
+  8013a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a5:	5b                   	pop    %ebx
+  8013a6:	5e                   	pop    %esi
+  8013a7:	5f                   	pop    %edi
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013aa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	ff 75 d4             	push   -0x2c(%ebp)
+  8013bd:	6a 00                	push   $0x0
+  8013bf:	53                   	push   %ebx
+  8013c0:	6a 00                	push   $0x0
+  8013c2:	e8 60 f8 ff ff       	call   800c27 <sys_page_map>
+  8013c7:	89 c3                	mov    %eax,%ebx
+  8013c9:	83 c4 20             	add    $0x20,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	79 a4                	jns    801374 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013d0:	83 ec 08             	sub    $0x8,%esp
+  8013d3:	56                   	push   %esi
+  8013d4:	6a 00                	push   $0x0
+  8013d6:	e8 98 f8 ff ff       	call   800c73 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013db:	83 c4 08             	add    $0x8,%esp
+  8013de:	ff 75 d4             	push   -0x2c(%ebp)
+  8013e1:	6a 00                	push   $0x0
+  8013e3:	e8 8b f8 ff ff       	call   800c73 <sys_page_unmap>
+	return r;
+  8013e8:	83 c4 10             	add    $0x10,%esp
+  8013eb:	eb b3                	jmp    8013a0 <dup+0x9d>
+
+008013ed <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	56                   	push   %esi
+  8013f1:	53                   	push   %ebx
+  8013f2:	83 ec 18             	sub    $0x18,%esp
+  8013f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013fb:	50                   	push   %eax
+  8013fc:	53                   	push   %ebx
+  8013fd:	e8 5b fd ff ff       	call   80115d <fd_lookup>
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 3c                	js     801445 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801409:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80140c:	83 ec 08             	sub    $0x8,%esp
+  80140f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801412:	50                   	push   %eax
+  801413:	ff 36                	push   (%esi)
+  801415:	e8 93 fd ff ff       	call   8011ad <dev_lookup>
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	78 24                	js     801445 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801421:	8b 46 08             	mov    0x8(%esi),%eax
+  801424:	83 e0 03             	and    $0x3,%eax
+  801427:	83 f8 01             	cmp    $0x1,%eax
+  80142a:	74 20                	je     80144c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80142c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80142f:	8b 40 08             	mov    0x8(%eax),%eax
+  801432:	85 c0                	test   %eax,%eax
+  801434:	74 61                	je     801497 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801436:	83 ec 04             	sub    $0x4,%esp
+  801439:	ff 75 10             	push   0x10(%ebp)
+  80143c:	ff 75 0c             	push   0xc(%ebp)
+  80143f:	56                   	push   %esi
+  801440:	ff d0                	call   *%eax
+  801442:	83 c4 10             	add    $0x10,%esp
+}
+  801445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+  80144c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80144e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801454:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801459:	77 18                	ja     801473 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80145b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801460:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801462:	c1 e8 10             	shr    $0x10,%eax
+  801465:	74 0c                	je     801473 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801467:	c1 e0 10             	shl    $0x10,%eax
+  80146a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80146f:	29 c2                	sub    %eax,%edx
+  801471:	eb 06                	jmp    801479 <read+0x8c>
+		return pthread_main_tls;
+  801473:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801479:	8b 02                	mov    (%edx),%eax
+  80147b:	8b 40 48             	mov    0x48(%eax),%eax
+  80147e:	83 ec 04             	sub    $0x4,%esp
+  801481:	53                   	push   %ebx
+  801482:	50                   	push   %eax
+  801483:	68 21 4b 80 00       	push   $0x804b21
+  801488:	e8 2b ed ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801495:	eb ae                	jmp    801445 <read+0x58>
+		return -E_NOT_SUPP;
+  801497:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149c:	eb a7                	jmp    801445 <read+0x58>
+
+0080149e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014aa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b2:	eb 02                	jmp    8014b6 <readn+0x18>
+  8014b4:	01 c3                	add    %eax,%ebx
+  8014b6:	39 f3                	cmp    %esi,%ebx
+  8014b8:	73 21                	jae    8014db <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014ba:	83 ec 04             	sub    $0x4,%esp
+  8014bd:	89 f0                	mov    %esi,%eax
+  8014bf:	29 d8                	sub    %ebx,%eax
+  8014c1:	50                   	push   %eax
+  8014c2:	89 d8                	mov    %ebx,%eax
+  8014c4:	03 45 0c             	add    0xc(%ebp),%eax
+  8014c7:	50                   	push   %eax
+  8014c8:	57                   	push   %edi
+  8014c9:	e8 1f ff ff ff       	call   8013ed <read>
+		if (m < 0)
+  8014ce:	83 c4 10             	add    $0x10,%esp
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	78 04                	js     8014d9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014d5:	75 dd                	jne    8014b4 <readn+0x16>
+  8014d7:	eb 02                	jmp    8014db <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014d9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014db:	89 d8                	mov    %ebx,%eax
+  8014dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e0:	5b                   	pop    %ebx
+  8014e1:	5e                   	pop    %esi
+  8014e2:	5f                   	pop    %edi
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	c3                   	ret
+
+008014e5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	56                   	push   %esi
+  8014e9:	53                   	push   %ebx
+  8014ea:	83 ec 18             	sub    $0x18,%esp
+  8014ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f3:	50                   	push   %eax
+  8014f4:	53                   	push   %ebx
+  8014f5:	e8 63 fc ff ff       	call   80115d <fd_lookup>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 37                	js     801538 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801501:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801504:	83 ec 08             	sub    $0x8,%esp
+  801507:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150a:	50                   	push   %eax
+  80150b:	ff 36                	push   (%esi)
+  80150d:	e8 9b fc ff ff       	call   8011ad <dev_lookup>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 1f                	js     801538 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801519:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80151d:	74 20                	je     80153f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80151f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801522:	8b 40 0c             	mov    0xc(%eax),%eax
+  801525:	85 c0                	test   %eax,%eax
+  801527:	74 61                	je     80158a <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801529:	83 ec 04             	sub    $0x4,%esp
+  80152c:	ff 75 10             	push   0x10(%ebp)
+  80152f:	ff 75 0c             	push   0xc(%ebp)
+  801532:	56                   	push   %esi
+  801533:	ff d0                	call   *%eax
+  801535:	83 c4 10             	add    $0x10,%esp
+}
+  801538:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+  80153f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801541:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801547:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80154c:	77 18                	ja     801566 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80154e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801553:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801555:	c1 e8 10             	shr    $0x10,%eax
+  801558:	74 0c                	je     801566 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80155a:	c1 e0 10             	shl    $0x10,%eax
+  80155d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801562:	29 c2                	sub    %eax,%edx
+  801564:	eb 06                	jmp    80156c <write+0x87>
+		return pthread_main_tls;
+  801566:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80156c:	8b 02                	mov    (%edx),%eax
+  80156e:	8b 40 48             	mov    0x48(%eax),%eax
+  801571:	83 ec 04             	sub    $0x4,%esp
+  801574:	53                   	push   %ebx
+  801575:	50                   	push   %eax
+  801576:	68 3d 4b 80 00       	push   $0x804b3d
+  80157b:	e8 38 ec ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801580:	83 c4 10             	add    $0x10,%esp
+  801583:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801588:	eb ae                	jmp    801538 <write+0x53>
+		return -E_NOT_SUPP;
+  80158a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80158f:	eb a7                	jmp    801538 <write+0x53>
+
+00801591 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801597:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 75 08             	push   0x8(%ebp)
+  80159e:	e8 ba fb ff ff       	call   80115d <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 0e                	js     8015b8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015b8:	c9                   	leave
+  8015b9:	c3                   	ret
+
+008015ba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+  8015bf:	83 ec 18             	sub    $0x18,%esp
+  8015c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015c8:	50                   	push   %eax
+  8015c9:	53                   	push   %ebx
+  8015ca:	e8 8e fb ff ff       	call   80115d <fd_lookup>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	78 34                	js     80160a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015d9:	83 ec 08             	sub    $0x8,%esp
+  8015dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015df:	50                   	push   %eax
+  8015e0:	ff 36                	push   (%esi)
+  8015e2:	e8 c6 fb ff ff       	call   8011ad <dev_lookup>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	85 c0                	test   %eax,%eax
+  8015ec:	78 1c                	js     80160a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015ee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015f2:	74 1d                	je     801611 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f7:	8b 40 18             	mov    0x18(%eax),%eax
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	74 5e                	je     80165c <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015fe:	83 ec 08             	sub    $0x8,%esp
+  801601:	ff 75 0c             	push   0xc(%ebp)
+  801604:	56                   	push   %esi
+  801605:	ff d0                	call   *%eax
+  801607:	83 c4 10             	add    $0x10,%esp
+}
+  80160a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+  801611:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801613:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801619:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80161e:	77 18                	ja     801638 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801620:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801625:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801627:	c1 e8 10             	shr    $0x10,%eax
+  80162a:	74 0c                	je     801638 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80162c:	c1 e0 10             	shl    $0x10,%eax
+  80162f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801634:	29 c2                	sub    %eax,%edx
+  801636:	eb 06                	jmp    80163e <ftruncate+0x84>
+		return pthread_main_tls;
+  801638:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  80163e:	8b 02                	mov    (%edx),%eax
+  801640:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801643:	83 ec 04             	sub    $0x4,%esp
+  801646:	53                   	push   %ebx
+  801647:	50                   	push   %eax
+  801648:	68 00 4b 80 00       	push   $0x804b00
+  80164d:	e8 66 eb ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165a:	eb ae                	jmp    80160a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80165c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801661:	eb a7                	jmp    80160a <ftruncate+0x50>
+
+00801663 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 18             	sub    $0x18,%esp
+  80166b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80166e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801671:	50                   	push   %eax
+  801672:	ff 75 08             	push   0x8(%ebp)
+  801675:	e8 e3 fa ff ff       	call   80115d <fd_lookup>
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	78 49                	js     8016ca <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801681:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801684:	83 ec 08             	sub    $0x8,%esp
+  801687:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168a:	50                   	push   %eax
+  80168b:	ff 36                	push   (%esi)
+  80168d:	e8 1b fb ff ff       	call   8011ad <dev_lookup>
+  801692:	83 c4 10             	add    $0x10,%esp
+  801695:	85 c0                	test   %eax,%eax
+  801697:	78 31                	js     8016ca <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801699:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016a0:	74 2f                	je     8016d1 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016a2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016a5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ac:	00 00 00 
+	stat->st_isdir = 0;
+  8016af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016b6:	00 00 00 
+	stat->st_dev = dev;
+  8016b9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016bf:	83 ec 08             	sub    $0x8,%esp
+  8016c2:	53                   	push   %ebx
+  8016c3:	56                   	push   %esi
+  8016c4:	ff 50 14             	call   *0x14(%eax)
+  8016c7:	83 c4 10             	add    $0x10,%esp
+}
+  8016ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cd:	5b                   	pop    %ebx
+  8016ce:	5e                   	pop    %esi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d6:	eb f2                	jmp    8016ca <fstat+0x67>
+
+008016d8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016d8:	55                   	push   %ebp
+  8016d9:	89 e5                	mov    %esp,%ebp
+  8016db:	56                   	push   %esi
+  8016dc:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8016dd:	83 ec 08             	sub    $0x8,%esp
+  8016e0:	6a 00                	push   $0x0
+  8016e2:	ff 75 08             	push   0x8(%ebp)
+  8016e5:	e8 4b 03 00 00       	call   801a35 <open>
+  8016ea:	89 c3                	mov    %eax,%ebx
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	78 1b                	js     80170e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016f3:	83 ec 08             	sub    $0x8,%esp
+  8016f6:	ff 75 0c             	push   0xc(%ebp)
+  8016f9:	50                   	push   %eax
+  8016fa:	e8 64 ff ff ff       	call   801663 <fstat>
+  8016ff:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801701:	89 1c 24             	mov    %ebx,(%esp)
+  801704:	e8 a8 fb ff ff       	call   8012b1 <close>
+	return r;
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	89 f3                	mov    %esi,%ebx
+}
+  80170e:	89 d8                	mov    %ebx,%eax
+  801710:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5d                   	pop    %ebp
+  801716:	c3                   	ret
+
+00801717 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	56                   	push   %esi
+  80171b:	53                   	push   %ebx
+  80171c:	89 c6                	mov    %eax,%esi
+  80171e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801720:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801727:	74 27                	je     801750 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801729:	6a 07                	push   $0x7
+  80172b:	68 00 70 80 00       	push   $0x807000
+  801730:	56                   	push   %esi
+  801731:	ff 35 00 60 80 00    	push   0x806000
+  801737:	e8 94 2c 00 00       	call   8043d0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80173c:	83 c4 0c             	add    $0xc,%esp
+  80173f:	6a 00                	push   $0x0
+  801741:	53                   	push   %ebx
+  801742:	6a 00                	push   $0x0
+  801744:	e8 91 2b 00 00       	call   8042da <ipc_recv>
+}
+  801749:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801750:	83 ec 0c             	sub    $0xc,%esp
+  801753:	6a 01                	push   $0x1
+  801755:	e8 cc 2c 00 00       	call   804426 <ipc_find_env>
+  80175a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	eb c5                	jmp    801729 <fsipc+0x12>
+
+00801764 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	53                   	push   %ebx
+  801768:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80176b:	68 04 60 80 00       	push   $0x806004
+  801770:	e8 29 1b 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801775:	8b 45 08             	mov    0x8(%ebp),%eax
+  801778:	8b 40 0c             	mov    0xc(%eax),%eax
+  80177b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801780:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801783:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80178d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801792:	e8 80 ff ff ff       	call   801717 <fsipc>
+  801797:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801799:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017a0:	e8 66 1b 00 00       	call   80330b <mutex_unlock>
+	return r;
+}
+  8017a5:	89 d8                	mov    %ebx,%eax
+  8017a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+008017ac <devfile_flush>:
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	53                   	push   %ebx
+  8017b0:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8017b3:	68 04 60 80 00       	push   $0x806004
+  8017b8:	e8 e1 1a 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017c3:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8017c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017d2:	e8 40 ff ff ff       	call   801717 <fsipc>
+  8017d7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017d9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017e0:	e8 26 1b 00 00       	call   80330b <mutex_unlock>
+}
+  8017e5:	89 d8                	mov    %ebx,%eax
+  8017e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+
+008017ec <devfile_stat>:
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+  8017f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8017f4:	83 ec 0c             	sub    $0xc,%esp
+  8017f7:	68 04 60 80 00       	push   $0x806004
+  8017fc:	e8 9d 1a 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801801:	8b 45 08             	mov    0x8(%ebp),%eax
+  801804:	8b 40 0c             	mov    0xc(%eax),%eax
+  801807:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	b8 05 00 00 00       	mov    $0x5,%eax
+  801816:	e8 fc fe ff ff       	call   801717 <fsipc>
+  80181b:	89 c3                	mov    %eax,%ebx
+  80181d:	83 c4 10             	add    $0x10,%esp
+  801820:	85 c0                	test   %eax,%eax
+  801822:	79 16                	jns    80183a <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801824:	83 ec 0c             	sub    $0xc,%esp
+  801827:	68 04 60 80 00       	push   $0x806004
+  80182c:	e8 da 1a 00 00       	call   80330b <mutex_unlock>
+}
+  801831:	89 d8                	mov    %ebx,%eax
+  801833:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801836:	5b                   	pop    %ebx
+  801837:	5e                   	pop    %esi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80183a:	83 ec 08             	sub    $0x8,%esp
+  80183d:	68 00 70 80 00       	push   $0x807000
+  801842:	56                   	push   %esi
+  801843:	e8 54 ef ff ff       	call   80079c <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801848:	a1 80 70 80 00       	mov    0x807080,%eax
+  80184d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801853:	a1 84 70 80 00       	mov    0x807084,%eax
+  801858:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80185e:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801861:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801866:	eb bc                	jmp    801824 <devfile_stat+0x38>
+
+00801868 <devfile_write>:
+{
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	53                   	push   %ebx
+  80186c:	83 ec 10             	sub    $0x10,%esp
+  80186f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801872:	68 04 60 80 00       	push   $0x806004
+  801877:	e8 22 1a 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80187c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801882:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801890:	76 3d                	jbe    8018cf <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801892:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801897:	39 c3                	cmp    %eax,%ebx
+  801899:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80189c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80189f:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  8018a4:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8018aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018b4:	e8 5e fe ff ff       	call   801717 <fsipc>
+  8018b9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018bb:	83 ec 0c             	sub    $0xc,%esp
+  8018be:	68 04 60 80 00       	push   $0x806004
+  8018c3:	e8 43 1a 00 00       	call   80330b <mutex_unlock>
+}
+  8018c8:	89 d8                	mov    %ebx,%eax
+  8018ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8018cf:	83 ec 04             	sub    $0x4,%esp
+  8018d2:	53                   	push   %ebx
+  8018d3:	ff 75 0c             	push   0xc(%ebp)
+  8018d6:	68 0c 70 80 00       	push   $0x80700c
+  8018db:	e8 42 f0 ff ff       	call   800922 <memmove>
+  8018e0:	83 c4 10             	add    $0x10,%esp
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	eb b5                	jmp    80189f <devfile_write+0x37>
+
+008018ea <devfile_read>:
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	57                   	push   %edi
+  8018ee:	56                   	push   %esi
+  8018ef:	53                   	push   %ebx
+  8018f0:	83 ec 0c             	sub    $0xc,%esp
+  8018f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8018fc:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801902:	0f 86 8c 00 00 00    	jbe    801994 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801908:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80190d:	39 c3                	cmp    %eax,%ebx
+  80190f:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801912:	89 f8                	mov    %edi,%eax
+  801914:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801917:	eb 0f                	jmp    801928 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801919:	0f b6 08             	movzbl (%eax),%ecx
+  80191c:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80191e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801923:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801928:	39 d0                	cmp    %edx,%eax
+  80192a:	72 ed                	jb     801919 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80192c:	83 ec 0c             	sub    $0xc,%esp
+  80192f:	68 04 60 80 00       	push   $0x806004
+  801934:	e8 65 19 00 00       	call   80329e <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801939:	8b 46 0c             	mov    0xc(%esi),%eax
+  80193c:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801941:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801947:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  80194d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801952:	b8 03 00 00 00       	mov    $0x3,%eax
+  801957:	e8 bb fd ff ff       	call   801717 <fsipc>
+  80195c:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80195e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801965:	e8 a1 19 00 00       	call   80330b <mutex_unlock>
+		assert(r <= (int) n);
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	39 f3                	cmp    %esi,%ebx
+  80196f:	7c 0a                	jl     80197b <devfile_read+0x91>
+}
+  801971:	89 f0                	mov    %esi,%eax
+  801973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801976:	5b                   	pop    %ebx
+  801977:	5e                   	pop    %esi
+  801978:	5f                   	pop    %edi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+		assert(r <= (int) n);
+  80197b:	68 70 4b 80 00       	push   $0x804b70
+  801980:	68 7d 4b 80 00       	push   $0x804b7d
+  801985:	68 90 00 00 00       	push   $0x90
+  80198a:	68 92 4b 80 00       	push   $0x804b92
+  80198f:	e8 8a 22 00 00       	call   803c1e <_panic>
+	mutex_lock(&fsipc_mu);
+  801994:	83 ec 0c             	sub    $0xc,%esp
+  801997:	68 04 60 80 00       	push   $0x806004
+  80199c:	e8 fd 18 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019a1:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019a4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019a9:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  8019af:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8019b6:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8019b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019c3:	e8 4f fd ff ff       	call   801717 <fsipc>
+  8019c8:	89 c6                	mov    %eax,%esi
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 1d                	js     8019ee <devfile_read+0x104>
+		assert(r <= n);
+  8019d1:	39 c3                	cmp    %eax,%ebx
+  8019d3:	72 2e                	jb     801a03 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8019d5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019da:	7f 40                	jg     801a1c <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019dc:	83 ec 04             	sub    $0x4,%esp
+  8019df:	50                   	push   %eax
+  8019e0:	68 00 70 80 00       	push   $0x807000
+  8019e5:	57                   	push   %edi
+  8019e6:	e8 37 ef ff ff       	call   800922 <memmove>
+  8019eb:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+  8019f1:	68 04 60 80 00       	push   $0x806004
+  8019f6:	e8 10 19 00 00       	call   80330b <mutex_unlock>
+	return r;
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	e9 6e ff ff ff       	jmp    801971 <devfile_read+0x87>
+		assert(r <= n);
+  801a03:	68 9d 4b 80 00       	push   $0x804b9d
+  801a08:	68 7d 4b 80 00       	push   $0x804b7d
+  801a0d:	68 99 00 00 00       	push   $0x99
+  801a12:	68 92 4b 80 00       	push   $0x804b92
+  801a17:	e8 02 22 00 00       	call   803c1e <_panic>
+		assert(r <= PGSIZE);
+  801a1c:	68 a4 4b 80 00       	push   $0x804ba4
+  801a21:	68 7d 4b 80 00       	push   $0x804b7d
+  801a26:	68 9a 00 00 00       	push   $0x9a
+  801a2b:	68 92 4b 80 00       	push   $0x804b92
+  801a30:	e8 e9 21 00 00       	call   803c1e <_panic>
+
+00801a35 <open>:
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	56                   	push   %esi
+  801a39:	53                   	push   %ebx
+  801a3a:	83 ec 1c             	sub    $0x1c,%esp
+  801a3d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a40:	56                   	push   %esi
+  801a41:	e8 1b ed ff ff       	call   800761 <strlen>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a4e:	0f 8f 85 00 00 00    	jg     801ad9 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	e8 a7 f6 ff ff       	call   801107 <fd_alloc>
+  801a60:	89 c3                	mov    %eax,%ebx
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	78 55                	js     801abe <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801a69:	83 ec 0c             	sub    $0xc,%esp
+  801a6c:	68 04 60 80 00       	push   $0x806004
+  801a71:	e8 28 18 00 00       	call   80329e <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a76:	83 c4 08             	add    $0x8,%esp
+  801a79:	56                   	push   %esi
+  801a7a:	68 00 70 80 00       	push   $0x807000
+  801a7f:	e8 18 ed ff ff       	call   80079c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a87:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801a8c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a94:	e8 7e fc ff ff       	call   801717 <fsipc>
+  801a99:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a9b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801aa2:	e8 64 18 00 00       	call   80330b <mutex_unlock>
+	if (r < 0) {
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	85 db                	test   %ebx,%ebx
+  801aac:	78 19                	js     801ac7 <open+0x92>
+	return fd2num(fd);
+  801aae:	83 ec 0c             	sub    $0xc,%esp
+  801ab1:	ff 75 f4             	push   -0xc(%ebp)
+  801ab4:	e8 27 f6 ff ff       	call   8010e0 <fd2num>
+  801ab9:	89 c3                	mov    %eax,%ebx
+  801abb:	83 c4 10             	add    $0x10,%esp
+}
+  801abe:	89 d8                	mov    %ebx,%eax
+  801ac0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac3:	5b                   	pop    %ebx
+  801ac4:	5e                   	pop    %esi
+  801ac5:	5d                   	pop    %ebp
+  801ac6:	c3                   	ret
+		fd_close(fd, 0);
+  801ac7:	83 ec 08             	sub    $0x8,%esp
+  801aca:	6a 00                	push   $0x0
+  801acc:	ff 75 f4             	push   -0xc(%ebp)
+  801acf:	e8 56 f7 ff ff       	call   80122a <fd_close>
+		return r;
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	eb e5                	jmp    801abe <open+0x89>
+		return -E_BAD_PATH;
+  801ad9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ade:	eb de                	jmp    801abe <open+0x89>
+
+00801ae0 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ae7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aea:	50                   	push   %eax
+  801aeb:	ff 75 08             	push   0x8(%ebp)
+  801aee:	e8 6a f6 ff ff       	call   80115d <fd_lookup>
+  801af3:	89 c3                	mov    %eax,%ebx
+  801af5:	83 c4 10             	add    $0x10,%esp
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 5b                	js     801b57 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aff:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b05:	39 08                	cmp    %ecx,(%eax)
+  801b07:	75 55                	jne    801b5e <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b09:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b0d:	74 56                	je     801b65 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b0f:	83 ec 0c             	sub    $0xc,%esp
+  801b12:	68 04 60 80 00       	push   $0x806004
+  801b17:	e8 82 17 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b22:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b2a:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801b2f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b32:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b41:	e8 d1 fb ff ff       	call   801717 <fsipc>
+  801b46:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b48:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b4f:	e8 b7 17 00 00       	call   80330b <mutex_unlock>
+	return r;
+  801b54:	83 c4 10             	add    $0x10,%esp
+}
+  801b57:	89 d8                	mov    %ebx,%eax
+  801b59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5c:	c9                   	leave
+  801b5d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b5e:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801b63:	eb f2                	jmp    801b57 <fallocate+0x77>
+		return -E_INVAL;
+  801b65:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801b6a:	eb eb                	jmp    801b57 <fallocate+0x77>
+
+00801b6c <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	56                   	push   %esi
+  801b70:	53                   	push   %ebx
+  801b71:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b74:	89 f3                	mov    %esi,%ebx
+  801b76:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b7c:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b7f:	eb 06                	jmp    801b87 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b81:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b87:	39 f3                	cmp    %esi,%ebx
+  801b89:	73 14                	jae    801b9f <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801b8b:	83 ec 08             	sub    $0x8,%esp
+  801b8e:	53                   	push   %ebx
+  801b8f:	6a 00                	push   $0x0
+  801b91:	e8 dd f0 ff ff       	call   800c73 <sys_page_unmap>
+  801b96:	83 c4 10             	add    $0x10,%esp
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	79 e4                	jns    801b81 <munmap+0x15>
+  801b9d:	eb 05                	jmp    801ba4 <munmap+0x38>
+			return r;
+	return 0;
+  801b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5d                   	pop    %ebp
+  801baa:	c3                   	ret
+
+00801bab <mmap>:
+{
+  801bab:	55                   	push   %ebp
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	57                   	push   %edi
+  801baf:	56                   	push   %esi
+  801bb0:	53                   	push   %ebx
+  801bb1:	83 ec 24             	sub    $0x24,%esp
+  801bb4:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bb7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bba:	50                   	push   %eax
+  801bbb:	ff 75 08             	push   0x8(%ebp)
+  801bbe:	e8 9a f5 ff ff       	call   80115d <fd_lookup>
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	0f 88 37 01 00 00    	js     801d05 <mmap+0x15a>
+		return NULL;
+  801bce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bd3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bd6:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801bdc:	39 0a                	cmp    %ecx,(%edx)
+  801bde:	0f 85 05 01 00 00    	jne    801ce9 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801be4:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801beb:	0f 85 1b 01 00 00    	jne    801d0c <mmap+0x161>
+  801bf1:	89 f0                	mov    %esi,%eax
+  801bf3:	83 e8 01             	sub    $0x1,%eax
+  801bf6:	0f 88 17 01 00 00    	js     801d13 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801bfc:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c00:	75 28                	jne    801c2a <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c02:	83 ec 0c             	sub    $0xc,%esp
+  801c05:	68 04 60 80 00       	push   $0x806004
+  801c0a:	e8 8f 16 00 00       	call   80329e <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c0f:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c15:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c23:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c28:	eb 2b                	jmp    801c55 <mmap+0xaa>
+		cow_enable();
+  801c2a:	e8 3a 22 00 00       	call   803e69 <cow_enable>
+  801c2f:	eb d1                	jmp    801c02 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c31:	89 c2                	mov    %eax,%edx
+  801c33:	c1 ea 0c             	shr    $0xc,%edx
+  801c36:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c3d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c43:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801c49:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801c4c:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c4e:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801c53:	77 25                	ja     801c7a <mmap+0xcf>
+  801c55:	89 c2                	mov    %eax,%edx
+  801c57:	29 da                	sub    %ebx,%edx
+  801c59:	39 ca                	cmp    %ecx,%edx
+  801c5b:	73 3a                	jae    801c97 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c5d:	89 c2                	mov    %eax,%edx
+  801c5f:	c1 ea 16             	shr    $0x16,%edx
+  801c62:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c69:	f6 c2 01             	test   $0x1,%dl
+  801c6c:	75 c3                	jne    801c31 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801c6e:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801c73:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801c78:	eb d4                	jmp    801c4e <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801c7a:	29 d8                	sub    %ebx,%eax
+  801c7c:	39 c8                	cmp    %ecx,%eax
+  801c7e:	73 17                	jae    801c97 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801c80:	83 ec 0c             	sub    $0xc,%esp
+  801c83:	68 04 60 80 00       	push   $0x806004
+  801c88:	e8 7e 16 00 00       	call   80330b <mutex_unlock>
+		return NULL;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c95:	eb 52                	jmp    801ce9 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c97:	85 db                	test   %ebx,%ebx
+  801c99:	74 e5                	je     801c80 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c9b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca1:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801ca6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ca9:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801cae:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801cb4:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801cba:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cbd:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ccc:	e8 46 fa ff ff       	call   801717 <fsipc>
+  801cd1:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801cd3:	83 ec 0c             	sub    $0xc,%esp
+  801cd6:	68 04 60 80 00       	push   $0x806004
+  801cdb:	e8 2b 16 00 00       	call   80330b <mutex_unlock>
+	if (r < 0) {
+  801ce0:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801ce3:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801ce5:	85 ff                	test   %edi,%edi
+  801ce7:	78 08                	js     801cf1 <mmap+0x146>
+}
+  801ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cec:	5b                   	pop    %ebx
+  801ced:	5e                   	pop    %esi
+  801cee:	5f                   	pop    %edi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+		munmap((void*) va, len);
+  801cf1:	83 ec 08             	sub    $0x8,%esp
+  801cf4:	56                   	push   %esi
+  801cf5:	53                   	push   %ebx
+  801cf6:	e8 71 fe ff ff       	call   801b6c <munmap>
+		return NULL;
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d03:	eb e4                	jmp    801ce9 <mmap+0x13e>
+		return NULL;
+  801d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0a:	eb dd                	jmp    801ce9 <mmap+0x13e>
+		return NULL;
+  801d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d11:	eb d6                	jmp    801ce9 <mmap+0x13e>
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d18:	eb cf                	jmp    801ce9 <mmap+0x13e>
+
+00801d1a <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 10             	sub    $0x10,%esp
+  801d21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d24:	53                   	push   %ebx
+  801d25:	e8 37 ea ff ff       	call   800761 <strlen>
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d32:	7f 42                	jg     801d76 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d34:	83 ec 0c             	sub    $0xc,%esp
+  801d37:	68 04 60 80 00       	push   $0x806004
+  801d3c:	e8 5d 15 00 00       	call   80329e <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d41:	83 c4 08             	add    $0x8,%esp
+  801d44:	53                   	push   %ebx
+  801d45:	68 00 70 80 00       	push   $0x807000
+  801d4a:	e8 4d ea ff ff       	call   80079c <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d54:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d59:	e8 b9 f9 ff ff       	call   801717 <fsipc>
+  801d5e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d60:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d67:	e8 9f 15 00 00       	call   80330b <mutex_unlock>
+	return r;
+  801d6c:	83 c4 10             	add    $0x10,%esp
+}
+  801d6f:	89 d8                	mov    %ebx,%eax
+  801d71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+		return -E_BAD_PATH;
+  801d76:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d7b:	eb f2                	jmp    801d6f <remove+0x55>
+
+00801d7d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	53                   	push   %ebx
+  801d81:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d84:	68 04 60 80 00       	push   $0x806004
+  801d89:	e8 10 15 00 00       	call   80329e <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801d8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d93:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d98:	e8 7a f9 ff ff       	call   801717 <fsipc>
+  801d9d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d9f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801da6:	e8 60 15 00 00       	call   80330b <mutex_unlock>
+	return r;
+}
+  801dab:	89 d8                	mov    %ebx,%eax
+  801dad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+00801db2 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801db2:	55                   	push   %ebp
+  801db3:	89 e5                	mov    %esp,%ebp
+  801db5:	56                   	push   %esi
+  801db6:	53                   	push   %ebx
+  801db7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+  801dbd:	68 04 60 80 00       	push   $0x806004
+  801dc2:	e8 d7 14 00 00       	call   80329e <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dca:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801dd9:	e8 39 f9 ff ff       	call   801717 <fsipc>
+  801dde:	89 c6                	mov    %eax,%esi
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	85 db                	test   %ebx,%ebx
+  801de5:	74 7b                	je     801e62 <fs_bcstat+0xb0>
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 77                	js     801e62 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801deb:	a1 00 70 80 00       	mov    0x807000,%eax
+  801df0:	89 03                	mov    %eax,(%ebx)
+  801df2:	a1 04 70 80 00       	mov    0x807004,%eax
+  801df7:	89 43 04             	mov    %eax,0x4(%ebx)
+  801dfa:	a1 08 70 80 00       	mov    0x807008,%eax
+  801dff:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e02:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e07:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e0a:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e0f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e12:	a1 14 70 80 00       	mov    0x807014,%eax
+  801e17:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e1a:	a1 18 70 80 00       	mov    0x807018,%eax
+  801e1f:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e22:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801e27:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e2a:	a1 20 70 80 00       	mov    0x807020,%eax
+  801e2f:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e32:	a1 24 70 80 00       	mov    0x807024,%eax
+  801e37:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e3a:	a1 28 70 80 00       	mov    0x807028,%eax
+  801e3f:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e42:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801e47:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801e4a:	a1 30 70 80 00       	mov    0x807030,%eax
+  801e4f:	89 43 30             	mov    %eax,0x30(%ebx)
+  801e52:	a1 34 70 80 00       	mov    0x807034,%eax
+  801e57:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e5a:	a1 38 70 80 00       	mov    0x807038,%eax
+  801e5f:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	68 04 60 80 00       	push   $0x806004
+  801e6a:	e8 9c 14 00 00       	call   80330b <mutex_unlock>
+	return r;
+}
+  801e6f:	89 f0                	mov    %esi,%eax
+  801e71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e74:	5b                   	pop    %ebx
+  801e75:	5e                   	pop    %esi
+  801e76:	5d                   	pop    %ebp
+  801e77:	c3                   	ret
+
+00801e78 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	56                   	push   %esi
+  801e7c:	53                   	push   %ebx
+  801e7d:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801e7f:	0f b6 10             	movzbl (%eax),%edx
+  801e82:	80 fa 72             	cmp    $0x72,%dl
+  801e85:	74 44                	je     801ecb <parse_mode+0x53>
+  801e87:	80 fa 77             	cmp    $0x77,%dl
+  801e8a:	74 4b                	je     801ed7 <parse_mode+0x5f>
+  801e8c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e91:	80 fa 61             	cmp    $0x61,%dl
+  801e94:	74 09                	je     801e9f <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801e96:	89 d8                	mov    %ebx,%eax
+  801e98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9b:	5b                   	pop    %ebx
+  801e9c:	5e                   	pop    %esi
+  801e9d:	5d                   	pop    %ebp
+  801e9e:	c3                   	ret
+	switch (mode[0]) {
+  801e9f:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801ea4:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801ea9:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801eab:	83 ec 08             	sub    $0x8,%esp
+  801eae:	6a 2b                	push   $0x2b
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 f8 e9 ff ff       	call   8008ae <strchr>
+  801eb6:	83 c4 10             	add    $0x10,%esp
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	74 d9                	je     801e96 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801ebd:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801ec0:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801ec3:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801ec9:	eb cb                	jmp    801e96 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801ecb:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ed0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ed5:	eb d2                	jmp    801ea9 <parse_mode+0x31>
+  801ed7:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801edc:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801ee1:	eb c6                	jmp    801ea9 <parse_mode+0x31>
+
+00801ee3 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	57                   	push   %edi
+  801ee7:	56                   	push   %esi
+  801ee8:	53                   	push   %ebx
+  801ee9:	83 ec 1c             	sub    $0x1c,%esp
+  801eec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eef:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801ef2:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801efc:	83 c0 24             	add    $0x24,%eax
+  801eff:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f03:	74 17                	je     801f1c <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f05:	83 c3 01             	add    $0x1,%ebx
+  801f08:	83 fb 10             	cmp    $0x10,%ebx
+  801f0b:	75 ef                	jne    801efc <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f0d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f12:	89 f0                	mov    %esi,%eax
+  801f14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f17:	5b                   	pop    %ebx
+  801f18:	5e                   	pop    %esi
+  801f19:	5f                   	pop    %edi
+  801f1a:	5d                   	pop    %ebp
+  801f1b:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f1c:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f23:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f26:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f29:	c1 e7 02             	shl    $0x2,%edi
+  801f2c:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801f32:	83 ec 04             	sub    $0x4,%esp
+  801f35:	6a 24                	push   $0x24
+  801f37:	6a 00                	push   $0x0
+  801f39:	56                   	push   %esi
+  801f3a:	e8 ae e9 ff ff       	call   8008ed <memset>
+			streams[i].f_fd = fd;
+  801f3f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f42:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801f48:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801f4b:	01 d8                	add    %ebx,%eax
+  801f4d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f50:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	eb b6                	jmp    801f12 <stream_alloc+0x2f>
+
+00801f5c <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	53                   	push   %ebx
+  801f60:	83 ec 14             	sub    $0x14,%esp
+  801f63:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801f65:	8b 40 18             	mov    0x18(%eax),%eax
+  801f68:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801f6b:	74 4a                	je     801fb7 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+  801f70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f73:	50                   	push   %eax
+  801f74:	ff 33                	push   (%ebx)
+  801f76:	e8 e2 f1 ff ff       	call   80115d <fd_lookup>
+  801f7b:	89 c2                	mov    %eax,%edx
+  801f7d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f80:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f85:	85 d2                	test   %edx,%edx
+  801f87:	78 41                	js     801fca <stream_unread+0x6e>
+  801f89:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f8c:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801f92:	39 0a                	cmp    %ecx,(%edx)
+  801f94:	75 34                	jne    801fca <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801f96:	8b 43 14             	mov    0x14(%ebx),%eax
+  801f99:	03 42 04             	add    0x4(%edx),%eax
+  801f9c:	2b 43 18             	sub    0x18(%ebx),%eax
+  801f9f:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801fa2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fa9:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb5:	eb 13                	jmp    801fca <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801fb7:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fbe:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801fc5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <stream_drain>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	56                   	push   %esi
+  801fd3:	53                   	push   %ebx
+  801fd4:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fdb:	eb 02                	jmp    801fdf <stream_drain+0x10>
+  801fdd:	01 c3                	add    %eax,%ebx
+  801fdf:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fe2:	39 c3                	cmp    %eax,%ebx
+  801fe4:	73 43                	jae    802029 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801fe6:	83 ec 04             	sub    $0x4,%esp
+  801fe9:	29 d8                	sub    %ebx,%eax
+  801feb:	50                   	push   %eax
+  801fec:	89 d8                	mov    %ebx,%eax
+  801fee:	03 46 0c             	add    0xc(%esi),%eax
+  801ff1:	50                   	push   %eax
+  801ff2:	ff 36                	push   (%esi)
+  801ff4:	e8 ec f4 ff ff       	call   8014e5 <write>
+  801ff9:	83 c4 10             	add    $0x10,%esp
+  801ffc:	85 c0                	test   %eax,%eax
+  801ffe:	7f dd                	jg     801fdd <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802000:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802004:	8b 56 0c             	mov    0xc(%esi),%edx
+  802007:	83 ec 04             	sub    $0x4,%esp
+  80200a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80200d:	29 d8                	sub    %ebx,%eax
+  80200f:	50                   	push   %eax
+  802010:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802013:	50                   	push   %eax
+  802014:	52                   	push   %edx
+  802015:	e8 08 e9 ff ff       	call   800922 <memmove>
+			f->f_wend -= done;
+  80201a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80201d:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802027:	eb 0a                	jmp    802033 <stream_drain+0x64>
+  802029:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802033:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802036:	89 d0                	mov    %edx,%eax
+  802038:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203b:	5b                   	pop    %ebx
+  80203c:	5e                   	pop    %esi
+  80203d:	5d                   	pop    %ebp
+  80203e:	c3                   	ret
+
+0080203f <stream_setup>:
+	if (f->f_buf)
+  80203f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802043:	74 01                	je     802046 <stream_setup+0x7>
+  802045:	c3                   	ret
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	53                   	push   %ebx
+  80204a:	83 ec 04             	sub    $0x4,%esp
+  80204d:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80204f:	8b 40 08             	mov    0x8(%eax),%eax
+  802052:	85 c0                	test   %eax,%eax
+  802054:	74 17                	je     80206d <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802056:	83 f8 03             	cmp    $0x3,%eax
+  802059:	75 2d                	jne    802088 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80205b:	8d 43 20             	lea    0x20(%ebx),%eax
+  80205e:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802061:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802068:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206b:	c9                   	leave
+  80206c:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	ff 33                	push   (%ebx)
+  802072:	e8 29 1b 00 00       	call   803ba0 <iscons>
+  802077:	83 c4 10             	add    $0x10,%esp
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	0f 9f c0             	setg   %al
+  80207f:	0f b6 c0             	movzbl %al,%eax
+  802082:	83 c0 01             	add    $0x1,%eax
+  802085:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802088:	83 ec 0c             	sub    $0xc,%esp
+  80208b:	68 00 10 00 00       	push   $0x1000
+  802090:	e8 6e 0b 00 00       	call   802c03 <malloc>
+  802095:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	74 bc                	je     80205b <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80209f:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020a6:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8020aa:	eb bc                	jmp    802068 <stream_setup+0x29>
+
+008020ac <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	53                   	push   %ebx
+  8020b0:	83 ec 04             	sub    $0x4,%esp
+  8020b3:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8020b5:	e8 85 ff ff ff       	call   80203f <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8020ba:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020bf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8020c3:	74 3d                	je     802102 <stream_fill+0x56>
+  8020c5:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020c9:	74 10                	je     8020db <stream_fill+0x2f>
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	e8 fd fe ff ff       	call   801fcf <stream_drain>
+		return 0;
+  8020d2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 27                	js     802102 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8020db:	83 ec 04             	sub    $0x4,%esp
+  8020de:	ff 73 10             	push   0x10(%ebx)
+  8020e1:	ff 73 0c             	push   0xc(%ebx)
+  8020e4:	ff 33                	push   (%ebx)
+  8020e6:	e8 02 f3 ff ff       	call   8013ed <read>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	7e 17                	jle    802109 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8020f2:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8020f6:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8020fd:	89 c2                	mov    %eax,%edx
+  8020ff:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802102:	89 d0                	mov    %edx,%eax
+  802104:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802107:	c9                   	leave
+  802108:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802109:	c1 f8 1f             	sar    $0x1f,%eax
+  80210c:	83 e0 04             	and    $0x4,%eax
+  80210f:	83 c0 04             	add    $0x4,%eax
+  802112:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	eb e6                	jmp    802102 <stream_fill+0x56>
+
+0080211c <fopen>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	57                   	push   %edi
+  802120:	56                   	push   %esi
+  802121:	53                   	push   %ebx
+  802122:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802128:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80212b:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802131:	89 f0                	mov    %esi,%eax
+  802133:	e8 40 fd ff ff       	call   801e78 <parse_mode>
+		return 0;
+  802138:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 2d                	js     80216e <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802141:	83 ec 08             	sub    $0x8,%esp
+  802144:	50                   	push   %eax
+  802145:	ff 75 08             	push   0x8(%ebp)
+  802148:	e8 e8 f8 ff ff       	call   801a35 <open>
+  80214d:	89 c7                	mov    %eax,%edi
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 58                	js     8021ae <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802156:	80 3e 61             	cmpb   $0x61,(%esi)
+  802159:	74 1d                	je     802178 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80215b:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802161:	89 f8                	mov    %edi,%eax
+  802163:	e8 7b fd ff ff       	call   801ee3 <stream_alloc>
+  802168:	89 c3                	mov    %eax,%ebx
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	74 32                	je     8021a0 <fopen+0x84>
+}
+  80216e:	89 d8                	mov    %ebx,%eax
+  802170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802173:	5b                   	pop    %ebx
+  802174:	5e                   	pop    %esi
+  802175:	5f                   	pop    %edi
+  802176:	5d                   	pop    %ebp
+  802177:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802178:	83 ec 08             	sub    $0x8,%esp
+  80217b:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802181:	50                   	push   %eax
+  802182:	57                   	push   %edi
+  802183:	e8 db f4 ff ff       	call   801663 <fstat>
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 cc                	js     80215b <fopen+0x3f>
+		seek(fd, st.st_size);
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  802192:	ff 75 dc             	push   -0x24(%ebp)
+  802195:	57                   	push   %edi
+  802196:	e8 f6 f3 ff ff       	call   801591 <seek>
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	eb bb                	jmp    80215b <fopen+0x3f>
+		close(fd);
+  8021a0:	83 ec 0c             	sub    $0xc,%esp
+  8021a3:	57                   	push   %edi
+  8021a4:	e8 08 f1 ff ff       	call   8012b1 <close>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	eb c0                	jmp    80216e <fopen+0x52>
+		return 0;
+  8021ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b3:	eb b9                	jmp    80216e <fopen+0x52>
+
+008021b5 <fdopen>:
+{
+  8021b5:	55                   	push   %ebp
+  8021b6:	89 e5                	mov    %esp,%ebp
+  8021b8:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8021bb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c1:	e8 b2 fc ff ff       	call   801e78 <parse_mode>
+  8021c6:	89 c2                	mov    %eax,%edx
+		return 0;
+  8021c8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8021cd:	85 d2                	test   %edx,%edx
+  8021cf:	78 0b                	js     8021dc <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8021d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	e8 07 fd ff ff       	call   801ee3 <stream_alloc>
+}
+  8021dc:	c9                   	leave
+  8021dd:	c3                   	ret
+
+008021de <setvbuf>:
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	57                   	push   %edi
+  8021e2:	56                   	push   %esi
+  8021e3:	53                   	push   %ebx
+  8021e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8021ed:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021f1:	75 3a                	jne    80222d <setvbuf+0x4f>
+  8021f3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8021f6:	83 fe 02             	cmp    $0x2,%esi
+  8021f9:	77 39                	ja     802234 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8021fb:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8021fe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802202:	0f 95 c3             	setne  %bl
+  802205:	85 ff                	test   %edi,%edi
+  802207:	0f 95 c1             	setne  %cl
+  80220a:	84 cb                	test   %cl,%bl
+  80220c:	74 05                	je     802213 <setvbuf+0x35>
+  80220e:	83 fa 03             	cmp    $0x3,%edx
+  802211:	75 0a                	jne    80221d <setvbuf+0x3f>
+	return 0;
+  802213:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802218:	5b                   	pop    %ebx
+  802219:	5e                   	pop    %esi
+  80221a:	5f                   	pop    %edi
+  80221b:	5d                   	pop    %ebp
+  80221c:	c3                   	ret
+		f->f_buf = buf;
+  80221d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802220:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802223:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222b:	eb eb                	jmp    802218 <setvbuf+0x3a>
+		return EOF;
+  80222d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802232:	eb e4                	jmp    802218 <setvbuf+0x3a>
+  802234:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802239:	eb dd                	jmp    802218 <setvbuf+0x3a>
+
+0080223b <fflush>:
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	57                   	push   %edi
+  80223f:	56                   	push   %esi
+  802240:	53                   	push   %ebx
+  802241:	83 ec 0c             	sub    $0xc,%esp
+  802244:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802247:	85 db                	test   %ebx,%ebx
+  802249:	74 1a                	je     802265 <fflush+0x2a>
+	stream_unread(f);
+  80224b:	89 d8                	mov    %ebx,%eax
+  80224d:	e8 0a fd ff ff       	call   801f5c <stream_unread>
+	return stream_drain(f);
+  802252:	89 d8                	mov    %ebx,%eax
+  802254:	e8 76 fd ff ff       	call   801fcf <stream_drain>
+  802259:	89 c7                	mov    %eax,%edi
+}
+  80225b:	89 f8                	mov    %edi,%eax
+  80225d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802260:	5b                   	pop    %ebx
+  802261:	5e                   	pop    %esi
+  802262:	5f                   	pop    %edi
+  802263:	5d                   	pop    %ebp
+  802264:	c3                   	ret
+  802265:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  80226a:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80226f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802274:	eb 03                	jmp    802279 <fflush+0x3e>
+  802276:	83 c3 24             	add    $0x24,%ebx
+  802279:	39 f3                	cmp    %esi,%ebx
+  80227b:	74 de                	je     80225b <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80227d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802281:	74 f3                	je     802276 <fflush+0x3b>
+  802283:	83 ec 0c             	sub    $0xc,%esp
+  802286:	53                   	push   %ebx
+  802287:	e8 af ff ff ff       	call   80223b <fflush>
+  80228c:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802296:	0f 48 f8             	cmovs  %eax,%edi
+  802299:	eb db                	jmp    802276 <fflush+0x3b>
+
+0080229b <fclose>:
+{
+  80229b:	55                   	push   %ebp
+  80229c:	89 e5                	mov    %esp,%ebp
+  80229e:	56                   	push   %esi
+  80229f:	53                   	push   %ebx
+  8022a0:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022a3:	83 ec 0c             	sub    $0xc,%esp
+  8022a6:	56                   	push   %esi
+  8022a7:	e8 8f ff ff ff       	call   80223b <fflush>
+  8022ac:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8022ae:	83 c4 04             	add    $0x4,%esp
+  8022b1:	ff 36                	push   (%esi)
+  8022b3:	e8 f9 ef ff ff       	call   8012b1 <close>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022c2:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8022c5:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8022c9:	75 10                	jne    8022db <fclose+0x40>
+	f->f_flags = 0;
+  8022cb:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8022d2:	89 d8                	mov    %ebx,%eax
+  8022d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d7:	5b                   	pop    %ebx
+  8022d8:	5e                   	pop    %esi
+  8022d9:	5d                   	pop    %ebp
+  8022da:	c3                   	ret
+		free(f->f_buf);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	ff 76 0c             	push   0xc(%esi)
+  8022e1:	e8 54 08 00 00       	call   802b3a <free>
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	eb e0                	jmp    8022cb <fclose+0x30>
+
+008022eb <fileno>:
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8022ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f1:	8b 00                	mov    (%eax),%eax
+}
+  8022f3:	5d                   	pop    %ebp
+  8022f4:	c3                   	ret
+
+008022f5 <feof>:
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8022f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fb:	8b 40 04             	mov    0x4(%eax),%eax
+  8022fe:	c1 e8 02             	shr    $0x2,%eax
+  802301:	83 e0 01             	and    $0x1,%eax
+}
+  802304:	5d                   	pop    %ebp
+  802305:	c3                   	ret
+
+00802306 <ferror>:
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230c:	8b 40 04             	mov    0x4(%eax),%eax
+  80230f:	c1 e8 03             	shr    $0x3,%eax
+  802312:	83 e0 01             	and    $0x1,%eax
+}
+  802315:	5d                   	pop    %ebp
+  802316:	c3                   	ret
+
+00802317 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	53                   	push   %ebx
+  80231b:	83 ec 04             	sub    $0x4,%esp
+  80231e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802321:	8b 43 18             	mov    0x18(%ebx),%eax
+  802324:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802327:	74 15                	je     80233e <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802329:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80232c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80232f:	8d 48 01             	lea    0x1(%eax),%ecx
+  802332:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802335:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802339:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80233e:	89 d8                	mov    %ebx,%eax
+  802340:	e8 67 fd ff ff       	call   8020ac <stream_fill>
+  802345:	85 c0                	test   %eax,%eax
+  802347:	75 e0                	jne    802329 <fgetc+0x12>
+		return EOF;
+  802349:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80234e:	eb e9                	jmp    802339 <fgetc+0x22>
+
+00802350 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	57                   	push   %edi
+  802354:	56                   	push   %esi
+  802355:	53                   	push   %ebx
+  802356:	83 ec 1c             	sub    $0x1c,%esp
+  802359:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80235c:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802361:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802364:	83 e8 01             	sub    $0x1,%eax
+  802367:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80236a:	eb 66                	jmp    8023d2 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80236c:	8b 46 14             	mov    0x14(%esi),%eax
+  80236f:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802372:	29 c3                	sub    %eax,%ebx
+  802374:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802377:	29 fa                	sub    %edi,%edx
+  802379:	39 d3                	cmp    %edx,%ebx
+  80237b:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80237e:	83 ec 04             	sub    $0x4,%esp
+  802381:	53                   	push   %ebx
+  802382:	6a 0a                	push   $0xa
+  802384:	03 46 0c             	add    0xc(%esi),%eax
+  802387:	50                   	push   %eax
+  802388:	e8 46 e6 ff ff       	call   8009d3 <memfind>
+  80238d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802390:	8b 46 0c             	mov    0xc(%esi),%eax
+  802393:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802396:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802399:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023a1:	74 0b                	je     8023ae <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023a3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023a9:	29 d3                	sub    %edx,%ebx
+  8023ab:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8023ae:	83 ec 04             	sub    $0x4,%esp
+  8023b1:	53                   	push   %ebx
+  8023b2:	01 c8                	add    %ecx,%eax
+  8023b4:	50                   	push   %eax
+  8023b5:	89 f8                	mov    %edi,%eax
+  8023b7:	03 45 08             	add    0x8(%ebp),%eax
+  8023ba:	50                   	push   %eax
+  8023bb:	e8 62 e5 ff ff       	call   800922 <memmove>
+		f->f_rpos += m;
+  8023c0:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8023c3:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8023c5:	83 c4 10             	add    $0x10,%esp
+  8023c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cb:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8023d0:	74 1f                	je     8023f1 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8023d2:	8d 47 01             	lea    0x1(%edi),%eax
+  8023d5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8023d8:	73 17                	jae    8023f1 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023da:	8b 46 18             	mov    0x18(%esi),%eax
+  8023dd:	39 46 14             	cmp    %eax,0x14(%esi)
+  8023e0:	75 8a                	jne    80236c <fgets+0x1c>
+  8023e2:	89 f0                	mov    %esi,%eax
+  8023e4:	e8 c3 fc ff ff       	call   8020ac <stream_fill>
+  8023e9:	85 c0                	test   %eax,%eax
+  8023eb:	0f 85 7b ff ff ff    	jne    80236c <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8023f1:	85 ff                	test   %edi,%edi
+  8023f3:	74 0f                	je     802404 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8023f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f8:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8023fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ff:	5b                   	pop    %ebx
+  802400:	5e                   	pop    %esi
+  802401:	5f                   	pop    %edi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+		return 0;
+  802404:	b8 00 00 00 00       	mov    $0x0,%eax
+  802409:	eb f1                	jmp    8023fc <fgets+0xac>
+
+0080240b <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80240b:	55                   	push   %ebp
+  80240c:	89 e5                	mov    %esp,%ebp
+  80240e:	57                   	push   %edi
+  80240f:	56                   	push   %esi
+  802410:	53                   	push   %ebx
+  802411:	83 ec 1c             	sub    $0x1c,%esp
+  802414:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802417:	89 f0                	mov    %esi,%eax
+  802419:	e8 21 fc ff ff       	call   80203f <stream_setup>
+	want = size * n;
+  80241e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802421:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802425:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802428:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242d:	eb 43                	jmp    802472 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80242f:	29 d3                	sub    %edx,%ebx
+  802431:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802434:	29 f8                	sub    %edi,%eax
+  802436:	39 c3                	cmp    %eax,%ebx
+  802438:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80243b:	83 ec 04             	sub    $0x4,%esp
+  80243e:	53                   	push   %ebx
+  80243f:	03 56 0c             	add    0xc(%esi),%edx
+  802442:	52                   	push   %edx
+  802443:	89 f8                	mov    %edi,%eax
+  802445:	03 45 08             	add    0x8(%ebp),%eax
+  802448:	50                   	push   %eax
+  802449:	e8 d4 e4 ff ff       	call   800922 <memmove>
+			f->f_rpos += m;
+  80244e:	01 5e 14             	add    %ebx,0x14(%esi)
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	eb 1a                	jmp    802470 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802456:	83 ec 04             	sub    $0x4,%esp
+  802459:	53                   	push   %ebx
+  80245a:	89 f8                	mov    %edi,%eax
+  80245c:	03 45 08             	add    0x8(%ebp),%eax
+  80245f:	50                   	push   %eax
+  802460:	ff 36                	push   (%esi)
+  802462:	e8 86 ef ff ff       	call   8013ed <read>
+  802467:	89 c3                	mov    %eax,%ebx
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	7e 36                	jle    8024a6 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802470:	01 df                	add    %ebx,%edi
+  802472:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802475:	39 c7                	cmp    %eax,%edi
+  802477:	73 39                	jae    8024b2 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802479:	8b 56 14             	mov    0x14(%esi),%edx
+  80247c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80247f:	39 da                	cmp    %ebx,%edx
+  802481:	72 ac                	jb     80242f <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802483:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802486:	29 fb                	sub    %edi,%ebx
+  802488:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80248b:	72 3e                	jb     8024cb <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80248d:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802491:	74 1f                	je     8024b2 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802493:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802497:	74 bd                	je     802456 <fread+0x4b>
+  802499:	89 f0                	mov    %esi,%eax
+  80249b:	e8 2f fb ff ff       	call   801fcf <stream_drain>
+  8024a0:	85 c0                	test   %eax,%eax
+  8024a2:	79 b2                	jns    802456 <fread+0x4b>
+  8024a4:	eb 0c                	jmp    8024b2 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024a6:	c1 fb 1f             	sar    $0x1f,%ebx
+  8024a9:	83 e3 04             	and    $0x4,%ebx
+  8024ac:	83 c3 04             	add    $0x4,%ebx
+  8024af:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8024b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	74 0a                	je     8024c3 <fread+0xb8>
+  8024b9:	89 f8                	mov    %edi,%eax
+  8024bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c0:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8024c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c6:	5b                   	pop    %ebx
+  8024c7:	5e                   	pop    %esi
+  8024c8:	5f                   	pop    %edi
+  8024c9:	5d                   	pop    %ebp
+  8024ca:	c3                   	ret
+		} else if (!stream_fill(f))
+  8024cb:	89 f0                	mov    %esi,%eax
+  8024cd:	e8 da fb ff ff       	call   8020ac <stream_fill>
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	74 dc                	je     8024b2 <fread+0xa7>
+			m = 0;
+  8024d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024db:	eb 93                	jmp    802470 <fread+0x65>
+
+008024dd <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8024dd:	55                   	push   %ebp
+  8024de:	89 e5                	mov    %esp,%ebp
+  8024e0:	57                   	push   %edi
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	83 ec 1c             	sub    $0x1c,%esp
+  8024e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8024e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024ec:	a8 02                	test   $0x2,%al
+  8024ee:	75 13                	jne    802503 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8024f0:	83 c8 08             	or     $0x8,%eax
+  8024f3:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8024f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8024fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024fe:	5b                   	pop    %ebx
+  8024ff:	5e                   	pop    %esi
+  802500:	5f                   	pop    %edi
+  802501:	5d                   	pop    %ebp
+  802502:	c3                   	ret
+	stream_setup(f);
+  802503:	89 d8                	mov    %ebx,%eax
+  802505:	e8 35 fb ff ff       	call   80203f <stream_setup>
+	want = size * n;
+  80250a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80250d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802511:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802514:	89 d8                	mov    %ebx,%eax
+  802516:	e8 41 fa ff ff       	call   801f5c <stream_unread>
+	for (done = 0; done < want; ) {
+  80251b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802520:	84 c0                	test   %al,%al
+  802522:	75 7b                	jne    80259f <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802524:	be 00 00 00 00       	mov    $0x0,%esi
+  802529:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80252c:	39 fe                	cmp    %edi,%esi
+  80252e:	73 24                	jae    802554 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802530:	83 ec 04             	sub    $0x4,%esp
+  802533:	89 f8                	mov    %edi,%eax
+  802535:	29 f0                	sub    %esi,%eax
+  802537:	50                   	push   %eax
+  802538:	89 f0                	mov    %esi,%eax
+  80253a:	03 45 08             	add    0x8(%ebp),%eax
+  80253d:	50                   	push   %eax
+  80253e:	ff 33                	push   (%ebx)
+  802540:	e8 a0 ef ff ff       	call   8014e5 <write>
+  802545:	83 c4 10             	add    $0x10,%esp
+  802548:	85 c0                	test   %eax,%eax
+  80254a:	7e 04                	jle    802550 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80254c:	01 c6                	add    %eax,%esi
+  80254e:	eb dc                	jmp    80252c <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802550:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802554:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802557:	85 c0                	test   %eax,%eax
+  802559:	74 a0                	je     8024fb <fwrite+0x1e>
+  80255b:	89 f0                	mov    %esi,%eax
+  80255d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802562:	f7 75 0c             	divl   0xc(%ebp)
+  802565:	eb 94                	jmp    8024fb <fwrite+0x1e>
+			done += r;
+  802567:	01 c7                	add    %eax,%edi
+			continue;
+  802569:	eb 34                	jmp    80259f <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80256b:	8b 73 10             	mov    0x10(%ebx),%esi
+  80256e:	29 c6                	sub    %eax,%esi
+  802570:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802573:	29 fa                	sub    %edi,%edx
+  802575:	39 d6                	cmp    %edx,%esi
+  802577:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80257a:	83 ec 04             	sub    $0x4,%esp
+  80257d:	56                   	push   %esi
+  80257e:	89 fa                	mov    %edi,%edx
+  802580:	03 55 08             	add    0x8(%ebp),%edx
+  802583:	52                   	push   %edx
+  802584:	03 43 0c             	add    0xc(%ebx),%eax
+  802587:	50                   	push   %eax
+  802588:	e8 95 e3 ff ff       	call   800922 <memmove>
+		f->f_wend += m;
+  80258d:	89 f0                	mov    %esi,%eax
+  80258f:	03 43 1c             	add    0x1c(%ebx),%eax
+  802592:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802595:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80259d:	74 5b                	je     8025fa <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80259f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025a2:	39 c7                	cmp    %eax,%edi
+  8025a4:	73 2d                	jae    8025d3 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025a6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	75 be                	jne    80256b <fwrite+0x8e>
+  8025ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025b0:	29 fa                	sub    %edi,%edx
+  8025b2:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8025b5:	72 b4                	jb     80256b <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025b7:	83 ec 04             	sub    $0x4,%esp
+  8025ba:	52                   	push   %edx
+  8025bb:	89 f8                	mov    %edi,%eax
+  8025bd:	03 45 08             	add    0x8(%ebp),%eax
+  8025c0:	50                   	push   %eax
+  8025c1:	ff 33                	push   (%ebx)
+  8025c3:	e8 1d ef ff ff       	call   8014e5 <write>
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	85 c0                	test   %eax,%eax
+  8025cd:	7f 98                	jg     802567 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8025cf:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8025d3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8025d6:	83 f8 03             	cmp    $0x3,%eax
+  8025d9:	74 48                	je     802623 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8025db:	83 f8 02             	cmp    $0x2,%eax
+  8025de:	74 27                	je     802607 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8025e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	0f 84 10 ff ff ff    	je     8024fb <fwrite+0x1e>
+  8025eb:	89 f8                	mov    %edi,%eax
+  8025ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f2:	f7 75 0c             	divl   0xc(%ebp)
+  8025f5:	e9 01 ff ff ff       	jmp    8024fb <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025fa:	89 d8                	mov    %ebx,%eax
+  8025fc:	e8 ce f9 ff ff       	call   801fcf <stream_drain>
+  802601:	85 c0                	test   %eax,%eax
+  802603:	79 9a                	jns    80259f <fwrite+0xc2>
+  802605:	eb cc                	jmp    8025d3 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802607:	83 ec 04             	sub    $0x4,%esp
+  80260a:	57                   	push   %edi
+  80260b:	6a 0a                	push   $0xa
+  80260d:	ff 75 08             	push   0x8(%ebp)
+  802610:	e8 be e3 ff ff       	call   8009d3 <memfind>
+  802615:	89 c2                	mov    %eax,%edx
+  802617:	89 f8                	mov    %edi,%eax
+  802619:	03 45 08             	add    0x8(%ebp),%eax
+  80261c:	83 c4 10             	add    $0x10,%esp
+  80261f:	39 c2                	cmp    %eax,%edx
+  802621:	74 bd                	je     8025e0 <fwrite+0x103>
+		stream_drain(f);
+  802623:	89 d8                	mov    %ebx,%eax
+  802625:	e8 a5 f9 ff ff       	call   801fcf <stream_drain>
+  80262a:	eb b4                	jmp    8025e0 <fwrite+0x103>
+
+0080262c <fputc>:
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	53                   	push   %ebx
+  802630:	83 ec 14             	sub    $0x14,%esp
+  802633:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802636:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802639:	ff 75 0c             	push   0xc(%ebp)
+  80263c:	6a 01                	push   $0x1
+  80263e:	6a 01                	push   $0x1
+  802640:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802643:	50                   	push   %eax
+  802644:	e8 94 fe ff ff       	call   8024dd <fwrite>
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	0f b6 db             	movzbl %bl,%ebx
+  80264f:	83 f8 01             	cmp    $0x1,%eax
+  802652:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802657:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80265a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265d:	c9                   	leave
+  80265e:	c3                   	ret
+
+0080265f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80265f:	55                   	push   %ebp
+  802660:	89 e5                	mov    %esp,%ebp
+  802662:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802665:	ff 75 0c             	push   0xc(%ebp)
+  802668:	ff 75 08             	push   0x8(%ebp)
+  80266b:	e8 bc ff ff ff       	call   80262c <fputc>
+}
+  802670:	83 c4 10             	add    $0x10,%esp
+  802673:	c9                   	leave
+  802674:	c3                   	ret
+
+00802675 <fputs>:
+{
+  802675:	55                   	push   %ebp
+  802676:	89 e5                	mov    %esp,%ebp
+  802678:	56                   	push   %esi
+  802679:	53                   	push   %ebx
+  80267a:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80267d:	83 ec 0c             	sub    $0xc,%esp
+  802680:	56                   	push   %esi
+  802681:	e8 db e0 ff ff       	call   800761 <strlen>
+  802686:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802688:	ff 75 0c             	push   0xc(%ebp)
+  80268b:	50                   	push   %eax
+  80268c:	6a 01                	push   $0x1
+  80268e:	56                   	push   %esi
+  80268f:	e8 49 fe ff ff       	call   8024dd <fwrite>
+  802694:	83 c4 20             	add    $0x20,%esp
+  802697:	39 d8                	cmp    %ebx,%eax
+  802699:	0f 95 c0             	setne  %al
+  80269c:	0f b6 c0             	movzbl %al,%eax
+  80269f:	f7 d8                	neg    %eax
+}
+  8026a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a4:	5b                   	pop    %ebx
+  8026a5:	5e                   	pop    %esi
+  8026a6:	5d                   	pop    %ebp
+  8026a7:	c3                   	ret
+
+008026a8 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	53                   	push   %ebx
+  8026ac:	83 ec 04             	sub    $0x4,%esp
+  8026af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8026b2:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8026b5:	50                   	push   %eax
+  8026b6:	ff 75 0c             	push   0xc(%ebp)
+  8026b9:	53                   	push   %ebx
+  8026ba:	68 5f 26 80 00       	push   $0x80265f
+  8026bf:	e8 eb db ff ff       	call   8002af <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8026c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026c7:	c1 e0 1c             	shl    $0x1c,%eax
+  8026ca:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8026cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+008026d2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026d8:	68 b8 4b 80 00       	push   $0x804bb8
+  8026dd:	ff 75 0c             	push   0xc(%ebp)
+  8026e0:	e8 b7 e0 ff ff       	call   80079c <strcpy>
+	return 0;
+}
+  8026e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+008026ec <devsock_close>:
+{
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	53                   	push   %ebx
+  8026f0:	83 ec 10             	sub    $0x10,%esp
+  8026f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026f6:	53                   	push   %ebx
+  8026f7:	e8 69 1d 00 00       	call   804465 <pageref>
+  8026fc:	89 c2                	mov    %eax,%edx
+  8026fe:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802701:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802706:	83 fa 01             	cmp    $0x1,%edx
+  802709:	74 05                	je     802710 <devsock_close+0x24>
+}
+  80270b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80270e:	c9                   	leave
+  80270f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	ff 73 0c             	push   0xc(%ebx)
+  802716:	e8 b7 02 00 00       	call   8029d2 <nsipc_close>
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	eb eb                	jmp    80270b <devsock_close+0x1f>
+
+00802720 <devsock_write>:
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802726:	6a 00                	push   $0x0
+  802728:	ff 75 10             	push   0x10(%ebp)
+  80272b:	ff 75 0c             	push   0xc(%ebp)
+  80272e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802731:	ff 70 0c             	push   0xc(%eax)
+  802734:	e8 79 03 00 00       	call   802ab2 <nsipc_send>
+}
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+0080273b <devsock_read>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802741:	6a 00                	push   $0x0
+  802743:	ff 75 10             	push   0x10(%ebp)
+  802746:	ff 75 0c             	push   0xc(%ebp)
+  802749:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274c:	ff 70 0c             	push   0xc(%eax)
+  80274f:	e8 ef 02 00 00       	call   802a43 <nsipc_recv>
+}
+  802754:	c9                   	leave
+  802755:	c3                   	ret
+
+00802756 <fd2sockid>:
+{
+  802756:	55                   	push   %ebp
+  802757:	89 e5                	mov    %esp,%ebp
+  802759:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80275c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80275f:	52                   	push   %edx
+  802760:	50                   	push   %eax
+  802761:	e8 f7 e9 ff ff       	call   80115d <fd_lookup>
+  802766:	83 c4 10             	add    $0x10,%esp
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 10                	js     80277d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80276d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802770:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802776:	39 08                	cmp    %ecx,(%eax)
+  802778:	75 05                	jne    80277f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80277a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80277d:	c9                   	leave
+  80277e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80277f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802784:	eb f7                	jmp    80277d <fd2sockid+0x27>
+
+00802786 <alloc_sockfd>:
+{
+  802786:	55                   	push   %ebp
+  802787:	89 e5                	mov    %esp,%ebp
+  802789:	56                   	push   %esi
+  80278a:	53                   	push   %ebx
+  80278b:	83 ec 1c             	sub    $0x1c,%esp
+  80278e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802793:	50                   	push   %eax
+  802794:	e8 6e e9 ff ff       	call   801107 <fd_alloc>
+  802799:	89 c3                	mov    %eax,%ebx
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	85 c0                	test   %eax,%eax
+  8027a0:	78 43                	js     8027e5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027a2:	83 ec 04             	sub    $0x4,%esp
+  8027a5:	68 07 04 00 00       	push   $0x407
+  8027aa:	ff 75 f4             	push   -0xc(%ebp)
+  8027ad:	6a 00                	push   $0x0
+  8027af:	e8 26 e4 ff ff       	call   800bda <sys_page_alloc>
+  8027b4:	89 c3                	mov    %eax,%ebx
+  8027b6:	83 c4 10             	add    $0x10,%esp
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	78 28                	js     8027e5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c0:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  8027c6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8027c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027cb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027d2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027d5:	83 ec 0c             	sub    $0xc,%esp
+  8027d8:	50                   	push   %eax
+  8027d9:	e8 02 e9 ff ff       	call   8010e0 <fd2num>
+  8027de:	89 c3                	mov    %eax,%ebx
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	eb 0c                	jmp    8027f1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027e5:	83 ec 0c             	sub    $0xc,%esp
+  8027e8:	56                   	push   %esi
+  8027e9:	e8 e4 01 00 00       	call   8029d2 <nsipc_close>
+		return r;
+  8027ee:	83 c4 10             	add    $0x10,%esp
+}
+  8027f1:	89 d8                	mov    %ebx,%eax
+  8027f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f6:	5b                   	pop    %ebx
+  8027f7:	5e                   	pop    %esi
+  8027f8:	5d                   	pop    %ebp
+  8027f9:	c3                   	ret
+
+008027fa <accept>:
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802800:	8b 45 08             	mov    0x8(%ebp),%eax
+  802803:	e8 4e ff ff ff       	call   802756 <fd2sockid>
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	78 1b                	js     802827 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80280c:	83 ec 04             	sub    $0x4,%esp
+  80280f:	ff 75 10             	push   0x10(%ebp)
+  802812:	ff 75 0c             	push   0xc(%ebp)
+  802815:	50                   	push   %eax
+  802816:	e8 0e 01 00 00       	call   802929 <nsipc_accept>
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 05                	js     802827 <accept+0x2d>
+	return alloc_sockfd(r);
+  802822:	e8 5f ff ff ff       	call   802786 <alloc_sockfd>
+}
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+
+00802829 <bind>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80282f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802832:	e8 1f ff ff ff       	call   802756 <fd2sockid>
+  802837:	85 c0                	test   %eax,%eax
+  802839:	78 12                	js     80284d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80283b:	83 ec 04             	sub    $0x4,%esp
+  80283e:	ff 75 10             	push   0x10(%ebp)
+  802841:	ff 75 0c             	push   0xc(%ebp)
+  802844:	50                   	push   %eax
+  802845:	e8 31 01 00 00       	call   80297b <nsipc_bind>
+  80284a:	83 c4 10             	add    $0x10,%esp
+}
+  80284d:	c9                   	leave
+  80284e:	c3                   	ret
+
+0080284f <shutdown>:
+{
+  80284f:	55                   	push   %ebp
+  802850:	89 e5                	mov    %esp,%ebp
+  802852:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802855:	8b 45 08             	mov    0x8(%ebp),%eax
+  802858:	e8 f9 fe ff ff       	call   802756 <fd2sockid>
+  80285d:	85 c0                	test   %eax,%eax
+  80285f:	78 0f                	js     802870 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802861:	83 ec 08             	sub    $0x8,%esp
+  802864:	ff 75 0c             	push   0xc(%ebp)
+  802867:	50                   	push   %eax
+  802868:	e8 43 01 00 00       	call   8029b0 <nsipc_shutdown>
+  80286d:	83 c4 10             	add    $0x10,%esp
+}
+  802870:	c9                   	leave
+  802871:	c3                   	ret
+
+00802872 <connect>:
+{
+  802872:	55                   	push   %ebp
+  802873:	89 e5                	mov    %esp,%ebp
+  802875:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802878:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287b:	e8 d6 fe ff ff       	call   802756 <fd2sockid>
+  802880:	85 c0                	test   %eax,%eax
+  802882:	78 12                	js     802896 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802884:	83 ec 04             	sub    $0x4,%esp
+  802887:	ff 75 10             	push   0x10(%ebp)
+  80288a:	ff 75 0c             	push   0xc(%ebp)
+  80288d:	50                   	push   %eax
+  80288e:	e8 59 01 00 00       	call   8029ec <nsipc_connect>
+  802893:	83 c4 10             	add    $0x10,%esp
+}
+  802896:	c9                   	leave
+  802897:	c3                   	ret
+
+00802898 <listen>:
+{
+  802898:	55                   	push   %ebp
+  802899:	89 e5                	mov    %esp,%ebp
+  80289b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80289e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a1:	e8 b0 fe ff ff       	call   802756 <fd2sockid>
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	78 0f                	js     8028b9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+  8028ad:	ff 75 0c             	push   0xc(%ebp)
+  8028b0:	50                   	push   %eax
+  8028b1:	e8 6b 01 00 00       	call   802a21 <nsipc_listen>
+  8028b6:	83 c4 10             	add    $0x10,%esp
+}
+  8028b9:	c9                   	leave
+  8028ba:	c3                   	ret
+
+008028bb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028bb:	55                   	push   %ebp
+  8028bc:	89 e5                	mov    %esp,%ebp
+  8028be:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028c1:	ff 75 10             	push   0x10(%ebp)
+  8028c4:	ff 75 0c             	push   0xc(%ebp)
+  8028c7:	ff 75 08             	push   0x8(%ebp)
+  8028ca:	e8 41 02 00 00       	call   802b10 <nsipc_socket>
+  8028cf:	83 c4 10             	add    $0x10,%esp
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	78 05                	js     8028db <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028d6:	e8 ab fe ff ff       	call   802786 <alloc_sockfd>
+}
+  8028db:	c9                   	leave
+  8028dc:	c3                   	ret
+
+008028dd <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028dd:	55                   	push   %ebp
+  8028de:	89 e5                	mov    %esp,%ebp
+  8028e0:	53                   	push   %ebx
+  8028e1:	83 ec 04             	sub    $0x4,%esp
+  8028e4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8028e6:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8028ed:	74 26                	je     802915 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028ef:	6a 07                	push   $0x7
+  8028f1:	68 00 80 80 00       	push   $0x808000
+  8028f6:	53                   	push   %ebx
+  8028f7:	ff 35 08 60 80 00    	push   0x806008
+  8028fd:	e8 ce 1a 00 00       	call   8043d0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802902:	83 c4 0c             	add    $0xc,%esp
+  802905:	6a 00                	push   $0x0
+  802907:	6a 00                	push   $0x0
+  802909:	6a 00                	push   $0x0
+  80290b:	e8 ca 19 00 00       	call   8042da <ipc_recv>
+}
+  802910:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802913:	c9                   	leave
+  802914:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802915:	83 ec 0c             	sub    $0xc,%esp
+  802918:	6a 02                	push   $0x2
+  80291a:	e8 07 1b 00 00       	call   804426 <ipc_find_env>
+  80291f:	a3 08 60 80 00       	mov    %eax,0x806008
+  802924:	83 c4 10             	add    $0x10,%esp
+  802927:	eb c6                	jmp    8028ef <nsipc+0x12>
+
+00802929 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	56                   	push   %esi
+  80292d:	53                   	push   %ebx
+  80292e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802931:	8b 45 08             	mov    0x8(%ebp),%eax
+  802934:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802939:	8b 06                	mov    (%esi),%eax
+  80293b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802940:	b8 01 00 00 00       	mov    $0x1,%eax
+  802945:	e8 93 ff ff ff       	call   8028dd <nsipc>
+  80294a:	89 c3                	mov    %eax,%ebx
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	79 09                	jns    802959 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802950:	89 d8                	mov    %ebx,%eax
+  802952:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802955:	5b                   	pop    %ebx
+  802956:	5e                   	pop    %esi
+  802957:	5d                   	pop    %ebp
+  802958:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802959:	83 ec 04             	sub    $0x4,%esp
+  80295c:	ff 35 10 80 80 00    	push   0x808010
+  802962:	68 00 80 80 00       	push   $0x808000
+  802967:	ff 75 0c             	push   0xc(%ebp)
+  80296a:	e8 b3 df ff ff       	call   800922 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80296f:	a1 10 80 80 00       	mov    0x808010,%eax
+  802974:	89 06                	mov    %eax,(%esi)
+  802976:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802979:	eb d5                	jmp    802950 <nsipc_accept+0x27>
+
+0080297b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	53                   	push   %ebx
+  80297f:	83 ec 08             	sub    $0x8,%esp
+  802982:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802985:	8b 45 08             	mov    0x8(%ebp),%eax
+  802988:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80298d:	53                   	push   %ebx
+  80298e:	ff 75 0c             	push   0xc(%ebp)
+  802991:	68 04 80 80 00       	push   $0x808004
+  802996:	e8 87 df ff ff       	call   800922 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80299b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8029a1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029a6:	e8 32 ff ff ff       	call   8028dd <nsipc>
+}
+  8029ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ae:	c9                   	leave
+  8029af:	c3                   	ret
+
+008029b0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8029be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029c1:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8029c6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029cb:	e8 0d ff ff ff       	call   8028dd <nsipc>
+}
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+
+008029d2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029d2:	55                   	push   %ebp
+  8029d3:	89 e5                	mov    %esp,%ebp
+  8029d5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029db:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8029e0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029e5:	e8 f3 fe ff ff       	call   8028dd <nsipc>
+}
+  8029ea:	c9                   	leave
+  8029eb:	c3                   	ret
+
+008029ec <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029ec:	55                   	push   %ebp
+  8029ed:	89 e5                	mov    %esp,%ebp
+  8029ef:	53                   	push   %ebx
+  8029f0:	83 ec 08             	sub    $0x8,%esp
+  8029f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8029f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029fe:	53                   	push   %ebx
+  8029ff:	ff 75 0c             	push   0xc(%ebp)
+  802a02:	68 04 80 80 00       	push   $0x808004
+  802a07:	e8 16 df ff ff       	call   800922 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a0c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a12:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a17:	e8 c1 fe ff ff       	call   8028dd <nsipc>
+}
+  802a1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+00802a21 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a32:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a37:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a3c:	e8 9c fe ff ff       	call   8028dd <nsipc>
+}
+  802a41:	c9                   	leave
+  802a42:	c3                   	ret
+
+00802a43 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a43:	55                   	push   %ebp
+  802a44:	89 e5                	mov    %esp,%ebp
+  802a46:	56                   	push   %esi
+  802a47:	53                   	push   %ebx
+  802a48:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a53:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a59:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a5c:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a61:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a66:	e8 72 fe ff ff       	call   8028dd <nsipc>
+  802a6b:	89 c3                	mov    %eax,%ebx
+  802a6d:	85 c0                	test   %eax,%eax
+  802a6f:	78 22                	js     802a93 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a71:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a76:	39 c6                	cmp    %eax,%esi
+  802a78:	0f 4e c6             	cmovle %esi,%eax
+  802a7b:	39 c3                	cmp    %eax,%ebx
+  802a7d:	7f 1d                	jg     802a9c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a7f:	83 ec 04             	sub    $0x4,%esp
+  802a82:	53                   	push   %ebx
+  802a83:	68 00 80 80 00       	push   $0x808000
+  802a88:	ff 75 0c             	push   0xc(%ebp)
+  802a8b:	e8 92 de ff ff       	call   800922 <memmove>
+  802a90:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a93:	89 d8                	mov    %ebx,%eax
+  802a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a98:	5b                   	pop    %ebx
+  802a99:	5e                   	pop    %esi
+  802a9a:	5d                   	pop    %ebp
+  802a9b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a9c:	68 c4 4b 80 00       	push   $0x804bc4
+  802aa1:	68 7d 4b 80 00       	push   $0x804b7d
+  802aa6:	6a 62                	push   $0x62
+  802aa8:	68 d9 4b 80 00       	push   $0x804bd9
+  802aad:	e8 6c 11 00 00       	call   803c1e <_panic>
+
+00802ab2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ab2:	55                   	push   %ebp
+  802ab3:	89 e5                	mov    %esp,%ebp
+  802ab5:	53                   	push   %ebx
+  802ab6:	83 ec 04             	sub    $0x4,%esp
+  802ab9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abf:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ac4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802aca:	7f 2e                	jg     802afa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802acc:	83 ec 04             	sub    $0x4,%esp
+  802acf:	53                   	push   %ebx
+  802ad0:	ff 75 0c             	push   0xc(%ebp)
+  802ad3:	68 0c 80 80 00       	push   $0x80800c
+  802ad8:	e8 45 de ff ff       	call   800922 <memmove>
+	nsipcbuf.send.req_size = size;
+  802add:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802ae3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ae6:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802aeb:	b8 08 00 00 00       	mov    $0x8,%eax
+  802af0:	e8 e8 fd ff ff       	call   8028dd <nsipc>
+}
+  802af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+	assert(size < 1600);
+  802afa:	68 e5 4b 80 00       	push   $0x804be5
+  802aff:	68 7d 4b 80 00       	push   $0x804b7d
+  802b04:	6a 6d                	push   $0x6d
+  802b06:	68 d9 4b 80 00       	push   $0x804bd9
+  802b0b:	e8 0e 11 00 00       	call   803c1e <_panic>
+
+00802b10 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b10:	55                   	push   %ebp
+  802b11:	89 e5                	mov    %esp,%ebp
+  802b13:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b19:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b21:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b26:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b29:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b2e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b33:	e8 a5 fd ff ff       	call   8028dd <nsipc>
+}
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+00802b3a <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	53                   	push   %ebx
+  802b3e:	83 ec 10             	sub    $0x10,%esp
+  802b41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802b44:	68 0c 60 80 00       	push   $0x80600c
+  802b49:	e8 50 07 00 00       	call   80329e <mutex_lock>
+	if (v == 0)
+  802b4e:	83 c4 10             	add    $0x10,%esp
+  802b51:	85 db                	test   %ebx,%ebx
+  802b53:	0f 84 85 00 00 00    	je     802bde <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b59:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b5f:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b64:	77 51                	ja     802bb7 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802b66:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802b6c:	89 d8                	mov    %ebx,%eax
+  802b6e:	c1 e8 0c             	shr    $0xc,%eax
+  802b71:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b78:	f6 c4 02             	test   $0x2,%ah
+  802b7b:	74 50                	je     802bcd <free+0x93>
+		sys_page_unmap(0, c);
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+  802b80:	53                   	push   %ebx
+  802b81:	6a 00                	push   $0x0
+  802b83:	e8 eb e0 ff ff       	call   800c73 <sys_page_unmap>
+		c += PGSIZE;
+  802b88:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802b8e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b94:	83 c4 10             	add    $0x10,%esp
+  802b97:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b9c:	76 ce                	jbe    802b6c <free+0x32>
+  802b9e:	68 2f 4c 80 00       	push   $0x804c2f
+  802ba3:	68 7d 4b 80 00       	push   $0x804b7d
+  802ba8:	68 82 00 00 00       	push   $0x82
+  802bad:	68 22 4c 80 00       	push   $0x804c22
+  802bb2:	e8 67 10 00 00       	call   803c1e <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bb7:	68 f4 4b 80 00       	push   $0x804bf4
+  802bbc:	68 7d 4b 80 00       	push   $0x804b7d
+  802bc1:	6a 7b                	push   $0x7b
+  802bc3:	68 22 4c 80 00       	push   $0x804c22
+  802bc8:	e8 51 10 00 00       	call   803c1e <_panic>
+	if (--(*ref) == 0)
+  802bcd:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802bd3:	83 e8 01             	sub    $0x1,%eax
+  802bd6:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802bdc:	74 15                	je     802bf3 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802bde:	83 ec 0c             	sub    $0xc,%esp
+  802be1:	68 0c 60 80 00       	push   $0x80600c
+  802be6:	e8 20 07 00 00       	call   80330b <mutex_unlock>
+}
+  802beb:	83 c4 10             	add    $0x10,%esp
+  802bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+		sys_page_unmap(0, c);
+  802bf3:	83 ec 08             	sub    $0x8,%esp
+  802bf6:	53                   	push   %ebx
+  802bf7:	6a 00                	push   $0x0
+  802bf9:	e8 75 e0 ff ff       	call   800c73 <sys_page_unmap>
+  802bfe:	83 c4 10             	add    $0x10,%esp
+  802c01:	eb db                	jmp    802bde <free+0xa4>
+
+00802c03 <malloc>:
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	57                   	push   %edi
+  802c07:	56                   	push   %esi
+  802c08:	53                   	push   %ebx
+  802c09:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c0c:	68 0c 60 80 00       	push   $0x80600c
+  802c11:	e8 88 06 00 00       	call   80329e <mutex_lock>
+	if (mptr == 0)
+  802c16:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c1c:	83 c4 10             	add    $0x10,%esp
+  802c1f:	85 ff                	test   %edi,%edi
+  802c21:	74 6c                	je     802c8f <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c26:	83 c0 03             	add    $0x3,%eax
+  802c29:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c2c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c2e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c33:	0f 87 64 01 00 00    	ja     802d9d <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802c39:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802c3f:	74 30                	je     802c71 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802c41:	89 f9                	mov    %edi,%ecx
+  802c43:	c1 e9 0c             	shr    $0xc,%ecx
+  802c46:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802c4a:	c1 e8 0c             	shr    $0xc,%eax
+  802c4d:	39 c1                	cmp    %eax,%ecx
+  802c4f:	74 5f                	je     802cb0 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802c51:	83 ec 0c             	sub    $0xc,%esp
+  802c54:	57                   	push   %edi
+  802c55:	e8 e0 fe ff ff       	call   802b3a <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802c5a:	a1 10 60 80 00       	mov    0x806010,%eax
+  802c5f:	05 00 10 00 00       	add    $0x1000,%eax
+  802c64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c69:	a3 10 60 80 00       	mov    %eax,0x806010
+  802c6e:	83 c4 10             	add    $0x10,%esp
+  802c71:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802c77:	ba 02 00 00 00       	mov    $0x2,%edx
+  802c7c:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802c80:	8d 7e 04             	lea    0x4(%esi),%edi
+  802c83:	89 cb                	mov    %ecx,%ebx
+  802c85:	01 f9                	add    %edi,%ecx
+  802c87:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802c8a:	e9 8b 00 00 00       	jmp    802d1a <malloc+0x117>
+		mptr = mbegin;
+  802c8f:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802c96:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9c:	83 c0 03             	add    $0x3,%eax
+  802c9f:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ca2:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ca4:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ca9:	76 c6                	jbe    802c71 <malloc+0x6e>
+  802cab:	e9 d6 00 00 00       	jmp    802d86 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802cb0:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cb6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802cbb:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802cbf:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802cc2:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802cc7:	e9 ba 00 00 00       	jmp    802d86 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ccc:	05 00 10 00 00       	add    $0x1000,%eax
+  802cd1:	39 c8                	cmp    %ecx,%eax
+  802cd3:	0f 83 cb 00 00 00    	jae    802da4 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802cd9:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802cde:	77 22                	ja     802d02 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802ce0:	89 c2                	mov    %eax,%edx
+  802ce2:	c1 ea 16             	shr    $0x16,%edx
+  802ce5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802cec:	f6 c2 01             	test   $0x1,%dl
+  802cef:	74 db                	je     802ccc <malloc+0xc9>
+  802cf1:	89 c2                	mov    %eax,%edx
+  802cf3:	c1 ea 0c             	shr    $0xc,%edx
+  802cf6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802cfd:	f6 c2 01             	test   $0x1,%dl
+  802d00:	74 ca                	je     802ccc <malloc+0xc9>
+		if (mptr == mend) {
+  802d02:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d08:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d0e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d12:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d18:	74 04                	je     802d1e <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d1a:	89 d8                	mov    %ebx,%eax
+  802d1c:	eb b3                	jmp    802cd1 <malloc+0xce>
+  802d1e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d21:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802d26:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802d2a:	83 ea 01             	sub    $0x1,%edx
+  802d2d:	0f 85 50 ff ff ff    	jne    802c83 <malloc+0x80>
+  802d33:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d3a:	00 00 08 
+				return 0;	/* out of address space */
+  802d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d42:	eb 42                	jmp    802d86 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802d44:	85 db                	test   %ebx,%ebx
+  802d46:	78 1e                	js     802d66 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802d48:	83 ec 08             	sub    $0x8,%esp
+  802d4b:	89 d8                	mov    %ebx,%eax
+  802d4d:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d53:	50                   	push   %eax
+  802d54:	6a 00                	push   $0x0
+  802d56:	e8 18 df ff ff       	call   800c73 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802d5b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802d61:	83 c4 10             	add    $0x10,%esp
+  802d64:	eb de                	jmp    802d44 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802d66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6b:	eb 19                	jmp    802d86 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802d6d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802d70:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802d76:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802d7d:	00 
+	mptr += n;
+  802d7e:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d81:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802d86:	83 ec 0c             	sub    $0xc,%esp
+  802d89:	68 0c 60 80 00       	push   $0x80600c
+  802d8e:	e8 78 05 00 00       	call   80330b <mutex_unlock>
+}
+  802d93:	89 f8                	mov    %edi,%eax
+  802d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d98:	5b                   	pop    %ebx
+  802d99:	5e                   	pop    %esi
+  802d9a:	5f                   	pop    %edi
+  802d9b:	5d                   	pop    %ebp
+  802d9c:	c3                   	ret
+		return 0;
+  802d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da2:	eb e2                	jmp    802d86 <malloc+0x183>
+  802da4:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802da8:	74 06                	je     802db0 <malloc+0x1ad>
+  802daa:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802db0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802db5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802db8:	39 fb                	cmp    %edi,%ebx
+  802dba:	73 b1                	jae    802d6d <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dbc:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802dc2:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dc5:	39 fe                	cmp    %edi,%esi
+  802dc7:	0f 92 c0             	setb   %al
+  802dca:	0f b6 c0             	movzbl %al,%eax
+  802dcd:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802dd0:	83 c8 07             	or     $0x7,%eax
+  802dd3:	50                   	push   %eax
+  802dd4:	89 d8                	mov    %ebx,%eax
+  802dd6:	03 05 10 60 80 00    	add    0x806010,%eax
+  802ddc:	50                   	push   %eax
+  802ddd:	6a 00                	push   $0x0
+  802ddf:	e8 f6 dd ff ff       	call   800bda <sys_page_alloc>
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	85 c0                	test   %eax,%eax
+  802de9:	0f 88 55 ff ff ff    	js     802d44 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802def:	89 f3                	mov    %esi,%ebx
+  802df1:	eb c5                	jmp    802db8 <malloc+0x1b5>
+
+00802df3 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	56                   	push   %esi
+  802df7:	53                   	push   %ebx
+  802df8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802dfb:	83 ec 0c             	sub    $0xc,%esp
+  802dfe:	ff 75 08             	push   0x8(%ebp)
+  802e01:	e8 ea e2 ff ff       	call   8010f0 <fd2data>
+  802e06:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e08:	83 c4 08             	add    $0x8,%esp
+  802e0b:	68 47 4c 80 00       	push   $0x804c47
+  802e10:	53                   	push   %ebx
+  802e11:	e8 86 d9 ff ff       	call   80079c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e16:	8b 46 04             	mov    0x4(%esi),%eax
+  802e19:	2b 06                	sub    (%esi),%eax
+  802e1b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e21:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e28:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e2b:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802e32:	52 80 00 
+	return 0;
+}
+  802e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3d:	5b                   	pop    %ebx
+  802e3e:	5e                   	pop    %esi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+
+00802e41 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802e41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e46:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802e4a:	85 c9                	test   %ecx,%ecx
+  802e4c:	75 01                	jne    802e4f <pipewake+0xe>
+  802e4e:	c3                   	ret
+{
+  802e4f:	55                   	push   %ebp
+  802e50:	89 e5                	mov    %esp,%ebp
+  802e52:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802e55:	68 00 04 00 00       	push   $0x400
+  802e5a:	52                   	push   %edx
+  802e5b:	e8 be e0 ff ff       	call   800f1e <sys_futex_wake>
+  802e60:	83 c4 10             	add    $0x10,%esp
+}
+  802e63:	c9                   	leave
+  802e64:	c3                   	ret
+
+00802e65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e65:	55                   	push   %ebp
+  802e66:	89 e5                	mov    %esp,%ebp
+  802e68:	56                   	push   %esi
+  802e69:	53                   	push   %ebx
+  802e6a:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e6d:	83 ec 0c             	sub    $0xc,%esp
+  802e70:	56                   	push   %esi
+  802e71:	e8 7a e2 ff ff       	call   8010f0 <fd2data>
+  802e76:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802e78:	83 c4 08             	add    $0x8,%esp
+  802e7b:	56                   	push   %esi
+  802e7c:	6a 00                	push   $0x0
+  802e7e:	e8 f0 dd ff ff       	call   800c73 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802e83:	8d 53 04             	lea    0x4(%ebx),%edx
+  802e86:	8d 43 08             	lea    0x8(%ebx),%eax
+  802e89:	e8 b3 ff ff ff       	call   802e41 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802e8e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802e91:	89 da                	mov    %ebx,%edx
+  802e93:	e8 a9 ff ff ff       	call   802e41 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802e98:	89 34 24             	mov    %esi,(%esp)
+  802e9b:	e8 50 e2 ff ff       	call   8010f0 <fd2data>
+  802ea0:	83 c4 08             	add    $0x8,%esp
+  802ea3:	50                   	push   %eax
+  802ea4:	6a 00                	push   $0x0
+  802ea6:	e8 c8 dd ff ff       	call   800c73 <sys_page_unmap>
+}
+  802eab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eae:	5b                   	pop    %ebx
+  802eaf:	5e                   	pop    %esi
+  802eb0:	5d                   	pop    %ebp
+  802eb1:	c3                   	ret
+
+00802eb2 <_pipeisclosed>:
+{
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	57                   	push   %edi
+  802eb6:	56                   	push   %esi
+  802eb7:	53                   	push   %ebx
+  802eb8:	83 ec 1c             	sub    $0x1c,%esp
+  802ebb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ebe:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ec0:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802ec5:	eb 5d                	jmp    802f24 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802ec7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802ecd:	8b 02                	mov    (%edx),%eax
+  802ecf:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ed2:	83 ec 0c             	sub    $0xc,%esp
+  802ed5:	ff 75 e0             	push   -0x20(%ebp)
+  802ed8:	e8 88 15 00 00       	call   804465 <pageref>
+  802edd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ee0:	89 3c 24             	mov    %edi,(%esp)
+  802ee3:	e8 7d 15 00 00       	call   804465 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802ee8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802eea:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802ef0:	83 c4 10             	add    $0x10,%esp
+  802ef3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802ef9:	77 15                	ja     802f10 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802efb:	89 f2                	mov    %esi,%edx
+  802efd:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802eff:	c1 ea 10             	shr    $0x10,%edx
+  802f02:	74 0c                	je     802f10 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f04:	c1 e2 10             	shl    $0x10,%edx
+  802f07:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f0c:	29 d1                	sub    %edx,%ecx
+  802f0e:	eb 06                	jmp    802f16 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f10:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802f16:	8b 11                	mov    (%ecx),%edx
+  802f18:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f1b:	39 d3                	cmp    %edx,%ebx
+  802f1d:	74 6e                	je     802f8d <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f1f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f22:	74 24                	je     802f48 <_pipeisclosed+0x96>
+  802f24:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f26:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f2c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f31:	77 94                	ja     802ec7 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f33:	89 f0                	mov    %esi,%eax
+  802f35:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f37:	c1 e8 10             	shr    $0x10,%eax
+  802f3a:	74 8b                	je     802ec7 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f3c:	c1 e0 10             	shl    $0x10,%eax
+  802f3f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f44:	29 c2                	sub    %eax,%edx
+  802f46:	eb 85                	jmp    802ecd <_pipeisclosed+0x1b>
+  802f48:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f4a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f50:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f55:	77 18                	ja     802f6f <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f57:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f5c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f5e:	c1 e8 10             	shr    $0x10,%eax
+  802f61:	74 0c                	je     802f6f <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f63:	c1 e0 10             	shl    $0x10,%eax
+  802f66:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f6b:	29 c2                	sub    %eax,%edx
+  802f6d:	eb 06                	jmp    802f75 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802f6f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f75:	8b 02                	mov    (%edx),%eax
+  802f77:	8b 40 58             	mov    0x58(%eax),%eax
+  802f7a:	6a 01                	push   $0x1
+  802f7c:	50                   	push   %eax
+  802f7d:	53                   	push   %ebx
+  802f7e:	68 4e 4c 80 00       	push   $0x804c4e
+  802f83:	e8 30 d2 ff ff       	call   8001b8 <cprintf>
+  802f88:	83 c4 10             	add    $0x10,%esp
+  802f8b:	eb 97                	jmp    802f24 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802f8d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f90:	0f 94 c0             	sete   %al
+  802f93:	0f b6 c0             	movzbl %al,%eax
+}
+  802f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f99:	5b                   	pop    %ebx
+  802f9a:	5e                   	pop    %esi
+  802f9b:	5f                   	pop    %edi
+  802f9c:	5d                   	pop    %ebp
+  802f9d:	c3                   	ret
+
+00802f9e <devpipe_write>:
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	57                   	push   %edi
+  802fa2:	56                   	push   %esi
+  802fa3:	53                   	push   %ebx
+  802fa4:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802fa7:	ff 75 08             	push   0x8(%ebp)
+  802faa:	e8 41 e1 ff ff       	call   8010f0 <fd2data>
+  802faf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fb1:	83 c4 10             	add    $0x10,%esp
+  802fb4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802fbb:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802fbe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fc1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fc4:	0f 84 96 00 00 00    	je     803060 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802fca:	8d 73 08             	lea    0x8(%ebx),%esi
+  802fcd:	eb 32                	jmp    803001 <devpipe_write+0x63>
+  802fcf:	89 fa                	mov    %edi,%edx
+  802fd1:	89 f0                	mov    %esi,%eax
+  802fd3:	e8 69 fe ff ff       	call   802e41 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802fd8:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fdb:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802fde:	ba 01 00 00 00       	mov    $0x1,%edx
+  802fe3:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802fe8:	83 ec 04             	sub    $0x4,%esp
+  802feb:	6a 0a                	push   $0xa
+  802fed:	50                   	push   %eax
+  802fee:	53                   	push   %ebx
+  802fef:	e8 fb de ff ff       	call   800eef <sys_futex_wait>
+  802ff4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ff9:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802ffe:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803001:	8b 43 04             	mov    0x4(%ebx),%eax
+  803004:	8b 0b                	mov    (%ebx),%ecx
+  803006:	8d 51 20             	lea    0x20(%ecx),%edx
+  803009:	39 d0                	cmp    %edx,%eax
+  80300b:	72 1b                	jb     803028 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80300d:	89 da                	mov    %ebx,%edx
+  80300f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803012:	e8 9b fe ff ff       	call   802eb2 <_pipeisclosed>
+  803017:	85 c0                	test   %eax,%eax
+  803019:	74 b4                	je     802fcf <devpipe_write+0x31>
+				return 0;
+  80301b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803023:	5b                   	pop    %ebx
+  803024:	5e                   	pop    %esi
+  803025:	5f                   	pop    %edi
+  803026:	5d                   	pop    %ebp
+  803027:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80302b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80302e:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803032:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803035:	89 c2                	mov    %eax,%edx
+  803037:	c1 fa 1f             	sar    $0x1f,%edx
+  80303a:	89 d1                	mov    %edx,%ecx
+  80303c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80303f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803042:	83 e2 1f             	and    $0x1f,%edx
+  803045:	29 ca                	sub    %ecx,%edx
+  803047:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80304b:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80304f:	83 c0 01             	add    $0x1,%eax
+  803052:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803055:	83 c6 01             	add    $0x1,%esi
+  803058:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80305b:	e9 5e ff ff ff       	jmp    802fbe <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803060:	8d 53 04             	lea    0x4(%ebx),%edx
+  803063:	8d 43 08             	lea    0x8(%ebx),%eax
+  803066:	e8 d6 fd ff ff       	call   802e41 <pipewake>
+	return i;
+  80306b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80306e:	eb b0                	jmp    803020 <devpipe_write+0x82>
+
+00803070 <devpipe_read>:
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	57                   	push   %edi
+  803074:	56                   	push   %esi
+  803075:	53                   	push   %ebx
+  803076:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803079:	ff 75 08             	push   0x8(%ebp)
+  80307c:	e8 6f e0 ff ff       	call   8010f0 <fd2data>
+  803081:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803083:	83 c4 10             	add    $0x10,%esp
+  803086:	be 00 00 00 00       	mov    $0x0,%esi
+  80308b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80308e:	74 6c                	je     8030fc <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803090:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803093:	eb 25                	jmp    8030ba <devpipe_read+0x4a>
+  803095:	8b 13                	mov    (%ebx),%edx
+  803097:	b8 01 00 00 00       	mov    $0x1,%eax
+  80309c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030a1:	83 ec 04             	sub    $0x4,%esp
+  8030a4:	6a 0a                	push   $0xa
+  8030a6:	52                   	push   %edx
+  8030a7:	57                   	push   %edi
+  8030a8:	e8 42 de ff ff       	call   800eef <sys_futex_wait>
+  8030ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030b2:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8030b7:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8030ba:	8b 03                	mov    (%ebx),%eax
+  8030bc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030bf:	75 19                	jne    8030da <devpipe_read+0x6a>
+			if (i > 0)
+  8030c1:	85 f6                	test   %esi,%esi
+  8030c3:	75 3a                	jne    8030ff <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8030c5:	89 da                	mov    %ebx,%edx
+  8030c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ca:	e8 e3 fd ff ff       	call   802eb2 <_pipeisclosed>
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	74 c2                	je     803095 <devpipe_read+0x25>
+				return 0;
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d8:	eb 31                	jmp    80310b <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030da:	89 c1                	mov    %eax,%ecx
+  8030dc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8030df:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030e2:	01 c8                	add    %ecx,%eax
+  8030e4:	83 e0 1f             	and    $0x1f,%eax
+  8030e7:	29 c8                	sub    %ecx,%eax
+  8030e9:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8030ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030f1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030f4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030f7:	83 c6 01             	add    $0x1,%esi
+  8030fa:	eb 8f                	jmp    80308b <devpipe_read+0x1b>
+out:
+  8030fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8030ff:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803102:	89 da                	mov    %ebx,%edx
+  803104:	e8 38 fd ff ff       	call   802e41 <pipewake>
+	return i;
+  803109:	89 f0                	mov    %esi,%eax
+}
+  80310b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310e:	5b                   	pop    %ebx
+  80310f:	5e                   	pop    %esi
+  803110:	5f                   	pop    %edi
+  803111:	5d                   	pop    %ebp
+  803112:	c3                   	ret
+
+00803113 <pipe>:
+{
+  803113:	55                   	push   %ebp
+  803114:	89 e5                	mov    %esp,%ebp
+  803116:	56                   	push   %esi
+  803117:	53                   	push   %ebx
+  803118:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80311b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80311e:	50                   	push   %eax
+  80311f:	e8 e3 df ff ff       	call   801107 <fd_alloc>
+  803124:	89 c3                	mov    %eax,%ebx
+  803126:	83 c4 10             	add    $0x10,%esp
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	0f 88 23 01 00 00    	js     803254 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803131:	83 ec 04             	sub    $0x4,%esp
+  803134:	68 07 04 00 00       	push   $0x407
+  803139:	ff 75 f4             	push   -0xc(%ebp)
+  80313c:	6a 00                	push   $0x0
+  80313e:	e8 97 da ff ff       	call   800bda <sys_page_alloc>
+  803143:	89 c3                	mov    %eax,%ebx
+  803145:	83 c4 10             	add    $0x10,%esp
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	0f 88 04 01 00 00    	js     803254 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803150:	83 ec 0c             	sub    $0xc,%esp
+  803153:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803156:	50                   	push   %eax
+  803157:	e8 ab df ff ff       	call   801107 <fd_alloc>
+  80315c:	89 c3                	mov    %eax,%ebx
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	85 c0                	test   %eax,%eax
+  803163:	0f 88 db 00 00 00    	js     803244 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803169:	83 ec 04             	sub    $0x4,%esp
+  80316c:	68 07 04 00 00       	push   $0x407
+  803171:	ff 75 f0             	push   -0x10(%ebp)
+  803174:	6a 00                	push   $0x0
+  803176:	e8 5f da ff ff       	call   800bda <sys_page_alloc>
+  80317b:	89 c3                	mov    %eax,%ebx
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	85 c0                	test   %eax,%eax
+  803182:	0f 88 bc 00 00 00    	js     803244 <pipe+0x131>
+	va = fd2data(fd0);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	ff 75 f4             	push   -0xc(%ebp)
+  80318e:	e8 5d df ff ff       	call   8010f0 <fd2data>
+  803193:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803195:	83 c4 0c             	add    $0xc,%esp
+  803198:	68 07 04 00 00       	push   $0x407
+  80319d:	50                   	push   %eax
+  80319e:	6a 00                	push   $0x0
+  8031a0:	e8 35 da ff ff       	call   800bda <sys_page_alloc>
+  8031a5:	89 c3                	mov    %eax,%ebx
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	0f 88 82 00 00 00    	js     803234 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031b2:	83 ec 0c             	sub    $0xc,%esp
+  8031b5:	ff 75 f0             	push   -0x10(%ebp)
+  8031b8:	e8 33 df ff ff       	call   8010f0 <fd2data>
+  8031bd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031c4:	50                   	push   %eax
+  8031c5:	6a 00                	push   $0x0
+  8031c7:	56                   	push   %esi
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	e8 58 da ff ff       	call   800c27 <sys_page_map>
+  8031cf:	89 c3                	mov    %eax,%ebx
+  8031d1:	83 c4 20             	add    $0x20,%esp
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	78 4e                	js     803226 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031d8:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8031dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031e0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031e5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031ec:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031ef:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031f4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031fb:	83 ec 0c             	sub    $0xc,%esp
+  8031fe:	ff 75 f4             	push   -0xc(%ebp)
+  803201:	e8 da de ff ff       	call   8010e0 <fd2num>
+  803206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803209:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80320b:	83 c4 04             	add    $0x4,%esp
+  80320e:	ff 75 f0             	push   -0x10(%ebp)
+  803211:	e8 ca de ff ff       	call   8010e0 <fd2num>
+  803216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803219:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803224:	eb 2e                	jmp    803254 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803226:	83 ec 08             	sub    $0x8,%esp
+  803229:	56                   	push   %esi
+  80322a:	6a 00                	push   $0x0
+  80322c:	e8 42 da ff ff       	call   800c73 <sys_page_unmap>
+  803231:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803234:	83 ec 08             	sub    $0x8,%esp
+  803237:	ff 75 f0             	push   -0x10(%ebp)
+  80323a:	6a 00                	push   $0x0
+  80323c:	e8 32 da ff ff       	call   800c73 <sys_page_unmap>
+  803241:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803244:	83 ec 08             	sub    $0x8,%esp
+  803247:	ff 75 f4             	push   -0xc(%ebp)
+  80324a:	6a 00                	push   $0x0
+  80324c:	e8 22 da ff ff       	call   800c73 <sys_page_unmap>
+  803251:	83 c4 10             	add    $0x10,%esp
+}
+  803254:	89 d8                	mov    %ebx,%eax
+  803256:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803259:	5b                   	pop    %ebx
+  80325a:	5e                   	pop    %esi
+  80325b:	5d                   	pop    %ebp
+  80325c:	c3                   	ret
+
+0080325d <pipeisclosed>:
+{
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803263:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803266:	50                   	push   %eax
+  803267:	ff 75 08             	push   0x8(%ebp)
+  80326a:	e8 ee de ff ff       	call   80115d <fd_lookup>
+  80326f:	83 c4 10             	add    $0x10,%esp
+  803272:	85 c0                	test   %eax,%eax
+  803274:	78 18                	js     80328e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803276:	83 ec 0c             	sub    $0xc,%esp
+  803279:	ff 75 f4             	push   -0xc(%ebp)
+  80327c:	e8 6f de ff ff       	call   8010f0 <fd2data>
+  803281:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803286:	e8 27 fc ff ff       	call   802eb2 <_pipeisclosed>
+  80328b:	83 c4 10             	add    $0x10,%esp
+}
+  80328e:	c9                   	leave
+  80328f:	c3                   	ret
+
+00803290 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803290:	55                   	push   %ebp
+  803291:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803293:	8b 45 08             	mov    0x8(%ebp),%eax
+  803296:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80329c:	5d                   	pop    %ebp
+  80329d:	c3                   	ret
+
+0080329e <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80329e:	55                   	push   %ebp
+  80329f:	89 e5                	mov    %esp,%ebp
+  8032a1:	56                   	push   %esi
+  8032a2:	53                   	push   %ebx
+  8032a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8032a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8032b0:	89 d0                	mov    %edx,%eax
+  8032b2:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8032b6:	85 c0                	test   %eax,%eax
+  8032b8:	74 2d                	je     8032e7 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8032ba:	83 f8 02             	cmp    $0x2,%eax
+  8032bd:	74 08                	je     8032c7 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8032bf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8032c4:	f0 87 03             	lock xchg %eax,(%ebx)
+  8032c7:	be 02 00 00 00       	mov    $0x2,%esi
+  8032cc:	eb 15                	jmp    8032e3 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8032ce:	83 ec 04             	sub    $0x4,%esp
+  8032d1:	6a 00                	push   $0x0
+  8032d3:	6a 02                	push   $0x2
+  8032d5:	53                   	push   %ebx
+  8032d6:	e8 14 dc ff ff       	call   800eef <sys_futex_wait>
+  8032db:	89 f0                	mov    %esi,%eax
+  8032dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  8032e0:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8032e3:	85 c0                	test   %eax,%eax
+  8032e5:	75 e7                	jne    8032ce <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8032e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032ea:	5b                   	pop    %ebx
+  8032eb:	5e                   	pop    %esi
+  8032ec:	5d                   	pop    %ebp
+  8032ed:	c3                   	ret
+
+008032ee <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8032ee:	55                   	push   %ebp
+  8032ef:	89 e5                	mov    %esp,%ebp
+  8032f1:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8032f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8032fe:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803302:	f7 d8                	neg    %eax
+  803304:	19 c0                	sbb    %eax,%eax
+  803306:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803309:	5d                   	pop    %ebp
+  80330a:	c3                   	ret
+
+0080330b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80330b:	55                   	push   %ebp
+  80330c:	89 e5                	mov    %esp,%ebp
+  80330e:	83 ec 08             	sub    $0x8,%esp
+  803311:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803314:	b8 00 00 00 00       	mov    $0x0,%eax
+  803319:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80331c:	83 f8 02             	cmp    $0x2,%eax
+  80331f:	74 02                	je     803323 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803321:	c9                   	leave
+  803322:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803323:	83 ec 08             	sub    $0x8,%esp
+  803326:	6a 01                	push   $0x1
+  803328:	52                   	push   %edx
+  803329:	e8 f0 db ff ff       	call   800f1e <sys_futex_wake>
+  80332e:	83 c4 10             	add    $0x10,%esp
+}
+  803331:	eb ee                	jmp    803321 <mutex_unlock+0x16>
+
+00803333 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803333:	55                   	push   %ebp
+  803334:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803336:	8b 45 08             	mov    0x8(%ebp),%eax
+  803339:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80333f:	5d                   	pop    %ebp
+  803340:	c3                   	ret
+
+00803341 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803341:	55                   	push   %ebp
+  803342:	89 e5                	mov    %esp,%ebp
+  803344:	57                   	push   %edi
+  803345:	56                   	push   %esi
+  803346:	53                   	push   %ebx
+  803347:	83 ec 18             	sub    $0x18,%esp
+  80334a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80334d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803350:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803352:	53                   	push   %ebx
+  803353:	e8 b3 ff ff ff       	call   80330b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803358:	83 c4 0c             	add    $0xc,%esp
+  80335b:	ff 75 10             	push   0x10(%ebp)
+  80335e:	57                   	push   %edi
+  80335f:	56                   	push   %esi
+  803360:	e8 8a db ff ff       	call   800eef <sys_futex_wait>
+  803365:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803367:	83 c4 10             	add    $0x10,%esp
+  80336a:	be 02 00 00 00       	mov    $0x2,%esi
+  80336f:	eb 10                	jmp    803381 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803371:	83 ec 04             	sub    $0x4,%esp
+  803374:	6a 00                	push   $0x0
+  803376:	6a 02                	push   $0x2
+  803378:	53                   	push   %ebx
+  803379:	e8 71 db ff ff       	call   800eef <sys_futex_wait>
+  80337e:	83 c4 10             	add    $0x10,%esp
+  803381:	89 f0                	mov    %esi,%eax
+  803383:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803386:	85 c0                	test   %eax,%eax
+  803388:	75 e7                	jne    803371 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80338a:	83 ff ec             	cmp    $0xffffffec,%edi
+  80338d:	74 05                	je     803394 <cond_timedwait+0x53>
+  80338f:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803394:	89 f8                	mov    %edi,%eax
+  803396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803399:	5b                   	pop    %ebx
+  80339a:	5e                   	pop    %esi
+  80339b:	5f                   	pop    %edi
+  80339c:	5d                   	pop    %ebp
+  80339d:	c3                   	ret
+
+0080339e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8033a4:	6a 00                	push   $0x0
+  8033a6:	ff 75 0c             	push   0xc(%ebp)
+  8033a9:	ff 75 08             	push   0x8(%ebp)
+  8033ac:	e8 90 ff ff ff       	call   803341 <cond_timedwait>
+}
+  8033b1:	83 c4 10             	add    $0x10,%esp
+  8033b4:	c9                   	leave
+  8033b5:	c3                   	ret
+
+008033b6 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8033b6:	55                   	push   %ebp
+  8033b7:	89 e5                	mov    %esp,%ebp
+  8033b9:	83 ec 10             	sub    $0x10,%esp
+  8033bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8033bf:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033c4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8033c8:	6a 01                	push   $0x1
+  8033ca:	50                   	push   %eax
+  8033cb:	e8 4e db ff ff       	call   800f1e <sys_futex_wake>
+}
+  8033d0:	83 c4 10             	add    $0x10,%esp
+  8033d3:	c9                   	leave
+  8033d4:	c3                   	ret
+
+008033d5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8033d5:	55                   	push   %ebp
+  8033d6:	89 e5                	mov    %esp,%ebp
+  8033d8:	83 ec 10             	sub    $0x10,%esp
+  8033db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033de:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033e3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8033e7:	68 00 04 00 00       	push   $0x400
+  8033ec:	50                   	push   %eax
+  8033ed:	e8 2c db ff ff       	call   800f1e <sys_futex_wake>
+}
+  8033f2:	83 c4 10             	add    $0x10,%esp
+  8033f5:	c9                   	leave
+  8033f6:	c3                   	ret
+
+008033f7 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8033f7:	55                   	push   %ebp
+  8033f8:	89 e5                	mov    %esp,%ebp
+  8033fa:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8033fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803400:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803402:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803409:	5d                   	pop    %ebp
+  80340a:	c3                   	ret
+
+0080340b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80340b:	55                   	push   %ebp
+  80340c:	89 e5                	mov    %esp,%ebp
+  80340e:	53                   	push   %ebx
+  80340f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803412:	8b 11                	mov    (%ecx),%edx
+  803414:	85 d2                	test   %edx,%edx
+  803416:	74 14                	je     80342c <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803418:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80341b:	89 d0                	mov    %edx,%eax
+  80341d:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803421:	39 c2                	cmp    %eax,%edx
+  803423:	75 ed                	jne    803412 <sem_trywait+0x7>
+			return 0;
+  803425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342a:	eb 05                	jmp    803431 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80342c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803434:	c9                   	leave
+  803435:	c3                   	ret
+
+00803436 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803436:	55                   	push   %ebp
+  803437:	89 e5                	mov    %esp,%ebp
+  803439:	57                   	push   %edi
+  80343a:	56                   	push   %esi
+  80343b:	53                   	push   %ebx
+  80343c:	83 ec 1c             	sub    $0x1c,%esp
+  80343f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803442:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803445:	e8 1d da ff ff       	call   800e67 <sys_time_msec>
+  80344a:	01 f8                	add    %edi,%eax
+  80344c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80344f:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803454:	eb 28                	jmp    80347e <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803456:	b8 01 00 00 00       	mov    $0x1,%eax
+  80345b:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803460:	83 ec 04             	sub    $0x4,%esp
+  803463:	56                   	push   %esi
+  803464:	6a 00                	push   $0x0
+  803466:	53                   	push   %ebx
+  803467:	e8 83 da ff ff       	call   800eef <sys_futex_wait>
+  80346c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803471:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803476:	83 c4 10             	add    $0x10,%esp
+  803479:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80347c:	74 2e                	je     8034ac <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80347e:	83 ec 0c             	sub    $0xc,%esp
+  803481:	53                   	push   %ebx
+  803482:	e8 84 ff ff ff       	call   80340b <sem_trywait>
+  803487:	83 c4 10             	add    $0x10,%esp
+  80348a:	85 c0                	test   %eax,%eax
+  80348c:	79 19                	jns    8034a7 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  80348e:	85 ff                	test   %edi,%edi
+  803490:	74 c4                	je     803456 <sem_timedwait+0x20>
+  803492:	e8 d0 d9 ff ff       	call   800e67 <sys_time_msec>
+  803497:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80349a:	29 c6                	sub    %eax,%esi
+  80349c:	85 f6                	test   %esi,%esi
+  80349e:	7f b6                	jg     803456 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8034a0:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8034a5:	eb 05                	jmp    8034ac <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8034a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034af:	5b                   	pop    %ebx
+  8034b0:	5e                   	pop    %esi
+  8034b1:	5f                   	pop    %edi
+  8034b2:	5d                   	pop    %ebp
+  8034b3:	c3                   	ret
+
+008034b4 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8034b4:	55                   	push   %ebp
+  8034b5:	89 e5                	mov    %esp,%ebp
+  8034b7:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8034ba:	6a 00                	push   $0x0
+  8034bc:	ff 75 08             	push   0x8(%ebp)
+  8034bf:	e8 72 ff ff ff       	call   803436 <sem_timedwait>
+}
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	c9                   	leave
+  8034c8:	c3                   	ret
+
+008034c9 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8034c9:	55                   	push   %ebp
+  8034ca:	89 e5                	mov    %esp,%ebp
+  8034cc:	83 ec 08             	sub    $0x8,%esp
+  8034cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034d7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8034db:	8b 50 04             	mov    0x4(%eax),%edx
+  8034de:	85 d2                	test   %edx,%edx
+  8034e0:	75 02                	jne    8034e4 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8034e2:	c9                   	leave
+  8034e3:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8034e4:	83 ec 08             	sub    $0x8,%esp
+  8034e7:	6a 01                	push   $0x1
+  8034e9:	50                   	push   %eax
+  8034ea:	e8 2f da ff ff       	call   800f1e <sys_futex_wake>
+  8034ef:	83 c4 10             	add    $0x10,%esp
+}
+  8034f2:	eb ee                	jmp    8034e2 <sem_post+0x19>
+
+008034f4 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8034f4:	55                   	push   %ebp
+  8034f5:	89 e5                	mov    %esp,%ebp
+  8034f7:	57                   	push   %edi
+  8034f8:	56                   	push   %esi
+  8034f9:	53                   	push   %ebx
+  8034fa:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8034fd:	68 20 60 80 00       	push   $0x806020
+  803502:	e8 97 fd ff ff       	call   80329e <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803507:	a1 44 60 80 00       	mov    0x806044,%eax
+  80350c:	83 c4 10             	add    $0x10,%esp
+  80350f:	85 c0                	test   %eax,%eax
+  803511:	75 19                	jne    80352c <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803513:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803518:	8b 00                	mov    (%eax),%eax
+  80351a:	8b 40 48             	mov    0x48(%eax),%eax
+  80351d:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803522:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803529:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80352c:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803531:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803534:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80353b:	8b 40 04             	mov    0x4(%eax),%eax
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	0f 84 e4 00 00 00    	je     80362a <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803546:	83 c3 01             	add    $0x1,%ebx
+  803549:	83 fb 20             	cmp    $0x20,%ebx
+  80354c:	75 e3                	jne    803531 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  80354e:	83 ec 0c             	sub    $0xc,%esp
+  803551:	68 20 60 80 00       	push   $0x806020
+  803556:	e8 b0 fd ff ff       	call   80330b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80355b:	83 c4 10             	add    $0x10,%esp
+  80355e:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803563:	e9 b8 00 00 00       	jmp    803620 <pthread_create+0x12c>
+  803568:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80356b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80356e:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803570:	39 f3                	cmp    %esi,%ebx
+  803572:	73 16                	jae    80358a <pthread_create+0x96>
+		va -= PGSIZE;
+  803574:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80357a:	83 ec 08             	sub    $0x8,%esp
+  80357d:	56                   	push   %esi
+  80357e:	6a 00                	push   $0x0
+  803580:	e8 ee d6 ff ff       	call   800c73 <sys_page_unmap>
+  803585:	83 c4 10             	add    $0x10,%esp
+  803588:	eb e6                	jmp    803570 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80358a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80358d:	83 ec 08             	sub    $0x8,%esp
+  803590:	ff 75 e4             	push   -0x1c(%ebp)
+  803593:	6a 00                	push   $0x0
+  803595:	e8 d9 d6 ff ff       	call   800c73 <sys_page_unmap>
+	return r;
+  80359a:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80359d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035a0:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035a7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8035ae:	eb 70                	jmp    803620 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8035b0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035b3:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035bd:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8035c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035c3:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8035c6:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8035cd:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8035d2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8035d5:	29 c8                	sub    %ecx,%eax
+  8035d7:	85 db                	test   %ebx,%ebx
+  8035d9:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  8035e0:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8035e3:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8035ea:	83 ec 04             	sub    $0x4,%esp
+  8035ed:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035f2:	29 ca                	sub    %ecx,%edx
+  8035f4:	52                   	push   %edx
+	*--esp = 0;
+  8035f5:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8035f8:	50                   	push   %eax
+  8035f9:	68 51 38 80 00       	push   $0x803851
+  8035fe:	e8 c0 d9 ff ff       	call   800fc3 <sys_thread_create>
+  803603:	89 c7                	mov    %eax,%edi
+  803605:	83 c4 10             	add    $0x10,%esp
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	78 91                	js     80359d <pthread_create+0xa9>
+	th->th_env = id;
+  80360c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80360f:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803616:	8b 45 08             	mov    0x8(%ebp),%eax
+  803619:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  80361b:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803620:	89 f8                	mov    %edi,%eax
+  803622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803625:	5b                   	pop    %ebx
+  803626:	5e                   	pop    %esi
+  803627:	5f                   	pop    %edi
+  803628:	5d                   	pop    %ebp
+  803629:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  80362a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80362d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803634:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  80363b:	83 ec 0c             	sub    $0xc,%esp
+  80363e:	68 20 60 80 00       	push   $0x806020
+  803643:	e8 c3 fc ff ff       	call   80330b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803648:	89 d9                	mov    %ebx,%ecx
+  80364a:	c1 e1 10             	shl    $0x10,%ecx
+  80364d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803650:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803655:	29 c8                	sub    %ecx,%eax
+  803657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80365a:	c1 e8 16             	shr    $0x16,%eax
+  80365d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803664:	83 c4 10             	add    $0x10,%esp
+  803667:	a8 01                	test   $0x1,%al
+  803669:	74 15                	je     803680 <pthread_create+0x18c>
+  80366b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80366e:	c1 e8 0c             	shr    $0xc,%eax
+  803671:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803678:	a8 01                	test   $0x1,%al
+  80367a:	0f 85 30 ff ff ff    	jne    8035b0 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803680:	83 ec 04             	sub    $0x4,%esp
+  803683:	6a 07                	push   $0x7
+  803685:	ff 75 e4             	push   -0x1c(%ebp)
+  803688:	6a 00                	push   $0x0
+  80368a:	e8 4b d5 ff ff       	call   800bda <sys_page_alloc>
+  80368f:	89 c7                	mov    %eax,%edi
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	85 c0                	test   %eax,%eax
+  803696:	0f 88 01 ff ff ff    	js     80359d <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80369c:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8036a1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8036a4:	29 d0                	sub    %edx,%eax
+  8036a6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8036a9:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8036ab:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8036b0:	29 d0                	sub    %edx,%eax
+  8036b2:	89 c7                	mov    %eax,%edi
+  8036b4:	39 fe                	cmp    %edi,%esi
+  8036b6:	0f 83 f4 fe ff ff    	jae    8035b0 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036bc:	83 ec 04             	sub    $0x4,%esp
+  8036bf:	6a 07                	push   $0x7
+  8036c1:	56                   	push   %esi
+  8036c2:	6a 00                	push   $0x0
+  8036c4:	e8 11 d5 ff ff       	call   800bda <sys_page_alloc>
+  8036c9:	83 c4 10             	add    $0x10,%esp
+  8036cc:	85 c0                	test   %eax,%eax
+  8036ce:	0f 88 94 fe ff ff    	js     803568 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8036d4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8036da:	eb d8                	jmp    8036b4 <pthread_create+0x1c0>
+
+008036dc <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	57                   	push   %edi
+  8036e0:	56                   	push   %esi
+  8036e1:	53                   	push   %ebx
+  8036e2:	83 ec 0c             	sub    $0xc,%esp
+  8036e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8036e8:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8036eb:	83 f8 1e             	cmp    $0x1e,%eax
+  8036ee:	0f 87 c7 00 00 00    	ja     8037bb <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8036f4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036f6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036fc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803701:	77 12                	ja     803715 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803703:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803708:	29 d0                	sub    %edx,%eax
+  80370a:	c1 e8 10             	shr    $0x10,%eax
+  80370d:	39 c3                	cmp    %eax,%ebx
+  80370f:	0f 84 ad 00 00 00    	je     8037c2 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803715:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803718:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80371f:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803726:	eb 10                	jmp    803738 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803728:	83 ec 04             	sub    $0x4,%esp
+  80372b:	6a 00                	push   $0x0
+  80372d:	6a 01                	push   $0x1
+  80372f:	57                   	push   %edi
+  803730:	e8 ba d7 ff ff       	call   800eef <sys_futex_wait>
+  803735:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803738:	8b 46 04             	mov    0x4(%esi),%eax
+  80373b:	83 f8 01             	cmp    $0x1,%eax
+  80373e:	74 e8                	je     803728 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803740:	83 f8 02             	cmp    $0x2,%eax
+  803743:	0f 85 80 00 00 00    	jne    8037c9 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803749:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80374c:	c1 e6 02             	shl    $0x2,%esi
+  80374f:	eb 05                	jmp    803756 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803751:	e8 58 d4 ff ff       	call   800bae <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803756:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  80375c:	89 ca                	mov    %ecx,%edx
+  80375e:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803764:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803767:	c1 e0 04             	shl    $0x4,%eax
+  80376a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80376f:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803772:	39 c1                	cmp    %eax,%ecx
+  803774:	75 12                	jne    803788 <pthread_join+0xac>
+  803776:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803779:	c1 e0 04             	shl    $0x4,%eax
+  80377c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803781:	8b 40 54             	mov    0x54(%eax),%eax
+  803784:	85 c0                	test   %eax,%eax
+  803786:	75 c9                	jne    803751 <pthread_join+0x75>
+	if (ret_store)
+  803788:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80378c:	74 0f                	je     80379d <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  80378e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803791:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803798:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80379b:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80379d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037a0:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8037a7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8037ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b6:	5b                   	pop    %ebx
+  8037b7:	5e                   	pop    %esi
+  8037b8:	5f                   	pop    %edi
+  8037b9:	5d                   	pop    %ebp
+  8037ba:	c3                   	ret
+		return -E_INVAL;
+  8037bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037c0:	eb f1                	jmp    8037b3 <pthread_join+0xd7>
+  8037c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037c7:	eb ea                	jmp    8037b3 <pthread_join+0xd7>
+		return -E_INVAL;
+  8037c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037ce:	eb e3                	jmp    8037b3 <pthread_join+0xd7>
+
+008037d0 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8037d0:	55                   	push   %ebp
+  8037d1:	89 e5                	mov    %esp,%ebp
+  8037d3:	53                   	push   %ebx
+  8037d4:	83 ec 04             	sub    $0x4,%esp
+  8037d7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037d9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037df:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037e4:	77 0c                	ja     8037f2 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037e6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8037eb:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8037ed:	c1 e8 10             	shr    $0x10,%eax
+  8037f0:	75 0a                	jne    8037fc <pthread_exit+0x2c>
+		exit();
+  8037f2:	e8 04 c9 ff ff       	call   8000fb <exit>
+  8037f7:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8037fc:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803803:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803806:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80380d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803810:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803813:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80381a:	83 ec 08             	sub    $0x8,%esp
+  80381d:	6a 20                	push   $0x20
+  80381f:	01 c2                	add    %eax,%edx
+  803821:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803828:	50                   	push   %eax
+  803829:	e8 f0 d6 ff ff       	call   800f1e <sys_futex_wake>
+	sys_env_destroy(0);
+  80382e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803835:	e8 fd d2 ff ff       	call   800b37 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80383a:	83 c4 0c             	add    $0xc,%esp
+  80383d:	68 66 4c 80 00       	push   $0x804c66
+  803842:	68 a5 00 00 00       	push   $0xa5
+  803847:	68 80 4c 80 00       	push   $0x804c80
+  80384c:	e8 cd 03 00 00       	call   803c1e <_panic>
+
+00803851 <pthread_start>:
+{
+  803851:	55                   	push   %ebp
+  803852:	89 e5                	mov    %esp,%ebp
+  803854:	53                   	push   %ebx
+  803855:	83 ec 04             	sub    $0x4,%esp
+  803858:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80385b:	e8 22 d3 ff ff       	call   800b82 <sys_getenvid>
+  803860:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803865:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  80386b:	85 db                	test   %ebx,%ebx
+  80386d:	74 0c                	je     80387b <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80386f:	89 d9                	mov    %ebx,%ecx
+  803871:	c1 e1 10             	shl    $0x10,%ecx
+  803874:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803879:	29 ca                	sub    %ecx,%edx
+  80387b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80387e:	c1 e0 04             	shl    $0x4,%eax
+  803881:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803886:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803888:	83 ec 0c             	sub    $0xc,%esp
+  80388b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803892:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803895:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  80389c:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  8038a3:	89 04 24             	mov    %eax,(%esp)
+  8038a6:	e8 25 ff ff ff       	call   8037d0 <pthread_exit>
+
+008038ab <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8038ab:	55                   	push   %ebp
+  8038ac:	89 e5                	mov    %esp,%ebp
+  8038ae:	57                   	push   %edi
+  8038af:	56                   	push   %esi
+  8038b0:	53                   	push   %ebx
+  8038b1:	83 ec 1c             	sub    $0x1c,%esp
+  8038b4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038b6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8038bc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038c3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038c8:	77 0d                	ja     8038d7 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038ca:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038cf:	29 d0                	sub    %edx,%eax
+  8038d1:	c1 e8 10             	shr    $0x10,%eax
+  8038d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8038d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038dc:	eb 2f                	jmp    80390d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8038de:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038e4:	8b 01                	mov    (%ecx),%eax
+  8038e6:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8038e9:	39 c2                	cmp    %eax,%edx
+  8038eb:	75 14                	jne    803901 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8038ed:	83 ec 0c             	sub    $0xc,%esp
+  8038f0:	57                   	push   %edi
+  8038f1:	e8 41 d2 ff ff       	call   800b37 <sys_env_destroy>
+  8038f6:	83 c4 10             	add    $0x10,%esp
+  8038f9:	85 c0                	test   %eax,%eax
+  8038fb:	0f 88 97 00 00 00    	js     803998 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803901:	83 c3 01             	add    $0x1,%ebx
+  803904:	83 fb 20             	cmp    $0x20,%ebx
+  803907:	0f 84 d2 00 00 00    	je     8039df <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80390d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803910:	74 ef                	je     803901 <pthread_kill_others+0x56>
+  803912:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803915:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80391c:	8b 40 04             	mov    0x4(%eax),%eax
+  80391f:	83 f8 01             	cmp    $0x1,%eax
+  803922:	75 dd                	jne    803901 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803924:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803927:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  80392e:	89 fe                	mov    %edi,%esi
+  803930:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803936:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803939:	c1 e0 04             	shl    $0x4,%eax
+  80393c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803941:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803944:	39 c7                	cmp    %eax,%edi
+  803946:	75 b9                	jne    803901 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803948:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80394b:	c1 e0 04             	shl    $0x4,%eax
+  80394e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803953:	8b 40 54             	mov    0x54(%eax),%eax
+  803956:	85 c0                	test   %eax,%eax
+  803958:	74 a7                	je     803901 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80395a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80395d:	c1 e0 04             	shl    $0x4,%eax
+  803960:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803966:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803968:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80396e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803973:	0f 87 65 ff ff ff    	ja     8038de <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803979:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80397e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803980:	c1 e8 10             	shr    $0x10,%eax
+  803983:	0f 84 55 ff ff ff    	je     8038de <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803989:	c1 e0 10             	shl    $0x10,%eax
+  80398c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803991:	29 c1                	sub    %eax,%ecx
+  803993:	e9 4c ff ff ff       	jmp    8038e4 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803998:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80399b:	c1 e2 04             	shl    $0x4,%edx
+  80399e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039a4:	8b 52 48             	mov    0x48(%edx),%edx
+  8039a7:	39 fa                	cmp    %edi,%edx
+  8039a9:	0f 85 52 ff ff ff    	jne    803901 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8039af:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039b2:	c1 e2 04             	shl    $0x4,%edx
+  8039b5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039bb:	8b 52 54             	mov    0x54(%edx),%edx
+  8039be:	85 d2                	test   %edx,%edx
+  8039c0:	0f 84 3b ff ff ff    	je     803901 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8039c6:	83 ec 0c             	sub    $0xc,%esp
+  8039c9:	50                   	push   %eax
+  8039ca:	57                   	push   %edi
+  8039cb:	68 90 4c 80 00       	push   $0x804c90
+  8039d0:	68 bb 00 00 00       	push   $0xbb
+  8039d5:	68 80 4c 80 00       	push   $0x804c80
+  8039da:	e8 3f 02 00 00       	call   803c1e <_panic>
+	}
+}
+  8039df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039e2:	5b                   	pop    %ebx
+  8039e3:	5e                   	pop    %esi
+  8039e4:	5f                   	pop    %edi
+  8039e5:	5d                   	pop    %ebp
+  8039e6:	c3                   	ret
+
+008039e7 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8039e7:	55                   	push   %ebp
+  8039e8:	89 e5                	mov    %esp,%ebp
+  8039ea:	53                   	push   %ebx
+  8039eb:	83 ec 04             	sub    $0x4,%esp
+  8039ee:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039f0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8039f6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8039fc:	0f 87 85 00 00 00    	ja     803a87 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a02:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a07:	29 c3                	sub    %eax,%ebx
+  803a09:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a0c:	83 ec 04             	sub    $0x4,%esp
+  803a0f:	68 80 02 00 00       	push   $0x280
+  803a14:	6a 00                	push   $0x0
+  803a16:	68 40 60 80 00       	push   $0x806040
+  803a1b:	e8 cd ce ff ff       	call   8008ed <memset>
+	threads_mu.m_state = 0;
+  803a20:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a27:	00 00 00 
+	if (self != 0) {
+  803a2a:	83 c4 10             	add    $0x10,%esp
+  803a2d:	85 db                	test   %ebx,%ebx
+  803a2f:	74 51                	je     803a82 <pthread_fork_child+0x9b>
+  803a31:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a33:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a39:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a3e:	77 18                	ja     803a58 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a40:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a45:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803a47:	c1 e8 10             	shr    $0x10,%eax
+  803a4a:	74 0c                	je     803a58 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a4c:	c1 e0 10             	shl    $0x10,%eax
+  803a4f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803a54:	29 c2                	sub    %eax,%edx
+  803a56:	eb 06                	jmp    803a5e <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803a58:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803a5e:	8b 02                	mov    (%edx),%eax
+  803a60:	8b 48 48             	mov    0x48(%eax),%ecx
+  803a63:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803a6a:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803a6d:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803a74:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803a7b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803a82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a85:	c9                   	leave
+  803a86:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803a87:	83 ec 04             	sub    $0x4,%esp
+  803a8a:	68 80 02 00 00       	push   $0x280
+  803a8f:	6a 00                	push   $0x0
+  803a91:	68 40 60 80 00       	push   $0x806040
+  803a96:	e8 52 ce ff ff       	call   8008ed <memset>
+	threads_mu.m_state = 0;
+  803a9b:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803aa2:	00 00 00 
+  803aa5:	83 c4 10             	add    $0x10,%esp
+  803aa8:	eb d8                	jmp    803a82 <pthread_fork_child+0x9b>
+
+00803aaa <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aaf:	c3                   	ret
+
+00803ab0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ab0:	55                   	push   %ebp
+  803ab1:	89 e5                	mov    %esp,%ebp
+  803ab3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803ab6:	68 b5 4c 80 00       	push   $0x804cb5
+  803abb:	ff 75 0c             	push   0xc(%ebp)
+  803abe:	e8 d9 cc ff ff       	call   80079c <strcpy>
+	return 0;
+}
+  803ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac8:	c9                   	leave
+  803ac9:	c3                   	ret
+
+00803aca <devcons_write>:
+{
+  803aca:	55                   	push   %ebp
+  803acb:	89 e5                	mov    %esp,%ebp
+  803acd:	57                   	push   %edi
+  803ace:	56                   	push   %esi
+  803acf:	53                   	push   %ebx
+  803ad0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803ad6:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803adb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803ae1:	eb 2e                	jmp    803b11 <devcons_write+0x47>
+		m = n - tot;
+  803ae3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ae6:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803ae8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803aed:	39 c3                	cmp    %eax,%ebx
+  803aef:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803af2:	83 ec 04             	sub    $0x4,%esp
+  803af5:	53                   	push   %ebx
+  803af6:	89 f0                	mov    %esi,%eax
+  803af8:	03 45 0c             	add    0xc(%ebp),%eax
+  803afb:	50                   	push   %eax
+  803afc:	57                   	push   %edi
+  803afd:	e8 20 ce ff ff       	call   800922 <memmove>
+		sys_cputs(buf, m);
+  803b02:	83 c4 08             	add    $0x8,%esp
+  803b05:	53                   	push   %ebx
+  803b06:	57                   	push   %edi
+  803b07:	e8 d4 cf ff ff       	call   800ae0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b0c:	01 de                	add    %ebx,%esi
+  803b0e:	83 c4 10             	add    $0x10,%esp
+  803b11:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b14:	72 cd                	jb     803ae3 <devcons_write+0x19>
+}
+  803b16:	89 f0                	mov    %esi,%eax
+  803b18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b1b:	5b                   	pop    %ebx
+  803b1c:	5e                   	pop    %esi
+  803b1d:	5f                   	pop    %edi
+  803b1e:	5d                   	pop    %ebp
+  803b1f:	c3                   	ret
+
+00803b20 <devcons_read>:
+{
+  803b20:	55                   	push   %ebp
+  803b21:	89 e5                	mov    %esp,%ebp
+  803b23:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b2f:	75 07                	jne    803b38 <devcons_read+0x18>
+  803b31:	eb 1f                	jmp    803b52 <devcons_read+0x32>
+		sys_yield();
+  803b33:	e8 76 d0 ff ff       	call   800bae <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b38:	e8 ce cf ff ff       	call   800b0b <sys_cgetc>
+  803b3d:	85 c0                	test   %eax,%eax
+  803b3f:	74 f2                	je     803b33 <devcons_read+0x13>
+	if (c < 0)
+  803b41:	78 0f                	js     803b52 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b43:	83 f8 04             	cmp    $0x4,%eax
+  803b46:	74 0c                	je     803b54 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b4b:	88 02                	mov    %al,(%edx)
+	return 1;
+  803b4d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b52:	c9                   	leave
+  803b53:	c3                   	ret
+		return 0;
+  803b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b59:	eb f7                	jmp    803b52 <devcons_read+0x32>
+
+00803b5b <cputchar>:
+{
+  803b5b:	55                   	push   %ebp
+  803b5c:	89 e5                	mov    %esp,%ebp
+  803b5e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b64:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803b67:	6a 01                	push   $0x1
+  803b69:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b6c:	50                   	push   %eax
+  803b6d:	e8 6e cf ff ff       	call   800ae0 <sys_cputs>
+}
+  803b72:	83 c4 10             	add    $0x10,%esp
+  803b75:	c9                   	leave
+  803b76:	c3                   	ret
+
+00803b77 <getchar>:
+{
+  803b77:	55                   	push   %ebp
+  803b78:	89 e5                	mov    %esp,%ebp
+  803b7a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803b7d:	6a 01                	push   $0x1
+  803b7f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b82:	50                   	push   %eax
+  803b83:	6a 00                	push   $0x0
+  803b85:	e8 63 d8 ff ff       	call   8013ed <read>
+	if (r < 0)
+  803b8a:	83 c4 10             	add    $0x10,%esp
+  803b8d:	85 c0                	test   %eax,%eax
+  803b8f:	78 06                	js     803b97 <getchar+0x20>
+	if (r < 1)
+  803b91:	74 06                	je     803b99 <getchar+0x22>
+	return c;
+  803b93:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b97:	c9                   	leave
+  803b98:	c3                   	ret
+		return -E_EOF;
+  803b99:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b9e:	eb f7                	jmp    803b97 <getchar+0x20>
+
+00803ba0 <iscons>:
+{
+  803ba0:	55                   	push   %ebp
+  803ba1:	89 e5                	mov    %esp,%ebp
+  803ba3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ba6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ba9:	50                   	push   %eax
+  803baa:	ff 75 08             	push   0x8(%ebp)
+  803bad:	e8 ab d5 ff ff       	call   80115d <fd_lookup>
+  803bb2:	83 c4 10             	add    $0x10,%esp
+  803bb5:	85 c0                	test   %eax,%eax
+  803bb7:	78 11                	js     803bca <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803bb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bbc:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803bc2:	39 10                	cmp    %edx,(%eax)
+  803bc4:	0f 94 c0             	sete   %al
+  803bc7:	0f b6 c0             	movzbl %al,%eax
+}
+  803bca:	c9                   	leave
+  803bcb:	c3                   	ret
+
+00803bcc <opencons>:
+{
+  803bcc:	55                   	push   %ebp
+  803bcd:	89 e5                	mov    %esp,%ebp
+  803bcf:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803bd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bd5:	50                   	push   %eax
+  803bd6:	e8 2c d5 ff ff       	call   801107 <fd_alloc>
+  803bdb:	83 c4 10             	add    $0x10,%esp
+  803bde:	85 c0                	test   %eax,%eax
+  803be0:	78 3a                	js     803c1c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803be2:	83 ec 04             	sub    $0x4,%esp
+  803be5:	68 07 04 00 00       	push   $0x407
+  803bea:	ff 75 f4             	push   -0xc(%ebp)
+  803bed:	6a 00                	push   $0x0
+  803bef:	e8 e6 cf ff ff       	call   800bda <sys_page_alloc>
+  803bf4:	83 c4 10             	add    $0x10,%esp
+  803bf7:	85 c0                	test   %eax,%eax
+  803bf9:	78 21                	js     803c1c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803bfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bfe:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c04:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c09:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c10:	83 ec 0c             	sub    $0xc,%esp
+  803c13:	50                   	push   %eax
+  803c14:	e8 c7 d4 ff ff       	call   8010e0 <fd2num>
+  803c19:	83 c4 10             	add    $0x10,%esp
+}
+  803c1c:	c9                   	leave
+  803c1d:	c3                   	ret
+
+00803c1e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803c1e:	55                   	push   %ebp
+  803c1f:	89 e5                	mov    %esp,%ebp
+  803c21:	56                   	push   %esi
+  803c22:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803c23:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803c26:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803c2c:	e8 51 cf ff ff       	call   800b82 <sys_getenvid>
+  803c31:	83 ec 0c             	sub    $0xc,%esp
+  803c34:	ff 75 0c             	push   0xc(%ebp)
+  803c37:	ff 75 08             	push   0x8(%ebp)
+  803c3a:	56                   	push   %esi
+  803c3b:	50                   	push   %eax
+  803c3c:	68 c4 4c 80 00       	push   $0x804cc4
+  803c41:	e8 72 c5 ff ff       	call   8001b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803c46:	83 c4 18             	add    $0x18,%esp
+  803c49:	53                   	push   %ebx
+  803c4a:	ff 75 10             	push   0x10(%ebp)
+  803c4d:	e8 15 c5 ff ff       	call   800167 <vcprintf>
+	cprintf("\n");
+  803c52:	c7 04 24 22 4e 80 00 	movl   $0x804e22,(%esp)
+  803c59:	e8 5a c5 ff ff       	call   8001b8 <cprintf>
+  803c5e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803c61:	cc                   	int3
+	while (1)
+  803c62:	eb fd                	jmp    803c61 <_panic+0x43>
+
+00803c64 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c64:	55                   	push   %ebp
+  803c65:	89 e5                	mov    %esp,%ebp
+  803c67:	57                   	push   %edi
+  803c68:	56                   	push   %esi
+  803c69:	53                   	push   %ebx
+  803c6a:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c6d:	89 d6                	mov    %edx,%esi
+  803c6f:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c72:	89 cf                	mov    %ecx,%edi
+  803c74:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c77:	89 fa                	mov    %edi,%edx
+  803c79:	80 ce 08             	or     $0x8,%dh
+  803c7c:	f6 c5 08             	test   $0x8,%ch
+  803c7f:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c82:	57                   	push   %edi
+  803c83:	56                   	push   %esi
+  803c84:	50                   	push   %eax
+  803c85:	56                   	push   %esi
+  803c86:	6a 00                	push   $0x0
+  803c88:	e8 9a cf ff ff       	call   800c27 <sys_page_map>
+	if (r < 0) {
+  803c8d:	83 c4 20             	add    $0x20,%esp
+  803c90:	85 c0                	test   %eax,%eax
+  803c92:	78 27                	js     803cbb <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c94:	83 ec 0c             	sub    $0xc,%esp
+  803c97:	57                   	push   %edi
+  803c98:	56                   	push   %esi
+  803c99:	6a 00                	push   $0x0
+  803c9b:	56                   	push   %esi
+  803c9c:	6a 00                	push   $0x0
+  803c9e:	e8 84 cf ff ff       	call   800c27 <sys_page_map>
+  803ca3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ca5:	83 c4 20             	add    $0x20,%esp
+  803ca8:	85 c0                	test   %eax,%eax
+  803caa:	78 24                	js     803cd0 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803cac:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cb1:	89 d8                	mov    %ebx,%eax
+  803cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cb6:	5b                   	pop    %ebx
+  803cb7:	5e                   	pop    %esi
+  803cb8:	5f                   	pop    %edi
+  803cb9:	5d                   	pop    %ebp
+  803cba:	c3                   	ret
+  803cbb:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cbd:	83 ec 08             	sub    $0x8,%esp
+  803cc0:	50                   	push   %eax
+  803cc1:	68 e8 4c 80 00       	push   $0x804ce8
+  803cc6:	e8 ed c4 ff ff       	call   8001b8 <cprintf>
+		return r;
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	eb e1                	jmp    803cb1 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803cd0:	83 ec 08             	sub    $0x8,%esp
+  803cd3:	50                   	push   %eax
+  803cd4:	68 18 4d 80 00       	push   $0x804d18
+  803cd9:	e8 da c4 ff ff       	call   8001b8 <cprintf>
+		return r;
+  803cde:	83 c4 10             	add    $0x10,%esp
+  803ce1:	eb ce                	jmp    803cb1 <duppage_cow+0x4d>
+
+00803ce3 <duppage>:
+{
+  803ce3:	55                   	push   %ebp
+  803ce4:	89 e5                	mov    %esp,%ebp
+  803ce6:	53                   	push   %ebx
+  803ce7:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803cea:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803ced:	51                   	push   %ecx
+  803cee:	52                   	push   %edx
+  803cef:	50                   	push   %eax
+  803cf0:	52                   	push   %edx
+  803cf1:	6a 00                	push   $0x0
+  803cf3:	e8 2f cf ff ff       	call   800c27 <sys_page_map>
+	if (r < 0) {
+  803cf8:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d00:	85 c0                	test   %eax,%eax
+  803d02:	78 07                	js     803d0b <duppage+0x28>
+}
+  803d04:	89 d8                	mov    %ebx,%eax
+  803d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+  803d0b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d0d:	83 ec 08             	sub    $0x8,%esp
+  803d10:	50                   	push   %eax
+  803d11:	68 e8 4c 80 00       	push   $0x804ce8
+  803d16:	e8 9d c4 ff ff       	call   8001b8 <cprintf>
+		return r;
+  803d1b:	83 c4 10             	add    $0x10,%esp
+  803d1e:	eb e4                	jmp    803d04 <duppage+0x21>
+
+00803d20 <cow_copy>:
+{
+  803d20:	55                   	push   %ebp
+  803d21:	89 e5                	mov    %esp,%ebp
+  803d23:	56                   	push   %esi
+  803d24:	53                   	push   %ebx
+  803d25:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d27:	83 ec 04             	sub    $0x4,%esp
+  803d2a:	6a 07                	push   $0x7
+  803d2c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d31:	6a 00                	push   $0x0
+  803d33:	e8 a2 ce ff ff       	call   800bda <sys_page_alloc>
+	if (r < 0) {
+  803d38:	83 c4 10             	add    $0x10,%esp
+  803d3b:	85 c0                	test   %eax,%eax
+  803d3d:	78 58                	js     803d97 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d3f:	83 ec 04             	sub    $0x4,%esp
+  803d42:	68 00 10 00 00       	push   $0x1000
+  803d47:	56                   	push   %esi
+  803d48:	68 00 f0 7f 00       	push   $0x7ff000
+  803d4d:	e8 d0 cb ff ff       	call   800922 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d52:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d59:	56                   	push   %esi
+  803d5a:	6a 00                	push   $0x0
+  803d5c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d61:	6a 00                	push   $0x0
+  803d63:	e8 bf ce ff ff       	call   800c27 <sys_page_map>
+  803d68:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d6a:	83 c4 20             	add    $0x20,%esp
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	78 3b                	js     803dac <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d71:	83 ec 08             	sub    $0x8,%esp
+  803d74:	68 00 f0 7f 00       	push   $0x7ff000
+  803d79:	6a 00                	push   $0x0
+  803d7b:	e8 f3 ce ff ff       	call   800c73 <sys_page_unmap>
+  803d80:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d82:	83 c4 10             	add    $0x10,%esp
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 45                	js     803dce <cow_copy+0xae>
+	return 0;
+  803d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d8e:	89 d8                	mov    %ebx,%eax
+  803d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d93:	5b                   	pop    %ebx
+  803d94:	5e                   	pop    %esi
+  803d95:	5d                   	pop    %ebp
+  803d96:	c3                   	ret
+  803d97:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d99:	83 ec 08             	sub    $0x8,%esp
+  803d9c:	50                   	push   %eax
+  803d9d:	68 08 4e 80 00       	push   $0x804e08
+  803da2:	e8 11 c4 ff ff       	call   8001b8 <cprintf>
+		return r;
+  803da7:	83 c4 10             	add    $0x10,%esp
+  803daa:	eb e2                	jmp    803d8e <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803dac:	83 ec 08             	sub    $0x8,%esp
+  803daf:	50                   	push   %eax
+  803db0:	68 24 4e 80 00       	push   $0x804e24
+  803db5:	e8 fe c3 ff ff       	call   8001b8 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803dba:	83 c4 08             	add    $0x8,%esp
+  803dbd:	68 00 f0 7f 00       	push   $0x7ff000
+  803dc2:	6a 00                	push   $0x0
+  803dc4:	e8 aa ce ff ff       	call   800c73 <sys_page_unmap>
+		return r;
+  803dc9:	83 c4 10             	add    $0x10,%esp
+  803dcc:	eb c0                	jmp    803d8e <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803dce:	83 ec 08             	sub    $0x8,%esp
+  803dd1:	50                   	push   %eax
+  803dd2:	68 40 4d 80 00       	push   $0x804d40
+  803dd7:	e8 dc c3 ff ff       	call   8001b8 <cprintf>
+		return r;
+  803ddc:	83 c4 10             	add    $0x10,%esp
+  803ddf:	eb ad                	jmp    803d8e <cow_copy+0x6e>
+
+00803de1 <pgfault>:
+{
+  803de1:	55                   	push   %ebp
+  803de2:	89 e5                	mov    %esp,%ebp
+  803de4:	56                   	push   %esi
+  803de5:	53                   	push   %ebx
+  803de6:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803de9:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803deb:	89 d8                	mov    %ebx,%eax
+  803ded:	c1 e8 16             	shr    $0x16,%eax
+  803df0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803df7:	89 de                	mov    %ebx,%esi
+  803df9:	c1 ee 0c             	shr    $0xc,%esi
+  803dfc:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e03:	a8 07                	test   $0x7,%al
+  803e05:	74 3b                	je     803e42 <pgfault+0x61>
+  803e07:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e0d:	74 33                	je     803e42 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e0f:	83 ec 0c             	sub    $0xc,%esp
+  803e12:	68 00 f0 bf ee       	push   $0xeebff000
+  803e17:	e8 82 f4 ff ff       	call   80329e <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e1c:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e23:	83 c4 10             	add    $0x10,%esp
+  803e26:	f6 c4 08             	test   $0x8,%ah
+  803e29:	75 30                	jne    803e5b <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e2b:	83 ec 0c             	sub    $0xc,%esp
+  803e2e:	68 00 f0 bf ee       	push   $0xeebff000
+  803e33:	e8 d3 f4 ff ff       	call   80330b <mutex_unlock>
+}
+  803e38:	83 c4 10             	add    $0x10,%esp
+  803e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e3e:	5b                   	pop    %ebx
+  803e3f:	5e                   	pop    %esi
+  803e40:	5d                   	pop    %ebp
+  803e41:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e42:	83 ec 08             	sub    $0x8,%esp
+  803e45:	ff 72 28             	push   0x28(%edx)
+  803e48:	51                   	push   %ecx
+  803e49:	50                   	push   %eax
+  803e4a:	68 64 4d 80 00       	push   $0x804d64
+  803e4f:	6a 3f                	push   $0x3f
+  803e51:	68 3e 4e 80 00       	push   $0x804e3e
+  803e56:	e8 c3 fd ff ff       	call   803c1e <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e5b:	89 d8                	mov    %ebx,%eax
+  803e5d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e62:	e8 b9 fe ff ff       	call   803d20 <cow_copy>
+  803e67:	eb c2                	jmp    803e2b <pgfault+0x4a>
+
+00803e69 <cow_enable>:
+{
+  803e69:	55                   	push   %ebp
+  803e6a:	89 e5                	mov    %esp,%ebp
+  803e6c:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e6f:	68 e1 3d 80 00       	push   $0x803de1
+  803e74:	e8 03 d2 ff ff       	call   80107c <set_pgfault_handler>
+}
+  803e79:	83 c4 10             	add    $0x10,%esp
+  803e7c:	c9                   	leave
+  803e7d:	c3                   	ret
+
+00803e7e <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e7e:	55                   	push   %ebp
+  803e7f:	89 e5                	mov    %esp,%ebp
+  803e81:	57                   	push   %edi
+  803e82:	56                   	push   %esi
+  803e83:	53                   	push   %ebx
+  803e84:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e87:	68 e1 3d 80 00       	push   $0x803de1
+  803e8c:	e8 eb d1 ff ff       	call   80107c <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e91:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e96:	cd 30                	int    $0x30
+  803e98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e9b:	83 c4 10             	add    $0x10,%esp
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	78 4b                	js     803eed <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803ea2:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803ea7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803eac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803eaf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803eb3:	0f 85 16 01 00 00    	jne    803fcf <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803eb9:	e8 c4 cc ff ff       	call   800b82 <sys_getenvid>
+  803ebe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ec3:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ec5:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803ecb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ed1:	77 32                	ja     803f05 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ed3:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803ed8:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803eda:	c1 ea 10             	shr    $0x10,%edx
+  803edd:	74 26                	je     803f05 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803edf:	c1 e2 10             	shl    $0x10,%edx
+  803ee2:	89 d1                	mov    %edx,%ecx
+  803ee4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ee9:	29 ca                	sub    %ecx,%edx
+  803eeb:	eb 1e                	jmp    803f0b <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803eed:	83 ec 08             	sub    $0x8,%esp
+  803ef0:	89 c7                	mov    %eax,%edi
+  803ef2:	50                   	push   %eax
+  803ef3:	68 49 4e 80 00       	push   $0x804e49
+  803ef8:	e8 bb c2 ff ff       	call   8001b8 <cprintf>
+		return eid;
+  803efd:	83 c4 10             	add    $0x10,%esp
+  803f00:	e9 6c 01 00 00       	jmp    804071 <fork+0x1f3>
+		return pthread_main_tls;
+  803f05:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f0b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f0e:	c1 e0 04             	shl    $0x4,%eax
+  803f11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f16:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f18:	e8 ca fa ff ff       	call   8039e7 <pthread_fork_child>
+		return eid;
+  803f1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f20:	e9 4c 01 00 00       	jmp    804071 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f25:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f2b:	89 da                	mov    %ebx,%edx
+  803f2d:	89 f8                	mov    %edi,%eax
+  803f2f:	e8 af fd ff ff       	call   803ce3 <duppage>
+  803f34:	85 c0                	test   %eax,%eax
+  803f36:	79 28                	jns    803f60 <fork+0xe2>
+  803f38:	89 c7                	mov    %eax,%edi
+  803f3a:	e9 32 01 00 00       	jmp    804071 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f3f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f45:	83 f9 05             	cmp    $0x5,%ecx
+  803f48:	75 58                	jne    803fa2 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f4a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f4f:	89 da                	mov    %ebx,%edx
+  803f51:	89 f8                	mov    %edi,%eax
+  803f53:	e8 8b fd ff ff       	call   803ce3 <duppage>
+  803f58:	85 c0                	test   %eax,%eax
+  803f5a:	0f 88 0f 01 00 00    	js     80406f <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f60:	83 c3 01             	add    $0x1,%ebx
+  803f63:	39 de                	cmp    %ebx,%esi
+  803f65:	74 54                	je     803fbb <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f67:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f6e:	f6 c1 05             	test   $0x5,%cl
+  803f71:	74 ed                	je     803f60 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f73:	f6 c5 04             	test   $0x4,%ch
+  803f76:	75 ad                	jne    803f25 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f78:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f7e:	74 bf                	je     803f3f <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f80:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f86:	74 d8                	je     803f60 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f88:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f8e:	89 da                	mov    %ebx,%edx
+  803f90:	89 f8                	mov    %edi,%eax
+  803f92:	e8 cd fc ff ff       	call   803c64 <duppage_cow>
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	79 c5                	jns    803f60 <fork+0xe2>
+  803f9b:	89 c7                	mov    %eax,%edi
+  803f9d:	e9 cf 00 00 00       	jmp    804071 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fa2:	68 94 4d 80 00       	push   $0x804d94
+  803fa7:	68 7d 4b 80 00       	push   $0x804b7d
+  803fac:	68 c6 00 00 00       	push   $0xc6
+  803fb1:	68 3e 4e 80 00       	push   $0x804e3e
+  803fb6:	e8 63 fc ff ff       	call   803c1e <_panic>
+  803fbb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fbe:	83 c1 01             	add    $0x1,%ecx
+  803fc1:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803fc7:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803fcd:	74 18                	je     803fe7 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803fcf:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803fd6:	a8 07                	test   $0x7,%al
+  803fd8:	74 e4                	je     803fbe <fork+0x140>
+  803fda:	89 cb                	mov    %ecx,%ebx
+  803fdc:	c1 e3 0a             	shl    $0xa,%ebx
+  803fdf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803fe2:	e9 7c ff ff ff       	jmp    803f63 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803fe7:	83 ec 04             	sub    $0x4,%esp
+  803fea:	6a 07                	push   $0x7
+  803fec:	68 00 f0 bf ee       	push   $0xeebff000
+  803ff1:	ff 75 e4             	push   -0x1c(%ebp)
+  803ff4:	e8 e1 cb ff ff       	call   800bda <sys_page_alloc>
+  803ff9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803ffb:	83 c4 10             	add    $0x10,%esp
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	78 34                	js     804036 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804002:	83 ec 08             	sub    $0x8,%esp
+  804005:	68 ba 10 80 00       	push   $0x8010ba
+  80400a:	ff 75 e4             	push   -0x1c(%ebp)
+  80400d:	e8 45 cd ff ff       	call   800d57 <sys_env_set_pgfault_upcall>
+  804012:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804014:	83 c4 10             	add    $0x10,%esp
+  804017:	85 c0                	test   %eax,%eax
+  804019:	78 2e                	js     804049 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80401b:	83 ec 08             	sub    $0x8,%esp
+  80401e:	6a 02                	push   $0x2
+  804020:	ff 75 e4             	push   -0x1c(%ebp)
+  804023:	e8 97 cc ff ff       	call   800cbf <sys_env_set_status>
+  804028:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	85 c0                	test   %eax,%eax
+  80402f:	78 2b                	js     80405c <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804031:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804034:	eb 3b                	jmp    804071 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804036:	83 ec 08             	sub    $0x8,%esp
+  804039:	50                   	push   %eax
+  80403a:	68 bc 4d 80 00       	push   $0x804dbc
+  80403f:	e8 74 c1 ff ff       	call   8001b8 <cprintf>
+		return r;
+  804044:	83 c4 10             	add    $0x10,%esp
+  804047:	eb 28                	jmp    804071 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804049:	83 ec 08             	sub    $0x8,%esp
+  80404c:	50                   	push   %eax
+  80404d:	68 e4 4d 80 00       	push   $0x804de4
+  804052:	e8 61 c1 ff ff       	call   8001b8 <cprintf>
+		return r;
+  804057:	83 c4 10             	add    $0x10,%esp
+  80405a:	eb 15                	jmp    804071 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80405c:	83 ec 08             	sub    $0x8,%esp
+  80405f:	50                   	push   %eax
+  804060:	68 59 4e 80 00       	push   $0x804e59
+  804065:	e8 4e c1 ff ff       	call   8001b8 <cprintf>
+		return r;
+  80406a:	83 c4 10             	add    $0x10,%esp
+  80406d:	eb 02                	jmp    804071 <fork+0x1f3>
+  80406f:	89 c7                	mov    %eax,%edi
+}
+  804071:	89 f8                	mov    %edi,%eax
+  804073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804076:	5b                   	pop    %ebx
+  804077:	5e                   	pop    %esi
+  804078:	5f                   	pop    %edi
+  804079:	5d                   	pop    %ebp
+  80407a:	c3                   	ret
+
+0080407b <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80407b:	55                   	push   %ebp
+  80407c:	89 e5                	mov    %esp,%ebp
+  80407e:	57                   	push   %edi
+  80407f:	56                   	push   %esi
+  804080:	53                   	push   %ebx
+  804081:	83 ec 2c             	sub    $0x2c,%esp
+  804084:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804086:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80408c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804091:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804097:	77 0a                	ja     8040a3 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804099:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80409e:	29 c3                	sub    %eax,%ebx
+  8040a0:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040a3:	83 ec 0c             	sub    $0xc,%esp
+  8040a6:	68 e1 3d 80 00       	push   $0x803de1
+  8040ab:	e8 cc cf ff ff       	call   80107c <set_pgfault_handler>
+  8040b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040b5:	cd 30                	int    $0x30
+  8040b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040ba:	83 c4 10             	add    $0x10,%esp
+  8040bd:	85 c0                	test   %eax,%eax
+  8040bf:	78 30                	js     8040f1 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8040c5:	74 42                	je     804109 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040c7:	c1 e3 10             	shl    $0x10,%ebx
+  8040ca:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8040cf:	29 d8                	sub    %ebx,%eax
+  8040d1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040d4:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8040d9:	29 d8                	sub    %ebx,%eax
+  8040db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040de:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040e8:	89 f7                	mov    %esi,%edi
+  8040ea:	89 d6                	mov    %edx,%esi
+  8040ec:	e9 2c 01 00 00       	jmp    80421d <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8040f1:	83 ec 08             	sub    $0x8,%esp
+  8040f4:	89 c7                	mov    %eax,%edi
+  8040f6:	50                   	push   %eax
+  8040f7:	68 49 4e 80 00       	push   $0x804e49
+  8040fc:	e8 b7 c0 ff ff       	call   8001b8 <cprintf>
+		return eid;
+  804101:	83 c4 10             	add    $0x10,%esp
+  804104:	e9 d5 00 00 00       	jmp    8041de <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804109:	e8 74 ca ff ff       	call   800b82 <sys_getenvid>
+  80410e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804113:	89 c2                	mov    %eax,%edx
+  804115:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804117:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80411d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804122:	77 18                	ja     80413c <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804124:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804129:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80412b:	c1 e8 10             	shr    $0x10,%eax
+  80412e:	74 0c                	je     80413c <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804130:	c1 e0 10             	shl    $0x10,%eax
+  804133:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804138:	29 c1                	sub    %eax,%ecx
+  80413a:	eb 06                	jmp    804142 <sfork+0xc7>
+		return pthread_main_tls;
+  80413c:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804142:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804145:	c1 e0 04             	shl    $0x4,%eax
+  804148:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80414d:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80414f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804152:	e9 87 00 00 00       	jmp    8041de <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804157:	f6 c5 04             	test   $0x4,%ch
+  80415a:	74 6c                	je     8041c8 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80415c:	89 ca                	mov    %ecx,%edx
+  80415e:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804164:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80416a:	74 7c                	je     8041e8 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80416c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804172:	89 da                	mov    %ebx,%edx
+  804174:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804177:	e8 67 fb ff ff       	call   803ce3 <duppage>
+  80417c:	85 c0                	test   %eax,%eax
+  80417e:	0f 88 4f 01 00 00    	js     8042d3 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804184:	83 c3 01             	add    $0x1,%ebx
+  804187:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80418a:	74 7a                	je     804206 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80418c:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80418e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804195:	f6 c1 01             	test   $0x1,%cl
+  804198:	74 ea                	je     804184 <sfork+0x109>
+  80419a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041a0:	74 e2                	je     804184 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041a2:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041a8:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041ab:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041b0:	76 a5                	jbe    804157 <sfork+0xdc>
+  8041b2:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041b8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041bb:	39 fa                	cmp    %edi,%edx
+  8041bd:	73 9d                	jae    80415c <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041bf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8041c2:	39 fa                	cmp    %edi,%edx
+  8041c4:	72 96                	jb     80415c <sfork+0xe1>
+  8041c6:	eb 8f                	jmp    804157 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041c8:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041ce:	89 da                	mov    %ebx,%edx
+  8041d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041d3:	e8 8c fa ff ff       	call   803c64 <duppage_cow>
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	79 a8                	jns    804184 <sfork+0x109>
+  8041dc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8041de:	89 f8                	mov    %edi,%eax
+  8041e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e3:	5b                   	pop    %ebx
+  8041e4:	5e                   	pop    %esi
+  8041e5:	5f                   	pop    %edi
+  8041e6:	5d                   	pop    %ebp
+  8041e7:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8041e8:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8041ed:	e8 2e fb ff ff       	call   803d20 <cow_copy>
+  8041f2:	85 c0                	test   %eax,%eax
+  8041f4:	0f 88 d2 00 00 00    	js     8042cc <sfork+0x251>
+				pte = uvpt[pn];
+  8041fa:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804201:	e9 66 ff ff ff       	jmp    80416c <sfork+0xf1>
+  804206:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804209:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80420c:	83 c6 01             	add    $0x1,%esi
+  80420f:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804215:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80421b:	74 1b                	je     804238 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80421d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804224:	a8 01                	test   $0x1,%al
+  804226:	74 e4                	je     80420c <sfork+0x191>
+  804228:	89 f3                	mov    %esi,%ebx
+  80422a:	c1 e3 0a             	shl    $0xa,%ebx
+  80422d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804230:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804233:	e9 4f ff ff ff       	jmp    804187 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804238:	83 ec 04             	sub    $0x4,%esp
+  80423b:	6a 07                	push   $0x7
+  80423d:	68 00 f0 bf ee       	push   $0xeebff000
+  804242:	ff 75 e0             	push   -0x20(%ebp)
+  804245:	e8 90 c9 ff ff       	call   800bda <sys_page_alloc>
+  80424a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80424c:	83 c4 10             	add    $0x10,%esp
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	78 37                	js     80428a <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804253:	83 ec 08             	sub    $0x8,%esp
+  804256:	68 ba 10 80 00       	push   $0x8010ba
+  80425b:	ff 75 e0             	push   -0x20(%ebp)
+  80425e:	e8 f4 ca ff ff       	call   800d57 <sys_env_set_pgfault_upcall>
+  804263:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804265:	83 c4 10             	add    $0x10,%esp
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	78 34                	js     8042a0 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80426c:	83 ec 08             	sub    $0x8,%esp
+  80426f:	6a 02                	push   $0x2
+  804271:	ff 75 e0             	push   -0x20(%ebp)
+  804274:	e8 46 ca ff ff       	call   800cbf <sys_env_set_status>
+  804279:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80427b:	83 c4 10             	add    $0x10,%esp
+  80427e:	85 c0                	test   %eax,%eax
+  804280:	78 34                	js     8042b6 <sfork+0x23b>
+	return eid;
+  804282:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804285:	e9 54 ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80428a:	83 ec 08             	sub    $0x8,%esp
+  80428d:	50                   	push   %eax
+  80428e:	68 bc 4d 80 00       	push   $0x804dbc
+  804293:	e8 20 bf ff ff       	call   8001b8 <cprintf>
+		return r;
+  804298:	83 c4 10             	add    $0x10,%esp
+  80429b:	e9 3e ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042a0:	83 ec 08             	sub    $0x8,%esp
+  8042a3:	50                   	push   %eax
+  8042a4:	68 e4 4d 80 00       	push   $0x804de4
+  8042a9:	e8 0a bf ff ff       	call   8001b8 <cprintf>
+		return r;
+  8042ae:	83 c4 10             	add    $0x10,%esp
+  8042b1:	e9 28 ff ff ff       	jmp    8041de <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042b6:	83 ec 08             	sub    $0x8,%esp
+  8042b9:	50                   	push   %eax
+  8042ba:	68 59 4e 80 00       	push   $0x804e59
+  8042bf:	e8 f4 be ff ff       	call   8001b8 <cprintf>
+		return r;
+  8042c4:	83 c4 10             	add    $0x10,%esp
+  8042c7:	e9 12 ff ff ff       	jmp    8041de <sfork+0x163>
+  8042cc:	89 c7                	mov    %eax,%edi
+  8042ce:	e9 0b ff ff ff       	jmp    8041de <sfork+0x163>
+  8042d3:	89 c7                	mov    %eax,%edi
+  8042d5:	e9 04 ff ff ff       	jmp    8041de <sfork+0x163>
+
+008042da <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042da:	55                   	push   %ebp
+  8042db:	89 e5                	mov    %esp,%ebp
+  8042dd:	57                   	push   %edi
+  8042de:	56                   	push   %esi
+  8042df:	53                   	push   %ebx
+  8042e0:	83 ec 18             	sub    $0x18,%esp
+  8042e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8042f3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8042f6:	50                   	push   %eax
+  8042f7:	e8 d4 ca ff ff       	call   800dd0 <sys_ipc_recv>
+	if (r < 0) {
+  8042fc:	83 c4 10             	add    $0x10,%esp
+  8042ff:	85 c0                	test   %eax,%eax
+  804301:	78 2b                	js     80432e <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804303:	85 ff                	test   %edi,%edi
+  804305:	74 55                	je     80435c <ipc_recv+0x82>
+  804307:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804309:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80430f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804314:	77 39                	ja     80434f <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804316:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80431b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80431d:	c1 e8 10             	shr    $0x10,%eax
+  804320:	74 2d                	je     80434f <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804322:	c1 e0 10             	shl    $0x10,%eax
+  804325:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80432a:	29 c2                	sub    %eax,%edx
+  80432c:	eb 27                	jmp    804355 <ipc_recv+0x7b>
+  80432e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804330:	83 ec 08             	sub    $0x8,%esp
+  804333:	50                   	push   %eax
+  804334:	68 77 4e 80 00       	push   $0x804e77
+  804339:	e8 7a be ff ff       	call   8001b8 <cprintf>
+		*from_env_store = 0;
+  80433e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804344:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80434a:	83 c4 10             	add    $0x10,%esp
+  80434d:	eb 77                	jmp    8043c6 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80434f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804355:	8b 02                	mov    (%edx),%eax
+  804357:	8b 40 78             	mov    0x78(%eax),%eax
+  80435a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80435c:	85 f6                	test   %esi,%esi
+  80435e:	74 34                	je     804394 <ipc_recv+0xba>
+  804360:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804362:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804368:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80436d:	77 18                	ja     804387 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80436f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804374:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804376:	c1 e8 10             	shr    $0x10,%eax
+  804379:	74 0c                	je     804387 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80437b:	c1 e0 10             	shl    $0x10,%eax
+  80437e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804383:	29 c2                	sub    %eax,%edx
+  804385:	eb 06                	jmp    80438d <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804387:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80438d:	8b 02                	mov    (%edx),%eax
+  80438f:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804392:	89 06                	mov    %eax,(%esi)
+  804394:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804396:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80439c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043a1:	77 18                	ja     8043bb <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043aa:	c1 e8 10             	shr    $0x10,%eax
+  8043ad:	74 0c                	je     8043bb <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043af:	c1 e0 10             	shl    $0x10,%eax
+  8043b2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043b7:	29 c2                	sub    %eax,%edx
+  8043b9:	eb 06                	jmp    8043c1 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043bb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043c1:	8b 02                	mov    (%edx),%eax
+  8043c3:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043c6:	89 d8                	mov    %ebx,%eax
+  8043c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cb:	5b                   	pop    %ebx
+  8043cc:	5e                   	pop    %esi
+  8043cd:	5f                   	pop    %edi
+  8043ce:	5d                   	pop    %ebp
+  8043cf:	c3                   	ret
+
+008043d0 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8043d0:	55                   	push   %ebp
+  8043d1:	89 e5                	mov    %esp,%ebp
+  8043d3:	57                   	push   %edi
+  8043d4:	56                   	push   %esi
+  8043d5:	53                   	push   %ebx
+  8043d6:	83 ec 0c             	sub    $0xc,%esp
+  8043d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043df:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043e2:	85 db                	test   %ebx,%ebx
+  8043e4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8043e9:	0f 44 d8             	cmove  %eax,%ebx
+  8043ec:	eb 05                	jmp    8043f3 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8043ee:	e8 bb c7 ff ff       	call   800bae <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8043f3:	57                   	push   %edi
+  8043f4:	53                   	push   %ebx
+  8043f5:	ff 75 0c             	push   0xc(%ebp)
+  8043f8:	56                   	push   %esi
+  8043f9:	e8 a5 c9 ff ff       	call   800da3 <sys_ipc_try_send>
+		if (r == 0) {
+  8043fe:	83 c4 10             	add    $0x10,%esp
+  804401:	85 c0                	test   %eax,%eax
+  804403:	74 19                	je     80441e <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804405:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804408:	74 e4                	je     8043ee <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80440a:	83 ec 0c             	sub    $0xc,%esp
+  80440d:	50                   	push   %eax
+  80440e:	57                   	push   %edi
+  80440f:	53                   	push   %ebx
+  804410:	56                   	push   %esi
+  804411:	68 90 4e 80 00       	push   $0x804e90
+  804416:	e8 9d bd ff ff       	call   8001b8 <cprintf>
+			return;
+  80441b:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80441e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804421:	5b                   	pop    %ebx
+  804422:	5e                   	pop    %esi
+  804423:	5f                   	pop    %edi
+  804424:	5d                   	pop    %ebp
+  804425:	c3                   	ret
+
+00804426 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804426:	55                   	push   %ebp
+  804427:	89 e5                	mov    %esp,%ebp
+  804429:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80442c:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804431:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804434:	c1 e0 04             	shl    $0x4,%eax
+  804437:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80443c:	8b 40 50             	mov    0x50(%eax),%eax
+  80443f:	39 c8                	cmp    %ecx,%eax
+  804441:	74 12                	je     804455 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804443:	83 c2 01             	add    $0x1,%edx
+  804446:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80444c:	75 e3                	jne    804431 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80444e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804453:	eb 0e                	jmp    804463 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804455:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804458:	c1 e0 04             	shl    $0x4,%eax
+  80445b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804460:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804463:	5d                   	pop    %ebp
+  804464:	c3                   	ret
+
+00804465 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804465:	55                   	push   %ebp
+  804466:	89 e5                	mov    %esp,%ebp
+  804468:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80446b:	89 c2                	mov    %eax,%edx
+  80446d:	c1 ea 16             	shr    $0x16,%edx
+  804470:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804477:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80447c:	f6 c1 01             	test   $0x1,%cl
+  80447f:	74 1c                	je     80449d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804481:	c1 e8 0c             	shr    $0xc,%eax
+  804484:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80448b:	a8 01                	test   $0x1,%al
+  80448d:	74 0e                	je     80449d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80448f:	c1 e8 0c             	shr    $0xc,%eax
+  804492:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804499:	ef 
+  80449a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80449d:	89 d0                	mov    %edx,%eax
+  80449f:	5d                   	pop    %ebp
+  8044a0:	c3                   	ret
+
+008044a1 <udm>:
+  8044a1:	57                   	push   %edi
+  8044a2:	56                   	push   %esi
+  8044a3:	53                   	push   %ebx
+  8044a4:	83 ec 20             	sub    $0x20,%esp
+  8044a7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044ab:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044af:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044b3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044b7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044bb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044bf:	89 d1                	mov    %edx,%ecx
+  8044c1:	09 c1                	or     %eax,%ecx
+  8044c3:	0f 84 91 00 00 00    	je     80455a <udm+0xb9>
+  8044c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044d8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044df:	00 
+  8044e0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044e7:	00 
+  8044e8:	eb 08                	jmp    8044f2 <udm+0x51>
+  8044ea:	83 e9 01             	sub    $0x1,%ecx
+  8044ed:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044f0:	74 7c                	je     80456e <udm+0xcd>
+  8044f2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044f6:	01 c0                	add    %eax,%eax
+  8044f8:	89 c6                	mov    %eax,%esi
+  8044fa:	89 d7                	mov    %edx,%edi
+  8044fc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804500:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804504:	0f ad d0             	shrd   %cl,%edx,%eax
+  804507:	d3 ea                	shr    %cl,%edx
+  804509:	f6 c1 20             	test   $0x20,%cl
+  80450c:	74 04                	je     804512 <udm+0x71>
+  80450e:	89 d0                	mov    %edx,%eax
+  804510:	31 d2                	xor    %edx,%edx
+  804512:	83 e0 01             	and    $0x1,%eax
+  804515:	89 04 24             	mov    %eax,(%esp)
+  804518:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80451f:	00 
+  804520:	8b 04 24             	mov    (%esp),%eax
+  804523:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804527:	09 f0                	or     %esi,%eax
+  804529:	09 fa                	or     %edi,%edx
+  80452b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80452f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804533:	39 f0                	cmp    %esi,%eax
+  804535:	89 d3                	mov    %edx,%ebx
+  804537:	19 fb                	sbb    %edi,%ebx
+  804539:	72 af                	jb     8044ea <udm+0x49>
+  80453b:	29 f0                	sub    %esi,%eax
+  80453d:	19 fa                	sbb    %edi,%edx
+  80453f:	89 cf                	mov    %ecx,%edi
+  804541:	c1 ef 05             	shr    $0x5,%edi
+  804544:	83 e7 01             	and    $0x1,%edi
+  804547:	89 fe                	mov    %edi,%esi
+  804549:	83 f6 01             	xor    $0x1,%esi
+  80454c:	d3 e6                	shl    %cl,%esi
+  80454e:	d3 e7                	shl    %cl,%edi
+  804550:	09 74 24 18          	or     %esi,0x18(%esp)
+  804554:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804558:	eb 90                	jmp    8044ea <udm+0x49>
+  80455a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80455e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804562:	89 f0                	mov    %esi,%eax
+  804564:	89 fa                	mov    %edi,%edx
+  804566:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80456a:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80456e:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804572:	89 01                	mov    %eax,(%ecx)
+  804574:	89 51 04             	mov    %edx,0x4(%ecx)
+  804577:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80457b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80457f:	83 c4 20             	add    $0x20,%esp
+  804582:	5b                   	pop    %ebx
+  804583:	5e                   	pop    %esi
+  804584:	5f                   	pop    %edi
+  804585:	c3                   	ret
+
+00804586 <__udivdi3>:
+  804586:	83 ec 18             	sub    $0x18,%esp
+  804589:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80458d:	50                   	push   %eax
+  80458e:	ff 74 24 2c          	push   0x2c(%esp)
+  804592:	ff 74 24 2c          	push   0x2c(%esp)
+  804596:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80459a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80459e:	e8 fe fe ff ff       	call   8044a1 <udm>
+  8045a3:	83 c4 24             	add    $0x24,%esp
+  8045a6:	c3                   	ret
+
+008045a7 <__umoddi3>:
+  8045a7:	83 ec 18             	sub    $0x18,%esp
+  8045aa:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045ae:	50                   	push   %eax
+  8045af:	ff 74 24 2c          	push   0x2c(%esp)
+  8045b3:	ff 74 24 2c          	push   0x2c(%esp)
+  8045b7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045bb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045bf:	e8 dd fe ff ff       	call   8044a1 <udm>
+  8045c4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045c8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045cc:	83 c4 24             	add    $0x24,%esp
+  8045cf:	c3                   	ret
+
+008045d0 <__divdi3>:
+  8045d0:	56                   	push   %esi
+  8045d1:	53                   	push   %ebx
+  8045d2:	83 ec 14             	sub    $0x14,%esp
+  8045d5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045d9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045dd:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045e1:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045e5:	85 d2                	test   %edx,%edx
+  8045e7:	78 18                	js     804601 <__divdi3+0x31>
+  8045e9:	85 db                	test   %ebx,%ebx
+  8045eb:	78 3e                	js     80462b <__divdi3+0x5b>
+  8045ed:	83 ec 04             	sub    $0x4,%esp
+  8045f0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045f4:	56                   	push   %esi
+  8045f5:	53                   	push   %ebx
+  8045f6:	51                   	push   %ecx
+  8045f7:	e8 a5 fe ff ff       	call   8044a1 <udm>
+  8045fc:	83 c4 10             	add    $0x10,%esp
+  8045ff:	eb 24                	jmp    804625 <__divdi3+0x55>
+  804601:	f7 d8                	neg    %eax
+  804603:	83 d2 00             	adc    $0x0,%edx
+  804606:	f7 da                	neg    %edx
+  804608:	85 db                	test   %ebx,%ebx
+  80460a:	78 3a                	js     804646 <__divdi3+0x76>
+  80460c:	83 ec 04             	sub    $0x4,%esp
+  80460f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804613:	56                   	push   %esi
+  804614:	53                   	push   %ebx
+  804615:	51                   	push   %ecx
+  804616:	e8 86 fe ff ff       	call   8044a1 <udm>
+  80461b:	83 c4 10             	add    $0x10,%esp
+  80461e:	f7 d8                	neg    %eax
+  804620:	83 d2 00             	adc    $0x0,%edx
+  804623:	f7 da                	neg    %edx
+  804625:	83 c4 14             	add    $0x14,%esp
+  804628:	5b                   	pop    %ebx
+  804629:	5e                   	pop    %esi
+  80462a:	c3                   	ret
+  80462b:	83 ec 04             	sub    $0x4,%esp
+  80462e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804632:	56                   	push   %esi
+  804633:	f7 d9                	neg    %ecx
+  804635:	83 d3 00             	adc    $0x0,%ebx
+  804638:	f7 db                	neg    %ebx
+  80463a:	53                   	push   %ebx
+  80463b:	51                   	push   %ecx
+  80463c:	e8 60 fe ff ff       	call   8044a1 <udm>
+  804641:	83 c4 10             	add    $0x10,%esp
+  804644:	eb d8                	jmp    80461e <__divdi3+0x4e>
+  804646:	83 ec 04             	sub    $0x4,%esp
+  804649:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80464d:	56                   	push   %esi
+  80464e:	f7 d9                	neg    %ecx
+  804650:	83 d3 00             	adc    $0x0,%ebx
+  804653:	f7 db                	neg    %ebx
+  804655:	53                   	push   %ebx
+  804656:	51                   	push   %ecx
+  804657:	e8 45 fe ff ff       	call   8044a1 <udm>
+  80465c:	83 c4 10             	add    $0x10,%esp
+  80465f:	eb c4                	jmp    804625 <__divdi3+0x55>
+
+00804661 <__moddi3>:
+  804661:	55                   	push   %ebp
+  804662:	57                   	push   %edi
+  804663:	56                   	push   %esi
+  804664:	53                   	push   %ebx
+  804665:	83 ec 24             	sub    $0x24,%esp
+  804668:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80466c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804670:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804674:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804678:	85 d2                	test   %edx,%edx
+  80467a:	78 3b                	js     8046b7 <__moddi3+0x56>
+  80467c:	83 ec 04             	sub    $0x4,%esp
+  80467f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804683:	56                   	push   %esi
+  804684:	89 ce                	mov    %ecx,%esi
+  804686:	f7 de                	neg    %esi
+  804688:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80468c:	89 de                	mov    %ebx,%esi
+  80468e:	83 d6 00             	adc    $0x0,%esi
+  804691:	f7 de                	neg    %esi
+  804693:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804697:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80469b:	0f 48 f1             	cmovs  %ecx,%esi
+  80469e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046a3:	53                   	push   %ebx
+  8046a4:	56                   	push   %esi
+  8046a5:	e8 f7 fd ff ff       	call   8044a1 <udm>
+  8046aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046ae:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046b2:	83 c4 10             	add    $0x10,%esp
+  8046b5:	eb 47                	jmp    8046fe <__moddi3+0x9d>
+  8046b7:	f7 d8                	neg    %eax
+  8046b9:	83 d2 00             	adc    $0x0,%edx
+  8046bc:	f7 da                	neg    %edx
+  8046be:	83 ec 04             	sub    $0x4,%esp
+  8046c1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046c5:	56                   	push   %esi
+  8046c6:	89 cf                	mov    %ecx,%edi
+  8046c8:	f7 df                	neg    %edi
+  8046ca:	89 de                	mov    %ebx,%esi
+  8046cc:	83 d6 00             	adc    $0x0,%esi
+  8046cf:	f7 de                	neg    %esi
+  8046d1:	0f 49 cf             	cmovns %edi,%ecx
+  8046d4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046d8:	0f 49 de             	cmovns %esi,%ebx
+  8046db:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046df:	ff 74 24 0c          	push   0xc(%esp)
+  8046e3:	ff 74 24 0c          	push   0xc(%esp)
+  8046e7:	e8 b5 fd ff ff       	call   8044a1 <udm>
+  8046ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046f0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046f4:	f7 d8                	neg    %eax
+  8046f6:	83 d2 00             	adc    $0x0,%edx
+  8046f9:	f7 da                	neg    %edx
+  8046fb:	83 c4 10             	add    $0x10,%esp
+  8046fe:	83 c4 24             	add    $0x24,%esp
+  804701:	5b                   	pop    %ebx
+  804702:	5e                   	pop    %esi
+  804703:	5f                   	pop    %edi
+  804704:	5d                   	pop    %ebp
+  804705:	c3                   	ret
@@ -0,0 +1,9718 @@
+
+obj/user/faultio.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 3e 00 00 00       	call   80006f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+read_eflags(void)
+{
+	uint32_t eflags;
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+  800039:	9c                   	pushf
+  80003a:	58                   	pop    %eax
+        int x, r;
+	int nsecs = 1;
+	int secno = 0;
+	int diskno = 1;
+
+	if (read_eflags() & FL_IOPL_3)
+  80003b:	f6 c4 30             	test   $0x30,%ah
+  80003e:	75 1d                	jne    80005d <umain+0x2a>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800040:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800045:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80004a:	ee                   	out    %al,(%dx)
+
+	// this outb to select disk 1 should result in a general protection
+	// fault, because user-level code shouldn't be able to use the io space.
+	outb(0x1F6, 0xE0 | (1<<4));
+
+        cprintf("%s: made it here --- bug\n");
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	68 0e 47 80 00       	push   $0x80470e
+  800053:	e8 4f 01 00 00       	call   8001a7 <cprintf>
+}
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+		cprintf("eflags wrong\n");
+  80005d:	83 ec 0c             	sub    $0xc,%esp
+  800060:	68 00 47 80 00       	push   $0x804700
+  800065:	e8 3d 01 00 00       	call   8001a7 <cprintf>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	eb d1                	jmp    800040 <umain+0xd>
+
+0080006f <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	57                   	push   %edi
+  800073:	56                   	push   %esi
+  800074:	53                   	push   %ebx
+  800075:	83 ec 1c             	sub    $0x1c,%esp
+  800078:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80007e:	e8 ee 0a 00 00       	call   800b71 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800083:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800086:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  80008c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800091:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800093:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800095:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80009b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000a0:	77 16                	ja     8000b8 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000a2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000a7:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000a9:	c1 e8 10             	shr    $0x10,%eax
+  8000ac:	74 0a                	je     8000b8 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000ae:	c1 e0 10             	shl    $0x10,%eax
+  8000b1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000b6:	29 c2                	sub    %eax,%edx
+  8000b8:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000bb:	c1 e0 04             	shl    $0x4,%eax
+  8000be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c3:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c5:	85 db                	test   %ebx,%ebx
+  8000c7:	7e 07                	jle    8000d0 <libmain+0x61>
+		binaryname = argv[0];
+  8000c9:	8b 06                	mov    (%esi),%eax
+  8000cb:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	56                   	push   %esi
+  8000d4:	53                   	push   %ebx
+  8000d5:	e8 59 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000da:	e8 0b 00 00 00       	call   8000ea <exit>
+}
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e5:	5b                   	pop    %ebx
+  8000e6:	5e                   	pop    %esi
+  8000e7:	5f                   	pop    %edi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000f0:	6a 00                	push   $0x0
+  8000f2:	e8 cf 20 00 00       	call   8021c6 <fflush>
+	pthread_kill_others();
+  8000f7:	e8 3a 37 00 00       	call   803836 <pthread_kill_others>
+	close_all();
+  8000fc:	e8 68 11 00 00       	call   801269 <close_all>
+	sys_env_destroy(0);
+  800101:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800108:	e8 19 0a 00 00       	call   800b26 <sys_env_destroy>
+}
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	c9                   	leave
+  800111:	c3                   	ret
+
+00800112 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800112:	55                   	push   %ebp
+  800113:	89 e5                	mov    %esp,%ebp
+  800115:	53                   	push   %ebx
+  800116:	83 ec 04             	sub    $0x4,%esp
+  800119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80011c:	8b 13                	mov    (%ebx),%edx
+  80011e:	8d 42 01             	lea    0x1(%edx),%eax
+  800121:	89 03                	mov    %eax,(%ebx)
+  800123:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800126:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80012a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80012f:	74 09                	je     80013a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800131:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800138:	c9                   	leave
+  800139:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80013a:	83 ec 08             	sub    $0x8,%esp
+  80013d:	68 ff 00 00 00       	push   $0xff
+  800142:	8d 43 08             	lea    0x8(%ebx),%eax
+  800145:	50                   	push   %eax
+  800146:	e8 84 09 00 00       	call   800acf <sys_cputs>
+		b->idx = 0;
+  80014b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800151:	83 c4 10             	add    $0x10,%esp
+  800154:	eb db                	jmp    800131 <putch+0x1f>
+
+00800156 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80015f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800166:	00 00 00 
+	b.cnt = 0;
+  800169:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800170:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800173:	ff 75 0c             	push   0xc(%ebp)
+  800176:	ff 75 08             	push   0x8(%ebp)
+  800179:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80017f:	50                   	push   %eax
+  800180:	68 12 01 80 00       	push   $0x800112
+  800185:	e8 14 01 00 00       	call   80029e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80018a:	83 c4 08             	add    $0x8,%esp
+  80018d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800193:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 30 09 00 00       	call   800acf <sys_cputs>
+
+	return b.cnt;
+}
+  80019f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001a5:	c9                   	leave
+  8001a6:	c3                   	ret
+
+008001a7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001ad:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b0:	50                   	push   %eax
+  8001b1:	ff 75 08             	push   0x8(%ebp)
+  8001b4:	e8 9d ff ff ff       	call   800156 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001b9:	c9                   	leave
+  8001ba:	c3                   	ret
+
+008001bb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001bb:	55                   	push   %ebp
+  8001bc:	89 e5                	mov    %esp,%ebp
+  8001be:	57                   	push   %edi
+  8001bf:	56                   	push   %esi
+  8001c0:	53                   	push   %ebx
+  8001c1:	83 ec 1c             	sub    $0x1c,%esp
+  8001c4:	89 c7                	mov    %eax,%edi
+  8001c6:	89 d6                	mov    %edx,%esi
+  8001c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ce:	89 d1                	mov    %edx,%ecx
+  8001d0:	89 c2                	mov    %eax,%edx
+  8001d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001d5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001d8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001db:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001e8:	39 c2                	cmp    %eax,%edx
+  8001ea:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ed:	72 3e                	jb     80022d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  8001f2:	ff 75 18             	push   0x18(%ebp)
+  8001f5:	83 eb 01             	sub    $0x1,%ebx
+  8001f8:	53                   	push   %ebx
+  8001f9:	50                   	push   %eax
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	ff 75 e4             	push   -0x1c(%ebp)
+  800200:	ff 75 e0             	push   -0x20(%ebp)
+  800203:	ff 75 dc             	push   -0x24(%ebp)
+  800206:	ff 75 d8             	push   -0x28(%ebp)
+  800209:	e8 67 43 00 00       	call   804575 <__udivdi3>
+  80020e:	83 c4 18             	add    $0x18,%esp
+  800211:	52                   	push   %edx
+  800212:	50                   	push   %eax
+  800213:	89 f2                	mov    %esi,%edx
+  800215:	89 f8                	mov    %edi,%eax
+  800217:	e8 9f ff ff ff       	call   8001bb <printnum>
+  80021c:	83 c4 20             	add    $0x20,%esp
+  80021f:	eb 13                	jmp    800234 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800221:	83 ec 08             	sub    $0x8,%esp
+  800224:	56                   	push   %esi
+  800225:	ff 75 18             	push   0x18(%ebp)
+  800228:	ff d7                	call   *%edi
+  80022a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80022d:	83 eb 01             	sub    $0x1,%ebx
+  800230:	85 db                	test   %ebx,%ebx
+  800232:	7f ed                	jg     800221 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800234:	83 ec 08             	sub    $0x8,%esp
+  800237:	56                   	push   %esi
+  800238:	83 ec 04             	sub    $0x4,%esp
+  80023b:	ff 75 e4             	push   -0x1c(%ebp)
+  80023e:	ff 75 e0             	push   -0x20(%ebp)
+  800241:	ff 75 dc             	push   -0x24(%ebp)
+  800244:	ff 75 d8             	push   -0x28(%ebp)
+  800247:	e8 4a 43 00 00       	call   804596 <__umoddi3>
+  80024c:	83 c4 14             	add    $0x14,%esp
+  80024f:	0f be 80 32 47 80 00 	movsbl 0x804732(%eax),%eax
+  800256:	50                   	push   %eax
+  800257:	ff d7                	call   *%edi
+}
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025f:	5b                   	pop    %ebx
+  800260:	5e                   	pop    %esi
+  800261:	5f                   	pop    %edi
+  800262:	5d                   	pop    %ebp
+  800263:	c3                   	ret
+
+00800264 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800264:	55                   	push   %ebp
+  800265:	89 e5                	mov    %esp,%ebp
+  800267:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80026a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80026e:	8b 10                	mov    (%eax),%edx
+  800270:	3b 50 04             	cmp    0x4(%eax),%edx
+  800273:	73 0a                	jae    80027f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800275:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800278:	89 08                	mov    %ecx,(%eax)
+  80027a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80027d:	88 02                	mov    %al,(%edx)
+}
+  80027f:	5d                   	pop    %ebp
+  800280:	c3                   	ret
+
+00800281 <printfmt>:
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800287:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80028a:	50                   	push   %eax
+  80028b:	ff 75 10             	push   0x10(%ebp)
+  80028e:	ff 75 0c             	push   0xc(%ebp)
+  800291:	ff 75 08             	push   0x8(%ebp)
+  800294:	e8 05 00 00 00       	call   80029e <vprintfmt>
+}
+  800299:	83 c4 10             	add    $0x10,%esp
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+
+0080029e <vprintfmt>:
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	57                   	push   %edi
+  8002a2:	56                   	push   %esi
+  8002a3:	53                   	push   %ebx
+  8002a4:	83 ec 2c             	sub    $0x2c,%esp
+  8002a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002ad:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b0:	eb 0a                	jmp    8002bc <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b2:	83 ec 08             	sub    $0x8,%esp
+  8002b5:	53                   	push   %ebx
+  8002b6:	50                   	push   %eax
+  8002b7:	ff d6                	call   *%esi
+  8002b9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8002bc:	83 c7 01             	add    $0x1,%edi
+  8002bf:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8002c3:	83 f8 25             	cmp    $0x25,%eax
+  8002c6:	74 0c                	je     8002d4 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002c8:	85 c0                	test   %eax,%eax
+  8002ca:	75 e6                	jne    8002b2 <vprintfmt+0x14>
+}
+  8002cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cf:	5b                   	pop    %ebx
+  8002d0:	5e                   	pop    %esi
+  8002d1:	5f                   	pop    %edi
+  8002d2:	5d                   	pop    %ebp
+  8002d3:	c3                   	ret
+		padc = ' ';
+  8002d4:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002d8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002df:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002e6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8002f2:	8d 47 01             	lea    0x1(%edi),%eax
+  8002f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002f8:	0f b6 17             	movzbl (%edi),%edx
+  8002fb:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002fe:	3c 55                	cmp    $0x55,%al
+  800300:	0f 87 c5 03 00 00    	ja     8006cb <vprintfmt+0x42d>
+  800306:	0f b6 c0             	movzbl %al,%eax
+  800309:	ff 24 85 c0 48 80 00 	jmp    *0x8048c0(,%eax,4)
+  800310:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800313:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800316:	eb da                	jmp    8002f2 <vprintfmt+0x54>
+  800318:	0f be d2             	movsbl %dl,%edx
+  80031b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80031e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800323:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800326:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800329:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80032d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800330:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800333:	83 f9 09             	cmp    $0x9,%ecx
+  800336:	77 55                	ja     80038d <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800338:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80033b:	eb e9                	jmp    800326 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80033d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800340:	8b 00                	mov    (%eax),%eax
+  800342:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800345:	8b 45 14             	mov    0x14(%ebp),%eax
+  800348:	8d 40 04             	lea    0x4(%eax),%eax
+  80034b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80034e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800351:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800355:	79 9b                	jns    8002f2 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800357:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80035a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80035d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800364:	eb 8c                	jmp    8002f2 <vprintfmt+0x54>
+			if (width < 0)
+  800366:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800369:	85 d2                	test   %edx,%edx
+  80036b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800370:	0f 49 c2             	cmovns %edx,%eax
+  800373:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800379:	e9 74 ff ff ff       	jmp    8002f2 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80037e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800381:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800388:	e9 65 ff ff ff       	jmp    8002f2 <vprintfmt+0x54>
+  80038d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800390:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800393:	eb bc                	jmp    800351 <vprintfmt+0xb3>
+			lflag++;
+  800395:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80039b:	e9 52 ff ff ff       	jmp    8002f2 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a3:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	53                   	push   %ebx
+  8003aa:	ff 30                	push   (%eax)
+  8003ac:	ff d6                	call   *%esi
+			break;
+  8003ae:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003b1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003b4:	e9 b1 02 00 00       	jmp    80066a <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003bf:	8b 10                	mov    (%eax),%edx
+  8003c1:	89 d0                	mov    %edx,%eax
+  8003c3:	f7 d8                	neg    %eax
+  8003c5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c8:	83 f8 14             	cmp    $0x14,%eax
+  8003cb:	7f 23                	jg     8003f0 <vprintfmt+0x152>
+  8003cd:	8b 14 85 20 4a 80 00 	mov    0x804a20(,%eax,4),%edx
+  8003d4:	85 d2                	test   %edx,%edx
+  8003d6:	74 18                	je     8003f0 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8003d8:	52                   	push   %edx
+  8003d9:	68 8f 4b 80 00       	push   $0x804b8f
+  8003de:	53                   	push   %ebx
+  8003df:	56                   	push   %esi
+  8003e0:	e8 9c fe ff ff       	call   800281 <printfmt>
+  8003e5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003eb:	e9 7a 02 00 00       	jmp    80066a <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8003f0:	50                   	push   %eax
+  8003f1:	68 4a 47 80 00       	push   $0x80474a
+  8003f6:	53                   	push   %ebx
+  8003f7:	56                   	push   %esi
+  8003f8:	e8 84 fe ff ff       	call   800281 <printfmt>
+  8003fd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800400:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800403:	e9 62 02 00 00       	jmp    80066a <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040b:	83 c0 04             	add    $0x4,%eax
+  80040e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800411:	8b 45 14             	mov    0x14(%ebp),%eax
+  800414:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800416:	85 c9                	test   %ecx,%ecx
+  800418:	b8 43 47 80 00       	mov    $0x804743,%eax
+  80041d:	0f 45 c1             	cmovne %ecx,%eax
+  800420:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800423:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800427:	7e 06                	jle    80042f <vprintfmt+0x191>
+  800429:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80042d:	75 0b                	jne    80043a <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80042f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800432:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800435:	89 75 08             	mov    %esi,0x8(%ebp)
+  800438:	eb 5c                	jmp    800496 <vprintfmt+0x1f8>
+  80043a:	83 ec 08             	sub    $0x8,%esp
+  80043d:	ff 75 d0             	push   -0x30(%ebp)
+  800440:	ff 75 cc             	push   -0x34(%ebp)
+  800443:	e8 20 03 00 00       	call   800768 <strnlen>
+  800448:	89 c2                	mov    %eax,%edx
+  80044a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80044d:	29 d0                	sub    %edx,%eax
+  80044f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800452:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800456:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800459:	89 75 08             	mov    %esi,0x8(%ebp)
+  80045c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045e:	eb 0e                	jmp    80046e <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	53                   	push   %ebx
+  800464:	57                   	push   %edi
+  800465:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800468:	83 ee 01             	sub    $0x1,%esi
+  80046b:	83 c4 10             	add    $0x10,%esp
+  80046e:	85 f6                	test   %esi,%esi
+  800470:	7f ee                	jg     800460 <vprintfmt+0x1c2>
+  800472:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	85 c0                	test   %eax,%eax
+  80047a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047f:	0f 49 d0             	cmovns %eax,%edx
+  800482:	29 d0                	sub    %edx,%eax
+  800484:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800487:	eb a6                	jmp    80042f <vprintfmt+0x191>
+					putch(ch, putdat);
+  800489:	83 ec 08             	sub    $0x8,%esp
+  80048c:	53                   	push   %ebx
+  80048d:	52                   	push   %edx
+  80048e:	ff 55 08             	call   *0x8(%ebp)
+  800491:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800494:	89 f1                	mov    %esi,%ecx
+  800496:	8d 71 01             	lea    0x1(%ecx),%esi
+  800499:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80049d:	0f be d0             	movsbl %al,%edx
+  8004a0:	85 d2                	test   %edx,%edx
+  8004a2:	74 28                	je     8004cc <vprintfmt+0x22e>
+  8004a4:	85 ff                	test   %edi,%edi
+  8004a6:	78 05                	js     8004ad <vprintfmt+0x20f>
+  8004a8:	83 ef 01             	sub    $0x1,%edi
+  8004ab:	78 30                	js     8004dd <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004ad:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004b1:	74 d6                	je     800489 <vprintfmt+0x1eb>
+  8004b3:	0f be c0             	movsbl %al,%eax
+  8004b6:	83 e8 20             	sub    $0x20,%eax
+  8004b9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004bc:	76 cb                	jbe    800489 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	53                   	push   %ebx
+  8004c2:	6a 3f                	push   $0x3f
+  8004c4:	ff 55 08             	call   *0x8(%ebp)
+  8004c7:	83 c4 10             	add    $0x10,%esp
+  8004ca:	eb c8                	jmp    800494 <vprintfmt+0x1f6>
+  8004cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d5:	01 d0                	add    %edx,%eax
+  8004d7:	29 c8                	sub    %ecx,%eax
+  8004d9:	89 c7                	mov    %eax,%edi
+  8004db:	eb 13                	jmp    8004f0 <vprintfmt+0x252>
+  8004dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e0:	eb ed                	jmp    8004cf <vprintfmt+0x231>
+				putch(' ', putdat);
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	53                   	push   %ebx
+  8004e6:	6a 20                	push   $0x20
+  8004e8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004ea:	83 ef 01             	sub    $0x1,%edi
+  8004ed:	83 c4 10             	add    $0x10,%esp
+  8004f0:	85 ff                	test   %edi,%edi
+  8004f2:	7f ee                	jg     8004e2 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004fa:	e9 6b 01 00 00       	jmp    80066a <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8004ff:	83 f9 01             	cmp    $0x1,%ecx
+  800502:	7f 1f                	jg     800523 <vprintfmt+0x285>
+	else if (lflag)
+  800504:	85 c9                	test   %ecx,%ecx
+  800506:	74 67                	je     80056f <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050b:	8b 00                	mov    (%eax),%eax
+  80050d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800510:	89 c1                	mov    %eax,%ecx
+  800512:	c1 f9 1f             	sar    $0x1f,%ecx
+  800515:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8d 40 04             	lea    0x4(%eax),%eax
+  80051e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800521:	eb 17                	jmp    80053a <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 50 04             	mov    0x4(%eax),%edx
+  800529:	8b 00                	mov    (%eax),%eax
+  80052b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800531:	8b 45 14             	mov    0x14(%ebp),%eax
+  800534:	8d 40 08             	lea    0x8(%eax),%eax
+  800537:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80053a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80053d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800540:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800545:	85 c9                	test   %ecx,%ecx
+  800547:	0f 89 03 01 00 00    	jns    800650 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	53                   	push   %ebx
+  800551:	6a 2d                	push   $0x2d
+  800553:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800555:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800558:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80055b:	f7 da                	neg    %edx
+  80055d:	83 d1 00             	adc    $0x0,%ecx
+  800560:	f7 d9                	neg    %ecx
+  800562:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800565:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80056a:	e9 e1 00 00 00       	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8b 00                	mov    (%eax),%eax
+  800574:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800577:	89 c1                	mov    %eax,%ecx
+  800579:	c1 f9 1f             	sar    $0x1f,%ecx
+  80057c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8d 40 04             	lea    0x4(%eax),%eax
+  800585:	89 45 14             	mov    %eax,0x14(%ebp)
+  800588:	eb b0                	jmp    80053a <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80058a:	83 f9 01             	cmp    $0x1,%ecx
+  80058d:	7f 1e                	jg     8005ad <vprintfmt+0x30f>
+	else if (lflag)
+  80058f:	85 c9                	test   %ecx,%ecx
+  800591:	74 32                	je     8005c5 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8b 10                	mov    (%eax),%edx
+  800598:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005a8:	e9 a3 00 00 00       	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 10                	mov    (%eax),%edx
+  8005b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c0:	e9 8b 00 00 00       	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 10                	mov    (%eax),%edx
+  8005ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005da:	eb 74                	jmp    800650 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8005dc:	83 f9 01             	cmp    $0x1,%ecx
+  8005df:	7f 1b                	jg     8005fc <vprintfmt+0x35e>
+	else if (lflag)
+  8005e1:	85 c9                	test   %ecx,%ecx
+  8005e3:	74 2c                	je     800611 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8b 10                	mov    (%eax),%edx
+  8005ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005fa:	eb 54                	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8b 10                	mov    (%eax),%edx
+  800601:	8b 48 04             	mov    0x4(%eax),%ecx
+  800604:	8d 40 08             	lea    0x8(%eax),%eax
+  800607:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80060a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80060f:	eb 3f                	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8b 10                	mov    (%eax),%edx
+  800616:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061b:	8d 40 04             	lea    0x4(%eax),%eax
+  80061e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800621:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800626:	eb 28                	jmp    800650 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800628:	83 ec 08             	sub    $0x8,%esp
+  80062b:	53                   	push   %ebx
+  80062c:	6a 30                	push   $0x30
+  80062e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800630:	83 c4 08             	add    $0x8,%esp
+  800633:	53                   	push   %ebx
+  800634:	6a 78                	push   $0x78
+  800636:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800642:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800645:	8d 40 04             	lea    0x4(%eax),%eax
+  800648:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800650:	83 ec 0c             	sub    $0xc,%esp
+  800653:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800657:	50                   	push   %eax
+  800658:	ff 75 e0             	push   -0x20(%ebp)
+  80065b:	57                   	push   %edi
+  80065c:	51                   	push   %ecx
+  80065d:	52                   	push   %edx
+  80065e:	89 da                	mov    %ebx,%edx
+  800660:	89 f0                	mov    %esi,%eax
+  800662:	e8 54 fb ff ff       	call   8001bb <printnum>
+			break;
+  800667:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80066a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80066d:	e9 4a fc ff ff       	jmp    8002bc <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800672:	83 f9 01             	cmp    $0x1,%ecx
+  800675:	7f 1b                	jg     800692 <vprintfmt+0x3f4>
+	else if (lflag)
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	74 2c                	je     8006a7 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800685:	8d 40 04             	lea    0x4(%eax),%eax
+  800688:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80068b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800690:	eb be                	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	8b 48 04             	mov    0x4(%eax),%ecx
+  80069a:	8d 40 08             	lea    0x8(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a5:	eb a9                	jmp    800650 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006bc:	eb 92                	jmp    800650 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8006be:	83 ec 08             	sub    $0x8,%esp
+  8006c1:	53                   	push   %ebx
+  8006c2:	6a 25                	push   $0x25
+  8006c4:	ff d6                	call   *%esi
+			break;
+  8006c6:	83 c4 10             	add    $0x10,%esp
+  8006c9:	eb 9f                	jmp    80066a <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	53                   	push   %ebx
+  8006cf:	6a 25                	push   $0x25
+  8006d1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006d3:	83 c4 10             	add    $0x10,%esp
+  8006d6:	89 f8                	mov    %edi,%eax
+  8006d8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006dc:	74 05                	je     8006e3 <vprintfmt+0x445>
+  8006de:	83 e8 01             	sub    $0x1,%eax
+  8006e1:	eb f5                	jmp    8006d8 <vprintfmt+0x43a>
+  8006e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006e6:	eb 82                	jmp    80066a <vprintfmt+0x3cc>
+
+008006e8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006e8:	55                   	push   %ebp
+  8006e9:	89 e5                	mov    %esp,%ebp
+  8006eb:	83 ec 18             	sub    $0x18,%esp
+  8006ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006f7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006fb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800705:	85 c0                	test   %eax,%eax
+  800707:	74 26                	je     80072f <vsnprintf+0x47>
+  800709:	85 d2                	test   %edx,%edx
+  80070b:	7e 22                	jle    80072f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80070d:	ff 75 14             	push   0x14(%ebp)
+  800710:	ff 75 10             	push   0x10(%ebp)
+  800713:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800716:	50                   	push   %eax
+  800717:	68 64 02 80 00       	push   $0x800264
+  80071c:	e8 7d fb ff ff       	call   80029e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800721:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800724:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80072a:	83 c4 10             	add    $0x10,%esp
+}
+  80072d:	c9                   	leave
+  80072e:	c3                   	ret
+		return -E_INVAL;
+  80072f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800734:	eb f7                	jmp    80072d <vsnprintf+0x45>
+
+00800736 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800736:	55                   	push   %ebp
+  800737:	89 e5                	mov    %esp,%ebp
+  800739:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80073c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80073f:	50                   	push   %eax
+  800740:	ff 75 10             	push   0x10(%ebp)
+  800743:	ff 75 0c             	push   0xc(%ebp)
+  800746:	ff 75 08             	push   0x8(%ebp)
+  800749:	e8 9a ff ff ff       	call   8006e8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+
+00800750 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075b:	eb 03                	jmp    800760 <strlen+0x10>
+		n++;
+  80075d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800760:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800764:	75 f7                	jne    80075d <strlen+0xd>
+	return n;
+}
+  800766:	5d                   	pop    %ebp
+  800767:	c3                   	ret
+
+00800768 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80076e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800771:	b8 00 00 00 00       	mov    $0x0,%eax
+  800776:	eb 03                	jmp    80077b <strnlen+0x13>
+		n++;
+  800778:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80077b:	39 d0                	cmp    %edx,%eax
+  80077d:	74 08                	je     800787 <strnlen+0x1f>
+  80077f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800783:	75 f3                	jne    800778 <strnlen+0x10>
+  800785:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800787:	89 d0                	mov    %edx,%eax
+  800789:	5d                   	pop    %ebp
+  80078a:	c3                   	ret
+
+0080078b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80078b:	55                   	push   %ebp
+  80078c:	89 e5                	mov    %esp,%ebp
+  80078e:	53                   	push   %ebx
+  80078f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800792:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80079e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007a1:	83 c0 01             	add    $0x1,%eax
+  8007a4:	84 d2                	test   %dl,%dl
+  8007a6:	75 f2                	jne    80079a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007a8:	89 c8                	mov    %ecx,%eax
+  8007aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ad:	c9                   	leave
+  8007ae:	c3                   	ret
+
+008007af <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	53                   	push   %ebx
+  8007b3:	83 ec 10             	sub    $0x10,%esp
+  8007b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007b9:	53                   	push   %ebx
+  8007ba:	e8 91 ff ff ff       	call   800750 <strlen>
+  8007bf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007c2:	ff 75 0c             	push   0xc(%ebp)
+  8007c5:	01 d8                	add    %ebx,%eax
+  8007c7:	50                   	push   %eax
+  8007c8:	e8 be ff ff ff       	call   80078b <strcpy>
+	return dst;
+}
+  8007cd:	89 d8                	mov    %ebx,%eax
+  8007cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d2:	c9                   	leave
+  8007d3:	c3                   	ret
+
+008007d4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	56                   	push   %esi
+  8007d8:	53                   	push   %ebx
+  8007d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007df:	89 f3                	mov    %esi,%ebx
+  8007e1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007e4:	89 f0                	mov    %esi,%eax
+  8007e6:	eb 0f                	jmp    8007f7 <strncpy+0x23>
+		*dst++ = *src;
+  8007e8:	83 c0 01             	add    $0x1,%eax
+  8007eb:	0f b6 0a             	movzbl (%edx),%ecx
+  8007ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007f1:	80 f9 01             	cmp    $0x1,%cl
+  8007f4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007f7:	39 d8                	cmp    %ebx,%eax
+  8007f9:	75 ed                	jne    8007e8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007fb:	89 f0                	mov    %esi,%eax
+  8007fd:	5b                   	pop    %ebx
+  8007fe:	5e                   	pop    %esi
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	56                   	push   %esi
+  800805:	53                   	push   %ebx
+  800806:	8b 75 08             	mov    0x8(%ebp),%esi
+  800809:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80080f:	89 f0                	mov    %esi,%eax
+  800811:	85 d2                	test   %edx,%edx
+  800813:	74 21                	je     800836 <strlcpy+0x35>
+  800815:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800819:	89 f2                	mov    %esi,%edx
+  80081b:	eb 09                	jmp    800826 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80081d:	83 c1 01             	add    $0x1,%ecx
+  800820:	83 c2 01             	add    $0x1,%edx
+  800823:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800826:	39 c2                	cmp    %eax,%edx
+  800828:	74 09                	je     800833 <strlcpy+0x32>
+  80082a:	0f b6 19             	movzbl (%ecx),%ebx
+  80082d:	84 db                	test   %bl,%bl
+  80082f:	75 ec                	jne    80081d <strlcpy+0x1c>
+  800831:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800833:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800836:	29 f0                	sub    %esi,%eax
+}
+  800838:	5b                   	pop    %ebx
+  800839:	5e                   	pop    %esi
+  80083a:	5d                   	pop    %ebp
+  80083b:	c3                   	ret
+
+0080083c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80083c:	55                   	push   %ebp
+  80083d:	89 e5                	mov    %esp,%ebp
+  80083f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800842:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800845:	eb 06                	jmp    80084d <strcmp+0x11>
+		p++, q++;
+  800847:	83 c1 01             	add    $0x1,%ecx
+  80084a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80084d:	0f b6 01             	movzbl (%ecx),%eax
+  800850:	84 c0                	test   %al,%al
+  800852:	74 04                	je     800858 <strcmp+0x1c>
+  800854:	3a 02                	cmp    (%edx),%al
+  800856:	74 ef                	je     800847 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800858:	0f b6 c0             	movzbl %al,%eax
+  80085b:	0f b6 12             	movzbl (%edx),%edx
+  80085e:	29 d0                	sub    %edx,%eax
+}
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	53                   	push   %ebx
+  800866:	8b 45 08             	mov    0x8(%ebp),%eax
+  800869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80086f:	eb 09                	jmp    80087a <strncmp+0x18>
+		n--, p++, q++;
+  800871:	83 ea 01             	sub    $0x1,%edx
+  800874:	83 c0 01             	add    $0x1,%eax
+  800877:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80087a:	85 d2                	test   %edx,%edx
+  80087c:	74 18                	je     800896 <strncmp+0x34>
+  80087e:	0f b6 18             	movzbl (%eax),%ebx
+  800881:	84 db                	test   %bl,%bl
+  800883:	74 04                	je     800889 <strncmp+0x27>
+  800885:	3a 19                	cmp    (%ecx),%bl
+  800887:	74 e8                	je     800871 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800889:	0f b6 00             	movzbl (%eax),%eax
+  80088c:	0f b6 11             	movzbl (%ecx),%edx
+  80088f:	29 d0                	sub    %edx,%eax
+}
+  800891:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800894:	c9                   	leave
+  800895:	c3                   	ret
+		return 0;
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	eb f4                	jmp    800891 <strncmp+0x2f>
+
+0080089d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a7:	eb 03                	jmp    8008ac <strchr+0xf>
+  8008a9:	83 c0 01             	add    $0x1,%eax
+  8008ac:	0f b6 10             	movzbl (%eax),%edx
+  8008af:	84 d2                	test   %dl,%dl
+  8008b1:	74 06                	je     8008b9 <strchr+0x1c>
+		if (*s == c)
+  8008b3:	38 ca                	cmp    %cl,%dl
+  8008b5:	75 f2                	jne    8008a9 <strchr+0xc>
+  8008b7:	eb 05                	jmp    8008be <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008be:	5d                   	pop    %ebp
+  8008bf:	c3                   	ret
+
+008008c0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ca:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008cd:	38 ca                	cmp    %cl,%dl
+  8008cf:	74 09                	je     8008da <strfind+0x1a>
+  8008d1:	84 d2                	test   %dl,%dl
+  8008d3:	74 05                	je     8008da <strfind+0x1a>
+	for (; *s; s++)
+  8008d5:	83 c0 01             	add    $0x1,%eax
+  8008d8:	eb f0                	jmp    8008ca <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	57                   	push   %edi
+  8008e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008e6:	85 c9                	test   %ecx,%ecx
+  8008e8:	74 20                	je     80090a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008ea:	89 f8                	mov    %edi,%eax
+  8008ec:	09 c8                	or     %ecx,%eax
+  8008ee:	a8 03                	test   $0x3,%al
+  8008f0:	75 12                	jne    800904 <memset+0x28>
+		c &= 0xFF;
+  8008f2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008f6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008fc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ff:	fc                   	cld
+  800900:	f3 ab                	rep stos %eax,%es:(%edi)
+  800902:	eb 06                	jmp    80090a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800904:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800907:	fc                   	cld
+  800908:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80090a:	89 f8                	mov    %edi,%eax
+  80090c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80090f:	c9                   	leave
+  800910:	c3                   	ret
+
+00800911 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	57                   	push   %edi
+  800915:	56                   	push   %esi
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80091c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80091f:	39 c6                	cmp    %eax,%esi
+  800921:	73 32                	jae    800955 <memmove+0x44>
+  800923:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800926:	39 d0                	cmp    %edx,%eax
+  800928:	73 2b                	jae    800955 <memmove+0x44>
+		s += n;
+		d += n;
+  80092a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80092d:	89 d6                	mov    %edx,%esi
+  80092f:	09 fe                	or     %edi,%esi
+  800931:	09 ce                	or     %ecx,%esi
+  800933:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800939:	75 0e                	jne    800949 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80093b:	83 ef 04             	sub    $0x4,%edi
+  80093e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800941:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800944:	fd                   	std
+  800945:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800947:	eb 09                	jmp    800952 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800949:	83 ef 01             	sub    $0x1,%edi
+  80094c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80094f:	fd                   	std
+  800950:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800952:	fc                   	cld
+  800953:	eb 1a                	jmp    80096f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800955:	89 f2                	mov    %esi,%edx
+  800957:	09 c2                	or     %eax,%edx
+  800959:	09 ca                	or     %ecx,%edx
+  80095b:	f6 c2 03             	test   $0x3,%dl
+  80095e:	75 0a                	jne    80096a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800960:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800963:	89 c7                	mov    %eax,%edi
+  800965:	fc                   	cld
+  800966:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800968:	eb 05                	jmp    80096f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80096a:	89 c7                	mov    %eax,%edi
+  80096c:	fc                   	cld
+  80096d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80096f:	5e                   	pop    %esi
+  800970:	5f                   	pop    %edi
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800979:	ff 75 10             	push   0x10(%ebp)
+  80097c:	ff 75 0c             	push   0xc(%ebp)
+  80097f:	ff 75 08             	push   0x8(%ebp)
+  800982:	e8 8a ff ff ff       	call   800911 <memmove>
+}
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+
+00800989 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800989:	55                   	push   %ebp
+  80098a:	89 e5                	mov    %esp,%ebp
+  80098c:	56                   	push   %esi
+  80098d:	53                   	push   %ebx
+  80098e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800991:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800994:	89 c6                	mov    %eax,%esi
+  800996:	03 75 10             	add    0x10(%ebp),%esi
+  800999:	eb 06                	jmp    8009a1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80099b:	83 c0 01             	add    $0x1,%eax
+  80099e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009a1:	39 f0                	cmp    %esi,%eax
+  8009a3:	74 14                	je     8009b9 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009a5:	0f b6 08             	movzbl (%eax),%ecx
+  8009a8:	0f b6 1a             	movzbl (%edx),%ebx
+  8009ab:	38 d9                	cmp    %bl,%cl
+  8009ad:	74 ec                	je     80099b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009af:	0f b6 c1             	movzbl %cl,%eax
+  8009b2:	0f b6 db             	movzbl %bl,%ebx
+  8009b5:	29 d8                	sub    %ebx,%eax
+  8009b7:	eb 05                	jmp    8009be <memcmp+0x35>
+	}
+
+	return 0;
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009be:	5b                   	pop    %ebx
+  8009bf:	5e                   	pop    %esi
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+
+008009c2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009c2:	55                   	push   %ebp
+  8009c3:	89 e5                	mov    %esp,%ebp
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009d0:	eb 03                	jmp    8009d5 <memfind+0x13>
+  8009d2:	83 c0 01             	add    $0x1,%eax
+  8009d5:	39 d0                	cmp    %edx,%eax
+  8009d7:	73 04                	jae    8009dd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009d9:	38 08                	cmp    %cl,(%eax)
+  8009db:	75 f5                	jne    8009d2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009dd:	5d                   	pop    %ebp
+  8009de:	c3                   	ret
+
+008009df <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	57                   	push   %edi
+  8009e3:	56                   	push   %esi
+  8009e4:	53                   	push   %ebx
+  8009e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009eb:	eb 03                	jmp    8009f0 <strtol+0x11>
+		s++;
+  8009ed:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009f0:	0f b6 02             	movzbl (%edx),%eax
+  8009f3:	3c 20                	cmp    $0x20,%al
+  8009f5:	74 f6                	je     8009ed <strtol+0xe>
+  8009f7:	3c 09                	cmp    $0x9,%al
+  8009f9:	74 f2                	je     8009ed <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009fb:	3c 2b                	cmp    $0x2b,%al
+  8009fd:	74 2a                	je     800a29 <strtol+0x4a>
+	int neg = 0;
+  8009ff:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a04:	3c 2d                	cmp    $0x2d,%al
+  800a06:	74 2b                	je     800a33 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a08:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a0e:	75 0f                	jne    800a1f <strtol+0x40>
+  800a10:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a13:	74 28                	je     800a3d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a15:	85 db                	test   %ebx,%ebx
+  800a17:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a1c:	0f 44 d8             	cmove  %eax,%ebx
+  800a1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a24:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a27:	eb 46                	jmp    800a6f <strtol+0x90>
+		s++;
+  800a29:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a31:	eb d5                	jmp    800a08 <strtol+0x29>
+		s++, neg = 1;
+  800a33:	83 c2 01             	add    $0x1,%edx
+  800a36:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a3b:	eb cb                	jmp    800a08 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a41:	74 0e                	je     800a51 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a43:	85 db                	test   %ebx,%ebx
+  800a45:	75 d8                	jne    800a1f <strtol+0x40>
+		s++, base = 8;
+  800a47:	83 c2 01             	add    $0x1,%edx
+  800a4a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a4f:	eb ce                	jmp    800a1f <strtol+0x40>
+		s += 2, base = 16;
+  800a51:	83 c2 02             	add    $0x2,%edx
+  800a54:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a59:	eb c4                	jmp    800a1f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a5b:	0f be c0             	movsbl %al,%eax
+  800a5e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a61:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a64:	7d 3a                	jge    800aa0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a66:	83 c2 01             	add    $0x1,%edx
+  800a69:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a6d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a6f:	0f b6 02             	movzbl (%edx),%eax
+  800a72:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a75:	89 f3                	mov    %esi,%ebx
+  800a77:	80 fb 09             	cmp    $0x9,%bl
+  800a7a:	76 df                	jbe    800a5b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a7c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a7f:	89 f3                	mov    %esi,%ebx
+  800a81:	80 fb 19             	cmp    $0x19,%bl
+  800a84:	77 08                	ja     800a8e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a86:	0f be c0             	movsbl %al,%eax
+  800a89:	83 e8 57             	sub    $0x57,%eax
+  800a8c:	eb d3                	jmp    800a61 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a8e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a91:	89 f3                	mov    %esi,%ebx
+  800a93:	80 fb 19             	cmp    $0x19,%bl
+  800a96:	77 08                	ja     800aa0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a98:	0f be c0             	movsbl %al,%eax
+  800a9b:	83 e8 37             	sub    $0x37,%eax
+  800a9e:	eb c1                	jmp    800a61 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800aa0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aa4:	74 05                	je     800aab <strtol+0xcc>
+		*endptr = (char *) s;
+  800aa6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800aab:	89 c8                	mov    %ecx,%eax
+  800aad:	f7 d8                	neg    %eax
+  800aaf:	85 ff                	test   %edi,%edi
+  800ab1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ab4:	89 c8                	mov    %ecx,%eax
+  800ab6:	5b                   	pop    %ebx
+  800ab7:	5e                   	pop    %esi
+  800ab8:	5f                   	pop    %edi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <atoi>:
+
+int
+atoi(const char* s)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800ac1:	6a 00                	push   $0x0
+  800ac3:	6a 00                	push   $0x0
+  800ac5:	ff 75 08             	push   0x8(%ebp)
+  800ac8:	e8 12 ff ff ff       	call   8009df <strtol>
+}
+  800acd:	c9                   	leave
+  800ace:	c3                   	ret
+
+00800acf <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	57                   	push   %edi
+  800ad3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adf:	89 c3                	mov    %eax,%ebx
+  800ae1:	89 c7                	mov    %eax,%edi
+  800ae3:	6a 00                	push   $0x0
+  800ae5:	55                   	push   %ebp
+  800ae6:	56                   	push   %esi
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	8d 35 f1 0a 80 00    	lea    0x800af1,%esi
+  800aef:	0f 34                	sysenter
+
+00800af1 <after_sysenter_label_47>:
+  800af1:	5e                   	pop    %esi
+  800af2:	5d                   	pop    %ebp
+  800af3:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800af6:	5b                   	pop    %ebx
+  800af7:	5f                   	pop    %edi
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+
+00800afa <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800aff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b04:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b09:	89 d1                	mov    %edx,%ecx
+  800b0b:	89 d3                	mov    %edx,%ebx
+  800b0d:	89 d7                	mov    %edx,%edi
+  800b0f:	6a 00                	push   $0x0
+  800b11:	55                   	push   %ebp
+  800b12:	56                   	push   %esi
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	8d 35 1d 0b 80 00    	lea    0x800b1d,%esi
+  800b1b:	0f 34                	sysenter
+
+00800b1d <after_sysenter_label_128>:
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5d                   	pop    %ebp
+  800b1f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b22:	5b                   	pop    %ebx
+  800b23:	5f                   	pop    %edi
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	57                   	push   %edi
+  800b2a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b33:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b38:	89 cb                	mov    %ecx,%ebx
+  800b3a:	89 cf                	mov    %ecx,%edi
+  800b3c:	6a 00                	push   $0x0
+  800b3e:	55                   	push   %ebp
+  800b3f:	56                   	push   %esi
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	8d 35 4a 0b 80 00    	lea    0x800b4a,%esi
+  800b48:	0f 34                	sysenter
+
+00800b4a <after_sysenter_label_212>:
+  800b4a:	5e                   	pop    %esi
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	7f 07                	jg     800b5a <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b56:	5b                   	pop    %ebx
+  800b57:	5f                   	pop    %edi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b5a:	83 ec 0c             	sub    $0xc,%esp
+  800b5d:	50                   	push   %eax
+  800b5e:	6a 03                	push   $0x3
+  800b60:	68 b5 4a 80 00       	push   $0x804ab5
+  800b65:	6a 54                	push   $0x54
+  800b67:	68 d2 4a 80 00       	push   $0x804ad2
+  800b6c:	e8 38 30 00 00       	call   803ba9 <_panic>
+
+00800b71 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	57                   	push   %edi
+  800b75:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b80:	89 d1                	mov    %edx,%ecx
+  800b82:	89 d3                	mov    %edx,%ebx
+  800b84:	89 d7                	mov    %edx,%edi
+  800b86:	6a 00                	push   $0x0
+  800b88:	55                   	push   %ebp
+  800b89:	56                   	push   %esi
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	8d 35 94 0b 80 00    	lea    0x800b94,%esi
+  800b92:	0f 34                	sysenter
+
+00800b94 <after_sysenter_label_309>:
+  800b94:	5e                   	pop    %esi
+  800b95:	5d                   	pop    %ebp
+  800b96:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b99:	5b                   	pop    %ebx
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ba2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bac:	89 d1                	mov    %edx,%ecx
+  800bae:	89 d3                	mov    %edx,%ebx
+  800bb0:	89 d7                	mov    %edx,%edi
+  800bb2:	6a 00                	push   $0x0
+  800bb4:	55                   	push   %ebp
+  800bb5:	56                   	push   %esi
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	8d 35 c0 0b 80 00    	lea    0x800bc0,%esi
+  800bbe:	0f 34                	sysenter
+
+00800bc0 <after_sysenter_label_391>:
+  800bc0:	5e                   	pop    %esi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bc5:	5b                   	pop    %ebx
+  800bc6:	5f                   	pop    %edi
+  800bc7:	5d                   	pop    %ebp
+  800bc8:	c3                   	ret
+
+00800bc9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	57                   	push   %edi
+  800bcd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800be1:	6a 00                	push   $0x0
+  800be3:	55                   	push   %ebp
+  800be4:	56                   	push   %esi
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	8d 35 ef 0b 80 00    	lea    0x800bef,%esi
+  800bed:	0f 34                	sysenter
+
+00800bef <after_sysenter_label_479>:
+  800bef:	5e                   	pop    %esi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bf4:	85 c0                	test   %eax,%eax
+  800bf6:	7f 07                	jg     800bff <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bfb:	5b                   	pop    %ebx
+  800bfc:	5f                   	pop    %edi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bff:	83 ec 0c             	sub    $0xc,%esp
+  800c02:	50                   	push   %eax
+  800c03:	6a 04                	push   $0x4
+  800c05:	68 b5 4a 80 00       	push   $0x804ab5
+  800c0a:	6a 54                	push   $0x54
+  800c0c:	68 d2 4a 80 00       	push   $0x804ad2
+  800c11:	e8 93 2f 00 00       	call   803ba9 <_panic>
+
+00800c16 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c21:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c29:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c2c:	ff 75 18             	push   0x18(%ebp)
+  800c2f:	55                   	push   %ebp
+  800c30:	56                   	push   %esi
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	8d 35 3b 0c 80 00    	lea    0x800c3b,%esi
+  800c39:	0f 34                	sysenter
+
+00800c3b <after_sysenter_label_593>:
+  800c3b:	5e                   	pop    %esi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c40:	85 c0                	test   %eax,%eax
+  800c42:	7f 07                	jg     800c4b <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c47:	5b                   	pop    %ebx
+  800c48:	5f                   	pop    %edi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+  800c4e:	50                   	push   %eax
+  800c4f:	6a 05                	push   $0x5
+  800c51:	68 b5 4a 80 00       	push   $0x804ab5
+  800c56:	6a 54                	push   $0x54
+  800c58:	68 d2 4a 80 00       	push   $0x804ad2
+  800c5d:	e8 47 2f 00 00       	call   803ba9 <_panic>
+
+00800c62 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c77:	89 df                	mov    %ebx,%edi
+  800c79:	6a 00                	push   $0x0
+  800c7b:	55                   	push   %ebp
+  800c7c:	56                   	push   %esi
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8d 35 87 0c 80 00    	lea    0x800c87,%esi
+  800c85:	0f 34                	sysenter
+
+00800c87 <after_sysenter_label_704>:
+  800c87:	5e                   	pop    %esi
+  800c88:	5d                   	pop    %ebp
+  800c89:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c8c:	85 c0                	test   %eax,%eax
+  800c8e:	7f 07                	jg     800c97 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c93:	5b                   	pop    %ebx
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  800c9a:	50                   	push   %eax
+  800c9b:	6a 06                	push   $0x6
+  800c9d:	68 b5 4a 80 00       	push   $0x804ab5
+  800ca2:	6a 54                	push   $0x54
+  800ca4:	68 d2 4a 80 00       	push   $0x804ad2
+  800ca9:	e8 fb 2e 00 00       	call   803ba9 <_panic>
+
+00800cae <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cc3:	89 df                	mov    %ebx,%edi
+  800cc5:	6a 00                	push   $0x0
+  800cc7:	55                   	push   %ebp
+  800cc8:	56                   	push   %esi
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	8d 35 d3 0c 80 00    	lea    0x800cd3,%esi
+  800cd1:	0f 34                	sysenter
+
+00800cd3 <after_sysenter_label_808>:
+  800cd3:	5e                   	pop    %esi
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cd8:	85 c0                	test   %eax,%eax
+  800cda:	7f 07                	jg     800ce3 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce3:	83 ec 0c             	sub    $0xc,%esp
+  800ce6:	50                   	push   %eax
+  800ce7:	6a 08                	push   $0x8
+  800ce9:	68 b5 4a 80 00       	push   $0x804ab5
+  800cee:	6a 54                	push   $0x54
+  800cf0:	68 d2 4a 80 00       	push   $0x804ad2
+  800cf5:	e8 af 2e 00 00       	call   803ba9 <_panic>
+
+00800cfa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	57                   	push   %edi
+  800cfe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0f:	89 df                	mov    %ebx,%edi
+  800d11:	6a 00                	push   $0x0
+  800d13:	55                   	push   %ebp
+  800d14:	56                   	push   %esi
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	8d 35 1f 0d 80 00    	lea    0x800d1f,%esi
+  800d1d:	0f 34                	sysenter
+
+00800d1f <after_sysenter_label_912>:
+  800d1f:	5e                   	pop    %esi
+  800d20:	5d                   	pop    %ebp
+  800d21:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d24:	85 c0                	test   %eax,%eax
+  800d26:	7f 07                	jg     800d2f <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+  800d32:	50                   	push   %eax
+  800d33:	6a 09                	push   $0x9
+  800d35:	68 b5 4a 80 00       	push   $0x804ab5
+  800d3a:	6a 54                	push   $0x54
+  800d3c:	68 d2 4a 80 00       	push   $0x804ad2
+  800d41:	e8 63 2e 00 00       	call   803ba9 <_panic>
+
+00800d46 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d56:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d5b:	89 df                	mov    %ebx,%edi
+  800d5d:	6a 00                	push   $0x0
+  800d5f:	55                   	push   %ebp
+  800d60:	56                   	push   %esi
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	8d 35 6b 0d 80 00    	lea    0x800d6b,%esi
+  800d69:	0f 34                	sysenter
+
+00800d6b <after_sysenter_label_1016>:
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d70:	85 c0                	test   %eax,%eax
+  800d72:	7f 07                	jg     800d7b <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d77:	5b                   	pop    %ebx
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7b:	83 ec 0c             	sub    $0xc,%esp
+  800d7e:	50                   	push   %eax
+  800d7f:	6a 0a                	push   $0xa
+  800d81:	68 b5 4a 80 00       	push   $0x804ab5
+  800d86:	6a 54                	push   $0x54
+  800d88:	68 d2 4a 80 00       	push   $0x804ad2
+  800d8d:	e8 17 2e 00 00       	call   803ba9 <_panic>
+
+00800d92 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800da2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da8:	6a 00                	push   $0x0
+  800daa:	55                   	push   %ebp
+  800dab:	56                   	push   %esi
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	8d 35 b6 0d 80 00    	lea    0x800db6,%esi
+  800db4:	0f 34                	sysenter
+
+00800db6 <after_sysenter_label_1126>:
+  800db6:	5e                   	pop    %esi
+  800db7:	5d                   	pop    %ebp
+  800db8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dd1:	89 cb                	mov    %ecx,%ebx
+  800dd3:	89 cf                	mov    %ecx,%edi
+  800dd5:	6a 00                	push   $0x0
+  800dd7:	55                   	push   %ebp
+  800dd8:	56                   	push   %esi
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	8d 35 e3 0d 80 00    	lea    0x800de3,%esi
+  800de1:	0f 34                	sysenter
+
+00800de3 <after_sysenter_label_1210>:
+  800de3:	5e                   	pop    %esi
+  800de4:	5d                   	pop    %ebp
+  800de5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	7f 07                	jg     800df3 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800def:	5b                   	pop    %ebx
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+  800df6:	50                   	push   %eax
+  800df7:	6a 0d                	push   $0xd
+  800df9:	68 b5 4a 80 00       	push   $0x804ab5
+  800dfe:	6a 54                	push   $0x54
+  800e00:	68 d2 4a 80 00       	push   $0x804ad2
+  800e05:	e8 9f 2d 00 00       	call   803ba9 <_panic>
+
+00800e0a <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e1f:	89 df                	mov    %ebx,%edi
+  800e21:	6a 00                	push   $0x0
+  800e23:	55                   	push   %ebp
+  800e24:	56                   	push   %esi
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	8d 35 2f 0e 80 00    	lea    0x800e2f,%esi
+  800e2d:	0f 34                	sysenter
+
+00800e2f <after_sysenter_label_1311>:
+  800e2f:	5e                   	pop    %esi
+  800e30:	5d                   	pop    %ebp
+  800e31:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e34:	85 c0                	test   %eax,%eax
+  800e36:	7f 07                	jg     800e3f <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+  800e42:	50                   	push   %eax
+  800e43:	6a 42                	push   $0x42
+  800e45:	68 b5 4a 80 00       	push   $0x804ab5
+  800e4a:	6a 54                	push   $0x54
+  800e4c:	68 d2 4a 80 00       	push   $0x804ad2
+  800e51:	e8 53 2d 00 00       	call   803ba9 <_panic>
+
+00800e56 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e60:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e65:	89 d1                	mov    %edx,%ecx
+  800e67:	89 d3                	mov    %edx,%ebx
+  800e69:	89 d7                	mov    %edx,%edi
+  800e6b:	6a 00                	push   $0x0
+  800e6d:	55                   	push   %ebp
+  800e6e:	56                   	push   %esi
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	8d 35 79 0e 80 00    	lea    0x800e79,%esi
+  800e77:	0f 34                	sysenter
+
+00800e79 <after_sysenter_label_1411>:
+  800e79:	5e                   	pop    %esi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+
+00800e82 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e97:	89 df                	mov    %ebx,%edi
+  800e99:	6a 00                	push   $0x0
+  800e9b:	55                   	push   %ebp
+  800e9c:	56                   	push   %esi
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	8d 35 a7 0e 80 00    	lea    0x800ea7,%esi
+  800ea5:	0f 34                	sysenter
+
+00800ea7 <after_sysenter_label_1497>:
+  800ea7:	5e                   	pop    %esi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800eac:	5b                   	pop    %ebx
+  800ead:	5f                   	pop    %edi
+  800eae:	5d                   	pop    %ebp
+  800eaf:	c3                   	ret
+
+00800eb0 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	6a 00                	push   $0x0
+  800ec9:	55                   	push   %ebp
+  800eca:	56                   	push   %esi
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	8d 35 d5 0e 80 00    	lea    0x800ed5,%esi
+  800ed3:	0f 34                	sysenter
+
+00800ed5 <after_sysenter_label_1583>:
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+
+00800ede <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800eee:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef6:	6a 00                	push   $0x0
+  800ef8:	55                   	push   %ebp
+  800ef9:	56                   	push   %esi
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	8d 35 04 0f 80 00    	lea    0x800f04,%esi
+  800f02:	0f 34                	sysenter
+
+00800f04 <after_sysenter_label_1672>:
+  800f04:	5e                   	pop    %esi
+  800f05:	5d                   	pop    %ebp
+  800f06:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f22:	89 df                	mov    %ebx,%edi
+  800f24:	6a 00                	push   $0x0
+  800f26:	55                   	push   %ebp
+  800f27:	56                   	push   %esi
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	8d 35 32 0f 80 00    	lea    0x800f32,%esi
+  800f30:	0f 34                	sysenter
+
+00800f32 <after_sysenter_label_1758>:
+  800f32:	5e                   	pop    %esi
+  800f33:	5d                   	pop    %ebp
+  800f34:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f37:	5b                   	pop    %ebx
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f48:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f4d:	89 cb                	mov    %ecx,%ebx
+  800f4f:	89 cf                	mov    %ecx,%edi
+  800f51:	6a 00                	push   $0x0
+  800f53:	55                   	push   %ebp
+  800f54:	56                   	push   %esi
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	8d 35 5f 0f 80 00    	lea    0x800f5f,%esi
+  800f5d:	0f 34                	sysenter
+
+00800f5f <after_sysenter_label_1842>:
+  800f5f:	5e                   	pop    %esi
+  800f60:	5d                   	pop    %ebp
+  800f61:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	7f 07                	jg     800f6f <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f6b:	5b                   	pop    %ebx
+  800f6c:	5f                   	pop    %edi
+  800f6d:	5d                   	pop    %ebp
+  800f6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+  800f72:	50                   	push   %eax
+  800f73:	6a 13                	push   $0x13
+  800f75:	68 b5 4a 80 00       	push   $0x804ab5
+  800f7a:	6a 54                	push   $0x54
+  800f7c:	68 d2 4a 80 00       	push   $0x804ad2
+  800f81:	e8 23 2c 00 00       	call   803ba9 <_panic>
+
+00800f86 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f90:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f95:	89 d1                	mov    %edx,%ecx
+  800f97:	89 d3                	mov    %edx,%ebx
+  800f99:	89 d7                	mov    %edx,%edi
+  800f9b:	6a 00                	push   $0x0
+  800f9d:	55                   	push   %ebp
+  800f9e:	56                   	push   %esi
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	8d 35 a9 0f 80 00    	lea    0x800fa9,%esi
+  800fa7:	0f 34                	sysenter
+
+00800fa9 <after_sysenter_label_1939>:
+  800fa9:	5e                   	pop    %esi
+  800faa:	5d                   	pop    %ebp
+  800fab:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+
+00800fb2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fca:	6a 00                	push   $0x0
+  800fcc:	55                   	push   %ebp
+  800fcd:	56                   	push   %esi
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	8d 35 d8 0f 80 00    	lea    0x800fd8,%esi
+  800fd6:	0f 34                	sysenter
+
+00800fd8 <after_sysenter_label_2028>:
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ff6:	89 df                	mov    %ebx,%edi
+  800ff8:	6a 00                	push   $0x0
+  800ffa:	55                   	push   %ebp
+  800ffb:	56                   	push   %esi
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	8d 35 06 10 80 00    	lea    0x801006,%esi
+  801004:	0f 34                	sysenter
+
+00801006 <after_sysenter_label_2114>:
+  801006:	5e                   	pop    %esi
+  801007:	5d                   	pop    %ebp
+  801008:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80100b:	5b                   	pop    %ebx
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801024:	89 df                	mov    %ebx,%edi
+  801026:	6a 00                	push   $0x0
+  801028:	55                   	push   %ebp
+  801029:	56                   	push   %esi
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	8d 35 34 10 80 00    	lea    0x801034,%esi
+  801032:	0f 34                	sysenter
+
+00801034 <after_sysenter_label_2200>:
+  801034:	5e                   	pop    %esi
+  801035:	5d                   	pop    %ebp
+  801036:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801039:	5b                   	pop    %ebx
+  80103a:	5f                   	pop    %edi
+  80103b:	5d                   	pop    %ebp
+  80103c:	c3                   	ret
+
+0080103d <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801042:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801052:	89 df                	mov    %ebx,%edi
+  801054:	6a 00                	push   $0x0
+  801056:	55                   	push   %ebp
+  801057:	56                   	push   %esi
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	8d 35 62 10 80 00    	lea    0x801062,%esi
+  801060:	0f 34                	sysenter
+
+00801062 <after_sysenter_label_2286>:
+  801062:	5e                   	pop    %esi
+  801063:	5d                   	pop    %ebp
+  801064:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801067:	5b                   	pop    %ebx
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+
+0080106b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80106e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801071:	05 00 00 00 30       	add    $0x30000000,%eax
+  801076:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+
+0080107b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80107e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801081:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801086:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80108b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+
+00801092 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801095:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80109a:	eb 02                	jmp    80109e <fd_alloc+0xc>
+  80109c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80109e:	89 c2                	mov    %eax,%edx
+  8010a0:	c1 ea 16             	shr    $0x16,%edx
+  8010a3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010aa:	f6 c2 01             	test   $0x1,%dl
+  8010ad:	74 2b                	je     8010da <fd_alloc+0x48>
+  8010af:	89 c2                	mov    %eax,%edx
+  8010b1:	c1 ea 0c             	shr    $0xc,%edx
+  8010b4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010bb:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010c1:	f6 c1 01             	test   $0x1,%cl
+  8010c4:	74 14                	je     8010da <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010c6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010cc:	75 ce                	jne    80109c <fd_alloc+0xa>
+  8010ce:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010d3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010d8:	eb 05                	jmp    8010df <fd_alloc+0x4d>
+			return 0;
+  8010da:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e2:	89 02                	mov    %eax,(%edx)
+}
+  8010e4:	89 c8                	mov    %ecx,%eax
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+
+008010e8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010ee:	83 f8 1f             	cmp    $0x1f,%eax
+  8010f1:	77 30                	ja     801123 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010f3:	c1 e0 0c             	shl    $0xc,%eax
+  8010f6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010fb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801101:	f6 c2 01             	test   $0x1,%dl
+  801104:	74 24                	je     80112a <fd_lookup+0x42>
+  801106:	89 c2                	mov    %eax,%edx
+  801108:	c1 ea 0c             	shr    $0xc,%edx
+  80110b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801112:	f6 c2 01             	test   $0x1,%dl
+  801115:	74 1a                	je     801131 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801117:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80111a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80111c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801121:	5d                   	pop    %ebp
+  801122:	c3                   	ret
+		return -E_INVAL;
+  801123:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801128:	eb f7                	jmp    801121 <fd_lookup+0x39>
+		return -E_INVAL;
+  80112a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80112f:	eb f0                	jmp    801121 <fd_lookup+0x39>
+  801131:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801136:	eb e9                	jmp    801121 <fd_lookup+0x39>
+
+00801138 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	53                   	push   %ebx
+  80113c:	83 ec 04             	sub    $0x4,%esp
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801142:	b8 00 00 00 00       	mov    $0x0,%eax
+  801147:	eb 03                	jmp    80114c <dev_lookup+0x14>
+  801149:	83 c0 01             	add    $0x1,%eax
+  80114c:	8b 1c 85 5c 4b 80 00 	mov    0x804b5c(,%eax,4),%ebx
+  801153:	85 db                	test   %ebx,%ebx
+  801155:	74 0b                	je     801162 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801157:	39 13                	cmp    %edx,(%ebx)
+  801159:	75 ee                	jne    801149 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80115b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801160:	eb 49                	jmp    8011ab <dev_lookup+0x73>
+  801162:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801164:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80116a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80116f:	77 18                	ja     801189 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801171:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801176:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801178:	c1 e8 10             	shr    $0x10,%eax
+  80117b:	74 0c                	je     801189 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80117d:	c1 e0 10             	shl    $0x10,%eax
+  801180:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801185:	29 c1                	sub    %eax,%ecx
+  801187:	eb 06                	jmp    80118f <dev_lookup+0x57>
+		return pthread_main_tls;
+  801189:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80118f:	8b 01                	mov    (%ecx),%eax
+  801191:	8b 40 48             	mov    0x48(%eax),%eax
+  801194:	83 ec 04             	sub    $0x4,%esp
+  801197:	52                   	push   %edx
+  801198:	50                   	push   %eax
+  801199:	68 e0 4a 80 00       	push   $0x804ae0
+  80119e:	e8 04 f0 ff ff       	call   8001a7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011a3:	83 c4 10             	add    $0x10,%esp
+  8011a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ae:	89 1a                	mov    %ebx,(%edx)
+}
+  8011b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+
+008011b5 <fd_close>:
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 24             	sub    $0x24,%esp
+  8011be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011c7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011c8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ce:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011d1:	50                   	push   %eax
+  8011d2:	e8 11 ff ff ff       	call   8010e8 <fd_lookup>
+  8011d7:	89 c3                	mov    %eax,%ebx
+  8011d9:	83 c4 10             	add    $0x10,%esp
+  8011dc:	85 c0                	test   %eax,%eax
+  8011de:	78 05                	js     8011e5 <fd_close+0x30>
+	    || fd != fd2)
+  8011e0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011e3:	74 16                	je     8011fb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011e5:	89 f8                	mov    %edi,%eax
+  8011e7:	84 c0                	test   %al,%al
+  8011e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ee:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011f1:	89 d8                	mov    %ebx,%eax
+  8011f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011fb:	83 ec 08             	sub    $0x8,%esp
+  8011fe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801201:	50                   	push   %eax
+  801202:	ff 36                	push   (%esi)
+  801204:	e8 2f ff ff ff       	call   801138 <dev_lookup>
+  801209:	89 c3                	mov    %eax,%ebx
+  80120b:	83 c4 10             	add    $0x10,%esp
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	78 1a                	js     80122c <fd_close+0x77>
+		if (dev->dev_close)
+  801212:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801215:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801218:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80121d:	85 c0                	test   %eax,%eax
+  80121f:	74 0b                	je     80122c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  801224:	56                   	push   %esi
+  801225:	ff d0                	call   *%eax
+  801227:	89 c3                	mov    %eax,%ebx
+  801229:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80122c:	83 ec 08             	sub    $0x8,%esp
+  80122f:	56                   	push   %esi
+  801230:	6a 00                	push   $0x0
+  801232:	e8 2b fa ff ff       	call   800c62 <sys_page_unmap>
+	return r;
+  801237:	83 c4 10             	add    $0x10,%esp
+  80123a:	eb b5                	jmp    8011f1 <fd_close+0x3c>
+
+0080123c <close>:
+
+int
+close(int fdnum)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801242:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801245:	50                   	push   %eax
+  801246:	ff 75 08             	push   0x8(%ebp)
+  801249:	e8 9a fe ff ff       	call   8010e8 <fd_lookup>
+  80124e:	83 c4 10             	add    $0x10,%esp
+  801251:	85 c0                	test   %eax,%eax
+  801253:	79 02                	jns    801257 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+		return fd_close(fd, 1);
+  801257:	83 ec 08             	sub    $0x8,%esp
+  80125a:	6a 01                	push   $0x1
+  80125c:	ff 75 f4             	push   -0xc(%ebp)
+  80125f:	e8 51 ff ff ff       	call   8011b5 <fd_close>
+  801264:	83 c4 10             	add    $0x10,%esp
+  801267:	eb ec                	jmp    801255 <close+0x19>
+
+00801269 <close_all>:
+
+void
+close_all(void)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	53                   	push   %ebx
+  80126d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801270:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801275:	83 ec 0c             	sub    $0xc,%esp
+  801278:	53                   	push   %ebx
+  801279:	e8 be ff ff ff       	call   80123c <close>
+	for (i = 0; i < MAXFD; i++)
+  80127e:	83 c3 01             	add    $0x1,%ebx
+  801281:	83 c4 10             	add    $0x10,%esp
+  801284:	83 fb 20             	cmp    $0x20,%ebx
+  801287:	75 ec                	jne    801275 <close_all+0xc>
+}
+  801289:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80128c:	c9                   	leave
+  80128d:	c3                   	ret
+
+0080128e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	57                   	push   %edi
+  801292:	56                   	push   %esi
+  801293:	53                   	push   %ebx
+  801294:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801297:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80129a:	50                   	push   %eax
+  80129b:	ff 75 08             	push   0x8(%ebp)
+  80129e:	e8 45 fe ff ff       	call   8010e8 <fd_lookup>
+  8012a3:	89 c3                	mov    %eax,%ebx
+  8012a5:	83 c4 10             	add    $0x10,%esp
+  8012a8:	85 c0                	test   %eax,%eax
+  8012aa:	78 7f                	js     80132b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	ff 75 0c             	push   0xc(%ebp)
+  8012b2:	e8 85 ff ff ff       	call   80123c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012b7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012ba:	c1 e6 0c             	shl    $0xc,%esi
+  8012bd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012c6:	89 3c 24             	mov    %edi,(%esp)
+  8012c9:	e8 ad fd ff ff       	call   80107b <fd2data>
+  8012ce:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012d0:	89 34 24             	mov    %esi,(%esp)
+  8012d3:	e8 a3 fd ff ff       	call   80107b <fd2data>
+  8012d8:	83 c4 10             	add    $0x10,%esp
+  8012db:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012de:	89 d8                	mov    %ebx,%eax
+  8012e0:	c1 e8 16             	shr    $0x16,%eax
+  8012e3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012ea:	a8 01                	test   $0x1,%al
+  8012ec:	74 11                	je     8012ff <dup+0x71>
+  8012ee:	89 d8                	mov    %ebx,%eax
+  8012f0:	c1 e8 0c             	shr    $0xc,%eax
+  8012f3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012fa:	f6 c2 01             	test   $0x1,%dl
+  8012fd:	75 36                	jne    801335 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012ff:	89 f8                	mov    %edi,%eax
+  801301:	c1 e8 0c             	shr    $0xc,%eax
+  801304:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801313:	50                   	push   %eax
+  801314:	56                   	push   %esi
+  801315:	6a 00                	push   $0x0
+  801317:	57                   	push   %edi
+  801318:	6a 00                	push   $0x0
+  80131a:	e8 f7 f8 ff ff       	call   800c16 <sys_page_map>
+  80131f:	89 c3                	mov    %eax,%ebx
+  801321:	83 c4 20             	add    $0x20,%esp
+  801324:	85 c0                	test   %eax,%eax
+  801326:	78 33                	js     80135b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801328:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80132b:	89 d8                	mov    %ebx,%eax
+  80132d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801330:	5b                   	pop    %ebx
+  801331:	5e                   	pop    %esi
+  801332:	5f                   	pop    %edi
+  801333:	5d                   	pop    %ebp
+  801334:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801335:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801344:	50                   	push   %eax
+  801345:	ff 75 d4             	push   -0x2c(%ebp)
+  801348:	6a 00                	push   $0x0
+  80134a:	53                   	push   %ebx
+  80134b:	6a 00                	push   $0x0
+  80134d:	e8 c4 f8 ff ff       	call   800c16 <sys_page_map>
+  801352:	89 c3                	mov    %eax,%ebx
+  801354:	83 c4 20             	add    $0x20,%esp
+  801357:	85 c0                	test   %eax,%eax
+  801359:	79 a4                	jns    8012ff <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	56                   	push   %esi
+  80135f:	6a 00                	push   $0x0
+  801361:	e8 fc f8 ff ff       	call   800c62 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801366:	83 c4 08             	add    $0x8,%esp
+  801369:	ff 75 d4             	push   -0x2c(%ebp)
+  80136c:	6a 00                	push   $0x0
+  80136e:	e8 ef f8 ff ff       	call   800c62 <sys_page_unmap>
+	return r;
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	eb b3                	jmp    80132b <dup+0x9d>
+
+00801378 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	56                   	push   %esi
+  80137c:	53                   	push   %ebx
+  80137d:	83 ec 18             	sub    $0x18,%esp
+  801380:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801383:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801386:	50                   	push   %eax
+  801387:	53                   	push   %ebx
+  801388:	e8 5b fd ff ff       	call   8010e8 <fd_lookup>
+  80138d:	83 c4 10             	add    $0x10,%esp
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 3c                	js     8013d0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801394:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801397:	83 ec 08             	sub    $0x8,%esp
+  80139a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139d:	50                   	push   %eax
+  80139e:	ff 36                	push   (%esi)
+  8013a0:	e8 93 fd ff ff       	call   801138 <dev_lookup>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	78 24                	js     8013d0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013ac:	8b 46 08             	mov    0x8(%esi),%eax
+  8013af:	83 e0 03             	and    $0x3,%eax
+  8013b2:	83 f8 01             	cmp    $0x1,%eax
+  8013b5:	74 20                	je     8013d7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ba:	8b 40 08             	mov    0x8(%eax),%eax
+  8013bd:	85 c0                	test   %eax,%eax
+  8013bf:	74 61                	je     801422 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013c1:	83 ec 04             	sub    $0x4,%esp
+  8013c4:	ff 75 10             	push   0x10(%ebp)
+  8013c7:	ff 75 0c             	push   0xc(%ebp)
+  8013ca:	56                   	push   %esi
+  8013cb:	ff d0                	call   *%eax
+  8013cd:	83 c4 10             	add    $0x10,%esp
+}
+  8013d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5e                   	pop    %esi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+  8013d7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013d9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8013df:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8013e4:	77 18                	ja     8013fe <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8013e6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8013eb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8013ed:	c1 e8 10             	shr    $0x10,%eax
+  8013f0:	74 0c                	je     8013fe <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8013f2:	c1 e0 10             	shl    $0x10,%eax
+  8013f5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8013fa:	29 c2                	sub    %eax,%edx
+  8013fc:	eb 06                	jmp    801404 <read+0x8c>
+		return pthread_main_tls;
+  8013fe:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801404:	8b 02                	mov    (%edx),%eax
+  801406:	8b 40 48             	mov    0x48(%eax),%eax
+  801409:	83 ec 04             	sub    $0x4,%esp
+  80140c:	53                   	push   %ebx
+  80140d:	50                   	push   %eax
+  80140e:	68 21 4b 80 00       	push   $0x804b21
+  801413:	e8 8f ed ff ff       	call   8001a7 <cprintf>
+		return -E_INVAL;
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801420:	eb ae                	jmp    8013d0 <read+0x58>
+		return -E_NOT_SUPP;
+  801422:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801427:	eb a7                	jmp    8013d0 <read+0x58>
+
+00801429 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	57                   	push   %edi
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+  801432:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801435:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801438:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143d:	eb 02                	jmp    801441 <readn+0x18>
+  80143f:	01 c3                	add    %eax,%ebx
+  801441:	39 f3                	cmp    %esi,%ebx
+  801443:	73 21                	jae    801466 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801445:	83 ec 04             	sub    $0x4,%esp
+  801448:	89 f0                	mov    %esi,%eax
+  80144a:	29 d8                	sub    %ebx,%eax
+  80144c:	50                   	push   %eax
+  80144d:	89 d8                	mov    %ebx,%eax
+  80144f:	03 45 0c             	add    0xc(%ebp),%eax
+  801452:	50                   	push   %eax
+  801453:	57                   	push   %edi
+  801454:	e8 1f ff ff ff       	call   801378 <read>
+		if (m < 0)
+  801459:	83 c4 10             	add    $0x10,%esp
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	78 04                	js     801464 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801460:	75 dd                	jne    80143f <readn+0x16>
+  801462:	eb 02                	jmp    801466 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801464:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801466:	89 d8                	mov    %ebx,%eax
+  801468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5f                   	pop    %edi
+  80146e:	5d                   	pop    %ebp
+  80146f:	c3                   	ret
+
+00801470 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801470:	55                   	push   %ebp
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	56                   	push   %esi
+  801474:	53                   	push   %ebx
+  801475:	83 ec 18             	sub    $0x18,%esp
+  801478:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80147b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80147e:	50                   	push   %eax
+  80147f:	53                   	push   %ebx
+  801480:	e8 63 fc ff ff       	call   8010e8 <fd_lookup>
+  801485:	83 c4 10             	add    $0x10,%esp
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	78 37                	js     8014c3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80148c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80148f:	83 ec 08             	sub    $0x8,%esp
+  801492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801495:	50                   	push   %eax
+  801496:	ff 36                	push   (%esi)
+  801498:	e8 9b fc ff ff       	call   801138 <dev_lookup>
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	78 1f                	js     8014c3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014a4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014a8:	74 20                	je     8014ca <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	74 61                	je     801515 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014b4:	83 ec 04             	sub    $0x4,%esp
+  8014b7:	ff 75 10             	push   0x10(%ebp)
+  8014ba:	ff 75 0c             	push   0xc(%ebp)
+  8014bd:	56                   	push   %esi
+  8014be:	ff d0                	call   *%eax
+  8014c0:	83 c4 10             	add    $0x10,%esp
+}
+  8014c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c6:	5b                   	pop    %ebx
+  8014c7:	5e                   	pop    %esi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+  8014ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014d7:	77 18                	ja     8014f1 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014e0:	c1 e8 10             	shr    $0x10,%eax
+  8014e3:	74 0c                	je     8014f1 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014e5:	c1 e0 10             	shl    $0x10,%eax
+  8014e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014ed:	29 c2                	sub    %eax,%edx
+  8014ef:	eb 06                	jmp    8014f7 <write+0x87>
+		return pthread_main_tls;
+  8014f1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014f7:	8b 02                	mov    (%edx),%eax
+  8014f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8014fc:	83 ec 04             	sub    $0x4,%esp
+  8014ff:	53                   	push   %ebx
+  801500:	50                   	push   %eax
+  801501:	68 3d 4b 80 00       	push   $0x804b3d
+  801506:	e8 9c ec ff ff       	call   8001a7 <cprintf>
+		return -E_INVAL;
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801513:	eb ae                	jmp    8014c3 <write+0x53>
+		return -E_NOT_SUPP;
+  801515:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80151a:	eb a7                	jmp    8014c3 <write+0x53>
+
+0080151c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801522:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801525:	50                   	push   %eax
+  801526:	ff 75 08             	push   0x8(%ebp)
+  801529:	e8 ba fb ff ff       	call   8010e8 <fd_lookup>
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	85 c0                	test   %eax,%eax
+  801533:	78 0e                	js     801543 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801535:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801538:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80153b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80153e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801543:	c9                   	leave
+  801544:	c3                   	ret
+
+00801545 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	56                   	push   %esi
+  801549:	53                   	push   %ebx
+  80154a:	83 ec 18             	sub    $0x18,%esp
+  80154d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801550:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801553:	50                   	push   %eax
+  801554:	53                   	push   %ebx
+  801555:	e8 8e fb ff ff       	call   8010e8 <fd_lookup>
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	78 34                	js     801595 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801561:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801564:	83 ec 08             	sub    $0x8,%esp
+  801567:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156a:	50                   	push   %eax
+  80156b:	ff 36                	push   (%esi)
+  80156d:	e8 c6 fb ff ff       	call   801138 <dev_lookup>
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 1c                	js     801595 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801579:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80157d:	74 1d                	je     80159c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80157f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801582:	8b 40 18             	mov    0x18(%eax),%eax
+  801585:	85 c0                	test   %eax,%eax
+  801587:	74 5e                	je     8015e7 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801589:	83 ec 08             	sub    $0x8,%esp
+  80158c:	ff 75 0c             	push   0xc(%ebp)
+  80158f:	56                   	push   %esi
+  801590:	ff d0                	call   *%eax
+  801592:	83 c4 10             	add    $0x10,%esp
+}
+  801595:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801598:	5b                   	pop    %ebx
+  801599:	5e                   	pop    %esi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+  80159c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80159e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015a4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015a9:	77 18                	ja     8015c3 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015ab:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015b0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015b2:	c1 e8 10             	shr    $0x10,%eax
+  8015b5:	74 0c                	je     8015c3 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015b7:	c1 e0 10             	shl    $0x10,%eax
+  8015ba:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015bf:	29 c2                	sub    %eax,%edx
+  8015c1:	eb 06                	jmp    8015c9 <ftruncate+0x84>
+		return pthread_main_tls;
+  8015c3:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8015c9:	8b 02                	mov    (%edx),%eax
+  8015cb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015ce:	83 ec 04             	sub    $0x4,%esp
+  8015d1:	53                   	push   %ebx
+  8015d2:	50                   	push   %eax
+  8015d3:	68 00 4b 80 00       	push   $0x804b00
+  8015d8:	e8 ca eb ff ff       	call   8001a7 <cprintf>
+		return -E_INVAL;
+  8015dd:	83 c4 10             	add    $0x10,%esp
+  8015e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e5:	eb ae                	jmp    801595 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ec:	eb a7                	jmp    801595 <ftruncate+0x50>
+
+008015ee <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 18             	sub    $0x18,%esp
+  8015f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015fc:	50                   	push   %eax
+  8015fd:	ff 75 08             	push   0x8(%ebp)
+  801600:	e8 e3 fa ff ff       	call   8010e8 <fd_lookup>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	78 49                	js     801655 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80160c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80160f:	83 ec 08             	sub    $0x8,%esp
+  801612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	ff 36                	push   (%esi)
+  801618:	e8 1b fb ff ff       	call   801138 <dev_lookup>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	85 c0                	test   %eax,%eax
+  801622:	78 31                	js     801655 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801624:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801627:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80162b:	74 2f                	je     80165c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80162d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801630:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801637:	00 00 00 
+	stat->st_isdir = 0;
+  80163a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801641:	00 00 00 
+	stat->st_dev = dev;
+  801644:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80164a:	83 ec 08             	sub    $0x8,%esp
+  80164d:	53                   	push   %ebx
+  80164e:	56                   	push   %esi
+  80164f:	ff 50 14             	call   *0x14(%eax)
+  801652:	83 c4 10             	add    $0x10,%esp
+}
+  801655:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801658:	5b                   	pop    %ebx
+  801659:	5e                   	pop    %esi
+  80165a:	5d                   	pop    %ebp
+  80165b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80165c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801661:	eb f2                	jmp    801655 <fstat+0x67>
+
+00801663 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801668:	83 ec 08             	sub    $0x8,%esp
+  80166b:	6a 00                	push   $0x0
+  80166d:	ff 75 08             	push   0x8(%ebp)
+  801670:	e8 4b 03 00 00       	call   8019c0 <open>
+  801675:	89 c3                	mov    %eax,%ebx
+  801677:	83 c4 10             	add    $0x10,%esp
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	78 1b                	js     801699 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80167e:	83 ec 08             	sub    $0x8,%esp
+  801681:	ff 75 0c             	push   0xc(%ebp)
+  801684:	50                   	push   %eax
+  801685:	e8 64 ff ff ff       	call   8015ee <fstat>
+  80168a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80168c:	89 1c 24             	mov    %ebx,(%esp)
+  80168f:	e8 a8 fb ff ff       	call   80123c <close>
+	return r;
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	89 f3                	mov    %esi,%ebx
+}
+  801699:	89 d8                	mov    %ebx,%eax
+  80169b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+
+008016a2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	56                   	push   %esi
+  8016a6:	53                   	push   %ebx
+  8016a7:	89 c6                	mov    %eax,%esi
+  8016a9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8016ab:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8016b2:	74 27                	je     8016db <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016b4:	6a 07                	push   $0x7
+  8016b6:	68 00 70 80 00       	push   $0x807000
+  8016bb:	56                   	push   %esi
+  8016bc:	ff 35 00 60 80 00    	push   0x806000
+  8016c2:	e8 94 2c 00 00       	call   80435b <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016c7:	83 c4 0c             	add    $0xc,%esp
+  8016ca:	6a 00                	push   $0x0
+  8016cc:	53                   	push   %ebx
+  8016cd:	6a 00                	push   $0x0
+  8016cf:	e8 91 2b 00 00       	call   804265 <ipc_recv>
+}
+  8016d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d7:	5b                   	pop    %ebx
+  8016d8:	5e                   	pop    %esi
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016db:	83 ec 0c             	sub    $0xc,%esp
+  8016de:	6a 01                	push   $0x1
+  8016e0:	e8 cc 2c 00 00       	call   8043b1 <ipc_find_env>
+  8016e5:	a3 00 60 80 00       	mov    %eax,0x806000
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	eb c5                	jmp    8016b4 <fsipc+0x12>
+
+008016ef <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	53                   	push   %ebx
+  8016f3:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8016f6:	68 04 60 80 00       	push   $0x806004
+  8016fb:	e8 29 1b 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801700:	8b 45 08             	mov    0x8(%ebp),%eax
+  801703:	8b 40 0c             	mov    0xc(%eax),%eax
+  801706:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80170b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80170e:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801713:	ba 00 00 00 00       	mov    $0x0,%edx
+  801718:	b8 02 00 00 00       	mov    $0x2,%eax
+  80171d:	e8 80 ff ff ff       	call   8016a2 <fsipc>
+  801722:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801724:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80172b:	e8 66 1b 00 00       	call   803296 <mutex_unlock>
+	return r;
+}
+  801730:	89 d8                	mov    %ebx,%eax
+  801732:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801735:	c9                   	leave
+  801736:	c3                   	ret
+
+00801737 <devfile_flush>:
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	53                   	push   %ebx
+  80173b:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80173e:	68 04 60 80 00       	push   $0x806004
+  801743:	e8 e1 1a 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80174e:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801753:	ba 00 00 00 00       	mov    $0x0,%edx
+  801758:	b8 06 00 00 00       	mov    $0x6,%eax
+  80175d:	e8 40 ff ff ff       	call   8016a2 <fsipc>
+  801762:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801764:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80176b:	e8 26 1b 00 00       	call   803296 <mutex_unlock>
+}
+  801770:	89 d8                	mov    %ebx,%eax
+  801772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+00801777 <devfile_stat>:
+{
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	56                   	push   %esi
+  80177b:	53                   	push   %ebx
+  80177c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80177f:	83 ec 0c             	sub    $0xc,%esp
+  801782:	68 04 60 80 00       	push   $0x806004
+  801787:	e8 9d 1a 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80178c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80178f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801792:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801797:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179c:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017a1:	e8 fc fe ff ff       	call   8016a2 <fsipc>
+  8017a6:	89 c3                	mov    %eax,%ebx
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	79 16                	jns    8017c5 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8017af:	83 ec 0c             	sub    $0xc,%esp
+  8017b2:	68 04 60 80 00       	push   $0x806004
+  8017b7:	e8 da 1a 00 00       	call   803296 <mutex_unlock>
+}
+  8017bc:	89 d8                	mov    %ebx,%eax
+  8017be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	68 00 70 80 00       	push   $0x807000
+  8017cd:	56                   	push   %esi
+  8017ce:	e8 b8 ef ff ff       	call   80078b <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8017d3:	a1 80 70 80 00       	mov    0x807080,%eax
+  8017d8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017de:	a1 84 70 80 00       	mov    0x807084,%eax
+  8017e3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8017e9:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8017ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f1:	eb bc                	jmp    8017af <devfile_stat+0x38>
+
+008017f3 <devfile_write>:
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 10             	sub    $0x10,%esp
+  8017fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8017fd:	68 04 60 80 00       	push   $0x806004
+  801802:	e8 22 1a 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80181b:	76 3d                	jbe    80185a <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80181d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801822:	39 c3                	cmp    %eax,%ebx
+  801824:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801827:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80182a:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  80182f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801835:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80183f:	e8 5e fe ff ff       	call   8016a2 <fsipc>
+  801844:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801846:	83 ec 0c             	sub    $0xc,%esp
+  801849:	68 04 60 80 00       	push   $0x806004
+  80184e:	e8 43 1a 00 00       	call   803296 <mutex_unlock>
+}
+  801853:	89 d8                	mov    %ebx,%eax
+  801855:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801858:	c9                   	leave
+  801859:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80185a:	83 ec 04             	sub    $0x4,%esp
+  80185d:	53                   	push   %ebx
+  80185e:	ff 75 0c             	push   0xc(%ebp)
+  801861:	68 0c 70 80 00       	push   $0x80700c
+  801866:	e8 a6 f0 ff ff       	call   800911 <memmove>
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801873:	eb b5                	jmp    80182a <devfile_write+0x37>
+
+00801875 <devfile_read>:
+{
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	57                   	push   %edi
+  801879:	56                   	push   %esi
+  80187a:	53                   	push   %ebx
+  80187b:	83 ec 0c             	sub    $0xc,%esp
+  80187e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801881:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801884:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801887:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80188d:	0f 86 8c 00 00 00    	jbe    80191f <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801893:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801898:	39 c3                	cmp    %eax,%ebx
+  80189a:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80189d:	89 f8                	mov    %edi,%eax
+  80189f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8018a2:	eb 0f                	jmp    8018b3 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8018a4:	0f b6 08             	movzbl (%eax),%ecx
+  8018a7:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8018a9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018ae:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8018b3:	39 d0                	cmp    %edx,%eax
+  8018b5:	72 ed                	jb     8018a4 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8018b7:	83 ec 0c             	sub    $0xc,%esp
+  8018ba:	68 04 60 80 00       	push   $0x806004
+  8018bf:	e8 65 19 00 00       	call   803229 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018c4:	8b 46 0c             	mov    0xc(%esi),%eax
+  8018c7:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8018cc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8018d2:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8018d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018dd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018e2:	e8 bb fd ff ff       	call   8016a2 <fsipc>
+  8018e7:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8018e9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8018f0:	e8 a1 19 00 00       	call   803296 <mutex_unlock>
+		assert(r <= (int) n);
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	39 f3                	cmp    %esi,%ebx
+  8018fa:	7c 0a                	jl     801906 <devfile_read+0x91>
+}
+  8018fc:	89 f0                	mov    %esi,%eax
+  8018fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801901:	5b                   	pop    %ebx
+  801902:	5e                   	pop    %esi
+  801903:	5f                   	pop    %edi
+  801904:	5d                   	pop    %ebp
+  801905:	c3                   	ret
+		assert(r <= (int) n);
+  801906:	68 70 4b 80 00       	push   $0x804b70
+  80190b:	68 7d 4b 80 00       	push   $0x804b7d
+  801910:	68 90 00 00 00       	push   $0x90
+  801915:	68 92 4b 80 00       	push   $0x804b92
+  80191a:	e8 8a 22 00 00       	call   803ba9 <_panic>
+	mutex_lock(&fsipc_mu);
+  80191f:	83 ec 0c             	sub    $0xc,%esp
+  801922:	68 04 60 80 00       	push   $0x806004
+  801927:	e8 fd 18 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80192c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80192f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801934:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  80193a:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801941:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801944:	ba 00 00 00 00       	mov    $0x0,%edx
+  801949:	b8 03 00 00 00       	mov    $0x3,%eax
+  80194e:	e8 4f fd ff ff       	call   8016a2 <fsipc>
+  801953:	89 c6                	mov    %eax,%esi
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 1d                	js     801979 <devfile_read+0x104>
+		assert(r <= n);
+  80195c:	39 c3                	cmp    %eax,%ebx
+  80195e:	72 2e                	jb     80198e <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801960:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801965:	7f 40                	jg     8019a7 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801967:	83 ec 04             	sub    $0x4,%esp
+  80196a:	50                   	push   %eax
+  80196b:	68 00 70 80 00       	push   $0x807000
+  801970:	57                   	push   %edi
+  801971:	e8 9b ef ff ff       	call   800911 <memmove>
+  801976:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801979:	83 ec 0c             	sub    $0xc,%esp
+  80197c:	68 04 60 80 00       	push   $0x806004
+  801981:	e8 10 19 00 00       	call   803296 <mutex_unlock>
+	return r;
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	e9 6e ff ff ff       	jmp    8018fc <devfile_read+0x87>
+		assert(r <= n);
+  80198e:	68 9d 4b 80 00       	push   $0x804b9d
+  801993:	68 7d 4b 80 00       	push   $0x804b7d
+  801998:	68 99 00 00 00       	push   $0x99
+  80199d:	68 92 4b 80 00       	push   $0x804b92
+  8019a2:	e8 02 22 00 00       	call   803ba9 <_panic>
+		assert(r <= PGSIZE);
+  8019a7:	68 a4 4b 80 00       	push   $0x804ba4
+  8019ac:	68 7d 4b 80 00       	push   $0x804b7d
+  8019b1:	68 9a 00 00 00       	push   $0x9a
+  8019b6:	68 92 4b 80 00       	push   $0x804b92
+  8019bb:	e8 e9 21 00 00       	call   803ba9 <_panic>
+
+008019c0 <open>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	56                   	push   %esi
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 1c             	sub    $0x1c,%esp
+  8019c8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019cb:	56                   	push   %esi
+  8019cc:	e8 7f ed ff ff       	call   800750 <strlen>
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019d9:	0f 8f 85 00 00 00    	jg     801a64 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019df:	83 ec 0c             	sub    $0xc,%esp
+  8019e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e5:	50                   	push   %eax
+  8019e6:	e8 a7 f6 ff ff       	call   801092 <fd_alloc>
+  8019eb:	89 c3                	mov    %eax,%ebx
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 55                	js     801a49 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8019f4:	83 ec 0c             	sub    $0xc,%esp
+  8019f7:	68 04 60 80 00       	push   $0x806004
+  8019fc:	e8 28 18 00 00       	call   803229 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a01:	83 c4 08             	add    $0x8,%esp
+  801a04:	56                   	push   %esi
+  801a05:	68 00 70 80 00       	push   $0x807000
+  801a0a:	e8 7c ed ff ff       	call   80078b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a12:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801a17:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a1f:	e8 7e fc ff ff       	call   8016a2 <fsipc>
+  801a24:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a26:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801a2d:	e8 64 18 00 00       	call   803296 <mutex_unlock>
+	if (r < 0) {
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	85 db                	test   %ebx,%ebx
+  801a37:	78 19                	js     801a52 <open+0x92>
+	return fd2num(fd);
+  801a39:	83 ec 0c             	sub    $0xc,%esp
+  801a3c:	ff 75 f4             	push   -0xc(%ebp)
+  801a3f:	e8 27 f6 ff ff       	call   80106b <fd2num>
+  801a44:	89 c3                	mov    %eax,%ebx
+  801a46:	83 c4 10             	add    $0x10,%esp
+}
+  801a49:	89 d8                	mov    %ebx,%eax
+  801a4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a4e:	5b                   	pop    %ebx
+  801a4f:	5e                   	pop    %esi
+  801a50:	5d                   	pop    %ebp
+  801a51:	c3                   	ret
+		fd_close(fd, 0);
+  801a52:	83 ec 08             	sub    $0x8,%esp
+  801a55:	6a 00                	push   $0x0
+  801a57:	ff 75 f4             	push   -0xc(%ebp)
+  801a5a:	e8 56 f7 ff ff       	call   8011b5 <fd_close>
+		return r;
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	eb e5                	jmp    801a49 <open+0x89>
+		return -E_BAD_PATH;
+  801a64:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a69:	eb de                	jmp    801a49 <open+0x89>
+
+00801a6b <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	53                   	push   %ebx
+  801a6f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a75:	50                   	push   %eax
+  801a76:	ff 75 08             	push   0x8(%ebp)
+  801a79:	e8 6a f6 ff ff       	call   8010e8 <fd_lookup>
+  801a7e:	89 c3                	mov    %eax,%ebx
+  801a80:	83 c4 10             	add    $0x10,%esp
+  801a83:	85 c0                	test   %eax,%eax
+  801a85:	78 5b                	js     801ae2 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801a90:	39 08                	cmp    %ecx,(%eax)
+  801a92:	75 55                	jne    801ae9 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801a94:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801a98:	74 56                	je     801af0 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801a9a:	83 ec 0c             	sub    $0xc,%esp
+  801a9d:	68 04 60 80 00       	push   $0x806004
+  801aa2:	e8 82 17 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801aa7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aaa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aad:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801ab2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab5:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801aba:	8b 45 10             	mov    0x10(%ebp),%eax
+  801abd:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801acc:	e8 d1 fb ff ff       	call   8016a2 <fsipc>
+  801ad1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ad3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ada:	e8 b7 17 00 00       	call   803296 <mutex_unlock>
+	return r;
+  801adf:	83 c4 10             	add    $0x10,%esp
+}
+  801ae2:	89 d8                	mov    %ebx,%eax
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ae9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801aee:	eb f2                	jmp    801ae2 <fallocate+0x77>
+		return -E_INVAL;
+  801af0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801af5:	eb eb                	jmp    801ae2 <fallocate+0x77>
+
+00801af7 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	56                   	push   %esi
+  801afb:	53                   	push   %ebx
+  801afc:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801aff:	89 f3                	mov    %esi,%ebx
+  801b01:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b07:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b0a:	eb 06                	jmp    801b12 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b0c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b12:	39 f3                	cmp    %esi,%ebx
+  801b14:	73 14                	jae    801b2a <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801b16:	83 ec 08             	sub    $0x8,%esp
+  801b19:	53                   	push   %ebx
+  801b1a:	6a 00                	push   $0x0
+  801b1c:	e8 41 f1 ff ff       	call   800c62 <sys_page_unmap>
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	79 e4                	jns    801b0c <munmap+0x15>
+  801b28:	eb 05                	jmp    801b2f <munmap+0x38>
+			return r;
+	return 0;
+  801b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b32:	5b                   	pop    %ebx
+  801b33:	5e                   	pop    %esi
+  801b34:	5d                   	pop    %ebp
+  801b35:	c3                   	ret
+
+00801b36 <mmap>:
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	57                   	push   %edi
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 24             	sub    $0x24,%esp
+  801b3f:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b42:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b45:	50                   	push   %eax
+  801b46:	ff 75 08             	push   0x8(%ebp)
+  801b49:	e8 9a f5 ff ff       	call   8010e8 <fd_lookup>
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	0f 88 37 01 00 00    	js     801c90 <mmap+0x15a>
+		return NULL;
+  801b59:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b5e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b61:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b67:	39 0a                	cmp    %ecx,(%edx)
+  801b69:	0f 85 05 01 00 00    	jne    801c74 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801b6f:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801b76:	0f 85 1b 01 00 00    	jne    801c97 <mmap+0x161>
+  801b7c:	89 f0                	mov    %esi,%eax
+  801b7e:	83 e8 01             	sub    $0x1,%eax
+  801b81:	0f 88 17 01 00 00    	js     801c9e <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801b87:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801b8b:	75 28                	jne    801bb5 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801b8d:	83 ec 0c             	sub    $0xc,%esp
+  801b90:	68 04 60 80 00       	push   $0x806004
+  801b95:	e8 8f 16 00 00       	call   803229 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801b9a:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801ba0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801bae:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801bb3:	eb 2b                	jmp    801be0 <mmap+0xaa>
+		cow_enable();
+  801bb5:	e8 3a 22 00 00       	call   803df4 <cow_enable>
+  801bba:	eb d1                	jmp    801b8d <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801bbc:	89 c2                	mov    %eax,%edx
+  801bbe:	c1 ea 0c             	shr    $0xc,%edx
+  801bc1:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801bc8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bce:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801bd4:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801bd7:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801bd9:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801bde:	77 25                	ja     801c05 <mmap+0xcf>
+  801be0:	89 c2                	mov    %eax,%edx
+  801be2:	29 da                	sub    %ebx,%edx
+  801be4:	39 ca                	cmp    %ecx,%edx
+  801be6:	73 3a                	jae    801c22 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801be8:	89 c2                	mov    %eax,%edx
+  801bea:	c1 ea 16             	shr    $0x16,%edx
+  801bed:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bf4:	f6 c2 01             	test   $0x1,%dl
+  801bf7:	75 c3                	jne    801bbc <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801bf9:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801bfe:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801c03:	eb d4                	jmp    801bd9 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801c05:	29 d8                	sub    %ebx,%eax
+  801c07:	39 c8                	cmp    %ecx,%eax
+  801c09:	73 17                	jae    801c22 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801c0b:	83 ec 0c             	sub    $0xc,%esp
+  801c0e:	68 04 60 80 00       	push   $0x806004
+  801c13:	e8 7e 16 00 00       	call   803296 <mutex_unlock>
+		return NULL;
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c20:	eb 52                	jmp    801c74 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c22:	85 db                	test   %ebx,%ebx
+  801c24:	74 e5                	je     801c0b <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801c31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c34:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801c39:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801c3f:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801c45:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c48:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c52:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c57:	e8 46 fa ff ff       	call   8016a2 <fsipc>
+  801c5c:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	68 04 60 80 00       	push   $0x806004
+  801c66:	e8 2b 16 00 00       	call   803296 <mutex_unlock>
+	if (r < 0) {
+  801c6b:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801c6e:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801c70:	85 ff                	test   %edi,%edi
+  801c72:	78 08                	js     801c7c <mmap+0x146>
+}
+  801c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c77:	5b                   	pop    %ebx
+  801c78:	5e                   	pop    %esi
+  801c79:	5f                   	pop    %edi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+		munmap((void*) va, len);
+  801c7c:	83 ec 08             	sub    $0x8,%esp
+  801c7f:	56                   	push   %esi
+  801c80:	53                   	push   %ebx
+  801c81:	e8 71 fe ff ff       	call   801af7 <munmap>
+		return NULL;
+  801c86:	83 c4 10             	add    $0x10,%esp
+  801c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8e:	eb e4                	jmp    801c74 <mmap+0x13e>
+		return NULL;
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c95:	eb dd                	jmp    801c74 <mmap+0x13e>
+		return NULL;
+  801c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9c:	eb d6                	jmp    801c74 <mmap+0x13e>
+  801c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca3:	eb cf                	jmp    801c74 <mmap+0x13e>
+
+00801ca5 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	53                   	push   %ebx
+  801ca9:	83 ec 10             	sub    $0x10,%esp
+  801cac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801caf:	53                   	push   %ebx
+  801cb0:	e8 9b ea ff ff       	call   800750 <strlen>
+  801cb5:	83 c4 10             	add    $0x10,%esp
+  801cb8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cbd:	7f 42                	jg     801d01 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801cbf:	83 ec 0c             	sub    $0xc,%esp
+  801cc2:	68 04 60 80 00       	push   $0x806004
+  801cc7:	e8 5d 15 00 00       	call   803229 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ccc:	83 c4 08             	add    $0x8,%esp
+  801ccf:	53                   	push   %ebx
+  801cd0:	68 00 70 80 00       	push   $0x807000
+  801cd5:	e8 b1 ea ff ff       	call   80078b <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ce4:	e8 b9 f9 ff ff       	call   8016a2 <fsipc>
+  801ce9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ceb:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801cf2:	e8 9f 15 00 00       	call   803296 <mutex_unlock>
+	return r;
+  801cf7:	83 c4 10             	add    $0x10,%esp
+}
+  801cfa:	89 d8                	mov    %ebx,%eax
+  801cfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cff:	c9                   	leave
+  801d00:	c3                   	ret
+		return -E_BAD_PATH;
+  801d01:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d06:	eb f2                	jmp    801cfa <remove+0x55>
+
+00801d08 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d08:	55                   	push   %ebp
+  801d09:	89 e5                	mov    %esp,%ebp
+  801d0b:	53                   	push   %ebx
+  801d0c:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d0f:	68 04 60 80 00       	push   $0x806004
+  801d14:	e8 10 15 00 00       	call   803229 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d23:	e8 7a f9 ff ff       	call   8016a2 <fsipc>
+  801d28:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d2a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d31:	e8 60 15 00 00       	call   803296 <mutex_unlock>
+	return r;
+}
+  801d36:	89 d8                	mov    %ebx,%eax
+  801d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d3b:	c9                   	leave
+  801d3c:	c3                   	ret
+
+00801d3d <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	56                   	push   %esi
+  801d41:	53                   	push   %ebx
+  801d42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d45:	83 ec 0c             	sub    $0xc,%esp
+  801d48:	68 04 60 80 00       	push   $0x806004
+  801d4d:	e8 d7 14 00 00       	call   803229 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d55:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d64:	e8 39 f9 ff ff       	call   8016a2 <fsipc>
+  801d69:	89 c6                	mov    %eax,%esi
+  801d6b:	83 c4 10             	add    $0x10,%esp
+  801d6e:	85 db                	test   %ebx,%ebx
+  801d70:	74 7b                	je     801ded <fs_bcstat+0xb0>
+  801d72:	85 c0                	test   %eax,%eax
+  801d74:	78 77                	js     801ded <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801d76:	a1 00 70 80 00       	mov    0x807000,%eax
+  801d7b:	89 03                	mov    %eax,(%ebx)
+  801d7d:	a1 04 70 80 00       	mov    0x807004,%eax
+  801d82:	89 43 04             	mov    %eax,0x4(%ebx)
+  801d85:	a1 08 70 80 00       	mov    0x807008,%eax
+  801d8a:	89 43 08             	mov    %eax,0x8(%ebx)
+  801d8d:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801d92:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801d95:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d9a:	89 43 10             	mov    %eax,0x10(%ebx)
+  801d9d:	a1 14 70 80 00       	mov    0x807014,%eax
+  801da2:	89 43 14             	mov    %eax,0x14(%ebx)
+  801da5:	a1 18 70 80 00       	mov    0x807018,%eax
+  801daa:	89 43 18             	mov    %eax,0x18(%ebx)
+  801dad:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801db2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801db5:	a1 20 70 80 00       	mov    0x807020,%eax
+  801dba:	89 43 20             	mov    %eax,0x20(%ebx)
+  801dbd:	a1 24 70 80 00       	mov    0x807024,%eax
+  801dc2:	89 43 24             	mov    %eax,0x24(%ebx)
+  801dc5:	a1 28 70 80 00       	mov    0x807028,%eax
+  801dca:	89 43 28             	mov    %eax,0x28(%ebx)
+  801dcd:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801dd2:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801dd5:	a1 30 70 80 00       	mov    0x807030,%eax
+  801dda:	89 43 30             	mov    %eax,0x30(%ebx)
+  801ddd:	a1 34 70 80 00       	mov    0x807034,%eax
+  801de2:	89 43 34             	mov    %eax,0x34(%ebx)
+  801de5:	a1 38 70 80 00       	mov    0x807038,%eax
+  801dea:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ded:	83 ec 0c             	sub    $0xc,%esp
+  801df0:	68 04 60 80 00       	push   $0x806004
+  801df5:	e8 9c 14 00 00       	call   803296 <mutex_unlock>
+	return r;
+}
+  801dfa:	89 f0                	mov    %esi,%eax
+  801dfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dff:	5b                   	pop    %ebx
+  801e00:	5e                   	pop    %esi
+  801e01:	5d                   	pop    %ebp
+  801e02:	c3                   	ret
+
+00801e03 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	56                   	push   %esi
+  801e07:	53                   	push   %ebx
+  801e08:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801e0a:	0f b6 10             	movzbl (%eax),%edx
+  801e0d:	80 fa 72             	cmp    $0x72,%dl
+  801e10:	74 44                	je     801e56 <parse_mode+0x53>
+  801e12:	80 fa 77             	cmp    $0x77,%dl
+  801e15:	74 4b                	je     801e62 <parse_mode+0x5f>
+  801e17:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e1c:	80 fa 61             	cmp    $0x61,%dl
+  801e1f:	74 09                	je     801e2a <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801e21:	89 d8                	mov    %ebx,%eax
+  801e23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e26:	5b                   	pop    %ebx
+  801e27:	5e                   	pop    %esi
+  801e28:	5d                   	pop    %ebp
+  801e29:	c3                   	ret
+	switch (mode[0]) {
+  801e2a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801e2f:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801e34:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801e36:	83 ec 08             	sub    $0x8,%esp
+  801e39:	6a 2b                	push   $0x2b
+  801e3b:	50                   	push   %eax
+  801e3c:	e8 5c ea ff ff       	call   80089d <strchr>
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	74 d9                	je     801e21 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801e48:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801e4b:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801e4e:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801e54:	eb cb                	jmp    801e21 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801e56:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e60:	eb d2                	jmp    801e34 <parse_mode+0x31>
+  801e62:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801e67:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801e6c:	eb c6                	jmp    801e34 <parse_mode+0x31>
+
+00801e6e <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801e6e:	55                   	push   %ebp
+  801e6f:	89 e5                	mov    %esp,%ebp
+  801e71:	57                   	push   %edi
+  801e72:	56                   	push   %esi
+  801e73:	53                   	push   %ebx
+  801e74:	83 ec 1c             	sub    $0x1c,%esp
+  801e77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e7a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e7d:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801e82:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801e87:	83 c0 24             	add    $0x24,%eax
+  801e8a:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801e8e:	74 17                	je     801ea7 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e90:	83 c3 01             	add    $0x1,%ebx
+  801e93:	83 fb 10             	cmp    $0x10,%ebx
+  801e96:	75 ef                	jne    801e87 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801e98:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801e9d:	89 f0                	mov    %esi,%eax
+  801e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea2:	5b                   	pop    %ebx
+  801ea3:	5e                   	pop    %esi
+  801ea4:	5f                   	pop    %edi
+  801ea5:	5d                   	pop    %ebp
+  801ea6:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801ea7:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801eae:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801eb1:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801eb4:	c1 e7 02             	shl    $0x2,%edi
+  801eb7:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801ebd:	83 ec 04             	sub    $0x4,%esp
+  801ec0:	6a 24                	push   $0x24
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	56                   	push   %esi
+  801ec5:	e8 12 ea ff ff       	call   8008dc <memset>
+			streams[i].f_fd = fd;
+  801eca:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ecd:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801ed3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801ed6:	01 d8                	add    %ebx,%eax
+  801ed8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801edb:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	eb b6                	jmp    801e9d <stream_alloc+0x2f>
+
+00801ee7 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	53                   	push   %ebx
+  801eeb:	83 ec 14             	sub    $0x14,%esp
+  801eee:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801ef0:	8b 40 18             	mov    0x18(%eax),%eax
+  801ef3:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801ef6:	74 4a                	je     801f42 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+  801efb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801efe:	50                   	push   %eax
+  801eff:	ff 33                	push   (%ebx)
+  801f01:	e8 e2 f1 ff ff       	call   8010e8 <fd_lookup>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f10:	85 d2                	test   %edx,%edx
+  801f12:	78 41                	js     801f55 <stream_unread+0x6e>
+  801f14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f17:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801f1d:	39 0a                	cmp    %ecx,(%edx)
+  801f1f:	75 34                	jne    801f55 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801f21:	8b 43 14             	mov    0x14(%ebx),%eax
+  801f24:	03 42 04             	add    0x4(%edx),%eax
+  801f27:	2b 43 18             	sub    0x18(%ebx),%eax
+  801f2a:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801f2d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f34:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f40:	eb 13                	jmp    801f55 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801f42:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f49:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801f50:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+
+00801f5a <stream_drain>:
+{
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	56                   	push   %esi
+  801f5e:	53                   	push   %ebx
+  801f5f:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f66:	eb 02                	jmp    801f6a <stream_drain+0x10>
+  801f68:	01 c3                	add    %eax,%ebx
+  801f6a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f6d:	39 c3                	cmp    %eax,%ebx
+  801f6f:	73 43                	jae    801fb4 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	29 d8                	sub    %ebx,%eax
+  801f76:	50                   	push   %eax
+  801f77:	89 d8                	mov    %ebx,%eax
+  801f79:	03 46 0c             	add    0xc(%esi),%eax
+  801f7c:	50                   	push   %eax
+  801f7d:	ff 36                	push   (%esi)
+  801f7f:	e8 ec f4 ff ff       	call   801470 <write>
+  801f84:	83 c4 10             	add    $0x10,%esp
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	7f dd                	jg     801f68 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801f8b:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801f8f:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f92:	83 ec 04             	sub    $0x4,%esp
+  801f95:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f98:	29 d8                	sub    %ebx,%eax
+  801f9a:	50                   	push   %eax
+  801f9b:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  801f9e:	50                   	push   %eax
+  801f9f:	52                   	push   %edx
+  801fa0:	e8 6c e9 ff ff       	call   800911 <memmove>
+			f->f_wend -= done;
+  801fa5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fa8:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801fb2:	eb 0a                	jmp    801fbe <stream_drain+0x64>
+  801fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  801fb9:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  801fbe:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  801fc1:	89 d0                	mov    %edx,%eax
+  801fc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc6:	5b                   	pop    %ebx
+  801fc7:	5e                   	pop    %esi
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+
+00801fca <stream_setup>:
+	if (f->f_buf)
+  801fca:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801fce:	74 01                	je     801fd1 <stream_setup+0x7>
+  801fd0:	c3                   	ret
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	53                   	push   %ebx
+  801fd5:	83 ec 04             	sub    $0x4,%esp
+  801fd8:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801fda:	8b 40 08             	mov    0x8(%eax),%eax
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	74 17                	je     801ff8 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801fe1:	83 f8 03             	cmp    $0x3,%eax
+  801fe4:	75 2d                	jne    802013 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801fe6:	8d 43 20             	lea    0x20(%ebx),%eax
+  801fe9:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801fec:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801ff3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff6:	c9                   	leave
+  801ff7:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801ff8:	83 ec 0c             	sub    $0xc,%esp
+  801ffb:	ff 33                	push   (%ebx)
+  801ffd:	e8 29 1b 00 00       	call   803b2b <iscons>
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	0f 9f c0             	setg   %al
+  80200a:	0f b6 c0             	movzbl %al,%eax
+  80200d:	83 c0 01             	add    $0x1,%eax
+  802010:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	68 00 10 00 00       	push   $0x1000
+  80201b:	e8 6e 0b 00 00       	call   802b8e <malloc>
+  802020:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	85 c0                	test   %eax,%eax
+  802028:	74 bc                	je     801fe6 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80202a:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802031:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802035:	eb bc                	jmp    801ff3 <stream_setup+0x29>
+
+00802037 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+  80203a:	53                   	push   %ebx
+  80203b:	83 ec 04             	sub    $0x4,%esp
+  80203e:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802040:	e8 85 ff ff ff       	call   801fca <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802045:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80204a:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80204e:	74 3d                	je     80208d <stream_fill+0x56>
+  802050:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802054:	74 10                	je     802066 <stream_fill+0x2f>
+  802056:	89 d8                	mov    %ebx,%eax
+  802058:	e8 fd fe ff ff       	call   801f5a <stream_drain>
+		return 0;
+  80205d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802062:	85 c0                	test   %eax,%eax
+  802064:	78 27                	js     80208d <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802066:	83 ec 04             	sub    $0x4,%esp
+  802069:	ff 73 10             	push   0x10(%ebx)
+  80206c:	ff 73 0c             	push   0xc(%ebx)
+  80206f:	ff 33                	push   (%ebx)
+  802071:	e8 02 f3 ff ff       	call   801378 <read>
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	7e 17                	jle    802094 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80207d:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802081:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802088:	89 c2                	mov    %eax,%edx
+  80208a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80208d:	89 d0                	mov    %edx,%eax
+  80208f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802092:	c9                   	leave
+  802093:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802094:	c1 f8 1f             	sar    $0x1f,%eax
+  802097:	83 e0 04             	and    $0x4,%eax
+  80209a:	83 c0 04             	add    $0x4,%eax
+  80209d:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8020a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a5:	eb e6                	jmp    80208d <stream_fill+0x56>
+
+008020a7 <fopen>:
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	57                   	push   %edi
+  8020ab:	56                   	push   %esi
+  8020ac:	53                   	push   %ebx
+  8020ad:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8020b3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020b6:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8020bc:	89 f0                	mov    %esi,%eax
+  8020be:	e8 40 fd ff ff       	call   801e03 <parse_mode>
+		return 0;
+  8020c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 2d                	js     8020f9 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8020cc:	83 ec 08             	sub    $0x8,%esp
+  8020cf:	50                   	push   %eax
+  8020d0:	ff 75 08             	push   0x8(%ebp)
+  8020d3:	e8 e8 f8 ff ff       	call   8019c0 <open>
+  8020d8:	89 c7                	mov    %eax,%edi
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 58                	js     802139 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020e1:	80 3e 61             	cmpb   $0x61,(%esi)
+  8020e4:	74 1d                	je     802103 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8020e6:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8020ec:	89 f8                	mov    %edi,%eax
+  8020ee:	e8 7b fd ff ff       	call   801e6e <stream_alloc>
+  8020f3:	89 c3                	mov    %eax,%ebx
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	74 32                	je     80212b <fopen+0x84>
+}
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fe:	5b                   	pop    %ebx
+  8020ff:	5e                   	pop    %esi
+  802100:	5f                   	pop    %edi
+  802101:	5d                   	pop    %ebp
+  802102:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802103:	83 ec 08             	sub    $0x8,%esp
+  802106:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80210c:	50                   	push   %eax
+  80210d:	57                   	push   %edi
+  80210e:	e8 db f4 ff ff       	call   8015ee <fstat>
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	85 c0                	test   %eax,%eax
+  802118:	78 cc                	js     8020e6 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80211a:	83 ec 08             	sub    $0x8,%esp
+  80211d:	ff 75 dc             	push   -0x24(%ebp)
+  802120:	57                   	push   %edi
+  802121:	e8 f6 f3 ff ff       	call   80151c <seek>
+  802126:	83 c4 10             	add    $0x10,%esp
+  802129:	eb bb                	jmp    8020e6 <fopen+0x3f>
+		close(fd);
+  80212b:	83 ec 0c             	sub    $0xc,%esp
+  80212e:	57                   	push   %edi
+  80212f:	e8 08 f1 ff ff       	call   80123c <close>
+  802134:	83 c4 10             	add    $0x10,%esp
+  802137:	eb c0                	jmp    8020f9 <fopen+0x52>
+		return 0;
+  802139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80213e:	eb b9                	jmp    8020f9 <fopen+0x52>
+
+00802140 <fdopen>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802146:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802149:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214c:	e8 b2 fc ff ff       	call   801e03 <parse_mode>
+  802151:	89 c2                	mov    %eax,%edx
+		return 0;
+  802153:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802158:	85 d2                	test   %edx,%edx
+  80215a:	78 0b                	js     802167 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80215c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80215f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802162:	e8 07 fd ff ff       	call   801e6e <stream_alloc>
+}
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+
+00802169 <setvbuf>:
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802172:	8b 55 10             	mov    0x10(%ebp),%edx
+  802175:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802178:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80217c:	75 3a                	jne    8021b8 <setvbuf+0x4f>
+  80217e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802181:	83 fe 02             	cmp    $0x2,%esi
+  802184:	77 39                	ja     8021bf <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802186:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802189:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80218d:	0f 95 c3             	setne  %bl
+  802190:	85 ff                	test   %edi,%edi
+  802192:	0f 95 c1             	setne  %cl
+  802195:	84 cb                	test   %cl,%bl
+  802197:	74 05                	je     80219e <setvbuf+0x35>
+  802199:	83 fa 03             	cmp    $0x3,%edx
+  80219c:	75 0a                	jne    8021a8 <setvbuf+0x3f>
+	return 0;
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a3:	5b                   	pop    %ebx
+  8021a4:	5e                   	pop    %esi
+  8021a5:	5f                   	pop    %edi
+  8021a6:	5d                   	pop    %ebp
+  8021a7:	c3                   	ret
+		f->f_buf = buf;
+  8021a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ab:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8021ae:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	eb eb                	jmp    8021a3 <setvbuf+0x3a>
+		return EOF;
+  8021b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021bd:	eb e4                	jmp    8021a3 <setvbuf+0x3a>
+  8021bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021c4:	eb dd                	jmp    8021a3 <setvbuf+0x3a>
+
+008021c6 <fflush>:
+{
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	57                   	push   %edi
+  8021ca:	56                   	push   %esi
+  8021cb:	53                   	push   %ebx
+  8021cc:	83 ec 0c             	sub    $0xc,%esp
+  8021cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8021d2:	85 db                	test   %ebx,%ebx
+  8021d4:	74 1a                	je     8021f0 <fflush+0x2a>
+	stream_unread(f);
+  8021d6:	89 d8                	mov    %ebx,%eax
+  8021d8:	e8 0a fd ff ff       	call   801ee7 <stream_unread>
+	return stream_drain(f);
+  8021dd:	89 d8                	mov    %ebx,%eax
+  8021df:	e8 76 fd ff ff       	call   801f5a <stream_drain>
+  8021e4:	89 c7                	mov    %eax,%edi
+}
+  8021e6:	89 f8                	mov    %edi,%eax
+  8021e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021eb:	5b                   	pop    %ebx
+  8021ec:	5e                   	pop    %esi
+  8021ed:	5f                   	pop    %edi
+  8021ee:	5d                   	pop    %ebp
+  8021ef:	c3                   	ret
+  8021f0:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8021f5:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8021fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ff:	eb 03                	jmp    802204 <fflush+0x3e>
+  802201:	83 c3 24             	add    $0x24,%ebx
+  802204:	39 f3                	cmp    %esi,%ebx
+  802206:	74 de                	je     8021e6 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802208:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80220c:	74 f3                	je     802201 <fflush+0x3b>
+  80220e:	83 ec 0c             	sub    $0xc,%esp
+  802211:	53                   	push   %ebx
+  802212:	e8 af ff ff ff       	call   8021c6 <fflush>
+  802217:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802221:	0f 48 f8             	cmovs  %eax,%edi
+  802224:	eb db                	jmp    802201 <fflush+0x3b>
+
+00802226 <fclose>:
+{
+  802226:	55                   	push   %ebp
+  802227:	89 e5                	mov    %esp,%ebp
+  802229:	56                   	push   %esi
+  80222a:	53                   	push   %ebx
+  80222b:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80222e:	83 ec 0c             	sub    $0xc,%esp
+  802231:	56                   	push   %esi
+  802232:	e8 8f ff ff ff       	call   8021c6 <fflush>
+  802237:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802239:	83 c4 04             	add    $0x4,%esp
+  80223c:	ff 36                	push   (%esi)
+  80223e:	e8 f9 ef ff ff       	call   80123c <close>
+  802243:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802246:	85 c0                	test   %eax,%eax
+  802248:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80224d:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802250:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802254:	75 10                	jne    802266 <fclose+0x40>
+	f->f_flags = 0;
+  802256:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80225d:	89 d8                	mov    %ebx,%eax
+  80225f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802262:	5b                   	pop    %ebx
+  802263:	5e                   	pop    %esi
+  802264:	5d                   	pop    %ebp
+  802265:	c3                   	ret
+		free(f->f_buf);
+  802266:	83 ec 0c             	sub    $0xc,%esp
+  802269:	ff 76 0c             	push   0xc(%esi)
+  80226c:	e8 54 08 00 00       	call   802ac5 <free>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	eb e0                	jmp    802256 <fclose+0x30>
+
+00802276 <fileno>:
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227c:	8b 00                	mov    (%eax),%eax
+}
+  80227e:	5d                   	pop    %ebp
+  80227f:	c3                   	ret
+
+00802280 <feof>:
+{
+  802280:	55                   	push   %ebp
+  802281:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802283:	8b 45 08             	mov    0x8(%ebp),%eax
+  802286:	8b 40 04             	mov    0x4(%eax),%eax
+  802289:	c1 e8 02             	shr    $0x2,%eax
+  80228c:	83 e0 01             	and    $0x1,%eax
+}
+  80228f:	5d                   	pop    %ebp
+  802290:	c3                   	ret
+
+00802291 <ferror>:
+{
+  802291:	55                   	push   %ebp
+  802292:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802294:	8b 45 08             	mov    0x8(%ebp),%eax
+  802297:	8b 40 04             	mov    0x4(%eax),%eax
+  80229a:	c1 e8 03             	shr    $0x3,%eax
+  80229d:	83 e0 01             	and    $0x1,%eax
+}
+  8022a0:	5d                   	pop    %ebp
+  8022a1:	c3                   	ret
+
+008022a2 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	53                   	push   %ebx
+  8022a6:	83 ec 04             	sub    $0x4,%esp
+  8022a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022ac:	8b 43 18             	mov    0x18(%ebx),%eax
+  8022af:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8022b2:	74 15                	je     8022c9 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8022b4:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8022b7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8022ba:	8d 48 01             	lea    0x1(%eax),%ecx
+  8022bd:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8022c0:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8022c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022c9:	89 d8                	mov    %ebx,%eax
+  8022cb:	e8 67 fd ff ff       	call   802037 <stream_fill>
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	75 e0                	jne    8022b4 <fgetc+0x12>
+		return EOF;
+  8022d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022d9:	eb e9                	jmp    8022c4 <fgetc+0x22>
+
+008022db <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8022db:	55                   	push   %ebp
+  8022dc:	89 e5                	mov    %esp,%ebp
+  8022de:	57                   	push   %edi
+  8022df:	56                   	push   %esi
+  8022e0:	53                   	push   %ebx
+  8022e1:	83 ec 1c             	sub    $0x1c,%esp
+  8022e4:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8022e7:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ef:	83 e8 01             	sub    $0x1,%eax
+  8022f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8022f5:	eb 66                	jmp    80235d <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022f7:	8b 46 14             	mov    0x14(%esi),%eax
+  8022fa:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8022fd:	29 c3                	sub    %eax,%ebx
+  8022ff:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802302:	29 fa                	sub    %edi,%edx
+  802304:	39 d3                	cmp    %edx,%ebx
+  802306:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802309:	83 ec 04             	sub    $0x4,%esp
+  80230c:	53                   	push   %ebx
+  80230d:	6a 0a                	push   $0xa
+  80230f:	03 46 0c             	add    0xc(%esi),%eax
+  802312:	50                   	push   %eax
+  802313:	e8 aa e6 ff ff       	call   8009c2 <memfind>
+  802318:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80231b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80231e:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802321:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802324:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802326:	83 c4 10             	add    $0x10,%esp
+  802329:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80232c:	74 0b                	je     802339 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80232e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802331:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802334:	29 d3                	sub    %edx,%ebx
+  802336:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802339:	83 ec 04             	sub    $0x4,%esp
+  80233c:	53                   	push   %ebx
+  80233d:	01 c8                	add    %ecx,%eax
+  80233f:	50                   	push   %eax
+  802340:	89 f8                	mov    %edi,%eax
+  802342:	03 45 08             	add    0x8(%ebp),%eax
+  802345:	50                   	push   %eax
+  802346:	e8 c6 e5 ff ff       	call   800911 <memmove>
+		f->f_rpos += m;
+  80234b:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80234e:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802350:	83 c4 10             	add    $0x10,%esp
+  802353:	8b 45 08             	mov    0x8(%ebp),%eax
+  802356:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80235b:	74 1f                	je     80237c <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80235d:	8d 47 01             	lea    0x1(%edi),%eax
+  802360:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802363:	73 17                	jae    80237c <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802365:	8b 46 18             	mov    0x18(%esi),%eax
+  802368:	39 46 14             	cmp    %eax,0x14(%esi)
+  80236b:	75 8a                	jne    8022f7 <fgets+0x1c>
+  80236d:	89 f0                	mov    %esi,%eax
+  80236f:	e8 c3 fc ff ff       	call   802037 <stream_fill>
+  802374:	85 c0                	test   %eax,%eax
+  802376:	0f 85 7b ff ff ff    	jne    8022f7 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80237c:	85 ff                	test   %edi,%edi
+  80237e:	74 0f                	je     80238f <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802380:	8b 45 08             	mov    0x8(%ebp),%eax
+  802383:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80238a:	5b                   	pop    %ebx
+  80238b:	5e                   	pop    %esi
+  80238c:	5f                   	pop    %edi
+  80238d:	5d                   	pop    %ebp
+  80238e:	c3                   	ret
+		return 0;
+  80238f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802394:	eb f1                	jmp    802387 <fgets+0xac>
+
+00802396 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+  802399:	57                   	push   %edi
+  80239a:	56                   	push   %esi
+  80239b:	53                   	push   %ebx
+  80239c:	83 ec 1c             	sub    $0x1c,%esp
+  80239f:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8023a2:	89 f0                	mov    %esi,%eax
+  8023a4:	e8 21 fc ff ff       	call   801fca <stream_setup>
+	want = size * n;
+  8023a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ac:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8023b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8023b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b8:	eb 43                	jmp    8023fd <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8023ba:	29 d3                	sub    %edx,%ebx
+  8023bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023bf:	29 f8                	sub    %edi,%eax
+  8023c1:	39 c3                	cmp    %eax,%ebx
+  8023c3:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8023c6:	83 ec 04             	sub    $0x4,%esp
+  8023c9:	53                   	push   %ebx
+  8023ca:	03 56 0c             	add    0xc(%esi),%edx
+  8023cd:	52                   	push   %edx
+  8023ce:	89 f8                	mov    %edi,%eax
+  8023d0:	03 45 08             	add    0x8(%ebp),%eax
+  8023d3:	50                   	push   %eax
+  8023d4:	e8 38 e5 ff ff       	call   800911 <memmove>
+			f->f_rpos += m;
+  8023d9:	01 5e 14             	add    %ebx,0x14(%esi)
+  8023dc:	83 c4 10             	add    $0x10,%esp
+  8023df:	eb 1a                	jmp    8023fb <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8023e1:	83 ec 04             	sub    $0x4,%esp
+  8023e4:	53                   	push   %ebx
+  8023e5:	89 f8                	mov    %edi,%eax
+  8023e7:	03 45 08             	add    0x8(%ebp),%eax
+  8023ea:	50                   	push   %eax
+  8023eb:	ff 36                	push   (%esi)
+  8023ed:	e8 86 ef ff ff       	call   801378 <read>
+  8023f2:	89 c3                	mov    %eax,%ebx
+  8023f4:	83 c4 10             	add    $0x10,%esp
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	7e 36                	jle    802431 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8023fb:	01 df                	add    %ebx,%edi
+  8023fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802400:	39 c7                	cmp    %eax,%edi
+  802402:	73 39                	jae    80243d <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802404:	8b 56 14             	mov    0x14(%esi),%edx
+  802407:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80240a:	39 da                	cmp    %ebx,%edx
+  80240c:	72 ac                	jb     8023ba <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80240e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802411:	29 fb                	sub    %edi,%ebx
+  802413:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802416:	72 3e                	jb     802456 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802418:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80241c:	74 1f                	je     80243d <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80241e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802422:	74 bd                	je     8023e1 <fread+0x4b>
+  802424:	89 f0                	mov    %esi,%eax
+  802426:	e8 2f fb ff ff       	call   801f5a <stream_drain>
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	79 b2                	jns    8023e1 <fread+0x4b>
+  80242f:	eb 0c                	jmp    80243d <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802431:	c1 fb 1f             	sar    $0x1f,%ebx
+  802434:	83 e3 04             	and    $0x4,%ebx
+  802437:	83 c3 04             	add    $0x4,%ebx
+  80243a:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80243d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802440:	85 c0                	test   %eax,%eax
+  802442:	74 0a                	je     80244e <fread+0xb8>
+  802444:	89 f8                	mov    %edi,%eax
+  802446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244b:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80244e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802451:	5b                   	pop    %ebx
+  802452:	5e                   	pop    %esi
+  802453:	5f                   	pop    %edi
+  802454:	5d                   	pop    %ebp
+  802455:	c3                   	ret
+		} else if (!stream_fill(f))
+  802456:	89 f0                	mov    %esi,%eax
+  802458:	e8 da fb ff ff       	call   802037 <stream_fill>
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	74 dc                	je     80243d <fread+0xa7>
+			m = 0;
+  802461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802466:	eb 93                	jmp    8023fb <fread+0x65>
+
+00802468 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802468:	55                   	push   %ebp
+  802469:	89 e5                	mov    %esp,%ebp
+  80246b:	57                   	push   %edi
+  80246c:	56                   	push   %esi
+  80246d:	53                   	push   %ebx
+  80246e:	83 ec 1c             	sub    $0x1c,%esp
+  802471:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802474:	8b 43 04             	mov    0x4(%ebx),%eax
+  802477:	a8 02                	test   $0x2,%al
+  802479:	75 13                	jne    80248e <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80247b:	83 c8 08             	or     $0x8,%eax
+  80247e:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802481:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802489:	5b                   	pop    %ebx
+  80248a:	5e                   	pop    %esi
+  80248b:	5f                   	pop    %edi
+  80248c:	5d                   	pop    %ebp
+  80248d:	c3                   	ret
+	stream_setup(f);
+  80248e:	89 d8                	mov    %ebx,%eax
+  802490:	e8 35 fb ff ff       	call   801fca <stream_setup>
+	want = size * n;
+  802495:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802498:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80249c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80249f:	89 d8                	mov    %ebx,%eax
+  8024a1:	e8 41 fa ff ff       	call   801ee7 <stream_unread>
+	for (done = 0; done < want; ) {
+  8024a6:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8024ab:	84 c0                	test   %al,%al
+  8024ad:	75 7b                	jne    80252a <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8024af:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8024b7:	39 fe                	cmp    %edi,%esi
+  8024b9:	73 24                	jae    8024df <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8024bb:	83 ec 04             	sub    $0x4,%esp
+  8024be:	89 f8                	mov    %edi,%eax
+  8024c0:	29 f0                	sub    %esi,%eax
+  8024c2:	50                   	push   %eax
+  8024c3:	89 f0                	mov    %esi,%eax
+  8024c5:	03 45 08             	add    0x8(%ebp),%eax
+  8024c8:	50                   	push   %eax
+  8024c9:	ff 33                	push   (%ebx)
+  8024cb:	e8 a0 ef ff ff       	call   801470 <write>
+  8024d0:	83 c4 10             	add    $0x10,%esp
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	7e 04                	jle    8024db <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8024d7:	01 c6                	add    %eax,%esi
+  8024d9:	eb dc                	jmp    8024b7 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8024db:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8024df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	74 a0                	je     802486 <fwrite+0x1e>
+  8024e6:	89 f0                	mov    %esi,%eax
+  8024e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ed:	f7 75 0c             	divl   0xc(%ebp)
+  8024f0:	eb 94                	jmp    802486 <fwrite+0x1e>
+			done += r;
+  8024f2:	01 c7                	add    %eax,%edi
+			continue;
+  8024f4:	eb 34                	jmp    80252a <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8024f6:	8b 73 10             	mov    0x10(%ebx),%esi
+  8024f9:	29 c6                	sub    %eax,%esi
+  8024fb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024fe:	29 fa                	sub    %edi,%edx
+  802500:	39 d6                	cmp    %edx,%esi
+  802502:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802505:	83 ec 04             	sub    $0x4,%esp
+  802508:	56                   	push   %esi
+  802509:	89 fa                	mov    %edi,%edx
+  80250b:	03 55 08             	add    0x8(%ebp),%edx
+  80250e:	52                   	push   %edx
+  80250f:	03 43 0c             	add    0xc(%ebx),%eax
+  802512:	50                   	push   %eax
+  802513:	e8 f9 e3 ff ff       	call   800911 <memmove>
+		f->f_wend += m;
+  802518:	89 f0                	mov    %esi,%eax
+  80251a:	03 43 1c             	add    0x1c(%ebx),%eax
+  80251d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802520:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802528:	74 5b                	je     802585 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80252a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80252d:	39 c7                	cmp    %eax,%edi
+  80252f:	73 2d                	jae    80255e <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802531:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802534:	85 c0                	test   %eax,%eax
+  802536:	75 be                	jne    8024f6 <fwrite+0x8e>
+  802538:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80253b:	29 fa                	sub    %edi,%edx
+  80253d:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802540:	72 b4                	jb     8024f6 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802542:	83 ec 04             	sub    $0x4,%esp
+  802545:	52                   	push   %edx
+  802546:	89 f8                	mov    %edi,%eax
+  802548:	03 45 08             	add    0x8(%ebp),%eax
+  80254b:	50                   	push   %eax
+  80254c:	ff 33                	push   (%ebx)
+  80254e:	e8 1d ef ff ff       	call   801470 <write>
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	85 c0                	test   %eax,%eax
+  802558:	7f 98                	jg     8024f2 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80255a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80255e:	8b 43 08             	mov    0x8(%ebx),%eax
+  802561:	83 f8 03             	cmp    $0x3,%eax
+  802564:	74 48                	je     8025ae <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802566:	83 f8 02             	cmp    $0x2,%eax
+  802569:	74 27                	je     802592 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80256b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	0f 84 10 ff ff ff    	je     802486 <fwrite+0x1e>
+  802576:	89 f8                	mov    %edi,%eax
+  802578:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257d:	f7 75 0c             	divl   0xc(%ebp)
+  802580:	e9 01 ff ff ff       	jmp    802486 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802585:	89 d8                	mov    %ebx,%eax
+  802587:	e8 ce f9 ff ff       	call   801f5a <stream_drain>
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	79 9a                	jns    80252a <fwrite+0xc2>
+  802590:	eb cc                	jmp    80255e <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802592:	83 ec 04             	sub    $0x4,%esp
+  802595:	57                   	push   %edi
+  802596:	6a 0a                	push   $0xa
+  802598:	ff 75 08             	push   0x8(%ebp)
+  80259b:	e8 22 e4 ff ff       	call   8009c2 <memfind>
+  8025a0:	89 c2                	mov    %eax,%edx
+  8025a2:	89 f8                	mov    %edi,%eax
+  8025a4:	03 45 08             	add    0x8(%ebp),%eax
+  8025a7:	83 c4 10             	add    $0x10,%esp
+  8025aa:	39 c2                	cmp    %eax,%edx
+  8025ac:	74 bd                	je     80256b <fwrite+0x103>
+		stream_drain(f);
+  8025ae:	89 d8                	mov    %ebx,%eax
+  8025b0:	e8 a5 f9 ff ff       	call   801f5a <stream_drain>
+  8025b5:	eb b4                	jmp    80256b <fwrite+0x103>
+
+008025b7 <fputc>:
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	53                   	push   %ebx
+  8025bb:	83 ec 14             	sub    $0x14,%esp
+  8025be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8025c1:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8025c4:	ff 75 0c             	push   0xc(%ebp)
+  8025c7:	6a 01                	push   $0x1
+  8025c9:	6a 01                	push   $0x1
+  8025cb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025ce:	50                   	push   %eax
+  8025cf:	e8 94 fe ff ff       	call   802468 <fwrite>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	0f b6 db             	movzbl %bl,%ebx
+  8025da:	83 f8 01             	cmp    $0x1,%eax
+  8025dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025e2:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8025e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e8:	c9                   	leave
+  8025e9:	c3                   	ret
+
+008025ea <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8025f0:	ff 75 0c             	push   0xc(%ebp)
+  8025f3:	ff 75 08             	push   0x8(%ebp)
+  8025f6:	e8 bc ff ff ff       	call   8025b7 <fputc>
+}
+  8025fb:	83 c4 10             	add    $0x10,%esp
+  8025fe:	c9                   	leave
+  8025ff:	c3                   	ret
+
+00802600 <fputs>:
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	56                   	push   %esi
+  802604:	53                   	push   %ebx
+  802605:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  80260b:	56                   	push   %esi
+  80260c:	e8 3f e1 ff ff       	call   800750 <strlen>
+  802611:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802613:	ff 75 0c             	push   0xc(%ebp)
+  802616:	50                   	push   %eax
+  802617:	6a 01                	push   $0x1
+  802619:	56                   	push   %esi
+  80261a:	e8 49 fe ff ff       	call   802468 <fwrite>
+  80261f:	83 c4 20             	add    $0x20,%esp
+  802622:	39 d8                	cmp    %ebx,%eax
+  802624:	0f 95 c0             	setne  %al
+  802627:	0f b6 c0             	movzbl %al,%eax
+  80262a:	f7 d8                	neg    %eax
+}
+  80262c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80262f:	5b                   	pop    %ebx
+  802630:	5e                   	pop    %esi
+  802631:	5d                   	pop    %ebp
+  802632:	c3                   	ret
+
+00802633 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	53                   	push   %ebx
+  802637:	83 ec 04             	sub    $0x4,%esp
+  80263a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80263d:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802640:	50                   	push   %eax
+  802641:	ff 75 0c             	push   0xc(%ebp)
+  802644:	53                   	push   %ebx
+  802645:	68 ea 25 80 00       	push   $0x8025ea
+  80264a:	e8 4f dc ff ff       	call   80029e <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80264f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802652:	c1 e0 1c             	shl    $0x1c,%eax
+  802655:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802658:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+
+0080265d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80265d:	55                   	push   %ebp
+  80265e:	89 e5                	mov    %esp,%ebp
+  802660:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802663:	68 b8 4b 80 00       	push   $0x804bb8
+  802668:	ff 75 0c             	push   0xc(%ebp)
+  80266b:	e8 1b e1 ff ff       	call   80078b <strcpy>
+	return 0;
+}
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+
+00802677 <devsock_close>:
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	53                   	push   %ebx
+  80267b:	83 ec 10             	sub    $0x10,%esp
+  80267e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802681:	53                   	push   %ebx
+  802682:	e8 69 1d 00 00       	call   8043f0 <pageref>
+  802687:	89 c2                	mov    %eax,%edx
+  802689:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802691:	83 fa 01             	cmp    $0x1,%edx
+  802694:	74 05                	je     80269b <devsock_close+0x24>
+}
+  802696:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802699:	c9                   	leave
+  80269a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+  80269e:	ff 73 0c             	push   0xc(%ebx)
+  8026a1:	e8 b7 02 00 00       	call   80295d <nsipc_close>
+  8026a6:	83 c4 10             	add    $0x10,%esp
+  8026a9:	eb eb                	jmp    802696 <devsock_close+0x1f>
+
+008026ab <devsock_write>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8026b1:	6a 00                	push   $0x0
+  8026b3:	ff 75 10             	push   0x10(%ebp)
+  8026b6:	ff 75 0c             	push   0xc(%ebp)
+  8026b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bc:	ff 70 0c             	push   0xc(%eax)
+  8026bf:	e8 79 03 00 00       	call   802a3d <nsipc_send>
+}
+  8026c4:	c9                   	leave
+  8026c5:	c3                   	ret
+
+008026c6 <devsock_read>:
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	ff 75 10             	push   0x10(%ebp)
+  8026d1:	ff 75 0c             	push   0xc(%ebp)
+  8026d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d7:	ff 70 0c             	push   0xc(%eax)
+  8026da:	e8 ef 02 00 00       	call   8029ce <nsipc_recv>
+}
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+
+008026e1 <fd2sockid>:
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026ea:	52                   	push   %edx
+  8026eb:	50                   	push   %eax
+  8026ec:	e8 f7 e9 ff ff       	call   8010e8 <fd_lookup>
+  8026f1:	83 c4 10             	add    $0x10,%esp
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	78 10                	js     802708 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026fb:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802701:	39 08                	cmp    %ecx,(%eax)
+  802703:	75 05                	jne    80270a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802705:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+		return -E_NOT_SUPP;
+  80270a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80270f:	eb f7                	jmp    802708 <fd2sockid+0x27>
+
+00802711 <alloc_sockfd>:
+{
+  802711:	55                   	push   %ebp
+  802712:	89 e5                	mov    %esp,%ebp
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	83 ec 1c             	sub    $0x1c,%esp
+  802719:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80271b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80271e:	50                   	push   %eax
+  80271f:	e8 6e e9 ff ff       	call   801092 <fd_alloc>
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	78 43                	js     802770 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80272d:	83 ec 04             	sub    $0x4,%esp
+  802730:	68 07 04 00 00       	push   $0x407
+  802735:	ff 75 f4             	push   -0xc(%ebp)
+  802738:	6a 00                	push   $0x0
+  80273a:	e8 8a e4 ff ff       	call   800bc9 <sys_page_alloc>
+  80273f:	89 c3                	mov    %eax,%ebx
+  802741:	83 c4 10             	add    $0x10,%esp
+  802744:	85 c0                	test   %eax,%eax
+  802746:	78 28                	js     802770 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80274b:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802751:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802756:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80275d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802760:	83 ec 0c             	sub    $0xc,%esp
+  802763:	50                   	push   %eax
+  802764:	e8 02 e9 ff ff       	call   80106b <fd2num>
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	eb 0c                	jmp    80277c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802770:	83 ec 0c             	sub    $0xc,%esp
+  802773:	56                   	push   %esi
+  802774:	e8 e4 01 00 00       	call   80295d <nsipc_close>
+		return r;
+  802779:	83 c4 10             	add    $0x10,%esp
+}
+  80277c:	89 d8                	mov    %ebx,%eax
+  80277e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802781:	5b                   	pop    %ebx
+  802782:	5e                   	pop    %esi
+  802783:	5d                   	pop    %ebp
+  802784:	c3                   	ret
+
+00802785 <accept>:
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80278b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278e:	e8 4e ff ff ff       	call   8026e1 <fd2sockid>
+  802793:	85 c0                	test   %eax,%eax
+  802795:	78 1b                	js     8027b2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802797:	83 ec 04             	sub    $0x4,%esp
+  80279a:	ff 75 10             	push   0x10(%ebp)
+  80279d:	ff 75 0c             	push   0xc(%ebp)
+  8027a0:	50                   	push   %eax
+  8027a1:	e8 0e 01 00 00       	call   8028b4 <nsipc_accept>
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	78 05                	js     8027b2 <accept+0x2d>
+	return alloc_sockfd(r);
+  8027ad:	e8 5f ff ff ff       	call   802711 <alloc_sockfd>
+}
+  8027b2:	c9                   	leave
+  8027b3:	c3                   	ret
+
+008027b4 <bind>:
+{
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027bd:	e8 1f ff ff ff       	call   8026e1 <fd2sockid>
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 12                	js     8027d8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027c6:	83 ec 04             	sub    $0x4,%esp
+  8027c9:	ff 75 10             	push   0x10(%ebp)
+  8027cc:	ff 75 0c             	push   0xc(%ebp)
+  8027cf:	50                   	push   %eax
+  8027d0:	e8 31 01 00 00       	call   802906 <nsipc_bind>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+}
+  8027d8:	c9                   	leave
+  8027d9:	c3                   	ret
+
+008027da <shutdown>:
+{
+  8027da:	55                   	push   %ebp
+  8027db:	89 e5                	mov    %esp,%ebp
+  8027dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e3:	e8 f9 fe ff ff       	call   8026e1 <fd2sockid>
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	78 0f                	js     8027fb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027ec:	83 ec 08             	sub    $0x8,%esp
+  8027ef:	ff 75 0c             	push   0xc(%ebp)
+  8027f2:	50                   	push   %eax
+  8027f3:	e8 43 01 00 00       	call   80293b <nsipc_shutdown>
+  8027f8:	83 c4 10             	add    $0x10,%esp
+}
+  8027fb:	c9                   	leave
+  8027fc:	c3                   	ret
+
+008027fd <connect>:
+{
+  8027fd:	55                   	push   %ebp
+  8027fe:	89 e5                	mov    %esp,%ebp
+  802800:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802803:	8b 45 08             	mov    0x8(%ebp),%eax
+  802806:	e8 d6 fe ff ff       	call   8026e1 <fd2sockid>
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 12                	js     802821 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80280f:	83 ec 04             	sub    $0x4,%esp
+  802812:	ff 75 10             	push   0x10(%ebp)
+  802815:	ff 75 0c             	push   0xc(%ebp)
+  802818:	50                   	push   %eax
+  802819:	e8 59 01 00 00       	call   802977 <nsipc_connect>
+  80281e:	83 c4 10             	add    $0x10,%esp
+}
+  802821:	c9                   	leave
+  802822:	c3                   	ret
+
+00802823 <listen>:
+{
+  802823:	55                   	push   %ebp
+  802824:	89 e5                	mov    %esp,%ebp
+  802826:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802829:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282c:	e8 b0 fe ff ff       	call   8026e1 <fd2sockid>
+  802831:	85 c0                	test   %eax,%eax
+  802833:	78 0f                	js     802844 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802835:	83 ec 08             	sub    $0x8,%esp
+  802838:	ff 75 0c             	push   0xc(%ebp)
+  80283b:	50                   	push   %eax
+  80283c:	e8 6b 01 00 00       	call   8029ac <nsipc_listen>
+  802841:	83 c4 10             	add    $0x10,%esp
+}
+  802844:	c9                   	leave
+  802845:	c3                   	ret
+
+00802846 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80284c:	ff 75 10             	push   0x10(%ebp)
+  80284f:	ff 75 0c             	push   0xc(%ebp)
+  802852:	ff 75 08             	push   0x8(%ebp)
+  802855:	e8 41 02 00 00       	call   802a9b <nsipc_socket>
+  80285a:	83 c4 10             	add    $0x10,%esp
+  80285d:	85 c0                	test   %eax,%eax
+  80285f:	78 05                	js     802866 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802861:	e8 ab fe ff ff       	call   802711 <alloc_sockfd>
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+00802868 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	53                   	push   %ebx
+  80286c:	83 ec 04             	sub    $0x4,%esp
+  80286f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802871:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802878:	74 26                	je     8028a0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80287a:	6a 07                	push   $0x7
+  80287c:	68 00 80 80 00       	push   $0x808000
+  802881:	53                   	push   %ebx
+  802882:	ff 35 08 60 80 00    	push   0x806008
+  802888:	e8 ce 1a 00 00       	call   80435b <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80288d:	83 c4 0c             	add    $0xc,%esp
+  802890:	6a 00                	push   $0x0
+  802892:	6a 00                	push   $0x0
+  802894:	6a 00                	push   $0x0
+  802896:	e8 ca 19 00 00       	call   804265 <ipc_recv>
+}
+  80289b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80289e:	c9                   	leave
+  80289f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028a0:	83 ec 0c             	sub    $0xc,%esp
+  8028a3:	6a 02                	push   $0x2
+  8028a5:	e8 07 1b 00 00       	call   8043b1 <ipc_find_env>
+  8028aa:	a3 08 60 80 00       	mov    %eax,0x806008
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	eb c6                	jmp    80287a <nsipc+0x12>
+
+008028b4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8028b4:	55                   	push   %ebp
+  8028b5:	89 e5                	mov    %esp,%ebp
+  8028b7:	56                   	push   %esi
+  8028b8:	53                   	push   %ebx
+  8028b9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8028bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8028c4:	8b 06                	mov    (%esi),%eax
+  8028c6:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8028cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d0:	e8 93 ff ff ff       	call   802868 <nsipc>
+  8028d5:	89 c3                	mov    %eax,%ebx
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	79 09                	jns    8028e4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028db:	89 d8                	mov    %ebx,%eax
+  8028dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028e0:	5b                   	pop    %ebx
+  8028e1:	5e                   	pop    %esi
+  8028e2:	5d                   	pop    %ebp
+  8028e3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028e4:	83 ec 04             	sub    $0x4,%esp
+  8028e7:	ff 35 10 80 80 00    	push   0x808010
+  8028ed:	68 00 80 80 00       	push   $0x808000
+  8028f2:	ff 75 0c             	push   0xc(%ebp)
+  8028f5:	e8 17 e0 ff ff       	call   800911 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028fa:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028ff:	89 06                	mov    %eax,(%esi)
+  802901:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802904:	eb d5                	jmp    8028db <nsipc_accept+0x27>
+
+00802906 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802906:	55                   	push   %ebp
+  802907:	89 e5                	mov    %esp,%ebp
+  802909:	53                   	push   %ebx
+  80290a:	83 ec 08             	sub    $0x8,%esp
+  80290d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802910:	8b 45 08             	mov    0x8(%ebp),%eax
+  802913:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802918:	53                   	push   %ebx
+  802919:	ff 75 0c             	push   0xc(%ebp)
+  80291c:	68 04 80 80 00       	push   $0x808004
+  802921:	e8 eb df ff ff       	call   800911 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802926:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80292c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802931:	e8 32 ff ff ff       	call   802868 <nsipc>
+}
+  802936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+
+0080293b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80293b:	55                   	push   %ebp
+  80293c:	89 e5                	mov    %esp,%ebp
+  80293e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802941:	8b 45 08             	mov    0x8(%ebp),%eax
+  802944:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802949:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80294c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802951:	b8 03 00 00 00       	mov    $0x3,%eax
+  802956:	e8 0d ff ff ff       	call   802868 <nsipc>
+}
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+0080295d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80295d:	55                   	push   %ebp
+  80295e:	89 e5                	mov    %esp,%ebp
+  802960:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802963:	8b 45 08             	mov    0x8(%ebp),%eax
+  802966:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80296b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802970:	e8 f3 fe ff ff       	call   802868 <nsipc>
+}
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	53                   	push   %ebx
+  80297b:	83 ec 08             	sub    $0x8,%esp
+  80297e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802981:	8b 45 08             	mov    0x8(%ebp),%eax
+  802984:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802989:	53                   	push   %ebx
+  80298a:	ff 75 0c             	push   0xc(%ebp)
+  80298d:	68 04 80 80 00       	push   $0x808004
+  802992:	e8 7a df ff ff       	call   800911 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802997:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80299d:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029a2:	e8 c1 fe ff ff       	call   802868 <nsipc>
+}
+  8029a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029aa:	c9                   	leave
+  8029ab:	c3                   	ret
+
+008029ac <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8029b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8029ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029bd:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8029c2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029c7:	e8 9c fe ff ff       	call   802868 <nsipc>
+}
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+
+008029ce <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	56                   	push   %esi
+  8029d2:	53                   	push   %ebx
+  8029d3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029de:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8029e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e7:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029ec:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029f1:	e8 72 fe ff ff       	call   802868 <nsipc>
+  8029f6:	89 c3                	mov    %eax,%ebx
+  8029f8:	85 c0                	test   %eax,%eax
+  8029fa:	78 22                	js     802a1e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029fc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a01:	39 c6                	cmp    %eax,%esi
+  802a03:	0f 4e c6             	cmovle %esi,%eax
+  802a06:	39 c3                	cmp    %eax,%ebx
+  802a08:	7f 1d                	jg     802a27 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a0a:	83 ec 04             	sub    $0x4,%esp
+  802a0d:	53                   	push   %ebx
+  802a0e:	68 00 80 80 00       	push   $0x808000
+  802a13:	ff 75 0c             	push   0xc(%ebp)
+  802a16:	e8 f6 de ff ff       	call   800911 <memmove>
+  802a1b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a1e:	89 d8                	mov    %ebx,%eax
+  802a20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a23:	5b                   	pop    %ebx
+  802a24:	5e                   	pop    %esi
+  802a25:	5d                   	pop    %ebp
+  802a26:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a27:	68 c4 4b 80 00       	push   $0x804bc4
+  802a2c:	68 7d 4b 80 00       	push   $0x804b7d
+  802a31:	6a 62                	push   $0x62
+  802a33:	68 d9 4b 80 00       	push   $0x804bd9
+  802a38:	e8 6c 11 00 00       	call   803ba9 <_panic>
+
+00802a3d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	53                   	push   %ebx
+  802a41:	83 ec 04             	sub    $0x4,%esp
+  802a44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4a:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a4f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a55:	7f 2e                	jg     802a85 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a57:	83 ec 04             	sub    $0x4,%esp
+  802a5a:	53                   	push   %ebx
+  802a5b:	ff 75 0c             	push   0xc(%ebp)
+  802a5e:	68 0c 80 80 00       	push   $0x80800c
+  802a63:	e8 a9 de ff ff       	call   800911 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a68:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a71:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a76:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a7b:	e8 e8 fd ff ff       	call   802868 <nsipc>
+}
+  802a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+	assert(size < 1600);
+  802a85:	68 e5 4b 80 00       	push   $0x804be5
+  802a8a:	68 7d 4b 80 00       	push   $0x804b7d
+  802a8f:	6a 6d                	push   $0x6d
+  802a91:	68 d9 4b 80 00       	push   $0x804bd9
+  802a96:	e8 0e 11 00 00       	call   803ba9 <_panic>
+
+00802a9b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802aa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aac:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ab1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ab4:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802ab9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802abe:	e8 a5 fd ff ff       	call   802868 <nsipc>
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	53                   	push   %ebx
+  802ac9:	83 ec 10             	sub    $0x10,%esp
+  802acc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802acf:	68 0c 60 80 00       	push   $0x80600c
+  802ad4:	e8 50 07 00 00       	call   803229 <mutex_lock>
+	if (v == 0)
+  802ad9:	83 c4 10             	add    $0x10,%esp
+  802adc:	85 db                	test   %ebx,%ebx
+  802ade:	0f 84 85 00 00 00    	je     802b69 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802ae4:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802aea:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802aef:	77 51                	ja     802b42 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802af1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802af7:	89 d8                	mov    %ebx,%eax
+  802af9:	c1 e8 0c             	shr    $0xc,%eax
+  802afc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b03:	f6 c4 02             	test   $0x2,%ah
+  802b06:	74 50                	je     802b58 <free+0x93>
+		sys_page_unmap(0, c);
+  802b08:	83 ec 08             	sub    $0x8,%esp
+  802b0b:	53                   	push   %ebx
+  802b0c:	6a 00                	push   $0x0
+  802b0e:	e8 4f e1 ff ff       	call   800c62 <sys_page_unmap>
+		c += PGSIZE;
+  802b13:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802b19:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b1f:	83 c4 10             	add    $0x10,%esp
+  802b22:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b27:	76 ce                	jbe    802af7 <free+0x32>
+  802b29:	68 2f 4c 80 00       	push   $0x804c2f
+  802b2e:	68 7d 4b 80 00       	push   $0x804b7d
+  802b33:	68 82 00 00 00       	push   $0x82
+  802b38:	68 22 4c 80 00       	push   $0x804c22
+  802b3d:	e8 67 10 00 00       	call   803ba9 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b42:	68 f4 4b 80 00       	push   $0x804bf4
+  802b47:	68 7d 4b 80 00       	push   $0x804b7d
+  802b4c:	6a 7b                	push   $0x7b
+  802b4e:	68 22 4c 80 00       	push   $0x804c22
+  802b53:	e8 51 10 00 00       	call   803ba9 <_panic>
+	if (--(*ref) == 0)
+  802b58:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802b5e:	83 e8 01             	sub    $0x1,%eax
+  802b61:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802b67:	74 15                	je     802b7e <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802b69:	83 ec 0c             	sub    $0xc,%esp
+  802b6c:	68 0c 60 80 00       	push   $0x80600c
+  802b71:	e8 20 07 00 00       	call   803296 <mutex_unlock>
+}
+  802b76:	83 c4 10             	add    $0x10,%esp
+  802b79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+		sys_page_unmap(0, c);
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	53                   	push   %ebx
+  802b82:	6a 00                	push   $0x0
+  802b84:	e8 d9 e0 ff ff       	call   800c62 <sys_page_unmap>
+  802b89:	83 c4 10             	add    $0x10,%esp
+  802b8c:	eb db                	jmp    802b69 <free+0xa4>
+
+00802b8e <malloc>:
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	57                   	push   %edi
+  802b92:	56                   	push   %esi
+  802b93:	53                   	push   %ebx
+  802b94:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802b97:	68 0c 60 80 00       	push   $0x80600c
+  802b9c:	e8 88 06 00 00       	call   803229 <mutex_lock>
+	if (mptr == 0)
+  802ba1:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802ba7:	83 c4 10             	add    $0x10,%esp
+  802baa:	85 ff                	test   %edi,%edi
+  802bac:	74 6c                	je     802c1a <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802bae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb1:	83 c0 03             	add    $0x3,%eax
+  802bb4:	83 e0 fc             	and    $0xfffffffc,%eax
+  802bb7:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802bb9:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802bbe:	0f 87 64 01 00 00    	ja     802d28 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802bc4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802bca:	74 30                	je     802bfc <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802bcc:	89 f9                	mov    %edi,%ecx
+  802bce:	c1 e9 0c             	shr    $0xc,%ecx
+  802bd1:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802bd5:	c1 e8 0c             	shr    $0xc,%eax
+  802bd8:	39 c1                	cmp    %eax,%ecx
+  802bda:	74 5f                	je     802c3b <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802bdc:	83 ec 0c             	sub    $0xc,%esp
+  802bdf:	57                   	push   %edi
+  802be0:	e8 e0 fe ff ff       	call   802ac5 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802be5:	a1 10 60 80 00       	mov    0x806010,%eax
+  802bea:	05 00 10 00 00       	add    $0x1000,%eax
+  802bef:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802bf4:	a3 10 60 80 00       	mov    %eax,0x806010
+  802bf9:	83 c4 10             	add    $0x10,%esp
+  802bfc:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802c02:	ba 02 00 00 00       	mov    $0x2,%edx
+  802c07:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802c0b:	8d 7e 04             	lea    0x4(%esi),%edi
+  802c0e:	89 cb                	mov    %ecx,%ebx
+  802c10:	01 f9                	add    %edi,%ecx
+  802c12:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802c15:	e9 8b 00 00 00       	jmp    802ca5 <malloc+0x117>
+		mptr = mbegin;
+  802c1a:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802c21:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c27:	83 c0 03             	add    $0x3,%eax
+  802c2a:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c2d:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c2f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c34:	76 c6                	jbe    802bfc <malloc+0x6e>
+  802c36:	e9 d6 00 00 00       	jmp    802d11 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802c3b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c41:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802c46:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802c4a:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802c4d:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802c52:	e9 ba 00 00 00       	jmp    802d11 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c57:	05 00 10 00 00       	add    $0x1000,%eax
+  802c5c:	39 c8                	cmp    %ecx,%eax
+  802c5e:	0f 83 cb 00 00 00    	jae    802d2f <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802c64:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802c69:	77 22                	ja     802c8d <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802c6b:	89 c2                	mov    %eax,%edx
+  802c6d:	c1 ea 16             	shr    $0x16,%edx
+  802c70:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802c77:	f6 c2 01             	test   $0x1,%dl
+  802c7a:	74 db                	je     802c57 <malloc+0xc9>
+  802c7c:	89 c2                	mov    %eax,%edx
+  802c7e:	c1 ea 0c             	shr    $0xc,%edx
+  802c81:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802c88:	f6 c2 01             	test   $0x1,%dl
+  802c8b:	74 ca                	je     802c57 <malloc+0xc9>
+		if (mptr == mend) {
+  802c8d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c93:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802c99:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802c9d:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802ca3:	74 04                	je     802ca9 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ca5:	89 d8                	mov    %ebx,%eax
+  802ca7:	eb b3                	jmp    802c5c <malloc+0xce>
+  802ca9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802cac:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802cb1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802cb5:	83 ea 01             	sub    $0x1,%edx
+  802cb8:	0f 85 50 ff ff ff    	jne    802c0e <malloc+0x80>
+  802cbe:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802cc5:	00 00 08 
+				return 0;	/* out of address space */
+  802cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccd:	eb 42                	jmp    802d11 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802ccf:	85 db                	test   %ebx,%ebx
+  802cd1:	78 1e                	js     802cf1 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802cd3:	83 ec 08             	sub    $0x8,%esp
+  802cd6:	89 d8                	mov    %ebx,%eax
+  802cd8:	03 05 10 60 80 00    	add    0x806010,%eax
+  802cde:	50                   	push   %eax
+  802cdf:	6a 00                	push   $0x0
+  802ce1:	e8 7c df ff ff       	call   800c62 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802ce6:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802cec:	83 c4 10             	add    $0x10,%esp
+  802cef:	eb de                	jmp    802ccf <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf6:	eb 19                	jmp    802d11 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802cf8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802cfb:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802d01:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802d08:	00 
+	mptr += n;
+  802d09:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d0c:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802d11:	83 ec 0c             	sub    $0xc,%esp
+  802d14:	68 0c 60 80 00       	push   $0x80600c
+  802d19:	e8 78 05 00 00       	call   803296 <mutex_unlock>
+}
+  802d1e:	89 f8                	mov    %edi,%eax
+  802d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d23:	5b                   	pop    %ebx
+  802d24:	5e                   	pop    %esi
+  802d25:	5f                   	pop    %edi
+  802d26:	5d                   	pop    %ebp
+  802d27:	c3                   	ret
+		return 0;
+  802d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2d:	eb e2                	jmp    802d11 <malloc+0x183>
+  802d2f:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802d33:	74 06                	je     802d3b <malloc+0x1ad>
+  802d35:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d40:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d43:	39 fb                	cmp    %edi,%ebx
+  802d45:	73 b1                	jae    802cf8 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d47:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d4d:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d50:	39 fe                	cmp    %edi,%esi
+  802d52:	0f 92 c0             	setb   %al
+  802d55:	0f b6 c0             	movzbl %al,%eax
+  802d58:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d5b:	83 c8 07             	or     $0x7,%eax
+  802d5e:	50                   	push   %eax
+  802d5f:	89 d8                	mov    %ebx,%eax
+  802d61:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d67:	50                   	push   %eax
+  802d68:	6a 00                	push   $0x0
+  802d6a:	e8 5a de ff ff       	call   800bc9 <sys_page_alloc>
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	85 c0                	test   %eax,%eax
+  802d74:	0f 88 55 ff ff ff    	js     802ccf <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d7a:	89 f3                	mov    %esi,%ebx
+  802d7c:	eb c5                	jmp    802d43 <malloc+0x1b5>
+
+00802d7e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	56                   	push   %esi
+  802d82:	53                   	push   %ebx
+  802d83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d86:	83 ec 0c             	sub    $0xc,%esp
+  802d89:	ff 75 08             	push   0x8(%ebp)
+  802d8c:	e8 ea e2 ff ff       	call   80107b <fd2data>
+  802d91:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d93:	83 c4 08             	add    $0x8,%esp
+  802d96:	68 47 4c 80 00       	push   $0x804c47
+  802d9b:	53                   	push   %ebx
+  802d9c:	e8 ea d9 ff ff       	call   80078b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802da1:	8b 46 04             	mov    0x4(%esi),%eax
+  802da4:	2b 06                	sub    (%esi),%eax
+  802da6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802dac:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802db3:	00 00 00 
+	stat->st_dev = &devpipe;
+  802db6:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802dbd:	52 80 00 
+	return 0;
+}
+  802dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc8:	5b                   	pop    %ebx
+  802dc9:	5e                   	pop    %esi
+  802dca:	5d                   	pop    %ebp
+  802dcb:	c3                   	ret
+
+00802dcc <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802dcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dd1:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802dd5:	85 c9                	test   %ecx,%ecx
+  802dd7:	75 01                	jne    802dda <pipewake+0xe>
+  802dd9:	c3                   	ret
+{
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802de0:	68 00 04 00 00       	push   $0x400
+  802de5:	52                   	push   %edx
+  802de6:	e8 22 e1 ff ff       	call   800f0d <sys_futex_wake>
+  802deb:	83 c4 10             	add    $0x10,%esp
+}
+  802dee:	c9                   	leave
+  802def:	c3                   	ret
+
+00802df0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802df0:	55                   	push   %ebp
+  802df1:	89 e5                	mov    %esp,%ebp
+  802df3:	56                   	push   %esi
+  802df4:	53                   	push   %ebx
+  802df5:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802df8:	83 ec 0c             	sub    $0xc,%esp
+  802dfb:	56                   	push   %esi
+  802dfc:	e8 7a e2 ff ff       	call   80107b <fd2data>
+  802e01:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802e03:	83 c4 08             	add    $0x8,%esp
+  802e06:	56                   	push   %esi
+  802e07:	6a 00                	push   $0x0
+  802e09:	e8 54 de ff ff       	call   800c62 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802e0e:	8d 53 04             	lea    0x4(%ebx),%edx
+  802e11:	8d 43 08             	lea    0x8(%ebx),%eax
+  802e14:	e8 b3 ff ff ff       	call   802dcc <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802e19:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802e1c:	89 da                	mov    %ebx,%edx
+  802e1e:	e8 a9 ff ff ff       	call   802dcc <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802e23:	89 34 24             	mov    %esi,(%esp)
+  802e26:	e8 50 e2 ff ff       	call   80107b <fd2data>
+  802e2b:	83 c4 08             	add    $0x8,%esp
+  802e2e:	50                   	push   %eax
+  802e2f:	6a 00                	push   $0x0
+  802e31:	e8 2c de ff ff       	call   800c62 <sys_page_unmap>
+}
+  802e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e39:	5b                   	pop    %ebx
+  802e3a:	5e                   	pop    %esi
+  802e3b:	5d                   	pop    %ebp
+  802e3c:	c3                   	ret
+
+00802e3d <_pipeisclosed>:
+{
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	57                   	push   %edi
+  802e41:	56                   	push   %esi
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 1c             	sub    $0x1c,%esp
+  802e46:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e49:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e4b:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802e50:	eb 5d                	jmp    802eaf <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802e52:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802e58:	8b 02                	mov    (%edx),%eax
+  802e5a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e5d:	83 ec 0c             	sub    $0xc,%esp
+  802e60:	ff 75 e0             	push   -0x20(%ebp)
+  802e63:	e8 88 15 00 00       	call   8043f0 <pageref>
+  802e68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e6b:	89 3c 24             	mov    %edi,(%esp)
+  802e6e:	e8 7d 15 00 00       	call   8043f0 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802e73:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e75:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802e7b:	83 c4 10             	add    $0x10,%esp
+  802e7e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802e84:	77 15                	ja     802e9b <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e86:	89 f2                	mov    %esi,%edx
+  802e88:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802e8a:	c1 ea 10             	shr    $0x10,%edx
+  802e8d:	74 0c                	je     802e9b <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e8f:	c1 e2 10             	shl    $0x10,%edx
+  802e92:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802e97:	29 d1                	sub    %edx,%ecx
+  802e99:	eb 06                	jmp    802ea1 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802e9b:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802ea1:	8b 11                	mov    (%ecx),%edx
+  802ea3:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802ea6:	39 d3                	cmp    %edx,%ebx
+  802ea8:	74 6e                	je     802f18 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802eaa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ead:	74 24                	je     802ed3 <_pipeisclosed+0x96>
+  802eaf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802eb1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802eb7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ebc:	77 94                	ja     802e52 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ebe:	89 f0                	mov    %esi,%eax
+  802ec0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ec2:	c1 e8 10             	shr    $0x10,%eax
+  802ec5:	74 8b                	je     802e52 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ec7:	c1 e0 10             	shl    $0x10,%eax
+  802eca:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ecf:	29 c2                	sub    %eax,%edx
+  802ed1:	eb 85                	jmp    802e58 <_pipeisclosed+0x1b>
+  802ed3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ed5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802edb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ee0:	77 18                	ja     802efa <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ee2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ee7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ee9:	c1 e8 10             	shr    $0x10,%eax
+  802eec:	74 0c                	je     802efa <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802eee:	c1 e0 10             	shl    $0x10,%eax
+  802ef1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ef6:	29 c2                	sub    %eax,%edx
+  802ef8:	eb 06                	jmp    802f00 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802efa:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f00:	8b 02                	mov    (%edx),%eax
+  802f02:	8b 40 58             	mov    0x58(%eax),%eax
+  802f05:	6a 01                	push   $0x1
+  802f07:	50                   	push   %eax
+  802f08:	53                   	push   %ebx
+  802f09:	68 4e 4c 80 00       	push   $0x804c4e
+  802f0e:	e8 94 d2 ff ff       	call   8001a7 <cprintf>
+  802f13:	83 c4 10             	add    $0x10,%esp
+  802f16:	eb 97                	jmp    802eaf <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802f18:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f1b:	0f 94 c0             	sete   %al
+  802f1e:	0f b6 c0             	movzbl %al,%eax
+}
+  802f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f24:	5b                   	pop    %ebx
+  802f25:	5e                   	pop    %esi
+  802f26:	5f                   	pop    %edi
+  802f27:	5d                   	pop    %ebp
+  802f28:	c3                   	ret
+
+00802f29 <devpipe_write>:
+{
+  802f29:	55                   	push   %ebp
+  802f2a:	89 e5                	mov    %esp,%ebp
+  802f2c:	57                   	push   %edi
+  802f2d:	56                   	push   %esi
+  802f2e:	53                   	push   %ebx
+  802f2f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f32:	ff 75 08             	push   0x8(%ebp)
+  802f35:	e8 41 e1 ff ff       	call   80107b <fd2data>
+  802f3a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f3c:	83 c4 10             	add    $0x10,%esp
+  802f3f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f46:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802f49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f4c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f4f:	0f 84 96 00 00 00    	je     802feb <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f55:	8d 73 08             	lea    0x8(%ebx),%esi
+  802f58:	eb 32                	jmp    802f8c <devpipe_write+0x63>
+  802f5a:	89 fa                	mov    %edi,%edx
+  802f5c:	89 f0                	mov    %esi,%eax
+  802f5e:	e8 69 fe ff ff       	call   802dcc <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802f63:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f66:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802f69:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f6e:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802f73:	83 ec 04             	sub    $0x4,%esp
+  802f76:	6a 0a                	push   $0xa
+  802f78:	50                   	push   %eax
+  802f79:	53                   	push   %ebx
+  802f7a:	e8 5f df ff ff       	call   800ede <sys_futex_wait>
+  802f7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f84:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802f89:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f8c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f8f:	8b 0b                	mov    (%ebx),%ecx
+  802f91:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f94:	39 d0                	cmp    %edx,%eax
+  802f96:	72 1b                	jb     802fb3 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  802f98:	89 da                	mov    %ebx,%edx
+  802f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9d:	e8 9b fe ff ff       	call   802e3d <_pipeisclosed>
+  802fa2:	85 c0                	test   %eax,%eax
+  802fa4:	74 b4                	je     802f5a <devpipe_write+0x31>
+				return 0;
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fae:	5b                   	pop    %ebx
+  802faf:	5e                   	pop    %esi
+  802fb0:	5f                   	pop    %edi
+  802fb1:	5d                   	pop    %ebp
+  802fb2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fb6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802fb9:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  802fbd:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  802fc0:	89 c2                	mov    %eax,%edx
+  802fc2:	c1 fa 1f             	sar    $0x1f,%edx
+  802fc5:	89 d1                	mov    %edx,%ecx
+  802fc7:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fca:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fcd:	83 e2 1f             	and    $0x1f,%edx
+  802fd0:	29 ca                	sub    %ecx,%edx
+  802fd2:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802fd6:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802fda:	83 c0 01             	add    $0x1,%eax
+  802fdd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802fe0:	83 c6 01             	add    $0x1,%esi
+  802fe3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802fe6:	e9 5e ff ff ff       	jmp    802f49 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802feb:	8d 53 04             	lea    0x4(%ebx),%edx
+  802fee:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ff1:	e8 d6 fd ff ff       	call   802dcc <pipewake>
+	return i;
+  802ff6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ff9:	eb b0                	jmp    802fab <devpipe_write+0x82>
+
+00802ffb <devpipe_read>:
+{
+  802ffb:	55                   	push   %ebp
+  802ffc:	89 e5                	mov    %esp,%ebp
+  802ffe:	57                   	push   %edi
+  802fff:	56                   	push   %esi
+  803000:	53                   	push   %ebx
+  803001:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803004:	ff 75 08             	push   0x8(%ebp)
+  803007:	e8 6f e0 ff ff       	call   80107b <fd2data>
+  80300c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80300e:	83 c4 10             	add    $0x10,%esp
+  803011:	be 00 00 00 00       	mov    $0x0,%esi
+  803016:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803019:	74 6c                	je     803087 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80301b:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80301e:	eb 25                	jmp    803045 <devpipe_read+0x4a>
+  803020:	8b 13                	mov    (%ebx),%edx
+  803022:	b8 01 00 00 00       	mov    $0x1,%eax
+  803027:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80302c:	83 ec 04             	sub    $0x4,%esp
+  80302f:	6a 0a                	push   $0xa
+  803031:	52                   	push   %edx
+  803032:	57                   	push   %edi
+  803033:	e8 a6 de ff ff       	call   800ede <sys_futex_wait>
+  803038:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80303d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803042:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803045:	8b 03                	mov    (%ebx),%eax
+  803047:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80304a:	75 19                	jne    803065 <devpipe_read+0x6a>
+			if (i > 0)
+  80304c:	85 f6                	test   %esi,%esi
+  80304e:	75 3a                	jne    80308a <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803050:	89 da                	mov    %ebx,%edx
+  803052:	8b 45 08             	mov    0x8(%ebp),%eax
+  803055:	e8 e3 fd ff ff       	call   802e3d <_pipeisclosed>
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	74 c2                	je     803020 <devpipe_read+0x25>
+				return 0;
+  80305e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803063:	eb 31                	jmp    803096 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803065:	89 c1                	mov    %eax,%ecx
+  803067:	c1 f9 1f             	sar    $0x1f,%ecx
+  80306a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80306d:	01 c8                	add    %ecx,%eax
+  80306f:	83 e0 1f             	and    $0x1f,%eax
+  803072:	29 c8                	sub    %ecx,%eax
+  803074:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803079:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80307c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80307f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803082:	83 c6 01             	add    $0x1,%esi
+  803085:	eb 8f                	jmp    803016 <devpipe_read+0x1b>
+out:
+  803087:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80308a:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80308d:	89 da                	mov    %ebx,%edx
+  80308f:	e8 38 fd ff ff       	call   802dcc <pipewake>
+	return i;
+  803094:	89 f0                	mov    %esi,%eax
+}
+  803096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803099:	5b                   	pop    %ebx
+  80309a:	5e                   	pop    %esi
+  80309b:	5f                   	pop    %edi
+  80309c:	5d                   	pop    %ebp
+  80309d:	c3                   	ret
+
+0080309e <pipe>:
+{
+  80309e:	55                   	push   %ebp
+  80309f:	89 e5                	mov    %esp,%ebp
+  8030a1:	56                   	push   %esi
+  8030a2:	53                   	push   %ebx
+  8030a3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030a9:	50                   	push   %eax
+  8030aa:	e8 e3 df ff ff       	call   801092 <fd_alloc>
+  8030af:	89 c3                	mov    %eax,%ebx
+  8030b1:	83 c4 10             	add    $0x10,%esp
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	0f 88 23 01 00 00    	js     8031df <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030bc:	83 ec 04             	sub    $0x4,%esp
+  8030bf:	68 07 04 00 00       	push   $0x407
+  8030c4:	ff 75 f4             	push   -0xc(%ebp)
+  8030c7:	6a 00                	push   $0x0
+  8030c9:	e8 fb da ff ff       	call   800bc9 <sys_page_alloc>
+  8030ce:	89 c3                	mov    %eax,%ebx
+  8030d0:	83 c4 10             	add    $0x10,%esp
+  8030d3:	85 c0                	test   %eax,%eax
+  8030d5:	0f 88 04 01 00 00    	js     8031df <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030db:	83 ec 0c             	sub    $0xc,%esp
+  8030de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030e1:	50                   	push   %eax
+  8030e2:	e8 ab df ff ff       	call   801092 <fd_alloc>
+  8030e7:	89 c3                	mov    %eax,%ebx
+  8030e9:	83 c4 10             	add    $0x10,%esp
+  8030ec:	85 c0                	test   %eax,%eax
+  8030ee:	0f 88 db 00 00 00    	js     8031cf <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030f4:	83 ec 04             	sub    $0x4,%esp
+  8030f7:	68 07 04 00 00       	push   $0x407
+  8030fc:	ff 75 f0             	push   -0x10(%ebp)
+  8030ff:	6a 00                	push   $0x0
+  803101:	e8 c3 da ff ff       	call   800bc9 <sys_page_alloc>
+  803106:	89 c3                	mov    %eax,%ebx
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	0f 88 bc 00 00 00    	js     8031cf <pipe+0x131>
+	va = fd2data(fd0);
+  803113:	83 ec 0c             	sub    $0xc,%esp
+  803116:	ff 75 f4             	push   -0xc(%ebp)
+  803119:	e8 5d df ff ff       	call   80107b <fd2data>
+  80311e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803120:	83 c4 0c             	add    $0xc,%esp
+  803123:	68 07 04 00 00       	push   $0x407
+  803128:	50                   	push   %eax
+  803129:	6a 00                	push   $0x0
+  80312b:	e8 99 da ff ff       	call   800bc9 <sys_page_alloc>
+  803130:	89 c3                	mov    %eax,%ebx
+  803132:	83 c4 10             	add    $0x10,%esp
+  803135:	85 c0                	test   %eax,%eax
+  803137:	0f 88 82 00 00 00    	js     8031bf <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313d:	83 ec 0c             	sub    $0xc,%esp
+  803140:	ff 75 f0             	push   -0x10(%ebp)
+  803143:	e8 33 df ff ff       	call   80107b <fd2data>
+  803148:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80314f:	50                   	push   %eax
+  803150:	6a 00                	push   $0x0
+  803152:	56                   	push   %esi
+  803153:	6a 00                	push   $0x0
+  803155:	e8 bc da ff ff       	call   800c16 <sys_page_map>
+  80315a:	89 c3                	mov    %eax,%ebx
+  80315c:	83 c4 20             	add    $0x20,%esp
+  80315f:	85 c0                	test   %eax,%eax
+  803161:	78 4e                	js     8031b1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803163:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803168:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80316b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80316d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803170:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803177:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80317a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80317c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80317f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803186:	83 ec 0c             	sub    $0xc,%esp
+  803189:	ff 75 f4             	push   -0xc(%ebp)
+  80318c:	e8 da de ff ff       	call   80106b <fd2num>
+  803191:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803194:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803196:	83 c4 04             	add    $0x4,%esp
+  803199:	ff 75 f0             	push   -0x10(%ebp)
+  80319c:	e8 ca de ff ff       	call   80106b <fd2num>
+  8031a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031a4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031af:	eb 2e                	jmp    8031df <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031b1:	83 ec 08             	sub    $0x8,%esp
+  8031b4:	56                   	push   %esi
+  8031b5:	6a 00                	push   $0x0
+  8031b7:	e8 a6 da ff ff       	call   800c62 <sys_page_unmap>
+  8031bc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031bf:	83 ec 08             	sub    $0x8,%esp
+  8031c2:	ff 75 f0             	push   -0x10(%ebp)
+  8031c5:	6a 00                	push   $0x0
+  8031c7:	e8 96 da ff ff       	call   800c62 <sys_page_unmap>
+  8031cc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031cf:	83 ec 08             	sub    $0x8,%esp
+  8031d2:	ff 75 f4             	push   -0xc(%ebp)
+  8031d5:	6a 00                	push   $0x0
+  8031d7:	e8 86 da ff ff       	call   800c62 <sys_page_unmap>
+  8031dc:	83 c4 10             	add    $0x10,%esp
+}
+  8031df:	89 d8                	mov    %ebx,%eax
+  8031e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e4:	5b                   	pop    %ebx
+  8031e5:	5e                   	pop    %esi
+  8031e6:	5d                   	pop    %ebp
+  8031e7:	c3                   	ret
+
+008031e8 <pipeisclosed>:
+{
+  8031e8:	55                   	push   %ebp
+  8031e9:	89 e5                	mov    %esp,%ebp
+  8031eb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031f1:	50                   	push   %eax
+  8031f2:	ff 75 08             	push   0x8(%ebp)
+  8031f5:	e8 ee de ff ff       	call   8010e8 <fd_lookup>
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	85 c0                	test   %eax,%eax
+  8031ff:	78 18                	js     803219 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803201:	83 ec 0c             	sub    $0xc,%esp
+  803204:	ff 75 f4             	push   -0xc(%ebp)
+  803207:	e8 6f de ff ff       	call   80107b <fd2data>
+  80320c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80320e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803211:	e8 27 fc ff ff       	call   802e3d <_pipeisclosed>
+  803216:	83 c4 10             	add    $0x10,%esp
+}
+  803219:	c9                   	leave
+  80321a:	c3                   	ret
+
+0080321b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80321b:	55                   	push   %ebp
+  80321c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80321e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803221:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803227:	5d                   	pop    %ebp
+  803228:	c3                   	ret
+
+00803229 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803229:	55                   	push   %ebp
+  80322a:	89 e5                	mov    %esp,%ebp
+  80322c:	56                   	push   %esi
+  80322d:	53                   	push   %ebx
+  80322e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803231:	ba 00 00 00 00       	mov    $0x0,%edx
+  803236:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80323b:	89 d0                	mov    %edx,%eax
+  80323d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803241:	85 c0                	test   %eax,%eax
+  803243:	74 2d                	je     803272 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803245:	83 f8 02             	cmp    $0x2,%eax
+  803248:	74 08                	je     803252 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80324a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80324f:	f0 87 03             	lock xchg %eax,(%ebx)
+  803252:	be 02 00 00 00       	mov    $0x2,%esi
+  803257:	eb 15                	jmp    80326e <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803259:	83 ec 04             	sub    $0x4,%esp
+  80325c:	6a 00                	push   $0x0
+  80325e:	6a 02                	push   $0x2
+  803260:	53                   	push   %ebx
+  803261:	e8 78 dc ff ff       	call   800ede <sys_futex_wait>
+  803266:	89 f0                	mov    %esi,%eax
+  803268:	f0 87 03             	lock xchg %eax,(%ebx)
+  80326b:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	75 e7                	jne    803259 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803272:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803275:	5b                   	pop    %ebx
+  803276:	5e                   	pop    %esi
+  803277:	5d                   	pop    %ebp
+  803278:	c3                   	ret
+
+00803279 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803279:	55                   	push   %ebp
+  80327a:	89 e5                	mov    %esp,%ebp
+  80327c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80327f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803284:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803289:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80328d:	f7 d8                	neg    %eax
+  80328f:	19 c0                	sbb    %eax,%eax
+  803291:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803294:	5d                   	pop    %ebp
+  803295:	c3                   	ret
+
+00803296 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80329f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a4:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8032a7:	83 f8 02             	cmp    $0x2,%eax
+  8032aa:	74 02                	je     8032ae <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8032ac:	c9                   	leave
+  8032ad:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8032ae:	83 ec 08             	sub    $0x8,%esp
+  8032b1:	6a 01                	push   $0x1
+  8032b3:	52                   	push   %edx
+  8032b4:	e8 54 dc ff ff       	call   800f0d <sys_futex_wake>
+  8032b9:	83 c4 10             	add    $0x10,%esp
+}
+  8032bc:	eb ee                	jmp    8032ac <mutex_unlock+0x16>
+
+008032be <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8032be:	55                   	push   %ebp
+  8032bf:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8032c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032ca:	5d                   	pop    %ebp
+  8032cb:	c3                   	ret
+
+008032cc <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8032cc:	55                   	push   %ebp
+  8032cd:	89 e5                	mov    %esp,%ebp
+  8032cf:	57                   	push   %edi
+  8032d0:	56                   	push   %esi
+  8032d1:	53                   	push   %ebx
+  8032d2:	83 ec 18             	sub    $0x18,%esp
+  8032d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8032db:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8032dd:	53                   	push   %ebx
+  8032de:	e8 b3 ff ff ff       	call   803296 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8032e3:	83 c4 0c             	add    $0xc,%esp
+  8032e6:	ff 75 10             	push   0x10(%ebp)
+  8032e9:	57                   	push   %edi
+  8032ea:	56                   	push   %esi
+  8032eb:	e8 ee db ff ff       	call   800ede <sys_futex_wait>
+  8032f0:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	be 02 00 00 00       	mov    $0x2,%esi
+  8032fa:	eb 10                	jmp    80330c <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8032fc:	83 ec 04             	sub    $0x4,%esp
+  8032ff:	6a 00                	push   $0x0
+  803301:	6a 02                	push   $0x2
+  803303:	53                   	push   %ebx
+  803304:	e8 d5 db ff ff       	call   800ede <sys_futex_wait>
+  803309:	83 c4 10             	add    $0x10,%esp
+  80330c:	89 f0                	mov    %esi,%eax
+  80330e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803311:	85 c0                	test   %eax,%eax
+  803313:	75 e7                	jne    8032fc <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803315:	83 ff ec             	cmp    $0xffffffec,%edi
+  803318:	74 05                	je     80331f <cond_timedwait+0x53>
+  80331a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80331f:	89 f8                	mov    %edi,%eax
+  803321:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803324:	5b                   	pop    %ebx
+  803325:	5e                   	pop    %esi
+  803326:	5f                   	pop    %edi
+  803327:	5d                   	pop    %ebp
+  803328:	c3                   	ret
+
+00803329 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803329:	55                   	push   %ebp
+  80332a:	89 e5                	mov    %esp,%ebp
+  80332c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80332f:	6a 00                	push   $0x0
+  803331:	ff 75 0c             	push   0xc(%ebp)
+  803334:	ff 75 08             	push   0x8(%ebp)
+  803337:	e8 90 ff ff ff       	call   8032cc <cond_timedwait>
+}
+  80333c:	83 c4 10             	add    $0x10,%esp
+  80333f:	c9                   	leave
+  803340:	c3                   	ret
+
+00803341 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803341:	55                   	push   %ebp
+  803342:	89 e5                	mov    %esp,%ebp
+  803344:	83 ec 10             	sub    $0x10,%esp
+  803347:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80334a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80334f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803353:	6a 01                	push   $0x1
+  803355:	50                   	push   %eax
+  803356:	e8 b2 db ff ff       	call   800f0d <sys_futex_wake>
+}
+  80335b:	83 c4 10             	add    $0x10,%esp
+  80335e:	c9                   	leave
+  80335f:	c3                   	ret
+
+00803360 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803360:	55                   	push   %ebp
+  803361:	89 e5                	mov    %esp,%ebp
+  803363:	83 ec 10             	sub    $0x10,%esp
+  803366:	8b 45 08             	mov    0x8(%ebp),%eax
+  803369:	ba 01 00 00 00       	mov    $0x1,%edx
+  80336e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803372:	68 00 04 00 00       	push   $0x400
+  803377:	50                   	push   %eax
+  803378:	e8 90 db ff ff       	call   800f0d <sys_futex_wake>
+}
+  80337d:	83 c4 10             	add    $0x10,%esp
+  803380:	c9                   	leave
+  803381:	c3                   	ret
+
+00803382 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803382:	55                   	push   %ebp
+  803383:	89 e5                	mov    %esp,%ebp
+  803385:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803388:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80338b:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80338d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803394:	5d                   	pop    %ebp
+  803395:	c3                   	ret
+
+00803396 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803396:	55                   	push   %ebp
+  803397:	89 e5                	mov    %esp,%ebp
+  803399:	53                   	push   %ebx
+  80339a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80339d:	8b 11                	mov    (%ecx),%edx
+  80339f:	85 d2                	test   %edx,%edx
+  8033a1:	74 14                	je     8033b7 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8033a3:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8033a6:	89 d0                	mov    %edx,%eax
+  8033a8:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8033ac:	39 c2                	cmp    %eax,%edx
+  8033ae:	75 ed                	jne    80339d <sem_trywait+0x7>
+			return 0;
+  8033b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b5:	eb 05                	jmp    8033bc <sem_trywait+0x26>
+	return -E_AGAIN;
+  8033b7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8033bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033bf:	c9                   	leave
+  8033c0:	c3                   	ret
+
+008033c1 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8033c1:	55                   	push   %ebp
+  8033c2:	89 e5                	mov    %esp,%ebp
+  8033c4:	57                   	push   %edi
+  8033c5:	56                   	push   %esi
+  8033c6:	53                   	push   %ebx
+  8033c7:	83 ec 1c             	sub    $0x1c,%esp
+  8033ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8033d0:	e8 81 da ff ff       	call   800e56 <sys_time_msec>
+  8033d5:	01 f8                	add    %edi,%eax
+  8033d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8033da:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8033df:	eb 28                	jmp    803409 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8033e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033e6:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8033eb:	83 ec 04             	sub    $0x4,%esp
+  8033ee:	56                   	push   %esi
+  8033ef:	6a 00                	push   $0x0
+  8033f1:	53                   	push   %ebx
+  8033f2:	e8 e7 da ff ff       	call   800ede <sys_futex_wait>
+  8033f7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8033fc:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803401:	83 c4 10             	add    $0x10,%esp
+  803404:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803407:	74 2e                	je     803437 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803409:	83 ec 0c             	sub    $0xc,%esp
+  80340c:	53                   	push   %ebx
+  80340d:	e8 84 ff ff ff       	call   803396 <sem_trywait>
+  803412:	83 c4 10             	add    $0x10,%esp
+  803415:	85 c0                	test   %eax,%eax
+  803417:	79 19                	jns    803432 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803419:	85 ff                	test   %edi,%edi
+  80341b:	74 c4                	je     8033e1 <sem_timedwait+0x20>
+  80341d:	e8 34 da ff ff       	call   800e56 <sys_time_msec>
+  803422:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803425:	29 c6                	sub    %eax,%esi
+  803427:	85 f6                	test   %esi,%esi
+  803429:	7f b6                	jg     8033e1 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80342b:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803430:	eb 05                	jmp    803437 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80343a:	5b                   	pop    %ebx
+  80343b:	5e                   	pop    %esi
+  80343c:	5f                   	pop    %edi
+  80343d:	5d                   	pop    %ebp
+  80343e:	c3                   	ret
+
+0080343f <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80343f:	55                   	push   %ebp
+  803440:	89 e5                	mov    %esp,%ebp
+  803442:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803445:	6a 00                	push   $0x0
+  803447:	ff 75 08             	push   0x8(%ebp)
+  80344a:	e8 72 ff ff ff       	call   8033c1 <sem_timedwait>
+}
+  80344f:	83 c4 10             	add    $0x10,%esp
+  803452:	c9                   	leave
+  803453:	c3                   	ret
+
+00803454 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803454:	55                   	push   %ebp
+  803455:	89 e5                	mov    %esp,%ebp
+  803457:	83 ec 08             	sub    $0x8,%esp
+  80345a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803462:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803466:	8b 50 04             	mov    0x4(%eax),%edx
+  803469:	85 d2                	test   %edx,%edx
+  80346b:	75 02                	jne    80346f <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80346d:	c9                   	leave
+  80346e:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80346f:	83 ec 08             	sub    $0x8,%esp
+  803472:	6a 01                	push   $0x1
+  803474:	50                   	push   %eax
+  803475:	e8 93 da ff ff       	call   800f0d <sys_futex_wake>
+  80347a:	83 c4 10             	add    $0x10,%esp
+}
+  80347d:	eb ee                	jmp    80346d <sem_post+0x19>
+
+0080347f <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80347f:	55                   	push   %ebp
+  803480:	89 e5                	mov    %esp,%ebp
+  803482:	57                   	push   %edi
+  803483:	56                   	push   %esi
+  803484:	53                   	push   %ebx
+  803485:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803488:	68 20 60 80 00       	push   $0x806020
+  80348d:	e8 97 fd ff ff       	call   803229 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803492:	a1 44 60 80 00       	mov    0x806044,%eax
+  803497:	83 c4 10             	add    $0x10,%esp
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	75 19                	jne    8034b7 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80349e:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8034a3:	8b 00                	mov    (%eax),%eax
+  8034a5:	8b 40 48             	mov    0x48(%eax),%eax
+  8034a8:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  8034ad:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  8034b4:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034b7:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8034bc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8034bf:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8034c6:	8b 40 04             	mov    0x4(%eax),%eax
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	0f 84 e4 00 00 00    	je     8035b5 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034d1:	83 c3 01             	add    $0x1,%ebx
+  8034d4:	83 fb 20             	cmp    $0x20,%ebx
+  8034d7:	75 e3                	jne    8034bc <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8034d9:	83 ec 0c             	sub    $0xc,%esp
+  8034dc:	68 20 60 80 00       	push   $0x806020
+  8034e1:	e8 b0 fd ff ff       	call   803296 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8034e6:	83 c4 10             	add    $0x10,%esp
+  8034e9:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8034ee:	e9 b8 00 00 00       	jmp    8035ab <pthread_create+0x12c>
+  8034f3:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8034f6:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8034f9:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8034fb:	39 f3                	cmp    %esi,%ebx
+  8034fd:	73 16                	jae    803515 <pthread_create+0x96>
+		va -= PGSIZE;
+  8034ff:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803505:	83 ec 08             	sub    $0x8,%esp
+  803508:	56                   	push   %esi
+  803509:	6a 00                	push   $0x0
+  80350b:	e8 52 d7 ff ff       	call   800c62 <sys_page_unmap>
+  803510:	83 c4 10             	add    $0x10,%esp
+  803513:	eb e6                	jmp    8034fb <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803515:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803518:	83 ec 08             	sub    $0x8,%esp
+  80351b:	ff 75 e4             	push   -0x1c(%ebp)
+  80351e:	6a 00                	push   $0x0
+  803520:	e8 3d d7 ff ff       	call   800c62 <sys_page_unmap>
+	return r;
+  803525:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803528:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80352b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803532:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803539:	eb 70                	jmp    8035ab <pthread_create+0x12c>
+	th->th_fn = fn;
+  80353b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80353e:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803545:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803548:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80354b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80354e:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803551:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803558:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80355d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803560:	29 c8                	sub    %ecx,%eax
+  803562:	85 db                	test   %ebx,%ebx
+  803564:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  80356b:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80356e:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803575:	83 ec 04             	sub    $0x4,%esp
+  803578:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80357d:	29 ca                	sub    %ecx,%edx
+  80357f:	52                   	push   %edx
+	*--esp = 0;
+  803580:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803583:	50                   	push   %eax
+  803584:	68 dc 37 80 00       	push   $0x8037dc
+  803589:	e8 24 da ff ff       	call   800fb2 <sys_thread_create>
+  80358e:	89 c7                	mov    %eax,%edi
+  803590:	83 c4 10             	add    $0x10,%esp
+  803593:	85 c0                	test   %eax,%eax
+  803595:	78 91                	js     803528 <pthread_create+0xa9>
+	th->th_env = id;
+  803597:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80359a:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  8035a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a4:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8035a6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8035ab:	89 f8                	mov    %edi,%eax
+  8035ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b0:	5b                   	pop    %ebx
+  8035b1:	5e                   	pop    %esi
+  8035b2:	5f                   	pop    %edi
+  8035b3:	5d                   	pop    %ebp
+  8035b4:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8035b5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035b8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035bf:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8035c6:	83 ec 0c             	sub    $0xc,%esp
+  8035c9:	68 20 60 80 00       	push   $0x806020
+  8035ce:	e8 c3 fc ff ff       	call   803296 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8035d3:	89 d9                	mov    %ebx,%ecx
+  8035d5:	c1 e1 10             	shl    $0x10,%ecx
+  8035d8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8035db:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8035e0:	29 c8                	sub    %ecx,%eax
+  8035e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8035e5:	c1 e8 16             	shr    $0x16,%eax
+  8035e8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035ef:	83 c4 10             	add    $0x10,%esp
+  8035f2:	a8 01                	test   $0x1,%al
+  8035f4:	74 15                	je     80360b <pthread_create+0x18c>
+  8035f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035f9:	c1 e8 0c             	shr    $0xc,%eax
+  8035fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803603:	a8 01                	test   $0x1,%al
+  803605:	0f 85 30 ff ff ff    	jne    80353b <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80360b:	83 ec 04             	sub    $0x4,%esp
+  80360e:	6a 07                	push   $0x7
+  803610:	ff 75 e4             	push   -0x1c(%ebp)
+  803613:	6a 00                	push   $0x0
+  803615:	e8 af d5 ff ff       	call   800bc9 <sys_page_alloc>
+  80361a:	89 c7                	mov    %eax,%edi
+  80361c:	83 c4 10             	add    $0x10,%esp
+  80361f:	85 c0                	test   %eax,%eax
+  803621:	0f 88 01 ff ff ff    	js     803528 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803627:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80362c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80362f:	29 d0                	sub    %edx,%eax
+  803631:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803634:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803636:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80363b:	29 d0                	sub    %edx,%eax
+  80363d:	89 c7                	mov    %eax,%edi
+  80363f:	39 fe                	cmp    %edi,%esi
+  803641:	0f 83 f4 fe ff ff    	jae    80353b <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803647:	83 ec 04             	sub    $0x4,%esp
+  80364a:	6a 07                	push   $0x7
+  80364c:	56                   	push   %esi
+  80364d:	6a 00                	push   $0x0
+  80364f:	e8 75 d5 ff ff       	call   800bc9 <sys_page_alloc>
+  803654:	83 c4 10             	add    $0x10,%esp
+  803657:	85 c0                	test   %eax,%eax
+  803659:	0f 88 94 fe ff ff    	js     8034f3 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80365f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803665:	eb d8                	jmp    80363f <pthread_create+0x1c0>
+
+00803667 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803667:	55                   	push   %ebp
+  803668:	89 e5                	mov    %esp,%ebp
+  80366a:	57                   	push   %edi
+  80366b:	56                   	push   %esi
+  80366c:	53                   	push   %ebx
+  80366d:	83 ec 0c             	sub    $0xc,%esp
+  803670:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803673:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803676:	83 f8 1e             	cmp    $0x1e,%eax
+  803679:	0f 87 c7 00 00 00    	ja     803746 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80367f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803681:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803687:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80368c:	77 12                	ja     8036a0 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80368e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803693:	29 d0                	sub    %edx,%eax
+  803695:	c1 e8 10             	shr    $0x10,%eax
+  803698:	39 c3                	cmp    %eax,%ebx
+  80369a:	0f 84 ad 00 00 00    	je     80374d <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8036a0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036a3:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036aa:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8036b1:	eb 10                	jmp    8036c3 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8036b3:	83 ec 04             	sub    $0x4,%esp
+  8036b6:	6a 00                	push   $0x0
+  8036b8:	6a 01                	push   $0x1
+  8036ba:	57                   	push   %edi
+  8036bb:	e8 1e d8 ff ff       	call   800ede <sys_futex_wait>
+  8036c0:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036c3:	8b 46 04             	mov    0x4(%esi),%eax
+  8036c6:	83 f8 01             	cmp    $0x1,%eax
+  8036c9:	74 e8                	je     8036b3 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8036cb:	83 f8 02             	cmp    $0x2,%eax
+  8036ce:	0f 85 80 00 00 00    	jne    803754 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036d4:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8036d7:	c1 e6 02             	shl    $0x2,%esi
+  8036da:	eb 05                	jmp    8036e1 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8036dc:	e8 bc d4 ff ff       	call   800b9d <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036e1:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8036e7:	89 ca                	mov    %ecx,%edx
+  8036e9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8036ef:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036f2:	c1 e0 04             	shl    $0x4,%eax
+  8036f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036fa:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8036fd:	39 c1                	cmp    %eax,%ecx
+  8036ff:	75 12                	jne    803713 <pthread_join+0xac>
+  803701:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803704:	c1 e0 04             	shl    $0x4,%eax
+  803707:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80370c:	8b 40 54             	mov    0x54(%eax),%eax
+  80370f:	85 c0                	test   %eax,%eax
+  803711:	75 c9                	jne    8036dc <pthread_join+0x75>
+	if (ret_store)
+  803713:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803717:	74 0f                	je     803728 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803719:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80371c:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803723:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803726:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803728:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80372b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803732:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803741:	5b                   	pop    %ebx
+  803742:	5e                   	pop    %esi
+  803743:	5f                   	pop    %edi
+  803744:	5d                   	pop    %ebp
+  803745:	c3                   	ret
+		return -E_INVAL;
+  803746:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80374b:	eb f1                	jmp    80373e <pthread_join+0xd7>
+  80374d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803752:	eb ea                	jmp    80373e <pthread_join+0xd7>
+		return -E_INVAL;
+  803754:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803759:	eb e3                	jmp    80373e <pthread_join+0xd7>
+
+0080375b <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80375b:	55                   	push   %ebp
+  80375c:	89 e5                	mov    %esp,%ebp
+  80375e:	53                   	push   %ebx
+  80375f:	83 ec 04             	sub    $0x4,%esp
+  803762:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803764:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80376a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80376f:	77 0c                	ja     80377d <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803771:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803776:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803778:	c1 e8 10             	shr    $0x10,%eax
+  80377b:	75 0a                	jne    803787 <pthread_exit+0x2c>
+		exit();
+  80377d:	e8 68 c9 ff ff       	call   8000ea <exit>
+  803782:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803787:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80378e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803791:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803798:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80379b:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80379e:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8037a5:	83 ec 08             	sub    $0x8,%esp
+  8037a8:	6a 20                	push   $0x20
+  8037aa:	01 c2                	add    %eax,%edx
+  8037ac:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8037b3:	50                   	push   %eax
+  8037b4:	e8 54 d7 ff ff       	call   800f0d <sys_futex_wake>
+	sys_env_destroy(0);
+  8037b9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8037c0:	e8 61 d3 ff ff       	call   800b26 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8037c5:	83 c4 0c             	add    $0xc,%esp
+  8037c8:	68 66 4c 80 00       	push   $0x804c66
+  8037cd:	68 a5 00 00 00       	push   $0xa5
+  8037d2:	68 80 4c 80 00       	push   $0x804c80
+  8037d7:	e8 cd 03 00 00       	call   803ba9 <_panic>
+
+008037dc <pthread_start>:
+{
+  8037dc:	55                   	push   %ebp
+  8037dd:	89 e5                	mov    %esp,%ebp
+  8037df:	53                   	push   %ebx
+  8037e0:	83 ec 04             	sub    $0x4,%esp
+  8037e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8037e6:	e8 86 d3 ff ff       	call   800b71 <sys_getenvid>
+  8037eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8037f0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8037f6:	85 db                	test   %ebx,%ebx
+  8037f8:	74 0c                	je     803806 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037fa:	89 d9                	mov    %ebx,%ecx
+  8037fc:	c1 e1 10             	shl    $0x10,%ecx
+  8037ff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803804:	29 ca                	sub    %ecx,%edx
+  803806:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803809:	c1 e0 04             	shl    $0x4,%eax
+  80380c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803811:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803813:	83 ec 0c             	sub    $0xc,%esp
+  803816:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80381d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803820:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803827:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  80382e:	89 04 24             	mov    %eax,(%esp)
+  803831:	e8 25 ff ff ff       	call   80375b <pthread_exit>
+
+00803836 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803836:	55                   	push   %ebp
+  803837:	89 e5                	mov    %esp,%ebp
+  803839:	57                   	push   %edi
+  80383a:	56                   	push   %esi
+  80383b:	53                   	push   %ebx
+  80383c:	83 ec 1c             	sub    $0x1c,%esp
+  80383f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803841:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803847:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80384e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803853:	77 0d                	ja     803862 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803855:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80385a:	29 d0                	sub    %edx,%eax
+  80385c:	c1 e8 10             	shr    $0x10,%eax
+  80385f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803862:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803867:	eb 2f                	jmp    803898 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803869:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80386f:	8b 01                	mov    (%ecx),%eax
+  803871:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803874:	39 c2                	cmp    %eax,%edx
+  803876:	75 14                	jne    80388c <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803878:	83 ec 0c             	sub    $0xc,%esp
+  80387b:	57                   	push   %edi
+  80387c:	e8 a5 d2 ff ff       	call   800b26 <sys_env_destroy>
+  803881:	83 c4 10             	add    $0x10,%esp
+  803884:	85 c0                	test   %eax,%eax
+  803886:	0f 88 97 00 00 00    	js     803923 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80388c:	83 c3 01             	add    $0x1,%ebx
+  80388f:	83 fb 20             	cmp    $0x20,%ebx
+  803892:	0f 84 d2 00 00 00    	je     80396a <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803898:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80389b:	74 ef                	je     80388c <pthread_kill_others+0x56>
+  80389d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038a0:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8038a7:	8b 40 04             	mov    0x4(%eax),%eax
+  8038aa:	83 f8 01             	cmp    $0x1,%eax
+  8038ad:	75 dd                	jne    80388c <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8038af:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038b2:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8038b9:	89 fe                	mov    %edi,%esi
+  8038bb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038c1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038c4:	c1 e0 04             	shl    $0x4,%eax
+  8038c7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038cc:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038cf:	39 c7                	cmp    %eax,%edi
+  8038d1:	75 b9                	jne    80388c <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038d3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038d6:	c1 e0 04             	shl    $0x4,%eax
+  8038d9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038de:	8b 40 54             	mov    0x54(%eax),%eax
+  8038e1:	85 c0                	test   %eax,%eax
+  8038e3:	74 a7                	je     80388c <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038e5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038e8:	c1 e0 04             	shl    $0x4,%eax
+  8038eb:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8038f1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038f3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8038f9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038fe:	0f 87 65 ff ff ff    	ja     803869 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803904:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803909:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80390b:	c1 e8 10             	shr    $0x10,%eax
+  80390e:	0f 84 55 ff ff ff    	je     803869 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803914:	c1 e0 10             	shl    $0x10,%eax
+  803917:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80391c:	29 c1                	sub    %eax,%ecx
+  80391e:	e9 4c ff ff ff       	jmp    80386f <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803923:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803926:	c1 e2 04             	shl    $0x4,%edx
+  803929:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80392f:	8b 52 48             	mov    0x48(%edx),%edx
+  803932:	39 fa                	cmp    %edi,%edx
+  803934:	0f 85 52 ff ff ff    	jne    80388c <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80393a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80393d:	c1 e2 04             	shl    $0x4,%edx
+  803940:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803946:	8b 52 54             	mov    0x54(%edx),%edx
+  803949:	85 d2                	test   %edx,%edx
+  80394b:	0f 84 3b ff ff ff    	je     80388c <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803951:	83 ec 0c             	sub    $0xc,%esp
+  803954:	50                   	push   %eax
+  803955:	57                   	push   %edi
+  803956:	68 90 4c 80 00       	push   $0x804c90
+  80395b:	68 bb 00 00 00       	push   $0xbb
+  803960:	68 80 4c 80 00       	push   $0x804c80
+  803965:	e8 3f 02 00 00       	call   803ba9 <_panic>
+	}
+}
+  80396a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80396d:	5b                   	pop    %ebx
+  80396e:	5e                   	pop    %esi
+  80396f:	5f                   	pop    %edi
+  803970:	5d                   	pop    %ebp
+  803971:	c3                   	ret
+
+00803972 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803972:	55                   	push   %ebp
+  803973:	89 e5                	mov    %esp,%ebp
+  803975:	53                   	push   %ebx
+  803976:	83 ec 04             	sub    $0x4,%esp
+  803979:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80397b:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803981:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803987:	0f 87 85 00 00 00    	ja     803a12 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80398d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803992:	29 c3                	sub    %eax,%ebx
+  803994:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803997:	83 ec 04             	sub    $0x4,%esp
+  80399a:	68 80 02 00 00       	push   $0x280
+  80399f:	6a 00                	push   $0x0
+  8039a1:	68 40 60 80 00       	push   $0x806040
+  8039a6:	e8 31 cf ff ff       	call   8008dc <memset>
+	threads_mu.m_state = 0;
+  8039ab:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8039b2:	00 00 00 
+	if (self != 0) {
+  8039b5:	83 c4 10             	add    $0x10,%esp
+  8039b8:	85 db                	test   %ebx,%ebx
+  8039ba:	74 51                	je     803a0d <pthread_fork_child+0x9b>
+  8039bc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039be:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039c4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039c9:	77 18                	ja     8039e3 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039cb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039d0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039d2:	c1 e8 10             	shr    $0x10,%eax
+  8039d5:	74 0c                	je     8039e3 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039d7:	c1 e0 10             	shl    $0x10,%eax
+  8039da:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039df:	29 c2                	sub    %eax,%edx
+  8039e1:	eb 06                	jmp    8039e9 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8039e3:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8039e9:	8b 02                	mov    (%edx),%eax
+  8039eb:	8b 48 48             	mov    0x48(%eax),%ecx
+  8039ee:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8039f5:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8039f8:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8039ff:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803a06:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a10:	c9                   	leave
+  803a11:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803a12:	83 ec 04             	sub    $0x4,%esp
+  803a15:	68 80 02 00 00       	push   $0x280
+  803a1a:	6a 00                	push   $0x0
+  803a1c:	68 40 60 80 00       	push   $0x806040
+  803a21:	e8 b6 ce ff ff       	call   8008dc <memset>
+	threads_mu.m_state = 0;
+  803a26:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a2d:	00 00 00 
+  803a30:	83 c4 10             	add    $0x10,%esp
+  803a33:	eb d8                	jmp    803a0d <pthread_fork_child+0x9b>
+
+00803a35 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3a:	c3                   	ret
+
+00803a3b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a3b:	55                   	push   %ebp
+  803a3c:	89 e5                	mov    %esp,%ebp
+  803a3e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803a41:	68 b5 4c 80 00       	push   $0x804cb5
+  803a46:	ff 75 0c             	push   0xc(%ebp)
+  803a49:	e8 3d cd ff ff       	call   80078b <strcpy>
+	return 0;
+}
+  803a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a53:	c9                   	leave
+  803a54:	c3                   	ret
+
+00803a55 <devcons_write>:
+{
+  803a55:	55                   	push   %ebp
+  803a56:	89 e5                	mov    %esp,%ebp
+  803a58:	57                   	push   %edi
+  803a59:	56                   	push   %esi
+  803a5a:	53                   	push   %ebx
+  803a5b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803a61:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803a66:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803a6c:	eb 2e                	jmp    803a9c <devcons_write+0x47>
+		m = n - tot;
+  803a6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a71:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803a73:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a78:	39 c3                	cmp    %eax,%ebx
+  803a7a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a7d:	83 ec 04             	sub    $0x4,%esp
+  803a80:	53                   	push   %ebx
+  803a81:	89 f0                	mov    %esi,%eax
+  803a83:	03 45 0c             	add    0xc(%ebp),%eax
+  803a86:	50                   	push   %eax
+  803a87:	57                   	push   %edi
+  803a88:	e8 84 ce ff ff       	call   800911 <memmove>
+		sys_cputs(buf, m);
+  803a8d:	83 c4 08             	add    $0x8,%esp
+  803a90:	53                   	push   %ebx
+  803a91:	57                   	push   %edi
+  803a92:	e8 38 d0 ff ff       	call   800acf <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803a97:	01 de                	add    %ebx,%esi
+  803a99:	83 c4 10             	add    $0x10,%esp
+  803a9c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a9f:	72 cd                	jb     803a6e <devcons_write+0x19>
+}
+  803aa1:	89 f0                	mov    %esi,%eax
+  803aa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aa6:	5b                   	pop    %ebx
+  803aa7:	5e                   	pop    %esi
+  803aa8:	5f                   	pop    %edi
+  803aa9:	5d                   	pop    %ebp
+  803aaa:	c3                   	ret
+
+00803aab <devcons_read>:
+{
+  803aab:	55                   	push   %ebp
+  803aac:	89 e5                	mov    %esp,%ebp
+  803aae:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803aba:	75 07                	jne    803ac3 <devcons_read+0x18>
+  803abc:	eb 1f                	jmp    803add <devcons_read+0x32>
+		sys_yield();
+  803abe:	e8 da d0 ff ff       	call   800b9d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803ac3:	e8 32 d0 ff ff       	call   800afa <sys_cgetc>
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	74 f2                	je     803abe <devcons_read+0x13>
+	if (c < 0)
+  803acc:	78 0f                	js     803add <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803ace:	83 f8 04             	cmp    $0x4,%eax
+  803ad1:	74 0c                	je     803adf <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ad3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ad6:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ad8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803add:	c9                   	leave
+  803ade:	c3                   	ret
+		return 0;
+  803adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae4:	eb f7                	jmp    803add <devcons_read+0x32>
+
+00803ae6 <cputchar>:
+{
+  803ae6:	55                   	push   %ebp
+  803ae7:	89 e5                	mov    %esp,%ebp
+  803ae9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803aec:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aef:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803af2:	6a 01                	push   $0x1
+  803af4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803af7:	50                   	push   %eax
+  803af8:	e8 d2 cf ff ff       	call   800acf <sys_cputs>
+}
+  803afd:	83 c4 10             	add    $0x10,%esp
+  803b00:	c9                   	leave
+  803b01:	c3                   	ret
+
+00803b02 <getchar>:
+{
+  803b02:	55                   	push   %ebp
+  803b03:	89 e5                	mov    %esp,%ebp
+  803b05:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803b08:	6a 01                	push   $0x1
+  803b0a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b0d:	50                   	push   %eax
+  803b0e:	6a 00                	push   $0x0
+  803b10:	e8 63 d8 ff ff       	call   801378 <read>
+	if (r < 0)
+  803b15:	83 c4 10             	add    $0x10,%esp
+  803b18:	85 c0                	test   %eax,%eax
+  803b1a:	78 06                	js     803b22 <getchar+0x20>
+	if (r < 1)
+  803b1c:	74 06                	je     803b24 <getchar+0x22>
+	return c;
+  803b1e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b22:	c9                   	leave
+  803b23:	c3                   	ret
+		return -E_EOF;
+  803b24:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b29:	eb f7                	jmp    803b22 <getchar+0x20>
+
+00803b2b <iscons>:
+{
+  803b2b:	55                   	push   %ebp
+  803b2c:	89 e5                	mov    %esp,%ebp
+  803b2e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b34:	50                   	push   %eax
+  803b35:	ff 75 08             	push   0x8(%ebp)
+  803b38:	e8 ab d5 ff ff       	call   8010e8 <fd_lookup>
+  803b3d:	83 c4 10             	add    $0x10,%esp
+  803b40:	85 c0                	test   %eax,%eax
+  803b42:	78 11                	js     803b55 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b47:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b4d:	39 10                	cmp    %edx,(%eax)
+  803b4f:	0f 94 c0             	sete   %al
+  803b52:	0f b6 c0             	movzbl %al,%eax
+}
+  803b55:	c9                   	leave
+  803b56:	c3                   	ret
+
+00803b57 <opencons>:
+{
+  803b57:	55                   	push   %ebp
+  803b58:	89 e5                	mov    %esp,%ebp
+  803b5a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803b5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b60:	50                   	push   %eax
+  803b61:	e8 2c d5 ff ff       	call   801092 <fd_alloc>
+  803b66:	83 c4 10             	add    $0x10,%esp
+  803b69:	85 c0                	test   %eax,%eax
+  803b6b:	78 3a                	js     803ba7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803b6d:	83 ec 04             	sub    $0x4,%esp
+  803b70:	68 07 04 00 00       	push   $0x407
+  803b75:	ff 75 f4             	push   -0xc(%ebp)
+  803b78:	6a 00                	push   $0x0
+  803b7a:	e8 4a d0 ff ff       	call   800bc9 <sys_page_alloc>
+  803b7f:	83 c4 10             	add    $0x10,%esp
+  803b82:	85 c0                	test   %eax,%eax
+  803b84:	78 21                	js     803ba7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b89:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b8f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b94:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b9b:	83 ec 0c             	sub    $0xc,%esp
+  803b9e:	50                   	push   %eax
+  803b9f:	e8 c7 d4 ff ff       	call   80106b <fd2num>
+  803ba4:	83 c4 10             	add    $0x10,%esp
+}
+  803ba7:	c9                   	leave
+  803ba8:	c3                   	ret
+
+00803ba9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803ba9:	55                   	push   %ebp
+  803baa:	89 e5                	mov    %esp,%ebp
+  803bac:	56                   	push   %esi
+  803bad:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803bae:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803bb1:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803bb7:	e8 b5 cf ff ff       	call   800b71 <sys_getenvid>
+  803bbc:	83 ec 0c             	sub    $0xc,%esp
+  803bbf:	ff 75 0c             	push   0xc(%ebp)
+  803bc2:	ff 75 08             	push   0x8(%ebp)
+  803bc5:	56                   	push   %esi
+  803bc6:	50                   	push   %eax
+  803bc7:	68 c4 4c 80 00       	push   $0x804cc4
+  803bcc:	e8 d6 c5 ff ff       	call   8001a7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803bd1:	83 c4 18             	add    $0x18,%esp
+  803bd4:	53                   	push   %ebx
+  803bd5:	ff 75 10             	push   0x10(%ebp)
+  803bd8:	e8 79 c5 ff ff       	call   800156 <vcprintf>
+	cprintf("\n");
+  803bdd:	c7 04 24 22 4e 80 00 	movl   $0x804e22,(%esp)
+  803be4:	e8 be c5 ff ff       	call   8001a7 <cprintf>
+  803be9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803bec:	cc                   	int3
+	while (1)
+  803bed:	eb fd                	jmp    803bec <_panic+0x43>
+
+00803bef <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bef:	55                   	push   %ebp
+  803bf0:	89 e5                	mov    %esp,%ebp
+  803bf2:	57                   	push   %edi
+  803bf3:	56                   	push   %esi
+  803bf4:	53                   	push   %ebx
+  803bf5:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bf8:	89 d6                	mov    %edx,%esi
+  803bfa:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bfd:	89 cf                	mov    %ecx,%edi
+  803bff:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c02:	89 fa                	mov    %edi,%edx
+  803c04:	80 ce 08             	or     $0x8,%dh
+  803c07:	f6 c5 08             	test   $0x8,%ch
+  803c0a:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c0d:	57                   	push   %edi
+  803c0e:	56                   	push   %esi
+  803c0f:	50                   	push   %eax
+  803c10:	56                   	push   %esi
+  803c11:	6a 00                	push   $0x0
+  803c13:	e8 fe cf ff ff       	call   800c16 <sys_page_map>
+	if (r < 0) {
+  803c18:	83 c4 20             	add    $0x20,%esp
+  803c1b:	85 c0                	test   %eax,%eax
+  803c1d:	78 27                	js     803c46 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c1f:	83 ec 0c             	sub    $0xc,%esp
+  803c22:	57                   	push   %edi
+  803c23:	56                   	push   %esi
+  803c24:	6a 00                	push   $0x0
+  803c26:	56                   	push   %esi
+  803c27:	6a 00                	push   $0x0
+  803c29:	e8 e8 cf ff ff       	call   800c16 <sys_page_map>
+  803c2e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c30:	83 c4 20             	add    $0x20,%esp
+  803c33:	85 c0                	test   %eax,%eax
+  803c35:	78 24                	js     803c5b <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c37:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c3c:	89 d8                	mov    %ebx,%eax
+  803c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c41:	5b                   	pop    %ebx
+  803c42:	5e                   	pop    %esi
+  803c43:	5f                   	pop    %edi
+  803c44:	5d                   	pop    %ebp
+  803c45:	c3                   	ret
+  803c46:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c48:	83 ec 08             	sub    $0x8,%esp
+  803c4b:	50                   	push   %eax
+  803c4c:	68 e8 4c 80 00       	push   $0x804ce8
+  803c51:	e8 51 c5 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803c56:	83 c4 10             	add    $0x10,%esp
+  803c59:	eb e1                	jmp    803c3c <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c5b:	83 ec 08             	sub    $0x8,%esp
+  803c5e:	50                   	push   %eax
+  803c5f:	68 18 4d 80 00       	push   $0x804d18
+  803c64:	e8 3e c5 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803c69:	83 c4 10             	add    $0x10,%esp
+  803c6c:	eb ce                	jmp    803c3c <duppage_cow+0x4d>
+
+00803c6e <duppage>:
+{
+  803c6e:	55                   	push   %ebp
+  803c6f:	89 e5                	mov    %esp,%ebp
+  803c71:	53                   	push   %ebx
+  803c72:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c75:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c78:	51                   	push   %ecx
+  803c79:	52                   	push   %edx
+  803c7a:	50                   	push   %eax
+  803c7b:	52                   	push   %edx
+  803c7c:	6a 00                	push   $0x0
+  803c7e:	e8 93 cf ff ff       	call   800c16 <sys_page_map>
+	if (r < 0) {
+  803c83:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c86:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c8b:	85 c0                	test   %eax,%eax
+  803c8d:	78 07                	js     803c96 <duppage+0x28>
+}
+  803c8f:	89 d8                	mov    %ebx,%eax
+  803c91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c94:	c9                   	leave
+  803c95:	c3                   	ret
+  803c96:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c98:	83 ec 08             	sub    $0x8,%esp
+  803c9b:	50                   	push   %eax
+  803c9c:	68 e8 4c 80 00       	push   $0x804ce8
+  803ca1:	e8 01 c5 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803ca6:	83 c4 10             	add    $0x10,%esp
+  803ca9:	eb e4                	jmp    803c8f <duppage+0x21>
+
+00803cab <cow_copy>:
+{
+  803cab:	55                   	push   %ebp
+  803cac:	89 e5                	mov    %esp,%ebp
+  803cae:	56                   	push   %esi
+  803caf:	53                   	push   %ebx
+  803cb0:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803cb2:	83 ec 04             	sub    $0x4,%esp
+  803cb5:	6a 07                	push   $0x7
+  803cb7:	68 00 f0 7f 00       	push   $0x7ff000
+  803cbc:	6a 00                	push   $0x0
+  803cbe:	e8 06 cf ff ff       	call   800bc9 <sys_page_alloc>
+	if (r < 0) {
+  803cc3:	83 c4 10             	add    $0x10,%esp
+  803cc6:	85 c0                	test   %eax,%eax
+  803cc8:	78 58                	js     803d22 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803cca:	83 ec 04             	sub    $0x4,%esp
+  803ccd:	68 00 10 00 00       	push   $0x1000
+  803cd2:	56                   	push   %esi
+  803cd3:	68 00 f0 7f 00       	push   $0x7ff000
+  803cd8:	e8 34 cc ff ff       	call   800911 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cdd:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803ce4:	56                   	push   %esi
+  803ce5:	6a 00                	push   $0x0
+  803ce7:	68 00 f0 7f 00       	push   $0x7ff000
+  803cec:	6a 00                	push   $0x0
+  803cee:	e8 23 cf ff ff       	call   800c16 <sys_page_map>
+  803cf3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cf5:	83 c4 20             	add    $0x20,%esp
+  803cf8:	85 c0                	test   %eax,%eax
+  803cfa:	78 3b                	js     803d37 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cfc:	83 ec 08             	sub    $0x8,%esp
+  803cff:	68 00 f0 7f 00       	push   $0x7ff000
+  803d04:	6a 00                	push   $0x0
+  803d06:	e8 57 cf ff ff       	call   800c62 <sys_page_unmap>
+  803d0b:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	85 c0                	test   %eax,%eax
+  803d12:	78 45                	js     803d59 <cow_copy+0xae>
+	return 0;
+  803d14:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d19:	89 d8                	mov    %ebx,%eax
+  803d1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d1e:	5b                   	pop    %ebx
+  803d1f:	5e                   	pop    %esi
+  803d20:	5d                   	pop    %ebp
+  803d21:	c3                   	ret
+  803d22:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d24:	83 ec 08             	sub    $0x8,%esp
+  803d27:	50                   	push   %eax
+  803d28:	68 08 4e 80 00       	push   $0x804e08
+  803d2d:	e8 75 c4 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803d32:	83 c4 10             	add    $0x10,%esp
+  803d35:	eb e2                	jmp    803d19 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d37:	83 ec 08             	sub    $0x8,%esp
+  803d3a:	50                   	push   %eax
+  803d3b:	68 24 4e 80 00       	push   $0x804e24
+  803d40:	e8 62 c4 ff ff       	call   8001a7 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d45:	83 c4 08             	add    $0x8,%esp
+  803d48:	68 00 f0 7f 00       	push   $0x7ff000
+  803d4d:	6a 00                	push   $0x0
+  803d4f:	e8 0e cf ff ff       	call   800c62 <sys_page_unmap>
+		return r;
+  803d54:	83 c4 10             	add    $0x10,%esp
+  803d57:	eb c0                	jmp    803d19 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d59:	83 ec 08             	sub    $0x8,%esp
+  803d5c:	50                   	push   %eax
+  803d5d:	68 40 4d 80 00       	push   $0x804d40
+  803d62:	e8 40 c4 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803d67:	83 c4 10             	add    $0x10,%esp
+  803d6a:	eb ad                	jmp    803d19 <cow_copy+0x6e>
+
+00803d6c <pgfault>:
+{
+  803d6c:	55                   	push   %ebp
+  803d6d:	89 e5                	mov    %esp,%ebp
+  803d6f:	56                   	push   %esi
+  803d70:	53                   	push   %ebx
+  803d71:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d74:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d76:	89 d8                	mov    %ebx,%eax
+  803d78:	c1 e8 16             	shr    $0x16,%eax
+  803d7b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d82:	89 de                	mov    %ebx,%esi
+  803d84:	c1 ee 0c             	shr    $0xc,%esi
+  803d87:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d8e:	a8 07                	test   $0x7,%al
+  803d90:	74 3b                	je     803dcd <pgfault+0x61>
+  803d92:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d98:	74 33                	je     803dcd <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d9a:	83 ec 0c             	sub    $0xc,%esp
+  803d9d:	68 00 f0 bf ee       	push   $0xeebff000
+  803da2:	e8 82 f4 ff ff       	call   803229 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803da7:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803dae:	83 c4 10             	add    $0x10,%esp
+  803db1:	f6 c4 08             	test   $0x8,%ah
+  803db4:	75 30                	jne    803de6 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803db6:	83 ec 0c             	sub    $0xc,%esp
+  803db9:	68 00 f0 bf ee       	push   $0xeebff000
+  803dbe:	e8 d3 f4 ff ff       	call   803296 <mutex_unlock>
+}
+  803dc3:	83 c4 10             	add    $0x10,%esp
+  803dc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dc9:	5b                   	pop    %ebx
+  803dca:	5e                   	pop    %esi
+  803dcb:	5d                   	pop    %ebp
+  803dcc:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803dcd:	83 ec 08             	sub    $0x8,%esp
+  803dd0:	ff 72 28             	push   0x28(%edx)
+  803dd3:	51                   	push   %ecx
+  803dd4:	50                   	push   %eax
+  803dd5:	68 64 4d 80 00       	push   $0x804d64
+  803dda:	6a 3f                	push   $0x3f
+  803ddc:	68 3e 4e 80 00       	push   $0x804e3e
+  803de1:	e8 c3 fd ff ff       	call   803ba9 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803de6:	89 d8                	mov    %ebx,%eax
+  803de8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803ded:	e8 b9 fe ff ff       	call   803cab <cow_copy>
+  803df2:	eb c2                	jmp    803db6 <pgfault+0x4a>
+
+00803df4 <cow_enable>:
+{
+  803df4:	55                   	push   %ebp
+  803df5:	89 e5                	mov    %esp,%ebp
+  803df7:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dfa:	68 6c 3d 80 00       	push   $0x803d6c
+  803dff:	e8 28 06 00 00       	call   80442c <set_pgfault_handler>
+}
+  803e04:	83 c4 10             	add    $0x10,%esp
+  803e07:	c9                   	leave
+  803e08:	c3                   	ret
+
+00803e09 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e09:	55                   	push   %ebp
+  803e0a:	89 e5                	mov    %esp,%ebp
+  803e0c:	57                   	push   %edi
+  803e0d:	56                   	push   %esi
+  803e0e:	53                   	push   %ebx
+  803e0f:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e12:	68 6c 3d 80 00       	push   $0x803d6c
+  803e17:	e8 10 06 00 00       	call   80442c <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e1c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e21:	cd 30                	int    $0x30
+  803e23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e26:	83 c4 10             	add    $0x10,%esp
+  803e29:	85 c0                	test   %eax,%eax
+  803e2b:	78 4b                	js     803e78 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e2d:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e37:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e3a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e3e:	0f 85 16 01 00 00    	jne    803f5a <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e44:	e8 28 cd ff ff       	call   800b71 <sys_getenvid>
+  803e49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e4e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e50:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e56:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e5c:	77 32                	ja     803e90 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e5e:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e63:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e65:	c1 ea 10             	shr    $0x10,%edx
+  803e68:	74 26                	je     803e90 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e6a:	c1 e2 10             	shl    $0x10,%edx
+  803e6d:	89 d1                	mov    %edx,%ecx
+  803e6f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e74:	29 ca                	sub    %ecx,%edx
+  803e76:	eb 1e                	jmp    803e96 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e78:	83 ec 08             	sub    $0x8,%esp
+  803e7b:	89 c7                	mov    %eax,%edi
+  803e7d:	50                   	push   %eax
+  803e7e:	68 49 4e 80 00       	push   $0x804e49
+  803e83:	e8 1f c3 ff ff       	call   8001a7 <cprintf>
+		return eid;
+  803e88:	83 c4 10             	add    $0x10,%esp
+  803e8b:	e9 6c 01 00 00       	jmp    803ffc <fork+0x1f3>
+		return pthread_main_tls;
+  803e90:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e96:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e99:	c1 e0 04             	shl    $0x4,%eax
+  803e9c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ea1:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803ea3:	e8 ca fa ff ff       	call   803972 <pthread_fork_child>
+		return eid;
+  803ea8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803eab:	e9 4c 01 00 00       	jmp    803ffc <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803eb0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eb6:	89 da                	mov    %ebx,%edx
+  803eb8:	89 f8                	mov    %edi,%eax
+  803eba:	e8 af fd ff ff       	call   803c6e <duppage>
+  803ebf:	85 c0                	test   %eax,%eax
+  803ec1:	79 28                	jns    803eeb <fork+0xe2>
+  803ec3:	89 c7                	mov    %eax,%edi
+  803ec5:	e9 32 01 00 00       	jmp    803ffc <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803eca:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803ed0:	83 f9 05             	cmp    $0x5,%ecx
+  803ed3:	75 58                	jne    803f2d <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ed5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803eda:	89 da                	mov    %ebx,%edx
+  803edc:	89 f8                	mov    %edi,%eax
+  803ede:	e8 8b fd ff ff       	call   803c6e <duppage>
+  803ee3:	85 c0                	test   %eax,%eax
+  803ee5:	0f 88 0f 01 00 00    	js     803ffa <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eeb:	83 c3 01             	add    $0x1,%ebx
+  803eee:	39 de                	cmp    %ebx,%esi
+  803ef0:	74 54                	je     803f46 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ef2:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ef9:	f6 c1 05             	test   $0x5,%cl
+  803efc:	74 ed                	je     803eeb <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803efe:	f6 c5 04             	test   $0x4,%ch
+  803f01:	75 ad                	jne    803eb0 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f03:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f09:	74 bf                	je     803eca <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f0b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f11:	74 d8                	je     803eeb <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f13:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f19:	89 da                	mov    %ebx,%edx
+  803f1b:	89 f8                	mov    %edi,%eax
+  803f1d:	e8 cd fc ff ff       	call   803bef <duppage_cow>
+  803f22:	85 c0                	test   %eax,%eax
+  803f24:	79 c5                	jns    803eeb <fork+0xe2>
+  803f26:	89 c7                	mov    %eax,%edi
+  803f28:	e9 cf 00 00 00       	jmp    803ffc <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f2d:	68 94 4d 80 00       	push   $0x804d94
+  803f32:	68 7d 4b 80 00       	push   $0x804b7d
+  803f37:	68 c6 00 00 00       	push   $0xc6
+  803f3c:	68 3e 4e 80 00       	push   $0x804e3e
+  803f41:	e8 63 fc ff ff       	call   803ba9 <_panic>
+  803f46:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f49:	83 c1 01             	add    $0x1,%ecx
+  803f4c:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f52:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f58:	74 18                	je     803f72 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f5a:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f61:	a8 07                	test   $0x7,%al
+  803f63:	74 e4                	je     803f49 <fork+0x140>
+  803f65:	89 cb                	mov    %ecx,%ebx
+  803f67:	c1 e3 0a             	shl    $0xa,%ebx
+  803f6a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f6d:	e9 7c ff ff ff       	jmp    803eee <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f72:	83 ec 04             	sub    $0x4,%esp
+  803f75:	6a 07                	push   $0x7
+  803f77:	68 00 f0 bf ee       	push   $0xeebff000
+  803f7c:	ff 75 e4             	push   -0x1c(%ebp)
+  803f7f:	e8 45 cc ff ff       	call   800bc9 <sys_page_alloc>
+  803f84:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f86:	83 c4 10             	add    $0x10,%esp
+  803f89:	85 c0                	test   %eax,%eax
+  803f8b:	78 34                	js     803fc1 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f8d:	83 ec 08             	sub    $0x8,%esp
+  803f90:	68 6a 44 80 00       	push   $0x80446a
+  803f95:	ff 75 e4             	push   -0x1c(%ebp)
+  803f98:	e8 a9 cd ff ff       	call   800d46 <sys_env_set_pgfault_upcall>
+  803f9d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f9f:	83 c4 10             	add    $0x10,%esp
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	78 2e                	js     803fd4 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803fa6:	83 ec 08             	sub    $0x8,%esp
+  803fa9:	6a 02                	push   $0x2
+  803fab:	ff 75 e4             	push   -0x1c(%ebp)
+  803fae:	e8 fb cc ff ff       	call   800cae <sys_env_set_status>
+  803fb3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fb5:	83 c4 10             	add    $0x10,%esp
+  803fb8:	85 c0                	test   %eax,%eax
+  803fba:	78 2b                	js     803fe7 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803fbc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fbf:	eb 3b                	jmp    803ffc <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fc1:	83 ec 08             	sub    $0x8,%esp
+  803fc4:	50                   	push   %eax
+  803fc5:	68 bc 4d 80 00       	push   $0x804dbc
+  803fca:	e8 d8 c1 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803fcf:	83 c4 10             	add    $0x10,%esp
+  803fd2:	eb 28                	jmp    803ffc <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fd4:	83 ec 08             	sub    $0x8,%esp
+  803fd7:	50                   	push   %eax
+  803fd8:	68 e4 4d 80 00       	push   $0x804de4
+  803fdd:	e8 c5 c1 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803fe2:	83 c4 10             	add    $0x10,%esp
+  803fe5:	eb 15                	jmp    803ffc <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fe7:	83 ec 08             	sub    $0x8,%esp
+  803fea:	50                   	push   %eax
+  803feb:	68 59 4e 80 00       	push   $0x804e59
+  803ff0:	e8 b2 c1 ff ff       	call   8001a7 <cprintf>
+		return r;
+  803ff5:	83 c4 10             	add    $0x10,%esp
+  803ff8:	eb 02                	jmp    803ffc <fork+0x1f3>
+  803ffa:	89 c7                	mov    %eax,%edi
+}
+  803ffc:	89 f8                	mov    %edi,%eax
+  803ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804001:	5b                   	pop    %ebx
+  804002:	5e                   	pop    %esi
+  804003:	5f                   	pop    %edi
+  804004:	5d                   	pop    %ebp
+  804005:	c3                   	ret
+
+00804006 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804006:	55                   	push   %ebp
+  804007:	89 e5                	mov    %esp,%ebp
+  804009:	57                   	push   %edi
+  80400a:	56                   	push   %esi
+  80400b:	53                   	push   %ebx
+  80400c:	83 ec 2c             	sub    $0x2c,%esp
+  80400f:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804011:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804017:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80401c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804022:	77 0a                	ja     80402e <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804024:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804029:	29 c3                	sub    %eax,%ebx
+  80402b:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80402e:	83 ec 0c             	sub    $0xc,%esp
+  804031:	68 6c 3d 80 00       	push   $0x803d6c
+  804036:	e8 f1 03 00 00       	call   80442c <set_pgfault_handler>
+  80403b:	b8 07 00 00 00       	mov    $0x7,%eax
+  804040:	cd 30                	int    $0x30
+  804042:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804045:	83 c4 10             	add    $0x10,%esp
+  804048:	85 c0                	test   %eax,%eax
+  80404a:	78 30                	js     80407c <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80404c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804050:	74 42                	je     804094 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804052:	c1 e3 10             	shl    $0x10,%ebx
+  804055:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80405a:	29 d8                	sub    %ebx,%eax
+  80405c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80405f:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804064:	29 d8                	sub    %ebx,%eax
+  804066:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804069:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80406e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804073:	89 f7                	mov    %esi,%edi
+  804075:	89 d6                	mov    %edx,%esi
+  804077:	e9 2c 01 00 00       	jmp    8041a8 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80407c:	83 ec 08             	sub    $0x8,%esp
+  80407f:	89 c7                	mov    %eax,%edi
+  804081:	50                   	push   %eax
+  804082:	68 49 4e 80 00       	push   $0x804e49
+  804087:	e8 1b c1 ff ff       	call   8001a7 <cprintf>
+		return eid;
+  80408c:	83 c4 10             	add    $0x10,%esp
+  80408f:	e9 d5 00 00 00       	jmp    804169 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804094:	e8 d8 ca ff ff       	call   800b71 <sys_getenvid>
+  804099:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80409e:	89 c2                	mov    %eax,%edx
+  8040a0:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a2:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8040a8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040ad:	77 18                	ja     8040c7 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040af:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040b4:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040b6:	c1 e8 10             	shr    $0x10,%eax
+  8040b9:	74 0c                	je     8040c7 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040bb:	c1 e0 10             	shl    $0x10,%eax
+  8040be:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040c3:	29 c1                	sub    %eax,%ecx
+  8040c5:	eb 06                	jmp    8040cd <sfork+0xc7>
+		return pthread_main_tls;
+  8040c7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040cd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040d0:	c1 e0 04             	shl    $0x4,%eax
+  8040d3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040d8:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040da:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040dd:	e9 87 00 00 00       	jmp    804169 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040e2:	f6 c5 04             	test   $0x4,%ch
+  8040e5:	74 6c                	je     804153 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040e7:	89 ca                	mov    %ecx,%edx
+  8040e9:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040ef:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040f5:	74 7c                	je     804173 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040f7:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040fd:	89 da                	mov    %ebx,%edx
+  8040ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804102:	e8 67 fb ff ff       	call   803c6e <duppage>
+  804107:	85 c0                	test   %eax,%eax
+  804109:	0f 88 4f 01 00 00    	js     80425e <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80410f:	83 c3 01             	add    $0x1,%ebx
+  804112:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804115:	74 7a                	je     804191 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804117:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804119:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804120:	f6 c1 01             	test   $0x1,%cl
+  804123:	74 ea                	je     80410f <sfork+0x109>
+  804125:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80412b:	74 e2                	je     80410f <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80412d:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804133:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804136:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80413b:	76 a5                	jbe    8040e2 <sfork+0xdc>
+  80413d:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804143:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804146:	39 fa                	cmp    %edi,%edx
+  804148:	73 9d                	jae    8040e7 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80414a:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80414d:	39 fa                	cmp    %edi,%edx
+  80414f:	72 96                	jb     8040e7 <sfork+0xe1>
+  804151:	eb 8f                	jmp    8040e2 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804153:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804159:	89 da                	mov    %ebx,%edx
+  80415b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80415e:	e8 8c fa ff ff       	call   803bef <duppage_cow>
+  804163:	85 c0                	test   %eax,%eax
+  804165:	79 a8                	jns    80410f <sfork+0x109>
+  804167:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804169:	89 f8                	mov    %edi,%eax
+  80416b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80416e:	5b                   	pop    %ebx
+  80416f:	5e                   	pop    %esi
+  804170:	5f                   	pop    %edi
+  804171:	5d                   	pop    %ebp
+  804172:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804173:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804178:	e8 2e fb ff ff       	call   803cab <cow_copy>
+  80417d:	85 c0                	test   %eax,%eax
+  80417f:	0f 88 d2 00 00 00    	js     804257 <sfork+0x251>
+				pte = uvpt[pn];
+  804185:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80418c:	e9 66 ff ff ff       	jmp    8040f7 <sfork+0xf1>
+  804191:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804194:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804197:	83 c6 01             	add    $0x1,%esi
+  80419a:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8041a0:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8041a6:	74 1b                	je     8041c3 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8041a8:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8041af:	a8 01                	test   $0x1,%al
+  8041b1:	74 e4                	je     804197 <sfork+0x191>
+  8041b3:	89 f3                	mov    %esi,%ebx
+  8041b5:	c1 e3 0a             	shl    $0xa,%ebx
+  8041b8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8041bb:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8041be:	e9 4f ff ff ff       	jmp    804112 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041c3:	83 ec 04             	sub    $0x4,%esp
+  8041c6:	6a 07                	push   $0x7
+  8041c8:	68 00 f0 bf ee       	push   $0xeebff000
+  8041cd:	ff 75 e0             	push   -0x20(%ebp)
+  8041d0:	e8 f4 c9 ff ff       	call   800bc9 <sys_page_alloc>
+  8041d5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041d7:	83 c4 10             	add    $0x10,%esp
+  8041da:	85 c0                	test   %eax,%eax
+  8041dc:	78 37                	js     804215 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041de:	83 ec 08             	sub    $0x8,%esp
+  8041e1:	68 6a 44 80 00       	push   $0x80446a
+  8041e6:	ff 75 e0             	push   -0x20(%ebp)
+  8041e9:	e8 58 cb ff ff       	call   800d46 <sys_env_set_pgfault_upcall>
+  8041ee:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041f0:	83 c4 10             	add    $0x10,%esp
+  8041f3:	85 c0                	test   %eax,%eax
+  8041f5:	78 34                	js     80422b <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041f7:	83 ec 08             	sub    $0x8,%esp
+  8041fa:	6a 02                	push   $0x2
+  8041fc:	ff 75 e0             	push   -0x20(%ebp)
+  8041ff:	e8 aa ca ff ff       	call   800cae <sys_env_set_status>
+  804204:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804206:	83 c4 10             	add    $0x10,%esp
+  804209:	85 c0                	test   %eax,%eax
+  80420b:	78 34                	js     804241 <sfork+0x23b>
+	return eid;
+  80420d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804210:	e9 54 ff ff ff       	jmp    804169 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804215:	83 ec 08             	sub    $0x8,%esp
+  804218:	50                   	push   %eax
+  804219:	68 bc 4d 80 00       	push   $0x804dbc
+  80421e:	e8 84 bf ff ff       	call   8001a7 <cprintf>
+		return r;
+  804223:	83 c4 10             	add    $0x10,%esp
+  804226:	e9 3e ff ff ff       	jmp    804169 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80422b:	83 ec 08             	sub    $0x8,%esp
+  80422e:	50                   	push   %eax
+  80422f:	68 e4 4d 80 00       	push   $0x804de4
+  804234:	e8 6e bf ff ff       	call   8001a7 <cprintf>
+		return r;
+  804239:	83 c4 10             	add    $0x10,%esp
+  80423c:	e9 28 ff ff ff       	jmp    804169 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804241:	83 ec 08             	sub    $0x8,%esp
+  804244:	50                   	push   %eax
+  804245:	68 59 4e 80 00       	push   $0x804e59
+  80424a:	e8 58 bf ff ff       	call   8001a7 <cprintf>
+		return r;
+  80424f:	83 c4 10             	add    $0x10,%esp
+  804252:	e9 12 ff ff ff       	jmp    804169 <sfork+0x163>
+  804257:	89 c7                	mov    %eax,%edi
+  804259:	e9 0b ff ff ff       	jmp    804169 <sfork+0x163>
+  80425e:	89 c7                	mov    %eax,%edi
+  804260:	e9 04 ff ff ff       	jmp    804169 <sfork+0x163>
+
+00804265 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804265:	55                   	push   %ebp
+  804266:	89 e5                	mov    %esp,%ebp
+  804268:	57                   	push   %edi
+  804269:	56                   	push   %esi
+  80426a:	53                   	push   %ebx
+  80426b:	83 ec 18             	sub    $0x18,%esp
+  80426e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804271:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804274:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804277:	85 c0                	test   %eax,%eax
+  804279:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80427e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804281:	50                   	push   %eax
+  804282:	e8 38 cb ff ff       	call   800dbf <sys_ipc_recv>
+	if (r < 0) {
+  804287:	83 c4 10             	add    $0x10,%esp
+  80428a:	85 c0                	test   %eax,%eax
+  80428c:	78 2b                	js     8042b9 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80428e:	85 ff                	test   %edi,%edi
+  804290:	74 55                	je     8042e7 <ipc_recv+0x82>
+  804292:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804294:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80429a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80429f:	77 39                	ja     8042da <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042a1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042a6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042a8:	c1 e8 10             	shr    $0x10,%eax
+  8042ab:	74 2d                	je     8042da <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042ad:	c1 e0 10             	shl    $0x10,%eax
+  8042b0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042b5:	29 c2                	sub    %eax,%edx
+  8042b7:	eb 27                	jmp    8042e0 <ipc_recv+0x7b>
+  8042b9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8042bb:	83 ec 08             	sub    $0x8,%esp
+  8042be:	50                   	push   %eax
+  8042bf:	68 77 4e 80 00       	push   $0x804e77
+  8042c4:	e8 de be ff ff       	call   8001a7 <cprintf>
+		*from_env_store = 0;
+  8042c9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042cf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042d5:	83 c4 10             	add    $0x10,%esp
+  8042d8:	eb 77                	jmp    804351 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042da:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042e0:	8b 02                	mov    (%edx),%eax
+  8042e2:	8b 40 78             	mov    0x78(%eax),%eax
+  8042e5:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042e7:	85 f6                	test   %esi,%esi
+  8042e9:	74 34                	je     80431f <ipc_recv+0xba>
+  8042eb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042ed:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042f3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f8:	77 18                	ja     804312 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042fa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042ff:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804301:	c1 e8 10             	shr    $0x10,%eax
+  804304:	74 0c                	je     804312 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804306:	c1 e0 10             	shl    $0x10,%eax
+  804309:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80430e:	29 c2                	sub    %eax,%edx
+  804310:	eb 06                	jmp    804318 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804312:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804318:	8b 02                	mov    (%edx),%eax
+  80431a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80431d:	89 06                	mov    %eax,(%esi)
+  80431f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804321:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804327:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80432c:	77 18                	ja     804346 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80432e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804333:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804335:	c1 e8 10             	shr    $0x10,%eax
+  804338:	74 0c                	je     804346 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80433a:	c1 e0 10             	shl    $0x10,%eax
+  80433d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804342:	29 c2                	sub    %eax,%edx
+  804344:	eb 06                	jmp    80434c <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804346:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80434c:	8b 02                	mov    (%edx),%eax
+  80434e:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804351:	89 d8                	mov    %ebx,%eax
+  804353:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804356:	5b                   	pop    %ebx
+  804357:	5e                   	pop    %esi
+  804358:	5f                   	pop    %edi
+  804359:	5d                   	pop    %ebp
+  80435a:	c3                   	ret
+
+0080435b <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80435b:	55                   	push   %ebp
+  80435c:	89 e5                	mov    %esp,%ebp
+  80435e:	57                   	push   %edi
+  80435f:	56                   	push   %esi
+  804360:	53                   	push   %ebx
+  804361:	83 ec 0c             	sub    $0xc,%esp
+  804364:	8b 75 08             	mov    0x8(%ebp),%esi
+  804367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80436a:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80436d:	85 db                	test   %ebx,%ebx
+  80436f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804374:	0f 44 d8             	cmove  %eax,%ebx
+  804377:	eb 05                	jmp    80437e <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804379:	e8 1f c8 ff ff       	call   800b9d <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80437e:	57                   	push   %edi
+  80437f:	53                   	push   %ebx
+  804380:	ff 75 0c             	push   0xc(%ebp)
+  804383:	56                   	push   %esi
+  804384:	e8 09 ca ff ff       	call   800d92 <sys_ipc_try_send>
+		if (r == 0) {
+  804389:	83 c4 10             	add    $0x10,%esp
+  80438c:	85 c0                	test   %eax,%eax
+  80438e:	74 19                	je     8043a9 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804390:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804393:	74 e4                	je     804379 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804395:	83 ec 0c             	sub    $0xc,%esp
+  804398:	50                   	push   %eax
+  804399:	57                   	push   %edi
+  80439a:	53                   	push   %ebx
+  80439b:	56                   	push   %esi
+  80439c:	68 90 4e 80 00       	push   $0x804e90
+  8043a1:	e8 01 be ff ff       	call   8001a7 <cprintf>
+			return;
+  8043a6:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8043a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ac:	5b                   	pop    %ebx
+  8043ad:	5e                   	pop    %esi
+  8043ae:	5f                   	pop    %edi
+  8043af:	5d                   	pop    %ebp
+  8043b0:	c3                   	ret
+
+008043b1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8043b1:	55                   	push   %ebp
+  8043b2:	89 e5                	mov    %esp,%ebp
+  8043b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8043b7:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8043bc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043bf:	c1 e0 04             	shl    $0x4,%eax
+  8043c2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043c7:	8b 40 50             	mov    0x50(%eax),%eax
+  8043ca:	39 c8                	cmp    %ecx,%eax
+  8043cc:	74 12                	je     8043e0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043ce:	83 c2 01             	add    $0x1,%edx
+  8043d1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043d7:	75 e3                	jne    8043bc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043de:	eb 0e                	jmp    8043ee <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043e0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043e3:	c1 e0 04             	shl    $0x4,%eax
+  8043e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043eb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043ee:	5d                   	pop    %ebp
+  8043ef:	c3                   	ret
+
+008043f0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043f0:	55                   	push   %ebp
+  8043f1:	89 e5                	mov    %esp,%ebp
+  8043f3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043f6:	89 c2                	mov    %eax,%edx
+  8043f8:	c1 ea 16             	shr    $0x16,%edx
+  8043fb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804402:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804407:	f6 c1 01             	test   $0x1,%cl
+  80440a:	74 1c                	je     804428 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80440c:	c1 e8 0c             	shr    $0xc,%eax
+  80440f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804416:	a8 01                	test   $0x1,%al
+  804418:	74 0e                	je     804428 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80441a:	c1 e8 0c             	shr    $0xc,%eax
+  80441d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804424:	ef 
+  804425:	0f b7 d2             	movzwl %dx,%edx
+}
+  804428:	89 d0                	mov    %edx,%eax
+  80442a:	5d                   	pop    %ebp
+  80442b:	c3                   	ret
+
+0080442c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80442c:	55                   	push   %ebp
+  80442d:	89 e5                	mov    %esp,%ebp
+  80442f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804432:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804439:	74 0a                	je     804445 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80443b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80443e:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804443:	c9                   	leave
+  804444:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804445:	83 ec 04             	sub    $0x4,%esp
+  804448:	6a 07                	push   $0x7
+  80444a:	68 00 f0 bf ee       	push   $0xeebff000
+  80444f:	6a 00                	push   $0x0
+  804451:	e8 73 c7 ff ff       	call   800bc9 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804456:	83 c4 08             	add    $0x8,%esp
+  804459:	68 6a 44 80 00       	push   $0x80446a
+  80445e:	6a 00                	push   $0x0
+  804460:	e8 e1 c8 ff ff       	call   800d46 <sys_env_set_pgfault_upcall>
+  804465:	83 c4 10             	add    $0x10,%esp
+  804468:	eb d1                	jmp    80443b <set_pgfault_handler+0xf>
+
+0080446a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80446a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80446b:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804470:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804472:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804475:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804479:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80447d:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804480:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804484:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804486:	83 c4 08             	add    $0x8,%esp
+	popal
+  804489:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80448a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80448d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80448e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80448f:	c3                   	ret
+
+00804490 <udm>:
+  804490:	57                   	push   %edi
+  804491:	56                   	push   %esi
+  804492:	53                   	push   %ebx
+  804493:	83 ec 20             	sub    $0x20,%esp
+  804496:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80449a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80449e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044aa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044ae:	89 d1                	mov    %edx,%ecx
+  8044b0:	09 c1                	or     %eax,%ecx
+  8044b2:	0f 84 91 00 00 00    	je     804549 <udm+0xb9>
+  8044b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044c2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044c7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044ce:	00 
+  8044cf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044d6:	00 
+  8044d7:	eb 08                	jmp    8044e1 <udm+0x51>
+  8044d9:	83 e9 01             	sub    $0x1,%ecx
+  8044dc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044df:	74 7c                	je     80455d <udm+0xcd>
+  8044e1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044e5:	01 c0                	add    %eax,%eax
+  8044e7:	89 c6                	mov    %eax,%esi
+  8044e9:	89 d7                	mov    %edx,%edi
+  8044eb:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044ef:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044f3:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044f6:	d3 ea                	shr    %cl,%edx
+  8044f8:	f6 c1 20             	test   $0x20,%cl
+  8044fb:	74 04                	je     804501 <udm+0x71>
+  8044fd:	89 d0                	mov    %edx,%eax
+  8044ff:	31 d2                	xor    %edx,%edx
+  804501:	83 e0 01             	and    $0x1,%eax
+  804504:	89 04 24             	mov    %eax,(%esp)
+  804507:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80450e:	00 
+  80450f:	8b 04 24             	mov    (%esp),%eax
+  804512:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804516:	09 f0                	or     %esi,%eax
+  804518:	09 fa                	or     %edi,%edx
+  80451a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80451e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804522:	39 f0                	cmp    %esi,%eax
+  804524:	89 d3                	mov    %edx,%ebx
+  804526:	19 fb                	sbb    %edi,%ebx
+  804528:	72 af                	jb     8044d9 <udm+0x49>
+  80452a:	29 f0                	sub    %esi,%eax
+  80452c:	19 fa                	sbb    %edi,%edx
+  80452e:	89 cf                	mov    %ecx,%edi
+  804530:	c1 ef 05             	shr    $0x5,%edi
+  804533:	83 e7 01             	and    $0x1,%edi
+  804536:	89 fe                	mov    %edi,%esi
+  804538:	83 f6 01             	xor    $0x1,%esi
+  80453b:	d3 e6                	shl    %cl,%esi
+  80453d:	d3 e7                	shl    %cl,%edi
+  80453f:	09 74 24 18          	or     %esi,0x18(%esp)
+  804543:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804547:	eb 90                	jmp    8044d9 <udm+0x49>
+  804549:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80454d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804551:	89 f0                	mov    %esi,%eax
+  804553:	89 fa                	mov    %edi,%edx
+  804555:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804559:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80455d:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804561:	89 01                	mov    %eax,(%ecx)
+  804563:	89 51 04             	mov    %edx,0x4(%ecx)
+  804566:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80456a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80456e:	83 c4 20             	add    $0x20,%esp
+  804571:	5b                   	pop    %ebx
+  804572:	5e                   	pop    %esi
+  804573:	5f                   	pop    %edi
+  804574:	c3                   	ret
+
+00804575 <__udivdi3>:
+  804575:	83 ec 18             	sub    $0x18,%esp
+  804578:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80457c:	50                   	push   %eax
+  80457d:	ff 74 24 2c          	push   0x2c(%esp)
+  804581:	ff 74 24 2c          	push   0x2c(%esp)
+  804585:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804589:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80458d:	e8 fe fe ff ff       	call   804490 <udm>
+  804592:	83 c4 24             	add    $0x24,%esp
+  804595:	c3                   	ret
+
+00804596 <__umoddi3>:
+  804596:	83 ec 18             	sub    $0x18,%esp
+  804599:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80459d:	50                   	push   %eax
+  80459e:	ff 74 24 2c          	push   0x2c(%esp)
+  8045a2:	ff 74 24 2c          	push   0x2c(%esp)
+  8045a6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045aa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045ae:	e8 dd fe ff ff       	call   804490 <udm>
+  8045b3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045b7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045bb:	83 c4 24             	add    $0x24,%esp
+  8045be:	c3                   	ret
+
+008045bf <__divdi3>:
+  8045bf:	56                   	push   %esi
+  8045c0:	53                   	push   %ebx
+  8045c1:	83 ec 14             	sub    $0x14,%esp
+  8045c4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045c8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045cc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045d0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045d4:	85 d2                	test   %edx,%edx
+  8045d6:	78 18                	js     8045f0 <__divdi3+0x31>
+  8045d8:	85 db                	test   %ebx,%ebx
+  8045da:	78 3e                	js     80461a <__divdi3+0x5b>
+  8045dc:	83 ec 04             	sub    $0x4,%esp
+  8045df:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e3:	56                   	push   %esi
+  8045e4:	53                   	push   %ebx
+  8045e5:	51                   	push   %ecx
+  8045e6:	e8 a5 fe ff ff       	call   804490 <udm>
+  8045eb:	83 c4 10             	add    $0x10,%esp
+  8045ee:	eb 24                	jmp    804614 <__divdi3+0x55>
+  8045f0:	f7 d8                	neg    %eax
+  8045f2:	83 d2 00             	adc    $0x0,%edx
+  8045f5:	f7 da                	neg    %edx
+  8045f7:	85 db                	test   %ebx,%ebx
+  8045f9:	78 3a                	js     804635 <__divdi3+0x76>
+  8045fb:	83 ec 04             	sub    $0x4,%esp
+  8045fe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804602:	56                   	push   %esi
+  804603:	53                   	push   %ebx
+  804604:	51                   	push   %ecx
+  804605:	e8 86 fe ff ff       	call   804490 <udm>
+  80460a:	83 c4 10             	add    $0x10,%esp
+  80460d:	f7 d8                	neg    %eax
+  80460f:	83 d2 00             	adc    $0x0,%edx
+  804612:	f7 da                	neg    %edx
+  804614:	83 c4 14             	add    $0x14,%esp
+  804617:	5b                   	pop    %ebx
+  804618:	5e                   	pop    %esi
+  804619:	c3                   	ret
+  80461a:	83 ec 04             	sub    $0x4,%esp
+  80461d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804621:	56                   	push   %esi
+  804622:	f7 d9                	neg    %ecx
+  804624:	83 d3 00             	adc    $0x0,%ebx
+  804627:	f7 db                	neg    %ebx
+  804629:	53                   	push   %ebx
+  80462a:	51                   	push   %ecx
+  80462b:	e8 60 fe ff ff       	call   804490 <udm>
+  804630:	83 c4 10             	add    $0x10,%esp
+  804633:	eb d8                	jmp    80460d <__divdi3+0x4e>
+  804635:	83 ec 04             	sub    $0x4,%esp
+  804638:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80463c:	56                   	push   %esi
+  80463d:	f7 d9                	neg    %ecx
+  80463f:	83 d3 00             	adc    $0x0,%ebx
+  804642:	f7 db                	neg    %ebx
+  804644:	53                   	push   %ebx
+  804645:	51                   	push   %ecx
+  804646:	e8 45 fe ff ff       	call   804490 <udm>
+  80464b:	83 c4 10             	add    $0x10,%esp
+  80464e:	eb c4                	jmp    804614 <__divdi3+0x55>
+
+00804650 <__moddi3>:
+  804650:	55                   	push   %ebp
+  804651:	57                   	push   %edi
+  804652:	56                   	push   %esi
+  804653:	53                   	push   %ebx
+  804654:	83 ec 24             	sub    $0x24,%esp
+  804657:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80465b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80465f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804663:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804667:	85 d2                	test   %edx,%edx
+  804669:	78 3b                	js     8046a6 <__moddi3+0x56>
+  80466b:	83 ec 04             	sub    $0x4,%esp
+  80466e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804672:	56                   	push   %esi
+  804673:	89 ce                	mov    %ecx,%esi
+  804675:	f7 de                	neg    %esi
+  804677:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80467b:	89 de                	mov    %ebx,%esi
+  80467d:	83 d6 00             	adc    $0x0,%esi
+  804680:	f7 de                	neg    %esi
+  804682:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804686:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80468a:	0f 48 f1             	cmovs  %ecx,%esi
+  80468d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804692:	53                   	push   %ebx
+  804693:	56                   	push   %esi
+  804694:	e8 f7 fd ff ff       	call   804490 <udm>
+  804699:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80469d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046a1:	83 c4 10             	add    $0x10,%esp
+  8046a4:	eb 47                	jmp    8046ed <__moddi3+0x9d>
+  8046a6:	f7 d8                	neg    %eax
+  8046a8:	83 d2 00             	adc    $0x0,%edx
+  8046ab:	f7 da                	neg    %edx
+  8046ad:	83 ec 04             	sub    $0x4,%esp
+  8046b0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046b4:	56                   	push   %esi
+  8046b5:	89 cf                	mov    %ecx,%edi
+  8046b7:	f7 df                	neg    %edi
+  8046b9:	89 de                	mov    %ebx,%esi
+  8046bb:	83 d6 00             	adc    $0x0,%esi
+  8046be:	f7 de                	neg    %esi
+  8046c0:	0f 49 cf             	cmovns %edi,%ecx
+  8046c3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046c7:	0f 49 de             	cmovns %esi,%ebx
+  8046ca:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046ce:	ff 74 24 0c          	push   0xc(%esp)
+  8046d2:	ff 74 24 0c          	push   0xc(%esp)
+  8046d6:	e8 b5 fd ff ff       	call   804490 <udm>
+  8046db:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046df:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046e3:	f7 d8                	neg    %eax
+  8046e5:	83 d2 00             	adc    $0x0,%edx
+  8046e8:	f7 da                	neg    %edx
+  8046ea:	83 c4 10             	add    $0x10,%esp
+  8046ed:	83 c4 24             	add    $0x24,%esp
+  8046f0:	5b                   	pop    %ebx
+  8046f1:	5e                   	pop    %esi
+  8046f2:	5f                   	pop    %edi
+  8046f3:	5d                   	pop    %ebp
+  8046f4:	c3                   	ret
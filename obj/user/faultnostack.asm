@@ -0,0 +1,9690 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 93 06 80 00       	push   $0x800693
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 29 03 00 00       	call   80036e <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	57                   	push   %edi
+  800058:	56                   	push   %esi
+  800059:	53                   	push   %ebx
+  80005a:	83 ec 1c             	sub    $0x1c,%esp
+  80005d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800060:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800063:	e8 31 01 00 00       	call   800199 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800068:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80006b:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800071:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800076:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800078:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80007a:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800080:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800085:	77 16                	ja     80009d <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800087:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80008c:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80008e:	c1 e8 10             	shr    $0x10,%eax
+  800091:	74 0a                	je     80009d <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800093:	c1 e0 10             	shl    $0x10,%eax
+  800096:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80009b:	29 c2                	sub    %eax,%edx
+  80009d:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000a0:	c1 e0 04             	shl    $0x4,%eax
+  8000a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a8:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000aa:	85 db                	test   %ebx,%ebx
+  8000ac:	7e 07                	jle    8000b5 <libmain+0x61>
+		binaryname = argv[0];
+  8000ae:	8b 06                	mov    (%esi),%eax
+  8000b0:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b5:	83 ec 08             	sub    $0x8,%esp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	e8 74 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000bf:	e8 0b 00 00 00       	call   8000cf <exit>
+}
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  8000c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ca:	5b                   	pop    %ebx
+  8000cb:	5e                   	pop    %esi
+  8000cc:	5f                   	pop    %edi
+  8000cd:	5d                   	pop    %ebp
+  8000ce:	c3                   	ret
+
+008000cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000cf:	55                   	push   %ebp
+  8000d0:	89 e5                	mov    %esp,%ebp
+  8000d2:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000d5:	6a 00                	push   $0x0
+  8000d7:	e8 38 17 00 00       	call   801814 <fflush>
+	pthread_kill_others();
+  8000dc:	e8 a3 2d 00 00       	call   802e84 <pthread_kill_others>
+	close_all();
+  8000e1:	e8 d1 07 00 00       	call   8008b7 <close_all>
+	sys_env_destroy(0);
+  8000e6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000ed:	e8 5c 00 00 00       	call   80014e <sys_env_destroy>
+}
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	c9                   	leave
+  8000f6:	c3                   	ret
+
+008000f7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	57                   	push   %edi
+  8000fb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	8b 55 08             	mov    0x8(%ebp),%edx
+  800104:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800107:	89 c3                	mov    %eax,%ebx
+  800109:	89 c7                	mov    %eax,%edi
+  80010b:	6a 00                	push   $0x0
+  80010d:	55                   	push   %ebp
+  80010e:	56                   	push   %esi
+  80010f:	89 e5                	mov    %esp,%ebp
+  800111:	8d 35 19 01 80 00    	lea    0x800119,%esi
+  800117:	0f 34                	sysenter
+
+00800119 <after_sysenter_label_47>:
+  800119:	5e                   	pop    %esi
+  80011a:	5d                   	pop    %ebp
+  80011b:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80011e:	5b                   	pop    %ebx
+  80011f:	5f                   	pop    %edi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+
+00800122 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	57                   	push   %edi
+  800126:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800131:	89 d1                	mov    %edx,%ecx
+  800133:	89 d3                	mov    %edx,%ebx
+  800135:	89 d7                	mov    %edx,%edi
+  800137:	6a 00                	push   $0x0
+  800139:	55                   	push   %ebp
+  80013a:	56                   	push   %esi
+  80013b:	89 e5                	mov    %esp,%ebp
+  80013d:	8d 35 45 01 80 00    	lea    0x800145,%esi
+  800143:	0f 34                	sysenter
+
+00800145 <after_sysenter_label_128>:
+  800145:	5e                   	pop    %esi
+  800146:	5d                   	pop    %ebp
+  800147:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80014a:	5b                   	pop    %ebx
+  80014b:	5f                   	pop    %edi
+  80014c:	5d                   	pop    %ebp
+  80014d:	c3                   	ret
+
+0080014e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	57                   	push   %edi
+  800152:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800153:	8b 55 08             	mov    0x8(%ebp),%edx
+  800156:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80015b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800160:	89 cb                	mov    %ecx,%ebx
+  800162:	89 cf                	mov    %ecx,%edi
+  800164:	6a 00                	push   $0x0
+  800166:	55                   	push   %ebp
+  800167:	56                   	push   %esi
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	8d 35 72 01 80 00    	lea    0x800172,%esi
+  800170:	0f 34                	sysenter
+
+00800172 <after_sysenter_label_212>:
+  800172:	5e                   	pop    %esi
+  800173:	5d                   	pop    %ebp
+  800174:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800177:	85 c0                	test   %eax,%eax
+  800179:	7f 07                	jg     800182 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80017b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80017e:	5b                   	pop    %ebx
+  80017f:	5f                   	pop    %edi
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800182:	83 ec 0c             	sub    $0xc,%esp
+  800185:	50                   	push   %eax
+  800186:	6a 03                	push   $0x3
+  800188:	68 ea 46 80 00       	push   $0x8046ea
+  80018d:	6a 54                	push   $0x54
+  80018f:	68 07 47 80 00       	push   $0x804707
+  800194:	e8 5e 30 00 00       	call   8031f7 <_panic>
+
+00800199 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	57                   	push   %edi
+  80019d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80019e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8001a8:	89 d1                	mov    %edx,%ecx
+  8001aa:	89 d3                	mov    %edx,%ebx
+  8001ac:	89 d7                	mov    %edx,%edi
+  8001ae:	6a 00                	push   $0x0
+  8001b0:	55                   	push   %ebp
+  8001b1:	56                   	push   %esi
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	8d 35 bc 01 80 00    	lea    0x8001bc,%esi
+  8001ba:	0f 34                	sysenter
+
+008001bc <after_sysenter_label_309>:
+  8001bc:	5e                   	pop    %esi
+  8001bd:	5d                   	pop    %ebp
+  8001be:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001c1:	5b                   	pop    %ebx
+  8001c2:	5f                   	pop    %edi
+  8001c3:	5d                   	pop    %ebp
+  8001c4:	c3                   	ret
+
+008001c5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001c5:	55                   	push   %ebp
+  8001c6:	89 e5                	mov    %esp,%ebp
+  8001c8:	57                   	push   %edi
+  8001c9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001d4:	89 d1                	mov    %edx,%ecx
+  8001d6:	89 d3                	mov    %edx,%ebx
+  8001d8:	89 d7                	mov    %edx,%edi
+  8001da:	6a 00                	push   $0x0
+  8001dc:	55                   	push   %ebp
+  8001dd:	56                   	push   %esi
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	8d 35 e8 01 80 00    	lea    0x8001e8,%esi
+  8001e6:	0f 34                	sysenter
+
+008001e8 <after_sysenter_label_391>:
+  8001e8:	5e                   	pop    %esi
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001ed:	5b                   	pop    %ebx
+  8001ee:	5f                   	pop    %edi
+  8001ef:	5d                   	pop    %ebp
+  8001f0:	c3                   	ret
+
+008001f1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	57                   	push   %edi
+  8001f5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800201:	bf 00 00 00 00       	mov    $0x0,%edi
+  800206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800209:	6a 00                	push   $0x0
+  80020b:	55                   	push   %ebp
+  80020c:	56                   	push   %esi
+  80020d:	89 e5                	mov    %esp,%ebp
+  80020f:	8d 35 17 02 80 00    	lea    0x800217,%esi
+  800215:	0f 34                	sysenter
+
+00800217 <after_sysenter_label_479>:
+  800217:	5e                   	pop    %esi
+  800218:	5d                   	pop    %ebp
+  800219:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80021c:	85 c0                	test   %eax,%eax
+  80021e:	7f 07                	jg     800227 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800220:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800223:	5b                   	pop    %ebx
+  800224:	5f                   	pop    %edi
+  800225:	5d                   	pop    %ebp
+  800226:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800227:	83 ec 0c             	sub    $0xc,%esp
+  80022a:	50                   	push   %eax
+  80022b:	6a 04                	push   $0x4
+  80022d:	68 ea 46 80 00       	push   $0x8046ea
+  800232:	6a 54                	push   $0x54
+  800234:	68 07 47 80 00       	push   $0x804707
+  800239:	e8 b9 2f 00 00       	call   8031f7 <_panic>
+
+0080023e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	57                   	push   %edi
+  800242:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800243:	8b 55 08             	mov    0x8(%ebp),%edx
+  800246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800249:	b8 05 00 00 00       	mov    $0x5,%eax
+  80024e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800251:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800254:	ff 75 18             	push   0x18(%ebp)
+  800257:	55                   	push   %ebp
+  800258:	56                   	push   %esi
+  800259:	89 e5                	mov    %esp,%ebp
+  80025b:	8d 35 63 02 80 00    	lea    0x800263,%esi
+  800261:	0f 34                	sysenter
+
+00800263 <after_sysenter_label_593>:
+  800263:	5e                   	pop    %esi
+  800264:	5d                   	pop    %ebp
+  800265:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800268:	85 c0                	test   %eax,%eax
+  80026a:	7f 07                	jg     800273 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80026c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80026f:	5b                   	pop    %ebx
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800273:	83 ec 0c             	sub    $0xc,%esp
+  800276:	50                   	push   %eax
+  800277:	6a 05                	push   $0x5
+  800279:	68 ea 46 80 00       	push   $0x8046ea
+  80027e:	6a 54                	push   $0x54
+  800280:	68 07 47 80 00       	push   $0x804707
+  800285:	e8 6d 2f 00 00       	call   8031f7 <_panic>
+
+0080028a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	57                   	push   %edi
+  80028e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80028f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800294:	8b 55 08             	mov    0x8(%ebp),%edx
+  800297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80029a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80029f:	89 df                	mov    %ebx,%edi
+  8002a1:	6a 00                	push   $0x0
+  8002a3:	55                   	push   %ebp
+  8002a4:	56                   	push   %esi
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	8d 35 af 02 80 00    	lea    0x8002af,%esi
+  8002ad:	0f 34                	sysenter
+
+008002af <after_sysenter_label_704>:
+  8002af:	5e                   	pop    %esi
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002b4:	85 c0                	test   %eax,%eax
+  8002b6:	7f 07                	jg     8002bf <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002bb:	5b                   	pop    %ebx
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002bf:	83 ec 0c             	sub    $0xc,%esp
+  8002c2:	50                   	push   %eax
+  8002c3:	6a 06                	push   $0x6
+  8002c5:	68 ea 46 80 00       	push   $0x8046ea
+  8002ca:	6a 54                	push   $0x54
+  8002cc:	68 07 47 80 00       	push   $0x804707
+  8002d1:	e8 21 2f 00 00       	call   8031f7 <_panic>
+
+008002d6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	57                   	push   %edi
+  8002da:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002eb:	89 df                	mov    %ebx,%edi
+  8002ed:	6a 00                	push   $0x0
+  8002ef:	55                   	push   %ebp
+  8002f0:	56                   	push   %esi
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	8d 35 fb 02 80 00    	lea    0x8002fb,%esi
+  8002f9:	0f 34                	sysenter
+
+008002fb <after_sysenter_label_808>:
+  8002fb:	5e                   	pop    %esi
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800300:	85 c0                	test   %eax,%eax
+  800302:	7f 07                	jg     80030b <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800307:	5b                   	pop    %ebx
+  800308:	5f                   	pop    %edi
+  800309:	5d                   	pop    %ebp
+  80030a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	50                   	push   %eax
+  80030f:	6a 08                	push   $0x8
+  800311:	68 ea 46 80 00       	push   $0x8046ea
+  800316:	6a 54                	push   $0x54
+  800318:	68 07 47 80 00       	push   $0x804707
+  80031d:	e8 d5 2e 00 00       	call   8031f7 <_panic>
+
+00800322 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800322:	55                   	push   %ebp
+  800323:	89 e5                	mov    %esp,%ebp
+  800325:	57                   	push   %edi
+  800326:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80032c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800332:	b8 09 00 00 00       	mov    $0x9,%eax
+  800337:	89 df                	mov    %ebx,%edi
+  800339:	6a 00                	push   $0x0
+  80033b:	55                   	push   %ebp
+  80033c:	56                   	push   %esi
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	8d 35 47 03 80 00    	lea    0x800347,%esi
+  800345:	0f 34                	sysenter
+
+00800347 <after_sysenter_label_912>:
+  800347:	5e                   	pop    %esi
+  800348:	5d                   	pop    %ebp
+  800349:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80034c:	85 c0                	test   %eax,%eax
+  80034e:	7f 07                	jg     800357 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800350:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800353:	5b                   	pop    %ebx
+  800354:	5f                   	pop    %edi
+  800355:	5d                   	pop    %ebp
+  800356:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800357:	83 ec 0c             	sub    $0xc,%esp
+  80035a:	50                   	push   %eax
+  80035b:	6a 09                	push   $0x9
+  80035d:	68 ea 46 80 00       	push   $0x8046ea
+  800362:	6a 54                	push   $0x54
+  800364:	68 07 47 80 00       	push   $0x804707
+  800369:	e8 89 2e 00 00       	call   8031f7 <_panic>
+
+0080036e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80036e:	55                   	push   %ebp
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	57                   	push   %edi
+  800372:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800373:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800383:	89 df                	mov    %ebx,%edi
+  800385:	6a 00                	push   $0x0
+  800387:	55                   	push   %ebp
+  800388:	56                   	push   %esi
+  800389:	89 e5                	mov    %esp,%ebp
+  80038b:	8d 35 93 03 80 00    	lea    0x800393,%esi
+  800391:	0f 34                	sysenter
+
+00800393 <after_sysenter_label_1016>:
+  800393:	5e                   	pop    %esi
+  800394:	5d                   	pop    %ebp
+  800395:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800398:	85 c0                	test   %eax,%eax
+  80039a:	7f 07                	jg     8003a3 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80039c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80039f:	5b                   	pop    %ebx
+  8003a0:	5f                   	pop    %edi
+  8003a1:	5d                   	pop    %ebp
+  8003a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a3:	83 ec 0c             	sub    $0xc,%esp
+  8003a6:	50                   	push   %eax
+  8003a7:	6a 0a                	push   $0xa
+  8003a9:	68 ea 46 80 00       	push   $0x8046ea
+  8003ae:	6a 54                	push   $0x54
+  8003b0:	68 07 47 80 00       	push   $0x804707
+  8003b5:	e8 3d 2e 00 00       	call   8031f7 <_panic>
+
+008003ba <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003ba:	55                   	push   %ebp
+  8003bb:	89 e5                	mov    %esp,%ebp
+  8003bd:	57                   	push   %edi
+  8003be:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003d0:	6a 00                	push   $0x0
+  8003d2:	55                   	push   %ebp
+  8003d3:	56                   	push   %esi
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	8d 35 de 03 80 00    	lea    0x8003de,%esi
+  8003dc:	0f 34                	sysenter
+
+008003de <after_sysenter_label_1126>:
+  8003de:	5e                   	pop    %esi
+  8003df:	5d                   	pop    %ebp
+  8003e0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003e3:	5b                   	pop    %ebx
+  8003e4:	5f                   	pop    %edi
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+
+008003e7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	57                   	push   %edi
+  8003eb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003f9:	89 cb                	mov    %ecx,%ebx
+  8003fb:	89 cf                	mov    %ecx,%edi
+  8003fd:	6a 00                	push   $0x0
+  8003ff:	55                   	push   %ebp
+  800400:	56                   	push   %esi
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	8d 35 0b 04 80 00    	lea    0x80040b,%esi
+  800409:	0f 34                	sysenter
+
+0080040b <after_sysenter_label_1210>:
+  80040b:	5e                   	pop    %esi
+  80040c:	5d                   	pop    %ebp
+  80040d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800410:	85 c0                	test   %eax,%eax
+  800412:	7f 07                	jg     80041b <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800417:	5b                   	pop    %ebx
+  800418:	5f                   	pop    %edi
+  800419:	5d                   	pop    %ebp
+  80041a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80041b:	83 ec 0c             	sub    $0xc,%esp
+  80041e:	50                   	push   %eax
+  80041f:	6a 0d                	push   $0xd
+  800421:	68 ea 46 80 00       	push   $0x8046ea
+  800426:	6a 54                	push   $0x54
+  800428:	68 07 47 80 00       	push   $0x804707
+  80042d:	e8 c5 2d 00 00       	call   8031f7 <_panic>
+
+00800432 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	57                   	push   %edi
+  800436:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800437:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800442:	b8 42 00 00 00       	mov    $0x42,%eax
+  800447:	89 df                	mov    %ebx,%edi
+  800449:	6a 00                	push   $0x0
+  80044b:	55                   	push   %ebp
+  80044c:	56                   	push   %esi
+  80044d:	89 e5                	mov    %esp,%ebp
+  80044f:	8d 35 57 04 80 00    	lea    0x800457,%esi
+  800455:	0f 34                	sysenter
+
+00800457 <after_sysenter_label_1311>:
+  800457:	5e                   	pop    %esi
+  800458:	5d                   	pop    %ebp
+  800459:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80045c:	85 c0                	test   %eax,%eax
+  80045e:	7f 07                	jg     800467 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800460:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800463:	5b                   	pop    %ebx
+  800464:	5f                   	pop    %edi
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800467:	83 ec 0c             	sub    $0xc,%esp
+  80046a:	50                   	push   %eax
+  80046b:	6a 42                	push   $0x42
+  80046d:	68 ea 46 80 00       	push   $0x8046ea
+  800472:	6a 54                	push   $0x54
+  800474:	68 07 47 80 00       	push   $0x804707
+  800479:	e8 79 2d 00 00       	call   8031f7 <_panic>
+
+0080047e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+  800481:	57                   	push   %edi
+  800482:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800483:	ba 00 00 00 00       	mov    $0x0,%edx
+  800488:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80048d:	89 d1                	mov    %edx,%ecx
+  80048f:	89 d3                	mov    %edx,%ebx
+  800491:	89 d7                	mov    %edx,%edi
+  800493:	6a 00                	push   $0x0
+  800495:	55                   	push   %ebp
+  800496:	56                   	push   %esi
+  800497:	89 e5                	mov    %esp,%ebp
+  800499:	8d 35 a1 04 80 00    	lea    0x8004a1,%esi
+  80049f:	0f 34                	sysenter
+
+008004a1 <after_sysenter_label_1411>:
+  8004a1:	5e                   	pop    %esi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004a6:	5b                   	pop    %ebx
+  8004a7:	5f                   	pop    %edi
+  8004a8:	5d                   	pop    %ebp
+  8004a9:	c3                   	ret
+
+008004aa <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8004aa:	55                   	push   %ebp
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	57                   	push   %edi
+  8004ae:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ba:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004bf:	89 df                	mov    %ebx,%edi
+  8004c1:	6a 00                	push   $0x0
+  8004c3:	55                   	push   %ebp
+  8004c4:	56                   	push   %esi
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	8d 35 cf 04 80 00    	lea    0x8004cf,%esi
+  8004cd:	0f 34                	sysenter
+
+008004cf <after_sysenter_label_1497>:
+  8004cf:	5e                   	pop    %esi
+  8004d0:	5d                   	pop    %ebp
+  8004d1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004d4:	5b                   	pop    %ebx
+  8004d5:	5f                   	pop    %edi
+  8004d6:	5d                   	pop    %ebp
+  8004d7:	c3                   	ret
+
+008004d8 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	57                   	push   %edi
+  8004dc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004ed:	89 df                	mov    %ebx,%edi
+  8004ef:	6a 00                	push   $0x0
+  8004f1:	55                   	push   %ebp
+  8004f2:	56                   	push   %esi
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	8d 35 fd 04 80 00    	lea    0x8004fd,%esi
+  8004fb:	0f 34                	sysenter
+
+008004fd <after_sysenter_label_1583>:
+  8004fd:	5e                   	pop    %esi
+  8004fe:	5d                   	pop    %ebp
+  8004ff:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800502:	5b                   	pop    %ebx
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+
+00800506 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80050b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800511:	b8 11 00 00 00       	mov    $0x11,%eax
+  800516:	bf 00 00 00 00       	mov    $0x0,%edi
+  80051b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051e:	6a 00                	push   $0x0
+  800520:	55                   	push   %ebp
+  800521:	56                   	push   %esi
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	8d 35 2c 05 80 00    	lea    0x80052c,%esi
+  80052a:	0f 34                	sysenter
+
+0080052c <after_sysenter_label_1672>:
+  80052c:	5e                   	pop    %esi
+  80052d:	5d                   	pop    %ebp
+  80052e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800531:	5b                   	pop    %ebx
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+
+00800535 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800535:	55                   	push   %ebp
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	57                   	push   %edi
+  800539:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80053a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80053f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800545:	b8 12 00 00 00       	mov    $0x12,%eax
+  80054a:	89 df                	mov    %ebx,%edi
+  80054c:	6a 00                	push   $0x0
+  80054e:	55                   	push   %ebp
+  80054f:	56                   	push   %esi
+  800550:	89 e5                	mov    %esp,%ebp
+  800552:	8d 35 5a 05 80 00    	lea    0x80055a,%esi
+  800558:	0f 34                	sysenter
+
+0080055a <after_sysenter_label_1758>:
+  80055a:	5e                   	pop    %esi
+  80055b:	5d                   	pop    %ebp
+  80055c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80055f:	5b                   	pop    %ebx
+  800560:	5f                   	pop    %edi
+  800561:	5d                   	pop    %ebp
+  800562:	c3                   	ret
+
+00800563 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800563:	55                   	push   %ebp
+  800564:	89 e5                	mov    %esp,%ebp
+  800566:	57                   	push   %edi
+  800567:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800570:	b8 13 00 00 00       	mov    $0x13,%eax
+  800575:	89 cb                	mov    %ecx,%ebx
+  800577:	89 cf                	mov    %ecx,%edi
+  800579:	6a 00                	push   $0x0
+  80057b:	55                   	push   %ebp
+  80057c:	56                   	push   %esi
+  80057d:	89 e5                	mov    %esp,%ebp
+  80057f:	8d 35 87 05 80 00    	lea    0x800587,%esi
+  800585:	0f 34                	sysenter
+
+00800587 <after_sysenter_label_1842>:
+  800587:	5e                   	pop    %esi
+  800588:	5d                   	pop    %ebp
+  800589:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80058c:	85 c0                	test   %eax,%eax
+  80058e:	7f 07                	jg     800597 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800593:	5b                   	pop    %ebx
+  800594:	5f                   	pop    %edi
+  800595:	5d                   	pop    %ebp
+  800596:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800597:	83 ec 0c             	sub    $0xc,%esp
+  80059a:	50                   	push   %eax
+  80059b:	6a 13                	push   $0x13
+  80059d:	68 ea 46 80 00       	push   $0x8046ea
+  8005a2:	6a 54                	push   $0x54
+  8005a4:	68 07 47 80 00       	push   $0x804707
+  8005a9:	e8 49 2c 00 00       	call   8031f7 <_panic>
+
+008005ae <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8005ae:	55                   	push   %ebp
+  8005af:	89 e5                	mov    %esp,%ebp
+  8005b1:	57                   	push   %edi
+  8005b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005bd:	89 d1                	mov    %edx,%ecx
+  8005bf:	89 d3                	mov    %edx,%ebx
+  8005c1:	89 d7                	mov    %edx,%edi
+  8005c3:	6a 00                	push   $0x0
+  8005c5:	55                   	push   %ebp
+  8005c6:	56                   	push   %esi
+  8005c7:	89 e5                	mov    %esp,%ebp
+  8005c9:	8d 35 d1 05 80 00    	lea    0x8005d1,%esi
+  8005cf:	0f 34                	sysenter
+
+008005d1 <after_sysenter_label_1939>:
+  8005d1:	5e                   	pop    %esi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005d6:	5b                   	pop    %ebx
+  8005d7:	5f                   	pop    %edi
+  8005d8:	5d                   	pop    %ebp
+  8005d9:	c3                   	ret
+
+008005da <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005da:	55                   	push   %ebp
+  8005db:	89 e5                	mov    %esp,%ebp
+  8005dd:	57                   	push   %edi
+  8005de:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005f2:	6a 00                	push   $0x0
+  8005f4:	55                   	push   %ebp
+  8005f5:	56                   	push   %esi
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	8d 35 00 06 80 00    	lea    0x800600,%esi
+  8005fe:	0f 34                	sysenter
+
+00800600 <after_sysenter_label_2028>:
+  800600:	5e                   	pop    %esi
+  800601:	5d                   	pop    %ebp
+  800602:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800605:	5b                   	pop    %ebx
+  800606:	5f                   	pop    %edi
+  800607:	5d                   	pop    %ebp
+  800608:	c3                   	ret
+
+00800609 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	57                   	push   %edi
+  80060d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80060e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800613:	8b 55 08             	mov    0x8(%ebp),%edx
+  800616:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800619:	b8 16 00 00 00       	mov    $0x16,%eax
+  80061e:	89 df                	mov    %ebx,%edi
+  800620:	6a 00                	push   $0x0
+  800622:	55                   	push   %ebp
+  800623:	56                   	push   %esi
+  800624:	89 e5                	mov    %esp,%ebp
+  800626:	8d 35 2e 06 80 00    	lea    0x80062e,%esi
+  80062c:	0f 34                	sysenter
+
+0080062e <after_sysenter_label_2114>:
+  80062e:	5e                   	pop    %esi
+  80062f:	5d                   	pop    %ebp
+  800630:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800633:	5b                   	pop    %ebx
+  800634:	5f                   	pop    %edi
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+
+00800637 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	57                   	push   %edi
+  80063b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80063c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800641:	8b 55 08             	mov    0x8(%ebp),%edx
+  800644:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800647:	b8 17 00 00 00       	mov    $0x17,%eax
+  80064c:	89 df                	mov    %ebx,%edi
+  80064e:	6a 00                	push   $0x0
+  800650:	55                   	push   %ebp
+  800651:	56                   	push   %esi
+  800652:	89 e5                	mov    %esp,%ebp
+  800654:	8d 35 5c 06 80 00    	lea    0x80065c,%esi
+  80065a:	0f 34                	sysenter
+
+0080065c <after_sysenter_label_2200>:
+  80065c:	5e                   	pop    %esi
+  80065d:	5d                   	pop    %ebp
+  80065e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800661:	5b                   	pop    %ebx
+  800662:	5f                   	pop    %edi
+  800663:	5d                   	pop    %ebp
+  800664:	c3                   	ret
+
+00800665 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	57                   	push   %edi
+  800669:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80066a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800672:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800675:	b8 18 00 00 00       	mov    $0x18,%eax
+  80067a:	89 df                	mov    %ebx,%edi
+  80067c:	6a 00                	push   $0x0
+  80067e:	55                   	push   %ebp
+  80067f:	56                   	push   %esi
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	8d 35 8a 06 80 00    	lea    0x80068a,%esi
+  800688:	0f 34                	sysenter
+
+0080068a <after_sysenter_label_2286>:
+  80068a:	5e                   	pop    %esi
+  80068b:	5d                   	pop    %ebp
+  80068c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80068f:	5b                   	pop    %ebx
+  800690:	5f                   	pop    %edi
+  800691:	5d                   	pop    %ebp
+  800692:	c3                   	ret
+
+00800693 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800693:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800694:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  800699:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80069b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80069e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8006a2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8006a6:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8006a9:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8006ad:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8006af:	83 c4 08             	add    $0x8,%esp
+	popal
+  8006b2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8006b3:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8006b6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8006b7:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8006b8:	c3                   	ret
+
+008006b9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006bf:	05 00 00 00 30       	add    $0x30000000,%eax
+  8006c4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8006c7:	5d                   	pop    %ebp
+  8006c8:	c3                   	ret
+
+008006c9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8006c9:	55                   	push   %ebp
+  8006ca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006cf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8006d4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8006d9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006de:	5d                   	pop    %ebp
+  8006df:	c3                   	ret
+
+008006e0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006e0:	55                   	push   %ebp
+  8006e1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006e3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006e8:	eb 02                	jmp    8006ec <fd_alloc+0xc>
+  8006ea:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006ec:	89 c2                	mov    %eax,%edx
+  8006ee:	c1 ea 16             	shr    $0x16,%edx
+  8006f1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006f8:	f6 c2 01             	test   $0x1,%dl
+  8006fb:	74 2b                	je     800728 <fd_alloc+0x48>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	c1 ea 0c             	shr    $0xc,%edx
+  800702:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800709:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80070f:	f6 c1 01             	test   $0x1,%cl
+  800712:	74 14                	je     800728 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800714:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80071a:	75 ce                	jne    8006ea <fd_alloc+0xa>
+  80071c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800721:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800726:	eb 05                	jmp    80072d <fd_alloc+0x4d>
+			return 0;
+  800728:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80072d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800730:	89 02                	mov    %eax,(%edx)
+}
+  800732:	89 c8                	mov    %ecx,%eax
+  800734:	5d                   	pop    %ebp
+  800735:	c3                   	ret
+
+00800736 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800736:	55                   	push   %ebp
+  800737:	89 e5                	mov    %esp,%ebp
+  800739:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80073c:	83 f8 1f             	cmp    $0x1f,%eax
+  80073f:	77 30                	ja     800771 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800741:	c1 e0 0c             	shl    $0xc,%eax
+  800744:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800749:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80074f:	f6 c2 01             	test   $0x1,%dl
+  800752:	74 24                	je     800778 <fd_lookup+0x42>
+  800754:	89 c2                	mov    %eax,%edx
+  800756:	c1 ea 0c             	shr    $0xc,%edx
+  800759:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800760:	f6 c2 01             	test   $0x1,%dl
+  800763:	74 1a                	je     80077f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800765:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800768:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80076a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+		return -E_INVAL;
+  800771:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800776:	eb f7                	jmp    80076f <fd_lookup+0x39>
+		return -E_INVAL;
+  800778:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80077d:	eb f0                	jmp    80076f <fd_lookup+0x39>
+  80077f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800784:	eb e9                	jmp    80076f <fd_lookup+0x39>
+
+00800786 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800786:	55                   	push   %ebp
+  800787:	89 e5                	mov    %esp,%ebp
+  800789:	53                   	push   %ebx
+  80078a:	83 ec 04             	sub    $0x4,%esp
+  80078d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800790:	b8 00 00 00 00       	mov    $0x0,%eax
+  800795:	eb 03                	jmp    80079a <dev_lookup+0x14>
+  800797:	83 c0 01             	add    $0x1,%eax
+  80079a:	8b 1c 85 94 47 80 00 	mov    0x804794(,%eax,4),%ebx
+  8007a1:	85 db                	test   %ebx,%ebx
+  8007a3:	74 0b                	je     8007b0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8007a5:	39 13                	cmp    %edx,(%ebx)
+  8007a7:	75 ee                	jne    800797 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	eb 49                	jmp    8007f9 <dev_lookup+0x73>
+  8007b0:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8007b2:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8007b8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8007bd:	77 18                	ja     8007d7 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8007bf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8007c4:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8007c6:	c1 e8 10             	shr    $0x10,%eax
+  8007c9:	74 0c                	je     8007d7 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8007cb:	c1 e0 10             	shl    $0x10,%eax
+  8007ce:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8007d3:	29 c1                	sub    %eax,%ecx
+  8007d5:	eb 06                	jmp    8007dd <dev_lookup+0x57>
+		return pthread_main_tls;
+  8007d7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007dd:	8b 01                	mov    (%ecx),%eax
+  8007df:	8b 40 48             	mov    0x48(%eax),%eax
+  8007e2:	83 ec 04             	sub    $0x4,%esp
+  8007e5:	52                   	push   %edx
+  8007e6:	50                   	push   %eax
+  8007e7:	68 18 47 80 00       	push   $0x804718
+  8007ec:	e8 e1 2a 00 00       	call   8032d2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007fc:	89 1a                	mov    %ebx,(%edx)
+}
+  8007fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800801:	c9                   	leave
+  800802:	c3                   	ret
+
+00800803 <fd_close>:
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	57                   	push   %edi
+  800807:	56                   	push   %esi
+  800808:	53                   	push   %ebx
+  800809:	83 ec 24             	sub    $0x24,%esp
+  80080c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80080f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800812:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800815:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800816:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80081c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80081f:	50                   	push   %eax
+  800820:	e8 11 ff ff ff       	call   800736 <fd_lookup>
+  800825:	89 c3                	mov    %eax,%ebx
+  800827:	83 c4 10             	add    $0x10,%esp
+  80082a:	85 c0                	test   %eax,%eax
+  80082c:	78 05                	js     800833 <fd_close+0x30>
+	    || fd != fd2)
+  80082e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800831:	74 16                	je     800849 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800833:	89 f8                	mov    %edi,%eax
+  800835:	84 c0                	test   %al,%al
+  800837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80083f:	89 d8                	mov    %ebx,%eax
+  800841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800844:	5b                   	pop    %ebx
+  800845:	5e                   	pop    %esi
+  800846:	5f                   	pop    %edi
+  800847:	5d                   	pop    %ebp
+  800848:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800849:	83 ec 08             	sub    $0x8,%esp
+  80084c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80084f:	50                   	push   %eax
+  800850:	ff 36                	push   (%esi)
+  800852:	e8 2f ff ff ff       	call   800786 <dev_lookup>
+  800857:	89 c3                	mov    %eax,%ebx
+  800859:	83 c4 10             	add    $0x10,%esp
+  80085c:	85 c0                	test   %eax,%eax
+  80085e:	78 1a                	js     80087a <fd_close+0x77>
+		if (dev->dev_close)
+  800860:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800863:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800866:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	74 0b                	je     80087a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80086f:	83 ec 0c             	sub    $0xc,%esp
+  800872:	56                   	push   %esi
+  800873:	ff d0                	call   *%eax
+  800875:	89 c3                	mov    %eax,%ebx
+  800877:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80087a:	83 ec 08             	sub    $0x8,%esp
+  80087d:	56                   	push   %esi
+  80087e:	6a 00                	push   $0x0
+  800880:	e8 05 fa ff ff       	call   80028a <sys_page_unmap>
+	return r;
+  800885:	83 c4 10             	add    $0x10,%esp
+  800888:	eb b5                	jmp    80083f <fd_close+0x3c>
+
+0080088a <close>:
+
+int
+close(int fdnum)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800890:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800893:	50                   	push   %eax
+  800894:	ff 75 08             	push   0x8(%ebp)
+  800897:	e8 9a fe ff ff       	call   800736 <fd_lookup>
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	85 c0                	test   %eax,%eax
+  8008a1:	79 02                	jns    8008a5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008a3:	c9                   	leave
+  8008a4:	c3                   	ret
+		return fd_close(fd, 1);
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+  8008a8:	6a 01                	push   $0x1
+  8008aa:	ff 75 f4             	push   -0xc(%ebp)
+  8008ad:	e8 51 ff ff ff       	call   800803 <fd_close>
+  8008b2:	83 c4 10             	add    $0x10,%esp
+  8008b5:	eb ec                	jmp    8008a3 <close+0x19>
+
+008008b7 <close_all>:
+
+void
+close_all(void)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	53                   	push   %ebx
+  8008bb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8008be:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8008c3:	83 ec 0c             	sub    $0xc,%esp
+  8008c6:	53                   	push   %ebx
+  8008c7:	e8 be ff ff ff       	call   80088a <close>
+	for (i = 0; i < MAXFD; i++)
+  8008cc:	83 c3 01             	add    $0x1,%ebx
+  8008cf:	83 c4 10             	add    $0x10,%esp
+  8008d2:	83 fb 20             	cmp    $0x20,%ebx
+  8008d5:	75 ec                	jne    8008c3 <close_all+0xc>
+}
+  8008d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008da:	c9                   	leave
+  8008db:	c3                   	ret
+
+008008dc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	57                   	push   %edi
+  8008e0:	56                   	push   %esi
+  8008e1:	53                   	push   %ebx
+  8008e2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 08             	push   0x8(%ebp)
+  8008ec:	e8 45 fe ff ff       	call   800736 <fd_lookup>
+  8008f1:	89 c3                	mov    %eax,%ebx
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	78 7f                	js     800979 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008fa:	83 ec 0c             	sub    $0xc,%esp
+  8008fd:	ff 75 0c             	push   0xc(%ebp)
+  800900:	e8 85 ff ff ff       	call   80088a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800905:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800908:	c1 e6 0c             	shl    $0xc,%esi
+  80090b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800911:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800914:	89 3c 24             	mov    %edi,(%esp)
+  800917:	e8 ad fd ff ff       	call   8006c9 <fd2data>
+  80091c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80091e:	89 34 24             	mov    %esi,(%esp)
+  800921:	e8 a3 fd ff ff       	call   8006c9 <fd2data>
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80092c:	89 d8                	mov    %ebx,%eax
+  80092e:	c1 e8 16             	shr    $0x16,%eax
+  800931:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800938:	a8 01                	test   $0x1,%al
+  80093a:	74 11                	je     80094d <dup+0x71>
+  80093c:	89 d8                	mov    %ebx,%eax
+  80093e:	c1 e8 0c             	shr    $0xc,%eax
+  800941:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800948:	f6 c2 01             	test   $0x1,%dl
+  80094b:	75 36                	jne    800983 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80094d:	89 f8                	mov    %edi,%eax
+  80094f:	c1 e8 0c             	shr    $0xc,%eax
+  800952:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800959:	83 ec 0c             	sub    $0xc,%esp
+  80095c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800961:	50                   	push   %eax
+  800962:	56                   	push   %esi
+  800963:	6a 00                	push   $0x0
+  800965:	57                   	push   %edi
+  800966:	6a 00                	push   $0x0
+  800968:	e8 d1 f8 ff ff       	call   80023e <sys_page_map>
+  80096d:	89 c3                	mov    %eax,%ebx
+  80096f:	83 c4 20             	add    $0x20,%esp
+  800972:	85 c0                	test   %eax,%eax
+  800974:	78 33                	js     8009a9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800976:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800979:	89 d8                	mov    %ebx,%eax
+  80097b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80097e:	5b                   	pop    %ebx
+  80097f:	5e                   	pop    %esi
+  800980:	5f                   	pop    %edi
+  800981:	5d                   	pop    %ebp
+  800982:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800983:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80098a:	83 ec 0c             	sub    $0xc,%esp
+  80098d:	25 07 0e 00 00       	and    $0xe07,%eax
+  800992:	50                   	push   %eax
+  800993:	ff 75 d4             	push   -0x2c(%ebp)
+  800996:	6a 00                	push   $0x0
+  800998:	53                   	push   %ebx
+  800999:	6a 00                	push   $0x0
+  80099b:	e8 9e f8 ff ff       	call   80023e <sys_page_map>
+  8009a0:	89 c3                	mov    %eax,%ebx
+  8009a2:	83 c4 20             	add    $0x20,%esp
+  8009a5:	85 c0                	test   %eax,%eax
+  8009a7:	79 a4                	jns    80094d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+  8009ac:	56                   	push   %esi
+  8009ad:	6a 00                	push   $0x0
+  8009af:	e8 d6 f8 ff ff       	call   80028a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8009b4:	83 c4 08             	add    $0x8,%esp
+  8009b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8009ba:	6a 00                	push   $0x0
+  8009bc:	e8 c9 f8 ff ff       	call   80028a <sys_page_unmap>
+	return r;
+  8009c1:	83 c4 10             	add    $0x10,%esp
+  8009c4:	eb b3                	jmp    800979 <dup+0x9d>
+
+008009c6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	56                   	push   %esi
+  8009ca:	53                   	push   %ebx
+  8009cb:	83 ec 18             	sub    $0x18,%esp
+  8009ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009d4:	50                   	push   %eax
+  8009d5:	53                   	push   %ebx
+  8009d6:	e8 5b fd ff ff       	call   800736 <fd_lookup>
+  8009db:	83 c4 10             	add    $0x10,%esp
+  8009de:	85 c0                	test   %eax,%eax
+  8009e0:	78 3c                	js     800a1e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009e2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009e5:	83 ec 08             	sub    $0x8,%esp
+  8009e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009eb:	50                   	push   %eax
+  8009ec:	ff 36                	push   (%esi)
+  8009ee:	e8 93 fd ff ff       	call   800786 <dev_lookup>
+  8009f3:	83 c4 10             	add    $0x10,%esp
+  8009f6:	85 c0                	test   %eax,%eax
+  8009f8:	78 24                	js     800a1e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009fa:	8b 46 08             	mov    0x8(%esi),%eax
+  8009fd:	83 e0 03             	and    $0x3,%eax
+  800a00:	83 f8 01             	cmp    $0x1,%eax
+  800a03:	74 20                	je     800a25 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a08:	8b 40 08             	mov    0x8(%eax),%eax
+  800a0b:	85 c0                	test   %eax,%eax
+  800a0d:	74 61                	je     800a70 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a0f:	83 ec 04             	sub    $0x4,%esp
+  800a12:	ff 75 10             	push   0x10(%ebp)
+  800a15:	ff 75 0c             	push   0xc(%ebp)
+  800a18:	56                   	push   %esi
+  800a19:	ff d0                	call   *%eax
+  800a1b:	83 c4 10             	add    $0x10,%esp
+}
+  800a1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a21:	5b                   	pop    %ebx
+  800a22:	5e                   	pop    %esi
+  800a23:	5d                   	pop    %ebp
+  800a24:	c3                   	ret
+  800a25:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800a27:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800a2d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800a32:	77 18                	ja     800a4c <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800a34:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800a39:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800a3b:	c1 e8 10             	shr    $0x10,%eax
+  800a3e:	74 0c                	je     800a4c <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a40:	c1 e0 10             	shl    $0x10,%eax
+  800a43:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a48:	29 c2                	sub    %eax,%edx
+  800a4a:	eb 06                	jmp    800a52 <read+0x8c>
+		return pthread_main_tls;
+  800a4c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a52:	8b 02                	mov    (%edx),%eax
+  800a54:	8b 40 48             	mov    0x48(%eax),%eax
+  800a57:	83 ec 04             	sub    $0x4,%esp
+  800a5a:	53                   	push   %ebx
+  800a5b:	50                   	push   %eax
+  800a5c:	68 59 47 80 00       	push   $0x804759
+  800a61:	e8 6c 28 00 00       	call   8032d2 <cprintf>
+		return -E_INVAL;
+  800a66:	83 c4 10             	add    $0x10,%esp
+  800a69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6e:	eb ae                	jmp    800a1e <read+0x58>
+		return -E_NOT_SUPP;
+  800a70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a75:	eb a7                	jmp    800a1e <read+0x58>
+
+00800a77 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	57                   	push   %edi
+  800a7b:	56                   	push   %esi
+  800a7c:	53                   	push   %ebx
+  800a7d:	83 ec 0c             	sub    $0xc,%esp
+  800a80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a83:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a8b:	eb 02                	jmp    800a8f <readn+0x18>
+  800a8d:	01 c3                	add    %eax,%ebx
+  800a8f:	39 f3                	cmp    %esi,%ebx
+  800a91:	73 21                	jae    800ab4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a93:	83 ec 04             	sub    $0x4,%esp
+  800a96:	89 f0                	mov    %esi,%eax
+  800a98:	29 d8                	sub    %ebx,%eax
+  800a9a:	50                   	push   %eax
+  800a9b:	89 d8                	mov    %ebx,%eax
+  800a9d:	03 45 0c             	add    0xc(%ebp),%eax
+  800aa0:	50                   	push   %eax
+  800aa1:	57                   	push   %edi
+  800aa2:	e8 1f ff ff ff       	call   8009c6 <read>
+		if (m < 0)
+  800aa7:	83 c4 10             	add    $0x10,%esp
+  800aaa:	85 c0                	test   %eax,%eax
+  800aac:	78 04                	js     800ab2 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800aae:	75 dd                	jne    800a8d <readn+0x16>
+  800ab0:	eb 02                	jmp    800ab4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ab2:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ab4:	89 d8                	mov    %ebx,%eax
+  800ab6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab9:	5b                   	pop    %ebx
+  800aba:	5e                   	pop    %esi
+  800abb:	5f                   	pop    %edi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  800ac3:	83 ec 18             	sub    $0x18,%esp
+  800ac6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ac9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800acc:	50                   	push   %eax
+  800acd:	53                   	push   %ebx
+  800ace:	e8 63 fc ff ff       	call   800736 <fd_lookup>
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	85 c0                	test   %eax,%eax
+  800ad8:	78 37                	js     800b11 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ada:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800add:	83 ec 08             	sub    $0x8,%esp
+  800ae0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ae3:	50                   	push   %eax
+  800ae4:	ff 36                	push   (%esi)
+  800ae6:	e8 9b fc ff ff       	call   800786 <dev_lookup>
+  800aeb:	83 c4 10             	add    $0x10,%esp
+  800aee:	85 c0                	test   %eax,%eax
+  800af0:	78 1f                	js     800b11 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800af2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800af6:	74 20                	je     800b18 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800af8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800afb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	74 61                	je     800b63 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b02:	83 ec 04             	sub    $0x4,%esp
+  800b05:	ff 75 10             	push   0x10(%ebp)
+  800b08:	ff 75 0c             	push   0xc(%ebp)
+  800b0b:	56                   	push   %esi
+  800b0c:	ff d0                	call   *%eax
+  800b0e:	83 c4 10             	add    $0x10,%esp
+}
+  800b11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b14:	5b                   	pop    %ebx
+  800b15:	5e                   	pop    %esi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+  800b18:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800b1a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800b20:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800b25:	77 18                	ja     800b3f <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800b27:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800b2c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800b2e:	c1 e8 10             	shr    $0x10,%eax
+  800b31:	74 0c                	je     800b3f <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800b33:	c1 e0 10             	shl    $0x10,%eax
+  800b36:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800b3b:	29 c2                	sub    %eax,%edx
+  800b3d:	eb 06                	jmp    800b45 <write+0x87>
+		return pthread_main_tls;
+  800b3f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b45:	8b 02                	mov    (%edx),%eax
+  800b47:	8b 40 48             	mov    0x48(%eax),%eax
+  800b4a:	83 ec 04             	sub    $0x4,%esp
+  800b4d:	53                   	push   %ebx
+  800b4e:	50                   	push   %eax
+  800b4f:	68 75 47 80 00       	push   $0x804775
+  800b54:	e8 79 27 00 00       	call   8032d2 <cprintf>
+		return -E_INVAL;
+  800b59:	83 c4 10             	add    $0x10,%esp
+  800b5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b61:	eb ae                	jmp    800b11 <write+0x53>
+		return -E_NOT_SUPP;
+  800b63:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b68:	eb a7                	jmp    800b11 <write+0x53>
+
+00800b6a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b6a:	55                   	push   %ebp
+  800b6b:	89 e5                	mov    %esp,%ebp
+  800b6d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b73:	50                   	push   %eax
+  800b74:	ff 75 08             	push   0x8(%ebp)
+  800b77:	e8 ba fb ff ff       	call   800736 <fd_lookup>
+  800b7c:	83 c4 10             	add    $0x10,%esp
+  800b7f:	85 c0                	test   %eax,%eax
+  800b81:	78 0e                	js     800b91 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b89:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b91:	c9                   	leave
+  800b92:	c3                   	ret
+
+00800b93 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	56                   	push   %esi
+  800b97:	53                   	push   %ebx
+  800b98:	83 ec 18             	sub    $0x18,%esp
+  800b9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b9e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ba1:	50                   	push   %eax
+  800ba2:	53                   	push   %ebx
+  800ba3:	e8 8e fb ff ff       	call   800736 <fd_lookup>
+  800ba8:	83 c4 10             	add    $0x10,%esp
+  800bab:	85 c0                	test   %eax,%eax
+  800bad:	78 34                	js     800be3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800baf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bb2:	83 ec 08             	sub    $0x8,%esp
+  800bb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bb8:	50                   	push   %eax
+  800bb9:	ff 36                	push   (%esi)
+  800bbb:	e8 c6 fb ff ff       	call   800786 <dev_lookup>
+  800bc0:	83 c4 10             	add    $0x10,%esp
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	78 1c                	js     800be3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bc7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bcb:	74 1d                	je     800bea <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bd0:	8b 40 18             	mov    0x18(%eax),%eax
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	74 5e                	je     800c35 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bd7:	83 ec 08             	sub    $0x8,%esp
+  800bda:	ff 75 0c             	push   0xc(%ebp)
+  800bdd:	56                   	push   %esi
+  800bde:	ff d0                	call   *%eax
+  800be0:	83 c4 10             	add    $0x10,%esp
+}
+  800be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+  800bea:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bec:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bf2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bf7:	77 18                	ja     800c11 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bf9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bfe:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800c00:	c1 e8 10             	shr    $0x10,%eax
+  800c03:	74 0c                	je     800c11 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800c05:	c1 e0 10             	shl    $0x10,%eax
+  800c08:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800c0d:	29 c2                	sub    %eax,%edx
+  800c0f:	eb 06                	jmp    800c17 <ftruncate+0x84>
+		return pthread_main_tls;
+  800c11:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800c17:	8b 02                	mov    (%edx),%eax
+  800c19:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800c1c:	83 ec 04             	sub    $0x4,%esp
+  800c1f:	53                   	push   %ebx
+  800c20:	50                   	push   %eax
+  800c21:	68 38 47 80 00       	push   $0x804738
+  800c26:	e8 a7 26 00 00       	call   8032d2 <cprintf>
+		return -E_INVAL;
+  800c2b:	83 c4 10             	add    $0x10,%esp
+  800c2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c33:	eb ae                	jmp    800be3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c35:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c3a:	eb a7                	jmp    800be3 <ftruncate+0x50>
+
+00800c3c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	56                   	push   %esi
+  800c40:	53                   	push   %ebx
+  800c41:	83 ec 18             	sub    $0x18,%esp
+  800c44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c4a:	50                   	push   %eax
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	e8 e3 fa ff ff       	call   800736 <fd_lookup>
+  800c53:	83 c4 10             	add    $0x10,%esp
+  800c56:	85 c0                	test   %eax,%eax
+  800c58:	78 49                	js     800ca3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c5a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c5d:	83 ec 08             	sub    $0x8,%esp
+  800c60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c63:	50                   	push   %eax
+  800c64:	ff 36                	push   (%esi)
+  800c66:	e8 1b fb ff ff       	call   800786 <dev_lookup>
+  800c6b:	83 c4 10             	add    $0x10,%esp
+  800c6e:	85 c0                	test   %eax,%eax
+  800c70:	78 31                	js     800ca3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c75:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c79:	74 2f                	je     800caa <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c7b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c7e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c85:	00 00 00 
+	stat->st_isdir = 0;
+  800c88:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c8f:	00 00 00 
+	stat->st_dev = dev;
+  800c92:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c98:	83 ec 08             	sub    $0x8,%esp
+  800c9b:	53                   	push   %ebx
+  800c9c:	56                   	push   %esi
+  800c9d:	ff 50 14             	call   *0x14(%eax)
+  800ca0:	83 c4 10             	add    $0x10,%esp
+}
+  800ca3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca6:	5b                   	pop    %ebx
+  800ca7:	5e                   	pop    %esi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+		return -E_NOT_SUPP;
+  800caa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800caf:	eb f2                	jmp    800ca3 <fstat+0x67>
+
+00800cb1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800cb6:	83 ec 08             	sub    $0x8,%esp
+  800cb9:	6a 00                	push   $0x0
+  800cbb:	ff 75 08             	push   0x8(%ebp)
+  800cbe:	e8 4b 03 00 00       	call   80100e <open>
+  800cc3:	89 c3                	mov    %eax,%ebx
+  800cc5:	83 c4 10             	add    $0x10,%esp
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	78 1b                	js     800ce7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800ccc:	83 ec 08             	sub    $0x8,%esp
+  800ccf:	ff 75 0c             	push   0xc(%ebp)
+  800cd2:	50                   	push   %eax
+  800cd3:	e8 64 ff ff ff       	call   800c3c <fstat>
+  800cd8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cda:	89 1c 24             	mov    %ebx,(%esp)
+  800cdd:	e8 a8 fb ff ff       	call   80088a <close>
+	return r;
+  800ce2:	83 c4 10             	add    $0x10,%esp
+  800ce5:	89 f3                	mov    %esi,%ebx
+}
+  800ce7:	89 d8                	mov    %ebx,%eax
+  800ce9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+
+00800cf0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	56                   	push   %esi
+  800cf4:	53                   	push   %ebx
+  800cf5:	89 c6                	mov    %eax,%esi
+  800cf7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cf9:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800d00:	74 27                	je     800d29 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d02:	6a 07                	push   $0x7
+  800d04:	68 00 70 80 00       	push   $0x807000
+  800d09:	56                   	push   %esi
+  800d0a:	ff 35 00 60 80 00    	push   0x806000
+  800d10:	e8 8f 36 00 00       	call   8043a4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800d15:	83 c4 0c             	add    $0xc,%esp
+  800d18:	6a 00                	push   $0x0
+  800d1a:	53                   	push   %ebx
+  800d1b:	6a 00                	push   $0x0
+  800d1d:	e8 8c 35 00 00       	call   8042ae <ipc_recv>
+}
+  800d22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d25:	5b                   	pop    %ebx
+  800d26:	5e                   	pop    %esi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  800d2c:	6a 01                	push   $0x1
+  800d2e:	e8 c7 36 00 00       	call   8043fa <ipc_find_env>
+  800d33:	a3 00 60 80 00       	mov    %eax,0x806000
+  800d38:	83 c4 10             	add    $0x10,%esp
+  800d3b:	eb c5                	jmp    800d02 <fsipc+0x12>
+
+00800d3d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	53                   	push   %ebx
+  800d41:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d44:	68 04 60 80 00       	push   $0x806004
+  800d49:	e8 29 1b 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d51:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d54:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5c:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d66:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d6b:	e8 80 ff ff ff       	call   800cf0 <fsipc>
+  800d70:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d72:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d79:	e8 66 1b 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+}
+  800d7e:	89 d8                	mov    %ebx,%eax
+  800d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d83:	c9                   	leave
+  800d84:	c3                   	ret
+
+00800d85 <devfile_flush>:
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	53                   	push   %ebx
+  800d89:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d8c:	68 04 60 80 00       	push   $0x806004
+  800d91:	e8 e1 1a 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d99:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d9c:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dab:	e8 40 ff ff ff       	call   800cf0 <fsipc>
+  800db0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800db2:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800db9:	e8 26 1b 00 00       	call   8028e4 <mutex_unlock>
+}
+  800dbe:	89 d8                	mov    %ebx,%eax
+  800dc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc3:	c9                   	leave
+  800dc4:	c3                   	ret
+
+00800dc5 <devfile_stat>:
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800dcd:	83 ec 0c             	sub    $0xc,%esp
+  800dd0:	68 04 60 80 00       	push   $0x806004
+  800dd5:	e8 9d 1a 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddd:	8b 40 0c             	mov    0xc(%eax),%eax
+  800de0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dea:	b8 05 00 00 00       	mov    $0x5,%eax
+  800def:	e8 fc fe ff ff       	call   800cf0 <fsipc>
+  800df4:	89 c3                	mov    %eax,%ebx
+  800df6:	83 c4 10             	add    $0x10,%esp
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	79 16                	jns    800e13 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+  800e00:	68 04 60 80 00       	push   $0x806004
+  800e05:	e8 da 1a 00 00       	call   8028e4 <mutex_unlock>
+}
+  800e0a:	89 d8                	mov    %ebx,%eax
+  800e0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800e13:	83 ec 08             	sub    $0x8,%esp
+  800e16:	68 00 70 80 00       	push   $0x807000
+  800e1b:	56                   	push   %esi
+  800e1c:	e8 95 2a 00 00       	call   8038b6 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800e21:	a1 80 70 80 00       	mov    0x807080,%eax
+  800e26:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800e2c:	a1 84 70 80 00       	mov    0x807084,%eax
+  800e31:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800e37:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3f:	eb bc                	jmp    800dfd <devfile_stat+0x38>
+
+00800e41 <devfile_write>:
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	53                   	push   %ebx
+  800e45:	83 ec 10             	sub    $0x10,%esp
+  800e48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e4b:	68 04 60 80 00       	push   $0x806004
+  800e50:	e8 22 1a 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e58:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e5b:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e60:	83 c4 10             	add    $0x10,%esp
+  800e63:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e69:	76 3d                	jbe    800ea8 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e6b:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e70:	39 c3                	cmp    %eax,%ebx
+  800e72:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e78:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e7d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e88:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e8d:	e8 5e fe ff ff       	call   800cf0 <fsipc>
+  800e92:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	68 04 60 80 00       	push   $0x806004
+  800e9c:	e8 43 1a 00 00       	call   8028e4 <mutex_unlock>
+}
+  800ea1:	89 d8                	mov    %ebx,%eax
+  800ea3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ea6:	c9                   	leave
+  800ea7:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800ea8:	83 ec 04             	sub    $0x4,%esp
+  800eab:	53                   	push   %ebx
+  800eac:	ff 75 0c             	push   0xc(%ebp)
+  800eaf:	68 0c 70 80 00       	push   $0x80700c
+  800eb4:	e8 83 2b 00 00       	call   803a3c <memmove>
+  800eb9:	83 c4 10             	add    $0x10,%esp
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec1:	eb b5                	jmp    800e78 <devfile_write+0x37>
+
+00800ec3 <devfile_read>:
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ecf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800ed5:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800edb:	0f 86 8c 00 00 00    	jbe    800f6d <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800ee1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800ee6:	39 c3                	cmp    %eax,%ebx
+  800ee8:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800eeb:	89 f8                	mov    %edi,%eax
+  800eed:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800ef0:	eb 0f                	jmp    800f01 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800ef2:	0f b6 08             	movzbl (%eax),%ecx
+  800ef5:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ef7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800efc:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800f01:	39 d0                	cmp    %edx,%eax
+  800f03:	72 ed                	jb     800ef2 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	68 04 60 80 00       	push   $0x806004
+  800f0d:	e8 65 19 00 00       	call   802877 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f12:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f15:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800f1a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800f20:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f30:	e8 bb fd ff ff       	call   800cf0 <fsipc>
+  800f35:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800f37:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f3e:	e8 a1 19 00 00       	call   8028e4 <mutex_unlock>
+		assert(r <= (int) n);
+  800f43:	83 c4 10             	add    $0x10,%esp
+  800f46:	39 f3                	cmp    %esi,%ebx
+  800f48:	7c 0a                	jl     800f54 <devfile_read+0x91>
+}
+  800f4a:	89 f0                	mov    %esi,%eax
+  800f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		assert(r <= (int) n);
+  800f54:	68 a8 47 80 00       	push   $0x8047a8
+  800f59:	68 b5 47 80 00       	push   $0x8047b5
+  800f5e:	68 90 00 00 00       	push   $0x90
+  800f63:	68 ca 47 80 00       	push   $0x8047ca
+  800f68:	e8 8a 22 00 00       	call   8031f7 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	68 04 60 80 00       	push   $0x806004
+  800f75:	e8 fd 18 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f7a:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f7d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f82:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f88:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f8f:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f97:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f9c:	e8 4f fd ff ff       	call   800cf0 <fsipc>
+  800fa1:	89 c6                	mov    %eax,%esi
+  800fa3:	83 c4 10             	add    $0x10,%esp
+  800fa6:	85 c0                	test   %eax,%eax
+  800fa8:	78 1d                	js     800fc7 <devfile_read+0x104>
+		assert(r <= n);
+  800faa:	39 c3                	cmp    %eax,%ebx
+  800fac:	72 2e                	jb     800fdc <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800fae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800fb3:	7f 40                	jg     800ff5 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800fb5:	83 ec 04             	sub    $0x4,%esp
+  800fb8:	50                   	push   %eax
+  800fb9:	68 00 70 80 00       	push   $0x807000
+  800fbe:	57                   	push   %edi
+  800fbf:	e8 78 2a 00 00       	call   803a3c <memmove>
+  800fc4:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	68 04 60 80 00       	push   $0x806004
+  800fcf:	e8 10 19 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+  800fd4:	83 c4 10             	add    $0x10,%esp
+  800fd7:	e9 6e ff ff ff       	jmp    800f4a <devfile_read+0x87>
+		assert(r <= n);
+  800fdc:	68 d5 47 80 00       	push   $0x8047d5
+  800fe1:	68 b5 47 80 00       	push   $0x8047b5
+  800fe6:	68 99 00 00 00       	push   $0x99
+  800feb:	68 ca 47 80 00       	push   $0x8047ca
+  800ff0:	e8 02 22 00 00       	call   8031f7 <_panic>
+		assert(r <= PGSIZE);
+  800ff5:	68 dc 47 80 00       	push   $0x8047dc
+  800ffa:	68 b5 47 80 00       	push   $0x8047b5
+  800fff:	68 9a 00 00 00       	push   $0x9a
+  801004:	68 ca 47 80 00       	push   $0x8047ca
+  801009:	e8 e9 21 00 00       	call   8031f7 <_panic>
+
+0080100e <open>:
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+  801013:	83 ec 1c             	sub    $0x1c,%esp
+  801016:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801019:	56                   	push   %esi
+  80101a:	e8 5c 28 00 00       	call   80387b <strlen>
+  80101f:	83 c4 10             	add    $0x10,%esp
+  801022:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801027:	0f 8f 85 00 00 00    	jg     8010b2 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+  801030:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801033:	50                   	push   %eax
+  801034:	e8 a7 f6 ff ff       	call   8006e0 <fd_alloc>
+  801039:	89 c3                	mov    %eax,%ebx
+  80103b:	83 c4 10             	add    $0x10,%esp
+  80103e:	85 c0                	test   %eax,%eax
+  801040:	78 55                	js     801097 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	68 04 60 80 00       	push   $0x806004
+  80104a:	e8 28 18 00 00       	call   802877 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80104f:	83 c4 08             	add    $0x8,%esp
+  801052:	56                   	push   %esi
+  801053:	68 00 70 80 00       	push   $0x807000
+  801058:	e8 59 28 00 00       	call   8038b6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80105d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801060:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801065:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801068:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106d:	e8 7e fc ff ff       	call   800cf0 <fsipc>
+  801072:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801074:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80107b:	e8 64 18 00 00       	call   8028e4 <mutex_unlock>
+	if (r < 0) {
+  801080:	83 c4 10             	add    $0x10,%esp
+  801083:	85 db                	test   %ebx,%ebx
+  801085:	78 19                	js     8010a0 <open+0x92>
+	return fd2num(fd);
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	ff 75 f4             	push   -0xc(%ebp)
+  80108d:	e8 27 f6 ff ff       	call   8006b9 <fd2num>
+  801092:	89 c3                	mov    %eax,%ebx
+  801094:	83 c4 10             	add    $0x10,%esp
+}
+  801097:	89 d8                	mov    %ebx,%eax
+  801099:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+		fd_close(fd, 0);
+  8010a0:	83 ec 08             	sub    $0x8,%esp
+  8010a3:	6a 00                	push   $0x0
+  8010a5:	ff 75 f4             	push   -0xc(%ebp)
+  8010a8:	e8 56 f7 ff ff       	call   800803 <fd_close>
+		return r;
+  8010ad:	83 c4 10             	add    $0x10,%esp
+  8010b0:	eb e5                	jmp    801097 <open+0x89>
+		return -E_BAD_PATH;
+  8010b2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8010b7:	eb de                	jmp    801097 <open+0x89>
+
+008010b9 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	53                   	push   %ebx
+  8010bd:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c3:	50                   	push   %eax
+  8010c4:	ff 75 08             	push   0x8(%ebp)
+  8010c7:	e8 6a f6 ff ff       	call   800736 <fd_lookup>
+  8010cc:	89 c3                	mov    %eax,%ebx
+  8010ce:	83 c4 10             	add    $0x10,%esp
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	78 5b                	js     801130 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8010d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010d8:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8010de:	39 08                	cmp    %ecx,(%eax)
+  8010e0:	75 55                	jne    801137 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010e2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010e6:	74 56                	je     80113e <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010e8:	83 ec 0c             	sub    $0xc,%esp
+  8010eb:	68 04 60 80 00       	push   $0x806004
+  8010f0:	e8 82 17 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010fb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801100:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801103:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801108:	8b 45 10             	mov    0x10(%ebp),%eax
+  80110b:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801110:	ba 00 00 00 00       	mov    $0x0,%edx
+  801115:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80111a:	e8 d1 fb ff ff       	call   800cf0 <fsipc>
+  80111f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801121:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801128:	e8 b7 17 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+  80112d:	83 c4 10             	add    $0x10,%esp
+}
+  801130:	89 d8                	mov    %ebx,%eax
+  801132:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+		return -E_NOT_SUPP;
+  801137:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80113c:	eb f2                	jmp    801130 <fallocate+0x77>
+		return -E_INVAL;
+  80113e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801143:	eb eb                	jmp    801130 <fallocate+0x77>
+
+00801145 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+  80114a:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80114d:	89 f3                	mov    %esi,%ebx
+  80114f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801155:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801158:	eb 06                	jmp    801160 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80115a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801160:	39 f3                	cmp    %esi,%ebx
+  801162:	73 14                	jae    801178 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801164:	83 ec 08             	sub    $0x8,%esp
+  801167:	53                   	push   %ebx
+  801168:	6a 00                	push   $0x0
+  80116a:	e8 1b f1 ff ff       	call   80028a <sys_page_unmap>
+  80116f:	83 c4 10             	add    $0x10,%esp
+  801172:	85 c0                	test   %eax,%eax
+  801174:	79 e4                	jns    80115a <munmap+0x15>
+  801176:	eb 05                	jmp    80117d <munmap+0x38>
+			return r;
+	return 0;
+  801178:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80117d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+
+00801184 <mmap>:
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	57                   	push   %edi
+  801188:	56                   	push   %esi
+  801189:	53                   	push   %ebx
+  80118a:	83 ec 24             	sub    $0x24,%esp
+  80118d:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801190:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801193:	50                   	push   %eax
+  801194:	ff 75 08             	push   0x8(%ebp)
+  801197:	e8 9a f5 ff ff       	call   800736 <fd_lookup>
+  80119c:	83 c4 10             	add    $0x10,%esp
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	0f 88 37 01 00 00    	js     8012de <mmap+0x15a>
+		return NULL;
+  8011a7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8011ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011af:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8011b5:	39 0a                	cmp    %ecx,(%edx)
+  8011b7:	0f 85 05 01 00 00    	jne    8012c2 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8011bd:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8011c4:	0f 85 1b 01 00 00    	jne    8012e5 <mmap+0x161>
+  8011ca:	89 f0                	mov    %esi,%eax
+  8011cc:	83 e8 01             	sub    $0x1,%eax
+  8011cf:	0f 88 17 01 00 00    	js     8012ec <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8011d5:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8011d9:	75 28                	jne    801203 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	68 04 60 80 00       	push   $0x806004
+  8011e3:	e8 8f 16 00 00       	call   802877 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011e8:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011ee:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011f4:	83 c4 10             	add    $0x10,%esp
+  8011f7:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011fc:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801201:	eb 2b                	jmp    80122e <mmap+0xaa>
+		cow_enable();
+  801203:	e8 35 2c 00 00       	call   803e3d <cow_enable>
+  801208:	eb d1                	jmp    8011db <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80120a:	89 c2                	mov    %eax,%edx
+  80120c:	c1 ea 0c             	shr    $0xc,%edx
+  80120f:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801216:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80121c:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801222:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801225:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801227:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80122c:	77 25                	ja     801253 <mmap+0xcf>
+  80122e:	89 c2                	mov    %eax,%edx
+  801230:	29 da                	sub    %ebx,%edx
+  801232:	39 ca                	cmp    %ecx,%edx
+  801234:	73 3a                	jae    801270 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801236:	89 c2                	mov    %eax,%edx
+  801238:	c1 ea 16             	shr    $0x16,%edx
+  80123b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801242:	f6 c2 01             	test   $0x1,%dl
+  801245:	75 c3                	jne    80120a <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801247:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80124c:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801251:	eb d4                	jmp    801227 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801253:	29 d8                	sub    %ebx,%eax
+  801255:	39 c8                	cmp    %ecx,%eax
+  801257:	73 17                	jae    801270 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801259:	83 ec 0c             	sub    $0xc,%esp
+  80125c:	68 04 60 80 00       	push   $0x806004
+  801261:	e8 7e 16 00 00       	call   8028e4 <mutex_unlock>
+		return NULL;
+  801266:	83 c4 10             	add    $0x10,%esp
+  801269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126e:	eb 52                	jmp    8012c2 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801270:	85 db                	test   %ebx,%ebx
+  801272:	74 e5                	je     801259 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801274:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801277:	8b 40 0c             	mov    0xc(%eax),%eax
+  80127a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80127f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801282:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801287:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  80128d:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801293:	8b 45 14             	mov    0x14(%ebp),%eax
+  801296:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80129b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012a5:	e8 46 fa ff ff       	call   800cf0 <fsipc>
+  8012aa:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	68 04 60 80 00       	push   $0x806004
+  8012b4:	e8 2b 16 00 00       	call   8028e4 <mutex_unlock>
+	if (r < 0) {
+  8012b9:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8012bc:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8012be:	85 ff                	test   %edi,%edi
+  8012c0:	78 08                	js     8012ca <mmap+0x146>
+}
+  8012c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c5:	5b                   	pop    %ebx
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5f                   	pop    %edi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+		munmap((void*) va, len);
+  8012ca:	83 ec 08             	sub    $0x8,%esp
+  8012cd:	56                   	push   %esi
+  8012ce:	53                   	push   %ebx
+  8012cf:	e8 71 fe ff ff       	call   801145 <munmap>
+		return NULL;
+  8012d4:	83 c4 10             	add    $0x10,%esp
+  8012d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dc:	eb e4                	jmp    8012c2 <mmap+0x13e>
+		return NULL;
+  8012de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e3:	eb dd                	jmp    8012c2 <mmap+0x13e>
+		return NULL;
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	eb d6                	jmp    8012c2 <mmap+0x13e>
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	eb cf                	jmp    8012c2 <mmap+0x13e>
+
+008012f3 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	53                   	push   %ebx
+  8012f7:	83 ec 10             	sub    $0x10,%esp
+  8012fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012fd:	53                   	push   %ebx
+  8012fe:	e8 78 25 00 00       	call   80387b <strlen>
+  801303:	83 c4 10             	add    $0x10,%esp
+  801306:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80130b:	7f 42                	jg     80134f <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+  801310:	68 04 60 80 00       	push   $0x806004
+  801315:	e8 5d 15 00 00       	call   802877 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80131a:	83 c4 08             	add    $0x8,%esp
+  80131d:	53                   	push   %ebx
+  80131e:	68 00 70 80 00       	push   $0x807000
+  801323:	e8 8e 25 00 00       	call   8038b6 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801328:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801332:	e8 b9 f9 ff ff       	call   800cf0 <fsipc>
+  801337:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801339:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801340:	e8 9f 15 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+  801345:	83 c4 10             	add    $0x10,%esp
+}
+  801348:	89 d8                	mov    %ebx,%eax
+  80134a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+		return -E_BAD_PATH;
+  80134f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801354:	eb f2                	jmp    801348 <remove+0x55>
+
+00801356 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	53                   	push   %ebx
+  80135a:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80135d:	68 04 60 80 00       	push   $0x806004
+  801362:	e8 10 15 00 00       	call   802877 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801367:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801371:	e8 7a f9 ff ff       	call   800cf0 <fsipc>
+  801376:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801378:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80137f:	e8 60 15 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+}
+  801384:	89 d8                	mov    %ebx,%eax
+  801386:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801389:	c9                   	leave
+  80138a:	c3                   	ret
+
+0080138b <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	56                   	push   %esi
+  80138f:	53                   	push   %ebx
+  801390:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801393:	83 ec 0c             	sub    $0xc,%esp
+  801396:	68 04 60 80 00       	push   $0x806004
+  80139b:	e8 d7 14 00 00       	call   802877 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8013a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a3:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8013a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013b2:	e8 39 f9 ff ff       	call   800cf0 <fsipc>
+  8013b7:	89 c6                	mov    %eax,%esi
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	85 db                	test   %ebx,%ebx
+  8013be:	74 7b                	je     80143b <fs_bcstat+0xb0>
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	78 77                	js     80143b <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8013c4:	a1 00 70 80 00       	mov    0x807000,%eax
+  8013c9:	89 03                	mov    %eax,(%ebx)
+  8013cb:	a1 04 70 80 00       	mov    0x807004,%eax
+  8013d0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8013d3:	a1 08 70 80 00       	mov    0x807008,%eax
+  8013d8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8013db:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013e0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013e3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013e8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013eb:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013f0:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013f3:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013f8:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013fb:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801400:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801403:	a1 20 70 80 00       	mov    0x807020,%eax
+  801408:	89 43 20             	mov    %eax,0x20(%ebx)
+  80140b:	a1 24 70 80 00       	mov    0x807024,%eax
+  801410:	89 43 24             	mov    %eax,0x24(%ebx)
+  801413:	a1 28 70 80 00       	mov    0x807028,%eax
+  801418:	89 43 28             	mov    %eax,0x28(%ebx)
+  80141b:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801420:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801423:	a1 30 70 80 00       	mov    0x807030,%eax
+  801428:	89 43 30             	mov    %eax,0x30(%ebx)
+  80142b:	a1 34 70 80 00       	mov    0x807034,%eax
+  801430:	89 43 34             	mov    %eax,0x34(%ebx)
+  801433:	a1 38 70 80 00       	mov    0x807038,%eax
+  801438:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80143b:	83 ec 0c             	sub    $0xc,%esp
+  80143e:	68 04 60 80 00       	push   $0x806004
+  801443:	e8 9c 14 00 00       	call   8028e4 <mutex_unlock>
+	return r;
+}
+  801448:	89 f0                	mov    %esi,%eax
+  80144a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80144d:	5b                   	pop    %ebx
+  80144e:	5e                   	pop    %esi
+  80144f:	5d                   	pop    %ebp
+  801450:	c3                   	ret
+
+00801451 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801451:	55                   	push   %ebp
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	56                   	push   %esi
+  801455:	53                   	push   %ebx
+  801456:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801458:	0f b6 10             	movzbl (%eax),%edx
+  80145b:	80 fa 72             	cmp    $0x72,%dl
+  80145e:	74 44                	je     8014a4 <parse_mode+0x53>
+  801460:	80 fa 77             	cmp    $0x77,%dl
+  801463:	74 4b                	je     8014b0 <parse_mode+0x5f>
+  801465:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80146a:	80 fa 61             	cmp    $0x61,%dl
+  80146d:	74 09                	je     801478 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80146f:	89 d8                	mov    %ebx,%eax
+  801471:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+	switch (mode[0]) {
+  801478:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80147d:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801482:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801484:	83 ec 08             	sub    $0x8,%esp
+  801487:	6a 2b                	push   $0x2b
+  801489:	50                   	push   %eax
+  80148a:	e8 39 25 00 00       	call   8039c8 <strchr>
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	74 d9                	je     80146f <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801496:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801499:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80149c:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8014a2:	eb cb                	jmp    80146f <parse_mode+0x1e>
+	switch (mode[0]) {
+  8014a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8014a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ae:	eb d2                	jmp    801482 <parse_mode+0x31>
+  8014b0:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8014b5:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8014ba:	eb c6                	jmp    801482 <parse_mode+0x31>
+
+008014bc <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+  8014c2:	83 ec 1c             	sub    $0x1c,%esp
+  8014c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014c8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014cb:	b8 24 50 80 00       	mov    $0x805024,%eax
+  8014d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8014d5:	83 c0 24             	add    $0x24,%eax
+  8014d8:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014dc:	74 17                	je     8014f5 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014de:	83 c3 01             	add    $0x1,%ebx
+  8014e1:	83 fb 10             	cmp    $0x10,%ebx
+  8014e4:	75 ef                	jne    8014d5 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014eb:	89 f0                	mov    %esi,%eax
+  8014ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f0:	5b                   	pop    %ebx
+  8014f1:	5e                   	pop    %esi
+  8014f2:	5f                   	pop    %edi
+  8014f3:	5d                   	pop    %ebp
+  8014f4:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014f5:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014fc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014ff:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801502:	c1 e7 02             	shl    $0x2,%edi
+  801505:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  80150b:	83 ec 04             	sub    $0x4,%esp
+  80150e:	6a 24                	push   $0x24
+  801510:	6a 00                	push   $0x0
+  801512:	56                   	push   %esi
+  801513:	e8 ef 24 00 00       	call   803a07 <memset>
+			streams[i].f_fd = fd;
+  801518:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80151b:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801521:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801524:	01 d8                	add    %ebx,%eax
+  801526:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801529:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	eb b6                	jmp    8014eb <stream_alloc+0x2f>
+
+00801535 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	53                   	push   %ebx
+  801539:	83 ec 14             	sub    $0x14,%esp
+  80153c:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80153e:	8b 40 18             	mov    0x18(%eax),%eax
+  801541:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801544:	74 4a                	je     801590 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801546:	83 ec 08             	sub    $0x8,%esp
+  801549:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154c:	50                   	push   %eax
+  80154d:	ff 33                	push   (%ebx)
+  80154f:	e8 e2 f1 ff ff       	call   800736 <fd_lookup>
+  801554:	89 c2                	mov    %eax,%edx
+  801556:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80155e:	85 d2                	test   %edx,%edx
+  801560:	78 41                	js     8015a3 <stream_unread+0x6e>
+  801562:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801565:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80156b:	39 0a                	cmp    %ecx,(%edx)
+  80156d:	75 34                	jne    8015a3 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80156f:	8b 43 14             	mov    0x14(%ebx),%eax
+  801572:	03 42 04             	add    0x4(%edx),%eax
+  801575:	2b 43 18             	sub    0x18(%ebx),%eax
+  801578:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80157b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801582:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801589:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158e:	eb 13                	jmp    8015a3 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801590:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801597:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80159e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8015a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a6:	c9                   	leave
+  8015a7:	c3                   	ret
+
+008015a8 <stream_drain>:
+{
+  8015a8:	55                   	push   %ebp
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	56                   	push   %esi
+  8015ac:	53                   	push   %ebx
+  8015ad:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8015af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b4:	eb 02                	jmp    8015b8 <stream_drain+0x10>
+  8015b6:	01 c3                	add    %eax,%ebx
+  8015b8:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015bb:	39 c3                	cmp    %eax,%ebx
+  8015bd:	73 43                	jae    801602 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8015bf:	83 ec 04             	sub    $0x4,%esp
+  8015c2:	29 d8                	sub    %ebx,%eax
+  8015c4:	50                   	push   %eax
+  8015c5:	89 d8                	mov    %ebx,%eax
+  8015c7:	03 46 0c             	add    0xc(%esi),%eax
+  8015ca:	50                   	push   %eax
+  8015cb:	ff 36                	push   (%esi)
+  8015cd:	e8 ec f4 ff ff       	call   800abe <write>
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	85 c0                	test   %eax,%eax
+  8015d7:	7f dd                	jg     8015b6 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8015d9:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015dd:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015e0:	83 ec 04             	sub    $0x4,%esp
+  8015e3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015e6:	29 d8                	sub    %ebx,%eax
+  8015e8:	50                   	push   %eax
+  8015e9:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015ec:	50                   	push   %eax
+  8015ed:	52                   	push   %edx
+  8015ee:	e8 49 24 00 00       	call   803a3c <memmove>
+			f->f_wend -= done;
+  8015f3:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015f6:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801600:	eb 0a                	jmp    80160c <stream_drain+0x64>
+  801602:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  801607:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80160c:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80160f:	89 d0                	mov    %edx,%eax
+  801611:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+
+00801618 <stream_setup>:
+	if (f->f_buf)
+  801618:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80161c:	74 01                	je     80161f <stream_setup+0x7>
+  80161e:	c3                   	ret
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	53                   	push   %ebx
+  801623:	83 ec 04             	sub    $0x4,%esp
+  801626:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801628:	8b 40 08             	mov    0x8(%eax),%eax
+  80162b:	85 c0                	test   %eax,%eax
+  80162d:	74 17                	je     801646 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80162f:	83 f8 03             	cmp    $0x3,%eax
+  801632:	75 2d                	jne    801661 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801634:	8d 43 20             	lea    0x20(%ebx),%eax
+  801637:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80163a:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801641:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801644:	c9                   	leave
+  801645:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801646:	83 ec 0c             	sub    $0xc,%esp
+  801649:	ff 33                	push   (%ebx)
+  80164b:	e8 29 1b 00 00       	call   803179 <iscons>
+  801650:	83 c4 10             	add    $0x10,%esp
+  801653:	85 c0                	test   %eax,%eax
+  801655:	0f 9f c0             	setg   %al
+  801658:	0f b6 c0             	movzbl %al,%eax
+  80165b:	83 c0 01             	add    $0x1,%eax
+  80165e:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	68 00 10 00 00       	push   $0x1000
+  801669:	e8 6e 0b 00 00       	call   8021dc <malloc>
+  80166e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	85 c0                	test   %eax,%eax
+  801676:	74 bc                	je     801634 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801678:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80167f:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801683:	eb bc                	jmp    801641 <stream_setup+0x29>
+
+00801685 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	53                   	push   %ebx
+  801689:	83 ec 04             	sub    $0x4,%esp
+  80168c:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80168e:	e8 85 ff ff ff       	call   801618 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801693:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801698:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80169c:	74 3d                	je     8016db <stream_fill+0x56>
+  80169e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8016a2:	74 10                	je     8016b4 <stream_fill+0x2f>
+  8016a4:	89 d8                	mov    %ebx,%eax
+  8016a6:	e8 fd fe ff ff       	call   8015a8 <stream_drain>
+		return 0;
+  8016ab:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	78 27                	js     8016db <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8016b4:	83 ec 04             	sub    $0x4,%esp
+  8016b7:	ff 73 10             	push   0x10(%ebx)
+  8016ba:	ff 73 0c             	push   0xc(%ebx)
+  8016bd:	ff 33                	push   (%ebx)
+  8016bf:	e8 02 f3 ff ff       	call   8009c6 <read>
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	7e 17                	jle    8016e2 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8016cb:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8016cf:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8016d6:	89 c2                	mov    %eax,%edx
+  8016d8:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8016db:	89 d0                	mov    %edx,%eax
+  8016dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e0:	c9                   	leave
+  8016e1:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016e2:	c1 f8 1f             	sar    $0x1f,%eax
+  8016e5:	83 e0 04             	and    $0x4,%eax
+  8016e8:	83 c0 04             	add    $0x4,%eax
+  8016eb:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f3:	eb e6                	jmp    8016db <stream_fill+0x56>
+
+008016f5 <fopen>:
+{
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  801701:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  801704:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80170a:	89 f0                	mov    %esi,%eax
+  80170c:	e8 40 fd ff ff       	call   801451 <parse_mode>
+		return 0;
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 2d                	js     801747 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80171a:	83 ec 08             	sub    $0x8,%esp
+  80171d:	50                   	push   %eax
+  80171e:	ff 75 08             	push   0x8(%ebp)
+  801721:	e8 e8 f8 ff ff       	call   80100e <open>
+  801726:	89 c7                	mov    %eax,%edi
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 58                	js     801787 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80172f:	80 3e 61             	cmpb   $0x61,(%esi)
+  801732:	74 1d                	je     801751 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  801734:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80173a:	89 f8                	mov    %edi,%eax
+  80173c:	e8 7b fd ff ff       	call   8014bc <stream_alloc>
+  801741:	89 c3                	mov    %eax,%ebx
+  801743:	85 c0                	test   %eax,%eax
+  801745:	74 32                	je     801779 <fopen+0x84>
+}
+  801747:	89 d8                	mov    %ebx,%eax
+  801749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5f                   	pop    %edi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80175a:	50                   	push   %eax
+  80175b:	57                   	push   %edi
+  80175c:	e8 db f4 ff ff       	call   800c3c <fstat>
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	85 c0                	test   %eax,%eax
+  801766:	78 cc                	js     801734 <fopen+0x3f>
+		seek(fd, st.st_size);
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	ff 75 dc             	push   -0x24(%ebp)
+  80176e:	57                   	push   %edi
+  80176f:	e8 f6 f3 ff ff       	call   800b6a <seek>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	eb bb                	jmp    801734 <fopen+0x3f>
+		close(fd);
+  801779:	83 ec 0c             	sub    $0xc,%esp
+  80177c:	57                   	push   %edi
+  80177d:	e8 08 f1 ff ff       	call   80088a <close>
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	eb c0                	jmp    801747 <fopen+0x52>
+		return 0;
+  801787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178c:	eb b9                	jmp    801747 <fopen+0x52>
+
+0080178e <fdopen>:
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801794:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801797:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80179a:	e8 b2 fc ff ff       	call   801451 <parse_mode>
+  80179f:	89 c2                	mov    %eax,%edx
+		return 0;
+  8017a1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8017a6:	85 d2                	test   %edx,%edx
+  8017a8:	78 0b                	js     8017b5 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8017aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b0:	e8 07 fd ff ff       	call   8014bc <stream_alloc>
+}
+  8017b5:	c9                   	leave
+  8017b6:	c3                   	ret
+
+008017b7 <setvbuf>:
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	57                   	push   %edi
+  8017bb:	56                   	push   %esi
+  8017bc:	53                   	push   %ebx
+  8017bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8017c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8017c6:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8017ca:	75 3a                	jne    801806 <setvbuf+0x4f>
+  8017cc:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8017cf:	83 fe 02             	cmp    $0x2,%esi
+  8017d2:	77 39                	ja     80180d <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8017d4:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8017d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8017db:	0f 95 c3             	setne  %bl
+  8017de:	85 ff                	test   %edi,%edi
+  8017e0:	0f 95 c1             	setne  %cl
+  8017e3:	84 cb                	test   %cl,%bl
+  8017e5:	74 05                	je     8017ec <setvbuf+0x35>
+  8017e7:	83 fa 03             	cmp    $0x3,%edx
+  8017ea:	75 0a                	jne    8017f6 <setvbuf+0x3f>
+	return 0;
+  8017ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f1:	5b                   	pop    %ebx
+  8017f2:	5e                   	pop    %esi
+  8017f3:	5f                   	pop    %edi
+  8017f4:	5d                   	pop    %ebp
+  8017f5:	c3                   	ret
+		f->f_buf = buf;
+  8017f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f9:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017fc:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801804:	eb eb                	jmp    8017f1 <setvbuf+0x3a>
+		return EOF;
+  801806:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80180b:	eb e4                	jmp    8017f1 <setvbuf+0x3a>
+  80180d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801812:	eb dd                	jmp    8017f1 <setvbuf+0x3a>
+
+00801814 <fflush>:
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	57                   	push   %edi
+  801818:	56                   	push   %esi
+  801819:	53                   	push   %ebx
+  80181a:	83 ec 0c             	sub    $0xc,%esp
+  80181d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  801820:	85 db                	test   %ebx,%ebx
+  801822:	74 1a                	je     80183e <fflush+0x2a>
+	stream_unread(f);
+  801824:	89 d8                	mov    %ebx,%eax
+  801826:	e8 0a fd ff ff       	call   801535 <stream_unread>
+	return stream_drain(f);
+  80182b:	89 d8                	mov    %ebx,%eax
+  80182d:	e8 76 fd ff ff       	call   8015a8 <stream_drain>
+  801832:	89 c7                	mov    %eax,%edi
+}
+  801834:	89 f8                	mov    %edi,%eax
+  801836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801839:	5b                   	pop    %ebx
+  80183a:	5e                   	pop    %esi
+  80183b:	5f                   	pop    %edi
+  80183c:	5d                   	pop    %ebp
+  80183d:	c3                   	ret
+  80183e:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801843:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80184d:	eb 03                	jmp    801852 <fflush+0x3e>
+  80184f:	83 c3 24             	add    $0x24,%ebx
+  801852:	39 f3                	cmp    %esi,%ebx
+  801854:	74 de                	je     801834 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801856:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80185a:	74 f3                	je     80184f <fflush+0x3b>
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	53                   	push   %ebx
+  801860:	e8 af ff ff ff       	call   801814 <fflush>
+  801865:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80186f:	0f 48 f8             	cmovs  %eax,%edi
+  801872:	eb db                	jmp    80184f <fflush+0x3b>
+
+00801874 <fclose>:
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	56                   	push   %esi
+  801878:	53                   	push   %ebx
+  801879:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	56                   	push   %esi
+  801880:	e8 8f ff ff ff       	call   801814 <fflush>
+  801885:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801887:	83 c4 04             	add    $0x4,%esp
+  80188a:	ff 36                	push   (%esi)
+  80188c:	e8 f9 ef ff ff       	call   80088a <close>
+  801891:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801894:	85 c0                	test   %eax,%eax
+  801896:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80189b:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80189e:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8018a2:	75 10                	jne    8018b4 <fclose+0x40>
+	f->f_flags = 0;
+  8018a4:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8018ab:	89 d8                	mov    %ebx,%eax
+  8018ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b0:	5b                   	pop    %ebx
+  8018b1:	5e                   	pop    %esi
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+		free(f->f_buf);
+  8018b4:	83 ec 0c             	sub    $0xc,%esp
+  8018b7:	ff 76 0c             	push   0xc(%esi)
+  8018ba:	e8 54 08 00 00       	call   802113 <free>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	eb e0                	jmp    8018a4 <fclose+0x30>
+
+008018c4 <fileno>:
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8018c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ca:	8b 00                	mov    (%eax),%eax
+}
+  8018cc:	5d                   	pop    %ebp
+  8018cd:	c3                   	ret
+
+008018ce <feof>:
+{
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8018d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d4:	8b 40 04             	mov    0x4(%eax),%eax
+  8018d7:	c1 e8 02             	shr    $0x2,%eax
+  8018da:	83 e0 01             	and    $0x1,%eax
+}
+  8018dd:	5d                   	pop    %ebp
+  8018de:	c3                   	ret
+
+008018df <ferror>:
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e5:	8b 40 04             	mov    0x4(%eax),%eax
+  8018e8:	c1 e8 03             	shr    $0x3,%eax
+  8018eb:	83 e0 01             	and    $0x1,%eax
+}
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+
+008018f0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	53                   	push   %ebx
+  8018f4:	83 ec 04             	sub    $0x4,%esp
+  8018f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018fa:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018fd:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801900:	74 15                	je     801917 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  801902:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801905:	8b 43 14             	mov    0x14(%ebx),%eax
+  801908:	8d 48 01             	lea    0x1(%eax),%ecx
+  80190b:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80190e:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  801912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801915:	c9                   	leave
+  801916:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801917:	89 d8                	mov    %ebx,%eax
+  801919:	e8 67 fd ff ff       	call   801685 <stream_fill>
+  80191e:	85 c0                	test   %eax,%eax
+  801920:	75 e0                	jne    801902 <fgetc+0x12>
+		return EOF;
+  801922:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801927:	eb e9                	jmp    801912 <fgetc+0x22>
+
+00801929 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  801929:	55                   	push   %ebp
+  80192a:	89 e5                	mov    %esp,%ebp
+  80192c:	57                   	push   %edi
+  80192d:	56                   	push   %esi
+  80192e:	53                   	push   %ebx
+  80192f:	83 ec 1c             	sub    $0x1c,%esp
+  801932:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  801935:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80193a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80193d:	83 e8 01             	sub    $0x1,%eax
+  801940:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801943:	eb 66                	jmp    8019ab <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801945:	8b 46 14             	mov    0x14(%esi),%eax
+  801948:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80194b:	29 c3                	sub    %eax,%ebx
+  80194d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801950:	29 fa                	sub    %edi,%edx
+  801952:	39 d3                	cmp    %edx,%ebx
+  801954:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801957:	83 ec 04             	sub    $0x4,%esp
+  80195a:	53                   	push   %ebx
+  80195b:	6a 0a                	push   $0xa
+  80195d:	03 46 0c             	add    0xc(%esi),%eax
+  801960:	50                   	push   %eax
+  801961:	e8 87 21 00 00       	call   803aed <memfind>
+  801966:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801969:	8b 46 0c             	mov    0xc(%esi),%eax
+  80196c:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80196f:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801972:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80197a:	74 0b                	je     801987 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80197c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80197f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801982:	29 d3                	sub    %edx,%ebx
+  801984:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801987:	83 ec 04             	sub    $0x4,%esp
+  80198a:	53                   	push   %ebx
+  80198b:	01 c8                	add    %ecx,%eax
+  80198d:	50                   	push   %eax
+  80198e:	89 f8                	mov    %edi,%eax
+  801990:	03 45 08             	add    0x8(%ebp),%eax
+  801993:	50                   	push   %eax
+  801994:	e8 a3 20 00 00       	call   803a3c <memmove>
+		f->f_rpos += m;
+  801999:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80199c:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a4:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8019a9:	74 1f                	je     8019ca <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8019ab:	8d 47 01             	lea    0x1(%edi),%eax
+  8019ae:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8019b1:	73 17                	jae    8019ca <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8019b3:	8b 46 18             	mov    0x18(%esi),%eax
+  8019b6:	39 46 14             	cmp    %eax,0x14(%esi)
+  8019b9:	75 8a                	jne    801945 <fgets+0x1c>
+  8019bb:	89 f0                	mov    %esi,%eax
+  8019bd:	e8 c3 fc ff ff       	call   801685 <stream_fill>
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	0f 85 7b ff ff ff    	jne    801945 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8019ca:	85 ff                	test   %edi,%edi
+  8019cc:	74 0f                	je     8019dd <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8019d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d8:	5b                   	pop    %ebx
+  8019d9:	5e                   	pop    %esi
+  8019da:	5f                   	pop    %edi
+  8019db:	5d                   	pop    %ebp
+  8019dc:	c3                   	ret
+		return 0;
+  8019dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e2:	eb f1                	jmp    8019d5 <fgets+0xac>
+
+008019e4 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	57                   	push   %edi
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 1c             	sub    $0x1c,%esp
+  8019ed:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019f0:	89 f0                	mov    %esi,%eax
+  8019f2:	e8 21 fc ff ff       	call   801618 <stream_setup>
+	want = size * n;
+  8019f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019fa:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  801a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a06:	eb 43                	jmp    801a4b <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  801a08:	29 d3                	sub    %edx,%ebx
+  801a0a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a0d:	29 f8                	sub    %edi,%eax
+  801a0f:	39 c3                	cmp    %eax,%ebx
+  801a11:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  801a14:	83 ec 04             	sub    $0x4,%esp
+  801a17:	53                   	push   %ebx
+  801a18:	03 56 0c             	add    0xc(%esi),%edx
+  801a1b:	52                   	push   %edx
+  801a1c:	89 f8                	mov    %edi,%eax
+  801a1e:	03 45 08             	add    0x8(%ebp),%eax
+  801a21:	50                   	push   %eax
+  801a22:	e8 15 20 00 00       	call   803a3c <memmove>
+			f->f_rpos += m;
+  801a27:	01 5e 14             	add    %ebx,0x14(%esi)
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	eb 1a                	jmp    801a49 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  801a2f:	83 ec 04             	sub    $0x4,%esp
+  801a32:	53                   	push   %ebx
+  801a33:	89 f8                	mov    %edi,%eax
+  801a35:	03 45 08             	add    0x8(%ebp),%eax
+  801a38:	50                   	push   %eax
+  801a39:	ff 36                	push   (%esi)
+  801a3b:	e8 86 ef ff ff       	call   8009c6 <read>
+  801a40:	89 c3                	mov    %eax,%ebx
+  801a42:	83 c4 10             	add    $0x10,%esp
+  801a45:	85 c0                	test   %eax,%eax
+  801a47:	7e 36                	jle    801a7f <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a49:	01 df                	add    %ebx,%edi
+  801a4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a4e:	39 c7                	cmp    %eax,%edi
+  801a50:	73 39                	jae    801a8b <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a52:	8b 56 14             	mov    0x14(%esi),%edx
+  801a55:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a58:	39 da                	cmp    %ebx,%edx
+  801a5a:	72 ac                	jb     801a08 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a5c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a5f:	29 fb                	sub    %edi,%ebx
+  801a61:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a64:	72 3e                	jb     801aa4 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a66:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a6a:	74 1f                	je     801a8b <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a6c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a70:	74 bd                	je     801a2f <fread+0x4b>
+  801a72:	89 f0                	mov    %esi,%eax
+  801a74:	e8 2f fb ff ff       	call   8015a8 <stream_drain>
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	79 b2                	jns    801a2f <fread+0x4b>
+  801a7d:	eb 0c                	jmp    801a8b <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a7f:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a82:	83 e3 04             	and    $0x4,%ebx
+  801a85:	83 c3 04             	add    $0x4,%ebx
+  801a88:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	74 0a                	je     801a9c <fread+0xb8>
+  801a92:	89 f8                	mov    %edi,%eax
+  801a94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a99:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a9f:	5b                   	pop    %ebx
+  801aa0:	5e                   	pop    %esi
+  801aa1:	5f                   	pop    %edi
+  801aa2:	5d                   	pop    %ebp
+  801aa3:	c3                   	ret
+		} else if (!stream_fill(f))
+  801aa4:	89 f0                	mov    %esi,%eax
+  801aa6:	e8 da fb ff ff       	call   801685 <stream_fill>
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	74 dc                	je     801a8b <fread+0xa7>
+			m = 0;
+  801aaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab4:	eb 93                	jmp    801a49 <fread+0x65>
+
+00801ab6 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	57                   	push   %edi
+  801aba:	56                   	push   %esi
+  801abb:	53                   	push   %ebx
+  801abc:	83 ec 1c             	sub    $0x1c,%esp
+  801abf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801ac2:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ac5:	a8 02                	test   $0x2,%al
+  801ac7:	75 13                	jne    801adc <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801ac9:	83 c8 08             	or     $0x8,%eax
+  801acc:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801acf:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801ad4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad7:	5b                   	pop    %ebx
+  801ad8:	5e                   	pop    %esi
+  801ad9:	5f                   	pop    %edi
+  801ada:	5d                   	pop    %ebp
+  801adb:	c3                   	ret
+	stream_setup(f);
+  801adc:	89 d8                	mov    %ebx,%eax
+  801ade:	e8 35 fb ff ff       	call   801618 <stream_setup>
+	want = size * n;
+  801ae3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ae6:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801aed:	89 d8                	mov    %ebx,%eax
+  801aef:	e8 41 fa ff ff       	call   801535 <stream_unread>
+	for (done = 0; done < want; ) {
+  801af4:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801af9:	84 c0                	test   %al,%al
+  801afb:	75 7b                	jne    801b78 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801afd:	be 00 00 00 00       	mov    $0x0,%esi
+  801b02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b05:	39 fe                	cmp    %edi,%esi
+  801b07:	73 24                	jae    801b2d <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b09:	83 ec 04             	sub    $0x4,%esp
+  801b0c:	89 f8                	mov    %edi,%eax
+  801b0e:	29 f0                	sub    %esi,%eax
+  801b10:	50                   	push   %eax
+  801b11:	89 f0                	mov    %esi,%eax
+  801b13:	03 45 08             	add    0x8(%ebp),%eax
+  801b16:	50                   	push   %eax
+  801b17:	ff 33                	push   (%ebx)
+  801b19:	e8 a0 ef ff ff       	call   800abe <write>
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	7e 04                	jle    801b29 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801b25:	01 c6                	add    %eax,%esi
+  801b27:	eb dc                	jmp    801b05 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801b29:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801b2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	74 a0                	je     801ad4 <fwrite+0x1e>
+  801b34:	89 f0                	mov    %esi,%eax
+  801b36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3b:	f7 75 0c             	divl   0xc(%ebp)
+  801b3e:	eb 94                	jmp    801ad4 <fwrite+0x1e>
+			done += r;
+  801b40:	01 c7                	add    %eax,%edi
+			continue;
+  801b42:	eb 34                	jmp    801b78 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b44:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b47:	29 c6                	sub    %eax,%esi
+  801b49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b4c:	29 fa                	sub    %edi,%edx
+  801b4e:	39 d6                	cmp    %edx,%esi
+  801b50:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b53:	83 ec 04             	sub    $0x4,%esp
+  801b56:	56                   	push   %esi
+  801b57:	89 fa                	mov    %edi,%edx
+  801b59:	03 55 08             	add    0x8(%ebp),%edx
+  801b5c:	52                   	push   %edx
+  801b5d:	03 43 0c             	add    0xc(%ebx),%eax
+  801b60:	50                   	push   %eax
+  801b61:	e8 d6 1e 00 00       	call   803a3c <memmove>
+		f->f_wend += m;
+  801b66:	89 f0                	mov    %esi,%eax
+  801b68:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b6b:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b6e:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b76:	74 5b                	je     801bd3 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b7b:	39 c7                	cmp    %eax,%edi
+  801b7d:	73 2d                	jae    801bac <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b7f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	75 be                	jne    801b44 <fwrite+0x8e>
+  801b86:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b89:	29 fa                	sub    %edi,%edx
+  801b8b:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b8e:	72 b4                	jb     801b44 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b90:	83 ec 04             	sub    $0x4,%esp
+  801b93:	52                   	push   %edx
+  801b94:	89 f8                	mov    %edi,%eax
+  801b96:	03 45 08             	add    0x8(%ebp),%eax
+  801b99:	50                   	push   %eax
+  801b9a:	ff 33                	push   (%ebx)
+  801b9c:	e8 1d ef ff ff       	call   800abe <write>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	7f 98                	jg     801b40 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801ba8:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801bac:	8b 43 08             	mov    0x8(%ebx),%eax
+  801baf:	83 f8 03             	cmp    $0x3,%eax
+  801bb2:	74 48                	je     801bfc <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801bb4:	83 f8 02             	cmp    $0x2,%eax
+  801bb7:	74 27                	je     801be0 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801bb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	0f 84 10 ff ff ff    	je     801ad4 <fwrite+0x1e>
+  801bc4:	89 f8                	mov    %edi,%eax
+  801bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcb:	f7 75 0c             	divl   0xc(%ebp)
+  801bce:	e9 01 ff ff ff       	jmp    801ad4 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801bd3:	89 d8                	mov    %ebx,%eax
+  801bd5:	e8 ce f9 ff ff       	call   8015a8 <stream_drain>
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	79 9a                	jns    801b78 <fwrite+0xc2>
+  801bde:	eb cc                	jmp    801bac <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801be0:	83 ec 04             	sub    $0x4,%esp
+  801be3:	57                   	push   %edi
+  801be4:	6a 0a                	push   $0xa
+  801be6:	ff 75 08             	push   0x8(%ebp)
+  801be9:	e8 ff 1e 00 00       	call   803aed <memfind>
+  801bee:	89 c2                	mov    %eax,%edx
+  801bf0:	89 f8                	mov    %edi,%eax
+  801bf2:	03 45 08             	add    0x8(%ebp),%eax
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	39 c2                	cmp    %eax,%edx
+  801bfa:	74 bd                	je     801bb9 <fwrite+0x103>
+		stream_drain(f);
+  801bfc:	89 d8                	mov    %ebx,%eax
+  801bfe:	e8 a5 f9 ff ff       	call   8015a8 <stream_drain>
+  801c03:	eb b4                	jmp    801bb9 <fwrite+0x103>
+
+00801c05 <fputc>:
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	53                   	push   %ebx
+  801c09:	83 ec 14             	sub    $0x14,%esp
+  801c0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801c0f:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801c12:	ff 75 0c             	push   0xc(%ebp)
+  801c15:	6a 01                	push   $0x1
+  801c17:	6a 01                	push   $0x1
+  801c19:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801c1c:	50                   	push   %eax
+  801c1d:	e8 94 fe ff ff       	call   801ab6 <fwrite>
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	0f b6 db             	movzbl %bl,%ebx
+  801c28:	83 f8 01             	cmp    $0x1,%eax
+  801c2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c30:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801c33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c36:	c9                   	leave
+  801c37:	c3                   	ret
+
+00801c38 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c3e:	ff 75 0c             	push   0xc(%ebp)
+  801c41:	ff 75 08             	push   0x8(%ebp)
+  801c44:	e8 bc ff ff ff       	call   801c05 <fputc>
+}
+  801c49:	83 c4 10             	add    $0x10,%esp
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+00801c4e <fputs>:
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	56                   	push   %esi
+  801c52:	53                   	push   %ebx
+  801c53:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c56:	83 ec 0c             	sub    $0xc,%esp
+  801c59:	56                   	push   %esi
+  801c5a:	e8 1c 1c 00 00       	call   80387b <strlen>
+  801c5f:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c61:	ff 75 0c             	push   0xc(%ebp)
+  801c64:	50                   	push   %eax
+  801c65:	6a 01                	push   $0x1
+  801c67:	56                   	push   %esi
+  801c68:	e8 49 fe ff ff       	call   801ab6 <fwrite>
+  801c6d:	83 c4 20             	add    $0x20,%esp
+  801c70:	39 d8                	cmp    %ebx,%eax
+  801c72:	0f 95 c0             	setne  %al
+  801c75:	0f b6 c0             	movzbl %al,%eax
+  801c78:	f7 d8                	neg    %eax
+}
+  801c7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c7d:	5b                   	pop    %ebx
+  801c7e:	5e                   	pop    %esi
+  801c7f:	5d                   	pop    %ebp
+  801c80:	c3                   	ret
+
+00801c81 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c8b:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c8e:	50                   	push   %eax
+  801c8f:	ff 75 0c             	push   0xc(%ebp)
+  801c92:	53                   	push   %ebx
+  801c93:	68 38 1c 80 00       	push   $0x801c38
+  801c98:	e8 2c 17 00 00       	call   8033c9 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c9d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ca0:	c1 e0 1c             	shl    $0x1c,%eax
+  801ca3:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca9:	c9                   	leave
+  801caa:	c3                   	ret
+
+00801cab <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cab:	55                   	push   %ebp
+  801cac:	89 e5                	mov    %esp,%ebp
+  801cae:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cb1:	68 f0 47 80 00       	push   $0x8047f0
+  801cb6:	ff 75 0c             	push   0xc(%ebp)
+  801cb9:	e8 f8 1b 00 00       	call   8038b6 <strcpy>
+	return 0;
+}
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+
+00801cc5 <devsock_close>:
+{
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	53                   	push   %ebx
+  801cc9:	83 ec 10             	sub    $0x10,%esp
+  801ccc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ccf:	53                   	push   %ebx
+  801cd0:	e8 64 27 00 00       	call   804439 <pageref>
+  801cd5:	89 c2                	mov    %eax,%edx
+  801cd7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cda:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cdf:	83 fa 01             	cmp    $0x1,%edx
+  801ce2:	74 05                	je     801ce9 <devsock_close+0x24>
+}
+  801ce4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce7:	c9                   	leave
+  801ce8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ce9:	83 ec 0c             	sub    $0xc,%esp
+  801cec:	ff 73 0c             	push   0xc(%ebx)
+  801cef:	e8 b7 02 00 00       	call   801fab <nsipc_close>
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	eb eb                	jmp    801ce4 <devsock_close+0x1f>
+
+00801cf9 <devsock_write>:
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cff:	6a 00                	push   $0x0
+  801d01:	ff 75 10             	push   0x10(%ebp)
+  801d04:	ff 75 0c             	push   0xc(%ebp)
+  801d07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0a:	ff 70 0c             	push   0xc(%eax)
+  801d0d:	e8 79 03 00 00       	call   80208b <nsipc_send>
+}
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+
+00801d14 <devsock_read>:
+{
+  801d14:	55                   	push   %ebp
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d1a:	6a 00                	push   $0x0
+  801d1c:	ff 75 10             	push   0x10(%ebp)
+  801d1f:	ff 75 0c             	push   0xc(%ebp)
+  801d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d25:	ff 70 0c             	push   0xc(%eax)
+  801d28:	e8 ef 02 00 00       	call   80201c <nsipc_recv>
+}
+  801d2d:	c9                   	leave
+  801d2e:	c3                   	ret
+
+00801d2f <fd2sockid>:
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d35:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d38:	52                   	push   %edx
+  801d39:	50                   	push   %eax
+  801d3a:	e8 f7 e9 ff ff       	call   800736 <fd_lookup>
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	78 10                	js     801d56 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d49:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d4f:	39 08                	cmp    %ecx,(%eax)
+  801d51:	75 05                	jne    801d58 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d53:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5d:	eb f7                	jmp    801d56 <fd2sockid+0x27>
+
+00801d5f <alloc_sockfd>:
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	56                   	push   %esi
+  801d63:	53                   	push   %ebx
+  801d64:	83 ec 1c             	sub    $0x1c,%esp
+  801d67:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	e8 6e e9 ff ff       	call   8006e0 <fd_alloc>
+  801d72:	89 c3                	mov    %eax,%ebx
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	78 43                	js     801dbe <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d7b:	83 ec 04             	sub    $0x4,%esp
+  801d7e:	68 07 04 00 00       	push   $0x407
+  801d83:	ff 75 f4             	push   -0xc(%ebp)
+  801d86:	6a 00                	push   $0x0
+  801d88:	e8 64 e4 ff ff       	call   8001f1 <sys_page_alloc>
+  801d8d:	89 c3                	mov    %eax,%ebx
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	78 28                	js     801dbe <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d99:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d9f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801da1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dab:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801dae:	83 ec 0c             	sub    $0xc,%esp
+  801db1:	50                   	push   %eax
+  801db2:	e8 02 e9 ff ff       	call   8006b9 <fd2num>
+  801db7:	89 c3                	mov    %eax,%ebx
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	eb 0c                	jmp    801dca <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801dbe:	83 ec 0c             	sub    $0xc,%esp
+  801dc1:	56                   	push   %esi
+  801dc2:	e8 e4 01 00 00       	call   801fab <nsipc_close>
+		return r;
+  801dc7:	83 c4 10             	add    $0x10,%esp
+}
+  801dca:	89 d8                	mov    %ebx,%eax
+  801dcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dcf:	5b                   	pop    %ebx
+  801dd0:	5e                   	pop    %esi
+  801dd1:	5d                   	pop    %ebp
+  801dd2:	c3                   	ret
+
+00801dd3 <accept>:
+{
+  801dd3:	55                   	push   %ebp
+  801dd4:	89 e5                	mov    %esp,%ebp
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddc:	e8 4e ff ff ff       	call   801d2f <fd2sockid>
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 1b                	js     801e00 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801de5:	83 ec 04             	sub    $0x4,%esp
+  801de8:	ff 75 10             	push   0x10(%ebp)
+  801deb:	ff 75 0c             	push   0xc(%ebp)
+  801dee:	50                   	push   %eax
+  801def:	e8 0e 01 00 00       	call   801f02 <nsipc_accept>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 05                	js     801e00 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dfb:	e8 5f ff ff ff       	call   801d5f <alloc_sockfd>
+}
+  801e00:	c9                   	leave
+  801e01:	c3                   	ret
+
+00801e02 <bind>:
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0b:	e8 1f ff ff ff       	call   801d2f <fd2sockid>
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	78 12                	js     801e26 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e14:	83 ec 04             	sub    $0x4,%esp
+  801e17:	ff 75 10             	push   0x10(%ebp)
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	50                   	push   %eax
+  801e1e:	e8 31 01 00 00       	call   801f54 <nsipc_bind>
+  801e23:	83 c4 10             	add    $0x10,%esp
+}
+  801e26:	c9                   	leave
+  801e27:	c3                   	ret
+
+00801e28 <shutdown>:
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e31:	e8 f9 fe ff ff       	call   801d2f <fd2sockid>
+  801e36:	85 c0                	test   %eax,%eax
+  801e38:	78 0f                	js     801e49 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e3a:	83 ec 08             	sub    $0x8,%esp
+  801e3d:	ff 75 0c             	push   0xc(%ebp)
+  801e40:	50                   	push   %eax
+  801e41:	e8 43 01 00 00       	call   801f89 <nsipc_shutdown>
+  801e46:	83 c4 10             	add    $0x10,%esp
+}
+  801e49:	c9                   	leave
+  801e4a:	c3                   	ret
+
+00801e4b <connect>:
+{
+  801e4b:	55                   	push   %ebp
+  801e4c:	89 e5                	mov    %esp,%ebp
+  801e4e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e51:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e54:	e8 d6 fe ff ff       	call   801d2f <fd2sockid>
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	78 12                	js     801e6f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e5d:	83 ec 04             	sub    $0x4,%esp
+  801e60:	ff 75 10             	push   0x10(%ebp)
+  801e63:	ff 75 0c             	push   0xc(%ebp)
+  801e66:	50                   	push   %eax
+  801e67:	e8 59 01 00 00       	call   801fc5 <nsipc_connect>
+  801e6c:	83 c4 10             	add    $0x10,%esp
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+00801e71 <listen>:
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7a:	e8 b0 fe ff ff       	call   801d2f <fd2sockid>
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 0f                	js     801e92 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e83:	83 ec 08             	sub    $0x8,%esp
+  801e86:	ff 75 0c             	push   0xc(%ebp)
+  801e89:	50                   	push   %eax
+  801e8a:	e8 6b 01 00 00       	call   801ffa <nsipc_listen>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+}
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+00801e94 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e9a:	ff 75 10             	push   0x10(%ebp)
+  801e9d:	ff 75 0c             	push   0xc(%ebp)
+  801ea0:	ff 75 08             	push   0x8(%ebp)
+  801ea3:	e8 41 02 00 00       	call   8020e9 <nsipc_socket>
+  801ea8:	83 c4 10             	add    $0x10,%esp
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	78 05                	js     801eb4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801eaf:	e8 ab fe ff ff       	call   801d5f <alloc_sockfd>
+}
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+
+00801eb6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	53                   	push   %ebx
+  801eba:	83 ec 04             	sub    $0x4,%esp
+  801ebd:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ebf:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801ec6:	74 26                	je     801eee <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ec8:	6a 07                	push   $0x7
+  801eca:	68 00 80 80 00       	push   $0x808000
+  801ecf:	53                   	push   %ebx
+  801ed0:	ff 35 08 60 80 00    	push   0x806008
+  801ed6:	e8 c9 24 00 00       	call   8043a4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801edb:	83 c4 0c             	add    $0xc,%esp
+  801ede:	6a 00                	push   $0x0
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	6a 00                	push   $0x0
+  801ee4:	e8 c5 23 00 00       	call   8042ae <ipc_recv>
+}
+  801ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eec:	c9                   	leave
+  801eed:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801eee:	83 ec 0c             	sub    $0xc,%esp
+  801ef1:	6a 02                	push   $0x2
+  801ef3:	e8 02 25 00 00       	call   8043fa <ipc_find_env>
+  801ef8:	a3 08 60 80 00       	mov    %eax,0x806008
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	eb c6                	jmp    801ec8 <nsipc+0x12>
+
+00801f02 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f02:	55                   	push   %ebp
+  801f03:	89 e5                	mov    %esp,%ebp
+  801f05:	56                   	push   %esi
+  801f06:	53                   	push   %ebx
+  801f07:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f12:	8b 06                	mov    (%esi),%eax
+  801f14:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f19:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f1e:	e8 93 ff ff ff       	call   801eb6 <nsipc>
+  801f23:	89 c3                	mov    %eax,%ebx
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	79 09                	jns    801f32 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f29:	89 d8                	mov    %ebx,%eax
+  801f2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2e:	5b                   	pop    %ebx
+  801f2f:	5e                   	pop    %esi
+  801f30:	5d                   	pop    %ebp
+  801f31:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f32:	83 ec 04             	sub    $0x4,%esp
+  801f35:	ff 35 10 80 80 00    	push   0x808010
+  801f3b:	68 00 80 80 00       	push   $0x808000
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	e8 f4 1a 00 00       	call   803a3c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f48:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f4d:	89 06                	mov    %eax,(%esi)
+  801f4f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f52:	eb d5                	jmp    801f29 <nsipc_accept+0x27>
+
+00801f54 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	53                   	push   %ebx
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f61:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f66:	53                   	push   %ebx
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	68 04 80 80 00       	push   $0x808004
+  801f6f:	e8 c8 1a 00 00       	call   803a3c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f74:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f7f:	e8 32 ff ff ff       	call   801eb6 <nsipc>
+}
+  801f84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+00801f89 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f92:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fa4:	e8 0d ff ff ff       	call   801eb6 <nsipc>
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+00801fab <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb4:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801fb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fbe:	e8 f3 fe ff ff       	call   801eb6 <nsipc>
+}
+  801fc3:	c9                   	leave
+  801fc4:	c3                   	ret
+
+00801fc5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	53                   	push   %ebx
+  801fc9:	83 ec 08             	sub    $0x8,%esp
+  801fcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801fcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fd7:	53                   	push   %ebx
+  801fd8:	ff 75 0c             	push   0xc(%ebp)
+  801fdb:	68 04 80 80 00       	push   $0x808004
+  801fe0:	e8 57 1a 00 00       	call   803a3c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fe5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801feb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ff0:	e8 c1 fe ff ff       	call   801eb6 <nsipc>
+}
+  801ff5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff8:	c9                   	leave
+  801ff9:	c3                   	ret
+
+00801ffa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802000:	8b 45 08             	mov    0x8(%ebp),%eax
+  802003:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802008:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80200b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802010:	b8 06 00 00 00       	mov    $0x6,%eax
+  802015:	e8 9c fe ff ff       	call   801eb6 <nsipc>
+}
+  80201a:	c9                   	leave
+  80201b:	c3                   	ret
+
+0080201c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802024:	8b 45 08             	mov    0x8(%ebp),%eax
+  802027:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80202c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802032:	8b 45 14             	mov    0x14(%ebp),%eax
+  802035:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80203a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80203f:	e8 72 fe ff ff       	call   801eb6 <nsipc>
+  802044:	89 c3                	mov    %eax,%ebx
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 22                	js     80206c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80204a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80204f:	39 c6                	cmp    %eax,%esi
+  802051:	0f 4e c6             	cmovle %esi,%eax
+  802054:	39 c3                	cmp    %eax,%ebx
+  802056:	7f 1d                	jg     802075 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802058:	83 ec 04             	sub    $0x4,%esp
+  80205b:	53                   	push   %ebx
+  80205c:	68 00 80 80 00       	push   $0x808000
+  802061:	ff 75 0c             	push   0xc(%ebp)
+  802064:	e8 d3 19 00 00       	call   803a3c <memmove>
+  802069:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80206c:	89 d8                	mov    %ebx,%eax
+  80206e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802071:	5b                   	pop    %ebx
+  802072:	5e                   	pop    %esi
+  802073:	5d                   	pop    %ebp
+  802074:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802075:	68 fc 47 80 00       	push   $0x8047fc
+  80207a:	68 b5 47 80 00       	push   $0x8047b5
+  80207f:	6a 62                	push   $0x62
+  802081:	68 11 48 80 00       	push   $0x804811
+  802086:	e8 6c 11 00 00       	call   8031f7 <_panic>
+
+0080208b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	53                   	push   %ebx
+  80208f:	83 ec 04             	sub    $0x4,%esp
+  802092:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802095:	8b 45 08             	mov    0x8(%ebp),%eax
+  802098:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80209d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020a3:	7f 2e                	jg     8020d3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020a5:	83 ec 04             	sub    $0x4,%esp
+  8020a8:	53                   	push   %ebx
+  8020a9:	ff 75 0c             	push   0xc(%ebp)
+  8020ac:	68 0c 80 80 00       	push   $0x80800c
+  8020b1:	e8 86 19 00 00       	call   803a3c <memmove>
+	nsipcbuf.send.req_size = size;
+  8020b6:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8020bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020bf:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8020c4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020c9:	e8 e8 fd ff ff       	call   801eb6 <nsipc>
+}
+  8020ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+	assert(size < 1600);
+  8020d3:	68 1d 48 80 00       	push   $0x80481d
+  8020d8:	68 b5 47 80 00       	push   $0x8047b5
+  8020dd:	6a 6d                	push   $0x6d
+  8020df:	68 11 48 80 00       	push   $0x804811
+  8020e4:	e8 0e 11 00 00       	call   8031f7 <_panic>
+
+008020e9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020fa:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802102:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802107:	b8 09 00 00 00       	mov    $0x9,%eax
+  80210c:	e8 a5 fd ff ff       	call   801eb6 <nsipc>
+}
+  802111:	c9                   	leave
+  802112:	c3                   	ret
+
+00802113 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802113:	55                   	push   %ebp
+  802114:	89 e5                	mov    %esp,%ebp
+  802116:	53                   	push   %ebx
+  802117:	83 ec 10             	sub    $0x10,%esp
+  80211a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80211d:	68 0c 60 80 00       	push   $0x80600c
+  802122:	e8 50 07 00 00       	call   802877 <mutex_lock>
+	if (v == 0)
+  802127:	83 c4 10             	add    $0x10,%esp
+  80212a:	85 db                	test   %ebx,%ebx
+  80212c:	0f 84 85 00 00 00    	je     8021b7 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802132:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802138:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80213d:	77 51                	ja     802190 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80213f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802145:	89 d8                	mov    %ebx,%eax
+  802147:	c1 e8 0c             	shr    $0xc,%eax
+  80214a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802151:	f6 c4 02             	test   $0x2,%ah
+  802154:	74 50                	je     8021a6 <free+0x93>
+		sys_page_unmap(0, c);
+  802156:	83 ec 08             	sub    $0x8,%esp
+  802159:	53                   	push   %ebx
+  80215a:	6a 00                	push   $0x0
+  80215c:	e8 29 e1 ff ff       	call   80028a <sys_page_unmap>
+		c += PGSIZE;
+  802161:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802167:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802175:	76 ce                	jbe    802145 <free+0x32>
+  802177:	68 67 48 80 00       	push   $0x804867
+  80217c:	68 b5 47 80 00       	push   $0x8047b5
+  802181:	68 82 00 00 00       	push   $0x82
+  802186:	68 5a 48 80 00       	push   $0x80485a
+  80218b:	e8 67 10 00 00       	call   8031f7 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802190:	68 2c 48 80 00       	push   $0x80482c
+  802195:	68 b5 47 80 00       	push   $0x8047b5
+  80219a:	6a 7b                	push   $0x7b
+  80219c:	68 5a 48 80 00       	push   $0x80485a
+  8021a1:	e8 51 10 00 00       	call   8031f7 <_panic>
+	if (--(*ref) == 0)
+  8021a6:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8021ac:	83 e8 01             	sub    $0x1,%eax
+  8021af:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8021b5:	74 15                	je     8021cc <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+  8021ba:	68 0c 60 80 00       	push   $0x80600c
+  8021bf:	e8 20 07 00 00       	call   8028e4 <mutex_unlock>
+}
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+		sys_page_unmap(0, c);
+  8021cc:	83 ec 08             	sub    $0x8,%esp
+  8021cf:	53                   	push   %ebx
+  8021d0:	6a 00                	push   $0x0
+  8021d2:	e8 b3 e0 ff ff       	call   80028a <sys_page_unmap>
+  8021d7:	83 c4 10             	add    $0x10,%esp
+  8021da:	eb db                	jmp    8021b7 <free+0xa4>
+
+008021dc <malloc>:
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	57                   	push   %edi
+  8021e0:	56                   	push   %esi
+  8021e1:	53                   	push   %ebx
+  8021e2:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021e5:	68 0c 60 80 00       	push   $0x80600c
+  8021ea:	e8 88 06 00 00       	call   802877 <mutex_lock>
+	if (mptr == 0)
+  8021ef:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	85 ff                	test   %edi,%edi
+  8021fa:	74 6c                	je     802268 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ff:	83 c0 03             	add    $0x3,%eax
+  802202:	83 e0 fc             	and    $0xfffffffc,%eax
+  802205:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802207:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80220c:	0f 87 64 01 00 00    	ja     802376 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802212:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802218:	74 30                	je     80224a <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80221a:	89 f9                	mov    %edi,%ecx
+  80221c:	c1 e9 0c             	shr    $0xc,%ecx
+  80221f:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802223:	c1 e8 0c             	shr    $0xc,%eax
+  802226:	39 c1                	cmp    %eax,%ecx
+  802228:	74 5f                	je     802289 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  80222a:	83 ec 0c             	sub    $0xc,%esp
+  80222d:	57                   	push   %edi
+  80222e:	e8 e0 fe ff ff       	call   802113 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802233:	a1 10 60 80 00       	mov    0x806010,%eax
+  802238:	05 00 10 00 00       	add    $0x1000,%eax
+  80223d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802242:	a3 10 60 80 00       	mov    %eax,0x806010
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802250:	ba 02 00 00 00       	mov    $0x2,%edx
+  802255:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802259:	8d 7e 04             	lea    0x4(%esi),%edi
+  80225c:	89 cb                	mov    %ecx,%ebx
+  80225e:	01 f9                	add    %edi,%ecx
+  802260:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802263:	e9 8b 00 00 00       	jmp    8022f3 <malloc+0x117>
+		mptr = mbegin;
+  802268:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80226f:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802272:	8b 45 08             	mov    0x8(%ebp),%eax
+  802275:	83 c0 03             	add    $0x3,%eax
+  802278:	83 e0 fc             	and    $0xfffffffc,%eax
+  80227b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80227d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802282:	76 c6                	jbe    80224a <malloc+0x6e>
+  802284:	e9 d6 00 00 00       	jmp    80235f <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802289:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80228f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802294:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802298:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80229b:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  8022a0:	e9 ba 00 00 00       	jmp    80235f <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022a5:	05 00 10 00 00       	add    $0x1000,%eax
+  8022aa:	39 c8                	cmp    %ecx,%eax
+  8022ac:	0f 83 cb 00 00 00    	jae    80237d <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8022b2:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8022b7:	77 22                	ja     8022db <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	c1 ea 16             	shr    $0x16,%edx
+  8022be:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022c5:	f6 c2 01             	test   $0x1,%dl
+  8022c8:	74 db                	je     8022a5 <malloc+0xc9>
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	c1 ea 0c             	shr    $0xc,%edx
+  8022cf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022d6:	f6 c2 01             	test   $0x1,%dl
+  8022d9:	74 ca                	je     8022a5 <malloc+0xc9>
+		if (mptr == mend) {
+  8022db:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022e1:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022e7:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022eb:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022f1:	74 04                	je     8022f7 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022f3:	89 d8                	mov    %ebx,%eax
+  8022f5:	eb b3                	jmp    8022aa <malloc+0xce>
+  8022f7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022fa:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022ff:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802303:	83 ea 01             	sub    $0x1,%edx
+  802306:	0f 85 50 ff ff ff    	jne    80225c <malloc+0x80>
+  80230c:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802313:	00 00 08 
+				return 0;	/* out of address space */
+  802316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231b:	eb 42                	jmp    80235f <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80231d:	85 db                	test   %ebx,%ebx
+  80231f:	78 1e                	js     80233f <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802321:	83 ec 08             	sub    $0x8,%esp
+  802324:	89 d8                	mov    %ebx,%eax
+  802326:	03 05 10 60 80 00    	add    0x806010,%eax
+  80232c:	50                   	push   %eax
+  80232d:	6a 00                	push   $0x0
+  80232f:	e8 56 df ff ff       	call   80028a <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802334:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80233a:	83 c4 10             	add    $0x10,%esp
+  80233d:	eb de                	jmp    80231d <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80233f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802344:	eb 19                	jmp    80235f <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802346:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802349:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80234f:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802356:	00 
+	mptr += n;
+  802357:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80235a:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80235f:	83 ec 0c             	sub    $0xc,%esp
+  802362:	68 0c 60 80 00       	push   $0x80600c
+  802367:	e8 78 05 00 00       	call   8028e4 <mutex_unlock>
+}
+  80236c:	89 f8                	mov    %edi,%eax
+  80236e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802371:	5b                   	pop    %ebx
+  802372:	5e                   	pop    %esi
+  802373:	5f                   	pop    %edi
+  802374:	5d                   	pop    %ebp
+  802375:	c3                   	ret
+		return 0;
+  802376:	bf 00 00 00 00       	mov    $0x0,%edi
+  80237b:	eb e2                	jmp    80235f <malloc+0x183>
+  80237d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802381:	74 06                	je     802389 <malloc+0x1ad>
+  802383:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802389:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80238e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802391:	39 fb                	cmp    %edi,%ebx
+  802393:	73 b1                	jae    802346 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802395:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80239b:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80239e:	39 fe                	cmp    %edi,%esi
+  8023a0:	0f 92 c0             	setb   %al
+  8023a3:	0f b6 c0             	movzbl %al,%eax
+  8023a6:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8023a9:	83 c8 07             	or     $0x7,%eax
+  8023ac:	50                   	push   %eax
+  8023ad:	89 d8                	mov    %ebx,%eax
+  8023af:	03 05 10 60 80 00    	add    0x806010,%eax
+  8023b5:	50                   	push   %eax
+  8023b6:	6a 00                	push   $0x0
+  8023b8:	e8 34 de ff ff       	call   8001f1 <sys_page_alloc>
+  8023bd:	83 c4 10             	add    $0x10,%esp
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	0f 88 55 ff ff ff    	js     80231d <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8023c8:	89 f3                	mov    %esi,%ebx
+  8023ca:	eb c5                	jmp    802391 <malloc+0x1b5>
+
+008023cc <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	56                   	push   %esi
+  8023d0:	53                   	push   %ebx
+  8023d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023d4:	83 ec 0c             	sub    $0xc,%esp
+  8023d7:	ff 75 08             	push   0x8(%ebp)
+  8023da:	e8 ea e2 ff ff       	call   8006c9 <fd2data>
+  8023df:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023e1:	83 c4 08             	add    $0x8,%esp
+  8023e4:	68 7f 48 80 00       	push   $0x80487f
+  8023e9:	53                   	push   %ebx
+  8023ea:	e8 c7 14 00 00       	call   8038b6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023ef:	8b 46 04             	mov    0x4(%esi),%eax
+  8023f2:	2b 06                	sub    (%esi),%eax
+  8023f4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023fa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802401:	00 00 00 
+	stat->st_dev = &devpipe;
+  802404:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  80240b:	52 80 00 
+	return 0;
+}
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802416:	5b                   	pop    %ebx
+  802417:	5e                   	pop    %esi
+  802418:	5d                   	pop    %ebp
+  802419:	c3                   	ret
+
+0080241a <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80241a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241f:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802423:	85 c9                	test   %ecx,%ecx
+  802425:	75 01                	jne    802428 <pipewake+0xe>
+  802427:	c3                   	ret
+{
+  802428:	55                   	push   %ebp
+  802429:	89 e5                	mov    %esp,%ebp
+  80242b:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80242e:	68 00 04 00 00       	push   $0x400
+  802433:	52                   	push   %edx
+  802434:	e8 fc e0 ff ff       	call   800535 <sys_futex_wake>
+  802439:	83 c4 10             	add    $0x10,%esp
+}
+  80243c:	c9                   	leave
+  80243d:	c3                   	ret
+
+0080243e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	56                   	push   %esi
+  802442:	53                   	push   %ebx
+  802443:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802446:	83 ec 0c             	sub    $0xc,%esp
+  802449:	56                   	push   %esi
+  80244a:	e8 7a e2 ff ff       	call   8006c9 <fd2data>
+  80244f:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802451:	83 c4 08             	add    $0x8,%esp
+  802454:	56                   	push   %esi
+  802455:	6a 00                	push   $0x0
+  802457:	e8 2e de ff ff       	call   80028a <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80245c:	8d 53 04             	lea    0x4(%ebx),%edx
+  80245f:	8d 43 08             	lea    0x8(%ebx),%eax
+  802462:	e8 b3 ff ff ff       	call   80241a <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802467:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80246a:	89 da                	mov    %ebx,%edx
+  80246c:	e8 a9 ff ff ff       	call   80241a <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802471:	89 34 24             	mov    %esi,(%esp)
+  802474:	e8 50 e2 ff ff       	call   8006c9 <fd2data>
+  802479:	83 c4 08             	add    $0x8,%esp
+  80247c:	50                   	push   %eax
+  80247d:	6a 00                	push   $0x0
+  80247f:	e8 06 de ff ff       	call   80028a <sys_page_unmap>
+}
+  802484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802487:	5b                   	pop    %ebx
+  802488:	5e                   	pop    %esi
+  802489:	5d                   	pop    %ebp
+  80248a:	c3                   	ret
+
+0080248b <_pipeisclosed>:
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	57                   	push   %edi
+  80248f:	56                   	push   %esi
+  802490:	53                   	push   %ebx
+  802491:	83 ec 1c             	sub    $0x1c,%esp
+  802494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802497:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802499:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80249e:	eb 5d                	jmp    8024fd <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8024a0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  8024a6:	8b 02                	mov    (%edx),%eax
+  8024a8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024ab:	83 ec 0c             	sub    $0xc,%esp
+  8024ae:	ff 75 e0             	push   -0x20(%ebp)
+  8024b1:	e8 83 1f 00 00       	call   804439 <pageref>
+  8024b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024b9:	89 3c 24             	mov    %edi,(%esp)
+  8024bc:	e8 78 1f 00 00       	call   804439 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8024c1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024c3:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8024d2:	77 15                	ja     8024e9 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024d4:	89 f2                	mov    %esi,%edx
+  8024d6:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8024d8:	c1 ea 10             	shr    $0x10,%edx
+  8024db:	74 0c                	je     8024e9 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024dd:	c1 e2 10             	shl    $0x10,%edx
+  8024e0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024e5:	29 d1                	sub    %edx,%ecx
+  8024e7:	eb 06                	jmp    8024ef <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024e9:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024ef:	8b 11                	mov    (%ecx),%edx
+  8024f1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024f4:	39 d3                	cmp    %edx,%ebx
+  8024f6:	74 6e                	je     802566 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024f8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024fb:	74 24                	je     802521 <_pipeisclosed+0x96>
+  8024fd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024ff:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802505:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80250a:	77 94                	ja     8024a0 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80250c:	89 f0                	mov    %esi,%eax
+  80250e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802510:	c1 e8 10             	shr    $0x10,%eax
+  802513:	74 8b                	je     8024a0 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802515:	c1 e0 10             	shl    $0x10,%eax
+  802518:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80251d:	29 c2                	sub    %eax,%edx
+  80251f:	eb 85                	jmp    8024a6 <_pipeisclosed+0x1b>
+  802521:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802523:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802529:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80252e:	77 18                	ja     802548 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802530:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802535:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802537:	c1 e8 10             	shr    $0x10,%eax
+  80253a:	74 0c                	je     802548 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80253c:	c1 e0 10             	shl    $0x10,%eax
+  80253f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802544:	29 c2                	sub    %eax,%edx
+  802546:	eb 06                	jmp    80254e <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802548:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80254e:	8b 02                	mov    (%edx),%eax
+  802550:	8b 40 58             	mov    0x58(%eax),%eax
+  802553:	6a 01                	push   $0x1
+  802555:	50                   	push   %eax
+  802556:	53                   	push   %ebx
+  802557:	68 86 48 80 00       	push   $0x804886
+  80255c:	e8 71 0d 00 00       	call   8032d2 <cprintf>
+  802561:	83 c4 10             	add    $0x10,%esp
+  802564:	eb 97                	jmp    8024fd <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802566:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802569:	0f 94 c0             	sete   %al
+  80256c:	0f b6 c0             	movzbl %al,%eax
+}
+  80256f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802572:	5b                   	pop    %ebx
+  802573:	5e                   	pop    %esi
+  802574:	5f                   	pop    %edi
+  802575:	5d                   	pop    %ebp
+  802576:	c3                   	ret
+
+00802577 <devpipe_write>:
+{
+  802577:	55                   	push   %ebp
+  802578:	89 e5                	mov    %esp,%ebp
+  80257a:	57                   	push   %edi
+  80257b:	56                   	push   %esi
+  80257c:	53                   	push   %ebx
+  80257d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802580:	ff 75 08             	push   0x8(%ebp)
+  802583:	e8 41 e1 ff ff       	call   8006c9 <fd2data>
+  802588:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802594:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802597:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80259a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80259d:	0f 84 96 00 00 00    	je     802639 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8025a3:	8d 73 08             	lea    0x8(%ebx),%esi
+  8025a6:	eb 32                	jmp    8025da <devpipe_write+0x63>
+  8025a8:	89 fa                	mov    %edi,%edx
+  8025aa:	89 f0                	mov    %esi,%eax
+  8025ac:	e8 69 fe ff ff       	call   80241a <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8025b1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025b4:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8025b7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025bc:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	6a 0a                	push   $0xa
+  8025c6:	50                   	push   %eax
+  8025c7:	53                   	push   %ebx
+  8025c8:	e8 39 df ff ff       	call   800506 <sys_futex_wait>
+  8025cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025d2:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8025d7:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025da:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025dd:	8b 0b                	mov    (%ebx),%ecx
+  8025df:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025e2:	39 d0                	cmp    %edx,%eax
+  8025e4:	72 1b                	jb     802601 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025e6:	89 da                	mov    %ebx,%edx
+  8025e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025eb:	e8 9b fe ff ff       	call   80248b <_pipeisclosed>
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	74 b4                	je     8025a8 <devpipe_write+0x31>
+				return 0;
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fc:	5b                   	pop    %ebx
+  8025fd:	5e                   	pop    %esi
+  8025fe:	5f                   	pop    %edi
+  8025ff:	5d                   	pop    %ebp
+  802600:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802601:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802604:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802607:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80260b:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80260e:	89 c2                	mov    %eax,%edx
+  802610:	c1 fa 1f             	sar    $0x1f,%edx
+  802613:	89 d1                	mov    %edx,%ecx
+  802615:	c1 e9 1b             	shr    $0x1b,%ecx
+  802618:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80261b:	83 e2 1f             	and    $0x1f,%edx
+  80261e:	29 ca                	sub    %ecx,%edx
+  802620:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802624:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802628:	83 c0 01             	add    $0x1,%eax
+  80262b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80262e:	83 c6 01             	add    $0x1,%esi
+  802631:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802634:	e9 5e ff ff ff       	jmp    802597 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802639:	8d 53 04             	lea    0x4(%ebx),%edx
+  80263c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80263f:	e8 d6 fd ff ff       	call   80241a <pipewake>
+	return i;
+  802644:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802647:	eb b0                	jmp    8025f9 <devpipe_write+0x82>
+
+00802649 <devpipe_read>:
+{
+  802649:	55                   	push   %ebp
+  80264a:	89 e5                	mov    %esp,%ebp
+  80264c:	57                   	push   %edi
+  80264d:	56                   	push   %esi
+  80264e:	53                   	push   %ebx
+  80264f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802652:	ff 75 08             	push   0x8(%ebp)
+  802655:	e8 6f e0 ff ff       	call   8006c9 <fd2data>
+  80265a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80265c:	83 c4 10             	add    $0x10,%esp
+  80265f:	be 00 00 00 00       	mov    $0x0,%esi
+  802664:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802667:	74 6c                	je     8026d5 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802669:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80266c:	eb 25                	jmp    802693 <devpipe_read+0x4a>
+  80266e:	8b 13                	mov    (%ebx),%edx
+  802670:	b8 01 00 00 00       	mov    $0x1,%eax
+  802675:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80267a:	83 ec 04             	sub    $0x4,%esp
+  80267d:	6a 0a                	push   $0xa
+  80267f:	52                   	push   %edx
+  802680:	57                   	push   %edi
+  802681:	e8 80 de ff ff       	call   800506 <sys_futex_wait>
+  802686:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80268b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802690:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802693:	8b 03                	mov    (%ebx),%eax
+  802695:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802698:	75 19                	jne    8026b3 <devpipe_read+0x6a>
+			if (i > 0)
+  80269a:	85 f6                	test   %esi,%esi
+  80269c:	75 3a                	jne    8026d8 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80269e:	89 da                	mov    %ebx,%edx
+  8026a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a3:	e8 e3 fd ff ff       	call   80248b <_pipeisclosed>
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	74 c2                	je     80266e <devpipe_read+0x25>
+				return 0;
+  8026ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b1:	eb 31                	jmp    8026e4 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026b3:	89 c1                	mov    %eax,%ecx
+  8026b5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8026b8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026bb:	01 c8                	add    %ecx,%eax
+  8026bd:	83 e0 1f             	and    $0x1f,%eax
+  8026c0:	29 c8                	sub    %ecx,%eax
+  8026c2:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8026c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026ca:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026cd:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026d0:	83 c6 01             	add    $0x1,%esi
+  8026d3:	eb 8f                	jmp    802664 <devpipe_read+0x1b>
+out:
+  8026d5:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8026d8:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8026db:	89 da                	mov    %ebx,%edx
+  8026dd:	e8 38 fd ff ff       	call   80241a <pipewake>
+	return i;
+  8026e2:	89 f0                	mov    %esi,%eax
+}
+  8026e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e7:	5b                   	pop    %ebx
+  8026e8:	5e                   	pop    %esi
+  8026e9:	5f                   	pop    %edi
+  8026ea:	5d                   	pop    %ebp
+  8026eb:	c3                   	ret
+
+008026ec <pipe>:
+{
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	56                   	push   %esi
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026f7:	50                   	push   %eax
+  8026f8:	e8 e3 df ff ff       	call   8006e0 <fd_alloc>
+  8026fd:	89 c3                	mov    %eax,%ebx
+  8026ff:	83 c4 10             	add    $0x10,%esp
+  802702:	85 c0                	test   %eax,%eax
+  802704:	0f 88 23 01 00 00    	js     80282d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80270a:	83 ec 04             	sub    $0x4,%esp
+  80270d:	68 07 04 00 00       	push   $0x407
+  802712:	ff 75 f4             	push   -0xc(%ebp)
+  802715:	6a 00                	push   $0x0
+  802717:	e8 d5 da ff ff       	call   8001f1 <sys_page_alloc>
+  80271c:	89 c3                	mov    %eax,%ebx
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 88 04 01 00 00    	js     80282d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802729:	83 ec 0c             	sub    $0xc,%esp
+  80272c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80272f:	50                   	push   %eax
+  802730:	e8 ab df ff ff       	call   8006e0 <fd_alloc>
+  802735:	89 c3                	mov    %eax,%ebx
+  802737:	83 c4 10             	add    $0x10,%esp
+  80273a:	85 c0                	test   %eax,%eax
+  80273c:	0f 88 db 00 00 00    	js     80281d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802742:	83 ec 04             	sub    $0x4,%esp
+  802745:	68 07 04 00 00       	push   $0x407
+  80274a:	ff 75 f0             	push   -0x10(%ebp)
+  80274d:	6a 00                	push   $0x0
+  80274f:	e8 9d da ff ff       	call   8001f1 <sys_page_alloc>
+  802754:	89 c3                	mov    %eax,%ebx
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	0f 88 bc 00 00 00    	js     80281d <pipe+0x131>
+	va = fd2data(fd0);
+  802761:	83 ec 0c             	sub    $0xc,%esp
+  802764:	ff 75 f4             	push   -0xc(%ebp)
+  802767:	e8 5d df ff ff       	call   8006c9 <fd2data>
+  80276c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80276e:	83 c4 0c             	add    $0xc,%esp
+  802771:	68 07 04 00 00       	push   $0x407
+  802776:	50                   	push   %eax
+  802777:	6a 00                	push   $0x0
+  802779:	e8 73 da ff ff       	call   8001f1 <sys_page_alloc>
+  80277e:	89 c3                	mov    %eax,%ebx
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	85 c0                	test   %eax,%eax
+  802785:	0f 88 82 00 00 00    	js     80280d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	ff 75 f0             	push   -0x10(%ebp)
+  802791:	e8 33 df ff ff       	call   8006c9 <fd2data>
+  802796:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80279d:	50                   	push   %eax
+  80279e:	6a 00                	push   $0x0
+  8027a0:	56                   	push   %esi
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	e8 96 da ff ff       	call   80023e <sys_page_map>
+  8027a8:	89 c3                	mov    %eax,%ebx
+  8027aa:	83 c4 20             	add    $0x20,%esp
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 4e                	js     8027ff <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8027b1:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8027b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027b9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8027bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027be:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8027c5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8027c8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8027ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027cd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027d4:	83 ec 0c             	sub    $0xc,%esp
+  8027d7:	ff 75 f4             	push   -0xc(%ebp)
+  8027da:	e8 da de ff ff       	call   8006b9 <fd2num>
+  8027df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027e4:	83 c4 04             	add    $0x4,%esp
+  8027e7:	ff 75 f0             	push   -0x10(%ebp)
+  8027ea:	e8 ca de ff ff       	call   8006b9 <fd2num>
+  8027ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027f2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027f5:	83 c4 10             	add    $0x10,%esp
+  8027f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fd:	eb 2e                	jmp    80282d <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ff:	83 ec 08             	sub    $0x8,%esp
+  802802:	56                   	push   %esi
+  802803:	6a 00                	push   $0x0
+  802805:	e8 80 da ff ff       	call   80028a <sys_page_unmap>
+  80280a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80280d:	83 ec 08             	sub    $0x8,%esp
+  802810:	ff 75 f0             	push   -0x10(%ebp)
+  802813:	6a 00                	push   $0x0
+  802815:	e8 70 da ff ff       	call   80028a <sys_page_unmap>
+  80281a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80281d:	83 ec 08             	sub    $0x8,%esp
+  802820:	ff 75 f4             	push   -0xc(%ebp)
+  802823:	6a 00                	push   $0x0
+  802825:	e8 60 da ff ff       	call   80028a <sys_page_unmap>
+  80282a:	83 c4 10             	add    $0x10,%esp
+}
+  80282d:	89 d8                	mov    %ebx,%eax
+  80282f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802832:	5b                   	pop    %ebx
+  802833:	5e                   	pop    %esi
+  802834:	5d                   	pop    %ebp
+  802835:	c3                   	ret
+
+00802836 <pipeisclosed>:
+{
+  802836:	55                   	push   %ebp
+  802837:	89 e5                	mov    %esp,%ebp
+  802839:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80283c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80283f:	50                   	push   %eax
+  802840:	ff 75 08             	push   0x8(%ebp)
+  802843:	e8 ee de ff ff       	call   800736 <fd_lookup>
+  802848:	83 c4 10             	add    $0x10,%esp
+  80284b:	85 c0                	test   %eax,%eax
+  80284d:	78 18                	js     802867 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80284f:	83 ec 0c             	sub    $0xc,%esp
+  802852:	ff 75 f4             	push   -0xc(%ebp)
+  802855:	e8 6f de ff ff       	call   8006c9 <fd2data>
+  80285a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80285c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80285f:	e8 27 fc ff ff       	call   80248b <_pipeisclosed>
+  802864:	83 c4 10             	add    $0x10,%esp
+}
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+
+00802869 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802869:	55                   	push   %ebp
+  80286a:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80286c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802875:	5d                   	pop    %ebp
+  802876:	c3                   	ret
+
+00802877 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	56                   	push   %esi
+  80287b:	53                   	push   %ebx
+  80287c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80287f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802884:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802889:	89 d0                	mov    %edx,%eax
+  80288b:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	74 2d                	je     8028c0 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802893:	83 f8 02             	cmp    $0x2,%eax
+  802896:	74 08                	je     8028a0 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802898:	b8 02 00 00 00       	mov    $0x2,%eax
+  80289d:	f0 87 03             	lock xchg %eax,(%ebx)
+  8028a0:	be 02 00 00 00       	mov    $0x2,%esi
+  8028a5:	eb 15                	jmp    8028bc <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8028a7:	83 ec 04             	sub    $0x4,%esp
+  8028aa:	6a 00                	push   $0x0
+  8028ac:	6a 02                	push   $0x2
+  8028ae:	53                   	push   %ebx
+  8028af:	e8 52 dc ff ff       	call   800506 <sys_futex_wait>
+  8028b4:	89 f0                	mov    %esi,%eax
+  8028b6:	f0 87 03             	lock xchg %eax,(%ebx)
+  8028b9:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	75 e7                	jne    8028a7 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8028c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c3:	5b                   	pop    %ebx
+  8028c4:	5e                   	pop    %esi
+  8028c5:	5d                   	pop    %ebp
+  8028c6:	c3                   	ret
+
+008028c7 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+  8028ca:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8028cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028d7:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8028db:	f7 d8                	neg    %eax
+  8028dd:	19 c0                	sbb    %eax,%eax
+  8028df:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028e2:	5d                   	pop    %ebp
+  8028e3:	c3                   	ret
+
+008028e4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f2:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028f5:	83 f8 02             	cmp    $0x2,%eax
+  8028f8:	74 02                	je     8028fc <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028fa:	c9                   	leave
+  8028fb:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028fc:	83 ec 08             	sub    $0x8,%esp
+  8028ff:	6a 01                	push   $0x1
+  802901:	52                   	push   %edx
+  802902:	e8 2e dc ff ff       	call   800535 <sys_futex_wake>
+  802907:	83 c4 10             	add    $0x10,%esp
+}
+  80290a:	eb ee                	jmp    8028fa <mutex_unlock+0x16>
+
+0080290c <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80290c:	55                   	push   %ebp
+  80290d:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80290f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802912:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802918:	5d                   	pop    %ebp
+  802919:	c3                   	ret
+
+0080291a <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	57                   	push   %edi
+  80291e:	56                   	push   %esi
+  80291f:	53                   	push   %ebx
+  802920:	83 ec 18             	sub    $0x18,%esp
+  802923:	8b 75 08             	mov    0x8(%ebp),%esi
+  802926:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  802929:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80292b:	53                   	push   %ebx
+  80292c:	e8 b3 ff ff ff       	call   8028e4 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  802931:	83 c4 0c             	add    $0xc,%esp
+  802934:	ff 75 10             	push   0x10(%ebp)
+  802937:	57                   	push   %edi
+  802938:	56                   	push   %esi
+  802939:	e8 c8 db ff ff       	call   800506 <sys_futex_wait>
+  80293e:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802940:	83 c4 10             	add    $0x10,%esp
+  802943:	be 02 00 00 00       	mov    $0x2,%esi
+  802948:	eb 10                	jmp    80295a <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80294a:	83 ec 04             	sub    $0x4,%esp
+  80294d:	6a 00                	push   $0x0
+  80294f:	6a 02                	push   $0x2
+  802951:	53                   	push   %ebx
+  802952:	e8 af db ff ff       	call   800506 <sys_futex_wait>
+  802957:	83 c4 10             	add    $0x10,%esp
+  80295a:	89 f0                	mov    %esi,%eax
+  80295c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	75 e7                	jne    80294a <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802963:	83 ff ec             	cmp    $0xffffffec,%edi
+  802966:	74 05                	je     80296d <cond_timedwait+0x53>
+  802968:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80296d:	89 f8                	mov    %edi,%eax
+  80296f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802972:	5b                   	pop    %ebx
+  802973:	5e                   	pop    %esi
+  802974:	5f                   	pop    %edi
+  802975:	5d                   	pop    %ebp
+  802976:	c3                   	ret
+
+00802977 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80297d:	6a 00                	push   $0x0
+  80297f:	ff 75 0c             	push   0xc(%ebp)
+  802982:	ff 75 08             	push   0x8(%ebp)
+  802985:	e8 90 ff ff ff       	call   80291a <cond_timedwait>
+}
+  80298a:	83 c4 10             	add    $0x10,%esp
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+
+0080298f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80298f:	55                   	push   %ebp
+  802990:	89 e5                	mov    %esp,%ebp
+  802992:	83 ec 10             	sub    $0x10,%esp
+  802995:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802998:	ba 01 00 00 00       	mov    $0x1,%edx
+  80299d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8029a1:	6a 01                	push   $0x1
+  8029a3:	50                   	push   %eax
+  8029a4:	e8 8c db ff ff       	call   800535 <sys_futex_wake>
+}
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+
+008029ae <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	83 ec 10             	sub    $0x10,%esp
+  8029b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029bc:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8029c0:	68 00 04 00 00       	push   $0x400
+  8029c5:	50                   	push   %eax
+  8029c6:	e8 6a db ff ff       	call   800535 <sys_futex_wake>
+}
+  8029cb:	83 c4 10             	add    $0x10,%esp
+  8029ce:	c9                   	leave
+  8029cf:	c3                   	ret
+
+008029d0 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8029d0:	55                   	push   %ebp
+  8029d1:	89 e5                	mov    %esp,%ebp
+  8029d3:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8029d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029d9:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8029db:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029e2:	5d                   	pop    %ebp
+  8029e3:	c3                   	ret
+
+008029e4 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029e4:	55                   	push   %ebp
+  8029e5:	89 e5                	mov    %esp,%ebp
+  8029e7:	53                   	push   %ebx
+  8029e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029eb:	8b 11                	mov    (%ecx),%edx
+  8029ed:	85 d2                	test   %edx,%edx
+  8029ef:	74 14                	je     802a05 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029f1:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029f4:	89 d0                	mov    %edx,%eax
+  8029f6:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029fa:	39 c2                	cmp    %eax,%edx
+  8029fc:	75 ed                	jne    8029eb <sem_trywait+0x7>
+			return 0;
+  8029fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a03:	eb 05                	jmp    802a0a <sem_trywait+0x26>
+	return -E_AGAIN;
+  802a05:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  802a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+00802a0f <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  802a0f:	55                   	push   %ebp
+  802a10:	89 e5                	mov    %esp,%ebp
+  802a12:	57                   	push   %edi
+  802a13:	56                   	push   %esi
+  802a14:	53                   	push   %ebx
+  802a15:	83 ec 1c             	sub    $0x1c,%esp
+  802a18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a1b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  802a1e:	e8 5b da ff ff       	call   80047e <sys_time_msec>
+  802a23:	01 f8                	add    %edi,%eax
+  802a25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  802a28:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  802a2d:	eb 28                	jmp    802a57 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  802a2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a34:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  802a39:	83 ec 04             	sub    $0x4,%esp
+  802a3c:	56                   	push   %esi
+  802a3d:	6a 00                	push   $0x0
+  802a3f:	53                   	push   %ebx
+  802a40:	e8 c1 da ff ff       	call   800506 <sys_futex_wait>
+  802a45:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a4a:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a4f:	83 c4 10             	add    $0x10,%esp
+  802a52:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a55:	74 2e                	je     802a85 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a57:	83 ec 0c             	sub    $0xc,%esp
+  802a5a:	53                   	push   %ebx
+  802a5b:	e8 84 ff ff ff       	call   8029e4 <sem_trywait>
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	79 19                	jns    802a80 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a67:	85 ff                	test   %edi,%edi
+  802a69:	74 c4                	je     802a2f <sem_timedwait+0x20>
+  802a6b:	e8 0e da ff ff       	call   80047e <sys_time_msec>
+  802a70:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a73:	29 c6                	sub    %eax,%esi
+  802a75:	85 f6                	test   %esi,%esi
+  802a77:	7f b6                	jg     802a2f <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a79:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a7e:	eb 05                	jmp    802a85 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a88:	5b                   	pop    %ebx
+  802a89:	5e                   	pop    %esi
+  802a8a:	5f                   	pop    %edi
+  802a8b:	5d                   	pop    %ebp
+  802a8c:	c3                   	ret
+
+00802a8d <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a93:	6a 00                	push   $0x0
+  802a95:	ff 75 08             	push   0x8(%ebp)
+  802a98:	e8 72 ff ff ff       	call   802a0f <sem_timedwait>
+}
+  802a9d:	83 c4 10             	add    $0x10,%esp
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+00802aa2 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802aa2:	55                   	push   %ebp
+  802aa3:	89 e5                	mov    %esp,%ebp
+  802aa5:	83 ec 08             	sub    $0x8,%esp
+  802aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aab:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ab0:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802ab4:	8b 50 04             	mov    0x4(%eax),%edx
+  802ab7:	85 d2                	test   %edx,%edx
+  802ab9:	75 02                	jne    802abd <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802abb:	c9                   	leave
+  802abc:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802abd:	83 ec 08             	sub    $0x8,%esp
+  802ac0:	6a 01                	push   $0x1
+  802ac2:	50                   	push   %eax
+  802ac3:	e8 6d da ff ff       	call   800535 <sys_futex_wake>
+  802ac8:	83 c4 10             	add    $0x10,%esp
+}
+  802acb:	eb ee                	jmp    802abb <sem_post+0x19>
+
+00802acd <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	57                   	push   %edi
+  802ad1:	56                   	push   %esi
+  802ad2:	53                   	push   %ebx
+  802ad3:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802ad6:	68 20 60 80 00       	push   $0x806020
+  802adb:	e8 97 fd ff ff       	call   802877 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802ae0:	a1 44 60 80 00       	mov    0x806044,%eax
+  802ae5:	83 c4 10             	add    $0x10,%esp
+  802ae8:	85 c0                	test   %eax,%eax
+  802aea:	75 19                	jne    802b05 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802aec:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802af1:	8b 00                	mov    (%eax),%eax
+  802af3:	8b 40 48             	mov    0x48(%eax),%eax
+  802af6:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802afb:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802b02:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802b05:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802b0a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b0d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b14:	8b 40 04             	mov    0x4(%eax),%eax
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	0f 84 e4 00 00 00    	je     802c03 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802b1f:	83 c3 01             	add    $0x1,%ebx
+  802b22:	83 fb 20             	cmp    $0x20,%ebx
+  802b25:	75 e3                	jne    802b0a <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802b27:	83 ec 0c             	sub    $0xc,%esp
+  802b2a:	68 20 60 80 00       	push   $0x806020
+  802b2f:	e8 b0 fd ff ff       	call   8028e4 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802b34:	83 c4 10             	add    $0x10,%esp
+  802b37:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b3c:	e9 b8 00 00 00       	jmp    802bf9 <pthread_create+0x12c>
+  802b41:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b44:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b47:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b49:	39 f3                	cmp    %esi,%ebx
+  802b4b:	73 16                	jae    802b63 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b4d:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b53:	83 ec 08             	sub    $0x8,%esp
+  802b56:	56                   	push   %esi
+  802b57:	6a 00                	push   $0x0
+  802b59:	e8 2c d7 ff ff       	call   80028a <sys_page_unmap>
+  802b5e:	83 c4 10             	add    $0x10,%esp
+  802b61:	eb e6                	jmp    802b49 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b63:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b66:	83 ec 08             	sub    $0x8,%esp
+  802b69:	ff 75 e4             	push   -0x1c(%ebp)
+  802b6c:	6a 00                	push   $0x0
+  802b6e:	e8 17 d7 ff ff       	call   80028a <sys_page_unmap>
+	return r;
+  802b73:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b76:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b79:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b80:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b87:	eb 70                	jmp    802bf9 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b89:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b8c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b93:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b96:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b99:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b9c:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b9f:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802ba6:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802bab:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802bae:	29 c8                	sub    %ecx,%eax
+  802bb0:	85 db                	test   %ebx,%ebx
+  802bb2:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802bb9:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802bbc:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802bc3:	83 ec 04             	sub    $0x4,%esp
+  802bc6:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802bcb:	29 ca                	sub    %ecx,%edx
+  802bcd:	52                   	push   %edx
+	*--esp = 0;
+  802bce:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802bd1:	50                   	push   %eax
+  802bd2:	68 2a 2e 80 00       	push   $0x802e2a
+  802bd7:	e8 fe d9 ff ff       	call   8005da <sys_thread_create>
+  802bdc:	89 c7                	mov    %eax,%edi
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	85 c0                	test   %eax,%eax
+  802be3:	78 91                	js     802b76 <pthread_create+0xa9>
+	th->th_env = id;
+  802be5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802be8:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf2:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bf9:	89 f8                	mov    %edi,%eax
+  802bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bfe:	5b                   	pop    %ebx
+  802bff:	5e                   	pop    %esi
+  802c00:	5f                   	pop    %edi
+  802c01:	5d                   	pop    %ebp
+  802c02:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802c03:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802c06:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802c0d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802c14:	83 ec 0c             	sub    $0xc,%esp
+  802c17:	68 20 60 80 00       	push   $0x806020
+  802c1c:	e8 c3 fc ff ff       	call   8028e4 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802c21:	89 d9                	mov    %ebx,%ecx
+  802c23:	c1 e1 10             	shl    $0x10,%ecx
+  802c26:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802c29:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802c2e:	29 c8                	sub    %ecx,%eax
+  802c30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802c33:	c1 e8 16             	shr    $0x16,%eax
+  802c36:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	a8 01                	test   $0x1,%al
+  802c42:	74 15                	je     802c59 <pthread_create+0x18c>
+  802c44:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c47:	c1 e8 0c             	shr    $0xc,%eax
+  802c4a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c51:	a8 01                	test   $0x1,%al
+  802c53:	0f 85 30 ff ff ff    	jne    802b89 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c59:	83 ec 04             	sub    $0x4,%esp
+  802c5c:	6a 07                	push   $0x7
+  802c5e:	ff 75 e4             	push   -0x1c(%ebp)
+  802c61:	6a 00                	push   $0x0
+  802c63:	e8 89 d5 ff ff       	call   8001f1 <sys_page_alloc>
+  802c68:	89 c7                	mov    %eax,%edi
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	0f 88 01 ff ff ff    	js     802b76 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c75:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c7a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c7d:	29 d0                	sub    %edx,%eax
+  802c7f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c82:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c84:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c89:	29 d0                	sub    %edx,%eax
+  802c8b:	89 c7                	mov    %eax,%edi
+  802c8d:	39 fe                	cmp    %edi,%esi
+  802c8f:	0f 83 f4 fe ff ff    	jae    802b89 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c95:	83 ec 04             	sub    $0x4,%esp
+  802c98:	6a 07                	push   $0x7
+  802c9a:	56                   	push   %esi
+  802c9b:	6a 00                	push   $0x0
+  802c9d:	e8 4f d5 ff ff       	call   8001f1 <sys_page_alloc>
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	0f 88 94 fe ff ff    	js     802b41 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802cad:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cb3:	eb d8                	jmp    802c8d <pthread_create+0x1c0>
+
+00802cb5 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802cb5:	55                   	push   %ebp
+  802cb6:	89 e5                	mov    %esp,%ebp
+  802cb8:	57                   	push   %edi
+  802cb9:	56                   	push   %esi
+  802cba:	53                   	push   %ebx
+  802cbb:	83 ec 0c             	sub    $0xc,%esp
+  802cbe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802cc1:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802cc4:	83 f8 1e             	cmp    $0x1e,%eax
+  802cc7:	0f 87 c7 00 00 00    	ja     802d94 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802ccd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ccf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802cd5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802cda:	77 12                	ja     802cee <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802cdc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ce1:	29 d0                	sub    %edx,%eax
+  802ce3:	c1 e8 10             	shr    $0x10,%eax
+  802ce6:	39 c3                	cmp    %eax,%ebx
+  802ce8:	0f 84 ad 00 00 00    	je     802d9b <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cee:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cf1:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cf8:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cff:	eb 10                	jmp    802d11 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802d01:	83 ec 04             	sub    $0x4,%esp
+  802d04:	6a 00                	push   $0x0
+  802d06:	6a 01                	push   $0x1
+  802d08:	57                   	push   %edi
+  802d09:	e8 f8 d7 ff ff       	call   800506 <sys_futex_wait>
+  802d0e:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802d11:	8b 46 04             	mov    0x4(%esi),%eax
+  802d14:	83 f8 01             	cmp    $0x1,%eax
+  802d17:	74 e8                	je     802d01 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802d19:	83 f8 02             	cmp    $0x2,%eax
+  802d1c:	0f 85 80 00 00 00    	jne    802da2 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802d22:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802d25:	c1 e6 02             	shl    $0x2,%esi
+  802d28:	eb 05                	jmp    802d2f <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802d2a:	e8 96 d4 ff ff       	call   8001c5 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802d2f:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802d35:	89 ca                	mov    %ecx,%edx
+  802d37:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d3d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d40:	c1 e0 04             	shl    $0x4,%eax
+  802d43:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d48:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d4b:	39 c1                	cmp    %eax,%ecx
+  802d4d:	75 12                	jne    802d61 <pthread_join+0xac>
+  802d4f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d52:	c1 e0 04             	shl    $0x4,%eax
+  802d55:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d5a:	8b 40 54             	mov    0x54(%eax),%eax
+  802d5d:	85 c0                	test   %eax,%eax
+  802d5f:	75 c9                	jne    802d2a <pthread_join+0x75>
+	if (ret_store)
+  802d61:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d65:	74 0f                	je     802d76 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d67:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d6a:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d71:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d74:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d76:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d79:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d80:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d8f:	5b                   	pop    %ebx
+  802d90:	5e                   	pop    %esi
+  802d91:	5f                   	pop    %edi
+  802d92:	5d                   	pop    %ebp
+  802d93:	c3                   	ret
+		return -E_INVAL;
+  802d94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d99:	eb f1                	jmp    802d8c <pthread_join+0xd7>
+  802d9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802da0:	eb ea                	jmp    802d8c <pthread_join+0xd7>
+		return -E_INVAL;
+  802da2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802da7:	eb e3                	jmp    802d8c <pthread_join+0xd7>
+
+00802da9 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802da9:	55                   	push   %ebp
+  802daa:	89 e5                	mov    %esp,%ebp
+  802dac:	53                   	push   %ebx
+  802dad:	83 ec 04             	sub    $0x4,%esp
+  802db0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802db2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802db8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802dbd:	77 0c                	ja     802dcb <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802dbf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802dc4:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802dc6:	c1 e8 10             	shr    $0x10,%eax
+  802dc9:	75 0a                	jne    802dd5 <pthread_exit+0x2c>
+		exit();
+  802dcb:	e8 ff d2 ff ff       	call   8000cf <exit>
+  802dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802dd5:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802ddc:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802ddf:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802de6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802de9:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802dec:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802df3:	83 ec 08             	sub    $0x8,%esp
+  802df6:	6a 20                	push   $0x20
+  802df8:	01 c2                	add    %eax,%edx
+  802dfa:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802e01:	50                   	push   %eax
+  802e02:	e8 2e d7 ff ff       	call   800535 <sys_futex_wake>
+	sys_env_destroy(0);
+  802e07:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802e0e:	e8 3b d3 ff ff       	call   80014e <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802e13:	83 c4 0c             	add    $0xc,%esp
+  802e16:	68 9e 48 80 00       	push   $0x80489e
+  802e1b:	68 a5 00 00 00       	push   $0xa5
+  802e20:	68 b8 48 80 00       	push   $0x8048b8
+  802e25:	e8 cd 03 00 00       	call   8031f7 <_panic>
+
+00802e2a <pthread_start>:
+{
+  802e2a:	55                   	push   %ebp
+  802e2b:	89 e5                	mov    %esp,%ebp
+  802e2d:	53                   	push   %ebx
+  802e2e:	83 ec 04             	sub    $0x4,%esp
+  802e31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802e34:	e8 60 d3 ff ff       	call   800199 <sys_getenvid>
+  802e39:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e3e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e44:	85 db                	test   %ebx,%ebx
+  802e46:	74 0c                	je     802e54 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e48:	89 d9                	mov    %ebx,%ecx
+  802e4a:	c1 e1 10             	shl    $0x10,%ecx
+  802e4d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e52:	29 ca                	sub    %ecx,%edx
+  802e54:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e57:	c1 e0 04             	shl    $0x4,%eax
+  802e5a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e5f:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e6b:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e6e:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e75:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e7c:	89 04 24             	mov    %eax,(%esp)
+  802e7f:	e8 25 ff ff ff       	call   802da9 <pthread_exit>
+
+00802e84 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	57                   	push   %edi
+  802e88:	56                   	push   %esi
+  802e89:	53                   	push   %ebx
+  802e8a:	83 ec 1c             	sub    $0x1c,%esp
+  802e8d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e8f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e95:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e9c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ea1:	77 0d                	ja     802eb0 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ea3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ea8:	29 d0                	sub    %edx,%eax
+  802eaa:	c1 e8 10             	shr    $0x10,%eax
+  802ead:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eb5:	eb 2f                	jmp    802ee6 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802eb7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ebd:	8b 01                	mov    (%ecx),%eax
+  802ebf:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802ec2:	39 c2                	cmp    %eax,%edx
+  802ec4:	75 14                	jne    802eda <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802ec6:	83 ec 0c             	sub    $0xc,%esp
+  802ec9:	57                   	push   %edi
+  802eca:	e8 7f d2 ff ff       	call   80014e <sys_env_destroy>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	0f 88 97 00 00 00    	js     802f71 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802eda:	83 c3 01             	add    $0x1,%ebx
+  802edd:	83 fb 20             	cmp    $0x20,%ebx
+  802ee0:	0f 84 d2 00 00 00    	je     802fb8 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802ee6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ee9:	74 ef                	je     802eda <pthread_kill_others+0x56>
+  802eeb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802eee:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ef5:	8b 40 04             	mov    0x4(%eax),%eax
+  802ef8:	83 f8 01             	cmp    $0x1,%eax
+  802efb:	75 dd                	jne    802eda <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802efd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f00:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802f07:	89 fe                	mov    %edi,%esi
+  802f09:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802f0f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f12:	c1 e0 04             	shl    $0x4,%eax
+  802f15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f1a:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f1d:	39 c7                	cmp    %eax,%edi
+  802f1f:	75 b9                	jne    802eda <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802f21:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f24:	c1 e0 04             	shl    $0x4,%eax
+  802f27:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f2c:	8b 40 54             	mov    0x54(%eax),%eax
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	74 a7                	je     802eda <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802f33:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802f36:	c1 e0 04             	shl    $0x4,%eax
+  802f39:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f3f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f41:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f47:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f4c:	0f 87 65 ff ff ff    	ja     802eb7 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f52:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f57:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f59:	c1 e8 10             	shr    $0x10,%eax
+  802f5c:	0f 84 55 ff ff ff    	je     802eb7 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f62:	c1 e0 10             	shl    $0x10,%eax
+  802f65:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f6a:	29 c1                	sub    %eax,%ecx
+  802f6c:	e9 4c ff ff ff       	jmp    802ebd <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f71:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f74:	c1 e2 04             	shl    $0x4,%edx
+  802f77:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f7d:	8b 52 48             	mov    0x48(%edx),%edx
+  802f80:	39 fa                	cmp    %edi,%edx
+  802f82:	0f 85 52 ff ff ff    	jne    802eda <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f88:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f8b:	c1 e2 04             	shl    $0x4,%edx
+  802f8e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f94:	8b 52 54             	mov    0x54(%edx),%edx
+  802f97:	85 d2                	test   %edx,%edx
+  802f99:	0f 84 3b ff ff ff    	je     802eda <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f9f:	83 ec 0c             	sub    $0xc,%esp
+  802fa2:	50                   	push   %eax
+  802fa3:	57                   	push   %edi
+  802fa4:	68 c8 48 80 00       	push   $0x8048c8
+  802fa9:	68 bb 00 00 00       	push   $0xbb
+  802fae:	68 b8 48 80 00       	push   $0x8048b8
+  802fb3:	e8 3f 02 00 00       	call   8031f7 <_panic>
+	}
+}
+  802fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbb:	5b                   	pop    %ebx
+  802fbc:	5e                   	pop    %esi
+  802fbd:	5f                   	pop    %edi
+  802fbe:	5d                   	pop    %ebp
+  802fbf:	c3                   	ret
+
+00802fc0 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	53                   	push   %ebx
+  802fc4:	83 ec 04             	sub    $0x4,%esp
+  802fc7:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fc9:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802fcf:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fd5:	0f 87 85 00 00 00    	ja     803060 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fdb:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fe0:	29 c3                	sub    %eax,%ebx
+  802fe2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fe5:	83 ec 04             	sub    $0x4,%esp
+  802fe8:	68 80 02 00 00       	push   $0x280
+  802fed:	6a 00                	push   $0x0
+  802fef:	68 40 60 80 00       	push   $0x806040
+  802ff4:	e8 0e 0a 00 00       	call   803a07 <memset>
+	threads_mu.m_state = 0;
+  802ff9:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803000:	00 00 00 
+	if (self != 0) {
+  803003:	83 c4 10             	add    $0x10,%esp
+  803006:	85 db                	test   %ebx,%ebx
+  803008:	74 51                	je     80305b <pthread_fork_child+0x9b>
+  80300a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80300c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803012:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803017:	77 18                	ja     803031 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803019:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80301e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803020:	c1 e8 10             	shr    $0x10,%eax
+  803023:	74 0c                	je     803031 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803025:	c1 e0 10             	shl    $0x10,%eax
+  803028:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80302d:	29 c2                	sub    %eax,%edx
+  80302f:	eb 06                	jmp    803037 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803031:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803037:	8b 02                	mov    (%edx),%eax
+  803039:	8b 48 48             	mov    0x48(%eax),%ecx
+  80303c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803043:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803046:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80304d:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803054:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80305b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80305e:	c9                   	leave
+  80305f:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803060:	83 ec 04             	sub    $0x4,%esp
+  803063:	68 80 02 00 00       	push   $0x280
+  803068:	6a 00                	push   $0x0
+  80306a:	68 40 60 80 00       	push   $0x806040
+  80306f:	e8 93 09 00 00       	call   803a07 <memset>
+	threads_mu.m_state = 0;
+  803074:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80307b:	00 00 00 
+  80307e:	83 c4 10             	add    $0x10,%esp
+  803081:	eb d8                	jmp    80305b <pthread_fork_child+0x9b>
+
+00803083 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	c3                   	ret
+
+00803089 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803089:	55                   	push   %ebp
+  80308a:	89 e5                	mov    %esp,%ebp
+  80308c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80308f:	68 ed 48 80 00       	push   $0x8048ed
+  803094:	ff 75 0c             	push   0xc(%ebp)
+  803097:	e8 1a 08 00 00       	call   8038b6 <strcpy>
+	return 0;
+}
+  80309c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a1:	c9                   	leave
+  8030a2:	c3                   	ret
+
+008030a3 <devcons_write>:
+{
+  8030a3:	55                   	push   %ebp
+  8030a4:	89 e5                	mov    %esp,%ebp
+  8030a6:	57                   	push   %edi
+  8030a7:	56                   	push   %esi
+  8030a8:	53                   	push   %ebx
+  8030a9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8030af:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8030b4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8030ba:	eb 2e                	jmp    8030ea <devcons_write+0x47>
+		m = n - tot;
+  8030bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030bf:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8030c1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8030c6:	39 c3                	cmp    %eax,%ebx
+  8030c8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8030cb:	83 ec 04             	sub    $0x4,%esp
+  8030ce:	53                   	push   %ebx
+  8030cf:	89 f0                	mov    %esi,%eax
+  8030d1:	03 45 0c             	add    0xc(%ebp),%eax
+  8030d4:	50                   	push   %eax
+  8030d5:	57                   	push   %edi
+  8030d6:	e8 61 09 00 00       	call   803a3c <memmove>
+		sys_cputs(buf, m);
+  8030db:	83 c4 08             	add    $0x8,%esp
+  8030de:	53                   	push   %ebx
+  8030df:	57                   	push   %edi
+  8030e0:	e8 12 d0 ff ff       	call   8000f7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030e5:	01 de                	add    %ebx,%esi
+  8030e7:	83 c4 10             	add    $0x10,%esp
+  8030ea:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030ed:	72 cd                	jb     8030bc <devcons_write+0x19>
+}
+  8030ef:	89 f0                	mov    %esi,%eax
+  8030f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f4:	5b                   	pop    %ebx
+  8030f5:	5e                   	pop    %esi
+  8030f6:	5f                   	pop    %edi
+  8030f7:	5d                   	pop    %ebp
+  8030f8:	c3                   	ret
+
+008030f9 <devcons_read>:
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803104:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803108:	75 07                	jne    803111 <devcons_read+0x18>
+  80310a:	eb 1f                	jmp    80312b <devcons_read+0x32>
+		sys_yield();
+  80310c:	e8 b4 d0 ff ff       	call   8001c5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803111:	e8 0c d0 ff ff       	call   800122 <sys_cgetc>
+  803116:	85 c0                	test   %eax,%eax
+  803118:	74 f2                	je     80310c <devcons_read+0x13>
+	if (c < 0)
+  80311a:	78 0f                	js     80312b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80311c:	83 f8 04             	cmp    $0x4,%eax
+  80311f:	74 0c                	je     80312d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803121:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803124:	88 02                	mov    %al,(%edx)
+	return 1;
+  803126:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80312b:	c9                   	leave
+  80312c:	c3                   	ret
+		return 0;
+  80312d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803132:	eb f7                	jmp    80312b <devcons_read+0x32>
+
+00803134 <cputchar>:
+{
+  803134:	55                   	push   %ebp
+  803135:	89 e5                	mov    %esp,%ebp
+  803137:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80313a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80313d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803140:	6a 01                	push   $0x1
+  803142:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803145:	50                   	push   %eax
+  803146:	e8 ac cf ff ff       	call   8000f7 <sys_cputs>
+}
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	c9                   	leave
+  80314f:	c3                   	ret
+
+00803150 <getchar>:
+{
+  803150:	55                   	push   %ebp
+  803151:	89 e5                	mov    %esp,%ebp
+  803153:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803156:	6a 01                	push   $0x1
+  803158:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80315b:	50                   	push   %eax
+  80315c:	6a 00                	push   $0x0
+  80315e:	e8 63 d8 ff ff       	call   8009c6 <read>
+	if (r < 0)
+  803163:	83 c4 10             	add    $0x10,%esp
+  803166:	85 c0                	test   %eax,%eax
+  803168:	78 06                	js     803170 <getchar+0x20>
+	if (r < 1)
+  80316a:	74 06                	je     803172 <getchar+0x22>
+	return c;
+  80316c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803170:	c9                   	leave
+  803171:	c3                   	ret
+		return -E_EOF;
+  803172:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803177:	eb f7                	jmp    803170 <getchar+0x20>
+
+00803179 <iscons>:
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80317f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803182:	50                   	push   %eax
+  803183:	ff 75 08             	push   0x8(%ebp)
+  803186:	e8 ab d5 ff ff       	call   800736 <fd_lookup>
+  80318b:	83 c4 10             	add    $0x10,%esp
+  80318e:	85 c0                	test   %eax,%eax
+  803190:	78 11                	js     8031a3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803192:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803195:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80319b:	39 10                	cmp    %edx,(%eax)
+  80319d:	0f 94 c0             	sete   %al
+  8031a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8031a3:	c9                   	leave
+  8031a4:	c3                   	ret
+
+008031a5 <opencons>:
+{
+  8031a5:	55                   	push   %ebp
+  8031a6:	89 e5                	mov    %esp,%ebp
+  8031a8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8031ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ae:	50                   	push   %eax
+  8031af:	e8 2c d5 ff ff       	call   8006e0 <fd_alloc>
+  8031b4:	83 c4 10             	add    $0x10,%esp
+  8031b7:	85 c0                	test   %eax,%eax
+  8031b9:	78 3a                	js     8031f5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8031bb:	83 ec 04             	sub    $0x4,%esp
+  8031be:	68 07 04 00 00       	push   $0x407
+  8031c3:	ff 75 f4             	push   -0xc(%ebp)
+  8031c6:	6a 00                	push   $0x0
+  8031c8:	e8 24 d0 ff ff       	call   8001f1 <sys_page_alloc>
+  8031cd:	83 c4 10             	add    $0x10,%esp
+  8031d0:	85 c0                	test   %eax,%eax
+  8031d2:	78 21                	js     8031f5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031d7:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8031dd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031e2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031e9:	83 ec 0c             	sub    $0xc,%esp
+  8031ec:	50                   	push   %eax
+  8031ed:	e8 c7 d4 ff ff       	call   8006b9 <fd2num>
+  8031f2:	83 c4 10             	add    $0x10,%esp
+}
+  8031f5:	c9                   	leave
+  8031f6:	c3                   	ret
+
+008031f7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031f7:	55                   	push   %ebp
+  8031f8:	89 e5                	mov    %esp,%ebp
+  8031fa:	56                   	push   %esi
+  8031fb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031fc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031ff:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803205:	e8 8f cf ff ff       	call   800199 <sys_getenvid>
+  80320a:	83 ec 0c             	sub    $0xc,%esp
+  80320d:	ff 75 0c             	push   0xc(%ebp)
+  803210:	ff 75 08             	push   0x8(%ebp)
+  803213:	56                   	push   %esi
+  803214:	50                   	push   %eax
+  803215:	68 fc 48 80 00       	push   $0x8048fc
+  80321a:	e8 b3 00 00 00       	call   8032d2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80321f:	83 c4 18             	add    $0x18,%esp
+  803222:	53                   	push   %ebx
+  803223:	ff 75 10             	push   0x10(%ebp)
+  803226:	e8 56 00 00 00       	call   803281 <vcprintf>
+	cprintf("\n");
+  80322b:	c7 04 24 d2 4d 80 00 	movl   $0x804dd2,(%esp)
+  803232:	e8 9b 00 00 00       	call   8032d2 <cprintf>
+  803237:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80323a:	cc                   	int3
+	while (1)
+  80323b:	eb fd                	jmp    80323a <_panic+0x43>
+
+0080323d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	53                   	push   %ebx
+  803241:	83 ec 04             	sub    $0x4,%esp
+  803244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803247:	8b 13                	mov    (%ebx),%edx
+  803249:	8d 42 01             	lea    0x1(%edx),%eax
+  80324c:	89 03                	mov    %eax,(%ebx)
+  80324e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803251:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803255:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80325a:	74 09                	je     803265 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80325c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803263:	c9                   	leave
+  803264:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803265:	83 ec 08             	sub    $0x8,%esp
+  803268:	68 ff 00 00 00       	push   $0xff
+  80326d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803270:	50                   	push   %eax
+  803271:	e8 81 ce ff ff       	call   8000f7 <sys_cputs>
+		b->idx = 0;
+  803276:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80327c:	83 c4 10             	add    $0x10,%esp
+  80327f:	eb db                	jmp    80325c <putch+0x1f>
+
+00803281 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803281:	55                   	push   %ebp
+  803282:	89 e5                	mov    %esp,%ebp
+  803284:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80328a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803291:	00 00 00 
+	b.cnt = 0;
+  803294:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80329b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80329e:	ff 75 0c             	push   0xc(%ebp)
+  8032a1:	ff 75 08             	push   0x8(%ebp)
+  8032a4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8032aa:	50                   	push   %eax
+  8032ab:	68 3d 32 80 00       	push   $0x80323d
+  8032b0:	e8 14 01 00 00       	call   8033c9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8032b5:	83 c4 08             	add    $0x8,%esp
+  8032b8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8032be:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8032c4:	50                   	push   %eax
+  8032c5:	e8 2d ce ff ff       	call   8000f7 <sys_cputs>
+
+	return b.cnt;
+}
+  8032ca:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8032d0:	c9                   	leave
+  8032d1:	c3                   	ret
+
+008032d2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8032d8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8032db:	50                   	push   %eax
+  8032dc:	ff 75 08             	push   0x8(%ebp)
+  8032df:	e8 9d ff ff ff       	call   803281 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032e4:	c9                   	leave
+  8032e5:	c3                   	ret
+
+008032e6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032e6:	55                   	push   %ebp
+  8032e7:	89 e5                	mov    %esp,%ebp
+  8032e9:	57                   	push   %edi
+  8032ea:	56                   	push   %esi
+  8032eb:	53                   	push   %ebx
+  8032ec:	83 ec 1c             	sub    $0x1c,%esp
+  8032ef:	89 c7                	mov    %eax,%edi
+  8032f1:	89 d6                	mov    %edx,%esi
+  8032f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032f9:	89 d1                	mov    %edx,%ecx
+  8032fb:	89 c2                	mov    %eax,%edx
+  8032fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803300:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803303:	8b 45 10             	mov    0x10(%ebp),%eax
+  803306:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  803309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80330c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803313:	39 c2                	cmp    %eax,%edx
+  803315:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803318:	72 3e                	jb     803358 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80331a:	83 ec 0c             	sub    $0xc,%esp
+  80331d:	ff 75 18             	push   0x18(%ebp)
+  803320:	83 eb 01             	sub    $0x1,%ebx
+  803323:	53                   	push   %ebx
+  803324:	50                   	push   %eax
+  803325:	83 ec 08             	sub    $0x8,%esp
+  803328:	ff 75 e4             	push   -0x1c(%ebp)
+  80332b:	ff 75 e0             	push   -0x20(%ebp)
+  80332e:	ff 75 dc             	push   -0x24(%ebp)
+  803331:	ff 75 d8             	push   -0x28(%ebp)
+  803334:	e8 21 12 00 00       	call   80455a <__udivdi3>
+  803339:	83 c4 18             	add    $0x18,%esp
+  80333c:	52                   	push   %edx
+  80333d:	50                   	push   %eax
+  80333e:	89 f2                	mov    %esi,%edx
+  803340:	89 f8                	mov    %edi,%eax
+  803342:	e8 9f ff ff ff       	call   8032e6 <printnum>
+  803347:	83 c4 20             	add    $0x20,%esp
+  80334a:	eb 13                	jmp    80335f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80334c:	83 ec 08             	sub    $0x8,%esp
+  80334f:	56                   	push   %esi
+  803350:	ff 75 18             	push   0x18(%ebp)
+  803353:	ff d7                	call   *%edi
+  803355:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803358:	83 eb 01             	sub    $0x1,%ebx
+  80335b:	85 db                	test   %ebx,%ebx
+  80335d:	7f ed                	jg     80334c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80335f:	83 ec 08             	sub    $0x8,%esp
+  803362:	56                   	push   %esi
+  803363:	83 ec 04             	sub    $0x4,%esp
+  803366:	ff 75 e4             	push   -0x1c(%ebp)
+  803369:	ff 75 e0             	push   -0x20(%ebp)
+  80336c:	ff 75 dc             	push   -0x24(%ebp)
+  80336f:	ff 75 d8             	push   -0x28(%ebp)
+  803372:	e8 04 12 00 00       	call   80457b <__umoddi3>
+  803377:	83 c4 14             	add    $0x14,%esp
+  80337a:	0f be 80 1f 49 80 00 	movsbl 0x80491f(%eax),%eax
+  803381:	50                   	push   %eax
+  803382:	ff d7                	call   *%edi
+}
+  803384:	83 c4 10             	add    $0x10,%esp
+  803387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338a:	5b                   	pop    %ebx
+  80338b:	5e                   	pop    %esi
+  80338c:	5f                   	pop    %edi
+  80338d:	5d                   	pop    %ebp
+  80338e:	c3                   	ret
+
+0080338f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80338f:	55                   	push   %ebp
+  803390:	89 e5                	mov    %esp,%ebp
+  803392:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803395:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803399:	8b 10                	mov    (%eax),%edx
+  80339b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80339e:	73 0a                	jae    8033aa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8033a0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8033a3:	89 08                	mov    %ecx,(%eax)
+  8033a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a8:	88 02                	mov    %al,(%edx)
+}
+  8033aa:	5d                   	pop    %ebp
+  8033ab:	c3                   	ret
+
+008033ac <printfmt>:
+{
+  8033ac:	55                   	push   %ebp
+  8033ad:	89 e5                	mov    %esp,%ebp
+  8033af:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8033b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8033b5:	50                   	push   %eax
+  8033b6:	ff 75 10             	push   0x10(%ebp)
+  8033b9:	ff 75 0c             	push   0xc(%ebp)
+  8033bc:	ff 75 08             	push   0x8(%ebp)
+  8033bf:	e8 05 00 00 00       	call   8033c9 <vprintfmt>
+}
+  8033c4:	83 c4 10             	add    $0x10,%esp
+  8033c7:	c9                   	leave
+  8033c8:	c3                   	ret
+
+008033c9 <vprintfmt>:
+{
+  8033c9:	55                   	push   %ebp
+  8033ca:	89 e5                	mov    %esp,%ebp
+  8033cc:	57                   	push   %edi
+  8033cd:	56                   	push   %esi
+  8033ce:	53                   	push   %ebx
+  8033cf:	83 ec 2c             	sub    $0x2c,%esp
+  8033d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8033d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033db:	eb 0a                	jmp    8033e7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033dd:	83 ec 08             	sub    $0x8,%esp
+  8033e0:	53                   	push   %ebx
+  8033e1:	50                   	push   %eax
+  8033e2:	ff d6                	call   *%esi
+  8033e4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033e7:	83 c7 01             	add    $0x1,%edi
+  8033ea:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033ee:	83 f8 25             	cmp    $0x25,%eax
+  8033f1:	74 0c                	je     8033ff <vprintfmt+0x36>
+			if (ch == '\0')
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	75 e6                	jne    8033dd <vprintfmt+0x14>
+}
+  8033f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fa:	5b                   	pop    %ebx
+  8033fb:	5e                   	pop    %esi
+  8033fc:	5f                   	pop    %edi
+  8033fd:	5d                   	pop    %ebp
+  8033fe:	c3                   	ret
+		padc = ' ';
+  8033ff:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  803403:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80340a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  803411:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  803418:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80341d:	8d 47 01             	lea    0x1(%edi),%eax
+  803420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803423:	0f b6 17             	movzbl (%edi),%edx
+  803426:	8d 42 dd             	lea    -0x23(%edx),%eax
+  803429:	3c 55                	cmp    $0x55,%al
+  80342b:	0f 87 c5 03 00 00    	ja     8037f6 <vprintfmt+0x42d>
+  803431:	0f b6 c0             	movzbl %al,%eax
+  803434:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  80343b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80343e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803441:	eb da                	jmp    80341d <vprintfmt+0x54>
+  803443:	0f be d2             	movsbl %dl,%edx
+  803446:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803451:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803454:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803458:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80345b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80345e:	83 f9 09             	cmp    $0x9,%ecx
+  803461:	77 55                	ja     8034b8 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803463:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803466:	eb e9                	jmp    803451 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803468:	8b 45 14             	mov    0x14(%ebp),%eax
+  80346b:	8b 00                	mov    (%eax),%eax
+  80346d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803470:	8b 45 14             	mov    0x14(%ebp),%eax
+  803473:	8d 40 04             	lea    0x4(%eax),%eax
+  803476:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803479:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80347c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803480:	79 9b                	jns    80341d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803482:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803485:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803488:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80348f:	eb 8c                	jmp    80341d <vprintfmt+0x54>
+			if (width < 0)
+  803491:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803494:	85 d2                	test   %edx,%edx
+  803496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349b:	0f 49 c2             	cmovns %edx,%eax
+  80349e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8034a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8034a4:	e9 74 ff ff ff       	jmp    80341d <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8034a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8034ac:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8034b3:	e9 65 ff ff ff       	jmp    80341d <vprintfmt+0x54>
+  8034b8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8034be:	eb bc                	jmp    80347c <vprintfmt+0xb3>
+			lflag++;
+  8034c0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8034c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8034c6:	e9 52 ff ff ff       	jmp    80341d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8034cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034ce:	8d 78 04             	lea    0x4(%eax),%edi
+  8034d1:	83 ec 08             	sub    $0x8,%esp
+  8034d4:	53                   	push   %ebx
+  8034d5:	ff 30                	push   (%eax)
+  8034d7:	ff d6                	call   *%esi
+			break;
+  8034d9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034dc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034df:	e9 b1 02 00 00       	jmp    803795 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034e7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034ea:	8b 10                	mov    (%eax),%edx
+  8034ec:	89 d0                	mov    %edx,%eax
+  8034ee:	f7 d8                	neg    %eax
+  8034f0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034f3:	83 f8 14             	cmp    $0x14,%eax
+  8034f6:	7f 23                	jg     80351b <vprintfmt+0x152>
+  8034f8:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  8034ff:	85 d2                	test   %edx,%edx
+  803501:	74 18                	je     80351b <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  803503:	52                   	push   %edx
+  803504:	68 c7 47 80 00       	push   $0x8047c7
+  803509:	53                   	push   %ebx
+  80350a:	56                   	push   %esi
+  80350b:	e8 9c fe ff ff       	call   8033ac <printfmt>
+  803510:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803513:	89 7d 14             	mov    %edi,0x14(%ebp)
+  803516:	e9 7a 02 00 00       	jmp    803795 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80351b:	50                   	push   %eax
+  80351c:	68 37 49 80 00       	push   $0x804937
+  803521:	53                   	push   %ebx
+  803522:	56                   	push   %esi
+  803523:	e8 84 fe ff ff       	call   8033ac <printfmt>
+  803528:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80352b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80352e:	e9 62 02 00 00       	jmp    803795 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803533:	8b 45 14             	mov    0x14(%ebp),%eax
+  803536:	83 c0 04             	add    $0x4,%eax
+  803539:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80353c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80353f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803541:	85 c9                	test   %ecx,%ecx
+  803543:	b8 30 49 80 00       	mov    $0x804930,%eax
+  803548:	0f 45 c1             	cmovne %ecx,%eax
+  80354b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80354e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803552:	7e 06                	jle    80355a <vprintfmt+0x191>
+  803554:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803558:	75 0b                	jne    803565 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80355a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80355d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803560:	89 75 08             	mov    %esi,0x8(%ebp)
+  803563:	eb 5c                	jmp    8035c1 <vprintfmt+0x1f8>
+  803565:	83 ec 08             	sub    $0x8,%esp
+  803568:	ff 75 d0             	push   -0x30(%ebp)
+  80356b:	ff 75 cc             	push   -0x34(%ebp)
+  80356e:	e8 20 03 00 00       	call   803893 <strnlen>
+  803573:	89 c2                	mov    %eax,%edx
+  803575:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803578:	29 d0                	sub    %edx,%eax
+  80357a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80357d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803581:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803584:	89 75 08             	mov    %esi,0x8(%ebp)
+  803587:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803589:	eb 0e                	jmp    803599 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80358b:	83 ec 08             	sub    $0x8,%esp
+  80358e:	53                   	push   %ebx
+  80358f:	57                   	push   %edi
+  803590:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803593:	83 ee 01             	sub    $0x1,%esi
+  803596:	83 c4 10             	add    $0x10,%esp
+  803599:	85 f6                	test   %esi,%esi
+  80359b:	7f ee                	jg     80358b <vprintfmt+0x1c2>
+  80359d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8035a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035a3:	85 c0                	test   %eax,%eax
+  8035a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035aa:	0f 49 d0             	cmovns %eax,%edx
+  8035ad:	29 d0                	sub    %edx,%eax
+  8035af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035b2:	eb a6                	jmp    80355a <vprintfmt+0x191>
+					putch(ch, putdat);
+  8035b4:	83 ec 08             	sub    $0x8,%esp
+  8035b7:	53                   	push   %ebx
+  8035b8:	52                   	push   %edx
+  8035b9:	ff 55 08             	call   *0x8(%ebp)
+  8035bc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8035bf:	89 f1                	mov    %esi,%ecx
+  8035c1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8035c4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8035c8:	0f be d0             	movsbl %al,%edx
+  8035cb:	85 d2                	test   %edx,%edx
+  8035cd:	74 28                	je     8035f7 <vprintfmt+0x22e>
+  8035cf:	85 ff                	test   %edi,%edi
+  8035d1:	78 05                	js     8035d8 <vprintfmt+0x20f>
+  8035d3:	83 ef 01             	sub    $0x1,%edi
+  8035d6:	78 30                	js     803608 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8035d8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035dc:	74 d6                	je     8035b4 <vprintfmt+0x1eb>
+  8035de:	0f be c0             	movsbl %al,%eax
+  8035e1:	83 e8 20             	sub    $0x20,%eax
+  8035e4:	83 f8 5e             	cmp    $0x5e,%eax
+  8035e7:	76 cb                	jbe    8035b4 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035e9:	83 ec 08             	sub    $0x8,%esp
+  8035ec:	53                   	push   %ebx
+  8035ed:	6a 3f                	push   $0x3f
+  8035ef:	ff 55 08             	call   *0x8(%ebp)
+  8035f2:	83 c4 10             	add    $0x10,%esp
+  8035f5:	eb c8                	jmp    8035bf <vprintfmt+0x1f6>
+  8035f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035fa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035fd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803600:	01 d0                	add    %edx,%eax
+  803602:	29 c8                	sub    %ecx,%eax
+  803604:	89 c7                	mov    %eax,%edi
+  803606:	eb 13                	jmp    80361b <vprintfmt+0x252>
+  803608:	8b 75 08             	mov    0x8(%ebp),%esi
+  80360b:	eb ed                	jmp    8035fa <vprintfmt+0x231>
+				putch(' ', putdat);
+  80360d:	83 ec 08             	sub    $0x8,%esp
+  803610:	53                   	push   %ebx
+  803611:	6a 20                	push   $0x20
+  803613:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  803615:	83 ef 01             	sub    $0x1,%edi
+  803618:	83 c4 10             	add    $0x10,%esp
+  80361b:	85 ff                	test   %edi,%edi
+  80361d:	7f ee                	jg     80360d <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80361f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  803622:	89 45 14             	mov    %eax,0x14(%ebp)
+  803625:	e9 6b 01 00 00       	jmp    803795 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80362a:	83 f9 01             	cmp    $0x1,%ecx
+  80362d:	7f 1f                	jg     80364e <vprintfmt+0x285>
+	else if (lflag)
+  80362f:	85 c9                	test   %ecx,%ecx
+  803631:	74 67                	je     80369a <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  803633:	8b 45 14             	mov    0x14(%ebp),%eax
+  803636:	8b 00                	mov    (%eax),%eax
+  803638:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80363b:	89 c1                	mov    %eax,%ecx
+  80363d:	c1 f9 1f             	sar    $0x1f,%ecx
+  803640:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803643:	8b 45 14             	mov    0x14(%ebp),%eax
+  803646:	8d 40 04             	lea    0x4(%eax),%eax
+  803649:	89 45 14             	mov    %eax,0x14(%ebp)
+  80364c:	eb 17                	jmp    803665 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80364e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803651:	8b 50 04             	mov    0x4(%eax),%edx
+  803654:	8b 00                	mov    (%eax),%eax
+  803656:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803659:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80365c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80365f:	8d 40 08             	lea    0x8(%eax),%eax
+  803662:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803665:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803668:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80366b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803670:	85 c9                	test   %ecx,%ecx
+  803672:	0f 89 03 01 00 00    	jns    80377b <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803678:	83 ec 08             	sub    $0x8,%esp
+  80367b:	53                   	push   %ebx
+  80367c:	6a 2d                	push   $0x2d
+  80367e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803680:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803683:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803686:	f7 da                	neg    %edx
+  803688:	83 d1 00             	adc    $0x0,%ecx
+  80368b:	f7 d9                	neg    %ecx
+  80368d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803690:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803695:	e9 e1 00 00 00       	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80369a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80369d:	8b 00                	mov    (%eax),%eax
+  80369f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8036a2:	89 c1                	mov    %eax,%ecx
+  8036a4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8036a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8036aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8036b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8036b3:	eb b0                	jmp    803665 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8036b5:	83 f9 01             	cmp    $0x1,%ecx
+  8036b8:	7f 1e                	jg     8036d8 <vprintfmt+0x30f>
+	else if (lflag)
+  8036ba:	85 c9                	test   %ecx,%ecx
+  8036bc:	74 32                	je     8036f0 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8036be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036c1:	8b 10                	mov    (%eax),%edx
+  8036c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8036cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8036d3:	e9 a3 00 00 00       	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036db:	8b 10                	mov    (%eax),%edx
+  8036dd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8036e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036eb:	e9 8b 00 00 00       	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036f3:	8b 10                	mov    (%eax),%edx
+  8036f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8036fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803700:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  803705:	eb 74                	jmp    80377b <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  803707:	83 f9 01             	cmp    $0x1,%ecx
+  80370a:	7f 1b                	jg     803727 <vprintfmt+0x35e>
+	else if (lflag)
+  80370c:	85 c9                	test   %ecx,%ecx
+  80370e:	74 2c                	je     80373c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  803710:	8b 45 14             	mov    0x14(%ebp),%eax
+  803713:	8b 10                	mov    (%eax),%edx
+  803715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80371a:	8d 40 04             	lea    0x4(%eax),%eax
+  80371d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803720:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  803725:	eb 54                	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80372a:	8b 10                	mov    (%eax),%edx
+  80372c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80372f:	8d 40 08             	lea    0x8(%eax),%eax
+  803732:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803735:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80373a:	eb 3f                	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80373c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80373f:	8b 10                	mov    (%eax),%edx
+  803741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803746:	8d 40 04             	lea    0x4(%eax),%eax
+  803749:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80374c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803751:	eb 28                	jmp    80377b <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803753:	83 ec 08             	sub    $0x8,%esp
+  803756:	53                   	push   %ebx
+  803757:	6a 30                	push   $0x30
+  803759:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80375b:	83 c4 08             	add    $0x8,%esp
+  80375e:	53                   	push   %ebx
+  80375f:	6a 78                	push   $0x78
+  803761:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803763:	8b 45 14             	mov    0x14(%ebp),%eax
+  803766:	8b 10                	mov    (%eax),%edx
+  803768:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80376d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803770:	8d 40 04             	lea    0x4(%eax),%eax
+  803773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803776:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80377b:	83 ec 0c             	sub    $0xc,%esp
+  80377e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803782:	50                   	push   %eax
+  803783:	ff 75 e0             	push   -0x20(%ebp)
+  803786:	57                   	push   %edi
+  803787:	51                   	push   %ecx
+  803788:	52                   	push   %edx
+  803789:	89 da                	mov    %ebx,%edx
+  80378b:	89 f0                	mov    %esi,%eax
+  80378d:	e8 54 fb ff ff       	call   8032e6 <printnum>
+			break;
+  803792:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803795:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803798:	e9 4a fc ff ff       	jmp    8033e7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80379d:	83 f9 01             	cmp    $0x1,%ecx
+  8037a0:	7f 1b                	jg     8037bd <vprintfmt+0x3f4>
+	else if (lflag)
+  8037a2:	85 c9                	test   %ecx,%ecx
+  8037a4:	74 2c                	je     8037d2 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8037a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037a9:	8b 10                	mov    (%eax),%edx
+  8037ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8037b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8037bb:	eb be                	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8037bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037c0:	8b 10                	mov    (%eax),%edx
+  8037c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8037c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8037c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037cb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8037d0:	eb a9                	jmp    80377b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8037d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037d5:	8b 10                	mov    (%eax),%edx
+  8037d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8037df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037e2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037e7:	eb 92                	jmp    80377b <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037e9:	83 ec 08             	sub    $0x8,%esp
+  8037ec:	53                   	push   %ebx
+  8037ed:	6a 25                	push   $0x25
+  8037ef:	ff d6                	call   *%esi
+			break;
+  8037f1:	83 c4 10             	add    $0x10,%esp
+  8037f4:	eb 9f                	jmp    803795 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037f6:	83 ec 08             	sub    $0x8,%esp
+  8037f9:	53                   	push   %ebx
+  8037fa:	6a 25                	push   $0x25
+  8037fc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037fe:	83 c4 10             	add    $0x10,%esp
+  803801:	89 f8                	mov    %edi,%eax
+  803803:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  803807:	74 05                	je     80380e <vprintfmt+0x445>
+  803809:	83 e8 01             	sub    $0x1,%eax
+  80380c:	eb f5                	jmp    803803 <vprintfmt+0x43a>
+  80380e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803811:	eb 82                	jmp    803795 <vprintfmt+0x3cc>
+
+00803813 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803813:	55                   	push   %ebp
+  803814:	89 e5                	mov    %esp,%ebp
+  803816:	83 ec 18             	sub    $0x18,%esp
+  803819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80381c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80381f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803822:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803826:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803829:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803830:	85 c0                	test   %eax,%eax
+  803832:	74 26                	je     80385a <vsnprintf+0x47>
+  803834:	85 d2                	test   %edx,%edx
+  803836:	7e 22                	jle    80385a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803838:	ff 75 14             	push   0x14(%ebp)
+  80383b:	ff 75 10             	push   0x10(%ebp)
+  80383e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803841:	50                   	push   %eax
+  803842:	68 8f 33 80 00       	push   $0x80338f
+  803847:	e8 7d fb ff ff       	call   8033c9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80384c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80384f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803852:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803855:	83 c4 10             	add    $0x10,%esp
+}
+  803858:	c9                   	leave
+  803859:	c3                   	ret
+		return -E_INVAL;
+  80385a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80385f:	eb f7                	jmp    803858 <vsnprintf+0x45>
+
+00803861 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803861:	55                   	push   %ebp
+  803862:	89 e5                	mov    %esp,%ebp
+  803864:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803867:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80386a:	50                   	push   %eax
+  80386b:	ff 75 10             	push   0x10(%ebp)
+  80386e:	ff 75 0c             	push   0xc(%ebp)
+  803871:	ff 75 08             	push   0x8(%ebp)
+  803874:	e8 9a ff ff ff       	call   803813 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803879:	c9                   	leave
+  80387a:	c3                   	ret
+
+0080387b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80387b:	55                   	push   %ebp
+  80387c:	89 e5                	mov    %esp,%ebp
+  80387e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803881:	b8 00 00 00 00       	mov    $0x0,%eax
+  803886:	eb 03                	jmp    80388b <strlen+0x10>
+		n++;
+  803888:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80388b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80388f:	75 f7                	jne    803888 <strlen+0xd>
+	return n;
+}
+  803891:	5d                   	pop    %ebp
+  803892:	c3                   	ret
+
+00803893 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803899:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80389c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a1:	eb 03                	jmp    8038a6 <strnlen+0x13>
+		n++;
+  8038a3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8038a6:	39 d0                	cmp    %edx,%eax
+  8038a8:	74 08                	je     8038b2 <strnlen+0x1f>
+  8038aa:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8038ae:	75 f3                	jne    8038a3 <strnlen+0x10>
+  8038b0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8038b2:	89 d0                	mov    %edx,%eax
+  8038b4:	5d                   	pop    %ebp
+  8038b5:	c3                   	ret
+
+008038b6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8038b6:	55                   	push   %ebp
+  8038b7:	89 e5                	mov    %esp,%ebp
+  8038b9:	53                   	push   %ebx
+  8038ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8038c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8038c9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8038cc:	83 c0 01             	add    $0x1,%eax
+  8038cf:	84 d2                	test   %dl,%dl
+  8038d1:	75 f2                	jne    8038c5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8038d3:	89 c8                	mov    %ecx,%eax
+  8038d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038d8:	c9                   	leave
+  8038d9:	c3                   	ret
+
+008038da <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8038da:	55                   	push   %ebp
+  8038db:	89 e5                	mov    %esp,%ebp
+  8038dd:	53                   	push   %ebx
+  8038de:	83 ec 10             	sub    $0x10,%esp
+  8038e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038e4:	53                   	push   %ebx
+  8038e5:	e8 91 ff ff ff       	call   80387b <strlen>
+  8038ea:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038ed:	ff 75 0c             	push   0xc(%ebp)
+  8038f0:	01 d8                	add    %ebx,%eax
+  8038f2:	50                   	push   %eax
+  8038f3:	e8 be ff ff ff       	call   8038b6 <strcpy>
+	return dst;
+}
+  8038f8:	89 d8                	mov    %ebx,%eax
+  8038fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038fd:	c9                   	leave
+  8038fe:	c3                   	ret
+
+008038ff <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038ff:	55                   	push   %ebp
+  803900:	89 e5                	mov    %esp,%ebp
+  803902:	56                   	push   %esi
+  803903:	53                   	push   %ebx
+  803904:	8b 75 08             	mov    0x8(%ebp),%esi
+  803907:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80390a:	89 f3                	mov    %esi,%ebx
+  80390c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80390f:	89 f0                	mov    %esi,%eax
+  803911:	eb 0f                	jmp    803922 <strncpy+0x23>
+		*dst++ = *src;
+  803913:	83 c0 01             	add    $0x1,%eax
+  803916:	0f b6 0a             	movzbl (%edx),%ecx
+  803919:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80391c:	80 f9 01             	cmp    $0x1,%cl
+  80391f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803922:	39 d8                	cmp    %ebx,%eax
+  803924:	75 ed                	jne    803913 <strncpy+0x14>
+	}
+	return ret;
+}
+  803926:	89 f0                	mov    %esi,%eax
+  803928:	5b                   	pop    %ebx
+  803929:	5e                   	pop    %esi
+  80392a:	5d                   	pop    %ebp
+  80392b:	c3                   	ret
+
+0080392c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80392c:	55                   	push   %ebp
+  80392d:	89 e5                	mov    %esp,%ebp
+  80392f:	56                   	push   %esi
+  803930:	53                   	push   %ebx
+  803931:	8b 75 08             	mov    0x8(%ebp),%esi
+  803934:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803937:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80393a:	89 f0                	mov    %esi,%eax
+  80393c:	85 d2                	test   %edx,%edx
+  80393e:	74 21                	je     803961 <strlcpy+0x35>
+  803940:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803944:	89 f2                	mov    %esi,%edx
+  803946:	eb 09                	jmp    803951 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803948:	83 c1 01             	add    $0x1,%ecx
+  80394b:	83 c2 01             	add    $0x1,%edx
+  80394e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803951:	39 c2                	cmp    %eax,%edx
+  803953:	74 09                	je     80395e <strlcpy+0x32>
+  803955:	0f b6 19             	movzbl (%ecx),%ebx
+  803958:	84 db                	test   %bl,%bl
+  80395a:	75 ec                	jne    803948 <strlcpy+0x1c>
+  80395c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80395e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803961:	29 f0                	sub    %esi,%eax
+}
+  803963:	5b                   	pop    %ebx
+  803964:	5e                   	pop    %esi
+  803965:	5d                   	pop    %ebp
+  803966:	c3                   	ret
+
+00803967 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803967:	55                   	push   %ebp
+  803968:	89 e5                	mov    %esp,%ebp
+  80396a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80396d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803970:	eb 06                	jmp    803978 <strcmp+0x11>
+		p++, q++;
+  803972:	83 c1 01             	add    $0x1,%ecx
+  803975:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803978:	0f b6 01             	movzbl (%ecx),%eax
+  80397b:	84 c0                	test   %al,%al
+  80397d:	74 04                	je     803983 <strcmp+0x1c>
+  80397f:	3a 02                	cmp    (%edx),%al
+  803981:	74 ef                	je     803972 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803983:	0f b6 c0             	movzbl %al,%eax
+  803986:	0f b6 12             	movzbl (%edx),%edx
+  803989:	29 d0                	sub    %edx,%eax
+}
+  80398b:	5d                   	pop    %ebp
+  80398c:	c3                   	ret
+
+0080398d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80398d:	55                   	push   %ebp
+  80398e:	89 e5                	mov    %esp,%ebp
+  803990:	53                   	push   %ebx
+  803991:	8b 45 08             	mov    0x8(%ebp),%eax
+  803994:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803997:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80399a:	eb 09                	jmp    8039a5 <strncmp+0x18>
+		n--, p++, q++;
+  80399c:	83 ea 01             	sub    $0x1,%edx
+  80399f:	83 c0 01             	add    $0x1,%eax
+  8039a2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8039a5:	85 d2                	test   %edx,%edx
+  8039a7:	74 18                	je     8039c1 <strncmp+0x34>
+  8039a9:	0f b6 18             	movzbl (%eax),%ebx
+  8039ac:	84 db                	test   %bl,%bl
+  8039ae:	74 04                	je     8039b4 <strncmp+0x27>
+  8039b0:	3a 19                	cmp    (%ecx),%bl
+  8039b2:	74 e8                	je     80399c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8039b4:	0f b6 00             	movzbl (%eax),%eax
+  8039b7:	0f b6 11             	movzbl (%ecx),%edx
+  8039ba:	29 d0                	sub    %edx,%eax
+}
+  8039bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039bf:	c9                   	leave
+  8039c0:	c3                   	ret
+		return 0;
+  8039c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c6:	eb f4                	jmp    8039bc <strncmp+0x2f>
+
+008039c8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8039c8:	55                   	push   %ebp
+  8039c9:	89 e5                	mov    %esp,%ebp
+  8039cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ce:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039d2:	eb 03                	jmp    8039d7 <strchr+0xf>
+  8039d4:	83 c0 01             	add    $0x1,%eax
+  8039d7:	0f b6 10             	movzbl (%eax),%edx
+  8039da:	84 d2                	test   %dl,%dl
+  8039dc:	74 06                	je     8039e4 <strchr+0x1c>
+		if (*s == c)
+  8039de:	38 ca                	cmp    %cl,%dl
+  8039e0:	75 f2                	jne    8039d4 <strchr+0xc>
+  8039e2:	eb 05                	jmp    8039e9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039e9:	5d                   	pop    %ebp
+  8039ea:	c3                   	ret
+
+008039eb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039eb:	55                   	push   %ebp
+  8039ec:	89 e5                	mov    %esp,%ebp
+  8039ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039f5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039f8:	38 ca                	cmp    %cl,%dl
+  8039fa:	74 09                	je     803a05 <strfind+0x1a>
+  8039fc:	84 d2                	test   %dl,%dl
+  8039fe:	74 05                	je     803a05 <strfind+0x1a>
+	for (; *s; s++)
+  803a00:	83 c0 01             	add    $0x1,%eax
+  803a03:	eb f0                	jmp    8039f5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  803a05:	5d                   	pop    %ebp
+  803a06:	c3                   	ret
+
+00803a07 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803a07:	55                   	push   %ebp
+  803a08:	89 e5                	mov    %esp,%ebp
+  803a0a:	57                   	push   %edi
+  803a0b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a0e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803a11:	85 c9                	test   %ecx,%ecx
+  803a13:	74 20                	je     803a35 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803a15:	89 f8                	mov    %edi,%eax
+  803a17:	09 c8                	or     %ecx,%eax
+  803a19:	a8 03                	test   $0x3,%al
+  803a1b:	75 12                	jne    803a2f <memset+0x28>
+		c &= 0xFF;
+  803a1d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803a21:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803a27:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803a2a:	fc                   	cld
+  803a2b:	f3 ab                	rep stos %eax,%es:(%edi)
+  803a2d:	eb 06                	jmp    803a35 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803a2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a32:	fc                   	cld
+  803a33:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803a35:	89 f8                	mov    %edi,%eax
+  803a37:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803a3a:	c9                   	leave
+  803a3b:	c3                   	ret
+
+00803a3c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a3c:	55                   	push   %ebp
+  803a3d:	89 e5                	mov    %esp,%ebp
+  803a3f:	57                   	push   %edi
+  803a40:	56                   	push   %esi
+  803a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a44:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a47:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a4a:	39 c6                	cmp    %eax,%esi
+  803a4c:	73 32                	jae    803a80 <memmove+0x44>
+  803a4e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a51:	39 d0                	cmp    %edx,%eax
+  803a53:	73 2b                	jae    803a80 <memmove+0x44>
+		s += n;
+		d += n;
+  803a55:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a58:	89 d6                	mov    %edx,%esi
+  803a5a:	09 fe                	or     %edi,%esi
+  803a5c:	09 ce                	or     %ecx,%esi
+  803a5e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a64:	75 0e                	jne    803a74 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a66:	83 ef 04             	sub    $0x4,%edi
+  803a69:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a6c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a6f:	fd                   	std
+  803a70:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a72:	eb 09                	jmp    803a7d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a74:	83 ef 01             	sub    $0x1,%edi
+  803a77:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a7a:	fd                   	std
+  803a7b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a7d:	fc                   	cld
+  803a7e:	eb 1a                	jmp    803a9a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a80:	89 f2                	mov    %esi,%edx
+  803a82:	09 c2                	or     %eax,%edx
+  803a84:	09 ca                	or     %ecx,%edx
+  803a86:	f6 c2 03             	test   $0x3,%dl
+  803a89:	75 0a                	jne    803a95 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a8b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a8e:	89 c7                	mov    %eax,%edi
+  803a90:	fc                   	cld
+  803a91:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a93:	eb 05                	jmp    803a9a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a95:	89 c7                	mov    %eax,%edi
+  803a97:	fc                   	cld
+  803a98:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a9a:	5e                   	pop    %esi
+  803a9b:	5f                   	pop    %edi
+  803a9c:	5d                   	pop    %ebp
+  803a9d:	c3                   	ret
+
+00803a9e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a9e:	55                   	push   %ebp
+  803a9f:	89 e5                	mov    %esp,%ebp
+  803aa1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803aa4:	ff 75 10             	push   0x10(%ebp)
+  803aa7:	ff 75 0c             	push   0xc(%ebp)
+  803aaa:	ff 75 08             	push   0x8(%ebp)
+  803aad:	e8 8a ff ff ff       	call   803a3c <memmove>
+}
+  803ab2:	c9                   	leave
+  803ab3:	c3                   	ret
+
+00803ab4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803ab4:	55                   	push   %ebp
+  803ab5:	89 e5                	mov    %esp,%ebp
+  803ab7:	56                   	push   %esi
+  803ab8:	53                   	push   %ebx
+  803ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803abc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803abf:	89 c6                	mov    %eax,%esi
+  803ac1:	03 75 10             	add    0x10(%ebp),%esi
+  803ac4:	eb 06                	jmp    803acc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803ac6:	83 c0 01             	add    $0x1,%eax
+  803ac9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803acc:	39 f0                	cmp    %esi,%eax
+  803ace:	74 14                	je     803ae4 <memcmp+0x30>
+		if (*s1 != *s2)
+  803ad0:	0f b6 08             	movzbl (%eax),%ecx
+  803ad3:	0f b6 1a             	movzbl (%edx),%ebx
+  803ad6:	38 d9                	cmp    %bl,%cl
+  803ad8:	74 ec                	je     803ac6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803ada:	0f b6 c1             	movzbl %cl,%eax
+  803add:	0f b6 db             	movzbl %bl,%ebx
+  803ae0:	29 d8                	sub    %ebx,%eax
+  803ae2:	eb 05                	jmp    803ae9 <memcmp+0x35>
+	}
+
+	return 0;
+  803ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ae9:	5b                   	pop    %ebx
+  803aea:	5e                   	pop    %esi
+  803aeb:	5d                   	pop    %ebp
+  803aec:	c3                   	ret
+
+00803aed <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803aed:	55                   	push   %ebp
+  803aee:	89 e5                	mov    %esp,%ebp
+  803af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803af3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803af6:	89 c2                	mov    %eax,%edx
+  803af8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803afb:	eb 03                	jmp    803b00 <memfind+0x13>
+  803afd:	83 c0 01             	add    $0x1,%eax
+  803b00:	39 d0                	cmp    %edx,%eax
+  803b02:	73 04                	jae    803b08 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803b04:	38 08                	cmp    %cl,(%eax)
+  803b06:	75 f5                	jne    803afd <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803b08:	5d                   	pop    %ebp
+  803b09:	c3                   	ret
+
+00803b0a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803b0a:	55                   	push   %ebp
+  803b0b:	89 e5                	mov    %esp,%ebp
+  803b0d:	57                   	push   %edi
+  803b0e:	56                   	push   %esi
+  803b0f:	53                   	push   %ebx
+  803b10:	8b 55 08             	mov    0x8(%ebp),%edx
+  803b13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803b16:	eb 03                	jmp    803b1b <strtol+0x11>
+		s++;
+  803b18:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803b1b:	0f b6 02             	movzbl (%edx),%eax
+  803b1e:	3c 20                	cmp    $0x20,%al
+  803b20:	74 f6                	je     803b18 <strtol+0xe>
+  803b22:	3c 09                	cmp    $0x9,%al
+  803b24:	74 f2                	je     803b18 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803b26:	3c 2b                	cmp    $0x2b,%al
+  803b28:	74 2a                	je     803b54 <strtol+0x4a>
+	int neg = 0;
+  803b2a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803b2f:	3c 2d                	cmp    $0x2d,%al
+  803b31:	74 2b                	je     803b5e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b33:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803b39:	75 0f                	jne    803b4a <strtol+0x40>
+  803b3b:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b3e:	74 28                	je     803b68 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b40:	85 db                	test   %ebx,%ebx
+  803b42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b47:	0f 44 d8             	cmove  %eax,%ebx
+  803b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b4f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b52:	eb 46                	jmp    803b9a <strtol+0x90>
+		s++;
+  803b54:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5c:	eb d5                	jmp    803b33 <strtol+0x29>
+		s++, neg = 1;
+  803b5e:	83 c2 01             	add    $0x1,%edx
+  803b61:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b66:	eb cb                	jmp    803b33 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b68:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b6c:	74 0e                	je     803b7c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b6e:	85 db                	test   %ebx,%ebx
+  803b70:	75 d8                	jne    803b4a <strtol+0x40>
+		s++, base = 8;
+  803b72:	83 c2 01             	add    $0x1,%edx
+  803b75:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b7a:	eb ce                	jmp    803b4a <strtol+0x40>
+		s += 2, base = 16;
+  803b7c:	83 c2 02             	add    $0x2,%edx
+  803b7f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b84:	eb c4                	jmp    803b4a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b86:	0f be c0             	movsbl %al,%eax
+  803b89:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b8c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b8f:	7d 3a                	jge    803bcb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b91:	83 c2 01             	add    $0x1,%edx
+  803b94:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b98:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b9a:	0f b6 02             	movzbl (%edx),%eax
+  803b9d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803ba0:	89 f3                	mov    %esi,%ebx
+  803ba2:	80 fb 09             	cmp    $0x9,%bl
+  803ba5:	76 df                	jbe    803b86 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803ba7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803baa:	89 f3                	mov    %esi,%ebx
+  803bac:	80 fb 19             	cmp    $0x19,%bl
+  803baf:	77 08                	ja     803bb9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803bb1:	0f be c0             	movsbl %al,%eax
+  803bb4:	83 e8 57             	sub    $0x57,%eax
+  803bb7:	eb d3                	jmp    803b8c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803bb9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803bbc:	89 f3                	mov    %esi,%ebx
+  803bbe:	80 fb 19             	cmp    $0x19,%bl
+  803bc1:	77 08                	ja     803bcb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803bc3:	0f be c0             	movsbl %al,%eax
+  803bc6:	83 e8 37             	sub    $0x37,%eax
+  803bc9:	eb c1                	jmp    803b8c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803bcb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803bcf:	74 05                	je     803bd6 <strtol+0xcc>
+		*endptr = (char *) s;
+  803bd1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bd4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803bd6:	89 c8                	mov    %ecx,%eax
+  803bd8:	f7 d8                	neg    %eax
+  803bda:	85 ff                	test   %edi,%edi
+  803bdc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803bdf:	89 c8                	mov    %ecx,%eax
+  803be1:	5b                   	pop    %ebx
+  803be2:	5e                   	pop    %esi
+  803be3:	5f                   	pop    %edi
+  803be4:	5d                   	pop    %ebp
+  803be5:	c3                   	ret
+
+00803be6 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803be6:	55                   	push   %ebp
+  803be7:	89 e5                	mov    %esp,%ebp
+  803be9:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bec:	6a 00                	push   $0x0
+  803bee:	6a 00                	push   $0x0
+  803bf0:	ff 75 08             	push   0x8(%ebp)
+  803bf3:	e8 12 ff ff ff       	call   803b0a <strtol>
+}
+  803bf8:	c9                   	leave
+  803bf9:	c3                   	ret
+
+00803bfa <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803bfa:	55                   	push   %ebp
+  803bfb:	89 e5                	mov    %esp,%ebp
+  803bfd:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803c00:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803c07:	74 0a                	je     803c13 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c0c:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803c11:	c9                   	leave
+  803c12:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  803c13:	83 ec 04             	sub    $0x4,%esp
+  803c16:	6a 07                	push   $0x7
+  803c18:	68 00 f0 bf ee       	push   $0xeebff000
+  803c1d:	6a 00                	push   $0x0
+  803c1f:	e8 cd c5 ff ff       	call   8001f1 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803c24:	83 c4 08             	add    $0x8,%esp
+  803c27:	68 93 06 80 00       	push   $0x800693
+  803c2c:	6a 00                	push   $0x0
+  803c2e:	e8 3b c7 ff ff       	call   80036e <sys_env_set_pgfault_upcall>
+  803c33:	83 c4 10             	add    $0x10,%esp
+  803c36:	eb d1                	jmp    803c09 <set_pgfault_handler+0xf>
+
+00803c38 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c38:	55                   	push   %ebp
+  803c39:	89 e5                	mov    %esp,%ebp
+  803c3b:	57                   	push   %edi
+  803c3c:	56                   	push   %esi
+  803c3d:	53                   	push   %ebx
+  803c3e:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c41:	89 d6                	mov    %edx,%esi
+  803c43:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c46:	89 cf                	mov    %ecx,%edi
+  803c48:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c4b:	89 fa                	mov    %edi,%edx
+  803c4d:	80 ce 08             	or     $0x8,%dh
+  803c50:	f6 c5 08             	test   $0x8,%ch
+  803c53:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c56:	57                   	push   %edi
+  803c57:	56                   	push   %esi
+  803c58:	50                   	push   %eax
+  803c59:	56                   	push   %esi
+  803c5a:	6a 00                	push   $0x0
+  803c5c:	e8 dd c5 ff ff       	call   80023e <sys_page_map>
+	if (r < 0) {
+  803c61:	83 c4 20             	add    $0x20,%esp
+  803c64:	85 c0                	test   %eax,%eax
+  803c66:	78 27                	js     803c8f <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c68:	83 ec 0c             	sub    $0xc,%esp
+  803c6b:	57                   	push   %edi
+  803c6c:	56                   	push   %esi
+  803c6d:	6a 00                	push   $0x0
+  803c6f:	56                   	push   %esi
+  803c70:	6a 00                	push   $0x0
+  803c72:	e8 c7 c5 ff ff       	call   80023e <sys_page_map>
+  803c77:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c79:	83 c4 20             	add    $0x20,%esp
+  803c7c:	85 c0                	test   %eax,%eax
+  803c7e:	78 24                	js     803ca4 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c85:	89 d8                	mov    %ebx,%eax
+  803c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c8a:	5b                   	pop    %ebx
+  803c8b:	5e                   	pop    %esi
+  803c8c:	5f                   	pop    %edi
+  803c8d:	5d                   	pop    %ebp
+  803c8e:	c3                   	ret
+  803c8f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c91:	83 ec 08             	sub    $0x8,%esp
+  803c94:	50                   	push   %eax
+  803c95:	68 98 4c 80 00       	push   $0x804c98
+  803c9a:	e8 33 f6 ff ff       	call   8032d2 <cprintf>
+		return r;
+  803c9f:	83 c4 10             	add    $0x10,%esp
+  803ca2:	eb e1                	jmp    803c85 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803ca4:	83 ec 08             	sub    $0x8,%esp
+  803ca7:	50                   	push   %eax
+  803ca8:	68 c8 4c 80 00       	push   $0x804cc8
+  803cad:	e8 20 f6 ff ff       	call   8032d2 <cprintf>
+		return r;
+  803cb2:	83 c4 10             	add    $0x10,%esp
+  803cb5:	eb ce                	jmp    803c85 <duppage_cow+0x4d>
+
+00803cb7 <duppage>:
+{
+  803cb7:	55                   	push   %ebp
+  803cb8:	89 e5                	mov    %esp,%ebp
+  803cba:	53                   	push   %ebx
+  803cbb:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803cbe:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803cc1:	51                   	push   %ecx
+  803cc2:	52                   	push   %edx
+  803cc3:	50                   	push   %eax
+  803cc4:	52                   	push   %edx
+  803cc5:	6a 00                	push   $0x0
+  803cc7:	e8 72 c5 ff ff       	call   80023e <sys_page_map>
+	if (r < 0) {
+  803ccc:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	78 07                	js     803cdf <duppage+0x28>
+}
+  803cd8:	89 d8                	mov    %ebx,%eax
+  803cda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cdd:	c9                   	leave
+  803cde:	c3                   	ret
+  803cdf:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803ce1:	83 ec 08             	sub    $0x8,%esp
+  803ce4:	50                   	push   %eax
+  803ce5:	68 98 4c 80 00       	push   $0x804c98
+  803cea:	e8 e3 f5 ff ff       	call   8032d2 <cprintf>
+		return r;
+  803cef:	83 c4 10             	add    $0x10,%esp
+  803cf2:	eb e4                	jmp    803cd8 <duppage+0x21>
+
+00803cf4 <cow_copy>:
+{
+  803cf4:	55                   	push   %ebp
+  803cf5:	89 e5                	mov    %esp,%ebp
+  803cf7:	56                   	push   %esi
+  803cf8:	53                   	push   %ebx
+  803cf9:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803cfb:	83 ec 04             	sub    $0x4,%esp
+  803cfe:	6a 07                	push   $0x7
+  803d00:	68 00 f0 7f 00       	push   $0x7ff000
+  803d05:	6a 00                	push   $0x0
+  803d07:	e8 e5 c4 ff ff       	call   8001f1 <sys_page_alloc>
+	if (r < 0) {
+  803d0c:	83 c4 10             	add    $0x10,%esp
+  803d0f:	85 c0                	test   %eax,%eax
+  803d11:	78 58                	js     803d6b <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d13:	83 ec 04             	sub    $0x4,%esp
+  803d16:	68 00 10 00 00       	push   $0x1000
+  803d1b:	56                   	push   %esi
+  803d1c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d21:	e8 16 fd ff ff       	call   803a3c <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d26:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d2d:	56                   	push   %esi
+  803d2e:	6a 00                	push   $0x0
+  803d30:	68 00 f0 7f 00       	push   $0x7ff000
+  803d35:	6a 00                	push   $0x0
+  803d37:	e8 02 c5 ff ff       	call   80023e <sys_page_map>
+  803d3c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d3e:	83 c4 20             	add    $0x20,%esp
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	78 3b                	js     803d80 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d45:	83 ec 08             	sub    $0x8,%esp
+  803d48:	68 00 f0 7f 00       	push   $0x7ff000
+  803d4d:	6a 00                	push   $0x0
+  803d4f:	e8 36 c5 ff ff       	call   80028a <sys_page_unmap>
+  803d54:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d56:	83 c4 10             	add    $0x10,%esp
+  803d59:	85 c0                	test   %eax,%eax
+  803d5b:	78 45                	js     803da2 <cow_copy+0xae>
+	return 0;
+  803d5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d62:	89 d8                	mov    %ebx,%eax
+  803d64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d67:	5b                   	pop    %ebx
+  803d68:	5e                   	pop    %esi
+  803d69:	5d                   	pop    %ebp
+  803d6a:	c3                   	ret
+  803d6b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d6d:	83 ec 08             	sub    $0x8,%esp
+  803d70:	50                   	push   %eax
+  803d71:	68 b8 4d 80 00       	push   $0x804db8
+  803d76:	e8 57 f5 ff ff       	call   8032d2 <cprintf>
+		return r;
+  803d7b:	83 c4 10             	add    $0x10,%esp
+  803d7e:	eb e2                	jmp    803d62 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d80:	83 ec 08             	sub    $0x8,%esp
+  803d83:	50                   	push   %eax
+  803d84:	68 d4 4d 80 00       	push   $0x804dd4
+  803d89:	e8 44 f5 ff ff       	call   8032d2 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d8e:	83 c4 08             	add    $0x8,%esp
+  803d91:	68 00 f0 7f 00       	push   $0x7ff000
+  803d96:	6a 00                	push   $0x0
+  803d98:	e8 ed c4 ff ff       	call   80028a <sys_page_unmap>
+		return r;
+  803d9d:	83 c4 10             	add    $0x10,%esp
+  803da0:	eb c0                	jmp    803d62 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803da2:	83 ec 08             	sub    $0x8,%esp
+  803da5:	50                   	push   %eax
+  803da6:	68 f0 4c 80 00       	push   $0x804cf0
+  803dab:	e8 22 f5 ff ff       	call   8032d2 <cprintf>
+		return r;
+  803db0:	83 c4 10             	add    $0x10,%esp
+  803db3:	eb ad                	jmp    803d62 <cow_copy+0x6e>
+
+00803db5 <pgfault>:
+{
+  803db5:	55                   	push   %ebp
+  803db6:	89 e5                	mov    %esp,%ebp
+  803db8:	56                   	push   %esi
+  803db9:	53                   	push   %ebx
+  803dba:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803dbd:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803dbf:	89 d8                	mov    %ebx,%eax
+  803dc1:	c1 e8 16             	shr    $0x16,%eax
+  803dc4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803dcb:	89 de                	mov    %ebx,%esi
+  803dcd:	c1 ee 0c             	shr    $0xc,%esi
+  803dd0:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803dd7:	a8 07                	test   $0x7,%al
+  803dd9:	74 3b                	je     803e16 <pgfault+0x61>
+  803ddb:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803de1:	74 33                	je     803e16 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803de3:	83 ec 0c             	sub    $0xc,%esp
+  803de6:	68 00 f0 bf ee       	push   $0xeebff000
+  803deb:	e8 87 ea ff ff       	call   802877 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803df0:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803df7:	83 c4 10             	add    $0x10,%esp
+  803dfa:	f6 c4 08             	test   $0x8,%ah
+  803dfd:	75 30                	jne    803e2f <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803dff:	83 ec 0c             	sub    $0xc,%esp
+  803e02:	68 00 f0 bf ee       	push   $0xeebff000
+  803e07:	e8 d8 ea ff ff       	call   8028e4 <mutex_unlock>
+}
+  803e0c:	83 c4 10             	add    $0x10,%esp
+  803e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e12:	5b                   	pop    %ebx
+  803e13:	5e                   	pop    %esi
+  803e14:	5d                   	pop    %ebp
+  803e15:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e16:	83 ec 08             	sub    $0x8,%esp
+  803e19:	ff 72 28             	push   0x28(%edx)
+  803e1c:	51                   	push   %ecx
+  803e1d:	50                   	push   %eax
+  803e1e:	68 14 4d 80 00       	push   $0x804d14
+  803e23:	6a 3f                	push   $0x3f
+  803e25:	68 ee 4d 80 00       	push   $0x804dee
+  803e2a:	e8 c8 f3 ff ff       	call   8031f7 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e2f:	89 d8                	mov    %ebx,%eax
+  803e31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e36:	e8 b9 fe ff ff       	call   803cf4 <cow_copy>
+  803e3b:	eb c2                	jmp    803dff <pgfault+0x4a>
+
+00803e3d <cow_enable>:
+{
+  803e3d:	55                   	push   %ebp
+  803e3e:	89 e5                	mov    %esp,%ebp
+  803e40:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e43:	68 b5 3d 80 00       	push   $0x803db5
+  803e48:	e8 ad fd ff ff       	call   803bfa <set_pgfault_handler>
+}
+  803e4d:	83 c4 10             	add    $0x10,%esp
+  803e50:	c9                   	leave
+  803e51:	c3                   	ret
+
+00803e52 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e52:	55                   	push   %ebp
+  803e53:	89 e5                	mov    %esp,%ebp
+  803e55:	57                   	push   %edi
+  803e56:	56                   	push   %esi
+  803e57:	53                   	push   %ebx
+  803e58:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e5b:	68 b5 3d 80 00       	push   $0x803db5
+  803e60:	e8 95 fd ff ff       	call   803bfa <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e65:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e6a:	cd 30                	int    $0x30
+  803e6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e6f:	83 c4 10             	add    $0x10,%esp
+  803e72:	85 c0                	test   %eax,%eax
+  803e74:	78 4b                	js     803ec1 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e76:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e83:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e87:	0f 85 16 01 00 00    	jne    803fa3 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e8d:	e8 07 c3 ff ff       	call   800199 <sys_getenvid>
+  803e92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e97:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e99:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e9f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ea5:	77 32                	ja     803ed9 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ea7:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803eac:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803eae:	c1 ea 10             	shr    $0x10,%edx
+  803eb1:	74 26                	je     803ed9 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803eb3:	c1 e2 10             	shl    $0x10,%edx
+  803eb6:	89 d1                	mov    %edx,%ecx
+  803eb8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ebd:	29 ca                	sub    %ecx,%edx
+  803ebf:	eb 1e                	jmp    803edf <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803ec1:	83 ec 08             	sub    $0x8,%esp
+  803ec4:	89 c7                	mov    %eax,%edi
+  803ec6:	50                   	push   %eax
+  803ec7:	68 f9 4d 80 00       	push   $0x804df9
+  803ecc:	e8 01 f4 ff ff       	call   8032d2 <cprintf>
+		return eid;
+  803ed1:	83 c4 10             	add    $0x10,%esp
+  803ed4:	e9 6c 01 00 00       	jmp    804045 <fork+0x1f3>
+		return pthread_main_tls;
+  803ed9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803edf:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803ee2:	c1 e0 04             	shl    $0x4,%eax
+  803ee5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803eea:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803eec:	e8 cf f0 ff ff       	call   802fc0 <pthread_fork_child>
+		return eid;
+  803ef1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803ef4:	e9 4c 01 00 00       	jmp    804045 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ef9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eff:	89 da                	mov    %ebx,%edx
+  803f01:	89 f8                	mov    %edi,%eax
+  803f03:	e8 af fd ff ff       	call   803cb7 <duppage>
+  803f08:	85 c0                	test   %eax,%eax
+  803f0a:	79 28                	jns    803f34 <fork+0xe2>
+  803f0c:	89 c7                	mov    %eax,%edi
+  803f0e:	e9 32 01 00 00       	jmp    804045 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f13:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f19:	83 f9 05             	cmp    $0x5,%ecx
+  803f1c:	75 58                	jne    803f76 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f1e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f23:	89 da                	mov    %ebx,%edx
+  803f25:	89 f8                	mov    %edi,%eax
+  803f27:	e8 8b fd ff ff       	call   803cb7 <duppage>
+  803f2c:	85 c0                	test   %eax,%eax
+  803f2e:	0f 88 0f 01 00 00    	js     804043 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f34:	83 c3 01             	add    $0x1,%ebx
+  803f37:	39 de                	cmp    %ebx,%esi
+  803f39:	74 54                	je     803f8f <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f3b:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f42:	f6 c1 05             	test   $0x5,%cl
+  803f45:	74 ed                	je     803f34 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f47:	f6 c5 04             	test   $0x4,%ch
+  803f4a:	75 ad                	jne    803ef9 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f4c:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f52:	74 bf                	je     803f13 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f54:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f5a:	74 d8                	je     803f34 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f5c:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f62:	89 da                	mov    %ebx,%edx
+  803f64:	89 f8                	mov    %edi,%eax
+  803f66:	e8 cd fc ff ff       	call   803c38 <duppage_cow>
+  803f6b:	85 c0                	test   %eax,%eax
+  803f6d:	79 c5                	jns    803f34 <fork+0xe2>
+  803f6f:	89 c7                	mov    %eax,%edi
+  803f71:	e9 cf 00 00 00       	jmp    804045 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f76:	68 44 4d 80 00       	push   $0x804d44
+  803f7b:	68 b5 47 80 00       	push   $0x8047b5
+  803f80:	68 c6 00 00 00       	push   $0xc6
+  803f85:	68 ee 4d 80 00       	push   $0x804dee
+  803f8a:	e8 68 f2 ff ff       	call   8031f7 <_panic>
+  803f8f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f92:	83 c1 01             	add    $0x1,%ecx
+  803f95:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f9b:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803fa1:	74 18                	je     803fbb <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803fa3:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803faa:	a8 07                	test   $0x7,%al
+  803fac:	74 e4                	je     803f92 <fork+0x140>
+  803fae:	89 cb                	mov    %ecx,%ebx
+  803fb0:	c1 e3 0a             	shl    $0xa,%ebx
+  803fb3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803fb6:	e9 7c ff ff ff       	jmp    803f37 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803fbb:	83 ec 04             	sub    $0x4,%esp
+  803fbe:	6a 07                	push   $0x7
+  803fc0:	68 00 f0 bf ee       	push   $0xeebff000
+  803fc5:	ff 75 e4             	push   -0x1c(%ebp)
+  803fc8:	e8 24 c2 ff ff       	call   8001f1 <sys_page_alloc>
+  803fcd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fcf:	83 c4 10             	add    $0x10,%esp
+  803fd2:	85 c0                	test   %eax,%eax
+  803fd4:	78 34                	js     80400a <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803fd6:	83 ec 08             	sub    $0x8,%esp
+  803fd9:	68 93 06 80 00       	push   $0x800693
+  803fde:	ff 75 e4             	push   -0x1c(%ebp)
+  803fe1:	e8 88 c3 ff ff       	call   80036e <sys_env_set_pgfault_upcall>
+  803fe6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fe8:	83 c4 10             	add    $0x10,%esp
+  803feb:	85 c0                	test   %eax,%eax
+  803fed:	78 2e                	js     80401d <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803fef:	83 ec 08             	sub    $0x8,%esp
+  803ff2:	6a 02                	push   $0x2
+  803ff4:	ff 75 e4             	push   -0x1c(%ebp)
+  803ff7:	e8 da c2 ff ff       	call   8002d6 <sys_env_set_status>
+  803ffc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803ffe:	83 c4 10             	add    $0x10,%esp
+  804001:	85 c0                	test   %eax,%eax
+  804003:	78 2b                	js     804030 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804005:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804008:	eb 3b                	jmp    804045 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80400a:	83 ec 08             	sub    $0x8,%esp
+  80400d:	50                   	push   %eax
+  80400e:	68 6c 4d 80 00       	push   $0x804d6c
+  804013:	e8 ba f2 ff ff       	call   8032d2 <cprintf>
+		return r;
+  804018:	83 c4 10             	add    $0x10,%esp
+  80401b:	eb 28                	jmp    804045 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80401d:	83 ec 08             	sub    $0x8,%esp
+  804020:	50                   	push   %eax
+  804021:	68 94 4d 80 00       	push   $0x804d94
+  804026:	e8 a7 f2 ff ff       	call   8032d2 <cprintf>
+		return r;
+  80402b:	83 c4 10             	add    $0x10,%esp
+  80402e:	eb 15                	jmp    804045 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804030:	83 ec 08             	sub    $0x8,%esp
+  804033:	50                   	push   %eax
+  804034:	68 09 4e 80 00       	push   $0x804e09
+  804039:	e8 94 f2 ff ff       	call   8032d2 <cprintf>
+		return r;
+  80403e:	83 c4 10             	add    $0x10,%esp
+  804041:	eb 02                	jmp    804045 <fork+0x1f3>
+  804043:	89 c7                	mov    %eax,%edi
+}
+  804045:	89 f8                	mov    %edi,%eax
+  804047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80404a:	5b                   	pop    %ebx
+  80404b:	5e                   	pop    %esi
+  80404c:	5f                   	pop    %edi
+  80404d:	5d                   	pop    %ebp
+  80404e:	c3                   	ret
+
+0080404f <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80404f:	55                   	push   %ebp
+  804050:	89 e5                	mov    %esp,%ebp
+  804052:	57                   	push   %edi
+  804053:	56                   	push   %esi
+  804054:	53                   	push   %ebx
+  804055:	83 ec 2c             	sub    $0x2c,%esp
+  804058:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80405a:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804060:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804065:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80406b:	77 0a                	ja     804077 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80406d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804072:	29 c3                	sub    %eax,%ebx
+  804074:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804077:	83 ec 0c             	sub    $0xc,%esp
+  80407a:	68 b5 3d 80 00       	push   $0x803db5
+  80407f:	e8 76 fb ff ff       	call   803bfa <set_pgfault_handler>
+  804084:	b8 07 00 00 00       	mov    $0x7,%eax
+  804089:	cd 30                	int    $0x30
+  80408b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80408e:	83 c4 10             	add    $0x10,%esp
+  804091:	85 c0                	test   %eax,%eax
+  804093:	78 30                	js     8040c5 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804095:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804099:	74 42                	je     8040dd <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80409b:	c1 e3 10             	shl    $0x10,%ebx
+  80409e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8040a3:	29 d8                	sub    %ebx,%eax
+  8040a5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040a8:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8040ad:	29 d8                	sub    %ebx,%eax
+  8040af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040b2:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040bc:	89 f7                	mov    %esi,%edi
+  8040be:	89 d6                	mov    %edx,%esi
+  8040c0:	e9 2c 01 00 00       	jmp    8041f1 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8040c5:	83 ec 08             	sub    $0x8,%esp
+  8040c8:	89 c7                	mov    %eax,%edi
+  8040ca:	50                   	push   %eax
+  8040cb:	68 f9 4d 80 00       	push   $0x804df9
+  8040d0:	e8 fd f1 ff ff       	call   8032d2 <cprintf>
+		return eid;
+  8040d5:	83 c4 10             	add    $0x10,%esp
+  8040d8:	e9 d5 00 00 00       	jmp    8041b2 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8040dd:	e8 b7 c0 ff ff       	call   800199 <sys_getenvid>
+  8040e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040e7:	89 c2                	mov    %eax,%edx
+  8040e9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040eb:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8040f1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040f6:	77 18                	ja     804110 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040f8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040fd:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040ff:	c1 e8 10             	shr    $0x10,%eax
+  804102:	74 0c                	je     804110 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804104:	c1 e0 10             	shl    $0x10,%eax
+  804107:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80410c:	29 c1                	sub    %eax,%ecx
+  80410e:	eb 06                	jmp    804116 <sfork+0xc7>
+		return pthread_main_tls;
+  804110:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804116:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804119:	c1 e0 04             	shl    $0x4,%eax
+  80411c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804121:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804123:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804126:	e9 87 00 00 00       	jmp    8041b2 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80412b:	f6 c5 04             	test   $0x4,%ch
+  80412e:	74 6c                	je     80419c <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804130:	89 ca                	mov    %ecx,%edx
+  804132:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804138:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80413e:	74 7c                	je     8041bc <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804140:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804146:	89 da                	mov    %ebx,%edx
+  804148:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80414b:	e8 67 fb ff ff       	call   803cb7 <duppage>
+  804150:	85 c0                	test   %eax,%eax
+  804152:	0f 88 4f 01 00 00    	js     8042a7 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804158:	83 c3 01             	add    $0x1,%ebx
+  80415b:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80415e:	74 7a                	je     8041da <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804160:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804162:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804169:	f6 c1 01             	test   $0x1,%cl
+  80416c:	74 ea                	je     804158 <sfork+0x109>
+  80416e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804174:	74 e2                	je     804158 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804176:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80417c:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80417f:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804184:	76 a5                	jbe    80412b <sfork+0xdc>
+  804186:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80418c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80418f:	39 fa                	cmp    %edi,%edx
+  804191:	73 9d                	jae    804130 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804193:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804196:	39 fa                	cmp    %edi,%edx
+  804198:	72 96                	jb     804130 <sfork+0xe1>
+  80419a:	eb 8f                	jmp    80412b <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80419c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041a2:	89 da                	mov    %ebx,%edx
+  8041a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041a7:	e8 8c fa ff ff       	call   803c38 <duppage_cow>
+  8041ac:	85 c0                	test   %eax,%eax
+  8041ae:	79 a8                	jns    804158 <sfork+0x109>
+  8041b0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8041b2:	89 f8                	mov    %edi,%eax
+  8041b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041b7:	5b                   	pop    %ebx
+  8041b8:	5e                   	pop    %esi
+  8041b9:	5f                   	pop    %edi
+  8041ba:	5d                   	pop    %ebp
+  8041bb:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8041bc:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8041c1:	e8 2e fb ff ff       	call   803cf4 <cow_copy>
+  8041c6:	85 c0                	test   %eax,%eax
+  8041c8:	0f 88 d2 00 00 00    	js     8042a0 <sfork+0x251>
+				pte = uvpt[pn];
+  8041ce:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8041d5:	e9 66 ff ff ff       	jmp    804140 <sfork+0xf1>
+  8041da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8041dd:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041e0:	83 c6 01             	add    $0x1,%esi
+  8041e3:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8041e9:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8041ef:	74 1b                	je     80420c <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8041f1:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8041f8:	a8 01                	test   $0x1,%al
+  8041fa:	74 e4                	je     8041e0 <sfork+0x191>
+  8041fc:	89 f3                	mov    %esi,%ebx
+  8041fe:	c1 e3 0a             	shl    $0xa,%ebx
+  804201:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804204:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804207:	e9 4f ff ff ff       	jmp    80415b <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80420c:	83 ec 04             	sub    $0x4,%esp
+  80420f:	6a 07                	push   $0x7
+  804211:	68 00 f0 bf ee       	push   $0xeebff000
+  804216:	ff 75 e0             	push   -0x20(%ebp)
+  804219:	e8 d3 bf ff ff       	call   8001f1 <sys_page_alloc>
+  80421e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804220:	83 c4 10             	add    $0x10,%esp
+  804223:	85 c0                	test   %eax,%eax
+  804225:	78 37                	js     80425e <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804227:	83 ec 08             	sub    $0x8,%esp
+  80422a:	68 93 06 80 00       	push   $0x800693
+  80422f:	ff 75 e0             	push   -0x20(%ebp)
+  804232:	e8 37 c1 ff ff       	call   80036e <sys_env_set_pgfault_upcall>
+  804237:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804239:	83 c4 10             	add    $0x10,%esp
+  80423c:	85 c0                	test   %eax,%eax
+  80423e:	78 34                	js     804274 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804240:	83 ec 08             	sub    $0x8,%esp
+  804243:	6a 02                	push   $0x2
+  804245:	ff 75 e0             	push   -0x20(%ebp)
+  804248:	e8 89 c0 ff ff       	call   8002d6 <sys_env_set_status>
+  80424d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80424f:	83 c4 10             	add    $0x10,%esp
+  804252:	85 c0                	test   %eax,%eax
+  804254:	78 34                	js     80428a <sfork+0x23b>
+	return eid;
+  804256:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804259:	e9 54 ff ff ff       	jmp    8041b2 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80425e:	83 ec 08             	sub    $0x8,%esp
+  804261:	50                   	push   %eax
+  804262:	68 6c 4d 80 00       	push   $0x804d6c
+  804267:	e8 66 f0 ff ff       	call   8032d2 <cprintf>
+		return r;
+  80426c:	83 c4 10             	add    $0x10,%esp
+  80426f:	e9 3e ff ff ff       	jmp    8041b2 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804274:	83 ec 08             	sub    $0x8,%esp
+  804277:	50                   	push   %eax
+  804278:	68 94 4d 80 00       	push   $0x804d94
+  80427d:	e8 50 f0 ff ff       	call   8032d2 <cprintf>
+		return r;
+  804282:	83 c4 10             	add    $0x10,%esp
+  804285:	e9 28 ff ff ff       	jmp    8041b2 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80428a:	83 ec 08             	sub    $0x8,%esp
+  80428d:	50                   	push   %eax
+  80428e:	68 09 4e 80 00       	push   $0x804e09
+  804293:	e8 3a f0 ff ff       	call   8032d2 <cprintf>
+		return r;
+  804298:	83 c4 10             	add    $0x10,%esp
+  80429b:	e9 12 ff ff ff       	jmp    8041b2 <sfork+0x163>
+  8042a0:	89 c7                	mov    %eax,%edi
+  8042a2:	e9 0b ff ff ff       	jmp    8041b2 <sfork+0x163>
+  8042a7:	89 c7                	mov    %eax,%edi
+  8042a9:	e9 04 ff ff ff       	jmp    8041b2 <sfork+0x163>
+
+008042ae <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042ae:	55                   	push   %ebp
+  8042af:	89 e5                	mov    %esp,%ebp
+  8042b1:	57                   	push   %edi
+  8042b2:	56                   	push   %esi
+  8042b3:	53                   	push   %ebx
+  8042b4:	83 ec 18             	sub    $0x18,%esp
+  8042b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8042c7:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8042ca:	50                   	push   %eax
+  8042cb:	e8 17 c1 ff ff       	call   8003e7 <sys_ipc_recv>
+	if (r < 0) {
+  8042d0:	83 c4 10             	add    $0x10,%esp
+  8042d3:	85 c0                	test   %eax,%eax
+  8042d5:	78 2b                	js     804302 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8042d7:	85 ff                	test   %edi,%edi
+  8042d9:	74 55                	je     804330 <ipc_recv+0x82>
+  8042db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042e8:	77 39                	ja     804323 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042ef:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042f1:	c1 e8 10             	shr    $0x10,%eax
+  8042f4:	74 2d                	je     804323 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042f6:	c1 e0 10             	shl    $0x10,%eax
+  8042f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042fe:	29 c2                	sub    %eax,%edx
+  804300:	eb 27                	jmp    804329 <ipc_recv+0x7b>
+  804302:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804304:	83 ec 08             	sub    $0x8,%esp
+  804307:	50                   	push   %eax
+  804308:	68 27 4e 80 00       	push   $0x804e27
+  80430d:	e8 c0 ef ff ff       	call   8032d2 <cprintf>
+		*from_env_store = 0;
+  804312:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804318:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80431e:	83 c4 10             	add    $0x10,%esp
+  804321:	eb 77                	jmp    80439a <ipc_recv+0xec>
+		return pthread_main_tls;
+  804323:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804329:	8b 02                	mov    (%edx),%eax
+  80432b:	8b 40 78             	mov    0x78(%eax),%eax
+  80432e:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804330:	85 f6                	test   %esi,%esi
+  804332:	74 34                	je     804368 <ipc_recv+0xba>
+  804334:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804336:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80433c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804341:	77 18                	ja     80435b <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804343:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804348:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80434a:	c1 e8 10             	shr    $0x10,%eax
+  80434d:	74 0c                	je     80435b <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80434f:	c1 e0 10             	shl    $0x10,%eax
+  804352:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804357:	29 c2                	sub    %eax,%edx
+  804359:	eb 06                	jmp    804361 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80435b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804361:	8b 02                	mov    (%edx),%eax
+  804363:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804366:	89 06                	mov    %eax,(%esi)
+  804368:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80436a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804370:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804375:	77 18                	ja     80438f <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804377:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80437c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80437e:	c1 e8 10             	shr    $0x10,%eax
+  804381:	74 0c                	je     80438f <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804383:	c1 e0 10             	shl    $0x10,%eax
+  804386:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80438b:	29 c2                	sub    %eax,%edx
+  80438d:	eb 06                	jmp    804395 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80438f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804395:	8b 02                	mov    (%edx),%eax
+  804397:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80439a:	89 d8                	mov    %ebx,%eax
+  80439c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80439f:	5b                   	pop    %ebx
+  8043a0:	5e                   	pop    %esi
+  8043a1:	5f                   	pop    %edi
+  8043a2:	5d                   	pop    %ebp
+  8043a3:	c3                   	ret
+
+008043a4 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8043a4:	55                   	push   %ebp
+  8043a5:	89 e5                	mov    %esp,%ebp
+  8043a7:	57                   	push   %edi
+  8043a8:	56                   	push   %esi
+  8043a9:	53                   	push   %ebx
+  8043aa:	83 ec 0c             	sub    $0xc,%esp
+  8043ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043b6:	85 db                	test   %ebx,%ebx
+  8043b8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8043bd:	0f 44 d8             	cmove  %eax,%ebx
+  8043c0:	eb 05                	jmp    8043c7 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8043c2:	e8 fe bd ff ff       	call   8001c5 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8043c7:	57                   	push   %edi
+  8043c8:	53                   	push   %ebx
+  8043c9:	ff 75 0c             	push   0xc(%ebp)
+  8043cc:	56                   	push   %esi
+  8043cd:	e8 e8 bf ff ff       	call   8003ba <sys_ipc_try_send>
+		if (r == 0) {
+  8043d2:	83 c4 10             	add    $0x10,%esp
+  8043d5:	85 c0                	test   %eax,%eax
+  8043d7:	74 19                	je     8043f2 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8043d9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8043dc:	74 e4                	je     8043c2 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8043de:	83 ec 0c             	sub    $0xc,%esp
+  8043e1:	50                   	push   %eax
+  8043e2:	57                   	push   %edi
+  8043e3:	53                   	push   %ebx
+  8043e4:	56                   	push   %esi
+  8043e5:	68 40 4e 80 00       	push   $0x804e40
+  8043ea:	e8 e3 ee ff ff       	call   8032d2 <cprintf>
+			return;
+  8043ef:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8043f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043f5:	5b                   	pop    %ebx
+  8043f6:	5e                   	pop    %esi
+  8043f7:	5f                   	pop    %edi
+  8043f8:	5d                   	pop    %ebp
+  8043f9:	c3                   	ret
+
+008043fa <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8043fa:	55                   	push   %ebp
+  8043fb:	89 e5                	mov    %esp,%ebp
+  8043fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804400:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804405:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804408:	c1 e0 04             	shl    $0x4,%eax
+  80440b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804410:	8b 40 50             	mov    0x50(%eax),%eax
+  804413:	39 c8                	cmp    %ecx,%eax
+  804415:	74 12                	je     804429 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804417:	83 c2 01             	add    $0x1,%edx
+  80441a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804420:	75 e3                	jne    804405 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804422:	b8 00 00 00 00       	mov    $0x0,%eax
+  804427:	eb 0e                	jmp    804437 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804429:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80442c:	c1 e0 04             	shl    $0x4,%eax
+  80442f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804434:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804437:	5d                   	pop    %ebp
+  804438:	c3                   	ret
+
+00804439 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804439:	55                   	push   %ebp
+  80443a:	89 e5                	mov    %esp,%ebp
+  80443c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80443f:	89 c2                	mov    %eax,%edx
+  804441:	c1 ea 16             	shr    $0x16,%edx
+  804444:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80444b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804450:	f6 c1 01             	test   $0x1,%cl
+  804453:	74 1c                	je     804471 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804455:	c1 e8 0c             	shr    $0xc,%eax
+  804458:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80445f:	a8 01                	test   $0x1,%al
+  804461:	74 0e                	je     804471 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804463:	c1 e8 0c             	shr    $0xc,%eax
+  804466:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80446d:	ef 
+  80446e:	0f b7 d2             	movzwl %dx,%edx
+}
+  804471:	89 d0                	mov    %edx,%eax
+  804473:	5d                   	pop    %ebp
+  804474:	c3                   	ret
+
+00804475 <udm>:
+  804475:	57                   	push   %edi
+  804476:	56                   	push   %esi
+  804477:	53                   	push   %ebx
+  804478:	83 ec 20             	sub    $0x20,%esp
+  80447b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80447f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804483:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804487:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80448b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80448f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804493:	89 d1                	mov    %edx,%ecx
+  804495:	09 c1                	or     %eax,%ecx
+  804497:	0f 84 91 00 00 00    	je     80452e <udm+0xb9>
+  80449d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044ac:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044b3:	00 
+  8044b4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044bb:	00 
+  8044bc:	eb 08                	jmp    8044c6 <udm+0x51>
+  8044be:	83 e9 01             	sub    $0x1,%ecx
+  8044c1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044c4:	74 7c                	je     804542 <udm+0xcd>
+  8044c6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044ca:	01 c0                	add    %eax,%eax
+  8044cc:	89 c6                	mov    %eax,%esi
+  8044ce:	89 d7                	mov    %edx,%edi
+  8044d0:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044d4:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044d8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044db:	d3 ea                	shr    %cl,%edx
+  8044dd:	f6 c1 20             	test   $0x20,%cl
+  8044e0:	74 04                	je     8044e6 <udm+0x71>
+  8044e2:	89 d0                	mov    %edx,%eax
+  8044e4:	31 d2                	xor    %edx,%edx
+  8044e6:	83 e0 01             	and    $0x1,%eax
+  8044e9:	89 04 24             	mov    %eax,(%esp)
+  8044ec:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044f3:	00 
+  8044f4:	8b 04 24             	mov    (%esp),%eax
+  8044f7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044fb:	09 f0                	or     %esi,%eax
+  8044fd:	09 fa                	or     %edi,%edx
+  8044ff:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804503:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804507:	39 f0                	cmp    %esi,%eax
+  804509:	89 d3                	mov    %edx,%ebx
+  80450b:	19 fb                	sbb    %edi,%ebx
+  80450d:	72 af                	jb     8044be <udm+0x49>
+  80450f:	29 f0                	sub    %esi,%eax
+  804511:	19 fa                	sbb    %edi,%edx
+  804513:	89 cf                	mov    %ecx,%edi
+  804515:	c1 ef 05             	shr    $0x5,%edi
+  804518:	83 e7 01             	and    $0x1,%edi
+  80451b:	89 fe                	mov    %edi,%esi
+  80451d:	83 f6 01             	xor    $0x1,%esi
+  804520:	d3 e6                	shl    %cl,%esi
+  804522:	d3 e7                	shl    %cl,%edi
+  804524:	09 74 24 18          	or     %esi,0x18(%esp)
+  804528:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80452c:	eb 90                	jmp    8044be <udm+0x49>
+  80452e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804532:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804536:	89 f0                	mov    %esi,%eax
+  804538:	89 fa                	mov    %edi,%edx
+  80453a:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80453e:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804542:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804546:	89 01                	mov    %eax,(%ecx)
+  804548:	89 51 04             	mov    %edx,0x4(%ecx)
+  80454b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80454f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804553:	83 c4 20             	add    $0x20,%esp
+  804556:	5b                   	pop    %ebx
+  804557:	5e                   	pop    %esi
+  804558:	5f                   	pop    %edi
+  804559:	c3                   	ret
+
+0080455a <__udivdi3>:
+  80455a:	83 ec 18             	sub    $0x18,%esp
+  80455d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804561:	50                   	push   %eax
+  804562:	ff 74 24 2c          	push   0x2c(%esp)
+  804566:	ff 74 24 2c          	push   0x2c(%esp)
+  80456a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80456e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804572:	e8 fe fe ff ff       	call   804475 <udm>
+  804577:	83 c4 24             	add    $0x24,%esp
+  80457a:	c3                   	ret
+
+0080457b <__umoddi3>:
+  80457b:	83 ec 18             	sub    $0x18,%esp
+  80457e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804582:	50                   	push   %eax
+  804583:	ff 74 24 2c          	push   0x2c(%esp)
+  804587:	ff 74 24 2c          	push   0x2c(%esp)
+  80458b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80458f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804593:	e8 dd fe ff ff       	call   804475 <udm>
+  804598:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80459c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045a0:	83 c4 24             	add    $0x24,%esp
+  8045a3:	c3                   	ret
+
+008045a4 <__divdi3>:
+  8045a4:	56                   	push   %esi
+  8045a5:	53                   	push   %ebx
+  8045a6:	83 ec 14             	sub    $0x14,%esp
+  8045a9:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045ad:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045b1:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045b5:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045b9:	85 d2                	test   %edx,%edx
+  8045bb:	78 18                	js     8045d5 <__divdi3+0x31>
+  8045bd:	85 db                	test   %ebx,%ebx
+  8045bf:	78 3e                	js     8045ff <__divdi3+0x5b>
+  8045c1:	83 ec 04             	sub    $0x4,%esp
+  8045c4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c8:	56                   	push   %esi
+  8045c9:	53                   	push   %ebx
+  8045ca:	51                   	push   %ecx
+  8045cb:	e8 a5 fe ff ff       	call   804475 <udm>
+  8045d0:	83 c4 10             	add    $0x10,%esp
+  8045d3:	eb 24                	jmp    8045f9 <__divdi3+0x55>
+  8045d5:	f7 d8                	neg    %eax
+  8045d7:	83 d2 00             	adc    $0x0,%edx
+  8045da:	f7 da                	neg    %edx
+  8045dc:	85 db                	test   %ebx,%ebx
+  8045de:	78 3a                	js     80461a <__divdi3+0x76>
+  8045e0:	83 ec 04             	sub    $0x4,%esp
+  8045e3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e7:	56                   	push   %esi
+  8045e8:	53                   	push   %ebx
+  8045e9:	51                   	push   %ecx
+  8045ea:	e8 86 fe ff ff       	call   804475 <udm>
+  8045ef:	83 c4 10             	add    $0x10,%esp
+  8045f2:	f7 d8                	neg    %eax
+  8045f4:	83 d2 00             	adc    $0x0,%edx
+  8045f7:	f7 da                	neg    %edx
+  8045f9:	83 c4 14             	add    $0x14,%esp
+  8045fc:	5b                   	pop    %ebx
+  8045fd:	5e                   	pop    %esi
+  8045fe:	c3                   	ret
+  8045ff:	83 ec 04             	sub    $0x4,%esp
+  804602:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804606:	56                   	push   %esi
+  804607:	f7 d9                	neg    %ecx
+  804609:	83 d3 00             	adc    $0x0,%ebx
+  80460c:	f7 db                	neg    %ebx
+  80460e:	53                   	push   %ebx
+  80460f:	51                   	push   %ecx
+  804610:	e8 60 fe ff ff       	call   804475 <udm>
+  804615:	83 c4 10             	add    $0x10,%esp
+  804618:	eb d8                	jmp    8045f2 <__divdi3+0x4e>
+  80461a:	83 ec 04             	sub    $0x4,%esp
+  80461d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804621:	56                   	push   %esi
+  804622:	f7 d9                	neg    %ecx
+  804624:	83 d3 00             	adc    $0x0,%ebx
+  804627:	f7 db                	neg    %ebx
+  804629:	53                   	push   %ebx
+  80462a:	51                   	push   %ecx
+  80462b:	e8 45 fe ff ff       	call   804475 <udm>
+  804630:	83 c4 10             	add    $0x10,%esp
+  804633:	eb c4                	jmp    8045f9 <__divdi3+0x55>
+
+00804635 <__moddi3>:
+  804635:	55                   	push   %ebp
+  804636:	57                   	push   %edi
+  804637:	56                   	push   %esi
+  804638:	53                   	push   %ebx
+  804639:	83 ec 24             	sub    $0x24,%esp
+  80463c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804640:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804644:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804648:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80464c:	85 d2                	test   %edx,%edx
+  80464e:	78 3b                	js     80468b <__moddi3+0x56>
+  804650:	83 ec 04             	sub    $0x4,%esp
+  804653:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804657:	56                   	push   %esi
+  804658:	89 ce                	mov    %ecx,%esi
+  80465a:	f7 de                	neg    %esi
+  80465c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804660:	89 de                	mov    %ebx,%esi
+  804662:	83 d6 00             	adc    $0x0,%esi
+  804665:	f7 de                	neg    %esi
+  804667:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80466b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80466f:	0f 48 f1             	cmovs  %ecx,%esi
+  804672:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804677:	53                   	push   %ebx
+  804678:	56                   	push   %esi
+  804679:	e8 f7 fd ff ff       	call   804475 <udm>
+  80467e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804682:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804686:	83 c4 10             	add    $0x10,%esp
+  804689:	eb 47                	jmp    8046d2 <__moddi3+0x9d>
+  80468b:	f7 d8                	neg    %eax
+  80468d:	83 d2 00             	adc    $0x0,%edx
+  804690:	f7 da                	neg    %edx
+  804692:	83 ec 04             	sub    $0x4,%esp
+  804695:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804699:	56                   	push   %esi
+  80469a:	89 cf                	mov    %ecx,%edi
+  80469c:	f7 df                	neg    %edi
+  80469e:	89 de                	mov    %ebx,%esi
+  8046a0:	83 d6 00             	adc    $0x0,%esi
+  8046a3:	f7 de                	neg    %esi
+  8046a5:	0f 49 cf             	cmovns %edi,%ecx
+  8046a8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046ac:	0f 49 de             	cmovns %esi,%ebx
+  8046af:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046b3:	ff 74 24 0c          	push   0xc(%esp)
+  8046b7:	ff 74 24 0c          	push   0xc(%esp)
+  8046bb:	e8 b5 fd ff ff       	call   804475 <udm>
+  8046c0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046c4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046c8:	f7 d8                	neg    %eax
+  8046ca:	83 d2 00             	adc    $0x0,%edx
+  8046cd:	f7 da                	neg    %edx
+  8046cf:	83 c4 10             	add    $0x10,%esp
+  8046d2:	83 c4 24             	add    $0x24,%esp
+  8046d5:	5b                   	pop    %ebx
+  8046d6:	5e                   	pop    %esi
+  8046d7:	5f                   	pop    %edi
+  8046d8:	5d                   	pop    %ebp
+  8046d9:	c3                   	ret
@@ -0,0 +1,9687 @@
+
+obj/user/faultreadkernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0xf0100000!\n", *(unsigned*)0xf0100000);
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 e0 46 80 00       	push   $0x8046e0
+  800044:	e8 3d 01 00 00       	call   800186 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 1c             	sub    $0x1c,%esp
+  800057:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80005d:	e8 ee 0a 00 00       	call   800b50 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800062:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800065:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  80006b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800070:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800072:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800074:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80007a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80007f:	77 16                	ja     800097 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800081:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800086:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800088:	c1 e8 10             	shr    $0x10,%eax
+  80008b:	74 0a                	je     800097 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80008d:	c1 e0 10             	shl    $0x10,%eax
+  800090:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800095:	29 c2                	sub    %eax,%edx
+  800097:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80009a:	c1 e0 04             	shl    $0x4,%eax
+  80009d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a2:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a4:	85 db                	test   %ebx,%ebx
+  8000a6:	7e 07                	jle    8000af <libmain+0x61>
+		binaryname = argv[0];
+  8000a8:	8b 06                	mov    (%esi),%eax
+  8000aa:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000af:	83 ec 08             	sub    $0x8,%esp
+  8000b2:	56                   	push   %esi
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 7a ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b9:	e8 0b 00 00 00       	call   8000c9 <exit>
+}
+  8000be:	83 c4 10             	add    $0x10,%esp
+  8000c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c4:	5b                   	pop    %ebx
+  8000c5:	5e                   	pop    %esi
+  8000c6:	5f                   	pop    %edi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	e8 cf 20 00 00       	call   8021a5 <fflush>
+	pthread_kill_others();
+  8000d6:	e8 3a 37 00 00       	call   803815 <pthread_kill_others>
+	close_all();
+  8000db:	e8 68 11 00 00       	call   801248 <close_all>
+	sys_env_destroy(0);
+  8000e0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000e7:	e8 19 0a 00 00       	call   800b05 <sys_env_destroy>
+}
+  8000ec:	83 c4 10             	add    $0x10,%esp
+  8000ef:	c9                   	leave
+  8000f0:	c3                   	ret
+
+008000f1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	53                   	push   %ebx
+  8000f5:	83 ec 04             	sub    $0x4,%esp
+  8000f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000fb:	8b 13                	mov    (%ebx),%edx
+  8000fd:	8d 42 01             	lea    0x1(%edx),%eax
+  800100:	89 03                	mov    %eax,(%ebx)
+  800102:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800105:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800109:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80010e:	74 09                	je     800119 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800110:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800114:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800117:	c9                   	leave
+  800118:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800119:	83 ec 08             	sub    $0x8,%esp
+  80011c:	68 ff 00 00 00       	push   $0xff
+  800121:	8d 43 08             	lea    0x8(%ebx),%eax
+  800124:	50                   	push   %eax
+  800125:	e8 84 09 00 00       	call   800aae <sys_cputs>
+		b->idx = 0;
+  80012a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	eb db                	jmp    800110 <putch+0x1f>
+
+00800135 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80013e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800145:	00 00 00 
+	b.cnt = 0;
+  800148:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80014f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800152:	ff 75 0c             	push   0xc(%ebp)
+  800155:	ff 75 08             	push   0x8(%ebp)
+  800158:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80015e:	50                   	push   %eax
+  80015f:	68 f1 00 80 00       	push   $0x8000f1
+  800164:	e8 14 01 00 00       	call   80027d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800169:	83 c4 08             	add    $0x8,%esp
+  80016c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800172:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800178:	50                   	push   %eax
+  800179:	e8 30 09 00 00       	call   800aae <sys_cputs>
+
+	return b.cnt;
+}
+  80017e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+00800186 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80018c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80018f:	50                   	push   %eax
+  800190:	ff 75 08             	push   0x8(%ebp)
+  800193:	e8 9d ff ff ff       	call   800135 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800198:	c9                   	leave
+  800199:	c3                   	ret
+
+0080019a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	57                   	push   %edi
+  80019e:	56                   	push   %esi
+  80019f:	53                   	push   %ebx
+  8001a0:	83 ec 1c             	sub    $0x1c,%esp
+  8001a3:	89 c7                	mov    %eax,%edi
+  8001a5:	89 d6                	mov    %edx,%esi
+  8001a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ad:	89 d1                	mov    %edx,%ecx
+  8001af:	89 c2                	mov    %eax,%edx
+  8001b1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001b4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001b7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ba:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001c7:	39 c2                	cmp    %eax,%edx
+  8001c9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001cc:	72 3e                	jb     80020c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	ff 75 18             	push   0x18(%ebp)
+  8001d4:	83 eb 01             	sub    $0x1,%ebx
+  8001d7:	53                   	push   %ebx
+  8001d8:	50                   	push   %eax
+  8001d9:	83 ec 08             	sub    $0x8,%esp
+  8001dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8001df:	ff 75 e0             	push   -0x20(%ebp)
+  8001e2:	ff 75 dc             	push   -0x24(%ebp)
+  8001e5:	ff 75 d8             	push   -0x28(%ebp)
+  8001e8:	e8 67 43 00 00       	call   804554 <__udivdi3>
+  8001ed:	83 c4 18             	add    $0x18,%esp
+  8001f0:	52                   	push   %edx
+  8001f1:	50                   	push   %eax
+  8001f2:	89 f2                	mov    %esi,%edx
+  8001f4:	89 f8                	mov    %edi,%eax
+  8001f6:	e8 9f ff ff ff       	call   80019a <printnum>
+  8001fb:	83 c4 20             	add    $0x20,%esp
+  8001fe:	eb 13                	jmp    800213 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	56                   	push   %esi
+  800204:	ff 75 18             	push   0x18(%ebp)
+  800207:	ff d7                	call   *%edi
+  800209:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80020c:	83 eb 01             	sub    $0x1,%ebx
+  80020f:	85 db                	test   %ebx,%ebx
+  800211:	7f ed                	jg     800200 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	83 ec 04             	sub    $0x4,%esp
+  80021a:	ff 75 e4             	push   -0x1c(%ebp)
+  80021d:	ff 75 e0             	push   -0x20(%ebp)
+  800220:	ff 75 dc             	push   -0x24(%ebp)
+  800223:	ff 75 d8             	push   -0x28(%ebp)
+  800226:	e8 4a 43 00 00       	call   804575 <__umoddi3>
+  80022b:	83 c4 14             	add    $0x14,%esp
+  80022e:	0f be 80 11 47 80 00 	movsbl 0x804711(%eax),%eax
+  800235:	50                   	push   %eax
+  800236:	ff d7                	call   *%edi
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023e:	5b                   	pop    %ebx
+  80023f:	5e                   	pop    %esi
+  800240:	5f                   	pop    %edi
+  800241:	5d                   	pop    %ebp
+  800242:	c3                   	ret
+
+00800243 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800249:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80024d:	8b 10                	mov    (%eax),%edx
+  80024f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800252:	73 0a                	jae    80025e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800254:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800257:	89 08                	mov    %ecx,(%eax)
+  800259:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025c:	88 02                	mov    %al,(%edx)
+}
+  80025e:	5d                   	pop    %ebp
+  80025f:	c3                   	ret
+
+00800260 <printfmt>:
+{
+  800260:	55                   	push   %ebp
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800266:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800269:	50                   	push   %eax
+  80026a:	ff 75 10             	push   0x10(%ebp)
+  80026d:	ff 75 0c             	push   0xc(%ebp)
+  800270:	ff 75 08             	push   0x8(%ebp)
+  800273:	e8 05 00 00 00       	call   80027d <vprintfmt>
+}
+  800278:	83 c4 10             	add    $0x10,%esp
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+0080027d <vprintfmt>:
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	57                   	push   %edi
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	83 ec 2c             	sub    $0x2c,%esp
+  800286:	8b 75 08             	mov    0x8(%ebp),%esi
+  800289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80028c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80028f:	eb 0a                	jmp    80029b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800291:	83 ec 08             	sub    $0x8,%esp
+  800294:	53                   	push   %ebx
+  800295:	50                   	push   %eax
+  800296:	ff d6                	call   *%esi
+  800298:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80029b:	83 c7 01             	add    $0x1,%edi
+  80029e:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8002a2:	83 f8 25             	cmp    $0x25,%eax
+  8002a5:	74 0c                	je     8002b3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	75 e6                	jne    800291 <vprintfmt+0x14>
+}
+  8002ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ae:	5b                   	pop    %ebx
+  8002af:	5e                   	pop    %esi
+  8002b0:	5f                   	pop    %edi
+  8002b1:	5d                   	pop    %ebp
+  8002b2:	c3                   	ret
+		padc = ' ';
+  8002b3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002b7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002be:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002c5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8002d1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002d7:	0f b6 17             	movzbl (%edi),%edx
+  8002da:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002dd:	3c 55                	cmp    $0x55,%al
+  8002df:	0f 87 c5 03 00 00    	ja     8006aa <vprintfmt+0x42d>
+  8002e5:	0f b6 c0             	movzbl %al,%eax
+  8002e8:	ff 24 85 a0 48 80 00 	jmp    *0x8048a0(,%eax,4)
+  8002ef:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8002f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002f5:	eb da                	jmp    8002d1 <vprintfmt+0x54>
+  8002f7:	0f be d2             	movsbl %dl,%edx
+  8002fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800302:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800305:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800308:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80030c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80030f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800312:	83 f9 09             	cmp    $0x9,%ecx
+  800315:	77 55                	ja     80036c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800317:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80031a:	eb e9                	jmp    800305 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80031c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031f:	8b 00                	mov    (%eax),%eax
+  800321:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800324:	8b 45 14             	mov    0x14(%ebp),%eax
+  800327:	8d 40 04             	lea    0x4(%eax),%eax
+  80032a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800330:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800334:	79 9b                	jns    8002d1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800336:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800339:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800343:	eb 8c                	jmp    8002d1 <vprintfmt+0x54>
+			if (width < 0)
+  800345:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800348:	85 d2                	test   %edx,%edx
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034f:	0f 49 c2             	cmovns %edx,%eax
+  800352:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800355:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800358:	e9 74 ff ff ff       	jmp    8002d1 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80035d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800360:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800367:	e9 65 ff ff ff       	jmp    8002d1 <vprintfmt+0x54>
+  80036c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	eb bc                	jmp    800330 <vprintfmt+0xb3>
+			lflag++;
+  800374:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800377:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80037a:	e9 52 ff ff ff       	jmp    8002d1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80037f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800382:	8d 78 04             	lea    0x4(%eax),%edi
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	53                   	push   %ebx
+  800389:	ff 30                	push   (%eax)
+  80038b:	ff d6                	call   *%esi
+			break;
+  80038d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800390:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800393:	e9 b1 02 00 00       	jmp    800649 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800398:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80039e:	8b 10                	mov    (%eax),%edx
+  8003a0:	89 d0                	mov    %edx,%eax
+  8003a2:	f7 d8                	neg    %eax
+  8003a4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003a7:	83 f8 14             	cmp    $0x14,%eax
+  8003aa:	7f 23                	jg     8003cf <vprintfmt+0x152>
+  8003ac:	8b 14 85 00 4a 80 00 	mov    0x804a00(,%eax,4),%edx
+  8003b3:	85 d2                	test   %edx,%edx
+  8003b5:	74 18                	je     8003cf <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8003b7:	52                   	push   %edx
+  8003b8:	68 6f 4b 80 00       	push   $0x804b6f
+  8003bd:	53                   	push   %ebx
+  8003be:	56                   	push   %esi
+  8003bf:	e8 9c fe ff ff       	call   800260 <printfmt>
+  8003c4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003ca:	e9 7a 02 00 00       	jmp    800649 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8003cf:	50                   	push   %eax
+  8003d0:	68 29 47 80 00       	push   $0x804729
+  8003d5:	53                   	push   %ebx
+  8003d6:	56                   	push   %esi
+  8003d7:	e8 84 fe ff ff       	call   800260 <printfmt>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003df:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003e2:	e9 62 02 00 00       	jmp    800649 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ea:	83 c0 04             	add    $0x4,%eax
+  8003ed:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003f5:	85 c9                	test   %ecx,%ecx
+  8003f7:	b8 22 47 80 00       	mov    $0x804722,%eax
+  8003fc:	0f 45 c1             	cmovne %ecx,%eax
+  8003ff:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800402:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800406:	7e 06                	jle    80040e <vprintfmt+0x191>
+  800408:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80040c:	75 0b                	jne    800419 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800411:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800414:	89 75 08             	mov    %esi,0x8(%ebp)
+  800417:	eb 5c                	jmp    800475 <vprintfmt+0x1f8>
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	ff 75 d0             	push   -0x30(%ebp)
+  80041f:	ff 75 cc             	push   -0x34(%ebp)
+  800422:	e8 20 03 00 00       	call   800747 <strnlen>
+  800427:	89 c2                	mov    %eax,%edx
+  800429:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042c:	29 d0                	sub    %edx,%eax
+  80042e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800431:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800435:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800438:	89 75 08             	mov    %esi,0x8(%ebp)
+  80043b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043d:	eb 0e                	jmp    80044d <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80043f:	83 ec 08             	sub    $0x8,%esp
+  800442:	53                   	push   %ebx
+  800443:	57                   	push   %edi
+  800444:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800447:	83 ee 01             	sub    $0x1,%esi
+  80044a:	83 c4 10             	add    $0x10,%esp
+  80044d:	85 f6                	test   %esi,%esi
+  80044f:	7f ee                	jg     80043f <vprintfmt+0x1c2>
+  800451:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800454:	8b 75 08             	mov    0x8(%ebp),%esi
+  800457:	85 c0                	test   %eax,%eax
+  800459:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045e:	0f 49 d0             	cmovns %eax,%edx
+  800461:	29 d0                	sub    %edx,%eax
+  800463:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800466:	eb a6                	jmp    80040e <vprintfmt+0x191>
+					putch(ch, putdat);
+  800468:	83 ec 08             	sub    $0x8,%esp
+  80046b:	53                   	push   %ebx
+  80046c:	52                   	push   %edx
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+  800470:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800473:	89 f1                	mov    %esi,%ecx
+  800475:	8d 71 01             	lea    0x1(%ecx),%esi
+  800478:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80047c:	0f be d0             	movsbl %al,%edx
+  80047f:	85 d2                	test   %edx,%edx
+  800481:	74 28                	je     8004ab <vprintfmt+0x22e>
+  800483:	85 ff                	test   %edi,%edi
+  800485:	78 05                	js     80048c <vprintfmt+0x20f>
+  800487:	83 ef 01             	sub    $0x1,%edi
+  80048a:	78 30                	js     8004bc <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80048c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800490:	74 d6                	je     800468 <vprintfmt+0x1eb>
+  800492:	0f be c0             	movsbl %al,%eax
+  800495:	83 e8 20             	sub    $0x20,%eax
+  800498:	83 f8 5e             	cmp    $0x5e,%eax
+  80049b:	76 cb                	jbe    800468 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	53                   	push   %ebx
+  8004a1:	6a 3f                	push   $0x3f
+  8004a3:	ff 55 08             	call   *0x8(%ebp)
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	eb c8                	jmp    800473 <vprintfmt+0x1f6>
+  8004ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b4:	01 d0                	add    %edx,%eax
+  8004b6:	29 c8                	sub    %ecx,%eax
+  8004b8:	89 c7                	mov    %eax,%edi
+  8004ba:	eb 13                	jmp    8004cf <vprintfmt+0x252>
+  8004bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bf:	eb ed                	jmp    8004ae <vprintfmt+0x231>
+				putch(' ', putdat);
+  8004c1:	83 ec 08             	sub    $0x8,%esp
+  8004c4:	53                   	push   %ebx
+  8004c5:	6a 20                	push   $0x20
+  8004c7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004c9:	83 ef 01             	sub    $0x1,%edi
+  8004cc:	83 c4 10             	add    $0x10,%esp
+  8004cf:	85 ff                	test   %edi,%edi
+  8004d1:	7f ee                	jg     8004c1 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d9:	e9 6b 01 00 00       	jmp    800649 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8004de:	83 f9 01             	cmp    $0x1,%ecx
+  8004e1:	7f 1f                	jg     800502 <vprintfmt+0x285>
+	else if (lflag)
+  8004e3:	85 c9                	test   %ecx,%ecx
+  8004e5:	74 67                	je     80054e <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8004e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ea:	8b 00                	mov    (%eax),%eax
+  8004ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004ef:	89 c1                	mov    %eax,%ecx
+  8004f1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004f4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8004fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800500:	eb 17                	jmp    800519 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800502:	8b 45 14             	mov    0x14(%ebp),%eax
+  800505:	8b 50 04             	mov    0x4(%eax),%edx
+  800508:	8b 00                	mov    (%eax),%eax
+  80050a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8d 40 08             	lea    0x8(%eax),%eax
+  800516:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800519:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80051c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80051f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800524:	85 c9                	test   %ecx,%ecx
+  800526:	0f 89 03 01 00 00    	jns    80062f <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80052c:	83 ec 08             	sub    $0x8,%esp
+  80052f:	53                   	push   %ebx
+  800530:	6a 2d                	push   $0x2d
+  800532:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800534:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800537:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80053a:	f7 da                	neg    %edx
+  80053c:	83 d1 00             	adc    $0x0,%ecx
+  80053f:	f7 d9                	neg    %ecx
+  800541:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800544:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800549:	e9 e1 00 00 00       	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80054e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800551:	8b 00                	mov    (%eax),%eax
+  800553:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800556:	89 c1                	mov    %eax,%ecx
+  800558:	c1 f9 1f             	sar    $0x1f,%ecx
+  80055b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8d 40 04             	lea    0x4(%eax),%eax
+  800564:	89 45 14             	mov    %eax,0x14(%ebp)
+  800567:	eb b0                	jmp    800519 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800569:	83 f9 01             	cmp    $0x1,%ecx
+  80056c:	7f 1e                	jg     80058c <vprintfmt+0x30f>
+	else if (lflag)
+  80056e:	85 c9                	test   %ecx,%ecx
+  800570:	74 32                	je     8005a4 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800572:	8b 45 14             	mov    0x14(%ebp),%eax
+  800575:	8b 10                	mov    (%eax),%edx
+  800577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057c:	8d 40 04             	lea    0x4(%eax),%eax
+  80057f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800582:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800587:	e9 a3 00 00 00       	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8b 10                	mov    (%eax),%edx
+  800591:	8b 48 04             	mov    0x4(%eax),%ecx
+  800594:	8d 40 08             	lea    0x8(%eax),%eax
+  800597:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80059a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80059f:	e9 8b 00 00 00       	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8b 10                	mov    (%eax),%edx
+  8005a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005b9:	eb 74                	jmp    80062f <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8005bb:	83 f9 01             	cmp    $0x1,%ecx
+  8005be:	7f 1b                	jg     8005db <vprintfmt+0x35e>
+	else if (lflag)
+  8005c0:	85 c9                	test   %ecx,%ecx
+  8005c2:	74 2c                	je     8005f0 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 10                	mov    (%eax),%edx
+  8005c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005d9:	eb 54                	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 10                	mov    (%eax),%edx
+  8005e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005ee:	eb 3f                	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8b 10                	mov    (%eax),%edx
+  8005f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800600:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800605:	eb 28                	jmp    80062f <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800607:	83 ec 08             	sub    $0x8,%esp
+  80060a:	53                   	push   %ebx
+  80060b:	6a 30                	push   $0x30
+  80060d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80060f:	83 c4 08             	add    $0x8,%esp
+  800612:	53                   	push   %ebx
+  800613:	6a 78                	push   $0x78
+  800615:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800621:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800624:	8d 40 04             	lea    0x4(%eax),%eax
+  800627:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80062a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80062f:	83 ec 0c             	sub    $0xc,%esp
+  800632:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800636:	50                   	push   %eax
+  800637:	ff 75 e0             	push   -0x20(%ebp)
+  80063a:	57                   	push   %edi
+  80063b:	51                   	push   %ecx
+  80063c:	52                   	push   %edx
+  80063d:	89 da                	mov    %ebx,%edx
+  80063f:	89 f0                	mov    %esi,%eax
+  800641:	e8 54 fb ff ff       	call   80019a <printnum>
+			break;
+  800646:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800649:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80064c:	e9 4a fc ff ff       	jmp    80029b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800651:	83 f9 01             	cmp    $0x1,%ecx
+  800654:	7f 1b                	jg     800671 <vprintfmt+0x3f4>
+	else if (lflag)
+  800656:	85 c9                	test   %ecx,%ecx
+  800658:	74 2c                	je     800686 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80066f:	eb be                	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	8b 48 04             	mov    0x4(%eax),%ecx
+  800679:	8d 40 08             	lea    0x8(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800684:	eb a9                	jmp    80062f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800696:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80069b:	eb 92                	jmp    80062f <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80069d:	83 ec 08             	sub    $0x8,%esp
+  8006a0:	53                   	push   %ebx
+  8006a1:	6a 25                	push   $0x25
+  8006a3:	ff d6                	call   *%esi
+			break;
+  8006a5:	83 c4 10             	add    $0x10,%esp
+  8006a8:	eb 9f                	jmp    800649 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  8006ad:	53                   	push   %ebx
+  8006ae:	6a 25                	push   $0x25
+  8006b0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006b2:	83 c4 10             	add    $0x10,%esp
+  8006b5:	89 f8                	mov    %edi,%eax
+  8006b7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006bb:	74 05                	je     8006c2 <vprintfmt+0x445>
+  8006bd:	83 e8 01             	sub    $0x1,%eax
+  8006c0:	eb f5                	jmp    8006b7 <vprintfmt+0x43a>
+  8006c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c5:	eb 82                	jmp    800649 <vprintfmt+0x3cc>
+
+008006c7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006c7:	55                   	push   %ebp
+  8006c8:	89 e5                	mov    %esp,%ebp
+  8006ca:	83 ec 18             	sub    $0x18,%esp
+  8006cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006d3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006d6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006da:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006e4:	85 c0                	test   %eax,%eax
+  8006e6:	74 26                	je     80070e <vsnprintf+0x47>
+  8006e8:	85 d2                	test   %edx,%edx
+  8006ea:	7e 22                	jle    80070e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006ec:	ff 75 14             	push   0x14(%ebp)
+  8006ef:	ff 75 10             	push   0x10(%ebp)
+  8006f2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006f5:	50                   	push   %eax
+  8006f6:	68 43 02 80 00       	push   $0x800243
+  8006fb:	e8 7d fb ff ff       	call   80027d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800700:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800703:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800709:	83 c4 10             	add    $0x10,%esp
+}
+  80070c:	c9                   	leave
+  80070d:	c3                   	ret
+		return -E_INVAL;
+  80070e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800713:	eb f7                	jmp    80070c <vsnprintf+0x45>
+
+00800715 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800715:	55                   	push   %ebp
+  800716:	89 e5                	mov    %esp,%ebp
+  800718:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80071b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80071e:	50                   	push   %eax
+  80071f:	ff 75 10             	push   0x10(%ebp)
+  800722:	ff 75 0c             	push   0xc(%ebp)
+  800725:	ff 75 08             	push   0x8(%ebp)
+  800728:	e8 9a ff ff ff       	call   8006c7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80072d:	c9                   	leave
+  80072e:	c3                   	ret
+
+0080072f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+  800732:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073a:	eb 03                	jmp    80073f <strlen+0x10>
+		n++;
+  80073c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80073f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800743:	75 f7                	jne    80073c <strlen+0xd>
+	return n;
+}
+  800745:	5d                   	pop    %ebp
+  800746:	c3                   	ret
+
+00800747 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800747:	55                   	push   %ebp
+  800748:	89 e5                	mov    %esp,%ebp
+  80074a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80074d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	eb 03                	jmp    80075a <strnlen+0x13>
+		n++;
+  800757:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80075a:	39 d0                	cmp    %edx,%eax
+  80075c:	74 08                	je     800766 <strnlen+0x1f>
+  80075e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800762:	75 f3                	jne    800757 <strnlen+0x10>
+  800764:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800766:	89 d0                	mov    %edx,%eax
+  800768:	5d                   	pop    %ebp
+  800769:	c3                   	ret
+
+0080076a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80076a:	55                   	push   %ebp
+  80076b:	89 e5                	mov    %esp,%ebp
+  80076d:	53                   	push   %ebx
+  80076e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800771:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800774:	b8 00 00 00 00       	mov    $0x0,%eax
+  800779:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80077d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800780:	83 c0 01             	add    $0x1,%eax
+  800783:	84 d2                	test   %dl,%dl
+  800785:	75 f2                	jne    800779 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800787:	89 c8                	mov    %ecx,%eax
+  800789:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+0080078e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	53                   	push   %ebx
+  800792:	83 ec 10             	sub    $0x10,%esp
+  800795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800798:	53                   	push   %ebx
+  800799:	e8 91 ff ff ff       	call   80072f <strlen>
+  80079e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007a1:	ff 75 0c             	push   0xc(%ebp)
+  8007a4:	01 d8                	add    %ebx,%eax
+  8007a6:	50                   	push   %eax
+  8007a7:	e8 be ff ff ff       	call   80076a <strcpy>
+	return dst;
+}
+  8007ac:	89 d8                	mov    %ebx,%eax
+  8007ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b1:	c9                   	leave
+  8007b2:	c3                   	ret
+
+008007b3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	56                   	push   %esi
+  8007b7:	53                   	push   %ebx
+  8007b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007be:	89 f3                	mov    %esi,%ebx
+  8007c0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007c3:	89 f0                	mov    %esi,%eax
+  8007c5:	eb 0f                	jmp    8007d6 <strncpy+0x23>
+		*dst++ = *src;
+  8007c7:	83 c0 01             	add    $0x1,%eax
+  8007ca:	0f b6 0a             	movzbl (%edx),%ecx
+  8007cd:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007d0:	80 f9 01             	cmp    $0x1,%cl
+  8007d3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007d6:	39 d8                	cmp    %ebx,%eax
+  8007d8:	75 ed                	jne    8007c7 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007da:	89 f0                	mov    %esi,%eax
+  8007dc:	5b                   	pop    %ebx
+  8007dd:	5e                   	pop    %esi
+  8007de:	5d                   	pop    %ebp
+  8007df:	c3                   	ret
+
+008007e0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	56                   	push   %esi
+  8007e4:	53                   	push   %ebx
+  8007e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007eb:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007ee:	89 f0                	mov    %esi,%eax
+  8007f0:	85 d2                	test   %edx,%edx
+  8007f2:	74 21                	je     800815 <strlcpy+0x35>
+  8007f4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007f8:	89 f2                	mov    %esi,%edx
+  8007fa:	eb 09                	jmp    800805 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007fc:	83 c1 01             	add    $0x1,%ecx
+  8007ff:	83 c2 01             	add    $0x1,%edx
+  800802:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800805:	39 c2                	cmp    %eax,%edx
+  800807:	74 09                	je     800812 <strlcpy+0x32>
+  800809:	0f b6 19             	movzbl (%ecx),%ebx
+  80080c:	84 db                	test   %bl,%bl
+  80080e:	75 ec                	jne    8007fc <strlcpy+0x1c>
+  800810:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800812:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800815:	29 f0                	sub    %esi,%eax
+}
+  800817:	5b                   	pop    %ebx
+  800818:	5e                   	pop    %esi
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800821:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800824:	eb 06                	jmp    80082c <strcmp+0x11>
+		p++, q++;
+  800826:	83 c1 01             	add    $0x1,%ecx
+  800829:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80082c:	0f b6 01             	movzbl (%ecx),%eax
+  80082f:	84 c0                	test   %al,%al
+  800831:	74 04                	je     800837 <strcmp+0x1c>
+  800833:	3a 02                	cmp    (%edx),%al
+  800835:	74 ef                	je     800826 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800837:	0f b6 c0             	movzbl %al,%eax
+  80083a:	0f b6 12             	movzbl (%edx),%edx
+  80083d:	29 d0                	sub    %edx,%eax
+}
+  80083f:	5d                   	pop    %ebp
+  800840:	c3                   	ret
+
+00800841 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	53                   	push   %ebx
+  800845:	8b 45 08             	mov    0x8(%ebp),%eax
+  800848:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80084b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80084e:	eb 09                	jmp    800859 <strncmp+0x18>
+		n--, p++, q++;
+  800850:	83 ea 01             	sub    $0x1,%edx
+  800853:	83 c0 01             	add    $0x1,%eax
+  800856:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800859:	85 d2                	test   %edx,%edx
+  80085b:	74 18                	je     800875 <strncmp+0x34>
+  80085d:	0f b6 18             	movzbl (%eax),%ebx
+  800860:	84 db                	test   %bl,%bl
+  800862:	74 04                	je     800868 <strncmp+0x27>
+  800864:	3a 19                	cmp    (%ecx),%bl
+  800866:	74 e8                	je     800850 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800868:	0f b6 00             	movzbl (%eax),%eax
+  80086b:	0f b6 11             	movzbl (%ecx),%edx
+  80086e:	29 d0                	sub    %edx,%eax
+}
+  800870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800873:	c9                   	leave
+  800874:	c3                   	ret
+		return 0;
+  800875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087a:	eb f4                	jmp    800870 <strncmp+0x2f>
+
+0080087c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800882:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800886:	eb 03                	jmp    80088b <strchr+0xf>
+  800888:	83 c0 01             	add    $0x1,%eax
+  80088b:	0f b6 10             	movzbl (%eax),%edx
+  80088e:	84 d2                	test   %dl,%dl
+  800890:	74 06                	je     800898 <strchr+0x1c>
+		if (*s == c)
+  800892:	38 ca                	cmp    %cl,%dl
+  800894:	75 f2                	jne    800888 <strchr+0xc>
+  800896:	eb 05                	jmp    80089d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800898:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80089d:	5d                   	pop    %ebp
+  80089e:	c3                   	ret
+
+0080089f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008ac:	38 ca                	cmp    %cl,%dl
+  8008ae:	74 09                	je     8008b9 <strfind+0x1a>
+  8008b0:	84 d2                	test   %dl,%dl
+  8008b2:	74 05                	je     8008b9 <strfind+0x1a>
+	for (; *s; s++)
+  8008b4:	83 c0 01             	add    $0x1,%eax
+  8008b7:	eb f0                	jmp    8008a9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b9:	5d                   	pop    %ebp
+  8008ba:	c3                   	ret
+
+008008bb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	57                   	push   %edi
+  8008bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008c5:	85 c9                	test   %ecx,%ecx
+  8008c7:	74 20                	je     8008e9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c9:	89 f8                	mov    %edi,%eax
+  8008cb:	09 c8                	or     %ecx,%eax
+  8008cd:	a8 03                	test   $0x3,%al
+  8008cf:	75 12                	jne    8008e3 <memset+0x28>
+		c &= 0xFF;
+  8008d1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008d5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008db:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008de:	fc                   	cld
+  8008df:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008e1:	eb 06                	jmp    8008e9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008e6:	fc                   	cld
+  8008e7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e9:	89 f8                	mov    %edi,%eax
+  8008eb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+008008f0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	57                   	push   %edi
+  8008f4:	56                   	push   %esi
+  8008f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008fe:	39 c6                	cmp    %eax,%esi
+  800900:	73 32                	jae    800934 <memmove+0x44>
+  800902:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800905:	39 d0                	cmp    %edx,%eax
+  800907:	73 2b                	jae    800934 <memmove+0x44>
+		s += n;
+		d += n;
+  800909:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80090c:	89 d6                	mov    %edx,%esi
+  80090e:	09 fe                	or     %edi,%esi
+  800910:	09 ce                	or     %ecx,%esi
+  800912:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800918:	75 0e                	jne    800928 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80091a:	83 ef 04             	sub    $0x4,%edi
+  80091d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800920:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800923:	fd                   	std
+  800924:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800926:	eb 09                	jmp    800931 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800928:	83 ef 01             	sub    $0x1,%edi
+  80092b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80092e:	fd                   	std
+  80092f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800931:	fc                   	cld
+  800932:	eb 1a                	jmp    80094e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800934:	89 f2                	mov    %esi,%edx
+  800936:	09 c2                	or     %eax,%edx
+  800938:	09 ca                	or     %ecx,%edx
+  80093a:	f6 c2 03             	test   $0x3,%dl
+  80093d:	75 0a                	jne    800949 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80093f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800942:	89 c7                	mov    %eax,%edi
+  800944:	fc                   	cld
+  800945:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800947:	eb 05                	jmp    80094e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800949:	89 c7                	mov    %eax,%edi
+  80094b:	fc                   	cld
+  80094c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80094e:	5e                   	pop    %esi
+  80094f:	5f                   	pop    %edi
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+
+00800952 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800958:	ff 75 10             	push   0x10(%ebp)
+  80095b:	ff 75 0c             	push   0xc(%ebp)
+  80095e:	ff 75 08             	push   0x8(%ebp)
+  800961:	e8 8a ff ff ff       	call   8008f0 <memmove>
+}
+  800966:	c9                   	leave
+  800967:	c3                   	ret
+
+00800968 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	56                   	push   %esi
+  80096c:	53                   	push   %ebx
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800973:	89 c6                	mov    %eax,%esi
+  800975:	03 75 10             	add    0x10(%ebp),%esi
+  800978:	eb 06                	jmp    800980 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80097a:	83 c0 01             	add    $0x1,%eax
+  80097d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800980:	39 f0                	cmp    %esi,%eax
+  800982:	74 14                	je     800998 <memcmp+0x30>
+		if (*s1 != *s2)
+  800984:	0f b6 08             	movzbl (%eax),%ecx
+  800987:	0f b6 1a             	movzbl (%edx),%ebx
+  80098a:	38 d9                	cmp    %bl,%cl
+  80098c:	74 ec                	je     80097a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80098e:	0f b6 c1             	movzbl %cl,%eax
+  800991:	0f b6 db             	movzbl %bl,%ebx
+  800994:	29 d8                	sub    %ebx,%eax
+  800996:	eb 05                	jmp    80099d <memcmp+0x35>
+	}
+
+	return 0;
+  800998:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80099d:	5b                   	pop    %ebx
+  80099e:	5e                   	pop    %esi
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+
+008009a1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009aa:	89 c2                	mov    %eax,%edx
+  8009ac:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009af:	eb 03                	jmp    8009b4 <memfind+0x13>
+  8009b1:	83 c0 01             	add    $0x1,%eax
+  8009b4:	39 d0                	cmp    %edx,%eax
+  8009b6:	73 04                	jae    8009bc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009b8:	38 08                	cmp    %cl,(%eax)
+  8009ba:	75 f5                	jne    8009b1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+
+008009be <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009be:	55                   	push   %ebp
+  8009bf:	89 e5                	mov    %esp,%ebp
+  8009c1:	57                   	push   %edi
+  8009c2:	56                   	push   %esi
+  8009c3:	53                   	push   %ebx
+  8009c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009ca:	eb 03                	jmp    8009cf <strtol+0x11>
+		s++;
+  8009cc:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009cf:	0f b6 02             	movzbl (%edx),%eax
+  8009d2:	3c 20                	cmp    $0x20,%al
+  8009d4:	74 f6                	je     8009cc <strtol+0xe>
+  8009d6:	3c 09                	cmp    $0x9,%al
+  8009d8:	74 f2                	je     8009cc <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009da:	3c 2b                	cmp    $0x2b,%al
+  8009dc:	74 2a                	je     800a08 <strtol+0x4a>
+	int neg = 0;
+  8009de:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009e3:	3c 2d                	cmp    $0x2d,%al
+  8009e5:	74 2b                	je     800a12 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009ed:	75 0f                	jne    8009fe <strtol+0x40>
+  8009ef:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009f2:	74 28                	je     800a1c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009f4:	85 db                	test   %ebx,%ebx
+  8009f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009fb:	0f 44 d8             	cmove  %eax,%ebx
+  8009fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a03:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a06:	eb 46                	jmp    800a4e <strtol+0x90>
+		s++;
+  800a08:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a10:	eb d5                	jmp    8009e7 <strtol+0x29>
+		s++, neg = 1;
+  800a12:	83 c2 01             	add    $0x1,%edx
+  800a15:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a1a:	eb cb                	jmp    8009e7 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a1c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a20:	74 0e                	je     800a30 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a22:	85 db                	test   %ebx,%ebx
+  800a24:	75 d8                	jne    8009fe <strtol+0x40>
+		s++, base = 8;
+  800a26:	83 c2 01             	add    $0x1,%edx
+  800a29:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a2e:	eb ce                	jmp    8009fe <strtol+0x40>
+		s += 2, base = 16;
+  800a30:	83 c2 02             	add    $0x2,%edx
+  800a33:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a38:	eb c4                	jmp    8009fe <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a3a:	0f be c0             	movsbl %al,%eax
+  800a3d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a40:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a43:	7d 3a                	jge    800a7f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a45:	83 c2 01             	add    $0x1,%edx
+  800a48:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a4c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a4e:	0f b6 02             	movzbl (%edx),%eax
+  800a51:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a54:	89 f3                	mov    %esi,%ebx
+  800a56:	80 fb 09             	cmp    $0x9,%bl
+  800a59:	76 df                	jbe    800a3a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a5b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a5e:	89 f3                	mov    %esi,%ebx
+  800a60:	80 fb 19             	cmp    $0x19,%bl
+  800a63:	77 08                	ja     800a6d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a65:	0f be c0             	movsbl %al,%eax
+  800a68:	83 e8 57             	sub    $0x57,%eax
+  800a6b:	eb d3                	jmp    800a40 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a6d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a70:	89 f3                	mov    %esi,%ebx
+  800a72:	80 fb 19             	cmp    $0x19,%bl
+  800a75:	77 08                	ja     800a7f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a77:	0f be c0             	movsbl %al,%eax
+  800a7a:	83 e8 37             	sub    $0x37,%eax
+  800a7d:	eb c1                	jmp    800a40 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a7f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a83:	74 05                	je     800a8a <strtol+0xcc>
+		*endptr = (char *) s;
+  800a85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a88:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a8a:	89 c8                	mov    %ecx,%eax
+  800a8c:	f7 d8                	neg    %eax
+  800a8e:	85 ff                	test   %edi,%edi
+  800a90:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a93:	89 c8                	mov    %ecx,%eax
+  800a95:	5b                   	pop    %ebx
+  800a96:	5e                   	pop    %esi
+  800a97:	5f                   	pop    %edi
+  800a98:	5d                   	pop    %ebp
+  800a99:	c3                   	ret
+
+00800a9a <atoi>:
+
+int
+atoi(const char* s)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800aa0:	6a 00                	push   $0x0
+  800aa2:	6a 00                	push   $0x0
+  800aa4:	ff 75 08             	push   0x8(%ebp)
+  800aa7:	e8 12 ff ff ff       	call   8009be <strtol>
+}
+  800aac:	c9                   	leave
+  800aad:	c3                   	ret
+
+00800aae <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800aae:	55                   	push   %ebp
+  800aaf:	89 e5                	mov    %esp,%ebp
+  800ab1:	57                   	push   %edi
+  800ab2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800abe:	89 c3                	mov    %eax,%ebx
+  800ac0:	89 c7                	mov    %eax,%edi
+  800ac2:	6a 00                	push   $0x0
+  800ac4:	55                   	push   %ebp
+  800ac5:	56                   	push   %esi
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	8d 35 d0 0a 80 00    	lea    0x800ad0,%esi
+  800ace:	0f 34                	sysenter
+
+00800ad0 <after_sysenter_label_47>:
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ad5:	5b                   	pop    %ebx
+  800ad6:	5f                   	pop    %edi
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+
+00800ad9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	57                   	push   %edi
+  800add:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ae8:	89 d1                	mov    %edx,%ecx
+  800aea:	89 d3                	mov    %edx,%ebx
+  800aec:	89 d7                	mov    %edx,%edi
+  800aee:	6a 00                	push   $0x0
+  800af0:	55                   	push   %ebp
+  800af1:	56                   	push   %esi
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	8d 35 fc 0a 80 00    	lea    0x800afc,%esi
+  800afa:	0f 34                	sysenter
+
+00800afc <after_sysenter_label_128>:
+  800afc:	5e                   	pop    %esi
+  800afd:	5d                   	pop    %ebp
+  800afe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b01:	5b                   	pop    %ebx
+  800b02:	5f                   	pop    %edi
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+
+00800b05 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b17:	89 cb                	mov    %ecx,%ebx
+  800b19:	89 cf                	mov    %ecx,%edi
+  800b1b:	6a 00                	push   $0x0
+  800b1d:	55                   	push   %ebp
+  800b1e:	56                   	push   %esi
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	8d 35 29 0b 80 00    	lea    0x800b29,%esi
+  800b27:	0f 34                	sysenter
+
+00800b29 <after_sysenter_label_212>:
+  800b29:	5e                   	pop    %esi
+  800b2a:	5d                   	pop    %ebp
+  800b2b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b2e:	85 c0                	test   %eax,%eax
+  800b30:	7f 07                	jg     800b39 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b35:	5b                   	pop    %ebx
+  800b36:	5f                   	pop    %edi
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b39:	83 ec 0c             	sub    $0xc,%esp
+  800b3c:	50                   	push   %eax
+  800b3d:	6a 03                	push   $0x3
+  800b3f:	68 95 4a 80 00       	push   $0x804a95
+  800b44:	6a 54                	push   $0x54
+  800b46:	68 b2 4a 80 00       	push   $0x804ab2
+  800b4b:	e8 38 30 00 00       	call   803b88 <_panic>
+
+00800b50 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	57                   	push   %edi
+  800b54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b5f:	89 d1                	mov    %edx,%ecx
+  800b61:	89 d3                	mov    %edx,%ebx
+  800b63:	89 d7                	mov    %edx,%edi
+  800b65:	6a 00                	push   $0x0
+  800b67:	55                   	push   %ebp
+  800b68:	56                   	push   %esi
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	8d 35 73 0b 80 00    	lea    0x800b73,%esi
+  800b71:	0f 34                	sysenter
+
+00800b73 <after_sysenter_label_309>:
+  800b73:	5e                   	pop    %esi
+  800b74:	5d                   	pop    %ebp
+  800b75:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b78:	5b                   	pop    %ebx
+  800b79:	5f                   	pop    %edi
+  800b7a:	5d                   	pop    %ebp
+  800b7b:	c3                   	ret
+
+00800b7c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	57                   	push   %edi
+  800b80:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b86:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b8b:	89 d1                	mov    %edx,%ecx
+  800b8d:	89 d3                	mov    %edx,%ebx
+  800b8f:	89 d7                	mov    %edx,%edi
+  800b91:	6a 00                	push   $0x0
+  800b93:	55                   	push   %ebp
+  800b94:	56                   	push   %esi
+  800b95:	89 e5                	mov    %esp,%ebp
+  800b97:	8d 35 9f 0b 80 00    	lea    0x800b9f,%esi
+  800b9d:	0f 34                	sysenter
+
+00800b9f <after_sysenter_label_391>:
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5f                   	pop    %edi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+
+00800ba8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	57                   	push   %edi
+  800bac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc0:	6a 00                	push   $0x0
+  800bc2:	55                   	push   %ebp
+  800bc3:	56                   	push   %esi
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	8d 35 ce 0b 80 00    	lea    0x800bce,%esi
+  800bcc:	0f 34                	sysenter
+
+00800bce <after_sysenter_label_479>:
+  800bce:	5e                   	pop    %esi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	7f 07                	jg     800bde <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bda:	5b                   	pop    %ebx
+  800bdb:	5f                   	pop    %edi
+  800bdc:	5d                   	pop    %ebp
+  800bdd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bde:	83 ec 0c             	sub    $0xc,%esp
+  800be1:	50                   	push   %eax
+  800be2:	6a 04                	push   $0x4
+  800be4:	68 95 4a 80 00       	push   $0x804a95
+  800be9:	6a 54                	push   $0x54
+  800beb:	68 b2 4a 80 00       	push   $0x804ab2
+  800bf0:	e8 93 2f 00 00       	call   803b88 <_panic>
+
+00800bf5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c00:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c08:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c0b:	ff 75 18             	push   0x18(%ebp)
+  800c0e:	55                   	push   %ebp
+  800c0f:	56                   	push   %esi
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	8d 35 1a 0c 80 00    	lea    0x800c1a,%esi
+  800c18:	0f 34                	sysenter
+
+00800c1a <after_sysenter_label_593>:
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c1f:	85 c0                	test   %eax,%eax
+  800c21:	7f 07                	jg     800c2a <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c26:	5b                   	pop    %ebx
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  800c2d:	50                   	push   %eax
+  800c2e:	6a 05                	push   $0x5
+  800c30:	68 95 4a 80 00       	push   $0x804a95
+  800c35:	6a 54                	push   $0x54
+  800c37:	68 b2 4a 80 00       	push   $0x804ab2
+  800c3c:	e8 47 2f 00 00       	call   803b88 <_panic>
+
+00800c41 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	57                   	push   %edi
+  800c45:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c51:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c56:	89 df                	mov    %ebx,%edi
+  800c58:	6a 00                	push   $0x0
+  800c5a:	55                   	push   %ebp
+  800c5b:	56                   	push   %esi
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	8d 35 66 0c 80 00    	lea    0x800c66,%esi
+  800c64:	0f 34                	sysenter
+
+00800c66 <after_sysenter_label_704>:
+  800c66:	5e                   	pop    %esi
+  800c67:	5d                   	pop    %ebp
+  800c68:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c6b:	85 c0                	test   %eax,%eax
+  800c6d:	7f 07                	jg     800c76 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c72:	5b                   	pop    %ebx
+  800c73:	5f                   	pop    %edi
+  800c74:	5d                   	pop    %ebp
+  800c75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+  800c79:	50                   	push   %eax
+  800c7a:	6a 06                	push   $0x6
+  800c7c:	68 95 4a 80 00       	push   $0x804a95
+  800c81:	6a 54                	push   $0x54
+  800c83:	68 b2 4a 80 00       	push   $0x804ab2
+  800c88:	e8 fb 2e 00 00       	call   803b88 <_panic>
+
+00800c8d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	57                   	push   %edi
+  800c91:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ca2:	89 df                	mov    %ebx,%edi
+  800ca4:	6a 00                	push   $0x0
+  800ca6:	55                   	push   %ebp
+  800ca7:	56                   	push   %esi
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	8d 35 b2 0c 80 00    	lea    0x800cb2,%esi
+  800cb0:	0f 34                	sysenter
+
+00800cb2 <after_sysenter_label_808>:
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	7f 07                	jg     800cc2 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cbe:	5b                   	pop    %ebx
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 08                	push   $0x8
+  800cc8:	68 95 4a 80 00       	push   $0x804a95
+  800ccd:	6a 54                	push   $0x54
+  800ccf:	68 b2 4a 80 00       	push   $0x804ab2
+  800cd4:	e8 af 2e 00 00       	call   803b88 <_panic>
+
+00800cd9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cee:	89 df                	mov    %ebx,%edi
+  800cf0:	6a 00                	push   $0x0
+  800cf2:	55                   	push   %ebp
+  800cf3:	56                   	push   %esi
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	8d 35 fe 0c 80 00    	lea    0x800cfe,%esi
+  800cfc:	0f 34                	sysenter
+
+00800cfe <after_sysenter_label_912>:
+  800cfe:	5e                   	pop    %esi
+  800cff:	5d                   	pop    %ebp
+  800d00:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	7f 07                	jg     800d0e <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0e:	83 ec 0c             	sub    $0xc,%esp
+  800d11:	50                   	push   %eax
+  800d12:	6a 09                	push   $0x9
+  800d14:	68 95 4a 80 00       	push   $0x804a95
+  800d19:	6a 54                	push   $0x54
+  800d1b:	68 b2 4a 80 00       	push   $0x804ab2
+  800d20:	e8 63 2e 00 00       	call   803b88 <_panic>
+
+00800d25 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d35:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3a:	89 df                	mov    %ebx,%edi
+  800d3c:	6a 00                	push   $0x0
+  800d3e:	55                   	push   %ebp
+  800d3f:	56                   	push   %esi
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	8d 35 4a 0d 80 00    	lea    0x800d4a,%esi
+  800d48:	0f 34                	sysenter
+
+00800d4a <after_sysenter_label_1016>:
+  800d4a:	5e                   	pop    %esi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d4f:	85 c0                	test   %eax,%eax
+  800d51:	7f 07                	jg     800d5a <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+  800d5d:	50                   	push   %eax
+  800d5e:	6a 0a                	push   $0xa
+  800d60:	68 95 4a 80 00       	push   $0x804a95
+  800d65:	6a 54                	push   $0x54
+  800d67:	68 b2 4a 80 00       	push   $0x804ab2
+  800d6c:	e8 17 2e 00 00       	call   803b88 <_panic>
+
+00800d71 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d87:	6a 00                	push   $0x0
+  800d89:	55                   	push   %ebp
+  800d8a:	56                   	push   %esi
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	8d 35 95 0d 80 00    	lea    0x800d95,%esi
+  800d93:	0f 34                	sysenter
+
+00800d95 <after_sysenter_label_1126>:
+  800d95:	5e                   	pop    %esi
+  800d96:	5d                   	pop    %ebp
+  800d97:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5f                   	pop    %edi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	c3                   	ret
+
+00800d9e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	57                   	push   %edi
+  800da2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dab:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800db0:	89 cb                	mov    %ecx,%ebx
+  800db2:	89 cf                	mov    %ecx,%edi
+  800db4:	6a 00                	push   $0x0
+  800db6:	55                   	push   %ebp
+  800db7:	56                   	push   %esi
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	8d 35 c2 0d 80 00    	lea    0x800dc2,%esi
+  800dc0:	0f 34                	sysenter
+
+00800dc2 <after_sysenter_label_1210>:
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc7:	85 c0                	test   %eax,%eax
+  800dc9:	7f 07                	jg     800dd2 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800dcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dce:	5b                   	pop    %ebx
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd2:	83 ec 0c             	sub    $0xc,%esp
+  800dd5:	50                   	push   %eax
+  800dd6:	6a 0d                	push   $0xd
+  800dd8:	68 95 4a 80 00       	push   $0x804a95
+  800ddd:	6a 54                	push   $0x54
+  800ddf:	68 b2 4a 80 00       	push   $0x804ab2
+  800de4:	e8 9f 2d 00 00       	call   803b88 <_panic>
+
+00800de9 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 42 00 00 00       	mov    $0x42,%eax
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	6a 00                	push   $0x0
+  800e02:	55                   	push   %ebp
+  800e03:	56                   	push   %esi
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	8d 35 0e 0e 80 00    	lea    0x800e0e,%esi
+  800e0c:	0f 34                	sysenter
+
+00800e0e <after_sysenter_label_1311>:
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e13:	85 c0                	test   %eax,%eax
+  800e15:	7f 07                	jg     800e1e <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 42                	push   $0x42
+  800e24:	68 95 4a 80 00       	push   $0x804a95
+  800e29:	6a 54                	push   $0x54
+  800e2b:	68 b2 4a 80 00       	push   $0x804ab2
+  800e30:	e8 53 2d 00 00       	call   803b88 <_panic>
+
+00800e35 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e44:	89 d1                	mov    %edx,%ecx
+  800e46:	89 d3                	mov    %edx,%ebx
+  800e48:	89 d7                	mov    %edx,%edi
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	55                   	push   %ebp
+  800e4d:	56                   	push   %esi
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	8d 35 58 0e 80 00    	lea    0x800e58,%esi
+  800e56:	0f 34                	sysenter
+
+00800e58 <after_sysenter_label_1411>:
+  800e58:	5e                   	pop    %esi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e71:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e76:	89 df                	mov    %ebx,%edi
+  800e78:	6a 00                	push   $0x0
+  800e7a:	55                   	push   %ebp
+  800e7b:	56                   	push   %esi
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	8d 35 86 0e 80 00    	lea    0x800e86,%esi
+  800e84:	0f 34                	sysenter
+
+00800e86 <after_sysenter_label_1497>:
+  800e86:	5e                   	pop    %esi
+  800e87:	5d                   	pop    %ebp
+  800e88:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ea4:	89 df                	mov    %ebx,%edi
+  800ea6:	6a 00                	push   $0x0
+  800ea8:	55                   	push   %ebp
+  800ea9:	56                   	push   %esi
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	8d 35 b4 0e 80 00    	lea    0x800eb4,%esi
+  800eb2:	0f 34                	sysenter
+
+00800eb4 <after_sysenter_label_1583>:
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5f                   	pop    %edi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+
+00800ebd <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec8:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed5:	6a 00                	push   $0x0
+  800ed7:	55                   	push   %ebp
+  800ed8:	56                   	push   %esi
+  800ed9:	89 e5                	mov    %esp,%ebp
+  800edb:	8d 35 e3 0e 80 00    	lea    0x800ee3,%esi
+  800ee1:	0f 34                	sysenter
+
+00800ee3 <after_sysenter_label_1672>:
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5d                   	pop    %ebp
+  800ee5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+
+00800eec <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f01:	89 df                	mov    %ebx,%edi
+  800f03:	6a 00                	push   $0x0
+  800f05:	55                   	push   %ebp
+  800f06:	56                   	push   %esi
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	8d 35 11 0f 80 00    	lea    0x800f11,%esi
+  800f0f:	0f 34                	sysenter
+
+00800f11 <after_sysenter_label_1758>:
+  800f11:	5e                   	pop    %esi
+  800f12:	5d                   	pop    %ebp
+  800f13:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f16:	5b                   	pop    %ebx
+  800f17:	5f                   	pop    %edi
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f27:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f2c:	89 cb                	mov    %ecx,%ebx
+  800f2e:	89 cf                	mov    %ecx,%edi
+  800f30:	6a 00                	push   $0x0
+  800f32:	55                   	push   %ebp
+  800f33:	56                   	push   %esi
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	8d 35 3e 0f 80 00    	lea    0x800f3e,%esi
+  800f3c:	0f 34                	sysenter
+
+00800f3e <after_sysenter_label_1842>:
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5d                   	pop    %ebp
+  800f40:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 07                	jg     800f4e <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800f47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5f                   	pop    %edi
+  800f4c:	5d                   	pop    %ebp
+  800f4d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4e:	83 ec 0c             	sub    $0xc,%esp
+  800f51:	50                   	push   %eax
+  800f52:	6a 13                	push   $0x13
+  800f54:	68 95 4a 80 00       	push   $0x804a95
+  800f59:	6a 54                	push   $0x54
+  800f5b:	68 b2 4a 80 00       	push   $0x804ab2
+  800f60:	e8 23 2c 00 00       	call   803b88 <_panic>
+
+00800f65 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f74:	89 d1                	mov    %edx,%ecx
+  800f76:	89 d3                	mov    %edx,%ebx
+  800f78:	89 d7                	mov    %edx,%edi
+  800f7a:	6a 00                	push   $0x0
+  800f7c:	55                   	push   %ebp
+  800f7d:	56                   	push   %esi
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	8d 35 88 0f 80 00    	lea    0x800f88,%esi
+  800f86:	0f 34                	sysenter
+
+00800f88 <after_sysenter_label_1939>:
+  800f88:	5e                   	pop    %esi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+
+00800f91 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	6a 00                	push   $0x0
+  800fab:	55                   	push   %ebp
+  800fac:	56                   	push   %esi
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	8d 35 b7 0f 80 00    	lea    0x800fb7,%esi
+  800fb5:	0f 34                	sysenter
+
+00800fb7 <after_sysenter_label_2028>:
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+
+00800fc0 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fd5:	89 df                	mov    %ebx,%edi
+  800fd7:	6a 00                	push   $0x0
+  800fd9:	55                   	push   %ebp
+  800fda:	56                   	push   %esi
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	8d 35 e5 0f 80 00    	lea    0x800fe5,%esi
+  800fe3:	0f 34                	sysenter
+
+00800fe5 <after_sysenter_label_2114>:
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800fea:	5b                   	pop    %ebx
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffe:	b8 17 00 00 00       	mov    $0x17,%eax
+  801003:	89 df                	mov    %ebx,%edi
+  801005:	6a 00                	push   $0x0
+  801007:	55                   	push   %ebp
+  801008:	56                   	push   %esi
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	8d 35 13 10 80 00    	lea    0x801013,%esi
+  801011:	0f 34                	sysenter
+
+00801013 <after_sysenter_label_2200>:
+  801013:	5e                   	pop    %esi
+  801014:	5d                   	pop    %ebp
+  801015:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801018:	5b                   	pop    %ebx
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801021:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801031:	89 df                	mov    %ebx,%edi
+  801033:	6a 00                	push   $0x0
+  801035:	55                   	push   %ebp
+  801036:	56                   	push   %esi
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	8d 35 41 10 80 00    	lea    0x801041,%esi
+  80103f:	0f 34                	sysenter
+
+00801041 <after_sysenter_label_2286>:
+  801041:	5e                   	pop    %esi
+  801042:	5d                   	pop    %ebp
+  801043:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801046:	5b                   	pop    %ebx
+  801047:	5f                   	pop    %edi
+  801048:	5d                   	pop    %ebp
+  801049:	c3                   	ret
+
+0080104a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80104d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801050:	05 00 00 00 30       	add    $0x30000000,%eax
+  801055:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801058:	5d                   	pop    %ebp
+  801059:	c3                   	ret
+
+0080105a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80105d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801060:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801065:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80106a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+
+00801071 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801074:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801079:	eb 02                	jmp    80107d <fd_alloc+0xc>
+  80107b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80107d:	89 c2                	mov    %eax,%edx
+  80107f:	c1 ea 16             	shr    $0x16,%edx
+  801082:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801089:	f6 c2 01             	test   $0x1,%dl
+  80108c:	74 2b                	je     8010b9 <fd_alloc+0x48>
+  80108e:	89 c2                	mov    %eax,%edx
+  801090:	c1 ea 0c             	shr    $0xc,%edx
+  801093:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80109a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010a0:	f6 c1 01             	test   $0x1,%cl
+  8010a3:	74 14                	je     8010b9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010a5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010ab:	75 ce                	jne    80107b <fd_alloc+0xa>
+  8010ad:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010b2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010b7:	eb 05                	jmp    8010be <fd_alloc+0x4d>
+			return 0;
+  8010b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	89 02                	mov    %eax,(%edx)
+}
+  8010c3:	89 c8                	mov    %ecx,%eax
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010cd:	83 f8 1f             	cmp    $0x1f,%eax
+  8010d0:	77 30                	ja     801102 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010d2:	c1 e0 0c             	shl    $0xc,%eax
+  8010d5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010da:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010e0:	f6 c2 01             	test   $0x1,%dl
+  8010e3:	74 24                	je     801109 <fd_lookup+0x42>
+  8010e5:	89 c2                	mov    %eax,%edx
+  8010e7:	c1 ea 0c             	shr    $0xc,%edx
+  8010ea:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010f1:	f6 c2 01             	test   $0x1,%dl
+  8010f4:	74 1a                	je     801110 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010f9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+		return -E_INVAL;
+  801102:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801107:	eb f7                	jmp    801100 <fd_lookup+0x39>
+		return -E_INVAL;
+  801109:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80110e:	eb f0                	jmp    801100 <fd_lookup+0x39>
+  801110:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801115:	eb e9                	jmp    801100 <fd_lookup+0x39>
+
+00801117 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	53                   	push   %ebx
+  80111b:	83 ec 04             	sub    $0x4,%esp
+  80111e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801121:	b8 00 00 00 00       	mov    $0x0,%eax
+  801126:	eb 03                	jmp    80112b <dev_lookup+0x14>
+  801128:	83 c0 01             	add    $0x1,%eax
+  80112b:	8b 1c 85 3c 4b 80 00 	mov    0x804b3c(,%eax,4),%ebx
+  801132:	85 db                	test   %ebx,%ebx
+  801134:	74 0b                	je     801141 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801136:	39 13                	cmp    %edx,(%ebx)
+  801138:	75 ee                	jne    801128 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80113a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113f:	eb 49                	jmp    80118a <dev_lookup+0x73>
+  801141:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801143:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801149:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80114e:	77 18                	ja     801168 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801150:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801155:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801157:	c1 e8 10             	shr    $0x10,%eax
+  80115a:	74 0c                	je     801168 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80115c:	c1 e0 10             	shl    $0x10,%eax
+  80115f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801164:	29 c1                	sub    %eax,%ecx
+  801166:	eb 06                	jmp    80116e <dev_lookup+0x57>
+		return pthread_main_tls;
+  801168:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80116e:	8b 01                	mov    (%ecx),%eax
+  801170:	8b 40 48             	mov    0x48(%eax),%eax
+  801173:	83 ec 04             	sub    $0x4,%esp
+  801176:	52                   	push   %edx
+  801177:	50                   	push   %eax
+  801178:	68 c0 4a 80 00       	push   $0x804ac0
+  80117d:	e8 04 f0 ff ff       	call   800186 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801182:	83 c4 10             	add    $0x10,%esp
+  801185:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80118a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80118d:	89 1a                	mov    %ebx,(%edx)
+}
+  80118f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+
+00801194 <fd_close>:
+{
+  801194:	55                   	push   %ebp
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	57                   	push   %edi
+  801198:	56                   	push   %esi
+  801199:	53                   	push   %ebx
+  80119a:	83 ec 24             	sub    $0x24,%esp
+  80119d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011a6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011a7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ad:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011b0:	50                   	push   %eax
+  8011b1:	e8 11 ff ff ff       	call   8010c7 <fd_lookup>
+  8011b6:	89 c3                	mov    %eax,%ebx
+  8011b8:	83 c4 10             	add    $0x10,%esp
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	78 05                	js     8011c4 <fd_close+0x30>
+	    || fd != fd2)
+  8011bf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011c2:	74 16                	je     8011da <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011c4:	89 f8                	mov    %edi,%eax
+  8011c6:	84 c0                	test   %al,%al
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011d0:	89 d8                	mov    %ebx,%eax
+  8011d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5f                   	pop    %edi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011da:	83 ec 08             	sub    $0x8,%esp
+  8011dd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011e0:	50                   	push   %eax
+  8011e1:	ff 36                	push   (%esi)
+  8011e3:	e8 2f ff ff ff       	call   801117 <dev_lookup>
+  8011e8:	89 c3                	mov    %eax,%ebx
+  8011ea:	83 c4 10             	add    $0x10,%esp
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	78 1a                	js     80120b <fd_close+0x77>
+		if (dev->dev_close)
+  8011f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011f4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	74 0b                	je     80120b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801200:	83 ec 0c             	sub    $0xc,%esp
+  801203:	56                   	push   %esi
+  801204:	ff d0                	call   *%eax
+  801206:	89 c3                	mov    %eax,%ebx
+  801208:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80120b:	83 ec 08             	sub    $0x8,%esp
+  80120e:	56                   	push   %esi
+  80120f:	6a 00                	push   $0x0
+  801211:	e8 2b fa ff ff       	call   800c41 <sys_page_unmap>
+	return r;
+  801216:	83 c4 10             	add    $0x10,%esp
+  801219:	eb b5                	jmp    8011d0 <fd_close+0x3c>
+
+0080121b <close>:
+
+int
+close(int fdnum)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801221:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801224:	50                   	push   %eax
+  801225:	ff 75 08             	push   0x8(%ebp)
+  801228:	e8 9a fe ff ff       	call   8010c7 <fd_lookup>
+  80122d:	83 c4 10             	add    $0x10,%esp
+  801230:	85 c0                	test   %eax,%eax
+  801232:	79 02                	jns    801236 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801234:	c9                   	leave
+  801235:	c3                   	ret
+		return fd_close(fd, 1);
+  801236:	83 ec 08             	sub    $0x8,%esp
+  801239:	6a 01                	push   $0x1
+  80123b:	ff 75 f4             	push   -0xc(%ebp)
+  80123e:	e8 51 ff ff ff       	call   801194 <fd_close>
+  801243:	83 c4 10             	add    $0x10,%esp
+  801246:	eb ec                	jmp    801234 <close+0x19>
+
+00801248 <close_all>:
+
+void
+close_all(void)
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	53                   	push   %ebx
+  80124c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80124f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	53                   	push   %ebx
+  801258:	e8 be ff ff ff       	call   80121b <close>
+	for (i = 0; i < MAXFD; i++)
+  80125d:	83 c3 01             	add    $0x1,%ebx
+  801260:	83 c4 10             	add    $0x10,%esp
+  801263:	83 fb 20             	cmp    $0x20,%ebx
+  801266:	75 ec                	jne    801254 <close_all+0xc>
+}
+  801268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+
+0080126d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  801273:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801276:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801279:	50                   	push   %eax
+  80127a:	ff 75 08             	push   0x8(%ebp)
+  80127d:	e8 45 fe ff ff       	call   8010c7 <fd_lookup>
+  801282:	89 c3                	mov    %eax,%ebx
+  801284:	83 c4 10             	add    $0x10,%esp
+  801287:	85 c0                	test   %eax,%eax
+  801289:	78 7f                	js     80130a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80128b:	83 ec 0c             	sub    $0xc,%esp
+  80128e:	ff 75 0c             	push   0xc(%ebp)
+  801291:	e8 85 ff ff ff       	call   80121b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801296:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801299:	c1 e6 0c             	shl    $0xc,%esi
+  80129c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012a5:	89 3c 24             	mov    %edi,(%esp)
+  8012a8:	e8 ad fd ff ff       	call   80105a <fd2data>
+  8012ad:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012af:	89 34 24             	mov    %esi,(%esp)
+  8012b2:	e8 a3 fd ff ff       	call   80105a <fd2data>
+  8012b7:	83 c4 10             	add    $0x10,%esp
+  8012ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012bd:	89 d8                	mov    %ebx,%eax
+  8012bf:	c1 e8 16             	shr    $0x16,%eax
+  8012c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012c9:	a8 01                	test   $0x1,%al
+  8012cb:	74 11                	je     8012de <dup+0x71>
+  8012cd:	89 d8                	mov    %ebx,%eax
+  8012cf:	c1 e8 0c             	shr    $0xc,%eax
+  8012d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012d9:	f6 c2 01             	test   $0x1,%dl
+  8012dc:	75 36                	jne    801314 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012de:	89 f8                	mov    %edi,%eax
+  8012e0:	c1 e8 0c             	shr    $0xc,%eax
+  8012e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012ea:	83 ec 0c             	sub    $0xc,%esp
+  8012ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012f2:	50                   	push   %eax
+  8012f3:	56                   	push   %esi
+  8012f4:	6a 00                	push   $0x0
+  8012f6:	57                   	push   %edi
+  8012f7:	6a 00                	push   $0x0
+  8012f9:	e8 f7 f8 ff ff       	call   800bf5 <sys_page_map>
+  8012fe:	89 c3                	mov    %eax,%ebx
+  801300:	83 c4 20             	add    $0x20,%esp
+  801303:	85 c0                	test   %eax,%eax
+  801305:	78 33                	js     80133a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801307:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80130a:	89 d8                	mov    %ebx,%eax
+  80130c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130f:	5b                   	pop    %ebx
+  801310:	5e                   	pop    %esi
+  801311:	5f                   	pop    %edi
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801314:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80131b:	83 ec 0c             	sub    $0xc,%esp
+  80131e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801323:	50                   	push   %eax
+  801324:	ff 75 d4             	push   -0x2c(%ebp)
+  801327:	6a 00                	push   $0x0
+  801329:	53                   	push   %ebx
+  80132a:	6a 00                	push   $0x0
+  80132c:	e8 c4 f8 ff ff       	call   800bf5 <sys_page_map>
+  801331:	89 c3                	mov    %eax,%ebx
+  801333:	83 c4 20             	add    $0x20,%esp
+  801336:	85 c0                	test   %eax,%eax
+  801338:	79 a4                	jns    8012de <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80133a:	83 ec 08             	sub    $0x8,%esp
+  80133d:	56                   	push   %esi
+  80133e:	6a 00                	push   $0x0
+  801340:	e8 fc f8 ff ff       	call   800c41 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801345:	83 c4 08             	add    $0x8,%esp
+  801348:	ff 75 d4             	push   -0x2c(%ebp)
+  80134b:	6a 00                	push   $0x0
+  80134d:	e8 ef f8 ff ff       	call   800c41 <sys_page_unmap>
+	return r;
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	eb b3                	jmp    80130a <dup+0x9d>
+
+00801357 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	56                   	push   %esi
+  80135b:	53                   	push   %ebx
+  80135c:	83 ec 18             	sub    $0x18,%esp
+  80135f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801362:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801365:	50                   	push   %eax
+  801366:	53                   	push   %ebx
+  801367:	e8 5b fd ff ff       	call   8010c7 <fd_lookup>
+  80136c:	83 c4 10             	add    $0x10,%esp
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 3c                	js     8013af <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801373:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801376:	83 ec 08             	sub    $0x8,%esp
+  801379:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80137c:	50                   	push   %eax
+  80137d:	ff 36                	push   (%esi)
+  80137f:	e8 93 fd ff ff       	call   801117 <dev_lookup>
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	85 c0                	test   %eax,%eax
+  801389:	78 24                	js     8013af <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80138b:	8b 46 08             	mov    0x8(%esi),%eax
+  80138e:	83 e0 03             	and    $0x3,%eax
+  801391:	83 f8 01             	cmp    $0x1,%eax
+  801394:	74 20                	je     8013b6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801396:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801399:	8b 40 08             	mov    0x8(%eax),%eax
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	74 61                	je     801401 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013a0:	83 ec 04             	sub    $0x4,%esp
+  8013a3:	ff 75 10             	push   0x10(%ebp)
+  8013a6:	ff 75 0c             	push   0xc(%ebp)
+  8013a9:	56                   	push   %esi
+  8013aa:	ff d0                	call   *%eax
+  8013ac:	83 c4 10             	add    $0x10,%esp
+}
+  8013af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b2:	5b                   	pop    %ebx
+  8013b3:	5e                   	pop    %esi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+  8013b6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013b8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8013be:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8013c3:	77 18                	ja     8013dd <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8013c5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8013ca:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8013cc:	c1 e8 10             	shr    $0x10,%eax
+  8013cf:	74 0c                	je     8013dd <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8013d1:	c1 e0 10             	shl    $0x10,%eax
+  8013d4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8013d9:	29 c2                	sub    %eax,%edx
+  8013db:	eb 06                	jmp    8013e3 <read+0x8c>
+		return pthread_main_tls;
+  8013dd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013e3:	8b 02                	mov    (%edx),%eax
+  8013e5:	8b 40 48             	mov    0x48(%eax),%eax
+  8013e8:	83 ec 04             	sub    $0x4,%esp
+  8013eb:	53                   	push   %ebx
+  8013ec:	50                   	push   %eax
+  8013ed:	68 01 4b 80 00       	push   $0x804b01
+  8013f2:	e8 8f ed ff ff       	call   800186 <cprintf>
+		return -E_INVAL;
+  8013f7:	83 c4 10             	add    $0x10,%esp
+  8013fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ff:	eb ae                	jmp    8013af <read+0x58>
+		return -E_NOT_SUPP;
+  801401:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801406:	eb a7                	jmp    8013af <read+0x58>
+
+00801408 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+  80140e:	83 ec 0c             	sub    $0xc,%esp
+  801411:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801414:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801417:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141c:	eb 02                	jmp    801420 <readn+0x18>
+  80141e:	01 c3                	add    %eax,%ebx
+  801420:	39 f3                	cmp    %esi,%ebx
+  801422:	73 21                	jae    801445 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801424:	83 ec 04             	sub    $0x4,%esp
+  801427:	89 f0                	mov    %esi,%eax
+  801429:	29 d8                	sub    %ebx,%eax
+  80142b:	50                   	push   %eax
+  80142c:	89 d8                	mov    %ebx,%eax
+  80142e:	03 45 0c             	add    0xc(%ebp),%eax
+  801431:	50                   	push   %eax
+  801432:	57                   	push   %edi
+  801433:	e8 1f ff ff ff       	call   801357 <read>
+		if (m < 0)
+  801438:	83 c4 10             	add    $0x10,%esp
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	78 04                	js     801443 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80143f:	75 dd                	jne    80141e <readn+0x16>
+  801441:	eb 02                	jmp    801445 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801443:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801445:	89 d8                	mov    %ebx,%eax
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+
+0080144f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+  801454:	83 ec 18             	sub    $0x18,%esp
+  801457:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80145a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145d:	50                   	push   %eax
+  80145e:	53                   	push   %ebx
+  80145f:	e8 63 fc ff ff       	call   8010c7 <fd_lookup>
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	85 c0                	test   %eax,%eax
+  801469:	78 37                	js     8014a2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80146b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80146e:	83 ec 08             	sub    $0x8,%esp
+  801471:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801474:	50                   	push   %eax
+  801475:	ff 36                	push   (%esi)
+  801477:	e8 9b fc ff ff       	call   801117 <dev_lookup>
+  80147c:	83 c4 10             	add    $0x10,%esp
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	78 1f                	js     8014a2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801483:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801487:	74 20                	je     8014a9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801489:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80148c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	74 61                	je     8014f4 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801493:	83 ec 04             	sub    $0x4,%esp
+  801496:	ff 75 10             	push   0x10(%ebp)
+  801499:	ff 75 0c             	push   0xc(%ebp)
+  80149c:	56                   	push   %esi
+  80149d:	ff d0                	call   *%eax
+  80149f:	83 c4 10             	add    $0x10,%esp
+}
+  8014a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+  8014a9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014ab:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014b1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014b6:	77 18                	ja     8014d0 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014b8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014bd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014bf:	c1 e8 10             	shr    $0x10,%eax
+  8014c2:	74 0c                	je     8014d0 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014c4:	c1 e0 10             	shl    $0x10,%eax
+  8014c7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014cc:	29 c2                	sub    %eax,%edx
+  8014ce:	eb 06                	jmp    8014d6 <write+0x87>
+		return pthread_main_tls;
+  8014d0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014d6:	8b 02                	mov    (%edx),%eax
+  8014d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8014db:	83 ec 04             	sub    $0x4,%esp
+  8014de:	53                   	push   %ebx
+  8014df:	50                   	push   %eax
+  8014e0:	68 1d 4b 80 00       	push   $0x804b1d
+  8014e5:	e8 9c ec ff ff       	call   800186 <cprintf>
+		return -E_INVAL;
+  8014ea:	83 c4 10             	add    $0x10,%esp
+  8014ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f2:	eb ae                	jmp    8014a2 <write+0x53>
+		return -E_NOT_SUPP;
+  8014f4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014f9:	eb a7                	jmp    8014a2 <write+0x53>
+
+008014fb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+  8014fe:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801501:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801504:	50                   	push   %eax
+  801505:	ff 75 08             	push   0x8(%ebp)
+  801508:	e8 ba fb ff ff       	call   8010c7 <fd_lookup>
+  80150d:	83 c4 10             	add    $0x10,%esp
+  801510:	85 c0                	test   %eax,%eax
+  801512:	78 0e                	js     801522 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801514:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801517:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80151a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801522:	c9                   	leave
+  801523:	c3                   	ret
+
+00801524 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	56                   	push   %esi
+  801528:	53                   	push   %ebx
+  801529:	83 ec 18             	sub    $0x18,%esp
+  80152c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80152f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801532:	50                   	push   %eax
+  801533:	53                   	push   %ebx
+  801534:	e8 8e fb ff ff       	call   8010c7 <fd_lookup>
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 34                	js     801574 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801540:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801543:	83 ec 08             	sub    $0x8,%esp
+  801546:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801549:	50                   	push   %eax
+  80154a:	ff 36                	push   (%esi)
+  80154c:	e8 c6 fb ff ff       	call   801117 <dev_lookup>
+  801551:	83 c4 10             	add    $0x10,%esp
+  801554:	85 c0                	test   %eax,%eax
+  801556:	78 1c                	js     801574 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801558:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80155c:	74 1d                	je     80157b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80155e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801561:	8b 40 18             	mov    0x18(%eax),%eax
+  801564:	85 c0                	test   %eax,%eax
+  801566:	74 5e                	je     8015c6 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	ff 75 0c             	push   0xc(%ebp)
+  80156e:	56                   	push   %esi
+  80156f:	ff d0                	call   *%eax
+  801571:	83 c4 10             	add    $0x10,%esp
+}
+  801574:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801577:	5b                   	pop    %ebx
+  801578:	5e                   	pop    %esi
+  801579:	5d                   	pop    %ebp
+  80157a:	c3                   	ret
+  80157b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80157d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801583:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801588:	77 18                	ja     8015a2 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80158a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80158f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801591:	c1 e8 10             	shr    $0x10,%eax
+  801594:	74 0c                	je     8015a2 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801596:	c1 e0 10             	shl    $0x10,%eax
+  801599:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80159e:	29 c2                	sub    %eax,%edx
+  8015a0:	eb 06                	jmp    8015a8 <ftruncate+0x84>
+		return pthread_main_tls;
+  8015a2:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8015a8:	8b 02                	mov    (%edx),%eax
+  8015aa:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015ad:	83 ec 04             	sub    $0x4,%esp
+  8015b0:	53                   	push   %ebx
+  8015b1:	50                   	push   %eax
+  8015b2:	68 e0 4a 80 00       	push   $0x804ae0
+  8015b7:	e8 ca eb ff ff       	call   800186 <cprintf>
+		return -E_INVAL;
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c4:	eb ae                	jmp    801574 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015c6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015cb:	eb a7                	jmp    801574 <ftruncate+0x50>
+
+008015cd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	56                   	push   %esi
+  8015d1:	53                   	push   %ebx
+  8015d2:	83 ec 18             	sub    $0x18,%esp
+  8015d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015db:	50                   	push   %eax
+  8015dc:	ff 75 08             	push   0x8(%ebp)
+  8015df:	e8 e3 fa ff ff       	call   8010c7 <fd_lookup>
+  8015e4:	83 c4 10             	add    $0x10,%esp
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	78 49                	js     801634 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ee:	83 ec 08             	sub    $0x8,%esp
+  8015f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	ff 36                	push   (%esi)
+  8015f7:	e8 1b fb ff ff       	call   801117 <dev_lookup>
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 31                	js     801634 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801606:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80160a:	74 2f                	je     80163b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80160c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80160f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801616:	00 00 00 
+	stat->st_isdir = 0;
+  801619:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801620:	00 00 00 
+	stat->st_dev = dev;
+  801623:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801629:	83 ec 08             	sub    $0x8,%esp
+  80162c:	53                   	push   %ebx
+  80162d:	56                   	push   %esi
+  80162e:	ff 50 14             	call   *0x14(%eax)
+  801631:	83 c4 10             	add    $0x10,%esp
+}
+  801634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80163b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801640:	eb f2                	jmp    801634 <fstat+0x67>
+
+00801642 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	6a 00                	push   $0x0
+  80164c:	ff 75 08             	push   0x8(%ebp)
+  80164f:	e8 4b 03 00 00       	call   80199f <open>
+  801654:	89 c3                	mov    %eax,%ebx
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	78 1b                	js     801678 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80165d:	83 ec 08             	sub    $0x8,%esp
+  801660:	ff 75 0c             	push   0xc(%ebp)
+  801663:	50                   	push   %eax
+  801664:	e8 64 ff ff ff       	call   8015cd <fstat>
+  801669:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80166b:	89 1c 24             	mov    %ebx,(%esp)
+  80166e:	e8 a8 fb ff ff       	call   80121b <close>
+	return r;
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	89 f3                	mov    %esi,%ebx
+}
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+
+00801681 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	56                   	push   %esi
+  801685:	53                   	push   %ebx
+  801686:	89 c6                	mov    %eax,%esi
+  801688:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80168a:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801691:	74 27                	je     8016ba <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801693:	6a 07                	push   $0x7
+  801695:	68 00 70 80 00       	push   $0x807000
+  80169a:	56                   	push   %esi
+  80169b:	ff 35 00 60 80 00    	push   0x806000
+  8016a1:	e8 94 2c 00 00       	call   80433a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016a6:	83 c4 0c             	add    $0xc,%esp
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	53                   	push   %ebx
+  8016ac:	6a 00                	push   $0x0
+  8016ae:	e8 91 2b 00 00       	call   804244 <ipc_recv>
+}
+  8016b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b6:	5b                   	pop    %ebx
+  8016b7:	5e                   	pop    %esi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	6a 01                	push   $0x1
+  8016bf:	e8 cc 2c 00 00       	call   804390 <ipc_find_env>
+  8016c4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	eb c5                	jmp    801693 <fsipc+0x12>
+
+008016ce <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016ce:	55                   	push   %ebp
+  8016cf:	89 e5                	mov    %esp,%ebp
+  8016d1:	53                   	push   %ebx
+  8016d2:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8016d5:	68 04 60 80 00       	push   $0x806004
+  8016da:	e8 29 1b 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e5:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8016ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016ed:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8016f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016fc:	e8 80 ff ff ff       	call   801681 <fsipc>
+  801701:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801703:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80170a:	e8 66 1b 00 00       	call   803275 <mutex_unlock>
+	return r;
+}
+  80170f:	89 d8                	mov    %ebx,%eax
+  801711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+00801716 <devfile_flush>:
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	53                   	push   %ebx
+  80171a:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80171d:	68 04 60 80 00       	push   $0x806004
+  801722:	e8 e1 1a 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801727:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80172d:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801732:	ba 00 00 00 00       	mov    $0x0,%edx
+  801737:	b8 06 00 00 00       	mov    $0x6,%eax
+  80173c:	e8 40 ff ff ff       	call   801681 <fsipc>
+  801741:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801743:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80174a:	e8 26 1b 00 00       	call   803275 <mutex_unlock>
+}
+  80174f:	89 d8                	mov    %ebx,%eax
+  801751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+
+00801756 <devfile_stat>:
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+  80175b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80175e:	83 ec 0c             	sub    $0xc,%esp
+  801761:	68 04 60 80 00       	push   $0x806004
+  801766:	e8 9d 1a 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80176b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801771:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801780:	e8 fc fe ff ff       	call   801681 <fsipc>
+  801785:	89 c3                	mov    %eax,%ebx
+  801787:	83 c4 10             	add    $0x10,%esp
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	79 16                	jns    8017a4 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80178e:	83 ec 0c             	sub    $0xc,%esp
+  801791:	68 04 60 80 00       	push   $0x806004
+  801796:	e8 da 1a 00 00       	call   803275 <mutex_unlock>
+}
+  80179b:	89 d8                	mov    %ebx,%eax
+  80179d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a0:	5b                   	pop    %ebx
+  8017a1:	5e                   	pop    %esi
+  8017a2:	5d                   	pop    %ebp
+  8017a3:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017a4:	83 ec 08             	sub    $0x8,%esp
+  8017a7:	68 00 70 80 00       	push   $0x807000
+  8017ac:	56                   	push   %esi
+  8017ad:	e8 b8 ef ff ff       	call   80076a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8017b2:	a1 80 70 80 00       	mov    0x807080,%eax
+  8017b7:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017bd:	a1 84 70 80 00       	mov    0x807084,%eax
+  8017c2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8017c8:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8017cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d0:	eb bc                	jmp    80178e <devfile_stat+0x38>
+
+008017d2 <devfile_write>:
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 10             	sub    $0x10,%esp
+  8017d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8017dc:	68 04 60 80 00       	push   $0x806004
+  8017e1:	e8 22 1a 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ec:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8017f1:	83 c4 10             	add    $0x10,%esp
+  8017f4:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8017fa:	76 3d                	jbe    801839 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8017fc:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801801:	39 c3                	cmp    %eax,%ebx
+  801803:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801806:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801809:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  80180e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801814:	ba 00 00 00 00       	mov    $0x0,%edx
+  801819:	b8 04 00 00 00       	mov    $0x4,%eax
+  80181e:	e8 5e fe ff ff       	call   801681 <fsipc>
+  801823:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801825:	83 ec 0c             	sub    $0xc,%esp
+  801828:	68 04 60 80 00       	push   $0x806004
+  80182d:	e8 43 1a 00 00       	call   803275 <mutex_unlock>
+}
+  801832:	89 d8                	mov    %ebx,%eax
+  801834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801839:	83 ec 04             	sub    $0x4,%esp
+  80183c:	53                   	push   %ebx
+  80183d:	ff 75 0c             	push   0xc(%ebp)
+  801840:	68 0c 70 80 00       	push   $0x80700c
+  801845:	e8 a6 f0 ff ff       	call   8008f0 <memmove>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801852:	eb b5                	jmp    801809 <devfile_write+0x37>
+
+00801854 <devfile_read>:
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	57                   	push   %edi
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801860:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801863:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801866:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80186c:	0f 86 8c 00 00 00    	jbe    8018fe <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801872:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801877:	39 c3                	cmp    %eax,%ebx
+  801879:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80187c:	89 f8                	mov    %edi,%eax
+  80187e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801881:	eb 0f                	jmp    801892 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801883:	0f b6 08             	movzbl (%eax),%ecx
+  801886:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801888:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80188d:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801892:	39 d0                	cmp    %edx,%eax
+  801894:	72 ed                	jb     801883 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801896:	83 ec 0c             	sub    $0xc,%esp
+  801899:	68 04 60 80 00       	push   $0x806004
+  80189e:	e8 65 19 00 00       	call   803208 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018a3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8018a6:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8018ab:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8018b1:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8018b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018c1:	e8 bb fd ff ff       	call   801681 <fsipc>
+  8018c6:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8018c8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8018cf:	e8 a1 19 00 00       	call   803275 <mutex_unlock>
+		assert(r <= (int) n);
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	39 f3                	cmp    %esi,%ebx
+  8018d9:	7c 0a                	jl     8018e5 <devfile_read+0x91>
+}
+  8018db:	89 f0                	mov    %esi,%eax
+  8018dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e0:	5b                   	pop    %ebx
+  8018e1:	5e                   	pop    %esi
+  8018e2:	5f                   	pop    %edi
+  8018e3:	5d                   	pop    %ebp
+  8018e4:	c3                   	ret
+		assert(r <= (int) n);
+  8018e5:	68 50 4b 80 00       	push   $0x804b50
+  8018ea:	68 5d 4b 80 00       	push   $0x804b5d
+  8018ef:	68 90 00 00 00       	push   $0x90
+  8018f4:	68 72 4b 80 00       	push   $0x804b72
+  8018f9:	e8 8a 22 00 00       	call   803b88 <_panic>
+	mutex_lock(&fsipc_mu);
+  8018fe:	83 ec 0c             	sub    $0xc,%esp
+  801901:	68 04 60 80 00       	push   $0x806004
+  801906:	e8 fd 18 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80190b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80190e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801913:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801919:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801920:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801923:	ba 00 00 00 00       	mov    $0x0,%edx
+  801928:	b8 03 00 00 00       	mov    $0x3,%eax
+  80192d:	e8 4f fd ff ff       	call   801681 <fsipc>
+  801932:	89 c6                	mov    %eax,%esi
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 1d                	js     801958 <devfile_read+0x104>
+		assert(r <= n);
+  80193b:	39 c3                	cmp    %eax,%ebx
+  80193d:	72 2e                	jb     80196d <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80193f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801944:	7f 40                	jg     801986 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801946:	83 ec 04             	sub    $0x4,%esp
+  801949:	50                   	push   %eax
+  80194a:	68 00 70 80 00       	push   $0x807000
+  80194f:	57                   	push   %edi
+  801950:	e8 9b ef ff ff       	call   8008f0 <memmove>
+  801955:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	68 04 60 80 00       	push   $0x806004
+  801960:	e8 10 19 00 00       	call   803275 <mutex_unlock>
+	return r;
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	e9 6e ff ff ff       	jmp    8018db <devfile_read+0x87>
+		assert(r <= n);
+  80196d:	68 7d 4b 80 00       	push   $0x804b7d
+  801972:	68 5d 4b 80 00       	push   $0x804b5d
+  801977:	68 99 00 00 00       	push   $0x99
+  80197c:	68 72 4b 80 00       	push   $0x804b72
+  801981:	e8 02 22 00 00       	call   803b88 <_panic>
+		assert(r <= PGSIZE);
+  801986:	68 84 4b 80 00       	push   $0x804b84
+  80198b:	68 5d 4b 80 00       	push   $0x804b5d
+  801990:	68 9a 00 00 00       	push   $0x9a
+  801995:	68 72 4b 80 00       	push   $0x804b72
+  80199a:	e8 e9 21 00 00       	call   803b88 <_panic>
+
+0080199f <open>:
+{
+  80199f:	55                   	push   %ebp
+  8019a0:	89 e5                	mov    %esp,%ebp
+  8019a2:	56                   	push   %esi
+  8019a3:	53                   	push   %ebx
+  8019a4:	83 ec 1c             	sub    $0x1c,%esp
+  8019a7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019aa:	56                   	push   %esi
+  8019ab:	e8 7f ed ff ff       	call   80072f <strlen>
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019b8:	0f 8f 85 00 00 00    	jg     801a43 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019be:	83 ec 0c             	sub    $0xc,%esp
+  8019c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c4:	50                   	push   %eax
+  8019c5:	e8 a7 f6 ff ff       	call   801071 <fd_alloc>
+  8019ca:	89 c3                	mov    %eax,%ebx
+  8019cc:	83 c4 10             	add    $0x10,%esp
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	78 55                	js     801a28 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8019d3:	83 ec 0c             	sub    $0xc,%esp
+  8019d6:	68 04 60 80 00       	push   $0x806004
+  8019db:	e8 28 18 00 00       	call   803208 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8019e0:	83 c4 08             	add    $0x8,%esp
+  8019e3:	56                   	push   %esi
+  8019e4:	68 00 70 80 00       	push   $0x807000
+  8019e9:	e8 7c ed ff ff       	call   80076a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8019ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f1:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  8019f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019fe:	e8 7e fc ff ff       	call   801681 <fsipc>
+  801a03:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a05:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801a0c:	e8 64 18 00 00       	call   803275 <mutex_unlock>
+	if (r < 0) {
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	85 db                	test   %ebx,%ebx
+  801a16:	78 19                	js     801a31 <open+0x92>
+	return fd2num(fd);
+  801a18:	83 ec 0c             	sub    $0xc,%esp
+  801a1b:	ff 75 f4             	push   -0xc(%ebp)
+  801a1e:	e8 27 f6 ff ff       	call   80104a <fd2num>
+  801a23:	89 c3                	mov    %eax,%ebx
+  801a25:	83 c4 10             	add    $0x10,%esp
+}
+  801a28:	89 d8                	mov    %ebx,%eax
+  801a2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a2d:	5b                   	pop    %ebx
+  801a2e:	5e                   	pop    %esi
+  801a2f:	5d                   	pop    %ebp
+  801a30:	c3                   	ret
+		fd_close(fd, 0);
+  801a31:	83 ec 08             	sub    $0x8,%esp
+  801a34:	6a 00                	push   $0x0
+  801a36:	ff 75 f4             	push   -0xc(%ebp)
+  801a39:	e8 56 f7 ff ff       	call   801194 <fd_close>
+		return r;
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	eb e5                	jmp    801a28 <open+0x89>
+		return -E_BAD_PATH;
+  801a43:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a48:	eb de                	jmp    801a28 <open+0x89>
+
+00801a4a <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a54:	50                   	push   %eax
+  801a55:	ff 75 08             	push   0x8(%ebp)
+  801a58:	e8 6a f6 ff ff       	call   8010c7 <fd_lookup>
+  801a5d:	89 c3                	mov    %eax,%ebx
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	85 c0                	test   %eax,%eax
+  801a64:	78 5b                	js     801ac1 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a69:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801a6f:	39 08                	cmp    %ecx,(%eax)
+  801a71:	75 55                	jne    801ac8 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801a73:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801a77:	74 56                	je     801acf <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801a79:	83 ec 0c             	sub    $0xc,%esp
+  801a7c:	68 04 60 80 00       	push   $0x806004
+  801a81:	e8 82 17 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a89:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a8c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801a91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a94:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801a99:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a9c:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801aab:	e8 d1 fb ff ff       	call   801681 <fsipc>
+  801ab0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ab2:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ab9:	e8 b7 17 00 00       	call   803275 <mutex_unlock>
+	return r;
+  801abe:	83 c4 10             	add    $0x10,%esp
+}
+  801ac1:	89 d8                	mov    %ebx,%eax
+  801ac3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac6:	c9                   	leave
+  801ac7:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ac8:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801acd:	eb f2                	jmp    801ac1 <fallocate+0x77>
+		return -E_INVAL;
+  801acf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ad4:	eb eb                	jmp    801ac1 <fallocate+0x77>
+
+00801ad6 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+  801adb:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ade:	89 f3                	mov    %esi,%ebx
+  801ae0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801ae6:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ae9:	eb 06                	jmp    801af1 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801aeb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801af1:	39 f3                	cmp    %esi,%ebx
+  801af3:	73 14                	jae    801b09 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801af5:	83 ec 08             	sub    $0x8,%esp
+  801af8:	53                   	push   %ebx
+  801af9:	6a 00                	push   $0x0
+  801afb:	e8 41 f1 ff ff       	call   800c41 <sys_page_unmap>
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	79 e4                	jns    801aeb <munmap+0x15>
+  801b07:	eb 05                	jmp    801b0e <munmap+0x38>
+			return r;
+	return 0;
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b11:	5b                   	pop    %ebx
+  801b12:	5e                   	pop    %esi
+  801b13:	5d                   	pop    %ebp
+  801b14:	c3                   	ret
+
+00801b15 <mmap>:
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	57                   	push   %edi
+  801b19:	56                   	push   %esi
+  801b1a:	53                   	push   %ebx
+  801b1b:	83 ec 24             	sub    $0x24,%esp
+  801b1e:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b21:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b24:	50                   	push   %eax
+  801b25:	ff 75 08             	push   0x8(%ebp)
+  801b28:	e8 9a f5 ff ff       	call   8010c7 <fd_lookup>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	0f 88 37 01 00 00    	js     801c6f <mmap+0x15a>
+		return NULL;
+  801b38:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b3d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b40:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b46:	39 0a                	cmp    %ecx,(%edx)
+  801b48:	0f 85 05 01 00 00    	jne    801c53 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801b4e:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801b55:	0f 85 1b 01 00 00    	jne    801c76 <mmap+0x161>
+  801b5b:	89 f0                	mov    %esi,%eax
+  801b5d:	83 e8 01             	sub    $0x1,%eax
+  801b60:	0f 88 17 01 00 00    	js     801c7d <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801b66:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801b6a:	75 28                	jne    801b94 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801b6c:	83 ec 0c             	sub    $0xc,%esp
+  801b6f:	68 04 60 80 00       	push   $0x806004
+  801b74:	e8 8f 16 00 00       	call   803208 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801b79:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801b7f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801b85:	83 c4 10             	add    $0x10,%esp
+  801b88:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801b8d:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801b92:	eb 2b                	jmp    801bbf <mmap+0xaa>
+		cow_enable();
+  801b94:	e8 3a 22 00 00       	call   803dd3 <cow_enable>
+  801b99:	eb d1                	jmp    801b6c <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801b9b:	89 c2                	mov    %eax,%edx
+  801b9d:	c1 ea 0c             	shr    $0xc,%edx
+  801ba0:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801ba7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bad:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801bb3:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801bb6:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801bb8:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801bbd:	77 25                	ja     801be4 <mmap+0xcf>
+  801bbf:	89 c2                	mov    %eax,%edx
+  801bc1:	29 da                	sub    %ebx,%edx
+  801bc3:	39 ca                	cmp    %ecx,%edx
+  801bc5:	73 3a                	jae    801c01 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801bc7:	89 c2                	mov    %eax,%edx
+  801bc9:	c1 ea 16             	shr    $0x16,%edx
+  801bcc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bd3:	f6 c2 01             	test   $0x1,%dl
+  801bd6:	75 c3                	jne    801b9b <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801bd8:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801bdd:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801be2:	eb d4                	jmp    801bb8 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801be4:	29 d8                	sub    %ebx,%eax
+  801be6:	39 c8                	cmp    %ecx,%eax
+  801be8:	73 17                	jae    801c01 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+  801bed:	68 04 60 80 00       	push   $0x806004
+  801bf2:	e8 7e 16 00 00       	call   803275 <mutex_unlock>
+		return NULL;
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bff:	eb 52                	jmp    801c53 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c01:	85 db                	test   %ebx,%ebx
+  801c03:	74 e5                	je     801bea <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c05:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801c10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c13:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801c18:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801c1e:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801c24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c27:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c31:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c36:	e8 46 fa ff ff       	call   801681 <fsipc>
+  801c3b:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801c3d:	83 ec 0c             	sub    $0xc,%esp
+  801c40:	68 04 60 80 00       	push   $0x806004
+  801c45:	e8 2b 16 00 00       	call   803275 <mutex_unlock>
+	if (r < 0) {
+  801c4a:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801c4d:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801c4f:	85 ff                	test   %edi,%edi
+  801c51:	78 08                	js     801c5b <mmap+0x146>
+}
+  801c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c56:	5b                   	pop    %ebx
+  801c57:	5e                   	pop    %esi
+  801c58:	5f                   	pop    %edi
+  801c59:	5d                   	pop    %ebp
+  801c5a:	c3                   	ret
+		munmap((void*) va, len);
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	56                   	push   %esi
+  801c5f:	53                   	push   %ebx
+  801c60:	e8 71 fe ff ff       	call   801ad6 <munmap>
+		return NULL;
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	eb e4                	jmp    801c53 <mmap+0x13e>
+		return NULL;
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c74:	eb dd                	jmp    801c53 <mmap+0x13e>
+		return NULL;
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7b:	eb d6                	jmp    801c53 <mmap+0x13e>
+  801c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c82:	eb cf                	jmp    801c53 <mmap+0x13e>
+
+00801c84 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801c84:	55                   	push   %ebp
+  801c85:	89 e5                	mov    %esp,%ebp
+  801c87:	53                   	push   %ebx
+  801c88:	83 ec 10             	sub    $0x10,%esp
+  801c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801c8e:	53                   	push   %ebx
+  801c8f:	e8 9b ea ff ff       	call   80072f <strlen>
+  801c94:	83 c4 10             	add    $0x10,%esp
+  801c97:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c9c:	7f 42                	jg     801ce0 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801c9e:	83 ec 0c             	sub    $0xc,%esp
+  801ca1:	68 04 60 80 00       	push   $0x806004
+  801ca6:	e8 5d 15 00 00       	call   803208 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801cab:	83 c4 08             	add    $0x8,%esp
+  801cae:	53                   	push   %ebx
+  801caf:	68 00 70 80 00       	push   $0x807000
+  801cb4:	e8 b1 ea ff ff       	call   80076a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801cb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbe:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cc3:	e8 b9 f9 ff ff       	call   801681 <fsipc>
+  801cc8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cca:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801cd1:	e8 9f 15 00 00       	call   803275 <mutex_unlock>
+	return r;
+  801cd6:	83 c4 10             	add    $0x10,%esp
+}
+  801cd9:	89 d8                	mov    %ebx,%eax
+  801cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cde:	c9                   	leave
+  801cdf:	c3                   	ret
+		return -E_BAD_PATH;
+  801ce0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ce5:	eb f2                	jmp    801cd9 <remove+0x55>
+
+00801ce7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ce7:	55                   	push   %ebp
+  801ce8:	89 e5                	mov    %esp,%ebp
+  801cea:	53                   	push   %ebx
+  801ceb:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801cee:	68 04 60 80 00       	push   $0x806004
+  801cf3:	e8 10 15 00 00       	call   803208 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801cf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfd:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d02:	e8 7a f9 ff ff       	call   801681 <fsipc>
+  801d07:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d09:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d10:	e8 60 15 00 00       	call   803275 <mutex_unlock>
+	return r;
+}
+  801d15:	89 d8                	mov    %ebx,%eax
+  801d17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d1a:	c9                   	leave
+  801d1b:	c3                   	ret
+
+00801d1c <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	56                   	push   %esi
+  801d20:	53                   	push   %ebx
+  801d21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d24:	83 ec 0c             	sub    $0xc,%esp
+  801d27:	68 04 60 80 00       	push   $0x806004
+  801d2c:	e8 d7 14 00 00       	call   803208 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801d31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d34:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d43:	e8 39 f9 ff ff       	call   801681 <fsipc>
+  801d48:	89 c6                	mov    %eax,%esi
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 db                	test   %ebx,%ebx
+  801d4f:	74 7b                	je     801dcc <fs_bcstat+0xb0>
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 77                	js     801dcc <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801d55:	a1 00 70 80 00       	mov    0x807000,%eax
+  801d5a:	89 03                	mov    %eax,(%ebx)
+  801d5c:	a1 04 70 80 00       	mov    0x807004,%eax
+  801d61:	89 43 04             	mov    %eax,0x4(%ebx)
+  801d64:	a1 08 70 80 00       	mov    0x807008,%eax
+  801d69:	89 43 08             	mov    %eax,0x8(%ebx)
+  801d6c:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801d71:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801d74:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d79:	89 43 10             	mov    %eax,0x10(%ebx)
+  801d7c:	a1 14 70 80 00       	mov    0x807014,%eax
+  801d81:	89 43 14             	mov    %eax,0x14(%ebx)
+  801d84:	a1 18 70 80 00       	mov    0x807018,%eax
+  801d89:	89 43 18             	mov    %eax,0x18(%ebx)
+  801d8c:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801d91:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801d94:	a1 20 70 80 00       	mov    0x807020,%eax
+  801d99:	89 43 20             	mov    %eax,0x20(%ebx)
+  801d9c:	a1 24 70 80 00       	mov    0x807024,%eax
+  801da1:	89 43 24             	mov    %eax,0x24(%ebx)
+  801da4:	a1 28 70 80 00       	mov    0x807028,%eax
+  801da9:	89 43 28             	mov    %eax,0x28(%ebx)
+  801dac:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801db1:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801db4:	a1 30 70 80 00       	mov    0x807030,%eax
+  801db9:	89 43 30             	mov    %eax,0x30(%ebx)
+  801dbc:	a1 34 70 80 00       	mov    0x807034,%eax
+  801dc1:	89 43 34             	mov    %eax,0x34(%ebx)
+  801dc4:	a1 38 70 80 00       	mov    0x807038,%eax
+  801dc9:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801dcc:	83 ec 0c             	sub    $0xc,%esp
+  801dcf:	68 04 60 80 00       	push   $0x806004
+  801dd4:	e8 9c 14 00 00       	call   803275 <mutex_unlock>
+	return r;
+}
+  801dd9:	89 f0                	mov    %esi,%eax
+  801ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dde:	5b                   	pop    %ebx
+  801ddf:	5e                   	pop    %esi
+  801de0:	5d                   	pop    %ebp
+  801de1:	c3                   	ret
+
+00801de2 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	56                   	push   %esi
+  801de6:	53                   	push   %ebx
+  801de7:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801de9:	0f b6 10             	movzbl (%eax),%edx
+  801dec:	80 fa 72             	cmp    $0x72,%dl
+  801def:	74 44                	je     801e35 <parse_mode+0x53>
+  801df1:	80 fa 77             	cmp    $0x77,%dl
+  801df4:	74 4b                	je     801e41 <parse_mode+0x5f>
+  801df6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801dfb:	80 fa 61             	cmp    $0x61,%dl
+  801dfe:	74 09                	je     801e09 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801e00:	89 d8                	mov    %ebx,%eax
+  801e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e05:	5b                   	pop    %ebx
+  801e06:	5e                   	pop    %esi
+  801e07:	5d                   	pop    %ebp
+  801e08:	c3                   	ret
+	switch (mode[0]) {
+  801e09:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801e0e:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801e13:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801e15:	83 ec 08             	sub    $0x8,%esp
+  801e18:	6a 2b                	push   $0x2b
+  801e1a:	50                   	push   %eax
+  801e1b:	e8 5c ea ff ff       	call   80087c <strchr>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	74 d9                	je     801e00 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801e27:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801e2a:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801e2d:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801e33:	eb cb                	jmp    801e00 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801e35:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e3f:	eb d2                	jmp    801e13 <parse_mode+0x31>
+  801e41:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801e46:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801e4b:	eb c6                	jmp    801e13 <parse_mode+0x31>
+
+00801e4d <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801e4d:	55                   	push   %ebp
+  801e4e:	89 e5                	mov    %esp,%ebp
+  801e50:	57                   	push   %edi
+  801e51:	56                   	push   %esi
+  801e52:	53                   	push   %ebx
+  801e53:	83 ec 1c             	sub    $0x1c,%esp
+  801e56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e59:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e5c:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801e61:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801e66:	83 c0 24             	add    $0x24,%eax
+  801e69:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801e6d:	74 17                	je     801e86 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e6f:	83 c3 01             	add    $0x1,%ebx
+  801e72:	83 fb 10             	cmp    $0x10,%ebx
+  801e75:	75 ef                	jne    801e66 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801e77:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801e7c:	89 f0                	mov    %esi,%eax
+  801e7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e81:	5b                   	pop    %ebx
+  801e82:	5e                   	pop    %esi
+  801e83:	5f                   	pop    %edi
+  801e84:	5d                   	pop    %ebp
+  801e85:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801e86:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801e8d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e90:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801e93:	c1 e7 02             	shl    $0x2,%edi
+  801e96:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801e9c:	83 ec 04             	sub    $0x4,%esp
+  801e9f:	6a 24                	push   $0x24
+  801ea1:	6a 00                	push   $0x0
+  801ea3:	56                   	push   %esi
+  801ea4:	e8 12 ea ff ff       	call   8008bb <memset>
+			streams[i].f_fd = fd;
+  801ea9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801eac:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801eb2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801eb5:	01 d8                	add    %ebx,%eax
+  801eb7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801eba:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801ec1:	83 c4 10             	add    $0x10,%esp
+  801ec4:	eb b6                	jmp    801e7c <stream_alloc+0x2f>
+
+00801ec6 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	53                   	push   %ebx
+  801eca:	83 ec 14             	sub    $0x14,%esp
+  801ecd:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801ecf:	8b 40 18             	mov    0x18(%eax),%eax
+  801ed2:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801ed5:	74 4a                	je     801f21 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ed7:	83 ec 08             	sub    $0x8,%esp
+  801eda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edd:	50                   	push   %eax
+  801ede:	ff 33                	push   (%ebx)
+  801ee0:	e8 e2 f1 ff ff       	call   8010c7 <fd_lookup>
+  801ee5:	89 c2                	mov    %eax,%edx
+  801ee7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801eef:	85 d2                	test   %edx,%edx
+  801ef1:	78 41                	js     801f34 <stream_unread+0x6e>
+  801ef3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ef6:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801efc:	39 0a                	cmp    %ecx,(%edx)
+  801efe:	75 34                	jne    801f34 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801f00:	8b 43 14             	mov    0x14(%ebx),%eax
+  801f03:	03 42 04             	add    0x4(%edx),%eax
+  801f06:	2b 43 18             	sub    0x18(%ebx),%eax
+  801f09:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801f0c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f13:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801f1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f1f:	eb 13                	jmp    801f34 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801f21:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f28:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801f2f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f37:	c9                   	leave
+  801f38:	c3                   	ret
+
+00801f39 <stream_drain>:
+{
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+  801f3c:	56                   	push   %esi
+  801f3d:	53                   	push   %ebx
+  801f3e:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f45:	eb 02                	jmp    801f49 <stream_drain+0x10>
+  801f47:	01 c3                	add    %eax,%ebx
+  801f49:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f4c:	39 c3                	cmp    %eax,%ebx
+  801f4e:	73 43                	jae    801f93 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801f50:	83 ec 04             	sub    $0x4,%esp
+  801f53:	29 d8                	sub    %ebx,%eax
+  801f55:	50                   	push   %eax
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	03 46 0c             	add    0xc(%esi),%eax
+  801f5b:	50                   	push   %eax
+  801f5c:	ff 36                	push   (%esi)
+  801f5e:	e8 ec f4 ff ff       	call   80144f <write>
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	7f dd                	jg     801f47 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801f6a:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801f6e:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f77:	29 d8                	sub    %ebx,%eax
+  801f79:	50                   	push   %eax
+  801f7a:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  801f7d:	50                   	push   %eax
+  801f7e:	52                   	push   %edx
+  801f7f:	e8 6c e9 ff ff       	call   8008f0 <memmove>
+			f->f_wend -= done;
+  801f84:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f87:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801f91:	eb 0a                	jmp    801f9d <stream_drain+0x64>
+  801f93:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  801f98:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  801f9d:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  801fa0:	89 d0                	mov    %edx,%eax
+  801fa2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa5:	5b                   	pop    %ebx
+  801fa6:	5e                   	pop    %esi
+  801fa7:	5d                   	pop    %ebp
+  801fa8:	c3                   	ret
+
+00801fa9 <stream_setup>:
+	if (f->f_buf)
+  801fa9:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801fad:	74 01                	je     801fb0 <stream_setup+0x7>
+  801faf:	c3                   	ret
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	53                   	push   %ebx
+  801fb4:	83 ec 04             	sub    $0x4,%esp
+  801fb7:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801fb9:	8b 40 08             	mov    0x8(%eax),%eax
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	74 17                	je     801fd7 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801fc0:	83 f8 03             	cmp    $0x3,%eax
+  801fc3:	75 2d                	jne    801ff2 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  801fc5:	8d 43 20             	lea    0x20(%ebx),%eax
+  801fc8:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  801fcb:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd5:	c9                   	leave
+  801fd6:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801fd7:	83 ec 0c             	sub    $0xc,%esp
+  801fda:	ff 33                	push   (%ebx)
+  801fdc:	e8 29 1b 00 00       	call   803b0a <iscons>
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	0f 9f c0             	setg   %al
+  801fe9:	0f b6 c0             	movzbl %al,%eax
+  801fec:	83 c0 01             	add    $0x1,%eax
+  801fef:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801ff2:	83 ec 0c             	sub    $0xc,%esp
+  801ff5:	68 00 10 00 00       	push   $0x1000
+  801ffa:	e8 6e 0b 00 00       	call   802b6d <malloc>
+  801fff:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	74 bc                	je     801fc5 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802009:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802010:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802014:	eb bc                	jmp    801fd2 <stream_setup+0x29>
+
+00802016 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802016:	55                   	push   %ebp
+  802017:	89 e5                	mov    %esp,%ebp
+  802019:	53                   	push   %ebx
+  80201a:	83 ec 04             	sub    $0x4,%esp
+  80201d:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80201f:	e8 85 ff ff ff       	call   801fa9 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802024:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802029:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80202d:	74 3d                	je     80206c <stream_fill+0x56>
+  80202f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802033:	74 10                	je     802045 <stream_fill+0x2f>
+  802035:	89 d8                	mov    %ebx,%eax
+  802037:	e8 fd fe ff ff       	call   801f39 <stream_drain>
+		return 0;
+  80203c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 27                	js     80206c <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802045:	83 ec 04             	sub    $0x4,%esp
+  802048:	ff 73 10             	push   0x10(%ebx)
+  80204b:	ff 73 0c             	push   0xc(%ebx)
+  80204e:	ff 33                	push   (%ebx)
+  802050:	e8 02 f3 ff ff       	call   801357 <read>
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	7e 17                	jle    802073 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80205c:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802060:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802067:	89 c2                	mov    %eax,%edx
+  802069:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80206c:	89 d0                	mov    %edx,%eax
+  80206e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802073:	c1 f8 1f             	sar    $0x1f,%eax
+  802076:	83 e0 04             	and    $0x4,%eax
+  802079:	83 c0 04             	add    $0x4,%eax
+  80207c:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80207f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802084:	eb e6                	jmp    80206c <stream_fill+0x56>
+
+00802086 <fopen>:
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	57                   	push   %edi
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802092:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802095:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80209b:	89 f0                	mov    %esi,%eax
+  80209d:	e8 40 fd ff ff       	call   801de2 <parse_mode>
+		return 0;
+  8020a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 2d                	js     8020d8 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8020ab:	83 ec 08             	sub    $0x8,%esp
+  8020ae:	50                   	push   %eax
+  8020af:	ff 75 08             	push   0x8(%ebp)
+  8020b2:	e8 e8 f8 ff ff       	call   80199f <open>
+  8020b7:	89 c7                	mov    %eax,%edi
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 58                	js     802118 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020c0:	80 3e 61             	cmpb   $0x61,(%esi)
+  8020c3:	74 1d                	je     8020e2 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8020c5:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8020cb:	89 f8                	mov    %edi,%eax
+  8020cd:	e8 7b fd ff ff       	call   801e4d <stream_alloc>
+  8020d2:	89 c3                	mov    %eax,%ebx
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	74 32                	je     80210a <fopen+0x84>
+}
+  8020d8:	89 d8                	mov    %ebx,%eax
+  8020da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020dd:	5b                   	pop    %ebx
+  8020de:	5e                   	pop    %esi
+  8020df:	5f                   	pop    %edi
+  8020e0:	5d                   	pop    %ebp
+  8020e1:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020e2:	83 ec 08             	sub    $0x8,%esp
+  8020e5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8020eb:	50                   	push   %eax
+  8020ec:	57                   	push   %edi
+  8020ed:	e8 db f4 ff ff       	call   8015cd <fstat>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	78 cc                	js     8020c5 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  8020fc:	ff 75 dc             	push   -0x24(%ebp)
+  8020ff:	57                   	push   %edi
+  802100:	e8 f6 f3 ff ff       	call   8014fb <seek>
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	eb bb                	jmp    8020c5 <fopen+0x3f>
+		close(fd);
+  80210a:	83 ec 0c             	sub    $0xc,%esp
+  80210d:	57                   	push   %edi
+  80210e:	e8 08 f1 ff ff       	call   80121b <close>
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	eb c0                	jmp    8020d8 <fopen+0x52>
+		return 0;
+  802118:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80211d:	eb b9                	jmp    8020d8 <fopen+0x52>
+
+0080211f <fdopen>:
+{
+  80211f:	55                   	push   %ebp
+  802120:	89 e5                	mov    %esp,%ebp
+  802122:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802125:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802128:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80212b:	e8 b2 fc ff ff       	call   801de2 <parse_mode>
+  802130:	89 c2                	mov    %eax,%edx
+		return 0;
+  802132:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802137:	85 d2                	test   %edx,%edx
+  802139:	78 0b                	js     802146 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80213b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802141:	e8 07 fd ff ff       	call   801e4d <stream_alloc>
+}
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+
+00802148 <setvbuf>:
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	57                   	push   %edi
+  80214c:	56                   	push   %esi
+  80214d:	53                   	push   %ebx
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	8b 55 10             	mov    0x10(%ebp),%edx
+  802154:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802157:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80215b:	75 3a                	jne    802197 <setvbuf+0x4f>
+  80215d:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802160:	83 fe 02             	cmp    $0x2,%esi
+  802163:	77 39                	ja     80219e <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802165:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802168:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80216c:	0f 95 c3             	setne  %bl
+  80216f:	85 ff                	test   %edi,%edi
+  802171:	0f 95 c1             	setne  %cl
+  802174:	84 cb                	test   %cl,%bl
+  802176:	74 05                	je     80217d <setvbuf+0x35>
+  802178:	83 fa 03             	cmp    $0x3,%edx
+  80217b:	75 0a                	jne    802187 <setvbuf+0x3f>
+	return 0;
+  80217d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802182:	5b                   	pop    %ebx
+  802183:	5e                   	pop    %esi
+  802184:	5f                   	pop    %edi
+  802185:	5d                   	pop    %ebp
+  802186:	c3                   	ret
+		f->f_buf = buf;
+  802187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80218a:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80218d:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802190:	b8 00 00 00 00       	mov    $0x0,%eax
+  802195:	eb eb                	jmp    802182 <setvbuf+0x3a>
+		return EOF;
+  802197:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80219c:	eb e4                	jmp    802182 <setvbuf+0x3a>
+  80219e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021a3:	eb dd                	jmp    802182 <setvbuf+0x3a>
+
+008021a5 <fflush>:
+{
+  8021a5:	55                   	push   %ebp
+  8021a6:	89 e5                	mov    %esp,%ebp
+  8021a8:	57                   	push   %edi
+  8021a9:	56                   	push   %esi
+  8021aa:	53                   	push   %ebx
+  8021ab:	83 ec 0c             	sub    $0xc,%esp
+  8021ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8021b1:	85 db                	test   %ebx,%ebx
+  8021b3:	74 1a                	je     8021cf <fflush+0x2a>
+	stream_unread(f);
+  8021b5:	89 d8                	mov    %ebx,%eax
+  8021b7:	e8 0a fd ff ff       	call   801ec6 <stream_unread>
+	return stream_drain(f);
+  8021bc:	89 d8                	mov    %ebx,%eax
+  8021be:	e8 76 fd ff ff       	call   801f39 <stream_drain>
+  8021c3:	89 c7                	mov    %eax,%edi
+}
+  8021c5:	89 f8                	mov    %edi,%eax
+  8021c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ca:	5b                   	pop    %ebx
+  8021cb:	5e                   	pop    %esi
+  8021cc:	5f                   	pop    %edi
+  8021cd:	5d                   	pop    %ebp
+  8021ce:	c3                   	ret
+  8021cf:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8021d4:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8021d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021de:	eb 03                	jmp    8021e3 <fflush+0x3e>
+  8021e0:	83 c3 24             	add    $0x24,%ebx
+  8021e3:	39 f3                	cmp    %esi,%ebx
+  8021e5:	74 de                	je     8021c5 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8021e7:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8021eb:	74 f3                	je     8021e0 <fflush+0x3b>
+  8021ed:	83 ec 0c             	sub    $0xc,%esp
+  8021f0:	53                   	push   %ebx
+  8021f1:	e8 af ff ff ff       	call   8021a5 <fflush>
+  8021f6:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802200:	0f 48 f8             	cmovs  %eax,%edi
+  802203:	eb db                	jmp    8021e0 <fflush+0x3b>
+
+00802205 <fclose>:
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	56                   	push   %esi
+  802209:	53                   	push   %ebx
+  80220a:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80220d:	83 ec 0c             	sub    $0xc,%esp
+  802210:	56                   	push   %esi
+  802211:	e8 8f ff ff ff       	call   8021a5 <fflush>
+  802216:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802218:	83 c4 04             	add    $0x4,%esp
+  80221b:	ff 36                	push   (%esi)
+  80221d:	e8 f9 ef ff ff       	call   80121b <close>
+  802222:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802225:	85 c0                	test   %eax,%eax
+  802227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80222c:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80222f:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802233:	75 10                	jne    802245 <fclose+0x40>
+	f->f_flags = 0;
+  802235:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80223c:	89 d8                	mov    %ebx,%eax
+  80223e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802241:	5b                   	pop    %ebx
+  802242:	5e                   	pop    %esi
+  802243:	5d                   	pop    %ebp
+  802244:	c3                   	ret
+		free(f->f_buf);
+  802245:	83 ec 0c             	sub    $0xc,%esp
+  802248:	ff 76 0c             	push   0xc(%esi)
+  80224b:	e8 54 08 00 00       	call   802aa4 <free>
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	eb e0                	jmp    802235 <fclose+0x30>
+
+00802255 <fileno>:
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225b:	8b 00                	mov    (%eax),%eax
+}
+  80225d:	5d                   	pop    %ebp
+  80225e:	c3                   	ret
+
+0080225f <feof>:
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802262:	8b 45 08             	mov    0x8(%ebp),%eax
+  802265:	8b 40 04             	mov    0x4(%eax),%eax
+  802268:	c1 e8 02             	shr    $0x2,%eax
+  80226b:	83 e0 01             	and    $0x1,%eax
+}
+  80226e:	5d                   	pop    %ebp
+  80226f:	c3                   	ret
+
+00802270 <ferror>:
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802273:	8b 45 08             	mov    0x8(%ebp),%eax
+  802276:	8b 40 04             	mov    0x4(%eax),%eax
+  802279:	c1 e8 03             	shr    $0x3,%eax
+  80227c:	83 e0 01             	and    $0x1,%eax
+}
+  80227f:	5d                   	pop    %ebp
+  802280:	c3                   	ret
+
+00802281 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	53                   	push   %ebx
+  802285:	83 ec 04             	sub    $0x4,%esp
+  802288:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80228b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80228e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802291:	74 15                	je     8022a8 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802293:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802296:	8b 43 14             	mov    0x14(%ebx),%eax
+  802299:	8d 48 01             	lea    0x1(%eax),%ecx
+  80229c:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80229f:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8022a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a6:	c9                   	leave
+  8022a7:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022a8:	89 d8                	mov    %ebx,%eax
+  8022aa:	e8 67 fd ff ff       	call   802016 <stream_fill>
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	75 e0                	jne    802293 <fgetc+0x12>
+		return EOF;
+  8022b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022b8:	eb e9                	jmp    8022a3 <fgetc+0x22>
+
+008022ba <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	57                   	push   %edi
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 1c             	sub    $0x1c,%esp
+  8022c3:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8022c6:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ce:	83 e8 01             	sub    $0x1,%eax
+  8022d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8022d4:	eb 66                	jmp    80233c <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8022d6:	8b 46 14             	mov    0x14(%esi),%eax
+  8022d9:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8022dc:	29 c3                	sub    %eax,%ebx
+  8022de:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8022e1:	29 fa                	sub    %edi,%edx
+  8022e3:	39 d3                	cmp    %edx,%ebx
+  8022e5:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8022e8:	83 ec 04             	sub    $0x4,%esp
+  8022eb:	53                   	push   %ebx
+  8022ec:	6a 0a                	push   $0xa
+  8022ee:	03 46 0c             	add    0xc(%esi),%eax
+  8022f1:	50                   	push   %eax
+  8022f2:	e8 aa e6 ff ff       	call   8009a1 <memfind>
+  8022f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8022fa:	8b 46 0c             	mov    0xc(%esi),%eax
+  8022fd:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802300:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802303:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80230b:	74 0b                	je     802318 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80230d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802310:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802313:	29 d3                	sub    %edx,%ebx
+  802315:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802318:	83 ec 04             	sub    $0x4,%esp
+  80231b:	53                   	push   %ebx
+  80231c:	01 c8                	add    %ecx,%eax
+  80231e:	50                   	push   %eax
+  80231f:	89 f8                	mov    %edi,%eax
+  802321:	03 45 08             	add    0x8(%ebp),%eax
+  802324:	50                   	push   %eax
+  802325:	e8 c6 e5 ff ff       	call   8008f0 <memmove>
+		f->f_rpos += m;
+  80232a:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80232d:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	8b 45 08             	mov    0x8(%ebp),%eax
+  802335:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80233a:	74 1f                	je     80235b <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80233c:	8d 47 01             	lea    0x1(%edi),%eax
+  80233f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802342:	73 17                	jae    80235b <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802344:	8b 46 18             	mov    0x18(%esi),%eax
+  802347:	39 46 14             	cmp    %eax,0x14(%esi)
+  80234a:	75 8a                	jne    8022d6 <fgets+0x1c>
+  80234c:	89 f0                	mov    %esi,%eax
+  80234e:	e8 c3 fc ff ff       	call   802016 <stream_fill>
+  802353:	85 c0                	test   %eax,%eax
+  802355:	0f 85 7b ff ff ff    	jne    8022d6 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80235b:	85 ff                	test   %edi,%edi
+  80235d:	74 0f                	je     80236e <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802369:	5b                   	pop    %ebx
+  80236a:	5e                   	pop    %esi
+  80236b:	5f                   	pop    %edi
+  80236c:	5d                   	pop    %ebp
+  80236d:	c3                   	ret
+		return 0;
+  80236e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802373:	eb f1                	jmp    802366 <fgets+0xac>
+
+00802375 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	57                   	push   %edi
+  802379:	56                   	push   %esi
+  80237a:	53                   	push   %ebx
+  80237b:	83 ec 1c             	sub    $0x1c,%esp
+  80237e:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802381:	89 f0                	mov    %esi,%eax
+  802383:	e8 21 fc ff ff       	call   801fa9 <stream_setup>
+	want = size * n;
+  802388:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80238b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80238f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802392:	bf 00 00 00 00       	mov    $0x0,%edi
+  802397:	eb 43                	jmp    8023dc <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802399:	29 d3                	sub    %edx,%ebx
+  80239b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239e:	29 f8                	sub    %edi,%eax
+  8023a0:	39 c3                	cmp    %eax,%ebx
+  8023a2:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8023a5:	83 ec 04             	sub    $0x4,%esp
+  8023a8:	53                   	push   %ebx
+  8023a9:	03 56 0c             	add    0xc(%esi),%edx
+  8023ac:	52                   	push   %edx
+  8023ad:	89 f8                	mov    %edi,%eax
+  8023af:	03 45 08             	add    0x8(%ebp),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	e8 38 e5 ff ff       	call   8008f0 <memmove>
+			f->f_rpos += m;
+  8023b8:	01 5e 14             	add    %ebx,0x14(%esi)
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	eb 1a                	jmp    8023da <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8023c0:	83 ec 04             	sub    $0x4,%esp
+  8023c3:	53                   	push   %ebx
+  8023c4:	89 f8                	mov    %edi,%eax
+  8023c6:	03 45 08             	add    0x8(%ebp),%eax
+  8023c9:	50                   	push   %eax
+  8023ca:	ff 36                	push   (%esi)
+  8023cc:	e8 86 ef ff ff       	call   801357 <read>
+  8023d1:	89 c3                	mov    %eax,%ebx
+  8023d3:	83 c4 10             	add    $0x10,%esp
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	7e 36                	jle    802410 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8023da:	01 df                	add    %ebx,%edi
+  8023dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023df:	39 c7                	cmp    %eax,%edi
+  8023e1:	73 39                	jae    80241c <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8023e3:	8b 56 14             	mov    0x14(%esi),%edx
+  8023e6:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023e9:	39 da                	cmp    %ebx,%edx
+  8023eb:	72 ac                	jb     802399 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8023ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023f0:	29 fb                	sub    %edi,%ebx
+  8023f2:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8023f5:	72 3e                	jb     802435 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8023f7:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8023fb:	74 1f                	je     80241c <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8023fd:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802401:	74 bd                	je     8023c0 <fread+0x4b>
+  802403:	89 f0                	mov    %esi,%eax
+  802405:	e8 2f fb ff ff       	call   801f39 <stream_drain>
+  80240a:	85 c0                	test   %eax,%eax
+  80240c:	79 b2                	jns    8023c0 <fread+0x4b>
+  80240e:	eb 0c                	jmp    80241c <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802410:	c1 fb 1f             	sar    $0x1f,%ebx
+  802413:	83 e3 04             	and    $0x4,%ebx
+  802416:	83 c3 04             	add    $0x4,%ebx
+  802419:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80241c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241f:	85 c0                	test   %eax,%eax
+  802421:	74 0a                	je     80242d <fread+0xb8>
+  802423:	89 f8                	mov    %edi,%eax
+  802425:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242a:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80242d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802430:	5b                   	pop    %ebx
+  802431:	5e                   	pop    %esi
+  802432:	5f                   	pop    %edi
+  802433:	5d                   	pop    %ebp
+  802434:	c3                   	ret
+		} else if (!stream_fill(f))
+  802435:	89 f0                	mov    %esi,%eax
+  802437:	e8 da fb ff ff       	call   802016 <stream_fill>
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	74 dc                	je     80241c <fread+0xa7>
+			m = 0;
+  802440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802445:	eb 93                	jmp    8023da <fread+0x65>
+
+00802447 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	57                   	push   %edi
+  80244b:	56                   	push   %esi
+  80244c:	53                   	push   %ebx
+  80244d:	83 ec 1c             	sub    $0x1c,%esp
+  802450:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802453:	8b 43 04             	mov    0x4(%ebx),%eax
+  802456:	a8 02                	test   $0x2,%al
+  802458:	75 13                	jne    80246d <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80245a:	83 c8 08             	or     $0x8,%eax
+  80245d:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802460:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802468:	5b                   	pop    %ebx
+  802469:	5e                   	pop    %esi
+  80246a:	5f                   	pop    %edi
+  80246b:	5d                   	pop    %ebp
+  80246c:	c3                   	ret
+	stream_setup(f);
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	e8 35 fb ff ff       	call   801fa9 <stream_setup>
+	want = size * n;
+  802474:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802477:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80247b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80247e:	89 d8                	mov    %ebx,%eax
+  802480:	e8 41 fa ff ff       	call   801ec6 <stream_unread>
+	for (done = 0; done < want; ) {
+  802485:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80248a:	84 c0                	test   %al,%al
+  80248c:	75 7b                	jne    802509 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80248e:	be 00 00 00 00       	mov    $0x0,%esi
+  802493:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802496:	39 fe                	cmp    %edi,%esi
+  802498:	73 24                	jae    8024be <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80249a:	83 ec 04             	sub    $0x4,%esp
+  80249d:	89 f8                	mov    %edi,%eax
+  80249f:	29 f0                	sub    %esi,%eax
+  8024a1:	50                   	push   %eax
+  8024a2:	89 f0                	mov    %esi,%eax
+  8024a4:	03 45 08             	add    0x8(%ebp),%eax
+  8024a7:	50                   	push   %eax
+  8024a8:	ff 33                	push   (%ebx)
+  8024aa:	e8 a0 ef ff ff       	call   80144f <write>
+  8024af:	83 c4 10             	add    $0x10,%esp
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	7e 04                	jle    8024ba <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8024b6:	01 c6                	add    %eax,%esi
+  8024b8:	eb dc                	jmp    802496 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8024ba:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8024be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	74 a0                	je     802465 <fwrite+0x1e>
+  8024c5:	89 f0                	mov    %esi,%eax
+  8024c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024cc:	f7 75 0c             	divl   0xc(%ebp)
+  8024cf:	eb 94                	jmp    802465 <fwrite+0x1e>
+			done += r;
+  8024d1:	01 c7                	add    %eax,%edi
+			continue;
+  8024d3:	eb 34                	jmp    802509 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8024d5:	8b 73 10             	mov    0x10(%ebx),%esi
+  8024d8:	29 c6                	sub    %eax,%esi
+  8024da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024dd:	29 fa                	sub    %edi,%edx
+  8024df:	39 d6                	cmp    %edx,%esi
+  8024e1:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8024e4:	83 ec 04             	sub    $0x4,%esp
+  8024e7:	56                   	push   %esi
+  8024e8:	89 fa                	mov    %edi,%edx
+  8024ea:	03 55 08             	add    0x8(%ebp),%edx
+  8024ed:	52                   	push   %edx
+  8024ee:	03 43 0c             	add    0xc(%ebx),%eax
+  8024f1:	50                   	push   %eax
+  8024f2:	e8 f9 e3 ff ff       	call   8008f0 <memmove>
+		f->f_wend += m;
+  8024f7:	89 f0                	mov    %esi,%eax
+  8024f9:	03 43 1c             	add    0x1c(%ebx),%eax
+  8024fc:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8024ff:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802507:	74 5b                	je     802564 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802509:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80250c:	39 c7                	cmp    %eax,%edi
+  80250e:	73 2d                	jae    80253d <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802510:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802513:	85 c0                	test   %eax,%eax
+  802515:	75 be                	jne    8024d5 <fwrite+0x8e>
+  802517:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80251a:	29 fa                	sub    %edi,%edx
+  80251c:	3b 53 10             	cmp    0x10(%ebx),%edx
+  80251f:	72 b4                	jb     8024d5 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	52                   	push   %edx
+  802525:	89 f8                	mov    %edi,%eax
+  802527:	03 45 08             	add    0x8(%ebp),%eax
+  80252a:	50                   	push   %eax
+  80252b:	ff 33                	push   (%ebx)
+  80252d:	e8 1d ef ff ff       	call   80144f <write>
+  802532:	83 c4 10             	add    $0x10,%esp
+  802535:	85 c0                	test   %eax,%eax
+  802537:	7f 98                	jg     8024d1 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802539:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80253d:	8b 43 08             	mov    0x8(%ebx),%eax
+  802540:	83 f8 03             	cmp    $0x3,%eax
+  802543:	74 48                	je     80258d <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802545:	83 f8 02             	cmp    $0x2,%eax
+  802548:	74 27                	je     802571 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80254a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	0f 84 10 ff ff ff    	je     802465 <fwrite+0x1e>
+  802555:	89 f8                	mov    %edi,%eax
+  802557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255c:	f7 75 0c             	divl   0xc(%ebp)
+  80255f:	e9 01 ff ff ff       	jmp    802465 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802564:	89 d8                	mov    %ebx,%eax
+  802566:	e8 ce f9 ff ff       	call   801f39 <stream_drain>
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	79 9a                	jns    802509 <fwrite+0xc2>
+  80256f:	eb cc                	jmp    80253d <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802571:	83 ec 04             	sub    $0x4,%esp
+  802574:	57                   	push   %edi
+  802575:	6a 0a                	push   $0xa
+  802577:	ff 75 08             	push   0x8(%ebp)
+  80257a:	e8 22 e4 ff ff       	call   8009a1 <memfind>
+  80257f:	89 c2                	mov    %eax,%edx
+  802581:	89 f8                	mov    %edi,%eax
+  802583:	03 45 08             	add    0x8(%ebp),%eax
+  802586:	83 c4 10             	add    $0x10,%esp
+  802589:	39 c2                	cmp    %eax,%edx
+  80258b:	74 bd                	je     80254a <fwrite+0x103>
+		stream_drain(f);
+  80258d:	89 d8                	mov    %ebx,%eax
+  80258f:	e8 a5 f9 ff ff       	call   801f39 <stream_drain>
+  802594:	eb b4                	jmp    80254a <fwrite+0x103>
+
+00802596 <fputc>:
+{
+  802596:	55                   	push   %ebp
+  802597:	89 e5                	mov    %esp,%ebp
+  802599:	53                   	push   %ebx
+  80259a:	83 ec 14             	sub    $0x14,%esp
+  80259d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8025a0:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8025a3:	ff 75 0c             	push   0xc(%ebp)
+  8025a6:	6a 01                	push   $0x1
+  8025a8:	6a 01                	push   $0x1
+  8025aa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025ad:	50                   	push   %eax
+  8025ae:	e8 94 fe ff ff       	call   802447 <fwrite>
+  8025b3:	83 c4 10             	add    $0x10,%esp
+  8025b6:	0f b6 db             	movzbl %bl,%ebx
+  8025b9:	83 f8 01             	cmp    $0x1,%eax
+  8025bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025c1:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8025c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025c7:	c9                   	leave
+  8025c8:	c3                   	ret
+
+008025c9 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8025cf:	ff 75 0c             	push   0xc(%ebp)
+  8025d2:	ff 75 08             	push   0x8(%ebp)
+  8025d5:	e8 bc ff ff ff       	call   802596 <fputc>
+}
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+
+008025df <fputs>:
+{
+  8025df:	55                   	push   %ebp
+  8025e0:	89 e5                	mov    %esp,%ebp
+  8025e2:	56                   	push   %esi
+  8025e3:	53                   	push   %ebx
+  8025e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8025e7:	83 ec 0c             	sub    $0xc,%esp
+  8025ea:	56                   	push   %esi
+  8025eb:	e8 3f e1 ff ff       	call   80072f <strlen>
+  8025f0:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8025f2:	ff 75 0c             	push   0xc(%ebp)
+  8025f5:	50                   	push   %eax
+  8025f6:	6a 01                	push   $0x1
+  8025f8:	56                   	push   %esi
+  8025f9:	e8 49 fe ff ff       	call   802447 <fwrite>
+  8025fe:	83 c4 20             	add    $0x20,%esp
+  802601:	39 d8                	cmp    %ebx,%eax
+  802603:	0f 95 c0             	setne  %al
+  802606:	0f b6 c0             	movzbl %al,%eax
+  802609:	f7 d8                	neg    %eax
+}
+  80260b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80260e:	5b                   	pop    %ebx
+  80260f:	5e                   	pop    %esi
+  802610:	5d                   	pop    %ebp
+  802611:	c3                   	ret
+
+00802612 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	53                   	push   %ebx
+  802616:	83 ec 04             	sub    $0x4,%esp
+  802619:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80261c:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  80261f:	50                   	push   %eax
+  802620:	ff 75 0c             	push   0xc(%ebp)
+  802623:	53                   	push   %ebx
+  802624:	68 c9 25 80 00       	push   $0x8025c9
+  802629:	e8 4f dc ff ff       	call   80027d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80262e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802631:	c1 e0 1c             	shl    $0x1c,%eax
+  802634:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802637:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+0080263c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802642:	68 98 4b 80 00       	push   $0x804b98
+  802647:	ff 75 0c             	push   0xc(%ebp)
+  80264a:	e8 1b e1 ff ff       	call   80076a <strcpy>
+	return 0;
+}
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+
+00802656 <devsock_close>:
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	53                   	push   %ebx
+  80265a:	83 ec 10             	sub    $0x10,%esp
+  80265d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802660:	53                   	push   %ebx
+  802661:	e8 69 1d 00 00       	call   8043cf <pageref>
+  802666:	89 c2                	mov    %eax,%edx
+  802668:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80266b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802670:	83 fa 01             	cmp    $0x1,%edx
+  802673:	74 05                	je     80267a <devsock_close+0x24>
+}
+  802675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802678:	c9                   	leave
+  802679:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80267a:	83 ec 0c             	sub    $0xc,%esp
+  80267d:	ff 73 0c             	push   0xc(%ebx)
+  802680:	e8 b7 02 00 00       	call   80293c <nsipc_close>
+  802685:	83 c4 10             	add    $0x10,%esp
+  802688:	eb eb                	jmp    802675 <devsock_close+0x1f>
+
+0080268a <devsock_write>:
+{
+  80268a:	55                   	push   %ebp
+  80268b:	89 e5                	mov    %esp,%ebp
+  80268d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802690:	6a 00                	push   $0x0
+  802692:	ff 75 10             	push   0x10(%ebp)
+  802695:	ff 75 0c             	push   0xc(%ebp)
+  802698:	8b 45 08             	mov    0x8(%ebp),%eax
+  80269b:	ff 70 0c             	push   0xc(%eax)
+  80269e:	e8 79 03 00 00       	call   802a1c <nsipc_send>
+}
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+008026a5 <devsock_read>:
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8026ab:	6a 00                	push   $0x0
+  8026ad:	ff 75 10             	push   0x10(%ebp)
+  8026b0:	ff 75 0c             	push   0xc(%ebp)
+  8026b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b6:	ff 70 0c             	push   0xc(%eax)
+  8026b9:	e8 ef 02 00 00       	call   8029ad <nsipc_recv>
+}
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+008026c0 <fd2sockid>:
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026c9:	52                   	push   %edx
+  8026ca:	50                   	push   %eax
+  8026cb:	e8 f7 e9 ff ff       	call   8010c7 <fd_lookup>
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	78 10                	js     8026e7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026da:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8026e0:	39 08                	cmp    %ecx,(%eax)
+  8026e2:	75 05                	jne    8026e9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026e4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026e7:	c9                   	leave
+  8026e8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026ee:	eb f7                	jmp    8026e7 <fd2sockid+0x27>
+
+008026f0 <alloc_sockfd>:
+{
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	56                   	push   %esi
+  8026f4:	53                   	push   %ebx
+  8026f5:	83 ec 1c             	sub    $0x1c,%esp
+  8026f8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026fd:	50                   	push   %eax
+  8026fe:	e8 6e e9 ff ff       	call   801071 <fd_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 43                	js     80274f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80270c:	83 ec 04             	sub    $0x4,%esp
+  80270f:	68 07 04 00 00       	push   $0x407
+  802714:	ff 75 f4             	push   -0xc(%ebp)
+  802717:	6a 00                	push   $0x0
+  802719:	e8 8a e4 ff ff       	call   800ba8 <sys_page_alloc>
+  80271e:	89 c3                	mov    %eax,%ebx
+  802720:	83 c4 10             	add    $0x10,%esp
+  802723:	85 c0                	test   %eax,%eax
+  802725:	78 28                	js     80274f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80272a:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802730:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802735:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80273c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80273f:	83 ec 0c             	sub    $0xc,%esp
+  802742:	50                   	push   %eax
+  802743:	e8 02 e9 ff ff       	call   80104a <fd2num>
+  802748:	89 c3                	mov    %eax,%ebx
+  80274a:	83 c4 10             	add    $0x10,%esp
+  80274d:	eb 0c                	jmp    80275b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80274f:	83 ec 0c             	sub    $0xc,%esp
+  802752:	56                   	push   %esi
+  802753:	e8 e4 01 00 00       	call   80293c <nsipc_close>
+		return r;
+  802758:	83 c4 10             	add    $0x10,%esp
+}
+  80275b:	89 d8                	mov    %ebx,%eax
+  80275d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5d                   	pop    %ebp
+  802763:	c3                   	ret
+
+00802764 <accept>:
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80276a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276d:	e8 4e ff ff ff       	call   8026c0 <fd2sockid>
+  802772:	85 c0                	test   %eax,%eax
+  802774:	78 1b                	js     802791 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802776:	83 ec 04             	sub    $0x4,%esp
+  802779:	ff 75 10             	push   0x10(%ebp)
+  80277c:	ff 75 0c             	push   0xc(%ebp)
+  80277f:	50                   	push   %eax
+  802780:	e8 0e 01 00 00       	call   802893 <nsipc_accept>
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	78 05                	js     802791 <accept+0x2d>
+	return alloc_sockfd(r);
+  80278c:	e8 5f ff ff ff       	call   8026f0 <alloc_sockfd>
+}
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+00802793 <bind>:
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802799:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279c:	e8 1f ff ff ff       	call   8026c0 <fd2sockid>
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	78 12                	js     8027b7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027a5:	83 ec 04             	sub    $0x4,%esp
+  8027a8:	ff 75 10             	push   0x10(%ebp)
+  8027ab:	ff 75 0c             	push   0xc(%ebp)
+  8027ae:	50                   	push   %eax
+  8027af:	e8 31 01 00 00       	call   8028e5 <nsipc_bind>
+  8027b4:	83 c4 10             	add    $0x10,%esp
+}
+  8027b7:	c9                   	leave
+  8027b8:	c3                   	ret
+
+008027b9 <shutdown>:
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c2:	e8 f9 fe ff ff       	call   8026c0 <fd2sockid>
+  8027c7:	85 c0                	test   %eax,%eax
+  8027c9:	78 0f                	js     8027da <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027cb:	83 ec 08             	sub    $0x8,%esp
+  8027ce:	ff 75 0c             	push   0xc(%ebp)
+  8027d1:	50                   	push   %eax
+  8027d2:	e8 43 01 00 00       	call   80291a <nsipc_shutdown>
+  8027d7:	83 c4 10             	add    $0x10,%esp
+}
+  8027da:	c9                   	leave
+  8027db:	c3                   	ret
+
+008027dc <connect>:
+{
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e5:	e8 d6 fe ff ff       	call   8026c0 <fd2sockid>
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	78 12                	js     802800 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027ee:	83 ec 04             	sub    $0x4,%esp
+  8027f1:	ff 75 10             	push   0x10(%ebp)
+  8027f4:	ff 75 0c             	push   0xc(%ebp)
+  8027f7:	50                   	push   %eax
+  8027f8:	e8 59 01 00 00       	call   802956 <nsipc_connect>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+}
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+00802802 <listen>:
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280b:	e8 b0 fe ff ff       	call   8026c0 <fd2sockid>
+  802810:	85 c0                	test   %eax,%eax
+  802812:	78 0f                	js     802823 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802814:	83 ec 08             	sub    $0x8,%esp
+  802817:	ff 75 0c             	push   0xc(%ebp)
+  80281a:	50                   	push   %eax
+  80281b:	e8 6b 01 00 00       	call   80298b <nsipc_listen>
+  802820:	83 c4 10             	add    $0x10,%esp
+}
+  802823:	c9                   	leave
+  802824:	c3                   	ret
+
+00802825 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802825:	55                   	push   %ebp
+  802826:	89 e5                	mov    %esp,%ebp
+  802828:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80282b:	ff 75 10             	push   0x10(%ebp)
+  80282e:	ff 75 0c             	push   0xc(%ebp)
+  802831:	ff 75 08             	push   0x8(%ebp)
+  802834:	e8 41 02 00 00       	call   802a7a <nsipc_socket>
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	78 05                	js     802845 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802840:	e8 ab fe ff ff       	call   8026f0 <alloc_sockfd>
+}
+  802845:	c9                   	leave
+  802846:	c3                   	ret
+
+00802847 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	53                   	push   %ebx
+  80284b:	83 ec 04             	sub    $0x4,%esp
+  80284e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802850:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802857:	74 26                	je     80287f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802859:	6a 07                	push   $0x7
+  80285b:	68 00 80 80 00       	push   $0x808000
+  802860:	53                   	push   %ebx
+  802861:	ff 35 08 60 80 00    	push   0x806008
+  802867:	e8 ce 1a 00 00       	call   80433a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80286c:	83 c4 0c             	add    $0xc,%esp
+  80286f:	6a 00                	push   $0x0
+  802871:	6a 00                	push   $0x0
+  802873:	6a 00                	push   $0x0
+  802875:	e8 ca 19 00 00       	call   804244 <ipc_recv>
+}
+  80287a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80287f:	83 ec 0c             	sub    $0xc,%esp
+  802882:	6a 02                	push   $0x2
+  802884:	e8 07 1b 00 00       	call   804390 <ipc_find_env>
+  802889:	a3 08 60 80 00       	mov    %eax,0x806008
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	eb c6                	jmp    802859 <nsipc+0x12>
+
+00802893 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	56                   	push   %esi
+  802897:	53                   	push   %ebx
+  802898:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80289b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8028a3:	8b 06                	mov    (%esi),%eax
+  8028a5:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8028aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028af:	e8 93 ff ff ff       	call   802847 <nsipc>
+  8028b4:	89 c3                	mov    %eax,%ebx
+  8028b6:	85 c0                	test   %eax,%eax
+  8028b8:	79 09                	jns    8028c3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028ba:	89 d8                	mov    %ebx,%eax
+  8028bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028bf:	5b                   	pop    %ebx
+  8028c0:	5e                   	pop    %esi
+  8028c1:	5d                   	pop    %ebp
+  8028c2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028c3:	83 ec 04             	sub    $0x4,%esp
+  8028c6:	ff 35 10 80 80 00    	push   0x808010
+  8028cc:	68 00 80 80 00       	push   $0x808000
+  8028d1:	ff 75 0c             	push   0xc(%ebp)
+  8028d4:	e8 17 e0 ff ff       	call   8008f0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028d9:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028de:	89 06                	mov    %eax,(%esi)
+  8028e0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028e3:	eb d5                	jmp    8028ba <nsipc_accept+0x27>
+
+008028e5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028e5:	55                   	push   %ebp
+  8028e6:	89 e5                	mov    %esp,%ebp
+  8028e8:	53                   	push   %ebx
+  8028e9:	83 ec 08             	sub    $0x8,%esp
+  8028ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028f7:	53                   	push   %ebx
+  8028f8:	ff 75 0c             	push   0xc(%ebp)
+  8028fb:	68 04 80 80 00       	push   $0x808004
+  802900:	e8 eb df ff ff       	call   8008f0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802905:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80290b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802910:	e8 32 ff ff ff       	call   802847 <nsipc>
+}
+  802915:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802918:	c9                   	leave
+  802919:	c3                   	ret
+
+0080291a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802920:	8b 45 08             	mov    0x8(%ebp),%eax
+  802923:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802928:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802930:	b8 03 00 00 00       	mov    $0x3,%eax
+  802935:	e8 0d ff ff ff       	call   802847 <nsipc>
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+0080293c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+  80293f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802942:	8b 45 08             	mov    0x8(%ebp),%eax
+  802945:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80294a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80294f:	e8 f3 fe ff ff       	call   802847 <nsipc>
+}
+  802954:	c9                   	leave
+  802955:	c3                   	ret
+
+00802956 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802956:	55                   	push   %ebp
+  802957:	89 e5                	mov    %esp,%ebp
+  802959:	53                   	push   %ebx
+  80295a:	83 ec 08             	sub    $0x8,%esp
+  80295d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802960:	8b 45 08             	mov    0x8(%ebp),%eax
+  802963:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802968:	53                   	push   %ebx
+  802969:	ff 75 0c             	push   0xc(%ebp)
+  80296c:	68 04 80 80 00       	push   $0x808004
+  802971:	e8 7a df ff ff       	call   8008f0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802976:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80297c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802981:	e8 c1 fe ff ff       	call   802847 <nsipc>
+}
+  802986:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802989:	c9                   	leave
+  80298a:	c3                   	ret
+
+0080298b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80298b:	55                   	push   %ebp
+  80298c:	89 e5                	mov    %esp,%ebp
+  80298e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802991:	8b 45 08             	mov    0x8(%ebp),%eax
+  802994:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802999:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80299c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8029a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029a6:	e8 9c fe ff ff       	call   802847 <nsipc>
+}
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+
+008029ad <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029bd:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8029c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029c6:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029d0:	e8 72 fe ff ff       	call   802847 <nsipc>
+  8029d5:	89 c3                	mov    %eax,%ebx
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	78 22                	js     8029fd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029db:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029e0:	39 c6                	cmp    %eax,%esi
+  8029e2:	0f 4e c6             	cmovle %esi,%eax
+  8029e5:	39 c3                	cmp    %eax,%ebx
+  8029e7:	7f 1d                	jg     802a06 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029e9:	83 ec 04             	sub    $0x4,%esp
+  8029ec:	53                   	push   %ebx
+  8029ed:	68 00 80 80 00       	push   $0x808000
+  8029f2:	ff 75 0c             	push   0xc(%ebp)
+  8029f5:	e8 f6 de ff ff       	call   8008f0 <memmove>
+  8029fa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029fd:	89 d8                	mov    %ebx,%eax
+  8029ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5d                   	pop    %ebp
+  802a05:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a06:	68 a4 4b 80 00       	push   $0x804ba4
+  802a0b:	68 5d 4b 80 00       	push   $0x804b5d
+  802a10:	6a 62                	push   $0x62
+  802a12:	68 b9 4b 80 00       	push   $0x804bb9
+  802a17:	e8 6c 11 00 00       	call   803b88 <_panic>
+
+00802a1c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	53                   	push   %ebx
+  802a20:	83 ec 04             	sub    $0x4,%esp
+  802a23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a29:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a2e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a34:	7f 2e                	jg     802a64 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a36:	83 ec 04             	sub    $0x4,%esp
+  802a39:	53                   	push   %ebx
+  802a3a:	ff 75 0c             	push   0xc(%ebp)
+  802a3d:	68 0c 80 80 00       	push   $0x80800c
+  802a42:	e8 a9 de ff ff       	call   8008f0 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a47:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a50:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a55:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a5a:	e8 e8 fd ff ff       	call   802847 <nsipc>
+}
+  802a5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a62:	c9                   	leave
+  802a63:	c3                   	ret
+	assert(size < 1600);
+  802a64:	68 c5 4b 80 00       	push   $0x804bc5
+  802a69:	68 5d 4b 80 00       	push   $0x804b5d
+  802a6e:	6a 6d                	push   $0x6d
+  802a70:	68 b9 4b 80 00       	push   $0x804bb9
+  802a75:	e8 0e 11 00 00       	call   803b88 <_panic>
+
+00802a7a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a7a:	55                   	push   %ebp
+  802a7b:	89 e5                	mov    %esp,%ebp
+  802a7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a83:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a8b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a90:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a93:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a98:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a9d:	e8 a5 fd ff ff       	call   802847 <nsipc>
+}
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+
+00802aa4 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	53                   	push   %ebx
+  802aa8:	83 ec 10             	sub    $0x10,%esp
+  802aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802aae:	68 0c 60 80 00       	push   $0x80600c
+  802ab3:	e8 50 07 00 00       	call   803208 <mutex_lock>
+	if (v == 0)
+  802ab8:	83 c4 10             	add    $0x10,%esp
+  802abb:	85 db                	test   %ebx,%ebx
+  802abd:	0f 84 85 00 00 00    	je     802b48 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802ac3:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802ac9:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802ace:	77 51                	ja     802b21 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802ad0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802ad6:	89 d8                	mov    %ebx,%eax
+  802ad8:	c1 e8 0c             	shr    $0xc,%eax
+  802adb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ae2:	f6 c4 02             	test   $0x2,%ah
+  802ae5:	74 50                	je     802b37 <free+0x93>
+		sys_page_unmap(0, c);
+  802ae7:	83 ec 08             	sub    $0x8,%esp
+  802aea:	53                   	push   %ebx
+  802aeb:	6a 00                	push   $0x0
+  802aed:	e8 4f e1 ff ff       	call   800c41 <sys_page_unmap>
+		c += PGSIZE;
+  802af2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802af8:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802afe:	83 c4 10             	add    $0x10,%esp
+  802b01:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b06:	76 ce                	jbe    802ad6 <free+0x32>
+  802b08:	68 0f 4c 80 00       	push   $0x804c0f
+  802b0d:	68 5d 4b 80 00       	push   $0x804b5d
+  802b12:	68 82 00 00 00       	push   $0x82
+  802b17:	68 02 4c 80 00       	push   $0x804c02
+  802b1c:	e8 67 10 00 00       	call   803b88 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b21:	68 d4 4b 80 00       	push   $0x804bd4
+  802b26:	68 5d 4b 80 00       	push   $0x804b5d
+  802b2b:	6a 7b                	push   $0x7b
+  802b2d:	68 02 4c 80 00       	push   $0x804c02
+  802b32:	e8 51 10 00 00       	call   803b88 <_panic>
+	if (--(*ref) == 0)
+  802b37:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802b3d:	83 e8 01             	sub    $0x1,%eax
+  802b40:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802b46:	74 15                	je     802b5d <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802b48:	83 ec 0c             	sub    $0xc,%esp
+  802b4b:	68 0c 60 80 00       	push   $0x80600c
+  802b50:	e8 20 07 00 00       	call   803275 <mutex_unlock>
+}
+  802b55:	83 c4 10             	add    $0x10,%esp
+  802b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+		sys_page_unmap(0, c);
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+  802b60:	53                   	push   %ebx
+  802b61:	6a 00                	push   $0x0
+  802b63:	e8 d9 e0 ff ff       	call   800c41 <sys_page_unmap>
+  802b68:	83 c4 10             	add    $0x10,%esp
+  802b6b:	eb db                	jmp    802b48 <free+0xa4>
+
+00802b6d <malloc>:
+{
+  802b6d:	55                   	push   %ebp
+  802b6e:	89 e5                	mov    %esp,%ebp
+  802b70:	57                   	push   %edi
+  802b71:	56                   	push   %esi
+  802b72:	53                   	push   %ebx
+  802b73:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802b76:	68 0c 60 80 00       	push   $0x80600c
+  802b7b:	e8 88 06 00 00       	call   803208 <mutex_lock>
+	if (mptr == 0)
+  802b80:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802b86:	83 c4 10             	add    $0x10,%esp
+  802b89:	85 ff                	test   %edi,%edi
+  802b8b:	74 6c                	je     802bf9 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b90:	83 c0 03             	add    $0x3,%eax
+  802b93:	83 e0 fc             	and    $0xfffffffc,%eax
+  802b96:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802b98:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802b9d:	0f 87 64 01 00 00    	ja     802d07 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802ba3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802ba9:	74 30                	je     802bdb <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802bab:	89 f9                	mov    %edi,%ecx
+  802bad:	c1 e9 0c             	shr    $0xc,%ecx
+  802bb0:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802bb4:	c1 e8 0c             	shr    $0xc,%eax
+  802bb7:	39 c1                	cmp    %eax,%ecx
+  802bb9:	74 5f                	je     802c1a <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802bbb:	83 ec 0c             	sub    $0xc,%esp
+  802bbe:	57                   	push   %edi
+  802bbf:	e8 e0 fe ff ff       	call   802aa4 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802bc4:	a1 10 60 80 00       	mov    0x806010,%eax
+  802bc9:	05 00 10 00 00       	add    $0x1000,%eax
+  802bce:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802bd3:	a3 10 60 80 00       	mov    %eax,0x806010
+  802bd8:	83 c4 10             	add    $0x10,%esp
+  802bdb:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802be1:	ba 02 00 00 00       	mov    $0x2,%edx
+  802be6:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802bea:	8d 7e 04             	lea    0x4(%esi),%edi
+  802bed:	89 cb                	mov    %ecx,%ebx
+  802bef:	01 f9                	add    %edi,%ecx
+  802bf1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802bf4:	e9 8b 00 00 00       	jmp    802c84 <malloc+0x117>
+		mptr = mbegin;
+  802bf9:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802c00:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c06:	83 c0 03             	add    $0x3,%eax
+  802c09:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c0c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c0e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c13:	76 c6                	jbe    802bdb <malloc+0x6e>
+  802c15:	e9 d6 00 00 00       	jmp    802cf0 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802c1a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802c25:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802c29:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802c2c:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802c31:	e9 ba 00 00 00       	jmp    802cf0 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c36:	05 00 10 00 00       	add    $0x1000,%eax
+  802c3b:	39 c8                	cmp    %ecx,%eax
+  802c3d:	0f 83 cb 00 00 00    	jae    802d0e <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802c43:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802c48:	77 22                	ja     802c6c <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802c4a:	89 c2                	mov    %eax,%edx
+  802c4c:	c1 ea 16             	shr    $0x16,%edx
+  802c4f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802c56:	f6 c2 01             	test   $0x1,%dl
+  802c59:	74 db                	je     802c36 <malloc+0xc9>
+  802c5b:	89 c2                	mov    %eax,%edx
+  802c5d:	c1 ea 0c             	shr    $0xc,%edx
+  802c60:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802c67:	f6 c2 01             	test   $0x1,%dl
+  802c6a:	74 ca                	je     802c36 <malloc+0xc9>
+		if (mptr == mend) {
+  802c6c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c72:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802c78:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802c7c:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802c82:	74 04                	je     802c88 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c84:	89 d8                	mov    %ebx,%eax
+  802c86:	eb b3                	jmp    802c3b <malloc+0xce>
+  802c88:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802c8b:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802c90:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802c94:	83 ea 01             	sub    $0x1,%edx
+  802c97:	0f 85 50 ff ff ff    	jne    802bed <malloc+0x80>
+  802c9d:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802ca4:	00 00 08 
+				return 0;	/* out of address space */
+  802ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cac:	eb 42                	jmp    802cf0 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802cae:	85 db                	test   %ebx,%ebx
+  802cb0:	78 1e                	js     802cd0 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802cb2:	83 ec 08             	sub    $0x8,%esp
+  802cb5:	89 d8                	mov    %ebx,%eax
+  802cb7:	03 05 10 60 80 00    	add    0x806010,%eax
+  802cbd:	50                   	push   %eax
+  802cbe:	6a 00                	push   $0x0
+  802cc0:	e8 7c df ff ff       	call   800c41 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802cc5:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ccb:	83 c4 10             	add    $0x10,%esp
+  802cce:	eb de                	jmp    802cae <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802cd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd5:	eb 19                	jmp    802cf0 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802cd7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802cda:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802ce0:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802ce7:	00 
+	mptr += n;
+  802ce8:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802ceb:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802cf0:	83 ec 0c             	sub    $0xc,%esp
+  802cf3:	68 0c 60 80 00       	push   $0x80600c
+  802cf8:	e8 78 05 00 00       	call   803275 <mutex_unlock>
+}
+  802cfd:	89 f8                	mov    %edi,%eax
+  802cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d02:	5b                   	pop    %ebx
+  802d03:	5e                   	pop    %esi
+  802d04:	5f                   	pop    %edi
+  802d05:	5d                   	pop    %ebp
+  802d06:	c3                   	ret
+		return 0;
+  802d07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0c:	eb e2                	jmp    802cf0 <malloc+0x183>
+  802d0e:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802d12:	74 06                	je     802d1a <malloc+0x1ad>
+  802d14:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d22:	39 fb                	cmp    %edi,%ebx
+  802d24:	73 b1                	jae    802cd7 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d26:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d2c:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d2f:	39 fe                	cmp    %edi,%esi
+  802d31:	0f 92 c0             	setb   %al
+  802d34:	0f b6 c0             	movzbl %al,%eax
+  802d37:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d3a:	83 c8 07             	or     $0x7,%eax
+  802d3d:	50                   	push   %eax
+  802d3e:	89 d8                	mov    %ebx,%eax
+  802d40:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d46:	50                   	push   %eax
+  802d47:	6a 00                	push   $0x0
+  802d49:	e8 5a de ff ff       	call   800ba8 <sys_page_alloc>
+  802d4e:	83 c4 10             	add    $0x10,%esp
+  802d51:	85 c0                	test   %eax,%eax
+  802d53:	0f 88 55 ff ff ff    	js     802cae <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d59:	89 f3                	mov    %esi,%ebx
+  802d5b:	eb c5                	jmp    802d22 <malloc+0x1b5>
+
+00802d5d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	56                   	push   %esi
+  802d61:	53                   	push   %ebx
+  802d62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d65:	83 ec 0c             	sub    $0xc,%esp
+  802d68:	ff 75 08             	push   0x8(%ebp)
+  802d6b:	e8 ea e2 ff ff       	call   80105a <fd2data>
+  802d70:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d72:	83 c4 08             	add    $0x8,%esp
+  802d75:	68 27 4c 80 00       	push   $0x804c27
+  802d7a:	53                   	push   %ebx
+  802d7b:	e8 ea d9 ff ff       	call   80076a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d80:	8b 46 04             	mov    0x4(%esi),%eax
+  802d83:	2b 06                	sub    (%esi),%eax
+  802d85:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d8b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d92:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d95:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802d9c:	52 80 00 
+	return 0;
+}
+  802d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802da7:	5b                   	pop    %ebx
+  802da8:	5e                   	pop    %esi
+  802da9:	5d                   	pop    %ebp
+  802daa:	c3                   	ret
+
+00802dab <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802dab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db0:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802db4:	85 c9                	test   %ecx,%ecx
+  802db6:	75 01                	jne    802db9 <pipewake+0xe>
+  802db8:	c3                   	ret
+{
+  802db9:	55                   	push   %ebp
+  802dba:	89 e5                	mov    %esp,%ebp
+  802dbc:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802dbf:	68 00 04 00 00       	push   $0x400
+  802dc4:	52                   	push   %edx
+  802dc5:	e8 22 e1 ff ff       	call   800eec <sys_futex_wake>
+  802dca:	83 c4 10             	add    $0x10,%esp
+}
+  802dcd:	c9                   	leave
+  802dce:	c3                   	ret
+
+00802dcf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802dcf:	55                   	push   %ebp
+  802dd0:	89 e5                	mov    %esp,%ebp
+  802dd2:	56                   	push   %esi
+  802dd3:	53                   	push   %ebx
+  802dd4:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802dd7:	83 ec 0c             	sub    $0xc,%esp
+  802dda:	56                   	push   %esi
+  802ddb:	e8 7a e2 ff ff       	call   80105a <fd2data>
+  802de0:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802de2:	83 c4 08             	add    $0x8,%esp
+  802de5:	56                   	push   %esi
+  802de6:	6a 00                	push   $0x0
+  802de8:	e8 54 de ff ff       	call   800c41 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802ded:	8d 53 04             	lea    0x4(%ebx),%edx
+  802df0:	8d 43 08             	lea    0x8(%ebx),%eax
+  802df3:	e8 b3 ff ff ff       	call   802dab <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802df8:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802dfb:	89 da                	mov    %ebx,%edx
+  802dfd:	e8 a9 ff ff ff       	call   802dab <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802e02:	89 34 24             	mov    %esi,(%esp)
+  802e05:	e8 50 e2 ff ff       	call   80105a <fd2data>
+  802e0a:	83 c4 08             	add    $0x8,%esp
+  802e0d:	50                   	push   %eax
+  802e0e:	6a 00                	push   $0x0
+  802e10:	e8 2c de ff ff       	call   800c41 <sys_page_unmap>
+}
+  802e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e18:	5b                   	pop    %ebx
+  802e19:	5e                   	pop    %esi
+  802e1a:	5d                   	pop    %ebp
+  802e1b:	c3                   	ret
+
+00802e1c <_pipeisclosed>:
+{
+  802e1c:	55                   	push   %ebp
+  802e1d:	89 e5                	mov    %esp,%ebp
+  802e1f:	57                   	push   %edi
+  802e20:	56                   	push   %esi
+  802e21:	53                   	push   %ebx
+  802e22:	83 ec 1c             	sub    $0x1c,%esp
+  802e25:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e28:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e2a:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802e2f:	eb 5d                	jmp    802e8e <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802e31:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802e37:	8b 02                	mov    (%edx),%eax
+  802e39:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e3c:	83 ec 0c             	sub    $0xc,%esp
+  802e3f:	ff 75 e0             	push   -0x20(%ebp)
+  802e42:	e8 88 15 00 00       	call   8043cf <pageref>
+  802e47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e4a:	89 3c 24             	mov    %edi,(%esp)
+  802e4d:	e8 7d 15 00 00       	call   8043cf <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802e52:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e54:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802e63:	77 15                	ja     802e7a <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e65:	89 f2                	mov    %esi,%edx
+  802e67:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802e69:	c1 ea 10             	shr    $0x10,%edx
+  802e6c:	74 0c                	je     802e7a <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e6e:	c1 e2 10             	shl    $0x10,%edx
+  802e71:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802e76:	29 d1                	sub    %edx,%ecx
+  802e78:	eb 06                	jmp    802e80 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802e7a:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802e80:	8b 11                	mov    (%ecx),%edx
+  802e82:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802e85:	39 d3                	cmp    %edx,%ebx
+  802e87:	74 6e                	je     802ef7 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802e89:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e8c:	74 24                	je     802eb2 <_pipeisclosed+0x96>
+  802e8e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e90:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802e96:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e9b:	77 94                	ja     802e31 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e9d:	89 f0                	mov    %esi,%eax
+  802e9f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ea1:	c1 e8 10             	shr    $0x10,%eax
+  802ea4:	74 8b                	je     802e31 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ea6:	c1 e0 10             	shl    $0x10,%eax
+  802ea9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802eae:	29 c2                	sub    %eax,%edx
+  802eb0:	eb 85                	jmp    802e37 <_pipeisclosed+0x1b>
+  802eb2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802eb4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802eba:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ebf:	77 18                	ja     802ed9 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ec1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ec6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ec8:	c1 e8 10             	shr    $0x10,%eax
+  802ecb:	74 0c                	je     802ed9 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ecd:	c1 e0 10             	shl    $0x10,%eax
+  802ed0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ed5:	29 c2                	sub    %eax,%edx
+  802ed7:	eb 06                	jmp    802edf <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802ed9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802edf:	8b 02                	mov    (%edx),%eax
+  802ee1:	8b 40 58             	mov    0x58(%eax),%eax
+  802ee4:	6a 01                	push   $0x1
+  802ee6:	50                   	push   %eax
+  802ee7:	53                   	push   %ebx
+  802ee8:	68 2e 4c 80 00       	push   $0x804c2e
+  802eed:	e8 94 d2 ff ff       	call   800186 <cprintf>
+  802ef2:	83 c4 10             	add    $0x10,%esp
+  802ef5:	eb 97                	jmp    802e8e <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802ef7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802efa:	0f 94 c0             	sete   %al
+  802efd:	0f b6 c0             	movzbl %al,%eax
+}
+  802f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f03:	5b                   	pop    %ebx
+  802f04:	5e                   	pop    %esi
+  802f05:	5f                   	pop    %edi
+  802f06:	5d                   	pop    %ebp
+  802f07:	c3                   	ret
+
+00802f08 <devpipe_write>:
+{
+  802f08:	55                   	push   %ebp
+  802f09:	89 e5                	mov    %esp,%ebp
+  802f0b:	57                   	push   %edi
+  802f0c:	56                   	push   %esi
+  802f0d:	53                   	push   %ebx
+  802f0e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f11:	ff 75 08             	push   0x8(%ebp)
+  802f14:	e8 41 e1 ff ff       	call   80105a <fd2data>
+  802f19:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f1b:	83 c4 10             	add    $0x10,%esp
+  802f1e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f25:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802f28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f2b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f2e:	0f 84 96 00 00 00    	je     802fca <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f34:	8d 73 08             	lea    0x8(%ebx),%esi
+  802f37:	eb 32                	jmp    802f6b <devpipe_write+0x63>
+  802f39:	89 fa                	mov    %edi,%edx
+  802f3b:	89 f0                	mov    %esi,%eax
+  802f3d:	e8 69 fe ff ff       	call   802dab <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802f42:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f45:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802f48:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f4d:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802f52:	83 ec 04             	sub    $0x4,%esp
+  802f55:	6a 0a                	push   $0xa
+  802f57:	50                   	push   %eax
+  802f58:	53                   	push   %ebx
+  802f59:	e8 5f df ff ff       	call   800ebd <sys_futex_wait>
+  802f5e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f63:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802f68:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f6b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f6e:	8b 0b                	mov    (%ebx),%ecx
+  802f70:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f73:	39 d0                	cmp    %edx,%eax
+  802f75:	72 1b                	jb     802f92 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  802f77:	89 da                	mov    %ebx,%edx
+  802f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7c:	e8 9b fe ff ff       	call   802e1c <_pipeisclosed>
+  802f81:	85 c0                	test   %eax,%eax
+  802f83:	74 b4                	je     802f39 <devpipe_write+0x31>
+				return 0;
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8d:	5b                   	pop    %ebx
+  802f8e:	5e                   	pop    %esi
+  802f8f:	5f                   	pop    %edi
+  802f90:	5d                   	pop    %ebp
+  802f91:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f95:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f98:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  802f9c:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  802f9f:	89 c2                	mov    %eax,%edx
+  802fa1:	c1 fa 1f             	sar    $0x1f,%edx
+  802fa4:	89 d1                	mov    %edx,%ecx
+  802fa6:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fa9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fac:	83 e2 1f             	and    $0x1f,%edx
+  802faf:	29 ca                	sub    %ecx,%edx
+  802fb1:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802fb5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802fb9:	83 c0 01             	add    $0x1,%eax
+  802fbc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802fbf:	83 c6 01             	add    $0x1,%esi
+  802fc2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802fc5:	e9 5e ff ff ff       	jmp    802f28 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802fca:	8d 53 04             	lea    0x4(%ebx),%edx
+  802fcd:	8d 43 08             	lea    0x8(%ebx),%eax
+  802fd0:	e8 d6 fd ff ff       	call   802dab <pipewake>
+	return i;
+  802fd5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fd8:	eb b0                	jmp    802f8a <devpipe_write+0x82>
+
+00802fda <devpipe_read>:
+{
+  802fda:	55                   	push   %ebp
+  802fdb:	89 e5                	mov    %esp,%ebp
+  802fdd:	57                   	push   %edi
+  802fde:	56                   	push   %esi
+  802fdf:	53                   	push   %ebx
+  802fe0:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802fe3:	ff 75 08             	push   0x8(%ebp)
+  802fe6:	e8 6f e0 ff ff       	call   80105a <fd2data>
+  802feb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fed:	83 c4 10             	add    $0x10,%esp
+  802ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ff8:	74 6c                	je     803066 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802ffa:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802ffd:	eb 25                	jmp    803024 <devpipe_read+0x4a>
+  802fff:	8b 13                	mov    (%ebx),%edx
+  803001:	b8 01 00 00 00       	mov    $0x1,%eax
+  803006:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80300b:	83 ec 04             	sub    $0x4,%esp
+  80300e:	6a 0a                	push   $0xa
+  803010:	52                   	push   %edx
+  803011:	57                   	push   %edi
+  803012:	e8 a6 de ff ff       	call   800ebd <sys_futex_wait>
+  803017:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80301c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803021:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803024:	8b 03                	mov    (%ebx),%eax
+  803026:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803029:	75 19                	jne    803044 <devpipe_read+0x6a>
+			if (i > 0)
+  80302b:	85 f6                	test   %esi,%esi
+  80302d:	75 3a                	jne    803069 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80302f:	89 da                	mov    %ebx,%edx
+  803031:	8b 45 08             	mov    0x8(%ebp),%eax
+  803034:	e8 e3 fd ff ff       	call   802e1c <_pipeisclosed>
+  803039:	85 c0                	test   %eax,%eax
+  80303b:	74 c2                	je     802fff <devpipe_read+0x25>
+				return 0;
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803042:	eb 31                	jmp    803075 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803044:	89 c1                	mov    %eax,%ecx
+  803046:	c1 f9 1f             	sar    $0x1f,%ecx
+  803049:	c1 e9 1b             	shr    $0x1b,%ecx
+  80304c:	01 c8                	add    %ecx,%eax
+  80304e:	83 e0 1f             	and    $0x1f,%eax
+  803051:	29 c8                	sub    %ecx,%eax
+  803053:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803058:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80305b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80305e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803061:	83 c6 01             	add    $0x1,%esi
+  803064:	eb 8f                	jmp    802ff5 <devpipe_read+0x1b>
+out:
+  803066:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803069:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80306c:	89 da                	mov    %ebx,%edx
+  80306e:	e8 38 fd ff ff       	call   802dab <pipewake>
+	return i;
+  803073:	89 f0                	mov    %esi,%eax
+}
+  803075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803078:	5b                   	pop    %ebx
+  803079:	5e                   	pop    %esi
+  80307a:	5f                   	pop    %edi
+  80307b:	5d                   	pop    %ebp
+  80307c:	c3                   	ret
+
+0080307d <pipe>:
+{
+  80307d:	55                   	push   %ebp
+  80307e:	89 e5                	mov    %esp,%ebp
+  803080:	56                   	push   %esi
+  803081:	53                   	push   %ebx
+  803082:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803085:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803088:	50                   	push   %eax
+  803089:	e8 e3 df ff ff       	call   801071 <fd_alloc>
+  80308e:	89 c3                	mov    %eax,%ebx
+  803090:	83 c4 10             	add    $0x10,%esp
+  803093:	85 c0                	test   %eax,%eax
+  803095:	0f 88 23 01 00 00    	js     8031be <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80309b:	83 ec 04             	sub    $0x4,%esp
+  80309e:	68 07 04 00 00       	push   $0x407
+  8030a3:	ff 75 f4             	push   -0xc(%ebp)
+  8030a6:	6a 00                	push   $0x0
+  8030a8:	e8 fb da ff ff       	call   800ba8 <sys_page_alloc>
+  8030ad:	89 c3                	mov    %eax,%ebx
+  8030af:	83 c4 10             	add    $0x10,%esp
+  8030b2:	85 c0                	test   %eax,%eax
+  8030b4:	0f 88 04 01 00 00    	js     8031be <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030ba:	83 ec 0c             	sub    $0xc,%esp
+  8030bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030c0:	50                   	push   %eax
+  8030c1:	e8 ab df ff ff       	call   801071 <fd_alloc>
+  8030c6:	89 c3                	mov    %eax,%ebx
+  8030c8:	83 c4 10             	add    $0x10,%esp
+  8030cb:	85 c0                	test   %eax,%eax
+  8030cd:	0f 88 db 00 00 00    	js     8031ae <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030d3:	83 ec 04             	sub    $0x4,%esp
+  8030d6:	68 07 04 00 00       	push   $0x407
+  8030db:	ff 75 f0             	push   -0x10(%ebp)
+  8030de:	6a 00                	push   $0x0
+  8030e0:	e8 c3 da ff ff       	call   800ba8 <sys_page_alloc>
+  8030e5:	89 c3                	mov    %eax,%ebx
+  8030e7:	83 c4 10             	add    $0x10,%esp
+  8030ea:	85 c0                	test   %eax,%eax
+  8030ec:	0f 88 bc 00 00 00    	js     8031ae <pipe+0x131>
+	va = fd2data(fd0);
+  8030f2:	83 ec 0c             	sub    $0xc,%esp
+  8030f5:	ff 75 f4             	push   -0xc(%ebp)
+  8030f8:	e8 5d df ff ff       	call   80105a <fd2data>
+  8030fd:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ff:	83 c4 0c             	add    $0xc,%esp
+  803102:	68 07 04 00 00       	push   $0x407
+  803107:	50                   	push   %eax
+  803108:	6a 00                	push   $0x0
+  80310a:	e8 99 da ff ff       	call   800ba8 <sys_page_alloc>
+  80310f:	89 c3                	mov    %eax,%ebx
+  803111:	83 c4 10             	add    $0x10,%esp
+  803114:	85 c0                	test   %eax,%eax
+  803116:	0f 88 82 00 00 00    	js     80319e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80311c:	83 ec 0c             	sub    $0xc,%esp
+  80311f:	ff 75 f0             	push   -0x10(%ebp)
+  803122:	e8 33 df ff ff       	call   80105a <fd2data>
+  803127:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80312e:	50                   	push   %eax
+  80312f:	6a 00                	push   $0x0
+  803131:	56                   	push   %esi
+  803132:	6a 00                	push   $0x0
+  803134:	e8 bc da ff ff       	call   800bf5 <sys_page_map>
+  803139:	89 c3                	mov    %eax,%ebx
+  80313b:	83 c4 20             	add    $0x20,%esp
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	78 4e                	js     803190 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803142:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803147:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80314a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80314c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80314f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803156:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803159:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80315b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80315e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803165:	83 ec 0c             	sub    $0xc,%esp
+  803168:	ff 75 f4             	push   -0xc(%ebp)
+  80316b:	e8 da de ff ff       	call   80104a <fd2num>
+  803170:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803173:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803175:	83 c4 04             	add    $0x4,%esp
+  803178:	ff 75 f0             	push   -0x10(%ebp)
+  80317b:	e8 ca de ff ff       	call   80104a <fd2num>
+  803180:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803183:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803186:	83 c4 10             	add    $0x10,%esp
+  803189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80318e:	eb 2e                	jmp    8031be <pipe+0x141>
+	sys_page_unmap(0, va);
+  803190:	83 ec 08             	sub    $0x8,%esp
+  803193:	56                   	push   %esi
+  803194:	6a 00                	push   $0x0
+  803196:	e8 a6 da ff ff       	call   800c41 <sys_page_unmap>
+  80319b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80319e:	83 ec 08             	sub    $0x8,%esp
+  8031a1:	ff 75 f0             	push   -0x10(%ebp)
+  8031a4:	6a 00                	push   $0x0
+  8031a6:	e8 96 da ff ff       	call   800c41 <sys_page_unmap>
+  8031ab:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031ae:	83 ec 08             	sub    $0x8,%esp
+  8031b1:	ff 75 f4             	push   -0xc(%ebp)
+  8031b4:	6a 00                	push   $0x0
+  8031b6:	e8 86 da ff ff       	call   800c41 <sys_page_unmap>
+  8031bb:	83 c4 10             	add    $0x10,%esp
+}
+  8031be:	89 d8                	mov    %ebx,%eax
+  8031c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031c3:	5b                   	pop    %ebx
+  8031c4:	5e                   	pop    %esi
+  8031c5:	5d                   	pop    %ebp
+  8031c6:	c3                   	ret
+
+008031c7 <pipeisclosed>:
+{
+  8031c7:	55                   	push   %ebp
+  8031c8:	89 e5                	mov    %esp,%ebp
+  8031ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d0:	50                   	push   %eax
+  8031d1:	ff 75 08             	push   0x8(%ebp)
+  8031d4:	e8 ee de ff ff       	call   8010c7 <fd_lookup>
+  8031d9:	83 c4 10             	add    $0x10,%esp
+  8031dc:	85 c0                	test   %eax,%eax
+  8031de:	78 18                	js     8031f8 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031e0:	83 ec 0c             	sub    $0xc,%esp
+  8031e3:	ff 75 f4             	push   -0xc(%ebp)
+  8031e6:	e8 6f de ff ff       	call   80105a <fd2data>
+  8031eb:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f0:	e8 27 fc ff ff       	call   802e1c <_pipeisclosed>
+  8031f5:	83 c4 10             	add    $0x10,%esp
+}
+  8031f8:	c9                   	leave
+  8031f9:	c3                   	ret
+
+008031fa <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8031fa:	55                   	push   %ebp
+  8031fb:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8031fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803200:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803206:	5d                   	pop    %ebp
+  803207:	c3                   	ret
+
+00803208 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803208:	55                   	push   %ebp
+  803209:	89 e5                	mov    %esp,%ebp
+  80320b:	56                   	push   %esi
+  80320c:	53                   	push   %ebx
+  80320d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803210:	ba 00 00 00 00       	mov    $0x0,%edx
+  803215:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80321a:	89 d0                	mov    %edx,%eax
+  80321c:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803220:	85 c0                	test   %eax,%eax
+  803222:	74 2d                	je     803251 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803224:	83 f8 02             	cmp    $0x2,%eax
+  803227:	74 08                	je     803231 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803229:	b8 02 00 00 00       	mov    $0x2,%eax
+  80322e:	f0 87 03             	lock xchg %eax,(%ebx)
+  803231:	be 02 00 00 00       	mov    $0x2,%esi
+  803236:	eb 15                	jmp    80324d <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803238:	83 ec 04             	sub    $0x4,%esp
+  80323b:	6a 00                	push   $0x0
+  80323d:	6a 02                	push   $0x2
+  80323f:	53                   	push   %ebx
+  803240:	e8 78 dc ff ff       	call   800ebd <sys_futex_wait>
+  803245:	89 f0                	mov    %esi,%eax
+  803247:	f0 87 03             	lock xchg %eax,(%ebx)
+  80324a:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80324d:	85 c0                	test   %eax,%eax
+  80324f:	75 e7                	jne    803238 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803251:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803254:	5b                   	pop    %ebx
+  803255:	5e                   	pop    %esi
+  803256:	5d                   	pop    %ebp
+  803257:	c3                   	ret
+
+00803258 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80325e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803263:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803268:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80326c:	f7 d8                	neg    %eax
+  80326e:	19 c0                	sbb    %eax,%eax
+  803270:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803273:	5d                   	pop    %ebp
+  803274:	c3                   	ret
+
+00803275 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803275:	55                   	push   %ebp
+  803276:	89 e5                	mov    %esp,%ebp
+  803278:	83 ec 08             	sub    $0x8,%esp
+  80327b:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80327e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803283:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803286:	83 f8 02             	cmp    $0x2,%eax
+  803289:	74 02                	je     80328d <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80328d:	83 ec 08             	sub    $0x8,%esp
+  803290:	6a 01                	push   $0x1
+  803292:	52                   	push   %edx
+  803293:	e8 54 dc ff ff       	call   800eec <sys_futex_wake>
+  803298:	83 c4 10             	add    $0x10,%esp
+}
+  80329b:	eb ee                	jmp    80328b <mutex_unlock+0x16>
+
+0080329d <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8032a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032a9:	5d                   	pop    %ebp
+  8032aa:	c3                   	ret
+
+008032ab <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8032ab:	55                   	push   %ebp
+  8032ac:	89 e5                	mov    %esp,%ebp
+  8032ae:	57                   	push   %edi
+  8032af:	56                   	push   %esi
+  8032b0:	53                   	push   %ebx
+  8032b1:	83 ec 18             	sub    $0x18,%esp
+  8032b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8032ba:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8032bc:	53                   	push   %ebx
+  8032bd:	e8 b3 ff ff ff       	call   803275 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8032c2:	83 c4 0c             	add    $0xc,%esp
+  8032c5:	ff 75 10             	push   0x10(%ebp)
+  8032c8:	57                   	push   %edi
+  8032c9:	56                   	push   %esi
+  8032ca:	e8 ee db ff ff       	call   800ebd <sys_futex_wait>
+  8032cf:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	be 02 00 00 00       	mov    $0x2,%esi
+  8032d9:	eb 10                	jmp    8032eb <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8032db:	83 ec 04             	sub    $0x4,%esp
+  8032de:	6a 00                	push   $0x0
+  8032e0:	6a 02                	push   $0x2
+  8032e2:	53                   	push   %ebx
+  8032e3:	e8 d5 db ff ff       	call   800ebd <sys_futex_wait>
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	89 f0                	mov    %esi,%eax
+  8032ed:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	75 e7                	jne    8032db <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8032f4:	83 ff ec             	cmp    $0xffffffec,%edi
+  8032f7:	74 05                	je     8032fe <cond_timedwait+0x53>
+  8032f9:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8032fe:	89 f8                	mov    %edi,%eax
+  803300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803303:	5b                   	pop    %ebx
+  803304:	5e                   	pop    %esi
+  803305:	5f                   	pop    %edi
+  803306:	5d                   	pop    %ebp
+  803307:	c3                   	ret
+
+00803308 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803308:	55                   	push   %ebp
+  803309:	89 e5                	mov    %esp,%ebp
+  80330b:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80330e:	6a 00                	push   $0x0
+  803310:	ff 75 0c             	push   0xc(%ebp)
+  803313:	ff 75 08             	push   0x8(%ebp)
+  803316:	e8 90 ff ff ff       	call   8032ab <cond_timedwait>
+}
+  80331b:	83 c4 10             	add    $0x10,%esp
+  80331e:	c9                   	leave
+  80331f:	c3                   	ret
+
+00803320 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803320:	55                   	push   %ebp
+  803321:	89 e5                	mov    %esp,%ebp
+  803323:	83 ec 10             	sub    $0x10,%esp
+  803326:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803329:	ba 01 00 00 00       	mov    $0x1,%edx
+  80332e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803332:	6a 01                	push   $0x1
+  803334:	50                   	push   %eax
+  803335:	e8 b2 db ff ff       	call   800eec <sys_futex_wake>
+}
+  80333a:	83 c4 10             	add    $0x10,%esp
+  80333d:	c9                   	leave
+  80333e:	c3                   	ret
+
+0080333f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80333f:	55                   	push   %ebp
+  803340:	89 e5                	mov    %esp,%ebp
+  803342:	83 ec 10             	sub    $0x10,%esp
+  803345:	8b 45 08             	mov    0x8(%ebp),%eax
+  803348:	ba 01 00 00 00       	mov    $0x1,%edx
+  80334d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803351:	68 00 04 00 00       	push   $0x400
+  803356:	50                   	push   %eax
+  803357:	e8 90 db ff ff       	call   800eec <sys_futex_wake>
+}
+  80335c:	83 c4 10             	add    $0x10,%esp
+  80335f:	c9                   	leave
+  803360:	c3                   	ret
+
+00803361 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803361:	55                   	push   %ebp
+  803362:	89 e5                	mov    %esp,%ebp
+  803364:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803367:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80336a:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80336c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803373:	5d                   	pop    %ebp
+  803374:	c3                   	ret
+
+00803375 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803375:	55                   	push   %ebp
+  803376:	89 e5                	mov    %esp,%ebp
+  803378:	53                   	push   %ebx
+  803379:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80337c:	8b 11                	mov    (%ecx),%edx
+  80337e:	85 d2                	test   %edx,%edx
+  803380:	74 14                	je     803396 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803382:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803385:	89 d0                	mov    %edx,%eax
+  803387:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80338b:	39 c2                	cmp    %eax,%edx
+  80338d:	75 ed                	jne    80337c <sem_trywait+0x7>
+			return 0;
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	eb 05                	jmp    80339b <sem_trywait+0x26>
+	return -E_AGAIN;
+  803396:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80339b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+
+008033a0 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+  8033a3:	57                   	push   %edi
+  8033a4:	56                   	push   %esi
+  8033a5:	53                   	push   %ebx
+  8033a6:	83 ec 1c             	sub    $0x1c,%esp
+  8033a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8033af:	e8 81 da ff ff       	call   800e35 <sys_time_msec>
+  8033b4:	01 f8                	add    %edi,%eax
+  8033b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8033b9:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8033be:	eb 28                	jmp    8033e8 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8033c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033c5:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8033ca:	83 ec 04             	sub    $0x4,%esp
+  8033cd:	56                   	push   %esi
+  8033ce:	6a 00                	push   $0x0
+  8033d0:	53                   	push   %ebx
+  8033d1:	e8 e7 da ff ff       	call   800ebd <sys_futex_wait>
+  8033d6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8033db:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8033e6:	74 2e                	je     803416 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8033e8:	83 ec 0c             	sub    $0xc,%esp
+  8033eb:	53                   	push   %ebx
+  8033ec:	e8 84 ff ff ff       	call   803375 <sem_trywait>
+  8033f1:	83 c4 10             	add    $0x10,%esp
+  8033f4:	85 c0                	test   %eax,%eax
+  8033f6:	79 19                	jns    803411 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8033f8:	85 ff                	test   %edi,%edi
+  8033fa:	74 c4                	je     8033c0 <sem_timedwait+0x20>
+  8033fc:	e8 34 da ff ff       	call   800e35 <sys_time_msec>
+  803401:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803404:	29 c6                	sub    %eax,%esi
+  803406:	85 f6                	test   %esi,%esi
+  803408:	7f b6                	jg     8033c0 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80340a:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  80340f:	eb 05                	jmp    803416 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803411:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803419:	5b                   	pop    %ebx
+  80341a:	5e                   	pop    %esi
+  80341b:	5f                   	pop    %edi
+  80341c:	5d                   	pop    %ebp
+  80341d:	c3                   	ret
+
+0080341e <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80341e:	55                   	push   %ebp
+  80341f:	89 e5                	mov    %esp,%ebp
+  803421:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803424:	6a 00                	push   $0x0
+  803426:	ff 75 08             	push   0x8(%ebp)
+  803429:	e8 72 ff ff ff       	call   8033a0 <sem_timedwait>
+}
+  80342e:	83 c4 10             	add    $0x10,%esp
+  803431:	c9                   	leave
+  803432:	c3                   	ret
+
+00803433 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803433:	55                   	push   %ebp
+  803434:	89 e5                	mov    %esp,%ebp
+  803436:	83 ec 08             	sub    $0x8,%esp
+  803439:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803441:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803445:	8b 50 04             	mov    0x4(%eax),%edx
+  803448:	85 d2                	test   %edx,%edx
+  80344a:	75 02                	jne    80344e <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80344e:	83 ec 08             	sub    $0x8,%esp
+  803451:	6a 01                	push   $0x1
+  803453:	50                   	push   %eax
+  803454:	e8 93 da ff ff       	call   800eec <sys_futex_wake>
+  803459:	83 c4 10             	add    $0x10,%esp
+}
+  80345c:	eb ee                	jmp    80344c <sem_post+0x19>
+
+0080345e <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80345e:	55                   	push   %ebp
+  80345f:	89 e5                	mov    %esp,%ebp
+  803461:	57                   	push   %edi
+  803462:	56                   	push   %esi
+  803463:	53                   	push   %ebx
+  803464:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803467:	68 20 60 80 00       	push   $0x806020
+  80346c:	e8 97 fd ff ff       	call   803208 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803471:	a1 44 60 80 00       	mov    0x806044,%eax
+  803476:	83 c4 10             	add    $0x10,%esp
+  803479:	85 c0                	test   %eax,%eax
+  80347b:	75 19                	jne    803496 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80347d:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803482:	8b 00                	mov    (%eax),%eax
+  803484:	8b 40 48             	mov    0x48(%eax),%eax
+  803487:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  80348c:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803493:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803496:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80349b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80349e:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8034a5:	8b 40 04             	mov    0x4(%eax),%eax
+  8034a8:	85 c0                	test   %eax,%eax
+  8034aa:	0f 84 e4 00 00 00    	je     803594 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034b0:	83 c3 01             	add    $0x1,%ebx
+  8034b3:	83 fb 20             	cmp    $0x20,%ebx
+  8034b6:	75 e3                	jne    80349b <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8034b8:	83 ec 0c             	sub    $0xc,%esp
+  8034bb:	68 20 60 80 00       	push   $0x806020
+  8034c0:	e8 b0 fd ff ff       	call   803275 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8034c5:	83 c4 10             	add    $0x10,%esp
+  8034c8:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8034cd:	e9 b8 00 00 00       	jmp    80358a <pthread_create+0x12c>
+  8034d2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8034d5:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8034d8:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8034da:	39 f3                	cmp    %esi,%ebx
+  8034dc:	73 16                	jae    8034f4 <pthread_create+0x96>
+		va -= PGSIZE;
+  8034de:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8034e4:	83 ec 08             	sub    $0x8,%esp
+  8034e7:	56                   	push   %esi
+  8034e8:	6a 00                	push   $0x0
+  8034ea:	e8 52 d7 ff ff       	call   800c41 <sys_page_unmap>
+  8034ef:	83 c4 10             	add    $0x10,%esp
+  8034f2:	eb e6                	jmp    8034da <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8034f4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8034f7:	83 ec 08             	sub    $0x8,%esp
+  8034fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8034fd:	6a 00                	push   $0x0
+  8034ff:	e8 3d d7 ff ff       	call   800c41 <sys_page_unmap>
+	return r;
+  803504:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803507:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80350a:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803511:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803518:	eb 70                	jmp    80358a <pthread_create+0x12c>
+	th->th_fn = fn;
+  80351a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80351d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803524:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803527:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80352a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80352d:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803530:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803537:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80353c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80353f:	29 c8                	sub    %ecx,%eax
+  803541:	85 db                	test   %ebx,%ebx
+  803543:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  80354a:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80354d:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803554:	83 ec 04             	sub    $0x4,%esp
+  803557:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80355c:	29 ca                	sub    %ecx,%edx
+  80355e:	52                   	push   %edx
+	*--esp = 0;
+  80355f:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803562:	50                   	push   %eax
+  803563:	68 bb 37 80 00       	push   $0x8037bb
+  803568:	e8 24 da ff ff       	call   800f91 <sys_thread_create>
+  80356d:	89 c7                	mov    %eax,%edi
+  80356f:	83 c4 10             	add    $0x10,%esp
+  803572:	85 c0                	test   %eax,%eax
+  803574:	78 91                	js     803507 <pthread_create+0xa9>
+	th->th_env = id;
+  803576:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803579:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803580:	8b 45 08             	mov    0x8(%ebp),%eax
+  803583:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803585:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80358a:	89 f8                	mov    %edi,%eax
+  80358c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80358f:	5b                   	pop    %ebx
+  803590:	5e                   	pop    %esi
+  803591:	5f                   	pop    %edi
+  803592:	5d                   	pop    %ebp
+  803593:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803594:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803597:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80359e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8035a5:	83 ec 0c             	sub    $0xc,%esp
+  8035a8:	68 20 60 80 00       	push   $0x806020
+  8035ad:	e8 c3 fc ff ff       	call   803275 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8035b2:	89 d9                	mov    %ebx,%ecx
+  8035b4:	c1 e1 10             	shl    $0x10,%ecx
+  8035b7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8035ba:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8035bf:	29 c8                	sub    %ecx,%eax
+  8035c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8035c4:	c1 e8 16             	shr    $0x16,%eax
+  8035c7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035ce:	83 c4 10             	add    $0x10,%esp
+  8035d1:	a8 01                	test   $0x1,%al
+  8035d3:	74 15                	je     8035ea <pthread_create+0x18c>
+  8035d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035d8:	c1 e8 0c             	shr    $0xc,%eax
+  8035db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035e2:	a8 01                	test   $0x1,%al
+  8035e4:	0f 85 30 ff ff ff    	jne    80351a <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8035ea:	83 ec 04             	sub    $0x4,%esp
+  8035ed:	6a 07                	push   $0x7
+  8035ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8035f2:	6a 00                	push   $0x0
+  8035f4:	e8 af d5 ff ff       	call   800ba8 <sys_page_alloc>
+  8035f9:	89 c7                	mov    %eax,%edi
+  8035fb:	83 c4 10             	add    $0x10,%esp
+  8035fe:	85 c0                	test   %eax,%eax
+  803600:	0f 88 01 ff ff ff    	js     803507 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803606:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80360b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80360e:	29 d0                	sub    %edx,%eax
+  803610:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803613:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803615:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80361a:	29 d0                	sub    %edx,%eax
+  80361c:	89 c7                	mov    %eax,%edi
+  80361e:	39 fe                	cmp    %edi,%esi
+  803620:	0f 83 f4 fe ff ff    	jae    80351a <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803626:	83 ec 04             	sub    $0x4,%esp
+  803629:	6a 07                	push   $0x7
+  80362b:	56                   	push   %esi
+  80362c:	6a 00                	push   $0x0
+  80362e:	e8 75 d5 ff ff       	call   800ba8 <sys_page_alloc>
+  803633:	83 c4 10             	add    $0x10,%esp
+  803636:	85 c0                	test   %eax,%eax
+  803638:	0f 88 94 fe ff ff    	js     8034d2 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80363e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803644:	eb d8                	jmp    80361e <pthread_create+0x1c0>
+
+00803646 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803646:	55                   	push   %ebp
+  803647:	89 e5                	mov    %esp,%ebp
+  803649:	57                   	push   %edi
+  80364a:	56                   	push   %esi
+  80364b:	53                   	push   %ebx
+  80364c:	83 ec 0c             	sub    $0xc,%esp
+  80364f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803652:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803655:	83 f8 1e             	cmp    $0x1e,%eax
+  803658:	0f 87 c7 00 00 00    	ja     803725 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80365e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803660:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803666:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80366b:	77 12                	ja     80367f <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80366d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803672:	29 d0                	sub    %edx,%eax
+  803674:	c1 e8 10             	shr    $0x10,%eax
+  803677:	39 c3                	cmp    %eax,%ebx
+  803679:	0f 84 ad 00 00 00    	je     80372c <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80367f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803682:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803689:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803690:	eb 10                	jmp    8036a2 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803692:	83 ec 04             	sub    $0x4,%esp
+  803695:	6a 00                	push   $0x0
+  803697:	6a 01                	push   $0x1
+  803699:	57                   	push   %edi
+  80369a:	e8 1e d8 ff ff       	call   800ebd <sys_futex_wait>
+  80369f:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036a2:	8b 46 04             	mov    0x4(%esi),%eax
+  8036a5:	83 f8 01             	cmp    $0x1,%eax
+  8036a8:	74 e8                	je     803692 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8036aa:	83 f8 02             	cmp    $0x2,%eax
+  8036ad:	0f 85 80 00 00 00    	jne    803733 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036b3:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8036b6:	c1 e6 02             	shl    $0x2,%esi
+  8036b9:	eb 05                	jmp    8036c0 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8036bb:	e8 bc d4 ff ff       	call   800b7c <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036c0:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8036c6:	89 ca                	mov    %ecx,%edx
+  8036c8:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8036ce:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036d1:	c1 e0 04             	shl    $0x4,%eax
+  8036d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036d9:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8036dc:	39 c1                	cmp    %eax,%ecx
+  8036de:	75 12                	jne    8036f2 <pthread_join+0xac>
+  8036e0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036e3:	c1 e0 04             	shl    $0x4,%eax
+  8036e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036eb:	8b 40 54             	mov    0x54(%eax),%eax
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	75 c9                	jne    8036bb <pthread_join+0x75>
+	if (ret_store)
+  8036f2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8036f6:	74 0f                	je     803707 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8036f8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036fb:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803702:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803705:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803707:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80370a:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803711:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803718:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80371d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803720:	5b                   	pop    %ebx
+  803721:	5e                   	pop    %esi
+  803722:	5f                   	pop    %edi
+  803723:	5d                   	pop    %ebp
+  803724:	c3                   	ret
+		return -E_INVAL;
+  803725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80372a:	eb f1                	jmp    80371d <pthread_join+0xd7>
+  80372c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803731:	eb ea                	jmp    80371d <pthread_join+0xd7>
+		return -E_INVAL;
+  803733:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803738:	eb e3                	jmp    80371d <pthread_join+0xd7>
+
+0080373a <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80373a:	55                   	push   %ebp
+  80373b:	89 e5                	mov    %esp,%ebp
+  80373d:	53                   	push   %ebx
+  80373e:	83 ec 04             	sub    $0x4,%esp
+  803741:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803743:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803749:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80374e:	77 0c                	ja     80375c <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803750:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803755:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803757:	c1 e8 10             	shr    $0x10,%eax
+  80375a:	75 0a                	jne    803766 <pthread_exit+0x2c>
+		exit();
+  80375c:	e8 68 c9 ff ff       	call   8000c9 <exit>
+  803761:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803766:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80376d:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803770:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803777:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80377a:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80377d:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803784:	83 ec 08             	sub    $0x8,%esp
+  803787:	6a 20                	push   $0x20
+  803789:	01 c2                	add    %eax,%edx
+  80378b:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803792:	50                   	push   %eax
+  803793:	e8 54 d7 ff ff       	call   800eec <sys_futex_wake>
+	sys_env_destroy(0);
+  803798:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80379f:	e8 61 d3 ff ff       	call   800b05 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8037a4:	83 c4 0c             	add    $0xc,%esp
+  8037a7:	68 46 4c 80 00       	push   $0x804c46
+  8037ac:	68 a5 00 00 00       	push   $0xa5
+  8037b1:	68 60 4c 80 00       	push   $0x804c60
+  8037b6:	e8 cd 03 00 00       	call   803b88 <_panic>
+
+008037bb <pthread_start>:
+{
+  8037bb:	55                   	push   %ebp
+  8037bc:	89 e5                	mov    %esp,%ebp
+  8037be:	53                   	push   %ebx
+  8037bf:	83 ec 04             	sub    $0x4,%esp
+  8037c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8037c5:	e8 86 d3 ff ff       	call   800b50 <sys_getenvid>
+  8037ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8037cf:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8037d5:	85 db                	test   %ebx,%ebx
+  8037d7:	74 0c                	je     8037e5 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037d9:	89 d9                	mov    %ebx,%ecx
+  8037db:	c1 e1 10             	shl    $0x10,%ecx
+  8037de:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037e3:	29 ca                	sub    %ecx,%edx
+  8037e5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8037e8:	c1 e0 04             	shl    $0x4,%eax
+  8037eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037f0:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8037f2:	83 ec 0c             	sub    $0xc,%esp
+  8037f5:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8037fc:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8037ff:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803806:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  80380d:	89 04 24             	mov    %eax,(%esp)
+  803810:	e8 25 ff ff ff       	call   80373a <pthread_exit>
+
+00803815 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803815:	55                   	push   %ebp
+  803816:	89 e5                	mov    %esp,%ebp
+  803818:	57                   	push   %edi
+  803819:	56                   	push   %esi
+  80381a:	53                   	push   %ebx
+  80381b:	83 ec 1c             	sub    $0x1c,%esp
+  80381e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803820:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803826:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80382d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803832:	77 0d                	ja     803841 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803834:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803839:	29 d0                	sub    %edx,%eax
+  80383b:	c1 e8 10             	shr    $0x10,%eax
+  80383e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803841:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803846:	eb 2f                	jmp    803877 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803848:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80384e:	8b 01                	mov    (%ecx),%eax
+  803850:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803853:	39 c2                	cmp    %eax,%edx
+  803855:	75 14                	jne    80386b <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803857:	83 ec 0c             	sub    $0xc,%esp
+  80385a:	57                   	push   %edi
+  80385b:	e8 a5 d2 ff ff       	call   800b05 <sys_env_destroy>
+  803860:	83 c4 10             	add    $0x10,%esp
+  803863:	85 c0                	test   %eax,%eax
+  803865:	0f 88 97 00 00 00    	js     803902 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80386b:	83 c3 01             	add    $0x1,%ebx
+  80386e:	83 fb 20             	cmp    $0x20,%ebx
+  803871:	0f 84 d2 00 00 00    	je     803949 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803877:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80387a:	74 ef                	je     80386b <pthread_kill_others+0x56>
+  80387c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80387f:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803886:	8b 40 04             	mov    0x4(%eax),%eax
+  803889:	83 f8 01             	cmp    $0x1,%eax
+  80388c:	75 dd                	jne    80386b <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80388e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803891:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803898:	89 fe                	mov    %edi,%esi
+  80389a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038a0:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038a3:	c1 e0 04             	shl    $0x4,%eax
+  8038a6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038ab:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038ae:	39 c7                	cmp    %eax,%edi
+  8038b0:	75 b9                	jne    80386b <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038b2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038b5:	c1 e0 04             	shl    $0x4,%eax
+  8038b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038bd:	8b 40 54             	mov    0x54(%eax),%eax
+  8038c0:	85 c0                	test   %eax,%eax
+  8038c2:	74 a7                	je     80386b <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038c4:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038c7:	c1 e0 04             	shl    $0x4,%eax
+  8038ca:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8038d0:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038d2:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8038d8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038dd:	0f 87 65 ff ff ff    	ja     803848 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038e3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038e8:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8038ea:	c1 e8 10             	shr    $0x10,%eax
+  8038ed:	0f 84 55 ff ff ff    	je     803848 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038f3:	c1 e0 10             	shl    $0x10,%eax
+  8038f6:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8038fb:	29 c1                	sub    %eax,%ecx
+  8038fd:	e9 4c ff ff ff       	jmp    80384e <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803902:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803905:	c1 e2 04             	shl    $0x4,%edx
+  803908:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80390e:	8b 52 48             	mov    0x48(%edx),%edx
+  803911:	39 fa                	cmp    %edi,%edx
+  803913:	0f 85 52 ff ff ff    	jne    80386b <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803919:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80391c:	c1 e2 04             	shl    $0x4,%edx
+  80391f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803925:	8b 52 54             	mov    0x54(%edx),%edx
+  803928:	85 d2                	test   %edx,%edx
+  80392a:	0f 84 3b ff ff ff    	je     80386b <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803930:	83 ec 0c             	sub    $0xc,%esp
+  803933:	50                   	push   %eax
+  803934:	57                   	push   %edi
+  803935:	68 70 4c 80 00       	push   $0x804c70
+  80393a:	68 bb 00 00 00       	push   $0xbb
+  80393f:	68 60 4c 80 00       	push   $0x804c60
+  803944:	e8 3f 02 00 00       	call   803b88 <_panic>
+	}
+}
+  803949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80394c:	5b                   	pop    %ebx
+  80394d:	5e                   	pop    %esi
+  80394e:	5f                   	pop    %edi
+  80394f:	5d                   	pop    %ebp
+  803950:	c3                   	ret
+
+00803951 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803951:	55                   	push   %ebp
+  803952:	89 e5                	mov    %esp,%ebp
+  803954:	53                   	push   %ebx
+  803955:	83 ec 04             	sub    $0x4,%esp
+  803958:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80395a:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803960:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803966:	0f 87 85 00 00 00    	ja     8039f1 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80396c:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803971:	29 c3                	sub    %eax,%ebx
+  803973:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803976:	83 ec 04             	sub    $0x4,%esp
+  803979:	68 80 02 00 00       	push   $0x280
+  80397e:	6a 00                	push   $0x0
+  803980:	68 40 60 80 00       	push   $0x806040
+  803985:	e8 31 cf ff ff       	call   8008bb <memset>
+	threads_mu.m_state = 0;
+  80398a:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803991:	00 00 00 
+	if (self != 0) {
+  803994:	83 c4 10             	add    $0x10,%esp
+  803997:	85 db                	test   %ebx,%ebx
+  803999:	74 51                	je     8039ec <pthread_fork_child+0x9b>
+  80399b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80399d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039a3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039a8:	77 18                	ja     8039c2 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039aa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039af:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039b1:	c1 e8 10             	shr    $0x10,%eax
+  8039b4:	74 0c                	je     8039c2 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039b6:	c1 e0 10             	shl    $0x10,%eax
+  8039b9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039be:	29 c2                	sub    %eax,%edx
+  8039c0:	eb 06                	jmp    8039c8 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8039c2:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8039c8:	8b 02                	mov    (%edx),%eax
+  8039ca:	8b 48 48             	mov    0x48(%eax),%ecx
+  8039cd:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8039d4:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8039d7:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8039de:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  8039e5:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8039ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039ef:	c9                   	leave
+  8039f0:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8039f1:	83 ec 04             	sub    $0x4,%esp
+  8039f4:	68 80 02 00 00       	push   $0x280
+  8039f9:	6a 00                	push   $0x0
+  8039fb:	68 40 60 80 00       	push   $0x806040
+  803a00:	e8 b6 ce ff ff       	call   8008bb <memset>
+	threads_mu.m_state = 0;
+  803a05:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a0c:	00 00 00 
+  803a0f:	83 c4 10             	add    $0x10,%esp
+  803a12:	eb d8                	jmp    8039ec <pthread_fork_child+0x9b>
+
+00803a14 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a19:	c3                   	ret
+
+00803a1a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a1a:	55                   	push   %ebp
+  803a1b:	89 e5                	mov    %esp,%ebp
+  803a1d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803a20:	68 95 4c 80 00       	push   $0x804c95
+  803a25:	ff 75 0c             	push   0xc(%ebp)
+  803a28:	e8 3d cd ff ff       	call   80076a <strcpy>
+	return 0;
+}
+  803a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a32:	c9                   	leave
+  803a33:	c3                   	ret
+
+00803a34 <devcons_write>:
+{
+  803a34:	55                   	push   %ebp
+  803a35:	89 e5                	mov    %esp,%ebp
+  803a37:	57                   	push   %edi
+  803a38:	56                   	push   %esi
+  803a39:	53                   	push   %ebx
+  803a3a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803a40:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803a45:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803a4b:	eb 2e                	jmp    803a7b <devcons_write+0x47>
+		m = n - tot;
+  803a4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a50:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803a52:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a57:	39 c3                	cmp    %eax,%ebx
+  803a59:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a5c:	83 ec 04             	sub    $0x4,%esp
+  803a5f:	53                   	push   %ebx
+  803a60:	89 f0                	mov    %esi,%eax
+  803a62:	03 45 0c             	add    0xc(%ebp),%eax
+  803a65:	50                   	push   %eax
+  803a66:	57                   	push   %edi
+  803a67:	e8 84 ce ff ff       	call   8008f0 <memmove>
+		sys_cputs(buf, m);
+  803a6c:	83 c4 08             	add    $0x8,%esp
+  803a6f:	53                   	push   %ebx
+  803a70:	57                   	push   %edi
+  803a71:	e8 38 d0 ff ff       	call   800aae <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803a76:	01 de                	add    %ebx,%esi
+  803a78:	83 c4 10             	add    $0x10,%esp
+  803a7b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a7e:	72 cd                	jb     803a4d <devcons_write+0x19>
+}
+  803a80:	89 f0                	mov    %esi,%eax
+  803a82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a85:	5b                   	pop    %ebx
+  803a86:	5e                   	pop    %esi
+  803a87:	5f                   	pop    %edi
+  803a88:	5d                   	pop    %ebp
+  803a89:	c3                   	ret
+
+00803a8a <devcons_read>:
+{
+  803a8a:	55                   	push   %ebp
+  803a8b:	89 e5                	mov    %esp,%ebp
+  803a8d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a95:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a99:	75 07                	jne    803aa2 <devcons_read+0x18>
+  803a9b:	eb 1f                	jmp    803abc <devcons_read+0x32>
+		sys_yield();
+  803a9d:	e8 da d0 ff ff       	call   800b7c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803aa2:	e8 32 d0 ff ff       	call   800ad9 <sys_cgetc>
+  803aa7:	85 c0                	test   %eax,%eax
+  803aa9:	74 f2                	je     803a9d <devcons_read+0x13>
+	if (c < 0)
+  803aab:	78 0f                	js     803abc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803aad:	83 f8 04             	cmp    $0x4,%eax
+  803ab0:	74 0c                	je     803abe <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ab5:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ab7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803abc:	c9                   	leave
+  803abd:	c3                   	ret
+		return 0;
+  803abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac3:	eb f7                	jmp    803abc <devcons_read+0x32>
+
+00803ac5 <cputchar>:
+{
+  803ac5:	55                   	push   %ebp
+  803ac6:	89 e5                	mov    %esp,%ebp
+  803ac8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ace:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803ad1:	6a 01                	push   $0x1
+  803ad3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803ad6:	50                   	push   %eax
+  803ad7:	e8 d2 cf ff ff       	call   800aae <sys_cputs>
+}
+  803adc:	83 c4 10             	add    $0x10,%esp
+  803adf:	c9                   	leave
+  803ae0:	c3                   	ret
+
+00803ae1 <getchar>:
+{
+  803ae1:	55                   	push   %ebp
+  803ae2:	89 e5                	mov    %esp,%ebp
+  803ae4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803ae7:	6a 01                	push   $0x1
+  803ae9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803aec:	50                   	push   %eax
+  803aed:	6a 00                	push   $0x0
+  803aef:	e8 63 d8 ff ff       	call   801357 <read>
+	if (r < 0)
+  803af4:	83 c4 10             	add    $0x10,%esp
+  803af7:	85 c0                	test   %eax,%eax
+  803af9:	78 06                	js     803b01 <getchar+0x20>
+	if (r < 1)
+  803afb:	74 06                	je     803b03 <getchar+0x22>
+	return c;
+  803afd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b01:	c9                   	leave
+  803b02:	c3                   	ret
+		return -E_EOF;
+  803b03:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b08:	eb f7                	jmp    803b01 <getchar+0x20>
+
+00803b0a <iscons>:
+{
+  803b0a:	55                   	push   %ebp
+  803b0b:	89 e5                	mov    %esp,%ebp
+  803b0d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b13:	50                   	push   %eax
+  803b14:	ff 75 08             	push   0x8(%ebp)
+  803b17:	e8 ab d5 ff ff       	call   8010c7 <fd_lookup>
+  803b1c:	83 c4 10             	add    $0x10,%esp
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	78 11                	js     803b34 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b26:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b2c:	39 10                	cmp    %edx,(%eax)
+  803b2e:	0f 94 c0             	sete   %al
+  803b31:	0f b6 c0             	movzbl %al,%eax
+}
+  803b34:	c9                   	leave
+  803b35:	c3                   	ret
+
+00803b36 <opencons>:
+{
+  803b36:	55                   	push   %ebp
+  803b37:	89 e5                	mov    %esp,%ebp
+  803b39:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803b3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b3f:	50                   	push   %eax
+  803b40:	e8 2c d5 ff ff       	call   801071 <fd_alloc>
+  803b45:	83 c4 10             	add    $0x10,%esp
+  803b48:	85 c0                	test   %eax,%eax
+  803b4a:	78 3a                	js     803b86 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803b4c:	83 ec 04             	sub    $0x4,%esp
+  803b4f:	68 07 04 00 00       	push   $0x407
+  803b54:	ff 75 f4             	push   -0xc(%ebp)
+  803b57:	6a 00                	push   $0x0
+  803b59:	e8 4a d0 ff ff       	call   800ba8 <sys_page_alloc>
+  803b5e:	83 c4 10             	add    $0x10,%esp
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	78 21                	js     803b86 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b68:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b6e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b73:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b7a:	83 ec 0c             	sub    $0xc,%esp
+  803b7d:	50                   	push   %eax
+  803b7e:	e8 c7 d4 ff ff       	call   80104a <fd2num>
+  803b83:	83 c4 10             	add    $0x10,%esp
+}
+  803b86:	c9                   	leave
+  803b87:	c3                   	ret
+
+00803b88 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803b88:	55                   	push   %ebp
+  803b89:	89 e5                	mov    %esp,%ebp
+  803b8b:	56                   	push   %esi
+  803b8c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803b8d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803b90:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803b96:	e8 b5 cf ff ff       	call   800b50 <sys_getenvid>
+  803b9b:	83 ec 0c             	sub    $0xc,%esp
+  803b9e:	ff 75 0c             	push   0xc(%ebp)
+  803ba1:	ff 75 08             	push   0x8(%ebp)
+  803ba4:	56                   	push   %esi
+  803ba5:	50                   	push   %eax
+  803ba6:	68 a4 4c 80 00       	push   $0x804ca4
+  803bab:	e8 d6 c5 ff ff       	call   800186 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803bb0:	83 c4 18             	add    $0x18,%esp
+  803bb3:	53                   	push   %ebx
+  803bb4:	ff 75 10             	push   0x10(%ebp)
+  803bb7:	e8 79 c5 ff ff       	call   800135 <vcprintf>
+	cprintf("\n");
+  803bbc:	c7 04 24 02 4e 80 00 	movl   $0x804e02,(%esp)
+  803bc3:	e8 be c5 ff ff       	call   800186 <cprintf>
+  803bc8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803bcb:	cc                   	int3
+	while (1)
+  803bcc:	eb fd                	jmp    803bcb <_panic+0x43>
+
+00803bce <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bce:	55                   	push   %ebp
+  803bcf:	89 e5                	mov    %esp,%ebp
+  803bd1:	57                   	push   %edi
+  803bd2:	56                   	push   %esi
+  803bd3:	53                   	push   %ebx
+  803bd4:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bd7:	89 d6                	mov    %edx,%esi
+  803bd9:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bdc:	89 cf                	mov    %ecx,%edi
+  803bde:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803be1:	89 fa                	mov    %edi,%edx
+  803be3:	80 ce 08             	or     $0x8,%dh
+  803be6:	f6 c5 08             	test   $0x8,%ch
+  803be9:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bec:	57                   	push   %edi
+  803bed:	56                   	push   %esi
+  803bee:	50                   	push   %eax
+  803bef:	56                   	push   %esi
+  803bf0:	6a 00                	push   $0x0
+  803bf2:	e8 fe cf ff ff       	call   800bf5 <sys_page_map>
+	if (r < 0) {
+  803bf7:	83 c4 20             	add    $0x20,%esp
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	78 27                	js     803c25 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bfe:	83 ec 0c             	sub    $0xc,%esp
+  803c01:	57                   	push   %edi
+  803c02:	56                   	push   %esi
+  803c03:	6a 00                	push   $0x0
+  803c05:	56                   	push   %esi
+  803c06:	6a 00                	push   $0x0
+  803c08:	e8 e8 cf ff ff       	call   800bf5 <sys_page_map>
+  803c0d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c0f:	83 c4 20             	add    $0x20,%esp
+  803c12:	85 c0                	test   %eax,%eax
+  803c14:	78 24                	js     803c3a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c16:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c1b:	89 d8                	mov    %ebx,%eax
+  803c1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c20:	5b                   	pop    %ebx
+  803c21:	5e                   	pop    %esi
+  803c22:	5f                   	pop    %edi
+  803c23:	5d                   	pop    %ebp
+  803c24:	c3                   	ret
+  803c25:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c27:	83 ec 08             	sub    $0x8,%esp
+  803c2a:	50                   	push   %eax
+  803c2b:	68 c8 4c 80 00       	push   $0x804cc8
+  803c30:	e8 51 c5 ff ff       	call   800186 <cprintf>
+		return r;
+  803c35:	83 c4 10             	add    $0x10,%esp
+  803c38:	eb e1                	jmp    803c1b <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c3a:	83 ec 08             	sub    $0x8,%esp
+  803c3d:	50                   	push   %eax
+  803c3e:	68 f8 4c 80 00       	push   $0x804cf8
+  803c43:	e8 3e c5 ff ff       	call   800186 <cprintf>
+		return r;
+  803c48:	83 c4 10             	add    $0x10,%esp
+  803c4b:	eb ce                	jmp    803c1b <duppage_cow+0x4d>
+
+00803c4d <duppage>:
+{
+  803c4d:	55                   	push   %ebp
+  803c4e:	89 e5                	mov    %esp,%ebp
+  803c50:	53                   	push   %ebx
+  803c51:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c54:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c57:	51                   	push   %ecx
+  803c58:	52                   	push   %edx
+  803c59:	50                   	push   %eax
+  803c5a:	52                   	push   %edx
+  803c5b:	6a 00                	push   $0x0
+  803c5d:	e8 93 cf ff ff       	call   800bf5 <sys_page_map>
+	if (r < 0) {
+  803c62:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c65:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c6a:	85 c0                	test   %eax,%eax
+  803c6c:	78 07                	js     803c75 <duppage+0x28>
+}
+  803c6e:	89 d8                	mov    %ebx,%eax
+  803c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c73:	c9                   	leave
+  803c74:	c3                   	ret
+  803c75:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c77:	83 ec 08             	sub    $0x8,%esp
+  803c7a:	50                   	push   %eax
+  803c7b:	68 c8 4c 80 00       	push   $0x804cc8
+  803c80:	e8 01 c5 ff ff       	call   800186 <cprintf>
+		return r;
+  803c85:	83 c4 10             	add    $0x10,%esp
+  803c88:	eb e4                	jmp    803c6e <duppage+0x21>
+
+00803c8a <cow_copy>:
+{
+  803c8a:	55                   	push   %ebp
+  803c8b:	89 e5                	mov    %esp,%ebp
+  803c8d:	56                   	push   %esi
+  803c8e:	53                   	push   %ebx
+  803c8f:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c91:	83 ec 04             	sub    $0x4,%esp
+  803c94:	6a 07                	push   $0x7
+  803c96:	68 00 f0 7f 00       	push   $0x7ff000
+  803c9b:	6a 00                	push   $0x0
+  803c9d:	e8 06 cf ff ff       	call   800ba8 <sys_page_alloc>
+	if (r < 0) {
+  803ca2:	83 c4 10             	add    $0x10,%esp
+  803ca5:	85 c0                	test   %eax,%eax
+  803ca7:	78 58                	js     803d01 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803ca9:	83 ec 04             	sub    $0x4,%esp
+  803cac:	68 00 10 00 00       	push   $0x1000
+  803cb1:	56                   	push   %esi
+  803cb2:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb7:	e8 34 cc ff ff       	call   8008f0 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cbc:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cc3:	56                   	push   %esi
+  803cc4:	6a 00                	push   $0x0
+  803cc6:	68 00 f0 7f 00       	push   $0x7ff000
+  803ccb:	6a 00                	push   $0x0
+  803ccd:	e8 23 cf ff ff       	call   800bf5 <sys_page_map>
+  803cd2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd4:	83 c4 20             	add    $0x20,%esp
+  803cd7:	85 c0                	test   %eax,%eax
+  803cd9:	78 3b                	js     803d16 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cdb:	83 ec 08             	sub    $0x8,%esp
+  803cde:	68 00 f0 7f 00       	push   $0x7ff000
+  803ce3:	6a 00                	push   $0x0
+  803ce5:	e8 57 cf ff ff       	call   800c41 <sys_page_unmap>
+  803cea:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cec:	83 c4 10             	add    $0x10,%esp
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	78 45                	js     803d38 <cow_copy+0xae>
+	return 0;
+  803cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf8:	89 d8                	mov    %ebx,%eax
+  803cfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cfd:	5b                   	pop    %ebx
+  803cfe:	5e                   	pop    %esi
+  803cff:	5d                   	pop    %ebp
+  803d00:	c3                   	ret
+  803d01:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d03:	83 ec 08             	sub    $0x8,%esp
+  803d06:	50                   	push   %eax
+  803d07:	68 e8 4d 80 00       	push   $0x804de8
+  803d0c:	e8 75 c4 ff ff       	call   800186 <cprintf>
+		return r;
+  803d11:	83 c4 10             	add    $0x10,%esp
+  803d14:	eb e2                	jmp    803cf8 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d16:	83 ec 08             	sub    $0x8,%esp
+  803d19:	50                   	push   %eax
+  803d1a:	68 04 4e 80 00       	push   $0x804e04
+  803d1f:	e8 62 c4 ff ff       	call   800186 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d24:	83 c4 08             	add    $0x8,%esp
+  803d27:	68 00 f0 7f 00       	push   $0x7ff000
+  803d2c:	6a 00                	push   $0x0
+  803d2e:	e8 0e cf ff ff       	call   800c41 <sys_page_unmap>
+		return r;
+  803d33:	83 c4 10             	add    $0x10,%esp
+  803d36:	eb c0                	jmp    803cf8 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d38:	83 ec 08             	sub    $0x8,%esp
+  803d3b:	50                   	push   %eax
+  803d3c:	68 20 4d 80 00       	push   $0x804d20
+  803d41:	e8 40 c4 ff ff       	call   800186 <cprintf>
+		return r;
+  803d46:	83 c4 10             	add    $0x10,%esp
+  803d49:	eb ad                	jmp    803cf8 <cow_copy+0x6e>
+
+00803d4b <pgfault>:
+{
+  803d4b:	55                   	push   %ebp
+  803d4c:	89 e5                	mov    %esp,%ebp
+  803d4e:	56                   	push   %esi
+  803d4f:	53                   	push   %ebx
+  803d50:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d53:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d55:	89 d8                	mov    %ebx,%eax
+  803d57:	c1 e8 16             	shr    $0x16,%eax
+  803d5a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d61:	89 de                	mov    %ebx,%esi
+  803d63:	c1 ee 0c             	shr    $0xc,%esi
+  803d66:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d6d:	a8 07                	test   $0x7,%al
+  803d6f:	74 3b                	je     803dac <pgfault+0x61>
+  803d71:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d77:	74 33                	je     803dac <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d79:	83 ec 0c             	sub    $0xc,%esp
+  803d7c:	68 00 f0 bf ee       	push   $0xeebff000
+  803d81:	e8 82 f4 ff ff       	call   803208 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d86:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d8d:	83 c4 10             	add    $0x10,%esp
+  803d90:	f6 c4 08             	test   $0x8,%ah
+  803d93:	75 30                	jne    803dc5 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d95:	83 ec 0c             	sub    $0xc,%esp
+  803d98:	68 00 f0 bf ee       	push   $0xeebff000
+  803d9d:	e8 d3 f4 ff ff       	call   803275 <mutex_unlock>
+}
+  803da2:	83 c4 10             	add    $0x10,%esp
+  803da5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da8:	5b                   	pop    %ebx
+  803da9:	5e                   	pop    %esi
+  803daa:	5d                   	pop    %ebp
+  803dab:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803dac:	83 ec 08             	sub    $0x8,%esp
+  803daf:	ff 72 28             	push   0x28(%edx)
+  803db2:	51                   	push   %ecx
+  803db3:	50                   	push   %eax
+  803db4:	68 44 4d 80 00       	push   $0x804d44
+  803db9:	6a 3f                	push   $0x3f
+  803dbb:	68 1e 4e 80 00       	push   $0x804e1e
+  803dc0:	e8 c3 fd ff ff       	call   803b88 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dc5:	89 d8                	mov    %ebx,%eax
+  803dc7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dcc:	e8 b9 fe ff ff       	call   803c8a <cow_copy>
+  803dd1:	eb c2                	jmp    803d95 <pgfault+0x4a>
+
+00803dd3 <cow_enable>:
+{
+  803dd3:	55                   	push   %ebp
+  803dd4:	89 e5                	mov    %esp,%ebp
+  803dd6:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dd9:	68 4b 3d 80 00       	push   $0x803d4b
+  803dde:	e8 28 06 00 00       	call   80440b <set_pgfault_handler>
+}
+  803de3:	83 c4 10             	add    $0x10,%esp
+  803de6:	c9                   	leave
+  803de7:	c3                   	ret
+
+00803de8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803de8:	55                   	push   %ebp
+  803de9:	89 e5                	mov    %esp,%ebp
+  803deb:	57                   	push   %edi
+  803dec:	56                   	push   %esi
+  803ded:	53                   	push   %ebx
+  803dee:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803df1:	68 4b 3d 80 00       	push   $0x803d4b
+  803df6:	e8 10 06 00 00       	call   80440b <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803dfb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e00:	cd 30                	int    $0x30
+  803e02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	85 c0                	test   %eax,%eax
+  803e0a:	78 4b                	js     803e57 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e0c:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e16:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e19:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e1d:	0f 85 16 01 00 00    	jne    803f39 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e23:	e8 28 cd ff ff       	call   800b50 <sys_getenvid>
+  803e28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e2d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e2f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e35:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e3b:	77 32                	ja     803e6f <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e3d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e42:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e44:	c1 ea 10             	shr    $0x10,%edx
+  803e47:	74 26                	je     803e6f <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e49:	c1 e2 10             	shl    $0x10,%edx
+  803e4c:	89 d1                	mov    %edx,%ecx
+  803e4e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e53:	29 ca                	sub    %ecx,%edx
+  803e55:	eb 1e                	jmp    803e75 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e57:	83 ec 08             	sub    $0x8,%esp
+  803e5a:	89 c7                	mov    %eax,%edi
+  803e5c:	50                   	push   %eax
+  803e5d:	68 29 4e 80 00       	push   $0x804e29
+  803e62:	e8 1f c3 ff ff       	call   800186 <cprintf>
+		return eid;
+  803e67:	83 c4 10             	add    $0x10,%esp
+  803e6a:	e9 6c 01 00 00       	jmp    803fdb <fork+0x1f3>
+		return pthread_main_tls;
+  803e6f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e75:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e78:	c1 e0 04             	shl    $0x4,%eax
+  803e7b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e80:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e82:	e8 ca fa ff ff       	call   803951 <pthread_fork_child>
+		return eid;
+  803e87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e8a:	e9 4c 01 00 00       	jmp    803fdb <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e8f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e95:	89 da                	mov    %ebx,%edx
+  803e97:	89 f8                	mov    %edi,%eax
+  803e99:	e8 af fd ff ff       	call   803c4d <duppage>
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	79 28                	jns    803eca <fork+0xe2>
+  803ea2:	89 c7                	mov    %eax,%edi
+  803ea4:	e9 32 01 00 00       	jmp    803fdb <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ea9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eaf:	83 f9 05             	cmp    $0x5,%ecx
+  803eb2:	75 58                	jne    803f0c <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803eb4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803eb9:	89 da                	mov    %ebx,%edx
+  803ebb:	89 f8                	mov    %edi,%eax
+  803ebd:	e8 8b fd ff ff       	call   803c4d <duppage>
+  803ec2:	85 c0                	test   %eax,%eax
+  803ec4:	0f 88 0f 01 00 00    	js     803fd9 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eca:	83 c3 01             	add    $0x1,%ebx
+  803ecd:	39 de                	cmp    %ebx,%esi
+  803ecf:	74 54                	je     803f25 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ed1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ed8:	f6 c1 05             	test   $0x5,%cl
+  803edb:	74 ed                	je     803eca <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803edd:	f6 c5 04             	test   $0x4,%ch
+  803ee0:	75 ad                	jne    803e8f <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ee2:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ee8:	74 bf                	je     803ea9 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803eea:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ef0:	74 d8                	je     803eca <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ef2:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ef8:	89 da                	mov    %ebx,%edx
+  803efa:	89 f8                	mov    %edi,%eax
+  803efc:	e8 cd fc ff ff       	call   803bce <duppage_cow>
+  803f01:	85 c0                	test   %eax,%eax
+  803f03:	79 c5                	jns    803eca <fork+0xe2>
+  803f05:	89 c7                	mov    %eax,%edi
+  803f07:	e9 cf 00 00 00       	jmp    803fdb <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f0c:	68 74 4d 80 00       	push   $0x804d74
+  803f11:	68 5d 4b 80 00       	push   $0x804b5d
+  803f16:	68 c6 00 00 00       	push   $0xc6
+  803f1b:	68 1e 4e 80 00       	push   $0x804e1e
+  803f20:	e8 63 fc ff ff       	call   803b88 <_panic>
+  803f25:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f28:	83 c1 01             	add    $0x1,%ecx
+  803f2b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f31:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f37:	74 18                	je     803f51 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f39:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f40:	a8 07                	test   $0x7,%al
+  803f42:	74 e4                	je     803f28 <fork+0x140>
+  803f44:	89 cb                	mov    %ecx,%ebx
+  803f46:	c1 e3 0a             	shl    $0xa,%ebx
+  803f49:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f4c:	e9 7c ff ff ff       	jmp    803ecd <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f51:	83 ec 04             	sub    $0x4,%esp
+  803f54:	6a 07                	push   $0x7
+  803f56:	68 00 f0 bf ee       	push   $0xeebff000
+  803f5b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5e:	e8 45 cc ff ff       	call   800ba8 <sys_page_alloc>
+  803f63:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	78 34                	js     803fa0 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f6c:	83 ec 08             	sub    $0x8,%esp
+  803f6f:	68 49 44 80 00       	push   $0x804449
+  803f74:	ff 75 e4             	push   -0x1c(%ebp)
+  803f77:	e8 a9 cd ff ff       	call   800d25 <sys_env_set_pgfault_upcall>
+  803f7c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7e:	83 c4 10             	add    $0x10,%esp
+  803f81:	85 c0                	test   %eax,%eax
+  803f83:	78 2e                	js     803fb3 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f85:	83 ec 08             	sub    $0x8,%esp
+  803f88:	6a 02                	push   $0x2
+  803f8a:	ff 75 e4             	push   -0x1c(%ebp)
+  803f8d:	e8 fb cc ff ff       	call   800c8d <sys_env_set_status>
+  803f92:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f94:	83 c4 10             	add    $0x10,%esp
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	78 2b                	js     803fc6 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f9b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f9e:	eb 3b                	jmp    803fdb <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fa0:	83 ec 08             	sub    $0x8,%esp
+  803fa3:	50                   	push   %eax
+  803fa4:	68 9c 4d 80 00       	push   $0x804d9c
+  803fa9:	e8 d8 c1 ff ff       	call   800186 <cprintf>
+		return r;
+  803fae:	83 c4 10             	add    $0x10,%esp
+  803fb1:	eb 28                	jmp    803fdb <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fb3:	83 ec 08             	sub    $0x8,%esp
+  803fb6:	50                   	push   %eax
+  803fb7:	68 c4 4d 80 00       	push   $0x804dc4
+  803fbc:	e8 c5 c1 ff ff       	call   800186 <cprintf>
+		return r;
+  803fc1:	83 c4 10             	add    $0x10,%esp
+  803fc4:	eb 15                	jmp    803fdb <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fc6:	83 ec 08             	sub    $0x8,%esp
+  803fc9:	50                   	push   %eax
+  803fca:	68 39 4e 80 00       	push   $0x804e39
+  803fcf:	e8 b2 c1 ff ff       	call   800186 <cprintf>
+		return r;
+  803fd4:	83 c4 10             	add    $0x10,%esp
+  803fd7:	eb 02                	jmp    803fdb <fork+0x1f3>
+  803fd9:	89 c7                	mov    %eax,%edi
+}
+  803fdb:	89 f8                	mov    %edi,%eax
+  803fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fe0:	5b                   	pop    %ebx
+  803fe1:	5e                   	pop    %esi
+  803fe2:	5f                   	pop    %edi
+  803fe3:	5d                   	pop    %ebp
+  803fe4:	c3                   	ret
+
+00803fe5 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fe5:	55                   	push   %ebp
+  803fe6:	89 e5                	mov    %esp,%ebp
+  803fe8:	57                   	push   %edi
+  803fe9:	56                   	push   %esi
+  803fea:	53                   	push   %ebx
+  803feb:	83 ec 2c             	sub    $0x2c,%esp
+  803fee:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ff0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ffb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804001:	77 0a                	ja     80400d <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804003:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804008:	29 c3                	sub    %eax,%ebx
+  80400a:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80400d:	83 ec 0c             	sub    $0xc,%esp
+  804010:	68 4b 3d 80 00       	push   $0x803d4b
+  804015:	e8 f1 03 00 00       	call   80440b <set_pgfault_handler>
+  80401a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80401f:	cd 30                	int    $0x30
+  804021:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804024:	83 c4 10             	add    $0x10,%esp
+  804027:	85 c0                	test   %eax,%eax
+  804029:	78 30                	js     80405b <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80402b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80402f:	74 42                	je     804073 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804031:	c1 e3 10             	shl    $0x10,%ebx
+  804034:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804039:	29 d8                	sub    %ebx,%eax
+  80403b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80403e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804043:	29 d8                	sub    %ebx,%eax
+  804045:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804048:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80404d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804052:	89 f7                	mov    %esi,%edi
+  804054:	89 d6                	mov    %edx,%esi
+  804056:	e9 2c 01 00 00       	jmp    804187 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	89 c7                	mov    %eax,%edi
+  804060:	50                   	push   %eax
+  804061:	68 29 4e 80 00       	push   $0x804e29
+  804066:	e8 1b c1 ff ff       	call   800186 <cprintf>
+		return eid;
+  80406b:	83 c4 10             	add    $0x10,%esp
+  80406e:	e9 d5 00 00 00       	jmp    804148 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804073:	e8 d8 ca ff ff       	call   800b50 <sys_getenvid>
+  804078:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80407d:	89 c2                	mov    %eax,%edx
+  80407f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804081:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804087:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80408c:	77 18                	ja     8040a6 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80408e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804093:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804095:	c1 e8 10             	shr    $0x10,%eax
+  804098:	74 0c                	je     8040a6 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80409a:	c1 e0 10             	shl    $0x10,%eax
+  80409d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040a2:	29 c1                	sub    %eax,%ecx
+  8040a4:	eb 06                	jmp    8040ac <sfork+0xc7>
+		return pthread_main_tls;
+  8040a6:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040ac:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040af:	c1 e0 04             	shl    $0x4,%eax
+  8040b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040b7:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040b9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040bc:	e9 87 00 00 00       	jmp    804148 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040c1:	f6 c5 04             	test   $0x4,%ch
+  8040c4:	74 6c                	je     804132 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040c6:	89 ca                	mov    %ecx,%edx
+  8040c8:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040ce:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040d4:	74 7c                	je     804152 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040d6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040dc:	89 da                	mov    %ebx,%edx
+  8040de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040e1:	e8 67 fb ff ff       	call   803c4d <duppage>
+  8040e6:	85 c0                	test   %eax,%eax
+  8040e8:	0f 88 4f 01 00 00    	js     80423d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040ee:	83 c3 01             	add    $0x1,%ebx
+  8040f1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040f4:	74 7a                	je     804170 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040f6:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040f8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040ff:	f6 c1 01             	test   $0x1,%cl
+  804102:	74 ea                	je     8040ee <sfork+0x109>
+  804104:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80410a:	74 e2                	je     8040ee <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80410c:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804112:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804115:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80411a:	76 a5                	jbe    8040c1 <sfork+0xdc>
+  80411c:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804122:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804125:	39 fa                	cmp    %edi,%edx
+  804127:	73 9d                	jae    8040c6 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804129:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80412c:	39 fa                	cmp    %edi,%edx
+  80412e:	72 96                	jb     8040c6 <sfork+0xe1>
+  804130:	eb 8f                	jmp    8040c1 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804132:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804138:	89 da                	mov    %ebx,%edx
+  80413a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80413d:	e8 8c fa ff ff       	call   803bce <duppage_cow>
+  804142:	85 c0                	test   %eax,%eax
+  804144:	79 a8                	jns    8040ee <sfork+0x109>
+  804146:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804148:	89 f8                	mov    %edi,%eax
+  80414a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80414d:	5b                   	pop    %ebx
+  80414e:	5e                   	pop    %esi
+  80414f:	5f                   	pop    %edi
+  804150:	5d                   	pop    %ebp
+  804151:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804152:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804157:	e8 2e fb ff ff       	call   803c8a <cow_copy>
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	0f 88 d2 00 00 00    	js     804236 <sfork+0x251>
+				pte = uvpt[pn];
+  804164:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80416b:	e9 66 ff ff ff       	jmp    8040d6 <sfork+0xf1>
+  804170:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804173:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804176:	83 c6 01             	add    $0x1,%esi
+  804179:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80417f:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804185:	74 1b                	je     8041a2 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804187:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80418e:	a8 01                	test   $0x1,%al
+  804190:	74 e4                	je     804176 <sfork+0x191>
+  804192:	89 f3                	mov    %esi,%ebx
+  804194:	c1 e3 0a             	shl    $0xa,%ebx
+  804197:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80419a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80419d:	e9 4f ff ff ff       	jmp    8040f1 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041a2:	83 ec 04             	sub    $0x4,%esp
+  8041a5:	6a 07                	push   $0x7
+  8041a7:	68 00 f0 bf ee       	push   $0xeebff000
+  8041ac:	ff 75 e0             	push   -0x20(%ebp)
+  8041af:	e8 f4 c9 ff ff       	call   800ba8 <sys_page_alloc>
+  8041b4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041b6:	83 c4 10             	add    $0x10,%esp
+  8041b9:	85 c0                	test   %eax,%eax
+  8041bb:	78 37                	js     8041f4 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041bd:	83 ec 08             	sub    $0x8,%esp
+  8041c0:	68 49 44 80 00       	push   $0x804449
+  8041c5:	ff 75 e0             	push   -0x20(%ebp)
+  8041c8:	e8 58 cb ff ff       	call   800d25 <sys_env_set_pgfault_upcall>
+  8041cd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cf:	83 c4 10             	add    $0x10,%esp
+  8041d2:	85 c0                	test   %eax,%eax
+  8041d4:	78 34                	js     80420a <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041d6:	83 ec 08             	sub    $0x8,%esp
+  8041d9:	6a 02                	push   $0x2
+  8041db:	ff 75 e0             	push   -0x20(%ebp)
+  8041de:	e8 aa ca ff ff       	call   800c8d <sys_env_set_status>
+  8041e3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041e5:	83 c4 10             	add    $0x10,%esp
+  8041e8:	85 c0                	test   %eax,%eax
+  8041ea:	78 34                	js     804220 <sfork+0x23b>
+	return eid;
+  8041ec:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041ef:	e9 54 ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041f4:	83 ec 08             	sub    $0x8,%esp
+  8041f7:	50                   	push   %eax
+  8041f8:	68 9c 4d 80 00       	push   $0x804d9c
+  8041fd:	e8 84 bf ff ff       	call   800186 <cprintf>
+		return r;
+  804202:	83 c4 10             	add    $0x10,%esp
+  804205:	e9 3e ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80420a:	83 ec 08             	sub    $0x8,%esp
+  80420d:	50                   	push   %eax
+  80420e:	68 c4 4d 80 00       	push   $0x804dc4
+  804213:	e8 6e bf ff ff       	call   800186 <cprintf>
+		return r;
+  804218:	83 c4 10             	add    $0x10,%esp
+  80421b:	e9 28 ff ff ff       	jmp    804148 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804220:	83 ec 08             	sub    $0x8,%esp
+  804223:	50                   	push   %eax
+  804224:	68 39 4e 80 00       	push   $0x804e39
+  804229:	e8 58 bf ff ff       	call   800186 <cprintf>
+		return r;
+  80422e:	83 c4 10             	add    $0x10,%esp
+  804231:	e9 12 ff ff ff       	jmp    804148 <sfork+0x163>
+  804236:	89 c7                	mov    %eax,%edi
+  804238:	e9 0b ff ff ff       	jmp    804148 <sfork+0x163>
+  80423d:	89 c7                	mov    %eax,%edi
+  80423f:	e9 04 ff ff ff       	jmp    804148 <sfork+0x163>
+
+00804244 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804244:	55                   	push   %ebp
+  804245:	89 e5                	mov    %esp,%ebp
+  804247:	57                   	push   %edi
+  804248:	56                   	push   %esi
+  804249:	53                   	push   %ebx
+  80424a:	83 ec 18             	sub    $0x18,%esp
+  80424d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804250:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804253:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804256:	85 c0                	test   %eax,%eax
+  804258:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80425d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804260:	50                   	push   %eax
+  804261:	e8 38 cb ff ff       	call   800d9e <sys_ipc_recv>
+	if (r < 0) {
+  804266:	83 c4 10             	add    $0x10,%esp
+  804269:	85 c0                	test   %eax,%eax
+  80426b:	78 2b                	js     804298 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80426d:	85 ff                	test   %edi,%edi
+  80426f:	74 55                	je     8042c6 <ipc_recv+0x82>
+  804271:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804273:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804279:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80427e:	77 39                	ja     8042b9 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804280:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804285:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804287:	c1 e8 10             	shr    $0x10,%eax
+  80428a:	74 2d                	je     8042b9 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80428c:	c1 e0 10             	shl    $0x10,%eax
+  80428f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804294:	29 c2                	sub    %eax,%edx
+  804296:	eb 27                	jmp    8042bf <ipc_recv+0x7b>
+  804298:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80429a:	83 ec 08             	sub    $0x8,%esp
+  80429d:	50                   	push   %eax
+  80429e:	68 57 4e 80 00       	push   $0x804e57
+  8042a3:	e8 de be ff ff       	call   800186 <cprintf>
+		*from_env_store = 0;
+  8042a8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042ae:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042b4:	83 c4 10             	add    $0x10,%esp
+  8042b7:	eb 77                	jmp    804330 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042b9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042bf:	8b 02                	mov    (%edx),%eax
+  8042c1:	8b 40 78             	mov    0x78(%eax),%eax
+  8042c4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042c6:	85 f6                	test   %esi,%esi
+  8042c8:	74 34                	je     8042fe <ipc_recv+0xba>
+  8042ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d7:	77 18                	ja     8042f1 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042e0:	c1 e8 10             	shr    $0x10,%eax
+  8042e3:	74 0c                	je     8042f1 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042e5:	c1 e0 10             	shl    $0x10,%eax
+  8042e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042ed:	29 c2                	sub    %eax,%edx
+  8042ef:	eb 06                	jmp    8042f7 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042f1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042f7:	8b 02                	mov    (%edx),%eax
+  8042f9:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042fc:	89 06                	mov    %eax,(%esi)
+  8042fe:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804300:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804306:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80430b:	77 18                	ja     804325 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80430d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804312:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804314:	c1 e8 10             	shr    $0x10,%eax
+  804317:	74 0c                	je     804325 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804319:	c1 e0 10             	shl    $0x10,%eax
+  80431c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804321:	29 c2                	sub    %eax,%edx
+  804323:	eb 06                	jmp    80432b <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804325:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80432b:	8b 02                	mov    (%edx),%eax
+  80432d:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804330:	89 d8                	mov    %ebx,%eax
+  804332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804335:	5b                   	pop    %ebx
+  804336:	5e                   	pop    %esi
+  804337:	5f                   	pop    %edi
+  804338:	5d                   	pop    %ebp
+  804339:	c3                   	ret
+
+0080433a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80433a:	55                   	push   %ebp
+  80433b:	89 e5                	mov    %esp,%ebp
+  80433d:	57                   	push   %edi
+  80433e:	56                   	push   %esi
+  80433f:	53                   	push   %ebx
+  804340:	83 ec 0c             	sub    $0xc,%esp
+  804343:	8b 75 08             	mov    0x8(%ebp),%esi
+  804346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804349:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80434c:	85 db                	test   %ebx,%ebx
+  80434e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804353:	0f 44 d8             	cmove  %eax,%ebx
+  804356:	eb 05                	jmp    80435d <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804358:	e8 1f c8 ff ff       	call   800b7c <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80435d:	57                   	push   %edi
+  80435e:	53                   	push   %ebx
+  80435f:	ff 75 0c             	push   0xc(%ebp)
+  804362:	56                   	push   %esi
+  804363:	e8 09 ca ff ff       	call   800d71 <sys_ipc_try_send>
+		if (r == 0) {
+  804368:	83 c4 10             	add    $0x10,%esp
+  80436b:	85 c0                	test   %eax,%eax
+  80436d:	74 19                	je     804388 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80436f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804372:	74 e4                	je     804358 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804374:	83 ec 0c             	sub    $0xc,%esp
+  804377:	50                   	push   %eax
+  804378:	57                   	push   %edi
+  804379:	53                   	push   %ebx
+  80437a:	56                   	push   %esi
+  80437b:	68 70 4e 80 00       	push   $0x804e70
+  804380:	e8 01 be ff ff       	call   800186 <cprintf>
+			return;
+  804385:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80438b:	5b                   	pop    %ebx
+  80438c:	5e                   	pop    %esi
+  80438d:	5f                   	pop    %edi
+  80438e:	5d                   	pop    %ebp
+  80438f:	c3                   	ret
+
+00804390 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804390:	55                   	push   %ebp
+  804391:	89 e5                	mov    %esp,%ebp
+  804393:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804396:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80439b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80439e:	c1 e0 04             	shl    $0x4,%eax
+  8043a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043a6:	8b 40 50             	mov    0x50(%eax),%eax
+  8043a9:	39 c8                	cmp    %ecx,%eax
+  8043ab:	74 12                	je     8043bf <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043ad:	83 c2 01             	add    $0x1,%edx
+  8043b0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043b6:	75 e3                	jne    80439b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bd:	eb 0e                	jmp    8043cd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043bf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043c2:	c1 e0 04             	shl    $0x4,%eax
+  8043c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043ca:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043cd:	5d                   	pop    %ebp
+  8043ce:	c3                   	ret
+
+008043cf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043cf:	55                   	push   %ebp
+  8043d0:	89 e5                	mov    %esp,%ebp
+  8043d2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043d5:	89 c2                	mov    %eax,%edx
+  8043d7:	c1 ea 16             	shr    $0x16,%edx
+  8043da:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043e6:	f6 c1 01             	test   $0x1,%cl
+  8043e9:	74 1c                	je     804407 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043eb:	c1 e8 0c             	shr    $0xc,%eax
+  8043ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043f5:	a8 01                	test   $0x1,%al
+  8043f7:	74 0e                	je     804407 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043f9:	c1 e8 0c             	shr    $0xc,%eax
+  8043fc:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804403:	ef 
+  804404:	0f b7 d2             	movzwl %dx,%edx
+}
+  804407:	89 d0                	mov    %edx,%eax
+  804409:	5d                   	pop    %ebp
+  80440a:	c3                   	ret
+
+0080440b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80440b:	55                   	push   %ebp
+  80440c:	89 e5                	mov    %esp,%ebp
+  80440e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804411:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804418:	74 0a                	je     804424 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80441a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80441d:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804422:	c9                   	leave
+  804423:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804424:	83 ec 04             	sub    $0x4,%esp
+  804427:	6a 07                	push   $0x7
+  804429:	68 00 f0 bf ee       	push   $0xeebff000
+  80442e:	6a 00                	push   $0x0
+  804430:	e8 73 c7 ff ff       	call   800ba8 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804435:	83 c4 08             	add    $0x8,%esp
+  804438:	68 49 44 80 00       	push   $0x804449
+  80443d:	6a 00                	push   $0x0
+  80443f:	e8 e1 c8 ff ff       	call   800d25 <sys_env_set_pgfault_upcall>
+  804444:	83 c4 10             	add    $0x10,%esp
+  804447:	eb d1                	jmp    80441a <set_pgfault_handler+0xf>
+
+00804449 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804449:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80444a:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80444f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804451:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804454:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804458:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80445c:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80445f:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804463:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804465:	83 c4 08             	add    $0x8,%esp
+	popal
+  804468:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804469:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80446c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80446d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80446e:	c3                   	ret
+
+0080446f <udm>:
+  80446f:	57                   	push   %edi
+  804470:	56                   	push   %esi
+  804471:	53                   	push   %ebx
+  804472:	83 ec 20             	sub    $0x20,%esp
+  804475:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804479:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80447d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804481:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804485:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804489:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80448d:	89 d1                	mov    %edx,%ecx
+  80448f:	09 c1                	or     %eax,%ecx
+  804491:	0f 84 91 00 00 00    	je     804528 <udm+0xb9>
+  804497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044a6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044ad:	00 
+  8044ae:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044b5:	00 
+  8044b6:	eb 08                	jmp    8044c0 <udm+0x51>
+  8044b8:	83 e9 01             	sub    $0x1,%ecx
+  8044bb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044be:	74 7c                	je     80453c <udm+0xcd>
+  8044c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044c4:	01 c0                	add    %eax,%eax
+  8044c6:	89 c6                	mov    %eax,%esi
+  8044c8:	89 d7                	mov    %edx,%edi
+  8044ca:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044ce:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044d5:	d3 ea                	shr    %cl,%edx
+  8044d7:	f6 c1 20             	test   $0x20,%cl
+  8044da:	74 04                	je     8044e0 <udm+0x71>
+  8044dc:	89 d0                	mov    %edx,%eax
+  8044de:	31 d2                	xor    %edx,%edx
+  8044e0:	83 e0 01             	and    $0x1,%eax
+  8044e3:	89 04 24             	mov    %eax,(%esp)
+  8044e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044ed:	00 
+  8044ee:	8b 04 24             	mov    (%esp),%eax
+  8044f1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044f5:	09 f0                	or     %esi,%eax
+  8044f7:	09 fa                	or     %edi,%edx
+  8044f9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044fd:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804501:	39 f0                	cmp    %esi,%eax
+  804503:	89 d3                	mov    %edx,%ebx
+  804505:	19 fb                	sbb    %edi,%ebx
+  804507:	72 af                	jb     8044b8 <udm+0x49>
+  804509:	29 f0                	sub    %esi,%eax
+  80450b:	19 fa                	sbb    %edi,%edx
+  80450d:	89 cf                	mov    %ecx,%edi
+  80450f:	c1 ef 05             	shr    $0x5,%edi
+  804512:	83 e7 01             	and    $0x1,%edi
+  804515:	89 fe                	mov    %edi,%esi
+  804517:	83 f6 01             	xor    $0x1,%esi
+  80451a:	d3 e6                	shl    %cl,%esi
+  80451c:	d3 e7                	shl    %cl,%edi
+  80451e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804522:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804526:	eb 90                	jmp    8044b8 <udm+0x49>
+  804528:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80452c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804530:	89 f0                	mov    %esi,%eax
+  804532:	89 fa                	mov    %edi,%edx
+  804534:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804538:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80453c:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804540:	89 01                	mov    %eax,(%ecx)
+  804542:	89 51 04             	mov    %edx,0x4(%ecx)
+  804545:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804549:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80454d:	83 c4 20             	add    $0x20,%esp
+  804550:	5b                   	pop    %ebx
+  804551:	5e                   	pop    %esi
+  804552:	5f                   	pop    %edi
+  804553:	c3                   	ret
+
+00804554 <__udivdi3>:
+  804554:	83 ec 18             	sub    $0x18,%esp
+  804557:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80455b:	50                   	push   %eax
+  80455c:	ff 74 24 2c          	push   0x2c(%esp)
+  804560:	ff 74 24 2c          	push   0x2c(%esp)
+  804564:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804568:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80456c:	e8 fe fe ff ff       	call   80446f <udm>
+  804571:	83 c4 24             	add    $0x24,%esp
+  804574:	c3                   	ret
+
+00804575 <__umoddi3>:
+  804575:	83 ec 18             	sub    $0x18,%esp
+  804578:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80457c:	50                   	push   %eax
+  80457d:	ff 74 24 2c          	push   0x2c(%esp)
+  804581:	ff 74 24 2c          	push   0x2c(%esp)
+  804585:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804589:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80458d:	e8 dd fe ff ff       	call   80446f <udm>
+  804592:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804596:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80459a:	83 c4 24             	add    $0x24,%esp
+  80459d:	c3                   	ret
+
+0080459e <__divdi3>:
+  80459e:	56                   	push   %esi
+  80459f:	53                   	push   %ebx
+  8045a0:	83 ec 14             	sub    $0x14,%esp
+  8045a3:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045a7:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045ab:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045af:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045b3:	85 d2                	test   %edx,%edx
+  8045b5:	78 18                	js     8045cf <__divdi3+0x31>
+  8045b7:	85 db                	test   %ebx,%ebx
+  8045b9:	78 3e                	js     8045f9 <__divdi3+0x5b>
+  8045bb:	83 ec 04             	sub    $0x4,%esp
+  8045be:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c2:	56                   	push   %esi
+  8045c3:	53                   	push   %ebx
+  8045c4:	51                   	push   %ecx
+  8045c5:	e8 a5 fe ff ff       	call   80446f <udm>
+  8045ca:	83 c4 10             	add    $0x10,%esp
+  8045cd:	eb 24                	jmp    8045f3 <__divdi3+0x55>
+  8045cf:	f7 d8                	neg    %eax
+  8045d1:	83 d2 00             	adc    $0x0,%edx
+  8045d4:	f7 da                	neg    %edx
+  8045d6:	85 db                	test   %ebx,%ebx
+  8045d8:	78 3a                	js     804614 <__divdi3+0x76>
+  8045da:	83 ec 04             	sub    $0x4,%esp
+  8045dd:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e1:	56                   	push   %esi
+  8045e2:	53                   	push   %ebx
+  8045e3:	51                   	push   %ecx
+  8045e4:	e8 86 fe ff ff       	call   80446f <udm>
+  8045e9:	83 c4 10             	add    $0x10,%esp
+  8045ec:	f7 d8                	neg    %eax
+  8045ee:	83 d2 00             	adc    $0x0,%edx
+  8045f1:	f7 da                	neg    %edx
+  8045f3:	83 c4 14             	add    $0x14,%esp
+  8045f6:	5b                   	pop    %ebx
+  8045f7:	5e                   	pop    %esi
+  8045f8:	c3                   	ret
+  8045f9:	83 ec 04             	sub    $0x4,%esp
+  8045fc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804600:	56                   	push   %esi
+  804601:	f7 d9                	neg    %ecx
+  804603:	83 d3 00             	adc    $0x0,%ebx
+  804606:	f7 db                	neg    %ebx
+  804608:	53                   	push   %ebx
+  804609:	51                   	push   %ecx
+  80460a:	e8 60 fe ff ff       	call   80446f <udm>
+  80460f:	83 c4 10             	add    $0x10,%esp
+  804612:	eb d8                	jmp    8045ec <__divdi3+0x4e>
+  804614:	83 ec 04             	sub    $0x4,%esp
+  804617:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80461b:	56                   	push   %esi
+  80461c:	f7 d9                	neg    %ecx
+  80461e:	83 d3 00             	adc    $0x0,%ebx
+  804621:	f7 db                	neg    %ebx
+  804623:	53                   	push   %ebx
+  804624:	51                   	push   %ecx
+  804625:	e8 45 fe ff ff       	call   80446f <udm>
+  80462a:	83 c4 10             	add    $0x10,%esp
+  80462d:	eb c4                	jmp    8045f3 <__divdi3+0x55>
+
+0080462f <__moddi3>:
+  80462f:	55                   	push   %ebp
+  804630:	57                   	push   %edi
+  804631:	56                   	push   %esi
+  804632:	53                   	push   %ebx
+  804633:	83 ec 24             	sub    $0x24,%esp
+  804636:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80463a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80463e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804642:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804646:	85 d2                	test   %edx,%edx
+  804648:	78 3b                	js     804685 <__moddi3+0x56>
+  80464a:	83 ec 04             	sub    $0x4,%esp
+  80464d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804651:	56                   	push   %esi
+  804652:	89 ce                	mov    %ecx,%esi
+  804654:	f7 de                	neg    %esi
+  804656:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80465a:	89 de                	mov    %ebx,%esi
+  80465c:	83 d6 00             	adc    $0x0,%esi
+  80465f:	f7 de                	neg    %esi
+  804661:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804665:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804669:	0f 48 f1             	cmovs  %ecx,%esi
+  80466c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804671:	53                   	push   %ebx
+  804672:	56                   	push   %esi
+  804673:	e8 f7 fd ff ff       	call   80446f <udm>
+  804678:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80467c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804680:	83 c4 10             	add    $0x10,%esp
+  804683:	eb 47                	jmp    8046cc <__moddi3+0x9d>
+  804685:	f7 d8                	neg    %eax
+  804687:	83 d2 00             	adc    $0x0,%edx
+  80468a:	f7 da                	neg    %edx
+  80468c:	83 ec 04             	sub    $0x4,%esp
+  80468f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804693:	56                   	push   %esi
+  804694:	89 cf                	mov    %ecx,%edi
+  804696:	f7 df                	neg    %edi
+  804698:	89 de                	mov    %ebx,%esi
+  80469a:	83 d6 00             	adc    $0x0,%esi
+  80469d:	f7 de                	neg    %esi
+  80469f:	0f 49 cf             	cmovns %edi,%ecx
+  8046a2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046a6:	0f 49 de             	cmovns %esi,%ebx
+  8046a9:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046ad:	ff 74 24 0c          	push   0xc(%esp)
+  8046b1:	ff 74 24 0c          	push   0xc(%esp)
+  8046b5:	e8 b5 fd ff ff       	call   80446f <udm>
+  8046ba:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046be:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046c2:	f7 d8                	neg    %eax
+  8046c4:	83 d2 00             	adc    $0x0,%edx
+  8046c7:	f7 da                	neg    %edx
+  8046c9:	83 c4 10             	add    $0x10,%esp
+  8046cc:	83 c4 24             	add    $0x24,%esp
+  8046cf:	5b                   	pop    %ebx
+  8046d0:	5e                   	pop    %esi
+  8046d1:	5f                   	pop    %edi
+  8046d2:	5d                   	pop    %ebp
+  8046d3:	c3                   	ret
@@ -0,0 +1,10132 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b0 05 00 00       	call   8005e1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 7f 54 80 00       	push   $0x80547f
+  800049:	68 80 4c 80 00       	push   $0x804c80
+  80004e:	e8 0c 07 00 00       	call   80075f <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 90 4c 80 00       	push   $0x804c90
+  80005c:	68 94 4c 80 00       	push   $0x804c94
+  800061:	e8 f9 06 00 00       	call   80075f <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 a8 4c 80 00       	push   $0x804ca8
+  80007b:	e8 df 06 00 00       	call   80075f <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 b2 4c 80 00       	push   $0x804cb2
+  800093:	68 94 4c 80 00       	push   $0x804c94
+  800098:	e8 c2 06 00 00       	call   80075f <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 a8 4c 80 00       	push   $0x804ca8
+  8000b4:	e8 a6 06 00 00       	call   80075f <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 b6 4c 80 00       	push   $0x804cb6
+  8000cc:	68 94 4c 80 00       	push   $0x804c94
+  8000d1:	e8 89 06 00 00       	call   80075f <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 a8 4c 80 00       	push   $0x804ca8
+  8000ed:	e8 6d 06 00 00       	call   80075f <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 ba 4c 80 00       	push   $0x804cba
+  800105:	68 94 4c 80 00       	push   $0x804c94
+  80010a:	e8 50 06 00 00       	call   80075f <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 a8 4c 80 00       	push   $0x804ca8
+  800126:	e8 34 06 00 00       	call   80075f <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 be 4c 80 00       	push   $0x804cbe
+  80013e:	68 94 4c 80 00       	push   $0x804c94
+  800143:	e8 17 06 00 00       	call   80075f <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 a8 4c 80 00       	push   $0x804ca8
+  80015f:	e8 fb 05 00 00       	call   80075f <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 c2 4c 80 00       	push   $0x804cc2
+  800177:	68 94 4c 80 00       	push   $0x804c94
+  80017c:	e8 de 05 00 00       	call   80075f <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 a8 4c 80 00       	push   $0x804ca8
+  800198:	e8 c2 05 00 00       	call   80075f <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 c6 4c 80 00       	push   $0x804cc6
+  8001b0:	68 94 4c 80 00       	push   $0x804c94
+  8001b5:	e8 a5 05 00 00       	call   80075f <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 a8 4c 80 00       	push   $0x804ca8
+  8001d1:	e8 89 05 00 00       	call   80075f <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ca 4c 80 00       	push   $0x804cca
+  8001e9:	68 94 4c 80 00       	push   $0x804c94
+  8001ee:	e8 6c 05 00 00       	call   80075f <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 a8 4c 80 00       	push   $0x804ca8
+  80020a:	e8 50 05 00 00       	call   80075f <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ce 4c 80 00       	push   $0x804cce
+  800222:	68 94 4c 80 00       	push   $0x804c94
+  800227:	e8 33 05 00 00       	call   80075f <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 a8 4c 80 00       	push   $0x804ca8
+  800243:	e8 17 05 00 00       	call   80075f <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 d5 4c 80 00       	push   $0x804cd5
+  800253:	68 94 4c 80 00       	push   $0x804c94
+  800258:	e8 02 05 00 00       	call   80075f <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 a8 4c 80 00       	push   $0x804ca8
+  800274:	e8 e6 04 00 00       	call   80075f <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 d9 4c 80 00       	push   $0x804cd9
+  800284:	e8 d6 04 00 00       	call   80075f <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 a8 4c 80 00       	push   $0x804ca8
+  800294:	e8 c6 04 00 00       	call   80075f <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 a4 4c 80 00       	push   $0x804ca4
+  8002a9:	e8 b1 04 00 00       	call   80075f <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 a4 4c 80 00       	push   $0x804ca4
+  8002c3:	e8 97 04 00 00       	call   80075f <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 a4 4c 80 00       	push   $0x804ca4
+  8002d8:	e8 82 04 00 00       	call   80075f <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 a4 4c 80 00       	push   $0x804ca4
+  8002ed:	e8 6d 04 00 00       	call   80075f <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 a4 4c 80 00       	push   $0x804ca4
+  800302:	e8 58 04 00 00       	call   80075f <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 a4 4c 80 00       	push   $0x804ca4
+  800317:	e8 43 04 00 00       	call   80075f <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 a4 4c 80 00       	push   $0x804ca4
+  80032c:	e8 2e 04 00 00       	call   80075f <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 a4 4c 80 00       	push   $0x804ca4
+  800341:	e8 19 04 00 00       	call   80075f <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 a4 4c 80 00       	push   $0x804ca4
+  800356:	e8 04 04 00 00       	call   80075f <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 d5 4c 80 00       	push   $0x804cd5
+  800366:	68 94 4c 80 00       	push   $0x804c94
+  80036b:	e8 ef 03 00 00       	call   80075f <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 a4 4c 80 00       	push   $0x804ca4
+  800387:	e8 d3 03 00 00       	call   80075f <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 d9 4c 80 00       	push   $0x804cd9
+  800397:	e8 c3 03 00 00       	call   80075f <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 a4 4c 80 00       	push   $0x804ca4
+  8003af:	e8 ab 03 00 00       	call   80075f <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 a4 4c 80 00       	push   $0x804ca4
+  8003c7:	e8 93 03 00 00       	call   80075f <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 d9 4c 80 00       	push   $0x804cd9
+  8003d7:	e8 83 03 00 00       	call   80075f <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a3 00 00 00    	jne    80049e <pgfault+0xba>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 70 80 00    	mov    %edx,0x807040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 70 80 00    	mov    %edx,0x807044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 70 80 00    	mov    %edx,0x807048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 70 80 00    	mov    %edx,0x80704c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 70 80 00    	mov    %edx,0x807050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 70 80 00    	mov    %edx,0x807054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 70 80 00    	mov    %edx,0x807058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 70 80 00    	mov    %edx,0x80705c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 70 80 00    	mov    %edx,0x807060
+	during.eflags = utf->utf_eflags & ~FL_RF;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	81 e2 ff ff fe ff    	and    $0xfffeffff,%edx
+  800455:	89 15 64 70 80 00    	mov    %edx,0x807064
+	during.esp = utf->utf_esp;
+  80045b:	8b 40 30             	mov    0x30(%eax),%eax
+  80045e:	a3 68 70 80 00       	mov    %eax,0x807068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	68 ff 4c 80 00       	push   $0x804cff
+  80046b:	68 0d 4d 80 00       	push   $0x804d0d
+  800470:	b9 40 70 80 00       	mov    $0x807040,%ecx
+  800475:	ba f8 4c 80 00       	mov    $0x804cf8,%edx
+  80047a:	b8 80 70 80 00       	mov    $0x807080,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800484:	83 c4 0c             	add    $0xc,%esp
+  800487:	6a 07                	push   $0x7
+  800489:	68 00 00 40 00       	push   $0x400000
+  80048e:	6a 00                	push   $0x0
+  800490:	e8 ec 0c 00 00       	call   801181 <sys_page_alloc>
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	78 1a                	js     8004b6 <pgfault+0xd2>
+		panic("sys_page_alloc: %e", r);
+}
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	ff 70 28             	push   0x28(%eax)
+  8004a4:	52                   	push   %edx
+  8004a5:	68 40 4d 80 00       	push   $0x804d40
+  8004aa:	6a 50                	push   $0x50
+  8004ac:	68 e7 4c 80 00       	push   $0x804ce7
+  8004b1:	e8 ce 01 00 00       	call   800684 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b6:	50                   	push   %eax
+  8004b7:	68 14 4d 80 00       	push   $0x804d14
+  8004bc:	6a 5c                	push   $0x5c
+  8004be:	68 e7 4c 80 00       	push   $0x804ce7
+  8004c3:	e8 bc 01 00 00       	call   800684 <_panic>
+
+008004c8 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004ce:	68 e4 03 80 00       	push   $0x8003e4
+  8004d3:	e8 4b 11 00 00       	call   801623 <set_pgfault_handler>
+
+	asm volatile(
+  8004d8:	50                   	push   %eax
+  8004d9:	9c                   	pushf
+  8004da:	58                   	pop    %eax
+  8004db:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	9d                   	popf
+  8004e2:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  8004e7:	8d 05 22 05 80 00    	lea    0x800522,%eax
+  8004ed:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  8004f2:	58                   	pop    %eax
+  8004f3:	89 3d 80 70 80 00    	mov    %edi,0x807080
+  8004f9:	89 35 84 70 80 00    	mov    %esi,0x807084
+  8004ff:	89 2d 88 70 80 00    	mov    %ebp,0x807088
+  800505:	89 1d 90 70 80 00    	mov    %ebx,0x807090
+  80050b:	89 15 94 70 80 00    	mov    %edx,0x807094
+  800511:	89 0d 98 70 80 00    	mov    %ecx,0x807098
+  800517:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  80051c:	89 25 a8 70 80 00    	mov    %esp,0x8070a8
+  800522:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800529:	00 00 00 
+  80052c:	89 3d 00 70 80 00    	mov    %edi,0x807000
+  800532:	89 35 04 70 80 00    	mov    %esi,0x807004
+  800538:	89 2d 08 70 80 00    	mov    %ebp,0x807008
+  80053e:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+  800544:	89 15 14 70 80 00    	mov    %edx,0x807014
+  80054a:	89 0d 18 70 80 00    	mov    %ecx,0x807018
+  800550:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  800555:	89 25 28 70 80 00    	mov    %esp,0x807028
+  80055b:	8b 3d 80 70 80 00    	mov    0x807080,%edi
+  800561:	8b 35 84 70 80 00    	mov    0x807084,%esi
+  800567:	8b 2d 88 70 80 00    	mov    0x807088,%ebp
+  80056d:	8b 1d 90 70 80 00    	mov    0x807090,%ebx
+  800573:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  800579:	8b 0d 98 70 80 00    	mov    0x807098,%ecx
+  80057f:	a1 9c 70 80 00       	mov    0x80709c,%eax
+  800584:	8b 25 a8 70 80 00    	mov    0x8070a8,%esp
+  80058a:	50                   	push   %eax
+  80058b:	9c                   	pushf
+  80058c:	58                   	pop    %eax
+  80058d:	a3 24 70 80 00       	mov    %eax,0x807024
+  800592:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059d:	75 30                	jne    8005cf <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059f:	a1 a0 70 80 00       	mov    0x8070a0,%eax
+  8005a4:	a3 20 70 80 00       	mov    %eax,0x807020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	68 27 4d 80 00       	push   $0x804d27
+  8005b1:	68 38 4d 80 00       	push   $0x804d38
+  8005b6:	b9 00 70 80 00       	mov    $0x807000,%ecx
+  8005bb:	ba f8 4c 80 00       	mov    $0x804cf8,%edx
+  8005c0:	b8 80 70 80 00       	mov    $0x807080,%eax
+  8005c5:	e8 69 fa ff ff       	call   800033 <check_regs>
+}
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cf:	83 ec 0c             	sub    $0xc,%esp
+  8005d2:	68 74 4d 80 00       	push   $0x804d74
+  8005d7:	e8 83 01 00 00       	call   80075f <cprintf>
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	eb be                	jmp    80059f <umain+0xd7>
+
+008005e1 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	57                   	push   %edi
+  8005e5:	56                   	push   %esi
+  8005e6:	53                   	push   %ebx
+  8005e7:	83 ec 1c             	sub    $0x1c,%esp
+  8005ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8005f0:	e8 34 0b 00 00       	call   801129 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8005f5:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8005f8:	89 15 60 73 80 00    	mov    %edx,0x807360
+	thisenv = &envs[ENVX(eid)];
+  8005fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800603:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800605:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800607:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80060d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800612:	77 16                	ja     80062a <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800614:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800619:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80061b:	c1 e8 10             	shr    $0x10,%eax
+  80061e:	74 0a                	je     80062a <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800620:	c1 e0 10             	shl    $0x10,%eax
+  800623:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800628:	29 c2                	sub    %eax,%edx
+  80062a:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80062d:	c1 e0 04             	shl    $0x4,%eax
+  800630:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800635:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800637:	85 db                	test   %ebx,%ebx
+  800639:	7e 07                	jle    800642 <libmain+0x61>
+		binaryname = argv[0];
+  80063b:	8b 06                	mov    (%esi),%eax
+  80063d:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	56                   	push   %esi
+  800646:	53                   	push   %ebx
+  800647:	e8 7c fe ff ff       	call   8004c8 <umain>
+
+	// exit gracefully
+	exit();
+  80064c:	e8 0b 00 00 00       	call   80065c <exit>
+}
+  800651:	83 c4 10             	add    $0x10,%esp
+  800654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800657:	5b                   	pop    %ebx
+  800658:	5e                   	pop    %esi
+  800659:	5f                   	pop    %edi
+  80065a:	5d                   	pop    %ebp
+  80065b:	c3                   	ret
+
+0080065c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80065c:	55                   	push   %ebp
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800662:	6a 00                	push   $0x0
+  800664:	e8 79 21 00 00       	call   8027e2 <fflush>
+	pthread_kill_others();
+  800669:	e8 e4 37 00 00       	call   803e52 <pthread_kill_others>
+	close_all();
+  80066e:	e8 12 12 00 00       	call   801885 <close_all>
+	sys_env_destroy(0);
+  800673:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80067a:	e8 5f 0a 00 00       	call   8010de <sys_env_destroy>
+}
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	c9                   	leave
+  800683:	c3                   	ret
+
+00800684 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800684:	55                   	push   %ebp
+  800685:	89 e5                	mov    %esp,%ebp
+  800687:	56                   	push   %esi
+  800688:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800689:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80068c:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800692:	e8 92 0a 00 00       	call   801129 <sys_getenvid>
+  800697:	83 ec 0c             	sub    $0xc,%esp
+  80069a:	ff 75 0c             	push   0xc(%ebp)
+  80069d:	ff 75 08             	push   0x8(%ebp)
+  8006a0:	56                   	push   %esi
+  8006a1:	50                   	push   %eax
+  8006a2:	68 a0 4d 80 00       	push   $0x804da0
+  8006a7:	e8 b3 00 00 00       	call   80075f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006ac:	83 c4 18             	add    $0x18,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	ff 75 10             	push   0x10(%ebp)
+  8006b3:	e8 56 00 00 00       	call   80070e <vcprintf>
+	cprintf("\n");
+  8006b8:	c7 04 24 7e 54 80 00 	movl   $0x80547e,(%esp)
+  8006bf:	e8 9b 00 00 00       	call   80075f <cprintf>
+  8006c4:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006c7:	cc                   	int3
+	while (1)
+  8006c8:	eb fd                	jmp    8006c7 <_panic+0x43>
+
+008006ca <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	53                   	push   %ebx
+  8006ce:	83 ec 04             	sub    $0x4,%esp
+  8006d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006d4:	8b 13                	mov    (%ebx),%edx
+  8006d6:	8d 42 01             	lea    0x1(%edx),%eax
+  8006d9:	89 03                	mov    %eax,(%ebx)
+  8006db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006de:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006e2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006e7:	74 09                	je     8006f2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006e9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006f0:	c9                   	leave
+  8006f1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	68 ff 00 00 00       	push   $0xff
+  8006fa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006fd:	50                   	push   %eax
+  8006fe:	e8 84 09 00 00       	call   801087 <sys_cputs>
+		b->idx = 0;
+  800703:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	eb db                	jmp    8006e9 <putch+0x1f>
+
+0080070e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800717:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80071e:	00 00 00 
+	b.cnt = 0;
+  800721:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800728:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80072b:	ff 75 0c             	push   0xc(%ebp)
+  80072e:	ff 75 08             	push   0x8(%ebp)
+  800731:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800737:	50                   	push   %eax
+  800738:	68 ca 06 80 00       	push   $0x8006ca
+  80073d:	e8 14 01 00 00       	call   800856 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800742:	83 c4 08             	add    $0x8,%esp
+  800745:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80074b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800751:	50                   	push   %eax
+  800752:	e8 30 09 00 00       	call   801087 <sys_cputs>
+
+	return b.cnt;
+}
+  800757:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80075d:	c9                   	leave
+  80075e:	c3                   	ret
+
+0080075f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+  800762:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800765:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800768:	50                   	push   %eax
+  800769:	ff 75 08             	push   0x8(%ebp)
+  80076c:	e8 9d ff ff ff       	call   80070e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+00800773 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	57                   	push   %edi
+  800777:	56                   	push   %esi
+  800778:	53                   	push   %ebx
+  800779:	83 ec 1c             	sub    $0x1c,%esp
+  80077c:	89 c7                	mov    %eax,%edi
+  80077e:	89 d6                	mov    %edx,%esi
+  800780:	8b 45 08             	mov    0x8(%ebp),%eax
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800786:	89 d1                	mov    %edx,%ecx
+  800788:	89 c2                	mov    %eax,%edx
+  80078a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80078d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800790:	8b 45 10             	mov    0x10(%ebp),%eax
+  800793:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800796:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800799:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8007a0:	39 c2                	cmp    %eax,%edx
+  8007a2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8007a5:	72 3e                	jb     8007e5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007a7:	83 ec 0c             	sub    $0xc,%esp
+  8007aa:	ff 75 18             	push   0x18(%ebp)
+  8007ad:	83 eb 01             	sub    $0x1,%ebx
+  8007b0:	53                   	push   %ebx
+  8007b1:	50                   	push   %eax
+  8007b2:	83 ec 08             	sub    $0x8,%esp
+  8007b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b8:	ff 75 e0             	push   -0x20(%ebp)
+  8007bb:	ff 75 dc             	push   -0x24(%ebp)
+  8007be:	ff 75 d8             	push   -0x28(%ebp)
+  8007c1:	e8 21 43 00 00       	call   804ae7 <__udivdi3>
+  8007c6:	83 c4 18             	add    $0x18,%esp
+  8007c9:	52                   	push   %edx
+  8007ca:	50                   	push   %eax
+  8007cb:	89 f2                	mov    %esi,%edx
+  8007cd:	89 f8                	mov    %edi,%eax
+  8007cf:	e8 9f ff ff ff       	call   800773 <printnum>
+  8007d4:	83 c4 20             	add    $0x20,%esp
+  8007d7:	eb 13                	jmp    8007ec <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	56                   	push   %esi
+  8007dd:	ff 75 18             	push   0x18(%ebp)
+  8007e0:	ff d7                	call   *%edi
+  8007e2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007e5:	83 eb 01             	sub    $0x1,%ebx
+  8007e8:	85 db                	test   %ebx,%ebx
+  8007ea:	7f ed                	jg     8007d9 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	56                   	push   %esi
+  8007f0:	83 ec 04             	sub    $0x4,%esp
+  8007f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007f6:	ff 75 e0             	push   -0x20(%ebp)
+  8007f9:	ff 75 dc             	push   -0x24(%ebp)
+  8007fc:	ff 75 d8             	push   -0x28(%ebp)
+  8007ff:	e8 04 43 00 00       	call   804b08 <__umoddi3>
+  800804:	83 c4 14             	add    $0x14,%esp
+  800807:	0f be 80 c3 4d 80 00 	movsbl 0x804dc3(%eax),%eax
+  80080e:	50                   	push   %eax
+  80080f:	ff d7                	call   *%edi
+}
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800817:	5b                   	pop    %ebx
+  800818:	5e                   	pop    %esi
+  800819:	5f                   	pop    %edi
+  80081a:	5d                   	pop    %ebp
+  80081b:	c3                   	ret
+
+0080081c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80081c:	55                   	push   %ebp
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800822:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800826:	8b 10                	mov    (%eax),%edx
+  800828:	3b 50 04             	cmp    0x4(%eax),%edx
+  80082b:	73 0a                	jae    800837 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80082d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800830:	89 08                	mov    %ecx,(%eax)
+  800832:	8b 45 08             	mov    0x8(%ebp),%eax
+  800835:	88 02                	mov    %al,(%edx)
+}
+  800837:	5d                   	pop    %ebp
+  800838:	c3                   	ret
+
+00800839 <printfmt>:
+{
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80083f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800842:	50                   	push   %eax
+  800843:	ff 75 10             	push   0x10(%ebp)
+  800846:	ff 75 0c             	push   0xc(%ebp)
+  800849:	ff 75 08             	push   0x8(%ebp)
+  80084c:	e8 05 00 00 00       	call   800856 <vprintfmt>
+}
+  800851:	83 c4 10             	add    $0x10,%esp
+  800854:	c9                   	leave
+  800855:	c3                   	ret
+
+00800856 <vprintfmt>:
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	57                   	push   %edi
+  80085a:	56                   	push   %esi
+  80085b:	53                   	push   %ebx
+  80085c:	83 ec 2c             	sub    $0x2c,%esp
+  80085f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800862:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800865:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800868:	eb 0a                	jmp    800874 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80086a:	83 ec 08             	sub    $0x8,%esp
+  80086d:	53                   	push   %ebx
+  80086e:	50                   	push   %eax
+  80086f:	ff d6                	call   *%esi
+  800871:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800874:	83 c7 01             	add    $0x1,%edi
+  800877:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80087b:	83 f8 25             	cmp    $0x25,%eax
+  80087e:	74 0c                	je     80088c <vprintfmt+0x36>
+			if (ch == '\0')
+  800880:	85 c0                	test   %eax,%eax
+  800882:	75 e6                	jne    80086a <vprintfmt+0x14>
+}
+  800884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800887:	5b                   	pop    %ebx
+  800888:	5e                   	pop    %esi
+  800889:	5f                   	pop    %edi
+  80088a:	5d                   	pop    %ebp
+  80088b:	c3                   	ret
+		padc = ' ';
+  80088c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800890:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800897:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80089e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8008a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8008aa:	8d 47 01             	lea    0x1(%edi),%eax
+  8008ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b0:	0f b6 17             	movzbl (%edi),%edx
+  8008b3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8008b6:	3c 55                	cmp    $0x55,%al
+  8008b8:	0f 87 c5 03 00 00    	ja     800c83 <vprintfmt+0x42d>
+  8008be:	0f b6 c0             	movzbl %al,%eax
+  8008c1:	ff 24 85 40 4f 80 00 	jmp    *0x804f40(,%eax,4)
+  8008c8:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8008cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008ce:	eb da                	jmp    8008aa <vprintfmt+0x54>
+  8008d0:	0f be d2             	movsbl %dl,%edx
+  8008d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008de:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008e1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008e5:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008e8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008eb:	83 f9 09             	cmp    $0x9,%ecx
+  8008ee:	77 55                	ja     800945 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8008f0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008f3:	eb e9                	jmp    8008de <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8008f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f8:	8b 00                	mov    (%eax),%eax
+  8008fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800900:	8d 40 04             	lea    0x4(%eax),%eax
+  800903:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800906:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800909:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80090d:	79 9b                	jns    8008aa <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80090f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800912:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800915:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80091c:	eb 8c                	jmp    8008aa <vprintfmt+0x54>
+			if (width < 0)
+  80091e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800921:	85 d2                	test   %edx,%edx
+  800923:	b8 00 00 00 00       	mov    $0x0,%eax
+  800928:	0f 49 c2             	cmovns %edx,%eax
+  80092b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80092e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800931:	e9 74 ff ff ff       	jmp    8008aa <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800936:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800939:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800940:	e9 65 ff ff ff       	jmp    8008aa <vprintfmt+0x54>
+  800945:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800948:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80094b:	eb bc                	jmp    800909 <vprintfmt+0xb3>
+			lflag++;
+  80094d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800950:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800953:	e9 52 ff ff ff       	jmp    8008aa <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8d 78 04             	lea    0x4(%eax),%edi
+  80095e:	83 ec 08             	sub    $0x8,%esp
+  800961:	53                   	push   %ebx
+  800962:	ff 30                	push   (%eax)
+  800964:	ff d6                	call   *%esi
+			break;
+  800966:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800969:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80096c:	e9 b1 02 00 00       	jmp    800c22 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800977:	8b 10                	mov    (%eax),%edx
+  800979:	89 d0                	mov    %edx,%eax
+  80097b:	f7 d8                	neg    %eax
+  80097d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800980:	83 f8 14             	cmp    $0x14,%eax
+  800983:	7f 23                	jg     8009a8 <vprintfmt+0x152>
+  800985:	8b 14 85 a0 50 80 00 	mov    0x8050a0(,%eax,4),%edx
+  80098c:	85 d2                	test   %edx,%edx
+  80098e:	74 18                	je     8009a8 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800990:	52                   	push   %edx
+  800991:	68 0f 52 80 00       	push   $0x80520f
+  800996:	53                   	push   %ebx
+  800997:	56                   	push   %esi
+  800998:	e8 9c fe ff ff       	call   800839 <printfmt>
+  80099d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009a0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8009a3:	e9 7a 02 00 00       	jmp    800c22 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8009a8:	50                   	push   %eax
+  8009a9:	68 db 4d 80 00       	push   $0x804ddb
+  8009ae:	53                   	push   %ebx
+  8009af:	56                   	push   %esi
+  8009b0:	e8 84 fe ff ff       	call   800839 <printfmt>
+  8009b5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009b8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009bb:	e9 62 02 00 00       	jmp    800c22 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	83 c0 04             	add    $0x4,%eax
+  8009c6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8009ce:	85 c9                	test   %ecx,%ecx
+  8009d0:	b8 d4 4d 80 00       	mov    $0x804dd4,%eax
+  8009d5:	0f 45 c1             	cmovne %ecx,%eax
+  8009d8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009db:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009df:	7e 06                	jle    8009e7 <vprintfmt+0x191>
+  8009e1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009e5:	75 0b                	jne    8009f2 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009ea:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009ed:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009f0:	eb 5c                	jmp    800a4e <vprintfmt+0x1f8>
+  8009f2:	83 ec 08             	sub    $0x8,%esp
+  8009f5:	ff 75 d0             	push   -0x30(%ebp)
+  8009f8:	ff 75 cc             	push   -0x34(%ebp)
+  8009fb:	e8 20 03 00 00       	call   800d20 <strnlen>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a05:	29 d0                	sub    %edx,%eax
+  800a07:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a0a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a0e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a11:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a14:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a16:	eb 0e                	jmp    800a26 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800a18:	83 ec 08             	sub    $0x8,%esp
+  800a1b:	53                   	push   %ebx
+  800a1c:	57                   	push   %edi
+  800a1d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a20:	83 ee 01             	sub    $0x1,%esi
+  800a23:	83 c4 10             	add    $0x10,%esp
+  800a26:	85 f6                	test   %esi,%esi
+  800a28:	7f ee                	jg     800a18 <vprintfmt+0x1c2>
+  800a2a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a2d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a37:	0f 49 d0             	cmovns %eax,%edx
+  800a3a:	29 d0                	sub    %edx,%eax
+  800a3c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a3f:	eb a6                	jmp    8009e7 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800a41:	83 ec 08             	sub    $0x8,%esp
+  800a44:	53                   	push   %ebx
+  800a45:	52                   	push   %edx
+  800a46:	ff 55 08             	call   *0x8(%ebp)
+  800a49:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a4c:	89 f1                	mov    %esi,%ecx
+  800a4e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a51:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a55:	0f be d0             	movsbl %al,%edx
+  800a58:	85 d2                	test   %edx,%edx
+  800a5a:	74 28                	je     800a84 <vprintfmt+0x22e>
+  800a5c:	85 ff                	test   %edi,%edi
+  800a5e:	78 05                	js     800a65 <vprintfmt+0x20f>
+  800a60:	83 ef 01             	sub    $0x1,%edi
+  800a63:	78 30                	js     800a95 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a65:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a69:	74 d6                	je     800a41 <vprintfmt+0x1eb>
+  800a6b:	0f be c0             	movsbl %al,%eax
+  800a6e:	83 e8 20             	sub    $0x20,%eax
+  800a71:	83 f8 5e             	cmp    $0x5e,%eax
+  800a74:	76 cb                	jbe    800a41 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800a76:	83 ec 08             	sub    $0x8,%esp
+  800a79:	53                   	push   %ebx
+  800a7a:	6a 3f                	push   $0x3f
+  800a7c:	ff 55 08             	call   *0x8(%ebp)
+  800a7f:	83 c4 10             	add    $0x10,%esp
+  800a82:	eb c8                	jmp    800a4c <vprintfmt+0x1f6>
+  800a84:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a87:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a8a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a8d:	01 d0                	add    %edx,%eax
+  800a8f:	29 c8                	sub    %ecx,%eax
+  800a91:	89 c7                	mov    %eax,%edi
+  800a93:	eb 13                	jmp    800aa8 <vprintfmt+0x252>
+  800a95:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a98:	eb ed                	jmp    800a87 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800a9a:	83 ec 08             	sub    $0x8,%esp
+  800a9d:	53                   	push   %ebx
+  800a9e:	6a 20                	push   $0x20
+  800aa0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800aa2:	83 ef 01             	sub    $0x1,%edi
+  800aa5:	83 c4 10             	add    $0x10,%esp
+  800aa8:	85 ff                	test   %edi,%edi
+  800aaa:	7f ee                	jg     800a9a <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800aac:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800aaf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ab2:	e9 6b 01 00 00       	jmp    800c22 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800ab7:	83 f9 01             	cmp    $0x1,%ecx
+  800aba:	7f 1f                	jg     800adb <vprintfmt+0x285>
+	else if (lflag)
+  800abc:	85 c9                	test   %ecx,%ecx
+  800abe:	74 67                	je     800b27 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800ac0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac3:	8b 00                	mov    (%eax),%eax
+  800ac5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ac8:	89 c1                	mov    %eax,%ecx
+  800aca:	c1 f9 1f             	sar    $0x1f,%ecx
+  800acd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ad0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad9:	eb 17                	jmp    800af2 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800adb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ade:	8b 50 04             	mov    0x4(%eax),%edx
+  800ae1:	8b 00                	mov    (%eax),%eax
+  800ae3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ae6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ae9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aec:	8d 40 08             	lea    0x8(%eax),%eax
+  800aef:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800af2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800af5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800af8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800afd:	85 c9                	test   %ecx,%ecx
+  800aff:	0f 89 03 01 00 00    	jns    800c08 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800b05:	83 ec 08             	sub    $0x8,%esp
+  800b08:	53                   	push   %ebx
+  800b09:	6a 2d                	push   $0x2d
+  800b0b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b0d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b10:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b13:	f7 da                	neg    %edx
+  800b15:	83 d1 00             	adc    $0x0,%ecx
+  800b18:	f7 d9                	neg    %ecx
+  800b1a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b1d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b22:	e9 e1 00 00 00       	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2a:	8b 00                	mov    (%eax),%eax
+  800b2c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b2f:	89 c1                	mov    %eax,%ecx
+  800b31:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b34:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b37:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b40:	eb b0                	jmp    800af2 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800b42:	83 f9 01             	cmp    $0x1,%ecx
+  800b45:	7f 1e                	jg     800b65 <vprintfmt+0x30f>
+	else if (lflag)
+  800b47:	85 c9                	test   %ecx,%ecx
+  800b49:	74 32                	je     800b7d <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800b4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4e:	8b 10                	mov    (%eax),%edx
+  800b50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b55:	8d 40 04             	lea    0x4(%eax),%eax
+  800b58:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b5b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b60:	e9 a3 00 00 00       	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800b65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b68:	8b 10                	mov    (%eax),%edx
+  800b6a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b6d:	8d 40 08             	lea    0x8(%eax),%eax
+  800b70:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b73:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b78:	e9 8b 00 00 00       	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800b7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b80:	8b 10                	mov    (%eax),%edx
+  800b82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b87:	8d 40 04             	lea    0x4(%eax),%eax
+  800b8a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b8d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b92:	eb 74                	jmp    800c08 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800b94:	83 f9 01             	cmp    $0x1,%ecx
+  800b97:	7f 1b                	jg     800bb4 <vprintfmt+0x35e>
+	else if (lflag)
+  800b99:	85 c9                	test   %ecx,%ecx
+  800b9b:	74 2c                	je     800bc9 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800b9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba0:	8b 10                	mov    (%eax),%edx
+  800ba2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba7:	8d 40 04             	lea    0x4(%eax),%eax
+  800baa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bad:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800bb2:	eb 54                	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800bb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb7:	8b 10                	mov    (%eax),%edx
+  800bb9:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bbc:	8d 40 08             	lea    0x8(%eax),%eax
+  800bbf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bc2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800bc7:	eb 3f                	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800bc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcc:	8b 10                	mov    (%eax),%edx
+  800bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd3:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bd9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800bde:	eb 28                	jmp    800c08 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800be0:	83 ec 08             	sub    $0x8,%esp
+  800be3:	53                   	push   %ebx
+  800be4:	6a 30                	push   $0x30
+  800be6:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800be8:	83 c4 08             	add    $0x8,%esp
+  800beb:	53                   	push   %ebx
+  800bec:	6a 78                	push   $0x78
+  800bee:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800bf0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf3:	8b 10                	mov    (%eax),%edx
+  800bf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bfa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bfd:	8d 40 04             	lea    0x4(%eax),%eax
+  800c00:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c03:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  800c0b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c0f:	50                   	push   %eax
+  800c10:	ff 75 e0             	push   -0x20(%ebp)
+  800c13:	57                   	push   %edi
+  800c14:	51                   	push   %ecx
+  800c15:	52                   	push   %edx
+  800c16:	89 da                	mov    %ebx,%edx
+  800c18:	89 f0                	mov    %esi,%eax
+  800c1a:	e8 54 fb ff ff       	call   800773 <printnum>
+			break;
+  800c1f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800c22:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800c25:	e9 4a fc ff ff       	jmp    800874 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800c2a:	83 f9 01             	cmp    $0x1,%ecx
+  800c2d:	7f 1b                	jg     800c4a <vprintfmt+0x3f4>
+	else if (lflag)
+  800c2f:	85 c9                	test   %ecx,%ecx
+  800c31:	74 2c                	je     800c5f <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800c33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c36:	8b 10                	mov    (%eax),%edx
+  800c38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c43:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c48:	eb be                	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800c4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c4d:	8b 10                	mov    (%eax),%edx
+  800c4f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c52:	8d 40 08             	lea    0x8(%eax),%eax
+  800c55:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c58:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c5d:	eb a9                	jmp    800c08 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800c5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c62:	8b 10                	mov    (%eax),%edx
+  800c64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c69:	8d 40 04             	lea    0x4(%eax),%eax
+  800c6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c6f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c74:	eb 92                	jmp    800c08 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800c76:	83 ec 08             	sub    $0x8,%esp
+  800c79:	53                   	push   %ebx
+  800c7a:	6a 25                	push   $0x25
+  800c7c:	ff d6                	call   *%esi
+			break;
+  800c7e:	83 c4 10             	add    $0x10,%esp
+  800c81:	eb 9f                	jmp    800c22 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800c83:	83 ec 08             	sub    $0x8,%esp
+  800c86:	53                   	push   %ebx
+  800c87:	6a 25                	push   $0x25
+  800c89:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c8b:	83 c4 10             	add    $0x10,%esp
+  800c8e:	89 f8                	mov    %edi,%eax
+  800c90:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c94:	74 05                	je     800c9b <vprintfmt+0x445>
+  800c96:	83 e8 01             	sub    $0x1,%eax
+  800c99:	eb f5                	jmp    800c90 <vprintfmt+0x43a>
+  800c9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c9e:	eb 82                	jmp    800c22 <vprintfmt+0x3cc>
+
+00800ca0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	83 ec 18             	sub    $0x18,%esp
+  800ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800cac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800caf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800cb3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800cb6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	74 26                	je     800ce7 <vsnprintf+0x47>
+  800cc1:	85 d2                	test   %edx,%edx
+  800cc3:	7e 22                	jle    800ce7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800cc5:	ff 75 14             	push   0x14(%ebp)
+  800cc8:	ff 75 10             	push   0x10(%ebp)
+  800ccb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800cce:	50                   	push   %eax
+  800ccf:	68 1c 08 80 00       	push   $0x80081c
+  800cd4:	e8 7d fb ff ff       	call   800856 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800cd9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800cdc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800cdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ce2:	83 c4 10             	add    $0x10,%esp
+}
+  800ce5:	c9                   	leave
+  800ce6:	c3                   	ret
+		return -E_INVAL;
+  800ce7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cec:	eb f7                	jmp    800ce5 <vsnprintf+0x45>
+
+00800cee <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cf4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cf7:	50                   	push   %eax
+  800cf8:	ff 75 10             	push   0x10(%ebp)
+  800cfb:	ff 75 0c             	push   0xc(%ebp)
+  800cfe:	ff 75 08             	push   0x8(%ebp)
+  800d01:	e8 9a ff ff ff       	call   800ca0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d06:	c9                   	leave
+  800d07:	c3                   	ret
+
+00800d08 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	eb 03                	jmp    800d18 <strlen+0x10>
+		n++;
+  800d15:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d18:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d1c:	75 f7                	jne    800d15 <strlen+0xd>
+	return n;
+}
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+
+00800d20 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	eb 03                	jmp    800d33 <strnlen+0x13>
+		n++;
+  800d30:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d33:	39 d0                	cmp    %edx,%eax
+  800d35:	74 08                	je     800d3f <strnlen+0x1f>
+  800d37:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d3b:	75 f3                	jne    800d30 <strnlen+0x10>
+  800d3d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d3f:	89 d0                	mov    %edx,%eax
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	53                   	push   %ebx
+  800d47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d52:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d56:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d59:	83 c0 01             	add    $0x1,%eax
+  800d5c:	84 d2                	test   %dl,%dl
+  800d5e:	75 f2                	jne    800d52 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d60:	89 c8                	mov    %ecx,%eax
+  800d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d65:	c9                   	leave
+  800d66:	c3                   	ret
+
+00800d67 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	53                   	push   %ebx
+  800d6b:	83 ec 10             	sub    $0x10,%esp
+  800d6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d71:	53                   	push   %ebx
+  800d72:	e8 91 ff ff ff       	call   800d08 <strlen>
+  800d77:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d7a:	ff 75 0c             	push   0xc(%ebp)
+  800d7d:	01 d8                	add    %ebx,%eax
+  800d7f:	50                   	push   %eax
+  800d80:	e8 be ff ff ff       	call   800d43 <strcpy>
+	return dst;
+}
+  800d85:	89 d8                	mov    %ebx,%eax
+  800d87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d8a:	c9                   	leave
+  800d8b:	c3                   	ret
+
+00800d8c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d94:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d97:	89 f3                	mov    %esi,%ebx
+  800d99:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d9c:	89 f0                	mov    %esi,%eax
+  800d9e:	eb 0f                	jmp    800daf <strncpy+0x23>
+		*dst++ = *src;
+  800da0:	83 c0 01             	add    $0x1,%eax
+  800da3:	0f b6 0a             	movzbl (%edx),%ecx
+  800da6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800da9:	80 f9 01             	cmp    $0x1,%cl
+  800dac:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800daf:	39 d8                	cmp    %ebx,%eax
+  800db1:	75 ed                	jne    800da0 <strncpy+0x14>
+	}
+	return ret;
+}
+  800db3:	89 f0                	mov    %esi,%eax
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5d                   	pop    %ebp
+  800db8:	c3                   	ret
+
+00800db9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800dc7:	89 f0                	mov    %esi,%eax
+  800dc9:	85 d2                	test   %edx,%edx
+  800dcb:	74 21                	je     800dee <strlcpy+0x35>
+  800dcd:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800dd1:	89 f2                	mov    %esi,%edx
+  800dd3:	eb 09                	jmp    800dde <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800dd5:	83 c1 01             	add    $0x1,%ecx
+  800dd8:	83 c2 01             	add    $0x1,%edx
+  800ddb:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800dde:	39 c2                	cmp    %eax,%edx
+  800de0:	74 09                	je     800deb <strlcpy+0x32>
+  800de2:	0f b6 19             	movzbl (%ecx),%ebx
+  800de5:	84 db                	test   %bl,%bl
+  800de7:	75 ec                	jne    800dd5 <strlcpy+0x1c>
+  800de9:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800deb:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800dee:	29 f0                	sub    %esi,%eax
+}
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dfd:	eb 06                	jmp    800e05 <strcmp+0x11>
+		p++, q++;
+  800dff:	83 c1 01             	add    $0x1,%ecx
+  800e02:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e05:	0f b6 01             	movzbl (%ecx),%eax
+  800e08:	84 c0                	test   %al,%al
+  800e0a:	74 04                	je     800e10 <strcmp+0x1c>
+  800e0c:	3a 02                	cmp    (%edx),%al
+  800e0e:	74 ef                	je     800dff <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e10:	0f b6 c0             	movzbl %al,%eax
+  800e13:	0f b6 12             	movzbl (%edx),%edx
+  800e16:	29 d0                	sub    %edx,%eax
+}
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	53                   	push   %ebx
+  800e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e24:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800e27:	eb 09                	jmp    800e32 <strncmp+0x18>
+		n--, p++, q++;
+  800e29:	83 ea 01             	sub    $0x1,%edx
+  800e2c:	83 c0 01             	add    $0x1,%eax
+  800e2f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800e32:	85 d2                	test   %edx,%edx
+  800e34:	74 18                	je     800e4e <strncmp+0x34>
+  800e36:	0f b6 18             	movzbl (%eax),%ebx
+  800e39:	84 db                	test   %bl,%bl
+  800e3b:	74 04                	je     800e41 <strncmp+0x27>
+  800e3d:	3a 19                	cmp    (%ecx),%bl
+  800e3f:	74 e8                	je     800e29 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e41:	0f b6 00             	movzbl (%eax),%eax
+  800e44:	0f b6 11             	movzbl (%ecx),%edx
+  800e47:	29 d0                	sub    %edx,%eax
+}
+  800e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e4c:	c9                   	leave
+  800e4d:	c3                   	ret
+		return 0;
+  800e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e53:	eb f4                	jmp    800e49 <strncmp+0x2f>
+
+00800e55 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e5f:	eb 03                	jmp    800e64 <strchr+0xf>
+  800e61:	83 c0 01             	add    $0x1,%eax
+  800e64:	0f b6 10             	movzbl (%eax),%edx
+  800e67:	84 d2                	test   %dl,%dl
+  800e69:	74 06                	je     800e71 <strchr+0x1c>
+		if (*s == c)
+  800e6b:	38 ca                	cmp    %cl,%dl
+  800e6d:	75 f2                	jne    800e61 <strchr+0xc>
+  800e6f:	eb 05                	jmp    800e76 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+
+00800e78 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e82:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e85:	38 ca                	cmp    %cl,%dl
+  800e87:	74 09                	je     800e92 <strfind+0x1a>
+  800e89:	84 d2                	test   %dl,%dl
+  800e8b:	74 05                	je     800e92 <strfind+0x1a>
+	for (; *s; s++)
+  800e8d:	83 c0 01             	add    $0x1,%eax
+  800e90:	eb f0                	jmp    800e82 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+
+00800e94 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e9e:	85 c9                	test   %ecx,%ecx
+  800ea0:	74 20                	je     800ec2 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ea2:	89 f8                	mov    %edi,%eax
+  800ea4:	09 c8                	or     %ecx,%eax
+  800ea6:	a8 03                	test   $0x3,%al
+  800ea8:	75 12                	jne    800ebc <memset+0x28>
+		c &= 0xFF;
+  800eaa:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800eae:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800eb4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800eb7:	fc                   	cld
+  800eb8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800eba:	eb 06                	jmp    800ec2 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ebc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebf:	fc                   	cld
+  800ec0:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ec2:	89 f8                	mov    %edi,%eax
+  800ec4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ec7:	c9                   	leave
+  800ec8:	c3                   	ret
+
+00800ec9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ed4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ed7:	39 c6                	cmp    %eax,%esi
+  800ed9:	73 32                	jae    800f0d <memmove+0x44>
+  800edb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ede:	39 d0                	cmp    %edx,%eax
+  800ee0:	73 2b                	jae    800f0d <memmove+0x44>
+		s += n;
+		d += n;
+  800ee2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ee5:	89 d6                	mov    %edx,%esi
+  800ee7:	09 fe                	or     %edi,%esi
+  800ee9:	09 ce                	or     %ecx,%esi
+  800eeb:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ef1:	75 0e                	jne    800f01 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ef3:	83 ef 04             	sub    $0x4,%edi
+  800ef6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ef9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800efc:	fd                   	std
+  800efd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eff:	eb 09                	jmp    800f0a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f01:	83 ef 01             	sub    $0x1,%edi
+  800f04:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f07:	fd                   	std
+  800f08:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f0a:	fc                   	cld
+  800f0b:	eb 1a                	jmp    800f27 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f0d:	89 f2                	mov    %esi,%edx
+  800f0f:	09 c2                	or     %eax,%edx
+  800f11:	09 ca                	or     %ecx,%edx
+  800f13:	f6 c2 03             	test   $0x3,%dl
+  800f16:	75 0a                	jne    800f22 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f18:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f1b:	89 c7                	mov    %eax,%edi
+  800f1d:	fc                   	cld
+  800f1e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f20:	eb 05                	jmp    800f27 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f22:	89 c7                	mov    %eax,%edi
+  800f24:	fc                   	cld
+  800f25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f31:	ff 75 10             	push   0x10(%ebp)
+  800f34:	ff 75 0c             	push   0xc(%ebp)
+  800f37:	ff 75 08             	push   0x8(%ebp)
+  800f3a:	e8 8a ff ff ff       	call   800ec9 <memmove>
+}
+  800f3f:	c9                   	leave
+  800f40:	c3                   	ret
+
+00800f41 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f49:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f4c:	89 c6                	mov    %eax,%esi
+  800f4e:	03 75 10             	add    0x10(%ebp),%esi
+  800f51:	eb 06                	jmp    800f59 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f53:	83 c0 01             	add    $0x1,%eax
+  800f56:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f59:	39 f0                	cmp    %esi,%eax
+  800f5b:	74 14                	je     800f71 <memcmp+0x30>
+		if (*s1 != *s2)
+  800f5d:	0f b6 08             	movzbl (%eax),%ecx
+  800f60:	0f b6 1a             	movzbl (%edx),%ebx
+  800f63:	38 d9                	cmp    %bl,%cl
+  800f65:	74 ec                	je     800f53 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f67:	0f b6 c1             	movzbl %cl,%eax
+  800f6a:	0f b6 db             	movzbl %bl,%ebx
+  800f6d:	29 d8                	sub    %ebx,%eax
+  800f6f:	eb 05                	jmp    800f76 <memcmp+0x35>
+	}
+
+	return 0;
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f76:	5b                   	pop    %ebx
+  800f77:	5e                   	pop    %esi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+
+00800f7a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f83:	89 c2                	mov    %eax,%edx
+  800f85:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f88:	eb 03                	jmp    800f8d <memfind+0x13>
+  800f8a:	83 c0 01             	add    $0x1,%eax
+  800f8d:	39 d0                	cmp    %edx,%eax
+  800f8f:	73 04                	jae    800f95 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f91:	38 08                	cmp    %cl,(%eax)
+  800f93:	75 f5                	jne    800f8a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fa3:	eb 03                	jmp    800fa8 <strtol+0x11>
+		s++;
+  800fa5:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fa8:	0f b6 02             	movzbl (%edx),%eax
+  800fab:	3c 20                	cmp    $0x20,%al
+  800fad:	74 f6                	je     800fa5 <strtol+0xe>
+  800faf:	3c 09                	cmp    $0x9,%al
+  800fb1:	74 f2                	je     800fa5 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fb3:	3c 2b                	cmp    $0x2b,%al
+  800fb5:	74 2a                	je     800fe1 <strtol+0x4a>
+	int neg = 0;
+  800fb7:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fbc:	3c 2d                	cmp    $0x2d,%al
+  800fbe:	74 2b                	je     800feb <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fc0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fc6:	75 0f                	jne    800fd7 <strtol+0x40>
+  800fc8:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fcb:	74 28                	je     800ff5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fcd:	85 db                	test   %ebx,%ebx
+  800fcf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd4:	0f 44 d8             	cmove  %eax,%ebx
+  800fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fdf:	eb 46                	jmp    801027 <strtol+0x90>
+		s++;
+  800fe1:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fe4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe9:	eb d5                	jmp    800fc0 <strtol+0x29>
+		s++, neg = 1;
+  800feb:	83 c2 01             	add    $0x1,%edx
+  800fee:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ff3:	eb cb                	jmp    800fc0 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ff5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ff9:	74 0e                	je     801009 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ffb:	85 db                	test   %ebx,%ebx
+  800ffd:	75 d8                	jne    800fd7 <strtol+0x40>
+		s++, base = 8;
+  800fff:	83 c2 01             	add    $0x1,%edx
+  801002:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801007:	eb ce                	jmp    800fd7 <strtol+0x40>
+		s += 2, base = 16;
+  801009:	83 c2 02             	add    $0x2,%edx
+  80100c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801011:	eb c4                	jmp    800fd7 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801013:	0f be c0             	movsbl %al,%eax
+  801016:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801019:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80101c:	7d 3a                	jge    801058 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80101e:	83 c2 01             	add    $0x1,%edx
+  801021:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801025:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801027:	0f b6 02             	movzbl (%edx),%eax
+  80102a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80102d:	89 f3                	mov    %esi,%ebx
+  80102f:	80 fb 09             	cmp    $0x9,%bl
+  801032:	76 df                	jbe    801013 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801034:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801037:	89 f3                	mov    %esi,%ebx
+  801039:	80 fb 19             	cmp    $0x19,%bl
+  80103c:	77 08                	ja     801046 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80103e:	0f be c0             	movsbl %al,%eax
+  801041:	83 e8 57             	sub    $0x57,%eax
+  801044:	eb d3                	jmp    801019 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801046:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801049:	89 f3                	mov    %esi,%ebx
+  80104b:	80 fb 19             	cmp    $0x19,%bl
+  80104e:	77 08                	ja     801058 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801050:	0f be c0             	movsbl %al,%eax
+  801053:	83 e8 37             	sub    $0x37,%eax
+  801056:	eb c1                	jmp    801019 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801058:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80105c:	74 05                	je     801063 <strtol+0xcc>
+		*endptr = (char *) s;
+  80105e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801061:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801063:	89 c8                	mov    %ecx,%eax
+  801065:	f7 d8                	neg    %eax
+  801067:	85 ff                	test   %edi,%edi
+  801069:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80106c:	89 c8                	mov    %ecx,%eax
+  80106e:	5b                   	pop    %ebx
+  80106f:	5e                   	pop    %esi
+  801070:	5f                   	pop    %edi
+  801071:	5d                   	pop    %ebp
+  801072:	c3                   	ret
+
+00801073 <atoi>:
+
+int
+atoi(const char* s)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  801079:	6a 00                	push   $0x0
+  80107b:	6a 00                	push   $0x0
+  80107d:	ff 75 08             	push   0x8(%ebp)
+  801080:	e8 12 ff ff ff       	call   800f97 <strtol>
+}
+  801085:	c9                   	leave
+  801086:	c3                   	ret
+
+00801087 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80108c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801091:	8b 55 08             	mov    0x8(%ebp),%edx
+  801094:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801097:	89 c3                	mov    %eax,%ebx
+  801099:	89 c7                	mov    %eax,%edi
+  80109b:	6a 00                	push   $0x0
+  80109d:	55                   	push   %ebp
+  80109e:	56                   	push   %esi
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	8d 35 a9 10 80 00    	lea    0x8010a9,%esi
+  8010a7:	0f 34                	sysenter
+
+008010a9 <after_sysenter_label_47>:
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5f                   	pop    %edi
+  8010b0:	5d                   	pop    %ebp
+  8010b1:	c3                   	ret
+
+008010b2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8010b2:	55                   	push   %ebp
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	57                   	push   %edi
+  8010b6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c1:	89 d1                	mov    %edx,%ecx
+  8010c3:	89 d3                	mov    %edx,%ebx
+  8010c5:	89 d7                	mov    %edx,%edi
+  8010c7:	6a 00                	push   $0x0
+  8010c9:	55                   	push   %ebp
+  8010ca:	56                   	push   %esi
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	8d 35 d5 10 80 00    	lea    0x8010d5,%esi
+  8010d3:	0f 34                	sysenter
+
+008010d5 <after_sysenter_label_128>:
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010da:	5b                   	pop    %ebx
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+
+008010de <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f0:	89 cb                	mov    %ecx,%ebx
+  8010f2:	89 cf                	mov    %ecx,%edi
+  8010f4:	6a 00                	push   $0x0
+  8010f6:	55                   	push   %ebp
+  8010f7:	56                   	push   %esi
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	8d 35 02 11 80 00    	lea    0x801102,%esi
+  801100:	0f 34                	sysenter
+
+00801102 <after_sysenter_label_212>:
+  801102:	5e                   	pop    %esi
+  801103:	5d                   	pop    %ebp
+  801104:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801107:	85 c0                	test   %eax,%eax
+  801109:	7f 07                	jg     801112 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80110b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110e:	5b                   	pop    %ebx
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801112:	83 ec 0c             	sub    $0xc,%esp
+  801115:	50                   	push   %eax
+  801116:	6a 03                	push   $0x3
+  801118:	68 35 51 80 00       	push   $0x805135
+  80111d:	6a 54                	push   $0x54
+  80111f:	68 52 51 80 00       	push   $0x805152
+  801124:	e8 5b f5 ff ff       	call   800684 <_panic>
+
+00801129 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801129:	55                   	push   %ebp
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	57                   	push   %edi
+  80112d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80112e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801133:	b8 02 00 00 00       	mov    $0x2,%eax
+  801138:	89 d1                	mov    %edx,%ecx
+  80113a:	89 d3                	mov    %edx,%ebx
+  80113c:	89 d7                	mov    %edx,%edi
+  80113e:	6a 00                	push   $0x0
+  801140:	55                   	push   %ebp
+  801141:	56                   	push   %esi
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	8d 35 4c 11 80 00    	lea    0x80114c,%esi
+  80114a:	0f 34                	sysenter
+
+0080114c <after_sysenter_label_309>:
+  80114c:	5e                   	pop    %esi
+  80114d:	5d                   	pop    %ebp
+  80114e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801151:	5b                   	pop    %ebx
+  801152:	5f                   	pop    %edi
+  801153:	5d                   	pop    %ebp
+  801154:	c3                   	ret
+
+00801155 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80115a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801164:	89 d1                	mov    %edx,%ecx
+  801166:	89 d3                	mov    %edx,%ebx
+  801168:	89 d7                	mov    %edx,%edi
+  80116a:	6a 00                	push   $0x0
+  80116c:	55                   	push   %ebp
+  80116d:	56                   	push   %esi
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	8d 35 78 11 80 00    	lea    0x801178,%esi
+  801176:	0f 34                	sysenter
+
+00801178 <after_sysenter_label_391>:
+  801178:	5e                   	pop    %esi
+  801179:	5d                   	pop    %ebp
+  80117a:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80117d:	5b                   	pop    %ebx
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+
+00801181 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801181:	55                   	push   %ebp
+  801182:	89 e5                	mov    %esp,%ebp
+  801184:	57                   	push   %edi
+  801185:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801191:	bf 00 00 00 00       	mov    $0x0,%edi
+  801196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801199:	6a 00                	push   $0x0
+  80119b:	55                   	push   %ebp
+  80119c:	56                   	push   %esi
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	8d 35 a7 11 80 00    	lea    0x8011a7,%esi
+  8011a5:	0f 34                	sysenter
+
+008011a7 <after_sysenter_label_479>:
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011ac:	85 c0                	test   %eax,%eax
+  8011ae:	7f 07                	jg     8011b7 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5f                   	pop    %edi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b7:	83 ec 0c             	sub    $0xc,%esp
+  8011ba:	50                   	push   %eax
+  8011bb:	6a 04                	push   $0x4
+  8011bd:	68 35 51 80 00       	push   $0x805135
+  8011c2:	6a 54                	push   $0x54
+  8011c4:	68 52 51 80 00       	push   $0x805152
+  8011c9:	e8 b6 f4 ff ff       	call   800684 <_panic>
+
+008011ce <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e4:	ff 75 18             	push   0x18(%ebp)
+  8011e7:	55                   	push   %ebp
+  8011e8:	56                   	push   %esi
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	8d 35 f3 11 80 00    	lea    0x8011f3,%esi
+  8011f1:	0f 34                	sysenter
+
+008011f3 <after_sysenter_label_593>:
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	7f 07                	jg     801203 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ff:	5b                   	pop    %ebx
+  801200:	5f                   	pop    %edi
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	50                   	push   %eax
+  801207:	6a 05                	push   $0x5
+  801209:	68 35 51 80 00       	push   $0x805135
+  80120e:	6a 54                	push   $0x54
+  801210:	68 52 51 80 00       	push   $0x805152
+  801215:	e8 6a f4 ff ff       	call   800684 <_panic>
+
+0080121a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	57                   	push   %edi
+  80121e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80121f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80122f:	89 df                	mov    %ebx,%edi
+  801231:	6a 00                	push   $0x0
+  801233:	55                   	push   %ebp
+  801234:	56                   	push   %esi
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	8d 35 3f 12 80 00    	lea    0x80123f,%esi
+  80123d:	0f 34                	sysenter
+
+0080123f <after_sysenter_label_704>:
+  80123f:	5e                   	pop    %esi
+  801240:	5d                   	pop    %ebp
+  801241:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801244:	85 c0                	test   %eax,%eax
+  801246:	7f 07                	jg     80124f <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801248:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80124b:	5b                   	pop    %ebx
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+  801252:	50                   	push   %eax
+  801253:	6a 06                	push   $0x6
+  801255:	68 35 51 80 00       	push   $0x805135
+  80125a:	6a 54                	push   $0x54
+  80125c:	68 52 51 80 00       	push   $0x805152
+  801261:	e8 1e f4 ff ff       	call   800684 <_panic>
+
+00801266 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80126b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801270:	8b 55 08             	mov    0x8(%ebp),%edx
+  801273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801276:	b8 08 00 00 00       	mov    $0x8,%eax
+  80127b:	89 df                	mov    %ebx,%edi
+  80127d:	6a 00                	push   $0x0
+  80127f:	55                   	push   %ebp
+  801280:	56                   	push   %esi
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	8d 35 8b 12 80 00    	lea    0x80128b,%esi
+  801289:	0f 34                	sysenter
+
+0080128b <after_sysenter_label_808>:
+  80128b:	5e                   	pop    %esi
+  80128c:	5d                   	pop    %ebp
+  80128d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801290:	85 c0                	test   %eax,%eax
+  801292:	7f 07                	jg     80129b <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5f                   	pop    %edi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129b:	83 ec 0c             	sub    $0xc,%esp
+  80129e:	50                   	push   %eax
+  80129f:	6a 08                	push   $0x8
+  8012a1:	68 35 51 80 00       	push   $0x805135
+  8012a6:	6a 54                	push   $0x54
+  8012a8:	68 52 51 80 00       	push   $0x805152
+  8012ad:	e8 d2 f3 ff ff       	call   800684 <_panic>
+
+008012b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012c7:	89 df                	mov    %ebx,%edi
+  8012c9:	6a 00                	push   $0x0
+  8012cb:	55                   	push   %ebp
+  8012cc:	56                   	push   %esi
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	8d 35 d7 12 80 00    	lea    0x8012d7,%esi
+  8012d5:	0f 34                	sysenter
+
+008012d7 <after_sysenter_label_912>:
+  8012d7:	5e                   	pop    %esi
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012dc:	85 c0                	test   %eax,%eax
+  8012de:	7f 07                	jg     8012e7 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012e3:	5b                   	pop    %ebx
+  8012e4:	5f                   	pop    %edi
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e7:	83 ec 0c             	sub    $0xc,%esp
+  8012ea:	50                   	push   %eax
+  8012eb:	6a 09                	push   $0x9
+  8012ed:	68 35 51 80 00       	push   $0x805135
+  8012f2:	6a 54                	push   $0x54
+  8012f4:	68 52 51 80 00       	push   $0x805152
+  8012f9:	e8 86 f3 ff ff       	call   800684 <_panic>
+
+008012fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012fe:	55                   	push   %ebp
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	57                   	push   %edi
+  801302:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	6a 00                	push   $0x0
+  801317:	55                   	push   %ebp
+  801318:	56                   	push   %esi
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	8d 35 23 13 80 00    	lea    0x801323,%esi
+  801321:	0f 34                	sysenter
+
+00801323 <after_sysenter_label_1016>:
+  801323:	5e                   	pop    %esi
+  801324:	5d                   	pop    %ebp
+  801325:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	7f 07                	jg     801333 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80132c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80132f:	5b                   	pop    %ebx
+  801330:	5f                   	pop    %edi
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	50                   	push   %eax
+  801337:	6a 0a                	push   $0xa
+  801339:	68 35 51 80 00       	push   $0x805135
+  80133e:	6a 54                	push   $0x54
+  801340:	68 52 51 80 00       	push   $0x805152
+  801345:	e8 3a f3 ff ff       	call   800684 <_panic>
+
+0080134a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80134f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801352:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801355:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80135a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801360:	6a 00                	push   $0x0
+  801362:	55                   	push   %ebp
+  801363:	56                   	push   %esi
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	8d 35 6e 13 80 00    	lea    0x80136e,%esi
+  80136c:	0f 34                	sysenter
+
+0080136e <after_sysenter_label_1126>:
+  80136e:	5e                   	pop    %esi
+  80136f:	5d                   	pop    %ebp
+  801370:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801373:	5b                   	pop    %ebx
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+
+00801377 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	57                   	push   %edi
+  80137b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80137c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801384:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801389:	89 cb                	mov    %ecx,%ebx
+  80138b:	89 cf                	mov    %ecx,%edi
+  80138d:	6a 00                	push   $0x0
+  80138f:	55                   	push   %ebp
+  801390:	56                   	push   %esi
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	8d 35 9b 13 80 00    	lea    0x80139b,%esi
+  801399:	0f 34                	sysenter
+
+0080139b <after_sysenter_label_1210>:
+  80139b:	5e                   	pop    %esi
+  80139c:	5d                   	pop    %ebp
+  80139d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	7f 07                	jg     8013ab <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a7:	5b                   	pop    %ebx
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	50                   	push   %eax
+  8013af:	6a 0d                	push   $0xd
+  8013b1:	68 35 51 80 00       	push   $0x805135
+  8013b6:	6a 54                	push   $0x54
+  8013b8:	68 52 51 80 00       	push   $0x805152
+  8013bd:	e8 c2 f2 ff ff       	call   800684 <_panic>
+
+008013c2 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d2:	b8 42 00 00 00       	mov    $0x42,%eax
+  8013d7:	89 df                	mov    %ebx,%edi
+  8013d9:	6a 00                	push   $0x0
+  8013db:	55                   	push   %ebp
+  8013dc:	56                   	push   %esi
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	8d 35 e7 13 80 00    	lea    0x8013e7,%esi
+  8013e5:	0f 34                	sysenter
+
+008013e7 <after_sysenter_label_1311>:
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	7f 07                	jg     8013f7 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8013f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5f                   	pop    %edi
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	50                   	push   %eax
+  8013fb:	6a 42                	push   $0x42
+  8013fd:	68 35 51 80 00       	push   $0x805135
+  801402:	6a 54                	push   $0x54
+  801404:	68 52 51 80 00       	push   $0x805152
+  801409:	e8 76 f2 ff ff       	call   800684 <_panic>
+
+0080140e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	57                   	push   %edi
+  801412:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801413:	ba 00 00 00 00       	mov    $0x0,%edx
+  801418:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80141d:	89 d1                	mov    %edx,%ecx
+  80141f:	89 d3                	mov    %edx,%ebx
+  801421:	89 d7                	mov    %edx,%edi
+  801423:	6a 00                	push   $0x0
+  801425:	55                   	push   %ebp
+  801426:	56                   	push   %esi
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	8d 35 31 14 80 00    	lea    0x801431,%esi
+  80142f:	0f 34                	sysenter
+
+00801431 <after_sysenter_label_1411>:
+  801431:	5e                   	pop    %esi
+  801432:	5d                   	pop    %ebp
+  801433:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801436:	5b                   	pop    %ebx
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	57                   	push   %edi
+  80143e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	8b 55 08             	mov    0x8(%ebp),%edx
+  801447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80144f:	89 df                	mov    %ebx,%edi
+  801451:	6a 00                	push   $0x0
+  801453:	55                   	push   %ebp
+  801454:	56                   	push   %esi
+  801455:	89 e5                	mov    %esp,%ebp
+  801457:	8d 35 5f 14 80 00    	lea    0x80145f,%esi
+  80145d:	0f 34                	sysenter
+
+0080145f <after_sysenter_label_1497>:
+  80145f:	5e                   	pop    %esi
+  801460:	5d                   	pop    %ebp
+  801461:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801464:	5b                   	pop    %ebx
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+
+00801468 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	57                   	push   %edi
+  80146c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80146d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801478:	b8 10 00 00 00       	mov    $0x10,%eax
+  80147d:	89 df                	mov    %ebx,%edi
+  80147f:	6a 00                	push   $0x0
+  801481:	55                   	push   %ebp
+  801482:	56                   	push   %esi
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	8d 35 8d 14 80 00    	lea    0x80148d,%esi
+  80148b:	0f 34                	sysenter
+
+0080148d <after_sysenter_label_1583>:
+  80148d:	5e                   	pop    %esi
+  80148e:	5d                   	pop    %ebp
+  80148f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801492:	5b                   	pop    %ebx
+  801493:	5f                   	pop    %edi
+  801494:	5d                   	pop    %ebp
+  801495:	c3                   	ret
+
+00801496 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801496:	55                   	push   %ebp
+  801497:	89 e5                	mov    %esp,%ebp
+  801499:	57                   	push   %edi
+  80149a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80149b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a1:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ae:	6a 00                	push   $0x0
+  8014b0:	55                   	push   %ebp
+  8014b1:	56                   	push   %esi
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	8d 35 bc 14 80 00    	lea    0x8014bc,%esi
+  8014ba:	0f 34                	sysenter
+
+008014bc <after_sysenter_label_1672>:
+  8014bc:	5e                   	pop    %esi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+
+008014c5 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	57                   	push   %edi
+  8014c9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8014da:	89 df                	mov    %ebx,%edi
+  8014dc:	6a 00                	push   $0x0
+  8014de:	55                   	push   %ebp
+  8014df:	56                   	push   %esi
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	8d 35 ea 14 80 00    	lea    0x8014ea,%esi
+  8014e8:	0f 34                	sysenter
+
+008014ea <after_sysenter_label_1758>:
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5f                   	pop    %edi
+  8014f1:	5d                   	pop    %ebp
+  8014f2:	c3                   	ret
+
+008014f3 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	57                   	push   %edi
+  8014f7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801500:	b8 13 00 00 00       	mov    $0x13,%eax
+  801505:	89 cb                	mov    %ecx,%ebx
+  801507:	89 cf                	mov    %ecx,%edi
+  801509:	6a 00                	push   $0x0
+  80150b:	55                   	push   %ebp
+  80150c:	56                   	push   %esi
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	8d 35 17 15 80 00    	lea    0x801517,%esi
+  801515:	0f 34                	sysenter
+
+00801517 <after_sysenter_label_1842>:
+  801517:	5e                   	pop    %esi
+  801518:	5d                   	pop    %ebp
+  801519:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	7f 07                	jg     801527 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801520:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5f                   	pop    %edi
+  801525:	5d                   	pop    %ebp
+  801526:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801527:	83 ec 0c             	sub    $0xc,%esp
+  80152a:	50                   	push   %eax
+  80152b:	6a 13                	push   $0x13
+  80152d:	68 35 51 80 00       	push   $0x805135
+  801532:	6a 54                	push   $0x54
+  801534:	68 52 51 80 00       	push   $0x805152
+  801539:	e8 46 f1 ff ff       	call   800684 <_panic>
+
+0080153e <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80153e:	55                   	push   %ebp
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	57                   	push   %edi
+  801542:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801543:	ba 00 00 00 00       	mov    $0x0,%edx
+  801548:	b8 14 00 00 00       	mov    $0x14,%eax
+  80154d:	89 d1                	mov    %edx,%ecx
+  80154f:	89 d3                	mov    %edx,%ebx
+  801551:	89 d7                	mov    %edx,%edi
+  801553:	6a 00                	push   $0x0
+  801555:	55                   	push   %ebp
+  801556:	56                   	push   %esi
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	8d 35 61 15 80 00    	lea    0x801561,%esi
+  80155f:	0f 34                	sysenter
+
+00801561 <after_sysenter_label_1939>:
+  801561:	5e                   	pop    %esi
+  801562:	5d                   	pop    %ebp
+  801563:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801566:	5b                   	pop    %ebx
+  801567:	5f                   	pop    %edi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+
+0080156a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	57                   	push   %edi
+  80156e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801575:	b8 15 00 00 00       	mov    $0x15,%eax
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801582:	6a 00                	push   $0x0
+  801584:	55                   	push   %ebp
+  801585:	56                   	push   %esi
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	8d 35 90 15 80 00    	lea    0x801590,%esi
+  80158e:	0f 34                	sysenter
+
+00801590 <after_sysenter_label_2028>:
+  801590:	5e                   	pop    %esi
+  801591:	5d                   	pop    %ebp
+  801592:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801595:	5b                   	pop    %ebx
+  801596:	5f                   	pop    %edi
+  801597:	5d                   	pop    %ebp
+  801598:	c3                   	ret
+
+00801599 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801599:	55                   	push   %ebp
+  80159a:	89 e5                	mov    %esp,%ebp
+  80159c:	57                   	push   %edi
+  80159d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80159e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015ae:	89 df                	mov    %ebx,%edi
+  8015b0:	6a 00                	push   $0x0
+  8015b2:	55                   	push   %ebp
+  8015b3:	56                   	push   %esi
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	8d 35 be 15 80 00    	lea    0x8015be,%esi
+  8015bc:	0f 34                	sysenter
+
+008015be <after_sysenter_label_2114>:
+  8015be:	5e                   	pop    %esi
+  8015bf:	5d                   	pop    %ebp
+  8015c0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8015c3:	5b                   	pop    %ebx
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+
+008015c7 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015dc:	89 df                	mov    %ebx,%edi
+  8015de:	6a 00                	push   $0x0
+  8015e0:	55                   	push   %ebp
+  8015e1:	56                   	push   %esi
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	8d 35 ec 15 80 00    	lea    0x8015ec,%esi
+  8015ea:	0f 34                	sysenter
+
+008015ec <after_sysenter_label_2200>:
+  8015ec:	5e                   	pop    %esi
+  8015ed:	5d                   	pop    %ebp
+  8015ee:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	57                   	push   %edi
+  8015f9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801602:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801605:	b8 18 00 00 00       	mov    $0x18,%eax
+  80160a:	89 df                	mov    %ebx,%edi
+  80160c:	6a 00                	push   $0x0
+  80160e:	55                   	push   %ebp
+  80160f:	56                   	push   %esi
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	8d 35 1a 16 80 00    	lea    0x80161a,%esi
+  801618:	0f 34                	sysenter
+
+0080161a <after_sysenter_label_2286>:
+  80161a:	5e                   	pop    %esi
+  80161b:	5d                   	pop    %ebp
+  80161c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80161f:	5b                   	pop    %ebx
+  801620:	5f                   	pop    %edi
+  801621:	5d                   	pop    %ebp
+  801622:	c3                   	ret
+
+00801623 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801623:	55                   	push   %ebp
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801629:	83 3d 64 73 80 00 00 	cmpl   $0x0,0x807364
+  801630:	74 0a                	je     80163c <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801632:	8b 45 08             	mov    0x8(%ebp),%eax
+  801635:	a3 64 73 80 00       	mov    %eax,0x807364
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80163c:	83 ec 04             	sub    $0x4,%esp
+  80163f:	6a 07                	push   $0x7
+  801641:	68 00 f0 bf ee       	push   $0xeebff000
+  801646:	6a 00                	push   $0x0
+  801648:	e8 34 fb ff ff       	call   801181 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80164d:	83 c4 08             	add    $0x8,%esp
+  801650:	68 61 16 80 00       	push   $0x801661
+  801655:	6a 00                	push   $0x0
+  801657:	e8 a2 fc ff ff       	call   8012fe <sys_env_set_pgfault_upcall>
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	eb d1                	jmp    801632 <set_pgfault_handler+0xf>
+
+00801661 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801661:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801662:	a1 64 73 80 00       	mov    0x807364,%eax
+	call *%eax
+  801667:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801669:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80166c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  801670:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  801674:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  801677:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80167b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80167d:	83 c4 08             	add    $0x8,%esp
+	popal
+  801680:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  801681:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801684:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  801685:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  801686:	c3                   	ret
+
+00801687 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80168a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801692:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801695:	5d                   	pop    %ebp
+  801696:	c3                   	ret
+
+00801697 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80169a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016a2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016a7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016ac:	5d                   	pop    %ebp
+  8016ad:	c3                   	ret
+
+008016ae <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016ae:	55                   	push   %ebp
+  8016af:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8016b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016b6:	eb 02                	jmp    8016ba <fd_alloc+0xc>
+  8016b8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016ba:	89 c2                	mov    %eax,%edx
+  8016bc:	c1 ea 16             	shr    $0x16,%edx
+  8016bf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016c6:	f6 c2 01             	test   $0x1,%dl
+  8016c9:	74 2b                	je     8016f6 <fd_alloc+0x48>
+  8016cb:	89 c2                	mov    %eax,%edx
+  8016cd:	c1 ea 0c             	shr    $0xc,%edx
+  8016d0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016d7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016dd:	f6 c1 01             	test   $0x1,%cl
+  8016e0:	74 14                	je     8016f6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8016e2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016e8:	75 ce                	jne    8016b8 <fd_alloc+0xa>
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8016ef:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016f4:	eb 05                	jmp    8016fb <fd_alloc+0x4d>
+			return 0;
+  8016f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8016fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fe:	89 02                	mov    %eax,(%edx)
+}
+  801700:	89 c8                	mov    %ecx,%eax
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+
+00801704 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801704:	55                   	push   %ebp
+  801705:	89 e5                	mov    %esp,%ebp
+  801707:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80170a:	83 f8 1f             	cmp    $0x1f,%eax
+  80170d:	77 30                	ja     80173f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80170f:	c1 e0 0c             	shl    $0xc,%eax
+  801712:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801717:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80171d:	f6 c2 01             	test   $0x1,%dl
+  801720:	74 24                	je     801746 <fd_lookup+0x42>
+  801722:	89 c2                	mov    %eax,%edx
+  801724:	c1 ea 0c             	shr    $0xc,%edx
+  801727:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80172e:	f6 c2 01             	test   $0x1,%dl
+  801731:	74 1a                	je     80174d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801733:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801736:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801738:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+		return -E_INVAL;
+  80173f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801744:	eb f7                	jmp    80173d <fd_lookup+0x39>
+		return -E_INVAL;
+  801746:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174b:	eb f0                	jmp    80173d <fd_lookup+0x39>
+  80174d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801752:	eb e9                	jmp    80173d <fd_lookup+0x39>
+
+00801754 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801754:	55                   	push   %ebp
+  801755:	89 e5                	mov    %esp,%ebp
+  801757:	53                   	push   %ebx
+  801758:	83 ec 04             	sub    $0x4,%esp
+  80175b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80175e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801763:	eb 03                	jmp    801768 <dev_lookup+0x14>
+  801765:	83 c0 01             	add    $0x1,%eax
+  801768:	8b 1c 85 dc 51 80 00 	mov    0x8051dc(,%eax,4),%ebx
+  80176f:	85 db                	test   %ebx,%ebx
+  801771:	74 0b                	je     80177e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801773:	39 13                	cmp    %edx,(%ebx)
+  801775:	75 ee                	jne    801765 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	eb 49                	jmp    8017c7 <dev_lookup+0x73>
+  80177e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801780:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801786:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80178b:	77 18                	ja     8017a5 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80178d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801792:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801794:	c1 e8 10             	shr    $0x10,%eax
+  801797:	74 0c                	je     8017a5 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801799:	c1 e0 10             	shl    $0x10,%eax
+  80179c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8017a1:	29 c1                	sub    %eax,%ecx
+  8017a3:	eb 06                	jmp    8017ab <dev_lookup+0x57>
+		return pthread_main_tls;
+  8017a5:	8b 0d 60 73 80 00    	mov    0x807360,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017ab:	8b 01                	mov    (%ecx),%eax
+  8017ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8017b0:	83 ec 04             	sub    $0x4,%esp
+  8017b3:	52                   	push   %edx
+  8017b4:	50                   	push   %eax
+  8017b5:	68 60 51 80 00       	push   $0x805160
+  8017ba:	e8 a0 ef ff ff       	call   80075f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8017bf:	83 c4 10             	add    $0x10,%esp
+  8017c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8017c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8017cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+
+008017d1 <fd_close>:
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	57                   	push   %edi
+  8017d5:	56                   	push   %esi
+  8017d6:	53                   	push   %ebx
+  8017d7:	83 ec 24             	sub    $0x24,%esp
+  8017da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017e3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017ea:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017ed:	50                   	push   %eax
+  8017ee:	e8 11 ff ff ff       	call   801704 <fd_lookup>
+  8017f3:	89 c3                	mov    %eax,%ebx
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 05                	js     801801 <fd_close+0x30>
+	    || fd != fd2)
+  8017fc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017ff:	74 16                	je     801817 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801801:	89 f8                	mov    %edi,%eax
+  801803:	84 c0                	test   %al,%al
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80180d:	89 d8                	mov    %ebx,%eax
+  80180f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801812:	5b                   	pop    %ebx
+  801813:	5e                   	pop    %esi
+  801814:	5f                   	pop    %edi
+  801815:	5d                   	pop    %ebp
+  801816:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801817:	83 ec 08             	sub    $0x8,%esp
+  80181a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80181d:	50                   	push   %eax
+  80181e:	ff 36                	push   (%esi)
+  801820:	e8 2f ff ff ff       	call   801754 <dev_lookup>
+  801825:	89 c3                	mov    %eax,%ebx
+  801827:	83 c4 10             	add    $0x10,%esp
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	78 1a                	js     801848 <fd_close+0x77>
+		if (dev->dev_close)
+  80182e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801831:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801834:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	74 0b                	je     801848 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80183d:	83 ec 0c             	sub    $0xc,%esp
+  801840:	56                   	push   %esi
+  801841:	ff d0                	call   *%eax
+  801843:	89 c3                	mov    %eax,%ebx
+  801845:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801848:	83 ec 08             	sub    $0x8,%esp
+  80184b:	56                   	push   %esi
+  80184c:	6a 00                	push   $0x0
+  80184e:	e8 c7 f9 ff ff       	call   80121a <sys_page_unmap>
+	return r;
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	eb b5                	jmp    80180d <fd_close+0x3c>
+
+00801858 <close>:
+
+int
+close(int fdnum)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80185e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801861:	50                   	push   %eax
+  801862:	ff 75 08             	push   0x8(%ebp)
+  801865:	e8 9a fe ff ff       	call   801704 <fd_lookup>
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	85 c0                	test   %eax,%eax
+  80186f:	79 02                	jns    801873 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801871:	c9                   	leave
+  801872:	c3                   	ret
+		return fd_close(fd, 1);
+  801873:	83 ec 08             	sub    $0x8,%esp
+  801876:	6a 01                	push   $0x1
+  801878:	ff 75 f4             	push   -0xc(%ebp)
+  80187b:	e8 51 ff ff ff       	call   8017d1 <fd_close>
+  801880:	83 c4 10             	add    $0x10,%esp
+  801883:	eb ec                	jmp    801871 <close+0x19>
+
+00801885 <close_all>:
+
+void
+close_all(void)
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	53                   	push   %ebx
+  801889:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80188c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801891:	83 ec 0c             	sub    $0xc,%esp
+  801894:	53                   	push   %ebx
+  801895:	e8 be ff ff ff       	call   801858 <close>
+	for (i = 0; i < MAXFD; i++)
+  80189a:	83 c3 01             	add    $0x1,%ebx
+  80189d:	83 c4 10             	add    $0x10,%esp
+  8018a0:	83 fb 20             	cmp    $0x20,%ebx
+  8018a3:	75 ec                	jne    801891 <close_all+0xc>
+}
+  8018a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018a8:	c9                   	leave
+  8018a9:	c3                   	ret
+
+008018aa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	57                   	push   %edi
+  8018ae:	56                   	push   %esi
+  8018af:	53                   	push   %ebx
+  8018b0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8018b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	ff 75 08             	push   0x8(%ebp)
+  8018ba:	e8 45 fe ff ff       	call   801704 <fd_lookup>
+  8018bf:	89 c3                	mov    %eax,%ebx
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	78 7f                	js     801947 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8018c8:	83 ec 0c             	sub    $0xc,%esp
+  8018cb:	ff 75 0c             	push   0xc(%ebp)
+  8018ce:	e8 85 ff ff ff       	call   801858 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018d6:	c1 e6 0c             	shl    $0xc,%esi
+  8018d9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8018df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018e2:	89 3c 24             	mov    %edi,(%esp)
+  8018e5:	e8 ad fd ff ff       	call   801697 <fd2data>
+  8018ea:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8018ec:	89 34 24             	mov    %esi,(%esp)
+  8018ef:	e8 a3 fd ff ff       	call   801697 <fd2data>
+  8018f4:	83 c4 10             	add    $0x10,%esp
+  8018f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8018fa:	89 d8                	mov    %ebx,%eax
+  8018fc:	c1 e8 16             	shr    $0x16,%eax
+  8018ff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801906:	a8 01                	test   $0x1,%al
+  801908:	74 11                	je     80191b <dup+0x71>
+  80190a:	89 d8                	mov    %ebx,%eax
+  80190c:	c1 e8 0c             	shr    $0xc,%eax
+  80190f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801916:	f6 c2 01             	test   $0x1,%dl
+  801919:	75 36                	jne    801951 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80191b:	89 f8                	mov    %edi,%eax
+  80191d:	c1 e8 0c             	shr    $0xc,%eax
+  801920:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801927:	83 ec 0c             	sub    $0xc,%esp
+  80192a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80192f:	50                   	push   %eax
+  801930:	56                   	push   %esi
+  801931:	6a 00                	push   $0x0
+  801933:	57                   	push   %edi
+  801934:	6a 00                	push   $0x0
+  801936:	e8 93 f8 ff ff       	call   8011ce <sys_page_map>
+  80193b:	89 c3                	mov    %eax,%ebx
+  80193d:	83 c4 20             	add    $0x20,%esp
+  801940:	85 c0                	test   %eax,%eax
+  801942:	78 33                	js     801977 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801944:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801947:	89 d8                	mov    %ebx,%eax
+  801949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194c:	5b                   	pop    %ebx
+  80194d:	5e                   	pop    %esi
+  80194e:	5f                   	pop    %edi
+  80194f:	5d                   	pop    %ebp
+  801950:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801951:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801960:	50                   	push   %eax
+  801961:	ff 75 d4             	push   -0x2c(%ebp)
+  801964:	6a 00                	push   $0x0
+  801966:	53                   	push   %ebx
+  801967:	6a 00                	push   $0x0
+  801969:	e8 60 f8 ff ff       	call   8011ce <sys_page_map>
+  80196e:	89 c3                	mov    %eax,%ebx
+  801970:	83 c4 20             	add    $0x20,%esp
+  801973:	85 c0                	test   %eax,%eax
+  801975:	79 a4                	jns    80191b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801977:	83 ec 08             	sub    $0x8,%esp
+  80197a:	56                   	push   %esi
+  80197b:	6a 00                	push   $0x0
+  80197d:	e8 98 f8 ff ff       	call   80121a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801982:	83 c4 08             	add    $0x8,%esp
+  801985:	ff 75 d4             	push   -0x2c(%ebp)
+  801988:	6a 00                	push   $0x0
+  80198a:	e8 8b f8 ff ff       	call   80121a <sys_page_unmap>
+	return r;
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	eb b3                	jmp    801947 <dup+0x9d>
+
+00801994 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	56                   	push   %esi
+  801998:	53                   	push   %ebx
+  801999:	83 ec 18             	sub    $0x18,%esp
+  80199c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80199f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019a2:	50                   	push   %eax
+  8019a3:	53                   	push   %ebx
+  8019a4:	e8 5b fd ff ff       	call   801704 <fd_lookup>
+  8019a9:	83 c4 10             	add    $0x10,%esp
+  8019ac:	85 c0                	test   %eax,%eax
+  8019ae:	78 3c                	js     8019ec <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019b0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b3:	83 ec 08             	sub    $0x8,%esp
+  8019b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b9:	50                   	push   %eax
+  8019ba:	ff 36                	push   (%esi)
+  8019bc:	e8 93 fd ff ff       	call   801754 <dev_lookup>
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 24                	js     8019ec <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c8:	8b 46 08             	mov    0x8(%esi),%eax
+  8019cb:	83 e0 03             	and    $0x3,%eax
+  8019ce:	83 f8 01             	cmp    $0x1,%eax
+  8019d1:	74 20                	je     8019f3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d6:	8b 40 08             	mov    0x8(%eax),%eax
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	74 61                	je     801a3e <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019dd:	83 ec 04             	sub    $0x4,%esp
+  8019e0:	ff 75 10             	push   0x10(%ebp)
+  8019e3:	ff 75 0c             	push   0xc(%ebp)
+  8019e6:	56                   	push   %esi
+  8019e7:	ff d0                	call   *%eax
+  8019e9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5d                   	pop    %ebp
+  8019f2:	c3                   	ret
+  8019f3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8019f5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8019fb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a00:	77 18                	ja     801a1a <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a02:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a07:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a09:	c1 e8 10             	shr    $0x10,%eax
+  801a0c:	74 0c                	je     801a1a <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a0e:	c1 e0 10             	shl    $0x10,%eax
+  801a11:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a16:	29 c2                	sub    %eax,%edx
+  801a18:	eb 06                	jmp    801a20 <read+0x8c>
+		return pthread_main_tls;
+  801a1a:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a20:	8b 02                	mov    (%edx),%eax
+  801a22:	8b 40 48             	mov    0x48(%eax),%eax
+  801a25:	83 ec 04             	sub    $0x4,%esp
+  801a28:	53                   	push   %ebx
+  801a29:	50                   	push   %eax
+  801a2a:	68 a1 51 80 00       	push   $0x8051a1
+  801a2f:	e8 2b ed ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a3c:	eb ae                	jmp    8019ec <read+0x58>
+		return -E_NOT_SUPP;
+  801a3e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a43:	eb a7                	jmp    8019ec <read+0x58>
+
+00801a45 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a45:	55                   	push   %ebp
+  801a46:	89 e5                	mov    %esp,%ebp
+  801a48:	57                   	push   %edi
+  801a49:	56                   	push   %esi
+  801a4a:	53                   	push   %ebx
+  801a4b:	83 ec 0c             	sub    $0xc,%esp
+  801a4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a51:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a59:	eb 02                	jmp    801a5d <readn+0x18>
+  801a5b:	01 c3                	add    %eax,%ebx
+  801a5d:	39 f3                	cmp    %esi,%ebx
+  801a5f:	73 21                	jae    801a82 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	89 f0                	mov    %esi,%eax
+  801a66:	29 d8                	sub    %ebx,%eax
+  801a68:	50                   	push   %eax
+  801a69:	89 d8                	mov    %ebx,%eax
+  801a6b:	03 45 0c             	add    0xc(%ebp),%eax
+  801a6e:	50                   	push   %eax
+  801a6f:	57                   	push   %edi
+  801a70:	e8 1f ff ff ff       	call   801994 <read>
+		if (m < 0)
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 04                	js     801a80 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801a7c:	75 dd                	jne    801a5b <readn+0x16>
+  801a7e:	eb 02                	jmp    801a82 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a80:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801a82:	89 d8                	mov    %ebx,%eax
+  801a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a87:	5b                   	pop    %ebx
+  801a88:	5e                   	pop    %esi
+  801a89:	5f                   	pop    %edi
+  801a8a:	5d                   	pop    %ebp
+  801a8b:	c3                   	ret
+
+00801a8c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	56                   	push   %esi
+  801a90:	53                   	push   %ebx
+  801a91:	83 ec 18             	sub    $0x18,%esp
+  801a94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a9a:	50                   	push   %eax
+  801a9b:	53                   	push   %ebx
+  801a9c:	e8 63 fc ff ff       	call   801704 <fd_lookup>
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 37                	js     801adf <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aa8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aab:	83 ec 08             	sub    $0x8,%esp
+  801aae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab1:	50                   	push   %eax
+  801ab2:	ff 36                	push   (%esi)
+  801ab4:	e8 9b fc ff ff       	call   801754 <dev_lookup>
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 1f                	js     801adf <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ac0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ac4:	74 20                	je     801ae6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ac6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	74 61                	je     801b31 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ad0:	83 ec 04             	sub    $0x4,%esp
+  801ad3:	ff 75 10             	push   0x10(%ebp)
+  801ad6:	ff 75 0c             	push   0xc(%ebp)
+  801ad9:	56                   	push   %esi
+  801ada:	ff d0                	call   *%eax
+  801adc:	83 c4 10             	add    $0x10,%esp
+}
+  801adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+  801ae6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ae8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801aee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801af3:	77 18                	ja     801b0d <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801af5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801afa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801afc:	c1 e8 10             	shr    $0x10,%eax
+  801aff:	74 0c                	je     801b0d <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b01:	c1 e0 10             	shl    $0x10,%eax
+  801b04:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801b09:	29 c2                	sub    %eax,%edx
+  801b0b:	eb 06                	jmp    801b13 <write+0x87>
+		return pthread_main_tls;
+  801b0d:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b13:	8b 02                	mov    (%edx),%eax
+  801b15:	8b 40 48             	mov    0x48(%eax),%eax
+  801b18:	83 ec 04             	sub    $0x4,%esp
+  801b1b:	53                   	push   %ebx
+  801b1c:	50                   	push   %eax
+  801b1d:	68 bd 51 80 00       	push   $0x8051bd
+  801b22:	e8 38 ec ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2f:	eb ae                	jmp    801adf <write+0x53>
+		return -E_NOT_SUPP;
+  801b31:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b36:	eb a7                	jmp    801adf <write+0x53>
+
+00801b38 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	ff 75 08             	push   0x8(%ebp)
+  801b45:	e8 ba fb ff ff       	call   801704 <fd_lookup>
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 0e                	js     801b5f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801b51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b57:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b5f:	c9                   	leave
+  801b60:	c3                   	ret
+
+00801b61 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	56                   	push   %esi
+  801b65:	53                   	push   %ebx
+  801b66:	83 ec 18             	sub    $0x18,%esp
+  801b69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b6f:	50                   	push   %eax
+  801b70:	53                   	push   %ebx
+  801b71:	e8 8e fb ff ff       	call   801704 <fd_lookup>
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	78 34                	js     801bb1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b7d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b80:	83 ec 08             	sub    $0x8,%esp
+  801b83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b86:	50                   	push   %eax
+  801b87:	ff 36                	push   (%esi)
+  801b89:	e8 c6 fb ff ff       	call   801754 <dev_lookup>
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	78 1c                	js     801bb1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b95:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b99:	74 1d                	je     801bb8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801b9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9e:	8b 40 18             	mov    0x18(%eax),%eax
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	74 5e                	je     801c03 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	56                   	push   %esi
+  801bac:	ff d0                	call   *%eax
+  801bae:	83 c4 10             	add    $0x10,%esp
+}
+  801bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	c3                   	ret
+  801bb8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bc0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bc5:	77 18                	ja     801bdf <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bc7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801bcc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801bce:	c1 e8 10             	shr    $0x10,%eax
+  801bd1:	74 0c                	je     801bdf <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801bd3:	c1 e0 10             	shl    $0x10,%eax
+  801bd6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801bdb:	29 c2                	sub    %eax,%edx
+  801bdd:	eb 06                	jmp    801be5 <ftruncate+0x84>
+		return pthread_main_tls;
+  801bdf:	8b 15 60 73 80 00    	mov    0x807360,%edx
+			thisenv->env_id, fdnum);
+  801be5:	8b 02                	mov    (%edx),%eax
+  801be7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	53                   	push   %ebx
+  801bee:	50                   	push   %eax
+  801bef:	68 80 51 80 00       	push   $0x805180
+  801bf4:	e8 66 eb ff ff       	call   80075f <cprintf>
+		return -E_INVAL;
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c01:	eb ae                	jmp    801bb1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c08:	eb a7                	jmp    801bb1 <ftruncate+0x50>
+
+00801c0a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 18             	sub    $0x18,%esp
+  801c12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c18:	50                   	push   %eax
+  801c19:	ff 75 08             	push   0x8(%ebp)
+  801c1c:	e8 e3 fa ff ff       	call   801704 <fd_lookup>
+  801c21:	83 c4 10             	add    $0x10,%esp
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	78 49                	js     801c71 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c28:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c2b:	83 ec 08             	sub    $0x8,%esp
+  801c2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c31:	50                   	push   %eax
+  801c32:	ff 36                	push   (%esi)
+  801c34:	e8 1b fb ff ff       	call   801754 <dev_lookup>
+  801c39:	83 c4 10             	add    $0x10,%esp
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 31                	js     801c71 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801c40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c43:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c47:	74 2f                	je     801c78 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801c49:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801c4c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c53:	00 00 00 
+	stat->st_isdir = 0;
+  801c56:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c5d:	00 00 00 
+	stat->st_dev = dev;
+  801c60:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801c66:	83 ec 08             	sub    $0x8,%esp
+  801c69:	53                   	push   %ebx
+  801c6a:	56                   	push   %esi
+  801c6b:	ff 50 14             	call   *0x14(%eax)
+  801c6e:	83 c4 10             	add    $0x10,%esp
+}
+  801c71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c74:	5b                   	pop    %ebx
+  801c75:	5e                   	pop    %esi
+  801c76:	5d                   	pop    %ebp
+  801c77:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c78:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c7d:	eb f2                	jmp    801c71 <fstat+0x67>
+
+00801c7f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	56                   	push   %esi
+  801c83:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801c84:	83 ec 08             	sub    $0x8,%esp
+  801c87:	6a 00                	push   $0x0
+  801c89:	ff 75 08             	push   0x8(%ebp)
+  801c8c:	e8 4b 03 00 00       	call   801fdc <open>
+  801c91:	89 c3                	mov    %eax,%ebx
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 1b                	js     801cb5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801c9a:	83 ec 08             	sub    $0x8,%esp
+  801c9d:	ff 75 0c             	push   0xc(%ebp)
+  801ca0:	50                   	push   %eax
+  801ca1:	e8 64 ff ff ff       	call   801c0a <fstat>
+  801ca6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ca8:	89 1c 24             	mov    %ebx,(%esp)
+  801cab:	e8 a8 fb ff ff       	call   801858 <close>
+	return r;
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	89 f3                	mov    %esi,%ebx
+}
+  801cb5:	89 d8                	mov    %ebx,%eax
+  801cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cba:	5b                   	pop    %ebx
+  801cbb:	5e                   	pop    %esi
+  801cbc:	5d                   	pop    %ebp
+  801cbd:	c3                   	ret
+
+00801cbe <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	56                   	push   %esi
+  801cc2:	53                   	push   %ebx
+  801cc3:	89 c6                	mov    %eax,%esi
+  801cc5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801cc7:	83 3d ac 70 80 00 00 	cmpl   $0x0,0x8070ac
+  801cce:	74 27                	je     801cf7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cd0:	6a 07                	push   $0x7
+  801cd2:	68 00 80 80 00       	push   $0x808000
+  801cd7:	56                   	push   %esi
+  801cd8:	ff 35 ac 70 80 00    	push   0x8070ac
+  801cde:	e8 4e 2c 00 00       	call   804931 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ce3:	83 c4 0c             	add    $0xc,%esp
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	53                   	push   %ebx
+  801ce9:	6a 00                	push   $0x0
+  801ceb:	e8 4b 2b 00 00       	call   80483b <ipc_recv>
+}
+  801cf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf3:	5b                   	pop    %ebx
+  801cf4:	5e                   	pop    %esi
+  801cf5:	5d                   	pop    %ebp
+  801cf6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cf7:	83 ec 0c             	sub    $0xc,%esp
+  801cfa:	6a 01                	push   $0x1
+  801cfc:	e8 86 2c 00 00       	call   804987 <ipc_find_env>
+  801d01:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	eb c5                	jmp    801cd0 <fsipc+0x12>
+
+00801d0b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d0b:	55                   	push   %ebp
+  801d0c:	89 e5                	mov    %esp,%ebp
+  801d0e:	53                   	push   %ebx
+  801d0f:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d12:	68 b0 70 80 00       	push   $0x8070b0
+  801d17:	e8 29 1b 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d22:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2a:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d34:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d39:	e8 80 ff ff ff       	call   801cbe <fsipc>
+  801d3e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d40:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  801d47:	e8 66 1b 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+}
+  801d4c:	89 d8                	mov    %ebx,%eax
+  801d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+00801d53 <devfile_flush>:
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+  801d56:	53                   	push   %ebx
+  801d57:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801d5a:	68 b0 70 80 00       	push   $0x8070b0
+  801d5f:	e8 e1 1a 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d67:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d6a:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d74:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d79:	e8 40 ff ff ff       	call   801cbe <fsipc>
+  801d7e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d80:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  801d87:	e8 26 1b 00 00       	call   8038b2 <mutex_unlock>
+}
+  801d8c:	89 d8                	mov    %ebx,%eax
+  801d8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+00801d93 <devfile_stat>:
+{
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	56                   	push   %esi
+  801d97:	53                   	push   %ebx
+  801d98:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801d9b:	83 ec 0c             	sub    $0xc,%esp
+  801d9e:	68 b0 70 80 00       	push   $0x8070b0
+  801da3:	e8 9d 1a 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801da8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dab:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dae:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db8:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dbd:	e8 fc fe ff ff       	call   801cbe <fsipc>
+  801dc2:	89 c3                	mov    %eax,%ebx
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	79 16                	jns    801de1 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801dcb:	83 ec 0c             	sub    $0xc,%esp
+  801dce:	68 b0 70 80 00       	push   $0x8070b0
+  801dd3:	e8 da 1a 00 00       	call   8038b2 <mutex_unlock>
+}
+  801dd8:	89 d8                	mov    %ebx,%eax
+  801dda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddd:	5b                   	pop    %ebx
+  801dde:	5e                   	pop    %esi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801de1:	83 ec 08             	sub    $0x8,%esp
+  801de4:	68 00 80 80 00       	push   $0x808000
+  801de9:	56                   	push   %esi
+  801dea:	e8 54 ef ff ff       	call   800d43 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801def:	a1 80 80 80 00       	mov    0x808080,%eax
+  801df4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dfa:	a1 84 80 80 00       	mov    0x808084,%eax
+  801dff:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801e05:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e0d:	eb bc                	jmp    801dcb <devfile_stat+0x38>
+
+00801e0f <devfile_write>:
+{
+  801e0f:	55                   	push   %ebp
+  801e10:	89 e5                	mov    %esp,%ebp
+  801e12:	53                   	push   %ebx
+  801e13:	83 ec 10             	sub    $0x10,%esp
+  801e16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801e19:	68 b0 70 80 00       	push   $0x8070b0
+  801e1e:	e8 22 1a 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e29:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801e37:	76 3d                	jbe    801e76 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801e39:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801e3e:	39 c3                	cmp    %eax,%ebx
+  801e40:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801e43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e46:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801e4b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e56:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e5b:	e8 5e fe ff ff       	call   801cbe <fsipc>
+  801e60:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	68 b0 70 80 00       	push   $0x8070b0
+  801e6a:	e8 43 1a 00 00       	call   8038b2 <mutex_unlock>
+}
+  801e6f:	89 d8                	mov    %ebx,%eax
+  801e71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e74:	c9                   	leave
+  801e75:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801e76:	83 ec 04             	sub    $0x4,%esp
+  801e79:	53                   	push   %ebx
+  801e7a:	ff 75 0c             	push   0xc(%ebp)
+  801e7d:	68 0c 80 80 00       	push   $0x80800c
+  801e82:	e8 42 f0 ff ff       	call   800ec9 <memmove>
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8f:	eb b5                	jmp    801e46 <devfile_write+0x37>
+
+00801e91 <devfile_read>:
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	57                   	push   %edi
+  801e95:	56                   	push   %esi
+  801e96:	53                   	push   %ebx
+  801e97:	83 ec 0c             	sub    $0xc,%esp
+  801e9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ea0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801ea3:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ea9:	0f 86 8c 00 00 00    	jbe    801f3b <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801eaf:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801eb4:	39 c3                	cmp    %eax,%ebx
+  801eb6:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801eb9:	89 f8                	mov    %edi,%eax
+  801ebb:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801ebe:	eb 0f                	jmp    801ecf <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801ec0:	0f b6 08             	movzbl (%eax),%ecx
+  801ec3:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801ec5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801eca:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801ecf:	39 d0                	cmp    %edx,%eax
+  801ed1:	72 ed                	jb     801ec0 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801ed3:	83 ec 0c             	sub    $0xc,%esp
+  801ed6:	68 b0 70 80 00       	push   $0x8070b0
+  801edb:	e8 65 19 00 00       	call   803845 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ee0:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ee3:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801ee8:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801eee:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801efe:	e8 bb fd ff ff       	call   801cbe <fsipc>
+  801f03:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801f05:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  801f0c:	e8 a1 19 00 00       	call   8038b2 <mutex_unlock>
+		assert(r <= (int) n);
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	39 f3                	cmp    %esi,%ebx
+  801f16:	7c 0a                	jl     801f22 <devfile_read+0x91>
+}
+  801f18:	89 f0                	mov    %esi,%eax
+  801f1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f1d:	5b                   	pop    %ebx
+  801f1e:	5e                   	pop    %esi
+  801f1f:	5f                   	pop    %edi
+  801f20:	5d                   	pop    %ebp
+  801f21:	c3                   	ret
+		assert(r <= (int) n);
+  801f22:	68 f0 51 80 00       	push   $0x8051f0
+  801f27:	68 fd 51 80 00       	push   $0x8051fd
+  801f2c:	68 90 00 00 00       	push   $0x90
+  801f31:	68 12 52 80 00       	push   $0x805212
+  801f36:	e8 49 e7 ff ff       	call   800684 <_panic>
+	mutex_lock(&fsipc_mu);
+  801f3b:	83 ec 0c             	sub    $0xc,%esp
+  801f3e:	68 b0 70 80 00       	push   $0x8070b0
+  801f43:	e8 fd 18 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f48:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f4b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801f50:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801f56:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801f5d:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801f60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f65:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f6a:	e8 4f fd ff ff       	call   801cbe <fsipc>
+  801f6f:	89 c6                	mov    %eax,%esi
+  801f71:	83 c4 10             	add    $0x10,%esp
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 1d                	js     801f95 <devfile_read+0x104>
+		assert(r <= n);
+  801f78:	39 c3                	cmp    %eax,%ebx
+  801f7a:	72 2e                	jb     801faa <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801f7c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f81:	7f 40                	jg     801fc3 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f83:	83 ec 04             	sub    $0x4,%esp
+  801f86:	50                   	push   %eax
+  801f87:	68 00 80 80 00       	push   $0x808000
+  801f8c:	57                   	push   %edi
+  801f8d:	e8 37 ef ff ff       	call   800ec9 <memmove>
+  801f92:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801f95:	83 ec 0c             	sub    $0xc,%esp
+  801f98:	68 b0 70 80 00       	push   $0x8070b0
+  801f9d:	e8 10 19 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	e9 6e ff ff ff       	jmp    801f18 <devfile_read+0x87>
+		assert(r <= n);
+  801faa:	68 1d 52 80 00       	push   $0x80521d
+  801faf:	68 fd 51 80 00       	push   $0x8051fd
+  801fb4:	68 99 00 00 00       	push   $0x99
+  801fb9:	68 12 52 80 00       	push   $0x805212
+  801fbe:	e8 c1 e6 ff ff       	call   800684 <_panic>
+		assert(r <= PGSIZE);
+  801fc3:	68 24 52 80 00       	push   $0x805224
+  801fc8:	68 fd 51 80 00       	push   $0x8051fd
+  801fcd:	68 9a 00 00 00       	push   $0x9a
+  801fd2:	68 12 52 80 00       	push   $0x805212
+  801fd7:	e8 a8 e6 ff ff       	call   800684 <_panic>
+
+00801fdc <open>:
+{
+  801fdc:	55                   	push   %ebp
+  801fdd:	89 e5                	mov    %esp,%ebp
+  801fdf:	56                   	push   %esi
+  801fe0:	53                   	push   %ebx
+  801fe1:	83 ec 1c             	sub    $0x1c,%esp
+  801fe4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801fe7:	56                   	push   %esi
+  801fe8:	e8 1b ed ff ff       	call   800d08 <strlen>
+  801fed:	83 c4 10             	add    $0x10,%esp
+  801ff0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ff5:	0f 8f 85 00 00 00    	jg     802080 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802001:	50                   	push   %eax
+  802002:	e8 a7 f6 ff ff       	call   8016ae <fd_alloc>
+  802007:	89 c3                	mov    %eax,%ebx
+  802009:	83 c4 10             	add    $0x10,%esp
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	78 55                	js     802065 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802010:	83 ec 0c             	sub    $0xc,%esp
+  802013:	68 b0 70 80 00       	push   $0x8070b0
+  802018:	e8 28 18 00 00       	call   803845 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80201d:	83 c4 08             	add    $0x8,%esp
+  802020:	56                   	push   %esi
+  802021:	68 00 80 80 00       	push   $0x808000
+  802026:	e8 18 ed ff ff       	call   800d43 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80202b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80202e:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  802033:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802036:	b8 01 00 00 00       	mov    $0x1,%eax
+  80203b:	e8 7e fc ff ff       	call   801cbe <fsipc>
+  802040:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802042:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  802049:	e8 64 18 00 00       	call   8038b2 <mutex_unlock>
+	if (r < 0) {
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	85 db                	test   %ebx,%ebx
+  802053:	78 19                	js     80206e <open+0x92>
+	return fd2num(fd);
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	ff 75 f4             	push   -0xc(%ebp)
+  80205b:	e8 27 f6 ff ff       	call   801687 <fd2num>
+  802060:	89 c3                	mov    %eax,%ebx
+  802062:	83 c4 10             	add    $0x10,%esp
+}
+  802065:	89 d8                	mov    %ebx,%eax
+  802067:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5d                   	pop    %ebp
+  80206d:	c3                   	ret
+		fd_close(fd, 0);
+  80206e:	83 ec 08             	sub    $0x8,%esp
+  802071:	6a 00                	push   $0x0
+  802073:	ff 75 f4             	push   -0xc(%ebp)
+  802076:	e8 56 f7 ff ff       	call   8017d1 <fd_close>
+		return r;
+  80207b:	83 c4 10             	add    $0x10,%esp
+  80207e:	eb e5                	jmp    802065 <open+0x89>
+		return -E_BAD_PATH;
+  802080:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802085:	eb de                	jmp    802065 <open+0x89>
+
+00802087 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	53                   	push   %ebx
+  80208b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80208e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802091:	50                   	push   %eax
+  802092:	ff 75 08             	push   0x8(%ebp)
+  802095:	e8 6a f6 ff ff       	call   801704 <fd_lookup>
+  80209a:	89 c3                	mov    %eax,%ebx
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	78 5b                	js     8020fe <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8020a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a6:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8020ac:	39 08                	cmp    %ecx,(%eax)
+  8020ae:	75 55                	jne    802105 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8020b0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8020b4:	74 56                	je     80210c <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8020b6:	83 ec 0c             	sub    $0xc,%esp
+  8020b9:	68 b0 70 80 00       	push   $0x8070b0
+  8020be:	e8 82 17 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8020c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020c9:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  8020ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d1:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  8020d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020d9:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8020de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020e8:	e8 d1 fb ff ff       	call   801cbe <fsipc>
+  8020ed:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020ef:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  8020f6:	e8 b7 17 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+  8020fb:	83 c4 10             	add    $0x10,%esp
+}
+  8020fe:	89 d8                	mov    %ebx,%eax
+  802100:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+		return -E_NOT_SUPP;
+  802105:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80210a:	eb f2                	jmp    8020fe <fallocate+0x77>
+		return -E_INVAL;
+  80210c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802111:	eb eb                	jmp    8020fe <fallocate+0x77>
+
+00802113 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802113:	55                   	push   %ebp
+  802114:	89 e5                	mov    %esp,%ebp
+  802116:	56                   	push   %esi
+  802117:	53                   	push   %ebx
+  802118:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80211b:	89 f3                	mov    %esi,%ebx
+  80211d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802123:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802126:	eb 06                	jmp    80212e <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802128:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80212e:	39 f3                	cmp    %esi,%ebx
+  802130:	73 14                	jae    802146 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802132:	83 ec 08             	sub    $0x8,%esp
+  802135:	53                   	push   %ebx
+  802136:	6a 00                	push   $0x0
+  802138:	e8 dd f0 ff ff       	call   80121a <sys_page_unmap>
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	85 c0                	test   %eax,%eax
+  802142:	79 e4                	jns    802128 <munmap+0x15>
+  802144:	eb 05                	jmp    80214b <munmap+0x38>
+			return r;
+	return 0;
+  802146:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80214b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214e:	5b                   	pop    %ebx
+  80214f:	5e                   	pop    %esi
+  802150:	5d                   	pop    %ebp
+  802151:	c3                   	ret
+
+00802152 <mmap>:
+{
+  802152:	55                   	push   %ebp
+  802153:	89 e5                	mov    %esp,%ebp
+  802155:	57                   	push   %edi
+  802156:	56                   	push   %esi
+  802157:	53                   	push   %ebx
+  802158:	83 ec 24             	sub    $0x24,%esp
+  80215b:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80215e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802161:	50                   	push   %eax
+  802162:	ff 75 08             	push   0x8(%ebp)
+  802165:	e8 9a f5 ff ff       	call   801704 <fd_lookup>
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	0f 88 37 01 00 00    	js     8022ac <mmap+0x15a>
+		return NULL;
+  802175:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80217a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80217d:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802183:	39 0a                	cmp    %ecx,(%edx)
+  802185:	0f 85 05 01 00 00    	jne    802290 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80218b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802192:	0f 85 1b 01 00 00    	jne    8022b3 <mmap+0x161>
+  802198:	89 f0                	mov    %esi,%eax
+  80219a:	83 e8 01             	sub    $0x1,%eax
+  80219d:	0f 88 17 01 00 00    	js     8022ba <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8021a3:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8021a7:	75 28                	jne    8021d1 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8021a9:	83 ec 0c             	sub    $0xc,%esp
+  8021ac:	68 b0 70 80 00       	push   $0x8070b0
+  8021b1:	e8 8f 16 00 00       	call   803845 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8021b6:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8021bc:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8021ca:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8021cf:	eb 2b                	jmp    8021fc <mmap+0xaa>
+		cow_enable();
+  8021d1:	e8 f4 21 00 00       	call   8043ca <cow_enable>
+  8021d6:	eb d1                	jmp    8021a9 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8021d8:	89 c2                	mov    %eax,%edx
+  8021da:	c1 ea 0c             	shr    $0xc,%edx
+  8021dd:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8021e4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8021ea:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8021f0:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8021f3:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8021f5:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8021fa:	77 25                	ja     802221 <mmap+0xcf>
+  8021fc:	89 c2                	mov    %eax,%edx
+  8021fe:	29 da                	sub    %ebx,%edx
+  802200:	39 ca                	cmp    %ecx,%edx
+  802202:	73 3a                	jae    80223e <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	c1 ea 16             	shr    $0x16,%edx
+  802209:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802210:	f6 c2 01             	test   $0x1,%dl
+  802213:	75 c3                	jne    8021d8 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802215:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80221a:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80221f:	eb d4                	jmp    8021f5 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802221:	29 d8                	sub    %ebx,%eax
+  802223:	39 c8                	cmp    %ecx,%eax
+  802225:	73 17                	jae    80223e <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802227:	83 ec 0c             	sub    $0xc,%esp
+  80222a:	68 b0 70 80 00       	push   $0x8070b0
+  80222f:	e8 7e 16 00 00       	call   8038b2 <mutex_unlock>
+		return NULL;
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223c:	eb 52                	jmp    802290 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80223e:	85 db                	test   %ebx,%ebx
+  802240:	74 e5                	je     802227 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802242:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802245:	8b 40 0c             	mov    0xc(%eax),%eax
+  802248:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  80224d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802250:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802255:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  80225b:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802261:	8b 45 14             	mov    0x14(%ebp),%eax
+  802264:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802273:	e8 46 fa ff ff       	call   801cbe <fsipc>
+  802278:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80227a:	83 ec 0c             	sub    $0xc,%esp
+  80227d:	68 b0 70 80 00       	push   $0x8070b0
+  802282:	e8 2b 16 00 00       	call   8038b2 <mutex_unlock>
+	if (r < 0) {
+  802287:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80228a:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80228c:	85 ff                	test   %edi,%edi
+  80228e:	78 08                	js     802298 <mmap+0x146>
+}
+  802290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802293:	5b                   	pop    %ebx
+  802294:	5e                   	pop    %esi
+  802295:	5f                   	pop    %edi
+  802296:	5d                   	pop    %ebp
+  802297:	c3                   	ret
+		munmap((void*) va, len);
+  802298:	83 ec 08             	sub    $0x8,%esp
+  80229b:	56                   	push   %esi
+  80229c:	53                   	push   %ebx
+  80229d:	e8 71 fe ff ff       	call   802113 <munmap>
+		return NULL;
+  8022a2:	83 c4 10             	add    $0x10,%esp
+  8022a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022aa:	eb e4                	jmp    802290 <mmap+0x13e>
+		return NULL;
+  8022ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b1:	eb dd                	jmp    802290 <mmap+0x13e>
+		return NULL;
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b8:	eb d6                	jmp    802290 <mmap+0x13e>
+  8022ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bf:	eb cf                	jmp    802290 <mmap+0x13e>
+
+008022c1 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	53                   	push   %ebx
+  8022c5:	83 ec 10             	sub    $0x10,%esp
+  8022c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8022cb:	53                   	push   %ebx
+  8022cc:	e8 37 ea ff ff       	call   800d08 <strlen>
+  8022d1:	83 c4 10             	add    $0x10,%esp
+  8022d4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022d9:	7f 42                	jg     80231d <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	68 b0 70 80 00       	push   $0x8070b0
+  8022e3:	e8 5d 15 00 00       	call   803845 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8022e8:	83 c4 08             	add    $0x8,%esp
+  8022eb:	53                   	push   %ebx
+  8022ec:	68 00 80 80 00       	push   $0x808000
+  8022f1:	e8 4d ea ff ff       	call   800d43 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8022f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fb:	b8 07 00 00 00       	mov    $0x7,%eax
+  802300:	e8 b9 f9 ff ff       	call   801cbe <fsipc>
+  802305:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802307:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  80230e:	e8 9f 15 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+  802313:	83 c4 10             	add    $0x10,%esp
+}
+  802316:	89 d8                	mov    %ebx,%eax
+  802318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+		return -E_BAD_PATH;
+  80231d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802322:	eb f2                	jmp    802316 <remove+0x55>
+
+00802324 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	53                   	push   %ebx
+  802328:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80232b:	68 b0 70 80 00       	push   $0x8070b0
+  802330:	e8 10 15 00 00       	call   803845 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80233f:	e8 7a f9 ff ff       	call   801cbe <fsipc>
+  802344:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802346:	c7 04 24 b0 70 80 00 	movl   $0x8070b0,(%esp)
+  80234d:	e8 60 15 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+}
+  802352:	89 d8                	mov    %ebx,%eax
+  802354:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802357:	c9                   	leave
+  802358:	c3                   	ret
+
+00802359 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	56                   	push   %esi
+  80235d:	53                   	push   %ebx
+  80235e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802361:	83 ec 0c             	sub    $0xc,%esp
+  802364:	68 b0 70 80 00       	push   $0x8070b0
+  802369:	e8 d7 14 00 00       	call   803845 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80236e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802371:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802380:	e8 39 f9 ff ff       	call   801cbe <fsipc>
+  802385:	89 c6                	mov    %eax,%esi
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	85 db                	test   %ebx,%ebx
+  80238c:	74 7b                	je     802409 <fs_bcstat+0xb0>
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 77                	js     802409 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802392:	a1 00 80 80 00       	mov    0x808000,%eax
+  802397:	89 03                	mov    %eax,(%ebx)
+  802399:	a1 04 80 80 00       	mov    0x808004,%eax
+  80239e:	89 43 04             	mov    %eax,0x4(%ebx)
+  8023a1:	a1 08 80 80 00       	mov    0x808008,%eax
+  8023a6:	89 43 08             	mov    %eax,0x8(%ebx)
+  8023a9:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8023ae:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8023b1:	a1 10 80 80 00       	mov    0x808010,%eax
+  8023b6:	89 43 10             	mov    %eax,0x10(%ebx)
+  8023b9:	a1 14 80 80 00       	mov    0x808014,%eax
+  8023be:	89 43 14             	mov    %eax,0x14(%ebx)
+  8023c1:	a1 18 80 80 00       	mov    0x808018,%eax
+  8023c6:	89 43 18             	mov    %eax,0x18(%ebx)
+  8023c9:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8023ce:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8023d1:	a1 20 80 80 00       	mov    0x808020,%eax
+  8023d6:	89 43 20             	mov    %eax,0x20(%ebx)
+  8023d9:	a1 24 80 80 00       	mov    0x808024,%eax
+  8023de:	89 43 24             	mov    %eax,0x24(%ebx)
+  8023e1:	a1 28 80 80 00       	mov    0x808028,%eax
+  8023e6:	89 43 28             	mov    %eax,0x28(%ebx)
+  8023e9:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8023ee:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8023f1:	a1 30 80 80 00       	mov    0x808030,%eax
+  8023f6:	89 43 30             	mov    %eax,0x30(%ebx)
+  8023f9:	a1 34 80 80 00       	mov    0x808034,%eax
+  8023fe:	89 43 34             	mov    %eax,0x34(%ebx)
+  802401:	a1 38 80 80 00       	mov    0x808038,%eax
+  802406:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802409:	83 ec 0c             	sub    $0xc,%esp
+  80240c:	68 b0 70 80 00       	push   $0x8070b0
+  802411:	e8 9c 14 00 00       	call   8038b2 <mutex_unlock>
+	return r;
+}
+  802416:	89 f0                	mov    %esi,%eax
+  802418:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80241b:	5b                   	pop    %ebx
+  80241c:	5e                   	pop    %esi
+  80241d:	5d                   	pop    %ebp
+  80241e:	c3                   	ret
+
+0080241f <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80241f:	55                   	push   %ebp
+  802420:	89 e5                	mov    %esp,%ebp
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802426:	0f b6 10             	movzbl (%eax),%edx
+  802429:	80 fa 72             	cmp    $0x72,%dl
+  80242c:	74 44                	je     802472 <parse_mode+0x53>
+  80242e:	80 fa 77             	cmp    $0x77,%dl
+  802431:	74 4b                	je     80247e <parse_mode+0x5f>
+  802433:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802438:	80 fa 61             	cmp    $0x61,%dl
+  80243b:	74 09                	je     802446 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80243d:	89 d8                	mov    %ebx,%eax
+  80243f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+	switch (mode[0]) {
+  802446:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80244b:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802450:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802452:	83 ec 08             	sub    $0x8,%esp
+  802455:	6a 2b                	push   $0x2b
+  802457:	50                   	push   %eax
+  802458:	e8 f8 e9 ff ff       	call   800e55 <strchr>
+  80245d:	83 c4 10             	add    $0x10,%esp
+  802460:	85 c0                	test   %eax,%eax
+  802462:	74 d9                	je     80243d <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802464:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802467:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80246a:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802470:	eb cb                	jmp    80243d <parse_mode+0x1e>
+	switch (mode[0]) {
+  802472:	ba 01 00 00 00       	mov    $0x1,%edx
+  802477:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80247c:	eb d2                	jmp    802450 <parse_mode+0x31>
+  80247e:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802483:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802488:	eb c6                	jmp    802450 <parse_mode+0x31>
+
+0080248a <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80248a:	55                   	push   %ebp
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	57                   	push   %edi
+  80248e:	56                   	push   %esi
+  80248f:	53                   	push   %ebx
+  802490:	83 ec 1c             	sub    $0x1c,%esp
+  802493:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802496:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802499:	b8 24 60 80 00       	mov    $0x806024,%eax
+  80249e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8024a3:	83 c0 24             	add    $0x24,%eax
+  8024a6:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8024aa:	74 17                	je     8024c3 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8024ac:	83 c3 01             	add    $0x1,%ebx
+  8024af:	83 fb 10             	cmp    $0x10,%ebx
+  8024b2:	75 ef                	jne    8024a3 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8024b4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8024b9:	89 f0                	mov    %esi,%eax
+  8024bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024be:	5b                   	pop    %ebx
+  8024bf:	5e                   	pop    %esi
+  8024c0:	5f                   	pop    %edi
+  8024c1:	5d                   	pop    %ebp
+  8024c2:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8024c3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8024ca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8024cd:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8024d0:	c1 e7 02             	shl    $0x2,%edi
+  8024d3:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8024d9:	83 ec 04             	sub    $0x4,%esp
+  8024dc:	6a 24                	push   $0x24
+  8024de:	6a 00                	push   $0x0
+  8024e0:	56                   	push   %esi
+  8024e1:	e8 ae e9 ff ff       	call   800e94 <memset>
+			streams[i].f_fd = fd;
+  8024e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8024e9:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8024ef:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024f2:	01 d8                	add    %ebx,%eax
+  8024f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024f7:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	eb b6                	jmp    8024b9 <stream_alloc+0x2f>
+
+00802503 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	53                   	push   %ebx
+  802507:	83 ec 14             	sub    $0x14,%esp
+  80250a:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80250c:	8b 40 18             	mov    0x18(%eax),%eax
+  80250f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802512:	74 4a                	je     80255e <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802514:	83 ec 08             	sub    $0x8,%esp
+  802517:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80251a:	50                   	push   %eax
+  80251b:	ff 33                	push   (%ebx)
+  80251d:	e8 e2 f1 ff ff       	call   801704 <fd_lookup>
+  802522:	89 c2                	mov    %eax,%edx
+  802524:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802527:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80252c:	85 d2                	test   %edx,%edx
+  80252e:	78 41                	js     802571 <stream_unread+0x6e>
+  802530:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802533:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802539:	39 0a                	cmp    %ecx,(%edx)
+  80253b:	75 34                	jne    802571 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80253d:	8b 43 14             	mov    0x14(%ebx),%eax
+  802540:	03 42 04             	add    0x4(%edx),%eax
+  802543:	2b 43 18             	sub    0x18(%ebx),%eax
+  802546:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802549:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802550:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802557:	b8 01 00 00 00       	mov    $0x1,%eax
+  80255c:	eb 13                	jmp    802571 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80255e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802565:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80256c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+00802576 <stream_drain>:
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	56                   	push   %esi
+  80257a:	53                   	push   %ebx
+  80257b:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80257d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802582:	eb 02                	jmp    802586 <stream_drain+0x10>
+  802584:	01 c3                	add    %eax,%ebx
+  802586:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802589:	39 c3                	cmp    %eax,%ebx
+  80258b:	73 43                	jae    8025d0 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80258d:	83 ec 04             	sub    $0x4,%esp
+  802590:	29 d8                	sub    %ebx,%eax
+  802592:	50                   	push   %eax
+  802593:	89 d8                	mov    %ebx,%eax
+  802595:	03 46 0c             	add    0xc(%esi),%eax
+  802598:	50                   	push   %eax
+  802599:	ff 36                	push   (%esi)
+  80259b:	e8 ec f4 ff ff       	call   801a8c <write>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	7f dd                	jg     802584 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8025a7:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8025ab:	8b 56 0c             	mov    0xc(%esi),%edx
+  8025ae:	83 ec 04             	sub    $0x4,%esp
+  8025b1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8025b4:	29 d8                	sub    %ebx,%eax
+  8025b6:	50                   	push   %eax
+  8025b7:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8025ba:	50                   	push   %eax
+  8025bb:	52                   	push   %edx
+  8025bc:	e8 08 e9 ff ff       	call   800ec9 <memmove>
+			f->f_wend -= done;
+  8025c1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8025c4:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8025ce:	eb 0a                	jmp    8025da <stream_drain+0x64>
+  8025d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8025d5:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8025da:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8025dd:	89 d0                	mov    %edx,%eax
+  8025df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e2:	5b                   	pop    %ebx
+  8025e3:	5e                   	pop    %esi
+  8025e4:	5d                   	pop    %ebp
+  8025e5:	c3                   	ret
+
+008025e6 <stream_setup>:
+	if (f->f_buf)
+  8025e6:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8025ea:	74 01                	je     8025ed <stream_setup+0x7>
+  8025ec:	c3                   	ret
+{
+  8025ed:	55                   	push   %ebp
+  8025ee:	89 e5                	mov    %esp,%ebp
+  8025f0:	53                   	push   %ebx
+  8025f1:	83 ec 04             	sub    $0x4,%esp
+  8025f4:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8025f6:	8b 40 08             	mov    0x8(%eax),%eax
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	74 17                	je     802614 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8025fd:	83 f8 03             	cmp    $0x3,%eax
+  802600:	75 2d                	jne    80262f <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802602:	8d 43 20             	lea    0x20(%ebx),%eax
+  802605:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802608:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80260f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802612:	c9                   	leave
+  802613:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802614:	83 ec 0c             	sub    $0xc,%esp
+  802617:	ff 33                	push   (%ebx)
+  802619:	e8 29 1b 00 00       	call   804147 <iscons>
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	85 c0                	test   %eax,%eax
+  802623:	0f 9f c0             	setg   %al
+  802626:	0f b6 c0             	movzbl %al,%eax
+  802629:	83 c0 01             	add    $0x1,%eax
+  80262c:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80262f:	83 ec 0c             	sub    $0xc,%esp
+  802632:	68 00 10 00 00       	push   $0x1000
+  802637:	e8 6e 0b 00 00       	call   8031aa <malloc>
+  80263c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80263f:	83 c4 10             	add    $0x10,%esp
+  802642:	85 c0                	test   %eax,%eax
+  802644:	74 bc                	je     802602 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802646:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80264d:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802651:	eb bc                	jmp    80260f <stream_setup+0x29>
+
+00802653 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802653:	55                   	push   %ebp
+  802654:	89 e5                	mov    %esp,%ebp
+  802656:	53                   	push   %ebx
+  802657:	83 ec 04             	sub    $0x4,%esp
+  80265a:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80265c:	e8 85 ff ff ff       	call   8025e6 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802661:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802666:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80266a:	74 3d                	je     8026a9 <stream_fill+0x56>
+  80266c:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802670:	74 10                	je     802682 <stream_fill+0x2f>
+  802672:	89 d8                	mov    %ebx,%eax
+  802674:	e8 fd fe ff ff       	call   802576 <stream_drain>
+		return 0;
+  802679:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	78 27                	js     8026a9 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802682:	83 ec 04             	sub    $0x4,%esp
+  802685:	ff 73 10             	push   0x10(%ebx)
+  802688:	ff 73 0c             	push   0xc(%ebx)
+  80268b:	ff 33                	push   (%ebx)
+  80268d:	e8 02 f3 ff ff       	call   801994 <read>
+  802692:	83 c4 10             	add    $0x10,%esp
+  802695:	85 c0                	test   %eax,%eax
+  802697:	7e 17                	jle    8026b0 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802699:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80269d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8026a4:	89 c2                	mov    %eax,%edx
+  8026a6:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8026a9:	89 d0                	mov    %edx,%eax
+  8026ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8026b0:	c1 f8 1f             	sar    $0x1f,%eax
+  8026b3:	83 e0 04             	and    $0x4,%eax
+  8026b6:	83 c0 04             	add    $0x4,%eax
+  8026b9:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8026bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c1:	eb e6                	jmp    8026a9 <stream_fill+0x56>
+
+008026c3 <fopen>:
+{
+  8026c3:	55                   	push   %ebp
+  8026c4:	89 e5                	mov    %esp,%ebp
+  8026c6:	57                   	push   %edi
+  8026c7:	56                   	push   %esi
+  8026c8:	53                   	push   %ebx
+  8026c9:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8026cf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8026d2:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8026d8:	89 f0                	mov    %esi,%eax
+  8026da:	e8 40 fd ff ff       	call   80241f <parse_mode>
+		return 0;
+  8026df:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	78 2d                	js     802715 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8026e8:	83 ec 08             	sub    $0x8,%esp
+  8026eb:	50                   	push   %eax
+  8026ec:	ff 75 08             	push   0x8(%ebp)
+  8026ef:	e8 e8 f8 ff ff       	call   801fdc <open>
+  8026f4:	89 c7                	mov    %eax,%edi
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 58                	js     802755 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8026fd:	80 3e 61             	cmpb   $0x61,(%esi)
+  802700:	74 1d                	je     80271f <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802702:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802708:	89 f8                	mov    %edi,%eax
+  80270a:	e8 7b fd ff ff       	call   80248a <stream_alloc>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	85 c0                	test   %eax,%eax
+  802713:	74 32                	je     802747 <fopen+0x84>
+}
+  802715:	89 d8                	mov    %ebx,%eax
+  802717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271a:	5b                   	pop    %ebx
+  80271b:	5e                   	pop    %esi
+  80271c:	5f                   	pop    %edi
+  80271d:	5d                   	pop    %ebp
+  80271e:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80271f:	83 ec 08             	sub    $0x8,%esp
+  802722:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802728:	50                   	push   %eax
+  802729:	57                   	push   %edi
+  80272a:	e8 db f4 ff ff       	call   801c0a <fstat>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 cc                	js     802702 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802736:	83 ec 08             	sub    $0x8,%esp
+  802739:	ff 75 dc             	push   -0x24(%ebp)
+  80273c:	57                   	push   %edi
+  80273d:	e8 f6 f3 ff ff       	call   801b38 <seek>
+  802742:	83 c4 10             	add    $0x10,%esp
+  802745:	eb bb                	jmp    802702 <fopen+0x3f>
+		close(fd);
+  802747:	83 ec 0c             	sub    $0xc,%esp
+  80274a:	57                   	push   %edi
+  80274b:	e8 08 f1 ff ff       	call   801858 <close>
+  802750:	83 c4 10             	add    $0x10,%esp
+  802753:	eb c0                	jmp    802715 <fopen+0x52>
+		return 0;
+  802755:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275a:	eb b9                	jmp    802715 <fopen+0x52>
+
+0080275c <fdopen>:
+{
+  80275c:	55                   	push   %ebp
+  80275d:	89 e5                	mov    %esp,%ebp
+  80275f:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802762:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802765:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802768:	e8 b2 fc ff ff       	call   80241f <parse_mode>
+  80276d:	89 c2                	mov    %eax,%edx
+		return 0;
+  80276f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802774:	85 d2                	test   %edx,%edx
+  802776:	78 0b                	js     802783 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802778:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277e:	e8 07 fd ff ff       	call   80248a <stream_alloc>
+}
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+00802785 <setvbuf>:
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	57                   	push   %edi
+  802789:	56                   	push   %esi
+  80278a:	53                   	push   %ebx
+  80278b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802791:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802794:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802798:	75 3a                	jne    8027d4 <setvbuf+0x4f>
+  80279a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80279d:	83 fe 02             	cmp    $0x2,%esi
+  8027a0:	77 39                	ja     8027db <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8027a2:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8027a5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8027a9:	0f 95 c3             	setne  %bl
+  8027ac:	85 ff                	test   %edi,%edi
+  8027ae:	0f 95 c1             	setne  %cl
+  8027b1:	84 cb                	test   %cl,%bl
+  8027b3:	74 05                	je     8027ba <setvbuf+0x35>
+  8027b5:	83 fa 03             	cmp    $0x3,%edx
+  8027b8:	75 0a                	jne    8027c4 <setvbuf+0x3f>
+	return 0;
+  8027ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027bf:	5b                   	pop    %ebx
+  8027c0:	5e                   	pop    %esi
+  8027c1:	5f                   	pop    %edi
+  8027c2:	5d                   	pop    %ebp
+  8027c3:	c3                   	ret
+		f->f_buf = buf;
+  8027c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027c7:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8027ca:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8027cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d2:	eb eb                	jmp    8027bf <setvbuf+0x3a>
+		return EOF;
+  8027d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027d9:	eb e4                	jmp    8027bf <setvbuf+0x3a>
+  8027db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027e0:	eb dd                	jmp    8027bf <setvbuf+0x3a>
+
+008027e2 <fflush>:
+{
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	57                   	push   %edi
+  8027e6:	56                   	push   %esi
+  8027e7:	53                   	push   %ebx
+  8027e8:	83 ec 0c             	sub    $0xc,%esp
+  8027eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8027ee:	85 db                	test   %ebx,%ebx
+  8027f0:	74 1a                	je     80280c <fflush+0x2a>
+	stream_unread(f);
+  8027f2:	89 d8                	mov    %ebx,%eax
+  8027f4:	e8 0a fd ff ff       	call   802503 <stream_unread>
+	return stream_drain(f);
+  8027f9:	89 d8                	mov    %ebx,%eax
+  8027fb:	e8 76 fd ff ff       	call   802576 <stream_drain>
+  802800:	89 c7                	mov    %eax,%edi
+}
+  802802:	89 f8                	mov    %edi,%eax
+  802804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802807:	5b                   	pop    %ebx
+  802808:	5e                   	pop    %esi
+  802809:	5f                   	pop    %edi
+  80280a:	5d                   	pop    %ebp
+  80280b:	c3                   	ret
+  80280c:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802811:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802816:	bf 00 00 00 00       	mov    $0x0,%edi
+  80281b:	eb 03                	jmp    802820 <fflush+0x3e>
+  80281d:	83 c3 24             	add    $0x24,%ebx
+  802820:	39 f3                	cmp    %esi,%ebx
+  802822:	74 de                	je     802802 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802824:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802828:	74 f3                	je     80281d <fflush+0x3b>
+  80282a:	83 ec 0c             	sub    $0xc,%esp
+  80282d:	53                   	push   %ebx
+  80282e:	e8 af ff ff ff       	call   8027e2 <fflush>
+  802833:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802836:	85 c0                	test   %eax,%eax
+  802838:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80283d:	0f 48 f8             	cmovs  %eax,%edi
+  802840:	eb db                	jmp    80281d <fflush+0x3b>
+
+00802842 <fclose>:
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	56                   	push   %esi
+  80284e:	e8 8f ff ff ff       	call   8027e2 <fflush>
+  802853:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802855:	83 c4 04             	add    $0x4,%esp
+  802858:	ff 36                	push   (%esi)
+  80285a:	e8 f9 ef ff ff       	call   801858 <close>
+  80285f:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802862:	85 c0                	test   %eax,%eax
+  802864:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802869:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80286c:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802870:	75 10                	jne    802882 <fclose+0x40>
+	f->f_flags = 0;
+  802872:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802879:	89 d8                	mov    %ebx,%eax
+  80287b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287e:	5b                   	pop    %ebx
+  80287f:	5e                   	pop    %esi
+  802880:	5d                   	pop    %ebp
+  802881:	c3                   	ret
+		free(f->f_buf);
+  802882:	83 ec 0c             	sub    $0xc,%esp
+  802885:	ff 76 0c             	push   0xc(%esi)
+  802888:	e8 54 08 00 00       	call   8030e1 <free>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	eb e0                	jmp    802872 <fclose+0x30>
+
+00802892 <fileno>:
+{
+  802892:	55                   	push   %ebp
+  802893:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802895:	8b 45 08             	mov    0x8(%ebp),%eax
+  802898:	8b 00                	mov    (%eax),%eax
+}
+  80289a:	5d                   	pop    %ebp
+  80289b:	c3                   	ret
+
+0080289c <feof>:
+{
+  80289c:	55                   	push   %ebp
+  80289d:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80289f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a2:	8b 40 04             	mov    0x4(%eax),%eax
+  8028a5:	c1 e8 02             	shr    $0x2,%eax
+  8028a8:	83 e0 01             	and    $0x1,%eax
+}
+  8028ab:	5d                   	pop    %ebp
+  8028ac:	c3                   	ret
+
+008028ad <ferror>:
+{
+  8028ad:	55                   	push   %ebp
+  8028ae:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8028b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b3:	8b 40 04             	mov    0x4(%eax),%eax
+  8028b6:	c1 e8 03             	shr    $0x3,%eax
+  8028b9:	83 e0 01             	and    $0x1,%eax
+}
+  8028bc:	5d                   	pop    %ebp
+  8028bd:	c3                   	ret
+
+008028be <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8028be:	55                   	push   %ebp
+  8028bf:	89 e5                	mov    %esp,%ebp
+  8028c1:	53                   	push   %ebx
+  8028c2:	83 ec 04             	sub    $0x4,%esp
+  8028c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8028c8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028cb:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8028ce:	74 15                	je     8028e5 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8028d0:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8028d3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028d6:	8d 48 01             	lea    0x1(%eax),%ecx
+  8028d9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8028dc:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8028e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e3:	c9                   	leave
+  8028e4:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8028e5:	89 d8                	mov    %ebx,%eax
+  8028e7:	e8 67 fd ff ff       	call   802653 <stream_fill>
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	75 e0                	jne    8028d0 <fgetc+0x12>
+		return EOF;
+  8028f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8028f5:	eb e9                	jmp    8028e0 <fgetc+0x22>
+
+008028f7 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	57                   	push   %edi
+  8028fb:	56                   	push   %esi
+  8028fc:	53                   	push   %ebx
+  8028fd:	83 ec 1c             	sub    $0x1c,%esp
+  802900:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802903:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802908:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80290b:	83 e8 01             	sub    $0x1,%eax
+  80290e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802911:	eb 66                	jmp    802979 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802913:	8b 46 14             	mov    0x14(%esi),%eax
+  802916:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802919:	29 c3                	sub    %eax,%ebx
+  80291b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80291e:	29 fa                	sub    %edi,%edx
+  802920:	39 d3                	cmp    %edx,%ebx
+  802922:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802925:	83 ec 04             	sub    $0x4,%esp
+  802928:	53                   	push   %ebx
+  802929:	6a 0a                	push   $0xa
+  80292b:	03 46 0c             	add    0xc(%esi),%eax
+  80292e:	50                   	push   %eax
+  80292f:	e8 46 e6 ff ff       	call   800f7a <memfind>
+  802934:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802937:	8b 46 0c             	mov    0xc(%esi),%eax
+  80293a:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80293d:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802940:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802948:	74 0b                	je     802955 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80294a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80294d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802950:	29 d3                	sub    %edx,%ebx
+  802952:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802955:	83 ec 04             	sub    $0x4,%esp
+  802958:	53                   	push   %ebx
+  802959:	01 c8                	add    %ecx,%eax
+  80295b:	50                   	push   %eax
+  80295c:	89 f8                	mov    %edi,%eax
+  80295e:	03 45 08             	add    0x8(%ebp),%eax
+  802961:	50                   	push   %eax
+  802962:	e8 62 e5 ff ff       	call   800ec9 <memmove>
+		f->f_rpos += m;
+  802967:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80296a:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80296c:	83 c4 10             	add    $0x10,%esp
+  80296f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802972:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802977:	74 1f                	je     802998 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802979:	8d 47 01             	lea    0x1(%edi),%eax
+  80297c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80297f:	73 17                	jae    802998 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802981:	8b 46 18             	mov    0x18(%esi),%eax
+  802984:	39 46 14             	cmp    %eax,0x14(%esi)
+  802987:	75 8a                	jne    802913 <fgets+0x1c>
+  802989:	89 f0                	mov    %esi,%eax
+  80298b:	e8 c3 fc ff ff       	call   802653 <stream_fill>
+  802990:	85 c0                	test   %eax,%eax
+  802992:	0f 85 7b ff ff ff    	jne    802913 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802998:	85 ff                	test   %edi,%edi
+  80299a:	74 0f                	je     8029ab <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80299c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8029a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a6:	5b                   	pop    %ebx
+  8029a7:	5e                   	pop    %esi
+  8029a8:	5f                   	pop    %edi
+  8029a9:	5d                   	pop    %ebp
+  8029aa:	c3                   	ret
+		return 0;
+  8029ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b0:	eb f1                	jmp    8029a3 <fgets+0xac>
+
+008029b2 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	57                   	push   %edi
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	83 ec 1c             	sub    $0x1c,%esp
+  8029bb:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8029be:	89 f0                	mov    %esi,%eax
+  8029c0:	e8 21 fc ff ff       	call   8025e6 <stream_setup>
+	want = size * n;
+  8029c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029c8:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8029cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8029cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d4:	eb 43                	jmp    802a19 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8029d6:	29 d3                	sub    %edx,%ebx
+  8029d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029db:	29 f8                	sub    %edi,%eax
+  8029dd:	39 c3                	cmp    %eax,%ebx
+  8029df:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8029e2:	83 ec 04             	sub    $0x4,%esp
+  8029e5:	53                   	push   %ebx
+  8029e6:	03 56 0c             	add    0xc(%esi),%edx
+  8029e9:	52                   	push   %edx
+  8029ea:	89 f8                	mov    %edi,%eax
+  8029ec:	03 45 08             	add    0x8(%ebp),%eax
+  8029ef:	50                   	push   %eax
+  8029f0:	e8 d4 e4 ff ff       	call   800ec9 <memmove>
+			f->f_rpos += m;
+  8029f5:	01 5e 14             	add    %ebx,0x14(%esi)
+  8029f8:	83 c4 10             	add    $0x10,%esp
+  8029fb:	eb 1a                	jmp    802a17 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	53                   	push   %ebx
+  802a01:	89 f8                	mov    %edi,%eax
+  802a03:	03 45 08             	add    0x8(%ebp),%eax
+  802a06:	50                   	push   %eax
+  802a07:	ff 36                	push   (%esi)
+  802a09:	e8 86 ef ff ff       	call   801994 <read>
+  802a0e:	89 c3                	mov    %eax,%ebx
+  802a10:	83 c4 10             	add    $0x10,%esp
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	7e 36                	jle    802a4d <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802a17:	01 df                	add    %ebx,%edi
+  802a19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a1c:	39 c7                	cmp    %eax,%edi
+  802a1e:	73 39                	jae    802a59 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802a20:	8b 56 14             	mov    0x14(%esi),%edx
+  802a23:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802a26:	39 da                	cmp    %ebx,%edx
+  802a28:	72 ac                	jb     8029d6 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802a2a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802a2d:	29 fb                	sub    %edi,%ebx
+  802a2f:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802a32:	72 3e                	jb     802a72 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802a34:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802a38:	74 1f                	je     802a59 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802a3a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802a3e:	74 bd                	je     8029fd <fread+0x4b>
+  802a40:	89 f0                	mov    %esi,%eax
+  802a42:	e8 2f fb ff ff       	call   802576 <stream_drain>
+  802a47:	85 c0                	test   %eax,%eax
+  802a49:	79 b2                	jns    8029fd <fread+0x4b>
+  802a4b:	eb 0c                	jmp    802a59 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802a4d:	c1 fb 1f             	sar    $0x1f,%ebx
+  802a50:	83 e3 04             	and    $0x4,%ebx
+  802a53:	83 c3 04             	add    $0x4,%ebx
+  802a56:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802a59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	74 0a                	je     802a6a <fread+0xb8>
+  802a60:	89 f8                	mov    %edi,%eax
+  802a62:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a67:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a6d:	5b                   	pop    %ebx
+  802a6e:	5e                   	pop    %esi
+  802a6f:	5f                   	pop    %edi
+  802a70:	5d                   	pop    %ebp
+  802a71:	c3                   	ret
+		} else if (!stream_fill(f))
+  802a72:	89 f0                	mov    %esi,%eax
+  802a74:	e8 da fb ff ff       	call   802653 <stream_fill>
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	74 dc                	je     802a59 <fread+0xa7>
+			m = 0;
+  802a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a82:	eb 93                	jmp    802a17 <fread+0x65>
+
+00802a84 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802a84:	55                   	push   %ebp
+  802a85:	89 e5                	mov    %esp,%ebp
+  802a87:	57                   	push   %edi
+  802a88:	56                   	push   %esi
+  802a89:	53                   	push   %ebx
+  802a8a:	83 ec 1c             	sub    $0x1c,%esp
+  802a8d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802a90:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a93:	a8 02                	test   $0x2,%al
+  802a95:	75 13                	jne    802aaa <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802a97:	83 c8 08             	or     $0x8,%eax
+  802a9a:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aa5:	5b                   	pop    %ebx
+  802aa6:	5e                   	pop    %esi
+  802aa7:	5f                   	pop    %edi
+  802aa8:	5d                   	pop    %ebp
+  802aa9:	c3                   	ret
+	stream_setup(f);
+  802aaa:	89 d8                	mov    %ebx,%eax
+  802aac:	e8 35 fb ff ff       	call   8025e6 <stream_setup>
+	want = size * n;
+  802ab1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab4:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802ab8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802abb:	89 d8                	mov    %ebx,%eax
+  802abd:	e8 41 fa ff ff       	call   802503 <stream_unread>
+	for (done = 0; done < want; ) {
+  802ac2:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802ac7:	84 c0                	test   %al,%al
+  802ac9:	75 7b                	jne    802b46 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802acb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802ad3:	39 fe                	cmp    %edi,%esi
+  802ad5:	73 24                	jae    802afb <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802ad7:	83 ec 04             	sub    $0x4,%esp
+  802ada:	89 f8                	mov    %edi,%eax
+  802adc:	29 f0                	sub    %esi,%eax
+  802ade:	50                   	push   %eax
+  802adf:	89 f0                	mov    %esi,%eax
+  802ae1:	03 45 08             	add    0x8(%ebp),%eax
+  802ae4:	50                   	push   %eax
+  802ae5:	ff 33                	push   (%ebx)
+  802ae7:	e8 a0 ef ff ff       	call   801a8c <write>
+  802aec:	83 c4 10             	add    $0x10,%esp
+  802aef:	85 c0                	test   %eax,%eax
+  802af1:	7e 04                	jle    802af7 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802af3:	01 c6                	add    %eax,%esi
+  802af5:	eb dc                	jmp    802ad3 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802af7:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802afb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	74 a0                	je     802aa2 <fwrite+0x1e>
+  802b02:	89 f0                	mov    %esi,%eax
+  802b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b09:	f7 75 0c             	divl   0xc(%ebp)
+  802b0c:	eb 94                	jmp    802aa2 <fwrite+0x1e>
+			done += r;
+  802b0e:	01 c7                	add    %eax,%edi
+			continue;
+  802b10:	eb 34                	jmp    802b46 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802b12:	8b 73 10             	mov    0x10(%ebx),%esi
+  802b15:	29 c6                	sub    %eax,%esi
+  802b17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b1a:	29 fa                	sub    %edi,%edx
+  802b1c:	39 d6                	cmp    %edx,%esi
+  802b1e:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802b21:	83 ec 04             	sub    $0x4,%esp
+  802b24:	56                   	push   %esi
+  802b25:	89 fa                	mov    %edi,%edx
+  802b27:	03 55 08             	add    0x8(%ebp),%edx
+  802b2a:	52                   	push   %edx
+  802b2b:	03 43 0c             	add    0xc(%ebx),%eax
+  802b2e:	50                   	push   %eax
+  802b2f:	e8 95 e3 ff ff       	call   800ec9 <memmove>
+		f->f_wend += m;
+  802b34:	89 f0                	mov    %esi,%eax
+  802b36:	03 43 1c             	add    0x1c(%ebx),%eax
+  802b39:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802b3c:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802b3e:	83 c4 10             	add    $0x10,%esp
+  802b41:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802b44:	74 5b                	je     802ba1 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802b46:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b49:	39 c7                	cmp    %eax,%edi
+  802b4b:	73 2d                	jae    802b7a <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802b4d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	75 be                	jne    802b12 <fwrite+0x8e>
+  802b54:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b57:	29 fa                	sub    %edi,%edx
+  802b59:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802b5c:	72 b4                	jb     802b12 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802b5e:	83 ec 04             	sub    $0x4,%esp
+  802b61:	52                   	push   %edx
+  802b62:	89 f8                	mov    %edi,%eax
+  802b64:	03 45 08             	add    0x8(%ebp),%eax
+  802b67:	50                   	push   %eax
+  802b68:	ff 33                	push   (%ebx)
+  802b6a:	e8 1d ef ff ff       	call   801a8c <write>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+  802b72:	85 c0                	test   %eax,%eax
+  802b74:	7f 98                	jg     802b0e <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802b76:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802b7a:	8b 43 08             	mov    0x8(%ebx),%eax
+  802b7d:	83 f8 03             	cmp    $0x3,%eax
+  802b80:	74 48                	je     802bca <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802b82:	83 f8 02             	cmp    $0x2,%eax
+  802b85:	74 27                	je     802bae <fwrite+0x12a>
+	return size ? done / size : 0;
+  802b87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8a:	85 c0                	test   %eax,%eax
+  802b8c:	0f 84 10 ff ff ff    	je     802aa2 <fwrite+0x1e>
+  802b92:	89 f8                	mov    %edi,%eax
+  802b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b99:	f7 75 0c             	divl   0xc(%ebp)
+  802b9c:	e9 01 ff ff ff       	jmp    802aa2 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802ba1:	89 d8                	mov    %ebx,%eax
+  802ba3:	e8 ce f9 ff ff       	call   802576 <stream_drain>
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	79 9a                	jns    802b46 <fwrite+0xc2>
+  802bac:	eb cc                	jmp    802b7a <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802bae:	83 ec 04             	sub    $0x4,%esp
+  802bb1:	57                   	push   %edi
+  802bb2:	6a 0a                	push   $0xa
+  802bb4:	ff 75 08             	push   0x8(%ebp)
+  802bb7:	e8 be e3 ff ff       	call   800f7a <memfind>
+  802bbc:	89 c2                	mov    %eax,%edx
+  802bbe:	89 f8                	mov    %edi,%eax
+  802bc0:	03 45 08             	add    0x8(%ebp),%eax
+  802bc3:	83 c4 10             	add    $0x10,%esp
+  802bc6:	39 c2                	cmp    %eax,%edx
+  802bc8:	74 bd                	je     802b87 <fwrite+0x103>
+		stream_drain(f);
+  802bca:	89 d8                	mov    %ebx,%eax
+  802bcc:	e8 a5 f9 ff ff       	call   802576 <stream_drain>
+  802bd1:	eb b4                	jmp    802b87 <fwrite+0x103>
+
+00802bd3 <fputc>:
+{
+  802bd3:	55                   	push   %ebp
+  802bd4:	89 e5                	mov    %esp,%ebp
+  802bd6:	53                   	push   %ebx
+  802bd7:	83 ec 14             	sub    $0x14,%esp
+  802bda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802bdd:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802be0:	ff 75 0c             	push   0xc(%ebp)
+  802be3:	6a 01                	push   $0x1
+  802be5:	6a 01                	push   $0x1
+  802be7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bea:	50                   	push   %eax
+  802beb:	e8 94 fe ff ff       	call   802a84 <fwrite>
+  802bf0:	83 c4 10             	add    $0x10,%esp
+  802bf3:	0f b6 db             	movzbl %bl,%ebx
+  802bf6:	83 f8 01             	cmp    $0x1,%eax
+  802bf9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bfe:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802c01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c04:	c9                   	leave
+  802c05:	c3                   	ret
+
+00802c06 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802c0c:	ff 75 0c             	push   0xc(%ebp)
+  802c0f:	ff 75 08             	push   0x8(%ebp)
+  802c12:	e8 bc ff ff ff       	call   802bd3 <fputc>
+}
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	c9                   	leave
+  802c1b:	c3                   	ret
+
+00802c1c <fputs>:
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	56                   	push   %esi
+  802c20:	53                   	push   %ebx
+  802c21:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802c24:	83 ec 0c             	sub    $0xc,%esp
+  802c27:	56                   	push   %esi
+  802c28:	e8 db e0 ff ff       	call   800d08 <strlen>
+  802c2d:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802c2f:	ff 75 0c             	push   0xc(%ebp)
+  802c32:	50                   	push   %eax
+  802c33:	6a 01                	push   $0x1
+  802c35:	56                   	push   %esi
+  802c36:	e8 49 fe ff ff       	call   802a84 <fwrite>
+  802c3b:	83 c4 20             	add    $0x20,%esp
+  802c3e:	39 d8                	cmp    %ebx,%eax
+  802c40:	0f 95 c0             	setne  %al
+  802c43:	0f b6 c0             	movzbl %al,%eax
+  802c46:	f7 d8                	neg    %eax
+}
+  802c48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4b:	5b                   	pop    %ebx
+  802c4c:	5e                   	pop    %esi
+  802c4d:	5d                   	pop    %ebp
+  802c4e:	c3                   	ret
+
+00802c4f <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802c4f:	55                   	push   %ebp
+  802c50:	89 e5                	mov    %esp,%ebp
+  802c52:	53                   	push   %ebx
+  802c53:	83 ec 04             	sub    $0x4,%esp
+  802c56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802c59:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802c5c:	50                   	push   %eax
+  802c5d:	ff 75 0c             	push   0xc(%ebp)
+  802c60:	53                   	push   %ebx
+  802c61:	68 06 2c 80 00       	push   $0x802c06
+  802c66:	e8 eb db ff ff       	call   800856 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802c6b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c6e:	c1 e0 1c             	shl    $0x1c,%eax
+  802c71:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802c74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c77:	c9                   	leave
+  802c78:	c3                   	ret
+
+00802c79 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c79:	55                   	push   %ebp
+  802c7a:	89 e5                	mov    %esp,%ebp
+  802c7c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802c7f:	68 38 52 80 00       	push   $0x805238
+  802c84:	ff 75 0c             	push   0xc(%ebp)
+  802c87:	e8 b7 e0 ff ff       	call   800d43 <strcpy>
+	return 0;
+}
+  802c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c91:	c9                   	leave
+  802c92:	c3                   	ret
+
+00802c93 <devsock_close>:
+{
+  802c93:	55                   	push   %ebp
+  802c94:	89 e5                	mov    %esp,%ebp
+  802c96:	53                   	push   %ebx
+  802c97:	83 ec 10             	sub    $0x10,%esp
+  802c9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802c9d:	53                   	push   %ebx
+  802c9e:	e8 23 1d 00 00       	call   8049c6 <pageref>
+  802ca3:	89 c2                	mov    %eax,%edx
+  802ca5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802cad:	83 fa 01             	cmp    $0x1,%edx
+  802cb0:	74 05                	je     802cb7 <devsock_close+0x24>
+}
+  802cb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cb5:	c9                   	leave
+  802cb6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802cb7:	83 ec 0c             	sub    $0xc,%esp
+  802cba:	ff 73 0c             	push   0xc(%ebx)
+  802cbd:	e8 b7 02 00 00       	call   802f79 <nsipc_close>
+  802cc2:	83 c4 10             	add    $0x10,%esp
+  802cc5:	eb eb                	jmp    802cb2 <devsock_close+0x1f>
+
+00802cc7 <devsock_write>:
+{
+  802cc7:	55                   	push   %ebp
+  802cc8:	89 e5                	mov    %esp,%ebp
+  802cca:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ccd:	6a 00                	push   $0x0
+  802ccf:	ff 75 10             	push   0x10(%ebp)
+  802cd2:	ff 75 0c             	push   0xc(%ebp)
+  802cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd8:	ff 70 0c             	push   0xc(%eax)
+  802cdb:	e8 79 03 00 00       	call   803059 <nsipc_send>
+}
+  802ce0:	c9                   	leave
+  802ce1:	c3                   	ret
+
+00802ce2 <devsock_read>:
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ce8:	6a 00                	push   $0x0
+  802cea:	ff 75 10             	push   0x10(%ebp)
+  802ced:	ff 75 0c             	push   0xc(%ebp)
+  802cf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf3:	ff 70 0c             	push   0xc(%eax)
+  802cf6:	e8 ef 02 00 00       	call   802fea <nsipc_recv>
+}
+  802cfb:	c9                   	leave
+  802cfc:	c3                   	ret
+
+00802cfd <fd2sockid>:
+{
+  802cfd:	55                   	push   %ebp
+  802cfe:	89 e5                	mov    %esp,%ebp
+  802d00:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802d03:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802d06:	52                   	push   %edx
+  802d07:	50                   	push   %eax
+  802d08:	e8 f7 e9 ff ff       	call   801704 <fd_lookup>
+  802d0d:	83 c4 10             	add    $0x10,%esp
+  802d10:	85 c0                	test   %eax,%eax
+  802d12:	78 10                	js     802d24 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802d14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d17:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802d1d:	39 08                	cmp    %ecx,(%eax)
+  802d1f:	75 05                	jne    802d26 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802d21:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802d24:	c9                   	leave
+  802d25:	c3                   	ret
+		return -E_NOT_SUPP;
+  802d26:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802d2b:	eb f7                	jmp    802d24 <fd2sockid+0x27>
+
+00802d2d <alloc_sockfd>:
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	56                   	push   %esi
+  802d31:	53                   	push   %ebx
+  802d32:	83 ec 1c             	sub    $0x1c,%esp
+  802d35:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802d37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d3a:	50                   	push   %eax
+  802d3b:	e8 6e e9 ff ff       	call   8016ae <fd_alloc>
+  802d40:	89 c3                	mov    %eax,%ebx
+  802d42:	83 c4 10             	add    $0x10,%esp
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	78 43                	js     802d8c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802d49:	83 ec 04             	sub    $0x4,%esp
+  802d4c:	68 07 04 00 00       	push   $0x407
+  802d51:	ff 75 f4             	push   -0xc(%ebp)
+  802d54:	6a 00                	push   $0x0
+  802d56:	e8 26 e4 ff ff       	call   801181 <sys_page_alloc>
+  802d5b:	89 c3                	mov    %eax,%ebx
+  802d5d:	83 c4 10             	add    $0x10,%esp
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	78 28                	js     802d8c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802d64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d67:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802d6d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d72:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802d79:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802d7c:	83 ec 0c             	sub    $0xc,%esp
+  802d7f:	50                   	push   %eax
+  802d80:	e8 02 e9 ff ff       	call   801687 <fd2num>
+  802d85:	89 c3                	mov    %eax,%ebx
+  802d87:	83 c4 10             	add    $0x10,%esp
+  802d8a:	eb 0c                	jmp    802d98 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802d8c:	83 ec 0c             	sub    $0xc,%esp
+  802d8f:	56                   	push   %esi
+  802d90:	e8 e4 01 00 00       	call   802f79 <nsipc_close>
+		return r;
+  802d95:	83 c4 10             	add    $0x10,%esp
+}
+  802d98:	89 d8                	mov    %ebx,%eax
+  802d9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d9d:	5b                   	pop    %ebx
+  802d9e:	5e                   	pop    %esi
+  802d9f:	5d                   	pop    %ebp
+  802da0:	c3                   	ret
+
+00802da1 <accept>:
+{
+  802da1:	55                   	push   %ebp
+  802da2:	89 e5                	mov    %esp,%ebp
+  802da4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802da7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802daa:	e8 4e ff ff ff       	call   802cfd <fd2sockid>
+  802daf:	85 c0                	test   %eax,%eax
+  802db1:	78 1b                	js     802dce <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802db3:	83 ec 04             	sub    $0x4,%esp
+  802db6:	ff 75 10             	push   0x10(%ebp)
+  802db9:	ff 75 0c             	push   0xc(%ebp)
+  802dbc:	50                   	push   %eax
+  802dbd:	e8 0e 01 00 00       	call   802ed0 <nsipc_accept>
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	85 c0                	test   %eax,%eax
+  802dc7:	78 05                	js     802dce <accept+0x2d>
+	return alloc_sockfd(r);
+  802dc9:	e8 5f ff ff ff       	call   802d2d <alloc_sockfd>
+}
+  802dce:	c9                   	leave
+  802dcf:	c3                   	ret
+
+00802dd0 <bind>:
+{
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd9:	e8 1f ff ff ff       	call   802cfd <fd2sockid>
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 12                	js     802df4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802de2:	83 ec 04             	sub    $0x4,%esp
+  802de5:	ff 75 10             	push   0x10(%ebp)
+  802de8:	ff 75 0c             	push   0xc(%ebp)
+  802deb:	50                   	push   %eax
+  802dec:	e8 31 01 00 00       	call   802f22 <nsipc_bind>
+  802df1:	83 c4 10             	add    $0x10,%esp
+}
+  802df4:	c9                   	leave
+  802df5:	c3                   	ret
+
+00802df6 <shutdown>:
+{
+  802df6:	55                   	push   %ebp
+  802df7:	89 e5                	mov    %esp,%ebp
+  802df9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dff:	e8 f9 fe ff ff       	call   802cfd <fd2sockid>
+  802e04:	85 c0                	test   %eax,%eax
+  802e06:	78 0f                	js     802e17 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802e08:	83 ec 08             	sub    $0x8,%esp
+  802e0b:	ff 75 0c             	push   0xc(%ebp)
+  802e0e:	50                   	push   %eax
+  802e0f:	e8 43 01 00 00       	call   802f57 <nsipc_shutdown>
+  802e14:	83 c4 10             	add    $0x10,%esp
+}
+  802e17:	c9                   	leave
+  802e18:	c3                   	ret
+
+00802e19 <connect>:
+{
+  802e19:	55                   	push   %ebp
+  802e1a:	89 e5                	mov    %esp,%ebp
+  802e1c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e22:	e8 d6 fe ff ff       	call   802cfd <fd2sockid>
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	78 12                	js     802e3d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802e2b:	83 ec 04             	sub    $0x4,%esp
+  802e2e:	ff 75 10             	push   0x10(%ebp)
+  802e31:	ff 75 0c             	push   0xc(%ebp)
+  802e34:	50                   	push   %eax
+  802e35:	e8 59 01 00 00       	call   802f93 <nsipc_connect>
+  802e3a:	83 c4 10             	add    $0x10,%esp
+}
+  802e3d:	c9                   	leave
+  802e3e:	c3                   	ret
+
+00802e3f <listen>:
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	e8 b0 fe ff ff       	call   802cfd <fd2sockid>
+  802e4d:	85 c0                	test   %eax,%eax
+  802e4f:	78 0f                	js     802e60 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802e51:	83 ec 08             	sub    $0x8,%esp
+  802e54:	ff 75 0c             	push   0xc(%ebp)
+  802e57:	50                   	push   %eax
+  802e58:	e8 6b 01 00 00       	call   802fc8 <nsipc_listen>
+  802e5d:	83 c4 10             	add    $0x10,%esp
+}
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+
+00802e62 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802e62:	55                   	push   %ebp
+  802e63:	89 e5                	mov    %esp,%ebp
+  802e65:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802e68:	ff 75 10             	push   0x10(%ebp)
+  802e6b:	ff 75 0c             	push   0xc(%ebp)
+  802e6e:	ff 75 08             	push   0x8(%ebp)
+  802e71:	e8 41 02 00 00       	call   8030b7 <nsipc_socket>
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	78 05                	js     802e82 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802e7d:	e8 ab fe ff ff       	call   802d2d <alloc_sockfd>
+}
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+00802e84 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	53                   	push   %ebx
+  802e88:	83 ec 04             	sub    $0x4,%esp
+  802e8b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802e8d:	83 3d b4 70 80 00 00 	cmpl   $0x0,0x8070b4
+  802e94:	74 26                	je     802ebc <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802e96:	6a 07                	push   $0x7
+  802e98:	68 00 90 80 00       	push   $0x809000
+  802e9d:	53                   	push   %ebx
+  802e9e:	ff 35 b4 70 80 00    	push   0x8070b4
+  802ea4:	e8 88 1a 00 00       	call   804931 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ea9:	83 c4 0c             	add    $0xc,%esp
+  802eac:	6a 00                	push   $0x0
+  802eae:	6a 00                	push   $0x0
+  802eb0:	6a 00                	push   $0x0
+  802eb2:	e8 84 19 00 00       	call   80483b <ipc_recv>
+}
+  802eb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eba:	c9                   	leave
+  802ebb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ebc:	83 ec 0c             	sub    $0xc,%esp
+  802ebf:	6a 02                	push   $0x2
+  802ec1:	e8 c1 1a 00 00       	call   804987 <ipc_find_env>
+  802ec6:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  802ecb:	83 c4 10             	add    $0x10,%esp
+  802ece:	eb c6                	jmp    802e96 <nsipc+0x12>
+
+00802ed0 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ed0:	55                   	push   %ebp
+  802ed1:	89 e5                	mov    %esp,%ebp
+  802ed3:	56                   	push   %esi
+  802ed4:	53                   	push   %ebx
+  802ed5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edb:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802ee0:	8b 06                	mov    (%esi),%eax
+  802ee2:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ee7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802eec:	e8 93 ff ff ff       	call   802e84 <nsipc>
+  802ef1:	89 c3                	mov    %eax,%ebx
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	79 09                	jns    802f00 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ef7:	89 d8                	mov    %ebx,%eax
+  802ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802efc:	5b                   	pop    %ebx
+  802efd:	5e                   	pop    %esi
+  802efe:	5d                   	pop    %ebp
+  802eff:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802f00:	83 ec 04             	sub    $0x4,%esp
+  802f03:	ff 35 10 90 80 00    	push   0x809010
+  802f09:	68 00 90 80 00       	push   $0x809000
+  802f0e:	ff 75 0c             	push   0xc(%ebp)
+  802f11:	e8 b3 df ff ff       	call   800ec9 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802f16:	a1 10 90 80 00       	mov    0x809010,%eax
+  802f1b:	89 06                	mov    %eax,(%esi)
+  802f1d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802f20:	eb d5                	jmp    802ef7 <nsipc_accept+0x27>
+
+00802f22 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802f22:	55                   	push   %ebp
+  802f23:	89 e5                	mov    %esp,%ebp
+  802f25:	53                   	push   %ebx
+  802f26:	83 ec 08             	sub    $0x8,%esp
+  802f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2f:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802f34:	53                   	push   %ebx
+  802f35:	ff 75 0c             	push   0xc(%ebp)
+  802f38:	68 04 90 80 00       	push   $0x809004
+  802f3d:	e8 87 df ff ff       	call   800ec9 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802f42:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802f48:	b8 02 00 00 00       	mov    $0x2,%eax
+  802f4d:	e8 32 ff ff ff       	call   802e84 <nsipc>
+}
+  802f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f55:	c9                   	leave
+  802f56:	c3                   	ret
+
+00802f57 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802f57:	55                   	push   %ebp
+  802f58:	89 e5                	mov    %esp,%ebp
+  802f5a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f60:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802f65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f68:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802f6d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f72:	e8 0d ff ff ff       	call   802e84 <nsipc>
+}
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+
+00802f79 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802f79:	55                   	push   %ebp
+  802f7a:	89 e5                	mov    %esp,%ebp
+  802f7c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f82:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802f87:	b8 04 00 00 00       	mov    $0x4,%eax
+  802f8c:	e8 f3 fe ff ff       	call   802e84 <nsipc>
+}
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+
+00802f93 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802f93:	55                   	push   %ebp
+  802f94:	89 e5                	mov    %esp,%ebp
+  802f96:	53                   	push   %ebx
+  802f97:	83 ec 08             	sub    $0x8,%esp
+  802f9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa0:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802fa5:	53                   	push   %ebx
+  802fa6:	ff 75 0c             	push   0xc(%ebp)
+  802fa9:	68 04 90 80 00       	push   $0x809004
+  802fae:	e8 16 df ff ff       	call   800ec9 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802fb3:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802fb9:	b8 05 00 00 00       	mov    $0x5,%eax
+  802fbe:	e8 c1 fe ff ff       	call   802e84 <nsipc>
+}
+  802fc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fc6:	c9                   	leave
+  802fc7:	c3                   	ret
+
+00802fc8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802fc8:	55                   	push   %ebp
+  802fc9:	89 e5                	mov    %esp,%ebp
+  802fcb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802fd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fd9:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802fde:	b8 06 00 00 00       	mov    $0x6,%eax
+  802fe3:	e8 9c fe ff ff       	call   802e84 <nsipc>
+}
+  802fe8:	c9                   	leave
+  802fe9:	c3                   	ret
+
+00802fea <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802fea:	55                   	push   %ebp
+  802feb:	89 e5                	mov    %esp,%ebp
+  802fed:	56                   	push   %esi
+  802fee:	53                   	push   %ebx
+  802fef:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802ffa:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803000:	8b 45 14             	mov    0x14(%ebp),%eax
+  803003:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803008:	b8 07 00 00 00       	mov    $0x7,%eax
+  80300d:	e8 72 fe ff ff       	call   802e84 <nsipc>
+  803012:	89 c3                	mov    %eax,%ebx
+  803014:	85 c0                	test   %eax,%eax
+  803016:	78 22                	js     80303a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803018:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80301d:	39 c6                	cmp    %eax,%esi
+  80301f:	0f 4e c6             	cmovle %esi,%eax
+  803022:	39 c3                	cmp    %eax,%ebx
+  803024:	7f 1d                	jg     803043 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803026:	83 ec 04             	sub    $0x4,%esp
+  803029:	53                   	push   %ebx
+  80302a:	68 00 90 80 00       	push   $0x809000
+  80302f:	ff 75 0c             	push   0xc(%ebp)
+  803032:	e8 92 de ff ff       	call   800ec9 <memmove>
+  803037:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80303a:	89 d8                	mov    %ebx,%eax
+  80303c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80303f:	5b                   	pop    %ebx
+  803040:	5e                   	pop    %esi
+  803041:	5d                   	pop    %ebp
+  803042:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803043:	68 44 52 80 00       	push   $0x805244
+  803048:	68 fd 51 80 00       	push   $0x8051fd
+  80304d:	6a 62                	push   $0x62
+  80304f:	68 59 52 80 00       	push   $0x805259
+  803054:	e8 2b d6 ff ff       	call   800684 <_panic>
+
+00803059 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803059:	55                   	push   %ebp
+  80305a:	89 e5                	mov    %esp,%ebp
+  80305c:	53                   	push   %ebx
+  80305d:	83 ec 04             	sub    $0x4,%esp
+  803060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803063:	8b 45 08             	mov    0x8(%ebp),%eax
+  803066:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80306b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803071:	7f 2e                	jg     8030a1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803073:	83 ec 04             	sub    $0x4,%esp
+  803076:	53                   	push   %ebx
+  803077:	ff 75 0c             	push   0xc(%ebp)
+  80307a:	68 0c 90 80 00       	push   $0x80900c
+  80307f:	e8 45 de ff ff       	call   800ec9 <memmove>
+	nsipcbuf.send.req_size = size;
+  803084:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80308a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80308d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803092:	b8 08 00 00 00       	mov    $0x8,%eax
+  803097:	e8 e8 fd ff ff       	call   802e84 <nsipc>
+}
+  80309c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80309f:	c9                   	leave
+  8030a0:	c3                   	ret
+	assert(size < 1600);
+  8030a1:	68 65 52 80 00       	push   $0x805265
+  8030a6:	68 fd 51 80 00       	push   $0x8051fd
+  8030ab:	6a 6d                	push   $0x6d
+  8030ad:	68 59 52 80 00       	push   $0x805259
+  8030b2:	e8 cd d5 ff ff       	call   800684 <_panic>
+
+008030b7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8030b7:	55                   	push   %ebp
+  8030b8:	89 e5                	mov    %esp,%ebp
+  8030ba:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8030bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8030c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030c8:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8030cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030d0:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8030d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8030da:	e8 a5 fd ff ff       	call   802e84 <nsipc>
+}
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+
+008030e1 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8030e1:	55                   	push   %ebp
+  8030e2:	89 e5                	mov    %esp,%ebp
+  8030e4:	53                   	push   %ebx
+  8030e5:	83 ec 10             	sub    $0x10,%esp
+  8030e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8030eb:	68 b8 70 80 00       	push   $0x8070b8
+  8030f0:	e8 50 07 00 00       	call   803845 <mutex_lock>
+	if (v == 0)
+  8030f5:	83 c4 10             	add    $0x10,%esp
+  8030f8:	85 db                	test   %ebx,%ebx
+  8030fa:	0f 84 85 00 00 00    	je     803185 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803100:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803106:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80310b:	77 51                	ja     80315e <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80310d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803113:	89 d8                	mov    %ebx,%eax
+  803115:	c1 e8 0c             	shr    $0xc,%eax
+  803118:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80311f:	f6 c4 02             	test   $0x2,%ah
+  803122:	74 50                	je     803174 <free+0x93>
+		sys_page_unmap(0, c);
+  803124:	83 ec 08             	sub    $0x8,%esp
+  803127:	53                   	push   %ebx
+  803128:	6a 00                	push   $0x0
+  80312a:	e8 eb e0 ff ff       	call   80121a <sys_page_unmap>
+		c += PGSIZE;
+  80312f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803135:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80313b:	83 c4 10             	add    $0x10,%esp
+  80313e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803143:	76 ce                	jbe    803113 <free+0x32>
+  803145:	68 af 52 80 00       	push   $0x8052af
+  80314a:	68 fd 51 80 00       	push   $0x8051fd
+  80314f:	68 82 00 00 00       	push   $0x82
+  803154:	68 a2 52 80 00       	push   $0x8052a2
+  803159:	e8 26 d5 ff ff       	call   800684 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80315e:	68 74 52 80 00       	push   $0x805274
+  803163:	68 fd 51 80 00       	push   $0x8051fd
+  803168:	6a 7b                	push   $0x7b
+  80316a:	68 a2 52 80 00       	push   $0x8052a2
+  80316f:	e8 10 d5 ff ff       	call   800684 <_panic>
+	if (--(*ref) == 0)
+  803174:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80317a:	83 e8 01             	sub    $0x1,%eax
+  80317d:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803183:	74 15                	je     80319a <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803185:	83 ec 0c             	sub    $0xc,%esp
+  803188:	68 b8 70 80 00       	push   $0x8070b8
+  80318d:	e8 20 07 00 00       	call   8038b2 <mutex_unlock>
+}
+  803192:	83 c4 10             	add    $0x10,%esp
+  803195:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803198:	c9                   	leave
+  803199:	c3                   	ret
+		sys_page_unmap(0, c);
+  80319a:	83 ec 08             	sub    $0x8,%esp
+  80319d:	53                   	push   %ebx
+  80319e:	6a 00                	push   $0x0
+  8031a0:	e8 75 e0 ff ff       	call   80121a <sys_page_unmap>
+  8031a5:	83 c4 10             	add    $0x10,%esp
+  8031a8:	eb db                	jmp    803185 <free+0xa4>
+
+008031aa <malloc>:
+{
+  8031aa:	55                   	push   %ebp
+  8031ab:	89 e5                	mov    %esp,%ebp
+  8031ad:	57                   	push   %edi
+  8031ae:	56                   	push   %esi
+  8031af:	53                   	push   %ebx
+  8031b0:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8031b3:	68 b8 70 80 00       	push   $0x8070b8
+  8031b8:	e8 88 06 00 00       	call   803845 <mutex_lock>
+	if (mptr == 0)
+  8031bd:	8b 3d bc 70 80 00    	mov    0x8070bc,%edi
+  8031c3:	83 c4 10             	add    $0x10,%esp
+  8031c6:	85 ff                	test   %edi,%edi
+  8031c8:	74 6c                	je     803236 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8031ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031cd:	83 c0 03             	add    $0x3,%eax
+  8031d0:	83 e0 fc             	and    $0xfffffffc,%eax
+  8031d3:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8031d5:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8031da:	0f 87 64 01 00 00    	ja     803344 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8031e0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8031e6:	74 30                	je     803218 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8031e8:	89 f9                	mov    %edi,%ecx
+  8031ea:	c1 e9 0c             	shr    $0xc,%ecx
+  8031ed:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8031f1:	c1 e8 0c             	shr    $0xc,%eax
+  8031f4:	39 c1                	cmp    %eax,%ecx
+  8031f6:	74 5f                	je     803257 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8031f8:	83 ec 0c             	sub    $0xc,%esp
+  8031fb:	57                   	push   %edi
+  8031fc:	e8 e0 fe ff ff       	call   8030e1 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803201:	a1 bc 70 80 00       	mov    0x8070bc,%eax
+  803206:	05 00 10 00 00       	add    $0x1000,%eax
+  80320b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803210:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  803215:	83 c4 10             	add    $0x10,%esp
+  803218:	8b 0d bc 70 80 00    	mov    0x8070bc,%ecx
+{
+  80321e:	ba 02 00 00 00       	mov    $0x2,%edx
+  803223:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803227:	8d 7e 04             	lea    0x4(%esi),%edi
+  80322a:	89 cb                	mov    %ecx,%ebx
+  80322c:	01 f9                	add    %edi,%ecx
+  80322e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803231:	e9 8b 00 00 00       	jmp    8032c1 <malloc+0x117>
+		mptr = mbegin;
+  803236:	c7 05 bc 70 80 00 00 	movl   $0x8000000,0x8070bc
+  80323d:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803240:	8b 45 08             	mov    0x8(%ebp),%eax
+  803243:	83 c0 03             	add    $0x3,%eax
+  803246:	83 e0 fc             	and    $0xfffffffc,%eax
+  803249:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80324b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803250:	76 c6                	jbe    803218 <malloc+0x6e>
+  803252:	e9 d6 00 00 00       	jmp    80332d <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803257:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80325d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803262:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803266:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803269:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+			return v;
+  80326e:	e9 ba 00 00 00       	jmp    80332d <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803273:	05 00 10 00 00       	add    $0x1000,%eax
+  803278:	39 c8                	cmp    %ecx,%eax
+  80327a:	0f 83 cb 00 00 00    	jae    80334b <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803280:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803285:	77 22                	ja     8032a9 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803287:	89 c2                	mov    %eax,%edx
+  803289:	c1 ea 16             	shr    $0x16,%edx
+  80328c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803293:	f6 c2 01             	test   $0x1,%dl
+  803296:	74 db                	je     803273 <malloc+0xc9>
+  803298:	89 c2                	mov    %eax,%edx
+  80329a:	c1 ea 0c             	shr    $0xc,%edx
+  80329d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8032a4:	f6 c2 01             	test   $0x1,%dl
+  8032a7:	74 ca                	je     803273 <malloc+0xc9>
+		if (mptr == mend) {
+  8032a9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8032af:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8032b5:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8032b9:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8032bf:	74 04                	je     8032c5 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8032c1:	89 d8                	mov    %ebx,%eax
+  8032c3:	eb b3                	jmp    803278 <malloc+0xce>
+  8032c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8032c8:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8032cd:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8032d1:	83 ea 01             	sub    $0x1,%edx
+  8032d4:	0f 85 50 ff ff ff    	jne    80322a <malloc+0x80>
+  8032da:	c7 05 bc 70 80 00 00 	movl   $0x8000000,0x8070bc
+  8032e1:	00 00 08 
+				return 0;	/* out of address space */
+  8032e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e9:	eb 42                	jmp    80332d <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8032eb:	85 db                	test   %ebx,%ebx
+  8032ed:	78 1e                	js     80330d <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8032ef:	83 ec 08             	sub    $0x8,%esp
+  8032f2:	89 d8                	mov    %ebx,%eax
+  8032f4:	03 05 bc 70 80 00    	add    0x8070bc,%eax
+  8032fa:	50                   	push   %eax
+  8032fb:	6a 00                	push   $0x0
+  8032fd:	e8 18 df ff ff       	call   80121a <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803302:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803308:	83 c4 10             	add    $0x10,%esp
+  80330b:	eb de                	jmp    8032eb <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80330d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803312:	eb 19                	jmp    80332d <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803314:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803317:	8b 3d bc 70 80 00    	mov    0x8070bc,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80331d:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803324:	00 
+	mptr += n;
+  803325:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803328:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+	mutex_unlock(&malloc_mu);
+  80332d:	83 ec 0c             	sub    $0xc,%esp
+  803330:	68 b8 70 80 00       	push   $0x8070b8
+  803335:	e8 78 05 00 00       	call   8038b2 <mutex_unlock>
+}
+  80333a:	89 f8                	mov    %edi,%eax
+  80333c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80333f:	5b                   	pop    %ebx
+  803340:	5e                   	pop    %esi
+  803341:	5f                   	pop    %edi
+  803342:	5d                   	pop    %ebp
+  803343:	c3                   	ret
+		return 0;
+  803344:	bf 00 00 00 00       	mov    $0x0,%edi
+  803349:	eb e2                	jmp    80332d <malloc+0x183>
+  80334b:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80334f:	74 06                	je     803357 <malloc+0x1ad>
+  803351:	89 1d bc 70 80 00    	mov    %ebx,0x8070bc
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803357:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80335c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80335f:	39 fb                	cmp    %edi,%ebx
+  803361:	73 b1                	jae    803314 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803363:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803369:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80336c:	39 fe                	cmp    %edi,%esi
+  80336e:	0f 92 c0             	setb   %al
+  803371:	0f b6 c0             	movzbl %al,%eax
+  803374:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803377:	83 c8 07             	or     $0x7,%eax
+  80337a:	50                   	push   %eax
+  80337b:	89 d8                	mov    %ebx,%eax
+  80337d:	03 05 bc 70 80 00    	add    0x8070bc,%eax
+  803383:	50                   	push   %eax
+  803384:	6a 00                	push   $0x0
+  803386:	e8 f6 dd ff ff       	call   801181 <sys_page_alloc>
+  80338b:	83 c4 10             	add    $0x10,%esp
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	0f 88 55 ff ff ff    	js     8032eb <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803396:	89 f3                	mov    %esi,%ebx
+  803398:	eb c5                	jmp    80335f <malloc+0x1b5>
+
+0080339a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80339a:	55                   	push   %ebp
+  80339b:	89 e5                	mov    %esp,%ebp
+  80339d:	56                   	push   %esi
+  80339e:	53                   	push   %ebx
+  80339f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8033a2:	83 ec 0c             	sub    $0xc,%esp
+  8033a5:	ff 75 08             	push   0x8(%ebp)
+  8033a8:	e8 ea e2 ff ff       	call   801697 <fd2data>
+  8033ad:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8033af:	83 c4 08             	add    $0x8,%esp
+  8033b2:	68 c7 52 80 00       	push   $0x8052c7
+  8033b7:	53                   	push   %ebx
+  8033b8:	e8 86 d9 ff ff       	call   800d43 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8033bd:	8b 46 04             	mov    0x4(%esi),%eax
+  8033c0:	2b 06                	sub    (%esi),%eax
+  8033c2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8033c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8033cf:	00 00 00 
+	stat->st_dev = &devpipe;
+  8033d2:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8033d9:	62 80 00 
+	return 0;
+}
+  8033dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033e4:	5b                   	pop    %ebx
+  8033e5:	5e                   	pop    %esi
+  8033e6:	5d                   	pop    %ebp
+  8033e7:	c3                   	ret
+
+008033e8 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8033e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033ed:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8033f1:	85 c9                	test   %ecx,%ecx
+  8033f3:	75 01                	jne    8033f6 <pipewake+0xe>
+  8033f5:	c3                   	ret
+{
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+  8033f9:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8033fc:	68 00 04 00 00       	push   $0x400
+  803401:	52                   	push   %edx
+  803402:	e8 be e0 ff ff       	call   8014c5 <sys_futex_wake>
+  803407:	83 c4 10             	add    $0x10,%esp
+}
+  80340a:	c9                   	leave
+  80340b:	c3                   	ret
+
+0080340c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	56                   	push   %esi
+  803410:	53                   	push   %ebx
+  803411:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803414:	83 ec 0c             	sub    $0xc,%esp
+  803417:	56                   	push   %esi
+  803418:	e8 7a e2 ff ff       	call   801697 <fd2data>
+  80341d:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80341f:	83 c4 08             	add    $0x8,%esp
+  803422:	56                   	push   %esi
+  803423:	6a 00                	push   $0x0
+  803425:	e8 f0 dd ff ff       	call   80121a <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80342a:	8d 53 04             	lea    0x4(%ebx),%edx
+  80342d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803430:	e8 b3 ff ff ff       	call   8033e8 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803435:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803438:	89 da                	mov    %ebx,%edx
+  80343a:	e8 a9 ff ff ff       	call   8033e8 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80343f:	89 34 24             	mov    %esi,(%esp)
+  803442:	e8 50 e2 ff ff       	call   801697 <fd2data>
+  803447:	83 c4 08             	add    $0x8,%esp
+  80344a:	50                   	push   %eax
+  80344b:	6a 00                	push   $0x0
+  80344d:	e8 c8 dd ff ff       	call   80121a <sys_page_unmap>
+}
+  803452:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803455:	5b                   	pop    %ebx
+  803456:	5e                   	pop    %esi
+  803457:	5d                   	pop    %ebp
+  803458:	c3                   	ret
+
+00803459 <_pipeisclosed>:
+{
+  803459:	55                   	push   %ebp
+  80345a:	89 e5                	mov    %esp,%ebp
+  80345c:	57                   	push   %edi
+  80345d:	56                   	push   %esi
+  80345e:	53                   	push   %ebx
+  80345f:	83 ec 1c             	sub    $0x1c,%esp
+  803462:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803465:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803467:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80346c:	eb 5d                	jmp    8034cb <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80346e:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		n = thisenv->env_runs;
+  803474:	8b 02                	mov    (%edx),%eax
+  803476:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803479:	83 ec 0c             	sub    $0xc,%esp
+  80347c:	ff 75 e0             	push   -0x20(%ebp)
+  80347f:	e8 42 15 00 00       	call   8049c6 <pageref>
+  803484:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803487:	89 3c 24             	mov    %edi,(%esp)
+  80348a:	e8 37 15 00 00       	call   8049c6 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80348f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803491:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803497:	83 c4 10             	add    $0x10,%esp
+  80349a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8034a0:	77 15                	ja     8034b7 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8034a2:	89 f2                	mov    %esi,%edx
+  8034a4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8034a6:	c1 ea 10             	shr    $0x10,%edx
+  8034a9:	74 0c                	je     8034b7 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8034ab:	c1 e2 10             	shl    $0x10,%edx
+  8034ae:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8034b3:	29 d1                	sub    %edx,%ecx
+  8034b5:	eb 06                	jmp    8034bd <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8034b7:	8b 0d 60 73 80 00    	mov    0x807360,%ecx
+		nn = thisenv->env_runs;
+  8034bd:	8b 11                	mov    (%ecx),%edx
+  8034bf:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8034c2:	39 d3                	cmp    %edx,%ebx
+  8034c4:	74 6e                	je     803534 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8034c6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8034c9:	74 24                	je     8034ef <_pipeisclosed+0x96>
+  8034cb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8034cd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8034d3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8034d8:	77 94                	ja     80346e <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8034da:	89 f0                	mov    %esi,%eax
+  8034dc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8034de:	c1 e8 10             	shr    $0x10,%eax
+  8034e1:	74 8b                	je     80346e <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8034e3:	c1 e0 10             	shl    $0x10,%eax
+  8034e6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8034eb:	29 c2                	sub    %eax,%edx
+  8034ed:	eb 85                	jmp    803474 <_pipeisclosed+0x1b>
+  8034ef:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8034f1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8034f7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8034fc:	77 18                	ja     803516 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8034fe:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803503:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803505:	c1 e8 10             	shr    $0x10,%eax
+  803508:	74 0c                	je     803516 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80350a:	c1 e0 10             	shl    $0x10,%eax
+  80350d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803512:	29 c2                	sub    %eax,%edx
+  803514:	eb 06                	jmp    80351c <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803516:	8b 15 60 73 80 00    	mov    0x807360,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80351c:	8b 02                	mov    (%edx),%eax
+  80351e:	8b 40 58             	mov    0x58(%eax),%eax
+  803521:	6a 01                	push   $0x1
+  803523:	50                   	push   %eax
+  803524:	53                   	push   %ebx
+  803525:	68 ce 52 80 00       	push   $0x8052ce
+  80352a:	e8 30 d2 ff ff       	call   80075f <cprintf>
+  80352f:	83 c4 10             	add    $0x10,%esp
+  803532:	eb 97                	jmp    8034cb <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803534:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803537:	0f 94 c0             	sete   %al
+  80353a:	0f b6 c0             	movzbl %al,%eax
+}
+  80353d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803540:	5b                   	pop    %ebx
+  803541:	5e                   	pop    %esi
+  803542:	5f                   	pop    %edi
+  803543:	5d                   	pop    %ebp
+  803544:	c3                   	ret
+
+00803545 <devpipe_write>:
+{
+  803545:	55                   	push   %ebp
+  803546:	89 e5                	mov    %esp,%ebp
+  803548:	57                   	push   %edi
+  803549:	56                   	push   %esi
+  80354a:	53                   	push   %ebx
+  80354b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80354e:	ff 75 08             	push   0x8(%ebp)
+  803551:	e8 41 e1 ff ff       	call   801697 <fd2data>
+  803556:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803558:	83 c4 10             	add    $0x10,%esp
+  80355b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803562:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803565:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803568:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80356b:	0f 84 96 00 00 00    	je     803607 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803571:	8d 73 08             	lea    0x8(%ebx),%esi
+  803574:	eb 32                	jmp    8035a8 <devpipe_write+0x63>
+  803576:	89 fa                	mov    %edi,%edx
+  803578:	89 f0                	mov    %esi,%eax
+  80357a:	e8 69 fe ff ff       	call   8033e8 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80357f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803582:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803585:	ba 01 00 00 00       	mov    $0x1,%edx
+  80358a:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80358f:	83 ec 04             	sub    $0x4,%esp
+  803592:	6a 0a                	push   $0xa
+  803594:	50                   	push   %eax
+  803595:	53                   	push   %ebx
+  803596:	e8 fb de ff ff       	call   801496 <sys_futex_wait>
+  80359b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8035a0:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8035a5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8035a8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8035ab:	8b 0b                	mov    (%ebx),%ecx
+  8035ad:	8d 51 20             	lea    0x20(%ecx),%edx
+  8035b0:	39 d0                	cmp    %edx,%eax
+  8035b2:	72 1b                	jb     8035cf <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8035b4:	89 da                	mov    %ebx,%edx
+  8035b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b9:	e8 9b fe ff ff       	call   803459 <_pipeisclosed>
+  8035be:	85 c0                	test   %eax,%eax
+  8035c0:	74 b4                	je     803576 <devpipe_write+0x31>
+				return 0;
+  8035c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035ca:	5b                   	pop    %ebx
+  8035cb:	5e                   	pop    %esi
+  8035cc:	5f                   	pop    %edi
+  8035cd:	5d                   	pop    %ebp
+  8035ce:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8035cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8035d2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8035d5:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8035d9:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8035dc:	89 c2                	mov    %eax,%edx
+  8035de:	c1 fa 1f             	sar    $0x1f,%edx
+  8035e1:	89 d1                	mov    %edx,%ecx
+  8035e3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8035e6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8035e9:	83 e2 1f             	and    $0x1f,%edx
+  8035ec:	29 ca                	sub    %ecx,%edx
+  8035ee:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8035f2:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8035f6:	83 c0 01             	add    $0x1,%eax
+  8035f9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8035fc:	83 c6 01             	add    $0x1,%esi
+  8035ff:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803602:	e9 5e ff ff ff       	jmp    803565 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803607:	8d 53 04             	lea    0x4(%ebx),%edx
+  80360a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80360d:	e8 d6 fd ff ff       	call   8033e8 <pipewake>
+	return i;
+  803612:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803615:	eb b0                	jmp    8035c7 <devpipe_write+0x82>
+
+00803617 <devpipe_read>:
+{
+  803617:	55                   	push   %ebp
+  803618:	89 e5                	mov    %esp,%ebp
+  80361a:	57                   	push   %edi
+  80361b:	56                   	push   %esi
+  80361c:	53                   	push   %ebx
+  80361d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803620:	ff 75 08             	push   0x8(%ebp)
+  803623:	e8 6f e0 ff ff       	call   801697 <fd2data>
+  803628:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80362a:	83 c4 10             	add    $0x10,%esp
+  80362d:	be 00 00 00 00       	mov    $0x0,%esi
+  803632:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803635:	74 6c                	je     8036a3 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803637:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80363a:	eb 25                	jmp    803661 <devpipe_read+0x4a>
+  80363c:	8b 13                	mov    (%ebx),%edx
+  80363e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803643:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803648:	83 ec 04             	sub    $0x4,%esp
+  80364b:	6a 0a                	push   $0xa
+  80364d:	52                   	push   %edx
+  80364e:	57                   	push   %edi
+  80364f:	e8 42 de ff ff       	call   801496 <sys_futex_wait>
+  803654:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803659:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80365e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803661:	8b 03                	mov    (%ebx),%eax
+  803663:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803666:	75 19                	jne    803681 <devpipe_read+0x6a>
+			if (i > 0)
+  803668:	85 f6                	test   %esi,%esi
+  80366a:	75 3a                	jne    8036a6 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80366c:	89 da                	mov    %ebx,%edx
+  80366e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803671:	e8 e3 fd ff ff       	call   803459 <_pipeisclosed>
+  803676:	85 c0                	test   %eax,%eax
+  803678:	74 c2                	je     80363c <devpipe_read+0x25>
+				return 0;
+  80367a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367f:	eb 31                	jmp    8036b2 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803681:	89 c1                	mov    %eax,%ecx
+  803683:	c1 f9 1f             	sar    $0x1f,%ecx
+  803686:	c1 e9 1b             	shr    $0x1b,%ecx
+  803689:	01 c8                	add    %ecx,%eax
+  80368b:	83 e0 1f             	and    $0x1f,%eax
+  80368e:	29 c8                	sub    %ecx,%eax
+  803690:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803695:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803698:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80369b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80369e:	83 c6 01             	add    $0x1,%esi
+  8036a1:	eb 8f                	jmp    803632 <devpipe_read+0x1b>
+out:
+  8036a3:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8036a6:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8036a9:	89 da                	mov    %ebx,%edx
+  8036ab:	e8 38 fd ff ff       	call   8033e8 <pipewake>
+	return i;
+  8036b0:	89 f0                	mov    %esi,%eax
+}
+  8036b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b5:	5b                   	pop    %ebx
+  8036b6:	5e                   	pop    %esi
+  8036b7:	5f                   	pop    %edi
+  8036b8:	5d                   	pop    %ebp
+  8036b9:	c3                   	ret
+
+008036ba <pipe>:
+{
+  8036ba:	55                   	push   %ebp
+  8036bb:	89 e5                	mov    %esp,%ebp
+  8036bd:	56                   	push   %esi
+  8036be:	53                   	push   %ebx
+  8036bf:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8036c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036c5:	50                   	push   %eax
+  8036c6:	e8 e3 df ff ff       	call   8016ae <fd_alloc>
+  8036cb:	89 c3                	mov    %eax,%ebx
+  8036cd:	83 c4 10             	add    $0x10,%esp
+  8036d0:	85 c0                	test   %eax,%eax
+  8036d2:	0f 88 23 01 00 00    	js     8037fb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036d8:	83 ec 04             	sub    $0x4,%esp
+  8036db:	68 07 04 00 00       	push   $0x407
+  8036e0:	ff 75 f4             	push   -0xc(%ebp)
+  8036e3:	6a 00                	push   $0x0
+  8036e5:	e8 97 da ff ff       	call   801181 <sys_page_alloc>
+  8036ea:	89 c3                	mov    %eax,%ebx
+  8036ec:	83 c4 10             	add    $0x10,%esp
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	0f 88 04 01 00 00    	js     8037fb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8036f7:	83 ec 0c             	sub    $0xc,%esp
+  8036fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8036fd:	50                   	push   %eax
+  8036fe:	e8 ab df ff ff       	call   8016ae <fd_alloc>
+  803703:	89 c3                	mov    %eax,%ebx
+  803705:	83 c4 10             	add    $0x10,%esp
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	0f 88 db 00 00 00    	js     8037eb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803710:	83 ec 04             	sub    $0x4,%esp
+  803713:	68 07 04 00 00       	push   $0x407
+  803718:	ff 75 f0             	push   -0x10(%ebp)
+  80371b:	6a 00                	push   $0x0
+  80371d:	e8 5f da ff ff       	call   801181 <sys_page_alloc>
+  803722:	89 c3                	mov    %eax,%ebx
+  803724:	83 c4 10             	add    $0x10,%esp
+  803727:	85 c0                	test   %eax,%eax
+  803729:	0f 88 bc 00 00 00    	js     8037eb <pipe+0x131>
+	va = fd2data(fd0);
+  80372f:	83 ec 0c             	sub    $0xc,%esp
+  803732:	ff 75 f4             	push   -0xc(%ebp)
+  803735:	e8 5d df ff ff       	call   801697 <fd2data>
+  80373a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80373c:	83 c4 0c             	add    $0xc,%esp
+  80373f:	68 07 04 00 00       	push   $0x407
+  803744:	50                   	push   %eax
+  803745:	6a 00                	push   $0x0
+  803747:	e8 35 da ff ff       	call   801181 <sys_page_alloc>
+  80374c:	89 c3                	mov    %eax,%ebx
+  80374e:	83 c4 10             	add    $0x10,%esp
+  803751:	85 c0                	test   %eax,%eax
+  803753:	0f 88 82 00 00 00    	js     8037db <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803759:	83 ec 0c             	sub    $0xc,%esp
+  80375c:	ff 75 f0             	push   -0x10(%ebp)
+  80375f:	e8 33 df ff ff       	call   801697 <fd2data>
+  803764:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80376b:	50                   	push   %eax
+  80376c:	6a 00                	push   $0x0
+  80376e:	56                   	push   %esi
+  80376f:	6a 00                	push   $0x0
+  803771:	e8 58 da ff ff       	call   8011ce <sys_page_map>
+  803776:	89 c3                	mov    %eax,%ebx
+  803778:	83 c4 20             	add    $0x20,%esp
+  80377b:	85 c0                	test   %eax,%eax
+  80377d:	78 4e                	js     8037cd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80377f:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803784:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803787:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803789:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80378c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803793:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803796:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803798:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80379b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8037a2:	83 ec 0c             	sub    $0xc,%esp
+  8037a5:	ff 75 f4             	push   -0xc(%ebp)
+  8037a8:	e8 da de ff ff       	call   801687 <fd2num>
+  8037ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037b0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8037b2:	83 c4 04             	add    $0x4,%esp
+  8037b5:	ff 75 f0             	push   -0x10(%ebp)
+  8037b8:	e8 ca de ff ff       	call   801687 <fd2num>
+  8037bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037c0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8037c3:	83 c4 10             	add    $0x10,%esp
+  8037c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037cb:	eb 2e                	jmp    8037fb <pipe+0x141>
+	sys_page_unmap(0, va);
+  8037cd:	83 ec 08             	sub    $0x8,%esp
+  8037d0:	56                   	push   %esi
+  8037d1:	6a 00                	push   $0x0
+  8037d3:	e8 42 da ff ff       	call   80121a <sys_page_unmap>
+  8037d8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8037db:	83 ec 08             	sub    $0x8,%esp
+  8037de:	ff 75 f0             	push   -0x10(%ebp)
+  8037e1:	6a 00                	push   $0x0
+  8037e3:	e8 32 da ff ff       	call   80121a <sys_page_unmap>
+  8037e8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8037eb:	83 ec 08             	sub    $0x8,%esp
+  8037ee:	ff 75 f4             	push   -0xc(%ebp)
+  8037f1:	6a 00                	push   $0x0
+  8037f3:	e8 22 da ff ff       	call   80121a <sys_page_unmap>
+  8037f8:	83 c4 10             	add    $0x10,%esp
+}
+  8037fb:	89 d8                	mov    %ebx,%eax
+  8037fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803800:	5b                   	pop    %ebx
+  803801:	5e                   	pop    %esi
+  803802:	5d                   	pop    %ebp
+  803803:	c3                   	ret
+
+00803804 <pipeisclosed>:
+{
+  803804:	55                   	push   %ebp
+  803805:	89 e5                	mov    %esp,%ebp
+  803807:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80380a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80380d:	50                   	push   %eax
+  80380e:	ff 75 08             	push   0x8(%ebp)
+  803811:	e8 ee de ff ff       	call   801704 <fd_lookup>
+  803816:	83 c4 10             	add    $0x10,%esp
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	78 18                	js     803835 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80381d:	83 ec 0c             	sub    $0xc,%esp
+  803820:	ff 75 f4             	push   -0xc(%ebp)
+  803823:	e8 6f de ff ff       	call   801697 <fd2data>
+  803828:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80382a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80382d:	e8 27 fc ff ff       	call   803459 <_pipeisclosed>
+  803832:	83 c4 10             	add    $0x10,%esp
+}
+  803835:	c9                   	leave
+  803836:	c3                   	ret
+
+00803837 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803837:	55                   	push   %ebp
+  803838:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80383a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80383d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803843:	5d                   	pop    %ebp
+  803844:	c3                   	ret
+
+00803845 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803845:	55                   	push   %ebp
+  803846:	89 e5                	mov    %esp,%ebp
+  803848:	56                   	push   %esi
+  803849:	53                   	push   %ebx
+  80384a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80384d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803852:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803857:	89 d0                	mov    %edx,%eax
+  803859:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80385d:	85 c0                	test   %eax,%eax
+  80385f:	74 2d                	je     80388e <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803861:	83 f8 02             	cmp    $0x2,%eax
+  803864:	74 08                	je     80386e <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803866:	b8 02 00 00 00       	mov    $0x2,%eax
+  80386b:	f0 87 03             	lock xchg %eax,(%ebx)
+  80386e:	be 02 00 00 00       	mov    $0x2,%esi
+  803873:	eb 15                	jmp    80388a <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803875:	83 ec 04             	sub    $0x4,%esp
+  803878:	6a 00                	push   $0x0
+  80387a:	6a 02                	push   $0x2
+  80387c:	53                   	push   %ebx
+  80387d:	e8 14 dc ff ff       	call   801496 <sys_futex_wait>
+  803882:	89 f0                	mov    %esi,%eax
+  803884:	f0 87 03             	lock xchg %eax,(%ebx)
+  803887:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80388a:	85 c0                	test   %eax,%eax
+  80388c:	75 e7                	jne    803875 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80388e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803891:	5b                   	pop    %ebx
+  803892:	5e                   	pop    %esi
+  803893:	5d                   	pop    %ebp
+  803894:	c3                   	ret
+
+00803895 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803895:	55                   	push   %ebp
+  803896:	89 e5                	mov    %esp,%ebp
+  803898:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80389b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8038a5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8038a9:	f7 d8                	neg    %eax
+  8038ab:	19 c0                	sbb    %eax,%eax
+  8038ad:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8038b0:	5d                   	pop    %ebp
+  8038b1:	c3                   	ret
+
+008038b2 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8038b2:	55                   	push   %ebp
+  8038b3:	89 e5                	mov    %esp,%ebp
+  8038b5:	83 ec 08             	sub    $0x8,%esp
+  8038b8:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8038bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c0:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8038c3:	83 f8 02             	cmp    $0x2,%eax
+  8038c6:	74 02                	je     8038ca <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8038c8:	c9                   	leave
+  8038c9:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8038ca:	83 ec 08             	sub    $0x8,%esp
+  8038cd:	6a 01                	push   $0x1
+  8038cf:	52                   	push   %edx
+  8038d0:	e8 f0 db ff ff       	call   8014c5 <sys_futex_wake>
+  8038d5:	83 c4 10             	add    $0x10,%esp
+}
+  8038d8:	eb ee                	jmp    8038c8 <mutex_unlock+0x16>
+
+008038da <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8038da:	55                   	push   %ebp
+  8038db:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8038dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038e0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8038e6:	5d                   	pop    %ebp
+  8038e7:	c3                   	ret
+
+008038e8 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8038e8:	55                   	push   %ebp
+  8038e9:	89 e5                	mov    %esp,%ebp
+  8038eb:	57                   	push   %edi
+  8038ec:	56                   	push   %esi
+  8038ed:	53                   	push   %ebx
+  8038ee:	83 ec 18             	sub    $0x18,%esp
+  8038f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8038f7:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8038f9:	53                   	push   %ebx
+  8038fa:	e8 b3 ff ff ff       	call   8038b2 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8038ff:	83 c4 0c             	add    $0xc,%esp
+  803902:	ff 75 10             	push   0x10(%ebp)
+  803905:	57                   	push   %edi
+  803906:	56                   	push   %esi
+  803907:	e8 8a db ff ff       	call   801496 <sys_futex_wait>
+  80390c:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80390e:	83 c4 10             	add    $0x10,%esp
+  803911:	be 02 00 00 00       	mov    $0x2,%esi
+  803916:	eb 10                	jmp    803928 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803918:	83 ec 04             	sub    $0x4,%esp
+  80391b:	6a 00                	push   $0x0
+  80391d:	6a 02                	push   $0x2
+  80391f:	53                   	push   %ebx
+  803920:	e8 71 db ff ff       	call   801496 <sys_futex_wait>
+  803925:	83 c4 10             	add    $0x10,%esp
+  803928:	89 f0                	mov    %esi,%eax
+  80392a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80392d:	85 c0                	test   %eax,%eax
+  80392f:	75 e7                	jne    803918 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803931:	83 ff ec             	cmp    $0xffffffec,%edi
+  803934:	74 05                	je     80393b <cond_timedwait+0x53>
+  803936:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80393b:	89 f8                	mov    %edi,%eax
+  80393d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803940:	5b                   	pop    %ebx
+  803941:	5e                   	pop    %esi
+  803942:	5f                   	pop    %edi
+  803943:	5d                   	pop    %ebp
+  803944:	c3                   	ret
+
+00803945 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803945:	55                   	push   %ebp
+  803946:	89 e5                	mov    %esp,%ebp
+  803948:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80394b:	6a 00                	push   $0x0
+  80394d:	ff 75 0c             	push   0xc(%ebp)
+  803950:	ff 75 08             	push   0x8(%ebp)
+  803953:	e8 90 ff ff ff       	call   8038e8 <cond_timedwait>
+}
+  803958:	83 c4 10             	add    $0x10,%esp
+  80395b:	c9                   	leave
+  80395c:	c3                   	ret
+
+0080395d <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80395d:	55                   	push   %ebp
+  80395e:	89 e5                	mov    %esp,%ebp
+  803960:	83 ec 10             	sub    $0x10,%esp
+  803963:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803966:	ba 01 00 00 00       	mov    $0x1,%edx
+  80396b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80396f:	6a 01                	push   $0x1
+  803971:	50                   	push   %eax
+  803972:	e8 4e db ff ff       	call   8014c5 <sys_futex_wake>
+}
+  803977:	83 c4 10             	add    $0x10,%esp
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+
+0080397c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80397c:	55                   	push   %ebp
+  80397d:	89 e5                	mov    %esp,%ebp
+  80397f:	83 ec 10             	sub    $0x10,%esp
+  803982:	8b 45 08             	mov    0x8(%ebp),%eax
+  803985:	ba 01 00 00 00       	mov    $0x1,%edx
+  80398a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80398e:	68 00 04 00 00       	push   $0x400
+  803993:	50                   	push   %eax
+  803994:	e8 2c db ff ff       	call   8014c5 <sys_futex_wake>
+}
+  803999:	83 c4 10             	add    $0x10,%esp
+  80399c:	c9                   	leave
+  80399d:	c3                   	ret
+
+0080399e <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80399e:	55                   	push   %ebp
+  80399f:	89 e5                	mov    %esp,%ebp
+  8039a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8039a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039a7:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8039a9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8039b0:	5d                   	pop    %ebp
+  8039b1:	c3                   	ret
+
+008039b2 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8039b2:	55                   	push   %ebp
+  8039b3:	89 e5                	mov    %esp,%ebp
+  8039b5:	53                   	push   %ebx
+  8039b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8039b9:	8b 11                	mov    (%ecx),%edx
+  8039bb:	85 d2                	test   %edx,%edx
+  8039bd:	74 14                	je     8039d3 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8039bf:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8039c2:	89 d0                	mov    %edx,%eax
+  8039c4:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8039c8:	39 c2                	cmp    %eax,%edx
+  8039ca:	75 ed                	jne    8039b9 <sem_trywait+0x7>
+			return 0;
+  8039cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d1:	eb 05                	jmp    8039d8 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8039d3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8039d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039db:	c9                   	leave
+  8039dc:	c3                   	ret
+
+008039dd <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8039dd:	55                   	push   %ebp
+  8039de:	89 e5                	mov    %esp,%ebp
+  8039e0:	57                   	push   %edi
+  8039e1:	56                   	push   %esi
+  8039e2:	53                   	push   %ebx
+  8039e3:	83 ec 1c             	sub    $0x1c,%esp
+  8039e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8039e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8039ec:	e8 1d da ff ff       	call   80140e <sys_time_msec>
+  8039f1:	01 f8                	add    %edi,%eax
+  8039f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8039f6:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8039fb:	eb 28                	jmp    803a25 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8039fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a02:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803a07:	83 ec 04             	sub    $0x4,%esp
+  803a0a:	56                   	push   %esi
+  803a0b:	6a 00                	push   $0x0
+  803a0d:	53                   	push   %ebx
+  803a0e:	e8 83 da ff ff       	call   801496 <sys_futex_wait>
+  803a13:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803a18:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803a1d:	83 c4 10             	add    $0x10,%esp
+  803a20:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803a23:	74 2e                	je     803a53 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803a25:	83 ec 0c             	sub    $0xc,%esp
+  803a28:	53                   	push   %ebx
+  803a29:	e8 84 ff ff ff       	call   8039b2 <sem_trywait>
+  803a2e:	83 c4 10             	add    $0x10,%esp
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	79 19                	jns    803a4e <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803a35:	85 ff                	test   %edi,%edi
+  803a37:	74 c4                	je     8039fd <sem_timedwait+0x20>
+  803a39:	e8 d0 d9 ff ff       	call   80140e <sys_time_msec>
+  803a3e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803a41:	29 c6                	sub    %eax,%esi
+  803a43:	85 f6                	test   %esi,%esi
+  803a45:	7f b6                	jg     8039fd <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803a47:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803a4c:	eb 05                	jmp    803a53 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a56:	5b                   	pop    %ebx
+  803a57:	5e                   	pop    %esi
+  803a58:	5f                   	pop    %edi
+  803a59:	5d                   	pop    %ebp
+  803a5a:	c3                   	ret
+
+00803a5b <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803a5b:	55                   	push   %ebp
+  803a5c:	89 e5                	mov    %esp,%ebp
+  803a5e:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803a61:	6a 00                	push   $0x0
+  803a63:	ff 75 08             	push   0x8(%ebp)
+  803a66:	e8 72 ff ff ff       	call   8039dd <sem_timedwait>
+}
+  803a6b:	83 c4 10             	add    $0x10,%esp
+  803a6e:	c9                   	leave
+  803a6f:	c3                   	ret
+
+00803a70 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803a70:	55                   	push   %ebp
+  803a71:	89 e5                	mov    %esp,%ebp
+  803a73:	83 ec 08             	sub    $0x8,%esp
+  803a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a79:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a7e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803a82:	8b 50 04             	mov    0x4(%eax),%edx
+  803a85:	85 d2                	test   %edx,%edx
+  803a87:	75 02                	jne    803a8b <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803a89:	c9                   	leave
+  803a8a:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803a8b:	83 ec 08             	sub    $0x8,%esp
+  803a8e:	6a 01                	push   $0x1
+  803a90:	50                   	push   %eax
+  803a91:	e8 2f da ff ff       	call   8014c5 <sys_futex_wake>
+  803a96:	83 c4 10             	add    $0x10,%esp
+}
+  803a99:	eb ee                	jmp    803a89 <sem_post+0x19>
+
+00803a9b <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803a9b:	55                   	push   %ebp
+  803a9c:	89 e5                	mov    %esp,%ebp
+  803a9e:	57                   	push   %edi
+  803a9f:	56                   	push   %esi
+  803aa0:	53                   	push   %ebx
+  803aa1:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803aa4:	68 c0 70 80 00       	push   $0x8070c0
+  803aa9:	e8 97 fd ff ff       	call   803845 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803aae:	a1 e4 70 80 00       	mov    0x8070e4,%eax
+  803ab3:	83 c4 10             	add    $0x10,%esp
+  803ab6:	85 c0                	test   %eax,%eax
+  803ab8:	75 19                	jne    803ad3 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803aba:	a1 60 73 80 00       	mov    0x807360,%eax
+  803abf:	8b 00                	mov    (%eax),%eax
+  803ac1:	8b 40 48             	mov    0x48(%eax),%eax
+  803ac4:	a3 e0 70 80 00       	mov    %eax,0x8070e0
+		threads[0].th_state = PTH_RUNNING;
+  803ac9:	c7 05 e4 70 80 00 01 	movl   $0x1,0x8070e4
+  803ad0:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803ad3:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803ad8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803adb:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803ae2:	8b 40 04             	mov    0x4(%eax),%eax
+  803ae5:	85 c0                	test   %eax,%eax
+  803ae7:	0f 84 e4 00 00 00    	je     803bd1 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803aed:	83 c3 01             	add    $0x1,%ebx
+  803af0:	83 fb 20             	cmp    $0x20,%ebx
+  803af3:	75 e3                	jne    803ad8 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803af5:	83 ec 0c             	sub    $0xc,%esp
+  803af8:	68 c0 70 80 00       	push   $0x8070c0
+  803afd:	e8 b0 fd ff ff       	call   8038b2 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803b02:	83 c4 10             	add    $0x10,%esp
+  803b05:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803b0a:	e9 b8 00 00 00       	jmp    803bc7 <pthread_create+0x12c>
+  803b0f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803b12:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803b15:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803b17:	39 f3                	cmp    %esi,%ebx
+  803b19:	73 16                	jae    803b31 <pthread_create+0x96>
+		va -= PGSIZE;
+  803b1b:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803b21:	83 ec 08             	sub    $0x8,%esp
+  803b24:	56                   	push   %esi
+  803b25:	6a 00                	push   $0x0
+  803b27:	e8 ee d6 ff ff       	call   80121a <sys_page_unmap>
+  803b2c:	83 c4 10             	add    $0x10,%esp
+  803b2f:	eb e6                	jmp    803b17 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803b31:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803b34:	83 ec 08             	sub    $0x8,%esp
+  803b37:	ff 75 e4             	push   -0x1c(%ebp)
+  803b3a:	6a 00                	push   $0x0
+  803b3c:	e8 d9 d6 ff ff       	call   80121a <sys_page_unmap>
+	return r;
+  803b41:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803b44:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b47:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803b4e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803b55:	eb 70                	jmp    803bc7 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803b57:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b5a:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803b61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b64:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803b67:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b6a:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803b6d:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803b74:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803b79:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803b7c:	29 c8                	sub    %ecx,%eax
+  803b7e:	85 db                	test   %ebx,%ebx
+  803b80:	0f 44 05 60 73 80 00 	cmove  0x807360,%eax
+	*--esp = t;
+  803b87:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803b8a:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803b91:	83 ec 04             	sub    $0x4,%esp
+  803b94:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803b99:	29 ca                	sub    %ecx,%edx
+  803b9b:	52                   	push   %edx
+	*--esp = 0;
+  803b9c:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803b9f:	50                   	push   %eax
+  803ba0:	68 f8 3d 80 00       	push   $0x803df8
+  803ba5:	e8 c0 d9 ff ff       	call   80156a <sys_thread_create>
+  803baa:	89 c7                	mov    %eax,%edi
+  803bac:	83 c4 10             	add    $0x10,%esp
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	78 91                	js     803b44 <pthread_create+0xa9>
+	th->th_env = id;
+  803bb3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bb6:	89 3c 85 e0 70 80 00 	mov    %edi,0x8070e0(,%eax,4)
+	*tp = t;
+  803bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bc0:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803bc2:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803bc7:	89 f8                	mov    %edi,%eax
+  803bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bcc:	5b                   	pop    %ebx
+  803bcd:	5e                   	pop    %esi
+  803bce:	5f                   	pop    %edi
+  803bcf:	5d                   	pop    %ebp
+  803bd0:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803bd1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bd4:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803bdb:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803be2:	83 ec 0c             	sub    $0xc,%esp
+  803be5:	68 c0 70 80 00       	push   $0x8070c0
+  803bea:	e8 c3 fc ff ff       	call   8038b2 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803bef:	89 d9                	mov    %ebx,%ecx
+  803bf1:	c1 e1 10             	shl    $0x10,%ecx
+  803bf4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803bf7:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803bfc:	29 c8                	sub    %ecx,%eax
+  803bfe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803c01:	c1 e8 16             	shr    $0x16,%eax
+  803c04:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c0b:	83 c4 10             	add    $0x10,%esp
+  803c0e:	a8 01                	test   $0x1,%al
+  803c10:	74 15                	je     803c27 <pthread_create+0x18c>
+  803c12:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c15:	c1 e8 0c             	shr    $0xc,%eax
+  803c18:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c1f:	a8 01                	test   $0x1,%al
+  803c21:	0f 85 30 ff ff ff    	jne    803b57 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803c27:	83 ec 04             	sub    $0x4,%esp
+  803c2a:	6a 07                	push   $0x7
+  803c2c:	ff 75 e4             	push   -0x1c(%ebp)
+  803c2f:	6a 00                	push   $0x0
+  803c31:	e8 4b d5 ff ff       	call   801181 <sys_page_alloc>
+  803c36:	89 c7                	mov    %eax,%edi
+  803c38:	83 c4 10             	add    $0x10,%esp
+  803c3b:	85 c0                	test   %eax,%eax
+  803c3d:	0f 88 01 ff ff ff    	js     803b44 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803c43:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803c48:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803c4b:	29 d0                	sub    %edx,%eax
+  803c4d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803c50:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803c52:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803c57:	29 d0                	sub    %edx,%eax
+  803c59:	89 c7                	mov    %eax,%edi
+  803c5b:	39 fe                	cmp    %edi,%esi
+  803c5d:	0f 83 f4 fe ff ff    	jae    803b57 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803c63:	83 ec 04             	sub    $0x4,%esp
+  803c66:	6a 07                	push   $0x7
+  803c68:	56                   	push   %esi
+  803c69:	6a 00                	push   $0x0
+  803c6b:	e8 11 d5 ff ff       	call   801181 <sys_page_alloc>
+  803c70:	83 c4 10             	add    $0x10,%esp
+  803c73:	85 c0                	test   %eax,%eax
+  803c75:	0f 88 94 fe ff ff    	js     803b0f <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803c7b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803c81:	eb d8                	jmp    803c5b <pthread_create+0x1c0>
+
+00803c83 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803c83:	55                   	push   %ebp
+  803c84:	89 e5                	mov    %esp,%ebp
+  803c86:	57                   	push   %edi
+  803c87:	56                   	push   %esi
+  803c88:	53                   	push   %ebx
+  803c89:	83 ec 0c             	sub    $0xc,%esp
+  803c8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803c8f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803c92:	83 f8 1e             	cmp    $0x1e,%eax
+  803c95:	0f 87 c7 00 00 00    	ja     803d62 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803c9b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c9d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ca3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ca8:	77 12                	ja     803cbc <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803caa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803caf:	29 d0                	sub    %edx,%eax
+  803cb1:	c1 e8 10             	shr    $0x10,%eax
+  803cb4:	39 c3                	cmp    %eax,%ebx
+  803cb6:	0f 84 ad 00 00 00    	je     803d69 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803cbc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cbf:	8d 3c 85 e4 70 80 00 	lea    0x8070e4(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803cc6:	8d 34 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%esi
+  803ccd:	eb 10                	jmp    803cdf <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ccf:	83 ec 04             	sub    $0x4,%esp
+  803cd2:	6a 00                	push   $0x0
+  803cd4:	6a 01                	push   $0x1
+  803cd6:	57                   	push   %edi
+  803cd7:	e8 ba d7 ff ff       	call   801496 <sys_futex_wait>
+  803cdc:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803cdf:	8b 46 04             	mov    0x4(%esi),%eax
+  803ce2:	83 f8 01             	cmp    $0x1,%eax
+  803ce5:	74 e8                	je     803ccf <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803ce7:	83 f8 02             	cmp    $0x2,%eax
+  803cea:	0f 85 80 00 00 00    	jne    803d70 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803cf0:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803cf3:	c1 e6 02             	shl    $0x2,%esi
+  803cf6:	eb 05                	jmp    803cfd <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803cf8:	e8 58 d4 ff ff       	call   801155 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803cfd:	8b 8e e0 70 80 00    	mov    0x8070e0(%esi),%ecx
+  803d03:	89 ca                	mov    %ecx,%edx
+  803d05:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803d0b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803d0e:	c1 e0 04             	shl    $0x4,%eax
+  803d11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d16:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803d19:	39 c1                	cmp    %eax,%ecx
+  803d1b:	75 12                	jne    803d2f <pthread_join+0xac>
+  803d1d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803d20:	c1 e0 04             	shl    $0x4,%eax
+  803d23:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d28:	8b 40 54             	mov    0x54(%eax),%eax
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	75 c9                	jne    803cf8 <pthread_join+0x75>
+	if (ret_store)
+  803d2f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803d33:	74 0f                	je     803d44 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803d35:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d38:	8b 04 85 f0 70 80 00 	mov    0x8070f0(,%eax,4),%eax
+  803d3f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803d42:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803d44:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d47:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803d4e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d5d:	5b                   	pop    %ebx
+  803d5e:	5e                   	pop    %esi
+  803d5f:	5f                   	pop    %edi
+  803d60:	5d                   	pop    %ebp
+  803d61:	c3                   	ret
+		return -E_INVAL;
+  803d62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d67:	eb f1                	jmp    803d5a <pthread_join+0xd7>
+  803d69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d6e:	eb ea                	jmp    803d5a <pthread_join+0xd7>
+		return -E_INVAL;
+  803d70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d75:	eb e3                	jmp    803d5a <pthread_join+0xd7>
+
+00803d77 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803d77:	55                   	push   %ebp
+  803d78:	89 e5                	mov    %esp,%ebp
+  803d7a:	53                   	push   %ebx
+  803d7b:	83 ec 04             	sub    $0x4,%esp
+  803d7e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d80:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803d86:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d8b:	77 0c                	ja     803d99 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d8d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d92:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803d94:	c1 e8 10             	shr    $0x10,%eax
+  803d97:	75 0a                	jne    803da3 <pthread_exit+0x2c>
+		exit();
+  803d99:	e8 be c8 ff ff       	call   80065c <exit>
+  803d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803da3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803daa:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803dad:	8d 0c 8d e0 70 80 00 	lea    0x8070e0(,%ecx,4),%ecx
+  803db4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803db7:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803dba:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803dc1:	83 ec 08             	sub    $0x8,%esp
+  803dc4:	6a 20                	push   $0x20
+  803dc6:	01 c2                	add    %eax,%edx
+  803dc8:	8d 04 95 e4 70 80 00 	lea    0x8070e4(,%edx,4),%eax
+  803dcf:	50                   	push   %eax
+  803dd0:	e8 f0 d6 ff ff       	call   8014c5 <sys_futex_wake>
+	sys_env_destroy(0);
+  803dd5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803ddc:	e8 fd d2 ff ff       	call   8010de <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803de1:	83 c4 0c             	add    $0xc,%esp
+  803de4:	68 e6 52 80 00       	push   $0x8052e6
+  803de9:	68 a5 00 00 00       	push   $0xa5
+  803dee:	68 00 53 80 00       	push   $0x805300
+  803df3:	e8 8c c8 ff ff       	call   800684 <_panic>
+
+00803df8 <pthread_start>:
+{
+  803df8:	55                   	push   %ebp
+  803df9:	89 e5                	mov    %esp,%ebp
+  803dfb:	53                   	push   %ebx
+  803dfc:	83 ec 04             	sub    $0x4,%esp
+  803dff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803e02:	e8 22 d3 ff ff       	call   801129 <sys_getenvid>
+  803e07:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803e0c:	8b 15 60 73 80 00    	mov    0x807360,%edx
+	if (t == 0)
+  803e12:	85 db                	test   %ebx,%ebx
+  803e14:	74 0c                	je     803e22 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e16:	89 d9                	mov    %ebx,%ecx
+  803e18:	c1 e1 10             	shl    $0x10,%ecx
+  803e1b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e20:	29 ca                	sub    %ecx,%edx
+  803e22:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e25:	c1 e0 04             	shl    $0x4,%eax
+  803e28:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e2d:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803e2f:	83 ec 0c             	sub    $0xc,%esp
+  803e32:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803e39:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803e3c:	ff 34 95 ec 70 80 00 	push   0x8070ec(,%edx,4)
+  803e43:	ff 14 95 e8 70 80 00 	call   *0x8070e8(,%edx,4)
+  803e4a:	89 04 24             	mov    %eax,(%esp)
+  803e4d:	e8 25 ff ff ff       	call   803d77 <pthread_exit>
+
+00803e52 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803e52:	55                   	push   %ebp
+  803e53:	89 e5                	mov    %esp,%ebp
+  803e55:	57                   	push   %edi
+  803e56:	56                   	push   %esi
+  803e57:	53                   	push   %ebx
+  803e58:	83 ec 1c             	sub    $0x1c,%esp
+  803e5b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e5d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803e63:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e6a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e6f:	77 0d                	ja     803e7e <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e71:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e76:	29 d0                	sub    %edx,%eax
+  803e78:	c1 e8 10             	shr    $0x10,%eax
+  803e7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e83:	eb 2f                	jmp    803eb4 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803e85:	8b 0d 60 73 80 00    	mov    0x807360,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803e8b:	8b 01                	mov    (%ecx),%eax
+  803e8d:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803e90:	39 c2                	cmp    %eax,%edx
+  803e92:	75 14                	jne    803ea8 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803e94:	83 ec 0c             	sub    $0xc,%esp
+  803e97:	57                   	push   %edi
+  803e98:	e8 41 d2 ff ff       	call   8010de <sys_env_destroy>
+  803e9d:	83 c4 10             	add    $0x10,%esp
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	0f 88 97 00 00 00    	js     803f3f <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803ea8:	83 c3 01             	add    $0x1,%ebx
+  803eab:	83 fb 20             	cmp    $0x20,%ebx
+  803eae:	0f 84 d2 00 00 00    	je     803f86 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803eb4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803eb7:	74 ef                	je     803ea8 <pthread_kill_others+0x56>
+  803eb9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ebc:	8d 04 85 e0 70 80 00 	lea    0x8070e0(,%eax,4),%eax
+  803ec3:	8b 40 04             	mov    0x4(%eax),%eax
+  803ec6:	83 f8 01             	cmp    $0x1,%eax
+  803ec9:	75 dd                	jne    803ea8 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803ecb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ece:	8b 3c 85 e0 70 80 00 	mov    0x8070e0(,%eax,4),%edi
+  803ed5:	89 fe                	mov    %edi,%esi
+  803ed7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803edd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ee0:	c1 e0 04             	shl    $0x4,%eax
+  803ee3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ee8:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803eeb:	39 c7                	cmp    %eax,%edi
+  803eed:	75 b9                	jne    803ea8 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803eef:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ef2:	c1 e0 04             	shl    $0x4,%eax
+  803ef5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803efa:	8b 40 54             	mov    0x54(%eax),%eax
+  803efd:	85 c0                	test   %eax,%eax
+  803eff:	74 a7                	je     803ea8 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f01:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f04:	c1 e0 04             	shl    $0x4,%eax
+  803f07:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803f0d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f0f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803f15:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f1a:	0f 87 65 ff ff ff    	ja     803e85 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f20:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f25:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803f27:	c1 e8 10             	shr    $0x10,%eax
+  803f2a:	0f 84 55 ff ff ff    	je     803e85 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f30:	c1 e0 10             	shl    $0x10,%eax
+  803f33:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803f38:	29 c1                	sub    %eax,%ecx
+  803f3a:	e9 4c ff ff ff       	jmp    803e8b <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803f3f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803f42:	c1 e2 04             	shl    $0x4,%edx
+  803f45:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803f4b:	8b 52 48             	mov    0x48(%edx),%edx
+  803f4e:	39 fa                	cmp    %edi,%edx
+  803f50:	0f 85 52 ff ff ff    	jne    803ea8 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803f56:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803f59:	c1 e2 04             	shl    $0x4,%edx
+  803f5c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803f62:	8b 52 54             	mov    0x54(%edx),%edx
+  803f65:	85 d2                	test   %edx,%edx
+  803f67:	0f 84 3b ff ff ff    	je     803ea8 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803f6d:	83 ec 0c             	sub    $0xc,%esp
+  803f70:	50                   	push   %eax
+  803f71:	57                   	push   %edi
+  803f72:	68 10 53 80 00       	push   $0x805310
+  803f77:	68 bb 00 00 00       	push   $0xbb
+  803f7c:	68 00 53 80 00       	push   $0x805300
+  803f81:	e8 fe c6 ff ff       	call   800684 <_panic>
+	}
+}
+  803f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f89:	5b                   	pop    %ebx
+  803f8a:	5e                   	pop    %esi
+  803f8b:	5f                   	pop    %edi
+  803f8c:	5d                   	pop    %ebp
+  803f8d:	c3                   	ret
+
+00803f8e <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803f8e:	55                   	push   %ebp
+  803f8f:	89 e5                	mov    %esp,%ebp
+  803f91:	53                   	push   %ebx
+  803f92:	83 ec 04             	sub    $0x4,%esp
+  803f95:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f97:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803f9d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803fa3:	0f 87 85 00 00 00    	ja     80402e <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fa9:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803fae:	29 c3                	sub    %eax,%ebx
+  803fb0:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803fb3:	83 ec 04             	sub    $0x4,%esp
+  803fb6:	68 80 02 00 00       	push   $0x280
+  803fbb:	6a 00                	push   $0x0
+  803fbd:	68 e0 70 80 00       	push   $0x8070e0
+  803fc2:	e8 cd ce ff ff       	call   800e94 <memset>
+	threads_mu.m_state = 0;
+  803fc7:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  803fce:	00 00 00 
+	if (self != 0) {
+  803fd1:	83 c4 10             	add    $0x10,%esp
+  803fd4:	85 db                	test   %ebx,%ebx
+  803fd6:	74 51                	je     804029 <pthread_fork_child+0x9b>
+  803fd8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fda:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fe0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fe5:	77 18                	ja     803fff <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fe7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fec:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803fee:	c1 e8 10             	shr    $0x10,%eax
+  803ff1:	74 0c                	je     803fff <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ff3:	c1 e0 10             	shl    $0x10,%eax
+  803ff6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ffb:	29 c2                	sub    %eax,%edx
+  803ffd:	eb 06                	jmp    804005 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803fff:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		threads[self].th_env = thisenv->env_id;
+  804005:	8b 02                	mov    (%edx),%eax
+  804007:	8b 48 48             	mov    0x48(%eax),%ecx
+  80400a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804011:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804014:	89 0c 95 e0 70 80 00 	mov    %ecx,0x8070e0(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80401b:	8d 04 95 e0 70 80 00 	lea    0x8070e0(,%edx,4),%eax
+  804022:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804029:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80402c:	c9                   	leave
+  80402d:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80402e:	83 ec 04             	sub    $0x4,%esp
+  804031:	68 80 02 00 00       	push   $0x280
+  804036:	6a 00                	push   $0x0
+  804038:	68 e0 70 80 00       	push   $0x8070e0
+  80403d:	e8 52 ce ff ff       	call   800e94 <memset>
+	threads_mu.m_state = 0;
+  804042:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  804049:	00 00 00 
+  80404c:	83 c4 10             	add    $0x10,%esp
+  80404f:	eb d8                	jmp    804029 <pthread_fork_child+0x9b>
+
+00804051 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804051:	b8 00 00 00 00       	mov    $0x0,%eax
+  804056:	c3                   	ret
+
+00804057 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804057:	55                   	push   %ebp
+  804058:	89 e5                	mov    %esp,%ebp
+  80405a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80405d:	68 35 53 80 00       	push   $0x805335
+  804062:	ff 75 0c             	push   0xc(%ebp)
+  804065:	e8 d9 cc ff ff       	call   800d43 <strcpy>
+	return 0;
+}
+  80406a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406f:	c9                   	leave
+  804070:	c3                   	ret
+
+00804071 <devcons_write>:
+{
+  804071:	55                   	push   %ebp
+  804072:	89 e5                	mov    %esp,%ebp
+  804074:	57                   	push   %edi
+  804075:	56                   	push   %esi
+  804076:	53                   	push   %ebx
+  804077:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80407d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804082:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804088:	eb 2e                	jmp    8040b8 <devcons_write+0x47>
+		m = n - tot;
+  80408a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80408d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80408f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804094:	39 c3                	cmp    %eax,%ebx
+  804096:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804099:	83 ec 04             	sub    $0x4,%esp
+  80409c:	53                   	push   %ebx
+  80409d:	89 f0                	mov    %esi,%eax
+  80409f:	03 45 0c             	add    0xc(%ebp),%eax
+  8040a2:	50                   	push   %eax
+  8040a3:	57                   	push   %edi
+  8040a4:	e8 20 ce ff ff       	call   800ec9 <memmove>
+		sys_cputs(buf, m);
+  8040a9:	83 c4 08             	add    $0x8,%esp
+  8040ac:	53                   	push   %ebx
+  8040ad:	57                   	push   %edi
+  8040ae:	e8 d4 cf ff ff       	call   801087 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8040b3:	01 de                	add    %ebx,%esi
+  8040b5:	83 c4 10             	add    $0x10,%esp
+  8040b8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8040bb:	72 cd                	jb     80408a <devcons_write+0x19>
+}
+  8040bd:	89 f0                	mov    %esi,%eax
+  8040bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040c2:	5b                   	pop    %ebx
+  8040c3:	5e                   	pop    %esi
+  8040c4:	5f                   	pop    %edi
+  8040c5:	5d                   	pop    %ebp
+  8040c6:	c3                   	ret
+
+008040c7 <devcons_read>:
+{
+  8040c7:	55                   	push   %ebp
+  8040c8:	89 e5                	mov    %esp,%ebp
+  8040ca:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8040cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8040d6:	75 07                	jne    8040df <devcons_read+0x18>
+  8040d8:	eb 1f                	jmp    8040f9 <devcons_read+0x32>
+		sys_yield();
+  8040da:	e8 76 d0 ff ff       	call   801155 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8040df:	e8 ce cf ff ff       	call   8010b2 <sys_cgetc>
+  8040e4:	85 c0                	test   %eax,%eax
+  8040e6:	74 f2                	je     8040da <devcons_read+0x13>
+	if (c < 0)
+  8040e8:	78 0f                	js     8040f9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8040ea:	83 f8 04             	cmp    $0x4,%eax
+  8040ed:	74 0c                	je     8040fb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8040ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8040f2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8040f4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8040f9:	c9                   	leave
+  8040fa:	c3                   	ret
+		return 0;
+  8040fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804100:	eb f7                	jmp    8040f9 <devcons_read+0x32>
+
+00804102 <cputchar>:
+{
+  804102:	55                   	push   %ebp
+  804103:	89 e5                	mov    %esp,%ebp
+  804105:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804108:	8b 45 08             	mov    0x8(%ebp),%eax
+  80410b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80410e:	6a 01                	push   $0x1
+  804110:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804113:	50                   	push   %eax
+  804114:	e8 6e cf ff ff       	call   801087 <sys_cputs>
+}
+  804119:	83 c4 10             	add    $0x10,%esp
+  80411c:	c9                   	leave
+  80411d:	c3                   	ret
+
+0080411e <getchar>:
+{
+  80411e:	55                   	push   %ebp
+  80411f:	89 e5                	mov    %esp,%ebp
+  804121:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804124:	6a 01                	push   $0x1
+  804126:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804129:	50                   	push   %eax
+  80412a:	6a 00                	push   $0x0
+  80412c:	e8 63 d8 ff ff       	call   801994 <read>
+	if (r < 0)
+  804131:	83 c4 10             	add    $0x10,%esp
+  804134:	85 c0                	test   %eax,%eax
+  804136:	78 06                	js     80413e <getchar+0x20>
+	if (r < 1)
+  804138:	74 06                	je     804140 <getchar+0x22>
+	return c;
+  80413a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80413e:	c9                   	leave
+  80413f:	c3                   	ret
+		return -E_EOF;
+  804140:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804145:	eb f7                	jmp    80413e <getchar+0x20>
+
+00804147 <iscons>:
+{
+  804147:	55                   	push   %ebp
+  804148:	89 e5                	mov    %esp,%ebp
+  80414a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80414d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804150:	50                   	push   %eax
+  804151:	ff 75 08             	push   0x8(%ebp)
+  804154:	e8 ab d5 ff ff       	call   801704 <fd_lookup>
+  804159:	83 c4 10             	add    $0x10,%esp
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	78 11                	js     804171 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804163:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804169:	39 10                	cmp    %edx,(%eax)
+  80416b:	0f 94 c0             	sete   %al
+  80416e:	0f b6 c0             	movzbl %al,%eax
+}
+  804171:	c9                   	leave
+  804172:	c3                   	ret
+
+00804173 <opencons>:
+{
+  804173:	55                   	push   %ebp
+  804174:	89 e5                	mov    %esp,%ebp
+  804176:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804179:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80417c:	50                   	push   %eax
+  80417d:	e8 2c d5 ff ff       	call   8016ae <fd_alloc>
+  804182:	83 c4 10             	add    $0x10,%esp
+  804185:	85 c0                	test   %eax,%eax
+  804187:	78 3a                	js     8041c3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804189:	83 ec 04             	sub    $0x4,%esp
+  80418c:	68 07 04 00 00       	push   $0x407
+  804191:	ff 75 f4             	push   -0xc(%ebp)
+  804194:	6a 00                	push   $0x0
+  804196:	e8 e6 cf ff ff       	call   801181 <sys_page_alloc>
+  80419b:	83 c4 10             	add    $0x10,%esp
+  80419e:	85 c0                	test   %eax,%eax
+  8041a0:	78 21                	js     8041c3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8041a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041a5:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8041ab:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8041ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041b0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8041b7:	83 ec 0c             	sub    $0xc,%esp
+  8041ba:	50                   	push   %eax
+  8041bb:	e8 c7 d4 ff ff       	call   801687 <fd2num>
+  8041c0:	83 c4 10             	add    $0x10,%esp
+}
+  8041c3:	c9                   	leave
+  8041c4:	c3                   	ret
+
+008041c5 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8041c5:	55                   	push   %ebp
+  8041c6:	89 e5                	mov    %esp,%ebp
+  8041c8:	57                   	push   %edi
+  8041c9:	56                   	push   %esi
+  8041ca:	53                   	push   %ebx
+  8041cb:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8041ce:	89 d6                	mov    %edx,%esi
+  8041d0:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8041d3:	89 cf                	mov    %ecx,%edi
+  8041d5:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8041d8:	89 fa                	mov    %edi,%edx
+  8041da:	80 ce 08             	or     $0x8,%dh
+  8041dd:	f6 c5 08             	test   $0x8,%ch
+  8041e0:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8041e3:	57                   	push   %edi
+  8041e4:	56                   	push   %esi
+  8041e5:	50                   	push   %eax
+  8041e6:	56                   	push   %esi
+  8041e7:	6a 00                	push   $0x0
+  8041e9:	e8 e0 cf ff ff       	call   8011ce <sys_page_map>
+	if (r < 0) {
+  8041ee:	83 c4 20             	add    $0x20,%esp
+  8041f1:	85 c0                	test   %eax,%eax
+  8041f3:	78 27                	js     80421c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8041f5:	83 ec 0c             	sub    $0xc,%esp
+  8041f8:	57                   	push   %edi
+  8041f9:	56                   	push   %esi
+  8041fa:	6a 00                	push   $0x0
+  8041fc:	56                   	push   %esi
+  8041fd:	6a 00                	push   $0x0
+  8041ff:	e8 ca cf ff ff       	call   8011ce <sys_page_map>
+  804204:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804206:	83 c4 20             	add    $0x20,%esp
+  804209:	85 c0                	test   %eax,%eax
+  80420b:	78 24                	js     804231 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80420d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804212:	89 d8                	mov    %ebx,%eax
+  804214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804217:	5b                   	pop    %ebx
+  804218:	5e                   	pop    %esi
+  804219:	5f                   	pop    %edi
+  80421a:	5d                   	pop    %ebp
+  80421b:	c3                   	ret
+  80421c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80421e:	83 ec 08             	sub    $0x8,%esp
+  804221:	50                   	push   %eax
+  804222:	68 44 53 80 00       	push   $0x805344
+  804227:	e8 33 c5 ff ff       	call   80075f <cprintf>
+		return r;
+  80422c:	83 c4 10             	add    $0x10,%esp
+  80422f:	eb e1                	jmp    804212 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  804231:	83 ec 08             	sub    $0x8,%esp
+  804234:	50                   	push   %eax
+  804235:	68 74 53 80 00       	push   $0x805374
+  80423a:	e8 20 c5 ff ff       	call   80075f <cprintf>
+		return r;
+  80423f:	83 c4 10             	add    $0x10,%esp
+  804242:	eb ce                	jmp    804212 <duppage_cow+0x4d>
+
+00804244 <duppage>:
+{
+  804244:	55                   	push   %ebp
+  804245:	89 e5                	mov    %esp,%ebp
+  804247:	53                   	push   %ebx
+  804248:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80424b:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80424e:	51                   	push   %ecx
+  80424f:	52                   	push   %edx
+  804250:	50                   	push   %eax
+  804251:	52                   	push   %edx
+  804252:	6a 00                	push   $0x0
+  804254:	e8 75 cf ff ff       	call   8011ce <sys_page_map>
+	if (r < 0) {
+  804259:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80425c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  804261:	85 c0                	test   %eax,%eax
+  804263:	78 07                	js     80426c <duppage+0x28>
+}
+  804265:	89 d8                	mov    %ebx,%eax
+  804267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80426a:	c9                   	leave
+  80426b:	c3                   	ret
+  80426c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80426e:	83 ec 08             	sub    $0x8,%esp
+  804271:	50                   	push   %eax
+  804272:	68 44 53 80 00       	push   $0x805344
+  804277:	e8 e3 c4 ff ff       	call   80075f <cprintf>
+		return r;
+  80427c:	83 c4 10             	add    $0x10,%esp
+  80427f:	eb e4                	jmp    804265 <duppage+0x21>
+
+00804281 <cow_copy>:
+{
+  804281:	55                   	push   %ebp
+  804282:	89 e5                	mov    %esp,%ebp
+  804284:	56                   	push   %esi
+  804285:	53                   	push   %ebx
+  804286:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804288:	83 ec 04             	sub    $0x4,%esp
+  80428b:	6a 07                	push   $0x7
+  80428d:	68 00 f0 7f 00       	push   $0x7ff000
+  804292:	6a 00                	push   $0x0
+  804294:	e8 e8 ce ff ff       	call   801181 <sys_page_alloc>
+	if (r < 0) {
+  804299:	83 c4 10             	add    $0x10,%esp
+  80429c:	85 c0                	test   %eax,%eax
+  80429e:	78 58                	js     8042f8 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8042a0:	83 ec 04             	sub    $0x4,%esp
+  8042a3:	68 00 10 00 00       	push   $0x1000
+  8042a8:	56                   	push   %esi
+  8042a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8042ae:	e8 16 cc ff ff       	call   800ec9 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8042b3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8042ba:	56                   	push   %esi
+  8042bb:	6a 00                	push   $0x0
+  8042bd:	68 00 f0 7f 00       	push   $0x7ff000
+  8042c2:	6a 00                	push   $0x0
+  8042c4:	e8 05 cf ff ff       	call   8011ce <sys_page_map>
+  8042c9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8042cb:	83 c4 20             	add    $0x20,%esp
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	78 3b                	js     80430d <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8042d2:	83 ec 08             	sub    $0x8,%esp
+  8042d5:	68 00 f0 7f 00       	push   $0x7ff000
+  8042da:	6a 00                	push   $0x0
+  8042dc:	e8 39 cf ff ff       	call   80121a <sys_page_unmap>
+  8042e1:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8042e3:	83 c4 10             	add    $0x10,%esp
+  8042e6:	85 c0                	test   %eax,%eax
+  8042e8:	78 45                	js     80432f <cow_copy+0xae>
+	return 0;
+  8042ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8042ef:	89 d8                	mov    %ebx,%eax
+  8042f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042f4:	5b                   	pop    %ebx
+  8042f5:	5e                   	pop    %esi
+  8042f6:	5d                   	pop    %ebp
+  8042f7:	c3                   	ret
+  8042f8:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8042fa:	83 ec 08             	sub    $0x8,%esp
+  8042fd:	50                   	push   %eax
+  8042fe:	68 64 54 80 00       	push   $0x805464
+  804303:	e8 57 c4 ff ff       	call   80075f <cprintf>
+		return r;
+  804308:	83 c4 10             	add    $0x10,%esp
+  80430b:	eb e2                	jmp    8042ef <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80430d:	83 ec 08             	sub    $0x8,%esp
+  804310:	50                   	push   %eax
+  804311:	68 80 54 80 00       	push   $0x805480
+  804316:	e8 44 c4 ff ff       	call   80075f <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80431b:	83 c4 08             	add    $0x8,%esp
+  80431e:	68 00 f0 7f 00       	push   $0x7ff000
+  804323:	6a 00                	push   $0x0
+  804325:	e8 f0 ce ff ff       	call   80121a <sys_page_unmap>
+		return r;
+  80432a:	83 c4 10             	add    $0x10,%esp
+  80432d:	eb c0                	jmp    8042ef <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80432f:	83 ec 08             	sub    $0x8,%esp
+  804332:	50                   	push   %eax
+  804333:	68 9c 53 80 00       	push   $0x80539c
+  804338:	e8 22 c4 ff ff       	call   80075f <cprintf>
+		return r;
+  80433d:	83 c4 10             	add    $0x10,%esp
+  804340:	eb ad                	jmp    8042ef <cow_copy+0x6e>
+
+00804342 <pgfault>:
+{
+  804342:	55                   	push   %ebp
+  804343:	89 e5                	mov    %esp,%ebp
+  804345:	56                   	push   %esi
+  804346:	53                   	push   %ebx
+  804347:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80434a:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80434c:	89 d8                	mov    %ebx,%eax
+  80434e:	c1 e8 16             	shr    $0x16,%eax
+  804351:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804358:	89 de                	mov    %ebx,%esi
+  80435a:	c1 ee 0c             	shr    $0xc,%esi
+  80435d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804364:	a8 07                	test   $0x7,%al
+  804366:	74 3b                	je     8043a3 <pgfault+0x61>
+  804368:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80436e:	74 33                	je     8043a3 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804370:	83 ec 0c             	sub    $0xc,%esp
+  804373:	68 00 f0 bf ee       	push   $0xeebff000
+  804378:	e8 c8 f4 ff ff       	call   803845 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80437d:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804384:	83 c4 10             	add    $0x10,%esp
+  804387:	f6 c4 08             	test   $0x8,%ah
+  80438a:	75 30                	jne    8043bc <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80438c:	83 ec 0c             	sub    $0xc,%esp
+  80438f:	68 00 f0 bf ee       	push   $0xeebff000
+  804394:	e8 19 f5 ff ff       	call   8038b2 <mutex_unlock>
+}
+  804399:	83 c4 10             	add    $0x10,%esp
+  80439c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80439f:	5b                   	pop    %ebx
+  8043a0:	5e                   	pop    %esi
+  8043a1:	5d                   	pop    %ebp
+  8043a2:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8043a3:	83 ec 08             	sub    $0x8,%esp
+  8043a6:	ff 72 28             	push   0x28(%edx)
+  8043a9:	51                   	push   %ecx
+  8043aa:	50                   	push   %eax
+  8043ab:	68 c0 53 80 00       	push   $0x8053c0
+  8043b0:	6a 3f                	push   $0x3f
+  8043b2:	68 9a 54 80 00       	push   $0x80549a
+  8043b7:	e8 c8 c2 ff ff       	call   800684 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8043bc:	89 d8                	mov    %ebx,%eax
+  8043be:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8043c3:	e8 b9 fe ff ff       	call   804281 <cow_copy>
+  8043c8:	eb c2                	jmp    80438c <pgfault+0x4a>
+
+008043ca <cow_enable>:
+{
+  8043ca:	55                   	push   %ebp
+  8043cb:	89 e5                	mov    %esp,%ebp
+  8043cd:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8043d0:	68 42 43 80 00       	push   $0x804342
+  8043d5:	e8 49 d2 ff ff       	call   801623 <set_pgfault_handler>
+}
+  8043da:	83 c4 10             	add    $0x10,%esp
+  8043dd:	c9                   	leave
+  8043de:	c3                   	ret
+
+008043df <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8043df:	55                   	push   %ebp
+  8043e0:	89 e5                	mov    %esp,%ebp
+  8043e2:	57                   	push   %edi
+  8043e3:	56                   	push   %esi
+  8043e4:	53                   	push   %ebx
+  8043e5:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8043e8:	68 42 43 80 00       	push   $0x804342
+  8043ed:	e8 31 d2 ff ff       	call   801623 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8043f2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8043f7:	cd 30                	int    $0x30
+  8043f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8043fc:	83 c4 10             	add    $0x10,%esp
+  8043ff:	85 c0                	test   %eax,%eax
+  804401:	78 4b                	js     80444e <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804403:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804408:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80440d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804410:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804414:	0f 85 16 01 00 00    	jne    804530 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80441a:	e8 0a cd ff ff       	call   801129 <sys_getenvid>
+  80441f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804424:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804426:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80442c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804432:	77 32                	ja     804466 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804434:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804439:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80443b:	c1 ea 10             	shr    $0x10,%edx
+  80443e:	74 26                	je     804466 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804440:	c1 e2 10             	shl    $0x10,%edx
+  804443:	89 d1                	mov    %edx,%ecx
+  804445:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80444a:	29 ca                	sub    %ecx,%edx
+  80444c:	eb 1e                	jmp    80446c <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80444e:	83 ec 08             	sub    $0x8,%esp
+  804451:	89 c7                	mov    %eax,%edi
+  804453:	50                   	push   %eax
+  804454:	68 a5 54 80 00       	push   $0x8054a5
+  804459:	e8 01 c3 ff ff       	call   80075f <cprintf>
+		return eid;
+  80445e:	83 c4 10             	add    $0x10,%esp
+  804461:	e9 6c 01 00 00       	jmp    8045d2 <fork+0x1f3>
+		return pthread_main_tls;
+  804466:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80446c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80446f:	c1 e0 04             	shl    $0x4,%eax
+  804472:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804477:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804479:	e8 10 fb ff ff       	call   803f8e <pthread_fork_child>
+		return eid;
+  80447e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804481:	e9 4c 01 00 00       	jmp    8045d2 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804486:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80448c:	89 da                	mov    %ebx,%edx
+  80448e:	89 f8                	mov    %edi,%eax
+  804490:	e8 af fd ff ff       	call   804244 <duppage>
+  804495:	85 c0                	test   %eax,%eax
+  804497:	79 28                	jns    8044c1 <fork+0xe2>
+  804499:	89 c7                	mov    %eax,%edi
+  80449b:	e9 32 01 00 00       	jmp    8045d2 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8044a0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8044a6:	83 f9 05             	cmp    $0x5,%ecx
+  8044a9:	75 58                	jne    804503 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8044ab:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8044b0:	89 da                	mov    %ebx,%edx
+  8044b2:	89 f8                	mov    %edi,%eax
+  8044b4:	e8 8b fd ff ff       	call   804244 <duppage>
+  8044b9:	85 c0                	test   %eax,%eax
+  8044bb:	0f 88 0f 01 00 00    	js     8045d0 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8044c1:	83 c3 01             	add    $0x1,%ebx
+  8044c4:	39 de                	cmp    %ebx,%esi
+  8044c6:	74 54                	je     80451c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8044c8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8044cf:	f6 c1 05             	test   $0x5,%cl
+  8044d2:	74 ed                	je     8044c1 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8044d4:	f6 c5 04             	test   $0x4,%ch
+  8044d7:	75 ad                	jne    804486 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8044d9:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8044df:	74 bf                	je     8044a0 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8044e1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8044e7:	74 d8                	je     8044c1 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8044e9:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8044ef:	89 da                	mov    %ebx,%edx
+  8044f1:	89 f8                	mov    %edi,%eax
+  8044f3:	e8 cd fc ff ff       	call   8041c5 <duppage_cow>
+  8044f8:	85 c0                	test   %eax,%eax
+  8044fa:	79 c5                	jns    8044c1 <fork+0xe2>
+  8044fc:	89 c7                	mov    %eax,%edi
+  8044fe:	e9 cf 00 00 00       	jmp    8045d2 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804503:	68 f0 53 80 00       	push   $0x8053f0
+  804508:	68 fd 51 80 00       	push   $0x8051fd
+  80450d:	68 c6 00 00 00       	push   $0xc6
+  804512:	68 9a 54 80 00       	push   $0x80549a
+  804517:	e8 68 c1 ff ff       	call   800684 <_panic>
+  80451c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80451f:	83 c1 01             	add    $0x1,%ecx
+  804522:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804528:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80452e:	74 18                	je     804548 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804530:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804537:	a8 07                	test   $0x7,%al
+  804539:	74 e4                	je     80451f <fork+0x140>
+  80453b:	89 cb                	mov    %ecx,%ebx
+  80453d:	c1 e3 0a             	shl    $0xa,%ebx
+  804540:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804543:	e9 7c ff ff ff       	jmp    8044c4 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804548:	83 ec 04             	sub    $0x4,%esp
+  80454b:	6a 07                	push   $0x7
+  80454d:	68 00 f0 bf ee       	push   $0xeebff000
+  804552:	ff 75 e4             	push   -0x1c(%ebp)
+  804555:	e8 27 cc ff ff       	call   801181 <sys_page_alloc>
+  80455a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80455c:	83 c4 10             	add    $0x10,%esp
+  80455f:	85 c0                	test   %eax,%eax
+  804561:	78 34                	js     804597 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804563:	83 ec 08             	sub    $0x8,%esp
+  804566:	68 61 16 80 00       	push   $0x801661
+  80456b:	ff 75 e4             	push   -0x1c(%ebp)
+  80456e:	e8 8b cd ff ff       	call   8012fe <sys_env_set_pgfault_upcall>
+  804573:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804575:	83 c4 10             	add    $0x10,%esp
+  804578:	85 c0                	test   %eax,%eax
+  80457a:	78 2e                	js     8045aa <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80457c:	83 ec 08             	sub    $0x8,%esp
+  80457f:	6a 02                	push   $0x2
+  804581:	ff 75 e4             	push   -0x1c(%ebp)
+  804584:	e8 dd cc ff ff       	call   801266 <sys_env_set_status>
+  804589:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80458b:	83 c4 10             	add    $0x10,%esp
+  80458e:	85 c0                	test   %eax,%eax
+  804590:	78 2b                	js     8045bd <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804592:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804595:	eb 3b                	jmp    8045d2 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804597:	83 ec 08             	sub    $0x8,%esp
+  80459a:	50                   	push   %eax
+  80459b:	68 18 54 80 00       	push   $0x805418
+  8045a0:	e8 ba c1 ff ff       	call   80075f <cprintf>
+		return r;
+  8045a5:	83 c4 10             	add    $0x10,%esp
+  8045a8:	eb 28                	jmp    8045d2 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8045aa:	83 ec 08             	sub    $0x8,%esp
+  8045ad:	50                   	push   %eax
+  8045ae:	68 40 54 80 00       	push   $0x805440
+  8045b3:	e8 a7 c1 ff ff       	call   80075f <cprintf>
+		return r;
+  8045b8:	83 c4 10             	add    $0x10,%esp
+  8045bb:	eb 15                	jmp    8045d2 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8045bd:	83 ec 08             	sub    $0x8,%esp
+  8045c0:	50                   	push   %eax
+  8045c1:	68 b5 54 80 00       	push   $0x8054b5
+  8045c6:	e8 94 c1 ff ff       	call   80075f <cprintf>
+		return r;
+  8045cb:	83 c4 10             	add    $0x10,%esp
+  8045ce:	eb 02                	jmp    8045d2 <fork+0x1f3>
+  8045d0:	89 c7                	mov    %eax,%edi
+}
+  8045d2:	89 f8                	mov    %edi,%eax
+  8045d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045d7:	5b                   	pop    %ebx
+  8045d8:	5e                   	pop    %esi
+  8045d9:	5f                   	pop    %edi
+  8045da:	5d                   	pop    %ebp
+  8045db:	c3                   	ret
+
+008045dc <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8045dc:	55                   	push   %ebp
+  8045dd:	89 e5                	mov    %esp,%ebp
+  8045df:	57                   	push   %edi
+  8045e0:	56                   	push   %esi
+  8045e1:	53                   	push   %ebx
+  8045e2:	83 ec 2c             	sub    $0x2c,%esp
+  8045e5:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045e7:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8045ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045f2:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8045f8:	77 0a                	ja     804604 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045fa:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8045ff:	29 c3                	sub    %eax,%ebx
+  804601:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804604:	83 ec 0c             	sub    $0xc,%esp
+  804607:	68 42 43 80 00       	push   $0x804342
+  80460c:	e8 12 d0 ff ff       	call   801623 <set_pgfault_handler>
+  804611:	b8 07 00 00 00       	mov    $0x7,%eax
+  804616:	cd 30                	int    $0x30
+  804618:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80461b:	83 c4 10             	add    $0x10,%esp
+  80461e:	85 c0                	test   %eax,%eax
+  804620:	78 30                	js     804652 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804622:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804626:	74 42                	je     80466a <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804628:	c1 e3 10             	shl    $0x10,%ebx
+  80462b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804630:	29 d8                	sub    %ebx,%eax
+  804632:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804635:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80463a:	29 d8                	sub    %ebx,%eax
+  80463c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80463f:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804644:	ba 00 00 00 00       	mov    $0x0,%edx
+  804649:	89 f7                	mov    %esi,%edi
+  80464b:	89 d6                	mov    %edx,%esi
+  80464d:	e9 2c 01 00 00       	jmp    80477e <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804652:	83 ec 08             	sub    $0x8,%esp
+  804655:	89 c7                	mov    %eax,%edi
+  804657:	50                   	push   %eax
+  804658:	68 a5 54 80 00       	push   $0x8054a5
+  80465d:	e8 fd c0 ff ff       	call   80075f <cprintf>
+		return eid;
+  804662:	83 c4 10             	add    $0x10,%esp
+  804665:	e9 d5 00 00 00       	jmp    80473f <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80466a:	e8 ba ca ff ff       	call   801129 <sys_getenvid>
+  80466f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804674:	89 c2                	mov    %eax,%edx
+  804676:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804678:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80467e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804683:	77 18                	ja     80469d <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804685:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80468a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80468c:	c1 e8 10             	shr    $0x10,%eax
+  80468f:	74 0c                	je     80469d <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804691:	c1 e0 10             	shl    $0x10,%eax
+  804694:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804699:	29 c1                	sub    %eax,%ecx
+  80469b:	eb 06                	jmp    8046a3 <sfork+0xc7>
+		return pthread_main_tls;
+  80469d:	8b 0d 60 73 80 00    	mov    0x807360,%ecx
+  8046a3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8046a6:	c1 e0 04             	shl    $0x4,%eax
+  8046a9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046ae:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8046b0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8046b3:	e9 87 00 00 00       	jmp    80473f <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8046b8:	f6 c5 04             	test   $0x4,%ch
+  8046bb:	74 6c                	je     804729 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8046bd:	89 ca                	mov    %ecx,%edx
+  8046bf:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8046c5:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8046cb:	74 7c                	je     804749 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8046cd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8046d3:	89 da                	mov    %ebx,%edx
+  8046d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8046d8:	e8 67 fb ff ff       	call   804244 <duppage>
+  8046dd:	85 c0                	test   %eax,%eax
+  8046df:	0f 88 4f 01 00 00    	js     804834 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8046e5:	83 c3 01             	add    $0x1,%ebx
+  8046e8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8046eb:	74 7a                	je     804767 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8046ed:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8046ef:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8046f6:	f6 c1 01             	test   $0x1,%cl
+  8046f9:	74 ea                	je     8046e5 <sfork+0x109>
+  8046fb:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804701:	74 e2                	je     8046e5 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804703:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804709:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80470c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804711:	76 a5                	jbe    8046b8 <sfork+0xdc>
+  804713:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804719:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80471c:	39 fa                	cmp    %edi,%edx
+  80471e:	73 9d                	jae    8046bd <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804720:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804723:	39 fa                	cmp    %edi,%edx
+  804725:	72 96                	jb     8046bd <sfork+0xe1>
+  804727:	eb 8f                	jmp    8046b8 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804729:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80472f:	89 da                	mov    %ebx,%edx
+  804731:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804734:	e8 8c fa ff ff       	call   8041c5 <duppage_cow>
+  804739:	85 c0                	test   %eax,%eax
+  80473b:	79 a8                	jns    8046e5 <sfork+0x109>
+  80473d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80473f:	89 f8                	mov    %edi,%eax
+  804741:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804744:	5b                   	pop    %ebx
+  804745:	5e                   	pop    %esi
+  804746:	5f                   	pop    %edi
+  804747:	5d                   	pop    %ebp
+  804748:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804749:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80474e:	e8 2e fb ff ff       	call   804281 <cow_copy>
+  804753:	85 c0                	test   %eax,%eax
+  804755:	0f 88 d2 00 00 00    	js     80482d <sfork+0x251>
+				pte = uvpt[pn];
+  80475b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804762:	e9 66 ff ff ff       	jmp    8046cd <sfork+0xf1>
+  804767:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80476a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80476d:	83 c6 01             	add    $0x1,%esi
+  804770:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804776:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80477c:	74 1b                	je     804799 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80477e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804785:	a8 01                	test   $0x1,%al
+  804787:	74 e4                	je     80476d <sfork+0x191>
+  804789:	89 f3                	mov    %esi,%ebx
+  80478b:	c1 e3 0a             	shl    $0xa,%ebx
+  80478e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804791:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804794:	e9 4f ff ff ff       	jmp    8046e8 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804799:	83 ec 04             	sub    $0x4,%esp
+  80479c:	6a 07                	push   $0x7
+  80479e:	68 00 f0 bf ee       	push   $0xeebff000
+  8047a3:	ff 75 e0             	push   -0x20(%ebp)
+  8047a6:	e8 d6 c9 ff ff       	call   801181 <sys_page_alloc>
+  8047ab:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047ad:	83 c4 10             	add    $0x10,%esp
+  8047b0:	85 c0                	test   %eax,%eax
+  8047b2:	78 37                	js     8047eb <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8047b4:	83 ec 08             	sub    $0x8,%esp
+  8047b7:	68 61 16 80 00       	push   $0x801661
+  8047bc:	ff 75 e0             	push   -0x20(%ebp)
+  8047bf:	e8 3a cb ff ff       	call   8012fe <sys_env_set_pgfault_upcall>
+  8047c4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047c6:	83 c4 10             	add    $0x10,%esp
+  8047c9:	85 c0                	test   %eax,%eax
+  8047cb:	78 34                	js     804801 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8047cd:	83 ec 08             	sub    $0x8,%esp
+  8047d0:	6a 02                	push   $0x2
+  8047d2:	ff 75 e0             	push   -0x20(%ebp)
+  8047d5:	e8 8c ca ff ff       	call   801266 <sys_env_set_status>
+  8047da:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047dc:	83 c4 10             	add    $0x10,%esp
+  8047df:	85 c0                	test   %eax,%eax
+  8047e1:	78 34                	js     804817 <sfork+0x23b>
+	return eid;
+  8047e3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8047e6:	e9 54 ff ff ff       	jmp    80473f <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8047eb:	83 ec 08             	sub    $0x8,%esp
+  8047ee:	50                   	push   %eax
+  8047ef:	68 18 54 80 00       	push   $0x805418
+  8047f4:	e8 66 bf ff ff       	call   80075f <cprintf>
+		return r;
+  8047f9:	83 c4 10             	add    $0x10,%esp
+  8047fc:	e9 3e ff ff ff       	jmp    80473f <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804801:	83 ec 08             	sub    $0x8,%esp
+  804804:	50                   	push   %eax
+  804805:	68 40 54 80 00       	push   $0x805440
+  80480a:	e8 50 bf ff ff       	call   80075f <cprintf>
+		return r;
+  80480f:	83 c4 10             	add    $0x10,%esp
+  804812:	e9 28 ff ff ff       	jmp    80473f <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804817:	83 ec 08             	sub    $0x8,%esp
+  80481a:	50                   	push   %eax
+  80481b:	68 b5 54 80 00       	push   $0x8054b5
+  804820:	e8 3a bf ff ff       	call   80075f <cprintf>
+		return r;
+  804825:	83 c4 10             	add    $0x10,%esp
+  804828:	e9 12 ff ff ff       	jmp    80473f <sfork+0x163>
+  80482d:	89 c7                	mov    %eax,%edi
+  80482f:	e9 0b ff ff ff       	jmp    80473f <sfork+0x163>
+  804834:	89 c7                	mov    %eax,%edi
+  804836:	e9 04 ff ff ff       	jmp    80473f <sfork+0x163>
+
+0080483b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80483b:	55                   	push   %ebp
+  80483c:	89 e5                	mov    %esp,%ebp
+  80483e:	57                   	push   %edi
+  80483f:	56                   	push   %esi
+  804840:	53                   	push   %ebx
+  804841:	83 ec 18             	sub    $0x18,%esp
+  804844:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804847:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80484a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80484d:	85 c0                	test   %eax,%eax
+  80484f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804854:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804857:	50                   	push   %eax
+  804858:	e8 1a cb ff ff       	call   801377 <sys_ipc_recv>
+	if (r < 0) {
+  80485d:	83 c4 10             	add    $0x10,%esp
+  804860:	85 c0                	test   %eax,%eax
+  804862:	78 2b                	js     80488f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804864:	85 ff                	test   %edi,%edi
+  804866:	74 55                	je     8048bd <ipc_recv+0x82>
+  804868:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80486a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804870:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804875:	77 39                	ja     8048b0 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804877:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80487c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80487e:	c1 e8 10             	shr    $0x10,%eax
+  804881:	74 2d                	je     8048b0 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804883:	c1 e0 10             	shl    $0x10,%eax
+  804886:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80488b:	29 c2                	sub    %eax,%edx
+  80488d:	eb 27                	jmp    8048b6 <ipc_recv+0x7b>
+  80488f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804891:	83 ec 08             	sub    $0x8,%esp
+  804894:	50                   	push   %eax
+  804895:	68 d3 54 80 00       	push   $0x8054d3
+  80489a:	e8 c0 be ff ff       	call   80075f <cprintf>
+		*from_env_store = 0;
+  80489f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8048a5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8048ab:	83 c4 10             	add    $0x10,%esp
+  8048ae:	eb 77                	jmp    804927 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8048b0:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8048b6:	8b 02                	mov    (%edx),%eax
+  8048b8:	8b 40 78             	mov    0x78(%eax),%eax
+  8048bb:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8048bd:	85 f6                	test   %esi,%esi
+  8048bf:	74 34                	je     8048f5 <ipc_recv+0xba>
+  8048c1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048c3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8048c9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048ce:	77 18                	ja     8048e8 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8048d0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8048d5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8048d7:	c1 e8 10             	shr    $0x10,%eax
+  8048da:	74 0c                	je     8048e8 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8048dc:	c1 e0 10             	shl    $0x10,%eax
+  8048df:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8048e4:	29 c2                	sub    %eax,%edx
+  8048e6:	eb 06                	jmp    8048ee <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8048e8:	8b 15 60 73 80 00    	mov    0x807360,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8048ee:	8b 02                	mov    (%edx),%eax
+  8048f0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8048f3:	89 06                	mov    %eax,(%esi)
+  8048f5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048f7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8048fd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804902:	77 18                	ja     80491c <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804904:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804909:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80490b:	c1 e8 10             	shr    $0x10,%eax
+  80490e:	74 0c                	je     80491c <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804910:	c1 e0 10             	shl    $0x10,%eax
+  804913:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804918:	29 c2                	sub    %eax,%edx
+  80491a:	eb 06                	jmp    804922 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80491c:	8b 15 60 73 80 00    	mov    0x807360,%edx
+	}
+	return thisenv->env_ipc_value;
+  804922:	8b 02                	mov    (%edx),%eax
+  804924:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804927:	89 d8                	mov    %ebx,%eax
+  804929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80492c:	5b                   	pop    %ebx
+  80492d:	5e                   	pop    %esi
+  80492e:	5f                   	pop    %edi
+  80492f:	5d                   	pop    %ebp
+  804930:	c3                   	ret
+
+00804931 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804931:	55                   	push   %ebp
+  804932:	89 e5                	mov    %esp,%ebp
+  804934:	57                   	push   %edi
+  804935:	56                   	push   %esi
+  804936:	53                   	push   %ebx
+  804937:	83 ec 0c             	sub    $0xc,%esp
+  80493a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80493d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804940:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804943:	85 db                	test   %ebx,%ebx
+  804945:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80494a:	0f 44 d8             	cmove  %eax,%ebx
+  80494d:	eb 05                	jmp    804954 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80494f:	e8 01 c8 ff ff       	call   801155 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804954:	57                   	push   %edi
+  804955:	53                   	push   %ebx
+  804956:	ff 75 0c             	push   0xc(%ebp)
+  804959:	56                   	push   %esi
+  80495a:	e8 eb c9 ff ff       	call   80134a <sys_ipc_try_send>
+		if (r == 0) {
+  80495f:	83 c4 10             	add    $0x10,%esp
+  804962:	85 c0                	test   %eax,%eax
+  804964:	74 19                	je     80497f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804966:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804969:	74 e4                	je     80494f <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80496b:	83 ec 0c             	sub    $0xc,%esp
+  80496e:	50                   	push   %eax
+  80496f:	57                   	push   %edi
+  804970:	53                   	push   %ebx
+  804971:	56                   	push   %esi
+  804972:	68 ec 54 80 00       	push   $0x8054ec
+  804977:	e8 e3 bd ff ff       	call   80075f <cprintf>
+			return;
+  80497c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80497f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804982:	5b                   	pop    %ebx
+  804983:	5e                   	pop    %esi
+  804984:	5f                   	pop    %edi
+  804985:	5d                   	pop    %ebp
+  804986:	c3                   	ret
+
+00804987 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804987:	55                   	push   %ebp
+  804988:	89 e5                	mov    %esp,%ebp
+  80498a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80498d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804992:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804995:	c1 e0 04             	shl    $0x4,%eax
+  804998:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80499d:	8b 40 50             	mov    0x50(%eax),%eax
+  8049a0:	39 c8                	cmp    %ecx,%eax
+  8049a2:	74 12                	je     8049b6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8049a4:	83 c2 01             	add    $0x1,%edx
+  8049a7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8049ad:	75 e3                	jne    804992 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8049af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b4:	eb 0e                	jmp    8049c4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8049b6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8049b9:	c1 e0 04             	shl    $0x4,%eax
+  8049bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8049c1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8049c4:	5d                   	pop    %ebp
+  8049c5:	c3                   	ret
+
+008049c6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8049c6:	55                   	push   %ebp
+  8049c7:	89 e5                	mov    %esp,%ebp
+  8049c9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8049cc:	89 c2                	mov    %eax,%edx
+  8049ce:	c1 ea 16             	shr    $0x16,%edx
+  8049d1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8049d8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8049dd:	f6 c1 01             	test   $0x1,%cl
+  8049e0:	74 1c                	je     8049fe <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8049e2:	c1 e8 0c             	shr    $0xc,%eax
+  8049e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8049ec:	a8 01                	test   $0x1,%al
+  8049ee:	74 0e                	je     8049fe <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8049f0:	c1 e8 0c             	shr    $0xc,%eax
+  8049f3:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8049fa:	ef 
+  8049fb:	0f b7 d2             	movzwl %dx,%edx
+}
+  8049fe:	89 d0                	mov    %edx,%eax
+  804a00:	5d                   	pop    %ebp
+  804a01:	c3                   	ret
+
+00804a02 <udm>:
+  804a02:	57                   	push   %edi
+  804a03:	56                   	push   %esi
+  804a04:	53                   	push   %ebx
+  804a05:	83 ec 20             	sub    $0x20,%esp
+  804a08:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804a0c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804a10:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804a14:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804a18:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a1c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a20:	89 d1                	mov    %edx,%ecx
+  804a22:	09 c1                	or     %eax,%ecx
+  804a24:	0f 84 91 00 00 00    	je     804abb <udm+0xb9>
+  804a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a34:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804a39:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804a40:	00 
+  804a41:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804a48:	00 
+  804a49:	eb 08                	jmp    804a53 <udm+0x51>
+  804a4b:	83 e9 01             	sub    $0x1,%ecx
+  804a4e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804a51:	74 7c                	je     804acf <udm+0xcd>
+  804a53:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804a57:	01 c0                	add    %eax,%eax
+  804a59:	89 c6                	mov    %eax,%esi
+  804a5b:	89 d7                	mov    %edx,%edi
+  804a5d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804a61:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804a65:	0f ad d0             	shrd   %cl,%edx,%eax
+  804a68:	d3 ea                	shr    %cl,%edx
+  804a6a:	f6 c1 20             	test   $0x20,%cl
+  804a6d:	74 04                	je     804a73 <udm+0x71>
+  804a6f:	89 d0                	mov    %edx,%eax
+  804a71:	31 d2                	xor    %edx,%edx
+  804a73:	83 e0 01             	and    $0x1,%eax
+  804a76:	89 04 24             	mov    %eax,(%esp)
+  804a79:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804a80:	00 
+  804a81:	8b 04 24             	mov    (%esp),%eax
+  804a84:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804a88:	09 f0                	or     %esi,%eax
+  804a8a:	09 fa                	or     %edi,%edx
+  804a8c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804a90:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804a94:	39 f0                	cmp    %esi,%eax
+  804a96:	89 d3                	mov    %edx,%ebx
+  804a98:	19 fb                	sbb    %edi,%ebx
+  804a9a:	72 af                	jb     804a4b <udm+0x49>
+  804a9c:	29 f0                	sub    %esi,%eax
+  804a9e:	19 fa                	sbb    %edi,%edx
+  804aa0:	89 cf                	mov    %ecx,%edi
+  804aa2:	c1 ef 05             	shr    $0x5,%edi
+  804aa5:	83 e7 01             	and    $0x1,%edi
+  804aa8:	89 fe                	mov    %edi,%esi
+  804aaa:	83 f6 01             	xor    $0x1,%esi
+  804aad:	d3 e6                	shl    %cl,%esi
+  804aaf:	d3 e7                	shl    %cl,%edi
+  804ab1:	09 74 24 18          	or     %esi,0x18(%esp)
+  804ab5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804ab9:	eb 90                	jmp    804a4b <udm+0x49>
+  804abb:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804abf:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804ac3:	89 f0                	mov    %esi,%eax
+  804ac5:	89 fa                	mov    %edi,%edx
+  804ac7:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804acb:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804acf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804ad3:	89 01                	mov    %eax,(%ecx)
+  804ad5:	89 51 04             	mov    %edx,0x4(%ecx)
+  804ad8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804adc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ae0:	83 c4 20             	add    $0x20,%esp
+  804ae3:	5b                   	pop    %ebx
+  804ae4:	5e                   	pop    %esi
+  804ae5:	5f                   	pop    %edi
+  804ae6:	c3                   	ret
+
+00804ae7 <__udivdi3>:
+  804ae7:	83 ec 18             	sub    $0x18,%esp
+  804aea:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804aee:	50                   	push   %eax
+  804aef:	ff 74 24 2c          	push   0x2c(%esp)
+  804af3:	ff 74 24 2c          	push   0x2c(%esp)
+  804af7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804afb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804aff:	e8 fe fe ff ff       	call   804a02 <udm>
+  804b04:	83 c4 24             	add    $0x24,%esp
+  804b07:	c3                   	ret
+
+00804b08 <__umoddi3>:
+  804b08:	83 ec 18             	sub    $0x18,%esp
+  804b0b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804b0f:	50                   	push   %eax
+  804b10:	ff 74 24 2c          	push   0x2c(%esp)
+  804b14:	ff 74 24 2c          	push   0x2c(%esp)
+  804b18:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b1c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b20:	e8 dd fe ff ff       	call   804a02 <udm>
+  804b25:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b29:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b2d:	83 c4 24             	add    $0x24,%esp
+  804b30:	c3                   	ret
+
+00804b31 <__divdi3>:
+  804b31:	56                   	push   %esi
+  804b32:	53                   	push   %ebx
+  804b33:	83 ec 14             	sub    $0x14,%esp
+  804b36:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804b3a:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804b3e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804b42:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804b46:	85 d2                	test   %edx,%edx
+  804b48:	78 18                	js     804b62 <__divdi3+0x31>
+  804b4a:	85 db                	test   %ebx,%ebx
+  804b4c:	78 3e                	js     804b8c <__divdi3+0x5b>
+  804b4e:	83 ec 04             	sub    $0x4,%esp
+  804b51:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b55:	56                   	push   %esi
+  804b56:	53                   	push   %ebx
+  804b57:	51                   	push   %ecx
+  804b58:	e8 a5 fe ff ff       	call   804a02 <udm>
+  804b5d:	83 c4 10             	add    $0x10,%esp
+  804b60:	eb 24                	jmp    804b86 <__divdi3+0x55>
+  804b62:	f7 d8                	neg    %eax
+  804b64:	83 d2 00             	adc    $0x0,%edx
+  804b67:	f7 da                	neg    %edx
+  804b69:	85 db                	test   %ebx,%ebx
+  804b6b:	78 3a                	js     804ba7 <__divdi3+0x76>
+  804b6d:	83 ec 04             	sub    $0x4,%esp
+  804b70:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b74:	56                   	push   %esi
+  804b75:	53                   	push   %ebx
+  804b76:	51                   	push   %ecx
+  804b77:	e8 86 fe ff ff       	call   804a02 <udm>
+  804b7c:	83 c4 10             	add    $0x10,%esp
+  804b7f:	f7 d8                	neg    %eax
+  804b81:	83 d2 00             	adc    $0x0,%edx
+  804b84:	f7 da                	neg    %edx
+  804b86:	83 c4 14             	add    $0x14,%esp
+  804b89:	5b                   	pop    %ebx
+  804b8a:	5e                   	pop    %esi
+  804b8b:	c3                   	ret
+  804b8c:	83 ec 04             	sub    $0x4,%esp
+  804b8f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b93:	56                   	push   %esi
+  804b94:	f7 d9                	neg    %ecx
+  804b96:	83 d3 00             	adc    $0x0,%ebx
+  804b99:	f7 db                	neg    %ebx
+  804b9b:	53                   	push   %ebx
+  804b9c:	51                   	push   %ecx
+  804b9d:	e8 60 fe ff ff       	call   804a02 <udm>
+  804ba2:	83 c4 10             	add    $0x10,%esp
+  804ba5:	eb d8                	jmp    804b7f <__divdi3+0x4e>
+  804ba7:	83 ec 04             	sub    $0x4,%esp
+  804baa:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804bae:	56                   	push   %esi
+  804baf:	f7 d9                	neg    %ecx
+  804bb1:	83 d3 00             	adc    $0x0,%ebx
+  804bb4:	f7 db                	neg    %ebx
+  804bb6:	53                   	push   %ebx
+  804bb7:	51                   	push   %ecx
+  804bb8:	e8 45 fe ff ff       	call   804a02 <udm>
+  804bbd:	83 c4 10             	add    $0x10,%esp
+  804bc0:	eb c4                	jmp    804b86 <__divdi3+0x55>
+
+00804bc2 <__moddi3>:
+  804bc2:	55                   	push   %ebp
+  804bc3:	57                   	push   %edi
+  804bc4:	56                   	push   %esi
+  804bc5:	53                   	push   %ebx
+  804bc6:	83 ec 24             	sub    $0x24,%esp
+  804bc9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804bcd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804bd1:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804bd5:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804bd9:	85 d2                	test   %edx,%edx
+  804bdb:	78 3b                	js     804c18 <__moddi3+0x56>
+  804bdd:	83 ec 04             	sub    $0x4,%esp
+  804be0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804be4:	56                   	push   %esi
+  804be5:	89 ce                	mov    %ecx,%esi
+  804be7:	f7 de                	neg    %esi
+  804be9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804bed:	89 de                	mov    %ebx,%esi
+  804bef:	83 d6 00             	adc    $0x0,%esi
+  804bf2:	f7 de                	neg    %esi
+  804bf4:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804bf8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804bfc:	0f 48 f1             	cmovs  %ecx,%esi
+  804bff:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804c04:	53                   	push   %ebx
+  804c05:	56                   	push   %esi
+  804c06:	e8 f7 fd ff ff       	call   804a02 <udm>
+  804c0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c0f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c13:	83 c4 10             	add    $0x10,%esp
+  804c16:	eb 47                	jmp    804c5f <__moddi3+0x9d>
+  804c18:	f7 d8                	neg    %eax
+  804c1a:	83 d2 00             	adc    $0x0,%edx
+  804c1d:	f7 da                	neg    %edx
+  804c1f:	83 ec 04             	sub    $0x4,%esp
+  804c22:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804c26:	56                   	push   %esi
+  804c27:	89 cf                	mov    %ecx,%edi
+  804c29:	f7 df                	neg    %edi
+  804c2b:	89 de                	mov    %ebx,%esi
+  804c2d:	83 d6 00             	adc    $0x0,%esi
+  804c30:	f7 de                	neg    %esi
+  804c32:	0f 49 cf             	cmovns %edi,%ecx
+  804c35:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804c39:	0f 49 de             	cmovns %esi,%ebx
+  804c3c:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804c40:	ff 74 24 0c          	push   0xc(%esp)
+  804c44:	ff 74 24 0c          	push   0xc(%esp)
+  804c48:	e8 b5 fd ff ff       	call   804a02 <udm>
+  804c4d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c51:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c55:	f7 d8                	neg    %eax
+  804c57:	83 d2 00             	adc    $0x0,%edx
+  804c5a:	f7 da                	neg    %edx
+  804c5c:	83 c4 10             	add    $0x10,%esp
+  804c5f:	83 c4 24             	add    $0x24,%esp
+  804c62:	5b                   	pop    %ebx
+  804c63:	5e                   	pop    %esi
+  804c64:	5f                   	pop    %edi
+  804c65:	5d                   	pop    %ebp
+  804c66:	c3                   	ret
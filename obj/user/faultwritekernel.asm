@@ -0,0 +1,9680 @@
+
+obj/user/faultwritekernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0xf0100000 = 0;
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	57                   	push   %edi
+  800042:	56                   	push   %esi
+  800043:	53                   	push   %ebx
+  800044:	83 ec 1c             	sub    $0x1c,%esp
+  800047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80004d:	e8 31 01 00 00       	call   800183 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800052:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800055:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  80005b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800060:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800062:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800064:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80006a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80006f:	77 16                	ja     800087 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800071:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800076:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800078:	c1 e8 10             	shr    $0x10,%eax
+  80007b:	74 0a                	je     800087 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80007d:	c1 e0 10             	shl    $0x10,%eax
+  800080:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800085:	29 c2                	sub    %eax,%edx
+  800087:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80008a:	c1 e0 04             	shl    $0x4,%eax
+  80008d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800092:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800094:	85 db                	test   %ebx,%ebx
+  800096:	7e 07                	jle    80009f <libmain+0x61>
+		binaryname = argv[0];
+  800098:	8b 06                	mov    (%esi),%eax
+  80009a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80009f:	83 ec 08             	sub    $0x8,%esp
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+  8000a4:	e8 8a ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a9:	e8 0b 00 00 00       	call   8000b9 <exit>
+}
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b4:	5b                   	pop    %ebx
+  8000b5:	5e                   	pop    %esi
+  8000b6:	5f                   	pop    %edi
+  8000b7:	5d                   	pop    %ebp
+  8000b8:	c3                   	ret
+
+008000b9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b9:	55                   	push   %ebp
+  8000ba:	89 e5                	mov    %esp,%ebp
+  8000bc:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 12 17 00 00       	call   8017d8 <fflush>
+	pthread_kill_others();
+  8000c6:	e8 7d 2d 00 00       	call   802e48 <pthread_kill_others>
+	close_all();
+  8000cb:	e8 ab 07 00 00       	call   80087b <close_all>
+	sys_env_destroy(0);
+  8000d0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000d7:	e8 5c 00 00 00       	call   800138 <sys_env_destroy>
+}
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	c9                   	leave
+  8000e0:	c3                   	ret
+
+008000e1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000e1:	55                   	push   %ebp
+  8000e2:	89 e5                	mov    %esp,%ebp
+  8000e4:	57                   	push   %edi
+  8000e5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f1:	89 c3                	mov    %eax,%ebx
+  8000f3:	89 c7                	mov    %eax,%edi
+  8000f5:	6a 00                	push   $0x0
+  8000f7:	55                   	push   %ebp
+  8000f8:	56                   	push   %esi
+  8000f9:	89 e5                	mov    %esp,%ebp
+  8000fb:	8d 35 03 01 80 00    	lea    0x800103,%esi
+  800101:	0f 34                	sysenter
+
+00800103 <after_sysenter_label_47>:
+  800103:	5e                   	pop    %esi
+  800104:	5d                   	pop    %ebp
+  800105:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800108:	5b                   	pop    %ebx
+  800109:	5f                   	pop    %edi
+  80010a:	5d                   	pop    %ebp
+  80010b:	c3                   	ret
+
+0080010c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80010c:	55                   	push   %ebp
+  80010d:	89 e5                	mov    %esp,%ebp
+  80010f:	57                   	push   %edi
+  800110:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800111:	ba 00 00 00 00       	mov    $0x0,%edx
+  800116:	b8 01 00 00 00       	mov    $0x1,%eax
+  80011b:	89 d1                	mov    %edx,%ecx
+  80011d:	89 d3                	mov    %edx,%ebx
+  80011f:	89 d7                	mov    %edx,%edi
+  800121:	6a 00                	push   $0x0
+  800123:	55                   	push   %ebp
+  800124:	56                   	push   %esi
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	8d 35 2f 01 80 00    	lea    0x80012f,%esi
+  80012d:	0f 34                	sysenter
+
+0080012f <after_sysenter_label_128>:
+  80012f:	5e                   	pop    %esi
+  800130:	5d                   	pop    %ebp
+  800131:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800134:	5b                   	pop    %ebx
+  800135:	5f                   	pop    %edi
+  800136:	5d                   	pop    %ebp
+  800137:	c3                   	ret
+
+00800138 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800138:	55                   	push   %ebp
+  800139:	89 e5                	mov    %esp,%ebp
+  80013b:	57                   	push   %edi
+  80013c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80013d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800140:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800145:	b8 03 00 00 00       	mov    $0x3,%eax
+  80014a:	89 cb                	mov    %ecx,%ebx
+  80014c:	89 cf                	mov    %ecx,%edi
+  80014e:	6a 00                	push   $0x0
+  800150:	55                   	push   %ebp
+  800151:	56                   	push   %esi
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	8d 35 5c 01 80 00    	lea    0x80015c,%esi
+  80015a:	0f 34                	sysenter
+
+0080015c <after_sysenter_label_212>:
+  80015c:	5e                   	pop    %esi
+  80015d:	5d                   	pop    %ebp
+  80015e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800161:	85 c0                	test   %eax,%eax
+  800163:	7f 07                	jg     80016c <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800165:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800168:	5b                   	pop    %ebx
+  800169:	5f                   	pop    %edi
+  80016a:	5d                   	pop    %ebp
+  80016b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  80016f:	50                   	push   %eax
+  800170:	6a 03                	push   $0x3
+  800172:	68 ea 46 80 00       	push   $0x8046ea
+  800177:	6a 54                	push   $0x54
+  800179:	68 07 47 80 00       	push   $0x804707
+  80017e:	e8 38 30 00 00       	call   8031bb <_panic>
+
+00800183 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800183:	55                   	push   %ebp
+  800184:	89 e5                	mov    %esp,%ebp
+  800186:	57                   	push   %edi
+  800187:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800192:	89 d1                	mov    %edx,%ecx
+  800194:	89 d3                	mov    %edx,%ebx
+  800196:	89 d7                	mov    %edx,%edi
+  800198:	6a 00                	push   $0x0
+  80019a:	55                   	push   %ebp
+  80019b:	56                   	push   %esi
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	8d 35 a6 01 80 00    	lea    0x8001a6,%esi
+  8001a4:	0f 34                	sysenter
+
+008001a6 <after_sysenter_label_309>:
+  8001a6:	5e                   	pop    %esi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001ab:	5b                   	pop    %ebx
+  8001ac:	5f                   	pop    %edi
+  8001ad:	5d                   	pop    %ebp
+  8001ae:	c3                   	ret
+
+008001af <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	57                   	push   %edi
+  8001b3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001be:	89 d1                	mov    %edx,%ecx
+  8001c0:	89 d3                	mov    %edx,%ebx
+  8001c2:	89 d7                	mov    %edx,%edi
+  8001c4:	6a 00                	push   $0x0
+  8001c6:	55                   	push   %ebp
+  8001c7:	56                   	push   %esi
+  8001c8:	89 e5                	mov    %esp,%ebp
+  8001ca:	8d 35 d2 01 80 00    	lea    0x8001d2,%esi
+  8001d0:	0f 34                	sysenter
+
+008001d2 <after_sysenter_label_391>:
+  8001d2:	5e                   	pop    %esi
+  8001d3:	5d                   	pop    %ebp
+  8001d4:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001d7:	5b                   	pop    %ebx
+  8001d8:	5f                   	pop    %edi
+  8001d9:	5d                   	pop    %ebp
+  8001da:	c3                   	ret
+
+008001db <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	57                   	push   %edi
+  8001df:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f3:	6a 00                	push   $0x0
+  8001f5:	55                   	push   %ebp
+  8001f6:	56                   	push   %esi
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	8d 35 01 02 80 00    	lea    0x800201,%esi
+  8001ff:	0f 34                	sysenter
+
+00800201 <after_sysenter_label_479>:
+  800201:	5e                   	pop    %esi
+  800202:	5d                   	pop    %ebp
+  800203:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800206:	85 c0                	test   %eax,%eax
+  800208:	7f 07                	jg     800211 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80020a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020d:	5b                   	pop    %ebx
+  80020e:	5f                   	pop    %edi
+  80020f:	5d                   	pop    %ebp
+  800210:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800211:	83 ec 0c             	sub    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	6a 04                	push   $0x4
+  800217:	68 ea 46 80 00       	push   $0x8046ea
+  80021c:	6a 54                	push   $0x54
+  80021e:	68 07 47 80 00       	push   $0x804707
+  800223:	e8 93 2f 00 00       	call   8031bb <_panic>
+
+00800228 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	57                   	push   %edi
+  80022c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80022d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800230:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800233:	b8 05 00 00 00       	mov    $0x5,%eax
+  800238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80023b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80023e:	ff 75 18             	push   0x18(%ebp)
+  800241:	55                   	push   %ebp
+  800242:	56                   	push   %esi
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	8d 35 4d 02 80 00    	lea    0x80024d,%esi
+  80024b:	0f 34                	sysenter
+
+0080024d <after_sysenter_label_593>:
+  80024d:	5e                   	pop    %esi
+  80024e:	5d                   	pop    %ebp
+  80024f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800252:	85 c0                	test   %eax,%eax
+  800254:	7f 07                	jg     80025d <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800256:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800259:	5b                   	pop    %ebx
+  80025a:	5f                   	pop    %edi
+  80025b:	5d                   	pop    %ebp
+  80025c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80025d:	83 ec 0c             	sub    $0xc,%esp
+  800260:	50                   	push   %eax
+  800261:	6a 05                	push   $0x5
+  800263:	68 ea 46 80 00       	push   $0x8046ea
+  800268:	6a 54                	push   $0x54
+  80026a:	68 07 47 80 00       	push   $0x804707
+  80026f:	e8 47 2f 00 00       	call   8031bb <_panic>
+
+00800274 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	57                   	push   %edi
+  800278:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800279:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800281:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800284:	b8 06 00 00 00       	mov    $0x6,%eax
+  800289:	89 df                	mov    %ebx,%edi
+  80028b:	6a 00                	push   $0x0
+  80028d:	55                   	push   %ebp
+  80028e:	56                   	push   %esi
+  80028f:	89 e5                	mov    %esp,%ebp
+  800291:	8d 35 99 02 80 00    	lea    0x800299,%esi
+  800297:	0f 34                	sysenter
+
+00800299 <after_sysenter_label_704>:
+  800299:	5e                   	pop    %esi
+  80029a:	5d                   	pop    %ebp
+  80029b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80029e:	85 c0                	test   %eax,%eax
+  8002a0:	7f 07                	jg     8002a9 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a5:	5b                   	pop    %ebx
+  8002a6:	5f                   	pop    %edi
+  8002a7:	5d                   	pop    %ebp
+  8002a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a9:	83 ec 0c             	sub    $0xc,%esp
+  8002ac:	50                   	push   %eax
+  8002ad:	6a 06                	push   $0x6
+  8002af:	68 ea 46 80 00       	push   $0x8046ea
+  8002b4:	6a 54                	push   $0x54
+  8002b6:	68 07 47 80 00       	push   $0x804707
+  8002bb:	e8 fb 2e 00 00       	call   8031bb <_panic>
+
+008002c0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	57                   	push   %edi
+  8002c4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002d5:	89 df                	mov    %ebx,%edi
+  8002d7:	6a 00                	push   $0x0
+  8002d9:	55                   	push   %ebp
+  8002da:	56                   	push   %esi
+  8002db:	89 e5                	mov    %esp,%ebp
+  8002dd:	8d 35 e5 02 80 00    	lea    0x8002e5,%esi
+  8002e3:	0f 34                	sysenter
+
+008002e5 <after_sysenter_label_808>:
+  8002e5:	5e                   	pop    %esi
+  8002e6:	5d                   	pop    %ebp
+  8002e7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002ea:	85 c0                	test   %eax,%eax
+  8002ec:	7f 07                	jg     8002f5 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002f1:	5b                   	pop    %ebx
+  8002f2:	5f                   	pop    %edi
+  8002f3:	5d                   	pop    %ebp
+  8002f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002f5:	83 ec 0c             	sub    $0xc,%esp
+  8002f8:	50                   	push   %eax
+  8002f9:	6a 08                	push   $0x8
+  8002fb:	68 ea 46 80 00       	push   $0x8046ea
+  800300:	6a 54                	push   $0x54
+  800302:	68 07 47 80 00       	push   $0x804707
+  800307:	e8 af 2e 00 00       	call   8031bb <_panic>
+
+0080030c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	57                   	push   %edi
+  800310:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800316:	8b 55 08             	mov    0x8(%ebp),%edx
+  800319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800321:	89 df                	mov    %ebx,%edi
+  800323:	6a 00                	push   $0x0
+  800325:	55                   	push   %ebp
+  800326:	56                   	push   %esi
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	8d 35 31 03 80 00    	lea    0x800331,%esi
+  80032f:	0f 34                	sysenter
+
+00800331 <after_sysenter_label_912>:
+  800331:	5e                   	pop    %esi
+  800332:	5d                   	pop    %ebp
+  800333:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800336:	85 c0                	test   %eax,%eax
+  800338:	7f 07                	jg     800341 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80033a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80033d:	5b                   	pop    %ebx
+  80033e:	5f                   	pop    %edi
+  80033f:	5d                   	pop    %ebp
+  800340:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800341:	83 ec 0c             	sub    $0xc,%esp
+  800344:	50                   	push   %eax
+  800345:	6a 09                	push   $0x9
+  800347:	68 ea 46 80 00       	push   $0x8046ea
+  80034c:	6a 54                	push   $0x54
+  80034e:	68 07 47 80 00       	push   $0x804707
+  800353:	e8 63 2e 00 00       	call   8031bb <_panic>
+
+00800358 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800358:	55                   	push   %ebp
+  800359:	89 e5                	mov    %esp,%ebp
+  80035b:	57                   	push   %edi
+  80035c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80035d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800362:	8b 55 08             	mov    0x8(%ebp),%edx
+  800365:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800368:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80036d:	89 df                	mov    %ebx,%edi
+  80036f:	6a 00                	push   $0x0
+  800371:	55                   	push   %ebp
+  800372:	56                   	push   %esi
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	8d 35 7d 03 80 00    	lea    0x80037d,%esi
+  80037b:	0f 34                	sysenter
+
+0080037d <after_sysenter_label_1016>:
+  80037d:	5e                   	pop    %esi
+  80037e:	5d                   	pop    %ebp
+  80037f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800382:	85 c0                	test   %eax,%eax
+  800384:	7f 07                	jg     80038d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800386:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800389:	5b                   	pop    %ebx
+  80038a:	5f                   	pop    %edi
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80038d:	83 ec 0c             	sub    $0xc,%esp
+  800390:	50                   	push   %eax
+  800391:	6a 0a                	push   $0xa
+  800393:	68 ea 46 80 00       	push   $0x8046ea
+  800398:	6a 54                	push   $0x54
+  80039a:	68 07 47 80 00       	push   $0x804707
+  80039f:	e8 17 2e 00 00       	call   8031bb <_panic>
+
+008003a4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	57                   	push   %edi
+  8003a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003af:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003ba:	6a 00                	push   $0x0
+  8003bc:	55                   	push   %ebp
+  8003bd:	56                   	push   %esi
+  8003be:	89 e5                	mov    %esp,%ebp
+  8003c0:	8d 35 c8 03 80 00    	lea    0x8003c8,%esi
+  8003c6:	0f 34                	sysenter
+
+008003c8 <after_sysenter_label_1126>:
+  8003c8:	5e                   	pop    %esi
+  8003c9:	5d                   	pop    %ebp
+  8003ca:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003cd:	5b                   	pop    %ebx
+  8003ce:	5f                   	pop    %edi
+  8003cf:	5d                   	pop    %ebp
+  8003d0:	c3                   	ret
+
+008003d1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003d1:	55                   	push   %ebp
+  8003d2:	89 e5                	mov    %esp,%ebp
+  8003d4:	57                   	push   %edi
+  8003d5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003de:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003e3:	89 cb                	mov    %ecx,%ebx
+  8003e5:	89 cf                	mov    %ecx,%edi
+  8003e7:	6a 00                	push   $0x0
+  8003e9:	55                   	push   %ebp
+  8003ea:	56                   	push   %esi
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	8d 35 f5 03 80 00    	lea    0x8003f5,%esi
+  8003f3:	0f 34                	sysenter
+
+008003f5 <after_sysenter_label_1210>:
+  8003f5:	5e                   	pop    %esi
+  8003f6:	5d                   	pop    %ebp
+  8003f7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8003fa:	85 c0                	test   %eax,%eax
+  8003fc:	7f 07                	jg     800405 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8003fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800401:	5b                   	pop    %ebx
+  800402:	5f                   	pop    %edi
+  800403:	5d                   	pop    %ebp
+  800404:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800405:	83 ec 0c             	sub    $0xc,%esp
+  800408:	50                   	push   %eax
+  800409:	6a 0d                	push   $0xd
+  80040b:	68 ea 46 80 00       	push   $0x8046ea
+  800410:	6a 54                	push   $0x54
+  800412:	68 07 47 80 00       	push   $0x804707
+  800417:	e8 9f 2d 00 00       	call   8031bb <_panic>
+
+0080041c <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	57                   	push   %edi
+  800420:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800421:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800426:	8b 55 08             	mov    0x8(%ebp),%edx
+  800429:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042c:	b8 42 00 00 00       	mov    $0x42,%eax
+  800431:	89 df                	mov    %ebx,%edi
+  800433:	6a 00                	push   $0x0
+  800435:	55                   	push   %ebp
+  800436:	56                   	push   %esi
+  800437:	89 e5                	mov    %esp,%ebp
+  800439:	8d 35 41 04 80 00    	lea    0x800441,%esi
+  80043f:	0f 34                	sysenter
+
+00800441 <after_sysenter_label_1311>:
+  800441:	5e                   	pop    %esi
+  800442:	5d                   	pop    %ebp
+  800443:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800446:	85 c0                	test   %eax,%eax
+  800448:	7f 07                	jg     800451 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80044a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80044d:	5b                   	pop    %ebx
+  80044e:	5f                   	pop    %edi
+  80044f:	5d                   	pop    %ebp
+  800450:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800451:	83 ec 0c             	sub    $0xc,%esp
+  800454:	50                   	push   %eax
+  800455:	6a 42                	push   $0x42
+  800457:	68 ea 46 80 00       	push   $0x8046ea
+  80045c:	6a 54                	push   $0x54
+  80045e:	68 07 47 80 00       	push   $0x804707
+  800463:	e8 53 2d 00 00       	call   8031bb <_panic>
+
+00800468 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800468:	55                   	push   %ebp
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	57                   	push   %edi
+  80046c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80046d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800472:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800477:	89 d1                	mov    %edx,%ecx
+  800479:	89 d3                	mov    %edx,%ebx
+  80047b:	89 d7                	mov    %edx,%edi
+  80047d:	6a 00                	push   $0x0
+  80047f:	55                   	push   %ebp
+  800480:	56                   	push   %esi
+  800481:	89 e5                	mov    %esp,%ebp
+  800483:	8d 35 8b 04 80 00    	lea    0x80048b,%esi
+  800489:	0f 34                	sysenter
+
+0080048b <after_sysenter_label_1411>:
+  80048b:	5e                   	pop    %esi
+  80048c:	5d                   	pop    %ebp
+  80048d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800490:	5b                   	pop    %ebx
+  800491:	5f                   	pop    %edi
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	57                   	push   %edi
+  800498:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004a9:	89 df                	mov    %ebx,%edi
+  8004ab:	6a 00                	push   $0x0
+  8004ad:	55                   	push   %ebp
+  8004ae:	56                   	push   %esi
+  8004af:	89 e5                	mov    %esp,%ebp
+  8004b1:	8d 35 b9 04 80 00    	lea    0x8004b9,%esi
+  8004b7:	0f 34                	sysenter
+
+008004b9 <after_sysenter_label_1497>:
+  8004b9:	5e                   	pop    %esi
+  8004ba:	5d                   	pop    %ebp
+  8004bb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004be:	5b                   	pop    %ebx
+  8004bf:	5f                   	pop    %edi
+  8004c0:	5d                   	pop    %ebp
+  8004c1:	c3                   	ret
+
+008004c2 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	57                   	push   %edi
+  8004c6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004d7:	89 df                	mov    %ebx,%edi
+  8004d9:	6a 00                	push   $0x0
+  8004db:	55                   	push   %ebp
+  8004dc:	56                   	push   %esi
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	8d 35 e7 04 80 00    	lea    0x8004e7,%esi
+  8004e5:	0f 34                	sysenter
+
+008004e7 <after_sysenter_label_1583>:
+  8004e7:	5e                   	pop    %esi
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004ec:	5b                   	pop    %ebx
+  8004ed:	5f                   	pop    %edi
+  8004ee:	5d                   	pop    %ebp
+  8004ef:	c3                   	ret
+
+008004f0 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004f0:	55                   	push   %ebp
+  8004f1:	89 e5                	mov    %esp,%ebp
+  8004f3:	57                   	push   %edi
+  8004f4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fb:	b8 11 00 00 00       	mov    $0x11,%eax
+  800500:	bf 00 00 00 00       	mov    $0x0,%edi
+  800505:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800508:	6a 00                	push   $0x0
+  80050a:	55                   	push   %ebp
+  80050b:	56                   	push   %esi
+  80050c:	89 e5                	mov    %esp,%ebp
+  80050e:	8d 35 16 05 80 00    	lea    0x800516,%esi
+  800514:	0f 34                	sysenter
+
+00800516 <after_sysenter_label_1672>:
+  800516:	5e                   	pop    %esi
+  800517:	5d                   	pop    %ebp
+  800518:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80051b:	5b                   	pop    %ebx
+  80051c:	5f                   	pop    %edi
+  80051d:	5d                   	pop    %ebp
+  80051e:	c3                   	ret
+
+0080051f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80051f:	55                   	push   %ebp
+  800520:	89 e5                	mov    %esp,%ebp
+  800522:	57                   	push   %edi
+  800523:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800534:	89 df                	mov    %ebx,%edi
+  800536:	6a 00                	push   $0x0
+  800538:	55                   	push   %ebp
+  800539:	56                   	push   %esi
+  80053a:	89 e5                	mov    %esp,%ebp
+  80053c:	8d 35 44 05 80 00    	lea    0x800544,%esi
+  800542:	0f 34                	sysenter
+
+00800544 <after_sysenter_label_1758>:
+  800544:	5e                   	pop    %esi
+  800545:	5d                   	pop    %ebp
+  800546:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800549:	5b                   	pop    %ebx
+  80054a:	5f                   	pop    %edi
+  80054b:	5d                   	pop    %ebp
+  80054c:	c3                   	ret
+
+0080054d <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80054d:	55                   	push   %ebp
+  80054e:	89 e5                	mov    %esp,%ebp
+  800550:	57                   	push   %edi
+  800551:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800552:	8b 55 08             	mov    0x8(%ebp),%edx
+  800555:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80055a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80055f:	89 cb                	mov    %ecx,%ebx
+  800561:	89 cf                	mov    %ecx,%edi
+  800563:	6a 00                	push   $0x0
+  800565:	55                   	push   %ebp
+  800566:	56                   	push   %esi
+  800567:	89 e5                	mov    %esp,%ebp
+  800569:	8d 35 71 05 80 00    	lea    0x800571,%esi
+  80056f:	0f 34                	sysenter
+
+00800571 <after_sysenter_label_1842>:
+  800571:	5e                   	pop    %esi
+  800572:	5d                   	pop    %ebp
+  800573:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800576:	85 c0                	test   %eax,%eax
+  800578:	7f 07                	jg     800581 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80057a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80057d:	5b                   	pop    %ebx
+  80057e:	5f                   	pop    %edi
+  80057f:	5d                   	pop    %ebp
+  800580:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800581:	83 ec 0c             	sub    $0xc,%esp
+  800584:	50                   	push   %eax
+  800585:	6a 13                	push   $0x13
+  800587:	68 ea 46 80 00       	push   $0x8046ea
+  80058c:	6a 54                	push   $0x54
+  80058e:	68 07 47 80 00       	push   $0x804707
+  800593:	e8 23 2c 00 00       	call   8031bb <_panic>
+
+00800598 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800598:	55                   	push   %ebp
+  800599:	89 e5                	mov    %esp,%ebp
+  80059b:	57                   	push   %edi
+  80059c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80059d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8005a7:	89 d1                	mov    %edx,%ecx
+  8005a9:	89 d3                	mov    %edx,%ebx
+  8005ab:	89 d7                	mov    %edx,%edi
+  8005ad:	6a 00                	push   $0x0
+  8005af:	55                   	push   %ebp
+  8005b0:	56                   	push   %esi
+  8005b1:	89 e5                	mov    %esp,%ebp
+  8005b3:	8d 35 bb 05 80 00    	lea    0x8005bb,%esi
+  8005b9:	0f 34                	sysenter
+
+008005bb <after_sysenter_label_1939>:
+  8005bb:	5e                   	pop    %esi
+  8005bc:	5d                   	pop    %ebp
+  8005bd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005c0:	5b                   	pop    %ebx
+  8005c1:	5f                   	pop    %edi
+  8005c2:	5d                   	pop    %ebp
+  8005c3:	c3                   	ret
+
+008005c4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005c4:	55                   	push   %ebp
+  8005c5:	89 e5                	mov    %esp,%ebp
+  8005c7:	57                   	push   %edi
+  8005c8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005dc:	6a 00                	push   $0x0
+  8005de:	55                   	push   %ebp
+  8005df:	56                   	push   %esi
+  8005e0:	89 e5                	mov    %esp,%ebp
+  8005e2:	8d 35 ea 05 80 00    	lea    0x8005ea,%esi
+  8005e8:	0f 34                	sysenter
+
+008005ea <after_sysenter_label_2028>:
+  8005ea:	5e                   	pop    %esi
+  8005eb:	5d                   	pop    %ebp
+  8005ec:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005ef:	5b                   	pop    %ebx
+  8005f0:	5f                   	pop    %edi
+  8005f1:	5d                   	pop    %ebp
+  8005f2:	c3                   	ret
+
+008005f3 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005f3:	55                   	push   %ebp
+  8005f4:	89 e5                	mov    %esp,%ebp
+  8005f6:	57                   	push   %edi
+  8005f7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800600:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800603:	b8 16 00 00 00       	mov    $0x16,%eax
+  800608:	89 df                	mov    %ebx,%edi
+  80060a:	6a 00                	push   $0x0
+  80060c:	55                   	push   %ebp
+  80060d:	56                   	push   %esi
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	8d 35 18 06 80 00    	lea    0x800618,%esi
+  800616:	0f 34                	sysenter
+
+00800618 <after_sysenter_label_2114>:
+  800618:	5e                   	pop    %esi
+  800619:	5d                   	pop    %ebp
+  80061a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80061d:	5b                   	pop    %ebx
+  80061e:	5f                   	pop    %edi
+  80061f:	5d                   	pop    %ebp
+  800620:	c3                   	ret
+
+00800621 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800621:	55                   	push   %ebp
+  800622:	89 e5                	mov    %esp,%ebp
+  800624:	57                   	push   %edi
+  800625:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800626:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80062b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800631:	b8 17 00 00 00       	mov    $0x17,%eax
+  800636:	89 df                	mov    %ebx,%edi
+  800638:	6a 00                	push   $0x0
+  80063a:	55                   	push   %ebp
+  80063b:	56                   	push   %esi
+  80063c:	89 e5                	mov    %esp,%ebp
+  80063e:	8d 35 46 06 80 00    	lea    0x800646,%esi
+  800644:	0f 34                	sysenter
+
+00800646 <after_sysenter_label_2200>:
+  800646:	5e                   	pop    %esi
+  800647:	5d                   	pop    %ebp
+  800648:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80064b:	5b                   	pop    %ebx
+  80064c:	5f                   	pop    %edi
+  80064d:	5d                   	pop    %ebp
+  80064e:	c3                   	ret
+
+0080064f <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80064f:	55                   	push   %ebp
+  800650:	89 e5                	mov    %esp,%ebp
+  800652:	57                   	push   %edi
+  800653:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80065f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800664:	89 df                	mov    %ebx,%edi
+  800666:	6a 00                	push   $0x0
+  800668:	55                   	push   %ebp
+  800669:	56                   	push   %esi
+  80066a:	89 e5                	mov    %esp,%ebp
+  80066c:	8d 35 74 06 80 00    	lea    0x800674,%esi
+  800672:	0f 34                	sysenter
+
+00800674 <after_sysenter_label_2286>:
+  800674:	5e                   	pop    %esi
+  800675:	5d                   	pop    %ebp
+  800676:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800679:	5b                   	pop    %ebx
+  80067a:	5f                   	pop    %edi
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800680:	8b 45 08             	mov    0x8(%ebp),%eax
+  800683:	05 00 00 00 30       	add    $0x30000000,%eax
+  800688:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80068b:	5d                   	pop    %ebp
+  80068c:	c3                   	ret
+
+0080068d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800690:	8b 45 08             	mov    0x8(%ebp),%eax
+  800693:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800698:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80069d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8006a7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006ac:	eb 02                	jmp    8006b0 <fd_alloc+0xc>
+  8006ae:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006b0:	89 c2                	mov    %eax,%edx
+  8006b2:	c1 ea 16             	shr    $0x16,%edx
+  8006b5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006bc:	f6 c2 01             	test   $0x1,%dl
+  8006bf:	74 2b                	je     8006ec <fd_alloc+0x48>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	c1 ea 0c             	shr    $0xc,%edx
+  8006c6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006cd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006d3:	f6 c1 01             	test   $0x1,%cl
+  8006d6:	74 14                	je     8006ec <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006d8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006de:	75 ce                	jne    8006ae <fd_alloc+0xa>
+  8006e0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006e5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006ea:	eb 05                	jmp    8006f1 <fd_alloc+0x4d>
+			return 0;
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f4:	89 02                	mov    %eax,(%edx)
+}
+  8006f6:	89 c8                	mov    %ecx,%eax
+  8006f8:	5d                   	pop    %ebp
+  8006f9:	c3                   	ret
+
+008006fa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006fa:	55                   	push   %ebp
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800700:	83 f8 1f             	cmp    $0x1f,%eax
+  800703:	77 30                	ja     800735 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800705:	c1 e0 0c             	shl    $0xc,%eax
+  800708:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80070d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800713:	f6 c2 01             	test   $0x1,%dl
+  800716:	74 24                	je     80073c <fd_lookup+0x42>
+  800718:	89 c2                	mov    %eax,%edx
+  80071a:	c1 ea 0c             	shr    $0xc,%edx
+  80071d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800724:	f6 c2 01             	test   $0x1,%dl
+  800727:	74 1a                	je     800743 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800729:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80072e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800733:	5d                   	pop    %ebp
+  800734:	c3                   	ret
+		return -E_INVAL;
+  800735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073a:	eb f7                	jmp    800733 <fd_lookup+0x39>
+		return -E_INVAL;
+  80073c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800741:	eb f0                	jmp    800733 <fd_lookup+0x39>
+  800743:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800748:	eb e9                	jmp    800733 <fd_lookup+0x39>
+
+0080074a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	53                   	push   %ebx
+  80074e:	83 ec 04             	sub    $0x4,%esp
+  800751:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800754:	b8 00 00 00 00       	mov    $0x0,%eax
+  800759:	eb 03                	jmp    80075e <dev_lookup+0x14>
+  80075b:	83 c0 01             	add    $0x1,%eax
+  80075e:	8b 1c 85 94 47 80 00 	mov    0x804794(,%eax,4),%ebx
+  800765:	85 db                	test   %ebx,%ebx
+  800767:	74 0b                	je     800774 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800769:	39 13                	cmp    %edx,(%ebx)
+  80076b:	75 ee                	jne    80075b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80076d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800772:	eb 49                	jmp    8007bd <dev_lookup+0x73>
+  800774:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800776:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80077c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800781:	77 18                	ja     80079b <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800783:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800788:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80078a:	c1 e8 10             	shr    $0x10,%eax
+  80078d:	74 0c                	je     80079b <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80078f:	c1 e0 10             	shl    $0x10,%eax
+  800792:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  800797:	29 c1                	sub    %eax,%ecx
+  800799:	eb 06                	jmp    8007a1 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80079b:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007a1:	8b 01                	mov    (%ecx),%eax
+  8007a3:	8b 40 48             	mov    0x48(%eax),%eax
+  8007a6:	83 ec 04             	sub    $0x4,%esp
+  8007a9:	52                   	push   %edx
+  8007aa:	50                   	push   %eax
+  8007ab:	68 18 47 80 00       	push   $0x804718
+  8007b0:	e8 e1 2a 00 00       	call   803296 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007b5:	83 c4 10             	add    $0x10,%esp
+  8007b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c0:	89 1a                	mov    %ebx,(%edx)
+}
+  8007c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c5:	c9                   	leave
+  8007c6:	c3                   	ret
+
+008007c7 <fd_close>:
+{
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	57                   	push   %edi
+  8007cb:	56                   	push   %esi
+  8007cc:	53                   	push   %ebx
+  8007cd:	83 ec 24             	sub    $0x24,%esp
+  8007d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007d9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007da:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007e0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007e3:	50                   	push   %eax
+  8007e4:	e8 11 ff ff ff       	call   8006fa <fd_lookup>
+  8007e9:	89 c3                	mov    %eax,%ebx
+  8007eb:	83 c4 10             	add    $0x10,%esp
+  8007ee:	85 c0                	test   %eax,%eax
+  8007f0:	78 05                	js     8007f7 <fd_close+0x30>
+	    || fd != fd2)
+  8007f2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007f5:	74 16                	je     80080d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8007f7:	89 f8                	mov    %edi,%eax
+  8007f9:	84 c0                	test   %al,%al
+  8007fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800800:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800803:	89 d8                	mov    %ebx,%eax
+  800805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800808:	5b                   	pop    %ebx
+  800809:	5e                   	pop    %esi
+  80080a:	5f                   	pop    %edi
+  80080b:	5d                   	pop    %ebp
+  80080c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800813:	50                   	push   %eax
+  800814:	ff 36                	push   (%esi)
+  800816:	e8 2f ff ff ff       	call   80074a <dev_lookup>
+  80081b:	89 c3                	mov    %eax,%ebx
+  80081d:	83 c4 10             	add    $0x10,%esp
+  800820:	85 c0                	test   %eax,%eax
+  800822:	78 1a                	js     80083e <fd_close+0x77>
+		if (dev->dev_close)
+  800824:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800827:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80082a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80082f:	85 c0                	test   %eax,%eax
+  800831:	74 0b                	je     80083e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800833:	83 ec 0c             	sub    $0xc,%esp
+  800836:	56                   	push   %esi
+  800837:	ff d0                	call   *%eax
+  800839:	89 c3                	mov    %eax,%ebx
+  80083b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80083e:	83 ec 08             	sub    $0x8,%esp
+  800841:	56                   	push   %esi
+  800842:	6a 00                	push   $0x0
+  800844:	e8 2b fa ff ff       	call   800274 <sys_page_unmap>
+	return r;
+  800849:	83 c4 10             	add    $0x10,%esp
+  80084c:	eb b5                	jmp    800803 <fd_close+0x3c>
+
+0080084e <close>:
+
+int
+close(int fdnum)
+{
+  80084e:	55                   	push   %ebp
+  80084f:	89 e5                	mov    %esp,%ebp
+  800851:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800854:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800857:	50                   	push   %eax
+  800858:	ff 75 08             	push   0x8(%ebp)
+  80085b:	e8 9a fe ff ff       	call   8006fa <fd_lookup>
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	85 c0                	test   %eax,%eax
+  800865:	79 02                	jns    800869 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+		return fd_close(fd, 1);
+  800869:	83 ec 08             	sub    $0x8,%esp
+  80086c:	6a 01                	push   $0x1
+  80086e:	ff 75 f4             	push   -0xc(%ebp)
+  800871:	e8 51 ff ff ff       	call   8007c7 <fd_close>
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	eb ec                	jmp    800867 <close+0x19>
+
+0080087b <close_all>:
+
+void
+close_all(void)
+{
+  80087b:	55                   	push   %ebp
+  80087c:	89 e5                	mov    %esp,%ebp
+  80087e:	53                   	push   %ebx
+  80087f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800882:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800887:	83 ec 0c             	sub    $0xc,%esp
+  80088a:	53                   	push   %ebx
+  80088b:	e8 be ff ff ff       	call   80084e <close>
+	for (i = 0; i < MAXFD; i++)
+  800890:	83 c3 01             	add    $0x1,%ebx
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	83 fb 20             	cmp    $0x20,%ebx
+  800899:	75 ec                	jne    800887 <close_all+0xc>
+}
+  80089b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089e:	c9                   	leave
+  80089f:	c3                   	ret
+
+008008a0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8008a0:	55                   	push   %ebp
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	57                   	push   %edi
+  8008a4:	56                   	push   %esi
+  8008a5:	53                   	push   %ebx
+  8008a6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008ac:	50                   	push   %eax
+  8008ad:	ff 75 08             	push   0x8(%ebp)
+  8008b0:	e8 45 fe ff ff       	call   8006fa <fd_lookup>
+  8008b5:	89 c3                	mov    %eax,%ebx
+  8008b7:	83 c4 10             	add    $0x10,%esp
+  8008ba:	85 c0                	test   %eax,%eax
+  8008bc:	78 7f                	js     80093d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008be:	83 ec 0c             	sub    $0xc,%esp
+  8008c1:	ff 75 0c             	push   0xc(%ebp)
+  8008c4:	e8 85 ff ff ff       	call   80084e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008cc:	c1 e6 0c             	shl    $0xc,%esi
+  8008cf:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008d8:	89 3c 24             	mov    %edi,(%esp)
+  8008db:	e8 ad fd ff ff       	call   80068d <fd2data>
+  8008e0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008e2:	89 34 24             	mov    %esi,(%esp)
+  8008e5:	e8 a3 fd ff ff       	call   80068d <fd2data>
+  8008ea:	83 c4 10             	add    $0x10,%esp
+  8008ed:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008f0:	89 d8                	mov    %ebx,%eax
+  8008f2:	c1 e8 16             	shr    $0x16,%eax
+  8008f5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008fc:	a8 01                	test   $0x1,%al
+  8008fe:	74 11                	je     800911 <dup+0x71>
+  800900:	89 d8                	mov    %ebx,%eax
+  800902:	c1 e8 0c             	shr    $0xc,%eax
+  800905:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80090c:	f6 c2 01             	test   $0x1,%dl
+  80090f:	75 36                	jne    800947 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800911:	89 f8                	mov    %edi,%eax
+  800913:	c1 e8 0c             	shr    $0xc,%eax
+  800916:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80091d:	83 ec 0c             	sub    $0xc,%esp
+  800920:	25 07 0e 00 00       	and    $0xe07,%eax
+  800925:	50                   	push   %eax
+  800926:	56                   	push   %esi
+  800927:	6a 00                	push   $0x0
+  800929:	57                   	push   %edi
+  80092a:	6a 00                	push   $0x0
+  80092c:	e8 f7 f8 ff ff       	call   800228 <sys_page_map>
+  800931:	89 c3                	mov    %eax,%ebx
+  800933:	83 c4 20             	add    $0x20,%esp
+  800936:	85 c0                	test   %eax,%eax
+  800938:	78 33                	js     80096d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80093a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80093d:	89 d8                	mov    %ebx,%eax
+  80093f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800942:	5b                   	pop    %ebx
+  800943:	5e                   	pop    %esi
+  800944:	5f                   	pop    %edi
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800947:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80094e:	83 ec 0c             	sub    $0xc,%esp
+  800951:	25 07 0e 00 00       	and    $0xe07,%eax
+  800956:	50                   	push   %eax
+  800957:	ff 75 d4             	push   -0x2c(%ebp)
+  80095a:	6a 00                	push   $0x0
+  80095c:	53                   	push   %ebx
+  80095d:	6a 00                	push   $0x0
+  80095f:	e8 c4 f8 ff ff       	call   800228 <sys_page_map>
+  800964:	89 c3                	mov    %eax,%ebx
+  800966:	83 c4 20             	add    $0x20,%esp
+  800969:	85 c0                	test   %eax,%eax
+  80096b:	79 a4                	jns    800911 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80096d:	83 ec 08             	sub    $0x8,%esp
+  800970:	56                   	push   %esi
+  800971:	6a 00                	push   $0x0
+  800973:	e8 fc f8 ff ff       	call   800274 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800978:	83 c4 08             	add    $0x8,%esp
+  80097b:	ff 75 d4             	push   -0x2c(%ebp)
+  80097e:	6a 00                	push   $0x0
+  800980:	e8 ef f8 ff ff       	call   800274 <sys_page_unmap>
+	return r;
+  800985:	83 c4 10             	add    $0x10,%esp
+  800988:	eb b3                	jmp    80093d <dup+0x9d>
+
+0080098a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	56                   	push   %esi
+  80098e:	53                   	push   %ebx
+  80098f:	83 ec 18             	sub    $0x18,%esp
+  800992:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800995:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800998:	50                   	push   %eax
+  800999:	53                   	push   %ebx
+  80099a:	e8 5b fd ff ff       	call   8006fa <fd_lookup>
+  80099f:	83 c4 10             	add    $0x10,%esp
+  8009a2:	85 c0                	test   %eax,%eax
+  8009a4:	78 3c                	js     8009e2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009a6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+  8009ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009af:	50                   	push   %eax
+  8009b0:	ff 36                	push   (%esi)
+  8009b2:	e8 93 fd ff ff       	call   80074a <dev_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 24                	js     8009e2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009be:	8b 46 08             	mov    0x8(%esi),%eax
+  8009c1:	83 e0 03             	and    $0x3,%eax
+  8009c4:	83 f8 01             	cmp    $0x1,%eax
+  8009c7:	74 20                	je     8009e9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009cc:	8b 40 08             	mov    0x8(%eax),%eax
+  8009cf:	85 c0                	test   %eax,%eax
+  8009d1:	74 61                	je     800a34 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009d3:	83 ec 04             	sub    $0x4,%esp
+  8009d6:	ff 75 10             	push   0x10(%ebp)
+  8009d9:	ff 75 0c             	push   0xc(%ebp)
+  8009dc:	56                   	push   %esi
+  8009dd:	ff d0                	call   *%eax
+  8009df:	83 c4 10             	add    $0x10,%esp
+}
+  8009e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e5:	5b                   	pop    %ebx
+  8009e6:	5e                   	pop    %esi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+  8009e9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009eb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009f1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8009f6:	77 18                	ja     800a10 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8009f8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8009fd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8009ff:	c1 e8 10             	shr    $0x10,%eax
+  800a02:	74 0c                	je     800a10 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800a04:	c1 e0 10             	shl    $0x10,%eax
+  800a07:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a0c:	29 c2                	sub    %eax,%edx
+  800a0e:	eb 06                	jmp    800a16 <read+0x8c>
+		return pthread_main_tls;
+  800a10:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a16:	8b 02                	mov    (%edx),%eax
+  800a18:	8b 40 48             	mov    0x48(%eax),%eax
+  800a1b:	83 ec 04             	sub    $0x4,%esp
+  800a1e:	53                   	push   %ebx
+  800a1f:	50                   	push   %eax
+  800a20:	68 59 47 80 00       	push   $0x804759
+  800a25:	e8 6c 28 00 00       	call   803296 <cprintf>
+		return -E_INVAL;
+  800a2a:	83 c4 10             	add    $0x10,%esp
+  800a2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a32:	eb ae                	jmp    8009e2 <read+0x58>
+		return -E_NOT_SUPP;
+  800a34:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a39:	eb a7                	jmp    8009e2 <read+0x58>
+
+00800a3b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	57                   	push   %edi
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	83 ec 0c             	sub    $0xc,%esp
+  800a44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a47:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a4f:	eb 02                	jmp    800a53 <readn+0x18>
+  800a51:	01 c3                	add    %eax,%ebx
+  800a53:	39 f3                	cmp    %esi,%ebx
+  800a55:	73 21                	jae    800a78 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a57:	83 ec 04             	sub    $0x4,%esp
+  800a5a:	89 f0                	mov    %esi,%eax
+  800a5c:	29 d8                	sub    %ebx,%eax
+  800a5e:	50                   	push   %eax
+  800a5f:	89 d8                	mov    %ebx,%eax
+  800a61:	03 45 0c             	add    0xc(%ebp),%eax
+  800a64:	50                   	push   %eax
+  800a65:	57                   	push   %edi
+  800a66:	e8 1f ff ff ff       	call   80098a <read>
+		if (m < 0)
+  800a6b:	83 c4 10             	add    $0x10,%esp
+  800a6e:	85 c0                	test   %eax,%eax
+  800a70:	78 04                	js     800a76 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a72:	75 dd                	jne    800a51 <readn+0x16>
+  800a74:	eb 02                	jmp    800a78 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a76:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a78:	89 d8                	mov    %ebx,%eax
+  800a7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a7d:	5b                   	pop    %ebx
+  800a7e:	5e                   	pop    %esi
+  800a7f:	5f                   	pop    %edi
+  800a80:	5d                   	pop    %ebp
+  800a81:	c3                   	ret
+
+00800a82 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	56                   	push   %esi
+  800a86:	53                   	push   %ebx
+  800a87:	83 ec 18             	sub    $0x18,%esp
+  800a8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a90:	50                   	push   %eax
+  800a91:	53                   	push   %ebx
+  800a92:	e8 63 fc ff ff       	call   8006fa <fd_lookup>
+  800a97:	83 c4 10             	add    $0x10,%esp
+  800a9a:	85 c0                	test   %eax,%eax
+  800a9c:	78 37                	js     800ad5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a9e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aa1:	83 ec 08             	sub    $0x8,%esp
+  800aa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aa7:	50                   	push   %eax
+  800aa8:	ff 36                	push   (%esi)
+  800aaa:	e8 9b fc ff ff       	call   80074a <dev_lookup>
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	85 c0                	test   %eax,%eax
+  800ab4:	78 1f                	js     800ad5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ab6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aba:	74 20                	je     800adc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800abc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800abf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	74 61                	je     800b27 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ac6:	83 ec 04             	sub    $0x4,%esp
+  800ac9:	ff 75 10             	push   0x10(%ebp)
+  800acc:	ff 75 0c             	push   0xc(%ebp)
+  800acf:	56                   	push   %esi
+  800ad0:	ff d0                	call   *%eax
+  800ad2:	83 c4 10             	add    $0x10,%esp
+}
+  800ad5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ad8:	5b                   	pop    %ebx
+  800ad9:	5e                   	pop    %esi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+  800adc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ade:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800ae4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800ae9:	77 18                	ja     800b03 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800aeb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800af0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800af2:	c1 e8 10             	shr    $0x10,%eax
+  800af5:	74 0c                	je     800b03 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800af7:	c1 e0 10             	shl    $0x10,%eax
+  800afa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800aff:	29 c2                	sub    %eax,%edx
+  800b01:	eb 06                	jmp    800b09 <write+0x87>
+		return pthread_main_tls;
+  800b03:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b09:	8b 02                	mov    (%edx),%eax
+  800b0b:	8b 40 48             	mov    0x48(%eax),%eax
+  800b0e:	83 ec 04             	sub    $0x4,%esp
+  800b11:	53                   	push   %ebx
+  800b12:	50                   	push   %eax
+  800b13:	68 75 47 80 00       	push   $0x804775
+  800b18:	e8 79 27 00 00       	call   803296 <cprintf>
+		return -E_INVAL;
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b25:	eb ae                	jmp    800ad5 <write+0x53>
+		return -E_NOT_SUPP;
+  800b27:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b2c:	eb a7                	jmp    800ad5 <write+0x53>
+
+00800b2e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b37:	50                   	push   %eax
+  800b38:	ff 75 08             	push   0x8(%ebp)
+  800b3b:	e8 ba fb ff ff       	call   8006fa <fd_lookup>
+  800b40:	83 c4 10             	add    $0x10,%esp
+  800b43:	85 c0                	test   %eax,%eax
+  800b45:	78 0e                	js     800b55 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b55:	c9                   	leave
+  800b56:	c3                   	ret
+
+00800b57 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	56                   	push   %esi
+  800b5b:	53                   	push   %ebx
+  800b5c:	83 ec 18             	sub    $0x18,%esp
+  800b5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b65:	50                   	push   %eax
+  800b66:	53                   	push   %ebx
+  800b67:	e8 8e fb ff ff       	call   8006fa <fd_lookup>
+  800b6c:	83 c4 10             	add    $0x10,%esp
+  800b6f:	85 c0                	test   %eax,%eax
+  800b71:	78 34                	js     800ba7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b76:	83 ec 08             	sub    $0x8,%esp
+  800b79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b7c:	50                   	push   %eax
+  800b7d:	ff 36                	push   (%esi)
+  800b7f:	e8 c6 fb ff ff       	call   80074a <dev_lookup>
+  800b84:	83 c4 10             	add    $0x10,%esp
+  800b87:	85 c0                	test   %eax,%eax
+  800b89:	78 1c                	js     800ba7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b8b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b8f:	74 1d                	je     800bae <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b94:	8b 40 18             	mov    0x18(%eax),%eax
+  800b97:	85 c0                	test   %eax,%eax
+  800b99:	74 5e                	je     800bf9 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b9b:	83 ec 08             	sub    $0x8,%esp
+  800b9e:	ff 75 0c             	push   0xc(%ebp)
+  800ba1:	56                   	push   %esi
+  800ba2:	ff d0                	call   *%eax
+  800ba4:	83 c4 10             	add    $0x10,%esp
+}
+  800ba7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800baa:	5b                   	pop    %ebx
+  800bab:	5e                   	pop    %esi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+  800bae:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bb0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bb6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bbb:	77 18                	ja     800bd5 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bbd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bc2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bc4:	c1 e8 10             	shr    $0x10,%eax
+  800bc7:	74 0c                	je     800bd5 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bc9:	c1 e0 10             	shl    $0x10,%eax
+  800bcc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bd1:	29 c2                	sub    %eax,%edx
+  800bd3:	eb 06                	jmp    800bdb <ftruncate+0x84>
+		return pthread_main_tls;
+  800bd5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800bdb:	8b 02                	mov    (%edx),%eax
+  800bdd:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800be0:	83 ec 04             	sub    $0x4,%esp
+  800be3:	53                   	push   %ebx
+  800be4:	50                   	push   %eax
+  800be5:	68 38 47 80 00       	push   $0x804738
+  800bea:	e8 a7 26 00 00       	call   803296 <cprintf>
+		return -E_INVAL;
+  800bef:	83 c4 10             	add    $0x10,%esp
+  800bf2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf7:	eb ae                	jmp    800ba7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bfe:	eb a7                	jmp    800ba7 <ftruncate+0x50>
+
+00800c00 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	56                   	push   %esi
+  800c04:	53                   	push   %ebx
+  800c05:	83 ec 18             	sub    $0x18,%esp
+  800c08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c0b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c0e:	50                   	push   %eax
+  800c0f:	ff 75 08             	push   0x8(%ebp)
+  800c12:	e8 e3 fa ff ff       	call   8006fa <fd_lookup>
+  800c17:	83 c4 10             	add    $0x10,%esp
+  800c1a:	85 c0                	test   %eax,%eax
+  800c1c:	78 49                	js     800c67 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c21:	83 ec 08             	sub    $0x8,%esp
+  800c24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c27:	50                   	push   %eax
+  800c28:	ff 36                	push   (%esi)
+  800c2a:	e8 1b fb ff ff       	call   80074a <dev_lookup>
+  800c2f:	83 c4 10             	add    $0x10,%esp
+  800c32:	85 c0                	test   %eax,%eax
+  800c34:	78 31                	js     800c67 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c39:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c3d:	74 2f                	je     800c6e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c3f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c42:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c49:	00 00 00 
+	stat->st_isdir = 0;
+  800c4c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c53:	00 00 00 
+	stat->st_dev = dev;
+  800c56:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c5c:	83 ec 08             	sub    $0x8,%esp
+  800c5f:	53                   	push   %ebx
+  800c60:	56                   	push   %esi
+  800c61:	ff 50 14             	call   *0x14(%eax)
+  800c64:	83 c4 10             	add    $0x10,%esp
+}
+  800c67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5d                   	pop    %ebp
+  800c6d:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c6e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c73:	eb f2                	jmp    800c67 <fstat+0x67>
+
+00800c75 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	56                   	push   %esi
+  800c79:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c7a:	83 ec 08             	sub    $0x8,%esp
+  800c7d:	6a 00                	push   $0x0
+  800c7f:	ff 75 08             	push   0x8(%ebp)
+  800c82:	e8 4b 03 00 00       	call   800fd2 <open>
+  800c87:	89 c3                	mov    %eax,%ebx
+  800c89:	83 c4 10             	add    $0x10,%esp
+  800c8c:	85 c0                	test   %eax,%eax
+  800c8e:	78 1b                	js     800cab <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c90:	83 ec 08             	sub    $0x8,%esp
+  800c93:	ff 75 0c             	push   0xc(%ebp)
+  800c96:	50                   	push   %eax
+  800c97:	e8 64 ff ff ff       	call   800c00 <fstat>
+  800c9c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c9e:	89 1c 24             	mov    %ebx,(%esp)
+  800ca1:	e8 a8 fb ff ff       	call   80084e <close>
+	return r;
+  800ca6:	83 c4 10             	add    $0x10,%esp
+  800ca9:	89 f3                	mov    %esi,%ebx
+}
+  800cab:	89 d8                	mov    %ebx,%eax
+  800cad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+
+00800cb4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	56                   	push   %esi
+  800cb8:	53                   	push   %ebx
+  800cb9:	89 c6                	mov    %eax,%esi
+  800cbb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cbd:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cc4:	74 27                	je     800ced <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc6:	6a 07                	push   $0x7
+  800cc8:	68 00 70 80 00       	push   $0x807000
+  800ccd:	56                   	push   %esi
+  800cce:	ff 35 00 60 80 00    	push   0x806000
+  800cd4:	e8 51 36 00 00       	call   80432a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cd9:	83 c4 0c             	add    $0xc,%esp
+  800cdc:	6a 00                	push   $0x0
+  800cde:	53                   	push   %ebx
+  800cdf:	6a 00                	push   $0x0
+  800ce1:	e8 4e 35 00 00       	call   804234 <ipc_recv>
+}
+  800ce6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5e                   	pop    %esi
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+  800cf0:	6a 01                	push   $0x1
+  800cf2:	e8 89 36 00 00       	call   804380 <ipc_find_env>
+  800cf7:	a3 00 60 80 00       	mov    %eax,0x806000
+  800cfc:	83 c4 10             	add    $0x10,%esp
+  800cff:	eb c5                	jmp    800cc6 <fsipc+0x12>
+
+00800d01 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d01:	55                   	push   %ebp
+  800d02:	89 e5                	mov    %esp,%ebp
+  800d04:	53                   	push   %ebx
+  800d05:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d08:	68 04 60 80 00       	push   $0x806004
+  800d0d:	e8 29 1b 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d15:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d18:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d20:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2f:	e8 80 ff ff ff       	call   800cb4 <fsipc>
+  800d34:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d36:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d3d:	e8 66 1b 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+}
+  800d42:	89 d8                	mov    %ebx,%eax
+  800d44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d47:	c9                   	leave
+  800d48:	c3                   	ret
+
+00800d49 <devfile_flush>:
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	53                   	push   %ebx
+  800d4d:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d50:	68 04 60 80 00       	push   $0x806004
+  800d55:	e8 e1 1a 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d60:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6f:	e8 40 ff ff ff       	call   800cb4 <fsipc>
+  800d74:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d76:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d7d:	e8 26 1b 00 00       	call   8028a8 <mutex_unlock>
+}
+  800d82:	89 d8                	mov    %ebx,%eax
+  800d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d87:	c9                   	leave
+  800d88:	c3                   	ret
+
+00800d89 <devfile_stat>:
+{
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  800d8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+  800d94:	68 04 60 80 00       	push   $0x806004
+  800d99:	e8 9d 1a 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dae:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db3:	e8 fc fe ff ff       	call   800cb4 <fsipc>
+  800db8:	89 c3                	mov    %eax,%ebx
+  800dba:	83 c4 10             	add    $0x10,%esp
+  800dbd:	85 c0                	test   %eax,%eax
+  800dbf:	79 16                	jns    800dd7 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+  800dc4:	68 04 60 80 00       	push   $0x806004
+  800dc9:	e8 da 1a 00 00       	call   8028a8 <mutex_unlock>
+}
+  800dce:	89 d8                	mov    %ebx,%eax
+  800dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dd7:	83 ec 08             	sub    $0x8,%esp
+  800dda:	68 00 70 80 00       	push   $0x807000
+  800ddf:	56                   	push   %esi
+  800de0:	e8 95 2a 00 00       	call   80387a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800de5:	a1 80 70 80 00       	mov    0x807080,%eax
+  800dea:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800df0:	a1 84 70 80 00       	mov    0x807084,%eax
+  800df5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800dfb:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e03:	eb bc                	jmp    800dc1 <devfile_stat+0x38>
+
+00800e05 <devfile_write>:
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 10             	sub    $0x10,%esp
+  800e0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e0f:	68 04 60 80 00       	push   $0x806004
+  800e14:	e8 22 1a 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e1f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e24:	83 c4 10             	add    $0x10,%esp
+  800e27:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e2d:	76 3d                	jbe    800e6c <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e2f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e34:	39 c3                	cmp    %eax,%ebx
+  800e36:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e3c:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e41:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e51:	e8 5e fe ff ff       	call   800cb4 <fsipc>
+  800e56:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	68 04 60 80 00       	push   $0x806004
+  800e60:	e8 43 1a 00 00       	call   8028a8 <mutex_unlock>
+}
+  800e65:	89 d8                	mov    %ebx,%eax
+  800e67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e6a:	c9                   	leave
+  800e6b:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e6c:	83 ec 04             	sub    $0x4,%esp
+  800e6f:	53                   	push   %ebx
+  800e70:	ff 75 0c             	push   0xc(%ebp)
+  800e73:	68 0c 70 80 00       	push   $0x80700c
+  800e78:	e8 83 2b 00 00       	call   803a00 <memmove>
+  800e7d:	83 c4 10             	add    $0x10,%esp
+  800e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e85:	eb b5                	jmp    800e3c <devfile_write+0x37>
+
+00800e87 <devfile_read>:
+{
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	57                   	push   %edi
+  800e8b:	56                   	push   %esi
+  800e8c:	53                   	push   %ebx
+  800e8d:	83 ec 0c             	sub    $0xc,%esp
+  800e90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800e99:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800e9f:	0f 86 8c 00 00 00    	jbe    800f31 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800ea5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800eaa:	39 c3                	cmp    %eax,%ebx
+  800eac:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800eaf:	89 f8                	mov    %edi,%eax
+  800eb1:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800eb4:	eb 0f                	jmp    800ec5 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800eb6:	0f b6 08             	movzbl (%eax),%ecx
+  800eb9:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800ebb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ec0:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ec5:	39 d0                	cmp    %edx,%eax
+  800ec7:	72 ed                	jb     800eb6 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	68 04 60 80 00       	push   $0x806004
+  800ed1:	e8 65 19 00 00       	call   80283b <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ed6:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ed9:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800ede:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800ee4:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eef:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ef4:	e8 bb fd ff ff       	call   800cb4 <fsipc>
+  800ef9:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800efb:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800f02:	e8 a1 19 00 00       	call   8028a8 <mutex_unlock>
+		assert(r <= (int) n);
+  800f07:	83 c4 10             	add    $0x10,%esp
+  800f0a:	39 f3                	cmp    %esi,%ebx
+  800f0c:	7c 0a                	jl     800f18 <devfile_read+0x91>
+}
+  800f0e:	89 f0                	mov    %esi,%eax
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		assert(r <= (int) n);
+  800f18:	68 a8 47 80 00       	push   $0x8047a8
+  800f1d:	68 b5 47 80 00       	push   $0x8047b5
+  800f22:	68 90 00 00 00       	push   $0x90
+  800f27:	68 ca 47 80 00       	push   $0x8047ca
+  800f2c:	e8 8a 22 00 00       	call   8031bb <_panic>
+	mutex_lock(&fsipc_mu);
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+  800f34:	68 04 60 80 00       	push   $0x806004
+  800f39:	e8 fd 18 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f3e:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f41:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f46:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f4c:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f53:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f60:	e8 4f fd ff ff       	call   800cb4 <fsipc>
+  800f65:	89 c6                	mov    %eax,%esi
+  800f67:	83 c4 10             	add    $0x10,%esp
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	78 1d                	js     800f8b <devfile_read+0x104>
+		assert(r <= n);
+  800f6e:	39 c3                	cmp    %eax,%ebx
+  800f70:	72 2e                	jb     800fa0 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f72:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f77:	7f 40                	jg     800fb9 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f79:	83 ec 04             	sub    $0x4,%esp
+  800f7c:	50                   	push   %eax
+  800f7d:	68 00 70 80 00       	push   $0x807000
+  800f82:	57                   	push   %edi
+  800f83:	e8 78 2a 00 00       	call   803a00 <memmove>
+  800f88:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  800f8e:	68 04 60 80 00       	push   $0x806004
+  800f93:	e8 10 19 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+  800f98:	83 c4 10             	add    $0x10,%esp
+  800f9b:	e9 6e ff ff ff       	jmp    800f0e <devfile_read+0x87>
+		assert(r <= n);
+  800fa0:	68 d5 47 80 00       	push   $0x8047d5
+  800fa5:	68 b5 47 80 00       	push   $0x8047b5
+  800faa:	68 99 00 00 00       	push   $0x99
+  800faf:	68 ca 47 80 00       	push   $0x8047ca
+  800fb4:	e8 02 22 00 00       	call   8031bb <_panic>
+		assert(r <= PGSIZE);
+  800fb9:	68 dc 47 80 00       	push   $0x8047dc
+  800fbe:	68 b5 47 80 00       	push   $0x8047b5
+  800fc3:	68 9a 00 00 00       	push   $0x9a
+  800fc8:	68 ca 47 80 00       	push   $0x8047ca
+  800fcd:	e8 e9 21 00 00       	call   8031bb <_panic>
+
+00800fd2 <open>:
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 ec 1c             	sub    $0x1c,%esp
+  800fda:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fdd:	56                   	push   %esi
+  800fde:	e8 5c 28 00 00       	call   80383f <strlen>
+  800fe3:	83 c4 10             	add    $0x10,%esp
+  800fe6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800feb:	0f 8f 85 00 00 00    	jg     801076 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800ff1:	83 ec 0c             	sub    $0xc,%esp
+  800ff4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ff7:	50                   	push   %eax
+  800ff8:	e8 a7 f6 ff ff       	call   8006a4 <fd_alloc>
+  800ffd:	89 c3                	mov    %eax,%ebx
+  800fff:	83 c4 10             	add    $0x10,%esp
+  801002:	85 c0                	test   %eax,%eax
+  801004:	78 55                	js     80105b <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  801009:	68 04 60 80 00       	push   $0x806004
+  80100e:	e8 28 18 00 00       	call   80283b <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801013:	83 c4 08             	add    $0x8,%esp
+  801016:	56                   	push   %esi
+  801017:	68 00 70 80 00       	push   $0x807000
+  80101c:	e8 59 28 00 00       	call   80387a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801021:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801024:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801029:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80102c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801031:	e8 7e fc ff ff       	call   800cb4 <fsipc>
+  801036:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801038:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80103f:	e8 64 18 00 00       	call   8028a8 <mutex_unlock>
+	if (r < 0) {
+  801044:	83 c4 10             	add    $0x10,%esp
+  801047:	85 db                	test   %ebx,%ebx
+  801049:	78 19                	js     801064 <open+0x92>
+	return fd2num(fd);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	ff 75 f4             	push   -0xc(%ebp)
+  801051:	e8 27 f6 ff ff       	call   80067d <fd2num>
+  801056:	89 c3                	mov    %eax,%ebx
+  801058:	83 c4 10             	add    $0x10,%esp
+}
+  80105b:	89 d8                	mov    %ebx,%eax
+  80105d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801060:	5b                   	pop    %ebx
+  801061:	5e                   	pop    %esi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+		fd_close(fd, 0);
+  801064:	83 ec 08             	sub    $0x8,%esp
+  801067:	6a 00                	push   $0x0
+  801069:	ff 75 f4             	push   -0xc(%ebp)
+  80106c:	e8 56 f7 ff ff       	call   8007c7 <fd_close>
+		return r;
+  801071:	83 c4 10             	add    $0x10,%esp
+  801074:	eb e5                	jmp    80105b <open+0x89>
+		return -E_BAD_PATH;
+  801076:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80107b:	eb de                	jmp    80105b <open+0x89>
+
+0080107d <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	53                   	push   %ebx
+  801081:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801084:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801087:	50                   	push   %eax
+  801088:	ff 75 08             	push   0x8(%ebp)
+  80108b:	e8 6a f6 ff ff       	call   8006fa <fd_lookup>
+  801090:	89 c3                	mov    %eax,%ebx
+  801092:	83 c4 10             	add    $0x10,%esp
+  801095:	85 c0                	test   %eax,%eax
+  801097:	78 5b                	js     8010f4 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801099:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80109c:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8010a2:	39 08                	cmp    %ecx,(%eax)
+  8010a4:	75 55                	jne    8010fb <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8010a6:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010aa:	74 56                	je     801102 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010ac:	83 ec 0c             	sub    $0xc,%esp
+  8010af:	68 04 60 80 00       	push   $0x806004
+  8010b4:	e8 82 17 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010bc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010bf:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010c7:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010cf:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010de:	e8 d1 fb ff ff       	call   800cb4 <fsipc>
+  8010e3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010e5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010ec:	e8 b7 17 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+  8010f1:	83 c4 10             	add    $0x10,%esp
+}
+  8010f4:	89 d8                	mov    %ebx,%eax
+  8010f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010fb:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801100:	eb f2                	jmp    8010f4 <fallocate+0x77>
+		return -E_INVAL;
+  801102:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801107:	eb eb                	jmp    8010f4 <fallocate+0x77>
+
+00801109 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801111:	89 f3                	mov    %esi,%ebx
+  801113:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801119:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80111c:	eb 06                	jmp    801124 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80111e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801124:	39 f3                	cmp    %esi,%ebx
+  801126:	73 14                	jae    80113c <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801128:	83 ec 08             	sub    $0x8,%esp
+  80112b:	53                   	push   %ebx
+  80112c:	6a 00                	push   $0x0
+  80112e:	e8 41 f1 ff ff       	call   800274 <sys_page_unmap>
+  801133:	83 c4 10             	add    $0x10,%esp
+  801136:	85 c0                	test   %eax,%eax
+  801138:	79 e4                	jns    80111e <munmap+0x15>
+  80113a:	eb 05                	jmp    801141 <munmap+0x38>
+			return r;
+	return 0;
+  80113c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801141:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801144:	5b                   	pop    %ebx
+  801145:	5e                   	pop    %esi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <mmap>:
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 ec 24             	sub    $0x24,%esp
+  801151:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801154:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801157:	50                   	push   %eax
+  801158:	ff 75 08             	push   0x8(%ebp)
+  80115b:	e8 9a f5 ff ff       	call   8006fa <fd_lookup>
+  801160:	83 c4 10             	add    $0x10,%esp
+  801163:	85 c0                	test   %eax,%eax
+  801165:	0f 88 37 01 00 00    	js     8012a2 <mmap+0x15a>
+		return NULL;
+  80116b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801170:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801173:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801179:	39 0a                	cmp    %ecx,(%edx)
+  80117b:	0f 85 05 01 00 00    	jne    801286 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801181:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801188:	0f 85 1b 01 00 00    	jne    8012a9 <mmap+0x161>
+  80118e:	89 f0                	mov    %esi,%eax
+  801190:	83 e8 01             	sub    $0x1,%eax
+  801193:	0f 88 17 01 00 00    	js     8012b0 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801199:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80119d:	75 28                	jne    8011c7 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80119f:	83 ec 0c             	sub    $0xc,%esp
+  8011a2:	68 04 60 80 00       	push   $0x806004
+  8011a7:	e8 8f 16 00 00       	call   80283b <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011ac:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011b2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011b8:	83 c4 10             	add    $0x10,%esp
+  8011bb:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011c0:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011c5:	eb 2b                	jmp    8011f2 <mmap+0xaa>
+		cow_enable();
+  8011c7:	e8 f7 2b 00 00       	call   803dc3 <cow_enable>
+  8011cc:	eb d1                	jmp    80119f <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011ce:	89 c2                	mov    %eax,%edx
+  8011d0:	c1 ea 0c             	shr    $0xc,%edx
+  8011d3:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011da:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011e0:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011e6:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011e9:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011eb:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011f0:	77 25                	ja     801217 <mmap+0xcf>
+  8011f2:	89 c2                	mov    %eax,%edx
+  8011f4:	29 da                	sub    %ebx,%edx
+  8011f6:	39 ca                	cmp    %ecx,%edx
+  8011f8:	73 3a                	jae    801234 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8011fa:	89 c2                	mov    %eax,%edx
+  8011fc:	c1 ea 16             	shr    $0x16,%edx
+  8011ff:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801206:	f6 c2 01             	test   $0x1,%dl
+  801209:	75 c3                	jne    8011ce <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80120b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801210:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801215:	eb d4                	jmp    8011eb <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801217:	29 d8                	sub    %ebx,%eax
+  801219:	39 c8                	cmp    %ecx,%eax
+  80121b:	73 17                	jae    801234 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80121d:	83 ec 0c             	sub    $0xc,%esp
+  801220:	68 04 60 80 00       	push   $0x806004
+  801225:	e8 7e 16 00 00       	call   8028a8 <mutex_unlock>
+		return NULL;
+  80122a:	83 c4 10             	add    $0x10,%esp
+  80122d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801232:	eb 52                	jmp    801286 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801234:	85 db                	test   %ebx,%ebx
+  801236:	74 e5                	je     80121d <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801238:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80123b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80123e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801243:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801246:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  80124b:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801251:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801257:	8b 45 14             	mov    0x14(%ebp),%eax
+  80125a:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80125f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801264:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801269:	e8 46 fa ff ff       	call   800cb4 <fsipc>
+  80126e:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801270:	83 ec 0c             	sub    $0xc,%esp
+  801273:	68 04 60 80 00       	push   $0x806004
+  801278:	e8 2b 16 00 00       	call   8028a8 <mutex_unlock>
+	if (r < 0) {
+  80127d:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801280:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801282:	85 ff                	test   %edi,%edi
+  801284:	78 08                	js     80128e <mmap+0x146>
+}
+  801286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+		munmap((void*) va, len);
+  80128e:	83 ec 08             	sub    $0x8,%esp
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+  801293:	e8 71 fe ff ff       	call   801109 <munmap>
+		return NULL;
+  801298:	83 c4 10             	add    $0x10,%esp
+  80129b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a0:	eb e4                	jmp    801286 <mmap+0x13e>
+		return NULL;
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	eb dd                	jmp    801286 <mmap+0x13e>
+		return NULL;
+  8012a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ae:	eb d6                	jmp    801286 <mmap+0x13e>
+  8012b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b5:	eb cf                	jmp    801286 <mmap+0x13e>
+
+008012b7 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 ec 10             	sub    $0x10,%esp
+  8012be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012c1:	53                   	push   %ebx
+  8012c2:	e8 78 25 00 00       	call   80383f <strlen>
+  8012c7:	83 c4 10             	add    $0x10,%esp
+  8012ca:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012cf:	7f 42                	jg     801313 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012d1:	83 ec 0c             	sub    $0xc,%esp
+  8012d4:	68 04 60 80 00       	push   $0x806004
+  8012d9:	e8 5d 15 00 00       	call   80283b <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012de:	83 c4 08             	add    $0x8,%esp
+  8012e1:	53                   	push   %ebx
+  8012e2:	68 00 70 80 00       	push   $0x807000
+  8012e7:	e8 8e 25 00 00       	call   80387a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012f6:	e8 b9 f9 ff ff       	call   800cb4 <fsipc>
+  8012fb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8012fd:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801304:	e8 9f 15 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+  801309:	83 c4 10             	add    $0x10,%esp
+}
+  80130c:	89 d8                	mov    %ebx,%eax
+  80130e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801311:	c9                   	leave
+  801312:	c3                   	ret
+		return -E_BAD_PATH;
+  801313:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801318:	eb f2                	jmp    80130c <remove+0x55>
+
+0080131a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	53                   	push   %ebx
+  80131e:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801321:	68 04 60 80 00       	push   $0x806004
+  801326:	e8 10 15 00 00       	call   80283b <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b8 08 00 00 00       	mov    $0x8,%eax
+  801335:	e8 7a f9 ff ff       	call   800cb4 <fsipc>
+  80133a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80133c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801343:	e8 60 15 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+}
+  801348:	89 d8                	mov    %ebx,%eax
+  80134a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+
+0080134f <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	56                   	push   %esi
+  801353:	53                   	push   %ebx
+  801354:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  80135a:	68 04 60 80 00       	push   $0x806004
+  80135f:	e8 d7 14 00 00       	call   80283b <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801364:	8b 45 08             	mov    0x8(%ebp),%eax
+  801367:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80136c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801371:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801376:	e8 39 f9 ff ff       	call   800cb4 <fsipc>
+  80137b:	89 c6                	mov    %eax,%esi
+  80137d:	83 c4 10             	add    $0x10,%esp
+  801380:	85 db                	test   %ebx,%ebx
+  801382:	74 7b                	je     8013ff <fs_bcstat+0xb0>
+  801384:	85 c0                	test   %eax,%eax
+  801386:	78 77                	js     8013ff <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801388:	a1 00 70 80 00       	mov    0x807000,%eax
+  80138d:	89 03                	mov    %eax,(%ebx)
+  80138f:	a1 04 70 80 00       	mov    0x807004,%eax
+  801394:	89 43 04             	mov    %eax,0x4(%ebx)
+  801397:	a1 08 70 80 00       	mov    0x807008,%eax
+  80139c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80139f:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8013a4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8013a7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013ac:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013af:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013b4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013b7:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013bc:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013bf:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013c4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013c7:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013cc:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013cf:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013d4:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013d7:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013dc:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013df:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013e4:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013e7:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013ec:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013ef:	a1 34 70 80 00       	mov    0x807034,%eax
+  8013f4:	89 43 34             	mov    %eax,0x34(%ebx)
+  8013f7:	a1 38 70 80 00       	mov    0x807038,%eax
+  8013fc:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8013ff:	83 ec 0c             	sub    $0xc,%esp
+  801402:	68 04 60 80 00       	push   $0x806004
+  801407:	e8 9c 14 00 00       	call   8028a8 <mutex_unlock>
+	return r;
+}
+  80140c:	89 f0                	mov    %esi,%eax
+  80140e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801411:	5b                   	pop    %ebx
+  801412:	5e                   	pop    %esi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80141c:	0f b6 10             	movzbl (%eax),%edx
+  80141f:	80 fa 72             	cmp    $0x72,%dl
+  801422:	74 44                	je     801468 <parse_mode+0x53>
+  801424:	80 fa 77             	cmp    $0x77,%dl
+  801427:	74 4b                	je     801474 <parse_mode+0x5f>
+  801429:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80142e:	80 fa 61             	cmp    $0x61,%dl
+  801431:	74 09                	je     80143c <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801433:	89 d8                	mov    %ebx,%eax
+  801435:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801438:	5b                   	pop    %ebx
+  801439:	5e                   	pop    %esi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+	switch (mode[0]) {
+  80143c:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801441:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801446:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801448:	83 ec 08             	sub    $0x8,%esp
+  80144b:	6a 2b                	push   $0x2b
+  80144d:	50                   	push   %eax
+  80144e:	e8 39 25 00 00       	call   80398c <strchr>
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	85 c0                	test   %eax,%eax
+  801458:	74 d9                	je     801433 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80145a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80145d:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801460:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801466:	eb cb                	jmp    801433 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801468:	ba 01 00 00 00       	mov    $0x1,%edx
+  80146d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801472:	eb d2                	jmp    801446 <parse_mode+0x31>
+  801474:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801479:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80147e:	eb c6                	jmp    801446 <parse_mode+0x31>
+
+00801480 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801480:	55                   	push   %ebp
+  801481:	89 e5                	mov    %esp,%ebp
+  801483:	57                   	push   %edi
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+  801486:	83 ec 1c             	sub    $0x1c,%esp
+  801489:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80148c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80148f:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801499:	83 c0 24             	add    $0x24,%eax
+  80149c:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8014a0:	74 17                	je     8014b9 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8014a2:	83 c3 01             	add    $0x1,%ebx
+  8014a5:	83 fb 10             	cmp    $0x10,%ebx
+  8014a8:	75 ef                	jne    801499 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014aa:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014af:	89 f0                	mov    %esi,%eax
+  8014b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b4:	5b                   	pop    %ebx
+  8014b5:	5e                   	pop    %esi
+  8014b6:	5f                   	pop    %edi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014b9:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014c0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014c3:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014c6:	c1 e7 02             	shl    $0x2,%edi
+  8014c9:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014cf:	83 ec 04             	sub    $0x4,%esp
+  8014d2:	6a 24                	push   $0x24
+  8014d4:	6a 00                	push   $0x0
+  8014d6:	56                   	push   %esi
+  8014d7:	e8 ef 24 00 00       	call   8039cb <memset>
+			streams[i].f_fd = fd;
+  8014dc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014df:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014e5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014e8:	01 d8                	add    %ebx,%eax
+  8014ea:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014ed:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8014f4:	83 c4 10             	add    $0x10,%esp
+  8014f7:	eb b6                	jmp    8014af <stream_alloc+0x2f>
+
+008014f9 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 14             	sub    $0x14,%esp
+  801500:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801502:	8b 40 18             	mov    0x18(%eax),%eax
+  801505:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801508:	74 4a                	je     801554 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80150a:	83 ec 08             	sub    $0x8,%esp
+  80150d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801510:	50                   	push   %eax
+  801511:	ff 33                	push   (%ebx)
+  801513:	e8 e2 f1 ff ff       	call   8006fa <fd_lookup>
+  801518:	89 c2                	mov    %eax,%edx
+  80151a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801522:	85 d2                	test   %edx,%edx
+  801524:	78 41                	js     801567 <stream_unread+0x6e>
+  801526:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801529:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80152f:	39 0a                	cmp    %ecx,(%edx)
+  801531:	75 34                	jne    801567 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801533:	8b 43 14             	mov    0x14(%ebx),%eax
+  801536:	03 42 04             	add    0x4(%edx),%eax
+  801539:	2b 43 18             	sub    0x18(%ebx),%eax
+  80153c:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80153f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801546:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80154d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801552:	eb 13                	jmp    801567 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801554:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80155b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801562:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801567:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156a:	c9                   	leave
+  80156b:	c3                   	ret
+
+0080156c <stream_drain>:
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	56                   	push   %esi
+  801570:	53                   	push   %ebx
+  801571:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801578:	eb 02                	jmp    80157c <stream_drain+0x10>
+  80157a:	01 c3                	add    %eax,%ebx
+  80157c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80157f:	39 c3                	cmp    %eax,%ebx
+  801581:	73 43                	jae    8015c6 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801583:	83 ec 04             	sub    $0x4,%esp
+  801586:	29 d8                	sub    %ebx,%eax
+  801588:	50                   	push   %eax
+  801589:	89 d8                	mov    %ebx,%eax
+  80158b:	03 46 0c             	add    0xc(%esi),%eax
+  80158e:	50                   	push   %eax
+  80158f:	ff 36                	push   (%esi)
+  801591:	e8 ec f4 ff ff       	call   800a82 <write>
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	7f dd                	jg     80157a <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80159d:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8015a1:	8b 56 0c             	mov    0xc(%esi),%edx
+  8015a4:	83 ec 04             	sub    $0x4,%esp
+  8015a7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015aa:	29 d8                	sub    %ebx,%eax
+  8015ac:	50                   	push   %eax
+  8015ad:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015b0:	50                   	push   %eax
+  8015b1:	52                   	push   %edx
+  8015b2:	e8 49 24 00 00       	call   803a00 <memmove>
+			f->f_wend -= done;
+  8015b7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015ba:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015c4:	eb 0a                	jmp    8015d0 <stream_drain+0x64>
+  8015c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015cb:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015d0:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015d3:	89 d0                	mov    %edx,%eax
+  8015d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d8:	5b                   	pop    %ebx
+  8015d9:	5e                   	pop    %esi
+  8015da:	5d                   	pop    %ebp
+  8015db:	c3                   	ret
+
+008015dc <stream_setup>:
+	if (f->f_buf)
+  8015dc:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015e0:	74 01                	je     8015e3 <stream_setup+0x7>
+  8015e2:	c3                   	ret
+{
+  8015e3:	55                   	push   %ebp
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015ec:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	74 17                	je     80160a <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015f3:	83 f8 03             	cmp    $0x3,%eax
+  8015f6:	75 2d                	jne    801625 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8015f8:	8d 43 20             	lea    0x20(%ebx),%eax
+  8015fb:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8015fe:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  801605:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80160a:	83 ec 0c             	sub    $0xc,%esp
+  80160d:	ff 33                	push   (%ebx)
+  80160f:	e8 29 1b 00 00       	call   80313d <iscons>
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	0f 9f c0             	setg   %al
+  80161c:	0f b6 c0             	movzbl %al,%eax
+  80161f:	83 c0 01             	add    $0x1,%eax
+  801622:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  801625:	83 ec 0c             	sub    $0xc,%esp
+  801628:	68 00 10 00 00       	push   $0x1000
+  80162d:	e8 6e 0b 00 00       	call   8021a0 <malloc>
+  801632:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	74 bc                	je     8015f8 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80163c:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  801643:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  801647:	eb bc                	jmp    801605 <stream_setup+0x29>
+
+00801649 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	53                   	push   %ebx
+  80164d:	83 ec 04             	sub    $0x4,%esp
+  801650:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  801652:	e8 85 ff ff ff       	call   8015dc <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  801657:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80165c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801660:	74 3d                	je     80169f <stream_fill+0x56>
+  801662:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801666:	74 10                	je     801678 <stream_fill+0x2f>
+  801668:	89 d8                	mov    %ebx,%eax
+  80166a:	e8 fd fe ff ff       	call   80156c <stream_drain>
+		return 0;
+  80166f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801674:	85 c0                	test   %eax,%eax
+  801676:	78 27                	js     80169f <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801678:	83 ec 04             	sub    $0x4,%esp
+  80167b:	ff 73 10             	push   0x10(%ebx)
+  80167e:	ff 73 0c             	push   0xc(%ebx)
+  801681:	ff 33                	push   (%ebx)
+  801683:	e8 02 f3 ff ff       	call   80098a <read>
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	85 c0                	test   %eax,%eax
+  80168d:	7e 17                	jle    8016a6 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80168f:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  801693:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80169a:	89 c2                	mov    %eax,%edx
+  80169c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80169f:	89 d0                	mov    %edx,%eax
+  8016a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8016a6:	c1 f8 1f             	sar    $0x1f,%eax
+  8016a9:	83 e0 04             	and    $0x4,%eax
+  8016ac:	83 c0 04             	add    $0x4,%eax
+  8016af:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b7:	eb e6                	jmp    80169f <stream_fill+0x56>
+
+008016b9 <fopen>:
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	57                   	push   %edi
+  8016bd:	56                   	push   %esi
+  8016be:	53                   	push   %ebx
+  8016bf:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016c8:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016ce:	89 f0                	mov    %esi,%eax
+  8016d0:	e8 40 fd ff ff       	call   801415 <parse_mode>
+		return 0;
+  8016d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 2d                	js     80170b <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016de:	83 ec 08             	sub    $0x8,%esp
+  8016e1:	50                   	push   %eax
+  8016e2:	ff 75 08             	push   0x8(%ebp)
+  8016e5:	e8 e8 f8 ff ff       	call   800fd2 <open>
+  8016ea:	89 c7                	mov    %eax,%edi
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	78 58                	js     80174b <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016f3:	80 3e 61             	cmpb   $0x61,(%esi)
+  8016f6:	74 1d                	je     801715 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8016f8:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8016fe:	89 f8                	mov    %edi,%eax
+  801700:	e8 7b fd ff ff       	call   801480 <stream_alloc>
+  801705:	89 c3                	mov    %eax,%ebx
+  801707:	85 c0                	test   %eax,%eax
+  801709:	74 32                	je     80173d <fopen+0x84>
+}
+  80170b:	89 d8                	mov    %ebx,%eax
+  80170d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801710:	5b                   	pop    %ebx
+  801711:	5e                   	pop    %esi
+  801712:	5f                   	pop    %edi
+  801713:	5d                   	pop    %ebp
+  801714:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  801715:	83 ec 08             	sub    $0x8,%esp
+  801718:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80171e:	50                   	push   %eax
+  80171f:	57                   	push   %edi
+  801720:	e8 db f4 ff ff       	call   800c00 <fstat>
+  801725:	83 c4 10             	add    $0x10,%esp
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	78 cc                	js     8016f8 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80172c:	83 ec 08             	sub    $0x8,%esp
+  80172f:	ff 75 dc             	push   -0x24(%ebp)
+  801732:	57                   	push   %edi
+  801733:	e8 f6 f3 ff ff       	call   800b2e <seek>
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	eb bb                	jmp    8016f8 <fopen+0x3f>
+		close(fd);
+  80173d:	83 ec 0c             	sub    $0xc,%esp
+  801740:	57                   	push   %edi
+  801741:	e8 08 f1 ff ff       	call   80084e <close>
+  801746:	83 c4 10             	add    $0x10,%esp
+  801749:	eb c0                	jmp    80170b <fopen+0x52>
+		return 0;
+  80174b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801750:	eb b9                	jmp    80170b <fopen+0x52>
+
+00801752 <fdopen>:
+{
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801758:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80175b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80175e:	e8 b2 fc ff ff       	call   801415 <parse_mode>
+  801763:	89 c2                	mov    %eax,%edx
+		return 0;
+  801765:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80176a:	85 d2                	test   %edx,%edx
+  80176c:	78 0b                	js     801779 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80176e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801771:	8b 45 08             	mov    0x8(%ebp),%eax
+  801774:	e8 07 fd ff ff       	call   801480 <stream_alloc>
+}
+  801779:	c9                   	leave
+  80177a:	c3                   	ret
+
+0080177b <setvbuf>:
+{
+  80177b:	55                   	push   %ebp
+  80177c:	89 e5                	mov    %esp,%ebp
+  80177e:	57                   	push   %edi
+  80177f:	56                   	push   %esi
+  801780:	53                   	push   %ebx
+  801781:	8b 45 08             	mov    0x8(%ebp),%eax
+  801784:	8b 55 10             	mov    0x10(%ebp),%edx
+  801787:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80178a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80178e:	75 3a                	jne    8017ca <setvbuf+0x4f>
+  801790:	8d 72 ff             	lea    -0x1(%edx),%esi
+  801793:	83 fe 02             	cmp    $0x2,%esi
+  801796:	77 39                	ja     8017d1 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  801798:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80179b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80179f:	0f 95 c3             	setne  %bl
+  8017a2:	85 ff                	test   %edi,%edi
+  8017a4:	0f 95 c1             	setne  %cl
+  8017a7:	84 cb                	test   %cl,%bl
+  8017a9:	74 05                	je     8017b0 <setvbuf+0x35>
+  8017ab:	83 fa 03             	cmp    $0x3,%edx
+  8017ae:	75 0a                	jne    8017ba <setvbuf+0x3f>
+	return 0;
+  8017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5f                   	pop    %edi
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+		f->f_buf = buf;
+  8017ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017bd:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017c0:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	eb eb                	jmp    8017b5 <setvbuf+0x3a>
+		return EOF;
+  8017ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017cf:	eb e4                	jmp    8017b5 <setvbuf+0x3a>
+  8017d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017d6:	eb dd                	jmp    8017b5 <setvbuf+0x3a>
+
+008017d8 <fflush>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	57                   	push   %edi
+  8017dc:	56                   	push   %esi
+  8017dd:	53                   	push   %ebx
+  8017de:	83 ec 0c             	sub    $0xc,%esp
+  8017e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017e4:	85 db                	test   %ebx,%ebx
+  8017e6:	74 1a                	je     801802 <fflush+0x2a>
+	stream_unread(f);
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	e8 0a fd ff ff       	call   8014f9 <stream_unread>
+	return stream_drain(f);
+  8017ef:	89 d8                	mov    %ebx,%eax
+  8017f1:	e8 76 fd ff ff       	call   80156c <stream_drain>
+  8017f6:	89 c7                	mov    %eax,%edi
+}
+  8017f8:	89 f8                	mov    %edi,%eax
+  8017fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017fd:	5b                   	pop    %ebx
+  8017fe:	5e                   	pop    %esi
+  8017ff:	5f                   	pop    %edi
+  801800:	5d                   	pop    %ebp
+  801801:	c3                   	ret
+  801802:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801807:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801811:	eb 03                	jmp    801816 <fflush+0x3e>
+  801813:	83 c3 24             	add    $0x24,%ebx
+  801816:	39 f3                	cmp    %esi,%ebx
+  801818:	74 de                	je     8017f8 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80181a:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80181e:	74 f3                	je     801813 <fflush+0x3b>
+  801820:	83 ec 0c             	sub    $0xc,%esp
+  801823:	53                   	push   %ebx
+  801824:	e8 af ff ff ff       	call   8017d8 <fflush>
+  801829:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801833:	0f 48 f8             	cmovs  %eax,%edi
+  801836:	eb db                	jmp    801813 <fflush+0x3b>
+
+00801838 <fclose>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	56                   	push   %esi
+  80183c:	53                   	push   %ebx
+  80183d:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	56                   	push   %esi
+  801844:	e8 8f ff ff ff       	call   8017d8 <fflush>
+  801849:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80184b:	83 c4 04             	add    $0x4,%esp
+  80184e:	ff 36                	push   (%esi)
+  801850:	e8 f9 ef ff ff       	call   80084e <close>
+  801855:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80185f:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  801862:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  801866:	75 10                	jne    801878 <fclose+0x40>
+	f->f_flags = 0;
+  801868:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80186f:	89 d8                	mov    %ebx,%eax
+  801871:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801874:	5b                   	pop    %ebx
+  801875:	5e                   	pop    %esi
+  801876:	5d                   	pop    %ebp
+  801877:	c3                   	ret
+		free(f->f_buf);
+  801878:	83 ec 0c             	sub    $0xc,%esp
+  80187b:	ff 76 0c             	push   0xc(%esi)
+  80187e:	e8 54 08 00 00       	call   8020d7 <free>
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	eb e0                	jmp    801868 <fclose+0x30>
+
+00801888 <fileno>:
+{
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80188b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188e:	8b 00                	mov    (%eax),%eax
+}
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+
+00801892 <feof>:
+{
+  801892:	55                   	push   %ebp
+  801893:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  801895:	8b 45 08             	mov    0x8(%ebp),%eax
+  801898:	8b 40 04             	mov    0x4(%eax),%eax
+  80189b:	c1 e8 02             	shr    $0x2,%eax
+  80189e:	83 e0 01             	and    $0x1,%eax
+}
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+
+008018a3 <ferror>:
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8018a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a9:	8b 40 04             	mov    0x4(%eax),%eax
+  8018ac:	c1 e8 03             	shr    $0x3,%eax
+  8018af:	83 e0 01             	and    $0x1,%eax
+}
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+
+008018b4 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	53                   	push   %ebx
+  8018b8:	83 ec 04             	sub    $0x4,%esp
+  8018bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018be:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018c1:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018c4:	74 15                	je     8018db <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018c6:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018c9:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018cc:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018cf:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018d2:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018db:	89 d8                	mov    %ebx,%eax
+  8018dd:	e8 67 fd ff ff       	call   801649 <stream_fill>
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	75 e0                	jne    8018c6 <fgetc+0x12>
+		return EOF;
+  8018e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018eb:	eb e9                	jmp    8018d6 <fgetc+0x22>
+
+008018ed <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	57                   	push   %edi
+  8018f1:	56                   	push   %esi
+  8018f2:	53                   	push   %ebx
+  8018f3:	83 ec 1c             	sub    $0x1c,%esp
+  8018f6:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8018f9:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8018fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801901:	83 e8 01             	sub    $0x1,%eax
+  801904:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  801907:	eb 66                	jmp    80196f <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801909:	8b 46 14             	mov    0x14(%esi),%eax
+  80190c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80190f:	29 c3                	sub    %eax,%ebx
+  801911:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801914:	29 fa                	sub    %edi,%edx
+  801916:	39 d3                	cmp    %edx,%ebx
+  801918:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80191b:	83 ec 04             	sub    $0x4,%esp
+  80191e:	53                   	push   %ebx
+  80191f:	6a 0a                	push   $0xa
+  801921:	03 46 0c             	add    0xc(%esi),%eax
+  801924:	50                   	push   %eax
+  801925:	e8 87 21 00 00       	call   803ab1 <memfind>
+  80192a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80192d:	8b 46 0c             	mov    0xc(%esi),%eax
+  801930:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801933:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  801936:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80193e:	74 0b                	je     80194b <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801940:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801943:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801946:	29 d3                	sub    %edx,%ebx
+  801948:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80194b:	83 ec 04             	sub    $0x4,%esp
+  80194e:	53                   	push   %ebx
+  80194f:	01 c8                	add    %ecx,%eax
+  801951:	50                   	push   %eax
+  801952:	89 f8                	mov    %edi,%eax
+  801954:	03 45 08             	add    0x8(%ebp),%eax
+  801957:	50                   	push   %eax
+  801958:	e8 a3 20 00 00       	call   803a00 <memmove>
+		f->f_rpos += m;
+  80195d:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801960:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	8b 45 08             	mov    0x8(%ebp),%eax
+  801968:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80196d:	74 1f                	je     80198e <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80196f:	8d 47 01             	lea    0x1(%edi),%eax
+  801972:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801975:	73 17                	jae    80198e <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  801977:	8b 46 18             	mov    0x18(%esi),%eax
+  80197a:	39 46 14             	cmp    %eax,0x14(%esi)
+  80197d:	75 8a                	jne    801909 <fgets+0x1c>
+  80197f:	89 f0                	mov    %esi,%eax
+  801981:	e8 c3 fc ff ff       	call   801649 <stream_fill>
+  801986:	85 c0                	test   %eax,%eax
+  801988:	0f 85 7b ff ff ff    	jne    801909 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80198e:	85 ff                	test   %edi,%edi
+  801990:	74 0f                	je     8019a1 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  801992:	8b 45 08             	mov    0x8(%ebp),%eax
+  801995:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  801999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5f                   	pop    %edi
+  80199f:	5d                   	pop    %ebp
+  8019a0:	c3                   	ret
+		return 0;
+  8019a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a6:	eb f1                	jmp    801999 <fgets+0xac>
+
+008019a8 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019a8:	55                   	push   %ebp
+  8019a9:	89 e5                	mov    %esp,%ebp
+  8019ab:	57                   	push   %edi
+  8019ac:	56                   	push   %esi
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 1c             	sub    $0x1c,%esp
+  8019b1:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019b4:	89 f0                	mov    %esi,%eax
+  8019b6:	e8 21 fc ff ff       	call   8015dc <stream_setup>
+	want = size * n;
+  8019bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019be:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ca:	eb 43                	jmp    801a0f <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019cc:	29 d3                	sub    %edx,%ebx
+  8019ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019d1:	29 f8                	sub    %edi,%eax
+  8019d3:	39 c3                	cmp    %eax,%ebx
+  8019d5:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019d8:	83 ec 04             	sub    $0x4,%esp
+  8019db:	53                   	push   %ebx
+  8019dc:	03 56 0c             	add    0xc(%esi),%edx
+  8019df:	52                   	push   %edx
+  8019e0:	89 f8                	mov    %edi,%eax
+  8019e2:	03 45 08             	add    0x8(%ebp),%eax
+  8019e5:	50                   	push   %eax
+  8019e6:	e8 15 20 00 00       	call   803a00 <memmove>
+			f->f_rpos += m;
+  8019eb:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	eb 1a                	jmp    801a0d <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019f3:	83 ec 04             	sub    $0x4,%esp
+  8019f6:	53                   	push   %ebx
+  8019f7:	89 f8                	mov    %edi,%eax
+  8019f9:	03 45 08             	add    0x8(%ebp),%eax
+  8019fc:	50                   	push   %eax
+  8019fd:	ff 36                	push   (%esi)
+  8019ff:	e8 86 ef ff ff       	call   80098a <read>
+  801a04:	89 c3                	mov    %eax,%ebx
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	7e 36                	jle    801a43 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a0d:	01 df                	add    %ebx,%edi
+  801a0f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a12:	39 c7                	cmp    %eax,%edi
+  801a14:	73 39                	jae    801a4f <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a16:	8b 56 14             	mov    0x14(%esi),%edx
+  801a19:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a1c:	39 da                	cmp    %ebx,%edx
+  801a1e:	72 ac                	jb     8019cc <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a20:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a23:	29 fb                	sub    %edi,%ebx
+  801a25:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a28:	72 3e                	jb     801a68 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a2a:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a2e:	74 1f                	je     801a4f <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a30:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a34:	74 bd                	je     8019f3 <fread+0x4b>
+  801a36:	89 f0                	mov    %esi,%eax
+  801a38:	e8 2f fb ff ff       	call   80156c <stream_drain>
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	79 b2                	jns    8019f3 <fread+0x4b>
+  801a41:	eb 0c                	jmp    801a4f <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a43:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a46:	83 e3 04             	and    $0x4,%ebx
+  801a49:	83 c3 04             	add    $0x4,%ebx
+  801a4c:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	74 0a                	je     801a60 <fread+0xb8>
+  801a56:	89 f8                	mov    %edi,%eax
+  801a58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5d:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5f                   	pop    %edi
+  801a66:	5d                   	pop    %ebp
+  801a67:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a68:	89 f0                	mov    %esi,%eax
+  801a6a:	e8 da fb ff ff       	call   801649 <stream_fill>
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	74 dc                	je     801a4f <fread+0xa7>
+			m = 0;
+  801a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a78:	eb 93                	jmp    801a0d <fread+0x65>
+
+00801a7a <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	57                   	push   %edi
+  801a7e:	56                   	push   %esi
+  801a7f:	53                   	push   %ebx
+  801a80:	83 ec 1c             	sub    $0x1c,%esp
+  801a83:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a86:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a89:	a8 02                	test   $0x2,%al
+  801a8b:	75 13                	jne    801aa0 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a8d:	83 c8 08             	or     $0x8,%eax
+  801a90:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a9b:	5b                   	pop    %ebx
+  801a9c:	5e                   	pop    %esi
+  801a9d:	5f                   	pop    %edi
+  801a9e:	5d                   	pop    %ebp
+  801a9f:	c3                   	ret
+	stream_setup(f);
+  801aa0:	89 d8                	mov    %ebx,%eax
+  801aa2:	e8 35 fb ff ff       	call   8015dc <stream_setup>
+	want = size * n;
+  801aa7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aaa:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801ab1:	89 d8                	mov    %ebx,%eax
+  801ab3:	e8 41 fa ff ff       	call   8014f9 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ab8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801abd:	84 c0                	test   %al,%al
+  801abf:	75 7b                	jne    801b3c <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ac1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ac9:	39 fe                	cmp    %edi,%esi
+  801acb:	73 24                	jae    801af1 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801acd:	83 ec 04             	sub    $0x4,%esp
+  801ad0:	89 f8                	mov    %edi,%eax
+  801ad2:	29 f0                	sub    %esi,%eax
+  801ad4:	50                   	push   %eax
+  801ad5:	89 f0                	mov    %esi,%eax
+  801ad7:	03 45 08             	add    0x8(%ebp),%eax
+  801ada:	50                   	push   %eax
+  801adb:	ff 33                	push   (%ebx)
+  801add:	e8 a0 ef ff ff       	call   800a82 <write>
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	7e 04                	jle    801aed <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801ae9:	01 c6                	add    %eax,%esi
+  801aeb:	eb dc                	jmp    801ac9 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801aed:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801af1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	74 a0                	je     801a98 <fwrite+0x1e>
+  801af8:	89 f0                	mov    %esi,%eax
+  801afa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aff:	f7 75 0c             	divl   0xc(%ebp)
+  801b02:	eb 94                	jmp    801a98 <fwrite+0x1e>
+			done += r;
+  801b04:	01 c7                	add    %eax,%edi
+			continue;
+  801b06:	eb 34                	jmp    801b3c <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b08:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b0b:	29 c6                	sub    %eax,%esi
+  801b0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b10:	29 fa                	sub    %edi,%edx
+  801b12:	39 d6                	cmp    %edx,%esi
+  801b14:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b17:	83 ec 04             	sub    $0x4,%esp
+  801b1a:	56                   	push   %esi
+  801b1b:	89 fa                	mov    %edi,%edx
+  801b1d:	03 55 08             	add    0x8(%ebp),%edx
+  801b20:	52                   	push   %edx
+  801b21:	03 43 0c             	add    0xc(%ebx),%eax
+  801b24:	50                   	push   %eax
+  801b25:	e8 d6 1e 00 00       	call   803a00 <memmove>
+		f->f_wend += m;
+  801b2a:	89 f0                	mov    %esi,%eax
+  801b2c:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b2f:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b32:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b3a:	74 5b                	je     801b97 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b3f:	39 c7                	cmp    %eax,%edi
+  801b41:	73 2d                	jae    801b70 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b43:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	75 be                	jne    801b08 <fwrite+0x8e>
+  801b4a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b4d:	29 fa                	sub    %edi,%edx
+  801b4f:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b52:	72 b4                	jb     801b08 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b54:	83 ec 04             	sub    $0x4,%esp
+  801b57:	52                   	push   %edx
+  801b58:	89 f8                	mov    %edi,%eax
+  801b5a:	03 45 08             	add    0x8(%ebp),%eax
+  801b5d:	50                   	push   %eax
+  801b5e:	ff 33                	push   (%ebx)
+  801b60:	e8 1d ef ff ff       	call   800a82 <write>
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	7f 98                	jg     801b04 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b6c:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b70:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b73:	83 f8 03             	cmp    $0x3,%eax
+  801b76:	74 48                	je     801bc0 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b78:	83 f8 02             	cmp    $0x2,%eax
+  801b7b:	74 27                	je     801ba4 <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	0f 84 10 ff ff ff    	je     801a98 <fwrite+0x1e>
+  801b88:	89 f8                	mov    %edi,%eax
+  801b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8f:	f7 75 0c             	divl   0xc(%ebp)
+  801b92:	e9 01 ff ff ff       	jmp    801a98 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b97:	89 d8                	mov    %ebx,%eax
+  801b99:	e8 ce f9 ff ff       	call   80156c <stream_drain>
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	79 9a                	jns    801b3c <fwrite+0xc2>
+  801ba2:	eb cc                	jmp    801b70 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801ba4:	83 ec 04             	sub    $0x4,%esp
+  801ba7:	57                   	push   %edi
+  801ba8:	6a 0a                	push   $0xa
+  801baa:	ff 75 08             	push   0x8(%ebp)
+  801bad:	e8 ff 1e 00 00       	call   803ab1 <memfind>
+  801bb2:	89 c2                	mov    %eax,%edx
+  801bb4:	89 f8                	mov    %edi,%eax
+  801bb6:	03 45 08             	add    0x8(%ebp),%eax
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	39 c2                	cmp    %eax,%edx
+  801bbe:	74 bd                	je     801b7d <fwrite+0x103>
+		stream_drain(f);
+  801bc0:	89 d8                	mov    %ebx,%eax
+  801bc2:	e8 a5 f9 ff ff       	call   80156c <stream_drain>
+  801bc7:	eb b4                	jmp    801b7d <fwrite+0x103>
+
+00801bc9 <fputc>:
+{
+  801bc9:	55                   	push   %ebp
+  801bca:	89 e5                	mov    %esp,%ebp
+  801bcc:	53                   	push   %ebx
+  801bcd:	83 ec 14             	sub    $0x14,%esp
+  801bd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bd3:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bd6:	ff 75 0c             	push   0xc(%ebp)
+  801bd9:	6a 01                	push   $0x1
+  801bdb:	6a 01                	push   $0x1
+  801bdd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801be0:	50                   	push   %eax
+  801be1:	e8 94 fe ff ff       	call   801a7a <fwrite>
+  801be6:	83 c4 10             	add    $0x10,%esp
+  801be9:	0f b6 db             	movzbl %bl,%ebx
+  801bec:	83 f8 01             	cmp    $0x1,%eax
+  801bef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bf4:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801bf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfa:	c9                   	leave
+  801bfb:	c3                   	ret
+
+00801bfc <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801c02:	ff 75 0c             	push   0xc(%ebp)
+  801c05:	ff 75 08             	push   0x8(%ebp)
+  801c08:	e8 bc ff ff ff       	call   801bc9 <fputc>
+}
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	c9                   	leave
+  801c11:	c3                   	ret
+
+00801c12 <fputs>:
+{
+  801c12:	55                   	push   %ebp
+  801c13:	89 e5                	mov    %esp,%ebp
+  801c15:	56                   	push   %esi
+  801c16:	53                   	push   %ebx
+  801c17:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	56                   	push   %esi
+  801c1e:	e8 1c 1c 00 00       	call   80383f <strlen>
+  801c23:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c25:	ff 75 0c             	push   0xc(%ebp)
+  801c28:	50                   	push   %eax
+  801c29:	6a 01                	push   $0x1
+  801c2b:	56                   	push   %esi
+  801c2c:	e8 49 fe ff ff       	call   801a7a <fwrite>
+  801c31:	83 c4 20             	add    $0x20,%esp
+  801c34:	39 d8                	cmp    %ebx,%eax
+  801c36:	0f 95 c0             	setne  %al
+  801c39:	0f b6 c0             	movzbl %al,%eax
+  801c3c:	f7 d8                	neg    %eax
+}
+  801c3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c41:	5b                   	pop    %ebx
+  801c42:	5e                   	pop    %esi
+  801c43:	5d                   	pop    %ebp
+  801c44:	c3                   	ret
+
+00801c45 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	53                   	push   %ebx
+  801c49:	83 ec 04             	sub    $0x4,%esp
+  801c4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c4f:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c52:	50                   	push   %eax
+  801c53:	ff 75 0c             	push   0xc(%ebp)
+  801c56:	53                   	push   %ebx
+  801c57:	68 fc 1b 80 00       	push   $0x801bfc
+  801c5c:	e8 2c 17 00 00       	call   80338d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c61:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c64:	c1 e0 1c             	shl    $0x1c,%eax
+  801c67:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c6d:	c9                   	leave
+  801c6e:	c3                   	ret
+
+00801c6f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c6f:	55                   	push   %ebp
+  801c70:	89 e5                	mov    %esp,%ebp
+  801c72:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c75:	68 f0 47 80 00       	push   $0x8047f0
+  801c7a:	ff 75 0c             	push   0xc(%ebp)
+  801c7d:	e8 f8 1b 00 00       	call   80387a <strcpy>
+	return 0;
+}
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+00801c89 <devsock_close>:
+{
+  801c89:	55                   	push   %ebp
+  801c8a:	89 e5                	mov    %esp,%ebp
+  801c8c:	53                   	push   %ebx
+  801c8d:	83 ec 10             	sub    $0x10,%esp
+  801c90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c93:	53                   	push   %ebx
+  801c94:	e8 26 27 00 00       	call   8043bf <pageref>
+  801c99:	89 c2                	mov    %eax,%edx
+  801c9b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ca3:	83 fa 01             	cmp    $0x1,%edx
+  801ca6:	74 05                	je     801cad <devsock_close+0x24>
+}
+  801ca8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cab:	c9                   	leave
+  801cac:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cad:	83 ec 0c             	sub    $0xc,%esp
+  801cb0:	ff 73 0c             	push   0xc(%ebx)
+  801cb3:	e8 b7 02 00 00       	call   801f6f <nsipc_close>
+  801cb8:	83 c4 10             	add    $0x10,%esp
+  801cbb:	eb eb                	jmp    801ca8 <devsock_close+0x1f>
+
+00801cbd <devsock_write>:
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cc3:	6a 00                	push   $0x0
+  801cc5:	ff 75 10             	push   0x10(%ebp)
+  801cc8:	ff 75 0c             	push   0xc(%ebp)
+  801ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cce:	ff 70 0c             	push   0xc(%eax)
+  801cd1:	e8 79 03 00 00       	call   80204f <nsipc_send>
+}
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+
+00801cd8 <devsock_read>:
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cde:	6a 00                	push   $0x0
+  801ce0:	ff 75 10             	push   0x10(%ebp)
+  801ce3:	ff 75 0c             	push   0xc(%ebp)
+  801ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce9:	ff 70 0c             	push   0xc(%eax)
+  801cec:	e8 ef 02 00 00       	call   801fe0 <nsipc_recv>
+}
+  801cf1:	c9                   	leave
+  801cf2:	c3                   	ret
+
+00801cf3 <fd2sockid>:
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cf9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cfc:	52                   	push   %edx
+  801cfd:	50                   	push   %eax
+  801cfe:	e8 f7 e9 ff ff       	call   8006fa <fd_lookup>
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 10                	js     801d1a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0d:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d13:	39 08                	cmp    %ecx,(%eax)
+  801d15:	75 05                	jne    801d1c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d17:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d1a:	c9                   	leave
+  801d1b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d1c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d21:	eb f7                	jmp    801d1a <fd2sockid+0x27>
+
+00801d23 <alloc_sockfd>:
+{
+  801d23:	55                   	push   %ebp
+  801d24:	89 e5                	mov    %esp,%ebp
+  801d26:	56                   	push   %esi
+  801d27:	53                   	push   %ebx
+  801d28:	83 ec 1c             	sub    $0x1c,%esp
+  801d2b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d30:	50                   	push   %eax
+  801d31:	e8 6e e9 ff ff       	call   8006a4 <fd_alloc>
+  801d36:	89 c3                	mov    %eax,%ebx
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 43                	js     801d82 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d3f:	83 ec 04             	sub    $0x4,%esp
+  801d42:	68 07 04 00 00       	push   $0x407
+  801d47:	ff 75 f4             	push   -0xc(%ebp)
+  801d4a:	6a 00                	push   $0x0
+  801d4c:	e8 8a e4 ff ff       	call   8001db <sys_page_alloc>
+  801d51:	89 c3                	mov    %eax,%ebx
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 28                	js     801d82 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5d:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d63:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d68:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d6f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d72:	83 ec 0c             	sub    $0xc,%esp
+  801d75:	50                   	push   %eax
+  801d76:	e8 02 e9 ff ff       	call   80067d <fd2num>
+  801d7b:	89 c3                	mov    %eax,%ebx
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	eb 0c                	jmp    801d8e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d82:	83 ec 0c             	sub    $0xc,%esp
+  801d85:	56                   	push   %esi
+  801d86:	e8 e4 01 00 00       	call   801f6f <nsipc_close>
+		return r;
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	89 d8                	mov    %ebx,%eax
+  801d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d93:	5b                   	pop    %ebx
+  801d94:	5e                   	pop    %esi
+  801d95:	5d                   	pop    %ebp
+  801d96:	c3                   	ret
+
+00801d97 <accept>:
+{
+  801d97:	55                   	push   %ebp
+  801d98:	89 e5                	mov    %esp,%ebp
+  801d9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da0:	e8 4e ff ff ff       	call   801cf3 <fd2sockid>
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 1b                	js     801dc4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801da9:	83 ec 04             	sub    $0x4,%esp
+  801dac:	ff 75 10             	push   0x10(%ebp)
+  801daf:	ff 75 0c             	push   0xc(%ebp)
+  801db2:	50                   	push   %eax
+  801db3:	e8 0e 01 00 00       	call   801ec6 <nsipc_accept>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 05                	js     801dc4 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dbf:	e8 5f ff ff ff       	call   801d23 <alloc_sockfd>
+}
+  801dc4:	c9                   	leave
+  801dc5:	c3                   	ret
+
+00801dc6 <bind>:
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcf:	e8 1f ff ff ff       	call   801cf3 <fd2sockid>
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 12                	js     801dea <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dd8:	83 ec 04             	sub    $0x4,%esp
+  801ddb:	ff 75 10             	push   0x10(%ebp)
+  801dde:	ff 75 0c             	push   0xc(%ebp)
+  801de1:	50                   	push   %eax
+  801de2:	e8 31 01 00 00       	call   801f18 <nsipc_bind>
+  801de7:	83 c4 10             	add    $0x10,%esp
+}
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+
+00801dec <shutdown>:
+{
+  801dec:	55                   	push   %ebp
+  801ded:	89 e5                	mov    %esp,%ebp
+  801def:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801df2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df5:	e8 f9 fe ff ff       	call   801cf3 <fd2sockid>
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 0f                	js     801e0d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	50                   	push   %eax
+  801e05:	e8 43 01 00 00       	call   801f4d <nsipc_shutdown>
+  801e0a:	83 c4 10             	add    $0x10,%esp
+}
+  801e0d:	c9                   	leave
+  801e0e:	c3                   	ret
+
+00801e0f <connect>:
+{
+  801e0f:	55                   	push   %ebp
+  801e10:	89 e5                	mov    %esp,%ebp
+  801e12:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e18:	e8 d6 fe ff ff       	call   801cf3 <fd2sockid>
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 12                	js     801e33 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e21:	83 ec 04             	sub    $0x4,%esp
+  801e24:	ff 75 10             	push   0x10(%ebp)
+  801e27:	ff 75 0c             	push   0xc(%ebp)
+  801e2a:	50                   	push   %eax
+  801e2b:	e8 59 01 00 00       	call   801f89 <nsipc_connect>
+  801e30:	83 c4 10             	add    $0x10,%esp
+}
+  801e33:	c9                   	leave
+  801e34:	c3                   	ret
+
+00801e35 <listen>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3e:	e8 b0 fe ff ff       	call   801cf3 <fd2sockid>
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 0f                	js     801e56 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e47:	83 ec 08             	sub    $0x8,%esp
+  801e4a:	ff 75 0c             	push   0xc(%ebp)
+  801e4d:	50                   	push   %eax
+  801e4e:	e8 6b 01 00 00       	call   801fbe <nsipc_listen>
+  801e53:	83 c4 10             	add    $0x10,%esp
+}
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+
+00801e58 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e58:	55                   	push   %ebp
+  801e59:	89 e5                	mov    %esp,%ebp
+  801e5b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e5e:	ff 75 10             	push   0x10(%ebp)
+  801e61:	ff 75 0c             	push   0xc(%ebp)
+  801e64:	ff 75 08             	push   0x8(%ebp)
+  801e67:	e8 41 02 00 00       	call   8020ad <nsipc_socket>
+  801e6c:	83 c4 10             	add    $0x10,%esp
+  801e6f:	85 c0                	test   %eax,%eax
+  801e71:	78 05                	js     801e78 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e73:	e8 ab fe ff ff       	call   801d23 <alloc_sockfd>
+}
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+
+00801e7a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	53                   	push   %ebx
+  801e7e:	83 ec 04             	sub    $0x4,%esp
+  801e81:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e83:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e8a:	74 26                	je     801eb2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e8c:	6a 07                	push   $0x7
+  801e8e:	68 00 80 80 00       	push   $0x808000
+  801e93:	53                   	push   %ebx
+  801e94:	ff 35 08 60 80 00    	push   0x806008
+  801e9a:	e8 8b 24 00 00       	call   80432a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e9f:	83 c4 0c             	add    $0xc,%esp
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	6a 00                	push   $0x0
+  801ea8:	e8 87 23 00 00       	call   804234 <ipc_recv>
+}
+  801ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801eb2:	83 ec 0c             	sub    $0xc,%esp
+  801eb5:	6a 02                	push   $0x2
+  801eb7:	e8 c4 24 00 00       	call   804380 <ipc_find_env>
+  801ebc:	a3 08 60 80 00       	mov    %eax,0x806008
+  801ec1:	83 c4 10             	add    $0x10,%esp
+  801ec4:	eb c6                	jmp    801e8c <nsipc+0x12>
+
+00801ec6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	56                   	push   %esi
+  801eca:	53                   	push   %ebx
+  801ecb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ed6:	8b 06                	mov    (%esi),%eax
+  801ed8:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801edd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ee2:	e8 93 ff ff ff       	call   801e7a <nsipc>
+  801ee7:	89 c3                	mov    %eax,%ebx
+  801ee9:	85 c0                	test   %eax,%eax
+  801eeb:	79 09                	jns    801ef6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801eed:	89 d8                	mov    %ebx,%eax
+  801eef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ef6:	83 ec 04             	sub    $0x4,%esp
+  801ef9:	ff 35 10 80 80 00    	push   0x808010
+  801eff:	68 00 80 80 00       	push   $0x808000
+  801f04:	ff 75 0c             	push   0xc(%ebp)
+  801f07:	e8 f4 1a 00 00       	call   803a00 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f0c:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f11:	89 06                	mov    %eax,(%esi)
+  801f13:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f16:	eb d5                	jmp    801eed <nsipc_accept+0x27>
+
+00801f18 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	53                   	push   %ebx
+  801f1c:	83 ec 08             	sub    $0x8,%esp
+  801f1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f25:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f2a:	53                   	push   %ebx
+  801f2b:	ff 75 0c             	push   0xc(%ebp)
+  801f2e:	68 04 80 80 00       	push   $0x808004
+  801f33:	e8 c8 1a 00 00       	call   803a00 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f38:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f43:	e8 32 ff ff ff       	call   801e7a <nsipc>
+}
+  801f48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f4b:	c9                   	leave
+  801f4c:	c3                   	ret
+
+00801f4d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f56:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f5e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f63:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f68:	e8 0d ff ff ff       	call   801e7a <nsipc>
+}
+  801f6d:	c9                   	leave
+  801f6e:	c3                   	ret
+
+00801f6f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f6f:	55                   	push   %ebp
+  801f70:	89 e5                	mov    %esp,%ebp
+  801f72:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f78:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f82:	e8 f3 fe ff ff       	call   801e7a <nsipc>
+}
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+00801f89 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	53                   	push   %ebx
+  801f8d:	83 ec 08             	sub    $0x8,%esp
+  801f90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f96:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f9b:	53                   	push   %ebx
+  801f9c:	ff 75 0c             	push   0xc(%ebp)
+  801f9f:	68 04 80 80 00       	push   $0x808004
+  801fa4:	e8 57 1a 00 00       	call   803a00 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fa9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801faf:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fb4:	e8 c1 fe ff ff       	call   801e7a <nsipc>
+}
+  801fb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fbc:	c9                   	leave
+  801fbd:	c3                   	ret
+
+00801fbe <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fbe:	55                   	push   %ebp
+  801fbf:	89 e5                	mov    %esp,%ebp
+  801fc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fcc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fcf:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fd4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd9:	e8 9c fe ff ff       	call   801e7a <nsipc>
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+00801fe0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	56                   	push   %esi
+  801fe4:	53                   	push   %ebx
+  801fe5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801feb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801ff0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801ff6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801ffe:	b8 07 00 00 00       	mov    $0x7,%eax
+  802003:	e8 72 fe ff ff       	call   801e7a <nsipc>
+  802008:	89 c3                	mov    %eax,%ebx
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	78 22                	js     802030 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80200e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802013:	39 c6                	cmp    %eax,%esi
+  802015:	0f 4e c6             	cmovle %esi,%eax
+  802018:	39 c3                	cmp    %eax,%ebx
+  80201a:	7f 1d                	jg     802039 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80201c:	83 ec 04             	sub    $0x4,%esp
+  80201f:	53                   	push   %ebx
+  802020:	68 00 80 80 00       	push   $0x808000
+  802025:	ff 75 0c             	push   0xc(%ebp)
+  802028:	e8 d3 19 00 00       	call   803a00 <memmove>
+  80202d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802030:	89 d8                	mov    %ebx,%eax
+  802032:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802035:	5b                   	pop    %ebx
+  802036:	5e                   	pop    %esi
+  802037:	5d                   	pop    %ebp
+  802038:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802039:	68 fc 47 80 00       	push   $0x8047fc
+  80203e:	68 b5 47 80 00       	push   $0x8047b5
+  802043:	6a 62                	push   $0x62
+  802045:	68 11 48 80 00       	push   $0x804811
+  80204a:	e8 6c 11 00 00       	call   8031bb <_panic>
+
+0080204f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	53                   	push   %ebx
+  802053:	83 ec 04             	sub    $0x4,%esp
+  802056:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802059:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802061:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802067:	7f 2e                	jg     802097 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802069:	83 ec 04             	sub    $0x4,%esp
+  80206c:	53                   	push   %ebx
+  80206d:	ff 75 0c             	push   0xc(%ebp)
+  802070:	68 0c 80 80 00       	push   $0x80800c
+  802075:	e8 86 19 00 00       	call   803a00 <memmove>
+	nsipcbuf.send.req_size = size;
+  80207a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802080:	8b 45 14             	mov    0x14(%ebp),%eax
+  802083:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802088:	b8 08 00 00 00       	mov    $0x8,%eax
+  80208d:	e8 e8 fd ff ff       	call   801e7a <nsipc>
+}
+  802092:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+	assert(size < 1600);
+  802097:	68 1d 48 80 00       	push   $0x80481d
+  80209c:	68 b5 47 80 00       	push   $0x8047b5
+  8020a1:	6a 6d                	push   $0x6d
+  8020a3:	68 11 48 80 00       	push   $0x804811
+  8020a8:	e8 0e 11 00 00       	call   8031bb <_panic>
+
+008020ad <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020be:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020c6:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020cb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020d0:	e8 a5 fd ff ff       	call   801e7a <nsipc>
+}
+  8020d5:	c9                   	leave
+  8020d6:	c3                   	ret
+
+008020d7 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	53                   	push   %ebx
+  8020db:	83 ec 10             	sub    $0x10,%esp
+  8020de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020e1:	68 0c 60 80 00       	push   $0x80600c
+  8020e6:	e8 50 07 00 00       	call   80283b <mutex_lock>
+	if (v == 0)
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 db                	test   %ebx,%ebx
+  8020f0:	0f 84 85 00 00 00    	je     80217b <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8020f6:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8020fc:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802101:	77 51                	ja     802154 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802103:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802109:	89 d8                	mov    %ebx,%eax
+  80210b:	c1 e8 0c             	shr    $0xc,%eax
+  80210e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802115:	f6 c4 02             	test   $0x2,%ah
+  802118:	74 50                	je     80216a <free+0x93>
+		sys_page_unmap(0, c);
+  80211a:	83 ec 08             	sub    $0x8,%esp
+  80211d:	53                   	push   %ebx
+  80211e:	6a 00                	push   $0x0
+  802120:	e8 4f e1 ff ff       	call   800274 <sys_page_unmap>
+		c += PGSIZE;
+  802125:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80212b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802139:	76 ce                	jbe    802109 <free+0x32>
+  80213b:	68 67 48 80 00       	push   $0x804867
+  802140:	68 b5 47 80 00       	push   $0x8047b5
+  802145:	68 82 00 00 00       	push   $0x82
+  80214a:	68 5a 48 80 00       	push   $0x80485a
+  80214f:	e8 67 10 00 00       	call   8031bb <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802154:	68 2c 48 80 00       	push   $0x80482c
+  802159:	68 b5 47 80 00       	push   $0x8047b5
+  80215e:	6a 7b                	push   $0x7b
+  802160:	68 5a 48 80 00       	push   $0x80485a
+  802165:	e8 51 10 00 00       	call   8031bb <_panic>
+	if (--(*ref) == 0)
+  80216a:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802170:	83 e8 01             	sub    $0x1,%eax
+  802173:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802179:	74 15                	je     802190 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  80217b:	83 ec 0c             	sub    $0xc,%esp
+  80217e:	68 0c 60 80 00       	push   $0x80600c
+  802183:	e8 20 07 00 00       	call   8028a8 <mutex_unlock>
+}
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+		sys_page_unmap(0, c);
+  802190:	83 ec 08             	sub    $0x8,%esp
+  802193:	53                   	push   %ebx
+  802194:	6a 00                	push   $0x0
+  802196:	e8 d9 e0 ff ff       	call   800274 <sys_page_unmap>
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	eb db                	jmp    80217b <free+0xa4>
+
+008021a0 <malloc>:
+{
+  8021a0:	55                   	push   %ebp
+  8021a1:	89 e5                	mov    %esp,%ebp
+  8021a3:	57                   	push   %edi
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021a9:	68 0c 60 80 00       	push   $0x80600c
+  8021ae:	e8 88 06 00 00       	call   80283b <mutex_lock>
+	if (mptr == 0)
+  8021b3:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	85 ff                	test   %edi,%edi
+  8021be:	74 6c                	je     80222c <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c3:	83 c0 03             	add    $0x3,%eax
+  8021c6:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021c9:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021cb:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021d0:	0f 87 64 01 00 00    	ja     80233a <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021d6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021dc:	74 30                	je     80220e <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021de:	89 f9                	mov    %edi,%ecx
+  8021e0:	c1 e9 0c             	shr    $0xc,%ecx
+  8021e3:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021e7:	c1 e8 0c             	shr    $0xc,%eax
+  8021ea:	39 c1                	cmp    %eax,%ecx
+  8021ec:	74 5f                	je     80224d <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021ee:	83 ec 0c             	sub    $0xc,%esp
+  8021f1:	57                   	push   %edi
+  8021f2:	e8 e0 fe ff ff       	call   8020d7 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8021f7:	a1 10 60 80 00       	mov    0x806010,%eax
+  8021fc:	05 00 10 00 00       	add    $0x1000,%eax
+  802201:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802206:	a3 10 60 80 00       	mov    %eax,0x806010
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802214:	ba 02 00 00 00       	mov    $0x2,%edx
+  802219:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80221d:	8d 7e 04             	lea    0x4(%esi),%edi
+  802220:	89 cb                	mov    %ecx,%ebx
+  802222:	01 f9                	add    %edi,%ecx
+  802224:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802227:	e9 8b 00 00 00       	jmp    8022b7 <malloc+0x117>
+		mptr = mbegin;
+  80222c:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802233:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802236:	8b 45 08             	mov    0x8(%ebp),%eax
+  802239:	83 c0 03             	add    $0x3,%eax
+  80223c:	83 e0 fc             	and    $0xfffffffc,%eax
+  80223f:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802241:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802246:	76 c6                	jbe    80220e <malloc+0x6e>
+  802248:	e9 d6 00 00 00       	jmp    802323 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80224d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802253:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802258:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80225c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80225f:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802264:	e9 ba 00 00 00       	jmp    802323 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802269:	05 00 10 00 00       	add    $0x1000,%eax
+  80226e:	39 c8                	cmp    %ecx,%eax
+  802270:	0f 83 cb 00 00 00    	jae    802341 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802276:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80227b:	77 22                	ja     80229f <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80227d:	89 c2                	mov    %eax,%edx
+  80227f:	c1 ea 16             	shr    $0x16,%edx
+  802282:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802289:	f6 c2 01             	test   $0x1,%dl
+  80228c:	74 db                	je     802269 <malloc+0xc9>
+  80228e:	89 c2                	mov    %eax,%edx
+  802290:	c1 ea 0c             	shr    $0xc,%edx
+  802293:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80229a:	f6 c2 01             	test   $0x1,%dl
+  80229d:	74 ca                	je     802269 <malloc+0xc9>
+		if (mptr == mend) {
+  80229f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022a5:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022ab:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022af:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022b5:	74 04                	je     8022bb <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022b7:	89 d8                	mov    %ebx,%eax
+  8022b9:	eb b3                	jmp    80226e <malloc+0xce>
+  8022bb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022be:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022c3:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022c7:	83 ea 01             	sub    $0x1,%edx
+  8022ca:	0f 85 50 ff ff ff    	jne    802220 <malloc+0x80>
+  8022d0:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022d7:	00 00 08 
+				return 0;	/* out of address space */
+  8022da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022df:	eb 42                	jmp    802323 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022e1:	85 db                	test   %ebx,%ebx
+  8022e3:	78 1e                	js     802303 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022e5:	83 ec 08             	sub    $0x8,%esp
+  8022e8:	89 d8                	mov    %ebx,%eax
+  8022ea:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022f0:	50                   	push   %eax
+  8022f1:	6a 00                	push   $0x0
+  8022f3:	e8 7c df ff ff       	call   800274 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8022f8:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8022fe:	83 c4 10             	add    $0x10,%esp
+  802301:	eb de                	jmp    8022e1 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802303:	bf 00 00 00 00       	mov    $0x0,%edi
+  802308:	eb 19                	jmp    802323 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80230a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80230d:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802313:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80231a:	00 
+	mptr += n;
+  80231b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80231e:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802323:	83 ec 0c             	sub    $0xc,%esp
+  802326:	68 0c 60 80 00       	push   $0x80600c
+  80232b:	e8 78 05 00 00       	call   8028a8 <mutex_unlock>
+}
+  802330:	89 f8                	mov    %edi,%eax
+  802332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802335:	5b                   	pop    %ebx
+  802336:	5e                   	pop    %esi
+  802337:	5f                   	pop    %edi
+  802338:	5d                   	pop    %ebp
+  802339:	c3                   	ret
+		return 0;
+  80233a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233f:	eb e2                	jmp    802323 <malloc+0x183>
+  802341:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802345:	74 06                	je     80234d <malloc+0x1ad>
+  802347:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80234d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802352:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802355:	39 fb                	cmp    %edi,%ebx
+  802357:	73 b1                	jae    80230a <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802359:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80235f:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802362:	39 fe                	cmp    %edi,%esi
+  802364:	0f 92 c0             	setb   %al
+  802367:	0f b6 c0             	movzbl %al,%eax
+  80236a:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80236d:	83 c8 07             	or     $0x7,%eax
+  802370:	50                   	push   %eax
+  802371:	89 d8                	mov    %ebx,%eax
+  802373:	03 05 10 60 80 00    	add    0x806010,%eax
+  802379:	50                   	push   %eax
+  80237a:	6a 00                	push   $0x0
+  80237c:	e8 5a de ff ff       	call   8001db <sys_page_alloc>
+  802381:	83 c4 10             	add    $0x10,%esp
+  802384:	85 c0                	test   %eax,%eax
+  802386:	0f 88 55 ff ff ff    	js     8022e1 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80238c:	89 f3                	mov    %esi,%ebx
+  80238e:	eb c5                	jmp    802355 <malloc+0x1b5>
+
+00802390 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802398:	83 ec 0c             	sub    $0xc,%esp
+  80239b:	ff 75 08             	push   0x8(%ebp)
+  80239e:	e8 ea e2 ff ff       	call   80068d <fd2data>
+  8023a3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023a5:	83 c4 08             	add    $0x8,%esp
+  8023a8:	68 7f 48 80 00       	push   $0x80487f
+  8023ad:	53                   	push   %ebx
+  8023ae:	e8 c7 14 00 00       	call   80387a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023b3:	8b 46 04             	mov    0x4(%esi),%eax
+  8023b6:	2b 06                	sub    (%esi),%eax
+  8023b8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023c5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023c8:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023cf:	52 80 00 
+	return 0;
+}
+  8023d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+
+008023de <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e3:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023e7:	85 c9                	test   %ecx,%ecx
+  8023e9:	75 01                	jne    8023ec <pipewake+0xe>
+  8023eb:	c3                   	ret
+{
+  8023ec:	55                   	push   %ebp
+  8023ed:	89 e5                	mov    %esp,%ebp
+  8023ef:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023f2:	68 00 04 00 00       	push   $0x400
+  8023f7:	52                   	push   %edx
+  8023f8:	e8 22 e1 ff ff       	call   80051f <sys_futex_wake>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+}
+  802400:	c9                   	leave
+  802401:	c3                   	ret
+
+00802402 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802402:	55                   	push   %ebp
+  802403:	89 e5                	mov    %esp,%ebp
+  802405:	56                   	push   %esi
+  802406:	53                   	push   %ebx
+  802407:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80240a:	83 ec 0c             	sub    $0xc,%esp
+  80240d:	56                   	push   %esi
+  80240e:	e8 7a e2 ff ff       	call   80068d <fd2data>
+  802413:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802415:	83 c4 08             	add    $0x8,%esp
+  802418:	56                   	push   %esi
+  802419:	6a 00                	push   $0x0
+  80241b:	e8 54 de ff ff       	call   800274 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802420:	8d 53 04             	lea    0x4(%ebx),%edx
+  802423:	8d 43 08             	lea    0x8(%ebx),%eax
+  802426:	e8 b3 ff ff ff       	call   8023de <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80242b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80242e:	89 da                	mov    %ebx,%edx
+  802430:	e8 a9 ff ff ff       	call   8023de <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802435:	89 34 24             	mov    %esi,(%esp)
+  802438:	e8 50 e2 ff ff       	call   80068d <fd2data>
+  80243d:	83 c4 08             	add    $0x8,%esp
+  802440:	50                   	push   %eax
+  802441:	6a 00                	push   $0x0
+  802443:	e8 2c de ff ff       	call   800274 <sys_page_unmap>
+}
+  802448:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244b:	5b                   	pop    %ebx
+  80244c:	5e                   	pop    %esi
+  80244d:	5d                   	pop    %ebp
+  80244e:	c3                   	ret
+
+0080244f <_pipeisclosed>:
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	57                   	push   %edi
+  802453:	56                   	push   %esi
+  802454:	53                   	push   %ebx
+  802455:	83 ec 1c             	sub    $0x1c,%esp
+  802458:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80245b:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80245d:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802462:	eb 5d                	jmp    8024c1 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802464:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  80246a:	8b 02                	mov    (%edx),%eax
+  80246c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80246f:	83 ec 0c             	sub    $0xc,%esp
+  802472:	ff 75 e0             	push   -0x20(%ebp)
+  802475:	e8 45 1f 00 00       	call   8043bf <pageref>
+  80247a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80247d:	89 3c 24             	mov    %edi,(%esp)
+  802480:	e8 3a 1f 00 00       	call   8043bf <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802485:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802487:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802496:	77 15                	ja     8024ad <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802498:	89 f2                	mov    %esi,%edx
+  80249a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80249c:	c1 ea 10             	shr    $0x10,%edx
+  80249f:	74 0c                	je     8024ad <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024a1:	c1 e2 10             	shl    $0x10,%edx
+  8024a4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024a9:	29 d1                	sub    %edx,%ecx
+  8024ab:	eb 06                	jmp    8024b3 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024ad:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024b3:	8b 11                	mov    (%ecx),%edx
+  8024b5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024b8:	39 d3                	cmp    %edx,%ebx
+  8024ba:	74 6e                	je     80252a <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024bc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024bf:	74 24                	je     8024e5 <_pipeisclosed+0x96>
+  8024c1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024c3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024c9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024ce:	77 94                	ja     802464 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024d0:	89 f0                	mov    %esi,%eax
+  8024d2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024d4:	c1 e8 10             	shr    $0x10,%eax
+  8024d7:	74 8b                	je     802464 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024d9:	c1 e0 10             	shl    $0x10,%eax
+  8024dc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024e1:	29 c2                	sub    %eax,%edx
+  8024e3:	eb 85                	jmp    80246a <_pipeisclosed+0x1b>
+  8024e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024f2:	77 18                	ja     80250c <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8024f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024fb:	c1 e8 10             	shr    $0x10,%eax
+  8024fe:	74 0c                	je     80250c <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802500:	c1 e0 10             	shl    $0x10,%eax
+  802503:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802508:	29 c2                	sub    %eax,%edx
+  80250a:	eb 06                	jmp    802512 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80250c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802512:	8b 02                	mov    (%edx),%eax
+  802514:	8b 40 58             	mov    0x58(%eax),%eax
+  802517:	6a 01                	push   $0x1
+  802519:	50                   	push   %eax
+  80251a:	53                   	push   %ebx
+  80251b:	68 86 48 80 00       	push   $0x804886
+  802520:	e8 71 0d 00 00       	call   803296 <cprintf>
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	eb 97                	jmp    8024c1 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80252a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80252d:	0f 94 c0             	sete   %al
+  802530:	0f b6 c0             	movzbl %al,%eax
+}
+  802533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802536:	5b                   	pop    %ebx
+  802537:	5e                   	pop    %esi
+  802538:	5f                   	pop    %edi
+  802539:	5d                   	pop    %ebp
+  80253a:	c3                   	ret
+
+0080253b <devpipe_write>:
+{
+  80253b:	55                   	push   %ebp
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	57                   	push   %edi
+  80253f:	56                   	push   %esi
+  802540:	53                   	push   %ebx
+  802541:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802544:	ff 75 08             	push   0x8(%ebp)
+  802547:	e8 41 e1 ff ff       	call   80068d <fd2data>
+  80254c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80254e:	83 c4 10             	add    $0x10,%esp
+  802551:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802558:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80255b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80255e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802561:	0f 84 96 00 00 00    	je     8025fd <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802567:	8d 73 08             	lea    0x8(%ebx),%esi
+  80256a:	eb 32                	jmp    80259e <devpipe_write+0x63>
+  80256c:	89 fa                	mov    %edi,%edx
+  80256e:	89 f0                	mov    %esi,%eax
+  802570:	e8 69 fe ff ff       	call   8023de <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802575:	8b 43 04             	mov    0x4(%ebx),%eax
+  802578:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80257b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802580:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802585:	83 ec 04             	sub    $0x4,%esp
+  802588:	6a 0a                	push   $0xa
+  80258a:	50                   	push   %eax
+  80258b:	53                   	push   %ebx
+  80258c:	e8 5f df ff ff       	call   8004f0 <sys_futex_wait>
+  802591:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802596:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80259b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80259e:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025a1:	8b 0b                	mov    (%ebx),%ecx
+  8025a3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025a6:	39 d0                	cmp    %edx,%eax
+  8025a8:	72 1b                	jb     8025c5 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025aa:	89 da                	mov    %ebx,%edx
+  8025ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025af:	e8 9b fe ff ff       	call   80244f <_pipeisclosed>
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	74 b4                	je     80256c <devpipe_write+0x31>
+				return 0;
+  8025b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	5e                   	pop    %esi
+  8025c2:	5f                   	pop    %edi
+  8025c3:	5d                   	pop    %ebp
+  8025c4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025cb:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025cf:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025d2:	89 c2                	mov    %eax,%edx
+  8025d4:	c1 fa 1f             	sar    $0x1f,%edx
+  8025d7:	89 d1                	mov    %edx,%ecx
+  8025d9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025dc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025df:	83 e2 1f             	and    $0x1f,%edx
+  8025e2:	29 ca                	sub    %ecx,%edx
+  8025e4:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025e8:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025ec:	83 c0 01             	add    $0x1,%eax
+  8025ef:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025f2:	83 c6 01             	add    $0x1,%esi
+  8025f5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8025f8:	e9 5e ff ff ff       	jmp    80255b <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8025fd:	8d 53 04             	lea    0x4(%ebx),%edx
+  802600:	8d 43 08             	lea    0x8(%ebx),%eax
+  802603:	e8 d6 fd ff ff       	call   8023de <pipewake>
+	return i;
+  802608:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80260b:	eb b0                	jmp    8025bd <devpipe_write+0x82>
+
+0080260d <devpipe_read>:
+{
+  80260d:	55                   	push   %ebp
+  80260e:	89 e5                	mov    %esp,%ebp
+  802610:	57                   	push   %edi
+  802611:	56                   	push   %esi
+  802612:	53                   	push   %ebx
+  802613:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802616:	ff 75 08             	push   0x8(%ebp)
+  802619:	e8 6f e0 ff ff       	call   80068d <fd2data>
+  80261e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	be 00 00 00 00       	mov    $0x0,%esi
+  802628:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80262b:	74 6c                	je     802699 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80262d:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802630:	eb 25                	jmp    802657 <devpipe_read+0x4a>
+  802632:	8b 13                	mov    (%ebx),%edx
+  802634:	b8 01 00 00 00       	mov    $0x1,%eax
+  802639:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80263e:	83 ec 04             	sub    $0x4,%esp
+  802641:	6a 0a                	push   $0xa
+  802643:	52                   	push   %edx
+  802644:	57                   	push   %edi
+  802645:	e8 a6 de ff ff       	call   8004f0 <sys_futex_wait>
+  80264a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80264f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  802654:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  802657:	8b 03                	mov    (%ebx),%eax
+  802659:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80265c:	75 19                	jne    802677 <devpipe_read+0x6a>
+			if (i > 0)
+  80265e:	85 f6                	test   %esi,%esi
+  802660:	75 3a                	jne    80269c <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  802662:	89 da                	mov    %ebx,%edx
+  802664:	8b 45 08             	mov    0x8(%ebp),%eax
+  802667:	e8 e3 fd ff ff       	call   80244f <_pipeisclosed>
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	74 c2                	je     802632 <devpipe_read+0x25>
+				return 0;
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+  802675:	eb 31                	jmp    8026a8 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802677:	89 c1                	mov    %eax,%ecx
+  802679:	c1 f9 1f             	sar    $0x1f,%ecx
+  80267c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80267f:	01 c8                	add    %ecx,%eax
+  802681:	83 e0 1f             	and    $0x1f,%eax
+  802684:	29 c8                	sub    %ecx,%eax
+  802686:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80268b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80268e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802691:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802694:	83 c6 01             	add    $0x1,%esi
+  802697:	eb 8f                	jmp    802628 <devpipe_read+0x1b>
+out:
+  802699:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80269c:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80269f:	89 da                	mov    %ebx,%edx
+  8026a1:	e8 38 fd ff ff       	call   8023de <pipewake>
+	return i;
+  8026a6:	89 f0                	mov    %esi,%eax
+}
+  8026a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ab:	5b                   	pop    %ebx
+  8026ac:	5e                   	pop    %esi
+  8026ad:	5f                   	pop    %edi
+  8026ae:	5d                   	pop    %ebp
+  8026af:	c3                   	ret
+
+008026b0 <pipe>:
+{
+  8026b0:	55                   	push   %ebp
+  8026b1:	89 e5                	mov    %esp,%ebp
+  8026b3:	56                   	push   %esi
+  8026b4:	53                   	push   %ebx
+  8026b5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026bb:	50                   	push   %eax
+  8026bc:	e8 e3 df ff ff       	call   8006a4 <fd_alloc>
+  8026c1:	89 c3                	mov    %eax,%ebx
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	85 c0                	test   %eax,%eax
+  8026c8:	0f 88 23 01 00 00    	js     8027f1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ce:	83 ec 04             	sub    $0x4,%esp
+  8026d1:	68 07 04 00 00       	push   $0x407
+  8026d6:	ff 75 f4             	push   -0xc(%ebp)
+  8026d9:	6a 00                	push   $0x0
+  8026db:	e8 fb da ff ff       	call   8001db <sys_page_alloc>
+  8026e0:	89 c3                	mov    %eax,%ebx
+  8026e2:	83 c4 10             	add    $0x10,%esp
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	0f 88 04 01 00 00    	js     8027f1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026ed:	83 ec 0c             	sub    $0xc,%esp
+  8026f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026f3:	50                   	push   %eax
+  8026f4:	e8 ab df ff ff       	call   8006a4 <fd_alloc>
+  8026f9:	89 c3                	mov    %eax,%ebx
+  8026fb:	83 c4 10             	add    $0x10,%esp
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	0f 88 db 00 00 00    	js     8027e1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802706:	83 ec 04             	sub    $0x4,%esp
+  802709:	68 07 04 00 00       	push   $0x407
+  80270e:	ff 75 f0             	push   -0x10(%ebp)
+  802711:	6a 00                	push   $0x0
+  802713:	e8 c3 da ff ff       	call   8001db <sys_page_alloc>
+  802718:	89 c3                	mov    %eax,%ebx
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	0f 88 bc 00 00 00    	js     8027e1 <pipe+0x131>
+	va = fd2data(fd0);
+  802725:	83 ec 0c             	sub    $0xc,%esp
+  802728:	ff 75 f4             	push   -0xc(%ebp)
+  80272b:	e8 5d df ff ff       	call   80068d <fd2data>
+  802730:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802732:	83 c4 0c             	add    $0xc,%esp
+  802735:	68 07 04 00 00       	push   $0x407
+  80273a:	50                   	push   %eax
+  80273b:	6a 00                	push   $0x0
+  80273d:	e8 99 da ff ff       	call   8001db <sys_page_alloc>
+  802742:	89 c3                	mov    %eax,%ebx
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	0f 88 82 00 00 00    	js     8027d1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80274f:	83 ec 0c             	sub    $0xc,%esp
+  802752:	ff 75 f0             	push   -0x10(%ebp)
+  802755:	e8 33 df ff ff       	call   80068d <fd2data>
+  80275a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802761:	50                   	push   %eax
+  802762:	6a 00                	push   $0x0
+  802764:	56                   	push   %esi
+  802765:	6a 00                	push   $0x0
+  802767:	e8 bc da ff ff       	call   800228 <sys_page_map>
+  80276c:	89 c3                	mov    %eax,%ebx
+  80276e:	83 c4 20             	add    $0x20,%esp
+  802771:	85 c0                	test   %eax,%eax
+  802773:	78 4e                	js     8027c3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802775:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80277a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80277f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802782:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802789:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80278c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80278e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802791:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802798:	83 ec 0c             	sub    $0xc,%esp
+  80279b:	ff 75 f4             	push   -0xc(%ebp)
+  80279e:	e8 da de ff ff       	call   80067d <fd2num>
+  8027a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a8:	83 c4 04             	add    $0x4,%esp
+  8027ab:	ff 75 f0             	push   -0x10(%ebp)
+  8027ae:	e8 ca de ff ff       	call   80067d <fd2num>
+  8027b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b9:	83 c4 10             	add    $0x10,%esp
+  8027bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c1:	eb 2e                	jmp    8027f1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027c3:	83 ec 08             	sub    $0x8,%esp
+  8027c6:	56                   	push   %esi
+  8027c7:	6a 00                	push   $0x0
+  8027c9:	e8 a6 da ff ff       	call   800274 <sys_page_unmap>
+  8027ce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027d1:	83 ec 08             	sub    $0x8,%esp
+  8027d4:	ff 75 f0             	push   -0x10(%ebp)
+  8027d7:	6a 00                	push   $0x0
+  8027d9:	e8 96 da ff ff       	call   800274 <sys_page_unmap>
+  8027de:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027e1:	83 ec 08             	sub    $0x8,%esp
+  8027e4:	ff 75 f4             	push   -0xc(%ebp)
+  8027e7:	6a 00                	push   $0x0
+  8027e9:	e8 86 da ff ff       	call   800274 <sys_page_unmap>
+  8027ee:	83 c4 10             	add    $0x10,%esp
+}
+  8027f1:	89 d8                	mov    %ebx,%eax
+  8027f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f6:	5b                   	pop    %ebx
+  8027f7:	5e                   	pop    %esi
+  8027f8:	5d                   	pop    %ebp
+  8027f9:	c3                   	ret
+
+008027fa <pipeisclosed>:
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802800:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802803:	50                   	push   %eax
+  802804:	ff 75 08             	push   0x8(%ebp)
+  802807:	e8 ee de ff ff       	call   8006fa <fd_lookup>
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 18                	js     80282b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802813:	83 ec 0c             	sub    $0xc,%esp
+  802816:	ff 75 f4             	push   -0xc(%ebp)
+  802819:	e8 6f de ff ff       	call   80068d <fd2data>
+  80281e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802820:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802823:	e8 27 fc ff ff       	call   80244f <_pipeisclosed>
+  802828:	83 c4 10             	add    $0x10,%esp
+}
+  80282b:	c9                   	leave
+  80282c:	c3                   	ret
+
+0080282d <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802830:	8b 45 08             	mov    0x8(%ebp),%eax
+  802833:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802839:	5d                   	pop    %ebp
+  80283a:	c3                   	ret
+
+0080283b <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80283b:	55                   	push   %ebp
+  80283c:	89 e5                	mov    %esp,%ebp
+  80283e:	56                   	push   %esi
+  80283f:	53                   	push   %ebx
+  802840:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802843:	ba 00 00 00 00       	mov    $0x0,%edx
+  802848:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80284d:	89 d0                	mov    %edx,%eax
+  80284f:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  802853:	85 c0                	test   %eax,%eax
+  802855:	74 2d                	je     802884 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  802857:	83 f8 02             	cmp    $0x2,%eax
+  80285a:	74 08                	je     802864 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80285c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802861:	f0 87 03             	lock xchg %eax,(%ebx)
+  802864:	be 02 00 00 00       	mov    $0x2,%esi
+  802869:	eb 15                	jmp    802880 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80286b:	83 ec 04             	sub    $0x4,%esp
+  80286e:	6a 00                	push   $0x0
+  802870:	6a 02                	push   $0x2
+  802872:	53                   	push   %ebx
+  802873:	e8 78 dc ff ff       	call   8004f0 <sys_futex_wait>
+  802878:	89 f0                	mov    %esi,%eax
+  80287a:	f0 87 03             	lock xchg %eax,(%ebx)
+  80287d:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802880:	85 c0                	test   %eax,%eax
+  802882:	75 e7                	jne    80286b <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  802884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802887:	5b                   	pop    %ebx
+  802888:	5e                   	pop    %esi
+  802889:	5d                   	pop    %ebp
+  80288a:	c3                   	ret
+
+0080288b <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80288b:	55                   	push   %ebp
+  80288c:	89 e5                	mov    %esp,%ebp
+  80288e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80289b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80289f:	f7 d8                	neg    %eax
+  8028a1:	19 c0                	sbb    %eax,%eax
+  8028a3:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8028a6:	5d                   	pop    %ebp
+  8028a7:	c3                   	ret
+
+008028a8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028a8:	55                   	push   %ebp
+  8028a9:	89 e5                	mov    %esp,%ebp
+  8028ab:	83 ec 08             	sub    $0x8,%esp
+  8028ae:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028b9:	83 f8 02             	cmp    $0x2,%eax
+  8028bc:	74 02                	je     8028c0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028c0:	83 ec 08             	sub    $0x8,%esp
+  8028c3:	6a 01                	push   $0x1
+  8028c5:	52                   	push   %edx
+  8028c6:	e8 54 dc ff ff       	call   80051f <sys_futex_wake>
+  8028cb:	83 c4 10             	add    $0x10,%esp
+}
+  8028ce:	eb ee                	jmp    8028be <mutex_unlock+0x16>
+
+008028d0 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028d0:	55                   	push   %ebp
+  8028d1:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028dc:	5d                   	pop    %ebp
+  8028dd:	c3                   	ret
+
+008028de <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028de:	55                   	push   %ebp
+  8028df:	89 e5                	mov    %esp,%ebp
+  8028e1:	57                   	push   %edi
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	83 ec 18             	sub    $0x18,%esp
+  8028e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028ed:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028ef:	53                   	push   %ebx
+  8028f0:	e8 b3 ff ff ff       	call   8028a8 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8028f5:	83 c4 0c             	add    $0xc,%esp
+  8028f8:	ff 75 10             	push   0x10(%ebp)
+  8028fb:	57                   	push   %edi
+  8028fc:	56                   	push   %esi
+  8028fd:	e8 ee db ff ff       	call   8004f0 <sys_futex_wait>
+  802902:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  802904:	83 c4 10             	add    $0x10,%esp
+  802907:	be 02 00 00 00       	mov    $0x2,%esi
+  80290c:	eb 10                	jmp    80291e <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80290e:	83 ec 04             	sub    $0x4,%esp
+  802911:	6a 00                	push   $0x0
+  802913:	6a 02                	push   $0x2
+  802915:	53                   	push   %ebx
+  802916:	e8 d5 db ff ff       	call   8004f0 <sys_futex_wait>
+  80291b:	83 c4 10             	add    $0x10,%esp
+  80291e:	89 f0                	mov    %esi,%eax
+  802920:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  802923:	85 c0                	test   %eax,%eax
+  802925:	75 e7                	jne    80290e <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  802927:	83 ff ec             	cmp    $0xffffffec,%edi
+  80292a:	74 05                	je     802931 <cond_timedwait+0x53>
+  80292c:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802931:	89 f8                	mov    %edi,%eax
+  802933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802936:	5b                   	pop    %ebx
+  802937:	5e                   	pop    %esi
+  802938:	5f                   	pop    %edi
+  802939:	5d                   	pop    %ebp
+  80293a:	c3                   	ret
+
+0080293b <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80293b:	55                   	push   %ebp
+  80293c:	89 e5                	mov    %esp,%ebp
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802941:	6a 00                	push   $0x0
+  802943:	ff 75 0c             	push   0xc(%ebp)
+  802946:	ff 75 08             	push   0x8(%ebp)
+  802949:	e8 90 ff ff ff       	call   8028de <cond_timedwait>
+}
+  80294e:	83 c4 10             	add    $0x10,%esp
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+00802953 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	83 ec 10             	sub    $0x10,%esp
+  802959:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80295c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802961:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  802965:	6a 01                	push   $0x1
+  802967:	50                   	push   %eax
+  802968:	e8 b2 db ff ff       	call   80051f <sys_futex_wake>
+}
+  80296d:	83 c4 10             	add    $0x10,%esp
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+
+00802972 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802972:	55                   	push   %ebp
+  802973:	89 e5                	mov    %esp,%ebp
+  802975:	83 ec 10             	sub    $0x10,%esp
+  802978:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802980:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  802984:	68 00 04 00 00       	push   $0x400
+  802989:	50                   	push   %eax
+  80298a:	e8 90 db ff ff       	call   80051f <sys_futex_wake>
+}
+  80298f:	83 c4 10             	add    $0x10,%esp
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+00802994 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80299a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80299d:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80299f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8029a6:	5d                   	pop    %ebp
+  8029a7:	c3                   	ret
+
+008029a8 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	53                   	push   %ebx
+  8029ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029af:	8b 11                	mov    (%ecx),%edx
+  8029b1:	85 d2                	test   %edx,%edx
+  8029b3:	74 14                	je     8029c9 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029b5:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029b8:	89 d0                	mov    %edx,%eax
+  8029ba:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029be:	39 c2                	cmp    %eax,%edx
+  8029c0:	75 ed                	jne    8029af <sem_trywait+0x7>
+			return 0;
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c7:	eb 05                	jmp    8029ce <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029c9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029d1:	c9                   	leave
+  8029d2:	c3                   	ret
+
+008029d3 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029d3:	55                   	push   %ebp
+  8029d4:	89 e5                	mov    %esp,%ebp
+  8029d6:	57                   	push   %edi
+  8029d7:	56                   	push   %esi
+  8029d8:	53                   	push   %ebx
+  8029d9:	83 ec 1c             	sub    $0x1c,%esp
+  8029dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029e2:	e8 81 da ff ff       	call   800468 <sys_time_msec>
+  8029e7:	01 f8                	add    %edi,%eax
+  8029e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029ec:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029f1:	eb 28                	jmp    802a1b <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f8:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	56                   	push   %esi
+  802a01:	6a 00                	push   $0x0
+  802a03:	53                   	push   %ebx
+  802a04:	e8 e7 da ff ff       	call   8004f0 <sys_futex_wait>
+  802a09:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a0e:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a13:	83 c4 10             	add    $0x10,%esp
+  802a16:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a19:	74 2e                	je     802a49 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a1b:	83 ec 0c             	sub    $0xc,%esp
+  802a1e:	53                   	push   %ebx
+  802a1f:	e8 84 ff ff ff       	call   8029a8 <sem_trywait>
+  802a24:	83 c4 10             	add    $0x10,%esp
+  802a27:	85 c0                	test   %eax,%eax
+  802a29:	79 19                	jns    802a44 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a2b:	85 ff                	test   %edi,%edi
+  802a2d:	74 c4                	je     8029f3 <sem_timedwait+0x20>
+  802a2f:	e8 34 da ff ff       	call   800468 <sys_time_msec>
+  802a34:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a37:	29 c6                	sub    %eax,%esi
+  802a39:	85 f6                	test   %esi,%esi
+  802a3b:	7f b6                	jg     8029f3 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a3d:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a42:	eb 05                	jmp    802a49 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4c:	5b                   	pop    %ebx
+  802a4d:	5e                   	pop    %esi
+  802a4e:	5f                   	pop    %edi
+  802a4f:	5d                   	pop    %ebp
+  802a50:	c3                   	ret
+
+00802a51 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a57:	6a 00                	push   $0x0
+  802a59:	ff 75 08             	push   0x8(%ebp)
+  802a5c:	e8 72 ff ff ff       	call   8029d3 <sem_timedwait>
+}
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+
+00802a66 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a66:	55                   	push   %ebp
+  802a67:	89 e5                	mov    %esp,%ebp
+  802a69:	83 ec 08             	sub    $0x8,%esp
+  802a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a74:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a78:	8b 50 04             	mov    0x4(%eax),%edx
+  802a7b:	85 d2                	test   %edx,%edx
+  802a7d:	75 02                	jne    802a81 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a81:	83 ec 08             	sub    $0x8,%esp
+  802a84:	6a 01                	push   $0x1
+  802a86:	50                   	push   %eax
+  802a87:	e8 93 da ff ff       	call   80051f <sys_futex_wake>
+  802a8c:	83 c4 10             	add    $0x10,%esp
+}
+  802a8f:	eb ee                	jmp    802a7f <sem_post+0x19>
+
+00802a91 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a91:	55                   	push   %ebp
+  802a92:	89 e5                	mov    %esp,%ebp
+  802a94:	57                   	push   %edi
+  802a95:	56                   	push   %esi
+  802a96:	53                   	push   %ebx
+  802a97:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802a9a:	68 20 60 80 00       	push   $0x806020
+  802a9f:	e8 97 fd ff ff       	call   80283b <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802aa4:	a1 44 60 80 00       	mov    0x806044,%eax
+  802aa9:	83 c4 10             	add    $0x10,%esp
+  802aac:	85 c0                	test   %eax,%eax
+  802aae:	75 19                	jne    802ac9 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802ab0:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802ab5:	8b 00                	mov    (%eax),%eax
+  802ab7:	8b 40 48             	mov    0x48(%eax),%eax
+  802aba:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802abf:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802ac6:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ac9:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ace:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ad1:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ad8:	8b 40 04             	mov    0x4(%eax),%eax
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	0f 84 e4 00 00 00    	je     802bc7 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ae3:	83 c3 01             	add    $0x1,%ebx
+  802ae6:	83 fb 20             	cmp    $0x20,%ebx
+  802ae9:	75 e3                	jne    802ace <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802aeb:	83 ec 0c             	sub    $0xc,%esp
+  802aee:	68 20 60 80 00       	push   $0x806020
+  802af3:	e8 b0 fd ff ff       	call   8028a8 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802b00:	e9 b8 00 00 00       	jmp    802bbd <pthread_create+0x12c>
+  802b05:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b08:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b0b:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b0d:	39 f3                	cmp    %esi,%ebx
+  802b0f:	73 16                	jae    802b27 <pthread_create+0x96>
+		va -= PGSIZE;
+  802b11:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b17:	83 ec 08             	sub    $0x8,%esp
+  802b1a:	56                   	push   %esi
+  802b1b:	6a 00                	push   $0x0
+  802b1d:	e8 52 d7 ff ff       	call   800274 <sys_page_unmap>
+  802b22:	83 c4 10             	add    $0x10,%esp
+  802b25:	eb e6                	jmp    802b0d <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b27:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+  802b2d:	ff 75 e4             	push   -0x1c(%ebp)
+  802b30:	6a 00                	push   $0x0
+  802b32:	e8 3d d7 ff ff       	call   800274 <sys_page_unmap>
+	return r;
+  802b37:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b3a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b3d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b44:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b4b:	eb 70                	jmp    802bbd <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b4d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b50:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b5a:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b5d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b60:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b63:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b6a:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b6f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b72:	29 c8                	sub    %ecx,%eax
+  802b74:	85 db                	test   %ebx,%ebx
+  802b76:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b7d:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b80:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b87:	83 ec 04             	sub    $0x4,%esp
+  802b8a:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b8f:	29 ca                	sub    %ecx,%edx
+  802b91:	52                   	push   %edx
+	*--esp = 0;
+  802b92:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b95:	50                   	push   %eax
+  802b96:	68 ee 2d 80 00       	push   $0x802dee
+  802b9b:	e8 24 da ff ff       	call   8005c4 <sys_thread_create>
+  802ba0:	89 c7                	mov    %eax,%edi
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	78 91                	js     802b3a <pthread_create+0xa9>
+	th->th_env = id;
+  802ba9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bac:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb6:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bb8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bbd:	89 f8                	mov    %edi,%eax
+  802bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5f                   	pop    %edi
+  802bc5:	5d                   	pop    %ebp
+  802bc6:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bc7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bca:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bd1:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802bd8:	83 ec 0c             	sub    $0xc,%esp
+  802bdb:	68 20 60 80 00       	push   $0x806020
+  802be0:	e8 c3 fc ff ff       	call   8028a8 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802be5:	89 d9                	mov    %ebx,%ecx
+  802be7:	c1 e1 10             	shl    $0x10,%ecx
+  802bea:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802bed:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802bf2:	29 c8                	sub    %ecx,%eax
+  802bf4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802bf7:	c1 e8 16             	shr    $0x16,%eax
+  802bfa:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c01:	83 c4 10             	add    $0x10,%esp
+  802c04:	a8 01                	test   $0x1,%al
+  802c06:	74 15                	je     802c1d <pthread_create+0x18c>
+  802c08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c0b:	c1 e8 0c             	shr    $0xc,%eax
+  802c0e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c15:	a8 01                	test   $0x1,%al
+  802c17:	0f 85 30 ff ff ff    	jne    802b4d <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c1d:	83 ec 04             	sub    $0x4,%esp
+  802c20:	6a 07                	push   $0x7
+  802c22:	ff 75 e4             	push   -0x1c(%ebp)
+  802c25:	6a 00                	push   $0x0
+  802c27:	e8 af d5 ff ff       	call   8001db <sys_page_alloc>
+  802c2c:	89 c7                	mov    %eax,%edi
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	0f 88 01 ff ff ff    	js     802b3a <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c39:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c3e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c41:	29 d0                	sub    %edx,%eax
+  802c43:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c46:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c48:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c4d:	29 d0                	sub    %edx,%eax
+  802c4f:	89 c7                	mov    %eax,%edi
+  802c51:	39 fe                	cmp    %edi,%esi
+  802c53:	0f 83 f4 fe ff ff    	jae    802b4d <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c59:	83 ec 04             	sub    $0x4,%esp
+  802c5c:	6a 07                	push   $0x7
+  802c5e:	56                   	push   %esi
+  802c5f:	6a 00                	push   $0x0
+  802c61:	e8 75 d5 ff ff       	call   8001db <sys_page_alloc>
+  802c66:	83 c4 10             	add    $0x10,%esp
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	0f 88 94 fe ff ff    	js     802b05 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c71:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c77:	eb d8                	jmp    802c51 <pthread_create+0x1c0>
+
+00802c79 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c79:	55                   	push   %ebp
+  802c7a:	89 e5                	mov    %esp,%ebp
+  802c7c:	57                   	push   %edi
+  802c7d:	56                   	push   %esi
+  802c7e:	53                   	push   %ebx
+  802c7f:	83 ec 0c             	sub    $0xc,%esp
+  802c82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c85:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c88:	83 f8 1e             	cmp    $0x1e,%eax
+  802c8b:	0f 87 c7 00 00 00    	ja     802d58 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c91:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c93:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802c99:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802c9e:	77 12                	ja     802cb2 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ca0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802ca5:	29 d0                	sub    %edx,%eax
+  802ca7:	c1 e8 10             	shr    $0x10,%eax
+  802caa:	39 c3                	cmp    %eax,%ebx
+  802cac:	0f 84 ad 00 00 00    	je     802d5f <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cb2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cb5:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cbc:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cc3:	eb 10                	jmp    802cd5 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cc5:	83 ec 04             	sub    $0x4,%esp
+  802cc8:	6a 00                	push   $0x0
+  802cca:	6a 01                	push   $0x1
+  802ccc:	57                   	push   %edi
+  802ccd:	e8 1e d8 ff ff       	call   8004f0 <sys_futex_wait>
+  802cd2:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cd5:	8b 46 04             	mov    0x4(%esi),%eax
+  802cd8:	83 f8 01             	cmp    $0x1,%eax
+  802cdb:	74 e8                	je     802cc5 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802cdd:	83 f8 02             	cmp    $0x2,%eax
+  802ce0:	0f 85 80 00 00 00    	jne    802d66 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802ce6:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802ce9:	c1 e6 02             	shl    $0x2,%esi
+  802cec:	eb 05                	jmp    802cf3 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802cee:	e8 bc d4 ff ff       	call   8001af <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cf3:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802cf9:	89 ca                	mov    %ecx,%edx
+  802cfb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802d01:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d04:	c1 e0 04             	shl    $0x4,%eax
+  802d07:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d0c:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d0f:	39 c1                	cmp    %eax,%ecx
+  802d11:	75 12                	jne    802d25 <pthread_join+0xac>
+  802d13:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d16:	c1 e0 04             	shl    $0x4,%eax
+  802d19:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d1e:	8b 40 54             	mov    0x54(%eax),%eax
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	75 c9                	jne    802cee <pthread_join+0x75>
+	if (ret_store)
+  802d25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d29:	74 0f                	je     802d3a <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d2b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d2e:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d35:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d38:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d3a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d3d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d44:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d53:	5b                   	pop    %ebx
+  802d54:	5e                   	pop    %esi
+  802d55:	5f                   	pop    %edi
+  802d56:	5d                   	pop    %ebp
+  802d57:	c3                   	ret
+		return -E_INVAL;
+  802d58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5d:	eb f1                	jmp    802d50 <pthread_join+0xd7>
+  802d5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d64:	eb ea                	jmp    802d50 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6b:	eb e3                	jmp    802d50 <pthread_join+0xd7>
+
+00802d6d <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d6d:	55                   	push   %ebp
+  802d6e:	89 e5                	mov    %esp,%ebp
+  802d70:	53                   	push   %ebx
+  802d71:	83 ec 04             	sub    $0x4,%esp
+  802d74:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d76:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d7c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d81:	77 0c                	ja     802d8f <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d83:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d88:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d8a:	c1 e8 10             	shr    $0x10,%eax
+  802d8d:	75 0a                	jne    802d99 <pthread_exit+0x2c>
+		exit();
+  802d8f:	e8 25 d3 ff ff       	call   8000b9 <exit>
+  802d94:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802d99:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802da0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802da3:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802daa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dad:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802db0:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802db7:	83 ec 08             	sub    $0x8,%esp
+  802dba:	6a 20                	push   $0x20
+  802dbc:	01 c2                	add    %eax,%edx
+  802dbe:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dc5:	50                   	push   %eax
+  802dc6:	e8 54 d7 ff ff       	call   80051f <sys_futex_wake>
+	sys_env_destroy(0);
+  802dcb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802dd2:	e8 61 d3 ff ff       	call   800138 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802dd7:	83 c4 0c             	add    $0xc,%esp
+  802dda:	68 9e 48 80 00       	push   $0x80489e
+  802ddf:	68 a5 00 00 00       	push   $0xa5
+  802de4:	68 b8 48 80 00       	push   $0x8048b8
+  802de9:	e8 cd 03 00 00       	call   8031bb <_panic>
+
+00802dee <pthread_start>:
+{
+  802dee:	55                   	push   %ebp
+  802def:	89 e5                	mov    %esp,%ebp
+  802df1:	53                   	push   %ebx
+  802df2:	83 ec 04             	sub    $0x4,%esp
+  802df5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802df8:	e8 86 d3 ff ff       	call   800183 <sys_getenvid>
+  802dfd:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802e02:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e08:	85 db                	test   %ebx,%ebx
+  802e0a:	74 0c                	je     802e18 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e0c:	89 d9                	mov    %ebx,%ecx
+  802e0e:	c1 e1 10             	shl    $0x10,%ecx
+  802e11:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e16:	29 ca                	sub    %ecx,%edx
+  802e18:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e1b:	c1 e0 04             	shl    $0x4,%eax
+  802e1e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e23:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e25:	83 ec 0c             	sub    $0xc,%esp
+  802e28:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e2f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e32:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e39:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e40:	89 04 24             	mov    %eax,(%esp)
+  802e43:	e8 25 ff ff ff       	call   802d6d <pthread_exit>
+
+00802e48 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e48:	55                   	push   %ebp
+  802e49:	89 e5                	mov    %esp,%ebp
+  802e4b:	57                   	push   %edi
+  802e4c:	56                   	push   %esi
+  802e4d:	53                   	push   %ebx
+  802e4e:	83 ec 1c             	sub    $0x1c,%esp
+  802e51:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e53:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e59:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e60:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e65:	77 0d                	ja     802e74 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e67:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e6c:	29 d0                	sub    %edx,%eax
+  802e6e:	c1 e8 10             	shr    $0x10,%eax
+  802e71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e79:	eb 2f                	jmp    802eaa <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e7b:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e81:	8b 01                	mov    (%ecx),%eax
+  802e83:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e86:	39 c2                	cmp    %eax,%edx
+  802e88:	75 14                	jne    802e9e <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e8a:	83 ec 0c             	sub    $0xc,%esp
+  802e8d:	57                   	push   %edi
+  802e8e:	e8 a5 d2 ff ff       	call   800138 <sys_env_destroy>
+  802e93:	83 c4 10             	add    $0x10,%esp
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	0f 88 97 00 00 00    	js     802f35 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e9e:	83 c3 01             	add    $0x1,%ebx
+  802ea1:	83 fb 20             	cmp    $0x20,%ebx
+  802ea4:	0f 84 d2 00 00 00    	je     802f7c <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802eaa:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ead:	74 ef                	je     802e9e <pthread_kill_others+0x56>
+  802eaf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802eb2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802eb9:	8b 40 04             	mov    0x4(%eax),%eax
+  802ebc:	83 f8 01             	cmp    $0x1,%eax
+  802ebf:	75 dd                	jne    802e9e <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802ec1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ec4:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ecb:	89 fe                	mov    %edi,%esi
+  802ecd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ed3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ed6:	c1 e0 04             	shl    $0x4,%eax
+  802ed9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ede:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ee1:	39 c7                	cmp    %eax,%edi
+  802ee3:	75 b9                	jne    802e9e <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ee5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ee8:	c1 e0 04             	shl    $0x4,%eax
+  802eeb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ef0:	8b 40 54             	mov    0x54(%eax),%eax
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	74 a7                	je     802e9e <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ef7:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802efa:	c1 e0 04             	shl    $0x4,%eax
+  802efd:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802f03:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f05:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f0b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f10:	0f 87 65 ff ff ff    	ja     802e7b <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f16:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f1b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f1d:	c1 e8 10             	shr    $0x10,%eax
+  802f20:	0f 84 55 ff ff ff    	je     802e7b <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f26:	c1 e0 10             	shl    $0x10,%eax
+  802f29:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f2e:	29 c1                	sub    %eax,%ecx
+  802f30:	e9 4c ff ff ff       	jmp    802e81 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f35:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f38:	c1 e2 04             	shl    $0x4,%edx
+  802f3b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f41:	8b 52 48             	mov    0x48(%edx),%edx
+  802f44:	39 fa                	cmp    %edi,%edx
+  802f46:	0f 85 52 ff ff ff    	jne    802e9e <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f4c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f4f:	c1 e2 04             	shl    $0x4,%edx
+  802f52:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f58:	8b 52 54             	mov    0x54(%edx),%edx
+  802f5b:	85 d2                	test   %edx,%edx
+  802f5d:	0f 84 3b ff ff ff    	je     802e9e <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f63:	83 ec 0c             	sub    $0xc,%esp
+  802f66:	50                   	push   %eax
+  802f67:	57                   	push   %edi
+  802f68:	68 c8 48 80 00       	push   $0x8048c8
+  802f6d:	68 bb 00 00 00       	push   $0xbb
+  802f72:	68 b8 48 80 00       	push   $0x8048b8
+  802f77:	e8 3f 02 00 00       	call   8031bb <_panic>
+	}
+}
+  802f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f7f:	5b                   	pop    %ebx
+  802f80:	5e                   	pop    %esi
+  802f81:	5f                   	pop    %edi
+  802f82:	5d                   	pop    %ebp
+  802f83:	c3                   	ret
+
+00802f84 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f84:	55                   	push   %ebp
+  802f85:	89 e5                	mov    %esp,%ebp
+  802f87:	53                   	push   %ebx
+  802f88:	83 ec 04             	sub    $0x4,%esp
+  802f8b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f8d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f93:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f99:	0f 87 85 00 00 00    	ja     803024 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f9f:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802fa4:	29 c3                	sub    %eax,%ebx
+  802fa6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fa9:	83 ec 04             	sub    $0x4,%esp
+  802fac:	68 80 02 00 00       	push   $0x280
+  802fb1:	6a 00                	push   $0x0
+  802fb3:	68 40 60 80 00       	push   $0x806040
+  802fb8:	e8 0e 0a 00 00       	call   8039cb <memset>
+	threads_mu.m_state = 0;
+  802fbd:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fc4:	00 00 00 
+	if (self != 0) {
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	85 db                	test   %ebx,%ebx
+  802fcc:	74 51                	je     80301f <pthread_fork_child+0x9b>
+  802fce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fd0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fd6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fdb:	77 18                	ja     802ff5 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fdd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fe2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fe4:	c1 e8 10             	shr    $0x10,%eax
+  802fe7:	74 0c                	je     802ff5 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fe9:	c1 e0 10             	shl    $0x10,%eax
+  802fec:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802ff1:	29 c2                	sub    %eax,%edx
+  802ff3:	eb 06                	jmp    802ffb <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  802ff5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  802ffb:	8b 02                	mov    (%edx),%eax
+  802ffd:	8b 48 48             	mov    0x48(%eax),%ecx
+  803000:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803007:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80300a:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803011:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803018:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80301f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803022:	c9                   	leave
+  803023:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803024:	83 ec 04             	sub    $0x4,%esp
+  803027:	68 80 02 00 00       	push   $0x280
+  80302c:	6a 00                	push   $0x0
+  80302e:	68 40 60 80 00       	push   $0x806040
+  803033:	e8 93 09 00 00       	call   8039cb <memset>
+	threads_mu.m_state = 0;
+  803038:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80303f:	00 00 00 
+  803042:	83 c4 10             	add    $0x10,%esp
+  803045:	eb d8                	jmp    80301f <pthread_fork_child+0x9b>
+
+00803047 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	c3                   	ret
+
+0080304d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80304d:	55                   	push   %ebp
+  80304e:	89 e5                	mov    %esp,%ebp
+  803050:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803053:	68 ed 48 80 00       	push   $0x8048ed
+  803058:	ff 75 0c             	push   0xc(%ebp)
+  80305b:	e8 1a 08 00 00       	call   80387a <strcpy>
+	return 0;
+}
+  803060:	b8 00 00 00 00       	mov    $0x0,%eax
+  803065:	c9                   	leave
+  803066:	c3                   	ret
+
+00803067 <devcons_write>:
+{
+  803067:	55                   	push   %ebp
+  803068:	89 e5                	mov    %esp,%ebp
+  80306a:	57                   	push   %edi
+  80306b:	56                   	push   %esi
+  80306c:	53                   	push   %ebx
+  80306d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803073:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803078:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80307e:	eb 2e                	jmp    8030ae <devcons_write+0x47>
+		m = n - tot;
+  803080:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803083:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803085:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80308a:	39 c3                	cmp    %eax,%ebx
+  80308c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80308f:	83 ec 04             	sub    $0x4,%esp
+  803092:	53                   	push   %ebx
+  803093:	89 f0                	mov    %esi,%eax
+  803095:	03 45 0c             	add    0xc(%ebp),%eax
+  803098:	50                   	push   %eax
+  803099:	57                   	push   %edi
+  80309a:	e8 61 09 00 00       	call   803a00 <memmove>
+		sys_cputs(buf, m);
+  80309f:	83 c4 08             	add    $0x8,%esp
+  8030a2:	53                   	push   %ebx
+  8030a3:	57                   	push   %edi
+  8030a4:	e8 38 d0 ff ff       	call   8000e1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030a9:	01 de                	add    %ebx,%esi
+  8030ab:	83 c4 10             	add    $0x10,%esp
+  8030ae:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030b1:	72 cd                	jb     803080 <devcons_write+0x19>
+}
+  8030b3:	89 f0                	mov    %esi,%eax
+  8030b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b8:	5b                   	pop    %ebx
+  8030b9:	5e                   	pop    %esi
+  8030ba:	5f                   	pop    %edi
+  8030bb:	5d                   	pop    %ebp
+  8030bc:	c3                   	ret
+
+008030bd <devcons_read>:
+{
+  8030bd:	55                   	push   %ebp
+  8030be:	89 e5                	mov    %esp,%ebp
+  8030c0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030cc:	75 07                	jne    8030d5 <devcons_read+0x18>
+  8030ce:	eb 1f                	jmp    8030ef <devcons_read+0x32>
+		sys_yield();
+  8030d0:	e8 da d0 ff ff       	call   8001af <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030d5:	e8 32 d0 ff ff       	call   80010c <sys_cgetc>
+  8030da:	85 c0                	test   %eax,%eax
+  8030dc:	74 f2                	je     8030d0 <devcons_read+0x13>
+	if (c < 0)
+  8030de:	78 0f                	js     8030ef <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030e0:	83 f8 04             	cmp    $0x4,%eax
+  8030e3:	74 0c                	je     8030f1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030e8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030ea:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030ef:	c9                   	leave
+  8030f0:	c3                   	ret
+		return 0;
+  8030f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f6:	eb f7                	jmp    8030ef <devcons_read+0x32>
+
+008030f8 <cputchar>:
+{
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803101:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803104:	6a 01                	push   $0x1
+  803106:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803109:	50                   	push   %eax
+  80310a:	e8 d2 cf ff ff       	call   8000e1 <sys_cputs>
+}
+  80310f:	83 c4 10             	add    $0x10,%esp
+  803112:	c9                   	leave
+  803113:	c3                   	ret
+
+00803114 <getchar>:
+{
+  803114:	55                   	push   %ebp
+  803115:	89 e5                	mov    %esp,%ebp
+  803117:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80311a:	6a 01                	push   $0x1
+  80311c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80311f:	50                   	push   %eax
+  803120:	6a 00                	push   $0x0
+  803122:	e8 63 d8 ff ff       	call   80098a <read>
+	if (r < 0)
+  803127:	83 c4 10             	add    $0x10,%esp
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	78 06                	js     803134 <getchar+0x20>
+	if (r < 1)
+  80312e:	74 06                	je     803136 <getchar+0x22>
+	return c;
+  803130:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803134:	c9                   	leave
+  803135:	c3                   	ret
+		return -E_EOF;
+  803136:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80313b:	eb f7                	jmp    803134 <getchar+0x20>
+
+0080313d <iscons>:
+{
+  80313d:	55                   	push   %ebp
+  80313e:	89 e5                	mov    %esp,%ebp
+  803140:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803143:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803146:	50                   	push   %eax
+  803147:	ff 75 08             	push   0x8(%ebp)
+  80314a:	e8 ab d5 ff ff       	call   8006fa <fd_lookup>
+  80314f:	83 c4 10             	add    $0x10,%esp
+  803152:	85 c0                	test   %eax,%eax
+  803154:	78 11                	js     803167 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803156:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803159:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80315f:	39 10                	cmp    %edx,(%eax)
+  803161:	0f 94 c0             	sete   %al
+  803164:	0f b6 c0             	movzbl %al,%eax
+}
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+
+00803169 <opencons>:
+{
+  803169:	55                   	push   %ebp
+  80316a:	89 e5                	mov    %esp,%ebp
+  80316c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80316f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803172:	50                   	push   %eax
+  803173:	e8 2c d5 ff ff       	call   8006a4 <fd_alloc>
+  803178:	83 c4 10             	add    $0x10,%esp
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	78 3a                	js     8031b9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80317f:	83 ec 04             	sub    $0x4,%esp
+  803182:	68 07 04 00 00       	push   $0x407
+  803187:	ff 75 f4             	push   -0xc(%ebp)
+  80318a:	6a 00                	push   $0x0
+  80318c:	e8 4a d0 ff ff       	call   8001db <sys_page_alloc>
+  803191:	83 c4 10             	add    $0x10,%esp
+  803194:	85 c0                	test   %eax,%eax
+  803196:	78 21                	js     8031b9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803198:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319b:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8031a1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031ad:	83 ec 0c             	sub    $0xc,%esp
+  8031b0:	50                   	push   %eax
+  8031b1:	e8 c7 d4 ff ff       	call   80067d <fd2num>
+  8031b6:	83 c4 10             	add    $0x10,%esp
+}
+  8031b9:	c9                   	leave
+  8031ba:	c3                   	ret
+
+008031bb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031bb:	55                   	push   %ebp
+  8031bc:	89 e5                	mov    %esp,%ebp
+  8031be:	56                   	push   %esi
+  8031bf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031c0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031c3:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031c9:	e8 b5 cf ff ff       	call   800183 <sys_getenvid>
+  8031ce:	83 ec 0c             	sub    $0xc,%esp
+  8031d1:	ff 75 0c             	push   0xc(%ebp)
+  8031d4:	ff 75 08             	push   0x8(%ebp)
+  8031d7:	56                   	push   %esi
+  8031d8:	50                   	push   %eax
+  8031d9:	68 fc 48 80 00       	push   $0x8048fc
+  8031de:	e8 b3 00 00 00       	call   803296 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031e3:	83 c4 18             	add    $0x18,%esp
+  8031e6:	53                   	push   %ebx
+  8031e7:	ff 75 10             	push   0x10(%ebp)
+  8031ea:	e8 56 00 00 00       	call   803245 <vcprintf>
+	cprintf("\n");
+  8031ef:	c7 04 24 d2 4d 80 00 	movl   $0x804dd2,(%esp)
+  8031f6:	e8 9b 00 00 00       	call   803296 <cprintf>
+  8031fb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8031fe:	cc                   	int3
+	while (1)
+  8031ff:	eb fd                	jmp    8031fe <_panic+0x43>
+
+00803201 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	53                   	push   %ebx
+  803205:	83 ec 04             	sub    $0x4,%esp
+  803208:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80320b:	8b 13                	mov    (%ebx),%edx
+  80320d:	8d 42 01             	lea    0x1(%edx),%eax
+  803210:	89 03                	mov    %eax,(%ebx)
+  803212:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803215:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803219:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80321e:	74 09                	je     803229 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803220:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803224:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803227:	c9                   	leave
+  803228:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803229:	83 ec 08             	sub    $0x8,%esp
+  80322c:	68 ff 00 00 00       	push   $0xff
+  803231:	8d 43 08             	lea    0x8(%ebx),%eax
+  803234:	50                   	push   %eax
+  803235:	e8 a7 ce ff ff       	call   8000e1 <sys_cputs>
+		b->idx = 0;
+  80323a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803240:	83 c4 10             	add    $0x10,%esp
+  803243:	eb db                	jmp    803220 <putch+0x1f>
+
+00803245 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803245:	55                   	push   %ebp
+  803246:	89 e5                	mov    %esp,%ebp
+  803248:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80324e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803255:	00 00 00 
+	b.cnt = 0;
+  803258:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80325f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803262:	ff 75 0c             	push   0xc(%ebp)
+  803265:	ff 75 08             	push   0x8(%ebp)
+  803268:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80326e:	50                   	push   %eax
+  80326f:	68 01 32 80 00       	push   $0x803201
+  803274:	e8 14 01 00 00       	call   80338d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803279:	83 c4 08             	add    $0x8,%esp
+  80327c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  803282:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803288:	50                   	push   %eax
+  803289:	e8 53 ce ff ff       	call   8000e1 <sys_cputs>
+
+	return b.cnt;
+}
+  80328e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  803294:	c9                   	leave
+  803295:	c3                   	ret
+
+00803296 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80329c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80329f:	50                   	push   %eax
+  8032a0:	ff 75 08             	push   0x8(%ebp)
+  8032a3:	e8 9d ff ff ff       	call   803245 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032a8:	c9                   	leave
+  8032a9:	c3                   	ret
+
+008032aa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032aa:	55                   	push   %ebp
+  8032ab:	89 e5                	mov    %esp,%ebp
+  8032ad:	57                   	push   %edi
+  8032ae:	56                   	push   %esi
+  8032af:	53                   	push   %ebx
+  8032b0:	83 ec 1c             	sub    $0x1c,%esp
+  8032b3:	89 c7                	mov    %eax,%edi
+  8032b5:	89 d6                	mov    %edx,%esi
+  8032b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032bd:	89 d1                	mov    %edx,%ecx
+  8032bf:	89 c2                	mov    %eax,%edx
+  8032c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032ca:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032d7:	39 c2                	cmp    %eax,%edx
+  8032d9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032dc:	72 3e                	jb     80331c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032de:	83 ec 0c             	sub    $0xc,%esp
+  8032e1:	ff 75 18             	push   0x18(%ebp)
+  8032e4:	83 eb 01             	sub    $0x1,%ebx
+  8032e7:	53                   	push   %ebx
+  8032e8:	50                   	push   %eax
+  8032e9:	83 ec 08             	sub    $0x8,%esp
+  8032ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8032ef:	ff 75 e0             	push   -0x20(%ebp)
+  8032f2:	ff 75 dc             	push   -0x24(%ebp)
+  8032f5:	ff 75 d8             	push   -0x28(%ebp)
+  8032f8:	e8 47 12 00 00       	call   804544 <__udivdi3>
+  8032fd:	83 c4 18             	add    $0x18,%esp
+  803300:	52                   	push   %edx
+  803301:	50                   	push   %eax
+  803302:	89 f2                	mov    %esi,%edx
+  803304:	89 f8                	mov    %edi,%eax
+  803306:	e8 9f ff ff ff       	call   8032aa <printnum>
+  80330b:	83 c4 20             	add    $0x20,%esp
+  80330e:	eb 13                	jmp    803323 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803310:	83 ec 08             	sub    $0x8,%esp
+  803313:	56                   	push   %esi
+  803314:	ff 75 18             	push   0x18(%ebp)
+  803317:	ff d7                	call   *%edi
+  803319:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80331c:	83 eb 01             	sub    $0x1,%ebx
+  80331f:	85 db                	test   %ebx,%ebx
+  803321:	7f ed                	jg     803310 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  803323:	83 ec 08             	sub    $0x8,%esp
+  803326:	56                   	push   %esi
+  803327:	83 ec 04             	sub    $0x4,%esp
+  80332a:	ff 75 e4             	push   -0x1c(%ebp)
+  80332d:	ff 75 e0             	push   -0x20(%ebp)
+  803330:	ff 75 dc             	push   -0x24(%ebp)
+  803333:	ff 75 d8             	push   -0x28(%ebp)
+  803336:	e8 2a 12 00 00       	call   804565 <__umoddi3>
+  80333b:	83 c4 14             	add    $0x14,%esp
+  80333e:	0f be 80 1f 49 80 00 	movsbl 0x80491f(%eax),%eax
+  803345:	50                   	push   %eax
+  803346:	ff d7                	call   *%edi
+}
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334e:	5b                   	pop    %ebx
+  80334f:	5e                   	pop    %esi
+  803350:	5f                   	pop    %edi
+  803351:	5d                   	pop    %ebp
+  803352:	c3                   	ret
+
+00803353 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803353:	55                   	push   %ebp
+  803354:	89 e5                	mov    %esp,%ebp
+  803356:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803359:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80335d:	8b 10                	mov    (%eax),%edx
+  80335f:	3b 50 04             	cmp    0x4(%eax),%edx
+  803362:	73 0a                	jae    80336e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803364:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803367:	89 08                	mov    %ecx,(%eax)
+  803369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336c:	88 02                	mov    %al,(%edx)
+}
+  80336e:	5d                   	pop    %ebp
+  80336f:	c3                   	ret
+
+00803370 <printfmt>:
+{
+  803370:	55                   	push   %ebp
+  803371:	89 e5                	mov    %esp,%ebp
+  803373:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803376:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803379:	50                   	push   %eax
+  80337a:	ff 75 10             	push   0x10(%ebp)
+  80337d:	ff 75 0c             	push   0xc(%ebp)
+  803380:	ff 75 08             	push   0x8(%ebp)
+  803383:	e8 05 00 00 00       	call   80338d <vprintfmt>
+}
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	c9                   	leave
+  80338c:	c3                   	ret
+
+0080338d <vprintfmt>:
+{
+  80338d:	55                   	push   %ebp
+  80338e:	89 e5                	mov    %esp,%ebp
+  803390:	57                   	push   %edi
+  803391:	56                   	push   %esi
+  803392:	53                   	push   %ebx
+  803393:	83 ec 2c             	sub    $0x2c,%esp
+  803396:	8b 75 08             	mov    0x8(%ebp),%esi
+  803399:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80339c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80339f:	eb 0a                	jmp    8033ab <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8033a1:	83 ec 08             	sub    $0x8,%esp
+  8033a4:	53                   	push   %ebx
+  8033a5:	50                   	push   %eax
+  8033a6:	ff d6                	call   *%esi
+  8033a8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033ab:	83 c7 01             	add    $0x1,%edi
+  8033ae:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033b2:	83 f8 25             	cmp    $0x25,%eax
+  8033b5:	74 0c                	je     8033c3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8033b7:	85 c0                	test   %eax,%eax
+  8033b9:	75 e6                	jne    8033a1 <vprintfmt+0x14>
+}
+  8033bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033be:	5b                   	pop    %ebx
+  8033bf:	5e                   	pop    %esi
+  8033c0:	5f                   	pop    %edi
+  8033c1:	5d                   	pop    %ebp
+  8033c2:	c3                   	ret
+		padc = ' ';
+  8033c3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033c7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033ce:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033d5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033e1:	8d 47 01             	lea    0x1(%edi),%eax
+  8033e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033e7:	0f b6 17             	movzbl (%edi),%edx
+  8033ea:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033ed:	3c 55                	cmp    $0x55,%al
+  8033ef:	0f 87 c5 03 00 00    	ja     8037ba <vprintfmt+0x42d>
+  8033f5:	0f b6 c0             	movzbl %al,%eax
+  8033f8:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  8033ff:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  803402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803405:	eb da                	jmp    8033e1 <vprintfmt+0x54>
+  803407:	0f be d2             	movsbl %dl,%edx
+  80340a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80340d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803412:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803415:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803418:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80341c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80341f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803422:	83 f9 09             	cmp    $0x9,%ecx
+  803425:	77 55                	ja     80347c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  803427:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80342a:	eb e9                	jmp    803415 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80342c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80342f:	8b 00                	mov    (%eax),%eax
+  803431:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803434:	8b 45 14             	mov    0x14(%ebp),%eax
+  803437:	8d 40 04             	lea    0x4(%eax),%eax
+  80343a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80343d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803440:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803444:	79 9b                	jns    8033e1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803446:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803449:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80344c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  803453:	eb 8c                	jmp    8033e1 <vprintfmt+0x54>
+			if (width < 0)
+  803455:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803458:	85 d2                	test   %edx,%edx
+  80345a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345f:	0f 49 c2             	cmovns %edx,%eax
+  803462:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  803465:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803468:	e9 74 ff ff ff       	jmp    8033e1 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80346d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803470:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803477:	e9 65 ff ff ff       	jmp    8033e1 <vprintfmt+0x54>
+  80347c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80347f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803482:	eb bc                	jmp    803440 <vprintfmt+0xb3>
+			lflag++;
+  803484:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  803487:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80348a:	e9 52 ff ff ff       	jmp    8033e1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80348f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803492:	8d 78 04             	lea    0x4(%eax),%edi
+  803495:	83 ec 08             	sub    $0x8,%esp
+  803498:	53                   	push   %ebx
+  803499:	ff 30                	push   (%eax)
+  80349b:	ff d6                	call   *%esi
+			break;
+  80349d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8034a0:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8034a3:	e9 b1 02 00 00       	jmp    803759 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034ab:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034ae:	8b 10                	mov    (%eax),%edx
+  8034b0:	89 d0                	mov    %edx,%eax
+  8034b2:	f7 d8                	neg    %eax
+  8034b4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034b7:	83 f8 14             	cmp    $0x14,%eax
+  8034ba:	7f 23                	jg     8034df <vprintfmt+0x152>
+  8034bc:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  8034c3:	85 d2                	test   %edx,%edx
+  8034c5:	74 18                	je     8034df <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034c7:	52                   	push   %edx
+  8034c8:	68 c7 47 80 00       	push   $0x8047c7
+  8034cd:	53                   	push   %ebx
+  8034ce:	56                   	push   %esi
+  8034cf:	e8 9c fe ff ff       	call   803370 <printfmt>
+  8034d4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034da:	e9 7a 02 00 00       	jmp    803759 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034df:	50                   	push   %eax
+  8034e0:	68 37 49 80 00       	push   $0x804937
+  8034e5:	53                   	push   %ebx
+  8034e6:	56                   	push   %esi
+  8034e7:	e8 84 fe ff ff       	call   803370 <printfmt>
+  8034ec:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034f2:	e9 62 02 00 00       	jmp    803759 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8034f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034fa:	83 c0 04             	add    $0x4,%eax
+  8034fd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803500:	8b 45 14             	mov    0x14(%ebp),%eax
+  803503:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803505:	85 c9                	test   %ecx,%ecx
+  803507:	b8 30 49 80 00       	mov    $0x804930,%eax
+  80350c:	0f 45 c1             	cmovne %ecx,%eax
+  80350f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803512:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803516:	7e 06                	jle    80351e <vprintfmt+0x191>
+  803518:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80351c:	75 0b                	jne    803529 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80351e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803521:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803524:	89 75 08             	mov    %esi,0x8(%ebp)
+  803527:	eb 5c                	jmp    803585 <vprintfmt+0x1f8>
+  803529:	83 ec 08             	sub    $0x8,%esp
+  80352c:	ff 75 d0             	push   -0x30(%ebp)
+  80352f:	ff 75 cc             	push   -0x34(%ebp)
+  803532:	e8 20 03 00 00       	call   803857 <strnlen>
+  803537:	89 c2                	mov    %eax,%edx
+  803539:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80353c:	29 d0                	sub    %edx,%eax
+  80353e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803541:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803545:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803548:	89 75 08             	mov    %esi,0x8(%ebp)
+  80354b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80354d:	eb 0e                	jmp    80355d <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80354f:	83 ec 08             	sub    $0x8,%esp
+  803552:	53                   	push   %ebx
+  803553:	57                   	push   %edi
+  803554:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803557:	83 ee 01             	sub    $0x1,%esi
+  80355a:	83 c4 10             	add    $0x10,%esp
+  80355d:	85 f6                	test   %esi,%esi
+  80355f:	7f ee                	jg     80354f <vprintfmt+0x1c2>
+  803561:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803564:	8b 75 08             	mov    0x8(%ebp),%esi
+  803567:	85 c0                	test   %eax,%eax
+  803569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356e:	0f 49 d0             	cmovns %eax,%edx
+  803571:	29 d0                	sub    %edx,%eax
+  803573:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803576:	eb a6                	jmp    80351e <vprintfmt+0x191>
+					putch(ch, putdat);
+  803578:	83 ec 08             	sub    $0x8,%esp
+  80357b:	53                   	push   %ebx
+  80357c:	52                   	push   %edx
+  80357d:	ff 55 08             	call   *0x8(%ebp)
+  803580:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803583:	89 f1                	mov    %esi,%ecx
+  803585:	8d 71 01             	lea    0x1(%ecx),%esi
+  803588:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80358c:	0f be d0             	movsbl %al,%edx
+  80358f:	85 d2                	test   %edx,%edx
+  803591:	74 28                	je     8035bb <vprintfmt+0x22e>
+  803593:	85 ff                	test   %edi,%edi
+  803595:	78 05                	js     80359c <vprintfmt+0x20f>
+  803597:	83 ef 01             	sub    $0x1,%edi
+  80359a:	78 30                	js     8035cc <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80359c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8035a0:	74 d6                	je     803578 <vprintfmt+0x1eb>
+  8035a2:	0f be c0             	movsbl %al,%eax
+  8035a5:	83 e8 20             	sub    $0x20,%eax
+  8035a8:	83 f8 5e             	cmp    $0x5e,%eax
+  8035ab:	76 cb                	jbe    803578 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035ad:	83 ec 08             	sub    $0x8,%esp
+  8035b0:	53                   	push   %ebx
+  8035b1:	6a 3f                	push   $0x3f
+  8035b3:	ff 55 08             	call   *0x8(%ebp)
+  8035b6:	83 c4 10             	add    $0x10,%esp
+  8035b9:	eb c8                	jmp    803583 <vprintfmt+0x1f6>
+  8035bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035be:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035c4:	01 d0                	add    %edx,%eax
+  8035c6:	29 c8                	sub    %ecx,%eax
+  8035c8:	89 c7                	mov    %eax,%edi
+  8035ca:	eb 13                	jmp    8035df <vprintfmt+0x252>
+  8035cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035cf:	eb ed                	jmp    8035be <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035d1:	83 ec 08             	sub    $0x8,%esp
+  8035d4:	53                   	push   %ebx
+  8035d5:	6a 20                	push   $0x20
+  8035d7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035d9:	83 ef 01             	sub    $0x1,%edi
+  8035dc:	83 c4 10             	add    $0x10,%esp
+  8035df:	85 ff                	test   %edi,%edi
+  8035e1:	7f ee                	jg     8035d1 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035e3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035e9:	e9 6b 01 00 00       	jmp    803759 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035ee:	83 f9 01             	cmp    $0x1,%ecx
+  8035f1:	7f 1f                	jg     803612 <vprintfmt+0x285>
+	else if (lflag)
+  8035f3:	85 c9                	test   %ecx,%ecx
+  8035f5:	74 67                	je     80365e <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8035f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035fa:	8b 00                	mov    (%eax),%eax
+  8035fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8035ff:	89 c1                	mov    %eax,%ecx
+  803601:	c1 f9 1f             	sar    $0x1f,%ecx
+  803604:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80360a:	8d 40 04             	lea    0x4(%eax),%eax
+  80360d:	89 45 14             	mov    %eax,0x14(%ebp)
+  803610:	eb 17                	jmp    803629 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  803612:	8b 45 14             	mov    0x14(%ebp),%eax
+  803615:	8b 50 04             	mov    0x4(%eax),%edx
+  803618:	8b 00                	mov    (%eax),%eax
+  80361a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80361d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803620:	8b 45 14             	mov    0x14(%ebp),%eax
+  803623:	8d 40 08             	lea    0x8(%eax),%eax
+  803626:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803629:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80362c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80362f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803634:	85 c9                	test   %ecx,%ecx
+  803636:	0f 89 03 01 00 00    	jns    80373f <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80363c:	83 ec 08             	sub    $0x8,%esp
+  80363f:	53                   	push   %ebx
+  803640:	6a 2d                	push   $0x2d
+  803642:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803644:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803647:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80364a:	f7 da                	neg    %edx
+  80364c:	83 d1 00             	adc    $0x0,%ecx
+  80364f:	f7 d9                	neg    %ecx
+  803651:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803654:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803659:	e9 e1 00 00 00       	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80365e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803661:	8b 00                	mov    (%eax),%eax
+  803663:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803666:	89 c1                	mov    %eax,%ecx
+  803668:	c1 f9 1f             	sar    $0x1f,%ecx
+  80366b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80366e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803671:	8d 40 04             	lea    0x4(%eax),%eax
+  803674:	89 45 14             	mov    %eax,0x14(%ebp)
+  803677:	eb b0                	jmp    803629 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803679:	83 f9 01             	cmp    $0x1,%ecx
+  80367c:	7f 1e                	jg     80369c <vprintfmt+0x30f>
+	else if (lflag)
+  80367e:	85 c9                	test   %ecx,%ecx
+  803680:	74 32                	je     8036b4 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  803682:	8b 45 14             	mov    0x14(%ebp),%eax
+  803685:	8b 10                	mov    (%eax),%edx
+  803687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80368c:	8d 40 04             	lea    0x4(%eax),%eax
+  80368f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  803692:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  803697:	e9 a3 00 00 00       	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80369c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80369f:	8b 10                	mov    (%eax),%edx
+  8036a1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8036a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036af:	e9 8b 00 00 00       	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036b7:	8b 10                	mov    (%eax),%edx
+  8036b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036be:	8d 40 04             	lea    0x4(%eax),%eax
+  8036c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036c9:	eb 74                	jmp    80373f <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036cb:	83 f9 01             	cmp    $0x1,%ecx
+  8036ce:	7f 1b                	jg     8036eb <vprintfmt+0x35e>
+	else if (lflag)
+  8036d0:	85 c9                	test   %ecx,%ecx
+  8036d2:	74 2c                	je     803700 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036d7:	8b 10                	mov    (%eax),%edx
+  8036d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036de:	8d 40 04             	lea    0x4(%eax),%eax
+  8036e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036e4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036e9:	eb 54                	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ee:	8b 10                	mov    (%eax),%edx
+  8036f0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036f3:	8d 40 08             	lea    0x8(%eax),%eax
+  8036f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8036fe:	eb 3f                	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803700:	8b 45 14             	mov    0x14(%ebp),%eax
+  803703:	8b 10                	mov    (%eax),%edx
+  803705:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80370a:	8d 40 04             	lea    0x4(%eax),%eax
+  80370d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803710:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  803715:	eb 28                	jmp    80373f <vprintfmt+0x3b2>
+			putch('0', putdat);
+  803717:	83 ec 08             	sub    $0x8,%esp
+  80371a:	53                   	push   %ebx
+  80371b:	6a 30                	push   $0x30
+  80371d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80371f:	83 c4 08             	add    $0x8,%esp
+  803722:	53                   	push   %ebx
+  803723:	6a 78                	push   $0x78
+  803725:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80372a:	8b 10                	mov    (%eax),%edx
+  80372c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803731:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803734:	8d 40 04             	lea    0x4(%eax),%eax
+  803737:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80373a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80373f:	83 ec 0c             	sub    $0xc,%esp
+  803742:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  803746:	50                   	push   %eax
+  803747:	ff 75 e0             	push   -0x20(%ebp)
+  80374a:	57                   	push   %edi
+  80374b:	51                   	push   %ecx
+  80374c:	52                   	push   %edx
+  80374d:	89 da                	mov    %ebx,%edx
+  80374f:	89 f0                	mov    %esi,%eax
+  803751:	e8 54 fb ff ff       	call   8032aa <printnum>
+			break;
+  803756:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803759:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80375c:	e9 4a fc ff ff       	jmp    8033ab <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803761:	83 f9 01             	cmp    $0x1,%ecx
+  803764:	7f 1b                	jg     803781 <vprintfmt+0x3f4>
+	else if (lflag)
+  803766:	85 c9                	test   %ecx,%ecx
+  803768:	74 2c                	je     803796 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80376a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80376d:	8b 10                	mov    (%eax),%edx
+  80376f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803774:	8d 40 04             	lea    0x4(%eax),%eax
+  803777:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80377a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80377f:	eb be                	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803781:	8b 45 14             	mov    0x14(%ebp),%eax
+  803784:	8b 10                	mov    (%eax),%edx
+  803786:	8b 48 04             	mov    0x4(%eax),%ecx
+  803789:	8d 40 08             	lea    0x8(%eax),%eax
+  80378c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80378f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  803794:	eb a9                	jmp    80373f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  803796:	8b 45 14             	mov    0x14(%ebp),%eax
+  803799:	8b 10                	mov    (%eax),%edx
+  80379b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8037a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8037a6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037ab:	eb 92                	jmp    80373f <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037ad:	83 ec 08             	sub    $0x8,%esp
+  8037b0:	53                   	push   %ebx
+  8037b1:	6a 25                	push   $0x25
+  8037b3:	ff d6                	call   *%esi
+			break;
+  8037b5:	83 c4 10             	add    $0x10,%esp
+  8037b8:	eb 9f                	jmp    803759 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037ba:	83 ec 08             	sub    $0x8,%esp
+  8037bd:	53                   	push   %ebx
+  8037be:	6a 25                	push   $0x25
+  8037c0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037c2:	83 c4 10             	add    $0x10,%esp
+  8037c5:	89 f8                	mov    %edi,%eax
+  8037c7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037cb:	74 05                	je     8037d2 <vprintfmt+0x445>
+  8037cd:	83 e8 01             	sub    $0x1,%eax
+  8037d0:	eb f5                	jmp    8037c7 <vprintfmt+0x43a>
+  8037d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037d5:	eb 82                	jmp    803759 <vprintfmt+0x3cc>
+
+008037d7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037d7:	55                   	push   %ebp
+  8037d8:	89 e5                	mov    %esp,%ebp
+  8037da:	83 ec 18             	sub    $0x18,%esp
+  8037dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037e6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037ea:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8037f4:	85 c0                	test   %eax,%eax
+  8037f6:	74 26                	je     80381e <vsnprintf+0x47>
+  8037f8:	85 d2                	test   %edx,%edx
+  8037fa:	7e 22                	jle    80381e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8037fc:	ff 75 14             	push   0x14(%ebp)
+  8037ff:	ff 75 10             	push   0x10(%ebp)
+  803802:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803805:	50                   	push   %eax
+  803806:	68 53 33 80 00       	push   $0x803353
+  80380b:	e8 7d fb ff ff       	call   80338d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803810:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803813:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803816:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803819:	83 c4 10             	add    $0x10,%esp
+}
+  80381c:	c9                   	leave
+  80381d:	c3                   	ret
+		return -E_INVAL;
+  80381e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803823:	eb f7                	jmp    80381c <vsnprintf+0x45>
+
+00803825 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803825:	55                   	push   %ebp
+  803826:	89 e5                	mov    %esp,%ebp
+  803828:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80382b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80382e:	50                   	push   %eax
+  80382f:	ff 75 10             	push   0x10(%ebp)
+  803832:	ff 75 0c             	push   0xc(%ebp)
+  803835:	ff 75 08             	push   0x8(%ebp)
+  803838:	e8 9a ff ff ff       	call   8037d7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80383d:	c9                   	leave
+  80383e:	c3                   	ret
+
+0080383f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80383f:	55                   	push   %ebp
+  803840:	89 e5                	mov    %esp,%ebp
+  803842:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384a:	eb 03                	jmp    80384f <strlen+0x10>
+		n++;
+  80384c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80384f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803853:	75 f7                	jne    80384c <strlen+0xd>
+	return n;
+}
+  803855:	5d                   	pop    %ebp
+  803856:	c3                   	ret
+
+00803857 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803857:	55                   	push   %ebp
+  803858:	89 e5                	mov    %esp,%ebp
+  80385a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80385d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803860:	b8 00 00 00 00       	mov    $0x0,%eax
+  803865:	eb 03                	jmp    80386a <strnlen+0x13>
+		n++;
+  803867:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80386a:	39 d0                	cmp    %edx,%eax
+  80386c:	74 08                	je     803876 <strnlen+0x1f>
+  80386e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803872:	75 f3                	jne    803867 <strnlen+0x10>
+  803874:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  803876:	89 d0                	mov    %edx,%eax
+  803878:	5d                   	pop    %ebp
+  803879:	c3                   	ret
+
+0080387a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80387a:	55                   	push   %ebp
+  80387b:	89 e5                	mov    %esp,%ebp
+  80387d:	53                   	push   %ebx
+  80387e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803881:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  803884:	b8 00 00 00 00       	mov    $0x0,%eax
+  803889:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80388d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  803890:	83 c0 01             	add    $0x1,%eax
+  803893:	84 d2                	test   %dl,%dl
+  803895:	75 f2                	jne    803889 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  803897:	89 c8                	mov    %ecx,%eax
+  803899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80389c:	c9                   	leave
+  80389d:	c3                   	ret
+
+0080389e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80389e:	55                   	push   %ebp
+  80389f:	89 e5                	mov    %esp,%ebp
+  8038a1:	53                   	push   %ebx
+  8038a2:	83 ec 10             	sub    $0x10,%esp
+  8038a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038a8:	53                   	push   %ebx
+  8038a9:	e8 91 ff ff ff       	call   80383f <strlen>
+  8038ae:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038b1:	ff 75 0c             	push   0xc(%ebp)
+  8038b4:	01 d8                	add    %ebx,%eax
+  8038b6:	50                   	push   %eax
+  8038b7:	e8 be ff ff ff       	call   80387a <strcpy>
+	return dst;
+}
+  8038bc:	89 d8                	mov    %ebx,%eax
+  8038be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038c1:	c9                   	leave
+  8038c2:	c3                   	ret
+
+008038c3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	56                   	push   %esi
+  8038c7:	53                   	push   %ebx
+  8038c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038ce:	89 f3                	mov    %esi,%ebx
+  8038d0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038d3:	89 f0                	mov    %esi,%eax
+  8038d5:	eb 0f                	jmp    8038e6 <strncpy+0x23>
+		*dst++ = *src;
+  8038d7:	83 c0 01             	add    $0x1,%eax
+  8038da:	0f b6 0a             	movzbl (%edx),%ecx
+  8038dd:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038e0:	80 f9 01             	cmp    $0x1,%cl
+  8038e3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038e6:	39 d8                	cmp    %ebx,%eax
+  8038e8:	75 ed                	jne    8038d7 <strncpy+0x14>
+	}
+	return ret;
+}
+  8038ea:	89 f0                	mov    %esi,%eax
+  8038ec:	5b                   	pop    %ebx
+  8038ed:	5e                   	pop    %esi
+  8038ee:	5d                   	pop    %ebp
+  8038ef:	c3                   	ret
+
+008038f0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038f0:	55                   	push   %ebp
+  8038f1:	89 e5                	mov    %esp,%ebp
+  8038f3:	56                   	push   %esi
+  8038f4:	53                   	push   %ebx
+  8038f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038fb:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8038fe:	89 f0                	mov    %esi,%eax
+  803900:	85 d2                	test   %edx,%edx
+  803902:	74 21                	je     803925 <strlcpy+0x35>
+  803904:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803908:	89 f2                	mov    %esi,%edx
+  80390a:	eb 09                	jmp    803915 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80390c:	83 c1 01             	add    $0x1,%ecx
+  80390f:	83 c2 01             	add    $0x1,%edx
+  803912:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803915:	39 c2                	cmp    %eax,%edx
+  803917:	74 09                	je     803922 <strlcpy+0x32>
+  803919:	0f b6 19             	movzbl (%ecx),%ebx
+  80391c:	84 db                	test   %bl,%bl
+  80391e:	75 ec                	jne    80390c <strlcpy+0x1c>
+  803920:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  803922:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803925:	29 f0                	sub    %esi,%eax
+}
+  803927:	5b                   	pop    %ebx
+  803928:	5e                   	pop    %esi
+  803929:	5d                   	pop    %ebp
+  80392a:	c3                   	ret
+
+0080392b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80392b:	55                   	push   %ebp
+  80392c:	89 e5                	mov    %esp,%ebp
+  80392e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803931:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803934:	eb 06                	jmp    80393c <strcmp+0x11>
+		p++, q++;
+  803936:	83 c1 01             	add    $0x1,%ecx
+  803939:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80393c:	0f b6 01             	movzbl (%ecx),%eax
+  80393f:	84 c0                	test   %al,%al
+  803941:	74 04                	je     803947 <strcmp+0x1c>
+  803943:	3a 02                	cmp    (%edx),%al
+  803945:	74 ef                	je     803936 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803947:	0f b6 c0             	movzbl %al,%eax
+  80394a:	0f b6 12             	movzbl (%edx),%edx
+  80394d:	29 d0                	sub    %edx,%eax
+}
+  80394f:	5d                   	pop    %ebp
+  803950:	c3                   	ret
+
+00803951 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803951:	55                   	push   %ebp
+  803952:	89 e5                	mov    %esp,%ebp
+  803954:	53                   	push   %ebx
+  803955:	8b 45 08             	mov    0x8(%ebp),%eax
+  803958:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80395b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80395e:	eb 09                	jmp    803969 <strncmp+0x18>
+		n--, p++, q++;
+  803960:	83 ea 01             	sub    $0x1,%edx
+  803963:	83 c0 01             	add    $0x1,%eax
+  803966:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803969:	85 d2                	test   %edx,%edx
+  80396b:	74 18                	je     803985 <strncmp+0x34>
+  80396d:	0f b6 18             	movzbl (%eax),%ebx
+  803970:	84 db                	test   %bl,%bl
+  803972:	74 04                	je     803978 <strncmp+0x27>
+  803974:	3a 19                	cmp    (%ecx),%bl
+  803976:	74 e8                	je     803960 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803978:	0f b6 00             	movzbl (%eax),%eax
+  80397b:	0f b6 11             	movzbl (%ecx),%edx
+  80397e:	29 d0                	sub    %edx,%eax
+}
+  803980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803983:	c9                   	leave
+  803984:	c3                   	ret
+		return 0;
+  803985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398a:	eb f4                	jmp    803980 <strncmp+0x2f>
+
+0080398c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80398c:	55                   	push   %ebp
+  80398d:	89 e5                	mov    %esp,%ebp
+  80398f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803992:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  803996:	eb 03                	jmp    80399b <strchr+0xf>
+  803998:	83 c0 01             	add    $0x1,%eax
+  80399b:	0f b6 10             	movzbl (%eax),%edx
+  80399e:	84 d2                	test   %dl,%dl
+  8039a0:	74 06                	je     8039a8 <strchr+0x1c>
+		if (*s == c)
+  8039a2:	38 ca                	cmp    %cl,%dl
+  8039a4:	75 f2                	jne    803998 <strchr+0xc>
+  8039a6:	eb 05                	jmp    8039ad <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039ad:	5d                   	pop    %ebp
+  8039ae:	c3                   	ret
+
+008039af <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039af:	55                   	push   %ebp
+  8039b0:	89 e5                	mov    %esp,%ebp
+  8039b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039b9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039bc:	38 ca                	cmp    %cl,%dl
+  8039be:	74 09                	je     8039c9 <strfind+0x1a>
+  8039c0:	84 d2                	test   %dl,%dl
+  8039c2:	74 05                	je     8039c9 <strfind+0x1a>
+	for (; *s; s++)
+  8039c4:	83 c0 01             	add    $0x1,%eax
+  8039c7:	eb f0                	jmp    8039b9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039c9:	5d                   	pop    %ebp
+  8039ca:	c3                   	ret
+
+008039cb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039cb:	55                   	push   %ebp
+  8039cc:	89 e5                	mov    %esp,%ebp
+  8039ce:	57                   	push   %edi
+  8039cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039d2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039d5:	85 c9                	test   %ecx,%ecx
+  8039d7:	74 20                	je     8039f9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039d9:	89 f8                	mov    %edi,%eax
+  8039db:	09 c8                	or     %ecx,%eax
+  8039dd:	a8 03                	test   $0x3,%al
+  8039df:	75 12                	jne    8039f3 <memset+0x28>
+		c &= 0xFF;
+  8039e1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039e5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039eb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039ee:	fc                   	cld
+  8039ef:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039f1:	eb 06                	jmp    8039f9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039f6:	fc                   	cld
+  8039f7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8039f9:	89 f8                	mov    %edi,%eax
+  8039fb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8039fe:	c9                   	leave
+  8039ff:	c3                   	ret
+
+00803a00 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803a00:	55                   	push   %ebp
+  803a01:	89 e5                	mov    %esp,%ebp
+  803a03:	57                   	push   %edi
+  803a04:	56                   	push   %esi
+  803a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a08:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a0b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a0e:	39 c6                	cmp    %eax,%esi
+  803a10:	73 32                	jae    803a44 <memmove+0x44>
+  803a12:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a15:	39 d0                	cmp    %edx,%eax
+  803a17:	73 2b                	jae    803a44 <memmove+0x44>
+		s += n;
+		d += n;
+  803a19:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a1c:	89 d6                	mov    %edx,%esi
+  803a1e:	09 fe                	or     %edi,%esi
+  803a20:	09 ce                	or     %ecx,%esi
+  803a22:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a28:	75 0e                	jne    803a38 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a2a:	83 ef 04             	sub    $0x4,%edi
+  803a2d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a30:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a33:	fd                   	std
+  803a34:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a36:	eb 09                	jmp    803a41 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a38:	83 ef 01             	sub    $0x1,%edi
+  803a3b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a3e:	fd                   	std
+  803a3f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a41:	fc                   	cld
+  803a42:	eb 1a                	jmp    803a5e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a44:	89 f2                	mov    %esi,%edx
+  803a46:	09 c2                	or     %eax,%edx
+  803a48:	09 ca                	or     %ecx,%edx
+  803a4a:	f6 c2 03             	test   $0x3,%dl
+  803a4d:	75 0a                	jne    803a59 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a4f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a52:	89 c7                	mov    %eax,%edi
+  803a54:	fc                   	cld
+  803a55:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a57:	eb 05                	jmp    803a5e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a59:	89 c7                	mov    %eax,%edi
+  803a5b:	fc                   	cld
+  803a5c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a5e:	5e                   	pop    %esi
+  803a5f:	5f                   	pop    %edi
+  803a60:	5d                   	pop    %ebp
+  803a61:	c3                   	ret
+
+00803a62 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a62:	55                   	push   %ebp
+  803a63:	89 e5                	mov    %esp,%ebp
+  803a65:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a68:	ff 75 10             	push   0x10(%ebp)
+  803a6b:	ff 75 0c             	push   0xc(%ebp)
+  803a6e:	ff 75 08             	push   0x8(%ebp)
+  803a71:	e8 8a ff ff ff       	call   803a00 <memmove>
+}
+  803a76:	c9                   	leave
+  803a77:	c3                   	ret
+
+00803a78 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a78:	55                   	push   %ebp
+  803a79:	89 e5                	mov    %esp,%ebp
+  803a7b:	56                   	push   %esi
+  803a7c:	53                   	push   %ebx
+  803a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a83:	89 c6                	mov    %eax,%esi
+  803a85:	03 75 10             	add    0x10(%ebp),%esi
+  803a88:	eb 06                	jmp    803a90 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a8a:	83 c0 01             	add    $0x1,%eax
+  803a8d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a90:	39 f0                	cmp    %esi,%eax
+  803a92:	74 14                	je     803aa8 <memcmp+0x30>
+		if (*s1 != *s2)
+  803a94:	0f b6 08             	movzbl (%eax),%ecx
+  803a97:	0f b6 1a             	movzbl (%edx),%ebx
+  803a9a:	38 d9                	cmp    %bl,%cl
+  803a9c:	74 ec                	je     803a8a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803a9e:	0f b6 c1             	movzbl %cl,%eax
+  803aa1:	0f b6 db             	movzbl %bl,%ebx
+  803aa4:	29 d8                	sub    %ebx,%eax
+  803aa6:	eb 05                	jmp    803aad <memcmp+0x35>
+	}
+
+	return 0;
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aad:	5b                   	pop    %ebx
+  803aae:	5e                   	pop    %esi
+  803aaf:	5d                   	pop    %ebp
+  803ab0:	c3                   	ret
+
+00803ab1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803ab1:	55                   	push   %ebp
+  803ab2:	89 e5                	mov    %esp,%ebp
+  803ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ab7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803aba:	89 c2                	mov    %eax,%edx
+  803abc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803abf:	eb 03                	jmp    803ac4 <memfind+0x13>
+  803ac1:	83 c0 01             	add    $0x1,%eax
+  803ac4:	39 d0                	cmp    %edx,%eax
+  803ac6:	73 04                	jae    803acc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ac8:	38 08                	cmp    %cl,(%eax)
+  803aca:	75 f5                	jne    803ac1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803acc:	5d                   	pop    %ebp
+  803acd:	c3                   	ret
+
+00803ace <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ace:	55                   	push   %ebp
+  803acf:	89 e5                	mov    %esp,%ebp
+  803ad1:	57                   	push   %edi
+  803ad2:	56                   	push   %esi
+  803ad3:	53                   	push   %ebx
+  803ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ad7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ada:	eb 03                	jmp    803adf <strtol+0x11>
+		s++;
+  803adc:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803adf:	0f b6 02             	movzbl (%edx),%eax
+  803ae2:	3c 20                	cmp    $0x20,%al
+  803ae4:	74 f6                	je     803adc <strtol+0xe>
+  803ae6:	3c 09                	cmp    $0x9,%al
+  803ae8:	74 f2                	je     803adc <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803aea:	3c 2b                	cmp    $0x2b,%al
+  803aec:	74 2a                	je     803b18 <strtol+0x4a>
+	int neg = 0;
+  803aee:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803af3:	3c 2d                	cmp    $0x2d,%al
+  803af5:	74 2b                	je     803b22 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803af7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803afd:	75 0f                	jne    803b0e <strtol+0x40>
+  803aff:	80 3a 30             	cmpb   $0x30,(%edx)
+  803b02:	74 28                	je     803b2c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803b04:	85 db                	test   %ebx,%ebx
+  803b06:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b0b:	0f 44 d8             	cmove  %eax,%ebx
+  803b0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b13:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b16:	eb 46                	jmp    803b5e <strtol+0x90>
+		s++;
+  803b18:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b20:	eb d5                	jmp    803af7 <strtol+0x29>
+		s++, neg = 1;
+  803b22:	83 c2 01             	add    $0x1,%edx
+  803b25:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b2a:	eb cb                	jmp    803af7 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b2c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b30:	74 0e                	je     803b40 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b32:	85 db                	test   %ebx,%ebx
+  803b34:	75 d8                	jne    803b0e <strtol+0x40>
+		s++, base = 8;
+  803b36:	83 c2 01             	add    $0x1,%edx
+  803b39:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b3e:	eb ce                	jmp    803b0e <strtol+0x40>
+		s += 2, base = 16;
+  803b40:	83 c2 02             	add    $0x2,%edx
+  803b43:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b48:	eb c4                	jmp    803b0e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b4a:	0f be c0             	movsbl %al,%eax
+  803b4d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b50:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b53:	7d 3a                	jge    803b8f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b55:	83 c2 01             	add    $0x1,%edx
+  803b58:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b5c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b5e:	0f b6 02             	movzbl (%edx),%eax
+  803b61:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b64:	89 f3                	mov    %esi,%ebx
+  803b66:	80 fb 09             	cmp    $0x9,%bl
+  803b69:	76 df                	jbe    803b4a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b6b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b6e:	89 f3                	mov    %esi,%ebx
+  803b70:	80 fb 19             	cmp    $0x19,%bl
+  803b73:	77 08                	ja     803b7d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b75:	0f be c0             	movsbl %al,%eax
+  803b78:	83 e8 57             	sub    $0x57,%eax
+  803b7b:	eb d3                	jmp    803b50 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b7d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b80:	89 f3                	mov    %esi,%ebx
+  803b82:	80 fb 19             	cmp    $0x19,%bl
+  803b85:	77 08                	ja     803b8f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b87:	0f be c0             	movsbl %al,%eax
+  803b8a:	83 e8 37             	sub    $0x37,%eax
+  803b8d:	eb c1                	jmp    803b50 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b8f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b93:	74 05                	je     803b9a <strtol+0xcc>
+		*endptr = (char *) s;
+  803b95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b98:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803b9a:	89 c8                	mov    %ecx,%eax
+  803b9c:	f7 d8                	neg    %eax
+  803b9e:	85 ff                	test   %edi,%edi
+  803ba0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803ba3:	89 c8                	mov    %ecx,%eax
+  803ba5:	5b                   	pop    %ebx
+  803ba6:	5e                   	pop    %esi
+  803ba7:	5f                   	pop    %edi
+  803ba8:	5d                   	pop    %ebp
+  803ba9:	c3                   	ret
+
+00803baa <atoi>:
+
+int
+atoi(const char* s)
+{
+  803baa:	55                   	push   %ebp
+  803bab:	89 e5                	mov    %esp,%ebp
+  803bad:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803bb0:	6a 00                	push   $0x0
+  803bb2:	6a 00                	push   $0x0
+  803bb4:	ff 75 08             	push   0x8(%ebp)
+  803bb7:	e8 12 ff ff ff       	call   803ace <strtol>
+}
+  803bbc:	c9                   	leave
+  803bbd:	c3                   	ret
+
+00803bbe <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bbe:	55                   	push   %ebp
+  803bbf:	89 e5                	mov    %esp,%ebp
+  803bc1:	57                   	push   %edi
+  803bc2:	56                   	push   %esi
+  803bc3:	53                   	push   %ebx
+  803bc4:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bc7:	89 d6                	mov    %edx,%esi
+  803bc9:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bcc:	89 cf                	mov    %ecx,%edi
+  803bce:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bd1:	89 fa                	mov    %edi,%edx
+  803bd3:	80 ce 08             	or     $0x8,%dh
+  803bd6:	f6 c5 08             	test   $0x8,%ch
+  803bd9:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bdc:	57                   	push   %edi
+  803bdd:	56                   	push   %esi
+  803bde:	50                   	push   %eax
+  803bdf:	56                   	push   %esi
+  803be0:	6a 00                	push   $0x0
+  803be2:	e8 41 c6 ff ff       	call   800228 <sys_page_map>
+	if (r < 0) {
+  803be7:	83 c4 20             	add    $0x20,%esp
+  803bea:	85 c0                	test   %eax,%eax
+  803bec:	78 27                	js     803c15 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803bee:	83 ec 0c             	sub    $0xc,%esp
+  803bf1:	57                   	push   %edi
+  803bf2:	56                   	push   %esi
+  803bf3:	6a 00                	push   $0x0
+  803bf5:	56                   	push   %esi
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	e8 2b c6 ff ff       	call   800228 <sys_page_map>
+  803bfd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803bff:	83 c4 20             	add    $0x20,%esp
+  803c02:	85 c0                	test   %eax,%eax
+  803c04:	78 24                	js     803c2a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c06:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c0b:	89 d8                	mov    %ebx,%eax
+  803c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c10:	5b                   	pop    %ebx
+  803c11:	5e                   	pop    %esi
+  803c12:	5f                   	pop    %edi
+  803c13:	5d                   	pop    %ebp
+  803c14:	c3                   	ret
+  803c15:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c17:	83 ec 08             	sub    $0x8,%esp
+  803c1a:	50                   	push   %eax
+  803c1b:	68 98 4c 80 00       	push   $0x804c98
+  803c20:	e8 71 f6 ff ff       	call   803296 <cprintf>
+		return r;
+  803c25:	83 c4 10             	add    $0x10,%esp
+  803c28:	eb e1                	jmp    803c0b <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c2a:	83 ec 08             	sub    $0x8,%esp
+  803c2d:	50                   	push   %eax
+  803c2e:	68 c8 4c 80 00       	push   $0x804cc8
+  803c33:	e8 5e f6 ff ff       	call   803296 <cprintf>
+		return r;
+  803c38:	83 c4 10             	add    $0x10,%esp
+  803c3b:	eb ce                	jmp    803c0b <duppage_cow+0x4d>
+
+00803c3d <duppage>:
+{
+  803c3d:	55                   	push   %ebp
+  803c3e:	89 e5                	mov    %esp,%ebp
+  803c40:	53                   	push   %ebx
+  803c41:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c44:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c47:	51                   	push   %ecx
+  803c48:	52                   	push   %edx
+  803c49:	50                   	push   %eax
+  803c4a:	52                   	push   %edx
+  803c4b:	6a 00                	push   $0x0
+  803c4d:	e8 d6 c5 ff ff       	call   800228 <sys_page_map>
+	if (r < 0) {
+  803c52:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c55:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c5a:	85 c0                	test   %eax,%eax
+  803c5c:	78 07                	js     803c65 <duppage+0x28>
+}
+  803c5e:	89 d8                	mov    %ebx,%eax
+  803c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c63:	c9                   	leave
+  803c64:	c3                   	ret
+  803c65:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c67:	83 ec 08             	sub    $0x8,%esp
+  803c6a:	50                   	push   %eax
+  803c6b:	68 98 4c 80 00       	push   $0x804c98
+  803c70:	e8 21 f6 ff ff       	call   803296 <cprintf>
+		return r;
+  803c75:	83 c4 10             	add    $0x10,%esp
+  803c78:	eb e4                	jmp    803c5e <duppage+0x21>
+
+00803c7a <cow_copy>:
+{
+  803c7a:	55                   	push   %ebp
+  803c7b:	89 e5                	mov    %esp,%ebp
+  803c7d:	56                   	push   %esi
+  803c7e:	53                   	push   %ebx
+  803c7f:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c81:	83 ec 04             	sub    $0x4,%esp
+  803c84:	6a 07                	push   $0x7
+  803c86:	68 00 f0 7f 00       	push   $0x7ff000
+  803c8b:	6a 00                	push   $0x0
+  803c8d:	e8 49 c5 ff ff       	call   8001db <sys_page_alloc>
+	if (r < 0) {
+  803c92:	83 c4 10             	add    $0x10,%esp
+  803c95:	85 c0                	test   %eax,%eax
+  803c97:	78 58                	js     803cf1 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803c99:	83 ec 04             	sub    $0x4,%esp
+  803c9c:	68 00 10 00 00       	push   $0x1000
+  803ca1:	56                   	push   %esi
+  803ca2:	68 00 f0 7f 00       	push   $0x7ff000
+  803ca7:	e8 54 fd ff ff       	call   803a00 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cac:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cb3:	56                   	push   %esi
+  803cb4:	6a 00                	push   $0x0
+  803cb6:	68 00 f0 7f 00       	push   $0x7ff000
+  803cbb:	6a 00                	push   $0x0
+  803cbd:	e8 66 c5 ff ff       	call   800228 <sys_page_map>
+  803cc2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cc4:	83 c4 20             	add    $0x20,%esp
+  803cc7:	85 c0                	test   %eax,%eax
+  803cc9:	78 3b                	js     803d06 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803ccb:	83 ec 08             	sub    $0x8,%esp
+  803cce:	68 00 f0 7f 00       	push   $0x7ff000
+  803cd3:	6a 00                	push   $0x0
+  803cd5:	e8 9a c5 ff ff       	call   800274 <sys_page_unmap>
+  803cda:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cdc:	83 c4 10             	add    $0x10,%esp
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 45                	js     803d28 <cow_copy+0xae>
+	return 0;
+  803ce3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ce8:	89 d8                	mov    %ebx,%eax
+  803cea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ced:	5b                   	pop    %ebx
+  803cee:	5e                   	pop    %esi
+  803cef:	5d                   	pop    %ebp
+  803cf0:	c3                   	ret
+  803cf1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803cf3:	83 ec 08             	sub    $0x8,%esp
+  803cf6:	50                   	push   %eax
+  803cf7:	68 b8 4d 80 00       	push   $0x804db8
+  803cfc:	e8 95 f5 ff ff       	call   803296 <cprintf>
+		return r;
+  803d01:	83 c4 10             	add    $0x10,%esp
+  803d04:	eb e2                	jmp    803ce8 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d06:	83 ec 08             	sub    $0x8,%esp
+  803d09:	50                   	push   %eax
+  803d0a:	68 d4 4d 80 00       	push   $0x804dd4
+  803d0f:	e8 82 f5 ff ff       	call   803296 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d14:	83 c4 08             	add    $0x8,%esp
+  803d17:	68 00 f0 7f 00       	push   $0x7ff000
+  803d1c:	6a 00                	push   $0x0
+  803d1e:	e8 51 c5 ff ff       	call   800274 <sys_page_unmap>
+		return r;
+  803d23:	83 c4 10             	add    $0x10,%esp
+  803d26:	eb c0                	jmp    803ce8 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d28:	83 ec 08             	sub    $0x8,%esp
+  803d2b:	50                   	push   %eax
+  803d2c:	68 f0 4c 80 00       	push   $0x804cf0
+  803d31:	e8 60 f5 ff ff       	call   803296 <cprintf>
+		return r;
+  803d36:	83 c4 10             	add    $0x10,%esp
+  803d39:	eb ad                	jmp    803ce8 <cow_copy+0x6e>
+
+00803d3b <pgfault>:
+{
+  803d3b:	55                   	push   %ebp
+  803d3c:	89 e5                	mov    %esp,%ebp
+  803d3e:	56                   	push   %esi
+  803d3f:	53                   	push   %ebx
+  803d40:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d43:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d45:	89 d8                	mov    %ebx,%eax
+  803d47:	c1 e8 16             	shr    $0x16,%eax
+  803d4a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d51:	89 de                	mov    %ebx,%esi
+  803d53:	c1 ee 0c             	shr    $0xc,%esi
+  803d56:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d5d:	a8 07                	test   $0x7,%al
+  803d5f:	74 3b                	je     803d9c <pgfault+0x61>
+  803d61:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d67:	74 33                	je     803d9c <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d69:	83 ec 0c             	sub    $0xc,%esp
+  803d6c:	68 00 f0 bf ee       	push   $0xeebff000
+  803d71:	e8 c5 ea ff ff       	call   80283b <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d76:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d7d:	83 c4 10             	add    $0x10,%esp
+  803d80:	f6 c4 08             	test   $0x8,%ah
+  803d83:	75 30                	jne    803db5 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d85:	83 ec 0c             	sub    $0xc,%esp
+  803d88:	68 00 f0 bf ee       	push   $0xeebff000
+  803d8d:	e8 16 eb ff ff       	call   8028a8 <mutex_unlock>
+}
+  803d92:	83 c4 10             	add    $0x10,%esp
+  803d95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d98:	5b                   	pop    %ebx
+  803d99:	5e                   	pop    %esi
+  803d9a:	5d                   	pop    %ebp
+  803d9b:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803d9c:	83 ec 08             	sub    $0x8,%esp
+  803d9f:	ff 72 28             	push   0x28(%edx)
+  803da2:	51                   	push   %ecx
+  803da3:	50                   	push   %eax
+  803da4:	68 14 4d 80 00       	push   $0x804d14
+  803da9:	6a 3f                	push   $0x3f
+  803dab:	68 ee 4d 80 00       	push   $0x804dee
+  803db0:	e8 06 f4 ff ff       	call   8031bb <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803db5:	89 d8                	mov    %ebx,%eax
+  803db7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803dbc:	e8 b9 fe ff ff       	call   803c7a <cow_copy>
+  803dc1:	eb c2                	jmp    803d85 <pgfault+0x4a>
+
+00803dc3 <cow_enable>:
+{
+  803dc3:	55                   	push   %ebp
+  803dc4:	89 e5                	mov    %esp,%ebp
+  803dc6:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dc9:	68 3b 3d 80 00       	push   $0x803d3b
+  803dce:	e8 28 06 00 00       	call   8043fb <set_pgfault_handler>
+}
+  803dd3:	83 c4 10             	add    $0x10,%esp
+  803dd6:	c9                   	leave
+  803dd7:	c3                   	ret
+
+00803dd8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dd8:	55                   	push   %ebp
+  803dd9:	89 e5                	mov    %esp,%ebp
+  803ddb:	57                   	push   %edi
+  803ddc:	56                   	push   %esi
+  803ddd:	53                   	push   %ebx
+  803dde:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803de1:	68 3b 3d 80 00       	push   $0x803d3b
+  803de6:	e8 10 06 00 00       	call   8043fb <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803deb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803df0:	cd 30                	int    $0x30
+  803df2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803df5:	83 c4 10             	add    $0x10,%esp
+  803df8:	85 c0                	test   %eax,%eax
+  803dfa:	78 4b                	js     803e47 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803dfc:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e09:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e0d:	0f 85 16 01 00 00    	jne    803f29 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e13:	e8 6b c3 ff ff       	call   800183 <sys_getenvid>
+  803e18:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e1d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e1f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e25:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e2b:	77 32                	ja     803e5f <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e2d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e32:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e34:	c1 ea 10             	shr    $0x10,%edx
+  803e37:	74 26                	je     803e5f <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e39:	c1 e2 10             	shl    $0x10,%edx
+  803e3c:	89 d1                	mov    %edx,%ecx
+  803e3e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e43:	29 ca                	sub    %ecx,%edx
+  803e45:	eb 1e                	jmp    803e65 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e47:	83 ec 08             	sub    $0x8,%esp
+  803e4a:	89 c7                	mov    %eax,%edi
+  803e4c:	50                   	push   %eax
+  803e4d:	68 f9 4d 80 00       	push   $0x804df9
+  803e52:	e8 3f f4 ff ff       	call   803296 <cprintf>
+		return eid;
+  803e57:	83 c4 10             	add    $0x10,%esp
+  803e5a:	e9 6c 01 00 00       	jmp    803fcb <fork+0x1f3>
+		return pthread_main_tls;
+  803e5f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e65:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e68:	c1 e0 04             	shl    $0x4,%eax
+  803e6b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e70:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e72:	e8 0d f1 ff ff       	call   802f84 <pthread_fork_child>
+		return eid;
+  803e77:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e7a:	e9 4c 01 00 00       	jmp    803fcb <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e7f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e85:	89 da                	mov    %ebx,%edx
+  803e87:	89 f8                	mov    %edi,%eax
+  803e89:	e8 af fd ff ff       	call   803c3d <duppage>
+  803e8e:	85 c0                	test   %eax,%eax
+  803e90:	79 28                	jns    803eba <fork+0xe2>
+  803e92:	89 c7                	mov    %eax,%edi
+  803e94:	e9 32 01 00 00       	jmp    803fcb <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803e99:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e9f:	83 f9 05             	cmp    $0x5,%ecx
+  803ea2:	75 58                	jne    803efc <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ea4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ea9:	89 da                	mov    %ebx,%edx
+  803eab:	89 f8                	mov    %edi,%eax
+  803ead:	e8 8b fd ff ff       	call   803c3d <duppage>
+  803eb2:	85 c0                	test   %eax,%eax
+  803eb4:	0f 88 0f 01 00 00    	js     803fc9 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eba:	83 c3 01             	add    $0x1,%ebx
+  803ebd:	39 de                	cmp    %ebx,%esi
+  803ebf:	74 54                	je     803f15 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803ec1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ec8:	f6 c1 05             	test   $0x5,%cl
+  803ecb:	74 ed                	je     803eba <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ecd:	f6 c5 04             	test   $0x4,%ch
+  803ed0:	75 ad                	jne    803e7f <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ed2:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ed8:	74 bf                	je     803e99 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803eda:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ee0:	74 d8                	je     803eba <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803ee2:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ee8:	89 da                	mov    %ebx,%edx
+  803eea:	89 f8                	mov    %edi,%eax
+  803eec:	e8 cd fc ff ff       	call   803bbe <duppage_cow>
+  803ef1:	85 c0                	test   %eax,%eax
+  803ef3:	79 c5                	jns    803eba <fork+0xe2>
+  803ef5:	89 c7                	mov    %eax,%edi
+  803ef7:	e9 cf 00 00 00       	jmp    803fcb <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803efc:	68 44 4d 80 00       	push   $0x804d44
+  803f01:	68 b5 47 80 00       	push   $0x8047b5
+  803f06:	68 c6 00 00 00       	push   $0xc6
+  803f0b:	68 ee 4d 80 00       	push   $0x804dee
+  803f10:	e8 a6 f2 ff ff       	call   8031bb <_panic>
+  803f15:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f18:	83 c1 01             	add    $0x1,%ecx
+  803f1b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f21:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f27:	74 18                	je     803f41 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f29:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f30:	a8 07                	test   $0x7,%al
+  803f32:	74 e4                	je     803f18 <fork+0x140>
+  803f34:	89 cb                	mov    %ecx,%ebx
+  803f36:	c1 e3 0a             	shl    $0xa,%ebx
+  803f39:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f3c:	e9 7c ff ff ff       	jmp    803ebd <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f41:	83 ec 04             	sub    $0x4,%esp
+  803f44:	6a 07                	push   $0x7
+  803f46:	68 00 f0 bf ee       	push   $0xeebff000
+  803f4b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f4e:	e8 88 c2 ff ff       	call   8001db <sys_page_alloc>
+  803f53:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f55:	83 c4 10             	add    $0x10,%esp
+  803f58:	85 c0                	test   %eax,%eax
+  803f5a:	78 34                	js     803f90 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f5c:	83 ec 08             	sub    $0x8,%esp
+  803f5f:	68 39 44 80 00       	push   $0x804439
+  803f64:	ff 75 e4             	push   -0x1c(%ebp)
+  803f67:	e8 ec c3 ff ff       	call   800358 <sys_env_set_pgfault_upcall>
+  803f6c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f6e:	83 c4 10             	add    $0x10,%esp
+  803f71:	85 c0                	test   %eax,%eax
+  803f73:	78 2e                	js     803fa3 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f75:	83 ec 08             	sub    $0x8,%esp
+  803f78:	6a 02                	push   $0x2
+  803f7a:	ff 75 e4             	push   -0x1c(%ebp)
+  803f7d:	e8 3e c3 ff ff       	call   8002c0 <sys_env_set_status>
+  803f82:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f84:	83 c4 10             	add    $0x10,%esp
+  803f87:	85 c0                	test   %eax,%eax
+  803f89:	78 2b                	js     803fb6 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f8b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f8e:	eb 3b                	jmp    803fcb <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f90:	83 ec 08             	sub    $0x8,%esp
+  803f93:	50                   	push   %eax
+  803f94:	68 6c 4d 80 00       	push   $0x804d6c
+  803f99:	e8 f8 f2 ff ff       	call   803296 <cprintf>
+		return r;
+  803f9e:	83 c4 10             	add    $0x10,%esp
+  803fa1:	eb 28                	jmp    803fcb <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803fa3:	83 ec 08             	sub    $0x8,%esp
+  803fa6:	50                   	push   %eax
+  803fa7:	68 94 4d 80 00       	push   $0x804d94
+  803fac:	e8 e5 f2 ff ff       	call   803296 <cprintf>
+		return r;
+  803fb1:	83 c4 10             	add    $0x10,%esp
+  803fb4:	eb 15                	jmp    803fcb <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fb6:	83 ec 08             	sub    $0x8,%esp
+  803fb9:	50                   	push   %eax
+  803fba:	68 09 4e 80 00       	push   $0x804e09
+  803fbf:	e8 d2 f2 ff ff       	call   803296 <cprintf>
+		return r;
+  803fc4:	83 c4 10             	add    $0x10,%esp
+  803fc7:	eb 02                	jmp    803fcb <fork+0x1f3>
+  803fc9:	89 c7                	mov    %eax,%edi
+}
+  803fcb:	89 f8                	mov    %edi,%eax
+  803fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fd0:	5b                   	pop    %ebx
+  803fd1:	5e                   	pop    %esi
+  803fd2:	5f                   	pop    %edi
+  803fd3:	5d                   	pop    %ebp
+  803fd4:	c3                   	ret
+
+00803fd5 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fd5:	55                   	push   %ebp
+  803fd6:	89 e5                	mov    %esp,%ebp
+  803fd8:	57                   	push   %edi
+  803fd9:	56                   	push   %esi
+  803fda:	53                   	push   %ebx
+  803fdb:	83 ec 2c             	sub    $0x2c,%esp
+  803fde:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803feb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ff1:	77 0a                	ja     803ffd <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ff3:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803ff8:	29 c3                	sub    %eax,%ebx
+  803ffa:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ffd:	83 ec 0c             	sub    $0xc,%esp
+  804000:	68 3b 3d 80 00       	push   $0x803d3b
+  804005:	e8 f1 03 00 00       	call   8043fb <set_pgfault_handler>
+  80400a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80400f:	cd 30                	int    $0x30
+  804011:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804014:	83 c4 10             	add    $0x10,%esp
+  804017:	85 c0                	test   %eax,%eax
+  804019:	78 30                	js     80404b <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80401b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80401f:	74 42                	je     804063 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804021:	c1 e3 10             	shl    $0x10,%ebx
+  804024:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804029:	29 d8                	sub    %ebx,%eax
+  80402b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80402e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804033:	29 d8                	sub    %ebx,%eax
+  804035:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804038:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80403d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804042:	89 f7                	mov    %esi,%edi
+  804044:	89 d6                	mov    %edx,%esi
+  804046:	e9 2c 01 00 00       	jmp    804177 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80404b:	83 ec 08             	sub    $0x8,%esp
+  80404e:	89 c7                	mov    %eax,%edi
+  804050:	50                   	push   %eax
+  804051:	68 f9 4d 80 00       	push   $0x804df9
+  804056:	e8 3b f2 ff ff       	call   803296 <cprintf>
+		return eid;
+  80405b:	83 c4 10             	add    $0x10,%esp
+  80405e:	e9 d5 00 00 00       	jmp    804138 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804063:	e8 1b c1 ff ff       	call   800183 <sys_getenvid>
+  804068:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80406d:	89 c2                	mov    %eax,%edx
+  80406f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804071:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804077:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80407c:	77 18                	ja     804096 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80407e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804083:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804085:	c1 e8 10             	shr    $0x10,%eax
+  804088:	74 0c                	je     804096 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80408a:	c1 e0 10             	shl    $0x10,%eax
+  80408d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804092:	29 c1                	sub    %eax,%ecx
+  804094:	eb 06                	jmp    80409c <sfork+0xc7>
+		return pthread_main_tls;
+  804096:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  80409c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80409f:	c1 e0 04             	shl    $0x4,%eax
+  8040a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040a7:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040a9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040ac:	e9 87 00 00 00       	jmp    804138 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040b1:	f6 c5 04             	test   $0x4,%ch
+  8040b4:	74 6c                	je     804122 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040b6:	89 ca                	mov    %ecx,%edx
+  8040b8:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040be:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040c4:	74 7c                	je     804142 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040c6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040cc:	89 da                	mov    %ebx,%edx
+  8040ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040d1:	e8 67 fb ff ff       	call   803c3d <duppage>
+  8040d6:	85 c0                	test   %eax,%eax
+  8040d8:	0f 88 4f 01 00 00    	js     80422d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040de:	83 c3 01             	add    $0x1,%ebx
+  8040e1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040e4:	74 7a                	je     804160 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040e6:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040e8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040ef:	f6 c1 01             	test   $0x1,%cl
+  8040f2:	74 ea                	je     8040de <sfork+0x109>
+  8040f4:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040fa:	74 e2                	je     8040de <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8040fc:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804102:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804105:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80410a:	76 a5                	jbe    8040b1 <sfork+0xdc>
+  80410c:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804112:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804115:	39 fa                	cmp    %edi,%edx
+  804117:	73 9d                	jae    8040b6 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804119:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80411c:	39 fa                	cmp    %edi,%edx
+  80411e:	72 96                	jb     8040b6 <sfork+0xe1>
+  804120:	eb 8f                	jmp    8040b1 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804122:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804128:	89 da                	mov    %ebx,%edx
+  80412a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80412d:	e8 8c fa ff ff       	call   803bbe <duppage_cow>
+  804132:	85 c0                	test   %eax,%eax
+  804134:	79 a8                	jns    8040de <sfork+0x109>
+  804136:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804138:	89 f8                	mov    %edi,%eax
+  80413a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80413d:	5b                   	pop    %ebx
+  80413e:	5e                   	pop    %esi
+  80413f:	5f                   	pop    %edi
+  804140:	5d                   	pop    %ebp
+  804141:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804142:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804147:	e8 2e fb ff ff       	call   803c7a <cow_copy>
+  80414c:	85 c0                	test   %eax,%eax
+  80414e:	0f 88 d2 00 00 00    	js     804226 <sfork+0x251>
+				pte = uvpt[pn];
+  804154:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80415b:	e9 66 ff ff ff       	jmp    8040c6 <sfork+0xf1>
+  804160:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804163:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804166:	83 c6 01             	add    $0x1,%esi
+  804169:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80416f:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804175:	74 1b                	je     804192 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804177:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80417e:	a8 01                	test   $0x1,%al
+  804180:	74 e4                	je     804166 <sfork+0x191>
+  804182:	89 f3                	mov    %esi,%ebx
+  804184:	c1 e3 0a             	shl    $0xa,%ebx
+  804187:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80418a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80418d:	e9 4f ff ff ff       	jmp    8040e1 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804192:	83 ec 04             	sub    $0x4,%esp
+  804195:	6a 07                	push   $0x7
+  804197:	68 00 f0 bf ee       	push   $0xeebff000
+  80419c:	ff 75 e0             	push   -0x20(%ebp)
+  80419f:	e8 37 c0 ff ff       	call   8001db <sys_page_alloc>
+  8041a4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041a6:	83 c4 10             	add    $0x10,%esp
+  8041a9:	85 c0                	test   %eax,%eax
+  8041ab:	78 37                	js     8041e4 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041ad:	83 ec 08             	sub    $0x8,%esp
+  8041b0:	68 39 44 80 00       	push   $0x804439
+  8041b5:	ff 75 e0             	push   -0x20(%ebp)
+  8041b8:	e8 9b c1 ff ff       	call   800358 <sys_env_set_pgfault_upcall>
+  8041bd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041bf:	83 c4 10             	add    $0x10,%esp
+  8041c2:	85 c0                	test   %eax,%eax
+  8041c4:	78 34                	js     8041fa <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041c6:	83 ec 08             	sub    $0x8,%esp
+  8041c9:	6a 02                	push   $0x2
+  8041cb:	ff 75 e0             	push   -0x20(%ebp)
+  8041ce:	e8 ed c0 ff ff       	call   8002c0 <sys_env_set_status>
+  8041d3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041d5:	83 c4 10             	add    $0x10,%esp
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	78 34                	js     804210 <sfork+0x23b>
+	return eid;
+  8041dc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041df:	e9 54 ff ff ff       	jmp    804138 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041e4:	83 ec 08             	sub    $0x8,%esp
+  8041e7:	50                   	push   %eax
+  8041e8:	68 6c 4d 80 00       	push   $0x804d6c
+  8041ed:	e8 a4 f0 ff ff       	call   803296 <cprintf>
+		return r;
+  8041f2:	83 c4 10             	add    $0x10,%esp
+  8041f5:	e9 3e ff ff ff       	jmp    804138 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041fa:	83 ec 08             	sub    $0x8,%esp
+  8041fd:	50                   	push   %eax
+  8041fe:	68 94 4d 80 00       	push   $0x804d94
+  804203:	e8 8e f0 ff ff       	call   803296 <cprintf>
+		return r;
+  804208:	83 c4 10             	add    $0x10,%esp
+  80420b:	e9 28 ff ff ff       	jmp    804138 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804210:	83 ec 08             	sub    $0x8,%esp
+  804213:	50                   	push   %eax
+  804214:	68 09 4e 80 00       	push   $0x804e09
+  804219:	e8 78 f0 ff ff       	call   803296 <cprintf>
+		return r;
+  80421e:	83 c4 10             	add    $0x10,%esp
+  804221:	e9 12 ff ff ff       	jmp    804138 <sfork+0x163>
+  804226:	89 c7                	mov    %eax,%edi
+  804228:	e9 0b ff ff ff       	jmp    804138 <sfork+0x163>
+  80422d:	89 c7                	mov    %eax,%edi
+  80422f:	e9 04 ff ff ff       	jmp    804138 <sfork+0x163>
+
+00804234 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804234:	55                   	push   %ebp
+  804235:	89 e5                	mov    %esp,%ebp
+  804237:	57                   	push   %edi
+  804238:	56                   	push   %esi
+  804239:	53                   	push   %ebx
+  80423a:	83 ec 18             	sub    $0x18,%esp
+  80423d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804240:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804243:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804246:	85 c0                	test   %eax,%eax
+  804248:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80424d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804250:	50                   	push   %eax
+  804251:	e8 7b c1 ff ff       	call   8003d1 <sys_ipc_recv>
+	if (r < 0) {
+  804256:	83 c4 10             	add    $0x10,%esp
+  804259:	85 c0                	test   %eax,%eax
+  80425b:	78 2b                	js     804288 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80425d:	85 ff                	test   %edi,%edi
+  80425f:	74 55                	je     8042b6 <ipc_recv+0x82>
+  804261:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804263:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804269:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80426e:	77 39                	ja     8042a9 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804270:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804275:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804277:	c1 e8 10             	shr    $0x10,%eax
+  80427a:	74 2d                	je     8042a9 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80427c:	c1 e0 10             	shl    $0x10,%eax
+  80427f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804284:	29 c2                	sub    %eax,%edx
+  804286:	eb 27                	jmp    8042af <ipc_recv+0x7b>
+  804288:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80428a:	83 ec 08             	sub    $0x8,%esp
+  80428d:	50                   	push   %eax
+  80428e:	68 27 4e 80 00       	push   $0x804e27
+  804293:	e8 fe ef ff ff       	call   803296 <cprintf>
+		*from_env_store = 0;
+  804298:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80429e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042a4:	83 c4 10             	add    $0x10,%esp
+  8042a7:	eb 77                	jmp    804320 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042a9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042af:	8b 02                	mov    (%edx),%eax
+  8042b1:	8b 40 78             	mov    0x78(%eax),%eax
+  8042b4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042b6:	85 f6                	test   %esi,%esi
+  8042b8:	74 34                	je     8042ee <ipc_recv+0xba>
+  8042ba:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042bc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042c2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042c7:	77 18                	ja     8042e1 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042ce:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042d0:	c1 e8 10             	shr    $0x10,%eax
+  8042d3:	74 0c                	je     8042e1 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042d5:	c1 e0 10             	shl    $0x10,%eax
+  8042d8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042dd:	29 c2                	sub    %eax,%edx
+  8042df:	eb 06                	jmp    8042e7 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042e1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042e7:	8b 02                	mov    (%edx),%eax
+  8042e9:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042ec:	89 06                	mov    %eax,(%esi)
+  8042ee:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042f0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042fb:	77 18                	ja     804315 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804302:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804304:	c1 e8 10             	shr    $0x10,%eax
+  804307:	74 0c                	je     804315 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804309:	c1 e0 10             	shl    $0x10,%eax
+  80430c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804311:	29 c2                	sub    %eax,%edx
+  804313:	eb 06                	jmp    80431b <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804315:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80431b:	8b 02                	mov    (%edx),%eax
+  80431d:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804320:	89 d8                	mov    %ebx,%eax
+  804322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804325:	5b                   	pop    %ebx
+  804326:	5e                   	pop    %esi
+  804327:	5f                   	pop    %edi
+  804328:	5d                   	pop    %ebp
+  804329:	c3                   	ret
+
+0080432a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80432a:	55                   	push   %ebp
+  80432b:	89 e5                	mov    %esp,%ebp
+  80432d:	57                   	push   %edi
+  80432e:	56                   	push   %esi
+  80432f:	53                   	push   %ebx
+  804330:	83 ec 0c             	sub    $0xc,%esp
+  804333:	8b 75 08             	mov    0x8(%ebp),%esi
+  804336:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804339:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80433c:	85 db                	test   %ebx,%ebx
+  80433e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804343:	0f 44 d8             	cmove  %eax,%ebx
+  804346:	eb 05                	jmp    80434d <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804348:	e8 62 be ff ff       	call   8001af <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80434d:	57                   	push   %edi
+  80434e:	53                   	push   %ebx
+  80434f:	ff 75 0c             	push   0xc(%ebp)
+  804352:	56                   	push   %esi
+  804353:	e8 4c c0 ff ff       	call   8003a4 <sys_ipc_try_send>
+		if (r == 0) {
+  804358:	83 c4 10             	add    $0x10,%esp
+  80435b:	85 c0                	test   %eax,%eax
+  80435d:	74 19                	je     804378 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80435f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804362:	74 e4                	je     804348 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804364:	83 ec 0c             	sub    $0xc,%esp
+  804367:	50                   	push   %eax
+  804368:	57                   	push   %edi
+  804369:	53                   	push   %ebx
+  80436a:	56                   	push   %esi
+  80436b:	68 40 4e 80 00       	push   $0x804e40
+  804370:	e8 21 ef ff ff       	call   803296 <cprintf>
+			return;
+  804375:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80437b:	5b                   	pop    %ebx
+  80437c:	5e                   	pop    %esi
+  80437d:	5f                   	pop    %edi
+  80437e:	5d                   	pop    %ebp
+  80437f:	c3                   	ret
+
+00804380 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804380:	55                   	push   %ebp
+  804381:	89 e5                	mov    %esp,%ebp
+  804383:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804386:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80438b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80438e:	c1 e0 04             	shl    $0x4,%eax
+  804391:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804396:	8b 40 50             	mov    0x50(%eax),%eax
+  804399:	39 c8                	cmp    %ecx,%eax
+  80439b:	74 12                	je     8043af <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80439d:	83 c2 01             	add    $0x1,%edx
+  8043a0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043a6:	75 e3                	jne    80438b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ad:	eb 0e                	jmp    8043bd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043af:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043b2:	c1 e0 04             	shl    $0x4,%eax
+  8043b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043ba:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043bd:	5d                   	pop    %ebp
+  8043be:	c3                   	ret
+
+008043bf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043bf:	55                   	push   %ebp
+  8043c0:	89 e5                	mov    %esp,%ebp
+  8043c2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043c5:	89 c2                	mov    %eax,%edx
+  8043c7:	c1 ea 16             	shr    $0x16,%edx
+  8043ca:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043d1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043d6:	f6 c1 01             	test   $0x1,%cl
+  8043d9:	74 1c                	je     8043f7 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043db:	c1 e8 0c             	shr    $0xc,%eax
+  8043de:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043e5:	a8 01                	test   $0x1,%al
+  8043e7:	74 0e                	je     8043f7 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043e9:	c1 e8 0c             	shr    $0xc,%eax
+  8043ec:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043f3:	ef 
+  8043f4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043f7:	89 d0                	mov    %edx,%eax
+  8043f9:	5d                   	pop    %ebp
+  8043fa:	c3                   	ret
+
+008043fb <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043fb:	55                   	push   %ebp
+  8043fc:	89 e5                	mov    %esp,%ebp
+  8043fe:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804401:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804408:	74 0a                	je     804414 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80440a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80440d:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804412:	c9                   	leave
+  804413:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804414:	83 ec 04             	sub    $0x4,%esp
+  804417:	6a 07                	push   $0x7
+  804419:	68 00 f0 bf ee       	push   $0xeebff000
+  80441e:	6a 00                	push   $0x0
+  804420:	e8 b6 bd ff ff       	call   8001db <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804425:	83 c4 08             	add    $0x8,%esp
+  804428:	68 39 44 80 00       	push   $0x804439
+  80442d:	6a 00                	push   $0x0
+  80442f:	e8 24 bf ff ff       	call   800358 <sys_env_set_pgfault_upcall>
+  804434:	83 c4 10             	add    $0x10,%esp
+  804437:	eb d1                	jmp    80440a <set_pgfault_handler+0xf>
+
+00804439 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804439:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80443a:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80443f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804441:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804444:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804448:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80444c:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80444f:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804453:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804455:	83 c4 08             	add    $0x8,%esp
+	popal
+  804458:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804459:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80445c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80445d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80445e:	c3                   	ret
+
+0080445f <udm>:
+  80445f:	57                   	push   %edi
+  804460:	56                   	push   %esi
+  804461:	53                   	push   %ebx
+  804462:	83 ec 20             	sub    $0x20,%esp
+  804465:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804469:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80446d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804471:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804475:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804479:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80447d:	89 d1                	mov    %edx,%ecx
+  80447f:	09 c1                	or     %eax,%ecx
+  804481:	0f 84 91 00 00 00    	je     804518 <udm+0xb9>
+  804487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804491:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804496:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80449d:	00 
+  80449e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044a5:	00 
+  8044a6:	eb 08                	jmp    8044b0 <udm+0x51>
+  8044a8:	83 e9 01             	sub    $0x1,%ecx
+  8044ab:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044ae:	74 7c                	je     80452c <udm+0xcd>
+  8044b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044b4:	01 c0                	add    %eax,%eax
+  8044b6:	89 c6                	mov    %eax,%esi
+  8044b8:	89 d7                	mov    %edx,%edi
+  8044ba:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044be:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044c5:	d3 ea                	shr    %cl,%edx
+  8044c7:	f6 c1 20             	test   $0x20,%cl
+  8044ca:	74 04                	je     8044d0 <udm+0x71>
+  8044cc:	89 d0                	mov    %edx,%eax
+  8044ce:	31 d2                	xor    %edx,%edx
+  8044d0:	83 e0 01             	and    $0x1,%eax
+  8044d3:	89 04 24             	mov    %eax,(%esp)
+  8044d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044dd:	00 
+  8044de:	8b 04 24             	mov    (%esp),%eax
+  8044e1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044e5:	09 f0                	or     %esi,%eax
+  8044e7:	09 fa                	or     %edi,%edx
+  8044e9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044ed:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044f1:	39 f0                	cmp    %esi,%eax
+  8044f3:	89 d3                	mov    %edx,%ebx
+  8044f5:	19 fb                	sbb    %edi,%ebx
+  8044f7:	72 af                	jb     8044a8 <udm+0x49>
+  8044f9:	29 f0                	sub    %esi,%eax
+  8044fb:	19 fa                	sbb    %edi,%edx
+  8044fd:	89 cf                	mov    %ecx,%edi
+  8044ff:	c1 ef 05             	shr    $0x5,%edi
+  804502:	83 e7 01             	and    $0x1,%edi
+  804505:	89 fe                	mov    %edi,%esi
+  804507:	83 f6 01             	xor    $0x1,%esi
+  80450a:	d3 e6                	shl    %cl,%esi
+  80450c:	d3 e7                	shl    %cl,%edi
+  80450e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804512:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804516:	eb 90                	jmp    8044a8 <udm+0x49>
+  804518:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80451c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804520:	89 f0                	mov    %esi,%eax
+  804522:	89 fa                	mov    %edi,%edx
+  804524:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804528:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80452c:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804530:	89 01                	mov    %eax,(%ecx)
+  804532:	89 51 04             	mov    %edx,0x4(%ecx)
+  804535:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804539:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80453d:	83 c4 20             	add    $0x20,%esp
+  804540:	5b                   	pop    %ebx
+  804541:	5e                   	pop    %esi
+  804542:	5f                   	pop    %edi
+  804543:	c3                   	ret
+
+00804544 <__udivdi3>:
+  804544:	83 ec 18             	sub    $0x18,%esp
+  804547:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80454b:	50                   	push   %eax
+  80454c:	ff 74 24 2c          	push   0x2c(%esp)
+  804550:	ff 74 24 2c          	push   0x2c(%esp)
+  804554:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804558:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80455c:	e8 fe fe ff ff       	call   80445f <udm>
+  804561:	83 c4 24             	add    $0x24,%esp
+  804564:	c3                   	ret
+
+00804565 <__umoddi3>:
+  804565:	83 ec 18             	sub    $0x18,%esp
+  804568:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80456c:	50                   	push   %eax
+  80456d:	ff 74 24 2c          	push   0x2c(%esp)
+  804571:	ff 74 24 2c          	push   0x2c(%esp)
+  804575:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804579:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80457d:	e8 dd fe ff ff       	call   80445f <udm>
+  804582:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804586:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80458a:	83 c4 24             	add    $0x24,%esp
+  80458d:	c3                   	ret
+
+0080458e <__divdi3>:
+  80458e:	56                   	push   %esi
+  80458f:	53                   	push   %ebx
+  804590:	83 ec 14             	sub    $0x14,%esp
+  804593:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804597:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80459b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80459f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045a3:	85 d2                	test   %edx,%edx
+  8045a5:	78 18                	js     8045bf <__divdi3+0x31>
+  8045a7:	85 db                	test   %ebx,%ebx
+  8045a9:	78 3e                	js     8045e9 <__divdi3+0x5b>
+  8045ab:	83 ec 04             	sub    $0x4,%esp
+  8045ae:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045b2:	56                   	push   %esi
+  8045b3:	53                   	push   %ebx
+  8045b4:	51                   	push   %ecx
+  8045b5:	e8 a5 fe ff ff       	call   80445f <udm>
+  8045ba:	83 c4 10             	add    $0x10,%esp
+  8045bd:	eb 24                	jmp    8045e3 <__divdi3+0x55>
+  8045bf:	f7 d8                	neg    %eax
+  8045c1:	83 d2 00             	adc    $0x0,%edx
+  8045c4:	f7 da                	neg    %edx
+  8045c6:	85 db                	test   %ebx,%ebx
+  8045c8:	78 3a                	js     804604 <__divdi3+0x76>
+  8045ca:	83 ec 04             	sub    $0x4,%esp
+  8045cd:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045d1:	56                   	push   %esi
+  8045d2:	53                   	push   %ebx
+  8045d3:	51                   	push   %ecx
+  8045d4:	e8 86 fe ff ff       	call   80445f <udm>
+  8045d9:	83 c4 10             	add    $0x10,%esp
+  8045dc:	f7 d8                	neg    %eax
+  8045de:	83 d2 00             	adc    $0x0,%edx
+  8045e1:	f7 da                	neg    %edx
+  8045e3:	83 c4 14             	add    $0x14,%esp
+  8045e6:	5b                   	pop    %ebx
+  8045e7:	5e                   	pop    %esi
+  8045e8:	c3                   	ret
+  8045e9:	83 ec 04             	sub    $0x4,%esp
+  8045ec:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045f0:	56                   	push   %esi
+  8045f1:	f7 d9                	neg    %ecx
+  8045f3:	83 d3 00             	adc    $0x0,%ebx
+  8045f6:	f7 db                	neg    %ebx
+  8045f8:	53                   	push   %ebx
+  8045f9:	51                   	push   %ecx
+  8045fa:	e8 60 fe ff ff       	call   80445f <udm>
+  8045ff:	83 c4 10             	add    $0x10,%esp
+  804602:	eb d8                	jmp    8045dc <__divdi3+0x4e>
+  804604:	83 ec 04             	sub    $0x4,%esp
+  804607:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80460b:	56                   	push   %esi
+  80460c:	f7 d9                	neg    %ecx
+  80460e:	83 d3 00             	adc    $0x0,%ebx
+  804611:	f7 db                	neg    %ebx
+  804613:	53                   	push   %ebx
+  804614:	51                   	push   %ecx
+  804615:	e8 45 fe ff ff       	call   80445f <udm>
+  80461a:	83 c4 10             	add    $0x10,%esp
+  80461d:	eb c4                	jmp    8045e3 <__divdi3+0x55>
+
+0080461f <__moddi3>:
+  80461f:	55                   	push   %ebp
+  804620:	57                   	push   %edi
+  804621:	56                   	push   %esi
+  804622:	53                   	push   %ebx
+  804623:	83 ec 24             	sub    $0x24,%esp
+  804626:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80462a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80462e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804632:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804636:	85 d2                	test   %edx,%edx
+  804638:	78 3b                	js     804675 <__moddi3+0x56>
+  80463a:	83 ec 04             	sub    $0x4,%esp
+  80463d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804641:	56                   	push   %esi
+  804642:	89 ce                	mov    %ecx,%esi
+  804644:	f7 de                	neg    %esi
+  804646:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80464a:	89 de                	mov    %ebx,%esi
+  80464c:	83 d6 00             	adc    $0x0,%esi
+  80464f:	f7 de                	neg    %esi
+  804651:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804655:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804659:	0f 48 f1             	cmovs  %ecx,%esi
+  80465c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804661:	53                   	push   %ebx
+  804662:	56                   	push   %esi
+  804663:	e8 f7 fd ff ff       	call   80445f <udm>
+  804668:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80466c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804670:	83 c4 10             	add    $0x10,%esp
+  804673:	eb 47                	jmp    8046bc <__moddi3+0x9d>
+  804675:	f7 d8                	neg    %eax
+  804677:	83 d2 00             	adc    $0x0,%edx
+  80467a:	f7 da                	neg    %edx
+  80467c:	83 ec 04             	sub    $0x4,%esp
+  80467f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804683:	56                   	push   %esi
+  804684:	89 cf                	mov    %ecx,%edi
+  804686:	f7 df                	neg    %edi
+  804688:	89 de                	mov    %ebx,%esi
+  80468a:	83 d6 00             	adc    $0x0,%esi
+  80468d:	f7 de                	neg    %esi
+  80468f:	0f 49 cf             	cmovns %edi,%ecx
+  804692:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804696:	0f 49 de             	cmovns %esi,%ebx
+  804699:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80469d:	ff 74 24 0c          	push   0xc(%esp)
+  8046a1:	ff 74 24 0c          	push   0xc(%esp)
+  8046a5:	e8 b5 fd ff ff       	call   80445f <udm>
+  8046aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046ae:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046b2:	f7 d8                	neg    %eax
+  8046b4:	83 d2 00             	adc    $0x0,%edx
+  8046b7:	f7 da                	neg    %edx
+  8046b9:	83 c4 10             	add    $0x10,%esp
+  8046bc:	83 c4 24             	add    $0x24,%esp
+  8046bf:	5b                   	pop    %ebx
+  8046c0:	5e                   	pop    %esi
+  8046c1:	5f                   	pop    %edi
+  8046c2:	5d                   	pop    %ebp
+  8046c3:	c3                   	ret
@@ -0,0 +1,9767 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 a3 0b 00 00       	call   800be5 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 80 47 80 00       	push   $0x804780
+  80004c:	e8 ca 01 00 00       	call   80021b <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 41 07 00 00       	call   8007c4 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 91 47 80 00       	push   $0x804791
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 fe 06 00 00       	call   8007aa <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 45 12 00 00       	call   8012f9 <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 95 00 00 00       	call   80015e <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 90 47 80 00       	push   $0x804790
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	57                   	push   %edi
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	83 ec 1c             	sub    $0x1c,%esp
+  8000ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000f2:	e8 ee 0a 00 00       	call   800be5 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000f7:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000fa:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800100:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800105:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800107:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800109:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80010f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800114:	77 16                	ja     80012c <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800116:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80011b:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80011d:	c1 e8 10             	shr    $0x10,%eax
+  800120:	74 0a                	je     80012c <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800122:	c1 e0 10             	shl    $0x10,%eax
+  800125:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80012a:	29 c2                	sub    %eax,%edx
+  80012c:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80012f:	c1 e0 04             	shl    $0x4,%eax
+  800132:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800137:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800139:	85 db                	test   %ebx,%ebx
+  80013b:	7e 07                	jle    800144 <libmain+0x61>
+		binaryname = argv[0];
+  80013d:	8b 06                	mov    (%esi),%eax
+  80013f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800144:	83 ec 08             	sub    $0x8,%esp
+  800147:	56                   	push   %esi
+  800148:	53                   	push   %ebx
+  800149:	e8 80 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80014e:	e8 0b 00 00 00       	call   80015e <exit>
+}
+  800153:	83 c4 10             	add    $0x10,%esp
+  800156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+
+0080015e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800164:	6a 00                	push   $0x0
+  800166:	e8 45 27 00 00       	call   8028b0 <fflush>
+	pthread_kill_others();
+  80016b:	e8 b0 3d 00 00       	call   803f20 <pthread_kill_others>
+	close_all();
+  800170:	e8 de 17 00 00       	call   801953 <close_all>
+	sys_env_destroy(0);
+  800175:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80017c:	e8 19 0a 00 00       	call   800b9a <sys_env_destroy>
+}
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+00800186 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	53                   	push   %ebx
+  80018a:	83 ec 04             	sub    $0x4,%esp
+  80018d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800190:	8b 13                	mov    (%ebx),%edx
+  800192:	8d 42 01             	lea    0x1(%edx),%eax
+  800195:	89 03                	mov    %eax,(%ebx)
+  800197:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80019e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a3:	74 09                	je     8001ae <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ac:	c9                   	leave
+  8001ad:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ae:	83 ec 08             	sub    $0x8,%esp
+  8001b1:	68 ff 00 00 00       	push   $0xff
+  8001b6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b9:	50                   	push   %eax
+  8001ba:	e8 84 09 00 00       	call   800b43 <sys_cputs>
+		b->idx = 0;
+  8001bf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c5:	83 c4 10             	add    $0x10,%esp
+  8001c8:	eb db                	jmp    8001a5 <putch+0x1f>
+
+008001ca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001da:	00 00 00 
+	b.cnt = 0;
+  8001dd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e7:	ff 75 0c             	push   0xc(%ebp)
+  8001ea:	ff 75 08             	push   0x8(%ebp)
+  8001ed:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f3:	50                   	push   %eax
+  8001f4:	68 86 01 80 00       	push   $0x800186
+  8001f9:	e8 14 01 00 00       	call   800312 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001fe:	83 c4 08             	add    $0x8,%esp
+  800201:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800207:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80020d:	50                   	push   %eax
+  80020e:	e8 30 09 00 00       	call   800b43 <sys_cputs>
+
+	return b.cnt;
+}
+  800213:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+
+0080021b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80021b:	55                   	push   %ebp
+  80021c:	89 e5                	mov    %esp,%ebp
+  80021e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800221:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800224:	50                   	push   %eax
+  800225:	ff 75 08             	push   0x8(%ebp)
+  800228:	e8 9d ff ff ff       	call   8001ca <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+
+0080022f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	57                   	push   %edi
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+  800235:	83 ec 1c             	sub    $0x1c,%esp
+  800238:	89 c7                	mov    %eax,%edi
+  80023a:	89 d6                	mov    %edx,%esi
+  80023c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800242:	89 d1                	mov    %edx,%ecx
+  800244:	89 c2                	mov    %eax,%edx
+  800246:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800249:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80024c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80024f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800252:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800255:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025c:	39 c2                	cmp    %eax,%edx
+  80025e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800261:	72 3e                	jb     8002a1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  800266:	ff 75 18             	push   0x18(%ebp)
+  800269:	83 eb 01             	sub    $0x1,%ebx
+  80026c:	53                   	push   %ebx
+  80026d:	50                   	push   %eax
+  80026e:	83 ec 08             	sub    $0x8,%esp
+  800271:	ff 75 e4             	push   -0x1c(%ebp)
+  800274:	ff 75 e0             	push   -0x20(%ebp)
+  800277:	ff 75 dc             	push   -0x24(%ebp)
+  80027a:	ff 75 d8             	push   -0x28(%ebp)
+  80027d:	e8 67 43 00 00       	call   8045e9 <__udivdi3>
+  800282:	83 c4 18             	add    $0x18,%esp
+  800285:	52                   	push   %edx
+  800286:	50                   	push   %eax
+  800287:	89 f2                	mov    %esi,%edx
+  800289:	89 f8                	mov    %edi,%eax
+  80028b:	e8 9f ff ff ff       	call   80022f <printnum>
+  800290:	83 c4 20             	add    $0x20,%esp
+  800293:	eb 13                	jmp    8002a8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	56                   	push   %esi
+  800299:	ff 75 18             	push   0x18(%ebp)
+  80029c:	ff d7                	call   *%edi
+  80029e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002a1:	83 eb 01             	sub    $0x1,%ebx
+  8002a4:	85 db                	test   %ebx,%ebx
+  8002a6:	7f ed                	jg     800295 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+  8002ab:	56                   	push   %esi
+  8002ac:	83 ec 04             	sub    $0x4,%esp
+  8002af:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b2:	ff 75 e0             	push   -0x20(%ebp)
+  8002b5:	ff 75 dc             	push   -0x24(%ebp)
+  8002b8:	ff 75 d8             	push   -0x28(%ebp)
+  8002bb:	e8 4a 43 00 00       	call   80460a <__umoddi3>
+  8002c0:	83 c4 14             	add    $0x14,%esp
+  8002c3:	0f be 80 a0 47 80 00 	movsbl 0x8047a0(%eax),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	ff d7                	call   *%edi
+}
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d3:	5b                   	pop    %ebx
+  8002d4:	5e                   	pop    %esi
+  8002d5:	5f                   	pop    %edi
+  8002d6:	5d                   	pop    %ebp
+  8002d7:	c3                   	ret
+
+008002d8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d8:	55                   	push   %ebp
+  8002d9:	89 e5                	mov    %esp,%ebp
+  8002db:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002de:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002e2:	8b 10                	mov    (%eax),%edx
+  8002e4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e7:	73 0a                	jae    8002f3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ec:	89 08                	mov    %ecx,(%eax)
+  8002ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f1:	88 02                	mov    %al,(%edx)
+}
+  8002f3:	5d                   	pop    %ebp
+  8002f4:	c3                   	ret
+
+008002f5 <printfmt>:
+{
+  8002f5:	55                   	push   %ebp
+  8002f6:	89 e5                	mov    %esp,%ebp
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002fb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002fe:	50                   	push   %eax
+  8002ff:	ff 75 10             	push   0x10(%ebp)
+  800302:	ff 75 0c             	push   0xc(%ebp)
+  800305:	ff 75 08             	push   0x8(%ebp)
+  800308:	e8 05 00 00 00       	call   800312 <vprintfmt>
+}
+  80030d:	83 c4 10             	add    $0x10,%esp
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+00800312 <vprintfmt>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	57                   	push   %edi
+  800316:	56                   	push   %esi
+  800317:	53                   	push   %ebx
+  800318:	83 ec 2c             	sub    $0x2c,%esp
+  80031b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80031e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800321:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800324:	eb 0a                	jmp    800330 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	53                   	push   %ebx
+  80032a:	50                   	push   %eax
+  80032b:	ff d6                	call   *%esi
+  80032d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800330:	83 c7 01             	add    $0x1,%edi
+  800333:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800337:	83 f8 25             	cmp    $0x25,%eax
+  80033a:	74 0c                	je     800348 <vprintfmt+0x36>
+			if (ch == '\0')
+  80033c:	85 c0                	test   %eax,%eax
+  80033e:	75 e6                	jne    800326 <vprintfmt+0x14>
+}
+  800340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800343:	5b                   	pop    %ebx
+  800344:	5e                   	pop    %esi
+  800345:	5f                   	pop    %edi
+  800346:	5d                   	pop    %ebp
+  800347:	c3                   	ret
+		padc = ' ';
+  800348:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80034c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800353:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80035a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800361:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800366:	8d 47 01             	lea    0x1(%edi),%eax
+  800369:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036c:	0f b6 17             	movzbl (%edi),%edx
+  80036f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800372:	3c 55                	cmp    $0x55,%al
+  800374:	0f 87 c5 03 00 00    	ja     80073f <vprintfmt+0x42d>
+  80037a:	0f b6 c0             	movzbl %al,%eax
+  80037d:	ff 24 85 20 49 80 00 	jmp    *0x804920(,%eax,4)
+  800384:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038a:	eb da                	jmp    800366 <vprintfmt+0x54>
+  80038c:	0f be d2             	movsbl %dl,%edx
+  80038f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800392:	b8 00 00 00 00       	mov    $0x0,%eax
+  800397:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80039a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80039d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003a1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003a4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003a7:	83 f9 09             	cmp    $0x9,%ecx
+  8003aa:	77 55                	ja     800401 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003ac:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003af:	eb e9                	jmp    80039a <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8b 00                	mov    (%eax),%eax
+  8003b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8003bf:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c9:	79 9b                	jns    800366 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d8:	eb 8c                	jmp    800366 <vprintfmt+0x54>
+			if (width < 0)
+  8003da:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003dd:	85 d2                	test   %edx,%edx
+  8003df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e4:	0f 49 c2             	cmovns %edx,%eax
+  8003e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ed:	e9 74 ff ff ff       	jmp    800366 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003f5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003fc:	e9 65 ff ff ff       	jmp    800366 <vprintfmt+0x54>
+  800401:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800404:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800407:	eb bc                	jmp    8003c5 <vprintfmt+0xb3>
+			lflag++;
+  800409:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80040c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040f:	e9 52 ff ff ff       	jmp    800366 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 78 04             	lea    0x4(%eax),%edi
+  80041a:	83 ec 08             	sub    $0x8,%esp
+  80041d:	53                   	push   %ebx
+  80041e:	ff 30                	push   (%eax)
+  800420:	ff d6                	call   *%esi
+			break;
+  800422:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800425:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800428:	e9 b1 02 00 00       	jmp    8006de <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800433:	8b 10                	mov    (%eax),%edx
+  800435:	89 d0                	mov    %edx,%eax
+  800437:	f7 d8                	neg    %eax
+  800439:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80043c:	83 f8 14             	cmp    $0x14,%eax
+  80043f:	7f 23                	jg     800464 <vprintfmt+0x152>
+  800441:	8b 14 85 80 4a 80 00 	mov    0x804a80(,%eax,4),%edx
+  800448:	85 d2                	test   %edx,%edx
+  80044a:	74 18                	je     800464 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80044c:	52                   	push   %edx
+  80044d:	68 c3 4c 80 00       	push   $0x804cc3
+  800452:	53                   	push   %ebx
+  800453:	56                   	push   %esi
+  800454:	e8 9c fe ff ff       	call   8002f5 <printfmt>
+  800459:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80045f:	e9 7a 02 00 00       	jmp    8006de <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800464:	50                   	push   %eax
+  800465:	68 b8 47 80 00       	push   $0x8047b8
+  80046a:	53                   	push   %ebx
+  80046b:	56                   	push   %esi
+  80046c:	e8 84 fe ff ff       	call   8002f5 <printfmt>
+  800471:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800474:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800477:	e9 62 02 00 00       	jmp    8006de <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80047c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047f:	83 c0 04             	add    $0x4,%eax
+  800482:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80048a:	85 c9                	test   %ecx,%ecx
+  80048c:	b8 b1 47 80 00       	mov    $0x8047b1,%eax
+  800491:	0f 45 c1             	cmovne %ecx,%eax
+  800494:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800497:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80049b:	7e 06                	jle    8004a3 <vprintfmt+0x191>
+  80049d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004a1:	75 0b                	jne    8004ae <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004a6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ac:	eb 5c                	jmp    80050a <vprintfmt+0x1f8>
+  8004ae:	83 ec 08             	sub    $0x8,%esp
+  8004b1:	ff 75 d0             	push   -0x30(%ebp)
+  8004b4:	ff 75 cc             	push   -0x34(%ebp)
+  8004b7:	e8 20 03 00 00       	call   8007dc <strnlen>
+  8004bc:	89 c2                	mov    %eax,%edx
+  8004be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c1:	29 d0                	sub    %edx,%eax
+  8004c3:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004c6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d0:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d2:	eb 0e                	jmp    8004e2 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004d4:	83 ec 08             	sub    $0x8,%esp
+  8004d7:	53                   	push   %ebx
+  8004d8:	57                   	push   %edi
+  8004d9:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dc:	83 ee 01             	sub    $0x1,%esi
+  8004df:	83 c4 10             	add    $0x10,%esp
+  8004e2:	85 f6                	test   %esi,%esi
+  8004e4:	7f ee                	jg     8004d4 <vprintfmt+0x1c2>
+  8004e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ec:	85 c0                	test   %eax,%eax
+  8004ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f3:	0f 49 d0             	cmovns %eax,%edx
+  8004f6:	29 d0                	sub    %edx,%eax
+  8004f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fb:	eb a6                	jmp    8004a3 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	52                   	push   %edx
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800508:	89 f1                	mov    %esi,%ecx
+  80050a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80050d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800511:	0f be d0             	movsbl %al,%edx
+  800514:	85 d2                	test   %edx,%edx
+  800516:	74 28                	je     800540 <vprintfmt+0x22e>
+  800518:	85 ff                	test   %edi,%edi
+  80051a:	78 05                	js     800521 <vprintfmt+0x20f>
+  80051c:	83 ef 01             	sub    $0x1,%edi
+  80051f:	78 30                	js     800551 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800521:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800525:	74 d6                	je     8004fd <vprintfmt+0x1eb>
+  800527:	0f be c0             	movsbl %al,%eax
+  80052a:	83 e8 20             	sub    $0x20,%eax
+  80052d:	83 f8 5e             	cmp    $0x5e,%eax
+  800530:	76 cb                	jbe    8004fd <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	53                   	push   %ebx
+  800536:	6a 3f                	push   $0x3f
+  800538:	ff 55 08             	call   *0x8(%ebp)
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	eb c8                	jmp    800508 <vprintfmt+0x1f6>
+  800540:	8b 75 08             	mov    0x8(%ebp),%esi
+  800543:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800546:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800549:	01 d0                	add    %edx,%eax
+  80054b:	29 c8                	sub    %ecx,%eax
+  80054d:	89 c7                	mov    %eax,%edi
+  80054f:	eb 13                	jmp    800564 <vprintfmt+0x252>
+  800551:	8b 75 08             	mov    0x8(%ebp),%esi
+  800554:	eb ed                	jmp    800543 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	53                   	push   %ebx
+  80055a:	6a 20                	push   $0x20
+  80055c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80055e:	83 ef 01             	sub    $0x1,%edi
+  800561:	83 c4 10             	add    $0x10,%esp
+  800564:	85 ff                	test   %edi,%edi
+  800566:	7f ee                	jg     800556 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800568:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80056b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056e:	e9 6b 01 00 00       	jmp    8006de <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800573:	83 f9 01             	cmp    $0x1,%ecx
+  800576:	7f 1f                	jg     800597 <vprintfmt+0x285>
+	else if (lflag)
+  800578:	85 c9                	test   %ecx,%ecx
+  80057a:	74 67                	je     8005e3 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 00                	mov    (%eax),%eax
+  800581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800584:	89 c1                	mov    %eax,%ecx
+  800586:	c1 f9 1f             	sar    $0x1f,%ecx
+  800589:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8d 40 04             	lea    0x4(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+  800595:	eb 17                	jmp    8005ae <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8b 50 04             	mov    0x4(%eax),%edx
+  80059d:	8b 00                	mov    (%eax),%eax
+  80059f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005ae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005b9:	85 c9                	test   %ecx,%ecx
+  8005bb:	0f 89 03 01 00 00    	jns    8006c4 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005c1:	83 ec 08             	sub    $0x8,%esp
+  8005c4:	53                   	push   %ebx
+  8005c5:	6a 2d                	push   $0x2d
+  8005c7:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005cf:	f7 da                	neg    %edx
+  8005d1:	83 d1 00             	adc    $0x0,%ecx
+  8005d4:	f7 d9                	neg    %ecx
+  8005d6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005de:	e9 e1 00 00 00       	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e6:	8b 00                	mov    (%eax),%eax
+  8005e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005eb:	89 c1                	mov    %eax,%ecx
+  8005ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fc:	eb b0                	jmp    8005ae <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1e                	jg     800621 <vprintfmt+0x30f>
+	else if (lflag)
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 32                	je     800639 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 10                	mov    (%eax),%edx
+  80060c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800611:	8d 40 04             	lea    0x4(%eax),%eax
+  800614:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800617:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80061c:	e9 a3 00 00 00       	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	8b 48 04             	mov    0x4(%eax),%ecx
+  800629:	8d 40 08             	lea    0x8(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800634:	e9 8b 00 00 00       	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 10                	mov    (%eax),%edx
+  80063e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800643:	8d 40 04             	lea    0x4(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800649:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80064e:	eb 74                	jmp    8006c4 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800650:	83 f9 01             	cmp    $0x1,%ecx
+  800653:	7f 1b                	jg     800670 <vprintfmt+0x35e>
+	else if (lflag)
+  800655:	85 c9                	test   %ecx,%ecx
+  800657:	74 2c                	je     800685 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800663:	8d 40 04             	lea    0x4(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800669:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80066e:	eb 54                	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	8b 48 04             	mov    0x4(%eax),%ecx
+  800678:	8d 40 08             	lea    0x8(%eax),%eax
+  80067b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800683:	eb 3f                	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 10                	mov    (%eax),%edx
+  80068a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800695:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80069a:	eb 28                	jmp    8006c4 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80069c:	83 ec 08             	sub    $0x8,%esp
+  80069f:	53                   	push   %ebx
+  8006a0:	6a 30                	push   $0x30
+  8006a2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006a4:	83 c4 08             	add    $0x8,%esp
+  8006a7:	53                   	push   %ebx
+  8006a8:	6a 78                	push   $0x78
+  8006aa:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006b6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006bf:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006c4:	83 ec 0c             	sub    $0xc,%esp
+  8006c7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006cb:	50                   	push   %eax
+  8006cc:	ff 75 e0             	push   -0x20(%ebp)
+  8006cf:	57                   	push   %edi
+  8006d0:	51                   	push   %ecx
+  8006d1:	52                   	push   %edx
+  8006d2:	89 da                	mov    %ebx,%edx
+  8006d4:	89 f0                	mov    %esi,%eax
+  8006d6:	e8 54 fb ff ff       	call   80022f <printnum>
+			break;
+  8006db:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006e1:	e9 4a fc ff ff       	jmp    800330 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006e6:	83 f9 01             	cmp    $0x1,%ecx
+  8006e9:	7f 1b                	jg     800706 <vprintfmt+0x3f4>
+	else if (lflag)
+  8006eb:	85 c9                	test   %ecx,%ecx
+  8006ed:	74 2c                	je     80071b <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800704:	eb be                	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070e:	8d 40 08             	lea    0x8(%eax),%eax
+  800711:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800714:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800719:	eb a9                	jmp    8006c4 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8b 10                	mov    (%eax),%edx
+  800720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800725:	8d 40 04             	lea    0x4(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800730:	eb 92                	jmp    8006c4 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800732:	83 ec 08             	sub    $0x8,%esp
+  800735:	53                   	push   %ebx
+  800736:	6a 25                	push   $0x25
+  800738:	ff d6                	call   *%esi
+			break;
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	eb 9f                	jmp    8006de <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80073f:	83 ec 08             	sub    $0x8,%esp
+  800742:	53                   	push   %ebx
+  800743:	6a 25                	push   $0x25
+  800745:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800747:	83 c4 10             	add    $0x10,%esp
+  80074a:	89 f8                	mov    %edi,%eax
+  80074c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800750:	74 05                	je     800757 <vprintfmt+0x445>
+  800752:	83 e8 01             	sub    $0x1,%eax
+  800755:	eb f5                	jmp    80074c <vprintfmt+0x43a>
+  800757:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80075a:	eb 82                	jmp    8006de <vprintfmt+0x3cc>
+
+0080075c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075c:	55                   	push   %ebp
+  80075d:	89 e5                	mov    %esp,%ebp
+  80075f:	83 ec 18             	sub    $0x18,%esp
+  800762:	8b 45 08             	mov    0x8(%ebp),%eax
+  800765:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800768:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80076f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800772:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800779:	85 c0                	test   %eax,%eax
+  80077b:	74 26                	je     8007a3 <vsnprintf+0x47>
+  80077d:	85 d2                	test   %edx,%edx
+  80077f:	7e 22                	jle    8007a3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800781:	ff 75 14             	push   0x14(%ebp)
+  800784:	ff 75 10             	push   0x10(%ebp)
+  800787:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078a:	50                   	push   %eax
+  80078b:	68 d8 02 80 00       	push   $0x8002d8
+  800790:	e8 7d fb ff ff       	call   800312 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800795:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800798:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80079b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079e:	83 c4 10             	add    $0x10,%esp
+}
+  8007a1:	c9                   	leave
+  8007a2:	c3                   	ret
+		return -E_INVAL;
+  8007a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a8:	eb f7                	jmp    8007a1 <vsnprintf+0x45>
+
+008007aa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007b3:	50                   	push   %eax
+  8007b4:	ff 75 10             	push   0x10(%ebp)
+  8007b7:	ff 75 0c             	push   0xc(%ebp)
+  8007ba:	ff 75 08             	push   0x8(%ebp)
+  8007bd:	e8 9a ff ff ff       	call   80075c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007c2:	c9                   	leave
+  8007c3:	c3                   	ret
+
+008007c4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cf:	eb 03                	jmp    8007d4 <strlen+0x10>
+		n++;
+  8007d1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007d8:	75 f7                	jne    8007d1 <strlen+0xd>
+	return n;
+}
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ea:	eb 03                	jmp    8007ef <strnlen+0x13>
+		n++;
+  8007ec:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ef:	39 d0                	cmp    %edx,%eax
+  8007f1:	74 08                	je     8007fb <strnlen+0x1f>
+  8007f3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f7:	75 f3                	jne    8007ec <strnlen+0x10>
+  8007f9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007fb:	89 d0                	mov    %edx,%eax
+  8007fd:	5d                   	pop    %ebp
+  8007fe:	c3                   	ret
+
+008007ff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	53                   	push   %ebx
+  800803:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800806:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800812:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800815:	83 c0 01             	add    $0x1,%eax
+  800818:	84 d2                	test   %dl,%dl
+  80081a:	75 f2                	jne    80080e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80081c:	89 c8                	mov    %ecx,%eax
+  80081e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800821:	c9                   	leave
+  800822:	c3                   	ret
+
+00800823 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	53                   	push   %ebx
+  800827:	83 ec 10             	sub    $0x10,%esp
+  80082a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80082d:	53                   	push   %ebx
+  80082e:	e8 91 ff ff ff       	call   8007c4 <strlen>
+  800833:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800836:	ff 75 0c             	push   0xc(%ebp)
+  800839:	01 d8                	add    %ebx,%eax
+  80083b:	50                   	push   %eax
+  80083c:	e8 be ff ff ff       	call   8007ff <strcpy>
+	return dst;
+}
+  800841:	89 d8                	mov    %ebx,%eax
+  800843:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+
+00800848 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800848:	55                   	push   %ebp
+  800849:	89 e5                	mov    %esp,%ebp
+  80084b:	56                   	push   %esi
+  80084c:	53                   	push   %ebx
+  80084d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800850:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800853:	89 f3                	mov    %esi,%ebx
+  800855:	03 5d 10             	add    0x10(%ebp),%ebx
+  800858:	89 f0                	mov    %esi,%eax
+  80085a:	eb 0f                	jmp    80086b <strncpy+0x23>
+		*dst++ = *src;
+  80085c:	83 c0 01             	add    $0x1,%eax
+  80085f:	0f b6 0a             	movzbl (%edx),%ecx
+  800862:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800865:	80 f9 01             	cmp    $0x1,%cl
+  800868:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80086b:	39 d8                	cmp    %ebx,%eax
+  80086d:	75 ed                	jne    80085c <strncpy+0x14>
+	}
+	return ret;
+}
+  80086f:	89 f0                	mov    %esi,%eax
+  800871:	5b                   	pop    %ebx
+  800872:	5e                   	pop    %esi
+  800873:	5d                   	pop    %ebp
+  800874:	c3                   	ret
+
+00800875 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	56                   	push   %esi
+  800879:	53                   	push   %ebx
+  80087a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800880:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800883:	89 f0                	mov    %esi,%eax
+  800885:	85 d2                	test   %edx,%edx
+  800887:	74 21                	je     8008aa <strlcpy+0x35>
+  800889:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088d:	89 f2                	mov    %esi,%edx
+  80088f:	eb 09                	jmp    80089a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800891:	83 c1 01             	add    $0x1,%ecx
+  800894:	83 c2 01             	add    $0x1,%edx
+  800897:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80089a:	39 c2                	cmp    %eax,%edx
+  80089c:	74 09                	je     8008a7 <strlcpy+0x32>
+  80089e:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a1:	84 db                	test   %bl,%bl
+  8008a3:	75 ec                	jne    800891 <strlcpy+0x1c>
+  8008a5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008a7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008aa:	29 f0                	sub    %esi,%eax
+}
+  8008ac:	5b                   	pop    %ebx
+  8008ad:	5e                   	pop    %esi
+  8008ae:	5d                   	pop    %ebp
+  8008af:	c3                   	ret
+
+008008b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008b9:	eb 06                	jmp    8008c1 <strcmp+0x11>
+		p++, q++;
+  8008bb:	83 c1 01             	add    $0x1,%ecx
+  8008be:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008c1:	0f b6 01             	movzbl (%ecx),%eax
+  8008c4:	84 c0                	test   %al,%al
+  8008c6:	74 04                	je     8008cc <strcmp+0x1c>
+  8008c8:	3a 02                	cmp    (%edx),%al
+  8008ca:	74 ef                	je     8008bb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008cc:	0f b6 c0             	movzbl %al,%eax
+  8008cf:	0f b6 12             	movzbl (%edx),%edx
+  8008d2:	29 d0                	sub    %edx,%eax
+}
+  8008d4:	5d                   	pop    %ebp
+  8008d5:	c3                   	ret
+
+008008d6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	53                   	push   %ebx
+  8008da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008e3:	eb 09                	jmp    8008ee <strncmp+0x18>
+		n--, p++, q++;
+  8008e5:	83 ea 01             	sub    $0x1,%edx
+  8008e8:	83 c0 01             	add    $0x1,%eax
+  8008eb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ee:	85 d2                	test   %edx,%edx
+  8008f0:	74 18                	je     80090a <strncmp+0x34>
+  8008f2:	0f b6 18             	movzbl (%eax),%ebx
+  8008f5:	84 db                	test   %bl,%bl
+  8008f7:	74 04                	je     8008fd <strncmp+0x27>
+  8008f9:	3a 19                	cmp    (%ecx),%bl
+  8008fb:	74 e8                	je     8008e5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fd:	0f b6 00             	movzbl (%eax),%eax
+  800900:	0f b6 11             	movzbl (%ecx),%edx
+  800903:	29 d0                	sub    %edx,%eax
+}
+  800905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+		return 0;
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	eb f4                	jmp    800905 <strncmp+0x2f>
+
+00800911 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	8b 45 08             	mov    0x8(%ebp),%eax
+  800917:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091b:	eb 03                	jmp    800920 <strchr+0xf>
+  80091d:	83 c0 01             	add    $0x1,%eax
+  800920:	0f b6 10             	movzbl (%eax),%edx
+  800923:	84 d2                	test   %dl,%dl
+  800925:	74 06                	je     80092d <strchr+0x1c>
+		if (*s == c)
+  800927:	38 ca                	cmp    %cl,%dl
+  800929:	75 f2                	jne    80091d <strchr+0xc>
+  80092b:	eb 05                	jmp    800932 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800932:	5d                   	pop    %ebp
+  800933:	c3                   	ret
+
+00800934 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800941:	38 ca                	cmp    %cl,%dl
+  800943:	74 09                	je     80094e <strfind+0x1a>
+  800945:	84 d2                	test   %dl,%dl
+  800947:	74 05                	je     80094e <strfind+0x1a>
+	for (; *s; s++)
+  800949:	83 c0 01             	add    $0x1,%eax
+  80094c:	eb f0                	jmp    80093e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+
+00800950 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	57                   	push   %edi
+  800954:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800957:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80095a:	85 c9                	test   %ecx,%ecx
+  80095c:	74 20                	je     80097e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80095e:	89 f8                	mov    %edi,%eax
+  800960:	09 c8                	or     %ecx,%eax
+  800962:	a8 03                	test   $0x3,%al
+  800964:	75 12                	jne    800978 <memset+0x28>
+		c &= 0xFF;
+  800966:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800970:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800973:	fc                   	cld
+  800974:	f3 ab                	rep stos %eax,%es:(%edi)
+  800976:	eb 06                	jmp    80097e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800978:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097b:	fc                   	cld
+  80097c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80097e:	89 f8                	mov    %edi,%eax
+  800980:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800983:	c9                   	leave
+  800984:	c3                   	ret
+
+00800985 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	57                   	push   %edi
+  800989:	56                   	push   %esi
+  80098a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800990:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800993:	39 c6                	cmp    %eax,%esi
+  800995:	73 32                	jae    8009c9 <memmove+0x44>
+  800997:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099a:	39 d0                	cmp    %edx,%eax
+  80099c:	73 2b                	jae    8009c9 <memmove+0x44>
+		s += n;
+		d += n;
+  80099e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a1:	89 d6                	mov    %edx,%esi
+  8009a3:	09 fe                	or     %edi,%esi
+  8009a5:	09 ce                	or     %ecx,%esi
+  8009a7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ad:	75 0e                	jne    8009bd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009af:	83 ef 04             	sub    $0x4,%edi
+  8009b2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009b8:	fd                   	std
+  8009b9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bb:	eb 09                	jmp    8009c6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009bd:	83 ef 01             	sub    $0x1,%edi
+  8009c0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009c3:	fd                   	std
+  8009c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009c6:	fc                   	cld
+  8009c7:	eb 1a                	jmp    8009e3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c9:	89 f2                	mov    %esi,%edx
+  8009cb:	09 c2                	or     %eax,%edx
+  8009cd:	09 ca                	or     %ecx,%edx
+  8009cf:	f6 c2 03             	test   $0x3,%dl
+  8009d2:	75 0a                	jne    8009de <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009d7:	89 c7                	mov    %eax,%edi
+  8009d9:	fc                   	cld
+  8009da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dc:	eb 05                	jmp    8009e3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009de:	89 c7                	mov    %eax,%edi
+  8009e0:	fc                   	cld
+  8009e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009e3:	5e                   	pop    %esi
+  8009e4:	5f                   	pop    %edi
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009ed:	ff 75 10             	push   0x10(%ebp)
+  8009f0:	ff 75 0c             	push   0xc(%ebp)
+  8009f3:	ff 75 08             	push   0x8(%ebp)
+  8009f6:	e8 8a ff ff ff       	call   800985 <memmove>
+}
+  8009fb:	c9                   	leave
+  8009fc:	c3                   	ret
+
+008009fd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009fd:	55                   	push   %ebp
+  8009fe:	89 e5                	mov    %esp,%ebp
+  800a00:	56                   	push   %esi
+  800a01:	53                   	push   %ebx
+  800a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a05:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a08:	89 c6                	mov    %eax,%esi
+  800a0a:	03 75 10             	add    0x10(%ebp),%esi
+  800a0d:	eb 06                	jmp    800a15 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a15:	39 f0                	cmp    %esi,%eax
+  800a17:	74 14                	je     800a2d <memcmp+0x30>
+		if (*s1 != *s2)
+  800a19:	0f b6 08             	movzbl (%eax),%ecx
+  800a1c:	0f b6 1a             	movzbl (%edx),%ebx
+  800a1f:	38 d9                	cmp    %bl,%cl
+  800a21:	74 ec                	je     800a0f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a23:	0f b6 c1             	movzbl %cl,%eax
+  800a26:	0f b6 db             	movzbl %bl,%ebx
+  800a29:	29 d8                	sub    %ebx,%eax
+  800a2b:	eb 05                	jmp    800a32 <memcmp+0x35>
+	}
+
+	return 0;
+  800a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a32:	5b                   	pop    %ebx
+  800a33:	5e                   	pop    %esi
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+
+00800a36 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a44:	eb 03                	jmp    800a49 <memfind+0x13>
+  800a46:	83 c0 01             	add    $0x1,%eax
+  800a49:	39 d0                	cmp    %edx,%eax
+  800a4b:	73 04                	jae    800a51 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a4d:	38 08                	cmp    %cl,(%eax)
+  800a4f:	75 f5                	jne    800a46 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+
+00800a53 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	57                   	push   %edi
+  800a57:	56                   	push   %esi
+  800a58:	53                   	push   %ebx
+  800a59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a5f:	eb 03                	jmp    800a64 <strtol+0x11>
+		s++;
+  800a61:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a64:	0f b6 02             	movzbl (%edx),%eax
+  800a67:	3c 20                	cmp    $0x20,%al
+  800a69:	74 f6                	je     800a61 <strtol+0xe>
+  800a6b:	3c 09                	cmp    $0x9,%al
+  800a6d:	74 f2                	je     800a61 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a6f:	3c 2b                	cmp    $0x2b,%al
+  800a71:	74 2a                	je     800a9d <strtol+0x4a>
+	int neg = 0;
+  800a73:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a78:	3c 2d                	cmp    $0x2d,%al
+  800a7a:	74 2b                	je     800aa7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a82:	75 0f                	jne    800a93 <strtol+0x40>
+  800a84:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a87:	74 28                	je     800ab1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a89:	85 db                	test   %ebx,%ebx
+  800a8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a90:	0f 44 d8             	cmove  %eax,%ebx
+  800a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a98:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9b:	eb 46                	jmp    800ae3 <strtol+0x90>
+		s++;
+  800a9d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa5:	eb d5                	jmp    800a7c <strtol+0x29>
+		s++, neg = 1;
+  800aa7:	83 c2 01             	add    $0x1,%edx
+  800aaa:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aaf:	eb cb                	jmp    800a7c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab5:	74 0e                	je     800ac5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ab7:	85 db                	test   %ebx,%ebx
+  800ab9:	75 d8                	jne    800a93 <strtol+0x40>
+		s++, base = 8;
+  800abb:	83 c2 01             	add    $0x1,%edx
+  800abe:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac3:	eb ce                	jmp    800a93 <strtol+0x40>
+		s += 2, base = 16;
+  800ac5:	83 c2 02             	add    $0x2,%edx
+  800ac8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800acd:	eb c4                	jmp    800a93 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800acf:	0f be c0             	movsbl %al,%eax
+  800ad2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ad5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ad8:	7d 3a                	jge    800b14 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ada:	83 c2 01             	add    $0x1,%edx
+  800add:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ae3:	0f b6 02             	movzbl (%edx),%eax
+  800ae6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ae9:	89 f3                	mov    %esi,%ebx
+  800aeb:	80 fb 09             	cmp    $0x9,%bl
+  800aee:	76 df                	jbe    800acf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af3:	89 f3                	mov    %esi,%ebx
+  800af5:	80 fb 19             	cmp    $0x19,%bl
+  800af8:	77 08                	ja     800b02 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800afa:	0f be c0             	movsbl %al,%eax
+  800afd:	83 e8 57             	sub    $0x57,%eax
+  800b00:	eb d3                	jmp    800ad5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b02:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b05:	89 f3                	mov    %esi,%ebx
+  800b07:	80 fb 19             	cmp    $0x19,%bl
+  800b0a:	77 08                	ja     800b14 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b0c:	0f be c0             	movsbl %al,%eax
+  800b0f:	83 e8 37             	sub    $0x37,%eax
+  800b12:	eb c1                	jmp    800ad5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b14:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b18:	74 05                	je     800b1f <strtol+0xcc>
+		*endptr = (char *) s;
+  800b1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b1f:	89 c8                	mov    %ecx,%eax
+  800b21:	f7 d8                	neg    %eax
+  800b23:	85 ff                	test   %edi,%edi
+  800b25:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b28:	89 c8                	mov    %ecx,%eax
+  800b2a:	5b                   	pop    %ebx
+  800b2b:	5e                   	pop    %esi
+  800b2c:	5f                   	pop    %edi
+  800b2d:	5d                   	pop    %ebp
+  800b2e:	c3                   	ret
+
+00800b2f <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b35:	6a 00                	push   $0x0
+  800b37:	6a 00                	push   $0x0
+  800b39:	ff 75 08             	push   0x8(%ebp)
+  800b3c:	e8 12 ff ff ff       	call   800a53 <strtol>
+}
+  800b41:	c9                   	leave
+  800b42:	c3                   	ret
+
+00800b43 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	57                   	push   %edi
+  800b47:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b53:	89 c3                	mov    %eax,%ebx
+  800b55:	89 c7                	mov    %eax,%edi
+  800b57:	6a 00                	push   $0x0
+  800b59:	55                   	push   %ebp
+  800b5a:	56                   	push   %esi
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	8d 35 65 0b 80 00    	lea    0x800b65,%esi
+  800b63:	0f 34                	sysenter
+
+00800b65 <after_sysenter_label_47>:
+  800b65:	5e                   	pop    %esi
+  800b66:	5d                   	pop    %ebp
+  800b67:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b6a:	5b                   	pop    %ebx
+  800b6b:	5f                   	pop    %edi
+  800b6c:	5d                   	pop    %ebp
+  800b6d:	c3                   	ret
+
+00800b6e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	57                   	push   %edi
+  800b72:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b78:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b7d:	89 d1                	mov    %edx,%ecx
+  800b7f:	89 d3                	mov    %edx,%ebx
+  800b81:	89 d7                	mov    %edx,%edi
+  800b83:	6a 00                	push   $0x0
+  800b85:	55                   	push   %ebp
+  800b86:	56                   	push   %esi
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	8d 35 91 0b 80 00    	lea    0x800b91,%esi
+  800b8f:	0f 34                	sysenter
+
+00800b91 <after_sysenter_label_128>:
+  800b91:	5e                   	pop    %esi
+  800b92:	5d                   	pop    %ebp
+  800b93:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b96:	5b                   	pop    %ebx
+  800b97:	5f                   	pop    %edi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	57                   	push   %edi
+  800b9e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bac:	89 cb                	mov    %ecx,%ebx
+  800bae:	89 cf                	mov    %ecx,%edi
+  800bb0:	6a 00                	push   $0x0
+  800bb2:	55                   	push   %ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	8d 35 be 0b 80 00    	lea    0x800bbe,%esi
+  800bbc:	0f 34                	sysenter
+
+00800bbe <after_sysenter_label_212>:
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	7f 07                	jg     800bce <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bca:	5b                   	pop    %ebx
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bce:	83 ec 0c             	sub    $0xc,%esp
+  800bd1:	50                   	push   %eax
+  800bd2:	6a 03                	push   $0x3
+  800bd4:	68 15 4b 80 00       	push   $0x804b15
+  800bd9:	6a 54                	push   $0x54
+  800bdb:	68 32 4b 80 00       	push   $0x804b32
+  800be0:	e8 ae 36 00 00       	call   804293 <_panic>
+
+00800be5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	57                   	push   %edi
+  800be9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bef:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf4:	89 d1                	mov    %edx,%ecx
+  800bf6:	89 d3                	mov    %edx,%ebx
+  800bf8:	89 d7                	mov    %edx,%edi
+  800bfa:	6a 00                	push   $0x0
+  800bfc:	55                   	push   %ebp
+  800bfd:	56                   	push   %esi
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	8d 35 08 0c 80 00    	lea    0x800c08,%esi
+  800c06:	0f 34                	sysenter
+
+00800c08 <after_sysenter_label_309>:
+  800c08:	5e                   	pop    %esi
+  800c09:	5d                   	pop    %ebp
+  800c0a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c0d:	5b                   	pop    %ebx
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c20:	89 d1                	mov    %edx,%ecx
+  800c22:	89 d3                	mov    %edx,%ebx
+  800c24:	89 d7                	mov    %edx,%edi
+  800c26:	6a 00                	push   $0x0
+  800c28:	55                   	push   %ebp
+  800c29:	56                   	push   %esi
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	8d 35 34 0c 80 00    	lea    0x800c34,%esi
+  800c32:	0f 34                	sysenter
+
+00800c34 <after_sysenter_label_391>:
+  800c34:	5e                   	pop    %esi
+  800c35:	5d                   	pop    %ebp
+  800c36:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c39:	5b                   	pop    %ebx
+  800c3a:	5f                   	pop    %edi
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+
+00800c3d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	57                   	push   %edi
+  800c41:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c48:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c55:	6a 00                	push   $0x0
+  800c57:	55                   	push   %ebp
+  800c58:	56                   	push   %esi
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	8d 35 63 0c 80 00    	lea    0x800c63,%esi
+  800c61:	0f 34                	sysenter
+
+00800c63 <after_sysenter_label_479>:
+  800c63:	5e                   	pop    %esi
+  800c64:	5d                   	pop    %ebp
+  800c65:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	7f 07                	jg     800c73 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+  800c76:	50                   	push   %eax
+  800c77:	6a 04                	push   $0x4
+  800c79:	68 15 4b 80 00       	push   $0x804b15
+  800c7e:	6a 54                	push   $0x54
+  800c80:	68 32 4b 80 00       	push   $0x804b32
+  800c85:	e8 09 36 00 00       	call   804293 <_panic>
+
+00800c8a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c8a:	55                   	push   %ebp
+  800c8b:	89 e5                	mov    %esp,%ebp
+  800c8d:	57                   	push   %edi
+  800c8e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c95:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca0:	ff 75 18             	push   0x18(%ebp)
+  800ca3:	55                   	push   %ebp
+  800ca4:	56                   	push   %esi
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	8d 35 af 0c 80 00    	lea    0x800caf,%esi
+  800cad:	0f 34                	sysenter
+
+00800caf <after_sysenter_label_593>:
+  800caf:	5e                   	pop    %esi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cb4:	85 c0                	test   %eax,%eax
+  800cb6:	7f 07                	jg     800cbf <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5f                   	pop    %edi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+  800cc2:	50                   	push   %eax
+  800cc3:	6a 05                	push   $0x5
+  800cc5:	68 15 4b 80 00       	push   $0x804b15
+  800cca:	6a 54                	push   $0x54
+  800ccc:	68 32 4b 80 00       	push   $0x804b32
+  800cd1:	e8 bd 35 00 00       	call   804293 <_panic>
+
+00800cd6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	57                   	push   %edi
+  800cda:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ceb:	89 df                	mov    %ebx,%edi
+  800ced:	6a 00                	push   $0x0
+  800cef:	55                   	push   %ebp
+  800cf0:	56                   	push   %esi
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8d 35 fb 0c 80 00    	lea    0x800cfb,%esi
+  800cf9:	0f 34                	sysenter
+
+00800cfb <after_sysenter_label_704>:
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5d                   	pop    %ebp
+  800cfd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	7f 07                	jg     800d0b <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d07:	5b                   	pop    %ebx
+  800d08:	5f                   	pop    %edi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0b:	83 ec 0c             	sub    $0xc,%esp
+  800d0e:	50                   	push   %eax
+  800d0f:	6a 06                	push   $0x6
+  800d11:	68 15 4b 80 00       	push   $0x804b15
+  800d16:	6a 54                	push   $0x54
+  800d18:	68 32 4b 80 00       	push   $0x804b32
+  800d1d:	e8 71 35 00 00       	call   804293 <_panic>
+
+00800d22 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	57                   	push   %edi
+  800d26:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	6a 00                	push   $0x0
+  800d3b:	55                   	push   %ebp
+  800d3c:	56                   	push   %esi
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	8d 35 47 0d 80 00    	lea    0x800d47,%esi
+  800d45:	0f 34                	sysenter
+
+00800d47 <after_sysenter_label_808>:
+  800d47:	5e                   	pop    %esi
+  800d48:	5d                   	pop    %ebp
+  800d49:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d4c:	85 c0                	test   %eax,%eax
+  800d4e:	7f 07                	jg     800d57 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d53:	5b                   	pop    %ebx
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+  800d5a:	50                   	push   %eax
+  800d5b:	6a 08                	push   $0x8
+  800d5d:	68 15 4b 80 00       	push   $0x804b15
+  800d62:	6a 54                	push   $0x54
+  800d64:	68 32 4b 80 00       	push   $0x804b32
+  800d69:	e8 25 35 00 00       	call   804293 <_panic>
+
+00800d6e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d83:	89 df                	mov    %ebx,%edi
+  800d85:	6a 00                	push   $0x0
+  800d87:	55                   	push   %ebp
+  800d88:	56                   	push   %esi
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	8d 35 93 0d 80 00    	lea    0x800d93,%esi
+  800d91:	0f 34                	sysenter
+
+00800d93 <after_sysenter_label_912>:
+  800d93:	5e                   	pop    %esi
+  800d94:	5d                   	pop    %ebp
+  800d95:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d98:	85 c0                	test   %eax,%eax
+  800d9a:	7f 07                	jg     800da3 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 09                	push   $0x9
+  800da9:	68 15 4b 80 00       	push   $0x804b15
+  800dae:	6a 54                	push   $0x54
+  800db0:	68 32 4b 80 00       	push   $0x804b32
+  800db5:	e8 d9 34 00 00       	call   804293 <_panic>
+
+00800dba <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dcf:	89 df                	mov    %ebx,%edi
+  800dd1:	6a 00                	push   $0x0
+  800dd3:	55                   	push   %ebp
+  800dd4:	56                   	push   %esi
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	8d 35 df 0d 80 00    	lea    0x800ddf,%esi
+  800ddd:	0f 34                	sysenter
+
+00800ddf <after_sysenter_label_1016>:
+  800ddf:	5e                   	pop    %esi
+  800de0:	5d                   	pop    %ebp
+  800de1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	7f 07                	jg     800def <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800de8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800def:	83 ec 0c             	sub    $0xc,%esp
+  800df2:	50                   	push   %eax
+  800df3:	6a 0a                	push   $0xa
+  800df5:	68 15 4b 80 00       	push   $0x804b15
+  800dfa:	6a 54                	push   $0x54
+  800dfc:	68 32 4b 80 00       	push   $0x804b32
+  800e01:	e8 8d 34 00 00       	call   804293 <_panic>
+
+00800e06 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e11:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e19:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e1c:	6a 00                	push   $0x0
+  800e1e:	55                   	push   %ebp
+  800e1f:	56                   	push   %esi
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	8d 35 2a 0e 80 00    	lea    0x800e2a,%esi
+  800e28:	0f 34                	sysenter
+
+00800e2a <after_sysenter_label_1126>:
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e2f:	5b                   	pop    %ebx
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e40:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e45:	89 cb                	mov    %ecx,%ebx
+  800e47:	89 cf                	mov    %ecx,%edi
+  800e49:	6a 00                	push   $0x0
+  800e4b:	55                   	push   %ebp
+  800e4c:	56                   	push   %esi
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8d 35 57 0e 80 00    	lea    0x800e57,%esi
+  800e55:	0f 34                	sysenter
+
+00800e57 <after_sysenter_label_1210>:
+  800e57:	5e                   	pop    %esi
+  800e58:	5d                   	pop    %ebp
+  800e59:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	7f 07                	jg     800e67 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e63:	5b                   	pop    %ebx
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  800e6a:	50                   	push   %eax
+  800e6b:	6a 0d                	push   $0xd
+  800e6d:	68 15 4b 80 00       	push   $0x804b15
+  800e72:	6a 54                	push   $0x54
+  800e74:	68 32 4b 80 00       	push   $0x804b32
+  800e79:	e8 15 34 00 00       	call   804293 <_panic>
+
+00800e7e <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8e:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e93:	89 df                	mov    %ebx,%edi
+  800e95:	6a 00                	push   $0x0
+  800e97:	55                   	push   %ebp
+  800e98:	56                   	push   %esi
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+
+00800ea3 <after_sysenter_label_1311>:
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	7f 07                	jg     800eb3 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	6a 42                	push   $0x42
+  800eb9:	68 15 4b 80 00       	push   $0x804b15
+  800ebe:	6a 54                	push   $0x54
+  800ec0:	68 32 4b 80 00       	push   $0x804b32
+  800ec5:	e8 c9 33 00 00       	call   804293 <_panic>
+
+00800eca <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ed9:	89 d1                	mov    %edx,%ecx
+  800edb:	89 d3                	mov    %edx,%ebx
+  800edd:	89 d7                	mov    %edx,%edi
+  800edf:	6a 00                	push   $0x0
+  800ee1:	55                   	push   %ebp
+  800ee2:	56                   	push   %esi
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	8d 35 ed 0e 80 00    	lea    0x800eed,%esi
+  800eeb:	0f 34                	sysenter
+
+00800eed <after_sysenter_label_1411>:
+  800eed:	5e                   	pop    %esi
+  800eee:	5d                   	pop    %ebp
+  800eef:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+
+00800ef6 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800efb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f0b:	89 df                	mov    %ebx,%edi
+  800f0d:	6a 00                	push   $0x0
+  800f0f:	55                   	push   %ebp
+  800f10:	56                   	push   %esi
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+
+00800f1b <after_sysenter_label_1497>:
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f20:	5b                   	pop    %ebx
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+
+00800f24 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f39:	89 df                	mov    %ebx,%edi
+  800f3b:	6a 00                	push   $0x0
+  800f3d:	55                   	push   %ebp
+  800f3e:	56                   	push   %esi
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	8d 35 49 0f 80 00    	lea    0x800f49,%esi
+  800f47:	0f 34                	sysenter
+
+00800f49 <after_sysenter_label_1583>:
+  800f49:	5e                   	pop    %esi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	6a 00                	push   $0x0
+  800f6c:	55                   	push   %ebp
+  800f6d:	56                   	push   %esi
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	8d 35 78 0f 80 00    	lea    0x800f78,%esi
+  800f76:	0f 34                	sysenter
+
+00800f78 <after_sysenter_label_1672>:
+  800f78:	5e                   	pop    %esi
+  800f79:	5d                   	pop    %ebp
+  800f7a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+
+00800f81 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f91:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f96:	89 df                	mov    %ebx,%edi
+  800f98:	6a 00                	push   $0x0
+  800f9a:	55                   	push   %ebp
+  800f9b:	56                   	push   %esi
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8d 35 a6 0f 80 00    	lea    0x800fa6,%esi
+  800fa4:	0f 34                	sysenter
+
+00800fa6 <after_sysenter_label_1758>:
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fab:	5b                   	pop    %ebx
+  800fac:	5f                   	pop    %edi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+
+00800faf <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbc:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc1:	89 cb                	mov    %ecx,%ebx
+  800fc3:	89 cf                	mov    %ecx,%edi
+  800fc5:	6a 00                	push   $0x0
+  800fc7:	55                   	push   %ebp
+  800fc8:	56                   	push   %esi
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	8d 35 d3 0f 80 00    	lea    0x800fd3,%esi
+  800fd1:	0f 34                	sysenter
+
+00800fd3 <after_sysenter_label_1842>:
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 07                	jg     800fe3 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 13                	push   $0x13
+  800fe9:	68 15 4b 80 00       	push   $0x804b15
+  800fee:	6a 54                	push   $0x54
+  800ff0:	68 32 4b 80 00       	push   $0x804b32
+  800ff5:	e8 99 32 00 00       	call   804293 <_panic>
+
+00800ffa <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801004:	b8 14 00 00 00       	mov    $0x14,%eax
+  801009:	89 d1                	mov    %edx,%ecx
+  80100b:	89 d3                	mov    %edx,%ebx
+  80100d:	89 d7                	mov    %edx,%edi
+  80100f:	6a 00                	push   $0x0
+  801011:	55                   	push   %ebp
+  801012:	56                   	push   %esi
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	8d 35 1d 10 80 00    	lea    0x80101d,%esi
+  80101b:	0f 34                	sysenter
+
+0080101d <after_sysenter_label_1939>:
+  80101d:	5e                   	pop    %esi
+  80101e:	5d                   	pop    %ebp
+  80101f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801022:	5b                   	pop    %ebx
+  801023:	5f                   	pop    %edi
+  801024:	5d                   	pop    %ebp
+  801025:	c3                   	ret
+
+00801026 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	57                   	push   %edi
+  80102a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	b8 15 00 00 00       	mov    $0x15,%eax
+  801036:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103e:	6a 00                	push   $0x0
+  801040:	55                   	push   %ebp
+  801041:	56                   	push   %esi
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	8d 35 4c 10 80 00    	lea    0x80104c,%esi
+  80104a:	0f 34                	sysenter
+
+0080104c <after_sysenter_label_2028>:
+  80104c:	5e                   	pop    %esi
+  80104d:	5d                   	pop    %ebp
+  80104e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801051:	5b                   	pop    %ebx
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 16 00 00 00       	mov    $0x16,%eax
+  80106a:	89 df                	mov    %ebx,%edi
+  80106c:	6a 00                	push   $0x0
+  80106e:	55                   	push   %ebp
+  80106f:	56                   	push   %esi
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	8d 35 7a 10 80 00    	lea    0x80107a,%esi
+  801078:	0f 34                	sysenter
+
+0080107a <after_sysenter_label_2114>:
+  80107a:	5e                   	pop    %esi
+  80107b:	5d                   	pop    %ebp
+  80107c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80107f:	5b                   	pop    %ebx
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 17 00 00 00       	mov    $0x17,%eax
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	6a 00                	push   $0x0
+  80109c:	55                   	push   %ebp
+  80109d:	56                   	push   %esi
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	8d 35 a8 10 80 00    	lea    0x8010a8,%esi
+  8010a6:	0f 34                	sysenter
+
+008010a8 <after_sysenter_label_2200>:
+  8010a8:	5e                   	pop    %esi
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010ad:	5b                   	pop    %ebx
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010c6:	89 df                	mov    %ebx,%edi
+  8010c8:	6a 00                	push   $0x0
+  8010ca:	55                   	push   %ebp
+  8010cb:	56                   	push   %esi
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	8d 35 d6 10 80 00    	lea    0x8010d6,%esi
+  8010d4:	0f 34                	sysenter
+
+008010d6 <after_sysenter_label_2286>:
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5f                   	pop    %edi
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+
+008010df <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8010e8:	89 d6                	mov    %edx,%esi
+  8010ea:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8010ed:	89 cf                	mov    %ecx,%edi
+  8010ef:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8010f2:	89 fa                	mov    %edi,%edx
+  8010f4:	80 ce 08             	or     $0x8,%dh
+  8010f7:	f6 c5 08             	test   $0x8,%ch
+  8010fa:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	50                   	push   %eax
+  801100:	56                   	push   %esi
+  801101:	6a 00                	push   $0x0
+  801103:	e8 82 fb ff ff       	call   800c8a <sys_page_map>
+	if (r < 0) {
+  801108:	83 c4 20             	add    $0x20,%esp
+  80110b:	85 c0                	test   %eax,%eax
+  80110d:	78 27                	js     801136 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	57                   	push   %edi
+  801113:	56                   	push   %esi
+  801114:	6a 00                	push   $0x0
+  801116:	56                   	push   %esi
+  801117:	6a 00                	push   $0x0
+  801119:	e8 6c fb ff ff       	call   800c8a <sys_page_map>
+  80111e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801120:	83 c4 20             	add    $0x20,%esp
+  801123:	85 c0                	test   %eax,%eax
+  801125:	78 24                	js     80114b <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801127:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80112c:	89 d8                	mov    %ebx,%eax
+  80112e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801131:	5b                   	pop    %ebx
+  801132:	5e                   	pop    %esi
+  801133:	5f                   	pop    %edi
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+  801136:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801138:	83 ec 08             	sub    $0x8,%esp
+  80113b:	50                   	push   %eax
+  80113c:	68 40 4b 80 00       	push   $0x804b40
+  801141:	e8 d5 f0 ff ff       	call   80021b <cprintf>
+		return r;
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	eb e1                	jmp    80112c <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80114b:	83 ec 08             	sub    $0x8,%esp
+  80114e:	50                   	push   %eax
+  80114f:	68 70 4b 80 00       	push   $0x804b70
+  801154:	e8 c2 f0 ff ff       	call   80021b <cprintf>
+		return r;
+  801159:	83 c4 10             	add    $0x10,%esp
+  80115c:	eb ce                	jmp    80112c <duppage_cow+0x4d>
+
+0080115e <duppage>:
+{
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	53                   	push   %ebx
+  801162:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801165:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801168:	51                   	push   %ecx
+  801169:	52                   	push   %edx
+  80116a:	50                   	push   %eax
+  80116b:	52                   	push   %edx
+  80116c:	6a 00                	push   $0x0
+  80116e:	e8 17 fb ff ff       	call   800c8a <sys_page_map>
+	if (r < 0) {
+  801173:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801176:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80117b:	85 c0                	test   %eax,%eax
+  80117d:	78 07                	js     801186 <duppage+0x28>
+}
+  80117f:	89 d8                	mov    %ebx,%eax
+  801181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801184:	c9                   	leave
+  801185:	c3                   	ret
+  801186:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801188:	83 ec 08             	sub    $0x8,%esp
+  80118b:	50                   	push   %eax
+  80118c:	68 40 4b 80 00       	push   $0x804b40
+  801191:	e8 85 f0 ff ff       	call   80021b <cprintf>
+		return r;
+  801196:	83 c4 10             	add    $0x10,%esp
+  801199:	eb e4                	jmp    80117f <duppage+0x21>
+
+0080119b <cow_copy>:
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8011a2:	83 ec 04             	sub    $0x4,%esp
+  8011a5:	6a 07                	push   $0x7
+  8011a7:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ac:	6a 00                	push   $0x0
+  8011ae:	e8 8a fa ff ff       	call   800c3d <sys_page_alloc>
+	if (r < 0) {
+  8011b3:	83 c4 10             	add    $0x10,%esp
+  8011b6:	85 c0                	test   %eax,%eax
+  8011b8:	78 58                	js     801212 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8011ba:	83 ec 04             	sub    $0x4,%esp
+  8011bd:	68 00 10 00 00       	push   $0x1000
+  8011c2:	56                   	push   %esi
+  8011c3:	68 00 f0 7f 00       	push   $0x7ff000
+  8011c8:	e8 b8 f7 ff ff       	call   800985 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8011cd:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011d4:	56                   	push   %esi
+  8011d5:	6a 00                	push   $0x0
+  8011d7:	68 00 f0 7f 00       	push   $0x7ff000
+  8011dc:	6a 00                	push   $0x0
+  8011de:	e8 a7 fa ff ff       	call   800c8a <sys_page_map>
+  8011e3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011e5:	83 c4 20             	add    $0x20,%esp
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	78 3b                	js     801227 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8011f4:	6a 00                	push   $0x0
+  8011f6:	e8 db fa ff ff       	call   800cd6 <sys_page_unmap>
+  8011fb:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011fd:	83 c4 10             	add    $0x10,%esp
+  801200:	85 c0                	test   %eax,%eax
+  801202:	78 45                	js     801249 <cow_copy+0xae>
+	return 0;
+  801204:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801209:	89 d8                	mov    %ebx,%eax
+  80120b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+  801212:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801214:	83 ec 08             	sub    $0x8,%esp
+  801217:	50                   	push   %eax
+  801218:	68 60 4c 80 00       	push   $0x804c60
+  80121d:	e8 f9 ef ff ff       	call   80021b <cprintf>
+		return r;
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	eb e2                	jmp    801209 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801227:	83 ec 08             	sub    $0x8,%esp
+  80122a:	50                   	push   %eax
+  80122b:	68 7c 4c 80 00       	push   $0x804c7c
+  801230:	e8 e6 ef ff ff       	call   80021b <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801235:	83 c4 08             	add    $0x8,%esp
+  801238:	68 00 f0 7f 00       	push   $0x7ff000
+  80123d:	6a 00                	push   $0x0
+  80123f:	e8 92 fa ff ff       	call   800cd6 <sys_page_unmap>
+		return r;
+  801244:	83 c4 10             	add    $0x10,%esp
+  801247:	eb c0                	jmp    801209 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801249:	83 ec 08             	sub    $0x8,%esp
+  80124c:	50                   	push   %eax
+  80124d:	68 98 4b 80 00       	push   $0x804b98
+  801252:	e8 c4 ef ff ff       	call   80021b <cprintf>
+		return r;
+  801257:	83 c4 10             	add    $0x10,%esp
+  80125a:	eb ad                	jmp    801209 <cow_copy+0x6e>
+
+0080125c <pgfault>:
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	56                   	push   %esi
+  801260:	53                   	push   %ebx
+  801261:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801264:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801266:	89 d8                	mov    %ebx,%eax
+  801268:	c1 e8 16             	shr    $0x16,%eax
+  80126b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801272:	89 de                	mov    %ebx,%esi
+  801274:	c1 ee 0c             	shr    $0xc,%esi
+  801277:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80127e:	a8 07                	test   $0x7,%al
+  801280:	74 3b                	je     8012bd <pgfault+0x61>
+  801282:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801288:	74 33                	je     8012bd <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	68 00 f0 bf ee       	push   $0xeebff000
+  801292:	e8 7c 26 00 00       	call   803913 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801297:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80129e:	83 c4 10             	add    $0x10,%esp
+  8012a1:	f6 c4 08             	test   $0x8,%ah
+  8012a4:	75 30                	jne    8012d6 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8012a6:	83 ec 0c             	sub    $0xc,%esp
+  8012a9:	68 00 f0 bf ee       	push   $0xeebff000
+  8012ae:	e8 cd 26 00 00       	call   803980 <mutex_unlock>
+}
+  8012b3:	83 c4 10             	add    $0x10,%esp
+  8012b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8012bd:	83 ec 08             	sub    $0x8,%esp
+  8012c0:	ff 72 28             	push   0x28(%edx)
+  8012c3:	51                   	push   %ecx
+  8012c4:	50                   	push   %eax
+  8012c5:	68 bc 4b 80 00       	push   $0x804bbc
+  8012ca:	6a 3f                	push   $0x3f
+  8012cc:	68 96 4c 80 00       	push   $0x804c96
+  8012d1:	e8 bd 2f 00 00       	call   804293 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012d6:	89 d8                	mov    %ebx,%eax
+  8012d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8012dd:	e8 b9 fe ff ff       	call   80119b <cow_copy>
+  8012e2:	eb c2                	jmp    8012a6 <pgfault+0x4a>
+
+008012e4 <cow_enable>:
+{
+  8012e4:	55                   	push   %ebp
+  8012e5:	89 e5                	mov    %esp,%ebp
+  8012e7:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8012ea:	68 5c 12 80 00       	push   $0x80125c
+  8012ef:	e8 e5 2f 00 00       	call   8042d9 <set_pgfault_handler>
+}
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+
+008012f9 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	57                   	push   %edi
+  8012fd:	56                   	push   %esi
+  8012fe:	53                   	push   %ebx
+  8012ff:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801302:	68 5c 12 80 00       	push   $0x80125c
+  801307:	e8 cd 2f 00 00       	call   8042d9 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80130c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801311:	cd 30                	int    $0x30
+  801313:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801316:	83 c4 10             	add    $0x10,%esp
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	78 4b                	js     801368 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80131d:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801322:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80132a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80132e:	0f 85 16 01 00 00    	jne    80144a <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801334:	e8 ac f8 ff ff       	call   800be5 <sys_getenvid>
+  801339:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80133e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801340:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801346:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80134c:	77 32                	ja     801380 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80134e:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801353:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801355:	c1 ea 10             	shr    $0x10,%edx
+  801358:	74 26                	je     801380 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80135a:	c1 e2 10             	shl    $0x10,%edx
+  80135d:	89 d1                	mov    %edx,%ecx
+  80135f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801364:	29 ca                	sub    %ecx,%edx
+  801366:	eb 1e                	jmp    801386 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801368:	83 ec 08             	sub    $0x8,%esp
+  80136b:	89 c7                	mov    %eax,%edi
+  80136d:	50                   	push   %eax
+  80136e:	68 a1 4c 80 00       	push   $0x804ca1
+  801373:	e8 a3 ee ff ff       	call   80021b <cprintf>
+		return eid;
+  801378:	83 c4 10             	add    $0x10,%esp
+  80137b:	e9 6c 01 00 00       	jmp    8014ec <fork+0x1f3>
+		return pthread_main_tls;
+  801380:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801386:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801389:	c1 e0 04             	shl    $0x4,%eax
+  80138c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801391:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801393:	e8 c4 2c 00 00       	call   80405c <pthread_fork_child>
+		return eid;
+  801398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80139b:	e9 4c 01 00 00       	jmp    8014ec <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8013a0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8013a6:	89 da                	mov    %ebx,%edx
+  8013a8:	89 f8                	mov    %edi,%eax
+  8013aa:	e8 af fd ff ff       	call   80115e <duppage>
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	79 28                	jns    8013db <fork+0xe2>
+  8013b3:	89 c7                	mov    %eax,%edi
+  8013b5:	e9 32 01 00 00       	jmp    8014ec <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8013ba:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8013c0:	83 f9 05             	cmp    $0x5,%ecx
+  8013c3:	75 58                	jne    80141d <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8013c5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013ca:	89 da                	mov    %ebx,%edx
+  8013cc:	89 f8                	mov    %edi,%eax
+  8013ce:	e8 8b fd ff ff       	call   80115e <duppage>
+  8013d3:	85 c0                	test   %eax,%eax
+  8013d5:	0f 88 0f 01 00 00    	js     8014ea <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8013db:	83 c3 01             	add    $0x1,%ebx
+  8013de:	39 de                	cmp    %ebx,%esi
+  8013e0:	74 54                	je     801436 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8013e2:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8013e9:	f6 c1 05             	test   $0x5,%cl
+  8013ec:	74 ed                	je     8013db <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8013ee:	f6 c5 04             	test   $0x4,%ch
+  8013f1:	75 ad                	jne    8013a0 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8013f3:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8013f9:	74 bf                	je     8013ba <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8013fb:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801401:	74 d8                	je     8013db <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801403:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801409:	89 da                	mov    %ebx,%edx
+  80140b:	89 f8                	mov    %edi,%eax
+  80140d:	e8 cd fc ff ff       	call   8010df <duppage_cow>
+  801412:	85 c0                	test   %eax,%eax
+  801414:	79 c5                	jns    8013db <fork+0xe2>
+  801416:	89 c7                	mov    %eax,%edi
+  801418:	e9 cf 00 00 00       	jmp    8014ec <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80141d:	68 ec 4b 80 00       	push   $0x804bec
+  801422:	68 b1 4c 80 00       	push   $0x804cb1
+  801427:	68 c6 00 00 00       	push   $0xc6
+  80142c:	68 96 4c 80 00       	push   $0x804c96
+  801431:	e8 5d 2e 00 00       	call   804293 <_panic>
+  801436:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801439:	83 c1 01             	add    $0x1,%ecx
+  80143c:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801442:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801448:	74 18                	je     801462 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80144a:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801451:	a8 07                	test   $0x7,%al
+  801453:	74 e4                	je     801439 <fork+0x140>
+  801455:	89 cb                	mov    %ecx,%ebx
+  801457:	c1 e3 0a             	shl    $0xa,%ebx
+  80145a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80145d:	e9 7c ff ff ff       	jmp    8013de <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801462:	83 ec 04             	sub    $0x4,%esp
+  801465:	6a 07                	push   $0x7
+  801467:	68 00 f0 bf ee       	push   $0xeebff000
+  80146c:	ff 75 e4             	push   -0x1c(%ebp)
+  80146f:	e8 c9 f7 ff ff       	call   800c3d <sys_page_alloc>
+  801474:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 34                	js     8014b1 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80147d:	83 ec 08             	sub    $0x8,%esp
+  801480:	68 17 43 80 00       	push   $0x804317
+  801485:	ff 75 e4             	push   -0x1c(%ebp)
+  801488:	e8 2d f9 ff ff       	call   800dba <sys_env_set_pgfault_upcall>
+  80148d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	78 2e                	js     8014c4 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801496:	83 ec 08             	sub    $0x8,%esp
+  801499:	6a 02                	push   $0x2
+  80149b:	ff 75 e4             	push   -0x1c(%ebp)
+  80149e:	e8 7f f8 ff ff       	call   800d22 <sys_env_set_status>
+  8014a3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	78 2b                	js     8014d7 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8014ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014af:	eb 3b                	jmp    8014ec <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8014b1:	83 ec 08             	sub    $0x8,%esp
+  8014b4:	50                   	push   %eax
+  8014b5:	68 14 4c 80 00       	push   $0x804c14
+  8014ba:	e8 5c ed ff ff       	call   80021b <cprintf>
+		return r;
+  8014bf:	83 c4 10             	add    $0x10,%esp
+  8014c2:	eb 28                	jmp    8014ec <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8014c4:	83 ec 08             	sub    $0x8,%esp
+  8014c7:	50                   	push   %eax
+  8014c8:	68 3c 4c 80 00       	push   $0x804c3c
+  8014cd:	e8 49 ed ff ff       	call   80021b <cprintf>
+		return r;
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	eb 15                	jmp    8014ec <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8014d7:	83 ec 08             	sub    $0x8,%esp
+  8014da:	50                   	push   %eax
+  8014db:	68 c6 4c 80 00       	push   $0x804cc6
+  8014e0:	e8 36 ed ff ff       	call   80021b <cprintf>
+		return r;
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	eb 02                	jmp    8014ec <fork+0x1f3>
+  8014ea:	89 c7                	mov    %eax,%edi
+}
+  8014ec:	89 f8                	mov    %edi,%eax
+  8014ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f1:	5b                   	pop    %ebx
+  8014f2:	5e                   	pop    %esi
+  8014f3:	5f                   	pop    %edi
+  8014f4:	5d                   	pop    %ebp
+  8014f5:	c3                   	ret
+
+008014f6 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8014f6:	55                   	push   %ebp
+  8014f7:	89 e5                	mov    %esp,%ebp
+  8014f9:	57                   	push   %edi
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	83 ec 2c             	sub    $0x2c,%esp
+  8014ff:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801501:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801507:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80150c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801512:	77 0a                	ja     80151e <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801514:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801519:	29 c3                	sub    %eax,%ebx
+  80151b:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80151e:	83 ec 0c             	sub    $0xc,%esp
+  801521:	68 5c 12 80 00       	push   $0x80125c
+  801526:	e8 ae 2d 00 00       	call   8042d9 <set_pgfault_handler>
+  80152b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801530:	cd 30                	int    $0x30
+  801532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801535:	83 c4 10             	add    $0x10,%esp
+  801538:	85 c0                	test   %eax,%eax
+  80153a:	78 30                	js     80156c <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80153c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801540:	74 42                	je     801584 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801542:	c1 e3 10             	shl    $0x10,%ebx
+  801545:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80154a:	29 d8                	sub    %ebx,%eax
+  80154c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80154f:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801554:	29 d8                	sub    %ebx,%eax
+  801556:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801559:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80155e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801563:	89 f7                	mov    %esi,%edi
+  801565:	89 d6                	mov    %edx,%esi
+  801567:	e9 2c 01 00 00       	jmp    801698 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80156c:	83 ec 08             	sub    $0x8,%esp
+  80156f:	89 c7                	mov    %eax,%edi
+  801571:	50                   	push   %eax
+  801572:	68 a1 4c 80 00       	push   $0x804ca1
+  801577:	e8 9f ec ff ff       	call   80021b <cprintf>
+		return eid;
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	e9 d5 00 00 00       	jmp    801659 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801584:	e8 5c f6 ff ff       	call   800be5 <sys_getenvid>
+  801589:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80158e:	89 c2                	mov    %eax,%edx
+  801590:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801592:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801598:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80159d:	77 18                	ja     8015b7 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80159f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015a4:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8015a6:	c1 e8 10             	shr    $0x10,%eax
+  8015a9:	74 0c                	je     8015b7 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015ab:	c1 e0 10             	shl    $0x10,%eax
+  8015ae:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8015b3:	29 c1                	sub    %eax,%ecx
+  8015b5:	eb 06                	jmp    8015bd <sfork+0xc7>
+		return pthread_main_tls;
+  8015b7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8015bd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8015c0:	c1 e0 04             	shl    $0x4,%eax
+  8015c3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015c8:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8015ca:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8015cd:	e9 87 00 00 00       	jmp    801659 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8015d2:	f6 c5 04             	test   $0x4,%ch
+  8015d5:	74 6c                	je     801643 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8015d7:	89 ca                	mov    %ecx,%edx
+  8015d9:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8015df:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8015e5:	74 7c                	je     801663 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015e7:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015ed:	89 da                	mov    %ebx,%edx
+  8015ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015f2:	e8 67 fb ff ff       	call   80115e <duppage>
+  8015f7:	85 c0                	test   %eax,%eax
+  8015f9:	0f 88 4f 01 00 00    	js     80174e <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8015ff:	83 c3 01             	add    $0x1,%ebx
+  801602:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801605:	74 7a                	je     801681 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801607:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  801609:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801610:	f6 c1 01             	test   $0x1,%cl
+  801613:	74 ea                	je     8015ff <sfork+0x109>
+  801615:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80161b:	74 e2                	je     8015ff <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80161d:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801623:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801626:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80162b:	76 a5                	jbe    8015d2 <sfork+0xdc>
+  80162d:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801633:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801636:	39 fa                	cmp    %edi,%edx
+  801638:	73 9d                	jae    8015d7 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80163a:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80163d:	39 fa                	cmp    %edi,%edx
+  80163f:	72 96                	jb     8015d7 <sfork+0xe1>
+  801641:	eb 8f                	jmp    8015d2 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801643:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801649:	89 da                	mov    %ebx,%edx
+  80164b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80164e:	e8 8c fa ff ff       	call   8010df <duppage_cow>
+  801653:	85 c0                	test   %eax,%eax
+  801655:	79 a8                	jns    8015ff <sfork+0x109>
+  801657:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801659:	89 f8                	mov    %edi,%eax
+  80165b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165e:	5b                   	pop    %ebx
+  80165f:	5e                   	pop    %esi
+  801660:	5f                   	pop    %edi
+  801661:	5d                   	pop    %ebp
+  801662:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801663:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801668:	e8 2e fb ff ff       	call   80119b <cow_copy>
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	0f 88 d2 00 00 00    	js     801747 <sfork+0x251>
+				pte = uvpt[pn];
+  801675:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80167c:	e9 66 ff ff ff       	jmp    8015e7 <sfork+0xf1>
+  801681:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801684:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801687:	83 c6 01             	add    $0x1,%esi
+  80168a:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801690:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801696:	74 1b                	je     8016b3 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801698:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80169f:	a8 01                	test   $0x1,%al
+  8016a1:	74 e4                	je     801687 <sfork+0x191>
+  8016a3:	89 f3                	mov    %esi,%ebx
+  8016a5:	c1 e3 0a             	shl    $0xa,%ebx
+  8016a8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8016ab:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8016ae:	e9 4f ff ff ff       	jmp    801602 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+  8016b6:	6a 07                	push   $0x7
+  8016b8:	68 00 f0 bf ee       	push   $0xeebff000
+  8016bd:	ff 75 e0             	push   -0x20(%ebp)
+  8016c0:	e8 78 f5 ff ff       	call   800c3d <sys_page_alloc>
+  8016c5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 37                	js     801705 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8016ce:	83 ec 08             	sub    $0x8,%esp
+  8016d1:	68 17 43 80 00       	push   $0x804317
+  8016d6:	ff 75 e0             	push   -0x20(%ebp)
+  8016d9:	e8 dc f6 ff ff       	call   800dba <sys_env_set_pgfault_upcall>
+  8016de:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 34                	js     80171b <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	6a 02                	push   $0x2
+  8016ec:	ff 75 e0             	push   -0x20(%ebp)
+  8016ef:	e8 2e f6 ff ff       	call   800d22 <sys_env_set_status>
+  8016f4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 34                	js     801731 <sfork+0x23b>
+	return eid;
+  8016fd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801700:	e9 54 ff ff ff       	jmp    801659 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801705:	83 ec 08             	sub    $0x8,%esp
+  801708:	50                   	push   %eax
+  801709:	68 14 4c 80 00       	push   $0x804c14
+  80170e:	e8 08 eb ff ff       	call   80021b <cprintf>
+		return r;
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	e9 3e ff ff ff       	jmp    801659 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80171b:	83 ec 08             	sub    $0x8,%esp
+  80171e:	50                   	push   %eax
+  80171f:	68 3c 4c 80 00       	push   $0x804c3c
+  801724:	e8 f2 ea ff ff       	call   80021b <cprintf>
+		return r;
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	e9 28 ff ff ff       	jmp    801659 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801731:	83 ec 08             	sub    $0x8,%esp
+  801734:	50                   	push   %eax
+  801735:	68 c6 4c 80 00       	push   $0x804cc6
+  80173a:	e8 dc ea ff ff       	call   80021b <cprintf>
+		return r;
+  80173f:	83 c4 10             	add    $0x10,%esp
+  801742:	e9 12 ff ff ff       	jmp    801659 <sfork+0x163>
+  801747:	89 c7                	mov    %eax,%edi
+  801749:	e9 0b ff ff ff       	jmp    801659 <sfork+0x163>
+  80174e:	89 c7                	mov    %eax,%edi
+  801750:	e9 04 ff ff ff       	jmp    801659 <sfork+0x163>
+
+00801755 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801758:	8b 45 08             	mov    0x8(%ebp),%eax
+  80175b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801760:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801763:	5d                   	pop    %ebp
+  801764:	c3                   	ret
+
+00801765 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801770:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801775:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+
+0080177c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80177f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801784:	eb 02                	jmp    801788 <fd_alloc+0xc>
+  801786:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801788:	89 c2                	mov    %eax,%edx
+  80178a:	c1 ea 16             	shr    $0x16,%edx
+  80178d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801794:	f6 c2 01             	test   $0x1,%dl
+  801797:	74 2b                	je     8017c4 <fd_alloc+0x48>
+  801799:	89 c2                	mov    %eax,%edx
+  80179b:	c1 ea 0c             	shr    $0xc,%edx
+  80179e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017a5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017ab:	f6 c1 01             	test   $0x1,%cl
+  8017ae:	74 14                	je     8017c4 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017b0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017b6:	75 ce                	jne    801786 <fd_alloc+0xa>
+  8017b8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017bd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017c2:	eb 05                	jmp    8017c9 <fd_alloc+0x4d>
+			return 0;
+  8017c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8017c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cc:	89 02                	mov    %eax,(%edx)
+}
+  8017ce:	89 c8                	mov    %ecx,%eax
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+
+008017d2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8017d8:	83 f8 1f             	cmp    $0x1f,%eax
+  8017db:	77 30                	ja     80180d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8017dd:	c1 e0 0c             	shl    $0xc,%eax
+  8017e0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8017e5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017eb:	f6 c2 01             	test   $0x1,%dl
+  8017ee:	74 24                	je     801814 <fd_lookup+0x42>
+  8017f0:	89 c2                	mov    %eax,%edx
+  8017f2:	c1 ea 0c             	shr    $0xc,%edx
+  8017f5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017fc:	f6 c2 01             	test   $0x1,%dl
+  8017ff:	74 1a                	je     80181b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801801:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801804:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801806:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80180b:	5d                   	pop    %ebp
+  80180c:	c3                   	ret
+		return -E_INVAL;
+  80180d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801812:	eb f7                	jmp    80180b <fd_lookup+0x39>
+		return -E_INVAL;
+  801814:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801819:	eb f0                	jmp    80180b <fd_lookup+0x39>
+  80181b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801820:	eb e9                	jmp    80180b <fd_lookup+0x39>
+
+00801822 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	53                   	push   %ebx
+  801826:	83 ec 04             	sub    $0x4,%esp
+  801829:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	eb 03                	jmp    801836 <dev_lookup+0x14>
+  801833:	83 c0 01             	add    $0x1,%eax
+  801836:	8b 1c 85 60 4d 80 00 	mov    0x804d60(,%eax,4),%ebx
+  80183d:	85 db                	test   %ebx,%ebx
+  80183f:	74 0b                	je     80184c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801841:	39 13                	cmp    %edx,(%ebx)
+  801843:	75 ee                	jne    801833 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184a:	eb 49                	jmp    801895 <dev_lookup+0x73>
+  80184c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80184e:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801854:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801859:	77 18                	ja     801873 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80185b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801860:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801862:	c1 e8 10             	shr    $0x10,%eax
+  801865:	74 0c                	je     801873 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801867:	c1 e0 10             	shl    $0x10,%eax
+  80186a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80186f:	29 c1                	sub    %eax,%ecx
+  801871:	eb 06                	jmp    801879 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801873:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801879:	8b 01                	mov    (%ecx),%eax
+  80187b:	8b 40 48             	mov    0x48(%eax),%eax
+  80187e:	83 ec 04             	sub    $0x4,%esp
+  801881:	52                   	push   %edx
+  801882:	50                   	push   %eax
+  801883:	68 e4 4c 80 00       	push   $0x804ce4
+  801888:	e8 8e e9 ff ff       	call   80021b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801895:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801898:	89 1a                	mov    %ebx,(%edx)
+}
+  80189a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80189d:	c9                   	leave
+  80189e:	c3                   	ret
+
+0080189f <fd_close>:
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	57                   	push   %edi
+  8018a3:	56                   	push   %esi
+  8018a4:	53                   	push   %ebx
+  8018a5:	83 ec 24             	sub    $0x24,%esp
+  8018a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018ae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018b1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018b2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018b8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018bb:	50                   	push   %eax
+  8018bc:	e8 11 ff ff ff       	call   8017d2 <fd_lookup>
+  8018c1:	89 c3                	mov    %eax,%ebx
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 05                	js     8018cf <fd_close+0x30>
+	    || fd != fd2)
+  8018ca:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018cd:	74 16                	je     8018e5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018cf:	89 f8                	mov    %edi,%eax
+  8018d1:	84 c0                	test   %al,%al
+  8018d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018db:	89 d8                	mov    %ebx,%eax
+  8018dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e0:	5b                   	pop    %ebx
+  8018e1:	5e                   	pop    %esi
+  8018e2:	5f                   	pop    %edi
+  8018e3:	5d                   	pop    %ebp
+  8018e4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+  8018e8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018eb:	50                   	push   %eax
+  8018ec:	ff 36                	push   (%esi)
+  8018ee:	e8 2f ff ff ff       	call   801822 <dev_lookup>
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 1a                	js     801916 <fd_close+0x77>
+		if (dev->dev_close)
+  8018fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ff:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801902:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801907:	85 c0                	test   %eax,%eax
+  801909:	74 0b                	je     801916 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80190b:	83 ec 0c             	sub    $0xc,%esp
+  80190e:	56                   	push   %esi
+  80190f:	ff d0                	call   *%eax
+  801911:	89 c3                	mov    %eax,%ebx
+  801913:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801916:	83 ec 08             	sub    $0x8,%esp
+  801919:	56                   	push   %esi
+  80191a:	6a 00                	push   $0x0
+  80191c:	e8 b5 f3 ff ff       	call   800cd6 <sys_page_unmap>
+	return r;
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	eb b5                	jmp    8018db <fd_close+0x3c>
+
+00801926 <close>:
+
+int
+close(int fdnum)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80192c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192f:	50                   	push   %eax
+  801930:	ff 75 08             	push   0x8(%ebp)
+  801933:	e8 9a fe ff ff       	call   8017d2 <fd_lookup>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	79 02                	jns    801941 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80193f:	c9                   	leave
+  801940:	c3                   	ret
+		return fd_close(fd, 1);
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	6a 01                	push   $0x1
+  801946:	ff 75 f4             	push   -0xc(%ebp)
+  801949:	e8 51 ff ff ff       	call   80189f <fd_close>
+  80194e:	83 c4 10             	add    $0x10,%esp
+  801951:	eb ec                	jmp    80193f <close+0x19>
+
+00801953 <close_all>:
+
+void
+close_all(void)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	53                   	push   %ebx
+  801957:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80195a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80195f:	83 ec 0c             	sub    $0xc,%esp
+  801962:	53                   	push   %ebx
+  801963:	e8 be ff ff ff       	call   801926 <close>
+	for (i = 0; i < MAXFD; i++)
+  801968:	83 c3 01             	add    $0x1,%ebx
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	83 fb 20             	cmp    $0x20,%ebx
+  801971:	75 ec                	jne    80195f <close_all+0xc>
+}
+  801973:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801976:	c9                   	leave
+  801977:	c3                   	ret
+
+00801978 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801978:	55                   	push   %ebp
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	57                   	push   %edi
+  80197c:	56                   	push   %esi
+  80197d:	53                   	push   %ebx
+  80197e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801981:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	ff 75 08             	push   0x8(%ebp)
+  801988:	e8 45 fe ff ff       	call   8017d2 <fd_lookup>
+  80198d:	89 c3                	mov    %eax,%ebx
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 7f                	js     801a15 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801996:	83 ec 0c             	sub    $0xc,%esp
+  801999:	ff 75 0c             	push   0xc(%ebp)
+  80199c:	e8 85 ff ff ff       	call   801926 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019a4:	c1 e6 0c             	shl    $0xc,%esi
+  8019a7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019b0:	89 3c 24             	mov    %edi,(%esp)
+  8019b3:	e8 ad fd ff ff       	call   801765 <fd2data>
+  8019b8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019ba:	89 34 24             	mov    %esi,(%esp)
+  8019bd:	e8 a3 fd ff ff       	call   801765 <fd2data>
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019c8:	89 d8                	mov    %ebx,%eax
+  8019ca:	c1 e8 16             	shr    $0x16,%eax
+  8019cd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019d4:	a8 01                	test   $0x1,%al
+  8019d6:	74 11                	je     8019e9 <dup+0x71>
+  8019d8:	89 d8                	mov    %ebx,%eax
+  8019da:	c1 e8 0c             	shr    $0xc,%eax
+  8019dd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019e4:	f6 c2 01             	test   $0x1,%dl
+  8019e7:	75 36                	jne    801a1f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019e9:	89 f8                	mov    %edi,%eax
+  8019eb:	c1 e8 0c             	shr    $0xc,%eax
+  8019ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019f5:	83 ec 0c             	sub    $0xc,%esp
+  8019f8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019fd:	50                   	push   %eax
+  8019fe:	56                   	push   %esi
+  8019ff:	6a 00                	push   $0x0
+  801a01:	57                   	push   %edi
+  801a02:	6a 00                	push   $0x0
+  801a04:	e8 81 f2 ff ff       	call   800c8a <sys_page_map>
+  801a09:	89 c3                	mov    %eax,%ebx
+  801a0b:	83 c4 20             	add    $0x20,%esp
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	78 33                	js     801a45 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a15:	89 d8                	mov    %ebx,%eax
+  801a17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a1a:	5b                   	pop    %ebx
+  801a1b:	5e                   	pop    %esi
+  801a1c:	5f                   	pop    %edi
+  801a1d:	5d                   	pop    %ebp
+  801a1e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a1f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a26:	83 ec 0c             	sub    $0xc,%esp
+  801a29:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a2e:	50                   	push   %eax
+  801a2f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a32:	6a 00                	push   $0x0
+  801a34:	53                   	push   %ebx
+  801a35:	6a 00                	push   $0x0
+  801a37:	e8 4e f2 ff ff       	call   800c8a <sys_page_map>
+  801a3c:	89 c3                	mov    %eax,%ebx
+  801a3e:	83 c4 20             	add    $0x20,%esp
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	79 a4                	jns    8019e9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a45:	83 ec 08             	sub    $0x8,%esp
+  801a48:	56                   	push   %esi
+  801a49:	6a 00                	push   $0x0
+  801a4b:	e8 86 f2 ff ff       	call   800cd6 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a50:	83 c4 08             	add    $0x8,%esp
+  801a53:	ff 75 d4             	push   -0x2c(%ebp)
+  801a56:	6a 00                	push   $0x0
+  801a58:	e8 79 f2 ff ff       	call   800cd6 <sys_page_unmap>
+	return r;
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	eb b3                	jmp    801a15 <dup+0x9d>
+
+00801a62 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a62:	55                   	push   %ebp
+  801a63:	89 e5                	mov    %esp,%ebp
+  801a65:	56                   	push   %esi
+  801a66:	53                   	push   %ebx
+  801a67:	83 ec 18             	sub    $0x18,%esp
+  801a6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a6d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a70:	50                   	push   %eax
+  801a71:	53                   	push   %ebx
+  801a72:	e8 5b fd ff ff       	call   8017d2 <fd_lookup>
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 3c                	js     801aba <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a7e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a81:	83 ec 08             	sub    $0x8,%esp
+  801a84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a87:	50                   	push   %eax
+  801a88:	ff 36                	push   (%esi)
+  801a8a:	e8 93 fd ff ff       	call   801822 <dev_lookup>
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 24                	js     801aba <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a96:	8b 46 08             	mov    0x8(%esi),%eax
+  801a99:	83 e0 03             	and    $0x3,%eax
+  801a9c:	83 f8 01             	cmp    $0x1,%eax
+  801a9f:	74 20                	je     801ac1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801aa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa4:	8b 40 08             	mov    0x8(%eax),%eax
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	74 61                	je     801b0c <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801aab:	83 ec 04             	sub    $0x4,%esp
+  801aae:	ff 75 10             	push   0x10(%ebp)
+  801ab1:	ff 75 0c             	push   0xc(%ebp)
+  801ab4:	56                   	push   %esi
+  801ab5:	ff d0                	call   *%eax
+  801ab7:	83 c4 10             	add    $0x10,%esp
+}
+  801aba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abd:	5b                   	pop    %ebx
+  801abe:	5e                   	pop    %esi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+  801ac1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ac3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ac9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801ace:	77 18                	ja     801ae8 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ad0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ad5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ad7:	c1 e8 10             	shr    $0x10,%eax
+  801ada:	74 0c                	je     801ae8 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801adc:	c1 e0 10             	shl    $0x10,%eax
+  801adf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ae4:	29 c2                	sub    %eax,%edx
+  801ae6:	eb 06                	jmp    801aee <read+0x8c>
+		return pthread_main_tls;
+  801ae8:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aee:	8b 02                	mov    (%edx),%eax
+  801af0:	8b 40 48             	mov    0x48(%eax),%eax
+  801af3:	83 ec 04             	sub    $0x4,%esp
+  801af6:	53                   	push   %ebx
+  801af7:	50                   	push   %eax
+  801af8:	68 25 4d 80 00       	push   $0x804d25
+  801afd:	e8 19 e7 ff ff       	call   80021b <cprintf>
+		return -E_INVAL;
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b0a:	eb ae                	jmp    801aba <read+0x58>
+		return -E_NOT_SUPP;
+  801b0c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b11:	eb a7                	jmp    801aba <read+0x58>
+
+00801b13 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b13:	55                   	push   %ebp
+  801b14:	89 e5                	mov    %esp,%ebp
+  801b16:	57                   	push   %edi
+  801b17:	56                   	push   %esi
+  801b18:	53                   	push   %ebx
+  801b19:	83 ec 0c             	sub    $0xc,%esp
+  801b1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b1f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b27:	eb 02                	jmp    801b2b <readn+0x18>
+  801b29:	01 c3                	add    %eax,%ebx
+  801b2b:	39 f3                	cmp    %esi,%ebx
+  801b2d:	73 21                	jae    801b50 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b2f:	83 ec 04             	sub    $0x4,%esp
+  801b32:	89 f0                	mov    %esi,%eax
+  801b34:	29 d8                	sub    %ebx,%eax
+  801b36:	50                   	push   %eax
+  801b37:	89 d8                	mov    %ebx,%eax
+  801b39:	03 45 0c             	add    0xc(%ebp),%eax
+  801b3c:	50                   	push   %eax
+  801b3d:	57                   	push   %edi
+  801b3e:	e8 1f ff ff ff       	call   801a62 <read>
+		if (m < 0)
+  801b43:	83 c4 10             	add    $0x10,%esp
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	78 04                	js     801b4e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b4a:	75 dd                	jne    801b29 <readn+0x16>
+  801b4c:	eb 02                	jmp    801b50 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b4e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b50:	89 d8                	mov    %ebx,%eax
+  801b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5f                   	pop    %edi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+
+00801b5a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	56                   	push   %esi
+  801b5e:	53                   	push   %ebx
+  801b5f:	83 ec 18             	sub    $0x18,%esp
+  801b62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b65:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b68:	50                   	push   %eax
+  801b69:	53                   	push   %ebx
+  801b6a:	e8 63 fc ff ff       	call   8017d2 <fd_lookup>
+  801b6f:	83 c4 10             	add    $0x10,%esp
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	78 37                	js     801bad <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b76:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b79:	83 ec 08             	sub    $0x8,%esp
+  801b7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7f:	50                   	push   %eax
+  801b80:	ff 36                	push   (%esi)
+  801b82:	e8 9b fc ff ff       	call   801822 <dev_lookup>
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 1f                	js     801bad <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b8e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b92:	74 20                	je     801bb4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b97:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	74 61                	je     801bff <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b9e:	83 ec 04             	sub    $0x4,%esp
+  801ba1:	ff 75 10             	push   0x10(%ebp)
+  801ba4:	ff 75 0c             	push   0xc(%ebp)
+  801ba7:	56                   	push   %esi
+  801ba8:	ff d0                	call   *%eax
+  801baa:	83 c4 10             	add    $0x10,%esp
+}
+  801bad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb0:	5b                   	pop    %ebx
+  801bb1:	5e                   	pop    %esi
+  801bb2:	5d                   	pop    %ebp
+  801bb3:	c3                   	ret
+  801bb4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bb6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bbc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bc1:	77 18                	ja     801bdb <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bc3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801bc8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801bca:	c1 e8 10             	shr    $0x10,%eax
+  801bcd:	74 0c                	je     801bdb <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801bcf:	c1 e0 10             	shl    $0x10,%eax
+  801bd2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801bd7:	29 c2                	sub    %eax,%edx
+  801bd9:	eb 06                	jmp    801be1 <write+0x87>
+		return pthread_main_tls;
+  801bdb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be1:	8b 02                	mov    (%edx),%eax
+  801be3:	8b 40 48             	mov    0x48(%eax),%eax
+  801be6:	83 ec 04             	sub    $0x4,%esp
+  801be9:	53                   	push   %ebx
+  801bea:	50                   	push   %eax
+  801beb:	68 41 4d 80 00       	push   $0x804d41
+  801bf0:	e8 26 e6 ff ff       	call   80021b <cprintf>
+		return -E_INVAL;
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bfd:	eb ae                	jmp    801bad <write+0x53>
+		return -E_NOT_SUPP;
+  801bff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c04:	eb a7                	jmp    801bad <write+0x53>
+
+00801c06 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c06:	55                   	push   %ebp
+  801c07:	89 e5                	mov    %esp,%ebp
+  801c09:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0f:	50                   	push   %eax
+  801c10:	ff 75 08             	push   0x8(%ebp)
+  801c13:	e8 ba fb ff ff       	call   8017d2 <fd_lookup>
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	78 0e                	js     801c2d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c25:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c2d:	c9                   	leave
+  801c2e:	c3                   	ret
+
+00801c2f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	56                   	push   %esi
+  801c33:	53                   	push   %ebx
+  801c34:	83 ec 18             	sub    $0x18,%esp
+  801c37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c3d:	50                   	push   %eax
+  801c3e:	53                   	push   %ebx
+  801c3f:	e8 8e fb ff ff       	call   8017d2 <fd_lookup>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 34                	js     801c7f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c4e:	83 ec 08             	sub    $0x8,%esp
+  801c51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	ff 36                	push   (%esi)
+  801c57:	e8 c6 fb ff ff       	call   801822 <dev_lookup>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 1c                	js     801c7f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c63:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c67:	74 1d                	je     801c86 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c6c:	8b 40 18             	mov    0x18(%eax),%eax
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	74 5e                	je     801cd1 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c73:	83 ec 08             	sub    $0x8,%esp
+  801c76:	ff 75 0c             	push   0xc(%ebp)
+  801c79:	56                   	push   %esi
+  801c7a:	ff d0                	call   *%eax
+  801c7c:	83 c4 10             	add    $0x10,%esp
+}
+  801c7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c82:	5b                   	pop    %ebx
+  801c83:	5e                   	pop    %esi
+  801c84:	5d                   	pop    %ebp
+  801c85:	c3                   	ret
+  801c86:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c88:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c8e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c93:	77 18                	ja     801cad <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c95:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c9a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c9c:	c1 e8 10             	shr    $0x10,%eax
+  801c9f:	74 0c                	je     801cad <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801ca1:	c1 e0 10             	shl    $0x10,%eax
+  801ca4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ca9:	29 c2                	sub    %eax,%edx
+  801cab:	eb 06                	jmp    801cb3 <ftruncate+0x84>
+		return pthread_main_tls;
+  801cad:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801cb3:	8b 02                	mov    (%edx),%eax
+  801cb5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb8:	83 ec 04             	sub    $0x4,%esp
+  801cbb:	53                   	push   %ebx
+  801cbc:	50                   	push   %eax
+  801cbd:	68 04 4d 80 00       	push   $0x804d04
+  801cc2:	e8 54 e5 ff ff       	call   80021b <cprintf>
+		return -E_INVAL;
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccf:	eb ae                	jmp    801c7f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801cd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cd6:	eb a7                	jmp    801c7f <ftruncate+0x50>
+
+00801cd8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	56                   	push   %esi
+  801cdc:	53                   	push   %ebx
+  801cdd:	83 ec 18             	sub    $0x18,%esp
+  801ce0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	ff 75 08             	push   0x8(%ebp)
+  801cea:	e8 e3 fa ff ff       	call   8017d2 <fd_lookup>
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 49                	js     801d3f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf9:	83 ec 08             	sub    $0x8,%esp
+  801cfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cff:	50                   	push   %eax
+  801d00:	ff 36                	push   (%esi)
+  801d02:	e8 1b fb ff ff       	call   801822 <dev_lookup>
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 31                	js     801d3f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d11:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d15:	74 2f                	je     801d46 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d17:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d1a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d21:	00 00 00 
+	stat->st_isdir = 0;
+  801d24:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d2b:	00 00 00 
+	stat->st_dev = dev;
+  801d2e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	53                   	push   %ebx
+  801d38:	56                   	push   %esi
+  801d39:	ff 50 14             	call   *0x14(%eax)
+  801d3c:	83 c4 10             	add    $0x10,%esp
+}
+  801d3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d42:	5b                   	pop    %ebx
+  801d43:	5e                   	pop    %esi
+  801d44:	5d                   	pop    %ebp
+  801d45:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d4b:	eb f2                	jmp    801d3f <fstat+0x67>
+
+00801d4d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	56                   	push   %esi
+  801d51:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d52:	83 ec 08             	sub    $0x8,%esp
+  801d55:	6a 00                	push   $0x0
+  801d57:	ff 75 08             	push   0x8(%ebp)
+  801d5a:	e8 4b 03 00 00       	call   8020aa <open>
+  801d5f:	89 c3                	mov    %eax,%ebx
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	78 1b                	js     801d83 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d68:	83 ec 08             	sub    $0x8,%esp
+  801d6b:	ff 75 0c             	push   0xc(%ebp)
+  801d6e:	50                   	push   %eax
+  801d6f:	e8 64 ff ff ff       	call   801cd8 <fstat>
+  801d74:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d76:	89 1c 24             	mov    %ebx,(%esp)
+  801d79:	e8 a8 fb ff ff       	call   801926 <close>
+	return r;
+  801d7e:	83 c4 10             	add    $0x10,%esp
+  801d81:	89 f3                	mov    %esi,%ebx
+}
+  801d83:	89 d8                	mov    %ebx,%eax
+  801d85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d88:	5b                   	pop    %ebx
+  801d89:	5e                   	pop    %esi
+  801d8a:	5d                   	pop    %ebp
+  801d8b:	c3                   	ret
+
+00801d8c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	89 c6                	mov    %eax,%esi
+  801d93:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d95:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801d9c:	74 27                	je     801dc5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d9e:	6a 07                	push   $0x7
+  801da0:	68 00 70 80 00       	push   $0x807000
+  801da5:	56                   	push   %esi
+  801da6:	ff 35 00 60 80 00    	push   0x806000
+  801dac:	e8 82 26 00 00       	call   804433 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801db1:	83 c4 0c             	add    $0xc,%esp
+  801db4:	6a 00                	push   $0x0
+  801db6:	53                   	push   %ebx
+  801db7:	6a 00                	push   $0x0
+  801db9:	e8 7f 25 00 00       	call   80433d <ipc_recv>
+}
+  801dbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc1:	5b                   	pop    %ebx
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5d                   	pop    %ebp
+  801dc4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dc5:	83 ec 0c             	sub    $0xc,%esp
+  801dc8:	6a 01                	push   $0x1
+  801dca:	e8 ba 26 00 00       	call   804489 <ipc_find_env>
+  801dcf:	a3 00 60 80 00       	mov    %eax,0x806000
+  801dd4:	83 c4 10             	add    $0x10,%esp
+  801dd7:	eb c5                	jmp    801d9e <fsipc+0x12>
+
+00801dd9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	53                   	push   %ebx
+  801ddd:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801de0:	68 04 60 80 00       	push   $0x806004
+  801de5:	e8 29 1b 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ded:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801df5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df8:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e02:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e07:	e8 80 ff ff ff       	call   801d8c <fsipc>
+  801e0c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e0e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801e15:	e8 66 1b 00 00       	call   803980 <mutex_unlock>
+	return r;
+}
+  801e1a:	89 d8                	mov    %ebx,%eax
+  801e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1f:	c9                   	leave
+  801e20:	c3                   	ret
+
+00801e21 <devfile_flush>:
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	53                   	push   %ebx
+  801e25:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801e28:	68 04 60 80 00       	push   $0x806004
+  801e2d:	e8 e1 1a 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e35:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e38:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e42:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e47:	e8 40 ff ff ff       	call   801d8c <fsipc>
+  801e4c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e4e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801e55:	e8 26 1b 00 00       	call   803980 <mutex_unlock>
+}
+  801e5a:	89 d8                	mov    %ebx,%eax
+  801e5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5f:	c9                   	leave
+  801e60:	c3                   	ret
+
+00801e61 <devfile_stat>:
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	56                   	push   %esi
+  801e65:	53                   	push   %ebx
+  801e66:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801e69:	83 ec 0c             	sub    $0xc,%esp
+  801e6c:	68 04 60 80 00       	push   $0x806004
+  801e71:	e8 9d 1a 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e79:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e7c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801e81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e86:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e8b:	e8 fc fe ff ff       	call   801d8c <fsipc>
+  801e90:	89 c3                	mov    %eax,%ebx
+  801e92:	83 c4 10             	add    $0x10,%esp
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	79 16                	jns    801eaf <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801e99:	83 ec 0c             	sub    $0xc,%esp
+  801e9c:	68 04 60 80 00       	push   $0x806004
+  801ea1:	e8 da 1a 00 00       	call   803980 <mutex_unlock>
+}
+  801ea6:	89 d8                	mov    %ebx,%eax
+  801ea8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eab:	5b                   	pop    %ebx
+  801eac:	5e                   	pop    %esi
+  801ead:	5d                   	pop    %ebp
+  801eae:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801eaf:	83 ec 08             	sub    $0x8,%esp
+  801eb2:	68 00 70 80 00       	push   $0x807000
+  801eb7:	56                   	push   %esi
+  801eb8:	e8 42 e9 ff ff       	call   8007ff <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801ebd:	a1 80 70 80 00       	mov    0x807080,%eax
+  801ec2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ec8:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ecd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801ed3:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edb:	eb bc                	jmp    801e99 <devfile_stat+0x38>
+
+00801edd <devfile_write>:
+{
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	53                   	push   %ebx
+  801ee1:	83 ec 10             	sub    $0x10,%esp
+  801ee4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801ee7:	68 04 60 80 00       	push   $0x806004
+  801eec:	e8 22 1a 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801f05:	76 3d                	jbe    801f44 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801f07:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801f0c:	39 c3                	cmp    %eax,%ebx
+  801f0e:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801f11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f14:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801f19:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f24:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f29:	e8 5e fe ff ff       	call   801d8c <fsipc>
+  801f2e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f30:	83 ec 0c             	sub    $0xc,%esp
+  801f33:	68 04 60 80 00       	push   $0x806004
+  801f38:	e8 43 1a 00 00       	call   803980 <mutex_unlock>
+}
+  801f3d:	89 d8                	mov    %ebx,%eax
+  801f3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f42:	c9                   	leave
+  801f43:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801f44:	83 ec 04             	sub    $0x4,%esp
+  801f47:	53                   	push   %ebx
+  801f48:	ff 75 0c             	push   0xc(%ebp)
+  801f4b:	68 0c 70 80 00       	push   $0x80700c
+  801f50:	e8 30 ea ff ff       	call   800985 <memmove>
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5d:	eb b5                	jmp    801f14 <devfile_write+0x37>
+
+00801f5f <devfile_read>:
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	57                   	push   %edi
+  801f63:	56                   	push   %esi
+  801f64:	53                   	push   %ebx
+  801f65:	83 ec 0c             	sub    $0xc,%esp
+  801f68:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f6b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801f71:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801f77:	0f 86 8c 00 00 00    	jbe    802009 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801f7d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801f82:	39 c3                	cmp    %eax,%ebx
+  801f84:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801f87:	89 f8                	mov    %edi,%eax
+  801f89:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801f8c:	eb 0f                	jmp    801f9d <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801f8e:	0f b6 08             	movzbl (%eax),%ecx
+  801f91:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801f93:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f98:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801f9d:	39 d0                	cmp    %edx,%eax
+  801f9f:	72 ed                	jb     801f8e <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801fa1:	83 ec 0c             	sub    $0xc,%esp
+  801fa4:	68 04 60 80 00       	push   $0x806004
+  801fa9:	e8 65 19 00 00       	call   803913 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fae:	8b 46 0c             	mov    0xc(%esi),%eax
+  801fb1:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801fb6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801fbc:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  801fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fcc:	e8 bb fd ff ff       	call   801d8c <fsipc>
+  801fd1:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801fd3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801fda:	e8 a1 19 00 00       	call   803980 <mutex_unlock>
+		assert(r <= (int) n);
+  801fdf:	83 c4 10             	add    $0x10,%esp
+  801fe2:	39 f3                	cmp    %esi,%ebx
+  801fe4:	7c 0a                	jl     801ff0 <devfile_read+0x91>
+}
+  801fe6:	89 f0                	mov    %esi,%eax
+  801fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801feb:	5b                   	pop    %ebx
+  801fec:	5e                   	pop    %esi
+  801fed:	5f                   	pop    %edi
+  801fee:	5d                   	pop    %ebp
+  801fef:	c3                   	ret
+		assert(r <= (int) n);
+  801ff0:	68 74 4d 80 00       	push   $0x804d74
+  801ff5:	68 b1 4c 80 00       	push   $0x804cb1
+  801ffa:	68 90 00 00 00       	push   $0x90
+  801fff:	68 81 4d 80 00       	push   $0x804d81
+  802004:	e8 8a 22 00 00       	call   804293 <_panic>
+	mutex_lock(&fsipc_mu);
+  802009:	83 ec 0c             	sub    $0xc,%esp
+  80200c:	68 04 60 80 00       	push   $0x806004
+  802011:	e8 fd 18 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802016:	8b 46 0c             	mov    0xc(%esi),%eax
+  802019:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80201e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  802024:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80202b:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802033:	b8 03 00 00 00       	mov    $0x3,%eax
+  802038:	e8 4f fd ff ff       	call   801d8c <fsipc>
+  80203d:	89 c6                	mov    %eax,%esi
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	85 c0                	test   %eax,%eax
+  802044:	78 1d                	js     802063 <devfile_read+0x104>
+		assert(r <= n);
+  802046:	39 c3                	cmp    %eax,%ebx
+  802048:	72 2e                	jb     802078 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80204a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80204f:	7f 40                	jg     802091 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802051:	83 ec 04             	sub    $0x4,%esp
+  802054:	50                   	push   %eax
+  802055:	68 00 70 80 00       	push   $0x807000
+  80205a:	57                   	push   %edi
+  80205b:	e8 25 e9 ff ff       	call   800985 <memmove>
+  802060:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	68 04 60 80 00       	push   $0x806004
+  80206b:	e8 10 19 00 00       	call   803980 <mutex_unlock>
+	return r;
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	e9 6e ff ff ff       	jmp    801fe6 <devfile_read+0x87>
+		assert(r <= n);
+  802078:	68 8c 4d 80 00       	push   $0x804d8c
+  80207d:	68 b1 4c 80 00       	push   $0x804cb1
+  802082:	68 99 00 00 00       	push   $0x99
+  802087:	68 81 4d 80 00       	push   $0x804d81
+  80208c:	e8 02 22 00 00       	call   804293 <_panic>
+		assert(r <= PGSIZE);
+  802091:	68 93 4d 80 00       	push   $0x804d93
+  802096:	68 b1 4c 80 00       	push   $0x804cb1
+  80209b:	68 9a 00 00 00       	push   $0x9a
+  8020a0:	68 81 4d 80 00       	push   $0x804d81
+  8020a5:	e8 e9 21 00 00       	call   804293 <_panic>
+
+008020aa <open>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	56                   	push   %esi
+  8020ae:	53                   	push   %ebx
+  8020af:	83 ec 1c             	sub    $0x1c,%esp
+  8020b2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020b5:	56                   	push   %esi
+  8020b6:	e8 09 e7 ff ff       	call   8007c4 <strlen>
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  8020be:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020c3:	0f 8f 85 00 00 00    	jg     80214e <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020c9:	83 ec 0c             	sub    $0xc,%esp
+  8020cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cf:	50                   	push   %eax
+  8020d0:	e8 a7 f6 ff ff       	call   80177c <fd_alloc>
+  8020d5:	89 c3                	mov    %eax,%ebx
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 55                	js     802133 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	68 04 60 80 00       	push   $0x806004
+  8020e6:	e8 28 18 00 00       	call   803913 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020eb:	83 c4 08             	add    $0x8,%esp
+  8020ee:	56                   	push   %esi
+  8020ef:	68 00 70 80 00       	push   $0x807000
+  8020f4:	e8 06 e7 ff ff       	call   8007ff <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020fc:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  802101:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802104:	b8 01 00 00 00       	mov    $0x1,%eax
+  802109:	e8 7e fc ff ff       	call   801d8c <fsipc>
+  80210e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802110:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802117:	e8 64 18 00 00       	call   803980 <mutex_unlock>
+	if (r < 0) {
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	85 db                	test   %ebx,%ebx
+  802121:	78 19                	js     80213c <open+0x92>
+	return fd2num(fd);
+  802123:	83 ec 0c             	sub    $0xc,%esp
+  802126:	ff 75 f4             	push   -0xc(%ebp)
+  802129:	e8 27 f6 ff ff       	call   801755 <fd2num>
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	83 c4 10             	add    $0x10,%esp
+}
+  802133:	89 d8                	mov    %ebx,%eax
+  802135:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802138:	5b                   	pop    %ebx
+  802139:	5e                   	pop    %esi
+  80213a:	5d                   	pop    %ebp
+  80213b:	c3                   	ret
+		fd_close(fd, 0);
+  80213c:	83 ec 08             	sub    $0x8,%esp
+  80213f:	6a 00                	push   $0x0
+  802141:	ff 75 f4             	push   -0xc(%ebp)
+  802144:	e8 56 f7 ff ff       	call   80189f <fd_close>
+		return r;
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	eb e5                	jmp    802133 <open+0x89>
+		return -E_BAD_PATH;
+  80214e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802153:	eb de                	jmp    802133 <open+0x89>
+
+00802155 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802155:	55                   	push   %ebp
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	53                   	push   %ebx
+  802159:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80215c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215f:	50                   	push   %eax
+  802160:	ff 75 08             	push   0x8(%ebp)
+  802163:	e8 6a f6 ff ff       	call   8017d2 <fd_lookup>
+  802168:	89 c3                	mov    %eax,%ebx
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 5b                	js     8021cc <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802171:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802174:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80217a:	39 08                	cmp    %ecx,(%eax)
+  80217c:	75 55                	jne    8021d3 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80217e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802182:	74 56                	je     8021da <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	68 04 60 80 00       	push   $0x806004
+  80218c:	e8 82 17 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802191:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802194:	8b 40 0c             	mov    0xc(%eax),%eax
+  802197:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  80219c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80219f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8021a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021a7:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8021ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021b6:	e8 d1 fb ff ff       	call   801d8c <fsipc>
+  8021bb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021bd:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8021c4:	e8 b7 17 00 00       	call   803980 <mutex_unlock>
+	return r;
+  8021c9:	83 c4 10             	add    $0x10,%esp
+}
+  8021cc:	89 d8                	mov    %ebx,%eax
+  8021ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021d3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021d8:	eb f2                	jmp    8021cc <fallocate+0x77>
+		return -E_INVAL;
+  8021da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021df:	eb eb                	jmp    8021cc <fallocate+0x77>
+
+008021e1 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	56                   	push   %esi
+  8021e5:	53                   	push   %ebx
+  8021e6:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8021e9:	89 f3                	mov    %esi,%ebx
+  8021eb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8021f1:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8021f4:	eb 06                	jmp    8021fc <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8021f6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021fc:	39 f3                	cmp    %esi,%ebx
+  8021fe:	73 14                	jae    802214 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802200:	83 ec 08             	sub    $0x8,%esp
+  802203:	53                   	push   %ebx
+  802204:	6a 00                	push   $0x0
+  802206:	e8 cb ea ff ff       	call   800cd6 <sys_page_unmap>
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	79 e4                	jns    8021f6 <munmap+0x15>
+  802212:	eb 05                	jmp    802219 <munmap+0x38>
+			return r;
+	return 0;
+  802214:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802219:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221c:	5b                   	pop    %ebx
+  80221d:	5e                   	pop    %esi
+  80221e:	5d                   	pop    %ebp
+  80221f:	c3                   	ret
+
+00802220 <mmap>:
+{
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	57                   	push   %edi
+  802224:	56                   	push   %esi
+  802225:	53                   	push   %ebx
+  802226:	83 ec 24             	sub    $0x24,%esp
+  802229:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80222c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80222f:	50                   	push   %eax
+  802230:	ff 75 08             	push   0x8(%ebp)
+  802233:	e8 9a f5 ff ff       	call   8017d2 <fd_lookup>
+  802238:	83 c4 10             	add    $0x10,%esp
+  80223b:	85 c0                	test   %eax,%eax
+  80223d:	0f 88 37 01 00 00    	js     80237a <mmap+0x15a>
+		return NULL;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802248:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80224b:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802251:	39 0a                	cmp    %ecx,(%edx)
+  802253:	0f 85 05 01 00 00    	jne    80235e <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802259:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802260:	0f 85 1b 01 00 00    	jne    802381 <mmap+0x161>
+  802266:	89 f0                	mov    %esi,%eax
+  802268:	83 e8 01             	sub    $0x1,%eax
+  80226b:	0f 88 17 01 00 00    	js     802388 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802271:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802275:	75 28                	jne    80229f <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  80227a:	68 04 60 80 00       	push   $0x806004
+  80227f:	e8 8f 16 00 00       	call   803913 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802284:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80228a:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802298:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80229d:	eb 2b                	jmp    8022ca <mmap+0xaa>
+		cow_enable();
+  80229f:	e8 40 f0 ff ff       	call   8012e4 <cow_enable>
+  8022a4:	eb d1                	jmp    802277 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8022a6:	89 c2                	mov    %eax,%edx
+  8022a8:	c1 ea 0c             	shr    $0xc,%edx
+  8022ab:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8022b2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8022b8:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8022be:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8022c1:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8022c3:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8022c8:	77 25                	ja     8022ef <mmap+0xcf>
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	29 da                	sub    %ebx,%edx
+  8022ce:	39 ca                	cmp    %ecx,%edx
+  8022d0:	73 3a                	jae    80230c <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8022d2:	89 c2                	mov    %eax,%edx
+  8022d4:	c1 ea 16             	shr    $0x16,%edx
+  8022d7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022de:	f6 c2 01             	test   $0x1,%dl
+  8022e1:	75 c3                	jne    8022a6 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8022e3:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8022e8:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8022ed:	eb d4                	jmp    8022c3 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8022ef:	29 d8                	sub    %ebx,%eax
+  8022f1:	39 c8                	cmp    %ecx,%eax
+  8022f3:	73 17                	jae    80230c <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8022f5:	83 ec 0c             	sub    $0xc,%esp
+  8022f8:	68 04 60 80 00       	push   $0x806004
+  8022fd:	e8 7e 16 00 00       	call   803980 <mutex_unlock>
+		return NULL;
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230a:	eb 52                	jmp    80235e <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80230c:	85 db                	test   %ebx,%ebx
+  80230e:	74 e5                	je     8022f5 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802310:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802313:	8b 40 0c             	mov    0xc(%eax),%eax
+  802316:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80231b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  802323:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  802329:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  80232f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802332:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  802337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802341:	e8 46 fa ff ff       	call   801d8c <fsipc>
+  802346:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802348:	83 ec 0c             	sub    $0xc,%esp
+  80234b:	68 04 60 80 00       	push   $0x806004
+  802350:	e8 2b 16 00 00       	call   803980 <mutex_unlock>
+	if (r < 0) {
+  802355:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802358:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80235a:	85 ff                	test   %edi,%edi
+  80235c:	78 08                	js     802366 <mmap+0x146>
+}
+  80235e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802361:	5b                   	pop    %ebx
+  802362:	5e                   	pop    %esi
+  802363:	5f                   	pop    %edi
+  802364:	5d                   	pop    %ebp
+  802365:	c3                   	ret
+		munmap((void*) va, len);
+  802366:	83 ec 08             	sub    $0x8,%esp
+  802369:	56                   	push   %esi
+  80236a:	53                   	push   %ebx
+  80236b:	e8 71 fe ff ff       	call   8021e1 <munmap>
+		return NULL;
+  802370:	83 c4 10             	add    $0x10,%esp
+  802373:	b8 00 00 00 00       	mov    $0x0,%eax
+  802378:	eb e4                	jmp    80235e <mmap+0x13e>
+		return NULL;
+  80237a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237f:	eb dd                	jmp    80235e <mmap+0x13e>
+		return NULL;
+  802381:	b8 00 00 00 00       	mov    $0x0,%eax
+  802386:	eb d6                	jmp    80235e <mmap+0x13e>
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238d:	eb cf                	jmp    80235e <mmap+0x13e>
+
+0080238f <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	53                   	push   %ebx
+  802393:	83 ec 10             	sub    $0x10,%esp
+  802396:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802399:	53                   	push   %ebx
+  80239a:	e8 25 e4 ff ff       	call   8007c4 <strlen>
+  80239f:	83 c4 10             	add    $0x10,%esp
+  8023a2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023a7:	7f 42                	jg     8023eb <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8023a9:	83 ec 0c             	sub    $0xc,%esp
+  8023ac:	68 04 60 80 00       	push   $0x806004
+  8023b1:	e8 5d 15 00 00       	call   803913 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8023b6:	83 c4 08             	add    $0x8,%esp
+  8023b9:	53                   	push   %ebx
+  8023ba:	68 00 70 80 00       	push   $0x807000
+  8023bf:	e8 3b e4 ff ff       	call   8007ff <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8023c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023ce:	e8 b9 f9 ff ff       	call   801d8c <fsipc>
+  8023d3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023d5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8023dc:	e8 9f 15 00 00       	call   803980 <mutex_unlock>
+	return r;
+  8023e1:	83 c4 10             	add    $0x10,%esp
+}
+  8023e4:	89 d8                	mov    %ebx,%eax
+  8023e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+		return -E_BAD_PATH;
+  8023eb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023f0:	eb f2                	jmp    8023e4 <remove+0x55>
+
+008023f2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	53                   	push   %ebx
+  8023f6:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8023f9:	68 04 60 80 00       	push   $0x806004
+  8023fe:	e8 10 15 00 00       	call   803913 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802403:	ba 00 00 00 00       	mov    $0x0,%edx
+  802408:	b8 08 00 00 00       	mov    $0x8,%eax
+  80240d:	e8 7a f9 ff ff       	call   801d8c <fsipc>
+  802412:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802414:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80241b:	e8 60 15 00 00       	call   803980 <mutex_unlock>
+	return r;
+}
+  802420:	89 d8                	mov    %ebx,%eax
+  802422:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802425:	c9                   	leave
+  802426:	c3                   	ret
+
+00802427 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802427:	55                   	push   %ebp
+  802428:	89 e5                	mov    %esp,%ebp
+  80242a:	56                   	push   %esi
+  80242b:	53                   	push   %ebx
+  80242c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80242f:	83 ec 0c             	sub    $0xc,%esp
+  802432:	68 04 60 80 00       	push   $0x806004
+  802437:	e8 d7 14 00 00       	call   803913 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80243c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802444:	ba 00 00 00 00       	mov    $0x0,%edx
+  802449:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80244e:	e8 39 f9 ff ff       	call   801d8c <fsipc>
+  802453:	89 c6                	mov    %eax,%esi
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	85 db                	test   %ebx,%ebx
+  80245a:	74 7b                	je     8024d7 <fs_bcstat+0xb0>
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	78 77                	js     8024d7 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802460:	a1 00 70 80 00       	mov    0x807000,%eax
+  802465:	89 03                	mov    %eax,(%ebx)
+  802467:	a1 04 70 80 00       	mov    0x807004,%eax
+  80246c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80246f:	a1 08 70 80 00       	mov    0x807008,%eax
+  802474:	89 43 08             	mov    %eax,0x8(%ebx)
+  802477:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80247c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80247f:	a1 10 70 80 00       	mov    0x807010,%eax
+  802484:	89 43 10             	mov    %eax,0x10(%ebx)
+  802487:	a1 14 70 80 00       	mov    0x807014,%eax
+  80248c:	89 43 14             	mov    %eax,0x14(%ebx)
+  80248f:	a1 18 70 80 00       	mov    0x807018,%eax
+  802494:	89 43 18             	mov    %eax,0x18(%ebx)
+  802497:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  80249c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80249f:	a1 20 70 80 00       	mov    0x807020,%eax
+  8024a4:	89 43 20             	mov    %eax,0x20(%ebx)
+  8024a7:	a1 24 70 80 00       	mov    0x807024,%eax
+  8024ac:	89 43 24             	mov    %eax,0x24(%ebx)
+  8024af:	a1 28 70 80 00       	mov    0x807028,%eax
+  8024b4:	89 43 28             	mov    %eax,0x28(%ebx)
+  8024b7:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8024bc:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8024bf:	a1 30 70 80 00       	mov    0x807030,%eax
+  8024c4:	89 43 30             	mov    %eax,0x30(%ebx)
+  8024c7:	a1 34 70 80 00       	mov    0x807034,%eax
+  8024cc:	89 43 34             	mov    %eax,0x34(%ebx)
+  8024cf:	a1 38 70 80 00       	mov    0x807038,%eax
+  8024d4:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8024d7:	83 ec 0c             	sub    $0xc,%esp
+  8024da:	68 04 60 80 00       	push   $0x806004
+  8024df:	e8 9c 14 00 00       	call   803980 <mutex_unlock>
+	return r;
+}
+  8024e4:	89 f0                	mov    %esi,%eax
+  8024e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e9:	5b                   	pop    %ebx
+  8024ea:	5e                   	pop    %esi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+
+008024ed <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	56                   	push   %esi
+  8024f1:	53                   	push   %ebx
+  8024f2:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8024f4:	0f b6 10             	movzbl (%eax),%edx
+  8024f7:	80 fa 72             	cmp    $0x72,%dl
+  8024fa:	74 44                	je     802540 <parse_mode+0x53>
+  8024fc:	80 fa 77             	cmp    $0x77,%dl
+  8024ff:	74 4b                	je     80254c <parse_mode+0x5f>
+  802501:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802506:	80 fa 61             	cmp    $0x61,%dl
+  802509:	74 09                	je     802514 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80250b:	89 d8                	mov    %ebx,%eax
+  80250d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802510:	5b                   	pop    %ebx
+  802511:	5e                   	pop    %esi
+  802512:	5d                   	pop    %ebp
+  802513:	c3                   	ret
+	switch (mode[0]) {
+  802514:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802519:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80251e:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802520:	83 ec 08             	sub    $0x8,%esp
+  802523:	6a 2b                	push   $0x2b
+  802525:	50                   	push   %eax
+  802526:	e8 e6 e3 ff ff       	call   800911 <strchr>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	74 d9                	je     80250b <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802532:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802535:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802538:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80253e:	eb cb                	jmp    80250b <parse_mode+0x1e>
+	switch (mode[0]) {
+  802540:	ba 01 00 00 00       	mov    $0x1,%edx
+  802545:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80254a:	eb d2                	jmp    80251e <parse_mode+0x31>
+  80254c:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802551:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802556:	eb c6                	jmp    80251e <parse_mode+0x31>
+
+00802558 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	57                   	push   %edi
+  80255c:	56                   	push   %esi
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 1c             	sub    $0x1c,%esp
+  802561:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802564:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802567:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80256c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802571:	83 c0 24             	add    $0x24,%eax
+  802574:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802578:	74 17                	je     802591 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80257a:	83 c3 01             	add    $0x1,%ebx
+  80257d:	83 fb 10             	cmp    $0x10,%ebx
+  802580:	75 ef                	jne    802571 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802582:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802587:	89 f0                	mov    %esi,%eax
+  802589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258c:	5b                   	pop    %ebx
+  80258d:	5e                   	pop    %esi
+  80258e:	5f                   	pop    %edi
+  80258f:	5d                   	pop    %ebp
+  802590:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802591:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802598:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80259b:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80259e:	c1 e7 02             	shl    $0x2,%edi
+  8025a1:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8025a7:	83 ec 04             	sub    $0x4,%esp
+  8025aa:	6a 24                	push   $0x24
+  8025ac:	6a 00                	push   $0x0
+  8025ae:	56                   	push   %esi
+  8025af:	e8 9c e3 ff ff       	call   800950 <memset>
+			streams[i].f_fd = fd;
+  8025b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8025b7:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8025bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025c0:	01 d8                	add    %ebx,%eax
+  8025c2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c5:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8025cc:	83 c4 10             	add    $0x10,%esp
+  8025cf:	eb b6                	jmp    802587 <stream_alloc+0x2f>
+
+008025d1 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	53                   	push   %ebx
+  8025d5:	83 ec 14             	sub    $0x14,%esp
+  8025d8:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8025da:	8b 40 18             	mov    0x18(%eax),%eax
+  8025dd:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8025e0:	74 4a                	je     80262c <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025e2:	83 ec 08             	sub    $0x8,%esp
+  8025e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025e8:	50                   	push   %eax
+  8025e9:	ff 33                	push   (%ebx)
+  8025eb:	e8 e2 f1 ff ff       	call   8017d2 <fd_lookup>
+  8025f0:	89 c2                	mov    %eax,%edx
+  8025f2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8025f5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025fa:	85 d2                	test   %edx,%edx
+  8025fc:	78 41                	js     80263f <stream_unread+0x6e>
+  8025fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802601:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802607:	39 0a                	cmp    %ecx,(%edx)
+  802609:	75 34                	jne    80263f <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80260b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80260e:	03 42 04             	add    0x4(%edx),%eax
+  802611:	2b 43 18             	sub    0x18(%ebx),%eax
+  802614:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802617:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80261e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802625:	b8 01 00 00 00       	mov    $0x1,%eax
+  80262a:	eb 13                	jmp    80263f <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80262c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802633:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80263a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80263f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+00802644 <stream_drain>:
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	56                   	push   %esi
+  802648:	53                   	push   %ebx
+  802649:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80264b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802650:	eb 02                	jmp    802654 <stream_drain+0x10>
+  802652:	01 c3                	add    %eax,%ebx
+  802654:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802657:	39 c3                	cmp    %eax,%ebx
+  802659:	73 43                	jae    80269e <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	29 d8                	sub    %ebx,%eax
+  802660:	50                   	push   %eax
+  802661:	89 d8                	mov    %ebx,%eax
+  802663:	03 46 0c             	add    0xc(%esi),%eax
+  802666:	50                   	push   %eax
+  802667:	ff 36                	push   (%esi)
+  802669:	e8 ec f4 ff ff       	call   801b5a <write>
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	85 c0                	test   %eax,%eax
+  802673:	7f dd                	jg     802652 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802675:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802679:	8b 56 0c             	mov    0xc(%esi),%edx
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802682:	29 d8                	sub    %ebx,%eax
+  802684:	50                   	push   %eax
+  802685:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802688:	50                   	push   %eax
+  802689:	52                   	push   %edx
+  80268a:	e8 f6 e2 ff ff       	call   800985 <memmove>
+			f->f_wend -= done;
+  80268f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802692:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802694:	83 c4 10             	add    $0x10,%esp
+  802697:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80269c:	eb 0a                	jmp    8026a8 <stream_drain+0x64>
+  80269e:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8026a3:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8026a8:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8026ab:	89 d0                	mov    %edx,%eax
+  8026ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b0:	5b                   	pop    %ebx
+  8026b1:	5e                   	pop    %esi
+  8026b2:	5d                   	pop    %ebp
+  8026b3:	c3                   	ret
+
+008026b4 <stream_setup>:
+	if (f->f_buf)
+  8026b4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8026b8:	74 01                	je     8026bb <stream_setup+0x7>
+  8026ba:	c3                   	ret
+{
+  8026bb:	55                   	push   %ebp
+  8026bc:	89 e5                	mov    %esp,%ebp
+  8026be:	53                   	push   %ebx
+  8026bf:	83 ec 04             	sub    $0x4,%esp
+  8026c2:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8026c4:	8b 40 08             	mov    0x8(%eax),%eax
+  8026c7:	85 c0                	test   %eax,%eax
+  8026c9:	74 17                	je     8026e2 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8026cb:	83 f8 03             	cmp    $0x3,%eax
+  8026ce:	75 2d                	jne    8026fd <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8026d0:	8d 43 20             	lea    0x20(%ebx),%eax
+  8026d3:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8026d6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8026dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8026e2:	83 ec 0c             	sub    $0xc,%esp
+  8026e5:	ff 33                	push   (%ebx)
+  8026e7:	e8 29 1b 00 00       	call   804215 <iscons>
+  8026ec:	83 c4 10             	add    $0x10,%esp
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	0f 9f c0             	setg   %al
+  8026f4:	0f b6 c0             	movzbl %al,%eax
+  8026f7:	83 c0 01             	add    $0x1,%eax
+  8026fa:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8026fd:	83 ec 0c             	sub    $0xc,%esp
+  802700:	68 00 10 00 00       	push   $0x1000
+  802705:	e8 6e 0b 00 00       	call   803278 <malloc>
+  80270a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	85 c0                	test   %eax,%eax
+  802712:	74 bc                	je     8026d0 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802714:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80271b:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80271f:	eb bc                	jmp    8026dd <stream_setup+0x29>
+
+00802721 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	53                   	push   %ebx
+  802725:	83 ec 04             	sub    $0x4,%esp
+  802728:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80272a:	e8 85 ff ff ff       	call   8026b4 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80272f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802734:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802738:	74 3d                	je     802777 <stream_fill+0x56>
+  80273a:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80273e:	74 10                	je     802750 <stream_fill+0x2f>
+  802740:	89 d8                	mov    %ebx,%eax
+  802742:	e8 fd fe ff ff       	call   802644 <stream_drain>
+		return 0;
+  802747:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	78 27                	js     802777 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802750:	83 ec 04             	sub    $0x4,%esp
+  802753:	ff 73 10             	push   0x10(%ebx)
+  802756:	ff 73 0c             	push   0xc(%ebx)
+  802759:	ff 33                	push   (%ebx)
+  80275b:	e8 02 f3 ff ff       	call   801a62 <read>
+  802760:	83 c4 10             	add    $0x10,%esp
+  802763:	85 c0                	test   %eax,%eax
+  802765:	7e 17                	jle    80277e <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802767:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80276b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802772:	89 c2                	mov    %eax,%edx
+  802774:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802777:	89 d0                	mov    %edx,%eax
+  802779:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80277c:	c9                   	leave
+  80277d:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80277e:	c1 f8 1f             	sar    $0x1f,%eax
+  802781:	83 e0 04             	and    $0x4,%eax
+  802784:	83 c0 04             	add    $0x4,%eax
+  802787:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80278a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278f:	eb e6                	jmp    802777 <stream_fill+0x56>
+
+00802791 <fopen>:
+{
+  802791:	55                   	push   %ebp
+  802792:	89 e5                	mov    %esp,%ebp
+  802794:	57                   	push   %edi
+  802795:	56                   	push   %esi
+  802796:	53                   	push   %ebx
+  802797:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80279d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8027a0:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8027a6:	89 f0                	mov    %esi,%eax
+  8027a8:	e8 40 fd ff ff       	call   8024ed <parse_mode>
+		return 0;
+  8027ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8027b2:	85 c0                	test   %eax,%eax
+  8027b4:	78 2d                	js     8027e3 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8027b6:	83 ec 08             	sub    $0x8,%esp
+  8027b9:	50                   	push   %eax
+  8027ba:	ff 75 08             	push   0x8(%ebp)
+  8027bd:	e8 e8 f8 ff ff       	call   8020aa <open>
+  8027c2:	89 c7                	mov    %eax,%edi
+  8027c4:	83 c4 10             	add    $0x10,%esp
+  8027c7:	85 c0                	test   %eax,%eax
+  8027c9:	78 58                	js     802823 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8027cb:	80 3e 61             	cmpb   $0x61,(%esi)
+  8027ce:	74 1d                	je     8027ed <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8027d0:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8027d6:	89 f8                	mov    %edi,%eax
+  8027d8:	e8 7b fd ff ff       	call   802558 <stream_alloc>
+  8027dd:	89 c3                	mov    %eax,%ebx
+  8027df:	85 c0                	test   %eax,%eax
+  8027e1:	74 32                	je     802815 <fopen+0x84>
+}
+  8027e3:	89 d8                	mov    %ebx,%eax
+  8027e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e8:	5b                   	pop    %ebx
+  8027e9:	5e                   	pop    %esi
+  8027ea:	5f                   	pop    %edi
+  8027eb:	5d                   	pop    %ebp
+  8027ec:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+  8027f0:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8027f6:	50                   	push   %eax
+  8027f7:	57                   	push   %edi
+  8027f8:	e8 db f4 ff ff       	call   801cd8 <fstat>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	85 c0                	test   %eax,%eax
+  802802:	78 cc                	js     8027d0 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802804:	83 ec 08             	sub    $0x8,%esp
+  802807:	ff 75 dc             	push   -0x24(%ebp)
+  80280a:	57                   	push   %edi
+  80280b:	e8 f6 f3 ff ff       	call   801c06 <seek>
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	eb bb                	jmp    8027d0 <fopen+0x3f>
+		close(fd);
+  802815:	83 ec 0c             	sub    $0xc,%esp
+  802818:	57                   	push   %edi
+  802819:	e8 08 f1 ff ff       	call   801926 <close>
+  80281e:	83 c4 10             	add    $0x10,%esp
+  802821:	eb c0                	jmp    8027e3 <fopen+0x52>
+		return 0;
+  802823:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802828:	eb b9                	jmp    8027e3 <fopen+0x52>
+
+0080282a <fdopen>:
+{
+  80282a:	55                   	push   %ebp
+  80282b:	89 e5                	mov    %esp,%ebp
+  80282d:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802830:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802833:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802836:	e8 b2 fc ff ff       	call   8024ed <parse_mode>
+  80283b:	89 c2                	mov    %eax,%edx
+		return 0;
+  80283d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802842:	85 d2                	test   %edx,%edx
+  802844:	78 0b                	js     802851 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802846:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284c:	e8 07 fd ff ff       	call   802558 <stream_alloc>
+}
+  802851:	c9                   	leave
+  802852:	c3                   	ret
+
+00802853 <setvbuf>:
+{
+  802853:	55                   	push   %ebp
+  802854:	89 e5                	mov    %esp,%ebp
+  802856:	57                   	push   %edi
+  802857:	56                   	push   %esi
+  802858:	53                   	push   %ebx
+  802859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80285f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802862:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802866:	75 3a                	jne    8028a2 <setvbuf+0x4f>
+  802868:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80286b:	83 fe 02             	cmp    $0x2,%esi
+  80286e:	77 39                	ja     8028a9 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802870:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802873:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802877:	0f 95 c3             	setne  %bl
+  80287a:	85 ff                	test   %edi,%edi
+  80287c:	0f 95 c1             	setne  %cl
+  80287f:	84 cb                	test   %cl,%bl
+  802881:	74 05                	je     802888 <setvbuf+0x35>
+  802883:	83 fa 03             	cmp    $0x3,%edx
+  802886:	75 0a                	jne    802892 <setvbuf+0x3f>
+	return 0;
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288d:	5b                   	pop    %ebx
+  80288e:	5e                   	pop    %esi
+  80288f:	5f                   	pop    %edi
+  802890:	5d                   	pop    %ebp
+  802891:	c3                   	ret
+		f->f_buf = buf;
+  802892:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802895:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802898:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80289b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a0:	eb eb                	jmp    80288d <setvbuf+0x3a>
+		return EOF;
+  8028a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8028a7:	eb e4                	jmp    80288d <setvbuf+0x3a>
+  8028a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8028ae:	eb dd                	jmp    80288d <setvbuf+0x3a>
+
+008028b0 <fflush>:
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	57                   	push   %edi
+  8028b4:	56                   	push   %esi
+  8028b5:	53                   	push   %ebx
+  8028b6:	83 ec 0c             	sub    $0xc,%esp
+  8028b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8028bc:	85 db                	test   %ebx,%ebx
+  8028be:	74 1a                	je     8028da <fflush+0x2a>
+	stream_unread(f);
+  8028c0:	89 d8                	mov    %ebx,%eax
+  8028c2:	e8 0a fd ff ff       	call   8025d1 <stream_unread>
+	return stream_drain(f);
+  8028c7:	89 d8                	mov    %ebx,%eax
+  8028c9:	e8 76 fd ff ff       	call   802644 <stream_drain>
+  8028ce:	89 c7                	mov    %eax,%edi
+}
+  8028d0:	89 f8                	mov    %edi,%eax
+  8028d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d5:	5b                   	pop    %ebx
+  8028d6:	5e                   	pop    %esi
+  8028d7:	5f                   	pop    %edi
+  8028d8:	5d                   	pop    %ebp
+  8028d9:	c3                   	ret
+  8028da:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8028df:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8028e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e9:	eb 03                	jmp    8028ee <fflush+0x3e>
+  8028eb:	83 c3 24             	add    $0x24,%ebx
+  8028ee:	39 f3                	cmp    %esi,%ebx
+  8028f0:	74 de                	je     8028d0 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8028f2:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8028f6:	74 f3                	je     8028eb <fflush+0x3b>
+  8028f8:	83 ec 0c             	sub    $0xc,%esp
+  8028fb:	53                   	push   %ebx
+  8028fc:	e8 af ff ff ff       	call   8028b0 <fflush>
+  802901:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802904:	85 c0                	test   %eax,%eax
+  802906:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80290b:	0f 48 f8             	cmovs  %eax,%edi
+  80290e:	eb db                	jmp    8028eb <fflush+0x3b>
+
+00802910 <fclose>:
+{
+  802910:	55                   	push   %ebp
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	56                   	push   %esi
+  802914:	53                   	push   %ebx
+  802915:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802918:	83 ec 0c             	sub    $0xc,%esp
+  80291b:	56                   	push   %esi
+  80291c:	e8 8f ff ff ff       	call   8028b0 <fflush>
+  802921:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802923:	83 c4 04             	add    $0x4,%esp
+  802926:	ff 36                	push   (%esi)
+  802928:	e8 f9 ef ff ff       	call   801926 <close>
+  80292d:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802930:	85 c0                	test   %eax,%eax
+  802932:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802937:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80293a:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80293e:	75 10                	jne    802950 <fclose+0x40>
+	f->f_flags = 0;
+  802940:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802947:	89 d8                	mov    %ebx,%eax
+  802949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80294c:	5b                   	pop    %ebx
+  80294d:	5e                   	pop    %esi
+  80294e:	5d                   	pop    %ebp
+  80294f:	c3                   	ret
+		free(f->f_buf);
+  802950:	83 ec 0c             	sub    $0xc,%esp
+  802953:	ff 76 0c             	push   0xc(%esi)
+  802956:	e8 54 08 00 00       	call   8031af <free>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	eb e0                	jmp    802940 <fclose+0x30>
+
+00802960 <fileno>:
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802963:	8b 45 08             	mov    0x8(%ebp),%eax
+  802966:	8b 00                	mov    (%eax),%eax
+}
+  802968:	5d                   	pop    %ebp
+  802969:	c3                   	ret
+
+0080296a <feof>:
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80296d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802970:	8b 40 04             	mov    0x4(%eax),%eax
+  802973:	c1 e8 02             	shr    $0x2,%eax
+  802976:	83 e0 01             	and    $0x1,%eax
+}
+  802979:	5d                   	pop    %ebp
+  80297a:	c3                   	ret
+
+0080297b <ferror>:
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80297e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802981:	8b 40 04             	mov    0x4(%eax),%eax
+  802984:	c1 e8 03             	shr    $0x3,%eax
+  802987:	83 e0 01             	and    $0x1,%eax
+}
+  80298a:	5d                   	pop    %ebp
+  80298b:	c3                   	ret
+
+0080298c <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	53                   	push   %ebx
+  802990:	83 ec 04             	sub    $0x4,%esp
+  802993:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802996:	8b 43 18             	mov    0x18(%ebx),%eax
+  802999:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80299c:	74 15                	je     8029b3 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  80299e:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8029a1:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  8029a7:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8029aa:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8029ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8029b3:	89 d8                	mov    %ebx,%eax
+  8029b5:	e8 67 fd ff ff       	call   802721 <stream_fill>
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	75 e0                	jne    80299e <fgetc+0x12>
+		return EOF;
+  8029be:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029c3:	eb e9                	jmp    8029ae <fgetc+0x22>
+
+008029c5 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	57                   	push   %edi
+  8029c9:	56                   	push   %esi
+  8029ca:	53                   	push   %ebx
+  8029cb:	83 ec 1c             	sub    $0x1c,%esp
+  8029ce:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8029d1:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8029d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d9:	83 e8 01             	sub    $0x1,%eax
+  8029dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8029df:	eb 66                	jmp    802a47 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8029e1:	8b 46 14             	mov    0x14(%esi),%eax
+  8029e4:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8029e7:	29 c3                	sub    %eax,%ebx
+  8029e9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8029ec:	29 fa                	sub    %edi,%edx
+  8029ee:	39 d3                	cmp    %edx,%ebx
+  8029f0:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8029f3:	83 ec 04             	sub    $0x4,%esp
+  8029f6:	53                   	push   %ebx
+  8029f7:	6a 0a                	push   $0xa
+  8029f9:	03 46 0c             	add    0xc(%esi),%eax
+  8029fc:	50                   	push   %eax
+  8029fd:	e8 34 e0 ff ff       	call   800a36 <memfind>
+  802a02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802a05:	8b 46 0c             	mov    0xc(%esi),%eax
+  802a08:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802a0b:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802a0e:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802a10:	83 c4 10             	add    $0x10,%esp
+  802a13:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802a16:	74 0b                	je     802a23 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802a18:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802a1b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802a1e:	29 d3                	sub    %edx,%ebx
+  802a20:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802a23:	83 ec 04             	sub    $0x4,%esp
+  802a26:	53                   	push   %ebx
+  802a27:	01 c8                	add    %ecx,%eax
+  802a29:	50                   	push   %eax
+  802a2a:	89 f8                	mov    %edi,%eax
+  802a2c:	03 45 08             	add    0x8(%ebp),%eax
+  802a2f:	50                   	push   %eax
+  802a30:	e8 50 df ff ff       	call   800985 <memmove>
+		f->f_rpos += m;
+  802a35:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802a38:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a40:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802a45:	74 1f                	je     802a66 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802a47:	8d 47 01             	lea    0x1(%edi),%eax
+  802a4a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802a4d:	73 17                	jae    802a66 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a4f:	8b 46 18             	mov    0x18(%esi),%eax
+  802a52:	39 46 14             	cmp    %eax,0x14(%esi)
+  802a55:	75 8a                	jne    8029e1 <fgets+0x1c>
+  802a57:	89 f0                	mov    %esi,%eax
+  802a59:	e8 c3 fc ff ff       	call   802721 <stream_fill>
+  802a5e:	85 c0                	test   %eax,%eax
+  802a60:	0f 85 7b ff ff ff    	jne    8029e1 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802a66:	85 ff                	test   %edi,%edi
+  802a68:	74 0f                	je     802a79 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6d:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a74:	5b                   	pop    %ebx
+  802a75:	5e                   	pop    %esi
+  802a76:	5f                   	pop    %edi
+  802a77:	5d                   	pop    %ebp
+  802a78:	c3                   	ret
+		return 0;
+  802a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7e:	eb f1                	jmp    802a71 <fgets+0xac>
+
+00802a80 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802a80:	55                   	push   %ebp
+  802a81:	89 e5                	mov    %esp,%ebp
+  802a83:	57                   	push   %edi
+  802a84:	56                   	push   %esi
+  802a85:	53                   	push   %ebx
+  802a86:	83 ec 1c             	sub    $0x1c,%esp
+  802a89:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802a8c:	89 f0                	mov    %esi,%eax
+  802a8e:	e8 21 fc ff ff       	call   8026b4 <stream_setup>
+	want = size * n;
+  802a93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a96:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802a9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa2:	eb 43                	jmp    802ae7 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802aa4:	29 d3                	sub    %edx,%ebx
+  802aa6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802aa9:	29 f8                	sub    %edi,%eax
+  802aab:	39 c3                	cmp    %eax,%ebx
+  802aad:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802ab0:	83 ec 04             	sub    $0x4,%esp
+  802ab3:	53                   	push   %ebx
+  802ab4:	03 56 0c             	add    0xc(%esi),%edx
+  802ab7:	52                   	push   %edx
+  802ab8:	89 f8                	mov    %edi,%eax
+  802aba:	03 45 08             	add    0x8(%ebp),%eax
+  802abd:	50                   	push   %eax
+  802abe:	e8 c2 de ff ff       	call   800985 <memmove>
+			f->f_rpos += m;
+  802ac3:	01 5e 14             	add    %ebx,0x14(%esi)
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	eb 1a                	jmp    802ae5 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802acb:	83 ec 04             	sub    $0x4,%esp
+  802ace:	53                   	push   %ebx
+  802acf:	89 f8                	mov    %edi,%eax
+  802ad1:	03 45 08             	add    0x8(%ebp),%eax
+  802ad4:	50                   	push   %eax
+  802ad5:	ff 36                	push   (%esi)
+  802ad7:	e8 86 ef ff ff       	call   801a62 <read>
+  802adc:	89 c3                	mov    %eax,%ebx
+  802ade:	83 c4 10             	add    $0x10,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	7e 36                	jle    802b1b <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802ae5:	01 df                	add    %ebx,%edi
+  802ae7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802aea:	39 c7                	cmp    %eax,%edi
+  802aec:	73 39                	jae    802b27 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802aee:	8b 56 14             	mov    0x14(%esi),%edx
+  802af1:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802af4:	39 da                	cmp    %ebx,%edx
+  802af6:	72 ac                	jb     802aa4 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802af8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802afb:	29 fb                	sub    %edi,%ebx
+  802afd:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802b00:	72 3e                	jb     802b40 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802b02:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802b06:	74 1f                	je     802b27 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802b08:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802b0c:	74 bd                	je     802acb <fread+0x4b>
+  802b0e:	89 f0                	mov    %esi,%eax
+  802b10:	e8 2f fb ff ff       	call   802644 <stream_drain>
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	79 b2                	jns    802acb <fread+0x4b>
+  802b19:	eb 0c                	jmp    802b27 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802b1b:	c1 fb 1f             	sar    $0x1f,%ebx
+  802b1e:	83 e3 04             	and    $0x4,%ebx
+  802b21:	83 c3 04             	add    $0x4,%ebx
+  802b24:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	74 0a                	je     802b38 <fread+0xb8>
+  802b2e:	89 f8                	mov    %edi,%eax
+  802b30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b35:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802b38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b3b:	5b                   	pop    %ebx
+  802b3c:	5e                   	pop    %esi
+  802b3d:	5f                   	pop    %edi
+  802b3e:	5d                   	pop    %ebp
+  802b3f:	c3                   	ret
+		} else if (!stream_fill(f))
+  802b40:	89 f0                	mov    %esi,%eax
+  802b42:	e8 da fb ff ff       	call   802721 <stream_fill>
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	74 dc                	je     802b27 <fread+0xa7>
+			m = 0;
+  802b4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b50:	eb 93                	jmp    802ae5 <fread+0x65>
+
+00802b52 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802b52:	55                   	push   %ebp
+  802b53:	89 e5                	mov    %esp,%ebp
+  802b55:	57                   	push   %edi
+  802b56:	56                   	push   %esi
+  802b57:	53                   	push   %ebx
+  802b58:	83 ec 1c             	sub    $0x1c,%esp
+  802b5b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802b5e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b61:	a8 02                	test   $0x2,%al
+  802b63:	75 13                	jne    802b78 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802b65:	83 c8 08             	or     $0x8,%eax
+  802b68:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b73:	5b                   	pop    %ebx
+  802b74:	5e                   	pop    %esi
+  802b75:	5f                   	pop    %edi
+  802b76:	5d                   	pop    %ebp
+  802b77:	c3                   	ret
+	stream_setup(f);
+  802b78:	89 d8                	mov    %ebx,%eax
+  802b7a:	e8 35 fb ff ff       	call   8026b4 <stream_setup>
+	want = size * n;
+  802b7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b82:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802b89:	89 d8                	mov    %ebx,%eax
+  802b8b:	e8 41 fa ff ff       	call   8025d1 <stream_unread>
+	for (done = 0; done < want; ) {
+  802b90:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802b95:	84 c0                	test   %al,%al
+  802b97:	75 7b                	jne    802c14 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802b99:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802ba1:	39 fe                	cmp    %edi,%esi
+  802ba3:	73 24                	jae    802bc9 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802ba5:	83 ec 04             	sub    $0x4,%esp
+  802ba8:	89 f8                	mov    %edi,%eax
+  802baa:	29 f0                	sub    %esi,%eax
+  802bac:	50                   	push   %eax
+  802bad:	89 f0                	mov    %esi,%eax
+  802baf:	03 45 08             	add    0x8(%ebp),%eax
+  802bb2:	50                   	push   %eax
+  802bb3:	ff 33                	push   (%ebx)
+  802bb5:	e8 a0 ef ff ff       	call   801b5a <write>
+  802bba:	83 c4 10             	add    $0x10,%esp
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	7e 04                	jle    802bc5 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802bc1:	01 c6                	add    %eax,%esi
+  802bc3:	eb dc                	jmp    802ba1 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802bc5:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	74 a0                	je     802b70 <fwrite+0x1e>
+  802bd0:	89 f0                	mov    %esi,%eax
+  802bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd7:	f7 75 0c             	divl   0xc(%ebp)
+  802bda:	eb 94                	jmp    802b70 <fwrite+0x1e>
+			done += r;
+  802bdc:	01 c7                	add    %eax,%edi
+			continue;
+  802bde:	eb 34                	jmp    802c14 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802be0:	8b 73 10             	mov    0x10(%ebx),%esi
+  802be3:	29 c6                	sub    %eax,%esi
+  802be5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802be8:	29 fa                	sub    %edi,%edx
+  802bea:	39 d6                	cmp    %edx,%esi
+  802bec:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802bef:	83 ec 04             	sub    $0x4,%esp
+  802bf2:	56                   	push   %esi
+  802bf3:	89 fa                	mov    %edi,%edx
+  802bf5:	03 55 08             	add    0x8(%ebp),%edx
+  802bf8:	52                   	push   %edx
+  802bf9:	03 43 0c             	add    0xc(%ebx),%eax
+  802bfc:	50                   	push   %eax
+  802bfd:	e8 83 dd ff ff       	call   800985 <memmove>
+		f->f_wend += m;
+  802c02:	89 f0                	mov    %esi,%eax
+  802c04:	03 43 1c             	add    0x1c(%ebx),%eax
+  802c07:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802c0a:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802c0c:	83 c4 10             	add    $0x10,%esp
+  802c0f:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802c12:	74 5b                	je     802c6f <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802c14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c17:	39 c7                	cmp    %eax,%edi
+  802c19:	73 2d                	jae    802c48 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802c1b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	75 be                	jne    802be0 <fwrite+0x8e>
+  802c22:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c25:	29 fa                	sub    %edi,%edx
+  802c27:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802c2a:	72 b4                	jb     802be0 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802c2c:	83 ec 04             	sub    $0x4,%esp
+  802c2f:	52                   	push   %edx
+  802c30:	89 f8                	mov    %edi,%eax
+  802c32:	03 45 08             	add    0x8(%ebp),%eax
+  802c35:	50                   	push   %eax
+  802c36:	ff 33                	push   (%ebx)
+  802c38:	e8 1d ef ff ff       	call   801b5a <write>
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	85 c0                	test   %eax,%eax
+  802c42:	7f 98                	jg     802bdc <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802c44:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802c48:	8b 43 08             	mov    0x8(%ebx),%eax
+  802c4b:	83 f8 03             	cmp    $0x3,%eax
+  802c4e:	74 48                	je     802c98 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802c50:	83 f8 02             	cmp    $0x2,%eax
+  802c53:	74 27                	je     802c7c <fwrite+0x12a>
+	return size ? done / size : 0;
+  802c55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c58:	85 c0                	test   %eax,%eax
+  802c5a:	0f 84 10 ff ff ff    	je     802b70 <fwrite+0x1e>
+  802c60:	89 f8                	mov    %edi,%eax
+  802c62:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c67:	f7 75 0c             	divl   0xc(%ebp)
+  802c6a:	e9 01 ff ff ff       	jmp    802b70 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802c6f:	89 d8                	mov    %ebx,%eax
+  802c71:	e8 ce f9 ff ff       	call   802644 <stream_drain>
+  802c76:	85 c0                	test   %eax,%eax
+  802c78:	79 9a                	jns    802c14 <fwrite+0xc2>
+  802c7a:	eb cc                	jmp    802c48 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802c7c:	83 ec 04             	sub    $0x4,%esp
+  802c7f:	57                   	push   %edi
+  802c80:	6a 0a                	push   $0xa
+  802c82:	ff 75 08             	push   0x8(%ebp)
+  802c85:	e8 ac dd ff ff       	call   800a36 <memfind>
+  802c8a:	89 c2                	mov    %eax,%edx
+  802c8c:	89 f8                	mov    %edi,%eax
+  802c8e:	03 45 08             	add    0x8(%ebp),%eax
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	39 c2                	cmp    %eax,%edx
+  802c96:	74 bd                	je     802c55 <fwrite+0x103>
+		stream_drain(f);
+  802c98:	89 d8                	mov    %ebx,%eax
+  802c9a:	e8 a5 f9 ff ff       	call   802644 <stream_drain>
+  802c9f:	eb b4                	jmp    802c55 <fwrite+0x103>
+
+00802ca1 <fputc>:
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	53                   	push   %ebx
+  802ca5:	83 ec 14             	sub    $0x14,%esp
+  802ca8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802cab:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802cae:	ff 75 0c             	push   0xc(%ebp)
+  802cb1:	6a 01                	push   $0x1
+  802cb3:	6a 01                	push   $0x1
+  802cb5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cb8:	50                   	push   %eax
+  802cb9:	e8 94 fe ff ff       	call   802b52 <fwrite>
+  802cbe:	83 c4 10             	add    $0x10,%esp
+  802cc1:	0f b6 db             	movzbl %bl,%ebx
+  802cc4:	83 f8 01             	cmp    $0x1,%eax
+  802cc7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ccc:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802ccf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd2:	c9                   	leave
+  802cd3:	c3                   	ret
+
+00802cd4 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802cd4:	55                   	push   %ebp
+  802cd5:	89 e5                	mov    %esp,%ebp
+  802cd7:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802cda:	ff 75 0c             	push   0xc(%ebp)
+  802cdd:	ff 75 08             	push   0x8(%ebp)
+  802ce0:	e8 bc ff ff ff       	call   802ca1 <fputc>
+}
+  802ce5:	83 c4 10             	add    $0x10,%esp
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+
+00802cea <fputs>:
+{
+  802cea:	55                   	push   %ebp
+  802ceb:	89 e5                	mov    %esp,%ebp
+  802ced:	56                   	push   %esi
+  802cee:	53                   	push   %ebx
+  802cef:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802cf2:	83 ec 0c             	sub    $0xc,%esp
+  802cf5:	56                   	push   %esi
+  802cf6:	e8 c9 da ff ff       	call   8007c4 <strlen>
+  802cfb:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802cfd:	ff 75 0c             	push   0xc(%ebp)
+  802d00:	50                   	push   %eax
+  802d01:	6a 01                	push   $0x1
+  802d03:	56                   	push   %esi
+  802d04:	e8 49 fe ff ff       	call   802b52 <fwrite>
+  802d09:	83 c4 20             	add    $0x20,%esp
+  802d0c:	39 d8                	cmp    %ebx,%eax
+  802d0e:	0f 95 c0             	setne  %al
+  802d11:	0f b6 c0             	movzbl %al,%eax
+  802d14:	f7 d8                	neg    %eax
+}
+  802d16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d19:	5b                   	pop    %ebx
+  802d1a:	5e                   	pop    %esi
+  802d1b:	5d                   	pop    %ebp
+  802d1c:	c3                   	ret
+
+00802d1d <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802d1d:	55                   	push   %ebp
+  802d1e:	89 e5                	mov    %esp,%ebp
+  802d20:	53                   	push   %ebx
+  802d21:	83 ec 04             	sub    $0x4,%esp
+  802d24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802d27:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802d2a:	50                   	push   %eax
+  802d2b:	ff 75 0c             	push   0xc(%ebp)
+  802d2e:	53                   	push   %ebx
+  802d2f:	68 d4 2c 80 00       	push   $0x802cd4
+  802d34:	e8 d9 d5 ff ff       	call   800312 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802d39:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d3c:	c1 e0 1c             	shl    $0x1c,%eax
+  802d3f:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802d42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d45:	c9                   	leave
+  802d46:	c3                   	ret
+
+00802d47 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d47:	55                   	push   %ebp
+  802d48:	89 e5                	mov    %esp,%ebp
+  802d4a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802d4d:	68 a8 4d 80 00       	push   $0x804da8
+  802d52:	ff 75 0c             	push   0xc(%ebp)
+  802d55:	e8 a5 da ff ff       	call   8007ff <strcpy>
+	return 0;
+}
+  802d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5f:	c9                   	leave
+  802d60:	c3                   	ret
+
+00802d61 <devsock_close>:
+{
+  802d61:	55                   	push   %ebp
+  802d62:	89 e5                	mov    %esp,%ebp
+  802d64:	53                   	push   %ebx
+  802d65:	83 ec 10             	sub    $0x10,%esp
+  802d68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802d6b:	53                   	push   %ebx
+  802d6c:	e8 57 17 00 00       	call   8044c8 <pageref>
+  802d71:	89 c2                	mov    %eax,%edx
+  802d73:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802d76:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802d7b:	83 fa 01             	cmp    $0x1,%edx
+  802d7e:	74 05                	je     802d85 <devsock_close+0x24>
+}
+  802d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802d85:	83 ec 0c             	sub    $0xc,%esp
+  802d88:	ff 73 0c             	push   0xc(%ebx)
+  802d8b:	e8 b7 02 00 00       	call   803047 <nsipc_close>
+  802d90:	83 c4 10             	add    $0x10,%esp
+  802d93:	eb eb                	jmp    802d80 <devsock_close+0x1f>
+
+00802d95 <devsock_write>:
+{
+  802d95:	55                   	push   %ebp
+  802d96:	89 e5                	mov    %esp,%ebp
+  802d98:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802d9b:	6a 00                	push   $0x0
+  802d9d:	ff 75 10             	push   0x10(%ebp)
+  802da0:	ff 75 0c             	push   0xc(%ebp)
+  802da3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da6:	ff 70 0c             	push   0xc(%eax)
+  802da9:	e8 79 03 00 00       	call   803127 <nsipc_send>
+}
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+00802db0 <devsock_read>:
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802db6:	6a 00                	push   $0x0
+  802db8:	ff 75 10             	push   0x10(%ebp)
+  802dbb:	ff 75 0c             	push   0xc(%ebp)
+  802dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc1:	ff 70 0c             	push   0xc(%eax)
+  802dc4:	e8 ef 02 00 00       	call   8030b8 <nsipc_recv>
+}
+  802dc9:	c9                   	leave
+  802dca:	c3                   	ret
+
+00802dcb <fd2sockid>:
+{
+  802dcb:	55                   	push   %ebp
+  802dcc:	89 e5                	mov    %esp,%ebp
+  802dce:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802dd1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802dd4:	52                   	push   %edx
+  802dd5:	50                   	push   %eax
+  802dd6:	e8 f7 e9 ff ff       	call   8017d2 <fd_lookup>
+  802ddb:	83 c4 10             	add    $0x10,%esp
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 10                	js     802df2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802de2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802de5:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802deb:	39 08                	cmp    %ecx,(%eax)
+  802ded:	75 05                	jne    802df4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802def:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802df2:	c9                   	leave
+  802df3:	c3                   	ret
+		return -E_NOT_SUPP;
+  802df4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802df9:	eb f7                	jmp    802df2 <fd2sockid+0x27>
+
+00802dfb <alloc_sockfd>:
+{
+  802dfb:	55                   	push   %ebp
+  802dfc:	89 e5                	mov    %esp,%ebp
+  802dfe:	56                   	push   %esi
+  802dff:	53                   	push   %ebx
+  802e00:	83 ec 1c             	sub    $0x1c,%esp
+  802e03:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802e05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e08:	50                   	push   %eax
+  802e09:	e8 6e e9 ff ff       	call   80177c <fd_alloc>
+  802e0e:	89 c3                	mov    %eax,%ebx
+  802e10:	83 c4 10             	add    $0x10,%esp
+  802e13:	85 c0                	test   %eax,%eax
+  802e15:	78 43                	js     802e5a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802e17:	83 ec 04             	sub    $0x4,%esp
+  802e1a:	68 07 04 00 00       	push   $0x407
+  802e1f:	ff 75 f4             	push   -0xc(%ebp)
+  802e22:	6a 00                	push   $0x0
+  802e24:	e8 14 de ff ff       	call   800c3d <sys_page_alloc>
+  802e29:	89 c3                	mov    %eax,%ebx
+  802e2b:	83 c4 10             	add    $0x10,%esp
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	78 28                	js     802e5a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802e32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e35:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802e3b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802e3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e40:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802e47:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802e4a:	83 ec 0c             	sub    $0xc,%esp
+  802e4d:	50                   	push   %eax
+  802e4e:	e8 02 e9 ff ff       	call   801755 <fd2num>
+  802e53:	89 c3                	mov    %eax,%ebx
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	eb 0c                	jmp    802e66 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e5a:	83 ec 0c             	sub    $0xc,%esp
+  802e5d:	56                   	push   %esi
+  802e5e:	e8 e4 01 00 00       	call   803047 <nsipc_close>
+		return r;
+  802e63:	83 c4 10             	add    $0x10,%esp
+}
+  802e66:	89 d8                	mov    %ebx,%eax
+  802e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e6b:	5b                   	pop    %ebx
+  802e6c:	5e                   	pop    %esi
+  802e6d:	5d                   	pop    %ebp
+  802e6e:	c3                   	ret
+
+00802e6f <accept>:
+{
+  802e6f:	55                   	push   %ebp
+  802e70:	89 e5                	mov    %esp,%ebp
+  802e72:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e78:	e8 4e ff ff ff       	call   802dcb <fd2sockid>
+  802e7d:	85 c0                	test   %eax,%eax
+  802e7f:	78 1b                	js     802e9c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802e81:	83 ec 04             	sub    $0x4,%esp
+  802e84:	ff 75 10             	push   0x10(%ebp)
+  802e87:	ff 75 0c             	push   0xc(%ebp)
+  802e8a:	50                   	push   %eax
+  802e8b:	e8 0e 01 00 00       	call   802f9e <nsipc_accept>
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 05                	js     802e9c <accept+0x2d>
+	return alloc_sockfd(r);
+  802e97:	e8 5f ff ff ff       	call   802dfb <alloc_sockfd>
+}
+  802e9c:	c9                   	leave
+  802e9d:	c3                   	ret
+
+00802e9e <bind>:
+{
+  802e9e:	55                   	push   %ebp
+  802e9f:	89 e5                	mov    %esp,%ebp
+  802ea1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea7:	e8 1f ff ff ff       	call   802dcb <fd2sockid>
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	78 12                	js     802ec2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802eb0:	83 ec 04             	sub    $0x4,%esp
+  802eb3:	ff 75 10             	push   0x10(%ebp)
+  802eb6:	ff 75 0c             	push   0xc(%ebp)
+  802eb9:	50                   	push   %eax
+  802eba:	e8 31 01 00 00       	call   802ff0 <nsipc_bind>
+  802ebf:	83 c4 10             	add    $0x10,%esp
+}
+  802ec2:	c9                   	leave
+  802ec3:	c3                   	ret
+
+00802ec4 <shutdown>:
+{
+  802ec4:	55                   	push   %ebp
+  802ec5:	89 e5                	mov    %esp,%ebp
+  802ec7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ecd:	e8 f9 fe ff ff       	call   802dcb <fd2sockid>
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	78 0f                	js     802ee5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ed6:	83 ec 08             	sub    $0x8,%esp
+  802ed9:	ff 75 0c             	push   0xc(%ebp)
+  802edc:	50                   	push   %eax
+  802edd:	e8 43 01 00 00       	call   803025 <nsipc_shutdown>
+  802ee2:	83 c4 10             	add    $0x10,%esp
+}
+  802ee5:	c9                   	leave
+  802ee6:	c3                   	ret
+
+00802ee7 <connect>:
+{
+  802ee7:	55                   	push   %ebp
+  802ee8:	89 e5                	mov    %esp,%ebp
+  802eea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802eed:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef0:	e8 d6 fe ff ff       	call   802dcb <fd2sockid>
+  802ef5:	85 c0                	test   %eax,%eax
+  802ef7:	78 12                	js     802f0b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ef9:	83 ec 04             	sub    $0x4,%esp
+  802efc:	ff 75 10             	push   0x10(%ebp)
+  802eff:	ff 75 0c             	push   0xc(%ebp)
+  802f02:	50                   	push   %eax
+  802f03:	e8 59 01 00 00       	call   803061 <nsipc_connect>
+  802f08:	83 c4 10             	add    $0x10,%esp
+}
+  802f0b:	c9                   	leave
+  802f0c:	c3                   	ret
+
+00802f0d <listen>:
+{
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f16:	e8 b0 fe ff ff       	call   802dcb <fd2sockid>
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	78 0f                	js     802f2e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802f1f:	83 ec 08             	sub    $0x8,%esp
+  802f22:	ff 75 0c             	push   0xc(%ebp)
+  802f25:	50                   	push   %eax
+  802f26:	e8 6b 01 00 00       	call   803096 <nsipc_listen>
+  802f2b:	83 c4 10             	add    $0x10,%esp
+}
+  802f2e:	c9                   	leave
+  802f2f:	c3                   	ret
+
+00802f30 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802f30:	55                   	push   %ebp
+  802f31:	89 e5                	mov    %esp,%ebp
+  802f33:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802f36:	ff 75 10             	push   0x10(%ebp)
+  802f39:	ff 75 0c             	push   0xc(%ebp)
+  802f3c:	ff 75 08             	push   0x8(%ebp)
+  802f3f:	e8 41 02 00 00       	call   803185 <nsipc_socket>
+  802f44:	83 c4 10             	add    $0x10,%esp
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	78 05                	js     802f50 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802f4b:	e8 ab fe ff ff       	call   802dfb <alloc_sockfd>
+}
+  802f50:	c9                   	leave
+  802f51:	c3                   	ret
+
+00802f52 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f52:	55                   	push   %ebp
+  802f53:	89 e5                	mov    %esp,%ebp
+  802f55:	53                   	push   %ebx
+  802f56:	83 ec 04             	sub    $0x4,%esp
+  802f59:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f5b:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802f62:	74 26                	je     802f8a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802f64:	6a 07                	push   $0x7
+  802f66:	68 00 80 80 00       	push   $0x808000
+  802f6b:	53                   	push   %ebx
+  802f6c:	ff 35 08 60 80 00    	push   0x806008
+  802f72:	e8 bc 14 00 00       	call   804433 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802f77:	83 c4 0c             	add    $0xc,%esp
+  802f7a:	6a 00                	push   $0x0
+  802f7c:	6a 00                	push   $0x0
+  802f7e:	6a 00                	push   $0x0
+  802f80:	e8 b8 13 00 00       	call   80433d <ipc_recv>
+}
+  802f85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f88:	c9                   	leave
+  802f89:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f8a:	83 ec 0c             	sub    $0xc,%esp
+  802f8d:	6a 02                	push   $0x2
+  802f8f:	e8 f5 14 00 00       	call   804489 <ipc_find_env>
+  802f94:	a3 08 60 80 00       	mov    %eax,0x806008
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	eb c6                	jmp    802f64 <nsipc+0x12>
+
+00802f9e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	56                   	push   %esi
+  802fa2:	53                   	push   %ebx
+  802fa3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802fa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802fae:	8b 06                	mov    (%esi),%eax
+  802fb0:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802fb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fba:	e8 93 ff ff ff       	call   802f52 <nsipc>
+  802fbf:	89 c3                	mov    %eax,%ebx
+  802fc1:	85 c0                	test   %eax,%eax
+  802fc3:	79 09                	jns    802fce <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802fc5:	89 d8                	mov    %ebx,%eax
+  802fc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fca:	5b                   	pop    %ebx
+  802fcb:	5e                   	pop    %esi
+  802fcc:	5d                   	pop    %ebp
+  802fcd:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802fce:	83 ec 04             	sub    $0x4,%esp
+  802fd1:	ff 35 10 80 80 00    	push   0x808010
+  802fd7:	68 00 80 80 00       	push   $0x808000
+  802fdc:	ff 75 0c             	push   0xc(%ebp)
+  802fdf:	e8 a1 d9 ff ff       	call   800985 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802fe4:	a1 10 80 80 00       	mov    0x808010,%eax
+  802fe9:	89 06                	mov    %eax,(%esi)
+  802feb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802fee:	eb d5                	jmp    802fc5 <nsipc_accept+0x27>
+
+00802ff0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	53                   	push   %ebx
+  802ff4:	83 ec 08             	sub    $0x8,%esp
+  802ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ffd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803002:	53                   	push   %ebx
+  803003:	ff 75 0c             	push   0xc(%ebp)
+  803006:	68 04 80 80 00       	push   $0x808004
+  80300b:	e8 75 d9 ff ff       	call   800985 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803010:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  803016:	b8 02 00 00 00       	mov    $0x2,%eax
+  80301b:	e8 32 ff ff ff       	call   802f52 <nsipc>
+}
+  803020:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803023:	c9                   	leave
+  803024:	c3                   	ret
+
+00803025 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803025:	55                   	push   %ebp
+  803026:	89 e5                	mov    %esp,%ebp
+  803028:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80302b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80302e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803033:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803036:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80303b:	b8 03 00 00 00       	mov    $0x3,%eax
+  803040:	e8 0d ff ff ff       	call   802f52 <nsipc>
+}
+  803045:	c9                   	leave
+  803046:	c3                   	ret
+
+00803047 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803047:	55                   	push   %ebp
+  803048:	89 e5                	mov    %esp,%ebp
+  80304a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80304d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803050:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  803055:	b8 04 00 00 00       	mov    $0x4,%eax
+  80305a:	e8 f3 fe ff ff       	call   802f52 <nsipc>
+}
+  80305f:	c9                   	leave
+  803060:	c3                   	ret
+
+00803061 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803061:	55                   	push   %ebp
+  803062:	89 e5                	mov    %esp,%ebp
+  803064:	53                   	push   %ebx
+  803065:	83 ec 08             	sub    $0x8,%esp
+  803068:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80306b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803073:	53                   	push   %ebx
+  803074:	ff 75 0c             	push   0xc(%ebp)
+  803077:	68 04 80 80 00       	push   $0x808004
+  80307c:	e8 04 d9 ff ff       	call   800985 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803081:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803087:	b8 05 00 00 00       	mov    $0x5,%eax
+  80308c:	e8 c1 fe ff ff       	call   802f52 <nsipc>
+}
+  803091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803094:	c9                   	leave
+  803095:	c3                   	ret
+
+00803096 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803096:	55                   	push   %ebp
+  803097:	89 e5                	mov    %esp,%ebp
+  803099:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80309c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80309f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8030a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030a7:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8030ac:	b8 06 00 00 00       	mov    $0x6,%eax
+  8030b1:	e8 9c fe ff ff       	call   802f52 <nsipc>
+}
+  8030b6:	c9                   	leave
+  8030b7:	c3                   	ret
+
+008030b8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	56                   	push   %esi
+  8030bc:	53                   	push   %ebx
+  8030bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8030c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8030c8:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8030ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030d1:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8030d6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030db:	e8 72 fe ff ff       	call   802f52 <nsipc>
+  8030e0:	89 c3                	mov    %eax,%ebx
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	78 22                	js     803108 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8030e6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8030eb:	39 c6                	cmp    %eax,%esi
+  8030ed:	0f 4e c6             	cmovle %esi,%eax
+  8030f0:	39 c3                	cmp    %eax,%ebx
+  8030f2:	7f 1d                	jg     803111 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8030f4:	83 ec 04             	sub    $0x4,%esp
+  8030f7:	53                   	push   %ebx
+  8030f8:	68 00 80 80 00       	push   $0x808000
+  8030fd:	ff 75 0c             	push   0xc(%ebp)
+  803100:	e8 80 d8 ff ff       	call   800985 <memmove>
+  803105:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803108:	89 d8                	mov    %ebx,%eax
+  80310a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80310d:	5b                   	pop    %ebx
+  80310e:	5e                   	pop    %esi
+  80310f:	5d                   	pop    %ebp
+  803110:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803111:	68 b4 4d 80 00       	push   $0x804db4
+  803116:	68 b1 4c 80 00       	push   $0x804cb1
+  80311b:	6a 62                	push   $0x62
+  80311d:	68 c9 4d 80 00       	push   $0x804dc9
+  803122:	e8 6c 11 00 00       	call   804293 <_panic>
+
+00803127 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803127:	55                   	push   %ebp
+  803128:	89 e5                	mov    %esp,%ebp
+  80312a:	53                   	push   %ebx
+  80312b:	83 ec 04             	sub    $0x4,%esp
+  80312e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803131:	8b 45 08             	mov    0x8(%ebp),%eax
+  803134:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  803139:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80313f:	7f 2e                	jg     80316f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803141:	83 ec 04             	sub    $0x4,%esp
+  803144:	53                   	push   %ebx
+  803145:	ff 75 0c             	push   0xc(%ebp)
+  803148:	68 0c 80 80 00       	push   $0x80800c
+  80314d:	e8 33 d8 ff ff       	call   800985 <memmove>
+	nsipcbuf.send.req_size = size;
+  803152:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  803158:	8b 45 14             	mov    0x14(%ebp),%eax
+  80315b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  803160:	b8 08 00 00 00       	mov    $0x8,%eax
+  803165:	e8 e8 fd ff ff       	call   802f52 <nsipc>
+}
+  80316a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80316d:	c9                   	leave
+  80316e:	c3                   	ret
+	assert(size < 1600);
+  80316f:	68 d5 4d 80 00       	push   $0x804dd5
+  803174:	68 b1 4c 80 00       	push   $0x804cb1
+  803179:	6a 6d                	push   $0x6d
+  80317b:	68 c9 4d 80 00       	push   $0x804dc9
+  803180:	e8 0e 11 00 00       	call   804293 <_panic>
+
+00803185 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803185:	55                   	push   %ebp
+  803186:	89 e5                	mov    %esp,%ebp
+  803188:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80318b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803193:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803196:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80319b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80319e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8031a3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8031a8:	e8 a5 fd ff ff       	call   802f52 <nsipc>
+}
+  8031ad:	c9                   	leave
+  8031ae:	c3                   	ret
+
+008031af <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8031af:	55                   	push   %ebp
+  8031b0:	89 e5                	mov    %esp,%ebp
+  8031b2:	53                   	push   %ebx
+  8031b3:	83 ec 10             	sub    $0x10,%esp
+  8031b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8031b9:	68 0c 60 80 00       	push   $0x80600c
+  8031be:	e8 50 07 00 00       	call   803913 <mutex_lock>
+	if (v == 0)
+  8031c3:	83 c4 10             	add    $0x10,%esp
+  8031c6:	85 db                	test   %ebx,%ebx
+  8031c8:	0f 84 85 00 00 00    	je     803253 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8031ce:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8031d4:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8031d9:	77 51                	ja     80322c <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8031db:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8031e1:	89 d8                	mov    %ebx,%eax
+  8031e3:	c1 e8 0c             	shr    $0xc,%eax
+  8031e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031ed:	f6 c4 02             	test   $0x2,%ah
+  8031f0:	74 50                	je     803242 <free+0x93>
+		sys_page_unmap(0, c);
+  8031f2:	83 ec 08             	sub    $0x8,%esp
+  8031f5:	53                   	push   %ebx
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	e8 d9 da ff ff       	call   800cd6 <sys_page_unmap>
+		c += PGSIZE;
+  8031fd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803203:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803211:	76 ce                	jbe    8031e1 <free+0x32>
+  803213:	68 1f 4e 80 00       	push   $0x804e1f
+  803218:	68 b1 4c 80 00       	push   $0x804cb1
+  80321d:	68 82 00 00 00       	push   $0x82
+  803222:	68 12 4e 80 00       	push   $0x804e12
+  803227:	e8 67 10 00 00       	call   804293 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80322c:	68 e4 4d 80 00       	push   $0x804de4
+  803231:	68 b1 4c 80 00       	push   $0x804cb1
+  803236:	6a 7b                	push   $0x7b
+  803238:	68 12 4e 80 00       	push   $0x804e12
+  80323d:	e8 51 10 00 00       	call   804293 <_panic>
+	if (--(*ref) == 0)
+  803242:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803248:	83 e8 01             	sub    $0x1,%eax
+  80324b:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803251:	74 15                	je     803268 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803253:	83 ec 0c             	sub    $0xc,%esp
+  803256:	68 0c 60 80 00       	push   $0x80600c
+  80325b:	e8 20 07 00 00       	call   803980 <mutex_unlock>
+}
+  803260:	83 c4 10             	add    $0x10,%esp
+  803263:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803266:	c9                   	leave
+  803267:	c3                   	ret
+		sys_page_unmap(0, c);
+  803268:	83 ec 08             	sub    $0x8,%esp
+  80326b:	53                   	push   %ebx
+  80326c:	6a 00                	push   $0x0
+  80326e:	e8 63 da ff ff       	call   800cd6 <sys_page_unmap>
+  803273:	83 c4 10             	add    $0x10,%esp
+  803276:	eb db                	jmp    803253 <free+0xa4>
+
+00803278 <malloc>:
+{
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	57                   	push   %edi
+  80327c:	56                   	push   %esi
+  80327d:	53                   	push   %ebx
+  80327e:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803281:	68 0c 60 80 00       	push   $0x80600c
+  803286:	e8 88 06 00 00       	call   803913 <mutex_lock>
+	if (mptr == 0)
+  80328b:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  803291:	83 c4 10             	add    $0x10,%esp
+  803294:	85 ff                	test   %edi,%edi
+  803296:	74 6c                	je     803304 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803298:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329b:	83 c0 03             	add    $0x3,%eax
+  80329e:	83 e0 fc             	and    $0xfffffffc,%eax
+  8032a1:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8032a3:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8032a8:	0f 87 64 01 00 00    	ja     803412 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8032ae:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8032b4:	74 30                	je     8032e6 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8032b6:	89 f9                	mov    %edi,%ecx
+  8032b8:	c1 e9 0c             	shr    $0xc,%ecx
+  8032bb:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8032bf:	c1 e8 0c             	shr    $0xc,%eax
+  8032c2:	39 c1                	cmp    %eax,%ecx
+  8032c4:	74 5f                	je     803325 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	57                   	push   %edi
+  8032ca:	e8 e0 fe ff ff       	call   8031af <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8032cf:	a1 10 60 80 00       	mov    0x806010,%eax
+  8032d4:	05 00 10 00 00       	add    $0x1000,%eax
+  8032d9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8032de:	a3 10 60 80 00       	mov    %eax,0x806010
+  8032e3:	83 c4 10             	add    $0x10,%esp
+  8032e6:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  8032ec:	ba 02 00 00 00       	mov    $0x2,%edx
+  8032f1:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8032f5:	8d 7e 04             	lea    0x4(%esi),%edi
+  8032f8:	89 cb                	mov    %ecx,%ebx
+  8032fa:	01 f9                	add    %edi,%ecx
+  8032fc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8032ff:	e9 8b 00 00 00       	jmp    80338f <malloc+0x117>
+		mptr = mbegin;
+  803304:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80330b:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80330e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803311:	83 c0 03             	add    $0x3,%eax
+  803314:	83 e0 fc             	and    $0xfffffffc,%eax
+  803317:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803319:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80331e:	76 c6                	jbe    8032e6 <malloc+0x6e>
+  803320:	e9 d6 00 00 00       	jmp    8033fb <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803325:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80332b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803330:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803334:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803337:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80333c:	e9 ba 00 00 00       	jmp    8033fb <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803341:	05 00 10 00 00       	add    $0x1000,%eax
+  803346:	39 c8                	cmp    %ecx,%eax
+  803348:	0f 83 cb 00 00 00    	jae    803419 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80334e:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803353:	77 22                	ja     803377 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803355:	89 c2                	mov    %eax,%edx
+  803357:	c1 ea 16             	shr    $0x16,%edx
+  80335a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803361:	f6 c2 01             	test   $0x1,%dl
+  803364:	74 db                	je     803341 <malloc+0xc9>
+  803366:	89 c2                	mov    %eax,%edx
+  803368:	c1 ea 0c             	shr    $0xc,%edx
+  80336b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803372:	f6 c2 01             	test   $0x1,%dl
+  803375:	74 ca                	je     803341 <malloc+0xc9>
+		if (mptr == mend) {
+  803377:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80337d:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803383:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803387:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80338d:	74 04                	je     803393 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80338f:	89 d8                	mov    %ebx,%eax
+  803391:	eb b3                	jmp    803346 <malloc+0xce>
+  803393:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803396:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80339b:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80339f:	83 ea 01             	sub    $0x1,%edx
+  8033a2:	0f 85 50 ff ff ff    	jne    8032f8 <malloc+0x80>
+  8033a8:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8033af:	00 00 08 
+				return 0;	/* out of address space */
+  8033b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b7:	eb 42                	jmp    8033fb <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8033b9:	85 db                	test   %ebx,%ebx
+  8033bb:	78 1e                	js     8033db <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8033bd:	83 ec 08             	sub    $0x8,%esp
+  8033c0:	89 d8                	mov    %ebx,%eax
+  8033c2:	03 05 10 60 80 00    	add    0x806010,%eax
+  8033c8:	50                   	push   %eax
+  8033c9:	6a 00                	push   $0x0
+  8033cb:	e8 06 d9 ff ff       	call   800cd6 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8033d0:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8033d6:	83 c4 10             	add    $0x10,%esp
+  8033d9:	eb de                	jmp    8033b9 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8033db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e0:	eb 19                	jmp    8033fb <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8033e2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8033e5:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8033eb:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8033f2:	00 
+	mptr += n;
+  8033f3:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8033f6:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  8033fb:	83 ec 0c             	sub    $0xc,%esp
+  8033fe:	68 0c 60 80 00       	push   $0x80600c
+  803403:	e8 78 05 00 00       	call   803980 <mutex_unlock>
+}
+  803408:	89 f8                	mov    %edi,%eax
+  80340a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80340d:	5b                   	pop    %ebx
+  80340e:	5e                   	pop    %esi
+  80340f:	5f                   	pop    %edi
+  803410:	5d                   	pop    %ebp
+  803411:	c3                   	ret
+		return 0;
+  803412:	bf 00 00 00 00       	mov    $0x0,%edi
+  803417:	eb e2                	jmp    8033fb <malloc+0x183>
+  803419:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80341d:	74 06                	je     803425 <malloc+0x1ad>
+  80341f:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80342a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80342d:	39 fb                	cmp    %edi,%ebx
+  80342f:	73 b1                	jae    8033e2 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803431:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803437:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80343a:	39 fe                	cmp    %edi,%esi
+  80343c:	0f 92 c0             	setb   %al
+  80343f:	0f b6 c0             	movzbl %al,%eax
+  803442:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803445:	83 c8 07             	or     $0x7,%eax
+  803448:	50                   	push   %eax
+  803449:	89 d8                	mov    %ebx,%eax
+  80344b:	03 05 10 60 80 00    	add    0x806010,%eax
+  803451:	50                   	push   %eax
+  803452:	6a 00                	push   $0x0
+  803454:	e8 e4 d7 ff ff       	call   800c3d <sys_page_alloc>
+  803459:	83 c4 10             	add    $0x10,%esp
+  80345c:	85 c0                	test   %eax,%eax
+  80345e:	0f 88 55 ff ff ff    	js     8033b9 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803464:	89 f3                	mov    %esi,%ebx
+  803466:	eb c5                	jmp    80342d <malloc+0x1b5>
+
+00803468 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803468:	55                   	push   %ebp
+  803469:	89 e5                	mov    %esp,%ebp
+  80346b:	56                   	push   %esi
+  80346c:	53                   	push   %ebx
+  80346d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803470:	83 ec 0c             	sub    $0xc,%esp
+  803473:	ff 75 08             	push   0x8(%ebp)
+  803476:	e8 ea e2 ff ff       	call   801765 <fd2data>
+  80347b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80347d:	83 c4 08             	add    $0x8,%esp
+  803480:	68 37 4e 80 00       	push   $0x804e37
+  803485:	53                   	push   %ebx
+  803486:	e8 74 d3 ff ff       	call   8007ff <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80348b:	8b 46 04             	mov    0x4(%esi),%eax
+  80348e:	2b 06                	sub    (%esi),%eax
+  803490:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803496:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80349d:	00 00 00 
+	stat->st_dev = &devpipe;
+  8034a0:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8034a7:	52 80 00 
+	return 0;
+}
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034b2:	5b                   	pop    %ebx
+  8034b3:	5e                   	pop    %esi
+  8034b4:	5d                   	pop    %ebp
+  8034b5:	c3                   	ret
+
+008034b6 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8034b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034bb:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8034bf:	85 c9                	test   %ecx,%ecx
+  8034c1:	75 01                	jne    8034c4 <pipewake+0xe>
+  8034c3:	c3                   	ret
+{
+  8034c4:	55                   	push   %ebp
+  8034c5:	89 e5                	mov    %esp,%ebp
+  8034c7:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8034ca:	68 00 04 00 00       	push   $0x400
+  8034cf:	52                   	push   %edx
+  8034d0:	e8 ac da ff ff       	call   800f81 <sys_futex_wake>
+  8034d5:	83 c4 10             	add    $0x10,%esp
+}
+  8034d8:	c9                   	leave
+  8034d9:	c3                   	ret
+
+008034da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8034da:	55                   	push   %ebp
+  8034db:	89 e5                	mov    %esp,%ebp
+  8034dd:	56                   	push   %esi
+  8034de:	53                   	push   %ebx
+  8034df:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8034e2:	83 ec 0c             	sub    $0xc,%esp
+  8034e5:	56                   	push   %esi
+  8034e6:	e8 7a e2 ff ff       	call   801765 <fd2data>
+  8034eb:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8034ed:	83 c4 08             	add    $0x8,%esp
+  8034f0:	56                   	push   %esi
+  8034f1:	6a 00                	push   $0x0
+  8034f3:	e8 de d7 ff ff       	call   800cd6 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8034f8:	8d 53 04             	lea    0x4(%ebx),%edx
+  8034fb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8034fe:	e8 b3 ff ff ff       	call   8034b6 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803503:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803506:	89 da                	mov    %ebx,%edx
+  803508:	e8 a9 ff ff ff       	call   8034b6 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80350d:	89 34 24             	mov    %esi,(%esp)
+  803510:	e8 50 e2 ff ff       	call   801765 <fd2data>
+  803515:	83 c4 08             	add    $0x8,%esp
+  803518:	50                   	push   %eax
+  803519:	6a 00                	push   $0x0
+  80351b:	e8 b6 d7 ff ff       	call   800cd6 <sys_page_unmap>
+}
+  803520:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803523:	5b                   	pop    %ebx
+  803524:	5e                   	pop    %esi
+  803525:	5d                   	pop    %ebp
+  803526:	c3                   	ret
+
+00803527 <_pipeisclosed>:
+{
+  803527:	55                   	push   %ebp
+  803528:	89 e5                	mov    %esp,%ebp
+  80352a:	57                   	push   %edi
+  80352b:	56                   	push   %esi
+  80352c:	53                   	push   %ebx
+  80352d:	83 ec 1c             	sub    $0x1c,%esp
+  803530:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803533:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803535:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80353a:	eb 5d                	jmp    803599 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80353c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  803542:	8b 02                	mov    (%edx),%eax
+  803544:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803547:	83 ec 0c             	sub    $0xc,%esp
+  80354a:	ff 75 e0             	push   -0x20(%ebp)
+  80354d:	e8 76 0f 00 00       	call   8044c8 <pageref>
+  803552:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803555:	89 3c 24             	mov    %edi,(%esp)
+  803558:	e8 6b 0f 00 00       	call   8044c8 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80355d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80355f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803565:	83 c4 10             	add    $0x10,%esp
+  803568:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80356e:	77 15                	ja     803585 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803570:	89 f2                	mov    %esi,%edx
+  803572:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803574:	c1 ea 10             	shr    $0x10,%edx
+  803577:	74 0c                	je     803585 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803579:	c1 e2 10             	shl    $0x10,%edx
+  80357c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803581:	29 d1                	sub    %edx,%ecx
+  803583:	eb 06                	jmp    80358b <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803585:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  80358b:	8b 11                	mov    (%ecx),%edx
+  80358d:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803590:	39 d3                	cmp    %edx,%ebx
+  803592:	74 6e                	je     803602 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803594:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803597:	74 24                	je     8035bd <_pipeisclosed+0x96>
+  803599:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80359b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8035a1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8035a6:	77 94                	ja     80353c <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035a8:	89 f0                	mov    %esi,%eax
+  8035aa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8035ac:	c1 e8 10             	shr    $0x10,%eax
+  8035af:	74 8b                	je     80353c <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8035b1:	c1 e0 10             	shl    $0x10,%eax
+  8035b4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8035b9:	29 c2                	sub    %eax,%edx
+  8035bb:	eb 85                	jmp    803542 <_pipeisclosed+0x1b>
+  8035bd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8035bf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8035c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8035ca:	77 18                	ja     8035e4 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8035d1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8035d3:	c1 e8 10             	shr    $0x10,%eax
+  8035d6:	74 0c                	je     8035e4 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8035d8:	c1 e0 10             	shl    $0x10,%eax
+  8035db:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8035e0:	29 c2                	sub    %eax,%edx
+  8035e2:	eb 06                	jmp    8035ea <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8035e4:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8035ea:	8b 02                	mov    (%edx),%eax
+  8035ec:	8b 40 58             	mov    0x58(%eax),%eax
+  8035ef:	6a 01                	push   $0x1
+  8035f1:	50                   	push   %eax
+  8035f2:	53                   	push   %ebx
+  8035f3:	68 3e 4e 80 00       	push   $0x804e3e
+  8035f8:	e8 1e cc ff ff       	call   80021b <cprintf>
+  8035fd:	83 c4 10             	add    $0x10,%esp
+  803600:	eb 97                	jmp    803599 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803602:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803605:	0f 94 c0             	sete   %al
+  803608:	0f b6 c0             	movzbl %al,%eax
+}
+  80360b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80360e:	5b                   	pop    %ebx
+  80360f:	5e                   	pop    %esi
+  803610:	5f                   	pop    %edi
+  803611:	5d                   	pop    %ebp
+  803612:	c3                   	ret
+
+00803613 <devpipe_write>:
+{
+  803613:	55                   	push   %ebp
+  803614:	89 e5                	mov    %esp,%ebp
+  803616:	57                   	push   %edi
+  803617:	56                   	push   %esi
+  803618:	53                   	push   %ebx
+  803619:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80361c:	ff 75 08             	push   0x8(%ebp)
+  80361f:	e8 41 e1 ff ff       	call   801765 <fd2data>
+  803624:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803626:	83 c4 10             	add    $0x10,%esp
+  803629:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803630:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803633:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803636:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803639:	0f 84 96 00 00 00    	je     8036d5 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80363f:	8d 73 08             	lea    0x8(%ebx),%esi
+  803642:	eb 32                	jmp    803676 <devpipe_write+0x63>
+  803644:	89 fa                	mov    %edi,%edx
+  803646:	89 f0                	mov    %esi,%eax
+  803648:	e8 69 fe ff ff       	call   8034b6 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80364d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803650:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803653:	ba 01 00 00 00       	mov    $0x1,%edx
+  803658:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80365d:	83 ec 04             	sub    $0x4,%esp
+  803660:	6a 0a                	push   $0xa
+  803662:	50                   	push   %eax
+  803663:	53                   	push   %ebx
+  803664:	e8 e9 d8 ff ff       	call   800f52 <sys_futex_wait>
+  803669:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80366e:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803673:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803676:	8b 43 04             	mov    0x4(%ebx),%eax
+  803679:	8b 0b                	mov    (%ebx),%ecx
+  80367b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80367e:	39 d0                	cmp    %edx,%eax
+  803680:	72 1b                	jb     80369d <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803682:	89 da                	mov    %ebx,%edx
+  803684:	8b 45 08             	mov    0x8(%ebp),%eax
+  803687:	e8 9b fe ff ff       	call   803527 <_pipeisclosed>
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	74 b4                	je     803644 <devpipe_write+0x31>
+				return 0;
+  803690:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803698:	5b                   	pop    %ebx
+  803699:	5e                   	pop    %esi
+  80369a:	5f                   	pop    %edi
+  80369b:	5d                   	pop    %ebp
+  80369c:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80369d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8036a3:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8036a7:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8036aa:	89 c2                	mov    %eax,%edx
+  8036ac:	c1 fa 1f             	sar    $0x1f,%edx
+  8036af:	89 d1                	mov    %edx,%ecx
+  8036b1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8036b4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8036b7:	83 e2 1f             	and    $0x1f,%edx
+  8036ba:	29 ca                	sub    %ecx,%edx
+  8036bc:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8036c0:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8036c4:	83 c0 01             	add    $0x1,%eax
+  8036c7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8036ca:	83 c6 01             	add    $0x1,%esi
+  8036cd:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8036d0:	e9 5e ff ff ff       	jmp    803633 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8036d5:	8d 53 04             	lea    0x4(%ebx),%edx
+  8036d8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8036db:	e8 d6 fd ff ff       	call   8034b6 <pipewake>
+	return i;
+  8036e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e3:	eb b0                	jmp    803695 <devpipe_write+0x82>
+
+008036e5 <devpipe_read>:
+{
+  8036e5:	55                   	push   %ebp
+  8036e6:	89 e5                	mov    %esp,%ebp
+  8036e8:	57                   	push   %edi
+  8036e9:	56                   	push   %esi
+  8036ea:	53                   	push   %ebx
+  8036eb:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8036ee:	ff 75 08             	push   0x8(%ebp)
+  8036f1:	e8 6f e0 ff ff       	call   801765 <fd2data>
+  8036f6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803700:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803703:	74 6c                	je     803771 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803705:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803708:	eb 25                	jmp    80372f <devpipe_read+0x4a>
+  80370a:	8b 13                	mov    (%ebx),%edx
+  80370c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803711:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803716:	83 ec 04             	sub    $0x4,%esp
+  803719:	6a 0a                	push   $0xa
+  80371b:	52                   	push   %edx
+  80371c:	57                   	push   %edi
+  80371d:	e8 30 d8 ff ff       	call   800f52 <sys_futex_wait>
+  803722:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803727:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80372c:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80372f:	8b 03                	mov    (%ebx),%eax
+  803731:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803734:	75 19                	jne    80374f <devpipe_read+0x6a>
+			if (i > 0)
+  803736:	85 f6                	test   %esi,%esi
+  803738:	75 3a                	jne    803774 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80373a:	89 da                	mov    %ebx,%edx
+  80373c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80373f:	e8 e3 fd ff ff       	call   803527 <_pipeisclosed>
+  803744:	85 c0                	test   %eax,%eax
+  803746:	74 c2                	je     80370a <devpipe_read+0x25>
+				return 0;
+  803748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374d:	eb 31                	jmp    803780 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80374f:	89 c1                	mov    %eax,%ecx
+  803751:	c1 f9 1f             	sar    $0x1f,%ecx
+  803754:	c1 e9 1b             	shr    $0x1b,%ecx
+  803757:	01 c8                	add    %ecx,%eax
+  803759:	83 e0 1f             	and    $0x1f,%eax
+  80375c:	29 c8                	sub    %ecx,%eax
+  80375e:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803763:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803766:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803769:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80376c:	83 c6 01             	add    $0x1,%esi
+  80376f:	eb 8f                	jmp    803700 <devpipe_read+0x1b>
+out:
+  803771:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803774:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803777:	89 da                	mov    %ebx,%edx
+  803779:	e8 38 fd ff ff       	call   8034b6 <pipewake>
+	return i;
+  80377e:	89 f0                	mov    %esi,%eax
+}
+  803780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803783:	5b                   	pop    %ebx
+  803784:	5e                   	pop    %esi
+  803785:	5f                   	pop    %edi
+  803786:	5d                   	pop    %ebp
+  803787:	c3                   	ret
+
+00803788 <pipe>:
+{
+  803788:	55                   	push   %ebp
+  803789:	89 e5                	mov    %esp,%ebp
+  80378b:	56                   	push   %esi
+  80378c:	53                   	push   %ebx
+  80378d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803793:	50                   	push   %eax
+  803794:	e8 e3 df ff ff       	call   80177c <fd_alloc>
+  803799:	89 c3                	mov    %eax,%ebx
+  80379b:	83 c4 10             	add    $0x10,%esp
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	0f 88 23 01 00 00    	js     8038c9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037a6:	83 ec 04             	sub    $0x4,%esp
+  8037a9:	68 07 04 00 00       	push   $0x407
+  8037ae:	ff 75 f4             	push   -0xc(%ebp)
+  8037b1:	6a 00                	push   $0x0
+  8037b3:	e8 85 d4 ff ff       	call   800c3d <sys_page_alloc>
+  8037b8:	89 c3                	mov    %eax,%ebx
+  8037ba:	83 c4 10             	add    $0x10,%esp
+  8037bd:	85 c0                	test   %eax,%eax
+  8037bf:	0f 88 04 01 00 00    	js     8038c9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8037c5:	83 ec 0c             	sub    $0xc,%esp
+  8037c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8037cb:	50                   	push   %eax
+  8037cc:	e8 ab df ff ff       	call   80177c <fd_alloc>
+  8037d1:	89 c3                	mov    %eax,%ebx
+  8037d3:	83 c4 10             	add    $0x10,%esp
+  8037d6:	85 c0                	test   %eax,%eax
+  8037d8:	0f 88 db 00 00 00    	js     8038b9 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037de:	83 ec 04             	sub    $0x4,%esp
+  8037e1:	68 07 04 00 00       	push   $0x407
+  8037e6:	ff 75 f0             	push   -0x10(%ebp)
+  8037e9:	6a 00                	push   $0x0
+  8037eb:	e8 4d d4 ff ff       	call   800c3d <sys_page_alloc>
+  8037f0:	89 c3                	mov    %eax,%ebx
+  8037f2:	83 c4 10             	add    $0x10,%esp
+  8037f5:	85 c0                	test   %eax,%eax
+  8037f7:	0f 88 bc 00 00 00    	js     8038b9 <pipe+0x131>
+	va = fd2data(fd0);
+  8037fd:	83 ec 0c             	sub    $0xc,%esp
+  803800:	ff 75 f4             	push   -0xc(%ebp)
+  803803:	e8 5d df ff ff       	call   801765 <fd2data>
+  803808:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80380a:	83 c4 0c             	add    $0xc,%esp
+  80380d:	68 07 04 00 00       	push   $0x407
+  803812:	50                   	push   %eax
+  803813:	6a 00                	push   $0x0
+  803815:	e8 23 d4 ff ff       	call   800c3d <sys_page_alloc>
+  80381a:	89 c3                	mov    %eax,%ebx
+  80381c:	83 c4 10             	add    $0x10,%esp
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	0f 88 82 00 00 00    	js     8038a9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803827:	83 ec 0c             	sub    $0xc,%esp
+  80382a:	ff 75 f0             	push   -0x10(%ebp)
+  80382d:	e8 33 df ff ff       	call   801765 <fd2data>
+  803832:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803839:	50                   	push   %eax
+  80383a:	6a 00                	push   $0x0
+  80383c:	56                   	push   %esi
+  80383d:	6a 00                	push   $0x0
+  80383f:	e8 46 d4 ff ff       	call   800c8a <sys_page_map>
+  803844:	89 c3                	mov    %eax,%ebx
+  803846:	83 c4 20             	add    $0x20,%esp
+  803849:	85 c0                	test   %eax,%eax
+  80384b:	78 4e                	js     80389b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80384d:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803852:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803855:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803857:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80385a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803861:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803864:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803866:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803869:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803870:	83 ec 0c             	sub    $0xc,%esp
+  803873:	ff 75 f4             	push   -0xc(%ebp)
+  803876:	e8 da de ff ff       	call   801755 <fd2num>
+  80387b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80387e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803880:	83 c4 04             	add    $0x4,%esp
+  803883:	ff 75 f0             	push   -0x10(%ebp)
+  803886:	e8 ca de ff ff       	call   801755 <fd2num>
+  80388b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80388e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803891:	83 c4 10             	add    $0x10,%esp
+  803894:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803899:	eb 2e                	jmp    8038c9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80389b:	83 ec 08             	sub    $0x8,%esp
+  80389e:	56                   	push   %esi
+  80389f:	6a 00                	push   $0x0
+  8038a1:	e8 30 d4 ff ff       	call   800cd6 <sys_page_unmap>
+  8038a6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8038a9:	83 ec 08             	sub    $0x8,%esp
+  8038ac:	ff 75 f0             	push   -0x10(%ebp)
+  8038af:	6a 00                	push   $0x0
+  8038b1:	e8 20 d4 ff ff       	call   800cd6 <sys_page_unmap>
+  8038b6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8038b9:	83 ec 08             	sub    $0x8,%esp
+  8038bc:	ff 75 f4             	push   -0xc(%ebp)
+  8038bf:	6a 00                	push   $0x0
+  8038c1:	e8 10 d4 ff ff       	call   800cd6 <sys_page_unmap>
+  8038c6:	83 c4 10             	add    $0x10,%esp
+}
+  8038c9:	89 d8                	mov    %ebx,%eax
+  8038cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038ce:	5b                   	pop    %ebx
+  8038cf:	5e                   	pop    %esi
+  8038d0:	5d                   	pop    %ebp
+  8038d1:	c3                   	ret
+
+008038d2 <pipeisclosed>:
+{
+  8038d2:	55                   	push   %ebp
+  8038d3:	89 e5                	mov    %esp,%ebp
+  8038d5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038db:	50                   	push   %eax
+  8038dc:	ff 75 08             	push   0x8(%ebp)
+  8038df:	e8 ee de ff ff       	call   8017d2 <fd_lookup>
+  8038e4:	83 c4 10             	add    $0x10,%esp
+  8038e7:	85 c0                	test   %eax,%eax
+  8038e9:	78 18                	js     803903 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8038eb:	83 ec 0c             	sub    $0xc,%esp
+  8038ee:	ff 75 f4             	push   -0xc(%ebp)
+  8038f1:	e8 6f de ff ff       	call   801765 <fd2data>
+  8038f6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8038f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038fb:	e8 27 fc ff ff       	call   803527 <_pipeisclosed>
+  803900:	83 c4 10             	add    $0x10,%esp
+}
+  803903:	c9                   	leave
+  803904:	c3                   	ret
+
+00803905 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803905:	55                   	push   %ebp
+  803906:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80390b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803911:	5d                   	pop    %ebp
+  803912:	c3                   	ret
+
+00803913 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803913:	55                   	push   %ebp
+  803914:	89 e5                	mov    %esp,%ebp
+  803916:	56                   	push   %esi
+  803917:	53                   	push   %ebx
+  803918:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80391b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803920:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803925:	89 d0                	mov    %edx,%eax
+  803927:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80392b:	85 c0                	test   %eax,%eax
+  80392d:	74 2d                	je     80395c <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80392f:	83 f8 02             	cmp    $0x2,%eax
+  803932:	74 08                	je     80393c <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803934:	b8 02 00 00 00       	mov    $0x2,%eax
+  803939:	f0 87 03             	lock xchg %eax,(%ebx)
+  80393c:	be 02 00 00 00       	mov    $0x2,%esi
+  803941:	eb 15                	jmp    803958 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803943:	83 ec 04             	sub    $0x4,%esp
+  803946:	6a 00                	push   $0x0
+  803948:	6a 02                	push   $0x2
+  80394a:	53                   	push   %ebx
+  80394b:	e8 02 d6 ff ff       	call   800f52 <sys_futex_wait>
+  803950:	89 f0                	mov    %esi,%eax
+  803952:	f0 87 03             	lock xchg %eax,(%ebx)
+  803955:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803958:	85 c0                	test   %eax,%eax
+  80395a:	75 e7                	jne    803943 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80395c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80395f:	5b                   	pop    %ebx
+  803960:	5e                   	pop    %esi
+  803961:	5d                   	pop    %ebp
+  803962:	c3                   	ret
+
+00803963 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803963:	55                   	push   %ebp
+  803964:	89 e5                	mov    %esp,%ebp
+  803966:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803973:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803977:	f7 d8                	neg    %eax
+  803979:	19 c0                	sbb    %eax,%eax
+  80397b:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  80397e:	5d                   	pop    %ebp
+  80397f:	c3                   	ret
+
+00803980 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803980:	55                   	push   %ebp
+  803981:	89 e5                	mov    %esp,%ebp
+  803983:	83 ec 08             	sub    $0x8,%esp
+  803986:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398e:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803991:	83 f8 02             	cmp    $0x2,%eax
+  803994:	74 02                	je     803998 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803996:	c9                   	leave
+  803997:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803998:	83 ec 08             	sub    $0x8,%esp
+  80399b:	6a 01                	push   $0x1
+  80399d:	52                   	push   %edx
+  80399e:	e8 de d5 ff ff       	call   800f81 <sys_futex_wake>
+  8039a3:	83 c4 10             	add    $0x10,%esp
+}
+  8039a6:	eb ee                	jmp    803996 <mutex_unlock+0x16>
+
+008039a8 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8039a8:	55                   	push   %ebp
+  8039a9:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8039ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ae:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8039b4:	5d                   	pop    %ebp
+  8039b5:	c3                   	ret
+
+008039b6 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8039b6:	55                   	push   %ebp
+  8039b7:	89 e5                	mov    %esp,%ebp
+  8039b9:	57                   	push   %edi
+  8039ba:	56                   	push   %esi
+  8039bb:	53                   	push   %ebx
+  8039bc:	83 ec 18             	sub    $0x18,%esp
+  8039bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8039c5:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8039c7:	53                   	push   %ebx
+  8039c8:	e8 b3 ff ff ff       	call   803980 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8039cd:	83 c4 0c             	add    $0xc,%esp
+  8039d0:	ff 75 10             	push   0x10(%ebp)
+  8039d3:	57                   	push   %edi
+  8039d4:	56                   	push   %esi
+  8039d5:	e8 78 d5 ff ff       	call   800f52 <sys_futex_wait>
+  8039da:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8039dc:	83 c4 10             	add    $0x10,%esp
+  8039df:	be 02 00 00 00       	mov    $0x2,%esi
+  8039e4:	eb 10                	jmp    8039f6 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8039e6:	83 ec 04             	sub    $0x4,%esp
+  8039e9:	6a 00                	push   $0x0
+  8039eb:	6a 02                	push   $0x2
+  8039ed:	53                   	push   %ebx
+  8039ee:	e8 5f d5 ff ff       	call   800f52 <sys_futex_wait>
+  8039f3:	83 c4 10             	add    $0x10,%esp
+  8039f6:	89 f0                	mov    %esi,%eax
+  8039f8:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8039fb:	85 c0                	test   %eax,%eax
+  8039fd:	75 e7                	jne    8039e6 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8039ff:	83 ff ec             	cmp    $0xffffffec,%edi
+  803a02:	74 05                	je     803a09 <cond_timedwait+0x53>
+  803a04:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803a09:	89 f8                	mov    %edi,%eax
+  803a0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0e:	5b                   	pop    %ebx
+  803a0f:	5e                   	pop    %esi
+  803a10:	5f                   	pop    %edi
+  803a11:	5d                   	pop    %ebp
+  803a12:	c3                   	ret
+
+00803a13 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803a13:	55                   	push   %ebp
+  803a14:	89 e5                	mov    %esp,%ebp
+  803a16:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803a19:	6a 00                	push   $0x0
+  803a1b:	ff 75 0c             	push   0xc(%ebp)
+  803a1e:	ff 75 08             	push   0x8(%ebp)
+  803a21:	e8 90 ff ff ff       	call   8039b6 <cond_timedwait>
+}
+  803a26:	83 c4 10             	add    $0x10,%esp
+  803a29:	c9                   	leave
+  803a2a:	c3                   	ret
+
+00803a2b <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803a2b:	55                   	push   %ebp
+  803a2c:	89 e5                	mov    %esp,%ebp
+  803a2e:	83 ec 10             	sub    $0x10,%esp
+  803a31:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803a34:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a39:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803a3d:	6a 01                	push   $0x1
+  803a3f:	50                   	push   %eax
+  803a40:	e8 3c d5 ff ff       	call   800f81 <sys_futex_wake>
+}
+  803a45:	83 c4 10             	add    $0x10,%esp
+  803a48:	c9                   	leave
+  803a49:	c3                   	ret
+
+00803a4a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803a4a:	55                   	push   %ebp
+  803a4b:	89 e5                	mov    %esp,%ebp
+  803a4d:	83 ec 10             	sub    $0x10,%esp
+  803a50:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a53:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a58:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803a5c:	68 00 04 00 00       	push   $0x400
+  803a61:	50                   	push   %eax
+  803a62:	e8 1a d5 ff ff       	call   800f81 <sys_futex_wake>
+}
+  803a67:	83 c4 10             	add    $0x10,%esp
+  803a6a:	c9                   	leave
+  803a6b:	c3                   	ret
+
+00803a6c <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803a6c:	55                   	push   %ebp
+  803a6d:	89 e5                	mov    %esp,%ebp
+  803a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803a72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a75:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803a77:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803a7e:	5d                   	pop    %ebp
+  803a7f:	c3                   	ret
+
+00803a80 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803a80:	55                   	push   %ebp
+  803a81:	89 e5                	mov    %esp,%ebp
+  803a83:	53                   	push   %ebx
+  803a84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803a87:	8b 11                	mov    (%ecx),%edx
+  803a89:	85 d2                	test   %edx,%edx
+  803a8b:	74 14                	je     803aa1 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803a8d:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a90:	89 d0                	mov    %edx,%eax
+  803a92:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803a96:	39 c2                	cmp    %eax,%edx
+  803a98:	75 ed                	jne    803a87 <sem_trywait+0x7>
+			return 0;
+  803a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9f:	eb 05                	jmp    803aa6 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803aa1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803aa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803aa9:	c9                   	leave
+  803aaa:	c3                   	ret
+
+00803aab <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803aab:	55                   	push   %ebp
+  803aac:	89 e5                	mov    %esp,%ebp
+  803aae:	57                   	push   %edi
+  803aaf:	56                   	push   %esi
+  803ab0:	53                   	push   %ebx
+  803ab1:	83 ec 1c             	sub    $0x1c,%esp
+  803ab4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ab7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803aba:	e8 0b d4 ff ff       	call   800eca <sys_time_msec>
+  803abf:	01 f8                	add    %edi,%eax
+  803ac1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803ac4:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803ac9:	eb 28                	jmp    803af3 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803acb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ad0:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803ad5:	83 ec 04             	sub    $0x4,%esp
+  803ad8:	56                   	push   %esi
+  803ad9:	6a 00                	push   $0x0
+  803adb:	53                   	push   %ebx
+  803adc:	e8 71 d4 ff ff       	call   800f52 <sys_futex_wait>
+  803ae1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803ae6:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803aeb:	83 c4 10             	add    $0x10,%esp
+  803aee:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803af1:	74 2e                	je     803b21 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803af3:	83 ec 0c             	sub    $0xc,%esp
+  803af6:	53                   	push   %ebx
+  803af7:	e8 84 ff ff ff       	call   803a80 <sem_trywait>
+  803afc:	83 c4 10             	add    $0x10,%esp
+  803aff:	85 c0                	test   %eax,%eax
+  803b01:	79 19                	jns    803b1c <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803b03:	85 ff                	test   %edi,%edi
+  803b05:	74 c4                	je     803acb <sem_timedwait+0x20>
+  803b07:	e8 be d3 ff ff       	call   800eca <sys_time_msec>
+  803b0c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803b0f:	29 c6                	sub    %eax,%esi
+  803b11:	85 f6                	test   %esi,%esi
+  803b13:	7f b6                	jg     803acb <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803b15:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803b1a:	eb 05                	jmp    803b21 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b24:	5b                   	pop    %ebx
+  803b25:	5e                   	pop    %esi
+  803b26:	5f                   	pop    %edi
+  803b27:	5d                   	pop    %ebp
+  803b28:	c3                   	ret
+
+00803b29 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803b29:	55                   	push   %ebp
+  803b2a:	89 e5                	mov    %esp,%ebp
+  803b2c:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803b2f:	6a 00                	push   $0x0
+  803b31:	ff 75 08             	push   0x8(%ebp)
+  803b34:	e8 72 ff ff ff       	call   803aab <sem_timedwait>
+}
+  803b39:	83 c4 10             	add    $0x10,%esp
+  803b3c:	c9                   	leave
+  803b3d:	c3                   	ret
+
+00803b3e <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803b3e:	55                   	push   %ebp
+  803b3f:	89 e5                	mov    %esp,%ebp
+  803b41:	83 ec 08             	sub    $0x8,%esp
+  803b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b47:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b4c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803b50:	8b 50 04             	mov    0x4(%eax),%edx
+  803b53:	85 d2                	test   %edx,%edx
+  803b55:	75 02                	jne    803b59 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803b57:	c9                   	leave
+  803b58:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803b59:	83 ec 08             	sub    $0x8,%esp
+  803b5c:	6a 01                	push   $0x1
+  803b5e:	50                   	push   %eax
+  803b5f:	e8 1d d4 ff ff       	call   800f81 <sys_futex_wake>
+  803b64:	83 c4 10             	add    $0x10,%esp
+}
+  803b67:	eb ee                	jmp    803b57 <sem_post+0x19>
+
+00803b69 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803b69:	55                   	push   %ebp
+  803b6a:	89 e5                	mov    %esp,%ebp
+  803b6c:	57                   	push   %edi
+  803b6d:	56                   	push   %esi
+  803b6e:	53                   	push   %ebx
+  803b6f:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803b72:	68 20 60 80 00       	push   $0x806020
+  803b77:	e8 97 fd ff ff       	call   803913 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803b7c:	a1 44 60 80 00       	mov    0x806044,%eax
+  803b81:	83 c4 10             	add    $0x10,%esp
+  803b84:	85 c0                	test   %eax,%eax
+  803b86:	75 19                	jne    803ba1 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803b88:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803b8d:	8b 00                	mov    (%eax),%eax
+  803b8f:	8b 40 48             	mov    0x48(%eax),%eax
+  803b92:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803b97:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803b9e:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803ba1:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803ba6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ba9:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803bb0:	8b 40 04             	mov    0x4(%eax),%eax
+  803bb3:	85 c0                	test   %eax,%eax
+  803bb5:	0f 84 e4 00 00 00    	je     803c9f <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803bbb:	83 c3 01             	add    $0x1,%ebx
+  803bbe:	83 fb 20             	cmp    $0x20,%ebx
+  803bc1:	75 e3                	jne    803ba6 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803bc3:	83 ec 0c             	sub    $0xc,%esp
+  803bc6:	68 20 60 80 00       	push   $0x806020
+  803bcb:	e8 b0 fd ff ff       	call   803980 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803bd0:	83 c4 10             	add    $0x10,%esp
+  803bd3:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803bd8:	e9 b8 00 00 00       	jmp    803c95 <pthread_create+0x12c>
+  803bdd:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803be0:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803be3:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803be5:	39 f3                	cmp    %esi,%ebx
+  803be7:	73 16                	jae    803bff <pthread_create+0x96>
+		va -= PGSIZE;
+  803be9:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803bef:	83 ec 08             	sub    $0x8,%esp
+  803bf2:	56                   	push   %esi
+  803bf3:	6a 00                	push   $0x0
+  803bf5:	e8 dc d0 ff ff       	call   800cd6 <sys_page_unmap>
+  803bfa:	83 c4 10             	add    $0x10,%esp
+  803bfd:	eb e6                	jmp    803be5 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803bff:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c02:	83 ec 08             	sub    $0x8,%esp
+  803c05:	ff 75 e4             	push   -0x1c(%ebp)
+  803c08:	6a 00                	push   $0x0
+  803c0a:	e8 c7 d0 ff ff       	call   800cd6 <sys_page_unmap>
+	return r;
+  803c0f:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803c12:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c15:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803c1c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803c23:	eb 70                	jmp    803c95 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803c25:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c28:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803c2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c32:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803c35:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c38:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803c3b:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803c42:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803c47:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803c4a:	29 c8                	sub    %ecx,%eax
+  803c4c:	85 db                	test   %ebx,%ebx
+  803c4e:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803c55:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803c58:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c5f:	83 ec 04             	sub    $0x4,%esp
+  803c62:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803c67:	29 ca                	sub    %ecx,%edx
+  803c69:	52                   	push   %edx
+	*--esp = 0;
+  803c6a:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c6d:	50                   	push   %eax
+  803c6e:	68 c6 3e 80 00       	push   $0x803ec6
+  803c73:	e8 ae d3 ff ff       	call   801026 <sys_thread_create>
+  803c78:	89 c7                	mov    %eax,%edi
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	78 91                	js     803c12 <pthread_create+0xa9>
+	th->th_env = id;
+  803c81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c84:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c8e:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803c90:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c95:	89 f8                	mov    %edi,%eax
+  803c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c9a:	5b                   	pop    %ebx
+  803c9b:	5e                   	pop    %esi
+  803c9c:	5f                   	pop    %edi
+  803c9d:	5d                   	pop    %ebp
+  803c9e:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803c9f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ca2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803ca9:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803cb0:	83 ec 0c             	sub    $0xc,%esp
+  803cb3:	68 20 60 80 00       	push   $0x806020
+  803cb8:	e8 c3 fc ff ff       	call   803980 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803cbd:	89 d9                	mov    %ebx,%ecx
+  803cbf:	c1 e1 10             	shl    $0x10,%ecx
+  803cc2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803cc5:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803cca:	29 c8                	sub    %ecx,%eax
+  803ccc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803ccf:	c1 e8 16             	shr    $0x16,%eax
+  803cd2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cd9:	83 c4 10             	add    $0x10,%esp
+  803cdc:	a8 01                	test   $0x1,%al
+  803cde:	74 15                	je     803cf5 <pthread_create+0x18c>
+  803ce0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ce3:	c1 e8 0c             	shr    $0xc,%eax
+  803ce6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ced:	a8 01                	test   $0x1,%al
+  803cef:	0f 85 30 ff ff ff    	jne    803c25 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803cf5:	83 ec 04             	sub    $0x4,%esp
+  803cf8:	6a 07                	push   $0x7
+  803cfa:	ff 75 e4             	push   -0x1c(%ebp)
+  803cfd:	6a 00                	push   $0x0
+  803cff:	e8 39 cf ff ff       	call   800c3d <sys_page_alloc>
+  803d04:	89 c7                	mov    %eax,%edi
+  803d06:	83 c4 10             	add    $0x10,%esp
+  803d09:	85 c0                	test   %eax,%eax
+  803d0b:	0f 88 01 ff ff ff    	js     803c12 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803d11:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803d16:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803d19:	29 d0                	sub    %edx,%eax
+  803d1b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803d1e:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803d20:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803d25:	29 d0                	sub    %edx,%eax
+  803d27:	89 c7                	mov    %eax,%edi
+  803d29:	39 fe                	cmp    %edi,%esi
+  803d2b:	0f 83 f4 fe ff ff    	jae    803c25 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803d31:	83 ec 04             	sub    $0x4,%esp
+  803d34:	6a 07                	push   $0x7
+  803d36:	56                   	push   %esi
+  803d37:	6a 00                	push   $0x0
+  803d39:	e8 ff ce ff ff       	call   800c3d <sys_page_alloc>
+  803d3e:	83 c4 10             	add    $0x10,%esp
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	0f 88 94 fe ff ff    	js     803bdd <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803d49:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803d4f:	eb d8                	jmp    803d29 <pthread_create+0x1c0>
+
+00803d51 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803d51:	55                   	push   %ebp
+  803d52:	89 e5                	mov    %esp,%ebp
+  803d54:	57                   	push   %edi
+  803d55:	56                   	push   %esi
+  803d56:	53                   	push   %ebx
+  803d57:	83 ec 0c             	sub    $0xc,%esp
+  803d5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803d5d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803d60:	83 f8 1e             	cmp    $0x1e,%eax
+  803d63:	0f 87 c7 00 00 00    	ja     803e30 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803d69:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d6b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803d71:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d76:	77 12                	ja     803d8a <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d78:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d7d:	29 d0                	sub    %edx,%eax
+  803d7f:	c1 e8 10             	shr    $0x10,%eax
+  803d82:	39 c3                	cmp    %eax,%ebx
+  803d84:	0f 84 ad 00 00 00    	je     803e37 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d8a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d8d:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803d94:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803d9b:	eb 10                	jmp    803dad <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d9d:	83 ec 04             	sub    $0x4,%esp
+  803da0:	6a 00                	push   $0x0
+  803da2:	6a 01                	push   $0x1
+  803da4:	57                   	push   %edi
+  803da5:	e8 a8 d1 ff ff       	call   800f52 <sys_futex_wait>
+  803daa:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803dad:	8b 46 04             	mov    0x4(%esi),%eax
+  803db0:	83 f8 01             	cmp    $0x1,%eax
+  803db3:	74 e8                	je     803d9d <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803db5:	83 f8 02             	cmp    $0x2,%eax
+  803db8:	0f 85 80 00 00 00    	jne    803e3e <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803dbe:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803dc1:	c1 e6 02             	shl    $0x2,%esi
+  803dc4:	eb 05                	jmp    803dcb <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803dc6:	e8 46 ce ff ff       	call   800c11 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803dcb:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803dd1:	89 ca                	mov    %ecx,%edx
+  803dd3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803dd9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803ddc:	c1 e0 04             	shl    $0x4,%eax
+  803ddf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803de4:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803de7:	39 c1                	cmp    %eax,%ecx
+  803de9:	75 12                	jne    803dfd <pthread_join+0xac>
+  803deb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803dee:	c1 e0 04             	shl    $0x4,%eax
+  803df1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803df6:	8b 40 54             	mov    0x54(%eax),%eax
+  803df9:	85 c0                	test   %eax,%eax
+  803dfb:	75 c9                	jne    803dc6 <pthread_join+0x75>
+	if (ret_store)
+  803dfd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803e01:	74 0f                	je     803e12 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803e03:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e06:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803e0d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e10:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803e12:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e15:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803e1c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803e23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e2b:	5b                   	pop    %ebx
+  803e2c:	5e                   	pop    %esi
+  803e2d:	5f                   	pop    %edi
+  803e2e:	5d                   	pop    %ebp
+  803e2f:	c3                   	ret
+		return -E_INVAL;
+  803e30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e35:	eb f1                	jmp    803e28 <pthread_join+0xd7>
+  803e37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e3c:	eb ea                	jmp    803e28 <pthread_join+0xd7>
+		return -E_INVAL;
+  803e3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e43:	eb e3                	jmp    803e28 <pthread_join+0xd7>
+
+00803e45 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803e45:	55                   	push   %ebp
+  803e46:	89 e5                	mov    %esp,%ebp
+  803e48:	53                   	push   %ebx
+  803e49:	83 ec 04             	sub    $0x4,%esp
+  803e4c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e4e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e54:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e59:	77 0c                	ja     803e67 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e5b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e60:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803e62:	c1 e8 10             	shr    $0x10,%eax
+  803e65:	75 0a                	jne    803e71 <pthread_exit+0x2c>
+		exit();
+  803e67:	e8 f2 c2 ff ff       	call   80015e <exit>
+  803e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803e71:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803e78:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803e7b:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803e82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e85:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803e88:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803e8f:	83 ec 08             	sub    $0x8,%esp
+  803e92:	6a 20                	push   $0x20
+  803e94:	01 c2                	add    %eax,%edx
+  803e96:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803e9d:	50                   	push   %eax
+  803e9e:	e8 de d0 ff ff       	call   800f81 <sys_futex_wake>
+	sys_env_destroy(0);
+  803ea3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803eaa:	e8 eb cc ff ff       	call   800b9a <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803eaf:	83 c4 0c             	add    $0xc,%esp
+  803eb2:	68 56 4e 80 00       	push   $0x804e56
+  803eb7:	68 a5 00 00 00       	push   $0xa5
+  803ebc:	68 70 4e 80 00       	push   $0x804e70
+  803ec1:	e8 cd 03 00 00       	call   804293 <_panic>
+
+00803ec6 <pthread_start>:
+{
+  803ec6:	55                   	push   %ebp
+  803ec7:	89 e5                	mov    %esp,%ebp
+  803ec9:	53                   	push   %ebx
+  803eca:	83 ec 04             	sub    $0x4,%esp
+  803ecd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803ed0:	e8 10 cd ff ff       	call   800be5 <sys_getenvid>
+  803ed5:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803eda:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  803ee0:	85 db                	test   %ebx,%ebx
+  803ee2:	74 0c                	je     803ef0 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ee4:	89 d9                	mov    %ebx,%ecx
+  803ee6:	c1 e1 10             	shl    $0x10,%ecx
+  803ee9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803eee:	29 ca                	sub    %ecx,%edx
+  803ef0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803ef3:	c1 e0 04             	shl    $0x4,%eax
+  803ef6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803efb:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803efd:	83 ec 0c             	sub    $0xc,%esp
+  803f00:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803f07:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803f0a:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803f11:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803f18:	89 04 24             	mov    %eax,(%esp)
+  803f1b:	e8 25 ff ff ff       	call   803e45 <pthread_exit>
+
+00803f20 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803f20:	55                   	push   %ebp
+  803f21:	89 e5                	mov    %esp,%ebp
+  803f23:	57                   	push   %edi
+  803f24:	56                   	push   %esi
+  803f25:	53                   	push   %ebx
+  803f26:	83 ec 1c             	sub    $0x1c,%esp
+  803f29:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f2b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803f31:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f38:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f3d:	77 0d                	ja     803f4c <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f3f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f44:	29 d0                	sub    %edx,%eax
+  803f46:	c1 e8 10             	shr    $0x10,%eax
+  803f49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f51:	eb 2f                	jmp    803f82 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803f53:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f59:	8b 01                	mov    (%ecx),%eax
+  803f5b:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803f5e:	39 c2                	cmp    %eax,%edx
+  803f60:	75 14                	jne    803f76 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803f62:	83 ec 0c             	sub    $0xc,%esp
+  803f65:	57                   	push   %edi
+  803f66:	e8 2f cc ff ff       	call   800b9a <sys_env_destroy>
+  803f6b:	83 c4 10             	add    $0x10,%esp
+  803f6e:	85 c0                	test   %eax,%eax
+  803f70:	0f 88 97 00 00 00    	js     80400d <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f76:	83 c3 01             	add    $0x1,%ebx
+  803f79:	83 fb 20             	cmp    $0x20,%ebx
+  803f7c:	0f 84 d2 00 00 00    	je     804054 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803f82:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803f85:	74 ef                	je     803f76 <pthread_kill_others+0x56>
+  803f87:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f8a:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803f91:	8b 40 04             	mov    0x4(%eax),%eax
+  803f94:	83 f8 01             	cmp    $0x1,%eax
+  803f97:	75 dd                	jne    803f76 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803f99:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f9c:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803fa3:	89 fe                	mov    %edi,%esi
+  803fa5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803fab:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803fae:	c1 e0 04             	shl    $0x4,%eax
+  803fb1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fb6:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803fb9:	39 c7                	cmp    %eax,%edi
+  803fbb:	75 b9                	jne    803f76 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803fbd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803fc0:	c1 e0 04             	shl    $0x4,%eax
+  803fc3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fc8:	8b 40 54             	mov    0x54(%eax),%eax
+  803fcb:	85 c0                	test   %eax,%eax
+  803fcd:	74 a7                	je     803f76 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803fcf:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803fd2:	c1 e0 04             	shl    $0x4,%eax
+  803fd5:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803fdb:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fdd:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803fe3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fe8:	0f 87 65 ff ff ff    	ja     803f53 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fee:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ff3:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803ff5:	c1 e8 10             	shr    $0x10,%eax
+  803ff8:	0f 84 55 ff ff ff    	je     803f53 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ffe:	c1 e0 10             	shl    $0x10,%eax
+  804001:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804006:	29 c1                	sub    %eax,%ecx
+  804008:	e9 4c ff ff ff       	jmp    803f59 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80400d:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804010:	c1 e2 04             	shl    $0x4,%edx
+  804013:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804019:	8b 52 48             	mov    0x48(%edx),%edx
+  80401c:	39 fa                	cmp    %edi,%edx
+  80401e:	0f 85 52 ff ff ff    	jne    803f76 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804024:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804027:	c1 e2 04             	shl    $0x4,%edx
+  80402a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804030:	8b 52 54             	mov    0x54(%edx),%edx
+  804033:	85 d2                	test   %edx,%edx
+  804035:	0f 84 3b ff ff ff    	je     803f76 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80403b:	83 ec 0c             	sub    $0xc,%esp
+  80403e:	50                   	push   %eax
+  80403f:	57                   	push   %edi
+  804040:	68 80 4e 80 00       	push   $0x804e80
+  804045:	68 bb 00 00 00       	push   $0xbb
+  80404a:	68 70 4e 80 00       	push   $0x804e70
+  80404f:	e8 3f 02 00 00       	call   804293 <_panic>
+	}
+}
+  804054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804057:	5b                   	pop    %ebx
+  804058:	5e                   	pop    %esi
+  804059:	5f                   	pop    %edi
+  80405a:	5d                   	pop    %ebp
+  80405b:	c3                   	ret
+
+0080405c <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80405c:	55                   	push   %ebp
+  80405d:	89 e5                	mov    %esp,%ebp
+  80405f:	53                   	push   %ebx
+  804060:	83 ec 04             	sub    $0x4,%esp
+  804063:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804065:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80406b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804071:	0f 87 85 00 00 00    	ja     8040fc <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804077:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80407c:	29 c3                	sub    %eax,%ebx
+  80407e:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804081:	83 ec 04             	sub    $0x4,%esp
+  804084:	68 80 02 00 00       	push   $0x280
+  804089:	6a 00                	push   $0x0
+  80408b:	68 40 60 80 00       	push   $0x806040
+  804090:	e8 bb c8 ff ff       	call   800950 <memset>
+	threads_mu.m_state = 0;
+  804095:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80409c:	00 00 00 
+	if (self != 0) {
+  80409f:	83 c4 10             	add    $0x10,%esp
+  8040a2:	85 db                	test   %ebx,%ebx
+  8040a4:	74 51                	je     8040f7 <pthread_fork_child+0x9b>
+  8040a6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8040ae:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040b3:	77 18                	ja     8040cd <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040b5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040ba:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8040bc:	c1 e8 10             	shr    $0x10,%eax
+  8040bf:	74 0c                	je     8040cd <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040c1:	c1 e0 10             	shl    $0x10,%eax
+  8040c4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8040c9:	29 c2                	sub    %eax,%edx
+  8040cb:	eb 06                	jmp    8040d3 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8040cd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8040d3:	8b 02                	mov    (%edx),%eax
+  8040d5:	8b 48 48             	mov    0x48(%eax),%ecx
+  8040d8:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8040df:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8040e2:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8040e9:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  8040f0:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8040f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040fa:	c9                   	leave
+  8040fb:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8040fc:	83 ec 04             	sub    $0x4,%esp
+  8040ff:	68 80 02 00 00       	push   $0x280
+  804104:	6a 00                	push   $0x0
+  804106:	68 40 60 80 00       	push   $0x806040
+  80410b:	e8 40 c8 ff ff       	call   800950 <memset>
+	threads_mu.m_state = 0;
+  804110:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  804117:	00 00 00 
+  80411a:	83 c4 10             	add    $0x10,%esp
+  80411d:	eb d8                	jmp    8040f7 <pthread_fork_child+0x9b>
+
+0080411f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80411f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804124:	c3                   	ret
+
+00804125 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804125:	55                   	push   %ebp
+  804126:	89 e5                	mov    %esp,%ebp
+  804128:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80412b:	68 a5 4e 80 00       	push   $0x804ea5
+  804130:	ff 75 0c             	push   0xc(%ebp)
+  804133:	e8 c7 c6 ff ff       	call   8007ff <strcpy>
+	return 0;
+}
+  804138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413d:	c9                   	leave
+  80413e:	c3                   	ret
+
+0080413f <devcons_write>:
+{
+  80413f:	55                   	push   %ebp
+  804140:	89 e5                	mov    %esp,%ebp
+  804142:	57                   	push   %edi
+  804143:	56                   	push   %esi
+  804144:	53                   	push   %ebx
+  804145:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80414b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804150:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804156:	eb 2e                	jmp    804186 <devcons_write+0x47>
+		m = n - tot;
+  804158:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80415b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80415d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804162:	39 c3                	cmp    %eax,%ebx
+  804164:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804167:	83 ec 04             	sub    $0x4,%esp
+  80416a:	53                   	push   %ebx
+  80416b:	89 f0                	mov    %esi,%eax
+  80416d:	03 45 0c             	add    0xc(%ebp),%eax
+  804170:	50                   	push   %eax
+  804171:	57                   	push   %edi
+  804172:	e8 0e c8 ff ff       	call   800985 <memmove>
+		sys_cputs(buf, m);
+  804177:	83 c4 08             	add    $0x8,%esp
+  80417a:	53                   	push   %ebx
+  80417b:	57                   	push   %edi
+  80417c:	e8 c2 c9 ff ff       	call   800b43 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804181:	01 de                	add    %ebx,%esi
+  804183:	83 c4 10             	add    $0x10,%esp
+  804186:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804189:	72 cd                	jb     804158 <devcons_write+0x19>
+}
+  80418b:	89 f0                	mov    %esi,%eax
+  80418d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804190:	5b                   	pop    %ebx
+  804191:	5e                   	pop    %esi
+  804192:	5f                   	pop    %edi
+  804193:	5d                   	pop    %ebp
+  804194:	c3                   	ret
+
+00804195 <devcons_read>:
+{
+  804195:	55                   	push   %ebp
+  804196:	89 e5                	mov    %esp,%ebp
+  804198:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80419b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8041a4:	75 07                	jne    8041ad <devcons_read+0x18>
+  8041a6:	eb 1f                	jmp    8041c7 <devcons_read+0x32>
+		sys_yield();
+  8041a8:	e8 64 ca ff ff       	call   800c11 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8041ad:	e8 bc c9 ff ff       	call   800b6e <sys_cgetc>
+  8041b2:	85 c0                	test   %eax,%eax
+  8041b4:	74 f2                	je     8041a8 <devcons_read+0x13>
+	if (c < 0)
+  8041b6:	78 0f                	js     8041c7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8041b8:	83 f8 04             	cmp    $0x4,%eax
+  8041bb:	74 0c                	je     8041c9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8041bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041c0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8041c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8041c7:	c9                   	leave
+  8041c8:	c3                   	ret
+		return 0;
+  8041c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ce:	eb f7                	jmp    8041c7 <devcons_read+0x32>
+
+008041d0 <cputchar>:
+{
+  8041d0:	55                   	push   %ebp
+  8041d1:	89 e5                	mov    %esp,%ebp
+  8041d3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8041d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041d9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8041dc:	6a 01                	push   $0x1
+  8041de:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041e1:	50                   	push   %eax
+  8041e2:	e8 5c c9 ff ff       	call   800b43 <sys_cputs>
+}
+  8041e7:	83 c4 10             	add    $0x10,%esp
+  8041ea:	c9                   	leave
+  8041eb:	c3                   	ret
+
+008041ec <getchar>:
+{
+  8041ec:	55                   	push   %ebp
+  8041ed:	89 e5                	mov    %esp,%ebp
+  8041ef:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8041f2:	6a 01                	push   $0x1
+  8041f4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041f7:	50                   	push   %eax
+  8041f8:	6a 00                	push   $0x0
+  8041fa:	e8 63 d8 ff ff       	call   801a62 <read>
+	if (r < 0)
+  8041ff:	83 c4 10             	add    $0x10,%esp
+  804202:	85 c0                	test   %eax,%eax
+  804204:	78 06                	js     80420c <getchar+0x20>
+	if (r < 1)
+  804206:	74 06                	je     80420e <getchar+0x22>
+	return c;
+  804208:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80420c:	c9                   	leave
+  80420d:	c3                   	ret
+		return -E_EOF;
+  80420e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804213:	eb f7                	jmp    80420c <getchar+0x20>
+
+00804215 <iscons>:
+{
+  804215:	55                   	push   %ebp
+  804216:	89 e5                	mov    %esp,%ebp
+  804218:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80421b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80421e:	50                   	push   %eax
+  80421f:	ff 75 08             	push   0x8(%ebp)
+  804222:	e8 ab d5 ff ff       	call   8017d2 <fd_lookup>
+  804227:	83 c4 10             	add    $0x10,%esp
+  80422a:	85 c0                	test   %eax,%eax
+  80422c:	78 11                	js     80423f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80422e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804231:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  804237:	39 10                	cmp    %edx,(%eax)
+  804239:	0f 94 c0             	sete   %al
+  80423c:	0f b6 c0             	movzbl %al,%eax
+}
+  80423f:	c9                   	leave
+  804240:	c3                   	ret
+
+00804241 <opencons>:
+{
+  804241:	55                   	push   %ebp
+  804242:	89 e5                	mov    %esp,%ebp
+  804244:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804247:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80424a:	50                   	push   %eax
+  80424b:	e8 2c d5 ff ff       	call   80177c <fd_alloc>
+  804250:	83 c4 10             	add    $0x10,%esp
+  804253:	85 c0                	test   %eax,%eax
+  804255:	78 3a                	js     804291 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804257:	83 ec 04             	sub    $0x4,%esp
+  80425a:	68 07 04 00 00       	push   $0x407
+  80425f:	ff 75 f4             	push   -0xc(%ebp)
+  804262:	6a 00                	push   $0x0
+  804264:	e8 d4 c9 ff ff       	call   800c3d <sys_page_alloc>
+  804269:	83 c4 10             	add    $0x10,%esp
+  80426c:	85 c0                	test   %eax,%eax
+  80426e:	78 21                	js     804291 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804270:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804273:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  804279:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80427b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80427e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804285:	83 ec 0c             	sub    $0xc,%esp
+  804288:	50                   	push   %eax
+  804289:	e8 c7 d4 ff ff       	call   801755 <fd2num>
+  80428e:	83 c4 10             	add    $0x10,%esp
+}
+  804291:	c9                   	leave
+  804292:	c3                   	ret
+
+00804293 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804293:	55                   	push   %ebp
+  804294:	89 e5                	mov    %esp,%ebp
+  804296:	56                   	push   %esi
+  804297:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804298:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80429b:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8042a1:	e8 3f c9 ff ff       	call   800be5 <sys_getenvid>
+  8042a6:	83 ec 0c             	sub    $0xc,%esp
+  8042a9:	ff 75 0c             	push   0xc(%ebp)
+  8042ac:	ff 75 08             	push   0x8(%ebp)
+  8042af:	56                   	push   %esi
+  8042b0:	50                   	push   %eax
+  8042b1:	68 b4 4e 80 00       	push   $0x804eb4
+  8042b6:	e8 60 bf ff ff       	call   80021b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8042bb:	83 c4 18             	add    $0x18,%esp
+  8042be:	53                   	push   %ebx
+  8042bf:	ff 75 10             	push   0x10(%ebp)
+  8042c2:	e8 03 bf ff ff       	call   8001ca <vcprintf>
+	cprintf("\n");
+  8042c7:	c7 04 24 8f 47 80 00 	movl   $0x80478f,(%esp)
+  8042ce:	e8 48 bf ff ff       	call   80021b <cprintf>
+  8042d3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8042d6:	cc                   	int3
+	while (1)
+  8042d7:	eb fd                	jmp    8042d6 <_panic+0x43>
+
+008042d9 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8042d9:	55                   	push   %ebp
+  8042da:	89 e5                	mov    %esp,%ebp
+  8042dc:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8042df:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8042e6:	74 0a                	je     8042f2 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8042e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042eb:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8042f0:	c9                   	leave
+  8042f1:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8042f2:	83 ec 04             	sub    $0x4,%esp
+  8042f5:	6a 07                	push   $0x7
+  8042f7:	68 00 f0 bf ee       	push   $0xeebff000
+  8042fc:	6a 00                	push   $0x0
+  8042fe:	e8 3a c9 ff ff       	call   800c3d <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804303:	83 c4 08             	add    $0x8,%esp
+  804306:	68 17 43 80 00       	push   $0x804317
+  80430b:	6a 00                	push   $0x0
+  80430d:	e8 a8 ca ff ff       	call   800dba <sys_env_set_pgfault_upcall>
+  804312:	83 c4 10             	add    $0x10,%esp
+  804315:	eb d1                	jmp    8042e8 <set_pgfault_handler+0xf>
+
+00804317 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804317:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804318:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80431d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80431f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804322:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804326:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80432a:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80432d:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804331:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804333:	83 c4 08             	add    $0x8,%esp
+	popal
+  804336:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804337:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80433a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80433b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80433c:	c3                   	ret
+
+0080433d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80433d:	55                   	push   %ebp
+  80433e:	89 e5                	mov    %esp,%ebp
+  804340:	57                   	push   %edi
+  804341:	56                   	push   %esi
+  804342:	53                   	push   %ebx
+  804343:	83 ec 18             	sub    $0x18,%esp
+  804346:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804349:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80434c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804356:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804359:	50                   	push   %eax
+  80435a:	e8 d4 ca ff ff       	call   800e33 <sys_ipc_recv>
+	if (r < 0) {
+  80435f:	83 c4 10             	add    $0x10,%esp
+  804362:	85 c0                	test   %eax,%eax
+  804364:	78 2b                	js     804391 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804366:	85 ff                	test   %edi,%edi
+  804368:	74 55                	je     8043bf <ipc_recv+0x82>
+  80436a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80436c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804372:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804377:	77 39                	ja     8043b2 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804379:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80437e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804380:	c1 e8 10             	shr    $0x10,%eax
+  804383:	74 2d                	je     8043b2 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804385:	c1 e0 10             	shl    $0x10,%eax
+  804388:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80438d:	29 c2                	sub    %eax,%edx
+  80438f:	eb 27                	jmp    8043b8 <ipc_recv+0x7b>
+  804391:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804393:	83 ec 08             	sub    $0x8,%esp
+  804396:	50                   	push   %eax
+  804397:	68 d7 4e 80 00       	push   $0x804ed7
+  80439c:	e8 7a be ff ff       	call   80021b <cprintf>
+		*from_env_store = 0;
+  8043a1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8043a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8043ad:	83 c4 10             	add    $0x10,%esp
+  8043b0:	eb 77                	jmp    804429 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8043b2:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8043b8:	8b 02                	mov    (%edx),%eax
+  8043ba:	8b 40 78             	mov    0x78(%eax),%eax
+  8043bd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8043bf:	85 f6                	test   %esi,%esi
+  8043c1:	74 34                	je     8043f7 <ipc_recv+0xba>
+  8043c3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043c5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043cb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043d0:	77 18                	ja     8043ea <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043d2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043d7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043d9:	c1 e8 10             	shr    $0x10,%eax
+  8043dc:	74 0c                	je     8043ea <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043de:	c1 e0 10             	shl    $0x10,%eax
+  8043e1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043e6:	29 c2                	sub    %eax,%edx
+  8043e8:	eb 06                	jmp    8043f0 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8043ea:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8043f0:	8b 02                	mov    (%edx),%eax
+  8043f2:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043f5:	89 06                	mov    %eax,(%esi)
+  8043f7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043f9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043ff:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804404:	77 18                	ja     80441e <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804406:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80440b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80440d:	c1 e8 10             	shr    $0x10,%eax
+  804410:	74 0c                	je     80441e <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804412:	c1 e0 10             	shl    $0x10,%eax
+  804415:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80441a:	29 c2                	sub    %eax,%edx
+  80441c:	eb 06                	jmp    804424 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80441e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804424:	8b 02                	mov    (%edx),%eax
+  804426:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804429:	89 d8                	mov    %ebx,%eax
+  80442b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80442e:	5b                   	pop    %ebx
+  80442f:	5e                   	pop    %esi
+  804430:	5f                   	pop    %edi
+  804431:	5d                   	pop    %ebp
+  804432:	c3                   	ret
+
+00804433 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804433:	55                   	push   %ebp
+  804434:	89 e5                	mov    %esp,%ebp
+  804436:	57                   	push   %edi
+  804437:	56                   	push   %esi
+  804438:	53                   	push   %ebx
+  804439:	83 ec 0c             	sub    $0xc,%esp
+  80443c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80443f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804442:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804445:	85 db                	test   %ebx,%ebx
+  804447:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80444c:	0f 44 d8             	cmove  %eax,%ebx
+  80444f:	eb 05                	jmp    804456 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804451:	e8 bb c7 ff ff       	call   800c11 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804456:	57                   	push   %edi
+  804457:	53                   	push   %ebx
+  804458:	ff 75 0c             	push   0xc(%ebp)
+  80445b:	56                   	push   %esi
+  80445c:	e8 a5 c9 ff ff       	call   800e06 <sys_ipc_try_send>
+		if (r == 0) {
+  804461:	83 c4 10             	add    $0x10,%esp
+  804464:	85 c0                	test   %eax,%eax
+  804466:	74 19                	je     804481 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804468:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80446b:	74 e4                	je     804451 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80446d:	83 ec 0c             	sub    $0xc,%esp
+  804470:	50                   	push   %eax
+  804471:	57                   	push   %edi
+  804472:	53                   	push   %ebx
+  804473:	56                   	push   %esi
+  804474:	68 f0 4e 80 00       	push   $0x804ef0
+  804479:	e8 9d bd ff ff       	call   80021b <cprintf>
+			return;
+  80447e:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804484:	5b                   	pop    %ebx
+  804485:	5e                   	pop    %esi
+  804486:	5f                   	pop    %edi
+  804487:	5d                   	pop    %ebp
+  804488:	c3                   	ret
+
+00804489 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804489:	55                   	push   %ebp
+  80448a:	89 e5                	mov    %esp,%ebp
+  80448c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80448f:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804494:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804497:	c1 e0 04             	shl    $0x4,%eax
+  80449a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80449f:	8b 40 50             	mov    0x50(%eax),%eax
+  8044a2:	39 c8                	cmp    %ecx,%eax
+  8044a4:	74 12                	je     8044b8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8044a6:	83 c2 01             	add    $0x1,%edx
+  8044a9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8044af:	75 e3                	jne    804494 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8044b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b6:	eb 0e                	jmp    8044c6 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8044b8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044bb:	c1 e0 04             	shl    $0x4,%eax
+  8044be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044c3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8044c6:	5d                   	pop    %ebp
+  8044c7:	c3                   	ret
+
+008044c8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044c8:	55                   	push   %ebp
+  8044c9:	89 e5                	mov    %esp,%ebp
+  8044cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044ce:	89 c2                	mov    %eax,%edx
+  8044d0:	c1 ea 16             	shr    $0x16,%edx
+  8044d3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044da:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044df:	f6 c1 01             	test   $0x1,%cl
+  8044e2:	74 1c                	je     804500 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044e4:	c1 e8 0c             	shr    $0xc,%eax
+  8044e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044ee:	a8 01                	test   $0x1,%al
+  8044f0:	74 0e                	je     804500 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044f2:	c1 e8 0c             	shr    $0xc,%eax
+  8044f5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044fc:	ef 
+  8044fd:	0f b7 d2             	movzwl %dx,%edx
+}
+  804500:	89 d0                	mov    %edx,%eax
+  804502:	5d                   	pop    %ebp
+  804503:	c3                   	ret
+
+00804504 <udm>:
+  804504:	57                   	push   %edi
+  804505:	56                   	push   %esi
+  804506:	53                   	push   %ebx
+  804507:	83 ec 20             	sub    $0x20,%esp
+  80450a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80450e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804512:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804516:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80451a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80451e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804522:	89 d1                	mov    %edx,%ecx
+  804524:	09 c1                	or     %eax,%ecx
+  804526:	0f 84 91 00 00 00    	je     8045bd <udm+0xb9>
+  80452c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804531:	ba 00 00 00 00       	mov    $0x0,%edx
+  804536:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80453b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804542:	00 
+  804543:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80454a:	00 
+  80454b:	eb 08                	jmp    804555 <udm+0x51>
+  80454d:	83 e9 01             	sub    $0x1,%ecx
+  804550:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804553:	74 7c                	je     8045d1 <udm+0xcd>
+  804555:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804559:	01 c0                	add    %eax,%eax
+  80455b:	89 c6                	mov    %eax,%esi
+  80455d:	89 d7                	mov    %edx,%edi
+  80455f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804563:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804567:	0f ad d0             	shrd   %cl,%edx,%eax
+  80456a:	d3 ea                	shr    %cl,%edx
+  80456c:	f6 c1 20             	test   $0x20,%cl
+  80456f:	74 04                	je     804575 <udm+0x71>
+  804571:	89 d0                	mov    %edx,%eax
+  804573:	31 d2                	xor    %edx,%edx
+  804575:	83 e0 01             	and    $0x1,%eax
+  804578:	89 04 24             	mov    %eax,(%esp)
+  80457b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804582:	00 
+  804583:	8b 04 24             	mov    (%esp),%eax
+  804586:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80458a:	09 f0                	or     %esi,%eax
+  80458c:	09 fa                	or     %edi,%edx
+  80458e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804592:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804596:	39 f0                	cmp    %esi,%eax
+  804598:	89 d3                	mov    %edx,%ebx
+  80459a:	19 fb                	sbb    %edi,%ebx
+  80459c:	72 af                	jb     80454d <udm+0x49>
+  80459e:	29 f0                	sub    %esi,%eax
+  8045a0:	19 fa                	sbb    %edi,%edx
+  8045a2:	89 cf                	mov    %ecx,%edi
+  8045a4:	c1 ef 05             	shr    $0x5,%edi
+  8045a7:	83 e7 01             	and    $0x1,%edi
+  8045aa:	89 fe                	mov    %edi,%esi
+  8045ac:	83 f6 01             	xor    $0x1,%esi
+  8045af:	d3 e6                	shl    %cl,%esi
+  8045b1:	d3 e7                	shl    %cl,%edi
+  8045b3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045b7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045bb:	eb 90                	jmp    80454d <udm+0x49>
+  8045bd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045c1:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045c5:	89 f0                	mov    %esi,%eax
+  8045c7:	89 fa                	mov    %edi,%edx
+  8045c9:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045cd:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045d1:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045d5:	89 01                	mov    %eax,(%ecx)
+  8045d7:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045da:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045de:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045e2:	83 c4 20             	add    $0x20,%esp
+  8045e5:	5b                   	pop    %ebx
+  8045e6:	5e                   	pop    %esi
+  8045e7:	5f                   	pop    %edi
+  8045e8:	c3                   	ret
+
+008045e9 <__udivdi3>:
+  8045e9:	83 ec 18             	sub    $0x18,%esp
+  8045ec:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045f0:	50                   	push   %eax
+  8045f1:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f5:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045fd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804601:	e8 fe fe ff ff       	call   804504 <udm>
+  804606:	83 c4 24             	add    $0x24,%esp
+  804609:	c3                   	ret
+
+0080460a <__umoddi3>:
+  80460a:	83 ec 18             	sub    $0x18,%esp
+  80460d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804611:	50                   	push   %eax
+  804612:	ff 74 24 2c          	push   0x2c(%esp)
+  804616:	ff 74 24 2c          	push   0x2c(%esp)
+  80461a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80461e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804622:	e8 dd fe ff ff       	call   804504 <udm>
+  804627:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80462b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80462f:	83 c4 24             	add    $0x24,%esp
+  804632:	c3                   	ret
+
+00804633 <__divdi3>:
+  804633:	56                   	push   %esi
+  804634:	53                   	push   %ebx
+  804635:	83 ec 14             	sub    $0x14,%esp
+  804638:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80463c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804640:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804644:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804648:	85 d2                	test   %edx,%edx
+  80464a:	78 18                	js     804664 <__divdi3+0x31>
+  80464c:	85 db                	test   %ebx,%ebx
+  80464e:	78 3e                	js     80468e <__divdi3+0x5b>
+  804650:	83 ec 04             	sub    $0x4,%esp
+  804653:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804657:	56                   	push   %esi
+  804658:	53                   	push   %ebx
+  804659:	51                   	push   %ecx
+  80465a:	e8 a5 fe ff ff       	call   804504 <udm>
+  80465f:	83 c4 10             	add    $0x10,%esp
+  804662:	eb 24                	jmp    804688 <__divdi3+0x55>
+  804664:	f7 d8                	neg    %eax
+  804666:	83 d2 00             	adc    $0x0,%edx
+  804669:	f7 da                	neg    %edx
+  80466b:	85 db                	test   %ebx,%ebx
+  80466d:	78 3a                	js     8046a9 <__divdi3+0x76>
+  80466f:	83 ec 04             	sub    $0x4,%esp
+  804672:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804676:	56                   	push   %esi
+  804677:	53                   	push   %ebx
+  804678:	51                   	push   %ecx
+  804679:	e8 86 fe ff ff       	call   804504 <udm>
+  80467e:	83 c4 10             	add    $0x10,%esp
+  804681:	f7 d8                	neg    %eax
+  804683:	83 d2 00             	adc    $0x0,%edx
+  804686:	f7 da                	neg    %edx
+  804688:	83 c4 14             	add    $0x14,%esp
+  80468b:	5b                   	pop    %ebx
+  80468c:	5e                   	pop    %esi
+  80468d:	c3                   	ret
+  80468e:	83 ec 04             	sub    $0x4,%esp
+  804691:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804695:	56                   	push   %esi
+  804696:	f7 d9                	neg    %ecx
+  804698:	83 d3 00             	adc    $0x0,%ebx
+  80469b:	f7 db                	neg    %ebx
+  80469d:	53                   	push   %ebx
+  80469e:	51                   	push   %ecx
+  80469f:	e8 60 fe ff ff       	call   804504 <udm>
+  8046a4:	83 c4 10             	add    $0x10,%esp
+  8046a7:	eb d8                	jmp    804681 <__divdi3+0x4e>
+  8046a9:	83 ec 04             	sub    $0x4,%esp
+  8046ac:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046b0:	56                   	push   %esi
+  8046b1:	f7 d9                	neg    %ecx
+  8046b3:	83 d3 00             	adc    $0x0,%ebx
+  8046b6:	f7 db                	neg    %ebx
+  8046b8:	53                   	push   %ebx
+  8046b9:	51                   	push   %ecx
+  8046ba:	e8 45 fe ff ff       	call   804504 <udm>
+  8046bf:	83 c4 10             	add    $0x10,%esp
+  8046c2:	eb c4                	jmp    804688 <__divdi3+0x55>
+
+008046c4 <__moddi3>:
+  8046c4:	55                   	push   %ebp
+  8046c5:	57                   	push   %edi
+  8046c6:	56                   	push   %esi
+  8046c7:	53                   	push   %ebx
+  8046c8:	83 ec 24             	sub    $0x24,%esp
+  8046cb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046cf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046d3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046d7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046db:	85 d2                	test   %edx,%edx
+  8046dd:	78 3b                	js     80471a <__moddi3+0x56>
+  8046df:	83 ec 04             	sub    $0x4,%esp
+  8046e2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046e6:	56                   	push   %esi
+  8046e7:	89 ce                	mov    %ecx,%esi
+  8046e9:	f7 de                	neg    %esi
+  8046eb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046ef:	89 de                	mov    %ebx,%esi
+  8046f1:	83 d6 00             	adc    $0x0,%esi
+  8046f4:	f7 de                	neg    %esi
+  8046f6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046fa:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046fe:	0f 48 f1             	cmovs  %ecx,%esi
+  804701:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804706:	53                   	push   %ebx
+  804707:	56                   	push   %esi
+  804708:	e8 f7 fd ff ff       	call   804504 <udm>
+  80470d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804711:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804715:	83 c4 10             	add    $0x10,%esp
+  804718:	eb 47                	jmp    804761 <__moddi3+0x9d>
+  80471a:	f7 d8                	neg    %eax
+  80471c:	83 d2 00             	adc    $0x0,%edx
+  80471f:	f7 da                	neg    %edx
+  804721:	83 ec 04             	sub    $0x4,%esp
+  804724:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804728:	56                   	push   %esi
+  804729:	89 cf                	mov    %ecx,%edi
+  80472b:	f7 df                	neg    %edi
+  80472d:	89 de                	mov    %ebx,%esi
+  80472f:	83 d6 00             	adc    $0x0,%esi
+  804732:	f7 de                	neg    %esi
+  804734:	0f 49 cf             	cmovns %edi,%ecx
+  804737:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80473b:	0f 49 de             	cmovns %esi,%ebx
+  80473e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804742:	ff 74 24 0c          	push   0xc(%esp)
+  804746:	ff 74 24 0c          	push   0xc(%esp)
+  80474a:	e8 b5 fd ff ff       	call   804504 <udm>
+  80474f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804753:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804757:	f7 d8                	neg    %eax
+  804759:	83 d2 00             	adc    $0x0,%edx
+  80475c:	f7 da                	neg    %edx
+  80475e:	83 c4 10             	add    $0x10,%esp
+  804761:	83 c4 24             	add    $0x24,%esp
+  804764:	5b                   	pop    %ebx
+  804765:	5e                   	pop    %esi
+  804766:	5f                   	pop    %edi
+  804767:	5d                   	pop    %ebp
+  804768:	c3                   	ret
@@ -0,0 +1,10912 @@
+
+obj/user/fsbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c7 07 00 00       	call   8007f8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <report>:
+static char buf[BLKSIZE];
+
+static void
+report(const char *what, uint64_t cycles, unsigned msec,
+       struct BcStat *before, struct BcStat *after)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 18             	sub    $0x18,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+  80003e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800041:	8b 75 10             	mov    0x10(%ebp),%esi
+	cprintf("%s: %d KB, %d cycles/block, %d ms, "
+  800044:	8b 7e 14             	mov    0x14(%esi),%edi
+  800047:	2b 78 14             	sub    0x14(%eax),%edi
+  80004a:	57                   	push   %edi
+  80004b:	8b 7e 10             	mov    0x10(%esi),%edi
+  80004e:	2b 78 10             	sub    0x10(%eax),%edi
+  800051:	57                   	push   %edi
+  800052:	8b 7e 08             	mov    0x8(%esi),%edi
+  800055:	2b 78 08             	sub    0x8(%eax),%edi
+  800058:	57                   	push   %edi
+  800059:	8b 76 04             	mov    0x4(%esi),%esi
+  80005c:	2b 70 04             	sub    0x4(%eax),%esi
+  80005f:	56                   	push   %esi
+  800060:	ff 75 08             	push   0x8(%ebp)
+		"%d faults, %d blocks read ahead, %d written back in %d writes\n",
+		what, FILESIZE / 1024, (uint32_t) (cycles / NBLOCKS), msec,
+  800063:	89 d0                	mov    %edx,%eax
+  800065:	89 ca                	mov    %ecx,%edx
+  800067:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80006b:	c1 ea 08             	shr    $0x8,%edx
+	cprintf("%s: %d KB, %d cycles/block, %d ms, "
+  80006e:	50                   	push   %eax
+  80006f:	68 00 04 00 00       	push   $0x400
+  800074:	53                   	push   %ebx
+  800075:	68 00 53 80 00       	push   $0x805300
+  80007a:	e8 f7 08 00 00       	call   800976 <cprintf>
+		after->bs_misses - before->bs_misses,
+		after->bs_readahead - before->bs_readahead,
+		after->bs_writebacks - before->bs_writebacks,
+		after->bs_writes - before->bs_writes);
+}
+  80007f:	83 c4 30             	add    $0x30,%esp
+  800082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800085:	5b                   	pop    %ebx
+  800086:	5e                   	pop    %esi
+  800087:	5f                   	pop    %edi
+  800088:	5d                   	pop    %ebp
+  800089:	c3                   	ret
+
+0080008a <bench_read>:
+}
+
+// Read block order[i] for every i.
+static void
+bench_read(int fd, const char *what, const uint32_t *order)
+{
+  80008a:	55                   	push   %ebp
+  80008b:	89 e5                	mov    %esp,%ebp
+  80008d:	57                   	push   %edi
+  80008e:	56                   	push   %esi
+  80008f:	53                   	push   %ebx
+  800090:	81 ec b4 00 00 00    	sub    $0xb4,%esp
+  800096:	89 c6                	mov    %eax,%esi
+  800098:	89 95 5c ff ff ff    	mov    %edx,-0xa4(%ebp)
+  80009e:	89 cf                	mov    %ecx,%edi
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	int i, r;
+
+	fs_bcstat(0, &before);
+  8000a0:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  8000a3:	50                   	push   %eax
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	e8 61 24 00 00       	call   80250c <fs_bcstat>
+	start = sys_time_msec();
+  8000ab:	e8 75 15 00 00       	call   801625 <sys_time_msec>
+  8000b0:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000b6:	0f 31                	rdtsc
+  8000b8:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  8000be:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+	tsc = read_tsc();
+	for (i = 0; i < NBLOCKS; i++) {
+  8000c4:	89 fb                	mov    %edi,%ebx
+  8000c6:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	39 fb                	cmp    %edi,%ebx
+  8000d1:	74 6e                	je     800141 <bench_read+0xb7>
+		seek(fd, order[i] * BLKSIZE);
+  8000d3:	89 9d 64 ff ff ff    	mov    %ebx,-0x9c(%ebp)
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+  8000dc:	8b 03                	mov    (%ebx),%eax
+  8000de:	c1 e0 0c             	shl    $0xc,%eax
+  8000e1:	50                   	push   %eax
+  8000e2:	56                   	push   %esi
+  8000e3:	e8 03 1c 00 00       	call   801ceb <seek>
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	68 00 10 00 00       	push   $0x1000
+  8000f0:	68 00 f4 90 00       	push   $0x90f400
+  8000f5:	56                   	push   %esi
+  8000f6:	e8 fd 1a 00 00       	call   801bf8 <readn>
+  8000fb:	83 c4 10             	add    $0x10,%esp
+  8000fe:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800103:	75 25                	jne    80012a <bench_read+0xa0>
+			panic("read block %d: got %d", order[i], r);
+		if (buf[0] != 0x5a)
+  800105:	83 c3 04             	add    $0x4,%ebx
+  800108:	80 3d 00 f4 90 00 5a 	cmpb   $0x5a,0x90f400
+  80010f:	74 be                	je     8000cf <bench_read+0x45>
+			panic("read block %d: bad data", order[i]);
+  800111:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  800117:	ff 30                	push   (%eax)
+  800119:	68 ae 54 80 00       	push   $0x8054ae
+  80011e:	6a 47                	push   $0x47
+  800120:	68 d0 53 80 00       	push   $0x8053d0
+  800125:	e8 71 07 00 00       	call   80089b <_panic>
+			panic("read block %d: got %d", order[i], r);
+  80012a:	83 ec 0c             	sub    $0xc,%esp
+  80012d:	50                   	push   %eax
+  80012e:	ff 33                	push   (%ebx)
+  800130:	68 ba 53 80 00       	push   $0x8053ba
+  800135:	6a 45                	push   $0x45
+  800137:	68 d0 53 80 00       	push   $0x8053d0
+  80013c:	e8 5a 07 00 00       	call   80089b <_panic>
+	}
+	fs_bcstat(0, &after);
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	8d 9d 70 ff ff ff    	lea    -0x90(%ebp),%ebx
+  80014a:	53                   	push   %ebx
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 ba 23 00 00       	call   80250c <fs_bcstat>
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+  800152:	e8 ce 14 00 00       	call   801625 <sys_time_msec>
+  800157:	89 c1                	mov    %eax,%ecx
+  800159:	0f 31                	rdtsc
+  80015b:	2b 85 50 ff ff ff    	sub    -0xb0(%ebp),%eax
+  800161:	1b 95 54 ff ff ff    	sbb    -0xac(%ebp),%edx
+  800167:	83 c4 0c             	add    $0xc,%esp
+  80016a:	53                   	push   %ebx
+  80016b:	8d 5d ac             	lea    -0x54(%ebp),%ebx
+  80016e:	53                   	push   %ebx
+  80016f:	8b bd 60 ff ff ff    	mov    -0xa0(%ebp),%edi
+  800175:	29 f9                	sub    %edi,%ecx
+  800177:	51                   	push   %ecx
+  800178:	89 d1                	mov    %edx,%ecx
+  80017a:	89 c2                	mov    %eax,%edx
+  80017c:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  800182:	e8 ac fe ff ff       	call   800033 <report>
+	       &before, &after);
+}
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018d:	5b                   	pop    %ebx
+  80018e:	5e                   	pop    %esi
+  80018f:	5f                   	pop    %edi
+  800190:	5d                   	pop    %ebp
+  800191:	c3                   	ret
+
+00800192 <umain>:
+	       &before, &after);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	57                   	push   %edi
+  800196:	56                   	push   %esi
+  800197:	53                   	push   %ebx
+  800198:	81 ec d4 01 00 00    	sub    $0x1d4,%esp
+	static uint32_t order[NBLOCKS];
+	struct BcStat st, after;
+	int fd, i, r;
+
+	if ((r = fs_bcstat(0, &st)) < 0)
+  80019e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  8001a1:	50                   	push   %eax
+  8001a2:	6a 00                	push   $0x0
+  8001a4:	e8 63 23 00 00       	call   80250c <fs_bcstat>
+  8001a9:	83 c4 10             	add    $0x10,%esp
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	0f 88 1b 02 00 00    	js     8003cf <umain+0x23d>
+		panic("fs_bcstat: %e", r);
+	if ((fd = open(FILENAME, O_RDWR|O_CREAT|O_TRUNC)) < 0)
+  8001b4:	83 ec 08             	sub    $0x8,%esp
+  8001b7:	68 02 03 00 00       	push   $0x302
+  8001bc:	68 ed 53 80 00       	push   $0x8053ed
+  8001c1:	e8 c9 1f 00 00       	call   80218f <open>
+  8001c6:	89 85 44 fe ff ff    	mov    %eax,-0x1bc(%ebp)
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	0f 88 0d 02 00 00    	js     8003e4 <umain+0x252>
+	memset(buf, 0x5a, sizeof buf);
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	68 00 10 00 00       	push   $0x1000
+  8001df:	6a 5a                	push   $0x5a
+  8001e1:	68 00 f4 90 00       	push   $0x90f400
+  8001e6:	e8 c0 0e 00 00       	call   8010ab <memset>
+	fs_bcstat(0, &before);
+  8001eb:	83 c4 08             	add    $0x8,%esp
+  8001ee:	8d 85 b4 fe ff ff    	lea    -0x14c(%ebp),%eax
+  8001f4:	50                   	push   %eax
+  8001f5:	6a 00                	push   $0x0
+  8001f7:	e8 10 23 00 00       	call   80250c <fs_bcstat>
+	start = sys_time_msec();
+  8001fc:	e8 24 14 00 00       	call   801625 <sys_time_msec>
+  800201:	89 c7                	mov    %eax,%edi
+  800203:	0f 31                	rdtsc
+  800205:	89 85 38 fe ff ff    	mov    %eax,-0x1c8(%ebp)
+  80020b:	89 95 3c fe ff ff    	mov    %edx,-0x1c4(%ebp)
+  800211:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < FILESIZE; i += r)
+  800214:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = write(fd, buf, MIN(sizeof buf, FILESIZE - i))) < 0)
+  800219:	be 00 00 10 00       	mov    $0x100000,%esi
+  80021e:	89 bd 30 fe ff ff    	mov    %edi,-0x1d0(%ebp)
+  800224:	8b bd 44 fe ff ff    	mov    -0x1bc(%ebp),%edi
+  80022a:	83 ec 04             	sub    $0x4,%esp
+  80022d:	89 f0                	mov    %esi,%eax
+  80022f:	29 d8                	sub    %ebx,%eax
+  800231:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800236:	39 d0                	cmp    %edx,%eax
+  800238:	0f 47 c2             	cmova  %edx,%eax
+  80023b:	50                   	push   %eax
+  80023c:	68 00 f4 90 00       	push   $0x90f400
+  800241:	57                   	push   %edi
+  800242:	e8 f8 19 00 00       	call   801c3f <write>
+  800247:	83 c4 10             	add    $0x10,%esp
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	0f 88 af 01 00 00    	js     800401 <umain+0x26f>
+	for (i = 0; i < FILESIZE; i += r)
+  800252:	01 c3                	add    %eax,%ebx
+  800254:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+  80025a:	7e ce                	jle    80022a <umain+0x98>
+	if ((r = sync()) < 0)
+  80025c:	8b bd 30 fe ff ff    	mov    -0x1d0(%ebp),%edi
+  800262:	e8 70 22 00 00       	call   8024d7 <sync>
+  800267:	85 c0                	test   %eax,%eax
+  800269:	0f 88 a4 01 00 00    	js     800413 <umain+0x281>
+	fs_bcstat(0, &after);
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	8d 9d f0 fe ff ff    	lea    -0x110(%ebp),%ebx
+  800278:	53                   	push   %ebx
+  800279:	6a 00                	push   $0x0
+  80027b:	e8 8c 22 00 00       	call   80250c <fs_bcstat>
+	report("write     ", read_tsc() - tsc, sys_time_msec() - start,
+  800280:	e8 a0 13 00 00       	call   801625 <sys_time_msec>
+  800285:	89 c1                	mov    %eax,%ecx
+  800287:	0f 31                	rdtsc
+  800289:	2b 85 38 fe ff ff    	sub    -0x1c8(%ebp),%eax
+  80028f:	1b 95 3c fe ff ff    	sbb    -0x1c4(%ebp),%edx
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	53                   	push   %ebx
+  800299:	8d 9d b4 fe ff ff    	lea    -0x14c(%ebp),%ebx
+  80029f:	53                   	push   %ebx
+  8002a0:	29 f9                	sub    %edi,%ecx
+  8002a2:	51                   	push   %ecx
+  8002a3:	89 d1                	mov    %edx,%ecx
+  8002a5:	89 c2                	mov    %eax,%edx
+  8002a7:	b8 15 54 80 00       	mov    $0x805415,%eax
+  8002ac:	e8 82 fd ff ff       	call   800033 <report>
+		panic("open %s: %e", FILENAME, fd);
+
+	bench_write(fd);
+
+	if ((r = fs_bcstat(COLDCACHE, NULL)) < 0)
+  8002b1:	83 c4 08             	add    $0x8,%esp
+  8002b4:	6a 00                	push   $0x0
+  8002b6:	6a 20                	push   $0x20
+  8002b8:	e8 4f 22 00 00       	call   80250c <fs_bcstat>
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	85 c0                	test   %eax,%eax
+  8002c2:	0f 88 5d 01 00 00    	js     800425 <umain+0x293>
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+	for (i = 0; i < NBLOCKS; i++)
+  8002c8:	b8 00 00 00 00       	mov    $0x0,%eax
+		order[i] = i;
+  8002cd:	89 04 85 00 f0 90 00 	mov    %eax,0x90f000(,%eax,4)
+	for (i = 0; i < NBLOCKS; i++)
+  8002d4:	83 c0 01             	add    $0x1,%eax
+  8002d7:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8002dc:	75 ef                	jne    8002cd <umain+0x13b>
+	bench_read(fd, "sequential", order);
+  8002de:	b9 00 f0 90 00       	mov    $0x90f000,%ecx
+  8002e3:	ba 31 54 80 00       	mov    $0x805431,%edx
+  8002e8:	8b 85 44 fe ff ff    	mov    -0x1bc(%ebp),%eax
+  8002ee:	e8 97 fd ff ff       	call   80008a <bench_read>
+  8002f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (i = 0; i < NBLOCKS; i++)
+  8002f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		order[i] = (i * 97) % NBLOCKS;
+  8002fd:	89 da                	mov    %ebx,%edx
+  8002ff:	c1 fa 1f             	sar    $0x1f,%edx
+  800302:	c1 ea 18             	shr    $0x18,%edx
+  800305:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800308:	0f b6 c0             	movzbl %al,%eax
+  80030b:	29 d0                	sub    %edx,%eax
+  80030d:	89 04 8d 00 f0 90 00 	mov    %eax,0x90f000(,%ecx,4)
+	for (i = 0; i < NBLOCKS; i++)
+  800314:	83 c1 01             	add    $0x1,%ecx
+  800317:	83 c3 61             	add    $0x61,%ebx
+  80031a:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  800320:	75 db                	jne    8002fd <umain+0x16b>
+	bench_read(fd, "scattered ", order);
+  800322:	b9 00 f0 90 00       	mov    $0x90f000,%ecx
+  800327:	ba 3c 54 80 00       	mov    $0x80543c,%edx
+  80032c:	8b 85 44 fe ff ff    	mov    -0x1bc(%ebp),%eax
+  800332:	e8 53 fd ff ff       	call   80008a <bench_read>
+		free_slots[nfree] = nfree;
+  800337:	c7 85 58 fe ff ff 00 	movl   $0x0,-0x1a8(%ebp)
+  80033e:	00 00 00 
+  800341:	c7 85 5c fe ff ff 01 	movl   $0x1,-0x1a4(%ebp)
+  800348:	00 00 00 
+  80034b:	c7 85 60 fe ff ff 02 	movl   $0x2,-0x1a0(%ebp)
+  800352:	00 00 00 
+  800355:	c7 85 64 fe ff ff 03 	movl   $0x3,-0x19c(%ebp)
+  80035c:	00 00 00 
+  80035f:	c7 85 68 fe ff ff 04 	movl   $0x4,-0x198(%ebp)
+  800366:	00 00 00 
+  800369:	c7 85 6c fe ff ff 05 	movl   $0x5,-0x194(%ebp)
+  800370:	00 00 00 
+  800373:	c7 85 70 fe ff ff 06 	movl   $0x6,-0x190(%ebp)
+  80037a:	00 00 00 
+  80037d:	c7 85 74 fe ff ff 07 	movl   $0x7,-0x18c(%ebp)
+  800384:	00 00 00 
+	fs_bcstat(0, &before);
+  800387:	83 ec 08             	sub    $0x8,%esp
+  80038a:	8d 85 78 fe ff ff    	lea    -0x188(%ebp),%eax
+  800390:	50                   	push   %eax
+  800391:	6a 00                	push   $0x0
+  800393:	e8 74 21 00 00       	call   80250c <fs_bcstat>
+	start = sys_time_msec();
+  800398:	e8 88 12 00 00       	call   801625 <sys_time_msec>
+  80039d:	89 c7                	mov    %eax,%edi
+  80039f:	0f 31                	rdtsc
+  8003a1:	89 85 30 fe ff ff    	mov    %eax,-0x1d0(%ebp)
+  8003a7:	89 95 34 fe ff ff    	mov    %edx,-0x1cc(%ebp)
+	for (issued = done = 0; done < NBLOCKS; done++) {
+  8003ad:	83 c4 10             	add    $0x10,%esp
+  8003b0:	c7 85 38 fe ff ff 01 	movl   $0x101,-0x1c8(%ebp)
+  8003b7:	01 00 00 
+  8003ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8003bf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8003c4:	89 bd 40 fe ff ff    	mov    %edi,-0x1c0(%ebp)
+  8003ca:	e9 e4 00 00 00       	jmp    8004b3 <umain+0x321>
+		panic("fs_bcstat: %e", r);
+  8003cf:	50                   	push   %eax
+  8003d0:	68 df 53 80 00       	push   $0x8053df
+  8003d5:	68 ad 00 00 00       	push   $0xad
+  8003da:	68 d0 53 80 00       	push   $0x8053d0
+  8003df:	e8 b7 04 00 00       	call   80089b <_panic>
+		panic("open %s: %e", FILENAME, fd);
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	50                   	push   %eax
+  8003e8:	68 ed 53 80 00       	push   $0x8053ed
+  8003ed:	68 f6 53 80 00       	push   $0x8053f6
+  8003f2:	68 af 00 00 00       	push   $0xaf
+  8003f7:	68 d0 53 80 00       	push   $0x8053d0
+  8003fc:	e8 9a 04 00 00       	call   80089b <_panic>
+			panic("write: %e", r);
+  800401:	50                   	push   %eax
+  800402:	68 02 54 80 00       	push   $0x805402
+  800407:	6a 2e                	push   $0x2e
+  800409:	68 d0 53 80 00       	push   $0x8053d0
+  80040e:	e8 88 04 00 00       	call   80089b <_panic>
+		panic("sync: %e", r);
+  800413:	50                   	push   %eax
+  800414:	68 0c 54 80 00       	push   $0x80540c
+  800419:	6a 30                	push   $0x30
+  80041b:	68 d0 53 80 00       	push   $0x8053d0
+  800420:	e8 76 04 00 00       	call   80089b <_panic>
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+  800425:	83 ec 0c             	sub    $0xc,%esp
+  800428:	50                   	push   %eax
+  800429:	6a 20                	push   $0x20
+  80042b:	68 20 54 80 00       	push   $0x805420
+  800430:	68 b4 00 00 00       	push   $0xb4
+  800435:	68 d0 53 80 00       	push   $0x8053d0
+  80043a:	e8 5c 04 00 00       	call   80089b <_panic>
+				panic("aio_read block %d: %e", order[issued], id);
+  80043f:	83 ec 0c             	sub    $0xc,%esp
+  800442:	50                   	push   %eax
+  800443:	ff 34 b5 00 f0 90 00 	push   0x90f000(,%esi,4)
+  80044a:	68 47 54 80 00       	push   $0x805447
+  80044f:	6a 65                	push   $0x65
+  800451:	68 d0 53 80 00       	push   $0x8053d0
+  800456:	e8 40 04 00 00       	call   80089b <_panic>
+		if ((r = aio_reap(&id)) != BLKSIZE)
+  80045b:	83 ec 0c             	sub    $0xc,%esp
+  80045e:	8d 85 54 fe ff ff    	lea    -0x1ac(%ebp),%eax
+  800464:	50                   	push   %eax
+  800465:	e8 cb 25 00 00       	call   802a35 <aio_reap>
+  80046a:	83 c4 10             	add    $0x10,%esp
+  80046d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800472:	0f 85 b0 00 00 00    	jne    800528 <umain+0x396>
+		slot = slot_of[id];
+  800478:	8b 85 54 fe ff ff    	mov    -0x1ac(%ebp),%eax
+  80047e:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+		if (bufs[slot][0] != 0x5a || bufs[slot][BLKSIZE - 1] != 0x5a)
+  800485:	89 c2                	mov    %eax,%edx
+  800487:	c1 e2 0c             	shl    $0xc,%edx
+  80048a:	80 ba 00 70 90 00 5a 	cmpb   $0x5a,0x907000(%edx)
+  800491:	0f 85 a3 00 00 00    	jne    80053a <umain+0x3a8>
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	c1 e2 0c             	shl    $0xc,%edx
+  80049c:	80 ba ff 7f 90 00 5a 	cmpb   $0x5a,0x907fff(%edx)
+  8004a3:	0f 85 91 00 00 00    	jne    80053a <umain+0x3a8>
+		free_slots[nfree++] = slot;
+  8004a9:	89 84 9d 58 fe ff ff 	mov    %eax,-0x1a8(%ebp,%ebx,4)
+  8004b0:	8d 5b 01             	lea    0x1(%ebx),%ebx
+	for (issued = done = 0; done < NBLOCKS; done++) {
+  8004b3:	83 ad 38 fe ff ff 01 	subl   $0x1,-0x1c8(%ebp)
+  8004ba:	0f 84 8e 00 00 00    	je     80054e <umain+0x3bc>
+		for (; issued < NBLOCKS && nfree > 0; issued++) {
+  8004c0:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8004c6:	7f 93                	jg     80045b <umain+0x2c9>
+  8004c8:	85 db                	test   %ebx,%ebx
+  8004ca:	7e 8f                	jle    80045b <umain+0x2c9>
+			slot = free_slots[--nfree];
+  8004cc:	83 eb 01             	sub    $0x1,%ebx
+  8004cf:	8b bc 9d 58 fe ff ff 	mov    -0x1a8(%ebp,%ebx,4),%edi
+			bufs[slot][0] = bufs[slot][BLKSIZE - 1] = 0;
+  8004d6:	89 f8                	mov    %edi,%eax
+  8004d8:	c1 e0 0c             	shl    $0xc,%eax
+  8004db:	8d 90 00 70 90 00    	lea    0x907000(%eax),%edx
+  8004e1:	c6 80 ff 7f 90 00 00 	movb   $0x0,0x907fff(%eax)
+  8004e8:	c6 80 00 70 90 00 00 	movb   $0x0,0x907000(%eax)
+			if ((id = aio_read(fd, bufs[slot], BLKSIZE, order[issued] * BLKSIZE)) < 0)
+  8004ef:	8b 04 b5 00 f0 90 00 	mov    0x90f000(,%esi,4),%eax
+  8004f6:	c1 e0 0c             	shl    $0xc,%eax
+  8004f9:	50                   	push   %eax
+  8004fa:	68 00 10 00 00       	push   $0x1000
+  8004ff:	52                   	push   %edx
+  800500:	ff b5 44 fe ff ff    	push   -0x1bc(%ebp)
+  800506:	e8 ea 23 00 00       	call   8028f5 <aio_read>
+  80050b:	89 85 54 fe ff ff    	mov    %eax,-0x1ac(%ebp)
+  800511:	83 c4 10             	add    $0x10,%esp
+  800514:	85 c0                	test   %eax,%eax
+  800516:	0f 88 23 ff ff ff    	js     80043f <umain+0x2ad>
+			slot_of[id] = slot;
+  80051c:	89 bc 85 f0 fe ff ff 	mov    %edi,-0x110(%ebp,%eax,4)
+		for (; issued < NBLOCKS && nfree > 0; issued++) {
+  800523:	83 c6 01             	add    $0x1,%esi
+  800526:	eb 98                	jmp    8004c0 <umain+0x32e>
+			panic("aio read: got %d", r);
+  800528:	50                   	push   %eax
+  800529:	68 5d 54 80 00       	push   $0x80545d
+  80052e:	6a 69                	push   $0x69
+  800530:	68 d0 53 80 00       	push   $0x8053d0
+  800535:	e8 61 03 00 00       	call   80089b <_panic>
+			panic("aio read: bad data");
+  80053a:	83 ec 04             	sub    $0x4,%esp
+  80053d:	68 6e 54 80 00       	push   $0x80546e
+  800542:	6a 6c                	push   $0x6c
+  800544:	68 d0 53 80 00       	push   $0x8053d0
+  800549:	e8 4d 03 00 00       	call   80089b <_panic>
+	fs_bcstat(0, &after);
+  80054e:	8b bd 40 fe ff ff    	mov    -0x1c0(%ebp),%edi
+  800554:	83 ec 08             	sub    $0x8,%esp
+  800557:	8d 9d b4 fe ff ff    	lea    -0x14c(%ebp),%ebx
+  80055d:	53                   	push   %ebx
+  80055e:	6a 00                	push   $0x0
+  800560:	e8 a7 1f 00 00       	call   80250c <fs_bcstat>
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+  800565:	e8 bb 10 00 00       	call   801625 <sys_time_msec>
+  80056a:	89 c1                	mov    %eax,%ecx
+  80056c:	0f 31                	rdtsc
+  80056e:	2b 85 30 fe ff ff    	sub    -0x1d0(%ebp),%eax
+  800574:	1b 95 34 fe ff ff    	sbb    -0x1cc(%ebp),%edx
+  80057a:	83 c4 0c             	add    $0xc,%esp
+  80057d:	53                   	push   %ebx
+  80057e:	8d b5 78 fe ff ff    	lea    -0x188(%ebp),%esi
+  800584:	56                   	push   %esi
+  800585:	29 f9                	sub    %edi,%ecx
+  800587:	51                   	push   %ecx
+  800588:	89 d1                	mov    %edx,%ecx
+  80058a:	89 c2                	mov    %eax,%edx
+  80058c:	b8 81 54 80 00       	mov    $0x805481,%eax
+  800591:	e8 9d fa ff ff       	call   800033 <report>
+	fs_bcstat(0, &before);
+  800596:	83 c4 08             	add    $0x8,%esp
+  800599:	53                   	push   %ebx
+  80059a:	6a 00                	push   $0x0
+  80059c:	e8 6b 1f 00 00       	call   80250c <fs_bcstat>
+	start = sys_time_msec();
+  8005a1:	e8 7f 10 00 00       	call   801625 <sys_time_msec>
+  8005a6:	89 c3                	mov    %eax,%ebx
+  8005a8:	0f 31                	rdtsc
+  8005aa:	89 85 38 fe ff ff    	mov    %eax,-0x1c8(%ebp)
+  8005b0:	89 95 3c fe ff ff    	mov    %edx,-0x1c4(%ebp)
+	seek(fd, 0);
+  8005b6:	83 c4 08             	add    $0x8,%esp
+  8005b9:	6a 00                	push   $0x0
+  8005bb:	8b bd 44 fe ff ff    	mov    -0x1bc(%ebp),%edi
+  8005c1:	57                   	push   %edi
+  8005c2:	e8 24 17 00 00       	call   801ceb <seek>
+	if ((r = readn(fd, big, FILESIZE)) != FILESIZE)
+  8005c7:	83 c4 0c             	add    $0xc,%esp
+  8005ca:	68 00 00 10 00       	push   $0x100000
+  8005cf:	68 00 70 80 00       	push   $0x807000
+  8005d4:	57                   	push   %edi
+  8005d5:	e8 1e 16 00 00       	call   801bf8 <readn>
+  8005da:	83 c4 10             	add    $0x10,%esp
+  8005dd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8005e2:	0f 85 95 01 00 00    	jne    80077d <umain+0x5eb>
+	fs_bcstat(0, &after);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	8d b5 f0 fe ff ff    	lea    -0x110(%ebp),%esi
+  8005f1:	56                   	push   %esi
+  8005f2:	6a 00                	push   $0x0
+  8005f4:	e8 13 1f 00 00       	call   80250c <fs_bcstat>
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+  8005f9:	e8 27 10 00 00       	call   801625 <sys_time_msec>
+  8005fe:	89 c1                	mov    %eax,%ecx
+  800600:	0f 31                	rdtsc
+  800602:	2b 85 38 fe ff ff    	sub    -0x1c8(%ebp),%eax
+  800608:	1b 95 3c fe ff ff    	sbb    -0x1c4(%ebp),%edx
+  80060e:	83 c4 0c             	add    $0xc,%esp
+  800611:	56                   	push   %esi
+  800612:	8d b5 b4 fe ff ff    	lea    -0x14c(%ebp),%esi
+  800618:	56                   	push   %esi
+  800619:	29 d9                	sub    %ebx,%ecx
+  80061b:	51                   	push   %ecx
+  80061c:	89 d1                	mov    %edx,%ecx
+  80061e:	89 c2                	mov    %eax,%edx
+  800620:	b8 9e 54 80 00       	mov    $0x80549e,%eax
+  800625:	e8 09 fa ff ff       	call   800033 <report>
+  80062a:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < FILESIZE; i += BLKSIZE)
+  80062d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (big[i] != 0x5a)
+  800632:	80 b8 00 70 80 00 5a 	cmpb   $0x5a,0x807000(%eax)
+  800639:	0f 85 53 01 00 00    	jne    800792 <umain+0x600>
+	for (i = 0; i < FILESIZE; i += BLKSIZE)
+  80063f:	05 00 10 00 00       	add    $0x1000,%eax
+  800644:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800649:	75 e7                	jne    800632 <umain+0x4a0>
+	fs_bcstat(0, &before);
+  80064b:	83 ec 08             	sub    $0x8,%esp
+  80064e:	8d 85 b4 fe ff ff    	lea    -0x14c(%ebp),%eax
+  800654:	50                   	push   %eax
+  800655:	6a 00                	push   $0x0
+  800657:	e8 b0 1e 00 00       	call   80250c <fs_bcstat>
+	start = sys_time_msec();
+  80065c:	e8 c4 0f 00 00       	call   801625 <sys_time_msec>
+  800661:	89 85 38 fe ff ff    	mov    %eax,-0x1c8(%ebp)
+  800667:	0f 31                	rdtsc
+  800669:	89 c6                	mov    %eax,%esi
+  80066b:	89 d7                	mov    %edx,%edi
+	if ((p = mmap(fd, 0, FILESIZE, PROT_READ)) == NULL)
+  80066d:	6a 01                	push   $0x1
+  80066f:	68 00 00 10 00       	push   $0x100000
+  800674:	6a 00                	push   $0x0
+  800676:	ff b5 44 fe ff ff    	push   -0x1bc(%ebp)
+  80067c:	e8 84 1c 00 00       	call   802305 <mmap>
+  800681:	89 c3                	mov    %eax,%ebx
+  800683:	83 c4 20             	add    $0x20,%esp
+  800686:	85 c0                	test   %eax,%eax
+  800688:	0f 84 27 01 00 00    	je     8007b5 <umain+0x623>
+	for (i = 0; i < NBLOCKS; i++)
+  80068e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (p[order[i] * BLKSIZE] != 0x5a)
+  800693:	8b 14 85 00 f0 90 00 	mov    0x90f000(,%eax,4),%edx
+  80069a:	89 d1                	mov    %edx,%ecx
+  80069c:	c1 e1 0c             	shl    $0xc,%ecx
+  80069f:	80 3c 0b 5a          	cmpb   $0x5a,(%ebx,%ecx,1)
+  8006a3:	0f 85 25 01 00 00    	jne    8007ce <umain+0x63c>
+	for (i = 0; i < NBLOCKS; i++)
+  8006a9:	83 c0 01             	add    $0x1,%eax
+  8006ac:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8006b1:	75 e0                	jne    800693 <umain+0x501>
+	if ((r = munmap(p, FILESIZE)) < 0)
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	68 00 00 10 00       	push   $0x100000
+  8006bb:	53                   	push   %ebx
+  8006bc:	e8 05 1c 00 00       	call   8022c6 <munmap>
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	85 c0                	test   %eax,%eax
+  8006c6:	0f 88 17 01 00 00    	js     8007e3 <umain+0x651>
+	fs_bcstat(0, &after);
+  8006cc:	83 ec 08             	sub    $0x8,%esp
+  8006cf:	8d 9d f0 fe ff ff    	lea    -0x110(%ebp),%ebx
+  8006d5:	53                   	push   %ebx
+  8006d6:	6a 00                	push   $0x0
+  8006d8:	e8 2f 1e 00 00       	call   80250c <fs_bcstat>
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+  8006dd:	e8 43 0f 00 00       	call   801625 <sys_time_msec>
+  8006e2:	89 c1                	mov    %eax,%ecx
+  8006e4:	0f 31                	rdtsc
+  8006e6:	29 f0                	sub    %esi,%eax
+  8006e8:	19 fa                	sbb    %edi,%edx
+  8006ea:	83 c4 0c             	add    $0xc,%esp
+  8006ed:	53                   	push   %ebx
+  8006ee:	8d 9d b4 fe ff ff    	lea    -0x14c(%ebp),%ebx
+  8006f4:	53                   	push   %ebx
+  8006f5:	8b bd 38 fe ff ff    	mov    -0x1c8(%ebp),%edi
+  8006fb:	29 f9                	sub    %edi,%ecx
+  8006fd:	51                   	push   %ecx
+  8006fe:	89 d1                	mov    %edx,%ecx
+  800700:	89 c2                	mov    %eax,%edx
+  800702:	b8 f8 54 80 00       	mov    $0x8054f8,%eax
+  800707:	e8 27 f9 ff ff       	call   800033 <report>
+	bench_aio(fd, "aio       ", order);
+	bench_bulk(fd, "bulk      ");
+	bench_mmap(fd, "mmap      ", order);
+
+	fs_bcstat(0, &after);
+  80070c:	83 c4 08             	add    $0x8,%esp
+  80070f:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+  800715:	50                   	push   %eax
+  800716:	6a 00                	push   $0x0
+  800718:	e8 ef 1d 00 00       	call   80250c <fs_bcstat>
+	cprintf("I/O queue: %d requests, %d merged, %d transfers, "
+  80071d:	83 c4 0c             	add    $0xc,%esp
+  800720:	ff 75 a8             	push   -0x58(%ebp)
+  800723:	ff 75 a4             	push   -0x5c(%ebp)
+  800726:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  800729:	2b 45 dc             	sub    -0x24(%ebp),%eax
+  80072c:	50                   	push   %eax
+  80072d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  800730:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  800733:	50                   	push   %eax
+  800734:	8b 45 98             	mov    -0x68(%ebp),%eax
+  800737:	2b 45 d4             	sub    -0x2c(%ebp),%eax
+  80073a:	50                   	push   %eax
+  80073b:	8b 45 94             	mov    -0x6c(%ebp),%eax
+  80073e:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  800741:	50                   	push   %eax
+  800742:	68 64 53 80 00       	push   $0x805364
+  800747:	e8 2a 02 00 00       	call   800976 <cprintf>
+		after.bs_ioqueued - st.bs_ioqueued,
+		after.bs_iomerged - st.bs_iomerged,
+		after.bs_iodispatched - st.bs_iodispatched,
+		after.bs_ioexpired - st.bs_ioexpired,
+		after.bs_iodepth, after.bs_iomaxdepth);
+	fs_bcstat(st.bs_budget, NULL);
+  80074c:	83 c4 18             	add    $0x18,%esp
+  80074f:	6a 00                	push   $0x0
+  800751:	ff 75 cc             	push   -0x34(%ebp)
+  800754:	e8 b3 1d 00 00       	call   80250c <fs_bcstat>
+	ftruncate(fd, 0);
+  800759:	83 c4 08             	add    $0x8,%esp
+  80075c:	6a 00                	push   $0x0
+  80075e:	8b bd 44 fe ff ff    	mov    -0x1bc(%ebp),%edi
+  800764:	57                   	push   %edi
+  800765:	e8 aa 15 00 00       	call   801d14 <ftruncate>
+	close(fd);
+  80076a:	89 3c 24             	mov    %edi,(%esp)
+  80076d:	e8 99 12 00 00       	call   801a0b <close>
+}
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800778:	5b                   	pop    %ebx
+  800779:	5e                   	pop    %esi
+  80077a:	5f                   	pop    %edi
+  80077b:	5d                   	pop    %ebp
+  80077c:	c3                   	ret
+		panic("bulk read: got %d", r);
+  80077d:	50                   	push   %eax
+  80077e:	68 8c 54 80 00       	push   $0x80548c
+  800783:	68 83 00 00 00       	push   $0x83
+  800788:	68 d0 53 80 00       	push   $0x8053d0
+  80078d:	e8 09 01 00 00       	call   80089b <_panic>
+			panic("bulk read block %d: bad data", i / BLKSIZE);
+  800792:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800798:	85 c0                	test   %eax,%eax
+  80079a:	0f 48 c2             	cmovs  %edx,%eax
+  80079d:	c1 f8 0c             	sar    $0xc,%eax
+  8007a0:	50                   	push   %eax
+  8007a1:	68 a9 54 80 00       	push   $0x8054a9
+  8007a6:	68 89 00 00 00       	push   $0x89
+  8007ab:	68 d0 53 80 00       	push   $0x8053d0
+  8007b0:	e8 e6 00 00 00       	call   80089b <_panic>
+		panic("mmap %s failed", FILENAME);
+  8007b5:	68 ed 53 80 00       	push   $0x8053ed
+  8007ba:	68 c6 54 80 00       	push   $0x8054c6
+  8007bf:	68 9a 00 00 00       	push   $0x9a
+  8007c4:	68 d0 53 80 00       	push   $0x8053d0
+  8007c9:	e8 cd 00 00 00       	call   80089b <_panic>
+			panic("mmap block %d: bad data", order[i]);
+  8007ce:	52                   	push   %edx
+  8007cf:	68 d5 54 80 00       	push   $0x8054d5
+  8007d4:	68 9d 00 00 00       	push   $0x9d
+  8007d9:	68 d0 53 80 00       	push   $0x8053d0
+  8007de:	e8 b8 00 00 00       	call   80089b <_panic>
+		panic("munmap: %e", r);
+  8007e3:	50                   	push   %eax
+  8007e4:	68 ed 54 80 00       	push   $0x8054ed
+  8007e9:	68 9f 00 00 00       	push   $0x9f
+  8007ee:	68 d0 53 80 00       	push   $0x8053d0
+  8007f3:	e8 a3 00 00 00       	call   80089b <_panic>
+
+008007f8 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8007f8:	55                   	push   %ebp
+  8007f9:	89 e5                	mov    %esp,%ebp
+  8007fb:	57                   	push   %edi
+  8007fc:	56                   	push   %esi
+  8007fd:	53                   	push   %ebx
+  8007fe:	83 ec 1c             	sub    $0x1c,%esp
+  800801:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800804:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800807:	e8 34 0b 00 00       	call   801340 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80080c:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80080f:	89 15 80 08 91 00    	mov    %edx,0x910880
+	thisenv = &envs[ENVX(eid)];
+  800815:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80081a:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80081c:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80081e:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800824:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800829:	77 16                	ja     800841 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80082b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800830:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800832:	c1 e8 10             	shr    $0x10,%eax
+  800835:	74 0a                	je     800841 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800837:	c1 e0 10             	shl    $0x10,%eax
+  80083a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80083f:	29 c2                	sub    %eax,%edx
+  800841:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800844:	c1 e0 04             	shl    $0x4,%eax
+  800847:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80084c:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80084e:	85 db                	test   %ebx,%ebx
+  800850:	7e 07                	jle    800859 <libmain+0x61>
+		binaryname = argv[0];
+  800852:	8b 06                	mov    (%esi),%eax
+  800854:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800859:	83 ec 08             	sub    $0x8,%esp
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	e8 2f f9 ff ff       	call   800192 <umain>
+
+	// exit gracefully
+	exit();
+  800863:	e8 0b 00 00 00       	call   800873 <exit>
+}
+  800868:	83 c4 10             	add    $0x10,%esp
+  80086b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086e:	5b                   	pop    %ebx
+  80086f:	5e                   	pop    %esi
+  800870:	5f                   	pop    %edi
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800879:	6a 00                	push   $0x0
+  80087b:	e8 8d 25 00 00       	call   802e0d <fflush>
+	pthread_kill_others();
+  800880:	e8 f8 3b 00 00       	call   80447d <pthread_kill_others>
+	close_all();
+  800885:	e8 ae 11 00 00       	call   801a38 <close_all>
+	sys_env_destroy(0);
+  80088a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800891:	e8 5f 0a 00 00       	call   8012f5 <sys_env_destroy>
+}
+  800896:	83 c4 10             	add    $0x10,%esp
+  800899:	c9                   	leave
+  80089a:	c3                   	ret
+
+0080089b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	56                   	push   %esi
+  80089f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8008a0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8008a3:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8008a9:	e8 92 0a 00 00       	call   801340 <sys_getenvid>
+  8008ae:	83 ec 0c             	sub    $0xc,%esp
+  8008b1:	ff 75 0c             	push   0xc(%ebp)
+  8008b4:	ff 75 08             	push   0x8(%ebp)
+  8008b7:	56                   	push   %esi
+  8008b8:	50                   	push   %eax
+  8008b9:	68 10 55 80 00       	push   $0x805510
+  8008be:	e8 b3 00 00 00       	call   800976 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008c3:	83 c4 18             	add    $0x18,%esp
+  8008c6:	53                   	push   %ebx
+  8008c7:	ff 75 10             	push   0x10(%ebp)
+  8008ca:	e8 56 00 00 00       	call   800925 <vcprintf>
+	cprintf("\n");
+  8008cf:	c7 04 24 fe 5b 80 00 	movl   $0x805bfe,(%esp)
+  8008d6:	e8 9b 00 00 00       	call   800976 <cprintf>
+  8008db:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008de:	cc                   	int3
+	while (1)
+  8008df:	eb fd                	jmp    8008de <_panic+0x43>
+
+008008e1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	53                   	push   %ebx
+  8008e5:	83 ec 04             	sub    $0x4,%esp
+  8008e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008eb:	8b 13                	mov    (%ebx),%edx
+  8008ed:	8d 42 01             	lea    0x1(%edx),%eax
+  8008f0:	89 03                	mov    %eax,(%ebx)
+  8008f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008f9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008fe:	74 09                	je     800909 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800900:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800904:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800909:	83 ec 08             	sub    $0x8,%esp
+  80090c:	68 ff 00 00 00       	push   $0xff
+  800911:	8d 43 08             	lea    0x8(%ebx),%eax
+  800914:	50                   	push   %eax
+  800915:	e8 84 09 00 00       	call   80129e <sys_cputs>
+		b->idx = 0;
+  80091a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800920:	83 c4 10             	add    $0x10,%esp
+  800923:	eb db                	jmp    800900 <putch+0x1f>
+
+00800925 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80092e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800935:	00 00 00 
+	b.cnt = 0;
+  800938:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80093f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800942:	ff 75 0c             	push   0xc(%ebp)
+  800945:	ff 75 08             	push   0x8(%ebp)
+  800948:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80094e:	50                   	push   %eax
+  80094f:	68 e1 08 80 00       	push   $0x8008e1
+  800954:	e8 14 01 00 00       	call   800a6d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800959:	83 c4 08             	add    $0x8,%esp
+  80095c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800962:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800968:	50                   	push   %eax
+  800969:	e8 30 09 00 00       	call   80129e <sys_cputs>
+
+	return b.cnt;
+}
+  80096e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+00800976 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80097c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80097f:	50                   	push   %eax
+  800980:	ff 75 08             	push   0x8(%ebp)
+  800983:	e8 9d ff ff ff       	call   800925 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800988:	c9                   	leave
+  800989:	c3                   	ret
+
+0080098a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	57                   	push   %edi
+  80098e:	56                   	push   %esi
+  80098f:	53                   	push   %ebx
+  800990:	83 ec 1c             	sub    $0x1c,%esp
+  800993:	89 c7                	mov    %eax,%edi
+  800995:	89 d6                	mov    %edx,%esi
+  800997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099d:	89 d1                	mov    %edx,%ecx
+  80099f:	89 c2                	mov    %eax,%edx
+  8009a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009a7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009aa:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8009ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009b0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8009b7:	39 c2                	cmp    %eax,%edx
+  8009b9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8009bc:	72 3e                	jb     8009fc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8009be:	83 ec 0c             	sub    $0xc,%esp
+  8009c1:	ff 75 18             	push   0x18(%ebp)
+  8009c4:	83 eb 01             	sub    $0x1,%ebx
+  8009c7:	53                   	push   %ebx
+  8009c8:	50                   	push   %eax
+  8009c9:	83 ec 08             	sub    $0x8,%esp
+  8009cc:	ff 75 e4             	push   -0x1c(%ebp)
+  8009cf:	ff 75 e0             	push   -0x20(%ebp)
+  8009d2:	ff 75 dc             	push   -0x24(%ebp)
+  8009d5:	ff 75 d8             	push   -0x28(%ebp)
+  8009d8:	e8 99 47 00 00       	call   805176 <__udivdi3>
+  8009dd:	83 c4 18             	add    $0x18,%esp
+  8009e0:	52                   	push   %edx
+  8009e1:	50                   	push   %eax
+  8009e2:	89 f2                	mov    %esi,%edx
+  8009e4:	89 f8                	mov    %edi,%eax
+  8009e6:	e8 9f ff ff ff       	call   80098a <printnum>
+  8009eb:	83 c4 20             	add    $0x20,%esp
+  8009ee:	eb 13                	jmp    800a03 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009f0:	83 ec 08             	sub    $0x8,%esp
+  8009f3:	56                   	push   %esi
+  8009f4:	ff 75 18             	push   0x18(%ebp)
+  8009f7:	ff d7                	call   *%edi
+  8009f9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009fc:	83 eb 01             	sub    $0x1,%ebx
+  8009ff:	85 db                	test   %ebx,%ebx
+  800a01:	7f ed                	jg     8009f0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800a03:	83 ec 08             	sub    $0x8,%esp
+  800a06:	56                   	push   %esi
+  800a07:	83 ec 04             	sub    $0x4,%esp
+  800a0a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a0d:	ff 75 e0             	push   -0x20(%ebp)
+  800a10:	ff 75 dc             	push   -0x24(%ebp)
+  800a13:	ff 75 d8             	push   -0x28(%ebp)
+  800a16:	e8 7c 47 00 00       	call   805197 <__umoddi3>
+  800a1b:	83 c4 14             	add    $0x14,%esp
+  800a1e:	0f be 80 33 55 80 00 	movsbl 0x805533(%eax),%eax
+  800a25:	50                   	push   %eax
+  800a26:	ff d7                	call   *%edi
+}
+  800a28:	83 c4 10             	add    $0x10,%esp
+  800a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a2e:	5b                   	pop    %ebx
+  800a2f:	5e                   	pop    %esi
+  800a30:	5f                   	pop    %edi
+  800a31:	5d                   	pop    %ebp
+  800a32:	c3                   	ret
+
+00800a33 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a39:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a3d:	8b 10                	mov    (%eax),%edx
+  800a3f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a42:	73 0a                	jae    800a4e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a44:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a47:	89 08                	mov    %ecx,(%eax)
+  800a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4c:	88 02                	mov    %al,(%edx)
+}
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <printfmt>:
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a56:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a59:	50                   	push   %eax
+  800a5a:	ff 75 10             	push   0x10(%ebp)
+  800a5d:	ff 75 0c             	push   0xc(%ebp)
+  800a60:	ff 75 08             	push   0x8(%ebp)
+  800a63:	e8 05 00 00 00       	call   800a6d <vprintfmt>
+}
+  800a68:	83 c4 10             	add    $0x10,%esp
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+
+00800a6d <vprintfmt>:
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	83 ec 2c             	sub    $0x2c,%esp
+  800a76:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a7f:	eb 0a                	jmp    800a8b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a81:	83 ec 08             	sub    $0x8,%esp
+  800a84:	53                   	push   %ebx
+  800a85:	50                   	push   %eax
+  800a86:	ff d6                	call   *%esi
+  800a88:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800a8b:	83 c7 01             	add    $0x1,%edi
+  800a8e:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800a92:	83 f8 25             	cmp    $0x25,%eax
+  800a95:	74 0c                	je     800aa3 <vprintfmt+0x36>
+			if (ch == '\0')
+  800a97:	85 c0                	test   %eax,%eax
+  800a99:	75 e6                	jne    800a81 <vprintfmt+0x14>
+}
+  800a9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a9e:	5b                   	pop    %ebx
+  800a9f:	5e                   	pop    %esi
+  800aa0:	5f                   	pop    %edi
+  800aa1:	5d                   	pop    %ebp
+  800aa2:	c3                   	ret
+		padc = ' ';
+  800aa3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800aa7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800aae:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800ab5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800abc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800ac1:	8d 47 01             	lea    0x1(%edi),%eax
+  800ac4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ac7:	0f b6 17             	movzbl (%edi),%edx
+  800aca:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800acd:	3c 55                	cmp    $0x55,%al
+  800acf:	0f 87 c5 03 00 00    	ja     800e9a <vprintfmt+0x42d>
+  800ad5:	0f b6 c0             	movzbl %al,%eax
+  800ad8:	ff 24 85 c0 56 80 00 	jmp    *0x8056c0(,%eax,4)
+  800adf:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800ae2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ae5:	eb da                	jmp    800ac1 <vprintfmt+0x54>
+  800ae7:	0f be d2             	movsbl %dl,%edx
+  800aea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800af5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800af8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800afc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800aff:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800b02:	83 f9 09             	cmp    $0x9,%ecx
+  800b05:	77 55                	ja     800b5c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800b07:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800b0a:	eb e9                	jmp    800af5 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800b0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0f:	8b 00                	mov    (%eax),%eax
+  800b11:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b14:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b17:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800b1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800b20:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b24:	79 9b                	jns    800ac1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800b26:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b29:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b2c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b33:	eb 8c                	jmp    800ac1 <vprintfmt+0x54>
+			if (width < 0)
+  800b35:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b38:	85 d2                	test   %edx,%edx
+  800b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3f:	0f 49 c2             	cmovns %edx,%eax
+  800b42:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800b45:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b48:	e9 74 ff ff ff       	jmp    800ac1 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800b4d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b50:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b57:	e9 65 ff ff ff       	jmp    800ac1 <vprintfmt+0x54>
+  800b5c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b5f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b62:	eb bc                	jmp    800b20 <vprintfmt+0xb3>
+			lflag++;
+  800b64:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800b67:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b6a:	e9 52 ff ff ff       	jmp    800ac1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b72:	8d 78 04             	lea    0x4(%eax),%edi
+  800b75:	83 ec 08             	sub    $0x8,%esp
+  800b78:	53                   	push   %ebx
+  800b79:	ff 30                	push   (%eax)
+  800b7b:	ff d6                	call   *%esi
+			break;
+  800b7d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800b80:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b83:	e9 b1 02 00 00       	jmp    800e39 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800b88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b8e:	8b 10                	mov    (%eax),%edx
+  800b90:	89 d0                	mov    %edx,%eax
+  800b92:	f7 d8                	neg    %eax
+  800b94:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b97:	83 f8 14             	cmp    $0x14,%eax
+  800b9a:	7f 23                	jg     800bbf <vprintfmt+0x152>
+  800b9c:	8b 14 85 20 58 80 00 	mov    0x805820(,%eax,4),%edx
+  800ba3:	85 d2                	test   %edx,%edx
+  800ba5:	74 18                	je     800bbf <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800ba7:	52                   	push   %edx
+  800ba8:	68 8f 59 80 00       	push   $0x80598f
+  800bad:	53                   	push   %ebx
+  800bae:	56                   	push   %esi
+  800baf:	e8 9c fe ff ff       	call   800a50 <printfmt>
+  800bb4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bb7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800bba:	e9 7a 02 00 00       	jmp    800e39 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800bbf:	50                   	push   %eax
+  800bc0:	68 4b 55 80 00       	push   $0x80554b
+  800bc5:	53                   	push   %ebx
+  800bc6:	56                   	push   %esi
+  800bc7:	e8 84 fe ff ff       	call   800a50 <printfmt>
+  800bcc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bcf:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bd2:	e9 62 02 00 00       	jmp    800e39 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bda:	83 c0 04             	add    $0x4,%eax
+  800bdd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800be0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800be5:	85 c9                	test   %ecx,%ecx
+  800be7:	b8 44 55 80 00       	mov    $0x805544,%eax
+  800bec:	0f 45 c1             	cmovne %ecx,%eax
+  800bef:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800bf2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800bf6:	7e 06                	jle    800bfe <vprintfmt+0x191>
+  800bf8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800bfc:	75 0b                	jne    800c09 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bfe:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800c01:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800c04:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c07:	eb 5c                	jmp    800c65 <vprintfmt+0x1f8>
+  800c09:	83 ec 08             	sub    $0x8,%esp
+  800c0c:	ff 75 d0             	push   -0x30(%ebp)
+  800c0f:	ff 75 cc             	push   -0x34(%ebp)
+  800c12:	e8 20 03 00 00       	call   800f37 <strnlen>
+  800c17:	89 c2                	mov    %eax,%edx
+  800c19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c1c:	29 d0                	sub    %edx,%eax
+  800c1e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800c21:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800c25:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c28:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c2b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c2d:	eb 0e                	jmp    800c3d <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800c2f:	83 ec 08             	sub    $0x8,%esp
+  800c32:	53                   	push   %ebx
+  800c33:	57                   	push   %edi
+  800c34:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c37:	83 ee 01             	sub    $0x1,%esi
+  800c3a:	83 c4 10             	add    $0x10,%esp
+  800c3d:	85 f6                	test   %esi,%esi
+  800c3f:	7f ee                	jg     800c2f <vprintfmt+0x1c2>
+  800c41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c44:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c47:	85 c0                	test   %eax,%eax
+  800c49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4e:	0f 49 d0             	cmovns %eax,%edx
+  800c51:	29 d0                	sub    %edx,%eax
+  800c53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c56:	eb a6                	jmp    800bfe <vprintfmt+0x191>
+					putch(ch, putdat);
+  800c58:	83 ec 08             	sub    $0x8,%esp
+  800c5b:	53                   	push   %ebx
+  800c5c:	52                   	push   %edx
+  800c5d:	ff 55 08             	call   *0x8(%ebp)
+  800c60:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c63:	89 f1                	mov    %esi,%ecx
+  800c65:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c68:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c6c:	0f be d0             	movsbl %al,%edx
+  800c6f:	85 d2                	test   %edx,%edx
+  800c71:	74 28                	je     800c9b <vprintfmt+0x22e>
+  800c73:	85 ff                	test   %edi,%edi
+  800c75:	78 05                	js     800c7c <vprintfmt+0x20f>
+  800c77:	83 ef 01             	sub    $0x1,%edi
+  800c7a:	78 30                	js     800cac <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c7c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800c80:	74 d6                	je     800c58 <vprintfmt+0x1eb>
+  800c82:	0f be c0             	movsbl %al,%eax
+  800c85:	83 e8 20             	sub    $0x20,%eax
+  800c88:	83 f8 5e             	cmp    $0x5e,%eax
+  800c8b:	76 cb                	jbe    800c58 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800c8d:	83 ec 08             	sub    $0x8,%esp
+  800c90:	53                   	push   %ebx
+  800c91:	6a 3f                	push   $0x3f
+  800c93:	ff 55 08             	call   *0x8(%ebp)
+  800c96:	83 c4 10             	add    $0x10,%esp
+  800c99:	eb c8                	jmp    800c63 <vprintfmt+0x1f6>
+  800c9b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c9e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ca1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800ca4:	01 d0                	add    %edx,%eax
+  800ca6:	29 c8                	sub    %ecx,%eax
+  800ca8:	89 c7                	mov    %eax,%edi
+  800caa:	eb 13                	jmp    800cbf <vprintfmt+0x252>
+  800cac:	8b 75 08             	mov    0x8(%ebp),%esi
+  800caf:	eb ed                	jmp    800c9e <vprintfmt+0x231>
+				putch(' ', putdat);
+  800cb1:	83 ec 08             	sub    $0x8,%esp
+  800cb4:	53                   	push   %ebx
+  800cb5:	6a 20                	push   $0x20
+  800cb7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800cb9:	83 ef 01             	sub    $0x1,%edi
+  800cbc:	83 c4 10             	add    $0x10,%esp
+  800cbf:	85 ff                	test   %edi,%edi
+  800cc1:	7f ee                	jg     800cb1 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800cc3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800cc6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cc9:	e9 6b 01 00 00       	jmp    800e39 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800cce:	83 f9 01             	cmp    $0x1,%ecx
+  800cd1:	7f 1f                	jg     800cf2 <vprintfmt+0x285>
+	else if (lflag)
+  800cd3:	85 c9                	test   %ecx,%ecx
+  800cd5:	74 67                	je     800d3e <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800cd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cda:	8b 00                	mov    (%eax),%eax
+  800cdc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cdf:	89 c1                	mov    %eax,%ecx
+  800ce1:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ce4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ce7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cea:	8d 40 04             	lea    0x4(%eax),%eax
+  800ced:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cf0:	eb 17                	jmp    800d09 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800cf2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cf5:	8b 50 04             	mov    0x4(%eax),%edx
+  800cf8:	8b 00                	mov    (%eax),%eax
+  800cfa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cfd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800d00:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d03:	8d 40 08             	lea    0x8(%eax),%eax
+  800d06:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800d09:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d0c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800d0f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800d14:	85 c9                	test   %ecx,%ecx
+  800d16:	0f 89 03 01 00 00    	jns    800e1f <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800d1c:	83 ec 08             	sub    $0x8,%esp
+  800d1f:	53                   	push   %ebx
+  800d20:	6a 2d                	push   $0x2d
+  800d22:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800d24:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d27:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d2a:	f7 da                	neg    %edx
+  800d2c:	83 d1 00             	adc    $0x0,%ecx
+  800d2f:	f7 d9                	neg    %ecx
+  800d31:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d34:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d39:	e9 e1 00 00 00       	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800d3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d41:	8b 00                	mov    (%eax),%eax
+  800d43:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d46:	89 c1                	mov    %eax,%ecx
+  800d48:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d4b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d51:	8d 40 04             	lea    0x4(%eax),%eax
+  800d54:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d57:	eb b0                	jmp    800d09 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800d59:	83 f9 01             	cmp    $0x1,%ecx
+  800d5c:	7f 1e                	jg     800d7c <vprintfmt+0x30f>
+	else if (lflag)
+  800d5e:	85 c9                	test   %ecx,%ecx
+  800d60:	74 32                	je     800d94 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800d62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d65:	8b 10                	mov    (%eax),%edx
+  800d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d6f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d72:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d77:	e9 a3 00 00 00       	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800d7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d7f:	8b 10                	mov    (%eax),%edx
+  800d81:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d84:	8d 40 08             	lea    0x8(%eax),%eax
+  800d87:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d8a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d8f:	e9 8b 00 00 00       	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800d94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d97:	8b 10                	mov    (%eax),%edx
+  800d99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d9e:	8d 40 04             	lea    0x4(%eax),%eax
+  800da1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800da4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800da9:	eb 74                	jmp    800e1f <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800dab:	83 f9 01             	cmp    $0x1,%ecx
+  800dae:	7f 1b                	jg     800dcb <vprintfmt+0x35e>
+	else if (lflag)
+  800db0:	85 c9                	test   %ecx,%ecx
+  800db2:	74 2c                	je     800de0 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800db4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800db7:	8b 10                	mov    (%eax),%edx
+  800db9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbe:	8d 40 04             	lea    0x4(%eax),%eax
+  800dc1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dc4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800dc9:	eb 54                	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800dcb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dce:	8b 10                	mov    (%eax),%edx
+  800dd0:	8b 48 04             	mov    0x4(%eax),%ecx
+  800dd3:	8d 40 08             	lea    0x8(%eax),%eax
+  800dd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dd9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800dde:	eb 3f                	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800de0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800de3:	8b 10                	mov    (%eax),%edx
+  800de5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dea:	8d 40 04             	lea    0x4(%eax),%eax
+  800ded:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800df0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800df5:	eb 28                	jmp    800e1f <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800df7:	83 ec 08             	sub    $0x8,%esp
+  800dfa:	53                   	push   %ebx
+  800dfb:	6a 30                	push   $0x30
+  800dfd:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800dff:	83 c4 08             	add    $0x8,%esp
+  800e02:	53                   	push   %ebx
+  800e03:	6a 78                	push   $0x78
+  800e05:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800e07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e0a:	8b 10                	mov    (%eax),%edx
+  800e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800e11:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800e14:	8d 40 04             	lea    0x4(%eax),%eax
+  800e17:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e1a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800e1f:	83 ec 0c             	sub    $0xc,%esp
+  800e22:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800e26:	50                   	push   %eax
+  800e27:	ff 75 e0             	push   -0x20(%ebp)
+  800e2a:	57                   	push   %edi
+  800e2b:	51                   	push   %ecx
+  800e2c:	52                   	push   %edx
+  800e2d:	89 da                	mov    %ebx,%edx
+  800e2f:	89 f0                	mov    %esi,%eax
+  800e31:	e8 54 fb ff ff       	call   80098a <printnum>
+			break;
+  800e36:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800e39:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800e3c:	e9 4a fc ff ff       	jmp    800a8b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800e41:	83 f9 01             	cmp    $0x1,%ecx
+  800e44:	7f 1b                	jg     800e61 <vprintfmt+0x3f4>
+	else if (lflag)
+  800e46:	85 c9                	test   %ecx,%ecx
+  800e48:	74 2c                	je     800e76 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800e4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e4d:	8b 10                	mov    (%eax),%edx
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e54:	8d 40 04             	lea    0x4(%eax),%eax
+  800e57:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e5a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e5f:	eb be                	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800e61:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e64:	8b 10                	mov    (%eax),%edx
+  800e66:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e69:	8d 40 08             	lea    0x8(%eax),%eax
+  800e6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e6f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e74:	eb a9                	jmp    800e1f <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800e76:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e79:	8b 10                	mov    (%eax),%edx
+  800e7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e80:	8d 40 04             	lea    0x4(%eax),%eax
+  800e83:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e86:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e8b:	eb 92                	jmp    800e1f <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800e8d:	83 ec 08             	sub    $0x8,%esp
+  800e90:	53                   	push   %ebx
+  800e91:	6a 25                	push   $0x25
+  800e93:	ff d6                	call   *%esi
+			break;
+  800e95:	83 c4 10             	add    $0x10,%esp
+  800e98:	eb 9f                	jmp    800e39 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800e9a:	83 ec 08             	sub    $0x8,%esp
+  800e9d:	53                   	push   %ebx
+  800e9e:	6a 25                	push   $0x25
+  800ea0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ea2:	83 c4 10             	add    $0x10,%esp
+  800ea5:	89 f8                	mov    %edi,%eax
+  800ea7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800eab:	74 05                	je     800eb2 <vprintfmt+0x445>
+  800ead:	83 e8 01             	sub    $0x1,%eax
+  800eb0:	eb f5                	jmp    800ea7 <vprintfmt+0x43a>
+  800eb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800eb5:	eb 82                	jmp    800e39 <vprintfmt+0x3cc>
+
+00800eb7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	83 ec 18             	sub    $0x18,%esp
+  800ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ec3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ec6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800eca:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ecd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ed4:	85 c0                	test   %eax,%eax
+  800ed6:	74 26                	je     800efe <vsnprintf+0x47>
+  800ed8:	85 d2                	test   %edx,%edx
+  800eda:	7e 22                	jle    800efe <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800edc:	ff 75 14             	push   0x14(%ebp)
+  800edf:	ff 75 10             	push   0x10(%ebp)
+  800ee2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ee5:	50                   	push   %eax
+  800ee6:	68 33 0a 80 00       	push   $0x800a33
+  800eeb:	e8 7d fb ff ff       	call   800a6d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ef0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ef3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ef6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ef9:	83 c4 10             	add    $0x10,%esp
+}
+  800efc:	c9                   	leave
+  800efd:	c3                   	ret
+		return -E_INVAL;
+  800efe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f03:	eb f7                	jmp    800efc <vsnprintf+0x45>
+
+00800f05 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f0b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f0e:	50                   	push   %eax
+  800f0f:	ff 75 10             	push   0x10(%ebp)
+  800f12:	ff 75 0c             	push   0xc(%ebp)
+  800f15:	ff 75 08             	push   0x8(%ebp)
+  800f18:	e8 9a ff ff ff       	call   800eb7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800f1d:	c9                   	leave
+  800f1e:	c3                   	ret
+
+00800f1f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2a:	eb 03                	jmp    800f2f <strlen+0x10>
+		n++;
+  800f2c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800f2f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800f33:	75 f7                	jne    800f2c <strlen+0xd>
+	return n;
+}
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+
+00800f37 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f45:	eb 03                	jmp    800f4a <strnlen+0x13>
+		n++;
+  800f47:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f4a:	39 d0                	cmp    %edx,%eax
+  800f4c:	74 08                	je     800f56 <strnlen+0x1f>
+  800f4e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800f52:	75 f3                	jne    800f47 <strnlen+0x10>
+  800f54:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800f56:	89 d0                	mov    %edx,%eax
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+
+00800f5a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	53                   	push   %ebx
+  800f5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f69:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f6d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f70:	83 c0 01             	add    $0x1,%eax
+  800f73:	84 d2                	test   %dl,%dl
+  800f75:	75 f2                	jne    800f69 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f77:	89 c8                	mov    %ecx,%eax
+  800f79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f7c:	c9                   	leave
+  800f7d:	c3                   	ret
+
+00800f7e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 10             	sub    $0x10,%esp
+  800f85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f88:	53                   	push   %ebx
+  800f89:	e8 91 ff ff ff       	call   800f1f <strlen>
+  800f8e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f91:	ff 75 0c             	push   0xc(%ebp)
+  800f94:	01 d8                	add    %ebx,%eax
+  800f96:	50                   	push   %eax
+  800f97:	e8 be ff ff ff       	call   800f5a <strcpy>
+	return dst;
+}
+  800f9c:	89 d8                	mov    %ebx,%eax
+  800f9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fa1:	c9                   	leave
+  800fa2:	c3                   	ret
+
+00800fa3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fa3:	55                   	push   %ebp
+  800fa4:	89 e5                	mov    %esp,%ebp
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fae:	89 f3                	mov    %esi,%ebx
+  800fb0:	03 5d 10             	add    0x10(%ebp),%ebx
+  800fb3:	89 f0                	mov    %esi,%eax
+  800fb5:	eb 0f                	jmp    800fc6 <strncpy+0x23>
+		*dst++ = *src;
+  800fb7:	83 c0 01             	add    $0x1,%eax
+  800fba:	0f b6 0a             	movzbl (%edx),%ecx
+  800fbd:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800fc0:	80 f9 01             	cmp    $0x1,%cl
+  800fc3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800fc6:	39 d8                	cmp    %ebx,%eax
+  800fc8:	75 ed                	jne    800fb7 <strncpy+0x14>
+	}
+	return ret;
+}
+  800fca:	89 f0                	mov    %esi,%eax
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+
+00800fd0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+  800fd5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdb:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800fde:	89 f0                	mov    %esi,%eax
+  800fe0:	85 d2                	test   %edx,%edx
+  800fe2:	74 21                	je     801005 <strlcpy+0x35>
+  800fe4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800fe8:	89 f2                	mov    %esi,%edx
+  800fea:	eb 09                	jmp    800ff5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800fec:	83 c1 01             	add    $0x1,%ecx
+  800fef:	83 c2 01             	add    $0x1,%edx
+  800ff2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ff5:	39 c2                	cmp    %eax,%edx
+  800ff7:	74 09                	je     801002 <strlcpy+0x32>
+  800ff9:	0f b6 19             	movzbl (%ecx),%ebx
+  800ffc:	84 db                	test   %bl,%bl
+  800ffe:	75 ec                	jne    800fec <strlcpy+0x1c>
+  801000:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801002:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801005:	29 f0                	sub    %esi,%eax
+}
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5d                   	pop    %ebp
+  80100a:	c3                   	ret
+
+0080100b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801011:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801014:	eb 06                	jmp    80101c <strcmp+0x11>
+		p++, q++;
+  801016:	83 c1 01             	add    $0x1,%ecx
+  801019:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80101c:	0f b6 01             	movzbl (%ecx),%eax
+  80101f:	84 c0                	test   %al,%al
+  801021:	74 04                	je     801027 <strcmp+0x1c>
+  801023:	3a 02                	cmp    (%edx),%al
+  801025:	74 ef                	je     801016 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801027:	0f b6 c0             	movzbl %al,%eax
+  80102a:	0f b6 12             	movzbl (%edx),%edx
+  80102d:	29 d0                	sub    %edx,%eax
+}
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	53                   	push   %ebx
+  801035:	8b 45 08             	mov    0x8(%ebp),%eax
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80103e:	eb 09                	jmp    801049 <strncmp+0x18>
+		n--, p++, q++;
+  801040:	83 ea 01             	sub    $0x1,%edx
+  801043:	83 c0 01             	add    $0x1,%eax
+  801046:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801049:	85 d2                	test   %edx,%edx
+  80104b:	74 18                	je     801065 <strncmp+0x34>
+  80104d:	0f b6 18             	movzbl (%eax),%ebx
+  801050:	84 db                	test   %bl,%bl
+  801052:	74 04                	je     801058 <strncmp+0x27>
+  801054:	3a 19                	cmp    (%ecx),%bl
+  801056:	74 e8                	je     801040 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801058:	0f b6 00             	movzbl (%eax),%eax
+  80105b:	0f b6 11             	movzbl (%ecx),%edx
+  80105e:	29 d0                	sub    %edx,%eax
+}
+  801060:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801063:	c9                   	leave
+  801064:	c3                   	ret
+		return 0;
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106a:	eb f4                	jmp    801060 <strncmp+0x2f>
+
+0080106c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801072:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801076:	eb 03                	jmp    80107b <strchr+0xf>
+  801078:	83 c0 01             	add    $0x1,%eax
+  80107b:	0f b6 10             	movzbl (%eax),%edx
+  80107e:	84 d2                	test   %dl,%dl
+  801080:	74 06                	je     801088 <strchr+0x1c>
+		if (*s == c)
+  801082:	38 ca                	cmp    %cl,%dl
+  801084:	75 f2                	jne    801078 <strchr+0xc>
+  801086:	eb 05                	jmp    80108d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+
+0080108f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	8b 45 08             	mov    0x8(%ebp),%eax
+  801095:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801099:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80109c:	38 ca                	cmp    %cl,%dl
+  80109e:	74 09                	je     8010a9 <strfind+0x1a>
+  8010a0:	84 d2                	test   %dl,%dl
+  8010a2:	74 05                	je     8010a9 <strfind+0x1a>
+	for (; *s; s++)
+  8010a4:	83 c0 01             	add    $0x1,%eax
+  8010a7:	eb f0                	jmp    801099 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	c3                   	ret
+
+008010ab <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	57                   	push   %edi
+  8010af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8010b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8010b5:	85 c9                	test   %ecx,%ecx
+  8010b7:	74 20                	je     8010d9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8010b9:	89 f8                	mov    %edi,%eax
+  8010bb:	09 c8                	or     %ecx,%eax
+  8010bd:	a8 03                	test   $0x3,%al
+  8010bf:	75 12                	jne    8010d3 <memset+0x28>
+		c &= 0xFF;
+  8010c1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8010c5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010cb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8010ce:	fc                   	cld
+  8010cf:	f3 ab                	rep stos %eax,%es:(%edi)
+  8010d1:	eb 06                	jmp    8010d9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d6:	fc                   	cld
+  8010d7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010d9:	89 f8                	mov    %edi,%eax
+  8010db:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8010de:	c9                   	leave
+  8010df:	c3                   	ret
+
+008010e0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	57                   	push   %edi
+  8010e4:	56                   	push   %esi
+  8010e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010eb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010ee:	39 c6                	cmp    %eax,%esi
+  8010f0:	73 32                	jae    801124 <memmove+0x44>
+  8010f2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8010f5:	39 d0                	cmp    %edx,%eax
+  8010f7:	73 2b                	jae    801124 <memmove+0x44>
+		s += n;
+		d += n;
+  8010f9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010fc:	89 d6                	mov    %edx,%esi
+  8010fe:	09 fe                	or     %edi,%esi
+  801100:	09 ce                	or     %ecx,%esi
+  801102:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801108:	75 0e                	jne    801118 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80110a:	83 ef 04             	sub    $0x4,%edi
+  80110d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801110:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801113:	fd                   	std
+  801114:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801116:	eb 09                	jmp    801121 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801118:	83 ef 01             	sub    $0x1,%edi
+  80111b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80111e:	fd                   	std
+  80111f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801121:	fc                   	cld
+  801122:	eb 1a                	jmp    80113e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801124:	89 f2                	mov    %esi,%edx
+  801126:	09 c2                	or     %eax,%edx
+  801128:	09 ca                	or     %ecx,%edx
+  80112a:	f6 c2 03             	test   $0x3,%dl
+  80112d:	75 0a                	jne    801139 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80112f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801132:	89 c7                	mov    %eax,%edi
+  801134:	fc                   	cld
+  801135:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801137:	eb 05                	jmp    80113e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801139:	89 c7                	mov    %eax,%edi
+  80113b:	fc                   	cld
+  80113c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+
+00801142 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801148:	ff 75 10             	push   0x10(%ebp)
+  80114b:	ff 75 0c             	push   0xc(%ebp)
+  80114e:	ff 75 08             	push   0x8(%ebp)
+  801151:	e8 8a ff ff ff       	call   8010e0 <memmove>
+}
+  801156:	c9                   	leave
+  801157:	c3                   	ret
+
+00801158 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801160:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801163:	89 c6                	mov    %eax,%esi
+  801165:	03 75 10             	add    0x10(%ebp),%esi
+  801168:	eb 06                	jmp    801170 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80116a:	83 c0 01             	add    $0x1,%eax
+  80116d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801170:	39 f0                	cmp    %esi,%eax
+  801172:	74 14                	je     801188 <memcmp+0x30>
+		if (*s1 != *s2)
+  801174:	0f b6 08             	movzbl (%eax),%ecx
+  801177:	0f b6 1a             	movzbl (%edx),%ebx
+  80117a:	38 d9                	cmp    %bl,%cl
+  80117c:	74 ec                	je     80116a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80117e:	0f b6 c1             	movzbl %cl,%eax
+  801181:	0f b6 db             	movzbl %bl,%ebx
+  801184:	29 d8                	sub    %ebx,%eax
+  801186:	eb 05                	jmp    80118d <memcmp+0x35>
+	}
+
+	return 0;
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80118d:	5b                   	pop    %ebx
+  80118e:	5e                   	pop    %esi
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+
+00801191 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	8b 45 08             	mov    0x8(%ebp),%eax
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80119a:	89 c2                	mov    %eax,%edx
+  80119c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80119f:	eb 03                	jmp    8011a4 <memfind+0x13>
+  8011a1:	83 c0 01             	add    $0x1,%eax
+  8011a4:	39 d0                	cmp    %edx,%eax
+  8011a6:	73 04                	jae    8011ac <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011a8:	38 08                	cmp    %cl,(%eax)
+  8011aa:	75 f5                	jne    8011a1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8011ac:	5d                   	pop    %ebp
+  8011ad:	c3                   	ret
+
+008011ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	57                   	push   %edi
+  8011b2:	56                   	push   %esi
+  8011b3:	53                   	push   %ebx
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011ba:	eb 03                	jmp    8011bf <strtol+0x11>
+		s++;
+  8011bc:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8011bf:	0f b6 02             	movzbl (%edx),%eax
+  8011c2:	3c 20                	cmp    $0x20,%al
+  8011c4:	74 f6                	je     8011bc <strtol+0xe>
+  8011c6:	3c 09                	cmp    $0x9,%al
+  8011c8:	74 f2                	je     8011bc <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011ca:	3c 2b                	cmp    $0x2b,%al
+  8011cc:	74 2a                	je     8011f8 <strtol+0x4a>
+	int neg = 0;
+  8011ce:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8011d3:	3c 2d                	cmp    $0x2d,%al
+  8011d5:	74 2b                	je     801202 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011d7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8011dd:	75 0f                	jne    8011ee <strtol+0x40>
+  8011df:	80 3a 30             	cmpb   $0x30,(%edx)
+  8011e2:	74 28                	je     80120c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011e4:	85 db                	test   %ebx,%ebx
+  8011e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011eb:	0f 44 d8             	cmove  %eax,%ebx
+  8011ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011f6:	eb 46                	jmp    80123e <strtol+0x90>
+		s++;
+  8011f8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801200:	eb d5                	jmp    8011d7 <strtol+0x29>
+		s++, neg = 1;
+  801202:	83 c2 01             	add    $0x1,%edx
+  801205:	bf 01 00 00 00       	mov    $0x1,%edi
+  80120a:	eb cb                	jmp    8011d7 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80120c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801210:	74 0e                	je     801220 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801212:	85 db                	test   %ebx,%ebx
+  801214:	75 d8                	jne    8011ee <strtol+0x40>
+		s++, base = 8;
+  801216:	83 c2 01             	add    $0x1,%edx
+  801219:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80121e:	eb ce                	jmp    8011ee <strtol+0x40>
+		s += 2, base = 16;
+  801220:	83 c2 02             	add    $0x2,%edx
+  801223:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801228:	eb c4                	jmp    8011ee <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80122a:	0f be c0             	movsbl %al,%eax
+  80122d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801230:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801233:	7d 3a                	jge    80126f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801235:	83 c2 01             	add    $0x1,%edx
+  801238:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80123c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80123e:	0f b6 02             	movzbl (%edx),%eax
+  801241:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801244:	89 f3                	mov    %esi,%ebx
+  801246:	80 fb 09             	cmp    $0x9,%bl
+  801249:	76 df                	jbe    80122a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80124b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80124e:	89 f3                	mov    %esi,%ebx
+  801250:	80 fb 19             	cmp    $0x19,%bl
+  801253:	77 08                	ja     80125d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801255:	0f be c0             	movsbl %al,%eax
+  801258:	83 e8 57             	sub    $0x57,%eax
+  80125b:	eb d3                	jmp    801230 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80125d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801260:	89 f3                	mov    %esi,%ebx
+  801262:	80 fb 19             	cmp    $0x19,%bl
+  801265:	77 08                	ja     80126f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801267:	0f be c0             	movsbl %al,%eax
+  80126a:	83 e8 37             	sub    $0x37,%eax
+  80126d:	eb c1                	jmp    801230 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80126f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801273:	74 05                	je     80127a <strtol+0xcc>
+		*endptr = (char *) s;
+  801275:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801278:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80127a:	89 c8                	mov    %ecx,%eax
+  80127c:	f7 d8                	neg    %eax
+  80127e:	85 ff                	test   %edi,%edi
+  801280:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801283:	89 c8                	mov    %ecx,%eax
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+
+0080128a <atoi>:
+
+int
+atoi(const char* s)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  801290:	6a 00                	push   $0x0
+  801292:	6a 00                	push   $0x0
+  801294:	ff 75 08             	push   0x8(%ebp)
+  801297:	e8 12 ff ff ff       	call   8011ae <strtol>
+}
+  80129c:	c9                   	leave
+  80129d:	c3                   	ret
+
+0080129e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ae:	89 c3                	mov    %eax,%ebx
+  8012b0:	89 c7                	mov    %eax,%edi
+  8012b2:	6a 00                	push   $0x0
+  8012b4:	55                   	push   %ebp
+  8012b5:	56                   	push   %esi
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	8d 35 c0 12 80 00    	lea    0x8012c0,%esi
+  8012be:	0f 34                	sysenter
+
+008012c0 <after_sysenter_label_47>:
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8012c5:	5b                   	pop    %ebx
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+
+008012c9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	57                   	push   %edi
+  8012cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012d8:	89 d1                	mov    %edx,%ecx
+  8012da:	89 d3                	mov    %edx,%ebx
+  8012dc:	89 d7                	mov    %edx,%edi
+  8012de:	6a 00                	push   $0x0
+  8012e0:	55                   	push   %ebp
+  8012e1:	56                   	push   %esi
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	8d 35 ec 12 80 00    	lea    0x8012ec,%esi
+  8012ea:	0f 34                	sysenter
+
+008012ec <after_sysenter_label_128>:
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801302:	b8 03 00 00 00       	mov    $0x3,%eax
+  801307:	89 cb                	mov    %ecx,%ebx
+  801309:	89 cf                	mov    %ecx,%edi
+  80130b:	6a 00                	push   $0x0
+  80130d:	55                   	push   %ebp
+  80130e:	56                   	push   %esi
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	8d 35 19 13 80 00    	lea    0x801319,%esi
+  801317:	0f 34                	sysenter
+
+00801319 <after_sysenter_label_212>:
+  801319:	5e                   	pop    %esi
+  80131a:	5d                   	pop    %ebp
+  80131b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80131e:	85 c0                	test   %eax,%eax
+  801320:	7f 07                	jg     801329 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801322:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801325:	5b                   	pop    %ebx
+  801326:	5f                   	pop    %edi
+  801327:	5d                   	pop    %ebp
+  801328:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	50                   	push   %eax
+  80132d:	6a 03                	push   $0x3
+  80132f:	68 b5 58 80 00       	push   $0x8058b5
+  801334:	6a 54                	push   $0x54
+  801336:	68 d2 58 80 00       	push   $0x8058d2
+  80133b:	e8 5b f5 ff ff       	call   80089b <_panic>
+
+00801340 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80134f:	89 d1                	mov    %edx,%ecx
+  801351:	89 d3                	mov    %edx,%ebx
+  801353:	89 d7                	mov    %edx,%edi
+  801355:	6a 00                	push   $0x0
+  801357:	55                   	push   %ebp
+  801358:	56                   	push   %esi
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	8d 35 63 13 80 00    	lea    0x801363,%esi
+  801361:	0f 34                	sysenter
+
+00801363 <after_sysenter_label_309>:
+  801363:	5e                   	pop    %esi
+  801364:	5d                   	pop    %ebp
+  801365:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801368:	5b                   	pop    %ebx
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+
+0080136c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	57                   	push   %edi
+  801370:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801371:	ba 00 00 00 00       	mov    $0x0,%edx
+  801376:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80137b:	89 d1                	mov    %edx,%ecx
+  80137d:	89 d3                	mov    %edx,%ebx
+  80137f:	89 d7                	mov    %edx,%edi
+  801381:	6a 00                	push   $0x0
+  801383:	55                   	push   %ebp
+  801384:	56                   	push   %esi
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	8d 35 8f 13 80 00    	lea    0x80138f,%esi
+  80138d:	0f 34                	sysenter
+
+0080138f <after_sysenter_label_391>:
+  80138f:	5e                   	pop    %esi
+  801390:	5d                   	pop    %ebp
+  801391:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801394:	5b                   	pop    %ebx
+  801395:	5f                   	pop    %edi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+
+00801398 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	57                   	push   %edi
+  80139c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8013a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b0:	6a 00                	push   $0x0
+  8013b2:	55                   	push   %ebp
+  8013b3:	56                   	push   %esi
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	8d 35 be 13 80 00    	lea    0x8013be,%esi
+  8013bc:	0f 34                	sysenter
+
+008013be <after_sysenter_label_479>:
+  8013be:	5e                   	pop    %esi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	7f 07                	jg     8013ce <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8013c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ca:	5b                   	pop    %ebx
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	50                   	push   %eax
+  8013d2:	6a 04                	push   $0x4
+  8013d4:	68 b5 58 80 00       	push   $0x8058b5
+  8013d9:	6a 54                	push   $0x54
+  8013db:	68 d2 58 80 00       	push   $0x8058d2
+  8013e0:	e8 b6 f4 ff ff       	call   80089b <_panic>
+
+008013e5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	57                   	push   %edi
+  8013e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013fb:	ff 75 18             	push   0x18(%ebp)
+  8013fe:	55                   	push   %ebp
+  8013ff:	56                   	push   %esi
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	8d 35 0a 14 80 00    	lea    0x80140a,%esi
+  801408:	0f 34                	sysenter
+
+0080140a <after_sysenter_label_593>:
+  80140a:	5e                   	pop    %esi
+  80140b:	5d                   	pop    %ebp
+  80140c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	7f 07                	jg     80141a <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801416:	5b                   	pop    %ebx
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	50                   	push   %eax
+  80141e:	6a 05                	push   $0x5
+  801420:	68 b5 58 80 00       	push   $0x8058b5
+  801425:	6a 54                	push   $0x54
+  801427:	68 d2 58 80 00       	push   $0x8058d2
+  80142c:	e8 6a f4 ff ff       	call   80089b <_panic>
+
+00801431 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801441:	b8 06 00 00 00       	mov    $0x6,%eax
+  801446:	89 df                	mov    %ebx,%edi
+  801448:	6a 00                	push   $0x0
+  80144a:	55                   	push   %ebp
+  80144b:	56                   	push   %esi
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	8d 35 56 14 80 00    	lea    0x801456,%esi
+  801454:	0f 34                	sysenter
+
+00801456 <after_sysenter_label_704>:
+  801456:	5e                   	pop    %esi
+  801457:	5d                   	pop    %ebp
+  801458:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	7f 07                	jg     801466 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80145f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801462:	5b                   	pop    %ebx
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	50                   	push   %eax
+  80146a:	6a 06                	push   $0x6
+  80146c:	68 b5 58 80 00       	push   $0x8058b5
+  801471:	6a 54                	push   $0x54
+  801473:	68 d2 58 80 00       	push   $0x8058d2
+  801478:	e8 1e f4 ff ff       	call   80089b <_panic>
+
+0080147d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801492:	89 df                	mov    %ebx,%edi
+  801494:	6a 00                	push   $0x0
+  801496:	55                   	push   %ebp
+  801497:	56                   	push   %esi
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	8d 35 a2 14 80 00    	lea    0x8014a2,%esi
+  8014a0:	0f 34                	sysenter
+
+008014a2 <after_sysenter_label_808>:
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	7f 07                	jg     8014b2 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8014ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	50                   	push   %eax
+  8014b6:	6a 08                	push   $0x8
+  8014b8:	68 b5 58 80 00       	push   $0x8058b5
+  8014bd:	6a 54                	push   $0x54
+  8014bf:	68 d2 58 80 00       	push   $0x8058d2
+  8014c4:	e8 d2 f3 ff ff       	call   80089b <_panic>
+
+008014c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014de:	89 df                	mov    %ebx,%edi
+  8014e0:	6a 00                	push   $0x0
+  8014e2:	55                   	push   %ebp
+  8014e3:	56                   	push   %esi
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	8d 35 ee 14 80 00    	lea    0x8014ee,%esi
+  8014ec:	0f 34                	sysenter
+
+008014ee <after_sysenter_label_912>:
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	7f 07                	jg     8014fe <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8014f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5f                   	pop    %edi
+  8014fc:	5d                   	pop    %ebp
+  8014fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014fe:	83 ec 0c             	sub    $0xc,%esp
+  801501:	50                   	push   %eax
+  801502:	6a 09                	push   $0x9
+  801504:	68 b5 58 80 00       	push   $0x8058b5
+  801509:	6a 54                	push   $0x54
+  80150b:	68 d2 58 80 00       	push   $0x8058d2
+  801510:	e8 86 f3 ff ff       	call   80089b <_panic>
+
+00801515 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	57                   	push   %edi
+  801519:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80151a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801525:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80152a:	89 df                	mov    %ebx,%edi
+  80152c:	6a 00                	push   $0x0
+  80152e:	55                   	push   %ebp
+  80152f:	56                   	push   %esi
+  801530:	89 e5                	mov    %esp,%ebp
+  801532:	8d 35 3a 15 80 00    	lea    0x80153a,%esi
+  801538:	0f 34                	sysenter
+
+0080153a <after_sysenter_label_1016>:
+  80153a:	5e                   	pop    %esi
+  80153b:	5d                   	pop    %ebp
+  80153c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	7f 07                	jg     80154a <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801543:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801546:	5b                   	pop    %ebx
+  801547:	5f                   	pop    %edi
+  801548:	5d                   	pop    %ebp
+  801549:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80154a:	83 ec 0c             	sub    $0xc,%esp
+  80154d:	50                   	push   %eax
+  80154e:	6a 0a                	push   $0xa
+  801550:	68 b5 58 80 00       	push   $0x8058b5
+  801555:	6a 54                	push   $0x54
+  801557:	68 d2 58 80 00       	push   $0x8058d2
+  80155c:	e8 3a f3 ff ff       	call   80089b <_panic>
+
+00801561 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	57                   	push   %edi
+  801565:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801566:	8b 55 08             	mov    0x8(%ebp),%edx
+  801569:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801571:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801574:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801577:	6a 00                	push   $0x0
+  801579:	55                   	push   %ebp
+  80157a:	56                   	push   %esi
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	8d 35 85 15 80 00    	lea    0x801585,%esi
+  801583:	0f 34                	sysenter
+
+00801585 <after_sysenter_label_1126>:
+  801585:	5e                   	pop    %esi
+  801586:	5d                   	pop    %ebp
+  801587:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80158a:	5b                   	pop    %ebx
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+
+0080158e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801593:	8b 55 08             	mov    0x8(%ebp),%edx
+  801596:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015a0:	89 cb                	mov    %ecx,%ebx
+  8015a2:	89 cf                	mov    %ecx,%edi
+  8015a4:	6a 00                	push   $0x0
+  8015a6:	55                   	push   %ebp
+  8015a7:	56                   	push   %esi
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	8d 35 b2 15 80 00    	lea    0x8015b2,%esi
+  8015b0:	0f 34                	sysenter
+
+008015b2 <after_sysenter_label_1210>:
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5d                   	pop    %ebp
+  8015b4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8015b7:	85 c0                	test   %eax,%eax
+  8015b9:	7f 07                	jg     8015c2 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8015bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015be:	5b                   	pop    %ebx
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	50                   	push   %eax
+  8015c6:	6a 0d                	push   $0xd
+  8015c8:	68 b5 58 80 00       	push   $0x8058b5
+  8015cd:	6a 54                	push   $0x54
+  8015cf:	68 d2 58 80 00       	push   $0x8058d2
+  8015d4:	e8 c2 f2 ff ff       	call   80089b <_panic>
+
+008015d9 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	57                   	push   %edi
+  8015dd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e9:	b8 42 00 00 00       	mov    $0x42,%eax
+  8015ee:	89 df                	mov    %ebx,%edi
+  8015f0:	6a 00                	push   $0x0
+  8015f2:	55                   	push   %ebp
+  8015f3:	56                   	push   %esi
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	8d 35 fe 15 80 00    	lea    0x8015fe,%esi
+  8015fc:	0f 34                	sysenter
+
+008015fe <after_sysenter_label_1311>:
+  8015fe:	5e                   	pop    %esi
+  8015ff:	5d                   	pop    %ebp
+  801600:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801603:	85 c0                	test   %eax,%eax
+  801605:	7f 07                	jg     80160e <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801607:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80160a:	5b                   	pop    %ebx
+  80160b:	5f                   	pop    %edi
+  80160c:	5d                   	pop    %ebp
+  80160d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80160e:	83 ec 0c             	sub    $0xc,%esp
+  801611:	50                   	push   %eax
+  801612:	6a 42                	push   $0x42
+  801614:	68 b5 58 80 00       	push   $0x8058b5
+  801619:	6a 54                	push   $0x54
+  80161b:	68 d2 58 80 00       	push   $0x8058d2
+  801620:	e8 76 f2 ff ff       	call   80089b <_panic>
+
+00801625 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	57                   	push   %edi
+  801629:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80162a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801634:	89 d1                	mov    %edx,%ecx
+  801636:	89 d3                	mov    %edx,%ebx
+  801638:	89 d7                	mov    %edx,%edi
+  80163a:	6a 00                	push   $0x0
+  80163c:	55                   	push   %ebp
+  80163d:	56                   	push   %esi
+  80163e:	89 e5                	mov    %esp,%ebp
+  801640:	8d 35 48 16 80 00    	lea    0x801648,%esi
+  801646:	0f 34                	sysenter
+
+00801648 <after_sysenter_label_1411>:
+  801648:	5e                   	pop    %esi
+  801649:	5d                   	pop    %ebp
+  80164a:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80164d:	5b                   	pop    %ebx
+  80164e:	5f                   	pop    %edi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+
+00801651 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	57                   	push   %edi
+  801655:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801656:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801661:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801666:	89 df                	mov    %ebx,%edi
+  801668:	6a 00                	push   $0x0
+  80166a:	55                   	push   %ebp
+  80166b:	56                   	push   %esi
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	8d 35 76 16 80 00    	lea    0x801676,%esi
+  801674:	0f 34                	sysenter
+
+00801676 <after_sysenter_label_1497>:
+  801676:	5e                   	pop    %esi
+  801677:	5d                   	pop    %ebp
+  801678:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80167b:	5b                   	pop    %ebx
+  80167c:	5f                   	pop    %edi
+  80167d:	5d                   	pop    %ebp
+  80167e:	c3                   	ret
+
+0080167f <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	57                   	push   %edi
+  801683:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801694:	89 df                	mov    %ebx,%edi
+  801696:	6a 00                	push   $0x0
+  801698:	55                   	push   %ebp
+  801699:	56                   	push   %esi
+  80169a:	89 e5                	mov    %esp,%ebp
+  80169c:	8d 35 a4 16 80 00    	lea    0x8016a4,%esi
+  8016a2:	0f 34                	sysenter
+
+008016a4 <after_sysenter_label_1583>:
+  8016a4:	5e                   	pop    %esi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8016a9:	5b                   	pop    %ebx
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+
+008016ad <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	57                   	push   %edi
+  8016b1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c5:	6a 00                	push   $0x0
+  8016c7:	55                   	push   %ebp
+  8016c8:	56                   	push   %esi
+  8016c9:	89 e5                	mov    %esp,%ebp
+  8016cb:	8d 35 d3 16 80 00    	lea    0x8016d3,%esi
+  8016d1:	0f 34                	sysenter
+
+008016d3 <after_sysenter_label_1672>:
+  8016d3:	5e                   	pop    %esi
+  8016d4:	5d                   	pop    %ebp
+  8016d5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8016d8:	5b                   	pop    %ebx
+  8016d9:	5f                   	pop    %edi
+  8016da:	5d                   	pop    %ebp
+  8016db:	c3                   	ret
+
+008016dc <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	57                   	push   %edi
+  8016e0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8016e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016f1:	89 df                	mov    %ebx,%edi
+  8016f3:	6a 00                	push   $0x0
+  8016f5:	55                   	push   %ebp
+  8016f6:	56                   	push   %esi
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	8d 35 01 17 80 00    	lea    0x801701,%esi
+  8016ff:	0f 34                	sysenter
+
+00801701 <after_sysenter_label_1758>:
+  801701:	5e                   	pop    %esi
+  801702:	5d                   	pop    %ebp
+  801703:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801706:	5b                   	pop    %ebx
+  801707:	5f                   	pop    %edi
+  801708:	5d                   	pop    %ebp
+  801709:	c3                   	ret
+
+0080170a <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80170f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801717:	b8 13 00 00 00       	mov    $0x13,%eax
+  80171c:	89 cb                	mov    %ecx,%ebx
+  80171e:	89 cf                	mov    %ecx,%edi
+  801720:	6a 00                	push   $0x0
+  801722:	55                   	push   %ebp
+  801723:	56                   	push   %esi
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	8d 35 2e 17 80 00    	lea    0x80172e,%esi
+  80172c:	0f 34                	sysenter
+
+0080172e <after_sysenter_label_1842>:
+  80172e:	5e                   	pop    %esi
+  80172f:	5d                   	pop    %ebp
+  801730:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801733:	85 c0                	test   %eax,%eax
+  801735:	7f 07                	jg     80173e <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5f                   	pop    %edi
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173e:	83 ec 0c             	sub    $0xc,%esp
+  801741:	50                   	push   %eax
+  801742:	6a 13                	push   $0x13
+  801744:	68 b5 58 80 00       	push   $0x8058b5
+  801749:	6a 54                	push   $0x54
+  80174b:	68 d2 58 80 00       	push   $0x8058d2
+  801750:	e8 46 f1 ff ff       	call   80089b <_panic>
+
+00801755 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	57                   	push   %edi
+  801759:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80175a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801764:	89 d1                	mov    %edx,%ecx
+  801766:	89 d3                	mov    %edx,%ebx
+  801768:	89 d7                	mov    %edx,%edi
+  80176a:	6a 00                	push   $0x0
+  80176c:	55                   	push   %ebp
+  80176d:	56                   	push   %esi
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	8d 35 78 17 80 00    	lea    0x801778,%esi
+  801776:	0f 34                	sysenter
+
+00801778 <after_sysenter_label_1939>:
+  801778:	5e                   	pop    %esi
+  801779:	5d                   	pop    %ebp
+  80177a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80177d:	5b                   	pop    %ebx
+  80177e:	5f                   	pop    %edi
+  80177f:	5d                   	pop    %ebp
+  801780:	c3                   	ret
+
+00801781 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	57                   	push   %edi
+  801785:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801786:	8b 55 08             	mov    0x8(%ebp),%edx
+  801789:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801791:	bf 00 00 00 00       	mov    $0x0,%edi
+  801796:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801799:	6a 00                	push   $0x0
+  80179b:	55                   	push   %ebp
+  80179c:	56                   	push   %esi
+  80179d:	89 e5                	mov    %esp,%ebp
+  80179f:	8d 35 a7 17 80 00    	lea    0x8017a7,%esi
+  8017a5:	0f 34                	sysenter
+
+008017a7 <after_sysenter_label_2028>:
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8017ac:	5b                   	pop    %ebx
+  8017ad:	5f                   	pop    %edi
+  8017ae:	5d                   	pop    %ebp
+  8017af:	c3                   	ret
+
+008017b0 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8017b0:	55                   	push   %ebp
+  8017b1:	89 e5                	mov    %esp,%ebp
+  8017b3:	57                   	push   %edi
+  8017b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017c5:	89 df                	mov    %ebx,%edi
+  8017c7:	6a 00                	push   $0x0
+  8017c9:	55                   	push   %ebp
+  8017ca:	56                   	push   %esi
+  8017cb:	89 e5                	mov    %esp,%ebp
+  8017cd:	8d 35 d5 17 80 00    	lea    0x8017d5,%esi
+  8017d3:	0f 34                	sysenter
+
+008017d5 <after_sysenter_label_2114>:
+  8017d5:	5e                   	pop    %esi
+  8017d6:	5d                   	pop    %ebp
+  8017d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8017da:	5b                   	pop    %ebx
+  8017db:	5f                   	pop    %edi
+  8017dc:	5d                   	pop    %ebp
+  8017dd:	c3                   	ret
+
+008017de <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	57                   	push   %edi
+  8017e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ee:	b8 17 00 00 00       	mov    $0x17,%eax
+  8017f3:	89 df                	mov    %ebx,%edi
+  8017f5:	6a 00                	push   $0x0
+  8017f7:	55                   	push   %ebp
+  8017f8:	56                   	push   %esi
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	8d 35 03 18 80 00    	lea    0x801803,%esi
+  801801:	0f 34                	sysenter
+
+00801803 <after_sysenter_label_2200>:
+  801803:	5e                   	pop    %esi
+  801804:	5d                   	pop    %ebp
+  801805:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801808:	5b                   	pop    %ebx
+  801809:	5f                   	pop    %edi
+  80180a:	5d                   	pop    %ebp
+  80180b:	c3                   	ret
+
+0080180c <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	57                   	push   %edi
+  801810:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	6a 00                	push   $0x0
+  801825:	55                   	push   %ebp
+  801826:	56                   	push   %esi
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	8d 35 31 18 80 00    	lea    0x801831,%esi
+  80182f:	0f 34                	sysenter
+
+00801831 <after_sysenter_label_2286>:
+  801831:	5e                   	pop    %esi
+  801832:	5d                   	pop    %ebp
+  801833:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801836:	5b                   	pop    %ebx
+  801837:	5f                   	pop    %edi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+
+0080183a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80183d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801840:	05 00 00 00 30       	add    $0x30000000,%eax
+  801845:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801848:	5d                   	pop    %ebp
+  801849:	c3                   	ret
+
+0080184a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80184d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801850:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801855:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80185a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80185f:	5d                   	pop    %ebp
+  801860:	c3                   	ret
+
+00801861 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801861:	55                   	push   %ebp
+  801862:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801864:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801869:	eb 02                	jmp    80186d <fd_alloc+0xc>
+  80186b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80186d:	89 c2                	mov    %eax,%edx
+  80186f:	c1 ea 16             	shr    $0x16,%edx
+  801872:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801879:	f6 c2 01             	test   $0x1,%dl
+  80187c:	74 2b                	je     8018a9 <fd_alloc+0x48>
+  80187e:	89 c2                	mov    %eax,%edx
+  801880:	c1 ea 0c             	shr    $0xc,%edx
+  801883:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80188a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801890:	f6 c1 01             	test   $0x1,%cl
+  801893:	74 14                	je     8018a9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801895:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80189b:	75 ce                	jne    80186b <fd_alloc+0xa>
+  80189d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018a2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018a7:	eb 05                	jmp    8018ae <fd_alloc+0x4d>
+			return 0;
+  8018a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b1:	89 02                	mov    %eax,(%edx)
+}
+  8018b3:	89 c8                	mov    %ecx,%eax
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+
+008018b7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018bd:	83 f8 1f             	cmp    $0x1f,%eax
+  8018c0:	77 30                	ja     8018f2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018c2:	c1 e0 0c             	shl    $0xc,%eax
+  8018c5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018ca:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018d0:	f6 c2 01             	test   $0x1,%dl
+  8018d3:	74 24                	je     8018f9 <fd_lookup+0x42>
+  8018d5:	89 c2                	mov    %eax,%edx
+  8018d7:	c1 ea 0c             	shr    $0xc,%edx
+  8018da:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018e1:	f6 c2 01             	test   $0x1,%dl
+  8018e4:	74 1a                	je     801900 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f0:	5d                   	pop    %ebp
+  8018f1:	c3                   	ret
+		return -E_INVAL;
+  8018f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f7:	eb f7                	jmp    8018f0 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018fe:	eb f0                	jmp    8018f0 <fd_lookup+0x39>
+  801900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801905:	eb e9                	jmp    8018f0 <fd_lookup+0x39>
+
+00801907 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	53                   	push   %ebx
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801911:	b8 00 00 00 00       	mov    $0x0,%eax
+  801916:	eb 03                	jmp    80191b <dev_lookup+0x14>
+  801918:	83 c0 01             	add    $0x1,%eax
+  80191b:	8b 1c 85 5c 59 80 00 	mov    0x80595c(,%eax,4),%ebx
+  801922:	85 db                	test   %ebx,%ebx
+  801924:	74 0b                	je     801931 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801926:	39 13                	cmp    %edx,(%ebx)
+  801928:	75 ee                	jne    801918 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80192a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192f:	eb 49                	jmp    80197a <dev_lookup+0x73>
+  801931:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801933:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801939:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80193e:	77 18                	ja     801958 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801940:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801945:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801947:	c1 e8 10             	shr    $0x10,%eax
+  80194a:	74 0c                	je     801958 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80194c:	c1 e0 10             	shl    $0x10,%eax
+  80194f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801954:	29 c1                	sub    %eax,%ecx
+  801956:	eb 06                	jmp    80195e <dev_lookup+0x57>
+		return pthread_main_tls;
+  801958:	8b 0d 80 08 91 00    	mov    0x910880,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80195e:	8b 01                	mov    (%ecx),%eax
+  801960:	8b 40 48             	mov    0x48(%eax),%eax
+  801963:	83 ec 04             	sub    $0x4,%esp
+  801966:	52                   	push   %edx
+  801967:	50                   	push   %eax
+  801968:	68 e0 58 80 00       	push   $0x8058e0
+  80196d:	e8 04 f0 ff ff       	call   800976 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80197a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80197d:	89 1a                	mov    %ebx,(%edx)
+}
+  80197f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801982:	c9                   	leave
+  801983:	c3                   	ret
+
+00801984 <fd_close>:
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	57                   	push   %edi
+  801988:	56                   	push   %esi
+  801989:	53                   	push   %ebx
+  80198a:	83 ec 24             	sub    $0x24,%esp
+  80198d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801990:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801993:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801996:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801997:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80199d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a0:	50                   	push   %eax
+  8019a1:	e8 11 ff ff ff       	call   8018b7 <fd_lookup>
+  8019a6:	89 c3                	mov    %eax,%ebx
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 05                	js     8019b4 <fd_close+0x30>
+	    || fd != fd2)
+  8019af:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019b2:	74 16                	je     8019ca <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019b4:	89 f8                	mov    %edi,%eax
+  8019b6:	84 c0                	test   %al,%al
+  8019b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019c0:	89 d8                	mov    %ebx,%eax
+  8019c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c5:	5b                   	pop    %ebx
+  8019c6:	5e                   	pop    %esi
+  8019c7:	5f                   	pop    %edi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019ca:	83 ec 08             	sub    $0x8,%esp
+  8019cd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019d0:	50                   	push   %eax
+  8019d1:	ff 36                	push   (%esi)
+  8019d3:	e8 2f ff ff ff       	call   801907 <dev_lookup>
+  8019d8:	89 c3                	mov    %eax,%ebx
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	78 1a                	js     8019fb <fd_close+0x77>
+		if (dev->dev_close)
+  8019e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019e4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	74 0b                	je     8019fb <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019f0:	83 ec 0c             	sub    $0xc,%esp
+  8019f3:	56                   	push   %esi
+  8019f4:	ff d0                	call   *%eax
+  8019f6:	89 c3                	mov    %eax,%ebx
+  8019f8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019fb:	83 ec 08             	sub    $0x8,%esp
+  8019fe:	56                   	push   %esi
+  8019ff:	6a 00                	push   $0x0
+  801a01:	e8 2b fa ff ff       	call   801431 <sys_page_unmap>
+	return r;
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	eb b5                	jmp    8019c0 <fd_close+0x3c>
+
+00801a0b <close>:
+
+int
+close(int fdnum)
+{
+  801a0b:	55                   	push   %ebp
+  801a0c:	89 e5                	mov    %esp,%ebp
+  801a0e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a14:	50                   	push   %eax
+  801a15:	ff 75 08             	push   0x8(%ebp)
+  801a18:	e8 9a fe ff ff       	call   8018b7 <fd_lookup>
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	79 02                	jns    801a26 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a24:	c9                   	leave
+  801a25:	c3                   	ret
+		return fd_close(fd, 1);
+  801a26:	83 ec 08             	sub    $0x8,%esp
+  801a29:	6a 01                	push   $0x1
+  801a2b:	ff 75 f4             	push   -0xc(%ebp)
+  801a2e:	e8 51 ff ff ff       	call   801984 <fd_close>
+  801a33:	83 c4 10             	add    $0x10,%esp
+  801a36:	eb ec                	jmp    801a24 <close+0x19>
+
+00801a38 <close_all>:
+
+void
+close_all(void)
+{
+  801a38:	55                   	push   %ebp
+  801a39:	89 e5                	mov    %esp,%ebp
+  801a3b:	53                   	push   %ebx
+  801a3c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a44:	83 ec 0c             	sub    $0xc,%esp
+  801a47:	53                   	push   %ebx
+  801a48:	e8 be ff ff ff       	call   801a0b <close>
+	for (i = 0; i < MAXFD; i++)
+  801a4d:	83 c3 01             	add    $0x1,%ebx
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	83 fb 20             	cmp    $0x20,%ebx
+  801a56:	75 ec                	jne    801a44 <close_all+0xc>
+}
+  801a58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a5b:	c9                   	leave
+  801a5c:	c3                   	ret
+
+00801a5d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	57                   	push   %edi
+  801a61:	56                   	push   %esi
+  801a62:	53                   	push   %ebx
+  801a63:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a69:	50                   	push   %eax
+  801a6a:	ff 75 08             	push   0x8(%ebp)
+  801a6d:	e8 45 fe ff ff       	call   8018b7 <fd_lookup>
+  801a72:	89 c3                	mov    %eax,%ebx
+  801a74:	83 c4 10             	add    $0x10,%esp
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	78 7f                	js     801afa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a7b:	83 ec 0c             	sub    $0xc,%esp
+  801a7e:	ff 75 0c             	push   0xc(%ebp)
+  801a81:	e8 85 ff ff ff       	call   801a0b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a89:	c1 e6 0c             	shl    $0xc,%esi
+  801a8c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a92:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a95:	89 3c 24             	mov    %edi,(%esp)
+  801a98:	e8 ad fd ff ff       	call   80184a <fd2data>
+  801a9d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a9f:	89 34 24             	mov    %esi,(%esp)
+  801aa2:	e8 a3 fd ff ff       	call   80184a <fd2data>
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801aad:	89 d8                	mov    %ebx,%eax
+  801aaf:	c1 e8 16             	shr    $0x16,%eax
+  801ab2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ab9:	a8 01                	test   $0x1,%al
+  801abb:	74 11                	je     801ace <dup+0x71>
+  801abd:	89 d8                	mov    %ebx,%eax
+  801abf:	c1 e8 0c             	shr    $0xc,%eax
+  801ac2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ac9:	f6 c2 01             	test   $0x1,%dl
+  801acc:	75 36                	jne    801b04 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ace:	89 f8                	mov    %edi,%eax
+  801ad0:	c1 e8 0c             	shr    $0xc,%eax
+  801ad3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ada:	83 ec 0c             	sub    $0xc,%esp
+  801add:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	56                   	push   %esi
+  801ae4:	6a 00                	push   $0x0
+  801ae6:	57                   	push   %edi
+  801ae7:	6a 00                	push   $0x0
+  801ae9:	e8 f7 f8 ff ff       	call   8013e5 <sys_page_map>
+  801aee:	89 c3                	mov    %eax,%ebx
+  801af0:	83 c4 20             	add    $0x20,%esp
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 33                	js     801b2a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801af7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801afa:	89 d8                	mov    %ebx,%eax
+  801afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aff:	5b                   	pop    %ebx
+  801b00:	5e                   	pop    %esi
+  801b01:	5f                   	pop    %edi
+  801b02:	5d                   	pop    %ebp
+  801b03:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b04:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b0b:	83 ec 0c             	sub    $0xc,%esp
+  801b0e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b13:	50                   	push   %eax
+  801b14:	ff 75 d4             	push   -0x2c(%ebp)
+  801b17:	6a 00                	push   $0x0
+  801b19:	53                   	push   %ebx
+  801b1a:	6a 00                	push   $0x0
+  801b1c:	e8 c4 f8 ff ff       	call   8013e5 <sys_page_map>
+  801b21:	89 c3                	mov    %eax,%ebx
+  801b23:	83 c4 20             	add    $0x20,%esp
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	79 a4                	jns    801ace <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b2a:	83 ec 08             	sub    $0x8,%esp
+  801b2d:	56                   	push   %esi
+  801b2e:	6a 00                	push   $0x0
+  801b30:	e8 fc f8 ff ff       	call   801431 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b35:	83 c4 08             	add    $0x8,%esp
+  801b38:	ff 75 d4             	push   -0x2c(%ebp)
+  801b3b:	6a 00                	push   $0x0
+  801b3d:	e8 ef f8 ff ff       	call   801431 <sys_page_unmap>
+	return r;
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	eb b3                	jmp    801afa <dup+0x9d>
+
+00801b47 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b47:	55                   	push   %ebp
+  801b48:	89 e5                	mov    %esp,%ebp
+  801b4a:	56                   	push   %esi
+  801b4b:	53                   	push   %ebx
+  801b4c:	83 ec 18             	sub    $0x18,%esp
+  801b4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b52:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b55:	50                   	push   %eax
+  801b56:	53                   	push   %ebx
+  801b57:	e8 5b fd ff ff       	call   8018b7 <fd_lookup>
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 3c                	js     801b9f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b63:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b66:	83 ec 08             	sub    $0x8,%esp
+  801b69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b6c:	50                   	push   %eax
+  801b6d:	ff 36                	push   (%esi)
+  801b6f:	e8 93 fd ff ff       	call   801907 <dev_lookup>
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 24                	js     801b9f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b7b:	8b 46 08             	mov    0x8(%esi),%eax
+  801b7e:	83 e0 03             	and    $0x3,%eax
+  801b81:	83 f8 01             	cmp    $0x1,%eax
+  801b84:	74 20                	je     801ba6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b89:	8b 40 08             	mov    0x8(%eax),%eax
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	74 61                	je     801bf1 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b90:	83 ec 04             	sub    $0x4,%esp
+  801b93:	ff 75 10             	push   0x10(%ebp)
+  801b96:	ff 75 0c             	push   0xc(%ebp)
+  801b99:	56                   	push   %esi
+  801b9a:	ff d0                	call   *%eax
+  801b9c:	83 c4 10             	add    $0x10,%esp
+}
+  801b9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba2:	5b                   	pop    %ebx
+  801ba3:	5e                   	pop    %esi
+  801ba4:	5d                   	pop    %ebp
+  801ba5:	c3                   	ret
+  801ba6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ba8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bae:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bb3:	77 18                	ja     801bcd <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bb5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801bba:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801bbc:	c1 e8 10             	shr    $0x10,%eax
+  801bbf:	74 0c                	je     801bcd <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801bc1:	c1 e0 10             	shl    $0x10,%eax
+  801bc4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801bc9:	29 c2                	sub    %eax,%edx
+  801bcb:	eb 06                	jmp    801bd3 <read+0x8c>
+		return pthread_main_tls;
+  801bcd:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd3:	8b 02                	mov    (%edx),%eax
+  801bd5:	8b 40 48             	mov    0x48(%eax),%eax
+  801bd8:	83 ec 04             	sub    $0x4,%esp
+  801bdb:	53                   	push   %ebx
+  801bdc:	50                   	push   %eax
+  801bdd:	68 21 59 80 00       	push   $0x805921
+  801be2:	e8 8f ed ff ff       	call   800976 <cprintf>
+		return -E_INVAL;
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bef:	eb ae                	jmp    801b9f <read+0x58>
+		return -E_NOT_SUPP;
+  801bf1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bf6:	eb a7                	jmp    801b9f <read+0x58>
+
+00801bf8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	57                   	push   %edi
+  801bfc:	56                   	push   %esi
+  801bfd:	53                   	push   %ebx
+  801bfe:	83 ec 0c             	sub    $0xc,%esp
+  801c01:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c04:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c0c:	eb 02                	jmp    801c10 <readn+0x18>
+  801c0e:	01 c3                	add    %eax,%ebx
+  801c10:	39 f3                	cmp    %esi,%ebx
+  801c12:	73 21                	jae    801c35 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	89 f0                	mov    %esi,%eax
+  801c19:	29 d8                	sub    %ebx,%eax
+  801c1b:	50                   	push   %eax
+  801c1c:	89 d8                	mov    %ebx,%eax
+  801c1e:	03 45 0c             	add    0xc(%ebp),%eax
+  801c21:	50                   	push   %eax
+  801c22:	57                   	push   %edi
+  801c23:	e8 1f ff ff ff       	call   801b47 <read>
+		if (m < 0)
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 04                	js     801c33 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c2f:	75 dd                	jne    801c0e <readn+0x16>
+  801c31:	eb 02                	jmp    801c35 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c33:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c35:	89 d8                	mov    %ebx,%eax
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+
+00801c3f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c3f:	55                   	push   %ebp
+  801c40:	89 e5                	mov    %esp,%ebp
+  801c42:	56                   	push   %esi
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 18             	sub    $0x18,%esp
+  801c47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c4a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	53                   	push   %ebx
+  801c4f:	e8 63 fc ff ff       	call   8018b7 <fd_lookup>
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 37                	js     801c92 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c5b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c5e:	83 ec 08             	sub    $0x8,%esp
+  801c61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c64:	50                   	push   %eax
+  801c65:	ff 36                	push   (%esi)
+  801c67:	e8 9b fc ff ff       	call   801907 <dev_lookup>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 1f                	js     801c92 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c73:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c77:	74 20                	je     801c99 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	74 61                	je     801ce4 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c83:	83 ec 04             	sub    $0x4,%esp
+  801c86:	ff 75 10             	push   0x10(%ebp)
+  801c89:	ff 75 0c             	push   0xc(%ebp)
+  801c8c:	56                   	push   %esi
+  801c8d:	ff d0                	call   *%eax
+  801c8f:	83 c4 10             	add    $0x10,%esp
+}
+  801c92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5d                   	pop    %ebp
+  801c98:	c3                   	ret
+  801c99:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c9b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ca1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801ca6:	77 18                	ja     801cc0 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ca8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cad:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801caf:	c1 e8 10             	shr    $0x10,%eax
+  801cb2:	74 0c                	je     801cc0 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801cb4:	c1 e0 10             	shl    $0x10,%eax
+  801cb7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801cbc:	29 c2                	sub    %eax,%edx
+  801cbe:	eb 06                	jmp    801cc6 <write+0x87>
+		return pthread_main_tls;
+  801cc0:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc6:	8b 02                	mov    (%edx),%eax
+  801cc8:	8b 40 48             	mov    0x48(%eax),%eax
+  801ccb:	83 ec 04             	sub    $0x4,%esp
+  801cce:	53                   	push   %ebx
+  801ccf:	50                   	push   %eax
+  801cd0:	68 3d 59 80 00       	push   $0x80593d
+  801cd5:	e8 9c ec ff ff       	call   800976 <cprintf>
+		return -E_INVAL;
+  801cda:	83 c4 10             	add    $0x10,%esp
+  801cdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce2:	eb ae                	jmp    801c92 <write+0x53>
+		return -E_NOT_SUPP;
+  801ce4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce9:	eb a7                	jmp    801c92 <write+0x53>
+
+00801ceb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ceb:	55                   	push   %ebp
+  801cec:	89 e5                	mov    %esp,%ebp
+  801cee:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cf1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf4:	50                   	push   %eax
+  801cf5:	ff 75 08             	push   0x8(%ebp)
+  801cf8:	e8 ba fb ff ff       	call   8018b7 <fd_lookup>
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	78 0e                	js     801d12 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+
+00801d14 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d14:	55                   	push   %ebp
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	56                   	push   %esi
+  801d18:	53                   	push   %ebx
+  801d19:	83 ec 18             	sub    $0x18,%esp
+  801d1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d22:	50                   	push   %eax
+  801d23:	53                   	push   %ebx
+  801d24:	e8 8e fb ff ff       	call   8018b7 <fd_lookup>
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 34                	js     801d64 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d30:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d33:	83 ec 08             	sub    $0x8,%esp
+  801d36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d39:	50                   	push   %eax
+  801d3a:	ff 36                	push   (%esi)
+  801d3c:	e8 c6 fb ff ff       	call   801907 <dev_lookup>
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 1c                	js     801d64 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d48:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d4c:	74 1d                	je     801d6b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d51:	8b 40 18             	mov    0x18(%eax),%eax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 5e                	je     801db6 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d58:	83 ec 08             	sub    $0x8,%esp
+  801d5b:	ff 75 0c             	push   0xc(%ebp)
+  801d5e:	56                   	push   %esi
+  801d5f:	ff d0                	call   *%eax
+  801d61:	83 c4 10             	add    $0x10,%esp
+}
+  801d64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d67:	5b                   	pop    %ebx
+  801d68:	5e                   	pop    %esi
+  801d69:	5d                   	pop    %ebp
+  801d6a:	c3                   	ret
+  801d6b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d6d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d73:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d78:	77 18                	ja     801d92 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d7a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d7f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d81:	c1 e8 10             	shr    $0x10,%eax
+  801d84:	74 0c                	je     801d92 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d86:	c1 e0 10             	shl    $0x10,%eax
+  801d89:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d8e:	29 c2                	sub    %eax,%edx
+  801d90:	eb 06                	jmp    801d98 <ftruncate+0x84>
+		return pthread_main_tls;
+  801d92:	8b 15 80 08 91 00    	mov    0x910880,%edx
+			thisenv->env_id, fdnum);
+  801d98:	8b 02                	mov    (%edx),%eax
+  801d9a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d9d:	83 ec 04             	sub    $0x4,%esp
+  801da0:	53                   	push   %ebx
+  801da1:	50                   	push   %eax
+  801da2:	68 00 59 80 00       	push   $0x805900
+  801da7:	e8 ca eb ff ff       	call   800976 <cprintf>
+		return -E_INVAL;
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801db4:	eb ae                	jmp    801d64 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801db6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbb:	eb a7                	jmp    801d64 <ftruncate+0x50>
+
+00801dbd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	56                   	push   %esi
+  801dc1:	53                   	push   %ebx
+  801dc2:	83 ec 18             	sub    $0x18,%esp
+  801dc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dc8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dcb:	50                   	push   %eax
+  801dcc:	ff 75 08             	push   0x8(%ebp)
+  801dcf:	e8 e3 fa ff ff       	call   8018b7 <fd_lookup>
+  801dd4:	83 c4 10             	add    $0x10,%esp
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	78 49                	js     801e24 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ddb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de4:	50                   	push   %eax
+  801de5:	ff 36                	push   (%esi)
+  801de7:	e8 1b fb ff ff       	call   801907 <dev_lookup>
+  801dec:	83 c4 10             	add    $0x10,%esp
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 31                	js     801e24 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dfa:	74 2f                	je     801e2b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dfc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dff:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e06:	00 00 00 
+	stat->st_isdir = 0;
+  801e09:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e10:	00 00 00 
+	stat->st_dev = dev;
+  801e13:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e19:	83 ec 08             	sub    $0x8,%esp
+  801e1c:	53                   	push   %ebx
+  801e1d:	56                   	push   %esi
+  801e1e:	ff 50 14             	call   *0x14(%eax)
+  801e21:	83 c4 10             	add    $0x10,%esp
+}
+  801e24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e27:	5b                   	pop    %ebx
+  801e28:	5e                   	pop    %esi
+  801e29:	5d                   	pop    %ebp
+  801e2a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e2b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e30:	eb f2                	jmp    801e24 <fstat+0x67>
+
+00801e32 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	56                   	push   %esi
+  801e36:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e37:	83 ec 08             	sub    $0x8,%esp
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	ff 75 08             	push   0x8(%ebp)
+  801e3f:	e8 4b 03 00 00       	call   80218f <open>
+  801e44:	89 c3                	mov    %eax,%ebx
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 1b                	js     801e68 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e4d:	83 ec 08             	sub    $0x8,%esp
+  801e50:	ff 75 0c             	push   0xc(%ebp)
+  801e53:	50                   	push   %eax
+  801e54:	e8 64 ff ff ff       	call   801dbd <fstat>
+  801e59:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e5b:	89 1c 24             	mov    %ebx,(%esp)
+  801e5e:	e8 a8 fb ff ff       	call   801a0b <close>
+	return r;
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	89 f3                	mov    %esi,%ebx
+}
+  801e68:	89 d8                	mov    %ebx,%eax
+  801e6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5d                   	pop    %ebp
+  801e70:	c3                   	ret
+
+00801e71 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	56                   	push   %esi
+  801e75:	53                   	push   %ebx
+  801e76:	89 c6                	mov    %eax,%esi
+  801e78:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e7a:	83 3d 00 04 91 00 00 	cmpl   $0x0,0x910400
+  801e81:	74 27                	je     801eaa <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e83:	6a 07                	push   $0x7
+  801e85:	68 00 10 91 00       	push   $0x911000
+  801e8a:	56                   	push   %esi
+  801e8b:	ff 35 00 04 91 00    	push   0x910400
+  801e91:	e8 c6 30 00 00       	call   804f5c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e96:	83 c4 0c             	add    $0xc,%esp
+  801e99:	6a 00                	push   $0x0
+  801e9b:	53                   	push   %ebx
+  801e9c:	6a 00                	push   $0x0
+  801e9e:	e8 c3 2f 00 00       	call   804e66 <ipc_recv>
+}
+  801ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea6:	5b                   	pop    %ebx
+  801ea7:	5e                   	pop    %esi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eaa:	83 ec 0c             	sub    $0xc,%esp
+  801ead:	6a 01                	push   $0x1
+  801eaf:	e8 fe 30 00 00       	call   804fb2 <ipc_find_env>
+  801eb4:	a3 00 04 91 00       	mov    %eax,0x910400
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	eb c5                	jmp    801e83 <fsipc+0x12>
+
+00801ebe <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	53                   	push   %ebx
+  801ec2:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ec5:	68 04 04 91 00       	push   $0x910404
+  801eca:	e8 a1 1f 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed5:	a3 00 10 91 00       	mov    %eax,0x911000
+	fsipcbuf.set_size.req_size = newsize;
+  801eda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801edd:	a3 04 10 91 00       	mov    %eax,0x911004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ee2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eec:	e8 80 ff ff ff       	call   801e71 <fsipc>
+  801ef1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ef3:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  801efa:	e8 de 1f 00 00       	call   803edd <mutex_unlock>
+	return r;
+}
+  801eff:	89 d8                	mov    %ebx,%eax
+  801f01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f04:	c9                   	leave
+  801f05:	c3                   	ret
+
+00801f06 <devfile_flush>:
+{
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	53                   	push   %ebx
+  801f0a:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f0d:	68 04 04 91 00       	push   $0x910404
+  801f12:	e8 59 1f 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1d:	a3 00 10 91 00       	mov    %eax,0x911000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f27:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f2c:	e8 40 ff ff ff       	call   801e71 <fsipc>
+  801f31:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f33:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  801f3a:	e8 9e 1f 00 00       	call   803edd <mutex_unlock>
+}
+  801f3f:	89 d8                	mov    %ebx,%eax
+  801f41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+00801f46 <devfile_stat>:
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	56                   	push   %esi
+  801f4a:	53                   	push   %ebx
+  801f4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f4e:	83 ec 0c             	sub    $0xc,%esp
+  801f51:	68 04 04 91 00       	push   $0x910404
+  801f56:	e8 15 1f 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f61:	a3 00 10 91 00       	mov    %eax,0x911000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f70:	e8 fc fe ff ff       	call   801e71 <fsipc>
+  801f75:	89 c3                	mov    %eax,%ebx
+  801f77:	83 c4 10             	add    $0x10,%esp
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	79 16                	jns    801f94 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801f7e:	83 ec 0c             	sub    $0xc,%esp
+  801f81:	68 04 04 91 00       	push   $0x910404
+  801f86:	e8 52 1f 00 00       	call   803edd <mutex_unlock>
+}
+  801f8b:	89 d8                	mov    %ebx,%eax
+  801f8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f90:	5b                   	pop    %ebx
+  801f91:	5e                   	pop    %esi
+  801f92:	5d                   	pop    %ebp
+  801f93:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f94:	83 ec 08             	sub    $0x8,%esp
+  801f97:	68 00 10 91 00       	push   $0x911000
+  801f9c:	56                   	push   %esi
+  801f9d:	e8 b8 ef ff ff       	call   800f5a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801fa2:	a1 80 10 91 00       	mov    0x911080,%eax
+  801fa7:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fad:	a1 84 10 91 00       	mov    0x911084,%eax
+  801fb2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801fb8:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801fbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc0:	eb bc                	jmp    801f7e <devfile_stat+0x38>
+
+00801fc2 <devfile_write>:
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	53                   	push   %ebx
+  801fc6:	83 ec 10             	sub    $0x10,%esp
+  801fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801fcc:	68 04 04 91 00       	push   $0x910404
+  801fd1:	e8 9a 1e 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fdc:	a3 00 10 91 00       	mov    %eax,0x911000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801fea:	76 3d                	jbe    802029 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801fec:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801ff1:	39 c3                	cmp    %eax,%ebx
+  801ff3:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801ff6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff9:	a3 08 10 91 00       	mov    %eax,0x911008
+	fsipcbuf.write.req_n = n;
+  801ffe:	89 1d 04 10 91 00    	mov    %ebx,0x911004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802004:	ba 00 00 00 00       	mov    $0x0,%edx
+  802009:	b8 04 00 00 00       	mov    $0x4,%eax
+  80200e:	e8 5e fe ff ff       	call   801e71 <fsipc>
+  802013:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802015:	83 ec 0c             	sub    $0xc,%esp
+  802018:	68 04 04 91 00       	push   $0x910404
+  80201d:	e8 bb 1e 00 00       	call   803edd <mutex_unlock>
+}
+  802022:	89 d8                	mov    %ebx,%eax
+  802024:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802027:	c9                   	leave
+  802028:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802029:	83 ec 04             	sub    $0x4,%esp
+  80202c:	53                   	push   %ebx
+  80202d:	ff 75 0c             	push   0xc(%ebp)
+  802030:	68 0c 10 91 00       	push   $0x91100c
+  802035:	e8 a6 f0 ff ff       	call   8010e0 <memmove>
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802042:	eb b5                	jmp    801ff9 <devfile_write+0x37>
+
+00802044 <devfile_read>:
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	57                   	push   %edi
+  802048:	56                   	push   %esi
+  802049:	53                   	push   %ebx
+  80204a:	83 ec 0c             	sub    $0xc,%esp
+  80204d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802050:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802053:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802056:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80205c:	0f 86 8c 00 00 00    	jbe    8020ee <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802062:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802067:	39 c3                	cmp    %eax,%ebx
+  802069:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80206c:	89 f8                	mov    %edi,%eax
+  80206e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802071:	eb 0f                	jmp    802082 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802073:	0f b6 08             	movzbl (%eax),%ecx
+  802076:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802078:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80207d:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802082:	39 d0                	cmp    %edx,%eax
+  802084:	72 ed                	jb     802073 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	68 04 04 91 00       	push   $0x910404
+  80208e:	e8 dd 1d 00 00       	call   803e70 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802093:	8b 46 0c             	mov    0xc(%esi),%eax
+  802096:	a3 00 10 91 00       	mov    %eax,0x911000
+		fsipcbuf.read.req_n = n;
+  80209b:	89 1d 04 10 91 00    	mov    %ebx,0x911004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8020a1:	89 3d 08 10 91 00    	mov    %edi,0x911008
+		r = fsipc(FSREQ_READ, NULL);
+  8020a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ac:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b1:	e8 bb fd ff ff       	call   801e71 <fsipc>
+  8020b6:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8020b8:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  8020bf:	e8 19 1e 00 00       	call   803edd <mutex_unlock>
+		assert(r <= (int) n);
+  8020c4:	83 c4 10             	add    $0x10,%esp
+  8020c7:	39 f3                	cmp    %esi,%ebx
+  8020c9:	7c 0a                	jl     8020d5 <devfile_read+0x91>
+}
+  8020cb:	89 f0                	mov    %esi,%eax
+  8020cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d0:	5b                   	pop    %ebx
+  8020d1:	5e                   	pop    %esi
+  8020d2:	5f                   	pop    %edi
+  8020d3:	5d                   	pop    %ebp
+  8020d4:	c3                   	ret
+		assert(r <= (int) n);
+  8020d5:	68 70 59 80 00       	push   $0x805970
+  8020da:	68 7d 59 80 00       	push   $0x80597d
+  8020df:	68 90 00 00 00       	push   $0x90
+  8020e4:	68 92 59 80 00       	push   $0x805992
+  8020e9:	e8 ad e7 ff ff       	call   80089b <_panic>
+	mutex_lock(&fsipc_mu);
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	68 04 04 91 00       	push   $0x910404
+  8020f6:	e8 75 1d 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020fb:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020fe:	a3 00 10 91 00       	mov    %eax,0x911000
+	fsipcbuf.read.req_n = n;
+  802103:	89 1d 04 10 91 00    	mov    %ebx,0x911004
+	fsipcbuf.read.req_va = 0;
+  802109:	c7 05 08 10 91 00 00 	movl   $0x0,0x911008
+  802110:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802113:	ba 00 00 00 00       	mov    $0x0,%edx
+  802118:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211d:	e8 4f fd ff ff       	call   801e71 <fsipc>
+  802122:	89 c6                	mov    %eax,%esi
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 1d                	js     802148 <devfile_read+0x104>
+		assert(r <= n);
+  80212b:	39 c3                	cmp    %eax,%ebx
+  80212d:	72 2e                	jb     80215d <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80212f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802134:	7f 40                	jg     802176 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802136:	83 ec 04             	sub    $0x4,%esp
+  802139:	50                   	push   %eax
+  80213a:	68 00 10 91 00       	push   $0x911000
+  80213f:	57                   	push   %edi
+  802140:	e8 9b ef ff ff       	call   8010e0 <memmove>
+  802145:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	68 04 04 91 00       	push   $0x910404
+  802150:	e8 88 1d 00 00       	call   803edd <mutex_unlock>
+	return r;
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	e9 6e ff ff ff       	jmp    8020cb <devfile_read+0x87>
+		assert(r <= n);
+  80215d:	68 9d 59 80 00       	push   $0x80599d
+  802162:	68 7d 59 80 00       	push   $0x80597d
+  802167:	68 99 00 00 00       	push   $0x99
+  80216c:	68 92 59 80 00       	push   $0x805992
+  802171:	e8 25 e7 ff ff       	call   80089b <_panic>
+		assert(r <= PGSIZE);
+  802176:	68 a4 59 80 00       	push   $0x8059a4
+  80217b:	68 7d 59 80 00       	push   $0x80597d
+  802180:	68 9a 00 00 00       	push   $0x9a
+  802185:	68 92 59 80 00       	push   $0x805992
+  80218a:	e8 0c e7 ff ff       	call   80089b <_panic>
+
+0080218f <open>:
+{
+  80218f:	55                   	push   %ebp
+  802190:	89 e5                	mov    %esp,%ebp
+  802192:	56                   	push   %esi
+  802193:	53                   	push   %ebx
+  802194:	83 ec 1c             	sub    $0x1c,%esp
+  802197:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80219a:	56                   	push   %esi
+  80219b:	e8 7f ed ff ff       	call   800f1f <strlen>
+  8021a0:	83 c4 10             	add    $0x10,%esp
+  8021a3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021a8:	0f 8f 85 00 00 00    	jg     802233 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021ae:	83 ec 0c             	sub    $0xc,%esp
+  8021b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b4:	50                   	push   %eax
+  8021b5:	e8 a7 f6 ff ff       	call   801861 <fd_alloc>
+  8021ba:	89 c3                	mov    %eax,%ebx
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 55                	js     802218 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8021c3:	83 ec 0c             	sub    $0xc,%esp
+  8021c6:	68 04 04 91 00       	push   $0x910404
+  8021cb:	e8 a0 1c 00 00       	call   803e70 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021d0:	83 c4 08             	add    $0x8,%esp
+  8021d3:	56                   	push   %esi
+  8021d4:	68 00 10 91 00       	push   $0x911000
+  8021d9:	e8 7c ed ff ff       	call   800f5a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021e1:	a3 00 14 91 00       	mov    %eax,0x911400
+	r = fsipc(FSREQ_OPEN, fd);
+  8021e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ee:	e8 7e fc ff ff       	call   801e71 <fsipc>
+  8021f3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021f5:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  8021fc:	e8 dc 1c 00 00       	call   803edd <mutex_unlock>
+	if (r < 0) {
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	85 db                	test   %ebx,%ebx
+  802206:	78 19                	js     802221 <open+0x92>
+	return fd2num(fd);
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	ff 75 f4             	push   -0xc(%ebp)
+  80220e:	e8 27 f6 ff ff       	call   80183a <fd2num>
+  802213:	89 c3                	mov    %eax,%ebx
+  802215:	83 c4 10             	add    $0x10,%esp
+}
+  802218:	89 d8                	mov    %ebx,%eax
+  80221a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221d:	5b                   	pop    %ebx
+  80221e:	5e                   	pop    %esi
+  80221f:	5d                   	pop    %ebp
+  802220:	c3                   	ret
+		fd_close(fd, 0);
+  802221:	83 ec 08             	sub    $0x8,%esp
+  802224:	6a 00                	push   $0x0
+  802226:	ff 75 f4             	push   -0xc(%ebp)
+  802229:	e8 56 f7 ff ff       	call   801984 <fd_close>
+		return r;
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	eb e5                	jmp    802218 <open+0x89>
+		return -E_BAD_PATH;
+  802233:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802238:	eb de                	jmp    802218 <open+0x89>
+
+0080223a <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	53                   	push   %ebx
+  80223e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802241:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802244:	50                   	push   %eax
+  802245:	ff 75 08             	push   0x8(%ebp)
+  802248:	e8 6a f6 ff ff       	call   8018b7 <fd_lookup>
+  80224d:	89 c3                	mov    %eax,%ebx
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 5b                	js     8022b1 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802256:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802259:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80225f:	39 08                	cmp    %ecx,(%eax)
+  802261:	75 55                	jne    8022b8 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802263:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802267:	74 56                	je     8022bf <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802269:	83 ec 0c             	sub    $0xc,%esp
+  80226c:	68 04 04 91 00       	push   $0x910404
+  802271:	e8 fa 1b 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802276:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802279:	8b 40 0c             	mov    0xc(%eax),%eax
+  80227c:	a3 00 10 91 00       	mov    %eax,0x911000
+	fsipcbuf.allocate.req_offset = offset;
+  802281:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802284:	a3 04 10 91 00       	mov    %eax,0x911004
+	fsipcbuf.allocate.req_len = len;
+  802289:	8b 45 10             	mov    0x10(%ebp),%eax
+  80228c:	a3 08 10 91 00       	mov    %eax,0x911008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802291:	ba 00 00 00 00       	mov    $0x0,%edx
+  802296:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80229b:	e8 d1 fb ff ff       	call   801e71 <fsipc>
+  8022a0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022a2:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  8022a9:	e8 2f 1c 00 00       	call   803edd <mutex_unlock>
+	return r;
+  8022ae:	83 c4 10             	add    $0x10,%esp
+}
+  8022b1:	89 d8                	mov    %ebx,%eax
+  8022b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022b8:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022bd:	eb f2                	jmp    8022b1 <fallocate+0x77>
+		return -E_INVAL;
+  8022bf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022c4:	eb eb                	jmp    8022b1 <fallocate+0x77>
+
+008022c6 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+  8022cb:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022ce:	89 f3                	mov    %esi,%ebx
+  8022d0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022d6:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022d9:	eb 06                	jmp    8022e1 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022db:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022e1:	39 f3                	cmp    %esi,%ebx
+  8022e3:	73 14                	jae    8022f9 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8022e5:	83 ec 08             	sub    $0x8,%esp
+  8022e8:	53                   	push   %ebx
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	e8 41 f1 ff ff       	call   801431 <sys_page_unmap>
+  8022f0:	83 c4 10             	add    $0x10,%esp
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	79 e4                	jns    8022db <munmap+0x15>
+  8022f7:	eb 05                	jmp    8022fe <munmap+0x38>
+			return r;
+	return 0;
+  8022f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802301:	5b                   	pop    %ebx
+  802302:	5e                   	pop    %esi
+  802303:	5d                   	pop    %ebp
+  802304:	c3                   	ret
+
+00802305 <mmap>:
+{
+  802305:	55                   	push   %ebp
+  802306:	89 e5                	mov    %esp,%ebp
+  802308:	57                   	push   %edi
+  802309:	56                   	push   %esi
+  80230a:	53                   	push   %ebx
+  80230b:	83 ec 24             	sub    $0x24,%esp
+  80230e:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802311:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802314:	50                   	push   %eax
+  802315:	ff 75 08             	push   0x8(%ebp)
+  802318:	e8 9a f5 ff ff       	call   8018b7 <fd_lookup>
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	85 c0                	test   %eax,%eax
+  802322:	0f 88 37 01 00 00    	js     80245f <mmap+0x15a>
+		return NULL;
+  802328:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80232d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802330:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802336:	39 0a                	cmp    %ecx,(%edx)
+  802338:	0f 85 05 01 00 00    	jne    802443 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80233e:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802345:	0f 85 1b 01 00 00    	jne    802466 <mmap+0x161>
+  80234b:	89 f0                	mov    %esi,%eax
+  80234d:	83 e8 01             	sub    $0x1,%eax
+  802350:	0f 88 17 01 00 00    	js     80246d <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802356:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80235a:	75 28                	jne    802384 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80235c:	83 ec 0c             	sub    $0xc,%esp
+  80235f:	68 04 04 91 00       	push   $0x910404
+  802364:	e8 07 1b 00 00       	call   803e70 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802369:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80236f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80237d:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802382:	eb 2b                	jmp    8023af <mmap+0xaa>
+		cow_enable();
+  802384:	e8 6c 26 00 00       	call   8049f5 <cow_enable>
+  802389:	eb d1                	jmp    80235c <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80238b:	89 c2                	mov    %eax,%edx
+  80238d:	c1 ea 0c             	shr    $0xc,%edx
+  802390:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802397:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80239d:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8023a3:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8023a6:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023a8:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8023ad:	77 25                	ja     8023d4 <mmap+0xcf>
+  8023af:	89 c2                	mov    %eax,%edx
+  8023b1:	29 da                	sub    %ebx,%edx
+  8023b3:	39 ca                	cmp    %ecx,%edx
+  8023b5:	73 3a                	jae    8023f1 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8023b7:	89 c2                	mov    %eax,%edx
+  8023b9:	c1 ea 16             	shr    $0x16,%edx
+  8023bc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023c3:	f6 c2 01             	test   $0x1,%dl
+  8023c6:	75 c3                	jne    80238b <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8023c8:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8023cd:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8023d2:	eb d4                	jmp    8023a8 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8023d4:	29 d8                	sub    %ebx,%eax
+  8023d6:	39 c8                	cmp    %ecx,%eax
+  8023d8:	73 17                	jae    8023f1 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8023da:	83 ec 0c             	sub    $0xc,%esp
+  8023dd:	68 04 04 91 00       	push   $0x910404
+  8023e2:	e8 f6 1a 00 00       	call   803edd <mutex_unlock>
+		return NULL;
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ef:	eb 52                	jmp    802443 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023f1:	85 db                	test   %ebx,%ebx
+  8023f3:	74 e5                	je     8023da <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8023f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023fb:	a3 00 10 91 00       	mov    %eax,0x911000
+	fsipcbuf.map.req_offset = offset;
+  802400:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802403:	a3 04 10 91 00       	mov    %eax,0x911004
+	fsipcbuf.map.req_len = len;
+  802408:	89 35 08 10 91 00    	mov    %esi,0x911008
+	fsipcbuf.map.req_va = va;
+  80240e:	89 1d 0c 10 91 00    	mov    %ebx,0x91100c
+	fsipcbuf.map.req_prot = prot;
+  802414:	8b 45 14             	mov    0x14(%ebp),%eax
+  802417:	a3 10 10 91 00       	mov    %eax,0x911010
+	r = fsipc(FSREQ_MAP, NULL);
+  80241c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802421:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802426:	e8 46 fa ff ff       	call   801e71 <fsipc>
+  80242b:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80242d:	83 ec 0c             	sub    $0xc,%esp
+  802430:	68 04 04 91 00       	push   $0x910404
+  802435:	e8 a3 1a 00 00       	call   803edd <mutex_unlock>
+	if (r < 0) {
+  80243a:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80243d:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80243f:	85 ff                	test   %edi,%edi
+  802441:	78 08                	js     80244b <mmap+0x146>
+}
+  802443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802446:	5b                   	pop    %ebx
+  802447:	5e                   	pop    %esi
+  802448:	5f                   	pop    %edi
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+		munmap((void*) va, len);
+  80244b:	83 ec 08             	sub    $0x8,%esp
+  80244e:	56                   	push   %esi
+  80244f:	53                   	push   %ebx
+  802450:	e8 71 fe ff ff       	call   8022c6 <munmap>
+		return NULL;
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245d:	eb e4                	jmp    802443 <mmap+0x13e>
+		return NULL;
+  80245f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802464:	eb dd                	jmp    802443 <mmap+0x13e>
+		return NULL;
+  802466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246b:	eb d6                	jmp    802443 <mmap+0x13e>
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802472:	eb cf                	jmp    802443 <mmap+0x13e>
+
+00802474 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	53                   	push   %ebx
+  802478:	83 ec 10             	sub    $0x10,%esp
+  80247b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80247e:	53                   	push   %ebx
+  80247f:	e8 9b ea ff ff       	call   800f1f <strlen>
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80248c:	7f 42                	jg     8024d0 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	68 04 04 91 00       	push   $0x910404
+  802496:	e8 d5 19 00 00       	call   803e70 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80249b:	83 c4 08             	add    $0x8,%esp
+  80249e:	53                   	push   %ebx
+  80249f:	68 00 10 91 00       	push   $0x911000
+  8024a4:	e8 b1 ea ff ff       	call   800f5a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8024a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ae:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024b3:	e8 b9 f9 ff ff       	call   801e71 <fsipc>
+  8024b8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024ba:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  8024c1:	e8 17 1a 00 00       	call   803edd <mutex_unlock>
+	return r;
+  8024c6:	83 c4 10             	add    $0x10,%esp
+}
+  8024c9:	89 d8                	mov    %ebx,%eax
+  8024cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+		return -E_BAD_PATH;
+  8024d0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024d5:	eb f2                	jmp    8024c9 <remove+0x55>
+
+008024d7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024de:	68 04 04 91 00       	push   $0x910404
+  8024e3:	e8 88 19 00 00       	call   803e70 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8024e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024f2:	e8 7a f9 ff ff       	call   801e71 <fsipc>
+  8024f7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024f9:	c7 04 24 04 04 91 00 	movl   $0x910404,(%esp)
+  802500:	e8 d8 19 00 00       	call   803edd <mutex_unlock>
+	return r;
+}
+  802505:	89 d8                	mov    %ebx,%eax
+  802507:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+0080250c <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	56                   	push   %esi
+  802510:	53                   	push   %ebx
+  802511:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802514:	83 ec 0c             	sub    $0xc,%esp
+  802517:	68 04 04 91 00       	push   $0x910404
+  80251c:	e8 4f 19 00 00       	call   803e70 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802521:	8b 45 08             	mov    0x8(%ebp),%eax
+  802524:	a3 00 10 91 00       	mov    %eax,0x911000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802533:	e8 39 f9 ff ff       	call   801e71 <fsipc>
+  802538:	89 c6                	mov    %eax,%esi
+  80253a:	83 c4 10             	add    $0x10,%esp
+  80253d:	85 db                	test   %ebx,%ebx
+  80253f:	74 7b                	je     8025bc <fs_bcstat+0xb0>
+  802541:	85 c0                	test   %eax,%eax
+  802543:	78 77                	js     8025bc <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802545:	a1 00 10 91 00       	mov    0x911000,%eax
+  80254a:	89 03                	mov    %eax,(%ebx)
+  80254c:	a1 04 10 91 00       	mov    0x911004,%eax
+  802551:	89 43 04             	mov    %eax,0x4(%ebx)
+  802554:	a1 08 10 91 00       	mov    0x911008,%eax
+  802559:	89 43 08             	mov    %eax,0x8(%ebx)
+  80255c:	a1 0c 10 91 00       	mov    0x91100c,%eax
+  802561:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802564:	a1 10 10 91 00       	mov    0x911010,%eax
+  802569:	89 43 10             	mov    %eax,0x10(%ebx)
+  80256c:	a1 14 10 91 00       	mov    0x911014,%eax
+  802571:	89 43 14             	mov    %eax,0x14(%ebx)
+  802574:	a1 18 10 91 00       	mov    0x911018,%eax
+  802579:	89 43 18             	mov    %eax,0x18(%ebx)
+  80257c:	a1 1c 10 91 00       	mov    0x91101c,%eax
+  802581:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802584:	a1 20 10 91 00       	mov    0x911020,%eax
+  802589:	89 43 20             	mov    %eax,0x20(%ebx)
+  80258c:	a1 24 10 91 00       	mov    0x911024,%eax
+  802591:	89 43 24             	mov    %eax,0x24(%ebx)
+  802594:	a1 28 10 91 00       	mov    0x911028,%eax
+  802599:	89 43 28             	mov    %eax,0x28(%ebx)
+  80259c:	a1 2c 10 91 00       	mov    0x91102c,%eax
+  8025a1:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8025a4:	a1 30 10 91 00       	mov    0x911030,%eax
+  8025a9:	89 43 30             	mov    %eax,0x30(%ebx)
+  8025ac:	a1 34 10 91 00       	mov    0x911034,%eax
+  8025b1:	89 43 34             	mov    %eax,0x34(%ebx)
+  8025b4:	a1 38 10 91 00       	mov    0x911038,%eax
+  8025b9:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8025bc:	83 ec 0c             	sub    $0xc,%esp
+  8025bf:	68 04 04 91 00       	push   $0x910404
+  8025c4:	e8 14 19 00 00       	call   803edd <mutex_unlock>
+	return r;
+}
+  8025c9:	89 f0                	mov    %esi,%eax
+  8025cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ce:	5b                   	pop    %ebx
+  8025cf:	5e                   	pop    %esi
+  8025d0:	5d                   	pop    %ebp
+  8025d1:	c3                   	ret
+
+008025d2 <aio_fileid>:
+	return r;
+}
+
+static int
+aio_fileid(int fdnum, int *fileid)
+{
+  8025d2:	55                   	push   %ebp
+  8025d3:	89 e5                	mov    %esp,%ebp
+  8025d5:	53                   	push   %ebx
+  8025d6:	83 ec 1c             	sub    $0x1c,%esp
+  8025d9:	89 d3                	mov    %edx,%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025db:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025de:	52                   	push   %edx
+  8025df:	50                   	push   %eax
+  8025e0:	e8 d2 f2 ff ff       	call   8018b7 <fd_lookup>
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	78 17                	js     802603 <aio_fileid+0x31>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ef:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8025f5:	39 08                	cmp    %ecx,(%eax)
+  8025f7:	75 0f                	jne    802608 <aio_fileid+0x36>
+		return -E_NOT_SUPP;
+	*fileid = fd->fd_file.id;
+  8025f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025fc:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8025fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802603:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+		return -E_NOT_SUPP;
+  802608:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80260d:	eb f4                	jmp    802603 <aio_fileid+0x31>
+
+0080260f <aio_init>:
+  80260f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802611:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802617:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80261c:	77 18                	ja     802636 <aio_init+0x27>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80261e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802623:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802625:	c1 e8 10             	shr    $0x10,%eax
+  802628:	74 0c                	je     802636 <aio_init+0x27>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80262a:	c1 e0 10             	shl    $0x10,%eax
+  80262d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802632:	29 c2                	sub    %eax,%edx
+  802634:	eb 06                	jmp    80263c <aio_init+0x2d>
+		return pthread_main_tls;
+  802636:	8b 15 80 08 91 00    	mov    0x910880,%edx
+	if (aio_pgdir == thisenv->env_pgdir)
+  80263c:	8b 02                	mov    (%edx),%eax
+  80263e:	8b 50 60             	mov    0x60(%eax),%edx
+		return 0;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (aio_pgdir == thisenv->env_pgdir)
+  802646:	3b 15 28 04 91 00    	cmp    0x910428,%edx
+  80264c:	0f 84 b9 00 00 00    	je     80270b <aio_init+0xfc>
+{
+  802652:	55                   	push   %ebp
+  802653:	89 e5                	mov    %esp,%ebp
+  802655:	53                   	push   %ebx
+  802656:	83 ec 08             	sub    $0x8,%esp
+	memset(aios, 0, sizeof aios);
+  802659:	68 80 01 00 00       	push   $0x180
+  80265e:	6a 00                	push   $0x0
+  802660:	68 40 04 91 00       	push   $0x910440
+  802665:	e8 41 ea ff ff       	call   8010ab <memset>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (void*) (AIOVA + i * PGSIZE), AIO_PERM)) < 0)
+  802672:	83 ec 04             	sub    $0x4,%esp
+  802675:	68 07 04 00 00       	push   $0x407
+  80267a:	53                   	push   %ebx
+  80267b:	6a 00                	push   $0x0
+  80267d:	e8 16 ed ff ff       	call   801398 <sys_page_alloc>
+  802682:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802688:	83 c4 10             	add    $0x10,%esp
+  80268b:	85 c0                	test   %eax,%eax
+  80268d:	78 77                	js     802706 <aio_init+0xf7>
+	for (i = 0; i <= AIO_MAX; i++)
+  80268f:	81 fb 00 10 02 cf    	cmp    $0xcf021000,%ebx
+  802695:	75 db                	jne    802672 <aio_init+0x63>
+	aio_fsenv = ipc_find_env(ENV_TYPE_FS);
+  802697:	83 ec 0c             	sub    $0xc,%esp
+  80269a:	6a 01                	push   $0x1
+  80269c:	e8 11 29 00 00       	call   804fb2 <ipc_find_env>
+  8026a1:	a3 24 04 91 00       	mov    %eax,0x910424
+	ipc_send(aio_fsenv, FSREQ_AIO_SETUP, aio_cq, PTE_P | PTE_W | PTE_U);
+  8026a6:	6a 07                	push   $0x7
+  8026a8:	68 00 00 00 cf       	push   $0xcf000000
+  8026ad:	6a 0f                	push   $0xf
+  8026af:	50                   	push   %eax
+  8026b0:	e8 a7 28 00 00       	call   804f5c <ipc_send>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026b5:	83 c4 1c             	add    $0x1c,%esp
+  8026b8:	6a 00                	push   $0x0
+  8026ba:	6a 00                	push   $0x0
+  8026bc:	6a 00                	push   $0x0
+  8026be:	e8 a3 27 00 00       	call   804e66 <ipc_recv>
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	85 c0                	test   %eax,%eax
+  8026c8:	78 3c                	js     802706 <aio_init+0xf7>
+  8026ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8026cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8026d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8026d7:	77 18                	ja     8026f1 <aio_init+0xe2>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8026d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8026de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8026e0:	c1 e8 10             	shr    $0x10,%eax
+  8026e3:	74 0c                	je     8026f1 <aio_init+0xe2>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8026e5:	c1 e0 10             	shl    $0x10,%eax
+  8026e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8026ed:	29 c2                	sub    %eax,%edx
+  8026ef:	eb 06                	jmp    8026f7 <aio_init+0xe8>
+		return pthread_main_tls;
+  8026f1:	8b 15 80 08 91 00    	mov    0x910880,%edx
+	aio_pgdir = thisenv->env_pgdir;
+  8026f7:	8b 02                	mov    (%edx),%eax
+  8026f9:	8b 40 60             	mov    0x60(%eax),%eax
+  8026fc:	a3 28 04 91 00       	mov    %eax,0x910428
+	return 0;
+  802701:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802706:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802709:	c9                   	leave
+  80270a:	c3                   	ret
+  80270b:	c3                   	ret
+
+0080270c <aio_alloc>:
+{
+  80270c:	55                   	push   %ebp
+  80270d:	89 e5                	mov    %esp,%ebp
+  80270f:	56                   	push   %esi
+  802710:	53                   	push   %ebx
+  802711:	89 c6                	mov    %eax,%esi
+	mutex_lock(&aio_mu);
+  802713:	83 ec 0c             	sub    $0xc,%esp
+  802716:	68 20 04 91 00       	push   $0x910420
+  80271b:	e8 50 17 00 00       	call   803e70 <mutex_lock>
+	if ((r = aio_init()) < 0)
+  802720:	e8 ea fe ff ff       	call   80260f <aio_init>
+  802725:	89 c3                	mov    %eax,%ebx
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	78 38                	js     802766 <aio_alloc+0x5a>
+  80272e:	b8 40 04 91 00       	mov    $0x910440,%eax
+	for (id = 0; id < AIO_MAX; id++)
+  802733:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (aios[id].a_state == AIO_FREE) {
+  802738:	83 c0 0c             	add    $0xc,%eax
+  80273b:	83 78 f4 00          	cmpl   $0x0,-0xc(%eax)
+  80273f:	74 0f                	je     802750 <aio_alloc+0x44>
+	for (id = 0; id < AIO_MAX; id++)
+  802741:	83 c3 01             	add    $0x1,%ebx
+  802744:	83 fb 20             	cmp    $0x20,%ebx
+  802747:	75 ef                	jne    802738 <aio_alloc+0x2c>
+	r = -E_AGAIN;
+  802749:	bb ed ff ff ff       	mov    $0xffffffed,%ebx
+  80274e:	eb 16                	jmp    802766 <aio_alloc+0x5a>
+			aios[id].a_state = AIO_PENDING;
+  802750:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802753:	c1 e0 02             	shl    $0x2,%eax
+  802756:	c7 80 40 04 91 00 01 	movl   $0x1,0x910440(%eax)
+  80275d:	00 00 00 
+			aios[id].a_buf = buf;
+  802760:	89 b0 48 04 91 00    	mov    %esi,0x910448(%eax)
+	mutex_unlock(&aio_mu);
+  802766:	83 ec 0c             	sub    $0xc,%esp
+  802769:	68 20 04 91 00       	push   $0x910420
+  80276e:	e8 6a 17 00 00       	call   803edd <mutex_unlock>
+}
+  802773:	89 d8                	mov    %ebx,%eax
+  802775:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802778:	5b                   	pop    %ebx
+  802779:	5e                   	pop    %esi
+  80277a:	5d                   	pop    %ebp
+  80277b:	c3                   	ret
+
+0080277c <aio_complete>:
+
+// Wait until request id is done, or any request if id is -1, then
+// free its slot and return its result, storing its id in *id_store.
+static int
+aio_complete(int id, int *id_store)
+{
+  80277c:	55                   	push   %ebp
+  80277d:	89 e5                	mov    %esp,%ebp
+  80277f:	57                   	push   %edi
+  802780:	56                   	push   %esi
+  802781:	53                   	push   %ebx
+  802782:	83 ec 28             	sub    $0x28,%esp
+  802785:	89 c7                	mov    %eax,%edi
+  802787:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint32_t tail;
+	int i, r;
+
+	mutex_lock(&aio_mu);
+  80278a:	68 20 04 91 00       	push   $0x910420
+  80278f:	e8 dc 16 00 00       	call   803e70 <mutex_lock>
+	if ((r = aio_init()) < 0)
+  802794:	e8 76 fe ff ff       	call   80260f <aio_init>
+  802799:	89 c3                	mov    %eax,%ebx
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	85 c0                	test   %eax,%eax
+  8027a0:	0f 88 ec 00 00 00    	js     802892 <aio_complete+0x116>
+		goto out;
+	while (1) {
+		aio_drain();
+		r = -E_INVAL;
+		for (i = 0; i < AIO_MAX; i++) {
+			if (id >= 0 && i != id)
+  8027a6:	89 fe                	mov    %edi,%esi
+  8027a8:	f7 d6                	not    %esi
+  8027aa:	c1 ee 1f             	shr    $0x1f,%esi
+  8027ad:	89 f3                	mov    %esi,%ebx
+  8027af:	eb 1b                	jmp    8027cc <aio_complete+0x50>
+			a->a_state = AIO_DONE;
+  8027b1:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  8027b4:	c7 04 85 40 04 91 00 	movl   $0x2,0x910440(,%eax,4)
+  8027bb:	02 00 00 00 
+		aio_cq->cq_head++;
+  8027bf:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8027c4:	83 c0 01             	add    $0x1,%eax
+  8027c7:	a3 00 00 00 cf       	mov    %eax,0xcf000000
+	while (aio_cq->cq_head != aio_cq->cq_tail) {
+  8027cc:	8b 15 00 00 00 cf    	mov    0xcf000000,%edx
+  8027d2:	a1 04 00 00 cf       	mov    0xcf000004,%eax
+  8027d7:	39 c2                	cmp    %eax,%edx
+  8027d9:	74 5e                	je     802839 <aio_complete+0xbd>
+		cqe = &aio_cq->cq[aio_cq->cq_head % FSAIO_NCQE];
+  8027db:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8027e0:	0f b6 c0             	movzbl %al,%eax
+  8027e3:	8d 04 c5 00 00 00 cf 	lea    -0x31000000(,%eax,8),%eax
+		if (cqe->cqe_tag < AIO_MAX
+  8027ea:	8b 70 08             	mov    0x8(%eax),%esi
+  8027ed:	83 fe 1f             	cmp    $0x1f,%esi
+  8027f0:	77 cd                	ja     8027bf <aio_complete+0x43>
+		    && aios[cqe->cqe_tag].a_state == AIO_PENDING) {
+  8027f2:	8d 14 76             	lea    (%esi,%esi,2),%edx
+  8027f5:	83 3c 95 40 04 91 00 	cmpl   $0x1,0x910440(,%edx,4)
+  8027fc:	01 
+  8027fd:	75 c0                	jne    8027bf <aio_complete+0x43>
+			a->a_res = cqe->cqe_res;
+  8027ff:	8b 50 0c             	mov    0xc(%eax),%edx
+  802802:	8d 0c 76             	lea    (%esi,%esi,2),%ecx
+  802805:	8d 0c 8d 40 04 91 00 	lea    0x910440(,%ecx,4),%ecx
+  80280c:	89 51 04             	mov    %edx,0x4(%ecx)
+			if (a->a_buf && a->a_res > 0)
+  80280f:	8b 49 08             	mov    0x8(%ecx),%ecx
+  802812:	85 d2                	test   %edx,%edx
+  802814:	7e 9b                	jle    8027b1 <aio_complete+0x35>
+  802816:	85 c9                	test   %ecx,%ecx
+  802818:	74 97                	je     8027b1 <aio_complete+0x35>
+				memmove(a->a_buf, aio_page(cqe->cqe_tag)->readRet.ret_buf, a->a_res);
+  80281a:	83 ec 04             	sub    $0x4,%esp
+  80281d:	52                   	push   %edx
+	return (union Fsipc*) (AIOVA + (id + 1) * PGSIZE);
+  80281e:	8b 40 08             	mov    0x8(%eax),%eax
+  802821:	c1 e0 0c             	shl    $0xc,%eax
+  802824:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+				memmove(a->a_buf, aio_page(cqe->cqe_tag)->readRet.ret_buf, a->a_res);
+  80282a:	50                   	push   %eax
+  80282b:	51                   	push   %ecx
+  80282c:	e8 af e8 ff ff       	call   8010e0 <memmove>
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	e9 78 ff ff ff       	jmp    8027b1 <aio_complete+0x35>
+		r = -E_INVAL;
+  802839:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+		for (i = 0; i < AIO_MAX; i++) {
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802843:	eb 22                	jmp    802867 <aio_complete+0xeb>
+				continue;
+			if (aios[i].a_state == AIO_DONE)
+  802845:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802848:	8b 14 95 40 04 91 00 	mov    0x910440(,%edx,4),%edx
+  80284f:	83 fa 02             	cmp    $0x2,%edx
+  802852:	74 1d                	je     802871 <aio_complete+0xf5>
+				goto done;
+			if (aios[i].a_state == AIO_PENDING)
+				r = 0;
+  802854:	83 fa 01             	cmp    $0x1,%edx
+  802857:	be 00 00 00 00       	mov    $0x0,%esi
+  80285c:	0f 44 ce             	cmove  %esi,%ecx
+		for (i = 0; i < AIO_MAX; i++) {
+  80285f:	83 c0 01             	add    $0x1,%eax
+  802862:	83 f8 20             	cmp    $0x20,%eax
+  802865:	74 42                	je     8028a9 <aio_complete+0x12d>
+			if (id >= 0 && i != id)
+  802867:	84 db                	test   %bl,%bl
+  802869:	74 da                	je     802845 <aio_complete+0xc9>
+  80286b:	39 c7                	cmp    %eax,%edi
+  80286d:	74 d6                	je     802845 <aio_complete+0xc9>
+  80286f:	eb ee                	jmp    80285f <aio_complete+0xe3>
+		mutex_unlock(&aio_mu);
+		sys_futex_wait(&aio_cq->cq_tail, tail, 0);
+		mutex_lock(&aio_mu);
+	}
+done:
+	aios[i].a_state = AIO_FREE;
+  802871:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802874:	c1 e2 02             	shl    $0x2,%edx
+  802877:	c7 82 40 04 91 00 00 	movl   $0x0,0x910440(%edx)
+  80287e:	00 00 00 
+	r = aios[i].a_res;
+  802881:	8b 9a 44 04 91 00    	mov    0x910444(%edx),%ebx
+	if (id_store)
+  802887:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80288b:	74 05                	je     802892 <aio_complete+0x116>
+		*id_store = i;
+  80288d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802890:	89 07                	mov    %eax,(%edi)
+out:
+	mutex_unlock(&aio_mu);
+  802892:	83 ec 0c             	sub    $0xc,%esp
+  802895:	68 20 04 91 00       	push   $0x910420
+  80289a:	e8 3e 16 00 00       	call   803edd <mutex_unlock>
+	return r;
+}
+  80289f:	89 d8                	mov    %ebx,%eax
+  8028a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a4:	5b                   	pop    %ebx
+  8028a5:	5e                   	pop    %esi
+  8028a6:	5f                   	pop    %edi
+  8028a7:	5d                   	pop    %ebp
+  8028a8:	c3                   	ret
+		if (r < 0)
+  8028a9:	85 c9                	test   %ecx,%ecx
+  8028ab:	78 44                	js     8028f1 <aio_complete+0x175>
+		tail = aio_cq->cq_tail;
+  8028ad:	8b 35 04 00 00 cf    	mov    0xcf000004,%esi
+		if (tail != aio_cq->cq_head)
+  8028b3:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8028b8:	39 f0                	cmp    %esi,%eax
+  8028ba:	0f 85 0c ff ff ff    	jne    8027cc <aio_complete+0x50>
+		mutex_unlock(&aio_mu);
+  8028c0:	83 ec 0c             	sub    $0xc,%esp
+  8028c3:	68 20 04 91 00       	push   $0x910420
+  8028c8:	e8 10 16 00 00       	call   803edd <mutex_unlock>
+		sys_futex_wait(&aio_cq->cq_tail, tail, 0);
+  8028cd:	83 c4 0c             	add    $0xc,%esp
+  8028d0:	6a 00                	push   $0x0
+  8028d2:	56                   	push   %esi
+  8028d3:	68 04 00 00 cf       	push   $0xcf000004
+  8028d8:	e8 d0 ed ff ff       	call   8016ad <sys_futex_wait>
+		mutex_lock(&aio_mu);
+  8028dd:	c7 04 24 20 04 91 00 	movl   $0x910420,(%esp)
+  8028e4:	e8 87 15 00 00       	call   803e70 <mutex_lock>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	e9 db fe ff ff       	jmp    8027cc <aio_complete+0x50>
+  8028f1:	89 cb                	mov    %ecx,%ebx
+  8028f3:	eb 9d                	jmp    802892 <aio_complete+0x116>
+
+008028f5 <aio_read>:
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	57                   	push   %edi
+  8028f9:	56                   	push   %esi
+  8028fa:	53                   	push   %ebx
+  8028fb:	83 ec 1c             	sub    $0x1c,%esp
+  8028fe:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((r = aio_fileid(fdnum, &fileid)) < 0)
+  802901:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  802904:	8b 45 08             	mov    0x8(%ebp),%eax
+  802907:	e8 c6 fc ff ff       	call   8025d2 <aio_fileid>
+  80290c:	89 c3                	mov    %eax,%ebx
+  80290e:	85 c0                	test   %eax,%eax
+  802910:	78 53                	js     802965 <aio_read+0x70>
+	if (offset < 0)
+  802912:	85 f6                	test   %esi,%esi
+  802914:	78 59                	js     80296f <aio_read+0x7a>
+	if ((id = aio_alloc(buf)) < 0)
+  802916:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802919:	e8 ee fd ff ff       	call   80270c <aio_alloc>
+  80291e:	89 c3                	mov    %eax,%ebx
+  802920:	85 c0                	test   %eax,%eax
+  802922:	78 41                	js     802965 <aio_read+0x70>
+	return (union Fsipc*) (AIOVA + (id + 1) * PGSIZE);
+  802924:	8d 40 01             	lea    0x1(%eax),%eax
+  802927:	89 c2                	mov    %eax,%edx
+  802929:	c1 e2 0c             	shl    $0xc,%edx
+  80292c:	8d 8a 00 00 00 cf    	lea    -0x31000000(%edx),%ecx
+	ipc->pread.req_fileid = fileid;
+  802932:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802935:	89 ba 00 00 00 cf    	mov    %edi,-0x31000000(%edx)
+	ipc->pread.req_n = MIN(n, sizeof(ipc->readRet.ret_buf));
+  80293b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802940:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802943:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802947:	89 51 04             	mov    %edx,0x4(%ecx)
+	ipc->pread.req_offset = offset;
+  80294a:	89 71 08             	mov    %esi,0x8(%ecx)
+	ipc_send(aio_fsenv, FSAIO(FSREQ_PREAD, id), ipc, PTE_P | PTE_W | PTE_U);
+  80294d:	6a 07                	push   $0x7
+  80294f:	51                   	push   %ecx
+  802950:	c1 e0 10             	shl    $0x10,%eax
+  802953:	83 c8 0d             	or     $0xd,%eax
+  802956:	50                   	push   %eax
+  802957:	ff 35 24 04 91 00    	push   0x910424
+  80295d:	e8 fa 25 00 00       	call   804f5c <ipc_send>
+	return id;
+  802962:	83 c4 10             	add    $0x10,%esp
+}
+  802965:	89 d8                	mov    %ebx,%eax
+  802967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296a:	5b                   	pop    %ebx
+  80296b:	5e                   	pop    %esi
+  80296c:	5f                   	pop    %edi
+  80296d:	5d                   	pop    %ebp
+  80296e:	c3                   	ret
+		return -E_INVAL;
+  80296f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802974:	eb ef                	jmp    802965 <aio_read+0x70>
+
+00802976 <aio_write>:
+{
+  802976:	55                   	push   %ebp
+  802977:	89 e5                	mov    %esp,%ebp
+  802979:	57                   	push   %edi
+  80297a:	56                   	push   %esi
+  80297b:	53                   	push   %ebx
+  80297c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = aio_fileid(fdnum, &fileid)) < 0)
+  80297f:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  802982:	8b 45 08             	mov    0x8(%ebp),%eax
+  802985:	e8 48 fc ff ff       	call   8025d2 <aio_fileid>
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	78 73                	js     802a03 <aio_write+0x8d>
+	if (offset < 0)
+  802990:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802994:	78 77                	js     802a0d <aio_write+0x97>
+	if ((id = aio_alloc(NULL)) < 0)
+  802996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299b:	e8 6c fd ff ff       	call   80270c <aio_alloc>
+  8029a0:	89 c3                	mov    %eax,%ebx
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 5d                	js     802a03 <aio_write+0x8d>
+	return (union Fsipc*) (AIOVA + (id + 1) * PGSIZE);
+  8029a6:	8d 70 01             	lea    0x1(%eax),%esi
+  8029a9:	89 f2                	mov    %esi,%edx
+  8029ab:	c1 e2 0c             	shl    $0xc,%edx
+  8029ae:	8d ba 00 00 00 cf    	lea    -0x31000000(%edx),%edi
+	ipc->pwrite.req_fileid = fileid;
+  8029b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029b7:	89 82 00 00 00 cf    	mov    %eax,-0x31000000(%edx)
+	ipc->pwrite.req_n = MIN(n, sizeof(ipc->pwrite.req_buf));
+  8029bd:	b8 f4 0f 00 00       	mov    $0xff4,%eax
+  8029c2:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8029c5:	0f 46 45 10          	cmovbe 0x10(%ebp),%eax
+  8029c9:	89 82 04 00 00 cf    	mov    %eax,-0x30fffffc(%edx)
+	ipc->pwrite.req_offset = offset;
+  8029cf:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8029d2:	89 8a 08 00 00 cf    	mov    %ecx,-0x30fffff8(%edx)
+	memmove(ipc->pwrite.req_buf, buf, ipc->pwrite.req_n);
+  8029d8:	83 ec 04             	sub    $0x4,%esp
+  8029db:	50                   	push   %eax
+  8029dc:	ff 75 0c             	push   0xc(%ebp)
+  8029df:	81 ea f4 ff ff 30    	sub    $0x30fffff4,%edx
+  8029e5:	52                   	push   %edx
+  8029e6:	e8 f5 e6 ff ff       	call   8010e0 <memmove>
+	ipc_send(aio_fsenv, FSAIO(FSREQ_PWRITE, id), ipc, PTE_P | PTE_W | PTE_U);
+  8029eb:	6a 07                	push   $0x7
+  8029ed:	57                   	push   %edi
+  8029ee:	c1 e6 10             	shl    $0x10,%esi
+  8029f1:	83 ce 0e             	or     $0xe,%esi
+  8029f4:	56                   	push   %esi
+  8029f5:	ff 35 24 04 91 00    	push   0x910424
+  8029fb:	e8 5c 25 00 00       	call   804f5c <ipc_send>
+	return id;
+  802a00:	83 c4 20             	add    $0x20,%esp
+}
+  802a03:	89 d8                	mov    %ebx,%eax
+  802a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a08:	5b                   	pop    %ebx
+  802a09:	5e                   	pop    %esi
+  802a0a:	5f                   	pop    %edi
+  802a0b:	5d                   	pop    %ebp
+  802a0c:	c3                   	ret
+		return -E_INVAL;
+  802a0d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a12:	eb ef                	jmp    802a03 <aio_write+0x8d>
+
+00802a14 <aio_wait>:
+// Wait for request id to finish and return its result: the number of
+// bytes read or written, or < 0 on error.  -E_INVAL if id is not an
+// outstanding request.
+int
+aio_wait(int id)
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	83 ec 08             	sub    $0x8,%esp
+  802a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (id < 0 || id >= AIO_MAX)
+  802a1d:	83 f8 1f             	cmp    $0x1f,%eax
+  802a20:	77 0c                	ja     802a2e <aio_wait+0x1a>
+		return -E_INVAL;
+	return aio_complete(id, NULL);
+  802a22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a27:	e8 50 fd ff ff       	call   80277c <aio_complete>
+}
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+		return -E_INVAL;
+  802a2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a33:	eb f7                	jmp    802a2c <aio_wait+0x18>
+
+00802a35 <aio_reap>:
+
+// Wait for any outstanding request to finish, store its id in
+// *id_store and return its result as for aio_wait.
+int
+aio_reap(int *id_store)
+{
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	83 ec 08             	sub    $0x8,%esp
+	return aio_complete(-1, id_store);
+  802a3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a3e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a43:	e8 34 fd ff ff       	call   80277c <aio_complete>
+}
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+
+00802a4a <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802a4a:	55                   	push   %ebp
+  802a4b:	89 e5                	mov    %esp,%ebp
+  802a4d:	56                   	push   %esi
+  802a4e:	53                   	push   %ebx
+  802a4f:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802a51:	0f b6 10             	movzbl (%eax),%edx
+  802a54:	80 fa 72             	cmp    $0x72,%dl
+  802a57:	74 44                	je     802a9d <parse_mode+0x53>
+  802a59:	80 fa 77             	cmp    $0x77,%dl
+  802a5c:	74 4b                	je     802aa9 <parse_mode+0x5f>
+  802a5e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a63:	80 fa 61             	cmp    $0x61,%dl
+  802a66:	74 09                	je     802a71 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802a68:	89 d8                	mov    %ebx,%eax
+  802a6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a6d:	5b                   	pop    %ebx
+  802a6e:	5e                   	pop    %esi
+  802a6f:	5d                   	pop    %ebp
+  802a70:	c3                   	ret
+	switch (mode[0]) {
+  802a71:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802a76:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802a7b:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802a7d:	83 ec 08             	sub    $0x8,%esp
+  802a80:	6a 2b                	push   $0x2b
+  802a82:	50                   	push   %eax
+  802a83:	e8 e4 e5 ff ff       	call   80106c <strchr>
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	85 c0                	test   %eax,%eax
+  802a8d:	74 d9                	je     802a68 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802a8f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802a92:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802a95:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802a9b:	eb cb                	jmp    802a68 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802a9d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802aa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa7:	eb d2                	jmp    802a7b <parse_mode+0x31>
+  802aa9:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802aae:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802ab3:	eb c6                	jmp    802a7b <parse_mode+0x31>
+
+00802ab5 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	57                   	push   %edi
+  802ab9:	56                   	push   %esi
+  802aba:	53                   	push   %ebx
+  802abb:	83 ec 1c             	sub    $0x1c,%esp
+  802abe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ac1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802ac4:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802ac9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802ace:	83 c0 24             	add    $0x24,%eax
+  802ad1:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802ad5:	74 17                	je     802aee <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802ad7:	83 c3 01             	add    $0x1,%ebx
+  802ada:	83 fb 10             	cmp    $0x10,%ebx
+  802add:	75 ef                	jne    802ace <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802adf:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802ae4:	89 f0                	mov    %esi,%eax
+  802ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5f                   	pop    %edi
+  802aec:	5d                   	pop    %ebp
+  802aed:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802aee:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802af5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802af8:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802afb:	c1 e7 02             	shl    $0x2,%edi
+  802afe:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802b04:	83 ec 04             	sub    $0x4,%esp
+  802b07:	6a 24                	push   $0x24
+  802b09:	6a 00                	push   $0x0
+  802b0b:	56                   	push   %esi
+  802b0c:	e8 9a e5 ff ff       	call   8010ab <memset>
+			streams[i].f_fd = fd;
+  802b11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b14:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802b1a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b1d:	01 d8                	add    %ebx,%eax
+  802b1f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b22:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	eb b6                	jmp    802ae4 <stream_alloc+0x2f>
+
+00802b2e <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	53                   	push   %ebx
+  802b32:	83 ec 14             	sub    $0x14,%esp
+  802b35:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802b37:	8b 40 18             	mov    0x18(%eax),%eax
+  802b3a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802b3d:	74 4a                	je     802b89 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802b3f:	83 ec 08             	sub    $0x8,%esp
+  802b42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b45:	50                   	push   %eax
+  802b46:	ff 33                	push   (%ebx)
+  802b48:	e8 6a ed ff ff       	call   8018b7 <fd_lookup>
+  802b4d:	89 c2                	mov    %eax,%edx
+  802b4f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b52:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802b57:	85 d2                	test   %edx,%edx
+  802b59:	78 41                	js     802b9c <stream_unread+0x6e>
+  802b5b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b5e:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802b64:	39 0a                	cmp    %ecx,(%edx)
+  802b66:	75 34                	jne    802b9c <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802b68:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b6b:	03 42 04             	add    0x4(%edx),%eax
+  802b6e:	2b 43 18             	sub    0x18(%ebx),%eax
+  802b71:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802b74:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802b7b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802b82:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b87:	eb 13                	jmp    802b9c <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802b89:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802b90:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802b97:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+00802ba1 <stream_drain>:
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	56                   	push   %esi
+  802ba5:	53                   	push   %ebx
+  802ba6:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802ba8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bad:	eb 02                	jmp    802bb1 <stream_drain+0x10>
+  802baf:	01 c3                	add    %eax,%ebx
+  802bb1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802bb4:	39 c3                	cmp    %eax,%ebx
+  802bb6:	73 43                	jae    802bfb <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802bb8:	83 ec 04             	sub    $0x4,%esp
+  802bbb:	29 d8                	sub    %ebx,%eax
+  802bbd:	50                   	push   %eax
+  802bbe:	89 d8                	mov    %ebx,%eax
+  802bc0:	03 46 0c             	add    0xc(%esi),%eax
+  802bc3:	50                   	push   %eax
+  802bc4:	ff 36                	push   (%esi)
+  802bc6:	e8 74 f0 ff ff       	call   801c3f <write>
+  802bcb:	83 c4 10             	add    $0x10,%esp
+  802bce:	85 c0                	test   %eax,%eax
+  802bd0:	7f dd                	jg     802baf <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802bd2:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802bd6:	8b 56 0c             	mov    0xc(%esi),%edx
+  802bd9:	83 ec 04             	sub    $0x4,%esp
+  802bdc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802bdf:	29 d8                	sub    %ebx,%eax
+  802be1:	50                   	push   %eax
+  802be2:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802be5:	50                   	push   %eax
+  802be6:	52                   	push   %edx
+  802be7:	e8 f4 e4 ff ff       	call   8010e0 <memmove>
+			f->f_wend -= done;
+  802bec:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802bef:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802bf1:	83 c4 10             	add    $0x10,%esp
+  802bf4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802bf9:	eb 0a                	jmp    802c05 <stream_drain+0x64>
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802c00:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802c05:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802c08:	89 d0                	mov    %edx,%eax
+  802c0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c0d:	5b                   	pop    %ebx
+  802c0e:	5e                   	pop    %esi
+  802c0f:	5d                   	pop    %ebp
+  802c10:	c3                   	ret
+
+00802c11 <stream_setup>:
+	if (f->f_buf)
+  802c11:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802c15:	74 01                	je     802c18 <stream_setup+0x7>
+  802c17:	c3                   	ret
+{
+  802c18:	55                   	push   %ebp
+  802c19:	89 e5                	mov    %esp,%ebp
+  802c1b:	53                   	push   %ebx
+  802c1c:	83 ec 04             	sub    $0x4,%esp
+  802c1f:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802c21:	8b 40 08             	mov    0x8(%eax),%eax
+  802c24:	85 c0                	test   %eax,%eax
+  802c26:	74 17                	je     802c3f <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802c28:	83 f8 03             	cmp    $0x3,%eax
+  802c2b:	75 2d                	jne    802c5a <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802c2d:	8d 43 20             	lea    0x20(%ebx),%eax
+  802c30:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802c33:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802c3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3d:	c9                   	leave
+  802c3e:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802c3f:	83 ec 0c             	sub    $0xc,%esp
+  802c42:	ff 33                	push   (%ebx)
+  802c44:	e8 29 1b 00 00       	call   804772 <iscons>
+  802c49:	83 c4 10             	add    $0x10,%esp
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	0f 9f c0             	setg   %al
+  802c51:	0f b6 c0             	movzbl %al,%eax
+  802c54:	83 c0 01             	add    $0x1,%eax
+  802c57:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802c5a:	83 ec 0c             	sub    $0xc,%esp
+  802c5d:	68 00 10 00 00       	push   $0x1000
+  802c62:	e8 6e 0b 00 00       	call   8037d5 <malloc>
+  802c67:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	74 bc                	je     802c2d <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802c71:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802c78:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802c7c:	eb bc                	jmp    802c3a <stream_setup+0x29>
+
+00802c7e <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802c7e:	55                   	push   %ebp
+  802c7f:	89 e5                	mov    %esp,%ebp
+  802c81:	53                   	push   %ebx
+  802c82:	83 ec 04             	sub    $0x4,%esp
+  802c85:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802c87:	e8 85 ff ff ff       	call   802c11 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802c91:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802c95:	74 3d                	je     802cd4 <stream_fill+0x56>
+  802c97:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802c9b:	74 10                	je     802cad <stream_fill+0x2f>
+  802c9d:	89 d8                	mov    %ebx,%eax
+  802c9f:	e8 fd fe ff ff       	call   802ba1 <stream_drain>
+		return 0;
+  802ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802ca9:	85 c0                	test   %eax,%eax
+  802cab:	78 27                	js     802cd4 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	ff 73 10             	push   0x10(%ebx)
+  802cb3:	ff 73 0c             	push   0xc(%ebx)
+  802cb6:	ff 33                	push   (%ebx)
+  802cb8:	e8 8a ee ff ff       	call   801b47 <read>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	7e 17                	jle    802cdb <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802cc4:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802cc8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802ccf:	89 c2                	mov    %eax,%edx
+  802cd1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802cd4:	89 d0                	mov    %edx,%eax
+  802cd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd9:	c9                   	leave
+  802cda:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802cdb:	c1 f8 1f             	sar    $0x1f,%eax
+  802cde:	83 e0 04             	and    $0x4,%eax
+  802ce1:	83 c0 04             	add    $0x4,%eax
+  802ce4:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cec:	eb e6                	jmp    802cd4 <stream_fill+0x56>
+
+00802cee <fopen>:
+{
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	57                   	push   %edi
+  802cf2:	56                   	push   %esi
+  802cf3:	53                   	push   %ebx
+  802cf4:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802cfa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802cfd:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802d03:	89 f0                	mov    %esi,%eax
+  802d05:	e8 40 fd ff ff       	call   802a4a <parse_mode>
+		return 0;
+  802d0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	78 2d                	js     802d40 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802d13:	83 ec 08             	sub    $0x8,%esp
+  802d16:	50                   	push   %eax
+  802d17:	ff 75 08             	push   0x8(%ebp)
+  802d1a:	e8 70 f4 ff ff       	call   80218f <open>
+  802d1f:	89 c7                	mov    %eax,%edi
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	85 c0                	test   %eax,%eax
+  802d26:	78 58                	js     802d80 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802d28:	80 3e 61             	cmpb   $0x61,(%esi)
+  802d2b:	74 1d                	je     802d4a <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802d2d:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802d33:	89 f8                	mov    %edi,%eax
+  802d35:	e8 7b fd ff ff       	call   802ab5 <stream_alloc>
+  802d3a:	89 c3                	mov    %eax,%ebx
+  802d3c:	85 c0                	test   %eax,%eax
+  802d3e:	74 32                	je     802d72 <fopen+0x84>
+}
+  802d40:	89 d8                	mov    %ebx,%eax
+  802d42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d45:	5b                   	pop    %ebx
+  802d46:	5e                   	pop    %esi
+  802d47:	5f                   	pop    %edi
+  802d48:	5d                   	pop    %ebp
+  802d49:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802d4a:	83 ec 08             	sub    $0x8,%esp
+  802d4d:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802d53:	50                   	push   %eax
+  802d54:	57                   	push   %edi
+  802d55:	e8 63 f0 ff ff       	call   801dbd <fstat>
+  802d5a:	83 c4 10             	add    $0x10,%esp
+  802d5d:	85 c0                	test   %eax,%eax
+  802d5f:	78 cc                	js     802d2d <fopen+0x3f>
+		seek(fd, st.st_size);
+  802d61:	83 ec 08             	sub    $0x8,%esp
+  802d64:	ff 75 dc             	push   -0x24(%ebp)
+  802d67:	57                   	push   %edi
+  802d68:	e8 7e ef ff ff       	call   801ceb <seek>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	eb bb                	jmp    802d2d <fopen+0x3f>
+		close(fd);
+  802d72:	83 ec 0c             	sub    $0xc,%esp
+  802d75:	57                   	push   %edi
+  802d76:	e8 90 ec ff ff       	call   801a0b <close>
+  802d7b:	83 c4 10             	add    $0x10,%esp
+  802d7e:	eb c0                	jmp    802d40 <fopen+0x52>
+		return 0;
+  802d80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d85:	eb b9                	jmp    802d40 <fopen+0x52>
+
+00802d87 <fdopen>:
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802d8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802d90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d93:	e8 b2 fc ff ff       	call   802a4a <parse_mode>
+  802d98:	89 c2                	mov    %eax,%edx
+		return 0;
+  802d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802d9f:	85 d2                	test   %edx,%edx
+  802da1:	78 0b                	js     802dae <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802da3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da9:	e8 07 fd ff ff       	call   802ab5 <stream_alloc>
+}
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+00802db0 <setvbuf>:
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	57                   	push   %edi
+  802db4:	56                   	push   %esi
+  802db5:	53                   	push   %ebx
+  802db6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db9:	8b 55 10             	mov    0x10(%ebp),%edx
+  802dbc:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802dbf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802dc3:	75 3a                	jne    802dff <setvbuf+0x4f>
+  802dc5:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802dc8:	83 fe 02             	cmp    $0x2,%esi
+  802dcb:	77 39                	ja     802e06 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802dcd:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802dd0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802dd4:	0f 95 c3             	setne  %bl
+  802dd7:	85 ff                	test   %edi,%edi
+  802dd9:	0f 95 c1             	setne  %cl
+  802ddc:	84 cb                	test   %cl,%bl
+  802dde:	74 05                	je     802de5 <setvbuf+0x35>
+  802de0:	83 fa 03             	cmp    $0x3,%edx
+  802de3:	75 0a                	jne    802def <setvbuf+0x3f>
+	return 0;
+  802de5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dea:	5b                   	pop    %ebx
+  802deb:	5e                   	pop    %esi
+  802dec:	5f                   	pop    %edi
+  802ded:	5d                   	pop    %ebp
+  802dee:	c3                   	ret
+		f->f_buf = buf;
+  802def:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802df2:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802df5:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfd:	eb eb                	jmp    802dea <setvbuf+0x3a>
+		return EOF;
+  802dff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e04:	eb e4                	jmp    802dea <setvbuf+0x3a>
+  802e06:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e0b:	eb dd                	jmp    802dea <setvbuf+0x3a>
+
+00802e0d <fflush>:
+{
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	57                   	push   %edi
+  802e11:	56                   	push   %esi
+  802e12:	53                   	push   %ebx
+  802e13:	83 ec 0c             	sub    $0xc,%esp
+  802e16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802e19:	85 db                	test   %ebx,%ebx
+  802e1b:	74 1a                	je     802e37 <fflush+0x2a>
+	stream_unread(f);
+  802e1d:	89 d8                	mov    %ebx,%eax
+  802e1f:	e8 0a fd ff ff       	call   802b2e <stream_unread>
+	return stream_drain(f);
+  802e24:	89 d8                	mov    %ebx,%eax
+  802e26:	e8 76 fd ff ff       	call   802ba1 <stream_drain>
+  802e2b:	89 c7                	mov    %eax,%edi
+}
+  802e2d:	89 f8                	mov    %edi,%eax
+  802e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e32:	5b                   	pop    %ebx
+  802e33:	5e                   	pop    %esi
+  802e34:	5f                   	pop    %edi
+  802e35:	5d                   	pop    %ebp
+  802e36:	c3                   	ret
+  802e37:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802e3c:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e46:	eb 03                	jmp    802e4b <fflush+0x3e>
+  802e48:	83 c3 24             	add    $0x24,%ebx
+  802e4b:	39 f3                	cmp    %esi,%ebx
+  802e4d:	74 de                	je     802e2d <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802e4f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802e53:	74 f3                	je     802e48 <fflush+0x3b>
+  802e55:	83 ec 0c             	sub    $0xc,%esp
+  802e58:	53                   	push   %ebx
+  802e59:	e8 af ff ff ff       	call   802e0d <fflush>
+  802e5e:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802e61:	85 c0                	test   %eax,%eax
+  802e63:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e68:	0f 48 f8             	cmovs  %eax,%edi
+  802e6b:	eb db                	jmp    802e48 <fflush+0x3b>
+
+00802e6d <fclose>:
+{
+  802e6d:	55                   	push   %ebp
+  802e6e:	89 e5                	mov    %esp,%ebp
+  802e70:	56                   	push   %esi
+  802e71:	53                   	push   %ebx
+  802e72:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802e75:	83 ec 0c             	sub    $0xc,%esp
+  802e78:	56                   	push   %esi
+  802e79:	e8 8f ff ff ff       	call   802e0d <fflush>
+  802e7e:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802e80:	83 c4 04             	add    $0x4,%esp
+  802e83:	ff 36                	push   (%esi)
+  802e85:	e8 81 eb ff ff       	call   801a0b <close>
+  802e8a:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e94:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802e97:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802e9b:	75 10                	jne    802ead <fclose+0x40>
+	f->f_flags = 0;
+  802e9d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802ea4:	89 d8                	mov    %ebx,%eax
+  802ea6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea9:	5b                   	pop    %ebx
+  802eaa:	5e                   	pop    %esi
+  802eab:	5d                   	pop    %ebp
+  802eac:	c3                   	ret
+		free(f->f_buf);
+  802ead:	83 ec 0c             	sub    $0xc,%esp
+  802eb0:	ff 76 0c             	push   0xc(%esi)
+  802eb3:	e8 54 08 00 00       	call   80370c <free>
+  802eb8:	83 c4 10             	add    $0x10,%esp
+  802ebb:	eb e0                	jmp    802e9d <fclose+0x30>
+
+00802ebd <fileno>:
+{
+  802ebd:	55                   	push   %ebp
+  802ebe:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec3:	8b 00                	mov    (%eax),%eax
+}
+  802ec5:	5d                   	pop    %ebp
+  802ec6:	c3                   	ret
+
+00802ec7 <feof>:
+{
+  802ec7:	55                   	push   %ebp
+  802ec8:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ecd:	8b 40 04             	mov    0x4(%eax),%eax
+  802ed0:	c1 e8 02             	shr    $0x2,%eax
+  802ed3:	83 e0 01             	and    $0x1,%eax
+}
+  802ed6:	5d                   	pop    %ebp
+  802ed7:	c3                   	ret
+
+00802ed8 <ferror>:
+{
+  802ed8:	55                   	push   %ebp
+  802ed9:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ede:	8b 40 04             	mov    0x4(%eax),%eax
+  802ee1:	c1 e8 03             	shr    $0x3,%eax
+  802ee4:	83 e0 01             	and    $0x1,%eax
+}
+  802ee7:	5d                   	pop    %ebp
+  802ee8:	c3                   	ret
+
+00802ee9 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802ee9:	55                   	push   %ebp
+  802eea:	89 e5                	mov    %esp,%ebp
+  802eec:	53                   	push   %ebx
+  802eed:	83 ec 04             	sub    $0x4,%esp
+  802ef0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ef3:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ef6:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802ef9:	74 15                	je     802f10 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802efb:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802efe:	8b 43 14             	mov    0x14(%ebx),%eax
+  802f01:	8d 48 01             	lea    0x1(%eax),%ecx
+  802f04:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802f07:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802f0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f0e:	c9                   	leave
+  802f0f:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802f10:	89 d8                	mov    %ebx,%eax
+  802f12:	e8 67 fd ff ff       	call   802c7e <stream_fill>
+  802f17:	85 c0                	test   %eax,%eax
+  802f19:	75 e0                	jne    802efb <fgetc+0x12>
+		return EOF;
+  802f1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f20:	eb e9                	jmp    802f0b <fgetc+0x22>
+
+00802f22 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802f22:	55                   	push   %ebp
+  802f23:	89 e5                	mov    %esp,%ebp
+  802f25:	57                   	push   %edi
+  802f26:	56                   	push   %esi
+  802f27:	53                   	push   %ebx
+  802f28:	83 ec 1c             	sub    $0x1c,%esp
+  802f2b:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802f2e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802f33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f36:	83 e8 01             	sub    $0x1,%eax
+  802f39:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802f3c:	eb 66                	jmp    802fa4 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802f3e:	8b 46 14             	mov    0x14(%esi),%eax
+  802f41:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802f44:	29 c3                	sub    %eax,%ebx
+  802f46:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802f49:	29 fa                	sub    %edi,%edx
+  802f4b:	39 d3                	cmp    %edx,%ebx
+  802f4d:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802f50:	83 ec 04             	sub    $0x4,%esp
+  802f53:	53                   	push   %ebx
+  802f54:	6a 0a                	push   $0xa
+  802f56:	03 46 0c             	add    0xc(%esi),%eax
+  802f59:	50                   	push   %eax
+  802f5a:	e8 32 e2 ff ff       	call   801191 <memfind>
+  802f5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802f62:	8b 46 0c             	mov    0xc(%esi),%eax
+  802f65:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802f68:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802f6b:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f73:	74 0b                	je     802f80 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802f75:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f78:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802f7b:	29 d3                	sub    %edx,%ebx
+  802f7d:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802f80:	83 ec 04             	sub    $0x4,%esp
+  802f83:	53                   	push   %ebx
+  802f84:	01 c8                	add    %ecx,%eax
+  802f86:	50                   	push   %eax
+  802f87:	89 f8                	mov    %edi,%eax
+  802f89:	03 45 08             	add    0x8(%ebp),%eax
+  802f8c:	50                   	push   %eax
+  802f8d:	e8 4e e1 ff ff       	call   8010e0 <memmove>
+		f->f_rpos += m;
+  802f92:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802f95:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802f97:	83 c4 10             	add    $0x10,%esp
+  802f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9d:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802fa2:	74 1f                	je     802fc3 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802fa4:	8d 47 01             	lea    0x1(%edi),%eax
+  802fa7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802faa:	73 17                	jae    802fc3 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802fac:	8b 46 18             	mov    0x18(%esi),%eax
+  802faf:	39 46 14             	cmp    %eax,0x14(%esi)
+  802fb2:	75 8a                	jne    802f3e <fgets+0x1c>
+  802fb4:	89 f0                	mov    %esi,%eax
+  802fb6:	e8 c3 fc ff ff       	call   802c7e <stream_fill>
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	0f 85 7b ff ff ff    	jne    802f3e <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802fc3:	85 ff                	test   %edi,%edi
+  802fc5:	74 0f                	je     802fd6 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fca:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd1:	5b                   	pop    %ebx
+  802fd2:	5e                   	pop    %esi
+  802fd3:	5f                   	pop    %edi
+  802fd4:	5d                   	pop    %ebp
+  802fd5:	c3                   	ret
+		return 0;
+  802fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdb:	eb f1                	jmp    802fce <fgets+0xac>
+
+00802fdd <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802fdd:	55                   	push   %ebp
+  802fde:	89 e5                	mov    %esp,%ebp
+  802fe0:	57                   	push   %edi
+  802fe1:	56                   	push   %esi
+  802fe2:	53                   	push   %ebx
+  802fe3:	83 ec 1c             	sub    $0x1c,%esp
+  802fe6:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802fe9:	89 f0                	mov    %esi,%eax
+  802feb:	e8 21 fc ff ff       	call   802c11 <stream_setup>
+	want = size * n;
+  802ff0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ff3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802ff7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fff:	eb 43                	jmp    803044 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  803001:	29 d3                	sub    %edx,%ebx
+  803003:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803006:	29 f8                	sub    %edi,%eax
+  803008:	39 c3                	cmp    %eax,%ebx
+  80300a:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80300d:	83 ec 04             	sub    $0x4,%esp
+  803010:	53                   	push   %ebx
+  803011:	03 56 0c             	add    0xc(%esi),%edx
+  803014:	52                   	push   %edx
+  803015:	89 f8                	mov    %edi,%eax
+  803017:	03 45 08             	add    0x8(%ebp),%eax
+  80301a:	50                   	push   %eax
+  80301b:	e8 c0 e0 ff ff       	call   8010e0 <memmove>
+			f->f_rpos += m;
+  803020:	01 5e 14             	add    %ebx,0x14(%esi)
+  803023:	83 c4 10             	add    $0x10,%esp
+  803026:	eb 1a                	jmp    803042 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  803028:	83 ec 04             	sub    $0x4,%esp
+  80302b:	53                   	push   %ebx
+  80302c:	89 f8                	mov    %edi,%eax
+  80302e:	03 45 08             	add    0x8(%ebp),%eax
+  803031:	50                   	push   %eax
+  803032:	ff 36                	push   (%esi)
+  803034:	e8 0e eb ff ff       	call   801b47 <read>
+  803039:	89 c3                	mov    %eax,%ebx
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	85 c0                	test   %eax,%eax
+  803040:	7e 36                	jle    803078 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  803042:	01 df                	add    %ebx,%edi
+  803044:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803047:	39 c7                	cmp    %eax,%edi
+  803049:	73 39                	jae    803084 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80304b:	8b 56 14             	mov    0x14(%esi),%edx
+  80304e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  803051:	39 da                	cmp    %ebx,%edx
+  803053:	72 ac                	jb     803001 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  803055:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803058:	29 fb                	sub    %edi,%ebx
+  80305a:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80305d:	72 3e                	jb     80309d <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80305f:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  803063:	74 1f                	je     803084 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  803065:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  803069:	74 bd                	je     803028 <fread+0x4b>
+  80306b:	89 f0                	mov    %esi,%eax
+  80306d:	e8 2f fb ff ff       	call   802ba1 <stream_drain>
+  803072:	85 c0                	test   %eax,%eax
+  803074:	79 b2                	jns    803028 <fread+0x4b>
+  803076:	eb 0c                	jmp    803084 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  803078:	c1 fb 1f             	sar    $0x1f,%ebx
+  80307b:	83 e3 04             	and    $0x4,%ebx
+  80307e:	83 c3 04             	add    $0x4,%ebx
+  803081:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  803084:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803087:	85 c0                	test   %eax,%eax
+  803089:	74 0a                	je     803095 <fread+0xb8>
+  80308b:	89 f8                	mov    %edi,%eax
+  80308d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803092:	f7 75 0c             	divl   0xc(%ebp)
+}
+  803095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803098:	5b                   	pop    %ebx
+  803099:	5e                   	pop    %esi
+  80309a:	5f                   	pop    %edi
+  80309b:	5d                   	pop    %ebp
+  80309c:	c3                   	ret
+		} else if (!stream_fill(f))
+  80309d:	89 f0                	mov    %esi,%eax
+  80309f:	e8 da fb ff ff       	call   802c7e <stream_fill>
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	74 dc                	je     803084 <fread+0xa7>
+			m = 0;
+  8030a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ad:	eb 93                	jmp    803042 <fread+0x65>
+
+008030af <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8030af:	55                   	push   %ebp
+  8030b0:	89 e5                	mov    %esp,%ebp
+  8030b2:	57                   	push   %edi
+  8030b3:	56                   	push   %esi
+  8030b4:	53                   	push   %ebx
+  8030b5:	83 ec 1c             	sub    $0x1c,%esp
+  8030b8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8030bb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030be:	a8 02                	test   $0x2,%al
+  8030c0:	75 13                	jne    8030d5 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8030c2:	83 c8 08             	or     $0x8,%eax
+  8030c5:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8030c8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8030cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030d0:	5b                   	pop    %ebx
+  8030d1:	5e                   	pop    %esi
+  8030d2:	5f                   	pop    %edi
+  8030d3:	5d                   	pop    %ebp
+  8030d4:	c3                   	ret
+	stream_setup(f);
+  8030d5:	89 d8                	mov    %ebx,%eax
+  8030d7:	e8 35 fb ff ff       	call   802c11 <stream_setup>
+	want = size * n;
+  8030dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030df:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8030e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8030e6:	89 d8                	mov    %ebx,%eax
+  8030e8:	e8 41 fa ff ff       	call   802b2e <stream_unread>
+	for (done = 0; done < want; ) {
+  8030ed:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8030f2:	84 c0                	test   %al,%al
+  8030f4:	75 7b                	jne    803171 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8030f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8030fe:	39 fe                	cmp    %edi,%esi
+  803100:	73 24                	jae    803126 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  803102:	83 ec 04             	sub    $0x4,%esp
+  803105:	89 f8                	mov    %edi,%eax
+  803107:	29 f0                	sub    %esi,%eax
+  803109:	50                   	push   %eax
+  80310a:	89 f0                	mov    %esi,%eax
+  80310c:	03 45 08             	add    0x8(%ebp),%eax
+  80310f:	50                   	push   %eax
+  803110:	ff 33                	push   (%ebx)
+  803112:	e8 28 eb ff ff       	call   801c3f <write>
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	7e 04                	jle    803122 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80311e:	01 c6                	add    %eax,%esi
+  803120:	eb dc                	jmp    8030fe <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  803122:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  803126:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	74 a0                	je     8030cd <fwrite+0x1e>
+  80312d:	89 f0                	mov    %esi,%eax
+  80312f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803134:	f7 75 0c             	divl   0xc(%ebp)
+  803137:	eb 94                	jmp    8030cd <fwrite+0x1e>
+			done += r;
+  803139:	01 c7                	add    %eax,%edi
+			continue;
+  80313b:	eb 34                	jmp    803171 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80313d:	8b 73 10             	mov    0x10(%ebx),%esi
+  803140:	29 c6                	sub    %eax,%esi
+  803142:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803145:	29 fa                	sub    %edi,%edx
+  803147:	39 d6                	cmp    %edx,%esi
+  803149:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80314c:	83 ec 04             	sub    $0x4,%esp
+  80314f:	56                   	push   %esi
+  803150:	89 fa                	mov    %edi,%edx
+  803152:	03 55 08             	add    0x8(%ebp),%edx
+  803155:	52                   	push   %edx
+  803156:	03 43 0c             	add    0xc(%ebx),%eax
+  803159:	50                   	push   %eax
+  80315a:	e8 81 df ff ff       	call   8010e0 <memmove>
+		f->f_wend += m;
+  80315f:	89 f0                	mov    %esi,%eax
+  803161:	03 43 1c             	add    0x1c(%ebx),%eax
+  803164:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  803167:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80316f:	74 5b                	je     8031cc <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  803171:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803174:	39 c7                	cmp    %eax,%edi
+  803176:	73 2d                	jae    8031a5 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  803178:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	75 be                	jne    80313d <fwrite+0x8e>
+  80317f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803182:	29 fa                	sub    %edi,%edx
+  803184:	3b 53 10             	cmp    0x10(%ebx),%edx
+  803187:	72 b4                	jb     80313d <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  803189:	83 ec 04             	sub    $0x4,%esp
+  80318c:	52                   	push   %edx
+  80318d:	89 f8                	mov    %edi,%eax
+  80318f:	03 45 08             	add    0x8(%ebp),%eax
+  803192:	50                   	push   %eax
+  803193:	ff 33                	push   (%ebx)
+  803195:	e8 a5 ea ff ff       	call   801c3f <write>
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	85 c0                	test   %eax,%eax
+  80319f:	7f 98                	jg     803139 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8031a1:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8031a5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8031a8:	83 f8 03             	cmp    $0x3,%eax
+  8031ab:	74 48                	je     8031f5 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8031ad:	83 f8 02             	cmp    $0x2,%eax
+  8031b0:	74 27                	je     8031d9 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8031b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	0f 84 10 ff ff ff    	je     8030cd <fwrite+0x1e>
+  8031bd:	89 f8                	mov    %edi,%eax
+  8031bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c4:	f7 75 0c             	divl   0xc(%ebp)
+  8031c7:	e9 01 ff ff ff       	jmp    8030cd <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8031cc:	89 d8                	mov    %ebx,%eax
+  8031ce:	e8 ce f9 ff ff       	call   802ba1 <stream_drain>
+  8031d3:	85 c0                	test   %eax,%eax
+  8031d5:	79 9a                	jns    803171 <fwrite+0xc2>
+  8031d7:	eb cc                	jmp    8031a5 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8031d9:	83 ec 04             	sub    $0x4,%esp
+  8031dc:	57                   	push   %edi
+  8031dd:	6a 0a                	push   $0xa
+  8031df:	ff 75 08             	push   0x8(%ebp)
+  8031e2:	e8 aa df ff ff       	call   801191 <memfind>
+  8031e7:	89 c2                	mov    %eax,%edx
+  8031e9:	89 f8                	mov    %edi,%eax
+  8031eb:	03 45 08             	add    0x8(%ebp),%eax
+  8031ee:	83 c4 10             	add    $0x10,%esp
+  8031f1:	39 c2                	cmp    %eax,%edx
+  8031f3:	74 bd                	je     8031b2 <fwrite+0x103>
+		stream_drain(f);
+  8031f5:	89 d8                	mov    %ebx,%eax
+  8031f7:	e8 a5 f9 ff ff       	call   802ba1 <stream_drain>
+  8031fc:	eb b4                	jmp    8031b2 <fwrite+0x103>
+
+008031fe <fputc>:
+{
+  8031fe:	55                   	push   %ebp
+  8031ff:	89 e5                	mov    %esp,%ebp
+  803201:	53                   	push   %ebx
+  803202:	83 ec 14             	sub    $0x14,%esp
+  803205:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  803208:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  80320b:	ff 75 0c             	push   0xc(%ebp)
+  80320e:	6a 01                	push   $0x1
+  803210:	6a 01                	push   $0x1
+  803212:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803215:	50                   	push   %eax
+  803216:	e8 94 fe ff ff       	call   8030af <fwrite>
+  80321b:	83 c4 10             	add    $0x10,%esp
+  80321e:	0f b6 db             	movzbl %bl,%ebx
+  803221:	83 f8 01             	cmp    $0x1,%eax
+  803224:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803229:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80322c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80322f:	c9                   	leave
+  803230:	c3                   	ret
+
+00803231 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  803231:	55                   	push   %ebp
+  803232:	89 e5                	mov    %esp,%ebp
+  803234:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  803237:	ff 75 0c             	push   0xc(%ebp)
+  80323a:	ff 75 08             	push   0x8(%ebp)
+  80323d:	e8 bc ff ff ff       	call   8031fe <fputc>
+}
+  803242:	83 c4 10             	add    $0x10,%esp
+  803245:	c9                   	leave
+  803246:	c3                   	ret
+
+00803247 <fputs>:
+{
+  803247:	55                   	push   %ebp
+  803248:	89 e5                	mov    %esp,%ebp
+  80324a:	56                   	push   %esi
+  80324b:	53                   	push   %ebx
+  80324c:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80324f:	83 ec 0c             	sub    $0xc,%esp
+  803252:	56                   	push   %esi
+  803253:	e8 c7 dc ff ff       	call   800f1f <strlen>
+  803258:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80325a:	ff 75 0c             	push   0xc(%ebp)
+  80325d:	50                   	push   %eax
+  80325e:	6a 01                	push   $0x1
+  803260:	56                   	push   %esi
+  803261:	e8 49 fe ff ff       	call   8030af <fwrite>
+  803266:	83 c4 20             	add    $0x20,%esp
+  803269:	39 d8                	cmp    %ebx,%eax
+  80326b:	0f 95 c0             	setne  %al
+  80326e:	0f b6 c0             	movzbl %al,%eax
+  803271:	f7 d8                	neg    %eax
+}
+  803273:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803276:	5b                   	pop    %ebx
+  803277:	5e                   	pop    %esi
+  803278:	5d                   	pop    %ebp
+  803279:	c3                   	ret
+
+0080327a <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80327a:	55                   	push   %ebp
+  80327b:	89 e5                	mov    %esp,%ebp
+  80327d:	53                   	push   %ebx
+  80327e:	83 ec 04             	sub    $0x4,%esp
+  803281:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803284:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803287:	50                   	push   %eax
+  803288:	ff 75 0c             	push   0xc(%ebp)
+  80328b:	53                   	push   %ebx
+  80328c:	68 31 32 80 00       	push   $0x803231
+  803291:	e8 d7 d7 ff ff       	call   800a6d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803296:	8b 43 04             	mov    0x4(%ebx),%eax
+  803299:	c1 e0 1c             	shl    $0x1c,%eax
+  80329c:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80329f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a2:	c9                   	leave
+  8032a3:	c3                   	ret
+
+008032a4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032a4:	55                   	push   %ebp
+  8032a5:	89 e5                	mov    %esp,%ebp
+  8032a7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8032aa:	68 b8 59 80 00       	push   $0x8059b8
+  8032af:	ff 75 0c             	push   0xc(%ebp)
+  8032b2:	e8 a3 dc ff ff       	call   800f5a <strcpy>
+	return 0;
+}
+  8032b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+
+008032be <devsock_close>:
+{
+  8032be:	55                   	push   %ebp
+  8032bf:	89 e5                	mov    %esp,%ebp
+  8032c1:	53                   	push   %ebx
+  8032c2:	83 ec 10             	sub    $0x10,%esp
+  8032c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8032c8:	53                   	push   %ebx
+  8032c9:	e8 23 1d 00 00       	call   804ff1 <pageref>
+  8032ce:	89 c2                	mov    %eax,%edx
+  8032d0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8032d8:	83 fa 01             	cmp    $0x1,%edx
+  8032db:	74 05                	je     8032e2 <devsock_close+0x24>
+}
+  8032dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032e0:	c9                   	leave
+  8032e1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8032e2:	83 ec 0c             	sub    $0xc,%esp
+  8032e5:	ff 73 0c             	push   0xc(%ebx)
+  8032e8:	e8 b7 02 00 00       	call   8035a4 <nsipc_close>
+  8032ed:	83 c4 10             	add    $0x10,%esp
+  8032f0:	eb eb                	jmp    8032dd <devsock_close+0x1f>
+
+008032f2 <devsock_write>:
+{
+  8032f2:	55                   	push   %ebp
+  8032f3:	89 e5                	mov    %esp,%ebp
+  8032f5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8032f8:	6a 00                	push   $0x0
+  8032fa:	ff 75 10             	push   0x10(%ebp)
+  8032fd:	ff 75 0c             	push   0xc(%ebp)
+  803300:	8b 45 08             	mov    0x8(%ebp),%eax
+  803303:	ff 70 0c             	push   0xc(%eax)
+  803306:	e8 79 03 00 00       	call   803684 <nsipc_send>
+}
+  80330b:	c9                   	leave
+  80330c:	c3                   	ret
+
+0080330d <devsock_read>:
+{
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803313:	6a 00                	push   $0x0
+  803315:	ff 75 10             	push   0x10(%ebp)
+  803318:	ff 75 0c             	push   0xc(%ebp)
+  80331b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80331e:	ff 70 0c             	push   0xc(%eax)
+  803321:	e8 ef 02 00 00       	call   803615 <nsipc_recv>
+}
+  803326:	c9                   	leave
+  803327:	c3                   	ret
+
+00803328 <fd2sockid>:
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80332e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803331:	52                   	push   %edx
+  803332:	50                   	push   %eax
+  803333:	e8 7f e5 ff ff       	call   8018b7 <fd_lookup>
+  803338:	83 c4 10             	add    $0x10,%esp
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	78 10                	js     80334f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80333f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803342:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  803348:	39 08                	cmp    %ecx,(%eax)
+  80334a:	75 05                	jne    803351 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80334c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80334f:	c9                   	leave
+  803350:	c3                   	ret
+		return -E_NOT_SUPP;
+  803351:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803356:	eb f7                	jmp    80334f <fd2sockid+0x27>
+
+00803358 <alloc_sockfd>:
+{
+  803358:	55                   	push   %ebp
+  803359:	89 e5                	mov    %esp,%ebp
+  80335b:	56                   	push   %esi
+  80335c:	53                   	push   %ebx
+  80335d:	83 ec 1c             	sub    $0x1c,%esp
+  803360:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803362:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803365:	50                   	push   %eax
+  803366:	e8 f6 e4 ff ff       	call   801861 <fd_alloc>
+  80336b:	89 c3                	mov    %eax,%ebx
+  80336d:	83 c4 10             	add    $0x10,%esp
+  803370:	85 c0                	test   %eax,%eax
+  803372:	78 43                	js     8033b7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803374:	83 ec 04             	sub    $0x4,%esp
+  803377:	68 07 04 00 00       	push   $0x407
+  80337c:	ff 75 f4             	push   -0xc(%ebp)
+  80337f:	6a 00                	push   $0x0
+  803381:	e8 12 e0 ff ff       	call   801398 <sys_page_alloc>
+  803386:	89 c3                	mov    %eax,%ebx
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	78 28                	js     8033b7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80338f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803392:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  803398:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80339a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80339d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8033a4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8033a7:	83 ec 0c             	sub    $0xc,%esp
+  8033aa:	50                   	push   %eax
+  8033ab:	e8 8a e4 ff ff       	call   80183a <fd2num>
+  8033b0:	89 c3                	mov    %eax,%ebx
+  8033b2:	83 c4 10             	add    $0x10,%esp
+  8033b5:	eb 0c                	jmp    8033c3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8033b7:	83 ec 0c             	sub    $0xc,%esp
+  8033ba:	56                   	push   %esi
+  8033bb:	e8 e4 01 00 00       	call   8035a4 <nsipc_close>
+		return r;
+  8033c0:	83 c4 10             	add    $0x10,%esp
+}
+  8033c3:	89 d8                	mov    %ebx,%eax
+  8033c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033c8:	5b                   	pop    %ebx
+  8033c9:	5e                   	pop    %esi
+  8033ca:	5d                   	pop    %ebp
+  8033cb:	c3                   	ret
+
+008033cc <accept>:
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8033d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d5:	e8 4e ff ff ff       	call   803328 <fd2sockid>
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	78 1b                	js     8033f9 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8033de:	83 ec 04             	sub    $0x4,%esp
+  8033e1:	ff 75 10             	push   0x10(%ebp)
+  8033e4:	ff 75 0c             	push   0xc(%ebp)
+  8033e7:	50                   	push   %eax
+  8033e8:	e8 0e 01 00 00       	call   8034fb <nsipc_accept>
+  8033ed:	83 c4 10             	add    $0x10,%esp
+  8033f0:	85 c0                	test   %eax,%eax
+  8033f2:	78 05                	js     8033f9 <accept+0x2d>
+	return alloc_sockfd(r);
+  8033f4:	e8 5f ff ff ff       	call   803358 <alloc_sockfd>
+}
+  8033f9:	c9                   	leave
+  8033fa:	c3                   	ret
+
+008033fb <bind>:
+{
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803401:	8b 45 08             	mov    0x8(%ebp),%eax
+  803404:	e8 1f ff ff ff       	call   803328 <fd2sockid>
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 12                	js     80341f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80340d:	83 ec 04             	sub    $0x4,%esp
+  803410:	ff 75 10             	push   0x10(%ebp)
+  803413:	ff 75 0c             	push   0xc(%ebp)
+  803416:	50                   	push   %eax
+  803417:	e8 31 01 00 00       	call   80354d <nsipc_bind>
+  80341c:	83 c4 10             	add    $0x10,%esp
+}
+  80341f:	c9                   	leave
+  803420:	c3                   	ret
+
+00803421 <shutdown>:
+{
+  803421:	55                   	push   %ebp
+  803422:	89 e5                	mov    %esp,%ebp
+  803424:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803427:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342a:	e8 f9 fe ff ff       	call   803328 <fd2sockid>
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	78 0f                	js     803442 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803433:	83 ec 08             	sub    $0x8,%esp
+  803436:	ff 75 0c             	push   0xc(%ebp)
+  803439:	50                   	push   %eax
+  80343a:	e8 43 01 00 00       	call   803582 <nsipc_shutdown>
+  80343f:	83 c4 10             	add    $0x10,%esp
+}
+  803442:	c9                   	leave
+  803443:	c3                   	ret
+
+00803444 <connect>:
+{
+  803444:	55                   	push   %ebp
+  803445:	89 e5                	mov    %esp,%ebp
+  803447:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80344a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80344d:	e8 d6 fe ff ff       	call   803328 <fd2sockid>
+  803452:	85 c0                	test   %eax,%eax
+  803454:	78 12                	js     803468 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803456:	83 ec 04             	sub    $0x4,%esp
+  803459:	ff 75 10             	push   0x10(%ebp)
+  80345c:	ff 75 0c             	push   0xc(%ebp)
+  80345f:	50                   	push   %eax
+  803460:	e8 59 01 00 00       	call   8035be <nsipc_connect>
+  803465:	83 c4 10             	add    $0x10,%esp
+}
+  803468:	c9                   	leave
+  803469:	c3                   	ret
+
+0080346a <listen>:
+{
+  80346a:	55                   	push   %ebp
+  80346b:	89 e5                	mov    %esp,%ebp
+  80346d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803470:	8b 45 08             	mov    0x8(%ebp),%eax
+  803473:	e8 b0 fe ff ff       	call   803328 <fd2sockid>
+  803478:	85 c0                	test   %eax,%eax
+  80347a:	78 0f                	js     80348b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80347c:	83 ec 08             	sub    $0x8,%esp
+  80347f:	ff 75 0c             	push   0xc(%ebp)
+  803482:	50                   	push   %eax
+  803483:	e8 6b 01 00 00       	call   8035f3 <nsipc_listen>
+  803488:	83 c4 10             	add    $0x10,%esp
+}
+  80348b:	c9                   	leave
+  80348c:	c3                   	ret
+
+0080348d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80348d:	55                   	push   %ebp
+  80348e:	89 e5                	mov    %esp,%ebp
+  803490:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803493:	ff 75 10             	push   0x10(%ebp)
+  803496:	ff 75 0c             	push   0xc(%ebp)
+  803499:	ff 75 08             	push   0x8(%ebp)
+  80349c:	e8 41 02 00 00       	call   8036e2 <nsipc_socket>
+  8034a1:	83 c4 10             	add    $0x10,%esp
+  8034a4:	85 c0                	test   %eax,%eax
+  8034a6:	78 05                	js     8034ad <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8034a8:	e8 ab fe ff ff       	call   803358 <alloc_sockfd>
+}
+  8034ad:	c9                   	leave
+  8034ae:	c3                   	ret
+
+008034af <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8034af:	55                   	push   %ebp
+  8034b0:	89 e5                	mov    %esp,%ebp
+  8034b2:	53                   	push   %ebx
+  8034b3:	83 ec 04             	sub    $0x4,%esp
+  8034b6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8034b8:	83 3d c0 05 91 00 00 	cmpl   $0x0,0x9105c0
+  8034bf:	74 26                	je     8034e7 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8034c1:	6a 07                	push   $0x7
+  8034c3:	68 00 20 91 00       	push   $0x912000
+  8034c8:	53                   	push   %ebx
+  8034c9:	ff 35 c0 05 91 00    	push   0x9105c0
+  8034cf:	e8 88 1a 00 00       	call   804f5c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8034d4:	83 c4 0c             	add    $0xc,%esp
+  8034d7:	6a 00                	push   $0x0
+  8034d9:	6a 00                	push   $0x0
+  8034db:	6a 00                	push   $0x0
+  8034dd:	e8 84 19 00 00       	call   804e66 <ipc_recv>
+}
+  8034e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034e5:	c9                   	leave
+  8034e6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8034e7:	83 ec 0c             	sub    $0xc,%esp
+  8034ea:	6a 02                	push   $0x2
+  8034ec:	e8 c1 1a 00 00       	call   804fb2 <ipc_find_env>
+  8034f1:	a3 c0 05 91 00       	mov    %eax,0x9105c0
+  8034f6:	83 c4 10             	add    $0x10,%esp
+  8034f9:	eb c6                	jmp    8034c1 <nsipc+0x12>
+
+008034fb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8034fb:	55                   	push   %ebp
+  8034fc:	89 e5                	mov    %esp,%ebp
+  8034fe:	56                   	push   %esi
+  8034ff:	53                   	push   %ebx
+  803500:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803503:	8b 45 08             	mov    0x8(%ebp),%eax
+  803506:	a3 00 20 91 00       	mov    %eax,0x912000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80350b:	8b 06                	mov    (%esi),%eax
+  80350d:	a3 04 20 91 00       	mov    %eax,0x912004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803512:	b8 01 00 00 00       	mov    $0x1,%eax
+  803517:	e8 93 ff ff ff       	call   8034af <nsipc>
+  80351c:	89 c3                	mov    %eax,%ebx
+  80351e:	85 c0                	test   %eax,%eax
+  803520:	79 09                	jns    80352b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803522:	89 d8                	mov    %ebx,%eax
+  803524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803527:	5b                   	pop    %ebx
+  803528:	5e                   	pop    %esi
+  803529:	5d                   	pop    %ebp
+  80352a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80352b:	83 ec 04             	sub    $0x4,%esp
+  80352e:	ff 35 10 20 91 00    	push   0x912010
+  803534:	68 00 20 91 00       	push   $0x912000
+  803539:	ff 75 0c             	push   0xc(%ebp)
+  80353c:	e8 9f db ff ff       	call   8010e0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803541:	a1 10 20 91 00       	mov    0x912010,%eax
+  803546:	89 06                	mov    %eax,(%esi)
+  803548:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80354b:	eb d5                	jmp    803522 <nsipc_accept+0x27>
+
+0080354d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80354d:	55                   	push   %ebp
+  80354e:	89 e5                	mov    %esp,%ebp
+  803550:	53                   	push   %ebx
+  803551:	83 ec 08             	sub    $0x8,%esp
+  803554:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80355a:	a3 00 20 91 00       	mov    %eax,0x912000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80355f:	53                   	push   %ebx
+  803560:	ff 75 0c             	push   0xc(%ebp)
+  803563:	68 04 20 91 00       	push   $0x912004
+  803568:	e8 73 db ff ff       	call   8010e0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80356d:	89 1d 14 20 91 00    	mov    %ebx,0x912014
+	return nsipc(NSREQ_BIND);
+  803573:	b8 02 00 00 00       	mov    $0x2,%eax
+  803578:	e8 32 ff ff ff       	call   8034af <nsipc>
+}
+  80357d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803580:	c9                   	leave
+  803581:	c3                   	ret
+
+00803582 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803582:	55                   	push   %ebp
+  803583:	89 e5                	mov    %esp,%ebp
+  803585:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80358b:	a3 00 20 91 00       	mov    %eax,0x912000
+	nsipcbuf.shutdown.req_how = how;
+  803590:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803593:	a3 04 20 91 00       	mov    %eax,0x912004
+	return nsipc(NSREQ_SHUTDOWN);
+  803598:	b8 03 00 00 00       	mov    $0x3,%eax
+  80359d:	e8 0d ff ff ff       	call   8034af <nsipc>
+}
+  8035a2:	c9                   	leave
+  8035a3:	c3                   	ret
+
+008035a4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8035a4:	55                   	push   %ebp
+  8035a5:	89 e5                	mov    %esp,%ebp
+  8035a7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8035aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ad:	a3 00 20 91 00       	mov    %eax,0x912000
+	return nsipc(NSREQ_CLOSE);
+  8035b2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8035b7:	e8 f3 fe ff ff       	call   8034af <nsipc>
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+
+008035be <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+  8035c1:	53                   	push   %ebx
+  8035c2:	83 ec 08             	sub    $0x8,%esp
+  8035c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8035c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035cb:	a3 00 20 91 00       	mov    %eax,0x912000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8035d0:	53                   	push   %ebx
+  8035d1:	ff 75 0c             	push   0xc(%ebp)
+  8035d4:	68 04 20 91 00       	push   $0x912004
+  8035d9:	e8 02 db ff ff       	call   8010e0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8035de:	89 1d 14 20 91 00    	mov    %ebx,0x912014
+	return nsipc(NSREQ_CONNECT);
+  8035e4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8035e9:	e8 c1 fe ff ff       	call   8034af <nsipc>
+}
+  8035ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+
+008035f3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8035f3:	55                   	push   %ebp
+  8035f4:	89 e5                	mov    %esp,%ebp
+  8035f6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8035f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035fc:	a3 00 20 91 00       	mov    %eax,0x912000
+	nsipcbuf.listen.req_backlog = backlog;
+  803601:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803604:	a3 04 20 91 00       	mov    %eax,0x912004
+	return nsipc(NSREQ_LISTEN);
+  803609:	b8 06 00 00 00       	mov    $0x6,%eax
+  80360e:	e8 9c fe ff ff       	call   8034af <nsipc>
+}
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+
+00803615 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803615:	55                   	push   %ebp
+  803616:	89 e5                	mov    %esp,%ebp
+  803618:	56                   	push   %esi
+  803619:	53                   	push   %ebx
+  80361a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80361d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803620:	a3 00 20 91 00       	mov    %eax,0x912000
+	nsipcbuf.recv.req_len = len;
+  803625:	89 35 04 20 91 00    	mov    %esi,0x912004
+	nsipcbuf.recv.req_flags = flags;
+  80362b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80362e:	a3 08 20 91 00       	mov    %eax,0x912008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803633:	b8 07 00 00 00       	mov    $0x7,%eax
+  803638:	e8 72 fe ff ff       	call   8034af <nsipc>
+  80363d:	89 c3                	mov    %eax,%ebx
+  80363f:	85 c0                	test   %eax,%eax
+  803641:	78 22                	js     803665 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803643:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803648:	39 c6                	cmp    %eax,%esi
+  80364a:	0f 4e c6             	cmovle %esi,%eax
+  80364d:	39 c3                	cmp    %eax,%ebx
+  80364f:	7f 1d                	jg     80366e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803651:	83 ec 04             	sub    $0x4,%esp
+  803654:	53                   	push   %ebx
+  803655:	68 00 20 91 00       	push   $0x912000
+  80365a:	ff 75 0c             	push   0xc(%ebp)
+  80365d:	e8 7e da ff ff       	call   8010e0 <memmove>
+  803662:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803665:	89 d8                	mov    %ebx,%eax
+  803667:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80366a:	5b                   	pop    %ebx
+  80366b:	5e                   	pop    %esi
+  80366c:	5d                   	pop    %ebp
+  80366d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80366e:	68 c4 59 80 00       	push   $0x8059c4
+  803673:	68 7d 59 80 00       	push   $0x80597d
+  803678:	6a 62                	push   $0x62
+  80367a:	68 d9 59 80 00       	push   $0x8059d9
+  80367f:	e8 17 d2 ff ff       	call   80089b <_panic>
+
+00803684 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803684:	55                   	push   %ebp
+  803685:	89 e5                	mov    %esp,%ebp
+  803687:	53                   	push   %ebx
+  803688:	83 ec 04             	sub    $0x4,%esp
+  80368b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80368e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803691:	a3 00 20 91 00       	mov    %eax,0x912000
+	assert(size < 1600);
+  803696:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80369c:	7f 2e                	jg     8036cc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80369e:	83 ec 04             	sub    $0x4,%esp
+  8036a1:	53                   	push   %ebx
+  8036a2:	ff 75 0c             	push   0xc(%ebp)
+  8036a5:	68 0c 20 91 00       	push   $0x91200c
+  8036aa:	e8 31 da ff ff       	call   8010e0 <memmove>
+	nsipcbuf.send.req_size = size;
+  8036af:	89 1d 04 20 91 00    	mov    %ebx,0x912004
+	nsipcbuf.send.req_flags = flags;
+  8036b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036b8:	a3 08 20 91 00       	mov    %eax,0x912008
+	return nsipc(NSREQ_SEND);
+  8036bd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8036c2:	e8 e8 fd ff ff       	call   8034af <nsipc>
+}
+  8036c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036ca:	c9                   	leave
+  8036cb:	c3                   	ret
+	assert(size < 1600);
+  8036cc:	68 e5 59 80 00       	push   $0x8059e5
+  8036d1:	68 7d 59 80 00       	push   $0x80597d
+  8036d6:	6a 6d                	push   $0x6d
+  8036d8:	68 d9 59 80 00       	push   $0x8059d9
+  8036dd:	e8 b9 d1 ff ff       	call   80089b <_panic>
+
+008036e2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8036e2:	55                   	push   %ebp
+  8036e3:	89 e5                	mov    %esp,%ebp
+  8036e5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8036e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036eb:	a3 00 20 91 00       	mov    %eax,0x912000
+	nsipcbuf.socket.req_type = type;
+  8036f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036f3:	a3 04 20 91 00       	mov    %eax,0x912004
+	nsipcbuf.socket.req_protocol = protocol;
+  8036f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036fb:	a3 08 20 91 00       	mov    %eax,0x912008
+	return nsipc(NSREQ_SOCKET);
+  803700:	b8 09 00 00 00       	mov    $0x9,%eax
+  803705:	e8 a5 fd ff ff       	call   8034af <nsipc>
+}
+  80370a:	c9                   	leave
+  80370b:	c3                   	ret
+
+0080370c <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80370c:	55                   	push   %ebp
+  80370d:	89 e5                	mov    %esp,%ebp
+  80370f:	53                   	push   %ebx
+  803710:	83 ec 10             	sub    $0x10,%esp
+  803713:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803716:	68 c4 05 91 00       	push   $0x9105c4
+  80371b:	e8 50 07 00 00       	call   803e70 <mutex_lock>
+	if (v == 0)
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	85 db                	test   %ebx,%ebx
+  803725:	0f 84 85 00 00 00    	je     8037b0 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80372b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803731:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803736:	77 51                	ja     803789 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803738:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80373e:	89 d8                	mov    %ebx,%eax
+  803740:	c1 e8 0c             	shr    $0xc,%eax
+  803743:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80374a:	f6 c4 02             	test   $0x2,%ah
+  80374d:	74 50                	je     80379f <free+0x93>
+		sys_page_unmap(0, c);
+  80374f:	83 ec 08             	sub    $0x8,%esp
+  803752:	53                   	push   %ebx
+  803753:	6a 00                	push   $0x0
+  803755:	e8 d7 dc ff ff       	call   801431 <sys_page_unmap>
+		c += PGSIZE;
+  80375a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803760:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80376e:	76 ce                	jbe    80373e <free+0x32>
+  803770:	68 2f 5a 80 00       	push   $0x805a2f
+  803775:	68 7d 59 80 00       	push   $0x80597d
+  80377a:	68 82 00 00 00       	push   $0x82
+  80377f:	68 22 5a 80 00       	push   $0x805a22
+  803784:	e8 12 d1 ff ff       	call   80089b <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803789:	68 f4 59 80 00       	push   $0x8059f4
+  80378e:	68 7d 59 80 00       	push   $0x80597d
+  803793:	6a 7b                	push   $0x7b
+  803795:	68 22 5a 80 00       	push   $0x805a22
+  80379a:	e8 fc d0 ff ff       	call   80089b <_panic>
+	if (--(*ref) == 0)
+  80379f:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8037a5:	83 e8 01             	sub    $0x1,%eax
+  8037a8:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8037ae:	74 15                	je     8037c5 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8037b0:	83 ec 0c             	sub    $0xc,%esp
+  8037b3:	68 c4 05 91 00       	push   $0x9105c4
+  8037b8:	e8 20 07 00 00       	call   803edd <mutex_unlock>
+}
+  8037bd:	83 c4 10             	add    $0x10,%esp
+  8037c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037c3:	c9                   	leave
+  8037c4:	c3                   	ret
+		sys_page_unmap(0, c);
+  8037c5:	83 ec 08             	sub    $0x8,%esp
+  8037c8:	53                   	push   %ebx
+  8037c9:	6a 00                	push   $0x0
+  8037cb:	e8 61 dc ff ff       	call   801431 <sys_page_unmap>
+  8037d0:	83 c4 10             	add    $0x10,%esp
+  8037d3:	eb db                	jmp    8037b0 <free+0xa4>
+
+008037d5 <malloc>:
+{
+  8037d5:	55                   	push   %ebp
+  8037d6:	89 e5                	mov    %esp,%ebp
+  8037d8:	57                   	push   %edi
+  8037d9:	56                   	push   %esi
+  8037da:	53                   	push   %ebx
+  8037db:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8037de:	68 c4 05 91 00       	push   $0x9105c4
+  8037e3:	e8 88 06 00 00       	call   803e70 <mutex_lock>
+	if (mptr == 0)
+  8037e8:	8b 3d c8 05 91 00    	mov    0x9105c8,%edi
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	85 ff                	test   %edi,%edi
+  8037f3:	74 6c                	je     803861 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8037f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037f8:	83 c0 03             	add    $0x3,%eax
+  8037fb:	83 e0 fc             	and    $0xfffffffc,%eax
+  8037fe:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803800:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803805:	0f 87 64 01 00 00    	ja     80396f <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80380b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803811:	74 30                	je     803843 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803813:	89 f9                	mov    %edi,%ecx
+  803815:	c1 e9 0c             	shr    $0xc,%ecx
+  803818:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80381c:	c1 e8 0c             	shr    $0xc,%eax
+  80381f:	39 c1                	cmp    %eax,%ecx
+  803821:	74 5f                	je     803882 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803823:	83 ec 0c             	sub    $0xc,%esp
+  803826:	57                   	push   %edi
+  803827:	e8 e0 fe ff ff       	call   80370c <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80382c:	a1 c8 05 91 00       	mov    0x9105c8,%eax
+  803831:	05 00 10 00 00       	add    $0x1000,%eax
+  803836:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80383b:	a3 c8 05 91 00       	mov    %eax,0x9105c8
+  803840:	83 c4 10             	add    $0x10,%esp
+  803843:	8b 0d c8 05 91 00    	mov    0x9105c8,%ecx
+{
+  803849:	ba 02 00 00 00       	mov    $0x2,%edx
+  80384e:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803852:	8d 7e 04             	lea    0x4(%esi),%edi
+  803855:	89 cb                	mov    %ecx,%ebx
+  803857:	01 f9                	add    %edi,%ecx
+  803859:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80385c:	e9 8b 00 00 00       	jmp    8038ec <malloc+0x117>
+		mptr = mbegin;
+  803861:	c7 05 c8 05 91 00 00 	movl   $0x8000000,0x9105c8
+  803868:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80386b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80386e:	83 c0 03             	add    $0x3,%eax
+  803871:	83 e0 fc             	and    $0xfffffffc,%eax
+  803874:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803876:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80387b:	76 c6                	jbe    803843 <malloc+0x6e>
+  80387d:	e9 d6 00 00 00       	jmp    803958 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803882:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803888:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80388d:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803891:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803894:	a3 c8 05 91 00       	mov    %eax,0x9105c8
+			return v;
+  803899:	e9 ba 00 00 00       	jmp    803958 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80389e:	05 00 10 00 00       	add    $0x1000,%eax
+  8038a3:	39 c8                	cmp    %ecx,%eax
+  8038a5:	0f 83 cb 00 00 00    	jae    803976 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8038ab:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8038b0:	77 22                	ja     8038d4 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8038b2:	89 c2                	mov    %eax,%edx
+  8038b4:	c1 ea 16             	shr    $0x16,%edx
+  8038b7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8038be:	f6 c2 01             	test   $0x1,%dl
+  8038c1:	74 db                	je     80389e <malloc+0xc9>
+  8038c3:	89 c2                	mov    %eax,%edx
+  8038c5:	c1 ea 0c             	shr    $0xc,%edx
+  8038c8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8038cf:	f6 c2 01             	test   $0x1,%dl
+  8038d2:	74 ca                	je     80389e <malloc+0xc9>
+		if (mptr == mend) {
+  8038d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038da:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8038e0:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8038e4:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8038ea:	74 04                	je     8038f0 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8038ec:	89 d8                	mov    %ebx,%eax
+  8038ee:	eb b3                	jmp    8038a3 <malloc+0xce>
+  8038f0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8038f3:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8038f8:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8038fc:	83 ea 01             	sub    $0x1,%edx
+  8038ff:	0f 85 50 ff ff ff    	jne    803855 <malloc+0x80>
+  803905:	c7 05 c8 05 91 00 00 	movl   $0x8000000,0x9105c8
+  80390c:	00 00 08 
+				return 0;	/* out of address space */
+  80390f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803914:	eb 42                	jmp    803958 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803916:	85 db                	test   %ebx,%ebx
+  803918:	78 1e                	js     803938 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80391a:	83 ec 08             	sub    $0x8,%esp
+  80391d:	89 d8                	mov    %ebx,%eax
+  80391f:	03 05 c8 05 91 00    	add    0x9105c8,%eax
+  803925:	50                   	push   %eax
+  803926:	6a 00                	push   $0x0
+  803928:	e8 04 db ff ff       	call   801431 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80392d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803933:	83 c4 10             	add    $0x10,%esp
+  803936:	eb de                	jmp    803916 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803938:	bf 00 00 00 00       	mov    $0x0,%edi
+  80393d:	eb 19                	jmp    803958 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80393f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803942:	8b 3d c8 05 91 00    	mov    0x9105c8,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803948:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80394f:	00 
+	mptr += n;
+  803950:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803953:	a3 c8 05 91 00       	mov    %eax,0x9105c8
+	mutex_unlock(&malloc_mu);
+  803958:	83 ec 0c             	sub    $0xc,%esp
+  80395b:	68 c4 05 91 00       	push   $0x9105c4
+  803960:	e8 78 05 00 00       	call   803edd <mutex_unlock>
+}
+  803965:	89 f8                	mov    %edi,%eax
+  803967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80396a:	5b                   	pop    %ebx
+  80396b:	5e                   	pop    %esi
+  80396c:	5f                   	pop    %edi
+  80396d:	5d                   	pop    %ebp
+  80396e:	c3                   	ret
+		return 0;
+  80396f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803974:	eb e2                	jmp    803958 <malloc+0x183>
+  803976:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80397a:	74 06                	je     803982 <malloc+0x1ad>
+  80397c:	89 1d c8 05 91 00    	mov    %ebx,0x9105c8
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803982:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803987:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80398a:	39 fb                	cmp    %edi,%ebx
+  80398c:	73 b1                	jae    80393f <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80398e:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803994:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803997:	39 fe                	cmp    %edi,%esi
+  803999:	0f 92 c0             	setb   %al
+  80399c:	0f b6 c0             	movzbl %al,%eax
+  80399f:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8039a2:	83 c8 07             	or     $0x7,%eax
+  8039a5:	50                   	push   %eax
+  8039a6:	89 d8                	mov    %ebx,%eax
+  8039a8:	03 05 c8 05 91 00    	add    0x9105c8,%eax
+  8039ae:	50                   	push   %eax
+  8039af:	6a 00                	push   $0x0
+  8039b1:	e8 e2 d9 ff ff       	call   801398 <sys_page_alloc>
+  8039b6:	83 c4 10             	add    $0x10,%esp
+  8039b9:	85 c0                	test   %eax,%eax
+  8039bb:	0f 88 55 ff ff ff    	js     803916 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8039c1:	89 f3                	mov    %esi,%ebx
+  8039c3:	eb c5                	jmp    80398a <malloc+0x1b5>
+
+008039c5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8039c5:	55                   	push   %ebp
+  8039c6:	89 e5                	mov    %esp,%ebp
+  8039c8:	56                   	push   %esi
+  8039c9:	53                   	push   %ebx
+  8039ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039cd:	83 ec 0c             	sub    $0xc,%esp
+  8039d0:	ff 75 08             	push   0x8(%ebp)
+  8039d3:	e8 72 de ff ff       	call   80184a <fd2data>
+  8039d8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8039da:	83 c4 08             	add    $0x8,%esp
+  8039dd:	68 47 5a 80 00       	push   $0x805a47
+  8039e2:	53                   	push   %ebx
+  8039e3:	e8 72 d5 ff ff       	call   800f5a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8039e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8039eb:	2b 06                	sub    (%esi),%eax
+  8039ed:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8039f3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8039fa:	00 00 00 
+	stat->st_dev = &devpipe;
+  8039fd:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803a04:	62 80 00 
+	return 0;
+}
+  803a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a0f:	5b                   	pop    %ebx
+  803a10:	5e                   	pop    %esi
+  803a11:	5d                   	pop    %ebp
+  803a12:	c3                   	ret
+
+00803a13 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803a13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a18:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803a1c:	85 c9                	test   %ecx,%ecx
+  803a1e:	75 01                	jne    803a21 <pipewake+0xe>
+  803a20:	c3                   	ret
+{
+  803a21:	55                   	push   %ebp
+  803a22:	89 e5                	mov    %esp,%ebp
+  803a24:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803a27:	68 00 04 00 00       	push   $0x400
+  803a2c:	52                   	push   %edx
+  803a2d:	e8 aa dc ff ff       	call   8016dc <sys_futex_wake>
+  803a32:	83 c4 10             	add    $0x10,%esp
+}
+  803a35:	c9                   	leave
+  803a36:	c3                   	ret
+
+00803a37 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803a37:	55                   	push   %ebp
+  803a38:	89 e5                	mov    %esp,%ebp
+  803a3a:	56                   	push   %esi
+  803a3b:	53                   	push   %ebx
+  803a3c:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a3f:	83 ec 0c             	sub    $0xc,%esp
+  803a42:	56                   	push   %esi
+  803a43:	e8 02 de ff ff       	call   80184a <fd2data>
+  803a48:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803a4a:	83 c4 08             	add    $0x8,%esp
+  803a4d:	56                   	push   %esi
+  803a4e:	6a 00                	push   $0x0
+  803a50:	e8 dc d9 ff ff       	call   801431 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803a55:	8d 53 04             	lea    0x4(%ebx),%edx
+  803a58:	8d 43 08             	lea    0x8(%ebx),%eax
+  803a5b:	e8 b3 ff ff ff       	call   803a13 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803a60:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803a63:	89 da                	mov    %ebx,%edx
+  803a65:	e8 a9 ff ff ff       	call   803a13 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803a6a:	89 34 24             	mov    %esi,(%esp)
+  803a6d:	e8 d8 dd ff ff       	call   80184a <fd2data>
+  803a72:	83 c4 08             	add    $0x8,%esp
+  803a75:	50                   	push   %eax
+  803a76:	6a 00                	push   $0x0
+  803a78:	e8 b4 d9 ff ff       	call   801431 <sys_page_unmap>
+}
+  803a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a80:	5b                   	pop    %ebx
+  803a81:	5e                   	pop    %esi
+  803a82:	5d                   	pop    %ebp
+  803a83:	c3                   	ret
+
+00803a84 <_pipeisclosed>:
+{
+  803a84:	55                   	push   %ebp
+  803a85:	89 e5                	mov    %esp,%ebp
+  803a87:	57                   	push   %edi
+  803a88:	56                   	push   %esi
+  803a89:	53                   	push   %ebx
+  803a8a:	83 ec 1c             	sub    $0x1c,%esp
+  803a8d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803a90:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a92:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803a97:	eb 5d                	jmp    803af6 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803a99:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		n = thisenv->env_runs;
+  803a9f:	8b 02                	mov    (%edx),%eax
+  803aa1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803aa4:	83 ec 0c             	sub    $0xc,%esp
+  803aa7:	ff 75 e0             	push   -0x20(%ebp)
+  803aaa:	e8 42 15 00 00       	call   804ff1 <pageref>
+  803aaf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803ab2:	89 3c 24             	mov    %edi,(%esp)
+  803ab5:	e8 37 15 00 00       	call   804ff1 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803aba:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803abc:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803ac2:	83 c4 10             	add    $0x10,%esp
+  803ac5:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803acb:	77 15                	ja     803ae2 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803acd:	89 f2                	mov    %esi,%edx
+  803acf:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803ad1:	c1 ea 10             	shr    $0x10,%edx
+  803ad4:	74 0c                	je     803ae2 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ad6:	c1 e2 10             	shl    $0x10,%edx
+  803ad9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803ade:	29 d1                	sub    %edx,%ecx
+  803ae0:	eb 06                	jmp    803ae8 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803ae2:	8b 0d 80 08 91 00    	mov    0x910880,%ecx
+		nn = thisenv->env_runs;
+  803ae8:	8b 11                	mov    (%ecx),%edx
+  803aea:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803aed:	39 d3                	cmp    %edx,%ebx
+  803aef:	74 6e                	je     803b5f <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803af1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803af4:	74 24                	je     803b1a <_pipeisclosed+0x96>
+  803af6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803af8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803afe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b03:	77 94                	ja     803a99 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b05:	89 f0                	mov    %esi,%eax
+  803b07:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803b09:	c1 e8 10             	shr    $0x10,%eax
+  803b0c:	74 8b                	je     803a99 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b0e:	c1 e0 10             	shl    $0x10,%eax
+  803b11:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b16:	29 c2                	sub    %eax,%edx
+  803b18:	eb 85                	jmp    803a9f <_pipeisclosed+0x1b>
+  803b1a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b1c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b22:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b27:	77 18                	ja     803b41 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b29:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b2e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803b30:	c1 e8 10             	shr    $0x10,%eax
+  803b33:	74 0c                	je     803b41 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b35:	c1 e0 10             	shl    $0x10,%eax
+  803b38:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b3d:	29 c2                	sub    %eax,%edx
+  803b3f:	eb 06                	jmp    803b47 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803b41:	8b 15 80 08 91 00    	mov    0x910880,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803b47:	8b 02                	mov    (%edx),%eax
+  803b49:	8b 40 58             	mov    0x58(%eax),%eax
+  803b4c:	6a 01                	push   $0x1
+  803b4e:	50                   	push   %eax
+  803b4f:	53                   	push   %ebx
+  803b50:	68 4e 5a 80 00       	push   $0x805a4e
+  803b55:	e8 1c ce ff ff       	call   800976 <cprintf>
+  803b5a:	83 c4 10             	add    $0x10,%esp
+  803b5d:	eb 97                	jmp    803af6 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803b5f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803b62:	0f 94 c0             	sete   %al
+  803b65:	0f b6 c0             	movzbl %al,%eax
+}
+  803b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b6b:	5b                   	pop    %ebx
+  803b6c:	5e                   	pop    %esi
+  803b6d:	5f                   	pop    %edi
+  803b6e:	5d                   	pop    %ebp
+  803b6f:	c3                   	ret
+
+00803b70 <devpipe_write>:
+{
+  803b70:	55                   	push   %ebp
+  803b71:	89 e5                	mov    %esp,%ebp
+  803b73:	57                   	push   %edi
+  803b74:	56                   	push   %esi
+  803b75:	53                   	push   %ebx
+  803b76:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803b79:	ff 75 08             	push   0x8(%ebp)
+  803b7c:	e8 c9 dc ff ff       	call   80184a <fd2data>
+  803b81:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803b83:	83 c4 10             	add    $0x10,%esp
+  803b86:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803b8d:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803b90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b93:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b96:	0f 84 96 00 00 00    	je     803c32 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803b9c:	8d 73 08             	lea    0x8(%ebx),%esi
+  803b9f:	eb 32                	jmp    803bd3 <devpipe_write+0x63>
+  803ba1:	89 fa                	mov    %edi,%edx
+  803ba3:	89 f0                	mov    %esi,%eax
+  803ba5:	e8 69 fe ff ff       	call   803a13 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803baa:	8b 43 04             	mov    0x4(%ebx),%eax
+  803bad:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803bb0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bb5:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803bba:	83 ec 04             	sub    $0x4,%esp
+  803bbd:	6a 0a                	push   $0xa
+  803bbf:	50                   	push   %eax
+  803bc0:	53                   	push   %ebx
+  803bc1:	e8 e7 da ff ff       	call   8016ad <sys_futex_wait>
+  803bc6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803bcb:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803bd0:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803bd3:	8b 43 04             	mov    0x4(%ebx),%eax
+  803bd6:	8b 0b                	mov    (%ebx),%ecx
+  803bd8:	8d 51 20             	lea    0x20(%ecx),%edx
+  803bdb:	39 d0                	cmp    %edx,%eax
+  803bdd:	72 1b                	jb     803bfa <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803bdf:	89 da                	mov    %ebx,%edx
+  803be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803be4:	e8 9b fe ff ff       	call   803a84 <_pipeisclosed>
+  803be9:	85 c0                	test   %eax,%eax
+  803beb:	74 b4                	je     803ba1 <devpipe_write+0x31>
+				return 0;
+  803bed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bf5:	5b                   	pop    %ebx
+  803bf6:	5e                   	pop    %esi
+  803bf7:	5f                   	pop    %edi
+  803bf8:	5d                   	pop    %ebp
+  803bf9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803bfd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c00:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803c04:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803c07:	89 c2                	mov    %eax,%edx
+  803c09:	c1 fa 1f             	sar    $0x1f,%edx
+  803c0c:	89 d1                	mov    %edx,%ecx
+  803c0e:	c1 e9 1b             	shr    $0x1b,%ecx
+  803c11:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803c14:	83 e2 1f             	and    $0x1f,%edx
+  803c17:	29 ca                	sub    %ecx,%edx
+  803c19:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803c1d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803c21:	83 c0 01             	add    $0x1,%eax
+  803c24:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803c27:	83 c6 01             	add    $0x1,%esi
+  803c2a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803c2d:	e9 5e ff ff ff       	jmp    803b90 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803c32:	8d 53 04             	lea    0x4(%ebx),%edx
+  803c35:	8d 43 08             	lea    0x8(%ebx),%eax
+  803c38:	e8 d6 fd ff ff       	call   803a13 <pipewake>
+	return i;
+  803c3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c40:	eb b0                	jmp    803bf2 <devpipe_write+0x82>
+
+00803c42 <devpipe_read>:
+{
+  803c42:	55                   	push   %ebp
+  803c43:	89 e5                	mov    %esp,%ebp
+  803c45:	57                   	push   %edi
+  803c46:	56                   	push   %esi
+  803c47:	53                   	push   %ebx
+  803c48:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803c4b:	ff 75 08             	push   0x8(%ebp)
+  803c4e:	e8 f7 db ff ff       	call   80184a <fd2data>
+  803c53:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803c55:	83 c4 10             	add    $0x10,%esp
+  803c58:	be 00 00 00 00       	mov    $0x0,%esi
+  803c5d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803c60:	74 6c                	je     803cce <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803c62:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803c65:	eb 25                	jmp    803c8c <devpipe_read+0x4a>
+  803c67:	8b 13                	mov    (%ebx),%edx
+  803c69:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c6e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803c73:	83 ec 04             	sub    $0x4,%esp
+  803c76:	6a 0a                	push   $0xa
+  803c78:	52                   	push   %edx
+  803c79:	57                   	push   %edi
+  803c7a:	e8 2e da ff ff       	call   8016ad <sys_futex_wait>
+  803c7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803c84:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803c89:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803c8c:	8b 03                	mov    (%ebx),%eax
+  803c8e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803c91:	75 19                	jne    803cac <devpipe_read+0x6a>
+			if (i > 0)
+  803c93:	85 f6                	test   %esi,%esi
+  803c95:	75 3a                	jne    803cd1 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803c97:	89 da                	mov    %ebx,%edx
+  803c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c9c:	e8 e3 fd ff ff       	call   803a84 <_pipeisclosed>
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	74 c2                	je     803c67 <devpipe_read+0x25>
+				return 0;
+  803ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803caa:	eb 31                	jmp    803cdd <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803cac:	89 c1                	mov    %eax,%ecx
+  803cae:	c1 f9 1f             	sar    $0x1f,%ecx
+  803cb1:	c1 e9 1b             	shr    $0x1b,%ecx
+  803cb4:	01 c8                	add    %ecx,%eax
+  803cb6:	83 e0 1f             	and    $0x1f,%eax
+  803cb9:	29 c8                	sub    %ecx,%eax
+  803cbb:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803cc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803cc3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803cc6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803cc9:	83 c6 01             	add    $0x1,%esi
+  803ccc:	eb 8f                	jmp    803c5d <devpipe_read+0x1b>
+out:
+  803cce:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803cd1:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803cd4:	89 da                	mov    %ebx,%edx
+  803cd6:	e8 38 fd ff ff       	call   803a13 <pipewake>
+	return i;
+  803cdb:	89 f0                	mov    %esi,%eax
+}
+  803cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ce0:	5b                   	pop    %ebx
+  803ce1:	5e                   	pop    %esi
+  803ce2:	5f                   	pop    %edi
+  803ce3:	5d                   	pop    %ebp
+  803ce4:	c3                   	ret
+
+00803ce5 <pipe>:
+{
+  803ce5:	55                   	push   %ebp
+  803ce6:	89 e5                	mov    %esp,%ebp
+  803ce8:	56                   	push   %esi
+  803ce9:	53                   	push   %ebx
+  803cea:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803ced:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cf0:	50                   	push   %eax
+  803cf1:	e8 6b db ff ff       	call   801861 <fd_alloc>
+  803cf6:	89 c3                	mov    %eax,%ebx
+  803cf8:	83 c4 10             	add    $0x10,%esp
+  803cfb:	85 c0                	test   %eax,%eax
+  803cfd:	0f 88 23 01 00 00    	js     803e26 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d03:	83 ec 04             	sub    $0x4,%esp
+  803d06:	68 07 04 00 00       	push   $0x407
+  803d0b:	ff 75 f4             	push   -0xc(%ebp)
+  803d0e:	6a 00                	push   $0x0
+  803d10:	e8 83 d6 ff ff       	call   801398 <sys_page_alloc>
+  803d15:	89 c3                	mov    %eax,%ebx
+  803d17:	83 c4 10             	add    $0x10,%esp
+  803d1a:	85 c0                	test   %eax,%eax
+  803d1c:	0f 88 04 01 00 00    	js     803e26 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803d22:	83 ec 0c             	sub    $0xc,%esp
+  803d25:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803d28:	50                   	push   %eax
+  803d29:	e8 33 db ff ff       	call   801861 <fd_alloc>
+  803d2e:	89 c3                	mov    %eax,%ebx
+  803d30:	83 c4 10             	add    $0x10,%esp
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	0f 88 db 00 00 00    	js     803e16 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d3b:	83 ec 04             	sub    $0x4,%esp
+  803d3e:	68 07 04 00 00       	push   $0x407
+  803d43:	ff 75 f0             	push   -0x10(%ebp)
+  803d46:	6a 00                	push   $0x0
+  803d48:	e8 4b d6 ff ff       	call   801398 <sys_page_alloc>
+  803d4d:	89 c3                	mov    %eax,%ebx
+  803d4f:	83 c4 10             	add    $0x10,%esp
+  803d52:	85 c0                	test   %eax,%eax
+  803d54:	0f 88 bc 00 00 00    	js     803e16 <pipe+0x131>
+	va = fd2data(fd0);
+  803d5a:	83 ec 0c             	sub    $0xc,%esp
+  803d5d:	ff 75 f4             	push   -0xc(%ebp)
+  803d60:	e8 e5 da ff ff       	call   80184a <fd2data>
+  803d65:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d67:	83 c4 0c             	add    $0xc,%esp
+  803d6a:	68 07 04 00 00       	push   $0x407
+  803d6f:	50                   	push   %eax
+  803d70:	6a 00                	push   $0x0
+  803d72:	e8 21 d6 ff ff       	call   801398 <sys_page_alloc>
+  803d77:	89 c3                	mov    %eax,%ebx
+  803d79:	83 c4 10             	add    $0x10,%esp
+  803d7c:	85 c0                	test   %eax,%eax
+  803d7e:	0f 88 82 00 00 00    	js     803e06 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d84:	83 ec 0c             	sub    $0xc,%esp
+  803d87:	ff 75 f0             	push   -0x10(%ebp)
+  803d8a:	e8 bb da ff ff       	call   80184a <fd2data>
+  803d8f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803d96:	50                   	push   %eax
+  803d97:	6a 00                	push   $0x0
+  803d99:	56                   	push   %esi
+  803d9a:	6a 00                	push   $0x0
+  803d9c:	e8 44 d6 ff ff       	call   8013e5 <sys_page_map>
+  803da1:	89 c3                	mov    %eax,%ebx
+  803da3:	83 c4 20             	add    $0x20,%esp
+  803da6:	85 c0                	test   %eax,%eax
+  803da8:	78 4e                	js     803df8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803daa:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803daf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803db2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803db4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803db7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803dbe:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803dc1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803dc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803dc6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803dcd:	83 ec 0c             	sub    $0xc,%esp
+  803dd0:	ff 75 f4             	push   -0xc(%ebp)
+  803dd3:	e8 62 da ff ff       	call   80183a <fd2num>
+  803dd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803ddb:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803ddd:	83 c4 04             	add    $0x4,%esp
+  803de0:	ff 75 f0             	push   -0x10(%ebp)
+  803de3:	e8 52 da ff ff       	call   80183a <fd2num>
+  803de8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803deb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803dee:	83 c4 10             	add    $0x10,%esp
+  803df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803df6:	eb 2e                	jmp    803e26 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803df8:	83 ec 08             	sub    $0x8,%esp
+  803dfb:	56                   	push   %esi
+  803dfc:	6a 00                	push   $0x0
+  803dfe:	e8 2e d6 ff ff       	call   801431 <sys_page_unmap>
+  803e03:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803e06:	83 ec 08             	sub    $0x8,%esp
+  803e09:	ff 75 f0             	push   -0x10(%ebp)
+  803e0c:	6a 00                	push   $0x0
+  803e0e:	e8 1e d6 ff ff       	call   801431 <sys_page_unmap>
+  803e13:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803e16:	83 ec 08             	sub    $0x8,%esp
+  803e19:	ff 75 f4             	push   -0xc(%ebp)
+  803e1c:	6a 00                	push   $0x0
+  803e1e:	e8 0e d6 ff ff       	call   801431 <sys_page_unmap>
+  803e23:	83 c4 10             	add    $0x10,%esp
+}
+  803e26:	89 d8                	mov    %ebx,%eax
+  803e28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e2b:	5b                   	pop    %ebx
+  803e2c:	5e                   	pop    %esi
+  803e2d:	5d                   	pop    %ebp
+  803e2e:	c3                   	ret
+
+00803e2f <pipeisclosed>:
+{
+  803e2f:	55                   	push   %ebp
+  803e30:	89 e5                	mov    %esp,%ebp
+  803e32:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e38:	50                   	push   %eax
+  803e39:	ff 75 08             	push   0x8(%ebp)
+  803e3c:	e8 76 da ff ff       	call   8018b7 <fd_lookup>
+  803e41:	83 c4 10             	add    $0x10,%esp
+  803e44:	85 c0                	test   %eax,%eax
+  803e46:	78 18                	js     803e60 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803e48:	83 ec 0c             	sub    $0xc,%esp
+  803e4b:	ff 75 f4             	push   -0xc(%ebp)
+  803e4e:	e8 f7 d9 ff ff       	call   80184a <fd2data>
+  803e53:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803e55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e58:	e8 27 fc ff ff       	call   803a84 <_pipeisclosed>
+  803e5d:	83 c4 10             	add    $0x10,%esp
+}
+  803e60:	c9                   	leave
+  803e61:	c3                   	ret
+
+00803e62 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803e62:	55                   	push   %ebp
+  803e63:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803e65:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e68:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e6e:	5d                   	pop    %ebp
+  803e6f:	c3                   	ret
+
+00803e70 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803e70:	55                   	push   %ebp
+  803e71:	89 e5                	mov    %esp,%ebp
+  803e73:	56                   	push   %esi
+  803e74:	53                   	push   %ebx
+  803e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e7d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803e82:	89 d0                	mov    %edx,%eax
+  803e84:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e88:	85 c0                	test   %eax,%eax
+  803e8a:	74 2d                	je     803eb9 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803e8c:	83 f8 02             	cmp    $0x2,%eax
+  803e8f:	74 08                	je     803e99 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803e91:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e96:	f0 87 03             	lock xchg %eax,(%ebx)
+  803e99:	be 02 00 00 00       	mov    $0x2,%esi
+  803e9e:	eb 15                	jmp    803eb5 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803ea0:	83 ec 04             	sub    $0x4,%esp
+  803ea3:	6a 00                	push   $0x0
+  803ea5:	6a 02                	push   $0x2
+  803ea7:	53                   	push   %ebx
+  803ea8:	e8 00 d8 ff ff       	call   8016ad <sys_futex_wait>
+  803ead:	89 f0                	mov    %esi,%eax
+  803eaf:	f0 87 03             	lock xchg %eax,(%ebx)
+  803eb2:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803eb5:	85 c0                	test   %eax,%eax
+  803eb7:	75 e7                	jne    803ea0 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803eb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ebc:	5b                   	pop    %ebx
+  803ebd:	5e                   	pop    %esi
+  803ebe:	5d                   	pop    %ebp
+  803ebf:	c3                   	ret
+
+00803ec0 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803ec0:	55                   	push   %ebp
+  803ec1:	89 e5                	mov    %esp,%ebp
+  803ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ed0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803ed4:	f7 d8                	neg    %eax
+  803ed6:	19 c0                	sbb    %eax,%eax
+  803ed8:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803edb:	5d                   	pop    %ebp
+  803edc:	c3                   	ret
+
+00803edd <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803edd:	55                   	push   %ebp
+  803ede:	89 e5                	mov    %esp,%ebp
+  803ee0:	83 ec 08             	sub    $0x8,%esp
+  803ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eeb:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803eee:	83 f8 02             	cmp    $0x2,%eax
+  803ef1:	74 02                	je     803ef5 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ef3:	c9                   	leave
+  803ef4:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803ef5:	83 ec 08             	sub    $0x8,%esp
+  803ef8:	6a 01                	push   $0x1
+  803efa:	52                   	push   %edx
+  803efb:	e8 dc d7 ff ff       	call   8016dc <sys_futex_wake>
+  803f00:	83 c4 10             	add    $0x10,%esp
+}
+  803f03:	eb ee                	jmp    803ef3 <mutex_unlock+0x16>
+
+00803f05 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803f05:	55                   	push   %ebp
+  803f06:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f0b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803f11:	5d                   	pop    %ebp
+  803f12:	c3                   	ret
+
+00803f13 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803f13:	55                   	push   %ebp
+  803f14:	89 e5                	mov    %esp,%ebp
+  803f16:	57                   	push   %edi
+  803f17:	56                   	push   %esi
+  803f18:	53                   	push   %ebx
+  803f19:	83 ec 18             	sub    $0x18,%esp
+  803f1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  803f1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803f22:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803f24:	53                   	push   %ebx
+  803f25:	e8 b3 ff ff ff       	call   803edd <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f2a:	83 c4 0c             	add    $0xc,%esp
+  803f2d:	ff 75 10             	push   0x10(%ebp)
+  803f30:	57                   	push   %edi
+  803f31:	56                   	push   %esi
+  803f32:	e8 76 d7 ff ff       	call   8016ad <sys_futex_wait>
+  803f37:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803f39:	83 c4 10             	add    $0x10,%esp
+  803f3c:	be 02 00 00 00       	mov    $0x2,%esi
+  803f41:	eb 10                	jmp    803f53 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803f43:	83 ec 04             	sub    $0x4,%esp
+  803f46:	6a 00                	push   $0x0
+  803f48:	6a 02                	push   $0x2
+  803f4a:	53                   	push   %ebx
+  803f4b:	e8 5d d7 ff ff       	call   8016ad <sys_futex_wait>
+  803f50:	83 c4 10             	add    $0x10,%esp
+  803f53:	89 f0                	mov    %esi,%eax
+  803f55:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803f58:	85 c0                	test   %eax,%eax
+  803f5a:	75 e7                	jne    803f43 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803f5c:	83 ff ec             	cmp    $0xffffffec,%edi
+  803f5f:	74 05                	je     803f66 <cond_timedwait+0x53>
+  803f61:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803f66:	89 f8                	mov    %edi,%eax
+  803f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f6b:	5b                   	pop    %ebx
+  803f6c:	5e                   	pop    %esi
+  803f6d:	5f                   	pop    %edi
+  803f6e:	5d                   	pop    %ebp
+  803f6f:	c3                   	ret
+
+00803f70 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f70:	55                   	push   %ebp
+  803f71:	89 e5                	mov    %esp,%ebp
+  803f73:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803f76:	6a 00                	push   $0x0
+  803f78:	ff 75 0c             	push   0xc(%ebp)
+  803f7b:	ff 75 08             	push   0x8(%ebp)
+  803f7e:	e8 90 ff ff ff       	call   803f13 <cond_timedwait>
+}
+  803f83:	83 c4 10             	add    $0x10,%esp
+  803f86:	c9                   	leave
+  803f87:	c3                   	ret
+
+00803f88 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f88:	55                   	push   %ebp
+  803f89:	89 e5                	mov    %esp,%ebp
+  803f8b:	83 ec 10             	sub    $0x10,%esp
+  803f8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803f91:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f96:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803f9a:	6a 01                	push   $0x1
+  803f9c:	50                   	push   %eax
+  803f9d:	e8 3a d7 ff ff       	call   8016dc <sys_futex_wake>
+}
+  803fa2:	83 c4 10             	add    $0x10,%esp
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+
+00803fa7 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803fa7:	55                   	push   %ebp
+  803fa8:	89 e5                	mov    %esp,%ebp
+  803faa:	83 ec 10             	sub    $0x10,%esp
+  803fad:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fb5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803fb9:	68 00 04 00 00       	push   $0x400
+  803fbe:	50                   	push   %eax
+  803fbf:	e8 18 d7 ff ff       	call   8016dc <sys_futex_wake>
+}
+  803fc4:	83 c4 10             	add    $0x10,%esp
+  803fc7:	c9                   	leave
+  803fc8:	c3                   	ret
+
+00803fc9 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803fc9:	55                   	push   %ebp
+  803fca:	89 e5                	mov    %esp,%ebp
+  803fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803fcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fd2:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803fd4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803fdb:	5d                   	pop    %ebp
+  803fdc:	c3                   	ret
+
+00803fdd <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803fdd:	55                   	push   %ebp
+  803fde:	89 e5                	mov    %esp,%ebp
+  803fe0:	53                   	push   %ebx
+  803fe1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803fe4:	8b 11                	mov    (%ecx),%edx
+  803fe6:	85 d2                	test   %edx,%edx
+  803fe8:	74 14                	je     803ffe <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803fea:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803fed:	89 d0                	mov    %edx,%eax
+  803fef:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803ff3:	39 c2                	cmp    %eax,%edx
+  803ff5:	75 ed                	jne    803fe4 <sem_trywait+0x7>
+			return 0;
+  803ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ffc:	eb 05                	jmp    804003 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803ffe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  804003:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804006:	c9                   	leave
+  804007:	c3                   	ret
+
+00804008 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  804008:	55                   	push   %ebp
+  804009:	89 e5                	mov    %esp,%ebp
+  80400b:	57                   	push   %edi
+  80400c:	56                   	push   %esi
+  80400d:	53                   	push   %ebx
+  80400e:	83 ec 1c             	sub    $0x1c,%esp
+  804011:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804014:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  804017:	e8 09 d6 ff ff       	call   801625 <sys_time_msec>
+  80401c:	01 f8                	add    %edi,%eax
+  80401e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  804021:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  804026:	eb 28                	jmp    804050 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  804028:	b8 01 00 00 00       	mov    $0x1,%eax
+  80402d:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  804032:	83 ec 04             	sub    $0x4,%esp
+  804035:	56                   	push   %esi
+  804036:	6a 00                	push   $0x0
+  804038:	53                   	push   %ebx
+  804039:	e8 6f d6 ff ff       	call   8016ad <sys_futex_wait>
+  80403e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  804043:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  804048:	83 c4 10             	add    $0x10,%esp
+  80404b:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80404e:	74 2e                	je     80407e <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  804050:	83 ec 0c             	sub    $0xc,%esp
+  804053:	53                   	push   %ebx
+  804054:	e8 84 ff ff ff       	call   803fdd <sem_trywait>
+  804059:	83 c4 10             	add    $0x10,%esp
+  80405c:	85 c0                	test   %eax,%eax
+  80405e:	79 19                	jns    804079 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  804060:	85 ff                	test   %edi,%edi
+  804062:	74 c4                	je     804028 <sem_timedwait+0x20>
+  804064:	e8 bc d5 ff ff       	call   801625 <sys_time_msec>
+  804069:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80406c:	29 c6                	sub    %eax,%esi
+  80406e:	85 f6                	test   %esi,%esi
+  804070:	7f b6                	jg     804028 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  804072:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  804077:	eb 05                	jmp    80407e <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  804079:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80407e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804081:	5b                   	pop    %ebx
+  804082:	5e                   	pop    %esi
+  804083:	5f                   	pop    %edi
+  804084:	5d                   	pop    %ebp
+  804085:	c3                   	ret
+
+00804086 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  804086:	55                   	push   %ebp
+  804087:	89 e5                	mov    %esp,%ebp
+  804089:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80408c:	6a 00                	push   $0x0
+  80408e:	ff 75 08             	push   0x8(%ebp)
+  804091:	e8 72 ff ff ff       	call   804008 <sem_timedwait>
+}
+  804096:	83 c4 10             	add    $0x10,%esp
+  804099:	c9                   	leave
+  80409a:	c3                   	ret
+
+0080409b <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80409b:	55                   	push   %ebp
+  80409c:	89 e5                	mov    %esp,%ebp
+  80409e:	83 ec 08             	sub    $0x8,%esp
+  8040a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040a9:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8040ad:	8b 50 04             	mov    0x4(%eax),%edx
+  8040b0:	85 d2                	test   %edx,%edx
+  8040b2:	75 02                	jne    8040b6 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8040b4:	c9                   	leave
+  8040b5:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8040b6:	83 ec 08             	sub    $0x8,%esp
+  8040b9:	6a 01                	push   $0x1
+  8040bb:	50                   	push   %eax
+  8040bc:	e8 1b d6 ff ff       	call   8016dc <sys_futex_wake>
+  8040c1:	83 c4 10             	add    $0x10,%esp
+}
+  8040c4:	eb ee                	jmp    8040b4 <sem_post+0x19>
+
+008040c6 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8040c6:	55                   	push   %ebp
+  8040c7:	89 e5                	mov    %esp,%ebp
+  8040c9:	57                   	push   %edi
+  8040ca:	56                   	push   %esi
+  8040cb:	53                   	push   %ebx
+  8040cc:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8040cf:	68 e0 05 91 00       	push   $0x9105e0
+  8040d4:	e8 97 fd ff ff       	call   803e70 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8040d9:	a1 04 06 91 00       	mov    0x910604,%eax
+  8040de:	83 c4 10             	add    $0x10,%esp
+  8040e1:	85 c0                	test   %eax,%eax
+  8040e3:	75 19                	jne    8040fe <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8040e5:	a1 80 08 91 00       	mov    0x910880,%eax
+  8040ea:	8b 00                	mov    (%eax),%eax
+  8040ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8040ef:	a3 00 06 91 00       	mov    %eax,0x910600
+		threads[0].th_state = PTH_RUNNING;
+  8040f4:	c7 05 04 06 91 00 01 	movl   $0x1,0x910604
+  8040fb:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8040fe:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  804103:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804106:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  80410d:	8b 40 04             	mov    0x4(%eax),%eax
+  804110:	85 c0                	test   %eax,%eax
+  804112:	0f 84 e4 00 00 00    	je     8041fc <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  804118:	83 c3 01             	add    $0x1,%ebx
+  80411b:	83 fb 20             	cmp    $0x20,%ebx
+  80411e:	75 e3                	jne    804103 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  804120:	83 ec 0c             	sub    $0xc,%esp
+  804123:	68 e0 05 91 00       	push   $0x9105e0
+  804128:	e8 b0 fd ff ff       	call   803edd <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80412d:	83 c4 10             	add    $0x10,%esp
+  804130:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  804135:	e9 b8 00 00 00       	jmp    8041f2 <pthread_create+0x12c>
+  80413a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80413d:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  804140:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  804142:	39 f3                	cmp    %esi,%ebx
+  804144:	73 16                	jae    80415c <pthread_create+0x96>
+		va -= PGSIZE;
+  804146:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80414c:	83 ec 08             	sub    $0x8,%esp
+  80414f:	56                   	push   %esi
+  804150:	6a 00                	push   $0x0
+  804152:	e8 da d2 ff ff       	call   801431 <sys_page_unmap>
+  804157:	83 c4 10             	add    $0x10,%esp
+  80415a:	eb e6                	jmp    804142 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80415c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80415f:	83 ec 08             	sub    $0x8,%esp
+  804162:	ff 75 e4             	push   -0x1c(%ebp)
+  804165:	6a 00                	push   $0x0
+  804167:	e8 c5 d2 ff ff       	call   801431 <sys_page_unmap>
+	return r;
+  80416c:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80416f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804172:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  804179:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  804180:	eb 70                	jmp    8041f2 <pthread_create+0x12c>
+	th->th_fn = fn;
+  804182:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804185:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  80418c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80418f:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  804192:	8b 55 10             	mov    0x10(%ebp),%edx
+  804195:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  804198:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80419f:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8041a4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8041a7:	29 c8                	sub    %ecx,%eax
+  8041a9:	85 db                	test   %ebx,%ebx
+  8041ab:	0f 44 05 80 08 91 00 	cmove  0x910880,%eax
+	*--esp = t;
+  8041b2:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8041b5:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8041bc:	83 ec 04             	sub    $0x4,%esp
+  8041bf:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8041c4:	29 ca                	sub    %ecx,%edx
+  8041c6:	52                   	push   %edx
+	*--esp = 0;
+  8041c7:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8041ca:	50                   	push   %eax
+  8041cb:	68 23 44 80 00       	push   $0x804423
+  8041d0:	e8 ac d5 ff ff       	call   801781 <sys_thread_create>
+  8041d5:	89 c7                	mov    %eax,%edi
+  8041d7:	83 c4 10             	add    $0x10,%esp
+  8041da:	85 c0                	test   %eax,%eax
+  8041dc:	78 91                	js     80416f <pthread_create+0xa9>
+	th->th_env = id;
+  8041de:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041e1:	89 3c 85 00 06 91 00 	mov    %edi,0x910600(,%eax,4)
+	*tp = t;
+  8041e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041eb:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8041ed:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8041f2:	89 f8                	mov    %edi,%eax
+  8041f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f7:	5b                   	pop    %ebx
+  8041f8:	5e                   	pop    %esi
+  8041f9:	5f                   	pop    %edi
+  8041fa:	5d                   	pop    %ebp
+  8041fb:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8041fc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041ff:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  804206:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  80420d:	83 ec 0c             	sub    $0xc,%esp
+  804210:	68 e0 05 91 00       	push   $0x9105e0
+  804215:	e8 c3 fc ff ff       	call   803edd <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80421a:	89 d9                	mov    %ebx,%ecx
+  80421c:	c1 e1 10             	shl    $0x10,%ecx
+  80421f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  804222:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  804227:	29 c8                	sub    %ecx,%eax
+  804229:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80422c:	c1 e8 16             	shr    $0x16,%eax
+  80422f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804236:	83 c4 10             	add    $0x10,%esp
+  804239:	a8 01                	test   $0x1,%al
+  80423b:	74 15                	je     804252 <pthread_create+0x18c>
+  80423d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804240:	c1 e8 0c             	shr    $0xc,%eax
+  804243:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80424a:	a8 01                	test   $0x1,%al
+  80424c:	0f 85 30 ff ff ff    	jne    804182 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804252:	83 ec 04             	sub    $0x4,%esp
+  804255:	6a 07                	push   $0x7
+  804257:	ff 75 e4             	push   -0x1c(%ebp)
+  80425a:	6a 00                	push   $0x0
+  80425c:	e8 37 d1 ff ff       	call   801398 <sys_page_alloc>
+  804261:	89 c7                	mov    %eax,%edi
+  804263:	83 c4 10             	add    $0x10,%esp
+  804266:	85 c0                	test   %eax,%eax
+  804268:	0f 88 01 ff ff ff    	js     80416f <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80426e:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  804273:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804276:	29 d0                	sub    %edx,%eax
+  804278:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80427b:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80427d:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  804282:	29 d0                	sub    %edx,%eax
+  804284:	89 c7                	mov    %eax,%edi
+  804286:	39 fe                	cmp    %edi,%esi
+  804288:	0f 83 f4 fe ff ff    	jae    804182 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80428e:	83 ec 04             	sub    $0x4,%esp
+  804291:	6a 07                	push   $0x7
+  804293:	56                   	push   %esi
+  804294:	6a 00                	push   $0x0
+  804296:	e8 fd d0 ff ff       	call   801398 <sys_page_alloc>
+  80429b:	83 c4 10             	add    $0x10,%esp
+  80429e:	85 c0                	test   %eax,%eax
+  8042a0:	0f 88 94 fe ff ff    	js     80413a <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8042a6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8042ac:	eb d8                	jmp    804286 <pthread_create+0x1c0>
+
+008042ae <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8042ae:	55                   	push   %ebp
+  8042af:	89 e5                	mov    %esp,%ebp
+  8042b1:	57                   	push   %edi
+  8042b2:	56                   	push   %esi
+  8042b3:	53                   	push   %ebx
+  8042b4:	83 ec 0c             	sub    $0xc,%esp
+  8042b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8042ba:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8042bd:	83 f8 1e             	cmp    $0x1e,%eax
+  8042c0:	0f 87 c7 00 00 00    	ja     80438d <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8042c6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042c8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d3:	77 12                	ja     8042e7 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042da:	29 d0                	sub    %edx,%eax
+  8042dc:	c1 e8 10             	shr    $0x10,%eax
+  8042df:	39 c3                	cmp    %eax,%ebx
+  8042e1:	0f 84 ad 00 00 00    	je     804394 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8042e7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8042ea:	8d 3c 85 04 06 91 00 	lea    0x910604(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8042f1:	8d 34 85 00 06 91 00 	lea    0x910600(,%eax,4),%esi
+  8042f8:	eb 10                	jmp    80430a <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8042fa:	83 ec 04             	sub    $0x4,%esp
+  8042fd:	6a 00                	push   $0x0
+  8042ff:	6a 01                	push   $0x1
+  804301:	57                   	push   %edi
+  804302:	e8 a6 d3 ff ff       	call   8016ad <sys_futex_wait>
+  804307:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  80430a:	8b 46 04             	mov    0x4(%esi),%eax
+  80430d:	83 f8 01             	cmp    $0x1,%eax
+  804310:	74 e8                	je     8042fa <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  804312:	83 f8 02             	cmp    $0x2,%eax
+  804315:	0f 85 80 00 00 00    	jne    80439b <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80431b:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80431e:	c1 e6 02             	shl    $0x2,%esi
+  804321:	eb 05                	jmp    804328 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  804323:	e8 44 d0 ff ff       	call   80136c <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804328:	8b 8e 00 06 91 00    	mov    0x910600(%esi),%ecx
+  80432e:	89 ca                	mov    %ecx,%edx
+  804330:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804336:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804339:	c1 e0 04             	shl    $0x4,%eax
+  80433c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804341:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  804344:	39 c1                	cmp    %eax,%ecx
+  804346:	75 12                	jne    80435a <pthread_join+0xac>
+  804348:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80434b:	c1 e0 04             	shl    $0x4,%eax
+  80434e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804353:	8b 40 54             	mov    0x54(%eax),%eax
+  804356:	85 c0                	test   %eax,%eax
+  804358:	75 c9                	jne    804323 <pthread_join+0x75>
+	if (ret_store)
+  80435a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80435e:	74 0f                	je     80436f <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804360:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804363:	8b 04 85 10 06 91 00 	mov    0x910610(,%eax,4),%eax
+  80436a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80436d:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80436f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804372:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  804379:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804380:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804388:	5b                   	pop    %ebx
+  804389:	5e                   	pop    %esi
+  80438a:	5f                   	pop    %edi
+  80438b:	5d                   	pop    %ebp
+  80438c:	c3                   	ret
+		return -E_INVAL;
+  80438d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804392:	eb f1                	jmp    804385 <pthread_join+0xd7>
+  804394:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804399:	eb ea                	jmp    804385 <pthread_join+0xd7>
+		return -E_INVAL;
+  80439b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8043a0:	eb e3                	jmp    804385 <pthread_join+0xd7>
+
+008043a2 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8043a2:	55                   	push   %ebp
+  8043a3:	89 e5                	mov    %esp,%ebp
+  8043a5:	53                   	push   %ebx
+  8043a6:	83 ec 04             	sub    $0x4,%esp
+  8043a9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043ab:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043b1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b6:	77 0c                	ja     8043c4 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043bd:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8043bf:	c1 e8 10             	shr    $0x10,%eax
+  8043c2:	75 0a                	jne    8043ce <pthread_exit+0x2c>
+		exit();
+  8043c4:	e8 aa c4 ff ff       	call   800873 <exit>
+  8043c9:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8043ce:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8043d5:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8043d8:	8d 0c 8d 00 06 91 00 	lea    0x910600(,%ecx,4),%ecx
+  8043df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8043e2:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8043e5:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8043ec:	83 ec 08             	sub    $0x8,%esp
+  8043ef:	6a 20                	push   $0x20
+  8043f1:	01 c2                	add    %eax,%edx
+  8043f3:	8d 04 95 04 06 91 00 	lea    0x910604(,%edx,4),%eax
+  8043fa:	50                   	push   %eax
+  8043fb:	e8 dc d2 ff ff       	call   8016dc <sys_futex_wake>
+	sys_env_destroy(0);
+  804400:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804407:	e8 e9 ce ff ff       	call   8012f5 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80440c:	83 c4 0c             	add    $0xc,%esp
+  80440f:	68 66 5a 80 00       	push   $0x805a66
+  804414:	68 a5 00 00 00       	push   $0xa5
+  804419:	68 80 5a 80 00       	push   $0x805a80
+  80441e:	e8 78 c4 ff ff       	call   80089b <_panic>
+
+00804423 <pthread_start>:
+{
+  804423:	55                   	push   %ebp
+  804424:	89 e5                	mov    %esp,%ebp
+  804426:	53                   	push   %ebx
+  804427:	83 ec 04             	sub    $0x4,%esp
+  80442a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80442d:	e8 0e cf ff ff       	call   801340 <sys_getenvid>
+  804432:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804437:	8b 15 80 08 91 00    	mov    0x910880,%edx
+	if (t == 0)
+  80443d:	85 db                	test   %ebx,%ebx
+  80443f:	74 0c                	je     80444d <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804441:	89 d9                	mov    %ebx,%ecx
+  804443:	c1 e1 10             	shl    $0x10,%ecx
+  804446:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80444b:	29 ca                	sub    %ecx,%edx
+  80444d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804450:	c1 e0 04             	shl    $0x4,%eax
+  804453:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804458:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80445a:	83 ec 0c             	sub    $0xc,%esp
+  80445d:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804464:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804467:	ff 34 95 0c 06 91 00 	push   0x91060c(,%edx,4)
+  80446e:	ff 14 95 08 06 91 00 	call   *0x910608(,%edx,4)
+  804475:	89 04 24             	mov    %eax,(%esp)
+  804478:	e8 25 ff ff ff       	call   8043a2 <pthread_exit>
+
+0080447d <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80447d:	55                   	push   %ebp
+  80447e:	89 e5                	mov    %esp,%ebp
+  804480:	57                   	push   %edi
+  804481:	56                   	push   %esi
+  804482:	53                   	push   %ebx
+  804483:	83 ec 1c             	sub    $0x1c,%esp
+  804486:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804488:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80448e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804495:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80449a:	77 0d                	ja     8044a9 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80449c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044a1:	29 d0                	sub    %edx,%eax
+  8044a3:	c1 e8 10             	shr    $0x10,%eax
+  8044a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8044a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044ae:	eb 2f                	jmp    8044df <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8044b0:	8b 0d 80 08 91 00    	mov    0x910880,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8044b6:	8b 01                	mov    (%ecx),%eax
+  8044b8:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8044bb:	39 c2                	cmp    %eax,%edx
+  8044bd:	75 14                	jne    8044d3 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8044bf:	83 ec 0c             	sub    $0xc,%esp
+  8044c2:	57                   	push   %edi
+  8044c3:	e8 2d ce ff ff       	call   8012f5 <sys_env_destroy>
+  8044c8:	83 c4 10             	add    $0x10,%esp
+  8044cb:	85 c0                	test   %eax,%eax
+  8044cd:	0f 88 97 00 00 00    	js     80456a <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8044d3:	83 c3 01             	add    $0x1,%ebx
+  8044d6:	83 fb 20             	cmp    $0x20,%ebx
+  8044d9:	0f 84 d2 00 00 00    	je     8045b1 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8044df:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8044e2:	74 ef                	je     8044d3 <pthread_kill_others+0x56>
+  8044e4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8044e7:	8d 04 85 00 06 91 00 	lea    0x910600(,%eax,4),%eax
+  8044ee:	8b 40 04             	mov    0x4(%eax),%eax
+  8044f1:	83 f8 01             	cmp    $0x1,%eax
+  8044f4:	75 dd                	jne    8044d3 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8044f6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8044f9:	8b 3c 85 00 06 91 00 	mov    0x910600(,%eax,4),%edi
+  804500:	89 fe                	mov    %edi,%esi
+  804502:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804508:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80450b:	c1 e0 04             	shl    $0x4,%eax
+  80450e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804513:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804516:	39 c7                	cmp    %eax,%edi
+  804518:	75 b9                	jne    8044d3 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80451a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80451d:	c1 e0 04             	shl    $0x4,%eax
+  804520:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804525:	8b 40 54             	mov    0x54(%eax),%eax
+  804528:	85 c0                	test   %eax,%eax
+  80452a:	74 a7                	je     8044d3 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80452c:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80452f:	c1 e0 04             	shl    $0x4,%eax
+  804532:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804538:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80453a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804540:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804545:	0f 87 65 ff ff ff    	ja     8044b0 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80454b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804550:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804552:	c1 e8 10             	shr    $0x10,%eax
+  804555:	0f 84 55 ff ff ff    	je     8044b0 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80455b:	c1 e0 10             	shl    $0x10,%eax
+  80455e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804563:	29 c1                	sub    %eax,%ecx
+  804565:	e9 4c ff ff ff       	jmp    8044b6 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80456a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80456d:	c1 e2 04             	shl    $0x4,%edx
+  804570:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804576:	8b 52 48             	mov    0x48(%edx),%edx
+  804579:	39 fa                	cmp    %edi,%edx
+  80457b:	0f 85 52 ff ff ff    	jne    8044d3 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804581:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804584:	c1 e2 04             	shl    $0x4,%edx
+  804587:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80458d:	8b 52 54             	mov    0x54(%edx),%edx
+  804590:	85 d2                	test   %edx,%edx
+  804592:	0f 84 3b ff ff ff    	je     8044d3 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804598:	83 ec 0c             	sub    $0xc,%esp
+  80459b:	50                   	push   %eax
+  80459c:	57                   	push   %edi
+  80459d:	68 90 5a 80 00       	push   $0x805a90
+  8045a2:	68 bb 00 00 00       	push   $0xbb
+  8045a7:	68 80 5a 80 00       	push   $0x805a80
+  8045ac:	e8 ea c2 ff ff       	call   80089b <_panic>
+	}
+}
+  8045b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b4:	5b                   	pop    %ebx
+  8045b5:	5e                   	pop    %esi
+  8045b6:	5f                   	pop    %edi
+  8045b7:	5d                   	pop    %ebp
+  8045b8:	c3                   	ret
+
+008045b9 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8045b9:	55                   	push   %ebp
+  8045ba:	89 e5                	mov    %esp,%ebp
+  8045bc:	53                   	push   %ebx
+  8045bd:	83 ec 04             	sub    $0x4,%esp
+  8045c0:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045c2:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8045c8:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8045ce:	0f 87 85 00 00 00    	ja     804659 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045d4:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8045d9:	29 c3                	sub    %eax,%ebx
+  8045db:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8045de:	83 ec 04             	sub    $0x4,%esp
+  8045e1:	68 80 02 00 00       	push   $0x280
+  8045e6:	6a 00                	push   $0x0
+  8045e8:	68 00 06 91 00       	push   $0x910600
+  8045ed:	e8 b9 ca ff ff       	call   8010ab <memset>
+	threads_mu.m_state = 0;
+  8045f2:	c7 05 e0 05 91 00 00 	movl   $0x0,0x9105e0
+  8045f9:	00 00 00 
+	if (self != 0) {
+  8045fc:	83 c4 10             	add    $0x10,%esp
+  8045ff:	85 db                	test   %ebx,%ebx
+  804601:	74 51                	je     804654 <pthread_fork_child+0x9b>
+  804603:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804605:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80460b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804610:	77 18                	ja     80462a <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804612:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804617:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804619:	c1 e8 10             	shr    $0x10,%eax
+  80461c:	74 0c                	je     80462a <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80461e:	c1 e0 10             	shl    $0x10,%eax
+  804621:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804626:	29 c2                	sub    %eax,%edx
+  804628:	eb 06                	jmp    804630 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80462a:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		threads[self].th_env = thisenv->env_id;
+  804630:	8b 02                	mov    (%edx),%eax
+  804632:	8b 48 48             	mov    0x48(%eax),%ecx
+  804635:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80463c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80463f:	89 0c 95 00 06 91 00 	mov    %ecx,0x910600(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804646:	8d 04 95 00 06 91 00 	lea    0x910600(,%edx,4),%eax
+  80464d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804654:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804657:	c9                   	leave
+  804658:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804659:	83 ec 04             	sub    $0x4,%esp
+  80465c:	68 80 02 00 00       	push   $0x280
+  804661:	6a 00                	push   $0x0
+  804663:	68 00 06 91 00       	push   $0x910600
+  804668:	e8 3e ca ff ff       	call   8010ab <memset>
+	threads_mu.m_state = 0;
+  80466d:	c7 05 e0 05 91 00 00 	movl   $0x0,0x9105e0
+  804674:	00 00 00 
+  804677:	83 c4 10             	add    $0x10,%esp
+  80467a:	eb d8                	jmp    804654 <pthread_fork_child+0x9b>
+
+0080467c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80467c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804681:	c3                   	ret
+
+00804682 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804682:	55                   	push   %ebp
+  804683:	89 e5                	mov    %esp,%ebp
+  804685:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804688:	68 b5 5a 80 00       	push   $0x805ab5
+  80468d:	ff 75 0c             	push   0xc(%ebp)
+  804690:	e8 c5 c8 ff ff       	call   800f5a <strcpy>
+	return 0;
+}
+  804695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80469a:	c9                   	leave
+  80469b:	c3                   	ret
+
+0080469c <devcons_write>:
+{
+  80469c:	55                   	push   %ebp
+  80469d:	89 e5                	mov    %esp,%ebp
+  80469f:	57                   	push   %edi
+  8046a0:	56                   	push   %esi
+  8046a1:	53                   	push   %ebx
+  8046a2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046a8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046ad:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046b3:	eb 2e                	jmp    8046e3 <devcons_write+0x47>
+		m = n - tot;
+  8046b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046b8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046ba:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046bf:	39 c3                	cmp    %eax,%ebx
+  8046c1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046c4:	83 ec 04             	sub    $0x4,%esp
+  8046c7:	53                   	push   %ebx
+  8046c8:	89 f0                	mov    %esi,%eax
+  8046ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8046cd:	50                   	push   %eax
+  8046ce:	57                   	push   %edi
+  8046cf:	e8 0c ca ff ff       	call   8010e0 <memmove>
+		sys_cputs(buf, m);
+  8046d4:	83 c4 08             	add    $0x8,%esp
+  8046d7:	53                   	push   %ebx
+  8046d8:	57                   	push   %edi
+  8046d9:	e8 c0 cb ff ff       	call   80129e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8046de:	01 de                	add    %ebx,%esi
+  8046e0:	83 c4 10             	add    $0x10,%esp
+  8046e3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8046e6:	72 cd                	jb     8046b5 <devcons_write+0x19>
+}
+  8046e8:	89 f0                	mov    %esi,%eax
+  8046ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046ed:	5b                   	pop    %ebx
+  8046ee:	5e                   	pop    %esi
+  8046ef:	5f                   	pop    %edi
+  8046f0:	5d                   	pop    %ebp
+  8046f1:	c3                   	ret
+
+008046f2 <devcons_read>:
+{
+  8046f2:	55                   	push   %ebp
+  8046f3:	89 e5                	mov    %esp,%ebp
+  8046f5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8046f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804701:	75 07                	jne    80470a <devcons_read+0x18>
+  804703:	eb 1f                	jmp    804724 <devcons_read+0x32>
+		sys_yield();
+  804705:	e8 62 cc ff ff       	call   80136c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80470a:	e8 ba cb ff ff       	call   8012c9 <sys_cgetc>
+  80470f:	85 c0                	test   %eax,%eax
+  804711:	74 f2                	je     804705 <devcons_read+0x13>
+	if (c < 0)
+  804713:	78 0f                	js     804724 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804715:	83 f8 04             	cmp    $0x4,%eax
+  804718:	74 0c                	je     804726 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80471a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80471d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80471f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804724:	c9                   	leave
+  804725:	c3                   	ret
+		return 0;
+  804726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80472b:	eb f7                	jmp    804724 <devcons_read+0x32>
+
+0080472d <cputchar>:
+{
+  80472d:	55                   	push   %ebp
+  80472e:	89 e5                	mov    %esp,%ebp
+  804730:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804733:	8b 45 08             	mov    0x8(%ebp),%eax
+  804736:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804739:	6a 01                	push   $0x1
+  80473b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80473e:	50                   	push   %eax
+  80473f:	e8 5a cb ff ff       	call   80129e <sys_cputs>
+}
+  804744:	83 c4 10             	add    $0x10,%esp
+  804747:	c9                   	leave
+  804748:	c3                   	ret
+
+00804749 <getchar>:
+{
+  804749:	55                   	push   %ebp
+  80474a:	89 e5                	mov    %esp,%ebp
+  80474c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80474f:	6a 01                	push   $0x1
+  804751:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804754:	50                   	push   %eax
+  804755:	6a 00                	push   $0x0
+  804757:	e8 eb d3 ff ff       	call   801b47 <read>
+	if (r < 0)
+  80475c:	83 c4 10             	add    $0x10,%esp
+  80475f:	85 c0                	test   %eax,%eax
+  804761:	78 06                	js     804769 <getchar+0x20>
+	if (r < 1)
+  804763:	74 06                	je     80476b <getchar+0x22>
+	return c;
+  804765:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804769:	c9                   	leave
+  80476a:	c3                   	ret
+		return -E_EOF;
+  80476b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804770:	eb f7                	jmp    804769 <getchar+0x20>
+
+00804772 <iscons>:
+{
+  804772:	55                   	push   %ebp
+  804773:	89 e5                	mov    %esp,%ebp
+  804775:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804778:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80477b:	50                   	push   %eax
+  80477c:	ff 75 08             	push   0x8(%ebp)
+  80477f:	e8 33 d1 ff ff       	call   8018b7 <fd_lookup>
+  804784:	83 c4 10             	add    $0x10,%esp
+  804787:	85 c0                	test   %eax,%eax
+  804789:	78 11                	js     80479c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80478b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80478e:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804794:	39 10                	cmp    %edx,(%eax)
+  804796:	0f 94 c0             	sete   %al
+  804799:	0f b6 c0             	movzbl %al,%eax
+}
+  80479c:	c9                   	leave
+  80479d:	c3                   	ret
+
+0080479e <opencons>:
+{
+  80479e:	55                   	push   %ebp
+  80479f:	89 e5                	mov    %esp,%ebp
+  8047a1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047a7:	50                   	push   %eax
+  8047a8:	e8 b4 d0 ff ff       	call   801861 <fd_alloc>
+  8047ad:	83 c4 10             	add    $0x10,%esp
+  8047b0:	85 c0                	test   %eax,%eax
+  8047b2:	78 3a                	js     8047ee <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047b4:	83 ec 04             	sub    $0x4,%esp
+  8047b7:	68 07 04 00 00       	push   $0x407
+  8047bc:	ff 75 f4             	push   -0xc(%ebp)
+  8047bf:	6a 00                	push   $0x0
+  8047c1:	e8 d2 cb ff ff       	call   801398 <sys_page_alloc>
+  8047c6:	83 c4 10             	add    $0x10,%esp
+  8047c9:	85 c0                	test   %eax,%eax
+  8047cb:	78 21                	js     8047ee <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047d0:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8047d6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047e2:	83 ec 0c             	sub    $0xc,%esp
+  8047e5:	50                   	push   %eax
+  8047e6:	e8 4f d0 ff ff       	call   80183a <fd2num>
+  8047eb:	83 c4 10             	add    $0x10,%esp
+}
+  8047ee:	c9                   	leave
+  8047ef:	c3                   	ret
+
+008047f0 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8047f0:	55                   	push   %ebp
+  8047f1:	89 e5                	mov    %esp,%ebp
+  8047f3:	57                   	push   %edi
+  8047f4:	56                   	push   %esi
+  8047f5:	53                   	push   %ebx
+  8047f6:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8047f9:	89 d6                	mov    %edx,%esi
+  8047fb:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8047fe:	89 cf                	mov    %ecx,%edi
+  804800:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  804803:	89 fa                	mov    %edi,%edx
+  804805:	80 ce 08             	or     $0x8,%dh
+  804808:	f6 c5 08             	test   $0x8,%ch
+  80480b:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80480e:	57                   	push   %edi
+  80480f:	56                   	push   %esi
+  804810:	50                   	push   %eax
+  804811:	56                   	push   %esi
+  804812:	6a 00                	push   $0x0
+  804814:	e8 cc cb ff ff       	call   8013e5 <sys_page_map>
+	if (r < 0) {
+  804819:	83 c4 20             	add    $0x20,%esp
+  80481c:	85 c0                	test   %eax,%eax
+  80481e:	78 27                	js     804847 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  804820:	83 ec 0c             	sub    $0xc,%esp
+  804823:	57                   	push   %edi
+  804824:	56                   	push   %esi
+  804825:	6a 00                	push   $0x0
+  804827:	56                   	push   %esi
+  804828:	6a 00                	push   $0x0
+  80482a:	e8 b6 cb ff ff       	call   8013e5 <sys_page_map>
+  80482f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804831:	83 c4 20             	add    $0x20,%esp
+  804834:	85 c0                	test   %eax,%eax
+  804836:	78 24                	js     80485c <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  804838:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80483d:	89 d8                	mov    %ebx,%eax
+  80483f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804842:	5b                   	pop    %ebx
+  804843:	5e                   	pop    %esi
+  804844:	5f                   	pop    %edi
+  804845:	5d                   	pop    %ebp
+  804846:	c3                   	ret
+  804847:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804849:	83 ec 08             	sub    $0x8,%esp
+  80484c:	50                   	push   %eax
+  80484d:	68 c4 5a 80 00       	push   $0x805ac4
+  804852:	e8 1f c1 ff ff       	call   800976 <cprintf>
+		return r;
+  804857:	83 c4 10             	add    $0x10,%esp
+  80485a:	eb e1                	jmp    80483d <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80485c:	83 ec 08             	sub    $0x8,%esp
+  80485f:	50                   	push   %eax
+  804860:	68 f4 5a 80 00       	push   $0x805af4
+  804865:	e8 0c c1 ff ff       	call   800976 <cprintf>
+		return r;
+  80486a:	83 c4 10             	add    $0x10,%esp
+  80486d:	eb ce                	jmp    80483d <duppage_cow+0x4d>
+
+0080486f <duppage>:
+{
+  80486f:	55                   	push   %ebp
+  804870:	89 e5                	mov    %esp,%ebp
+  804872:	53                   	push   %ebx
+  804873:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  804876:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  804879:	51                   	push   %ecx
+  80487a:	52                   	push   %edx
+  80487b:	50                   	push   %eax
+  80487c:	52                   	push   %edx
+  80487d:	6a 00                	push   $0x0
+  80487f:	e8 61 cb ff ff       	call   8013e5 <sys_page_map>
+	if (r < 0) {
+  804884:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  804887:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80488c:	85 c0                	test   %eax,%eax
+  80488e:	78 07                	js     804897 <duppage+0x28>
+}
+  804890:	89 d8                	mov    %ebx,%eax
+  804892:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804895:	c9                   	leave
+  804896:	c3                   	ret
+  804897:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804899:	83 ec 08             	sub    $0x8,%esp
+  80489c:	50                   	push   %eax
+  80489d:	68 c4 5a 80 00       	push   $0x805ac4
+  8048a2:	e8 cf c0 ff ff       	call   800976 <cprintf>
+		return r;
+  8048a7:	83 c4 10             	add    $0x10,%esp
+  8048aa:	eb e4                	jmp    804890 <duppage+0x21>
+
+008048ac <cow_copy>:
+{
+  8048ac:	55                   	push   %ebp
+  8048ad:	89 e5                	mov    %esp,%ebp
+  8048af:	56                   	push   %esi
+  8048b0:	53                   	push   %ebx
+  8048b1:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8048b3:	83 ec 04             	sub    $0x4,%esp
+  8048b6:	6a 07                	push   $0x7
+  8048b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8048bd:	6a 00                	push   $0x0
+  8048bf:	e8 d4 ca ff ff       	call   801398 <sys_page_alloc>
+	if (r < 0) {
+  8048c4:	83 c4 10             	add    $0x10,%esp
+  8048c7:	85 c0                	test   %eax,%eax
+  8048c9:	78 58                	js     804923 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8048cb:	83 ec 04             	sub    $0x4,%esp
+  8048ce:	68 00 10 00 00       	push   $0x1000
+  8048d3:	56                   	push   %esi
+  8048d4:	68 00 f0 7f 00       	push   $0x7ff000
+  8048d9:	e8 02 c8 ff ff       	call   8010e0 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8048de:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8048e5:	56                   	push   %esi
+  8048e6:	6a 00                	push   $0x0
+  8048e8:	68 00 f0 7f 00       	push   $0x7ff000
+  8048ed:	6a 00                	push   $0x0
+  8048ef:	e8 f1 ca ff ff       	call   8013e5 <sys_page_map>
+  8048f4:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8048f6:	83 c4 20             	add    $0x20,%esp
+  8048f9:	85 c0                	test   %eax,%eax
+  8048fb:	78 3b                	js     804938 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8048fd:	83 ec 08             	sub    $0x8,%esp
+  804900:	68 00 f0 7f 00       	push   $0x7ff000
+  804905:	6a 00                	push   $0x0
+  804907:	e8 25 cb ff ff       	call   801431 <sys_page_unmap>
+  80490c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80490e:	83 c4 10             	add    $0x10,%esp
+  804911:	85 c0                	test   %eax,%eax
+  804913:	78 45                	js     80495a <cow_copy+0xae>
+	return 0;
+  804915:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80491a:	89 d8                	mov    %ebx,%eax
+  80491c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80491f:	5b                   	pop    %ebx
+  804920:	5e                   	pop    %esi
+  804921:	5d                   	pop    %ebp
+  804922:	c3                   	ret
+  804923:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  804925:	83 ec 08             	sub    $0x8,%esp
+  804928:	50                   	push   %eax
+  804929:	68 e4 5b 80 00       	push   $0x805be4
+  80492e:	e8 43 c0 ff ff       	call   800976 <cprintf>
+		return r;
+  804933:	83 c4 10             	add    $0x10,%esp
+  804936:	eb e2                	jmp    80491a <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  804938:	83 ec 08             	sub    $0x8,%esp
+  80493b:	50                   	push   %eax
+  80493c:	68 00 5c 80 00       	push   $0x805c00
+  804941:	e8 30 c0 ff ff       	call   800976 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  804946:	83 c4 08             	add    $0x8,%esp
+  804949:	68 00 f0 7f 00       	push   $0x7ff000
+  80494e:	6a 00                	push   $0x0
+  804950:	e8 dc ca ff ff       	call   801431 <sys_page_unmap>
+		return r;
+  804955:	83 c4 10             	add    $0x10,%esp
+  804958:	eb c0                	jmp    80491a <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80495a:	83 ec 08             	sub    $0x8,%esp
+  80495d:	50                   	push   %eax
+  80495e:	68 1c 5b 80 00       	push   $0x805b1c
+  804963:	e8 0e c0 ff ff       	call   800976 <cprintf>
+		return r;
+  804968:	83 c4 10             	add    $0x10,%esp
+  80496b:	eb ad                	jmp    80491a <cow_copy+0x6e>
+
+0080496d <pgfault>:
+{
+  80496d:	55                   	push   %ebp
+  80496e:	89 e5                	mov    %esp,%ebp
+  804970:	56                   	push   %esi
+  804971:	53                   	push   %ebx
+  804972:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  804975:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  804977:	89 d8                	mov    %ebx,%eax
+  804979:	c1 e8 16             	shr    $0x16,%eax
+  80497c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804983:	89 de                	mov    %ebx,%esi
+  804985:	c1 ee 0c             	shr    $0xc,%esi
+  804988:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80498f:	a8 07                	test   $0x7,%al
+  804991:	74 3b                	je     8049ce <pgfault+0x61>
+  804993:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804999:	74 33                	je     8049ce <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80499b:	83 ec 0c             	sub    $0xc,%esp
+  80499e:	68 00 f0 bf ee       	push   $0xeebff000
+  8049a3:	e8 c8 f4 ff ff       	call   803e70 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8049a8:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8049af:	83 c4 10             	add    $0x10,%esp
+  8049b2:	f6 c4 08             	test   $0x8,%ah
+  8049b5:	75 30                	jne    8049e7 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8049b7:	83 ec 0c             	sub    $0xc,%esp
+  8049ba:	68 00 f0 bf ee       	push   $0xeebff000
+  8049bf:	e8 19 f5 ff ff       	call   803edd <mutex_unlock>
+}
+  8049c4:	83 c4 10             	add    $0x10,%esp
+  8049c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049ca:	5b                   	pop    %ebx
+  8049cb:	5e                   	pop    %esi
+  8049cc:	5d                   	pop    %ebp
+  8049cd:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8049ce:	83 ec 08             	sub    $0x8,%esp
+  8049d1:	ff 72 28             	push   0x28(%edx)
+  8049d4:	51                   	push   %ecx
+  8049d5:	50                   	push   %eax
+  8049d6:	68 40 5b 80 00       	push   $0x805b40
+  8049db:	6a 3f                	push   $0x3f
+  8049dd:	68 1a 5c 80 00       	push   $0x805c1a
+  8049e2:	e8 b4 be ff ff       	call   80089b <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8049e7:	89 d8                	mov    %ebx,%eax
+  8049e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8049ee:	e8 b9 fe ff ff       	call   8048ac <cow_copy>
+  8049f3:	eb c2                	jmp    8049b7 <pgfault+0x4a>
+
+008049f5 <cow_enable>:
+{
+  8049f5:	55                   	push   %ebp
+  8049f6:	89 e5                	mov    %esp,%ebp
+  8049f8:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8049fb:	68 6d 49 80 00       	push   $0x80496d
+  804a00:	e8 28 06 00 00       	call   80502d <set_pgfault_handler>
+}
+  804a05:	83 c4 10             	add    $0x10,%esp
+  804a08:	c9                   	leave
+  804a09:	c3                   	ret
+
+00804a0a <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804a0a:	55                   	push   %ebp
+  804a0b:	89 e5                	mov    %esp,%ebp
+  804a0d:	57                   	push   %edi
+  804a0e:	56                   	push   %esi
+  804a0f:	53                   	push   %ebx
+  804a10:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804a13:	68 6d 49 80 00       	push   $0x80496d
+  804a18:	e8 10 06 00 00       	call   80502d <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804a1d:	b8 07 00 00 00       	mov    $0x7,%eax
+  804a22:	cd 30                	int    $0x30
+  804a24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804a27:	83 c4 10             	add    $0x10,%esp
+  804a2a:	85 c0                	test   %eax,%eax
+  804a2c:	78 4b                	js     804a79 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804a2e:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804a33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a38:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804a3b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804a3f:	0f 85 16 01 00 00    	jne    804b5b <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804a45:	e8 f6 c8 ff ff       	call   801340 <sys_getenvid>
+  804a4a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a4f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a51:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  804a57:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804a5d:	77 32                	ja     804a91 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a5f:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804a64:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  804a66:	c1 ea 10             	shr    $0x10,%edx
+  804a69:	74 26                	je     804a91 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a6b:	c1 e2 10             	shl    $0x10,%edx
+  804a6e:	89 d1                	mov    %edx,%ecx
+  804a70:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a75:	29 ca                	sub    %ecx,%edx
+  804a77:	eb 1e                	jmp    804a97 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  804a79:	83 ec 08             	sub    $0x8,%esp
+  804a7c:	89 c7                	mov    %eax,%edi
+  804a7e:	50                   	push   %eax
+  804a7f:	68 25 5c 80 00       	push   $0x805c25
+  804a84:	e8 ed be ff ff       	call   800976 <cprintf>
+		return eid;
+  804a89:	83 c4 10             	add    $0x10,%esp
+  804a8c:	e9 6c 01 00 00       	jmp    804bfd <fork+0x1f3>
+		return pthread_main_tls;
+  804a91:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804a97:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804a9a:	c1 e0 04             	shl    $0x4,%eax
+  804a9d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804aa2:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804aa4:	e8 10 fb ff ff       	call   8045b9 <pthread_fork_child>
+		return eid;
+  804aa9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804aac:	e9 4c 01 00 00       	jmp    804bfd <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804ab1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804ab7:	89 da                	mov    %ebx,%edx
+  804ab9:	89 f8                	mov    %edi,%eax
+  804abb:	e8 af fd ff ff       	call   80486f <duppage>
+  804ac0:	85 c0                	test   %eax,%eax
+  804ac2:	79 28                	jns    804aec <fork+0xe2>
+  804ac4:	89 c7                	mov    %eax,%edi
+  804ac6:	e9 32 01 00 00       	jmp    804bfd <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804acb:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804ad1:	83 f9 05             	cmp    $0x5,%ecx
+  804ad4:	75 58                	jne    804b2e <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804ad6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804adb:	89 da                	mov    %ebx,%edx
+  804add:	89 f8                	mov    %edi,%eax
+  804adf:	e8 8b fd ff ff       	call   80486f <duppage>
+  804ae4:	85 c0                	test   %eax,%eax
+  804ae6:	0f 88 0f 01 00 00    	js     804bfb <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804aec:	83 c3 01             	add    $0x1,%ebx
+  804aef:	39 de                	cmp    %ebx,%esi
+  804af1:	74 54                	je     804b47 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804af3:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804afa:	f6 c1 05             	test   $0x5,%cl
+  804afd:	74 ed                	je     804aec <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804aff:	f6 c5 04             	test   $0x4,%ch
+  804b02:	75 ad                	jne    804ab1 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804b04:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804b0a:	74 bf                	je     804acb <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804b0c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804b12:	74 d8                	je     804aec <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804b14:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804b1a:	89 da                	mov    %ebx,%edx
+  804b1c:	89 f8                	mov    %edi,%eax
+  804b1e:	e8 cd fc ff ff       	call   8047f0 <duppage_cow>
+  804b23:	85 c0                	test   %eax,%eax
+  804b25:	79 c5                	jns    804aec <fork+0xe2>
+  804b27:	89 c7                	mov    %eax,%edi
+  804b29:	e9 cf 00 00 00       	jmp    804bfd <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804b2e:	68 70 5b 80 00       	push   $0x805b70
+  804b33:	68 7d 59 80 00       	push   $0x80597d
+  804b38:	68 c6 00 00 00       	push   $0xc6
+  804b3d:	68 1a 5c 80 00       	push   $0x805c1a
+  804b42:	e8 54 bd ff ff       	call   80089b <_panic>
+  804b47:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804b4a:	83 c1 01             	add    $0x1,%ecx
+  804b4d:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804b53:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804b59:	74 18                	je     804b73 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804b5b:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804b62:	a8 07                	test   $0x7,%al
+  804b64:	74 e4                	je     804b4a <fork+0x140>
+  804b66:	89 cb                	mov    %ecx,%ebx
+  804b68:	c1 e3 0a             	shl    $0xa,%ebx
+  804b6b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804b6e:	e9 7c ff ff ff       	jmp    804aef <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804b73:	83 ec 04             	sub    $0x4,%esp
+  804b76:	6a 07                	push   $0x7
+  804b78:	68 00 f0 bf ee       	push   $0xeebff000
+  804b7d:	ff 75 e4             	push   -0x1c(%ebp)
+  804b80:	e8 13 c8 ff ff       	call   801398 <sys_page_alloc>
+  804b85:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804b87:	83 c4 10             	add    $0x10,%esp
+  804b8a:	85 c0                	test   %eax,%eax
+  804b8c:	78 34                	js     804bc2 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804b8e:	83 ec 08             	sub    $0x8,%esp
+  804b91:	68 6b 50 80 00       	push   $0x80506b
+  804b96:	ff 75 e4             	push   -0x1c(%ebp)
+  804b99:	e8 77 c9 ff ff       	call   801515 <sys_env_set_pgfault_upcall>
+  804b9e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804ba0:	83 c4 10             	add    $0x10,%esp
+  804ba3:	85 c0                	test   %eax,%eax
+  804ba5:	78 2e                	js     804bd5 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804ba7:	83 ec 08             	sub    $0x8,%esp
+  804baa:	6a 02                	push   $0x2
+  804bac:	ff 75 e4             	push   -0x1c(%ebp)
+  804baf:	e8 c9 c8 ff ff       	call   80147d <sys_env_set_status>
+  804bb4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804bb6:	83 c4 10             	add    $0x10,%esp
+  804bb9:	85 c0                	test   %eax,%eax
+  804bbb:	78 2b                	js     804be8 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804bbd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804bc0:	eb 3b                	jmp    804bfd <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804bc2:	83 ec 08             	sub    $0x8,%esp
+  804bc5:	50                   	push   %eax
+  804bc6:	68 98 5b 80 00       	push   $0x805b98
+  804bcb:	e8 a6 bd ff ff       	call   800976 <cprintf>
+		return r;
+  804bd0:	83 c4 10             	add    $0x10,%esp
+  804bd3:	eb 28                	jmp    804bfd <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804bd5:	83 ec 08             	sub    $0x8,%esp
+  804bd8:	50                   	push   %eax
+  804bd9:	68 c0 5b 80 00       	push   $0x805bc0
+  804bde:	e8 93 bd ff ff       	call   800976 <cprintf>
+		return r;
+  804be3:	83 c4 10             	add    $0x10,%esp
+  804be6:	eb 15                	jmp    804bfd <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804be8:	83 ec 08             	sub    $0x8,%esp
+  804beb:	50                   	push   %eax
+  804bec:	68 35 5c 80 00       	push   $0x805c35
+  804bf1:	e8 80 bd ff ff       	call   800976 <cprintf>
+		return r;
+  804bf6:	83 c4 10             	add    $0x10,%esp
+  804bf9:	eb 02                	jmp    804bfd <fork+0x1f3>
+  804bfb:	89 c7                	mov    %eax,%edi
+}
+  804bfd:	89 f8                	mov    %edi,%eax
+  804bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c02:	5b                   	pop    %ebx
+  804c03:	5e                   	pop    %esi
+  804c04:	5f                   	pop    %edi
+  804c05:	5d                   	pop    %ebp
+  804c06:	c3                   	ret
+
+00804c07 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804c07:	55                   	push   %ebp
+  804c08:	89 e5                	mov    %esp,%ebp
+  804c0a:	57                   	push   %edi
+  804c0b:	56                   	push   %esi
+  804c0c:	53                   	push   %ebx
+  804c0d:	83 ec 2c             	sub    $0x2c,%esp
+  804c10:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804c12:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804c18:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804c1d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804c23:	77 0a                	ja     804c2f <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804c25:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804c2a:	29 c3                	sub    %eax,%ebx
+  804c2c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804c2f:	83 ec 0c             	sub    $0xc,%esp
+  804c32:	68 6d 49 80 00       	push   $0x80496d
+  804c37:	e8 f1 03 00 00       	call   80502d <set_pgfault_handler>
+  804c3c:	b8 07 00 00 00       	mov    $0x7,%eax
+  804c41:	cd 30                	int    $0x30
+  804c43:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804c46:	83 c4 10             	add    $0x10,%esp
+  804c49:	85 c0                	test   %eax,%eax
+  804c4b:	78 30                	js     804c7d <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804c4d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804c51:	74 42                	je     804c95 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804c53:	c1 e3 10             	shl    $0x10,%ebx
+  804c56:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804c5b:	29 d8                	sub    %ebx,%eax
+  804c5d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804c60:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804c65:	29 d8                	sub    %ebx,%eax
+  804c67:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804c6a:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c74:	89 f7                	mov    %esi,%edi
+  804c76:	89 d6                	mov    %edx,%esi
+  804c78:	e9 2c 01 00 00       	jmp    804da9 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804c7d:	83 ec 08             	sub    $0x8,%esp
+  804c80:	89 c7                	mov    %eax,%edi
+  804c82:	50                   	push   %eax
+  804c83:	68 25 5c 80 00       	push   $0x805c25
+  804c88:	e8 e9 bc ff ff       	call   800976 <cprintf>
+		return eid;
+  804c8d:	83 c4 10             	add    $0x10,%esp
+  804c90:	e9 d5 00 00 00       	jmp    804d6a <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804c95:	e8 a6 c6 ff ff       	call   801340 <sys_getenvid>
+  804c9a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c9f:	89 c2                	mov    %eax,%edx
+  804ca1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804ca3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804ca9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804cae:	77 18                	ja     804cc8 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804cb0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804cb5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804cb7:	c1 e8 10             	shr    $0x10,%eax
+  804cba:	74 0c                	je     804cc8 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804cbc:	c1 e0 10             	shl    $0x10,%eax
+  804cbf:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804cc4:	29 c1                	sub    %eax,%ecx
+  804cc6:	eb 06                	jmp    804cce <sfork+0xc7>
+		return pthread_main_tls;
+  804cc8:	8b 0d 80 08 91 00    	mov    0x910880,%ecx
+  804cce:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804cd1:	c1 e0 04             	shl    $0x4,%eax
+  804cd4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804cd9:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804cdb:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804cde:	e9 87 00 00 00       	jmp    804d6a <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804ce3:	f6 c5 04             	test   $0x4,%ch
+  804ce6:	74 6c                	je     804d54 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804ce8:	89 ca                	mov    %ecx,%edx
+  804cea:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804cf0:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804cf6:	74 7c                	je     804d74 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804cf8:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804cfe:	89 da                	mov    %ebx,%edx
+  804d00:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d03:	e8 67 fb ff ff       	call   80486f <duppage>
+  804d08:	85 c0                	test   %eax,%eax
+  804d0a:	0f 88 4f 01 00 00    	js     804e5f <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804d10:	83 c3 01             	add    $0x1,%ebx
+  804d13:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804d16:	74 7a                	je     804d92 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804d18:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804d1a:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804d21:	f6 c1 01             	test   $0x1,%cl
+  804d24:	74 ea                	je     804d10 <sfork+0x109>
+  804d26:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804d2c:	74 e2                	je     804d10 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804d2e:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804d34:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804d37:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804d3c:	76 a5                	jbe    804ce3 <sfork+0xdc>
+  804d3e:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804d44:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804d47:	39 fa                	cmp    %edi,%edx
+  804d49:	73 9d                	jae    804ce8 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804d4b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804d4e:	39 fa                	cmp    %edi,%edx
+  804d50:	72 96                	jb     804ce8 <sfork+0xe1>
+  804d52:	eb 8f                	jmp    804ce3 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804d54:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804d5a:	89 da                	mov    %ebx,%edx
+  804d5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d5f:	e8 8c fa ff ff       	call   8047f0 <duppage_cow>
+  804d64:	85 c0                	test   %eax,%eax
+  804d66:	79 a8                	jns    804d10 <sfork+0x109>
+  804d68:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804d6a:	89 f8                	mov    %edi,%eax
+  804d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d6f:	5b                   	pop    %ebx
+  804d70:	5e                   	pop    %esi
+  804d71:	5f                   	pop    %edi
+  804d72:	5d                   	pop    %ebp
+  804d73:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804d74:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804d79:	e8 2e fb ff ff       	call   8048ac <cow_copy>
+  804d7e:	85 c0                	test   %eax,%eax
+  804d80:	0f 88 d2 00 00 00    	js     804e58 <sfork+0x251>
+				pte = uvpt[pn];
+  804d86:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804d8d:	e9 66 ff ff ff       	jmp    804cf8 <sfork+0xf1>
+  804d92:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804d95:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804d98:	83 c6 01             	add    $0x1,%esi
+  804d9b:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804da1:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804da7:	74 1b                	je     804dc4 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804da9:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804db0:	a8 01                	test   $0x1,%al
+  804db2:	74 e4                	je     804d98 <sfork+0x191>
+  804db4:	89 f3                	mov    %esi,%ebx
+  804db6:	c1 e3 0a             	shl    $0xa,%ebx
+  804db9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804dbc:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804dbf:	e9 4f ff ff ff       	jmp    804d13 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804dc4:	83 ec 04             	sub    $0x4,%esp
+  804dc7:	6a 07                	push   $0x7
+  804dc9:	68 00 f0 bf ee       	push   $0xeebff000
+  804dce:	ff 75 e0             	push   -0x20(%ebp)
+  804dd1:	e8 c2 c5 ff ff       	call   801398 <sys_page_alloc>
+  804dd6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804dd8:	83 c4 10             	add    $0x10,%esp
+  804ddb:	85 c0                	test   %eax,%eax
+  804ddd:	78 37                	js     804e16 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804ddf:	83 ec 08             	sub    $0x8,%esp
+  804de2:	68 6b 50 80 00       	push   $0x80506b
+  804de7:	ff 75 e0             	push   -0x20(%ebp)
+  804dea:	e8 26 c7 ff ff       	call   801515 <sys_env_set_pgfault_upcall>
+  804def:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804df1:	83 c4 10             	add    $0x10,%esp
+  804df4:	85 c0                	test   %eax,%eax
+  804df6:	78 34                	js     804e2c <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804df8:	83 ec 08             	sub    $0x8,%esp
+  804dfb:	6a 02                	push   $0x2
+  804dfd:	ff 75 e0             	push   -0x20(%ebp)
+  804e00:	e8 78 c6 ff ff       	call   80147d <sys_env_set_status>
+  804e05:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804e07:	83 c4 10             	add    $0x10,%esp
+  804e0a:	85 c0                	test   %eax,%eax
+  804e0c:	78 34                	js     804e42 <sfork+0x23b>
+	return eid;
+  804e0e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804e11:	e9 54 ff ff ff       	jmp    804d6a <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804e16:	83 ec 08             	sub    $0x8,%esp
+  804e19:	50                   	push   %eax
+  804e1a:	68 98 5b 80 00       	push   $0x805b98
+  804e1f:	e8 52 bb ff ff       	call   800976 <cprintf>
+		return r;
+  804e24:	83 c4 10             	add    $0x10,%esp
+  804e27:	e9 3e ff ff ff       	jmp    804d6a <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804e2c:	83 ec 08             	sub    $0x8,%esp
+  804e2f:	50                   	push   %eax
+  804e30:	68 c0 5b 80 00       	push   $0x805bc0
+  804e35:	e8 3c bb ff ff       	call   800976 <cprintf>
+		return r;
+  804e3a:	83 c4 10             	add    $0x10,%esp
+  804e3d:	e9 28 ff ff ff       	jmp    804d6a <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804e42:	83 ec 08             	sub    $0x8,%esp
+  804e45:	50                   	push   %eax
+  804e46:	68 35 5c 80 00       	push   $0x805c35
+  804e4b:	e8 26 bb ff ff       	call   800976 <cprintf>
+		return r;
+  804e50:	83 c4 10             	add    $0x10,%esp
+  804e53:	e9 12 ff ff ff       	jmp    804d6a <sfork+0x163>
+  804e58:	89 c7                	mov    %eax,%edi
+  804e5a:	e9 0b ff ff ff       	jmp    804d6a <sfork+0x163>
+  804e5f:	89 c7                	mov    %eax,%edi
+  804e61:	e9 04 ff ff ff       	jmp    804d6a <sfork+0x163>
+
+00804e66 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804e66:	55                   	push   %ebp
+  804e67:	89 e5                	mov    %esp,%ebp
+  804e69:	57                   	push   %edi
+  804e6a:	56                   	push   %esi
+  804e6b:	53                   	push   %ebx
+  804e6c:	83 ec 18             	sub    $0x18,%esp
+  804e6f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804e75:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804e78:	85 c0                	test   %eax,%eax
+  804e7a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804e7f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804e82:	50                   	push   %eax
+  804e83:	e8 06 c7 ff ff       	call   80158e <sys_ipc_recv>
+	if (r < 0) {
+  804e88:	83 c4 10             	add    $0x10,%esp
+  804e8b:	85 c0                	test   %eax,%eax
+  804e8d:	78 2b                	js     804eba <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804e8f:	85 ff                	test   %edi,%edi
+  804e91:	74 55                	je     804ee8 <ipc_recv+0x82>
+  804e93:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804e95:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804e9b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804ea0:	77 39                	ja     804edb <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804ea2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804ea7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804ea9:	c1 e8 10             	shr    $0x10,%eax
+  804eac:	74 2d                	je     804edb <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804eae:	c1 e0 10             	shl    $0x10,%eax
+  804eb1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804eb6:	29 c2                	sub    %eax,%edx
+  804eb8:	eb 27                	jmp    804ee1 <ipc_recv+0x7b>
+  804eba:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804ebc:	83 ec 08             	sub    $0x8,%esp
+  804ebf:	50                   	push   %eax
+  804ec0:	68 53 5c 80 00       	push   $0x805c53
+  804ec5:	e8 ac ba ff ff       	call   800976 <cprintf>
+		*from_env_store = 0;
+  804eca:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804ed0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804ed6:	83 c4 10             	add    $0x10,%esp
+  804ed9:	eb 77                	jmp    804f52 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804edb:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804ee1:	8b 02                	mov    (%edx),%eax
+  804ee3:	8b 40 78             	mov    0x78(%eax),%eax
+  804ee6:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804ee8:	85 f6                	test   %esi,%esi
+  804eea:	74 34                	je     804f20 <ipc_recv+0xba>
+  804eec:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804eee:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804ef4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804ef9:	77 18                	ja     804f13 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804efb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804f00:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804f02:	c1 e8 10             	shr    $0x10,%eax
+  804f05:	74 0c                	je     804f13 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804f07:	c1 e0 10             	shl    $0x10,%eax
+  804f0a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804f0f:	29 c2                	sub    %eax,%edx
+  804f11:	eb 06                	jmp    804f19 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804f13:	8b 15 80 08 91 00    	mov    0x910880,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804f19:	8b 02                	mov    (%edx),%eax
+  804f1b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804f1e:	89 06                	mov    %eax,(%esi)
+  804f20:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804f22:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804f28:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804f2d:	77 18                	ja     804f47 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804f2f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804f34:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804f36:	c1 e8 10             	shr    $0x10,%eax
+  804f39:	74 0c                	je     804f47 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804f3b:	c1 e0 10             	shl    $0x10,%eax
+  804f3e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804f43:	29 c2                	sub    %eax,%edx
+  804f45:	eb 06                	jmp    804f4d <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804f47:	8b 15 80 08 91 00    	mov    0x910880,%edx
+	}
+	return thisenv->env_ipc_value;
+  804f4d:	8b 02                	mov    (%edx),%eax
+  804f4f:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804f52:	89 d8                	mov    %ebx,%eax
+  804f54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f57:	5b                   	pop    %ebx
+  804f58:	5e                   	pop    %esi
+  804f59:	5f                   	pop    %edi
+  804f5a:	5d                   	pop    %ebp
+  804f5b:	c3                   	ret
+
+00804f5c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804f5c:	55                   	push   %ebp
+  804f5d:	89 e5                	mov    %esp,%ebp
+  804f5f:	57                   	push   %edi
+  804f60:	56                   	push   %esi
+  804f61:	53                   	push   %ebx
+  804f62:	83 ec 0c             	sub    $0xc,%esp
+  804f65:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804f6b:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804f6e:	85 db                	test   %ebx,%ebx
+  804f70:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804f75:	0f 44 d8             	cmove  %eax,%ebx
+  804f78:	eb 05                	jmp    804f7f <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804f7a:	e8 ed c3 ff ff       	call   80136c <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804f7f:	57                   	push   %edi
+  804f80:	53                   	push   %ebx
+  804f81:	ff 75 0c             	push   0xc(%ebp)
+  804f84:	56                   	push   %esi
+  804f85:	e8 d7 c5 ff ff       	call   801561 <sys_ipc_try_send>
+		if (r == 0) {
+  804f8a:	83 c4 10             	add    $0x10,%esp
+  804f8d:	85 c0                	test   %eax,%eax
+  804f8f:	74 19                	je     804faa <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804f91:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804f94:	74 e4                	je     804f7a <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804f96:	83 ec 0c             	sub    $0xc,%esp
+  804f99:	50                   	push   %eax
+  804f9a:	57                   	push   %edi
+  804f9b:	53                   	push   %ebx
+  804f9c:	56                   	push   %esi
+  804f9d:	68 6c 5c 80 00       	push   $0x805c6c
+  804fa2:	e8 cf b9 ff ff       	call   800976 <cprintf>
+			return;
+  804fa7:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fad:	5b                   	pop    %ebx
+  804fae:	5e                   	pop    %esi
+  804faf:	5f                   	pop    %edi
+  804fb0:	5d                   	pop    %ebp
+  804fb1:	c3                   	ret
+
+00804fb2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804fb2:	55                   	push   %ebp
+  804fb3:	89 e5                	mov    %esp,%ebp
+  804fb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804fbd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804fc0:	c1 e0 04             	shl    $0x4,%eax
+  804fc3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804fc8:	8b 40 50             	mov    0x50(%eax),%eax
+  804fcb:	39 c8                	cmp    %ecx,%eax
+  804fcd:	74 12                	je     804fe1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804fcf:	83 c2 01             	add    $0x1,%edx
+  804fd2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804fd8:	75 e3                	jne    804fbd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fdf:	eb 0e                	jmp    804fef <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804fe1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804fe4:	c1 e0 04             	shl    $0x4,%eax
+  804fe7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804fec:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804fef:	5d                   	pop    %ebp
+  804ff0:	c3                   	ret
+
+00804ff1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804ff1:	55                   	push   %ebp
+  804ff2:	89 e5                	mov    %esp,%ebp
+  804ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ff7:	89 c2                	mov    %eax,%edx
+  804ff9:	c1 ea 16             	shr    $0x16,%edx
+  804ffc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805003:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805008:	f6 c1 01             	test   $0x1,%cl
+  80500b:	74 1c                	je     805029 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80500d:	c1 e8 0c             	shr    $0xc,%eax
+  805010:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805017:	a8 01                	test   $0x1,%al
+  805019:	74 0e                	je     805029 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80501b:	c1 e8 0c             	shr    $0xc,%eax
+  80501e:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  805025:	ef 
+  805026:	0f b7 d2             	movzwl %dx,%edx
+}
+  805029:	89 d0                	mov    %edx,%eax
+  80502b:	5d                   	pop    %ebp
+  80502c:	c3                   	ret
+
+0080502d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80502d:	55                   	push   %ebp
+  80502e:	89 e5                	mov    %esp,%ebp
+  805030:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  805033:	83 3d 00 30 91 00 00 	cmpl   $0x0,0x913000
+  80503a:	74 0a                	je     805046 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80503c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80503f:	a3 00 30 91 00       	mov    %eax,0x913000
+}
+  805044:	c9                   	leave
+  805045:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  805046:	83 ec 04             	sub    $0x4,%esp
+  805049:	6a 07                	push   $0x7
+  80504b:	68 00 f0 bf ee       	push   $0xeebff000
+  805050:	6a 00                	push   $0x0
+  805052:	e8 41 c3 ff ff       	call   801398 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805057:	83 c4 08             	add    $0x8,%esp
+  80505a:	68 6b 50 80 00       	push   $0x80506b
+  80505f:	6a 00                	push   $0x0
+  805061:	e8 af c4 ff ff       	call   801515 <sys_env_set_pgfault_upcall>
+  805066:	83 c4 10             	add    $0x10,%esp
+  805069:	eb d1                	jmp    80503c <set_pgfault_handler+0xf>
+
+0080506b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80506b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80506c:	a1 00 30 91 00       	mov    0x913000,%eax
+	call *%eax
+  805071:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805073:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  805076:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80507a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80507e:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  805081:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  805085:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  805087:	83 c4 08             	add    $0x8,%esp
+	popal
+  80508a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80508b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80508e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80508f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  805090:	c3                   	ret
+
+00805091 <udm>:
+  805091:	57                   	push   %edi
+  805092:	56                   	push   %esi
+  805093:	53                   	push   %ebx
+  805094:	83 ec 20             	sub    $0x20,%esp
+  805097:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80509b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80509f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8050a3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8050a7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050ab:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050af:	89 d1                	mov    %edx,%ecx
+  8050b1:	09 c1                	or     %eax,%ecx
+  8050b3:	0f 84 91 00 00 00    	je     80514a <udm+0xb9>
+  8050b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050c3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050c8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8050cf:	00 
+  8050d0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8050d7:	00 
+  8050d8:	eb 08                	jmp    8050e2 <udm+0x51>
+  8050da:	83 e9 01             	sub    $0x1,%ecx
+  8050dd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8050e0:	74 7c                	je     80515e <udm+0xcd>
+  8050e2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8050e6:	01 c0                	add    %eax,%eax
+  8050e8:	89 c6                	mov    %eax,%esi
+  8050ea:	89 d7                	mov    %edx,%edi
+  8050ec:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8050f0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8050f4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8050f7:	d3 ea                	shr    %cl,%edx
+  8050f9:	f6 c1 20             	test   $0x20,%cl
+  8050fc:	74 04                	je     805102 <udm+0x71>
+  8050fe:	89 d0                	mov    %edx,%eax
+  805100:	31 d2                	xor    %edx,%edx
+  805102:	83 e0 01             	and    $0x1,%eax
+  805105:	89 04 24             	mov    %eax,(%esp)
+  805108:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80510f:	00 
+  805110:	8b 04 24             	mov    (%esp),%eax
+  805113:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805117:	09 f0                	or     %esi,%eax
+  805119:	09 fa                	or     %edi,%edx
+  80511b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80511f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  805123:	39 f0                	cmp    %esi,%eax
+  805125:	89 d3                	mov    %edx,%ebx
+  805127:	19 fb                	sbb    %edi,%ebx
+  805129:	72 af                	jb     8050da <udm+0x49>
+  80512b:	29 f0                	sub    %esi,%eax
+  80512d:	19 fa                	sbb    %edi,%edx
+  80512f:	89 cf                	mov    %ecx,%edi
+  805131:	c1 ef 05             	shr    $0x5,%edi
+  805134:	83 e7 01             	and    $0x1,%edi
+  805137:	89 fe                	mov    %edi,%esi
+  805139:	83 f6 01             	xor    $0x1,%esi
+  80513c:	d3 e6                	shl    %cl,%esi
+  80513e:	d3 e7                	shl    %cl,%edi
+  805140:	09 74 24 18          	or     %esi,0x18(%esp)
+  805144:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805148:	eb 90                	jmp    8050da <udm+0x49>
+  80514a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80514e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  805152:	89 f0                	mov    %esi,%eax
+  805154:	89 fa                	mov    %edi,%edx
+  805156:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80515a:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80515e:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  805162:	89 01                	mov    %eax,(%ecx)
+  805164:	89 51 04             	mov    %edx,0x4(%ecx)
+  805167:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80516b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80516f:	83 c4 20             	add    $0x20,%esp
+  805172:	5b                   	pop    %ebx
+  805173:	5e                   	pop    %esi
+  805174:	5f                   	pop    %edi
+  805175:	c3                   	ret
+
+00805176 <__udivdi3>:
+  805176:	83 ec 18             	sub    $0x18,%esp
+  805179:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80517d:	50                   	push   %eax
+  80517e:	ff 74 24 2c          	push   0x2c(%esp)
+  805182:	ff 74 24 2c          	push   0x2c(%esp)
+  805186:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80518a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80518e:	e8 fe fe ff ff       	call   805091 <udm>
+  805193:	83 c4 24             	add    $0x24,%esp
+  805196:	c3                   	ret
+
+00805197 <__umoddi3>:
+  805197:	83 ec 18             	sub    $0x18,%esp
+  80519a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80519e:	50                   	push   %eax
+  80519f:	ff 74 24 2c          	push   0x2c(%esp)
+  8051a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8051a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8051ab:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8051af:	e8 dd fe ff ff       	call   805091 <udm>
+  8051b4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051b8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051bc:	83 c4 24             	add    $0x24,%esp
+  8051bf:	c3                   	ret
+
+008051c0 <__divdi3>:
+  8051c0:	56                   	push   %esi
+  8051c1:	53                   	push   %ebx
+  8051c2:	83 ec 14             	sub    $0x14,%esp
+  8051c5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8051c9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8051cd:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8051d1:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8051d5:	85 d2                	test   %edx,%edx
+  8051d7:	78 18                	js     8051f1 <__divdi3+0x31>
+  8051d9:	85 db                	test   %ebx,%ebx
+  8051db:	78 3e                	js     80521b <__divdi3+0x5b>
+  8051dd:	83 ec 04             	sub    $0x4,%esp
+  8051e0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8051e4:	56                   	push   %esi
+  8051e5:	53                   	push   %ebx
+  8051e6:	51                   	push   %ecx
+  8051e7:	e8 a5 fe ff ff       	call   805091 <udm>
+  8051ec:	83 c4 10             	add    $0x10,%esp
+  8051ef:	eb 24                	jmp    805215 <__divdi3+0x55>
+  8051f1:	f7 d8                	neg    %eax
+  8051f3:	83 d2 00             	adc    $0x0,%edx
+  8051f6:	f7 da                	neg    %edx
+  8051f8:	85 db                	test   %ebx,%ebx
+  8051fa:	78 3a                	js     805236 <__divdi3+0x76>
+  8051fc:	83 ec 04             	sub    $0x4,%esp
+  8051ff:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  805203:	56                   	push   %esi
+  805204:	53                   	push   %ebx
+  805205:	51                   	push   %ecx
+  805206:	e8 86 fe ff ff       	call   805091 <udm>
+  80520b:	83 c4 10             	add    $0x10,%esp
+  80520e:	f7 d8                	neg    %eax
+  805210:	83 d2 00             	adc    $0x0,%edx
+  805213:	f7 da                	neg    %edx
+  805215:	83 c4 14             	add    $0x14,%esp
+  805218:	5b                   	pop    %ebx
+  805219:	5e                   	pop    %esi
+  80521a:	c3                   	ret
+  80521b:	83 ec 04             	sub    $0x4,%esp
+  80521e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  805222:	56                   	push   %esi
+  805223:	f7 d9                	neg    %ecx
+  805225:	83 d3 00             	adc    $0x0,%ebx
+  805228:	f7 db                	neg    %ebx
+  80522a:	53                   	push   %ebx
+  80522b:	51                   	push   %ecx
+  80522c:	e8 60 fe ff ff       	call   805091 <udm>
+  805231:	83 c4 10             	add    $0x10,%esp
+  805234:	eb d8                	jmp    80520e <__divdi3+0x4e>
+  805236:	83 ec 04             	sub    $0x4,%esp
+  805239:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80523d:	56                   	push   %esi
+  80523e:	f7 d9                	neg    %ecx
+  805240:	83 d3 00             	adc    $0x0,%ebx
+  805243:	f7 db                	neg    %ebx
+  805245:	53                   	push   %ebx
+  805246:	51                   	push   %ecx
+  805247:	e8 45 fe ff ff       	call   805091 <udm>
+  80524c:	83 c4 10             	add    $0x10,%esp
+  80524f:	eb c4                	jmp    805215 <__divdi3+0x55>
+
+00805251 <__moddi3>:
+  805251:	55                   	push   %ebp
+  805252:	57                   	push   %edi
+  805253:	56                   	push   %esi
+  805254:	53                   	push   %ebx
+  805255:	83 ec 24             	sub    $0x24,%esp
+  805258:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80525c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805260:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  805264:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  805268:	85 d2                	test   %edx,%edx
+  80526a:	78 3b                	js     8052a7 <__moddi3+0x56>
+  80526c:	83 ec 04             	sub    $0x4,%esp
+  80526f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  805273:	56                   	push   %esi
+  805274:	89 ce                	mov    %ecx,%esi
+  805276:	f7 de                	neg    %esi
+  805278:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80527c:	89 de                	mov    %ebx,%esi
+  80527e:	83 d6 00             	adc    $0x0,%esi
+  805281:	f7 de                	neg    %esi
+  805283:	89 74 24 14          	mov    %esi,0x14(%esp)
+  805287:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80528b:	0f 48 f1             	cmovs  %ecx,%esi
+  80528e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  805293:	53                   	push   %ebx
+  805294:	56                   	push   %esi
+  805295:	e8 f7 fd ff ff       	call   805091 <udm>
+  80529a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80529e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8052a2:	83 c4 10             	add    $0x10,%esp
+  8052a5:	eb 47                	jmp    8052ee <__moddi3+0x9d>
+  8052a7:	f7 d8                	neg    %eax
+  8052a9:	83 d2 00             	adc    $0x0,%edx
+  8052ac:	f7 da                	neg    %edx
+  8052ae:	83 ec 04             	sub    $0x4,%esp
+  8052b1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8052b5:	56                   	push   %esi
+  8052b6:	89 cf                	mov    %ecx,%edi
+  8052b8:	f7 df                	neg    %edi
+  8052ba:	89 de                	mov    %ebx,%esi
+  8052bc:	83 d6 00             	adc    $0x0,%esi
+  8052bf:	f7 de                	neg    %esi
+  8052c1:	0f 49 cf             	cmovns %edi,%ecx
+  8052c4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8052c8:	0f 49 de             	cmovns %esi,%ebx
+  8052cb:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8052cf:	ff 74 24 0c          	push   0xc(%esp)
+  8052d3:	ff 74 24 0c          	push   0xc(%esp)
+  8052d7:	e8 b5 fd ff ff       	call   805091 <udm>
+  8052dc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8052e0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8052e4:	f7 d8                	neg    %eax
+  8052e6:	83 d2 00             	adc    $0x0,%edx
+  8052e9:	f7 da                	neg    %edx
+  8052eb:	83 c4 10             	add    $0x10,%esp
+  8052ee:	83 c4 24             	add    $0x24,%esp
+  8052f1:	5b                   	pop    %ebx
+  8052f2:	5e                   	pop    %esi
+  8052f3:	5f                   	pop    %edi
+  8052f4:	5d                   	pop    %ebp
+  8052f5:	c3                   	ret
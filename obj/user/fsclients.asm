@@ -0,0 +1,10112 @@
+
+obj/user/fsclients.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ed 03 00 00       	call   80041e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <open_or_die>:
+
+static char buf[BLKSIZE];
+
+static int
+open_or_die(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 c3                	mov    %eax,%ebx
+	int fd;
+
+	if ((fd = open(path, mode)) < 0)
+  80003c:	52                   	push   %edx
+  80003d:	50                   	push   %eax
+  80003e:	e8 e8 23 00 00       	call   80242b <open>
+  800043:	83 c4 10             	add    $0x10,%esp
+  800046:	85 c0                	test   %eax,%eax
+  800048:	78 05                	js     80004f <open_or_die+0x1c>
+		panic("open %s: %e", path, fd);
+	return fd;
+}
+  80004a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80004d:	c9                   	leave
+  80004e:	c3                   	ret
+		panic("open %s: %e", path, fd);
+  80004f:	83 ec 0c             	sub    $0xc,%esp
+  800052:	50                   	push   %eax
+  800053:	53                   	push   %ebx
+  800054:	68 00 4b 80 00       	push   $0x804b00
+  800059:	6a 1b                	push   $0x1b
+  80005b:	68 0c 4b 80 00       	push   $0x804b0c
+  800060:	e8 5c 04 00 00       	call   8004c1 <_panic>
+
+00800065 <umain>:
+		(uint32_t) lat[NHOTREADS - 1]);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	57                   	push   %edi
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	83 c4 80             	add    $0xffffff80,%esp
+	envid_t kids[NCOLD + NHOT];
+	struct BcStat st;
+	unsigned start;
+	int fd, i, r;
+
+	memset(buf, 0x5a, sizeof buf);
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	6a 5a                	push   $0x5a
+  800075:	68 80 ae 80 00       	push   $0x80ae80
+  80007a:	e8 52 0c 00 00       	call   800cd1 <memset>
+	fd = open_or_die(COLDFILE, O_RDWR|O_CREAT|O_TRUNC);
+  80007f:	ba 02 03 00 00       	mov    $0x302,%edx
+  800084:	b8 1d 4b 80 00       	mov    $0x804b1d,%eax
+  800089:	e8 a5 ff ff ff       	call   800033 <open_or_die>
+  80008e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < COLDBLOCKS; i++)
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	bb 01 01 00 00       	mov    $0x101,%ebx
+  800098:	83 eb 01             	sub    $0x1,%ebx
+  80009b:	74 37                	je     8000d4 <umain+0x6f>
+		if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  80009d:	83 ec 04             	sub    $0x4,%esp
+  8000a0:	68 00 10 00 00       	push   $0x1000
+  8000a5:	68 80 ae 80 00       	push   $0x80ae80
+  8000aa:	56                   	push   %esi
+  8000ab:	e8 2b 1e 00 00       	call   801edb <write>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8000b8:	74 de                	je     800098 <umain+0x33>
+			panic("write %s: %e", COLDFILE, r);
+  8000ba:	83 ec 0c             	sub    $0xc,%esp
+  8000bd:	50                   	push   %eax
+  8000be:	68 1d 4b 80 00       	push   $0x804b1d
+  8000c3:	68 2d 4b 80 00       	push   $0x804b2d
+  8000c8:	6a 5b                	push   $0x5b
+  8000ca:	68 0c 4b 80 00       	push   $0x804b0c
+  8000cf:	e8 ed 03 00 00       	call   8004c1 <_panic>
+	close(fd);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	56                   	push   %esi
+  8000d8:	e8 ca 1b 00 00       	call   801ca7 <close>
+	fd = open_or_die(HOTFILE, O_RDWR|O_CREAT|O_TRUNC);
+  8000dd:	ba 02 03 00 00       	mov    $0x302,%edx
+  8000e2:	b8 3a 4b 80 00       	mov    $0x804b3a,%eax
+  8000e7:	e8 47 ff ff ff       	call   800033 <open_or_die>
+  8000ec:	89 c3                	mov    %eax,%ebx
+	if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  8000ee:	83 c4 0c             	add    $0xc,%esp
+  8000f1:	68 00 10 00 00       	push   $0x1000
+  8000f6:	68 80 ae 80 00       	push   $0x80ae80
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 da 1d 00 00       	call   801edb <write>
+  800101:	83 c4 10             	add    $0x10,%esp
+  800104:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800109:	75 56                	jne    800161 <umain+0xfc>
+		panic("write %s: %e", HOTFILE, r);
+	close(fd);
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	53                   	push   %ebx
+  80010f:	e8 93 1b 00 00       	call   801ca7 <close>
+	if ((r = sync()) < 0)
+  800114:	e8 5a 26 00 00       	call   802773 <sync>
+  800119:	83 c4 10             	add    $0x10,%esp
+  80011c:	85 c0                	test   %eax,%eax
+  80011e:	78 5b                	js     80017b <umain+0x116>
+		panic("sync: %e", r);
+
+	if ((r = fs_bcstat(0, &st)) < 0)
+  800120:	83 ec 08             	sub    $0x8,%esp
+  800123:	8d 45 9c             	lea    -0x64(%ebp),%eax
+  800126:	50                   	push   %eax
+  800127:	6a 00                	push   $0x0
+  800129:	e8 7a 26 00 00       	call   8027a8 <fs_bcstat>
+  80012e:	83 c4 10             	add    $0x10,%esp
+  800131:	85 c0                	test   %eax,%eax
+  800133:	78 58                	js     80018d <umain+0x128>
+		panic("fs_bcstat: %e", r);
+	if ((r = fs_bcstat(COLDCACHE, NULL)) < 0)
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	6a 00                	push   $0x0
+  80013a:	6a 20                	push   $0x20
+  80013c:	e8 67 26 00 00       	call   8027a8 <fs_bcstat>
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	85 c0                	test   %eax,%eax
+  800146:	78 57                	js     80019f <umain+0x13a>
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+
+	start = sys_time_msec();
+  800148:	e8 fe 10 00 00       	call   80124b <sys_time_msec>
+  80014d:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  800150:	bf 00 61 00 00       	mov    $0x6100,%edi
+	for (i = 0; i < NCOLD + NHOT; i++) {
+  800155:	c7 45 8c 00 00 00 00 	movl   $0x0,-0x74(%ebp)
+  80015c:	e9 11 02 00 00       	jmp    800372 <umain+0x30d>
+		panic("write %s: %e", HOTFILE, r);
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	50                   	push   %eax
+  800165:	68 3a 4b 80 00       	push   $0x804b3a
+  80016a:	68 2d 4b 80 00       	push   $0x804b2d
+  80016f:	6a 5f                	push   $0x5f
+  800171:	68 0c 4b 80 00       	push   $0x804b0c
+  800176:	e8 46 03 00 00       	call   8004c1 <_panic>
+		panic("sync: %e", r);
+  80017b:	50                   	push   %eax
+  80017c:	68 49 4b 80 00       	push   $0x804b49
+  800181:	6a 62                	push   $0x62
+  800183:	68 0c 4b 80 00       	push   $0x804b0c
+  800188:	e8 34 03 00 00       	call   8004c1 <_panic>
+		panic("fs_bcstat: %e", r);
+  80018d:	50                   	push   %eax
+  80018e:	68 52 4b 80 00       	push   $0x804b52
+  800193:	6a 65                	push   $0x65
+  800195:	68 0c 4b 80 00       	push   $0x804b0c
+  80019a:	e8 22 03 00 00       	call   8004c1 <_panic>
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+  80019f:	83 ec 0c             	sub    $0xc,%esp
+  8001a2:	50                   	push   %eax
+  8001a3:	6a 20                	push   $0x20
+  8001a5:	68 60 4b 80 00       	push   $0x804b60
+  8001aa:	6a 67                	push   $0x67
+  8001ac:	68 0c 4b 80 00       	push   $0x804b0c
+  8001b1:	e8 0b 03 00 00       	call   8004c1 <_panic>
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+  8001b6:	53                   	push   %ebx
+  8001b7:	68 71 4b 80 00       	push   $0x804b71
+  8001bc:	6a 6c                	push   $0x6c
+  8001be:	68 0c 4b 80 00       	push   $0x804b0c
+  8001c3:	e8 f9 02 00 00       	call   8004c1 <_panic>
+  8001c8:	8b 55 90             	mov    -0x70(%ebp),%edx
+	for (pass = 0; pass < NCOLDPASSES; pass++)
+  8001cb:	83 ea 01             	sub    $0x1,%edx
+  8001ce:	74 59                	je     800229 <umain+0x1c4>
+  8001d0:	8b 5d 88             	mov    -0x78(%ebp),%ebx
+  8001d3:	89 55 90             	mov    %edx,-0x70(%ebp)
+		for (i = 0; i < COLDBLOCKS; i++) {
+  8001d6:	39 df                	cmp    %ebx,%edi
+  8001d8:	74 ee                	je     8001c8 <umain+0x163>
+			seek(fd, ((i * 97 + id * 31) % COLDBLOCKS) * BLKSIZE);
+  8001da:	83 ec 08             	sub    $0x8,%esp
+  8001dd:	89 da                	mov    %ebx,%edx
+  8001df:	c1 fa 1f             	sar    $0x1f,%edx
+  8001e2:	c1 ea 18             	shr    $0x18,%edx
+  8001e5:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	29 d0                	sub    %edx,%eax
+  8001ed:	c1 e0 0c             	shl    $0xc,%eax
+  8001f0:	50                   	push   %eax
+  8001f1:	56                   	push   %esi
+  8001f2:	e8 90 1d 00 00       	call   801f87 <seek>
+			if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  8001f7:	83 c4 0c             	add    $0xc,%esp
+  8001fa:	68 00 10 00 00       	push   $0x1000
+  8001ff:	68 80 ae 80 00       	push   $0x80ae80
+  800204:	56                   	push   %esi
+  800205:	e8 8a 1c 00 00       	call   801e94 <readn>
+  80020a:	83 c3 61             	add    $0x61,%ebx
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800215:	74 bf                	je     8001d6 <umain+0x171>
+				panic("cold read: got %d", r);
+  800217:	50                   	push   %eax
+  800218:	68 7a 4b 80 00       	push   $0x804b7a
+  80021d:	6a 2a                	push   $0x2a
+  80021f:	68 0c 4b 80 00       	push   $0x804b0c
+  800224:	e8 98 02 00 00       	call   8004c1 <_panic>
+	close(fd);
+  800229:	83 ec 0c             	sub    $0xc,%esp
+  80022c:	56                   	push   %esi
+  80022d:	e8 75 1a 00 00       	call   801ca7 <close>
+}
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	e9 24 01 00 00       	jmp    80035e <umain+0x2f9>
+		if (kids[i] == 0) {
+			if (i < NCOLD)
+				cold_client(i);
+			else
+				hot_client(i - NCOLD);
+  80023a:	83 e8 02             	sub    $0x2,%eax
+  80023d:	89 45 88             	mov    %eax,-0x78(%ebp)
+	fd = open_or_die(HOTFILE, O_RDONLY);
+  800240:	ba 00 00 00 00       	mov    $0x0,%edx
+  800245:	b8 3a 4b 80 00       	mov    $0x804b3a,%eax
+  80024a:	e8 e4 fd ff ff       	call   800033 <open_or_die>
+  80024f:	89 c6                	mov    %eax,%esi
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  800251:	0f 31                	rdtsc
+  800253:	89 45 90             	mov    %eax,-0x70(%ebp)
+  800256:	89 55 94             	mov    %edx,-0x6c(%ebp)
+		seek(fd, 0);
+  800259:	83 ec 08             	sub    $0x8,%esp
+  80025c:	6a 00                	push   $0x0
+  80025e:	56                   	push   %esi
+  80025f:	e8 23 1d 00 00       	call   801f87 <seek>
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  800264:	83 c4 0c             	add    $0xc,%esp
+  800267:	68 00 10 00 00       	push   $0x1000
+  80026c:	68 80 ae 80 00       	push   $0x80ae80
+  800271:	56                   	push   %esi
+  800272:	e8 1d 1c 00 00       	call   801e94 <readn>
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80027f:	75 3e                	jne    8002bf <umain+0x25a>
+  800281:	0f 31                	rdtsc
+		lat[i] = read_tsc() - tsc;
+  800283:	2b 45 90             	sub    -0x70(%ebp),%eax
+  800286:	1b 55 94             	sbb    -0x6c(%ebp),%edx
+  800289:	89 04 dd 00 70 80 00 	mov    %eax,0x807000(,%ebx,8)
+  800290:	89 14 dd 04 70 80 00 	mov    %edx,0x807004(,%ebx,8)
+	for (i = 0; i < NHOTREADS; i++) {
+  800297:	83 c3 01             	add    $0x1,%ebx
+  80029a:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  8002a0:	75 af                	jne    800251 <umain+0x1ec>
+	close(fd);
+  8002a2:	83 ec 0c             	sub    $0xc,%esp
+  8002a5:	56                   	push   %esi
+  8002a6:	e8 fc 19 00 00       	call   801ca7 <close>
+  8002ab:	83 c4 10             	add    $0x10,%esp
+	for (i = 1; i < NHOTREADS; i++)
+  8002ae:	c7 45 90 01 00 00 00 	movl   $0x1,-0x70(%ebp)
+  8002b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002ba:	89 7d 80             	mov    %edi,-0x80(%ebp)
+  8002bd:	eb 23                	jmp    8002e2 <umain+0x27d>
+			panic("hot read: got %d", r);
+  8002bf:	50                   	push   %eax
+  8002c0:	68 8c 4b 80 00       	push   $0x804b8c
+  8002c5:	6a 3b                	push   $0x3b
+  8002c7:	68 0c 4b 80 00       	push   $0x804b0c
+  8002cc:	e8 f0 01 00 00       	call   8004c1 <_panic>
+	for (i = 1; i < NHOTREADS; i++)
+  8002d1:	8b 7d 90             	mov    -0x70(%ebp),%edi
+  8002d4:	8d 47 01             	lea    0x1(%edi),%eax
+  8002d7:	81 ff cf 07 00 00    	cmp    $0x7cf,%edi
+  8002dd:	74 4c                	je     80032b <umain+0x2c6>
+  8002df:	89 45 90             	mov    %eax,-0x70(%ebp)
+		for (j = i; j > 0 && lat[j - 1] > lat[j]; j--) {
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	7e eb                	jle    8002d1 <umain+0x26c>
+  8002e6:	83 e8 01             	sub    $0x1,%eax
+  8002e9:	8b 1c c5 00 70 80 00 	mov    0x807000(,%eax,8),%ebx
+  8002f0:	8b 14 c5 04 70 80 00 	mov    0x807004(,%eax,8),%edx
+  8002f7:	8b 34 c5 08 70 80 00 	mov    0x807008(,%eax,8),%esi
+  8002fe:	8b 0c c5 0c 70 80 00 	mov    0x80700c(,%eax,8),%ecx
+  800305:	39 de                	cmp    %ebx,%esi
+  800307:	89 cf                	mov    %ecx,%edi
+  800309:	19 d7                	sbb    %edx,%edi
+  80030b:	73 c4                	jae    8002d1 <umain+0x26c>
+			lat[j] = lat[j - 1];
+  80030d:	89 1c c5 08 70 80 00 	mov    %ebx,0x807008(,%eax,8)
+  800314:	89 14 c5 0c 70 80 00 	mov    %edx,0x80700c(,%eax,8)
+			lat[j - 1] = tsc;
+  80031b:	89 34 c5 00 70 80 00 	mov    %esi,0x807000(,%eax,8)
+  800322:	89 0c c5 04 70 80 00 	mov    %ecx,0x807004(,%eax,8)
+		for (j = i; j > 0 && lat[j - 1] > lat[j]; j--) {
+  800329:	eb b7                	jmp    8002e2 <umain+0x27d>
+	cprintf("hot client %d: %d reads, cycles p50 %u p90 %u p99 %u max %u\n",
+  80032b:	8b 7d 80             	mov    -0x80(%ebp),%edi
+  80032e:	83 ec 04             	sub    $0x4,%esp
+  800331:	ff 35 78 ae 80 00    	push   0x80ae78
+  800337:	ff 35 e0 ad 80 00    	push   0x80ade0
+  80033d:	ff 35 40 a8 80 00    	push   0x80a840
+  800343:	ff 35 40 8f 80 00    	push   0x808f40
+  800349:	68 d0 07 00 00       	push   $0x7d0
+  80034e:	ff 75 88             	push   -0x78(%ebp)
+  800351:	68 a0 4b 80 00       	push   $0x804ba0
+  800356:	e8 41 02 00 00       	call   80059c <cprintf>
+}
+  80035b:	83 c4 20             	add    $0x20,%esp
+			exit();
+  80035e:	e8 36 01 00 00       	call   800499 <exit>
+	for (i = 0; i < NCOLD + NHOT; i++) {
+  800363:	83 45 8c 01          	addl   $0x1,-0x74(%ebp)
+  800367:	8b 45 8c             	mov    -0x74(%ebp),%eax
+  80036a:	83 c7 1f             	add    $0x1f,%edi
+  80036d:	83 f8 04             	cmp    $0x4,%eax
+  800370:	74 48                	je     8003ba <umain+0x355>
+		if ((kids[i] = fork()) < 0)
+  800372:	e8 03 13 00 00       	call   80167a <fork>
+  800377:	89 c3                	mov    %eax,%ebx
+  800379:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+  80037c:	89 c8                	mov    %ecx,%eax
+  80037e:	89 5c 8d d8          	mov    %ebx,-0x28(%ebp,%ecx,4)
+  800382:	85 db                	test   %ebx,%ebx
+  800384:	0f 88 2c fe ff ff    	js     8001b6 <umain+0x151>
+		if (kids[i] == 0) {
+  80038a:	75 d7                	jne    800363 <umain+0x2fe>
+			if (i < NCOLD)
+  80038c:	83 7d 8c 01          	cmpl   $0x1,-0x74(%ebp)
+  800390:	0f 8f a4 fe ff ff    	jg     80023a <umain+0x1d5>
+	fd = open_or_die(COLDFILE, O_RDONLY);
+  800396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039b:	b8 1d 4b 80 00       	mov    $0x804b1d,%eax
+  8003a0:	e8 8e fc ff ff       	call   800033 <open_or_die>
+  8003a5:	89 c6                	mov    %eax,%esi
+			seek(fd, ((i * 97 + id * 31) % COLDBLOCKS) * BLKSIZE);
+  8003a7:	8d 87 00 9f ff ff    	lea    -0x6100(%edi),%eax
+  8003ad:	89 45 88             	mov    %eax,-0x78(%ebp)
+	for (pass = 0; pass < NCOLDPASSES; pass++)
+  8003b0:	ba 05 00 00 00       	mov    $0x5,%edx
+  8003b5:	e9 11 fe ff ff       	jmp    8001cb <umain+0x166>
+  8003ba:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8003bd:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  8003c0:	eb 10                	jmp    8003d2 <umain+0x36d>
+		}
+	}
+	for (i = 0; i < NCOLD + NHOT; i++)
+		wait(kids[i]);
+  8003c2:	83 ec 0c             	sub    $0xc,%esp
+  8003c5:	ff 33                	push   (%ebx)
+  8003c7:	e8 ba 38 00 00       	call   803c86 <wait>
+	for (i = 0; i < NCOLD + NHOT; i++)
+  8003cc:	83 c3 04             	add    $0x4,%ebx
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	39 f3                	cmp    %esi,%ebx
+  8003d4:	75 ec                	jne    8003c2 <umain+0x35d>
+	cprintf("%d cold and %d hot clients done in %d ms\n",
+		NCOLD, NHOT, sys_time_msec() - start);
+  8003d6:	e8 70 0e 00 00       	call   80124b <sys_time_msec>
+	cprintf("%d cold and %d hot clients done in %d ms\n",
+  8003db:	8b 4d 84             	mov    -0x7c(%ebp),%ecx
+  8003de:	29 c8                	sub    %ecx,%eax
+  8003e0:	50                   	push   %eax
+  8003e1:	6a 02                	push   $0x2
+  8003e3:	6a 02                	push   $0x2
+  8003e5:	68 e0 4b 80 00       	push   $0x804be0
+  8003ea:	e8 ad 01 00 00       	call   80059c <cprintf>
+
+	fs_bcstat(st.bs_budget, NULL);
+  8003ef:	83 c4 08             	add    $0x8,%esp
+  8003f2:	6a 00                	push   $0x0
+  8003f4:	ff 75 bc             	push   -0x44(%ebp)
+  8003f7:	e8 ac 23 00 00       	call   8027a8 <fs_bcstat>
+	fd = open_or_die(COLDFILE, O_RDWR|O_TRUNC);
+  8003fc:	ba 02 02 00 00       	mov    $0x202,%edx
+  800401:	b8 1d 4b 80 00       	mov    $0x804b1d,%eax
+  800406:	e8 28 fc ff ff       	call   800033 <open_or_die>
+	close(fd);
+  80040b:	89 04 24             	mov    %eax,(%esp)
+  80040e:	e8 94 18 00 00       	call   801ca7 <close>
+}
+  800413:	83 c4 10             	add    $0x10,%esp
+  800416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800419:	5b                   	pop    %ebx
+  80041a:	5e                   	pop    %esi
+  80041b:	5f                   	pop    %edi
+  80041c:	5d                   	pop    %ebp
+  80041d:	c3                   	ret
+
+0080041e <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	57                   	push   %edi
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+  800424:	83 ec 1c             	sub    $0x1c,%esp
+  800427:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80042a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80042d:	e8 34 0b 00 00       	call   800f66 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800432:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800435:	89 15 40 c1 80 00    	mov    %edx,0x80c140
+	thisenv = &envs[ENVX(eid)];
+  80043b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800440:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800442:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800444:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80044a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80044f:	77 16                	ja     800467 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800451:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800456:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800458:	c1 e8 10             	shr    $0x10,%eax
+  80045b:	74 0a                	je     800467 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80045d:	c1 e0 10             	shl    $0x10,%eax
+  800460:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800465:	29 c2                	sub    %eax,%edx
+  800467:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80046a:	c1 e0 04             	shl    $0x4,%eax
+  80046d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800472:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	7e 07                	jle    80047f <libmain+0x61>
+		binaryname = argv[0];
+  800478:	8b 06                	mov    (%esi),%eax
+  80047a:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80047f:	83 ec 08             	sub    $0x8,%esp
+  800482:	56                   	push   %esi
+  800483:	53                   	push   %ebx
+  800484:	e8 dc fb ff ff       	call   800065 <umain>
+
+	// exit gracefully
+	exit();
+  800489:	e8 0b 00 00 00       	call   800499 <exit>
+}
+  80048e:	83 c4 10             	add    $0x10,%esp
+  800491:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800494:	5b                   	pop    %ebx
+  800495:	5e                   	pop    %esi
+  800496:	5f                   	pop    %edi
+  800497:	5d                   	pop    %ebp
+  800498:	c3                   	ret
+
+00800499 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800499:	55                   	push   %ebp
+  80049a:	89 e5                	mov    %esp,%ebp
+  80049c:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80049f:	6a 00                	push   $0x0
+  8004a1:	e8 8b 27 00 00       	call   802c31 <fflush>
+	pthread_kill_others();
+  8004a6:	e8 47 3e 00 00       	call   8042f2 <pthread_kill_others>
+	close_all();
+  8004ab:	e8 24 18 00 00       	call   801cd4 <close_all>
+	sys_env_destroy(0);
+  8004b0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8004b7:	e8 5f 0a 00 00       	call   800f1b <sys_env_destroy>
+}
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+
+008004c1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	56                   	push   %esi
+  8004c5:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004c6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004c9:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8004cf:	e8 92 0a 00 00       	call   800f66 <sys_getenvid>
+  8004d4:	83 ec 0c             	sub    $0xc,%esp
+  8004d7:	ff 75 0c             	push   0xc(%ebp)
+  8004da:	ff 75 08             	push   0x8(%ebp)
+  8004dd:	56                   	push   %esi
+  8004de:	50                   	push   %eax
+  8004df:	68 14 4c 80 00       	push   $0x804c14
+  8004e4:	e8 b3 00 00 00       	call   80059c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8004e9:	83 c4 18             	add    $0x18,%esp
+  8004ec:	53                   	push   %ebx
+  8004ed:	ff 75 10             	push   0x10(%ebp)
+  8004f0:	e8 56 00 00 00       	call   80054b <vcprintf>
+	cprintf("\n");
+  8004f5:	c7 04 24 1a 51 80 00 	movl   $0x80511a,(%esp)
+  8004fc:	e8 9b 00 00 00       	call   80059c <cprintf>
+  800501:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800504:	cc                   	int3
+	while (1)
+  800505:	eb fd                	jmp    800504 <_panic+0x43>
+
+00800507 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	53                   	push   %ebx
+  80050b:	83 ec 04             	sub    $0x4,%esp
+  80050e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800511:	8b 13                	mov    (%ebx),%edx
+  800513:	8d 42 01             	lea    0x1(%edx),%eax
+  800516:	89 03                	mov    %eax,(%ebx)
+  800518:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80051b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80051f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800524:	74 09                	je     80052f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800526:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80052a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80052d:	c9                   	leave
+  80052e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	68 ff 00 00 00       	push   $0xff
+  800537:	8d 43 08             	lea    0x8(%ebx),%eax
+  80053a:	50                   	push   %eax
+  80053b:	e8 84 09 00 00       	call   800ec4 <sys_cputs>
+		b->idx = 0;
+  800540:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800546:	83 c4 10             	add    $0x10,%esp
+  800549:	eb db                	jmp    800526 <putch+0x1f>
+
+0080054b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80054b:	55                   	push   %ebp
+  80054c:	89 e5                	mov    %esp,%ebp
+  80054e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800554:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80055b:	00 00 00 
+	b.cnt = 0;
+  80055e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800565:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800568:	ff 75 0c             	push   0xc(%ebp)
+  80056b:	ff 75 08             	push   0x8(%ebp)
+  80056e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800574:	50                   	push   %eax
+  800575:	68 07 05 80 00       	push   $0x800507
+  80057a:	e8 14 01 00 00       	call   800693 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80057f:	83 c4 08             	add    $0x8,%esp
+  800582:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800588:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80058e:	50                   	push   %eax
+  80058f:	e8 30 09 00 00       	call   800ec4 <sys_cputs>
+
+	return b.cnt;
+}
+  800594:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80059a:	c9                   	leave
+  80059b:	c3                   	ret
+
+0080059c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80059c:	55                   	push   %ebp
+  80059d:	89 e5                	mov    %esp,%ebp
+  80059f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005a5:	50                   	push   %eax
+  8005a6:	ff 75 08             	push   0x8(%ebp)
+  8005a9:	e8 9d ff ff ff       	call   80054b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005ae:	c9                   	leave
+  8005af:	c3                   	ret
+
+008005b0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005b0:	55                   	push   %ebp
+  8005b1:	89 e5                	mov    %esp,%ebp
+  8005b3:	57                   	push   %edi
+  8005b4:	56                   	push   %esi
+  8005b5:	53                   	push   %ebx
+  8005b6:	83 ec 1c             	sub    $0x1c,%esp
+  8005b9:	89 c7                	mov    %eax,%edi
+  8005bb:	89 d6                	mov    %edx,%esi
+  8005bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005c3:	89 d1                	mov    %edx,%ecx
+  8005c5:	89 c2                	mov    %eax,%edx
+  8005c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005dd:	39 c2                	cmp    %eax,%edx
+  8005df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005e2:	72 3e                	jb     800622 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005e4:	83 ec 0c             	sub    $0xc,%esp
+  8005e7:	ff 75 18             	push   0x18(%ebp)
+  8005ea:	83 eb 01             	sub    $0x1,%ebx
+  8005ed:	53                   	push   %ebx
+  8005ee:	50                   	push   %eax
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8005f5:	ff 75 e0             	push   -0x20(%ebp)
+  8005f8:	ff 75 dc             	push   -0x24(%ebp)
+  8005fb:	ff 75 d8             	push   -0x28(%ebp)
+  8005fe:	e8 72 43 00 00       	call   804975 <__udivdi3>
+  800603:	83 c4 18             	add    $0x18,%esp
+  800606:	52                   	push   %edx
+  800607:	50                   	push   %eax
+  800608:	89 f2                	mov    %esi,%edx
+  80060a:	89 f8                	mov    %edi,%eax
+  80060c:	e8 9f ff ff ff       	call   8005b0 <printnum>
+  800611:	83 c4 20             	add    $0x20,%esp
+  800614:	eb 13                	jmp    800629 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	56                   	push   %esi
+  80061a:	ff 75 18             	push   0x18(%ebp)
+  80061d:	ff d7                	call   *%edi
+  80061f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800622:	83 eb 01             	sub    $0x1,%ebx
+  800625:	85 db                	test   %ebx,%ebx
+  800627:	7f ed                	jg     800616 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	56                   	push   %esi
+  80062d:	83 ec 04             	sub    $0x4,%esp
+  800630:	ff 75 e4             	push   -0x1c(%ebp)
+  800633:	ff 75 e0             	push   -0x20(%ebp)
+  800636:	ff 75 dc             	push   -0x24(%ebp)
+  800639:	ff 75 d8             	push   -0x28(%ebp)
+  80063c:	e8 55 43 00 00       	call   804996 <__umoddi3>
+  800641:	83 c4 14             	add    $0x14,%esp
+  800644:	0f be 80 37 4c 80 00 	movsbl 0x804c37(%eax),%eax
+  80064b:	50                   	push   %eax
+  80064c:	ff d7                	call   *%edi
+}
+  80064e:	83 c4 10             	add    $0x10,%esp
+  800651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800654:	5b                   	pop    %ebx
+  800655:	5e                   	pop    %esi
+  800656:	5f                   	pop    %edi
+  800657:	5d                   	pop    %ebp
+  800658:	c3                   	ret
+
+00800659 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800659:	55                   	push   %ebp
+  80065a:	89 e5                	mov    %esp,%ebp
+  80065c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80065f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	3b 50 04             	cmp    0x4(%eax),%edx
+  800668:	73 0a                	jae    800674 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80066a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80066d:	89 08                	mov    %ecx,(%eax)
+  80066f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800672:	88 02                	mov    %al,(%edx)
+}
+  800674:	5d                   	pop    %ebp
+  800675:	c3                   	ret
+
+00800676 <printfmt>:
+{
+  800676:	55                   	push   %ebp
+  800677:	89 e5                	mov    %esp,%ebp
+  800679:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80067c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80067f:	50                   	push   %eax
+  800680:	ff 75 10             	push   0x10(%ebp)
+  800683:	ff 75 0c             	push   0xc(%ebp)
+  800686:	ff 75 08             	push   0x8(%ebp)
+  800689:	e8 05 00 00 00       	call   800693 <vprintfmt>
+}
+  80068e:	83 c4 10             	add    $0x10,%esp
+  800691:	c9                   	leave
+  800692:	c3                   	ret
+
+00800693 <vprintfmt>:
+{
+  800693:	55                   	push   %ebp
+  800694:	89 e5                	mov    %esp,%ebp
+  800696:	57                   	push   %edi
+  800697:	56                   	push   %esi
+  800698:	53                   	push   %ebx
+  800699:	83 ec 2c             	sub    $0x2c,%esp
+  80069c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80069f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006a5:	eb 0a                	jmp    8006b1 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	53                   	push   %ebx
+  8006ab:	50                   	push   %eax
+  8006ac:	ff d6                	call   *%esi
+  8006ae:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8006b1:	83 c7 01             	add    $0x1,%edi
+  8006b4:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8006b8:	83 f8 25             	cmp    $0x25,%eax
+  8006bb:	74 0c                	je     8006c9 <vprintfmt+0x36>
+			if (ch == '\0')
+  8006bd:	85 c0                	test   %eax,%eax
+  8006bf:	75 e6                	jne    8006a7 <vprintfmt+0x14>
+}
+  8006c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c4:	5b                   	pop    %ebx
+  8006c5:	5e                   	pop    %esi
+  8006c6:	5f                   	pop    %edi
+  8006c7:	5d                   	pop    %ebp
+  8006c8:	c3                   	ret
+		padc = ' ';
+  8006c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8006db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8006e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8006e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8006ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ed:	0f b6 17             	movzbl (%edi),%edx
+  8006f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006f3:	3c 55                	cmp    $0x55,%al
+  8006f5:	0f 87 c5 03 00 00    	ja     800ac0 <vprintfmt+0x42d>
+  8006fb:	0f b6 c0             	movzbl %al,%eax
+  8006fe:	ff 24 85 c0 4d 80 00 	jmp    *0x804dc0(,%eax,4)
+  800705:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800708:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80070b:	eb da                	jmp    8006e7 <vprintfmt+0x54>
+  80070d:	0f be d2             	movsbl %dl,%edx
+  800710:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+  800718:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80071b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80071e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800722:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800725:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800728:	83 f9 09             	cmp    $0x9,%ecx
+  80072b:	77 55                	ja     800782 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80072d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800730:	eb e9                	jmp    80071b <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 00                	mov    (%eax),%eax
+  800737:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80073a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073d:	8d 40 04             	lea    0x4(%eax),%eax
+  800740:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800743:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800746:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80074a:	79 9b                	jns    8006e7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80074c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80074f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800752:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800759:	eb 8c                	jmp    8006e7 <vprintfmt+0x54>
+			if (width < 0)
+  80075b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80075e:	85 d2                	test   %edx,%edx
+  800760:	b8 00 00 00 00       	mov    $0x0,%eax
+  800765:	0f 49 c2             	cmovns %edx,%eax
+  800768:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80076b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80076e:	e9 74 ff ff ff       	jmp    8006e7 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800773:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800776:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80077d:	e9 65 ff ff ff       	jmp    8006e7 <vprintfmt+0x54>
+  800782:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800785:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800788:	eb bc                	jmp    800746 <vprintfmt+0xb3>
+			lflag++;
+  80078a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80078d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800790:	e9 52 ff ff ff       	jmp    8006e7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8d 78 04             	lea    0x4(%eax),%edi
+  80079b:	83 ec 08             	sub    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	ff 30                	push   (%eax)
+  8007a1:	ff d6                	call   *%esi
+			break;
+  8007a3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007a9:	e9 b1 02 00 00       	jmp    800a5f <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007b4:	8b 10                	mov    (%eax),%edx
+  8007b6:	89 d0                	mov    %edx,%eax
+  8007b8:	f7 d8                	neg    %eax
+  8007ba:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007bd:	83 f8 14             	cmp    $0x14,%eax
+  8007c0:	7f 23                	jg     8007e5 <vprintfmt+0x152>
+  8007c2:	8b 14 85 20 4f 80 00 	mov    0x804f20(,%eax,4),%edx
+  8007c9:	85 d2                	test   %edx,%edx
+  8007cb:	74 18                	je     8007e5 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8007cd:	52                   	push   %edx
+  8007ce:	68 63 51 80 00       	push   $0x805163
+  8007d3:	53                   	push   %ebx
+  8007d4:	56                   	push   %esi
+  8007d5:	e8 9c fe ff ff       	call   800676 <printfmt>
+  8007da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8007e0:	e9 7a 02 00 00       	jmp    800a5f <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8007e5:	50                   	push   %eax
+  8007e6:	68 4f 4c 80 00       	push   $0x804c4f
+  8007eb:	53                   	push   %ebx
+  8007ec:	56                   	push   %esi
+  8007ed:	e8 84 fe ff ff       	call   800676 <printfmt>
+  8007f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007f8:	e9 62 02 00 00       	jmp    800a5f <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	83 c0 04             	add    $0x4,%eax
+  800803:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80080b:	85 c9                	test   %ecx,%ecx
+  80080d:	b8 48 4c 80 00       	mov    $0x804c48,%eax
+  800812:	0f 45 c1             	cmovne %ecx,%eax
+  800815:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800818:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80081c:	7e 06                	jle    800824 <vprintfmt+0x191>
+  80081e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800822:	75 0b                	jne    80082f <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800824:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800827:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80082a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80082d:	eb 5c                	jmp    80088b <vprintfmt+0x1f8>
+  80082f:	83 ec 08             	sub    $0x8,%esp
+  800832:	ff 75 d0             	push   -0x30(%ebp)
+  800835:	ff 75 cc             	push   -0x34(%ebp)
+  800838:	e8 20 03 00 00       	call   800b5d <strnlen>
+  80083d:	89 c2                	mov    %eax,%edx
+  80083f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800842:	29 d0                	sub    %edx,%eax
+  800844:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800847:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80084b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80084e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800851:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800853:	eb 0e                	jmp    800863 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800855:	83 ec 08             	sub    $0x8,%esp
+  800858:	53                   	push   %ebx
+  800859:	57                   	push   %edi
+  80085a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80085d:	83 ee 01             	sub    $0x1,%esi
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	85 f6                	test   %esi,%esi
+  800865:	7f ee                	jg     800855 <vprintfmt+0x1c2>
+  800867:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80086a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086d:	85 c0                	test   %eax,%eax
+  80086f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800874:	0f 49 d0             	cmovns %eax,%edx
+  800877:	29 d0                	sub    %edx,%eax
+  800879:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80087c:	eb a6                	jmp    800824 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	53                   	push   %ebx
+  800882:	52                   	push   %edx
+  800883:	ff 55 08             	call   *0x8(%ebp)
+  800886:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800889:	89 f1                	mov    %esi,%ecx
+  80088b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80088e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800892:	0f be d0             	movsbl %al,%edx
+  800895:	85 d2                	test   %edx,%edx
+  800897:	74 28                	je     8008c1 <vprintfmt+0x22e>
+  800899:	85 ff                	test   %edi,%edi
+  80089b:	78 05                	js     8008a2 <vprintfmt+0x20f>
+  80089d:	83 ef 01             	sub    $0x1,%edi
+  8008a0:	78 30                	js     8008d2 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008a6:	74 d6                	je     80087e <vprintfmt+0x1eb>
+  8008a8:	0f be c0             	movsbl %al,%eax
+  8008ab:	83 e8 20             	sub    $0x20,%eax
+  8008ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8008b1:	76 cb                	jbe    80087e <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8008b3:	83 ec 08             	sub    $0x8,%esp
+  8008b6:	53                   	push   %ebx
+  8008b7:	6a 3f                	push   $0x3f
+  8008b9:	ff 55 08             	call   *0x8(%ebp)
+  8008bc:	83 c4 10             	add    $0x10,%esp
+  8008bf:	eb c8                	jmp    800889 <vprintfmt+0x1f6>
+  8008c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008ca:	01 d0                	add    %edx,%eax
+  8008cc:	29 c8                	sub    %ecx,%eax
+  8008ce:	89 c7                	mov    %eax,%edi
+  8008d0:	eb 13                	jmp    8008e5 <vprintfmt+0x252>
+  8008d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d5:	eb ed                	jmp    8008c4 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8008d7:	83 ec 08             	sub    $0x8,%esp
+  8008da:	53                   	push   %ebx
+  8008db:	6a 20                	push   $0x20
+  8008dd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8008df:	83 ef 01             	sub    $0x1,%edi
+  8008e2:	83 c4 10             	add    $0x10,%esp
+  8008e5:	85 ff                	test   %edi,%edi
+  8008e7:	7f ee                	jg     8008d7 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008e9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8008ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ef:	e9 6b 01 00 00       	jmp    800a5f <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8008f4:	83 f9 01             	cmp    $0x1,%ecx
+  8008f7:	7f 1f                	jg     800918 <vprintfmt+0x285>
+	else if (lflag)
+  8008f9:	85 c9                	test   %ecx,%ecx
+  8008fb:	74 67                	je     800964 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8008fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800900:	8b 00                	mov    (%eax),%eax
+  800902:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800905:	89 c1                	mov    %eax,%ecx
+  800907:	c1 f9 1f             	sar    $0x1f,%ecx
+  80090a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8d 40 04             	lea    0x4(%eax),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+  800916:	eb 17                	jmp    80092f <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8b 50 04             	mov    0x4(%eax),%edx
+  80091e:	8b 00                	mov    (%eax),%eax
+  800920:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800923:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800926:	8b 45 14             	mov    0x14(%ebp),%eax
+  800929:	8d 40 08             	lea    0x8(%eax),%eax
+  80092c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80092f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800932:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800935:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80093a:	85 c9                	test   %ecx,%ecx
+  80093c:	0f 89 03 01 00 00    	jns    800a45 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800942:	83 ec 08             	sub    $0x8,%esp
+  800945:	53                   	push   %ebx
+  800946:	6a 2d                	push   $0x2d
+  800948:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80094a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80094d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800950:	f7 da                	neg    %edx
+  800952:	83 d1 00             	adc    $0x0,%ecx
+  800955:	f7 d9                	neg    %ecx
+  800957:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80095a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80095f:	e9 e1 00 00 00       	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 00                	mov    (%eax),%eax
+  800969:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80096c:	89 c1                	mov    %eax,%ecx
+  80096e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800971:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800974:	8b 45 14             	mov    0x14(%ebp),%eax
+  800977:	8d 40 04             	lea    0x4(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097d:	eb b0                	jmp    80092f <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80097f:	83 f9 01             	cmp    $0x1,%ecx
+  800982:	7f 1e                	jg     8009a2 <vprintfmt+0x30f>
+	else if (lflag)
+  800984:	85 c9                	test   %ecx,%ecx
+  800986:	74 32                	je     8009ba <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098b:	8b 10                	mov    (%eax),%edx
+  80098d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800992:	8d 40 04             	lea    0x4(%eax),%eax
+  800995:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800998:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80099d:	e9 a3 00 00 00       	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8009a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a5:	8b 10                	mov    (%eax),%edx
+  8009a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009b5:	e9 8b 00 00 00       	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8009ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bd:	8b 10                	mov    (%eax),%edx
+  8009bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8009cf:	eb 74                	jmp    800a45 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8009d1:	83 f9 01             	cmp    $0x1,%ecx
+  8009d4:	7f 1b                	jg     8009f1 <vprintfmt+0x35e>
+	else if (lflag)
+  8009d6:	85 c9                	test   %ecx,%ecx
+  8009d8:	74 2c                	je     800a06 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8009da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009dd:	8b 10                	mov    (%eax),%edx
+  8009df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ea:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8009ef:	eb 54                	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 10                	mov    (%eax),%edx
+  8009f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8009fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ff:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a04:	eb 3f                	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a09:	8b 10                	mov    (%eax),%edx
+  800a0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a10:	8d 40 04             	lea    0x4(%eax),%eax
+  800a13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a16:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a1b:	eb 28                	jmp    800a45 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800a1d:	83 ec 08             	sub    $0x8,%esp
+  800a20:	53                   	push   %ebx
+  800a21:	6a 30                	push   $0x30
+  800a23:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a25:	83 c4 08             	add    $0x8,%esp
+  800a28:	53                   	push   %ebx
+  800a29:	6a 78                	push   $0x78
+  800a2b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a30:	8b 10                	mov    (%eax),%edx
+  800a32:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a37:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a40:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a45:	83 ec 0c             	sub    $0xc,%esp
+  800a48:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a4c:	50                   	push   %eax
+  800a4d:	ff 75 e0             	push   -0x20(%ebp)
+  800a50:	57                   	push   %edi
+  800a51:	51                   	push   %ecx
+  800a52:	52                   	push   %edx
+  800a53:	89 da                	mov    %ebx,%edx
+  800a55:	89 f0                	mov    %esi,%eax
+  800a57:	e8 54 fb ff ff       	call   8005b0 <printnum>
+			break;
+  800a5c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a5f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800a62:	e9 4a fc ff ff       	jmp    8006b1 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a67:	83 f9 01             	cmp    $0x1,%ecx
+  800a6a:	7f 1b                	jg     800a87 <vprintfmt+0x3f4>
+	else if (lflag)
+  800a6c:	85 c9                	test   %ecx,%ecx
+  800a6e:	74 2c                	je     800a9c <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800a70:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a73:	8b 10                	mov    (%eax),%edx
+  800a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a80:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a85:	eb be                	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a87:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8a:	8b 10                	mov    (%eax),%edx
+  800a8c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a8f:	8d 40 08             	lea    0x8(%eax),%eax
+  800a92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a95:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a9a:	eb a9                	jmp    800a45 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9f:	8b 10                	mov    (%eax),%edx
+  800aa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa6:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ab1:	eb 92                	jmp    800a45 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800ab3:	83 ec 08             	sub    $0x8,%esp
+  800ab6:	53                   	push   %ebx
+  800ab7:	6a 25                	push   $0x25
+  800ab9:	ff d6                	call   *%esi
+			break;
+  800abb:	83 c4 10             	add    $0x10,%esp
+  800abe:	eb 9f                	jmp    800a5f <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800ac0:	83 ec 08             	sub    $0x8,%esp
+  800ac3:	53                   	push   %ebx
+  800ac4:	6a 25                	push   $0x25
+  800ac6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ac8:	83 c4 10             	add    $0x10,%esp
+  800acb:	89 f8                	mov    %edi,%eax
+  800acd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ad1:	74 05                	je     800ad8 <vprintfmt+0x445>
+  800ad3:	83 e8 01             	sub    $0x1,%eax
+  800ad6:	eb f5                	jmp    800acd <vprintfmt+0x43a>
+  800ad8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800adb:	eb 82                	jmp    800a5f <vprintfmt+0x3cc>
+
+00800add <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	83 ec 18             	sub    $0x18,%esp
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ae9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800aec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800af0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800af3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800afa:	85 c0                	test   %eax,%eax
+  800afc:	74 26                	je     800b24 <vsnprintf+0x47>
+  800afe:	85 d2                	test   %edx,%edx
+  800b00:	7e 22                	jle    800b24 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b02:	ff 75 14             	push   0x14(%ebp)
+  800b05:	ff 75 10             	push   0x10(%ebp)
+  800b08:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b0b:	50                   	push   %eax
+  800b0c:	68 59 06 80 00       	push   $0x800659
+  800b11:	e8 7d fb ff ff       	call   800693 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b16:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b19:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1f:	83 c4 10             	add    $0x10,%esp
+}
+  800b22:	c9                   	leave
+  800b23:	c3                   	ret
+		return -E_INVAL;
+  800b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b29:	eb f7                	jmp    800b22 <vsnprintf+0x45>
+
+00800b2b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b31:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b34:	50                   	push   %eax
+  800b35:	ff 75 10             	push   0x10(%ebp)
+  800b38:	ff 75 0c             	push   0xc(%ebp)
+  800b3b:	ff 75 08             	push   0x8(%ebp)
+  800b3e:	e8 9a ff ff ff       	call   800add <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+
+00800b45 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b50:	eb 03                	jmp    800b55 <strlen+0x10>
+		n++;
+  800b52:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b55:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b59:	75 f7                	jne    800b52 <strlen+0xd>
+	return n;
+}
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+
+00800b5d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6b:	eb 03                	jmp    800b70 <strnlen+0x13>
+		n++;
+  800b6d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b70:	39 d0                	cmp    %edx,%eax
+  800b72:	74 08                	je     800b7c <strnlen+0x1f>
+  800b74:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b78:	75 f3                	jne    800b6d <strnlen+0x10>
+  800b7a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b7c:	89 d0                	mov    %edx,%eax
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	53                   	push   %ebx
+  800b84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b93:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b96:	83 c0 01             	add    $0x1,%eax
+  800b99:	84 d2                	test   %dl,%dl
+  800b9b:	75 f2                	jne    800b8f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b9d:	89 c8                	mov    %ecx,%eax
+  800b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+
+00800ba4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	53                   	push   %ebx
+  800ba8:	83 ec 10             	sub    $0x10,%esp
+  800bab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bae:	53                   	push   %ebx
+  800baf:	e8 91 ff ff ff       	call   800b45 <strlen>
+  800bb4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bb7:	ff 75 0c             	push   0xc(%ebp)
+  800bba:	01 d8                	add    %ebx,%eax
+  800bbc:	50                   	push   %eax
+  800bbd:	e8 be ff ff ff       	call   800b80 <strcpy>
+	return dst;
+}
+  800bc2:	89 d8                	mov    %ebx,%eax
+  800bc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc7:	c9                   	leave
+  800bc8:	c3                   	ret
+
+00800bc9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	56                   	push   %esi
+  800bcd:	53                   	push   %ebx
+  800bce:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bd4:	89 f3                	mov    %esi,%ebx
+  800bd6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bd9:	89 f0                	mov    %esi,%eax
+  800bdb:	eb 0f                	jmp    800bec <strncpy+0x23>
+		*dst++ = *src;
+  800bdd:	83 c0 01             	add    $0x1,%eax
+  800be0:	0f b6 0a             	movzbl (%edx),%ecx
+  800be3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800be6:	80 f9 01             	cmp    $0x1,%cl
+  800be9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bec:	39 d8                	cmp    %ebx,%eax
+  800bee:	75 ed                	jne    800bdd <strncpy+0x14>
+	}
+	return ret;
+}
+  800bf0:	89 f0                	mov    %esi,%eax
+  800bf2:	5b                   	pop    %ebx
+  800bf3:	5e                   	pop    %esi
+  800bf4:	5d                   	pop    %ebp
+  800bf5:	c3                   	ret
+
+00800bf6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+  800bfb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c01:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c04:	89 f0                	mov    %esi,%eax
+  800c06:	85 d2                	test   %edx,%edx
+  800c08:	74 21                	je     800c2b <strlcpy+0x35>
+  800c0a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c0e:	89 f2                	mov    %esi,%edx
+  800c10:	eb 09                	jmp    800c1b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c12:	83 c1 01             	add    $0x1,%ecx
+  800c15:	83 c2 01             	add    $0x1,%edx
+  800c18:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c1b:	39 c2                	cmp    %eax,%edx
+  800c1d:	74 09                	je     800c28 <strlcpy+0x32>
+  800c1f:	0f b6 19             	movzbl (%ecx),%ebx
+  800c22:	84 db                	test   %bl,%bl
+  800c24:	75 ec                	jne    800c12 <strlcpy+0x1c>
+  800c26:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c28:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c2b:	29 f0                	sub    %esi,%eax
+}
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+
+00800c31 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c3a:	eb 06                	jmp    800c42 <strcmp+0x11>
+		p++, q++;
+  800c3c:	83 c1 01             	add    $0x1,%ecx
+  800c3f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c42:	0f b6 01             	movzbl (%ecx),%eax
+  800c45:	84 c0                	test   %al,%al
+  800c47:	74 04                	je     800c4d <strcmp+0x1c>
+  800c49:	3a 02                	cmp    (%edx),%al
+  800c4b:	74 ef                	je     800c3c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c4d:	0f b6 c0             	movzbl %al,%eax
+  800c50:	0f b6 12             	movzbl (%edx),%edx
+  800c53:	29 d0                	sub    %edx,%eax
+}
+  800c55:	5d                   	pop    %ebp
+  800c56:	c3                   	ret
+
+00800c57 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c57:	55                   	push   %ebp
+  800c58:	89 e5                	mov    %esp,%ebp
+  800c5a:	53                   	push   %ebx
+  800c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c61:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c64:	eb 09                	jmp    800c6f <strncmp+0x18>
+		n--, p++, q++;
+  800c66:	83 ea 01             	sub    $0x1,%edx
+  800c69:	83 c0 01             	add    $0x1,%eax
+  800c6c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c6f:	85 d2                	test   %edx,%edx
+  800c71:	74 18                	je     800c8b <strncmp+0x34>
+  800c73:	0f b6 18             	movzbl (%eax),%ebx
+  800c76:	84 db                	test   %bl,%bl
+  800c78:	74 04                	je     800c7e <strncmp+0x27>
+  800c7a:	3a 19                	cmp    (%ecx),%bl
+  800c7c:	74 e8                	je     800c66 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c7e:	0f b6 00             	movzbl (%eax),%eax
+  800c81:	0f b6 11             	movzbl (%ecx),%edx
+  800c84:	29 d0                	sub    %edx,%eax
+}
+  800c86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c89:	c9                   	leave
+  800c8a:	c3                   	ret
+		return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c90:	eb f4                	jmp    800c86 <strncmp+0x2f>
+
+00800c92 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c98:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c9c:	eb 03                	jmp    800ca1 <strchr+0xf>
+  800c9e:	83 c0 01             	add    $0x1,%eax
+  800ca1:	0f b6 10             	movzbl (%eax),%edx
+  800ca4:	84 d2                	test   %dl,%dl
+  800ca6:	74 06                	je     800cae <strchr+0x1c>
+		if (*s == c)
+  800ca8:	38 ca                	cmp    %cl,%dl
+  800caa:	75 f2                	jne    800c9e <strchr+0xc>
+  800cac:	eb 05                	jmp    800cb3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cbf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cc2:	38 ca                	cmp    %cl,%dl
+  800cc4:	74 09                	je     800ccf <strfind+0x1a>
+  800cc6:	84 d2                	test   %dl,%dl
+  800cc8:	74 05                	je     800ccf <strfind+0x1a>
+	for (; *s; s++)
+  800cca:	83 c0 01             	add    $0x1,%eax
+  800ccd:	eb f0                	jmp    800cbf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cd8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cdb:	85 c9                	test   %ecx,%ecx
+  800cdd:	74 20                	je     800cff <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cdf:	89 f8                	mov    %edi,%eax
+  800ce1:	09 c8                	or     %ecx,%eax
+  800ce3:	a8 03                	test   $0x3,%al
+  800ce5:	75 12                	jne    800cf9 <memset+0x28>
+		c &= 0xFF;
+  800ce7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ceb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cf1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cf4:	fc                   	cld
+  800cf5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cf7:	eb 06                	jmp    800cff <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cf9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cfc:	fc                   	cld
+  800cfd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cff:	89 f8                	mov    %edi,%eax
+  800d01:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d04:	c9                   	leave
+  800d05:	c3                   	ret
+
+00800d06 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d11:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d14:	39 c6                	cmp    %eax,%esi
+  800d16:	73 32                	jae    800d4a <memmove+0x44>
+  800d18:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d1b:	39 d0                	cmp    %edx,%eax
+  800d1d:	73 2b                	jae    800d4a <memmove+0x44>
+		s += n;
+		d += n;
+  800d1f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d22:	89 d6                	mov    %edx,%esi
+  800d24:	09 fe                	or     %edi,%esi
+  800d26:	09 ce                	or     %ecx,%esi
+  800d28:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d2e:	75 0e                	jne    800d3e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d30:	83 ef 04             	sub    $0x4,%edi
+  800d33:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d36:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d39:	fd                   	std
+  800d3a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d3c:	eb 09                	jmp    800d47 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d3e:	83 ef 01             	sub    $0x1,%edi
+  800d41:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d44:	fd                   	std
+  800d45:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d47:	fc                   	cld
+  800d48:	eb 1a                	jmp    800d64 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d4a:	89 f2                	mov    %esi,%edx
+  800d4c:	09 c2                	or     %eax,%edx
+  800d4e:	09 ca                	or     %ecx,%edx
+  800d50:	f6 c2 03             	test   $0x3,%dl
+  800d53:	75 0a                	jne    800d5f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d55:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d58:	89 c7                	mov    %eax,%edi
+  800d5a:	fc                   	cld
+  800d5b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d5d:	eb 05                	jmp    800d64 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d5f:	89 c7                	mov    %eax,%edi
+  800d61:	fc                   	cld
+  800d62:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+
+00800d68 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d6e:	ff 75 10             	push   0x10(%ebp)
+  800d71:	ff 75 0c             	push   0xc(%ebp)
+  800d74:	ff 75 08             	push   0x8(%ebp)
+  800d77:	e8 8a ff ff ff       	call   800d06 <memmove>
+}
+  800d7c:	c9                   	leave
+  800d7d:	c3                   	ret
+
+00800d7e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+  800d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d86:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d89:	89 c6                	mov    %eax,%esi
+  800d8b:	03 75 10             	add    0x10(%ebp),%esi
+  800d8e:	eb 06                	jmp    800d96 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d90:	83 c0 01             	add    $0x1,%eax
+  800d93:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d96:	39 f0                	cmp    %esi,%eax
+  800d98:	74 14                	je     800dae <memcmp+0x30>
+		if (*s1 != *s2)
+  800d9a:	0f b6 08             	movzbl (%eax),%ecx
+  800d9d:	0f b6 1a             	movzbl (%edx),%ebx
+  800da0:	38 d9                	cmp    %bl,%cl
+  800da2:	74 ec                	je     800d90 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800da4:	0f b6 c1             	movzbl %cl,%eax
+  800da7:	0f b6 db             	movzbl %bl,%ebx
+  800daa:	29 d8                	sub    %ebx,%eax
+  800dac:	eb 05                	jmp    800db3 <memcmp+0x35>
+	}
+
+	return 0;
+  800dae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dc0:	89 c2                	mov    %eax,%edx
+  800dc2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dc5:	eb 03                	jmp    800dca <memfind+0x13>
+  800dc7:	83 c0 01             	add    $0x1,%eax
+  800dca:	39 d0                	cmp    %edx,%eax
+  800dcc:	73 04                	jae    800dd2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dce:	38 08                	cmp    %cl,(%eax)
+  800dd0:	75 f5                	jne    800dc7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+
+00800dd4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	57                   	push   %edi
+  800dd8:	56                   	push   %esi
+  800dd9:	53                   	push   %ebx
+  800dda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800de0:	eb 03                	jmp    800de5 <strtol+0x11>
+		s++;
+  800de2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800de5:	0f b6 02             	movzbl (%edx),%eax
+  800de8:	3c 20                	cmp    $0x20,%al
+  800dea:	74 f6                	je     800de2 <strtol+0xe>
+  800dec:	3c 09                	cmp    $0x9,%al
+  800dee:	74 f2                	je     800de2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800df0:	3c 2b                	cmp    $0x2b,%al
+  800df2:	74 2a                	je     800e1e <strtol+0x4a>
+	int neg = 0;
+  800df4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800df9:	3c 2d                	cmp    $0x2d,%al
+  800dfb:	74 2b                	je     800e28 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dfd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e03:	75 0f                	jne    800e14 <strtol+0x40>
+  800e05:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e08:	74 28                	je     800e32 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e0a:	85 db                	test   %ebx,%ebx
+  800e0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e11:	0f 44 d8             	cmove  %eax,%ebx
+  800e14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e19:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e1c:	eb 46                	jmp    800e64 <strtol+0x90>
+		s++;
+  800e1e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e26:	eb d5                	jmp    800dfd <strtol+0x29>
+		s++, neg = 1;
+  800e28:	83 c2 01             	add    $0x1,%edx
+  800e2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e30:	eb cb                	jmp    800dfd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e32:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e36:	74 0e                	je     800e46 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e38:	85 db                	test   %ebx,%ebx
+  800e3a:	75 d8                	jne    800e14 <strtol+0x40>
+		s++, base = 8;
+  800e3c:	83 c2 01             	add    $0x1,%edx
+  800e3f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e44:	eb ce                	jmp    800e14 <strtol+0x40>
+		s += 2, base = 16;
+  800e46:	83 c2 02             	add    $0x2,%edx
+  800e49:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e4e:	eb c4                	jmp    800e14 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e50:	0f be c0             	movsbl %al,%eax
+  800e53:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e56:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e59:	7d 3a                	jge    800e95 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e5b:	83 c2 01             	add    $0x1,%edx
+  800e5e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e62:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e64:	0f b6 02             	movzbl (%edx),%eax
+  800e67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e6a:	89 f3                	mov    %esi,%ebx
+  800e6c:	80 fb 09             	cmp    $0x9,%bl
+  800e6f:	76 df                	jbe    800e50 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e71:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e74:	89 f3                	mov    %esi,%ebx
+  800e76:	80 fb 19             	cmp    $0x19,%bl
+  800e79:	77 08                	ja     800e83 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e7b:	0f be c0             	movsbl %al,%eax
+  800e7e:	83 e8 57             	sub    $0x57,%eax
+  800e81:	eb d3                	jmp    800e56 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e83:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e86:	89 f3                	mov    %esi,%ebx
+  800e88:	80 fb 19             	cmp    $0x19,%bl
+  800e8b:	77 08                	ja     800e95 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e8d:	0f be c0             	movsbl %al,%eax
+  800e90:	83 e8 37             	sub    $0x37,%eax
+  800e93:	eb c1                	jmp    800e56 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e99:	74 05                	je     800ea0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800e9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e9e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ea0:	89 c8                	mov    %ecx,%eax
+  800ea2:	f7 d8                	neg    %eax
+  800ea4:	85 ff                	test   %edi,%edi
+  800ea6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ea9:	89 c8                	mov    %ecx,%eax
+  800eab:	5b                   	pop    %ebx
+  800eac:	5e                   	pop    %esi
+  800ead:	5f                   	pop    %edi
+  800eae:	5d                   	pop    %ebp
+  800eaf:	c3                   	ret
+
+00800eb0 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800eb6:	6a 00                	push   $0x0
+  800eb8:	6a 00                	push   $0x0
+  800eba:	ff 75 08             	push   0x8(%ebp)
+  800ebd:	e8 12 ff ff ff       	call   800dd4 <strtol>
+}
+  800ec2:	c9                   	leave
+  800ec3:	c3                   	ret
+
+00800ec4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed4:	89 c3                	mov    %eax,%ebx
+  800ed6:	89 c7                	mov    %eax,%edi
+  800ed8:	6a 00                	push   $0x0
+  800eda:	55                   	push   %ebp
+  800edb:	56                   	push   %esi
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	8d 35 e6 0e 80 00    	lea    0x800ee6,%esi
+  800ee4:	0f 34                	sysenter
+
+00800ee6 <after_sysenter_label_47>:
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+
+00800eef <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800efe:	89 d1                	mov    %edx,%ecx
+  800f00:	89 d3                	mov    %edx,%ebx
+  800f02:	89 d7                	mov    %edx,%edi
+  800f04:	6a 00                	push   $0x0
+  800f06:	55                   	push   %ebp
+  800f07:	56                   	push   %esi
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	8d 35 12 0f 80 00    	lea    0x800f12,%esi
+  800f10:	0f 34                	sysenter
+
+00800f12 <after_sysenter_label_128>:
+  800f12:	5e                   	pop    %esi
+  800f13:	5d                   	pop    %ebp
+  800f14:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f17:	5b                   	pop    %ebx
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f28:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f2d:	89 cb                	mov    %ecx,%ebx
+  800f2f:	89 cf                	mov    %ecx,%edi
+  800f31:	6a 00                	push   $0x0
+  800f33:	55                   	push   %ebp
+  800f34:	56                   	push   %esi
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	8d 35 3f 0f 80 00    	lea    0x800f3f,%esi
+  800f3d:	0f 34                	sysenter
+
+00800f3f <after_sysenter_label_212>:
+  800f3f:	5e                   	pop    %esi
+  800f40:	5d                   	pop    %ebp
+  800f41:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	7f 07                	jg     800f4f <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+  800f52:	50                   	push   %eax
+  800f53:	6a 03                	push   $0x3
+  800f55:	68 b5 4f 80 00       	push   $0x804fb5
+  800f5a:	6a 54                	push   $0x54
+  800f5c:	68 d2 4f 80 00       	push   $0x804fd2
+  800f61:	e8 5b f5 ff ff       	call   8004c1 <_panic>
+
+00800f66 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	57                   	push   %edi
+  800f6a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f70:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f75:	89 d1                	mov    %edx,%ecx
+  800f77:	89 d3                	mov    %edx,%ebx
+  800f79:	89 d7                	mov    %edx,%edi
+  800f7b:	6a 00                	push   $0x0
+  800f7d:	55                   	push   %ebp
+  800f7e:	56                   	push   %esi
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	8d 35 89 0f 80 00    	lea    0x800f89,%esi
+  800f87:	0f 34                	sysenter
+
+00800f89 <after_sysenter_label_309>:
+  800f89:	5e                   	pop    %esi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fa1:	89 d1                	mov    %edx,%ecx
+  800fa3:	89 d3                	mov    %edx,%ebx
+  800fa5:	89 d7                	mov    %edx,%edi
+  800fa7:	6a 00                	push   $0x0
+  800fa9:	55                   	push   %ebp
+  800faa:	56                   	push   %esi
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	8d 35 b5 0f 80 00    	lea    0x800fb5,%esi
+  800fb3:	0f 34                	sysenter
+
+00800fb5 <after_sysenter_label_391>:
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd6:	6a 00                	push   $0x0
+  800fd8:	55                   	push   %ebp
+  800fd9:	56                   	push   %esi
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	8d 35 e4 0f 80 00    	lea    0x800fe4,%esi
+  800fe2:	0f 34                	sysenter
+
+00800fe4 <after_sysenter_label_479>:
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5d                   	pop    %ebp
+  800fe6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fe9:	85 c0                	test   %eax,%eax
+  800feb:	7f 07                	jg     800ff4 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5f                   	pop    %edi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+  800ff7:	50                   	push   %eax
+  800ff8:	6a 04                	push   $0x4
+  800ffa:	68 b5 4f 80 00       	push   $0x804fb5
+  800fff:	6a 54                	push   $0x54
+  801001:	68 d2 4f 80 00       	push   $0x804fd2
+  801006:	e8 b6 f4 ff ff       	call   8004c1 <_panic>
+
+0080100b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	57                   	push   %edi
+  80100f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801010:	8b 55 08             	mov    0x8(%ebp),%edx
+  801013:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801016:	b8 05 00 00 00       	mov    $0x5,%eax
+  80101b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801021:	ff 75 18             	push   0x18(%ebp)
+  801024:	55                   	push   %ebp
+  801025:	56                   	push   %esi
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	8d 35 30 10 80 00    	lea    0x801030,%esi
+  80102e:	0f 34                	sysenter
+
+00801030 <after_sysenter_label_593>:
+  801030:	5e                   	pop    %esi
+  801031:	5d                   	pop    %ebp
+  801032:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801035:	85 c0                	test   %eax,%eax
+  801037:	7f 07                	jg     801040 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801039:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80103c:	5b                   	pop    %ebx
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801040:	83 ec 0c             	sub    $0xc,%esp
+  801043:	50                   	push   %eax
+  801044:	6a 05                	push   $0x5
+  801046:	68 b5 4f 80 00       	push   $0x804fb5
+  80104b:	6a 54                	push   $0x54
+  80104d:	68 d2 4f 80 00       	push   $0x804fd2
+  801052:	e8 6a f4 ff ff       	call   8004c1 <_panic>
+
+00801057 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 06 00 00 00       	mov    $0x6,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	6a 00                	push   $0x0
+  801070:	55                   	push   %ebp
+  801071:	56                   	push   %esi
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	8d 35 7c 10 80 00    	lea    0x80107c,%esi
+  80107a:	0f 34                	sysenter
+
+0080107c <after_sysenter_label_704>:
+  80107c:	5e                   	pop    %esi
+  80107d:	5d                   	pop    %ebp
+  80107e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801081:	85 c0                	test   %eax,%eax
+  801083:	7f 07                	jg     80108c <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801085:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801088:	5b                   	pop    %ebx
+  801089:	5f                   	pop    %edi
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+  80108f:	50                   	push   %eax
+  801090:	6a 06                	push   $0x6
+  801092:	68 b5 4f 80 00       	push   $0x804fb5
+  801097:	6a 54                	push   $0x54
+  801099:	68 d2 4f 80 00       	push   $0x804fd2
+  80109e:	e8 1e f4 ff ff       	call   8004c1 <_panic>
+
+008010a3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010b8:	89 df                	mov    %ebx,%edi
+  8010ba:	6a 00                	push   $0x0
+  8010bc:	55                   	push   %ebp
+  8010bd:	56                   	push   %esi
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	8d 35 c8 10 80 00    	lea    0x8010c8,%esi
+  8010c6:	0f 34                	sysenter
+
+008010c8 <after_sysenter_label_808>:
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	7f 07                	jg     8010d8 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	50                   	push   %eax
+  8010dc:	6a 08                	push   $0x8
+  8010de:	68 b5 4f 80 00       	push   $0x804fb5
+  8010e3:	6a 54                	push   $0x54
+  8010e5:	68 d2 4f 80 00       	push   $0x804fd2
+  8010ea:	e8 d2 f3 ff ff       	call   8004c1 <_panic>
+
+008010ef <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ff:	b8 09 00 00 00       	mov    $0x9,%eax
+  801104:	89 df                	mov    %ebx,%edi
+  801106:	6a 00                	push   $0x0
+  801108:	55                   	push   %ebp
+  801109:	56                   	push   %esi
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8d 35 14 11 80 00    	lea    0x801114,%esi
+  801112:	0f 34                	sysenter
+
+00801114 <after_sysenter_label_912>:
+  801114:	5e                   	pop    %esi
+  801115:	5d                   	pop    %ebp
+  801116:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 07                	jg     801124 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80111d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  801127:	50                   	push   %eax
+  801128:	6a 09                	push   $0x9
+  80112a:	68 b5 4f 80 00       	push   $0x804fb5
+  80112f:	6a 54                	push   $0x54
+  801131:	68 d2 4f 80 00       	push   $0x804fd2
+  801136:	e8 86 f3 ff ff       	call   8004c1 <_panic>
+
+0080113b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801140:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801145:	8b 55 08             	mov    0x8(%ebp),%edx
+  801148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801150:	89 df                	mov    %ebx,%edi
+  801152:	6a 00                	push   $0x0
+  801154:	55                   	push   %ebp
+  801155:	56                   	push   %esi
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	8d 35 60 11 80 00    	lea    0x801160,%esi
+  80115e:	0f 34                	sysenter
+
+00801160 <after_sysenter_label_1016>:
+  801160:	5e                   	pop    %esi
+  801161:	5d                   	pop    %ebp
+  801162:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801165:	85 c0                	test   %eax,%eax
+  801167:	7f 07                	jg     801170 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801169:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116c:	5b                   	pop    %ebx
+  80116d:	5f                   	pop    %edi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801170:	83 ec 0c             	sub    $0xc,%esp
+  801173:	50                   	push   %eax
+  801174:	6a 0a                	push   $0xa
+  801176:	68 b5 4f 80 00       	push   $0x804fb5
+  80117b:	6a 54                	push   $0x54
+  80117d:	68 d2 4f 80 00       	push   $0x804fd2
+  801182:	e8 3a f3 ff ff       	call   8004c1 <_panic>
+
+00801187 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801197:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119d:	6a 00                	push   $0x0
+  80119f:	55                   	push   %ebp
+  8011a0:	56                   	push   %esi
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	8d 35 ab 11 80 00    	lea    0x8011ab,%esi
+  8011a9:	0f 34                	sysenter
+
+008011ab <after_sysenter_label_1126>:
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5d                   	pop    %ebp
+  8011ad:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011b0:	5b                   	pop    %ebx
+  8011b1:	5f                   	pop    %edi
+  8011b2:	5d                   	pop    %ebp
+  8011b3:	c3                   	ret
+
+008011b4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c6:	89 cb                	mov    %ecx,%ebx
+  8011c8:	89 cf                	mov    %ecx,%edi
+  8011ca:	6a 00                	push   $0x0
+  8011cc:	55                   	push   %ebp
+  8011cd:	56                   	push   %esi
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	8d 35 d8 11 80 00    	lea    0x8011d8,%esi
+  8011d6:	0f 34                	sysenter
+
+008011d8 <after_sysenter_label_1210>:
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	7f 07                	jg     8011e8 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5f                   	pop    %edi
+  8011e6:	5d                   	pop    %ebp
+  8011e7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e8:	83 ec 0c             	sub    $0xc,%esp
+  8011eb:	50                   	push   %eax
+  8011ec:	6a 0d                	push   $0xd
+  8011ee:	68 b5 4f 80 00       	push   $0x804fb5
+  8011f3:	6a 54                	push   $0x54
+  8011f5:	68 d2 4f 80 00       	push   $0x804fd2
+  8011fa:	e8 c2 f2 ff ff       	call   8004c1 <_panic>
+
+008011ff <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801204:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 42 00 00 00       	mov    $0x42,%eax
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	6a 00                	push   $0x0
+  801218:	55                   	push   %ebp
+  801219:	56                   	push   %esi
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	8d 35 24 12 80 00    	lea    0x801224,%esi
+  801222:	0f 34                	sysenter
+
+00801224 <after_sysenter_label_1311>:
+  801224:	5e                   	pop    %esi
+  801225:	5d                   	pop    %ebp
+  801226:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801229:	85 c0                	test   %eax,%eax
+  80122b:	7f 07                	jg     801234 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80122d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5f                   	pop    %edi
+  801232:	5d                   	pop    %ebp
+  801233:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801234:	83 ec 0c             	sub    $0xc,%esp
+  801237:	50                   	push   %eax
+  801238:	6a 42                	push   $0x42
+  80123a:	68 b5 4f 80 00       	push   $0x804fb5
+  80123f:	6a 54                	push   $0x54
+  801241:	68 d2 4f 80 00       	push   $0x804fd2
+  801246:	e8 76 f2 ff ff       	call   8004c1 <_panic>
+
+0080124b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801250:	ba 00 00 00 00       	mov    $0x0,%edx
+  801255:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80125a:	89 d1                	mov    %edx,%ecx
+  80125c:	89 d3                	mov    %edx,%ebx
+  80125e:	89 d7                	mov    %edx,%edi
+  801260:	6a 00                	push   $0x0
+  801262:	55                   	push   %ebp
+  801263:	56                   	push   %esi
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	8d 35 6e 12 80 00    	lea    0x80126e,%esi
+  80126c:	0f 34                	sysenter
+
+0080126e <after_sysenter_label_1411>:
+  80126e:	5e                   	pop    %esi
+  80126f:	5d                   	pop    %ebp
+  801270:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801273:	5b                   	pop    %ebx
+  801274:	5f                   	pop    %edi
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+
+00801277 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80127c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80128c:	89 df                	mov    %ebx,%edi
+  80128e:	6a 00                	push   $0x0
+  801290:	55                   	push   %ebp
+  801291:	56                   	push   %esi
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	8d 35 9c 12 80 00    	lea    0x80129c,%esi
+  80129a:	0f 34                	sysenter
+
+0080129c <after_sysenter_label_1497>:
+  80129c:	5e                   	pop    %esi
+  80129d:	5d                   	pop    %ebp
+  80129e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+
+008012a5 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012ba:	89 df                	mov    %ebx,%edi
+  8012bc:	6a 00                	push   $0x0
+  8012be:	55                   	push   %ebp
+  8012bf:	56                   	push   %esi
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+
+008012ca <after_sysenter_label_1583>:
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	55                   	push   %ebp
+  8012ee:	56                   	push   %esi
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	8d 35 f9 12 80 00    	lea    0x8012f9,%esi
+  8012f7:	0f 34                	sysenter
+
+008012f9 <after_sysenter_label_1672>:
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	b8 12 00 00 00       	mov    $0x12,%eax
+  801317:	89 df                	mov    %ebx,%edi
+  801319:	6a 00                	push   $0x0
+  80131b:	55                   	push   %ebp
+  80131c:	56                   	push   %esi
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8d 35 27 13 80 00    	lea    0x801327,%esi
+  801325:	0f 34                	sysenter
+
+00801327 <after_sysenter_label_1758>:
+  801327:	5e                   	pop    %esi
+  801328:	5d                   	pop    %ebp
+  801329:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801342:	89 cb                	mov    %ecx,%ebx
+  801344:	89 cf                	mov    %ecx,%edi
+  801346:	6a 00                	push   $0x0
+  801348:	55                   	push   %ebp
+  801349:	56                   	push   %esi
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	8d 35 54 13 80 00    	lea    0x801354,%esi
+  801352:	0f 34                	sysenter
+
+00801354 <after_sysenter_label_1842>:
+  801354:	5e                   	pop    %esi
+  801355:	5d                   	pop    %ebp
+  801356:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	7f 07                	jg     801364 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80135d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801360:	5b                   	pop    %ebx
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	50                   	push   %eax
+  801368:	6a 13                	push   $0x13
+  80136a:	68 b5 4f 80 00       	push   $0x804fb5
+  80136f:	6a 54                	push   $0x54
+  801371:	68 d2 4f 80 00       	push   $0x804fd2
+  801376:	e8 46 f1 ff ff       	call   8004c1 <_panic>
+
+0080137b <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801380:	ba 00 00 00 00       	mov    $0x0,%edx
+  801385:	b8 14 00 00 00       	mov    $0x14,%eax
+  80138a:	89 d1                	mov    %edx,%ecx
+  80138c:	89 d3                	mov    %edx,%ebx
+  80138e:	89 d7                	mov    %edx,%edi
+  801390:	6a 00                	push   $0x0
+  801392:	55                   	push   %ebp
+  801393:	56                   	push   %esi
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	8d 35 9e 13 80 00    	lea    0x80139e,%esi
+  80139c:	0f 34                	sysenter
+
+0080139e <after_sysenter_label_1939>:
+  80139e:	5e                   	pop    %esi
+  80139f:	5d                   	pop    %ebp
+  8013a0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+
+008013a7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013bf:	6a 00                	push   $0x0
+  8013c1:	55                   	push   %ebp
+  8013c2:	56                   	push   %esi
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	8d 35 cd 13 80 00    	lea    0x8013cd,%esi
+  8013cb:	0f 34                	sysenter
+
+008013cd <after_sysenter_label_2028>:
+  8013cd:	5e                   	pop    %esi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5f                   	pop    %edi
+  8013d4:	5d                   	pop    %ebp
+  8013d5:	c3                   	ret
+
+008013d6 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	57                   	push   %edi
+  8013da:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013eb:	89 df                	mov    %ebx,%edi
+  8013ed:	6a 00                	push   $0x0
+  8013ef:	55                   	push   %ebp
+  8013f0:	56                   	push   %esi
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	8d 35 fb 13 80 00    	lea    0x8013fb,%esi
+  8013f9:	0f 34                	sysenter
+
+008013fb <after_sysenter_label_2114>:
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5d                   	pop    %ebp
+  8013fd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801400:	5b                   	pop    %ebx
+  801401:	5f                   	pop    %edi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+
+00801404 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	57                   	push   %edi
+  801408:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801411:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801414:	b8 17 00 00 00       	mov    $0x17,%eax
+  801419:	89 df                	mov    %ebx,%edi
+  80141b:	6a 00                	push   $0x0
+  80141d:	55                   	push   %ebp
+  80141e:	56                   	push   %esi
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	8d 35 29 14 80 00    	lea    0x801429,%esi
+  801427:	0f 34                	sysenter
+
+00801429 <after_sysenter_label_2200>:
+  801429:	5e                   	pop    %esi
+  80142a:	5d                   	pop    %ebp
+  80142b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80142e:	5b                   	pop    %ebx
+  80142f:	5f                   	pop    %edi
+  801430:	5d                   	pop    %ebp
+  801431:	c3                   	ret
+
+00801432 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	57                   	push   %edi
+  801436:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801437:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801442:	b8 18 00 00 00       	mov    $0x18,%eax
+  801447:	89 df                	mov    %ebx,%edi
+  801449:	6a 00                	push   $0x0
+  80144b:	55                   	push   %ebp
+  80144c:	56                   	push   %esi
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	8d 35 57 14 80 00    	lea    0x801457,%esi
+  801455:	0f 34                	sysenter
+
+00801457 <after_sysenter_label_2286>:
+  801457:	5e                   	pop    %esi
+  801458:	5d                   	pop    %ebp
+  801459:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80145c:	5b                   	pop    %ebx
+  80145d:	5f                   	pop    %edi
+  80145e:	5d                   	pop    %ebp
+  80145f:	c3                   	ret
+
+00801460 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	57                   	push   %edi
+  801464:	56                   	push   %esi
+  801465:	53                   	push   %ebx
+  801466:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801469:	89 d6                	mov    %edx,%esi
+  80146b:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80146e:	89 cf                	mov    %ecx,%edi
+  801470:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801473:	89 fa                	mov    %edi,%edx
+  801475:	80 ce 08             	or     $0x8,%dh
+  801478:	f6 c5 08             	test   $0x8,%ch
+  80147b:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	50                   	push   %eax
+  801481:	56                   	push   %esi
+  801482:	6a 00                	push   $0x0
+  801484:	e8 82 fb ff ff       	call   80100b <sys_page_map>
+	if (r < 0) {
+  801489:	83 c4 20             	add    $0x20,%esp
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	78 27                	js     8014b7 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	6a 00                	push   $0x0
+  801497:	56                   	push   %esi
+  801498:	6a 00                	push   $0x0
+  80149a:	e8 6c fb ff ff       	call   80100b <sys_page_map>
+  80149f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8014a1:	83 c4 20             	add    $0x20,%esp
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	78 24                	js     8014cc <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8014ad:	89 d8                	mov    %ebx,%eax
+  8014af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+  8014b7:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8014b9:	83 ec 08             	sub    $0x8,%esp
+  8014bc:	50                   	push   %eax
+  8014bd:	68 e0 4f 80 00       	push   $0x804fe0
+  8014c2:	e8 d5 f0 ff ff       	call   80059c <cprintf>
+		return r;
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	eb e1                	jmp    8014ad <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8014cc:	83 ec 08             	sub    $0x8,%esp
+  8014cf:	50                   	push   %eax
+  8014d0:	68 10 50 80 00       	push   $0x805010
+  8014d5:	e8 c2 f0 ff ff       	call   80059c <cprintf>
+		return r;
+  8014da:	83 c4 10             	add    $0x10,%esp
+  8014dd:	eb ce                	jmp    8014ad <duppage_cow+0x4d>
+
+008014df <duppage>:
+{
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	53                   	push   %ebx
+  8014e3:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8014e6:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8014e9:	51                   	push   %ecx
+  8014ea:	52                   	push   %edx
+  8014eb:	50                   	push   %eax
+  8014ec:	52                   	push   %edx
+  8014ed:	6a 00                	push   $0x0
+  8014ef:	e8 17 fb ff ff       	call   80100b <sys_page_map>
+	if (r < 0) {
+  8014f4:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8014fc:	85 c0                	test   %eax,%eax
+  8014fe:	78 07                	js     801507 <duppage+0x28>
+}
+  801500:	89 d8                	mov    %ebx,%eax
+  801502:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801505:	c9                   	leave
+  801506:	c3                   	ret
+  801507:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	50                   	push   %eax
+  80150d:	68 e0 4f 80 00       	push   $0x804fe0
+  801512:	e8 85 f0 ff ff       	call   80059c <cprintf>
+		return r;
+  801517:	83 c4 10             	add    $0x10,%esp
+  80151a:	eb e4                	jmp    801500 <duppage+0x21>
+
+0080151c <cow_copy>:
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	56                   	push   %esi
+  801520:	53                   	push   %ebx
+  801521:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801523:	83 ec 04             	sub    $0x4,%esp
+  801526:	6a 07                	push   $0x7
+  801528:	68 00 f0 7f 00       	push   $0x7ff000
+  80152d:	6a 00                	push   $0x0
+  80152f:	e8 8a fa ff ff       	call   800fbe <sys_page_alloc>
+	if (r < 0) {
+  801534:	83 c4 10             	add    $0x10,%esp
+  801537:	85 c0                	test   %eax,%eax
+  801539:	78 58                	js     801593 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80153b:	83 ec 04             	sub    $0x4,%esp
+  80153e:	68 00 10 00 00       	push   $0x1000
+  801543:	56                   	push   %esi
+  801544:	68 00 f0 7f 00       	push   $0x7ff000
+  801549:	e8 b8 f7 ff ff       	call   800d06 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80154e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801555:	56                   	push   %esi
+  801556:	6a 00                	push   $0x0
+  801558:	68 00 f0 7f 00       	push   $0x7ff000
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 a7 fa ff ff       	call   80100b <sys_page_map>
+  801564:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801566:	83 c4 20             	add    $0x20,%esp
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	78 3b                	js     8015a8 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80156d:	83 ec 08             	sub    $0x8,%esp
+  801570:	68 00 f0 7f 00       	push   $0x7ff000
+  801575:	6a 00                	push   $0x0
+  801577:	e8 db fa ff ff       	call   801057 <sys_page_unmap>
+  80157c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	78 45                	js     8015ca <cow_copy+0xae>
+	return 0;
+  801585:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80158a:	89 d8                	mov    %ebx,%eax
+  80158c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158f:	5b                   	pop    %ebx
+  801590:	5e                   	pop    %esi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+  801593:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801595:	83 ec 08             	sub    $0x8,%esp
+  801598:	50                   	push   %eax
+  801599:	68 00 51 80 00       	push   $0x805100
+  80159e:	e8 f9 ef ff ff       	call   80059c <cprintf>
+		return r;
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	eb e2                	jmp    80158a <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+  8015ab:	50                   	push   %eax
+  8015ac:	68 1c 51 80 00       	push   $0x80511c
+  8015b1:	e8 e6 ef ff ff       	call   80059c <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8015b6:	83 c4 08             	add    $0x8,%esp
+  8015b9:	68 00 f0 7f 00       	push   $0x7ff000
+  8015be:	6a 00                	push   $0x0
+  8015c0:	e8 92 fa ff ff       	call   801057 <sys_page_unmap>
+		return r;
+  8015c5:	83 c4 10             	add    $0x10,%esp
+  8015c8:	eb c0                	jmp    80158a <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	50                   	push   %eax
+  8015ce:	68 38 50 80 00       	push   $0x805038
+  8015d3:	e8 c4 ef ff ff       	call   80059c <cprintf>
+		return r;
+  8015d8:	83 c4 10             	add    $0x10,%esp
+  8015db:	eb ad                	jmp    80158a <cow_copy+0x6e>
+
+008015dd <pgfault>:
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	56                   	push   %esi
+  8015e1:	53                   	push   %ebx
+  8015e2:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8015e5:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8015e7:	89 d8                	mov    %ebx,%eax
+  8015e9:	c1 e8 16             	shr    $0x16,%eax
+  8015ec:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8015f3:	89 de                	mov    %ebx,%esi
+  8015f5:	c1 ee 0c             	shr    $0xc,%esi
+  8015f8:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8015ff:	a8 07                	test   $0x7,%al
+  801601:	74 3b                	je     80163e <pgfault+0x61>
+  801603:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801609:	74 33                	je     80163e <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80160b:	83 ec 0c             	sub    $0xc,%esp
+  80160e:	68 00 f0 bf ee       	push   $0xeebff000
+  801613:	e8 cd 26 00 00       	call   803ce5 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801618:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	f6 c4 08             	test   $0x8,%ah
+  801625:	75 30                	jne    801657 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801627:	83 ec 0c             	sub    $0xc,%esp
+  80162a:	68 00 f0 bf ee       	push   $0xeebff000
+  80162f:	e8 1e 27 00 00       	call   803d52 <mutex_unlock>
+}
+  801634:	83 c4 10             	add    $0x10,%esp
+  801637:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5d                   	pop    %ebp
+  80163d:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80163e:	83 ec 08             	sub    $0x8,%esp
+  801641:	ff 72 28             	push   0x28(%edx)
+  801644:	51                   	push   %ecx
+  801645:	50                   	push   %eax
+  801646:	68 5c 50 80 00       	push   $0x80505c
+  80164b:	6a 3f                	push   $0x3f
+  80164d:	68 36 51 80 00       	push   $0x805136
+  801652:	e8 6a ee ff ff       	call   8004c1 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801657:	89 d8                	mov    %ebx,%eax
+  801659:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80165e:	e8 b9 fe ff ff       	call   80151c <cow_copy>
+  801663:	eb c2                	jmp    801627 <pgfault+0x4a>
+
+00801665 <cow_enable>:
+{
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80166b:	68 dd 15 80 00       	push   $0x8015dd
+  801670:	e8 f0 2f 00 00       	call   804665 <set_pgfault_handler>
+}
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	c9                   	leave
+  801679:	c3                   	ret
+
+0080167a <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	57                   	push   %edi
+  80167e:	56                   	push   %esi
+  80167f:	53                   	push   %ebx
+  801680:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801683:	68 dd 15 80 00       	push   $0x8015dd
+  801688:	e8 d8 2f 00 00       	call   804665 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80168d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801692:	cd 30                	int    $0x30
+  801694:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	78 4b                	js     8016e9 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80169e:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8016a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8016ab:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8016af:	0f 85 16 01 00 00    	jne    8017cb <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016b5:	e8 ac f8 ff ff       	call   800f66 <sys_getenvid>
+  8016ba:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016bf:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016c1:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8016c7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8016cd:	77 32                	ja     801701 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016cf:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8016d4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8016d6:	c1 ea 10             	shr    $0x10,%edx
+  8016d9:	74 26                	je     801701 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016db:	c1 e2 10             	shl    $0x10,%edx
+  8016de:	89 d1                	mov    %edx,%ecx
+  8016e0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016e5:	29 ca                	sub    %ecx,%edx
+  8016e7:	eb 1e                	jmp    801707 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+  8016ec:	89 c7                	mov    %eax,%edi
+  8016ee:	50                   	push   %eax
+  8016ef:	68 41 51 80 00       	push   $0x805141
+  8016f4:	e8 a3 ee ff ff       	call   80059c <cprintf>
+		return eid;
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	e9 6c 01 00 00       	jmp    80186d <fork+0x1f3>
+		return pthread_main_tls;
+  801701:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801707:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80170a:	c1 e0 04             	shl    $0x4,%eax
+  80170d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801712:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801714:	e8 15 2d 00 00       	call   80442e <pthread_fork_child>
+		return eid;
+  801719:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80171c:	e9 4c 01 00 00       	jmp    80186d <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801721:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801727:	89 da                	mov    %ebx,%edx
+  801729:	89 f8                	mov    %edi,%eax
+  80172b:	e8 af fd ff ff       	call   8014df <duppage>
+  801730:	85 c0                	test   %eax,%eax
+  801732:	79 28                	jns    80175c <fork+0xe2>
+  801734:	89 c7                	mov    %eax,%edi
+  801736:	e9 32 01 00 00       	jmp    80186d <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80173b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801741:	83 f9 05             	cmp    $0x5,%ecx
+  801744:	75 58                	jne    80179e <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801746:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80174b:	89 da                	mov    %ebx,%edx
+  80174d:	89 f8                	mov    %edi,%eax
+  80174f:	e8 8b fd ff ff       	call   8014df <duppage>
+  801754:	85 c0                	test   %eax,%eax
+  801756:	0f 88 0f 01 00 00    	js     80186b <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80175c:	83 c3 01             	add    $0x1,%ebx
+  80175f:	39 de                	cmp    %ebx,%esi
+  801761:	74 54                	je     8017b7 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801763:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80176a:	f6 c1 05             	test   $0x5,%cl
+  80176d:	74 ed                	je     80175c <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80176f:	f6 c5 04             	test   $0x4,%ch
+  801772:	75 ad                	jne    801721 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801774:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80177a:	74 bf                	je     80173b <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80177c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801782:	74 d8                	je     80175c <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801784:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80178a:	89 da                	mov    %ebx,%edx
+  80178c:	89 f8                	mov    %edi,%eax
+  80178e:	e8 cd fc ff ff       	call   801460 <duppage_cow>
+  801793:	85 c0                	test   %eax,%eax
+  801795:	79 c5                	jns    80175c <fork+0xe2>
+  801797:	89 c7                	mov    %eax,%edi
+  801799:	e9 cf 00 00 00       	jmp    80186d <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80179e:	68 8c 50 80 00       	push   $0x80508c
+  8017a3:	68 51 51 80 00       	push   $0x805151
+  8017a8:	68 c6 00 00 00       	push   $0xc6
+  8017ad:	68 36 51 80 00       	push   $0x805136
+  8017b2:	e8 0a ed ff ff       	call   8004c1 <_panic>
+  8017b7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8017ba:	83 c1 01             	add    $0x1,%ecx
+  8017bd:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8017c3:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8017c9:	74 18                	je     8017e3 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8017cb:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8017d2:	a8 07                	test   $0x7,%al
+  8017d4:	74 e4                	je     8017ba <fork+0x140>
+  8017d6:	89 cb                	mov    %ecx,%ebx
+  8017d8:	c1 e3 0a             	shl    $0xa,%ebx
+  8017db:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8017de:	e9 7c ff ff ff       	jmp    80175f <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8017e3:	83 ec 04             	sub    $0x4,%esp
+  8017e6:	6a 07                	push   $0x7
+  8017e8:	68 00 f0 bf ee       	push   $0xeebff000
+  8017ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8017f0:	e8 c9 f7 ff ff       	call   800fbe <sys_page_alloc>
+  8017f5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017f7:	83 c4 10             	add    $0x10,%esp
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 34                	js     801832 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8017fe:	83 ec 08             	sub    $0x8,%esp
+  801801:	68 a3 46 80 00       	push   $0x8046a3
+  801806:	ff 75 e4             	push   -0x1c(%ebp)
+  801809:	e8 2d f9 ff ff       	call   80113b <sys_env_set_pgfault_upcall>
+  80180e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801810:	83 c4 10             	add    $0x10,%esp
+  801813:	85 c0                	test   %eax,%eax
+  801815:	78 2e                	js     801845 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801817:	83 ec 08             	sub    $0x8,%esp
+  80181a:	6a 02                	push   $0x2
+  80181c:	ff 75 e4             	push   -0x1c(%ebp)
+  80181f:	e8 7f f8 ff ff       	call   8010a3 <sys_env_set_status>
+  801824:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 2b                	js     801858 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80182d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801830:	eb 3b                	jmp    80186d <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	50                   	push   %eax
+  801836:	68 b4 50 80 00       	push   $0x8050b4
+  80183b:	e8 5c ed ff ff       	call   80059c <cprintf>
+		return r;
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	eb 28                	jmp    80186d <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801845:	83 ec 08             	sub    $0x8,%esp
+  801848:	50                   	push   %eax
+  801849:	68 dc 50 80 00       	push   $0x8050dc
+  80184e:	e8 49 ed ff ff       	call   80059c <cprintf>
+		return r;
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	eb 15                	jmp    80186d <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801858:	83 ec 08             	sub    $0x8,%esp
+  80185b:	50                   	push   %eax
+  80185c:	68 66 51 80 00       	push   $0x805166
+  801861:	e8 36 ed ff ff       	call   80059c <cprintf>
+		return r;
+  801866:	83 c4 10             	add    $0x10,%esp
+  801869:	eb 02                	jmp    80186d <fork+0x1f3>
+  80186b:	89 c7                	mov    %eax,%edi
+}
+  80186d:	89 f8                	mov    %edi,%eax
+  80186f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801872:	5b                   	pop    %ebx
+  801873:	5e                   	pop    %esi
+  801874:	5f                   	pop    %edi
+  801875:	5d                   	pop    %ebp
+  801876:	c3                   	ret
+
+00801877 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801877:	55                   	push   %ebp
+  801878:	89 e5                	mov    %esp,%ebp
+  80187a:	57                   	push   %edi
+  80187b:	56                   	push   %esi
+  80187c:	53                   	push   %ebx
+  80187d:	83 ec 2c             	sub    $0x2c,%esp
+  801880:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801882:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801888:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80188d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801893:	77 0a                	ja     80189f <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801895:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80189a:	29 c3                	sub    %eax,%ebx
+  80189c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80189f:	83 ec 0c             	sub    $0xc,%esp
+  8018a2:	68 dd 15 80 00       	push   $0x8015dd
+  8018a7:	e8 b9 2d 00 00       	call   804665 <set_pgfault_handler>
+  8018ac:	b8 07 00 00 00       	mov    $0x7,%eax
+  8018b1:	cd 30                	int    $0x30
+  8018b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 30                	js     8018ed <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8018bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018c1:	74 42                	je     801905 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8018c3:	c1 e3 10             	shl    $0x10,%ebx
+  8018c6:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8018cb:	29 d8                	sub    %ebx,%eax
+  8018cd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8018d0:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8018d5:	29 d8                	sub    %ebx,%eax
+  8018d7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8018da:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8018df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e4:	89 f7                	mov    %esi,%edi
+  8018e6:	89 d6                	mov    %edx,%esi
+  8018e8:	e9 2c 01 00 00       	jmp    801a19 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+  8018f0:	89 c7                	mov    %eax,%edi
+  8018f2:	50                   	push   %eax
+  8018f3:	68 41 51 80 00       	push   $0x805141
+  8018f8:	e8 9f ec ff ff       	call   80059c <cprintf>
+		return eid;
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	e9 d5 00 00 00       	jmp    8019da <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801905:	e8 5c f6 ff ff       	call   800f66 <sys_getenvid>
+  80190a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80190f:	89 c2                	mov    %eax,%edx
+  801911:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801913:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801919:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80191e:	77 18                	ja     801938 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801920:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801925:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801927:	c1 e8 10             	shr    $0x10,%eax
+  80192a:	74 0c                	je     801938 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80192c:	c1 e0 10             	shl    $0x10,%eax
+  80192f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801934:	29 c1                	sub    %eax,%ecx
+  801936:	eb 06                	jmp    80193e <sfork+0xc7>
+		return pthread_main_tls;
+  801938:	8b 0d 40 c1 80 00    	mov    0x80c140,%ecx
+  80193e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801941:	c1 e0 04             	shl    $0x4,%eax
+  801944:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801949:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80194b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80194e:	e9 87 00 00 00       	jmp    8019da <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801953:	f6 c5 04             	test   $0x4,%ch
+  801956:	74 6c                	je     8019c4 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801958:	89 ca                	mov    %ecx,%edx
+  80195a:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801960:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801966:	74 7c                	je     8019e4 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801968:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80196e:	89 da                	mov    %ebx,%edx
+  801970:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801973:	e8 67 fb ff ff       	call   8014df <duppage>
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	0f 88 4f 01 00 00    	js     801acf <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801980:	83 c3 01             	add    $0x1,%ebx
+  801983:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801986:	74 7a                	je     801a02 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801988:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80198a:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801991:	f6 c1 01             	test   $0x1,%cl
+  801994:	74 ea                	je     801980 <sfork+0x109>
+  801996:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80199c:	74 e2                	je     801980 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80199e:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8019a4:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8019a7:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8019ac:	76 a5                	jbe    801953 <sfork+0xdc>
+  8019ae:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8019b4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019b7:	39 fa                	cmp    %edi,%edx
+  8019b9:	73 9d                	jae    801958 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8019bb:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8019be:	39 fa                	cmp    %edi,%edx
+  8019c0:	72 96                	jb     801958 <sfork+0xe1>
+  8019c2:	eb 8f                	jmp    801953 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8019c4:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8019ca:	89 da                	mov    %ebx,%edx
+  8019cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019cf:	e8 8c fa ff ff       	call   801460 <duppage_cow>
+  8019d4:	85 c0                	test   %eax,%eax
+  8019d6:	79 a8                	jns    801980 <sfork+0x109>
+  8019d8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8019da:	89 f8                	mov    %edi,%eax
+  8019dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5f                   	pop    %edi
+  8019e2:	5d                   	pop    %ebp
+  8019e3:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8019e4:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8019e9:	e8 2e fb ff ff       	call   80151c <cow_copy>
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	0f 88 d2 00 00 00    	js     801ac8 <sfork+0x251>
+				pte = uvpt[pn];
+  8019f6:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8019fd:	e9 66 ff ff ff       	jmp    801968 <sfork+0xf1>
+  801a02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a05:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801a08:	83 c6 01             	add    $0x1,%esi
+  801a0b:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801a11:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801a17:	74 1b                	je     801a34 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801a19:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801a20:	a8 01                	test   $0x1,%al
+  801a22:	74 e4                	je     801a08 <sfork+0x191>
+  801a24:	89 f3                	mov    %esi,%ebx
+  801a26:	c1 e3 0a             	shl    $0xa,%ebx
+  801a29:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801a2c:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801a2f:	e9 4f ff ff ff       	jmp    801983 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801a34:	83 ec 04             	sub    $0x4,%esp
+  801a37:	6a 07                	push   $0x7
+  801a39:	68 00 f0 bf ee       	push   $0xeebff000
+  801a3e:	ff 75 e0             	push   -0x20(%ebp)
+  801a41:	e8 78 f5 ff ff       	call   800fbe <sys_page_alloc>
+  801a46:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801a48:	83 c4 10             	add    $0x10,%esp
+  801a4b:	85 c0                	test   %eax,%eax
+  801a4d:	78 37                	js     801a86 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801a4f:	83 ec 08             	sub    $0x8,%esp
+  801a52:	68 a3 46 80 00       	push   $0x8046a3
+  801a57:	ff 75 e0             	push   -0x20(%ebp)
+  801a5a:	e8 dc f6 ff ff       	call   80113b <sys_env_set_pgfault_upcall>
+  801a5f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 34                	js     801a9c <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801a68:	83 ec 08             	sub    $0x8,%esp
+  801a6b:	6a 02                	push   $0x2
+  801a6d:	ff 75 e0             	push   -0x20(%ebp)
+  801a70:	e8 2e f6 ff ff       	call   8010a3 <sys_env_set_status>
+  801a75:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 34                	js     801ab2 <sfork+0x23b>
+	return eid;
+  801a7e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801a81:	e9 54 ff ff ff       	jmp    8019da <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801a86:	83 ec 08             	sub    $0x8,%esp
+  801a89:	50                   	push   %eax
+  801a8a:	68 b4 50 80 00       	push   $0x8050b4
+  801a8f:	e8 08 eb ff ff       	call   80059c <cprintf>
+		return r;
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	e9 3e ff ff ff       	jmp    8019da <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801a9c:	83 ec 08             	sub    $0x8,%esp
+  801a9f:	50                   	push   %eax
+  801aa0:	68 dc 50 80 00       	push   $0x8050dc
+  801aa5:	e8 f2 ea ff ff       	call   80059c <cprintf>
+		return r;
+  801aaa:	83 c4 10             	add    $0x10,%esp
+  801aad:	e9 28 ff ff ff       	jmp    8019da <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801ab2:	83 ec 08             	sub    $0x8,%esp
+  801ab5:	50                   	push   %eax
+  801ab6:	68 66 51 80 00       	push   $0x805166
+  801abb:	e8 dc ea ff ff       	call   80059c <cprintf>
+		return r;
+  801ac0:	83 c4 10             	add    $0x10,%esp
+  801ac3:	e9 12 ff ff ff       	jmp    8019da <sfork+0x163>
+  801ac8:	89 c7                	mov    %eax,%edi
+  801aca:	e9 0b ff ff ff       	jmp    8019da <sfork+0x163>
+  801acf:	89 c7                	mov    %eax,%edi
+  801ad1:	e9 04 ff ff ff       	jmp    8019da <sfork+0x163>
+
+00801ad6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ad9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adc:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ae1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+
+00801ae6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aec:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801af1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801af6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801afb:	5d                   	pop    %ebp
+  801afc:	c3                   	ret
+
+00801afd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801afd:	55                   	push   %ebp
+  801afe:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b00:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b05:	eb 02                	jmp    801b09 <fd_alloc+0xc>
+  801b07:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b09:	89 c2                	mov    %eax,%edx
+  801b0b:	c1 ea 16             	shr    $0x16,%edx
+  801b0e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b15:	f6 c2 01             	test   $0x1,%dl
+  801b18:	74 2b                	je     801b45 <fd_alloc+0x48>
+  801b1a:	89 c2                	mov    %eax,%edx
+  801b1c:	c1 ea 0c             	shr    $0xc,%edx
+  801b1f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b26:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801b2c:	f6 c1 01             	test   $0x1,%cl
+  801b2f:	74 14                	je     801b45 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801b31:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b37:	75 ce                	jne    801b07 <fd_alloc+0xa>
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b3e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b43:	eb 05                	jmp    801b4a <fd_alloc+0x4d>
+			return 0;
+  801b45:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4d:	89 02                	mov    %eax,(%edx)
+}
+  801b4f:	89 c8                	mov    %ecx,%eax
+  801b51:	5d                   	pop    %ebp
+  801b52:	c3                   	ret
+
+00801b53 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b53:	55                   	push   %ebp
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b59:	83 f8 1f             	cmp    $0x1f,%eax
+  801b5c:	77 30                	ja     801b8e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b5e:	c1 e0 0c             	shl    $0xc,%eax
+  801b61:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b66:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b6c:	f6 c2 01             	test   $0x1,%dl
+  801b6f:	74 24                	je     801b95 <fd_lookup+0x42>
+  801b71:	89 c2                	mov    %eax,%edx
+  801b73:	c1 ea 0c             	shr    $0xc,%edx
+  801b76:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b7d:	f6 c2 01             	test   $0x1,%dl
+  801b80:	74 1a                	je     801b9c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b85:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b8c:	5d                   	pop    %ebp
+  801b8d:	c3                   	ret
+		return -E_INVAL;
+  801b8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b93:	eb f7                	jmp    801b8c <fd_lookup+0x39>
+		return -E_INVAL;
+  801b95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b9a:	eb f0                	jmp    801b8c <fd_lookup+0x39>
+  801b9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba1:	eb e9                	jmp    801b8c <fd_lookup+0x39>
+
+00801ba3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	53                   	push   %ebx
+  801ba7:	83 ec 04             	sub    $0x4,%esp
+  801baa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb2:	eb 03                	jmp    801bb7 <dev_lookup+0x14>
+  801bb4:	83 c0 01             	add    $0x1,%eax
+  801bb7:	8b 1c 85 00 52 80 00 	mov    0x805200(,%eax,4),%ebx
+  801bbe:	85 db                	test   %ebx,%ebx
+  801bc0:	74 0b                	je     801bcd <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801bc2:	39 13                	cmp    %edx,(%ebx)
+  801bc4:	75 ee                	jne    801bb4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcb:	eb 49                	jmp    801c16 <dev_lookup+0x73>
+  801bcd:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bcf:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801bd5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bda:	77 18                	ja     801bf4 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bdc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801be1:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801be3:	c1 e8 10             	shr    $0x10,%eax
+  801be6:	74 0c                	je     801bf4 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801be8:	c1 e0 10             	shl    $0x10,%eax
+  801beb:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801bf0:	29 c1                	sub    %eax,%ecx
+  801bf2:	eb 06                	jmp    801bfa <dev_lookup+0x57>
+		return pthread_main_tls;
+  801bf4:	8b 0d 40 c1 80 00    	mov    0x80c140,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bfa:	8b 01                	mov    (%ecx),%eax
+  801bfc:	8b 40 48             	mov    0x48(%eax),%eax
+  801bff:	83 ec 04             	sub    $0x4,%esp
+  801c02:	52                   	push   %edx
+  801c03:	50                   	push   %eax
+  801c04:	68 84 51 80 00       	push   $0x805184
+  801c09:	e8 8e e9 ff ff       	call   80059c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c19:	89 1a                	mov    %ebx,(%edx)
+}
+  801c1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+
+00801c20 <fd_close>:
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	57                   	push   %edi
+  801c24:	56                   	push   %esi
+  801c25:	53                   	push   %ebx
+  801c26:	83 ec 24             	sub    $0x24,%esp
+  801c29:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c2f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c32:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c33:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c39:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c3c:	50                   	push   %eax
+  801c3d:	e8 11 ff ff ff       	call   801b53 <fd_lookup>
+  801c42:	89 c3                	mov    %eax,%ebx
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 05                	js     801c50 <fd_close+0x30>
+	    || fd != fd2)
+  801c4b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c4e:	74 16                	je     801c66 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c50:	89 f8                	mov    %edi,%eax
+  801c52:	84 c0                	test   %al,%al
+  801c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c59:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c5c:	89 d8                	mov    %ebx,%eax
+  801c5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c61:	5b                   	pop    %ebx
+  801c62:	5e                   	pop    %esi
+  801c63:	5f                   	pop    %edi
+  801c64:	5d                   	pop    %ebp
+  801c65:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c66:	83 ec 08             	sub    $0x8,%esp
+  801c69:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	ff 36                	push   (%esi)
+  801c6f:	e8 2f ff ff ff       	call   801ba3 <dev_lookup>
+  801c74:	89 c3                	mov    %eax,%ebx
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 1a                	js     801c97 <fd_close+0x77>
+		if (dev->dev_close)
+  801c7d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c80:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c83:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	74 0b                	je     801c97 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c8c:	83 ec 0c             	sub    $0xc,%esp
+  801c8f:	56                   	push   %esi
+  801c90:	ff d0                	call   *%eax
+  801c92:	89 c3                	mov    %eax,%ebx
+  801c94:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c97:	83 ec 08             	sub    $0x8,%esp
+  801c9a:	56                   	push   %esi
+  801c9b:	6a 00                	push   $0x0
+  801c9d:	e8 b5 f3 ff ff       	call   801057 <sys_page_unmap>
+	return r;
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	eb b5                	jmp    801c5c <fd_close+0x3c>
+
+00801ca7 <close>:
+
+int
+close(int fdnum)
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb0:	50                   	push   %eax
+  801cb1:	ff 75 08             	push   0x8(%ebp)
+  801cb4:	e8 9a fe ff ff       	call   801b53 <fd_lookup>
+  801cb9:	83 c4 10             	add    $0x10,%esp
+  801cbc:	85 c0                	test   %eax,%eax
+  801cbe:	79 02                	jns    801cc2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801cc0:	c9                   	leave
+  801cc1:	c3                   	ret
+		return fd_close(fd, 1);
+  801cc2:	83 ec 08             	sub    $0x8,%esp
+  801cc5:	6a 01                	push   $0x1
+  801cc7:	ff 75 f4             	push   -0xc(%ebp)
+  801cca:	e8 51 ff ff ff       	call   801c20 <fd_close>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	eb ec                	jmp    801cc0 <close+0x19>
+
+00801cd4 <close_all>:
+
+void
+close_all(void)
+{
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801cdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ce0:	83 ec 0c             	sub    $0xc,%esp
+  801ce3:	53                   	push   %ebx
+  801ce4:	e8 be ff ff ff       	call   801ca7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ce9:	83 c3 01             	add    $0x1,%ebx
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	83 fb 20             	cmp    $0x20,%ebx
+  801cf2:	75 ec                	jne    801ce0 <close_all+0xc>
+}
+  801cf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf7:	c9                   	leave
+  801cf8:	c3                   	ret
+
+00801cf9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	57                   	push   %edi
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d02:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d05:	50                   	push   %eax
+  801d06:	ff 75 08             	push   0x8(%ebp)
+  801d09:	e8 45 fe ff ff       	call   801b53 <fd_lookup>
+  801d0e:	89 c3                	mov    %eax,%ebx
+  801d10:	83 c4 10             	add    $0x10,%esp
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	78 7f                	js     801d96 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d17:	83 ec 0c             	sub    $0xc,%esp
+  801d1a:	ff 75 0c             	push   0xc(%ebp)
+  801d1d:	e8 85 ff ff ff       	call   801ca7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d22:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d25:	c1 e6 0c             	shl    $0xc,%esi
+  801d28:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d2e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d31:	89 3c 24             	mov    %edi,(%esp)
+  801d34:	e8 ad fd ff ff       	call   801ae6 <fd2data>
+  801d39:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d3b:	89 34 24             	mov    %esi,(%esp)
+  801d3e:	e8 a3 fd ff ff       	call   801ae6 <fd2data>
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d49:	89 d8                	mov    %ebx,%eax
+  801d4b:	c1 e8 16             	shr    $0x16,%eax
+  801d4e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d55:	a8 01                	test   $0x1,%al
+  801d57:	74 11                	je     801d6a <dup+0x71>
+  801d59:	89 d8                	mov    %ebx,%eax
+  801d5b:	c1 e8 0c             	shr    $0xc,%eax
+  801d5e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d65:	f6 c2 01             	test   $0x1,%dl
+  801d68:	75 36                	jne    801da0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d6a:	89 f8                	mov    %edi,%eax
+  801d6c:	c1 e8 0c             	shr    $0xc,%eax
+  801d6f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+  801d79:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d7e:	50                   	push   %eax
+  801d7f:	56                   	push   %esi
+  801d80:	6a 00                	push   $0x0
+  801d82:	57                   	push   %edi
+  801d83:	6a 00                	push   $0x0
+  801d85:	e8 81 f2 ff ff       	call   80100b <sys_page_map>
+  801d8a:	89 c3                	mov    %eax,%ebx
+  801d8c:	83 c4 20             	add    $0x20,%esp
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	78 33                	js     801dc6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d96:	89 d8                	mov    %ebx,%eax
+  801d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9b:	5b                   	pop    %ebx
+  801d9c:	5e                   	pop    %esi
+  801d9d:	5f                   	pop    %edi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801da0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801da7:	83 ec 0c             	sub    $0xc,%esp
+  801daa:	25 07 0e 00 00       	and    $0xe07,%eax
+  801daf:	50                   	push   %eax
+  801db0:	ff 75 d4             	push   -0x2c(%ebp)
+  801db3:	6a 00                	push   $0x0
+  801db5:	53                   	push   %ebx
+  801db6:	6a 00                	push   $0x0
+  801db8:	e8 4e f2 ff ff       	call   80100b <sys_page_map>
+  801dbd:	89 c3                	mov    %eax,%ebx
+  801dbf:	83 c4 20             	add    $0x20,%esp
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	79 a4                	jns    801d6a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801dc6:	83 ec 08             	sub    $0x8,%esp
+  801dc9:	56                   	push   %esi
+  801dca:	6a 00                	push   $0x0
+  801dcc:	e8 86 f2 ff ff       	call   801057 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801dd1:	83 c4 08             	add    $0x8,%esp
+  801dd4:	ff 75 d4             	push   -0x2c(%ebp)
+  801dd7:	6a 00                	push   $0x0
+  801dd9:	e8 79 f2 ff ff       	call   801057 <sys_page_unmap>
+	return r;
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	eb b3                	jmp    801d96 <dup+0x9d>
+
+00801de3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	56                   	push   %esi
+  801de7:	53                   	push   %ebx
+  801de8:	83 ec 18             	sub    $0x18,%esp
+  801deb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801df1:	50                   	push   %eax
+  801df2:	53                   	push   %ebx
+  801df3:	e8 5b fd ff ff       	call   801b53 <fd_lookup>
+  801df8:	83 c4 10             	add    $0x10,%esp
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	78 3c                	js     801e3b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e02:	83 ec 08             	sub    $0x8,%esp
+  801e05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e08:	50                   	push   %eax
+  801e09:	ff 36                	push   (%esi)
+  801e0b:	e8 93 fd ff ff       	call   801ba3 <dev_lookup>
+  801e10:	83 c4 10             	add    $0x10,%esp
+  801e13:	85 c0                	test   %eax,%eax
+  801e15:	78 24                	js     801e3b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e17:	8b 46 08             	mov    0x8(%esi),%eax
+  801e1a:	83 e0 03             	and    $0x3,%eax
+  801e1d:	83 f8 01             	cmp    $0x1,%eax
+  801e20:	74 20                	je     801e42 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e25:	8b 40 08             	mov    0x8(%eax),%eax
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	74 61                	je     801e8d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e2c:	83 ec 04             	sub    $0x4,%esp
+  801e2f:	ff 75 10             	push   0x10(%ebp)
+  801e32:	ff 75 0c             	push   0xc(%ebp)
+  801e35:	56                   	push   %esi
+  801e36:	ff d0                	call   *%eax
+  801e38:	83 c4 10             	add    $0x10,%esp
+}
+  801e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e3e:	5b                   	pop    %ebx
+  801e3f:	5e                   	pop    %esi
+  801e40:	5d                   	pop    %ebp
+  801e41:	c3                   	ret
+  801e42:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e44:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e4a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e4f:	77 18                	ja     801e69 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e51:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e56:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e58:	c1 e8 10             	shr    $0x10,%eax
+  801e5b:	74 0c                	je     801e69 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e5d:	c1 e0 10             	shl    $0x10,%eax
+  801e60:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e65:	29 c2                	sub    %eax,%edx
+  801e67:	eb 06                	jmp    801e6f <read+0x8c>
+		return pthread_main_tls;
+  801e69:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e6f:	8b 02                	mov    (%edx),%eax
+  801e71:	8b 40 48             	mov    0x48(%eax),%eax
+  801e74:	83 ec 04             	sub    $0x4,%esp
+  801e77:	53                   	push   %ebx
+  801e78:	50                   	push   %eax
+  801e79:	68 c5 51 80 00       	push   $0x8051c5
+  801e7e:	e8 19 e7 ff ff       	call   80059c <cprintf>
+		return -E_INVAL;
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8b:	eb ae                	jmp    801e3b <read+0x58>
+		return -E_NOT_SUPP;
+  801e8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e92:	eb a7                	jmp    801e3b <read+0x58>
+
+00801e94 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	57                   	push   %edi
+  801e98:	56                   	push   %esi
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 0c             	sub    $0xc,%esp
+  801e9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ea0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea8:	eb 02                	jmp    801eac <readn+0x18>
+  801eaa:	01 c3                	add    %eax,%ebx
+  801eac:	39 f3                	cmp    %esi,%ebx
+  801eae:	73 21                	jae    801ed1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	89 f0                	mov    %esi,%eax
+  801eb5:	29 d8                	sub    %ebx,%eax
+  801eb7:	50                   	push   %eax
+  801eb8:	89 d8                	mov    %ebx,%eax
+  801eba:	03 45 0c             	add    0xc(%ebp),%eax
+  801ebd:	50                   	push   %eax
+  801ebe:	57                   	push   %edi
+  801ebf:	e8 1f ff ff ff       	call   801de3 <read>
+		if (m < 0)
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 04                	js     801ecf <readn+0x3b>
+			return m;
+		if (m == 0)
+  801ecb:	75 dd                	jne    801eaa <readn+0x16>
+  801ecd:	eb 02                	jmp    801ed1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ecf:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ed1:	89 d8                	mov    %ebx,%eax
+  801ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed6:	5b                   	pop    %ebx
+  801ed7:	5e                   	pop    %esi
+  801ed8:	5f                   	pop    %edi
+  801ed9:	5d                   	pop    %ebp
+  801eda:	c3                   	ret
+
+00801edb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	56                   	push   %esi
+  801edf:	53                   	push   %ebx
+  801ee0:	83 ec 18             	sub    $0x18,%esp
+  801ee3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ee6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ee9:	50                   	push   %eax
+  801eea:	53                   	push   %ebx
+  801eeb:	e8 63 fc ff ff       	call   801b53 <fd_lookup>
+  801ef0:	83 c4 10             	add    $0x10,%esp
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	78 37                	js     801f2e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ef7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801efa:	83 ec 08             	sub    $0x8,%esp
+  801efd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f00:	50                   	push   %eax
+  801f01:	ff 36                	push   (%esi)
+  801f03:	e8 9b fc ff ff       	call   801ba3 <dev_lookup>
+  801f08:	83 c4 10             	add    $0x10,%esp
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 1f                	js     801f2e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f0f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f13:	74 20                	je     801f35 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f18:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	74 61                	je     801f80 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f1f:	83 ec 04             	sub    $0x4,%esp
+  801f22:	ff 75 10             	push   0x10(%ebp)
+  801f25:	ff 75 0c             	push   0xc(%ebp)
+  801f28:	56                   	push   %esi
+  801f29:	ff d0                	call   *%eax
+  801f2b:	83 c4 10             	add    $0x10,%esp
+}
+  801f2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f31:	5b                   	pop    %ebx
+  801f32:	5e                   	pop    %esi
+  801f33:	5d                   	pop    %ebp
+  801f34:	c3                   	ret
+  801f35:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f37:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f3d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f42:	77 18                	ja     801f5c <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f44:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f49:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f4b:	c1 e8 10             	shr    $0x10,%eax
+  801f4e:	74 0c                	je     801f5c <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f50:	c1 e0 10             	shl    $0x10,%eax
+  801f53:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f58:	29 c2                	sub    %eax,%edx
+  801f5a:	eb 06                	jmp    801f62 <write+0x87>
+		return pthread_main_tls;
+  801f5c:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f62:	8b 02                	mov    (%edx),%eax
+  801f64:	8b 40 48             	mov    0x48(%eax),%eax
+  801f67:	83 ec 04             	sub    $0x4,%esp
+  801f6a:	53                   	push   %ebx
+  801f6b:	50                   	push   %eax
+  801f6c:	68 e1 51 80 00       	push   $0x8051e1
+  801f71:	e8 26 e6 ff ff       	call   80059c <cprintf>
+		return -E_INVAL;
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7e:	eb ae                	jmp    801f2e <write+0x53>
+		return -E_NOT_SUPP;
+  801f80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f85:	eb a7                	jmp    801f2e <write+0x53>
+
+00801f87 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f90:	50                   	push   %eax
+  801f91:	ff 75 08             	push   0x8(%ebp)
+  801f94:	e8 ba fb ff ff       	call   801b53 <fd_lookup>
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 0e                	js     801fae <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801fa0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+00801fb0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	56                   	push   %esi
+  801fb4:	53                   	push   %ebx
+  801fb5:	83 ec 18             	sub    $0x18,%esp
+  801fb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fbb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fbe:	50                   	push   %eax
+  801fbf:	53                   	push   %ebx
+  801fc0:	e8 8e fb ff ff       	call   801b53 <fd_lookup>
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 34                	js     802000 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fcc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fcf:	83 ec 08             	sub    $0x8,%esp
+  801fd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd5:	50                   	push   %eax
+  801fd6:	ff 36                	push   (%esi)
+  801fd8:	e8 c6 fb ff ff       	call   801ba3 <dev_lookup>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 1c                	js     802000 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fe4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fe8:	74 1d                	je     802007 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801fea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fed:	8b 40 18             	mov    0x18(%eax),%eax
+  801ff0:	85 c0                	test   %eax,%eax
+  801ff2:	74 5e                	je     802052 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ff4:	83 ec 08             	sub    $0x8,%esp
+  801ff7:	ff 75 0c             	push   0xc(%ebp)
+  801ffa:	56                   	push   %esi
+  801ffb:	ff d0                	call   *%eax
+  801ffd:	83 c4 10             	add    $0x10,%esp
+}
+  802000:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802003:	5b                   	pop    %ebx
+  802004:	5e                   	pop    %esi
+  802005:	5d                   	pop    %ebp
+  802006:	c3                   	ret
+  802007:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802009:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80200f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802014:	77 18                	ja     80202e <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802016:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80201b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80201d:	c1 e8 10             	shr    $0x10,%eax
+  802020:	74 0c                	je     80202e <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802022:	c1 e0 10             	shl    $0x10,%eax
+  802025:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80202a:	29 c2                	sub    %eax,%edx
+  80202c:	eb 06                	jmp    802034 <ftruncate+0x84>
+		return pthread_main_tls;
+  80202e:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+			thisenv->env_id, fdnum);
+  802034:	8b 02                	mov    (%edx),%eax
+  802036:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802039:	83 ec 04             	sub    $0x4,%esp
+  80203c:	53                   	push   %ebx
+  80203d:	50                   	push   %eax
+  80203e:	68 a4 51 80 00       	push   $0x8051a4
+  802043:	e8 54 e5 ff ff       	call   80059c <cprintf>
+		return -E_INVAL;
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802050:	eb ae                	jmp    802000 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802052:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802057:	eb a7                	jmp    802000 <ftruncate+0x50>
+
+00802059 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802059:	55                   	push   %ebp
+  80205a:	89 e5                	mov    %esp,%ebp
+  80205c:	56                   	push   %esi
+  80205d:	53                   	push   %ebx
+  80205e:	83 ec 18             	sub    $0x18,%esp
+  802061:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802064:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	ff 75 08             	push   0x8(%ebp)
+  80206b:	e8 e3 fa ff ff       	call   801b53 <fd_lookup>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 49                	js     8020c0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802077:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80207a:	83 ec 08             	sub    $0x8,%esp
+  80207d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	ff 36                	push   (%esi)
+  802083:	e8 1b fb ff ff       	call   801ba3 <dev_lookup>
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	78 31                	js     8020c0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80208f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802092:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802096:	74 2f                	je     8020c7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802098:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80209b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020a2:	00 00 00 
+	stat->st_isdir = 0;
+  8020a5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ac:	00 00 00 
+	stat->st_dev = dev;
+  8020af:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8020b5:	83 ec 08             	sub    $0x8,%esp
+  8020b8:	53                   	push   %ebx
+  8020b9:	56                   	push   %esi
+  8020ba:	ff 50 14             	call   *0x14(%eax)
+  8020bd:	83 c4 10             	add    $0x10,%esp
+}
+  8020c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c3:	5b                   	pop    %ebx
+  8020c4:	5e                   	pop    %esi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020cc:	eb f2                	jmp    8020c0 <fstat+0x67>
+
+008020ce <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	56                   	push   %esi
+  8020d2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8020d3:	83 ec 08             	sub    $0x8,%esp
+  8020d6:	6a 00                	push   $0x0
+  8020d8:	ff 75 08             	push   0x8(%ebp)
+  8020db:	e8 4b 03 00 00       	call   80242b <open>
+  8020e0:	89 c3                	mov    %eax,%ebx
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 1b                	js     802104 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8020e9:	83 ec 08             	sub    $0x8,%esp
+  8020ec:	ff 75 0c             	push   0xc(%ebp)
+  8020ef:	50                   	push   %eax
+  8020f0:	e8 64 ff ff ff       	call   802059 <fstat>
+  8020f5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8020f7:	89 1c 24             	mov    %ebx,(%esp)
+  8020fa:	e8 a8 fb ff ff       	call   801ca7 <close>
+	return r;
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	89 f3                	mov    %esi,%ebx
+}
+  802104:	89 d8                	mov    %ebx,%eax
+  802106:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802109:	5b                   	pop    %ebx
+  80210a:	5e                   	pop    %esi
+  80210b:	5d                   	pop    %ebp
+  80210c:	c3                   	ret
+
+0080210d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	56                   	push   %esi
+  802111:	53                   	push   %ebx
+  802112:	89 c6                	mov    %eax,%esi
+  802114:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802116:	83 3d 80 be 80 00 00 	cmpl   $0x0,0x80be80
+  80211d:	74 27                	je     802146 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80211f:	6a 07                	push   $0x7
+  802121:	68 00 d0 80 00       	push   $0x80d000
+  802126:	56                   	push   %esi
+  802127:	ff 35 80 be 80 00    	push   0x80be80
+  80212d:	e8 8d 26 00 00       	call   8047bf <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802132:	83 c4 0c             	add    $0xc,%esp
+  802135:	6a 00                	push   $0x0
+  802137:	53                   	push   %ebx
+  802138:	6a 00                	push   $0x0
+  80213a:	e8 8a 25 00 00       	call   8046c9 <ipc_recv>
+}
+  80213f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802142:	5b                   	pop    %ebx
+  802143:	5e                   	pop    %esi
+  802144:	5d                   	pop    %ebp
+  802145:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802146:	83 ec 0c             	sub    $0xc,%esp
+  802149:	6a 01                	push   $0x1
+  80214b:	e8 c5 26 00 00       	call   804815 <ipc_find_env>
+  802150:	a3 80 be 80 00       	mov    %eax,0x80be80
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	eb c5                	jmp    80211f <fsipc+0x12>
+
+0080215a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	53                   	push   %ebx
+  80215e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802161:	68 84 be 80 00       	push   $0x80be84
+  802166:	e8 7a 1b 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802171:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.set_size.req_size = newsize;
+  802176:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802179:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80217e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802183:	b8 02 00 00 00       	mov    $0x2,%eax
+  802188:	e8 80 ff ff ff       	call   80210d <fsipc>
+  80218d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80218f:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  802196:	e8 b7 1b 00 00       	call   803d52 <mutex_unlock>
+	return r;
+}
+  80219b:	89 d8                	mov    %ebx,%eax
+  80219d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+
+008021a2 <devfile_flush>:
+{
+  8021a2:	55                   	push   %ebp
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8021a9:	68 84 be 80 00       	push   $0x80be84
+  8021ae:	e8 32 1b 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021b9:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8021be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021c8:	e8 40 ff ff ff       	call   80210d <fsipc>
+  8021cd:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021cf:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  8021d6:	e8 77 1b 00 00       	call   803d52 <mutex_unlock>
+}
+  8021db:	89 d8                	mov    %ebx,%eax
+  8021dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e0:	c9                   	leave
+  8021e1:	c3                   	ret
+
+008021e2 <devfile_stat>:
+{
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	56                   	push   %esi
+  8021e6:	53                   	push   %ebx
+  8021e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+  8021ed:	68 84 be 80 00       	push   $0x80be84
+  8021f2:	e8 ee 1a 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021fd:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802202:	ba 00 00 00 00       	mov    $0x0,%edx
+  802207:	b8 05 00 00 00       	mov    $0x5,%eax
+  80220c:	e8 fc fe ff ff       	call   80210d <fsipc>
+  802211:	89 c3                	mov    %eax,%ebx
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 c0                	test   %eax,%eax
+  802218:	79 16                	jns    802230 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	68 84 be 80 00       	push   $0x80be84
+  802222:	e8 2b 1b 00 00       	call   803d52 <mutex_unlock>
+}
+  802227:	89 d8                	mov    %ebx,%eax
+  802229:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222c:	5b                   	pop    %ebx
+  80222d:	5e                   	pop    %esi
+  80222e:	5d                   	pop    %ebp
+  80222f:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802230:	83 ec 08             	sub    $0x8,%esp
+  802233:	68 00 d0 80 00       	push   $0x80d000
+  802238:	56                   	push   %esi
+  802239:	e8 42 e9 ff ff       	call   800b80 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80223e:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  802243:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802249:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  80224e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802254:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80225c:	eb bc                	jmp    80221a <devfile_stat+0x38>
+
+0080225e <devfile_write>:
+{
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	53                   	push   %ebx
+  802262:	83 ec 10             	sub    $0x10,%esp
+  802265:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802268:	68 84 be 80 00       	push   $0x80be84
+  80226d:	e8 73 1a 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802272:	8b 45 08             	mov    0x8(%ebp),%eax
+  802275:	8b 40 0c             	mov    0xc(%eax),%eax
+  802278:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802286:	76 3d                	jbe    8022c5 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802288:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80228d:	39 c3                	cmp    %eax,%ebx
+  80228f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802292:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802295:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	fsipcbuf.write.req_n = n;
+  80229a:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8022a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022aa:	e8 5e fe ff ff       	call   80210d <fsipc>
+  8022af:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022b1:	83 ec 0c             	sub    $0xc,%esp
+  8022b4:	68 84 be 80 00       	push   $0x80be84
+  8022b9:	e8 94 1a 00 00       	call   803d52 <mutex_unlock>
+}
+  8022be:	89 d8                	mov    %ebx,%eax
+  8022c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8022c5:	83 ec 04             	sub    $0x4,%esp
+  8022c8:	53                   	push   %ebx
+  8022c9:	ff 75 0c             	push   0xc(%ebp)
+  8022cc:	68 0c d0 80 00       	push   $0x80d00c
+  8022d1:	e8 30 ea ff ff       	call   800d06 <memmove>
+  8022d6:	83 c4 10             	add    $0x10,%esp
+  8022d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022de:	eb b5                	jmp    802295 <devfile_write+0x37>
+
+008022e0 <devfile_read>:
+{
+  8022e0:	55                   	push   %ebp
+  8022e1:	89 e5                	mov    %esp,%ebp
+  8022e3:	57                   	push   %edi
+  8022e4:	56                   	push   %esi
+  8022e5:	53                   	push   %ebx
+  8022e6:	83 ec 0c             	sub    $0xc,%esp
+  8022e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8022f2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8022f8:	0f 86 8c 00 00 00    	jbe    80238a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8022fe:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802303:	39 c3                	cmp    %eax,%ebx
+  802305:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802308:	89 f8                	mov    %edi,%eax
+  80230a:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80230d:	eb 0f                	jmp    80231e <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80230f:	0f b6 08             	movzbl (%eax),%ecx
+  802312:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802314:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802319:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80231e:	39 d0                	cmp    %edx,%eax
+  802320:	72 ed                	jb     80230f <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	68 84 be 80 00       	push   $0x80be84
+  80232a:	e8 b6 19 00 00       	call   803ce5 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80232f:	8b 46 0c             	mov    0xc(%esi),%eax
+  802332:	a3 00 d0 80 00       	mov    %eax,0x80d000
+		fsipcbuf.read.req_n = n;
+  802337:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  80233d:	89 3d 08 d0 80 00    	mov    %edi,0x80d008
+		r = fsipc(FSREQ_READ, NULL);
+  802343:	ba 00 00 00 00       	mov    $0x0,%edx
+  802348:	b8 03 00 00 00       	mov    $0x3,%eax
+  80234d:	e8 bb fd ff ff       	call   80210d <fsipc>
+  802352:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802354:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  80235b:	e8 f2 19 00 00       	call   803d52 <mutex_unlock>
+		assert(r <= (int) n);
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	39 f3                	cmp    %esi,%ebx
+  802365:	7c 0a                	jl     802371 <devfile_read+0x91>
+}
+  802367:	89 f0                	mov    %esi,%eax
+  802369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+		assert(r <= (int) n);
+  802371:	68 14 52 80 00       	push   $0x805214
+  802376:	68 51 51 80 00       	push   $0x805151
+  80237b:	68 90 00 00 00       	push   $0x90
+  802380:	68 21 52 80 00       	push   $0x805221
+  802385:	e8 37 e1 ff ff       	call   8004c1 <_panic>
+	mutex_lock(&fsipc_mu);
+  80238a:	83 ec 0c             	sub    $0xc,%esp
+  80238d:	68 84 be 80 00       	push   $0x80be84
+  802392:	e8 4e 19 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802397:	8b 46 0c             	mov    0xc(%esi),%eax
+  80239a:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.read.req_n = n;
+  80239f:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+	fsipcbuf.read.req_va = 0;
+  8023a5:	c7 05 08 d0 80 00 00 	movl   $0x0,0x80d008
+  8023ac:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8023af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023b9:	e8 4f fd ff ff       	call   80210d <fsipc>
+  8023be:	89 c6                	mov    %eax,%esi
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	85 c0                	test   %eax,%eax
+  8023c5:	78 1d                	js     8023e4 <devfile_read+0x104>
+		assert(r <= n);
+  8023c7:	39 c3                	cmp    %eax,%ebx
+  8023c9:	72 2e                	jb     8023f9 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8023cb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023d0:	7f 40                	jg     802412 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023d2:	83 ec 04             	sub    $0x4,%esp
+  8023d5:	50                   	push   %eax
+  8023d6:	68 00 d0 80 00       	push   $0x80d000
+  8023db:	57                   	push   %edi
+  8023dc:	e8 25 e9 ff ff       	call   800d06 <memmove>
+  8023e1:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8023e4:	83 ec 0c             	sub    $0xc,%esp
+  8023e7:	68 84 be 80 00       	push   $0x80be84
+  8023ec:	e8 61 19 00 00       	call   803d52 <mutex_unlock>
+	return r;
+  8023f1:	83 c4 10             	add    $0x10,%esp
+  8023f4:	e9 6e ff ff ff       	jmp    802367 <devfile_read+0x87>
+		assert(r <= n);
+  8023f9:	68 2c 52 80 00       	push   $0x80522c
+  8023fe:	68 51 51 80 00       	push   $0x805151
+  802403:	68 99 00 00 00       	push   $0x99
+  802408:	68 21 52 80 00       	push   $0x805221
+  80240d:	e8 af e0 ff ff       	call   8004c1 <_panic>
+		assert(r <= PGSIZE);
+  802412:	68 33 52 80 00       	push   $0x805233
+  802417:	68 51 51 80 00       	push   $0x805151
+  80241c:	68 9a 00 00 00       	push   $0x9a
+  802421:	68 21 52 80 00       	push   $0x805221
+  802426:	e8 96 e0 ff ff       	call   8004c1 <_panic>
+
+0080242b <open>:
+{
+  80242b:	55                   	push   %ebp
+  80242c:	89 e5                	mov    %esp,%ebp
+  80242e:	56                   	push   %esi
+  80242f:	53                   	push   %ebx
+  802430:	83 ec 1c             	sub    $0x1c,%esp
+  802433:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802436:	56                   	push   %esi
+  802437:	e8 09 e7 ff ff       	call   800b45 <strlen>
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802444:	0f 8f 85 00 00 00    	jg     8024cf <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  80244a:	83 ec 0c             	sub    $0xc,%esp
+  80244d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802450:	50                   	push   %eax
+  802451:	e8 a7 f6 ff ff       	call   801afd <fd_alloc>
+  802456:	89 c3                	mov    %eax,%ebx
+  802458:	83 c4 10             	add    $0x10,%esp
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	78 55                	js     8024b4 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80245f:	83 ec 0c             	sub    $0xc,%esp
+  802462:	68 84 be 80 00       	push   $0x80be84
+  802467:	e8 79 18 00 00       	call   803ce5 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80246c:	83 c4 08             	add    $0x8,%esp
+  80246f:	56                   	push   %esi
+  802470:	68 00 d0 80 00       	push   $0x80d000
+  802475:	e8 06 e7 ff ff       	call   800b80 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80247a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247d:	a3 00 d4 80 00       	mov    %eax,0x80d400
+	r = fsipc(FSREQ_OPEN, fd);
+  802482:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802485:	b8 01 00 00 00       	mov    $0x1,%eax
+  80248a:	e8 7e fc ff ff       	call   80210d <fsipc>
+  80248f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802491:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  802498:	e8 b5 18 00 00       	call   803d52 <mutex_unlock>
+	if (r < 0) {
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	85 db                	test   %ebx,%ebx
+  8024a2:	78 19                	js     8024bd <open+0x92>
+	return fd2num(fd);
+  8024a4:	83 ec 0c             	sub    $0xc,%esp
+  8024a7:	ff 75 f4             	push   -0xc(%ebp)
+  8024aa:	e8 27 f6 ff ff       	call   801ad6 <fd2num>
+  8024af:	89 c3                	mov    %eax,%ebx
+  8024b1:	83 c4 10             	add    $0x10,%esp
+}
+  8024b4:	89 d8                	mov    %ebx,%eax
+  8024b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b9:	5b                   	pop    %ebx
+  8024ba:	5e                   	pop    %esi
+  8024bb:	5d                   	pop    %ebp
+  8024bc:	c3                   	ret
+		fd_close(fd, 0);
+  8024bd:	83 ec 08             	sub    $0x8,%esp
+  8024c0:	6a 00                	push   $0x0
+  8024c2:	ff 75 f4             	push   -0xc(%ebp)
+  8024c5:	e8 56 f7 ff ff       	call   801c20 <fd_close>
+		return r;
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	eb e5                	jmp    8024b4 <open+0x89>
+		return -E_BAD_PATH;
+  8024cf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024d4:	eb de                	jmp    8024b4 <open+0x89>
+
+008024d6 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	53                   	push   %ebx
+  8024da:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e0:	50                   	push   %eax
+  8024e1:	ff 75 08             	push   0x8(%ebp)
+  8024e4:	e8 6a f6 ff ff       	call   801b53 <fd_lookup>
+  8024e9:	89 c3                	mov    %eax,%ebx
+  8024eb:	83 c4 10             	add    $0x10,%esp
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 5b                	js     80254d <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f5:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8024fb:	39 08                	cmp    %ecx,(%eax)
+  8024fd:	75 55                	jne    802554 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8024ff:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802503:	74 56                	je     80255b <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802505:	83 ec 0c             	sub    $0xc,%esp
+  802508:	68 84 be 80 00       	push   $0x80be84
+  80250d:	e8 d3 17 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802512:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802515:	8b 40 0c             	mov    0xc(%eax),%eax
+  802518:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.allocate.req_offset = offset;
+  80251d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802520:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	fsipcbuf.allocate.req_len = len;
+  802525:	8b 45 10             	mov    0x10(%ebp),%eax
+  802528:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  80252d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802532:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802537:	e8 d1 fb ff ff       	call   80210d <fsipc>
+  80253c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80253e:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  802545:	e8 08 18 00 00       	call   803d52 <mutex_unlock>
+	return r;
+  80254a:	83 c4 10             	add    $0x10,%esp
+}
+  80254d:	89 d8                	mov    %ebx,%eax
+  80254f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+		return -E_NOT_SUPP;
+  802554:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802559:	eb f2                	jmp    80254d <fallocate+0x77>
+		return -E_INVAL;
+  80255b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802560:	eb eb                	jmp    80254d <fallocate+0x77>
+
+00802562 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802562:	55                   	push   %ebp
+  802563:	89 e5                	mov    %esp,%ebp
+  802565:	56                   	push   %esi
+  802566:	53                   	push   %ebx
+  802567:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80256a:	89 f3                	mov    %esi,%ebx
+  80256c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802572:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802575:	eb 06                	jmp    80257d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802577:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80257d:	39 f3                	cmp    %esi,%ebx
+  80257f:	73 14                	jae    802595 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802581:	83 ec 08             	sub    $0x8,%esp
+  802584:	53                   	push   %ebx
+  802585:	6a 00                	push   $0x0
+  802587:	e8 cb ea ff ff       	call   801057 <sys_page_unmap>
+  80258c:	83 c4 10             	add    $0x10,%esp
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	79 e4                	jns    802577 <munmap+0x15>
+  802593:	eb 05                	jmp    80259a <munmap+0x38>
+			return r;
+	return 0;
+  802595:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80259a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5d                   	pop    %ebp
+  8025a0:	c3                   	ret
+
+008025a1 <mmap>:
+{
+  8025a1:	55                   	push   %ebp
+  8025a2:	89 e5                	mov    %esp,%ebp
+  8025a4:	57                   	push   %edi
+  8025a5:	56                   	push   %esi
+  8025a6:	53                   	push   %ebx
+  8025a7:	83 ec 24             	sub    $0x24,%esp
+  8025aa:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025b0:	50                   	push   %eax
+  8025b1:	ff 75 08             	push   0x8(%ebp)
+  8025b4:	e8 9a f5 ff ff       	call   801b53 <fd_lookup>
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	85 c0                	test   %eax,%eax
+  8025be:	0f 88 37 01 00 00    	js     8026fb <mmap+0x15a>
+		return NULL;
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025c9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025cc:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8025d2:	39 0a                	cmp    %ecx,(%edx)
+  8025d4:	0f 85 05 01 00 00    	jne    8026df <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8025da:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8025e1:	0f 85 1b 01 00 00    	jne    802702 <mmap+0x161>
+  8025e7:	89 f0                	mov    %esi,%eax
+  8025e9:	83 e8 01             	sub    $0x1,%eax
+  8025ec:	0f 88 17 01 00 00    	js     802709 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8025f2:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8025f6:	75 28                	jne    802620 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8025f8:	83 ec 0c             	sub    $0xc,%esp
+  8025fb:	68 84 be 80 00       	push   $0x80be84
+  802600:	e8 e0 16 00 00       	call   803ce5 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802605:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80260b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802619:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80261e:	eb 2b                	jmp    80264b <mmap+0xaa>
+		cow_enable();
+  802620:	e8 40 f0 ff ff       	call   801665 <cow_enable>
+  802625:	eb d1                	jmp    8025f8 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802627:	89 c2                	mov    %eax,%edx
+  802629:	c1 ea 0c             	shr    $0xc,%edx
+  80262c:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802633:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802639:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80263f:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802642:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802644:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802649:	77 25                	ja     802670 <mmap+0xcf>
+  80264b:	89 c2                	mov    %eax,%edx
+  80264d:	29 da                	sub    %ebx,%edx
+  80264f:	39 ca                	cmp    %ecx,%edx
+  802651:	73 3a                	jae    80268d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802653:	89 c2                	mov    %eax,%edx
+  802655:	c1 ea 16             	shr    $0x16,%edx
+  802658:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80265f:	f6 c2 01             	test   $0x1,%dl
+  802662:	75 c3                	jne    802627 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802664:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802669:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80266e:	eb d4                	jmp    802644 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802670:	29 d8                	sub    %ebx,%eax
+  802672:	39 c8                	cmp    %ecx,%eax
+  802674:	73 17                	jae    80268d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	68 84 be 80 00       	push   $0x80be84
+  80267e:	e8 cf 16 00 00       	call   803d52 <mutex_unlock>
+		return NULL;
+  802683:	83 c4 10             	add    $0x10,%esp
+  802686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268b:	eb 52                	jmp    8026df <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80268d:	85 db                	test   %ebx,%ebx
+  80268f:	74 e5                	je     802676 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802691:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802694:	8b 40 0c             	mov    0xc(%eax),%eax
+  802697:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.map.req_offset = offset;
+  80269c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80269f:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	fsipcbuf.map.req_len = len;
+  8026a4:	89 35 08 d0 80 00    	mov    %esi,0x80d008
+	fsipcbuf.map.req_va = va;
+  8026aa:	89 1d 0c d0 80 00    	mov    %ebx,0x80d00c
+	fsipcbuf.map.req_prot = prot;
+  8026b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b3:	a3 10 d0 80 00       	mov    %eax,0x80d010
+	r = fsipc(FSREQ_MAP, NULL);
+  8026b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8026c2:	e8 46 fa ff ff       	call   80210d <fsipc>
+  8026c7:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8026c9:	83 ec 0c             	sub    $0xc,%esp
+  8026cc:	68 84 be 80 00       	push   $0x80be84
+  8026d1:	e8 7c 16 00 00       	call   803d52 <mutex_unlock>
+	if (r < 0) {
+  8026d6:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8026d9:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8026db:	85 ff                	test   %edi,%edi
+  8026dd:	78 08                	js     8026e7 <mmap+0x146>
+}
+  8026df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5f                   	pop    %edi
+  8026e5:	5d                   	pop    %ebp
+  8026e6:	c3                   	ret
+		munmap((void*) va, len);
+  8026e7:	83 ec 08             	sub    $0x8,%esp
+  8026ea:	56                   	push   %esi
+  8026eb:	53                   	push   %ebx
+  8026ec:	e8 71 fe ff ff       	call   802562 <munmap>
+		return NULL;
+  8026f1:	83 c4 10             	add    $0x10,%esp
+  8026f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f9:	eb e4                	jmp    8026df <mmap+0x13e>
+		return NULL;
+  8026fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802700:	eb dd                	jmp    8026df <mmap+0x13e>
+		return NULL;
+  802702:	b8 00 00 00 00       	mov    $0x0,%eax
+  802707:	eb d6                	jmp    8026df <mmap+0x13e>
+  802709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270e:	eb cf                	jmp    8026df <mmap+0x13e>
+
+00802710 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	53                   	push   %ebx
+  802714:	83 ec 10             	sub    $0x10,%esp
+  802717:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80271a:	53                   	push   %ebx
+  80271b:	e8 25 e4 ff ff       	call   800b45 <strlen>
+  802720:	83 c4 10             	add    $0x10,%esp
+  802723:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802728:	7f 42                	jg     80276c <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80272a:	83 ec 0c             	sub    $0xc,%esp
+  80272d:	68 84 be 80 00       	push   $0x80be84
+  802732:	e8 ae 15 00 00       	call   803ce5 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802737:	83 c4 08             	add    $0x8,%esp
+  80273a:	53                   	push   %ebx
+  80273b:	68 00 d0 80 00       	push   $0x80d000
+  802740:	e8 3b e4 ff ff       	call   800b80 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802745:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80274f:	e8 b9 f9 ff ff       	call   80210d <fsipc>
+  802754:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802756:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  80275d:	e8 f0 15 00 00       	call   803d52 <mutex_unlock>
+	return r;
+  802762:	83 c4 10             	add    $0x10,%esp
+}
+  802765:	89 d8                	mov    %ebx,%eax
+  802767:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276a:	c9                   	leave
+  80276b:	c3                   	ret
+		return -E_BAD_PATH;
+  80276c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802771:	eb f2                	jmp    802765 <remove+0x55>
+
+00802773 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802773:	55                   	push   %ebp
+  802774:	89 e5                	mov    %esp,%ebp
+  802776:	53                   	push   %ebx
+  802777:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80277a:	68 84 be 80 00       	push   $0x80be84
+  80277f:	e8 61 15 00 00       	call   803ce5 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802784:	ba 00 00 00 00       	mov    $0x0,%edx
+  802789:	b8 08 00 00 00       	mov    $0x8,%eax
+  80278e:	e8 7a f9 ff ff       	call   80210d <fsipc>
+  802793:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802795:	c7 04 24 84 be 80 00 	movl   $0x80be84,(%esp)
+  80279c:	e8 b1 15 00 00       	call   803d52 <mutex_unlock>
+	return r;
+}
+  8027a1:	89 d8                	mov    %ebx,%eax
+  8027a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a6:	c9                   	leave
+  8027a7:	c3                   	ret
+
+008027a8 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	56                   	push   %esi
+  8027ac:	53                   	push   %ebx
+  8027ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8027b0:	83 ec 0c             	sub    $0xc,%esp
+  8027b3:	68 84 be 80 00       	push   $0x80be84
+  8027b8:	e8 28 15 00 00       	call   803ce5 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8027bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c0:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8027c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8027cf:	e8 39 f9 ff ff       	call   80210d <fsipc>
+  8027d4:	89 c6                	mov    %eax,%esi
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	85 db                	test   %ebx,%ebx
+  8027db:	74 7b                	je     802858 <fs_bcstat+0xb0>
+  8027dd:	85 c0                	test   %eax,%eax
+  8027df:	78 77                	js     802858 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8027e1:	a1 00 d0 80 00       	mov    0x80d000,%eax
+  8027e6:	89 03                	mov    %eax,(%ebx)
+  8027e8:	a1 04 d0 80 00       	mov    0x80d004,%eax
+  8027ed:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027f0:	a1 08 d0 80 00       	mov    0x80d008,%eax
+  8027f5:	89 43 08             	mov    %eax,0x8(%ebx)
+  8027f8:	a1 0c d0 80 00       	mov    0x80d00c,%eax
+  8027fd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802800:	a1 10 d0 80 00       	mov    0x80d010,%eax
+  802805:	89 43 10             	mov    %eax,0x10(%ebx)
+  802808:	a1 14 d0 80 00       	mov    0x80d014,%eax
+  80280d:	89 43 14             	mov    %eax,0x14(%ebx)
+  802810:	a1 18 d0 80 00       	mov    0x80d018,%eax
+  802815:	89 43 18             	mov    %eax,0x18(%ebx)
+  802818:	a1 1c d0 80 00       	mov    0x80d01c,%eax
+  80281d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802820:	a1 20 d0 80 00       	mov    0x80d020,%eax
+  802825:	89 43 20             	mov    %eax,0x20(%ebx)
+  802828:	a1 24 d0 80 00       	mov    0x80d024,%eax
+  80282d:	89 43 24             	mov    %eax,0x24(%ebx)
+  802830:	a1 28 d0 80 00       	mov    0x80d028,%eax
+  802835:	89 43 28             	mov    %eax,0x28(%ebx)
+  802838:	a1 2c d0 80 00       	mov    0x80d02c,%eax
+  80283d:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802840:	a1 30 d0 80 00       	mov    0x80d030,%eax
+  802845:	89 43 30             	mov    %eax,0x30(%ebx)
+  802848:	a1 34 d0 80 00       	mov    0x80d034,%eax
+  80284d:	89 43 34             	mov    %eax,0x34(%ebx)
+  802850:	a1 38 d0 80 00       	mov    0x80d038,%eax
+  802855:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802858:	83 ec 0c             	sub    $0xc,%esp
+  80285b:	68 84 be 80 00       	push   $0x80be84
+  802860:	e8 ed 14 00 00       	call   803d52 <mutex_unlock>
+	return r;
+}
+  802865:	89 f0                	mov    %esi,%eax
+  802867:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286a:	5b                   	pop    %ebx
+  80286b:	5e                   	pop    %esi
+  80286c:	5d                   	pop    %ebp
+  80286d:	c3                   	ret
+
+0080286e <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80286e:	55                   	push   %ebp
+  80286f:	89 e5                	mov    %esp,%ebp
+  802871:	56                   	push   %esi
+  802872:	53                   	push   %ebx
+  802873:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802875:	0f b6 10             	movzbl (%eax),%edx
+  802878:	80 fa 72             	cmp    $0x72,%dl
+  80287b:	74 44                	je     8028c1 <parse_mode+0x53>
+  80287d:	80 fa 77             	cmp    $0x77,%dl
+  802880:	74 4b                	je     8028cd <parse_mode+0x5f>
+  802882:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802887:	80 fa 61             	cmp    $0x61,%dl
+  80288a:	74 09                	je     802895 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80288c:	89 d8                	mov    %ebx,%eax
+  80288e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802891:	5b                   	pop    %ebx
+  802892:	5e                   	pop    %esi
+  802893:	5d                   	pop    %ebp
+  802894:	c3                   	ret
+	switch (mode[0]) {
+  802895:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80289a:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80289f:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+  8028a4:	6a 2b                	push   $0x2b
+  8028a6:	50                   	push   %eax
+  8028a7:	e8 e6 e3 ff ff       	call   800c92 <strchr>
+  8028ac:	83 c4 10             	add    $0x10,%esp
+  8028af:	85 c0                	test   %eax,%eax
+  8028b1:	74 d9                	je     80288c <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8028b3:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8028b6:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8028b9:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8028bf:	eb cb                	jmp    80288c <parse_mode+0x1e>
+	switch (mode[0]) {
+  8028c1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028cb:	eb d2                	jmp    80289f <parse_mode+0x31>
+  8028cd:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8028d2:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8028d7:	eb c6                	jmp    80289f <parse_mode+0x31>
+
+008028d9 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	57                   	push   %edi
+  8028dd:	56                   	push   %esi
+  8028de:	53                   	push   %ebx
+  8028df:	83 ec 1c             	sub    $0x1c,%esp
+  8028e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028e5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8028e8:	b8 24 60 80 00       	mov    $0x806024,%eax
+  8028ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8028f2:	83 c0 24             	add    $0x24,%eax
+  8028f5:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8028f9:	74 17                	je     802912 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8028fb:	83 c3 01             	add    $0x1,%ebx
+  8028fe:	83 fb 10             	cmp    $0x10,%ebx
+  802901:	75 ef                	jne    8028f2 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802903:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802908:	89 f0                	mov    %esi,%eax
+  80290a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80290d:	5b                   	pop    %ebx
+  80290e:	5e                   	pop    %esi
+  80290f:	5f                   	pop    %edi
+  802910:	5d                   	pop    %ebp
+  802911:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802912:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802919:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80291c:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80291f:	c1 e7 02             	shl    $0x2,%edi
+  802922:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802928:	83 ec 04             	sub    $0x4,%esp
+  80292b:	6a 24                	push   $0x24
+  80292d:	6a 00                	push   $0x0
+  80292f:	56                   	push   %esi
+  802930:	e8 9c e3 ff ff       	call   800cd1 <memset>
+			streams[i].f_fd = fd;
+  802935:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802938:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  80293e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802941:	01 d8                	add    %ebx,%eax
+  802943:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802946:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	eb b6                	jmp    802908 <stream_alloc+0x2f>
+
+00802952 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802952:	55                   	push   %ebp
+  802953:	89 e5                	mov    %esp,%ebp
+  802955:	53                   	push   %ebx
+  802956:	83 ec 14             	sub    $0x14,%esp
+  802959:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80295b:	8b 40 18             	mov    0x18(%eax),%eax
+  80295e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802961:	74 4a                	je     8029ad <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802963:	83 ec 08             	sub    $0x8,%esp
+  802966:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	ff 33                	push   (%ebx)
+  80296c:	e8 e2 f1 ff ff       	call   801b53 <fd_lookup>
+  802971:	89 c2                	mov    %eax,%edx
+  802973:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802976:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80297b:	85 d2                	test   %edx,%edx
+  80297d:	78 41                	js     8029c0 <stream_unread+0x6e>
+  80297f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802982:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802988:	39 0a                	cmp    %ecx,(%edx)
+  80298a:	75 34                	jne    8029c0 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80298c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80298f:	03 42 04             	add    0x4(%edx),%eax
+  802992:	2b 43 18             	sub    0x18(%ebx),%eax
+  802995:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802998:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80299f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8029a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ab:	eb 13                	jmp    8029c0 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8029ad:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8029b4:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8029bb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8029c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+
+008029c5 <stream_drain>:
+{
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	56                   	push   %esi
+  8029c9:	53                   	push   %ebx
+  8029ca:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8029cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d1:	eb 02                	jmp    8029d5 <stream_drain+0x10>
+  8029d3:	01 c3                	add    %eax,%ebx
+  8029d5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8029d8:	39 c3                	cmp    %eax,%ebx
+  8029da:	73 43                	jae    802a1f <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8029dc:	83 ec 04             	sub    $0x4,%esp
+  8029df:	29 d8                	sub    %ebx,%eax
+  8029e1:	50                   	push   %eax
+  8029e2:	89 d8                	mov    %ebx,%eax
+  8029e4:	03 46 0c             	add    0xc(%esi),%eax
+  8029e7:	50                   	push   %eax
+  8029e8:	ff 36                	push   (%esi)
+  8029ea:	e8 ec f4 ff ff       	call   801edb <write>
+  8029ef:	83 c4 10             	add    $0x10,%esp
+  8029f2:	85 c0                	test   %eax,%eax
+  8029f4:	7f dd                	jg     8029d3 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8029f6:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8029fa:	8b 56 0c             	mov    0xc(%esi),%edx
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a03:	29 d8                	sub    %ebx,%eax
+  802a05:	50                   	push   %eax
+  802a06:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802a09:	50                   	push   %eax
+  802a0a:	52                   	push   %edx
+  802a0b:	e8 f6 e2 ff ff       	call   800d06 <memmove>
+			f->f_wend -= done;
+  802a10:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a13:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802a15:	83 c4 10             	add    $0x10,%esp
+  802a18:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a1d:	eb 0a                	jmp    802a29 <stream_drain+0x64>
+  802a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802a24:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802a29:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802a2c:	89 d0                	mov    %edx,%eax
+  802a2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a31:	5b                   	pop    %ebx
+  802a32:	5e                   	pop    %esi
+  802a33:	5d                   	pop    %ebp
+  802a34:	c3                   	ret
+
+00802a35 <stream_setup>:
+	if (f->f_buf)
+  802a35:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a39:	74 01                	je     802a3c <stream_setup+0x7>
+  802a3b:	c3                   	ret
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	53                   	push   %ebx
+  802a40:	83 ec 04             	sub    $0x4,%esp
+  802a43:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802a45:	8b 40 08             	mov    0x8(%eax),%eax
+  802a48:	85 c0                	test   %eax,%eax
+  802a4a:	74 17                	je     802a63 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802a4c:	83 f8 03             	cmp    $0x3,%eax
+  802a4f:	75 2d                	jne    802a7e <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802a51:	8d 43 20             	lea    0x20(%ebx),%eax
+  802a54:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802a57:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802a63:	83 ec 0c             	sub    $0xc,%esp
+  802a66:	ff 33                	push   (%ebx)
+  802a68:	e8 7a 1b 00 00       	call   8045e7 <iscons>
+  802a6d:	83 c4 10             	add    $0x10,%esp
+  802a70:	85 c0                	test   %eax,%eax
+  802a72:	0f 9f c0             	setg   %al
+  802a75:	0f b6 c0             	movzbl %al,%eax
+  802a78:	83 c0 01             	add    $0x1,%eax
+  802a7b:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802a7e:	83 ec 0c             	sub    $0xc,%esp
+  802a81:	68 00 10 00 00       	push   $0x1000
+  802a86:	e8 6e 0b 00 00       	call   8035f9 <malloc>
+  802a8b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a8e:	83 c4 10             	add    $0x10,%esp
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	74 bc                	je     802a51 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802a95:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802a9c:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802aa0:	eb bc                	jmp    802a5e <stream_setup+0x29>
+
+00802aa2 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802aa2:	55                   	push   %ebp
+  802aa3:	89 e5                	mov    %esp,%ebp
+  802aa5:	53                   	push   %ebx
+  802aa6:	83 ec 04             	sub    $0x4,%esp
+  802aa9:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802aab:	e8 85 ff ff ff       	call   802a35 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802ab5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802ab9:	74 3d                	je     802af8 <stream_fill+0x56>
+  802abb:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802abf:	74 10                	je     802ad1 <stream_fill+0x2f>
+  802ac1:	89 d8                	mov    %ebx,%eax
+  802ac3:	e8 fd fe ff ff       	call   8029c5 <stream_drain>
+		return 0;
+  802ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	78 27                	js     802af8 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802ad1:	83 ec 04             	sub    $0x4,%esp
+  802ad4:	ff 73 10             	push   0x10(%ebx)
+  802ad7:	ff 73 0c             	push   0xc(%ebx)
+  802ada:	ff 33                	push   (%ebx)
+  802adc:	e8 02 f3 ff ff       	call   801de3 <read>
+  802ae1:	83 c4 10             	add    $0x10,%esp
+  802ae4:	85 c0                	test   %eax,%eax
+  802ae6:	7e 17                	jle    802aff <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802ae8:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802aec:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802af3:	89 c2                	mov    %eax,%edx
+  802af5:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802af8:	89 d0                	mov    %edx,%eax
+  802afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afd:	c9                   	leave
+  802afe:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802aff:	c1 f8 1f             	sar    $0x1f,%eax
+  802b02:	83 e0 04             	and    $0x4,%eax
+  802b05:	83 c0 04             	add    $0x4,%eax
+  802b08:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b10:	eb e6                	jmp    802af8 <stream_fill+0x56>
+
+00802b12 <fopen>:
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	57                   	push   %edi
+  802b16:	56                   	push   %esi
+  802b17:	53                   	push   %ebx
+  802b18:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802b1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b21:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802b27:	89 f0                	mov    %esi,%eax
+  802b29:	e8 40 fd ff ff       	call   80286e <parse_mode>
+		return 0;
+  802b2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 2d                	js     802b64 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802b37:	83 ec 08             	sub    $0x8,%esp
+  802b3a:	50                   	push   %eax
+  802b3b:	ff 75 08             	push   0x8(%ebp)
+  802b3e:	e8 e8 f8 ff ff       	call   80242b <open>
+  802b43:	89 c7                	mov    %eax,%edi
+  802b45:	83 c4 10             	add    $0x10,%esp
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	78 58                	js     802ba4 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802b4c:	80 3e 61             	cmpb   $0x61,(%esi)
+  802b4f:	74 1d                	je     802b6e <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802b51:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802b57:	89 f8                	mov    %edi,%eax
+  802b59:	e8 7b fd ff ff       	call   8028d9 <stream_alloc>
+  802b5e:	89 c3                	mov    %eax,%ebx
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	74 32                	je     802b96 <fopen+0x84>
+}
+  802b64:	89 d8                	mov    %ebx,%eax
+  802b66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b69:	5b                   	pop    %ebx
+  802b6a:	5e                   	pop    %esi
+  802b6b:	5f                   	pop    %edi
+  802b6c:	5d                   	pop    %ebp
+  802b6d:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802b6e:	83 ec 08             	sub    $0x8,%esp
+  802b71:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802b77:	50                   	push   %eax
+  802b78:	57                   	push   %edi
+  802b79:	e8 db f4 ff ff       	call   802059 <fstat>
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	78 cc                	js     802b51 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802b85:	83 ec 08             	sub    $0x8,%esp
+  802b88:	ff 75 dc             	push   -0x24(%ebp)
+  802b8b:	57                   	push   %edi
+  802b8c:	e8 f6 f3 ff ff       	call   801f87 <seek>
+  802b91:	83 c4 10             	add    $0x10,%esp
+  802b94:	eb bb                	jmp    802b51 <fopen+0x3f>
+		close(fd);
+  802b96:	83 ec 0c             	sub    $0xc,%esp
+  802b99:	57                   	push   %edi
+  802b9a:	e8 08 f1 ff ff       	call   801ca7 <close>
+  802b9f:	83 c4 10             	add    $0x10,%esp
+  802ba2:	eb c0                	jmp    802b64 <fopen+0x52>
+		return 0;
+  802ba4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ba9:	eb b9                	jmp    802b64 <fopen+0x52>
+
+00802bab <fdopen>:
+{
+  802bab:	55                   	push   %ebp
+  802bac:	89 e5                	mov    %esp,%ebp
+  802bae:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802bb1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bb7:	e8 b2 fc ff ff       	call   80286e <parse_mode>
+  802bbc:	89 c2                	mov    %eax,%edx
+		return 0;
+  802bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802bc3:	85 d2                	test   %edx,%edx
+  802bc5:	78 0b                	js     802bd2 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802bc7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	e8 07 fd ff ff       	call   8028d9 <stream_alloc>
+}
+  802bd2:	c9                   	leave
+  802bd3:	c3                   	ret
+
+00802bd4 <setvbuf>:
+{
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	57                   	push   %edi
+  802bd8:	56                   	push   %esi
+  802bd9:	53                   	push   %ebx
+  802bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdd:	8b 55 10             	mov    0x10(%ebp),%edx
+  802be0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802be3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802be7:	75 3a                	jne    802c23 <setvbuf+0x4f>
+  802be9:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802bec:	83 fe 02             	cmp    $0x2,%esi
+  802bef:	77 39                	ja     802c2a <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802bf1:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802bf4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802bf8:	0f 95 c3             	setne  %bl
+  802bfb:	85 ff                	test   %edi,%edi
+  802bfd:	0f 95 c1             	setne  %cl
+  802c00:	84 cb                	test   %cl,%bl
+  802c02:	74 05                	je     802c09 <setvbuf+0x35>
+  802c04:	83 fa 03             	cmp    $0x3,%edx
+  802c07:	75 0a                	jne    802c13 <setvbuf+0x3f>
+	return 0;
+  802c09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c0e:	5b                   	pop    %ebx
+  802c0f:	5e                   	pop    %esi
+  802c10:	5f                   	pop    %edi
+  802c11:	5d                   	pop    %ebp
+  802c12:	c3                   	ret
+		f->f_buf = buf;
+  802c13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c16:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802c19:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c21:	eb eb                	jmp    802c0e <setvbuf+0x3a>
+		return EOF;
+  802c23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c28:	eb e4                	jmp    802c0e <setvbuf+0x3a>
+  802c2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c2f:	eb dd                	jmp    802c0e <setvbuf+0x3a>
+
+00802c31 <fflush>:
+{
+  802c31:	55                   	push   %ebp
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	57                   	push   %edi
+  802c35:	56                   	push   %esi
+  802c36:	53                   	push   %ebx
+  802c37:	83 ec 0c             	sub    $0xc,%esp
+  802c3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802c3d:	85 db                	test   %ebx,%ebx
+  802c3f:	74 1a                	je     802c5b <fflush+0x2a>
+	stream_unread(f);
+  802c41:	89 d8                	mov    %ebx,%eax
+  802c43:	e8 0a fd ff ff       	call   802952 <stream_unread>
+	return stream_drain(f);
+  802c48:	89 d8                	mov    %ebx,%eax
+  802c4a:	e8 76 fd ff ff       	call   8029c5 <stream_drain>
+  802c4f:	89 c7                	mov    %eax,%edi
+}
+  802c51:	89 f8                	mov    %edi,%eax
+  802c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c56:	5b                   	pop    %ebx
+  802c57:	5e                   	pop    %esi
+  802c58:	5f                   	pop    %edi
+  802c59:	5d                   	pop    %ebp
+  802c5a:	c3                   	ret
+  802c5b:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802c60:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6a:	eb 03                	jmp    802c6f <fflush+0x3e>
+  802c6c:	83 c3 24             	add    $0x24,%ebx
+  802c6f:	39 f3                	cmp    %esi,%ebx
+  802c71:	74 de                	je     802c51 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802c73:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802c77:	74 f3                	je     802c6c <fflush+0x3b>
+  802c79:	83 ec 0c             	sub    $0xc,%esp
+  802c7c:	53                   	push   %ebx
+  802c7d:	e8 af ff ff ff       	call   802c31 <fflush>
+  802c82:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802c85:	85 c0                	test   %eax,%eax
+  802c87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c8c:	0f 48 f8             	cmovs  %eax,%edi
+  802c8f:	eb db                	jmp    802c6c <fflush+0x3b>
+
+00802c91 <fclose>:
+{
+  802c91:	55                   	push   %ebp
+  802c92:	89 e5                	mov    %esp,%ebp
+  802c94:	56                   	push   %esi
+  802c95:	53                   	push   %ebx
+  802c96:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+  802c9c:	56                   	push   %esi
+  802c9d:	e8 8f ff ff ff       	call   802c31 <fflush>
+  802ca2:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802ca4:	83 c4 04             	add    $0x4,%esp
+  802ca7:	ff 36                	push   (%esi)
+  802ca9:	e8 f9 ef ff ff       	call   801ca7 <close>
+  802cae:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802cb1:	85 c0                	test   %eax,%eax
+  802cb3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802cb8:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802cbb:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802cbf:	75 10                	jne    802cd1 <fclose+0x40>
+	f->f_flags = 0;
+  802cc1:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802cc8:	89 d8                	mov    %ebx,%eax
+  802cca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ccd:	5b                   	pop    %ebx
+  802cce:	5e                   	pop    %esi
+  802ccf:	5d                   	pop    %ebp
+  802cd0:	c3                   	ret
+		free(f->f_buf);
+  802cd1:	83 ec 0c             	sub    $0xc,%esp
+  802cd4:	ff 76 0c             	push   0xc(%esi)
+  802cd7:	e8 54 08 00 00       	call   803530 <free>
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	eb e0                	jmp    802cc1 <fclose+0x30>
+
+00802ce1 <fileno>:
+{
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce7:	8b 00                	mov    (%eax),%eax
+}
+  802ce9:	5d                   	pop    %ebp
+  802cea:	c3                   	ret
+
+00802ceb <feof>:
+{
+  802ceb:	55                   	push   %ebp
+  802cec:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802cee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf1:	8b 40 04             	mov    0x4(%eax),%eax
+  802cf4:	c1 e8 02             	shr    $0x2,%eax
+  802cf7:	83 e0 01             	and    $0x1,%eax
+}
+  802cfa:	5d                   	pop    %ebp
+  802cfb:	c3                   	ret
+
+00802cfc <ferror>:
+{
+  802cfc:	55                   	push   %ebp
+  802cfd:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802cff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d02:	8b 40 04             	mov    0x4(%eax),%eax
+  802d05:	c1 e8 03             	shr    $0x3,%eax
+  802d08:	83 e0 01             	and    $0x1,%eax
+}
+  802d0b:	5d                   	pop    %ebp
+  802d0c:	c3                   	ret
+
+00802d0d <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	53                   	push   %ebx
+  802d11:	83 ec 04             	sub    $0x4,%esp
+  802d14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d17:	8b 43 18             	mov    0x18(%ebx),%eax
+  802d1a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802d1d:	74 15                	je     802d34 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802d1f:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802d22:	8b 43 14             	mov    0x14(%ebx),%eax
+  802d25:	8d 48 01             	lea    0x1(%eax),%ecx
+  802d28:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802d2b:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802d2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d32:	c9                   	leave
+  802d33:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d34:	89 d8                	mov    %ebx,%eax
+  802d36:	e8 67 fd ff ff       	call   802aa2 <stream_fill>
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	75 e0                	jne    802d1f <fgetc+0x12>
+		return EOF;
+  802d3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d44:	eb e9                	jmp    802d2f <fgetc+0x22>
+
+00802d46 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802d46:	55                   	push   %ebp
+  802d47:	89 e5                	mov    %esp,%ebp
+  802d49:	57                   	push   %edi
+  802d4a:	56                   	push   %esi
+  802d4b:	53                   	push   %ebx
+  802d4c:	83 ec 1c             	sub    $0x1c,%esp
+  802d4f:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802d52:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802d57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d5a:	83 e8 01             	sub    $0x1,%eax
+  802d5d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802d60:	eb 66                	jmp    802dc8 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802d62:	8b 46 14             	mov    0x14(%esi),%eax
+  802d65:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802d68:	29 c3                	sub    %eax,%ebx
+  802d6a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802d6d:	29 fa                	sub    %edi,%edx
+  802d6f:	39 d3                	cmp    %edx,%ebx
+  802d71:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802d74:	83 ec 04             	sub    $0x4,%esp
+  802d77:	53                   	push   %ebx
+  802d78:	6a 0a                	push   $0xa
+  802d7a:	03 46 0c             	add    0xc(%esi),%eax
+  802d7d:	50                   	push   %eax
+  802d7e:	e8 34 e0 ff ff       	call   800db7 <memfind>
+  802d83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802d86:	8b 46 0c             	mov    0xc(%esi),%eax
+  802d89:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802d8c:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802d8f:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d97:	74 0b                	je     802da4 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802d99:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d9c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d9f:	29 d3                	sub    %edx,%ebx
+  802da1:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802da4:	83 ec 04             	sub    $0x4,%esp
+  802da7:	53                   	push   %ebx
+  802da8:	01 c8                	add    %ecx,%eax
+  802daa:	50                   	push   %eax
+  802dab:	89 f8                	mov    %edi,%eax
+  802dad:	03 45 08             	add    0x8(%ebp),%eax
+  802db0:	50                   	push   %eax
+  802db1:	e8 50 df ff ff       	call   800d06 <memmove>
+		f->f_rpos += m;
+  802db6:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802db9:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802dbb:	83 c4 10             	add    $0x10,%esp
+  802dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc1:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802dc6:	74 1f                	je     802de7 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802dc8:	8d 47 01             	lea    0x1(%edi),%eax
+  802dcb:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802dce:	73 17                	jae    802de7 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802dd0:	8b 46 18             	mov    0x18(%esi),%eax
+  802dd3:	39 46 14             	cmp    %eax,0x14(%esi)
+  802dd6:	75 8a                	jne    802d62 <fgets+0x1c>
+  802dd8:	89 f0                	mov    %esi,%eax
+  802dda:	e8 c3 fc ff ff       	call   802aa2 <stream_fill>
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	0f 85 7b ff ff ff    	jne    802d62 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802de7:	85 ff                	test   %edi,%edi
+  802de9:	74 0f                	je     802dfa <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dee:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802df2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df5:	5b                   	pop    %ebx
+  802df6:	5e                   	pop    %esi
+  802df7:	5f                   	pop    %edi
+  802df8:	5d                   	pop    %ebp
+  802df9:	c3                   	ret
+		return 0;
+  802dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dff:	eb f1                	jmp    802df2 <fgets+0xac>
+
+00802e01 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802e01:	55                   	push   %ebp
+  802e02:	89 e5                	mov    %esp,%ebp
+  802e04:	57                   	push   %edi
+  802e05:	56                   	push   %esi
+  802e06:	53                   	push   %ebx
+  802e07:	83 ec 1c             	sub    $0x1c,%esp
+  802e0a:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802e0d:	89 f0                	mov    %esi,%eax
+  802e0f:	e8 21 fc ff ff       	call   802a35 <stream_setup>
+	want = size * n;
+  802e14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e17:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e1b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e23:	eb 43                	jmp    802e68 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802e25:	29 d3                	sub    %edx,%ebx
+  802e27:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e2a:	29 f8                	sub    %edi,%eax
+  802e2c:	39 c3                	cmp    %eax,%ebx
+  802e2e:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802e31:	83 ec 04             	sub    $0x4,%esp
+  802e34:	53                   	push   %ebx
+  802e35:	03 56 0c             	add    0xc(%esi),%edx
+  802e38:	52                   	push   %edx
+  802e39:	89 f8                	mov    %edi,%eax
+  802e3b:	03 45 08             	add    0x8(%ebp),%eax
+  802e3e:	50                   	push   %eax
+  802e3f:	e8 c2 de ff ff       	call   800d06 <memmove>
+			f->f_rpos += m;
+  802e44:	01 5e 14             	add    %ebx,0x14(%esi)
+  802e47:	83 c4 10             	add    $0x10,%esp
+  802e4a:	eb 1a                	jmp    802e66 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802e4c:	83 ec 04             	sub    $0x4,%esp
+  802e4f:	53                   	push   %ebx
+  802e50:	89 f8                	mov    %edi,%eax
+  802e52:	03 45 08             	add    0x8(%ebp),%eax
+  802e55:	50                   	push   %eax
+  802e56:	ff 36                	push   (%esi)
+  802e58:	e8 86 ef ff ff       	call   801de3 <read>
+  802e5d:	89 c3                	mov    %eax,%ebx
+  802e5f:	83 c4 10             	add    $0x10,%esp
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	7e 36                	jle    802e9c <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802e66:	01 df                	add    %ebx,%edi
+  802e68:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e6b:	39 c7                	cmp    %eax,%edi
+  802e6d:	73 39                	jae    802ea8 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802e6f:	8b 56 14             	mov    0x14(%esi),%edx
+  802e72:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802e75:	39 da                	cmp    %ebx,%edx
+  802e77:	72 ac                	jb     802e25 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802e79:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e7c:	29 fb                	sub    %edi,%ebx
+  802e7e:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802e81:	72 3e                	jb     802ec1 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802e83:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802e87:	74 1f                	je     802ea8 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802e89:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802e8d:	74 bd                	je     802e4c <fread+0x4b>
+  802e8f:	89 f0                	mov    %esi,%eax
+  802e91:	e8 2f fb ff ff       	call   8029c5 <stream_drain>
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	79 b2                	jns    802e4c <fread+0x4b>
+  802e9a:	eb 0c                	jmp    802ea8 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802e9c:	c1 fb 1f             	sar    $0x1f,%ebx
+  802e9f:	83 e3 04             	and    $0x4,%ebx
+  802ea2:	83 c3 04             	add    $0x4,%ebx
+  802ea5:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802ea8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	74 0a                	je     802eb9 <fread+0xb8>
+  802eaf:	89 f8                	mov    %edi,%eax
+  802eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb6:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802eb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ebc:	5b                   	pop    %ebx
+  802ebd:	5e                   	pop    %esi
+  802ebe:	5f                   	pop    %edi
+  802ebf:	5d                   	pop    %ebp
+  802ec0:	c3                   	ret
+		} else if (!stream_fill(f))
+  802ec1:	89 f0                	mov    %esi,%eax
+  802ec3:	e8 da fb ff ff       	call   802aa2 <stream_fill>
+  802ec8:	85 c0                	test   %eax,%eax
+  802eca:	74 dc                	je     802ea8 <fread+0xa7>
+			m = 0;
+  802ecc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed1:	eb 93                	jmp    802e66 <fread+0x65>
+
+00802ed3 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802ed3:	55                   	push   %ebp
+  802ed4:	89 e5                	mov    %esp,%ebp
+  802ed6:	57                   	push   %edi
+  802ed7:	56                   	push   %esi
+  802ed8:	53                   	push   %ebx
+  802ed9:	83 ec 1c             	sub    $0x1c,%esp
+  802edc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802edf:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ee2:	a8 02                	test   $0x2,%al
+  802ee4:	75 13                	jne    802ef9 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802ee6:	83 c8 08             	or     $0x8,%eax
+  802ee9:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802eec:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef4:	5b                   	pop    %ebx
+  802ef5:	5e                   	pop    %esi
+  802ef6:	5f                   	pop    %edi
+  802ef7:	5d                   	pop    %ebp
+  802ef8:	c3                   	ret
+	stream_setup(f);
+  802ef9:	89 d8                	mov    %ebx,%eax
+  802efb:	e8 35 fb ff ff       	call   802a35 <stream_setup>
+	want = size * n;
+  802f00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f03:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802f07:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802f0a:	89 d8                	mov    %ebx,%eax
+  802f0c:	e8 41 fa ff ff       	call   802952 <stream_unread>
+	for (done = 0; done < want; ) {
+  802f11:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802f16:	84 c0                	test   %al,%al
+  802f18:	75 7b                	jne    802f95 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802f1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802f22:	39 fe                	cmp    %edi,%esi
+  802f24:	73 24                	jae    802f4a <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802f26:	83 ec 04             	sub    $0x4,%esp
+  802f29:	89 f8                	mov    %edi,%eax
+  802f2b:	29 f0                	sub    %esi,%eax
+  802f2d:	50                   	push   %eax
+  802f2e:	89 f0                	mov    %esi,%eax
+  802f30:	03 45 08             	add    0x8(%ebp),%eax
+  802f33:	50                   	push   %eax
+  802f34:	ff 33                	push   (%ebx)
+  802f36:	e8 a0 ef ff ff       	call   801edb <write>
+  802f3b:	83 c4 10             	add    $0x10,%esp
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	7e 04                	jle    802f46 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802f42:	01 c6                	add    %eax,%esi
+  802f44:	eb dc                	jmp    802f22 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802f46:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802f4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f4d:	85 c0                	test   %eax,%eax
+  802f4f:	74 a0                	je     802ef1 <fwrite+0x1e>
+  802f51:	89 f0                	mov    %esi,%eax
+  802f53:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f58:	f7 75 0c             	divl   0xc(%ebp)
+  802f5b:	eb 94                	jmp    802ef1 <fwrite+0x1e>
+			done += r;
+  802f5d:	01 c7                	add    %eax,%edi
+			continue;
+  802f5f:	eb 34                	jmp    802f95 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802f61:	8b 73 10             	mov    0x10(%ebx),%esi
+  802f64:	29 c6                	sub    %eax,%esi
+  802f66:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f69:	29 fa                	sub    %edi,%edx
+  802f6b:	39 d6                	cmp    %edx,%esi
+  802f6d:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802f70:	83 ec 04             	sub    $0x4,%esp
+  802f73:	56                   	push   %esi
+  802f74:	89 fa                	mov    %edi,%edx
+  802f76:	03 55 08             	add    0x8(%ebp),%edx
+  802f79:	52                   	push   %edx
+  802f7a:	03 43 0c             	add    0xc(%ebx),%eax
+  802f7d:	50                   	push   %eax
+  802f7e:	e8 83 dd ff ff       	call   800d06 <memmove>
+		f->f_wend += m;
+  802f83:	89 f0                	mov    %esi,%eax
+  802f85:	03 43 1c             	add    0x1c(%ebx),%eax
+  802f88:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802f8b:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802f8d:	83 c4 10             	add    $0x10,%esp
+  802f90:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802f93:	74 5b                	je     802ff0 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802f95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f98:	39 c7                	cmp    %eax,%edi
+  802f9a:	73 2d                	jae    802fc9 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802f9c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802f9f:	85 c0                	test   %eax,%eax
+  802fa1:	75 be                	jne    802f61 <fwrite+0x8e>
+  802fa3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802fa6:	29 fa                	sub    %edi,%edx
+  802fa8:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802fab:	72 b4                	jb     802f61 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802fad:	83 ec 04             	sub    $0x4,%esp
+  802fb0:	52                   	push   %edx
+  802fb1:	89 f8                	mov    %edi,%eax
+  802fb3:	03 45 08             	add    0x8(%ebp),%eax
+  802fb6:	50                   	push   %eax
+  802fb7:	ff 33                	push   (%ebx)
+  802fb9:	e8 1d ef ff ff       	call   801edb <write>
+  802fbe:	83 c4 10             	add    $0x10,%esp
+  802fc1:	85 c0                	test   %eax,%eax
+  802fc3:	7f 98                	jg     802f5d <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802fc5:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802fc9:	8b 43 08             	mov    0x8(%ebx),%eax
+  802fcc:	83 f8 03             	cmp    $0x3,%eax
+  802fcf:	74 48                	je     803019 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802fd1:	83 f8 02             	cmp    $0x2,%eax
+  802fd4:	74 27                	je     802ffd <fwrite+0x12a>
+	return size ? done / size : 0;
+  802fd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	0f 84 10 ff ff ff    	je     802ef1 <fwrite+0x1e>
+  802fe1:	89 f8                	mov    %edi,%eax
+  802fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe8:	f7 75 0c             	divl   0xc(%ebp)
+  802feb:	e9 01 ff ff ff       	jmp    802ef1 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802ff0:	89 d8                	mov    %ebx,%eax
+  802ff2:	e8 ce f9 ff ff       	call   8029c5 <stream_drain>
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	79 9a                	jns    802f95 <fwrite+0xc2>
+  802ffb:	eb cc                	jmp    802fc9 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802ffd:	83 ec 04             	sub    $0x4,%esp
+  803000:	57                   	push   %edi
+  803001:	6a 0a                	push   $0xa
+  803003:	ff 75 08             	push   0x8(%ebp)
+  803006:	e8 ac dd ff ff       	call   800db7 <memfind>
+  80300b:	89 c2                	mov    %eax,%edx
+  80300d:	89 f8                	mov    %edi,%eax
+  80300f:	03 45 08             	add    0x8(%ebp),%eax
+  803012:	83 c4 10             	add    $0x10,%esp
+  803015:	39 c2                	cmp    %eax,%edx
+  803017:	74 bd                	je     802fd6 <fwrite+0x103>
+		stream_drain(f);
+  803019:	89 d8                	mov    %ebx,%eax
+  80301b:	e8 a5 f9 ff ff       	call   8029c5 <stream_drain>
+  803020:	eb b4                	jmp    802fd6 <fwrite+0x103>
+
+00803022 <fputc>:
+{
+  803022:	55                   	push   %ebp
+  803023:	89 e5                	mov    %esp,%ebp
+  803025:	53                   	push   %ebx
+  803026:	83 ec 14             	sub    $0x14,%esp
+  803029:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  80302c:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  80302f:	ff 75 0c             	push   0xc(%ebp)
+  803032:	6a 01                	push   $0x1
+  803034:	6a 01                	push   $0x1
+  803036:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803039:	50                   	push   %eax
+  80303a:	e8 94 fe ff ff       	call   802ed3 <fwrite>
+  80303f:	83 c4 10             	add    $0x10,%esp
+  803042:	0f b6 db             	movzbl %bl,%ebx
+  803045:	83 f8 01             	cmp    $0x1,%eax
+  803048:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80304d:	0f 44 c3             	cmove  %ebx,%eax
+}
+  803050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803053:	c9                   	leave
+  803054:	c3                   	ret
+
+00803055 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  803055:	55                   	push   %ebp
+  803056:	89 e5                	mov    %esp,%ebp
+  803058:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80305b:	ff 75 0c             	push   0xc(%ebp)
+  80305e:	ff 75 08             	push   0x8(%ebp)
+  803061:	e8 bc ff ff ff       	call   803022 <fputc>
+}
+  803066:	83 c4 10             	add    $0x10,%esp
+  803069:	c9                   	leave
+  80306a:	c3                   	ret
+
+0080306b <fputs>:
+{
+  80306b:	55                   	push   %ebp
+  80306c:	89 e5                	mov    %esp,%ebp
+  80306e:	56                   	push   %esi
+  80306f:	53                   	push   %ebx
+  803070:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  803073:	83 ec 0c             	sub    $0xc,%esp
+  803076:	56                   	push   %esi
+  803077:	e8 c9 da ff ff       	call   800b45 <strlen>
+  80307c:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80307e:	ff 75 0c             	push   0xc(%ebp)
+  803081:	50                   	push   %eax
+  803082:	6a 01                	push   $0x1
+  803084:	56                   	push   %esi
+  803085:	e8 49 fe ff ff       	call   802ed3 <fwrite>
+  80308a:	83 c4 20             	add    $0x20,%esp
+  80308d:	39 d8                	cmp    %ebx,%eax
+  80308f:	0f 95 c0             	setne  %al
+  803092:	0f b6 c0             	movzbl %al,%eax
+  803095:	f7 d8                	neg    %eax
+}
+  803097:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80309a:	5b                   	pop    %ebx
+  80309b:	5e                   	pop    %esi
+  80309c:	5d                   	pop    %ebp
+  80309d:	c3                   	ret
+
+0080309e <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80309e:	55                   	push   %ebp
+  80309f:	89 e5                	mov    %esp,%ebp
+  8030a1:	53                   	push   %ebx
+  8030a2:	83 ec 04             	sub    $0x4,%esp
+  8030a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8030a8:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8030ab:	50                   	push   %eax
+  8030ac:	ff 75 0c             	push   0xc(%ebp)
+  8030af:	53                   	push   %ebx
+  8030b0:	68 55 30 80 00       	push   $0x803055
+  8030b5:	e8 d9 d5 ff ff       	call   800693 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8030ba:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030bd:	c1 e0 1c             	shl    $0x1c,%eax
+  8030c0:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8030c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030c6:	c9                   	leave
+  8030c7:	c3                   	ret
+
+008030c8 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030c8:	55                   	push   %ebp
+  8030c9:	89 e5                	mov    %esp,%ebp
+  8030cb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8030ce:	68 48 52 80 00       	push   $0x805248
+  8030d3:	ff 75 0c             	push   0xc(%ebp)
+  8030d6:	e8 a5 da ff ff       	call   800b80 <strcpy>
+	return 0;
+}
+  8030db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e0:	c9                   	leave
+  8030e1:	c3                   	ret
+
+008030e2 <devsock_close>:
+{
+  8030e2:	55                   	push   %ebp
+  8030e3:	89 e5                	mov    %esp,%ebp
+  8030e5:	53                   	push   %ebx
+  8030e6:	83 ec 10             	sub    $0x10,%esp
+  8030e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8030ec:	53                   	push   %ebx
+  8030ed:	e8 62 17 00 00       	call   804854 <pageref>
+  8030f2:	89 c2                	mov    %eax,%edx
+  8030f4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8030f7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8030fc:	83 fa 01             	cmp    $0x1,%edx
+  8030ff:	74 05                	je     803106 <devsock_close+0x24>
+}
+  803101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803104:	c9                   	leave
+  803105:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803106:	83 ec 0c             	sub    $0xc,%esp
+  803109:	ff 73 0c             	push   0xc(%ebx)
+  80310c:	e8 b7 02 00 00       	call   8033c8 <nsipc_close>
+  803111:	83 c4 10             	add    $0x10,%esp
+  803114:	eb eb                	jmp    803101 <devsock_close+0x1f>
+
+00803116 <devsock_write>:
+{
+  803116:	55                   	push   %ebp
+  803117:	89 e5                	mov    %esp,%ebp
+  803119:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80311c:	6a 00                	push   $0x0
+  80311e:	ff 75 10             	push   0x10(%ebp)
+  803121:	ff 75 0c             	push   0xc(%ebp)
+  803124:	8b 45 08             	mov    0x8(%ebp),%eax
+  803127:	ff 70 0c             	push   0xc(%eax)
+  80312a:	e8 79 03 00 00       	call   8034a8 <nsipc_send>
+}
+  80312f:	c9                   	leave
+  803130:	c3                   	ret
+
+00803131 <devsock_read>:
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803137:	6a 00                	push   $0x0
+  803139:	ff 75 10             	push   0x10(%ebp)
+  80313c:	ff 75 0c             	push   0xc(%ebp)
+  80313f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803142:	ff 70 0c             	push   0xc(%eax)
+  803145:	e8 ef 02 00 00       	call   803439 <nsipc_recv>
+}
+  80314a:	c9                   	leave
+  80314b:	c3                   	ret
+
+0080314c <fd2sockid>:
+{
+  80314c:	55                   	push   %ebp
+  80314d:	89 e5                	mov    %esp,%ebp
+  80314f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803152:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803155:	52                   	push   %edx
+  803156:	50                   	push   %eax
+  803157:	e8 f7 e9 ff ff       	call   801b53 <fd_lookup>
+  80315c:	83 c4 10             	add    $0x10,%esp
+  80315f:	85 c0                	test   %eax,%eax
+  803161:	78 10                	js     803173 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803163:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803166:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  80316c:	39 08                	cmp    %ecx,(%eax)
+  80316e:	75 05                	jne    803175 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803170:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+		return -E_NOT_SUPP;
+  803175:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80317a:	eb f7                	jmp    803173 <fd2sockid+0x27>
+
+0080317c <alloc_sockfd>:
+{
+  80317c:	55                   	push   %ebp
+  80317d:	89 e5                	mov    %esp,%ebp
+  80317f:	56                   	push   %esi
+  803180:	53                   	push   %ebx
+  803181:	83 ec 1c             	sub    $0x1c,%esp
+  803184:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803186:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803189:	50                   	push   %eax
+  80318a:	e8 6e e9 ff ff       	call   801afd <fd_alloc>
+  80318f:	89 c3                	mov    %eax,%ebx
+  803191:	83 c4 10             	add    $0x10,%esp
+  803194:	85 c0                	test   %eax,%eax
+  803196:	78 43                	js     8031db <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803198:	83 ec 04             	sub    $0x4,%esp
+  80319b:	68 07 04 00 00       	push   $0x407
+  8031a0:	ff 75 f4             	push   -0xc(%ebp)
+  8031a3:	6a 00                	push   $0x0
+  8031a5:	e8 14 de ff ff       	call   800fbe <sys_page_alloc>
+  8031aa:	89 c3                	mov    %eax,%ebx
+  8031ac:	83 c4 10             	add    $0x10,%esp
+  8031af:	85 c0                	test   %eax,%eax
+  8031b1:	78 28                	js     8031db <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8031b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b6:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8031bc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8031be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8031c8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8031cb:	83 ec 0c             	sub    $0xc,%esp
+  8031ce:	50                   	push   %eax
+  8031cf:	e8 02 e9 ff ff       	call   801ad6 <fd2num>
+  8031d4:	89 c3                	mov    %eax,%ebx
+  8031d6:	83 c4 10             	add    $0x10,%esp
+  8031d9:	eb 0c                	jmp    8031e7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8031db:	83 ec 0c             	sub    $0xc,%esp
+  8031de:	56                   	push   %esi
+  8031df:	e8 e4 01 00 00       	call   8033c8 <nsipc_close>
+		return r;
+  8031e4:	83 c4 10             	add    $0x10,%esp
+}
+  8031e7:	89 d8                	mov    %ebx,%eax
+  8031e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5d                   	pop    %ebp
+  8031ef:	c3                   	ret
+
+008031f0 <accept>:
+{
+  8031f0:	55                   	push   %ebp
+  8031f1:	89 e5                	mov    %esp,%ebp
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f9:	e8 4e ff ff ff       	call   80314c <fd2sockid>
+  8031fe:	85 c0                	test   %eax,%eax
+  803200:	78 1b                	js     80321d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803202:	83 ec 04             	sub    $0x4,%esp
+  803205:	ff 75 10             	push   0x10(%ebp)
+  803208:	ff 75 0c             	push   0xc(%ebp)
+  80320b:	50                   	push   %eax
+  80320c:	e8 0e 01 00 00       	call   80331f <nsipc_accept>
+  803211:	83 c4 10             	add    $0x10,%esp
+  803214:	85 c0                	test   %eax,%eax
+  803216:	78 05                	js     80321d <accept+0x2d>
+	return alloc_sockfd(r);
+  803218:	e8 5f ff ff ff       	call   80317c <alloc_sockfd>
+}
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+
+0080321f <bind>:
+{
+  80321f:	55                   	push   %ebp
+  803220:	89 e5                	mov    %esp,%ebp
+  803222:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803225:	8b 45 08             	mov    0x8(%ebp),%eax
+  803228:	e8 1f ff ff ff       	call   80314c <fd2sockid>
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	78 12                	js     803243 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803231:	83 ec 04             	sub    $0x4,%esp
+  803234:	ff 75 10             	push   0x10(%ebp)
+  803237:	ff 75 0c             	push   0xc(%ebp)
+  80323a:	50                   	push   %eax
+  80323b:	e8 31 01 00 00       	call   803371 <nsipc_bind>
+  803240:	83 c4 10             	add    $0x10,%esp
+}
+  803243:	c9                   	leave
+  803244:	c3                   	ret
+
+00803245 <shutdown>:
+{
+  803245:	55                   	push   %ebp
+  803246:	89 e5                	mov    %esp,%ebp
+  803248:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80324b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80324e:	e8 f9 fe ff ff       	call   80314c <fd2sockid>
+  803253:	85 c0                	test   %eax,%eax
+  803255:	78 0f                	js     803266 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803257:	83 ec 08             	sub    $0x8,%esp
+  80325a:	ff 75 0c             	push   0xc(%ebp)
+  80325d:	50                   	push   %eax
+  80325e:	e8 43 01 00 00       	call   8033a6 <nsipc_shutdown>
+  803263:	83 c4 10             	add    $0x10,%esp
+}
+  803266:	c9                   	leave
+  803267:	c3                   	ret
+
+00803268 <connect>:
+{
+  803268:	55                   	push   %ebp
+  803269:	89 e5                	mov    %esp,%ebp
+  80326b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80326e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803271:	e8 d6 fe ff ff       	call   80314c <fd2sockid>
+  803276:	85 c0                	test   %eax,%eax
+  803278:	78 12                	js     80328c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80327a:	83 ec 04             	sub    $0x4,%esp
+  80327d:	ff 75 10             	push   0x10(%ebp)
+  803280:	ff 75 0c             	push   0xc(%ebp)
+  803283:	50                   	push   %eax
+  803284:	e8 59 01 00 00       	call   8033e2 <nsipc_connect>
+  803289:	83 c4 10             	add    $0x10,%esp
+}
+  80328c:	c9                   	leave
+  80328d:	c3                   	ret
+
+0080328e <listen>:
+{
+  80328e:	55                   	push   %ebp
+  80328f:	89 e5                	mov    %esp,%ebp
+  803291:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803294:	8b 45 08             	mov    0x8(%ebp),%eax
+  803297:	e8 b0 fe ff ff       	call   80314c <fd2sockid>
+  80329c:	85 c0                	test   %eax,%eax
+  80329e:	78 0f                	js     8032af <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8032a0:	83 ec 08             	sub    $0x8,%esp
+  8032a3:	ff 75 0c             	push   0xc(%ebp)
+  8032a6:	50                   	push   %eax
+  8032a7:	e8 6b 01 00 00       	call   803417 <nsipc_listen>
+  8032ac:	83 c4 10             	add    $0x10,%esp
+}
+  8032af:	c9                   	leave
+  8032b0:	c3                   	ret
+
+008032b1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8032b7:	ff 75 10             	push   0x10(%ebp)
+  8032ba:	ff 75 0c             	push   0xc(%ebp)
+  8032bd:	ff 75 08             	push   0x8(%ebp)
+  8032c0:	e8 41 02 00 00       	call   803506 <nsipc_socket>
+  8032c5:	83 c4 10             	add    $0x10,%esp
+  8032c8:	85 c0                	test   %eax,%eax
+  8032ca:	78 05                	js     8032d1 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8032cc:	e8 ab fe ff ff       	call   80317c <alloc_sockfd>
+}
+  8032d1:	c9                   	leave
+  8032d2:	c3                   	ret
+
+008032d3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8032d3:	55                   	push   %ebp
+  8032d4:	89 e5                	mov    %esp,%ebp
+  8032d6:	53                   	push   %ebx
+  8032d7:	83 ec 04             	sub    $0x4,%esp
+  8032da:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8032dc:	83 3d 88 be 80 00 00 	cmpl   $0x0,0x80be88
+  8032e3:	74 26                	je     80330b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8032e5:	6a 07                	push   $0x7
+  8032e7:	68 00 e0 80 00       	push   $0x80e000
+  8032ec:	53                   	push   %ebx
+  8032ed:	ff 35 88 be 80 00    	push   0x80be88
+  8032f3:	e8 c7 14 00 00       	call   8047bf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8032f8:	83 c4 0c             	add    $0xc,%esp
+  8032fb:	6a 00                	push   $0x0
+  8032fd:	6a 00                	push   $0x0
+  8032ff:	6a 00                	push   $0x0
+  803301:	e8 c3 13 00 00       	call   8046c9 <ipc_recv>
+}
+  803306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80330b:	83 ec 0c             	sub    $0xc,%esp
+  80330e:	6a 02                	push   $0x2
+  803310:	e8 00 15 00 00       	call   804815 <ipc_find_env>
+  803315:	a3 88 be 80 00       	mov    %eax,0x80be88
+  80331a:	83 c4 10             	add    $0x10,%esp
+  80331d:	eb c6                	jmp    8032e5 <nsipc+0x12>
+
+0080331f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+  803322:	56                   	push   %esi
+  803323:	53                   	push   %ebx
+  803324:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80332f:	8b 06                	mov    (%esi),%eax
+  803331:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803336:	b8 01 00 00 00       	mov    $0x1,%eax
+  80333b:	e8 93 ff ff ff       	call   8032d3 <nsipc>
+  803340:	89 c3                	mov    %eax,%ebx
+  803342:	85 c0                	test   %eax,%eax
+  803344:	79 09                	jns    80334f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803346:	89 d8                	mov    %ebx,%eax
+  803348:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80334b:	5b                   	pop    %ebx
+  80334c:	5e                   	pop    %esi
+  80334d:	5d                   	pop    %ebp
+  80334e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80334f:	83 ec 04             	sub    $0x4,%esp
+  803352:	ff 35 10 e0 80 00    	push   0x80e010
+  803358:	68 00 e0 80 00       	push   $0x80e000
+  80335d:	ff 75 0c             	push   0xc(%ebp)
+  803360:	e8 a1 d9 ff ff       	call   800d06 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803365:	a1 10 e0 80 00       	mov    0x80e010,%eax
+  80336a:	89 06                	mov    %eax,(%esi)
+  80336c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80336f:	eb d5                	jmp    803346 <nsipc_accept+0x27>
+
+00803371 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803371:	55                   	push   %ebp
+  803372:	89 e5                	mov    %esp,%ebp
+  803374:	53                   	push   %ebx
+  803375:	83 ec 08             	sub    $0x8,%esp
+  803378:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80337b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337e:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803383:	53                   	push   %ebx
+  803384:	ff 75 0c             	push   0xc(%ebp)
+  803387:	68 04 e0 80 00       	push   $0x80e004
+  80338c:	e8 75 d9 ff ff       	call   800d06 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803391:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_BIND);
+  803397:	b8 02 00 00 00       	mov    $0x2,%eax
+  80339c:	e8 32 ff ff ff       	call   8032d3 <nsipc>
+}
+  8033a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033a4:	c9                   	leave
+  8033a5:	c3                   	ret
+
+008033a6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8033a6:	55                   	push   %ebp
+  8033a7:	89 e5                	mov    %esp,%ebp
+  8033a9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8033ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033af:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.shutdown.req_how = how;
+  8033b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033b7:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_SHUTDOWN);
+  8033bc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8033c1:	e8 0d ff ff ff       	call   8032d3 <nsipc>
+}
+  8033c6:	c9                   	leave
+  8033c7:	c3                   	ret
+
+008033c8 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8033c8:	55                   	push   %ebp
+  8033c9:	89 e5                	mov    %esp,%ebp
+  8033cb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8033ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d1:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_CLOSE);
+  8033d6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8033db:	e8 f3 fe ff ff       	call   8032d3 <nsipc>
+}
+  8033e0:	c9                   	leave
+  8033e1:	c3                   	ret
+
+008033e2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8033e2:	55                   	push   %ebp
+  8033e3:	89 e5                	mov    %esp,%ebp
+  8033e5:	53                   	push   %ebx
+  8033e6:	83 ec 08             	sub    $0x8,%esp
+  8033e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8033ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ef:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8033f4:	53                   	push   %ebx
+  8033f5:	ff 75 0c             	push   0xc(%ebp)
+  8033f8:	68 04 e0 80 00       	push   $0x80e004
+  8033fd:	e8 04 d9 ff ff       	call   800d06 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803402:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_CONNECT);
+  803408:	b8 05 00 00 00       	mov    $0x5,%eax
+  80340d:	e8 c1 fe ff ff       	call   8032d3 <nsipc>
+}
+  803412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803415:	c9                   	leave
+  803416:	c3                   	ret
+
+00803417 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803417:	55                   	push   %ebp
+  803418:	89 e5                	mov    %esp,%ebp
+  80341a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80341d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803420:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.listen.req_backlog = backlog;
+  803425:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803428:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_LISTEN);
+  80342d:	b8 06 00 00 00       	mov    $0x6,%eax
+  803432:	e8 9c fe ff ff       	call   8032d3 <nsipc>
+}
+  803437:	c9                   	leave
+  803438:	c3                   	ret
+
+00803439 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803439:	55                   	push   %ebp
+  80343a:	89 e5                	mov    %esp,%ebp
+  80343c:	56                   	push   %esi
+  80343d:	53                   	push   %ebx
+  80343e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803441:	8b 45 08             	mov    0x8(%ebp),%eax
+  803444:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.recv.req_len = len;
+  803449:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+	nsipcbuf.recv.req_flags = flags;
+  80344f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803452:	a3 08 e0 80 00       	mov    %eax,0x80e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803457:	b8 07 00 00 00       	mov    $0x7,%eax
+  80345c:	e8 72 fe ff ff       	call   8032d3 <nsipc>
+  803461:	89 c3                	mov    %eax,%ebx
+  803463:	85 c0                	test   %eax,%eax
+  803465:	78 22                	js     803489 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803467:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80346c:	39 c6                	cmp    %eax,%esi
+  80346e:	0f 4e c6             	cmovle %esi,%eax
+  803471:	39 c3                	cmp    %eax,%ebx
+  803473:	7f 1d                	jg     803492 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803475:	83 ec 04             	sub    $0x4,%esp
+  803478:	53                   	push   %ebx
+  803479:	68 00 e0 80 00       	push   $0x80e000
+  80347e:	ff 75 0c             	push   0xc(%ebp)
+  803481:	e8 80 d8 ff ff       	call   800d06 <memmove>
+  803486:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803489:	89 d8                	mov    %ebx,%eax
+  80348b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80348e:	5b                   	pop    %ebx
+  80348f:	5e                   	pop    %esi
+  803490:	5d                   	pop    %ebp
+  803491:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803492:	68 54 52 80 00       	push   $0x805254
+  803497:	68 51 51 80 00       	push   $0x805151
+  80349c:	6a 62                	push   $0x62
+  80349e:	68 69 52 80 00       	push   $0x805269
+  8034a3:	e8 19 d0 ff ff       	call   8004c1 <_panic>
+
+008034a8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8034a8:	55                   	push   %ebp
+  8034a9:	89 e5                	mov    %esp,%ebp
+  8034ab:	53                   	push   %ebx
+  8034ac:	83 ec 04             	sub    $0x4,%esp
+  8034af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8034b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b5:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	assert(size < 1600);
+  8034ba:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8034c0:	7f 2e                	jg     8034f0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8034c2:	83 ec 04             	sub    $0x4,%esp
+  8034c5:	53                   	push   %ebx
+  8034c6:	ff 75 0c             	push   0xc(%ebp)
+  8034c9:	68 0c e0 80 00       	push   $0x80e00c
+  8034ce:	e8 33 d8 ff ff       	call   800d06 <memmove>
+	nsipcbuf.send.req_size = size;
+  8034d3:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+	nsipcbuf.send.req_flags = flags;
+  8034d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034dc:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SEND);
+  8034e1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8034e6:	e8 e8 fd ff ff       	call   8032d3 <nsipc>
+}
+  8034eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034ee:	c9                   	leave
+  8034ef:	c3                   	ret
+	assert(size < 1600);
+  8034f0:	68 75 52 80 00       	push   $0x805275
+  8034f5:	68 51 51 80 00       	push   $0x805151
+  8034fa:	6a 6d                	push   $0x6d
+  8034fc:	68 69 52 80 00       	push   $0x805269
+  803501:	e8 bb cf ff ff       	call   8004c1 <_panic>
+
+00803506 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80350c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80350f:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.socket.req_type = type;
+  803514:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803517:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.socket.req_protocol = protocol;
+  80351c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80351f:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SOCKET);
+  803524:	b8 09 00 00 00       	mov    $0x9,%eax
+  803529:	e8 a5 fd ff ff       	call   8032d3 <nsipc>
+}
+  80352e:	c9                   	leave
+  80352f:	c3                   	ret
+
+00803530 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803530:	55                   	push   %ebp
+  803531:	89 e5                	mov    %esp,%ebp
+  803533:	53                   	push   %ebx
+  803534:	83 ec 10             	sub    $0x10,%esp
+  803537:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80353a:	68 8c be 80 00       	push   $0x80be8c
+  80353f:	e8 a1 07 00 00       	call   803ce5 <mutex_lock>
+	if (v == 0)
+  803544:	83 c4 10             	add    $0x10,%esp
+  803547:	85 db                	test   %ebx,%ebx
+  803549:	0f 84 85 00 00 00    	je     8035d4 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80354f:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803555:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80355a:	77 51                	ja     8035ad <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80355c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803562:	89 d8                	mov    %ebx,%eax
+  803564:	c1 e8 0c             	shr    $0xc,%eax
+  803567:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80356e:	f6 c4 02             	test   $0x2,%ah
+  803571:	74 50                	je     8035c3 <free+0x93>
+		sys_page_unmap(0, c);
+  803573:	83 ec 08             	sub    $0x8,%esp
+  803576:	53                   	push   %ebx
+  803577:	6a 00                	push   $0x0
+  803579:	e8 d9 da ff ff       	call   801057 <sys_page_unmap>
+		c += PGSIZE;
+  80357e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803584:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80358a:	83 c4 10             	add    $0x10,%esp
+  80358d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803592:	76 ce                	jbe    803562 <free+0x32>
+  803594:	68 bf 52 80 00       	push   $0x8052bf
+  803599:	68 51 51 80 00       	push   $0x805151
+  80359e:	68 82 00 00 00       	push   $0x82
+  8035a3:	68 b2 52 80 00       	push   $0x8052b2
+  8035a8:	e8 14 cf ff ff       	call   8004c1 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8035ad:	68 84 52 80 00       	push   $0x805284
+  8035b2:	68 51 51 80 00       	push   $0x805151
+  8035b7:	6a 7b                	push   $0x7b
+  8035b9:	68 b2 52 80 00       	push   $0x8052b2
+  8035be:	e8 fe ce ff ff       	call   8004c1 <_panic>
+	if (--(*ref) == 0)
+  8035c3:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8035c9:	83 e8 01             	sub    $0x1,%eax
+  8035cc:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8035d2:	74 15                	je     8035e9 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8035d4:	83 ec 0c             	sub    $0xc,%esp
+  8035d7:	68 8c be 80 00       	push   $0x80be8c
+  8035dc:	e8 71 07 00 00       	call   803d52 <mutex_unlock>
+}
+  8035e1:	83 c4 10             	add    $0x10,%esp
+  8035e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+		sys_page_unmap(0, c);
+  8035e9:	83 ec 08             	sub    $0x8,%esp
+  8035ec:	53                   	push   %ebx
+  8035ed:	6a 00                	push   $0x0
+  8035ef:	e8 63 da ff ff       	call   801057 <sys_page_unmap>
+  8035f4:	83 c4 10             	add    $0x10,%esp
+  8035f7:	eb db                	jmp    8035d4 <free+0xa4>
+
+008035f9 <malloc>:
+{
+  8035f9:	55                   	push   %ebp
+  8035fa:	89 e5                	mov    %esp,%ebp
+  8035fc:	57                   	push   %edi
+  8035fd:	56                   	push   %esi
+  8035fe:	53                   	push   %ebx
+  8035ff:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803602:	68 8c be 80 00       	push   $0x80be8c
+  803607:	e8 d9 06 00 00       	call   803ce5 <mutex_lock>
+	if (mptr == 0)
+  80360c:	8b 3d 90 be 80 00    	mov    0x80be90,%edi
+  803612:	83 c4 10             	add    $0x10,%esp
+  803615:	85 ff                	test   %edi,%edi
+  803617:	74 6c                	je     803685 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803619:	8b 45 08             	mov    0x8(%ebp),%eax
+  80361c:	83 c0 03             	add    $0x3,%eax
+  80361f:	83 e0 fc             	and    $0xfffffffc,%eax
+  803622:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803624:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803629:	0f 87 64 01 00 00    	ja     803793 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80362f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803635:	74 30                	je     803667 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803637:	89 f9                	mov    %edi,%ecx
+  803639:	c1 e9 0c             	shr    $0xc,%ecx
+  80363c:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803640:	c1 e8 0c             	shr    $0xc,%eax
+  803643:	39 c1                	cmp    %eax,%ecx
+  803645:	74 5f                	je     8036a6 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803647:	83 ec 0c             	sub    $0xc,%esp
+  80364a:	57                   	push   %edi
+  80364b:	e8 e0 fe ff ff       	call   803530 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803650:	a1 90 be 80 00       	mov    0x80be90,%eax
+  803655:	05 00 10 00 00       	add    $0x1000,%eax
+  80365a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80365f:	a3 90 be 80 00       	mov    %eax,0x80be90
+  803664:	83 c4 10             	add    $0x10,%esp
+  803667:	8b 0d 90 be 80 00    	mov    0x80be90,%ecx
+{
+  80366d:	ba 02 00 00 00       	mov    $0x2,%edx
+  803672:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803676:	8d 7e 04             	lea    0x4(%esi),%edi
+  803679:	89 cb                	mov    %ecx,%ebx
+  80367b:	01 f9                	add    %edi,%ecx
+  80367d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803680:	e9 8b 00 00 00       	jmp    803710 <malloc+0x117>
+		mptr = mbegin;
+  803685:	c7 05 90 be 80 00 00 	movl   $0x8000000,0x80be90
+  80368c:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80368f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803692:	83 c0 03             	add    $0x3,%eax
+  803695:	83 e0 fc             	and    $0xfffffffc,%eax
+  803698:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80369a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80369f:	76 c6                	jbe    803667 <malloc+0x6e>
+  8036a1:	e9 d6 00 00 00       	jmp    80377c <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8036a6:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8036ac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8036b1:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8036b5:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8036b8:	a3 90 be 80 00       	mov    %eax,0x80be90
+			return v;
+  8036bd:	e9 ba 00 00 00       	jmp    80377c <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8036c2:	05 00 10 00 00       	add    $0x1000,%eax
+  8036c7:	39 c8                	cmp    %ecx,%eax
+  8036c9:	0f 83 cb 00 00 00    	jae    80379a <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8036cf:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8036d4:	77 22                	ja     8036f8 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8036d6:	89 c2                	mov    %eax,%edx
+  8036d8:	c1 ea 16             	shr    $0x16,%edx
+  8036db:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8036e2:	f6 c2 01             	test   $0x1,%dl
+  8036e5:	74 db                	je     8036c2 <malloc+0xc9>
+  8036e7:	89 c2                	mov    %eax,%edx
+  8036e9:	c1 ea 0c             	shr    $0xc,%edx
+  8036ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8036f3:	f6 c2 01             	test   $0x1,%dl
+  8036f6:	74 ca                	je     8036c2 <malloc+0xc9>
+		if (mptr == mend) {
+  8036f8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8036fe:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803704:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803708:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80370e:	74 04                	je     803714 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803710:	89 d8                	mov    %ebx,%eax
+  803712:	eb b3                	jmp    8036c7 <malloc+0xce>
+  803714:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803717:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80371c:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803720:	83 ea 01             	sub    $0x1,%edx
+  803723:	0f 85 50 ff ff ff    	jne    803679 <malloc+0x80>
+  803729:	c7 05 90 be 80 00 00 	movl   $0x8000000,0x80be90
+  803730:	00 00 08 
+				return 0;	/* out of address space */
+  803733:	bf 00 00 00 00       	mov    $0x0,%edi
+  803738:	eb 42                	jmp    80377c <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80373a:	85 db                	test   %ebx,%ebx
+  80373c:	78 1e                	js     80375c <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80373e:	83 ec 08             	sub    $0x8,%esp
+  803741:	89 d8                	mov    %ebx,%eax
+  803743:	03 05 90 be 80 00    	add    0x80be90,%eax
+  803749:	50                   	push   %eax
+  80374a:	6a 00                	push   $0x0
+  80374c:	e8 06 d9 ff ff       	call   801057 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803751:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803757:	83 c4 10             	add    $0x10,%esp
+  80375a:	eb de                	jmp    80373a <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80375c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803761:	eb 19                	jmp    80377c <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803763:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803766:	8b 3d 90 be 80 00    	mov    0x80be90,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80376c:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803773:	00 
+	mptr += n;
+  803774:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803777:	a3 90 be 80 00       	mov    %eax,0x80be90
+	mutex_unlock(&malloc_mu);
+  80377c:	83 ec 0c             	sub    $0xc,%esp
+  80377f:	68 8c be 80 00       	push   $0x80be8c
+  803784:	e8 c9 05 00 00       	call   803d52 <mutex_unlock>
+}
+  803789:	89 f8                	mov    %edi,%eax
+  80378b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80378e:	5b                   	pop    %ebx
+  80378f:	5e                   	pop    %esi
+  803790:	5f                   	pop    %edi
+  803791:	5d                   	pop    %ebp
+  803792:	c3                   	ret
+		return 0;
+  803793:	bf 00 00 00 00       	mov    $0x0,%edi
+  803798:	eb e2                	jmp    80377c <malloc+0x183>
+  80379a:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80379e:	74 06                	je     8037a6 <malloc+0x1ad>
+  8037a0:	89 1d 90 be 80 00    	mov    %ebx,0x80be90
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8037a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037ab:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8037ae:	39 fb                	cmp    %edi,%ebx
+  8037b0:	73 b1                	jae    803763 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8037b2:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8037b8:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8037bb:	39 fe                	cmp    %edi,%esi
+  8037bd:	0f 92 c0             	setb   %al
+  8037c0:	0f b6 c0             	movzbl %al,%eax
+  8037c3:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8037c6:	83 c8 07             	or     $0x7,%eax
+  8037c9:	50                   	push   %eax
+  8037ca:	89 d8                	mov    %ebx,%eax
+  8037cc:	03 05 90 be 80 00    	add    0x80be90,%eax
+  8037d2:	50                   	push   %eax
+  8037d3:	6a 00                	push   $0x0
+  8037d5:	e8 e4 d7 ff ff       	call   800fbe <sys_page_alloc>
+  8037da:	83 c4 10             	add    $0x10,%esp
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	0f 88 55 ff ff ff    	js     80373a <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8037e5:	89 f3                	mov    %esi,%ebx
+  8037e7:	eb c5                	jmp    8037ae <malloc+0x1b5>
+
+008037e9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8037e9:	55                   	push   %ebp
+  8037ea:	89 e5                	mov    %esp,%ebp
+  8037ec:	56                   	push   %esi
+  8037ed:	53                   	push   %ebx
+  8037ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8037f1:	83 ec 0c             	sub    $0xc,%esp
+  8037f4:	ff 75 08             	push   0x8(%ebp)
+  8037f7:	e8 ea e2 ff ff       	call   801ae6 <fd2data>
+  8037fc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8037fe:	83 c4 08             	add    $0x8,%esp
+  803801:	68 d7 52 80 00       	push   $0x8052d7
+  803806:	53                   	push   %ebx
+  803807:	e8 74 d3 ff ff       	call   800b80 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80380c:	8b 46 04             	mov    0x4(%esi),%eax
+  80380f:	2b 06                	sub    (%esi),%eax
+  803811:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803817:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80381e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803821:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803828:	62 80 00 
+	return 0;
+}
+  80382b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803830:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803833:	5b                   	pop    %ebx
+  803834:	5e                   	pop    %esi
+  803835:	5d                   	pop    %ebp
+  803836:	c3                   	ret
+
+00803837 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803837:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80383c:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803840:	85 c9                	test   %ecx,%ecx
+  803842:	75 01                	jne    803845 <pipewake+0xe>
+  803844:	c3                   	ret
+{
+  803845:	55                   	push   %ebp
+  803846:	89 e5                	mov    %esp,%ebp
+  803848:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80384b:	68 00 04 00 00       	push   $0x400
+  803850:	52                   	push   %edx
+  803851:	e8 ac da ff ff       	call   801302 <sys_futex_wake>
+  803856:	83 c4 10             	add    $0x10,%esp
+}
+  803859:	c9                   	leave
+  80385a:	c3                   	ret
+
+0080385b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80385b:	55                   	push   %ebp
+  80385c:	89 e5                	mov    %esp,%ebp
+  80385e:	56                   	push   %esi
+  80385f:	53                   	push   %ebx
+  803860:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803863:	83 ec 0c             	sub    $0xc,%esp
+  803866:	56                   	push   %esi
+  803867:	e8 7a e2 ff ff       	call   801ae6 <fd2data>
+  80386c:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80386e:	83 c4 08             	add    $0x8,%esp
+  803871:	56                   	push   %esi
+  803872:	6a 00                	push   $0x0
+  803874:	e8 de d7 ff ff       	call   801057 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803879:	8d 53 04             	lea    0x4(%ebx),%edx
+  80387c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80387f:	e8 b3 ff ff ff       	call   803837 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803884:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803887:	89 da                	mov    %ebx,%edx
+  803889:	e8 a9 ff ff ff       	call   803837 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80388e:	89 34 24             	mov    %esi,(%esp)
+  803891:	e8 50 e2 ff ff       	call   801ae6 <fd2data>
+  803896:	83 c4 08             	add    $0x8,%esp
+  803899:	50                   	push   %eax
+  80389a:	6a 00                	push   $0x0
+  80389c:	e8 b6 d7 ff ff       	call   801057 <sys_page_unmap>
+}
+  8038a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038a4:	5b                   	pop    %ebx
+  8038a5:	5e                   	pop    %esi
+  8038a6:	5d                   	pop    %ebp
+  8038a7:	c3                   	ret
+
+008038a8 <_pipeisclosed>:
+{
+  8038a8:	55                   	push   %ebp
+  8038a9:	89 e5                	mov    %esp,%ebp
+  8038ab:	57                   	push   %edi
+  8038ac:	56                   	push   %esi
+  8038ad:	53                   	push   %ebx
+  8038ae:	83 ec 1c             	sub    $0x1c,%esp
+  8038b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038b4:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038b6:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8038bb:	eb 5d                	jmp    80391a <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8038bd:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		n = thisenv->env_runs;
+  8038c3:	8b 02                	mov    (%edx),%eax
+  8038c5:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8038c8:	83 ec 0c             	sub    $0xc,%esp
+  8038cb:	ff 75 e0             	push   -0x20(%ebp)
+  8038ce:	e8 81 0f 00 00       	call   804854 <pageref>
+  8038d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038d6:	89 3c 24             	mov    %edi,(%esp)
+  8038d9:	e8 76 0f 00 00       	call   804854 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8038de:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038e0:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8038e6:	83 c4 10             	add    $0x10,%esp
+  8038e9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8038ef:	77 15                	ja     803906 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038f1:	89 f2                	mov    %esi,%edx
+  8038f3:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8038f5:	c1 ea 10             	shr    $0x10,%edx
+  8038f8:	74 0c                	je     803906 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038fa:	c1 e2 10             	shl    $0x10,%edx
+  8038fd:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803902:	29 d1                	sub    %edx,%ecx
+  803904:	eb 06                	jmp    80390c <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803906:	8b 0d 40 c1 80 00    	mov    0x80c140,%ecx
+		nn = thisenv->env_runs;
+  80390c:	8b 11                	mov    (%ecx),%edx
+  80390e:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803911:	39 d3                	cmp    %edx,%ebx
+  803913:	74 6e                	je     803983 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803915:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803918:	74 24                	je     80393e <_pipeisclosed+0x96>
+  80391a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80391c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803922:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803927:	77 94                	ja     8038bd <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803929:	89 f0                	mov    %esi,%eax
+  80392b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80392d:	c1 e8 10             	shr    $0x10,%eax
+  803930:	74 8b                	je     8038bd <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803932:	c1 e0 10             	shl    $0x10,%eax
+  803935:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80393a:	29 c2                	sub    %eax,%edx
+  80393c:	eb 85                	jmp    8038c3 <_pipeisclosed+0x1b>
+  80393e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803940:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803946:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80394b:	77 18                	ja     803965 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80394d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803952:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803954:	c1 e8 10             	shr    $0x10,%eax
+  803957:	74 0c                	je     803965 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803959:	c1 e0 10             	shl    $0x10,%eax
+  80395c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803961:	29 c2                	sub    %eax,%edx
+  803963:	eb 06                	jmp    80396b <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803965:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80396b:	8b 02                	mov    (%edx),%eax
+  80396d:	8b 40 58             	mov    0x58(%eax),%eax
+  803970:	6a 01                	push   $0x1
+  803972:	50                   	push   %eax
+  803973:	53                   	push   %ebx
+  803974:	68 de 52 80 00       	push   $0x8052de
+  803979:	e8 1e cc ff ff       	call   80059c <cprintf>
+  80397e:	83 c4 10             	add    $0x10,%esp
+  803981:	eb 97                	jmp    80391a <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803983:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803986:	0f 94 c0             	sete   %al
+  803989:	0f b6 c0             	movzbl %al,%eax
+}
+  80398c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80398f:	5b                   	pop    %ebx
+  803990:	5e                   	pop    %esi
+  803991:	5f                   	pop    %edi
+  803992:	5d                   	pop    %ebp
+  803993:	c3                   	ret
+
+00803994 <devpipe_write>:
+{
+  803994:	55                   	push   %ebp
+  803995:	89 e5                	mov    %esp,%ebp
+  803997:	57                   	push   %edi
+  803998:	56                   	push   %esi
+  803999:	53                   	push   %ebx
+  80399a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80399d:	ff 75 08             	push   0x8(%ebp)
+  8039a0:	e8 41 e1 ff ff       	call   801ae6 <fd2data>
+  8039a5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039a7:	83 c4 10             	add    $0x10,%esp
+  8039aa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8039b1:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8039b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039b7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8039ba:	0f 84 96 00 00 00    	je     803a56 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8039c0:	8d 73 08             	lea    0x8(%ebx),%esi
+  8039c3:	eb 32                	jmp    8039f7 <devpipe_write+0x63>
+  8039c5:	89 fa                	mov    %edi,%edx
+  8039c7:	89 f0                	mov    %esi,%eax
+  8039c9:	e8 69 fe ff ff       	call   803837 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8039ce:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039d1:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8039d4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8039d9:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8039de:	83 ec 04             	sub    $0x4,%esp
+  8039e1:	6a 0a                	push   $0xa
+  8039e3:	50                   	push   %eax
+  8039e4:	53                   	push   %ebx
+  8039e5:	e8 e9 d8 ff ff       	call   8012d3 <sys_futex_wait>
+  8039ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8039ef:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8039f4:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8039f7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039fa:	8b 0b                	mov    (%ebx),%ecx
+  8039fc:	8d 51 20             	lea    0x20(%ecx),%edx
+  8039ff:	39 d0                	cmp    %edx,%eax
+  803a01:	72 1b                	jb     803a1e <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803a03:	89 da                	mov    %ebx,%edx
+  803a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a08:	e8 9b fe ff ff       	call   8038a8 <_pipeisclosed>
+  803a0d:	85 c0                	test   %eax,%eax
+  803a0f:	74 b4                	je     8039c5 <devpipe_write+0x31>
+				return 0;
+  803a11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a19:	5b                   	pop    %ebx
+  803a1a:	5e                   	pop    %esi
+  803a1b:	5f                   	pop    %edi
+  803a1c:	5d                   	pop    %ebp
+  803a1d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a21:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803a24:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803a28:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803a2b:	89 c2                	mov    %eax,%edx
+  803a2d:	c1 fa 1f             	sar    $0x1f,%edx
+  803a30:	89 d1                	mov    %edx,%ecx
+  803a32:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a35:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803a38:	83 e2 1f             	and    $0x1f,%edx
+  803a3b:	29 ca                	sub    %ecx,%edx
+  803a3d:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803a41:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803a45:	83 c0 01             	add    $0x1,%eax
+  803a48:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803a4b:	83 c6 01             	add    $0x1,%esi
+  803a4e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803a51:	e9 5e ff ff ff       	jmp    8039b4 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803a56:	8d 53 04             	lea    0x4(%ebx),%edx
+  803a59:	8d 43 08             	lea    0x8(%ebx),%eax
+  803a5c:	e8 d6 fd ff ff       	call   803837 <pipewake>
+	return i;
+  803a61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a64:	eb b0                	jmp    803a16 <devpipe_write+0x82>
+
+00803a66 <devpipe_read>:
+{
+  803a66:	55                   	push   %ebp
+  803a67:	89 e5                	mov    %esp,%ebp
+  803a69:	57                   	push   %edi
+  803a6a:	56                   	push   %esi
+  803a6b:	53                   	push   %ebx
+  803a6c:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803a6f:	ff 75 08             	push   0x8(%ebp)
+  803a72:	e8 6f e0 ff ff       	call   801ae6 <fd2data>
+  803a77:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a79:	83 c4 10             	add    $0x10,%esp
+  803a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a81:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a84:	74 6c                	je     803af2 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803a86:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803a89:	eb 25                	jmp    803ab0 <devpipe_read+0x4a>
+  803a8b:	8b 13                	mov    (%ebx),%edx
+  803a8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a92:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803a97:	83 ec 04             	sub    $0x4,%esp
+  803a9a:	6a 0a                	push   $0xa
+  803a9c:	52                   	push   %edx
+  803a9d:	57                   	push   %edi
+  803a9e:	e8 30 d8 ff ff       	call   8012d3 <sys_futex_wait>
+  803aa3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803aa8:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803aad:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803ab0:	8b 03                	mov    (%ebx),%eax
+  803ab2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803ab5:	75 19                	jne    803ad0 <devpipe_read+0x6a>
+			if (i > 0)
+  803ab7:	85 f6                	test   %esi,%esi
+  803ab9:	75 3a                	jne    803af5 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803abb:	89 da                	mov    %ebx,%edx
+  803abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac0:	e8 e3 fd ff ff       	call   8038a8 <_pipeisclosed>
+  803ac5:	85 c0                	test   %eax,%eax
+  803ac7:	74 c2                	je     803a8b <devpipe_read+0x25>
+				return 0;
+  803ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ace:	eb 31                	jmp    803b01 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ad0:	89 c1                	mov    %eax,%ecx
+  803ad2:	c1 f9 1f             	sar    $0x1f,%ecx
+  803ad5:	c1 e9 1b             	shr    $0x1b,%ecx
+  803ad8:	01 c8                	add    %ecx,%eax
+  803ada:	83 e0 1f             	and    $0x1f,%eax
+  803add:	29 c8                	sub    %ecx,%eax
+  803adf:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803ae7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803aea:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803aed:	83 c6 01             	add    $0x1,%esi
+  803af0:	eb 8f                	jmp    803a81 <devpipe_read+0x1b>
+out:
+  803af2:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803af5:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803af8:	89 da                	mov    %ebx,%edx
+  803afa:	e8 38 fd ff ff       	call   803837 <pipewake>
+	return i;
+  803aff:	89 f0                	mov    %esi,%eax
+}
+  803b01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b04:	5b                   	pop    %ebx
+  803b05:	5e                   	pop    %esi
+  803b06:	5f                   	pop    %edi
+  803b07:	5d                   	pop    %ebp
+  803b08:	c3                   	ret
+
+00803b09 <pipe>:
+{
+  803b09:	55                   	push   %ebp
+  803b0a:	89 e5                	mov    %esp,%ebp
+  803b0c:	56                   	push   %esi
+  803b0d:	53                   	push   %ebx
+  803b0e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803b11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b14:	50                   	push   %eax
+  803b15:	e8 e3 df ff ff       	call   801afd <fd_alloc>
+  803b1a:	89 c3                	mov    %eax,%ebx
+  803b1c:	83 c4 10             	add    $0x10,%esp
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	0f 88 23 01 00 00    	js     803c4a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b27:	83 ec 04             	sub    $0x4,%esp
+  803b2a:	68 07 04 00 00       	push   $0x407
+  803b2f:	ff 75 f4             	push   -0xc(%ebp)
+  803b32:	6a 00                	push   $0x0
+  803b34:	e8 85 d4 ff ff       	call   800fbe <sys_page_alloc>
+  803b39:	89 c3                	mov    %eax,%ebx
+  803b3b:	83 c4 10             	add    $0x10,%esp
+  803b3e:	85 c0                	test   %eax,%eax
+  803b40:	0f 88 04 01 00 00    	js     803c4a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b46:	83 ec 0c             	sub    $0xc,%esp
+  803b49:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b4c:	50                   	push   %eax
+  803b4d:	e8 ab df ff ff       	call   801afd <fd_alloc>
+  803b52:	89 c3                	mov    %eax,%ebx
+  803b54:	83 c4 10             	add    $0x10,%esp
+  803b57:	85 c0                	test   %eax,%eax
+  803b59:	0f 88 db 00 00 00    	js     803c3a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b5f:	83 ec 04             	sub    $0x4,%esp
+  803b62:	68 07 04 00 00       	push   $0x407
+  803b67:	ff 75 f0             	push   -0x10(%ebp)
+  803b6a:	6a 00                	push   $0x0
+  803b6c:	e8 4d d4 ff ff       	call   800fbe <sys_page_alloc>
+  803b71:	89 c3                	mov    %eax,%ebx
+  803b73:	83 c4 10             	add    $0x10,%esp
+  803b76:	85 c0                	test   %eax,%eax
+  803b78:	0f 88 bc 00 00 00    	js     803c3a <pipe+0x131>
+	va = fd2data(fd0);
+  803b7e:	83 ec 0c             	sub    $0xc,%esp
+  803b81:	ff 75 f4             	push   -0xc(%ebp)
+  803b84:	e8 5d df ff ff       	call   801ae6 <fd2data>
+  803b89:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b8b:	83 c4 0c             	add    $0xc,%esp
+  803b8e:	68 07 04 00 00       	push   $0x407
+  803b93:	50                   	push   %eax
+  803b94:	6a 00                	push   $0x0
+  803b96:	e8 23 d4 ff ff       	call   800fbe <sys_page_alloc>
+  803b9b:	89 c3                	mov    %eax,%ebx
+  803b9d:	83 c4 10             	add    $0x10,%esp
+  803ba0:	85 c0                	test   %eax,%eax
+  803ba2:	0f 88 82 00 00 00    	js     803c2a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ba8:	83 ec 0c             	sub    $0xc,%esp
+  803bab:	ff 75 f0             	push   -0x10(%ebp)
+  803bae:	e8 33 df ff ff       	call   801ae6 <fd2data>
+  803bb3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803bba:	50                   	push   %eax
+  803bbb:	6a 00                	push   $0x0
+  803bbd:	56                   	push   %esi
+  803bbe:	6a 00                	push   $0x0
+  803bc0:	e8 46 d4 ff ff       	call   80100b <sys_page_map>
+  803bc5:	89 c3                	mov    %eax,%ebx
+  803bc7:	83 c4 20             	add    $0x20,%esp
+  803bca:	85 c0                	test   %eax,%eax
+  803bcc:	78 4e                	js     803c1c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803bce:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803bd3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803bd6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803bd8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803bdb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803be2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803be5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803be7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803bf1:	83 ec 0c             	sub    $0xc,%esp
+  803bf4:	ff 75 f4             	push   -0xc(%ebp)
+  803bf7:	e8 da de ff ff       	call   801ad6 <fd2num>
+  803bfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bff:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803c01:	83 c4 04             	add    $0x4,%esp
+  803c04:	ff 75 f0             	push   -0x10(%ebp)
+  803c07:	e8 ca de ff ff       	call   801ad6 <fd2num>
+  803c0c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c0f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803c12:	83 c4 10             	add    $0x10,%esp
+  803c15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c1a:	eb 2e                	jmp    803c4a <pipe+0x141>
+	sys_page_unmap(0, va);
+  803c1c:	83 ec 08             	sub    $0x8,%esp
+  803c1f:	56                   	push   %esi
+  803c20:	6a 00                	push   $0x0
+  803c22:	e8 30 d4 ff ff       	call   801057 <sys_page_unmap>
+  803c27:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803c2a:	83 ec 08             	sub    $0x8,%esp
+  803c2d:	ff 75 f0             	push   -0x10(%ebp)
+  803c30:	6a 00                	push   $0x0
+  803c32:	e8 20 d4 ff ff       	call   801057 <sys_page_unmap>
+  803c37:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c3a:	83 ec 08             	sub    $0x8,%esp
+  803c3d:	ff 75 f4             	push   -0xc(%ebp)
+  803c40:	6a 00                	push   $0x0
+  803c42:	e8 10 d4 ff ff       	call   801057 <sys_page_unmap>
+  803c47:	83 c4 10             	add    $0x10,%esp
+}
+  803c4a:	89 d8                	mov    %ebx,%eax
+  803c4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c4f:	5b                   	pop    %ebx
+  803c50:	5e                   	pop    %esi
+  803c51:	5d                   	pop    %ebp
+  803c52:	c3                   	ret
+
+00803c53 <pipeisclosed>:
+{
+  803c53:	55                   	push   %ebp
+  803c54:	89 e5                	mov    %esp,%ebp
+  803c56:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c5c:	50                   	push   %eax
+  803c5d:	ff 75 08             	push   0x8(%ebp)
+  803c60:	e8 ee de ff ff       	call   801b53 <fd_lookup>
+  803c65:	83 c4 10             	add    $0x10,%esp
+  803c68:	85 c0                	test   %eax,%eax
+  803c6a:	78 18                	js     803c84 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c6c:	83 ec 0c             	sub    $0xc,%esp
+  803c6f:	ff 75 f4             	push   -0xc(%ebp)
+  803c72:	e8 6f de ff ff       	call   801ae6 <fd2data>
+  803c77:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c7c:	e8 27 fc ff ff       	call   8038a8 <_pipeisclosed>
+  803c81:	83 c4 10             	add    $0x10,%esp
+}
+  803c84:	c9                   	leave
+  803c85:	c3                   	ret
+
+00803c86 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c86:	55                   	push   %ebp
+  803c87:	89 e5                	mov    %esp,%ebp
+  803c89:	56                   	push   %esi
+  803c8a:	53                   	push   %ebx
+  803c8b:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c8e:	85 f6                	test   %esi,%esi
+  803c90:	74 15                	je     803ca7 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803c92:	89 f0                	mov    %esi,%eax
+  803c94:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c99:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803c9c:	c1 e3 04             	shl    $0x4,%ebx
+  803c9f:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803ca5:	eb 1b                	jmp    803cc2 <wait+0x3c>
+	assert(envid != 0);
+  803ca7:	68 f6 52 80 00       	push   $0x8052f6
+  803cac:	68 51 51 80 00       	push   $0x805151
+  803cb1:	6a 09                	push   $0x9
+  803cb3:	68 01 53 80 00       	push   $0x805301
+  803cb8:	e8 04 c8 ff ff       	call   8004c1 <_panic>
+		sys_yield();
+  803cbd:	e8 d0 d2 ff ff       	call   800f92 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803cc2:	8b 43 48             	mov    0x48(%ebx),%eax
+  803cc5:	39 f0                	cmp    %esi,%eax
+  803cc7:	75 07                	jne    803cd0 <wait+0x4a>
+  803cc9:	8b 43 54             	mov    0x54(%ebx),%eax
+  803ccc:	85 c0                	test   %eax,%eax
+  803cce:	75 ed                	jne    803cbd <wait+0x37>
+}
+  803cd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cd3:	5b                   	pop    %ebx
+  803cd4:	5e                   	pop    %esi
+  803cd5:	5d                   	pop    %ebp
+  803cd6:	c3                   	ret
+
+00803cd7 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803cd7:	55                   	push   %ebp
+  803cd8:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803cda:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cdd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ce3:	5d                   	pop    %ebp
+  803ce4:	c3                   	ret
+
+00803ce5 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803ce5:	55                   	push   %ebp
+  803ce6:	89 e5                	mov    %esp,%ebp
+  803ce8:	56                   	push   %esi
+  803ce9:	53                   	push   %ebx
+  803cea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cf2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803cf7:	89 d0                	mov    %edx,%eax
+  803cf9:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803cfd:	85 c0                	test   %eax,%eax
+  803cff:	74 2d                	je     803d2e <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803d01:	83 f8 02             	cmp    $0x2,%eax
+  803d04:	74 08                	je     803d0e <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803d06:	b8 02 00 00 00       	mov    $0x2,%eax
+  803d0b:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d0e:	be 02 00 00 00       	mov    $0x2,%esi
+  803d13:	eb 15                	jmp    803d2a <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803d15:	83 ec 04             	sub    $0x4,%esp
+  803d18:	6a 00                	push   $0x0
+  803d1a:	6a 02                	push   $0x2
+  803d1c:	53                   	push   %ebx
+  803d1d:	e8 b1 d5 ff ff       	call   8012d3 <sys_futex_wait>
+  803d22:	89 f0                	mov    %esi,%eax
+  803d24:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d27:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803d2a:	85 c0                	test   %eax,%eax
+  803d2c:	75 e7                	jne    803d15 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803d2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d31:	5b                   	pop    %ebx
+  803d32:	5e                   	pop    %esi
+  803d33:	5d                   	pop    %ebp
+  803d34:	c3                   	ret
+
+00803d35 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803d35:	55                   	push   %ebp
+  803d36:	89 e5                	mov    %esp,%ebp
+  803d38:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d40:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803d45:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803d49:	f7 d8                	neg    %eax
+  803d4b:	19 c0                	sbb    %eax,%eax
+  803d4d:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803d50:	5d                   	pop    %ebp
+  803d51:	c3                   	ret
+
+00803d52 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803d52:	55                   	push   %ebp
+  803d53:	89 e5                	mov    %esp,%ebp
+  803d55:	83 ec 08             	sub    $0x8,%esp
+  803d58:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d60:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803d63:	83 f8 02             	cmp    $0x2,%eax
+  803d66:	74 02                	je     803d6a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803d68:	c9                   	leave
+  803d69:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803d6a:	83 ec 08             	sub    $0x8,%esp
+  803d6d:	6a 01                	push   $0x1
+  803d6f:	52                   	push   %edx
+  803d70:	e8 8d d5 ff ff       	call   801302 <sys_futex_wake>
+  803d75:	83 c4 10             	add    $0x10,%esp
+}
+  803d78:	eb ee                	jmp    803d68 <mutex_unlock+0x16>
+
+00803d7a <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803d7a:	55                   	push   %ebp
+  803d7b:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d80:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d86:	5d                   	pop    %ebp
+  803d87:	c3                   	ret
+
+00803d88 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803d88:	55                   	push   %ebp
+  803d89:	89 e5                	mov    %esp,%ebp
+  803d8b:	57                   	push   %edi
+  803d8c:	56                   	push   %esi
+  803d8d:	53                   	push   %ebx
+  803d8e:	83 ec 18             	sub    $0x18,%esp
+  803d91:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803d97:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803d99:	53                   	push   %ebx
+  803d9a:	e8 b3 ff ff ff       	call   803d52 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803d9f:	83 c4 0c             	add    $0xc,%esp
+  803da2:	ff 75 10             	push   0x10(%ebp)
+  803da5:	57                   	push   %edi
+  803da6:	56                   	push   %esi
+  803da7:	e8 27 d5 ff ff       	call   8012d3 <sys_futex_wait>
+  803dac:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803dae:	83 c4 10             	add    $0x10,%esp
+  803db1:	be 02 00 00 00       	mov    $0x2,%esi
+  803db6:	eb 10                	jmp    803dc8 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803db8:	83 ec 04             	sub    $0x4,%esp
+  803dbb:	6a 00                	push   $0x0
+  803dbd:	6a 02                	push   $0x2
+  803dbf:	53                   	push   %ebx
+  803dc0:	e8 0e d5 ff ff       	call   8012d3 <sys_futex_wait>
+  803dc5:	83 c4 10             	add    $0x10,%esp
+  803dc8:	89 f0                	mov    %esi,%eax
+  803dca:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	75 e7                	jne    803db8 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803dd1:	83 ff ec             	cmp    $0xffffffec,%edi
+  803dd4:	74 05                	je     803ddb <cond_timedwait+0x53>
+  803dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ddb:	89 f8                	mov    %edi,%eax
+  803ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803de0:	5b                   	pop    %ebx
+  803de1:	5e                   	pop    %esi
+  803de2:	5f                   	pop    %edi
+  803de3:	5d                   	pop    %ebp
+  803de4:	c3                   	ret
+
+00803de5 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803de5:	55                   	push   %ebp
+  803de6:	89 e5                	mov    %esp,%ebp
+  803de8:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803deb:	6a 00                	push   $0x0
+  803ded:	ff 75 0c             	push   0xc(%ebp)
+  803df0:	ff 75 08             	push   0x8(%ebp)
+  803df3:	e8 90 ff ff ff       	call   803d88 <cond_timedwait>
+}
+  803df8:	83 c4 10             	add    $0x10,%esp
+  803dfb:	c9                   	leave
+  803dfc:	c3                   	ret
+
+00803dfd <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803dfd:	55                   	push   %ebp
+  803dfe:	89 e5                	mov    %esp,%ebp
+  803e00:	83 ec 10             	sub    $0x10,%esp
+  803e03:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803e06:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e0b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803e0f:	6a 01                	push   $0x1
+  803e11:	50                   	push   %eax
+  803e12:	e8 eb d4 ff ff       	call   801302 <sys_futex_wake>
+}
+  803e17:	83 c4 10             	add    $0x10,%esp
+  803e1a:	c9                   	leave
+  803e1b:	c3                   	ret
+
+00803e1c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803e1c:	55                   	push   %ebp
+  803e1d:	89 e5                	mov    %esp,%ebp
+  803e1f:	83 ec 10             	sub    $0x10,%esp
+  803e22:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e25:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e2a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803e2e:	68 00 04 00 00       	push   $0x400
+  803e33:	50                   	push   %eax
+  803e34:	e8 c9 d4 ff ff       	call   801302 <sys_futex_wake>
+}
+  803e39:	83 c4 10             	add    $0x10,%esp
+  803e3c:	c9                   	leave
+  803e3d:	c3                   	ret
+
+00803e3e <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803e3e:	55                   	push   %ebp
+  803e3f:	89 e5                	mov    %esp,%ebp
+  803e41:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803e44:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e47:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803e49:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803e50:	5d                   	pop    %ebp
+  803e51:	c3                   	ret
+
+00803e52 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803e52:	55                   	push   %ebp
+  803e53:	89 e5                	mov    %esp,%ebp
+  803e55:	53                   	push   %ebx
+  803e56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803e59:	8b 11                	mov    (%ecx),%edx
+  803e5b:	85 d2                	test   %edx,%edx
+  803e5d:	74 14                	je     803e73 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803e5f:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803e62:	89 d0                	mov    %edx,%eax
+  803e64:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803e68:	39 c2                	cmp    %eax,%edx
+  803e6a:	75 ed                	jne    803e59 <sem_trywait+0x7>
+			return 0;
+  803e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e71:	eb 05                	jmp    803e78 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803e73:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803e78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e7b:	c9                   	leave
+  803e7c:	c3                   	ret
+
+00803e7d <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803e7d:	55                   	push   %ebp
+  803e7e:	89 e5                	mov    %esp,%ebp
+  803e80:	57                   	push   %edi
+  803e81:	56                   	push   %esi
+  803e82:	53                   	push   %ebx
+  803e83:	83 ec 1c             	sub    $0x1c,%esp
+  803e86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e89:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803e8c:	e8 ba d3 ff ff       	call   80124b <sys_time_msec>
+  803e91:	01 f8                	add    %edi,%eax
+  803e93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803e96:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803e9b:	eb 28                	jmp    803ec5 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803e9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ea2:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803ea7:	83 ec 04             	sub    $0x4,%esp
+  803eaa:	56                   	push   %esi
+  803eab:	6a 00                	push   $0x0
+  803ead:	53                   	push   %ebx
+  803eae:	e8 20 d4 ff ff       	call   8012d3 <sys_futex_wait>
+  803eb3:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803eb8:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803ebd:	83 c4 10             	add    $0x10,%esp
+  803ec0:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803ec3:	74 2e                	je     803ef3 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803ec5:	83 ec 0c             	sub    $0xc,%esp
+  803ec8:	53                   	push   %ebx
+  803ec9:	e8 84 ff ff ff       	call   803e52 <sem_trywait>
+  803ece:	83 c4 10             	add    $0x10,%esp
+  803ed1:	85 c0                	test   %eax,%eax
+  803ed3:	79 19                	jns    803eee <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803ed5:	85 ff                	test   %edi,%edi
+  803ed7:	74 c4                	je     803e9d <sem_timedwait+0x20>
+  803ed9:	e8 6d d3 ff ff       	call   80124b <sys_time_msec>
+  803ede:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803ee1:	29 c6                	sub    %eax,%esi
+  803ee3:	85 f6                	test   %esi,%esi
+  803ee5:	7f b6                	jg     803e9d <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803ee7:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803eec:	eb 05                	jmp    803ef3 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803eee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ef6:	5b                   	pop    %ebx
+  803ef7:	5e                   	pop    %esi
+  803ef8:	5f                   	pop    %edi
+  803ef9:	5d                   	pop    %ebp
+  803efa:	c3                   	ret
+
+00803efb <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803efb:	55                   	push   %ebp
+  803efc:	89 e5                	mov    %esp,%ebp
+  803efe:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803f01:	6a 00                	push   $0x0
+  803f03:	ff 75 08             	push   0x8(%ebp)
+  803f06:	e8 72 ff ff ff       	call   803e7d <sem_timedwait>
+}
+  803f0b:	83 c4 10             	add    $0x10,%esp
+  803f0e:	c9                   	leave
+  803f0f:	c3                   	ret
+
+00803f10 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803f10:	55                   	push   %ebp
+  803f11:	89 e5                	mov    %esp,%ebp
+  803f13:	83 ec 08             	sub    $0x8,%esp
+  803f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f19:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f1e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803f22:	8b 50 04             	mov    0x4(%eax),%edx
+  803f25:	85 d2                	test   %edx,%edx
+  803f27:	75 02                	jne    803f2b <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803f29:	c9                   	leave
+  803f2a:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803f2b:	83 ec 08             	sub    $0x8,%esp
+  803f2e:	6a 01                	push   $0x1
+  803f30:	50                   	push   %eax
+  803f31:	e8 cc d3 ff ff       	call   801302 <sys_futex_wake>
+  803f36:	83 c4 10             	add    $0x10,%esp
+}
+  803f39:	eb ee                	jmp    803f29 <sem_post+0x19>
+
+00803f3b <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803f3b:	55                   	push   %ebp
+  803f3c:	89 e5                	mov    %esp,%ebp
+  803f3e:	57                   	push   %edi
+  803f3f:	56                   	push   %esi
+  803f40:	53                   	push   %ebx
+  803f41:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803f44:	68 a0 be 80 00       	push   $0x80bea0
+  803f49:	e8 97 fd ff ff       	call   803ce5 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803f4e:	a1 c4 be 80 00       	mov    0x80bec4,%eax
+  803f53:	83 c4 10             	add    $0x10,%esp
+  803f56:	85 c0                	test   %eax,%eax
+  803f58:	75 19                	jne    803f73 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803f5a:	a1 40 c1 80 00       	mov    0x80c140,%eax
+  803f5f:	8b 00                	mov    (%eax),%eax
+  803f61:	8b 40 48             	mov    0x48(%eax),%eax
+  803f64:	a3 c0 be 80 00       	mov    %eax,0x80bec0
+		threads[0].th_state = PTH_RUNNING;
+  803f69:	c7 05 c4 be 80 00 01 	movl   $0x1,0x80bec4
+  803f70:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803f73:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803f78:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f7b:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  803f82:	8b 40 04             	mov    0x4(%eax),%eax
+  803f85:	85 c0                	test   %eax,%eax
+  803f87:	0f 84 e4 00 00 00    	je     804071 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803f8d:	83 c3 01             	add    $0x1,%ebx
+  803f90:	83 fb 20             	cmp    $0x20,%ebx
+  803f93:	75 e3                	jne    803f78 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803f95:	83 ec 0c             	sub    $0xc,%esp
+  803f98:	68 a0 be 80 00       	push   $0x80bea0
+  803f9d:	e8 b0 fd ff ff       	call   803d52 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803fa2:	83 c4 10             	add    $0x10,%esp
+  803fa5:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803faa:	e9 b8 00 00 00       	jmp    804067 <pthread_create+0x12c>
+  803faf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803fb2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803fb5:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803fb7:	39 f3                	cmp    %esi,%ebx
+  803fb9:	73 16                	jae    803fd1 <pthread_create+0x96>
+		va -= PGSIZE;
+  803fbb:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803fc1:	83 ec 08             	sub    $0x8,%esp
+  803fc4:	56                   	push   %esi
+  803fc5:	6a 00                	push   $0x0
+  803fc7:	e8 8b d0 ff ff       	call   801057 <sys_page_unmap>
+  803fcc:	83 c4 10             	add    $0x10,%esp
+  803fcf:	eb e6                	jmp    803fb7 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803fd1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803fd4:	83 ec 08             	sub    $0x8,%esp
+  803fd7:	ff 75 e4             	push   -0x1c(%ebp)
+  803fda:	6a 00                	push   $0x0
+  803fdc:	e8 76 d0 ff ff       	call   801057 <sys_page_unmap>
+	return r;
+  803fe1:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803fe4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fe7:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  803fee:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803ff5:	eb 70                	jmp    804067 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803ff7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ffa:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  804001:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804004:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  804007:	8b 55 10             	mov    0x10(%ebp),%edx
+  80400a:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  80400d:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  804014:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  804019:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80401c:	29 c8                	sub    %ecx,%eax
+  80401e:	85 db                	test   %ebx,%ebx
+  804020:	0f 44 05 40 c1 80 00 	cmove  0x80c140,%eax
+	*--esp = t;
+  804027:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80402a:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  804031:	83 ec 04             	sub    $0x4,%esp
+  804034:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804039:	29 ca                	sub    %ecx,%edx
+  80403b:	52                   	push   %edx
+	*--esp = 0;
+  80403c:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80403f:	50                   	push   %eax
+  804040:	68 98 42 80 00       	push   $0x804298
+  804045:	e8 5d d3 ff ff       	call   8013a7 <sys_thread_create>
+  80404a:	89 c7                	mov    %eax,%edi
+  80404c:	83 c4 10             	add    $0x10,%esp
+  80404f:	85 c0                	test   %eax,%eax
+  804051:	78 91                	js     803fe4 <pthread_create+0xa9>
+	th->th_env = id;
+  804053:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804056:	89 3c 85 c0 be 80 00 	mov    %edi,0x80bec0(,%eax,4)
+	*tp = t;
+  80405d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804060:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  804062:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  804067:	89 f8                	mov    %edi,%eax
+  804069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80406c:	5b                   	pop    %ebx
+  80406d:	5e                   	pop    %esi
+  80406e:	5f                   	pop    %edi
+  80406f:	5d                   	pop    %ebp
+  804070:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  804071:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804074:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  80407b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  804082:	83 ec 0c             	sub    $0xc,%esp
+  804085:	68 a0 be 80 00       	push   $0x80bea0
+  80408a:	e8 c3 fc ff ff       	call   803d52 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80408f:	89 d9                	mov    %ebx,%ecx
+  804091:	c1 e1 10             	shl    $0x10,%ecx
+  804094:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  804097:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  80409c:	29 c8                	sub    %ecx,%eax
+  80409e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8040a1:	c1 e8 16             	shr    $0x16,%eax
+  8040a4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8040ab:	83 c4 10             	add    $0x10,%esp
+  8040ae:	a8 01                	test   $0x1,%al
+  8040b0:	74 15                	je     8040c7 <pthread_create+0x18c>
+  8040b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8040b5:	c1 e8 0c             	shr    $0xc,%eax
+  8040b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8040bf:	a8 01                	test   $0x1,%al
+  8040c1:	0f 85 30 ff ff ff    	jne    803ff7 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8040c7:	83 ec 04             	sub    $0x4,%esp
+  8040ca:	6a 07                	push   $0x7
+  8040cc:	ff 75 e4             	push   -0x1c(%ebp)
+  8040cf:	6a 00                	push   $0x0
+  8040d1:	e8 e8 ce ff ff       	call   800fbe <sys_page_alloc>
+  8040d6:	89 c7                	mov    %eax,%edi
+  8040d8:	83 c4 10             	add    $0x10,%esp
+  8040db:	85 c0                	test   %eax,%eax
+  8040dd:	0f 88 01 ff ff ff    	js     803fe4 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8040e3:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8040e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8040eb:	29 d0                	sub    %edx,%eax
+  8040ed:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040f0:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8040f2:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8040f7:	29 d0                	sub    %edx,%eax
+  8040f9:	89 c7                	mov    %eax,%edi
+  8040fb:	39 fe                	cmp    %edi,%esi
+  8040fd:	0f 83 f4 fe ff ff    	jae    803ff7 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804103:	83 ec 04             	sub    $0x4,%esp
+  804106:	6a 07                	push   $0x7
+  804108:	56                   	push   %esi
+  804109:	6a 00                	push   $0x0
+  80410b:	e8 ae ce ff ff       	call   800fbe <sys_page_alloc>
+  804110:	83 c4 10             	add    $0x10,%esp
+  804113:	85 c0                	test   %eax,%eax
+  804115:	0f 88 94 fe ff ff    	js     803faf <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80411b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804121:	eb d8                	jmp    8040fb <pthread_create+0x1c0>
+
+00804123 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  804123:	55                   	push   %ebp
+  804124:	89 e5                	mov    %esp,%ebp
+  804126:	57                   	push   %edi
+  804127:	56                   	push   %esi
+  804128:	53                   	push   %ebx
+  804129:	83 ec 0c             	sub    $0xc,%esp
+  80412c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80412f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804132:	83 f8 1e             	cmp    $0x1e,%eax
+  804135:	0f 87 c7 00 00 00    	ja     804202 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80413b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80413d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804143:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804148:	77 12                	ja     80415c <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80414a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80414f:	29 d0                	sub    %edx,%eax
+  804151:	c1 e8 10             	shr    $0x10,%eax
+  804154:	39 c3                	cmp    %eax,%ebx
+  804156:	0f 84 ad 00 00 00    	je     804209 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80415c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80415f:	8d 3c 85 c4 be 80 00 	lea    0x80bec4(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  804166:	8d 34 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%esi
+  80416d:	eb 10                	jmp    80417f <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80416f:	83 ec 04             	sub    $0x4,%esp
+  804172:	6a 00                	push   $0x0
+  804174:	6a 01                	push   $0x1
+  804176:	57                   	push   %edi
+  804177:	e8 57 d1 ff ff       	call   8012d3 <sys_futex_wait>
+  80417c:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  80417f:	8b 46 04             	mov    0x4(%esi),%eax
+  804182:	83 f8 01             	cmp    $0x1,%eax
+  804185:	74 e8                	je     80416f <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  804187:	83 f8 02             	cmp    $0x2,%eax
+  80418a:	0f 85 80 00 00 00    	jne    804210 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804190:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804193:	c1 e6 02             	shl    $0x2,%esi
+  804196:	eb 05                	jmp    80419d <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  804198:	e8 f5 cd ff ff       	call   800f92 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80419d:	8b 8e c0 be 80 00    	mov    0x80bec0(%esi),%ecx
+  8041a3:	89 ca                	mov    %ecx,%edx
+  8041a5:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8041ab:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8041ae:	c1 e0 04             	shl    $0x4,%eax
+  8041b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041b6:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8041b9:	39 c1                	cmp    %eax,%ecx
+  8041bb:	75 12                	jne    8041cf <pthread_join+0xac>
+  8041bd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8041c0:	c1 e0 04             	shl    $0x4,%eax
+  8041c3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041c8:	8b 40 54             	mov    0x54(%eax),%eax
+  8041cb:	85 c0                	test   %eax,%eax
+  8041cd:	75 c9                	jne    804198 <pthread_join+0x75>
+	if (ret_store)
+  8041cf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8041d3:	74 0f                	je     8041e4 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8041d5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041d8:	8b 04 85 d0 be 80 00 	mov    0x80bed0(,%eax,4),%eax
+  8041df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8041e2:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8041e4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041e7:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  8041ee:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8041f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041fd:	5b                   	pop    %ebx
+  8041fe:	5e                   	pop    %esi
+  8041ff:	5f                   	pop    %edi
+  804200:	5d                   	pop    %ebp
+  804201:	c3                   	ret
+		return -E_INVAL;
+  804202:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804207:	eb f1                	jmp    8041fa <pthread_join+0xd7>
+  804209:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80420e:	eb ea                	jmp    8041fa <pthread_join+0xd7>
+		return -E_INVAL;
+  804210:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804215:	eb e3                	jmp    8041fa <pthread_join+0xd7>
+
+00804217 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804217:	55                   	push   %ebp
+  804218:	89 e5                	mov    %esp,%ebp
+  80421a:	53                   	push   %ebx
+  80421b:	83 ec 04             	sub    $0x4,%esp
+  80421e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804220:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804226:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80422b:	77 0c                	ja     804239 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80422d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804232:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804234:	c1 e8 10             	shr    $0x10,%eax
+  804237:	75 0a                	jne    804243 <pthread_exit+0x2c>
+		exit();
+  804239:	e8 5b c2 ff ff       	call   800499 <exit>
+  80423e:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804243:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80424a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80424d:	8d 0c 8d c0 be 80 00 	lea    0x80bec0(,%ecx,4),%ecx
+  804254:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804257:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80425a:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  804261:	83 ec 08             	sub    $0x8,%esp
+  804264:	6a 20                	push   $0x20
+  804266:	01 c2                	add    %eax,%edx
+  804268:	8d 04 95 c4 be 80 00 	lea    0x80bec4(,%edx,4),%eax
+  80426f:	50                   	push   %eax
+  804270:	e8 8d d0 ff ff       	call   801302 <sys_futex_wake>
+	sys_env_destroy(0);
+  804275:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80427c:	e8 9a cc ff ff       	call   800f1b <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804281:	83 c4 0c             	add    $0xc,%esp
+  804284:	68 0c 53 80 00       	push   $0x80530c
+  804289:	68 a5 00 00 00       	push   $0xa5
+  80428e:	68 26 53 80 00       	push   $0x805326
+  804293:	e8 29 c2 ff ff       	call   8004c1 <_panic>
+
+00804298 <pthread_start>:
+{
+  804298:	55                   	push   %ebp
+  804299:	89 e5                	mov    %esp,%ebp
+  80429b:	53                   	push   %ebx
+  80429c:	83 ec 04             	sub    $0x4,%esp
+  80429f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8042a2:	e8 bf cc ff ff       	call   800f66 <sys_getenvid>
+  8042a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8042ac:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+	if (t == 0)
+  8042b2:	85 db                	test   %ebx,%ebx
+  8042b4:	74 0c                	je     8042c2 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042b6:	89 d9                	mov    %ebx,%ecx
+  8042b8:	c1 e1 10             	shl    $0x10,%ecx
+  8042bb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042c0:	29 ca                	sub    %ecx,%edx
+  8042c2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8042c5:	c1 e0 04             	shl    $0x4,%eax
+  8042c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042cd:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8042cf:	83 ec 0c             	sub    $0xc,%esp
+  8042d2:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8042d9:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8042dc:	ff 34 95 cc be 80 00 	push   0x80becc(,%edx,4)
+  8042e3:	ff 14 95 c8 be 80 00 	call   *0x80bec8(,%edx,4)
+  8042ea:	89 04 24             	mov    %eax,(%esp)
+  8042ed:	e8 25 ff ff ff       	call   804217 <pthread_exit>
+
+008042f2 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8042f2:	55                   	push   %ebp
+  8042f3:	89 e5                	mov    %esp,%ebp
+  8042f5:	57                   	push   %edi
+  8042f6:	56                   	push   %esi
+  8042f7:	53                   	push   %ebx
+  8042f8:	83 ec 1c             	sub    $0x1c,%esp
+  8042fb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042fd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804303:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80430a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80430f:	77 0d                	ja     80431e <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804311:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804316:	29 d0                	sub    %edx,%eax
+  804318:	c1 e8 10             	shr    $0x10,%eax
+  80431b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80431e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804323:	eb 2f                	jmp    804354 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804325:	8b 0d 40 c1 80 00    	mov    0x80c140,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80432b:	8b 01                	mov    (%ecx),%eax
+  80432d:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804330:	39 c2                	cmp    %eax,%edx
+  804332:	75 14                	jne    804348 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804334:	83 ec 0c             	sub    $0xc,%esp
+  804337:	57                   	push   %edi
+  804338:	e8 de cb ff ff       	call   800f1b <sys_env_destroy>
+  80433d:	83 c4 10             	add    $0x10,%esp
+  804340:	85 c0                	test   %eax,%eax
+  804342:	0f 88 97 00 00 00    	js     8043df <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804348:	83 c3 01             	add    $0x1,%ebx
+  80434b:	83 fb 20             	cmp    $0x20,%ebx
+  80434e:	0f 84 d2 00 00 00    	je     804426 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804354:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804357:	74 ef                	je     804348 <pthread_kill_others+0x56>
+  804359:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80435c:	8d 04 85 c0 be 80 00 	lea    0x80bec0(,%eax,4),%eax
+  804363:	8b 40 04             	mov    0x4(%eax),%eax
+  804366:	83 f8 01             	cmp    $0x1,%eax
+  804369:	75 dd                	jne    804348 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80436b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80436e:	8b 3c 85 c0 be 80 00 	mov    0x80bec0(,%eax,4),%edi
+  804375:	89 fe                	mov    %edi,%esi
+  804377:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80437d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804380:	c1 e0 04             	shl    $0x4,%eax
+  804383:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804388:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80438b:	39 c7                	cmp    %eax,%edi
+  80438d:	75 b9                	jne    804348 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80438f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804392:	c1 e0 04             	shl    $0x4,%eax
+  804395:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80439a:	8b 40 54             	mov    0x54(%eax),%eax
+  80439d:	85 c0                	test   %eax,%eax
+  80439f:	74 a7                	je     804348 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8043a1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8043a4:	c1 e0 04             	shl    $0x4,%eax
+  8043a7:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8043ad:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043af:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8043b5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043ba:	0f 87 65 ff ff ff    	ja     804325 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043c0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043c5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8043c7:	c1 e8 10             	shr    $0x10,%eax
+  8043ca:	0f 84 55 ff ff ff    	je     804325 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043d0:	c1 e0 10             	shl    $0x10,%eax
+  8043d3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8043d8:	29 c1                	sub    %eax,%ecx
+  8043da:	e9 4c ff ff ff       	jmp    80432b <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8043df:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8043e2:	c1 e2 04             	shl    $0x4,%edx
+  8043e5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8043eb:	8b 52 48             	mov    0x48(%edx),%edx
+  8043ee:	39 fa                	cmp    %edi,%edx
+  8043f0:	0f 85 52 ff ff ff    	jne    804348 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8043f6:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8043f9:	c1 e2 04             	shl    $0x4,%edx
+  8043fc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804402:	8b 52 54             	mov    0x54(%edx),%edx
+  804405:	85 d2                	test   %edx,%edx
+  804407:	0f 84 3b ff ff ff    	je     804348 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80440d:	83 ec 0c             	sub    $0xc,%esp
+  804410:	50                   	push   %eax
+  804411:	57                   	push   %edi
+  804412:	68 34 53 80 00       	push   $0x805334
+  804417:	68 bb 00 00 00       	push   $0xbb
+  80441c:	68 26 53 80 00       	push   $0x805326
+  804421:	e8 9b c0 ff ff       	call   8004c1 <_panic>
+	}
+}
+  804426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804429:	5b                   	pop    %ebx
+  80442a:	5e                   	pop    %esi
+  80442b:	5f                   	pop    %edi
+  80442c:	5d                   	pop    %ebp
+  80442d:	c3                   	ret
+
+0080442e <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80442e:	55                   	push   %ebp
+  80442f:	89 e5                	mov    %esp,%ebp
+  804431:	53                   	push   %ebx
+  804432:	83 ec 04             	sub    $0x4,%esp
+  804435:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804437:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80443d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804443:	0f 87 85 00 00 00    	ja     8044ce <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804449:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80444e:	29 c3                	sub    %eax,%ebx
+  804450:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804453:	83 ec 04             	sub    $0x4,%esp
+  804456:	68 80 02 00 00       	push   $0x280
+  80445b:	6a 00                	push   $0x0
+  80445d:	68 c0 be 80 00       	push   $0x80bec0
+  804462:	e8 6a c8 ff ff       	call   800cd1 <memset>
+	threads_mu.m_state = 0;
+  804467:	c7 05 a0 be 80 00 00 	movl   $0x0,0x80bea0
+  80446e:	00 00 00 
+	if (self != 0) {
+  804471:	83 c4 10             	add    $0x10,%esp
+  804474:	85 db                	test   %ebx,%ebx
+  804476:	74 51                	je     8044c9 <pthread_fork_child+0x9b>
+  804478:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80447a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804480:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804485:	77 18                	ja     80449f <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804487:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80448c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80448e:	c1 e8 10             	shr    $0x10,%eax
+  804491:	74 0c                	je     80449f <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804493:	c1 e0 10             	shl    $0x10,%eax
+  804496:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80449b:	29 c2                	sub    %eax,%edx
+  80449d:	eb 06                	jmp    8044a5 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80449f:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		threads[self].th_env = thisenv->env_id;
+  8044a5:	8b 02                	mov    (%edx),%eax
+  8044a7:	8b 48 48             	mov    0x48(%eax),%ecx
+  8044aa:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8044b1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8044b4:	89 0c 95 c0 be 80 00 	mov    %ecx,0x80bec0(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8044bb:	8d 04 95 c0 be 80 00 	lea    0x80bec0(,%edx,4),%eax
+  8044c2:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8044c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8044cc:	c9                   	leave
+  8044cd:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8044ce:	83 ec 04             	sub    $0x4,%esp
+  8044d1:	68 80 02 00 00       	push   $0x280
+  8044d6:	6a 00                	push   $0x0
+  8044d8:	68 c0 be 80 00       	push   $0x80bec0
+  8044dd:	e8 ef c7 ff ff       	call   800cd1 <memset>
+	threads_mu.m_state = 0;
+  8044e2:	c7 05 a0 be 80 00 00 	movl   $0x0,0x80bea0
+  8044e9:	00 00 00 
+  8044ec:	83 c4 10             	add    $0x10,%esp
+  8044ef:	eb d8                	jmp    8044c9 <pthread_fork_child+0x9b>
+
+008044f1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8044f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f6:	c3                   	ret
+
+008044f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8044f7:	55                   	push   %ebp
+  8044f8:	89 e5                	mov    %esp,%ebp
+  8044fa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8044fd:	68 59 53 80 00       	push   $0x805359
+  804502:	ff 75 0c             	push   0xc(%ebp)
+  804505:	e8 76 c6 ff ff       	call   800b80 <strcpy>
+	return 0;
+}
+  80450a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450f:	c9                   	leave
+  804510:	c3                   	ret
+
+00804511 <devcons_write>:
+{
+  804511:	55                   	push   %ebp
+  804512:	89 e5                	mov    %esp,%ebp
+  804514:	57                   	push   %edi
+  804515:	56                   	push   %esi
+  804516:	53                   	push   %ebx
+  804517:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80451d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804522:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804528:	eb 2e                	jmp    804558 <devcons_write+0x47>
+		m = n - tot;
+  80452a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80452d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80452f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804534:	39 c3                	cmp    %eax,%ebx
+  804536:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804539:	83 ec 04             	sub    $0x4,%esp
+  80453c:	53                   	push   %ebx
+  80453d:	89 f0                	mov    %esi,%eax
+  80453f:	03 45 0c             	add    0xc(%ebp),%eax
+  804542:	50                   	push   %eax
+  804543:	57                   	push   %edi
+  804544:	e8 bd c7 ff ff       	call   800d06 <memmove>
+		sys_cputs(buf, m);
+  804549:	83 c4 08             	add    $0x8,%esp
+  80454c:	53                   	push   %ebx
+  80454d:	57                   	push   %edi
+  80454e:	e8 71 c9 ff ff       	call   800ec4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804553:	01 de                	add    %ebx,%esi
+  804555:	83 c4 10             	add    $0x10,%esp
+  804558:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80455b:	72 cd                	jb     80452a <devcons_write+0x19>
+}
+  80455d:	89 f0                	mov    %esi,%eax
+  80455f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804562:	5b                   	pop    %ebx
+  804563:	5e                   	pop    %esi
+  804564:	5f                   	pop    %edi
+  804565:	5d                   	pop    %ebp
+  804566:	c3                   	ret
+
+00804567 <devcons_read>:
+{
+  804567:	55                   	push   %ebp
+  804568:	89 e5                	mov    %esp,%ebp
+  80456a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80456d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804572:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804576:	75 07                	jne    80457f <devcons_read+0x18>
+  804578:	eb 1f                	jmp    804599 <devcons_read+0x32>
+		sys_yield();
+  80457a:	e8 13 ca ff ff       	call   800f92 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80457f:	e8 6b c9 ff ff       	call   800eef <sys_cgetc>
+  804584:	85 c0                	test   %eax,%eax
+  804586:	74 f2                	je     80457a <devcons_read+0x13>
+	if (c < 0)
+  804588:	78 0f                	js     804599 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80458a:	83 f8 04             	cmp    $0x4,%eax
+  80458d:	74 0c                	je     80459b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80458f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804592:	88 02                	mov    %al,(%edx)
+	return 1;
+  804594:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804599:	c9                   	leave
+  80459a:	c3                   	ret
+		return 0;
+  80459b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a0:	eb f7                	jmp    804599 <devcons_read+0x32>
+
+008045a2 <cputchar>:
+{
+  8045a2:	55                   	push   %ebp
+  8045a3:	89 e5                	mov    %esp,%ebp
+  8045a5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8045a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045ab:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8045ae:	6a 01                	push   $0x1
+  8045b0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8045b3:	50                   	push   %eax
+  8045b4:	e8 0b c9 ff ff       	call   800ec4 <sys_cputs>
+}
+  8045b9:	83 c4 10             	add    $0x10,%esp
+  8045bc:	c9                   	leave
+  8045bd:	c3                   	ret
+
+008045be <getchar>:
+{
+  8045be:	55                   	push   %ebp
+  8045bf:	89 e5                	mov    %esp,%ebp
+  8045c1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8045c4:	6a 01                	push   $0x1
+  8045c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8045c9:	50                   	push   %eax
+  8045ca:	6a 00                	push   $0x0
+  8045cc:	e8 12 d8 ff ff       	call   801de3 <read>
+	if (r < 0)
+  8045d1:	83 c4 10             	add    $0x10,%esp
+  8045d4:	85 c0                	test   %eax,%eax
+  8045d6:	78 06                	js     8045de <getchar+0x20>
+	if (r < 1)
+  8045d8:	74 06                	je     8045e0 <getchar+0x22>
+	return c;
+  8045da:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8045de:	c9                   	leave
+  8045df:	c3                   	ret
+		return -E_EOF;
+  8045e0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8045e5:	eb f7                	jmp    8045de <getchar+0x20>
+
+008045e7 <iscons>:
+{
+  8045e7:	55                   	push   %ebp
+  8045e8:	89 e5                	mov    %esp,%ebp
+  8045ea:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8045ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8045f0:	50                   	push   %eax
+  8045f1:	ff 75 08             	push   0x8(%ebp)
+  8045f4:	e8 5a d5 ff ff       	call   801b53 <fd_lookup>
+  8045f9:	83 c4 10             	add    $0x10,%esp
+  8045fc:	85 c0                	test   %eax,%eax
+  8045fe:	78 11                	js     804611 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804603:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804609:	39 10                	cmp    %edx,(%eax)
+  80460b:	0f 94 c0             	sete   %al
+  80460e:	0f b6 c0             	movzbl %al,%eax
+}
+  804611:	c9                   	leave
+  804612:	c3                   	ret
+
+00804613 <opencons>:
+{
+  804613:	55                   	push   %ebp
+  804614:	89 e5                	mov    %esp,%ebp
+  804616:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804619:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80461c:	50                   	push   %eax
+  80461d:	e8 db d4 ff ff       	call   801afd <fd_alloc>
+  804622:	83 c4 10             	add    $0x10,%esp
+  804625:	85 c0                	test   %eax,%eax
+  804627:	78 3a                	js     804663 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804629:	83 ec 04             	sub    $0x4,%esp
+  80462c:	68 07 04 00 00       	push   $0x407
+  804631:	ff 75 f4             	push   -0xc(%ebp)
+  804634:	6a 00                	push   $0x0
+  804636:	e8 83 c9 ff ff       	call   800fbe <sys_page_alloc>
+  80463b:	83 c4 10             	add    $0x10,%esp
+  80463e:	85 c0                	test   %eax,%eax
+  804640:	78 21                	js     804663 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804642:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804645:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80464b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80464d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804650:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804657:	83 ec 0c             	sub    $0xc,%esp
+  80465a:	50                   	push   %eax
+  80465b:	e8 76 d4 ff ff       	call   801ad6 <fd2num>
+  804660:	83 c4 10             	add    $0x10,%esp
+}
+  804663:	c9                   	leave
+  804664:	c3                   	ret
+
+00804665 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804665:	55                   	push   %ebp
+  804666:	89 e5                	mov    %esp,%ebp
+  804668:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80466b:	83 3d 00 f0 80 00 00 	cmpl   $0x0,0x80f000
+  804672:	74 0a                	je     80467e <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804674:	8b 45 08             	mov    0x8(%ebp),%eax
+  804677:	a3 00 f0 80 00       	mov    %eax,0x80f000
+}
+  80467c:	c9                   	leave
+  80467d:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80467e:	83 ec 04             	sub    $0x4,%esp
+  804681:	6a 07                	push   $0x7
+  804683:	68 00 f0 bf ee       	push   $0xeebff000
+  804688:	6a 00                	push   $0x0
+  80468a:	e8 2f c9 ff ff       	call   800fbe <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80468f:	83 c4 08             	add    $0x8,%esp
+  804692:	68 a3 46 80 00       	push   $0x8046a3
+  804697:	6a 00                	push   $0x0
+  804699:	e8 9d ca ff ff       	call   80113b <sys_env_set_pgfault_upcall>
+  80469e:	83 c4 10             	add    $0x10,%esp
+  8046a1:	eb d1                	jmp    804674 <set_pgfault_handler+0xf>
+
+008046a3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8046a3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8046a4:	a1 00 f0 80 00       	mov    0x80f000,%eax
+	call *%eax
+  8046a9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8046ab:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8046ae:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8046b2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8046b6:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8046b9:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8046bd:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8046bf:	83 c4 08             	add    $0x8,%esp
+	popal
+  8046c2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8046c3:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8046c6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8046c7:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8046c8:	c3                   	ret
+
+008046c9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8046c9:	55                   	push   %ebp
+  8046ca:	89 e5                	mov    %esp,%ebp
+  8046cc:	57                   	push   %edi
+  8046cd:	56                   	push   %esi
+  8046ce:	53                   	push   %ebx
+  8046cf:	83 ec 18             	sub    $0x18,%esp
+  8046d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8046d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8046d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8046db:	85 c0                	test   %eax,%eax
+  8046dd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8046e2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8046e5:	50                   	push   %eax
+  8046e6:	e8 c9 ca ff ff       	call   8011b4 <sys_ipc_recv>
+	if (r < 0) {
+  8046eb:	83 c4 10             	add    $0x10,%esp
+  8046ee:	85 c0                	test   %eax,%eax
+  8046f0:	78 2b                	js     80471d <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8046f2:	85 ff                	test   %edi,%edi
+  8046f4:	74 55                	je     80474b <ipc_recv+0x82>
+  8046f6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046f8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046fe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804703:	77 39                	ja     80473e <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804705:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80470a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80470c:	c1 e8 10             	shr    $0x10,%eax
+  80470f:	74 2d                	je     80473e <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804711:	c1 e0 10             	shl    $0x10,%eax
+  804714:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804719:	29 c2                	sub    %eax,%edx
+  80471b:	eb 27                	jmp    804744 <ipc_recv+0x7b>
+  80471d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80471f:	83 ec 08             	sub    $0x8,%esp
+  804722:	50                   	push   %eax
+  804723:	68 65 53 80 00       	push   $0x805365
+  804728:	e8 6f be ff ff       	call   80059c <cprintf>
+		*from_env_store = 0;
+  80472d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804733:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804739:	83 c4 10             	add    $0x10,%esp
+  80473c:	eb 77                	jmp    8047b5 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80473e:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804744:	8b 02                	mov    (%edx),%eax
+  804746:	8b 40 78             	mov    0x78(%eax),%eax
+  804749:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80474b:	85 f6                	test   %esi,%esi
+  80474d:	74 34                	je     804783 <ipc_recv+0xba>
+  80474f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804751:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804757:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80475c:	77 18                	ja     804776 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80475e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804763:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804765:	c1 e8 10             	shr    $0x10,%eax
+  804768:	74 0c                	je     804776 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80476a:	c1 e0 10             	shl    $0x10,%eax
+  80476d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804772:	29 c2                	sub    %eax,%edx
+  804774:	eb 06                	jmp    80477c <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804776:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80477c:	8b 02                	mov    (%edx),%eax
+  80477e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804781:	89 06                	mov    %eax,(%esi)
+  804783:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804785:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80478b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804790:	77 18                	ja     8047aa <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804792:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804797:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804799:	c1 e8 10             	shr    $0x10,%eax
+  80479c:	74 0c                	je     8047aa <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80479e:	c1 e0 10             	shl    $0x10,%eax
+  8047a1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8047a6:	29 c2                	sub    %eax,%edx
+  8047a8:	eb 06                	jmp    8047b0 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8047aa:	8b 15 40 c1 80 00    	mov    0x80c140,%edx
+	}
+	return thisenv->env_ipc_value;
+  8047b0:	8b 02                	mov    (%edx),%eax
+  8047b2:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8047b5:	89 d8                	mov    %ebx,%eax
+  8047b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047ba:	5b                   	pop    %ebx
+  8047bb:	5e                   	pop    %esi
+  8047bc:	5f                   	pop    %edi
+  8047bd:	5d                   	pop    %ebp
+  8047be:	c3                   	ret
+
+008047bf <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8047bf:	55                   	push   %ebp
+  8047c0:	89 e5                	mov    %esp,%ebp
+  8047c2:	57                   	push   %edi
+  8047c3:	56                   	push   %esi
+  8047c4:	53                   	push   %ebx
+  8047c5:	83 ec 0c             	sub    $0xc,%esp
+  8047c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8047cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8047ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8047d1:	85 db                	test   %ebx,%ebx
+  8047d3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8047d8:	0f 44 d8             	cmove  %eax,%ebx
+  8047db:	eb 05                	jmp    8047e2 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8047dd:	e8 b0 c7 ff ff       	call   800f92 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8047e2:	57                   	push   %edi
+  8047e3:	53                   	push   %ebx
+  8047e4:	ff 75 0c             	push   0xc(%ebp)
+  8047e7:	56                   	push   %esi
+  8047e8:	e8 9a c9 ff ff       	call   801187 <sys_ipc_try_send>
+		if (r == 0) {
+  8047ed:	83 c4 10             	add    $0x10,%esp
+  8047f0:	85 c0                	test   %eax,%eax
+  8047f2:	74 19                	je     80480d <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8047f4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8047f7:	74 e4                	je     8047dd <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8047f9:	83 ec 0c             	sub    $0xc,%esp
+  8047fc:	50                   	push   %eax
+  8047fd:	57                   	push   %edi
+  8047fe:	53                   	push   %ebx
+  8047ff:	56                   	push   %esi
+  804800:	68 80 53 80 00       	push   $0x805380
+  804805:	e8 92 bd ff ff       	call   80059c <cprintf>
+			return;
+  80480a:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80480d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804810:	5b                   	pop    %ebx
+  804811:	5e                   	pop    %esi
+  804812:	5f                   	pop    %edi
+  804813:	5d                   	pop    %ebp
+  804814:	c3                   	ret
+
+00804815 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804815:	55                   	push   %ebp
+  804816:	89 e5                	mov    %esp,%ebp
+  804818:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80481b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804820:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804823:	c1 e0 04             	shl    $0x4,%eax
+  804826:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80482b:	8b 40 50             	mov    0x50(%eax),%eax
+  80482e:	39 c8                	cmp    %ecx,%eax
+  804830:	74 12                	je     804844 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804832:	83 c2 01             	add    $0x1,%edx
+  804835:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80483b:	75 e3                	jne    804820 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80483d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804842:	eb 0e                	jmp    804852 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804844:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804847:	c1 e0 04             	shl    $0x4,%eax
+  80484a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80484f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804852:	5d                   	pop    %ebp
+  804853:	c3                   	ret
+
+00804854 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804854:	55                   	push   %ebp
+  804855:	89 e5                	mov    %esp,%ebp
+  804857:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80485a:	89 c2                	mov    %eax,%edx
+  80485c:	c1 ea 16             	shr    $0x16,%edx
+  80485f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804866:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80486b:	f6 c1 01             	test   $0x1,%cl
+  80486e:	74 1c                	je     80488c <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804870:	c1 e8 0c             	shr    $0xc,%eax
+  804873:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80487a:	a8 01                	test   $0x1,%al
+  80487c:	74 0e                	je     80488c <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80487e:	c1 e8 0c             	shr    $0xc,%eax
+  804881:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804888:	ef 
+  804889:	0f b7 d2             	movzwl %dx,%edx
+}
+  80488c:	89 d0                	mov    %edx,%eax
+  80488e:	5d                   	pop    %ebp
+  80488f:	c3                   	ret
+
+00804890 <udm>:
+  804890:	57                   	push   %edi
+  804891:	56                   	push   %esi
+  804892:	53                   	push   %ebx
+  804893:	83 ec 20             	sub    $0x20,%esp
+  804896:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80489a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80489e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8048a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8048a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8048aa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8048ae:	89 d1                	mov    %edx,%ecx
+  8048b0:	09 c1                	or     %eax,%ecx
+  8048b2:	0f 84 91 00 00 00    	je     804949 <udm+0xb9>
+  8048b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048c2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8048c7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8048ce:	00 
+  8048cf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8048d6:	00 
+  8048d7:	eb 08                	jmp    8048e1 <udm+0x51>
+  8048d9:	83 e9 01             	sub    $0x1,%ecx
+  8048dc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8048df:	74 7c                	je     80495d <udm+0xcd>
+  8048e1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8048e5:	01 c0                	add    %eax,%eax
+  8048e7:	89 c6                	mov    %eax,%esi
+  8048e9:	89 d7                	mov    %edx,%edi
+  8048eb:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8048ef:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8048f3:	0f ad d0             	shrd   %cl,%edx,%eax
+  8048f6:	d3 ea                	shr    %cl,%edx
+  8048f8:	f6 c1 20             	test   $0x20,%cl
+  8048fb:	74 04                	je     804901 <udm+0x71>
+  8048fd:	89 d0                	mov    %edx,%eax
+  8048ff:	31 d2                	xor    %edx,%edx
+  804901:	83 e0 01             	and    $0x1,%eax
+  804904:	89 04 24             	mov    %eax,(%esp)
+  804907:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80490e:	00 
+  80490f:	8b 04 24             	mov    (%esp),%eax
+  804912:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804916:	09 f0                	or     %esi,%eax
+  804918:	09 fa                	or     %edi,%edx
+  80491a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80491e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804922:	39 f0                	cmp    %esi,%eax
+  804924:	89 d3                	mov    %edx,%ebx
+  804926:	19 fb                	sbb    %edi,%ebx
+  804928:	72 af                	jb     8048d9 <udm+0x49>
+  80492a:	29 f0                	sub    %esi,%eax
+  80492c:	19 fa                	sbb    %edi,%edx
+  80492e:	89 cf                	mov    %ecx,%edi
+  804930:	c1 ef 05             	shr    $0x5,%edi
+  804933:	83 e7 01             	and    $0x1,%edi
+  804936:	89 fe                	mov    %edi,%esi
+  804938:	83 f6 01             	xor    $0x1,%esi
+  80493b:	d3 e6                	shl    %cl,%esi
+  80493d:	d3 e7                	shl    %cl,%edi
+  80493f:	09 74 24 18          	or     %esi,0x18(%esp)
+  804943:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804947:	eb 90                	jmp    8048d9 <udm+0x49>
+  804949:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80494d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804951:	89 f0                	mov    %esi,%eax
+  804953:	89 fa                	mov    %edi,%edx
+  804955:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804959:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80495d:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804961:	89 01                	mov    %eax,(%ecx)
+  804963:	89 51 04             	mov    %edx,0x4(%ecx)
+  804966:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80496a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80496e:	83 c4 20             	add    $0x20,%esp
+  804971:	5b                   	pop    %ebx
+  804972:	5e                   	pop    %esi
+  804973:	5f                   	pop    %edi
+  804974:	c3                   	ret
+
+00804975 <__udivdi3>:
+  804975:	83 ec 18             	sub    $0x18,%esp
+  804978:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80497c:	50                   	push   %eax
+  80497d:	ff 74 24 2c          	push   0x2c(%esp)
+  804981:	ff 74 24 2c          	push   0x2c(%esp)
+  804985:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804989:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80498d:	e8 fe fe ff ff       	call   804890 <udm>
+  804992:	83 c4 24             	add    $0x24,%esp
+  804995:	c3                   	ret
+
+00804996 <__umoddi3>:
+  804996:	83 ec 18             	sub    $0x18,%esp
+  804999:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80499d:	50                   	push   %eax
+  80499e:	ff 74 24 2c          	push   0x2c(%esp)
+  8049a2:	ff 74 24 2c          	push   0x2c(%esp)
+  8049a6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049aa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049ae:	e8 dd fe ff ff       	call   804890 <udm>
+  8049b3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8049b7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8049bb:	83 c4 24             	add    $0x24,%esp
+  8049be:	c3                   	ret
+
+008049bf <__divdi3>:
+  8049bf:	56                   	push   %esi
+  8049c0:	53                   	push   %ebx
+  8049c1:	83 ec 14             	sub    $0x14,%esp
+  8049c4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8049c8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8049cc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8049d0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8049d4:	85 d2                	test   %edx,%edx
+  8049d6:	78 18                	js     8049f0 <__divdi3+0x31>
+  8049d8:	85 db                	test   %ebx,%ebx
+  8049da:	78 3e                	js     804a1a <__divdi3+0x5b>
+  8049dc:	83 ec 04             	sub    $0x4,%esp
+  8049df:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8049e3:	56                   	push   %esi
+  8049e4:	53                   	push   %ebx
+  8049e5:	51                   	push   %ecx
+  8049e6:	e8 a5 fe ff ff       	call   804890 <udm>
+  8049eb:	83 c4 10             	add    $0x10,%esp
+  8049ee:	eb 24                	jmp    804a14 <__divdi3+0x55>
+  8049f0:	f7 d8                	neg    %eax
+  8049f2:	83 d2 00             	adc    $0x0,%edx
+  8049f5:	f7 da                	neg    %edx
+  8049f7:	85 db                	test   %ebx,%ebx
+  8049f9:	78 3a                	js     804a35 <__divdi3+0x76>
+  8049fb:	83 ec 04             	sub    $0x4,%esp
+  8049fe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a02:	56                   	push   %esi
+  804a03:	53                   	push   %ebx
+  804a04:	51                   	push   %ecx
+  804a05:	e8 86 fe ff ff       	call   804890 <udm>
+  804a0a:	83 c4 10             	add    $0x10,%esp
+  804a0d:	f7 d8                	neg    %eax
+  804a0f:	83 d2 00             	adc    $0x0,%edx
+  804a12:	f7 da                	neg    %edx
+  804a14:	83 c4 14             	add    $0x14,%esp
+  804a17:	5b                   	pop    %ebx
+  804a18:	5e                   	pop    %esi
+  804a19:	c3                   	ret
+  804a1a:	83 ec 04             	sub    $0x4,%esp
+  804a1d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a21:	56                   	push   %esi
+  804a22:	f7 d9                	neg    %ecx
+  804a24:	83 d3 00             	adc    $0x0,%ebx
+  804a27:	f7 db                	neg    %ebx
+  804a29:	53                   	push   %ebx
+  804a2a:	51                   	push   %ecx
+  804a2b:	e8 60 fe ff ff       	call   804890 <udm>
+  804a30:	83 c4 10             	add    $0x10,%esp
+  804a33:	eb d8                	jmp    804a0d <__divdi3+0x4e>
+  804a35:	83 ec 04             	sub    $0x4,%esp
+  804a38:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a3c:	56                   	push   %esi
+  804a3d:	f7 d9                	neg    %ecx
+  804a3f:	83 d3 00             	adc    $0x0,%ebx
+  804a42:	f7 db                	neg    %ebx
+  804a44:	53                   	push   %ebx
+  804a45:	51                   	push   %ecx
+  804a46:	e8 45 fe ff ff       	call   804890 <udm>
+  804a4b:	83 c4 10             	add    $0x10,%esp
+  804a4e:	eb c4                	jmp    804a14 <__divdi3+0x55>
+
+00804a50 <__moddi3>:
+  804a50:	55                   	push   %ebp
+  804a51:	57                   	push   %edi
+  804a52:	56                   	push   %esi
+  804a53:	53                   	push   %ebx
+  804a54:	83 ec 24             	sub    $0x24,%esp
+  804a57:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804a5b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804a5f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804a63:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804a67:	85 d2                	test   %edx,%edx
+  804a69:	78 3b                	js     804aa6 <__moddi3+0x56>
+  804a6b:	83 ec 04             	sub    $0x4,%esp
+  804a6e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804a72:	56                   	push   %esi
+  804a73:	89 ce                	mov    %ecx,%esi
+  804a75:	f7 de                	neg    %esi
+  804a77:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804a7b:	89 de                	mov    %ebx,%esi
+  804a7d:	83 d6 00             	adc    $0x0,%esi
+  804a80:	f7 de                	neg    %esi
+  804a82:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804a86:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804a8a:	0f 48 f1             	cmovs  %ecx,%esi
+  804a8d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804a92:	53                   	push   %ebx
+  804a93:	56                   	push   %esi
+  804a94:	e8 f7 fd ff ff       	call   804890 <udm>
+  804a99:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a9d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804aa1:	83 c4 10             	add    $0x10,%esp
+  804aa4:	eb 47                	jmp    804aed <__moddi3+0x9d>
+  804aa6:	f7 d8                	neg    %eax
+  804aa8:	83 d2 00             	adc    $0x0,%edx
+  804aab:	f7 da                	neg    %edx
+  804aad:	83 ec 04             	sub    $0x4,%esp
+  804ab0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804ab4:	56                   	push   %esi
+  804ab5:	89 cf                	mov    %ecx,%edi
+  804ab7:	f7 df                	neg    %edi
+  804ab9:	89 de                	mov    %ebx,%esi
+  804abb:	83 d6 00             	adc    $0x0,%esi
+  804abe:	f7 de                	neg    %esi
+  804ac0:	0f 49 cf             	cmovns %edi,%ecx
+  804ac3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804ac7:	0f 49 de             	cmovns %esi,%ebx
+  804aca:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804ace:	ff 74 24 0c          	push   0xc(%esp)
+  804ad2:	ff 74 24 0c          	push   0xc(%esp)
+  804ad6:	e8 b5 fd ff ff       	call   804890 <udm>
+  804adb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804adf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ae3:	f7 d8                	neg    %eax
+  804ae5:	83 d2 00             	adc    $0x0,%edx
+  804ae8:	f7 da                	neg    %edx
+  804aea:	83 c4 10             	add    $0x10,%esp
+  804aed:	83 c4 24             	add    $0x24,%esp
+  804af0:	5b                   	pop    %ebx
+  804af1:	5e                   	pop    %esi
+  804af2:	5f                   	pop    %edi
+  804af3:	5d                   	pop    %ebp
+  804af4:	c3                   	ret
@@ -0,0 +1,9712 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5a 00 00 00       	call   80008b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 20 47 80 00       	push   $0x804720
+  80003e:	e8 80 01 00 00       	call   8001c3 <cprintf>
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800043:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800045:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800053:	77 18                	ja     80006d <umain+0x3a>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800055:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80005a:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80005c:	c1 e8 10             	shr    $0x10,%eax
+  80005f:	74 0c                	je     80006d <umain+0x3a>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800061:	c1 e0 10             	shl    $0x10,%eax
+  800064:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800069:	29 c2                	sub    %eax,%edx
+  80006b:	eb 06                	jmp    800073 <umain+0x40>
+		return pthread_main_tls;
+  80006d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800073:	8b 02                	mov    (%edx),%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 08             	sub    $0x8,%esp
+  80007b:	50                   	push   %eax
+  80007c:	68 2e 47 80 00       	push   $0x80472e
+  800081:	e8 3d 01 00 00       	call   8001c3 <cprintf>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	c9                   	leave
+  80008a:	c3                   	ret
+
+0080008b <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80008b:	55                   	push   %ebp
+  80008c:	89 e5                	mov    %esp,%ebp
+  80008e:	57                   	push   %edi
+  80008f:	56                   	push   %esi
+  800090:	53                   	push   %ebx
+  800091:	83 ec 1c             	sub    $0x1c,%esp
+  800094:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800097:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80009a:	e8 ee 0a 00 00       	call   800b8d <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80009f:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000a2:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000a8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ad:	89 c1                	mov    %eax,%ecx
+  8000af:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000b1:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000b7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000bc:	77 16                	ja     8000d4 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000be:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000c3:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  8000c5:	c1 e8 10             	shr    $0x10,%eax
+  8000c8:	74 0a                	je     8000d4 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000ca:	c1 e0 10             	shl    $0x10,%eax
+  8000cd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000d2:	29 c2                	sub    %eax,%edx
+  8000d4:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000d7:	c1 e0 04             	shl    $0x4,%eax
+  8000da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000df:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e1:	85 db                	test   %ebx,%ebx
+  8000e3:	7e 07                	jle    8000ec <libmain+0x61>
+		binaryname = argv[0];
+  8000e5:	8b 06                	mov    (%esi),%eax
+  8000e7:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ec:	83 ec 08             	sub    $0x8,%esp
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	e8 3d ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000f6:	e8 0b 00 00 00       	call   800106 <exit>
+}
+  8000fb:	83 c4 10             	add    $0x10,%esp
+  8000fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800101:	5b                   	pop    %ebx
+  800102:	5e                   	pop    %esi
+  800103:	5f                   	pop    %edi
+  800104:	5d                   	pop    %ebp
+  800105:	c3                   	ret
+
+00800106 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800106:	55                   	push   %ebp
+  800107:	89 e5                	mov    %esp,%ebp
+  800109:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 cf 20 00 00       	call   8021e2 <fflush>
+	pthread_kill_others();
+  800113:	e8 3a 37 00 00       	call   803852 <pthread_kill_others>
+	close_all();
+  800118:	e8 68 11 00 00       	call   801285 <close_all>
+	sys_env_destroy(0);
+  80011d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800124:	e8 19 0a 00 00       	call   800b42 <sys_env_destroy>
+}
+  800129:	83 c4 10             	add    $0x10,%esp
+  80012c:	c9                   	leave
+  80012d:	c3                   	ret
+
+0080012e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	53                   	push   %ebx
+  800132:	83 ec 04             	sub    $0x4,%esp
+  800135:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800138:	8b 13                	mov    (%ebx),%edx
+  80013a:	8d 42 01             	lea    0x1(%edx),%eax
+  80013d:	89 03                	mov    %eax,(%ebx)
+  80013f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800142:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800146:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014b:	74 09                	je     800156 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80014d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800156:	83 ec 08             	sub    $0x8,%esp
+  800159:	68 ff 00 00 00       	push   $0xff
+  80015e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800161:	50                   	push   %eax
+  800162:	e8 84 09 00 00       	call   800aeb <sys_cputs>
+		b->idx = 0;
+  800167:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	eb db                	jmp    80014d <putch+0x1f>
+
+00800172 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800172:	55                   	push   %ebp
+  800173:	89 e5                	mov    %esp,%ebp
+  800175:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80017b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800182:	00 00 00 
+	b.cnt = 0;
+  800185:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80018c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80018f:	ff 75 0c             	push   0xc(%ebp)
+  800192:	ff 75 08             	push   0x8(%ebp)
+  800195:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80019b:	50                   	push   %eax
+  80019c:	68 2e 01 80 00       	push   $0x80012e
+  8001a1:	e8 14 01 00 00       	call   8002ba <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001a6:	83 c4 08             	add    $0x8,%esp
+  8001a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b5:	50                   	push   %eax
+  8001b6:	e8 30 09 00 00       	call   800aeb <sys_cputs>
+
+	return b.cnt;
+}
+  8001bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001cc:	50                   	push   %eax
+  8001cd:	ff 75 08             	push   0x8(%ebp)
+  8001d0:	e8 9d ff ff ff       	call   800172 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+008001d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  8001e0:	89 c7                	mov    %eax,%edi
+  8001e2:	89 d6                	mov    %edx,%esi
+  8001e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ea:	89 d1                	mov    %edx,%ecx
+  8001ec:	89 c2                	mov    %eax,%edx
+  8001ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800204:	39 c2                	cmp    %eax,%edx
+  800206:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800209:	72 3e                	jb     800249 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80020b:	83 ec 0c             	sub    $0xc,%esp
+  80020e:	ff 75 18             	push   0x18(%ebp)
+  800211:	83 eb 01             	sub    $0x1,%ebx
+  800214:	53                   	push   %ebx
+  800215:	50                   	push   %eax
+  800216:	83 ec 08             	sub    $0x8,%esp
+  800219:	ff 75 e4             	push   -0x1c(%ebp)
+  80021c:	ff 75 e0             	push   -0x20(%ebp)
+  80021f:	ff 75 dc             	push   -0x24(%ebp)
+  800222:	ff 75 d8             	push   -0x28(%ebp)
+  800225:	e8 67 43 00 00       	call   804591 <__udivdi3>
+  80022a:	83 c4 18             	add    $0x18,%esp
+  80022d:	52                   	push   %edx
+  80022e:	50                   	push   %eax
+  80022f:	89 f2                	mov    %esi,%edx
+  800231:	89 f8                	mov    %edi,%eax
+  800233:	e8 9f ff ff ff       	call   8001d7 <printnum>
+  800238:	83 c4 20             	add    $0x20,%esp
+  80023b:	eb 13                	jmp    800250 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80023d:	83 ec 08             	sub    $0x8,%esp
+  800240:	56                   	push   %esi
+  800241:	ff 75 18             	push   0x18(%ebp)
+  800244:	ff d7                	call   *%edi
+  800246:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	85 db                	test   %ebx,%ebx
+  80024e:	7f ed                	jg     80023d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800250:	83 ec 08             	sub    $0x8,%esp
+  800253:	56                   	push   %esi
+  800254:	83 ec 04             	sub    $0x4,%esp
+  800257:	ff 75 e4             	push   -0x1c(%ebp)
+  80025a:	ff 75 e0             	push   -0x20(%ebp)
+  80025d:	ff 75 dc             	push   -0x24(%ebp)
+  800260:	ff 75 d8             	push   -0x28(%ebp)
+  800263:	e8 4a 43 00 00       	call   8045b2 <__umoddi3>
+  800268:	83 c4 14             	add    $0x14,%esp
+  80026b:	0f be 80 4f 47 80 00 	movsbl 0x80474f(%eax),%eax
+  800272:	50                   	push   %eax
+  800273:	ff d7                	call   *%edi
+}
+  800275:	83 c4 10             	add    $0x10,%esp
+  800278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027b:	5b                   	pop    %ebx
+  80027c:	5e                   	pop    %esi
+  80027d:	5f                   	pop    %edi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800286:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80028a:	8b 10                	mov    (%eax),%edx
+  80028c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80028f:	73 0a                	jae    80029b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800291:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800294:	89 08                	mov    %ecx,(%eax)
+  800296:	8b 45 08             	mov    0x8(%ebp),%eax
+  800299:	88 02                	mov    %al,(%edx)
+}
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+
+0080029d <printfmt>:
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002a6:	50                   	push   %eax
+  8002a7:	ff 75 10             	push   0x10(%ebp)
+  8002aa:	ff 75 0c             	push   0xc(%ebp)
+  8002ad:	ff 75 08             	push   0x8(%ebp)
+  8002b0:	e8 05 00 00 00       	call   8002ba <vprintfmt>
+}
+  8002b5:	83 c4 10             	add    $0x10,%esp
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+008002ba <vprintfmt>:
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	57                   	push   %edi
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+  8002c0:	83 ec 2c             	sub    $0x2c,%esp
+  8002c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002cc:	eb 0a                	jmp    8002d8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	53                   	push   %ebx
+  8002d2:	50                   	push   %eax
+  8002d3:	ff d6                	call   *%esi
+  8002d5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8002d8:	83 c7 01             	add    $0x1,%edi
+  8002db:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8002df:	83 f8 25             	cmp    $0x25,%eax
+  8002e2:	74 0c                	je     8002f0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	75 e6                	jne    8002ce <vprintfmt+0x14>
+}
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+		padc = ' ';
+  8002f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800302:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800309:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80030e:	8d 47 01             	lea    0x1(%edi),%eax
+  800311:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800314:	0f b6 17             	movzbl (%edi),%edx
+  800317:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80031a:	3c 55                	cmp    $0x55,%al
+  80031c:	0f 87 c5 03 00 00    	ja     8006e7 <vprintfmt+0x42d>
+  800322:	0f b6 c0             	movzbl %al,%eax
+  800325:	ff 24 85 e0 48 80 00 	jmp    *0x8048e0(,%eax,4)
+  80032c:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800332:	eb da                	jmp    80030e <vprintfmt+0x54>
+  800334:	0f be d2             	movsbl %dl,%edx
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800342:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800345:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800349:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034f:	83 f9 09             	cmp    $0x9,%ecx
+  800352:	77 55                	ja     8003a9 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800354:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800357:	eb e9                	jmp    800342 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8b 00                	mov    (%eax),%eax
+  80035e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800361:	8b 45 14             	mov    0x14(%ebp),%eax
+  800364:	8d 40 04             	lea    0x4(%eax),%eax
+  800367:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800371:	79 9b                	jns    80030e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800373:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800376:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800379:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800380:	eb 8c                	jmp    80030e <vprintfmt+0x54>
+			if (width < 0)
+  800382:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800385:	85 d2                	test   %edx,%edx
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	0f 49 c2             	cmovns %edx,%eax
+  80038f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800395:	e9 74 ff ff ff       	jmp    80030e <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a4:	e9 65 ff ff ff       	jmp    80030e <vprintfmt+0x54>
+  8003a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003af:	eb bc                	jmp    80036d <vprintfmt+0xb3>
+			lflag++;
+  8003b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 52 ff ff ff       	jmp    80030e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	53                   	push   %ebx
+  8003c6:	ff 30                	push   (%eax)
+  8003c8:	ff d6                	call   *%esi
+			break;
+  8003ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003d0:	e9 b1 02 00 00       	jmp    800686 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8003d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003db:	8b 10                	mov    (%eax),%edx
+  8003dd:	89 d0                	mov    %edx,%eax
+  8003df:	f7 d8                	neg    %eax
+  8003e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e4:	83 f8 14             	cmp    $0x14,%eax
+  8003e7:	7f 23                	jg     80040c <vprintfmt+0x152>
+  8003e9:	8b 14 85 40 4a 80 00 	mov    0x804a40(,%eax,4),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	74 18                	je     80040c <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8003f4:	52                   	push   %edx
+  8003f5:	68 af 4b 80 00       	push   $0x804baf
+  8003fa:	53                   	push   %ebx
+  8003fb:	56                   	push   %esi
+  8003fc:	e8 9c fe ff ff       	call   80029d <printfmt>
+  800401:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800404:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800407:	e9 7a 02 00 00       	jmp    800686 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80040c:	50                   	push   %eax
+  80040d:	68 67 47 80 00       	push   $0x804767
+  800412:	53                   	push   %ebx
+  800413:	56                   	push   %esi
+  800414:	e8 84 fe ff ff       	call   80029d <printfmt>
+  800419:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041f:	e9 62 02 00 00       	jmp    800686 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	83 c0 04             	add    $0x4,%eax
+  80042a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800432:	85 c9                	test   %ecx,%ecx
+  800434:	b8 60 47 80 00       	mov    $0x804760,%eax
+  800439:	0f 45 c1             	cmovne %ecx,%eax
+  80043c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800443:	7e 06                	jle    80044b <vprintfmt+0x191>
+  800445:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800449:	75 0b                	jne    800456 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800451:	89 75 08             	mov    %esi,0x8(%ebp)
+  800454:	eb 5c                	jmp    8004b2 <vprintfmt+0x1f8>
+  800456:	83 ec 08             	sub    $0x8,%esp
+  800459:	ff 75 d0             	push   -0x30(%ebp)
+  80045c:	ff 75 cc             	push   -0x34(%ebp)
+  80045f:	e8 20 03 00 00       	call   800784 <strnlen>
+  800464:	89 c2                	mov    %eax,%edx
+  800466:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800469:	29 d0                	sub    %edx,%eax
+  80046b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	89 75 08             	mov    %esi,0x8(%ebp)
+  800478:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047a:	eb 0e                	jmp    80048a <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80047c:	83 ec 08             	sub    $0x8,%esp
+  80047f:	53                   	push   %ebx
+  800480:	57                   	push   %edi
+  800481:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	83 ee 01             	sub    $0x1,%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+  80048a:	85 f6                	test   %esi,%esi
+  80048c:	7f ee                	jg     80047c <vprintfmt+0x1c2>
+  80048e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800491:	8b 75 08             	mov    0x8(%ebp),%esi
+  800494:	85 c0                	test   %eax,%eax
+  800496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049b:	0f 49 d0             	cmovns %eax,%edx
+  80049e:	29 d0                	sub    %edx,%eax
+  8004a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a3:	eb a6                	jmp    80044b <vprintfmt+0x191>
+					putch(ch, putdat);
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	52                   	push   %edx
+  8004aa:	ff 55 08             	call   *0x8(%ebp)
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b0:	89 f1                	mov    %esi,%ecx
+  8004b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b9:	0f be d0             	movsbl %al,%edx
+  8004bc:	85 d2                	test   %edx,%edx
+  8004be:	74 28                	je     8004e8 <vprintfmt+0x22e>
+  8004c0:	85 ff                	test   %edi,%edi
+  8004c2:	78 05                	js     8004c9 <vprintfmt+0x20f>
+  8004c4:	83 ef 01             	sub    $0x1,%edi
+  8004c7:	78 30                	js     8004f9 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cd:	74 d6                	je     8004a5 <vprintfmt+0x1eb>
+  8004cf:	0f be c0             	movsbl %al,%eax
+  8004d2:	83 e8 20             	sub    $0x20,%eax
+  8004d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d8:	76 cb                	jbe    8004a5 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	6a 3f                	push   $0x3f
+  8004e0:	ff 55 08             	call   *0x8(%ebp)
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	eb c8                	jmp    8004b0 <vprintfmt+0x1f6>
+  8004e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f1:	01 d0                	add    %edx,%eax
+  8004f3:	29 c8                	sub    %ecx,%eax
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	eb 13                	jmp    80050c <vprintfmt+0x252>
+  8004f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fc:	eb ed                	jmp    8004eb <vprintfmt+0x231>
+				putch(' ', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	6a 20                	push   $0x20
+  800504:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	7f ee                	jg     8004fe <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800510:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	e9 6b 01 00 00       	jmp    800686 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80051b:	83 f9 01             	cmp    $0x1,%ecx
+  80051e:	7f 1f                	jg     80053f <vprintfmt+0x285>
+	else if (lflag)
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	74 67                	je     80058b <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052c:	89 c1                	mov    %eax,%ecx
+  80052e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800531:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8d 40 04             	lea    0x4(%eax),%eax
+  80053a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053d:	eb 17                	jmp    800556 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8b 50 04             	mov    0x4(%eax),%edx
+  800545:	8b 00                	mov    (%eax),%eax
+  800547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	8d 40 08             	lea    0x8(%eax),%eax
+  800553:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800556:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800559:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800561:	85 c9                	test   %ecx,%ecx
+  800563:	0f 89 03 01 00 00    	jns    80066c <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	6a 2d                	push   $0x2d
+  80056f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800571:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800574:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800577:	f7 da                	neg    %edx
+  800579:	83 d1 00             	adc    $0x0,%ecx
+  80057c:	f7 d9                	neg    %ecx
+  80057e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800581:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800586:	e9 e1 00 00 00       	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 00                	mov    (%eax),%eax
+  800590:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800593:	89 c1                	mov    %eax,%ecx
+  800595:	c1 f9 1f             	sar    $0x1f,%ecx
+  800598:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	eb b0                	jmp    800556 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8005a6:	83 f9 01             	cmp    $0x1,%ecx
+  8005a9:	7f 1e                	jg     8005c9 <vprintfmt+0x30f>
+	else if (lflag)
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	74 32                	je     8005e1 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 10                	mov    (%eax),%edx
+  8005b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c4:	e9 a3 00 00 00       	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 10                	mov    (%eax),%edx
+  8005ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005dc:	e9 8b 00 00 00       	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f6:	eb 74                	jmp    80066c <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8005f8:	83 f9 01             	cmp    $0x1,%ecx
+  8005fb:	7f 1b                	jg     800618 <vprintfmt+0x35e>
+	else if (lflag)
+  8005fd:	85 c9                	test   %ecx,%ecx
+  8005ff:	74 2c                	je     80062d <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 10                	mov    (%eax),%edx
+  800606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060b:	8d 40 04             	lea    0x4(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800611:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800616:	eb 54                	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800620:	8d 40 08             	lea    0x8(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800626:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80062b:	eb 3f                	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80063d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800642:	eb 28                	jmp    80066c <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800644:	83 ec 08             	sub    $0x8,%esp
+  800647:	53                   	push   %ebx
+  800648:	6a 30                	push   $0x30
+  80064a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80064c:	83 c4 08             	add    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 78                	push   $0x78
+  800652:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 10                	mov    (%eax),%edx
+  800659:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800667:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80066c:	83 ec 0c             	sub    $0xc,%esp
+  80066f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800673:	50                   	push   %eax
+  800674:	ff 75 e0             	push   -0x20(%ebp)
+  800677:	57                   	push   %edi
+  800678:	51                   	push   %ecx
+  800679:	52                   	push   %edx
+  80067a:	89 da                	mov    %ebx,%edx
+  80067c:	89 f0                	mov    %esi,%eax
+  80067e:	e8 54 fb ff ff       	call   8001d7 <printnum>
+			break;
+  800683:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800686:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800689:	e9 4a fc ff ff       	jmp    8002d8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80068e:	83 f9 01             	cmp    $0x1,%ecx
+  800691:	7f 1b                	jg     8006ae <vprintfmt+0x3f4>
+	else if (lflag)
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	74 2c                	je     8006c3 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ac:	eb be                	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 10                	mov    (%eax),%edx
+  8006b3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006bc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c1:	eb a9                	jmp    80066c <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d8:	eb 92                	jmp    80066c <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8006da:	83 ec 08             	sub    $0x8,%esp
+  8006dd:	53                   	push   %ebx
+  8006de:	6a 25                	push   $0x25
+  8006e0:	ff d6                	call   *%esi
+			break;
+  8006e2:	83 c4 10             	add    $0x10,%esp
+  8006e5:	eb 9f                	jmp    800686 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8006e7:	83 ec 08             	sub    $0x8,%esp
+  8006ea:	53                   	push   %ebx
+  8006eb:	6a 25                	push   $0x25
+  8006ed:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ef:	83 c4 10             	add    $0x10,%esp
+  8006f2:	89 f8                	mov    %edi,%eax
+  8006f4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f8:	74 05                	je     8006ff <vprintfmt+0x445>
+  8006fa:	83 e8 01             	sub    $0x1,%eax
+  8006fd:	eb f5                	jmp    8006f4 <vprintfmt+0x43a>
+  8006ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800702:	eb 82                	jmp    800686 <vprintfmt+0x3cc>
+
+00800704 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800704:	55                   	push   %ebp
+  800705:	89 e5                	mov    %esp,%ebp
+  800707:	83 ec 18             	sub    $0x18,%esp
+  80070a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800710:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800713:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800717:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80071a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800721:	85 c0                	test   %eax,%eax
+  800723:	74 26                	je     80074b <vsnprintf+0x47>
+  800725:	85 d2                	test   %edx,%edx
+  800727:	7e 22                	jle    80074b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800729:	ff 75 14             	push   0x14(%ebp)
+  80072c:	ff 75 10             	push   0x10(%ebp)
+  80072f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800732:	50                   	push   %eax
+  800733:	68 80 02 80 00       	push   $0x800280
+  800738:	e8 7d fb ff ff       	call   8002ba <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80073d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800740:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800746:	83 c4 10             	add    $0x10,%esp
+}
+  800749:	c9                   	leave
+  80074a:	c3                   	ret
+		return -E_INVAL;
+  80074b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800750:	eb f7                	jmp    800749 <vsnprintf+0x45>
+
+00800752 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+  800755:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800758:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80075b:	50                   	push   %eax
+  80075c:	ff 75 10             	push   0x10(%ebp)
+  80075f:	ff 75 0c             	push   0xc(%ebp)
+  800762:	ff 75 08             	push   0x8(%ebp)
+  800765:	e8 9a ff ff ff       	call   800704 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80076a:	c9                   	leave
+  80076b:	c3                   	ret
+
+0080076c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800772:	b8 00 00 00 00       	mov    $0x0,%eax
+  800777:	eb 03                	jmp    80077c <strlen+0x10>
+		n++;
+  800779:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80077c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800780:	75 f7                	jne    800779 <strlen+0xd>
+	return n;
+}
+  800782:	5d                   	pop    %ebp
+  800783:	c3                   	ret
+
+00800784 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800784:	55                   	push   %ebp
+  800785:	89 e5                	mov    %esp,%ebp
+  800787:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	eb 03                	jmp    800797 <strnlen+0x13>
+		n++;
+  800794:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800797:	39 d0                	cmp    %edx,%eax
+  800799:	74 08                	je     8007a3 <strnlen+0x1f>
+  80079b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079f:	75 f3                	jne    800794 <strnlen+0x10>
+  8007a1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a3:	89 d0                	mov    %edx,%eax
+  8007a5:	5d                   	pop    %ebp
+  8007a6:	c3                   	ret
+
+008007a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	53                   	push   %ebx
+  8007ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007bd:	83 c0 01             	add    $0x1,%eax
+  8007c0:	84 d2                	test   %dl,%dl
+  8007c2:	75 f2                	jne    8007b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c4:	89 c8                	mov    %ecx,%eax
+  8007c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+
+008007cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	53                   	push   %ebx
+  8007cf:	83 ec 10             	sub    $0x10,%esp
+  8007d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d5:	53                   	push   %ebx
+  8007d6:	e8 91 ff ff ff       	call   80076c <strlen>
+  8007db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007de:	ff 75 0c             	push   0xc(%ebp)
+  8007e1:	01 d8                	add    %ebx,%eax
+  8007e3:	50                   	push   %eax
+  8007e4:	e8 be ff ff ff       	call   8007a7 <strcpy>
+	return dst;
+}
+  8007e9:	89 d8                	mov    %ebx,%eax
+  8007eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ee:	c9                   	leave
+  8007ef:	c3                   	ret
+
+008007f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	56                   	push   %esi
+  8007f4:	53                   	push   %ebx
+  8007f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007fb:	89 f3                	mov    %esi,%ebx
+  8007fd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800800:	89 f0                	mov    %esi,%eax
+  800802:	eb 0f                	jmp    800813 <strncpy+0x23>
+		*dst++ = *src;
+  800804:	83 c0 01             	add    $0x1,%eax
+  800807:	0f b6 0a             	movzbl (%edx),%ecx
+  80080a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80080d:	80 f9 01             	cmp    $0x1,%cl
+  800810:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800813:	39 d8                	cmp    %ebx,%eax
+  800815:	75 ed                	jne    800804 <strncpy+0x14>
+	}
+	return ret;
+}
+  800817:	89 f0                	mov    %esi,%eax
+  800819:	5b                   	pop    %ebx
+  80081a:	5e                   	pop    %esi
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+
+0080081d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	56                   	push   %esi
+  800821:	53                   	push   %ebx
+  800822:	8b 75 08             	mov    0x8(%ebp),%esi
+  800825:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800828:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80082b:	89 f0                	mov    %esi,%eax
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	74 21                	je     800852 <strlcpy+0x35>
+  800831:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800835:	89 f2                	mov    %esi,%edx
+  800837:	eb 09                	jmp    800842 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800839:	83 c1 01             	add    $0x1,%ecx
+  80083c:	83 c2 01             	add    $0x1,%edx
+  80083f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800842:	39 c2                	cmp    %eax,%edx
+  800844:	74 09                	je     80084f <strlcpy+0x32>
+  800846:	0f b6 19             	movzbl (%ecx),%ebx
+  800849:	84 db                	test   %bl,%bl
+  80084b:	75 ec                	jne    800839 <strlcpy+0x1c>
+  80084d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80084f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800852:	29 f0                	sub    %esi,%eax
+}
+  800854:	5b                   	pop    %ebx
+  800855:	5e                   	pop    %esi
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+
+00800858 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800861:	eb 06                	jmp    800869 <strcmp+0x11>
+		p++, q++;
+  800863:	83 c1 01             	add    $0x1,%ecx
+  800866:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800869:	0f b6 01             	movzbl (%ecx),%eax
+  80086c:	84 c0                	test   %al,%al
+  80086e:	74 04                	je     800874 <strcmp+0x1c>
+  800870:	3a 02                	cmp    (%edx),%al
+  800872:	74 ef                	je     800863 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800874:	0f b6 c0             	movzbl %al,%eax
+  800877:	0f b6 12             	movzbl (%edx),%edx
+  80087a:	29 d0                	sub    %edx,%eax
+}
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	53                   	push   %ebx
+  800882:	8b 45 08             	mov    0x8(%ebp),%eax
+  800885:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800888:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80088b:	eb 09                	jmp    800896 <strncmp+0x18>
+		n--, p++, q++;
+  80088d:	83 ea 01             	sub    $0x1,%edx
+  800890:	83 c0 01             	add    $0x1,%eax
+  800893:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800896:	85 d2                	test   %edx,%edx
+  800898:	74 18                	je     8008b2 <strncmp+0x34>
+  80089a:	0f b6 18             	movzbl (%eax),%ebx
+  80089d:	84 db                	test   %bl,%bl
+  80089f:	74 04                	je     8008a5 <strncmp+0x27>
+  8008a1:	3a 19                	cmp    (%ecx),%bl
+  8008a3:	74 e8                	je     80088d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a5:	0f b6 00             	movzbl (%eax),%eax
+  8008a8:	0f b6 11             	movzbl (%ecx),%edx
+  8008ab:	29 d0                	sub    %edx,%eax
+}
+  8008ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b0:	c9                   	leave
+  8008b1:	c3                   	ret
+		return 0;
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b7:	eb f4                	jmp    8008ad <strncmp+0x2f>
+
+008008b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c3:	eb 03                	jmp    8008c8 <strchr+0xf>
+  8008c5:	83 c0 01             	add    $0x1,%eax
+  8008c8:	0f b6 10             	movzbl (%eax),%edx
+  8008cb:	84 d2                	test   %dl,%dl
+  8008cd:	74 06                	je     8008d5 <strchr+0x1c>
+		if (*s == c)
+  8008cf:	38 ca                	cmp    %cl,%dl
+  8008d1:	75 f2                	jne    8008c5 <strchr+0xc>
+  8008d3:	eb 05                	jmp    8008da <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e9:	38 ca                	cmp    %cl,%dl
+  8008eb:	74 09                	je     8008f6 <strfind+0x1a>
+  8008ed:	84 d2                	test   %dl,%dl
+  8008ef:	74 05                	je     8008f6 <strfind+0x1a>
+	for (; *s; s++)
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	eb f0                	jmp    8008e6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	57                   	push   %edi
+  8008fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800902:	85 c9                	test   %ecx,%ecx
+  800904:	74 20                	je     800926 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800906:	89 f8                	mov    %edi,%eax
+  800908:	09 c8                	or     %ecx,%eax
+  80090a:	a8 03                	test   $0x3,%al
+  80090c:	75 12                	jne    800920 <memset+0x28>
+		c &= 0xFF;
+  80090e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800912:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800918:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80091b:	fc                   	cld
+  80091c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091e:	eb 06                	jmp    800926 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800920:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800923:	fc                   	cld
+  800924:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800926:	89 f8                	mov    %edi,%eax
+  800928:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80092b:	c9                   	leave
+  80092c:	c3                   	ret
+
+0080092d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	57                   	push   %edi
+  800931:	56                   	push   %esi
+  800932:	8b 45 08             	mov    0x8(%ebp),%eax
+  800935:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800938:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80093b:	39 c6                	cmp    %eax,%esi
+  80093d:	73 32                	jae    800971 <memmove+0x44>
+  80093f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800942:	39 d0                	cmp    %edx,%eax
+  800944:	73 2b                	jae    800971 <memmove+0x44>
+		s += n;
+		d += n;
+  800946:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800949:	89 d6                	mov    %edx,%esi
+  80094b:	09 fe                	or     %edi,%esi
+  80094d:	09 ce                	or     %ecx,%esi
+  80094f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800955:	75 0e                	jne    800965 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800957:	83 ef 04             	sub    $0x4,%edi
+  80095a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80095d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800960:	fd                   	std
+  800961:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800963:	eb 09                	jmp    80096e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800965:	83 ef 01             	sub    $0x1,%edi
+  800968:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80096b:	fd                   	std
+  80096c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80096e:	fc                   	cld
+  80096f:	eb 1a                	jmp    80098b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800971:	89 f2                	mov    %esi,%edx
+  800973:	09 c2                	or     %eax,%edx
+  800975:	09 ca                	or     %ecx,%edx
+  800977:	f6 c2 03             	test   $0x3,%dl
+  80097a:	75 0a                	jne    800986 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80097c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80097f:	89 c7                	mov    %eax,%edi
+  800981:	fc                   	cld
+  800982:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800984:	eb 05                	jmp    80098b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800986:	89 c7                	mov    %eax,%edi
+  800988:	fc                   	cld
+  800989:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80098b:	5e                   	pop    %esi
+  80098c:	5f                   	pop    %edi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800995:	ff 75 10             	push   0x10(%ebp)
+  800998:	ff 75 0c             	push   0xc(%ebp)
+  80099b:	ff 75 08             	push   0x8(%ebp)
+  80099e:	e8 8a ff ff ff       	call   80092d <memmove>
+}
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009b0:	89 c6                	mov    %eax,%esi
+  8009b2:	03 75 10             	add    0x10(%ebp),%esi
+  8009b5:	eb 06                	jmp    8009bd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b7:	83 c0 01             	add    $0x1,%eax
+  8009ba:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009bd:	39 f0                	cmp    %esi,%eax
+  8009bf:	74 14                	je     8009d5 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c1:	0f b6 08             	movzbl (%eax),%ecx
+  8009c4:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c7:	38 d9                	cmp    %bl,%cl
+  8009c9:	74 ec                	je     8009b7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009cb:	0f b6 c1             	movzbl %cl,%eax
+  8009ce:	0f b6 db             	movzbl %bl,%ebx
+  8009d1:	29 d8                	sub    %ebx,%eax
+  8009d3:	eb 05                	jmp    8009da <memcmp+0x35>
+	}
+
+	return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009da:	5b                   	pop    %ebx
+  8009db:	5e                   	pop    %esi
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e7:	89 c2                	mov    %eax,%edx
+  8009e9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009ec:	eb 03                	jmp    8009f1 <memfind+0x13>
+  8009ee:	83 c0 01             	add    $0x1,%eax
+  8009f1:	39 d0                	cmp    %edx,%eax
+  8009f3:	73 04                	jae    8009f9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f5:	38 08                	cmp    %cl,(%eax)
+  8009f7:	75 f5                	jne    8009ee <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	57                   	push   %edi
+  8009ff:	56                   	push   %esi
+  800a00:	53                   	push   %ebx
+  800a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a07:	eb 03                	jmp    800a0c <strtol+0x11>
+		s++;
+  800a09:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a0c:	0f b6 02             	movzbl (%edx),%eax
+  800a0f:	3c 20                	cmp    $0x20,%al
+  800a11:	74 f6                	je     800a09 <strtol+0xe>
+  800a13:	3c 09                	cmp    $0x9,%al
+  800a15:	74 f2                	je     800a09 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a17:	3c 2b                	cmp    $0x2b,%al
+  800a19:	74 2a                	je     800a45 <strtol+0x4a>
+	int neg = 0;
+  800a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a20:	3c 2d                	cmp    $0x2d,%al
+  800a22:	74 2b                	je     800a4f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a24:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a2a:	75 0f                	jne    800a3b <strtol+0x40>
+  800a2c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2f:	74 28                	je     800a59 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a31:	85 db                	test   %ebx,%ebx
+  800a33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a38:	0f 44 d8             	cmove  %eax,%ebx
+  800a3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a40:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a43:	eb 46                	jmp    800a8b <strtol+0x90>
+		s++;
+  800a45:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4d:	eb d5                	jmp    800a24 <strtol+0x29>
+		s++, neg = 1;
+  800a4f:	83 c2 01             	add    $0x1,%edx
+  800a52:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a57:	eb cb                	jmp    800a24 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a59:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a5d:	74 0e                	je     800a6d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a5f:	85 db                	test   %ebx,%ebx
+  800a61:	75 d8                	jne    800a3b <strtol+0x40>
+		s++, base = 8;
+  800a63:	83 c2 01             	add    $0x1,%edx
+  800a66:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a6b:	eb ce                	jmp    800a3b <strtol+0x40>
+		s += 2, base = 16;
+  800a6d:	83 c2 02             	add    $0x2,%edx
+  800a70:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a75:	eb c4                	jmp    800a3b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a77:	0f be c0             	movsbl %al,%eax
+  800a7a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a7d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a80:	7d 3a                	jge    800abc <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a82:	83 c2 01             	add    $0x1,%edx
+  800a85:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a89:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a8b:	0f b6 02             	movzbl (%edx),%eax
+  800a8e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a91:	89 f3                	mov    %esi,%ebx
+  800a93:	80 fb 09             	cmp    $0x9,%bl
+  800a96:	76 df                	jbe    800a77 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a98:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a9b:	89 f3                	mov    %esi,%ebx
+  800a9d:	80 fb 19             	cmp    $0x19,%bl
+  800aa0:	77 08                	ja     800aaa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa2:	0f be c0             	movsbl %al,%eax
+  800aa5:	83 e8 57             	sub    $0x57,%eax
+  800aa8:	eb d3                	jmp    800a7d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aaa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aad:	89 f3                	mov    %esi,%ebx
+  800aaf:	80 fb 19             	cmp    $0x19,%bl
+  800ab2:	77 08                	ja     800abc <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab4:	0f be c0             	movsbl %al,%eax
+  800ab7:	83 e8 37             	sub    $0x37,%eax
+  800aba:	eb c1                	jmp    800a7d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800abc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac0:	74 05                	je     800ac7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac7:	89 c8                	mov    %ecx,%eax
+  800ac9:	f7 d8                	neg    %eax
+  800acb:	85 ff                	test   %edi,%edi
+  800acd:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad0:	89 c8                	mov    %ecx,%eax
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800add:	6a 00                	push   $0x0
+  800adf:	6a 00                	push   $0x0
+  800ae1:	ff 75 08             	push   0x8(%ebp)
+  800ae4:	e8 12 ff ff ff       	call   8009fb <strtol>
+}
+  800ae9:	c9                   	leave
+  800aea:	c3                   	ret
+
+00800aeb <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	57                   	push   %edi
+  800aef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800afb:	89 c3                	mov    %eax,%ebx
+  800afd:	89 c7                	mov    %eax,%edi
+  800aff:	6a 00                	push   $0x0
+  800b01:	55                   	push   %ebp
+  800b02:	56                   	push   %esi
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	8d 35 0d 0b 80 00    	lea    0x800b0d,%esi
+  800b0b:	0f 34                	sysenter
+
+00800b0d <after_sysenter_label_47>:
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5d                   	pop    %ebp
+  800b0f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b12:	5b                   	pop    %ebx
+  800b13:	5f                   	pop    %edi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	57                   	push   %edi
+  800b1a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b25:	89 d1                	mov    %edx,%ecx
+  800b27:	89 d3                	mov    %edx,%ebx
+  800b29:	89 d7                	mov    %edx,%edi
+  800b2b:	6a 00                	push   $0x0
+  800b2d:	55                   	push   %ebp
+  800b2e:	56                   	push   %esi
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	8d 35 39 0b 80 00    	lea    0x800b39,%esi
+  800b37:	0f 34                	sysenter
+
+00800b39 <after_sysenter_label_128>:
+  800b39:	5e                   	pop    %esi
+  800b3a:	5d                   	pop    %ebp
+  800b3b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b54:	89 cb                	mov    %ecx,%ebx
+  800b56:	89 cf                	mov    %ecx,%edi
+  800b58:	6a 00                	push   $0x0
+  800b5a:	55                   	push   %ebp
+  800b5b:	56                   	push   %esi
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	8d 35 66 0b 80 00    	lea    0x800b66,%esi
+  800b64:	0f 34                	sysenter
+
+00800b66 <after_sysenter_label_212>:
+  800b66:	5e                   	pop    %esi
+  800b67:	5d                   	pop    %ebp
+  800b68:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b6b:	85 c0                	test   %eax,%eax
+  800b6d:	7f 07                	jg     800b76 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b72:	5b                   	pop    %ebx
+  800b73:	5f                   	pop    %edi
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b76:	83 ec 0c             	sub    $0xc,%esp
+  800b79:	50                   	push   %eax
+  800b7a:	6a 03                	push   $0x3
+  800b7c:	68 d5 4a 80 00       	push   $0x804ad5
+  800b81:	6a 54                	push   $0x54
+  800b83:	68 f2 4a 80 00       	push   $0x804af2
+  800b88:	e8 38 30 00 00       	call   803bc5 <_panic>
+
+00800b8d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b97:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b9c:	89 d1                	mov    %edx,%ecx
+  800b9e:	89 d3                	mov    %edx,%ebx
+  800ba0:	89 d7                	mov    %edx,%edi
+  800ba2:	6a 00                	push   $0x0
+  800ba4:	55                   	push   %ebp
+  800ba5:	56                   	push   %esi
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	8d 35 b0 0b 80 00    	lea    0x800bb0,%esi
+  800bae:	0f 34                	sysenter
+
+00800bb0 <after_sysenter_label_309>:
+  800bb0:	5e                   	pop    %esi
+  800bb1:	5d                   	pop    %ebp
+  800bb2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bb5:	5b                   	pop    %ebx
+  800bb6:	5f                   	pop    %edi
+  800bb7:	5d                   	pop    %ebp
+  800bb8:	c3                   	ret
+
+00800bb9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	57                   	push   %edi
+  800bbd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bc8:	89 d1                	mov    %edx,%ecx
+  800bca:	89 d3                	mov    %edx,%ebx
+  800bcc:	89 d7                	mov    %edx,%edi
+  800bce:	6a 00                	push   $0x0
+  800bd0:	55                   	push   %ebp
+  800bd1:	56                   	push   %esi
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	8d 35 dc 0b 80 00    	lea    0x800bdc,%esi
+  800bda:	0f 34                	sysenter
+
+00800bdc <after_sysenter_label_391>:
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be1:	5b                   	pop    %ebx
+  800be2:	5f                   	pop    %edi
+  800be3:	5d                   	pop    %ebp
+  800be4:	c3                   	ret
+
+00800be5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	57                   	push   %edi
+  800be9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfd:	6a 00                	push   $0x0
+  800bff:	55                   	push   %ebp
+  800c00:	56                   	push   %esi
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	8d 35 0b 0c 80 00    	lea    0x800c0b,%esi
+  800c09:	0f 34                	sysenter
+
+00800c0b <after_sysenter_label_479>:
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c10:	85 c0                	test   %eax,%eax
+  800c12:	7f 07                	jg     800c1b <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c17:	5b                   	pop    %ebx
+  800c18:	5f                   	pop    %edi
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1b:	83 ec 0c             	sub    $0xc,%esp
+  800c1e:	50                   	push   %eax
+  800c1f:	6a 04                	push   $0x4
+  800c21:	68 d5 4a 80 00       	push   $0x804ad5
+  800c26:	6a 54                	push   $0x54
+  800c28:	68 f2 4a 80 00       	push   $0x804af2
+  800c2d:	e8 93 2f 00 00       	call   803bc5 <_panic>
+
+00800c32 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c45:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c48:	ff 75 18             	push   0x18(%ebp)
+  800c4b:	55                   	push   %ebp
+  800c4c:	56                   	push   %esi
+  800c4d:	89 e5                	mov    %esp,%ebp
+  800c4f:	8d 35 57 0c 80 00    	lea    0x800c57,%esi
+  800c55:	0f 34                	sysenter
+
+00800c57 <after_sysenter_label_593>:
+  800c57:	5e                   	pop    %esi
+  800c58:	5d                   	pop    %ebp
+  800c59:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c5c:	85 c0                	test   %eax,%eax
+  800c5e:	7f 07                	jg     800c67 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c63:	5b                   	pop    %ebx
+  800c64:	5f                   	pop    %edi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+  800c6a:	50                   	push   %eax
+  800c6b:	6a 05                	push   $0x5
+  800c6d:	68 d5 4a 80 00       	push   $0x804ad5
+  800c72:	6a 54                	push   $0x54
+  800c74:	68 f2 4a 80 00       	push   $0x804af2
+  800c79:	e8 47 2f 00 00       	call   803bc5 <_panic>
+
+00800c7e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c93:	89 df                	mov    %ebx,%edi
+  800c95:	6a 00                	push   $0x0
+  800c97:	55                   	push   %ebp
+  800c98:	56                   	push   %esi
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	8d 35 a3 0c 80 00    	lea    0x800ca3,%esi
+  800ca1:	0f 34                	sysenter
+
+00800ca3 <after_sysenter_label_704>:
+  800ca3:	5e                   	pop    %esi
+  800ca4:	5d                   	pop    %ebp
+  800ca5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	7f 07                	jg     800cb3 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	50                   	push   %eax
+  800cb7:	6a 06                	push   $0x6
+  800cb9:	68 d5 4a 80 00       	push   $0x804ad5
+  800cbe:	6a 54                	push   $0x54
+  800cc0:	68 f2 4a 80 00       	push   $0x804af2
+  800cc5:	e8 fb 2e 00 00       	call   803bc5 <_panic>
+
+00800cca <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cda:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cdf:	89 df                	mov    %ebx,%edi
+  800ce1:	6a 00                	push   $0x0
+  800ce3:	55                   	push   %ebp
+  800ce4:	56                   	push   %esi
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	8d 35 ef 0c 80 00    	lea    0x800cef,%esi
+  800ced:	0f 34                	sysenter
+
+00800cef <after_sysenter_label_808>:
+  800cef:	5e                   	pop    %esi
+  800cf0:	5d                   	pop    %ebp
+  800cf1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 07                	jg     800cff <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	50                   	push   %eax
+  800d03:	6a 08                	push   $0x8
+  800d05:	68 d5 4a 80 00       	push   $0x804ad5
+  800d0a:	6a 54                	push   $0x54
+  800d0c:	68 f2 4a 80 00       	push   $0x804af2
+  800d11:	e8 af 2e 00 00       	call   803bc5 <_panic>
+
+00800d16 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d2b:	89 df                	mov    %ebx,%edi
+  800d2d:	6a 00                	push   $0x0
+  800d2f:	55                   	push   %ebp
+  800d30:	56                   	push   %esi
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	8d 35 3b 0d 80 00    	lea    0x800d3b,%esi
+  800d39:	0f 34                	sysenter
+
+00800d3b <after_sysenter_label_912>:
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d40:	85 c0                	test   %eax,%eax
+  800d42:	7f 07                	jg     800d4b <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d47:	5b                   	pop    %ebx
+  800d48:	5f                   	pop    %edi
+  800d49:	5d                   	pop    %ebp
+  800d4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+  800d4e:	50                   	push   %eax
+  800d4f:	6a 09                	push   $0x9
+  800d51:	68 d5 4a 80 00       	push   $0x804ad5
+  800d56:	6a 54                	push   $0x54
+  800d58:	68 f2 4a 80 00       	push   $0x804af2
+  800d5d:	e8 63 2e 00 00       	call   803bc5 <_panic>
+
+00800d62 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d72:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d77:	89 df                	mov    %ebx,%edi
+  800d79:	6a 00                	push   $0x0
+  800d7b:	55                   	push   %ebp
+  800d7c:	56                   	push   %esi
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	8d 35 87 0d 80 00    	lea    0x800d87,%esi
+  800d85:	0f 34                	sysenter
+
+00800d87 <after_sysenter_label_1016>:
+  800d87:	5e                   	pop    %esi
+  800d88:	5d                   	pop    %ebp
+  800d89:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	7f 07                	jg     800d97 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d97:	83 ec 0c             	sub    $0xc,%esp
+  800d9a:	50                   	push   %eax
+  800d9b:	6a 0a                	push   $0xa
+  800d9d:	68 d5 4a 80 00       	push   $0x804ad5
+  800da2:	6a 54                	push   $0x54
+  800da4:	68 f2 4a 80 00       	push   $0x804af2
+  800da9:	e8 17 2e 00 00       	call   803bc5 <_panic>
+
+00800dae <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800db3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc4:	6a 00                	push   $0x0
+  800dc6:	55                   	push   %ebp
+  800dc7:	56                   	push   %esi
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	8d 35 d2 0d 80 00    	lea    0x800dd2,%esi
+  800dd0:	0f 34                	sysenter
+
+00800dd2 <after_sysenter_label_1126>:
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dd7:	5b                   	pop    %ebx
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+
+00800ddb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ded:	89 cb                	mov    %ecx,%ebx
+  800def:	89 cf                	mov    %ecx,%edi
+  800df1:	6a 00                	push   $0x0
+  800df3:	55                   	push   %ebp
+  800df4:	56                   	push   %esi
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	8d 35 ff 0d 80 00    	lea    0x800dff,%esi
+  800dfd:	0f 34                	sysenter
+
+00800dff <after_sysenter_label_1210>:
+  800dff:	5e                   	pop    %esi
+  800e00:	5d                   	pop    %ebp
+  800e01:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 07                	jg     800e0f <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0f:	83 ec 0c             	sub    $0xc,%esp
+  800e12:	50                   	push   %eax
+  800e13:	6a 0d                	push   $0xd
+  800e15:	68 d5 4a 80 00       	push   $0x804ad5
+  800e1a:	6a 54                	push   $0x54
+  800e1c:	68 f2 4a 80 00       	push   $0x804af2
+  800e21:	e8 9f 2d 00 00       	call   803bc5 <_panic>
+
+00800e26 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e36:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e3b:	89 df                	mov    %ebx,%edi
+  800e3d:	6a 00                	push   $0x0
+  800e3f:	55                   	push   %ebp
+  800e40:	56                   	push   %esi
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	8d 35 4b 0e 80 00    	lea    0x800e4b,%esi
+  800e49:	0f 34                	sysenter
+
+00800e4b <after_sysenter_label_1311>:
+  800e4b:	5e                   	pop    %esi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 07                	jg     800e5b <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  800e5e:	50                   	push   %eax
+  800e5f:	6a 42                	push   $0x42
+  800e61:	68 d5 4a 80 00       	push   $0x804ad5
+  800e66:	6a 54                	push   $0x54
+  800e68:	68 f2 4a 80 00       	push   $0x804af2
+  800e6d:	e8 53 2d 00 00       	call   803bc5 <_panic>
+
+00800e72 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e81:	89 d1                	mov    %edx,%ecx
+  800e83:	89 d3                	mov    %edx,%ebx
+  800e85:	89 d7                	mov    %edx,%edi
+  800e87:	6a 00                	push   $0x0
+  800e89:	55                   	push   %ebp
+  800e8a:	56                   	push   %esi
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	8d 35 95 0e 80 00    	lea    0x800e95,%esi
+  800e93:	0f 34                	sysenter
+
+00800e95 <after_sysenter_label_1411>:
+  800e95:	5e                   	pop    %esi
+  800e96:	5d                   	pop    %ebp
+  800e97:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	6a 00                	push   $0x0
+  800eb7:	55                   	push   %ebp
+  800eb8:	56                   	push   %esi
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	8d 35 c3 0e 80 00    	lea    0x800ec3,%esi
+  800ec1:	0f 34                	sysenter
+
+00800ec3 <after_sysenter_label_1497>:
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5d                   	pop    %ebp
+  800ec5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+
+00800ecc <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ee1:	89 df                	mov    %ebx,%edi
+  800ee3:	6a 00                	push   $0x0
+  800ee5:	55                   	push   %ebp
+  800ee6:	56                   	push   %esi
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	8d 35 f1 0e 80 00    	lea    0x800ef1,%esi
+  800eef:	0f 34                	sysenter
+
+00800ef1 <after_sysenter_label_1583>:
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+
+00800efa <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f05:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f12:	6a 00                	push   $0x0
+  800f14:	55                   	push   %ebp
+  800f15:	56                   	push   %esi
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	8d 35 20 0f 80 00    	lea    0x800f20,%esi
+  800f1e:	0f 34                	sysenter
+
+00800f20 <after_sysenter_label_1672>:
+  800f20:	5e                   	pop    %esi
+  800f21:	5d                   	pop    %ebp
+  800f22:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f25:	5b                   	pop    %ebx
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f39:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f3e:	89 df                	mov    %ebx,%edi
+  800f40:	6a 00                	push   $0x0
+  800f42:	55                   	push   %ebp
+  800f43:	56                   	push   %esi
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	8d 35 4e 0f 80 00    	lea    0x800f4e,%esi
+  800f4c:	0f 34                	sysenter
+
+00800f4e <after_sysenter_label_1758>:
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f53:	5b                   	pop    %ebx
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+
+00800f57 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f64:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f69:	89 cb                	mov    %ecx,%ebx
+  800f6b:	89 cf                	mov    %ecx,%edi
+  800f6d:	6a 00                	push   $0x0
+  800f6f:	55                   	push   %ebp
+  800f70:	56                   	push   %esi
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	8d 35 7b 0f 80 00    	lea    0x800f7b,%esi
+  800f79:	0f 34                	sysenter
+
+00800f7b <after_sysenter_label_1842>:
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5d                   	pop    %ebp
+  800f7d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	7f 07                	jg     800f8b <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800f84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f87:	5b                   	pop    %ebx
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  800f8e:	50                   	push   %eax
+  800f8f:	6a 13                	push   $0x13
+  800f91:	68 d5 4a 80 00       	push   $0x804ad5
+  800f96:	6a 54                	push   $0x54
+  800f98:	68 f2 4a 80 00       	push   $0x804af2
+  800f9d:	e8 23 2c 00 00       	call   803bc5 <_panic>
+
+00800fa2 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fac:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fb1:	89 d1                	mov    %edx,%ecx
+  800fb3:	89 d3                	mov    %edx,%ebx
+  800fb5:	89 d7                	mov    %edx,%edi
+  800fb7:	6a 00                	push   $0x0
+  800fb9:	55                   	push   %ebp
+  800fba:	56                   	push   %esi
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	8d 35 c5 0f 80 00    	lea    0x800fc5,%esi
+  800fc3:	0f 34                	sysenter
+
+00800fc5 <after_sysenter_label_1939>:
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5d                   	pop    %ebp
+  800fc7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd9:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe6:	6a 00                	push   $0x0
+  800fe8:	55                   	push   %ebp
+  800fe9:	56                   	push   %esi
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	8d 35 f4 0f 80 00    	lea    0x800ff4,%esi
+  800ff2:	0f 34                	sysenter
+
+00800ff4 <after_sysenter_label_2028>:
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+
+00800ffd <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	6a 00                	push   $0x0
+  801016:	55                   	push   %ebp
+  801017:	56                   	push   %esi
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	8d 35 22 10 80 00    	lea    0x801022,%esi
+  801020:	0f 34                	sysenter
+
+00801022 <after_sysenter_label_2114>:
+  801022:	5e                   	pop    %esi
+  801023:	5d                   	pop    %ebp
+  801024:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801027:	5b                   	pop    %ebx
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801030:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801040:	89 df                	mov    %ebx,%edi
+  801042:	6a 00                	push   $0x0
+  801044:	55                   	push   %ebp
+  801045:	56                   	push   %esi
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	8d 35 50 10 80 00    	lea    0x801050,%esi
+  80104e:	0f 34                	sysenter
+
+00801050 <after_sysenter_label_2200>:
+  801050:	5e                   	pop    %esi
+  801051:	5d                   	pop    %ebp
+  801052:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801055:	5b                   	pop    %ebx
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+
+00801059 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 18 00 00 00       	mov    $0x18,%eax
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	6a 00                	push   $0x0
+  801072:	55                   	push   %ebp
+  801073:	56                   	push   %esi
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	8d 35 7e 10 80 00    	lea    0x80107e,%esi
+  80107c:	0f 34                	sysenter
+
+0080107e <after_sysenter_label_2286>:
+  80107e:	5e                   	pop    %esi
+  80107f:	5d                   	pop    %ebp
+  801080:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801083:	5b                   	pop    %ebx
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+
+00801087 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80108a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801092:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80109a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010a2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010a7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+
+008010ae <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010b6:	eb 02                	jmp    8010ba <fd_alloc+0xc>
+  8010b8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010ba:	89 c2                	mov    %eax,%edx
+  8010bc:	c1 ea 16             	shr    $0x16,%edx
+  8010bf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010c6:	f6 c2 01             	test   $0x1,%dl
+  8010c9:	74 2b                	je     8010f6 <fd_alloc+0x48>
+  8010cb:	89 c2                	mov    %eax,%edx
+  8010cd:	c1 ea 0c             	shr    $0xc,%edx
+  8010d0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010d7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010dd:	f6 c1 01             	test   $0x1,%cl
+  8010e0:	74 14                	je     8010f6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010e2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010e8:	75 ce                	jne    8010b8 <fd_alloc+0xa>
+  8010ea:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010ef:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010f4:	eb 05                	jmp    8010fb <fd_alloc+0x4d>
+			return 0;
+  8010f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fe:	89 02                	mov    %eax,(%edx)
+}
+  801100:	89 c8                	mov    %ecx,%eax
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80110a:	83 f8 1f             	cmp    $0x1f,%eax
+  80110d:	77 30                	ja     80113f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80110f:	c1 e0 0c             	shl    $0xc,%eax
+  801112:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801117:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80111d:	f6 c2 01             	test   $0x1,%dl
+  801120:	74 24                	je     801146 <fd_lookup+0x42>
+  801122:	89 c2                	mov    %eax,%edx
+  801124:	c1 ea 0c             	shr    $0xc,%edx
+  801127:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80112e:	f6 c2 01             	test   $0x1,%dl
+  801131:	74 1a                	je     80114d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801133:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801136:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+		return -E_INVAL;
+  80113f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801144:	eb f7                	jmp    80113d <fd_lookup+0x39>
+		return -E_INVAL;
+  801146:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80114b:	eb f0                	jmp    80113d <fd_lookup+0x39>
+  80114d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801152:	eb e9                	jmp    80113d <fd_lookup+0x39>
+
+00801154 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	53                   	push   %ebx
+  801158:	83 ec 04             	sub    $0x4,%esp
+  80115b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801163:	eb 03                	jmp    801168 <dev_lookup+0x14>
+  801165:	83 c0 01             	add    $0x1,%eax
+  801168:	8b 1c 85 7c 4b 80 00 	mov    0x804b7c(,%eax,4),%ebx
+  80116f:	85 db                	test   %ebx,%ebx
+  801171:	74 0b                	je     80117e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801173:	39 13                	cmp    %edx,(%ebx)
+  801175:	75 ee                	jne    801165 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	eb 49                	jmp    8011c7 <dev_lookup+0x73>
+  80117e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801180:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801186:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80118b:	77 18                	ja     8011a5 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80118d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801192:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801194:	c1 e8 10             	shr    $0x10,%eax
+  801197:	74 0c                	je     8011a5 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801199:	c1 e0 10             	shl    $0x10,%eax
+  80119c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8011a1:	29 c1                	sub    %eax,%ecx
+  8011a3:	eb 06                	jmp    8011ab <dev_lookup+0x57>
+		return pthread_main_tls;
+  8011a5:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011ab:	8b 01                	mov    (%ecx),%eax
+  8011ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8011b0:	83 ec 04             	sub    $0x4,%esp
+  8011b3:	52                   	push   %edx
+  8011b4:	50                   	push   %eax
+  8011b5:	68 00 4b 80 00       	push   $0x804b00
+  8011ba:	e8 04 f0 ff ff       	call   8001c3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8011cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011cf:	c9                   	leave
+  8011d0:	c3                   	ret
+
+008011d1 <fd_close>:
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+  8011d7:	83 ec 24             	sub    $0x24,%esp
+  8011da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011e3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011e4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ea:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011ed:	50                   	push   %eax
+  8011ee:	e8 11 ff ff ff       	call   801104 <fd_lookup>
+  8011f3:	89 c3                	mov    %eax,%ebx
+  8011f5:	83 c4 10             	add    $0x10,%esp
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 05                	js     801201 <fd_close+0x30>
+	    || fd != fd2)
+  8011fc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011ff:	74 16                	je     801217 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801201:	89 f8                	mov    %edi,%eax
+  801203:	84 c0                	test   %al,%al
+  801205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801217:	83 ec 08             	sub    $0x8,%esp
+  80121a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 36                	push   (%esi)
+  801220:	e8 2f ff ff ff       	call   801154 <dev_lookup>
+  801225:	89 c3                	mov    %eax,%ebx
+  801227:	83 c4 10             	add    $0x10,%esp
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	78 1a                	js     801248 <fd_close+0x77>
+		if (dev->dev_close)
+  80122e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801231:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	74 0b                	je     801248 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+  801240:	56                   	push   %esi
+  801241:	ff d0                	call   *%eax
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801248:	83 ec 08             	sub    $0x8,%esp
+  80124b:	56                   	push   %esi
+  80124c:	6a 00                	push   $0x0
+  80124e:	e8 2b fa ff ff       	call   800c7e <sys_page_unmap>
+	return r;
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	eb b5                	jmp    80120d <fd_close+0x3c>
+
+00801258 <close>:
+
+int
+close(int fdnum)
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80125e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801261:	50                   	push   %eax
+  801262:	ff 75 08             	push   0x8(%ebp)
+  801265:	e8 9a fe ff ff       	call   801104 <fd_lookup>
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	79 02                	jns    801273 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+		return fd_close(fd, 1);
+  801273:	83 ec 08             	sub    $0x8,%esp
+  801276:	6a 01                	push   $0x1
+  801278:	ff 75 f4             	push   -0xc(%ebp)
+  80127b:	e8 51 ff ff ff       	call   8011d1 <fd_close>
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	eb ec                	jmp    801271 <close+0x19>
+
+00801285 <close_all>:
+
+void
+close_all(void)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	53                   	push   %ebx
+  801289:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80128c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	53                   	push   %ebx
+  801295:	e8 be ff ff ff       	call   801258 <close>
+	for (i = 0; i < MAXFD; i++)
+  80129a:	83 c3 01             	add    $0x1,%ebx
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	83 fb 20             	cmp    $0x20,%ebx
+  8012a3:	75 ec                	jne    801291 <close_all+0xc>
+}
+  8012a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+
+008012aa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b6:	50                   	push   %eax
+  8012b7:	ff 75 08             	push   0x8(%ebp)
+  8012ba:	e8 45 fe ff ff       	call   801104 <fd_lookup>
+  8012bf:	89 c3                	mov    %eax,%ebx
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 7f                	js     801347 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	ff 75 0c             	push   0xc(%ebp)
+  8012ce:	e8 85 ff ff ff       	call   801258 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012d6:	c1 e6 0c             	shl    $0xc,%esi
+  8012d9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012e2:	89 3c 24             	mov    %edi,(%esp)
+  8012e5:	e8 ad fd ff ff       	call   801097 <fd2data>
+  8012ea:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012ec:	89 34 24             	mov    %esi,(%esp)
+  8012ef:	e8 a3 fd ff ff       	call   801097 <fd2data>
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012fa:	89 d8                	mov    %ebx,%eax
+  8012fc:	c1 e8 16             	shr    $0x16,%eax
+  8012ff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801306:	a8 01                	test   $0x1,%al
+  801308:	74 11                	je     80131b <dup+0x71>
+  80130a:	89 d8                	mov    %ebx,%eax
+  80130c:	c1 e8 0c             	shr    $0xc,%eax
+  80130f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801316:	f6 c2 01             	test   $0x1,%dl
+  801319:	75 36                	jne    801351 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80131b:	89 f8                	mov    %edi,%eax
+  80131d:	c1 e8 0c             	shr    $0xc,%eax
+  801320:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801327:	83 ec 0c             	sub    $0xc,%esp
+  80132a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80132f:	50                   	push   %eax
+  801330:	56                   	push   %esi
+  801331:	6a 00                	push   $0x0
+  801333:	57                   	push   %edi
+  801334:	6a 00                	push   $0x0
+  801336:	e8 f7 f8 ff ff       	call   800c32 <sys_page_map>
+  80133b:	89 c3                	mov    %eax,%ebx
+  80133d:	83 c4 20             	add    $0x20,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	78 33                	js     801377 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801344:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801347:	89 d8                	mov    %ebx,%eax
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801351:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801360:	50                   	push   %eax
+  801361:	ff 75 d4             	push   -0x2c(%ebp)
+  801364:	6a 00                	push   $0x0
+  801366:	53                   	push   %ebx
+  801367:	6a 00                	push   $0x0
+  801369:	e8 c4 f8 ff ff       	call   800c32 <sys_page_map>
+  80136e:	89 c3                	mov    %eax,%ebx
+  801370:	83 c4 20             	add    $0x20,%esp
+  801373:	85 c0                	test   %eax,%eax
+  801375:	79 a4                	jns    80131b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801377:	83 ec 08             	sub    $0x8,%esp
+  80137a:	56                   	push   %esi
+  80137b:	6a 00                	push   $0x0
+  80137d:	e8 fc f8 ff ff       	call   800c7e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801382:	83 c4 08             	add    $0x8,%esp
+  801385:	ff 75 d4             	push   -0x2c(%ebp)
+  801388:	6a 00                	push   $0x0
+  80138a:	e8 ef f8 ff ff       	call   800c7e <sys_page_unmap>
+	return r;
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	eb b3                	jmp    801347 <dup+0x9d>
+
+00801394 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+  801399:	83 ec 18             	sub    $0x18,%esp
+  80139c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80139f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013a2:	50                   	push   %eax
+  8013a3:	53                   	push   %ebx
+  8013a4:	e8 5b fd ff ff       	call   801104 <fd_lookup>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 3c                	js     8013ec <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013b0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013b3:	83 ec 08             	sub    $0x8,%esp
+  8013b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	ff 36                	push   (%esi)
+  8013bc:	e8 93 fd ff ff       	call   801154 <dev_lookup>
+  8013c1:	83 c4 10             	add    $0x10,%esp
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	78 24                	js     8013ec <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013c8:	8b 46 08             	mov    0x8(%esi),%eax
+  8013cb:	83 e0 03             	and    $0x3,%eax
+  8013ce:	83 f8 01             	cmp    $0x1,%eax
+  8013d1:	74 20                	je     8013f3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d6:	8b 40 08             	mov    0x8(%eax),%eax
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	74 61                	je     80143e <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013dd:	83 ec 04             	sub    $0x4,%esp
+  8013e0:	ff 75 10             	push   0x10(%ebp)
+  8013e3:	ff 75 0c             	push   0xc(%ebp)
+  8013e6:	56                   	push   %esi
+  8013e7:	ff d0                	call   *%eax
+  8013e9:	83 c4 10             	add    $0x10,%esp
+}
+  8013ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+  8013f3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013f5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8013fb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801400:	77 18                	ja     80141a <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801402:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801407:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801409:	c1 e8 10             	shr    $0x10,%eax
+  80140c:	74 0c                	je     80141a <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80140e:	c1 e0 10             	shl    $0x10,%eax
+  801411:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801416:	29 c2                	sub    %eax,%edx
+  801418:	eb 06                	jmp    801420 <read+0x8c>
+		return pthread_main_tls;
+  80141a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801420:	8b 02                	mov    (%edx),%eax
+  801422:	8b 40 48             	mov    0x48(%eax),%eax
+  801425:	83 ec 04             	sub    $0x4,%esp
+  801428:	53                   	push   %ebx
+  801429:	50                   	push   %eax
+  80142a:	68 41 4b 80 00       	push   $0x804b41
+  80142f:	e8 8f ed ff ff       	call   8001c3 <cprintf>
+		return -E_INVAL;
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143c:	eb ae                	jmp    8013ec <read+0x58>
+		return -E_NOT_SUPP;
+  80143e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801443:	eb a7                	jmp    8013ec <read+0x58>
+
+00801445 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801451:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	eb 02                	jmp    80145d <readn+0x18>
+  80145b:	01 c3                	add    %eax,%ebx
+  80145d:	39 f3                	cmp    %esi,%ebx
+  80145f:	73 21                	jae    801482 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801461:	83 ec 04             	sub    $0x4,%esp
+  801464:	89 f0                	mov    %esi,%eax
+  801466:	29 d8                	sub    %ebx,%eax
+  801468:	50                   	push   %eax
+  801469:	89 d8                	mov    %ebx,%eax
+  80146b:	03 45 0c             	add    0xc(%ebp),%eax
+  80146e:	50                   	push   %eax
+  80146f:	57                   	push   %edi
+  801470:	e8 1f ff ff ff       	call   801394 <read>
+		if (m < 0)
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	78 04                	js     801480 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80147c:	75 dd                	jne    80145b <readn+0x16>
+  80147e:	eb 02                	jmp    801482 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801480:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801482:	89 d8                	mov    %ebx,%eax
+  801484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+
+0080148c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	56                   	push   %esi
+  801490:	53                   	push   %ebx
+  801491:	83 ec 18             	sub    $0x18,%esp
+  801494:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801497:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80149a:	50                   	push   %eax
+  80149b:	53                   	push   %ebx
+  80149c:	e8 63 fc ff ff       	call   801104 <fd_lookup>
+  8014a1:	83 c4 10             	add    $0x10,%esp
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	78 37                	js     8014df <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014ab:	83 ec 08             	sub    $0x8,%esp
+  8014ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	ff 36                	push   (%esi)
+  8014b4:	e8 9b fc ff ff       	call   801154 <dev_lookup>
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	78 1f                	js     8014df <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014c0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014c4:	74 20                	je     8014e6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	74 61                	je     801531 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014d0:	83 ec 04             	sub    $0x4,%esp
+  8014d3:	ff 75 10             	push   0x10(%ebp)
+  8014d6:	ff 75 0c             	push   0xc(%ebp)
+  8014d9:	56                   	push   %esi
+  8014da:	ff d0                	call   *%eax
+  8014dc:	83 c4 10             	add    $0x10,%esp
+}
+  8014df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5d                   	pop    %ebp
+  8014e5:	c3                   	ret
+  8014e6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014e8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014f3:	77 18                	ja     80150d <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014f5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014fa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014fc:	c1 e8 10             	shr    $0x10,%eax
+  8014ff:	74 0c                	je     80150d <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801501:	c1 e0 10             	shl    $0x10,%eax
+  801504:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801509:	29 c2                	sub    %eax,%edx
+  80150b:	eb 06                	jmp    801513 <write+0x87>
+		return pthread_main_tls;
+  80150d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801513:	8b 02                	mov    (%edx),%eax
+  801515:	8b 40 48             	mov    0x48(%eax),%eax
+  801518:	83 ec 04             	sub    $0x4,%esp
+  80151b:	53                   	push   %ebx
+  80151c:	50                   	push   %eax
+  80151d:	68 5d 4b 80 00       	push   $0x804b5d
+  801522:	e8 9c ec ff ff       	call   8001c3 <cprintf>
+		return -E_INVAL;
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152f:	eb ae                	jmp    8014df <write+0x53>
+		return -E_NOT_SUPP;
+  801531:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801536:	eb a7                	jmp    8014df <write+0x53>
+
+00801538 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801541:	50                   	push   %eax
+  801542:	ff 75 08             	push   0x8(%ebp)
+  801545:	e8 ba fb ff ff       	call   801104 <fd_lookup>
+  80154a:	83 c4 10             	add    $0x10,%esp
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	78 0e                	js     80155f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801551:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801554:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801557:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80155a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+
+00801561 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	56                   	push   %esi
+  801565:	53                   	push   %ebx
+  801566:	83 ec 18             	sub    $0x18,%esp
+  801569:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80156c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156f:	50                   	push   %eax
+  801570:	53                   	push   %ebx
+  801571:	e8 8e fb ff ff       	call   801104 <fd_lookup>
+  801576:	83 c4 10             	add    $0x10,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 34                	js     8015b1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80157d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801580:	83 ec 08             	sub    $0x8,%esp
+  801583:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801586:	50                   	push   %eax
+  801587:	ff 36                	push   (%esi)
+  801589:	e8 c6 fb ff ff       	call   801154 <dev_lookup>
+  80158e:	83 c4 10             	add    $0x10,%esp
+  801591:	85 c0                	test   %eax,%eax
+  801593:	78 1c                	js     8015b1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801595:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801599:	74 1d                	je     8015b8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80159b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159e:	8b 40 18             	mov    0x18(%eax),%eax
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	74 5e                	je     801603 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015a5:	83 ec 08             	sub    $0x8,%esp
+  8015a8:	ff 75 0c             	push   0xc(%ebp)
+  8015ab:	56                   	push   %esi
+  8015ac:	ff d0                	call   *%eax
+  8015ae:	83 c4 10             	add    $0x10,%esp
+}
+  8015b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b4:	5b                   	pop    %ebx
+  8015b5:	5e                   	pop    %esi
+  8015b6:	5d                   	pop    %ebp
+  8015b7:	c3                   	ret
+  8015b8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015ba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015c0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015c5:	77 18                	ja     8015df <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015c7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015cc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015ce:	c1 e8 10             	shr    $0x10,%eax
+  8015d1:	74 0c                	je     8015df <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015d3:	c1 e0 10             	shl    $0x10,%eax
+  8015d6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015db:	29 c2                	sub    %eax,%edx
+  8015dd:	eb 06                	jmp    8015e5 <ftruncate+0x84>
+		return pthread_main_tls;
+  8015df:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  8015e5:	8b 02                	mov    (%edx),%eax
+  8015e7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015ea:	83 ec 04             	sub    $0x4,%esp
+  8015ed:	53                   	push   %ebx
+  8015ee:	50                   	push   %eax
+  8015ef:	68 20 4b 80 00       	push   $0x804b20
+  8015f4:	e8 ca eb ff ff       	call   8001c3 <cprintf>
+		return -E_INVAL;
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801601:	eb ae                	jmp    8015b1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801603:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801608:	eb a7                	jmp    8015b1 <ftruncate+0x50>
+
+0080160a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	83 ec 18             	sub    $0x18,%esp
+  801612:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801615:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801618:	50                   	push   %eax
+  801619:	ff 75 08             	push   0x8(%ebp)
+  80161c:	e8 e3 fa ff ff       	call   801104 <fd_lookup>
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	85 c0                	test   %eax,%eax
+  801626:	78 49                	js     801671 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801628:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80162b:	83 ec 08             	sub    $0x8,%esp
+  80162e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801631:	50                   	push   %eax
+  801632:	ff 36                	push   (%esi)
+  801634:	e8 1b fb ff ff       	call   801154 <dev_lookup>
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	78 31                	js     801671 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801640:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801643:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801647:	74 2f                	je     801678 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801649:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80164c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801653:	00 00 00 
+	stat->st_isdir = 0;
+  801656:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80165d:	00 00 00 
+	stat->st_dev = dev;
+  801660:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801666:	83 ec 08             	sub    $0x8,%esp
+  801669:	53                   	push   %ebx
+  80166a:	56                   	push   %esi
+  80166b:	ff 50 14             	call   *0x14(%eax)
+  80166e:	83 c4 10             	add    $0x10,%esp
+}
+  801671:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+		return -E_NOT_SUPP;
+  801678:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80167d:	eb f2                	jmp    801671 <fstat+0x67>
+
+0080167f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	56                   	push   %esi
+  801683:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801684:	83 ec 08             	sub    $0x8,%esp
+  801687:	6a 00                	push   $0x0
+  801689:	ff 75 08             	push   0x8(%ebp)
+  80168c:	e8 4b 03 00 00       	call   8019dc <open>
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	78 1b                	js     8016b5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80169a:	83 ec 08             	sub    $0x8,%esp
+  80169d:	ff 75 0c             	push   0xc(%ebp)
+  8016a0:	50                   	push   %eax
+  8016a1:	e8 64 ff ff ff       	call   80160a <fstat>
+  8016a6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016a8:	89 1c 24             	mov    %ebx,(%esp)
+  8016ab:	e8 a8 fb ff ff       	call   801258 <close>
+	return r;
+  8016b0:	83 c4 10             	add    $0x10,%esp
+  8016b3:	89 f3                	mov    %esi,%ebx
+}
+  8016b5:	89 d8                	mov    %ebx,%eax
+  8016b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ba:	5b                   	pop    %ebx
+  8016bb:	5e                   	pop    %esi
+  8016bc:	5d                   	pop    %ebp
+  8016bd:	c3                   	ret
+
+008016be <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	56                   	push   %esi
+  8016c2:	53                   	push   %ebx
+  8016c3:	89 c6                	mov    %eax,%esi
+  8016c5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8016c7:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8016ce:	74 27                	je     8016f7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016d0:	6a 07                	push   $0x7
+  8016d2:	68 00 70 80 00       	push   $0x807000
+  8016d7:	56                   	push   %esi
+  8016d8:	ff 35 00 60 80 00    	push   0x806000
+  8016de:	e8 94 2c 00 00       	call   804377 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016e3:	83 c4 0c             	add    $0xc,%esp
+  8016e6:	6a 00                	push   $0x0
+  8016e8:	53                   	push   %ebx
+  8016e9:	6a 00                	push   $0x0
+  8016eb:	e8 91 2b 00 00       	call   804281 <ipc_recv>
+}
+  8016f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f3:	5b                   	pop    %ebx
+  8016f4:	5e                   	pop    %esi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+  8016fa:	6a 01                	push   $0x1
+  8016fc:	e8 cc 2c 00 00       	call   8043cd <ipc_find_env>
+  801701:	a3 00 60 80 00       	mov    %eax,0x806000
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	eb c5                	jmp    8016d0 <fsipc+0x12>
+
+0080170b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	53                   	push   %ebx
+  80170f:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801712:	68 04 60 80 00       	push   $0x806004
+  801717:	e8 29 1b 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80171c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801722:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801727:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80172a:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80172f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801734:	b8 02 00 00 00       	mov    $0x2,%eax
+  801739:	e8 80 ff ff ff       	call   8016be <fsipc>
+  80173e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801740:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801747:	e8 66 1b 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+}
+  80174c:	89 d8                	mov    %ebx,%eax
+  80174e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801751:	c9                   	leave
+  801752:	c3                   	ret
+
+00801753 <devfile_flush>:
+{
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	53                   	push   %ebx
+  801757:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80175a:	68 04 60 80 00       	push   $0x806004
+  80175f:	e8 e1 1a 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801764:	8b 45 08             	mov    0x8(%ebp),%eax
+  801767:	8b 40 0c             	mov    0xc(%eax),%eax
+  80176a:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80176f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801774:	b8 06 00 00 00       	mov    $0x6,%eax
+  801779:	e8 40 ff ff ff       	call   8016be <fsipc>
+  80177e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801780:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801787:	e8 26 1b 00 00       	call   8032b2 <mutex_unlock>
+}
+  80178c:	89 d8                	mov    %ebx,%eax
+  80178e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801791:	c9                   	leave
+  801792:	c3                   	ret
+
+00801793 <devfile_stat>:
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80179b:	83 ec 0c             	sub    $0xc,%esp
+  80179e:	68 04 60 80 00       	push   $0x806004
+  8017a3:	e8 9d 1a 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8017a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ae:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8017b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017bd:	e8 fc fe ff ff       	call   8016be <fsipc>
+  8017c2:	89 c3                	mov    %eax,%ebx
+  8017c4:	83 c4 10             	add    $0x10,%esp
+  8017c7:	85 c0                	test   %eax,%eax
+  8017c9:	79 16                	jns    8017e1 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8017cb:	83 ec 0c             	sub    $0xc,%esp
+  8017ce:	68 04 60 80 00       	push   $0x806004
+  8017d3:	e8 da 1a 00 00       	call   8032b2 <mutex_unlock>
+}
+  8017d8:	89 d8                	mov    %ebx,%eax
+  8017da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017e1:	83 ec 08             	sub    $0x8,%esp
+  8017e4:	68 00 70 80 00       	push   $0x807000
+  8017e9:	56                   	push   %esi
+  8017ea:	e8 b8 ef ff ff       	call   8007a7 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8017ef:	a1 80 70 80 00       	mov    0x807080,%eax
+  8017f4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017fa:	a1 84 70 80 00       	mov    0x807084,%eax
+  8017ff:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801805:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801808:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180d:	eb bc                	jmp    8017cb <devfile_stat+0x38>
+
+0080180f <devfile_write>:
+{
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+  801812:	53                   	push   %ebx
+  801813:	83 ec 10             	sub    $0x10,%esp
+  801816:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801819:	68 04 60 80 00       	push   $0x806004
+  80181e:	e8 22 1a 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801823:	8b 45 08             	mov    0x8(%ebp),%eax
+  801826:	8b 40 0c             	mov    0xc(%eax),%eax
+  801829:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801837:	76 3d                	jbe    801876 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801839:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80183e:	39 c3                	cmp    %eax,%ebx
+  801840:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801843:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801846:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  80184b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801851:	ba 00 00 00 00       	mov    $0x0,%edx
+  801856:	b8 04 00 00 00       	mov    $0x4,%eax
+  80185b:	e8 5e fe ff ff       	call   8016be <fsipc>
+  801860:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	68 04 60 80 00       	push   $0x806004
+  80186a:	e8 43 1a 00 00       	call   8032b2 <mutex_unlock>
+}
+  80186f:	89 d8                	mov    %ebx,%eax
+  801871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801874:	c9                   	leave
+  801875:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801876:	83 ec 04             	sub    $0x4,%esp
+  801879:	53                   	push   %ebx
+  80187a:	ff 75 0c             	push   0xc(%ebp)
+  80187d:	68 0c 70 80 00       	push   $0x80700c
+  801882:	e8 a6 f0 ff ff       	call   80092d <memmove>
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188f:	eb b5                	jmp    801846 <devfile_write+0x37>
+
+00801891 <devfile_read>:
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	57                   	push   %edi
+  801895:	56                   	push   %esi
+  801896:	53                   	push   %ebx
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80189d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8018a3:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8018a9:	0f 86 8c 00 00 00    	jbe    80193b <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8018af:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018b4:	39 c3                	cmp    %eax,%ebx
+  8018b6:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8018b9:	89 f8                	mov    %edi,%eax
+  8018bb:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8018be:	eb 0f                	jmp    8018cf <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8018c0:	0f b6 08             	movzbl (%eax),%ecx
+  8018c3:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8018c5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018ca:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8018cf:	39 d0                	cmp    %edx,%eax
+  8018d1:	72 ed                	jb     8018c0 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8018d3:	83 ec 0c             	sub    $0xc,%esp
+  8018d6:	68 04 60 80 00       	push   $0x806004
+  8018db:	e8 65 19 00 00       	call   803245 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018e0:	8b 46 0c             	mov    0xc(%esi),%eax
+  8018e3:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8018e8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8018ee:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8018f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018fe:	e8 bb fd ff ff       	call   8016be <fsipc>
+  801903:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801905:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80190c:	e8 a1 19 00 00       	call   8032b2 <mutex_unlock>
+		assert(r <= (int) n);
+  801911:	83 c4 10             	add    $0x10,%esp
+  801914:	39 f3                	cmp    %esi,%ebx
+  801916:	7c 0a                	jl     801922 <devfile_read+0x91>
+}
+  801918:	89 f0                	mov    %esi,%eax
+  80191a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191d:	5b                   	pop    %ebx
+  80191e:	5e                   	pop    %esi
+  80191f:	5f                   	pop    %edi
+  801920:	5d                   	pop    %ebp
+  801921:	c3                   	ret
+		assert(r <= (int) n);
+  801922:	68 90 4b 80 00       	push   $0x804b90
+  801927:	68 9d 4b 80 00       	push   $0x804b9d
+  80192c:	68 90 00 00 00       	push   $0x90
+  801931:	68 b2 4b 80 00       	push   $0x804bb2
+  801936:	e8 8a 22 00 00       	call   803bc5 <_panic>
+	mutex_lock(&fsipc_mu);
+  80193b:	83 ec 0c             	sub    $0xc,%esp
+  80193e:	68 04 60 80 00       	push   $0x806004
+  801943:	e8 fd 18 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801948:	8b 46 0c             	mov    0xc(%esi),%eax
+  80194b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801950:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801956:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80195d:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801960:	ba 00 00 00 00       	mov    $0x0,%edx
+  801965:	b8 03 00 00 00       	mov    $0x3,%eax
+  80196a:	e8 4f fd ff ff       	call   8016be <fsipc>
+  80196f:	89 c6                	mov    %eax,%esi
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	85 c0                	test   %eax,%eax
+  801976:	78 1d                	js     801995 <devfile_read+0x104>
+		assert(r <= n);
+  801978:	39 c3                	cmp    %eax,%ebx
+  80197a:	72 2e                	jb     8019aa <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80197c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801981:	7f 40                	jg     8019c3 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801983:	83 ec 04             	sub    $0x4,%esp
+  801986:	50                   	push   %eax
+  801987:	68 00 70 80 00       	push   $0x807000
+  80198c:	57                   	push   %edi
+  80198d:	e8 9b ef ff ff       	call   80092d <memmove>
+  801992:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	68 04 60 80 00       	push   $0x806004
+  80199d:	e8 10 19 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+  8019a2:	83 c4 10             	add    $0x10,%esp
+  8019a5:	e9 6e ff ff ff       	jmp    801918 <devfile_read+0x87>
+		assert(r <= n);
+  8019aa:	68 bd 4b 80 00       	push   $0x804bbd
+  8019af:	68 9d 4b 80 00       	push   $0x804b9d
+  8019b4:	68 99 00 00 00       	push   $0x99
+  8019b9:	68 b2 4b 80 00       	push   $0x804bb2
+  8019be:	e8 02 22 00 00       	call   803bc5 <_panic>
+		assert(r <= PGSIZE);
+  8019c3:	68 c4 4b 80 00       	push   $0x804bc4
+  8019c8:	68 9d 4b 80 00       	push   $0x804b9d
+  8019cd:	68 9a 00 00 00       	push   $0x9a
+  8019d2:	68 b2 4b 80 00       	push   $0x804bb2
+  8019d7:	e8 e9 21 00 00       	call   803bc5 <_panic>
+
+008019dc <open>:
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	56                   	push   %esi
+  8019e0:	53                   	push   %ebx
+  8019e1:	83 ec 1c             	sub    $0x1c,%esp
+  8019e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019e7:	56                   	push   %esi
+  8019e8:	e8 7f ed ff ff       	call   80076c <strlen>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019f5:	0f 8f 85 00 00 00    	jg     801a80 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019fb:	83 ec 0c             	sub    $0xc,%esp
+  8019fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a01:	50                   	push   %eax
+  801a02:	e8 a7 f6 ff ff       	call   8010ae <fd_alloc>
+  801a07:	89 c3                	mov    %eax,%ebx
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 55                	js     801a65 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801a10:	83 ec 0c             	sub    $0xc,%esp
+  801a13:	68 04 60 80 00       	push   $0x806004
+  801a18:	e8 28 18 00 00       	call   803245 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a1d:	83 c4 08             	add    $0x8,%esp
+  801a20:	56                   	push   %esi
+  801a21:	68 00 70 80 00       	push   $0x807000
+  801a26:	e8 7c ed ff ff       	call   8007a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a2e:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801a33:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a36:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a3b:	e8 7e fc ff ff       	call   8016be <fsipc>
+  801a40:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a42:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801a49:	e8 64 18 00 00       	call   8032b2 <mutex_unlock>
+	if (r < 0) {
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	85 db                	test   %ebx,%ebx
+  801a53:	78 19                	js     801a6e <open+0x92>
+	return fd2num(fd);
+  801a55:	83 ec 0c             	sub    $0xc,%esp
+  801a58:	ff 75 f4             	push   -0xc(%ebp)
+  801a5b:	e8 27 f6 ff ff       	call   801087 <fd2num>
+  801a60:	89 c3                	mov    %eax,%ebx
+  801a62:	83 c4 10             	add    $0x10,%esp
+}
+  801a65:	89 d8                	mov    %ebx,%eax
+  801a67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6a:	5b                   	pop    %ebx
+  801a6b:	5e                   	pop    %esi
+  801a6c:	5d                   	pop    %ebp
+  801a6d:	c3                   	ret
+		fd_close(fd, 0);
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	6a 00                	push   $0x0
+  801a73:	ff 75 f4             	push   -0xc(%ebp)
+  801a76:	e8 56 f7 ff ff       	call   8011d1 <fd_close>
+		return r;
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	eb e5                	jmp    801a65 <open+0x89>
+		return -E_BAD_PATH;
+  801a80:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a85:	eb de                	jmp    801a65 <open+0x89>
+
+00801a87 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	53                   	push   %ebx
+  801a8b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	ff 75 08             	push   0x8(%ebp)
+  801a95:	e8 6a f6 ff ff       	call   801104 <fd_lookup>
+  801a9a:	89 c3                	mov    %eax,%ebx
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	78 5b                	js     801afe <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801aa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa6:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801aac:	39 08                	cmp    %ecx,(%eax)
+  801aae:	75 55                	jne    801b05 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801ab0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801ab4:	74 56                	je     801b0c <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	68 04 60 80 00       	push   $0x806004
+  801abe:	e8 82 17 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad1:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801ad6:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ad9:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ae8:	e8 d1 fb ff ff       	call   8016be <fsipc>
+  801aed:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801aef:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801af6:	e8 b7 17 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+  801afb:	83 c4 10             	add    $0x10,%esp
+}
+  801afe:	89 d8                	mov    %ebx,%eax
+  801b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b05:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801b0a:	eb f2                	jmp    801afe <fallocate+0x77>
+		return -E_INVAL;
+  801b0c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801b11:	eb eb                	jmp    801afe <fallocate+0x77>
+
+00801b13 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801b13:	55                   	push   %ebp
+  801b14:	89 e5                	mov    %esp,%ebp
+  801b16:	56                   	push   %esi
+  801b17:	53                   	push   %ebx
+  801b18:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b1b:	89 f3                	mov    %esi,%ebx
+  801b1d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b23:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b26:	eb 06                	jmp    801b2e <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b28:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b2e:	39 f3                	cmp    %esi,%ebx
+  801b30:	73 14                	jae    801b46 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801b32:	83 ec 08             	sub    $0x8,%esp
+  801b35:	53                   	push   %ebx
+  801b36:	6a 00                	push   $0x0
+  801b38:	e8 41 f1 ff ff       	call   800c7e <sys_page_unmap>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	79 e4                	jns    801b28 <munmap+0x15>
+  801b44:	eb 05                	jmp    801b4b <munmap+0x38>
+			return r;
+	return 0;
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b4e:	5b                   	pop    %ebx
+  801b4f:	5e                   	pop    %esi
+  801b50:	5d                   	pop    %ebp
+  801b51:	c3                   	ret
+
+00801b52 <mmap>:
+{
+  801b52:	55                   	push   %ebp
+  801b53:	89 e5                	mov    %esp,%ebp
+  801b55:	57                   	push   %edi
+  801b56:	56                   	push   %esi
+  801b57:	53                   	push   %ebx
+  801b58:	83 ec 24             	sub    $0x24,%esp
+  801b5b:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b5e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b61:	50                   	push   %eax
+  801b62:	ff 75 08             	push   0x8(%ebp)
+  801b65:	e8 9a f5 ff ff       	call   801104 <fd_lookup>
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	0f 88 37 01 00 00    	js     801cac <mmap+0x15a>
+		return NULL;
+  801b75:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801b7a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b7d:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b83:	39 0a                	cmp    %ecx,(%edx)
+  801b85:	0f 85 05 01 00 00    	jne    801c90 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801b8b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801b92:	0f 85 1b 01 00 00    	jne    801cb3 <mmap+0x161>
+  801b98:	89 f0                	mov    %esi,%eax
+  801b9a:	83 e8 01             	sub    $0x1,%eax
+  801b9d:	0f 88 17 01 00 00    	js     801cba <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801ba3:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801ba7:	75 28                	jne    801bd1 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801ba9:	83 ec 0c             	sub    $0xc,%esp
+  801bac:	68 04 60 80 00       	push   $0x806004
+  801bb1:	e8 8f 16 00 00       	call   803245 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801bb6:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801bbc:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801bca:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801bcf:	eb 2b                	jmp    801bfc <mmap+0xaa>
+		cow_enable();
+  801bd1:	e8 3a 22 00 00       	call   803e10 <cow_enable>
+  801bd6:	eb d1                	jmp    801ba9 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801bd8:	89 c2                	mov    %eax,%edx
+  801bda:	c1 ea 0c             	shr    $0xc,%edx
+  801bdd:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801be4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bea:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801bf0:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801bf3:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801bf5:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801bfa:	77 25                	ja     801c21 <mmap+0xcf>
+  801bfc:	89 c2                	mov    %eax,%edx
+  801bfe:	29 da                	sub    %ebx,%edx
+  801c00:	39 ca                	cmp    %ecx,%edx
+  801c02:	73 3a                	jae    801c3e <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c04:	89 c2                	mov    %eax,%edx
+  801c06:	c1 ea 16             	shr    $0x16,%edx
+  801c09:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c10:	f6 c2 01             	test   $0x1,%dl
+  801c13:	75 c3                	jne    801bd8 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801c15:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801c1a:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801c1f:	eb d4                	jmp    801bf5 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801c21:	29 d8                	sub    %ebx,%eax
+  801c23:	39 c8                	cmp    %ecx,%eax
+  801c25:	73 17                	jae    801c3e <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	68 04 60 80 00       	push   $0x806004
+  801c2f:	e8 7e 16 00 00       	call   8032b2 <mutex_unlock>
+		return NULL;
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3c:	eb 52                	jmp    801c90 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c3e:	85 db                	test   %ebx,%ebx
+  801c40:	74 e5                	je     801c27 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801c42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c45:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c48:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c50:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801c55:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801c5b:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801c61:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c64:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c73:	e8 46 fa ff ff       	call   8016be <fsipc>
+  801c78:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801c7a:	83 ec 0c             	sub    $0xc,%esp
+  801c7d:	68 04 60 80 00       	push   $0x806004
+  801c82:	e8 2b 16 00 00       	call   8032b2 <mutex_unlock>
+	if (r < 0) {
+  801c87:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801c8a:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801c8c:	85 ff                	test   %edi,%edi
+  801c8e:	78 08                	js     801c98 <mmap+0x146>
+}
+  801c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c93:	5b                   	pop    %ebx
+  801c94:	5e                   	pop    %esi
+  801c95:	5f                   	pop    %edi
+  801c96:	5d                   	pop    %ebp
+  801c97:	c3                   	ret
+		munmap((void*) va, len);
+  801c98:	83 ec 08             	sub    $0x8,%esp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	e8 71 fe ff ff       	call   801b13 <munmap>
+		return NULL;
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	eb e4                	jmp    801c90 <mmap+0x13e>
+		return NULL;
+  801cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb1:	eb dd                	jmp    801c90 <mmap+0x13e>
+		return NULL;
+  801cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb8:	eb d6                	jmp    801c90 <mmap+0x13e>
+  801cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbf:	eb cf                	jmp    801c90 <mmap+0x13e>
+
+00801cc1 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	53                   	push   %ebx
+  801cc5:	83 ec 10             	sub    $0x10,%esp
+  801cc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801ccb:	53                   	push   %ebx
+  801ccc:	e8 9b ea ff ff       	call   80076c <strlen>
+  801cd1:	83 c4 10             	add    $0x10,%esp
+  801cd4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cd9:	7f 42                	jg     801d1d <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801cdb:	83 ec 0c             	sub    $0xc,%esp
+  801cde:	68 04 60 80 00       	push   $0x806004
+  801ce3:	e8 5d 15 00 00       	call   803245 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ce8:	83 c4 08             	add    $0x8,%esp
+  801ceb:	53                   	push   %ebx
+  801cec:	68 00 70 80 00       	push   $0x807000
+  801cf1:	e8 b1 ea ff ff       	call   8007a7 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d00:	e8 b9 f9 ff ff       	call   8016be <fsipc>
+  801d05:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d07:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d0e:	e8 9f 15 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+  801d13:	83 c4 10             	add    $0x10,%esp
+}
+  801d16:	89 d8                	mov    %ebx,%eax
+  801d18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d1b:	c9                   	leave
+  801d1c:	c3                   	ret
+		return -E_BAD_PATH;
+  801d1d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d22:	eb f2                	jmp    801d16 <remove+0x55>
+
+00801d24 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	53                   	push   %ebx
+  801d28:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d2b:	68 04 60 80 00       	push   $0x806004
+  801d30:	e8 10 15 00 00       	call   803245 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d3f:	e8 7a f9 ff ff       	call   8016be <fsipc>
+  801d44:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d46:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d4d:	e8 60 15 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+}
+  801d52:	89 d8                	mov    %ebx,%eax
+  801d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+00801d59 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801d59:	55                   	push   %ebp
+  801d5a:	89 e5                	mov    %esp,%ebp
+  801d5c:	56                   	push   %esi
+  801d5d:	53                   	push   %ebx
+  801d5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d61:	83 ec 0c             	sub    $0xc,%esp
+  801d64:	68 04 60 80 00       	push   $0x806004
+  801d69:	e8 d7 14 00 00       	call   803245 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d71:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d80:	e8 39 f9 ff ff       	call   8016be <fsipc>
+  801d85:	89 c6                	mov    %eax,%esi
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	85 db                	test   %ebx,%ebx
+  801d8c:	74 7b                	je     801e09 <fs_bcstat+0xb0>
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	78 77                	js     801e09 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801d92:	a1 00 70 80 00       	mov    0x807000,%eax
+  801d97:	89 03                	mov    %eax,(%ebx)
+  801d99:	a1 04 70 80 00       	mov    0x807004,%eax
+  801d9e:	89 43 04             	mov    %eax,0x4(%ebx)
+  801da1:	a1 08 70 80 00       	mov    0x807008,%eax
+  801da6:	89 43 08             	mov    %eax,0x8(%ebx)
+  801da9:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801dae:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801db1:	a1 10 70 80 00       	mov    0x807010,%eax
+  801db6:	89 43 10             	mov    %eax,0x10(%ebx)
+  801db9:	a1 14 70 80 00       	mov    0x807014,%eax
+  801dbe:	89 43 14             	mov    %eax,0x14(%ebx)
+  801dc1:	a1 18 70 80 00       	mov    0x807018,%eax
+  801dc6:	89 43 18             	mov    %eax,0x18(%ebx)
+  801dc9:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801dce:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801dd1:	a1 20 70 80 00       	mov    0x807020,%eax
+  801dd6:	89 43 20             	mov    %eax,0x20(%ebx)
+  801dd9:	a1 24 70 80 00       	mov    0x807024,%eax
+  801dde:	89 43 24             	mov    %eax,0x24(%ebx)
+  801de1:	a1 28 70 80 00       	mov    0x807028,%eax
+  801de6:	89 43 28             	mov    %eax,0x28(%ebx)
+  801de9:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801dee:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801df1:	a1 30 70 80 00       	mov    0x807030,%eax
+  801df6:	89 43 30             	mov    %eax,0x30(%ebx)
+  801df9:	a1 34 70 80 00       	mov    0x807034,%eax
+  801dfe:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e01:	a1 38 70 80 00       	mov    0x807038,%eax
+  801e06:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801e09:	83 ec 0c             	sub    $0xc,%esp
+  801e0c:	68 04 60 80 00       	push   $0x806004
+  801e11:	e8 9c 14 00 00       	call   8032b2 <mutex_unlock>
+	return r;
+}
+  801e16:	89 f0                	mov    %esi,%eax
+  801e18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1b:	5b                   	pop    %ebx
+  801e1c:	5e                   	pop    %esi
+  801e1d:	5d                   	pop    %ebp
+  801e1e:	c3                   	ret
+
+00801e1f <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	56                   	push   %esi
+  801e23:	53                   	push   %ebx
+  801e24:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801e26:	0f b6 10             	movzbl (%eax),%edx
+  801e29:	80 fa 72             	cmp    $0x72,%dl
+  801e2c:	74 44                	je     801e72 <parse_mode+0x53>
+  801e2e:	80 fa 77             	cmp    $0x77,%dl
+  801e31:	74 4b                	je     801e7e <parse_mode+0x5f>
+  801e33:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e38:	80 fa 61             	cmp    $0x61,%dl
+  801e3b:	74 09                	je     801e46 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801e3d:	89 d8                	mov    %ebx,%eax
+  801e3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e42:	5b                   	pop    %ebx
+  801e43:	5e                   	pop    %esi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+	switch (mode[0]) {
+  801e46:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801e4b:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801e50:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801e52:	83 ec 08             	sub    $0x8,%esp
+  801e55:	6a 2b                	push   $0x2b
+  801e57:	50                   	push   %eax
+  801e58:	e8 5c ea ff ff       	call   8008b9 <strchr>
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	74 d9                	je     801e3d <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801e64:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801e67:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801e6a:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801e70:	eb cb                	jmp    801e3d <parse_mode+0x1e>
+	switch (mode[0]) {
+  801e72:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e7c:	eb d2                	jmp    801e50 <parse_mode+0x31>
+  801e7e:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801e83:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801e88:	eb c6                	jmp    801e50 <parse_mode+0x31>
+
+00801e8a <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	57                   	push   %edi
+  801e8e:	56                   	push   %esi
+  801e8f:	53                   	push   %ebx
+  801e90:	83 ec 1c             	sub    $0x1c,%esp
+  801e93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e96:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801e99:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801ea3:	83 c0 24             	add    $0x24,%eax
+  801ea6:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801eaa:	74 17                	je     801ec3 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801eac:	83 c3 01             	add    $0x1,%ebx
+  801eaf:	83 fb 10             	cmp    $0x10,%ebx
+  801eb2:	75 ef                	jne    801ea3 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801eb4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801eb9:	89 f0                	mov    %esi,%eax
+  801ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ebe:	5b                   	pop    %ebx
+  801ebf:	5e                   	pop    %esi
+  801ec0:	5f                   	pop    %edi
+  801ec1:	5d                   	pop    %ebp
+  801ec2:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801ec3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801eca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801ecd:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801ed0:	c1 e7 02             	shl    $0x2,%edi
+  801ed3:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801ed9:	83 ec 04             	sub    $0x4,%esp
+  801edc:	6a 24                	push   $0x24
+  801ede:	6a 00                	push   $0x0
+  801ee0:	56                   	push   %esi
+  801ee1:	e8 12 ea ff ff       	call   8008f8 <memset>
+			streams[i].f_fd = fd;
+  801ee6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ee9:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801eef:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801ef2:	01 d8                	add    %ebx,%eax
+  801ef4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ef7:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	eb b6                	jmp    801eb9 <stream_alloc+0x2f>
+
+00801f03 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	53                   	push   %ebx
+  801f07:	83 ec 14             	sub    $0x14,%esp
+  801f0a:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801f0c:	8b 40 18             	mov    0x18(%eax),%eax
+  801f0f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801f12:	74 4a                	je     801f5e <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f14:	83 ec 08             	sub    $0x8,%esp
+  801f17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1a:	50                   	push   %eax
+  801f1b:	ff 33                	push   (%ebx)
+  801f1d:	e8 e2 f1 ff ff       	call   801104 <fd_lookup>
+  801f22:	89 c2                	mov    %eax,%edx
+  801f24:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f2c:	85 d2                	test   %edx,%edx
+  801f2e:	78 41                	js     801f71 <stream_unread+0x6e>
+  801f30:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f33:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801f39:	39 0a                	cmp    %ecx,(%edx)
+  801f3b:	75 34                	jne    801f71 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801f3d:	8b 43 14             	mov    0x14(%ebx),%eax
+  801f40:	03 42 04             	add    0x4(%edx),%eax
+  801f43:	2b 43 18             	sub    0x18(%ebx),%eax
+  801f46:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801f49:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f50:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801f57:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f5c:	eb 13                	jmp    801f71 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801f5e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801f65:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801f6c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+00801f76 <stream_drain>:
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	56                   	push   %esi
+  801f7a:	53                   	push   %ebx
+  801f7b:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f82:	eb 02                	jmp    801f86 <stream_drain+0x10>
+  801f84:	01 c3                	add    %eax,%ebx
+  801f86:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801f89:	39 c3                	cmp    %eax,%ebx
+  801f8b:	73 43                	jae    801fd0 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801f8d:	83 ec 04             	sub    $0x4,%esp
+  801f90:	29 d8                	sub    %ebx,%eax
+  801f92:	50                   	push   %eax
+  801f93:	89 d8                	mov    %ebx,%eax
+  801f95:	03 46 0c             	add    0xc(%esi),%eax
+  801f98:	50                   	push   %eax
+  801f99:	ff 36                	push   (%esi)
+  801f9b:	e8 ec f4 ff ff       	call   80148c <write>
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	85 c0                	test   %eax,%eax
+  801fa5:	7f dd                	jg     801f84 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801fa7:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801fab:	8b 56 0c             	mov    0xc(%esi),%edx
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fb4:	29 d8                	sub    %ebx,%eax
+  801fb6:	50                   	push   %eax
+  801fb7:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  801fba:	50                   	push   %eax
+  801fbb:	52                   	push   %edx
+  801fbc:	e8 6c e9 ff ff       	call   80092d <memmove>
+			f->f_wend -= done;
+  801fc1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fc4:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801fce:	eb 0a                	jmp    801fda <stream_drain+0x64>
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  801fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  801fda:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  801fdd:	89 d0                	mov    %edx,%eax
+  801fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe2:	5b                   	pop    %ebx
+  801fe3:	5e                   	pop    %esi
+  801fe4:	5d                   	pop    %ebp
+  801fe5:	c3                   	ret
+
+00801fe6 <stream_setup>:
+	if (f->f_buf)
+  801fe6:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801fea:	74 01                	je     801fed <stream_setup+0x7>
+  801fec:	c3                   	ret
+{
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	53                   	push   %ebx
+  801ff1:	83 ec 04             	sub    $0x4,%esp
+  801ff4:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  801ff6:	8b 40 08             	mov    0x8(%eax),%eax
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	74 17                	je     802014 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  801ffd:	83 f8 03             	cmp    $0x3,%eax
+  802000:	75 2d                	jne    80202f <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802002:	8d 43 20             	lea    0x20(%ebx),%eax
+  802005:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802008:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80200f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802014:	83 ec 0c             	sub    $0xc,%esp
+  802017:	ff 33                	push   (%ebx)
+  802019:	e8 29 1b 00 00       	call   803b47 <iscons>
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	85 c0                	test   %eax,%eax
+  802023:	0f 9f c0             	setg   %al
+  802026:	0f b6 c0             	movzbl %al,%eax
+  802029:	83 c0 01             	add    $0x1,%eax
+  80202c:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80202f:	83 ec 0c             	sub    $0xc,%esp
+  802032:	68 00 10 00 00       	push   $0x1000
+  802037:	e8 6e 0b 00 00       	call   802baa <malloc>
+  80203c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	85 c0                	test   %eax,%eax
+  802044:	74 bc                	je     802002 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802046:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80204d:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802051:	eb bc                	jmp    80200f <stream_setup+0x29>
+
+00802053 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802053:	55                   	push   %ebp
+  802054:	89 e5                	mov    %esp,%ebp
+  802056:	53                   	push   %ebx
+  802057:	83 ec 04             	sub    $0x4,%esp
+  80205a:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80205c:	e8 85 ff ff ff       	call   801fe6 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802061:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802066:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80206a:	74 3d                	je     8020a9 <stream_fill+0x56>
+  80206c:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802070:	74 10                	je     802082 <stream_fill+0x2f>
+  802072:	89 d8                	mov    %ebx,%eax
+  802074:	e8 fd fe ff ff       	call   801f76 <stream_drain>
+		return 0;
+  802079:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 27                	js     8020a9 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802082:	83 ec 04             	sub    $0x4,%esp
+  802085:	ff 73 10             	push   0x10(%ebx)
+  802088:	ff 73 0c             	push   0xc(%ebx)
+  80208b:	ff 33                	push   (%ebx)
+  80208d:	e8 02 f3 ff ff       	call   801394 <read>
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	7e 17                	jle    8020b0 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802099:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80209d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8020a4:	89 c2                	mov    %eax,%edx
+  8020a6:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8020a9:	89 d0                	mov    %edx,%eax
+  8020ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ae:	c9                   	leave
+  8020af:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8020b0:	c1 f8 1f             	sar    $0x1f,%eax
+  8020b3:	83 e0 04             	and    $0x4,%eax
+  8020b6:	83 c0 04             	add    $0x4,%eax
+  8020b9:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8020bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c1:	eb e6                	jmp    8020a9 <stream_fill+0x56>
+
+008020c3 <fopen>:
+{
+  8020c3:	55                   	push   %ebp
+  8020c4:	89 e5                	mov    %esp,%ebp
+  8020c6:	57                   	push   %edi
+  8020c7:	56                   	push   %esi
+  8020c8:	53                   	push   %ebx
+  8020c9:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8020cf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020d2:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8020d8:	89 f0                	mov    %esi,%eax
+  8020da:	e8 40 fd ff ff       	call   801e1f <parse_mode>
+		return 0;
+  8020df:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 2d                	js     802115 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8020e8:	83 ec 08             	sub    $0x8,%esp
+  8020eb:	50                   	push   %eax
+  8020ec:	ff 75 08             	push   0x8(%ebp)
+  8020ef:	e8 e8 f8 ff ff       	call   8019dc <open>
+  8020f4:	89 c7                	mov    %eax,%edi
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 58                	js     802155 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8020fd:	80 3e 61             	cmpb   $0x61,(%esi)
+  802100:	74 1d                	je     80211f <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802102:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802108:	89 f8                	mov    %edi,%eax
+  80210a:	e8 7b fd ff ff       	call   801e8a <stream_alloc>
+  80210f:	89 c3                	mov    %eax,%ebx
+  802111:	85 c0                	test   %eax,%eax
+  802113:	74 32                	je     802147 <fopen+0x84>
+}
+  802115:	89 d8                	mov    %ebx,%eax
+  802117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5f                   	pop    %edi
+  80211d:	5d                   	pop    %ebp
+  80211e:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80211f:	83 ec 08             	sub    $0x8,%esp
+  802122:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802128:	50                   	push   %eax
+  802129:	57                   	push   %edi
+  80212a:	e8 db f4 ff ff       	call   80160a <fstat>
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	85 c0                	test   %eax,%eax
+  802134:	78 cc                	js     802102 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802136:	83 ec 08             	sub    $0x8,%esp
+  802139:	ff 75 dc             	push   -0x24(%ebp)
+  80213c:	57                   	push   %edi
+  80213d:	e8 f6 f3 ff ff       	call   801538 <seek>
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	eb bb                	jmp    802102 <fopen+0x3f>
+		close(fd);
+  802147:	83 ec 0c             	sub    $0xc,%esp
+  80214a:	57                   	push   %edi
+  80214b:	e8 08 f1 ff ff       	call   801258 <close>
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	eb c0                	jmp    802115 <fopen+0x52>
+		return 0;
+  802155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80215a:	eb b9                	jmp    802115 <fopen+0x52>
+
+0080215c <fdopen>:
+{
+  80215c:	55                   	push   %ebp
+  80215d:	89 e5                	mov    %esp,%ebp
+  80215f:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802162:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802165:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802168:	e8 b2 fc ff ff       	call   801e1f <parse_mode>
+  80216d:	89 c2                	mov    %eax,%edx
+		return 0;
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802174:	85 d2                	test   %edx,%edx
+  802176:	78 0b                	js     802183 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802178:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80217b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217e:	e8 07 fd ff ff       	call   801e8a <stream_alloc>
+}
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+
+00802185 <setvbuf>:
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	57                   	push   %edi
+  802189:	56                   	push   %esi
+  80218a:	53                   	push   %ebx
+  80218b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802191:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802194:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802198:	75 3a                	jne    8021d4 <setvbuf+0x4f>
+  80219a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80219d:	83 fe 02             	cmp    $0x2,%esi
+  8021a0:	77 39                	ja     8021db <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8021a2:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8021a5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8021a9:	0f 95 c3             	setne  %bl
+  8021ac:	85 ff                	test   %edi,%edi
+  8021ae:	0f 95 c1             	setne  %cl
+  8021b1:	84 cb                	test   %cl,%bl
+  8021b3:	74 05                	je     8021ba <setvbuf+0x35>
+  8021b5:	83 fa 03             	cmp    $0x3,%edx
+  8021b8:	75 0a                	jne    8021c4 <setvbuf+0x3f>
+	return 0;
+  8021ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021bf:	5b                   	pop    %ebx
+  8021c0:	5e                   	pop    %esi
+  8021c1:	5f                   	pop    %edi
+  8021c2:	5d                   	pop    %ebp
+  8021c3:	c3                   	ret
+		f->f_buf = buf;
+  8021c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c7:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8021ca:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d2:	eb eb                	jmp    8021bf <setvbuf+0x3a>
+		return EOF;
+  8021d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021d9:	eb e4                	jmp    8021bf <setvbuf+0x3a>
+  8021db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8021e0:	eb dd                	jmp    8021bf <setvbuf+0x3a>
+
+008021e2 <fflush>:
+{
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	57                   	push   %edi
+  8021e6:	56                   	push   %esi
+  8021e7:	53                   	push   %ebx
+  8021e8:	83 ec 0c             	sub    $0xc,%esp
+  8021eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8021ee:	85 db                	test   %ebx,%ebx
+  8021f0:	74 1a                	je     80220c <fflush+0x2a>
+	stream_unread(f);
+  8021f2:	89 d8                	mov    %ebx,%eax
+  8021f4:	e8 0a fd ff ff       	call   801f03 <stream_unread>
+	return stream_drain(f);
+  8021f9:	89 d8                	mov    %ebx,%eax
+  8021fb:	e8 76 fd ff ff       	call   801f76 <stream_drain>
+  802200:	89 c7                	mov    %eax,%edi
+}
+  802202:	89 f8                	mov    %edi,%eax
+  802204:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802207:	5b                   	pop    %ebx
+  802208:	5e                   	pop    %esi
+  802209:	5f                   	pop    %edi
+  80220a:	5d                   	pop    %ebp
+  80220b:	c3                   	ret
+  80220c:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  802211:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80221b:	eb 03                	jmp    802220 <fflush+0x3e>
+  80221d:	83 c3 24             	add    $0x24,%ebx
+  802220:	39 f3                	cmp    %esi,%ebx
+  802222:	74 de                	je     802202 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802224:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802228:	74 f3                	je     80221d <fflush+0x3b>
+  80222a:	83 ec 0c             	sub    $0xc,%esp
+  80222d:	53                   	push   %ebx
+  80222e:	e8 af ff ff ff       	call   8021e2 <fflush>
+  802233:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802236:	85 c0                	test   %eax,%eax
+  802238:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80223d:	0f 48 f8             	cmovs  %eax,%edi
+  802240:	eb db                	jmp    80221d <fflush+0x3b>
+
+00802242 <fclose>:
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	56                   	push   %esi
+  802246:	53                   	push   %ebx
+  802247:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80224a:	83 ec 0c             	sub    $0xc,%esp
+  80224d:	56                   	push   %esi
+  80224e:	e8 8f ff ff ff       	call   8021e2 <fflush>
+  802253:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802255:	83 c4 04             	add    $0x4,%esp
+  802258:	ff 36                	push   (%esi)
+  80225a:	e8 f9 ef ff ff       	call   801258 <close>
+  80225f:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802262:	85 c0                	test   %eax,%eax
+  802264:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802269:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80226c:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802270:	75 10                	jne    802282 <fclose+0x40>
+	f->f_flags = 0;
+  802272:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802279:	89 d8                	mov    %ebx,%eax
+  80227b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227e:	5b                   	pop    %ebx
+  80227f:	5e                   	pop    %esi
+  802280:	5d                   	pop    %ebp
+  802281:	c3                   	ret
+		free(f->f_buf);
+  802282:	83 ec 0c             	sub    $0xc,%esp
+  802285:	ff 76 0c             	push   0xc(%esi)
+  802288:	e8 54 08 00 00       	call   802ae1 <free>
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	eb e0                	jmp    802272 <fclose+0x30>
+
+00802292 <fileno>:
+{
+  802292:	55                   	push   %ebp
+  802293:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802295:	8b 45 08             	mov    0x8(%ebp),%eax
+  802298:	8b 00                	mov    (%eax),%eax
+}
+  80229a:	5d                   	pop    %ebp
+  80229b:	c3                   	ret
+
+0080229c <feof>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80229f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a2:	8b 40 04             	mov    0x4(%eax),%eax
+  8022a5:	c1 e8 02             	shr    $0x2,%eax
+  8022a8:	83 e0 01             	and    $0x1,%eax
+}
+  8022ab:	5d                   	pop    %ebp
+  8022ac:	c3                   	ret
+
+008022ad <ferror>:
+{
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8022b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b3:	8b 40 04             	mov    0x4(%eax),%eax
+  8022b6:	c1 e8 03             	shr    $0x3,%eax
+  8022b9:	83 e0 01             	and    $0x1,%eax
+}
+  8022bc:	5d                   	pop    %ebp
+  8022bd:	c3                   	ret
+
+008022be <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	53                   	push   %ebx
+  8022c2:	83 ec 04             	sub    $0x4,%esp
+  8022c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022c8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8022cb:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8022ce:	74 15                	je     8022e5 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8022d0:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8022d3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8022d6:	8d 48 01             	lea    0x1(%eax),%ecx
+  8022d9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8022dc:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8022e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8022e5:	89 d8                	mov    %ebx,%eax
+  8022e7:	e8 67 fd ff ff       	call   802053 <stream_fill>
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	75 e0                	jne    8022d0 <fgetc+0x12>
+		return EOF;
+  8022f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022f5:	eb e9                	jmp    8022e0 <fgetc+0x22>
+
+008022f7 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	57                   	push   %edi
+  8022fb:	56                   	push   %esi
+  8022fc:	53                   	push   %ebx
+  8022fd:	83 ec 1c             	sub    $0x1c,%esp
+  802300:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802303:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802308:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230b:	83 e8 01             	sub    $0x1,%eax
+  80230e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802311:	eb 66                	jmp    802379 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802313:	8b 46 14             	mov    0x14(%esi),%eax
+  802316:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802319:	29 c3                	sub    %eax,%ebx
+  80231b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80231e:	29 fa                	sub    %edi,%edx
+  802320:	39 d3                	cmp    %edx,%ebx
+  802322:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	53                   	push   %ebx
+  802329:	6a 0a                	push   $0xa
+  80232b:	03 46 0c             	add    0xc(%esi),%eax
+  80232e:	50                   	push   %eax
+  80232f:	e8 aa e6 ff ff       	call   8009de <memfind>
+  802334:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802337:	8b 46 0c             	mov    0xc(%esi),%eax
+  80233a:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80233d:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802340:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802348:	74 0b                	je     802355 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80234a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80234d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802350:	29 d3                	sub    %edx,%ebx
+  802352:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802355:	83 ec 04             	sub    $0x4,%esp
+  802358:	53                   	push   %ebx
+  802359:	01 c8                	add    %ecx,%eax
+  80235b:	50                   	push   %eax
+  80235c:	89 f8                	mov    %edi,%eax
+  80235e:	03 45 08             	add    0x8(%ebp),%eax
+  802361:	50                   	push   %eax
+  802362:	e8 c6 e5 ff ff       	call   80092d <memmove>
+		f->f_rpos += m;
+  802367:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80236a:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802372:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802377:	74 1f                	je     802398 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802379:	8d 47 01             	lea    0x1(%edi),%eax
+  80237c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80237f:	73 17                	jae    802398 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802381:	8b 46 18             	mov    0x18(%esi),%eax
+  802384:	39 46 14             	cmp    %eax,0x14(%esi)
+  802387:	75 8a                	jne    802313 <fgets+0x1c>
+  802389:	89 f0                	mov    %esi,%eax
+  80238b:	e8 c3 fc ff ff       	call   802053 <stream_fill>
+  802390:	85 c0                	test   %eax,%eax
+  802392:	0f 85 7b ff ff ff    	jne    802313 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802398:	85 ff                	test   %edi,%edi
+  80239a:	74 0f                	je     8023ab <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80239c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8023a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a6:	5b                   	pop    %ebx
+  8023a7:	5e                   	pop    %esi
+  8023a8:	5f                   	pop    %edi
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+		return 0;
+  8023ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b0:	eb f1                	jmp    8023a3 <fgets+0xac>
+
+008023b2 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8023b2:	55                   	push   %ebp
+  8023b3:	89 e5                	mov    %esp,%ebp
+  8023b5:	57                   	push   %edi
+  8023b6:	56                   	push   %esi
+  8023b7:	53                   	push   %ebx
+  8023b8:	83 ec 1c             	sub    $0x1c,%esp
+  8023bb:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8023be:	89 f0                	mov    %esi,%eax
+  8023c0:	e8 21 fc ff ff       	call   801fe6 <stream_setup>
+	want = size * n;
+  8023c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023c8:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8023cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8023cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d4:	eb 43                	jmp    802419 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8023d6:	29 d3                	sub    %edx,%ebx
+  8023d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023db:	29 f8                	sub    %edi,%eax
+  8023dd:	39 c3                	cmp    %eax,%ebx
+  8023df:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8023e2:	83 ec 04             	sub    $0x4,%esp
+  8023e5:	53                   	push   %ebx
+  8023e6:	03 56 0c             	add    0xc(%esi),%edx
+  8023e9:	52                   	push   %edx
+  8023ea:	89 f8                	mov    %edi,%eax
+  8023ec:	03 45 08             	add    0x8(%ebp),%eax
+  8023ef:	50                   	push   %eax
+  8023f0:	e8 38 e5 ff ff       	call   80092d <memmove>
+			f->f_rpos += m;
+  8023f5:	01 5e 14             	add    %ebx,0x14(%esi)
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	eb 1a                	jmp    802417 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8023fd:	83 ec 04             	sub    $0x4,%esp
+  802400:	53                   	push   %ebx
+  802401:	89 f8                	mov    %edi,%eax
+  802403:	03 45 08             	add    0x8(%ebp),%eax
+  802406:	50                   	push   %eax
+  802407:	ff 36                	push   (%esi)
+  802409:	e8 86 ef ff ff       	call   801394 <read>
+  80240e:	89 c3                	mov    %eax,%ebx
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	85 c0                	test   %eax,%eax
+  802415:	7e 36                	jle    80244d <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802417:	01 df                	add    %ebx,%edi
+  802419:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80241c:	39 c7                	cmp    %eax,%edi
+  80241e:	73 39                	jae    802459 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802420:	8b 56 14             	mov    0x14(%esi),%edx
+  802423:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802426:	39 da                	cmp    %ebx,%edx
+  802428:	72 ac                	jb     8023d6 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80242a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80242d:	29 fb                	sub    %edi,%ebx
+  80242f:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802432:	72 3e                	jb     802472 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802434:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802438:	74 1f                	je     802459 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80243a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80243e:	74 bd                	je     8023fd <fread+0x4b>
+  802440:	89 f0                	mov    %esi,%eax
+  802442:	e8 2f fb ff ff       	call   801f76 <stream_drain>
+  802447:	85 c0                	test   %eax,%eax
+  802449:	79 b2                	jns    8023fd <fread+0x4b>
+  80244b:	eb 0c                	jmp    802459 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80244d:	c1 fb 1f             	sar    $0x1f,%ebx
+  802450:	83 e3 04             	and    $0x4,%ebx
+  802453:	83 c3 04             	add    $0x4,%ebx
+  802456:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802459:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	74 0a                	je     80246a <fread+0xb8>
+  802460:	89 f8                	mov    %edi,%eax
+  802462:	ba 00 00 00 00       	mov    $0x0,%edx
+  802467:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80246a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246d:	5b                   	pop    %ebx
+  80246e:	5e                   	pop    %esi
+  80246f:	5f                   	pop    %edi
+  802470:	5d                   	pop    %ebp
+  802471:	c3                   	ret
+		} else if (!stream_fill(f))
+  802472:	89 f0                	mov    %esi,%eax
+  802474:	e8 da fb ff ff       	call   802053 <stream_fill>
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	74 dc                	je     802459 <fread+0xa7>
+			m = 0;
+  80247d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802482:	eb 93                	jmp    802417 <fread+0x65>
+
+00802484 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	57                   	push   %edi
+  802488:	56                   	push   %esi
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 1c             	sub    $0x1c,%esp
+  80248d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802490:	8b 43 04             	mov    0x4(%ebx),%eax
+  802493:	a8 02                	test   $0x2,%al
+  802495:	75 13                	jne    8024aa <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802497:	83 c8 08             	or     $0x8,%eax
+  80249a:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  80249d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8024a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a5:	5b                   	pop    %ebx
+  8024a6:	5e                   	pop    %esi
+  8024a7:	5f                   	pop    %edi
+  8024a8:	5d                   	pop    %ebp
+  8024a9:	c3                   	ret
+	stream_setup(f);
+  8024aa:	89 d8                	mov    %ebx,%eax
+  8024ac:	e8 35 fb ff ff       	call   801fe6 <stream_setup>
+	want = size * n;
+  8024b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b4:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8024b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8024bb:	89 d8                	mov    %ebx,%eax
+  8024bd:	e8 41 fa ff ff       	call   801f03 <stream_unread>
+	for (done = 0; done < want; ) {
+  8024c2:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8024c7:	84 c0                	test   %al,%al
+  8024c9:	75 7b                	jne    802546 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8024cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8024d3:	39 fe                	cmp    %edi,%esi
+  8024d5:	73 24                	jae    8024fb <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8024d7:	83 ec 04             	sub    $0x4,%esp
+  8024da:	89 f8                	mov    %edi,%eax
+  8024dc:	29 f0                	sub    %esi,%eax
+  8024de:	50                   	push   %eax
+  8024df:	89 f0                	mov    %esi,%eax
+  8024e1:	03 45 08             	add    0x8(%ebp),%eax
+  8024e4:	50                   	push   %eax
+  8024e5:	ff 33                	push   (%ebx)
+  8024e7:	e8 a0 ef ff ff       	call   80148c <write>
+  8024ec:	83 c4 10             	add    $0x10,%esp
+  8024ef:	85 c0                	test   %eax,%eax
+  8024f1:	7e 04                	jle    8024f7 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8024f3:	01 c6                	add    %eax,%esi
+  8024f5:	eb dc                	jmp    8024d3 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8024f7:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8024fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	74 a0                	je     8024a2 <fwrite+0x1e>
+  802502:	89 f0                	mov    %esi,%eax
+  802504:	ba 00 00 00 00       	mov    $0x0,%edx
+  802509:	f7 75 0c             	divl   0xc(%ebp)
+  80250c:	eb 94                	jmp    8024a2 <fwrite+0x1e>
+			done += r;
+  80250e:	01 c7                	add    %eax,%edi
+			continue;
+  802510:	eb 34                	jmp    802546 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802512:	8b 73 10             	mov    0x10(%ebx),%esi
+  802515:	29 c6                	sub    %eax,%esi
+  802517:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80251a:	29 fa                	sub    %edi,%edx
+  80251c:	39 d6                	cmp    %edx,%esi
+  80251e:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	56                   	push   %esi
+  802525:	89 fa                	mov    %edi,%edx
+  802527:	03 55 08             	add    0x8(%ebp),%edx
+  80252a:	52                   	push   %edx
+  80252b:	03 43 0c             	add    0xc(%ebx),%eax
+  80252e:	50                   	push   %eax
+  80252f:	e8 f9 e3 ff ff       	call   80092d <memmove>
+		f->f_wend += m;
+  802534:	89 f0                	mov    %esi,%eax
+  802536:	03 43 1c             	add    0x1c(%ebx),%eax
+  802539:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  80253c:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802544:	74 5b                	je     8025a1 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802546:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802549:	39 c7                	cmp    %eax,%edi
+  80254b:	73 2d                	jae    80257a <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  80254d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802550:	85 c0                	test   %eax,%eax
+  802552:	75 be                	jne    802512 <fwrite+0x8e>
+  802554:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802557:	29 fa                	sub    %edi,%edx
+  802559:	3b 53 10             	cmp    0x10(%ebx),%edx
+  80255c:	72 b4                	jb     802512 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80255e:	83 ec 04             	sub    $0x4,%esp
+  802561:	52                   	push   %edx
+  802562:	89 f8                	mov    %edi,%eax
+  802564:	03 45 08             	add    0x8(%ebp),%eax
+  802567:	50                   	push   %eax
+  802568:	ff 33                	push   (%ebx)
+  80256a:	e8 1d ef ff ff       	call   80148c <write>
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	85 c0                	test   %eax,%eax
+  802574:	7f 98                	jg     80250e <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802576:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80257a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80257d:	83 f8 03             	cmp    $0x3,%eax
+  802580:	74 48                	je     8025ca <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802582:	83 f8 02             	cmp    $0x2,%eax
+  802585:	74 27                	je     8025ae <fwrite+0x12a>
+	return size ? done / size : 0;
+  802587:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	0f 84 10 ff ff ff    	je     8024a2 <fwrite+0x1e>
+  802592:	89 f8                	mov    %edi,%eax
+  802594:	ba 00 00 00 00       	mov    $0x0,%edx
+  802599:	f7 75 0c             	divl   0xc(%ebp)
+  80259c:	e9 01 ff ff ff       	jmp    8024a2 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025a1:	89 d8                	mov    %ebx,%eax
+  8025a3:	e8 ce f9 ff ff       	call   801f76 <stream_drain>
+  8025a8:	85 c0                	test   %eax,%eax
+  8025aa:	79 9a                	jns    802546 <fwrite+0xc2>
+  8025ac:	eb cc                	jmp    80257a <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8025ae:	83 ec 04             	sub    $0x4,%esp
+  8025b1:	57                   	push   %edi
+  8025b2:	6a 0a                	push   $0xa
+  8025b4:	ff 75 08             	push   0x8(%ebp)
+  8025b7:	e8 22 e4 ff ff       	call   8009de <memfind>
+  8025bc:	89 c2                	mov    %eax,%edx
+  8025be:	89 f8                	mov    %edi,%eax
+  8025c0:	03 45 08             	add    0x8(%ebp),%eax
+  8025c3:	83 c4 10             	add    $0x10,%esp
+  8025c6:	39 c2                	cmp    %eax,%edx
+  8025c8:	74 bd                	je     802587 <fwrite+0x103>
+		stream_drain(f);
+  8025ca:	89 d8                	mov    %ebx,%eax
+  8025cc:	e8 a5 f9 ff ff       	call   801f76 <stream_drain>
+  8025d1:	eb b4                	jmp    802587 <fwrite+0x103>
+
+008025d3 <fputc>:
+{
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	53                   	push   %ebx
+  8025d7:	83 ec 14             	sub    $0x14,%esp
+  8025da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8025dd:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8025e0:	ff 75 0c             	push   0xc(%ebp)
+  8025e3:	6a 01                	push   $0x1
+  8025e5:	6a 01                	push   $0x1
+  8025e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	e8 94 fe ff ff       	call   802484 <fwrite>
+  8025f0:	83 c4 10             	add    $0x10,%esp
+  8025f3:	0f b6 db             	movzbl %bl,%ebx
+  8025f6:	83 f8 01             	cmp    $0x1,%eax
+  8025f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025fe:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802604:	c9                   	leave
+  802605:	c3                   	ret
+
+00802606 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802606:	55                   	push   %ebp
+  802607:	89 e5                	mov    %esp,%ebp
+  802609:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80260c:	ff 75 0c             	push   0xc(%ebp)
+  80260f:	ff 75 08             	push   0x8(%ebp)
+  802612:	e8 bc ff ff ff       	call   8025d3 <fputc>
+}
+  802617:	83 c4 10             	add    $0x10,%esp
+  80261a:	c9                   	leave
+  80261b:	c3                   	ret
+
+0080261c <fputs>:
+{
+  80261c:	55                   	push   %ebp
+  80261d:	89 e5                	mov    %esp,%ebp
+  80261f:	56                   	push   %esi
+  802620:	53                   	push   %ebx
+  802621:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802624:	83 ec 0c             	sub    $0xc,%esp
+  802627:	56                   	push   %esi
+  802628:	e8 3f e1 ff ff       	call   80076c <strlen>
+  80262d:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80262f:	ff 75 0c             	push   0xc(%ebp)
+  802632:	50                   	push   %eax
+  802633:	6a 01                	push   $0x1
+  802635:	56                   	push   %esi
+  802636:	e8 49 fe ff ff       	call   802484 <fwrite>
+  80263b:	83 c4 20             	add    $0x20,%esp
+  80263e:	39 d8                	cmp    %ebx,%eax
+  802640:	0f 95 c0             	setne  %al
+  802643:	0f b6 c0             	movzbl %al,%eax
+  802646:	f7 d8                	neg    %eax
+}
+  802648:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80264b:	5b                   	pop    %ebx
+  80264c:	5e                   	pop    %esi
+  80264d:	5d                   	pop    %ebp
+  80264e:	c3                   	ret
+
+0080264f <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	53                   	push   %ebx
+  802653:	83 ec 04             	sub    $0x4,%esp
+  802656:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802659:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  80265c:	50                   	push   %eax
+  80265d:	ff 75 0c             	push   0xc(%ebp)
+  802660:	53                   	push   %ebx
+  802661:	68 06 26 80 00       	push   $0x802606
+  802666:	e8 4f dc ff ff       	call   8002ba <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80266b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80266e:	c1 e0 1c             	shl    $0x1c,%eax
+  802671:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802674:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802677:	c9                   	leave
+  802678:	c3                   	ret
+
+00802679 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802679:	55                   	push   %ebp
+  80267a:	89 e5                	mov    %esp,%ebp
+  80267c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80267f:	68 d8 4b 80 00       	push   $0x804bd8
+  802684:	ff 75 0c             	push   0xc(%ebp)
+  802687:	e8 1b e1 ff ff       	call   8007a7 <strcpy>
+	return 0;
+}
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+00802693 <devsock_close>:
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	53                   	push   %ebx
+  802697:	83 ec 10             	sub    $0x10,%esp
+  80269a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80269d:	53                   	push   %ebx
+  80269e:	e8 69 1d 00 00       	call   80440c <pageref>
+  8026a3:	89 c2                	mov    %eax,%edx
+  8026a5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026ad:	83 fa 01             	cmp    $0x1,%edx
+  8026b0:	74 05                	je     8026b7 <devsock_close+0x24>
+}
+  8026b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b5:	c9                   	leave
+  8026b6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026b7:	83 ec 0c             	sub    $0xc,%esp
+  8026ba:	ff 73 0c             	push   0xc(%ebx)
+  8026bd:	e8 b7 02 00 00       	call   802979 <nsipc_close>
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	eb eb                	jmp    8026b2 <devsock_close+0x1f>
+
+008026c7 <devsock_write>:
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	ff 75 10             	push   0x10(%ebp)
+  8026d2:	ff 75 0c             	push   0xc(%ebp)
+  8026d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d8:	ff 70 0c             	push   0xc(%eax)
+  8026db:	e8 79 03 00 00       	call   802a59 <nsipc_send>
+}
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+
+008026e2 <devsock_read>:
+{
+  8026e2:	55                   	push   %ebp
+  8026e3:	89 e5                	mov    %esp,%ebp
+  8026e5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8026e8:	6a 00                	push   $0x0
+  8026ea:	ff 75 10             	push   0x10(%ebp)
+  8026ed:	ff 75 0c             	push   0xc(%ebp)
+  8026f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f3:	ff 70 0c             	push   0xc(%eax)
+  8026f6:	e8 ef 02 00 00       	call   8029ea <nsipc_recv>
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+008026fd <fd2sockid>:
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802703:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802706:	52                   	push   %edx
+  802707:	50                   	push   %eax
+  802708:	e8 f7 e9 ff ff       	call   801104 <fd_lookup>
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	85 c0                	test   %eax,%eax
+  802712:	78 10                	js     802724 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802717:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  80271d:	39 08                	cmp    %ecx,(%eax)
+  80271f:	75 05                	jne    802726 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802721:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802724:	c9                   	leave
+  802725:	c3                   	ret
+		return -E_NOT_SUPP;
+  802726:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80272b:	eb f7                	jmp    802724 <fd2sockid+0x27>
+
+0080272d <alloc_sockfd>:
+{
+  80272d:	55                   	push   %ebp
+  80272e:	89 e5                	mov    %esp,%ebp
+  802730:	56                   	push   %esi
+  802731:	53                   	push   %ebx
+  802732:	83 ec 1c             	sub    $0x1c,%esp
+  802735:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802737:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80273a:	50                   	push   %eax
+  80273b:	e8 6e e9 ff ff       	call   8010ae <fd_alloc>
+  802740:	89 c3                	mov    %eax,%ebx
+  802742:	83 c4 10             	add    $0x10,%esp
+  802745:	85 c0                	test   %eax,%eax
+  802747:	78 43                	js     80278c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802749:	83 ec 04             	sub    $0x4,%esp
+  80274c:	68 07 04 00 00       	push   $0x407
+  802751:	ff 75 f4             	push   -0xc(%ebp)
+  802754:	6a 00                	push   $0x0
+  802756:	e8 8a e4 ff ff       	call   800be5 <sys_page_alloc>
+  80275b:	89 c3                	mov    %eax,%ebx
+  80275d:	83 c4 10             	add    $0x10,%esp
+  802760:	85 c0                	test   %eax,%eax
+  802762:	78 28                	js     80278c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802764:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802767:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  80276d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80276f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802772:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802779:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80277c:	83 ec 0c             	sub    $0xc,%esp
+  80277f:	50                   	push   %eax
+  802780:	e8 02 e9 ff ff       	call   801087 <fd2num>
+  802785:	89 c3                	mov    %eax,%ebx
+  802787:	83 c4 10             	add    $0x10,%esp
+  80278a:	eb 0c                	jmp    802798 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80278c:	83 ec 0c             	sub    $0xc,%esp
+  80278f:	56                   	push   %esi
+  802790:	e8 e4 01 00 00       	call   802979 <nsipc_close>
+		return r;
+  802795:	83 c4 10             	add    $0x10,%esp
+}
+  802798:	89 d8                	mov    %ebx,%eax
+  80279a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5d                   	pop    %ebp
+  8027a0:	c3                   	ret
+
+008027a1 <accept>:
+{
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027aa:	e8 4e ff ff ff       	call   8026fd <fd2sockid>
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	78 1b                	js     8027ce <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8027b3:	83 ec 04             	sub    $0x4,%esp
+  8027b6:	ff 75 10             	push   0x10(%ebp)
+  8027b9:	ff 75 0c             	push   0xc(%ebp)
+  8027bc:	50                   	push   %eax
+  8027bd:	e8 0e 01 00 00       	call   8028d0 <nsipc_accept>
+  8027c2:	83 c4 10             	add    $0x10,%esp
+  8027c5:	85 c0                	test   %eax,%eax
+  8027c7:	78 05                	js     8027ce <accept+0x2d>
+	return alloc_sockfd(r);
+  8027c9:	e8 5f ff ff ff       	call   80272d <alloc_sockfd>
+}
+  8027ce:	c9                   	leave
+  8027cf:	c3                   	ret
+
+008027d0 <bind>:
+{
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d9:	e8 1f ff ff ff       	call   8026fd <fd2sockid>
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 12                	js     8027f4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8027e2:	83 ec 04             	sub    $0x4,%esp
+  8027e5:	ff 75 10             	push   0x10(%ebp)
+  8027e8:	ff 75 0c             	push   0xc(%ebp)
+  8027eb:	50                   	push   %eax
+  8027ec:	e8 31 01 00 00       	call   802922 <nsipc_bind>
+  8027f1:	83 c4 10             	add    $0x10,%esp
+}
+  8027f4:	c9                   	leave
+  8027f5:	c3                   	ret
+
+008027f6 <shutdown>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ff:	e8 f9 fe ff ff       	call   8026fd <fd2sockid>
+  802804:	85 c0                	test   %eax,%eax
+  802806:	78 0f                	js     802817 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802808:	83 ec 08             	sub    $0x8,%esp
+  80280b:	ff 75 0c             	push   0xc(%ebp)
+  80280e:	50                   	push   %eax
+  80280f:	e8 43 01 00 00       	call   802957 <nsipc_shutdown>
+  802814:	83 c4 10             	add    $0x10,%esp
+}
+  802817:	c9                   	leave
+  802818:	c3                   	ret
+
+00802819 <connect>:
+{
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80281f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802822:	e8 d6 fe ff ff       	call   8026fd <fd2sockid>
+  802827:	85 c0                	test   %eax,%eax
+  802829:	78 12                	js     80283d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80282b:	83 ec 04             	sub    $0x4,%esp
+  80282e:	ff 75 10             	push   0x10(%ebp)
+  802831:	ff 75 0c             	push   0xc(%ebp)
+  802834:	50                   	push   %eax
+  802835:	e8 59 01 00 00       	call   802993 <nsipc_connect>
+  80283a:	83 c4 10             	add    $0x10,%esp
+}
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+0080283f <listen>:
+{
+  80283f:	55                   	push   %ebp
+  802840:	89 e5                	mov    %esp,%ebp
+  802842:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802845:	8b 45 08             	mov    0x8(%ebp),%eax
+  802848:	e8 b0 fe ff ff       	call   8026fd <fd2sockid>
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 0f                	js     802860 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802851:	83 ec 08             	sub    $0x8,%esp
+  802854:	ff 75 0c             	push   0xc(%ebp)
+  802857:	50                   	push   %eax
+  802858:	e8 6b 01 00 00       	call   8029c8 <nsipc_listen>
+  80285d:	83 c4 10             	add    $0x10,%esp
+}
+  802860:	c9                   	leave
+  802861:	c3                   	ret
+
+00802862 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802862:	55                   	push   %ebp
+  802863:	89 e5                	mov    %esp,%ebp
+  802865:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802868:	ff 75 10             	push   0x10(%ebp)
+  80286b:	ff 75 0c             	push   0xc(%ebp)
+  80286e:	ff 75 08             	push   0x8(%ebp)
+  802871:	e8 41 02 00 00       	call   802ab7 <nsipc_socket>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 05                	js     802882 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80287d:	e8 ab fe ff ff       	call   80272d <alloc_sockfd>
+}
+  802882:	c9                   	leave
+  802883:	c3                   	ret
+
+00802884 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	53                   	push   %ebx
+  802888:	83 ec 04             	sub    $0x4,%esp
+  80288b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80288d:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802894:	74 26                	je     8028bc <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802896:	6a 07                	push   $0x7
+  802898:	68 00 80 80 00       	push   $0x808000
+  80289d:	53                   	push   %ebx
+  80289e:	ff 35 08 60 80 00    	push   0x806008
+  8028a4:	e8 ce 1a 00 00       	call   804377 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028a9:	83 c4 0c             	add    $0xc,%esp
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	6a 00                	push   $0x0
+  8028b0:	6a 00                	push   $0x0
+  8028b2:	e8 ca 19 00 00       	call   804281 <ipc_recv>
+}
+  8028b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028bc:	83 ec 0c             	sub    $0xc,%esp
+  8028bf:	6a 02                	push   $0x2
+  8028c1:	e8 07 1b 00 00       	call   8043cd <ipc_find_env>
+  8028c6:	a3 08 60 80 00       	mov    %eax,0x806008
+  8028cb:	83 c4 10             	add    $0x10,%esp
+  8028ce:	eb c6                	jmp    802896 <nsipc+0x12>
+
+008028d0 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8028d0:	55                   	push   %ebp
+  8028d1:	89 e5                	mov    %esp,%ebp
+  8028d3:	56                   	push   %esi
+  8028d4:	53                   	push   %ebx
+  8028d5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8028d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028db:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8028e0:	8b 06                	mov    (%esi),%eax
+  8028e2:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8028e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ec:	e8 93 ff ff ff       	call   802884 <nsipc>
+  8028f1:	89 c3                	mov    %eax,%ebx
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	79 09                	jns    802900 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028f7:	89 d8                	mov    %ebx,%eax
+  8028f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028fc:	5b                   	pop    %ebx
+  8028fd:	5e                   	pop    %esi
+  8028fe:	5d                   	pop    %ebp
+  8028ff:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802900:	83 ec 04             	sub    $0x4,%esp
+  802903:	ff 35 10 80 80 00    	push   0x808010
+  802909:	68 00 80 80 00       	push   $0x808000
+  80290e:	ff 75 0c             	push   0xc(%ebp)
+  802911:	e8 17 e0 ff ff       	call   80092d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802916:	a1 10 80 80 00       	mov    0x808010,%eax
+  80291b:	89 06                	mov    %eax,(%esi)
+  80291d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802920:	eb d5                	jmp    8028f7 <nsipc_accept+0x27>
+
+00802922 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	53                   	push   %ebx
+  802926:	83 ec 08             	sub    $0x8,%esp
+  802929:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80292c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292f:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802934:	53                   	push   %ebx
+  802935:	ff 75 0c             	push   0xc(%ebp)
+  802938:	68 04 80 80 00       	push   $0x808004
+  80293d:	e8 eb df ff ff       	call   80092d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802942:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802948:	b8 02 00 00 00       	mov    $0x2,%eax
+  80294d:	e8 32 ff ff ff       	call   802884 <nsipc>
+}
+  802952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80295d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802960:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802965:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802968:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80296d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802972:	e8 0d ff ff ff       	call   802884 <nsipc>
+}
+  802977:	c9                   	leave
+  802978:	c3                   	ret
+
+00802979 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802979:	55                   	push   %ebp
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80297f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802982:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802987:	b8 04 00 00 00       	mov    $0x4,%eax
+  80298c:	e8 f3 fe ff ff       	call   802884 <nsipc>
+}
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+
+00802993 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	53                   	push   %ebx
+  802997:	83 ec 08             	sub    $0x8,%esp
+  80299a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80299d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a0:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029a5:	53                   	push   %ebx
+  8029a6:	ff 75 0c             	push   0xc(%ebp)
+  8029a9:	68 04 80 80 00       	push   $0x808004
+  8029ae:	e8 7a df ff ff       	call   80092d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8029b3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8029b9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029be:	e8 c1 fe ff ff       	call   802884 <nsipc>
+}
+  8029c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+008029c8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8029ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8029d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d9:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8029de:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029e3:	e8 9c fe ff ff       	call   802884 <nsipc>
+}
+  8029e8:	c9                   	leave
+  8029e9:	c3                   	ret
+
+008029ea <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8029ea:	55                   	push   %ebp
+  8029eb:	89 e5                	mov    %esp,%ebp
+  8029ed:	56                   	push   %esi
+  8029ee:	53                   	push   %ebx
+  8029ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029fa:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a00:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a03:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a08:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a0d:	e8 72 fe ff ff       	call   802884 <nsipc>
+  802a12:	89 c3                	mov    %eax,%ebx
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	78 22                	js     802a3a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a18:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a1d:	39 c6                	cmp    %eax,%esi
+  802a1f:	0f 4e c6             	cmovle %esi,%eax
+  802a22:	39 c3                	cmp    %eax,%ebx
+  802a24:	7f 1d                	jg     802a43 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a26:	83 ec 04             	sub    $0x4,%esp
+  802a29:	53                   	push   %ebx
+  802a2a:	68 00 80 80 00       	push   $0x808000
+  802a2f:	ff 75 0c             	push   0xc(%ebp)
+  802a32:	e8 f6 de ff ff       	call   80092d <memmove>
+  802a37:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a3a:	89 d8                	mov    %ebx,%eax
+  802a3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a3f:	5b                   	pop    %ebx
+  802a40:	5e                   	pop    %esi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a43:	68 e4 4b 80 00       	push   $0x804be4
+  802a48:	68 9d 4b 80 00       	push   $0x804b9d
+  802a4d:	6a 62                	push   $0x62
+  802a4f:	68 f9 4b 80 00       	push   $0x804bf9
+  802a54:	e8 6c 11 00 00       	call   803bc5 <_panic>
+
+00802a59 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	53                   	push   %ebx
+  802a5d:	83 ec 04             	sub    $0x4,%esp
+  802a60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a66:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a6b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a71:	7f 2e                	jg     802aa1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a73:	83 ec 04             	sub    $0x4,%esp
+  802a76:	53                   	push   %ebx
+  802a77:	ff 75 0c             	push   0xc(%ebp)
+  802a7a:	68 0c 80 80 00       	push   $0x80800c
+  802a7f:	e8 a9 de ff ff       	call   80092d <memmove>
+	nsipcbuf.send.req_size = size;
+  802a84:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a8d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a92:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a97:	e8 e8 fd ff ff       	call   802884 <nsipc>
+}
+  802a9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9f:	c9                   	leave
+  802aa0:	c3                   	ret
+	assert(size < 1600);
+  802aa1:	68 05 4c 80 00       	push   $0x804c05
+  802aa6:	68 9d 4b 80 00       	push   $0x804b9d
+  802aab:	6a 6d                	push   $0x6d
+  802aad:	68 f9 4b 80 00       	push   $0x804bf9
+  802ab2:	e8 0e 11 00 00       	call   803bc5 <_panic>
+
+00802ab7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ab7:	55                   	push   %ebp
+  802ab8:	89 e5                	mov    %esp,%ebp
+  802aba:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802ac5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ac8:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802acd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ad0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802ad5:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ada:	e8 a5 fd ff ff       	call   802884 <nsipc>
+}
+  802adf:	c9                   	leave
+  802ae0:	c3                   	ret
+
+00802ae1 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802ae1:	55                   	push   %ebp
+  802ae2:	89 e5                	mov    %esp,%ebp
+  802ae4:	53                   	push   %ebx
+  802ae5:	83 ec 10             	sub    $0x10,%esp
+  802ae8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802aeb:	68 0c 60 80 00       	push   $0x80600c
+  802af0:	e8 50 07 00 00       	call   803245 <mutex_lock>
+	if (v == 0)
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	85 db                	test   %ebx,%ebx
+  802afa:	0f 84 85 00 00 00    	je     802b85 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b00:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b06:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b0b:	77 51                	ja     802b5e <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802b0d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802b13:	89 d8                	mov    %ebx,%eax
+  802b15:	c1 e8 0c             	shr    $0xc,%eax
+  802b18:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b1f:	f6 c4 02             	test   $0x2,%ah
+  802b22:	74 50                	je     802b74 <free+0x93>
+		sys_page_unmap(0, c);
+  802b24:	83 ec 08             	sub    $0x8,%esp
+  802b27:	53                   	push   %ebx
+  802b28:	6a 00                	push   $0x0
+  802b2a:	e8 4f e1 ff ff       	call   800c7e <sys_page_unmap>
+		c += PGSIZE;
+  802b2f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802b35:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b3b:	83 c4 10             	add    $0x10,%esp
+  802b3e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b43:	76 ce                	jbe    802b13 <free+0x32>
+  802b45:	68 4f 4c 80 00       	push   $0x804c4f
+  802b4a:	68 9d 4b 80 00       	push   $0x804b9d
+  802b4f:	68 82 00 00 00       	push   $0x82
+  802b54:	68 42 4c 80 00       	push   $0x804c42
+  802b59:	e8 67 10 00 00       	call   803bc5 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b5e:	68 14 4c 80 00       	push   $0x804c14
+  802b63:	68 9d 4b 80 00       	push   $0x804b9d
+  802b68:	6a 7b                	push   $0x7b
+  802b6a:	68 42 4c 80 00       	push   $0x804c42
+  802b6f:	e8 51 10 00 00       	call   803bc5 <_panic>
+	if (--(*ref) == 0)
+  802b74:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802b7a:	83 e8 01             	sub    $0x1,%eax
+  802b7d:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802b83:	74 15                	je     802b9a <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802b85:	83 ec 0c             	sub    $0xc,%esp
+  802b88:	68 0c 60 80 00       	push   $0x80600c
+  802b8d:	e8 20 07 00 00       	call   8032b2 <mutex_unlock>
+}
+  802b92:	83 c4 10             	add    $0x10,%esp
+  802b95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b98:	c9                   	leave
+  802b99:	c3                   	ret
+		sys_page_unmap(0, c);
+  802b9a:	83 ec 08             	sub    $0x8,%esp
+  802b9d:	53                   	push   %ebx
+  802b9e:	6a 00                	push   $0x0
+  802ba0:	e8 d9 e0 ff ff       	call   800c7e <sys_page_unmap>
+  802ba5:	83 c4 10             	add    $0x10,%esp
+  802ba8:	eb db                	jmp    802b85 <free+0xa4>
+
+00802baa <malloc>:
+{
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	57                   	push   %edi
+  802bae:	56                   	push   %esi
+  802baf:	53                   	push   %ebx
+  802bb0:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802bb3:	68 0c 60 80 00       	push   $0x80600c
+  802bb8:	e8 88 06 00 00       	call   803245 <mutex_lock>
+	if (mptr == 0)
+  802bbd:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802bc3:	83 c4 10             	add    $0x10,%esp
+  802bc6:	85 ff                	test   %edi,%edi
+  802bc8:	74 6c                	je     802c36 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	83 c0 03             	add    $0x3,%eax
+  802bd0:	83 e0 fc             	and    $0xfffffffc,%eax
+  802bd3:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802bd5:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802bda:	0f 87 64 01 00 00    	ja     802d44 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802be0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802be6:	74 30                	je     802c18 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802be8:	89 f9                	mov    %edi,%ecx
+  802bea:	c1 e9 0c             	shr    $0xc,%ecx
+  802bed:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802bf1:	c1 e8 0c             	shr    $0xc,%eax
+  802bf4:	39 c1                	cmp    %eax,%ecx
+  802bf6:	74 5f                	je     802c57 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802bf8:	83 ec 0c             	sub    $0xc,%esp
+  802bfb:	57                   	push   %edi
+  802bfc:	e8 e0 fe ff ff       	call   802ae1 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802c01:	a1 10 60 80 00       	mov    0x806010,%eax
+  802c06:	05 00 10 00 00       	add    $0x1000,%eax
+  802c0b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c10:	a3 10 60 80 00       	mov    %eax,0x806010
+  802c15:	83 c4 10             	add    $0x10,%esp
+  802c18:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802c1e:	ba 02 00 00 00       	mov    $0x2,%edx
+  802c23:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802c27:	8d 7e 04             	lea    0x4(%esi),%edi
+  802c2a:	89 cb                	mov    %ecx,%ebx
+  802c2c:	01 f9                	add    %edi,%ecx
+  802c2e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802c31:	e9 8b 00 00 00       	jmp    802cc1 <malloc+0x117>
+		mptr = mbegin;
+  802c36:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802c3d:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802c40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c43:	83 c0 03             	add    $0x3,%eax
+  802c46:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c49:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c4b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c50:	76 c6                	jbe    802c18 <malloc+0x6e>
+  802c52:	e9 d6 00 00 00       	jmp    802d2d <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802c57:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c5d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802c62:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802c66:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802c69:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802c6e:	e9 ba 00 00 00       	jmp    802d2d <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c73:	05 00 10 00 00       	add    $0x1000,%eax
+  802c78:	39 c8                	cmp    %ecx,%eax
+  802c7a:	0f 83 cb 00 00 00    	jae    802d4b <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802c80:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802c85:	77 22                	ja     802ca9 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802c87:	89 c2                	mov    %eax,%edx
+  802c89:	c1 ea 16             	shr    $0x16,%edx
+  802c8c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802c93:	f6 c2 01             	test   $0x1,%dl
+  802c96:	74 db                	je     802c73 <malloc+0xc9>
+  802c98:	89 c2                	mov    %eax,%edx
+  802c9a:	c1 ea 0c             	shr    $0xc,%edx
+  802c9d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ca4:	f6 c2 01             	test   $0x1,%dl
+  802ca7:	74 ca                	je     802c73 <malloc+0xc9>
+		if (mptr == mend) {
+  802ca9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802caf:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802cb5:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802cb9:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802cbf:	74 04                	je     802cc5 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802cc1:	89 d8                	mov    %ebx,%eax
+  802cc3:	eb b3                	jmp    802c78 <malloc+0xce>
+  802cc5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802cc8:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802ccd:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802cd1:	83 ea 01             	sub    $0x1,%edx
+  802cd4:	0f 85 50 ff ff ff    	jne    802c2a <malloc+0x80>
+  802cda:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802ce1:	00 00 08 
+				return 0;	/* out of address space */
+  802ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce9:	eb 42                	jmp    802d2d <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802ceb:	85 db                	test   %ebx,%ebx
+  802ced:	78 1e                	js     802d0d <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802cef:	83 ec 08             	sub    $0x8,%esp
+  802cf2:	89 d8                	mov    %ebx,%eax
+  802cf4:	03 05 10 60 80 00    	add    0x806010,%eax
+  802cfa:	50                   	push   %eax
+  802cfb:	6a 00                	push   $0x0
+  802cfd:	e8 7c df ff ff       	call   800c7e <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802d02:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802d08:	83 c4 10             	add    $0x10,%esp
+  802d0b:	eb de                	jmp    802ceb <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802d0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d12:	eb 19                	jmp    802d2d <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802d14:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802d17:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802d1d:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802d24:	00 
+	mptr += n;
+  802d25:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d28:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802d2d:	83 ec 0c             	sub    $0xc,%esp
+  802d30:	68 0c 60 80 00       	push   $0x80600c
+  802d35:	e8 78 05 00 00       	call   8032b2 <mutex_unlock>
+}
+  802d3a:	89 f8                	mov    %edi,%eax
+  802d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d3f:	5b                   	pop    %ebx
+  802d40:	5e                   	pop    %esi
+  802d41:	5f                   	pop    %edi
+  802d42:	5d                   	pop    %ebp
+  802d43:	c3                   	ret
+		return 0;
+  802d44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d49:	eb e2                	jmp    802d2d <malloc+0x183>
+  802d4b:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802d4f:	74 06                	je     802d57 <malloc+0x1ad>
+  802d51:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d5c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d5f:	39 fb                	cmp    %edi,%ebx
+  802d61:	73 b1                	jae    802d14 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d63:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d69:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802d6c:	39 fe                	cmp    %edi,%esi
+  802d6e:	0f 92 c0             	setb   %al
+  802d71:	0f b6 c0             	movzbl %al,%eax
+  802d74:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802d77:	83 c8 07             	or     $0x7,%eax
+  802d7a:	50                   	push   %eax
+  802d7b:	89 d8                	mov    %ebx,%eax
+  802d7d:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d83:	50                   	push   %eax
+  802d84:	6a 00                	push   $0x0
+  802d86:	e8 5a de ff ff       	call   800be5 <sys_page_alloc>
+  802d8b:	83 c4 10             	add    $0x10,%esp
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	0f 88 55 ff ff ff    	js     802ceb <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802d96:	89 f3                	mov    %esi,%ebx
+  802d98:	eb c5                	jmp    802d5f <malloc+0x1b5>
+
+00802d9a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d9a:	55                   	push   %ebp
+  802d9b:	89 e5                	mov    %esp,%ebp
+  802d9d:	56                   	push   %esi
+  802d9e:	53                   	push   %ebx
+  802d9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802da2:	83 ec 0c             	sub    $0xc,%esp
+  802da5:	ff 75 08             	push   0x8(%ebp)
+  802da8:	e8 ea e2 ff ff       	call   801097 <fd2data>
+  802dad:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802daf:	83 c4 08             	add    $0x8,%esp
+  802db2:	68 67 4c 80 00       	push   $0x804c67
+  802db7:	53                   	push   %ebx
+  802db8:	e8 ea d9 ff ff       	call   8007a7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802dbd:	8b 46 04             	mov    0x4(%esi),%eax
+  802dc0:	2b 06                	sub    (%esi),%eax
+  802dc2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802dc8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dcf:	00 00 00 
+	stat->st_dev = &devpipe;
+  802dd2:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802dd9:	52 80 00 
+	return 0;
+}
+  802ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802de4:	5b                   	pop    %ebx
+  802de5:	5e                   	pop    %esi
+  802de6:	5d                   	pop    %ebp
+  802de7:	c3                   	ret
+
+00802de8 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802de8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ded:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802df1:	85 c9                	test   %ecx,%ecx
+  802df3:	75 01                	jne    802df6 <pipewake+0xe>
+  802df5:	c3                   	ret
+{
+  802df6:	55                   	push   %ebp
+  802df7:	89 e5                	mov    %esp,%ebp
+  802df9:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802dfc:	68 00 04 00 00       	push   $0x400
+  802e01:	52                   	push   %edx
+  802e02:	e8 22 e1 ff ff       	call   800f29 <sys_futex_wake>
+  802e07:	83 c4 10             	add    $0x10,%esp
+}
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+
+00802e0c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	56                   	push   %esi
+  802e10:	53                   	push   %ebx
+  802e11:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e14:	83 ec 0c             	sub    $0xc,%esp
+  802e17:	56                   	push   %esi
+  802e18:	e8 7a e2 ff ff       	call   801097 <fd2data>
+  802e1d:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802e1f:	83 c4 08             	add    $0x8,%esp
+  802e22:	56                   	push   %esi
+  802e23:	6a 00                	push   $0x0
+  802e25:	e8 54 de ff ff       	call   800c7e <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802e2a:	8d 53 04             	lea    0x4(%ebx),%edx
+  802e2d:	8d 43 08             	lea    0x8(%ebx),%eax
+  802e30:	e8 b3 ff ff ff       	call   802de8 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802e35:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802e38:	89 da                	mov    %ebx,%edx
+  802e3a:	e8 a9 ff ff ff       	call   802de8 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802e3f:	89 34 24             	mov    %esi,(%esp)
+  802e42:	e8 50 e2 ff ff       	call   801097 <fd2data>
+  802e47:	83 c4 08             	add    $0x8,%esp
+  802e4a:	50                   	push   %eax
+  802e4b:	6a 00                	push   $0x0
+  802e4d:	e8 2c de ff ff       	call   800c7e <sys_page_unmap>
+}
+  802e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e55:	5b                   	pop    %ebx
+  802e56:	5e                   	pop    %esi
+  802e57:	5d                   	pop    %ebp
+  802e58:	c3                   	ret
+
+00802e59 <_pipeisclosed>:
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	57                   	push   %edi
+  802e5d:	56                   	push   %esi
+  802e5e:	53                   	push   %ebx
+  802e5f:	83 ec 1c             	sub    $0x1c,%esp
+  802e62:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e65:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e67:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802e6c:	eb 5d                	jmp    802ecb <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802e6e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802e74:	8b 02                	mov    (%edx),%eax
+  802e76:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e79:	83 ec 0c             	sub    $0xc,%esp
+  802e7c:	ff 75 e0             	push   -0x20(%ebp)
+  802e7f:	e8 88 15 00 00       	call   80440c <pageref>
+  802e84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e87:	89 3c 24             	mov    %edi,(%esp)
+  802e8a:	e8 7d 15 00 00       	call   80440c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802e8f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e91:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802e97:	83 c4 10             	add    $0x10,%esp
+  802e9a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802ea0:	77 15                	ja     802eb7 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802ea2:	89 f2                	mov    %esi,%edx
+  802ea4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802ea6:	c1 ea 10             	shr    $0x10,%edx
+  802ea9:	74 0c                	je     802eb7 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802eab:	c1 e2 10             	shl    $0x10,%edx
+  802eae:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802eb3:	29 d1                	sub    %edx,%ecx
+  802eb5:	eb 06                	jmp    802ebd <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802eb7:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802ebd:	8b 11                	mov    (%ecx),%edx
+  802ebf:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802ec2:	39 d3                	cmp    %edx,%ebx
+  802ec4:	74 6e                	je     802f34 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802ec6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ec9:	74 24                	je     802eef <_pipeisclosed+0x96>
+  802ecb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ecd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ed3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802ed8:	77 94                	ja     802e6e <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802eda:	89 f0                	mov    %esi,%eax
+  802edc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802ede:	c1 e8 10             	shr    $0x10,%eax
+  802ee1:	74 8b                	je     802e6e <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802ee3:	c1 e0 10             	shl    $0x10,%eax
+  802ee6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802eeb:	29 c2                	sub    %eax,%edx
+  802eed:	eb 85                	jmp    802e74 <_pipeisclosed+0x1b>
+  802eef:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ef1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802ef7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802efc:	77 18                	ja     802f16 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802efe:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f03:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f05:	c1 e8 10             	shr    $0x10,%eax
+  802f08:	74 0c                	je     802f16 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f0a:	c1 e0 10             	shl    $0x10,%eax
+  802f0d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f12:	29 c2                	sub    %eax,%edx
+  802f14:	eb 06                	jmp    802f1c <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802f16:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f1c:	8b 02                	mov    (%edx),%eax
+  802f1e:	8b 40 58             	mov    0x58(%eax),%eax
+  802f21:	6a 01                	push   $0x1
+  802f23:	50                   	push   %eax
+  802f24:	53                   	push   %ebx
+  802f25:	68 6e 4c 80 00       	push   $0x804c6e
+  802f2a:	e8 94 d2 ff ff       	call   8001c3 <cprintf>
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	eb 97                	jmp    802ecb <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802f34:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f37:	0f 94 c0             	sete   %al
+  802f3a:	0f b6 c0             	movzbl %al,%eax
+}
+  802f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f40:	5b                   	pop    %ebx
+  802f41:	5e                   	pop    %esi
+  802f42:	5f                   	pop    %edi
+  802f43:	5d                   	pop    %ebp
+  802f44:	c3                   	ret
+
+00802f45 <devpipe_write>:
+{
+  802f45:	55                   	push   %ebp
+  802f46:	89 e5                	mov    %esp,%ebp
+  802f48:	57                   	push   %edi
+  802f49:	56                   	push   %esi
+  802f4a:	53                   	push   %ebx
+  802f4b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f4e:	ff 75 08             	push   0x8(%ebp)
+  802f51:	e8 41 e1 ff ff       	call   801097 <fd2data>
+  802f56:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f58:	83 c4 10             	add    $0x10,%esp
+  802f5b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f62:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802f65:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f68:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f6b:	0f 84 96 00 00 00    	je     803007 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802f71:	8d 73 08             	lea    0x8(%ebx),%esi
+  802f74:	eb 32                	jmp    802fa8 <devpipe_write+0x63>
+  802f76:	89 fa                	mov    %edi,%edx
+  802f78:	89 f0                	mov    %esi,%eax
+  802f7a:	e8 69 fe ff ff       	call   802de8 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802f7f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f82:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802f85:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f8a:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802f8f:	83 ec 04             	sub    $0x4,%esp
+  802f92:	6a 0a                	push   $0xa
+  802f94:	50                   	push   %eax
+  802f95:	53                   	push   %ebx
+  802f96:	e8 5f df ff ff       	call   800efa <sys_futex_wait>
+  802f9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802fa0:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802fa5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fa8:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fab:	8b 0b                	mov    (%ebx),%ecx
+  802fad:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fb0:	39 d0                	cmp    %edx,%eax
+  802fb2:	72 1b                	jb     802fcf <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  802fb4:	89 da                	mov    %ebx,%edx
+  802fb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb9:	e8 9b fe ff ff       	call   802e59 <_pipeisclosed>
+  802fbe:	85 c0                	test   %eax,%eax
+  802fc0:	74 b4                	je     802f76 <devpipe_write+0x31>
+				return 0;
+  802fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fca:	5b                   	pop    %ebx
+  802fcb:	5e                   	pop    %esi
+  802fcc:	5f                   	pop    %edi
+  802fcd:	5d                   	pop    %ebp
+  802fce:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fd2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802fd5:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  802fd9:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  802fdc:	89 c2                	mov    %eax,%edx
+  802fde:	c1 fa 1f             	sar    $0x1f,%edx
+  802fe1:	89 d1                	mov    %edx,%ecx
+  802fe3:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fe6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fe9:	83 e2 1f             	and    $0x1f,%edx
+  802fec:	29 ca                	sub    %ecx,%edx
+  802fee:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  802ff2:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  802ff6:	83 c0 01             	add    $0x1,%eax
+  802ff9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802ffc:	83 c6 01             	add    $0x1,%esi
+  802fff:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803002:	e9 5e ff ff ff       	jmp    802f65 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803007:	8d 53 04             	lea    0x4(%ebx),%edx
+  80300a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80300d:	e8 d6 fd ff ff       	call   802de8 <pipewake>
+	return i;
+  803012:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803015:	eb b0                	jmp    802fc7 <devpipe_write+0x82>
+
+00803017 <devpipe_read>:
+{
+  803017:	55                   	push   %ebp
+  803018:	89 e5                	mov    %esp,%ebp
+  80301a:	57                   	push   %edi
+  80301b:	56                   	push   %esi
+  80301c:	53                   	push   %ebx
+  80301d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803020:	ff 75 08             	push   0x8(%ebp)
+  803023:	e8 6f e0 ff ff       	call   801097 <fd2data>
+  803028:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	be 00 00 00 00       	mov    $0x0,%esi
+  803032:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803035:	74 6c                	je     8030a3 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803037:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80303a:	eb 25                	jmp    803061 <devpipe_read+0x4a>
+  80303c:	8b 13                	mov    (%ebx),%edx
+  80303e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803043:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803048:	83 ec 04             	sub    $0x4,%esp
+  80304b:	6a 0a                	push   $0xa
+  80304d:	52                   	push   %edx
+  80304e:	57                   	push   %edi
+  80304f:	e8 a6 de ff ff       	call   800efa <sys_futex_wait>
+  803054:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803059:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80305e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803061:	8b 03                	mov    (%ebx),%eax
+  803063:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803066:	75 19                	jne    803081 <devpipe_read+0x6a>
+			if (i > 0)
+  803068:	85 f6                	test   %esi,%esi
+  80306a:	75 3a                	jne    8030a6 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80306c:	89 da                	mov    %ebx,%edx
+  80306e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803071:	e8 e3 fd ff ff       	call   802e59 <_pipeisclosed>
+  803076:	85 c0                	test   %eax,%eax
+  803078:	74 c2                	je     80303c <devpipe_read+0x25>
+				return 0;
+  80307a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307f:	eb 31                	jmp    8030b2 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803081:	89 c1                	mov    %eax,%ecx
+  803083:	c1 f9 1f             	sar    $0x1f,%ecx
+  803086:	c1 e9 1b             	shr    $0x1b,%ecx
+  803089:	01 c8                	add    %ecx,%eax
+  80308b:	83 e0 1f             	and    $0x1f,%eax
+  80308e:	29 c8                	sub    %ecx,%eax
+  803090:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803098:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80309b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80309e:	83 c6 01             	add    $0x1,%esi
+  8030a1:	eb 8f                	jmp    803032 <devpipe_read+0x1b>
+out:
+  8030a3:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8030a6:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8030a9:	89 da                	mov    %ebx,%edx
+  8030ab:	e8 38 fd ff ff       	call   802de8 <pipewake>
+	return i;
+  8030b0:	89 f0                	mov    %esi,%eax
+}
+  8030b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b5:	5b                   	pop    %ebx
+  8030b6:	5e                   	pop    %esi
+  8030b7:	5f                   	pop    %edi
+  8030b8:	5d                   	pop    %ebp
+  8030b9:	c3                   	ret
+
+008030ba <pipe>:
+{
+  8030ba:	55                   	push   %ebp
+  8030bb:	89 e5                	mov    %esp,%ebp
+  8030bd:	56                   	push   %esi
+  8030be:	53                   	push   %ebx
+  8030bf:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030c5:	50                   	push   %eax
+  8030c6:	e8 e3 df ff ff       	call   8010ae <fd_alloc>
+  8030cb:	89 c3                	mov    %eax,%ebx
+  8030cd:	83 c4 10             	add    $0x10,%esp
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	0f 88 23 01 00 00    	js     8031fb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030d8:	83 ec 04             	sub    $0x4,%esp
+  8030db:	68 07 04 00 00       	push   $0x407
+  8030e0:	ff 75 f4             	push   -0xc(%ebp)
+  8030e3:	6a 00                	push   $0x0
+  8030e5:	e8 fb da ff ff       	call   800be5 <sys_page_alloc>
+  8030ea:	89 c3                	mov    %eax,%ebx
+  8030ec:	83 c4 10             	add    $0x10,%esp
+  8030ef:	85 c0                	test   %eax,%eax
+  8030f1:	0f 88 04 01 00 00    	js     8031fb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030f7:	83 ec 0c             	sub    $0xc,%esp
+  8030fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030fd:	50                   	push   %eax
+  8030fe:	e8 ab df ff ff       	call   8010ae <fd_alloc>
+  803103:	89 c3                	mov    %eax,%ebx
+  803105:	83 c4 10             	add    $0x10,%esp
+  803108:	85 c0                	test   %eax,%eax
+  80310a:	0f 88 db 00 00 00    	js     8031eb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803110:	83 ec 04             	sub    $0x4,%esp
+  803113:	68 07 04 00 00       	push   $0x407
+  803118:	ff 75 f0             	push   -0x10(%ebp)
+  80311b:	6a 00                	push   $0x0
+  80311d:	e8 c3 da ff ff       	call   800be5 <sys_page_alloc>
+  803122:	89 c3                	mov    %eax,%ebx
+  803124:	83 c4 10             	add    $0x10,%esp
+  803127:	85 c0                	test   %eax,%eax
+  803129:	0f 88 bc 00 00 00    	js     8031eb <pipe+0x131>
+	va = fd2data(fd0);
+  80312f:	83 ec 0c             	sub    $0xc,%esp
+  803132:	ff 75 f4             	push   -0xc(%ebp)
+  803135:	e8 5d df ff ff       	call   801097 <fd2data>
+  80313a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313c:	83 c4 0c             	add    $0xc,%esp
+  80313f:	68 07 04 00 00       	push   $0x407
+  803144:	50                   	push   %eax
+  803145:	6a 00                	push   $0x0
+  803147:	e8 99 da ff ff       	call   800be5 <sys_page_alloc>
+  80314c:	89 c3                	mov    %eax,%ebx
+  80314e:	83 c4 10             	add    $0x10,%esp
+  803151:	85 c0                	test   %eax,%eax
+  803153:	0f 88 82 00 00 00    	js     8031db <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803159:	83 ec 0c             	sub    $0xc,%esp
+  80315c:	ff 75 f0             	push   -0x10(%ebp)
+  80315f:	e8 33 df ff ff       	call   801097 <fd2data>
+  803164:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80316b:	50                   	push   %eax
+  80316c:	6a 00                	push   $0x0
+  80316e:	56                   	push   %esi
+  80316f:	6a 00                	push   $0x0
+  803171:	e8 bc da ff ff       	call   800c32 <sys_page_map>
+  803176:	89 c3                	mov    %eax,%ebx
+  803178:	83 c4 20             	add    $0x20,%esp
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	78 4e                	js     8031cd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80317f:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803184:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803187:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803189:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80318c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803193:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803196:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803198:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80319b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031a2:	83 ec 0c             	sub    $0xc,%esp
+  8031a5:	ff 75 f4             	push   -0xc(%ebp)
+  8031a8:	e8 da de ff ff       	call   801087 <fd2num>
+  8031ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031b2:	83 c4 04             	add    $0x4,%esp
+  8031b5:	ff 75 f0             	push   -0x10(%ebp)
+  8031b8:	e8 ca de ff ff       	call   801087 <fd2num>
+  8031bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031c3:	83 c4 10             	add    $0x10,%esp
+  8031c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031cb:	eb 2e                	jmp    8031fb <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	56                   	push   %esi
+  8031d1:	6a 00                	push   $0x0
+  8031d3:	e8 a6 da ff ff       	call   800c7e <sys_page_unmap>
+  8031d8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031db:	83 ec 08             	sub    $0x8,%esp
+  8031de:	ff 75 f0             	push   -0x10(%ebp)
+  8031e1:	6a 00                	push   $0x0
+  8031e3:	e8 96 da ff ff       	call   800c7e <sys_page_unmap>
+  8031e8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031eb:	83 ec 08             	sub    $0x8,%esp
+  8031ee:	ff 75 f4             	push   -0xc(%ebp)
+  8031f1:	6a 00                	push   $0x0
+  8031f3:	e8 86 da ff ff       	call   800c7e <sys_page_unmap>
+  8031f8:	83 c4 10             	add    $0x10,%esp
+}
+  8031fb:	89 d8                	mov    %ebx,%eax
+  8031fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803200:	5b                   	pop    %ebx
+  803201:	5e                   	pop    %esi
+  803202:	5d                   	pop    %ebp
+  803203:	c3                   	ret
+
+00803204 <pipeisclosed>:
+{
+  803204:	55                   	push   %ebp
+  803205:	89 e5                	mov    %esp,%ebp
+  803207:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80320a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80320d:	50                   	push   %eax
+  80320e:	ff 75 08             	push   0x8(%ebp)
+  803211:	e8 ee de ff ff       	call   801104 <fd_lookup>
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	78 18                	js     803235 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80321d:	83 ec 0c             	sub    $0xc,%esp
+  803220:	ff 75 f4             	push   -0xc(%ebp)
+  803223:	e8 6f de ff ff       	call   801097 <fd2data>
+  803228:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80322a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80322d:	e8 27 fc ff ff       	call   802e59 <_pipeisclosed>
+  803232:	83 c4 10             	add    $0x10,%esp
+}
+  803235:	c9                   	leave
+  803236:	c3                   	ret
+
+00803237 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803237:	55                   	push   %ebp
+  803238:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80323a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803243:	5d                   	pop    %ebp
+  803244:	c3                   	ret
+
+00803245 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803245:	55                   	push   %ebp
+  803246:	89 e5                	mov    %esp,%ebp
+  803248:	56                   	push   %esi
+  803249:	53                   	push   %ebx
+  80324a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80324d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803252:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803257:	89 d0                	mov    %edx,%eax
+  803259:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80325d:	85 c0                	test   %eax,%eax
+  80325f:	74 2d                	je     80328e <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803261:	83 f8 02             	cmp    $0x2,%eax
+  803264:	74 08                	je     80326e <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803266:	b8 02 00 00 00       	mov    $0x2,%eax
+  80326b:	f0 87 03             	lock xchg %eax,(%ebx)
+  80326e:	be 02 00 00 00       	mov    $0x2,%esi
+  803273:	eb 15                	jmp    80328a <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803275:	83 ec 04             	sub    $0x4,%esp
+  803278:	6a 00                	push   $0x0
+  80327a:	6a 02                	push   $0x2
+  80327c:	53                   	push   %ebx
+  80327d:	e8 78 dc ff ff       	call   800efa <sys_futex_wait>
+  803282:	89 f0                	mov    %esi,%eax
+  803284:	f0 87 03             	lock xchg %eax,(%ebx)
+  803287:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	75 e7                	jne    803275 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80328e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803291:	5b                   	pop    %ebx
+  803292:	5e                   	pop    %esi
+  803293:	5d                   	pop    %ebp
+  803294:	c3                   	ret
+
+00803295 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803295:	55                   	push   %ebp
+  803296:	89 e5                	mov    %esp,%ebp
+  803298:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80329b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8032a5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8032a9:	f7 d8                	neg    %eax
+  8032ab:	19 c0                	sbb    %eax,%eax
+  8032ad:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8032b0:	5d                   	pop    %ebp
+  8032b1:	c3                   	ret
+
+008032b2 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8032b2:	55                   	push   %ebp
+  8032b3:	89 e5                	mov    %esp,%ebp
+  8032b5:	83 ec 08             	sub    $0x8,%esp
+  8032b8:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8032bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c0:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8032c3:	83 f8 02             	cmp    $0x2,%eax
+  8032c6:	74 02                	je     8032ca <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8032c8:	c9                   	leave
+  8032c9:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8032ca:	83 ec 08             	sub    $0x8,%esp
+  8032cd:	6a 01                	push   $0x1
+  8032cf:	52                   	push   %edx
+  8032d0:	e8 54 dc ff ff       	call   800f29 <sys_futex_wake>
+  8032d5:	83 c4 10             	add    $0x10,%esp
+}
+  8032d8:	eb ee                	jmp    8032c8 <mutex_unlock+0x16>
+
+008032da <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8032da:	55                   	push   %ebp
+  8032db:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8032dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032e6:	5d                   	pop    %ebp
+  8032e7:	c3                   	ret
+
+008032e8 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8032e8:	55                   	push   %ebp
+  8032e9:	89 e5                	mov    %esp,%ebp
+  8032eb:	57                   	push   %edi
+  8032ec:	56                   	push   %esi
+  8032ed:	53                   	push   %ebx
+  8032ee:	83 ec 18             	sub    $0x18,%esp
+  8032f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8032f7:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8032f9:	53                   	push   %ebx
+  8032fa:	e8 b3 ff ff ff       	call   8032b2 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8032ff:	83 c4 0c             	add    $0xc,%esp
+  803302:	ff 75 10             	push   0x10(%ebp)
+  803305:	57                   	push   %edi
+  803306:	56                   	push   %esi
+  803307:	e8 ee db ff ff       	call   800efa <sys_futex_wait>
+  80330c:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	be 02 00 00 00       	mov    $0x2,%esi
+  803316:	eb 10                	jmp    803328 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803318:	83 ec 04             	sub    $0x4,%esp
+  80331b:	6a 00                	push   $0x0
+  80331d:	6a 02                	push   $0x2
+  80331f:	53                   	push   %ebx
+  803320:	e8 d5 db ff ff       	call   800efa <sys_futex_wait>
+  803325:	83 c4 10             	add    $0x10,%esp
+  803328:	89 f0                	mov    %esi,%eax
+  80332a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80332d:	85 c0                	test   %eax,%eax
+  80332f:	75 e7                	jne    803318 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803331:	83 ff ec             	cmp    $0xffffffec,%edi
+  803334:	74 05                	je     80333b <cond_timedwait+0x53>
+  803336:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80333b:	89 f8                	mov    %edi,%eax
+  80333d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803340:	5b                   	pop    %ebx
+  803341:	5e                   	pop    %esi
+  803342:	5f                   	pop    %edi
+  803343:	5d                   	pop    %ebp
+  803344:	c3                   	ret
+
+00803345 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803345:	55                   	push   %ebp
+  803346:	89 e5                	mov    %esp,%ebp
+  803348:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80334b:	6a 00                	push   $0x0
+  80334d:	ff 75 0c             	push   0xc(%ebp)
+  803350:	ff 75 08             	push   0x8(%ebp)
+  803353:	e8 90 ff ff ff       	call   8032e8 <cond_timedwait>
+}
+  803358:	83 c4 10             	add    $0x10,%esp
+  80335b:	c9                   	leave
+  80335c:	c3                   	ret
+
+0080335d <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80335d:	55                   	push   %ebp
+  80335e:	89 e5                	mov    %esp,%ebp
+  803360:	83 ec 10             	sub    $0x10,%esp
+  803363:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803366:	ba 01 00 00 00       	mov    $0x1,%edx
+  80336b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80336f:	6a 01                	push   $0x1
+  803371:	50                   	push   %eax
+  803372:	e8 b2 db ff ff       	call   800f29 <sys_futex_wake>
+}
+  803377:	83 c4 10             	add    $0x10,%esp
+  80337a:	c9                   	leave
+  80337b:	c3                   	ret
+
+0080337c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80337c:	55                   	push   %ebp
+  80337d:	89 e5                	mov    %esp,%ebp
+  80337f:	83 ec 10             	sub    $0x10,%esp
+  803382:	8b 45 08             	mov    0x8(%ebp),%eax
+  803385:	ba 01 00 00 00       	mov    $0x1,%edx
+  80338a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80338e:	68 00 04 00 00       	push   $0x400
+  803393:	50                   	push   %eax
+  803394:	e8 90 db ff ff       	call   800f29 <sys_futex_wake>
+}
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	c9                   	leave
+  80339d:	c3                   	ret
+
+0080339e <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8033a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033a7:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8033a9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8033b0:	5d                   	pop    %ebp
+  8033b1:	c3                   	ret
+
+008033b2 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8033b2:	55                   	push   %ebp
+  8033b3:	89 e5                	mov    %esp,%ebp
+  8033b5:	53                   	push   %ebx
+  8033b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8033b9:	8b 11                	mov    (%ecx),%edx
+  8033bb:	85 d2                	test   %edx,%edx
+  8033bd:	74 14                	je     8033d3 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8033bf:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8033c2:	89 d0                	mov    %edx,%eax
+  8033c4:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8033c8:	39 c2                	cmp    %eax,%edx
+  8033ca:	75 ed                	jne    8033b9 <sem_trywait+0x7>
+			return 0;
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d1:	eb 05                	jmp    8033d8 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8033d3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8033d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033db:	c9                   	leave
+  8033dc:	c3                   	ret
+
+008033dd <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8033dd:	55                   	push   %ebp
+  8033de:	89 e5                	mov    %esp,%ebp
+  8033e0:	57                   	push   %edi
+  8033e1:	56                   	push   %esi
+  8033e2:	53                   	push   %ebx
+  8033e3:	83 ec 1c             	sub    $0x1c,%esp
+  8033e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8033ec:	e8 81 da ff ff       	call   800e72 <sys_time_msec>
+  8033f1:	01 f8                	add    %edi,%eax
+  8033f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8033f6:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8033fb:	eb 28                	jmp    803425 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8033fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  803402:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803407:	83 ec 04             	sub    $0x4,%esp
+  80340a:	56                   	push   %esi
+  80340b:	6a 00                	push   $0x0
+  80340d:	53                   	push   %ebx
+  80340e:	e8 e7 da ff ff       	call   800efa <sys_futex_wait>
+  803413:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803418:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  80341d:	83 c4 10             	add    $0x10,%esp
+  803420:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803423:	74 2e                	je     803453 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803425:	83 ec 0c             	sub    $0xc,%esp
+  803428:	53                   	push   %ebx
+  803429:	e8 84 ff ff ff       	call   8033b2 <sem_trywait>
+  80342e:	83 c4 10             	add    $0x10,%esp
+  803431:	85 c0                	test   %eax,%eax
+  803433:	79 19                	jns    80344e <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803435:	85 ff                	test   %edi,%edi
+  803437:	74 c4                	je     8033fd <sem_timedwait+0x20>
+  803439:	e8 34 da ff ff       	call   800e72 <sys_time_msec>
+  80343e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803441:	29 c6                	sub    %eax,%esi
+  803443:	85 f6                	test   %esi,%esi
+  803445:	7f b6                	jg     8033fd <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803447:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  80344c:	eb 05                	jmp    803453 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  80344e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803456:	5b                   	pop    %ebx
+  803457:	5e                   	pop    %esi
+  803458:	5f                   	pop    %edi
+  803459:	5d                   	pop    %ebp
+  80345a:	c3                   	ret
+
+0080345b <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80345b:	55                   	push   %ebp
+  80345c:	89 e5                	mov    %esp,%ebp
+  80345e:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803461:	6a 00                	push   $0x0
+  803463:	ff 75 08             	push   0x8(%ebp)
+  803466:	e8 72 ff ff ff       	call   8033dd <sem_timedwait>
+}
+  80346b:	83 c4 10             	add    $0x10,%esp
+  80346e:	c9                   	leave
+  80346f:	c3                   	ret
+
+00803470 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803470:	55                   	push   %ebp
+  803471:	89 e5                	mov    %esp,%ebp
+  803473:	83 ec 08             	sub    $0x8,%esp
+  803476:	8b 45 08             	mov    0x8(%ebp),%eax
+  803479:	ba 01 00 00 00       	mov    $0x1,%edx
+  80347e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803482:	8b 50 04             	mov    0x4(%eax),%edx
+  803485:	85 d2                	test   %edx,%edx
+  803487:	75 02                	jne    80348b <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803489:	c9                   	leave
+  80348a:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80348b:	83 ec 08             	sub    $0x8,%esp
+  80348e:	6a 01                	push   $0x1
+  803490:	50                   	push   %eax
+  803491:	e8 93 da ff ff       	call   800f29 <sys_futex_wake>
+  803496:	83 c4 10             	add    $0x10,%esp
+}
+  803499:	eb ee                	jmp    803489 <sem_post+0x19>
+
+0080349b <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80349b:	55                   	push   %ebp
+  80349c:	89 e5                	mov    %esp,%ebp
+  80349e:	57                   	push   %edi
+  80349f:	56                   	push   %esi
+  8034a0:	53                   	push   %ebx
+  8034a1:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8034a4:	68 20 60 80 00       	push   $0x806020
+  8034a9:	e8 97 fd ff ff       	call   803245 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8034ae:	a1 44 60 80 00       	mov    0x806044,%eax
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	75 19                	jne    8034d3 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8034ba:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8034bf:	8b 00                	mov    (%eax),%eax
+  8034c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8034c4:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  8034c9:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  8034d0:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034d3:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8034d8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8034db:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8034e2:	8b 40 04             	mov    0x4(%eax),%eax
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	0f 84 e4 00 00 00    	je     8035d1 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8034ed:	83 c3 01             	add    $0x1,%ebx
+  8034f0:	83 fb 20             	cmp    $0x20,%ebx
+  8034f3:	75 e3                	jne    8034d8 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8034f5:	83 ec 0c             	sub    $0xc,%esp
+  8034f8:	68 20 60 80 00       	push   $0x806020
+  8034fd:	e8 b0 fd ff ff       	call   8032b2 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80350a:	e9 b8 00 00 00       	jmp    8035c7 <pthread_create+0x12c>
+  80350f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803512:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803515:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803517:	39 f3                	cmp    %esi,%ebx
+  803519:	73 16                	jae    803531 <pthread_create+0x96>
+		va -= PGSIZE;
+  80351b:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803521:	83 ec 08             	sub    $0x8,%esp
+  803524:	56                   	push   %esi
+  803525:	6a 00                	push   $0x0
+  803527:	e8 52 d7 ff ff       	call   800c7e <sys_page_unmap>
+  80352c:	83 c4 10             	add    $0x10,%esp
+  80352f:	eb e6                	jmp    803517 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803531:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803534:	83 ec 08             	sub    $0x8,%esp
+  803537:	ff 75 e4             	push   -0x1c(%ebp)
+  80353a:	6a 00                	push   $0x0
+  80353c:	e8 3d d7 ff ff       	call   800c7e <sys_page_unmap>
+	return r;
+  803541:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803544:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803547:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80354e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803555:	eb 70                	jmp    8035c7 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803557:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80355a:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803561:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803564:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803567:	8b 55 10             	mov    0x10(%ebp),%edx
+  80356a:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  80356d:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803574:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803579:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80357c:	29 c8                	sub    %ecx,%eax
+  80357e:	85 db                	test   %ebx,%ebx
+  803580:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803587:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80358a:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803591:	83 ec 04             	sub    $0x4,%esp
+  803594:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803599:	29 ca                	sub    %ecx,%edx
+  80359b:	52                   	push   %edx
+	*--esp = 0;
+  80359c:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80359f:	50                   	push   %eax
+  8035a0:	68 f8 37 80 00       	push   $0x8037f8
+  8035a5:	e8 24 da ff ff       	call   800fce <sys_thread_create>
+  8035aa:	89 c7                	mov    %eax,%edi
+  8035ac:	83 c4 10             	add    $0x10,%esp
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 91                	js     803544 <pthread_create+0xa9>
+	th->th_env = id;
+  8035b3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035b6:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  8035bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c0:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8035c2:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8035c7:	89 f8                	mov    %edi,%eax
+  8035c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035cc:	5b                   	pop    %ebx
+  8035cd:	5e                   	pop    %esi
+  8035ce:	5f                   	pop    %edi
+  8035cf:	5d                   	pop    %ebp
+  8035d0:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8035d1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035d4:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035db:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8035e2:	83 ec 0c             	sub    $0xc,%esp
+  8035e5:	68 20 60 80 00       	push   $0x806020
+  8035ea:	e8 c3 fc ff ff       	call   8032b2 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8035ef:	89 d9                	mov    %ebx,%ecx
+  8035f1:	c1 e1 10             	shl    $0x10,%ecx
+  8035f4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8035f7:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8035fc:	29 c8                	sub    %ecx,%eax
+  8035fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803601:	c1 e8 16             	shr    $0x16,%eax
+  803604:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80360b:	83 c4 10             	add    $0x10,%esp
+  80360e:	a8 01                	test   $0x1,%al
+  803610:	74 15                	je     803627 <pthread_create+0x18c>
+  803612:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803615:	c1 e8 0c             	shr    $0xc,%eax
+  803618:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80361f:	a8 01                	test   $0x1,%al
+  803621:	0f 85 30 ff ff ff    	jne    803557 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803627:	83 ec 04             	sub    $0x4,%esp
+  80362a:	6a 07                	push   $0x7
+  80362c:	ff 75 e4             	push   -0x1c(%ebp)
+  80362f:	6a 00                	push   $0x0
+  803631:	e8 af d5 ff ff       	call   800be5 <sys_page_alloc>
+  803636:	89 c7                	mov    %eax,%edi
+  803638:	83 c4 10             	add    $0x10,%esp
+  80363b:	85 c0                	test   %eax,%eax
+  80363d:	0f 88 01 ff ff ff    	js     803544 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803643:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803648:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80364b:	29 d0                	sub    %edx,%eax
+  80364d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803650:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803652:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803657:	29 d0                	sub    %edx,%eax
+  803659:	89 c7                	mov    %eax,%edi
+  80365b:	39 fe                	cmp    %edi,%esi
+  80365d:	0f 83 f4 fe ff ff    	jae    803557 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803663:	83 ec 04             	sub    $0x4,%esp
+  803666:	6a 07                	push   $0x7
+  803668:	56                   	push   %esi
+  803669:	6a 00                	push   $0x0
+  80366b:	e8 75 d5 ff ff       	call   800be5 <sys_page_alloc>
+  803670:	83 c4 10             	add    $0x10,%esp
+  803673:	85 c0                	test   %eax,%eax
+  803675:	0f 88 94 fe ff ff    	js     80350f <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80367b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803681:	eb d8                	jmp    80365b <pthread_create+0x1c0>
+
+00803683 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803683:	55                   	push   %ebp
+  803684:	89 e5                	mov    %esp,%ebp
+  803686:	57                   	push   %edi
+  803687:	56                   	push   %esi
+  803688:	53                   	push   %ebx
+  803689:	83 ec 0c             	sub    $0xc,%esp
+  80368c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80368f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803692:	83 f8 1e             	cmp    $0x1e,%eax
+  803695:	0f 87 c7 00 00 00    	ja     803762 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80369b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80369d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036a3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036a8:	77 12                	ja     8036bc <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036aa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8036af:	29 d0                	sub    %edx,%eax
+  8036b1:	c1 e8 10             	shr    $0x10,%eax
+  8036b4:	39 c3                	cmp    %eax,%ebx
+  8036b6:	0f 84 ad 00 00 00    	je     803769 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8036bc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036bf:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036c6:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8036cd:	eb 10                	jmp    8036df <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8036cf:	83 ec 04             	sub    $0x4,%esp
+  8036d2:	6a 00                	push   $0x0
+  8036d4:	6a 01                	push   $0x1
+  8036d6:	57                   	push   %edi
+  8036d7:	e8 1e d8 ff ff       	call   800efa <sys_futex_wait>
+  8036dc:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8036df:	8b 46 04             	mov    0x4(%esi),%eax
+  8036e2:	83 f8 01             	cmp    $0x1,%eax
+  8036e5:	74 e8                	je     8036cf <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8036e7:	83 f8 02             	cmp    $0x2,%eax
+  8036ea:	0f 85 80 00 00 00    	jne    803770 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036f0:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8036f3:	c1 e6 02             	shl    $0x2,%esi
+  8036f6:	eb 05                	jmp    8036fd <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8036f8:	e8 bc d4 ff ff       	call   800bb9 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8036fd:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803703:	89 ca                	mov    %ecx,%edx
+  803705:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80370b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80370e:	c1 e0 04             	shl    $0x4,%eax
+  803711:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803716:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803719:	39 c1                	cmp    %eax,%ecx
+  80371b:	75 12                	jne    80372f <pthread_join+0xac>
+  80371d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803720:	c1 e0 04             	shl    $0x4,%eax
+  803723:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803728:	8b 40 54             	mov    0x54(%eax),%eax
+  80372b:	85 c0                	test   %eax,%eax
+  80372d:	75 c9                	jne    8036f8 <pthread_join+0x75>
+	if (ret_store)
+  80372f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803733:	74 0f                	je     803744 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803735:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803738:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  80373f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803742:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803744:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803747:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80374e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80375a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80375d:	5b                   	pop    %ebx
+  80375e:	5e                   	pop    %esi
+  80375f:	5f                   	pop    %edi
+  803760:	5d                   	pop    %ebp
+  803761:	c3                   	ret
+		return -E_INVAL;
+  803762:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803767:	eb f1                	jmp    80375a <pthread_join+0xd7>
+  803769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80376e:	eb ea                	jmp    80375a <pthread_join+0xd7>
+		return -E_INVAL;
+  803770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803775:	eb e3                	jmp    80375a <pthread_join+0xd7>
+
+00803777 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803777:	55                   	push   %ebp
+  803778:	89 e5                	mov    %esp,%ebp
+  80377a:	53                   	push   %ebx
+  80377b:	83 ec 04             	sub    $0x4,%esp
+  80377e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803780:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803786:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80378b:	77 0c                	ja     803799 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80378d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803792:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803794:	c1 e8 10             	shr    $0x10,%eax
+  803797:	75 0a                	jne    8037a3 <pthread_exit+0x2c>
+		exit();
+  803799:	e8 68 c9 ff ff       	call   800106 <exit>
+  80379e:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8037a3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8037aa:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8037ad:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  8037b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8037b7:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8037ba:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8037c1:	83 ec 08             	sub    $0x8,%esp
+  8037c4:	6a 20                	push   $0x20
+  8037c6:	01 c2                	add    %eax,%edx
+  8037c8:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8037cf:	50                   	push   %eax
+  8037d0:	e8 54 d7 ff ff       	call   800f29 <sys_futex_wake>
+	sys_env_destroy(0);
+  8037d5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8037dc:	e8 61 d3 ff ff       	call   800b42 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8037e1:	83 c4 0c             	add    $0xc,%esp
+  8037e4:	68 86 4c 80 00       	push   $0x804c86
+  8037e9:	68 a5 00 00 00       	push   $0xa5
+  8037ee:	68 a0 4c 80 00       	push   $0x804ca0
+  8037f3:	e8 cd 03 00 00       	call   803bc5 <_panic>
+
+008037f8 <pthread_start>:
+{
+  8037f8:	55                   	push   %ebp
+  8037f9:	89 e5                	mov    %esp,%ebp
+  8037fb:	53                   	push   %ebx
+  8037fc:	83 ec 04             	sub    $0x4,%esp
+  8037ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803802:	e8 86 d3 ff ff       	call   800b8d <sys_getenvid>
+  803807:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80380c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  803812:	85 db                	test   %ebx,%ebx
+  803814:	74 0c                	je     803822 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803816:	89 d9                	mov    %ebx,%ecx
+  803818:	c1 e1 10             	shl    $0x10,%ecx
+  80381b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803820:	29 ca                	sub    %ecx,%edx
+  803822:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803825:	c1 e0 04             	shl    $0x4,%eax
+  803828:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80382d:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80382f:	83 ec 0c             	sub    $0xc,%esp
+  803832:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803839:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80383c:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803843:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  80384a:	89 04 24             	mov    %eax,(%esp)
+  80384d:	e8 25 ff ff ff       	call   803777 <pthread_exit>
+
+00803852 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803852:	55                   	push   %ebp
+  803853:	89 e5                	mov    %esp,%ebp
+  803855:	57                   	push   %edi
+  803856:	56                   	push   %esi
+  803857:	53                   	push   %ebx
+  803858:	83 ec 1c             	sub    $0x1c,%esp
+  80385b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80385d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803863:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80386a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80386f:	77 0d                	ja     80387e <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803871:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803876:	29 d0                	sub    %edx,%eax
+  803878:	c1 e8 10             	shr    $0x10,%eax
+  80387b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80387e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803883:	eb 2f                	jmp    8038b4 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803885:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80388b:	8b 01                	mov    (%ecx),%eax
+  80388d:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803890:	39 c2                	cmp    %eax,%edx
+  803892:	75 14                	jne    8038a8 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803894:	83 ec 0c             	sub    $0xc,%esp
+  803897:	57                   	push   %edi
+  803898:	e8 a5 d2 ff ff       	call   800b42 <sys_env_destroy>
+  80389d:	83 c4 10             	add    $0x10,%esp
+  8038a0:	85 c0                	test   %eax,%eax
+  8038a2:	0f 88 97 00 00 00    	js     80393f <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8038a8:	83 c3 01             	add    $0x1,%ebx
+  8038ab:	83 fb 20             	cmp    $0x20,%ebx
+  8038ae:	0f 84 d2 00 00 00    	je     803986 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8038b4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8038b7:	74 ef                	je     8038a8 <pthread_kill_others+0x56>
+  8038b9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038bc:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8038c3:	8b 40 04             	mov    0x4(%eax),%eax
+  8038c6:	83 f8 01             	cmp    $0x1,%eax
+  8038c9:	75 dd                	jne    8038a8 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8038cb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038ce:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8038d5:	89 fe                	mov    %edi,%esi
+  8038d7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038dd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038e0:	c1 e0 04             	shl    $0x4,%eax
+  8038e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038e8:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8038eb:	39 c7                	cmp    %eax,%edi
+  8038ed:	75 b9                	jne    8038a8 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8038ef:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8038f2:	c1 e0 04             	shl    $0x4,%eax
+  8038f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038fa:	8b 40 54             	mov    0x54(%eax),%eax
+  8038fd:	85 c0                	test   %eax,%eax
+  8038ff:	74 a7                	je     8038a8 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803901:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803904:	c1 e0 04             	shl    $0x4,%eax
+  803907:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80390d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80390f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803915:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80391a:	0f 87 65 ff ff ff    	ja     803885 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803920:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803925:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803927:	c1 e8 10             	shr    $0x10,%eax
+  80392a:	0f 84 55 ff ff ff    	je     803885 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803930:	c1 e0 10             	shl    $0x10,%eax
+  803933:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803938:	29 c1                	sub    %eax,%ecx
+  80393a:	e9 4c ff ff ff       	jmp    80388b <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80393f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803942:	c1 e2 04             	shl    $0x4,%edx
+  803945:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80394b:	8b 52 48             	mov    0x48(%edx),%edx
+  80394e:	39 fa                	cmp    %edi,%edx
+  803950:	0f 85 52 ff ff ff    	jne    8038a8 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803956:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803959:	c1 e2 04             	shl    $0x4,%edx
+  80395c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803962:	8b 52 54             	mov    0x54(%edx),%edx
+  803965:	85 d2                	test   %edx,%edx
+  803967:	0f 84 3b ff ff ff    	je     8038a8 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80396d:	83 ec 0c             	sub    $0xc,%esp
+  803970:	50                   	push   %eax
+  803971:	57                   	push   %edi
+  803972:	68 b0 4c 80 00       	push   $0x804cb0
+  803977:	68 bb 00 00 00       	push   $0xbb
+  80397c:	68 a0 4c 80 00       	push   $0x804ca0
+  803981:	e8 3f 02 00 00       	call   803bc5 <_panic>
+	}
+}
+  803986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803989:	5b                   	pop    %ebx
+  80398a:	5e                   	pop    %esi
+  80398b:	5f                   	pop    %edi
+  80398c:	5d                   	pop    %ebp
+  80398d:	c3                   	ret
+
+0080398e <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80398e:	55                   	push   %ebp
+  80398f:	89 e5                	mov    %esp,%ebp
+  803991:	53                   	push   %ebx
+  803992:	83 ec 04             	sub    $0x4,%esp
+  803995:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803997:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80399d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8039a3:	0f 87 85 00 00 00    	ja     803a2e <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039a9:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8039ae:	29 c3                	sub    %eax,%ebx
+  8039b0:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8039b3:	83 ec 04             	sub    $0x4,%esp
+  8039b6:	68 80 02 00 00       	push   $0x280
+  8039bb:	6a 00                	push   $0x0
+  8039bd:	68 40 60 80 00       	push   $0x806040
+  8039c2:	e8 31 cf ff ff       	call   8008f8 <memset>
+	threads_mu.m_state = 0;
+  8039c7:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8039ce:	00 00 00 
+	if (self != 0) {
+  8039d1:	83 c4 10             	add    $0x10,%esp
+  8039d4:	85 db                	test   %ebx,%ebx
+  8039d6:	74 51                	je     803a29 <pthread_fork_child+0x9b>
+  8039d8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039da:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8039e0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039e5:	77 18                	ja     8039ff <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039e7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039ec:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8039ee:	c1 e8 10             	shr    $0x10,%eax
+  8039f1:	74 0c                	je     8039ff <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039f3:	c1 e0 10             	shl    $0x10,%eax
+  8039f6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8039fb:	29 c2                	sub    %eax,%edx
+  8039fd:	eb 06                	jmp    803a05 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8039ff:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803a05:	8b 02                	mov    (%edx),%eax
+  803a07:	8b 48 48             	mov    0x48(%eax),%ecx
+  803a0a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803a11:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803a14:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803a1b:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803a22:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a2c:	c9                   	leave
+  803a2d:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803a2e:	83 ec 04             	sub    $0x4,%esp
+  803a31:	68 80 02 00 00       	push   $0x280
+  803a36:	6a 00                	push   $0x0
+  803a38:	68 40 60 80 00       	push   $0x806040
+  803a3d:	e8 b6 ce ff ff       	call   8008f8 <memset>
+	threads_mu.m_state = 0;
+  803a42:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a49:	00 00 00 
+  803a4c:	83 c4 10             	add    $0x10,%esp
+  803a4f:	eb d8                	jmp    803a29 <pthread_fork_child+0x9b>
+
+00803a51 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a56:	c3                   	ret
+
+00803a57 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a57:	55                   	push   %ebp
+  803a58:	89 e5                	mov    %esp,%ebp
+  803a5a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803a5d:	68 d5 4c 80 00       	push   $0x804cd5
+  803a62:	ff 75 0c             	push   0xc(%ebp)
+  803a65:	e8 3d cd ff ff       	call   8007a7 <strcpy>
+	return 0;
+}
+  803a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6f:	c9                   	leave
+  803a70:	c3                   	ret
+
+00803a71 <devcons_write>:
+{
+  803a71:	55                   	push   %ebp
+  803a72:	89 e5                	mov    %esp,%ebp
+  803a74:	57                   	push   %edi
+  803a75:	56                   	push   %esi
+  803a76:	53                   	push   %ebx
+  803a77:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803a7d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803a82:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803a88:	eb 2e                	jmp    803ab8 <devcons_write+0x47>
+		m = n - tot;
+  803a8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a8d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803a8f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a94:	39 c3                	cmp    %eax,%ebx
+  803a96:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a99:	83 ec 04             	sub    $0x4,%esp
+  803a9c:	53                   	push   %ebx
+  803a9d:	89 f0                	mov    %esi,%eax
+  803a9f:	03 45 0c             	add    0xc(%ebp),%eax
+  803aa2:	50                   	push   %eax
+  803aa3:	57                   	push   %edi
+  803aa4:	e8 84 ce ff ff       	call   80092d <memmove>
+		sys_cputs(buf, m);
+  803aa9:	83 c4 08             	add    $0x8,%esp
+  803aac:	53                   	push   %ebx
+  803aad:	57                   	push   %edi
+  803aae:	e8 38 d0 ff ff       	call   800aeb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803ab3:	01 de                	add    %ebx,%esi
+  803ab5:	83 c4 10             	add    $0x10,%esp
+  803ab8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803abb:	72 cd                	jb     803a8a <devcons_write+0x19>
+}
+  803abd:	89 f0                	mov    %esi,%eax
+  803abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac2:	5b                   	pop    %ebx
+  803ac3:	5e                   	pop    %esi
+  803ac4:	5f                   	pop    %edi
+  803ac5:	5d                   	pop    %ebp
+  803ac6:	c3                   	ret
+
+00803ac7 <devcons_read>:
+{
+  803ac7:	55                   	push   %ebp
+  803ac8:	89 e5                	mov    %esp,%ebp
+  803aca:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803ad6:	75 07                	jne    803adf <devcons_read+0x18>
+  803ad8:	eb 1f                	jmp    803af9 <devcons_read+0x32>
+		sys_yield();
+  803ada:	e8 da d0 ff ff       	call   800bb9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803adf:	e8 32 d0 ff ff       	call   800b16 <sys_cgetc>
+  803ae4:	85 c0                	test   %eax,%eax
+  803ae6:	74 f2                	je     803ada <devcons_read+0x13>
+	if (c < 0)
+  803ae8:	78 0f                	js     803af9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803aea:	83 f8 04             	cmp    $0x4,%eax
+  803aed:	74 0c                	je     803afb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803aef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803af2:	88 02                	mov    %al,(%edx)
+	return 1;
+  803af4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803af9:	c9                   	leave
+  803afa:	c3                   	ret
+		return 0;
+  803afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b00:	eb f7                	jmp    803af9 <devcons_read+0x32>
+
+00803b02 <cputchar>:
+{
+  803b02:	55                   	push   %ebp
+  803b03:	89 e5                	mov    %esp,%ebp
+  803b05:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b0b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803b0e:	6a 01                	push   $0x1
+  803b10:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b13:	50                   	push   %eax
+  803b14:	e8 d2 cf ff ff       	call   800aeb <sys_cputs>
+}
+  803b19:	83 c4 10             	add    $0x10,%esp
+  803b1c:	c9                   	leave
+  803b1d:	c3                   	ret
+
+00803b1e <getchar>:
+{
+  803b1e:	55                   	push   %ebp
+  803b1f:	89 e5                	mov    %esp,%ebp
+  803b21:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803b24:	6a 01                	push   $0x1
+  803b26:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b29:	50                   	push   %eax
+  803b2a:	6a 00                	push   $0x0
+  803b2c:	e8 63 d8 ff ff       	call   801394 <read>
+	if (r < 0)
+  803b31:	83 c4 10             	add    $0x10,%esp
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	78 06                	js     803b3e <getchar+0x20>
+	if (r < 1)
+  803b38:	74 06                	je     803b40 <getchar+0x22>
+	return c;
+  803b3a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b3e:	c9                   	leave
+  803b3f:	c3                   	ret
+		return -E_EOF;
+  803b40:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b45:	eb f7                	jmp    803b3e <getchar+0x20>
+
+00803b47 <iscons>:
+{
+  803b47:	55                   	push   %ebp
+  803b48:	89 e5                	mov    %esp,%ebp
+  803b4a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b50:	50                   	push   %eax
+  803b51:	ff 75 08             	push   0x8(%ebp)
+  803b54:	e8 ab d5 ff ff       	call   801104 <fd_lookup>
+  803b59:	83 c4 10             	add    $0x10,%esp
+  803b5c:	85 c0                	test   %eax,%eax
+  803b5e:	78 11                	js     803b71 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b63:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803b69:	39 10                	cmp    %edx,(%eax)
+  803b6b:	0f 94 c0             	sete   %al
+  803b6e:	0f b6 c0             	movzbl %al,%eax
+}
+  803b71:	c9                   	leave
+  803b72:	c3                   	ret
+
+00803b73 <opencons>:
+{
+  803b73:	55                   	push   %ebp
+  803b74:	89 e5                	mov    %esp,%ebp
+  803b76:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803b79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b7c:	50                   	push   %eax
+  803b7d:	e8 2c d5 ff ff       	call   8010ae <fd_alloc>
+  803b82:	83 c4 10             	add    $0x10,%esp
+  803b85:	85 c0                	test   %eax,%eax
+  803b87:	78 3a                	js     803bc3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803b89:	83 ec 04             	sub    $0x4,%esp
+  803b8c:	68 07 04 00 00       	push   $0x407
+  803b91:	ff 75 f4             	push   -0xc(%ebp)
+  803b94:	6a 00                	push   $0x0
+  803b96:	e8 4a d0 ff ff       	call   800be5 <sys_page_alloc>
+  803b9b:	83 c4 10             	add    $0x10,%esp
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	78 21                	js     803bc3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803ba2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ba5:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803bab:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803bad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bb0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803bb7:	83 ec 0c             	sub    $0xc,%esp
+  803bba:	50                   	push   %eax
+  803bbb:	e8 c7 d4 ff ff       	call   801087 <fd2num>
+  803bc0:	83 c4 10             	add    $0x10,%esp
+}
+  803bc3:	c9                   	leave
+  803bc4:	c3                   	ret
+
+00803bc5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803bc5:	55                   	push   %ebp
+  803bc6:	89 e5                	mov    %esp,%ebp
+  803bc8:	56                   	push   %esi
+  803bc9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803bca:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803bcd:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803bd3:	e8 b5 cf ff ff       	call   800b8d <sys_getenvid>
+  803bd8:	83 ec 0c             	sub    $0xc,%esp
+  803bdb:	ff 75 0c             	push   0xc(%ebp)
+  803bde:	ff 75 08             	push   0x8(%ebp)
+  803be1:	56                   	push   %esi
+  803be2:	50                   	push   %eax
+  803be3:	68 e4 4c 80 00       	push   $0x804ce4
+  803be8:	e8 d6 c5 ff ff       	call   8001c3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803bed:	83 c4 18             	add    $0x18,%esp
+  803bf0:	53                   	push   %ebx
+  803bf1:	ff 75 10             	push   0x10(%ebp)
+  803bf4:	e8 79 c5 ff ff       	call   800172 <vcprintf>
+	cprintf("\n");
+  803bf9:	c7 04 24 42 4e 80 00 	movl   $0x804e42,(%esp)
+  803c00:	e8 be c5 ff ff       	call   8001c3 <cprintf>
+  803c05:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803c08:	cc                   	int3
+	while (1)
+  803c09:	eb fd                	jmp    803c08 <_panic+0x43>
+
+00803c0b <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c0b:	55                   	push   %ebp
+  803c0c:	89 e5                	mov    %esp,%ebp
+  803c0e:	57                   	push   %edi
+  803c0f:	56                   	push   %esi
+  803c10:	53                   	push   %ebx
+  803c11:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c14:	89 d6                	mov    %edx,%esi
+  803c16:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c19:	89 cf                	mov    %ecx,%edi
+  803c1b:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c1e:	89 fa                	mov    %edi,%edx
+  803c20:	80 ce 08             	or     $0x8,%dh
+  803c23:	f6 c5 08             	test   $0x8,%ch
+  803c26:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c29:	57                   	push   %edi
+  803c2a:	56                   	push   %esi
+  803c2b:	50                   	push   %eax
+  803c2c:	56                   	push   %esi
+  803c2d:	6a 00                	push   $0x0
+  803c2f:	e8 fe cf ff ff       	call   800c32 <sys_page_map>
+	if (r < 0) {
+  803c34:	83 c4 20             	add    $0x20,%esp
+  803c37:	85 c0                	test   %eax,%eax
+  803c39:	78 27                	js     803c62 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c3b:	83 ec 0c             	sub    $0xc,%esp
+  803c3e:	57                   	push   %edi
+  803c3f:	56                   	push   %esi
+  803c40:	6a 00                	push   $0x0
+  803c42:	56                   	push   %esi
+  803c43:	6a 00                	push   $0x0
+  803c45:	e8 e8 cf ff ff       	call   800c32 <sys_page_map>
+  803c4a:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c4c:	83 c4 20             	add    $0x20,%esp
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	78 24                	js     803c77 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c58:	89 d8                	mov    %ebx,%eax
+  803c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c5d:	5b                   	pop    %ebx
+  803c5e:	5e                   	pop    %esi
+  803c5f:	5f                   	pop    %edi
+  803c60:	5d                   	pop    %ebp
+  803c61:	c3                   	ret
+  803c62:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c64:	83 ec 08             	sub    $0x8,%esp
+  803c67:	50                   	push   %eax
+  803c68:	68 08 4d 80 00       	push   $0x804d08
+  803c6d:	e8 51 c5 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803c72:	83 c4 10             	add    $0x10,%esp
+  803c75:	eb e1                	jmp    803c58 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c77:	83 ec 08             	sub    $0x8,%esp
+  803c7a:	50                   	push   %eax
+  803c7b:	68 38 4d 80 00       	push   $0x804d38
+  803c80:	e8 3e c5 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803c85:	83 c4 10             	add    $0x10,%esp
+  803c88:	eb ce                	jmp    803c58 <duppage_cow+0x4d>
+
+00803c8a <duppage>:
+{
+  803c8a:	55                   	push   %ebp
+  803c8b:	89 e5                	mov    %esp,%ebp
+  803c8d:	53                   	push   %ebx
+  803c8e:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c91:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c94:	51                   	push   %ecx
+  803c95:	52                   	push   %edx
+  803c96:	50                   	push   %eax
+  803c97:	52                   	push   %edx
+  803c98:	6a 00                	push   $0x0
+  803c9a:	e8 93 cf ff ff       	call   800c32 <sys_page_map>
+	if (r < 0) {
+  803c9f:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803ca7:	85 c0                	test   %eax,%eax
+  803ca9:	78 07                	js     803cb2 <duppage+0x28>
+}
+  803cab:	89 d8                	mov    %ebx,%eax
+  803cad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cb0:	c9                   	leave
+  803cb1:	c3                   	ret
+  803cb2:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cb4:	83 ec 08             	sub    $0x8,%esp
+  803cb7:	50                   	push   %eax
+  803cb8:	68 08 4d 80 00       	push   $0x804d08
+  803cbd:	e8 01 c5 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803cc2:	83 c4 10             	add    $0x10,%esp
+  803cc5:	eb e4                	jmp    803cab <duppage+0x21>
+
+00803cc7 <cow_copy>:
+{
+  803cc7:	55                   	push   %ebp
+  803cc8:	89 e5                	mov    %esp,%ebp
+  803cca:	56                   	push   %esi
+  803ccb:	53                   	push   %ebx
+  803ccc:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803cce:	83 ec 04             	sub    $0x4,%esp
+  803cd1:	6a 07                	push   $0x7
+  803cd3:	68 00 f0 7f 00       	push   $0x7ff000
+  803cd8:	6a 00                	push   $0x0
+  803cda:	e8 06 cf ff ff       	call   800be5 <sys_page_alloc>
+	if (r < 0) {
+  803cdf:	83 c4 10             	add    $0x10,%esp
+  803ce2:	85 c0                	test   %eax,%eax
+  803ce4:	78 58                	js     803d3e <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803ce6:	83 ec 04             	sub    $0x4,%esp
+  803ce9:	68 00 10 00 00       	push   $0x1000
+  803cee:	56                   	push   %esi
+  803cef:	68 00 f0 7f 00       	push   $0x7ff000
+  803cf4:	e8 34 cc ff ff       	call   80092d <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803cf9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d00:	56                   	push   %esi
+  803d01:	6a 00                	push   $0x0
+  803d03:	68 00 f0 7f 00       	push   $0x7ff000
+  803d08:	6a 00                	push   $0x0
+  803d0a:	e8 23 cf ff ff       	call   800c32 <sys_page_map>
+  803d0f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d11:	83 c4 20             	add    $0x20,%esp
+  803d14:	85 c0                	test   %eax,%eax
+  803d16:	78 3b                	js     803d53 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d18:	83 ec 08             	sub    $0x8,%esp
+  803d1b:	68 00 f0 7f 00       	push   $0x7ff000
+  803d20:	6a 00                	push   $0x0
+  803d22:	e8 57 cf ff ff       	call   800c7e <sys_page_unmap>
+  803d27:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d29:	83 c4 10             	add    $0x10,%esp
+  803d2c:	85 c0                	test   %eax,%eax
+  803d2e:	78 45                	js     803d75 <cow_copy+0xae>
+	return 0;
+  803d30:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d35:	89 d8                	mov    %ebx,%eax
+  803d37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d3a:	5b                   	pop    %ebx
+  803d3b:	5e                   	pop    %esi
+  803d3c:	5d                   	pop    %ebp
+  803d3d:	c3                   	ret
+  803d3e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d40:	83 ec 08             	sub    $0x8,%esp
+  803d43:	50                   	push   %eax
+  803d44:	68 28 4e 80 00       	push   $0x804e28
+  803d49:	e8 75 c4 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803d4e:	83 c4 10             	add    $0x10,%esp
+  803d51:	eb e2                	jmp    803d35 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803d53:	83 ec 08             	sub    $0x8,%esp
+  803d56:	50                   	push   %eax
+  803d57:	68 44 4e 80 00       	push   $0x804e44
+  803d5c:	e8 62 c4 ff ff       	call   8001c3 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d61:	83 c4 08             	add    $0x8,%esp
+  803d64:	68 00 f0 7f 00       	push   $0x7ff000
+  803d69:	6a 00                	push   $0x0
+  803d6b:	e8 0e cf ff ff       	call   800c7e <sys_page_unmap>
+		return r;
+  803d70:	83 c4 10             	add    $0x10,%esp
+  803d73:	eb c0                	jmp    803d35 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d75:	83 ec 08             	sub    $0x8,%esp
+  803d78:	50                   	push   %eax
+  803d79:	68 60 4d 80 00       	push   $0x804d60
+  803d7e:	e8 40 c4 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803d83:	83 c4 10             	add    $0x10,%esp
+  803d86:	eb ad                	jmp    803d35 <cow_copy+0x6e>
+
+00803d88 <pgfault>:
+{
+  803d88:	55                   	push   %ebp
+  803d89:	89 e5                	mov    %esp,%ebp
+  803d8b:	56                   	push   %esi
+  803d8c:	53                   	push   %ebx
+  803d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d90:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d92:	89 d8                	mov    %ebx,%eax
+  803d94:	c1 e8 16             	shr    $0x16,%eax
+  803d97:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d9e:	89 de                	mov    %ebx,%esi
+  803da0:	c1 ee 0c             	shr    $0xc,%esi
+  803da3:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803daa:	a8 07                	test   $0x7,%al
+  803dac:	74 3b                	je     803de9 <pgfault+0x61>
+  803dae:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803db4:	74 33                	je     803de9 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803db6:	83 ec 0c             	sub    $0xc,%esp
+  803db9:	68 00 f0 bf ee       	push   $0xeebff000
+  803dbe:	e8 82 f4 ff ff       	call   803245 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803dc3:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803dca:	83 c4 10             	add    $0x10,%esp
+  803dcd:	f6 c4 08             	test   $0x8,%ah
+  803dd0:	75 30                	jne    803e02 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803dd2:	83 ec 0c             	sub    $0xc,%esp
+  803dd5:	68 00 f0 bf ee       	push   $0xeebff000
+  803dda:	e8 d3 f4 ff ff       	call   8032b2 <mutex_unlock>
+}
+  803ddf:	83 c4 10             	add    $0x10,%esp
+  803de2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803de5:	5b                   	pop    %ebx
+  803de6:	5e                   	pop    %esi
+  803de7:	5d                   	pop    %ebp
+  803de8:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803de9:	83 ec 08             	sub    $0x8,%esp
+  803dec:	ff 72 28             	push   0x28(%edx)
+  803def:	51                   	push   %ecx
+  803df0:	50                   	push   %eax
+  803df1:	68 84 4d 80 00       	push   $0x804d84
+  803df6:	6a 3f                	push   $0x3f
+  803df8:	68 5e 4e 80 00       	push   $0x804e5e
+  803dfd:	e8 c3 fd ff ff       	call   803bc5 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e02:	89 d8                	mov    %ebx,%eax
+  803e04:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e09:	e8 b9 fe ff ff       	call   803cc7 <cow_copy>
+  803e0e:	eb c2                	jmp    803dd2 <pgfault+0x4a>
+
+00803e10 <cow_enable>:
+{
+  803e10:	55                   	push   %ebp
+  803e11:	89 e5                	mov    %esp,%ebp
+  803e13:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e16:	68 88 3d 80 00       	push   $0x803d88
+  803e1b:	e8 28 06 00 00       	call   804448 <set_pgfault_handler>
+}
+  803e20:	83 c4 10             	add    $0x10,%esp
+  803e23:	c9                   	leave
+  803e24:	c3                   	ret
+
+00803e25 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e25:	55                   	push   %ebp
+  803e26:	89 e5                	mov    %esp,%ebp
+  803e28:	57                   	push   %edi
+  803e29:	56                   	push   %esi
+  803e2a:	53                   	push   %ebx
+  803e2b:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e2e:	68 88 3d 80 00       	push   $0x803d88
+  803e33:	e8 10 06 00 00       	call   804448 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e38:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e3d:	cd 30                	int    $0x30
+  803e3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e42:	83 c4 10             	add    $0x10,%esp
+  803e45:	85 c0                	test   %eax,%eax
+  803e47:	78 4b                	js     803e94 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e49:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e53:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e56:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e5a:	0f 85 16 01 00 00    	jne    803f76 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e60:	e8 28 cd ff ff       	call   800b8d <sys_getenvid>
+  803e65:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e6a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e6c:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e72:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e78:	77 32                	ja     803eac <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e7a:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e7f:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e81:	c1 ea 10             	shr    $0x10,%edx
+  803e84:	74 26                	je     803eac <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e86:	c1 e2 10             	shl    $0x10,%edx
+  803e89:	89 d1                	mov    %edx,%ecx
+  803e8b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e90:	29 ca                	sub    %ecx,%edx
+  803e92:	eb 1e                	jmp    803eb2 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e94:	83 ec 08             	sub    $0x8,%esp
+  803e97:	89 c7                	mov    %eax,%edi
+  803e99:	50                   	push   %eax
+  803e9a:	68 69 4e 80 00       	push   $0x804e69
+  803e9f:	e8 1f c3 ff ff       	call   8001c3 <cprintf>
+		return eid;
+  803ea4:	83 c4 10             	add    $0x10,%esp
+  803ea7:	e9 6c 01 00 00       	jmp    804018 <fork+0x1f3>
+		return pthread_main_tls;
+  803eac:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803eb2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803eb5:	c1 e0 04             	shl    $0x4,%eax
+  803eb8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ebd:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803ebf:	e8 ca fa ff ff       	call   80398e <pthread_fork_child>
+		return eid;
+  803ec4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803ec7:	e9 4c 01 00 00       	jmp    804018 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ecc:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803ed2:	89 da                	mov    %ebx,%edx
+  803ed4:	89 f8                	mov    %edi,%eax
+  803ed6:	e8 af fd ff ff       	call   803c8a <duppage>
+  803edb:	85 c0                	test   %eax,%eax
+  803edd:	79 28                	jns    803f07 <fork+0xe2>
+  803edf:	89 c7                	mov    %eax,%edi
+  803ee1:	e9 32 01 00 00       	jmp    804018 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ee6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803eec:	83 f9 05             	cmp    $0x5,%ecx
+  803eef:	75 58                	jne    803f49 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803ef1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ef6:	89 da                	mov    %ebx,%edx
+  803ef8:	89 f8                	mov    %edi,%eax
+  803efa:	e8 8b fd ff ff       	call   803c8a <duppage>
+  803eff:	85 c0                	test   %eax,%eax
+  803f01:	0f 88 0f 01 00 00    	js     804016 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f07:	83 c3 01             	add    $0x1,%ebx
+  803f0a:	39 de                	cmp    %ebx,%esi
+  803f0c:	74 54                	je     803f62 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f0e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f15:	f6 c1 05             	test   $0x5,%cl
+  803f18:	74 ed                	je     803f07 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f1a:	f6 c5 04             	test   $0x4,%ch
+  803f1d:	75 ad                	jne    803ecc <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f1f:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f25:	74 bf                	je     803ee6 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f27:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f2d:	74 d8                	je     803f07 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f2f:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f35:	89 da                	mov    %ebx,%edx
+  803f37:	89 f8                	mov    %edi,%eax
+  803f39:	e8 cd fc ff ff       	call   803c0b <duppage_cow>
+  803f3e:	85 c0                	test   %eax,%eax
+  803f40:	79 c5                	jns    803f07 <fork+0xe2>
+  803f42:	89 c7                	mov    %eax,%edi
+  803f44:	e9 cf 00 00 00       	jmp    804018 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f49:	68 b4 4d 80 00       	push   $0x804db4
+  803f4e:	68 9d 4b 80 00       	push   $0x804b9d
+  803f53:	68 c6 00 00 00       	push   $0xc6
+  803f58:	68 5e 4e 80 00       	push   $0x804e5e
+  803f5d:	e8 63 fc ff ff       	call   803bc5 <_panic>
+  803f62:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f65:	83 c1 01             	add    $0x1,%ecx
+  803f68:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f6e:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f74:	74 18                	je     803f8e <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f76:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f7d:	a8 07                	test   $0x7,%al
+  803f7f:	74 e4                	je     803f65 <fork+0x140>
+  803f81:	89 cb                	mov    %ecx,%ebx
+  803f83:	c1 e3 0a             	shl    $0xa,%ebx
+  803f86:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f89:	e9 7c ff ff ff       	jmp    803f0a <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f8e:	83 ec 04             	sub    $0x4,%esp
+  803f91:	6a 07                	push   $0x7
+  803f93:	68 00 f0 bf ee       	push   $0xeebff000
+  803f98:	ff 75 e4             	push   -0x1c(%ebp)
+  803f9b:	e8 45 cc ff ff       	call   800be5 <sys_page_alloc>
+  803fa0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fa2:	83 c4 10             	add    $0x10,%esp
+  803fa5:	85 c0                	test   %eax,%eax
+  803fa7:	78 34                	js     803fdd <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803fa9:	83 ec 08             	sub    $0x8,%esp
+  803fac:	68 86 44 80 00       	push   $0x804486
+  803fb1:	ff 75 e4             	push   -0x1c(%ebp)
+  803fb4:	e8 a9 cd ff ff       	call   800d62 <sys_env_set_pgfault_upcall>
+  803fb9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fbb:	83 c4 10             	add    $0x10,%esp
+  803fbe:	85 c0                	test   %eax,%eax
+  803fc0:	78 2e                	js     803ff0 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803fc2:	83 ec 08             	sub    $0x8,%esp
+  803fc5:	6a 02                	push   $0x2
+  803fc7:	ff 75 e4             	push   -0x1c(%ebp)
+  803fca:	e8 fb cc ff ff       	call   800cca <sys_env_set_status>
+  803fcf:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803fd1:	83 c4 10             	add    $0x10,%esp
+  803fd4:	85 c0                	test   %eax,%eax
+  803fd6:	78 2b                	js     804003 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803fd8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fdb:	eb 3b                	jmp    804018 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803fdd:	83 ec 08             	sub    $0x8,%esp
+  803fe0:	50                   	push   %eax
+  803fe1:	68 dc 4d 80 00       	push   $0x804ddc
+  803fe6:	e8 d8 c1 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803feb:	83 c4 10             	add    $0x10,%esp
+  803fee:	eb 28                	jmp    804018 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803ff0:	83 ec 08             	sub    $0x8,%esp
+  803ff3:	50                   	push   %eax
+  803ff4:	68 04 4e 80 00       	push   $0x804e04
+  803ff9:	e8 c5 c1 ff ff       	call   8001c3 <cprintf>
+		return r;
+  803ffe:	83 c4 10             	add    $0x10,%esp
+  804001:	eb 15                	jmp    804018 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804003:	83 ec 08             	sub    $0x8,%esp
+  804006:	50                   	push   %eax
+  804007:	68 79 4e 80 00       	push   $0x804e79
+  80400c:	e8 b2 c1 ff ff       	call   8001c3 <cprintf>
+		return r;
+  804011:	83 c4 10             	add    $0x10,%esp
+  804014:	eb 02                	jmp    804018 <fork+0x1f3>
+  804016:	89 c7                	mov    %eax,%edi
+}
+  804018:	89 f8                	mov    %edi,%eax
+  80401a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80401d:	5b                   	pop    %ebx
+  80401e:	5e                   	pop    %esi
+  80401f:	5f                   	pop    %edi
+  804020:	5d                   	pop    %ebp
+  804021:	c3                   	ret
+
+00804022 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804022:	55                   	push   %ebp
+  804023:	89 e5                	mov    %esp,%ebp
+  804025:	57                   	push   %edi
+  804026:	56                   	push   %esi
+  804027:	53                   	push   %ebx
+  804028:	83 ec 2c             	sub    $0x2c,%esp
+  80402b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80402d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804033:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804038:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80403e:	77 0a                	ja     80404a <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804040:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804045:	29 c3                	sub    %eax,%ebx
+  804047:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80404a:	83 ec 0c             	sub    $0xc,%esp
+  80404d:	68 88 3d 80 00       	push   $0x803d88
+  804052:	e8 f1 03 00 00       	call   804448 <set_pgfault_handler>
+  804057:	b8 07 00 00 00       	mov    $0x7,%eax
+  80405c:	cd 30                	int    $0x30
+  80405e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804061:	83 c4 10             	add    $0x10,%esp
+  804064:	85 c0                	test   %eax,%eax
+  804066:	78 30                	js     804098 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804068:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80406c:	74 42                	je     8040b0 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80406e:	c1 e3 10             	shl    $0x10,%ebx
+  804071:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804076:	29 d8                	sub    %ebx,%eax
+  804078:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80407b:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804080:	29 d8                	sub    %ebx,%eax
+  804082:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804085:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80408a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408f:	89 f7                	mov    %esi,%edi
+  804091:	89 d6                	mov    %edx,%esi
+  804093:	e9 2c 01 00 00       	jmp    8041c4 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804098:	83 ec 08             	sub    $0x8,%esp
+  80409b:	89 c7                	mov    %eax,%edi
+  80409d:	50                   	push   %eax
+  80409e:	68 69 4e 80 00       	push   $0x804e69
+  8040a3:	e8 1b c1 ff ff       	call   8001c3 <cprintf>
+		return eid;
+  8040a8:	83 c4 10             	add    $0x10,%esp
+  8040ab:	e9 d5 00 00 00       	jmp    804185 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8040b0:	e8 d8 ca ff ff       	call   800b8d <sys_getenvid>
+  8040b5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040ba:	89 c2                	mov    %eax,%edx
+  8040bc:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040be:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8040c4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040c9:	77 18                	ja     8040e3 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040cb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040d0:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040d2:	c1 e8 10             	shr    $0x10,%eax
+  8040d5:	74 0c                	je     8040e3 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040d7:	c1 e0 10             	shl    $0x10,%eax
+  8040da:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040df:	29 c1                	sub    %eax,%ecx
+  8040e1:	eb 06                	jmp    8040e9 <sfork+0xc7>
+		return pthread_main_tls;
+  8040e3:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8040e9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040ec:	c1 e0 04             	shl    $0x4,%eax
+  8040ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040f4:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040f6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040f9:	e9 87 00 00 00       	jmp    804185 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040fe:	f6 c5 04             	test   $0x4,%ch
+  804101:	74 6c                	je     80416f <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804103:	89 ca                	mov    %ecx,%edx
+  804105:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80410b:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804111:	74 7c                	je     80418f <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804113:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804119:	89 da                	mov    %ebx,%edx
+  80411b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80411e:	e8 67 fb ff ff       	call   803c8a <duppage>
+  804123:	85 c0                	test   %eax,%eax
+  804125:	0f 88 4f 01 00 00    	js     80427a <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80412b:	83 c3 01             	add    $0x1,%ebx
+  80412e:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804131:	74 7a                	je     8041ad <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804133:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804135:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80413c:	f6 c1 01             	test   $0x1,%cl
+  80413f:	74 ea                	je     80412b <sfork+0x109>
+  804141:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804147:	74 e2                	je     80412b <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804149:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80414f:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804152:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804157:	76 a5                	jbe    8040fe <sfork+0xdc>
+  804159:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80415f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804162:	39 fa                	cmp    %edi,%edx
+  804164:	73 9d                	jae    804103 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804166:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804169:	39 fa                	cmp    %edi,%edx
+  80416b:	72 96                	jb     804103 <sfork+0xe1>
+  80416d:	eb 8f                	jmp    8040fe <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80416f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804175:	89 da                	mov    %ebx,%edx
+  804177:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80417a:	e8 8c fa ff ff       	call   803c0b <duppage_cow>
+  80417f:	85 c0                	test   %eax,%eax
+  804181:	79 a8                	jns    80412b <sfork+0x109>
+  804183:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804185:	89 f8                	mov    %edi,%eax
+  804187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80418a:	5b                   	pop    %ebx
+  80418b:	5e                   	pop    %esi
+  80418c:	5f                   	pop    %edi
+  80418d:	5d                   	pop    %ebp
+  80418e:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80418f:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804194:	e8 2e fb ff ff       	call   803cc7 <cow_copy>
+  804199:	85 c0                	test   %eax,%eax
+  80419b:	0f 88 d2 00 00 00    	js     804273 <sfork+0x251>
+				pte = uvpt[pn];
+  8041a1:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8041a8:	e9 66 ff ff ff       	jmp    804113 <sfork+0xf1>
+  8041ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8041b0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041b3:	83 c6 01             	add    $0x1,%esi
+  8041b6:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8041bc:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8041c2:	74 1b                	je     8041df <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8041c4:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8041cb:	a8 01                	test   $0x1,%al
+  8041cd:	74 e4                	je     8041b3 <sfork+0x191>
+  8041cf:	89 f3                	mov    %esi,%ebx
+  8041d1:	c1 e3 0a             	shl    $0xa,%ebx
+  8041d4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8041d7:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8041da:	e9 4f ff ff ff       	jmp    80412e <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041df:	83 ec 04             	sub    $0x4,%esp
+  8041e2:	6a 07                	push   $0x7
+  8041e4:	68 00 f0 bf ee       	push   $0xeebff000
+  8041e9:	ff 75 e0             	push   -0x20(%ebp)
+  8041ec:	e8 f4 c9 ff ff       	call   800be5 <sys_page_alloc>
+  8041f1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041f3:	83 c4 10             	add    $0x10,%esp
+  8041f6:	85 c0                	test   %eax,%eax
+  8041f8:	78 37                	js     804231 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041fa:	83 ec 08             	sub    $0x8,%esp
+  8041fd:	68 86 44 80 00       	push   $0x804486
+  804202:	ff 75 e0             	push   -0x20(%ebp)
+  804205:	e8 58 cb ff ff       	call   800d62 <sys_env_set_pgfault_upcall>
+  80420a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80420c:	83 c4 10             	add    $0x10,%esp
+  80420f:	85 c0                	test   %eax,%eax
+  804211:	78 34                	js     804247 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804213:	83 ec 08             	sub    $0x8,%esp
+  804216:	6a 02                	push   $0x2
+  804218:	ff 75 e0             	push   -0x20(%ebp)
+  80421b:	e8 aa ca ff ff       	call   800cca <sys_env_set_status>
+  804220:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804222:	83 c4 10             	add    $0x10,%esp
+  804225:	85 c0                	test   %eax,%eax
+  804227:	78 34                	js     80425d <sfork+0x23b>
+	return eid;
+  804229:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80422c:	e9 54 ff ff ff       	jmp    804185 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804231:	83 ec 08             	sub    $0x8,%esp
+  804234:	50                   	push   %eax
+  804235:	68 dc 4d 80 00       	push   $0x804ddc
+  80423a:	e8 84 bf ff ff       	call   8001c3 <cprintf>
+		return r;
+  80423f:	83 c4 10             	add    $0x10,%esp
+  804242:	e9 3e ff ff ff       	jmp    804185 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804247:	83 ec 08             	sub    $0x8,%esp
+  80424a:	50                   	push   %eax
+  80424b:	68 04 4e 80 00       	push   $0x804e04
+  804250:	e8 6e bf ff ff       	call   8001c3 <cprintf>
+		return r;
+  804255:	83 c4 10             	add    $0x10,%esp
+  804258:	e9 28 ff ff ff       	jmp    804185 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80425d:	83 ec 08             	sub    $0x8,%esp
+  804260:	50                   	push   %eax
+  804261:	68 79 4e 80 00       	push   $0x804e79
+  804266:	e8 58 bf ff ff       	call   8001c3 <cprintf>
+		return r;
+  80426b:	83 c4 10             	add    $0x10,%esp
+  80426e:	e9 12 ff ff ff       	jmp    804185 <sfork+0x163>
+  804273:	89 c7                	mov    %eax,%edi
+  804275:	e9 0b ff ff ff       	jmp    804185 <sfork+0x163>
+  80427a:	89 c7                	mov    %eax,%edi
+  80427c:	e9 04 ff ff ff       	jmp    804185 <sfork+0x163>
+
+00804281 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804281:	55                   	push   %ebp
+  804282:	89 e5                	mov    %esp,%ebp
+  804284:	57                   	push   %edi
+  804285:	56                   	push   %esi
+  804286:	53                   	push   %ebx
+  804287:	83 ec 18             	sub    $0x18,%esp
+  80428a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80428d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804290:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804293:	85 c0                	test   %eax,%eax
+  804295:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80429a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80429d:	50                   	push   %eax
+  80429e:	e8 38 cb ff ff       	call   800ddb <sys_ipc_recv>
+	if (r < 0) {
+  8042a3:	83 c4 10             	add    $0x10,%esp
+  8042a6:	85 c0                	test   %eax,%eax
+  8042a8:	78 2b                	js     8042d5 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8042aa:	85 ff                	test   %edi,%edi
+  8042ac:	74 55                	je     804303 <ipc_recv+0x82>
+  8042ae:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042b6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042bb:	77 39                	ja     8042f6 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042bd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042c2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042c4:	c1 e8 10             	shr    $0x10,%eax
+  8042c7:	74 2d                	je     8042f6 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042c9:	c1 e0 10             	shl    $0x10,%eax
+  8042cc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042d1:	29 c2                	sub    %eax,%edx
+  8042d3:	eb 27                	jmp    8042fc <ipc_recv+0x7b>
+  8042d5:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8042d7:	83 ec 08             	sub    $0x8,%esp
+  8042da:	50                   	push   %eax
+  8042db:	68 97 4e 80 00       	push   $0x804e97
+  8042e0:	e8 de be ff ff       	call   8001c3 <cprintf>
+		*from_env_store = 0;
+  8042e5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8042eb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8042f1:	83 c4 10             	add    $0x10,%esp
+  8042f4:	eb 77                	jmp    80436d <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042f6:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042fc:	8b 02                	mov    (%edx),%eax
+  8042fe:	8b 40 78             	mov    0x78(%eax),%eax
+  804301:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804303:	85 f6                	test   %esi,%esi
+  804305:	74 34                	je     80433b <ipc_recv+0xba>
+  804307:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804309:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80430f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804314:	77 18                	ja     80432e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804316:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80431b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80431d:	c1 e8 10             	shr    $0x10,%eax
+  804320:	74 0c                	je     80432e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804322:	c1 e0 10             	shl    $0x10,%eax
+  804325:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80432a:	29 c2                	sub    %eax,%edx
+  80432c:	eb 06                	jmp    804334 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80432e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804334:	8b 02                	mov    (%edx),%eax
+  804336:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804339:	89 06                	mov    %eax,(%esi)
+  80433b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80433d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804343:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804348:	77 18                	ja     804362 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80434a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80434f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804351:	c1 e8 10             	shr    $0x10,%eax
+  804354:	74 0c                	je     804362 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804356:	c1 e0 10             	shl    $0x10,%eax
+  804359:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80435e:	29 c2                	sub    %eax,%edx
+  804360:	eb 06                	jmp    804368 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804362:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804368:	8b 02                	mov    (%edx),%eax
+  80436a:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80436d:	89 d8                	mov    %ebx,%eax
+  80436f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804372:	5b                   	pop    %ebx
+  804373:	5e                   	pop    %esi
+  804374:	5f                   	pop    %edi
+  804375:	5d                   	pop    %ebp
+  804376:	c3                   	ret
+
+00804377 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804377:	55                   	push   %ebp
+  804378:	89 e5                	mov    %esp,%ebp
+  80437a:	57                   	push   %edi
+  80437b:	56                   	push   %esi
+  80437c:	53                   	push   %ebx
+  80437d:	83 ec 0c             	sub    $0xc,%esp
+  804380:	8b 75 08             	mov    0x8(%ebp),%esi
+  804383:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804386:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804389:	85 db                	test   %ebx,%ebx
+  80438b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804390:	0f 44 d8             	cmove  %eax,%ebx
+  804393:	eb 05                	jmp    80439a <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804395:	e8 1f c8 ff ff       	call   800bb9 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80439a:	57                   	push   %edi
+  80439b:	53                   	push   %ebx
+  80439c:	ff 75 0c             	push   0xc(%ebp)
+  80439f:	56                   	push   %esi
+  8043a0:	e8 09 ca ff ff       	call   800dae <sys_ipc_try_send>
+		if (r == 0) {
+  8043a5:	83 c4 10             	add    $0x10,%esp
+  8043a8:	85 c0                	test   %eax,%eax
+  8043aa:	74 19                	je     8043c5 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8043ac:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8043af:	74 e4                	je     804395 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8043b1:	83 ec 0c             	sub    $0xc,%esp
+  8043b4:	50                   	push   %eax
+  8043b5:	57                   	push   %edi
+  8043b6:	53                   	push   %ebx
+  8043b7:	56                   	push   %esi
+  8043b8:	68 b0 4e 80 00       	push   $0x804eb0
+  8043bd:	e8 01 be ff ff       	call   8001c3 <cprintf>
+			return;
+  8043c2:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8043c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043c8:	5b                   	pop    %ebx
+  8043c9:	5e                   	pop    %esi
+  8043ca:	5f                   	pop    %edi
+  8043cb:	5d                   	pop    %ebp
+  8043cc:	c3                   	ret
+
+008043cd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8043cd:	55                   	push   %ebp
+  8043ce:	89 e5                	mov    %esp,%ebp
+  8043d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8043d3:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8043d8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043db:	c1 e0 04             	shl    $0x4,%eax
+  8043de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043e3:	8b 40 50             	mov    0x50(%eax),%eax
+  8043e6:	39 c8                	cmp    %ecx,%eax
+  8043e8:	74 12                	je     8043fc <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8043ea:	83 c2 01             	add    $0x1,%edx
+  8043ed:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8043f3:	75 e3                	jne    8043d8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043fa:	eb 0e                	jmp    80440a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043fc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043ff:	c1 e0 04             	shl    $0x4,%eax
+  804402:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804407:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80440a:	5d                   	pop    %ebp
+  80440b:	c3                   	ret
+
+0080440c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80440c:	55                   	push   %ebp
+  80440d:	89 e5                	mov    %esp,%ebp
+  80440f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804412:	89 c2                	mov    %eax,%edx
+  804414:	c1 ea 16             	shr    $0x16,%edx
+  804417:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80441e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804423:	f6 c1 01             	test   $0x1,%cl
+  804426:	74 1c                	je     804444 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804428:	c1 e8 0c             	shr    $0xc,%eax
+  80442b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804432:	a8 01                	test   $0x1,%al
+  804434:	74 0e                	je     804444 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804436:	c1 e8 0c             	shr    $0xc,%eax
+  804439:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804440:	ef 
+  804441:	0f b7 d2             	movzwl %dx,%edx
+}
+  804444:	89 d0                	mov    %edx,%eax
+  804446:	5d                   	pop    %ebp
+  804447:	c3                   	ret
+
+00804448 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804448:	55                   	push   %ebp
+  804449:	89 e5                	mov    %esp,%ebp
+  80444b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80444e:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804455:	74 0a                	je     804461 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804457:	8b 45 08             	mov    0x8(%ebp),%eax
+  80445a:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80445f:	c9                   	leave
+  804460:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804461:	83 ec 04             	sub    $0x4,%esp
+  804464:	6a 07                	push   $0x7
+  804466:	68 00 f0 bf ee       	push   $0xeebff000
+  80446b:	6a 00                	push   $0x0
+  80446d:	e8 73 c7 ff ff       	call   800be5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804472:	83 c4 08             	add    $0x8,%esp
+  804475:	68 86 44 80 00       	push   $0x804486
+  80447a:	6a 00                	push   $0x0
+  80447c:	e8 e1 c8 ff ff       	call   800d62 <sys_env_set_pgfault_upcall>
+  804481:	83 c4 10             	add    $0x10,%esp
+  804484:	eb d1                	jmp    804457 <set_pgfault_handler+0xf>
+
+00804486 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804486:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804487:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80448c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80448e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804491:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804495:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804499:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80449c:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044a0:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044a2:	83 c4 08             	add    $0x8,%esp
+	popal
+  8044a5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8044a6:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8044a9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8044aa:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8044ab:	c3                   	ret
+
+008044ac <udm>:
+  8044ac:	57                   	push   %edi
+  8044ad:	56                   	push   %esi
+  8044ae:	53                   	push   %ebx
+  8044af:	83 ec 20             	sub    $0x20,%esp
+  8044b2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044b6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044be:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044ca:	89 d1                	mov    %edx,%ecx
+  8044cc:	09 c1                	or     %eax,%ecx
+  8044ce:	0f 84 91 00 00 00    	je     804565 <udm+0xb9>
+  8044d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044de:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8044e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8044ea:	00 
+  8044eb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8044f2:	00 
+  8044f3:	eb 08                	jmp    8044fd <udm+0x51>
+  8044f5:	83 e9 01             	sub    $0x1,%ecx
+  8044f8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044fb:	74 7c                	je     804579 <udm+0xcd>
+  8044fd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804501:	01 c0                	add    %eax,%eax
+  804503:	89 c6                	mov    %eax,%esi
+  804505:	89 d7                	mov    %edx,%edi
+  804507:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80450b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80450f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804512:	d3 ea                	shr    %cl,%edx
+  804514:	f6 c1 20             	test   $0x20,%cl
+  804517:	74 04                	je     80451d <udm+0x71>
+  804519:	89 d0                	mov    %edx,%eax
+  80451b:	31 d2                	xor    %edx,%edx
+  80451d:	83 e0 01             	and    $0x1,%eax
+  804520:	89 04 24             	mov    %eax,(%esp)
+  804523:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80452a:	00 
+  80452b:	8b 04 24             	mov    (%esp),%eax
+  80452e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804532:	09 f0                	or     %esi,%eax
+  804534:	09 fa                	or     %edi,%edx
+  804536:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80453a:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80453e:	39 f0                	cmp    %esi,%eax
+  804540:	89 d3                	mov    %edx,%ebx
+  804542:	19 fb                	sbb    %edi,%ebx
+  804544:	72 af                	jb     8044f5 <udm+0x49>
+  804546:	29 f0                	sub    %esi,%eax
+  804548:	19 fa                	sbb    %edi,%edx
+  80454a:	89 cf                	mov    %ecx,%edi
+  80454c:	c1 ef 05             	shr    $0x5,%edi
+  80454f:	83 e7 01             	and    $0x1,%edi
+  804552:	89 fe                	mov    %edi,%esi
+  804554:	83 f6 01             	xor    $0x1,%esi
+  804557:	d3 e6                	shl    %cl,%esi
+  804559:	d3 e7                	shl    %cl,%edi
+  80455b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80455f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804563:	eb 90                	jmp    8044f5 <udm+0x49>
+  804565:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804569:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80456d:	89 f0                	mov    %esi,%eax
+  80456f:	89 fa                	mov    %edi,%edx
+  804571:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804575:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804579:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80457d:	89 01                	mov    %eax,(%ecx)
+  80457f:	89 51 04             	mov    %edx,0x4(%ecx)
+  804582:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804586:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80458a:	83 c4 20             	add    $0x20,%esp
+  80458d:	5b                   	pop    %ebx
+  80458e:	5e                   	pop    %esi
+  80458f:	5f                   	pop    %edi
+  804590:	c3                   	ret
+
+00804591 <__udivdi3>:
+  804591:	83 ec 18             	sub    $0x18,%esp
+  804594:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804598:	50                   	push   %eax
+  804599:	ff 74 24 2c          	push   0x2c(%esp)
+  80459d:	ff 74 24 2c          	push   0x2c(%esp)
+  8045a1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045a5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045a9:	e8 fe fe ff ff       	call   8044ac <udm>
+  8045ae:	83 c4 24             	add    $0x24,%esp
+  8045b1:	c3                   	ret
+
+008045b2 <__umoddi3>:
+  8045b2:	83 ec 18             	sub    $0x18,%esp
+  8045b5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045b9:	50                   	push   %eax
+  8045ba:	ff 74 24 2c          	push   0x2c(%esp)
+  8045be:	ff 74 24 2c          	push   0x2c(%esp)
+  8045c2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045c6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045ca:	e8 dd fe ff ff       	call   8044ac <udm>
+  8045cf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045d3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045d7:	83 c4 24             	add    $0x24,%esp
+  8045da:	c3                   	ret
+
+008045db <__divdi3>:
+  8045db:	56                   	push   %esi
+  8045dc:	53                   	push   %ebx
+  8045dd:	83 ec 14             	sub    $0x14,%esp
+  8045e0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8045e4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8045e8:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8045ec:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8045f0:	85 d2                	test   %edx,%edx
+  8045f2:	78 18                	js     80460c <__divdi3+0x31>
+  8045f4:	85 db                	test   %ebx,%ebx
+  8045f6:	78 3e                	js     804636 <__divdi3+0x5b>
+  8045f8:	83 ec 04             	sub    $0x4,%esp
+  8045fb:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045ff:	56                   	push   %esi
+  804600:	53                   	push   %ebx
+  804601:	51                   	push   %ecx
+  804602:	e8 a5 fe ff ff       	call   8044ac <udm>
+  804607:	83 c4 10             	add    $0x10,%esp
+  80460a:	eb 24                	jmp    804630 <__divdi3+0x55>
+  80460c:	f7 d8                	neg    %eax
+  80460e:	83 d2 00             	adc    $0x0,%edx
+  804611:	f7 da                	neg    %edx
+  804613:	85 db                	test   %ebx,%ebx
+  804615:	78 3a                	js     804651 <__divdi3+0x76>
+  804617:	83 ec 04             	sub    $0x4,%esp
+  80461a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80461e:	56                   	push   %esi
+  80461f:	53                   	push   %ebx
+  804620:	51                   	push   %ecx
+  804621:	e8 86 fe ff ff       	call   8044ac <udm>
+  804626:	83 c4 10             	add    $0x10,%esp
+  804629:	f7 d8                	neg    %eax
+  80462b:	83 d2 00             	adc    $0x0,%edx
+  80462e:	f7 da                	neg    %edx
+  804630:	83 c4 14             	add    $0x14,%esp
+  804633:	5b                   	pop    %ebx
+  804634:	5e                   	pop    %esi
+  804635:	c3                   	ret
+  804636:	83 ec 04             	sub    $0x4,%esp
+  804639:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80463d:	56                   	push   %esi
+  80463e:	f7 d9                	neg    %ecx
+  804640:	83 d3 00             	adc    $0x0,%ebx
+  804643:	f7 db                	neg    %ebx
+  804645:	53                   	push   %ebx
+  804646:	51                   	push   %ecx
+  804647:	e8 60 fe ff ff       	call   8044ac <udm>
+  80464c:	83 c4 10             	add    $0x10,%esp
+  80464f:	eb d8                	jmp    804629 <__divdi3+0x4e>
+  804651:	83 ec 04             	sub    $0x4,%esp
+  804654:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804658:	56                   	push   %esi
+  804659:	f7 d9                	neg    %ecx
+  80465b:	83 d3 00             	adc    $0x0,%ebx
+  80465e:	f7 db                	neg    %ebx
+  804660:	53                   	push   %ebx
+  804661:	51                   	push   %ecx
+  804662:	e8 45 fe ff ff       	call   8044ac <udm>
+  804667:	83 c4 10             	add    $0x10,%esp
+  80466a:	eb c4                	jmp    804630 <__divdi3+0x55>
+
+0080466c <__moddi3>:
+  80466c:	55                   	push   %ebp
+  80466d:	57                   	push   %edi
+  80466e:	56                   	push   %esi
+  80466f:	53                   	push   %ebx
+  804670:	83 ec 24             	sub    $0x24,%esp
+  804673:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804677:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80467b:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80467f:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804683:	85 d2                	test   %edx,%edx
+  804685:	78 3b                	js     8046c2 <__moddi3+0x56>
+  804687:	83 ec 04             	sub    $0x4,%esp
+  80468a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80468e:	56                   	push   %esi
+  80468f:	89 ce                	mov    %ecx,%esi
+  804691:	f7 de                	neg    %esi
+  804693:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804697:	89 de                	mov    %ebx,%esi
+  804699:	83 d6 00             	adc    $0x0,%esi
+  80469c:	f7 de                	neg    %esi
+  80469e:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046a2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046a6:	0f 48 f1             	cmovs  %ecx,%esi
+  8046a9:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046ae:	53                   	push   %ebx
+  8046af:	56                   	push   %esi
+  8046b0:	e8 f7 fd ff ff       	call   8044ac <udm>
+  8046b5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046b9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046bd:	83 c4 10             	add    $0x10,%esp
+  8046c0:	eb 47                	jmp    804709 <__moddi3+0x9d>
+  8046c2:	f7 d8                	neg    %eax
+  8046c4:	83 d2 00             	adc    $0x0,%edx
+  8046c7:	f7 da                	neg    %edx
+  8046c9:	83 ec 04             	sub    $0x4,%esp
+  8046cc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046d0:	56                   	push   %esi
+  8046d1:	89 cf                	mov    %ecx,%edi
+  8046d3:	f7 df                	neg    %edi
+  8046d5:	89 de                	mov    %ebx,%esi
+  8046d7:	83 d6 00             	adc    $0x0,%esi
+  8046da:	f7 de                	neg    %esi
+  8046dc:	0f 49 cf             	cmovns %edi,%ecx
+  8046df:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8046e3:	0f 49 de             	cmovns %esi,%ebx
+  8046e6:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8046ea:	ff 74 24 0c          	push   0xc(%esp)
+  8046ee:	ff 74 24 0c          	push   0xc(%esp)
+  8046f2:	e8 b5 fd ff ff       	call   8044ac <udm>
+  8046f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046ff:	f7 d8                	neg    %eax
+  804701:	83 d2 00             	adc    $0x0,%edx
+  804704:	f7 da                	neg    %edx
+  804706:	83 c4 10             	add    $0x10,%esp
+  804709:	83 c4 24             	add    $0x24,%esp
+  80470c:	5b                   	pop    %ebx
+  80470d:	5e                   	pop    %esi
+  80470e:	5f                   	pop    %edi
+  80470f:	5d                   	pop    %ebp
+  804710:	c3                   	ret
@@ -0,0 +1,10632 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 92 07 00 00       	call   8007c3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+	{404, "Not Found"},
+};
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 60 4e 80 00       	push   $0x804e60
+  80003f:	e8 fd 08 00 00       	call   800941 <cprintf>
+	exit();
+  800044:	e8 f5 07 00 00       	call   80083e <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <send_error>:
+	return 0;
+}
+
+static int
+send_error(struct http_request *req, int code)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80005a:	89 c3                	mov    %eax,%ebx
+	char buf[512];
+	int r;
+
+	struct error_messages *e = errors;
+  80005c:	b8 00 60 80 00       	mov    $0x806000,%eax
+	while (e->code != 0 && e->msg != 0) {
+  800061:	8b 08                	mov    (%eax),%ecx
+  800063:	85 c9                	test   %ecx,%ecx
+  800065:	74 0f                	je     800076 <send_error+0x28>
+		if (e->code == code)
+  800067:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80006b:	74 10                	je     80007d <send_error+0x2f>
+  80006d:	39 d1                	cmp    %edx,%ecx
+  80006f:	74 0c                	je     80007d <send_error+0x2f>
+			break;
+		e++;
+  800071:	83 c0 08             	add    $0x8,%eax
+  800074:	eb eb                	jmp    800061 <send_error+0x13>
+	}
+
+	if (e->code == 0)
+		return -1;
+  800076:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80007b:	eb 3b                	jmp    8000b8 <send_error+0x6a>
+
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  80007d:	8b 40 04             	mov    0x4(%eax),%eax
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	50                   	push   %eax
+  800084:	51                   	push   %ecx
+  800085:	50                   	push   %eax
+  800086:	51                   	push   %ecx
+  800087:	68 00 4f 80 00       	push   $0x804f00
+  80008c:	68 00 02 00 00       	push   $0x200
+  800091:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  800097:	57                   	push   %edi
+  800098:	e8 33 0e 00 00       	call   800ed0 <snprintf>
+  80009d:	89 c6                	mov    %eax,%esi
+			       "Content-type: text/html\r\n"
+			       "\r\n"
+			       "<html><body><p>%d - %s</p></body></html>\r\n",
+			       e->code, e->msg, e->code, e->msg);
+
+	if (write(req->sock, buf, r) != r)
+  80009f:	83 c4 1c             	add    $0x1c,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	57                   	push   %edi
+  8000a4:	ff 33                	push   (%ebx)
+  8000a6:	e8 5f 1b 00 00       	call   801c0a <write>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	39 f0                	cmp    %esi,%eax
+  8000b0:	0f 95 c0             	setne  %al
+  8000b3:	0f b6 c0             	movzbl %al,%eax
+  8000b6:	f7 d8                	neg    %eax
+		return -1;
+
+	return 0;
+}
+  8000b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <handle_client>:
+	return r;
+}
+
+static void
+handle_client(int sock)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec 40 03 00 00    	sub    $0x340,%esp
+  8000cc:	89 c6                	mov    %eax,%esi
+	struct http_request *req = &con_d;
+
+	while (1)
+	{
+		// Receive message
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000ce:	68 00 02 00 00       	push   $0x200
+  8000d3:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	56                   	push   %esi
+  8000db:	e8 32 1a 00 00       	call   801b12 <read>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 3c                	js     800123 <handle_client+0x63>
+			panic("failed to read");
+
+		memset(req, 0, sizeof(*req));
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	6a 0c                	push   $0xc
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 7f 0f 00 00       	call   801076 <memset>
+
+		req->sock = sock;
+  8000f7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	if (strncmp(request, "GET ", 4) != 0)
+  8000fa:	83 c4 0c             	add    $0xc,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	68 80 4e 80 00       	push   $0x804e80
+  800104:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80010a:	50                   	push   %eax
+  80010b:	e8 ec 0e 00 00       	call   800ffc <strncmp>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	0f 85 8e 01 00 00    	jne    8002a9 <handle_client+0x1e9>
+	request += 4;
+  80011b:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  800121:	eb 1a                	jmp    80013d <handle_client+0x7d>
+			panic("failed to read");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 64 4e 80 00       	push   $0x804e64
+  80012b:	68 19 01 00 00       	push   $0x119
+  800130:	68 73 4e 80 00       	push   $0x804e73
+  800135:	e8 2c 07 00 00       	call   800866 <_panic>
+		request++;
+  80013a:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != ' ')
+  80013d:	f6 03 df             	testb  $0xdf,(%ebx)
+  800140:	75 f8                	jne    80013a <handle_client+0x7a>
+	url_len = request - url;
+  800142:	89 df                	mov    %ebx,%edi
+  800144:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80014a:	29 c7                	sub    %eax,%edi
+	req->url = malloc(url_len + 1);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	8d 47 01             	lea    0x1(%edi),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 d0 31 00 00       	call   803328 <malloc>
+  800158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	memmove(req->url, url, url_len);
+  80015b:	83 c4 0c             	add    $0xc,%esp
+  80015e:	57                   	push   %edi
+  80015f:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  800165:	51                   	push   %ecx
+  800166:	50                   	push   %eax
+  800167:	e8 3f 0f 00 00       	call   8010ab <memmove>
+	req->url[url_len] = '\0';
+  80016c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80016f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	request++;
+  800173:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != '\n')
+  800176:	83 c4 10             	add    $0x10,%esp
+	request++;
+  800179:	89 d8                	mov    %ebx,%eax
+	while (*request && *request != '\n')
+  80017b:	eb 03                	jmp    800180 <handle_client+0xc0>
+		request++;
+  80017d:	83 c0 01             	add    $0x1,%eax
+	while (*request && *request != '\n')
+  800180:	0f b6 10             	movzbl (%eax),%edx
+  800183:	84 d2                	test   %dl,%dl
+  800185:	74 05                	je     80018c <handle_client+0xcc>
+  800187:	80 fa 0a             	cmp    $0xa,%dl
+  80018a:	75 f1                	jne    80017d <handle_client+0xbd>
+	version_len = request - version;
+  80018c:	29 d8                	sub    %ebx,%eax
+  80018e:	89 c7                	mov    %eax,%edi
+	req->version = malloc(version_len + 1);
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	8d 40 01             	lea    0x1(%eax),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 8c 31 00 00       	call   803328 <malloc>
+  80019c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memmove(req->version, version, version_len);
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	57                   	push   %edi
+  8001a3:	53                   	push   %ebx
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 01 0f 00 00       	call   8010ab <memmove>
+	req->version[version_len] = '\0';
+  8001aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001ad:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	if ((fd = open(req->url, O_RDONLY)) < 0) {
+  8001b1:	83 c4 08             	add    $0x8,%esp
+  8001b4:	6a 00                	push   $0x0
+  8001b6:	ff 75 e0             	push   -0x20(%ebp)
+  8001b9:	e8 9c 1f 00 00       	call   80215a <open>
+  8001be:	89 c7                	mov    %eax,%edi
+  8001c0:	83 c4 10             	add    $0x10,%esp
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	78 51                	js     800218 <handle_client+0x158>
+	if ((r = fstat(fd, &statbuf)) < 0) {
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	57                   	push   %edi
+  8001d2:	e8 b1 1b 00 00       	call   801d88 <fstat>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 49                	js     800227 <handle_client+0x167>
+	if (statbuf.st_isdir) {
+  8001de:	83 bd d4 fd ff ff 00 	cmpl   $0x0,-0x22c(%ebp)
+  8001e5:	75 4f                	jne    800236 <handle_client+0x176>
+	file_size = statbuf.st_size;
+  8001e7:	8b 85 d0 fd ff ff    	mov    -0x230(%ebp),%eax
+  8001ed:	89 85 c0 fc ff ff    	mov    %eax,-0x340(%ebp)
+	struct responce_header *h = headers;
+  8001f3:	bb 10 60 80 00       	mov    $0x806010,%ebx
+	while (h->code != 0 && h->header!= 0) {
+  8001f8:	8b 03                	mov    (%ebx),%eax
+  8001fa:	85 c0                	test   %eax,%eax
+  8001fc:	74 45                	je     800243 <handle_client+0x183>
+		if (h->code == code)
+  8001fe:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  800202:	0f 84 b0 00 00 00    	je     8002b8 <handle_client+0x1f8>
+  800208:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80020d:	0f 84 a5 00 00 00    	je     8002b8 <handle_client+0x1f8>
+		h++;
+  800213:	83 c3 08             	add    $0x8,%ebx
+  800216:	eb e0                	jmp    8001f8 <handle_client+0x138>
+		send_error(req, 404);
+  800218:	ba 94 01 00 00       	mov    $0x194,%edx
+  80021d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800220:	e8 29 fe ff ff       	call   80004e <send_error>
+		return fd;
+  800225:	eb 28                	jmp    80024f <handle_client+0x18f>
+		send_error(req, 404);
+  800227:	ba 94 01 00 00       	mov    $0x194,%edx
+  80022c:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80022f:	e8 1a fe ff ff       	call   80004e <send_error>
+		goto end;
+  800234:	eb 0d                	jmp    800243 <handle_client+0x183>
+		send_error(req, 404);
+  800236:	ba 94 01 00 00       	mov    $0x194,%edx
+  80023b:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80023e:	e8 0b fe ff ff       	call   80004e <send_error>
+	close(fd);
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	57                   	push   %edi
+  800247:	e8 8a 17 00 00       	call   8019d6 <close>
+	return r;
+  80024c:	83 c4 10             	add    $0x10,%esp
+	free(req->url);
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	ff 75 e0             	push   -0x20(%ebp)
+  800255:	e8 05 30 00 00       	call   80325f <free>
+	free(req->version);
+  80025a:	83 c4 04             	add    $0x4,%esp
+  80025d:	ff 75 e4             	push   -0x1c(%ebp)
+  800260:	e8 fa 2f 00 00       	call   80325f <free>
+
+		// no keep alive
+		break;
+	}
+
+	close(sock);
+  800265:	89 34 24             	mov    %esi,(%esp)
+  800268:	e8 69 17 00 00       	call   8019d6 <close>
+}
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+		die("Failed to send bytes to client");
+  800275:	b8 7c 4f 80 00       	mov    $0x804f7c,%eax
+  80027a:	e8 b4 fd ff ff       	call   800033 <die>
+  80027f:	eb 62                	jmp    8002e3 <handle_client+0x223>
+		panic("buffer too small!");
+  800281:	83 ec 04             	sub    $0x4,%esp
+  800284:	68 85 4e 80 00       	push   $0x804e85
+  800289:	6a 63                	push   $0x63
+  80028b:	68 73 4e 80 00       	push   $0x804e73
+  800290:	e8 d1 05 00 00       	call   800866 <_panic>
+		panic("buffer too small!");
+  800295:	83 ec 04             	sub    $0x4,%esp
+  800298:	68 85 4e 80 00       	push   $0x804e85
+  80029d:	6a 7f                	push   $0x7f
+  80029f:	68 73 4e 80 00       	push   $0x804e73
+  8002a4:	e8 bd 05 00 00       	call   800866 <_panic>
+			send_error(req, 400);
+  8002a9:	ba 90 01 00 00       	mov    $0x190,%edx
+  8002ae:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002b1:	e8 98 fd ff ff       	call   80004e <send_error>
+  8002b6:	eb 97                	jmp    80024f <handle_client+0x18f>
+	int len = strlen(h->header);
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	ff 73 04             	push   0x4(%ebx)
+  8002be:	e8 27 0c 00 00       	call   800eea <strlen>
+	if (write(req->sock, h->header, len) != len) {
+  8002c3:	83 c4 0c             	add    $0xc,%esp
+  8002c6:	89 85 c4 fc ff ff    	mov    %eax,-0x33c(%ebp)
+  8002cc:	50                   	push   %eax
+  8002cd:	ff 73 04             	push   0x4(%ebx)
+  8002d0:	ff 75 dc             	push   -0x24(%ebp)
+  8002d3:	e8 32 19 00 00       	call   801c0a <write>
+  8002d8:	83 c4 10             	add    $0x10,%esp
+  8002db:	39 85 c4 fc ff ff    	cmp    %eax,-0x33c(%ebp)
+  8002e1:	75 92                	jne    800275 <handle_client+0x1b5>
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  8002e3:	ff b5 c0 fc ff ff    	push   -0x340(%ebp)
+  8002e9:	68 b4 4e 80 00       	push   $0x804eb4
+  8002ee:	6a 40                	push   $0x40
+  8002f0:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  8002f6:	50                   	push   %eax
+  8002f7:	e8 d4 0b 00 00       	call   800ed0 <snprintf>
+  8002fc:	89 c3                	mov    %eax,%ebx
+	if (r > 63)
+  8002fe:	83 c4 10             	add    $0x10,%esp
+  800301:	83 f8 3f             	cmp    $0x3f,%eax
+  800304:	0f 8f 77 ff ff ff    	jg     800281 <handle_client+0x1c1>
+	if (write(req->sock, buf, r) != r)
+  80030a:	83 ec 04             	sub    $0x4,%esp
+  80030d:	53                   	push   %ebx
+  80030e:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  800314:	50                   	push   %eax
+  800315:	ff 75 dc             	push   -0x24(%ebp)
+  800318:	e8 ed 18 00 00       	call   801c0a <write>
+	if ((r = send_size(req, file_size)) < 0)
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	39 c3                	cmp    %eax,%ebx
+  800322:	0f 85 1b ff ff ff    	jne    800243 <handle_client+0x183>
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  800328:	68 97 4e 80 00       	push   $0x804e97
+  80032d:	68 a1 4e 80 00       	push   $0x804ea1
+  800332:	68 80 00 00 00       	push   $0x80
+  800337:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  80033d:	50                   	push   %eax
+  80033e:	e8 8d 0b 00 00       	call   800ed0 <snprintf>
+  800343:	89 c3                	mov    %eax,%ebx
+	if (r > 127)
+  800345:	83 c4 10             	add    $0x10,%esp
+  800348:	83 f8 7f             	cmp    $0x7f,%eax
+  80034b:	0f 8f 44 ff ff ff    	jg     800295 <handle_client+0x1d5>
+	if (write(req->sock, buf, r) != r)
+  800351:	83 ec 04             	sub    $0x4,%esp
+  800354:	50                   	push   %eax
+  800355:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  80035b:	50                   	push   %eax
+  80035c:	ff 75 dc             	push   -0x24(%ebp)
+  80035f:	e8 a6 18 00 00       	call   801c0a <write>
+	if ((r = send_content_type(req)) < 0)
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	39 c3                	cmp    %eax,%ebx
+  800369:	0f 85 d4 fe ff ff    	jne    800243 <handle_client+0x183>
+	int fin_len = strlen(fin);
+  80036f:	83 ec 0c             	sub    $0xc,%esp
+  800372:	68 c7 4e 80 00       	push   $0x804ec7
+  800377:	e8 6e 0b 00 00       	call   800eea <strlen>
+  80037c:	89 c3                	mov    %eax,%ebx
+	if (write(req->sock, fin, fin_len) != fin_len)
+  80037e:	83 c4 0c             	add    $0xc,%esp
+  800381:	50                   	push   %eax
+  800382:	68 c7 4e 80 00       	push   $0x804ec7
+  800387:	ff 75 dc             	push   -0x24(%ebp)
+  80038a:	e8 7b 18 00 00       	call   801c0a <write>
+	if ((r = send_header_fin(req)) < 0)
+  80038f:	83 c4 10             	add    $0x10,%esp
+  800392:	39 c3                	cmp    %eax,%ebx
+  800394:	0f 85 a9 fe ff ff    	jne    800243 <handle_client+0x183>
+{
+  80039a:	89 a5 c4 fc ff ff    	mov    %esp,-0x33c(%ebp)
+	char buf[len];
+  8003a0:	83 c4 80             	add    $0xffffff80,%esp
+  8003a3:	89 e3                	mov    %esp,%ebx
+	while ((r = read(fd, buf, len)) > 0) {
+  8003a5:	83 ec 04             	sub    $0x4,%esp
+  8003a8:	68 80 00 00 00       	push   $0x80
+  8003ad:	53                   	push   %ebx
+  8003ae:	57                   	push   %edi
+  8003af:	e8 5e 17 00 00       	call   801b12 <read>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	85 c0                	test   %eax,%eax
+  8003b9:	7e 14                	jle    8003cf <handle_client+0x30f>
+		if ((r = write(req->sock, buf, r)) < 0) {
+  8003bb:	83 ec 04             	sub    $0x4,%esp
+  8003be:	50                   	push   %eax
+  8003bf:	53                   	push   %ebx
+  8003c0:	ff 75 dc             	push   -0x24(%ebp)
+  8003c3:	e8 42 18 00 00       	call   801c0a <write>
+  8003c8:	83 c4 10             	add    $0x10,%esp
+  8003cb:	85 c0                	test   %eax,%eax
+  8003cd:	79 d6                	jns    8003a5 <handle_client+0x2e5>
+  8003cf:	8b a5 c4 fc ff ff    	mov    -0x33c(%ebp),%esp
+  8003d5:	e9 69 fe ff ff       	jmp    800243 <handle_client+0x183>
+
+008003da <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8003da:	55                   	push   %ebp
+  8003db:	89 e5                	mov    %esp,%ebp
+  8003dd:	57                   	push   %edi
+  8003de:	56                   	push   %esi
+  8003df:	53                   	push   %ebx
+  8003e0:	83 ec 40             	sub    $0x40,%esp
+	int serversock, clientsock;
+	struct sockaddr_in server, client;
+
+	binaryname = "jhttpd";
+  8003e3:	c7 05 20 60 80 00 ca 	movl   $0x804eca,0x806020
+  8003ea:	4e 80 00 
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8003ed:	6a 06                	push   $0x6
+  8003ef:	6a 01                	push   $0x1
+  8003f1:	6a 02                	push   $0x2
+  8003f3:	e8 e8 2b 00 00       	call   802fe0 <socket>
+  8003f8:	89 c6                	mov    %eax,%esi
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	85 c0                	test   %eax,%eax
+  8003ff:	78 6d                	js     80046e <umain+0x94>
+		die("Failed to create socket");
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  800401:	83 ec 04             	sub    $0x4,%esp
+  800404:	6a 10                	push   $0x10
+  800406:	6a 00                	push   $0x0
+  800408:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80040b:	53                   	push   %ebx
+  80040c:	e8 65 0c 00 00       	call   801076 <memset>
+	server.sin_family = AF_INET;			// Internet/IP
+  800411:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  800415:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80041c:	e8 64 01 00 00       	call   800585 <htonl>
+  800421:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	server.sin_port = htons(PORT);			// server port
+  800424:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  80042b:	e8 3b 01 00 00       	call   80056b <htons>
+  800430:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  800434:	83 c4 0c             	add    $0xc,%esp
+  800437:	6a 10                	push   $0x10
+  800439:	53                   	push   %ebx
+  80043a:	56                   	push   %esi
+  80043b:	e8 0e 2b 00 00       	call   802f4e <bind>
+  800440:	83 c4 10             	add    $0x10,%esp
+  800443:	85 c0                	test   %eax,%eax
+  800445:	78 33                	js     80047a <umain+0xa0>
+	{
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800447:	83 ec 08             	sub    $0x8,%esp
+  80044a:	6a 05                	push   $0x5
+  80044c:	56                   	push   %esi
+  80044d:	e8 6b 2b 00 00       	call   802fbd <listen>
+  800452:	83 c4 10             	add    $0x10,%esp
+  800455:	85 c0                	test   %eax,%eax
+  800457:	78 2d                	js     800486 <umain+0xac>
+		die("Failed to listen on server socket");
+
+	cprintf("Waiting for http connections...\n");
+  800459:	83 ec 0c             	sub    $0xc,%esp
+  80045c:	68 e4 4f 80 00       	push   $0x804fe4
+  800461:	e8 db 04 00 00       	call   800941 <cprintf>
+  800466:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  800469:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  80046c:	eb 35                	jmp    8004a3 <umain+0xc9>
+		die("Failed to create socket");
+  80046e:	b8 d1 4e 80 00       	mov    $0x804ed1,%eax
+  800473:	e8 bb fb ff ff       	call   800033 <die>
+  800478:	eb 87                	jmp    800401 <umain+0x27>
+		die("Failed to bind the server socket");
+  80047a:	b8 9c 4f 80 00       	mov    $0x804f9c,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <die>
+  800484:	eb c1                	jmp    800447 <umain+0x6d>
+		die("Failed to listen on server socket");
+  800486:	b8 c0 4f 80 00       	mov    $0x804fc0,%eax
+  80048b:	e8 a3 fb ff ff       	call   800033 <die>
+  800490:	eb c7                	jmp    800459 <umain+0x7f>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  800492:	b8 08 50 80 00       	mov    $0x805008,%eax
+  800497:	e8 97 fb ff ff       	call   800033 <die>
+		}
+		handle_client(clientsock);
+  80049c:	89 d8                	mov    %ebx,%eax
+  80049e:	e8 1d fc ff ff       	call   8000c0 <handle_client>
+		unsigned int clientlen = sizeof(client);
+  8004a3:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		if ((clientsock = accept(serversock,
+  8004aa:	83 ec 04             	sub    $0x4,%esp
+  8004ad:	57                   	push   %edi
+  8004ae:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8004b1:	50                   	push   %eax
+  8004b2:	56                   	push   %esi
+  8004b3:	e8 67 2a 00 00       	call   802f1f <accept>
+  8004b8:	89 c3                	mov    %eax,%ebx
+  8004ba:	83 c4 10             	add    $0x10,%esp
+  8004bd:	85 c0                	test   %eax,%eax
+  8004bf:	78 d1                	js     800492 <umain+0xb8>
+  8004c1:	eb d9                	jmp    80049c <umain+0xc2>
+
+008004c3 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8004c3:	55                   	push   %ebp
+  8004c4:	89 e5                	mov    %esp,%ebp
+  8004c6:	57                   	push   %edi
+  8004c7:	56                   	push   %esi
+  8004c8:	53                   	push   %ebx
+  8004c9:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8004cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8004d2:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8004d5:	b9 00 70 80 00       	mov    $0x807000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8004da:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8004df:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004e2:	eb 31                	jmp    800515 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8004e4:	0f b6 c8             	movzbl %al,%ecx
+  8004e7:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  8004ec:	88 0a                	mov    %cl,(%edx)
+  8004ee:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  8004f1:	83 e8 01             	sub    $0x1,%eax
+  8004f4:	3c ff                	cmp    $0xff,%al
+  8004f6:	75 ec                	jne    8004e4 <inet_ntoa+0x21>
+  8004f8:	0f b6 db             	movzbl %bl,%ebx
+  8004fb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8004fe:	01 d8                	add    %ebx,%eax
+  800500:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800502:	8d 40 01             	lea    0x1(%eax),%eax
+  800505:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800508:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80050b:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80050e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800511:	39 c7                	cmp    %eax,%edi
+  800513:	74 46                	je     80055b <inet_ntoa+0x98>
+  800515:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051d:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800520:	89 f0                	mov    %esi,%eax
+  800522:	f6 e2                	mul    %dl
+  800524:	66 c1 e8 0b          	shr    $0xb,%ax
+  800528:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80052b:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80052e:	01 c9                	add    %ecx,%ecx
+  800530:	89 d0                	mov    %edx,%eax
+  800532:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800534:	89 d7                	mov    %edx,%edi
+  800536:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80053a:	89 d9                	mov    %ebx,%ecx
+  80053c:	83 c3 01             	add    $0x1,%ebx
+  80053f:	0f b6 c9             	movzbl %cl,%ecx
+  800542:	83 c0 30             	add    $0x30,%eax
+  800545:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800549:	89 f8                	mov    %edi,%eax
+  80054b:	3c 09                	cmp    $0x9,%al
+  80054d:	77 d1                	ja     800520 <inet_ntoa+0x5d>
+  80054f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800552:	88 17                	mov    %dl,(%edi)
+  800554:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800557:	89 d8                	mov    %ebx,%eax
+  800559:	eb 96                	jmp    8004f1 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80055b:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80055e:	b8 00 70 80 00       	mov    $0x807000,%eax
+  800563:	83 c4 1c             	add    $0x1c,%esp
+  800566:	5b                   	pop    %ebx
+  800567:	5e                   	pop    %esi
+  800568:	5f                   	pop    %edi
+  800569:	5d                   	pop    %ebp
+  80056a:	c3                   	ret
+
+0080056b <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80056b:	55                   	push   %ebp
+  80056c:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80056e:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800572:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  800576:	5d                   	pop    %ebp
+  800577:	c3                   	ret
+
+00800578 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  800578:	55                   	push   %ebp
+  800579:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80057b:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80057f:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+
+00800585 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80058b:	89 d0                	mov    %edx,%eax
+  80058d:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  800590:	89 d1                	mov    %edx,%ecx
+  800592:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800595:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  800597:	89 d1                	mov    %edx,%ecx
+  800599:	c1 e1 08             	shl    $0x8,%ecx
+  80059c:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005a2:	09 c8                	or     %ecx,%eax
+  8005a4:	c1 ea 08             	shr    $0x8,%edx
+  8005a7:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8005ad:	09 d0                	or     %edx,%eax
+}
+  8005af:	5d                   	pop    %ebp
+  8005b0:	c3                   	ret
+
+008005b1 <inet_aton>:
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	57                   	push   %edi
+  8005b5:	56                   	push   %esi
+  8005b6:	53                   	push   %ebx
+  8005b7:	83 ec 2c             	sub    $0x2c,%esp
+  8005ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8005bd:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8005c0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8005c3:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8005c6:	e9 9b 00 00 00       	jmp    800666 <inet_aton+0xb5>
+      c = *++cp;
+  8005cb:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8005cf:	89 c1                	mov    %eax,%ecx
+  8005d1:	83 e1 df             	and    $0xffffffdf,%ecx
+  8005d4:	80 f9 58             	cmp    $0x58,%cl
+  8005d7:	74 10                	je     8005e9 <inet_aton+0x38>
+      c = *++cp;
+  8005d9:	83 c2 01             	add    $0x1,%edx
+  8005dc:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8005df:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005e4:	e9 97 00 00 00       	jmp    800680 <inet_aton+0xcf>
+        c = *++cp;
+  8005e9:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8005ed:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8005f0:	bf 10 00 00 00       	mov    $0x10,%edi
+  8005f5:	e9 86 00 00 00       	jmp    800680 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  8005fa:	0f af d7             	imul   %edi,%edx
+  8005fd:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800601:	0f be 01             	movsbl (%ecx),%eax
+  800604:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800607:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80060a:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80060d:	80 fb 09             	cmp    $0x9,%bl
+  800610:	76 e8                	jbe    8005fa <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800612:	83 ff 10             	cmp    $0x10,%edi
+  800615:	75 2e                	jne    800645 <inet_aton+0x94>
+  800617:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80061b:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80061e:	83 e3 df             	and    $0xffffffdf,%ebx
+  800621:	83 eb 41             	sub    $0x41,%ebx
+  800624:	80 fb 05             	cmp    $0x5,%bl
+  800627:	77 1c                	ja     800645 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800629:	c1 e2 04             	shl    $0x4,%edx
+  80062c:	83 c0 0a             	add    $0xa,%eax
+  80062f:	89 f3                	mov    %esi,%ebx
+  800631:	80 fb 1a             	cmp    $0x1a,%bl
+  800634:	19 db                	sbb    %ebx,%ebx
+  800636:	83 e3 20             	and    $0x20,%ebx
+  800639:	83 c3 41             	add    $0x41,%ebx
+  80063c:	29 d8                	sub    %ebx,%eax
+  80063e:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800640:	0f be 01             	movsbl (%ecx),%eax
+  800643:	eb bf                	jmp    800604 <inet_aton+0x53>
+    if (c == '.') {
+  800645:	83 f8 2e             	cmp    $0x2e,%eax
+  800648:	75 43                	jne    80068d <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80064a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80064d:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800650:	39 f0                	cmp    %esi,%eax
+  800652:	0f 84 22 01 00 00    	je     80077a <inet_aton+0x1c9>
+      *pp++ = val;
+  800658:	83 c0 04             	add    $0x4,%eax
+  80065b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80065e:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800661:	89 ca                	mov    %ecx,%edx
+  800663:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800666:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800669:	80 f9 09             	cmp    $0x9,%cl
+  80066c:	0f 87 01 01 00 00    	ja     800773 <inet_aton+0x1c2>
+    base = 10;
+  800672:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  800677:	83 f8 30             	cmp    $0x30,%eax
+  80067a:	0f 84 4b ff ff ff    	je     8005cb <inet_aton+0x1a>
+  800680:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800683:	ba 00 00 00 00       	mov    $0x0,%edx
+  800688:	e9 7a ff ff ff       	jmp    800607 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80068d:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  800691:	89 d6                	mov    %edx,%esi
+  800693:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800696:	85 c0                	test   %eax,%eax
+  800698:	74 2e                	je     8006c8 <inet_aton+0x117>
+    return (0);
+  80069a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80069f:	89 fa                	mov    %edi,%edx
+  8006a1:	80 fa 1f             	cmp    $0x1f,%dl
+  8006a4:	0f 86 d5 00 00 00    	jbe    80077f <inet_aton+0x1ce>
+  8006aa:	84 c0                	test   %al,%al
+  8006ac:	0f 88 cd 00 00 00    	js     80077f <inet_aton+0x1ce>
+  8006b2:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8006b5:	83 f9 04             	cmp    $0x4,%ecx
+  8006b8:	76 0e                	jbe    8006c8 <inet_aton+0x117>
+    return (0);
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006bf:	83 f8 20             	cmp    $0x20,%eax
+  8006c2:	0f 85 b7 00 00 00    	jne    80077f <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8006c8:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8006cb:	89 d8                	mov    %ebx,%eax
+  8006cd:	29 c8                	sub    %ecx,%eax
+  8006cf:	c1 f8 02             	sar    $0x2,%eax
+  8006d2:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8006d5:	83 f8 02             	cmp    $0x2,%eax
+  8006d8:	74 7a                	je     800754 <inet_aton+0x1a3>
+  8006da:	83 f9 03             	cmp    $0x3,%ecx
+  8006dd:	7f 49                	jg     800728 <inet_aton+0x177>
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	0f 84 98 00 00 00    	je     80077f <inet_aton+0x1ce>
+  8006e7:	83 f9 02             	cmp    $0x2,%ecx
+  8006ea:	75 19                	jne    800705 <inet_aton+0x154>
+      return (0);
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8006f1:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8006f7:	0f 87 82 00 00 00    	ja     80077f <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  8006fd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800700:	c1 e0 18             	shl    $0x18,%eax
+  800703:	09 c6                	or     %eax,%esi
+  return (1);
+  800705:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80070a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80070e:	74 6f                	je     80077f <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800710:	83 ec 0c             	sub    $0xc,%esp
+  800713:	56                   	push   %esi
+  800714:	e8 6c fe ff ff       	call   800585 <htonl>
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80071f:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800721:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800726:	eb 57                	jmp    80077f <inet_aton+0x1ce>
+  switch (n) {
+  800728:	83 f9 04             	cmp    $0x4,%ecx
+  80072b:	75 d8                	jne    800705 <inet_aton+0x154>
+      return (0);
+  80072d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800732:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800738:	77 45                	ja     80077f <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80073a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80073d:	c1 e0 18             	shl    $0x18,%eax
+  800740:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800743:	c1 e1 10             	shl    $0x10,%ecx
+  800746:	09 c8                	or     %ecx,%eax
+  800748:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80074b:	c1 e1 08             	shl    $0x8,%ecx
+  80074e:	09 c8                	or     %ecx,%eax
+  800750:	09 c6                	or     %eax,%esi
+    break;
+  800752:	eb b1                	jmp    800705 <inet_aton+0x154>
+      return (0);
+  800754:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800759:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80075f:	77 1e                	ja     80077f <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800761:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800764:	c1 e0 18             	shl    $0x18,%eax
+  800767:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80076a:	c1 e1 10             	shl    $0x10,%ecx
+  80076d:	09 c8                	or     %ecx,%eax
+  80076f:	09 c6                	or     %eax,%esi
+    break;
+  800771:	eb 92                	jmp    800705 <inet_aton+0x154>
+      return (0);
+  800773:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800778:	eb 05                	jmp    80077f <inet_aton+0x1ce>
+        return (0);
+  80077a:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  80077f:	89 c8                	mov    %ecx,%eax
+  800781:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800784:	5b                   	pop    %ebx
+  800785:	5e                   	pop    %esi
+  800786:	5f                   	pop    %edi
+  800787:	5d                   	pop    %ebp
+  800788:	c3                   	ret
+
+00800789 <inet_addr>:
+{
+  800789:	55                   	push   %ebp
+  80078a:	89 e5                	mov    %esp,%ebp
+  80078c:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  80078f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800792:	50                   	push   %eax
+  800793:	ff 75 08             	push   0x8(%ebp)
+  800796:	e8 16 fe ff ff       	call   8005b1 <inet_aton>
+  80079b:	89 c2                	mov    %eax,%edx
+  80079d:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8007a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8007a5:	85 d2                	test   %edx,%edx
+  8007a7:	75 02                	jne    8007ab <inet_addr+0x22>
+}
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+    return (val.s_addr);
+  8007ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007ae:	eb f9                	jmp    8007a9 <inet_addr+0x20>
+
+008007b0 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8007b6:	ff 75 08             	push   0x8(%ebp)
+  8007b9:	e8 c7 fd ff ff       	call   800585 <htonl>
+  8007be:	83 c4 10             	add    $0x10,%esp
+}
+  8007c1:	c9                   	leave
+  8007c2:	c3                   	ret
+
+008007c3 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	57                   	push   %edi
+  8007c7:	56                   	push   %esi
+  8007c8:	53                   	push   %ebx
+  8007c9:	83 ec 1c             	sub    $0x1c,%esp
+  8007cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007cf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8007d2:	e8 34 0b 00 00       	call   80130b <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8007d7:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8007da:	89 15 e0 72 80 00    	mov    %edx,0x8072e0
+	thisenv = &envs[ENVX(eid)];
+  8007e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8007e5:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8007e7:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8007e9:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8007ef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8007f4:	77 16                	ja     80080c <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8007f6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8007fb:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8007fd:	c1 e8 10             	shr    $0x10,%eax
+  800800:	74 0a                	je     80080c <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800802:	c1 e0 10             	shl    $0x10,%eax
+  800805:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80080a:	29 c2                	sub    %eax,%edx
+  80080c:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80080f:	c1 e0 04             	shl    $0x4,%eax
+  800812:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800817:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800819:	85 db                	test   %ebx,%ebx
+  80081b:	7e 07                	jle    800824 <libmain+0x61>
+		binaryname = argv[0];
+  80081d:	8b 06                	mov    (%esi),%eax
+  80081f:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	// call user main routine
+	umain(argc, argv);
+  800824:	83 ec 08             	sub    $0x8,%esp
+  800827:	56                   	push   %esi
+  800828:	53                   	push   %ebx
+  800829:	e8 ac fb ff ff       	call   8003da <umain>
+
+	// exit gracefully
+	exit();
+  80082e:	e8 0b 00 00 00       	call   80083e <exit>
+}
+  800833:	83 c4 10             	add    $0x10,%esp
+  800836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800839:	5b                   	pop    %ebx
+  80083a:	5e                   	pop    %esi
+  80083b:	5f                   	pop    %edi
+  80083c:	5d                   	pop    %ebp
+  80083d:	c3                   	ret
+
+0080083e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800844:	6a 00                	push   $0x0
+  800846:	e8 15 21 00 00       	call   802960 <fflush>
+	pthread_kill_others();
+  80084b:	e8 80 37 00 00       	call   803fd0 <pthread_kill_others>
+	close_all();
+  800850:	e8 ae 11 00 00       	call   801a03 <close_all>
+	sys_env_destroy(0);
+  800855:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80085c:	e8 5f 0a 00 00       	call   8012c0 <sys_env_destroy>
+}
+  800861:	83 c4 10             	add    $0x10,%esp
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+
+00800866 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	56                   	push   %esi
+  80086a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80086b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80086e:	8b 35 20 60 80 00    	mov    0x806020,%esi
+  800874:	e8 92 0a 00 00       	call   80130b <sys_getenvid>
+  800879:	83 ec 0c             	sub    $0xc,%esp
+  80087c:	ff 75 0c             	push   0xc(%ebp)
+  80087f:	ff 75 08             	push   0x8(%ebp)
+  800882:	56                   	push   %esi
+  800883:	50                   	push   %eax
+  800884:	68 5c 50 80 00       	push   $0x80505c
+  800889:	e8 b3 00 00 00       	call   800941 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80088e:	83 c4 18             	add    $0x18,%esp
+  800891:	53                   	push   %ebx
+  800892:	ff 75 10             	push   0x10(%ebp)
+  800895:	e8 56 00 00 00       	call   8008f0 <vcprintf>
+	cprintf("\n");
+  80089a:	c7 04 24 c8 4e 80 00 	movl   $0x804ec8,(%esp)
+  8008a1:	e8 9b 00 00 00       	call   800941 <cprintf>
+  8008a6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008a9:	cc                   	int3
+	while (1)
+  8008aa:	eb fd                	jmp    8008a9 <_panic+0x43>
+
+008008ac <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008ac:	55                   	push   %ebp
+  8008ad:	89 e5                	mov    %esp,%ebp
+  8008af:	53                   	push   %ebx
+  8008b0:	83 ec 04             	sub    $0x4,%esp
+  8008b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008b6:	8b 13                	mov    (%ebx),%edx
+  8008b8:	8d 42 01             	lea    0x1(%edx),%eax
+  8008bb:	89 03                	mov    %eax,(%ebx)
+  8008bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008c4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008c9:	74 09                	je     8008d4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8008cb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8008cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8008d4:	83 ec 08             	sub    $0x8,%esp
+  8008d7:	68 ff 00 00 00       	push   $0xff
+  8008dc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8008df:	50                   	push   %eax
+  8008e0:	e8 84 09 00 00       	call   801269 <sys_cputs>
+		b->idx = 0;
+  8008e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8008eb:	83 c4 10             	add    $0x10,%esp
+  8008ee:	eb db                	jmp    8008cb <putch+0x1f>
+
+008008f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8008f9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800900:	00 00 00 
+	b.cnt = 0;
+  800903:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80090a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80090d:	ff 75 0c             	push   0xc(%ebp)
+  800910:	ff 75 08             	push   0x8(%ebp)
+  800913:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800919:	50                   	push   %eax
+  80091a:	68 ac 08 80 00       	push   $0x8008ac
+  80091f:	e8 14 01 00 00       	call   800a38 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800924:	83 c4 08             	add    $0x8,%esp
+  800927:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80092d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800933:	50                   	push   %eax
+  800934:	e8 30 09 00 00       	call   801269 <sys_cputs>
+
+	return b.cnt;
+}
+  800939:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80093f:	c9                   	leave
+  800940:	c3                   	ret
+
+00800941 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800947:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80094a:	50                   	push   %eax
+  80094b:	ff 75 08             	push   0x8(%ebp)
+  80094e:	e8 9d ff ff ff       	call   8008f0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800953:	c9                   	leave
+  800954:	c3                   	ret
+
+00800955 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	57                   	push   %edi
+  800959:	56                   	push   %esi
+  80095a:	53                   	push   %ebx
+  80095b:	83 ec 1c             	sub    $0x1c,%esp
+  80095e:	89 c7                	mov    %eax,%edi
+  800960:	89 d6                	mov    %edx,%esi
+  800962:	8b 45 08             	mov    0x8(%ebp),%eax
+  800965:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800968:	89 d1                	mov    %edx,%ecx
+  80096a:	89 c2                	mov    %eax,%edx
+  80096c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80096f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800972:	8b 45 10             	mov    0x10(%ebp),%eax
+  800975:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800978:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80097b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800982:	39 c2                	cmp    %eax,%edx
+  800984:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800987:	72 3e                	jb     8009c7 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800989:	83 ec 0c             	sub    $0xc,%esp
+  80098c:	ff 75 18             	push   0x18(%ebp)
+  80098f:	83 eb 01             	sub    $0x1,%ebx
+  800992:	53                   	push   %ebx
+  800993:	50                   	push   %eax
+  800994:	83 ec 08             	sub    $0x8,%esp
+  800997:	ff 75 e4             	push   -0x1c(%ebp)
+  80099a:	ff 75 e0             	push   -0x20(%ebp)
+  80099d:	ff 75 dc             	push   -0x24(%ebp)
+  8009a0:	ff 75 d8             	push   -0x28(%ebp)
+  8009a3:	e8 21 43 00 00       	call   804cc9 <__udivdi3>
+  8009a8:	83 c4 18             	add    $0x18,%esp
+  8009ab:	52                   	push   %edx
+  8009ac:	50                   	push   %eax
+  8009ad:	89 f2                	mov    %esi,%edx
+  8009af:	89 f8                	mov    %edi,%eax
+  8009b1:	e8 9f ff ff ff       	call   800955 <printnum>
+  8009b6:	83 c4 20             	add    $0x20,%esp
+  8009b9:	eb 13                	jmp    8009ce <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009bb:	83 ec 08             	sub    $0x8,%esp
+  8009be:	56                   	push   %esi
+  8009bf:	ff 75 18             	push   0x18(%ebp)
+  8009c2:	ff d7                	call   *%edi
+  8009c4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009c7:	83 eb 01             	sub    $0x1,%ebx
+  8009ca:	85 db                	test   %ebx,%ebx
+  8009cc:	7f ed                	jg     8009bb <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009ce:	83 ec 08             	sub    $0x8,%esp
+  8009d1:	56                   	push   %esi
+  8009d2:	83 ec 04             	sub    $0x4,%esp
+  8009d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8009d8:	ff 75 e0             	push   -0x20(%ebp)
+  8009db:	ff 75 dc             	push   -0x24(%ebp)
+  8009de:	ff 75 d8             	push   -0x28(%ebp)
+  8009e1:	e8 04 43 00 00       	call   804cea <__umoddi3>
+  8009e6:	83 c4 14             	add    $0x14,%esp
+  8009e9:	0f be 80 7f 50 80 00 	movsbl 0x80507f(%eax),%eax
+  8009f0:	50                   	push   %eax
+  8009f1:	ff d7                	call   *%edi
+}
+  8009f3:	83 c4 10             	add    $0x10,%esp
+  8009f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009f9:	5b                   	pop    %ebx
+  8009fa:	5e                   	pop    %esi
+  8009fb:	5f                   	pop    %edi
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+
+008009fe <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a04:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a08:	8b 10                	mov    (%eax),%edx
+  800a0a:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a0d:	73 0a                	jae    800a19 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a0f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a12:	89 08                	mov    %ecx,(%eax)
+  800a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a17:	88 02                	mov    %al,(%edx)
+}
+  800a19:	5d                   	pop    %ebp
+  800a1a:	c3                   	ret
+
+00800a1b <printfmt>:
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a21:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a24:	50                   	push   %eax
+  800a25:	ff 75 10             	push   0x10(%ebp)
+  800a28:	ff 75 0c             	push   0xc(%ebp)
+  800a2b:	ff 75 08             	push   0x8(%ebp)
+  800a2e:	e8 05 00 00 00       	call   800a38 <vprintfmt>
+}
+  800a33:	83 c4 10             	add    $0x10,%esp
+  800a36:	c9                   	leave
+  800a37:	c3                   	ret
+
+00800a38 <vprintfmt>:
+{
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	57                   	push   %edi
+  800a3c:	56                   	push   %esi
+  800a3d:	53                   	push   %ebx
+  800a3e:	83 ec 2c             	sub    $0x2c,%esp
+  800a41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a47:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a4a:	eb 0a                	jmp    800a56 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a4c:	83 ec 08             	sub    $0x8,%esp
+  800a4f:	53                   	push   %ebx
+  800a50:	50                   	push   %eax
+  800a51:	ff d6                	call   *%esi
+  800a53:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800a56:	83 c7 01             	add    $0x1,%edi
+  800a59:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800a5d:	83 f8 25             	cmp    $0x25,%eax
+  800a60:	74 0c                	je     800a6e <vprintfmt+0x36>
+			if (ch == '\0')
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	75 e6                	jne    800a4c <vprintfmt+0x14>
+}
+  800a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a69:	5b                   	pop    %ebx
+  800a6a:	5e                   	pop    %esi
+  800a6b:	5f                   	pop    %edi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+		padc = ' ';
+  800a6e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800a72:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a79:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a80:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800a8c:	8d 47 01             	lea    0x1(%edi),%eax
+  800a8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a92:	0f b6 17             	movzbl (%edi),%edx
+  800a95:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800a98:	3c 55                	cmp    $0x55,%al
+  800a9a:	0f 87 c5 03 00 00    	ja     800e65 <vprintfmt+0x42d>
+  800aa0:	0f b6 c0             	movzbl %al,%eax
+  800aa3:	ff 24 85 00 52 80 00 	jmp    *0x805200(,%eax,4)
+  800aaa:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800aad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ab0:	eb da                	jmp    800a8c <vprintfmt+0x54>
+  800ab2:	0f be d2             	movsbl %dl,%edx
+  800ab5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800ac0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ac3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800ac7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800aca:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800acd:	83 f9 09             	cmp    $0x9,%ecx
+  800ad0:	77 55                	ja     800b27 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800ad2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800ad5:	eb e9                	jmp    800ac0 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800ad7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ada:	8b 00                	mov    (%eax),%eax
+  800adc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800adf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800ae8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800aeb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800aef:	79 9b                	jns    800a8c <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800af1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800af4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800af7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800afe:	eb 8c                	jmp    800a8c <vprintfmt+0x54>
+			if (width < 0)
+  800b00:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b03:	85 d2                	test   %edx,%edx
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0a:	0f 49 c2             	cmovns %edx,%eax
+  800b0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800b10:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b13:	e9 74 ff ff ff       	jmp    800a8c <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800b18:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b1b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b22:	e9 65 ff ff ff       	jmp    800a8c <vprintfmt+0x54>
+  800b27:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b2a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b2d:	eb bc                	jmp    800aeb <vprintfmt+0xb3>
+			lflag++;
+  800b2f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800b32:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b35:	e9 52 ff ff ff       	jmp    800a8c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3d:	8d 78 04             	lea    0x4(%eax),%edi
+  800b40:	83 ec 08             	sub    $0x8,%esp
+  800b43:	53                   	push   %ebx
+  800b44:	ff 30                	push   (%eax)
+  800b46:	ff d6                	call   *%esi
+			break;
+  800b48:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800b4b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b4e:	e9 b1 02 00 00       	jmp    800e04 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800b53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b56:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b59:	8b 10                	mov    (%eax),%edx
+  800b5b:	89 d0                	mov    %edx,%eax
+  800b5d:	f7 d8                	neg    %eax
+  800b5f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b62:	83 f8 14             	cmp    $0x14,%eax
+  800b65:	7f 23                	jg     800b8a <vprintfmt+0x152>
+  800b67:	8b 14 85 60 53 80 00 	mov    0x805360(,%eax,4),%edx
+  800b6e:	85 d2                	test   %edx,%edx
+  800b70:	74 18                	je     800b8a <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800b72:	52                   	push   %edx
+  800b73:	68 cf 54 80 00       	push   $0x8054cf
+  800b78:	53                   	push   %ebx
+  800b79:	56                   	push   %esi
+  800b7a:	e8 9c fe ff ff       	call   800a1b <printfmt>
+  800b7f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b82:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800b85:	e9 7a 02 00 00       	jmp    800e04 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800b8a:	50                   	push   %eax
+  800b8b:	68 97 50 80 00       	push   $0x805097
+  800b90:	53                   	push   %ebx
+  800b91:	56                   	push   %esi
+  800b92:	e8 84 fe ff ff       	call   800a1b <printfmt>
+  800b97:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b9a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800b9d:	e9 62 02 00 00       	jmp    800e04 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ba2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba5:	83 c0 04             	add    $0x4,%eax
+  800ba8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800bab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bae:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800bb0:	85 c9                	test   %ecx,%ecx
+  800bb2:	b8 90 50 80 00       	mov    $0x805090,%eax
+  800bb7:	0f 45 c1             	cmovne %ecx,%eax
+  800bba:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800bbd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800bc1:	7e 06                	jle    800bc9 <vprintfmt+0x191>
+  800bc3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800bc7:	75 0b                	jne    800bd4 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bc9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800bcc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800bcf:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bd2:	eb 5c                	jmp    800c30 <vprintfmt+0x1f8>
+  800bd4:	83 ec 08             	sub    $0x8,%esp
+  800bd7:	ff 75 d0             	push   -0x30(%ebp)
+  800bda:	ff 75 cc             	push   -0x34(%ebp)
+  800bdd:	e8 20 03 00 00       	call   800f02 <strnlen>
+  800be2:	89 c2                	mov    %eax,%edx
+  800be4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800be7:	29 d0                	sub    %edx,%eax
+  800be9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800bec:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800bf0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800bf3:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bf6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bf8:	eb 0e                	jmp    800c08 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800bfa:	83 ec 08             	sub    $0x8,%esp
+  800bfd:	53                   	push   %ebx
+  800bfe:	57                   	push   %edi
+  800bff:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c02:	83 ee 01             	sub    $0x1,%esi
+  800c05:	83 c4 10             	add    $0x10,%esp
+  800c08:	85 f6                	test   %esi,%esi
+  800c0a:	7f ee                	jg     800bfa <vprintfmt+0x1c2>
+  800c0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c19:	0f 49 d0             	cmovns %eax,%edx
+  800c1c:	29 d0                	sub    %edx,%eax
+  800c1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c21:	eb a6                	jmp    800bc9 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800c23:	83 ec 08             	sub    $0x8,%esp
+  800c26:	53                   	push   %ebx
+  800c27:	52                   	push   %edx
+  800c28:	ff 55 08             	call   *0x8(%ebp)
+  800c2b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c2e:	89 f1                	mov    %esi,%ecx
+  800c30:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c33:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c37:	0f be d0             	movsbl %al,%edx
+  800c3a:	85 d2                	test   %edx,%edx
+  800c3c:	74 28                	je     800c66 <vprintfmt+0x22e>
+  800c3e:	85 ff                	test   %edi,%edi
+  800c40:	78 05                	js     800c47 <vprintfmt+0x20f>
+  800c42:	83 ef 01             	sub    $0x1,%edi
+  800c45:	78 30                	js     800c77 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c47:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800c4b:	74 d6                	je     800c23 <vprintfmt+0x1eb>
+  800c4d:	0f be c0             	movsbl %al,%eax
+  800c50:	83 e8 20             	sub    $0x20,%eax
+  800c53:	83 f8 5e             	cmp    $0x5e,%eax
+  800c56:	76 cb                	jbe    800c23 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800c58:	83 ec 08             	sub    $0x8,%esp
+  800c5b:	53                   	push   %ebx
+  800c5c:	6a 3f                	push   $0x3f
+  800c5e:	ff 55 08             	call   *0x8(%ebp)
+  800c61:	83 c4 10             	add    $0x10,%esp
+  800c64:	eb c8                	jmp    800c2e <vprintfmt+0x1f6>
+  800c66:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c69:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c6c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c6f:	01 d0                	add    %edx,%eax
+  800c71:	29 c8                	sub    %ecx,%eax
+  800c73:	89 c7                	mov    %eax,%edi
+  800c75:	eb 13                	jmp    800c8a <vprintfmt+0x252>
+  800c77:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c7a:	eb ed                	jmp    800c69 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800c7c:	83 ec 08             	sub    $0x8,%esp
+  800c7f:	53                   	push   %ebx
+  800c80:	6a 20                	push   $0x20
+  800c82:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800c84:	83 ef 01             	sub    $0x1,%edi
+  800c87:	83 c4 10             	add    $0x10,%esp
+  800c8a:	85 ff                	test   %edi,%edi
+  800c8c:	7f ee                	jg     800c7c <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c8e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800c91:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c94:	e9 6b 01 00 00       	jmp    800e04 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800c99:	83 f9 01             	cmp    $0x1,%ecx
+  800c9c:	7f 1f                	jg     800cbd <vprintfmt+0x285>
+	else if (lflag)
+  800c9e:	85 c9                	test   %ecx,%ecx
+  800ca0:	74 67                	je     800d09 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800ca2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca5:	8b 00                	mov    (%eax),%eax
+  800ca7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800caa:	89 c1                	mov    %eax,%ecx
+  800cac:	c1 f9 1f             	sar    $0x1f,%ecx
+  800caf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cb2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb5:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cbb:	eb 17                	jmp    800cd4 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800cbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc0:	8b 50 04             	mov    0x4(%eax),%edx
+  800cc3:	8b 00                	mov    (%eax),%eax
+  800cc5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ccb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cce:	8d 40 08             	lea    0x8(%eax),%eax
+  800cd1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800cd4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800cd7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800cda:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800cdf:	85 c9                	test   %ecx,%ecx
+  800ce1:	0f 89 03 01 00 00    	jns    800dea <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800ce7:	83 ec 08             	sub    $0x8,%esp
+  800cea:	53                   	push   %ebx
+  800ceb:	6a 2d                	push   $0x2d
+  800ced:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800cef:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800cf2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800cf5:	f7 da                	neg    %edx
+  800cf7:	83 d1 00             	adc    $0x0,%ecx
+  800cfa:	f7 d9                	neg    %ecx
+  800cfc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800cff:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d04:	e9 e1 00 00 00       	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8b 00                	mov    (%eax),%eax
+  800d0e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d11:	89 c1                	mov    %eax,%ecx
+  800d13:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d16:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d1c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d1f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d22:	eb b0                	jmp    800cd4 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800d24:	83 f9 01             	cmp    $0x1,%ecx
+  800d27:	7f 1e                	jg     800d47 <vprintfmt+0x30f>
+	else if (lflag)
+  800d29:	85 c9                	test   %ecx,%ecx
+  800d2b:	74 32                	je     800d5f <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800d2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d30:	8b 10                	mov    (%eax),%edx
+  800d32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d37:	8d 40 04             	lea    0x4(%eax),%eax
+  800d3a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d3d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d42:	e9 a3 00 00 00       	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800d47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d4a:	8b 10                	mov    (%eax),%edx
+  800d4c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d4f:	8d 40 08             	lea    0x8(%eax),%eax
+  800d52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d55:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d5a:	e9 8b 00 00 00       	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800d5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d62:	8b 10                	mov    (%eax),%edx
+  800d64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d69:	8d 40 04             	lea    0x4(%eax),%eax
+  800d6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d6f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800d74:	eb 74                	jmp    800dea <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800d76:	83 f9 01             	cmp    $0x1,%ecx
+  800d79:	7f 1b                	jg     800d96 <vprintfmt+0x35e>
+	else if (lflag)
+  800d7b:	85 c9                	test   %ecx,%ecx
+  800d7d:	74 2c                	je     800dab <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800d7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d82:	8b 10                	mov    (%eax),%edx
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	8d 40 04             	lea    0x4(%eax),%eax
+  800d8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800d8f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800d94:	eb 54                	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800d96:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d99:	8b 10                	mov    (%eax),%edx
+  800d9b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d9e:	8d 40 08             	lea    0x8(%eax),%eax
+  800da1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800da4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800da9:	eb 3f                	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800dab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dae:	8b 10                	mov    (%eax),%edx
+  800db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db5:	8d 40 04             	lea    0x4(%eax),%eax
+  800db8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dbb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800dc0:	eb 28                	jmp    800dea <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800dc2:	83 ec 08             	sub    $0x8,%esp
+  800dc5:	53                   	push   %ebx
+  800dc6:	6a 30                	push   $0x30
+  800dc8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800dca:	83 c4 08             	add    $0x8,%esp
+  800dcd:	53                   	push   %ebx
+  800dce:	6a 78                	push   $0x78
+  800dd0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800dd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd5:	8b 10                	mov    (%eax),%edx
+  800dd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800ddc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800ddf:	8d 40 04             	lea    0x4(%eax),%eax
+  800de2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800de5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800df1:	50                   	push   %eax
+  800df2:	ff 75 e0             	push   -0x20(%ebp)
+  800df5:	57                   	push   %edi
+  800df6:	51                   	push   %ecx
+  800df7:	52                   	push   %edx
+  800df8:	89 da                	mov    %ebx,%edx
+  800dfa:	89 f0                	mov    %esi,%eax
+  800dfc:	e8 54 fb ff ff       	call   800955 <printnum>
+			break;
+  800e01:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800e04:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800e07:	e9 4a fc ff ff       	jmp    800a56 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800e0c:	83 f9 01             	cmp    $0x1,%ecx
+  800e0f:	7f 1b                	jg     800e2c <vprintfmt+0x3f4>
+	else if (lflag)
+  800e11:	85 c9                	test   %ecx,%ecx
+  800e13:	74 2c                	je     800e41 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800e15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e18:	8b 10                	mov    (%eax),%edx
+  800e1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800e22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e25:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e2a:	eb be                	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800e2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2f:	8b 10                	mov    (%eax),%edx
+  800e31:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e34:	8d 40 08             	lea    0x8(%eax),%eax
+  800e37:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e3a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e3f:	eb a9                	jmp    800dea <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800e41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e44:	8b 10                	mov    (%eax),%edx
+  800e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4b:	8d 40 04             	lea    0x4(%eax),%eax
+  800e4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e51:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e56:	eb 92                	jmp    800dea <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800e58:	83 ec 08             	sub    $0x8,%esp
+  800e5b:	53                   	push   %ebx
+  800e5c:	6a 25                	push   $0x25
+  800e5e:	ff d6                	call   *%esi
+			break;
+  800e60:	83 c4 10             	add    $0x10,%esp
+  800e63:	eb 9f                	jmp    800e04 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800e65:	83 ec 08             	sub    $0x8,%esp
+  800e68:	53                   	push   %ebx
+  800e69:	6a 25                	push   $0x25
+  800e6b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e6d:	83 c4 10             	add    $0x10,%esp
+  800e70:	89 f8                	mov    %edi,%eax
+  800e72:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800e76:	74 05                	je     800e7d <vprintfmt+0x445>
+  800e78:	83 e8 01             	sub    $0x1,%eax
+  800e7b:	eb f5                	jmp    800e72 <vprintfmt+0x43a>
+  800e7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e80:	eb 82                	jmp    800e04 <vprintfmt+0x3cc>
+
+00800e82 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	83 ec 18             	sub    $0x18,%esp
+  800e88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e8e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e91:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e95:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800e9f:	85 c0                	test   %eax,%eax
+  800ea1:	74 26                	je     800ec9 <vsnprintf+0x47>
+  800ea3:	85 d2                	test   %edx,%edx
+  800ea5:	7e 22                	jle    800ec9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ea7:	ff 75 14             	push   0x14(%ebp)
+  800eaa:	ff 75 10             	push   0x10(%ebp)
+  800ead:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800eb0:	50                   	push   %eax
+  800eb1:	68 fe 09 80 00       	push   $0x8009fe
+  800eb6:	e8 7d fb ff ff       	call   800a38 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ebb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ebe:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ec1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ec4:	83 c4 10             	add    $0x10,%esp
+}
+  800ec7:	c9                   	leave
+  800ec8:	c3                   	ret
+		return -E_INVAL;
+  800ec9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ece:	eb f7                	jmp    800ec7 <vsnprintf+0x45>
+
+00800ed0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ed6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ed9:	50                   	push   %eax
+  800eda:	ff 75 10             	push   0x10(%ebp)
+  800edd:	ff 75 0c             	push   0xc(%ebp)
+  800ee0:	ff 75 08             	push   0x8(%ebp)
+  800ee3:	e8 9a ff ff ff       	call   800e82 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ee8:	c9                   	leave
+  800ee9:	c3                   	ret
+
+00800eea <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef5:	eb 03                	jmp    800efa <strlen+0x10>
+		n++;
+  800ef7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800efa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800efe:	75 f7                	jne    800ef7 <strlen+0xd>
+	return n;
+}
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+
+00800f02 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f10:	eb 03                	jmp    800f15 <strnlen+0x13>
+		n++;
+  800f12:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f15:	39 d0                	cmp    %edx,%eax
+  800f17:	74 08                	je     800f21 <strnlen+0x1f>
+  800f19:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800f1d:	75 f3                	jne    800f12 <strnlen+0x10>
+  800f1f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800f21:	89 d0                	mov    %edx,%eax
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+
+00800f25 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	53                   	push   %ebx
+  800f29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f34:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f38:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f3b:	83 c0 01             	add    $0x1,%eax
+  800f3e:	84 d2                	test   %dl,%dl
+  800f40:	75 f2                	jne    800f34 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f42:	89 c8                	mov    %ecx,%eax
+  800f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f47:	c9                   	leave
+  800f48:	c3                   	ret
+
+00800f49 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	53                   	push   %ebx
+  800f4d:	83 ec 10             	sub    $0x10,%esp
+  800f50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f53:	53                   	push   %ebx
+  800f54:	e8 91 ff ff ff       	call   800eea <strlen>
+  800f59:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f5c:	ff 75 0c             	push   0xc(%ebp)
+  800f5f:	01 d8                	add    %ebx,%eax
+  800f61:	50                   	push   %eax
+  800f62:	e8 be ff ff ff       	call   800f25 <strcpy>
+	return dst;
+}
+  800f67:	89 d8                	mov    %ebx,%eax
+  800f69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f6c:	c9                   	leave
+  800f6d:	c3                   	ret
+
+00800f6e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	56                   	push   %esi
+  800f72:	53                   	push   %ebx
+  800f73:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f76:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f79:	89 f3                	mov    %esi,%ebx
+  800f7b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800f7e:	89 f0                	mov    %esi,%eax
+  800f80:	eb 0f                	jmp    800f91 <strncpy+0x23>
+		*dst++ = *src;
+  800f82:	83 c0 01             	add    $0x1,%eax
+  800f85:	0f b6 0a             	movzbl (%edx),%ecx
+  800f88:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800f8b:	80 f9 01             	cmp    $0x1,%cl
+  800f8e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800f91:	39 d8                	cmp    %ebx,%eax
+  800f93:	75 ed                	jne    800f82 <strncpy+0x14>
+	}
+	return ret;
+}
+  800f95:	89 f0                	mov    %esi,%eax
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	56                   	push   %esi
+  800f9f:	53                   	push   %ebx
+  800fa0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800fa9:	89 f0                	mov    %esi,%eax
+  800fab:	85 d2                	test   %edx,%edx
+  800fad:	74 21                	je     800fd0 <strlcpy+0x35>
+  800faf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800fb3:	89 f2                	mov    %esi,%edx
+  800fb5:	eb 09                	jmp    800fc0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800fb7:	83 c1 01             	add    $0x1,%ecx
+  800fba:	83 c2 01             	add    $0x1,%edx
+  800fbd:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800fc0:	39 c2                	cmp    %eax,%edx
+  800fc2:	74 09                	je     800fcd <strlcpy+0x32>
+  800fc4:	0f b6 19             	movzbl (%ecx),%ebx
+  800fc7:	84 db                	test   %bl,%bl
+  800fc9:	75 ec                	jne    800fb7 <strlcpy+0x1c>
+  800fcb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800fcd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800fd0:	29 f0                	sub    %esi,%eax
+}
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+
+00800fd6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800fdf:	eb 06                	jmp    800fe7 <strcmp+0x11>
+		p++, q++;
+  800fe1:	83 c1 01             	add    $0x1,%ecx
+  800fe4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800fe7:	0f b6 01             	movzbl (%ecx),%eax
+  800fea:	84 c0                	test   %al,%al
+  800fec:	74 04                	je     800ff2 <strcmp+0x1c>
+  800fee:	3a 02                	cmp    (%edx),%al
+  800ff0:	74 ef                	je     800fe1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ff2:	0f b6 c0             	movzbl %al,%eax
+  800ff5:	0f b6 12             	movzbl (%edx),%edx
+  800ff8:	29 d0                	sub    %edx,%eax
+}
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+
+00800ffc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	53                   	push   %ebx
+  801000:	8b 45 08             	mov    0x8(%ebp),%eax
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801009:	eb 09                	jmp    801014 <strncmp+0x18>
+		n--, p++, q++;
+  80100b:	83 ea 01             	sub    $0x1,%edx
+  80100e:	83 c0 01             	add    $0x1,%eax
+  801011:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801014:	85 d2                	test   %edx,%edx
+  801016:	74 18                	je     801030 <strncmp+0x34>
+  801018:	0f b6 18             	movzbl (%eax),%ebx
+  80101b:	84 db                	test   %bl,%bl
+  80101d:	74 04                	je     801023 <strncmp+0x27>
+  80101f:	3a 19                	cmp    (%ecx),%bl
+  801021:	74 e8                	je     80100b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801023:	0f b6 00             	movzbl (%eax),%eax
+  801026:	0f b6 11             	movzbl (%ecx),%edx
+  801029:	29 d0                	sub    %edx,%eax
+}
+  80102b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80102e:	c9                   	leave
+  80102f:	c3                   	ret
+		return 0;
+  801030:	b8 00 00 00 00       	mov    $0x0,%eax
+  801035:	eb f4                	jmp    80102b <strncmp+0x2f>
+
+00801037 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801041:	eb 03                	jmp    801046 <strchr+0xf>
+  801043:	83 c0 01             	add    $0x1,%eax
+  801046:	0f b6 10             	movzbl (%eax),%edx
+  801049:	84 d2                	test   %dl,%dl
+  80104b:	74 06                	je     801053 <strchr+0x1c>
+		if (*s == c)
+  80104d:	38 ca                	cmp    %cl,%dl
+  80104f:	75 f2                	jne    801043 <strchr+0xc>
+  801051:	eb 05                	jmp    801058 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801053:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801058:	5d                   	pop    %ebp
+  801059:	c3                   	ret
+
+0080105a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801060:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801064:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801067:	38 ca                	cmp    %cl,%dl
+  801069:	74 09                	je     801074 <strfind+0x1a>
+  80106b:	84 d2                	test   %dl,%dl
+  80106d:	74 05                	je     801074 <strfind+0x1a>
+	for (; *s; s++)
+  80106f:	83 c0 01             	add    $0x1,%eax
+  801072:	eb f0                	jmp    801064 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+
+00801076 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80107d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801080:	85 c9                	test   %ecx,%ecx
+  801082:	74 20                	je     8010a4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801084:	89 f8                	mov    %edi,%eax
+  801086:	09 c8                	or     %ecx,%eax
+  801088:	a8 03                	test   $0x3,%al
+  80108a:	75 12                	jne    80109e <memset+0x28>
+		c &= 0xFF;
+  80108c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801090:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801096:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801099:	fc                   	cld
+  80109a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80109c:	eb 06                	jmp    8010a4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80109e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010a1:	fc                   	cld
+  8010a2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010a4:	89 f8                	mov    %edi,%eax
+  8010a6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8010a9:	c9                   	leave
+  8010aa:	c3                   	ret
+
+008010ab <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	57                   	push   %edi
+  8010af:	56                   	push   %esi
+  8010b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010b6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010b9:	39 c6                	cmp    %eax,%esi
+  8010bb:	73 32                	jae    8010ef <memmove+0x44>
+  8010bd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8010c0:	39 d0                	cmp    %edx,%eax
+  8010c2:	73 2b                	jae    8010ef <memmove+0x44>
+		s += n;
+		d += n;
+  8010c4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010c7:	89 d6                	mov    %edx,%esi
+  8010c9:	09 fe                	or     %edi,%esi
+  8010cb:	09 ce                	or     %ecx,%esi
+  8010cd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8010d3:	75 0e                	jne    8010e3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8010d5:	83 ef 04             	sub    $0x4,%edi
+  8010d8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010db:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8010de:	fd                   	std
+  8010df:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010e1:	eb 09                	jmp    8010ec <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8010e3:	83 ef 01             	sub    $0x1,%edi
+  8010e6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8010e9:	fd                   	std
+  8010ea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8010ec:	fc                   	cld
+  8010ed:	eb 1a                	jmp    801109 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010ef:	89 f2                	mov    %esi,%edx
+  8010f1:	09 c2                	or     %eax,%edx
+  8010f3:	09 ca                	or     %ecx,%edx
+  8010f5:	f6 c2 03             	test   $0x3,%dl
+  8010f8:	75 0a                	jne    801104 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8010fa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8010fd:	89 c7                	mov    %eax,%edi
+  8010ff:	fc                   	cld
+  801100:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801102:	eb 05                	jmp    801109 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801104:	89 c7                	mov    %eax,%edi
+  801106:	fc                   	cld
+  801107:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+
+0080110d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801113:	ff 75 10             	push   0x10(%ebp)
+  801116:	ff 75 0c             	push   0xc(%ebp)
+  801119:	ff 75 08             	push   0x8(%ebp)
+  80111c:	e8 8a ff ff ff       	call   8010ab <memmove>
+}
+  801121:	c9                   	leave
+  801122:	c3                   	ret
+
+00801123 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801123:	55                   	push   %ebp
+  801124:	89 e5                	mov    %esp,%ebp
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80112e:	89 c6                	mov    %eax,%esi
+  801130:	03 75 10             	add    0x10(%ebp),%esi
+  801133:	eb 06                	jmp    80113b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801135:	83 c0 01             	add    $0x1,%eax
+  801138:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80113b:	39 f0                	cmp    %esi,%eax
+  80113d:	74 14                	je     801153 <memcmp+0x30>
+		if (*s1 != *s2)
+  80113f:	0f b6 08             	movzbl (%eax),%ecx
+  801142:	0f b6 1a             	movzbl (%edx),%ebx
+  801145:	38 d9                	cmp    %bl,%cl
+  801147:	74 ec                	je     801135 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801149:	0f b6 c1             	movzbl %cl,%eax
+  80114c:	0f b6 db             	movzbl %bl,%ebx
+  80114f:	29 d8                	sub    %ebx,%eax
+  801151:	eb 05                	jmp    801158 <memcmp+0x35>
+	}
+
+	return 0;
+  801153:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801158:	5b                   	pop    %ebx
+  801159:	5e                   	pop    %esi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+
+0080115c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801162:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801165:	89 c2                	mov    %eax,%edx
+  801167:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80116a:	eb 03                	jmp    80116f <memfind+0x13>
+  80116c:	83 c0 01             	add    $0x1,%eax
+  80116f:	39 d0                	cmp    %edx,%eax
+  801171:	73 04                	jae    801177 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801173:	38 08                	cmp    %cl,(%eax)
+  801175:	75 f5                	jne    80116c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801177:	5d                   	pop    %ebp
+  801178:	c3                   	ret
+
+00801179 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801185:	eb 03                	jmp    80118a <strtol+0x11>
+		s++;
+  801187:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80118a:	0f b6 02             	movzbl (%edx),%eax
+  80118d:	3c 20                	cmp    $0x20,%al
+  80118f:	74 f6                	je     801187 <strtol+0xe>
+  801191:	3c 09                	cmp    $0x9,%al
+  801193:	74 f2                	je     801187 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801195:	3c 2b                	cmp    $0x2b,%al
+  801197:	74 2a                	je     8011c3 <strtol+0x4a>
+	int neg = 0;
+  801199:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80119e:	3c 2d                	cmp    $0x2d,%al
+  8011a0:	74 2b                	je     8011cd <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011a2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8011a8:	75 0f                	jne    8011b9 <strtol+0x40>
+  8011aa:	80 3a 30             	cmpb   $0x30,(%edx)
+  8011ad:	74 28                	je     8011d7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011af:	85 db                	test   %ebx,%ebx
+  8011b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011b6:	0f 44 d8             	cmove  %eax,%ebx
+  8011b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011be:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011c1:	eb 46                	jmp    801209 <strtol+0x90>
+		s++;
+  8011c3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011cb:	eb d5                	jmp    8011a2 <strtol+0x29>
+		s++, neg = 1;
+  8011cd:	83 c2 01             	add    $0x1,%edx
+  8011d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011d5:	eb cb                	jmp    8011a2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011d7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011db:	74 0e                	je     8011eb <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8011dd:	85 db                	test   %ebx,%ebx
+  8011df:	75 d8                	jne    8011b9 <strtol+0x40>
+		s++, base = 8;
+  8011e1:	83 c2 01             	add    $0x1,%edx
+  8011e4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8011e9:	eb ce                	jmp    8011b9 <strtol+0x40>
+		s += 2, base = 16;
+  8011eb:	83 c2 02             	add    $0x2,%edx
+  8011ee:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8011f3:	eb c4                	jmp    8011b9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8011f5:	0f be c0             	movsbl %al,%eax
+  8011f8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8011fb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8011fe:	7d 3a                	jge    80123a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801200:	83 c2 01             	add    $0x1,%edx
+  801203:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801207:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801209:	0f b6 02             	movzbl (%edx),%eax
+  80120c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80120f:	89 f3                	mov    %esi,%ebx
+  801211:	80 fb 09             	cmp    $0x9,%bl
+  801214:	76 df                	jbe    8011f5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801216:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801219:	89 f3                	mov    %esi,%ebx
+  80121b:	80 fb 19             	cmp    $0x19,%bl
+  80121e:	77 08                	ja     801228 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801220:	0f be c0             	movsbl %al,%eax
+  801223:	83 e8 57             	sub    $0x57,%eax
+  801226:	eb d3                	jmp    8011fb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801228:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80122b:	89 f3                	mov    %esi,%ebx
+  80122d:	80 fb 19             	cmp    $0x19,%bl
+  801230:	77 08                	ja     80123a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801232:	0f be c0             	movsbl %al,%eax
+  801235:	83 e8 37             	sub    $0x37,%eax
+  801238:	eb c1                	jmp    8011fb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80123a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80123e:	74 05                	je     801245 <strtol+0xcc>
+		*endptr = (char *) s;
+  801240:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801243:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801245:	89 c8                	mov    %ecx,%eax
+  801247:	f7 d8                	neg    %eax
+  801249:	85 ff                	test   %edi,%edi
+  80124b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80124e:	89 c8                	mov    %ecx,%eax
+  801250:	5b                   	pop    %ebx
+  801251:	5e                   	pop    %esi
+  801252:	5f                   	pop    %edi
+  801253:	5d                   	pop    %ebp
+  801254:	c3                   	ret
+
+00801255 <atoi>:
+
+int
+atoi(const char* s)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  80125b:	6a 00                	push   $0x0
+  80125d:	6a 00                	push   $0x0
+  80125f:	ff 75 08             	push   0x8(%ebp)
+  801262:	e8 12 ff ff ff       	call   801179 <strtol>
+}
+  801267:	c9                   	leave
+  801268:	c3                   	ret
+
+00801269 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	57                   	push   %edi
+  80126d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	89 c3                	mov    %eax,%ebx
+  80127b:	89 c7                	mov    %eax,%edi
+  80127d:	6a 00                	push   $0x0
+  80127f:	55                   	push   %ebp
+  801280:	56                   	push   %esi
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	8d 35 8b 12 80 00    	lea    0x80128b,%esi
+  801289:	0f 34                	sysenter
+
+0080128b <after_sysenter_label_47>:
+  80128b:	5e                   	pop    %esi
+  80128c:	5d                   	pop    %ebp
+  80128d:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801290:	5b                   	pop    %ebx
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+
+00801294 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	57                   	push   %edi
+  801298:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a3:	89 d1                	mov    %edx,%ecx
+  8012a5:	89 d3                	mov    %edx,%ebx
+  8012a7:	89 d7                	mov    %edx,%edi
+  8012a9:	6a 00                	push   $0x0
+  8012ab:	55                   	push   %ebp
+  8012ac:	56                   	push   %esi
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	8d 35 b7 12 80 00    	lea    0x8012b7,%esi
+  8012b5:	0f 34                	sysenter
+
+008012b7 <after_sysenter_label_128>:
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8012bc:	5b                   	pop    %ebx
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+
+008012c0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012d2:	89 cb                	mov    %ecx,%ebx
+  8012d4:	89 cf                	mov    %ecx,%edi
+  8012d6:	6a 00                	push   $0x0
+  8012d8:	55                   	push   %ebp
+  8012d9:	56                   	push   %esi
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	8d 35 e4 12 80 00    	lea    0x8012e4,%esi
+  8012e2:	0f 34                	sysenter
+
+008012e4 <after_sysenter_label_212>:
+  8012e4:	5e                   	pop    %esi
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012e9:	85 c0                	test   %eax,%eax
+  8012eb:	7f 07                	jg     8012f4 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8012ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5f                   	pop    %edi
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	50                   	push   %eax
+  8012f8:	6a 03                	push   $0x3
+  8012fa:	68 f5 53 80 00       	push   $0x8053f5
+  8012ff:	6a 54                	push   $0x54
+  801301:	68 12 54 80 00       	push   $0x805412
+  801306:	e8 5b f5 ff ff       	call   800866 <_panic>
+
+0080130b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	57                   	push   %edi
+  80130f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801310:	ba 00 00 00 00       	mov    $0x0,%edx
+  801315:	b8 02 00 00 00       	mov    $0x2,%eax
+  80131a:	89 d1                	mov    %edx,%ecx
+  80131c:	89 d3                	mov    %edx,%ebx
+  80131e:	89 d7                	mov    %edx,%edi
+  801320:	6a 00                	push   $0x0
+  801322:	55                   	push   %ebp
+  801323:	56                   	push   %esi
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	8d 35 2e 13 80 00    	lea    0x80132e,%esi
+  80132c:	0f 34                	sysenter
+
+0080132e <after_sysenter_label_309>:
+  80132e:	5e                   	pop    %esi
+  80132f:	5d                   	pop    %ebp
+  801330:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801333:	5b                   	pop    %ebx
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+
+00801337 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	57                   	push   %edi
+  80133b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80133c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801341:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801346:	89 d1                	mov    %edx,%ecx
+  801348:	89 d3                	mov    %edx,%ebx
+  80134a:	89 d7                	mov    %edx,%edi
+  80134c:	6a 00                	push   $0x0
+  80134e:	55                   	push   %ebp
+  80134f:	56                   	push   %esi
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	8d 35 5a 13 80 00    	lea    0x80135a,%esi
+  801358:	0f 34                	sysenter
+
+0080135a <after_sysenter_label_391>:
+  80135a:	5e                   	pop    %esi
+  80135b:	5d                   	pop    %ebp
+  80135c:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80135f:	5b                   	pop    %ebx
+  801360:	5f                   	pop    %edi
+  801361:	5d                   	pop    %ebp
+  801362:	c3                   	ret
+
+00801363 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	57                   	push   %edi
+  801367:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801368:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801373:	bf 00 00 00 00       	mov    $0x0,%edi
+  801378:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137b:	6a 00                	push   $0x0
+  80137d:	55                   	push   %ebp
+  80137e:	56                   	push   %esi
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	8d 35 89 13 80 00    	lea    0x801389,%esi
+  801387:	0f 34                	sysenter
+
+00801389 <after_sysenter_label_479>:
+  801389:	5e                   	pop    %esi
+  80138a:	5d                   	pop    %ebp
+  80138b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	7f 07                	jg     801399 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801392:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801395:	5b                   	pop    %ebx
+  801396:	5f                   	pop    %edi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801399:	83 ec 0c             	sub    $0xc,%esp
+  80139c:	50                   	push   %eax
+  80139d:	6a 04                	push   $0x4
+  80139f:	68 f5 53 80 00       	push   $0x8053f5
+  8013a4:	6a 54                	push   $0x54
+  8013a6:	68 12 54 80 00       	push   $0x805412
+  8013ab:	e8 b6 f4 ff ff       	call   800866 <_panic>
+
+008013b0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8013b0:	55                   	push   %ebp
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	57                   	push   %edi
+  8013b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c6:	ff 75 18             	push   0x18(%ebp)
+  8013c9:	55                   	push   %ebp
+  8013ca:	56                   	push   %esi
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	8d 35 d5 13 80 00    	lea    0x8013d5,%esi
+  8013d3:	0f 34                	sysenter
+
+008013d5 <after_sysenter_label_593>:
+  8013d5:	5e                   	pop    %esi
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013da:	85 c0                	test   %eax,%eax
+  8013dc:	7f 07                	jg     8013e5 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8013de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5f                   	pop    %edi
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e5:	83 ec 0c             	sub    $0xc,%esp
+  8013e8:	50                   	push   %eax
+  8013e9:	6a 05                	push   $0x5
+  8013eb:	68 f5 53 80 00       	push   $0x8053f5
+  8013f0:	6a 54                	push   $0x54
+  8013f2:	68 12 54 80 00       	push   $0x805412
+  8013f7:	e8 6a f4 ff ff       	call   800866 <_panic>
+
+008013fc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	57                   	push   %edi
+  801400:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801401:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801411:	89 df                	mov    %ebx,%edi
+  801413:	6a 00                	push   $0x0
+  801415:	55                   	push   %ebp
+  801416:	56                   	push   %esi
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	8d 35 21 14 80 00    	lea    0x801421,%esi
+  80141f:	0f 34                	sysenter
+
+00801421 <after_sysenter_label_704>:
+  801421:	5e                   	pop    %esi
+  801422:	5d                   	pop    %ebp
+  801423:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801426:	85 c0                	test   %eax,%eax
+  801428:	7f 07                	jg     801431 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80142a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142d:	5b                   	pop    %ebx
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	50                   	push   %eax
+  801435:	6a 06                	push   $0x6
+  801437:	68 f5 53 80 00       	push   $0x8053f5
+  80143c:	6a 54                	push   $0x54
+  80143e:	68 12 54 80 00       	push   $0x805412
+  801443:	e8 1e f4 ff ff       	call   800866 <_panic>
+
+00801448 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	57                   	push   %edi
+  80144c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80144d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801452:	8b 55 08             	mov    0x8(%ebp),%edx
+  801455:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801458:	b8 08 00 00 00       	mov    $0x8,%eax
+  80145d:	89 df                	mov    %ebx,%edi
+  80145f:	6a 00                	push   $0x0
+  801461:	55                   	push   %ebp
+  801462:	56                   	push   %esi
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	8d 35 6d 14 80 00    	lea    0x80146d,%esi
+  80146b:	0f 34                	sysenter
+
+0080146d <after_sysenter_label_808>:
+  80146d:	5e                   	pop    %esi
+  80146e:	5d                   	pop    %ebp
+  80146f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801472:	85 c0                	test   %eax,%eax
+  801474:	7f 07                	jg     80147d <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801476:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801479:	5b                   	pop    %ebx
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80147d:	83 ec 0c             	sub    $0xc,%esp
+  801480:	50                   	push   %eax
+  801481:	6a 08                	push   $0x8
+  801483:	68 f5 53 80 00       	push   $0x8053f5
+  801488:	6a 54                	push   $0x54
+  80148a:	68 12 54 80 00       	push   $0x805412
+  80148f:	e8 d2 f3 ff ff       	call   800866 <_panic>
+
+00801494 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014a9:	89 df                	mov    %ebx,%edi
+  8014ab:	6a 00                	push   $0x0
+  8014ad:	55                   	push   %ebp
+  8014ae:	56                   	push   %esi
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	8d 35 b9 14 80 00    	lea    0x8014b9,%esi
+  8014b7:	0f 34                	sysenter
+
+008014b9 <after_sysenter_label_912>:
+  8014b9:	5e                   	pop    %esi
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	7f 07                	jg     8014c9 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8014c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014c9:	83 ec 0c             	sub    $0xc,%esp
+  8014cc:	50                   	push   %eax
+  8014cd:	6a 09                	push   $0x9
+  8014cf:	68 f5 53 80 00       	push   $0x8053f5
+  8014d4:	6a 54                	push   $0x54
+  8014d6:	68 12 54 80 00       	push   $0x805412
+  8014db:	e8 86 f3 ff ff       	call   800866 <_panic>
+
+008014e0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014f5:	89 df                	mov    %ebx,%edi
+  8014f7:	6a 00                	push   $0x0
+  8014f9:	55                   	push   %ebp
+  8014fa:	56                   	push   %esi
+  8014fb:	89 e5                	mov    %esp,%ebp
+  8014fd:	8d 35 05 15 80 00    	lea    0x801505,%esi
+  801503:	0f 34                	sysenter
+
+00801505 <after_sysenter_label_1016>:
+  801505:	5e                   	pop    %esi
+  801506:	5d                   	pop    %ebp
+  801507:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	7f 07                	jg     801515 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80150e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801511:	5b                   	pop    %ebx
+  801512:	5f                   	pop    %edi
+  801513:	5d                   	pop    %ebp
+  801514:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801515:	83 ec 0c             	sub    $0xc,%esp
+  801518:	50                   	push   %eax
+  801519:	6a 0a                	push   $0xa
+  80151b:	68 f5 53 80 00       	push   $0x8053f5
+  801520:	6a 54                	push   $0x54
+  801522:	68 12 54 80 00       	push   $0x805412
+  801527:	e8 3a f3 ff ff       	call   800866 <_panic>
+
+0080152c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80153c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801542:	6a 00                	push   $0x0
+  801544:	55                   	push   %ebp
+  801545:	56                   	push   %esi
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	8d 35 50 15 80 00    	lea    0x801550,%esi
+  80154e:	0f 34                	sysenter
+
+00801550 <after_sysenter_label_1126>:
+  801550:	5e                   	pop    %esi
+  801551:	5d                   	pop    %ebp
+  801552:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801555:	5b                   	pop    %ebx
+  801556:	5f                   	pop    %edi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+
+00801559 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801559:	55                   	push   %ebp
+  80155a:	89 e5                	mov    %esp,%ebp
+  80155c:	57                   	push   %edi
+  80155d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801566:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80156b:	89 cb                	mov    %ecx,%ebx
+  80156d:	89 cf                	mov    %ecx,%edi
+  80156f:	6a 00                	push   $0x0
+  801571:	55                   	push   %ebp
+  801572:	56                   	push   %esi
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	8d 35 7d 15 80 00    	lea    0x80157d,%esi
+  80157b:	0f 34                	sysenter
+
+0080157d <after_sysenter_label_1210>:
+  80157d:	5e                   	pop    %esi
+  80157e:	5d                   	pop    %ebp
+  80157f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801582:	85 c0                	test   %eax,%eax
+  801584:	7f 07                	jg     80158d <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801586:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801589:	5b                   	pop    %ebx
+  80158a:	5f                   	pop    %edi
+  80158b:	5d                   	pop    %ebp
+  80158c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158d:	83 ec 0c             	sub    $0xc,%esp
+  801590:	50                   	push   %eax
+  801591:	6a 0d                	push   $0xd
+  801593:	68 f5 53 80 00       	push   $0x8053f5
+  801598:	6a 54                	push   $0x54
+  80159a:	68 12 54 80 00       	push   $0x805412
+  80159f:	e8 c2 f2 ff ff       	call   800866 <_panic>
+
+008015a4 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b4:	b8 42 00 00 00       	mov    $0x42,%eax
+  8015b9:	89 df                	mov    %ebx,%edi
+  8015bb:	6a 00                	push   $0x0
+  8015bd:	55                   	push   %ebp
+  8015be:	56                   	push   %esi
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	8d 35 c9 15 80 00    	lea    0x8015c9,%esi
+  8015c7:	0f 34                	sysenter
+
+008015c9 <after_sysenter_label_1311>:
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5d                   	pop    %ebp
+  8015cb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	7f 07                	jg     8015d9 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8015d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d5:	5b                   	pop    %ebx
+  8015d6:	5f                   	pop    %edi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+  8015dc:	50                   	push   %eax
+  8015dd:	6a 42                	push   $0x42
+  8015df:	68 f5 53 80 00       	push   $0x8053f5
+  8015e4:	6a 54                	push   $0x54
+  8015e6:	68 12 54 80 00       	push   $0x805412
+  8015eb:	e8 76 f2 ff ff       	call   800866 <_panic>
+
+008015f0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	57                   	push   %edi
+  8015f4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015ff:	89 d1                	mov    %edx,%ecx
+  801601:	89 d3                	mov    %edx,%ebx
+  801603:	89 d7                	mov    %edx,%edi
+  801605:	6a 00                	push   $0x0
+  801607:	55                   	push   %ebp
+  801608:	56                   	push   %esi
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	8d 35 13 16 80 00    	lea    0x801613,%esi
+  801611:	0f 34                	sysenter
+
+00801613 <after_sysenter_label_1411>:
+  801613:	5e                   	pop    %esi
+  801614:	5d                   	pop    %ebp
+  801615:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801618:	5b                   	pop    %ebx
+  801619:	5f                   	pop    %edi
+  80161a:	5d                   	pop    %ebp
+  80161b:	c3                   	ret
+
+0080161c <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	57                   	push   %edi
+  801620:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801621:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801626:	8b 55 08             	mov    0x8(%ebp),%edx
+  801629:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801631:	89 df                	mov    %ebx,%edi
+  801633:	6a 00                	push   $0x0
+  801635:	55                   	push   %ebp
+  801636:	56                   	push   %esi
+  801637:	89 e5                	mov    %esp,%ebp
+  801639:	8d 35 41 16 80 00    	lea    0x801641,%esi
+  80163f:	0f 34                	sysenter
+
+00801641 <after_sysenter_label_1497>:
+  801641:	5e                   	pop    %esi
+  801642:	5d                   	pop    %ebp
+  801643:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801646:	5b                   	pop    %ebx
+  801647:	5f                   	pop    %edi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+
+0080164a <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	57                   	push   %edi
+  80164e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80164f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801654:	8b 55 08             	mov    0x8(%ebp),%edx
+  801657:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80165f:	89 df                	mov    %ebx,%edi
+  801661:	6a 00                	push   $0x0
+  801663:	55                   	push   %ebp
+  801664:	56                   	push   %esi
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	8d 35 6f 16 80 00    	lea    0x80166f,%esi
+  80166d:	0f 34                	sysenter
+
+0080166f <after_sysenter_label_1583>:
+  80166f:	5e                   	pop    %esi
+  801670:	5d                   	pop    %ebp
+  801671:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801674:	5b                   	pop    %ebx
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+
+00801678 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	57                   	push   %edi
+  80167c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80167d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801680:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801683:	b8 11 00 00 00       	mov    $0x11,%eax
+  801688:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801690:	6a 00                	push   $0x0
+  801692:	55                   	push   %ebp
+  801693:	56                   	push   %esi
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	8d 35 9e 16 80 00    	lea    0x80169e,%esi
+  80169c:	0f 34                	sysenter
+
+0080169e <after_sysenter_label_1672>:
+  80169e:	5e                   	pop    %esi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8016a3:	5b                   	pop    %ebx
+  8016a4:	5f                   	pop    %edi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+
+008016a7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	57                   	push   %edi
+  8016ab:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8016ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016bc:	89 df                	mov    %ebx,%edi
+  8016be:	6a 00                	push   $0x0
+  8016c0:	55                   	push   %ebp
+  8016c1:	56                   	push   %esi
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	8d 35 cc 16 80 00    	lea    0x8016cc,%esi
+  8016ca:	0f 34                	sysenter
+
+008016cc <after_sysenter_label_1758>:
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5d                   	pop    %ebp
+  8016ce:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8016d1:	5b                   	pop    %ebx
+  8016d2:	5f                   	pop    %edi
+  8016d3:	5d                   	pop    %ebp
+  8016d4:	c3                   	ret
+
+008016d5 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	57                   	push   %edi
+  8016d9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8016da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016e2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016e7:	89 cb                	mov    %ecx,%ebx
+  8016e9:	89 cf                	mov    %ecx,%edi
+  8016eb:	6a 00                	push   $0x0
+  8016ed:	55                   	push   %ebp
+  8016ee:	56                   	push   %esi
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	8d 35 f9 16 80 00    	lea    0x8016f9,%esi
+  8016f7:	0f 34                	sysenter
+
+008016f9 <after_sysenter_label_1842>:
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	7f 07                	jg     801709 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801702:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801705:	5b                   	pop    %ebx
+  801706:	5f                   	pop    %edi
+  801707:	5d                   	pop    %ebp
+  801708:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801709:	83 ec 0c             	sub    $0xc,%esp
+  80170c:	50                   	push   %eax
+  80170d:	6a 13                	push   $0x13
+  80170f:	68 f5 53 80 00       	push   $0x8053f5
+  801714:	6a 54                	push   $0x54
+  801716:	68 12 54 80 00       	push   $0x805412
+  80171b:	e8 46 f1 ff ff       	call   800866 <_panic>
+
+00801720 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801720:	55                   	push   %ebp
+  801721:	89 e5                	mov    %esp,%ebp
+  801723:	57                   	push   %edi
+  801724:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80172f:	89 d1                	mov    %edx,%ecx
+  801731:	89 d3                	mov    %edx,%ebx
+  801733:	89 d7                	mov    %edx,%edi
+  801735:	6a 00                	push   $0x0
+  801737:	55                   	push   %ebp
+  801738:	56                   	push   %esi
+  801739:	89 e5                	mov    %esp,%ebp
+  80173b:	8d 35 43 17 80 00    	lea    0x801743,%esi
+  801741:	0f 34                	sysenter
+
+00801743 <after_sysenter_label_1939>:
+  801743:	5e                   	pop    %esi
+  801744:	5d                   	pop    %ebp
+  801745:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801748:	5b                   	pop    %ebx
+  801749:	5f                   	pop    %edi
+  80174a:	5d                   	pop    %ebp
+  80174b:	c3                   	ret
+
+0080174c <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	57                   	push   %edi
+  801750:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801757:	b8 15 00 00 00       	mov    $0x15,%eax
+  80175c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801761:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801764:	6a 00                	push   $0x0
+  801766:	55                   	push   %ebp
+  801767:	56                   	push   %esi
+  801768:	89 e5                	mov    %esp,%ebp
+  80176a:	8d 35 72 17 80 00    	lea    0x801772,%esi
+  801770:	0f 34                	sysenter
+
+00801772 <after_sysenter_label_2028>:
+  801772:	5e                   	pop    %esi
+  801773:	5d                   	pop    %ebp
+  801774:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801777:	5b                   	pop    %ebx
+  801778:	5f                   	pop    %edi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+
+0080177b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80177b:	55                   	push   %ebp
+  80177c:	89 e5                	mov    %esp,%ebp
+  80177e:	57                   	push   %edi
+  80177f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801785:	8b 55 08             	mov    0x8(%ebp),%edx
+  801788:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801790:	89 df                	mov    %ebx,%edi
+  801792:	6a 00                	push   $0x0
+  801794:	55                   	push   %ebp
+  801795:	56                   	push   %esi
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	8d 35 a0 17 80 00    	lea    0x8017a0,%esi
+  80179e:	0f 34                	sysenter
+
+008017a0 <after_sysenter_label_2114>:
+  8017a0:	5e                   	pop    %esi
+  8017a1:	5d                   	pop    %ebp
+  8017a2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8017a5:	5b                   	pop    %ebx
+  8017a6:	5f                   	pop    %edi
+  8017a7:	5d                   	pop    %ebp
+  8017a8:	c3                   	ret
+
+008017a9 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	57                   	push   %edi
+  8017ad:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8017be:	89 df                	mov    %ebx,%edi
+  8017c0:	6a 00                	push   $0x0
+  8017c2:	55                   	push   %ebp
+  8017c3:	56                   	push   %esi
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	8d 35 ce 17 80 00    	lea    0x8017ce,%esi
+  8017cc:	0f 34                	sysenter
+
+008017ce <after_sysenter_label_2200>:
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5d                   	pop    %ebp
+  8017d0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8017d3:	5b                   	pop    %ebx
+  8017d4:	5f                   	pop    %edi
+  8017d5:	5d                   	pop    %ebp
+  8017d6:	c3                   	ret
+
+008017d7 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	57                   	push   %edi
+  8017db:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8017ec:	89 df                	mov    %ebx,%edi
+  8017ee:	6a 00                	push   $0x0
+  8017f0:	55                   	push   %ebp
+  8017f1:	56                   	push   %esi
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	8d 35 fc 17 80 00    	lea    0x8017fc,%esi
+  8017fa:	0f 34                	sysenter
+
+008017fc <after_sysenter_label_2286>:
+  8017fc:	5e                   	pop    %esi
+  8017fd:	5d                   	pop    %ebp
+  8017fe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801801:	5b                   	pop    %ebx
+  801802:	5f                   	pop    %edi
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+
+00801805 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801810:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801813:	5d                   	pop    %ebp
+  801814:	c3                   	ret
+
+00801815 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801818:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801820:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801825:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80182a:	5d                   	pop    %ebp
+  80182b:	c3                   	ret
+
+0080182c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80182c:	55                   	push   %ebp
+  80182d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80182f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801834:	eb 02                	jmp    801838 <fd_alloc+0xc>
+  801836:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801838:	89 c2                	mov    %eax,%edx
+  80183a:	c1 ea 16             	shr    $0x16,%edx
+  80183d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801844:	f6 c2 01             	test   $0x1,%dl
+  801847:	74 2b                	je     801874 <fd_alloc+0x48>
+  801849:	89 c2                	mov    %eax,%edx
+  80184b:	c1 ea 0c             	shr    $0xc,%edx
+  80184e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801855:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80185b:	f6 c1 01             	test   $0x1,%cl
+  80185e:	74 14                	je     801874 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801860:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801866:	75 ce                	jne    801836 <fd_alloc+0xa>
+  801868:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80186d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801872:	eb 05                	jmp    801879 <fd_alloc+0x4d>
+			return 0;
+  801874:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801879:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187c:	89 02                	mov    %eax,(%edx)
+}
+  80187e:	89 c8                	mov    %ecx,%eax
+  801880:	5d                   	pop    %ebp
+  801881:	c3                   	ret
+
+00801882 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801888:	83 f8 1f             	cmp    $0x1f,%eax
+  80188b:	77 30                	ja     8018bd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80188d:	c1 e0 0c             	shl    $0xc,%eax
+  801890:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801895:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80189b:	f6 c2 01             	test   $0x1,%dl
+  80189e:	74 24                	je     8018c4 <fd_lookup+0x42>
+  8018a0:	89 c2                	mov    %eax,%edx
+  8018a2:	c1 ea 0c             	shr    $0xc,%edx
+  8018a5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018ac:	f6 c2 01             	test   $0x1,%dl
+  8018af:	74 1a                	je     8018cb <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+		return -E_INVAL;
+  8018bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c2:	eb f7                	jmp    8018bb <fd_lookup+0x39>
+		return -E_INVAL;
+  8018c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c9:	eb f0                	jmp    8018bb <fd_lookup+0x39>
+  8018cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018d0:	eb e9                	jmp    8018bb <fd_lookup+0x39>
+
+008018d2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018d2:	55                   	push   %ebp
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	53                   	push   %ebx
+  8018d6:	83 ec 04             	sub    $0x4,%esp
+  8018d9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e1:	eb 03                	jmp    8018e6 <dev_lookup+0x14>
+  8018e3:	83 c0 01             	add    $0x1,%eax
+  8018e6:	8b 1c 85 9c 54 80 00 	mov    0x80549c(,%eax,4),%ebx
+  8018ed:	85 db                	test   %ebx,%ebx
+  8018ef:	74 0b                	je     8018fc <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018f1:	39 13                	cmp    %edx,(%ebx)
+  8018f3:	75 ee                	jne    8018e3 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fa:	eb 49                	jmp    801945 <dev_lookup+0x73>
+  8018fc:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018fe:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801904:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801909:	77 18                	ja     801923 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80190b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801910:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801912:	c1 e8 10             	shr    $0x10,%eax
+  801915:	74 0c                	je     801923 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801917:	c1 e0 10             	shl    $0x10,%eax
+  80191a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80191f:	29 c1                	sub    %eax,%ecx
+  801921:	eb 06                	jmp    801929 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801923:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801929:	8b 01                	mov    (%ecx),%eax
+  80192b:	8b 40 48             	mov    0x48(%eax),%eax
+  80192e:	83 ec 04             	sub    $0x4,%esp
+  801931:	52                   	push   %edx
+  801932:	50                   	push   %eax
+  801933:	68 20 54 80 00       	push   $0x805420
+  801938:	e8 04 f0 ff ff       	call   800941 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801948:	89 1a                	mov    %ebx,(%edx)
+}
+  80194a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80194d:	c9                   	leave
+  80194e:	c3                   	ret
+
+0080194f <fd_close>:
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	57                   	push   %edi
+  801953:	56                   	push   %esi
+  801954:	53                   	push   %ebx
+  801955:	83 ec 24             	sub    $0x24,%esp
+  801958:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80195e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801961:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801962:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801968:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80196b:	50                   	push   %eax
+  80196c:	e8 11 ff ff ff       	call   801882 <fd_lookup>
+  801971:	89 c3                	mov    %eax,%ebx
+  801973:	83 c4 10             	add    $0x10,%esp
+  801976:	85 c0                	test   %eax,%eax
+  801978:	78 05                	js     80197f <fd_close+0x30>
+	    || fd != fd2)
+  80197a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80197d:	74 16                	je     801995 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80197f:	89 f8                	mov    %edi,%eax
+  801981:	84 c0                	test   %al,%al
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+  801988:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80198b:	89 d8                	mov    %ebx,%eax
+  80198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5f                   	pop    %edi
+  801993:	5d                   	pop    %ebp
+  801994:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801995:	83 ec 08             	sub    $0x8,%esp
+  801998:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80199b:	50                   	push   %eax
+  80199c:	ff 36                	push   (%esi)
+  80199e:	e8 2f ff ff ff       	call   8018d2 <dev_lookup>
+  8019a3:	89 c3                	mov    %eax,%ebx
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 1a                	js     8019c6 <fd_close+0x77>
+		if (dev->dev_close)
+  8019ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019af:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019b7:	85 c0                	test   %eax,%eax
+  8019b9:	74 0b                	je     8019c6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019bb:	83 ec 0c             	sub    $0xc,%esp
+  8019be:	56                   	push   %esi
+  8019bf:	ff d0                	call   *%eax
+  8019c1:	89 c3                	mov    %eax,%ebx
+  8019c3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019c6:	83 ec 08             	sub    $0x8,%esp
+  8019c9:	56                   	push   %esi
+  8019ca:	6a 00                	push   $0x0
+  8019cc:	e8 2b fa ff ff       	call   8013fc <sys_page_unmap>
+	return r;
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	eb b5                	jmp    80198b <fd_close+0x3c>
+
+008019d6 <close>:
+
+int
+close(int fdnum)
+{
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019df:	50                   	push   %eax
+  8019e0:	ff 75 08             	push   0x8(%ebp)
+  8019e3:	e8 9a fe ff ff       	call   801882 <fd_lookup>
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	79 02                	jns    8019f1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+		return fd_close(fd, 1);
+  8019f1:	83 ec 08             	sub    $0x8,%esp
+  8019f4:	6a 01                	push   $0x1
+  8019f6:	ff 75 f4             	push   -0xc(%ebp)
+  8019f9:	e8 51 ff ff ff       	call   80194f <fd_close>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	eb ec                	jmp    8019ef <close+0x19>
+
+00801a03 <close_all>:
+
+void
+close_all(void)
+{
+  801a03:	55                   	push   %ebp
+  801a04:	89 e5                	mov    %esp,%ebp
+  801a06:	53                   	push   %ebx
+  801a07:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a0f:	83 ec 0c             	sub    $0xc,%esp
+  801a12:	53                   	push   %ebx
+  801a13:	e8 be ff ff ff       	call   8019d6 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a18:	83 c3 01             	add    $0x1,%ebx
+  801a1b:	83 c4 10             	add    $0x10,%esp
+  801a1e:	83 fb 20             	cmp    $0x20,%ebx
+  801a21:	75 ec                	jne    801a0f <close_all+0xc>
+}
+  801a23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a26:	c9                   	leave
+  801a27:	c3                   	ret
+
+00801a28 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a28:	55                   	push   %ebp
+  801a29:	89 e5                	mov    %esp,%ebp
+  801a2b:	57                   	push   %edi
+  801a2c:	56                   	push   %esi
+  801a2d:	53                   	push   %ebx
+  801a2e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a31:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a34:	50                   	push   %eax
+  801a35:	ff 75 08             	push   0x8(%ebp)
+  801a38:	e8 45 fe ff ff       	call   801882 <fd_lookup>
+  801a3d:	89 c3                	mov    %eax,%ebx
+  801a3f:	83 c4 10             	add    $0x10,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 7f                	js     801ac5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a46:	83 ec 0c             	sub    $0xc,%esp
+  801a49:	ff 75 0c             	push   0xc(%ebp)
+  801a4c:	e8 85 ff ff ff       	call   8019d6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a51:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a54:	c1 e6 0c             	shl    $0xc,%esi
+  801a57:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a5d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a60:	89 3c 24             	mov    %edi,(%esp)
+  801a63:	e8 ad fd ff ff       	call   801815 <fd2data>
+  801a68:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a6a:	89 34 24             	mov    %esi,(%esp)
+  801a6d:	e8 a3 fd ff ff       	call   801815 <fd2data>
+  801a72:	83 c4 10             	add    $0x10,%esp
+  801a75:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a78:	89 d8                	mov    %ebx,%eax
+  801a7a:	c1 e8 16             	shr    $0x16,%eax
+  801a7d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a84:	a8 01                	test   $0x1,%al
+  801a86:	74 11                	je     801a99 <dup+0x71>
+  801a88:	89 d8                	mov    %ebx,%eax
+  801a8a:	c1 e8 0c             	shr    $0xc,%eax
+  801a8d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a94:	f6 c2 01             	test   $0x1,%dl
+  801a97:	75 36                	jne    801acf <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a99:	89 f8                	mov    %edi,%eax
+  801a9b:	c1 e8 0c             	shr    $0xc,%eax
+  801a9e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aa5:	83 ec 0c             	sub    $0xc,%esp
+  801aa8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aad:	50                   	push   %eax
+  801aae:	56                   	push   %esi
+  801aaf:	6a 00                	push   $0x0
+  801ab1:	57                   	push   %edi
+  801ab2:	6a 00                	push   $0x0
+  801ab4:	e8 f7 f8 ff ff       	call   8013b0 <sys_page_map>
+  801ab9:	89 c3                	mov    %eax,%ebx
+  801abb:	83 c4 20             	add    $0x20,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	78 33                	js     801af5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ac2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ac5:	89 d8                	mov    %ebx,%eax
+  801ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aca:	5b                   	pop    %ebx
+  801acb:	5e                   	pop    %esi
+  801acc:	5f                   	pop    %edi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801acf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ad6:	83 ec 0c             	sub    $0xc,%esp
+  801ad9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ade:	50                   	push   %eax
+  801adf:	ff 75 d4             	push   -0x2c(%ebp)
+  801ae2:	6a 00                	push   $0x0
+  801ae4:	53                   	push   %ebx
+  801ae5:	6a 00                	push   $0x0
+  801ae7:	e8 c4 f8 ff ff       	call   8013b0 <sys_page_map>
+  801aec:	89 c3                	mov    %eax,%ebx
+  801aee:	83 c4 20             	add    $0x20,%esp
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	79 a4                	jns    801a99 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801af5:	83 ec 08             	sub    $0x8,%esp
+  801af8:	56                   	push   %esi
+  801af9:	6a 00                	push   $0x0
+  801afb:	e8 fc f8 ff ff       	call   8013fc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b00:	83 c4 08             	add    $0x8,%esp
+  801b03:	ff 75 d4             	push   -0x2c(%ebp)
+  801b06:	6a 00                	push   $0x0
+  801b08:	e8 ef f8 ff ff       	call   8013fc <sys_page_unmap>
+	return r;
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	eb b3                	jmp    801ac5 <dup+0x9d>
+
+00801b12 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	56                   	push   %esi
+  801b16:	53                   	push   %ebx
+  801b17:	83 ec 18             	sub    $0x18,%esp
+  801b1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b20:	50                   	push   %eax
+  801b21:	53                   	push   %ebx
+  801b22:	e8 5b fd ff ff       	call   801882 <fd_lookup>
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	78 3c                	js     801b6a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b2e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b31:	83 ec 08             	sub    $0x8,%esp
+  801b34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b37:	50                   	push   %eax
+  801b38:	ff 36                	push   (%esi)
+  801b3a:	e8 93 fd ff ff       	call   8018d2 <dev_lookup>
+  801b3f:	83 c4 10             	add    $0x10,%esp
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 24                	js     801b6a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b46:	8b 46 08             	mov    0x8(%esi),%eax
+  801b49:	83 e0 03             	and    $0x3,%eax
+  801b4c:	83 f8 01             	cmp    $0x1,%eax
+  801b4f:	74 20                	je     801b71 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b54:	8b 40 08             	mov    0x8(%eax),%eax
+  801b57:	85 c0                	test   %eax,%eax
+  801b59:	74 61                	je     801bbc <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b5b:	83 ec 04             	sub    $0x4,%esp
+  801b5e:	ff 75 10             	push   0x10(%ebp)
+  801b61:	ff 75 0c             	push   0xc(%ebp)
+  801b64:	56                   	push   %esi
+  801b65:	ff d0                	call   *%eax
+  801b67:	83 c4 10             	add    $0x10,%esp
+}
+  801b6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6d:	5b                   	pop    %ebx
+  801b6e:	5e                   	pop    %esi
+  801b6f:	5d                   	pop    %ebp
+  801b70:	c3                   	ret
+  801b71:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b73:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801b79:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b7e:	77 18                	ja     801b98 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b80:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b85:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801b87:	c1 e8 10             	shr    $0x10,%eax
+  801b8a:	74 0c                	je     801b98 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b8c:	c1 e0 10             	shl    $0x10,%eax
+  801b8f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801b94:	29 c2                	sub    %eax,%edx
+  801b96:	eb 06                	jmp    801b9e <read+0x8c>
+		return pthread_main_tls;
+  801b98:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b9e:	8b 02                	mov    (%edx),%eax
+  801ba0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ba3:	83 ec 04             	sub    $0x4,%esp
+  801ba6:	53                   	push   %ebx
+  801ba7:	50                   	push   %eax
+  801ba8:	68 61 54 80 00       	push   $0x805461
+  801bad:	e8 8f ed ff ff       	call   800941 <cprintf>
+		return -E_INVAL;
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bba:	eb ae                	jmp    801b6a <read+0x58>
+		return -E_NOT_SUPP;
+  801bbc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bc1:	eb a7                	jmp    801b6a <read+0x58>
+
+00801bc3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bc3:	55                   	push   %ebp
+  801bc4:	89 e5                	mov    %esp,%ebp
+  801bc6:	57                   	push   %edi
+  801bc7:	56                   	push   %esi
+  801bc8:	53                   	push   %ebx
+  801bc9:	83 ec 0c             	sub    $0xc,%esp
+  801bcc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bcf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd7:	eb 02                	jmp    801bdb <readn+0x18>
+  801bd9:	01 c3                	add    %eax,%ebx
+  801bdb:	39 f3                	cmp    %esi,%ebx
+  801bdd:	73 21                	jae    801c00 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bdf:	83 ec 04             	sub    $0x4,%esp
+  801be2:	89 f0                	mov    %esi,%eax
+  801be4:	29 d8                	sub    %ebx,%eax
+  801be6:	50                   	push   %eax
+  801be7:	89 d8                	mov    %ebx,%eax
+  801be9:	03 45 0c             	add    0xc(%ebp),%eax
+  801bec:	50                   	push   %eax
+  801bed:	57                   	push   %edi
+  801bee:	e8 1f ff ff ff       	call   801b12 <read>
+		if (m < 0)
+  801bf3:	83 c4 10             	add    $0x10,%esp
+  801bf6:	85 c0                	test   %eax,%eax
+  801bf8:	78 04                	js     801bfe <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bfa:	75 dd                	jne    801bd9 <readn+0x16>
+  801bfc:	eb 02                	jmp    801c00 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bfe:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c00:	89 d8                	mov    %ebx,%eax
+  801c02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c05:	5b                   	pop    %ebx
+  801c06:	5e                   	pop    %esi
+  801c07:	5f                   	pop    %edi
+  801c08:	5d                   	pop    %ebp
+  801c09:	c3                   	ret
+
+00801c0a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 18             	sub    $0x18,%esp
+  801c12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c18:	50                   	push   %eax
+  801c19:	53                   	push   %ebx
+  801c1a:	e8 63 fc ff ff       	call   801882 <fd_lookup>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 37                	js     801c5d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c26:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c29:	83 ec 08             	sub    $0x8,%esp
+  801c2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2f:	50                   	push   %eax
+  801c30:	ff 36                	push   (%esi)
+  801c32:	e8 9b fc ff ff       	call   8018d2 <dev_lookup>
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 1f                	js     801c5d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c3e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c42:	74 20                	je     801c64 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c47:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	74 61                	je     801caf <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c4e:	83 ec 04             	sub    $0x4,%esp
+  801c51:	ff 75 10             	push   0x10(%ebp)
+  801c54:	ff 75 0c             	push   0xc(%ebp)
+  801c57:	56                   	push   %esi
+  801c58:	ff d0                	call   *%eax
+  801c5a:	83 c4 10             	add    $0x10,%esp
+}
+  801c5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c60:	5b                   	pop    %ebx
+  801c61:	5e                   	pop    %esi
+  801c62:	5d                   	pop    %ebp
+  801c63:	c3                   	ret
+  801c64:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c66:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c6c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c71:	77 18                	ja     801c8b <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c73:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c78:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c7a:	c1 e8 10             	shr    $0x10,%eax
+  801c7d:	74 0c                	je     801c8b <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c7f:	c1 e0 10             	shl    $0x10,%eax
+  801c82:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c87:	29 c2                	sub    %eax,%edx
+  801c89:	eb 06                	jmp    801c91 <write+0x87>
+		return pthread_main_tls;
+  801c8b:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c91:	8b 02                	mov    (%edx),%eax
+  801c93:	8b 40 48             	mov    0x48(%eax),%eax
+  801c96:	83 ec 04             	sub    $0x4,%esp
+  801c99:	53                   	push   %ebx
+  801c9a:	50                   	push   %eax
+  801c9b:	68 7d 54 80 00       	push   $0x80547d
+  801ca0:	e8 9c ec ff ff       	call   800941 <cprintf>
+		return -E_INVAL;
+  801ca5:	83 c4 10             	add    $0x10,%esp
+  801ca8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cad:	eb ae                	jmp    801c5d <write+0x53>
+		return -E_NOT_SUPP;
+  801caf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cb4:	eb a7                	jmp    801c5d <write+0x53>
+
+00801cb6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cb6:	55                   	push   %ebp
+  801cb7:	89 e5                	mov    %esp,%ebp
+  801cb9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbf:	50                   	push   %eax
+  801cc0:	ff 75 08             	push   0x8(%ebp)
+  801cc3:	e8 ba fb ff ff       	call   801882 <fd_lookup>
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 0e                	js     801cdd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ccf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+
+00801cdf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	56                   	push   %esi
+  801ce3:	53                   	push   %ebx
+  801ce4:	83 ec 18             	sub    $0x18,%esp
+  801ce7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ced:	50                   	push   %eax
+  801cee:	53                   	push   %ebx
+  801cef:	e8 8e fb ff ff       	call   801882 <fd_lookup>
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	78 34                	js     801d2f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cfb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d04:	50                   	push   %eax
+  801d05:	ff 36                	push   (%esi)
+  801d07:	e8 c6 fb ff ff       	call   8018d2 <dev_lookup>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	78 1c                	js     801d2f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d13:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d17:	74 1d                	je     801d36 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1c:	8b 40 18             	mov    0x18(%eax),%eax
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	74 5e                	je     801d81 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d23:	83 ec 08             	sub    $0x8,%esp
+  801d26:	ff 75 0c             	push   0xc(%ebp)
+  801d29:	56                   	push   %esi
+  801d2a:	ff d0                	call   *%eax
+  801d2c:	83 c4 10             	add    $0x10,%esp
+}
+  801d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d32:	5b                   	pop    %ebx
+  801d33:	5e                   	pop    %esi
+  801d34:	5d                   	pop    %ebp
+  801d35:	c3                   	ret
+  801d36:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d38:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d3e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d43:	77 18                	ja     801d5d <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d45:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d4a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d4c:	c1 e8 10             	shr    $0x10,%eax
+  801d4f:	74 0c                	je     801d5d <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d51:	c1 e0 10             	shl    $0x10,%eax
+  801d54:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d59:	29 c2                	sub    %eax,%edx
+  801d5b:	eb 06                	jmp    801d63 <ftruncate+0x84>
+		return pthread_main_tls;
+  801d5d:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			thisenv->env_id, fdnum);
+  801d63:	8b 02                	mov    (%edx),%eax
+  801d65:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d68:	83 ec 04             	sub    $0x4,%esp
+  801d6b:	53                   	push   %ebx
+  801d6c:	50                   	push   %eax
+  801d6d:	68 40 54 80 00       	push   $0x805440
+  801d72:	e8 ca eb ff ff       	call   800941 <cprintf>
+		return -E_INVAL;
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7f:	eb ae                	jmp    801d2f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d86:	eb a7                	jmp    801d2f <ftruncate+0x50>
+
+00801d88 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	56                   	push   %esi
+  801d8c:	53                   	push   %ebx
+  801d8d:	83 ec 18             	sub    $0x18,%esp
+  801d90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d93:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d96:	50                   	push   %eax
+  801d97:	ff 75 08             	push   0x8(%ebp)
+  801d9a:	e8 e3 fa ff ff       	call   801882 <fd_lookup>
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 49                	js     801def <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801da9:	83 ec 08             	sub    $0x8,%esp
+  801dac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801daf:	50                   	push   %eax
+  801db0:	ff 36                	push   (%esi)
+  801db2:	e8 1b fb ff ff       	call   8018d2 <dev_lookup>
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	78 31                	js     801def <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801dbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dc5:	74 2f                	je     801df6 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dc7:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dca:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dd1:	00 00 00 
+	stat->st_isdir = 0;
+  801dd4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ddb:	00 00 00 
+	stat->st_dev = dev;
+  801dde:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801de4:	83 ec 08             	sub    $0x8,%esp
+  801de7:	53                   	push   %ebx
+  801de8:	56                   	push   %esi
+  801de9:	ff 50 14             	call   *0x14(%eax)
+  801dec:	83 c4 10             	add    $0x10,%esp
+}
+  801def:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df2:	5b                   	pop    %ebx
+  801df3:	5e                   	pop    %esi
+  801df4:	5d                   	pop    %ebp
+  801df5:	c3                   	ret
+		return -E_NOT_SUPP;
+  801df6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dfb:	eb f2                	jmp    801def <fstat+0x67>
+
+00801dfd <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	56                   	push   %esi
+  801e01:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e02:	83 ec 08             	sub    $0x8,%esp
+  801e05:	6a 00                	push   $0x0
+  801e07:	ff 75 08             	push   0x8(%ebp)
+  801e0a:	e8 4b 03 00 00       	call   80215a <open>
+  801e0f:	89 c3                	mov    %eax,%ebx
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	78 1b                	js     801e33 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e18:	83 ec 08             	sub    $0x8,%esp
+  801e1b:	ff 75 0c             	push   0xc(%ebp)
+  801e1e:	50                   	push   %eax
+  801e1f:	e8 64 ff ff ff       	call   801d88 <fstat>
+  801e24:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e26:	89 1c 24             	mov    %ebx,(%esp)
+  801e29:	e8 a8 fb ff ff       	call   8019d6 <close>
+	return r;
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	89 f3                	mov    %esi,%ebx
+}
+  801e33:	89 d8                	mov    %ebx,%eax
+  801e35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e38:	5b                   	pop    %ebx
+  801e39:	5e                   	pop    %esi
+  801e3a:	5d                   	pop    %ebp
+  801e3b:	c3                   	ret
+
+00801e3c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	56                   	push   %esi
+  801e40:	53                   	push   %ebx
+  801e41:	89 c6                	mov    %eax,%esi
+  801e43:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e45:	83 3d 10 70 80 00 00 	cmpl   $0x0,0x807010
+  801e4c:	74 27                	je     801e75 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e4e:	6a 07                	push   $0x7
+  801e50:	68 00 80 80 00       	push   $0x808000
+  801e55:	56                   	push   %esi
+  801e56:	ff 35 10 70 80 00    	push   0x807010
+  801e5c:	e8 4e 2c 00 00       	call   804aaf <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e61:	83 c4 0c             	add    $0xc,%esp
+  801e64:	6a 00                	push   $0x0
+  801e66:	53                   	push   %ebx
+  801e67:	6a 00                	push   $0x0
+  801e69:	e8 4b 2b 00 00       	call   8049b9 <ipc_recv>
+}
+  801e6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e71:	5b                   	pop    %ebx
+  801e72:	5e                   	pop    %esi
+  801e73:	5d                   	pop    %ebp
+  801e74:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e75:	83 ec 0c             	sub    $0xc,%esp
+  801e78:	6a 01                	push   $0x1
+  801e7a:	e8 86 2c 00 00       	call   804b05 <ipc_find_env>
+  801e7f:	a3 10 70 80 00       	mov    %eax,0x807010
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	eb c5                	jmp    801e4e <fsipc+0x12>
+
+00801e89 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e89:	55                   	push   %ebp
+  801e8a:	89 e5                	mov    %esp,%ebp
+  801e8c:	53                   	push   %ebx
+  801e8d:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e90:	68 14 70 80 00       	push   $0x807014
+  801e95:	e8 29 1b 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea0:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801ea5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea8:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ead:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eb7:	e8 80 ff ff ff       	call   801e3c <fsipc>
+  801ebc:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ebe:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801ec5:	e8 66 1b 00 00       	call   803a30 <mutex_unlock>
+	return r;
+}
+  801eca:	89 d8                	mov    %ebx,%eax
+  801ecc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+
+00801ed1 <devfile_flush>:
+{
+  801ed1:	55                   	push   %ebp
+  801ed2:	89 e5                	mov    %esp,%ebp
+  801ed4:	53                   	push   %ebx
+  801ed5:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801ed8:	68 14 70 80 00       	push   $0x807014
+  801edd:	e8 e1 1a 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ee2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee8:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef2:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ef7:	e8 40 ff ff ff       	call   801e3c <fsipc>
+  801efc:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801efe:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  801f05:	e8 26 1b 00 00       	call   803a30 <mutex_unlock>
+}
+  801f0a:	89 d8                	mov    %ebx,%eax
+  801f0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0f:	c9                   	leave
+  801f10:	c3                   	ret
+
+00801f11 <devfile_stat>:
+{
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	56                   	push   %esi
+  801f15:	53                   	push   %ebx
+  801f16:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f19:	83 ec 0c             	sub    $0xc,%esp
+  801f1c:	68 14 70 80 00       	push   $0x807014
+  801f21:	e8 9d 1a 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2c:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f36:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f3b:	e8 fc fe ff ff       	call   801e3c <fsipc>
+  801f40:	89 c3                	mov    %eax,%ebx
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	79 16                	jns    801f5f <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801f49:	83 ec 0c             	sub    $0xc,%esp
+  801f4c:	68 14 70 80 00       	push   $0x807014
+  801f51:	e8 da 1a 00 00       	call   803a30 <mutex_unlock>
+}
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	68 00 80 80 00       	push   $0x808000
+  801f67:	56                   	push   %esi
+  801f68:	e8 b8 ef ff ff       	call   800f25 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801f6d:	a1 80 80 80 00       	mov    0x808080,%eax
+  801f72:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f78:	a1 84 80 80 00       	mov    0x808084,%eax
+  801f7d:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801f83:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8b:	eb bc                	jmp    801f49 <devfile_stat+0x38>
+
+00801f8d <devfile_write>:
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	53                   	push   %ebx
+  801f91:	83 ec 10             	sub    $0x10,%esp
+  801f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801f97:	68 14 70 80 00       	push   $0x807014
+  801f9c:	e8 22 1a 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa7:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801fb5:	76 3d                	jbe    801ff4 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801fb7:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801fbc:	39 c3                	cmp    %eax,%ebx
+  801fbe:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801fc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc4:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801fc9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fd9:	e8 5e fe ff ff       	call   801e3c <fsipc>
+  801fde:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fe0:	83 ec 0c             	sub    $0xc,%esp
+  801fe3:	68 14 70 80 00       	push   $0x807014
+  801fe8:	e8 43 1a 00 00       	call   803a30 <mutex_unlock>
+}
+  801fed:	89 d8                	mov    %ebx,%eax
+  801fef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff2:	c9                   	leave
+  801ff3:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801ff4:	83 ec 04             	sub    $0x4,%esp
+  801ff7:	53                   	push   %ebx
+  801ff8:	ff 75 0c             	push   0xc(%ebp)
+  801ffb:	68 0c 80 80 00       	push   $0x80800c
+  802000:	e8 a6 f0 ff ff       	call   8010ab <memmove>
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200d:	eb b5                	jmp    801fc4 <devfile_write+0x37>
+
+0080200f <devfile_read>:
+{
+  80200f:	55                   	push   %ebp
+  802010:	89 e5                	mov    %esp,%ebp
+  802012:	57                   	push   %edi
+  802013:	56                   	push   %esi
+  802014:	53                   	push   %ebx
+  802015:	83 ec 0c             	sub    $0xc,%esp
+  802018:	8b 75 08             	mov    0x8(%ebp),%esi
+  80201b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80201e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802021:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802027:	0f 86 8c 00 00 00    	jbe    8020b9 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80202d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802032:	39 c3                	cmp    %eax,%ebx
+  802034:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802037:	89 f8                	mov    %edi,%eax
+  802039:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80203c:	eb 0f                	jmp    80204d <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80203e:	0f b6 08             	movzbl (%eax),%ecx
+  802041:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802043:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802048:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80204d:	39 d0                	cmp    %edx,%eax
+  80204f:	72 ed                	jb     80203e <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802051:	83 ec 0c             	sub    $0xc,%esp
+  802054:	68 14 70 80 00       	push   $0x807014
+  802059:	e8 65 19 00 00       	call   8039c3 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80205e:	8b 46 0c             	mov    0xc(%esi),%eax
+  802061:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  802066:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  80206c:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  802072:	ba 00 00 00 00       	mov    $0x0,%edx
+  802077:	b8 03 00 00 00       	mov    $0x3,%eax
+  80207c:	e8 bb fd ff ff       	call   801e3c <fsipc>
+  802081:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802083:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  80208a:	e8 a1 19 00 00       	call   803a30 <mutex_unlock>
+		assert(r <= (int) n);
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	39 f3                	cmp    %esi,%ebx
+  802094:	7c 0a                	jl     8020a0 <devfile_read+0x91>
+}
+  802096:	89 f0                	mov    %esi,%eax
+  802098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209b:	5b                   	pop    %ebx
+  80209c:	5e                   	pop    %esi
+  80209d:	5f                   	pop    %edi
+  80209e:	5d                   	pop    %ebp
+  80209f:	c3                   	ret
+		assert(r <= (int) n);
+  8020a0:	68 b0 54 80 00       	push   $0x8054b0
+  8020a5:	68 bd 54 80 00       	push   $0x8054bd
+  8020aa:	68 90 00 00 00       	push   $0x90
+  8020af:	68 d2 54 80 00       	push   $0x8054d2
+  8020b4:	e8 ad e7 ff ff       	call   800866 <_panic>
+	mutex_lock(&fsipc_mu);
+  8020b9:	83 ec 0c             	sub    $0xc,%esp
+  8020bc:	68 14 70 80 00       	push   $0x807014
+  8020c1:	e8 fd 18 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020c6:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020c9:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8020ce:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8020d4:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8020db:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8020de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020e8:	e8 4f fd ff ff       	call   801e3c <fsipc>
+  8020ed:	89 c6                	mov    %eax,%esi
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	78 1d                	js     802113 <devfile_read+0x104>
+		assert(r <= n);
+  8020f6:	39 c3                	cmp    %eax,%ebx
+  8020f8:	72 2e                	jb     802128 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8020fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020ff:	7f 40                	jg     802141 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802101:	83 ec 04             	sub    $0x4,%esp
+  802104:	50                   	push   %eax
+  802105:	68 00 80 80 00       	push   $0x808000
+  80210a:	57                   	push   %edi
+  80210b:	e8 9b ef ff ff       	call   8010ab <memmove>
+  802110:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802113:	83 ec 0c             	sub    $0xc,%esp
+  802116:	68 14 70 80 00       	push   $0x807014
+  80211b:	e8 10 19 00 00       	call   803a30 <mutex_unlock>
+	return r;
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	e9 6e ff ff ff       	jmp    802096 <devfile_read+0x87>
+		assert(r <= n);
+  802128:	68 dd 54 80 00       	push   $0x8054dd
+  80212d:	68 bd 54 80 00       	push   $0x8054bd
+  802132:	68 99 00 00 00       	push   $0x99
+  802137:	68 d2 54 80 00       	push   $0x8054d2
+  80213c:	e8 25 e7 ff ff       	call   800866 <_panic>
+		assert(r <= PGSIZE);
+  802141:	68 e4 54 80 00       	push   $0x8054e4
+  802146:	68 bd 54 80 00       	push   $0x8054bd
+  80214b:	68 9a 00 00 00       	push   $0x9a
+  802150:	68 d2 54 80 00       	push   $0x8054d2
+  802155:	e8 0c e7 ff ff       	call   800866 <_panic>
+
+0080215a <open>:
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	56                   	push   %esi
+  80215e:	53                   	push   %ebx
+  80215f:	83 ec 1c             	sub    $0x1c,%esp
+  802162:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802165:	56                   	push   %esi
+  802166:	e8 7f ed ff ff       	call   800eea <strlen>
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802173:	0f 8f 85 00 00 00    	jg     8021fe <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802179:	83 ec 0c             	sub    $0xc,%esp
+  80217c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217f:	50                   	push   %eax
+  802180:	e8 a7 f6 ff ff       	call   80182c <fd_alloc>
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 55                	js     8021e3 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80218e:	83 ec 0c             	sub    $0xc,%esp
+  802191:	68 14 70 80 00       	push   $0x807014
+  802196:	e8 28 18 00 00       	call   8039c3 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80219b:	83 c4 08             	add    $0x8,%esp
+  80219e:	56                   	push   %esi
+  80219f:	68 00 80 80 00       	push   $0x808000
+  8021a4:	e8 7c ed ff ff       	call   800f25 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ac:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8021b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b9:	e8 7e fc ff ff       	call   801e3c <fsipc>
+  8021be:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021c0:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  8021c7:	e8 64 18 00 00       	call   803a30 <mutex_unlock>
+	if (r < 0) {
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	85 db                	test   %ebx,%ebx
+  8021d1:	78 19                	js     8021ec <open+0x92>
+	return fd2num(fd);
+  8021d3:	83 ec 0c             	sub    $0xc,%esp
+  8021d6:	ff 75 f4             	push   -0xc(%ebp)
+  8021d9:	e8 27 f6 ff ff       	call   801805 <fd2num>
+  8021de:	89 c3                	mov    %eax,%ebx
+  8021e0:	83 c4 10             	add    $0x10,%esp
+}
+  8021e3:	89 d8                	mov    %ebx,%eax
+  8021e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e8:	5b                   	pop    %ebx
+  8021e9:	5e                   	pop    %esi
+  8021ea:	5d                   	pop    %ebp
+  8021eb:	c3                   	ret
+		fd_close(fd, 0);
+  8021ec:	83 ec 08             	sub    $0x8,%esp
+  8021ef:	6a 00                	push   $0x0
+  8021f1:	ff 75 f4             	push   -0xc(%ebp)
+  8021f4:	e8 56 f7 ff ff       	call   80194f <fd_close>
+		return r;
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	eb e5                	jmp    8021e3 <open+0x89>
+		return -E_BAD_PATH;
+  8021fe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802203:	eb de                	jmp    8021e3 <open+0x89>
+
+00802205 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	53                   	push   %ebx
+  802209:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80220c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80220f:	50                   	push   %eax
+  802210:	ff 75 08             	push   0x8(%ebp)
+  802213:	e8 6a f6 ff ff       	call   801882 <fd_lookup>
+  802218:	89 c3                	mov    %eax,%ebx
+  80221a:	83 c4 10             	add    $0x10,%esp
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	78 5b                	js     80227c <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802224:	8b 0d 24 60 80 00    	mov    0x806024,%ecx
+  80222a:	39 08                	cmp    %ecx,(%eax)
+  80222c:	75 55                	jne    802283 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80222e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802232:	74 56                	je     80228a <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802234:	83 ec 0c             	sub    $0xc,%esp
+  802237:	68 14 70 80 00       	push   $0x807014
+  80223c:	e8 82 17 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802241:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802244:	8b 40 0c             	mov    0xc(%eax),%eax
+  802247:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  80224c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80224f:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802254:	8b 45 10             	mov    0x10(%ebp),%eax
+  802257:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  80225c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802261:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802266:	e8 d1 fb ff ff       	call   801e3c <fsipc>
+  80226b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80226d:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  802274:	e8 b7 17 00 00       	call   803a30 <mutex_unlock>
+	return r;
+  802279:	83 c4 10             	add    $0x10,%esp
+}
+  80227c:	89 d8                	mov    %ebx,%eax
+  80227e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+		return -E_NOT_SUPP;
+  802283:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802288:	eb f2                	jmp    80227c <fallocate+0x77>
+		return -E_INVAL;
+  80228a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80228f:	eb eb                	jmp    80227c <fallocate+0x77>
+
+00802291 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802291:	55                   	push   %ebp
+  802292:	89 e5                	mov    %esp,%ebp
+  802294:	56                   	push   %esi
+  802295:	53                   	push   %ebx
+  802296:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802299:	89 f3                	mov    %esi,%ebx
+  80229b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022a1:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022a4:	eb 06                	jmp    8022ac <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022ac:	39 f3                	cmp    %esi,%ebx
+  8022ae:	73 14                	jae    8022c4 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8022b0:	83 ec 08             	sub    $0x8,%esp
+  8022b3:	53                   	push   %ebx
+  8022b4:	6a 00                	push   $0x0
+  8022b6:	e8 41 f1 ff ff       	call   8013fc <sys_page_unmap>
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	79 e4                	jns    8022a6 <munmap+0x15>
+  8022c2:	eb 05                	jmp    8022c9 <munmap+0x38>
+			return r;
+	return 0;
+  8022c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022cc:	5b                   	pop    %ebx
+  8022cd:	5e                   	pop    %esi
+  8022ce:	5d                   	pop    %ebp
+  8022cf:	c3                   	ret
+
+008022d0 <mmap>:
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	57                   	push   %edi
+  8022d4:	56                   	push   %esi
+  8022d5:	53                   	push   %ebx
+  8022d6:	83 ec 24             	sub    $0x24,%esp
+  8022d9:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8022dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022df:	50                   	push   %eax
+  8022e0:	ff 75 08             	push   0x8(%ebp)
+  8022e3:	e8 9a f5 ff ff       	call   801882 <fd_lookup>
+  8022e8:	83 c4 10             	add    $0x10,%esp
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	0f 88 37 01 00 00    	js     80242a <mmap+0x15a>
+		return NULL;
+  8022f3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8022f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022fb:	8b 0d 24 60 80 00    	mov    0x806024,%ecx
+  802301:	39 0a                	cmp    %ecx,(%edx)
+  802303:	0f 85 05 01 00 00    	jne    80240e <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802309:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802310:	0f 85 1b 01 00 00    	jne    802431 <mmap+0x161>
+  802316:	89 f0                	mov    %esi,%eax
+  802318:	83 e8 01             	sub    $0x1,%eax
+  80231b:	0f 88 17 01 00 00    	js     802438 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802321:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802325:	75 28                	jne    80234f <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802327:	83 ec 0c             	sub    $0xc,%esp
+  80232a:	68 14 70 80 00       	push   $0x807014
+  80232f:	e8 8f 16 00 00       	call   8039c3 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802334:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80233a:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802340:	83 c4 10             	add    $0x10,%esp
+  802343:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802348:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80234d:	eb 2b                	jmp    80237a <mmap+0xaa>
+		cow_enable();
+  80234f:	e8 f4 21 00 00       	call   804548 <cow_enable>
+  802354:	eb d1                	jmp    802327 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802356:	89 c2                	mov    %eax,%edx
+  802358:	c1 ea 0c             	shr    $0xc,%edx
+  80235b:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802362:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802368:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80236e:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802371:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802373:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802378:	77 25                	ja     80239f <mmap+0xcf>
+  80237a:	89 c2                	mov    %eax,%edx
+  80237c:	29 da                	sub    %ebx,%edx
+  80237e:	39 ca                	cmp    %ecx,%edx
+  802380:	73 3a                	jae    8023bc <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802382:	89 c2                	mov    %eax,%edx
+  802384:	c1 ea 16             	shr    $0x16,%edx
+  802387:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80238e:	f6 c2 01             	test   $0x1,%dl
+  802391:	75 c3                	jne    802356 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802393:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802398:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80239d:	eb d4                	jmp    802373 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80239f:	29 d8                	sub    %ebx,%eax
+  8023a1:	39 c8                	cmp    %ecx,%eax
+  8023a3:	73 17                	jae    8023bc <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8023a5:	83 ec 0c             	sub    $0xc,%esp
+  8023a8:	68 14 70 80 00       	push   $0x807014
+  8023ad:	e8 7e 16 00 00       	call   803a30 <mutex_unlock>
+		return NULL;
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ba:	eb 52                	jmp    80240e <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023bc:	85 db                	test   %ebx,%ebx
+  8023be:	74 e5                	je     8023a5 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8023c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023c3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c6:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8023cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ce:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8023d3:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8023d9:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8023df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023e2:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8023e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023f1:	e8 46 fa ff ff       	call   801e3c <fsipc>
+  8023f6:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8023f8:	83 ec 0c             	sub    $0xc,%esp
+  8023fb:	68 14 70 80 00       	push   $0x807014
+  802400:	e8 2b 16 00 00       	call   803a30 <mutex_unlock>
+	if (r < 0) {
+  802405:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802408:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80240a:	85 ff                	test   %edi,%edi
+  80240c:	78 08                	js     802416 <mmap+0x146>
+}
+  80240e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802411:	5b                   	pop    %ebx
+  802412:	5e                   	pop    %esi
+  802413:	5f                   	pop    %edi
+  802414:	5d                   	pop    %ebp
+  802415:	c3                   	ret
+		munmap((void*) va, len);
+  802416:	83 ec 08             	sub    $0x8,%esp
+  802419:	56                   	push   %esi
+  80241a:	53                   	push   %ebx
+  80241b:	e8 71 fe ff ff       	call   802291 <munmap>
+		return NULL;
+  802420:	83 c4 10             	add    $0x10,%esp
+  802423:	b8 00 00 00 00       	mov    $0x0,%eax
+  802428:	eb e4                	jmp    80240e <mmap+0x13e>
+		return NULL;
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242f:	eb dd                	jmp    80240e <mmap+0x13e>
+		return NULL;
+  802431:	b8 00 00 00 00       	mov    $0x0,%eax
+  802436:	eb d6                	jmp    80240e <mmap+0x13e>
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	eb cf                	jmp    80240e <mmap+0x13e>
+
+0080243f <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	53                   	push   %ebx
+  802443:	83 ec 10             	sub    $0x10,%esp
+  802446:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802449:	53                   	push   %ebx
+  80244a:	e8 9b ea ff ff       	call   800eea <strlen>
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802457:	7f 42                	jg     80249b <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802459:	83 ec 0c             	sub    $0xc,%esp
+  80245c:	68 14 70 80 00       	push   $0x807014
+  802461:	e8 5d 15 00 00       	call   8039c3 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802466:	83 c4 08             	add    $0x8,%esp
+  802469:	53                   	push   %ebx
+  80246a:	68 00 80 80 00       	push   $0x808000
+  80246f:	e8 b1 ea ff ff       	call   800f25 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802474:	ba 00 00 00 00       	mov    $0x0,%edx
+  802479:	b8 07 00 00 00       	mov    $0x7,%eax
+  80247e:	e8 b9 f9 ff ff       	call   801e3c <fsipc>
+  802483:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802485:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  80248c:	e8 9f 15 00 00       	call   803a30 <mutex_unlock>
+	return r;
+  802491:	83 c4 10             	add    $0x10,%esp
+}
+  802494:	89 d8                	mov    %ebx,%eax
+  802496:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+		return -E_BAD_PATH;
+  80249b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024a0:	eb f2                	jmp    802494 <remove+0x55>
+
+008024a2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024a2:	55                   	push   %ebp
+  8024a3:	89 e5                	mov    %esp,%ebp
+  8024a5:	53                   	push   %ebx
+  8024a6:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024a9:	68 14 70 80 00       	push   $0x807014
+  8024ae:	e8 10 15 00 00       	call   8039c3 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8024b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024bd:	e8 7a f9 ff ff       	call   801e3c <fsipc>
+  8024c2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024c4:	c7 04 24 14 70 80 00 	movl   $0x807014,(%esp)
+  8024cb:	e8 60 15 00 00       	call   803a30 <mutex_unlock>
+	return r;
+}
+  8024d0:	89 d8                	mov    %ebx,%eax
+  8024d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+008024d7 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	56                   	push   %esi
+  8024db:	53                   	push   %ebx
+  8024dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024df:	83 ec 0c             	sub    $0xc,%esp
+  8024e2:	68 14 70 80 00       	push   $0x807014
+  8024e7:	e8 d7 14 00 00       	call   8039c3 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8024ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ef:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8024f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024fe:	e8 39 f9 ff ff       	call   801e3c <fsipc>
+  802503:	89 c6                	mov    %eax,%esi
+  802505:	83 c4 10             	add    $0x10,%esp
+  802508:	85 db                	test   %ebx,%ebx
+  80250a:	74 7b                	je     802587 <fs_bcstat+0xb0>
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	78 77                	js     802587 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802510:	a1 00 80 80 00       	mov    0x808000,%eax
+  802515:	89 03                	mov    %eax,(%ebx)
+  802517:	a1 04 80 80 00       	mov    0x808004,%eax
+  80251c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80251f:	a1 08 80 80 00       	mov    0x808008,%eax
+  802524:	89 43 08             	mov    %eax,0x8(%ebx)
+  802527:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  80252c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80252f:	a1 10 80 80 00       	mov    0x808010,%eax
+  802534:	89 43 10             	mov    %eax,0x10(%ebx)
+  802537:	a1 14 80 80 00       	mov    0x808014,%eax
+  80253c:	89 43 14             	mov    %eax,0x14(%ebx)
+  80253f:	a1 18 80 80 00       	mov    0x808018,%eax
+  802544:	89 43 18             	mov    %eax,0x18(%ebx)
+  802547:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  80254c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80254f:	a1 20 80 80 00       	mov    0x808020,%eax
+  802554:	89 43 20             	mov    %eax,0x20(%ebx)
+  802557:	a1 24 80 80 00       	mov    0x808024,%eax
+  80255c:	89 43 24             	mov    %eax,0x24(%ebx)
+  80255f:	a1 28 80 80 00       	mov    0x808028,%eax
+  802564:	89 43 28             	mov    %eax,0x28(%ebx)
+  802567:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  80256c:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80256f:	a1 30 80 80 00       	mov    0x808030,%eax
+  802574:	89 43 30             	mov    %eax,0x30(%ebx)
+  802577:	a1 34 80 80 00       	mov    0x808034,%eax
+  80257c:	89 43 34             	mov    %eax,0x34(%ebx)
+  80257f:	a1 38 80 80 00       	mov    0x808038,%eax
+  802584:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802587:	83 ec 0c             	sub    $0xc,%esp
+  80258a:	68 14 70 80 00       	push   $0x807014
+  80258f:	e8 9c 14 00 00       	call   803a30 <mutex_unlock>
+	return r;
+}
+  802594:	89 f0                	mov    %esi,%eax
+  802596:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802599:	5b                   	pop    %ebx
+  80259a:	5e                   	pop    %esi
+  80259b:	5d                   	pop    %ebp
+  80259c:	c3                   	ret
+
+0080259d <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80259d:	55                   	push   %ebp
+  80259e:	89 e5                	mov    %esp,%ebp
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8025a4:	0f b6 10             	movzbl (%eax),%edx
+  8025a7:	80 fa 72             	cmp    $0x72,%dl
+  8025aa:	74 44                	je     8025f0 <parse_mode+0x53>
+  8025ac:	80 fa 77             	cmp    $0x77,%dl
+  8025af:	74 4b                	je     8025fc <parse_mode+0x5f>
+  8025b1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025b6:	80 fa 61             	cmp    $0x61,%dl
+  8025b9:	74 09                	je     8025c4 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8025bb:	89 d8                	mov    %ebx,%eax
+  8025bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	5e                   	pop    %esi
+  8025c2:	5d                   	pop    %ebp
+  8025c3:	c3                   	ret
+	switch (mode[0]) {
+  8025c4:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8025c9:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8025ce:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8025d0:	83 ec 08             	sub    $0x8,%esp
+  8025d3:	6a 2b                	push   $0x2b
+  8025d5:	50                   	push   %eax
+  8025d6:	e8 5c ea ff ff       	call   801037 <strchr>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	74 d9                	je     8025bb <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8025e2:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8025e5:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8025e8:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8025ee:	eb cb                	jmp    8025bb <parse_mode+0x1e>
+	switch (mode[0]) {
+  8025f0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025fa:	eb d2                	jmp    8025ce <parse_mode+0x31>
+  8025fc:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802601:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802606:	eb c6                	jmp    8025ce <parse_mode+0x31>
+
+00802608 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	57                   	push   %edi
+  80260c:	56                   	push   %esi
+  80260d:	53                   	push   %ebx
+  80260e:	83 ec 1c             	sub    $0x1c,%esp
+  802611:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802614:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802617:	b8 44 60 80 00       	mov    $0x806044,%eax
+  80261c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802621:	83 c0 24             	add    $0x24,%eax
+  802624:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802628:	74 17                	je     802641 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80262a:	83 c3 01             	add    $0x1,%ebx
+  80262d:	83 fb 10             	cmp    $0x10,%ebx
+  802630:	75 ef                	jne    802621 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802632:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802637:	89 f0                	mov    %esi,%eax
+  802639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263c:	5b                   	pop    %ebx
+  80263d:	5e                   	pop    %esi
+  80263e:	5f                   	pop    %edi
+  80263f:	5d                   	pop    %ebp
+  802640:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802641:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802648:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80264b:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80264e:	c1 e7 02             	shl    $0x2,%edi
+  802651:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  802657:	83 ec 04             	sub    $0x4,%esp
+  80265a:	6a 24                	push   $0x24
+  80265c:	6a 00                	push   $0x0
+  80265e:	56                   	push   %esi
+  80265f:	e8 12 ea ff ff       	call   801076 <memset>
+			streams[i].f_fd = fd;
+  802664:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802667:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  80266d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802670:	01 d8                	add    %ebx,%eax
+  802672:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802675:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	eb b6                	jmp    802637 <stream_alloc+0x2f>
+
+00802681 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802681:	55                   	push   %ebp
+  802682:	89 e5                	mov    %esp,%ebp
+  802684:	53                   	push   %ebx
+  802685:	83 ec 14             	sub    $0x14,%esp
+  802688:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80268a:	8b 40 18             	mov    0x18(%eax),%eax
+  80268d:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802690:	74 4a                	je     8026dc <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802692:	83 ec 08             	sub    $0x8,%esp
+  802695:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802698:	50                   	push   %eax
+  802699:	ff 33                	push   (%ebx)
+  80269b:	e8 e2 f1 ff ff       	call   801882 <fd_lookup>
+  8026a0:	89 c2                	mov    %eax,%edx
+  8026a2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026a5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026aa:	85 d2                	test   %edx,%edx
+  8026ac:	78 41                	js     8026ef <stream_unread+0x6e>
+  8026ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026b1:	8b 0d 24 60 80 00    	mov    0x806024,%ecx
+  8026b7:	39 0a                	cmp    %ecx,(%edx)
+  8026b9:	75 34                	jne    8026ef <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8026bb:	8b 43 14             	mov    0x14(%ebx),%eax
+  8026be:	03 42 04             	add    0x4(%edx),%eax
+  8026c1:	2b 43 18             	sub    0x18(%ebx),%eax
+  8026c4:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8026c7:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8026ce:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8026d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026da:	eb 13                	jmp    8026ef <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8026dc:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8026e3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8026ea:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8026ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f2:	c9                   	leave
+  8026f3:	c3                   	ret
+
+008026f4 <stream_drain>:
+{
+  8026f4:	55                   	push   %ebp
+  8026f5:	89 e5                	mov    %esp,%ebp
+  8026f7:	56                   	push   %esi
+  8026f8:	53                   	push   %ebx
+  8026f9:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8026fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802700:	eb 02                	jmp    802704 <stream_drain+0x10>
+  802702:	01 c3                	add    %eax,%ebx
+  802704:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802707:	39 c3                	cmp    %eax,%ebx
+  802709:	73 43                	jae    80274e <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80270b:	83 ec 04             	sub    $0x4,%esp
+  80270e:	29 d8                	sub    %ebx,%eax
+  802710:	50                   	push   %eax
+  802711:	89 d8                	mov    %ebx,%eax
+  802713:	03 46 0c             	add    0xc(%esi),%eax
+  802716:	50                   	push   %eax
+  802717:	ff 36                	push   (%esi)
+  802719:	e8 ec f4 ff ff       	call   801c0a <write>
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	7f dd                	jg     802702 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802725:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802729:	8b 56 0c             	mov    0xc(%esi),%edx
+  80272c:	83 ec 04             	sub    $0x4,%esp
+  80272f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802732:	29 d8                	sub    %ebx,%eax
+  802734:	50                   	push   %eax
+  802735:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802738:	50                   	push   %eax
+  802739:	52                   	push   %edx
+  80273a:	e8 6c e9 ff ff       	call   8010ab <memmove>
+			f->f_wend -= done;
+  80273f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802742:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80274c:	eb 0a                	jmp    802758 <stream_drain+0x64>
+  80274e:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802753:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802758:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80275b:	89 d0                	mov    %edx,%eax
+  80275d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5d                   	pop    %ebp
+  802763:	c3                   	ret
+
+00802764 <stream_setup>:
+	if (f->f_buf)
+  802764:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802768:	74 01                	je     80276b <stream_setup+0x7>
+  80276a:	c3                   	ret
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	53                   	push   %ebx
+  80276f:	83 ec 04             	sub    $0x4,%esp
+  802772:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802774:	8b 40 08             	mov    0x8(%eax),%eax
+  802777:	85 c0                	test   %eax,%eax
+  802779:	74 17                	je     802792 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80277b:	83 f8 03             	cmp    $0x3,%eax
+  80277e:	75 2d                	jne    8027ad <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802780:	8d 43 20             	lea    0x20(%ebx),%eax
+  802783:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802786:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80278d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802792:	83 ec 0c             	sub    $0xc,%esp
+  802795:	ff 33                	push   (%ebx)
+  802797:	e8 29 1b 00 00       	call   8042c5 <iscons>
+  80279c:	83 c4 10             	add    $0x10,%esp
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	0f 9f c0             	setg   %al
+  8027a4:	0f b6 c0             	movzbl %al,%eax
+  8027a7:	83 c0 01             	add    $0x1,%eax
+  8027aa:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8027ad:	83 ec 0c             	sub    $0xc,%esp
+  8027b0:	68 00 10 00 00       	push   $0x1000
+  8027b5:	e8 6e 0b 00 00       	call   803328 <malloc>
+  8027ba:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	74 bc                	je     802780 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8027c4:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8027cb:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8027cf:	eb bc                	jmp    80278d <stream_setup+0x29>
+
+008027d1 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8027d1:	55                   	push   %ebp
+  8027d2:	89 e5                	mov    %esp,%ebp
+  8027d4:	53                   	push   %ebx
+  8027d5:	83 ec 04             	sub    $0x4,%esp
+  8027d8:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8027da:	e8 85 ff ff ff       	call   802764 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8027df:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8027e4:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8027e8:	74 3d                	je     802827 <stream_fill+0x56>
+  8027ea:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8027ee:	74 10                	je     802800 <stream_fill+0x2f>
+  8027f0:	89 d8                	mov    %ebx,%eax
+  8027f2:	e8 fd fe ff ff       	call   8026f4 <stream_drain>
+		return 0;
+  8027f7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8027fc:	85 c0                	test   %eax,%eax
+  8027fe:	78 27                	js     802827 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802800:	83 ec 04             	sub    $0x4,%esp
+  802803:	ff 73 10             	push   0x10(%ebx)
+  802806:	ff 73 0c             	push   0xc(%ebx)
+  802809:	ff 33                	push   (%ebx)
+  80280b:	e8 02 f3 ff ff       	call   801b12 <read>
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	85 c0                	test   %eax,%eax
+  802815:	7e 17                	jle    80282e <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802817:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80281b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802822:	89 c2                	mov    %eax,%edx
+  802824:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802827:	89 d0                	mov    %edx,%eax
+  802829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80282e:	c1 f8 1f             	sar    $0x1f,%eax
+  802831:	83 e0 04             	and    $0x4,%eax
+  802834:	83 c0 04             	add    $0x4,%eax
+  802837:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80283a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283f:	eb e6                	jmp    802827 <stream_fill+0x56>
+
+00802841 <fopen>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	57                   	push   %edi
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80284d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802850:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802856:	89 f0                	mov    %esi,%eax
+  802858:	e8 40 fd ff ff       	call   80259d <parse_mode>
+		return 0;
+  80285d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 2d                	js     802893 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802866:	83 ec 08             	sub    $0x8,%esp
+  802869:	50                   	push   %eax
+  80286a:	ff 75 08             	push   0x8(%ebp)
+  80286d:	e8 e8 f8 ff ff       	call   80215a <open>
+  802872:	89 c7                	mov    %eax,%edi
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 58                	js     8028d3 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80287b:	80 3e 61             	cmpb   $0x61,(%esi)
+  80287e:	74 1d                	je     80289d <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802880:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802886:	89 f8                	mov    %edi,%eax
+  802888:	e8 7b fd ff ff       	call   802608 <stream_alloc>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	74 32                	je     8028c5 <fopen+0x84>
+}
+  802893:	89 d8                	mov    %ebx,%eax
+  802895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802898:	5b                   	pop    %ebx
+  802899:	5e                   	pop    %esi
+  80289a:	5f                   	pop    %edi
+  80289b:	5d                   	pop    %ebp
+  80289c:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80289d:	83 ec 08             	sub    $0x8,%esp
+  8028a0:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8028a6:	50                   	push   %eax
+  8028a7:	57                   	push   %edi
+  8028a8:	e8 db f4 ff ff       	call   801d88 <fstat>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	78 cc                	js     802880 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+  8028b7:	ff 75 dc             	push   -0x24(%ebp)
+  8028ba:	57                   	push   %edi
+  8028bb:	e8 f6 f3 ff ff       	call   801cb6 <seek>
+  8028c0:	83 c4 10             	add    $0x10,%esp
+  8028c3:	eb bb                	jmp    802880 <fopen+0x3f>
+		close(fd);
+  8028c5:	83 ec 0c             	sub    $0xc,%esp
+  8028c8:	57                   	push   %edi
+  8028c9:	e8 08 f1 ff ff       	call   8019d6 <close>
+  8028ce:	83 c4 10             	add    $0x10,%esp
+  8028d1:	eb c0                	jmp    802893 <fopen+0x52>
+		return 0;
+  8028d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d8:	eb b9                	jmp    802893 <fopen+0x52>
+
+008028da <fdopen>:
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8028e0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e6:	e8 b2 fc ff ff       	call   80259d <parse_mode>
+  8028eb:	89 c2                	mov    %eax,%edx
+		return 0;
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8028f2:	85 d2                	test   %edx,%edx
+  8028f4:	78 0b                	js     802901 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8028f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fc:	e8 07 fd ff ff       	call   802608 <stream_alloc>
+}
+  802901:	c9                   	leave
+  802902:	c3                   	ret
+
+00802903 <setvbuf>:
+{
+  802903:	55                   	push   %ebp
+  802904:	89 e5                	mov    %esp,%ebp
+  802906:	57                   	push   %edi
+  802907:	56                   	push   %esi
+  802908:	53                   	push   %ebx
+  802909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80290f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802912:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802916:	75 3a                	jne    802952 <setvbuf+0x4f>
+  802918:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80291b:	83 fe 02             	cmp    $0x2,%esi
+  80291e:	77 39                	ja     802959 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802920:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802923:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802927:	0f 95 c3             	setne  %bl
+  80292a:	85 ff                	test   %edi,%edi
+  80292c:	0f 95 c1             	setne  %cl
+  80292f:	84 cb                	test   %cl,%bl
+  802931:	74 05                	je     802938 <setvbuf+0x35>
+  802933:	83 fa 03             	cmp    $0x3,%edx
+  802936:	75 0a                	jne    802942 <setvbuf+0x3f>
+	return 0;
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80293d:	5b                   	pop    %ebx
+  80293e:	5e                   	pop    %esi
+  80293f:	5f                   	pop    %edi
+  802940:	5d                   	pop    %ebp
+  802941:	c3                   	ret
+		f->f_buf = buf;
+  802942:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802945:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802948:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802950:	eb eb                	jmp    80293d <setvbuf+0x3a>
+		return EOF;
+  802952:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802957:	eb e4                	jmp    80293d <setvbuf+0x3a>
+  802959:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80295e:	eb dd                	jmp    80293d <setvbuf+0x3a>
+
+00802960 <fflush>:
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	57                   	push   %edi
+  802964:	56                   	push   %esi
+  802965:	53                   	push   %ebx
+  802966:	83 ec 0c             	sub    $0xc,%esp
+  802969:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80296c:	85 db                	test   %ebx,%ebx
+  80296e:	74 1a                	je     80298a <fflush+0x2a>
+	stream_unread(f);
+  802970:	89 d8                	mov    %ebx,%eax
+  802972:	e8 0a fd ff ff       	call   802681 <stream_unread>
+	return stream_drain(f);
+  802977:	89 d8                	mov    %ebx,%eax
+  802979:	e8 76 fd ff ff       	call   8026f4 <stream_drain>
+  80297e:	89 c7                	mov    %eax,%edi
+}
+  802980:	89 f8                	mov    %edi,%eax
+  802982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802985:	5b                   	pop    %ebx
+  802986:	5e                   	pop    %esi
+  802987:	5f                   	pop    %edi
+  802988:	5d                   	pop    %ebp
+  802989:	c3                   	ret
+  80298a:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  80298f:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802994:	bf 00 00 00 00       	mov    $0x0,%edi
+  802999:	eb 03                	jmp    80299e <fflush+0x3e>
+  80299b:	83 c3 24             	add    $0x24,%ebx
+  80299e:	39 f3                	cmp    %esi,%ebx
+  8029a0:	74 de                	je     802980 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8029a2:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8029a6:	74 f3                	je     80299b <fflush+0x3b>
+  8029a8:	83 ec 0c             	sub    $0xc,%esp
+  8029ab:	53                   	push   %ebx
+  8029ac:	e8 af ff ff ff       	call   802960 <fflush>
+  8029b1:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029bb:	0f 48 f8             	cmovs  %eax,%edi
+  8029be:	eb db                	jmp    80299b <fflush+0x3b>
+
+008029c0 <fclose>:
+{
+  8029c0:	55                   	push   %ebp
+  8029c1:	89 e5                	mov    %esp,%ebp
+  8029c3:	56                   	push   %esi
+  8029c4:	53                   	push   %ebx
+  8029c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8029c8:	83 ec 0c             	sub    $0xc,%esp
+  8029cb:	56                   	push   %esi
+  8029cc:	e8 8f ff ff ff       	call   802960 <fflush>
+  8029d1:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8029d3:	83 c4 04             	add    $0x4,%esp
+  8029d6:	ff 36                	push   (%esi)
+  8029d8:	e8 f9 ef ff ff       	call   8019d6 <close>
+  8029dd:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8029e0:	85 c0                	test   %eax,%eax
+  8029e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029e7:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8029ea:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8029ee:	75 10                	jne    802a00 <fclose+0x40>
+	f->f_flags = 0;
+  8029f0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8029f7:	89 d8                	mov    %ebx,%eax
+  8029f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029fc:	5b                   	pop    %ebx
+  8029fd:	5e                   	pop    %esi
+  8029fe:	5d                   	pop    %ebp
+  8029ff:	c3                   	ret
+		free(f->f_buf);
+  802a00:	83 ec 0c             	sub    $0xc,%esp
+  802a03:	ff 76 0c             	push   0xc(%esi)
+  802a06:	e8 54 08 00 00       	call   80325f <free>
+  802a0b:	83 c4 10             	add    $0x10,%esp
+  802a0e:	eb e0                	jmp    8029f0 <fclose+0x30>
+
+00802a10 <fileno>:
+{
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a16:	8b 00                	mov    (%eax),%eax
+}
+  802a18:	5d                   	pop    %ebp
+  802a19:	c3                   	ret
+
+00802a1a <feof>:
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a20:	8b 40 04             	mov    0x4(%eax),%eax
+  802a23:	c1 e8 02             	shr    $0x2,%eax
+  802a26:	83 e0 01             	and    $0x1,%eax
+}
+  802a29:	5d                   	pop    %ebp
+  802a2a:	c3                   	ret
+
+00802a2b <ferror>:
+{
+  802a2b:	55                   	push   %ebp
+  802a2c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	8b 40 04             	mov    0x4(%eax),%eax
+  802a34:	c1 e8 03             	shr    $0x3,%eax
+  802a37:	83 e0 01             	and    $0x1,%eax
+}
+  802a3a:	5d                   	pop    %ebp
+  802a3b:	c3                   	ret
+
+00802a3c <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	53                   	push   %ebx
+  802a40:	83 ec 04             	sub    $0x4,%esp
+  802a43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a46:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a49:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802a4c:	74 15                	je     802a63 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802a4e:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802a51:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a54:	8d 48 01             	lea    0x1(%eax),%ecx
+  802a57:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802a5a:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a63:	89 d8                	mov    %ebx,%eax
+  802a65:	e8 67 fd ff ff       	call   8027d1 <stream_fill>
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	75 e0                	jne    802a4e <fgetc+0x12>
+		return EOF;
+  802a6e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a73:	eb e9                	jmp    802a5e <fgetc+0x22>
+
+00802a75 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802a75:	55                   	push   %ebp
+  802a76:	89 e5                	mov    %esp,%ebp
+  802a78:	57                   	push   %edi
+  802a79:	56                   	push   %esi
+  802a7a:	53                   	push   %ebx
+  802a7b:	83 ec 1c             	sub    $0x1c,%esp
+  802a7e:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802a81:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802a86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a89:	83 e8 01             	sub    $0x1,%eax
+  802a8c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802a8f:	eb 66                	jmp    802af7 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802a91:	8b 46 14             	mov    0x14(%esi),%eax
+  802a94:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802a97:	29 c3                	sub    %eax,%ebx
+  802a99:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a9c:	29 fa                	sub    %edi,%edx
+  802a9e:	39 d3                	cmp    %edx,%ebx
+  802aa0:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802aa3:	83 ec 04             	sub    $0x4,%esp
+  802aa6:	53                   	push   %ebx
+  802aa7:	6a 0a                	push   $0xa
+  802aa9:	03 46 0c             	add    0xc(%esi),%eax
+  802aac:	50                   	push   %eax
+  802aad:	e8 aa e6 ff ff       	call   80115c <memfind>
+  802ab2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802ab5:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ab8:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802abb:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802abe:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ac6:	74 0b                	je     802ad3 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802ac8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802acb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ace:	29 d3                	sub    %edx,%ebx
+  802ad0:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802ad3:	83 ec 04             	sub    $0x4,%esp
+  802ad6:	53                   	push   %ebx
+  802ad7:	01 c8                	add    %ecx,%eax
+  802ad9:	50                   	push   %eax
+  802ada:	89 f8                	mov    %edi,%eax
+  802adc:	03 45 08             	add    0x8(%ebp),%eax
+  802adf:	50                   	push   %eax
+  802ae0:	e8 c6 e5 ff ff       	call   8010ab <memmove>
+		f->f_rpos += m;
+  802ae5:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802ae8:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802aea:	83 c4 10             	add    $0x10,%esp
+  802aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af0:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802af5:	74 1f                	je     802b16 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802af7:	8d 47 01             	lea    0x1(%edi),%eax
+  802afa:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802afd:	73 17                	jae    802b16 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802aff:	8b 46 18             	mov    0x18(%esi),%eax
+  802b02:	39 46 14             	cmp    %eax,0x14(%esi)
+  802b05:	75 8a                	jne    802a91 <fgets+0x1c>
+  802b07:	89 f0                	mov    %esi,%eax
+  802b09:	e8 c3 fc ff ff       	call   8027d1 <stream_fill>
+  802b0e:	85 c0                	test   %eax,%eax
+  802b10:	0f 85 7b ff ff ff    	jne    802a91 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b16:	85 ff                	test   %edi,%edi
+  802b18:	74 0f                	je     802b29 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1d:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802b21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b24:	5b                   	pop    %ebx
+  802b25:	5e                   	pop    %esi
+  802b26:	5f                   	pop    %edi
+  802b27:	5d                   	pop    %ebp
+  802b28:	c3                   	ret
+		return 0;
+  802b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2e:	eb f1                	jmp    802b21 <fgets+0xac>
+
+00802b30 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802b30:	55                   	push   %ebp
+  802b31:	89 e5                	mov    %esp,%ebp
+  802b33:	57                   	push   %edi
+  802b34:	56                   	push   %esi
+  802b35:	53                   	push   %ebx
+  802b36:	83 ec 1c             	sub    $0x1c,%esp
+  802b39:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802b3c:	89 f0                	mov    %esi,%eax
+  802b3e:	e8 21 fc ff ff       	call   802764 <stream_setup>
+	want = size * n;
+  802b43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b46:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b52:	eb 43                	jmp    802b97 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802b54:	29 d3                	sub    %edx,%ebx
+  802b56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b59:	29 f8                	sub    %edi,%eax
+  802b5b:	39 c3                	cmp    %eax,%ebx
+  802b5d:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802b60:	83 ec 04             	sub    $0x4,%esp
+  802b63:	53                   	push   %ebx
+  802b64:	03 56 0c             	add    0xc(%esi),%edx
+  802b67:	52                   	push   %edx
+  802b68:	89 f8                	mov    %edi,%eax
+  802b6a:	03 45 08             	add    0x8(%ebp),%eax
+  802b6d:	50                   	push   %eax
+  802b6e:	e8 38 e5 ff ff       	call   8010ab <memmove>
+			f->f_rpos += m;
+  802b73:	01 5e 14             	add    %ebx,0x14(%esi)
+  802b76:	83 c4 10             	add    $0x10,%esp
+  802b79:	eb 1a                	jmp    802b95 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802b7b:	83 ec 04             	sub    $0x4,%esp
+  802b7e:	53                   	push   %ebx
+  802b7f:	89 f8                	mov    %edi,%eax
+  802b81:	03 45 08             	add    0x8(%ebp),%eax
+  802b84:	50                   	push   %eax
+  802b85:	ff 36                	push   (%esi)
+  802b87:	e8 86 ef ff ff       	call   801b12 <read>
+  802b8c:	89 c3                	mov    %eax,%ebx
+  802b8e:	83 c4 10             	add    $0x10,%esp
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	7e 36                	jle    802bcb <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802b95:	01 df                	add    %ebx,%edi
+  802b97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b9a:	39 c7                	cmp    %eax,%edi
+  802b9c:	73 39                	jae    802bd7 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802b9e:	8b 56 14             	mov    0x14(%esi),%edx
+  802ba1:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ba4:	39 da                	cmp    %ebx,%edx
+  802ba6:	72 ac                	jb     802b54 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802ba8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802bab:	29 fb                	sub    %edi,%ebx
+  802bad:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802bb0:	72 3e                	jb     802bf0 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802bb2:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802bb6:	74 1f                	je     802bd7 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802bb8:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802bbc:	74 bd                	je     802b7b <fread+0x4b>
+  802bbe:	89 f0                	mov    %esi,%eax
+  802bc0:	e8 2f fb ff ff       	call   8026f4 <stream_drain>
+  802bc5:	85 c0                	test   %eax,%eax
+  802bc7:	79 b2                	jns    802b7b <fread+0x4b>
+  802bc9:	eb 0c                	jmp    802bd7 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802bcb:	c1 fb 1f             	sar    $0x1f,%ebx
+  802bce:	83 e3 04             	and    $0x4,%ebx
+  802bd1:	83 c3 04             	add    $0x4,%ebx
+  802bd4:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802bd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bda:	85 c0                	test   %eax,%eax
+  802bdc:	74 0a                	je     802be8 <fread+0xb8>
+  802bde:	89 f8                	mov    %edi,%eax
+  802be0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be5:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802beb:	5b                   	pop    %ebx
+  802bec:	5e                   	pop    %esi
+  802bed:	5f                   	pop    %edi
+  802bee:	5d                   	pop    %ebp
+  802bef:	c3                   	ret
+		} else if (!stream_fill(f))
+  802bf0:	89 f0                	mov    %esi,%eax
+  802bf2:	e8 da fb ff ff       	call   8027d1 <stream_fill>
+  802bf7:	85 c0                	test   %eax,%eax
+  802bf9:	74 dc                	je     802bd7 <fread+0xa7>
+			m = 0;
+  802bfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c00:	eb 93                	jmp    802b95 <fread+0x65>
+
+00802c02 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	57                   	push   %edi
+  802c06:	56                   	push   %esi
+  802c07:	53                   	push   %ebx
+  802c08:	83 ec 1c             	sub    $0x1c,%esp
+  802c0b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c0e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c11:	a8 02                	test   $0x2,%al
+  802c13:	75 13                	jne    802c28 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c15:	83 c8 08             	or     $0x8,%eax
+  802c18:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c23:	5b                   	pop    %ebx
+  802c24:	5e                   	pop    %esi
+  802c25:	5f                   	pop    %edi
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+	stream_setup(f);
+  802c28:	89 d8                	mov    %ebx,%eax
+  802c2a:	e8 35 fb ff ff       	call   802764 <stream_setup>
+	want = size * n;
+  802c2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c32:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802c39:	89 d8                	mov    %ebx,%eax
+  802c3b:	e8 41 fa ff ff       	call   802681 <stream_unread>
+	for (done = 0; done < want; ) {
+  802c40:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802c45:	84 c0                	test   %al,%al
+  802c47:	75 7b                	jne    802cc4 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802c49:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802c51:	39 fe                	cmp    %edi,%esi
+  802c53:	73 24                	jae    802c79 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802c55:	83 ec 04             	sub    $0x4,%esp
+  802c58:	89 f8                	mov    %edi,%eax
+  802c5a:	29 f0                	sub    %esi,%eax
+  802c5c:	50                   	push   %eax
+  802c5d:	89 f0                	mov    %esi,%eax
+  802c5f:	03 45 08             	add    0x8(%ebp),%eax
+  802c62:	50                   	push   %eax
+  802c63:	ff 33                	push   (%ebx)
+  802c65:	e8 a0 ef ff ff       	call   801c0a <write>
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	7e 04                	jle    802c75 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802c71:	01 c6                	add    %eax,%esi
+  802c73:	eb dc                	jmp    802c51 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802c75:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802c79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c7c:	85 c0                	test   %eax,%eax
+  802c7e:	74 a0                	je     802c20 <fwrite+0x1e>
+  802c80:	89 f0                	mov    %esi,%eax
+  802c82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c87:	f7 75 0c             	divl   0xc(%ebp)
+  802c8a:	eb 94                	jmp    802c20 <fwrite+0x1e>
+			done += r;
+  802c8c:	01 c7                	add    %eax,%edi
+			continue;
+  802c8e:	eb 34                	jmp    802cc4 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802c90:	8b 73 10             	mov    0x10(%ebx),%esi
+  802c93:	29 c6                	sub    %eax,%esi
+  802c95:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c98:	29 fa                	sub    %edi,%edx
+  802c9a:	39 d6                	cmp    %edx,%esi
+  802c9c:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802c9f:	83 ec 04             	sub    $0x4,%esp
+  802ca2:	56                   	push   %esi
+  802ca3:	89 fa                	mov    %edi,%edx
+  802ca5:	03 55 08             	add    0x8(%ebp),%edx
+  802ca8:	52                   	push   %edx
+  802ca9:	03 43 0c             	add    0xc(%ebx),%eax
+  802cac:	50                   	push   %eax
+  802cad:	e8 f9 e3 ff ff       	call   8010ab <memmove>
+		f->f_wend += m;
+  802cb2:	89 f0                	mov    %esi,%eax
+  802cb4:	03 43 1c             	add    0x1c(%ebx),%eax
+  802cb7:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802cba:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802cbc:	83 c4 10             	add    $0x10,%esp
+  802cbf:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802cc2:	74 5b                	je     802d1f <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802cc4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cc7:	39 c7                	cmp    %eax,%edi
+  802cc9:	73 2d                	jae    802cf8 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802ccb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	75 be                	jne    802c90 <fwrite+0x8e>
+  802cd2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cd5:	29 fa                	sub    %edi,%edx
+  802cd7:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802cda:	72 b4                	jb     802c90 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802cdc:	83 ec 04             	sub    $0x4,%esp
+  802cdf:	52                   	push   %edx
+  802ce0:	89 f8                	mov    %edi,%eax
+  802ce2:	03 45 08             	add    0x8(%ebp),%eax
+  802ce5:	50                   	push   %eax
+  802ce6:	ff 33                	push   (%ebx)
+  802ce8:	e8 1d ef ff ff       	call   801c0a <write>
+  802ced:	83 c4 10             	add    $0x10,%esp
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	7f 98                	jg     802c8c <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802cf4:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802cf8:	8b 43 08             	mov    0x8(%ebx),%eax
+  802cfb:	83 f8 03             	cmp    $0x3,%eax
+  802cfe:	74 48                	je     802d48 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d00:	83 f8 02             	cmp    $0x2,%eax
+  802d03:	74 27                	je     802d2c <fwrite+0x12a>
+	return size ? done / size : 0;
+  802d05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d08:	85 c0                	test   %eax,%eax
+  802d0a:	0f 84 10 ff ff ff    	je     802c20 <fwrite+0x1e>
+  802d10:	89 f8                	mov    %edi,%eax
+  802d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d17:	f7 75 0c             	divl   0xc(%ebp)
+  802d1a:	e9 01 ff ff ff       	jmp    802c20 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d1f:	89 d8                	mov    %ebx,%eax
+  802d21:	e8 ce f9 ff ff       	call   8026f4 <stream_drain>
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	79 9a                	jns    802cc4 <fwrite+0xc2>
+  802d2a:	eb cc                	jmp    802cf8 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d2c:	83 ec 04             	sub    $0x4,%esp
+  802d2f:	57                   	push   %edi
+  802d30:	6a 0a                	push   $0xa
+  802d32:	ff 75 08             	push   0x8(%ebp)
+  802d35:	e8 22 e4 ff ff       	call   80115c <memfind>
+  802d3a:	89 c2                	mov    %eax,%edx
+  802d3c:	89 f8                	mov    %edi,%eax
+  802d3e:	03 45 08             	add    0x8(%ebp),%eax
+  802d41:	83 c4 10             	add    $0x10,%esp
+  802d44:	39 c2                	cmp    %eax,%edx
+  802d46:	74 bd                	je     802d05 <fwrite+0x103>
+		stream_drain(f);
+  802d48:	89 d8                	mov    %ebx,%eax
+  802d4a:	e8 a5 f9 ff ff       	call   8026f4 <stream_drain>
+  802d4f:	eb b4                	jmp    802d05 <fwrite+0x103>
+
+00802d51 <fputc>:
+{
+  802d51:	55                   	push   %ebp
+  802d52:	89 e5                	mov    %esp,%ebp
+  802d54:	53                   	push   %ebx
+  802d55:	83 ec 14             	sub    $0x14,%esp
+  802d58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802d5b:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802d5e:	ff 75 0c             	push   0xc(%ebp)
+  802d61:	6a 01                	push   $0x1
+  802d63:	6a 01                	push   $0x1
+  802d65:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d68:	50                   	push   %eax
+  802d69:	e8 94 fe ff ff       	call   802c02 <fwrite>
+  802d6e:	83 c4 10             	add    $0x10,%esp
+  802d71:	0f b6 db             	movzbl %bl,%ebx
+  802d74:	83 f8 01             	cmp    $0x1,%eax
+  802d77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d7c:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802d7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d82:	c9                   	leave
+  802d83:	c3                   	ret
+
+00802d84 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802d8a:	ff 75 0c             	push   0xc(%ebp)
+  802d8d:	ff 75 08             	push   0x8(%ebp)
+  802d90:	e8 bc ff ff ff       	call   802d51 <fputc>
+}
+  802d95:	83 c4 10             	add    $0x10,%esp
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+
+00802d9a <fputs>:
+{
+  802d9a:	55                   	push   %ebp
+  802d9b:	89 e5                	mov    %esp,%ebp
+  802d9d:	56                   	push   %esi
+  802d9e:	53                   	push   %ebx
+  802d9f:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802da2:	83 ec 0c             	sub    $0xc,%esp
+  802da5:	56                   	push   %esi
+  802da6:	e8 3f e1 ff ff       	call   800eea <strlen>
+  802dab:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802dad:	ff 75 0c             	push   0xc(%ebp)
+  802db0:	50                   	push   %eax
+  802db1:	6a 01                	push   $0x1
+  802db3:	56                   	push   %esi
+  802db4:	e8 49 fe ff ff       	call   802c02 <fwrite>
+  802db9:	83 c4 20             	add    $0x20,%esp
+  802dbc:	39 d8                	cmp    %ebx,%eax
+  802dbe:	0f 95 c0             	setne  %al
+  802dc1:	0f b6 c0             	movzbl %al,%eax
+  802dc4:	f7 d8                	neg    %eax
+}
+  802dc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc9:	5b                   	pop    %ebx
+  802dca:	5e                   	pop    %esi
+  802dcb:	5d                   	pop    %ebp
+  802dcc:	c3                   	ret
+
+00802dcd <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802dcd:	55                   	push   %ebp
+  802dce:	89 e5                	mov    %esp,%ebp
+  802dd0:	53                   	push   %ebx
+  802dd1:	83 ec 04             	sub    $0x4,%esp
+  802dd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802dd7:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802dda:	50                   	push   %eax
+  802ddb:	ff 75 0c             	push   0xc(%ebp)
+  802dde:	53                   	push   %ebx
+  802ddf:	68 84 2d 80 00       	push   $0x802d84
+  802de4:	e8 4f dc ff ff       	call   800a38 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802de9:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dec:	c1 e0 1c             	shl    $0x1c,%eax
+  802def:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802df2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+
+00802df7 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802dfd:	68 f8 54 80 00       	push   $0x8054f8
+  802e02:	ff 75 0c             	push   0xc(%ebp)
+  802e05:	e8 1b e1 ff ff       	call   800f25 <strcpy>
+	return 0;
+}
+  802e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0f:	c9                   	leave
+  802e10:	c3                   	ret
+
+00802e11 <devsock_close>:
+{
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	53                   	push   %ebx
+  802e15:	83 ec 10             	sub    $0x10,%esp
+  802e18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e1b:	53                   	push   %ebx
+  802e1c:	e8 23 1d 00 00       	call   804b44 <pageref>
+  802e21:	89 c2                	mov    %eax,%edx
+  802e23:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e26:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e2b:	83 fa 01             	cmp    $0x1,%edx
+  802e2e:	74 05                	je     802e35 <devsock_close+0x24>
+}
+  802e30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e33:	c9                   	leave
+  802e34:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e35:	83 ec 0c             	sub    $0xc,%esp
+  802e38:	ff 73 0c             	push   0xc(%ebx)
+  802e3b:	e8 b7 02 00 00       	call   8030f7 <nsipc_close>
+  802e40:	83 c4 10             	add    $0x10,%esp
+  802e43:	eb eb                	jmp    802e30 <devsock_close+0x1f>
+
+00802e45 <devsock_write>:
+{
+  802e45:	55                   	push   %ebp
+  802e46:	89 e5                	mov    %esp,%ebp
+  802e48:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802e4b:	6a 00                	push   $0x0
+  802e4d:	ff 75 10             	push   0x10(%ebp)
+  802e50:	ff 75 0c             	push   0xc(%ebp)
+  802e53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e56:	ff 70 0c             	push   0xc(%eax)
+  802e59:	e8 79 03 00 00       	call   8031d7 <nsipc_send>
+}
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+
+00802e60 <devsock_read>:
+{
+  802e60:	55                   	push   %ebp
+  802e61:	89 e5                	mov    %esp,%ebp
+  802e63:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802e66:	6a 00                	push   $0x0
+  802e68:	ff 75 10             	push   0x10(%ebp)
+  802e6b:	ff 75 0c             	push   0xc(%ebp)
+  802e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e71:	ff 70 0c             	push   0xc(%eax)
+  802e74:	e8 ef 02 00 00       	call   803168 <nsipc_recv>
+}
+  802e79:	c9                   	leave
+  802e7a:	c3                   	ret
+
+00802e7b <fd2sockid>:
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802e81:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802e84:	52                   	push   %edx
+  802e85:	50                   	push   %eax
+  802e86:	e8 f7 e9 ff ff       	call   801882 <fd_lookup>
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	85 c0                	test   %eax,%eax
+  802e90:	78 10                	js     802ea2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802e92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e95:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  802e9b:	39 08                	cmp    %ecx,(%eax)
+  802e9d:	75 05                	jne    802ea4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802e9f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ea2:	c9                   	leave
+  802ea3:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ea4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ea9:	eb f7                	jmp    802ea2 <fd2sockid+0x27>
+
+00802eab <alloc_sockfd>:
+{
+  802eab:	55                   	push   %ebp
+  802eac:	89 e5                	mov    %esp,%ebp
+  802eae:	56                   	push   %esi
+  802eaf:	53                   	push   %ebx
+  802eb0:	83 ec 1c             	sub    $0x1c,%esp
+  802eb3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb8:	50                   	push   %eax
+  802eb9:	e8 6e e9 ff ff       	call   80182c <fd_alloc>
+  802ebe:	89 c3                	mov    %eax,%ebx
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	78 43                	js     802f0a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ec7:	83 ec 04             	sub    $0x4,%esp
+  802eca:	68 07 04 00 00       	push   $0x407
+  802ecf:	ff 75 f4             	push   -0xc(%ebp)
+  802ed2:	6a 00                	push   $0x0
+  802ed4:	e8 8a e4 ff ff       	call   801363 <sys_page_alloc>
+  802ed9:	89 c3                	mov    %eax,%ebx
+  802edb:	83 c4 10             	add    $0x10,%esp
+  802ede:	85 c0                	test   %eax,%eax
+  802ee0:	78 28                	js     802f0a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee5:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  802eeb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802eed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ef0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802ef7:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802efa:	83 ec 0c             	sub    $0xc,%esp
+  802efd:	50                   	push   %eax
+  802efe:	e8 02 e9 ff ff       	call   801805 <fd2num>
+  802f03:	89 c3                	mov    %eax,%ebx
+  802f05:	83 c4 10             	add    $0x10,%esp
+  802f08:	eb 0c                	jmp    802f16 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f0a:	83 ec 0c             	sub    $0xc,%esp
+  802f0d:	56                   	push   %esi
+  802f0e:	e8 e4 01 00 00       	call   8030f7 <nsipc_close>
+		return r;
+  802f13:	83 c4 10             	add    $0x10,%esp
+}
+  802f16:	89 d8                	mov    %ebx,%eax
+  802f18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f1b:	5b                   	pop    %ebx
+  802f1c:	5e                   	pop    %esi
+  802f1d:	5d                   	pop    %ebp
+  802f1e:	c3                   	ret
+
+00802f1f <accept>:
+{
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f28:	e8 4e ff ff ff       	call   802e7b <fd2sockid>
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	78 1b                	js     802f4c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f31:	83 ec 04             	sub    $0x4,%esp
+  802f34:	ff 75 10             	push   0x10(%ebp)
+  802f37:	ff 75 0c             	push   0xc(%ebp)
+  802f3a:	50                   	push   %eax
+  802f3b:	e8 0e 01 00 00       	call   80304e <nsipc_accept>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	85 c0                	test   %eax,%eax
+  802f45:	78 05                	js     802f4c <accept+0x2d>
+	return alloc_sockfd(r);
+  802f47:	e8 5f ff ff ff       	call   802eab <alloc_sockfd>
+}
+  802f4c:	c9                   	leave
+  802f4d:	c3                   	ret
+
+00802f4e <bind>:
+{
+  802f4e:	55                   	push   %ebp
+  802f4f:	89 e5                	mov    %esp,%ebp
+  802f51:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f57:	e8 1f ff ff ff       	call   802e7b <fd2sockid>
+  802f5c:	85 c0                	test   %eax,%eax
+  802f5e:	78 12                	js     802f72 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802f60:	83 ec 04             	sub    $0x4,%esp
+  802f63:	ff 75 10             	push   0x10(%ebp)
+  802f66:	ff 75 0c             	push   0xc(%ebp)
+  802f69:	50                   	push   %eax
+  802f6a:	e8 31 01 00 00       	call   8030a0 <nsipc_bind>
+  802f6f:	83 c4 10             	add    $0x10,%esp
+}
+  802f72:	c9                   	leave
+  802f73:	c3                   	ret
+
+00802f74 <shutdown>:
+{
+  802f74:	55                   	push   %ebp
+  802f75:	89 e5                	mov    %esp,%ebp
+  802f77:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7d:	e8 f9 fe ff ff       	call   802e7b <fd2sockid>
+  802f82:	85 c0                	test   %eax,%eax
+  802f84:	78 0f                	js     802f95 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802f86:	83 ec 08             	sub    $0x8,%esp
+  802f89:	ff 75 0c             	push   0xc(%ebp)
+  802f8c:	50                   	push   %eax
+  802f8d:	e8 43 01 00 00       	call   8030d5 <nsipc_shutdown>
+  802f92:	83 c4 10             	add    $0x10,%esp
+}
+  802f95:	c9                   	leave
+  802f96:	c3                   	ret
+
+00802f97 <connect>:
+{
+  802f97:	55                   	push   %ebp
+  802f98:	89 e5                	mov    %esp,%ebp
+  802f9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa0:	e8 d6 fe ff ff       	call   802e7b <fd2sockid>
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	78 12                	js     802fbb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802fa9:	83 ec 04             	sub    $0x4,%esp
+  802fac:	ff 75 10             	push   0x10(%ebp)
+  802faf:	ff 75 0c             	push   0xc(%ebp)
+  802fb2:	50                   	push   %eax
+  802fb3:	e8 59 01 00 00       	call   803111 <nsipc_connect>
+  802fb8:	83 c4 10             	add    $0x10,%esp
+}
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+
+00802fbd <listen>:
+{
+  802fbd:	55                   	push   %ebp
+  802fbe:	89 e5                	mov    %esp,%ebp
+  802fc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc6:	e8 b0 fe ff ff       	call   802e7b <fd2sockid>
+  802fcb:	85 c0                	test   %eax,%eax
+  802fcd:	78 0f                	js     802fde <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802fcf:	83 ec 08             	sub    $0x8,%esp
+  802fd2:	ff 75 0c             	push   0xc(%ebp)
+  802fd5:	50                   	push   %eax
+  802fd6:	e8 6b 01 00 00       	call   803146 <nsipc_listen>
+  802fdb:	83 c4 10             	add    $0x10,%esp
+}
+  802fde:	c9                   	leave
+  802fdf:	c3                   	ret
+
+00802fe0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802fe0:	55                   	push   %ebp
+  802fe1:	89 e5                	mov    %esp,%ebp
+  802fe3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802fe6:	ff 75 10             	push   0x10(%ebp)
+  802fe9:	ff 75 0c             	push   0xc(%ebp)
+  802fec:	ff 75 08             	push   0x8(%ebp)
+  802fef:	e8 41 02 00 00       	call   803235 <nsipc_socket>
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	78 05                	js     803000 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802ffb:	e8 ab fe ff ff       	call   802eab <alloc_sockfd>
+}
+  803000:	c9                   	leave
+  803001:	c3                   	ret
+
+00803002 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803002:	55                   	push   %ebp
+  803003:	89 e5                	mov    %esp,%ebp
+  803005:	53                   	push   %ebx
+  803006:	83 ec 04             	sub    $0x4,%esp
+  803009:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80300b:	83 3d 18 70 80 00 00 	cmpl   $0x0,0x807018
+  803012:	74 26                	je     80303a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803014:	6a 07                	push   $0x7
+  803016:	68 00 90 80 00       	push   $0x809000
+  80301b:	53                   	push   %ebx
+  80301c:	ff 35 18 70 80 00    	push   0x807018
+  803022:	e8 88 1a 00 00       	call   804aaf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803027:	83 c4 0c             	add    $0xc,%esp
+  80302a:	6a 00                	push   $0x0
+  80302c:	6a 00                	push   $0x0
+  80302e:	6a 00                	push   $0x0
+  803030:	e8 84 19 00 00       	call   8049b9 <ipc_recv>
+}
+  803035:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803038:	c9                   	leave
+  803039:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80303a:	83 ec 0c             	sub    $0xc,%esp
+  80303d:	6a 02                	push   $0x2
+  80303f:	e8 c1 1a 00 00       	call   804b05 <ipc_find_env>
+  803044:	a3 18 70 80 00       	mov    %eax,0x807018
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	eb c6                	jmp    803014 <nsipc+0x12>
+
+0080304e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80304e:	55                   	push   %ebp
+  80304f:	89 e5                	mov    %esp,%ebp
+  803051:	56                   	push   %esi
+  803052:	53                   	push   %ebx
+  803053:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803056:	8b 45 08             	mov    0x8(%ebp),%eax
+  803059:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80305e:	8b 06                	mov    (%esi),%eax
+  803060:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803065:	b8 01 00 00 00       	mov    $0x1,%eax
+  80306a:	e8 93 ff ff ff       	call   803002 <nsipc>
+  80306f:	89 c3                	mov    %eax,%ebx
+  803071:	85 c0                	test   %eax,%eax
+  803073:	79 09                	jns    80307e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803075:	89 d8                	mov    %ebx,%eax
+  803077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80307a:	5b                   	pop    %ebx
+  80307b:	5e                   	pop    %esi
+  80307c:	5d                   	pop    %ebp
+  80307d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80307e:	83 ec 04             	sub    $0x4,%esp
+  803081:	ff 35 10 90 80 00    	push   0x809010
+  803087:	68 00 90 80 00       	push   $0x809000
+  80308c:	ff 75 0c             	push   0xc(%ebp)
+  80308f:	e8 17 e0 ff ff       	call   8010ab <memmove>
+		*addrlen = ret->ret_addrlen;
+  803094:	a1 10 90 80 00       	mov    0x809010,%eax
+  803099:	89 06                	mov    %eax,(%esi)
+  80309b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80309e:	eb d5                	jmp    803075 <nsipc_accept+0x27>
+
+008030a0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8030a0:	55                   	push   %ebp
+  8030a1:	89 e5                	mov    %esp,%ebp
+  8030a3:	53                   	push   %ebx
+  8030a4:	83 ec 08             	sub    $0x8,%esp
+  8030a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8030aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ad:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8030b2:	53                   	push   %ebx
+  8030b3:	ff 75 0c             	push   0xc(%ebp)
+  8030b6:	68 04 90 80 00       	push   $0x809004
+  8030bb:	e8 eb df ff ff       	call   8010ab <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8030c0:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8030c6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8030cb:	e8 32 ff ff ff       	call   803002 <nsipc>
+}
+  8030d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030d3:	c9                   	leave
+  8030d4:	c3                   	ret
+
+008030d5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8030d5:	55                   	push   %ebp
+  8030d6:	89 e5                	mov    %esp,%ebp
+  8030d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8030db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030de:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8030e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030e6:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8030eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8030f0:	e8 0d ff ff ff       	call   803002 <nsipc>
+}
+  8030f5:	c9                   	leave
+  8030f6:	c3                   	ret
+
+008030f7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8030f7:	55                   	push   %ebp
+  8030f8:	89 e5                	mov    %esp,%ebp
+  8030fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8030fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803100:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803105:	b8 04 00 00 00       	mov    $0x4,%eax
+  80310a:	e8 f3 fe ff ff       	call   803002 <nsipc>
+}
+  80310f:	c9                   	leave
+  803110:	c3                   	ret
+
+00803111 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803111:	55                   	push   %ebp
+  803112:	89 e5                	mov    %esp,%ebp
+  803114:	53                   	push   %ebx
+  803115:	83 ec 08             	sub    $0x8,%esp
+  803118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80311b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80311e:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803123:	53                   	push   %ebx
+  803124:	ff 75 0c             	push   0xc(%ebp)
+  803127:	68 04 90 80 00       	push   $0x809004
+  80312c:	e8 7a df ff ff       	call   8010ab <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803131:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803137:	b8 05 00 00 00       	mov    $0x5,%eax
+  80313c:	e8 c1 fe ff ff       	call   803002 <nsipc>
+}
+  803141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803144:	c9                   	leave
+  803145:	c3                   	ret
+
+00803146 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80314c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80314f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803154:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803157:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80315c:	b8 06 00 00 00       	mov    $0x6,%eax
+  803161:	e8 9c fe ff ff       	call   803002 <nsipc>
+}
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+00803168 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803168:	55                   	push   %ebp
+  803169:	89 e5                	mov    %esp,%ebp
+  80316b:	56                   	push   %esi
+  80316c:	53                   	push   %ebx
+  80316d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803170:	8b 45 08             	mov    0x8(%ebp),%eax
+  803173:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803178:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80317e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803181:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803186:	b8 07 00 00 00       	mov    $0x7,%eax
+  80318b:	e8 72 fe ff ff       	call   803002 <nsipc>
+  803190:	89 c3                	mov    %eax,%ebx
+  803192:	85 c0                	test   %eax,%eax
+  803194:	78 22                	js     8031b8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803196:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80319b:	39 c6                	cmp    %eax,%esi
+  80319d:	0f 4e c6             	cmovle %esi,%eax
+  8031a0:	39 c3                	cmp    %eax,%ebx
+  8031a2:	7f 1d                	jg     8031c1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8031a4:	83 ec 04             	sub    $0x4,%esp
+  8031a7:	53                   	push   %ebx
+  8031a8:	68 00 90 80 00       	push   $0x809000
+  8031ad:	ff 75 0c             	push   0xc(%ebp)
+  8031b0:	e8 f6 de ff ff       	call   8010ab <memmove>
+  8031b5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8031b8:	89 d8                	mov    %ebx,%eax
+  8031ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031bd:	5b                   	pop    %ebx
+  8031be:	5e                   	pop    %esi
+  8031bf:	5d                   	pop    %ebp
+  8031c0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8031c1:	68 04 55 80 00       	push   $0x805504
+  8031c6:	68 bd 54 80 00       	push   $0x8054bd
+  8031cb:	6a 62                	push   $0x62
+  8031cd:	68 19 55 80 00       	push   $0x805519
+  8031d2:	e8 8f d6 ff ff       	call   800866 <_panic>
+
+008031d7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8031d7:	55                   	push   %ebp
+  8031d8:	89 e5                	mov    %esp,%ebp
+  8031da:	53                   	push   %ebx
+  8031db:	83 ec 04             	sub    $0x4,%esp
+  8031de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8031e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8031e9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8031ef:	7f 2e                	jg     80321f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8031f1:	83 ec 04             	sub    $0x4,%esp
+  8031f4:	53                   	push   %ebx
+  8031f5:	ff 75 0c             	push   0xc(%ebp)
+  8031f8:	68 0c 90 80 00       	push   $0x80900c
+  8031fd:	e8 a9 de ff ff       	call   8010ab <memmove>
+	nsipcbuf.send.req_size = size;
+  803202:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803208:	8b 45 14             	mov    0x14(%ebp),%eax
+  80320b:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803210:	b8 08 00 00 00       	mov    $0x8,%eax
+  803215:	e8 e8 fd ff ff       	call   803002 <nsipc>
+}
+  80321a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+	assert(size < 1600);
+  80321f:	68 25 55 80 00       	push   $0x805525
+  803224:	68 bd 54 80 00       	push   $0x8054bd
+  803229:	6a 6d                	push   $0x6d
+  80322b:	68 19 55 80 00       	push   $0x805519
+  803230:	e8 31 d6 ff ff       	call   800866 <_panic>
+
+00803235 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80323b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803243:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803246:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80324b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80324e:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803253:	b8 09 00 00 00       	mov    $0x9,%eax
+  803258:	e8 a5 fd ff ff       	call   803002 <nsipc>
+}
+  80325d:	c9                   	leave
+  80325e:	c3                   	ret
+
+0080325f <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80325f:	55                   	push   %ebp
+  803260:	89 e5                	mov    %esp,%ebp
+  803262:	53                   	push   %ebx
+  803263:	83 ec 10             	sub    $0x10,%esp
+  803266:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803269:	68 1c 70 80 00       	push   $0x80701c
+  80326e:	e8 50 07 00 00       	call   8039c3 <mutex_lock>
+	if (v == 0)
+  803273:	83 c4 10             	add    $0x10,%esp
+  803276:	85 db                	test   %ebx,%ebx
+  803278:	0f 84 85 00 00 00    	je     803303 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80327e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803284:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803289:	77 51                	ja     8032dc <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80328b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803291:	89 d8                	mov    %ebx,%eax
+  803293:	c1 e8 0c             	shr    $0xc,%eax
+  803296:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80329d:	f6 c4 02             	test   $0x2,%ah
+  8032a0:	74 50                	je     8032f2 <free+0x93>
+		sys_page_unmap(0, c);
+  8032a2:	83 ec 08             	sub    $0x8,%esp
+  8032a5:	53                   	push   %ebx
+  8032a6:	6a 00                	push   $0x0
+  8032a8:	e8 4f e1 ff ff       	call   8013fc <sys_page_unmap>
+		c += PGSIZE;
+  8032ad:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8032b3:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8032c1:	76 ce                	jbe    803291 <free+0x32>
+  8032c3:	68 6f 55 80 00       	push   $0x80556f
+  8032c8:	68 bd 54 80 00       	push   $0x8054bd
+  8032cd:	68 82 00 00 00       	push   $0x82
+  8032d2:	68 62 55 80 00       	push   $0x805562
+  8032d7:	e8 8a d5 ff ff       	call   800866 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8032dc:	68 34 55 80 00       	push   $0x805534
+  8032e1:	68 bd 54 80 00       	push   $0x8054bd
+  8032e6:	6a 7b                	push   $0x7b
+  8032e8:	68 62 55 80 00       	push   $0x805562
+  8032ed:	e8 74 d5 ff ff       	call   800866 <_panic>
+	if (--(*ref) == 0)
+  8032f2:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8032f8:	83 e8 01             	sub    $0x1,%eax
+  8032fb:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803301:	74 15                	je     803318 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803303:	83 ec 0c             	sub    $0xc,%esp
+  803306:	68 1c 70 80 00       	push   $0x80701c
+  80330b:	e8 20 07 00 00       	call   803a30 <mutex_unlock>
+}
+  803310:	83 c4 10             	add    $0x10,%esp
+  803313:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803316:	c9                   	leave
+  803317:	c3                   	ret
+		sys_page_unmap(0, c);
+  803318:	83 ec 08             	sub    $0x8,%esp
+  80331b:	53                   	push   %ebx
+  80331c:	6a 00                	push   $0x0
+  80331e:	e8 d9 e0 ff ff       	call   8013fc <sys_page_unmap>
+  803323:	83 c4 10             	add    $0x10,%esp
+  803326:	eb db                	jmp    803303 <free+0xa4>
+
+00803328 <malloc>:
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	57                   	push   %edi
+  80332c:	56                   	push   %esi
+  80332d:	53                   	push   %ebx
+  80332e:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803331:	68 1c 70 80 00       	push   $0x80701c
+  803336:	e8 88 06 00 00       	call   8039c3 <mutex_lock>
+	if (mptr == 0)
+  80333b:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+  803341:	83 c4 10             	add    $0x10,%esp
+  803344:	85 ff                	test   %edi,%edi
+  803346:	74 6c                	je     8033b4 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334b:	83 c0 03             	add    $0x3,%eax
+  80334e:	83 e0 fc             	and    $0xfffffffc,%eax
+  803351:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803353:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803358:	0f 87 64 01 00 00    	ja     8034c2 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80335e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803364:	74 30                	je     803396 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803366:	89 f9                	mov    %edi,%ecx
+  803368:	c1 e9 0c             	shr    $0xc,%ecx
+  80336b:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80336f:	c1 e8 0c             	shr    $0xc,%eax
+  803372:	39 c1                	cmp    %eax,%ecx
+  803374:	74 5f                	je     8033d5 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803376:	83 ec 0c             	sub    $0xc,%esp
+  803379:	57                   	push   %edi
+  80337a:	e8 e0 fe ff ff       	call   80325f <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80337f:	a1 20 70 80 00       	mov    0x807020,%eax
+  803384:	05 00 10 00 00       	add    $0x1000,%eax
+  803389:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80338e:	a3 20 70 80 00       	mov    %eax,0x807020
+  803393:	83 c4 10             	add    $0x10,%esp
+  803396:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+{
+  80339c:	ba 02 00 00 00       	mov    $0x2,%edx
+  8033a1:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8033a5:	8d 7e 04             	lea    0x4(%esi),%edi
+  8033a8:	89 cb                	mov    %ecx,%ebx
+  8033aa:	01 f9                	add    %edi,%ecx
+  8033ac:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8033af:	e9 8b 00 00 00       	jmp    80343f <malloc+0x117>
+		mptr = mbegin;
+  8033b4:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  8033bb:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8033be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c1:	83 c0 03             	add    $0x3,%eax
+  8033c4:	83 e0 fc             	and    $0xfffffffc,%eax
+  8033c7:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8033c9:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8033ce:	76 c6                	jbe    803396 <malloc+0x6e>
+  8033d0:	e9 d6 00 00 00       	jmp    8034ab <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8033d5:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8033db:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8033e0:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8033e4:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8033e7:	a3 20 70 80 00       	mov    %eax,0x807020
+			return v;
+  8033ec:	e9 ba 00 00 00       	jmp    8034ab <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8033f1:	05 00 10 00 00       	add    $0x1000,%eax
+  8033f6:	39 c8                	cmp    %ecx,%eax
+  8033f8:	0f 83 cb 00 00 00    	jae    8034c9 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8033fe:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803403:	77 22                	ja     803427 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803405:	89 c2                	mov    %eax,%edx
+  803407:	c1 ea 16             	shr    $0x16,%edx
+  80340a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803411:	f6 c2 01             	test   $0x1,%dl
+  803414:	74 db                	je     8033f1 <malloc+0xc9>
+  803416:	89 c2                	mov    %eax,%edx
+  803418:	c1 ea 0c             	shr    $0xc,%edx
+  80341b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803422:	f6 c2 01             	test   $0x1,%dl
+  803425:	74 ca                	je     8033f1 <malloc+0xc9>
+		if (mptr == mend) {
+  803427:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80342d:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803433:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803437:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80343d:	74 04                	je     803443 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80343f:	89 d8                	mov    %ebx,%eax
+  803441:	eb b3                	jmp    8033f6 <malloc+0xce>
+  803443:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803446:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80344b:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80344f:	83 ea 01             	sub    $0x1,%edx
+  803452:	0f 85 50 ff ff ff    	jne    8033a8 <malloc+0x80>
+  803458:	c7 05 20 70 80 00 00 	movl   $0x8000000,0x807020
+  80345f:	00 00 08 
+				return 0;	/* out of address space */
+  803462:	bf 00 00 00 00       	mov    $0x0,%edi
+  803467:	eb 42                	jmp    8034ab <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803469:	85 db                	test   %ebx,%ebx
+  80346b:	78 1e                	js     80348b <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80346d:	83 ec 08             	sub    $0x8,%esp
+  803470:	89 d8                	mov    %ebx,%eax
+  803472:	03 05 20 70 80 00    	add    0x807020,%eax
+  803478:	50                   	push   %eax
+  803479:	6a 00                	push   $0x0
+  80347b:	e8 7c df ff ff       	call   8013fc <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803480:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803486:	83 c4 10             	add    $0x10,%esp
+  803489:	eb de                	jmp    803469 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80348b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803490:	eb 19                	jmp    8034ab <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803492:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803495:	8b 3d 20 70 80 00    	mov    0x807020,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80349b:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8034a2:	00 
+	mptr += n;
+  8034a3:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8034a6:	a3 20 70 80 00       	mov    %eax,0x807020
+	mutex_unlock(&malloc_mu);
+  8034ab:	83 ec 0c             	sub    $0xc,%esp
+  8034ae:	68 1c 70 80 00       	push   $0x80701c
+  8034b3:	e8 78 05 00 00       	call   803a30 <mutex_unlock>
+}
+  8034b8:	89 f8                	mov    %edi,%eax
+  8034ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034bd:	5b                   	pop    %ebx
+  8034be:	5e                   	pop    %esi
+  8034bf:	5f                   	pop    %edi
+  8034c0:	5d                   	pop    %ebp
+  8034c1:	c3                   	ret
+		return 0;
+  8034c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c7:	eb e2                	jmp    8034ab <malloc+0x183>
+  8034c9:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8034cd:	74 06                	je     8034d5 <malloc+0x1ad>
+  8034cf:	89 1d 20 70 80 00    	mov    %ebx,0x807020
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8034d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034da:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8034dd:	39 fb                	cmp    %edi,%ebx
+  8034df:	73 b1                	jae    803492 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034e1:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034e7:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034ea:	39 fe                	cmp    %edi,%esi
+  8034ec:	0f 92 c0             	setb   %al
+  8034ef:	0f b6 c0             	movzbl %al,%eax
+  8034f2:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034f5:	83 c8 07             	or     $0x7,%eax
+  8034f8:	50                   	push   %eax
+  8034f9:	89 d8                	mov    %ebx,%eax
+  8034fb:	03 05 20 70 80 00    	add    0x807020,%eax
+  803501:	50                   	push   %eax
+  803502:	6a 00                	push   $0x0
+  803504:	e8 5a de ff ff       	call   801363 <sys_page_alloc>
+  803509:	83 c4 10             	add    $0x10,%esp
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	0f 88 55 ff ff ff    	js     803469 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803514:	89 f3                	mov    %esi,%ebx
+  803516:	eb c5                	jmp    8034dd <malloc+0x1b5>
+
+00803518 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	56                   	push   %esi
+  80351c:	53                   	push   %ebx
+  80351d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803520:	83 ec 0c             	sub    $0xc,%esp
+  803523:	ff 75 08             	push   0x8(%ebp)
+  803526:	e8 ea e2 ff ff       	call   801815 <fd2data>
+  80352b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80352d:	83 c4 08             	add    $0x8,%esp
+  803530:	68 87 55 80 00       	push   $0x805587
+  803535:	53                   	push   %ebx
+  803536:	e8 ea d9 ff ff       	call   800f25 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80353b:	8b 46 04             	mov    0x4(%esi),%eax
+  80353e:	2b 06                	sub    (%esi),%eax
+  803540:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803546:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80354d:	00 00 00 
+	stat->st_dev = &devpipe;
+  803550:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  803557:	62 80 00 
+	return 0;
+}
+  80355a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803562:	5b                   	pop    %ebx
+  803563:	5e                   	pop    %esi
+  803564:	5d                   	pop    %ebp
+  803565:	c3                   	ret
+
+00803566 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803566:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80356b:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80356f:	85 c9                	test   %ecx,%ecx
+  803571:	75 01                	jne    803574 <pipewake+0xe>
+  803573:	c3                   	ret
+{
+  803574:	55                   	push   %ebp
+  803575:	89 e5                	mov    %esp,%ebp
+  803577:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80357a:	68 00 04 00 00       	push   $0x400
+  80357f:	52                   	push   %edx
+  803580:	e8 22 e1 ff ff       	call   8016a7 <sys_futex_wake>
+  803585:	83 c4 10             	add    $0x10,%esp
+}
+  803588:	c9                   	leave
+  803589:	c3                   	ret
+
+0080358a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	56                   	push   %esi
+  80358e:	53                   	push   %ebx
+  80358f:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803592:	83 ec 0c             	sub    $0xc,%esp
+  803595:	56                   	push   %esi
+  803596:	e8 7a e2 ff ff       	call   801815 <fd2data>
+  80359b:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80359d:	83 c4 08             	add    $0x8,%esp
+  8035a0:	56                   	push   %esi
+  8035a1:	6a 00                	push   $0x0
+  8035a3:	e8 54 de ff ff       	call   8013fc <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8035a8:	8d 53 04             	lea    0x4(%ebx),%edx
+  8035ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8035ae:	e8 b3 ff ff ff       	call   803566 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8035b3:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8035b6:	89 da                	mov    %ebx,%edx
+  8035b8:	e8 a9 ff ff ff       	call   803566 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8035bd:	89 34 24             	mov    %esi,(%esp)
+  8035c0:	e8 50 e2 ff ff       	call   801815 <fd2data>
+  8035c5:	83 c4 08             	add    $0x8,%esp
+  8035c8:	50                   	push   %eax
+  8035c9:	6a 00                	push   $0x0
+  8035cb:	e8 2c de ff ff       	call   8013fc <sys_page_unmap>
+}
+  8035d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d3:	5b                   	pop    %ebx
+  8035d4:	5e                   	pop    %esi
+  8035d5:	5d                   	pop    %ebp
+  8035d6:	c3                   	ret
+
+008035d7 <_pipeisclosed>:
+{
+  8035d7:	55                   	push   %ebp
+  8035d8:	89 e5                	mov    %esp,%ebp
+  8035da:	57                   	push   %edi
+  8035db:	56                   	push   %esi
+  8035dc:	53                   	push   %ebx
+  8035dd:	83 ec 1c             	sub    $0x1c,%esp
+  8035e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035e3:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035e5:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8035ea:	eb 5d                	jmp    803649 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8035ec:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		n = thisenv->env_runs;
+  8035f2:	8b 02                	mov    (%edx),%eax
+  8035f4:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8035f7:	83 ec 0c             	sub    $0xc,%esp
+  8035fa:	ff 75 e0             	push   -0x20(%ebp)
+  8035fd:	e8 42 15 00 00       	call   804b44 <pageref>
+  803602:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803605:	89 3c 24             	mov    %edi,(%esp)
+  803608:	e8 37 15 00 00       	call   804b44 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80360d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80360f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80361e:	77 15                	ja     803635 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803620:	89 f2                	mov    %esi,%edx
+  803622:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803624:	c1 ea 10             	shr    $0x10,%edx
+  803627:	74 0c                	je     803635 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803629:	c1 e2 10             	shl    $0x10,%edx
+  80362c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803631:	29 d1                	sub    %edx,%ecx
+  803633:	eb 06                	jmp    80363b <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803635:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		nn = thisenv->env_runs;
+  80363b:	8b 11                	mov    (%ecx),%edx
+  80363d:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803640:	39 d3                	cmp    %edx,%ebx
+  803642:	74 6e                	je     8036b2 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803644:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803647:	74 24                	je     80366d <_pipeisclosed+0x96>
+  803649:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80364b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803651:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803656:	77 94                	ja     8035ec <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803658:	89 f0                	mov    %esi,%eax
+  80365a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80365c:	c1 e8 10             	shr    $0x10,%eax
+  80365f:	74 8b                	je     8035ec <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803661:	c1 e0 10             	shl    $0x10,%eax
+  803664:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803669:	29 c2                	sub    %eax,%edx
+  80366b:	eb 85                	jmp    8035f2 <_pipeisclosed+0x1b>
+  80366d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80366f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803675:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80367a:	77 18                	ja     803694 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80367c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803681:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803683:	c1 e8 10             	shr    $0x10,%eax
+  803686:	74 0c                	je     803694 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803688:	c1 e0 10             	shl    $0x10,%eax
+  80368b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803690:	29 c2                	sub    %eax,%edx
+  803692:	eb 06                	jmp    80369a <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803694:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80369a:	8b 02                	mov    (%edx),%eax
+  80369c:	8b 40 58             	mov    0x58(%eax),%eax
+  80369f:	6a 01                	push   $0x1
+  8036a1:	50                   	push   %eax
+  8036a2:	53                   	push   %ebx
+  8036a3:	68 8e 55 80 00       	push   $0x80558e
+  8036a8:	e8 94 d2 ff ff       	call   800941 <cprintf>
+  8036ad:	83 c4 10             	add    $0x10,%esp
+  8036b0:	eb 97                	jmp    803649 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8036b2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036b5:	0f 94 c0             	sete   %al
+  8036b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8036bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036be:	5b                   	pop    %ebx
+  8036bf:	5e                   	pop    %esi
+  8036c0:	5f                   	pop    %edi
+  8036c1:	5d                   	pop    %ebp
+  8036c2:	c3                   	ret
+
+008036c3 <devpipe_write>:
+{
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	57                   	push   %edi
+  8036c7:	56                   	push   %esi
+  8036c8:	53                   	push   %ebx
+  8036c9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8036cc:	ff 75 08             	push   0x8(%ebp)
+  8036cf:	e8 41 e1 ff ff       	call   801815 <fd2data>
+  8036d4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036d6:	83 c4 10             	add    $0x10,%esp
+  8036d9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8036e0:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8036e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8036e9:	0f 84 96 00 00 00    	je     803785 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8036ef:	8d 73 08             	lea    0x8(%ebx),%esi
+  8036f2:	eb 32                	jmp    803726 <devpipe_write+0x63>
+  8036f4:	89 fa                	mov    %edi,%edx
+  8036f6:	89 f0                	mov    %esi,%eax
+  8036f8:	e8 69 fe ff ff       	call   803566 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8036fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  803700:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803703:	ba 01 00 00 00       	mov    $0x1,%edx
+  803708:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80370d:	83 ec 04             	sub    $0x4,%esp
+  803710:	6a 0a                	push   $0xa
+  803712:	50                   	push   %eax
+  803713:	53                   	push   %ebx
+  803714:	e8 5f df ff ff       	call   801678 <sys_futex_wait>
+  803719:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80371e:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803723:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803726:	8b 43 04             	mov    0x4(%ebx),%eax
+  803729:	8b 0b                	mov    (%ebx),%ecx
+  80372b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80372e:	39 d0                	cmp    %edx,%eax
+  803730:	72 1b                	jb     80374d <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803732:	89 da                	mov    %ebx,%edx
+  803734:	8b 45 08             	mov    0x8(%ebp),%eax
+  803737:	e8 9b fe ff ff       	call   8035d7 <_pipeisclosed>
+  80373c:	85 c0                	test   %eax,%eax
+  80373e:	74 b4                	je     8036f4 <devpipe_write+0x31>
+				return 0;
+  803740:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803748:	5b                   	pop    %ebx
+  803749:	5e                   	pop    %esi
+  80374a:	5f                   	pop    %edi
+  80374b:	5d                   	pop    %ebp
+  80374c:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80374d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803750:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803753:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803757:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80375a:	89 c2                	mov    %eax,%edx
+  80375c:	c1 fa 1f             	sar    $0x1f,%edx
+  80375f:	89 d1                	mov    %edx,%ecx
+  803761:	c1 e9 1b             	shr    $0x1b,%ecx
+  803764:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803767:	83 e2 1f             	and    $0x1f,%edx
+  80376a:	29 ca                	sub    %ecx,%edx
+  80376c:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803770:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803774:	83 c0 01             	add    $0x1,%eax
+  803777:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80377a:	83 c6 01             	add    $0x1,%esi
+  80377d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803780:	e9 5e ff ff ff       	jmp    8036e3 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803785:	8d 53 04             	lea    0x4(%ebx),%edx
+  803788:	8d 43 08             	lea    0x8(%ebx),%eax
+  80378b:	e8 d6 fd ff ff       	call   803566 <pipewake>
+	return i;
+  803790:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803793:	eb b0                	jmp    803745 <devpipe_write+0x82>
+
+00803795 <devpipe_read>:
+{
+  803795:	55                   	push   %ebp
+  803796:	89 e5                	mov    %esp,%ebp
+  803798:	57                   	push   %edi
+  803799:	56                   	push   %esi
+  80379a:	53                   	push   %ebx
+  80379b:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80379e:	ff 75 08             	push   0x8(%ebp)
+  8037a1:	e8 6f e0 ff ff       	call   801815 <fd2data>
+  8037a6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037a8:	83 c4 10             	add    $0x10,%esp
+  8037ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037b3:	74 6c                	je     803821 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8037b5:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8037b8:	eb 25                	jmp    8037df <devpipe_read+0x4a>
+  8037ba:	8b 13                	mov    (%ebx),%edx
+  8037bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037c1:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8037c6:	83 ec 04             	sub    $0x4,%esp
+  8037c9:	6a 0a                	push   $0xa
+  8037cb:	52                   	push   %edx
+  8037cc:	57                   	push   %edi
+  8037cd:	e8 a6 de ff ff       	call   801678 <sys_futex_wait>
+  8037d2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8037d7:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8037dc:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8037df:	8b 03                	mov    (%ebx),%eax
+  8037e1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8037e4:	75 19                	jne    8037ff <devpipe_read+0x6a>
+			if (i > 0)
+  8037e6:	85 f6                	test   %esi,%esi
+  8037e8:	75 3a                	jne    803824 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8037ea:	89 da                	mov    %ebx,%edx
+  8037ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ef:	e8 e3 fd ff ff       	call   8035d7 <_pipeisclosed>
+  8037f4:	85 c0                	test   %eax,%eax
+  8037f6:	74 c2                	je     8037ba <devpipe_read+0x25>
+				return 0;
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fd:	eb 31                	jmp    803830 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8037ff:	89 c1                	mov    %eax,%ecx
+  803801:	c1 f9 1f             	sar    $0x1f,%ecx
+  803804:	c1 e9 1b             	shr    $0x1b,%ecx
+  803807:	01 c8                	add    %ecx,%eax
+  803809:	83 e0 1f             	and    $0x1f,%eax
+  80380c:	29 c8                	sub    %ecx,%eax
+  80380e:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803813:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803816:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803819:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80381c:	83 c6 01             	add    $0x1,%esi
+  80381f:	eb 8f                	jmp    8037b0 <devpipe_read+0x1b>
+out:
+  803821:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803824:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803827:	89 da                	mov    %ebx,%edx
+  803829:	e8 38 fd ff ff       	call   803566 <pipewake>
+	return i;
+  80382e:	89 f0                	mov    %esi,%eax
+}
+  803830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803833:	5b                   	pop    %ebx
+  803834:	5e                   	pop    %esi
+  803835:	5f                   	pop    %edi
+  803836:	5d                   	pop    %ebp
+  803837:	c3                   	ret
+
+00803838 <pipe>:
+{
+  803838:	55                   	push   %ebp
+  803839:	89 e5                	mov    %esp,%ebp
+  80383b:	56                   	push   %esi
+  80383c:	53                   	push   %ebx
+  80383d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803840:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803843:	50                   	push   %eax
+  803844:	e8 e3 df ff ff       	call   80182c <fd_alloc>
+  803849:	89 c3                	mov    %eax,%ebx
+  80384b:	83 c4 10             	add    $0x10,%esp
+  80384e:	85 c0                	test   %eax,%eax
+  803850:	0f 88 23 01 00 00    	js     803979 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803856:	83 ec 04             	sub    $0x4,%esp
+  803859:	68 07 04 00 00       	push   $0x407
+  80385e:	ff 75 f4             	push   -0xc(%ebp)
+  803861:	6a 00                	push   $0x0
+  803863:	e8 fb da ff ff       	call   801363 <sys_page_alloc>
+  803868:	89 c3                	mov    %eax,%ebx
+  80386a:	83 c4 10             	add    $0x10,%esp
+  80386d:	85 c0                	test   %eax,%eax
+  80386f:	0f 88 04 01 00 00    	js     803979 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803875:	83 ec 0c             	sub    $0xc,%esp
+  803878:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80387b:	50                   	push   %eax
+  80387c:	e8 ab df ff ff       	call   80182c <fd_alloc>
+  803881:	89 c3                	mov    %eax,%ebx
+  803883:	83 c4 10             	add    $0x10,%esp
+  803886:	85 c0                	test   %eax,%eax
+  803888:	0f 88 db 00 00 00    	js     803969 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80388e:	83 ec 04             	sub    $0x4,%esp
+  803891:	68 07 04 00 00       	push   $0x407
+  803896:	ff 75 f0             	push   -0x10(%ebp)
+  803899:	6a 00                	push   $0x0
+  80389b:	e8 c3 da ff ff       	call   801363 <sys_page_alloc>
+  8038a0:	89 c3                	mov    %eax,%ebx
+  8038a2:	83 c4 10             	add    $0x10,%esp
+  8038a5:	85 c0                	test   %eax,%eax
+  8038a7:	0f 88 bc 00 00 00    	js     803969 <pipe+0x131>
+	va = fd2data(fd0);
+  8038ad:	83 ec 0c             	sub    $0xc,%esp
+  8038b0:	ff 75 f4             	push   -0xc(%ebp)
+  8038b3:	e8 5d df ff ff       	call   801815 <fd2data>
+  8038b8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038ba:	83 c4 0c             	add    $0xc,%esp
+  8038bd:	68 07 04 00 00       	push   $0x407
+  8038c2:	50                   	push   %eax
+  8038c3:	6a 00                	push   $0x0
+  8038c5:	e8 99 da ff ff       	call   801363 <sys_page_alloc>
+  8038ca:	89 c3                	mov    %eax,%ebx
+  8038cc:	83 c4 10             	add    $0x10,%esp
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	0f 88 82 00 00 00    	js     803959 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038d7:	83 ec 0c             	sub    $0xc,%esp
+  8038da:	ff 75 f0             	push   -0x10(%ebp)
+  8038dd:	e8 33 df ff ff       	call   801815 <fd2data>
+  8038e2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038e9:	50                   	push   %eax
+  8038ea:	6a 00                	push   $0x0
+  8038ec:	56                   	push   %esi
+  8038ed:	6a 00                	push   $0x0
+  8038ef:	e8 bc da ff ff       	call   8013b0 <sys_page_map>
+  8038f4:	89 c3                	mov    %eax,%ebx
+  8038f6:	83 c4 20             	add    $0x20,%esp
+  8038f9:	85 c0                	test   %eax,%eax
+  8038fb:	78 4e                	js     80394b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038fd:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  803902:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803905:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803907:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80390a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803911:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803914:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803916:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803919:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803920:	83 ec 0c             	sub    $0xc,%esp
+  803923:	ff 75 f4             	push   -0xc(%ebp)
+  803926:	e8 da de ff ff       	call   801805 <fd2num>
+  80392b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80392e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803930:	83 c4 04             	add    $0x4,%esp
+  803933:	ff 75 f0             	push   -0x10(%ebp)
+  803936:	e8 ca de ff ff       	call   801805 <fd2num>
+  80393b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80393e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803941:	83 c4 10             	add    $0x10,%esp
+  803944:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803949:	eb 2e                	jmp    803979 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80394b:	83 ec 08             	sub    $0x8,%esp
+  80394e:	56                   	push   %esi
+  80394f:	6a 00                	push   $0x0
+  803951:	e8 a6 da ff ff       	call   8013fc <sys_page_unmap>
+  803956:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803959:	83 ec 08             	sub    $0x8,%esp
+  80395c:	ff 75 f0             	push   -0x10(%ebp)
+  80395f:	6a 00                	push   $0x0
+  803961:	e8 96 da ff ff       	call   8013fc <sys_page_unmap>
+  803966:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803969:	83 ec 08             	sub    $0x8,%esp
+  80396c:	ff 75 f4             	push   -0xc(%ebp)
+  80396f:	6a 00                	push   $0x0
+  803971:	e8 86 da ff ff       	call   8013fc <sys_page_unmap>
+  803976:	83 c4 10             	add    $0x10,%esp
+}
+  803979:	89 d8                	mov    %ebx,%eax
+  80397b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80397e:	5b                   	pop    %ebx
+  80397f:	5e                   	pop    %esi
+  803980:	5d                   	pop    %ebp
+  803981:	c3                   	ret
+
+00803982 <pipeisclosed>:
+{
+  803982:	55                   	push   %ebp
+  803983:	89 e5                	mov    %esp,%ebp
+  803985:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803988:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80398b:	50                   	push   %eax
+  80398c:	ff 75 08             	push   0x8(%ebp)
+  80398f:	e8 ee de ff ff       	call   801882 <fd_lookup>
+  803994:	83 c4 10             	add    $0x10,%esp
+  803997:	85 c0                	test   %eax,%eax
+  803999:	78 18                	js     8039b3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80399b:	83 ec 0c             	sub    $0xc,%esp
+  80399e:	ff 75 f4             	push   -0xc(%ebp)
+  8039a1:	e8 6f de ff ff       	call   801815 <fd2data>
+  8039a6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8039a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039ab:	e8 27 fc ff ff       	call   8035d7 <_pipeisclosed>
+  8039b0:	83 c4 10             	add    $0x10,%esp
+}
+  8039b3:	c9                   	leave
+  8039b4:	c3                   	ret
+
+008039b5 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8039b5:	55                   	push   %ebp
+  8039b6:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8039b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039bb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8039c1:	5d                   	pop    %ebp
+  8039c2:	c3                   	ret
+
+008039c3 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8039c3:	55                   	push   %ebp
+  8039c4:	89 e5                	mov    %esp,%ebp
+  8039c6:	56                   	push   %esi
+  8039c7:	53                   	push   %ebx
+  8039c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8039cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039d0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8039d5:	89 d0                	mov    %edx,%eax
+  8039d7:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8039db:	85 c0                	test   %eax,%eax
+  8039dd:	74 2d                	je     803a0c <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8039df:	83 f8 02             	cmp    $0x2,%eax
+  8039e2:	74 08                	je     8039ec <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8039e4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8039e9:	f0 87 03             	lock xchg %eax,(%ebx)
+  8039ec:	be 02 00 00 00       	mov    $0x2,%esi
+  8039f1:	eb 15                	jmp    803a08 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8039f3:	83 ec 04             	sub    $0x4,%esp
+  8039f6:	6a 00                	push   $0x0
+  8039f8:	6a 02                	push   $0x2
+  8039fa:	53                   	push   %ebx
+  8039fb:	e8 78 dc ff ff       	call   801678 <sys_futex_wait>
+  803a00:	89 f0                	mov    %esi,%eax
+  803a02:	f0 87 03             	lock xchg %eax,(%ebx)
+  803a05:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803a08:	85 c0                	test   %eax,%eax
+  803a0a:	75 e7                	jne    8039f3 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803a0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a0f:	5b                   	pop    %ebx
+  803a10:	5e                   	pop    %esi
+  803a11:	5d                   	pop    %ebp
+  803a12:	c3                   	ret
+
+00803a13 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803a13:	55                   	push   %ebp
+  803a14:	89 e5                	mov    %esp,%ebp
+  803a16:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a23:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803a27:	f7 d8                	neg    %eax
+  803a29:	19 c0                	sbb    %eax,%eax
+  803a2b:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803a2e:	5d                   	pop    %ebp
+  803a2f:	c3                   	ret
+
+00803a30 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803a30:	55                   	push   %ebp
+  803a31:	89 e5                	mov    %esp,%ebp
+  803a33:	83 ec 08             	sub    $0x8,%esp
+  803a36:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3e:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803a41:	83 f8 02             	cmp    $0x2,%eax
+  803a44:	74 02                	je     803a48 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803a46:	c9                   	leave
+  803a47:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803a48:	83 ec 08             	sub    $0x8,%esp
+  803a4b:	6a 01                	push   $0x1
+  803a4d:	52                   	push   %edx
+  803a4e:	e8 54 dc ff ff       	call   8016a7 <sys_futex_wake>
+  803a53:	83 c4 10             	add    $0x10,%esp
+}
+  803a56:	eb ee                	jmp    803a46 <mutex_unlock+0x16>
+
+00803a58 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803a58:	55                   	push   %ebp
+  803a59:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a5e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a64:	5d                   	pop    %ebp
+  803a65:	c3                   	ret
+
+00803a66 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803a66:	55                   	push   %ebp
+  803a67:	89 e5                	mov    %esp,%ebp
+  803a69:	57                   	push   %edi
+  803a6a:	56                   	push   %esi
+  803a6b:	53                   	push   %ebx
+  803a6c:	83 ec 18             	sub    $0x18,%esp
+  803a6f:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803a75:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803a77:	53                   	push   %ebx
+  803a78:	e8 b3 ff ff ff       	call   803a30 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803a7d:	83 c4 0c             	add    $0xc,%esp
+  803a80:	ff 75 10             	push   0x10(%ebp)
+  803a83:	57                   	push   %edi
+  803a84:	56                   	push   %esi
+  803a85:	e8 ee db ff ff       	call   801678 <sys_futex_wait>
+  803a8a:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803a8c:	83 c4 10             	add    $0x10,%esp
+  803a8f:	be 02 00 00 00       	mov    $0x2,%esi
+  803a94:	eb 10                	jmp    803aa6 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803a96:	83 ec 04             	sub    $0x4,%esp
+  803a99:	6a 00                	push   $0x0
+  803a9b:	6a 02                	push   $0x2
+  803a9d:	53                   	push   %ebx
+  803a9e:	e8 d5 db ff ff       	call   801678 <sys_futex_wait>
+  803aa3:	83 c4 10             	add    $0x10,%esp
+  803aa6:	89 f0                	mov    %esi,%eax
+  803aa8:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803aab:	85 c0                	test   %eax,%eax
+  803aad:	75 e7                	jne    803a96 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803aaf:	83 ff ec             	cmp    $0xffffffec,%edi
+  803ab2:	74 05                	je     803ab9 <cond_timedwait+0x53>
+  803ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ab9:	89 f8                	mov    %edi,%eax
+  803abb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803abe:	5b                   	pop    %ebx
+  803abf:	5e                   	pop    %esi
+  803ac0:	5f                   	pop    %edi
+  803ac1:	5d                   	pop    %ebp
+  803ac2:	c3                   	ret
+
+00803ac3 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803ac3:	55                   	push   %ebp
+  803ac4:	89 e5                	mov    %esp,%ebp
+  803ac6:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803ac9:	6a 00                	push   $0x0
+  803acb:	ff 75 0c             	push   0xc(%ebp)
+  803ace:	ff 75 08             	push   0x8(%ebp)
+  803ad1:	e8 90 ff ff ff       	call   803a66 <cond_timedwait>
+}
+  803ad6:	83 c4 10             	add    $0x10,%esp
+  803ad9:	c9                   	leave
+  803ada:	c3                   	ret
+
+00803adb <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803adb:	55                   	push   %ebp
+  803adc:	89 e5                	mov    %esp,%ebp
+  803ade:	83 ec 10             	sub    $0x10,%esp
+  803ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803ae4:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ae9:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803aed:	6a 01                	push   $0x1
+  803aef:	50                   	push   %eax
+  803af0:	e8 b2 db ff ff       	call   8016a7 <sys_futex_wake>
+}
+  803af5:	83 c4 10             	add    $0x10,%esp
+  803af8:	c9                   	leave
+  803af9:	c3                   	ret
+
+00803afa <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803afa:	55                   	push   %ebp
+  803afb:	89 e5                	mov    %esp,%ebp
+  803afd:	83 ec 10             	sub    $0x10,%esp
+  803b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b03:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b08:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803b0c:	68 00 04 00 00       	push   $0x400
+  803b11:	50                   	push   %eax
+  803b12:	e8 90 db ff ff       	call   8016a7 <sys_futex_wake>
+}
+  803b17:	83 c4 10             	add    $0x10,%esp
+  803b1a:	c9                   	leave
+  803b1b:	c3                   	ret
+
+00803b1c <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803b1c:	55                   	push   %ebp
+  803b1d:	89 e5                	mov    %esp,%ebp
+  803b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803b22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b25:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803b27:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803b2e:	5d                   	pop    %ebp
+  803b2f:	c3                   	ret
+
+00803b30 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803b30:	55                   	push   %ebp
+  803b31:	89 e5                	mov    %esp,%ebp
+  803b33:	53                   	push   %ebx
+  803b34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803b37:	8b 11                	mov    (%ecx),%edx
+  803b39:	85 d2                	test   %edx,%edx
+  803b3b:	74 14                	je     803b51 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803b3d:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b40:	89 d0                	mov    %edx,%eax
+  803b42:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803b46:	39 c2                	cmp    %eax,%edx
+  803b48:	75 ed                	jne    803b37 <sem_trywait+0x7>
+			return 0;
+  803b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4f:	eb 05                	jmp    803b56 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803b51:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b59:	c9                   	leave
+  803b5a:	c3                   	ret
+
+00803b5b <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803b5b:	55                   	push   %ebp
+  803b5c:	89 e5                	mov    %esp,%ebp
+  803b5e:	57                   	push   %edi
+  803b5f:	56                   	push   %esi
+  803b60:	53                   	push   %ebx
+  803b61:	83 ec 1c             	sub    $0x1c,%esp
+  803b64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803b67:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803b6a:	e8 81 da ff ff       	call   8015f0 <sys_time_msec>
+  803b6f:	01 f8                	add    %edi,%eax
+  803b71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803b74:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803b79:	eb 28                	jmp    803ba3 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803b7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b80:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803b85:	83 ec 04             	sub    $0x4,%esp
+  803b88:	56                   	push   %esi
+  803b89:	6a 00                	push   $0x0
+  803b8b:	53                   	push   %ebx
+  803b8c:	e8 e7 da ff ff       	call   801678 <sys_futex_wait>
+  803b91:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803b96:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803b9b:	83 c4 10             	add    $0x10,%esp
+  803b9e:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803ba1:	74 2e                	je     803bd1 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803ba3:	83 ec 0c             	sub    $0xc,%esp
+  803ba6:	53                   	push   %ebx
+  803ba7:	e8 84 ff ff ff       	call   803b30 <sem_trywait>
+  803bac:	83 c4 10             	add    $0x10,%esp
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	79 19                	jns    803bcc <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803bb3:	85 ff                	test   %edi,%edi
+  803bb5:	74 c4                	je     803b7b <sem_timedwait+0x20>
+  803bb7:	e8 34 da ff ff       	call   8015f0 <sys_time_msec>
+  803bbc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803bbf:	29 c6                	sub    %eax,%esi
+  803bc1:	85 f6                	test   %esi,%esi
+  803bc3:	7f b6                	jg     803b7b <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803bc5:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803bca:	eb 05                	jmp    803bd1 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bd4:	5b                   	pop    %ebx
+  803bd5:	5e                   	pop    %esi
+  803bd6:	5f                   	pop    %edi
+  803bd7:	5d                   	pop    %ebp
+  803bd8:	c3                   	ret
+
+00803bd9 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803bd9:	55                   	push   %ebp
+  803bda:	89 e5                	mov    %esp,%ebp
+  803bdc:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803bdf:	6a 00                	push   $0x0
+  803be1:	ff 75 08             	push   0x8(%ebp)
+  803be4:	e8 72 ff ff ff       	call   803b5b <sem_timedwait>
+}
+  803be9:	83 c4 10             	add    $0x10,%esp
+  803bec:	c9                   	leave
+  803bed:	c3                   	ret
+
+00803bee <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803bee:	55                   	push   %ebp
+  803bef:	89 e5                	mov    %esp,%ebp
+  803bf1:	83 ec 08             	sub    $0x8,%esp
+  803bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bf7:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bfc:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803c00:	8b 50 04             	mov    0x4(%eax),%edx
+  803c03:	85 d2                	test   %edx,%edx
+  803c05:	75 02                	jne    803c09 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803c07:	c9                   	leave
+  803c08:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803c09:	83 ec 08             	sub    $0x8,%esp
+  803c0c:	6a 01                	push   $0x1
+  803c0e:	50                   	push   %eax
+  803c0f:	e8 93 da ff ff       	call   8016a7 <sys_futex_wake>
+  803c14:	83 c4 10             	add    $0x10,%esp
+}
+  803c17:	eb ee                	jmp    803c07 <sem_post+0x19>
+
+00803c19 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803c19:	55                   	push   %ebp
+  803c1a:	89 e5                	mov    %esp,%ebp
+  803c1c:	57                   	push   %edi
+  803c1d:	56                   	push   %esi
+  803c1e:	53                   	push   %ebx
+  803c1f:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803c22:	68 40 70 80 00       	push   $0x807040
+  803c27:	e8 97 fd ff ff       	call   8039c3 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803c2c:	a1 64 70 80 00       	mov    0x807064,%eax
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	75 19                	jne    803c51 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803c38:	a1 e0 72 80 00       	mov    0x8072e0,%eax
+  803c3d:	8b 00                	mov    (%eax),%eax
+  803c3f:	8b 40 48             	mov    0x48(%eax),%eax
+  803c42:	a3 60 70 80 00       	mov    %eax,0x807060
+		threads[0].th_state = PTH_RUNNING;
+  803c47:	c7 05 64 70 80 00 01 	movl   $0x1,0x807064
+  803c4e:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803c51:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803c56:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c59:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803c60:	8b 40 04             	mov    0x4(%eax),%eax
+  803c63:	85 c0                	test   %eax,%eax
+  803c65:	0f 84 e4 00 00 00    	je     803d4f <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803c6b:	83 c3 01             	add    $0x1,%ebx
+  803c6e:	83 fb 20             	cmp    $0x20,%ebx
+  803c71:	75 e3                	jne    803c56 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803c73:	83 ec 0c             	sub    $0xc,%esp
+  803c76:	68 40 70 80 00       	push   $0x807040
+  803c7b:	e8 b0 fd ff ff       	call   803a30 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803c80:	83 c4 10             	add    $0x10,%esp
+  803c83:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803c88:	e9 b8 00 00 00       	jmp    803d45 <pthread_create+0x12c>
+  803c8d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803c90:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803c93:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803c95:	39 f3                	cmp    %esi,%ebx
+  803c97:	73 16                	jae    803caf <pthread_create+0x96>
+		va -= PGSIZE;
+  803c99:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803c9f:	83 ec 08             	sub    $0x8,%esp
+  803ca2:	56                   	push   %esi
+  803ca3:	6a 00                	push   $0x0
+  803ca5:	e8 52 d7 ff ff       	call   8013fc <sys_page_unmap>
+  803caa:	83 c4 10             	add    $0x10,%esp
+  803cad:	eb e6                	jmp    803c95 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803caf:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803cb2:	83 ec 08             	sub    $0x8,%esp
+  803cb5:	ff 75 e4             	push   -0x1c(%ebp)
+  803cb8:	6a 00                	push   $0x0
+  803cba:	e8 3d d7 ff ff       	call   8013fc <sys_page_unmap>
+	return r;
+  803cbf:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803cc2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cc5:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803ccc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803cd3:	eb 70                	jmp    803d45 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803cd5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cd8:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803cdf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ce2:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803ce5:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ce8:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803ceb:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803cf2:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803cf7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803cfa:	29 c8                	sub    %ecx,%eax
+  803cfc:	85 db                	test   %ebx,%ebx
+  803cfe:	0f 44 05 e0 72 80 00 	cmove  0x8072e0,%eax
+	*--esp = t;
+  803d05:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803d08:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d0f:	83 ec 04             	sub    $0x4,%esp
+  803d12:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803d17:	29 ca                	sub    %ecx,%edx
+  803d19:	52                   	push   %edx
+	*--esp = 0;
+  803d1a:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d1d:	50                   	push   %eax
+  803d1e:	68 76 3f 80 00       	push   $0x803f76
+  803d23:	e8 24 da ff ff       	call   80174c <sys_thread_create>
+  803d28:	89 c7                	mov    %eax,%edi
+  803d2a:	83 c4 10             	add    $0x10,%esp
+  803d2d:	85 c0                	test   %eax,%eax
+  803d2f:	78 91                	js     803cc2 <pthread_create+0xa9>
+	th->th_env = id;
+  803d31:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d34:	89 3c 85 60 70 80 00 	mov    %edi,0x807060(,%eax,4)
+	*tp = t;
+  803d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3e:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803d40:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d45:	89 f8                	mov    %edi,%eax
+  803d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d4a:	5b                   	pop    %ebx
+  803d4b:	5e                   	pop    %esi
+  803d4c:	5f                   	pop    %edi
+  803d4d:	5d                   	pop    %ebp
+  803d4e:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803d4f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d52:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803d59:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803d60:	83 ec 0c             	sub    $0xc,%esp
+  803d63:	68 40 70 80 00       	push   $0x807040
+  803d68:	e8 c3 fc ff ff       	call   803a30 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803d6d:	89 d9                	mov    %ebx,%ecx
+  803d6f:	c1 e1 10             	shl    $0x10,%ecx
+  803d72:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803d75:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803d7a:	29 c8                	sub    %ecx,%eax
+  803d7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803d7f:	c1 e8 16             	shr    $0x16,%eax
+  803d82:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d89:	83 c4 10             	add    $0x10,%esp
+  803d8c:	a8 01                	test   $0x1,%al
+  803d8e:	74 15                	je     803da5 <pthread_create+0x18c>
+  803d90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803d93:	c1 e8 0c             	shr    $0xc,%eax
+  803d96:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d9d:	a8 01                	test   $0x1,%al
+  803d9f:	0f 85 30 ff ff ff    	jne    803cd5 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803da5:	83 ec 04             	sub    $0x4,%esp
+  803da8:	6a 07                	push   $0x7
+  803daa:	ff 75 e4             	push   -0x1c(%ebp)
+  803dad:	6a 00                	push   $0x0
+  803daf:	e8 af d5 ff ff       	call   801363 <sys_page_alloc>
+  803db4:	89 c7                	mov    %eax,%edi
+  803db6:	83 c4 10             	add    $0x10,%esp
+  803db9:	85 c0                	test   %eax,%eax
+  803dbb:	0f 88 01 ff ff ff    	js     803cc2 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803dc1:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803dc6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803dc9:	29 d0                	sub    %edx,%eax
+  803dcb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803dce:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803dd0:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803dd5:	29 d0                	sub    %edx,%eax
+  803dd7:	89 c7                	mov    %eax,%edi
+  803dd9:	39 fe                	cmp    %edi,%esi
+  803ddb:	0f 83 f4 fe ff ff    	jae    803cd5 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803de1:	83 ec 04             	sub    $0x4,%esp
+  803de4:	6a 07                	push   $0x7
+  803de6:	56                   	push   %esi
+  803de7:	6a 00                	push   $0x0
+  803de9:	e8 75 d5 ff ff       	call   801363 <sys_page_alloc>
+  803dee:	83 c4 10             	add    $0x10,%esp
+  803df1:	85 c0                	test   %eax,%eax
+  803df3:	0f 88 94 fe ff ff    	js     803c8d <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803df9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803dff:	eb d8                	jmp    803dd9 <pthread_create+0x1c0>
+
+00803e01 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803e01:	55                   	push   %ebp
+  803e02:	89 e5                	mov    %esp,%ebp
+  803e04:	57                   	push   %edi
+  803e05:	56                   	push   %esi
+  803e06:	53                   	push   %ebx
+  803e07:	83 ec 0c             	sub    $0xc,%esp
+  803e0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803e0d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803e10:	83 f8 1e             	cmp    $0x1e,%eax
+  803e13:	0f 87 c7 00 00 00    	ja     803ee0 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803e19:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e1b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e21:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e26:	77 12                	ja     803e3a <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e28:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e2d:	29 d0                	sub    %edx,%eax
+  803e2f:	c1 e8 10             	shr    $0x10,%eax
+  803e32:	39 c3                	cmp    %eax,%ebx
+  803e34:	0f 84 ad 00 00 00    	je     803ee7 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e3a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e3d:	8d 3c 85 64 70 80 00 	lea    0x807064(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803e44:	8d 34 85 60 70 80 00 	lea    0x807060(,%eax,4),%esi
+  803e4b:	eb 10                	jmp    803e5d <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e4d:	83 ec 04             	sub    $0x4,%esp
+  803e50:	6a 00                	push   $0x0
+  803e52:	6a 01                	push   $0x1
+  803e54:	57                   	push   %edi
+  803e55:	e8 1e d8 ff ff       	call   801678 <sys_futex_wait>
+  803e5a:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803e5d:	8b 46 04             	mov    0x4(%esi),%eax
+  803e60:	83 f8 01             	cmp    $0x1,%eax
+  803e63:	74 e8                	je     803e4d <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803e65:	83 f8 02             	cmp    $0x2,%eax
+  803e68:	0f 85 80 00 00 00    	jne    803eee <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803e6e:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803e71:	c1 e6 02             	shl    $0x2,%esi
+  803e74:	eb 05                	jmp    803e7b <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803e76:	e8 bc d4 ff ff       	call   801337 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803e7b:	8b 8e 60 70 80 00    	mov    0x807060(%esi),%ecx
+  803e81:	89 ca                	mov    %ecx,%edx
+  803e83:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803e89:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e8c:	c1 e0 04             	shl    $0x4,%eax
+  803e8f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e94:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803e97:	39 c1                	cmp    %eax,%ecx
+  803e99:	75 12                	jne    803ead <pthread_join+0xac>
+  803e9b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e9e:	c1 e0 04             	shl    $0x4,%eax
+  803ea1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ea6:	8b 40 54             	mov    0x54(%eax),%eax
+  803ea9:	85 c0                	test   %eax,%eax
+  803eab:	75 c9                	jne    803e76 <pthread_join+0x75>
+	if (ret_store)
+  803ead:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803eb1:	74 0f                	je     803ec2 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803eb3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803eb6:	8b 04 85 70 70 80 00 	mov    0x807070(,%eax,4),%eax
+  803ebd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803ec0:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803ec2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ec5:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  803ecc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803edb:	5b                   	pop    %ebx
+  803edc:	5e                   	pop    %esi
+  803edd:	5f                   	pop    %edi
+  803ede:	5d                   	pop    %ebp
+  803edf:	c3                   	ret
+		return -E_INVAL;
+  803ee0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ee5:	eb f1                	jmp    803ed8 <pthread_join+0xd7>
+  803ee7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803eec:	eb ea                	jmp    803ed8 <pthread_join+0xd7>
+		return -E_INVAL;
+  803eee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ef3:	eb e3                	jmp    803ed8 <pthread_join+0xd7>
+
+00803ef5 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803ef5:	55                   	push   %ebp
+  803ef6:	89 e5                	mov    %esp,%ebp
+  803ef8:	53                   	push   %ebx
+  803ef9:	83 ec 04             	sub    $0x4,%esp
+  803efc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803efe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f04:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f09:	77 0c                	ja     803f17 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f0b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f10:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803f12:	c1 e8 10             	shr    $0x10,%eax
+  803f15:	75 0a                	jne    803f21 <pthread_exit+0x2c>
+		exit();
+  803f17:	e8 22 c9 ff ff       	call   80083e <exit>
+  803f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803f21:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803f28:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803f2b:	8d 0c 8d 60 70 80 00 	lea    0x807060(,%ecx,4),%ecx
+  803f32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f35:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803f38:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803f3f:	83 ec 08             	sub    $0x8,%esp
+  803f42:	6a 20                	push   $0x20
+  803f44:	01 c2                	add    %eax,%edx
+  803f46:	8d 04 95 64 70 80 00 	lea    0x807064(,%edx,4),%eax
+  803f4d:	50                   	push   %eax
+  803f4e:	e8 54 d7 ff ff       	call   8016a7 <sys_futex_wake>
+	sys_env_destroy(0);
+  803f53:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803f5a:	e8 61 d3 ff ff       	call   8012c0 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803f5f:	83 c4 0c             	add    $0xc,%esp
+  803f62:	68 a6 55 80 00       	push   $0x8055a6
+  803f67:	68 a5 00 00 00       	push   $0xa5
+  803f6c:	68 c0 55 80 00       	push   $0x8055c0
+  803f71:	e8 f0 c8 ff ff       	call   800866 <_panic>
+
+00803f76 <pthread_start>:
+{
+  803f76:	55                   	push   %ebp
+  803f77:	89 e5                	mov    %esp,%ebp
+  803f79:	53                   	push   %ebx
+  803f7a:	83 ec 04             	sub    $0x4,%esp
+  803f7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803f80:	e8 86 d3 ff ff       	call   80130b <sys_getenvid>
+  803f85:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803f8a:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	if (t == 0)
+  803f90:	85 db                	test   %ebx,%ebx
+  803f92:	74 0c                	je     803fa0 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f94:	89 d9                	mov    %ebx,%ecx
+  803f96:	c1 e1 10             	shl    $0x10,%ecx
+  803f99:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f9e:	29 ca                	sub    %ecx,%edx
+  803fa0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803fa3:	c1 e0 04             	shl    $0x4,%eax
+  803fa6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fab:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803fad:	83 ec 0c             	sub    $0xc,%esp
+  803fb0:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803fb7:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803fba:	ff 34 95 6c 70 80 00 	push   0x80706c(,%edx,4)
+  803fc1:	ff 14 95 68 70 80 00 	call   *0x807068(,%edx,4)
+  803fc8:	89 04 24             	mov    %eax,(%esp)
+  803fcb:	e8 25 ff ff ff       	call   803ef5 <pthread_exit>
+
+00803fd0 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803fd0:	55                   	push   %ebp
+  803fd1:	89 e5                	mov    %esp,%ebp
+  803fd3:	57                   	push   %edi
+  803fd4:	56                   	push   %esi
+  803fd5:	53                   	push   %ebx
+  803fd6:	83 ec 1c             	sub    $0x1c,%esp
+  803fd9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fdb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803fe1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fed:	77 0d                	ja     803ffc <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fef:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ff4:	29 d0                	sub    %edx,%eax
+  803ff6:	c1 e8 10             	shr    $0x10,%eax
+  803ff9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803ffc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804001:	eb 2f                	jmp    804032 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804003:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804009:	8b 01                	mov    (%ecx),%eax
+  80400b:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80400e:	39 c2                	cmp    %eax,%edx
+  804010:	75 14                	jne    804026 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804012:	83 ec 0c             	sub    $0xc,%esp
+  804015:	57                   	push   %edi
+  804016:	e8 a5 d2 ff ff       	call   8012c0 <sys_env_destroy>
+  80401b:	83 c4 10             	add    $0x10,%esp
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	0f 88 97 00 00 00    	js     8040bd <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804026:	83 c3 01             	add    $0x1,%ebx
+  804029:	83 fb 20             	cmp    $0x20,%ebx
+  80402c:	0f 84 d2 00 00 00    	je     804104 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804032:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804035:	74 ef                	je     804026 <pthread_kill_others+0x56>
+  804037:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80403a:	8d 04 85 60 70 80 00 	lea    0x807060(,%eax,4),%eax
+  804041:	8b 40 04             	mov    0x4(%eax),%eax
+  804044:	83 f8 01             	cmp    $0x1,%eax
+  804047:	75 dd                	jne    804026 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804049:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80404c:	8b 3c 85 60 70 80 00 	mov    0x807060(,%eax,4),%edi
+  804053:	89 fe                	mov    %edi,%esi
+  804055:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80405b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80405e:	c1 e0 04             	shl    $0x4,%eax
+  804061:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804066:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804069:	39 c7                	cmp    %eax,%edi
+  80406b:	75 b9                	jne    804026 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80406d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804070:	c1 e0 04             	shl    $0x4,%eax
+  804073:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804078:	8b 40 54             	mov    0x54(%eax),%eax
+  80407b:	85 c0                	test   %eax,%eax
+  80407d:	74 a7                	je     804026 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80407f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804082:	c1 e0 04             	shl    $0x4,%eax
+  804085:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80408b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80408d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804093:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804098:	0f 87 65 ff ff ff    	ja     804003 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80409e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040a3:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040a5:	c1 e8 10             	shr    $0x10,%eax
+  8040a8:	0f 84 55 ff ff ff    	je     804003 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040ae:	c1 e0 10             	shl    $0x10,%eax
+  8040b1:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040b6:	29 c1                	sub    %eax,%ecx
+  8040b8:	e9 4c ff ff ff       	jmp    804009 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8040bd:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8040c0:	c1 e2 04             	shl    $0x4,%edx
+  8040c3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8040c9:	8b 52 48             	mov    0x48(%edx),%edx
+  8040cc:	39 fa                	cmp    %edi,%edx
+  8040ce:	0f 85 52 ff ff ff    	jne    804026 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8040d4:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8040d7:	c1 e2 04             	shl    $0x4,%edx
+  8040da:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8040e0:	8b 52 54             	mov    0x54(%edx),%edx
+  8040e3:	85 d2                	test   %edx,%edx
+  8040e5:	0f 84 3b ff ff ff    	je     804026 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8040eb:	83 ec 0c             	sub    $0xc,%esp
+  8040ee:	50                   	push   %eax
+  8040ef:	57                   	push   %edi
+  8040f0:	68 d0 55 80 00       	push   $0x8055d0
+  8040f5:	68 bb 00 00 00       	push   $0xbb
+  8040fa:	68 c0 55 80 00       	push   $0x8055c0
+  8040ff:	e8 62 c7 ff ff       	call   800866 <_panic>
+	}
+}
+  804104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804107:	5b                   	pop    %ebx
+  804108:	5e                   	pop    %esi
+  804109:	5f                   	pop    %edi
+  80410a:	5d                   	pop    %ebp
+  80410b:	c3                   	ret
+
+0080410c <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80410c:	55                   	push   %ebp
+  80410d:	89 e5                	mov    %esp,%ebp
+  80410f:	53                   	push   %ebx
+  804110:	83 ec 04             	sub    $0x4,%esp
+  804113:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804115:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80411b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804121:	0f 87 85 00 00 00    	ja     8041ac <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804127:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80412c:	29 c3                	sub    %eax,%ebx
+  80412e:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804131:	83 ec 04             	sub    $0x4,%esp
+  804134:	68 80 02 00 00       	push   $0x280
+  804139:	6a 00                	push   $0x0
+  80413b:	68 60 70 80 00       	push   $0x807060
+  804140:	e8 31 cf ff ff       	call   801076 <memset>
+	threads_mu.m_state = 0;
+  804145:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  80414c:	00 00 00 
+	if (self != 0) {
+  80414f:	83 c4 10             	add    $0x10,%esp
+  804152:	85 db                	test   %ebx,%ebx
+  804154:	74 51                	je     8041a7 <pthread_fork_child+0x9b>
+  804156:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804158:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80415e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804163:	77 18                	ja     80417d <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804165:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80416a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80416c:	c1 e8 10             	shr    $0x10,%eax
+  80416f:	74 0c                	je     80417d <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804171:	c1 e0 10             	shl    $0x10,%eax
+  804174:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804179:	29 c2                	sub    %eax,%edx
+  80417b:	eb 06                	jmp    804183 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80417d:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804183:	8b 02                	mov    (%edx),%eax
+  804185:	8b 48 48             	mov    0x48(%eax),%ecx
+  804188:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80418f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804192:	89 0c 95 60 70 80 00 	mov    %ecx,0x807060(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804199:	8d 04 95 60 70 80 00 	lea    0x807060(,%edx,4),%eax
+  8041a0:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8041a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041aa:	c9                   	leave
+  8041ab:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8041ac:	83 ec 04             	sub    $0x4,%esp
+  8041af:	68 80 02 00 00       	push   $0x280
+  8041b4:	6a 00                	push   $0x0
+  8041b6:	68 60 70 80 00       	push   $0x807060
+  8041bb:	e8 b6 ce ff ff       	call   801076 <memset>
+	threads_mu.m_state = 0;
+  8041c0:	c7 05 40 70 80 00 00 	movl   $0x0,0x807040
+  8041c7:	00 00 00 
+  8041ca:	83 c4 10             	add    $0x10,%esp
+  8041cd:	eb d8                	jmp    8041a7 <pthread_fork_child+0x9b>
+
+008041cf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8041cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d4:	c3                   	ret
+
+008041d5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8041d5:	55                   	push   %ebp
+  8041d6:	89 e5                	mov    %esp,%ebp
+  8041d8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8041db:	68 f5 55 80 00       	push   $0x8055f5
+  8041e0:	ff 75 0c             	push   0xc(%ebp)
+  8041e3:	e8 3d cd ff ff       	call   800f25 <strcpy>
+	return 0;
+}
+  8041e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ed:	c9                   	leave
+  8041ee:	c3                   	ret
+
+008041ef <devcons_write>:
+{
+  8041ef:	55                   	push   %ebp
+  8041f0:	89 e5                	mov    %esp,%ebp
+  8041f2:	57                   	push   %edi
+  8041f3:	56                   	push   %esi
+  8041f4:	53                   	push   %ebx
+  8041f5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8041fb:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804200:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804206:	eb 2e                	jmp    804236 <devcons_write+0x47>
+		m = n - tot;
+  804208:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80420b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80420d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804212:	39 c3                	cmp    %eax,%ebx
+  804214:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804217:	83 ec 04             	sub    $0x4,%esp
+  80421a:	53                   	push   %ebx
+  80421b:	89 f0                	mov    %esi,%eax
+  80421d:	03 45 0c             	add    0xc(%ebp),%eax
+  804220:	50                   	push   %eax
+  804221:	57                   	push   %edi
+  804222:	e8 84 ce ff ff       	call   8010ab <memmove>
+		sys_cputs(buf, m);
+  804227:	83 c4 08             	add    $0x8,%esp
+  80422a:	53                   	push   %ebx
+  80422b:	57                   	push   %edi
+  80422c:	e8 38 d0 ff ff       	call   801269 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804231:	01 de                	add    %ebx,%esi
+  804233:	83 c4 10             	add    $0x10,%esp
+  804236:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804239:	72 cd                	jb     804208 <devcons_write+0x19>
+}
+  80423b:	89 f0                	mov    %esi,%eax
+  80423d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804240:	5b                   	pop    %ebx
+  804241:	5e                   	pop    %esi
+  804242:	5f                   	pop    %edi
+  804243:	5d                   	pop    %ebp
+  804244:	c3                   	ret
+
+00804245 <devcons_read>:
+{
+  804245:	55                   	push   %ebp
+  804246:	89 e5                	mov    %esp,%ebp
+  804248:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80424b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804250:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804254:	75 07                	jne    80425d <devcons_read+0x18>
+  804256:	eb 1f                	jmp    804277 <devcons_read+0x32>
+		sys_yield();
+  804258:	e8 da d0 ff ff       	call   801337 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80425d:	e8 32 d0 ff ff       	call   801294 <sys_cgetc>
+  804262:	85 c0                	test   %eax,%eax
+  804264:	74 f2                	je     804258 <devcons_read+0x13>
+	if (c < 0)
+  804266:	78 0f                	js     804277 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804268:	83 f8 04             	cmp    $0x4,%eax
+  80426b:	74 0c                	je     804279 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80426d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804270:	88 02                	mov    %al,(%edx)
+	return 1;
+  804272:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804277:	c9                   	leave
+  804278:	c3                   	ret
+		return 0;
+  804279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427e:	eb f7                	jmp    804277 <devcons_read+0x32>
+
+00804280 <cputchar>:
+{
+  804280:	55                   	push   %ebp
+  804281:	89 e5                	mov    %esp,%ebp
+  804283:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804286:	8b 45 08             	mov    0x8(%ebp),%eax
+  804289:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80428c:	6a 01                	push   $0x1
+  80428e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804291:	50                   	push   %eax
+  804292:	e8 d2 cf ff ff       	call   801269 <sys_cputs>
+}
+  804297:	83 c4 10             	add    $0x10,%esp
+  80429a:	c9                   	leave
+  80429b:	c3                   	ret
+
+0080429c <getchar>:
+{
+  80429c:	55                   	push   %ebp
+  80429d:	89 e5                	mov    %esp,%ebp
+  80429f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8042a2:	6a 01                	push   $0x1
+  8042a4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042a7:	50                   	push   %eax
+  8042a8:	6a 00                	push   $0x0
+  8042aa:	e8 63 d8 ff ff       	call   801b12 <read>
+	if (r < 0)
+  8042af:	83 c4 10             	add    $0x10,%esp
+  8042b2:	85 c0                	test   %eax,%eax
+  8042b4:	78 06                	js     8042bc <getchar+0x20>
+	if (r < 1)
+  8042b6:	74 06                	je     8042be <getchar+0x22>
+	return c;
+  8042b8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8042bc:	c9                   	leave
+  8042bd:	c3                   	ret
+		return -E_EOF;
+  8042be:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8042c3:	eb f7                	jmp    8042bc <getchar+0x20>
+
+008042c5 <iscons>:
+{
+  8042c5:	55                   	push   %ebp
+  8042c6:	89 e5                	mov    %esp,%ebp
+  8042c8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8042cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042ce:	50                   	push   %eax
+  8042cf:	ff 75 08             	push   0x8(%ebp)
+  8042d2:	e8 ab d5 ff ff       	call   801882 <fd_lookup>
+  8042d7:	83 c4 10             	add    $0x10,%esp
+  8042da:	85 c0                	test   %eax,%eax
+  8042dc:	78 11                	js     8042ef <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8042de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042e1:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  8042e7:	39 10                	cmp    %edx,(%eax)
+  8042e9:	0f 94 c0             	sete   %al
+  8042ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8042ef:	c9                   	leave
+  8042f0:	c3                   	ret
+
+008042f1 <opencons>:
+{
+  8042f1:	55                   	push   %ebp
+  8042f2:	89 e5                	mov    %esp,%ebp
+  8042f4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8042f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042fa:	50                   	push   %eax
+  8042fb:	e8 2c d5 ff ff       	call   80182c <fd_alloc>
+  804300:	83 c4 10             	add    $0x10,%esp
+  804303:	85 c0                	test   %eax,%eax
+  804305:	78 3a                	js     804341 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804307:	83 ec 04             	sub    $0x4,%esp
+  80430a:	68 07 04 00 00       	push   $0x407
+  80430f:	ff 75 f4             	push   -0xc(%ebp)
+  804312:	6a 00                	push   $0x0
+  804314:	e8 4a d0 ff ff       	call   801363 <sys_page_alloc>
+  804319:	83 c4 10             	add    $0x10,%esp
+  80431c:	85 c0                	test   %eax,%eax
+  80431e:	78 21                	js     804341 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804323:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  804329:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80432b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80432e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804335:	83 ec 0c             	sub    $0xc,%esp
+  804338:	50                   	push   %eax
+  804339:	e8 c7 d4 ff ff       	call   801805 <fd2num>
+  80433e:	83 c4 10             	add    $0x10,%esp
+}
+  804341:	c9                   	leave
+  804342:	c3                   	ret
+
+00804343 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  804343:	55                   	push   %ebp
+  804344:	89 e5                	mov    %esp,%ebp
+  804346:	57                   	push   %edi
+  804347:	56                   	push   %esi
+  804348:	53                   	push   %ebx
+  804349:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80434c:	89 d6                	mov    %edx,%esi
+  80434e:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804351:	89 cf                	mov    %ecx,%edi
+  804353:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  804356:	89 fa                	mov    %edi,%edx
+  804358:	80 ce 08             	or     $0x8,%dh
+  80435b:	f6 c5 08             	test   $0x8,%ch
+  80435e:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  804361:	57                   	push   %edi
+  804362:	56                   	push   %esi
+  804363:	50                   	push   %eax
+  804364:	56                   	push   %esi
+  804365:	6a 00                	push   $0x0
+  804367:	e8 44 d0 ff ff       	call   8013b0 <sys_page_map>
+	if (r < 0) {
+  80436c:	83 c4 20             	add    $0x20,%esp
+  80436f:	85 c0                	test   %eax,%eax
+  804371:	78 27                	js     80439a <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  804373:	83 ec 0c             	sub    $0xc,%esp
+  804376:	57                   	push   %edi
+  804377:	56                   	push   %esi
+  804378:	6a 00                	push   $0x0
+  80437a:	56                   	push   %esi
+  80437b:	6a 00                	push   $0x0
+  80437d:	e8 2e d0 ff ff       	call   8013b0 <sys_page_map>
+  804382:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804384:	83 c4 20             	add    $0x20,%esp
+  804387:	85 c0                	test   %eax,%eax
+  804389:	78 24                	js     8043af <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80438b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804390:	89 d8                	mov    %ebx,%eax
+  804392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804395:	5b                   	pop    %ebx
+  804396:	5e                   	pop    %esi
+  804397:	5f                   	pop    %edi
+  804398:	5d                   	pop    %ebp
+  804399:	c3                   	ret
+  80439a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80439c:	83 ec 08             	sub    $0x8,%esp
+  80439f:	50                   	push   %eax
+  8043a0:	68 04 56 80 00       	push   $0x805604
+  8043a5:	e8 97 c5 ff ff       	call   800941 <cprintf>
+		return r;
+  8043aa:	83 c4 10             	add    $0x10,%esp
+  8043ad:	eb e1                	jmp    804390 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8043af:	83 ec 08             	sub    $0x8,%esp
+  8043b2:	50                   	push   %eax
+  8043b3:	68 34 56 80 00       	push   $0x805634
+  8043b8:	e8 84 c5 ff ff       	call   800941 <cprintf>
+		return r;
+  8043bd:	83 c4 10             	add    $0x10,%esp
+  8043c0:	eb ce                	jmp    804390 <duppage_cow+0x4d>
+
+008043c2 <duppage>:
+{
+  8043c2:	55                   	push   %ebp
+  8043c3:	89 e5                	mov    %esp,%ebp
+  8043c5:	53                   	push   %ebx
+  8043c6:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8043c9:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8043cc:	51                   	push   %ecx
+  8043cd:	52                   	push   %edx
+  8043ce:	50                   	push   %eax
+  8043cf:	52                   	push   %edx
+  8043d0:	6a 00                	push   $0x0
+  8043d2:	e8 d9 cf ff ff       	call   8013b0 <sys_page_map>
+	if (r < 0) {
+  8043d7:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8043da:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8043df:	85 c0                	test   %eax,%eax
+  8043e1:	78 07                	js     8043ea <duppage+0x28>
+}
+  8043e3:	89 d8                	mov    %ebx,%eax
+  8043e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043e8:	c9                   	leave
+  8043e9:	c3                   	ret
+  8043ea:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8043ec:	83 ec 08             	sub    $0x8,%esp
+  8043ef:	50                   	push   %eax
+  8043f0:	68 04 56 80 00       	push   $0x805604
+  8043f5:	e8 47 c5 ff ff       	call   800941 <cprintf>
+		return r;
+  8043fa:	83 c4 10             	add    $0x10,%esp
+  8043fd:	eb e4                	jmp    8043e3 <duppage+0x21>
+
+008043ff <cow_copy>:
+{
+  8043ff:	55                   	push   %ebp
+  804400:	89 e5                	mov    %esp,%ebp
+  804402:	56                   	push   %esi
+  804403:	53                   	push   %ebx
+  804404:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804406:	83 ec 04             	sub    $0x4,%esp
+  804409:	6a 07                	push   $0x7
+  80440b:	68 00 f0 7f 00       	push   $0x7ff000
+  804410:	6a 00                	push   $0x0
+  804412:	e8 4c cf ff ff       	call   801363 <sys_page_alloc>
+	if (r < 0) {
+  804417:	83 c4 10             	add    $0x10,%esp
+  80441a:	85 c0                	test   %eax,%eax
+  80441c:	78 58                	js     804476 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80441e:	83 ec 04             	sub    $0x4,%esp
+  804421:	68 00 10 00 00       	push   $0x1000
+  804426:	56                   	push   %esi
+  804427:	68 00 f0 7f 00       	push   $0x7ff000
+  80442c:	e8 7a cc ff ff       	call   8010ab <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  804431:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804438:	56                   	push   %esi
+  804439:	6a 00                	push   $0x0
+  80443b:	68 00 f0 7f 00       	push   $0x7ff000
+  804440:	6a 00                	push   $0x0
+  804442:	e8 69 cf ff ff       	call   8013b0 <sys_page_map>
+  804447:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804449:	83 c4 20             	add    $0x20,%esp
+  80444c:	85 c0                	test   %eax,%eax
+  80444e:	78 3b                	js     80448b <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804450:	83 ec 08             	sub    $0x8,%esp
+  804453:	68 00 f0 7f 00       	push   $0x7ff000
+  804458:	6a 00                	push   $0x0
+  80445a:	e8 9d cf ff ff       	call   8013fc <sys_page_unmap>
+  80445f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804461:	83 c4 10             	add    $0x10,%esp
+  804464:	85 c0                	test   %eax,%eax
+  804466:	78 45                	js     8044ad <cow_copy+0xae>
+	return 0;
+  804468:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80446d:	89 d8                	mov    %ebx,%eax
+  80446f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804472:	5b                   	pop    %ebx
+  804473:	5e                   	pop    %esi
+  804474:	5d                   	pop    %ebp
+  804475:	c3                   	ret
+  804476:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  804478:	83 ec 08             	sub    $0x8,%esp
+  80447b:	50                   	push   %eax
+  80447c:	68 24 57 80 00       	push   $0x805724
+  804481:	e8 bb c4 ff ff       	call   800941 <cprintf>
+		return r;
+  804486:	83 c4 10             	add    $0x10,%esp
+  804489:	eb e2                	jmp    80446d <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80448b:	83 ec 08             	sub    $0x8,%esp
+  80448e:	50                   	push   %eax
+  80448f:	68 40 57 80 00       	push   $0x805740
+  804494:	e8 a8 c4 ff ff       	call   800941 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  804499:	83 c4 08             	add    $0x8,%esp
+  80449c:	68 00 f0 7f 00       	push   $0x7ff000
+  8044a1:	6a 00                	push   $0x0
+  8044a3:	e8 54 cf ff ff       	call   8013fc <sys_page_unmap>
+		return r;
+  8044a8:	83 c4 10             	add    $0x10,%esp
+  8044ab:	eb c0                	jmp    80446d <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8044ad:	83 ec 08             	sub    $0x8,%esp
+  8044b0:	50                   	push   %eax
+  8044b1:	68 5c 56 80 00       	push   $0x80565c
+  8044b6:	e8 86 c4 ff ff       	call   800941 <cprintf>
+		return r;
+  8044bb:	83 c4 10             	add    $0x10,%esp
+  8044be:	eb ad                	jmp    80446d <cow_copy+0x6e>
+
+008044c0 <pgfault>:
+{
+  8044c0:	55                   	push   %ebp
+  8044c1:	89 e5                	mov    %esp,%ebp
+  8044c3:	56                   	push   %esi
+  8044c4:	53                   	push   %ebx
+  8044c5:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8044c8:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8044ca:	89 d8                	mov    %ebx,%eax
+  8044cc:	c1 e8 16             	shr    $0x16,%eax
+  8044cf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8044d6:	89 de                	mov    %ebx,%esi
+  8044d8:	c1 ee 0c             	shr    $0xc,%esi
+  8044db:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8044e2:	a8 07                	test   $0x7,%al
+  8044e4:	74 3b                	je     804521 <pgfault+0x61>
+  8044e6:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8044ec:	74 33                	je     804521 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8044ee:	83 ec 0c             	sub    $0xc,%esp
+  8044f1:	68 00 f0 bf ee       	push   $0xeebff000
+  8044f6:	e8 c8 f4 ff ff       	call   8039c3 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8044fb:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804502:	83 c4 10             	add    $0x10,%esp
+  804505:	f6 c4 08             	test   $0x8,%ah
+  804508:	75 30                	jne    80453a <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80450a:	83 ec 0c             	sub    $0xc,%esp
+  80450d:	68 00 f0 bf ee       	push   $0xeebff000
+  804512:	e8 19 f5 ff ff       	call   803a30 <mutex_unlock>
+}
+  804517:	83 c4 10             	add    $0x10,%esp
+  80451a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80451d:	5b                   	pop    %ebx
+  80451e:	5e                   	pop    %esi
+  80451f:	5d                   	pop    %ebp
+  804520:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804521:	83 ec 08             	sub    $0x8,%esp
+  804524:	ff 72 28             	push   0x28(%edx)
+  804527:	51                   	push   %ecx
+  804528:	50                   	push   %eax
+  804529:	68 80 56 80 00       	push   $0x805680
+  80452e:	6a 3f                	push   $0x3f
+  804530:	68 5a 57 80 00       	push   $0x80575a
+  804535:	e8 2c c3 ff ff       	call   800866 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80453a:	89 d8                	mov    %ebx,%eax
+  80453c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804541:	e8 b9 fe ff ff       	call   8043ff <cow_copy>
+  804546:	eb c2                	jmp    80450a <pgfault+0x4a>
+
+00804548 <cow_enable>:
+{
+  804548:	55                   	push   %ebp
+  804549:	89 e5                	mov    %esp,%ebp
+  80454b:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80454e:	68 c0 44 80 00       	push   $0x8044c0
+  804553:	e8 28 06 00 00       	call   804b80 <set_pgfault_handler>
+}
+  804558:	83 c4 10             	add    $0x10,%esp
+  80455b:	c9                   	leave
+  80455c:	c3                   	ret
+
+0080455d <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80455d:	55                   	push   %ebp
+  80455e:	89 e5                	mov    %esp,%ebp
+  804560:	57                   	push   %edi
+  804561:	56                   	push   %esi
+  804562:	53                   	push   %ebx
+  804563:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804566:	68 c0 44 80 00       	push   $0x8044c0
+  80456b:	e8 10 06 00 00       	call   804b80 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804570:	b8 07 00 00 00       	mov    $0x7,%eax
+  804575:	cd 30                	int    $0x30
+  804577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80457a:	83 c4 10             	add    $0x10,%esp
+  80457d:	85 c0                	test   %eax,%eax
+  80457f:	78 4b                	js     8045cc <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804581:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804586:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80458b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80458e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804592:	0f 85 16 01 00 00    	jne    8046ae <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804598:	e8 6e cd ff ff       	call   80130b <sys_getenvid>
+  80459d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045a2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045a4:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8045aa:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8045b0:	77 32                	ja     8045e4 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045b2:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8045b7:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8045b9:	c1 ea 10             	shr    $0x10,%edx
+  8045bc:	74 26                	je     8045e4 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8045be:	c1 e2 10             	shl    $0x10,%edx
+  8045c1:	89 d1                	mov    %edx,%ecx
+  8045c3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8045c8:	29 ca                	sub    %ecx,%edx
+  8045ca:	eb 1e                	jmp    8045ea <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8045cc:	83 ec 08             	sub    $0x8,%esp
+  8045cf:	89 c7                	mov    %eax,%edi
+  8045d1:	50                   	push   %eax
+  8045d2:	68 65 57 80 00       	push   $0x805765
+  8045d7:	e8 65 c3 ff ff       	call   800941 <cprintf>
+		return eid;
+  8045dc:	83 c4 10             	add    $0x10,%esp
+  8045df:	e9 6c 01 00 00       	jmp    804750 <fork+0x1f3>
+		return pthread_main_tls;
+  8045e4:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8045ea:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8045ed:	c1 e0 04             	shl    $0x4,%eax
+  8045f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045f5:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8045f7:	e8 10 fb ff ff       	call   80410c <pthread_fork_child>
+		return eid;
+  8045fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8045ff:	e9 4c 01 00 00       	jmp    804750 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804604:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80460a:	89 da                	mov    %ebx,%edx
+  80460c:	89 f8                	mov    %edi,%eax
+  80460e:	e8 af fd ff ff       	call   8043c2 <duppage>
+  804613:	85 c0                	test   %eax,%eax
+  804615:	79 28                	jns    80463f <fork+0xe2>
+  804617:	89 c7                	mov    %eax,%edi
+  804619:	e9 32 01 00 00       	jmp    804750 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80461e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804624:	83 f9 05             	cmp    $0x5,%ecx
+  804627:	75 58                	jne    804681 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804629:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80462e:	89 da                	mov    %ebx,%edx
+  804630:	89 f8                	mov    %edi,%eax
+  804632:	e8 8b fd ff ff       	call   8043c2 <duppage>
+  804637:	85 c0                	test   %eax,%eax
+  804639:	0f 88 0f 01 00 00    	js     80474e <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80463f:	83 c3 01             	add    $0x1,%ebx
+  804642:	39 de                	cmp    %ebx,%esi
+  804644:	74 54                	je     80469a <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804646:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80464d:	f6 c1 05             	test   $0x5,%cl
+  804650:	74 ed                	je     80463f <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804652:	f6 c5 04             	test   $0x4,%ch
+  804655:	75 ad                	jne    804604 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804657:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80465d:	74 bf                	je     80461e <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80465f:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804665:	74 d8                	je     80463f <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804667:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80466d:	89 da                	mov    %ebx,%edx
+  80466f:	89 f8                	mov    %edi,%eax
+  804671:	e8 cd fc ff ff       	call   804343 <duppage_cow>
+  804676:	85 c0                	test   %eax,%eax
+  804678:	79 c5                	jns    80463f <fork+0xe2>
+  80467a:	89 c7                	mov    %eax,%edi
+  80467c:	e9 cf 00 00 00       	jmp    804750 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804681:	68 b0 56 80 00       	push   $0x8056b0
+  804686:	68 bd 54 80 00       	push   $0x8054bd
+  80468b:	68 c6 00 00 00       	push   $0xc6
+  804690:	68 5a 57 80 00       	push   $0x80575a
+  804695:	e8 cc c1 ff ff       	call   800866 <_panic>
+  80469a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80469d:	83 c1 01             	add    $0x1,%ecx
+  8046a0:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8046a6:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8046ac:	74 18                	je     8046c6 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8046ae:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8046b5:	a8 07                	test   $0x7,%al
+  8046b7:	74 e4                	je     80469d <fork+0x140>
+  8046b9:	89 cb                	mov    %ecx,%ebx
+  8046bb:	c1 e3 0a             	shl    $0xa,%ebx
+  8046be:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8046c1:	e9 7c ff ff ff       	jmp    804642 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8046c6:	83 ec 04             	sub    $0x4,%esp
+  8046c9:	6a 07                	push   $0x7
+  8046cb:	68 00 f0 bf ee       	push   $0xeebff000
+  8046d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8046d3:	e8 8b cc ff ff       	call   801363 <sys_page_alloc>
+  8046d8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8046da:	83 c4 10             	add    $0x10,%esp
+  8046dd:	85 c0                	test   %eax,%eax
+  8046df:	78 34                	js     804715 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8046e1:	83 ec 08             	sub    $0x8,%esp
+  8046e4:	68 be 4b 80 00       	push   $0x804bbe
+  8046e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8046ec:	e8 ef cd ff ff       	call   8014e0 <sys_env_set_pgfault_upcall>
+  8046f1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8046f3:	83 c4 10             	add    $0x10,%esp
+  8046f6:	85 c0                	test   %eax,%eax
+  8046f8:	78 2e                	js     804728 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8046fa:	83 ec 08             	sub    $0x8,%esp
+  8046fd:	6a 02                	push   $0x2
+  8046ff:	ff 75 e4             	push   -0x1c(%ebp)
+  804702:	e8 41 cd ff ff       	call   801448 <sys_env_set_status>
+  804707:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804709:	83 c4 10             	add    $0x10,%esp
+  80470c:	85 c0                	test   %eax,%eax
+  80470e:	78 2b                	js     80473b <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804710:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804713:	eb 3b                	jmp    804750 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804715:	83 ec 08             	sub    $0x8,%esp
+  804718:	50                   	push   %eax
+  804719:	68 d8 56 80 00       	push   $0x8056d8
+  80471e:	e8 1e c2 ff ff       	call   800941 <cprintf>
+		return r;
+  804723:	83 c4 10             	add    $0x10,%esp
+  804726:	eb 28                	jmp    804750 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804728:	83 ec 08             	sub    $0x8,%esp
+  80472b:	50                   	push   %eax
+  80472c:	68 00 57 80 00       	push   $0x805700
+  804731:	e8 0b c2 ff ff       	call   800941 <cprintf>
+		return r;
+  804736:	83 c4 10             	add    $0x10,%esp
+  804739:	eb 15                	jmp    804750 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80473b:	83 ec 08             	sub    $0x8,%esp
+  80473e:	50                   	push   %eax
+  80473f:	68 75 57 80 00       	push   $0x805775
+  804744:	e8 f8 c1 ff ff       	call   800941 <cprintf>
+		return r;
+  804749:	83 c4 10             	add    $0x10,%esp
+  80474c:	eb 02                	jmp    804750 <fork+0x1f3>
+  80474e:	89 c7                	mov    %eax,%edi
+}
+  804750:	89 f8                	mov    %edi,%eax
+  804752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804755:	5b                   	pop    %ebx
+  804756:	5e                   	pop    %esi
+  804757:	5f                   	pop    %edi
+  804758:	5d                   	pop    %ebp
+  804759:	c3                   	ret
+
+0080475a <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80475a:	55                   	push   %ebp
+  80475b:	89 e5                	mov    %esp,%ebp
+  80475d:	57                   	push   %edi
+  80475e:	56                   	push   %esi
+  80475f:	53                   	push   %ebx
+  804760:	83 ec 2c             	sub    $0x2c,%esp
+  804763:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804765:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80476b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804770:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804776:	77 0a                	ja     804782 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804778:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80477d:	29 c3                	sub    %eax,%ebx
+  80477f:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804782:	83 ec 0c             	sub    $0xc,%esp
+  804785:	68 c0 44 80 00       	push   $0x8044c0
+  80478a:	e8 f1 03 00 00       	call   804b80 <set_pgfault_handler>
+  80478f:	b8 07 00 00 00       	mov    $0x7,%eax
+  804794:	cd 30                	int    $0x30
+  804796:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804799:	83 c4 10             	add    $0x10,%esp
+  80479c:	85 c0                	test   %eax,%eax
+  80479e:	78 30                	js     8047d0 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8047a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8047a4:	74 42                	je     8047e8 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8047a6:	c1 e3 10             	shl    $0x10,%ebx
+  8047a9:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8047ae:	29 d8                	sub    %ebx,%eax
+  8047b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8047b3:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8047b8:	29 d8                	sub    %ebx,%eax
+  8047ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8047bd:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8047c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047c7:	89 f7                	mov    %esi,%edi
+  8047c9:	89 d6                	mov    %edx,%esi
+  8047cb:	e9 2c 01 00 00       	jmp    8048fc <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8047d0:	83 ec 08             	sub    $0x8,%esp
+  8047d3:	89 c7                	mov    %eax,%edi
+  8047d5:	50                   	push   %eax
+  8047d6:	68 65 57 80 00       	push   $0x805765
+  8047db:	e8 61 c1 ff ff       	call   800941 <cprintf>
+		return eid;
+  8047e0:	83 c4 10             	add    $0x10,%esp
+  8047e3:	e9 d5 00 00 00       	jmp    8048bd <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8047e8:	e8 1e cb ff ff       	call   80130b <sys_getenvid>
+  8047ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8047f2:	89 c2                	mov    %eax,%edx
+  8047f4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047f6:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8047fc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804801:	77 18                	ja     80481b <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804803:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804808:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80480a:	c1 e8 10             	shr    $0x10,%eax
+  80480d:	74 0c                	je     80481b <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80480f:	c1 e0 10             	shl    $0x10,%eax
+  804812:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804817:	29 c1                	sub    %eax,%ecx
+  804819:	eb 06                	jmp    804821 <sfork+0xc7>
+		return pthread_main_tls;
+  80481b:	8b 0d e0 72 80 00    	mov    0x8072e0,%ecx
+  804821:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804824:	c1 e0 04             	shl    $0x4,%eax
+  804827:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80482c:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80482e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804831:	e9 87 00 00 00       	jmp    8048bd <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804836:	f6 c5 04             	test   $0x4,%ch
+  804839:	74 6c                	je     8048a7 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80483b:	89 ca                	mov    %ecx,%edx
+  80483d:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804843:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804849:	74 7c                	je     8048c7 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80484b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804851:	89 da                	mov    %ebx,%edx
+  804853:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804856:	e8 67 fb ff ff       	call   8043c2 <duppage>
+  80485b:	85 c0                	test   %eax,%eax
+  80485d:	0f 88 4f 01 00 00    	js     8049b2 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804863:	83 c3 01             	add    $0x1,%ebx
+  804866:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804869:	74 7a                	je     8048e5 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80486b:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80486d:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804874:	f6 c1 01             	test   $0x1,%cl
+  804877:	74 ea                	je     804863 <sfork+0x109>
+  804879:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80487f:	74 e2                	je     804863 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804881:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804887:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80488a:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80488f:	76 a5                	jbe    804836 <sfork+0xdc>
+  804891:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804897:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80489a:	39 fa                	cmp    %edi,%edx
+  80489c:	73 9d                	jae    80483b <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80489e:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8048a1:	39 fa                	cmp    %edi,%edx
+  8048a3:	72 96                	jb     80483b <sfork+0xe1>
+  8048a5:	eb 8f                	jmp    804836 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8048a7:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8048ad:	89 da                	mov    %ebx,%edx
+  8048af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8048b2:	e8 8c fa ff ff       	call   804343 <duppage_cow>
+  8048b7:	85 c0                	test   %eax,%eax
+  8048b9:	79 a8                	jns    804863 <sfork+0x109>
+  8048bb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8048bd:	89 f8                	mov    %edi,%eax
+  8048bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048c2:	5b                   	pop    %ebx
+  8048c3:	5e                   	pop    %esi
+  8048c4:	5f                   	pop    %edi
+  8048c5:	5d                   	pop    %ebp
+  8048c6:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8048c7:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8048cc:	e8 2e fb ff ff       	call   8043ff <cow_copy>
+  8048d1:	85 c0                	test   %eax,%eax
+  8048d3:	0f 88 d2 00 00 00    	js     8049ab <sfork+0x251>
+				pte = uvpt[pn];
+  8048d9:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8048e0:	e9 66 ff ff ff       	jmp    80484b <sfork+0xf1>
+  8048e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8048e8:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8048eb:	83 c6 01             	add    $0x1,%esi
+  8048ee:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8048f4:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8048fa:	74 1b                	je     804917 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8048fc:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804903:	a8 01                	test   $0x1,%al
+  804905:	74 e4                	je     8048eb <sfork+0x191>
+  804907:	89 f3                	mov    %esi,%ebx
+  804909:	c1 e3 0a             	shl    $0xa,%ebx
+  80490c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80490f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804912:	e9 4f ff ff ff       	jmp    804866 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804917:	83 ec 04             	sub    $0x4,%esp
+  80491a:	6a 07                	push   $0x7
+  80491c:	68 00 f0 bf ee       	push   $0xeebff000
+  804921:	ff 75 e0             	push   -0x20(%ebp)
+  804924:	e8 3a ca ff ff       	call   801363 <sys_page_alloc>
+  804929:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80492b:	83 c4 10             	add    $0x10,%esp
+  80492e:	85 c0                	test   %eax,%eax
+  804930:	78 37                	js     804969 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804932:	83 ec 08             	sub    $0x8,%esp
+  804935:	68 be 4b 80 00       	push   $0x804bbe
+  80493a:	ff 75 e0             	push   -0x20(%ebp)
+  80493d:	e8 9e cb ff ff       	call   8014e0 <sys_env_set_pgfault_upcall>
+  804942:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804944:	83 c4 10             	add    $0x10,%esp
+  804947:	85 c0                	test   %eax,%eax
+  804949:	78 34                	js     80497f <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80494b:	83 ec 08             	sub    $0x8,%esp
+  80494e:	6a 02                	push   $0x2
+  804950:	ff 75 e0             	push   -0x20(%ebp)
+  804953:	e8 f0 ca ff ff       	call   801448 <sys_env_set_status>
+  804958:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80495a:	83 c4 10             	add    $0x10,%esp
+  80495d:	85 c0                	test   %eax,%eax
+  80495f:	78 34                	js     804995 <sfork+0x23b>
+	return eid;
+  804961:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804964:	e9 54 ff ff ff       	jmp    8048bd <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804969:	83 ec 08             	sub    $0x8,%esp
+  80496c:	50                   	push   %eax
+  80496d:	68 d8 56 80 00       	push   $0x8056d8
+  804972:	e8 ca bf ff ff       	call   800941 <cprintf>
+		return r;
+  804977:	83 c4 10             	add    $0x10,%esp
+  80497a:	e9 3e ff ff ff       	jmp    8048bd <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80497f:	83 ec 08             	sub    $0x8,%esp
+  804982:	50                   	push   %eax
+  804983:	68 00 57 80 00       	push   $0x805700
+  804988:	e8 b4 bf ff ff       	call   800941 <cprintf>
+		return r;
+  80498d:	83 c4 10             	add    $0x10,%esp
+  804990:	e9 28 ff ff ff       	jmp    8048bd <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804995:	83 ec 08             	sub    $0x8,%esp
+  804998:	50                   	push   %eax
+  804999:	68 75 57 80 00       	push   $0x805775
+  80499e:	e8 9e bf ff ff       	call   800941 <cprintf>
+		return r;
+  8049a3:	83 c4 10             	add    $0x10,%esp
+  8049a6:	e9 12 ff ff ff       	jmp    8048bd <sfork+0x163>
+  8049ab:	89 c7                	mov    %eax,%edi
+  8049ad:	e9 0b ff ff ff       	jmp    8048bd <sfork+0x163>
+  8049b2:	89 c7                	mov    %eax,%edi
+  8049b4:	e9 04 ff ff ff       	jmp    8048bd <sfork+0x163>
+
+008049b9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049b9:	55                   	push   %ebp
+  8049ba:	89 e5                	mov    %esp,%ebp
+  8049bc:	57                   	push   %edi
+  8049bd:	56                   	push   %esi
+  8049be:	53                   	push   %ebx
+  8049bf:	83 ec 18             	sub    $0x18,%esp
+  8049c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8049c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8049c8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8049cb:	85 c0                	test   %eax,%eax
+  8049cd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049d2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8049d5:	50                   	push   %eax
+  8049d6:	e8 7e cb ff ff       	call   801559 <sys_ipc_recv>
+	if (r < 0) {
+  8049db:	83 c4 10             	add    $0x10,%esp
+  8049de:	85 c0                	test   %eax,%eax
+  8049e0:	78 2b                	js     804a0d <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8049e2:	85 ff                	test   %edi,%edi
+  8049e4:	74 55                	je     804a3b <ipc_recv+0x82>
+  8049e6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8049e8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8049ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8049f3:	77 39                	ja     804a2e <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8049f5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8049fa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8049fc:	c1 e8 10             	shr    $0x10,%eax
+  8049ff:	74 2d                	je     804a2e <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a01:	c1 e0 10             	shl    $0x10,%eax
+  804a04:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a09:	29 c2                	sub    %eax,%edx
+  804a0b:	eb 27                	jmp    804a34 <ipc_recv+0x7b>
+  804a0d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804a0f:	83 ec 08             	sub    $0x8,%esp
+  804a12:	50                   	push   %eax
+  804a13:	68 93 57 80 00       	push   $0x805793
+  804a18:	e8 24 bf ff ff       	call   800941 <cprintf>
+		*from_env_store = 0;
+  804a1d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804a23:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804a29:	83 c4 10             	add    $0x10,%esp
+  804a2c:	eb 77                	jmp    804aa5 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804a2e:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804a34:	8b 02                	mov    (%edx),%eax
+  804a36:	8b 40 78             	mov    0x78(%eax),%eax
+  804a39:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804a3b:	85 f6                	test   %esi,%esi
+  804a3d:	74 34                	je     804a73 <ipc_recv+0xba>
+  804a3f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a41:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a47:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a4c:	77 18                	ja     804a66 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a4e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a53:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a55:	c1 e8 10             	shr    $0x10,%eax
+  804a58:	74 0c                	je     804a66 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a5a:	c1 e0 10             	shl    $0x10,%eax
+  804a5d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a62:	29 c2                	sub    %eax,%edx
+  804a64:	eb 06                	jmp    804a6c <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804a66:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804a6c:	8b 02                	mov    (%edx),%eax
+  804a6e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804a71:	89 06                	mov    %eax,(%esi)
+  804a73:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a75:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a7b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a80:	77 18                	ja     804a9a <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a82:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a87:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a89:	c1 e8 10             	shr    $0x10,%eax
+  804a8c:	74 0c                	je     804a9a <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a8e:	c1 e0 10             	shl    $0x10,%eax
+  804a91:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a96:	29 c2                	sub    %eax,%edx
+  804a98:	eb 06                	jmp    804aa0 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804a9a:	8b 15 e0 72 80 00    	mov    0x8072e0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804aa0:	8b 02                	mov    (%edx),%eax
+  804aa2:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804aa5:	89 d8                	mov    %ebx,%eax
+  804aa7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804aaa:	5b                   	pop    %ebx
+  804aab:	5e                   	pop    %esi
+  804aac:	5f                   	pop    %edi
+  804aad:	5d                   	pop    %ebp
+  804aae:	c3                   	ret
+
+00804aaf <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804aaf:	55                   	push   %ebp
+  804ab0:	89 e5                	mov    %esp,%ebp
+  804ab2:	57                   	push   %edi
+  804ab3:	56                   	push   %esi
+  804ab4:	53                   	push   %ebx
+  804ab5:	83 ec 0c             	sub    $0xc,%esp
+  804ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+  804abb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804abe:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804ac1:	85 db                	test   %ebx,%ebx
+  804ac3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804ac8:	0f 44 d8             	cmove  %eax,%ebx
+  804acb:	eb 05                	jmp    804ad2 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804acd:	e8 65 c8 ff ff       	call   801337 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804ad2:	57                   	push   %edi
+  804ad3:	53                   	push   %ebx
+  804ad4:	ff 75 0c             	push   0xc(%ebp)
+  804ad7:	56                   	push   %esi
+  804ad8:	e8 4f ca ff ff       	call   80152c <sys_ipc_try_send>
+		if (r == 0) {
+  804add:	83 c4 10             	add    $0x10,%esp
+  804ae0:	85 c0                	test   %eax,%eax
+  804ae2:	74 19                	je     804afd <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804ae4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804ae7:	74 e4                	je     804acd <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804ae9:	83 ec 0c             	sub    $0xc,%esp
+  804aec:	50                   	push   %eax
+  804aed:	57                   	push   %edi
+  804aee:	53                   	push   %ebx
+  804aef:	56                   	push   %esi
+  804af0:	68 ac 57 80 00       	push   $0x8057ac
+  804af5:	e8 47 be ff ff       	call   800941 <cprintf>
+			return;
+  804afa:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804afd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b00:	5b                   	pop    %ebx
+  804b01:	5e                   	pop    %esi
+  804b02:	5f                   	pop    %edi
+  804b03:	5d                   	pop    %ebp
+  804b04:	c3                   	ret
+
+00804b05 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b05:	55                   	push   %ebp
+  804b06:	89 e5                	mov    %esp,%ebp
+  804b08:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b10:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804b13:	c1 e0 04             	shl    $0x4,%eax
+  804b16:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b1b:	8b 40 50             	mov    0x50(%eax),%eax
+  804b1e:	39 c8                	cmp    %ecx,%eax
+  804b20:	74 12                	je     804b34 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b22:	83 c2 01             	add    $0x1,%edx
+  804b25:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b2b:	75 e3                	jne    804b10 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b32:	eb 0e                	jmp    804b42 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804b34:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804b37:	c1 e0 04             	shl    $0x4,%eax
+  804b3a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b3f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804b42:	5d                   	pop    %ebp
+  804b43:	c3                   	ret
+
+00804b44 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804b44:	55                   	push   %ebp
+  804b45:	89 e5                	mov    %esp,%ebp
+  804b47:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b4a:	89 c2                	mov    %eax,%edx
+  804b4c:	c1 ea 16             	shr    $0x16,%edx
+  804b4f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804b56:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b5b:	f6 c1 01             	test   $0x1,%cl
+  804b5e:	74 1c                	je     804b7c <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804b60:	c1 e8 0c             	shr    $0xc,%eax
+  804b63:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804b6a:	a8 01                	test   $0x1,%al
+  804b6c:	74 0e                	je     804b7c <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804b6e:	c1 e8 0c             	shr    $0xc,%eax
+  804b71:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804b78:	ef 
+  804b79:	0f b7 d2             	movzwl %dx,%edx
+}
+  804b7c:	89 d0                	mov    %edx,%eax
+  804b7e:	5d                   	pop    %ebp
+  804b7f:	c3                   	ret
+
+00804b80 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804b80:	55                   	push   %ebp
+  804b81:	89 e5                	mov    %esp,%ebp
+  804b83:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804b86:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804b8d:	74 0a                	je     804b99 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b92:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804b97:	c9                   	leave
+  804b98:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804b99:	83 ec 04             	sub    $0x4,%esp
+  804b9c:	6a 07                	push   $0x7
+  804b9e:	68 00 f0 bf ee       	push   $0xeebff000
+  804ba3:	6a 00                	push   $0x0
+  804ba5:	e8 b9 c7 ff ff       	call   801363 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804baa:	83 c4 08             	add    $0x8,%esp
+  804bad:	68 be 4b 80 00       	push   $0x804bbe
+  804bb2:	6a 00                	push   $0x0
+  804bb4:	e8 27 c9 ff ff       	call   8014e0 <sys_env_set_pgfault_upcall>
+  804bb9:	83 c4 10             	add    $0x10,%esp
+  804bbc:	eb d1                	jmp    804b8f <set_pgfault_handler+0xf>
+
+00804bbe <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804bbe:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804bbf:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804bc4:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804bc6:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804bc9:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804bcd:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804bd1:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804bd4:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804bd8:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804bda:	83 c4 08             	add    $0x8,%esp
+	popal
+  804bdd:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804bde:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804be1:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804be2:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804be3:	c3                   	ret
+
+00804be4 <udm>:
+  804be4:	57                   	push   %edi
+  804be5:	56                   	push   %esi
+  804be6:	53                   	push   %ebx
+  804be7:	83 ec 20             	sub    $0x20,%esp
+  804bea:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804bee:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804bf2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804bf6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804bfa:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bfe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804c02:	89 d1                	mov    %edx,%ecx
+  804c04:	09 c1                	or     %eax,%ecx
+  804c06:	0f 84 91 00 00 00    	je     804c9d <udm+0xb9>
+  804c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c11:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c16:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c1b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c22:	00 
+  804c23:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c2a:	00 
+  804c2b:	eb 08                	jmp    804c35 <udm+0x51>
+  804c2d:	83 e9 01             	sub    $0x1,%ecx
+  804c30:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c33:	74 7c                	je     804cb1 <udm+0xcd>
+  804c35:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c39:	01 c0                	add    %eax,%eax
+  804c3b:	89 c6                	mov    %eax,%esi
+  804c3d:	89 d7                	mov    %edx,%edi
+  804c3f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804c43:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804c47:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c4a:	d3 ea                	shr    %cl,%edx
+  804c4c:	f6 c1 20             	test   $0x20,%cl
+  804c4f:	74 04                	je     804c55 <udm+0x71>
+  804c51:	89 d0                	mov    %edx,%eax
+  804c53:	31 d2                	xor    %edx,%edx
+  804c55:	83 e0 01             	and    $0x1,%eax
+  804c58:	89 04 24             	mov    %eax,(%esp)
+  804c5b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c62:	00 
+  804c63:	8b 04 24             	mov    (%esp),%eax
+  804c66:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c6a:	09 f0                	or     %esi,%eax
+  804c6c:	09 fa                	or     %edi,%edx
+  804c6e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804c72:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804c76:	39 f0                	cmp    %esi,%eax
+  804c78:	89 d3                	mov    %edx,%ebx
+  804c7a:	19 fb                	sbb    %edi,%ebx
+  804c7c:	72 af                	jb     804c2d <udm+0x49>
+  804c7e:	29 f0                	sub    %esi,%eax
+  804c80:	19 fa                	sbb    %edi,%edx
+  804c82:	89 cf                	mov    %ecx,%edi
+  804c84:	c1 ef 05             	shr    $0x5,%edi
+  804c87:	83 e7 01             	and    $0x1,%edi
+  804c8a:	89 fe                	mov    %edi,%esi
+  804c8c:	83 f6 01             	xor    $0x1,%esi
+  804c8f:	d3 e6                	shl    %cl,%esi
+  804c91:	d3 e7                	shl    %cl,%edi
+  804c93:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c97:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c9b:	eb 90                	jmp    804c2d <udm+0x49>
+  804c9d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ca1:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804ca5:	89 f0                	mov    %esi,%eax
+  804ca7:	89 fa                	mov    %edi,%edx
+  804ca9:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804cad:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804cb1:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804cb5:	89 01                	mov    %eax,(%ecx)
+  804cb7:	89 51 04             	mov    %edx,0x4(%ecx)
+  804cba:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cbe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cc2:	83 c4 20             	add    $0x20,%esp
+  804cc5:	5b                   	pop    %ebx
+  804cc6:	5e                   	pop    %esi
+  804cc7:	5f                   	pop    %edi
+  804cc8:	c3                   	ret
+
+00804cc9 <__udivdi3>:
+  804cc9:	83 ec 18             	sub    $0x18,%esp
+  804ccc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804cd0:	50                   	push   %eax
+  804cd1:	ff 74 24 2c          	push   0x2c(%esp)
+  804cd5:	ff 74 24 2c          	push   0x2c(%esp)
+  804cd9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cdd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ce1:	e8 fe fe ff ff       	call   804be4 <udm>
+  804ce6:	83 c4 24             	add    $0x24,%esp
+  804ce9:	c3                   	ret
+
+00804cea <__umoddi3>:
+  804cea:	83 ec 18             	sub    $0x18,%esp
+  804ced:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804cf1:	50                   	push   %eax
+  804cf2:	ff 74 24 2c          	push   0x2c(%esp)
+  804cf6:	ff 74 24 2c          	push   0x2c(%esp)
+  804cfa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cfe:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d02:	e8 dd fe ff ff       	call   804be4 <udm>
+  804d07:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d0b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d0f:	83 c4 24             	add    $0x24,%esp
+  804d12:	c3                   	ret
+
+00804d13 <__divdi3>:
+  804d13:	56                   	push   %esi
+  804d14:	53                   	push   %ebx
+  804d15:	83 ec 14             	sub    $0x14,%esp
+  804d18:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804d1c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804d20:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804d24:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804d28:	85 d2                	test   %edx,%edx
+  804d2a:	78 18                	js     804d44 <__divdi3+0x31>
+  804d2c:	85 db                	test   %ebx,%ebx
+  804d2e:	78 3e                	js     804d6e <__divdi3+0x5b>
+  804d30:	83 ec 04             	sub    $0x4,%esp
+  804d33:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d37:	56                   	push   %esi
+  804d38:	53                   	push   %ebx
+  804d39:	51                   	push   %ecx
+  804d3a:	e8 a5 fe ff ff       	call   804be4 <udm>
+  804d3f:	83 c4 10             	add    $0x10,%esp
+  804d42:	eb 24                	jmp    804d68 <__divdi3+0x55>
+  804d44:	f7 d8                	neg    %eax
+  804d46:	83 d2 00             	adc    $0x0,%edx
+  804d49:	f7 da                	neg    %edx
+  804d4b:	85 db                	test   %ebx,%ebx
+  804d4d:	78 3a                	js     804d89 <__divdi3+0x76>
+  804d4f:	83 ec 04             	sub    $0x4,%esp
+  804d52:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d56:	56                   	push   %esi
+  804d57:	53                   	push   %ebx
+  804d58:	51                   	push   %ecx
+  804d59:	e8 86 fe ff ff       	call   804be4 <udm>
+  804d5e:	83 c4 10             	add    $0x10,%esp
+  804d61:	f7 d8                	neg    %eax
+  804d63:	83 d2 00             	adc    $0x0,%edx
+  804d66:	f7 da                	neg    %edx
+  804d68:	83 c4 14             	add    $0x14,%esp
+  804d6b:	5b                   	pop    %ebx
+  804d6c:	5e                   	pop    %esi
+  804d6d:	c3                   	ret
+  804d6e:	83 ec 04             	sub    $0x4,%esp
+  804d71:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d75:	56                   	push   %esi
+  804d76:	f7 d9                	neg    %ecx
+  804d78:	83 d3 00             	adc    $0x0,%ebx
+  804d7b:	f7 db                	neg    %ebx
+  804d7d:	53                   	push   %ebx
+  804d7e:	51                   	push   %ecx
+  804d7f:	e8 60 fe ff ff       	call   804be4 <udm>
+  804d84:	83 c4 10             	add    $0x10,%esp
+  804d87:	eb d8                	jmp    804d61 <__divdi3+0x4e>
+  804d89:	83 ec 04             	sub    $0x4,%esp
+  804d8c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d90:	56                   	push   %esi
+  804d91:	f7 d9                	neg    %ecx
+  804d93:	83 d3 00             	adc    $0x0,%ebx
+  804d96:	f7 db                	neg    %ebx
+  804d98:	53                   	push   %ebx
+  804d99:	51                   	push   %ecx
+  804d9a:	e8 45 fe ff ff       	call   804be4 <udm>
+  804d9f:	83 c4 10             	add    $0x10,%esp
+  804da2:	eb c4                	jmp    804d68 <__divdi3+0x55>
+
+00804da4 <__moddi3>:
+  804da4:	55                   	push   %ebp
+  804da5:	57                   	push   %edi
+  804da6:	56                   	push   %esi
+  804da7:	53                   	push   %ebx
+  804da8:	83 ec 24             	sub    $0x24,%esp
+  804dab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804daf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804db3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804db7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804dbb:	85 d2                	test   %edx,%edx
+  804dbd:	78 3b                	js     804dfa <__moddi3+0x56>
+  804dbf:	83 ec 04             	sub    $0x4,%esp
+  804dc2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804dc6:	56                   	push   %esi
+  804dc7:	89 ce                	mov    %ecx,%esi
+  804dc9:	f7 de                	neg    %esi
+  804dcb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804dcf:	89 de                	mov    %ebx,%esi
+  804dd1:	83 d6 00             	adc    $0x0,%esi
+  804dd4:	f7 de                	neg    %esi
+  804dd6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804dda:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804dde:	0f 48 f1             	cmovs  %ecx,%esi
+  804de1:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804de6:	53                   	push   %ebx
+  804de7:	56                   	push   %esi
+  804de8:	e8 f7 fd ff ff       	call   804be4 <udm>
+  804ded:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804df1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804df5:	83 c4 10             	add    $0x10,%esp
+  804df8:	eb 47                	jmp    804e41 <__moddi3+0x9d>
+  804dfa:	f7 d8                	neg    %eax
+  804dfc:	83 d2 00             	adc    $0x0,%edx
+  804dff:	f7 da                	neg    %edx
+  804e01:	83 ec 04             	sub    $0x4,%esp
+  804e04:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e08:	56                   	push   %esi
+  804e09:	89 cf                	mov    %ecx,%edi
+  804e0b:	f7 df                	neg    %edi
+  804e0d:	89 de                	mov    %ebx,%esi
+  804e0f:	83 d6 00             	adc    $0x0,%esi
+  804e12:	f7 de                	neg    %esi
+  804e14:	0f 49 cf             	cmovns %edi,%ecx
+  804e17:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804e1b:	0f 49 de             	cmovns %esi,%ebx
+  804e1e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804e22:	ff 74 24 0c          	push   0xc(%esp)
+  804e26:	ff 74 24 0c          	push   0xc(%esp)
+  804e2a:	e8 b5 fd ff ff       	call   804be4 <udm>
+  804e2f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e33:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e37:	f7 d8                	neg    %eax
+  804e39:	83 d2 00             	adc    $0x0,%edx
+  804e3c:	f7 da                	neg    %edx
+  804e3e:	83 c4 10             	add    $0x10,%esp
+  804e41:	83 c4 24             	add    $0x24,%esp
+  804e44:	5b                   	pop    %ebx
+  804e45:	5e                   	pop    %esi
+  804e46:	5f                   	pop    %edi
+  804e47:	5d                   	pop    %ebp
+  804e48:	c3                   	ret
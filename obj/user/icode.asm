@@ -0,0 +1,10354 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 60 80 00 e0 	movl   $0x804de0,0x806000
+  800045:	4d 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 e6 4d 80 00       	push   $0x804de6
+  80004d:	e8 60 02 00 00       	call   8002b2 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 f5 4d 80 00 	movl   $0x804df5,(%esp)
+  800059:	e8 54 02 00 00       	call   8002b2 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 08 4e 80 00       	push   $0x804e08
+  800068:	e8 5e 1a 00 00       	call   801acb <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 31 4e 80 00       	push   $0x804e31
+  80007e:	e8 2f 02 00 00       	call   8002b2 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 0e 4e 80 00       	push   $0x804e0e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 24 4e 80 00       	push   $0x804e24
+  80009b:	e8 37 01 00 00       	call   8001d7 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 30 0b 00 00       	call   800bda <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 c7 13 00 00       	call   801483 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 44 4e 80 00       	push   $0x804e44
+  8000cb:	e8 e2 01 00 00       	call   8002b2 <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 6f 12 00 00       	call   801347 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 58 4e 80 00 	movl   $0x804e58,(%esp)
+  8000df:	e8 ce 01 00 00       	call   8002b2 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 6c 4e 80 00       	push   $0x804e6c
+  8000f0:	68 75 4e 80 00       	push   $0x804e75
+  8000f5:	68 7f 4e 80 00       	push   $0x804e7f
+  8000fa:	68 7e 4e 80 00       	push   $0x804e7e
+  8000ff:	e8 0d 2c 00 00       	call   802d11 <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 9b 4e 80 00       	push   $0x804e9b
+  800113:	e8 9a 01 00 00       	call   8002b2 <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 84 4e 80 00       	push   $0x804e84
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 24 4e 80 00       	push   $0x804e24
+  80012f:	e8 a3 00 00 00       	call   8001d7 <_panic>
+
+00800134 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+  80013a:	83 ec 1c             	sub    $0x1c,%esp
+  80013d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800140:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800143:	e8 34 0b 00 00       	call   800c7c <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800148:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80014b:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  800151:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800156:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800158:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80015a:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800160:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800165:	77 16                	ja     80017d <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800167:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80016c:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80016e:	c1 e8 10             	shr    $0x10,%eax
+  800171:	74 0a                	je     80017d <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800173:	c1 e0 10             	shl    $0x10,%eax
+  800176:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80017b:	29 c2                	sub    %eax,%edx
+  80017d:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800180:	c1 e0 04             	shl    $0x4,%eax
+  800183:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800188:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80018a:	85 db                	test   %ebx,%ebx
+  80018c:	7e 07                	jle    800195 <libmain+0x61>
+		binaryname = argv[0];
+  80018e:	8b 06                	mov    (%esi),%eax
+  800190:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800195:	83 ec 08             	sub    $0x8,%esp
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+  80019a:	e8 94 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80019f:	e8 0b 00 00 00       	call   8001af <exit>
+}
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5f                   	pop    %edi
+  8001ad:	5d                   	pop    %ebp
+  8001ae:	c3                   	ret
+
+008001af <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 15 21 00 00       	call   8022d1 <fflush>
+	pthread_kill_others();
+  8001bc:	e8 9d 3d 00 00       	call   803f5e <pthread_kill_others>
+	close_all();
+  8001c1:	e8 ae 11 00 00       	call   801374 <close_all>
+	sys_env_destroy(0);
+  8001c6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001cd:	e8 5f 0a 00 00       	call   800c31 <sys_env_destroy>
+}
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+008001d7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	56                   	push   %esi
+  8001db:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001dc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001df:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8001e5:	e8 92 0a 00 00       	call   800c7c <sys_getenvid>
+  8001ea:	83 ec 0c             	sub    $0xc,%esp
+  8001ed:	ff 75 0c             	push   0xc(%ebp)
+  8001f0:	ff 75 08             	push   0x8(%ebp)
+  8001f3:	56                   	push   %esi
+  8001f4:	50                   	push   %eax
+  8001f5:	68 b8 4e 80 00       	push   $0x804eb8
+  8001fa:	e8 b3 00 00 00       	call   8002b2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001ff:	83 c4 18             	add    $0x18,%esp
+  800202:	53                   	push   %ebx
+  800203:	ff 75 10             	push   0x10(%ebp)
+  800206:	e8 56 00 00 00       	call   800261 <vcprintf>
+	cprintf("\n");
+  80020b:	c7 04 24 4e 56 80 00 	movl   $0x80564e,(%esp)
+  800212:	e8 9b 00 00 00       	call   8002b2 <cprintf>
+  800217:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80021a:	cc                   	int3
+	while (1)
+  80021b:	eb fd                	jmp    80021a <_panic+0x43>
+
+0080021d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	53                   	push   %ebx
+  800221:	83 ec 04             	sub    $0x4,%esp
+  800224:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800227:	8b 13                	mov    (%ebx),%edx
+  800229:	8d 42 01             	lea    0x1(%edx),%eax
+  80022c:	89 03                	mov    %eax,(%ebx)
+  80022e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800231:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800235:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80023a:	74 09                	je     800245 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80023c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800240:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	68 ff 00 00 00       	push   $0xff
+  80024d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800250:	50                   	push   %eax
+  800251:	e8 84 09 00 00       	call   800bda <sys_cputs>
+		b->idx = 0;
+  800256:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80025c:	83 c4 10             	add    $0x10,%esp
+  80025f:	eb db                	jmp    80023c <putch+0x1f>
+
+00800261 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800261:	55                   	push   %ebp
+  800262:	89 e5                	mov    %esp,%ebp
+  800264:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80026a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800271:	00 00 00 
+	b.cnt = 0;
+  800274:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80027b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80027e:	ff 75 0c             	push   0xc(%ebp)
+  800281:	ff 75 08             	push   0x8(%ebp)
+  800284:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80028a:	50                   	push   %eax
+  80028b:	68 1d 02 80 00       	push   $0x80021d
+  800290:	e8 14 01 00 00       	call   8003a9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800295:	83 c4 08             	add    $0x8,%esp
+  800298:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80029e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	e8 30 09 00 00       	call   800bda <sys_cputs>
+
+	return b.cnt;
+}
+  8002aa:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b0:	c9                   	leave
+  8002b1:	c3                   	ret
+
+008002b2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002b8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002bb:	50                   	push   %eax
+  8002bc:	ff 75 08             	push   0x8(%ebp)
+  8002bf:	e8 9d ff ff ff       	call   800261 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+008002c6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	57                   	push   %edi
+  8002ca:	56                   	push   %esi
+  8002cb:	53                   	push   %ebx
+  8002cc:	83 ec 1c             	sub    $0x1c,%esp
+  8002cf:	89 c7                	mov    %eax,%edi
+  8002d1:	89 d6                	mov    %edx,%esi
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002d9:	89 d1                	mov    %edx,%ecx
+  8002db:	89 c2                	mov    %eax,%edx
+  8002dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002e3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ec:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f3:	39 c2                	cmp    %eax,%edx
+  8002f5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002f8:	72 3e                	jb     800338 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	ff 75 18             	push   0x18(%ebp)
+  800300:	83 eb 01             	sub    $0x1,%ebx
+  800303:	53                   	push   %ebx
+  800304:	50                   	push   %eax
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	ff 75 e4             	push   -0x1c(%ebp)
+  80030b:	ff 75 e0             	push   -0x20(%ebp)
+  80030e:	ff 75 dc             	push   -0x24(%ebp)
+  800311:	ff 75 d8             	push   -0x28(%ebp)
+  800314:	e8 3e 49 00 00       	call   804c57 <__udivdi3>
+  800319:	83 c4 18             	add    $0x18,%esp
+  80031c:	52                   	push   %edx
+  80031d:	50                   	push   %eax
+  80031e:	89 f2                	mov    %esi,%edx
+  800320:	89 f8                	mov    %edi,%eax
+  800322:	e8 9f ff ff ff       	call   8002c6 <printnum>
+  800327:	83 c4 20             	add    $0x20,%esp
+  80032a:	eb 13                	jmp    80033f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	56                   	push   %esi
+  800330:	ff 75 18             	push   0x18(%ebp)
+  800333:	ff d7                	call   *%edi
+  800335:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800338:	83 eb 01             	sub    $0x1,%ebx
+  80033b:	85 db                	test   %ebx,%ebx
+  80033d:	7f ed                	jg     80032c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80033f:	83 ec 08             	sub    $0x8,%esp
+  800342:	56                   	push   %esi
+  800343:	83 ec 04             	sub    $0x4,%esp
+  800346:	ff 75 e4             	push   -0x1c(%ebp)
+  800349:	ff 75 e0             	push   -0x20(%ebp)
+  80034c:	ff 75 dc             	push   -0x24(%ebp)
+  80034f:	ff 75 d8             	push   -0x28(%ebp)
+  800352:	e8 21 49 00 00       	call   804c78 <__umoddi3>
+  800357:	83 c4 14             	add    $0x14,%esp
+  80035a:	0f be 80 db 4e 80 00 	movsbl 0x804edb(%eax),%eax
+  800361:	50                   	push   %eax
+  800362:	ff d7                	call   *%edi
+}
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036a:	5b                   	pop    %ebx
+  80036b:	5e                   	pop    %esi
+  80036c:	5f                   	pop    %edi
+  80036d:	5d                   	pop    %ebp
+  80036e:	c3                   	ret
+
+0080036f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80036f:	55                   	push   %ebp
+  800370:	89 e5                	mov    %esp,%ebp
+  800372:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800375:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800379:	8b 10                	mov    (%eax),%edx
+  80037b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80037e:	73 0a                	jae    80038a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800380:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800383:	89 08                	mov    %ecx,(%eax)
+  800385:	8b 45 08             	mov    0x8(%ebp),%eax
+  800388:	88 02                	mov    %al,(%edx)
+}
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+
+0080038c <printfmt>:
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800392:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800395:	50                   	push   %eax
+  800396:	ff 75 10             	push   0x10(%ebp)
+  800399:	ff 75 0c             	push   0xc(%ebp)
+  80039c:	ff 75 08             	push   0x8(%ebp)
+  80039f:	e8 05 00 00 00       	call   8003a9 <vprintfmt>
+}
+  8003a4:	83 c4 10             	add    $0x10,%esp
+  8003a7:	c9                   	leave
+  8003a8:	c3                   	ret
+
+008003a9 <vprintfmt>:
+{
+  8003a9:	55                   	push   %ebp
+  8003aa:	89 e5                	mov    %esp,%ebp
+  8003ac:	57                   	push   %edi
+  8003ad:	56                   	push   %esi
+  8003ae:	53                   	push   %ebx
+  8003af:	83 ec 2c             	sub    $0x2c,%esp
+  8003b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003b8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003bb:	eb 0a                	jmp    8003c7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003bd:	83 ec 08             	sub    $0x8,%esp
+  8003c0:	53                   	push   %ebx
+  8003c1:	50                   	push   %eax
+  8003c2:	ff d6                	call   *%esi
+  8003c4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8003c7:	83 c7 01             	add    $0x1,%edi
+  8003ca:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8003ce:	83 f8 25             	cmp    $0x25,%eax
+  8003d1:	74 0c                	je     8003df <vprintfmt+0x36>
+			if (ch == '\0')
+  8003d3:	85 c0                	test   %eax,%eax
+  8003d5:	75 e6                	jne    8003bd <vprintfmt+0x14>
+}
+  8003d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003da:	5b                   	pop    %ebx
+  8003db:	5e                   	pop    %esi
+  8003dc:	5f                   	pop    %edi
+  8003dd:	5d                   	pop    %ebp
+  8003de:	c3                   	ret
+		padc = ' ';
+  8003df:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003e3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003ea:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003f1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003fd:	8d 47 01             	lea    0x1(%edi),%eax
+  800400:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800403:	0f b6 17             	movzbl (%edi),%edx
+  800406:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800409:	3c 55                	cmp    $0x55,%al
+  80040b:	0f 87 c5 03 00 00    	ja     8007d6 <vprintfmt+0x42d>
+  800411:	0f b6 c0             	movzbl %al,%eax
+  800414:	ff 24 85 60 50 80 00 	jmp    *0x805060(,%eax,4)
+  80041b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80041e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800421:	eb da                	jmp    8003fd <vprintfmt+0x54>
+  800423:	0f be d2             	movsbl %dl,%edx
+  800426:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800431:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800434:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800438:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80043b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80043e:	83 f9 09             	cmp    $0x9,%ecx
+  800441:	77 55                	ja     800498 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800443:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800446:	eb e9                	jmp    800431 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800448:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044b:	8b 00                	mov    (%eax),%eax
+  80044d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800450:	8b 45 14             	mov    0x14(%ebp),%eax
+  800453:	8d 40 04             	lea    0x4(%eax),%eax
+  800456:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800459:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80045c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800460:	79 9b                	jns    8003fd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800462:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800465:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800468:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80046f:	eb 8c                	jmp    8003fd <vprintfmt+0x54>
+			if (width < 0)
+  800471:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800474:	85 d2                	test   %edx,%edx
+  800476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047b:	0f 49 c2             	cmovns %edx,%eax
+  80047e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800481:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800484:	e9 74 ff ff ff       	jmp    8003fd <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800489:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80048c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800493:	e9 65 ff ff ff       	jmp    8003fd <vprintfmt+0x54>
+  800498:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80049b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049e:	eb bc                	jmp    80045c <vprintfmt+0xb3>
+			lflag++;
+  8004a0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8004a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004a6:	e9 52 ff ff ff       	jmp    8003fd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8d 78 04             	lea    0x4(%eax),%edi
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	53                   	push   %ebx
+  8004b5:	ff 30                	push   (%eax)
+  8004b7:	ff d6                	call   *%esi
+			break;
+  8004b9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004bc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004bf:	e9 b1 02 00 00       	jmp    800775 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004ca:	8b 10                	mov    (%eax),%edx
+  8004cc:	89 d0                	mov    %edx,%eax
+  8004ce:	f7 d8                	neg    %eax
+  8004d0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d3:	83 f8 14             	cmp    $0x14,%eax
+  8004d6:	7f 23                	jg     8004fb <vprintfmt+0x152>
+  8004d8:	8b 14 85 c0 51 80 00 	mov    0x8051c0(,%eax,4),%edx
+  8004df:	85 d2                	test   %edx,%edx
+  8004e1:	74 18                	je     8004fb <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8004e3:	52                   	push   %edx
+  8004e4:	68 2f 53 80 00       	push   $0x80532f
+  8004e9:	53                   	push   %ebx
+  8004ea:	56                   	push   %esi
+  8004eb:	e8 9c fe ff ff       	call   80038c <printfmt>
+  8004f0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004f6:	e9 7a 02 00 00       	jmp    800775 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004fb:	50                   	push   %eax
+  8004fc:	68 f3 4e 80 00       	push   $0x804ef3
+  800501:	53                   	push   %ebx
+  800502:	56                   	push   %esi
+  800503:	e8 84 fe ff ff       	call   80038c <printfmt>
+  800508:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80050b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80050e:	e9 62 02 00 00       	jmp    800775 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800513:	8b 45 14             	mov    0x14(%ebp),%eax
+  800516:	83 c0 04             	add    $0x4,%eax
+  800519:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80051c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800521:	85 c9                	test   %ecx,%ecx
+  800523:	b8 ec 4e 80 00       	mov    $0x804eec,%eax
+  800528:	0f 45 c1             	cmovne %ecx,%eax
+  80052b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80052e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800532:	7e 06                	jle    80053a <vprintfmt+0x191>
+  800534:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800538:	75 0b                	jne    800545 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80053d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800540:	89 75 08             	mov    %esi,0x8(%ebp)
+  800543:	eb 5c                	jmp    8005a1 <vprintfmt+0x1f8>
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	ff 75 d0             	push   -0x30(%ebp)
+  80054b:	ff 75 cc             	push   -0x34(%ebp)
+  80054e:	e8 20 03 00 00       	call   800873 <strnlen>
+  800553:	89 c2                	mov    %eax,%edx
+  800555:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800558:	29 d0                	sub    %edx,%eax
+  80055a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80055d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800561:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800564:	89 75 08             	mov    %esi,0x8(%ebp)
+  800567:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800569:	eb 0e                	jmp    800579 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80056b:	83 ec 08             	sub    $0x8,%esp
+  80056e:	53                   	push   %ebx
+  80056f:	57                   	push   %edi
+  800570:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800573:	83 ee 01             	sub    $0x1,%esi
+  800576:	83 c4 10             	add    $0x10,%esp
+  800579:	85 f6                	test   %esi,%esi
+  80057b:	7f ee                	jg     80056b <vprintfmt+0x1c2>
+  80057d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800580:	8b 75 08             	mov    0x8(%ebp),%esi
+  800583:	85 c0                	test   %eax,%eax
+  800585:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058a:	0f 49 d0             	cmovns %eax,%edx
+  80058d:	29 d0                	sub    %edx,%eax
+  80058f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800592:	eb a6                	jmp    80053a <vprintfmt+0x191>
+					putch(ch, putdat);
+  800594:	83 ec 08             	sub    $0x8,%esp
+  800597:	53                   	push   %ebx
+  800598:	52                   	push   %edx
+  800599:	ff 55 08             	call   *0x8(%ebp)
+  80059c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059f:	89 f1                	mov    %esi,%ecx
+  8005a1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005a4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005a8:	0f be d0             	movsbl %al,%edx
+  8005ab:	85 d2                	test   %edx,%edx
+  8005ad:	74 28                	je     8005d7 <vprintfmt+0x22e>
+  8005af:	85 ff                	test   %edi,%edi
+  8005b1:	78 05                	js     8005b8 <vprintfmt+0x20f>
+  8005b3:	83 ef 01             	sub    $0x1,%edi
+  8005b6:	78 30                	js     8005e8 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005b8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005bc:	74 d6                	je     800594 <vprintfmt+0x1eb>
+  8005be:	0f be c0             	movsbl %al,%eax
+  8005c1:	83 e8 20             	sub    $0x20,%eax
+  8005c4:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c7:	76 cb                	jbe    800594 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8005c9:	83 ec 08             	sub    $0x8,%esp
+  8005cc:	53                   	push   %ebx
+  8005cd:	6a 3f                	push   $0x3f
+  8005cf:	ff 55 08             	call   *0x8(%ebp)
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	eb c8                	jmp    80059f <vprintfmt+0x1f6>
+  8005d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005da:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005dd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005e0:	01 d0                	add    %edx,%eax
+  8005e2:	29 c8                	sub    %ecx,%eax
+  8005e4:	89 c7                	mov    %eax,%edi
+  8005e6:	eb 13                	jmp    8005fb <vprintfmt+0x252>
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	eb ed                	jmp    8005da <vprintfmt+0x231>
+				putch(' ', putdat);
+  8005ed:	83 ec 08             	sub    $0x8,%esp
+  8005f0:	53                   	push   %ebx
+  8005f1:	6a 20                	push   $0x20
+  8005f3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005f5:	83 ef 01             	sub    $0x1,%edi
+  8005f8:	83 c4 10             	add    $0x10,%esp
+  8005fb:	85 ff                	test   %edi,%edi
+  8005fd:	7f ee                	jg     8005ed <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ff:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	e9 6b 01 00 00       	jmp    800775 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80060a:	83 f9 01             	cmp    $0x1,%ecx
+  80060d:	7f 1f                	jg     80062e <vprintfmt+0x285>
+	else if (lflag)
+  80060f:	85 c9                	test   %ecx,%ecx
+  800611:	74 67                	je     80067a <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 00                	mov    (%eax),%eax
+  800618:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80061b:	89 c1                	mov    %eax,%ecx
+  80061d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800620:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8d 40 04             	lea    0x4(%eax),%eax
+  800629:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062c:	eb 17                	jmp    800645 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 50 04             	mov    0x4(%eax),%edx
+  800634:	8b 00                	mov    (%eax),%eax
+  800636:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800639:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8d 40 08             	lea    0x8(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800645:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800648:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80064b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800650:	85 c9                	test   %ecx,%ecx
+  800652:	0f 89 03 01 00 00    	jns    80075b <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800658:	83 ec 08             	sub    $0x8,%esp
+  80065b:	53                   	push   %ebx
+  80065c:	6a 2d                	push   $0x2d
+  80065e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800660:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800663:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800666:	f7 da                	neg    %edx
+  800668:	83 d1 00             	adc    $0x0,%ecx
+  80066b:	f7 d9                	neg    %ecx
+  80066d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800675:	e9 e1 00 00 00       	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 00                	mov    (%eax),%eax
+  80067f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800682:	89 c1                	mov    %eax,%ecx
+  800684:	c1 f9 1f             	sar    $0x1f,%ecx
+  800687:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8d 40 04             	lea    0x4(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+  800693:	eb b0                	jmp    800645 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800695:	83 f9 01             	cmp    $0x1,%ecx
+  800698:	7f 1e                	jg     8006b8 <vprintfmt+0x30f>
+	else if (lflag)
+  80069a:	85 c9                	test   %ecx,%ecx
+  80069c:	74 32                	je     8006d0 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80069e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a1:	8b 10                	mov    (%eax),%edx
+  8006a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ae:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006b3:	e9 a3 00 00 00       	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006cb:	e9 8b 00 00 00       	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006da:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006e5:	eb 74                	jmp    80075b <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1b                	jg     800707 <vprintfmt+0x35e>
+	else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 2c                	je     80071c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800700:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800705:	eb 54                	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800715:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80071a:	eb 3f                	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800731:	eb 28                	jmp    80075b <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 30                	push   $0x30
+  800739:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80073b:	83 c4 08             	add    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	6a 78                	push   $0x78
+  800741:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 10                	mov    (%eax),%edx
+  800748:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80074d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800756:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80075b:	83 ec 0c             	sub    $0xc,%esp
+  80075e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800762:	50                   	push   %eax
+  800763:	ff 75 e0             	push   -0x20(%ebp)
+  800766:	57                   	push   %edi
+  800767:	51                   	push   %ecx
+  800768:	52                   	push   %edx
+  800769:	89 da                	mov    %ebx,%edx
+  80076b:	89 f0                	mov    %esi,%eax
+  80076d:	e8 54 fb ff ff       	call   8002c6 <printnum>
+			break;
+  800772:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800775:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800778:	e9 4a fc ff ff       	jmp    8003c7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80077d:	83 f9 01             	cmp    $0x1,%ecx
+  800780:	7f 1b                	jg     80079d <vprintfmt+0x3f4>
+	else if (lflag)
+  800782:	85 c9                	test   %ecx,%ecx
+  800784:	74 2c                	je     8007b2 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800796:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80079b:	eb be                	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 10                	mov    (%eax),%edx
+  8007a2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ab:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b0:	eb a9                	jmp    80075b <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 10                	mov    (%eax),%edx
+  8007b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007c7:	eb 92                	jmp    80075b <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8007c9:	83 ec 08             	sub    $0x8,%esp
+  8007cc:	53                   	push   %ebx
+  8007cd:	6a 25                	push   $0x25
+  8007cf:	ff d6                	call   *%esi
+			break;
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	eb 9f                	jmp    800775 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8007d6:	83 ec 08             	sub    $0x8,%esp
+  8007d9:	53                   	push   %ebx
+  8007da:	6a 25                	push   $0x25
+  8007dc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007de:	83 c4 10             	add    $0x10,%esp
+  8007e1:	89 f8                	mov    %edi,%eax
+  8007e3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007e7:	74 05                	je     8007ee <vprintfmt+0x445>
+  8007e9:	83 e8 01             	sub    $0x1,%eax
+  8007ec:	eb f5                	jmp    8007e3 <vprintfmt+0x43a>
+  8007ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007f1:	eb 82                	jmp    800775 <vprintfmt+0x3cc>
+
+008007f3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	83 ec 18             	sub    $0x18,%esp
+  8007f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007ff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800802:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800806:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800809:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800810:	85 c0                	test   %eax,%eax
+  800812:	74 26                	je     80083a <vsnprintf+0x47>
+  800814:	85 d2                	test   %edx,%edx
+  800816:	7e 22                	jle    80083a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800818:	ff 75 14             	push   0x14(%ebp)
+  80081b:	ff 75 10             	push   0x10(%ebp)
+  80081e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800821:	50                   	push   %eax
+  800822:	68 6f 03 80 00       	push   $0x80036f
+  800827:	e8 7d fb ff ff       	call   8003a9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80082c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80082f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800832:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800835:	83 c4 10             	add    $0x10,%esp
+}
+  800838:	c9                   	leave
+  800839:	c3                   	ret
+		return -E_INVAL;
+  80083a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80083f:	eb f7                	jmp    800838 <vsnprintf+0x45>
+
+00800841 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800847:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80084a:	50                   	push   %eax
+  80084b:	ff 75 10             	push   0x10(%ebp)
+  80084e:	ff 75 0c             	push   0xc(%ebp)
+  800851:	ff 75 08             	push   0x8(%ebp)
+  800854:	e8 9a ff ff ff       	call   8007f3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800859:	c9                   	leave
+  80085a:	c3                   	ret
+
+0080085b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800861:	b8 00 00 00 00       	mov    $0x0,%eax
+  800866:	eb 03                	jmp    80086b <strlen+0x10>
+		n++;
+  800868:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80086b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80086f:	75 f7                	jne    800868 <strlen+0xd>
+	return n;
+}
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800879:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	eb 03                	jmp    800886 <strnlen+0x13>
+		n++;
+  800883:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800886:	39 d0                	cmp    %edx,%eax
+  800888:	74 08                	je     800892 <strnlen+0x1f>
+  80088a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80088e:	75 f3                	jne    800883 <strnlen+0x10>
+  800890:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800892:	89 d0                	mov    %edx,%eax
+  800894:	5d                   	pop    %ebp
+  800895:	c3                   	ret
+
+00800896 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	53                   	push   %ebx
+  80089a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80089d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008a9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008ac:	83 c0 01             	add    $0x1,%eax
+  8008af:	84 d2                	test   %dl,%dl
+  8008b1:	75 f2                	jne    8008a5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008b3:	89 c8                	mov    %ecx,%eax
+  8008b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b8:	c9                   	leave
+  8008b9:	c3                   	ret
+
+008008ba <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ba:	55                   	push   %ebp
+  8008bb:	89 e5                	mov    %esp,%ebp
+  8008bd:	53                   	push   %ebx
+  8008be:	83 ec 10             	sub    $0x10,%esp
+  8008c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008c4:	53                   	push   %ebx
+  8008c5:	e8 91 ff ff ff       	call   80085b <strlen>
+  8008ca:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008cd:	ff 75 0c             	push   0xc(%ebp)
+  8008d0:	01 d8                	add    %ebx,%eax
+  8008d2:	50                   	push   %eax
+  8008d3:	e8 be ff ff ff       	call   800896 <strcpy>
+	return dst;
+}
+  8008d8:	89 d8                	mov    %ebx,%eax
+  8008da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008dd:	c9                   	leave
+  8008de:	c3                   	ret
+
+008008df <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	56                   	push   %esi
+  8008e3:	53                   	push   %ebx
+  8008e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008ea:	89 f3                	mov    %esi,%ebx
+  8008ec:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008ef:	89 f0                	mov    %esi,%eax
+  8008f1:	eb 0f                	jmp    800902 <strncpy+0x23>
+		*dst++ = *src;
+  8008f3:	83 c0 01             	add    $0x1,%eax
+  8008f6:	0f b6 0a             	movzbl (%edx),%ecx
+  8008f9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008fc:	80 f9 01             	cmp    $0x1,%cl
+  8008ff:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800902:	39 d8                	cmp    %ebx,%eax
+  800904:	75 ed                	jne    8008f3 <strncpy+0x14>
+	}
+	return ret;
+}
+  800906:	89 f0                	mov    %esi,%eax
+  800908:	5b                   	pop    %ebx
+  800909:	5e                   	pop    %esi
+  80090a:	5d                   	pop    %ebp
+  80090b:	c3                   	ret
+
+0080090c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80090c:	55                   	push   %ebp
+  80090d:	89 e5                	mov    %esp,%ebp
+  80090f:	56                   	push   %esi
+  800910:	53                   	push   %ebx
+  800911:	8b 75 08             	mov    0x8(%ebp),%esi
+  800914:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800917:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80091a:	89 f0                	mov    %esi,%eax
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	74 21                	je     800941 <strlcpy+0x35>
+  800920:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800924:	89 f2                	mov    %esi,%edx
+  800926:	eb 09                	jmp    800931 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800928:	83 c1 01             	add    $0x1,%ecx
+  80092b:	83 c2 01             	add    $0x1,%edx
+  80092e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800931:	39 c2                	cmp    %eax,%edx
+  800933:	74 09                	je     80093e <strlcpy+0x32>
+  800935:	0f b6 19             	movzbl (%ecx),%ebx
+  800938:	84 db                	test   %bl,%bl
+  80093a:	75 ec                	jne    800928 <strlcpy+0x1c>
+  80093c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80093e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800941:	29 f0                	sub    %esi,%eax
+}
+  800943:	5b                   	pop    %ebx
+  800944:	5e                   	pop    %esi
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800950:	eb 06                	jmp    800958 <strcmp+0x11>
+		p++, q++;
+  800952:	83 c1 01             	add    $0x1,%ecx
+  800955:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800958:	0f b6 01             	movzbl (%ecx),%eax
+  80095b:	84 c0                	test   %al,%al
+  80095d:	74 04                	je     800963 <strcmp+0x1c>
+  80095f:	3a 02                	cmp    (%edx),%al
+  800961:	74 ef                	je     800952 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800963:	0f b6 c0             	movzbl %al,%eax
+  800966:	0f b6 12             	movzbl (%edx),%edx
+  800969:	29 d0                	sub    %edx,%eax
+}
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	53                   	push   %ebx
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800977:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80097a:	eb 09                	jmp    800985 <strncmp+0x18>
+		n--, p++, q++;
+  80097c:	83 ea 01             	sub    $0x1,%edx
+  80097f:	83 c0 01             	add    $0x1,%eax
+  800982:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800985:	85 d2                	test   %edx,%edx
+  800987:	74 18                	je     8009a1 <strncmp+0x34>
+  800989:	0f b6 18             	movzbl (%eax),%ebx
+  80098c:	84 db                	test   %bl,%bl
+  80098e:	74 04                	je     800994 <strncmp+0x27>
+  800990:	3a 19                	cmp    (%ecx),%bl
+  800992:	74 e8                	je     80097c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800994:	0f b6 00             	movzbl (%eax),%eax
+  800997:	0f b6 11             	movzbl (%ecx),%edx
+  80099a:	29 d0                	sub    %edx,%eax
+}
+  80099c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099f:	c9                   	leave
+  8009a0:	c3                   	ret
+		return 0;
+  8009a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a6:	eb f4                	jmp    80099c <strncmp+0x2f>
+
+008009a8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ae:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b2:	eb 03                	jmp    8009b7 <strchr+0xf>
+  8009b4:	83 c0 01             	add    $0x1,%eax
+  8009b7:	0f b6 10             	movzbl (%eax),%edx
+  8009ba:	84 d2                	test   %dl,%dl
+  8009bc:	74 06                	je     8009c4 <strchr+0x1c>
+		if (*s == c)
+  8009be:	38 ca                	cmp    %cl,%dl
+  8009c0:	75 f2                	jne    8009b4 <strchr+0xc>
+  8009c2:	eb 05                	jmp    8009c9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009d5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009d8:	38 ca                	cmp    %cl,%dl
+  8009da:	74 09                	je     8009e5 <strfind+0x1a>
+  8009dc:	84 d2                	test   %dl,%dl
+  8009de:	74 05                	je     8009e5 <strfind+0x1a>
+	for (; *s; s++)
+  8009e0:	83 c0 01             	add    $0x1,%eax
+  8009e3:	eb f0                	jmp    8009d5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	57                   	push   %edi
+  8009eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009f1:	85 c9                	test   %ecx,%ecx
+  8009f3:	74 20                	je     800a15 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009f5:	89 f8                	mov    %edi,%eax
+  8009f7:	09 c8                	or     %ecx,%eax
+  8009f9:	a8 03                	test   $0x3,%al
+  8009fb:	75 12                	jne    800a0f <memset+0x28>
+		c &= 0xFF;
+  8009fd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a01:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a07:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a0a:	fc                   	cld
+  800a0b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a0d:	eb 06                	jmp    800a15 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a12:	fc                   	cld
+  800a13:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a15:	89 f8                	mov    %edi,%eax
+  800a17:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a1a:	c9                   	leave
+  800a1b:	c3                   	ret
+
+00800a1c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	57                   	push   %edi
+  800a20:	56                   	push   %esi
+  800a21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a24:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a27:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a2a:	39 c6                	cmp    %eax,%esi
+  800a2c:	73 32                	jae    800a60 <memmove+0x44>
+  800a2e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a31:	39 d0                	cmp    %edx,%eax
+  800a33:	73 2b                	jae    800a60 <memmove+0x44>
+		s += n;
+		d += n;
+  800a35:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a38:	89 d6                	mov    %edx,%esi
+  800a3a:	09 fe                	or     %edi,%esi
+  800a3c:	09 ce                	or     %ecx,%esi
+  800a3e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a44:	75 0e                	jne    800a54 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a46:	83 ef 04             	sub    $0x4,%edi
+  800a49:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a4c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a4f:	fd                   	std
+  800a50:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a52:	eb 09                	jmp    800a5d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a54:	83 ef 01             	sub    $0x1,%edi
+  800a57:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a5a:	fd                   	std
+  800a5b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a5d:	fc                   	cld
+  800a5e:	eb 1a                	jmp    800a7a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a60:	89 f2                	mov    %esi,%edx
+  800a62:	09 c2                	or     %eax,%edx
+  800a64:	09 ca                	or     %ecx,%edx
+  800a66:	f6 c2 03             	test   $0x3,%dl
+  800a69:	75 0a                	jne    800a75 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a6b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a6e:	89 c7                	mov    %eax,%edi
+  800a70:	fc                   	cld
+  800a71:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a73:	eb 05                	jmp    800a7a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a75:	89 c7                	mov    %eax,%edi
+  800a77:	fc                   	cld
+  800a78:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a7a:	5e                   	pop    %esi
+  800a7b:	5f                   	pop    %edi
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a84:	ff 75 10             	push   0x10(%ebp)
+  800a87:	ff 75 0c             	push   0xc(%ebp)
+  800a8a:	ff 75 08             	push   0x8(%ebp)
+  800a8d:	e8 8a ff ff ff       	call   800a1c <memmove>
+}
+  800a92:	c9                   	leave
+  800a93:	c3                   	ret
+
+00800a94 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	56                   	push   %esi
+  800a98:	53                   	push   %ebx
+  800a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a9f:	89 c6                	mov    %eax,%esi
+  800aa1:	03 75 10             	add    0x10(%ebp),%esi
+  800aa4:	eb 06                	jmp    800aac <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aa6:	83 c0 01             	add    $0x1,%eax
+  800aa9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aac:	39 f0                	cmp    %esi,%eax
+  800aae:	74 14                	je     800ac4 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ab0:	0f b6 08             	movzbl (%eax),%ecx
+  800ab3:	0f b6 1a             	movzbl (%edx),%ebx
+  800ab6:	38 d9                	cmp    %bl,%cl
+  800ab8:	74 ec                	je     800aa6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aba:	0f b6 c1             	movzbl %cl,%eax
+  800abd:	0f b6 db             	movzbl %bl,%ebx
+  800ac0:	29 d8                	sub    %ebx,%eax
+  800ac2:	eb 05                	jmp    800ac9 <memcmp+0x35>
+	}
+
+	return 0;
+  800ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5d                   	pop    %ebp
+  800acc:	c3                   	ret
+
+00800acd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ad6:	89 c2                	mov    %eax,%edx
+  800ad8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800adb:	eb 03                	jmp    800ae0 <memfind+0x13>
+  800add:	83 c0 01             	add    $0x1,%eax
+  800ae0:	39 d0                	cmp    %edx,%eax
+  800ae2:	73 04                	jae    800ae8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ae4:	38 08                	cmp    %cl,(%eax)
+  800ae6:	75 f5                	jne    800add <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	57                   	push   %edi
+  800aee:	56                   	push   %esi
+  800aef:	53                   	push   %ebx
+  800af0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800af6:	eb 03                	jmp    800afb <strtol+0x11>
+		s++;
+  800af8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800afb:	0f b6 02             	movzbl (%edx),%eax
+  800afe:	3c 20                	cmp    $0x20,%al
+  800b00:	74 f6                	je     800af8 <strtol+0xe>
+  800b02:	3c 09                	cmp    $0x9,%al
+  800b04:	74 f2                	je     800af8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b06:	3c 2b                	cmp    $0x2b,%al
+  800b08:	74 2a                	je     800b34 <strtol+0x4a>
+	int neg = 0;
+  800b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b0f:	3c 2d                	cmp    $0x2d,%al
+  800b11:	74 2b                	je     800b3e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b13:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b19:	75 0f                	jne    800b2a <strtol+0x40>
+  800b1b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b1e:	74 28                	je     800b48 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b20:	85 db                	test   %ebx,%ebx
+  800b22:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b27:	0f 44 d8             	cmove  %eax,%ebx
+  800b2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b32:	eb 46                	jmp    800b7a <strtol+0x90>
+		s++;
+  800b34:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b3c:	eb d5                	jmp    800b13 <strtol+0x29>
+		s++, neg = 1;
+  800b3e:	83 c2 01             	add    $0x1,%edx
+  800b41:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b46:	eb cb                	jmp    800b13 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b48:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b4c:	74 0e                	je     800b5c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b4e:	85 db                	test   %ebx,%ebx
+  800b50:	75 d8                	jne    800b2a <strtol+0x40>
+		s++, base = 8;
+  800b52:	83 c2 01             	add    $0x1,%edx
+  800b55:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b5a:	eb ce                	jmp    800b2a <strtol+0x40>
+		s += 2, base = 16;
+  800b5c:	83 c2 02             	add    $0x2,%edx
+  800b5f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b64:	eb c4                	jmp    800b2a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b66:	0f be c0             	movsbl %al,%eax
+  800b69:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b6c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b6f:	7d 3a                	jge    800bab <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b71:	83 c2 01             	add    $0x1,%edx
+  800b74:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b78:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b7a:	0f b6 02             	movzbl (%edx),%eax
+  800b7d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b80:	89 f3                	mov    %esi,%ebx
+  800b82:	80 fb 09             	cmp    $0x9,%bl
+  800b85:	76 df                	jbe    800b66 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b87:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b8a:	89 f3                	mov    %esi,%ebx
+  800b8c:	80 fb 19             	cmp    $0x19,%bl
+  800b8f:	77 08                	ja     800b99 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b91:	0f be c0             	movsbl %al,%eax
+  800b94:	83 e8 57             	sub    $0x57,%eax
+  800b97:	eb d3                	jmp    800b6c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b99:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b9c:	89 f3                	mov    %esi,%ebx
+  800b9e:	80 fb 19             	cmp    $0x19,%bl
+  800ba1:	77 08                	ja     800bab <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ba3:	0f be c0             	movsbl %al,%eax
+  800ba6:	83 e8 37             	sub    $0x37,%eax
+  800ba9:	eb c1                	jmp    800b6c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800baf:	74 05                	je     800bb6 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bb6:	89 c8                	mov    %ecx,%eax
+  800bb8:	f7 d8                	neg    %eax
+  800bba:	85 ff                	test   %edi,%edi
+  800bbc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bbf:	89 c8                	mov    %ecx,%eax
+  800bc1:	5b                   	pop    %ebx
+  800bc2:	5e                   	pop    %esi
+  800bc3:	5f                   	pop    %edi
+  800bc4:	5d                   	pop    %ebp
+  800bc5:	c3                   	ret
+
+00800bc6 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800bc6:	55                   	push   %ebp
+  800bc7:	89 e5                	mov    %esp,%ebp
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800bcc:	6a 00                	push   $0x0
+  800bce:	6a 00                	push   $0x0
+  800bd0:	ff 75 08             	push   0x8(%ebp)
+  800bd3:	e8 12 ff ff ff       	call   800aea <strtol>
+}
+  800bd8:	c9                   	leave
+  800bd9:	c3                   	ret
+
+00800bda <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bda:	55                   	push   %ebp
+  800bdb:	89 e5                	mov    %esp,%ebp
+  800bdd:	57                   	push   %edi
+  800bde:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bea:	89 c3                	mov    %eax,%ebx
+  800bec:	89 c7                	mov    %eax,%edi
+  800bee:	6a 00                	push   $0x0
+  800bf0:	55                   	push   %ebp
+  800bf1:	56                   	push   %esi
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	8d 35 fc 0b 80 00    	lea    0x800bfc,%esi
+  800bfa:	0f 34                	sysenter
+
+00800bfc <after_sysenter_label_47>:
+  800bfc:	5e                   	pop    %esi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c01:	5b                   	pop    %ebx
+  800c02:	5f                   	pop    %edi
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+
+00800c05 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c14:	89 d1                	mov    %edx,%ecx
+  800c16:	89 d3                	mov    %edx,%ebx
+  800c18:	89 d7                	mov    %edx,%edi
+  800c1a:	6a 00                	push   $0x0
+  800c1c:	55                   	push   %ebp
+  800c1d:	56                   	push   %esi
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	8d 35 28 0c 80 00    	lea    0x800c28,%esi
+  800c26:	0f 34                	sysenter
+
+00800c28 <after_sysenter_label_128>:
+  800c28:	5e                   	pop    %esi
+  800c29:	5d                   	pop    %ebp
+  800c2a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5f                   	pop    %edi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+
+00800c31 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	57                   	push   %edi
+  800c35:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c43:	89 cb                	mov    %ecx,%ebx
+  800c45:	89 cf                	mov    %ecx,%edi
+  800c47:	6a 00                	push   $0x0
+  800c49:	55                   	push   %ebp
+  800c4a:	56                   	push   %esi
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	8d 35 55 0c 80 00    	lea    0x800c55,%esi
+  800c53:	0f 34                	sysenter
+
+00800c55 <after_sysenter_label_212>:
+  800c55:	5e                   	pop    %esi
+  800c56:	5d                   	pop    %ebp
+  800c57:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c5a:	85 c0                	test   %eax,%eax
+  800c5c:	7f 07                	jg     800c65 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c61:	5b                   	pop    %ebx
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+  800c68:	50                   	push   %eax
+  800c69:	6a 03                	push   $0x3
+  800c6b:	68 55 52 80 00       	push   $0x805255
+  800c70:	6a 54                	push   $0x54
+  800c72:	68 72 52 80 00       	push   $0x805272
+  800c77:	e8 5b f5 ff ff       	call   8001d7 <_panic>
+
+00800c7c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	57                   	push   %edi
+  800c80:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c86:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c8b:	89 d1                	mov    %edx,%ecx
+  800c8d:	89 d3                	mov    %edx,%ebx
+  800c8f:	89 d7                	mov    %edx,%edi
+  800c91:	6a 00                	push   $0x0
+  800c93:	55                   	push   %ebp
+  800c94:	56                   	push   %esi
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	8d 35 9f 0c 80 00    	lea    0x800c9f,%esi
+  800c9d:	0f 34                	sysenter
+
+00800c9f <after_sysenter_label_309>:
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ca4:	5b                   	pop    %ebx
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+
+00800ca8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cb7:	89 d1                	mov    %edx,%ecx
+  800cb9:	89 d3                	mov    %edx,%ebx
+  800cbb:	89 d7                	mov    %edx,%edi
+  800cbd:	6a 00                	push   $0x0
+  800cbf:	55                   	push   %ebp
+  800cc0:	56                   	push   %esi
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	8d 35 cb 0c 80 00    	lea    0x800ccb,%esi
+  800cc9:	0f 34                	sysenter
+
+00800ccb <after_sysenter_label_391>:
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5d                   	pop    %ebp
+  800ccd:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+
+00800cd4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ce9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cec:	6a 00                	push   $0x0
+  800cee:	55                   	push   %ebp
+  800cef:	56                   	push   %esi
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	8d 35 fa 0c 80 00    	lea    0x800cfa,%esi
+  800cf8:	0f 34                	sysenter
+
+00800cfa <after_sysenter_label_479>:
+  800cfa:	5e                   	pop    %esi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cff:	85 c0                	test   %eax,%eax
+  800d01:	7f 07                	jg     800d0a <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d06:	5b                   	pop    %ebx
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  800d0d:	50                   	push   %eax
+  800d0e:	6a 04                	push   $0x4
+  800d10:	68 55 52 80 00       	push   $0x805255
+  800d15:	6a 54                	push   $0x54
+  800d17:	68 72 52 80 00       	push   $0x805272
+  800d1c:	e8 b6 f4 ff ff       	call   8001d7 <_panic>
+
+00800d21 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d37:	ff 75 18             	push   0x18(%ebp)
+  800d3a:	55                   	push   %ebp
+  800d3b:	56                   	push   %esi
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	8d 35 46 0d 80 00    	lea    0x800d46,%esi
+  800d44:	0f 34                	sysenter
+
+00800d46 <after_sysenter_label_593>:
+  800d46:	5e                   	pop    %esi
+  800d47:	5d                   	pop    %ebp
+  800d48:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d4b:	85 c0                	test   %eax,%eax
+  800d4d:	7f 07                	jg     800d56 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d52:	5b                   	pop    %ebx
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  800d59:	50                   	push   %eax
+  800d5a:	6a 05                	push   $0x5
+  800d5c:	68 55 52 80 00       	push   $0x805255
+  800d61:	6a 54                	push   $0x54
+  800d63:	68 72 52 80 00       	push   $0x805272
+  800d68:	e8 6a f4 ff ff       	call   8001d7 <_panic>
+
+00800d6d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d82:	89 df                	mov    %ebx,%edi
+  800d84:	6a 00                	push   $0x0
+  800d86:	55                   	push   %ebp
+  800d87:	56                   	push   %esi
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	8d 35 92 0d 80 00    	lea    0x800d92,%esi
+  800d90:	0f 34                	sysenter
+
+00800d92 <after_sysenter_label_704>:
+  800d92:	5e                   	pop    %esi
+  800d93:	5d                   	pop    %ebp
+  800d94:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	7f 07                	jg     800da2 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	50                   	push   %eax
+  800da6:	6a 06                	push   $0x6
+  800da8:	68 55 52 80 00       	push   $0x805255
+  800dad:	6a 54                	push   $0x54
+  800daf:	68 72 52 80 00       	push   $0x805272
+  800db4:	e8 1e f4 ff ff       	call   8001d7 <_panic>
+
+00800db9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dce:	89 df                	mov    %ebx,%edi
+  800dd0:	6a 00                	push   $0x0
+  800dd2:	55                   	push   %ebp
+  800dd3:	56                   	push   %esi
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	8d 35 de 0d 80 00    	lea    0x800dde,%esi
+  800ddc:	0f 34                	sysenter
+
+00800dde <after_sysenter_label_808>:
+  800dde:	5e                   	pop    %esi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de3:	85 c0                	test   %eax,%eax
+  800de5:	7f 07                	jg     800dee <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800de7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dea:	5b                   	pop    %ebx
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 08                	push   $0x8
+  800df4:	68 55 52 80 00       	push   $0x805255
+  800df9:	6a 54                	push   $0x54
+  800dfb:	68 72 52 80 00       	push   $0x805272
+  800e00:	e8 d2 f3 ff ff       	call   8001d7 <_panic>
+
+00800e05 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e15:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e1a:	89 df                	mov    %ebx,%edi
+  800e1c:	6a 00                	push   $0x0
+  800e1e:	55                   	push   %ebp
+  800e1f:	56                   	push   %esi
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	8d 35 2a 0e 80 00    	lea    0x800e2a,%esi
+  800e28:	0f 34                	sysenter
+
+00800e2a <after_sysenter_label_912>:
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e2f:	85 c0                	test   %eax,%eax
+  800e31:	7f 07                	jg     800e3a <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e36:	5b                   	pop    %ebx
+  800e37:	5f                   	pop    %edi
+  800e38:	5d                   	pop    %ebp
+  800e39:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+  800e3d:	50                   	push   %eax
+  800e3e:	6a 09                	push   $0x9
+  800e40:	68 55 52 80 00       	push   $0x805255
+  800e45:	6a 54                	push   $0x54
+  800e47:	68 72 52 80 00       	push   $0x805272
+  800e4c:	e8 86 f3 ff ff       	call   8001d7 <_panic>
+
+00800e51 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e66:	89 df                	mov    %ebx,%edi
+  800e68:	6a 00                	push   $0x0
+  800e6a:	55                   	push   %ebp
+  800e6b:	56                   	push   %esi
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	8d 35 76 0e 80 00    	lea    0x800e76,%esi
+  800e74:	0f 34                	sysenter
+
+00800e76 <after_sysenter_label_1016>:
+  800e76:	5e                   	pop    %esi
+  800e77:	5d                   	pop    %ebp
+  800e78:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	7f 07                	jg     800e86 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e82:	5b                   	pop    %ebx
+  800e83:	5f                   	pop    %edi
+  800e84:	5d                   	pop    %ebp
+  800e85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e86:	83 ec 0c             	sub    $0xc,%esp
+  800e89:	50                   	push   %eax
+  800e8a:	6a 0a                	push   $0xa
+  800e8c:	68 55 52 80 00       	push   $0x805255
+  800e91:	6a 54                	push   $0x54
+  800e93:	68 72 52 80 00       	push   $0x805272
+  800e98:	e8 3a f3 ff ff       	call   8001d7 <_panic>
+
+00800e9d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	57                   	push   %edi
+  800ea1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ead:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eb3:	6a 00                	push   $0x0
+  800eb5:	55                   	push   %ebp
+  800eb6:	56                   	push   %esi
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	8d 35 c1 0e 80 00    	lea    0x800ec1,%esi
+  800ebf:	0f 34                	sysenter
+
+00800ec1 <after_sysenter_label_1126>:
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ec6:	5b                   	pop    %ebx
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800edc:	89 cb                	mov    %ecx,%ebx
+  800ede:	89 cf                	mov    %ecx,%edi
+  800ee0:	6a 00                	push   $0x0
+  800ee2:	55                   	push   %ebp
+  800ee3:	56                   	push   %esi
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	8d 35 ee 0e 80 00    	lea    0x800eee,%esi
+  800eec:	0f 34                	sysenter
+
+00800eee <after_sysenter_label_1210>:
+  800eee:	5e                   	pop    %esi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	7f 07                	jg     800efe <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ef7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800efa:	5b                   	pop    %ebx
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	6a 0d                	push   $0xd
+  800f04:	68 55 52 80 00       	push   $0x805255
+  800f09:	6a 54                	push   $0x54
+  800f0b:	68 72 52 80 00       	push   $0x805272
+  800f10:	e8 c2 f2 ff ff       	call   8001d7 <_panic>
+
+00800f15 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f25:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f2a:	89 df                	mov    %ebx,%edi
+  800f2c:	6a 00                	push   $0x0
+  800f2e:	55                   	push   %ebp
+  800f2f:	56                   	push   %esi
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	8d 35 3a 0f 80 00    	lea    0x800f3a,%esi
+  800f38:	0f 34                	sysenter
+
+00800f3a <after_sysenter_label_1311>:
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 07                	jg     800f4a <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	50                   	push   %eax
+  800f4e:	6a 42                	push   $0x42
+  800f50:	68 55 52 80 00       	push   $0x805255
+  800f55:	6a 54                	push   $0x54
+  800f57:	68 72 52 80 00       	push   $0x805272
+  800f5c:	e8 76 f2 ff ff       	call   8001d7 <_panic>
+
+00800f61 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f70:	89 d1                	mov    %edx,%ecx
+  800f72:	89 d3                	mov    %edx,%ebx
+  800f74:	89 d7                	mov    %edx,%edi
+  800f76:	6a 00                	push   $0x0
+  800f78:	55                   	push   %ebp
+  800f79:	56                   	push   %esi
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	8d 35 84 0f 80 00    	lea    0x800f84,%esi
+  800f82:	0f 34                	sysenter
+
+00800f84 <after_sysenter_label_1411>:
+  800f84:	5e                   	pop    %esi
+  800f85:	5d                   	pop    %ebp
+  800f86:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa2:	89 df                	mov    %ebx,%edi
+  800fa4:	6a 00                	push   $0x0
+  800fa6:	55                   	push   %ebp
+  800fa7:	56                   	push   %esi
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	8d 35 b2 0f 80 00    	lea    0x800fb2,%esi
+  800fb0:	0f 34                	sysenter
+
+00800fb2 <after_sysenter_label_1497>:
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+
+00800fbb <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	6a 00                	push   $0x0
+  800fd4:	55                   	push   %ebp
+  800fd5:	56                   	push   %esi
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	8d 35 e0 0f 80 00    	lea    0x800fe0,%esi
+  800fde:	0f 34                	sysenter
+
+00800fe0 <after_sysenter_label_1583>:
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+
+00800fe9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	57                   	push   %edi
+  800fed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff4:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ff9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801001:	6a 00                	push   $0x0
+  801003:	55                   	push   %ebp
+  801004:	56                   	push   %esi
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	8d 35 0f 10 80 00    	lea    0x80100f,%esi
+  80100d:	0f 34                	sysenter
+
+0080100f <after_sysenter_label_1672>:
+  80100f:	5e                   	pop    %esi
+  801010:	5d                   	pop    %ebp
+  801011:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+
+00801018 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80101d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	b8 12 00 00 00       	mov    $0x12,%eax
+  80102d:	89 df                	mov    %ebx,%edi
+  80102f:	6a 00                	push   $0x0
+  801031:	55                   	push   %ebp
+  801032:	56                   	push   %esi
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	8d 35 3d 10 80 00    	lea    0x80103d,%esi
+  80103b:	0f 34                	sysenter
+
+0080103d <after_sysenter_label_1758>:
+  80103d:	5e                   	pop    %esi
+  80103e:	5d                   	pop    %ebp
+  80103f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801042:	5b                   	pop    %ebx
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801053:	b8 13 00 00 00       	mov    $0x13,%eax
+  801058:	89 cb                	mov    %ecx,%ebx
+  80105a:	89 cf                	mov    %ecx,%edi
+  80105c:	6a 00                	push   $0x0
+  80105e:	55                   	push   %ebp
+  80105f:	56                   	push   %esi
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	8d 35 6a 10 80 00    	lea    0x80106a,%esi
+  801068:	0f 34                	sysenter
+
+0080106a <after_sysenter_label_1842>:
+  80106a:	5e                   	pop    %esi
+  80106b:	5d                   	pop    %ebp
+  80106c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	7f 07                	jg     80107a <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801073:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801076:	5b                   	pop    %ebx
+  801077:	5f                   	pop    %edi
+  801078:	5d                   	pop    %ebp
+  801079:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  80107d:	50                   	push   %eax
+  80107e:	6a 13                	push   $0x13
+  801080:	68 55 52 80 00       	push   $0x805255
+  801085:	6a 54                	push   $0x54
+  801087:	68 72 52 80 00       	push   $0x805272
+  80108c:	e8 46 f1 ff ff       	call   8001d7 <_panic>
+
+00801091 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801096:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109b:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010a0:	89 d1                	mov    %edx,%ecx
+  8010a2:	89 d3                	mov    %edx,%ebx
+  8010a4:	89 d7                	mov    %edx,%edi
+  8010a6:	6a 00                	push   $0x0
+  8010a8:	55                   	push   %ebp
+  8010a9:	56                   	push   %esi
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	8d 35 b4 10 80 00    	lea    0x8010b4,%esi
+  8010b2:	0f 34                	sysenter
+
+008010b4 <after_sysenter_label_1939>:
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010b9:	5b                   	pop    %ebx
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+
+008010bd <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d5:	6a 00                	push   $0x0
+  8010d7:	55                   	push   %ebp
+  8010d8:	56                   	push   %esi
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	8d 35 e3 10 80 00    	lea    0x8010e3,%esi
+  8010e1:	0f 34                	sysenter
+
+008010e3 <after_sysenter_label_2028>:
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8010e8:	5b                   	pop    %ebx
+  8010e9:	5f                   	pop    %edi
+  8010ea:	5d                   	pop    %ebp
+  8010eb:	c3                   	ret
+
+008010ec <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	57                   	push   %edi
+  8010f0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fc:	b8 16 00 00 00       	mov    $0x16,%eax
+  801101:	89 df                	mov    %ebx,%edi
+  801103:	6a 00                	push   $0x0
+  801105:	55                   	push   %ebp
+  801106:	56                   	push   %esi
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	8d 35 11 11 80 00    	lea    0x801111,%esi
+  80110f:	0f 34                	sysenter
+
+00801111 <after_sysenter_label_2114>:
+  801111:	5e                   	pop    %esi
+  801112:	5d                   	pop    %ebp
+  801113:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801116:	5b                   	pop    %ebx
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+
+0080111a <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80111f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80112f:	89 df                	mov    %ebx,%edi
+  801131:	6a 00                	push   $0x0
+  801133:	55                   	push   %ebp
+  801134:	56                   	push   %esi
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	8d 35 3f 11 80 00    	lea    0x80113f,%esi
+  80113d:	0f 34                	sysenter
+
+0080113f <after_sysenter_label_2200>:
+  80113f:	5e                   	pop    %esi
+  801140:	5d                   	pop    %ebp
+  801141:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801144:	5b                   	pop    %ebx
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	8b 55 08             	mov    0x8(%ebp),%edx
+  801155:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801158:	b8 18 00 00 00       	mov    $0x18,%eax
+  80115d:	89 df                	mov    %ebx,%edi
+  80115f:	6a 00                	push   $0x0
+  801161:	55                   	push   %ebp
+  801162:	56                   	push   %esi
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+
+0080116d <after_sysenter_label_2286>:
+  80116d:	5e                   	pop    %esi
+  80116e:	5d                   	pop    %ebp
+  80116f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801172:	5b                   	pop    %ebx
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+
+00801176 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801179:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801181:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801184:	5d                   	pop    %ebp
+  801185:	c3                   	ret
+
+00801186 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801191:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801196:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011a0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011a5:	eb 02                	jmp    8011a9 <fd_alloc+0xc>
+  8011a7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011a9:	89 c2                	mov    %eax,%edx
+  8011ab:	c1 ea 16             	shr    $0x16,%edx
+  8011ae:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011b5:	f6 c2 01             	test   $0x1,%dl
+  8011b8:	74 2b                	je     8011e5 <fd_alloc+0x48>
+  8011ba:	89 c2                	mov    %eax,%edx
+  8011bc:	c1 ea 0c             	shr    $0xc,%edx
+  8011bf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011c6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011cc:	f6 c1 01             	test   $0x1,%cl
+  8011cf:	74 14                	je     8011e5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011d1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011d7:	75 ce                	jne    8011a7 <fd_alloc+0xa>
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011de:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011e3:	eb 05                	jmp    8011ea <fd_alloc+0x4d>
+			return 0;
+  8011e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	89 02                	mov    %eax,(%edx)
+}
+  8011ef:	89 c8                	mov    %ecx,%eax
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+
+008011f3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011f9:	83 f8 1f             	cmp    $0x1f,%eax
+  8011fc:	77 30                	ja     80122e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011fe:	c1 e0 0c             	shl    $0xc,%eax
+  801201:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801206:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80120c:	f6 c2 01             	test   $0x1,%dl
+  80120f:	74 24                	je     801235 <fd_lookup+0x42>
+  801211:	89 c2                	mov    %eax,%edx
+  801213:	c1 ea 0c             	shr    $0xc,%edx
+  801216:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80121d:	f6 c2 01             	test   $0x1,%dl
+  801220:	74 1a                	je     80123c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801222:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801225:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801227:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+		return -E_INVAL;
+  80122e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801233:	eb f7                	jmp    80122c <fd_lookup+0x39>
+		return -E_INVAL;
+  801235:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80123a:	eb f0                	jmp    80122c <fd_lookup+0x39>
+  80123c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801241:	eb e9                	jmp    80122c <fd_lookup+0x39>
+
+00801243 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	53                   	push   %ebx
+  801247:	83 ec 04             	sub    $0x4,%esp
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80124d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801252:	eb 03                	jmp    801257 <dev_lookup+0x14>
+  801254:	83 c0 01             	add    $0x1,%eax
+  801257:	8b 1c 85 fc 52 80 00 	mov    0x8052fc(,%eax,4),%ebx
+  80125e:	85 db                	test   %ebx,%ebx
+  801260:	74 0b                	je     80126d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801262:	39 13                	cmp    %edx,(%ebx)
+  801264:	75 ee                	jne    801254 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126b:	eb 49                	jmp    8012b6 <dev_lookup+0x73>
+  80126d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80126f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801275:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80127a:	77 18                	ja     801294 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80127c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801281:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801283:	c1 e8 10             	shr    $0x10,%eax
+  801286:	74 0c                	je     801294 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801288:	c1 e0 10             	shl    $0x10,%eax
+  80128b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801290:	29 c1                	sub    %eax,%ecx
+  801292:	eb 06                	jmp    80129a <dev_lookup+0x57>
+		return pthread_main_tls;
+  801294:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80129a:	8b 01                	mov    (%ecx),%eax
+  80129c:	8b 40 48             	mov    0x48(%eax),%eax
+  80129f:	83 ec 04             	sub    $0x4,%esp
+  8012a2:	52                   	push   %edx
+  8012a3:	50                   	push   %eax
+  8012a4:	68 80 52 80 00       	push   $0x805280
+  8012a9:	e8 04 f0 ff ff       	call   8002b2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012ae:	83 c4 10             	add    $0x10,%esp
+  8012b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b9:	89 1a                	mov    %ebx,(%edx)
+}
+  8012bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+
+008012c0 <fd_close>:
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	56                   	push   %esi
+  8012c5:	53                   	push   %ebx
+  8012c6:	83 ec 24             	sub    $0x24,%esp
+  8012c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012cf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012d2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012d3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012d9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012dc:	50                   	push   %eax
+  8012dd:	e8 11 ff ff ff       	call   8011f3 <fd_lookup>
+  8012e2:	89 c3                	mov    %eax,%ebx
+  8012e4:	83 c4 10             	add    $0x10,%esp
+  8012e7:	85 c0                	test   %eax,%eax
+  8012e9:	78 05                	js     8012f0 <fd_close+0x30>
+	    || fd != fd2)
+  8012eb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012ee:	74 16                	je     801306 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012f0:	89 f8                	mov    %edi,%eax
+  8012f2:	84 c0                	test   %al,%al
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012fc:	89 d8                	mov    %ebx,%eax
+  8012fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801306:	83 ec 08             	sub    $0x8,%esp
+  801309:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80130c:	50                   	push   %eax
+  80130d:	ff 36                	push   (%esi)
+  80130f:	e8 2f ff ff ff       	call   801243 <dev_lookup>
+  801314:	89 c3                	mov    %eax,%ebx
+  801316:	83 c4 10             	add    $0x10,%esp
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	78 1a                	js     801337 <fd_close+0x77>
+		if (dev->dev_close)
+  80131d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801320:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	74 0b                	je     801337 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+  80132f:	56                   	push   %esi
+  801330:	ff d0                	call   *%eax
+  801332:	89 c3                	mov    %eax,%ebx
+  801334:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801337:	83 ec 08             	sub    $0x8,%esp
+  80133a:	56                   	push   %esi
+  80133b:	6a 00                	push   $0x0
+  80133d:	e8 2b fa ff ff       	call   800d6d <sys_page_unmap>
+	return r;
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	eb b5                	jmp    8012fc <fd_close+0x3c>
+
+00801347 <close>:
+
+int
+close(int fdnum)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80134d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801350:	50                   	push   %eax
+  801351:	ff 75 08             	push   0x8(%ebp)
+  801354:	e8 9a fe ff ff       	call   8011f3 <fd_lookup>
+  801359:	83 c4 10             	add    $0x10,%esp
+  80135c:	85 c0                	test   %eax,%eax
+  80135e:	79 02                	jns    801362 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801360:	c9                   	leave
+  801361:	c3                   	ret
+		return fd_close(fd, 1);
+  801362:	83 ec 08             	sub    $0x8,%esp
+  801365:	6a 01                	push   $0x1
+  801367:	ff 75 f4             	push   -0xc(%ebp)
+  80136a:	e8 51 ff ff ff       	call   8012c0 <fd_close>
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	eb ec                	jmp    801360 <close+0x19>
+
+00801374 <close_all>:
+
+void
+close_all(void)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	53                   	push   %ebx
+  801378:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80137b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	53                   	push   %ebx
+  801384:	e8 be ff ff ff       	call   801347 <close>
+	for (i = 0; i < MAXFD; i++)
+  801389:	83 c3 01             	add    $0x1,%ebx
+  80138c:	83 c4 10             	add    $0x10,%esp
+  80138f:	83 fb 20             	cmp    $0x20,%ebx
+  801392:	75 ec                	jne    801380 <close_all+0xc>
+}
+  801394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801397:	c9                   	leave
+  801398:	c3                   	ret
+
+00801399 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	57                   	push   %edi
+  80139d:	56                   	push   %esi
+  80139e:	53                   	push   %ebx
+  80139f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013a5:	50                   	push   %eax
+  8013a6:	ff 75 08             	push   0x8(%ebp)
+  8013a9:	e8 45 fe ff ff       	call   8011f3 <fd_lookup>
+  8013ae:	89 c3                	mov    %eax,%ebx
+  8013b0:	83 c4 10             	add    $0x10,%esp
+  8013b3:	85 c0                	test   %eax,%eax
+  8013b5:	78 7f                	js     801436 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013b7:	83 ec 0c             	sub    $0xc,%esp
+  8013ba:	ff 75 0c             	push   0xc(%ebp)
+  8013bd:	e8 85 ff ff ff       	call   801347 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013c5:	c1 e6 0c             	shl    $0xc,%esi
+  8013c8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013d1:	89 3c 24             	mov    %edi,(%esp)
+  8013d4:	e8 ad fd ff ff       	call   801186 <fd2data>
+  8013d9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013db:	89 34 24             	mov    %esi,(%esp)
+  8013de:	e8 a3 fd ff ff       	call   801186 <fd2data>
+  8013e3:	83 c4 10             	add    $0x10,%esp
+  8013e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013e9:	89 d8                	mov    %ebx,%eax
+  8013eb:	c1 e8 16             	shr    $0x16,%eax
+  8013ee:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013f5:	a8 01                	test   $0x1,%al
+  8013f7:	74 11                	je     80140a <dup+0x71>
+  8013f9:	89 d8                	mov    %ebx,%eax
+  8013fb:	c1 e8 0c             	shr    $0xc,%eax
+  8013fe:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801405:	f6 c2 01             	test   $0x1,%dl
+  801408:	75 36                	jne    801440 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80140a:	89 f8                	mov    %edi,%eax
+  80140c:	c1 e8 0c             	shr    $0xc,%eax
+  80140f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801416:	83 ec 0c             	sub    $0xc,%esp
+  801419:	25 07 0e 00 00       	and    $0xe07,%eax
+  80141e:	50                   	push   %eax
+  80141f:	56                   	push   %esi
+  801420:	6a 00                	push   $0x0
+  801422:	57                   	push   %edi
+  801423:	6a 00                	push   $0x0
+  801425:	e8 f7 f8 ff ff       	call   800d21 <sys_page_map>
+  80142a:	89 c3                	mov    %eax,%ebx
+  80142c:	83 c4 20             	add    $0x20,%esp
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	78 33                	js     801466 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801433:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801436:	89 d8                	mov    %ebx,%eax
+  801438:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143b:	5b                   	pop    %ebx
+  80143c:	5e                   	pop    %esi
+  80143d:	5f                   	pop    %edi
+  80143e:	5d                   	pop    %ebp
+  80143f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801440:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80144f:	50                   	push   %eax
+  801450:	ff 75 d4             	push   -0x2c(%ebp)
+  801453:	6a 00                	push   $0x0
+  801455:	53                   	push   %ebx
+  801456:	6a 00                	push   $0x0
+  801458:	e8 c4 f8 ff ff       	call   800d21 <sys_page_map>
+  80145d:	89 c3                	mov    %eax,%ebx
+  80145f:	83 c4 20             	add    $0x20,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	79 a4                	jns    80140a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801466:	83 ec 08             	sub    $0x8,%esp
+  801469:	56                   	push   %esi
+  80146a:	6a 00                	push   $0x0
+  80146c:	e8 fc f8 ff ff       	call   800d6d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801471:	83 c4 08             	add    $0x8,%esp
+  801474:	ff 75 d4             	push   -0x2c(%ebp)
+  801477:	6a 00                	push   $0x0
+  801479:	e8 ef f8 ff ff       	call   800d6d <sys_page_unmap>
+	return r;
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	eb b3                	jmp    801436 <dup+0x9d>
+
+00801483 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	56                   	push   %esi
+  801487:	53                   	push   %ebx
+  801488:	83 ec 18             	sub    $0x18,%esp
+  80148b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80148e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801491:	50                   	push   %eax
+  801492:	53                   	push   %ebx
+  801493:	e8 5b fd ff ff       	call   8011f3 <fd_lookup>
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	85 c0                	test   %eax,%eax
+  80149d:	78 3c                	js     8014db <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80149f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014a2:	83 ec 08             	sub    $0x8,%esp
+  8014a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a8:	50                   	push   %eax
+  8014a9:	ff 36                	push   (%esi)
+  8014ab:	e8 93 fd ff ff       	call   801243 <dev_lookup>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	78 24                	js     8014db <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014b7:	8b 46 08             	mov    0x8(%esi),%eax
+  8014ba:	83 e0 03             	and    $0x3,%eax
+  8014bd:	83 f8 01             	cmp    $0x1,%eax
+  8014c0:	74 20                	je     8014e2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014c5:	8b 40 08             	mov    0x8(%eax),%eax
+  8014c8:	85 c0                	test   %eax,%eax
+  8014ca:	74 61                	je     80152d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014cc:	83 ec 04             	sub    $0x4,%esp
+  8014cf:	ff 75 10             	push   0x10(%ebp)
+  8014d2:	ff 75 0c             	push   0xc(%ebp)
+  8014d5:	56                   	push   %esi
+  8014d6:	ff d0                	call   *%eax
+  8014d8:	83 c4 10             	add    $0x10,%esp
+}
+  8014db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5d                   	pop    %ebp
+  8014e1:	c3                   	ret
+  8014e2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014e4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014ea:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014ef:	77 18                	ja     801509 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014f1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014f6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014f8:	c1 e8 10             	shr    $0x10,%eax
+  8014fb:	74 0c                	je     801509 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014fd:	c1 e0 10             	shl    $0x10,%eax
+  801500:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801505:	29 c2                	sub    %eax,%edx
+  801507:	eb 06                	jmp    80150f <read+0x8c>
+		return pthread_main_tls;
+  801509:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80150f:	8b 02                	mov    (%edx),%eax
+  801511:	8b 40 48             	mov    0x48(%eax),%eax
+  801514:	83 ec 04             	sub    $0x4,%esp
+  801517:	53                   	push   %ebx
+  801518:	50                   	push   %eax
+  801519:	68 c1 52 80 00       	push   $0x8052c1
+  80151e:	e8 8f ed ff ff       	call   8002b2 <cprintf>
+		return -E_INVAL;
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152b:	eb ae                	jmp    8014db <read+0x58>
+		return -E_NOT_SUPP;
+  80152d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801532:	eb a7                	jmp    8014db <read+0x58>
+
+00801534 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	57                   	push   %edi
+  801538:	56                   	push   %esi
+  801539:	53                   	push   %ebx
+  80153a:	83 ec 0c             	sub    $0xc,%esp
+  80153d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801540:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801548:	eb 02                	jmp    80154c <readn+0x18>
+  80154a:	01 c3                	add    %eax,%ebx
+  80154c:	39 f3                	cmp    %esi,%ebx
+  80154e:	73 21                	jae    801571 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801550:	83 ec 04             	sub    $0x4,%esp
+  801553:	89 f0                	mov    %esi,%eax
+  801555:	29 d8                	sub    %ebx,%eax
+  801557:	50                   	push   %eax
+  801558:	89 d8                	mov    %ebx,%eax
+  80155a:	03 45 0c             	add    0xc(%ebp),%eax
+  80155d:	50                   	push   %eax
+  80155e:	57                   	push   %edi
+  80155f:	e8 1f ff ff ff       	call   801483 <read>
+		if (m < 0)
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	85 c0                	test   %eax,%eax
+  801569:	78 04                	js     80156f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80156b:	75 dd                	jne    80154a <readn+0x16>
+  80156d:	eb 02                	jmp    801571 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80156f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801571:	89 d8                	mov    %ebx,%eax
+  801573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801576:	5b                   	pop    %ebx
+  801577:	5e                   	pop    %esi
+  801578:	5f                   	pop    %edi
+  801579:	5d                   	pop    %ebp
+  80157a:	c3                   	ret
+
+0080157b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	56                   	push   %esi
+  80157f:	53                   	push   %ebx
+  801580:	83 ec 18             	sub    $0x18,%esp
+  801583:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801586:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801589:	50                   	push   %eax
+  80158a:	53                   	push   %ebx
+  80158b:	e8 63 fc ff ff       	call   8011f3 <fd_lookup>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 37                	js     8015ce <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801597:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80159a:	83 ec 08             	sub    $0x8,%esp
+  80159d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a0:	50                   	push   %eax
+  8015a1:	ff 36                	push   (%esi)
+  8015a3:	e8 9b fc ff ff       	call   801243 <dev_lookup>
+  8015a8:	83 c4 10             	add    $0x10,%esp
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	78 1f                	js     8015ce <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015af:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015b3:	74 20                	je     8015d5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	74 61                	je     801620 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015bf:	83 ec 04             	sub    $0x4,%esp
+  8015c2:	ff 75 10             	push   0x10(%ebp)
+  8015c5:	ff 75 0c             	push   0xc(%ebp)
+  8015c8:	56                   	push   %esi
+  8015c9:	ff d0                	call   *%eax
+  8015cb:	83 c4 10             	add    $0x10,%esp
+}
+  8015ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d1:	5b                   	pop    %ebx
+  8015d2:	5e                   	pop    %esi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+  8015d5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015d7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015dd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015e2:	77 18                	ja     8015fc <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015e4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015e9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015eb:	c1 e8 10             	shr    $0x10,%eax
+  8015ee:	74 0c                	je     8015fc <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015f0:	c1 e0 10             	shl    $0x10,%eax
+  8015f3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015f8:	29 c2                	sub    %eax,%edx
+  8015fa:	eb 06                	jmp    801602 <write+0x87>
+		return pthread_main_tls;
+  8015fc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801602:	8b 02                	mov    (%edx),%eax
+  801604:	8b 40 48             	mov    0x48(%eax),%eax
+  801607:	83 ec 04             	sub    $0x4,%esp
+  80160a:	53                   	push   %ebx
+  80160b:	50                   	push   %eax
+  80160c:	68 dd 52 80 00       	push   $0x8052dd
+  801611:	e8 9c ec ff ff       	call   8002b2 <cprintf>
+		return -E_INVAL;
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161e:	eb ae                	jmp    8015ce <write+0x53>
+		return -E_NOT_SUPP;
+  801620:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801625:	eb a7                	jmp    8015ce <write+0x53>
+
+00801627 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80162d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801630:	50                   	push   %eax
+  801631:	ff 75 08             	push   0x8(%ebp)
+  801634:	e8 ba fb ff ff       	call   8011f3 <fd_lookup>
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	78 0e                	js     80164e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801640:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801646:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+
+00801650 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	56                   	push   %esi
+  801654:	53                   	push   %ebx
+  801655:	83 ec 18             	sub    $0x18,%esp
+  801658:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80165b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80165e:	50                   	push   %eax
+  80165f:	53                   	push   %ebx
+  801660:	e8 8e fb ff ff       	call   8011f3 <fd_lookup>
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	78 34                	js     8016a0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80166c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80166f:	83 ec 08             	sub    $0x8,%esp
+  801672:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801675:	50                   	push   %eax
+  801676:	ff 36                	push   (%esi)
+  801678:	e8 c6 fb ff ff       	call   801243 <dev_lookup>
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	85 c0                	test   %eax,%eax
+  801682:	78 1c                	js     8016a0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801684:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801688:	74 1d                	je     8016a7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80168a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80168d:	8b 40 18             	mov    0x18(%eax),%eax
+  801690:	85 c0                	test   %eax,%eax
+  801692:	74 5e                	je     8016f2 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801694:	83 ec 08             	sub    $0x8,%esp
+  801697:	ff 75 0c             	push   0xc(%ebp)
+  80169a:	56                   	push   %esi
+  80169b:	ff d0                	call   *%eax
+  80169d:	83 c4 10             	add    $0x10,%esp
+}
+  8016a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a3:	5b                   	pop    %ebx
+  8016a4:	5e                   	pop    %esi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+  8016a7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016a9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016af:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016b4:	77 18                	ja     8016ce <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016b6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016bb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016bd:	c1 e8 10             	shr    $0x10,%eax
+  8016c0:	74 0c                	je     8016ce <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016c2:	c1 e0 10             	shl    $0x10,%eax
+  8016c5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016ca:	29 c2                	sub    %eax,%edx
+  8016cc:	eb 06                	jmp    8016d4 <ftruncate+0x84>
+		return pthread_main_tls;
+  8016ce:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  8016d4:	8b 02                	mov    (%edx),%eax
+  8016d6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016d9:	83 ec 04             	sub    $0x4,%esp
+  8016dc:	53                   	push   %ebx
+  8016dd:	50                   	push   %eax
+  8016de:	68 a0 52 80 00       	push   $0x8052a0
+  8016e3:	e8 ca eb ff ff       	call   8002b2 <cprintf>
+		return -E_INVAL;
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f0:	eb ae                	jmp    8016a0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016f2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f7:	eb a7                	jmp    8016a0 <ftruncate+0x50>
+
+008016f9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+  8016fe:	83 ec 18             	sub    $0x18,%esp
+  801701:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801704:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801707:	50                   	push   %eax
+  801708:	ff 75 08             	push   0x8(%ebp)
+  80170b:	e8 e3 fa ff ff       	call   8011f3 <fd_lookup>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	78 49                	js     801760 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801717:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171a:	83 ec 08             	sub    $0x8,%esp
+  80171d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801720:	50                   	push   %eax
+  801721:	ff 36                	push   (%esi)
+  801723:	e8 1b fb ff ff       	call   801243 <dev_lookup>
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 31                	js     801760 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80172f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801732:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801736:	74 2f                	je     801767 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801738:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80173b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801742:	00 00 00 
+	stat->st_isdir = 0;
+  801745:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80174c:	00 00 00 
+	stat->st_dev = dev;
+  80174f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801755:	83 ec 08             	sub    $0x8,%esp
+  801758:	53                   	push   %ebx
+  801759:	56                   	push   %esi
+  80175a:	ff 50 14             	call   *0x14(%eax)
+  80175d:	83 c4 10             	add    $0x10,%esp
+}
+  801760:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801763:	5b                   	pop    %ebx
+  801764:	5e                   	pop    %esi
+  801765:	5d                   	pop    %ebp
+  801766:	c3                   	ret
+		return -E_NOT_SUPP;
+  801767:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176c:	eb f2                	jmp    801760 <fstat+0x67>
+
+0080176e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	56                   	push   %esi
+  801772:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801773:	83 ec 08             	sub    $0x8,%esp
+  801776:	6a 00                	push   $0x0
+  801778:	ff 75 08             	push   0x8(%ebp)
+  80177b:	e8 4b 03 00 00       	call   801acb <open>
+  801780:	89 c3                	mov    %eax,%ebx
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	85 c0                	test   %eax,%eax
+  801787:	78 1b                	js     8017a4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801789:	83 ec 08             	sub    $0x8,%esp
+  80178c:	ff 75 0c             	push   0xc(%ebp)
+  80178f:	50                   	push   %eax
+  801790:	e8 64 ff ff ff       	call   8016f9 <fstat>
+  801795:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801797:	89 1c 24             	mov    %ebx,(%esp)
+  80179a:	e8 a8 fb ff ff       	call   801347 <close>
+	return r;
+  80179f:	83 c4 10             	add    $0x10,%esp
+  8017a2:	89 f3                	mov    %esi,%ebx
+}
+  8017a4:	89 d8                	mov    %ebx,%eax
+  8017a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a9:	5b                   	pop    %ebx
+  8017aa:	5e                   	pop    %esi
+  8017ab:	5d                   	pop    %ebp
+  8017ac:	c3                   	ret
+
+008017ad <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	56                   	push   %esi
+  8017b1:	53                   	push   %ebx
+  8017b2:	89 c6                	mov    %eax,%esi
+  8017b4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017b6:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8017bd:	74 27                	je     8017e6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017bf:	6a 07                	push   $0x7
+  8017c1:	68 00 80 80 00       	push   $0x808000
+  8017c6:	56                   	push   %esi
+  8017c7:	ff 35 00 70 80 00    	push   0x807000
+  8017cd:	e8 6b 32 00 00       	call   804a3d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017d2:	83 c4 0c             	add    $0xc,%esp
+  8017d5:	6a 00                	push   $0x0
+  8017d7:	53                   	push   %ebx
+  8017d8:	6a 00                	push   $0x0
+  8017da:	e8 68 31 00 00       	call   804947 <ipc_recv>
+}
+  8017df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e2:	5b                   	pop    %ebx
+  8017e3:	5e                   	pop    %esi
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017e6:	83 ec 0c             	sub    $0xc,%esp
+  8017e9:	6a 01                	push   $0x1
+  8017eb:	e8 a3 32 00 00       	call   804a93 <ipc_find_env>
+  8017f0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	eb c5                	jmp    8017bf <fsipc+0x12>
+
+008017fa <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801801:	68 04 70 80 00       	push   $0x807004
+  801806:	e8 46 21 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80180b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801811:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801816:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801819:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80181e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801823:	b8 02 00 00 00       	mov    $0x2,%eax
+  801828:	e8 80 ff ff ff       	call   8017ad <fsipc>
+  80182d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80182f:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801836:	e8 83 21 00 00       	call   8039be <mutex_unlock>
+	return r;
+}
+  80183b:	89 d8                	mov    %ebx,%eax
+  80183d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+00801842 <devfile_flush>:
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	53                   	push   %ebx
+  801846:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801849:	68 04 70 80 00       	push   $0x807004
+  80184e:	e8 fe 20 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801853:	8b 45 08             	mov    0x8(%ebp),%eax
+  801856:	8b 40 0c             	mov    0xc(%eax),%eax
+  801859:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80185e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801863:	b8 06 00 00 00       	mov    $0x6,%eax
+  801868:	e8 40 ff ff ff       	call   8017ad <fsipc>
+  80186d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80186f:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801876:	e8 43 21 00 00       	call   8039be <mutex_unlock>
+}
+  80187b:	89 d8                	mov    %ebx,%eax
+  80187d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <devfile_stat>:
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80188a:	83 ec 0c             	sub    $0xc,%esp
+  80188d:	68 04 70 80 00       	push   $0x807004
+  801892:	e8 ba 20 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80189d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8018a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018ac:	e8 fc fe ff ff       	call   8017ad <fsipc>
+  8018b1:	89 c3                	mov    %eax,%ebx
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	79 16                	jns    8018d0 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	68 04 70 80 00       	push   $0x807004
+  8018c2:	e8 f7 20 00 00       	call   8039be <mutex_unlock>
+}
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5d                   	pop    %ebp
+  8018cf:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018d0:	83 ec 08             	sub    $0x8,%esp
+  8018d3:	68 00 80 80 00       	push   $0x808000
+  8018d8:	56                   	push   %esi
+  8018d9:	e8 b8 ef ff ff       	call   800896 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8018de:	a1 80 80 80 00       	mov    0x808080,%eax
+  8018e3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018e9:	a1 84 80 80 00       	mov    0x808084,%eax
+  8018ee:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018f4:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fc:	eb bc                	jmp    8018ba <devfile_stat+0x38>
+
+008018fe <devfile_write>:
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	53                   	push   %ebx
+  801902:	83 ec 10             	sub    $0x10,%esp
+  801905:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801908:	68 04 70 80 00       	push   $0x807004
+  80190d:	e8 3f 20 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801912:	8b 45 08             	mov    0x8(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801926:	76 3d                	jbe    801965 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801928:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80192d:	39 c3                	cmp    %eax,%ebx
+  80192f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801932:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801935:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  80193a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801940:	ba 00 00 00 00       	mov    $0x0,%edx
+  801945:	b8 04 00 00 00       	mov    $0x4,%eax
+  80194a:	e8 5e fe ff ff       	call   8017ad <fsipc>
+  80194f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801951:	83 ec 0c             	sub    $0xc,%esp
+  801954:	68 04 70 80 00       	push   $0x807004
+  801959:	e8 60 20 00 00       	call   8039be <mutex_unlock>
+}
+  80195e:	89 d8                	mov    %ebx,%eax
+  801960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801963:	c9                   	leave
+  801964:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801965:	83 ec 04             	sub    $0x4,%esp
+  801968:	53                   	push   %ebx
+  801969:	ff 75 0c             	push   0xc(%ebp)
+  80196c:	68 0c 80 80 00       	push   $0x80800c
+  801971:	e8 a6 f0 ff ff       	call   800a1c <memmove>
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	eb b5                	jmp    801935 <devfile_write+0x37>
+
+00801980 <devfile_read>:
+{
+  801980:	55                   	push   %ebp
+  801981:	89 e5                	mov    %esp,%ebp
+  801983:	57                   	push   %edi
+  801984:	56                   	push   %esi
+  801985:	53                   	push   %ebx
+  801986:	83 ec 0c             	sub    $0xc,%esp
+  801989:	8b 75 08             	mov    0x8(%ebp),%esi
+  80198c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80198f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801992:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801998:	0f 86 8c 00 00 00    	jbe    801a2a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80199e:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019a3:	39 c3                	cmp    %eax,%ebx
+  8019a5:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019a8:	89 f8                	mov    %edi,%eax
+  8019aa:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019ad:	eb 0f                	jmp    8019be <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8019af:	0f b6 08             	movzbl (%eax),%ecx
+  8019b2:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8019b4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019b9:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019be:	39 d0                	cmp    %edx,%eax
+  8019c0:	72 ed                	jb     8019af <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8019c2:	83 ec 0c             	sub    $0xc,%esp
+  8019c5:	68 04 70 80 00       	push   $0x807004
+  8019ca:	e8 82 1f 00 00       	call   803951 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019cf:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019d2:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8019d7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8019dd:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8019e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019ed:	e8 bb fd ff ff       	call   8017ad <fsipc>
+  8019f2:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019f4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8019fb:	e8 be 1f 00 00       	call   8039be <mutex_unlock>
+		assert(r <= (int) n);
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	39 f3                	cmp    %esi,%ebx
+  801a05:	7c 0a                	jl     801a11 <devfile_read+0x91>
+}
+  801a07:	89 f0                	mov    %esi,%eax
+  801a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0c:	5b                   	pop    %ebx
+  801a0d:	5e                   	pop    %esi
+  801a0e:	5f                   	pop    %edi
+  801a0f:	5d                   	pop    %ebp
+  801a10:	c3                   	ret
+		assert(r <= (int) n);
+  801a11:	68 10 53 80 00       	push   $0x805310
+  801a16:	68 1d 53 80 00       	push   $0x80531d
+  801a1b:	68 90 00 00 00       	push   $0x90
+  801a20:	68 32 53 80 00       	push   $0x805332
+  801a25:	e8 ad e7 ff ff       	call   8001d7 <_panic>
+	mutex_lock(&fsipc_mu);
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	68 04 70 80 00       	push   $0x807004
+  801a32:	e8 1a 1f 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a37:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801a3f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801a45:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801a4c:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a54:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a59:	e8 4f fd ff ff       	call   8017ad <fsipc>
+  801a5e:	89 c6                	mov    %eax,%esi
+  801a60:	83 c4 10             	add    $0x10,%esp
+  801a63:	85 c0                	test   %eax,%eax
+  801a65:	78 1d                	js     801a84 <devfile_read+0x104>
+		assert(r <= n);
+  801a67:	39 c3                	cmp    %eax,%ebx
+  801a69:	72 2e                	jb     801a99 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a6b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a70:	7f 40                	jg     801ab2 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a72:	83 ec 04             	sub    $0x4,%esp
+  801a75:	50                   	push   %eax
+  801a76:	68 00 80 80 00       	push   $0x808000
+  801a7b:	57                   	push   %edi
+  801a7c:	e8 9b ef ff ff       	call   800a1c <memmove>
+  801a81:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a84:	83 ec 0c             	sub    $0xc,%esp
+  801a87:	68 04 70 80 00       	push   $0x807004
+  801a8c:	e8 2d 1f 00 00       	call   8039be <mutex_unlock>
+	return r;
+  801a91:	83 c4 10             	add    $0x10,%esp
+  801a94:	e9 6e ff ff ff       	jmp    801a07 <devfile_read+0x87>
+		assert(r <= n);
+  801a99:	68 3d 53 80 00       	push   $0x80533d
+  801a9e:	68 1d 53 80 00       	push   $0x80531d
+  801aa3:	68 99 00 00 00       	push   $0x99
+  801aa8:	68 32 53 80 00       	push   $0x805332
+  801aad:	e8 25 e7 ff ff       	call   8001d7 <_panic>
+		assert(r <= PGSIZE);
+  801ab2:	68 44 53 80 00       	push   $0x805344
+  801ab7:	68 1d 53 80 00       	push   $0x80531d
+  801abc:	68 9a 00 00 00       	push   $0x9a
+  801ac1:	68 32 53 80 00       	push   $0x805332
+  801ac6:	e8 0c e7 ff ff       	call   8001d7 <_panic>
+
+00801acb <open>:
+{
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	56                   	push   %esi
+  801acf:	53                   	push   %ebx
+  801ad0:	83 ec 1c             	sub    $0x1c,%esp
+  801ad3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ad6:	56                   	push   %esi
+  801ad7:	e8 7f ed ff ff       	call   80085b <strlen>
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ae4:	0f 8f 85 00 00 00    	jg     801b6f <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af0:	50                   	push   %eax
+  801af1:	e8 a7 f6 ff ff       	call   80119d <fd_alloc>
+  801af6:	89 c3                	mov    %eax,%ebx
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 55                	js     801b54 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	68 04 70 80 00       	push   $0x807004
+  801b07:	e8 45 1e 00 00       	call   803951 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b0c:	83 c4 08             	add    $0x8,%esp
+  801b0f:	56                   	push   %esi
+  801b10:	68 00 80 80 00       	push   $0x808000
+  801b15:	e8 7c ed ff ff       	call   800896 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1d:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b22:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b25:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b2a:	e8 7e fc ff ff       	call   8017ad <fsipc>
+  801b2f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b31:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b38:	e8 81 1e 00 00       	call   8039be <mutex_unlock>
+	if (r < 0) {
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 db                	test   %ebx,%ebx
+  801b42:	78 19                	js     801b5d <open+0x92>
+	return fd2num(fd);
+  801b44:	83 ec 0c             	sub    $0xc,%esp
+  801b47:	ff 75 f4             	push   -0xc(%ebp)
+  801b4a:	e8 27 f6 ff ff       	call   801176 <fd2num>
+  801b4f:	89 c3                	mov    %eax,%ebx
+  801b51:	83 c4 10             	add    $0x10,%esp
+}
+  801b54:	89 d8                	mov    %ebx,%eax
+  801b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5d                   	pop    %ebp
+  801b5c:	c3                   	ret
+		fd_close(fd, 0);
+  801b5d:	83 ec 08             	sub    $0x8,%esp
+  801b60:	6a 00                	push   $0x0
+  801b62:	ff 75 f4             	push   -0xc(%ebp)
+  801b65:	e8 56 f7 ff ff       	call   8012c0 <fd_close>
+		return r;
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	eb e5                	jmp    801b54 <open+0x89>
+		return -E_BAD_PATH;
+  801b6f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b74:	eb de                	jmp    801b54 <open+0x89>
+
+00801b76 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	53                   	push   %ebx
+  801b7a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b80:	50                   	push   %eax
+  801b81:	ff 75 08             	push   0x8(%ebp)
+  801b84:	e8 6a f6 ff ff       	call   8011f3 <fd_lookup>
+  801b89:	89 c3                	mov    %eax,%ebx
+  801b8b:	83 c4 10             	add    $0x10,%esp
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 5b                	js     801bed <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b95:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801b9b:	39 08                	cmp    %ecx,(%eax)
+  801b9d:	75 55                	jne    801bf4 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b9f:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801ba3:	74 56                	je     801bfb <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801ba5:	83 ec 0c             	sub    $0xc,%esp
+  801ba8:	68 04 70 80 00       	push   $0x807004
+  801bad:	e8 9f 1d 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb8:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801bbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bc0:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801bc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc8:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801bcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801bd7:	e8 d1 fb ff ff       	call   8017ad <fsipc>
+  801bdc:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bde:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801be5:	e8 d4 1d 00 00       	call   8039be <mutex_unlock>
+	return r;
+  801bea:	83 c4 10             	add    $0x10,%esp
+}
+  801bed:	89 d8                	mov    %ebx,%eax
+  801bef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf2:	c9                   	leave
+  801bf3:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bf4:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801bf9:	eb f2                	jmp    801bed <fallocate+0x77>
+		return -E_INVAL;
+  801bfb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801c00:	eb eb                	jmp    801bed <fallocate+0x77>
+
+00801c02 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801c02:	55                   	push   %ebp
+  801c03:	89 e5                	mov    %esp,%ebp
+  801c05:	56                   	push   %esi
+  801c06:	53                   	push   %ebx
+  801c07:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c0a:	89 f3                	mov    %esi,%ebx
+  801c0c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c12:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c15:	eb 06                	jmp    801c1d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c17:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c1d:	39 f3                	cmp    %esi,%ebx
+  801c1f:	73 14                	jae    801c35 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c21:	83 ec 08             	sub    $0x8,%esp
+  801c24:	53                   	push   %ebx
+  801c25:	6a 00                	push   $0x0
+  801c27:	e8 41 f1 ff ff       	call   800d6d <sys_page_unmap>
+  801c2c:	83 c4 10             	add    $0x10,%esp
+  801c2f:	85 c0                	test   %eax,%eax
+  801c31:	79 e4                	jns    801c17 <munmap+0x15>
+  801c33:	eb 05                	jmp    801c3a <munmap+0x38>
+			return r;
+	return 0;
+  801c35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3d:	5b                   	pop    %ebx
+  801c3e:	5e                   	pop    %esi
+  801c3f:	5d                   	pop    %ebp
+  801c40:	c3                   	ret
+
+00801c41 <mmap>:
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	57                   	push   %edi
+  801c45:	56                   	push   %esi
+  801c46:	53                   	push   %ebx
+  801c47:	83 ec 24             	sub    $0x24,%esp
+  801c4a:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c4d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c50:	50                   	push   %eax
+  801c51:	ff 75 08             	push   0x8(%ebp)
+  801c54:	e8 9a f5 ff ff       	call   8011f3 <fd_lookup>
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	85 c0                	test   %eax,%eax
+  801c5e:	0f 88 37 01 00 00    	js     801d9b <mmap+0x15a>
+		return NULL;
+  801c64:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c69:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c6c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801c72:	39 0a                	cmp    %ecx,(%edx)
+  801c74:	0f 85 05 01 00 00    	jne    801d7f <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c7a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c81:	0f 85 1b 01 00 00    	jne    801da2 <mmap+0x161>
+  801c87:	89 f0                	mov    %esi,%eax
+  801c89:	83 e8 01             	sub    $0x1,%eax
+  801c8c:	0f 88 17 01 00 00    	js     801da9 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c92:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c96:	75 28                	jne    801cc0 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c98:	83 ec 0c             	sub    $0xc,%esp
+  801c9b:	68 04 70 80 00       	push   $0x807004
+  801ca0:	e8 ac 1c 00 00       	call   803951 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801ca5:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801cab:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801cb1:	83 c4 10             	add    $0x10,%esp
+  801cb4:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801cb9:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801cbe:	eb 2b                	jmp    801ceb <mmap+0xaa>
+		cow_enable();
+  801cc0:	e8 11 28 00 00       	call   8044d6 <cow_enable>
+  801cc5:	eb d1                	jmp    801c98 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801cc7:	89 c2                	mov    %eax,%edx
+  801cc9:	c1 ea 0c             	shr    $0xc,%edx
+  801ccc:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801cd3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801cd9:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801cdf:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801ce2:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801ce4:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801ce9:	77 25                	ja     801d10 <mmap+0xcf>
+  801ceb:	89 c2                	mov    %eax,%edx
+  801ced:	29 da                	sub    %ebx,%edx
+  801cef:	39 ca                	cmp    %ecx,%edx
+  801cf1:	73 3a                	jae    801d2d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801cf3:	89 c2                	mov    %eax,%edx
+  801cf5:	c1 ea 16             	shr    $0x16,%edx
+  801cf8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cff:	f6 c2 01             	test   $0x1,%dl
+  801d02:	75 c3                	jne    801cc7 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801d04:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801d09:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801d0e:	eb d4                	jmp    801ce4 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801d10:	29 d8                	sub    %ebx,%eax
+  801d12:	39 c8                	cmp    %ecx,%eax
+  801d14:	73 17                	jae    801d2d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	68 04 70 80 00       	push   $0x807004
+  801d1e:	e8 9b 1c 00 00       	call   8039be <mutex_unlock>
+		return NULL;
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2b:	eb 52                	jmp    801d7f <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d2d:	85 db                	test   %ebx,%ebx
+  801d2f:	74 e5                	je     801d16 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d31:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d34:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d37:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801d3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d3f:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801d44:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801d4a:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801d50:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d53:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d62:	e8 46 fa ff ff       	call   8017ad <fsipc>
+  801d67:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d69:	83 ec 0c             	sub    $0xc,%esp
+  801d6c:	68 04 70 80 00       	push   $0x807004
+  801d71:	e8 48 1c 00 00       	call   8039be <mutex_unlock>
+	if (r < 0) {
+  801d76:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d79:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d7b:	85 ff                	test   %edi,%edi
+  801d7d:	78 08                	js     801d87 <mmap+0x146>
+}
+  801d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d82:	5b                   	pop    %ebx
+  801d83:	5e                   	pop    %esi
+  801d84:	5f                   	pop    %edi
+  801d85:	5d                   	pop    %ebp
+  801d86:	c3                   	ret
+		munmap((void*) va, len);
+  801d87:	83 ec 08             	sub    $0x8,%esp
+  801d8a:	56                   	push   %esi
+  801d8b:	53                   	push   %ebx
+  801d8c:	e8 71 fe ff ff       	call   801c02 <munmap>
+		return NULL;
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d99:	eb e4                	jmp    801d7f <mmap+0x13e>
+		return NULL;
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	eb dd                	jmp    801d7f <mmap+0x13e>
+		return NULL;
+  801da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da7:	eb d6                	jmp    801d7f <mmap+0x13e>
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dae:	eb cf                	jmp    801d7f <mmap+0x13e>
+
+00801db0 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	53                   	push   %ebx
+  801db4:	83 ec 10             	sub    $0x10,%esp
+  801db7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801dba:	53                   	push   %ebx
+  801dbb:	e8 9b ea ff ff       	call   80085b <strlen>
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dc8:	7f 42                	jg     801e0c <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801dca:	83 ec 0c             	sub    $0xc,%esp
+  801dcd:	68 04 70 80 00       	push   $0x807004
+  801dd2:	e8 7a 1b 00 00       	call   803951 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dd7:	83 c4 08             	add    $0x8,%esp
+  801dda:	53                   	push   %ebx
+  801ddb:	68 00 80 80 00       	push   $0x808000
+  801de0:	e8 b1 ea ff ff       	call   800896 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dea:	b8 07 00 00 00       	mov    $0x7,%eax
+  801def:	e8 b9 f9 ff ff       	call   8017ad <fsipc>
+  801df4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801df6:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801dfd:	e8 bc 1b 00 00       	call   8039be <mutex_unlock>
+	return r;
+  801e02:	83 c4 10             	add    $0x10,%esp
+}
+  801e05:	89 d8                	mov    %ebx,%eax
+  801e07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+		return -E_BAD_PATH;
+  801e0c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e11:	eb f2                	jmp    801e05 <remove+0x55>
+
+00801e13 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	53                   	push   %ebx
+  801e17:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e1a:	68 04 70 80 00       	push   $0x807004
+  801e1f:	e8 2d 1b 00 00       	call   803951 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e29:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e2e:	e8 7a f9 ff ff       	call   8017ad <fsipc>
+  801e33:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e35:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801e3c:	e8 7d 1b 00 00       	call   8039be <mutex_unlock>
+	return r;
+}
+  801e41:	89 d8                	mov    %ebx,%eax
+  801e43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+
+00801e48 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	56                   	push   %esi
+  801e4c:	53                   	push   %ebx
+  801e4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e50:	83 ec 0c             	sub    $0xc,%esp
+  801e53:	68 04 70 80 00       	push   $0x807004
+  801e58:	e8 f4 1a 00 00       	call   803951 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e60:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e6f:	e8 39 f9 ff ff       	call   8017ad <fsipc>
+  801e74:	89 c6                	mov    %eax,%esi
+  801e76:	83 c4 10             	add    $0x10,%esp
+  801e79:	85 db                	test   %ebx,%ebx
+  801e7b:	74 7b                	je     801ef8 <fs_bcstat+0xb0>
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 77                	js     801ef8 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e81:	a1 00 80 80 00       	mov    0x808000,%eax
+  801e86:	89 03                	mov    %eax,(%ebx)
+  801e88:	a1 04 80 80 00       	mov    0x808004,%eax
+  801e8d:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e90:	a1 08 80 80 00       	mov    0x808008,%eax
+  801e95:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e98:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801e9d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801ea0:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ea5:	89 43 10             	mov    %eax,0x10(%ebx)
+  801ea8:	a1 14 80 80 00       	mov    0x808014,%eax
+  801ead:	89 43 14             	mov    %eax,0x14(%ebx)
+  801eb0:	a1 18 80 80 00       	mov    0x808018,%eax
+  801eb5:	89 43 18             	mov    %eax,0x18(%ebx)
+  801eb8:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801ebd:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801ec0:	a1 20 80 80 00       	mov    0x808020,%eax
+  801ec5:	89 43 20             	mov    %eax,0x20(%ebx)
+  801ec8:	a1 24 80 80 00       	mov    0x808024,%eax
+  801ecd:	89 43 24             	mov    %eax,0x24(%ebx)
+  801ed0:	a1 28 80 80 00       	mov    0x808028,%eax
+  801ed5:	89 43 28             	mov    %eax,0x28(%ebx)
+  801ed8:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801edd:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801ee0:	a1 30 80 80 00       	mov    0x808030,%eax
+  801ee5:	89 43 30             	mov    %eax,0x30(%ebx)
+  801ee8:	a1 34 80 80 00       	mov    0x808034,%eax
+  801eed:	89 43 34             	mov    %eax,0x34(%ebx)
+  801ef0:	a1 38 80 80 00       	mov    0x808038,%eax
+  801ef5:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ef8:	83 ec 0c             	sub    $0xc,%esp
+  801efb:	68 04 70 80 00       	push   $0x807004
+  801f00:	e8 b9 1a 00 00       	call   8039be <mutex_unlock>
+	return r;
+}
+  801f05:	89 f0                	mov    %esi,%eax
+  801f07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0a:	5b                   	pop    %ebx
+  801f0b:	5e                   	pop    %esi
+  801f0c:	5d                   	pop    %ebp
+  801f0d:	c3                   	ret
+
+00801f0e <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801f15:	0f b6 10             	movzbl (%eax),%edx
+  801f18:	80 fa 72             	cmp    $0x72,%dl
+  801f1b:	74 44                	je     801f61 <parse_mode+0x53>
+  801f1d:	80 fa 77             	cmp    $0x77,%dl
+  801f20:	74 4b                	je     801f6d <parse_mode+0x5f>
+  801f22:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f27:	80 fa 61             	cmp    $0x61,%dl
+  801f2a:	74 09                	je     801f35 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801f2c:	89 d8                	mov    %ebx,%eax
+  801f2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f31:	5b                   	pop    %ebx
+  801f32:	5e                   	pop    %esi
+  801f33:	5d                   	pop    %ebp
+  801f34:	c3                   	ret
+	switch (mode[0]) {
+  801f35:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801f3a:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801f3f:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801f41:	83 ec 08             	sub    $0x8,%esp
+  801f44:	6a 2b                	push   $0x2b
+  801f46:	50                   	push   %eax
+  801f47:	e8 5c ea ff ff       	call   8009a8 <strchr>
+  801f4c:	83 c4 10             	add    $0x10,%esp
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	74 d9                	je     801f2c <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801f53:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801f56:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f59:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f5f:	eb cb                	jmp    801f2c <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f61:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f6b:	eb d2                	jmp    801f3f <parse_mode+0x31>
+  801f6d:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f72:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f77:	eb c6                	jmp    801f3f <parse_mode+0x31>
+
+00801f79 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	57                   	push   %edi
+  801f7d:	56                   	push   %esi
+  801f7e:	53                   	push   %ebx
+  801f7f:	83 ec 1c             	sub    $0x1c,%esp
+  801f82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f85:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f88:	b8 24 60 80 00       	mov    $0x806024,%eax
+  801f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f92:	83 c0 24             	add    $0x24,%eax
+  801f95:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f99:	74 17                	je     801fb2 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f9b:	83 c3 01             	add    $0x1,%ebx
+  801f9e:	83 fb 10             	cmp    $0x10,%ebx
+  801fa1:	75 ef                	jne    801f92 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801fa3:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801fa8:	89 f0                	mov    %esi,%eax
+  801faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fad:	5b                   	pop    %ebx
+  801fae:	5e                   	pop    %esi
+  801faf:	5f                   	pop    %edi
+  801fb0:	5d                   	pop    %ebp
+  801fb1:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801fb2:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801fb9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801fbc:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801fbf:	c1 e7 02             	shl    $0x2,%edi
+  801fc2:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  801fc8:	83 ec 04             	sub    $0x4,%esp
+  801fcb:	6a 24                	push   $0x24
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	56                   	push   %esi
+  801fd0:	e8 12 ea ff ff       	call   8009e7 <memset>
+			streams[i].f_fd = fd;
+  801fd5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801fd8:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  801fde:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801fe1:	01 d8                	add    %ebx,%eax
+  801fe3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fe6:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  801fed:	83 c4 10             	add    $0x10,%esp
+  801ff0:	eb b6                	jmp    801fa8 <stream_alloc+0x2f>
+
+00801ff2 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	53                   	push   %ebx
+  801ff6:	83 ec 14             	sub    $0x14,%esp
+  801ff9:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801ffb:	8b 40 18             	mov    0x18(%eax),%eax
+  801ffe:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802001:	74 4a                	je     80204d <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802003:	83 ec 08             	sub    $0x8,%esp
+  802006:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802009:	50                   	push   %eax
+  80200a:	ff 33                	push   (%ebx)
+  80200c:	e8 e2 f1 ff ff       	call   8011f3 <fd_lookup>
+  802011:	89 c2                	mov    %eax,%edx
+  802013:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802016:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80201b:	85 d2                	test   %edx,%edx
+  80201d:	78 41                	js     802060 <stream_unread+0x6e>
+  80201f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802022:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802028:	39 0a                	cmp    %ecx,(%edx)
+  80202a:	75 34                	jne    802060 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80202c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80202f:	03 42 04             	add    0x4(%edx),%eax
+  802032:	2b 43 18             	sub    0x18(%ebx),%eax
+  802035:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802038:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80203f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802046:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204b:	eb 13                	jmp    802060 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80204d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802054:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80205b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802060:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802063:	c9                   	leave
+  802064:	c3                   	ret
+
+00802065 <stream_drain>:
+{
+  802065:	55                   	push   %ebp
+  802066:	89 e5                	mov    %esp,%ebp
+  802068:	56                   	push   %esi
+  802069:	53                   	push   %ebx
+  80206a:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80206c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802071:	eb 02                	jmp    802075 <stream_drain+0x10>
+  802073:	01 c3                	add    %eax,%ebx
+  802075:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802078:	39 c3                	cmp    %eax,%ebx
+  80207a:	73 43                	jae    8020bf <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80207c:	83 ec 04             	sub    $0x4,%esp
+  80207f:	29 d8                	sub    %ebx,%eax
+  802081:	50                   	push   %eax
+  802082:	89 d8                	mov    %ebx,%eax
+  802084:	03 46 0c             	add    0xc(%esi),%eax
+  802087:	50                   	push   %eax
+  802088:	ff 36                	push   (%esi)
+  80208a:	e8 ec f4 ff ff       	call   80157b <write>
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	85 c0                	test   %eax,%eax
+  802094:	7f dd                	jg     802073 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802096:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80209a:	8b 56 0c             	mov    0xc(%esi),%edx
+  80209d:	83 ec 04             	sub    $0x4,%esp
+  8020a0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020a3:	29 d8                	sub    %ebx,%eax
+  8020a5:	50                   	push   %eax
+  8020a6:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	52                   	push   %edx
+  8020ab:	e8 6c e9 ff ff       	call   800a1c <memmove>
+			f->f_wend -= done;
+  8020b0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020b3:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8020bd:	eb 0a                	jmp    8020c9 <stream_drain+0x64>
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8020c4:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8020c9:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8020cc:	89 d0                	mov    %edx,%eax
+  8020ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d1:	5b                   	pop    %ebx
+  8020d2:	5e                   	pop    %esi
+  8020d3:	5d                   	pop    %ebp
+  8020d4:	c3                   	ret
+
+008020d5 <stream_setup>:
+	if (f->f_buf)
+  8020d5:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8020d9:	74 01                	je     8020dc <stream_setup+0x7>
+  8020db:	c3                   	ret
+{
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	53                   	push   %ebx
+  8020e0:	83 ec 04             	sub    $0x4,%esp
+  8020e3:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8020e5:	8b 40 08             	mov    0x8(%eax),%eax
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	74 17                	je     802103 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8020ec:	83 f8 03             	cmp    $0x3,%eax
+  8020ef:	75 2d                	jne    80211e <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8020f1:	8d 43 20             	lea    0x20(%ebx),%eax
+  8020f4:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8020f7:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802101:	c9                   	leave
+  802102:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802103:	83 ec 0c             	sub    $0xc,%esp
+  802106:	ff 33                	push   (%ebx)
+  802108:	e8 46 21 00 00       	call   804253 <iscons>
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	0f 9f c0             	setg   %al
+  802115:	0f b6 c0             	movzbl %al,%eax
+  802118:	83 c0 01             	add    $0x1,%eax
+  80211b:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80211e:	83 ec 0c             	sub    $0xc,%esp
+  802121:	68 00 10 00 00       	push   $0x1000
+  802126:	e8 8b 11 00 00       	call   8032b6 <malloc>
+  80212b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	85 c0                	test   %eax,%eax
+  802133:	74 bc                	je     8020f1 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802135:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80213c:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802140:	eb bc                	jmp    8020fe <stream_setup+0x29>
+
+00802142 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	53                   	push   %ebx
+  802146:	83 ec 04             	sub    $0x4,%esp
+  802149:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80214b:	e8 85 ff ff ff       	call   8020d5 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802150:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802155:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802159:	74 3d                	je     802198 <stream_fill+0x56>
+  80215b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80215f:	74 10                	je     802171 <stream_fill+0x2f>
+  802161:	89 d8                	mov    %ebx,%eax
+  802163:	e8 fd fe ff ff       	call   802065 <stream_drain>
+		return 0;
+  802168:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 27                	js     802198 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802171:	83 ec 04             	sub    $0x4,%esp
+  802174:	ff 73 10             	push   0x10(%ebx)
+  802177:	ff 73 0c             	push   0xc(%ebx)
+  80217a:	ff 33                	push   (%ebx)
+  80217c:	e8 02 f3 ff ff       	call   801483 <read>
+  802181:	83 c4 10             	add    $0x10,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	7e 17                	jle    80219f <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802188:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80218c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802193:	89 c2                	mov    %eax,%edx
+  802195:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802198:	89 d0                	mov    %edx,%eax
+  80219a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80219f:	c1 f8 1f             	sar    $0x1f,%eax
+  8021a2:	83 e0 04             	and    $0x4,%eax
+  8021a5:	83 c0 04             	add    $0x4,%eax
+  8021a8:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8021ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b0:	eb e6                	jmp    802198 <stream_fill+0x56>
+
+008021b2 <fopen>:
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	57                   	push   %edi
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+  8021b8:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8021be:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021c1:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8021c7:	89 f0                	mov    %esi,%eax
+  8021c9:	e8 40 fd ff ff       	call   801f0e <parse_mode>
+		return 0;
+  8021ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 2d                	js     802204 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8021d7:	83 ec 08             	sub    $0x8,%esp
+  8021da:	50                   	push   %eax
+  8021db:	ff 75 08             	push   0x8(%ebp)
+  8021de:	e8 e8 f8 ff ff       	call   801acb <open>
+  8021e3:	89 c7                	mov    %eax,%edi
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 58                	js     802244 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021ec:	80 3e 61             	cmpb   $0x61,(%esi)
+  8021ef:	74 1d                	je     80220e <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8021f1:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8021f7:	89 f8                	mov    %edi,%eax
+  8021f9:	e8 7b fd ff ff       	call   801f79 <stream_alloc>
+  8021fe:	89 c3                	mov    %eax,%ebx
+  802200:	85 c0                	test   %eax,%eax
+  802202:	74 32                	je     802236 <fopen+0x84>
+}
+  802204:	89 d8                	mov    %ebx,%eax
+  802206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802209:	5b                   	pop    %ebx
+  80220a:	5e                   	pop    %esi
+  80220b:	5f                   	pop    %edi
+  80220c:	5d                   	pop    %ebp
+  80220d:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80220e:	83 ec 08             	sub    $0x8,%esp
+  802211:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802217:	50                   	push   %eax
+  802218:	57                   	push   %edi
+  802219:	e8 db f4 ff ff       	call   8016f9 <fstat>
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 cc                	js     8021f1 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802225:	83 ec 08             	sub    $0x8,%esp
+  802228:	ff 75 dc             	push   -0x24(%ebp)
+  80222b:	57                   	push   %edi
+  80222c:	e8 f6 f3 ff ff       	call   801627 <seek>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	eb bb                	jmp    8021f1 <fopen+0x3f>
+		close(fd);
+  802236:	83 ec 0c             	sub    $0xc,%esp
+  802239:	57                   	push   %edi
+  80223a:	e8 08 f1 ff ff       	call   801347 <close>
+  80223f:	83 c4 10             	add    $0x10,%esp
+  802242:	eb c0                	jmp    802204 <fopen+0x52>
+		return 0;
+  802244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802249:	eb b9                	jmp    802204 <fopen+0x52>
+
+0080224b <fdopen>:
+{
+  80224b:	55                   	push   %ebp
+  80224c:	89 e5                	mov    %esp,%ebp
+  80224e:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802251:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802254:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802257:	e8 b2 fc ff ff       	call   801f0e <parse_mode>
+  80225c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802263:	85 d2                	test   %edx,%edx
+  802265:	78 0b                	js     802272 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802267:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80226a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226d:	e8 07 fd ff ff       	call   801f79 <stream_alloc>
+}
+  802272:	c9                   	leave
+  802273:	c3                   	ret
+
+00802274 <setvbuf>:
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	57                   	push   %edi
+  802278:	56                   	push   %esi
+  802279:	53                   	push   %ebx
+  80227a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802280:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802283:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802287:	75 3a                	jne    8022c3 <setvbuf+0x4f>
+  802289:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80228c:	83 fe 02             	cmp    $0x2,%esi
+  80228f:	77 39                	ja     8022ca <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802291:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802294:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802298:	0f 95 c3             	setne  %bl
+  80229b:	85 ff                	test   %edi,%edi
+  80229d:	0f 95 c1             	setne  %cl
+  8022a0:	84 cb                	test   %cl,%bl
+  8022a2:	74 05                	je     8022a9 <setvbuf+0x35>
+  8022a4:	83 fa 03             	cmp    $0x3,%edx
+  8022a7:	75 0a                	jne    8022b3 <setvbuf+0x3f>
+	return 0;
+  8022a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ae:	5b                   	pop    %ebx
+  8022af:	5e                   	pop    %esi
+  8022b0:	5f                   	pop    %edi
+  8022b1:	5d                   	pop    %ebp
+  8022b2:	c3                   	ret
+		f->f_buf = buf;
+  8022b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b6:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8022b9:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c1:	eb eb                	jmp    8022ae <setvbuf+0x3a>
+		return EOF;
+  8022c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022c8:	eb e4                	jmp    8022ae <setvbuf+0x3a>
+  8022ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022cf:	eb dd                	jmp    8022ae <setvbuf+0x3a>
+
+008022d1 <fflush>:
+{
+  8022d1:	55                   	push   %ebp
+  8022d2:	89 e5                	mov    %esp,%ebp
+  8022d4:	57                   	push   %edi
+  8022d5:	56                   	push   %esi
+  8022d6:	53                   	push   %ebx
+  8022d7:	83 ec 0c             	sub    $0xc,%esp
+  8022da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8022dd:	85 db                	test   %ebx,%ebx
+  8022df:	74 1a                	je     8022fb <fflush+0x2a>
+	stream_unread(f);
+  8022e1:	89 d8                	mov    %ebx,%eax
+  8022e3:	e8 0a fd ff ff       	call   801ff2 <stream_unread>
+	return stream_drain(f);
+  8022e8:	89 d8                	mov    %ebx,%eax
+  8022ea:	e8 76 fd ff ff       	call   802065 <stream_drain>
+  8022ef:	89 c7                	mov    %eax,%edi
+}
+  8022f1:	89 f8                	mov    %edi,%eax
+  8022f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+  8022fb:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802300:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802305:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230a:	eb 03                	jmp    80230f <fflush+0x3e>
+  80230c:	83 c3 24             	add    $0x24,%ebx
+  80230f:	39 f3                	cmp    %esi,%ebx
+  802311:	74 de                	je     8022f1 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802313:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802317:	74 f3                	je     80230c <fflush+0x3b>
+  802319:	83 ec 0c             	sub    $0xc,%esp
+  80231c:	53                   	push   %ebx
+  80231d:	e8 af ff ff ff       	call   8022d1 <fflush>
+  802322:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802325:	85 c0                	test   %eax,%eax
+  802327:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80232c:	0f 48 f8             	cmovs  %eax,%edi
+  80232f:	eb db                	jmp    80230c <fflush+0x3b>
+
+00802331 <fclose>:
+{
+  802331:	55                   	push   %ebp
+  802332:	89 e5                	mov    %esp,%ebp
+  802334:	56                   	push   %esi
+  802335:	53                   	push   %ebx
+  802336:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802339:	83 ec 0c             	sub    $0xc,%esp
+  80233c:	56                   	push   %esi
+  80233d:	e8 8f ff ff ff       	call   8022d1 <fflush>
+  802342:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802344:	83 c4 04             	add    $0x4,%esp
+  802347:	ff 36                	push   (%esi)
+  802349:	e8 f9 ef ff ff       	call   801347 <close>
+  80234e:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802351:	85 c0                	test   %eax,%eax
+  802353:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802358:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80235b:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80235f:	75 10                	jne    802371 <fclose+0x40>
+	f->f_flags = 0;
+  802361:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802368:	89 d8                	mov    %ebx,%eax
+  80236a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80236d:	5b                   	pop    %ebx
+  80236e:	5e                   	pop    %esi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+		free(f->f_buf);
+  802371:	83 ec 0c             	sub    $0xc,%esp
+  802374:	ff 76 0c             	push   0xc(%esi)
+  802377:	e8 71 0e 00 00       	call   8031ed <free>
+  80237c:	83 c4 10             	add    $0x10,%esp
+  80237f:	eb e0                	jmp    802361 <fclose+0x30>
+
+00802381 <fileno>:
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802384:	8b 45 08             	mov    0x8(%ebp),%eax
+  802387:	8b 00                	mov    (%eax),%eax
+}
+  802389:	5d                   	pop    %ebp
+  80238a:	c3                   	ret
+
+0080238b <feof>:
+{
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80238e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802391:	8b 40 04             	mov    0x4(%eax),%eax
+  802394:	c1 e8 02             	shr    $0x2,%eax
+  802397:	83 e0 01             	and    $0x1,%eax
+}
+  80239a:	5d                   	pop    %ebp
+  80239b:	c3                   	ret
+
+0080239c <ferror>:
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80239f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a2:	8b 40 04             	mov    0x4(%eax),%eax
+  8023a5:	c1 e8 03             	shr    $0x3,%eax
+  8023a8:	83 e0 01             	and    $0x1,%eax
+}
+  8023ab:	5d                   	pop    %ebp
+  8023ac:	c3                   	ret
+
+008023ad <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	53                   	push   %ebx
+  8023b1:	83 ec 04             	sub    $0x4,%esp
+  8023b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023b7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8023ba:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8023bd:	74 15                	je     8023d4 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8023bf:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8023c2:	8b 43 14             	mov    0x14(%ebx),%eax
+  8023c5:	8d 48 01             	lea    0x1(%eax),%ecx
+  8023c8:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8023cb:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8023cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023d4:	89 d8                	mov    %ebx,%eax
+  8023d6:	e8 67 fd ff ff       	call   802142 <stream_fill>
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	75 e0                	jne    8023bf <fgetc+0x12>
+		return EOF;
+  8023df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023e4:	eb e9                	jmp    8023cf <fgetc+0x22>
+
+008023e6 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8023e6:	55                   	push   %ebp
+  8023e7:	89 e5                	mov    %esp,%ebp
+  8023e9:	57                   	push   %edi
+  8023ea:	56                   	push   %esi
+  8023eb:	53                   	push   %ebx
+  8023ec:	83 ec 1c             	sub    $0x1c,%esp
+  8023ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8023f2:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023fa:	83 e8 01             	sub    $0x1,%eax
+  8023fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802400:	eb 66                	jmp    802468 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802402:	8b 46 14             	mov    0x14(%esi),%eax
+  802405:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802408:	29 c3                	sub    %eax,%ebx
+  80240a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80240d:	29 fa                	sub    %edi,%edx
+  80240f:	39 d3                	cmp    %edx,%ebx
+  802411:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802414:	83 ec 04             	sub    $0x4,%esp
+  802417:	53                   	push   %ebx
+  802418:	6a 0a                	push   $0xa
+  80241a:	03 46 0c             	add    0xc(%esi),%eax
+  80241d:	50                   	push   %eax
+  80241e:	e8 aa e6 ff ff       	call   800acd <memfind>
+  802423:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802426:	8b 46 0c             	mov    0xc(%esi),%eax
+  802429:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80242c:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80242f:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802431:	83 c4 10             	add    $0x10,%esp
+  802434:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802437:	74 0b                	je     802444 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802439:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80243c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80243f:	29 d3                	sub    %edx,%ebx
+  802441:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802444:	83 ec 04             	sub    $0x4,%esp
+  802447:	53                   	push   %ebx
+  802448:	01 c8                	add    %ecx,%eax
+  80244a:	50                   	push   %eax
+  80244b:	89 f8                	mov    %edi,%eax
+  80244d:	03 45 08             	add    0x8(%ebp),%eax
+  802450:	50                   	push   %eax
+  802451:	e8 c6 e5 ff ff       	call   800a1c <memmove>
+		f->f_rpos += m;
+  802456:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802459:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802461:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802466:	74 1f                	je     802487 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802468:	8d 47 01             	lea    0x1(%edi),%eax
+  80246b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80246e:	73 17                	jae    802487 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802470:	8b 46 18             	mov    0x18(%esi),%eax
+  802473:	39 46 14             	cmp    %eax,0x14(%esi)
+  802476:	75 8a                	jne    802402 <fgets+0x1c>
+  802478:	89 f0                	mov    %esi,%eax
+  80247a:	e8 c3 fc ff ff       	call   802142 <stream_fill>
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	0f 85 7b ff ff ff    	jne    802402 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802487:	85 ff                	test   %edi,%edi
+  802489:	74 0f                	je     80249a <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80248b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248e:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5f                   	pop    %edi
+  802498:	5d                   	pop    %ebp
+  802499:	c3                   	ret
+		return 0;
+  80249a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249f:	eb f1                	jmp    802492 <fgets+0xac>
+
+008024a1 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8024a1:	55                   	push   %ebp
+  8024a2:	89 e5                	mov    %esp,%ebp
+  8024a4:	57                   	push   %edi
+  8024a5:	56                   	push   %esi
+  8024a6:	53                   	push   %ebx
+  8024a7:	83 ec 1c             	sub    $0x1c,%esp
+  8024aa:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8024ad:	89 f0                	mov    %esi,%eax
+  8024af:	e8 21 fc ff ff       	call   8020d5 <stream_setup>
+	want = size * n;
+  8024b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8024bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8024be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c3:	eb 43                	jmp    802508 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8024c5:	29 d3                	sub    %edx,%ebx
+  8024c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ca:	29 f8                	sub    %edi,%eax
+  8024cc:	39 c3                	cmp    %eax,%ebx
+  8024ce:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8024d1:	83 ec 04             	sub    $0x4,%esp
+  8024d4:	53                   	push   %ebx
+  8024d5:	03 56 0c             	add    0xc(%esi),%edx
+  8024d8:	52                   	push   %edx
+  8024d9:	89 f8                	mov    %edi,%eax
+  8024db:	03 45 08             	add    0x8(%ebp),%eax
+  8024de:	50                   	push   %eax
+  8024df:	e8 38 e5 ff ff       	call   800a1c <memmove>
+			f->f_rpos += m;
+  8024e4:	01 5e 14             	add    %ebx,0x14(%esi)
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	eb 1a                	jmp    802506 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8024ec:	83 ec 04             	sub    $0x4,%esp
+  8024ef:	53                   	push   %ebx
+  8024f0:	89 f8                	mov    %edi,%eax
+  8024f2:	03 45 08             	add    0x8(%ebp),%eax
+  8024f5:	50                   	push   %eax
+  8024f6:	ff 36                	push   (%esi)
+  8024f8:	e8 86 ef ff ff       	call   801483 <read>
+  8024fd:	89 c3                	mov    %eax,%ebx
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	85 c0                	test   %eax,%eax
+  802504:	7e 36                	jle    80253c <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802506:	01 df                	add    %ebx,%edi
+  802508:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80250b:	39 c7                	cmp    %eax,%edi
+  80250d:	73 39                	jae    802548 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80250f:	8b 56 14             	mov    0x14(%esi),%edx
+  802512:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802515:	39 da                	cmp    %ebx,%edx
+  802517:	72 ac                	jb     8024c5 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802519:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80251c:	29 fb                	sub    %edi,%ebx
+  80251e:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802521:	72 3e                	jb     802561 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802523:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802527:	74 1f                	je     802548 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802529:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80252d:	74 bd                	je     8024ec <fread+0x4b>
+  80252f:	89 f0                	mov    %esi,%eax
+  802531:	e8 2f fb ff ff       	call   802065 <stream_drain>
+  802536:	85 c0                	test   %eax,%eax
+  802538:	79 b2                	jns    8024ec <fread+0x4b>
+  80253a:	eb 0c                	jmp    802548 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80253c:	c1 fb 1f             	sar    $0x1f,%ebx
+  80253f:	83 e3 04             	and    $0x4,%ebx
+  802542:	83 c3 04             	add    $0x4,%ebx
+  802545:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802548:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	74 0a                	je     802559 <fread+0xb8>
+  80254f:	89 f8                	mov    %edi,%eax
+  802551:	ba 00 00 00 00       	mov    $0x0,%edx
+  802556:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255c:	5b                   	pop    %ebx
+  80255d:	5e                   	pop    %esi
+  80255e:	5f                   	pop    %edi
+  80255f:	5d                   	pop    %ebp
+  802560:	c3                   	ret
+		} else if (!stream_fill(f))
+  802561:	89 f0                	mov    %esi,%eax
+  802563:	e8 da fb ff ff       	call   802142 <stream_fill>
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	74 dc                	je     802548 <fread+0xa7>
+			m = 0;
+  80256c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802571:	eb 93                	jmp    802506 <fread+0x65>
+
+00802573 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	57                   	push   %edi
+  802577:	56                   	push   %esi
+  802578:	53                   	push   %ebx
+  802579:	83 ec 1c             	sub    $0x1c,%esp
+  80257c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  80257f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802582:	a8 02                	test   $0x2,%al
+  802584:	75 13                	jne    802599 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802586:	83 c8 08             	or     $0x8,%eax
+  802589:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  80258c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802594:	5b                   	pop    %ebx
+  802595:	5e                   	pop    %esi
+  802596:	5f                   	pop    %edi
+  802597:	5d                   	pop    %ebp
+  802598:	c3                   	ret
+	stream_setup(f);
+  802599:	89 d8                	mov    %ebx,%eax
+  80259b:	e8 35 fb ff ff       	call   8020d5 <stream_setup>
+	want = size * n;
+  8025a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025a3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8025a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8025aa:	89 d8                	mov    %ebx,%eax
+  8025ac:	e8 41 fa ff ff       	call   801ff2 <stream_unread>
+	for (done = 0; done < want; ) {
+  8025b1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8025b6:	84 c0                	test   %al,%al
+  8025b8:	75 7b                	jne    802635 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8025ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025c2:	39 fe                	cmp    %edi,%esi
+  8025c4:	73 24                	jae    8025ea <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025c6:	83 ec 04             	sub    $0x4,%esp
+  8025c9:	89 f8                	mov    %edi,%eax
+  8025cb:	29 f0                	sub    %esi,%eax
+  8025cd:	50                   	push   %eax
+  8025ce:	89 f0                	mov    %esi,%eax
+  8025d0:	03 45 08             	add    0x8(%ebp),%eax
+  8025d3:	50                   	push   %eax
+  8025d4:	ff 33                	push   (%ebx)
+  8025d6:	e8 a0 ef ff ff       	call   80157b <write>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	7e 04                	jle    8025e6 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8025e2:	01 c6                	add    %eax,%esi
+  8025e4:	eb dc                	jmp    8025c2 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8025e6:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8025ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	74 a0                	je     802591 <fwrite+0x1e>
+  8025f1:	89 f0                	mov    %esi,%eax
+  8025f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f8:	f7 75 0c             	divl   0xc(%ebp)
+  8025fb:	eb 94                	jmp    802591 <fwrite+0x1e>
+			done += r;
+  8025fd:	01 c7                	add    %eax,%edi
+			continue;
+  8025ff:	eb 34                	jmp    802635 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802601:	8b 73 10             	mov    0x10(%ebx),%esi
+  802604:	29 c6                	sub    %eax,%esi
+  802606:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802609:	29 fa                	sub    %edi,%edx
+  80260b:	39 d6                	cmp    %edx,%esi
+  80260d:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802610:	83 ec 04             	sub    $0x4,%esp
+  802613:	56                   	push   %esi
+  802614:	89 fa                	mov    %edi,%edx
+  802616:	03 55 08             	add    0x8(%ebp),%edx
+  802619:	52                   	push   %edx
+  80261a:	03 43 0c             	add    0xc(%ebx),%eax
+  80261d:	50                   	push   %eax
+  80261e:	e8 f9 e3 ff ff       	call   800a1c <memmove>
+		f->f_wend += m;
+  802623:	89 f0                	mov    %esi,%eax
+  802625:	03 43 1c             	add    0x1c(%ebx),%eax
+  802628:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  80262b:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802633:	74 5b                	je     802690 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802635:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802638:	39 c7                	cmp    %eax,%edi
+  80263a:	73 2d                	jae    802669 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  80263c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	75 be                	jne    802601 <fwrite+0x8e>
+  802643:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802646:	29 fa                	sub    %edi,%edx
+  802648:	3b 53 10             	cmp    0x10(%ebx),%edx
+  80264b:	72 b4                	jb     802601 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80264d:	83 ec 04             	sub    $0x4,%esp
+  802650:	52                   	push   %edx
+  802651:	89 f8                	mov    %edi,%eax
+  802653:	03 45 08             	add    0x8(%ebp),%eax
+  802656:	50                   	push   %eax
+  802657:	ff 33                	push   (%ebx)
+  802659:	e8 1d ef ff ff       	call   80157b <write>
+  80265e:	83 c4 10             	add    $0x10,%esp
+  802661:	85 c0                	test   %eax,%eax
+  802663:	7f 98                	jg     8025fd <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802665:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802669:	8b 43 08             	mov    0x8(%ebx),%eax
+  80266c:	83 f8 03             	cmp    $0x3,%eax
+  80266f:	74 48                	je     8026b9 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802671:	83 f8 02             	cmp    $0x2,%eax
+  802674:	74 27                	je     80269d <fwrite+0x12a>
+	return size ? done / size : 0;
+  802676:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	0f 84 10 ff ff ff    	je     802591 <fwrite+0x1e>
+  802681:	89 f8                	mov    %edi,%eax
+  802683:	ba 00 00 00 00       	mov    $0x0,%edx
+  802688:	f7 75 0c             	divl   0xc(%ebp)
+  80268b:	e9 01 ff ff ff       	jmp    802591 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802690:	89 d8                	mov    %ebx,%eax
+  802692:	e8 ce f9 ff ff       	call   802065 <stream_drain>
+  802697:	85 c0                	test   %eax,%eax
+  802699:	79 9a                	jns    802635 <fwrite+0xc2>
+  80269b:	eb cc                	jmp    802669 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80269d:	83 ec 04             	sub    $0x4,%esp
+  8026a0:	57                   	push   %edi
+  8026a1:	6a 0a                	push   $0xa
+  8026a3:	ff 75 08             	push   0x8(%ebp)
+  8026a6:	e8 22 e4 ff ff       	call   800acd <memfind>
+  8026ab:	89 c2                	mov    %eax,%edx
+  8026ad:	89 f8                	mov    %edi,%eax
+  8026af:	03 45 08             	add    0x8(%ebp),%eax
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  8026b5:	39 c2                	cmp    %eax,%edx
+  8026b7:	74 bd                	je     802676 <fwrite+0x103>
+		stream_drain(f);
+  8026b9:	89 d8                	mov    %ebx,%eax
+  8026bb:	e8 a5 f9 ff ff       	call   802065 <stream_drain>
+  8026c0:	eb b4                	jmp    802676 <fwrite+0x103>
+
+008026c2 <fputc>:
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	53                   	push   %ebx
+  8026c6:	83 ec 14             	sub    $0x14,%esp
+  8026c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8026cc:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8026cf:	ff 75 0c             	push   0xc(%ebp)
+  8026d2:	6a 01                	push   $0x1
+  8026d4:	6a 01                	push   $0x1
+  8026d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026d9:	50                   	push   %eax
+  8026da:	e8 94 fe ff ff       	call   802573 <fwrite>
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	0f b6 db             	movzbl %bl,%ebx
+  8026e5:	83 f8 01             	cmp    $0x1,%eax
+  8026e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026ed:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8026f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f3:	c9                   	leave
+  8026f4:	c3                   	ret
+
+008026f5 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026f5:	55                   	push   %ebp
+  8026f6:	89 e5                	mov    %esp,%ebp
+  8026f8:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026fb:	ff 75 0c             	push   0xc(%ebp)
+  8026fe:	ff 75 08             	push   0x8(%ebp)
+  802701:	e8 bc ff ff ff       	call   8026c2 <fputc>
+}
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	c9                   	leave
+  80270a:	c3                   	ret
+
+0080270b <fputs>:
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	56                   	push   %esi
+  80270f:	53                   	push   %ebx
+  802710:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802713:	83 ec 0c             	sub    $0xc,%esp
+  802716:	56                   	push   %esi
+  802717:	e8 3f e1 ff ff       	call   80085b <strlen>
+  80271c:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80271e:	ff 75 0c             	push   0xc(%ebp)
+  802721:	50                   	push   %eax
+  802722:	6a 01                	push   $0x1
+  802724:	56                   	push   %esi
+  802725:	e8 49 fe ff ff       	call   802573 <fwrite>
+  80272a:	83 c4 20             	add    $0x20,%esp
+  80272d:	39 d8                	cmp    %ebx,%eax
+  80272f:	0f 95 c0             	setne  %al
+  802732:	0f b6 c0             	movzbl %al,%eax
+  802735:	f7 d8                	neg    %eax
+}
+  802737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80273a:	5b                   	pop    %ebx
+  80273b:	5e                   	pop    %esi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+
+0080273e <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80273e:	55                   	push   %ebp
+  80273f:	89 e5                	mov    %esp,%ebp
+  802741:	53                   	push   %ebx
+  802742:	83 ec 04             	sub    $0x4,%esp
+  802745:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802748:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  80274b:	50                   	push   %eax
+  80274c:	ff 75 0c             	push   0xc(%ebp)
+  80274f:	53                   	push   %ebx
+  802750:	68 f5 26 80 00       	push   $0x8026f5
+  802755:	e8 4f dc ff ff       	call   8003a9 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80275a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80275d:	c1 e0 1c             	shl    $0x1c,%eax
+  802760:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+
+00802768 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802768:	55                   	push   %ebp
+  802769:	89 e5                	mov    %esp,%ebp
+  80276b:	57                   	push   %edi
+  80276c:	56                   	push   %esi
+  80276d:	53                   	push   %ebx
+  80276e:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802774:	6a 00                	push   $0x0
+  802776:	ff 75 08             	push   0x8(%ebp)
+  802779:	e8 4d f3 ff ff       	call   801acb <open>
+  80277e:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 df 04 00 00    	js     802c6e <spawn+0x506>
+  80278f:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802791:	83 ec 04             	sub    $0x4,%esp
+  802794:	68 00 02 00 00       	push   $0x200
+  802799:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80279f:	50                   	push   %eax
+  8027a0:	51                   	push   %ecx
+  8027a1:	e8 8e ed ff ff       	call   801534 <readn>
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8027ae:	75 5a                	jne    80280a <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  8027b0:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8027b7:	45 4c 46 
+  8027ba:	75 4e                	jne    80280a <spawn+0xa2>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8027bc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027c1:	cd 30                	int    $0x30
+  8027c3:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	0f 88 91 04 00 00    	js     802c62 <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8027d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027d6:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  8027d9:	c1 e6 04             	shl    $0x4,%esi
+  8027dc:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8027e2:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8027e8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8027ed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8027ef:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8027f5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802800:	be 00 00 00 00       	mov    $0x0,%esi
+  802805:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802808:	eb 4b                	jmp    802855 <spawn+0xed>
+		close(fd);
+  80280a:	83 ec 0c             	sub    $0xc,%esp
+  80280d:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802813:	e8 2f eb ff ff       	call   801347 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802818:	83 c4 0c             	add    $0xc,%esp
+  80281b:	68 7f 45 4c 46       	push   $0x464c457f
+  802820:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802826:	68 58 53 80 00       	push   $0x805358
+  80282b:	e8 82 da ff ff       	call   8002b2 <cprintf>
+		return -E_NOT_EXEC;
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  80283a:	ff ff ff 
+  80283d:	e9 2c 04 00 00       	jmp    802c6e <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  802842:	83 ec 0c             	sub    $0xc,%esp
+  802845:	50                   	push   %eax
+  802846:	e8 10 e0 ff ff       	call   80085b <strlen>
+  80284b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80284f:	83 c3 01             	add    $0x1,%ebx
+  802852:	83 c4 10             	add    $0x10,%esp
+  802855:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	75 e6                	jne    802842 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80285c:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802862:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802867:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802869:	89 fa                	mov    %edi,%edx
+  80286b:	83 e2 fc             	and    $0xfffffffc,%edx
+  80286e:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802875:	29 c2                	sub    %eax,%edx
+  802877:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80287d:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802880:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802885:	0f 86 06 04 00 00    	jbe    802c91 <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80288b:	83 ec 04             	sub    $0x4,%esp
+  80288e:	6a 07                	push   $0x7
+  802890:	68 00 00 40 00       	push   $0x400000
+  802895:	6a 00                	push   $0x0
+  802897:	e8 38 e4 ff ff       	call   800cd4 <sys_page_alloc>
+  80289c:	83 c4 10             	add    $0x10,%esp
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	0f 88 ef 03 00 00    	js     802c96 <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8028a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ac:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8028b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8028b5:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  8028bb:	7e 32                	jle    8028ef <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8028bd:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8028c3:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8028c9:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+  8028cf:	ff 34 b3             	push   (%ebx,%esi,4)
+  8028d2:	57                   	push   %edi
+  8028d3:	e8 be df ff ff       	call   800896 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8028d8:	83 c4 04             	add    $0x4,%esp
+  8028db:	ff 34 b3             	push   (%ebx,%esi,4)
+  8028de:	e8 78 df ff ff       	call   80085b <strlen>
+  8028e3:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8028e7:	83 c6 01             	add    $0x1,%esi
+  8028ea:	83 c4 10             	add    $0x10,%esp
+  8028ed:	eb c6                	jmp    8028b5 <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  8028ef:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8028f5:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8028fb:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802902:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802908:	0f 85 87 00 00 00    	jne    802995 <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  80290e:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802914:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80291a:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  80291d:	89 c8                	mov    %ecx,%eax
+  80291f:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802925:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802928:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80292d:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802933:	83 ec 0c             	sub    $0xc,%esp
+  802936:	6a 07                	push   $0x7
+  802938:	68 00 d0 bf ee       	push   $0xeebfd000
+  80293d:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802943:	68 00 00 40 00       	push   $0x400000
+  802948:	6a 00                	push   $0x0
+  80294a:	e8 d2 e3 ff ff       	call   800d21 <sys_page_map>
+  80294f:	89 c3                	mov    %eax,%ebx
+  802951:	83 c4 20             	add    $0x20,%esp
+  802954:	85 c0                	test   %eax,%eax
+  802956:	0f 88 98 03 00 00    	js     802cf4 <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80295c:	83 ec 08             	sub    $0x8,%esp
+  80295f:	68 00 00 40 00       	push   $0x400000
+  802964:	6a 00                	push   $0x0
+  802966:	e8 02 e4 ff ff       	call   800d6d <sys_page_unmap>
+  80296b:	89 c3                	mov    %eax,%ebx
+  80296d:	83 c4 10             	add    $0x10,%esp
+  802970:	85 c0                	test   %eax,%eax
+  802972:	0f 88 7c 03 00 00    	js     802cf4 <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802978:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80297e:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802985:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298a:	89 c8                	mov    %ecx,%eax
+  80298c:	89 d1                	mov    %edx,%ecx
+  80298e:	89 c2                	mov    %eax,%edx
+  802990:	e9 5a 01 00 00       	jmp    802aef <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802995:	68 e4 53 80 00       	push   $0x8053e4
+  80299a:	68 1d 53 80 00       	push   $0x80531d
+  80299f:	68 06 01 00 00       	push   $0x106
+  8029a4:	68 72 53 80 00       	push   $0x805372
+  8029a9:	e8 29 d8 ff ff       	call   8001d7 <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8029ae:	83 ec 04             	sub    $0x4,%esp
+  8029b1:	6a 07                	push   $0x7
+  8029b3:	68 00 00 40 00       	push   $0x400000
+  8029b8:	6a 00                	push   $0x0
+  8029ba:	e8 15 e3 ff ff       	call   800cd4 <sys_page_alloc>
+  8029bf:	83 c4 10             	add    $0x10,%esp
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	0f 88 b2 02 00 00    	js     802c7c <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8029ca:	83 ec 08             	sub    $0x8,%esp
+  8029cd:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  8029d3:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8029d9:	01 d0                	add    %edx,%eax
+  8029db:	50                   	push   %eax
+  8029dc:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8029e2:	e8 40 ec ff ff       	call   801627 <seek>
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	0f 88 91 02 00 00    	js     802c83 <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8029f2:	83 ec 04             	sub    $0x4,%esp
+  8029f5:	89 fa                	mov    %edi,%edx
+  8029f7:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8029fd:	29 ca                	sub    %ecx,%edx
+  8029ff:	89 d0                	mov    %edx,%eax
+  802a01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a06:	39 d0                	cmp    %edx,%eax
+  802a08:	0f 47 c2             	cmova  %edx,%eax
+  802a0b:	50                   	push   %eax
+  802a0c:	68 00 00 40 00       	push   $0x400000
+  802a11:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802a17:	e8 18 eb ff ff       	call   801534 <readn>
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	85 c0                	test   %eax,%eax
+  802a21:	0f 88 63 02 00 00    	js     802c8a <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  802a27:	83 ec 0c             	sub    $0xc,%esp
+  802a2a:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  802a30:	56                   	push   %esi
+  802a31:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802a37:	68 00 00 40 00       	push   $0x400000
+  802a3c:	6a 00                	push   $0x0
+  802a3e:	e8 de e2 ff ff       	call   800d21 <sys_page_map>
+  802a43:	83 c4 20             	add    $0x20,%esp
+  802a46:	85 c0                	test   %eax,%eax
+  802a48:	78 7e                	js     802ac8 <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  802a4a:	83 ec 08             	sub    $0x8,%esp
+  802a4d:	68 00 00 40 00       	push   $0x400000
+  802a52:	6a 00                	push   $0x0
+  802a54:	e8 14 e3 ff ff       	call   800d6d <sys_page_unmap>
+  802a59:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802a5c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a62:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a68:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  802a6e:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802a74:	39 c3                	cmp    %eax,%ebx
+  802a76:	73 65                	jae    802add <spawn+0x375>
+		if (i >= filesz) {
+  802a78:	39 fb                	cmp    %edi,%ebx
+  802a7a:	0f 82 2e ff ff ff    	jb     8029ae <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802a80:	83 ec 04             	sub    $0x4,%esp
+  802a83:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  802a89:	56                   	push   %esi
+  802a8a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802a90:	e8 3f e2 ff ff       	call   800cd4 <sys_page_alloc>
+  802a95:	83 c4 10             	add    $0x10,%esp
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	79 c0                	jns    802a5c <spawn+0x2f4>
+  802a9c:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802a9e:	83 ec 0c             	sub    $0xc,%esp
+  802aa1:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802aa7:	e8 85 e1 ff ff       	call   800c31 <sys_env_destroy>
+	close(fd);
+  802aac:	83 c4 04             	add    $0x4,%esp
+  802aaf:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802ab5:	e8 8d e8 ff ff       	call   801347 <close>
+	return r;
+  802aba:	83 c4 10             	add    $0x10,%esp
+  802abd:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  802ac3:	e9 a6 01 00 00       	jmp    802c6e <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  802ac8:	50                   	push   %eax
+  802ac9:	68 7e 53 80 00       	push   $0x80537e
+  802ace:	68 39 01 00 00       	push   $0x139
+  802ad3:	68 72 53 80 00       	push   $0x805372
+  802ad8:	e8 fa d6 ff ff       	call   8001d7 <_panic>
+  802add:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802ae3:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802ae9:	83 c1 01             	add    $0x1,%ecx
+  802aec:	83 c2 20             	add    $0x20,%edx
+  802aef:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802af6:	39 c8                	cmp    %ecx,%eax
+  802af8:	0f 8e 88 00 00 00    	jle    802b86 <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802afe:	83 3a 01             	cmpl   $0x1,(%edx)
+  802b01:	75 e6                	jne    802ae9 <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802b03:	8b 42 18             	mov    0x18(%edx),%eax
+  802b06:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802b09:	83 f8 01             	cmp    $0x1,%eax
+  802b0c:	19 c0                	sbb    %eax,%eax
+  802b0e:	83 e0 fe             	and    $0xfffffffe,%eax
+  802b11:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802b14:	8b 72 04             	mov    0x4(%edx),%esi
+  802b17:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  802b1d:	8b 7a 10             	mov    0x10(%edx),%edi
+  802b20:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802b26:	8b 5a 14             	mov    0x14(%edx),%ebx
+  802b29:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802b2f:	8b 7a 08             	mov    0x8(%edx),%edi
+  802b32:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  802b38:	89 fb                	mov    %edi,%ebx
+  802b3a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802b40:	74 1c                	je     802b5e <spawn+0x3f6>
+		va -= i;
+  802b42:	29 df                	sub    %ebx,%edi
+  802b44:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  802b4a:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  802b50:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  802b56:	29 de                	sub    %ebx,%esi
+  802b58:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802b5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b63:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  802b69:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  802b6f:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  802b75:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802b7b:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802b81:	e9 e2 fe ff ff       	jmp    802a68 <spawn+0x300>
+	close(fd);
+  802b86:	83 ec 0c             	sub    $0xc,%esp
+  802b89:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802b8f:	e8 b3 e7 ff ff       	call   801347 <close>
+  802b94:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802b97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b9c:	eb 75                	jmp    802c13 <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  802b9e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ba4:	83 c6 01             	add    $0x1,%esi
+  802ba7:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802bad:	74 4f                	je     802bfe <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  802baf:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  802bb6:	89 c2                	mov    %eax,%edx
+  802bb8:	81 e2 05 04 00 00    	and    $0x405,%edx
+  802bbe:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  802bc4:	75 d8                	jne    802b9e <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  802bc6:	89 da                	mov    %ebx,%edx
+  802bc8:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  802bca:	83 ec 0c             	sub    $0xc,%esp
+  802bcd:	25 07 0e 00 00       	and    $0xe07,%eax
+  802bd2:	50                   	push   %eax
+  802bd3:	52                   	push   %edx
+  802bd4:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802bda:	52                   	push   %edx
+  802bdb:	6a 00                	push   $0x0
+  802bdd:	e8 3f e1 ff ff       	call   800d21 <sys_page_map>
+  802be2:	83 c4 20             	add    $0x20,%esp
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	79 b5                	jns    802b9e <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  802be9:	50                   	push   %eax
+  802bea:	68 cc 53 80 00       	push   $0x8053cc
+  802bef:	68 94 00 00 00       	push   $0x94
+  802bf4:	68 72 53 80 00       	push   $0x805372
+  802bf9:	e8 d9 d5 ff ff       	call   8001d7 <_panic>
+  802bfe:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802c04:	83 c2 01             	add    $0x1,%edx
+  802c07:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  802c0d:	0f 84 8b 00 00 00    	je     802c9e <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  802c13:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  802c1a:	a8 07                	test   $0x7,%al
+  802c1c:	74 e6                	je     802c04 <spawn+0x49c>
+  802c1e:	89 d6                	mov    %edx,%esi
+  802c20:	c1 e6 0a             	shl    $0xa,%esi
+  802c23:	89 d7                	mov    %edx,%edi
+  802c25:	c1 e7 16             	shl    $0x16,%edi
+  802c28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c2d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  802c33:	e9 77 ff ff ff       	jmp    802baf <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  802c38:	50                   	push   %eax
+  802c39:	68 9b 53 80 00       	push   $0x80539b
+  802c3e:	68 98 00 00 00       	push   $0x98
+  802c43:	68 72 53 80 00       	push   $0x805372
+  802c48:	e8 8a d5 ff ff       	call   8001d7 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802c4d:	50                   	push   %eax
+  802c4e:	68 b5 53 80 00       	push   $0x8053b5
+  802c53:	68 9b 00 00 00       	push   $0x9b
+  802c58:	68 72 53 80 00       	push   $0x805372
+  802c5d:	e8 75 d5 ff ff       	call   8001d7 <_panic>
+		return r;
+  802c62:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802c68:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  802c6e:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c77:	5b                   	pop    %ebx
+  802c78:	5e                   	pop    %esi
+  802c79:	5f                   	pop    %edi
+  802c7a:	5d                   	pop    %ebp
+  802c7b:	c3                   	ret
+  802c7c:	89 c7                	mov    %eax,%edi
+  802c7e:	e9 1b fe ff ff       	jmp    802a9e <spawn+0x336>
+  802c83:	89 c7                	mov    %eax,%edi
+  802c85:	e9 14 fe ff ff       	jmp    802a9e <spawn+0x336>
+  802c8a:	89 c7                	mov    %eax,%edi
+  802c8c:	e9 0d fe ff ff       	jmp    802a9e <spawn+0x336>
+		return -E_NO_MEM;
+  802c91:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802c96:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802c9c:	eb d0                	jmp    802c6e <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802c9e:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802ca5:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802ca8:	83 ec 08             	sub    $0x8,%esp
+  802cab:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802cb1:	50                   	push   %eax
+  802cb2:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802cb8:	e8 48 e1 ff ff       	call   800e05 <sys_env_set_trapframe>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	0f 88 70 ff ff ff    	js     802c38 <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802cc8:	83 ec 08             	sub    $0x8,%esp
+  802ccb:	6a 02                	push   $0x2
+  802ccd:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802cd3:	e8 e1 e0 ff ff       	call   800db9 <sys_env_set_status>
+  802cd8:	83 c4 10             	add    $0x10,%esp
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	0f 88 6a ff ff ff    	js     802c4d <spawn+0x4e5>
+	return child;
+  802ce3:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802ce9:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802cef:	e9 7a ff ff ff       	jmp    802c6e <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  802cf4:	83 ec 08             	sub    $0x8,%esp
+  802cf7:	68 00 00 40 00       	push   $0x400000
+  802cfc:	6a 00                	push   $0x0
+  802cfe:	e8 6a e0 ff ff       	call   800d6d <sys_page_unmap>
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802d0c:	e9 5d ff ff ff       	jmp    802c6e <spawn+0x506>
+
+00802d11 <spawnl>:
+{
+  802d11:	55                   	push   %ebp
+  802d12:	89 e5                	mov    %esp,%ebp
+  802d14:	56                   	push   %esi
+  802d15:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802d16:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802d19:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802d1e:	eb 05                	jmp    802d25 <spawnl+0x14>
+		argc++;
+  802d20:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802d23:	89 ca                	mov    %ecx,%edx
+  802d25:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802d28:	83 3a 00             	cmpl   $0x0,(%edx)
+  802d2b:	75 f3                	jne    802d20 <spawnl+0xf>
+	const char *argv[argc+2];
+  802d2d:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802d34:	83 e2 f0             	and    $0xfffffff0,%edx
+  802d37:	29 d4                	sub    %edx,%esp
+  802d39:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802d3d:	89 da                	mov    %ebx,%edx
+  802d3f:	c1 ea 02             	shr    $0x2,%edx
+  802d42:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802d45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d48:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802d4f:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802d56:	00 
+	va_start(vl, arg0);
+  802d57:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802d5a:	89 c2                	mov    %eax,%edx
+  802d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d61:	eb 0b                	jmp    802d6e <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802d63:	83 c0 01             	add    $0x1,%eax
+  802d66:	8b 31                	mov    (%ecx),%esi
+  802d68:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802d6b:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802d6e:	39 d0                	cmp    %edx,%eax
+  802d70:	75 f1                	jne    802d63 <spawnl+0x52>
+	return spawn(prog, argv);
+  802d72:	83 ec 08             	sub    $0x8,%esp
+  802d75:	53                   	push   %ebx
+  802d76:	ff 75 08             	push   0x8(%ebp)
+  802d79:	e8 ea f9 ff ff       	call   802768 <spawn>
+}
+  802d7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d81:	5b                   	pop    %ebx
+  802d82:	5e                   	pop    %esi
+  802d83:	5d                   	pop    %ebp
+  802d84:	c3                   	ret
+
+00802d85 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d85:	55                   	push   %ebp
+  802d86:	89 e5                	mov    %esp,%ebp
+  802d88:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802d8b:	68 0a 54 80 00       	push   $0x80540a
+  802d90:	ff 75 0c             	push   0xc(%ebp)
+  802d93:	e8 fe da ff ff       	call   800896 <strcpy>
+	return 0;
+}
+  802d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9d:	c9                   	leave
+  802d9e:	c3                   	ret
+
+00802d9f <devsock_close>:
+{
+  802d9f:	55                   	push   %ebp
+  802da0:	89 e5                	mov    %esp,%ebp
+  802da2:	53                   	push   %ebx
+  802da3:	83 ec 10             	sub    $0x10,%esp
+  802da6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802da9:	53                   	push   %ebx
+  802daa:	e8 23 1d 00 00       	call   804ad2 <pageref>
+  802daf:	89 c2                	mov    %eax,%edx
+  802db1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802db9:	83 fa 01             	cmp    $0x1,%edx
+  802dbc:	74 05                	je     802dc3 <devsock_close+0x24>
+}
+  802dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc1:	c9                   	leave
+  802dc2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802dc3:	83 ec 0c             	sub    $0xc,%esp
+  802dc6:	ff 73 0c             	push   0xc(%ebx)
+  802dc9:	e8 b7 02 00 00       	call   803085 <nsipc_close>
+  802dce:	83 c4 10             	add    $0x10,%esp
+  802dd1:	eb eb                	jmp    802dbe <devsock_close+0x1f>
+
+00802dd3 <devsock_write>:
+{
+  802dd3:	55                   	push   %ebp
+  802dd4:	89 e5                	mov    %esp,%ebp
+  802dd6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802dd9:	6a 00                	push   $0x0
+  802ddb:	ff 75 10             	push   0x10(%ebp)
+  802dde:	ff 75 0c             	push   0xc(%ebp)
+  802de1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de4:	ff 70 0c             	push   0xc(%eax)
+  802de7:	e8 79 03 00 00       	call   803165 <nsipc_send>
+}
+  802dec:	c9                   	leave
+  802ded:	c3                   	ret
+
+00802dee <devsock_read>:
+{
+  802dee:	55                   	push   %ebp
+  802def:	89 e5                	mov    %esp,%ebp
+  802df1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802df4:	6a 00                	push   $0x0
+  802df6:	ff 75 10             	push   0x10(%ebp)
+  802df9:	ff 75 0c             	push   0xc(%ebp)
+  802dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dff:	ff 70 0c             	push   0xc(%eax)
+  802e02:	e8 ef 02 00 00       	call   8030f6 <nsipc_recv>
+}
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+
+00802e09 <fd2sockid>:
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802e0f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802e12:	52                   	push   %edx
+  802e13:	50                   	push   %eax
+  802e14:	e8 da e3 ff ff       	call   8011f3 <fd_lookup>
+  802e19:	83 c4 10             	add    $0x10,%esp
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	78 10                	js     802e30 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802e20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e23:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802e29:	39 08                	cmp    %ecx,(%eax)
+  802e2b:	75 05                	jne    802e32 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802e2d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+		return -E_NOT_SUPP;
+  802e32:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e37:	eb f7                	jmp    802e30 <fd2sockid+0x27>
+
+00802e39 <alloc_sockfd>:
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	56                   	push   %esi
+  802e3d:	53                   	push   %ebx
+  802e3e:	83 ec 1c             	sub    $0x1c,%esp
+  802e41:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802e43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e46:	50                   	push   %eax
+  802e47:	e8 51 e3 ff ff       	call   80119d <fd_alloc>
+  802e4c:	89 c3                	mov    %eax,%ebx
+  802e4e:	83 c4 10             	add    $0x10,%esp
+  802e51:	85 c0                	test   %eax,%eax
+  802e53:	78 43                	js     802e98 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802e55:	83 ec 04             	sub    $0x4,%esp
+  802e58:	68 07 04 00 00       	push   $0x407
+  802e5d:	ff 75 f4             	push   -0xc(%ebp)
+  802e60:	6a 00                	push   $0x0
+  802e62:	e8 6d de ff ff       	call   800cd4 <sys_page_alloc>
+  802e67:	89 c3                	mov    %eax,%ebx
+  802e69:	83 c4 10             	add    $0x10,%esp
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	78 28                	js     802e98 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e73:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802e79:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802e7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e7e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802e85:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802e88:	83 ec 0c             	sub    $0xc,%esp
+  802e8b:	50                   	push   %eax
+  802e8c:	e8 e5 e2 ff ff       	call   801176 <fd2num>
+  802e91:	89 c3                	mov    %eax,%ebx
+  802e93:	83 c4 10             	add    $0x10,%esp
+  802e96:	eb 0c                	jmp    802ea4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e98:	83 ec 0c             	sub    $0xc,%esp
+  802e9b:	56                   	push   %esi
+  802e9c:	e8 e4 01 00 00       	call   803085 <nsipc_close>
+		return r;
+  802ea1:	83 c4 10             	add    $0x10,%esp
+}
+  802ea4:	89 d8                	mov    %ebx,%eax
+  802ea6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea9:	5b                   	pop    %ebx
+  802eaa:	5e                   	pop    %esi
+  802eab:	5d                   	pop    %ebp
+  802eac:	c3                   	ret
+
+00802ead <accept>:
+{
+  802ead:	55                   	push   %ebp
+  802eae:	89 e5                	mov    %esp,%ebp
+  802eb0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb6:	e8 4e ff ff ff       	call   802e09 <fd2sockid>
+  802ebb:	85 c0                	test   %eax,%eax
+  802ebd:	78 1b                	js     802eda <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802ebf:	83 ec 04             	sub    $0x4,%esp
+  802ec2:	ff 75 10             	push   0x10(%ebp)
+  802ec5:	ff 75 0c             	push   0xc(%ebp)
+  802ec8:	50                   	push   %eax
+  802ec9:	e8 0e 01 00 00       	call   802fdc <nsipc_accept>
+  802ece:	83 c4 10             	add    $0x10,%esp
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	78 05                	js     802eda <accept+0x2d>
+	return alloc_sockfd(r);
+  802ed5:	e8 5f ff ff ff       	call   802e39 <alloc_sockfd>
+}
+  802eda:	c9                   	leave
+  802edb:	c3                   	ret
+
+00802edc <bind>:
+{
+  802edc:	55                   	push   %ebp
+  802edd:	89 e5                	mov    %esp,%ebp
+  802edf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ee2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee5:	e8 1f ff ff ff       	call   802e09 <fd2sockid>
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	78 12                	js     802f00 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802eee:	83 ec 04             	sub    $0x4,%esp
+  802ef1:	ff 75 10             	push   0x10(%ebp)
+  802ef4:	ff 75 0c             	push   0xc(%ebp)
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 31 01 00 00       	call   80302e <nsipc_bind>
+  802efd:	83 c4 10             	add    $0x10,%esp
+}
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <shutdown>:
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0b:	e8 f9 fe ff ff       	call   802e09 <fd2sockid>
+  802f10:	85 c0                	test   %eax,%eax
+  802f12:	78 0f                	js     802f23 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802f14:	83 ec 08             	sub    $0x8,%esp
+  802f17:	ff 75 0c             	push   0xc(%ebp)
+  802f1a:	50                   	push   %eax
+  802f1b:	e8 43 01 00 00       	call   803063 <nsipc_shutdown>
+  802f20:	83 c4 10             	add    $0x10,%esp
+}
+  802f23:	c9                   	leave
+  802f24:	c3                   	ret
+
+00802f25 <connect>:
+{
+  802f25:	55                   	push   %ebp
+  802f26:	89 e5                	mov    %esp,%ebp
+  802f28:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2e:	e8 d6 fe ff ff       	call   802e09 <fd2sockid>
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	78 12                	js     802f49 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802f37:	83 ec 04             	sub    $0x4,%esp
+  802f3a:	ff 75 10             	push   0x10(%ebp)
+  802f3d:	ff 75 0c             	push   0xc(%ebp)
+  802f40:	50                   	push   %eax
+  802f41:	e8 59 01 00 00       	call   80309f <nsipc_connect>
+  802f46:	83 c4 10             	add    $0x10,%esp
+}
+  802f49:	c9                   	leave
+  802f4a:	c3                   	ret
+
+00802f4b <listen>:
+{
+  802f4b:	55                   	push   %ebp
+  802f4c:	89 e5                	mov    %esp,%ebp
+  802f4e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f54:	e8 b0 fe ff ff       	call   802e09 <fd2sockid>
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	78 0f                	js     802f6c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802f5d:	83 ec 08             	sub    $0x8,%esp
+  802f60:	ff 75 0c             	push   0xc(%ebp)
+  802f63:	50                   	push   %eax
+  802f64:	e8 6b 01 00 00       	call   8030d4 <nsipc_listen>
+  802f69:	83 c4 10             	add    $0x10,%esp
+}
+  802f6c:	c9                   	leave
+  802f6d:	c3                   	ret
+
+00802f6e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802f6e:	55                   	push   %ebp
+  802f6f:	89 e5                	mov    %esp,%ebp
+  802f71:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802f74:	ff 75 10             	push   0x10(%ebp)
+  802f77:	ff 75 0c             	push   0xc(%ebp)
+  802f7a:	ff 75 08             	push   0x8(%ebp)
+  802f7d:	e8 41 02 00 00       	call   8031c3 <nsipc_socket>
+  802f82:	83 c4 10             	add    $0x10,%esp
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 05                	js     802f8e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802f89:	e8 ab fe ff ff       	call   802e39 <alloc_sockfd>
+}
+  802f8e:	c9                   	leave
+  802f8f:	c3                   	ret
+
+00802f90 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f90:	55                   	push   %ebp
+  802f91:	89 e5                	mov    %esp,%ebp
+  802f93:	53                   	push   %ebx
+  802f94:	83 ec 04             	sub    $0x4,%esp
+  802f97:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f99:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802fa0:	74 26                	je     802fc8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802fa2:	6a 07                	push   $0x7
+  802fa4:	68 00 90 80 00       	push   $0x809000
+  802fa9:	53                   	push   %ebx
+  802faa:	ff 35 08 70 80 00    	push   0x807008
+  802fb0:	e8 88 1a 00 00       	call   804a3d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802fb5:	83 c4 0c             	add    $0xc,%esp
+  802fb8:	6a 00                	push   $0x0
+  802fba:	6a 00                	push   $0x0
+  802fbc:	6a 00                	push   $0x0
+  802fbe:	e8 84 19 00 00       	call   804947 <ipc_recv>
+}
+  802fc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fc6:	c9                   	leave
+  802fc7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fc8:	83 ec 0c             	sub    $0xc,%esp
+  802fcb:	6a 02                	push   $0x2
+  802fcd:	e8 c1 1a 00 00       	call   804a93 <ipc_find_env>
+  802fd2:	a3 08 70 80 00       	mov    %eax,0x807008
+  802fd7:	83 c4 10             	add    $0x10,%esp
+  802fda:	eb c6                	jmp    802fa2 <nsipc+0x12>
+
+00802fdc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802fdc:	55                   	push   %ebp
+  802fdd:	89 e5                	mov    %esp,%ebp
+  802fdf:	56                   	push   %esi
+  802fe0:	53                   	push   %ebx
+  802fe1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802fec:	8b 06                	mov    (%esi),%eax
+  802fee:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ff3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ff8:	e8 93 ff ff ff       	call   802f90 <nsipc>
+  802ffd:	89 c3                	mov    %eax,%ebx
+  802fff:	85 c0                	test   %eax,%eax
+  803001:	79 09                	jns    80300c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803003:	89 d8                	mov    %ebx,%eax
+  803005:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803008:	5b                   	pop    %ebx
+  803009:	5e                   	pop    %esi
+  80300a:	5d                   	pop    %ebp
+  80300b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80300c:	83 ec 04             	sub    $0x4,%esp
+  80300f:	ff 35 10 90 80 00    	push   0x809010
+  803015:	68 00 90 80 00       	push   $0x809000
+  80301a:	ff 75 0c             	push   0xc(%ebp)
+  80301d:	e8 fa d9 ff ff       	call   800a1c <memmove>
+		*addrlen = ret->ret_addrlen;
+  803022:	a1 10 90 80 00       	mov    0x809010,%eax
+  803027:	89 06                	mov    %eax,(%esi)
+  803029:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80302c:	eb d5                	jmp    803003 <nsipc_accept+0x27>
+
+0080302e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80302e:	55                   	push   %ebp
+  80302f:	89 e5                	mov    %esp,%ebp
+  803031:	53                   	push   %ebx
+  803032:	83 ec 08             	sub    $0x8,%esp
+  803035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803038:	8b 45 08             	mov    0x8(%ebp),%eax
+  80303b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803040:	53                   	push   %ebx
+  803041:	ff 75 0c             	push   0xc(%ebp)
+  803044:	68 04 90 80 00       	push   $0x809004
+  803049:	e8 ce d9 ff ff       	call   800a1c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80304e:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803054:	b8 02 00 00 00       	mov    $0x2,%eax
+  803059:	e8 32 ff ff ff       	call   802f90 <nsipc>
+}
+  80305e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+
+00803063 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803071:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803074:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803079:	b8 03 00 00 00       	mov    $0x3,%eax
+  80307e:	e8 0d ff ff ff       	call   802f90 <nsipc>
+}
+  803083:	c9                   	leave
+  803084:	c3                   	ret
+
+00803085 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803085:	55                   	push   %ebp
+  803086:	89 e5                	mov    %esp,%ebp
+  803088:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80308b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308e:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803093:	b8 04 00 00 00       	mov    $0x4,%eax
+  803098:	e8 f3 fe ff ff       	call   802f90 <nsipc>
+}
+  80309d:	c9                   	leave
+  80309e:	c3                   	ret
+
+0080309f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80309f:	55                   	push   %ebp
+  8030a0:	89 e5                	mov    %esp,%ebp
+  8030a2:	53                   	push   %ebx
+  8030a3:	83 ec 08             	sub    $0x8,%esp
+  8030a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8030a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ac:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8030b1:	53                   	push   %ebx
+  8030b2:	ff 75 0c             	push   0xc(%ebp)
+  8030b5:	68 04 90 80 00       	push   $0x809004
+  8030ba:	e8 5d d9 ff ff       	call   800a1c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8030bf:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8030c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030ca:	e8 c1 fe ff ff       	call   802f90 <nsipc>
+}
+  8030cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030d2:	c9                   	leave
+  8030d3:	c3                   	ret
+
+008030d4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8030d4:	55                   	push   %ebp
+  8030d5:	89 e5                	mov    %esp,%ebp
+  8030d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8030da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030dd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8030e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030e5:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8030ea:	b8 06 00 00 00       	mov    $0x6,%eax
+  8030ef:	e8 9c fe ff ff       	call   802f90 <nsipc>
+}
+  8030f4:	c9                   	leave
+  8030f5:	c3                   	ret
+
+008030f6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8030f6:	55                   	push   %ebp
+  8030f7:	89 e5                	mov    %esp,%ebp
+  8030f9:	56                   	push   %esi
+  8030fa:	53                   	push   %ebx
+  8030fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8030fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803101:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803106:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80310c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80310f:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803114:	b8 07 00 00 00       	mov    $0x7,%eax
+  803119:	e8 72 fe ff ff       	call   802f90 <nsipc>
+  80311e:	89 c3                	mov    %eax,%ebx
+  803120:	85 c0                	test   %eax,%eax
+  803122:	78 22                	js     803146 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803124:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803129:	39 c6                	cmp    %eax,%esi
+  80312b:	0f 4e c6             	cmovle %esi,%eax
+  80312e:	39 c3                	cmp    %eax,%ebx
+  803130:	7f 1d                	jg     80314f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803132:	83 ec 04             	sub    $0x4,%esp
+  803135:	53                   	push   %ebx
+  803136:	68 00 90 80 00       	push   $0x809000
+  80313b:	ff 75 0c             	push   0xc(%ebp)
+  80313e:	e8 d9 d8 ff ff       	call   800a1c <memmove>
+  803143:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803146:	89 d8                	mov    %ebx,%eax
+  803148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80314b:	5b                   	pop    %ebx
+  80314c:	5e                   	pop    %esi
+  80314d:	5d                   	pop    %ebp
+  80314e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80314f:	68 16 54 80 00       	push   $0x805416
+  803154:	68 1d 53 80 00       	push   $0x80531d
+  803159:	6a 62                	push   $0x62
+  80315b:	68 2b 54 80 00       	push   $0x80542b
+  803160:	e8 72 d0 ff ff       	call   8001d7 <_panic>
+
+00803165 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803165:	55                   	push   %ebp
+  803166:	89 e5                	mov    %esp,%ebp
+  803168:	53                   	push   %ebx
+  803169:	83 ec 04             	sub    $0x4,%esp
+  80316c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80316f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803172:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803177:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80317d:	7f 2e                	jg     8031ad <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80317f:	83 ec 04             	sub    $0x4,%esp
+  803182:	53                   	push   %ebx
+  803183:	ff 75 0c             	push   0xc(%ebp)
+  803186:	68 0c 90 80 00       	push   $0x80900c
+  80318b:	e8 8c d8 ff ff       	call   800a1c <memmove>
+	nsipcbuf.send.req_size = size;
+  803190:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803196:	8b 45 14             	mov    0x14(%ebp),%eax
+  803199:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80319e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031a3:	e8 e8 fd ff ff       	call   802f90 <nsipc>
+}
+  8031a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ab:	c9                   	leave
+  8031ac:	c3                   	ret
+	assert(size < 1600);
+  8031ad:	68 37 54 80 00       	push   $0x805437
+  8031b2:	68 1d 53 80 00       	push   $0x80531d
+  8031b7:	6a 6d                	push   $0x6d
+  8031b9:	68 2b 54 80 00       	push   $0x80542b
+  8031be:	e8 14 d0 ff ff       	call   8001d7 <_panic>
+
+008031c3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8031c3:	55                   	push   %ebp
+  8031c4:	89 e5                	mov    %esp,%ebp
+  8031c6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8031c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031cc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8031d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d4:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8031d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031dc:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8031e1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8031e6:	e8 a5 fd ff ff       	call   802f90 <nsipc>
+}
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+
+008031ed <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	53                   	push   %ebx
+  8031f1:	83 ec 10             	sub    $0x10,%esp
+  8031f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8031f7:	68 0c 70 80 00       	push   $0x80700c
+  8031fc:	e8 50 07 00 00       	call   803951 <mutex_lock>
+	if (v == 0)
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	85 db                	test   %ebx,%ebx
+  803206:	0f 84 85 00 00 00    	je     803291 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80320c:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803212:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803217:	77 51                	ja     80326a <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803219:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80321f:	89 d8                	mov    %ebx,%eax
+  803221:	c1 e8 0c             	shr    $0xc,%eax
+  803224:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80322b:	f6 c4 02             	test   $0x2,%ah
+  80322e:	74 50                	je     803280 <free+0x93>
+		sys_page_unmap(0, c);
+  803230:	83 ec 08             	sub    $0x8,%esp
+  803233:	53                   	push   %ebx
+  803234:	6a 00                	push   $0x0
+  803236:	e8 32 db ff ff       	call   800d6d <sys_page_unmap>
+		c += PGSIZE;
+  80323b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803241:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803247:	83 c4 10             	add    $0x10,%esp
+  80324a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80324f:	76 ce                	jbe    80321f <free+0x32>
+  803251:	68 7f 54 80 00       	push   $0x80547f
+  803256:	68 1d 53 80 00       	push   $0x80531d
+  80325b:	68 82 00 00 00       	push   $0x82
+  803260:	68 72 54 80 00       	push   $0x805472
+  803265:	e8 6d cf ff ff       	call   8001d7 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80326a:	68 44 54 80 00       	push   $0x805444
+  80326f:	68 1d 53 80 00       	push   $0x80531d
+  803274:	6a 7b                	push   $0x7b
+  803276:	68 72 54 80 00       	push   $0x805472
+  80327b:	e8 57 cf ff ff       	call   8001d7 <_panic>
+	if (--(*ref) == 0)
+  803280:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803286:	83 e8 01             	sub    $0x1,%eax
+  803289:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80328f:	74 15                	je     8032a6 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803291:	83 ec 0c             	sub    $0xc,%esp
+  803294:	68 0c 70 80 00       	push   $0x80700c
+  803299:	e8 20 07 00 00       	call   8039be <mutex_unlock>
+}
+  80329e:	83 c4 10             	add    $0x10,%esp
+  8032a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+		sys_page_unmap(0, c);
+  8032a6:	83 ec 08             	sub    $0x8,%esp
+  8032a9:	53                   	push   %ebx
+  8032aa:	6a 00                	push   $0x0
+  8032ac:	e8 bc da ff ff       	call   800d6d <sys_page_unmap>
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	eb db                	jmp    803291 <free+0xa4>
+
+008032b6 <malloc>:
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	57                   	push   %edi
+  8032ba:	56                   	push   %esi
+  8032bb:	53                   	push   %ebx
+  8032bc:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8032bf:	68 0c 70 80 00       	push   $0x80700c
+  8032c4:	e8 88 06 00 00       	call   803951 <mutex_lock>
+	if (mptr == 0)
+  8032c9:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8032cf:	83 c4 10             	add    $0x10,%esp
+  8032d2:	85 ff                	test   %edi,%edi
+  8032d4:	74 6c                	je     803342 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8032d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d9:	83 c0 03             	add    $0x3,%eax
+  8032dc:	83 e0 fc             	and    $0xfffffffc,%eax
+  8032df:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8032e1:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8032e6:	0f 87 64 01 00 00    	ja     803450 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8032ec:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8032f2:	74 30                	je     803324 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8032f4:	89 f9                	mov    %edi,%ecx
+  8032f6:	c1 e9 0c             	shr    $0xc,%ecx
+  8032f9:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8032fd:	c1 e8 0c             	shr    $0xc,%eax
+  803300:	39 c1                	cmp    %eax,%ecx
+  803302:	74 5f                	je     803363 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803304:	83 ec 0c             	sub    $0xc,%esp
+  803307:	57                   	push   %edi
+  803308:	e8 e0 fe ff ff       	call   8031ed <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80330d:	a1 10 70 80 00       	mov    0x807010,%eax
+  803312:	05 00 10 00 00       	add    $0x1000,%eax
+  803317:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80331c:	a3 10 70 80 00       	mov    %eax,0x807010
+  803321:	83 c4 10             	add    $0x10,%esp
+  803324:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  80332a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80332f:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803333:	8d 7e 04             	lea    0x4(%esi),%edi
+  803336:	89 cb                	mov    %ecx,%ebx
+  803338:	01 f9                	add    %edi,%ecx
+  80333a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80333d:	e9 8b 00 00 00       	jmp    8033cd <malloc+0x117>
+		mptr = mbegin;
+  803342:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803349:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80334c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334f:	83 c0 03             	add    $0x3,%eax
+  803352:	83 e0 fc             	and    $0xfffffffc,%eax
+  803355:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803357:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80335c:	76 c6                	jbe    803324 <malloc+0x6e>
+  80335e:	e9 d6 00 00 00       	jmp    803439 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803363:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803369:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80336e:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803372:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803375:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  80337a:	e9 ba 00 00 00       	jmp    803439 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80337f:	05 00 10 00 00       	add    $0x1000,%eax
+  803384:	39 c8                	cmp    %ecx,%eax
+  803386:	0f 83 cb 00 00 00    	jae    803457 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80338c:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803391:	77 22                	ja     8033b5 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803393:	89 c2                	mov    %eax,%edx
+  803395:	c1 ea 16             	shr    $0x16,%edx
+  803398:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80339f:	f6 c2 01             	test   $0x1,%dl
+  8033a2:	74 db                	je     80337f <malloc+0xc9>
+  8033a4:	89 c2                	mov    %eax,%edx
+  8033a6:	c1 ea 0c             	shr    $0xc,%edx
+  8033a9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8033b0:	f6 c2 01             	test   $0x1,%dl
+  8033b3:	74 ca                	je     80337f <malloc+0xc9>
+		if (mptr == mend) {
+  8033b5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8033bb:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8033c1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8033c5:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8033cb:	74 04                	je     8033d1 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8033cd:	89 d8                	mov    %ebx,%eax
+  8033cf:	eb b3                	jmp    803384 <malloc+0xce>
+  8033d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8033d4:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8033d9:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8033dd:	83 ea 01             	sub    $0x1,%edx
+  8033e0:	0f 85 50 ff ff ff    	jne    803336 <malloc+0x80>
+  8033e6:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8033ed:	00 00 08 
+				return 0;	/* out of address space */
+  8033f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f5:	eb 42                	jmp    803439 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8033f7:	85 db                	test   %ebx,%ebx
+  8033f9:	78 1e                	js     803419 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8033fb:	83 ec 08             	sub    $0x8,%esp
+  8033fe:	89 d8                	mov    %ebx,%eax
+  803400:	03 05 10 70 80 00    	add    0x807010,%eax
+  803406:	50                   	push   %eax
+  803407:	6a 00                	push   $0x0
+  803409:	e8 5f d9 ff ff       	call   800d6d <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80340e:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803414:	83 c4 10             	add    $0x10,%esp
+  803417:	eb de                	jmp    8033f7 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803419:	bf 00 00 00 00       	mov    $0x0,%edi
+  80341e:	eb 19                	jmp    803439 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803420:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803423:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803429:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803430:	00 
+	mptr += n;
+  803431:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803434:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803439:	83 ec 0c             	sub    $0xc,%esp
+  80343c:	68 0c 70 80 00       	push   $0x80700c
+  803441:	e8 78 05 00 00       	call   8039be <mutex_unlock>
+}
+  803446:	89 f8                	mov    %edi,%eax
+  803448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80344b:	5b                   	pop    %ebx
+  80344c:	5e                   	pop    %esi
+  80344d:	5f                   	pop    %edi
+  80344e:	5d                   	pop    %ebp
+  80344f:	c3                   	ret
+		return 0;
+  803450:	bf 00 00 00 00       	mov    $0x0,%edi
+  803455:	eb e2                	jmp    803439 <malloc+0x183>
+  803457:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80345b:	74 06                	je     803463 <malloc+0x1ad>
+  80345d:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803463:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803468:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80346b:	39 fb                	cmp    %edi,%ebx
+  80346d:	73 b1                	jae    803420 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80346f:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803475:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803478:	39 fe                	cmp    %edi,%esi
+  80347a:	0f 92 c0             	setb   %al
+  80347d:	0f b6 c0             	movzbl %al,%eax
+  803480:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803483:	83 c8 07             	or     $0x7,%eax
+  803486:	50                   	push   %eax
+  803487:	89 d8                	mov    %ebx,%eax
+  803489:	03 05 10 70 80 00    	add    0x807010,%eax
+  80348f:	50                   	push   %eax
+  803490:	6a 00                	push   $0x0
+  803492:	e8 3d d8 ff ff       	call   800cd4 <sys_page_alloc>
+  803497:	83 c4 10             	add    $0x10,%esp
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	0f 88 55 ff ff ff    	js     8033f7 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8034a2:	89 f3                	mov    %esi,%ebx
+  8034a4:	eb c5                	jmp    80346b <malloc+0x1b5>
+
+008034a6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034a6:	55                   	push   %ebp
+  8034a7:	89 e5                	mov    %esp,%ebp
+  8034a9:	56                   	push   %esi
+  8034aa:	53                   	push   %ebx
+  8034ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8034ae:	83 ec 0c             	sub    $0xc,%esp
+  8034b1:	ff 75 08             	push   0x8(%ebp)
+  8034b4:	e8 cd dc ff ff       	call   801186 <fd2data>
+  8034b9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8034bb:	83 c4 08             	add    $0x8,%esp
+  8034be:	68 97 54 80 00       	push   $0x805497
+  8034c3:	53                   	push   %ebx
+  8034c4:	e8 cd d3 ff ff       	call   800896 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8034c9:	8b 46 04             	mov    0x4(%esi),%eax
+  8034cc:	2b 06                	sub    (%esi),%eax
+  8034ce:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8034d4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8034db:	00 00 00 
+	stat->st_dev = &devpipe;
+  8034de:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8034e5:	62 80 00 
+	return 0;
+}
+  8034e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034f0:	5b                   	pop    %ebx
+  8034f1:	5e                   	pop    %esi
+  8034f2:	5d                   	pop    %ebp
+  8034f3:	c3                   	ret
+
+008034f4 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8034f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034f9:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8034fd:	85 c9                	test   %ecx,%ecx
+  8034ff:	75 01                	jne    803502 <pipewake+0xe>
+  803501:	c3                   	ret
+{
+  803502:	55                   	push   %ebp
+  803503:	89 e5                	mov    %esp,%ebp
+  803505:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803508:	68 00 04 00 00       	push   $0x400
+  80350d:	52                   	push   %edx
+  80350e:	e8 05 db ff ff       	call   801018 <sys_futex_wake>
+  803513:	83 c4 10             	add    $0x10,%esp
+}
+  803516:	c9                   	leave
+  803517:	c3                   	ret
+
+00803518 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	56                   	push   %esi
+  80351c:	53                   	push   %ebx
+  80351d:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803520:	83 ec 0c             	sub    $0xc,%esp
+  803523:	56                   	push   %esi
+  803524:	e8 5d dc ff ff       	call   801186 <fd2data>
+  803529:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80352b:	83 c4 08             	add    $0x8,%esp
+  80352e:	56                   	push   %esi
+  80352f:	6a 00                	push   $0x0
+  803531:	e8 37 d8 ff ff       	call   800d6d <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803536:	8d 53 04             	lea    0x4(%ebx),%edx
+  803539:	8d 43 08             	lea    0x8(%ebx),%eax
+  80353c:	e8 b3 ff ff ff       	call   8034f4 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803541:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803544:	89 da                	mov    %ebx,%edx
+  803546:	e8 a9 ff ff ff       	call   8034f4 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80354b:	89 34 24             	mov    %esi,(%esp)
+  80354e:	e8 33 dc ff ff       	call   801186 <fd2data>
+  803553:	83 c4 08             	add    $0x8,%esp
+  803556:	50                   	push   %eax
+  803557:	6a 00                	push   $0x0
+  803559:	e8 0f d8 ff ff       	call   800d6d <sys_page_unmap>
+}
+  80355e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803561:	5b                   	pop    %ebx
+  803562:	5e                   	pop    %esi
+  803563:	5d                   	pop    %ebp
+  803564:	c3                   	ret
+
+00803565 <_pipeisclosed>:
+{
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	57                   	push   %edi
+  803569:	56                   	push   %esi
+  80356a:	53                   	push   %ebx
+  80356b:	83 ec 1c             	sub    $0x1c,%esp
+  80356e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803571:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803573:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803578:	eb 5d                	jmp    8035d7 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80357a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803580:	8b 02                	mov    (%edx),%eax
+  803582:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803585:	83 ec 0c             	sub    $0xc,%esp
+  803588:	ff 75 e0             	push   -0x20(%ebp)
+  80358b:	e8 42 15 00 00       	call   804ad2 <pageref>
+  803590:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803593:	89 3c 24             	mov    %edi,(%esp)
+  803596:	e8 37 15 00 00       	call   804ad2 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80359b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80359d:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8035a3:	83 c4 10             	add    $0x10,%esp
+  8035a6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8035ac:	77 15                	ja     8035c3 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035ae:	89 f2                	mov    %esi,%edx
+  8035b0:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8035b2:	c1 ea 10             	shr    $0x10,%edx
+  8035b5:	74 0c                	je     8035c3 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8035b7:	c1 e2 10             	shl    $0x10,%edx
+  8035ba:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8035bf:	29 d1                	sub    %edx,%ecx
+  8035c1:	eb 06                	jmp    8035c9 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8035c3:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  8035c9:	8b 11                	mov    (%ecx),%edx
+  8035cb:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8035ce:	39 d3                	cmp    %edx,%ebx
+  8035d0:	74 6e                	je     803640 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8035d2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035d5:	74 24                	je     8035fb <_pipeisclosed+0x96>
+  8035d7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8035d9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8035df:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8035e4:	77 94                	ja     80357a <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035e6:	89 f0                	mov    %esi,%eax
+  8035e8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8035ea:	c1 e8 10             	shr    $0x10,%eax
+  8035ed:	74 8b                	je     80357a <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8035ef:	c1 e0 10             	shl    $0x10,%eax
+  8035f2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8035f7:	29 c2                	sub    %eax,%edx
+  8035f9:	eb 85                	jmp    803580 <_pipeisclosed+0x1b>
+  8035fb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8035fd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803603:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803608:	77 18                	ja     803622 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80360a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80360f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803611:	c1 e8 10             	shr    $0x10,%eax
+  803614:	74 0c                	je     803622 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803616:	c1 e0 10             	shl    $0x10,%eax
+  803619:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80361e:	29 c2                	sub    %eax,%edx
+  803620:	eb 06                	jmp    803628 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803622:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803628:	8b 02                	mov    (%edx),%eax
+  80362a:	8b 40 58             	mov    0x58(%eax),%eax
+  80362d:	6a 01                	push   $0x1
+  80362f:	50                   	push   %eax
+  803630:	53                   	push   %ebx
+  803631:	68 9e 54 80 00       	push   $0x80549e
+  803636:	e8 77 cc ff ff       	call   8002b2 <cprintf>
+  80363b:	83 c4 10             	add    $0x10,%esp
+  80363e:	eb 97                	jmp    8035d7 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803640:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803643:	0f 94 c0             	sete   %al
+  803646:	0f b6 c0             	movzbl %al,%eax
+}
+  803649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80364c:	5b                   	pop    %ebx
+  80364d:	5e                   	pop    %esi
+  80364e:	5f                   	pop    %edi
+  80364f:	5d                   	pop    %ebp
+  803650:	c3                   	ret
+
+00803651 <devpipe_write>:
+{
+  803651:	55                   	push   %ebp
+  803652:	89 e5                	mov    %esp,%ebp
+  803654:	57                   	push   %edi
+  803655:	56                   	push   %esi
+  803656:	53                   	push   %ebx
+  803657:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80365a:	ff 75 08             	push   0x8(%ebp)
+  80365d:	e8 24 db ff ff       	call   801186 <fd2data>
+  803662:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803664:	83 c4 10             	add    $0x10,%esp
+  803667:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80366e:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803671:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803674:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803677:	0f 84 96 00 00 00    	je     803713 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80367d:	8d 73 08             	lea    0x8(%ebx),%esi
+  803680:	eb 32                	jmp    8036b4 <devpipe_write+0x63>
+  803682:	89 fa                	mov    %edi,%edx
+  803684:	89 f0                	mov    %esi,%eax
+  803686:	e8 69 fe ff ff       	call   8034f4 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80368b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80368e:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803691:	ba 01 00 00 00       	mov    $0x1,%edx
+  803696:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80369b:	83 ec 04             	sub    $0x4,%esp
+  80369e:	6a 0a                	push   $0xa
+  8036a0:	50                   	push   %eax
+  8036a1:	53                   	push   %ebx
+  8036a2:	e8 42 d9 ff ff       	call   800fe9 <sys_futex_wait>
+  8036a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8036ac:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8036b1:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8036b4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8036b7:	8b 0b                	mov    (%ebx),%ecx
+  8036b9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8036bc:	39 d0                	cmp    %edx,%eax
+  8036be:	72 1b                	jb     8036db <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8036c0:	89 da                	mov    %ebx,%edx
+  8036c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c5:	e8 9b fe ff ff       	call   803565 <_pipeisclosed>
+  8036ca:	85 c0                	test   %eax,%eax
+  8036cc:	74 b4                	je     803682 <devpipe_write+0x31>
+				return 0;
+  8036ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d6:	5b                   	pop    %ebx
+  8036d7:	5e                   	pop    %esi
+  8036d8:	5f                   	pop    %edi
+  8036d9:	5d                   	pop    %ebp
+  8036da:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8036db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036de:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8036e1:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8036e5:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8036e8:	89 c2                	mov    %eax,%edx
+  8036ea:	c1 fa 1f             	sar    $0x1f,%edx
+  8036ed:	89 d1                	mov    %edx,%ecx
+  8036ef:	c1 e9 1b             	shr    $0x1b,%ecx
+  8036f2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8036f5:	83 e2 1f             	and    $0x1f,%edx
+  8036f8:	29 ca                	sub    %ecx,%edx
+  8036fa:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8036fe:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803702:	83 c0 01             	add    $0x1,%eax
+  803705:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803708:	83 c6 01             	add    $0x1,%esi
+  80370b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80370e:	e9 5e ff ff ff       	jmp    803671 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803713:	8d 53 04             	lea    0x4(%ebx),%edx
+  803716:	8d 43 08             	lea    0x8(%ebx),%eax
+  803719:	e8 d6 fd ff ff       	call   8034f4 <pipewake>
+	return i;
+  80371e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803721:	eb b0                	jmp    8036d3 <devpipe_write+0x82>
+
+00803723 <devpipe_read>:
+{
+  803723:	55                   	push   %ebp
+  803724:	89 e5                	mov    %esp,%ebp
+  803726:	57                   	push   %edi
+  803727:	56                   	push   %esi
+  803728:	53                   	push   %ebx
+  803729:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80372c:	ff 75 08             	push   0x8(%ebp)
+  80372f:	e8 52 da ff ff       	call   801186 <fd2data>
+  803734:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803736:	83 c4 10             	add    $0x10,%esp
+  803739:	be 00 00 00 00       	mov    $0x0,%esi
+  80373e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803741:	74 6c                	je     8037af <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803743:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803746:	eb 25                	jmp    80376d <devpipe_read+0x4a>
+  803748:	8b 13                	mov    (%ebx),%edx
+  80374a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80374f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803754:	83 ec 04             	sub    $0x4,%esp
+  803757:	6a 0a                	push   $0xa
+  803759:	52                   	push   %edx
+  80375a:	57                   	push   %edi
+  80375b:	e8 89 d8 ff ff       	call   800fe9 <sys_futex_wait>
+  803760:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803765:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80376a:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80376d:	8b 03                	mov    (%ebx),%eax
+  80376f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803772:	75 19                	jne    80378d <devpipe_read+0x6a>
+			if (i > 0)
+  803774:	85 f6                	test   %esi,%esi
+  803776:	75 3a                	jne    8037b2 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803778:	89 da                	mov    %ebx,%edx
+  80377a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80377d:	e8 e3 fd ff ff       	call   803565 <_pipeisclosed>
+  803782:	85 c0                	test   %eax,%eax
+  803784:	74 c2                	je     803748 <devpipe_read+0x25>
+				return 0;
+  803786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378b:	eb 31                	jmp    8037be <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80378d:	89 c1                	mov    %eax,%ecx
+  80378f:	c1 f9 1f             	sar    $0x1f,%ecx
+  803792:	c1 e9 1b             	shr    $0x1b,%ecx
+  803795:	01 c8                	add    %ecx,%eax
+  803797:	83 e0 1f             	and    $0x1f,%eax
+  80379a:	29 c8                	sub    %ecx,%eax
+  80379c:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8037a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037a4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8037a7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8037aa:	83 c6 01             	add    $0x1,%esi
+  8037ad:	eb 8f                	jmp    80373e <devpipe_read+0x1b>
+out:
+  8037af:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8037b2:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8037b5:	89 da                	mov    %ebx,%edx
+  8037b7:	e8 38 fd ff ff       	call   8034f4 <pipewake>
+	return i;
+  8037bc:	89 f0                	mov    %esi,%eax
+}
+  8037be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c1:	5b                   	pop    %ebx
+  8037c2:	5e                   	pop    %esi
+  8037c3:	5f                   	pop    %edi
+  8037c4:	5d                   	pop    %ebp
+  8037c5:	c3                   	ret
+
+008037c6 <pipe>:
+{
+  8037c6:	55                   	push   %ebp
+  8037c7:	89 e5                	mov    %esp,%ebp
+  8037c9:	56                   	push   %esi
+  8037ca:	53                   	push   %ebx
+  8037cb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8037ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037d1:	50                   	push   %eax
+  8037d2:	e8 c6 d9 ff ff       	call   80119d <fd_alloc>
+  8037d7:	89 c3                	mov    %eax,%ebx
+  8037d9:	83 c4 10             	add    $0x10,%esp
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	0f 88 23 01 00 00    	js     803907 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037e4:	83 ec 04             	sub    $0x4,%esp
+  8037e7:	68 07 04 00 00       	push   $0x407
+  8037ec:	ff 75 f4             	push   -0xc(%ebp)
+  8037ef:	6a 00                	push   $0x0
+  8037f1:	e8 de d4 ff ff       	call   800cd4 <sys_page_alloc>
+  8037f6:	89 c3                	mov    %eax,%ebx
+  8037f8:	83 c4 10             	add    $0x10,%esp
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	0f 88 04 01 00 00    	js     803907 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803803:	83 ec 0c             	sub    $0xc,%esp
+  803806:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803809:	50                   	push   %eax
+  80380a:	e8 8e d9 ff ff       	call   80119d <fd_alloc>
+  80380f:	89 c3                	mov    %eax,%ebx
+  803811:	83 c4 10             	add    $0x10,%esp
+  803814:	85 c0                	test   %eax,%eax
+  803816:	0f 88 db 00 00 00    	js     8038f7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80381c:	83 ec 04             	sub    $0x4,%esp
+  80381f:	68 07 04 00 00       	push   $0x407
+  803824:	ff 75 f0             	push   -0x10(%ebp)
+  803827:	6a 00                	push   $0x0
+  803829:	e8 a6 d4 ff ff       	call   800cd4 <sys_page_alloc>
+  80382e:	89 c3                	mov    %eax,%ebx
+  803830:	83 c4 10             	add    $0x10,%esp
+  803833:	85 c0                	test   %eax,%eax
+  803835:	0f 88 bc 00 00 00    	js     8038f7 <pipe+0x131>
+	va = fd2data(fd0);
+  80383b:	83 ec 0c             	sub    $0xc,%esp
+  80383e:	ff 75 f4             	push   -0xc(%ebp)
+  803841:	e8 40 d9 ff ff       	call   801186 <fd2data>
+  803846:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803848:	83 c4 0c             	add    $0xc,%esp
+  80384b:	68 07 04 00 00       	push   $0x407
+  803850:	50                   	push   %eax
+  803851:	6a 00                	push   $0x0
+  803853:	e8 7c d4 ff ff       	call   800cd4 <sys_page_alloc>
+  803858:	89 c3                	mov    %eax,%ebx
+  80385a:	83 c4 10             	add    $0x10,%esp
+  80385d:	85 c0                	test   %eax,%eax
+  80385f:	0f 88 82 00 00 00    	js     8038e7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803865:	83 ec 0c             	sub    $0xc,%esp
+  803868:	ff 75 f0             	push   -0x10(%ebp)
+  80386b:	e8 16 d9 ff ff       	call   801186 <fd2data>
+  803870:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803877:	50                   	push   %eax
+  803878:	6a 00                	push   $0x0
+  80387a:	56                   	push   %esi
+  80387b:	6a 00                	push   $0x0
+  80387d:	e8 9f d4 ff ff       	call   800d21 <sys_page_map>
+  803882:	89 c3                	mov    %eax,%ebx
+  803884:	83 c4 20             	add    $0x20,%esp
+  803887:	85 c0                	test   %eax,%eax
+  803889:	78 4e                	js     8038d9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80388b:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803890:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803893:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803895:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803898:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80389f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8038a2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8038a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038a7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8038ae:	83 ec 0c             	sub    $0xc,%esp
+  8038b1:	ff 75 f4             	push   -0xc(%ebp)
+  8038b4:	e8 bd d8 ff ff       	call   801176 <fd2num>
+  8038b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038bc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8038be:	83 c4 04             	add    $0x4,%esp
+  8038c1:	ff 75 f0             	push   -0x10(%ebp)
+  8038c4:	e8 ad d8 ff ff       	call   801176 <fd2num>
+  8038c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038cc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8038cf:	83 c4 10             	add    $0x10,%esp
+  8038d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038d7:	eb 2e                	jmp    803907 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8038d9:	83 ec 08             	sub    $0x8,%esp
+  8038dc:	56                   	push   %esi
+  8038dd:	6a 00                	push   $0x0
+  8038df:	e8 89 d4 ff ff       	call   800d6d <sys_page_unmap>
+  8038e4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8038e7:	83 ec 08             	sub    $0x8,%esp
+  8038ea:	ff 75 f0             	push   -0x10(%ebp)
+  8038ed:	6a 00                	push   $0x0
+  8038ef:	e8 79 d4 ff ff       	call   800d6d <sys_page_unmap>
+  8038f4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8038f7:	83 ec 08             	sub    $0x8,%esp
+  8038fa:	ff 75 f4             	push   -0xc(%ebp)
+  8038fd:	6a 00                	push   $0x0
+  8038ff:	e8 69 d4 ff ff       	call   800d6d <sys_page_unmap>
+  803904:	83 c4 10             	add    $0x10,%esp
+}
+  803907:	89 d8                	mov    %ebx,%eax
+  803909:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80390c:	5b                   	pop    %ebx
+  80390d:	5e                   	pop    %esi
+  80390e:	5d                   	pop    %ebp
+  80390f:	c3                   	ret
+
+00803910 <pipeisclosed>:
+{
+  803910:	55                   	push   %ebp
+  803911:	89 e5                	mov    %esp,%ebp
+  803913:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803916:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803919:	50                   	push   %eax
+  80391a:	ff 75 08             	push   0x8(%ebp)
+  80391d:	e8 d1 d8 ff ff       	call   8011f3 <fd_lookup>
+  803922:	83 c4 10             	add    $0x10,%esp
+  803925:	85 c0                	test   %eax,%eax
+  803927:	78 18                	js     803941 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803929:	83 ec 0c             	sub    $0xc,%esp
+  80392c:	ff 75 f4             	push   -0xc(%ebp)
+  80392f:	e8 52 d8 ff ff       	call   801186 <fd2data>
+  803934:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803939:	e8 27 fc ff ff       	call   803565 <_pipeisclosed>
+  80393e:	83 c4 10             	add    $0x10,%esp
+}
+  803941:	c9                   	leave
+  803942:	c3                   	ret
+
+00803943 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803943:	55                   	push   %ebp
+  803944:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803946:	8b 45 08             	mov    0x8(%ebp),%eax
+  803949:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80394f:	5d                   	pop    %ebp
+  803950:	c3                   	ret
+
+00803951 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803951:	55                   	push   %ebp
+  803952:	89 e5                	mov    %esp,%ebp
+  803954:	56                   	push   %esi
+  803955:	53                   	push   %ebx
+  803956:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803959:	ba 00 00 00 00       	mov    $0x0,%edx
+  80395e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803963:	89 d0                	mov    %edx,%eax
+  803965:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803969:	85 c0                	test   %eax,%eax
+  80396b:	74 2d                	je     80399a <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80396d:	83 f8 02             	cmp    $0x2,%eax
+  803970:	74 08                	je     80397a <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803972:	b8 02 00 00 00       	mov    $0x2,%eax
+  803977:	f0 87 03             	lock xchg %eax,(%ebx)
+  80397a:	be 02 00 00 00       	mov    $0x2,%esi
+  80397f:	eb 15                	jmp    803996 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803981:	83 ec 04             	sub    $0x4,%esp
+  803984:	6a 00                	push   $0x0
+  803986:	6a 02                	push   $0x2
+  803988:	53                   	push   %ebx
+  803989:	e8 5b d6 ff ff       	call   800fe9 <sys_futex_wait>
+  80398e:	89 f0                	mov    %esi,%eax
+  803990:	f0 87 03             	lock xchg %eax,(%ebx)
+  803993:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803996:	85 c0                	test   %eax,%eax
+  803998:	75 e7                	jne    803981 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80399a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80399d:	5b                   	pop    %ebx
+  80399e:	5e                   	pop    %esi
+  80399f:	5d                   	pop    %ebp
+  8039a0:	c3                   	ret
+
+008039a1 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8039a1:	55                   	push   %ebp
+  8039a2:	89 e5                	mov    %esp,%ebp
+  8039a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8039a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8039b1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8039b5:	f7 d8                	neg    %eax
+  8039b7:	19 c0                	sbb    %eax,%eax
+  8039b9:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8039bc:	5d                   	pop    %ebp
+  8039bd:	c3                   	ret
+
+008039be <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8039be:	55                   	push   %ebp
+  8039bf:	89 e5                	mov    %esp,%ebp
+  8039c1:	83 ec 08             	sub    $0x8,%esp
+  8039c4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8039c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039cc:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8039cf:	83 f8 02             	cmp    $0x2,%eax
+  8039d2:	74 02                	je     8039d6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8039d4:	c9                   	leave
+  8039d5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8039d6:	83 ec 08             	sub    $0x8,%esp
+  8039d9:	6a 01                	push   $0x1
+  8039db:	52                   	push   %edx
+  8039dc:	e8 37 d6 ff ff       	call   801018 <sys_futex_wake>
+  8039e1:	83 c4 10             	add    $0x10,%esp
+}
+  8039e4:	eb ee                	jmp    8039d4 <mutex_unlock+0x16>
+
+008039e6 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8039e6:	55                   	push   %ebp
+  8039e7:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8039e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ec:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8039f2:	5d                   	pop    %ebp
+  8039f3:	c3                   	ret
+
+008039f4 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8039f4:	55                   	push   %ebp
+  8039f5:	89 e5                	mov    %esp,%ebp
+  8039f7:	57                   	push   %edi
+  8039f8:	56                   	push   %esi
+  8039f9:	53                   	push   %ebx
+  8039fa:	83 ec 18             	sub    $0x18,%esp
+  8039fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803a03:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803a05:	53                   	push   %ebx
+  803a06:	e8 b3 ff ff ff       	call   8039be <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803a0b:	83 c4 0c             	add    $0xc,%esp
+  803a0e:	ff 75 10             	push   0x10(%ebp)
+  803a11:	57                   	push   %edi
+  803a12:	56                   	push   %esi
+  803a13:	e8 d1 d5 ff ff       	call   800fe9 <sys_futex_wait>
+  803a18:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803a1a:	83 c4 10             	add    $0x10,%esp
+  803a1d:	be 02 00 00 00       	mov    $0x2,%esi
+  803a22:	eb 10                	jmp    803a34 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803a24:	83 ec 04             	sub    $0x4,%esp
+  803a27:	6a 00                	push   $0x0
+  803a29:	6a 02                	push   $0x2
+  803a2b:	53                   	push   %ebx
+  803a2c:	e8 b8 d5 ff ff       	call   800fe9 <sys_futex_wait>
+  803a31:	83 c4 10             	add    $0x10,%esp
+  803a34:	89 f0                	mov    %esi,%eax
+  803a36:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803a39:	85 c0                	test   %eax,%eax
+  803a3b:	75 e7                	jne    803a24 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803a3d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803a40:	74 05                	je     803a47 <cond_timedwait+0x53>
+  803a42:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803a47:	89 f8                	mov    %edi,%eax
+  803a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a4c:	5b                   	pop    %ebx
+  803a4d:	5e                   	pop    %esi
+  803a4e:	5f                   	pop    %edi
+  803a4f:	5d                   	pop    %ebp
+  803a50:	c3                   	ret
+
+00803a51 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803a51:	55                   	push   %ebp
+  803a52:	89 e5                	mov    %esp,%ebp
+  803a54:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803a57:	6a 00                	push   $0x0
+  803a59:	ff 75 0c             	push   0xc(%ebp)
+  803a5c:	ff 75 08             	push   0x8(%ebp)
+  803a5f:	e8 90 ff ff ff       	call   8039f4 <cond_timedwait>
+}
+  803a64:	83 c4 10             	add    $0x10,%esp
+  803a67:	c9                   	leave
+  803a68:	c3                   	ret
+
+00803a69 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803a69:	55                   	push   %ebp
+  803a6a:	89 e5                	mov    %esp,%ebp
+  803a6c:	83 ec 10             	sub    $0x10,%esp
+  803a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803a72:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a77:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803a7b:	6a 01                	push   $0x1
+  803a7d:	50                   	push   %eax
+  803a7e:	e8 95 d5 ff ff       	call   801018 <sys_futex_wake>
+}
+  803a83:	83 c4 10             	add    $0x10,%esp
+  803a86:	c9                   	leave
+  803a87:	c3                   	ret
+
+00803a88 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803a88:	55                   	push   %ebp
+  803a89:	89 e5                	mov    %esp,%ebp
+  803a8b:	83 ec 10             	sub    $0x10,%esp
+  803a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a91:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a96:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803a9a:	68 00 04 00 00       	push   $0x400
+  803a9f:	50                   	push   %eax
+  803aa0:	e8 73 d5 ff ff       	call   801018 <sys_futex_wake>
+}
+  803aa5:	83 c4 10             	add    $0x10,%esp
+  803aa8:	c9                   	leave
+  803aa9:	c3                   	ret
+
+00803aaa <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803aaa:	55                   	push   %ebp
+  803aab:	89 e5                	mov    %esp,%ebp
+  803aad:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803ab0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ab3:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803ab5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803abc:	5d                   	pop    %ebp
+  803abd:	c3                   	ret
+
+00803abe <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803abe:	55                   	push   %ebp
+  803abf:	89 e5                	mov    %esp,%ebp
+  803ac1:	53                   	push   %ebx
+  803ac2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803ac5:	8b 11                	mov    (%ecx),%edx
+  803ac7:	85 d2                	test   %edx,%edx
+  803ac9:	74 14                	je     803adf <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803acb:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ace:	89 d0                	mov    %edx,%eax
+  803ad0:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803ad4:	39 c2                	cmp    %eax,%edx
+  803ad6:	75 ed                	jne    803ac5 <sem_trywait+0x7>
+			return 0;
+  803ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803add:	eb 05                	jmp    803ae4 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803adf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ae7:	c9                   	leave
+  803ae8:	c3                   	ret
+
+00803ae9 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803ae9:	55                   	push   %ebp
+  803aea:	89 e5                	mov    %esp,%ebp
+  803aec:	57                   	push   %edi
+  803aed:	56                   	push   %esi
+  803aee:	53                   	push   %ebx
+  803aef:	83 ec 1c             	sub    $0x1c,%esp
+  803af2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803af5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803af8:	e8 64 d4 ff ff       	call   800f61 <sys_time_msec>
+  803afd:	01 f8                	add    %edi,%eax
+  803aff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803b02:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803b07:	eb 28                	jmp    803b31 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803b09:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b0e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803b13:	83 ec 04             	sub    $0x4,%esp
+  803b16:	56                   	push   %esi
+  803b17:	6a 00                	push   $0x0
+  803b19:	53                   	push   %ebx
+  803b1a:	e8 ca d4 ff ff       	call   800fe9 <sys_futex_wait>
+  803b1f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803b24:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803b29:	83 c4 10             	add    $0x10,%esp
+  803b2c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803b2f:	74 2e                	je     803b5f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803b31:	83 ec 0c             	sub    $0xc,%esp
+  803b34:	53                   	push   %ebx
+  803b35:	e8 84 ff ff ff       	call   803abe <sem_trywait>
+  803b3a:	83 c4 10             	add    $0x10,%esp
+  803b3d:	85 c0                	test   %eax,%eax
+  803b3f:	79 19                	jns    803b5a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803b41:	85 ff                	test   %edi,%edi
+  803b43:	74 c4                	je     803b09 <sem_timedwait+0x20>
+  803b45:	e8 17 d4 ff ff       	call   800f61 <sys_time_msec>
+  803b4a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803b4d:	29 c6                	sub    %eax,%esi
+  803b4f:	85 f6                	test   %esi,%esi
+  803b51:	7f b6                	jg     803b09 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803b53:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803b58:	eb 05                	jmp    803b5f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b62:	5b                   	pop    %ebx
+  803b63:	5e                   	pop    %esi
+  803b64:	5f                   	pop    %edi
+  803b65:	5d                   	pop    %ebp
+  803b66:	c3                   	ret
+
+00803b67 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803b67:	55                   	push   %ebp
+  803b68:	89 e5                	mov    %esp,%ebp
+  803b6a:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803b6d:	6a 00                	push   $0x0
+  803b6f:	ff 75 08             	push   0x8(%ebp)
+  803b72:	e8 72 ff ff ff       	call   803ae9 <sem_timedwait>
+}
+  803b77:	83 c4 10             	add    $0x10,%esp
+  803b7a:	c9                   	leave
+  803b7b:	c3                   	ret
+
+00803b7c <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803b7c:	55                   	push   %ebp
+  803b7d:	89 e5                	mov    %esp,%ebp
+  803b7f:	83 ec 08             	sub    $0x8,%esp
+  803b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b85:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b8a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803b8e:	8b 50 04             	mov    0x4(%eax),%edx
+  803b91:	85 d2                	test   %edx,%edx
+  803b93:	75 02                	jne    803b97 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803b95:	c9                   	leave
+  803b96:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803b97:	83 ec 08             	sub    $0x8,%esp
+  803b9a:	6a 01                	push   $0x1
+  803b9c:	50                   	push   %eax
+  803b9d:	e8 76 d4 ff ff       	call   801018 <sys_futex_wake>
+  803ba2:	83 c4 10             	add    $0x10,%esp
+}
+  803ba5:	eb ee                	jmp    803b95 <sem_post+0x19>
+
+00803ba7 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803ba7:	55                   	push   %ebp
+  803ba8:	89 e5                	mov    %esp,%ebp
+  803baa:	57                   	push   %edi
+  803bab:	56                   	push   %esi
+  803bac:	53                   	push   %ebx
+  803bad:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803bb0:	68 20 70 80 00       	push   $0x807020
+  803bb5:	e8 97 fd ff ff       	call   803951 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803bba:	a1 44 70 80 00       	mov    0x807044,%eax
+  803bbf:	83 c4 10             	add    $0x10,%esp
+  803bc2:	85 c0                	test   %eax,%eax
+  803bc4:	75 19                	jne    803bdf <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803bc6:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803bcb:	8b 00                	mov    (%eax),%eax
+  803bcd:	8b 40 48             	mov    0x48(%eax),%eax
+  803bd0:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803bd5:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803bdc:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803bdf:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803be4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803be7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803bee:	8b 40 04             	mov    0x4(%eax),%eax
+  803bf1:	85 c0                	test   %eax,%eax
+  803bf3:	0f 84 e4 00 00 00    	je     803cdd <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803bf9:	83 c3 01             	add    $0x1,%ebx
+  803bfc:	83 fb 20             	cmp    $0x20,%ebx
+  803bff:	75 e3                	jne    803be4 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803c01:	83 ec 0c             	sub    $0xc,%esp
+  803c04:	68 20 70 80 00       	push   $0x807020
+  803c09:	e8 b0 fd ff ff       	call   8039be <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803c0e:	83 c4 10             	add    $0x10,%esp
+  803c11:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803c16:	e9 b8 00 00 00       	jmp    803cd3 <pthread_create+0x12c>
+  803c1b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803c1e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803c21:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803c23:	39 f3                	cmp    %esi,%ebx
+  803c25:	73 16                	jae    803c3d <pthread_create+0x96>
+		va -= PGSIZE;
+  803c27:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803c2d:	83 ec 08             	sub    $0x8,%esp
+  803c30:	56                   	push   %esi
+  803c31:	6a 00                	push   $0x0
+  803c33:	e8 35 d1 ff ff       	call   800d6d <sys_page_unmap>
+  803c38:	83 c4 10             	add    $0x10,%esp
+  803c3b:	eb e6                	jmp    803c23 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803c3d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803c40:	83 ec 08             	sub    $0x8,%esp
+  803c43:	ff 75 e4             	push   -0x1c(%ebp)
+  803c46:	6a 00                	push   $0x0
+  803c48:	e8 20 d1 ff ff       	call   800d6d <sys_page_unmap>
+	return r;
+  803c4d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803c50:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c53:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803c5a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803c61:	eb 70                	jmp    803cd3 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803c63:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c66:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803c6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c70:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803c73:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c76:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803c79:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803c80:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803c85:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803c88:	29 c8                	sub    %ecx,%eax
+  803c8a:	85 db                	test   %ebx,%ebx
+  803c8c:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803c93:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803c96:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c9d:	83 ec 04             	sub    $0x4,%esp
+  803ca0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803ca5:	29 ca                	sub    %ecx,%edx
+  803ca7:	52                   	push   %edx
+	*--esp = 0;
+  803ca8:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803cab:	50                   	push   %eax
+  803cac:	68 04 3f 80 00       	push   $0x803f04
+  803cb1:	e8 07 d4 ff ff       	call   8010bd <sys_thread_create>
+  803cb6:	89 c7                	mov    %eax,%edi
+  803cb8:	83 c4 10             	add    $0x10,%esp
+  803cbb:	85 c0                	test   %eax,%eax
+  803cbd:	78 91                	js     803c50 <pthread_create+0xa9>
+	th->th_env = id;
+  803cbf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cc2:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ccc:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803cce:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803cd3:	89 f8                	mov    %edi,%eax
+  803cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cd8:	5b                   	pop    %ebx
+  803cd9:	5e                   	pop    %esi
+  803cda:	5f                   	pop    %edi
+  803cdb:	5d                   	pop    %ebp
+  803cdc:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803cdd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ce0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ce7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803cee:	83 ec 0c             	sub    $0xc,%esp
+  803cf1:	68 20 70 80 00       	push   $0x807020
+  803cf6:	e8 c3 fc ff ff       	call   8039be <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803cfb:	89 d9                	mov    %ebx,%ecx
+  803cfd:	c1 e1 10             	shl    $0x10,%ecx
+  803d00:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803d03:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803d08:	29 c8                	sub    %ecx,%eax
+  803d0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803d0d:	c1 e8 16             	shr    $0x16,%eax
+  803d10:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d17:	83 c4 10             	add    $0x10,%esp
+  803d1a:	a8 01                	test   $0x1,%al
+  803d1c:	74 15                	je     803d33 <pthread_create+0x18c>
+  803d1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803d21:	c1 e8 0c             	shr    $0xc,%eax
+  803d24:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d2b:	a8 01                	test   $0x1,%al
+  803d2d:	0f 85 30 ff ff ff    	jne    803c63 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803d33:	83 ec 04             	sub    $0x4,%esp
+  803d36:	6a 07                	push   $0x7
+  803d38:	ff 75 e4             	push   -0x1c(%ebp)
+  803d3b:	6a 00                	push   $0x0
+  803d3d:	e8 92 cf ff ff       	call   800cd4 <sys_page_alloc>
+  803d42:	89 c7                	mov    %eax,%edi
+  803d44:	83 c4 10             	add    $0x10,%esp
+  803d47:	85 c0                	test   %eax,%eax
+  803d49:	0f 88 01 ff ff ff    	js     803c50 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803d4f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803d54:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803d57:	29 d0                	sub    %edx,%eax
+  803d59:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803d5c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803d5e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803d63:	29 d0                	sub    %edx,%eax
+  803d65:	89 c7                	mov    %eax,%edi
+  803d67:	39 fe                	cmp    %edi,%esi
+  803d69:	0f 83 f4 fe ff ff    	jae    803c63 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803d6f:	83 ec 04             	sub    $0x4,%esp
+  803d72:	6a 07                	push   $0x7
+  803d74:	56                   	push   %esi
+  803d75:	6a 00                	push   $0x0
+  803d77:	e8 58 cf ff ff       	call   800cd4 <sys_page_alloc>
+  803d7c:	83 c4 10             	add    $0x10,%esp
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	0f 88 94 fe ff ff    	js     803c1b <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803d87:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803d8d:	eb d8                	jmp    803d67 <pthread_create+0x1c0>
+
+00803d8f <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803d8f:	55                   	push   %ebp
+  803d90:	89 e5                	mov    %esp,%ebp
+  803d92:	57                   	push   %edi
+  803d93:	56                   	push   %esi
+  803d94:	53                   	push   %ebx
+  803d95:	83 ec 0c             	sub    $0xc,%esp
+  803d98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803d9b:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803d9e:	83 f8 1e             	cmp    $0x1e,%eax
+  803da1:	0f 87 c7 00 00 00    	ja     803e6e <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803da7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803da9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803daf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803db4:	77 12                	ja     803dc8 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803db6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803dbb:	29 d0                	sub    %edx,%eax
+  803dbd:	c1 e8 10             	shr    $0x10,%eax
+  803dc0:	39 c3                	cmp    %eax,%ebx
+  803dc2:	0f 84 ad 00 00 00    	je     803e75 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803dc8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dcb:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803dd2:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803dd9:	eb 10                	jmp    803deb <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ddb:	83 ec 04             	sub    $0x4,%esp
+  803dde:	6a 00                	push   $0x0
+  803de0:	6a 01                	push   $0x1
+  803de2:	57                   	push   %edi
+  803de3:	e8 01 d2 ff ff       	call   800fe9 <sys_futex_wait>
+  803de8:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803deb:	8b 46 04             	mov    0x4(%esi),%eax
+  803dee:	83 f8 01             	cmp    $0x1,%eax
+  803df1:	74 e8                	je     803ddb <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803df3:	83 f8 02             	cmp    $0x2,%eax
+  803df6:	0f 85 80 00 00 00    	jne    803e7c <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803dfc:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803dff:	c1 e6 02             	shl    $0x2,%esi
+  803e02:	eb 05                	jmp    803e09 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803e04:	e8 9f ce ff ff       	call   800ca8 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803e09:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803e0f:	89 ca                	mov    %ecx,%edx
+  803e11:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803e17:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e1a:	c1 e0 04             	shl    $0x4,%eax
+  803e1d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e22:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803e25:	39 c1                	cmp    %eax,%ecx
+  803e27:	75 12                	jne    803e3b <pthread_join+0xac>
+  803e29:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e2c:	c1 e0 04             	shl    $0x4,%eax
+  803e2f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e34:	8b 40 54             	mov    0x54(%eax),%eax
+  803e37:	85 c0                	test   %eax,%eax
+  803e39:	75 c9                	jne    803e04 <pthread_join+0x75>
+	if (ret_store)
+  803e3b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803e3f:	74 0f                	je     803e50 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803e41:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e44:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803e4b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e4e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803e50:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e53:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e5a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803e61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e69:	5b                   	pop    %ebx
+  803e6a:	5e                   	pop    %esi
+  803e6b:	5f                   	pop    %edi
+  803e6c:	5d                   	pop    %ebp
+  803e6d:	c3                   	ret
+		return -E_INVAL;
+  803e6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e73:	eb f1                	jmp    803e66 <pthread_join+0xd7>
+  803e75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e7a:	eb ea                	jmp    803e66 <pthread_join+0xd7>
+		return -E_INVAL;
+  803e7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e81:	eb e3                	jmp    803e66 <pthread_join+0xd7>
+
+00803e83 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803e83:	55                   	push   %ebp
+  803e84:	89 e5                	mov    %esp,%ebp
+  803e86:	53                   	push   %ebx
+  803e87:	83 ec 04             	sub    $0x4,%esp
+  803e8a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e8c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e92:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e97:	77 0c                	ja     803ea5 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e99:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e9e:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803ea0:	c1 e8 10             	shr    $0x10,%eax
+  803ea3:	75 0a                	jne    803eaf <pthread_exit+0x2c>
+		exit();
+  803ea5:	e8 05 c3 ff ff       	call   8001af <exit>
+  803eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803eaf:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803eb6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803eb9:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803ec0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ec3:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803ec6:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803ecd:	83 ec 08             	sub    $0x8,%esp
+  803ed0:	6a 20                	push   $0x20
+  803ed2:	01 c2                	add    %eax,%edx
+  803ed4:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803edb:	50                   	push   %eax
+  803edc:	e8 37 d1 ff ff       	call   801018 <sys_futex_wake>
+	sys_env_destroy(0);
+  803ee1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803ee8:	e8 44 cd ff ff       	call   800c31 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803eed:	83 c4 0c             	add    $0xc,%esp
+  803ef0:	68 b6 54 80 00       	push   $0x8054b6
+  803ef5:	68 a5 00 00 00       	push   $0xa5
+  803efa:	68 d0 54 80 00       	push   $0x8054d0
+  803eff:	e8 d3 c2 ff ff       	call   8001d7 <_panic>
+
+00803f04 <pthread_start>:
+{
+  803f04:	55                   	push   %ebp
+  803f05:	89 e5                	mov    %esp,%ebp
+  803f07:	53                   	push   %ebx
+  803f08:	83 ec 04             	sub    $0x4,%esp
+  803f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803f0e:	e8 69 cd ff ff       	call   800c7c <sys_getenvid>
+  803f13:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803f18:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803f1e:	85 db                	test   %ebx,%ebx
+  803f20:	74 0c                	je     803f2e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f22:	89 d9                	mov    %ebx,%ecx
+  803f24:	c1 e1 10             	shl    $0x10,%ecx
+  803f27:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f2c:	29 ca                	sub    %ecx,%edx
+  803f2e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f31:	c1 e0 04             	shl    $0x4,%eax
+  803f34:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f39:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803f3b:	83 ec 0c             	sub    $0xc,%esp
+  803f3e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803f45:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803f48:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803f4f:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803f56:	89 04 24             	mov    %eax,(%esp)
+  803f59:	e8 25 ff ff ff       	call   803e83 <pthread_exit>
+
+00803f5e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803f5e:	55                   	push   %ebp
+  803f5f:	89 e5                	mov    %esp,%ebp
+  803f61:	57                   	push   %edi
+  803f62:	56                   	push   %esi
+  803f63:	53                   	push   %ebx
+  803f64:	83 ec 1c             	sub    $0x1c,%esp
+  803f67:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f69:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803f6f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f76:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f7b:	77 0d                	ja     803f8a <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f7d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f82:	29 d0                	sub    %edx,%eax
+  803f84:	c1 e8 10             	shr    $0x10,%eax
+  803f87:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f8f:	eb 2f                	jmp    803fc0 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803f91:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f97:	8b 01                	mov    (%ecx),%eax
+  803f99:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803f9c:	39 c2                	cmp    %eax,%edx
+  803f9e:	75 14                	jne    803fb4 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803fa0:	83 ec 0c             	sub    $0xc,%esp
+  803fa3:	57                   	push   %edi
+  803fa4:	e8 88 cc ff ff       	call   800c31 <sys_env_destroy>
+  803fa9:	83 c4 10             	add    $0x10,%esp
+  803fac:	85 c0                	test   %eax,%eax
+  803fae:	0f 88 97 00 00 00    	js     80404b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803fb4:	83 c3 01             	add    $0x1,%ebx
+  803fb7:	83 fb 20             	cmp    $0x20,%ebx
+  803fba:	0f 84 d2 00 00 00    	je     804092 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803fc0:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803fc3:	74 ef                	je     803fb4 <pthread_kill_others+0x56>
+  803fc5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fc8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fcf:	8b 40 04             	mov    0x4(%eax),%eax
+  803fd2:	83 f8 01             	cmp    $0x1,%eax
+  803fd5:	75 dd                	jne    803fb4 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803fd7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fda:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803fe1:	89 fe                	mov    %edi,%esi
+  803fe3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803fe9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803fec:	c1 e0 04             	shl    $0x4,%eax
+  803fef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ff4:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803ff7:	39 c7                	cmp    %eax,%edi
+  803ff9:	75 b9                	jne    803fb4 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803ffb:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ffe:	c1 e0 04             	shl    $0x4,%eax
+  804001:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804006:	8b 40 54             	mov    0x54(%eax),%eax
+  804009:	85 c0                	test   %eax,%eax
+  80400b:	74 a7                	je     803fb4 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80400d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804010:	c1 e0 04             	shl    $0x4,%eax
+  804013:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804019:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80401b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804021:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804026:	0f 87 65 ff ff ff    	ja     803f91 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80402c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804031:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804033:	c1 e8 10             	shr    $0x10,%eax
+  804036:	0f 84 55 ff ff ff    	je     803f91 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80403c:	c1 e0 10             	shl    $0x10,%eax
+  80403f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804044:	29 c1                	sub    %eax,%ecx
+  804046:	e9 4c ff ff ff       	jmp    803f97 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80404b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80404e:	c1 e2 04             	shl    $0x4,%edx
+  804051:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804057:	8b 52 48             	mov    0x48(%edx),%edx
+  80405a:	39 fa                	cmp    %edi,%edx
+  80405c:	0f 85 52 ff ff ff    	jne    803fb4 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804062:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804065:	c1 e2 04             	shl    $0x4,%edx
+  804068:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80406e:	8b 52 54             	mov    0x54(%edx),%edx
+  804071:	85 d2                	test   %edx,%edx
+  804073:	0f 84 3b ff ff ff    	je     803fb4 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804079:	83 ec 0c             	sub    $0xc,%esp
+  80407c:	50                   	push   %eax
+  80407d:	57                   	push   %edi
+  80407e:	68 e0 54 80 00       	push   $0x8054e0
+  804083:	68 bb 00 00 00       	push   $0xbb
+  804088:	68 d0 54 80 00       	push   $0x8054d0
+  80408d:	e8 45 c1 ff ff       	call   8001d7 <_panic>
+	}
+}
+  804092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804095:	5b                   	pop    %ebx
+  804096:	5e                   	pop    %esi
+  804097:	5f                   	pop    %edi
+  804098:	5d                   	pop    %ebp
+  804099:	c3                   	ret
+
+0080409a <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80409a:	55                   	push   %ebp
+  80409b:	89 e5                	mov    %esp,%ebp
+  80409d:	53                   	push   %ebx
+  80409e:	83 ec 04             	sub    $0x4,%esp
+  8040a1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8040a9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040af:	0f 87 85 00 00 00    	ja     80413a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040b5:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8040ba:	29 c3                	sub    %eax,%ebx
+  8040bc:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8040bf:	83 ec 04             	sub    $0x4,%esp
+  8040c2:	68 80 02 00 00       	push   $0x280
+  8040c7:	6a 00                	push   $0x0
+  8040c9:	68 40 70 80 00       	push   $0x807040
+  8040ce:	e8 14 c9 ff ff       	call   8009e7 <memset>
+	threads_mu.m_state = 0;
+  8040d3:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8040da:	00 00 00 
+	if (self != 0) {
+  8040dd:	83 c4 10             	add    $0x10,%esp
+  8040e0:	85 db                	test   %ebx,%ebx
+  8040e2:	74 51                	je     804135 <pthread_fork_child+0x9b>
+  8040e4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040e6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8040ec:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040f1:	77 18                	ja     80410b <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040f3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040f8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8040fa:	c1 e8 10             	shr    $0x10,%eax
+  8040fd:	74 0c                	je     80410b <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040ff:	c1 e0 10             	shl    $0x10,%eax
+  804102:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804107:	29 c2                	sub    %eax,%edx
+  804109:	eb 06                	jmp    804111 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80410b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804111:	8b 02                	mov    (%edx),%eax
+  804113:	8b 48 48             	mov    0x48(%eax),%ecx
+  804116:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80411d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804120:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804127:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  80412e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804138:	c9                   	leave
+  804139:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80413a:	83 ec 04             	sub    $0x4,%esp
+  80413d:	68 80 02 00 00       	push   $0x280
+  804142:	6a 00                	push   $0x0
+  804144:	68 40 70 80 00       	push   $0x807040
+  804149:	e8 99 c8 ff ff       	call   8009e7 <memset>
+	threads_mu.m_state = 0;
+  80414e:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804155:	00 00 00 
+  804158:	83 c4 10             	add    $0x10,%esp
+  80415b:	eb d8                	jmp    804135 <pthread_fork_child+0x9b>
+
+0080415d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80415d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804162:	c3                   	ret
+
+00804163 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804163:	55                   	push   %ebp
+  804164:	89 e5                	mov    %esp,%ebp
+  804166:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804169:	68 05 55 80 00       	push   $0x805505
+  80416e:	ff 75 0c             	push   0xc(%ebp)
+  804171:	e8 20 c7 ff ff       	call   800896 <strcpy>
+	return 0;
+}
+  804176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417b:	c9                   	leave
+  80417c:	c3                   	ret
+
+0080417d <devcons_write>:
+{
+  80417d:	55                   	push   %ebp
+  80417e:	89 e5                	mov    %esp,%ebp
+  804180:	57                   	push   %edi
+  804181:	56                   	push   %esi
+  804182:	53                   	push   %ebx
+  804183:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804189:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80418e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804194:	eb 2e                	jmp    8041c4 <devcons_write+0x47>
+		m = n - tot;
+  804196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804199:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80419b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041a0:	39 c3                	cmp    %eax,%ebx
+  8041a2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8041a5:	83 ec 04             	sub    $0x4,%esp
+  8041a8:	53                   	push   %ebx
+  8041a9:	89 f0                	mov    %esi,%eax
+  8041ab:	03 45 0c             	add    0xc(%ebp),%eax
+  8041ae:	50                   	push   %eax
+  8041af:	57                   	push   %edi
+  8041b0:	e8 67 c8 ff ff       	call   800a1c <memmove>
+		sys_cputs(buf, m);
+  8041b5:	83 c4 08             	add    $0x8,%esp
+  8041b8:	53                   	push   %ebx
+  8041b9:	57                   	push   %edi
+  8041ba:	e8 1b ca ff ff       	call   800bda <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8041bf:	01 de                	add    %ebx,%esi
+  8041c1:	83 c4 10             	add    $0x10,%esp
+  8041c4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8041c7:	72 cd                	jb     804196 <devcons_write+0x19>
+}
+  8041c9:	89 f0                	mov    %esi,%eax
+  8041cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041ce:	5b                   	pop    %ebx
+  8041cf:	5e                   	pop    %esi
+  8041d0:	5f                   	pop    %edi
+  8041d1:	5d                   	pop    %ebp
+  8041d2:	c3                   	ret
+
+008041d3 <devcons_read>:
+{
+  8041d3:	55                   	push   %ebp
+  8041d4:	89 e5                	mov    %esp,%ebp
+  8041d6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8041d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041de:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8041e2:	75 07                	jne    8041eb <devcons_read+0x18>
+  8041e4:	eb 1f                	jmp    804205 <devcons_read+0x32>
+		sys_yield();
+  8041e6:	e8 bd ca ff ff       	call   800ca8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8041eb:	e8 15 ca ff ff       	call   800c05 <sys_cgetc>
+  8041f0:	85 c0                	test   %eax,%eax
+  8041f2:	74 f2                	je     8041e6 <devcons_read+0x13>
+	if (c < 0)
+  8041f4:	78 0f                	js     804205 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8041f6:	83 f8 04             	cmp    $0x4,%eax
+  8041f9:	74 0c                	je     804207 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8041fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041fe:	88 02                	mov    %al,(%edx)
+	return 1;
+  804200:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804205:	c9                   	leave
+  804206:	c3                   	ret
+		return 0;
+  804207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420c:	eb f7                	jmp    804205 <devcons_read+0x32>
+
+0080420e <cputchar>:
+{
+  80420e:	55                   	push   %ebp
+  80420f:	89 e5                	mov    %esp,%ebp
+  804211:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804214:	8b 45 08             	mov    0x8(%ebp),%eax
+  804217:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80421a:	6a 01                	push   $0x1
+  80421c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80421f:	50                   	push   %eax
+  804220:	e8 b5 c9 ff ff       	call   800bda <sys_cputs>
+}
+  804225:	83 c4 10             	add    $0x10,%esp
+  804228:	c9                   	leave
+  804229:	c3                   	ret
+
+0080422a <getchar>:
+{
+  80422a:	55                   	push   %ebp
+  80422b:	89 e5                	mov    %esp,%ebp
+  80422d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804230:	6a 01                	push   $0x1
+  804232:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804235:	50                   	push   %eax
+  804236:	6a 00                	push   $0x0
+  804238:	e8 46 d2 ff ff       	call   801483 <read>
+	if (r < 0)
+  80423d:	83 c4 10             	add    $0x10,%esp
+  804240:	85 c0                	test   %eax,%eax
+  804242:	78 06                	js     80424a <getchar+0x20>
+	if (r < 1)
+  804244:	74 06                	je     80424c <getchar+0x22>
+	return c;
+  804246:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80424a:	c9                   	leave
+  80424b:	c3                   	ret
+		return -E_EOF;
+  80424c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804251:	eb f7                	jmp    80424a <getchar+0x20>
+
+00804253 <iscons>:
+{
+  804253:	55                   	push   %ebp
+  804254:	89 e5                	mov    %esp,%ebp
+  804256:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804259:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80425c:	50                   	push   %eax
+  80425d:	ff 75 08             	push   0x8(%ebp)
+  804260:	e8 8e cf ff ff       	call   8011f3 <fd_lookup>
+  804265:	83 c4 10             	add    $0x10,%esp
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	78 11                	js     80427d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80426c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80426f:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804275:	39 10                	cmp    %edx,(%eax)
+  804277:	0f 94 c0             	sete   %al
+  80427a:	0f b6 c0             	movzbl %al,%eax
+}
+  80427d:	c9                   	leave
+  80427e:	c3                   	ret
+
+0080427f <opencons>:
+{
+  80427f:	55                   	push   %ebp
+  804280:	89 e5                	mov    %esp,%ebp
+  804282:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804285:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804288:	50                   	push   %eax
+  804289:	e8 0f cf ff ff       	call   80119d <fd_alloc>
+  80428e:	83 c4 10             	add    $0x10,%esp
+  804291:	85 c0                	test   %eax,%eax
+  804293:	78 3a                	js     8042cf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804295:	83 ec 04             	sub    $0x4,%esp
+  804298:	68 07 04 00 00       	push   $0x407
+  80429d:	ff 75 f4             	push   -0xc(%ebp)
+  8042a0:	6a 00                	push   $0x0
+  8042a2:	e8 2d ca ff ff       	call   800cd4 <sys_page_alloc>
+  8042a7:	83 c4 10             	add    $0x10,%esp
+  8042aa:	85 c0                	test   %eax,%eax
+  8042ac:	78 21                	js     8042cf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8042ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042b1:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8042b7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8042b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042bc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8042c3:	83 ec 0c             	sub    $0xc,%esp
+  8042c6:	50                   	push   %eax
+  8042c7:	e8 aa ce ff ff       	call   801176 <fd2num>
+  8042cc:	83 c4 10             	add    $0x10,%esp
+}
+  8042cf:	c9                   	leave
+  8042d0:	c3                   	ret
+
+008042d1 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8042d1:	55                   	push   %ebp
+  8042d2:	89 e5                	mov    %esp,%ebp
+  8042d4:	57                   	push   %edi
+  8042d5:	56                   	push   %esi
+  8042d6:	53                   	push   %ebx
+  8042d7:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8042da:	89 d6                	mov    %edx,%esi
+  8042dc:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8042df:	89 cf                	mov    %ecx,%edi
+  8042e1:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8042e4:	89 fa                	mov    %edi,%edx
+  8042e6:	80 ce 08             	or     $0x8,%dh
+  8042e9:	f6 c5 08             	test   $0x8,%ch
+  8042ec:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8042ef:	57                   	push   %edi
+  8042f0:	56                   	push   %esi
+  8042f1:	50                   	push   %eax
+  8042f2:	56                   	push   %esi
+  8042f3:	6a 00                	push   $0x0
+  8042f5:	e8 27 ca ff ff       	call   800d21 <sys_page_map>
+	if (r < 0) {
+  8042fa:	83 c4 20             	add    $0x20,%esp
+  8042fd:	85 c0                	test   %eax,%eax
+  8042ff:	78 27                	js     804328 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  804301:	83 ec 0c             	sub    $0xc,%esp
+  804304:	57                   	push   %edi
+  804305:	56                   	push   %esi
+  804306:	6a 00                	push   $0x0
+  804308:	56                   	push   %esi
+  804309:	6a 00                	push   $0x0
+  80430b:	e8 11 ca ff ff       	call   800d21 <sys_page_map>
+  804310:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804312:	83 c4 20             	add    $0x20,%esp
+  804315:	85 c0                	test   %eax,%eax
+  804317:	78 24                	js     80433d <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  804319:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80431e:	89 d8                	mov    %ebx,%eax
+  804320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804323:	5b                   	pop    %ebx
+  804324:	5e                   	pop    %esi
+  804325:	5f                   	pop    %edi
+  804326:	5d                   	pop    %ebp
+  804327:	c3                   	ret
+  804328:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80432a:	83 ec 08             	sub    $0x8,%esp
+  80432d:	50                   	push   %eax
+  80432e:	68 14 55 80 00       	push   $0x805514
+  804333:	e8 7a bf ff ff       	call   8002b2 <cprintf>
+		return r;
+  804338:	83 c4 10             	add    $0x10,%esp
+  80433b:	eb e1                	jmp    80431e <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80433d:	83 ec 08             	sub    $0x8,%esp
+  804340:	50                   	push   %eax
+  804341:	68 44 55 80 00       	push   $0x805544
+  804346:	e8 67 bf ff ff       	call   8002b2 <cprintf>
+		return r;
+  80434b:	83 c4 10             	add    $0x10,%esp
+  80434e:	eb ce                	jmp    80431e <duppage_cow+0x4d>
+
+00804350 <duppage>:
+{
+  804350:	55                   	push   %ebp
+  804351:	89 e5                	mov    %esp,%ebp
+  804353:	53                   	push   %ebx
+  804354:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  804357:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80435a:	51                   	push   %ecx
+  80435b:	52                   	push   %edx
+  80435c:	50                   	push   %eax
+  80435d:	52                   	push   %edx
+  80435e:	6a 00                	push   $0x0
+  804360:	e8 bc c9 ff ff       	call   800d21 <sys_page_map>
+	if (r < 0) {
+  804365:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  804368:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80436d:	85 c0                	test   %eax,%eax
+  80436f:	78 07                	js     804378 <duppage+0x28>
+}
+  804371:	89 d8                	mov    %ebx,%eax
+  804373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804376:	c9                   	leave
+  804377:	c3                   	ret
+  804378:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80437a:	83 ec 08             	sub    $0x8,%esp
+  80437d:	50                   	push   %eax
+  80437e:	68 14 55 80 00       	push   $0x805514
+  804383:	e8 2a bf ff ff       	call   8002b2 <cprintf>
+		return r;
+  804388:	83 c4 10             	add    $0x10,%esp
+  80438b:	eb e4                	jmp    804371 <duppage+0x21>
+
+0080438d <cow_copy>:
+{
+  80438d:	55                   	push   %ebp
+  80438e:	89 e5                	mov    %esp,%ebp
+  804390:	56                   	push   %esi
+  804391:	53                   	push   %ebx
+  804392:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804394:	83 ec 04             	sub    $0x4,%esp
+  804397:	6a 07                	push   $0x7
+  804399:	68 00 f0 7f 00       	push   $0x7ff000
+  80439e:	6a 00                	push   $0x0
+  8043a0:	e8 2f c9 ff ff       	call   800cd4 <sys_page_alloc>
+	if (r < 0) {
+  8043a5:	83 c4 10             	add    $0x10,%esp
+  8043a8:	85 c0                	test   %eax,%eax
+  8043aa:	78 58                	js     804404 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8043ac:	83 ec 04             	sub    $0x4,%esp
+  8043af:	68 00 10 00 00       	push   $0x1000
+  8043b4:	56                   	push   %esi
+  8043b5:	68 00 f0 7f 00       	push   $0x7ff000
+  8043ba:	e8 5d c6 ff ff       	call   800a1c <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8043bf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8043c6:	56                   	push   %esi
+  8043c7:	6a 00                	push   $0x0
+  8043c9:	68 00 f0 7f 00       	push   $0x7ff000
+  8043ce:	6a 00                	push   $0x0
+  8043d0:	e8 4c c9 ff ff       	call   800d21 <sys_page_map>
+  8043d5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8043d7:	83 c4 20             	add    $0x20,%esp
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	78 3b                	js     804419 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8043de:	83 ec 08             	sub    $0x8,%esp
+  8043e1:	68 00 f0 7f 00       	push   $0x7ff000
+  8043e6:	6a 00                	push   $0x0
+  8043e8:	e8 80 c9 ff ff       	call   800d6d <sys_page_unmap>
+  8043ed:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8043ef:	83 c4 10             	add    $0x10,%esp
+  8043f2:	85 c0                	test   %eax,%eax
+  8043f4:	78 45                	js     80443b <cow_copy+0xae>
+	return 0;
+  8043f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8043fb:	89 d8                	mov    %ebx,%eax
+  8043fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804400:	5b                   	pop    %ebx
+  804401:	5e                   	pop    %esi
+  804402:	5d                   	pop    %ebp
+  804403:	c3                   	ret
+  804404:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  804406:	83 ec 08             	sub    $0x8,%esp
+  804409:	50                   	push   %eax
+  80440a:	68 34 56 80 00       	push   $0x805634
+  80440f:	e8 9e be ff ff       	call   8002b2 <cprintf>
+		return r;
+  804414:	83 c4 10             	add    $0x10,%esp
+  804417:	eb e2                	jmp    8043fb <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  804419:	83 ec 08             	sub    $0x8,%esp
+  80441c:	50                   	push   %eax
+  80441d:	68 50 56 80 00       	push   $0x805650
+  804422:	e8 8b be ff ff       	call   8002b2 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  804427:	83 c4 08             	add    $0x8,%esp
+  80442a:	68 00 f0 7f 00       	push   $0x7ff000
+  80442f:	6a 00                	push   $0x0
+  804431:	e8 37 c9 ff ff       	call   800d6d <sys_page_unmap>
+		return r;
+  804436:	83 c4 10             	add    $0x10,%esp
+  804439:	eb c0                	jmp    8043fb <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80443b:	83 ec 08             	sub    $0x8,%esp
+  80443e:	50                   	push   %eax
+  80443f:	68 6c 55 80 00       	push   $0x80556c
+  804444:	e8 69 be ff ff       	call   8002b2 <cprintf>
+		return r;
+  804449:	83 c4 10             	add    $0x10,%esp
+  80444c:	eb ad                	jmp    8043fb <cow_copy+0x6e>
+
+0080444e <pgfault>:
+{
+  80444e:	55                   	push   %ebp
+  80444f:	89 e5                	mov    %esp,%ebp
+  804451:	56                   	push   %esi
+  804452:	53                   	push   %ebx
+  804453:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  804456:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  804458:	89 d8                	mov    %ebx,%eax
+  80445a:	c1 e8 16             	shr    $0x16,%eax
+  80445d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804464:	89 de                	mov    %ebx,%esi
+  804466:	c1 ee 0c             	shr    $0xc,%esi
+  804469:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804470:	a8 07                	test   $0x7,%al
+  804472:	74 3b                	je     8044af <pgfault+0x61>
+  804474:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80447a:	74 33                	je     8044af <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80447c:	83 ec 0c             	sub    $0xc,%esp
+  80447f:	68 00 f0 bf ee       	push   $0xeebff000
+  804484:	e8 c8 f4 ff ff       	call   803951 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  804489:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804490:	83 c4 10             	add    $0x10,%esp
+  804493:	f6 c4 08             	test   $0x8,%ah
+  804496:	75 30                	jne    8044c8 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804498:	83 ec 0c             	sub    $0xc,%esp
+  80449b:	68 00 f0 bf ee       	push   $0xeebff000
+  8044a0:	e8 19 f5 ff ff       	call   8039be <mutex_unlock>
+}
+  8044a5:	83 c4 10             	add    $0x10,%esp
+  8044a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044ab:	5b                   	pop    %ebx
+  8044ac:	5e                   	pop    %esi
+  8044ad:	5d                   	pop    %ebp
+  8044ae:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8044af:	83 ec 08             	sub    $0x8,%esp
+  8044b2:	ff 72 28             	push   0x28(%edx)
+  8044b5:	51                   	push   %ecx
+  8044b6:	50                   	push   %eax
+  8044b7:	68 90 55 80 00       	push   $0x805590
+  8044bc:	6a 3f                	push   $0x3f
+  8044be:	68 6a 56 80 00       	push   $0x80566a
+  8044c3:	e8 0f bd ff ff       	call   8001d7 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8044c8:	89 d8                	mov    %ebx,%eax
+  8044ca:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8044cf:	e8 b9 fe ff ff       	call   80438d <cow_copy>
+  8044d4:	eb c2                	jmp    804498 <pgfault+0x4a>
+
+008044d6 <cow_enable>:
+{
+  8044d6:	55                   	push   %ebp
+  8044d7:	89 e5                	mov    %esp,%ebp
+  8044d9:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8044dc:	68 4e 44 80 00       	push   $0x80444e
+  8044e1:	e8 28 06 00 00       	call   804b0e <set_pgfault_handler>
+}
+  8044e6:	83 c4 10             	add    $0x10,%esp
+  8044e9:	c9                   	leave
+  8044ea:	c3                   	ret
+
+008044eb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8044eb:	55                   	push   %ebp
+  8044ec:	89 e5                	mov    %esp,%ebp
+  8044ee:	57                   	push   %edi
+  8044ef:	56                   	push   %esi
+  8044f0:	53                   	push   %ebx
+  8044f1:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8044f4:	68 4e 44 80 00       	push   $0x80444e
+  8044f9:	e8 10 06 00 00       	call   804b0e <set_pgfault_handler>
+  8044fe:	b8 07 00 00 00       	mov    $0x7,%eax
+  804503:	cd 30                	int    $0x30
+  804505:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804508:	83 c4 10             	add    $0x10,%esp
+  80450b:	85 c0                	test   %eax,%eax
+  80450d:	78 4b                	js     80455a <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80450f:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804514:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804519:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80451c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804520:	0f 85 16 01 00 00    	jne    80463c <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804526:	e8 51 c7 ff ff       	call   800c7c <sys_getenvid>
+  80452b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804530:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804532:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  804538:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80453e:	77 32                	ja     804572 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804540:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804545:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  804547:	c1 ea 10             	shr    $0x10,%edx
+  80454a:	74 26                	je     804572 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80454c:	c1 e2 10             	shl    $0x10,%edx
+  80454f:	89 d1                	mov    %edx,%ecx
+  804551:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804556:	29 ca                	sub    %ecx,%edx
+  804558:	eb 1e                	jmp    804578 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80455a:	83 ec 08             	sub    $0x8,%esp
+  80455d:	89 c7                	mov    %eax,%edi
+  80455f:	50                   	push   %eax
+  804560:	68 75 56 80 00       	push   $0x805675
+  804565:	e8 48 bd ff ff       	call   8002b2 <cprintf>
+		return eid;
+  80456a:	83 c4 10             	add    $0x10,%esp
+  80456d:	e9 6c 01 00 00       	jmp    8046de <fork+0x1f3>
+		return pthread_main_tls;
+  804572:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804578:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80457b:	c1 e0 04             	shl    $0x4,%eax
+  80457e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804583:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  804585:	e8 10 fb ff ff       	call   80409a <pthread_fork_child>
+		return eid;
+  80458a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80458d:	e9 4c 01 00 00       	jmp    8046de <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804592:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804598:	89 da                	mov    %ebx,%edx
+  80459a:	89 f8                	mov    %edi,%eax
+  80459c:	e8 af fd ff ff       	call   804350 <duppage>
+  8045a1:	85 c0                	test   %eax,%eax
+  8045a3:	79 28                	jns    8045cd <fork+0xe2>
+  8045a5:	89 c7                	mov    %eax,%edi
+  8045a7:	e9 32 01 00 00       	jmp    8046de <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8045ac:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8045b2:	83 f9 05             	cmp    $0x5,%ecx
+  8045b5:	75 58                	jne    80460f <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8045b7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8045bc:	89 da                	mov    %ebx,%edx
+  8045be:	89 f8                	mov    %edi,%eax
+  8045c0:	e8 8b fd ff ff       	call   804350 <duppage>
+  8045c5:	85 c0                	test   %eax,%eax
+  8045c7:	0f 88 0f 01 00 00    	js     8046dc <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8045cd:	83 c3 01             	add    $0x1,%ebx
+  8045d0:	39 de                	cmp    %ebx,%esi
+  8045d2:	74 54                	je     804628 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8045d4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8045db:	f6 c1 05             	test   $0x5,%cl
+  8045de:	74 ed                	je     8045cd <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8045e0:	f6 c5 04             	test   $0x4,%ch
+  8045e3:	75 ad                	jne    804592 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8045e5:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8045eb:	74 bf                	je     8045ac <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8045ed:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8045f3:	74 d8                	je     8045cd <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8045f5:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8045fb:	89 da                	mov    %ebx,%edx
+  8045fd:	89 f8                	mov    %edi,%eax
+  8045ff:	e8 cd fc ff ff       	call   8042d1 <duppage_cow>
+  804604:	85 c0                	test   %eax,%eax
+  804606:	79 c5                	jns    8045cd <fork+0xe2>
+  804608:	89 c7                	mov    %eax,%edi
+  80460a:	e9 cf 00 00 00       	jmp    8046de <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80460f:	68 c0 55 80 00       	push   $0x8055c0
+  804614:	68 1d 53 80 00       	push   $0x80531d
+  804619:	68 c6 00 00 00       	push   $0xc6
+  80461e:	68 6a 56 80 00       	push   $0x80566a
+  804623:	e8 af bb ff ff       	call   8001d7 <_panic>
+  804628:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80462b:	83 c1 01             	add    $0x1,%ecx
+  80462e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804634:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80463a:	74 18                	je     804654 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80463c:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804643:	a8 07                	test   $0x7,%al
+  804645:	74 e4                	je     80462b <fork+0x140>
+  804647:	89 cb                	mov    %ecx,%ebx
+  804649:	c1 e3 0a             	shl    $0xa,%ebx
+  80464c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80464f:	e9 7c ff ff ff       	jmp    8045d0 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804654:	83 ec 04             	sub    $0x4,%esp
+  804657:	6a 07                	push   $0x7
+  804659:	68 00 f0 bf ee       	push   $0xeebff000
+  80465e:	ff 75 e4             	push   -0x1c(%ebp)
+  804661:	e8 6e c6 ff ff       	call   800cd4 <sys_page_alloc>
+  804666:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804668:	83 c4 10             	add    $0x10,%esp
+  80466b:	85 c0                	test   %eax,%eax
+  80466d:	78 34                	js     8046a3 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80466f:	83 ec 08             	sub    $0x8,%esp
+  804672:	68 4c 4b 80 00       	push   $0x804b4c
+  804677:	ff 75 e4             	push   -0x1c(%ebp)
+  80467a:	e8 d2 c7 ff ff       	call   800e51 <sys_env_set_pgfault_upcall>
+  80467f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804681:	83 c4 10             	add    $0x10,%esp
+  804684:	85 c0                	test   %eax,%eax
+  804686:	78 2e                	js     8046b6 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804688:	83 ec 08             	sub    $0x8,%esp
+  80468b:	6a 02                	push   $0x2
+  80468d:	ff 75 e4             	push   -0x1c(%ebp)
+  804690:	e8 24 c7 ff ff       	call   800db9 <sys_env_set_status>
+  804695:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804697:	83 c4 10             	add    $0x10,%esp
+  80469a:	85 c0                	test   %eax,%eax
+  80469c:	78 2b                	js     8046c9 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80469e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8046a1:	eb 3b                	jmp    8046de <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8046a3:	83 ec 08             	sub    $0x8,%esp
+  8046a6:	50                   	push   %eax
+  8046a7:	68 e8 55 80 00       	push   $0x8055e8
+  8046ac:	e8 01 bc ff ff       	call   8002b2 <cprintf>
+		return r;
+  8046b1:	83 c4 10             	add    $0x10,%esp
+  8046b4:	eb 28                	jmp    8046de <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8046b6:	83 ec 08             	sub    $0x8,%esp
+  8046b9:	50                   	push   %eax
+  8046ba:	68 10 56 80 00       	push   $0x805610
+  8046bf:	e8 ee bb ff ff       	call   8002b2 <cprintf>
+		return r;
+  8046c4:	83 c4 10             	add    $0x10,%esp
+  8046c7:	eb 15                	jmp    8046de <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8046c9:	83 ec 08             	sub    $0x8,%esp
+  8046cc:	50                   	push   %eax
+  8046cd:	68 85 56 80 00       	push   $0x805685
+  8046d2:	e8 db bb ff ff       	call   8002b2 <cprintf>
+		return r;
+  8046d7:	83 c4 10             	add    $0x10,%esp
+  8046da:	eb 02                	jmp    8046de <fork+0x1f3>
+  8046dc:	89 c7                	mov    %eax,%edi
+}
+  8046de:	89 f8                	mov    %edi,%eax
+  8046e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046e3:	5b                   	pop    %ebx
+  8046e4:	5e                   	pop    %esi
+  8046e5:	5f                   	pop    %edi
+  8046e6:	5d                   	pop    %ebp
+  8046e7:	c3                   	ret
+
+008046e8 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8046e8:	55                   	push   %ebp
+  8046e9:	89 e5                	mov    %esp,%ebp
+  8046eb:	57                   	push   %edi
+  8046ec:	56                   	push   %esi
+  8046ed:	53                   	push   %ebx
+  8046ee:	83 ec 2c             	sub    $0x2c,%esp
+  8046f1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046f3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8046f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046fe:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804704:	77 0a                	ja     804710 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804706:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80470b:	29 c3                	sub    %eax,%ebx
+  80470d:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804710:	83 ec 0c             	sub    $0xc,%esp
+  804713:	68 4e 44 80 00       	push   $0x80444e
+  804718:	e8 f1 03 00 00       	call   804b0e <set_pgfault_handler>
+  80471d:	b8 07 00 00 00       	mov    $0x7,%eax
+  804722:	cd 30                	int    $0x30
+  804724:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804727:	83 c4 10             	add    $0x10,%esp
+  80472a:	85 c0                	test   %eax,%eax
+  80472c:	78 30                	js     80475e <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80472e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804732:	74 42                	je     804776 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804734:	c1 e3 10             	shl    $0x10,%ebx
+  804737:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80473c:	29 d8                	sub    %ebx,%eax
+  80473e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804741:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804746:	29 d8                	sub    %ebx,%eax
+  804748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80474b:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804750:	ba 00 00 00 00       	mov    $0x0,%edx
+  804755:	89 f7                	mov    %esi,%edi
+  804757:	89 d6                	mov    %edx,%esi
+  804759:	e9 2c 01 00 00       	jmp    80488a <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80475e:	83 ec 08             	sub    $0x8,%esp
+  804761:	89 c7                	mov    %eax,%edi
+  804763:	50                   	push   %eax
+  804764:	68 75 56 80 00       	push   $0x805675
+  804769:	e8 44 bb ff ff       	call   8002b2 <cprintf>
+		return eid;
+  80476e:	83 c4 10             	add    $0x10,%esp
+  804771:	e9 d5 00 00 00       	jmp    80484b <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804776:	e8 01 c5 ff ff       	call   800c7c <sys_getenvid>
+  80477b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804780:	89 c2                	mov    %eax,%edx
+  804782:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804784:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80478a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80478f:	77 18                	ja     8047a9 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804791:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804796:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804798:	c1 e8 10             	shr    $0x10,%eax
+  80479b:	74 0c                	je     8047a9 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80479d:	c1 e0 10             	shl    $0x10,%eax
+  8047a0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8047a5:	29 c1                	sub    %eax,%ecx
+  8047a7:	eb 06                	jmp    8047af <sfork+0xc7>
+		return pthread_main_tls;
+  8047a9:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8047af:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8047b2:	c1 e0 04             	shl    $0x4,%eax
+  8047b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047ba:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8047bc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8047bf:	e9 87 00 00 00       	jmp    80484b <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8047c4:	f6 c5 04             	test   $0x4,%ch
+  8047c7:	74 6c                	je     804835 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8047c9:	89 ca                	mov    %ecx,%edx
+  8047cb:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8047d1:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8047d7:	74 7c                	je     804855 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8047d9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8047df:	89 da                	mov    %ebx,%edx
+  8047e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8047e4:	e8 67 fb ff ff       	call   804350 <duppage>
+  8047e9:	85 c0                	test   %eax,%eax
+  8047eb:	0f 88 4f 01 00 00    	js     804940 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8047f1:	83 c3 01             	add    $0x1,%ebx
+  8047f4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8047f7:	74 7a                	je     804873 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8047f9:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8047fb:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804802:	f6 c1 01             	test   $0x1,%cl
+  804805:	74 ea                	je     8047f1 <sfork+0x109>
+  804807:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80480d:	74 e2                	je     8047f1 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80480f:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804815:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804818:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80481d:	76 a5                	jbe    8047c4 <sfork+0xdc>
+  80481f:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804825:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804828:	39 fa                	cmp    %edi,%edx
+  80482a:	73 9d                	jae    8047c9 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80482c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80482f:	39 fa                	cmp    %edi,%edx
+  804831:	72 96                	jb     8047c9 <sfork+0xe1>
+  804833:	eb 8f                	jmp    8047c4 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804835:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80483b:	89 da                	mov    %ebx,%edx
+  80483d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804840:	e8 8c fa ff ff       	call   8042d1 <duppage_cow>
+  804845:	85 c0                	test   %eax,%eax
+  804847:	79 a8                	jns    8047f1 <sfork+0x109>
+  804849:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80484b:	89 f8                	mov    %edi,%eax
+  80484d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804850:	5b                   	pop    %ebx
+  804851:	5e                   	pop    %esi
+  804852:	5f                   	pop    %edi
+  804853:	5d                   	pop    %ebp
+  804854:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804855:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80485a:	e8 2e fb ff ff       	call   80438d <cow_copy>
+  80485f:	85 c0                	test   %eax,%eax
+  804861:	0f 88 d2 00 00 00    	js     804939 <sfork+0x251>
+				pte = uvpt[pn];
+  804867:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80486e:	e9 66 ff ff ff       	jmp    8047d9 <sfork+0xf1>
+  804873:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804876:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804879:	83 c6 01             	add    $0x1,%esi
+  80487c:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804882:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804888:	74 1b                	je     8048a5 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80488a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804891:	a8 01                	test   $0x1,%al
+  804893:	74 e4                	je     804879 <sfork+0x191>
+  804895:	89 f3                	mov    %esi,%ebx
+  804897:	c1 e3 0a             	shl    $0xa,%ebx
+  80489a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80489d:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8048a0:	e9 4f ff ff ff       	jmp    8047f4 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8048a5:	83 ec 04             	sub    $0x4,%esp
+  8048a8:	6a 07                	push   $0x7
+  8048aa:	68 00 f0 bf ee       	push   $0xeebff000
+  8048af:	ff 75 e0             	push   -0x20(%ebp)
+  8048b2:	e8 1d c4 ff ff       	call   800cd4 <sys_page_alloc>
+  8048b7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8048b9:	83 c4 10             	add    $0x10,%esp
+  8048bc:	85 c0                	test   %eax,%eax
+  8048be:	78 37                	js     8048f7 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8048c0:	83 ec 08             	sub    $0x8,%esp
+  8048c3:	68 4c 4b 80 00       	push   $0x804b4c
+  8048c8:	ff 75 e0             	push   -0x20(%ebp)
+  8048cb:	e8 81 c5 ff ff       	call   800e51 <sys_env_set_pgfault_upcall>
+  8048d0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8048d2:	83 c4 10             	add    $0x10,%esp
+  8048d5:	85 c0                	test   %eax,%eax
+  8048d7:	78 34                	js     80490d <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8048d9:	83 ec 08             	sub    $0x8,%esp
+  8048dc:	6a 02                	push   $0x2
+  8048de:	ff 75 e0             	push   -0x20(%ebp)
+  8048e1:	e8 d3 c4 ff ff       	call   800db9 <sys_env_set_status>
+  8048e6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8048e8:	83 c4 10             	add    $0x10,%esp
+  8048eb:	85 c0                	test   %eax,%eax
+  8048ed:	78 34                	js     804923 <sfork+0x23b>
+	return eid;
+  8048ef:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8048f2:	e9 54 ff ff ff       	jmp    80484b <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8048f7:	83 ec 08             	sub    $0x8,%esp
+  8048fa:	50                   	push   %eax
+  8048fb:	68 e8 55 80 00       	push   $0x8055e8
+  804900:	e8 ad b9 ff ff       	call   8002b2 <cprintf>
+		return r;
+  804905:	83 c4 10             	add    $0x10,%esp
+  804908:	e9 3e ff ff ff       	jmp    80484b <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80490d:	83 ec 08             	sub    $0x8,%esp
+  804910:	50                   	push   %eax
+  804911:	68 10 56 80 00       	push   $0x805610
+  804916:	e8 97 b9 ff ff       	call   8002b2 <cprintf>
+		return r;
+  80491b:	83 c4 10             	add    $0x10,%esp
+  80491e:	e9 28 ff ff ff       	jmp    80484b <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804923:	83 ec 08             	sub    $0x8,%esp
+  804926:	50                   	push   %eax
+  804927:	68 85 56 80 00       	push   $0x805685
+  80492c:	e8 81 b9 ff ff       	call   8002b2 <cprintf>
+		return r;
+  804931:	83 c4 10             	add    $0x10,%esp
+  804934:	e9 12 ff ff ff       	jmp    80484b <sfork+0x163>
+  804939:	89 c7                	mov    %eax,%edi
+  80493b:	e9 0b ff ff ff       	jmp    80484b <sfork+0x163>
+  804940:	89 c7                	mov    %eax,%edi
+  804942:	e9 04 ff ff ff       	jmp    80484b <sfork+0x163>
+
+00804947 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804947:	55                   	push   %ebp
+  804948:	89 e5                	mov    %esp,%ebp
+  80494a:	57                   	push   %edi
+  80494b:	56                   	push   %esi
+  80494c:	53                   	push   %ebx
+  80494d:	83 ec 18             	sub    $0x18,%esp
+  804950:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804953:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804956:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804959:	85 c0                	test   %eax,%eax
+  80495b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804960:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804963:	50                   	push   %eax
+  804964:	e8 61 c5 ff ff       	call   800eca <sys_ipc_recv>
+	if (r < 0) {
+  804969:	83 c4 10             	add    $0x10,%esp
+  80496c:	85 c0                	test   %eax,%eax
+  80496e:	78 2b                	js     80499b <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804970:	85 ff                	test   %edi,%edi
+  804972:	74 55                	je     8049c9 <ipc_recv+0x82>
+  804974:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804976:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80497c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804981:	77 39                	ja     8049bc <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804983:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804988:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80498a:	c1 e8 10             	shr    $0x10,%eax
+  80498d:	74 2d                	je     8049bc <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80498f:	c1 e0 10             	shl    $0x10,%eax
+  804992:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804997:	29 c2                	sub    %eax,%edx
+  804999:	eb 27                	jmp    8049c2 <ipc_recv+0x7b>
+  80499b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80499d:	83 ec 08             	sub    $0x8,%esp
+  8049a0:	50                   	push   %eax
+  8049a1:	68 a3 56 80 00       	push   $0x8056a3
+  8049a6:	e8 07 b9 ff ff       	call   8002b2 <cprintf>
+		*from_env_store = 0;
+  8049ab:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8049b1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8049b7:	83 c4 10             	add    $0x10,%esp
+  8049ba:	eb 77                	jmp    804a33 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8049bc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8049c2:	8b 02                	mov    (%edx),%eax
+  8049c4:	8b 40 78             	mov    0x78(%eax),%eax
+  8049c7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8049c9:	85 f6                	test   %esi,%esi
+  8049cb:	74 34                	je     804a01 <ipc_recv+0xba>
+  8049cd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8049cf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8049d5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8049da:	77 18                	ja     8049f4 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8049dc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8049e1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8049e3:	c1 e8 10             	shr    $0x10,%eax
+  8049e6:	74 0c                	je     8049f4 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8049e8:	c1 e0 10             	shl    $0x10,%eax
+  8049eb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8049f0:	29 c2                	sub    %eax,%edx
+  8049f2:	eb 06                	jmp    8049fa <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8049f4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8049fa:	8b 02                	mov    (%edx),%eax
+  8049fc:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8049ff:	89 06                	mov    %eax,(%esi)
+  804a01:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a03:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a09:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a0e:	77 18                	ja     804a28 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a10:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a15:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a17:	c1 e8 10             	shr    $0x10,%eax
+  804a1a:	74 0c                	je     804a28 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a1c:	c1 e0 10             	shl    $0x10,%eax
+  804a1f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a24:	29 c2                	sub    %eax,%edx
+  804a26:	eb 06                	jmp    804a2e <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804a28:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804a2e:	8b 02                	mov    (%edx),%eax
+  804a30:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804a33:	89 d8                	mov    %ebx,%eax
+  804a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a38:	5b                   	pop    %ebx
+  804a39:	5e                   	pop    %esi
+  804a3a:	5f                   	pop    %edi
+  804a3b:	5d                   	pop    %ebp
+  804a3c:	c3                   	ret
+
+00804a3d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804a3d:	55                   	push   %ebp
+  804a3e:	89 e5                	mov    %esp,%ebp
+  804a40:	57                   	push   %edi
+  804a41:	56                   	push   %esi
+  804a42:	53                   	push   %ebx
+  804a43:	83 ec 0c             	sub    $0xc,%esp
+  804a46:	8b 75 08             	mov    0x8(%ebp),%esi
+  804a49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804a4c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804a4f:	85 db                	test   %ebx,%ebx
+  804a51:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804a56:	0f 44 d8             	cmove  %eax,%ebx
+  804a59:	eb 05                	jmp    804a60 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804a5b:	e8 48 c2 ff ff       	call   800ca8 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804a60:	57                   	push   %edi
+  804a61:	53                   	push   %ebx
+  804a62:	ff 75 0c             	push   0xc(%ebp)
+  804a65:	56                   	push   %esi
+  804a66:	e8 32 c4 ff ff       	call   800e9d <sys_ipc_try_send>
+		if (r == 0) {
+  804a6b:	83 c4 10             	add    $0x10,%esp
+  804a6e:	85 c0                	test   %eax,%eax
+  804a70:	74 19                	je     804a8b <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804a72:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804a75:	74 e4                	je     804a5b <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804a77:	83 ec 0c             	sub    $0xc,%esp
+  804a7a:	50                   	push   %eax
+  804a7b:	57                   	push   %edi
+  804a7c:	53                   	push   %ebx
+  804a7d:	56                   	push   %esi
+  804a7e:	68 bc 56 80 00       	push   $0x8056bc
+  804a83:	e8 2a b8 ff ff       	call   8002b2 <cprintf>
+			return;
+  804a88:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804a8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a8e:	5b                   	pop    %ebx
+  804a8f:	5e                   	pop    %esi
+  804a90:	5f                   	pop    %edi
+  804a91:	5d                   	pop    %ebp
+  804a92:	c3                   	ret
+
+00804a93 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a93:	55                   	push   %ebp
+  804a94:	89 e5                	mov    %esp,%ebp
+  804a96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a99:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a9e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804aa1:	c1 e0 04             	shl    $0x4,%eax
+  804aa4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804aa9:	8b 40 50             	mov    0x50(%eax),%eax
+  804aac:	39 c8                	cmp    %ecx,%eax
+  804aae:	74 12                	je     804ac2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804ab0:	83 c2 01             	add    $0x1,%edx
+  804ab3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804ab9:	75 e3                	jne    804a9e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac0:	eb 0e                	jmp    804ad0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804ac2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804ac5:	c1 e0 04             	shl    $0x4,%eax
+  804ac8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804acd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804ad0:	5d                   	pop    %ebp
+  804ad1:	c3                   	ret
+
+00804ad2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804ad2:	55                   	push   %ebp
+  804ad3:	89 e5                	mov    %esp,%ebp
+  804ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ad8:	89 c2                	mov    %eax,%edx
+  804ada:	c1 ea 16             	shr    $0x16,%edx
+  804add:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804ae4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ae9:	f6 c1 01             	test   $0x1,%cl
+  804aec:	74 1c                	je     804b0a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804aee:	c1 e8 0c             	shr    $0xc,%eax
+  804af1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804af8:	a8 01                	test   $0x1,%al
+  804afa:	74 0e                	je     804b0a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804afc:	c1 e8 0c             	shr    $0xc,%eax
+  804aff:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804b06:	ef 
+  804b07:	0f b7 d2             	movzwl %dx,%edx
+}
+  804b0a:	89 d0                	mov    %edx,%eax
+  804b0c:	5d                   	pop    %ebp
+  804b0d:	c3                   	ret
+
+00804b0e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804b0e:	55                   	push   %ebp
+  804b0f:	89 e5                	mov    %esp,%ebp
+  804b11:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804b14:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804b1b:	74 0a                	je     804b27 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b20:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804b25:	c9                   	leave
+  804b26:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804b27:	83 ec 04             	sub    $0x4,%esp
+  804b2a:	6a 07                	push   $0x7
+  804b2c:	68 00 f0 bf ee       	push   $0xeebff000
+  804b31:	6a 00                	push   $0x0
+  804b33:	e8 9c c1 ff ff       	call   800cd4 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804b38:	83 c4 08             	add    $0x8,%esp
+  804b3b:	68 4c 4b 80 00       	push   $0x804b4c
+  804b40:	6a 00                	push   $0x0
+  804b42:	e8 0a c3 ff ff       	call   800e51 <sys_env_set_pgfault_upcall>
+  804b47:	83 c4 10             	add    $0x10,%esp
+  804b4a:	eb d1                	jmp    804b1d <set_pgfault_handler+0xf>
+
+00804b4c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804b4c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804b4d:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804b52:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804b54:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804b57:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804b5b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804b5f:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804b62:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804b66:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804b68:	83 c4 08             	add    $0x8,%esp
+	popal
+  804b6b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804b6c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804b6f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804b70:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804b71:	c3                   	ret
+
+00804b72 <udm>:
+  804b72:	57                   	push   %edi
+  804b73:	56                   	push   %esi
+  804b74:	53                   	push   %ebx
+  804b75:	83 ec 20             	sub    $0x20,%esp
+  804b78:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804b7c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804b80:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804b84:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804b88:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b8c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b90:	89 d1                	mov    %edx,%ecx
+  804b92:	09 c1                	or     %eax,%ecx
+  804b94:	0f 84 91 00 00 00    	je     804c2b <udm+0xb9>
+  804b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ba4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ba9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804bb0:	00 
+  804bb1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804bb8:	00 
+  804bb9:	eb 08                	jmp    804bc3 <udm+0x51>
+  804bbb:	83 e9 01             	sub    $0x1,%ecx
+  804bbe:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804bc1:	74 7c                	je     804c3f <udm+0xcd>
+  804bc3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804bc7:	01 c0                	add    %eax,%eax
+  804bc9:	89 c6                	mov    %eax,%esi
+  804bcb:	89 d7                	mov    %edx,%edi
+  804bcd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804bd1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804bd5:	0f ad d0             	shrd   %cl,%edx,%eax
+  804bd8:	d3 ea                	shr    %cl,%edx
+  804bda:	f6 c1 20             	test   $0x20,%cl
+  804bdd:	74 04                	je     804be3 <udm+0x71>
+  804bdf:	89 d0                	mov    %edx,%eax
+  804be1:	31 d2                	xor    %edx,%edx
+  804be3:	83 e0 01             	and    $0x1,%eax
+  804be6:	89 04 24             	mov    %eax,(%esp)
+  804be9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804bf0:	00 
+  804bf1:	8b 04 24             	mov    (%esp),%eax
+  804bf4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804bf8:	09 f0                	or     %esi,%eax
+  804bfa:	09 fa                	or     %edi,%edx
+  804bfc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804c00:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804c04:	39 f0                	cmp    %esi,%eax
+  804c06:	89 d3                	mov    %edx,%ebx
+  804c08:	19 fb                	sbb    %edi,%ebx
+  804c0a:	72 af                	jb     804bbb <udm+0x49>
+  804c0c:	29 f0                	sub    %esi,%eax
+  804c0e:	19 fa                	sbb    %edi,%edx
+  804c10:	89 cf                	mov    %ecx,%edi
+  804c12:	c1 ef 05             	shr    $0x5,%edi
+  804c15:	83 e7 01             	and    $0x1,%edi
+  804c18:	89 fe                	mov    %edi,%esi
+  804c1a:	83 f6 01             	xor    $0x1,%esi
+  804c1d:	d3 e6                	shl    %cl,%esi
+  804c1f:	d3 e7                	shl    %cl,%edi
+  804c21:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c25:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c29:	eb 90                	jmp    804bbb <udm+0x49>
+  804c2b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804c2f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804c33:	89 f0                	mov    %esi,%eax
+  804c35:	89 fa                	mov    %edi,%edx
+  804c37:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804c3b:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804c3f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804c43:	89 01                	mov    %eax,(%ecx)
+  804c45:	89 51 04             	mov    %edx,0x4(%ecx)
+  804c48:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c4c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c50:	83 c4 20             	add    $0x20,%esp
+  804c53:	5b                   	pop    %ebx
+  804c54:	5e                   	pop    %esi
+  804c55:	5f                   	pop    %edi
+  804c56:	c3                   	ret
+
+00804c57 <__udivdi3>:
+  804c57:	83 ec 18             	sub    $0x18,%esp
+  804c5a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c5e:	50                   	push   %eax
+  804c5f:	ff 74 24 2c          	push   0x2c(%esp)
+  804c63:	ff 74 24 2c          	push   0x2c(%esp)
+  804c67:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c6b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c6f:	e8 fe fe ff ff       	call   804b72 <udm>
+  804c74:	83 c4 24             	add    $0x24,%esp
+  804c77:	c3                   	ret
+
+00804c78 <__umoddi3>:
+  804c78:	83 ec 18             	sub    $0x18,%esp
+  804c7b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c7f:	50                   	push   %eax
+  804c80:	ff 74 24 2c          	push   0x2c(%esp)
+  804c84:	ff 74 24 2c          	push   0x2c(%esp)
+  804c88:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c8c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c90:	e8 dd fe ff ff       	call   804b72 <udm>
+  804c95:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c99:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c9d:	83 c4 24             	add    $0x24,%esp
+  804ca0:	c3                   	ret
+
+00804ca1 <__divdi3>:
+  804ca1:	56                   	push   %esi
+  804ca2:	53                   	push   %ebx
+  804ca3:	83 ec 14             	sub    $0x14,%esp
+  804ca6:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804caa:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804cae:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804cb2:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804cb6:	85 d2                	test   %edx,%edx
+  804cb8:	78 18                	js     804cd2 <__divdi3+0x31>
+  804cba:	85 db                	test   %ebx,%ebx
+  804cbc:	78 3e                	js     804cfc <__divdi3+0x5b>
+  804cbe:	83 ec 04             	sub    $0x4,%esp
+  804cc1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804cc5:	56                   	push   %esi
+  804cc6:	53                   	push   %ebx
+  804cc7:	51                   	push   %ecx
+  804cc8:	e8 a5 fe ff ff       	call   804b72 <udm>
+  804ccd:	83 c4 10             	add    $0x10,%esp
+  804cd0:	eb 24                	jmp    804cf6 <__divdi3+0x55>
+  804cd2:	f7 d8                	neg    %eax
+  804cd4:	83 d2 00             	adc    $0x0,%edx
+  804cd7:	f7 da                	neg    %edx
+  804cd9:	85 db                	test   %ebx,%ebx
+  804cdb:	78 3a                	js     804d17 <__divdi3+0x76>
+  804cdd:	83 ec 04             	sub    $0x4,%esp
+  804ce0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804ce4:	56                   	push   %esi
+  804ce5:	53                   	push   %ebx
+  804ce6:	51                   	push   %ecx
+  804ce7:	e8 86 fe ff ff       	call   804b72 <udm>
+  804cec:	83 c4 10             	add    $0x10,%esp
+  804cef:	f7 d8                	neg    %eax
+  804cf1:	83 d2 00             	adc    $0x0,%edx
+  804cf4:	f7 da                	neg    %edx
+  804cf6:	83 c4 14             	add    $0x14,%esp
+  804cf9:	5b                   	pop    %ebx
+  804cfa:	5e                   	pop    %esi
+  804cfb:	c3                   	ret
+  804cfc:	83 ec 04             	sub    $0x4,%esp
+  804cff:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d03:	56                   	push   %esi
+  804d04:	f7 d9                	neg    %ecx
+  804d06:	83 d3 00             	adc    $0x0,%ebx
+  804d09:	f7 db                	neg    %ebx
+  804d0b:	53                   	push   %ebx
+  804d0c:	51                   	push   %ecx
+  804d0d:	e8 60 fe ff ff       	call   804b72 <udm>
+  804d12:	83 c4 10             	add    $0x10,%esp
+  804d15:	eb d8                	jmp    804cef <__divdi3+0x4e>
+  804d17:	83 ec 04             	sub    $0x4,%esp
+  804d1a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d1e:	56                   	push   %esi
+  804d1f:	f7 d9                	neg    %ecx
+  804d21:	83 d3 00             	adc    $0x0,%ebx
+  804d24:	f7 db                	neg    %ebx
+  804d26:	53                   	push   %ebx
+  804d27:	51                   	push   %ecx
+  804d28:	e8 45 fe ff ff       	call   804b72 <udm>
+  804d2d:	83 c4 10             	add    $0x10,%esp
+  804d30:	eb c4                	jmp    804cf6 <__divdi3+0x55>
+
+00804d32 <__moddi3>:
+  804d32:	55                   	push   %ebp
+  804d33:	57                   	push   %edi
+  804d34:	56                   	push   %esi
+  804d35:	53                   	push   %ebx
+  804d36:	83 ec 24             	sub    $0x24,%esp
+  804d39:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804d3d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804d41:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804d45:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804d49:	85 d2                	test   %edx,%edx
+  804d4b:	78 3b                	js     804d88 <__moddi3+0x56>
+  804d4d:	83 ec 04             	sub    $0x4,%esp
+  804d50:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804d54:	56                   	push   %esi
+  804d55:	89 ce                	mov    %ecx,%esi
+  804d57:	f7 de                	neg    %esi
+  804d59:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804d5d:	89 de                	mov    %ebx,%esi
+  804d5f:	83 d6 00             	adc    $0x0,%esi
+  804d62:	f7 de                	neg    %esi
+  804d64:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804d68:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d6c:	0f 48 f1             	cmovs  %ecx,%esi
+  804d6f:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804d74:	53                   	push   %ebx
+  804d75:	56                   	push   %esi
+  804d76:	e8 f7 fd ff ff       	call   804b72 <udm>
+  804d7b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d7f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d83:	83 c4 10             	add    $0x10,%esp
+  804d86:	eb 47                	jmp    804dcf <__moddi3+0x9d>
+  804d88:	f7 d8                	neg    %eax
+  804d8a:	83 d2 00             	adc    $0x0,%edx
+  804d8d:	f7 da                	neg    %edx
+  804d8f:	83 ec 04             	sub    $0x4,%esp
+  804d92:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804d96:	56                   	push   %esi
+  804d97:	89 cf                	mov    %ecx,%edi
+  804d99:	f7 df                	neg    %edi
+  804d9b:	89 de                	mov    %ebx,%esi
+  804d9d:	83 d6 00             	adc    $0x0,%esi
+  804da0:	f7 de                	neg    %esi
+  804da2:	0f 49 cf             	cmovns %edi,%ecx
+  804da5:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804da9:	0f 49 de             	cmovns %esi,%ebx
+  804dac:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804db0:	ff 74 24 0c          	push   0xc(%esp)
+  804db4:	ff 74 24 0c          	push   0xc(%esp)
+  804db8:	e8 b5 fd ff ff       	call   804b72 <udm>
+  804dbd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804dc1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804dc5:	f7 d8                	neg    %eax
+  804dc7:	83 d2 00             	adc    $0x0,%edx
+  804dca:	f7 da                	neg    %edx
+  804dcc:	83 c4 10             	add    $0x10,%esp
+  804dcf:	83 c4 24             	add    $0x24,%esp
+  804dd2:	5b                   	pop    %ebx
+  804dd3:	5e                   	pop    %esi
+  804dd4:	5f                   	pop    %edi
+  804dd5:	5d                   	pop    %ebp
+  804dd6:	c3                   	ret
@@ -0,0 +1,10513 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 20 4f 80 00       	push   $0x804f20
+  800074:	e8 95 04 00 00       	call   80050e <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 60 80 00       	push   $0x806000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 e8 4f 80 00       	push   $0x804fe8
+  8000a3:	e8 66 04 00 00       	call   80050e <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 c0 82 80 00       	push   $0x8082c0
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 24 50 80 00       	push   $0x805024
+  8000cd:	e8 3c 04 00 00       	call   80050e <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 5c 4f 80 00       	push   $0x804f5c
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 2d 0a 00 00       	call   800b16 <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 2f 4f 80 00       	push   $0x804f2f
+  800101:	e8 08 04 00 00       	call   80050e <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 46 4f 80 00       	push   $0x804f46
+  800113:	e8 f6 03 00 00       	call   80050e <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 68 4f 80 00       	push   $0x804f68
+  800125:	56                   	push   %esi
+  800126:	e8 eb 09 00 00       	call   800b16 <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 dc 09 00 00       	call   800b16 <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 69 4f 80 00       	push   $0x804f69
+  800142:	56                   	push   %esi
+  800143:	e8 ce 09 00 00       	call   800b16 <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 6b 4f 80 00       	push   $0x804f6b
+  800161:	e8 a8 03 00 00       	call   80050e <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 6f 4f 80 00 	movl   $0x804f6f,(%esp)
+  80016d:	e8 9c 03 00 00       	call   80050e <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 25 14 00 00       	call   8015a3 <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 9a 4f 80 00       	push   $0x804f9a
+  800192:	6a 39                	push   $0x39
+  800194:	68 8e 4f 80 00       	push   $0x804f8e
+  800199:	e8 95 02 00 00       	call   800433 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 81 4f 80 00       	push   $0x804f81
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 8e 4f 80 00       	push   $0x804f8e
+  8001ab:	e8 83 02 00 00       	call   800433 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 39 14 00 00       	call   8015f5 <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 b4 4f 80 00       	push   $0x804fb4
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 8e 4f 80 00       	push   $0x804f8e
+  8001d0:	e8 5e 02 00 00       	call   800433 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 d3 4f 80 00       	push   $0x804fd3
+  8001de:	e8 2b 03 00 00       	call   80050e <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 bc 4f 80 00       	push   $0x804fbc
+  8001ee:	e8 1b 03 00 00       	call   80050e <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 d0 4f 80 00       	push   $0x804fd0
+  8001fd:	68 cf 4f 80 00       	push   $0x804fcf
+  800202:	e8 66 2d 00 00       	call   802f6d <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 88 39 00 00       	call   803b9f <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 53 50 80 00       	push   $0x805053
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 bd 08 00 00       	call   800af2 <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 04 0a 00 00       	call   800c78 <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 b8 0b 00 00       	call   800e36 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 5a 0c 00 00       	call   800f04 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 b2 0b 00 00       	call   800e61 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 52 0b 00 00       	call   800e36 <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 e3 13 00 00       	call   8016df <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 2b 11 00 00       	call   80144f <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 77 80 00    	mov    0x807770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 ac 10 00 00       	call   8013f9 <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 ca 0b 00 00       	call   800f30 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 77 80 00    	mov    0x807770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 47 10 00 00       	call   8013d2 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	57                   	push   %edi
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+  800396:	83 ec 1c             	sub    $0x1c,%esp
+  800399:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80039c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80039f:	e8 34 0b 00 00       	call   800ed8 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8003a4:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8003a7:	89 15 30 9a 80 00    	mov    %edx,0x809a30
+	thisenv = &envs[ENVX(eid)];
+  8003ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003b2:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8003b4:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8003b6:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8003bc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8003c1:	77 16                	ja     8003d9 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8003c3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8003c8:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8003ca:	c1 e8 10             	shr    $0x10,%eax
+  8003cd:	74 0a                	je     8003d9 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8003cf:	c1 e0 10             	shl    $0x10,%eax
+  8003d2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8003d7:	29 c2                	sub    %eax,%edx
+  8003d9:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8003dc:	c1 e0 04             	shl    $0x4,%eax
+  8003df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003e4:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003e6:	85 db                	test   %ebx,%ebx
+  8003e8:	7e 07                	jle    8003f1 <libmain+0x61>
+		binaryname = argv[0];
+  8003ea:	8b 06                	mov    (%esi),%eax
+  8003ec:	a3 8c 77 80 00       	mov    %eax,0x80778c
+
+	// call user main routine
+	umain(argc, argv);
+  8003f1:	83 ec 08             	sub    $0x8,%esp
+  8003f4:	56                   	push   %esi
+  8003f5:	53                   	push   %ebx
+  8003f6:	e8 65 fc ff ff       	call   800060 <umain>
+
+	// exit gracefully
+	exit();
+  8003fb:	e8 0b 00 00 00       	call   80040b <exit>
+}
+  800400:	83 c4 10             	add    $0x10,%esp
+  800403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800406:	5b                   	pop    %ebx
+  800407:	5e                   	pop    %esi
+  800408:	5f                   	pop    %edi
+  800409:	5d                   	pop    %ebp
+  80040a:	c3                   	ret
+
+0080040b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800411:	6a 00                	push   $0x0
+  800413:	e8 15 21 00 00       	call   80252d <fflush>
+	pthread_kill_others();
+  800418:	e8 ee 3d 00 00       	call   80420b <pthread_kill_others>
+	close_all();
+  80041d:	e8 ae 11 00 00       	call   8015d0 <close_all>
+	sys_env_destroy(0);
+  800422:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800429:	e8 5f 0a 00 00       	call   800e8d <sys_env_destroy>
+}
+  80042e:	83 c4 10             	add    $0x10,%esp
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	56                   	push   %esi
+  800437:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800438:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80043b:	8b 35 8c 77 80 00    	mov    0x80778c,%esi
+  800441:	e8 92 0a 00 00       	call   800ed8 <sys_getenvid>
+  800446:	83 ec 0c             	sub    $0xc,%esp
+  800449:	ff 75 0c             	push   0xc(%ebp)
+  80044c:	ff 75 08             	push   0x8(%ebp)
+  80044f:	56                   	push   %esi
+  800450:	50                   	push   %eax
+  800451:	68 6c 50 80 00       	push   $0x80506c
+  800456:	e8 b3 00 00 00       	call   80050e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80045b:	83 c4 18             	add    $0x18,%esp
+  80045e:	53                   	push   %ebx
+  80045f:	ff 75 10             	push   0x10(%ebp)
+  800462:	e8 56 00 00 00       	call   8004bd <vcprintf>
+	cprintf("\n");
+  800467:	c7 04 24 16 58 80 00 	movl   $0x805816,(%esp)
+  80046e:	e8 9b 00 00 00       	call   80050e <cprintf>
+  800473:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800476:	cc                   	int3
+	while (1)
+  800477:	eb fd                	jmp    800476 <_panic+0x43>
+
+00800479 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	53                   	push   %ebx
+  80047d:	83 ec 04             	sub    $0x4,%esp
+  800480:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800483:	8b 13                	mov    (%ebx),%edx
+  800485:	8d 42 01             	lea    0x1(%edx),%eax
+  800488:	89 03                	mov    %eax,(%ebx)
+  80048a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80048d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800491:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800496:	74 09                	je     8004a1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800498:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80049c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80049f:	c9                   	leave
+  8004a0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	68 ff 00 00 00       	push   $0xff
+  8004a9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004ac:	50                   	push   %eax
+  8004ad:	e8 84 09 00 00       	call   800e36 <sys_cputs>
+		b->idx = 0;
+  8004b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004b8:	83 c4 10             	add    $0x10,%esp
+  8004bb:	eb db                	jmp    800498 <putch+0x1f>
+
+008004bd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004bd:	55                   	push   %ebp
+  8004be:	89 e5                	mov    %esp,%ebp
+  8004c0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004c6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004cd:	00 00 00 
+	b.cnt = 0;
+  8004d0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004d7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004da:	ff 75 0c             	push   0xc(%ebp)
+  8004dd:	ff 75 08             	push   0x8(%ebp)
+  8004e0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004e6:	50                   	push   %eax
+  8004e7:	68 79 04 80 00       	push   $0x800479
+  8004ec:	e8 14 01 00 00       	call   800605 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004f1:	83 c4 08             	add    $0x8,%esp
+  8004f4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004fa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800500:	50                   	push   %eax
+  800501:	e8 30 09 00 00       	call   800e36 <sys_cputs>
+
+	return b.cnt;
+}
+  800506:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+0080050e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800514:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800517:	50                   	push   %eax
+  800518:	ff 75 08             	push   0x8(%ebp)
+  80051b:	e8 9d ff ff ff       	call   8004bd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800520:	c9                   	leave
+  800521:	c3                   	ret
+
+00800522 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800522:	55                   	push   %ebp
+  800523:	89 e5                	mov    %esp,%ebp
+  800525:	57                   	push   %edi
+  800526:	56                   	push   %esi
+  800527:	53                   	push   %ebx
+  800528:	83 ec 1c             	sub    $0x1c,%esp
+  80052b:	89 c7                	mov    %eax,%edi
+  80052d:	89 d6                	mov    %edx,%esi
+  80052f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800532:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800535:	89 d1                	mov    %edx,%ecx
+  800537:	89 c2                	mov    %eax,%edx
+  800539:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80053f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800542:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800545:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800548:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80054f:	39 c2                	cmp    %eax,%edx
+  800551:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800554:	72 3e                	jb     800594 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800556:	83 ec 0c             	sub    $0xc,%esp
+  800559:	ff 75 18             	push   0x18(%ebp)
+  80055c:	83 eb 01             	sub    $0x1,%ebx
+  80055f:	53                   	push   %ebx
+  800560:	50                   	push   %eax
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	ff 75 e4             	push   -0x1c(%ebp)
+  800567:	ff 75 e0             	push   -0x20(%ebp)
+  80056a:	ff 75 dc             	push   -0x24(%ebp)
+  80056d:	ff 75 d8             	push   -0x28(%ebp)
+  800570:	e8 1b 48 00 00       	call   804d90 <__udivdi3>
+  800575:	83 c4 18             	add    $0x18,%esp
+  800578:	52                   	push   %edx
+  800579:	50                   	push   %eax
+  80057a:	89 f2                	mov    %esi,%edx
+  80057c:	89 f8                	mov    %edi,%eax
+  80057e:	e8 9f ff ff ff       	call   800522 <printnum>
+  800583:	83 c4 20             	add    $0x20,%esp
+  800586:	eb 13                	jmp    80059b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	56                   	push   %esi
+  80058c:	ff 75 18             	push   0x18(%ebp)
+  80058f:	ff d7                	call   *%edi
+  800591:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800594:	83 eb 01             	sub    $0x1,%ebx
+  800597:	85 db                	test   %ebx,%ebx
+  800599:	7f ed                	jg     800588 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80059b:	83 ec 08             	sub    $0x8,%esp
+  80059e:	56                   	push   %esi
+  80059f:	83 ec 04             	sub    $0x4,%esp
+  8005a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8005a5:	ff 75 e0             	push   -0x20(%ebp)
+  8005a8:	ff 75 dc             	push   -0x24(%ebp)
+  8005ab:	ff 75 d8             	push   -0x28(%ebp)
+  8005ae:	e8 fe 47 00 00       	call   804db1 <__umoddi3>
+  8005b3:	83 c4 14             	add    $0x14,%esp
+  8005b6:	0f be 80 8f 50 80 00 	movsbl 0x80508f(%eax),%eax
+  8005bd:	50                   	push   %eax
+  8005be:	ff d7                	call   *%edi
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005c6:	5b                   	pop    %ebx
+  8005c7:	5e                   	pop    %esi
+  8005c8:	5f                   	pop    %edi
+  8005c9:	5d                   	pop    %ebp
+  8005ca:	c3                   	ret
+
+008005cb <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005cb:	55                   	push   %ebp
+  8005cc:	89 e5                	mov    %esp,%ebp
+  8005ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005d1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005d5:	8b 10                	mov    (%eax),%edx
+  8005d7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005da:	73 0a                	jae    8005e6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005dc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005df:	89 08                	mov    %ecx,(%eax)
+  8005e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e4:	88 02                	mov    %al,(%edx)
+}
+  8005e6:	5d                   	pop    %ebp
+  8005e7:	c3                   	ret
+
+008005e8 <printfmt>:
+{
+  8005e8:	55                   	push   %ebp
+  8005e9:	89 e5                	mov    %esp,%ebp
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ee:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005f1:	50                   	push   %eax
+  8005f2:	ff 75 10             	push   0x10(%ebp)
+  8005f5:	ff 75 0c             	push   0xc(%ebp)
+  8005f8:	ff 75 08             	push   0x8(%ebp)
+  8005fb:	e8 05 00 00 00       	call   800605 <vprintfmt>
+}
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	c9                   	leave
+  800604:	c3                   	ret
+
+00800605 <vprintfmt>:
+{
+  800605:	55                   	push   %ebp
+  800606:	89 e5                	mov    %esp,%ebp
+  800608:	57                   	push   %edi
+  800609:	56                   	push   %esi
+  80060a:	53                   	push   %ebx
+  80060b:	83 ec 2c             	sub    $0x2c,%esp
+  80060e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800611:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800614:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800617:	eb 0a                	jmp    800623 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	50                   	push   %eax
+  80061e:	ff d6                	call   *%esi
+  800620:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800623:	83 c7 01             	add    $0x1,%edi
+  800626:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80062a:	83 f8 25             	cmp    $0x25,%eax
+  80062d:	74 0c                	je     80063b <vprintfmt+0x36>
+			if (ch == '\0')
+  80062f:	85 c0                	test   %eax,%eax
+  800631:	75 e6                	jne    800619 <vprintfmt+0x14>
+}
+  800633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800636:	5b                   	pop    %ebx
+  800637:	5e                   	pop    %esi
+  800638:	5f                   	pop    %edi
+  800639:	5d                   	pop    %ebp
+  80063a:	c3                   	ret
+		padc = ' ';
+  80063b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80063f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800646:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80064d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800654:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800659:	8d 47 01             	lea    0x1(%edi),%eax
+  80065c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80065f:	0f b6 17             	movzbl (%edi),%edx
+  800662:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800665:	3c 55                	cmp    $0x55,%al
+  800667:	0f 87 c5 03 00 00    	ja     800a32 <vprintfmt+0x42d>
+  80066d:	0f b6 c0             	movzbl %al,%eax
+  800670:	ff 24 85 20 52 80 00 	jmp    *0x805220(,%eax,4)
+  800677:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80067a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80067d:	eb da                	jmp    800659 <vprintfmt+0x54>
+  80067f:	0f be d2             	movsbl %dl,%edx
+  800682:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80068d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800690:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800694:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800697:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80069a:	83 f9 09             	cmp    $0x9,%ecx
+  80069d:	77 55                	ja     8006f4 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80069f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8006a2:	eb e9                	jmp    80068d <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8006b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006b8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006bc:	79 9b                	jns    800659 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006be:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006cb:	eb 8c                	jmp    800659 <vprintfmt+0x54>
+			if (width < 0)
+  8006cd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d7:	0f 49 c2             	cmovns %edx,%eax
+  8006da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8006dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006e0:	e9 74 ff ff ff       	jmp    800659 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8006e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006e8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006ef:	e9 65 ff ff ff       	jmp    800659 <vprintfmt+0x54>
+  8006f4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006f7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006fa:	eb bc                	jmp    8006b8 <vprintfmt+0xb3>
+			lflag++;
+  8006fc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8006ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800702:	e9 52 ff ff ff       	jmp    800659 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8d 78 04             	lea    0x4(%eax),%edi
+  80070d:	83 ec 08             	sub    $0x8,%esp
+  800710:	53                   	push   %ebx
+  800711:	ff 30                	push   (%eax)
+  800713:	ff d6                	call   *%esi
+			break;
+  800715:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800718:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80071b:	e9 b1 02 00 00       	jmp    8009d1 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800720:	8b 45 14             	mov    0x14(%ebp),%eax
+  800723:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800726:	8b 10                	mov    (%eax),%edx
+  800728:	89 d0                	mov    %edx,%eax
+  80072a:	f7 d8                	neg    %eax
+  80072c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80072f:	83 f8 14             	cmp    $0x14,%eax
+  800732:	7f 23                	jg     800757 <vprintfmt+0x152>
+  800734:	8b 14 85 80 53 80 00 	mov    0x805380(,%eax,4),%edx
+  80073b:	85 d2                	test   %edx,%edx
+  80073d:	74 18                	je     800757 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80073f:	52                   	push   %edx
+  800740:	68 ef 54 80 00       	push   $0x8054ef
+  800745:	53                   	push   %ebx
+  800746:	56                   	push   %esi
+  800747:	e8 9c fe ff ff       	call   8005e8 <printfmt>
+  80074c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80074f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800752:	e9 7a 02 00 00       	jmp    8009d1 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800757:	50                   	push   %eax
+  800758:	68 a7 50 80 00       	push   $0x8050a7
+  80075d:	53                   	push   %ebx
+  80075e:	56                   	push   %esi
+  80075f:	e8 84 fe ff ff       	call   8005e8 <printfmt>
+  800764:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800767:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80076a:	e9 62 02 00 00       	jmp    8009d1 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	83 c0 04             	add    $0x4,%eax
+  800775:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80077d:	85 c9                	test   %ecx,%ecx
+  80077f:	b8 a0 50 80 00       	mov    $0x8050a0,%eax
+  800784:	0f 45 c1             	cmovne %ecx,%eax
+  800787:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80078a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80078e:	7e 06                	jle    800796 <vprintfmt+0x191>
+  800790:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800794:	75 0b                	jne    8007a1 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800796:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800799:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80079c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80079f:	eb 5c                	jmp    8007fd <vprintfmt+0x1f8>
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  8007a4:	ff 75 d0             	push   -0x30(%ebp)
+  8007a7:	ff 75 cc             	push   -0x34(%ebp)
+  8007aa:	e8 20 03 00 00       	call   800acf <strnlen>
+  8007af:	89 c2                	mov    %eax,%edx
+  8007b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007b4:	29 d0                	sub    %edx,%eax
+  8007b6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007b9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007c0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007c3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c5:	eb 0e                	jmp    8007d5 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+  8007ca:	53                   	push   %ebx
+  8007cb:	57                   	push   %edi
+  8007cc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007cf:	83 ee 01             	sub    $0x1,%esi
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	85 f6                	test   %esi,%esi
+  8007d7:	7f ee                	jg     8007c7 <vprintfmt+0x1c2>
+  8007d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007e6:	0f 49 d0             	cmovns %eax,%edx
+  8007e9:	29 d0                	sub    %edx,%eax
+  8007eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007ee:	eb a6                	jmp    800796 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	52                   	push   %edx
+  8007f5:	ff 55 08             	call   *0x8(%ebp)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007fb:	89 f1                	mov    %esi,%ecx
+  8007fd:	8d 71 01             	lea    0x1(%ecx),%esi
+  800800:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800804:	0f be d0             	movsbl %al,%edx
+  800807:	85 d2                	test   %edx,%edx
+  800809:	74 28                	je     800833 <vprintfmt+0x22e>
+  80080b:	85 ff                	test   %edi,%edi
+  80080d:	78 05                	js     800814 <vprintfmt+0x20f>
+  80080f:	83 ef 01             	sub    $0x1,%edi
+  800812:	78 30                	js     800844 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800814:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800818:	74 d6                	je     8007f0 <vprintfmt+0x1eb>
+  80081a:	0f be c0             	movsbl %al,%eax
+  80081d:	83 e8 20             	sub    $0x20,%eax
+  800820:	83 f8 5e             	cmp    $0x5e,%eax
+  800823:	76 cb                	jbe    8007f0 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800825:	83 ec 08             	sub    $0x8,%esp
+  800828:	53                   	push   %ebx
+  800829:	6a 3f                	push   $0x3f
+  80082b:	ff 55 08             	call   *0x8(%ebp)
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	eb c8                	jmp    8007fb <vprintfmt+0x1f6>
+  800833:	8b 75 08             	mov    0x8(%ebp),%esi
+  800836:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800839:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80083c:	01 d0                	add    %edx,%eax
+  80083e:	29 c8                	sub    %ecx,%eax
+  800840:	89 c7                	mov    %eax,%edi
+  800842:	eb 13                	jmp    800857 <vprintfmt+0x252>
+  800844:	8b 75 08             	mov    0x8(%ebp),%esi
+  800847:	eb ed                	jmp    800836 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800849:	83 ec 08             	sub    $0x8,%esp
+  80084c:	53                   	push   %ebx
+  80084d:	6a 20                	push   $0x20
+  80084f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800851:	83 ef 01             	sub    $0x1,%edi
+  800854:	83 c4 10             	add    $0x10,%esp
+  800857:	85 ff                	test   %edi,%edi
+  800859:	7f ee                	jg     800849 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80085b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80085e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800861:	e9 6b 01 00 00       	jmp    8009d1 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800866:	83 f9 01             	cmp    $0x1,%ecx
+  800869:	7f 1f                	jg     80088a <vprintfmt+0x285>
+	else if (lflag)
+  80086b:	85 c9                	test   %ecx,%ecx
+  80086d:	74 67                	je     8008d6 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8b 00                	mov    (%eax),%eax
+  800874:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800877:	89 c1                	mov    %eax,%ecx
+  800879:	c1 f9 1f             	sar    $0x1f,%ecx
+  80087c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80087f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800882:	8d 40 04             	lea    0x4(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+  800888:	eb 17                	jmp    8008a1 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80088a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088d:	8b 50 04             	mov    0x4(%eax),%edx
+  800890:	8b 00                	mov    (%eax),%eax
+  800892:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800895:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8d 40 08             	lea    0x8(%eax),%eax
+  80089e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008a1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008a4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8008ac:	85 c9                	test   %ecx,%ecx
+  8008ae:	0f 89 03 01 00 00    	jns    8009b7 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8008b4:	83 ec 08             	sub    $0x8,%esp
+  8008b7:	53                   	push   %ebx
+  8008b8:	6a 2d                	push   $0x2d
+  8008ba:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008c2:	f7 da                	neg    %edx
+  8008c4:	83 d1 00             	adc    $0x0,%ecx
+  8008c7:	f7 d9                	neg    %ecx
+  8008c9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008d1:	e9 e1 00 00 00       	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8b 00                	mov    (%eax),%eax
+  8008db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008de:	89 c1                	mov    %eax,%ecx
+  8008e0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ef:	eb b0                	jmp    8008a1 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8008f1:	83 f9 01             	cmp    $0x1,%ecx
+  8008f4:	7f 1e                	jg     800914 <vprintfmt+0x30f>
+	else if (lflag)
+  8008f6:	85 c9                	test   %ecx,%ecx
+  8008f8:	74 32                	je     80092c <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 10                	mov    (%eax),%edx
+  8008ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800904:	8d 40 04             	lea    0x4(%eax),%eax
+  800907:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80090a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80090f:	e9 a3 00 00 00       	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800914:	8b 45 14             	mov    0x14(%ebp),%eax
+  800917:	8b 10                	mov    (%eax),%edx
+  800919:	8b 48 04             	mov    0x4(%eax),%ecx
+  80091c:	8d 40 08             	lea    0x8(%eax),%eax
+  80091f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800922:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800927:	e9 8b 00 00 00       	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80092c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092f:	8b 10                	mov    (%eax),%edx
+  800931:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800936:	8d 40 04             	lea    0x4(%eax),%eax
+  800939:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80093c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800941:	eb 74                	jmp    8009b7 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800943:	83 f9 01             	cmp    $0x1,%ecx
+  800946:	7f 1b                	jg     800963 <vprintfmt+0x35e>
+	else if (lflag)
+  800948:	85 c9                	test   %ecx,%ecx
+  80094a:	74 2c                	je     800978 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 10                	mov    (%eax),%edx
+  800951:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800956:	8d 40 04             	lea    0x4(%eax),%eax
+  800959:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80095c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800961:	eb 54                	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800963:	8b 45 14             	mov    0x14(%ebp),%eax
+  800966:	8b 10                	mov    (%eax),%edx
+  800968:	8b 48 04             	mov    0x4(%eax),%ecx
+  80096b:	8d 40 08             	lea    0x8(%eax),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800971:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800976:	eb 3f                	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800978:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097b:	8b 10                	mov    (%eax),%edx
+  80097d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800982:	8d 40 04             	lea    0x4(%eax),%eax
+  800985:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800988:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80098d:	eb 28                	jmp    8009b7 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80098f:	83 ec 08             	sub    $0x8,%esp
+  800992:	53                   	push   %ebx
+  800993:	6a 30                	push   $0x30
+  800995:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800997:	83 c4 08             	add    $0x8,%esp
+  80099a:	53                   	push   %ebx
+  80099b:	6a 78                	push   $0x78
+  80099d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8b 10                	mov    (%eax),%edx
+  8009a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009a9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8009af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009b7:	83 ec 0c             	sub    $0xc,%esp
+  8009ba:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009be:	50                   	push   %eax
+  8009bf:	ff 75 e0             	push   -0x20(%ebp)
+  8009c2:	57                   	push   %edi
+  8009c3:	51                   	push   %ecx
+  8009c4:	52                   	push   %edx
+  8009c5:	89 da                	mov    %ebx,%edx
+  8009c7:	89 f0                	mov    %esi,%eax
+  8009c9:	e8 54 fb ff ff       	call   800522 <printnum>
+			break;
+  8009ce:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8009d4:	e9 4a fc ff ff       	jmp    800623 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009d9:	83 f9 01             	cmp    $0x1,%ecx
+  8009dc:	7f 1b                	jg     8009f9 <vprintfmt+0x3f4>
+	else if (lflag)
+  8009de:	85 c9                	test   %ecx,%ecx
+  8009e0:	74 2c                	je     800a0e <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8009e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e5:	8b 10                	mov    (%eax),%edx
+  8009e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009f7:	eb be                	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8009f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fc:	8b 10                	mov    (%eax),%edx
+  8009fe:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a01:	8d 40 08             	lea    0x8(%eax),%eax
+  800a04:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a07:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a0c:	eb a9                	jmp    8009b7 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a11:	8b 10                	mov    (%eax),%edx
+  800a13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a18:	8d 40 04             	lea    0x4(%eax),%eax
+  800a1b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a1e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a23:	eb 92                	jmp    8009b7 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800a25:	83 ec 08             	sub    $0x8,%esp
+  800a28:	53                   	push   %ebx
+  800a29:	6a 25                	push   $0x25
+  800a2b:	ff d6                	call   *%esi
+			break;
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	eb 9f                	jmp    8009d1 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800a32:	83 ec 08             	sub    $0x8,%esp
+  800a35:	53                   	push   %ebx
+  800a36:	6a 25                	push   $0x25
+  800a38:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a3a:	83 c4 10             	add    $0x10,%esp
+  800a3d:	89 f8                	mov    %edi,%eax
+  800a3f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a43:	74 05                	je     800a4a <vprintfmt+0x445>
+  800a45:	83 e8 01             	sub    $0x1,%eax
+  800a48:	eb f5                	jmp    800a3f <vprintfmt+0x43a>
+  800a4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a4d:	eb 82                	jmp    8009d1 <vprintfmt+0x3cc>
+
+00800a4f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	83 ec 18             	sub    $0x18,%esp
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a5b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a5e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a62:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a65:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a6c:	85 c0                	test   %eax,%eax
+  800a6e:	74 26                	je     800a96 <vsnprintf+0x47>
+  800a70:	85 d2                	test   %edx,%edx
+  800a72:	7e 22                	jle    800a96 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a74:	ff 75 14             	push   0x14(%ebp)
+  800a77:	ff 75 10             	push   0x10(%ebp)
+  800a7a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a7d:	50                   	push   %eax
+  800a7e:	68 cb 05 80 00       	push   $0x8005cb
+  800a83:	e8 7d fb ff ff       	call   800605 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a88:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a8b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a91:	83 c4 10             	add    $0x10,%esp
+}
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+		return -E_INVAL;
+  800a96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a9b:	eb f7                	jmp    800a94 <vsnprintf+0x45>
+
+00800a9d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a9d:	55                   	push   %ebp
+  800a9e:	89 e5                	mov    %esp,%ebp
+  800aa0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800aa3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800aa6:	50                   	push   %eax
+  800aa7:	ff 75 10             	push   0x10(%ebp)
+  800aaa:	ff 75 0c             	push   0xc(%ebp)
+  800aad:	ff 75 08             	push   0x8(%ebp)
+  800ab0:	e8 9a ff ff ff       	call   800a4f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+
+00800ab7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	eb 03                	jmp    800ac7 <strlen+0x10>
+		n++;
+  800ac4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ac7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800acb:	75 f7                	jne    800ac4 <strlen+0xd>
+	return n;
+}
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+
+00800acf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800add:	eb 03                	jmp    800ae2 <strnlen+0x13>
+		n++;
+  800adf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ae2:	39 d0                	cmp    %edx,%eax
+  800ae4:	74 08                	je     800aee <strnlen+0x1f>
+  800ae6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aea:	75 f3                	jne    800adf <strnlen+0x10>
+  800aec:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800aee:	89 d0                	mov    %edx,%eax
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	53                   	push   %ebx
+  800af6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b01:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b05:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b08:	83 c0 01             	add    $0x1,%eax
+  800b0b:	84 d2                	test   %dl,%dl
+  800b0d:	75 f2                	jne    800b01 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b0f:	89 c8                	mov    %ecx,%eax
+  800b11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b14:	c9                   	leave
+  800b15:	c3                   	ret
+
+00800b16 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	53                   	push   %ebx
+  800b1a:	83 ec 10             	sub    $0x10,%esp
+  800b1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b20:	53                   	push   %ebx
+  800b21:	e8 91 ff ff ff       	call   800ab7 <strlen>
+  800b26:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b29:	ff 75 0c             	push   0xc(%ebp)
+  800b2c:	01 d8                	add    %ebx,%eax
+  800b2e:	50                   	push   %eax
+  800b2f:	e8 be ff ff ff       	call   800af2 <strcpy>
+	return dst;
+}
+  800b34:	89 d8                	mov    %ebx,%eax
+  800b36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b39:	c9                   	leave
+  800b3a:	c3                   	ret
+
+00800b3b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	56                   	push   %esi
+  800b3f:	53                   	push   %ebx
+  800b40:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b43:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b46:	89 f3                	mov    %esi,%ebx
+  800b48:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b4b:	89 f0                	mov    %esi,%eax
+  800b4d:	eb 0f                	jmp    800b5e <strncpy+0x23>
+		*dst++ = *src;
+  800b4f:	83 c0 01             	add    $0x1,%eax
+  800b52:	0f b6 0a             	movzbl (%edx),%ecx
+  800b55:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b58:	80 f9 01             	cmp    $0x1,%cl
+  800b5b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b5e:	39 d8                	cmp    %ebx,%eax
+  800b60:	75 ed                	jne    800b4f <strncpy+0x14>
+	}
+	return ret;
+}
+  800b62:	89 f0                	mov    %esi,%eax
+  800b64:	5b                   	pop    %ebx
+  800b65:	5e                   	pop    %esi
+  800b66:	5d                   	pop    %ebp
+  800b67:	c3                   	ret
+
+00800b68 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	56                   	push   %esi
+  800b6c:	53                   	push   %ebx
+  800b6d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b73:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b76:	89 f0                	mov    %esi,%eax
+  800b78:	85 d2                	test   %edx,%edx
+  800b7a:	74 21                	je     800b9d <strlcpy+0x35>
+  800b7c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b80:	89 f2                	mov    %esi,%edx
+  800b82:	eb 09                	jmp    800b8d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b84:	83 c1 01             	add    $0x1,%ecx
+  800b87:	83 c2 01             	add    $0x1,%edx
+  800b8a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b8d:	39 c2                	cmp    %eax,%edx
+  800b8f:	74 09                	je     800b9a <strlcpy+0x32>
+  800b91:	0f b6 19             	movzbl (%ecx),%ebx
+  800b94:	84 db                	test   %bl,%bl
+  800b96:	75 ec                	jne    800b84 <strlcpy+0x1c>
+  800b98:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b9a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b9d:	29 f0                	sub    %esi,%eax
+}
+  800b9f:	5b                   	pop    %ebx
+  800ba0:	5e                   	pop    %esi
+  800ba1:	5d                   	pop    %ebp
+  800ba2:	c3                   	ret
+
+00800ba3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ba9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800bac:	eb 06                	jmp    800bb4 <strcmp+0x11>
+		p++, q++;
+  800bae:	83 c1 01             	add    $0x1,%ecx
+  800bb1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800bb4:	0f b6 01             	movzbl (%ecx),%eax
+  800bb7:	84 c0                	test   %al,%al
+  800bb9:	74 04                	je     800bbf <strcmp+0x1c>
+  800bbb:	3a 02                	cmp    (%edx),%al
+  800bbd:	74 ef                	je     800bae <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bbf:	0f b6 c0             	movzbl %al,%eax
+  800bc2:	0f b6 12             	movzbl (%edx),%edx
+  800bc5:	29 d0                	sub    %edx,%eax
+}
+  800bc7:	5d                   	pop    %ebp
+  800bc8:	c3                   	ret
+
+00800bc9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	53                   	push   %ebx
+  800bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bd6:	eb 09                	jmp    800be1 <strncmp+0x18>
+		n--, p++, q++;
+  800bd8:	83 ea 01             	sub    $0x1,%edx
+  800bdb:	83 c0 01             	add    $0x1,%eax
+  800bde:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800be1:	85 d2                	test   %edx,%edx
+  800be3:	74 18                	je     800bfd <strncmp+0x34>
+  800be5:	0f b6 18             	movzbl (%eax),%ebx
+  800be8:	84 db                	test   %bl,%bl
+  800bea:	74 04                	je     800bf0 <strncmp+0x27>
+  800bec:	3a 19                	cmp    (%ecx),%bl
+  800bee:	74 e8                	je     800bd8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bf0:	0f b6 00             	movzbl (%eax),%eax
+  800bf3:	0f b6 11             	movzbl (%ecx),%edx
+  800bf6:	29 d0                	sub    %edx,%eax
+}
+  800bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+		return 0;
+  800bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c02:	eb f4                	jmp    800bf8 <strncmp+0x2f>
+
+00800c04 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c0e:	eb 03                	jmp    800c13 <strchr+0xf>
+  800c10:	83 c0 01             	add    $0x1,%eax
+  800c13:	0f b6 10             	movzbl (%eax),%edx
+  800c16:	84 d2                	test   %dl,%dl
+  800c18:	74 06                	je     800c20 <strchr+0x1c>
+		if (*s == c)
+  800c1a:	38 ca                	cmp    %cl,%dl
+  800c1c:	75 f2                	jne    800c10 <strchr+0xc>
+  800c1e:	eb 05                	jmp    800c25 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+
+00800c27 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c31:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c34:	38 ca                	cmp    %cl,%dl
+  800c36:	74 09                	je     800c41 <strfind+0x1a>
+  800c38:	84 d2                	test   %dl,%dl
+  800c3a:	74 05                	je     800c41 <strfind+0x1a>
+	for (; *s; s++)
+  800c3c:	83 c0 01             	add    $0x1,%eax
+  800c3f:	eb f0                	jmp    800c31 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+
+00800c43 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	57                   	push   %edi
+  800c47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c4a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c4d:	85 c9                	test   %ecx,%ecx
+  800c4f:	74 20                	je     800c71 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c51:	89 f8                	mov    %edi,%eax
+  800c53:	09 c8                	or     %ecx,%eax
+  800c55:	a8 03                	test   $0x3,%al
+  800c57:	75 12                	jne    800c6b <memset+0x28>
+		c &= 0xFF;
+  800c59:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c5d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c63:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c66:	fc                   	cld
+  800c67:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c69:	eb 06                	jmp    800c71 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c6e:	fc                   	cld
+  800c6f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c71:	89 f8                	mov    %edi,%eax
+  800c73:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c76:	c9                   	leave
+  800c77:	c3                   	ret
+
+00800c78 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c80:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c83:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c86:	39 c6                	cmp    %eax,%esi
+  800c88:	73 32                	jae    800cbc <memmove+0x44>
+  800c8a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c8d:	39 d0                	cmp    %edx,%eax
+  800c8f:	73 2b                	jae    800cbc <memmove+0x44>
+		s += n;
+		d += n;
+  800c91:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c94:	89 d6                	mov    %edx,%esi
+  800c96:	09 fe                	or     %edi,%esi
+  800c98:	09 ce                	or     %ecx,%esi
+  800c9a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ca0:	75 0e                	jne    800cb0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ca2:	83 ef 04             	sub    $0x4,%edi
+  800ca5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ca8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800cab:	fd                   	std
+  800cac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cae:	eb 09                	jmp    800cb9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800cb0:	83 ef 01             	sub    $0x1,%edi
+  800cb3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800cb6:	fd                   	std
+  800cb7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cb9:	fc                   	cld
+  800cba:	eb 1a                	jmp    800cd6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cbc:	89 f2                	mov    %esi,%edx
+  800cbe:	09 c2                	or     %eax,%edx
+  800cc0:	09 ca                	or     %ecx,%edx
+  800cc2:	f6 c2 03             	test   $0x3,%dl
+  800cc5:	75 0a                	jne    800cd1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cc7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cca:	89 c7                	mov    %eax,%edi
+  800ccc:	fc                   	cld
+  800ccd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ccf:	eb 05                	jmp    800cd6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cd1:	89 c7                	mov    %eax,%edi
+  800cd3:	fc                   	cld
+  800cd4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800cd6:	5e                   	pop    %esi
+  800cd7:	5f                   	pop    %edi
+  800cd8:	5d                   	pop    %ebp
+  800cd9:	c3                   	ret
+
+00800cda <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ce0:	ff 75 10             	push   0x10(%ebp)
+  800ce3:	ff 75 0c             	push   0xc(%ebp)
+  800ce6:	ff 75 08             	push   0x8(%ebp)
+  800ce9:	e8 8a ff ff ff       	call   800c78 <memmove>
+}
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+
+00800cf0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	56                   	push   %esi
+  800cf4:	53                   	push   %ebx
+  800cf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cfb:	89 c6                	mov    %eax,%esi
+  800cfd:	03 75 10             	add    0x10(%ebp),%esi
+  800d00:	eb 06                	jmp    800d08 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d02:	83 c0 01             	add    $0x1,%eax
+  800d05:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d08:	39 f0                	cmp    %esi,%eax
+  800d0a:	74 14                	je     800d20 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d0c:	0f b6 08             	movzbl (%eax),%ecx
+  800d0f:	0f b6 1a             	movzbl (%edx),%ebx
+  800d12:	38 d9                	cmp    %bl,%cl
+  800d14:	74 ec                	je     800d02 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d16:	0f b6 c1             	movzbl %cl,%eax
+  800d19:	0f b6 db             	movzbl %bl,%ebx
+  800d1c:	29 d8                	sub    %ebx,%eax
+  800d1e:	eb 05                	jmp    800d25 <memcmp+0x35>
+	}
+
+	return 0;
+  800d20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d25:	5b                   	pop    %ebx
+  800d26:	5e                   	pop    %esi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d32:	89 c2                	mov    %eax,%edx
+  800d34:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d37:	eb 03                	jmp    800d3c <memfind+0x13>
+  800d39:	83 c0 01             	add    $0x1,%eax
+  800d3c:	39 d0                	cmp    %edx,%eax
+  800d3e:	73 04                	jae    800d44 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d40:	38 08                	cmp    %cl,(%eax)
+  800d42:	75 f5                	jne    800d39 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+
+00800d46 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+  800d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d52:	eb 03                	jmp    800d57 <strtol+0x11>
+		s++;
+  800d54:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d57:	0f b6 02             	movzbl (%edx),%eax
+  800d5a:	3c 20                	cmp    $0x20,%al
+  800d5c:	74 f6                	je     800d54 <strtol+0xe>
+  800d5e:	3c 09                	cmp    $0x9,%al
+  800d60:	74 f2                	je     800d54 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d62:	3c 2b                	cmp    $0x2b,%al
+  800d64:	74 2a                	je     800d90 <strtol+0x4a>
+	int neg = 0;
+  800d66:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d6b:	3c 2d                	cmp    $0x2d,%al
+  800d6d:	74 2b                	je     800d9a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d75:	75 0f                	jne    800d86 <strtol+0x40>
+  800d77:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d7a:	74 28                	je     800da4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d7c:	85 db                	test   %ebx,%ebx
+  800d7e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d83:	0f 44 d8             	cmove  %eax,%ebx
+  800d86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d8e:	eb 46                	jmp    800dd6 <strtol+0x90>
+		s++;
+  800d90:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d93:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d98:	eb d5                	jmp    800d6f <strtol+0x29>
+		s++, neg = 1;
+  800d9a:	83 c2 01             	add    $0x1,%edx
+  800d9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800da2:	eb cb                	jmp    800d6f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800da4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800da8:	74 0e                	je     800db8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800daa:	85 db                	test   %ebx,%ebx
+  800dac:	75 d8                	jne    800d86 <strtol+0x40>
+		s++, base = 8;
+  800dae:	83 c2 01             	add    $0x1,%edx
+  800db1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800db6:	eb ce                	jmp    800d86 <strtol+0x40>
+		s += 2, base = 16;
+  800db8:	83 c2 02             	add    $0x2,%edx
+  800dbb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800dc0:	eb c4                	jmp    800d86 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800dc2:	0f be c0             	movsbl %al,%eax
+  800dc5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800dc8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dcb:	7d 3a                	jge    800e07 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800dcd:	83 c2 01             	add    $0x1,%edx
+  800dd0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dd4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dd6:	0f b6 02             	movzbl (%edx),%eax
+  800dd9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ddc:	89 f3                	mov    %esi,%ebx
+  800dde:	80 fb 09             	cmp    $0x9,%bl
+  800de1:	76 df                	jbe    800dc2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800de3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800de6:	89 f3                	mov    %esi,%ebx
+  800de8:	80 fb 19             	cmp    $0x19,%bl
+  800deb:	77 08                	ja     800df5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ded:	0f be c0             	movsbl %al,%eax
+  800df0:	83 e8 57             	sub    $0x57,%eax
+  800df3:	eb d3                	jmp    800dc8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800df5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800df8:	89 f3                	mov    %esi,%ebx
+  800dfa:	80 fb 19             	cmp    $0x19,%bl
+  800dfd:	77 08                	ja     800e07 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dff:	0f be c0             	movsbl %al,%eax
+  800e02:	83 e8 37             	sub    $0x37,%eax
+  800e05:	eb c1                	jmp    800dc8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e07:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e0b:	74 05                	je     800e12 <strtol+0xcc>
+		*endptr = (char *) s;
+  800e0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e10:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e12:	89 c8                	mov    %ecx,%eax
+  800e14:	f7 d8                	neg    %eax
+  800e16:	85 ff                	test   %edi,%edi
+  800e18:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e1b:	89 c8                	mov    %ecx,%eax
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+
+00800e22 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800e28:	6a 00                	push   $0x0
+  800e2a:	6a 00                	push   $0x0
+  800e2c:	ff 75 08             	push   0x8(%ebp)
+  800e2f:	e8 12 ff ff ff       	call   800d46 <strtol>
+}
+  800e34:	c9                   	leave
+  800e35:	c3                   	ret
+
+00800e36 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	57                   	push   %edi
+  800e3a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	89 c3                	mov    %eax,%ebx
+  800e48:	89 c7                	mov    %eax,%edi
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	55                   	push   %ebp
+  800e4d:	56                   	push   %esi
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	8d 35 58 0e 80 00    	lea    0x800e58,%esi
+  800e56:	0f 34                	sysenter
+
+00800e58 <after_sysenter_label_47>:
+  800e58:	5e                   	pop    %esi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e70:	89 d1                	mov    %edx,%ecx
+  800e72:	89 d3                	mov    %edx,%ebx
+  800e74:	89 d7                	mov    %edx,%edi
+  800e76:	6a 00                	push   $0x0
+  800e78:	55                   	push   %ebp
+  800e79:	56                   	push   %esi
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	8d 35 84 0e 80 00    	lea    0x800e84,%esi
+  800e82:	0f 34                	sysenter
+
+00800e84 <after_sysenter_label_128>:
+  800e84:	5e                   	pop    %esi
+  800e85:	5d                   	pop    %ebp
+  800e86:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5f                   	pop    %edi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	c3                   	ret
+
+00800e8d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	57                   	push   %edi
+  800e91:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e9f:	89 cb                	mov    %ecx,%ebx
+  800ea1:	89 cf                	mov    %ecx,%edi
+  800ea3:	6a 00                	push   $0x0
+  800ea5:	55                   	push   %ebp
+  800ea6:	56                   	push   %esi
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	8d 35 b1 0e 80 00    	lea    0x800eb1,%esi
+  800eaf:	0f 34                	sysenter
+
+00800eb1 <after_sysenter_label_212>:
+  800eb1:	5e                   	pop    %esi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	7f 07                	jg     800ec1 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800eba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5f                   	pop    %edi
+  800ebf:	5d                   	pop    %ebp
+  800ec0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec1:	83 ec 0c             	sub    $0xc,%esp
+  800ec4:	50                   	push   %eax
+  800ec5:	6a 03                	push   $0x3
+  800ec7:	68 15 54 80 00       	push   $0x805415
+  800ecc:	6a 54                	push   $0x54
+  800ece:	68 32 54 80 00       	push   $0x805432
+  800ed3:	e8 5b f5 ff ff       	call   800433 <_panic>
+
+00800ed8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ed8:	55                   	push   %ebp
+  800ed9:	89 e5                	mov    %esp,%ebp
+  800edb:	57                   	push   %edi
+  800edc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee7:	89 d1                	mov    %edx,%ecx
+  800ee9:	89 d3                	mov    %edx,%ebx
+  800eeb:	89 d7                	mov    %edx,%edi
+  800eed:	6a 00                	push   $0x0
+  800eef:	55                   	push   %ebp
+  800ef0:	56                   	push   %esi
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	8d 35 fb 0e 80 00    	lea    0x800efb,%esi
+  800ef9:	0f 34                	sysenter
+
+00800efb <after_sysenter_label_309>:
+  800efb:	5e                   	pop    %esi
+  800efc:	5d                   	pop    %ebp
+  800efd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f00:	5b                   	pop    %ebx
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+
+00800f04 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f13:	89 d1                	mov    %edx,%ecx
+  800f15:	89 d3                	mov    %edx,%ebx
+  800f17:	89 d7                	mov    %edx,%edi
+  800f19:	6a 00                	push   $0x0
+  800f1b:	55                   	push   %ebp
+  800f1c:	56                   	push   %esi
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	8d 35 27 0f 80 00    	lea    0x800f27,%esi
+  800f25:	0f 34                	sysenter
+
+00800f27 <after_sysenter_label_391>:
+  800f27:	5e                   	pop    %esi
+  800f28:	5d                   	pop    %ebp
+  800f29:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f48:	6a 00                	push   $0x0
+  800f4a:	55                   	push   %ebp
+  800f4b:	56                   	push   %esi
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	8d 35 56 0f 80 00    	lea    0x800f56,%esi
+  800f54:	0f 34                	sysenter
+
+00800f56 <after_sysenter_label_479>:
+  800f56:	5e                   	pop    %esi
+  800f57:	5d                   	pop    %ebp
+  800f58:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	7f 07                	jg     800f66 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f62:	5b                   	pop    %ebx
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f66:	83 ec 0c             	sub    $0xc,%esp
+  800f69:	50                   	push   %eax
+  800f6a:	6a 04                	push   $0x4
+  800f6c:	68 15 54 80 00       	push   $0x805415
+  800f71:	6a 54                	push   $0x54
+  800f73:	68 32 54 80 00       	push   $0x805432
+  800f78:	e8 b6 f4 ff ff       	call   800433 <_panic>
+
+00800f7d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f93:	ff 75 18             	push   0x18(%ebp)
+  800f96:	55                   	push   %ebp
+  800f97:	56                   	push   %esi
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	8d 35 a2 0f 80 00    	lea    0x800fa2,%esi
+  800fa0:	0f 34                	sysenter
+
+00800fa2 <after_sysenter_label_593>:
+  800fa2:	5e                   	pop    %esi
+  800fa3:	5d                   	pop    %ebp
+  800fa4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	7f 07                	jg     800fb2 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fae:	5b                   	pop    %ebx
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	50                   	push   %eax
+  800fb6:	6a 05                	push   $0x5
+  800fb8:	68 15 54 80 00       	push   $0x805415
+  800fbd:	6a 54                	push   $0x54
+  800fbf:	68 32 54 80 00       	push   $0x805432
+  800fc4:	e8 6a f4 ff ff       	call   800433 <_panic>
+
+00800fc9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fde:	89 df                	mov    %ebx,%edi
+  800fe0:	6a 00                	push   $0x0
+  800fe2:	55                   	push   %ebp
+  800fe3:	56                   	push   %esi
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	8d 35 ee 0f 80 00    	lea    0x800fee,%esi
+  800fec:	0f 34                	sysenter
+
+00800fee <after_sysenter_label_704>:
+  800fee:	5e                   	pop    %esi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ff3:	85 c0                	test   %eax,%eax
+  800ff5:	7f 07                	jg     800ffe <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ff7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	50                   	push   %eax
+  801002:	6a 06                	push   $0x6
+  801004:	68 15 54 80 00       	push   $0x805415
+  801009:	6a 54                	push   $0x54
+  80100b:	68 32 54 80 00       	push   $0x805432
+  801010:	e8 1e f4 ff ff       	call   800433 <_panic>
+
+00801015 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	6a 00                	push   $0x0
+  80102e:	55                   	push   %ebp
+  80102f:	56                   	push   %esi
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	8d 35 3a 10 80 00    	lea    0x80103a,%esi
+  801038:	0f 34                	sysenter
+
+0080103a <after_sysenter_label_808>:
+  80103a:	5e                   	pop    %esi
+  80103b:	5d                   	pop    %ebp
+  80103c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	7f 07                	jg     80104a <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801043:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5f                   	pop    %edi
+  801048:	5d                   	pop    %ebp
+  801049:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104a:	83 ec 0c             	sub    $0xc,%esp
+  80104d:	50                   	push   %eax
+  80104e:	6a 08                	push   $0x8
+  801050:	68 15 54 80 00       	push   $0x805415
+  801055:	6a 54                	push   $0x54
+  801057:	68 32 54 80 00       	push   $0x805432
+  80105c:	e8 d2 f3 ff ff       	call   800433 <_panic>
+
+00801061 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	57                   	push   %edi
+  801065:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	b8 09 00 00 00       	mov    $0x9,%eax
+  801076:	89 df                	mov    %ebx,%edi
+  801078:	6a 00                	push   $0x0
+  80107a:	55                   	push   %ebp
+  80107b:	56                   	push   %esi
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	8d 35 86 10 80 00    	lea    0x801086,%esi
+  801084:	0f 34                	sysenter
+
+00801086 <after_sysenter_label_912>:
+  801086:	5e                   	pop    %esi
+  801087:	5d                   	pop    %ebp
+  801088:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80108b:	85 c0                	test   %eax,%eax
+  80108d:	7f 07                	jg     801096 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80108f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801092:	5b                   	pop    %ebx
+  801093:	5f                   	pop    %edi
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801096:	83 ec 0c             	sub    $0xc,%esp
+  801099:	50                   	push   %eax
+  80109a:	6a 09                	push   $0x9
+  80109c:	68 15 54 80 00       	push   $0x805415
+  8010a1:	6a 54                	push   $0x54
+  8010a3:	68 32 54 80 00       	push   $0x805432
+  8010a8:	e8 86 f3 ff ff       	call   800433 <_panic>
+
+008010ad <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c2:	89 df                	mov    %ebx,%edi
+  8010c4:	6a 00                	push   $0x0
+  8010c6:	55                   	push   %ebp
+  8010c7:	56                   	push   %esi
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8d 35 d2 10 80 00    	lea    0x8010d2,%esi
+  8010d0:	0f 34                	sysenter
+
+008010d2 <after_sysenter_label_1016>:
+  8010d2:	5e                   	pop    %esi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010d7:	85 c0                	test   %eax,%eax
+  8010d9:	7f 07                	jg     8010e2 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010de:	5b                   	pop    %ebx
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+  8010e5:	50                   	push   %eax
+  8010e6:	6a 0a                	push   $0xa
+  8010e8:	68 15 54 80 00       	push   $0x805415
+  8010ed:	6a 54                	push   $0x54
+  8010ef:	68 32 54 80 00       	push   $0x805432
+  8010f4:	e8 3a f3 ff ff       	call   800433 <_panic>
+
+008010f9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801109:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80110c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110f:	6a 00                	push   $0x0
+  801111:	55                   	push   %ebp
+  801112:	56                   	push   %esi
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	8d 35 1d 11 80 00    	lea    0x80111d,%esi
+  80111b:	0f 34                	sysenter
+
+0080111d <after_sysenter_label_1126>:
+  80111d:	5e                   	pop    %esi
+  80111e:	5d                   	pop    %ebp
+  80111f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801122:	5b                   	pop    %ebx
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80112b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801133:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801138:	89 cb                	mov    %ecx,%ebx
+  80113a:	89 cf                	mov    %ecx,%edi
+  80113c:	6a 00                	push   $0x0
+  80113e:	55                   	push   %ebp
+  80113f:	56                   	push   %esi
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	8d 35 4a 11 80 00    	lea    0x80114a,%esi
+  801148:	0f 34                	sysenter
+
+0080114a <after_sysenter_label_1210>:
+  80114a:	5e                   	pop    %esi
+  80114b:	5d                   	pop    %ebp
+  80114c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	7f 07                	jg     80115a <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801156:	5b                   	pop    %ebx
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115a:	83 ec 0c             	sub    $0xc,%esp
+  80115d:	50                   	push   %eax
+  80115e:	6a 0d                	push   $0xd
+  801160:	68 15 54 80 00       	push   $0x805415
+  801165:	6a 54                	push   $0x54
+  801167:	68 32 54 80 00       	push   $0x805432
+  80116c:	e8 c2 f2 ff ff       	call   800433 <_panic>
+
+00801171 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801181:	b8 42 00 00 00       	mov    $0x42,%eax
+  801186:	89 df                	mov    %ebx,%edi
+  801188:	6a 00                	push   $0x0
+  80118a:	55                   	push   %ebp
+  80118b:	56                   	push   %esi
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	8d 35 96 11 80 00    	lea    0x801196,%esi
+  801194:	0f 34                	sysenter
+
+00801196 <after_sysenter_label_1311>:
+  801196:	5e                   	pop    %esi
+  801197:	5d                   	pop    %ebp
+  801198:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	7f 07                	jg     8011a6 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80119f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+  8011a9:	50                   	push   %eax
+  8011aa:	6a 42                	push   $0x42
+  8011ac:	68 15 54 80 00       	push   $0x805415
+  8011b1:	6a 54                	push   $0x54
+  8011b3:	68 32 54 80 00       	push   $0x805432
+  8011b8:	e8 76 f2 ff ff       	call   800433 <_panic>
+
+008011bd <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	57                   	push   %edi
+  8011c1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011cc:	89 d1                	mov    %edx,%ecx
+  8011ce:	89 d3                	mov    %edx,%ebx
+  8011d0:	89 d7                	mov    %edx,%edi
+  8011d2:	6a 00                	push   $0x0
+  8011d4:	55                   	push   %ebp
+  8011d5:	56                   	push   %esi
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	8d 35 e0 11 80 00    	lea    0x8011e0,%esi
+  8011de:	0f 34                	sysenter
+
+008011e0 <after_sysenter_label_1411>:
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011fe:	89 df                	mov    %ebx,%edi
+  801200:	6a 00                	push   $0x0
+  801202:	55                   	push   %ebp
+  801203:	56                   	push   %esi
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	8d 35 0e 12 80 00    	lea    0x80120e,%esi
+  80120c:	0f 34                	sysenter
+
+0080120e <after_sysenter_label_1497>:
+  80120e:	5e                   	pop    %esi
+  80120f:	5d                   	pop    %ebp
+  801210:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801213:	5b                   	pop    %ebx
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+
+00801217 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801217:	55                   	push   %ebp
+  801218:	89 e5                	mov    %esp,%ebp
+  80121a:	57                   	push   %edi
+  80121b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	8b 55 08             	mov    0x8(%ebp),%edx
+  801224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801227:	b8 10 00 00 00       	mov    $0x10,%eax
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	6a 00                	push   $0x0
+  801230:	55                   	push   %ebp
+  801231:	56                   	push   %esi
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	8d 35 3c 12 80 00    	lea    0x80123c,%esi
+  80123a:	0f 34                	sysenter
+
+0080123c <after_sysenter_label_1583>:
+  80123c:	5e                   	pop    %esi
+  80123d:	5d                   	pop    %ebp
+  80123e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801241:	5b                   	pop    %ebx
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+
+00801245 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801250:	b8 11 00 00 00       	mov    $0x11,%eax
+  801255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80125a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125d:	6a 00                	push   $0x0
+  80125f:	55                   	push   %ebp
+  801260:	56                   	push   %esi
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	8d 35 6b 12 80 00    	lea    0x80126b,%esi
+  801269:	0f 34                	sysenter
+
+0080126b <after_sysenter_label_1672>:
+  80126b:	5e                   	pop    %esi
+  80126c:	5d                   	pop    %ebp
+  80126d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801270:	5b                   	pop    %ebx
+  801271:	5f                   	pop    %edi
+  801272:	5d                   	pop    %ebp
+  801273:	c3                   	ret
+
+00801274 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801279:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801281:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801284:	b8 12 00 00 00       	mov    $0x12,%eax
+  801289:	89 df                	mov    %ebx,%edi
+  80128b:	6a 00                	push   $0x0
+  80128d:	55                   	push   %ebp
+  80128e:	56                   	push   %esi
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	8d 35 99 12 80 00    	lea    0x801299,%esi
+  801297:	0f 34                	sysenter
+
+00801299 <after_sysenter_label_1758>:
+  801299:	5e                   	pop    %esi
+  80129a:	5d                   	pop    %ebp
+  80129b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80129e:	5b                   	pop    %ebx
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012af:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012b4:	89 cb                	mov    %ecx,%ebx
+  8012b6:	89 cf                	mov    %ecx,%edi
+  8012b8:	6a 00                	push   $0x0
+  8012ba:	55                   	push   %ebp
+  8012bb:	56                   	push   %esi
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	8d 35 c6 12 80 00    	lea    0x8012c6,%esi
+  8012c4:	0f 34                	sysenter
+
+008012c6 <after_sysenter_label_1842>:
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	7f 07                	jg     8012d6 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8012cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d6:	83 ec 0c             	sub    $0xc,%esp
+  8012d9:	50                   	push   %eax
+  8012da:	6a 13                	push   $0x13
+  8012dc:	68 15 54 80 00       	push   $0x805415
+  8012e1:	6a 54                	push   $0x54
+  8012e3:	68 32 54 80 00       	push   $0x805432
+  8012e8:	e8 46 f1 ff ff       	call   800433 <_panic>
+
+008012ed <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	57                   	push   %edi
+  8012f1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012fc:	89 d1                	mov    %edx,%ecx
+  8012fe:	89 d3                	mov    %edx,%ebx
+  801300:	89 d7                	mov    %edx,%edi
+  801302:	6a 00                	push   $0x0
+  801304:	55                   	push   %ebp
+  801305:	56                   	push   %esi
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	8d 35 10 13 80 00    	lea    0x801310,%esi
+  80130e:	0f 34                	sysenter
+
+00801310 <after_sysenter_label_1939>:
+  801310:	5e                   	pop    %esi
+  801311:	5d                   	pop    %ebp
+  801312:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801315:	5b                   	pop    %ebx
+  801316:	5f                   	pop    %edi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+
+00801319 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+  80131c:	57                   	push   %edi
+  80131d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80131e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801321:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801324:	b8 15 00 00 00       	mov    $0x15,%eax
+  801329:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801331:	6a 00                	push   $0x0
+  801333:	55                   	push   %ebp
+  801334:	56                   	push   %esi
+  801335:	89 e5                	mov    %esp,%ebp
+  801337:	8d 35 3f 13 80 00    	lea    0x80133f,%esi
+  80133d:	0f 34                	sysenter
+
+0080133f <after_sysenter_label_2028>:
+  80133f:	5e                   	pop    %esi
+  801340:	5d                   	pop    %ebp
+  801341:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801344:	5b                   	pop    %ebx
+  801345:	5f                   	pop    %edi
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+
+00801348 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80134d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801352:	8b 55 08             	mov    0x8(%ebp),%edx
+  801355:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801358:	b8 16 00 00 00       	mov    $0x16,%eax
+  80135d:	89 df                	mov    %ebx,%edi
+  80135f:	6a 00                	push   $0x0
+  801361:	55                   	push   %ebp
+  801362:	56                   	push   %esi
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	8d 35 6d 13 80 00    	lea    0x80136d,%esi
+  80136b:	0f 34                	sysenter
+
+0080136d <after_sysenter_label_2114>:
+  80136d:	5e                   	pop    %esi
+  80136e:	5d                   	pop    %ebp
+  80136f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801372:	5b                   	pop    %ebx
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+
+00801376 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	57                   	push   %edi
+  80137a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80137b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801380:	8b 55 08             	mov    0x8(%ebp),%edx
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	b8 17 00 00 00       	mov    $0x17,%eax
+  80138b:	89 df                	mov    %ebx,%edi
+  80138d:	6a 00                	push   $0x0
+  80138f:	55                   	push   %ebp
+  801390:	56                   	push   %esi
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	8d 35 9b 13 80 00    	lea    0x80139b,%esi
+  801399:	0f 34                	sysenter
+
+0080139b <after_sysenter_label_2200>:
+  80139b:	5e                   	pop    %esi
+  80139c:	5d                   	pop    %ebp
+  80139d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8013a0:	5b                   	pop    %ebx
+  8013a1:	5f                   	pop    %edi
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+
+008013a4 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	57                   	push   %edi
+  8013a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013b9:	89 df                	mov    %ebx,%edi
+  8013bb:	6a 00                	push   $0x0
+  8013bd:	55                   	push   %ebp
+  8013be:	56                   	push   %esi
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	8d 35 c9 13 80 00    	lea    0x8013c9,%esi
+  8013c7:	0f 34                	sysenter
+
+008013c9 <after_sysenter_label_2286>:
+  8013c9:	5e                   	pop    %esi
+  8013ca:	5d                   	pop    %ebp
+  8013cb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5f                   	pop    %edi
+  8013d0:	5d                   	pop    %ebp
+  8013d1:	c3                   	ret
+
+008013d2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013dd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013e0:	5d                   	pop    %ebp
+  8013e1:	c3                   	ret
+
+008013e2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013ed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013f2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013fc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801401:	eb 02                	jmp    801405 <fd_alloc+0xc>
+  801403:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801405:	89 c2                	mov    %eax,%edx
+  801407:	c1 ea 16             	shr    $0x16,%edx
+  80140a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801411:	f6 c2 01             	test   $0x1,%dl
+  801414:	74 2b                	je     801441 <fd_alloc+0x48>
+  801416:	89 c2                	mov    %eax,%edx
+  801418:	c1 ea 0c             	shr    $0xc,%edx
+  80141b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801422:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801428:	f6 c1 01             	test   $0x1,%cl
+  80142b:	74 14                	je     801441 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80142d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801433:	75 ce                	jne    801403 <fd_alloc+0xa>
+  801435:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80143a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80143f:	eb 05                	jmp    801446 <fd_alloc+0x4d>
+			return 0;
+  801441:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801446:	8b 55 08             	mov    0x8(%ebp),%edx
+  801449:	89 02                	mov    %eax,(%edx)
+}
+  80144b:	89 c8                	mov    %ecx,%eax
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+
+0080144f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801455:	83 f8 1f             	cmp    $0x1f,%eax
+  801458:	77 30                	ja     80148a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80145a:	c1 e0 0c             	shl    $0xc,%eax
+  80145d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801462:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801468:	f6 c2 01             	test   $0x1,%dl
+  80146b:	74 24                	je     801491 <fd_lookup+0x42>
+  80146d:	89 c2                	mov    %eax,%edx
+  80146f:	c1 ea 0c             	shr    $0xc,%edx
+  801472:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801479:	f6 c2 01             	test   $0x1,%dl
+  80147c:	74 1a                	je     801498 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80147e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801481:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+		return -E_INVAL;
+  80148a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148f:	eb f7                	jmp    801488 <fd_lookup+0x39>
+		return -E_INVAL;
+  801491:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801496:	eb f0                	jmp    801488 <fd_lookup+0x39>
+  801498:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149d:	eb e9                	jmp    801488 <fd_lookup+0x39>
+
+0080149f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	53                   	push   %ebx
+  8014a3:	83 ec 04             	sub    $0x4,%esp
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ae:	eb 03                	jmp    8014b3 <dev_lookup+0x14>
+  8014b0:	83 c0 01             	add    $0x1,%eax
+  8014b3:	8b 1c 85 bc 54 80 00 	mov    0x8054bc(,%eax,4),%ebx
+  8014ba:	85 db                	test   %ebx,%ebx
+  8014bc:	74 0b                	je     8014c9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014be:	39 13                	cmp    %edx,(%ebx)
+  8014c0:	75 ee                	jne    8014b0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c7:	eb 49                	jmp    801512 <dev_lookup+0x73>
+  8014c9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014cb:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8014d1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014d6:	77 18                	ja     8014f0 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014d8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014dd:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8014df:	c1 e8 10             	shr    $0x10,%eax
+  8014e2:	74 0c                	je     8014f0 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014e4:	c1 e0 10             	shl    $0x10,%eax
+  8014e7:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8014ec:	29 c1                	sub    %eax,%ecx
+  8014ee:	eb 06                	jmp    8014f6 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8014f0:	8b 0d 30 9a 80 00    	mov    0x809a30,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014f6:	8b 01                	mov    (%ecx),%eax
+  8014f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8014fb:	83 ec 04             	sub    $0x4,%esp
+  8014fe:	52                   	push   %edx
+  8014ff:	50                   	push   %eax
+  801500:	68 40 54 80 00       	push   $0x805440
+  801505:	e8 04 f0 ff ff       	call   80050e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80150a:	83 c4 10             	add    $0x10,%esp
+  80150d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801512:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801515:	89 1a                	mov    %ebx,(%edx)
+}
+  801517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151a:	c9                   	leave
+  80151b:	c3                   	ret
+
+0080151c <fd_close>:
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	83 ec 24             	sub    $0x24,%esp
+  801525:	8b 75 08             	mov    0x8(%ebp),%esi
+  801528:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80152b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80152f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801535:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801538:	50                   	push   %eax
+  801539:	e8 11 ff ff ff       	call   80144f <fd_lookup>
+  80153e:	89 c3                	mov    %eax,%ebx
+  801540:	83 c4 10             	add    $0x10,%esp
+  801543:	85 c0                	test   %eax,%eax
+  801545:	78 05                	js     80154c <fd_close+0x30>
+	    || fd != fd2)
+  801547:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80154a:	74 16                	je     801562 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80154c:	89 f8                	mov    %edi,%eax
+  80154e:	84 c0                	test   %al,%al
+  801550:	b8 00 00 00 00       	mov    $0x0,%eax
+  801555:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801558:	89 d8                	mov    %ebx,%eax
+  80155a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155d:	5b                   	pop    %ebx
+  80155e:	5e                   	pop    %esi
+  80155f:	5f                   	pop    %edi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801562:	83 ec 08             	sub    $0x8,%esp
+  801565:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801568:	50                   	push   %eax
+  801569:	ff 36                	push   (%esi)
+  80156b:	e8 2f ff ff ff       	call   80149f <dev_lookup>
+  801570:	89 c3                	mov    %eax,%ebx
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 1a                	js     801593 <fd_close+0x77>
+		if (dev->dev_close)
+  801579:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80157c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80157f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801584:	85 c0                	test   %eax,%eax
+  801586:	74 0b                	je     801593 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	56                   	push   %esi
+  80158c:	ff d0                	call   *%eax
+  80158e:	89 c3                	mov    %eax,%ebx
+  801590:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801593:	83 ec 08             	sub    $0x8,%esp
+  801596:	56                   	push   %esi
+  801597:	6a 00                	push   $0x0
+  801599:	e8 2b fa ff ff       	call   800fc9 <sys_page_unmap>
+	return r;
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	eb b5                	jmp    801558 <fd_close+0x3c>
+
+008015a3 <close>:
+
+int
+close(int fdnum)
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ac:	50                   	push   %eax
+  8015ad:	ff 75 08             	push   0x8(%ebp)
+  8015b0:	e8 9a fe ff ff       	call   80144f <fd_lookup>
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	79 02                	jns    8015be <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+		return fd_close(fd, 1);
+  8015be:	83 ec 08             	sub    $0x8,%esp
+  8015c1:	6a 01                	push   $0x1
+  8015c3:	ff 75 f4             	push   -0xc(%ebp)
+  8015c6:	e8 51 ff ff ff       	call   80151c <fd_close>
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	eb ec                	jmp    8015bc <close+0x19>
+
+008015d0 <close_all>:
+
+void
+close_all(void)
+{
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	53                   	push   %ebx
+  8015d4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015dc:	83 ec 0c             	sub    $0xc,%esp
+  8015df:	53                   	push   %ebx
+  8015e0:	e8 be ff ff ff       	call   8015a3 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015e5:	83 c3 01             	add    $0x1,%ebx
+  8015e8:	83 c4 10             	add    $0x10,%esp
+  8015eb:	83 fb 20             	cmp    $0x20,%ebx
+  8015ee:	75 ec                	jne    8015dc <close_all+0xc>
+}
+  8015f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+
+008015f5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	57                   	push   %edi
+  8015f9:	56                   	push   %esi
+  8015fa:	53                   	push   %ebx
+  8015fb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801601:	50                   	push   %eax
+  801602:	ff 75 08             	push   0x8(%ebp)
+  801605:	e8 45 fe ff ff       	call   80144f <fd_lookup>
+  80160a:	89 c3                	mov    %eax,%ebx
+  80160c:	83 c4 10             	add    $0x10,%esp
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	78 7f                	js     801692 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801613:	83 ec 0c             	sub    $0xc,%esp
+  801616:	ff 75 0c             	push   0xc(%ebp)
+  801619:	e8 85 ff ff ff       	call   8015a3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80161e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801621:	c1 e6 0c             	shl    $0xc,%esi
+  801624:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80162a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80162d:	89 3c 24             	mov    %edi,(%esp)
+  801630:	e8 ad fd ff ff       	call   8013e2 <fd2data>
+  801635:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801637:	89 34 24             	mov    %esi,(%esp)
+  80163a:	e8 a3 fd ff ff       	call   8013e2 <fd2data>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801645:	89 d8                	mov    %ebx,%eax
+  801647:	c1 e8 16             	shr    $0x16,%eax
+  80164a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801651:	a8 01                	test   $0x1,%al
+  801653:	74 11                	je     801666 <dup+0x71>
+  801655:	89 d8                	mov    %ebx,%eax
+  801657:	c1 e8 0c             	shr    $0xc,%eax
+  80165a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801661:	f6 c2 01             	test   $0x1,%dl
+  801664:	75 36                	jne    80169c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801666:	89 f8                	mov    %edi,%eax
+  801668:	c1 e8 0c             	shr    $0xc,%eax
+  80166b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801672:	83 ec 0c             	sub    $0xc,%esp
+  801675:	25 07 0e 00 00       	and    $0xe07,%eax
+  80167a:	50                   	push   %eax
+  80167b:	56                   	push   %esi
+  80167c:	6a 00                	push   $0x0
+  80167e:	57                   	push   %edi
+  80167f:	6a 00                	push   $0x0
+  801681:	e8 f7 f8 ff ff       	call   800f7d <sys_page_map>
+  801686:	89 c3                	mov    %eax,%ebx
+  801688:	83 c4 20             	add    $0x20,%esp
+  80168b:	85 c0                	test   %eax,%eax
+  80168d:	78 33                	js     8016c2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80168f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801692:	89 d8                	mov    %ebx,%eax
+  801694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5f                   	pop    %edi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80169c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016ab:	50                   	push   %eax
+  8016ac:	ff 75 d4             	push   -0x2c(%ebp)
+  8016af:	6a 00                	push   $0x0
+  8016b1:	53                   	push   %ebx
+  8016b2:	6a 00                	push   $0x0
+  8016b4:	e8 c4 f8 ff ff       	call   800f7d <sys_page_map>
+  8016b9:	89 c3                	mov    %eax,%ebx
+  8016bb:	83 c4 20             	add    $0x20,%esp
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	79 a4                	jns    801666 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016c2:	83 ec 08             	sub    $0x8,%esp
+  8016c5:	56                   	push   %esi
+  8016c6:	6a 00                	push   $0x0
+  8016c8:	e8 fc f8 ff ff       	call   800fc9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016cd:	83 c4 08             	add    $0x8,%esp
+  8016d0:	ff 75 d4             	push   -0x2c(%ebp)
+  8016d3:	6a 00                	push   $0x0
+  8016d5:	e8 ef f8 ff ff       	call   800fc9 <sys_page_unmap>
+	return r;
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	eb b3                	jmp    801692 <dup+0x9d>
+
+008016df <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016df:	55                   	push   %ebp
+  8016e0:	89 e5                	mov    %esp,%ebp
+  8016e2:	56                   	push   %esi
+  8016e3:	53                   	push   %ebx
+  8016e4:	83 ec 18             	sub    $0x18,%esp
+  8016e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ed:	50                   	push   %eax
+  8016ee:	53                   	push   %ebx
+  8016ef:	e8 5b fd ff ff       	call   80144f <fd_lookup>
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	85 c0                	test   %eax,%eax
+  8016f9:	78 3c                	js     801737 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016fe:	83 ec 08             	sub    $0x8,%esp
+  801701:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	ff 36                	push   (%esi)
+  801707:	e8 93 fd ff ff       	call   80149f <dev_lookup>
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	78 24                	js     801737 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801713:	8b 46 08             	mov    0x8(%esi),%eax
+  801716:	83 e0 03             	and    $0x3,%eax
+  801719:	83 f8 01             	cmp    $0x1,%eax
+  80171c:	74 20                	je     80173e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80171e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801721:	8b 40 08             	mov    0x8(%eax),%eax
+  801724:	85 c0                	test   %eax,%eax
+  801726:	74 61                	je     801789 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801728:	83 ec 04             	sub    $0x4,%esp
+  80172b:	ff 75 10             	push   0x10(%ebp)
+  80172e:	ff 75 0c             	push   0xc(%ebp)
+  801731:	56                   	push   %esi
+  801732:	ff d0                	call   *%eax
+  801734:	83 c4 10             	add    $0x10,%esp
+}
+  801737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+  80173e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801740:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801746:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80174b:	77 18                	ja     801765 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80174d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801752:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801754:	c1 e8 10             	shr    $0x10,%eax
+  801757:	74 0c                	je     801765 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801759:	c1 e0 10             	shl    $0x10,%eax
+  80175c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801761:	29 c2                	sub    %eax,%edx
+  801763:	eb 06                	jmp    80176b <read+0x8c>
+		return pthread_main_tls;
+  801765:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80176b:	8b 02                	mov    (%edx),%eax
+  80176d:	8b 40 48             	mov    0x48(%eax),%eax
+  801770:	83 ec 04             	sub    $0x4,%esp
+  801773:	53                   	push   %ebx
+  801774:	50                   	push   %eax
+  801775:	68 81 54 80 00       	push   $0x805481
+  80177a:	e8 8f ed ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801787:	eb ae                	jmp    801737 <read+0x58>
+		return -E_NOT_SUPP;
+  801789:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80178e:	eb a7                	jmp    801737 <read+0x58>
+
+00801790 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	57                   	push   %edi
+  801794:	56                   	push   %esi
+  801795:	53                   	push   %ebx
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80179c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80179f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a4:	eb 02                	jmp    8017a8 <readn+0x18>
+  8017a6:	01 c3                	add    %eax,%ebx
+  8017a8:	39 f3                	cmp    %esi,%ebx
+  8017aa:	73 21                	jae    8017cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017ac:	83 ec 04             	sub    $0x4,%esp
+  8017af:	89 f0                	mov    %esi,%eax
+  8017b1:	29 d8                	sub    %ebx,%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	89 d8                	mov    %ebx,%eax
+  8017b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8017b9:	50                   	push   %eax
+  8017ba:	57                   	push   %edi
+  8017bb:	e8 1f ff ff ff       	call   8016df <read>
+		if (m < 0)
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 04                	js     8017cb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017c7:	75 dd                	jne    8017a6 <readn+0x16>
+  8017c9:	eb 02                	jmp    8017cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017cb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017cd:	89 d8                	mov    %ebx,%eax
+  8017cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d2:	5b                   	pop    %ebx
+  8017d3:	5e                   	pop    %esi
+  8017d4:	5f                   	pop    %edi
+  8017d5:	5d                   	pop    %ebp
+  8017d6:	c3                   	ret
+
+008017d7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	56                   	push   %esi
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 18             	sub    $0x18,%esp
+  8017df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	53                   	push   %ebx
+  8017e7:	e8 63 fc ff ff       	call   80144f <fd_lookup>
+  8017ec:	83 c4 10             	add    $0x10,%esp
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 37                	js     80182a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f6:	83 ec 08             	sub    $0x8,%esp
+  8017f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fc:	50                   	push   %eax
+  8017fd:	ff 36                	push   (%esi)
+  8017ff:	e8 9b fc ff ff       	call   80149f <dev_lookup>
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 1f                	js     80182a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80180b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180f:	74 20                	je     801831 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	8b 40 0c             	mov    0xc(%eax),%eax
+  801817:	85 c0                	test   %eax,%eax
+  801819:	74 61                	je     80187c <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80181b:	83 ec 04             	sub    $0x4,%esp
+  80181e:	ff 75 10             	push   0x10(%ebp)
+  801821:	ff 75 0c             	push   0xc(%ebp)
+  801824:	56                   	push   %esi
+  801825:	ff d0                	call   *%eax
+  801827:	83 c4 10             	add    $0x10,%esp
+}
+  80182a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182d:	5b                   	pop    %ebx
+  80182e:	5e                   	pop    %esi
+  80182f:	5d                   	pop    %ebp
+  801830:	c3                   	ret
+  801831:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801833:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801839:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80183e:	77 18                	ja     801858 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801840:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801845:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801847:	c1 e8 10             	shr    $0x10,%eax
+  80184a:	74 0c                	je     801858 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80184c:	c1 e0 10             	shl    $0x10,%eax
+  80184f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801854:	29 c2                	sub    %eax,%edx
+  801856:	eb 06                	jmp    80185e <write+0x87>
+		return pthread_main_tls;
+  801858:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80185e:	8b 02                	mov    (%edx),%eax
+  801860:	8b 40 48             	mov    0x48(%eax),%eax
+  801863:	83 ec 04             	sub    $0x4,%esp
+  801866:	53                   	push   %ebx
+  801867:	50                   	push   %eax
+  801868:	68 9d 54 80 00       	push   $0x80549d
+  80186d:	e8 9c ec ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  801872:	83 c4 10             	add    $0x10,%esp
+  801875:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80187a:	eb ae                	jmp    80182a <write+0x53>
+		return -E_NOT_SUPP;
+  80187c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801881:	eb a7                	jmp    80182a <write+0x53>
+
+00801883 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801883:	55                   	push   %ebp
+  801884:	89 e5                	mov    %esp,%ebp
+  801886:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801889:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80188c:	50                   	push   %eax
+  80188d:	ff 75 08             	push   0x8(%ebp)
+  801890:	e8 ba fb ff ff       	call   80144f <fd_lookup>
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 0e                	js     8018aa <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80189c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80189f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018aa:	c9                   	leave
+  8018ab:	c3                   	ret
+
+008018ac <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018ac:	55                   	push   %ebp
+  8018ad:	89 e5                	mov    %esp,%ebp
+  8018af:	56                   	push   %esi
+  8018b0:	53                   	push   %ebx
+  8018b1:	83 ec 18             	sub    $0x18,%esp
+  8018b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ba:	50                   	push   %eax
+  8018bb:	53                   	push   %ebx
+  8018bc:	e8 8e fb ff ff       	call   80144f <fd_lookup>
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	78 34                	js     8018fc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018cb:	83 ec 08             	sub    $0x8,%esp
+  8018ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d1:	50                   	push   %eax
+  8018d2:	ff 36                	push   (%esi)
+  8018d4:	e8 c6 fb ff ff       	call   80149f <dev_lookup>
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 1c                	js     8018fc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018e0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018e4:	74 1d                	je     801903 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e9:	8b 40 18             	mov    0x18(%eax),%eax
+  8018ec:	85 c0                	test   %eax,%eax
+  8018ee:	74 5e                	je     80194e <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018f0:	83 ec 08             	sub    $0x8,%esp
+  8018f3:	ff 75 0c             	push   0xc(%ebp)
+  8018f6:	56                   	push   %esi
+  8018f7:	ff d0                	call   *%eax
+  8018f9:	83 c4 10             	add    $0x10,%esp
+}
+  8018fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+  801903:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801905:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80190b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801910:	77 18                	ja     80192a <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801912:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801917:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801919:	c1 e8 10             	shr    $0x10,%eax
+  80191c:	74 0c                	je     80192a <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80191e:	c1 e0 10             	shl    $0x10,%eax
+  801921:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801926:	29 c2                	sub    %eax,%edx
+  801928:	eb 06                	jmp    801930 <ftruncate+0x84>
+		return pthread_main_tls;
+  80192a:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+			thisenv->env_id, fdnum);
+  801930:	8b 02                	mov    (%edx),%eax
+  801932:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801935:	83 ec 04             	sub    $0x4,%esp
+  801938:	53                   	push   %ebx
+  801939:	50                   	push   %eax
+  80193a:	68 60 54 80 00       	push   $0x805460
+  80193f:	e8 ca eb ff ff       	call   80050e <cprintf>
+		return -E_INVAL;
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194c:	eb ae                	jmp    8018fc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80194e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801953:	eb a7                	jmp    8018fc <ftruncate+0x50>
+
+00801955 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	56                   	push   %esi
+  801959:	53                   	push   %ebx
+  80195a:	83 ec 18             	sub    $0x18,%esp
+  80195d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801960:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	ff 75 08             	push   0x8(%ebp)
+  801967:	e8 e3 fa ff ff       	call   80144f <fd_lookup>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 49                	js     8019bc <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801973:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801976:	83 ec 08             	sub    $0x8,%esp
+  801979:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197c:	50                   	push   %eax
+  80197d:	ff 36                	push   (%esi)
+  80197f:	e8 1b fb ff ff       	call   80149f <dev_lookup>
+  801984:	83 c4 10             	add    $0x10,%esp
+  801987:	85 c0                	test   %eax,%eax
+  801989:	78 31                	js     8019bc <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80198b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801992:	74 2f                	je     8019c3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801994:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801997:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80199e:	00 00 00 
+	stat->st_isdir = 0;
+  8019a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019a8:	00 00 00 
+	stat->st_dev = dev;
+  8019ab:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019b1:	83 ec 08             	sub    $0x8,%esp
+  8019b4:	53                   	push   %ebx
+  8019b5:	56                   	push   %esi
+  8019b6:	ff 50 14             	call   *0x14(%eax)
+  8019b9:	83 c4 10             	add    $0x10,%esp
+}
+  8019bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019bf:	5b                   	pop    %ebx
+  8019c0:	5e                   	pop    %esi
+  8019c1:	5d                   	pop    %ebp
+  8019c2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c8:	eb f2                	jmp    8019bc <fstat+0x67>
+
+008019ca <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019ca:	55                   	push   %ebp
+  8019cb:	89 e5                	mov    %esp,%ebp
+  8019cd:	56                   	push   %esi
+  8019ce:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019cf:	83 ec 08             	sub    $0x8,%esp
+  8019d2:	6a 00                	push   $0x0
+  8019d4:	ff 75 08             	push   0x8(%ebp)
+  8019d7:	e8 4b 03 00 00       	call   801d27 <open>
+  8019dc:	89 c3                	mov    %eax,%ebx
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	78 1b                	js     801a00 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019e5:	83 ec 08             	sub    $0x8,%esp
+  8019e8:	ff 75 0c             	push   0xc(%ebp)
+  8019eb:	50                   	push   %eax
+  8019ec:	e8 64 ff ff ff       	call   801955 <fstat>
+  8019f1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019f3:	89 1c 24             	mov    %ebx,(%esp)
+  8019f6:	e8 a8 fb ff ff       	call   8015a3 <close>
+	return r;
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	89 f3                	mov    %esi,%ebx
+}
+  801a00:	89 d8                	mov    %ebx,%eax
+  801a02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a05:	5b                   	pop    %ebx
+  801a06:	5e                   	pop    %esi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+
+00801a09 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	56                   	push   %esi
+  801a0d:	53                   	push   %ebx
+  801a0e:	89 c6                	mov    %eax,%esi
+  801a10:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a12:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801a19:	74 27                	je     801a42 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a1b:	6a 07                	push   $0x7
+  801a1d:	68 00 a0 80 00       	push   $0x80a000
+  801a22:	56                   	push   %esi
+  801a23:	ff 35 00 80 80 00    	push   0x808000
+  801a29:	e8 48 31 00 00       	call   804b76 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a2e:	83 c4 0c             	add    $0xc,%esp
+  801a31:	6a 00                	push   $0x0
+  801a33:	53                   	push   %ebx
+  801a34:	6a 00                	push   $0x0
+  801a36:	e8 45 30 00 00       	call   804a80 <ipc_recv>
+}
+  801a3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3e:	5b                   	pop    %ebx
+  801a3f:	5e                   	pop    %esi
+  801a40:	5d                   	pop    %ebp
+  801a41:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a42:	83 ec 0c             	sub    $0xc,%esp
+  801a45:	6a 01                	push   $0x1
+  801a47:	e8 80 31 00 00       	call   804bcc <ipc_find_env>
+  801a4c:	a3 00 80 80 00       	mov    %eax,0x808000
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	eb c5                	jmp    801a1b <fsipc+0x12>
+
+00801a56 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	53                   	push   %ebx
+  801a5a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801a5d:	68 04 80 80 00       	push   $0x808004
+  801a62:	e8 97 21 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a6d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  801a72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a75:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a84:	e8 80 ff ff ff       	call   801a09 <fsipc>
+  801a89:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a8b:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  801a92:	e8 d4 21 00 00       	call   803c6b <mutex_unlock>
+	return r;
+}
+  801a97:	89 d8                	mov    %ebx,%eax
+  801a99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9c:	c9                   	leave
+  801a9d:	c3                   	ret
+
+00801a9e <devfile_flush>:
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	53                   	push   %ebx
+  801aa2:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801aa5:	68 04 80 80 00       	push   $0x808004
+  801aaa:	e8 4f 21 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ab5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ac4:	e8 40 ff ff ff       	call   801a09 <fsipc>
+  801ac9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801acb:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  801ad2:	e8 94 21 00 00       	call   803c6b <mutex_unlock>
+}
+  801ad7:	89 d8                	mov    %ebx,%eax
+  801ad9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801adc:	c9                   	leave
+  801add:	c3                   	ret
+
+00801ade <devfile_stat>:
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	56                   	push   %esi
+  801ae2:	53                   	push   %ebx
+  801ae3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801ae6:	83 ec 0c             	sub    $0xc,%esp
+  801ae9:	68 04 80 80 00       	push   $0x808004
+  801aee:	e8 0b 21 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b03:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b08:	e8 fc fe ff ff       	call   801a09 <fsipc>
+  801b0d:	89 c3                	mov    %eax,%ebx
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	79 16                	jns    801b2c <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801b16:	83 ec 0c             	sub    $0xc,%esp
+  801b19:	68 04 80 80 00       	push   $0x808004
+  801b1e:	e8 48 21 00 00       	call   803c6b <mutex_unlock>
+}
+  801b23:	89 d8                	mov    %ebx,%eax
+  801b25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b28:	5b                   	pop    %ebx
+  801b29:	5e                   	pop    %esi
+  801b2a:	5d                   	pop    %ebp
+  801b2b:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	68 00 a0 80 00       	push   $0x80a000
+  801b34:	56                   	push   %esi
+  801b35:	e8 b8 ef ff ff       	call   800af2 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801b3a:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  801b3f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b45:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  801b4a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801b50:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801b53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b58:	eb bc                	jmp    801b16 <devfile_stat+0x38>
+
+00801b5a <devfile_write>:
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 10             	sub    $0x10,%esp
+  801b61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801b64:	68 04 80 80 00       	push   $0x808004
+  801b69:	e8 90 20 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b71:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b74:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801b82:	76 3d                	jbe    801bc1 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801b84:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801b89:	39 c3                	cmp    %eax,%ebx
+  801b8b:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801b8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b91:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	fsipcbuf.write.req_n = n;
+  801b96:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801b9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ba6:	e8 5e fe ff ff       	call   801a09 <fsipc>
+  801bab:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+  801bb0:	68 04 80 80 00       	push   $0x808004
+  801bb5:	e8 b1 20 00 00       	call   803c6b <mutex_unlock>
+}
+  801bba:	89 d8                	mov    %ebx,%eax
+  801bbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bbf:	c9                   	leave
+  801bc0:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801bc1:	83 ec 04             	sub    $0x4,%esp
+  801bc4:	53                   	push   %ebx
+  801bc5:	ff 75 0c             	push   0xc(%ebp)
+  801bc8:	68 0c a0 80 00       	push   $0x80a00c
+  801bcd:	e8 a6 f0 ff ff       	call   800c78 <memmove>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	eb b5                	jmp    801b91 <devfile_write+0x37>
+
+00801bdc <devfile_read>:
+{
+  801bdc:	55                   	push   %ebp
+  801bdd:	89 e5                	mov    %esp,%ebp
+  801bdf:	57                   	push   %edi
+  801be0:	56                   	push   %esi
+  801be1:	53                   	push   %ebx
+  801be2:	83 ec 0c             	sub    $0xc,%esp
+  801be5:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801beb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801bee:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801bf4:	0f 86 8c 00 00 00    	jbe    801c86 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801bfa:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801bff:	39 c3                	cmp    %eax,%ebx
+  801c01:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801c04:	89 f8                	mov    %edi,%eax
+  801c06:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c09:	eb 0f                	jmp    801c1a <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801c0b:	0f b6 08             	movzbl (%eax),%ecx
+  801c0e:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801c10:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c15:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801c1a:	39 d0                	cmp    %edx,%eax
+  801c1c:	72 ed                	jb     801c0b <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+  801c21:	68 04 80 80 00       	push   $0x808004
+  801c26:	e8 d3 1f 00 00       	call   803bfe <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c2b:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c2e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+		fsipcbuf.read.req_n = n;
+  801c33:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801c39:	89 3d 08 a0 80 00    	mov    %edi,0x80a008
+		r = fsipc(FSREQ_READ, NULL);
+  801c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c44:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c49:	e8 bb fd ff ff       	call   801a09 <fsipc>
+  801c4e:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801c50:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  801c57:	e8 0f 20 00 00       	call   803c6b <mutex_unlock>
+		assert(r <= (int) n);
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	39 f3                	cmp    %esi,%ebx
+  801c61:	7c 0a                	jl     801c6d <devfile_read+0x91>
+}
+  801c63:	89 f0                	mov    %esi,%eax
+  801c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c68:	5b                   	pop    %ebx
+  801c69:	5e                   	pop    %esi
+  801c6a:	5f                   	pop    %edi
+  801c6b:	5d                   	pop    %ebp
+  801c6c:	c3                   	ret
+		assert(r <= (int) n);
+  801c6d:	68 d0 54 80 00       	push   $0x8054d0
+  801c72:	68 dd 54 80 00       	push   $0x8054dd
+  801c77:	68 90 00 00 00       	push   $0x90
+  801c7c:	68 f2 54 80 00       	push   $0x8054f2
+  801c81:	e8 ad e7 ff ff       	call   800433 <_panic>
+	mutex_lock(&fsipc_mu);
+  801c86:	83 ec 0c             	sub    $0xc,%esp
+  801c89:	68 04 80 80 00       	push   $0x808004
+  801c8e:	e8 6b 1f 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c93:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c96:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  801c9b:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	fsipcbuf.read.req_va = 0;
+  801ca1:	c7 05 08 a0 80 00 00 	movl   $0x0,0x80a008
+  801ca8:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb0:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cb5:	e8 4f fd ff ff       	call   801a09 <fsipc>
+  801cba:	89 c6                	mov    %eax,%esi
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 1d                	js     801ce0 <devfile_read+0x104>
+		assert(r <= n);
+  801cc3:	39 c3                	cmp    %eax,%ebx
+  801cc5:	72 2e                	jb     801cf5 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801cc7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ccc:	7f 40                	jg     801d0e <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cce:	83 ec 04             	sub    $0x4,%esp
+  801cd1:	50                   	push   %eax
+  801cd2:	68 00 a0 80 00       	push   $0x80a000
+  801cd7:	57                   	push   %edi
+  801cd8:	e8 9b ef ff ff       	call   800c78 <memmove>
+  801cdd:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801ce0:	83 ec 0c             	sub    $0xc,%esp
+  801ce3:	68 04 80 80 00       	push   $0x808004
+  801ce8:	e8 7e 1f 00 00       	call   803c6b <mutex_unlock>
+	return r;
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	e9 6e ff ff ff       	jmp    801c63 <devfile_read+0x87>
+		assert(r <= n);
+  801cf5:	68 fd 54 80 00       	push   $0x8054fd
+  801cfa:	68 dd 54 80 00       	push   $0x8054dd
+  801cff:	68 99 00 00 00       	push   $0x99
+  801d04:	68 f2 54 80 00       	push   $0x8054f2
+  801d09:	e8 25 e7 ff ff       	call   800433 <_panic>
+		assert(r <= PGSIZE);
+  801d0e:	68 04 55 80 00       	push   $0x805504
+  801d13:	68 dd 54 80 00       	push   $0x8054dd
+  801d18:	68 9a 00 00 00       	push   $0x9a
+  801d1d:	68 f2 54 80 00       	push   $0x8054f2
+  801d22:	e8 0c e7 ff ff       	call   800433 <_panic>
+
+00801d27 <open>:
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	56                   	push   %esi
+  801d2b:	53                   	push   %ebx
+  801d2c:	83 ec 1c             	sub    $0x1c,%esp
+  801d2f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d32:	56                   	push   %esi
+  801d33:	e8 7f ed ff ff       	call   800ab7 <strlen>
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d40:	0f 8f 85 00 00 00    	jg     801dcb <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d46:	83 ec 0c             	sub    $0xc,%esp
+  801d49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	e8 a7 f6 ff ff       	call   8013f9 <fd_alloc>
+  801d52:	89 c3                	mov    %eax,%ebx
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 55                	js     801db0 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801d5b:	83 ec 0c             	sub    $0xc,%esp
+  801d5e:	68 04 80 80 00       	push   $0x808004
+  801d63:	e8 96 1e 00 00       	call   803bfe <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d68:	83 c4 08             	add    $0x8,%esp
+  801d6b:	56                   	push   %esi
+  801d6c:	68 00 a0 80 00       	push   $0x80a000
+  801d71:	e8 7c ed ff ff       	call   800af2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d79:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	r = fsipc(FSREQ_OPEN, fd);
+  801d7e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d81:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d86:	e8 7e fc ff ff       	call   801a09 <fsipc>
+  801d8b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d8d:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  801d94:	e8 d2 1e 00 00       	call   803c6b <mutex_unlock>
+	if (r < 0) {
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	85 db                	test   %ebx,%ebx
+  801d9e:	78 19                	js     801db9 <open+0x92>
+	return fd2num(fd);
+  801da0:	83 ec 0c             	sub    $0xc,%esp
+  801da3:	ff 75 f4             	push   -0xc(%ebp)
+  801da6:	e8 27 f6 ff ff       	call   8013d2 <fd2num>
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	83 c4 10             	add    $0x10,%esp
+}
+  801db0:	89 d8                	mov    %ebx,%eax
+  801db2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db5:	5b                   	pop    %ebx
+  801db6:	5e                   	pop    %esi
+  801db7:	5d                   	pop    %ebp
+  801db8:	c3                   	ret
+		fd_close(fd, 0);
+  801db9:	83 ec 08             	sub    $0x8,%esp
+  801dbc:	6a 00                	push   $0x0
+  801dbe:	ff 75 f4             	push   -0xc(%ebp)
+  801dc1:	e8 56 f7 ff ff       	call   80151c <fd_close>
+		return r;
+  801dc6:	83 c4 10             	add    $0x10,%esp
+  801dc9:	eb e5                	jmp    801db0 <open+0x89>
+		return -E_BAD_PATH;
+  801dcb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dd0:	eb de                	jmp    801db0 <open+0x89>
+
+00801dd2 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	53                   	push   %ebx
+  801dd6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	ff 75 08             	push   0x8(%ebp)
+  801de0:	e8 6a f6 ff ff       	call   80144f <fd_lookup>
+  801de5:	89 c3                	mov    %eax,%ebx
+  801de7:	83 c4 10             	add    $0x10,%esp
+  801dea:	85 c0                	test   %eax,%eax
+  801dec:	78 5b                	js     801e49 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801dee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df1:	8b 0d 90 77 80 00    	mov    0x807790,%ecx
+  801df7:	39 08                	cmp    %ecx,(%eax)
+  801df9:	75 55                	jne    801e50 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801dfb:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801dff:	74 56                	je     801e57 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801e01:	83 ec 0c             	sub    $0xc,%esp
+  801e04:	68 04 80 80 00       	push   $0x808004
+  801e09:	e8 f0 1d 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801e0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e11:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e14:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.allocate.req_offset = offset;
+  801e19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e1c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.allocate.req_len = len;
+  801e21:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e24:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801e29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e33:	e8 d1 fb ff ff       	call   801a09 <fsipc>
+  801e38:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e3a:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  801e41:	e8 25 1e 00 00       	call   803c6b <mutex_unlock>
+	return r;
+  801e46:	83 c4 10             	add    $0x10,%esp
+}
+  801e49:	89 d8                	mov    %ebx,%eax
+  801e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e50:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e55:	eb f2                	jmp    801e49 <fallocate+0x77>
+		return -E_INVAL;
+  801e57:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e5c:	eb eb                	jmp    801e49 <fallocate+0x77>
+
+00801e5e <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	56                   	push   %esi
+  801e62:	53                   	push   %ebx
+  801e63:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801e66:	89 f3                	mov    %esi,%ebx
+  801e68:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801e6e:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801e71:	eb 06                	jmp    801e79 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801e73:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e79:	39 f3                	cmp    %esi,%ebx
+  801e7b:	73 14                	jae    801e91 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801e7d:	83 ec 08             	sub    $0x8,%esp
+  801e80:	53                   	push   %ebx
+  801e81:	6a 00                	push   $0x0
+  801e83:	e8 41 f1 ff ff       	call   800fc9 <sys_page_unmap>
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	79 e4                	jns    801e73 <munmap+0x15>
+  801e8f:	eb 05                	jmp    801e96 <munmap+0x38>
+			return r;
+	return 0;
+  801e91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5d                   	pop    %ebp
+  801e9c:	c3                   	ret
+
+00801e9d <mmap>:
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	57                   	push   %edi
+  801ea1:	56                   	push   %esi
+  801ea2:	53                   	push   %ebx
+  801ea3:	83 ec 24             	sub    $0x24,%esp
+  801ea6:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ea9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eac:	50                   	push   %eax
+  801ead:	ff 75 08             	push   0x8(%ebp)
+  801eb0:	e8 9a f5 ff ff       	call   80144f <fd_lookup>
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	0f 88 37 01 00 00    	js     801ff7 <mmap+0x15a>
+		return NULL;
+  801ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ec5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ec8:	8b 0d 90 77 80 00    	mov    0x807790,%ecx
+  801ece:	39 0a                	cmp    %ecx,(%edx)
+  801ed0:	0f 85 05 01 00 00    	jne    801fdb <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801ed6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801edd:	0f 85 1b 01 00 00    	jne    801ffe <mmap+0x161>
+  801ee3:	89 f0                	mov    %esi,%eax
+  801ee5:	83 e8 01             	sub    $0x1,%eax
+  801ee8:	0f 88 17 01 00 00    	js     802005 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801eee:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801ef2:	75 28                	jne    801f1c <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801ef4:	83 ec 0c             	sub    $0xc,%esp
+  801ef7:	68 04 80 80 00       	push   $0x808004
+  801efc:	e8 fd 1c 00 00       	call   803bfe <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801f01:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801f07:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801f0d:	83 c4 10             	add    $0x10,%esp
+  801f10:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801f15:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801f1a:	eb 2b                	jmp    801f47 <mmap+0xaa>
+		cow_enable();
+  801f1c:	e8 ee 26 00 00       	call   80460f <cow_enable>
+  801f21:	eb d1                	jmp    801ef4 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801f23:	89 c2                	mov    %eax,%edx
+  801f25:	c1 ea 0c             	shr    $0xc,%edx
+  801f28:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801f2f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f35:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801f3b:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801f3e:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801f40:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801f45:	77 25                	ja     801f6c <mmap+0xcf>
+  801f47:	89 c2                	mov    %eax,%edx
+  801f49:	29 da                	sub    %ebx,%edx
+  801f4b:	39 ca                	cmp    %ecx,%edx
+  801f4d:	73 3a                	jae    801f89 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801f4f:	89 c2                	mov    %eax,%edx
+  801f51:	c1 ea 16             	shr    $0x16,%edx
+  801f54:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f5b:	f6 c2 01             	test   $0x1,%dl
+  801f5e:	75 c3                	jne    801f23 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801f60:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801f65:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801f6a:	eb d4                	jmp    801f40 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801f6c:	29 d8                	sub    %ebx,%eax
+  801f6e:	39 c8                	cmp    %ecx,%eax
+  801f70:	73 17                	jae    801f89 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801f72:	83 ec 0c             	sub    $0xc,%esp
+  801f75:	68 04 80 80 00       	push   $0x808004
+  801f7a:	e8 ec 1c 00 00       	call   803c6b <mutex_unlock>
+		return NULL;
+  801f7f:	83 c4 10             	add    $0x10,%esp
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f87:	eb 52                	jmp    801fdb <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801f89:	85 db                	test   %ebx,%ebx
+  801f8b:	74 e5                	je     801f72 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f90:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f93:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.map.req_offset = offset;
+  801f98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9b:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	fsipcbuf.map.req_len = len;
+  801fa0:	89 35 08 a0 80 00    	mov    %esi,0x80a008
+	fsipcbuf.map.req_va = va;
+  801fa6:	89 1d 0c a0 80 00    	mov    %ebx,0x80a00c
+	fsipcbuf.map.req_prot = prot;
+  801fac:	8b 45 14             	mov    0x14(%ebp),%eax
+  801faf:	a3 10 a0 80 00       	mov    %eax,0x80a010
+	r = fsipc(FSREQ_MAP, NULL);
+  801fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801fbe:	e8 46 fa ff ff       	call   801a09 <fsipc>
+  801fc3:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	68 04 80 80 00       	push   $0x808004
+  801fcd:	e8 99 1c 00 00       	call   803c6b <mutex_unlock>
+	if (r < 0) {
+  801fd2:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801fd5:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801fd7:	85 ff                	test   %edi,%edi
+  801fd9:	78 08                	js     801fe3 <mmap+0x146>
+}
+  801fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fde:	5b                   	pop    %ebx
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5f                   	pop    %edi
+  801fe1:	5d                   	pop    %ebp
+  801fe2:	c3                   	ret
+		munmap((void*) va, len);
+  801fe3:	83 ec 08             	sub    $0x8,%esp
+  801fe6:	56                   	push   %esi
+  801fe7:	53                   	push   %ebx
+  801fe8:	e8 71 fe ff ff       	call   801e5e <munmap>
+		return NULL;
+  801fed:	83 c4 10             	add    $0x10,%esp
+  801ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff5:	eb e4                	jmp    801fdb <mmap+0x13e>
+		return NULL;
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffc:	eb dd                	jmp    801fdb <mmap+0x13e>
+		return NULL;
+  801ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802003:	eb d6                	jmp    801fdb <mmap+0x13e>
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200a:	eb cf                	jmp    801fdb <mmap+0x13e>
+
+0080200c <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	53                   	push   %ebx
+  802010:	83 ec 10             	sub    $0x10,%esp
+  802013:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802016:	53                   	push   %ebx
+  802017:	e8 9b ea ff ff       	call   800ab7 <strlen>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802024:	7f 42                	jg     802068 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802026:	83 ec 0c             	sub    $0xc,%esp
+  802029:	68 04 80 80 00       	push   $0x808004
+  80202e:	e8 cb 1b 00 00       	call   803bfe <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802033:	83 c4 08             	add    $0x8,%esp
+  802036:	53                   	push   %ebx
+  802037:	68 00 a0 80 00       	push   $0x80a000
+  80203c:	e8 b1 ea ff ff       	call   800af2 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802041:	ba 00 00 00 00       	mov    $0x0,%edx
+  802046:	b8 07 00 00 00       	mov    $0x7,%eax
+  80204b:	e8 b9 f9 ff ff       	call   801a09 <fsipc>
+  802050:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802052:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  802059:	e8 0d 1c 00 00       	call   803c6b <mutex_unlock>
+	return r;
+  80205e:	83 c4 10             	add    $0x10,%esp
+}
+  802061:	89 d8                	mov    %ebx,%eax
+  802063:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802066:	c9                   	leave
+  802067:	c3                   	ret
+		return -E_BAD_PATH;
+  802068:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80206d:	eb f2                	jmp    802061 <remove+0x55>
+
+0080206f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80206f:	55                   	push   %ebp
+  802070:	89 e5                	mov    %esp,%ebp
+  802072:	53                   	push   %ebx
+  802073:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802076:	68 04 80 80 00       	push   $0x808004
+  80207b:	e8 7e 1b 00 00       	call   803bfe <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802080:	ba 00 00 00 00       	mov    $0x0,%edx
+  802085:	b8 08 00 00 00       	mov    $0x8,%eax
+  80208a:	e8 7a f9 ff ff       	call   801a09 <fsipc>
+  80208f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802091:	c7 04 24 04 80 80 00 	movl   $0x808004,(%esp)
+  802098:	e8 ce 1b 00 00       	call   803c6b <mutex_unlock>
+	return r;
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+
+008020a4 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	56                   	push   %esi
+  8020a8:	53                   	push   %ebx
+  8020a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8020ac:	83 ec 0c             	sub    $0xc,%esp
+  8020af:	68 04 80 80 00       	push   $0x808004
+  8020b4:	e8 45 1b 00 00       	call   803bfe <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8020b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8020c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020cb:	e8 39 f9 ff ff       	call   801a09 <fsipc>
+  8020d0:	89 c6                	mov    %eax,%esi
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	85 db                	test   %ebx,%ebx
+  8020d7:	74 7b                	je     802154 <fs_bcstat+0xb0>
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	78 77                	js     802154 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8020dd:	a1 00 a0 80 00       	mov    0x80a000,%eax
+  8020e2:	89 03                	mov    %eax,(%ebx)
+  8020e4:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  8020e9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8020ec:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8020f1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8020f4:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8020f9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020fc:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802101:	89 43 10             	mov    %eax,0x10(%ebx)
+  802104:	a1 14 a0 80 00       	mov    0x80a014,%eax
+  802109:	89 43 14             	mov    %eax,0x14(%ebx)
+  80210c:	a1 18 a0 80 00       	mov    0x80a018,%eax
+  802111:	89 43 18             	mov    %eax,0x18(%ebx)
+  802114:	a1 1c a0 80 00       	mov    0x80a01c,%eax
+  802119:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80211c:	a1 20 a0 80 00       	mov    0x80a020,%eax
+  802121:	89 43 20             	mov    %eax,0x20(%ebx)
+  802124:	a1 24 a0 80 00       	mov    0x80a024,%eax
+  802129:	89 43 24             	mov    %eax,0x24(%ebx)
+  80212c:	a1 28 a0 80 00       	mov    0x80a028,%eax
+  802131:	89 43 28             	mov    %eax,0x28(%ebx)
+  802134:	a1 2c a0 80 00       	mov    0x80a02c,%eax
+  802139:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80213c:	a1 30 a0 80 00       	mov    0x80a030,%eax
+  802141:	89 43 30             	mov    %eax,0x30(%ebx)
+  802144:	a1 34 a0 80 00       	mov    0x80a034,%eax
+  802149:	89 43 34             	mov    %eax,0x34(%ebx)
+  80214c:	a1 38 a0 80 00       	mov    0x80a038,%eax
+  802151:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	68 04 80 80 00       	push   $0x808004
+  80215c:	e8 0a 1b 00 00       	call   803c6b <mutex_unlock>
+	return r;
+}
+  802161:	89 f0                	mov    %esi,%eax
+  802163:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802166:	5b                   	pop    %ebx
+  802167:	5e                   	pop    %esi
+  802168:	5d                   	pop    %ebp
+  802169:	c3                   	ret
+
+0080216a <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802171:	0f b6 10             	movzbl (%eax),%edx
+  802174:	80 fa 72             	cmp    $0x72,%dl
+  802177:	74 44                	je     8021bd <parse_mode+0x53>
+  802179:	80 fa 77             	cmp    $0x77,%dl
+  80217c:	74 4b                	je     8021c9 <parse_mode+0x5f>
+  80217e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802183:	80 fa 61             	cmp    $0x61,%dl
+  802186:	74 09                	je     802191 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802188:	89 d8                	mov    %ebx,%eax
+  80218a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218d:	5b                   	pop    %ebx
+  80218e:	5e                   	pop    %esi
+  80218f:	5d                   	pop    %ebp
+  802190:	c3                   	ret
+	switch (mode[0]) {
+  802191:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802196:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80219b:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80219d:	83 ec 08             	sub    $0x8,%esp
+  8021a0:	6a 2b                	push   $0x2b
+  8021a2:	50                   	push   %eax
+  8021a3:	e8 5c ea ff ff       	call   800c04 <strchr>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	74 d9                	je     802188 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8021af:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8021b2:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8021b5:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8021bb:	eb cb                	jmp    802188 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8021bd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c7:	eb d2                	jmp    80219b <parse_mode+0x31>
+  8021c9:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8021ce:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8021d3:	eb c6                	jmp    80219b <parse_mode+0x31>
+
+008021d5 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	57                   	push   %edi
+  8021d9:	56                   	push   %esi
+  8021da:	53                   	push   %ebx
+  8021db:	83 ec 1c             	sub    $0x1c,%esp
+  8021de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021e1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8021e4:	b8 c4 77 80 00       	mov    $0x8077c4,%eax
+  8021e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8021ee:	83 c0 24             	add    $0x24,%eax
+  8021f1:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8021f5:	74 17                	je     80220e <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8021f7:	83 c3 01             	add    $0x1,%ebx
+  8021fa:	83 fb 10             	cmp    $0x10,%ebx
+  8021fd:	75 ef                	jne    8021ee <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8021ff:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802204:	89 f0                	mov    %esi,%eax
+  802206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802209:	5b                   	pop    %ebx
+  80220a:	5e                   	pop    %esi
+  80220b:	5f                   	pop    %edi
+  80220c:	5d                   	pop    %ebp
+  80220d:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80220e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802215:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802218:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80221b:	c1 e7 02             	shl    $0x2,%edi
+  80221e:	8d b7 c0 77 80 00    	lea    0x8077c0(%edi),%esi
+  802224:	83 ec 04             	sub    $0x4,%esp
+  802227:	6a 24                	push   $0x24
+  802229:	6a 00                	push   $0x0
+  80222b:	56                   	push   %esi
+  80222c:	e8 12 ea ff ff       	call   800c43 <memset>
+			streams[i].f_fd = fd;
+  802231:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802234:	89 8f c0 77 80 00    	mov    %ecx,0x8077c0(%edi)
+			streams[i].f_flags = flags;
+  80223a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80223d:	01 d8                	add    %ebx,%eax
+  80223f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802242:	89 0c 85 c4 77 80 00 	mov    %ecx,0x8077c4(,%eax,4)
+			return &streams[i];
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	eb b6                	jmp    802204 <stream_alloc+0x2f>
+
+0080224e <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	53                   	push   %ebx
+  802252:	83 ec 14             	sub    $0x14,%esp
+  802255:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802257:	8b 40 18             	mov    0x18(%eax),%eax
+  80225a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80225d:	74 4a                	je     8022a9 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80225f:	83 ec 08             	sub    $0x8,%esp
+  802262:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802265:	50                   	push   %eax
+  802266:	ff 33                	push   (%ebx)
+  802268:	e8 e2 f1 ff ff       	call   80144f <fd_lookup>
+  80226d:	89 c2                	mov    %eax,%edx
+  80226f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802272:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802277:	85 d2                	test   %edx,%edx
+  802279:	78 41                	js     8022bc <stream_unread+0x6e>
+  80227b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80227e:	8b 0d 90 77 80 00    	mov    0x807790,%ecx
+  802284:	39 0a                	cmp    %ecx,(%edx)
+  802286:	75 34                	jne    8022bc <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802288:	8b 43 14             	mov    0x14(%ebx),%eax
+  80228b:	03 42 04             	add    0x4(%edx),%eax
+  80228e:	2b 43 18             	sub    0x18(%ebx),%eax
+  802291:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802294:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80229b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8022a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a7:	eb 13                	jmp    8022bc <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8022a9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8022b0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8022b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bf:	c9                   	leave
+  8022c0:	c3                   	ret
+
+008022c1 <stream_drain>:
+{
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+  8022c6:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8022c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022cd:	eb 02                	jmp    8022d1 <stream_drain+0x10>
+  8022cf:	01 c3                	add    %eax,%ebx
+  8022d1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8022d4:	39 c3                	cmp    %eax,%ebx
+  8022d6:	73 43                	jae    80231b <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8022d8:	83 ec 04             	sub    $0x4,%esp
+  8022db:	29 d8                	sub    %ebx,%eax
+  8022dd:	50                   	push   %eax
+  8022de:	89 d8                	mov    %ebx,%eax
+  8022e0:	03 46 0c             	add    0xc(%esi),%eax
+  8022e3:	50                   	push   %eax
+  8022e4:	ff 36                	push   (%esi)
+  8022e6:	e8 ec f4 ff ff       	call   8017d7 <write>
+  8022eb:	83 c4 10             	add    $0x10,%esp
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	7f dd                	jg     8022cf <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8022f2:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8022f6:	8b 56 0c             	mov    0xc(%esi),%edx
+  8022f9:	83 ec 04             	sub    $0x4,%esp
+  8022fc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8022ff:	29 d8                	sub    %ebx,%eax
+  802301:	50                   	push   %eax
+  802302:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802305:	50                   	push   %eax
+  802306:	52                   	push   %edx
+  802307:	e8 6c e9 ff ff       	call   800c78 <memmove>
+			f->f_wend -= done;
+  80230c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80230f:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802311:	83 c4 10             	add    $0x10,%esp
+  802314:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802319:	eb 0a                	jmp    802325 <stream_drain+0x64>
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802320:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802325:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802328:	89 d0                	mov    %edx,%eax
+  80232a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80232d:	5b                   	pop    %ebx
+  80232e:	5e                   	pop    %esi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+
+00802331 <stream_setup>:
+	if (f->f_buf)
+  802331:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802335:	74 01                	je     802338 <stream_setup+0x7>
+  802337:	c3                   	ret
+{
+  802338:	55                   	push   %ebp
+  802339:	89 e5                	mov    %esp,%ebp
+  80233b:	53                   	push   %ebx
+  80233c:	83 ec 04             	sub    $0x4,%esp
+  80233f:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802341:	8b 40 08             	mov    0x8(%eax),%eax
+  802344:	85 c0                	test   %eax,%eax
+  802346:	74 17                	je     80235f <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802348:	83 f8 03             	cmp    $0x3,%eax
+  80234b:	75 2d                	jne    80237a <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80234d:	8d 43 20             	lea    0x20(%ebx),%eax
+  802350:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802353:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80235a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80235f:	83 ec 0c             	sub    $0xc,%esp
+  802362:	ff 33                	push   (%ebx)
+  802364:	e8 a9 df ff ff       	call   800312 <iscons>
+  802369:	83 c4 10             	add    $0x10,%esp
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	0f 9f c0             	setg   %al
+  802371:	0f b6 c0             	movzbl %al,%eax
+  802374:	83 c0 01             	add    $0x1,%eax
+  802377:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	68 00 10 00 00       	push   $0x1000
+  802382:	e8 8b 11 00 00       	call   803512 <malloc>
+  802387:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	74 bc                	je     80234d <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802391:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802398:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80239c:	eb bc                	jmp    80235a <stream_setup+0x29>
+
+0080239e <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	53                   	push   %ebx
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8023a7:	e8 85 ff ff ff       	call   802331 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8023ac:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8023b1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8023b5:	74 3d                	je     8023f4 <stream_fill+0x56>
+  8023b7:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8023bb:	74 10                	je     8023cd <stream_fill+0x2f>
+  8023bd:	89 d8                	mov    %ebx,%eax
+  8023bf:	e8 fd fe ff ff       	call   8022c1 <stream_drain>
+		return 0;
+  8023c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	78 27                	js     8023f4 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8023cd:	83 ec 04             	sub    $0x4,%esp
+  8023d0:	ff 73 10             	push   0x10(%ebx)
+  8023d3:	ff 73 0c             	push   0xc(%ebx)
+  8023d6:	ff 33                	push   (%ebx)
+  8023d8:	e8 02 f3 ff ff       	call   8016df <read>
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	7e 17                	jle    8023fb <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8023e4:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8023e8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8023ef:	89 c2                	mov    %eax,%edx
+  8023f1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8023f4:	89 d0                	mov    %edx,%eax
+  8023f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8023fb:	c1 f8 1f             	sar    $0x1f,%eax
+  8023fe:	83 e0 04             	and    $0x4,%eax
+  802401:	83 c0 04             	add    $0x4,%eax
+  802404:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802407:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240c:	eb e6                	jmp    8023f4 <stream_fill+0x56>
+
+0080240e <fopen>:
+{
+  80240e:	55                   	push   %ebp
+  80240f:	89 e5                	mov    %esp,%ebp
+  802411:	57                   	push   %edi
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80241a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80241d:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802423:	89 f0                	mov    %esi,%eax
+  802425:	e8 40 fd ff ff       	call   80216a <parse_mode>
+		return 0;
+  80242a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	78 2d                	js     802460 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802433:	83 ec 08             	sub    $0x8,%esp
+  802436:	50                   	push   %eax
+  802437:	ff 75 08             	push   0x8(%ebp)
+  80243a:	e8 e8 f8 ff ff       	call   801d27 <open>
+  80243f:	89 c7                	mov    %eax,%edi
+  802441:	83 c4 10             	add    $0x10,%esp
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 58                	js     8024a0 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802448:	80 3e 61             	cmpb   $0x61,(%esi)
+  80244b:	74 1d                	je     80246a <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80244d:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802453:	89 f8                	mov    %edi,%eax
+  802455:	e8 7b fd ff ff       	call   8021d5 <stream_alloc>
+  80245a:	89 c3                	mov    %eax,%ebx
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	74 32                	je     802492 <fopen+0x84>
+}
+  802460:	89 d8                	mov    %ebx,%eax
+  802462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802465:	5b                   	pop    %ebx
+  802466:	5e                   	pop    %esi
+  802467:	5f                   	pop    %edi
+  802468:	5d                   	pop    %ebp
+  802469:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80246a:	83 ec 08             	sub    $0x8,%esp
+  80246d:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802473:	50                   	push   %eax
+  802474:	57                   	push   %edi
+  802475:	e8 db f4 ff ff       	call   801955 <fstat>
+  80247a:	83 c4 10             	add    $0x10,%esp
+  80247d:	85 c0                	test   %eax,%eax
+  80247f:	78 cc                	js     80244d <fopen+0x3f>
+		seek(fd, st.st_size);
+  802481:	83 ec 08             	sub    $0x8,%esp
+  802484:	ff 75 dc             	push   -0x24(%ebp)
+  802487:	57                   	push   %edi
+  802488:	e8 f6 f3 ff ff       	call   801883 <seek>
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	eb bb                	jmp    80244d <fopen+0x3f>
+		close(fd);
+  802492:	83 ec 0c             	sub    $0xc,%esp
+  802495:	57                   	push   %edi
+  802496:	e8 08 f1 ff ff       	call   8015a3 <close>
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	eb c0                	jmp    802460 <fopen+0x52>
+		return 0;
+  8024a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024a5:	eb b9                	jmp    802460 <fopen+0x52>
+
+008024a7 <fdopen>:
+{
+  8024a7:	55                   	push   %ebp
+  8024a8:	89 e5                	mov    %esp,%ebp
+  8024aa:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8024ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b3:	e8 b2 fc ff ff       	call   80216a <parse_mode>
+  8024b8:	89 c2                	mov    %eax,%edx
+		return 0;
+  8024ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8024bf:	85 d2                	test   %edx,%edx
+  8024c1:	78 0b                	js     8024ce <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8024c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c9:	e8 07 fd ff ff       	call   8021d5 <stream_alloc>
+}
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+008024d0 <setvbuf>:
+{
+  8024d0:	55                   	push   %ebp
+  8024d1:	89 e5                	mov    %esp,%ebp
+  8024d3:	57                   	push   %edi
+  8024d4:	56                   	push   %esi
+  8024d5:	53                   	push   %ebx
+  8024d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8024dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8024df:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8024e3:	75 3a                	jne    80251f <setvbuf+0x4f>
+  8024e5:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8024e8:	83 fe 02             	cmp    $0x2,%esi
+  8024eb:	77 39                	ja     802526 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8024ed:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8024f0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8024f4:	0f 95 c3             	setne  %bl
+  8024f7:	85 ff                	test   %edi,%edi
+  8024f9:	0f 95 c1             	setne  %cl
+  8024fc:	84 cb                	test   %cl,%bl
+  8024fe:	74 05                	je     802505 <setvbuf+0x35>
+  802500:	83 fa 03             	cmp    $0x3,%edx
+  802503:	75 0a                	jne    80250f <setvbuf+0x3f>
+	return 0;
+  802505:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5f                   	pop    %edi
+  80250d:	5d                   	pop    %ebp
+  80250e:	c3                   	ret
+		f->f_buf = buf;
+  80250f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802512:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802515:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251d:	eb eb                	jmp    80250a <setvbuf+0x3a>
+		return EOF;
+  80251f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802524:	eb e4                	jmp    80250a <setvbuf+0x3a>
+  802526:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80252b:	eb dd                	jmp    80250a <setvbuf+0x3a>
+
+0080252d <fflush>:
+{
+  80252d:	55                   	push   %ebp
+  80252e:	89 e5                	mov    %esp,%ebp
+  802530:	57                   	push   %edi
+  802531:	56                   	push   %esi
+  802532:	53                   	push   %ebx
+  802533:	83 ec 0c             	sub    $0xc,%esp
+  802536:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802539:	85 db                	test   %ebx,%ebx
+  80253b:	74 1a                	je     802557 <fflush+0x2a>
+	stream_unread(f);
+  80253d:	89 d8                	mov    %ebx,%eax
+  80253f:	e8 0a fd ff ff       	call   80224e <stream_unread>
+	return stream_drain(f);
+  802544:	89 d8                	mov    %ebx,%eax
+  802546:	e8 76 fd ff ff       	call   8022c1 <stream_drain>
+  80254b:	89 c7                	mov    %eax,%edi
+}
+  80254d:	89 f8                	mov    %edi,%eax
+  80254f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802552:	5b                   	pop    %ebx
+  802553:	5e                   	pop    %esi
+  802554:	5f                   	pop    %edi
+  802555:	5d                   	pop    %ebp
+  802556:	c3                   	ret
+  802557:	bb c0 77 80 00       	mov    $0x8077c0,%ebx
+  80255c:	be 00 7a 80 00       	mov    $0x807a00,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802561:	bf 00 00 00 00       	mov    $0x0,%edi
+  802566:	eb 03                	jmp    80256b <fflush+0x3e>
+  802568:	83 c3 24             	add    $0x24,%ebx
+  80256b:	39 f3                	cmp    %esi,%ebx
+  80256d:	74 de                	je     80254d <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80256f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802573:	74 f3                	je     802568 <fflush+0x3b>
+  802575:	83 ec 0c             	sub    $0xc,%esp
+  802578:	53                   	push   %ebx
+  802579:	e8 af ff ff ff       	call   80252d <fflush>
+  80257e:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802581:	85 c0                	test   %eax,%eax
+  802583:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802588:	0f 48 f8             	cmovs  %eax,%edi
+  80258b:	eb db                	jmp    802568 <fflush+0x3b>
+
+0080258d <fclose>:
+{
+  80258d:	55                   	push   %ebp
+  80258e:	89 e5                	mov    %esp,%ebp
+  802590:	56                   	push   %esi
+  802591:	53                   	push   %ebx
+  802592:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802595:	83 ec 0c             	sub    $0xc,%esp
+  802598:	56                   	push   %esi
+  802599:	e8 8f ff ff ff       	call   80252d <fflush>
+  80259e:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8025a0:	83 c4 04             	add    $0x4,%esp
+  8025a3:	ff 36                	push   (%esi)
+  8025a5:	e8 f9 ef ff ff       	call   8015a3 <close>
+  8025aa:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8025ad:	85 c0                	test   %eax,%eax
+  8025af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025b4:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8025b7:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8025bb:	75 10                	jne    8025cd <fclose+0x40>
+	f->f_flags = 0;
+  8025bd:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8025c4:	89 d8                	mov    %ebx,%eax
+  8025c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c9:	5b                   	pop    %ebx
+  8025ca:	5e                   	pop    %esi
+  8025cb:	5d                   	pop    %ebp
+  8025cc:	c3                   	ret
+		free(f->f_buf);
+  8025cd:	83 ec 0c             	sub    $0xc,%esp
+  8025d0:	ff 76 0c             	push   0xc(%esi)
+  8025d3:	e8 71 0e 00 00       	call   803449 <free>
+  8025d8:	83 c4 10             	add    $0x10,%esp
+  8025db:	eb e0                	jmp    8025bd <fclose+0x30>
+
+008025dd <fileno>:
+{
+  8025dd:	55                   	push   %ebp
+  8025de:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8025e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e3:	8b 00                	mov    (%eax),%eax
+}
+  8025e5:	5d                   	pop    %ebp
+  8025e6:	c3                   	ret
+
+008025e7 <feof>:
+{
+  8025e7:	55                   	push   %ebp
+  8025e8:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8025ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ed:	8b 40 04             	mov    0x4(%eax),%eax
+  8025f0:	c1 e8 02             	shr    $0x2,%eax
+  8025f3:	83 e0 01             	and    $0x1,%eax
+}
+  8025f6:	5d                   	pop    %ebp
+  8025f7:	c3                   	ret
+
+008025f8 <ferror>:
+{
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8025fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fe:	8b 40 04             	mov    0x4(%eax),%eax
+  802601:	c1 e8 03             	shr    $0x3,%eax
+  802604:	83 e0 01             	and    $0x1,%eax
+}
+  802607:	5d                   	pop    %ebp
+  802608:	c3                   	ret
+
+00802609 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+  80260c:	53                   	push   %ebx
+  80260d:	83 ec 04             	sub    $0x4,%esp
+  802610:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802613:	8b 43 18             	mov    0x18(%ebx),%eax
+  802616:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802619:	74 15                	je     802630 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  80261b:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80261e:	8b 43 14             	mov    0x14(%ebx),%eax
+  802621:	8d 48 01             	lea    0x1(%eax),%ecx
+  802624:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802627:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  80262b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80262e:	c9                   	leave
+  80262f:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802630:	89 d8                	mov    %ebx,%eax
+  802632:	e8 67 fd ff ff       	call   80239e <stream_fill>
+  802637:	85 c0                	test   %eax,%eax
+  802639:	75 e0                	jne    80261b <fgetc+0x12>
+		return EOF;
+  80263b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802640:	eb e9                	jmp    80262b <fgetc+0x22>
+
+00802642 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802642:	55                   	push   %ebp
+  802643:	89 e5                	mov    %esp,%ebp
+  802645:	57                   	push   %edi
+  802646:	56                   	push   %esi
+  802647:	53                   	push   %ebx
+  802648:	83 ec 1c             	sub    $0x1c,%esp
+  80264b:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80264e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802653:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802656:	83 e8 01             	sub    $0x1,%eax
+  802659:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80265c:	eb 66                	jmp    8026c4 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80265e:	8b 46 14             	mov    0x14(%esi),%eax
+  802661:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802664:	29 c3                	sub    %eax,%ebx
+  802666:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802669:	29 fa                	sub    %edi,%edx
+  80266b:	39 d3                	cmp    %edx,%ebx
+  80266d:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802670:	83 ec 04             	sub    $0x4,%esp
+  802673:	53                   	push   %ebx
+  802674:	6a 0a                	push   $0xa
+  802676:	03 46 0c             	add    0xc(%esi),%eax
+  802679:	50                   	push   %eax
+  80267a:	e8 aa e6 ff ff       	call   800d29 <memfind>
+  80267f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802682:	8b 46 0c             	mov    0xc(%esi),%eax
+  802685:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802688:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80268b:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80268d:	83 c4 10             	add    $0x10,%esp
+  802690:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802693:	74 0b                	je     8026a0 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802695:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802698:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80269b:	29 d3                	sub    %edx,%ebx
+  80269d:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8026a0:	83 ec 04             	sub    $0x4,%esp
+  8026a3:	53                   	push   %ebx
+  8026a4:	01 c8                	add    %ecx,%eax
+  8026a6:	50                   	push   %eax
+  8026a7:	89 f8                	mov    %edi,%eax
+  8026a9:	03 45 08             	add    0x8(%ebp),%eax
+  8026ac:	50                   	push   %eax
+  8026ad:	e8 c6 e5 ff ff       	call   800c78 <memmove>
+		f->f_rpos += m;
+  8026b2:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8026b5:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8026b7:	83 c4 10             	add    $0x10,%esp
+  8026ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bd:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8026c2:	74 1f                	je     8026e3 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8026c4:	8d 47 01             	lea    0x1(%edi),%eax
+  8026c7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8026ca:	73 17                	jae    8026e3 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8026cc:	8b 46 18             	mov    0x18(%esi),%eax
+  8026cf:	39 46 14             	cmp    %eax,0x14(%esi)
+  8026d2:	75 8a                	jne    80265e <fgets+0x1c>
+  8026d4:	89 f0                	mov    %esi,%eax
+  8026d6:	e8 c3 fc ff ff       	call   80239e <stream_fill>
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	0f 85 7b ff ff ff    	jne    80265e <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8026e3:	85 ff                	test   %edi,%edi
+  8026e5:	74 0f                	je     8026f6 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8026e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ea:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8026ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f1:	5b                   	pop    %ebx
+  8026f2:	5e                   	pop    %esi
+  8026f3:	5f                   	pop    %edi
+  8026f4:	5d                   	pop    %ebp
+  8026f5:	c3                   	ret
+		return 0;
+  8026f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fb:	eb f1                	jmp    8026ee <fgets+0xac>
+
+008026fd <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	57                   	push   %edi
+  802701:	56                   	push   %esi
+  802702:	53                   	push   %ebx
+  802703:	83 ec 1c             	sub    $0x1c,%esp
+  802706:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802709:	89 f0                	mov    %esi,%eax
+  80270b:	e8 21 fc ff ff       	call   802331 <stream_setup>
+	want = size * n;
+  802710:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802713:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802717:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  80271a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80271f:	eb 43                	jmp    802764 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802721:	29 d3                	sub    %edx,%ebx
+  802723:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802726:	29 f8                	sub    %edi,%eax
+  802728:	39 c3                	cmp    %eax,%ebx
+  80272a:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80272d:	83 ec 04             	sub    $0x4,%esp
+  802730:	53                   	push   %ebx
+  802731:	03 56 0c             	add    0xc(%esi),%edx
+  802734:	52                   	push   %edx
+  802735:	89 f8                	mov    %edi,%eax
+  802737:	03 45 08             	add    0x8(%ebp),%eax
+  80273a:	50                   	push   %eax
+  80273b:	e8 38 e5 ff ff       	call   800c78 <memmove>
+			f->f_rpos += m;
+  802740:	01 5e 14             	add    %ebx,0x14(%esi)
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	eb 1a                	jmp    802762 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	53                   	push   %ebx
+  80274c:	89 f8                	mov    %edi,%eax
+  80274e:	03 45 08             	add    0x8(%ebp),%eax
+  802751:	50                   	push   %eax
+  802752:	ff 36                	push   (%esi)
+  802754:	e8 86 ef ff ff       	call   8016df <read>
+  802759:	89 c3                	mov    %eax,%ebx
+  80275b:	83 c4 10             	add    $0x10,%esp
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	7e 36                	jle    802798 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802762:	01 df                	add    %ebx,%edi
+  802764:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802767:	39 c7                	cmp    %eax,%edi
+  802769:	73 39                	jae    8027a4 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80276b:	8b 56 14             	mov    0x14(%esi),%edx
+  80276e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802771:	39 da                	cmp    %ebx,%edx
+  802773:	72 ac                	jb     802721 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802775:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802778:	29 fb                	sub    %edi,%ebx
+  80277a:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80277d:	72 3e                	jb     8027bd <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80277f:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802783:	74 1f                	je     8027a4 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802785:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802789:	74 bd                	je     802748 <fread+0x4b>
+  80278b:	89 f0                	mov    %esi,%eax
+  80278d:	e8 2f fb ff ff       	call   8022c1 <stream_drain>
+  802792:	85 c0                	test   %eax,%eax
+  802794:	79 b2                	jns    802748 <fread+0x4b>
+  802796:	eb 0c                	jmp    8027a4 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802798:	c1 fb 1f             	sar    $0x1f,%ebx
+  80279b:	83 e3 04             	and    $0x4,%ebx
+  80279e:	83 c3 04             	add    $0x4,%ebx
+  8027a1:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8027a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	74 0a                	je     8027b5 <fread+0xb8>
+  8027ab:	89 f8                	mov    %edi,%eax
+  8027ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b2:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8027b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b8:	5b                   	pop    %ebx
+  8027b9:	5e                   	pop    %esi
+  8027ba:	5f                   	pop    %edi
+  8027bb:	5d                   	pop    %ebp
+  8027bc:	c3                   	ret
+		} else if (!stream_fill(f))
+  8027bd:	89 f0                	mov    %esi,%eax
+  8027bf:	e8 da fb ff ff       	call   80239e <stream_fill>
+  8027c4:	85 c0                	test   %eax,%eax
+  8027c6:	74 dc                	je     8027a4 <fread+0xa7>
+			m = 0;
+  8027c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027cd:	eb 93                	jmp    802762 <fread+0x65>
+
+008027cf <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	57                   	push   %edi
+  8027d3:	56                   	push   %esi
+  8027d4:	53                   	push   %ebx
+  8027d5:	83 ec 1c             	sub    $0x1c,%esp
+  8027d8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8027db:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027de:	a8 02                	test   $0x2,%al
+  8027e0:	75 13                	jne    8027f5 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8027e2:	83 c8 08             	or     $0x8,%eax
+  8027e5:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8027e8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8027ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f0:	5b                   	pop    %ebx
+  8027f1:	5e                   	pop    %esi
+  8027f2:	5f                   	pop    %edi
+  8027f3:	5d                   	pop    %ebp
+  8027f4:	c3                   	ret
+	stream_setup(f);
+  8027f5:	89 d8                	mov    %ebx,%eax
+  8027f7:	e8 35 fb ff ff       	call   802331 <stream_setup>
+	want = size * n;
+  8027fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027ff:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802803:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802806:	89 d8                	mov    %ebx,%eax
+  802808:	e8 41 fa ff ff       	call   80224e <stream_unread>
+	for (done = 0; done < want; ) {
+  80280d:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802812:	84 c0                	test   %al,%al
+  802814:	75 7b                	jne    802891 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802816:	be 00 00 00 00       	mov    $0x0,%esi
+  80281b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80281e:	39 fe                	cmp    %edi,%esi
+  802820:	73 24                	jae    802846 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802822:	83 ec 04             	sub    $0x4,%esp
+  802825:	89 f8                	mov    %edi,%eax
+  802827:	29 f0                	sub    %esi,%eax
+  802829:	50                   	push   %eax
+  80282a:	89 f0                	mov    %esi,%eax
+  80282c:	03 45 08             	add    0x8(%ebp),%eax
+  80282f:	50                   	push   %eax
+  802830:	ff 33                	push   (%ebx)
+  802832:	e8 a0 ef ff ff       	call   8017d7 <write>
+  802837:	83 c4 10             	add    $0x10,%esp
+  80283a:	85 c0                	test   %eax,%eax
+  80283c:	7e 04                	jle    802842 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80283e:	01 c6                	add    %eax,%esi
+  802840:	eb dc                	jmp    80281e <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802842:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802846:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	74 a0                	je     8027ed <fwrite+0x1e>
+  80284d:	89 f0                	mov    %esi,%eax
+  80284f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802854:	f7 75 0c             	divl   0xc(%ebp)
+  802857:	eb 94                	jmp    8027ed <fwrite+0x1e>
+			done += r;
+  802859:	01 c7                	add    %eax,%edi
+			continue;
+  80285b:	eb 34                	jmp    802891 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80285d:	8b 73 10             	mov    0x10(%ebx),%esi
+  802860:	29 c6                	sub    %eax,%esi
+  802862:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802865:	29 fa                	sub    %edi,%edx
+  802867:	39 d6                	cmp    %edx,%esi
+  802869:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80286c:	83 ec 04             	sub    $0x4,%esp
+  80286f:	56                   	push   %esi
+  802870:	89 fa                	mov    %edi,%edx
+  802872:	03 55 08             	add    0x8(%ebp),%edx
+  802875:	52                   	push   %edx
+  802876:	03 43 0c             	add    0xc(%ebx),%eax
+  802879:	50                   	push   %eax
+  80287a:	e8 f9 e3 ff ff       	call   800c78 <memmove>
+		f->f_wend += m;
+  80287f:	89 f0                	mov    %esi,%eax
+  802881:	03 43 1c             	add    0x1c(%ebx),%eax
+  802884:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802887:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802889:	83 c4 10             	add    $0x10,%esp
+  80288c:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80288f:	74 5b                	je     8028ec <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802891:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802894:	39 c7                	cmp    %eax,%edi
+  802896:	73 2d                	jae    8028c5 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802898:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80289b:	85 c0                	test   %eax,%eax
+  80289d:	75 be                	jne    80285d <fwrite+0x8e>
+  80289f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028a2:	29 fa                	sub    %edi,%edx
+  8028a4:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8028a7:	72 b4                	jb     80285d <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8028a9:	83 ec 04             	sub    $0x4,%esp
+  8028ac:	52                   	push   %edx
+  8028ad:	89 f8                	mov    %edi,%eax
+  8028af:	03 45 08             	add    0x8(%ebp),%eax
+  8028b2:	50                   	push   %eax
+  8028b3:	ff 33                	push   (%ebx)
+  8028b5:	e8 1d ef ff ff       	call   8017d7 <write>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	7f 98                	jg     802859 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8028c1:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8028c5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8028c8:	83 f8 03             	cmp    $0x3,%eax
+  8028cb:	74 48                	je     802915 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8028cd:	83 f8 02             	cmp    $0x2,%eax
+  8028d0:	74 27                	je     8028f9 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8028d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	0f 84 10 ff ff ff    	je     8027ed <fwrite+0x1e>
+  8028dd:	89 f8                	mov    %edi,%eax
+  8028df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e4:	f7 75 0c             	divl   0xc(%ebp)
+  8028e7:	e9 01 ff ff ff       	jmp    8027ed <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8028ec:	89 d8                	mov    %ebx,%eax
+  8028ee:	e8 ce f9 ff ff       	call   8022c1 <stream_drain>
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	79 9a                	jns    802891 <fwrite+0xc2>
+  8028f7:	eb cc                	jmp    8028c5 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8028f9:	83 ec 04             	sub    $0x4,%esp
+  8028fc:	57                   	push   %edi
+  8028fd:	6a 0a                	push   $0xa
+  8028ff:	ff 75 08             	push   0x8(%ebp)
+  802902:	e8 22 e4 ff ff       	call   800d29 <memfind>
+  802907:	89 c2                	mov    %eax,%edx
+  802909:	89 f8                	mov    %edi,%eax
+  80290b:	03 45 08             	add    0x8(%ebp),%eax
+  80290e:	83 c4 10             	add    $0x10,%esp
+  802911:	39 c2                	cmp    %eax,%edx
+  802913:	74 bd                	je     8028d2 <fwrite+0x103>
+		stream_drain(f);
+  802915:	89 d8                	mov    %ebx,%eax
+  802917:	e8 a5 f9 ff ff       	call   8022c1 <stream_drain>
+  80291c:	eb b4                	jmp    8028d2 <fwrite+0x103>
+
+0080291e <fputc>:
+{
+  80291e:	55                   	push   %ebp
+  80291f:	89 e5                	mov    %esp,%ebp
+  802921:	53                   	push   %ebx
+  802922:	83 ec 14             	sub    $0x14,%esp
+  802925:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802928:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  80292b:	ff 75 0c             	push   0xc(%ebp)
+  80292e:	6a 01                	push   $0x1
+  802930:	6a 01                	push   $0x1
+  802932:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802935:	50                   	push   %eax
+  802936:	e8 94 fe ff ff       	call   8027cf <fwrite>
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	0f b6 db             	movzbl %bl,%ebx
+  802941:	83 f8 01             	cmp    $0x1,%eax
+  802944:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802949:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80294c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+
+00802951 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802951:	55                   	push   %ebp
+  802952:	89 e5                	mov    %esp,%ebp
+  802954:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802957:	ff 75 0c             	push   0xc(%ebp)
+  80295a:	ff 75 08             	push   0x8(%ebp)
+  80295d:	e8 bc ff ff ff       	call   80291e <fputc>
+}
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	c9                   	leave
+  802966:	c3                   	ret
+
+00802967 <fputs>:
+{
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	56                   	push   %esi
+  80296b:	53                   	push   %ebx
+  80296c:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80296f:	83 ec 0c             	sub    $0xc,%esp
+  802972:	56                   	push   %esi
+  802973:	e8 3f e1 ff ff       	call   800ab7 <strlen>
+  802978:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80297a:	ff 75 0c             	push   0xc(%ebp)
+  80297d:	50                   	push   %eax
+  80297e:	6a 01                	push   $0x1
+  802980:	56                   	push   %esi
+  802981:	e8 49 fe ff ff       	call   8027cf <fwrite>
+  802986:	83 c4 20             	add    $0x20,%esp
+  802989:	39 d8                	cmp    %ebx,%eax
+  80298b:	0f 95 c0             	setne  %al
+  80298e:	0f b6 c0             	movzbl %al,%eax
+  802991:	f7 d8                	neg    %eax
+}
+  802993:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802996:	5b                   	pop    %ebx
+  802997:	5e                   	pop    %esi
+  802998:	5d                   	pop    %ebp
+  802999:	c3                   	ret
+
+0080299a <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	53                   	push   %ebx
+  80299e:	83 ec 04             	sub    $0x4,%esp
+  8029a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029a4:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8029a7:	50                   	push   %eax
+  8029a8:	ff 75 0c             	push   0xc(%ebp)
+  8029ab:	53                   	push   %ebx
+  8029ac:	68 51 29 80 00       	push   $0x802951
+  8029b1:	e8 4f dc ff ff       	call   800605 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8029b6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029b9:	c1 e0 1c             	shl    $0x1c,%eax
+  8029bc:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8029bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+008029c4 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	57                   	push   %edi
+  8029c8:	56                   	push   %esi
+  8029c9:	53                   	push   %ebx
+  8029ca:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8029d0:	6a 00                	push   $0x0
+  8029d2:	ff 75 08             	push   0x8(%ebp)
+  8029d5:	e8 4d f3 ff ff       	call   801d27 <open>
+  8029da:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	0f 88 df 04 00 00    	js     802eca <spawn+0x506>
+  8029eb:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8029ed:	83 ec 04             	sub    $0x4,%esp
+  8029f0:	68 00 02 00 00       	push   $0x200
+  8029f5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8029fb:	50                   	push   %eax
+  8029fc:	51                   	push   %ecx
+  8029fd:	e8 8e ed ff ff       	call   801790 <readn>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802a0a:	75 5a                	jne    802a66 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802a0c:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802a13:	45 4c 46 
+  802a16:	75 4e                	jne    802a66 <spawn+0xa2>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802a18:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a1d:	cd 30                	int    $0x30
+  802a1f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802a25:	85 c0                	test   %eax,%eax
+  802a27:	0f 88 91 04 00 00    	js     802ebe <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802a2d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a32:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802a35:	c1 e6 04             	shl    $0x4,%esi
+  802a38:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802a3e:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802a44:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802a49:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802a4b:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802a51:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802a57:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802a5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802a64:	eb 4b                	jmp    802ab1 <spawn+0xed>
+		close(fd);
+  802a66:	83 ec 0c             	sub    $0xc,%esp
+  802a69:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802a6f:	e8 2f eb ff ff       	call   8015a3 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802a74:	83 c4 0c             	add    $0xc,%esp
+  802a77:	68 7f 45 4c 46       	push   $0x464c457f
+  802a7c:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802a82:	68 18 55 80 00       	push   $0x805518
+  802a87:	e8 82 da ff ff       	call   80050e <cprintf>
+		return -E_NOT_EXEC;
+  802a8c:	83 c4 10             	add    $0x10,%esp
+  802a8f:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  802a96:	ff ff ff 
+  802a99:	e9 2c 04 00 00       	jmp    802eca <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  802a9e:	83 ec 0c             	sub    $0xc,%esp
+  802aa1:	50                   	push   %eax
+  802aa2:	e8 10 e0 ff ff       	call   800ab7 <strlen>
+  802aa7:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802aab:	83 c3 01             	add    $0x1,%ebx
+  802aae:	83 c4 10             	add    $0x10,%esp
+  802ab1:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802ab4:	85 c0                	test   %eax,%eax
+  802ab6:	75 e6                	jne    802a9e <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802ab8:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802abe:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802ac3:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802ac5:	89 fa                	mov    %edi,%edx
+  802ac7:	83 e2 fc             	and    $0xfffffffc,%edx
+  802aca:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802ad1:	29 c2                	sub    %eax,%edx
+  802ad3:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802ad9:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802adc:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802ae1:	0f 86 06 04 00 00    	jbe    802eed <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802ae7:	83 ec 04             	sub    $0x4,%esp
+  802aea:	6a 07                	push   $0x7
+  802aec:	68 00 00 40 00       	push   $0x400000
+  802af1:	6a 00                	push   $0x0
+  802af3:	e8 38 e4 ff ff       	call   800f30 <sys_page_alloc>
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	0f 88 ef 03 00 00    	js     802ef2 <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802b03:	be 00 00 00 00       	mov    $0x0,%esi
+  802b08:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802b0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b11:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802b17:	7e 32                	jle    802b4b <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802b19:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802b1f:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802b25:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802b28:	83 ec 08             	sub    $0x8,%esp
+  802b2b:	ff 34 b3             	push   (%ebx,%esi,4)
+  802b2e:	57                   	push   %edi
+  802b2f:	e8 be df ff ff       	call   800af2 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802b34:	83 c4 04             	add    $0x4,%esp
+  802b37:	ff 34 b3             	push   (%ebx,%esi,4)
+  802b3a:	e8 78 df ff ff       	call   800ab7 <strlen>
+  802b3f:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802b43:	83 c6 01             	add    $0x1,%esi
+  802b46:	83 c4 10             	add    $0x10,%esp
+  802b49:	eb c6                	jmp    802b11 <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  802b4b:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802b51:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802b57:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802b5e:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802b64:	0f 85 87 00 00 00    	jne    802bf1 <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802b6a:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802b70:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802b76:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802b79:	89 c8                	mov    %ecx,%eax
+  802b7b:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802b81:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802b84:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802b89:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802b8f:	83 ec 0c             	sub    $0xc,%esp
+  802b92:	6a 07                	push   $0x7
+  802b94:	68 00 d0 bf ee       	push   $0xeebfd000
+  802b99:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b9f:	68 00 00 40 00       	push   $0x400000
+  802ba4:	6a 00                	push   $0x0
+  802ba6:	e8 d2 e3 ff ff       	call   800f7d <sys_page_map>
+  802bab:	89 c3                	mov    %eax,%ebx
+  802bad:	83 c4 20             	add    $0x20,%esp
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	0f 88 98 03 00 00    	js     802f50 <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802bb8:	83 ec 08             	sub    $0x8,%esp
+  802bbb:	68 00 00 40 00       	push   $0x400000
+  802bc0:	6a 00                	push   $0x0
+  802bc2:	e8 02 e4 ff ff       	call   800fc9 <sys_page_unmap>
+  802bc7:	89 c3                	mov    %eax,%ebx
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	0f 88 7c 03 00 00    	js     802f50 <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802bd4:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802bda:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802be1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be6:	89 c8                	mov    %ecx,%eax
+  802be8:	89 d1                	mov    %edx,%ecx
+  802bea:	89 c2                	mov    %eax,%edx
+  802bec:	e9 5a 01 00 00       	jmp    802d4b <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802bf1:	68 a4 55 80 00       	push   $0x8055a4
+  802bf6:	68 dd 54 80 00       	push   $0x8054dd
+  802bfb:	68 06 01 00 00       	push   $0x106
+  802c00:	68 32 55 80 00       	push   $0x805532
+  802c05:	e8 29 d8 ff ff       	call   800433 <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802c0a:	83 ec 04             	sub    $0x4,%esp
+  802c0d:	6a 07                	push   $0x7
+  802c0f:	68 00 00 40 00       	push   $0x400000
+  802c14:	6a 00                	push   $0x0
+  802c16:	e8 15 e3 ff ff       	call   800f30 <sys_page_alloc>
+  802c1b:	83 c4 10             	add    $0x10,%esp
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	0f 88 b2 02 00 00    	js     802ed8 <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  802c26:	83 ec 08             	sub    $0x8,%esp
+  802c29:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  802c2f:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802c35:	01 d0                	add    %edx,%eax
+  802c37:	50                   	push   %eax
+  802c38:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802c3e:	e8 40 ec ff ff       	call   801883 <seek>
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	0f 88 91 02 00 00    	js     802edf <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  802c4e:	83 ec 04             	sub    $0x4,%esp
+  802c51:	89 fa                	mov    %edi,%edx
+  802c53:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802c59:	29 ca                	sub    %ecx,%edx
+  802c5b:	89 d0                	mov    %edx,%eax
+  802c5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c62:	39 d0                	cmp    %edx,%eax
+  802c64:	0f 47 c2             	cmova  %edx,%eax
+  802c67:	50                   	push   %eax
+  802c68:	68 00 00 40 00       	push   $0x400000
+  802c6d:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802c73:	e8 18 eb ff ff       	call   801790 <readn>
+  802c78:	83 c4 10             	add    $0x10,%esp
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	0f 88 63 02 00 00    	js     802ee6 <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  802c83:	83 ec 0c             	sub    $0xc,%esp
+  802c86:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  802c8c:	56                   	push   %esi
+  802c8d:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c93:	68 00 00 40 00       	push   $0x400000
+  802c98:	6a 00                	push   $0x0
+  802c9a:	e8 de e2 ff ff       	call   800f7d <sys_page_map>
+  802c9f:	83 c4 20             	add    $0x20,%esp
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 7e                	js     802d24 <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+  802ca9:	68 00 00 40 00       	push   $0x400000
+  802cae:	6a 00                	push   $0x0
+  802cb0:	e8 14 e3 ff ff       	call   800fc9 <sys_page_unmap>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802cb8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802cbe:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cc4:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  802cca:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802cd0:	39 c3                	cmp    %eax,%ebx
+  802cd2:	73 65                	jae    802d39 <spawn+0x375>
+		if (i >= filesz) {
+  802cd4:	39 fb                	cmp    %edi,%ebx
+  802cd6:	0f 82 2e ff ff ff    	jb     802c0a <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802cdc:	83 ec 04             	sub    $0x4,%esp
+  802cdf:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  802ce5:	56                   	push   %esi
+  802ce6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802cec:	e8 3f e2 ff ff       	call   800f30 <sys_page_alloc>
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	79 c0                	jns    802cb8 <spawn+0x2f4>
+  802cf8:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802cfa:	83 ec 0c             	sub    $0xc,%esp
+  802cfd:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802d03:	e8 85 e1 ff ff       	call   800e8d <sys_env_destroy>
+	close(fd);
+  802d08:	83 c4 04             	add    $0x4,%esp
+  802d0b:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802d11:	e8 8d e8 ff ff       	call   8015a3 <close>
+	return r;
+  802d16:	83 c4 10             	add    $0x10,%esp
+  802d19:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  802d1f:	e9 a6 01 00 00       	jmp    802eca <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  802d24:	50                   	push   %eax
+  802d25:	68 3e 55 80 00       	push   $0x80553e
+  802d2a:	68 39 01 00 00       	push   $0x139
+  802d2f:	68 32 55 80 00       	push   $0x805532
+  802d34:	e8 fa d6 ff ff       	call   800433 <_panic>
+  802d39:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802d3f:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802d45:	83 c1 01             	add    $0x1,%ecx
+  802d48:	83 c2 20             	add    $0x20,%edx
+  802d4b:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802d52:	39 c8                	cmp    %ecx,%eax
+  802d54:	0f 8e 88 00 00 00    	jle    802de2 <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802d5a:	83 3a 01             	cmpl   $0x1,(%edx)
+  802d5d:	75 e6                	jne    802d45 <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802d5f:	8b 42 18             	mov    0x18(%edx),%eax
+  802d62:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802d65:	83 f8 01             	cmp    $0x1,%eax
+  802d68:	19 c0                	sbb    %eax,%eax
+  802d6a:	83 e0 fe             	and    $0xfffffffe,%eax
+  802d6d:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802d70:	8b 72 04             	mov    0x4(%edx),%esi
+  802d73:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  802d79:	8b 7a 10             	mov    0x10(%edx),%edi
+  802d7c:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802d82:	8b 5a 14             	mov    0x14(%edx),%ebx
+  802d85:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802d8b:	8b 7a 08             	mov    0x8(%edx),%edi
+  802d8e:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  802d94:	89 fb                	mov    %edi,%ebx
+  802d96:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802d9c:	74 1c                	je     802dba <spawn+0x3f6>
+		va -= i;
+  802d9e:	29 df                	sub    %ebx,%edi
+  802da0:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  802da6:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  802dac:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  802db2:	29 de                	sub    %ebx,%esi
+  802db4:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802dba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dbf:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  802dc5:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  802dcb:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  802dd1:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802dd7:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802ddd:	e9 e2 fe ff ff       	jmp    802cc4 <spawn+0x300>
+	close(fd);
+  802de2:	83 ec 0c             	sub    $0xc,%esp
+  802de5:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802deb:	e8 b3 e7 ff ff       	call   8015a3 <close>
+  802df0:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df8:	eb 75                	jmp    802e6f <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  802dfa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e00:	83 c6 01             	add    $0x1,%esi
+  802e03:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802e09:	74 4f                	je     802e5a <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  802e0b:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  802e12:	89 c2                	mov    %eax,%edx
+  802e14:	81 e2 05 04 00 00    	and    $0x405,%edx
+  802e1a:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  802e20:	75 d8                	jne    802dfa <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  802e22:	89 da                	mov    %ebx,%edx
+  802e24:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  802e26:	83 ec 0c             	sub    $0xc,%esp
+  802e29:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e2e:	50                   	push   %eax
+  802e2f:	52                   	push   %edx
+  802e30:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802e36:	52                   	push   %edx
+  802e37:	6a 00                	push   $0x0
+  802e39:	e8 3f e1 ff ff       	call   800f7d <sys_page_map>
+  802e3e:	83 c4 20             	add    $0x20,%esp
+  802e41:	85 c0                	test   %eax,%eax
+  802e43:	79 b5                	jns    802dfa <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  802e45:	50                   	push   %eax
+  802e46:	68 8c 55 80 00       	push   $0x80558c
+  802e4b:	68 94 00 00 00       	push   $0x94
+  802e50:	68 32 55 80 00       	push   $0x805532
+  802e55:	e8 d9 d5 ff ff       	call   800433 <_panic>
+  802e5a:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802e60:	83 c2 01             	add    $0x1,%edx
+  802e63:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  802e69:	0f 84 8b 00 00 00    	je     802efa <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  802e6f:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  802e76:	a8 07                	test   $0x7,%al
+  802e78:	74 e6                	je     802e60 <spawn+0x49c>
+  802e7a:	89 d6                	mov    %edx,%esi
+  802e7c:	c1 e6 0a             	shl    $0xa,%esi
+  802e7f:	89 d7                	mov    %edx,%edi
+  802e81:	c1 e7 16             	shl    $0x16,%edi
+  802e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e89:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  802e8f:	e9 77 ff ff ff       	jmp    802e0b <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  802e94:	50                   	push   %eax
+  802e95:	68 5b 55 80 00       	push   $0x80555b
+  802e9a:	68 98 00 00 00       	push   $0x98
+  802e9f:	68 32 55 80 00       	push   $0x805532
+  802ea4:	e8 8a d5 ff ff       	call   800433 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802ea9:	50                   	push   %eax
+  802eaa:	68 75 55 80 00       	push   $0x805575
+  802eaf:	68 9b 00 00 00       	push   $0x9b
+  802eb4:	68 32 55 80 00       	push   $0x805532
+  802eb9:	e8 75 d5 ff ff       	call   800433 <_panic>
+		return r;
+  802ebe:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802ec4:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  802eca:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802ed0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ed3:	5b                   	pop    %ebx
+  802ed4:	5e                   	pop    %esi
+  802ed5:	5f                   	pop    %edi
+  802ed6:	5d                   	pop    %ebp
+  802ed7:	c3                   	ret
+  802ed8:	89 c7                	mov    %eax,%edi
+  802eda:	e9 1b fe ff ff       	jmp    802cfa <spawn+0x336>
+  802edf:	89 c7                	mov    %eax,%edi
+  802ee1:	e9 14 fe ff ff       	jmp    802cfa <spawn+0x336>
+  802ee6:	89 c7                	mov    %eax,%edi
+  802ee8:	e9 0d fe ff ff       	jmp    802cfa <spawn+0x336>
+		return -E_NO_MEM;
+  802eed:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802ef2:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802ef8:	eb d0                	jmp    802eca <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802efa:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802f01:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802f04:	83 ec 08             	sub    $0x8,%esp
+  802f07:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802f0d:	50                   	push   %eax
+  802f0e:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802f14:	e8 48 e1 ff ff       	call   801061 <sys_env_set_trapframe>
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	0f 88 70 ff ff ff    	js     802e94 <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802f24:	83 ec 08             	sub    $0x8,%esp
+  802f27:	6a 02                	push   $0x2
+  802f29:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802f2f:	e8 e1 e0 ff ff       	call   801015 <sys_env_set_status>
+  802f34:	83 c4 10             	add    $0x10,%esp
+  802f37:	85 c0                	test   %eax,%eax
+  802f39:	0f 88 6a ff ff ff    	js     802ea9 <spawn+0x4e5>
+	return child;
+  802f3f:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802f45:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802f4b:	e9 7a ff ff ff       	jmp    802eca <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  802f50:	83 ec 08             	sub    $0x8,%esp
+  802f53:	68 00 00 40 00       	push   $0x400000
+  802f58:	6a 00                	push   $0x0
+  802f5a:	e8 6a e0 ff ff       	call   800fc9 <sys_page_unmap>
+  802f5f:	83 c4 10             	add    $0x10,%esp
+  802f62:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802f68:	e9 5d ff ff ff       	jmp    802eca <spawn+0x506>
+
+00802f6d <spawnl>:
+{
+  802f6d:	55                   	push   %ebp
+  802f6e:	89 e5                	mov    %esp,%ebp
+  802f70:	56                   	push   %esi
+  802f71:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802f72:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802f7a:	eb 05                	jmp    802f81 <spawnl+0x14>
+		argc++;
+  802f7c:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802f7f:	89 ca                	mov    %ecx,%edx
+  802f81:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802f84:	83 3a 00             	cmpl   $0x0,(%edx)
+  802f87:	75 f3                	jne    802f7c <spawnl+0xf>
+	const char *argv[argc+2];
+  802f89:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802f90:	83 e2 f0             	and    $0xfffffff0,%edx
+  802f93:	29 d4                	sub    %edx,%esp
+  802f95:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802f99:	89 da                	mov    %ebx,%edx
+  802f9b:	c1 ea 02             	shr    $0x2,%edx
+  802f9e:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802fa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fa4:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802fab:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802fb2:	00 
+	va_start(vl, arg0);
+  802fb3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802fb6:	89 c2                	mov    %eax,%edx
+  802fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbd:	eb 0b                	jmp    802fca <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802fbf:	83 c0 01             	add    $0x1,%eax
+  802fc2:	8b 31                	mov    (%ecx),%esi
+  802fc4:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802fc7:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802fca:	39 d0                	cmp    %edx,%eax
+  802fcc:	75 f1                	jne    802fbf <spawnl+0x52>
+	return spawn(prog, argv);
+  802fce:	83 ec 08             	sub    $0x8,%esp
+  802fd1:	53                   	push   %ebx
+  802fd2:	ff 75 08             	push   0x8(%ebp)
+  802fd5:	e8 ea f9 ff ff       	call   8029c4 <spawn>
+}
+  802fda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fdd:	5b                   	pop    %ebx
+  802fde:	5e                   	pop    %esi
+  802fdf:	5d                   	pop    %ebp
+  802fe0:	c3                   	ret
+
+00802fe1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802fe7:	68 ca 55 80 00       	push   $0x8055ca
+  802fec:	ff 75 0c             	push   0xc(%ebp)
+  802fef:	e8 fe da ff ff       	call   800af2 <strcpy>
+	return 0;
+}
+  802ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+
+00802ffb <devsock_close>:
+{
+  802ffb:	55                   	push   %ebp
+  802ffc:	89 e5                	mov    %esp,%ebp
+  802ffe:	53                   	push   %ebx
+  802fff:	83 ec 10             	sub    $0x10,%esp
+  803002:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803005:	53                   	push   %ebx
+  803006:	e8 00 1c 00 00       	call   804c0b <pageref>
+  80300b:	89 c2                	mov    %eax,%edx
+  80300d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803010:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803015:	83 fa 01             	cmp    $0x1,%edx
+  803018:	74 05                	je     80301f <devsock_close+0x24>
+}
+  80301a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301d:	c9                   	leave
+  80301e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80301f:	83 ec 0c             	sub    $0xc,%esp
+  803022:	ff 73 0c             	push   0xc(%ebx)
+  803025:	e8 b7 02 00 00       	call   8032e1 <nsipc_close>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	eb eb                	jmp    80301a <devsock_close+0x1f>
+
+0080302f <devsock_write>:
+{
+  80302f:	55                   	push   %ebp
+  803030:	89 e5                	mov    %esp,%ebp
+  803032:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803035:	6a 00                	push   $0x0
+  803037:	ff 75 10             	push   0x10(%ebp)
+  80303a:	ff 75 0c             	push   0xc(%ebp)
+  80303d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803040:	ff 70 0c             	push   0xc(%eax)
+  803043:	e8 79 03 00 00       	call   8033c1 <nsipc_send>
+}
+  803048:	c9                   	leave
+  803049:	c3                   	ret
+
+0080304a <devsock_read>:
+{
+  80304a:	55                   	push   %ebp
+  80304b:	89 e5                	mov    %esp,%ebp
+  80304d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803050:	6a 00                	push   $0x0
+  803052:	ff 75 10             	push   0x10(%ebp)
+  803055:	ff 75 0c             	push   0xc(%ebp)
+  803058:	8b 45 08             	mov    0x8(%ebp),%eax
+  80305b:	ff 70 0c             	push   0xc(%eax)
+  80305e:	e8 ef 02 00 00       	call   803352 <nsipc_recv>
+}
+  803063:	c9                   	leave
+  803064:	c3                   	ret
+
+00803065 <fd2sockid>:
+{
+  803065:	55                   	push   %ebp
+  803066:	89 e5                	mov    %esp,%ebp
+  803068:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80306b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80306e:	52                   	push   %edx
+  80306f:	50                   	push   %eax
+  803070:	e8 da e3 ff ff       	call   80144f <fd_lookup>
+  803075:	83 c4 10             	add    $0x10,%esp
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	78 10                	js     80308c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80307c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80307f:	8b 0d 00 7a 80 00    	mov    0x807a00,%ecx
+  803085:	39 08                	cmp    %ecx,(%eax)
+  803087:	75 05                	jne    80308e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803089:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80308c:	c9                   	leave
+  80308d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80308e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803093:	eb f7                	jmp    80308c <fd2sockid+0x27>
+
+00803095 <alloc_sockfd>:
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	56                   	push   %esi
+  803099:	53                   	push   %ebx
+  80309a:	83 ec 1c             	sub    $0x1c,%esp
+  80309d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80309f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030a2:	50                   	push   %eax
+  8030a3:	e8 51 e3 ff ff       	call   8013f9 <fd_alloc>
+  8030a8:	89 c3                	mov    %eax,%ebx
+  8030aa:	83 c4 10             	add    $0x10,%esp
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	78 43                	js     8030f4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8030b1:	83 ec 04             	sub    $0x4,%esp
+  8030b4:	68 07 04 00 00       	push   $0x407
+  8030b9:	ff 75 f4             	push   -0xc(%ebp)
+  8030bc:	6a 00                	push   $0x0
+  8030be:	e8 6d de ff ff       	call   800f30 <sys_page_alloc>
+  8030c3:	89 c3                	mov    %eax,%ebx
+  8030c5:	83 c4 10             	add    $0x10,%esp
+  8030c8:	85 c0                	test   %eax,%eax
+  8030ca:	78 28                	js     8030f4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8030cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030cf:	8b 15 00 7a 80 00    	mov    0x807a00,%edx
+  8030d5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8030d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030da:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8030e1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8030e4:	83 ec 0c             	sub    $0xc,%esp
+  8030e7:	50                   	push   %eax
+  8030e8:	e8 e5 e2 ff ff       	call   8013d2 <fd2num>
+  8030ed:	89 c3                	mov    %eax,%ebx
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	eb 0c                	jmp    803100 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8030f4:	83 ec 0c             	sub    $0xc,%esp
+  8030f7:	56                   	push   %esi
+  8030f8:	e8 e4 01 00 00       	call   8032e1 <nsipc_close>
+		return r;
+  8030fd:	83 c4 10             	add    $0x10,%esp
+}
+  803100:	89 d8                	mov    %ebx,%eax
+  803102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803105:	5b                   	pop    %ebx
+  803106:	5e                   	pop    %esi
+  803107:	5d                   	pop    %ebp
+  803108:	c3                   	ret
+
+00803109 <accept>:
+{
+  803109:	55                   	push   %ebp
+  80310a:	89 e5                	mov    %esp,%ebp
+  80310c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80310f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803112:	e8 4e ff ff ff       	call   803065 <fd2sockid>
+  803117:	85 c0                	test   %eax,%eax
+  803119:	78 1b                	js     803136 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80311b:	83 ec 04             	sub    $0x4,%esp
+  80311e:	ff 75 10             	push   0x10(%ebp)
+  803121:	ff 75 0c             	push   0xc(%ebp)
+  803124:	50                   	push   %eax
+  803125:	e8 0e 01 00 00       	call   803238 <nsipc_accept>
+  80312a:	83 c4 10             	add    $0x10,%esp
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	78 05                	js     803136 <accept+0x2d>
+	return alloc_sockfd(r);
+  803131:	e8 5f ff ff ff       	call   803095 <alloc_sockfd>
+}
+  803136:	c9                   	leave
+  803137:	c3                   	ret
+
+00803138 <bind>:
+{
+  803138:	55                   	push   %ebp
+  803139:	89 e5                	mov    %esp,%ebp
+  80313b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80313e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803141:	e8 1f ff ff ff       	call   803065 <fd2sockid>
+  803146:	85 c0                	test   %eax,%eax
+  803148:	78 12                	js     80315c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80314a:	83 ec 04             	sub    $0x4,%esp
+  80314d:	ff 75 10             	push   0x10(%ebp)
+  803150:	ff 75 0c             	push   0xc(%ebp)
+  803153:	50                   	push   %eax
+  803154:	e8 31 01 00 00       	call   80328a <nsipc_bind>
+  803159:	83 c4 10             	add    $0x10,%esp
+}
+  80315c:	c9                   	leave
+  80315d:	c3                   	ret
+
+0080315e <shutdown>:
+{
+  80315e:	55                   	push   %ebp
+  80315f:	89 e5                	mov    %esp,%ebp
+  803161:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803164:	8b 45 08             	mov    0x8(%ebp),%eax
+  803167:	e8 f9 fe ff ff       	call   803065 <fd2sockid>
+  80316c:	85 c0                	test   %eax,%eax
+  80316e:	78 0f                	js     80317f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803170:	83 ec 08             	sub    $0x8,%esp
+  803173:	ff 75 0c             	push   0xc(%ebp)
+  803176:	50                   	push   %eax
+  803177:	e8 43 01 00 00       	call   8032bf <nsipc_shutdown>
+  80317c:	83 c4 10             	add    $0x10,%esp
+}
+  80317f:	c9                   	leave
+  803180:	c3                   	ret
+
+00803181 <connect>:
+{
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803187:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318a:	e8 d6 fe ff ff       	call   803065 <fd2sockid>
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	78 12                	js     8031a5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803193:	83 ec 04             	sub    $0x4,%esp
+  803196:	ff 75 10             	push   0x10(%ebp)
+  803199:	ff 75 0c             	push   0xc(%ebp)
+  80319c:	50                   	push   %eax
+  80319d:	e8 59 01 00 00       	call   8032fb <nsipc_connect>
+  8031a2:	83 c4 10             	add    $0x10,%esp
+}
+  8031a5:	c9                   	leave
+  8031a6:	c3                   	ret
+
+008031a7 <listen>:
+{
+  8031a7:	55                   	push   %ebp
+  8031a8:	89 e5                	mov    %esp,%ebp
+  8031aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b0:	e8 b0 fe ff ff       	call   803065 <fd2sockid>
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	78 0f                	js     8031c8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8031b9:	83 ec 08             	sub    $0x8,%esp
+  8031bc:	ff 75 0c             	push   0xc(%ebp)
+  8031bf:	50                   	push   %eax
+  8031c0:	e8 6b 01 00 00       	call   803330 <nsipc_listen>
+  8031c5:	83 c4 10             	add    $0x10,%esp
+}
+  8031c8:	c9                   	leave
+  8031c9:	c3                   	ret
+
+008031ca <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8031ca:	55                   	push   %ebp
+  8031cb:	89 e5                	mov    %esp,%ebp
+  8031cd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8031d0:	ff 75 10             	push   0x10(%ebp)
+  8031d3:	ff 75 0c             	push   0xc(%ebp)
+  8031d6:	ff 75 08             	push   0x8(%ebp)
+  8031d9:	e8 41 02 00 00       	call   80341f <nsipc_socket>
+  8031de:	83 c4 10             	add    $0x10,%esp
+  8031e1:	85 c0                	test   %eax,%eax
+  8031e3:	78 05                	js     8031ea <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8031e5:	e8 ab fe ff ff       	call   803095 <alloc_sockfd>
+}
+  8031ea:	c9                   	leave
+  8031eb:	c3                   	ret
+
+008031ec <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031ec:	55                   	push   %ebp
+  8031ed:	89 e5                	mov    %esp,%ebp
+  8031ef:	53                   	push   %ebx
+  8031f0:	83 ec 04             	sub    $0x4,%esp
+  8031f3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8031f5:	83 3d 08 80 80 00 00 	cmpl   $0x0,0x808008
+  8031fc:	74 26                	je     803224 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031fe:	6a 07                	push   $0x7
+  803200:	68 00 b0 80 00       	push   $0x80b000
+  803205:	53                   	push   %ebx
+  803206:	ff 35 08 80 80 00    	push   0x808008
+  80320c:	e8 65 19 00 00       	call   804b76 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803211:	83 c4 0c             	add    $0xc,%esp
+  803214:	6a 00                	push   $0x0
+  803216:	6a 00                	push   $0x0
+  803218:	6a 00                	push   $0x0
+  80321a:	e8 61 18 00 00       	call   804a80 <ipc_recv>
+}
+  80321f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803222:	c9                   	leave
+  803223:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803224:	83 ec 0c             	sub    $0xc,%esp
+  803227:	6a 02                	push   $0x2
+  803229:	e8 9e 19 00 00       	call   804bcc <ipc_find_env>
+  80322e:	a3 08 80 80 00       	mov    %eax,0x808008
+  803233:	83 c4 10             	add    $0x10,%esp
+  803236:	eb c6                	jmp    8031fe <nsipc+0x12>
+
+00803238 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803238:	55                   	push   %ebp
+  803239:	89 e5                	mov    %esp,%ebp
+  80323b:	56                   	push   %esi
+  80323c:	53                   	push   %ebx
+  80323d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803240:	8b 45 08             	mov    0x8(%ebp),%eax
+  803243:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803248:	8b 06                	mov    (%esi),%eax
+  80324a:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80324f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803254:	e8 93 ff ff ff       	call   8031ec <nsipc>
+  803259:	89 c3                	mov    %eax,%ebx
+  80325b:	85 c0                	test   %eax,%eax
+  80325d:	79 09                	jns    803268 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80325f:	89 d8                	mov    %ebx,%eax
+  803261:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803264:	5b                   	pop    %ebx
+  803265:	5e                   	pop    %esi
+  803266:	5d                   	pop    %ebp
+  803267:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803268:	83 ec 04             	sub    $0x4,%esp
+  80326b:	ff 35 10 b0 80 00    	push   0x80b010
+  803271:	68 00 b0 80 00       	push   $0x80b000
+  803276:	ff 75 0c             	push   0xc(%ebp)
+  803279:	e8 fa d9 ff ff       	call   800c78 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80327e:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  803283:	89 06                	mov    %eax,(%esi)
+  803285:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803288:	eb d5                	jmp    80325f <nsipc_accept+0x27>
+
+0080328a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	53                   	push   %ebx
+  80328e:	83 ec 08             	sub    $0x8,%esp
+  803291:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803294:	8b 45 08             	mov    0x8(%ebp),%eax
+  803297:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80329c:	53                   	push   %ebx
+  80329d:	ff 75 0c             	push   0xc(%ebp)
+  8032a0:	68 04 b0 80 00       	push   $0x80b004
+  8032a5:	e8 ce d9 ff ff       	call   800c78 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8032aa:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  8032b0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8032b5:	e8 32 ff ff ff       	call   8031ec <nsipc>
+}
+  8032ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032bd:	c9                   	leave
+  8032be:	c3                   	ret
+
+008032bf <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8032bf:	55                   	push   %ebp
+  8032c0:	89 e5                	mov    %esp,%ebp
+  8032c2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8032c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  8032cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032d0:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  8032d5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8032da:	e8 0d ff ff ff       	call   8031ec <nsipc>
+}
+  8032df:	c9                   	leave
+  8032e0:	c3                   	ret
+
+008032e1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8032e1:	55                   	push   %ebp
+  8032e2:	89 e5                	mov    %esp,%ebp
+  8032e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8032e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ea:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  8032ef:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032f4:	e8 f3 fe ff ff       	call   8031ec <nsipc>
+}
+  8032f9:	c9                   	leave
+  8032fa:	c3                   	ret
+
+008032fb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032fb:	55                   	push   %ebp
+  8032fc:	89 e5                	mov    %esp,%ebp
+  8032fe:	53                   	push   %ebx
+  8032ff:	83 ec 08             	sub    $0x8,%esp
+  803302:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803305:	8b 45 08             	mov    0x8(%ebp),%eax
+  803308:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80330d:	53                   	push   %ebx
+  80330e:	ff 75 0c             	push   0xc(%ebp)
+  803311:	68 04 b0 80 00       	push   $0x80b004
+  803316:	e8 5d d9 ff ff       	call   800c78 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80331b:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  803321:	b8 05 00 00 00       	mov    $0x5,%eax
+  803326:	e8 c1 fe ff ff       	call   8031ec <nsipc>
+}
+  80332b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80332e:	c9                   	leave
+  80332f:	c3                   	ret
+
+00803330 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803336:	8b 45 08             	mov    0x8(%ebp),%eax
+  803339:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  80333e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803341:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  803346:	b8 06 00 00 00       	mov    $0x6,%eax
+  80334b:	e8 9c fe ff ff       	call   8031ec <nsipc>
+}
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+
+00803352 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	56                   	push   %esi
+  803356:	53                   	push   %ebx
+  803357:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80335a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  803362:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  803368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80336b:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803370:	b8 07 00 00 00       	mov    $0x7,%eax
+  803375:	e8 72 fe ff ff       	call   8031ec <nsipc>
+  80337a:	89 c3                	mov    %eax,%ebx
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	78 22                	js     8033a2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803380:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803385:	39 c6                	cmp    %eax,%esi
+  803387:	0f 4e c6             	cmovle %esi,%eax
+  80338a:	39 c3                	cmp    %eax,%ebx
+  80338c:	7f 1d                	jg     8033ab <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80338e:	83 ec 04             	sub    $0x4,%esp
+  803391:	53                   	push   %ebx
+  803392:	68 00 b0 80 00       	push   $0x80b000
+  803397:	ff 75 0c             	push   0xc(%ebp)
+  80339a:	e8 d9 d8 ff ff       	call   800c78 <memmove>
+  80339f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8033a2:	89 d8                	mov    %ebx,%eax
+  8033a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033a7:	5b                   	pop    %ebx
+  8033a8:	5e                   	pop    %esi
+  8033a9:	5d                   	pop    %ebp
+  8033aa:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8033ab:	68 d6 55 80 00       	push   $0x8055d6
+  8033b0:	68 dd 54 80 00       	push   $0x8054dd
+  8033b5:	6a 62                	push   $0x62
+  8033b7:	68 eb 55 80 00       	push   $0x8055eb
+  8033bc:	e8 72 d0 ff ff       	call   800433 <_panic>
+
+008033c1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8033c1:	55                   	push   %ebp
+  8033c2:	89 e5                	mov    %esp,%ebp
+  8033c4:	53                   	push   %ebx
+  8033c5:	83 ec 04             	sub    $0x4,%esp
+  8033c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8033cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ce:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  8033d3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8033d9:	7f 2e                	jg     803409 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8033db:	83 ec 04             	sub    $0x4,%esp
+  8033de:	53                   	push   %ebx
+  8033df:	ff 75 0c             	push   0xc(%ebp)
+  8033e2:	68 0c b0 80 00       	push   $0x80b00c
+  8033e7:	e8 8c d8 ff ff       	call   800c78 <memmove>
+	nsipcbuf.send.req_size = size;
+  8033ec:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  8033f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033f5:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  8033fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033ff:	e8 e8 fd ff ff       	call   8031ec <nsipc>
+}
+  803404:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803407:	c9                   	leave
+  803408:	c3                   	ret
+	assert(size < 1600);
+  803409:	68 f7 55 80 00       	push   $0x8055f7
+  80340e:	68 dd 54 80 00       	push   $0x8054dd
+  803413:	6a 6d                	push   $0x6d
+  803415:	68 eb 55 80 00       	push   $0x8055eb
+  80341a:	e8 14 d0 ff ff       	call   800433 <_panic>
+
+0080341f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80341f:	55                   	push   %ebp
+  803420:	89 e5                	mov    %esp,%ebp
+  803422:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803425:	8b 45 08             	mov    0x8(%ebp),%eax
+  803428:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  80342d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803430:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  803435:	8b 45 10             	mov    0x10(%ebp),%eax
+  803438:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  80343d:	b8 09 00 00 00       	mov    $0x9,%eax
+  803442:	e8 a5 fd ff ff       	call   8031ec <nsipc>
+}
+  803447:	c9                   	leave
+  803448:	c3                   	ret
+
+00803449 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803449:	55                   	push   %ebp
+  80344a:	89 e5                	mov    %esp,%ebp
+  80344c:	53                   	push   %ebx
+  80344d:	83 ec 10             	sub    $0x10,%esp
+  803450:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803453:	68 0c 80 80 00       	push   $0x80800c
+  803458:	e8 a1 07 00 00       	call   803bfe <mutex_lock>
+	if (v == 0)
+  80345d:	83 c4 10             	add    $0x10,%esp
+  803460:	85 db                	test   %ebx,%ebx
+  803462:	0f 84 85 00 00 00    	je     8034ed <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803468:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80346e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803473:	77 51                	ja     8034c6 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803475:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80347b:	89 d8                	mov    %ebx,%eax
+  80347d:	c1 e8 0c             	shr    $0xc,%eax
+  803480:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803487:	f6 c4 02             	test   $0x2,%ah
+  80348a:	74 50                	je     8034dc <free+0x93>
+		sys_page_unmap(0, c);
+  80348c:	83 ec 08             	sub    $0x8,%esp
+  80348f:	53                   	push   %ebx
+  803490:	6a 00                	push   $0x0
+  803492:	e8 32 db ff ff       	call   800fc9 <sys_page_unmap>
+		c += PGSIZE;
+  803497:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80349d:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8034ab:	76 ce                	jbe    80347b <free+0x32>
+  8034ad:	68 3f 56 80 00       	push   $0x80563f
+  8034b2:	68 dd 54 80 00       	push   $0x8054dd
+  8034b7:	68 82 00 00 00       	push   $0x82
+  8034bc:	68 32 56 80 00       	push   $0x805632
+  8034c1:	e8 6d cf ff ff       	call   800433 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8034c6:	68 04 56 80 00       	push   $0x805604
+  8034cb:	68 dd 54 80 00       	push   $0x8054dd
+  8034d0:	6a 7b                	push   $0x7b
+  8034d2:	68 32 56 80 00       	push   $0x805632
+  8034d7:	e8 57 cf ff ff       	call   800433 <_panic>
+	if (--(*ref) == 0)
+  8034dc:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8034e2:	83 e8 01             	sub    $0x1,%eax
+  8034e5:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8034eb:	74 15                	je     803502 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8034ed:	83 ec 0c             	sub    $0xc,%esp
+  8034f0:	68 0c 80 80 00       	push   $0x80800c
+  8034f5:	e8 71 07 00 00       	call   803c6b <mutex_unlock>
+}
+  8034fa:	83 c4 10             	add    $0x10,%esp
+  8034fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803500:	c9                   	leave
+  803501:	c3                   	ret
+		sys_page_unmap(0, c);
+  803502:	83 ec 08             	sub    $0x8,%esp
+  803505:	53                   	push   %ebx
+  803506:	6a 00                	push   $0x0
+  803508:	e8 bc da ff ff       	call   800fc9 <sys_page_unmap>
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	eb db                	jmp    8034ed <free+0xa4>
+
+00803512 <malloc>:
+{
+  803512:	55                   	push   %ebp
+  803513:	89 e5                	mov    %esp,%ebp
+  803515:	57                   	push   %edi
+  803516:	56                   	push   %esi
+  803517:	53                   	push   %ebx
+  803518:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80351b:	68 0c 80 80 00       	push   $0x80800c
+  803520:	e8 d9 06 00 00       	call   803bfe <mutex_lock>
+	if (mptr == 0)
+  803525:	8b 3d 10 80 80 00    	mov    0x808010,%edi
+  80352b:	83 c4 10             	add    $0x10,%esp
+  80352e:	85 ff                	test   %edi,%edi
+  803530:	74 6c                	je     80359e <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803532:	8b 45 08             	mov    0x8(%ebp),%eax
+  803535:	83 c0 03             	add    $0x3,%eax
+  803538:	83 e0 fc             	and    $0xfffffffc,%eax
+  80353b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80353d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803542:	0f 87 64 01 00 00    	ja     8036ac <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803548:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80354e:	74 30                	je     803580 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803550:	89 f9                	mov    %edi,%ecx
+  803552:	c1 e9 0c             	shr    $0xc,%ecx
+  803555:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803559:	c1 e8 0c             	shr    $0xc,%eax
+  80355c:	39 c1                	cmp    %eax,%ecx
+  80355e:	74 5f                	je     8035bf <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803560:	83 ec 0c             	sub    $0xc,%esp
+  803563:	57                   	push   %edi
+  803564:	e8 e0 fe ff ff       	call   803449 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803569:	a1 10 80 80 00       	mov    0x808010,%eax
+  80356e:	05 00 10 00 00       	add    $0x1000,%eax
+  803573:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803578:	a3 10 80 80 00       	mov    %eax,0x808010
+  80357d:	83 c4 10             	add    $0x10,%esp
+  803580:	8b 0d 10 80 80 00    	mov    0x808010,%ecx
+{
+  803586:	ba 02 00 00 00       	mov    $0x2,%edx
+  80358b:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80358f:	8d 7e 04             	lea    0x4(%esi),%edi
+  803592:	89 cb                	mov    %ecx,%ebx
+  803594:	01 f9                	add    %edi,%ecx
+  803596:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803599:	e9 8b 00 00 00       	jmp    803629 <malloc+0x117>
+		mptr = mbegin;
+  80359e:	c7 05 10 80 80 00 00 	movl   $0x8000000,0x808010
+  8035a5:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8035a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ab:	83 c0 03             	add    $0x3,%eax
+  8035ae:	83 e0 fc             	and    $0xfffffffc,%eax
+  8035b1:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8035b3:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8035b8:	76 c6                	jbe    803580 <malloc+0x6e>
+  8035ba:	e9 d6 00 00 00       	jmp    803695 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8035bf:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8035c5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8035ca:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8035ce:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8035d1:	a3 10 80 80 00       	mov    %eax,0x808010
+			return v;
+  8035d6:	e9 ba 00 00 00       	jmp    803695 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8035db:	05 00 10 00 00       	add    $0x1000,%eax
+  8035e0:	39 c8                	cmp    %ecx,%eax
+  8035e2:	0f 83 cb 00 00 00    	jae    8036b3 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8035e8:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8035ed:	77 22                	ja     803611 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8035ef:	89 c2                	mov    %eax,%edx
+  8035f1:	c1 ea 16             	shr    $0x16,%edx
+  8035f4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8035fb:	f6 c2 01             	test   $0x1,%dl
+  8035fe:	74 db                	je     8035db <malloc+0xc9>
+  803600:	89 c2                	mov    %eax,%edx
+  803602:	c1 ea 0c             	shr    $0xc,%edx
+  803605:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80360c:	f6 c2 01             	test   $0x1,%dl
+  80360f:	74 ca                	je     8035db <malloc+0xc9>
+		if (mptr == mend) {
+  803611:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803617:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80361d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803621:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803627:	74 04                	je     80362d <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803629:	89 d8                	mov    %ebx,%eax
+  80362b:	eb b3                	jmp    8035e0 <malloc+0xce>
+  80362d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803630:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803635:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803639:	83 ea 01             	sub    $0x1,%edx
+  80363c:	0f 85 50 ff ff ff    	jne    803592 <malloc+0x80>
+  803642:	c7 05 10 80 80 00 00 	movl   $0x8000000,0x808010
+  803649:	00 00 08 
+				return 0;	/* out of address space */
+  80364c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803651:	eb 42                	jmp    803695 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803653:	85 db                	test   %ebx,%ebx
+  803655:	78 1e                	js     803675 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803657:	83 ec 08             	sub    $0x8,%esp
+  80365a:	89 d8                	mov    %ebx,%eax
+  80365c:	03 05 10 80 80 00    	add    0x808010,%eax
+  803662:	50                   	push   %eax
+  803663:	6a 00                	push   $0x0
+  803665:	e8 5f d9 ff ff       	call   800fc9 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80366a:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803670:	83 c4 10             	add    $0x10,%esp
+  803673:	eb de                	jmp    803653 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367a:	eb 19                	jmp    803695 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80367c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80367f:	8b 3d 10 80 80 00    	mov    0x808010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803685:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80368c:	00 
+	mptr += n;
+  80368d:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803690:	a3 10 80 80 00       	mov    %eax,0x808010
+	mutex_unlock(&malloc_mu);
+  803695:	83 ec 0c             	sub    $0xc,%esp
+  803698:	68 0c 80 80 00       	push   $0x80800c
+  80369d:	e8 c9 05 00 00       	call   803c6b <mutex_unlock>
+}
+  8036a2:	89 f8                	mov    %edi,%eax
+  8036a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a7:	5b                   	pop    %ebx
+  8036a8:	5e                   	pop    %esi
+  8036a9:	5f                   	pop    %edi
+  8036aa:	5d                   	pop    %ebp
+  8036ab:	c3                   	ret
+		return 0;
+  8036ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b1:	eb e2                	jmp    803695 <malloc+0x183>
+  8036b3:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8036b7:	74 06                	je     8036bf <malloc+0x1ad>
+  8036b9:	89 1d 10 80 80 00    	mov    %ebx,0x808010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8036bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036c4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8036c7:	39 fb                	cmp    %edi,%ebx
+  8036c9:	73 b1                	jae    80367c <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036cb:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036d1:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036d4:	39 fe                	cmp    %edi,%esi
+  8036d6:	0f 92 c0             	setb   %al
+  8036d9:	0f b6 c0             	movzbl %al,%eax
+  8036dc:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036df:	83 c8 07             	or     $0x7,%eax
+  8036e2:	50                   	push   %eax
+  8036e3:	89 d8                	mov    %ebx,%eax
+  8036e5:	03 05 10 80 80 00    	add    0x808010,%eax
+  8036eb:	50                   	push   %eax
+  8036ec:	6a 00                	push   $0x0
+  8036ee:	e8 3d d8 ff ff       	call   800f30 <sys_page_alloc>
+  8036f3:	83 c4 10             	add    $0x10,%esp
+  8036f6:	85 c0                	test   %eax,%eax
+  8036f8:	0f 88 55 ff ff ff    	js     803653 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8036fe:	89 f3                	mov    %esi,%ebx
+  803700:	eb c5                	jmp    8036c7 <malloc+0x1b5>
+
+00803702 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803702:	55                   	push   %ebp
+  803703:	89 e5                	mov    %esp,%ebp
+  803705:	56                   	push   %esi
+  803706:	53                   	push   %ebx
+  803707:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80370a:	83 ec 0c             	sub    $0xc,%esp
+  80370d:	ff 75 08             	push   0x8(%ebp)
+  803710:	e8 cd dc ff ff       	call   8013e2 <fd2data>
+  803715:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803717:	83 c4 08             	add    $0x8,%esp
+  80371a:	68 57 56 80 00       	push   $0x805657
+  80371f:	53                   	push   %ebx
+  803720:	e8 cd d3 ff ff       	call   800af2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803725:	8b 46 04             	mov    0x4(%esi),%eax
+  803728:	2b 06                	sub    (%esi),%eax
+  80372a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803730:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803737:	00 00 00 
+	stat->st_dev = &devpipe;
+  80373a:	c7 83 88 00 00 00 1c 	movl   $0x807a1c,0x88(%ebx)
+  803741:	7a 80 00 
+	return 0;
+}
+  803744:	b8 00 00 00 00       	mov    $0x0,%eax
+  803749:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80374c:	5b                   	pop    %ebx
+  80374d:	5e                   	pop    %esi
+  80374e:	5d                   	pop    %ebp
+  80374f:	c3                   	ret
+
+00803750 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803755:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803759:	85 c9                	test   %ecx,%ecx
+  80375b:	75 01                	jne    80375e <pipewake+0xe>
+  80375d:	c3                   	ret
+{
+  80375e:	55                   	push   %ebp
+  80375f:	89 e5                	mov    %esp,%ebp
+  803761:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803764:	68 00 04 00 00       	push   $0x400
+  803769:	52                   	push   %edx
+  80376a:	e8 05 db ff ff       	call   801274 <sys_futex_wake>
+  80376f:	83 c4 10             	add    $0x10,%esp
+}
+  803772:	c9                   	leave
+  803773:	c3                   	ret
+
+00803774 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803774:	55                   	push   %ebp
+  803775:	89 e5                	mov    %esp,%ebp
+  803777:	56                   	push   %esi
+  803778:	53                   	push   %ebx
+  803779:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80377c:	83 ec 0c             	sub    $0xc,%esp
+  80377f:	56                   	push   %esi
+  803780:	e8 5d dc ff ff       	call   8013e2 <fd2data>
+  803785:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803787:	83 c4 08             	add    $0x8,%esp
+  80378a:	56                   	push   %esi
+  80378b:	6a 00                	push   $0x0
+  80378d:	e8 37 d8 ff ff       	call   800fc9 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803792:	8d 53 04             	lea    0x4(%ebx),%edx
+  803795:	8d 43 08             	lea    0x8(%ebx),%eax
+  803798:	e8 b3 ff ff ff       	call   803750 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80379d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8037a0:	89 da                	mov    %ebx,%edx
+  8037a2:	e8 a9 ff ff ff       	call   803750 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8037a7:	89 34 24             	mov    %esi,(%esp)
+  8037aa:	e8 33 dc ff ff       	call   8013e2 <fd2data>
+  8037af:	83 c4 08             	add    $0x8,%esp
+  8037b2:	50                   	push   %eax
+  8037b3:	6a 00                	push   $0x0
+  8037b5:	e8 0f d8 ff ff       	call   800fc9 <sys_page_unmap>
+}
+  8037ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037bd:	5b                   	pop    %ebx
+  8037be:	5e                   	pop    %esi
+  8037bf:	5d                   	pop    %ebp
+  8037c0:	c3                   	ret
+
+008037c1 <_pipeisclosed>:
+{
+  8037c1:	55                   	push   %ebp
+  8037c2:	89 e5                	mov    %esp,%ebp
+  8037c4:	57                   	push   %edi
+  8037c5:	56                   	push   %esi
+  8037c6:	53                   	push   %ebx
+  8037c7:	83 ec 1c             	sub    $0x1c,%esp
+  8037ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037cd:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037cf:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8037d4:	eb 5d                	jmp    803833 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8037d6:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		n = thisenv->env_runs;
+  8037dc:	8b 02                	mov    (%edx),%eax
+  8037de:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8037e1:	83 ec 0c             	sub    $0xc,%esp
+  8037e4:	ff 75 e0             	push   -0x20(%ebp)
+  8037e7:	e8 1f 14 00 00       	call   804c0b <pageref>
+  8037ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037ef:	89 3c 24             	mov    %edi,(%esp)
+  8037f2:	e8 14 14 00 00       	call   804c0b <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8037f7:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037f9:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8037ff:	83 c4 10             	add    $0x10,%esp
+  803802:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803808:	77 15                	ja     80381f <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80380a:	89 f2                	mov    %esi,%edx
+  80380c:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80380e:	c1 ea 10             	shr    $0x10,%edx
+  803811:	74 0c                	je     80381f <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803813:	c1 e2 10             	shl    $0x10,%edx
+  803816:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80381b:	29 d1                	sub    %edx,%ecx
+  80381d:	eb 06                	jmp    803825 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80381f:	8b 0d 30 9a 80 00    	mov    0x809a30,%ecx
+		nn = thisenv->env_runs;
+  803825:	8b 11                	mov    (%ecx),%edx
+  803827:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80382a:	39 d3                	cmp    %edx,%ebx
+  80382c:	74 6e                	je     80389c <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80382e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803831:	74 24                	je     803857 <_pipeisclosed+0x96>
+  803833:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803835:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80383b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803840:	77 94                	ja     8037d6 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803842:	89 f0                	mov    %esi,%eax
+  803844:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803846:	c1 e8 10             	shr    $0x10,%eax
+  803849:	74 8b                	je     8037d6 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80384b:	c1 e0 10             	shl    $0x10,%eax
+  80384e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803853:	29 c2                	sub    %eax,%edx
+  803855:	eb 85                	jmp    8037dc <_pipeisclosed+0x1b>
+  803857:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803859:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80385f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803864:	77 18                	ja     80387e <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803866:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80386b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80386d:	c1 e8 10             	shr    $0x10,%eax
+  803870:	74 0c                	je     80387e <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803872:	c1 e0 10             	shl    $0x10,%eax
+  803875:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80387a:	29 c2                	sub    %eax,%edx
+  80387c:	eb 06                	jmp    803884 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80387e:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803884:	8b 02                	mov    (%edx),%eax
+  803886:	8b 40 58             	mov    0x58(%eax),%eax
+  803889:	6a 01                	push   $0x1
+  80388b:	50                   	push   %eax
+  80388c:	53                   	push   %ebx
+  80388d:	68 5e 56 80 00       	push   $0x80565e
+  803892:	e8 77 cc ff ff       	call   80050e <cprintf>
+  803897:	83 c4 10             	add    $0x10,%esp
+  80389a:	eb 97                	jmp    803833 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80389c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80389f:	0f 94 c0             	sete   %al
+  8038a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8038a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038a8:	5b                   	pop    %ebx
+  8038a9:	5e                   	pop    %esi
+  8038aa:	5f                   	pop    %edi
+  8038ab:	5d                   	pop    %ebp
+  8038ac:	c3                   	ret
+
+008038ad <devpipe_write>:
+{
+  8038ad:	55                   	push   %ebp
+  8038ae:	89 e5                	mov    %esp,%ebp
+  8038b0:	57                   	push   %edi
+  8038b1:	56                   	push   %esi
+  8038b2:	53                   	push   %ebx
+  8038b3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8038b6:	ff 75 08             	push   0x8(%ebp)
+  8038b9:	e8 24 db ff ff       	call   8013e2 <fd2data>
+  8038be:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8038c0:	83 c4 10             	add    $0x10,%esp
+  8038c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038ca:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8038cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038d0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038d3:	0f 84 96 00 00 00    	je     80396f <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038d9:	8d 73 08             	lea    0x8(%ebx),%esi
+  8038dc:	eb 32                	jmp    803910 <devpipe_write+0x63>
+  8038de:	89 fa                	mov    %edi,%edx
+  8038e0:	89 f0                	mov    %esi,%eax
+  8038e2:	e8 69 fe ff ff       	call   803750 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8038e7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038ea:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8038ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038f2:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8038f7:	83 ec 04             	sub    $0x4,%esp
+  8038fa:	6a 0a                	push   $0xa
+  8038fc:	50                   	push   %eax
+  8038fd:	53                   	push   %ebx
+  8038fe:	e8 42 d9 ff ff       	call   801245 <sys_futex_wait>
+  803903:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803908:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80390d:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803910:	8b 43 04             	mov    0x4(%ebx),%eax
+  803913:	8b 0b                	mov    (%ebx),%ecx
+  803915:	8d 51 20             	lea    0x20(%ecx),%edx
+  803918:	39 d0                	cmp    %edx,%eax
+  80391a:	72 1b                	jb     803937 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80391c:	89 da                	mov    %ebx,%edx
+  80391e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803921:	e8 9b fe ff ff       	call   8037c1 <_pipeisclosed>
+  803926:	85 c0                	test   %eax,%eax
+  803928:	74 b4                	je     8038de <devpipe_write+0x31>
+				return 0;
+  80392a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80392f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803932:	5b                   	pop    %ebx
+  803933:	5e                   	pop    %esi
+  803934:	5f                   	pop    %edi
+  803935:	5d                   	pop    %ebp
+  803936:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803937:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80393a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80393d:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803941:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803944:	89 c2                	mov    %eax,%edx
+  803946:	c1 fa 1f             	sar    $0x1f,%edx
+  803949:	89 d1                	mov    %edx,%ecx
+  80394b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80394e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803951:	83 e2 1f             	and    $0x1f,%edx
+  803954:	29 ca                	sub    %ecx,%edx
+  803956:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80395a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80395e:	83 c0 01             	add    $0x1,%eax
+  803961:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803964:	83 c6 01             	add    $0x1,%esi
+  803967:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80396a:	e9 5e ff ff ff       	jmp    8038cd <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80396f:	8d 53 04             	lea    0x4(%ebx),%edx
+  803972:	8d 43 08             	lea    0x8(%ebx),%eax
+  803975:	e8 d6 fd ff ff       	call   803750 <pipewake>
+	return i;
+  80397a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80397d:	eb b0                	jmp    80392f <devpipe_write+0x82>
+
+0080397f <devpipe_read>:
+{
+  80397f:	55                   	push   %ebp
+  803980:	89 e5                	mov    %esp,%ebp
+  803982:	57                   	push   %edi
+  803983:	56                   	push   %esi
+  803984:	53                   	push   %ebx
+  803985:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803988:	ff 75 08             	push   0x8(%ebp)
+  80398b:	e8 52 da ff ff       	call   8013e2 <fd2data>
+  803990:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803992:	83 c4 10             	add    $0x10,%esp
+  803995:	be 00 00 00 00       	mov    $0x0,%esi
+  80399a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80399d:	74 6c                	je     803a0b <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80399f:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8039a2:	eb 25                	jmp    8039c9 <devpipe_read+0x4a>
+  8039a4:	8b 13                	mov    (%ebx),%edx
+  8039a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039ab:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8039b0:	83 ec 04             	sub    $0x4,%esp
+  8039b3:	6a 0a                	push   $0xa
+  8039b5:	52                   	push   %edx
+  8039b6:	57                   	push   %edi
+  8039b7:	e8 89 d8 ff ff       	call   801245 <sys_futex_wait>
+  8039bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8039c1:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8039c6:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8039c9:	8b 03                	mov    (%ebx),%eax
+  8039cb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8039ce:	75 19                	jne    8039e9 <devpipe_read+0x6a>
+			if (i > 0)
+  8039d0:	85 f6                	test   %esi,%esi
+  8039d2:	75 3a                	jne    803a0e <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8039d4:	89 da                	mov    %ebx,%edx
+  8039d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039d9:	e8 e3 fd ff ff       	call   8037c1 <_pipeisclosed>
+  8039de:	85 c0                	test   %eax,%eax
+  8039e0:	74 c2                	je     8039a4 <devpipe_read+0x25>
+				return 0;
+  8039e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e7:	eb 31                	jmp    803a1a <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8039e9:	89 c1                	mov    %eax,%ecx
+  8039eb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8039ee:	c1 e9 1b             	shr    $0x1b,%ecx
+  8039f1:	01 c8                	add    %ecx,%eax
+  8039f3:	83 e0 1f             	and    $0x1f,%eax
+  8039f6:	29 c8                	sub    %ecx,%eax
+  8039f8:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8039fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a00:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803a03:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803a06:	83 c6 01             	add    $0x1,%esi
+  803a09:	eb 8f                	jmp    80399a <devpipe_read+0x1b>
+out:
+  803a0b:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803a0e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803a11:	89 da                	mov    %ebx,%edx
+  803a13:	e8 38 fd ff ff       	call   803750 <pipewake>
+	return i;
+  803a18:	89 f0                	mov    %esi,%eax
+}
+  803a1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a1d:	5b                   	pop    %ebx
+  803a1e:	5e                   	pop    %esi
+  803a1f:	5f                   	pop    %edi
+  803a20:	5d                   	pop    %ebp
+  803a21:	c3                   	ret
+
+00803a22 <pipe>:
+{
+  803a22:	55                   	push   %ebp
+  803a23:	89 e5                	mov    %esp,%ebp
+  803a25:	56                   	push   %esi
+  803a26:	53                   	push   %ebx
+  803a27:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a2d:	50                   	push   %eax
+  803a2e:	e8 c6 d9 ff ff       	call   8013f9 <fd_alloc>
+  803a33:	89 c3                	mov    %eax,%ebx
+  803a35:	83 c4 10             	add    $0x10,%esp
+  803a38:	85 c0                	test   %eax,%eax
+  803a3a:	0f 88 23 01 00 00    	js     803b63 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a40:	83 ec 04             	sub    $0x4,%esp
+  803a43:	68 07 04 00 00       	push   $0x407
+  803a48:	ff 75 f4             	push   -0xc(%ebp)
+  803a4b:	6a 00                	push   $0x0
+  803a4d:	e8 de d4 ff ff       	call   800f30 <sys_page_alloc>
+  803a52:	89 c3                	mov    %eax,%ebx
+  803a54:	83 c4 10             	add    $0x10,%esp
+  803a57:	85 c0                	test   %eax,%eax
+  803a59:	0f 88 04 01 00 00    	js     803b63 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a5f:	83 ec 0c             	sub    $0xc,%esp
+  803a62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a65:	50                   	push   %eax
+  803a66:	e8 8e d9 ff ff       	call   8013f9 <fd_alloc>
+  803a6b:	89 c3                	mov    %eax,%ebx
+  803a6d:	83 c4 10             	add    $0x10,%esp
+  803a70:	85 c0                	test   %eax,%eax
+  803a72:	0f 88 db 00 00 00    	js     803b53 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a78:	83 ec 04             	sub    $0x4,%esp
+  803a7b:	68 07 04 00 00       	push   $0x407
+  803a80:	ff 75 f0             	push   -0x10(%ebp)
+  803a83:	6a 00                	push   $0x0
+  803a85:	e8 a6 d4 ff ff       	call   800f30 <sys_page_alloc>
+  803a8a:	89 c3                	mov    %eax,%ebx
+  803a8c:	83 c4 10             	add    $0x10,%esp
+  803a8f:	85 c0                	test   %eax,%eax
+  803a91:	0f 88 bc 00 00 00    	js     803b53 <pipe+0x131>
+	va = fd2data(fd0);
+  803a97:	83 ec 0c             	sub    $0xc,%esp
+  803a9a:	ff 75 f4             	push   -0xc(%ebp)
+  803a9d:	e8 40 d9 ff ff       	call   8013e2 <fd2data>
+  803aa2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803aa4:	83 c4 0c             	add    $0xc,%esp
+  803aa7:	68 07 04 00 00       	push   $0x407
+  803aac:	50                   	push   %eax
+  803aad:	6a 00                	push   $0x0
+  803aaf:	e8 7c d4 ff ff       	call   800f30 <sys_page_alloc>
+  803ab4:	89 c3                	mov    %eax,%ebx
+  803ab6:	83 c4 10             	add    $0x10,%esp
+  803ab9:	85 c0                	test   %eax,%eax
+  803abb:	0f 88 82 00 00 00    	js     803b43 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ac1:	83 ec 0c             	sub    $0xc,%esp
+  803ac4:	ff 75 f0             	push   -0x10(%ebp)
+  803ac7:	e8 16 d9 ff ff       	call   8013e2 <fd2data>
+  803acc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803ad3:	50                   	push   %eax
+  803ad4:	6a 00                	push   $0x0
+  803ad6:	56                   	push   %esi
+  803ad7:	6a 00                	push   $0x0
+  803ad9:	e8 9f d4 ff ff       	call   800f7d <sys_page_map>
+  803ade:	89 c3                	mov    %eax,%ebx
+  803ae0:	83 c4 20             	add    $0x20,%esp
+  803ae3:	85 c0                	test   %eax,%eax
+  803ae5:	78 4e                	js     803b35 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803ae7:	a1 1c 7a 80 00       	mov    0x807a1c,%eax
+  803aec:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803aef:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803af1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803af4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803afb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803afe:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b03:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b0a:	83 ec 0c             	sub    $0xc,%esp
+  803b0d:	ff 75 f4             	push   -0xc(%ebp)
+  803b10:	e8 bd d8 ff ff       	call   8013d2 <fd2num>
+  803b15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b18:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b1a:	83 c4 04             	add    $0x4,%esp
+  803b1d:	ff 75 f0             	push   -0x10(%ebp)
+  803b20:	e8 ad d8 ff ff       	call   8013d2 <fd2num>
+  803b25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b28:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b2b:	83 c4 10             	add    $0x10,%esp
+  803b2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b33:	eb 2e                	jmp    803b63 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b35:	83 ec 08             	sub    $0x8,%esp
+  803b38:	56                   	push   %esi
+  803b39:	6a 00                	push   $0x0
+  803b3b:	e8 89 d4 ff ff       	call   800fc9 <sys_page_unmap>
+  803b40:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b43:	83 ec 08             	sub    $0x8,%esp
+  803b46:	ff 75 f0             	push   -0x10(%ebp)
+  803b49:	6a 00                	push   $0x0
+  803b4b:	e8 79 d4 ff ff       	call   800fc9 <sys_page_unmap>
+  803b50:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b53:	83 ec 08             	sub    $0x8,%esp
+  803b56:	ff 75 f4             	push   -0xc(%ebp)
+  803b59:	6a 00                	push   $0x0
+  803b5b:	e8 69 d4 ff ff       	call   800fc9 <sys_page_unmap>
+  803b60:	83 c4 10             	add    $0x10,%esp
+}
+  803b63:	89 d8                	mov    %ebx,%eax
+  803b65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b68:	5b                   	pop    %ebx
+  803b69:	5e                   	pop    %esi
+  803b6a:	5d                   	pop    %ebp
+  803b6b:	c3                   	ret
+
+00803b6c <pipeisclosed>:
+{
+  803b6c:	55                   	push   %ebp
+  803b6d:	89 e5                	mov    %esp,%ebp
+  803b6f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b75:	50                   	push   %eax
+  803b76:	ff 75 08             	push   0x8(%ebp)
+  803b79:	e8 d1 d8 ff ff       	call   80144f <fd_lookup>
+  803b7e:	83 c4 10             	add    $0x10,%esp
+  803b81:	85 c0                	test   %eax,%eax
+  803b83:	78 18                	js     803b9d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b85:	83 ec 0c             	sub    $0xc,%esp
+  803b88:	ff 75 f4             	push   -0xc(%ebp)
+  803b8b:	e8 52 d8 ff ff       	call   8013e2 <fd2data>
+  803b90:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b95:	e8 27 fc ff ff       	call   8037c1 <_pipeisclosed>
+  803b9a:	83 c4 10             	add    $0x10,%esp
+}
+  803b9d:	c9                   	leave
+  803b9e:	c3                   	ret
+
+00803b9f <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803b9f:	55                   	push   %ebp
+  803ba0:	89 e5                	mov    %esp,%ebp
+  803ba2:	56                   	push   %esi
+  803ba3:	53                   	push   %ebx
+  803ba4:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803ba7:	85 f6                	test   %esi,%esi
+  803ba9:	74 15                	je     803bc0 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803bab:	89 f0                	mov    %esi,%eax
+  803bad:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803bb2:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803bb5:	c1 e3 04             	shl    $0x4,%ebx
+  803bb8:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803bbe:	eb 1b                	jmp    803bdb <wait+0x3c>
+	assert(envid != 0);
+  803bc0:	68 76 56 80 00       	push   $0x805676
+  803bc5:	68 dd 54 80 00       	push   $0x8054dd
+  803bca:	6a 09                	push   $0x9
+  803bcc:	68 81 56 80 00       	push   $0x805681
+  803bd1:	e8 5d c8 ff ff       	call   800433 <_panic>
+		sys_yield();
+  803bd6:	e8 29 d3 ff ff       	call   800f04 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803bdb:	8b 43 48             	mov    0x48(%ebx),%eax
+  803bde:	39 f0                	cmp    %esi,%eax
+  803be0:	75 07                	jne    803be9 <wait+0x4a>
+  803be2:	8b 43 54             	mov    0x54(%ebx),%eax
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	75 ed                	jne    803bd6 <wait+0x37>
+}
+  803be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bec:	5b                   	pop    %ebx
+  803bed:	5e                   	pop    %esi
+  803bee:	5d                   	pop    %ebp
+  803bef:	c3                   	ret
+
+00803bf0 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803bf0:	55                   	push   %ebp
+  803bf1:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bf6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bfc:	5d                   	pop    %ebp
+  803bfd:	c3                   	ret
+
+00803bfe <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803bfe:	55                   	push   %ebp
+  803bff:	89 e5                	mov    %esp,%ebp
+  803c01:	56                   	push   %esi
+  803c02:	53                   	push   %ebx
+  803c03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c10:	89 d0                	mov    %edx,%eax
+  803c12:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803c16:	85 c0                	test   %eax,%eax
+  803c18:	74 2d                	je     803c47 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803c1a:	83 f8 02             	cmp    $0x2,%eax
+  803c1d:	74 08                	je     803c27 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803c1f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803c24:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c27:	be 02 00 00 00       	mov    $0x2,%esi
+  803c2c:	eb 15                	jmp    803c43 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c2e:	83 ec 04             	sub    $0x4,%esp
+  803c31:	6a 00                	push   $0x0
+  803c33:	6a 02                	push   $0x2
+  803c35:	53                   	push   %ebx
+  803c36:	e8 0a d6 ff ff       	call   801245 <sys_futex_wait>
+  803c3b:	89 f0                	mov    %esi,%eax
+  803c3d:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c40:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	75 e7                	jne    803c2e <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803c47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c4a:	5b                   	pop    %ebx
+  803c4b:	5e                   	pop    %esi
+  803c4c:	5d                   	pop    %ebp
+  803c4d:	c3                   	ret
+
+00803c4e <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803c4e:	55                   	push   %ebp
+  803c4f:	89 e5                	mov    %esp,%ebp
+  803c51:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c59:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c5e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803c62:	f7 d8                	neg    %eax
+  803c64:	19 c0                	sbb    %eax,%eax
+  803c66:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803c69:	5d                   	pop    %ebp
+  803c6a:	c3                   	ret
+
+00803c6b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803c6b:	55                   	push   %ebp
+  803c6c:	89 e5                	mov    %esp,%ebp
+  803c6e:	83 ec 08             	sub    $0x8,%esp
+  803c71:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c79:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803c7c:	83 f8 02             	cmp    $0x2,%eax
+  803c7f:	74 02                	je     803c83 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803c81:	c9                   	leave
+  803c82:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803c83:	83 ec 08             	sub    $0x8,%esp
+  803c86:	6a 01                	push   $0x1
+  803c88:	52                   	push   %edx
+  803c89:	e8 e6 d5 ff ff       	call   801274 <sys_futex_wake>
+  803c8e:	83 c4 10             	add    $0x10,%esp
+}
+  803c91:	eb ee                	jmp    803c81 <mutex_unlock+0x16>
+
+00803c93 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803c93:	55                   	push   %ebp
+  803c94:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c99:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c9f:	5d                   	pop    %ebp
+  803ca0:	c3                   	ret
+
+00803ca1 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803ca1:	55                   	push   %ebp
+  803ca2:	89 e5                	mov    %esp,%ebp
+  803ca4:	57                   	push   %edi
+  803ca5:	56                   	push   %esi
+  803ca6:	53                   	push   %ebx
+  803ca7:	83 ec 18             	sub    $0x18,%esp
+  803caa:	8b 75 08             	mov    0x8(%ebp),%esi
+  803cad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803cb0:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803cb2:	53                   	push   %ebx
+  803cb3:	e8 b3 ff ff ff       	call   803c6b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803cb8:	83 c4 0c             	add    $0xc,%esp
+  803cbb:	ff 75 10             	push   0x10(%ebp)
+  803cbe:	57                   	push   %edi
+  803cbf:	56                   	push   %esi
+  803cc0:	e8 80 d5 ff ff       	call   801245 <sys_futex_wait>
+  803cc5:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803cc7:	83 c4 10             	add    $0x10,%esp
+  803cca:	be 02 00 00 00       	mov    $0x2,%esi
+  803ccf:	eb 10                	jmp    803ce1 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803cd1:	83 ec 04             	sub    $0x4,%esp
+  803cd4:	6a 00                	push   $0x0
+  803cd6:	6a 02                	push   $0x2
+  803cd8:	53                   	push   %ebx
+  803cd9:	e8 67 d5 ff ff       	call   801245 <sys_futex_wait>
+  803cde:	83 c4 10             	add    $0x10,%esp
+  803ce1:	89 f0                	mov    %esi,%eax
+  803ce3:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803ce6:	85 c0                	test   %eax,%eax
+  803ce8:	75 e7                	jne    803cd1 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803cea:	83 ff ec             	cmp    $0xffffffec,%edi
+  803ced:	74 05                	je     803cf4 <cond_timedwait+0x53>
+  803cef:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803cf4:	89 f8                	mov    %edi,%eax
+  803cf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cf9:	5b                   	pop    %ebx
+  803cfa:	5e                   	pop    %esi
+  803cfb:	5f                   	pop    %edi
+  803cfc:	5d                   	pop    %ebp
+  803cfd:	c3                   	ret
+
+00803cfe <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803cfe:	55                   	push   %ebp
+  803cff:	89 e5                	mov    %esp,%ebp
+  803d01:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803d04:	6a 00                	push   $0x0
+  803d06:	ff 75 0c             	push   0xc(%ebp)
+  803d09:	ff 75 08             	push   0x8(%ebp)
+  803d0c:	e8 90 ff ff ff       	call   803ca1 <cond_timedwait>
+}
+  803d11:	83 c4 10             	add    $0x10,%esp
+  803d14:	c9                   	leave
+  803d15:	c3                   	ret
+
+00803d16 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803d16:	55                   	push   %ebp
+  803d17:	89 e5                	mov    %esp,%ebp
+  803d19:	83 ec 10             	sub    $0x10,%esp
+  803d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803d1f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d24:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803d28:	6a 01                	push   $0x1
+  803d2a:	50                   	push   %eax
+  803d2b:	e8 44 d5 ff ff       	call   801274 <sys_futex_wake>
+}
+  803d30:	83 c4 10             	add    $0x10,%esp
+  803d33:	c9                   	leave
+  803d34:	c3                   	ret
+
+00803d35 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803d35:	55                   	push   %ebp
+  803d36:	89 e5                	mov    %esp,%ebp
+  803d38:	83 ec 10             	sub    $0x10,%esp
+  803d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d43:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803d47:	68 00 04 00 00       	push   $0x400
+  803d4c:	50                   	push   %eax
+  803d4d:	e8 22 d5 ff ff       	call   801274 <sys_futex_wake>
+}
+  803d52:	83 c4 10             	add    $0x10,%esp
+  803d55:	c9                   	leave
+  803d56:	c3                   	ret
+
+00803d57 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803d57:	55                   	push   %ebp
+  803d58:	89 e5                	mov    %esp,%ebp
+  803d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803d5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d60:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803d62:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803d69:	5d                   	pop    %ebp
+  803d6a:	c3                   	ret
+
+00803d6b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803d6b:	55                   	push   %ebp
+  803d6c:	89 e5                	mov    %esp,%ebp
+  803d6e:	53                   	push   %ebx
+  803d6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803d72:	8b 11                	mov    (%ecx),%edx
+  803d74:	85 d2                	test   %edx,%edx
+  803d76:	74 14                	je     803d8c <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803d78:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d7b:	89 d0                	mov    %edx,%eax
+  803d7d:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803d81:	39 c2                	cmp    %eax,%edx
+  803d83:	75 ed                	jne    803d72 <sem_trywait+0x7>
+			return 0;
+  803d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8a:	eb 05                	jmp    803d91 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803d8c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d94:	c9                   	leave
+  803d95:	c3                   	ret
+
+00803d96 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803d96:	55                   	push   %ebp
+  803d97:	89 e5                	mov    %esp,%ebp
+  803d99:	57                   	push   %edi
+  803d9a:	56                   	push   %esi
+  803d9b:	53                   	push   %ebx
+  803d9c:	83 ec 1c             	sub    $0x1c,%esp
+  803d9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803da2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803da5:	e8 13 d4 ff ff       	call   8011bd <sys_time_msec>
+  803daa:	01 f8                	add    %edi,%eax
+  803dac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803daf:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803db4:	eb 28                	jmp    803dde <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803db6:	b8 01 00 00 00       	mov    $0x1,%eax
+  803dbb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803dc0:	83 ec 04             	sub    $0x4,%esp
+  803dc3:	56                   	push   %esi
+  803dc4:	6a 00                	push   $0x0
+  803dc6:	53                   	push   %ebx
+  803dc7:	e8 79 d4 ff ff       	call   801245 <sys_futex_wait>
+  803dcc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803dd1:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803dd6:	83 c4 10             	add    $0x10,%esp
+  803dd9:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803ddc:	74 2e                	je     803e0c <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803dde:	83 ec 0c             	sub    $0xc,%esp
+  803de1:	53                   	push   %ebx
+  803de2:	e8 84 ff ff ff       	call   803d6b <sem_trywait>
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	79 19                	jns    803e07 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803dee:	85 ff                	test   %edi,%edi
+  803df0:	74 c4                	je     803db6 <sem_timedwait+0x20>
+  803df2:	e8 c6 d3 ff ff       	call   8011bd <sys_time_msec>
+  803df7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803dfa:	29 c6                	sub    %eax,%esi
+  803dfc:	85 f6                	test   %esi,%esi
+  803dfe:	7f b6                	jg     803db6 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803e00:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803e05:	eb 05                	jmp    803e0c <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803e07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e0f:	5b                   	pop    %ebx
+  803e10:	5e                   	pop    %esi
+  803e11:	5f                   	pop    %edi
+  803e12:	5d                   	pop    %ebp
+  803e13:	c3                   	ret
+
+00803e14 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803e14:	55                   	push   %ebp
+  803e15:	89 e5                	mov    %esp,%ebp
+  803e17:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803e1a:	6a 00                	push   $0x0
+  803e1c:	ff 75 08             	push   0x8(%ebp)
+  803e1f:	e8 72 ff ff ff       	call   803d96 <sem_timedwait>
+}
+  803e24:	83 c4 10             	add    $0x10,%esp
+  803e27:	c9                   	leave
+  803e28:	c3                   	ret
+
+00803e29 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803e29:	55                   	push   %ebp
+  803e2a:	89 e5                	mov    %esp,%ebp
+  803e2c:	83 ec 08             	sub    $0x8,%esp
+  803e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e32:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e37:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803e3b:	8b 50 04             	mov    0x4(%eax),%edx
+  803e3e:	85 d2                	test   %edx,%edx
+  803e40:	75 02                	jne    803e44 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803e42:	c9                   	leave
+  803e43:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803e44:	83 ec 08             	sub    $0x8,%esp
+  803e47:	6a 01                	push   $0x1
+  803e49:	50                   	push   %eax
+  803e4a:	e8 25 d4 ff ff       	call   801274 <sys_futex_wake>
+  803e4f:	83 c4 10             	add    $0x10,%esp
+}
+  803e52:	eb ee                	jmp    803e42 <sem_post+0x19>
+
+00803e54 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803e54:	55                   	push   %ebp
+  803e55:	89 e5                	mov    %esp,%ebp
+  803e57:	57                   	push   %edi
+  803e58:	56                   	push   %esi
+  803e59:	53                   	push   %ebx
+  803e5a:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803e5d:	68 20 80 80 00       	push   $0x808020
+  803e62:	e8 97 fd ff ff       	call   803bfe <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803e67:	a1 44 80 80 00       	mov    0x808044,%eax
+  803e6c:	83 c4 10             	add    $0x10,%esp
+  803e6f:	85 c0                	test   %eax,%eax
+  803e71:	75 19                	jne    803e8c <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803e73:	a1 30 9a 80 00       	mov    0x809a30,%eax
+  803e78:	8b 00                	mov    (%eax),%eax
+  803e7a:	8b 40 48             	mov    0x48(%eax),%eax
+  803e7d:	a3 40 80 80 00       	mov    %eax,0x808040
+		threads[0].th_state = PTH_RUNNING;
+  803e82:	c7 05 44 80 80 00 01 	movl   $0x1,0x808044
+  803e89:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803e8c:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803e91:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e94:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  803e9b:	8b 40 04             	mov    0x4(%eax),%eax
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	0f 84 e4 00 00 00    	je     803f8a <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803ea6:	83 c3 01             	add    $0x1,%ebx
+  803ea9:	83 fb 20             	cmp    $0x20,%ebx
+  803eac:	75 e3                	jne    803e91 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803eae:	83 ec 0c             	sub    $0xc,%esp
+  803eb1:	68 20 80 80 00       	push   $0x808020
+  803eb6:	e8 b0 fd ff ff       	call   803c6b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803ebb:	83 c4 10             	add    $0x10,%esp
+  803ebe:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803ec3:	e9 b8 00 00 00       	jmp    803f80 <pthread_create+0x12c>
+  803ec8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803ecb:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803ece:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803ed0:	39 f3                	cmp    %esi,%ebx
+  803ed2:	73 16                	jae    803eea <pthread_create+0x96>
+		va -= PGSIZE;
+  803ed4:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803eda:	83 ec 08             	sub    $0x8,%esp
+  803edd:	56                   	push   %esi
+  803ede:	6a 00                	push   $0x0
+  803ee0:	e8 e4 d0 ff ff       	call   800fc9 <sys_page_unmap>
+  803ee5:	83 c4 10             	add    $0x10,%esp
+  803ee8:	eb e6                	jmp    803ed0 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803eea:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803eed:	83 ec 08             	sub    $0x8,%esp
+  803ef0:	ff 75 e4             	push   -0x1c(%ebp)
+  803ef3:	6a 00                	push   $0x0
+  803ef5:	e8 cf d0 ff ff       	call   800fc9 <sys_page_unmap>
+	return r;
+  803efa:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803efd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f00:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  803f07:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803f0e:	eb 70                	jmp    803f80 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803f10:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f13:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  803f1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f1d:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803f20:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f23:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803f26:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803f2d:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803f32:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803f35:	29 c8                	sub    %ecx,%eax
+  803f37:	85 db                	test   %ebx,%ebx
+  803f39:	0f 44 05 30 9a 80 00 	cmove  0x809a30,%eax
+	*--esp = t;
+  803f40:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803f43:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f4a:	83 ec 04             	sub    $0x4,%esp
+  803f4d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f52:	29 ca                	sub    %ecx,%edx
+  803f54:	52                   	push   %edx
+	*--esp = 0;
+  803f55:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f58:	50                   	push   %eax
+  803f59:	68 b1 41 80 00       	push   $0x8041b1
+  803f5e:	e8 b6 d3 ff ff       	call   801319 <sys_thread_create>
+  803f63:	89 c7                	mov    %eax,%edi
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	78 91                	js     803efd <pthread_create+0xa9>
+	th->th_env = id;
+  803f6c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f6f:	89 3c 85 40 80 80 00 	mov    %edi,0x808040(,%eax,4)
+	*tp = t;
+  803f76:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f79:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803f80:	89 f8                	mov    %edi,%eax
+  803f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f85:	5b                   	pop    %ebx
+  803f86:	5e                   	pop    %esi
+  803f87:	5f                   	pop    %edi
+  803f88:	5d                   	pop    %ebp
+  803f89:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803f8a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f8d:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  803f94:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803f9b:	83 ec 0c             	sub    $0xc,%esp
+  803f9e:	68 20 80 80 00       	push   $0x808020
+  803fa3:	e8 c3 fc ff ff       	call   803c6b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803fa8:	89 d9                	mov    %ebx,%ecx
+  803faa:	c1 e1 10             	shl    $0x10,%ecx
+  803fad:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803fb0:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803fb5:	29 c8                	sub    %ecx,%eax
+  803fb7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803fba:	c1 e8 16             	shr    $0x16,%eax
+  803fbd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803fc4:	83 c4 10             	add    $0x10,%esp
+  803fc7:	a8 01                	test   $0x1,%al
+  803fc9:	74 15                	je     803fe0 <pthread_create+0x18c>
+  803fcb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fce:	c1 e8 0c             	shr    $0xc,%eax
+  803fd1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803fd8:	a8 01                	test   $0x1,%al
+  803fda:	0f 85 30 ff ff ff    	jne    803f10 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803fe0:	83 ec 04             	sub    $0x4,%esp
+  803fe3:	6a 07                	push   $0x7
+  803fe5:	ff 75 e4             	push   -0x1c(%ebp)
+  803fe8:	6a 00                	push   $0x0
+  803fea:	e8 41 cf ff ff       	call   800f30 <sys_page_alloc>
+  803fef:	89 c7                	mov    %eax,%edi
+  803ff1:	83 c4 10             	add    $0x10,%esp
+  803ff4:	85 c0                	test   %eax,%eax
+  803ff6:	0f 88 01 ff ff ff    	js     803efd <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803ffc:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  804001:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804004:	29 d0                	sub    %edx,%eax
+  804006:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804009:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80400b:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  804010:	29 d0                	sub    %edx,%eax
+  804012:	89 c7                	mov    %eax,%edi
+  804014:	39 fe                	cmp    %edi,%esi
+  804016:	0f 83 f4 fe ff ff    	jae    803f10 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80401c:	83 ec 04             	sub    $0x4,%esp
+  80401f:	6a 07                	push   $0x7
+  804021:	56                   	push   %esi
+  804022:	6a 00                	push   $0x0
+  804024:	e8 07 cf ff ff       	call   800f30 <sys_page_alloc>
+  804029:	83 c4 10             	add    $0x10,%esp
+  80402c:	85 c0                	test   %eax,%eax
+  80402e:	0f 88 94 fe ff ff    	js     803ec8 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804034:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80403a:	eb d8                	jmp    804014 <pthread_create+0x1c0>
+
+0080403c <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80403c:	55                   	push   %ebp
+  80403d:	89 e5                	mov    %esp,%ebp
+  80403f:	57                   	push   %edi
+  804040:	56                   	push   %esi
+  804041:	53                   	push   %ebx
+  804042:	83 ec 0c             	sub    $0xc,%esp
+  804045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  804048:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80404b:	83 f8 1e             	cmp    $0x1e,%eax
+  80404e:	0f 87 c7 00 00 00    	ja     80411b <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804054:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804056:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80405c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804061:	77 12                	ja     804075 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804063:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804068:	29 d0                	sub    %edx,%eax
+  80406a:	c1 e8 10             	shr    $0x10,%eax
+  80406d:	39 c3                	cmp    %eax,%ebx
+  80406f:	0f 84 ad 00 00 00    	je     804122 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804075:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804078:	8d 3c 85 44 80 80 00 	lea    0x808044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80407f:	8d 34 85 40 80 80 00 	lea    0x808040(,%eax,4),%esi
+  804086:	eb 10                	jmp    804098 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804088:	83 ec 04             	sub    $0x4,%esp
+  80408b:	6a 00                	push   $0x0
+  80408d:	6a 01                	push   $0x1
+  80408f:	57                   	push   %edi
+  804090:	e8 b0 d1 ff ff       	call   801245 <sys_futex_wait>
+  804095:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  804098:	8b 46 04             	mov    0x4(%esi),%eax
+  80409b:	83 f8 01             	cmp    $0x1,%eax
+  80409e:	74 e8                	je     804088 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8040a0:	83 f8 02             	cmp    $0x2,%eax
+  8040a3:	0f 85 80 00 00 00    	jne    804129 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040a9:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8040ac:	c1 e6 02             	shl    $0x2,%esi
+  8040af:	eb 05                	jmp    8040b6 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8040b1:	e8 4e ce ff ff       	call   800f04 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040b6:	8b 8e 40 80 80 00    	mov    0x808040(%esi),%ecx
+  8040bc:	89 ca                	mov    %ecx,%edx
+  8040be:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8040c4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040c7:	c1 e0 04             	shl    $0x4,%eax
+  8040ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040cf:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8040d2:	39 c1                	cmp    %eax,%ecx
+  8040d4:	75 12                	jne    8040e8 <pthread_join+0xac>
+  8040d6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040d9:	c1 e0 04             	shl    $0x4,%eax
+  8040dc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040e1:	8b 40 54             	mov    0x54(%eax),%eax
+  8040e4:	85 c0                	test   %eax,%eax
+  8040e6:	75 c9                	jne    8040b1 <pthread_join+0x75>
+	if (ret_store)
+  8040e8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8040ec:	74 0f                	je     8040fd <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8040ee:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040f1:	8b 04 85 50 80 80 00 	mov    0x808050(,%eax,4),%eax
+  8040f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040fb:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8040fd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804100:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  804107:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80410e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804116:	5b                   	pop    %ebx
+  804117:	5e                   	pop    %esi
+  804118:	5f                   	pop    %edi
+  804119:	5d                   	pop    %ebp
+  80411a:	c3                   	ret
+		return -E_INVAL;
+  80411b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804120:	eb f1                	jmp    804113 <pthread_join+0xd7>
+  804122:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804127:	eb ea                	jmp    804113 <pthread_join+0xd7>
+		return -E_INVAL;
+  804129:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80412e:	eb e3                	jmp    804113 <pthread_join+0xd7>
+
+00804130 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804130:	55                   	push   %ebp
+  804131:	89 e5                	mov    %esp,%ebp
+  804133:	53                   	push   %ebx
+  804134:	83 ec 04             	sub    $0x4,%esp
+  804137:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804139:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80413f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804144:	77 0c                	ja     804152 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804146:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80414b:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80414d:	c1 e8 10             	shr    $0x10,%eax
+  804150:	75 0a                	jne    80415c <pthread_exit+0x2c>
+		exit();
+  804152:	e8 b4 c2 ff ff       	call   80040b <exit>
+  804157:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80415c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804163:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804166:	8d 0c 8d 40 80 80 00 	lea    0x808040(,%ecx,4),%ecx
+  80416d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804170:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  804173:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80417a:	83 ec 08             	sub    $0x8,%esp
+  80417d:	6a 20                	push   $0x20
+  80417f:	01 c2                	add    %eax,%edx
+  804181:	8d 04 95 44 80 80 00 	lea    0x808044(,%edx,4),%eax
+  804188:	50                   	push   %eax
+  804189:	e8 e6 d0 ff ff       	call   801274 <sys_futex_wake>
+	sys_env_destroy(0);
+  80418e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804195:	e8 f3 cc ff ff       	call   800e8d <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80419a:	83 c4 0c             	add    $0xc,%esp
+  80419d:	68 8c 56 80 00       	push   $0x80568c
+  8041a2:	68 a5 00 00 00       	push   $0xa5
+  8041a7:	68 a6 56 80 00       	push   $0x8056a6
+  8041ac:	e8 82 c2 ff ff       	call   800433 <_panic>
+
+008041b1 <pthread_start>:
+{
+  8041b1:	55                   	push   %ebp
+  8041b2:	89 e5                	mov    %esp,%ebp
+  8041b4:	53                   	push   %ebx
+  8041b5:	83 ec 04             	sub    $0x4,%esp
+  8041b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8041bb:	e8 18 cd ff ff       	call   800ed8 <sys_getenvid>
+  8041c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8041c5:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+	if (t == 0)
+  8041cb:	85 db                	test   %ebx,%ebx
+  8041cd:	74 0c                	je     8041db <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041cf:	89 d9                	mov    %ebx,%ecx
+  8041d1:	c1 e1 10             	shl    $0x10,%ecx
+  8041d4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8041d9:	29 ca                	sub    %ecx,%edx
+  8041db:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8041de:	c1 e0 04             	shl    $0x4,%eax
+  8041e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041e6:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8041e8:	83 ec 0c             	sub    $0xc,%esp
+  8041eb:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8041f2:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8041f5:	ff 34 95 4c 80 80 00 	push   0x80804c(,%edx,4)
+  8041fc:	ff 14 95 48 80 80 00 	call   *0x808048(,%edx,4)
+  804203:	89 04 24             	mov    %eax,(%esp)
+  804206:	e8 25 ff ff ff       	call   804130 <pthread_exit>
+
+0080420b <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80420b:	55                   	push   %ebp
+  80420c:	89 e5                	mov    %esp,%ebp
+  80420e:	57                   	push   %edi
+  80420f:	56                   	push   %esi
+  804210:	53                   	push   %ebx
+  804211:	83 ec 1c             	sub    $0x1c,%esp
+  804214:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804216:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80421c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804223:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804228:	77 0d                	ja     804237 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80422a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80422f:	29 d0                	sub    %edx,%eax
+  804231:	c1 e8 10             	shr    $0x10,%eax
+  804234:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804237:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80423c:	eb 2f                	jmp    80426d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80423e:	8b 0d 30 9a 80 00    	mov    0x809a30,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804244:	8b 01                	mov    (%ecx),%eax
+  804246:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804249:	39 c2                	cmp    %eax,%edx
+  80424b:	75 14                	jne    804261 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80424d:	83 ec 0c             	sub    $0xc,%esp
+  804250:	57                   	push   %edi
+  804251:	e8 37 cc ff ff       	call   800e8d <sys_env_destroy>
+  804256:	83 c4 10             	add    $0x10,%esp
+  804259:	85 c0                	test   %eax,%eax
+  80425b:	0f 88 97 00 00 00    	js     8042f8 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804261:	83 c3 01             	add    $0x1,%ebx
+  804264:	83 fb 20             	cmp    $0x20,%ebx
+  804267:	0f 84 d2 00 00 00    	je     80433f <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80426d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804270:	74 ef                	je     804261 <pthread_kill_others+0x56>
+  804272:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804275:	8d 04 85 40 80 80 00 	lea    0x808040(,%eax,4),%eax
+  80427c:	8b 40 04             	mov    0x4(%eax),%eax
+  80427f:	83 f8 01             	cmp    $0x1,%eax
+  804282:	75 dd                	jne    804261 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804284:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804287:	8b 3c 85 40 80 80 00 	mov    0x808040(,%eax,4),%edi
+  80428e:	89 fe                	mov    %edi,%esi
+  804290:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804296:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804299:	c1 e0 04             	shl    $0x4,%eax
+  80429c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042a1:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042a4:	39 c7                	cmp    %eax,%edi
+  8042a6:	75 b9                	jne    804261 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042a8:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042ab:	c1 e0 04             	shl    $0x4,%eax
+  8042ae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042b3:	8b 40 54             	mov    0x54(%eax),%eax
+  8042b6:	85 c0                	test   %eax,%eax
+  8042b8:	74 a7                	je     804261 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042ba:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042bd:	c1 e0 04             	shl    $0x4,%eax
+  8042c0:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8042c6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042c8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8042ce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042d3:	0f 87 65 ff ff ff    	ja     80423e <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042de:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8042e0:	c1 e8 10             	shr    $0x10,%eax
+  8042e3:	0f 84 55 ff ff ff    	je     80423e <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042e9:	c1 e0 10             	shl    $0x10,%eax
+  8042ec:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8042f1:	29 c1                	sub    %eax,%ecx
+  8042f3:	e9 4c ff ff ff       	jmp    804244 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8042f8:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8042fb:	c1 e2 04             	shl    $0x4,%edx
+  8042fe:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804304:	8b 52 48             	mov    0x48(%edx),%edx
+  804307:	39 fa                	cmp    %edi,%edx
+  804309:	0f 85 52 ff ff ff    	jne    804261 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80430f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804312:	c1 e2 04             	shl    $0x4,%edx
+  804315:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80431b:	8b 52 54             	mov    0x54(%edx),%edx
+  80431e:	85 d2                	test   %edx,%edx
+  804320:	0f 84 3b ff ff ff    	je     804261 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804326:	83 ec 0c             	sub    $0xc,%esp
+  804329:	50                   	push   %eax
+  80432a:	57                   	push   %edi
+  80432b:	68 b4 56 80 00       	push   $0x8056b4
+  804330:	68 bb 00 00 00       	push   $0xbb
+  804335:	68 a6 56 80 00       	push   $0x8056a6
+  80433a:	e8 f4 c0 ff ff       	call   800433 <_panic>
+	}
+}
+  80433f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804342:	5b                   	pop    %ebx
+  804343:	5e                   	pop    %esi
+  804344:	5f                   	pop    %edi
+  804345:	5d                   	pop    %ebp
+  804346:	c3                   	ret
+
+00804347 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804347:	55                   	push   %ebp
+  804348:	89 e5                	mov    %esp,%ebp
+  80434a:	53                   	push   %ebx
+  80434b:	83 ec 04             	sub    $0x4,%esp
+  80434e:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804350:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804356:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80435c:	0f 87 85 00 00 00    	ja     8043e7 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804362:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804367:	29 c3                	sub    %eax,%ebx
+  804369:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80436c:	83 ec 04             	sub    $0x4,%esp
+  80436f:	68 80 02 00 00       	push   $0x280
+  804374:	6a 00                	push   $0x0
+  804376:	68 40 80 80 00       	push   $0x808040
+  80437b:	e8 c3 c8 ff ff       	call   800c43 <memset>
+	threads_mu.m_state = 0;
+  804380:	c7 05 20 80 80 00 00 	movl   $0x0,0x808020
+  804387:	00 00 00 
+	if (self != 0) {
+  80438a:	83 c4 10             	add    $0x10,%esp
+  80438d:	85 db                	test   %ebx,%ebx
+  80438f:	74 51                	je     8043e2 <pthread_fork_child+0x9b>
+  804391:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804393:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804399:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80439e:	77 18                	ja     8043b8 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043a7:	c1 e8 10             	shr    $0x10,%eax
+  8043aa:	74 0c                	je     8043b8 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043ac:	c1 e0 10             	shl    $0x10,%eax
+  8043af:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043b4:	29 c2                	sub    %eax,%edx
+  8043b6:	eb 06                	jmp    8043be <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8043b8:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		threads[self].th_env = thisenv->env_id;
+  8043be:	8b 02                	mov    (%edx),%eax
+  8043c0:	8b 48 48             	mov    0x48(%eax),%ecx
+  8043c3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8043ca:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8043cd:	89 0c 95 40 80 80 00 	mov    %ecx,0x808040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8043d4:	8d 04 95 40 80 80 00 	lea    0x808040(,%edx,4),%eax
+  8043db:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8043e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043e5:	c9                   	leave
+  8043e6:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8043e7:	83 ec 04             	sub    $0x4,%esp
+  8043ea:	68 80 02 00 00       	push   $0x280
+  8043ef:	6a 00                	push   $0x0
+  8043f1:	68 40 80 80 00       	push   $0x808040
+  8043f6:	e8 48 c8 ff ff       	call   800c43 <memset>
+	threads_mu.m_state = 0;
+  8043fb:	c7 05 20 80 80 00 00 	movl   $0x0,0x808020
+  804402:	00 00 00 
+  804405:	83 c4 10             	add    $0x10,%esp
+  804408:	eb d8                	jmp    8043e2 <pthread_fork_child+0x9b>
+
+0080440a <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80440a:	55                   	push   %ebp
+  80440b:	89 e5                	mov    %esp,%ebp
+  80440d:	57                   	push   %edi
+  80440e:	56                   	push   %esi
+  80440f:	53                   	push   %ebx
+  804410:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  804413:	89 d6                	mov    %edx,%esi
+  804415:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804418:	89 cf                	mov    %ecx,%edi
+  80441a:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80441d:	89 fa                	mov    %edi,%edx
+  80441f:	80 ce 08             	or     $0x8,%dh
+  804422:	f6 c5 08             	test   $0x8,%ch
+  804425:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  804428:	57                   	push   %edi
+  804429:	56                   	push   %esi
+  80442a:	50                   	push   %eax
+  80442b:	56                   	push   %esi
+  80442c:	6a 00                	push   $0x0
+  80442e:	e8 4a cb ff ff       	call   800f7d <sys_page_map>
+	if (r < 0) {
+  804433:	83 c4 20             	add    $0x20,%esp
+  804436:	85 c0                	test   %eax,%eax
+  804438:	78 27                	js     804461 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80443a:	83 ec 0c             	sub    $0xc,%esp
+  80443d:	57                   	push   %edi
+  80443e:	56                   	push   %esi
+  80443f:	6a 00                	push   $0x0
+  804441:	56                   	push   %esi
+  804442:	6a 00                	push   $0x0
+  804444:	e8 34 cb ff ff       	call   800f7d <sys_page_map>
+  804449:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80444b:	83 c4 20             	add    $0x20,%esp
+  80444e:	85 c0                	test   %eax,%eax
+  804450:	78 24                	js     804476 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  804452:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804457:	89 d8                	mov    %ebx,%eax
+  804459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80445c:	5b                   	pop    %ebx
+  80445d:	5e                   	pop    %esi
+  80445e:	5f                   	pop    %edi
+  80445f:	5d                   	pop    %ebp
+  804460:	c3                   	ret
+  804461:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804463:	83 ec 08             	sub    $0x8,%esp
+  804466:	50                   	push   %eax
+  804467:	68 dc 56 80 00       	push   $0x8056dc
+  80446c:	e8 9d c0 ff ff       	call   80050e <cprintf>
+		return r;
+  804471:	83 c4 10             	add    $0x10,%esp
+  804474:	eb e1                	jmp    804457 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  804476:	83 ec 08             	sub    $0x8,%esp
+  804479:	50                   	push   %eax
+  80447a:	68 0c 57 80 00       	push   $0x80570c
+  80447f:	e8 8a c0 ff ff       	call   80050e <cprintf>
+		return r;
+  804484:	83 c4 10             	add    $0x10,%esp
+  804487:	eb ce                	jmp    804457 <duppage_cow+0x4d>
+
+00804489 <duppage>:
+{
+  804489:	55                   	push   %ebp
+  80448a:	89 e5                	mov    %esp,%ebp
+  80448c:	53                   	push   %ebx
+  80448d:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  804490:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  804493:	51                   	push   %ecx
+  804494:	52                   	push   %edx
+  804495:	50                   	push   %eax
+  804496:	52                   	push   %edx
+  804497:	6a 00                	push   $0x0
+  804499:	e8 df ca ff ff       	call   800f7d <sys_page_map>
+	if (r < 0) {
+  80449e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8044a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8044a6:	85 c0                	test   %eax,%eax
+  8044a8:	78 07                	js     8044b1 <duppage+0x28>
+}
+  8044aa:	89 d8                	mov    %ebx,%eax
+  8044ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8044af:	c9                   	leave
+  8044b0:	c3                   	ret
+  8044b1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8044b3:	83 ec 08             	sub    $0x8,%esp
+  8044b6:	50                   	push   %eax
+  8044b7:	68 dc 56 80 00       	push   $0x8056dc
+  8044bc:	e8 4d c0 ff ff       	call   80050e <cprintf>
+		return r;
+  8044c1:	83 c4 10             	add    $0x10,%esp
+  8044c4:	eb e4                	jmp    8044aa <duppage+0x21>
+
+008044c6 <cow_copy>:
+{
+  8044c6:	55                   	push   %ebp
+  8044c7:	89 e5                	mov    %esp,%ebp
+  8044c9:	56                   	push   %esi
+  8044ca:	53                   	push   %ebx
+  8044cb:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8044cd:	83 ec 04             	sub    $0x4,%esp
+  8044d0:	6a 07                	push   $0x7
+  8044d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8044d7:	6a 00                	push   $0x0
+  8044d9:	e8 52 ca ff ff       	call   800f30 <sys_page_alloc>
+	if (r < 0) {
+  8044de:	83 c4 10             	add    $0x10,%esp
+  8044e1:	85 c0                	test   %eax,%eax
+  8044e3:	78 58                	js     80453d <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8044e5:	83 ec 04             	sub    $0x4,%esp
+  8044e8:	68 00 10 00 00       	push   $0x1000
+  8044ed:	56                   	push   %esi
+  8044ee:	68 00 f0 7f 00       	push   $0x7ff000
+  8044f3:	e8 80 c7 ff ff       	call   800c78 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8044f8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8044ff:	56                   	push   %esi
+  804500:	6a 00                	push   $0x0
+  804502:	68 00 f0 7f 00       	push   $0x7ff000
+  804507:	6a 00                	push   $0x0
+  804509:	e8 6f ca ff ff       	call   800f7d <sys_page_map>
+  80450e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804510:	83 c4 20             	add    $0x20,%esp
+  804513:	85 c0                	test   %eax,%eax
+  804515:	78 3b                	js     804552 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804517:	83 ec 08             	sub    $0x8,%esp
+  80451a:	68 00 f0 7f 00       	push   $0x7ff000
+  80451f:	6a 00                	push   $0x0
+  804521:	e8 a3 ca ff ff       	call   800fc9 <sys_page_unmap>
+  804526:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804528:	83 c4 10             	add    $0x10,%esp
+  80452b:	85 c0                	test   %eax,%eax
+  80452d:	78 45                	js     804574 <cow_copy+0xae>
+	return 0;
+  80452f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804534:	89 d8                	mov    %ebx,%eax
+  804536:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804539:	5b                   	pop    %ebx
+  80453a:	5e                   	pop    %esi
+  80453b:	5d                   	pop    %ebp
+  80453c:	c3                   	ret
+  80453d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80453f:	83 ec 08             	sub    $0x8,%esp
+  804542:	50                   	push   %eax
+  804543:	68 fc 57 80 00       	push   $0x8057fc
+  804548:	e8 c1 bf ff ff       	call   80050e <cprintf>
+		return r;
+  80454d:	83 c4 10             	add    $0x10,%esp
+  804550:	eb e2                	jmp    804534 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  804552:	83 ec 08             	sub    $0x8,%esp
+  804555:	50                   	push   %eax
+  804556:	68 18 58 80 00       	push   $0x805818
+  80455b:	e8 ae bf ff ff       	call   80050e <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  804560:	83 c4 08             	add    $0x8,%esp
+  804563:	68 00 f0 7f 00       	push   $0x7ff000
+  804568:	6a 00                	push   $0x0
+  80456a:	e8 5a ca ff ff       	call   800fc9 <sys_page_unmap>
+		return r;
+  80456f:	83 c4 10             	add    $0x10,%esp
+  804572:	eb c0                	jmp    804534 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  804574:	83 ec 08             	sub    $0x8,%esp
+  804577:	50                   	push   %eax
+  804578:	68 34 57 80 00       	push   $0x805734
+  80457d:	e8 8c bf ff ff       	call   80050e <cprintf>
+		return r;
+  804582:	83 c4 10             	add    $0x10,%esp
+  804585:	eb ad                	jmp    804534 <cow_copy+0x6e>
+
+00804587 <pgfault>:
+{
+  804587:	55                   	push   %ebp
+  804588:	89 e5                	mov    %esp,%ebp
+  80458a:	56                   	push   %esi
+  80458b:	53                   	push   %ebx
+  80458c:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80458f:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  804591:	89 d8                	mov    %ebx,%eax
+  804593:	c1 e8 16             	shr    $0x16,%eax
+  804596:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80459d:	89 de                	mov    %ebx,%esi
+  80459f:	c1 ee 0c             	shr    $0xc,%esi
+  8045a2:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8045a9:	a8 07                	test   $0x7,%al
+  8045ab:	74 3b                	je     8045e8 <pgfault+0x61>
+  8045ad:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8045b3:	74 33                	je     8045e8 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8045b5:	83 ec 0c             	sub    $0xc,%esp
+  8045b8:	68 00 f0 bf ee       	push   $0xeebff000
+  8045bd:	e8 3c f6 ff ff       	call   803bfe <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8045c2:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8045c9:	83 c4 10             	add    $0x10,%esp
+  8045cc:	f6 c4 08             	test   $0x8,%ah
+  8045cf:	75 30                	jne    804601 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8045d1:	83 ec 0c             	sub    $0xc,%esp
+  8045d4:	68 00 f0 bf ee       	push   $0xeebff000
+  8045d9:	e8 8d f6 ff ff       	call   803c6b <mutex_unlock>
+}
+  8045de:	83 c4 10             	add    $0x10,%esp
+  8045e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8045e4:	5b                   	pop    %ebx
+  8045e5:	5e                   	pop    %esi
+  8045e6:	5d                   	pop    %ebp
+  8045e7:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8045e8:	83 ec 08             	sub    $0x8,%esp
+  8045eb:	ff 72 28             	push   0x28(%edx)
+  8045ee:	51                   	push   %ecx
+  8045ef:	50                   	push   %eax
+  8045f0:	68 58 57 80 00       	push   $0x805758
+  8045f5:	6a 3f                	push   $0x3f
+  8045f7:	68 32 58 80 00       	push   $0x805832
+  8045fc:	e8 32 be ff ff       	call   800433 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804601:	89 d8                	mov    %ebx,%eax
+  804603:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804608:	e8 b9 fe ff ff       	call   8044c6 <cow_copy>
+  80460d:	eb c2                	jmp    8045d1 <pgfault+0x4a>
+
+0080460f <cow_enable>:
+{
+  80460f:	55                   	push   %ebp
+  804610:	89 e5                	mov    %esp,%ebp
+  804612:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804615:	68 87 45 80 00       	push   $0x804587
+  80461a:	e8 28 06 00 00       	call   804c47 <set_pgfault_handler>
+}
+  80461f:	83 c4 10             	add    $0x10,%esp
+  804622:	c9                   	leave
+  804623:	c3                   	ret
+
+00804624 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804624:	55                   	push   %ebp
+  804625:	89 e5                	mov    %esp,%ebp
+  804627:	57                   	push   %edi
+  804628:	56                   	push   %esi
+  804629:	53                   	push   %ebx
+  80462a:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80462d:	68 87 45 80 00       	push   $0x804587
+  804632:	e8 10 06 00 00       	call   804c47 <set_pgfault_handler>
+  804637:	b8 07 00 00 00       	mov    $0x7,%eax
+  80463c:	cd 30                	int    $0x30
+  80463e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804641:	83 c4 10             	add    $0x10,%esp
+  804644:	85 c0                	test   %eax,%eax
+  804646:	78 4b                	js     804693 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804648:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80464d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804652:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804655:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804659:	0f 85 16 01 00 00    	jne    804775 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80465f:	e8 74 c8 ff ff       	call   800ed8 <sys_getenvid>
+  804664:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804669:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80466b:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  804671:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804677:	77 32                	ja     8046ab <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804679:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80467e:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  804680:	c1 ea 10             	shr    $0x10,%edx
+  804683:	74 26                	je     8046ab <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804685:	c1 e2 10             	shl    $0x10,%edx
+  804688:	89 d1                	mov    %edx,%ecx
+  80468a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80468f:	29 ca                	sub    %ecx,%edx
+  804691:	eb 1e                	jmp    8046b1 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  804693:	83 ec 08             	sub    $0x8,%esp
+  804696:	89 c7                	mov    %eax,%edi
+  804698:	50                   	push   %eax
+  804699:	68 3d 58 80 00       	push   $0x80583d
+  80469e:	e8 6b be ff ff       	call   80050e <cprintf>
+		return eid;
+  8046a3:	83 c4 10             	add    $0x10,%esp
+  8046a6:	e9 6c 01 00 00       	jmp    804817 <fork+0x1f3>
+		return pthread_main_tls;
+  8046ab:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8046b1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8046b4:	c1 e0 04             	shl    $0x4,%eax
+  8046b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046bc:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8046be:	e8 84 fc ff ff       	call   804347 <pthread_fork_child>
+		return eid;
+  8046c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8046c6:	e9 4c 01 00 00       	jmp    804817 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8046cb:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8046d1:	89 da                	mov    %ebx,%edx
+  8046d3:	89 f8                	mov    %edi,%eax
+  8046d5:	e8 af fd ff ff       	call   804489 <duppage>
+  8046da:	85 c0                	test   %eax,%eax
+  8046dc:	79 28                	jns    804706 <fork+0xe2>
+  8046de:	89 c7                	mov    %eax,%edi
+  8046e0:	e9 32 01 00 00       	jmp    804817 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8046e5:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8046eb:	83 f9 05             	cmp    $0x5,%ecx
+  8046ee:	75 58                	jne    804748 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8046f0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8046f5:	89 da                	mov    %ebx,%edx
+  8046f7:	89 f8                	mov    %edi,%eax
+  8046f9:	e8 8b fd ff ff       	call   804489 <duppage>
+  8046fe:	85 c0                	test   %eax,%eax
+  804700:	0f 88 0f 01 00 00    	js     804815 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804706:	83 c3 01             	add    $0x1,%ebx
+  804709:	39 de                	cmp    %ebx,%esi
+  80470b:	74 54                	je     804761 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80470d:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804714:	f6 c1 05             	test   $0x5,%cl
+  804717:	74 ed                	je     804706 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804719:	f6 c5 04             	test   $0x4,%ch
+  80471c:	75 ad                	jne    8046cb <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80471e:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804724:	74 bf                	je     8046e5 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804726:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80472c:	74 d8                	je     804706 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80472e:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804734:	89 da                	mov    %ebx,%edx
+  804736:	89 f8                	mov    %edi,%eax
+  804738:	e8 cd fc ff ff       	call   80440a <duppage_cow>
+  80473d:	85 c0                	test   %eax,%eax
+  80473f:	79 c5                	jns    804706 <fork+0xe2>
+  804741:	89 c7                	mov    %eax,%edi
+  804743:	e9 cf 00 00 00       	jmp    804817 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804748:	68 88 57 80 00       	push   $0x805788
+  80474d:	68 dd 54 80 00       	push   $0x8054dd
+  804752:	68 c6 00 00 00       	push   $0xc6
+  804757:	68 32 58 80 00       	push   $0x805832
+  80475c:	e8 d2 bc ff ff       	call   800433 <_panic>
+  804761:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804764:	83 c1 01             	add    $0x1,%ecx
+  804767:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80476d:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804773:	74 18                	je     80478d <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804775:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80477c:	a8 07                	test   $0x7,%al
+  80477e:	74 e4                	je     804764 <fork+0x140>
+  804780:	89 cb                	mov    %ecx,%ebx
+  804782:	c1 e3 0a             	shl    $0xa,%ebx
+  804785:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804788:	e9 7c ff ff ff       	jmp    804709 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80478d:	83 ec 04             	sub    $0x4,%esp
+  804790:	6a 07                	push   $0x7
+  804792:	68 00 f0 bf ee       	push   $0xeebff000
+  804797:	ff 75 e4             	push   -0x1c(%ebp)
+  80479a:	e8 91 c7 ff ff       	call   800f30 <sys_page_alloc>
+  80479f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047a1:	83 c4 10             	add    $0x10,%esp
+  8047a4:	85 c0                	test   %eax,%eax
+  8047a6:	78 34                	js     8047dc <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8047a8:	83 ec 08             	sub    $0x8,%esp
+  8047ab:	68 85 4c 80 00       	push   $0x804c85
+  8047b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8047b3:	e8 f5 c8 ff ff       	call   8010ad <sys_env_set_pgfault_upcall>
+  8047b8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047ba:	83 c4 10             	add    $0x10,%esp
+  8047bd:	85 c0                	test   %eax,%eax
+  8047bf:	78 2e                	js     8047ef <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8047c1:	83 ec 08             	sub    $0x8,%esp
+  8047c4:	6a 02                	push   $0x2
+  8047c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8047c9:	e8 47 c8 ff ff       	call   801015 <sys_env_set_status>
+  8047ce:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8047d0:	83 c4 10             	add    $0x10,%esp
+  8047d3:	85 c0                	test   %eax,%eax
+  8047d5:	78 2b                	js     804802 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8047d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8047da:	eb 3b                	jmp    804817 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8047dc:	83 ec 08             	sub    $0x8,%esp
+  8047df:	50                   	push   %eax
+  8047e0:	68 b0 57 80 00       	push   $0x8057b0
+  8047e5:	e8 24 bd ff ff       	call   80050e <cprintf>
+		return r;
+  8047ea:	83 c4 10             	add    $0x10,%esp
+  8047ed:	eb 28                	jmp    804817 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8047ef:	83 ec 08             	sub    $0x8,%esp
+  8047f2:	50                   	push   %eax
+  8047f3:	68 d8 57 80 00       	push   $0x8057d8
+  8047f8:	e8 11 bd ff ff       	call   80050e <cprintf>
+		return r;
+  8047fd:	83 c4 10             	add    $0x10,%esp
+  804800:	eb 15                	jmp    804817 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804802:	83 ec 08             	sub    $0x8,%esp
+  804805:	50                   	push   %eax
+  804806:	68 4d 58 80 00       	push   $0x80584d
+  80480b:	e8 fe bc ff ff       	call   80050e <cprintf>
+		return r;
+  804810:	83 c4 10             	add    $0x10,%esp
+  804813:	eb 02                	jmp    804817 <fork+0x1f3>
+  804815:	89 c7                	mov    %eax,%edi
+}
+  804817:	89 f8                	mov    %edi,%eax
+  804819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80481c:	5b                   	pop    %ebx
+  80481d:	5e                   	pop    %esi
+  80481e:	5f                   	pop    %edi
+  80481f:	5d                   	pop    %ebp
+  804820:	c3                   	ret
+
+00804821 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804821:	55                   	push   %ebp
+  804822:	89 e5                	mov    %esp,%ebp
+  804824:	57                   	push   %edi
+  804825:	56                   	push   %esi
+  804826:	53                   	push   %ebx
+  804827:	83 ec 2c             	sub    $0x2c,%esp
+  80482a:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80482c:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804832:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804837:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80483d:	77 0a                	ja     804849 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80483f:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804844:	29 c3                	sub    %eax,%ebx
+  804846:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804849:	83 ec 0c             	sub    $0xc,%esp
+  80484c:	68 87 45 80 00       	push   $0x804587
+  804851:	e8 f1 03 00 00       	call   804c47 <set_pgfault_handler>
+  804856:	b8 07 00 00 00       	mov    $0x7,%eax
+  80485b:	cd 30                	int    $0x30
+  80485d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804860:	83 c4 10             	add    $0x10,%esp
+  804863:	85 c0                	test   %eax,%eax
+  804865:	78 30                	js     804897 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804867:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80486b:	74 42                	je     8048af <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80486d:	c1 e3 10             	shl    $0x10,%ebx
+  804870:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804875:	29 d8                	sub    %ebx,%eax
+  804877:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80487a:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80487f:	29 d8                	sub    %ebx,%eax
+  804881:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804884:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804889:	ba 00 00 00 00       	mov    $0x0,%edx
+  80488e:	89 f7                	mov    %esi,%edi
+  804890:	89 d6                	mov    %edx,%esi
+  804892:	e9 2c 01 00 00       	jmp    8049c3 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804897:	83 ec 08             	sub    $0x8,%esp
+  80489a:	89 c7                	mov    %eax,%edi
+  80489c:	50                   	push   %eax
+  80489d:	68 3d 58 80 00       	push   $0x80583d
+  8048a2:	e8 67 bc ff ff       	call   80050e <cprintf>
+		return eid;
+  8048a7:	83 c4 10             	add    $0x10,%esp
+  8048aa:	e9 d5 00 00 00       	jmp    804984 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8048af:	e8 24 c6 ff ff       	call   800ed8 <sys_getenvid>
+  8048b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8048b9:	89 c2                	mov    %eax,%edx
+  8048bb:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048bd:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8048c3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048c8:	77 18                	ja     8048e2 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8048ca:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8048cf:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8048d1:	c1 e8 10             	shr    $0x10,%eax
+  8048d4:	74 0c                	je     8048e2 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8048d6:	c1 e0 10             	shl    $0x10,%eax
+  8048d9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8048de:	29 c1                	sub    %eax,%ecx
+  8048e0:	eb 06                	jmp    8048e8 <sfork+0xc7>
+		return pthread_main_tls;
+  8048e2:	8b 0d 30 9a 80 00    	mov    0x809a30,%ecx
+  8048e8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8048eb:	c1 e0 04             	shl    $0x4,%eax
+  8048ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8048f3:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8048f5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8048f8:	e9 87 00 00 00       	jmp    804984 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8048fd:	f6 c5 04             	test   $0x4,%ch
+  804900:	74 6c                	je     80496e <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804902:	89 ca                	mov    %ecx,%edx
+  804904:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80490a:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804910:	74 7c                	je     80498e <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804912:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804918:	89 da                	mov    %ebx,%edx
+  80491a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80491d:	e8 67 fb ff ff       	call   804489 <duppage>
+  804922:	85 c0                	test   %eax,%eax
+  804924:	0f 88 4f 01 00 00    	js     804a79 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80492a:	83 c3 01             	add    $0x1,%ebx
+  80492d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804930:	74 7a                	je     8049ac <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804932:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804934:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80493b:	f6 c1 01             	test   $0x1,%cl
+  80493e:	74 ea                	je     80492a <sfork+0x109>
+  804940:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804946:	74 e2                	je     80492a <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804948:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80494e:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804951:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804956:	76 a5                	jbe    8048fd <sfork+0xdc>
+  804958:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80495e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804961:	39 fa                	cmp    %edi,%edx
+  804963:	73 9d                	jae    804902 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804965:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804968:	39 fa                	cmp    %edi,%edx
+  80496a:	72 96                	jb     804902 <sfork+0xe1>
+  80496c:	eb 8f                	jmp    8048fd <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80496e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804974:	89 da                	mov    %ebx,%edx
+  804976:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804979:	e8 8c fa ff ff       	call   80440a <duppage_cow>
+  80497e:	85 c0                	test   %eax,%eax
+  804980:	79 a8                	jns    80492a <sfork+0x109>
+  804982:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804984:	89 f8                	mov    %edi,%eax
+  804986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804989:	5b                   	pop    %ebx
+  80498a:	5e                   	pop    %esi
+  80498b:	5f                   	pop    %edi
+  80498c:	5d                   	pop    %ebp
+  80498d:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80498e:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804993:	e8 2e fb ff ff       	call   8044c6 <cow_copy>
+  804998:	85 c0                	test   %eax,%eax
+  80499a:	0f 88 d2 00 00 00    	js     804a72 <sfork+0x251>
+				pte = uvpt[pn];
+  8049a0:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8049a7:	e9 66 ff ff ff       	jmp    804912 <sfork+0xf1>
+  8049ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8049af:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8049b2:	83 c6 01             	add    $0x1,%esi
+  8049b5:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8049bb:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8049c1:	74 1b                	je     8049de <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8049c3:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8049ca:	a8 01                	test   $0x1,%al
+  8049cc:	74 e4                	je     8049b2 <sfork+0x191>
+  8049ce:	89 f3                	mov    %esi,%ebx
+  8049d0:	c1 e3 0a             	shl    $0xa,%ebx
+  8049d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8049d6:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8049d9:	e9 4f ff ff ff       	jmp    80492d <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8049de:	83 ec 04             	sub    $0x4,%esp
+  8049e1:	6a 07                	push   $0x7
+  8049e3:	68 00 f0 bf ee       	push   $0xeebff000
+  8049e8:	ff 75 e0             	push   -0x20(%ebp)
+  8049eb:	e8 40 c5 ff ff       	call   800f30 <sys_page_alloc>
+  8049f0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8049f2:	83 c4 10             	add    $0x10,%esp
+  8049f5:	85 c0                	test   %eax,%eax
+  8049f7:	78 37                	js     804a30 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8049f9:	83 ec 08             	sub    $0x8,%esp
+  8049fc:	68 85 4c 80 00       	push   $0x804c85
+  804a01:	ff 75 e0             	push   -0x20(%ebp)
+  804a04:	e8 a4 c6 ff ff       	call   8010ad <sys_env_set_pgfault_upcall>
+  804a09:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804a0b:	83 c4 10             	add    $0x10,%esp
+  804a0e:	85 c0                	test   %eax,%eax
+  804a10:	78 34                	js     804a46 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804a12:	83 ec 08             	sub    $0x8,%esp
+  804a15:	6a 02                	push   $0x2
+  804a17:	ff 75 e0             	push   -0x20(%ebp)
+  804a1a:	e8 f6 c5 ff ff       	call   801015 <sys_env_set_status>
+  804a1f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804a21:	83 c4 10             	add    $0x10,%esp
+  804a24:	85 c0                	test   %eax,%eax
+  804a26:	78 34                	js     804a5c <sfork+0x23b>
+	return eid;
+  804a28:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804a2b:	e9 54 ff ff ff       	jmp    804984 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804a30:	83 ec 08             	sub    $0x8,%esp
+  804a33:	50                   	push   %eax
+  804a34:	68 b0 57 80 00       	push   $0x8057b0
+  804a39:	e8 d0 ba ff ff       	call   80050e <cprintf>
+		return r;
+  804a3e:	83 c4 10             	add    $0x10,%esp
+  804a41:	e9 3e ff ff ff       	jmp    804984 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804a46:	83 ec 08             	sub    $0x8,%esp
+  804a49:	50                   	push   %eax
+  804a4a:	68 d8 57 80 00       	push   $0x8057d8
+  804a4f:	e8 ba ba ff ff       	call   80050e <cprintf>
+		return r;
+  804a54:	83 c4 10             	add    $0x10,%esp
+  804a57:	e9 28 ff ff ff       	jmp    804984 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804a5c:	83 ec 08             	sub    $0x8,%esp
+  804a5f:	50                   	push   %eax
+  804a60:	68 4d 58 80 00       	push   $0x80584d
+  804a65:	e8 a4 ba ff ff       	call   80050e <cprintf>
+		return r;
+  804a6a:	83 c4 10             	add    $0x10,%esp
+  804a6d:	e9 12 ff ff ff       	jmp    804984 <sfork+0x163>
+  804a72:	89 c7                	mov    %eax,%edi
+  804a74:	e9 0b ff ff ff       	jmp    804984 <sfork+0x163>
+  804a79:	89 c7                	mov    %eax,%edi
+  804a7b:	e9 04 ff ff ff       	jmp    804984 <sfork+0x163>
+
+00804a80 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804a80:	55                   	push   %ebp
+  804a81:	89 e5                	mov    %esp,%ebp
+  804a83:	57                   	push   %edi
+  804a84:	56                   	push   %esi
+  804a85:	53                   	push   %ebx
+  804a86:	83 ec 18             	sub    $0x18,%esp
+  804a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804a8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a8f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804a92:	85 c0                	test   %eax,%eax
+  804a94:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a99:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804a9c:	50                   	push   %eax
+  804a9d:	e8 84 c6 ff ff       	call   801126 <sys_ipc_recv>
+	if (r < 0) {
+  804aa2:	83 c4 10             	add    $0x10,%esp
+  804aa5:	85 c0                	test   %eax,%eax
+  804aa7:	78 2b                	js     804ad4 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804aa9:	85 ff                	test   %edi,%edi
+  804aab:	74 55                	je     804b02 <ipc_recv+0x82>
+  804aad:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804aaf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804ab5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804aba:	77 39                	ja     804af5 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804abc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804ac1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804ac3:	c1 e8 10             	shr    $0x10,%eax
+  804ac6:	74 2d                	je     804af5 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804ac8:	c1 e0 10             	shl    $0x10,%eax
+  804acb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804ad0:	29 c2                	sub    %eax,%edx
+  804ad2:	eb 27                	jmp    804afb <ipc_recv+0x7b>
+  804ad4:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804ad6:	83 ec 08             	sub    $0x8,%esp
+  804ad9:	50                   	push   %eax
+  804ada:	68 6b 58 80 00       	push   $0x80586b
+  804adf:	e8 2a ba ff ff       	call   80050e <cprintf>
+		*from_env_store = 0;
+  804ae4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804aea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804af0:	83 c4 10             	add    $0x10,%esp
+  804af3:	eb 77                	jmp    804b6c <ipc_recv+0xec>
+		return pthread_main_tls;
+  804af5:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804afb:	8b 02                	mov    (%edx),%eax
+  804afd:	8b 40 78             	mov    0x78(%eax),%eax
+  804b00:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804b02:	85 f6                	test   %esi,%esi
+  804b04:	74 34                	je     804b3a <ipc_recv+0xba>
+  804b06:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804b08:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804b0e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804b13:	77 18                	ja     804b2d <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804b15:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804b1a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804b1c:	c1 e8 10             	shr    $0x10,%eax
+  804b1f:	74 0c                	je     804b2d <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804b21:	c1 e0 10             	shl    $0x10,%eax
+  804b24:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804b29:	29 c2                	sub    %eax,%edx
+  804b2b:	eb 06                	jmp    804b33 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804b2d:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804b33:	8b 02                	mov    (%edx),%eax
+  804b35:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804b38:	89 06                	mov    %eax,(%esi)
+  804b3a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804b3c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804b42:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804b47:	77 18                	ja     804b61 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804b49:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804b4e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804b50:	c1 e8 10             	shr    $0x10,%eax
+  804b53:	74 0c                	je     804b61 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804b55:	c1 e0 10             	shl    $0x10,%eax
+  804b58:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804b5d:	29 c2                	sub    %eax,%edx
+  804b5f:	eb 06                	jmp    804b67 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804b61:	8b 15 30 9a 80 00    	mov    0x809a30,%edx
+	}
+	return thisenv->env_ipc_value;
+  804b67:	8b 02                	mov    (%edx),%eax
+  804b69:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804b6c:	89 d8                	mov    %ebx,%eax
+  804b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b71:	5b                   	pop    %ebx
+  804b72:	5e                   	pop    %esi
+  804b73:	5f                   	pop    %edi
+  804b74:	5d                   	pop    %ebp
+  804b75:	c3                   	ret
+
+00804b76 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804b76:	55                   	push   %ebp
+  804b77:	89 e5                	mov    %esp,%ebp
+  804b79:	57                   	push   %edi
+  804b7a:	56                   	push   %esi
+  804b7b:	53                   	push   %ebx
+  804b7c:	83 ec 0c             	sub    $0xc,%esp
+  804b7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  804b82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804b85:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804b88:	85 db                	test   %ebx,%ebx
+  804b8a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804b8f:	0f 44 d8             	cmove  %eax,%ebx
+  804b92:	eb 05                	jmp    804b99 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804b94:	e8 6b c3 ff ff       	call   800f04 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804b99:	57                   	push   %edi
+  804b9a:	53                   	push   %ebx
+  804b9b:	ff 75 0c             	push   0xc(%ebp)
+  804b9e:	56                   	push   %esi
+  804b9f:	e8 55 c5 ff ff       	call   8010f9 <sys_ipc_try_send>
+		if (r == 0) {
+  804ba4:	83 c4 10             	add    $0x10,%esp
+  804ba7:	85 c0                	test   %eax,%eax
+  804ba9:	74 19                	je     804bc4 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804bab:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804bae:	74 e4                	je     804b94 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804bb0:	83 ec 0c             	sub    $0xc,%esp
+  804bb3:	50                   	push   %eax
+  804bb4:	57                   	push   %edi
+  804bb5:	53                   	push   %ebx
+  804bb6:	56                   	push   %esi
+  804bb7:	68 84 58 80 00       	push   $0x805884
+  804bbc:	e8 4d b9 ff ff       	call   80050e <cprintf>
+			return;
+  804bc1:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bc7:	5b                   	pop    %ebx
+  804bc8:	5e                   	pop    %esi
+  804bc9:	5f                   	pop    %edi
+  804bca:	5d                   	pop    %ebp
+  804bcb:	c3                   	ret
+
+00804bcc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804bcc:	55                   	push   %ebp
+  804bcd:	89 e5                	mov    %esp,%ebp
+  804bcf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804bd7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804bda:	c1 e0 04             	shl    $0x4,%eax
+  804bdd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804be2:	8b 40 50             	mov    0x50(%eax),%eax
+  804be5:	39 c8                	cmp    %ecx,%eax
+  804be7:	74 12                	je     804bfb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804be9:	83 c2 01             	add    $0x1,%edx
+  804bec:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804bf2:	75 e3                	jne    804bd7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf9:	eb 0e                	jmp    804c09 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804bfb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804bfe:	c1 e0 04             	shl    $0x4,%eax
+  804c01:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804c06:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804c09:	5d                   	pop    %ebp
+  804c0a:	c3                   	ret
+
+00804c0b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804c0b:	55                   	push   %ebp
+  804c0c:	89 e5                	mov    %esp,%ebp
+  804c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804c11:	89 c2                	mov    %eax,%edx
+  804c13:	c1 ea 16             	shr    $0x16,%edx
+  804c16:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804c22:	f6 c1 01             	test   $0x1,%cl
+  804c25:	74 1c                	je     804c43 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804c27:	c1 e8 0c             	shr    $0xc,%eax
+  804c2a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804c31:	a8 01                	test   $0x1,%al
+  804c33:	74 0e                	je     804c43 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804c35:	c1 e8 0c             	shr    $0xc,%eax
+  804c38:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804c3f:	ef 
+  804c40:	0f b7 d2             	movzwl %dx,%edx
+}
+  804c43:	89 d0                	mov    %edx,%eax
+  804c45:	5d                   	pop    %ebp
+  804c46:	c3                   	ret
+
+00804c47 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804c47:	55                   	push   %ebp
+  804c48:	89 e5                	mov    %esp,%ebp
+  804c4a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804c4d:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  804c54:	74 0a                	je     804c60 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c59:	a3 00 c0 80 00       	mov    %eax,0x80c000
+}
+  804c5e:	c9                   	leave
+  804c5f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804c60:	83 ec 04             	sub    $0x4,%esp
+  804c63:	6a 07                	push   $0x7
+  804c65:	68 00 f0 bf ee       	push   $0xeebff000
+  804c6a:	6a 00                	push   $0x0
+  804c6c:	e8 bf c2 ff ff       	call   800f30 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804c71:	83 c4 08             	add    $0x8,%esp
+  804c74:	68 85 4c 80 00       	push   $0x804c85
+  804c79:	6a 00                	push   $0x0
+  804c7b:	e8 2d c4 ff ff       	call   8010ad <sys_env_set_pgfault_upcall>
+  804c80:	83 c4 10             	add    $0x10,%esp
+  804c83:	eb d1                	jmp    804c56 <set_pgfault_handler+0xf>
+
+00804c85 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804c85:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804c86:	a1 00 c0 80 00       	mov    0x80c000,%eax
+	call *%eax
+  804c8b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804c8d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804c90:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804c94:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804c98:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804c9b:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804c9f:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804ca1:	83 c4 08             	add    $0x8,%esp
+	popal
+  804ca4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804ca5:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804ca8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804ca9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804caa:	c3                   	ret
+
+00804cab <udm>:
+  804cab:	57                   	push   %edi
+  804cac:	56                   	push   %esi
+  804cad:	53                   	push   %ebx
+  804cae:	83 ec 20             	sub    $0x20,%esp
+  804cb1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804cb5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804cb9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804cbd:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804cc1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804cc5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804cc9:	89 d1                	mov    %edx,%ecx
+  804ccb:	09 c1                	or     %eax,%ecx
+  804ccd:	0f 84 91 00 00 00    	je     804d64 <udm+0xb9>
+  804cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cdd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ce2:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804ce9:	00 
+  804cea:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804cf1:	00 
+  804cf2:	eb 08                	jmp    804cfc <udm+0x51>
+  804cf4:	83 e9 01             	sub    $0x1,%ecx
+  804cf7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804cfa:	74 7c                	je     804d78 <udm+0xcd>
+  804cfc:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804d00:	01 c0                	add    %eax,%eax
+  804d02:	89 c6                	mov    %eax,%esi
+  804d04:	89 d7                	mov    %edx,%edi
+  804d06:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804d0a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804d0e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804d11:	d3 ea                	shr    %cl,%edx
+  804d13:	f6 c1 20             	test   $0x20,%cl
+  804d16:	74 04                	je     804d1c <udm+0x71>
+  804d18:	89 d0                	mov    %edx,%eax
+  804d1a:	31 d2                	xor    %edx,%edx
+  804d1c:	83 e0 01             	and    $0x1,%eax
+  804d1f:	89 04 24             	mov    %eax,(%esp)
+  804d22:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804d29:	00 
+  804d2a:	8b 04 24             	mov    (%esp),%eax
+  804d2d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804d31:	09 f0                	or     %esi,%eax
+  804d33:	09 fa                	or     %edi,%edx
+  804d35:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d39:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804d3d:	39 f0                	cmp    %esi,%eax
+  804d3f:	89 d3                	mov    %edx,%ebx
+  804d41:	19 fb                	sbb    %edi,%ebx
+  804d43:	72 af                	jb     804cf4 <udm+0x49>
+  804d45:	29 f0                	sub    %esi,%eax
+  804d47:	19 fa                	sbb    %edi,%edx
+  804d49:	89 cf                	mov    %ecx,%edi
+  804d4b:	c1 ef 05             	shr    $0x5,%edi
+  804d4e:	83 e7 01             	and    $0x1,%edi
+  804d51:	89 fe                	mov    %edi,%esi
+  804d53:	83 f6 01             	xor    $0x1,%esi
+  804d56:	d3 e6                	shl    %cl,%esi
+  804d58:	d3 e7                	shl    %cl,%edi
+  804d5a:	09 74 24 18          	or     %esi,0x18(%esp)
+  804d5e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804d62:	eb 90                	jmp    804cf4 <udm+0x49>
+  804d64:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d68:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804d6c:	89 f0                	mov    %esi,%eax
+  804d6e:	89 fa                	mov    %edi,%edx
+  804d70:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804d74:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804d78:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804d7c:	89 01                	mov    %eax,(%ecx)
+  804d7e:	89 51 04             	mov    %edx,0x4(%ecx)
+  804d81:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d85:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d89:	83 c4 20             	add    $0x20,%esp
+  804d8c:	5b                   	pop    %ebx
+  804d8d:	5e                   	pop    %esi
+  804d8e:	5f                   	pop    %edi
+  804d8f:	c3                   	ret
+
+00804d90 <__udivdi3>:
+  804d90:	83 ec 18             	sub    $0x18,%esp
+  804d93:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d97:	50                   	push   %eax
+  804d98:	ff 74 24 2c          	push   0x2c(%esp)
+  804d9c:	ff 74 24 2c          	push   0x2c(%esp)
+  804da0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804da4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804da8:	e8 fe fe ff ff       	call   804cab <udm>
+  804dad:	83 c4 24             	add    $0x24,%esp
+  804db0:	c3                   	ret
+
+00804db1 <__umoddi3>:
+  804db1:	83 ec 18             	sub    $0x18,%esp
+  804db4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804db8:	50                   	push   %eax
+  804db9:	ff 74 24 2c          	push   0x2c(%esp)
+  804dbd:	ff 74 24 2c          	push   0x2c(%esp)
+  804dc1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804dc5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804dc9:	e8 dd fe ff ff       	call   804cab <udm>
+  804dce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804dd2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804dd6:	83 c4 24             	add    $0x24,%esp
+  804dd9:	c3                   	ret
+
+00804dda <__divdi3>:
+  804dda:	56                   	push   %esi
+  804ddb:	53                   	push   %ebx
+  804ddc:	83 ec 14             	sub    $0x14,%esp
+  804ddf:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804de3:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804de7:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804deb:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804def:	85 d2                	test   %edx,%edx
+  804df1:	78 18                	js     804e0b <__divdi3+0x31>
+  804df3:	85 db                	test   %ebx,%ebx
+  804df5:	78 3e                	js     804e35 <__divdi3+0x5b>
+  804df7:	83 ec 04             	sub    $0x4,%esp
+  804dfa:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804dfe:	56                   	push   %esi
+  804dff:	53                   	push   %ebx
+  804e00:	51                   	push   %ecx
+  804e01:	e8 a5 fe ff ff       	call   804cab <udm>
+  804e06:	83 c4 10             	add    $0x10,%esp
+  804e09:	eb 24                	jmp    804e2f <__divdi3+0x55>
+  804e0b:	f7 d8                	neg    %eax
+  804e0d:	83 d2 00             	adc    $0x0,%edx
+  804e10:	f7 da                	neg    %edx
+  804e12:	85 db                	test   %ebx,%ebx
+  804e14:	78 3a                	js     804e50 <__divdi3+0x76>
+  804e16:	83 ec 04             	sub    $0x4,%esp
+  804e19:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e1d:	56                   	push   %esi
+  804e1e:	53                   	push   %ebx
+  804e1f:	51                   	push   %ecx
+  804e20:	e8 86 fe ff ff       	call   804cab <udm>
+  804e25:	83 c4 10             	add    $0x10,%esp
+  804e28:	f7 d8                	neg    %eax
+  804e2a:	83 d2 00             	adc    $0x0,%edx
+  804e2d:	f7 da                	neg    %edx
+  804e2f:	83 c4 14             	add    $0x14,%esp
+  804e32:	5b                   	pop    %ebx
+  804e33:	5e                   	pop    %esi
+  804e34:	c3                   	ret
+  804e35:	83 ec 04             	sub    $0x4,%esp
+  804e38:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e3c:	56                   	push   %esi
+  804e3d:	f7 d9                	neg    %ecx
+  804e3f:	83 d3 00             	adc    $0x0,%ebx
+  804e42:	f7 db                	neg    %ebx
+  804e44:	53                   	push   %ebx
+  804e45:	51                   	push   %ecx
+  804e46:	e8 60 fe ff ff       	call   804cab <udm>
+  804e4b:	83 c4 10             	add    $0x10,%esp
+  804e4e:	eb d8                	jmp    804e28 <__divdi3+0x4e>
+  804e50:	83 ec 04             	sub    $0x4,%esp
+  804e53:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804e57:	56                   	push   %esi
+  804e58:	f7 d9                	neg    %ecx
+  804e5a:	83 d3 00             	adc    $0x0,%ebx
+  804e5d:	f7 db                	neg    %ebx
+  804e5f:	53                   	push   %ebx
+  804e60:	51                   	push   %ecx
+  804e61:	e8 45 fe ff ff       	call   804cab <udm>
+  804e66:	83 c4 10             	add    $0x10,%esp
+  804e69:	eb c4                	jmp    804e2f <__divdi3+0x55>
+
+00804e6b <__moddi3>:
+  804e6b:	55                   	push   %ebp
+  804e6c:	57                   	push   %edi
+  804e6d:	56                   	push   %esi
+  804e6e:	53                   	push   %ebx
+  804e6f:	83 ec 24             	sub    $0x24,%esp
+  804e72:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804e76:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804e7a:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804e7e:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804e82:	85 d2                	test   %edx,%edx
+  804e84:	78 3b                	js     804ec1 <__moddi3+0x56>
+  804e86:	83 ec 04             	sub    $0x4,%esp
+  804e89:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e8d:	56                   	push   %esi
+  804e8e:	89 ce                	mov    %ecx,%esi
+  804e90:	f7 de                	neg    %esi
+  804e92:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804e96:	89 de                	mov    %ebx,%esi
+  804e98:	83 d6 00             	adc    $0x0,%esi
+  804e9b:	f7 de                	neg    %esi
+  804e9d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804ea1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ea5:	0f 48 f1             	cmovs  %ecx,%esi
+  804ea8:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804ead:	53                   	push   %ebx
+  804eae:	56                   	push   %esi
+  804eaf:	e8 f7 fd ff ff       	call   804cab <udm>
+  804eb4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804eb8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ebc:	83 c4 10             	add    $0x10,%esp
+  804ebf:	eb 47                	jmp    804f08 <__moddi3+0x9d>
+  804ec1:	f7 d8                	neg    %eax
+  804ec3:	83 d2 00             	adc    $0x0,%edx
+  804ec6:	f7 da                	neg    %edx
+  804ec8:	83 ec 04             	sub    $0x4,%esp
+  804ecb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804ecf:	56                   	push   %esi
+  804ed0:	89 cf                	mov    %ecx,%edi
+  804ed2:	f7 df                	neg    %edi
+  804ed4:	89 de                	mov    %ebx,%esi
+  804ed6:	83 d6 00             	adc    $0x0,%esi
+  804ed9:	f7 de                	neg    %esi
+  804edb:	0f 49 cf             	cmovns %edi,%ecx
+  804ede:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804ee2:	0f 49 de             	cmovns %esi,%ebx
+  804ee5:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804ee9:	ff 74 24 0c          	push   0xc(%esp)
+  804eed:	ff 74 24 0c          	push   0xc(%esp)
+  804ef1:	e8 b5 fd ff ff       	call   804cab <udm>
+  804ef6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804efa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804efe:	f7 d8                	neg    %eax
+  804f00:	83 d2 00             	adc    $0x0,%edx
+  804f03:	f7 da                	neg    %edx
+  804f05:	83 c4 10             	add    $0x10,%esp
+  804f08:	83 c4 24             	add    $0x24,%esp
+  804f0b:	5b                   	pop    %ebx
+  804f0c:	5e                   	pop    %esi
+  804f0d:	5f                   	pop    %edi
+  804f0e:	5d                   	pop    %ebp
+  804f0f:	c3                   	ret
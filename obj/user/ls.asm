@@ -0,0 +1,10210 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b9 02 00 00       	call   8002ea <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+	fclose(d);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d 70 74 80 00 00 	cmpl   $0x0,0x807470
+  800045:	74 23                	je     80006a <ls1+0x37>
+		sfprintf(stdout, "%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	50                   	push   %eax
+  800054:	ff 75 10             	push   0x10(%ebp)
+  800057:	68 c2 4a 80 00       	push   $0x804ac2
+  80005c:	ff 35 f0 4f 80 00    	push   0x804ff0
+  800062:	e8 dc 29 00 00       	call   802a43 <sfprintf>
+  800067:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  80006a:	85 db                	test   %ebx,%ebx
+  80006c:	74 1f                	je     80008d <ls1+0x5a>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006e:	b8 3f 52 80 00       	mov    $0x80523f,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800073:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800076:	75 4e                	jne    8000c6 <ls1+0x93>
+		sfprintf(stdout, "%s%s", prefix, sep);
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 cb 4a 80 00       	push   $0x804acb
+  80007f:	ff 35 f0 4f 80 00    	push   0x804ff0
+  800085:	e8 b9 29 00 00       	call   802a43 <sfprintf>
+  80008a:	83 c4 10             	add    $0x10,%esp
+	}
+	fputs(name, stdout);
+  80008d:	8b 1d f0 4f 80 00    	mov    0x804ff0,%ebx
+  800093:	83 ec 08             	sub    $0x8,%esp
+  800096:	53                   	push   %ebx
+  800097:	ff 75 14             	push   0x14(%ebp)
+  80009a:	e8 71 29 00 00       	call   802a10 <fputs>
+	if(flag['F'] && isdir)
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	83 3d d8 73 80 00 00 	cmpl   $0x0,0x8073d8
+  8000a9:	74 06                	je     8000b1 <ls1+0x7e>
+  8000ab:	89 f0                	mov    %esi,%eax
+  8000ad:	84 c0                	test   %al,%al
+  8000af:	75 35                	jne    8000e6 <ls1+0xb3>
+		fputc('/', stdout);
+	fputc('\n', stdout);
+  8000b1:	83 ec 08             	sub    $0x8,%esp
+  8000b4:	53                   	push   %ebx
+  8000b5:	6a 0a                	push   $0xa
+  8000b7:	e8 0b 29 00 00       	call   8029c7 <fputc>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c2:	5b                   	pop    %ebx
+  8000c3:	5e                   	pop    %esi
+  8000c4:	5d                   	pop    %ebp
+  8000c5:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c6:	83 ec 0c             	sub    $0xc,%esp
+  8000c9:	53                   	push   %ebx
+  8000ca:	e8 42 09 00 00       	call   800a11 <strlen>
+  8000cf:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000d2:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d7:	b8 3f 52 80 00       	mov    $0x80523f,%eax
+  8000dc:	ba c0 4a 80 00       	mov    $0x804ac0,%edx
+  8000e1:	0f 45 c2             	cmovne %edx,%eax
+  8000e4:	eb 92                	jmp    800078 <ls1+0x45>
+		fputc('/', stdout);
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	53                   	push   %ebx
+  8000ea:	6a 2f                	push   $0x2f
+  8000ec:	e8 d6 28 00 00       	call   8029c7 <fputc>
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	eb bb                	jmp    8000b1 <ls1+0x7e>
+
+008000f6 <lsdir>:
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	57                   	push   %edi
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+  8000fc:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  800102:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (!(d = fopen(path, "r")))
+  800105:	68 c4 4c 80 00       	push   $0x804cc4
+  80010a:	57                   	push   %edi
+  80010b:	e8 a7 23 00 00       	call   8024b7 <fopen>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	74 51                	je     800168 <lsdir+0x72>
+  800117:	89 c3                	mov    %eax,%ebx
+	while ((n = fread(&f, 1, sizeof f, d)) == sizeof f)
+  800119:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80011f:	53                   	push   %ebx
+  800120:	68 00 01 00 00       	push   $0x100
+  800125:	6a 01                	push   $0x1
+  800127:	56                   	push   %esi
+  800128:	e8 79 26 00 00       	call   8027a6 <fread>
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	3d 00 01 00 00       	cmp    $0x100,%eax
+  800135:	75 43                	jne    80017a <lsdir+0x84>
+		if (f.f_name[0])
+  800137:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  80013e:	74 df                	je     80011f <lsdir+0x29>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  800140:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800146:	50                   	push   %eax
+  800147:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  80014d:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  800154:	0f 94 c0             	sete   %al
+  800157:	0f b6 c0             	movzbl %al,%eax
+  80015a:	50                   	push   %eax
+  80015b:	ff 75 0c             	push   0xc(%ebp)
+  80015e:	e8 d0 fe ff ff       	call   800033 <ls1>
+  800163:	83 c4 10             	add    $0x10,%esp
+  800166:	eb b7                	jmp    80011f <lsdir+0x29>
+		panic("open %s failed", path);
+  800168:	57                   	push   %edi
+  800169:	68 d0 4a 80 00       	push   $0x804ad0
+  80016e:	6a 1e                	push   $0x1e
+  800170:	68 df 4a 80 00       	push   $0x804adf
+  800175:	e8 13 02 00 00       	call   80038d <_panic>
+	if (n > 0)
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	75 24                	jne    8001a2 <lsdir+0xac>
+	if (ferror(d))
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	53                   	push   %ebx
+  800182:	e8 1a 25 00 00       	call   8026a1 <ferror>
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	85 c0                	test   %eax,%eax
+  80018c:	75 26                	jne    8001b4 <lsdir+0xbe>
+	fclose(d);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	53                   	push   %ebx
+  800192:	e8 9f 24 00 00       	call   802636 <fclose>
+}
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019d:	5b                   	pop    %ebx
+  80019e:	5e                   	pop    %esi
+  80019f:	5f                   	pop    %edi
+  8001a0:	5d                   	pop    %ebp
+  8001a1:	c3                   	ret
+		panic("short read in directory %s", path);
+  8001a2:	57                   	push   %edi
+  8001a3:	68 e9 4a 80 00       	push   $0x804ae9
+  8001a8:	6a 23                	push   $0x23
+  8001aa:	68 df 4a 80 00       	push   $0x804adf
+  8001af:	e8 d9 01 00 00       	call   80038d <_panic>
+		panic("error reading directory %s", path);
+  8001b4:	57                   	push   %edi
+  8001b5:	68 04 4b 80 00       	push   $0x804b04
+  8001ba:	6a 25                	push   $0x25
+  8001bc:	68 df 4a 80 00       	push   $0x804adf
+  8001c1:	e8 c7 01 00 00       	call   80038d <_panic>
+
+008001c6 <ls>:
+{
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	53                   	push   %ebx
+  8001ca:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001d3:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001d9:	50                   	push   %eax
+  8001da:	53                   	push   %ebx
+  8001db:	e8 93 18 00 00       	call   801a73 <stat>
+  8001e0:	83 c4 10             	add    $0x10,%esp
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	78 2c                	js     800213 <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	74 09                	je     8001f7 <ls+0x31>
+  8001ee:	83 3d 50 74 80 00 00 	cmpl   $0x0,0x807450
+  8001f5:	74 32                	je     800229 <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001f7:	53                   	push   %ebx
+  8001f8:	ff 75 ec             	push   -0x14(%ebp)
+  8001fb:	85 c0                	test   %eax,%eax
+  8001fd:	0f 95 c0             	setne  %al
+  800200:	0f b6 c0             	movzbl %al,%eax
+  800203:	50                   	push   %eax
+  800204:	6a 00                	push   $0x0
+  800206:	e8 28 fe ff ff       	call   800033 <ls1>
+  80020b:	83 c4 10             	add    $0x10,%esp
+}
+  80020e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  800213:	83 ec 0c             	sub    $0xc,%esp
+  800216:	50                   	push   %eax
+  800217:	53                   	push   %ebx
+  800218:	68 1f 4b 80 00       	push   $0x804b1f
+  80021d:	6a 0f                	push   $0xf
+  80021f:	68 df 4a 80 00       	push   $0x804adf
+  800224:	e8 64 01 00 00       	call   80038d <_panic>
+		lsdir(path, prefix);
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	ff 75 0c             	push   0xc(%ebp)
+  80022f:	53                   	push   %ebx
+  800230:	e8 c1 fe ff ff       	call   8000f6 <lsdir>
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	eb d4                	jmp    80020e <ls+0x48>
+
+0080023a <usage>:
+
+void
+usage(void)
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	83 ec 10             	sub    $0x10,%esp
+	sfprintf(stdout, "usage: ls [-dFl] [file...]\n");
+  800240:	68 2b 4b 80 00       	push   $0x804b2b
+  800245:	ff 35 f0 4f 80 00    	push   0x804ff0
+  80024b:	e8 f3 27 00 00       	call   802a43 <sfprintf>
+	exit();
+  800250:	e8 10 01 00 00       	call   800365 <exit>
+}
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+0080025a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	56                   	push   %esi
+  80025e:	53                   	push   %ebx
+  80025f:	83 ec 14             	sub    $0x14,%esp
+  800262:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800265:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  800268:	50                   	push   %eax
+  800269:	56                   	push   %esi
+  80026a:	8d 45 08             	lea    0x8(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	e8 b9 10 00 00       	call   80132c <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  800279:	eb 08                	jmp    800283 <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  80027b:	83 04 85 c0 72 80 00 	addl   $0x1,0x8072c0(,%eax,4)
+  800282:	01 
+	while ((i = argnext(&args)) >= 0)
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	53                   	push   %ebx
+  800287:	e8 d0 10 00 00       	call   80135c <argnext>
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	85 c0                	test   %eax,%eax
+  800291:	78 16                	js     8002a9 <umain+0x4f>
+		switch (i) {
+  800293:	89 c2                	mov    %eax,%edx
+  800295:	83 e2 f7             	and    $0xfffffff7,%edx
+  800298:	83 fa 64             	cmp    $0x64,%edx
+  80029b:	74 de                	je     80027b <umain+0x21>
+  80029d:	83 f8 46             	cmp    $0x46,%eax
+  8002a0:	74 d9                	je     80027b <umain+0x21>
+			break;
+		default:
+			usage();
+  8002a2:	e8 93 ff ff ff       	call   80023a <usage>
+  8002a7:	eb da                	jmp    800283 <umain+0x29>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  8002a9:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  8002ae:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8002b2:	75 2a                	jne    8002de <umain+0x84>
+		ls("/", "");
+  8002b4:	83 ec 08             	sub    $0x8,%esp
+  8002b7:	68 3f 52 80 00       	push   $0x80523f
+  8002bc:	68 c0 4a 80 00       	push   $0x804ac0
+  8002c1:	e8 00 ff ff ff       	call   8001c6 <ls>
+  8002c6:	83 c4 10             	add    $0x10,%esp
+  8002c9:	eb 18                	jmp    8002e3 <umain+0x89>
+			ls(argv[i], argv[i]);
+  8002cb:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	50                   	push   %eax
+  8002d2:	50                   	push   %eax
+  8002d3:	e8 ee fe ff ff       	call   8001c6 <ls>
+		for (i = 1; i < argc; i++)
+  8002d8:	83 c3 01             	add    $0x1,%ebx
+  8002db:	83 c4 10             	add    $0x10,%esp
+  8002de:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002e1:	7f e8                	jg     8002cb <umain+0x71>
+	}
+}
+  8002e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002e6:	5b                   	pop    %ebx
+  8002e7:	5e                   	pop    %esi
+  8002e8:	5d                   	pop    %ebp
+  8002e9:	c3                   	ret
+
+008002ea <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	83 ec 1c             	sub    $0x1c,%esp
+  8002f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8002f9:	e8 34 0b 00 00       	call   800e32 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8002fe:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800301:	89 15 c0 76 80 00    	mov    %edx,0x8076c0
+	thisenv = &envs[ENVX(eid)];
+  800307:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80030c:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80030e:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800310:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800316:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80031b:	77 16                	ja     800333 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80031d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800322:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800324:	c1 e8 10             	shr    $0x10,%eax
+  800327:	74 0a                	je     800333 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800329:	c1 e0 10             	shl    $0x10,%eax
+  80032c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800331:	29 c2                	sub    %eax,%edx
+  800333:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800336:	c1 e0 04             	shl    $0x4,%eax
+  800339:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80033e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800340:	85 db                	test   %ebx,%ebx
+  800342:	7e 07                	jle    80034b <libmain+0x61>
+		binaryname = argv[0];
+  800344:	8b 06                	mov    (%esi),%eax
+  800346:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80034b:	83 ec 08             	sub    $0x8,%esp
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  800350:	e8 05 ff ff ff       	call   80025a <umain>
+
+	// exit gracefully
+	exit();
+  800355:	e8 0b 00 00 00       	call   800365 <exit>
+}
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800360:	5b                   	pop    %ebx
+  800361:	5e                   	pop    %esi
+  800362:	5f                   	pop    %edi
+  800363:	5d                   	pop    %ebp
+  800364:	c3                   	ret
+
+00800365 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80036b:	6a 00                	push   $0x0
+  80036d:	e8 64 22 00 00       	call   8025d6 <fflush>
+	pthread_kill_others();
+  800372:	e8 cf 38 00 00       	call   803c46 <pthread_kill_others>
+	close_all();
+  800377:	e8 fd 12 00 00       	call   801679 <close_all>
+	sys_env_destroy(0);
+  80037c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800383:	e8 5f 0a 00 00       	call   800de7 <sys_env_destroy>
+}
+  800388:	83 c4 10             	add    $0x10,%esp
+  80038b:	c9                   	leave
+  80038c:	c3                   	ret
+
+0080038d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80038d:	55                   	push   %ebp
+  80038e:	89 e5                	mov    %esp,%ebp
+  800390:	56                   	push   %esi
+  800391:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800392:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800395:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80039b:	e8 92 0a 00 00       	call   800e32 <sys_getenvid>
+  8003a0:	83 ec 0c             	sub    $0xc,%esp
+  8003a3:	ff 75 0c             	push   0xc(%ebp)
+  8003a6:	ff 75 08             	push   0x8(%ebp)
+  8003a9:	56                   	push   %esi
+  8003aa:	50                   	push   %eax
+  8003ab:	68 54 4b 80 00       	push   $0x804b54
+  8003b0:	e8 b3 00 00 00       	call   800468 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003b5:	83 c4 18             	add    $0x18,%esp
+  8003b8:	53                   	push   %ebx
+  8003b9:	ff 75 10             	push   0x10(%ebp)
+  8003bc:	e8 56 00 00 00       	call   800417 <vcprintf>
+	cprintf("\n");
+  8003c1:	c7 04 24 3e 52 80 00 	movl   $0x80523e,(%esp)
+  8003c8:	e8 9b 00 00 00       	call   800468 <cprintf>
+  8003cd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003d0:	cc                   	int3
+	while (1)
+  8003d1:	eb fd                	jmp    8003d0 <_panic+0x43>
+
+008003d3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	53                   	push   %ebx
+  8003d7:	83 ec 04             	sub    $0x4,%esp
+  8003da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003dd:	8b 13                	mov    (%ebx),%edx
+  8003df:	8d 42 01             	lea    0x1(%edx),%eax
+  8003e2:	89 03                	mov    %eax,(%ebx)
+  8003e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003e7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003eb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003f0:	74 09                	je     8003fb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003f2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003f9:	c9                   	leave
+  8003fa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003fb:	83 ec 08             	sub    $0x8,%esp
+  8003fe:	68 ff 00 00 00       	push   $0xff
+  800403:	8d 43 08             	lea    0x8(%ebx),%eax
+  800406:	50                   	push   %eax
+  800407:	e8 84 09 00 00       	call   800d90 <sys_cputs>
+		b->idx = 0;
+  80040c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800412:	83 c4 10             	add    $0x10,%esp
+  800415:	eb db                	jmp    8003f2 <putch+0x1f>
+
+00800417 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800420:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800427:	00 00 00 
+	b.cnt = 0;
+  80042a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800431:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800434:	ff 75 0c             	push   0xc(%ebp)
+  800437:	ff 75 08             	push   0x8(%ebp)
+  80043a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800440:	50                   	push   %eax
+  800441:	68 d3 03 80 00       	push   $0x8003d3
+  800446:	e8 14 01 00 00       	call   80055f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80044b:	83 c4 08             	add    $0x8,%esp
+  80044e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800454:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80045a:	50                   	push   %eax
+  80045b:	e8 30 09 00 00       	call   800d90 <sys_cputs>
+
+	return b.cnt;
+}
+  800460:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800466:	c9                   	leave
+  800467:	c3                   	ret
+
+00800468 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800468:	55                   	push   %ebp
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80046e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800471:	50                   	push   %eax
+  800472:	ff 75 08             	push   0x8(%ebp)
+  800475:	e8 9d ff ff ff       	call   800417 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+0080047c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+  800482:	83 ec 1c             	sub    $0x1c,%esp
+  800485:	89 c7                	mov    %eax,%edi
+  800487:	89 d6                	mov    %edx,%esi
+  800489:	8b 45 08             	mov    0x8(%ebp),%eax
+  80048c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80048f:	89 d1                	mov    %edx,%ecx
+  800491:	89 c2                	mov    %eax,%edx
+  800493:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800496:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800499:	8b 45 10             	mov    0x10(%ebp),%eax
+  80049c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80049f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004a9:	39 c2                	cmp    %eax,%edx
+  8004ab:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004ae:	72 3e                	jb     8004ee <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004b0:	83 ec 0c             	sub    $0xc,%esp
+  8004b3:	ff 75 18             	push   0x18(%ebp)
+  8004b6:	83 eb 01             	sub    $0x1,%ebx
+  8004b9:	53                   	push   %ebx
+  8004ba:	50                   	push   %eax
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	ff 75 e4             	push   -0x1c(%ebp)
+  8004c1:	ff 75 e0             	push   -0x20(%ebp)
+  8004c4:	ff 75 dc             	push   -0x24(%ebp)
+  8004c7:	ff 75 d8             	push   -0x28(%ebp)
+  8004ca:	e8 70 44 00 00       	call   80493f <__udivdi3>
+  8004cf:	83 c4 18             	add    $0x18,%esp
+  8004d2:	52                   	push   %edx
+  8004d3:	50                   	push   %eax
+  8004d4:	89 f2                	mov    %esi,%edx
+  8004d6:	89 f8                	mov    %edi,%eax
+  8004d8:	e8 9f ff ff ff       	call   80047c <printnum>
+  8004dd:	83 c4 20             	add    $0x20,%esp
+  8004e0:	eb 13                	jmp    8004f5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	56                   	push   %esi
+  8004e6:	ff 75 18             	push   0x18(%ebp)
+  8004e9:	ff d7                	call   *%edi
+  8004eb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004ee:	83 eb 01             	sub    $0x1,%ebx
+  8004f1:	85 db                	test   %ebx,%ebx
+  8004f3:	7f ed                	jg     8004e2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	56                   	push   %esi
+  8004f9:	83 ec 04             	sub    $0x4,%esp
+  8004fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ff:	ff 75 e0             	push   -0x20(%ebp)
+  800502:	ff 75 dc             	push   -0x24(%ebp)
+  800505:	ff 75 d8             	push   -0x28(%ebp)
+  800508:	e8 53 44 00 00       	call   804960 <__umoddi3>
+  80050d:	83 c4 14             	add    $0x14,%esp
+  800510:	0f be 80 77 4b 80 00 	movsbl 0x804b77(%eax),%eax
+  800517:	50                   	push   %eax
+  800518:	ff d7                	call   *%edi
+}
+  80051a:	83 c4 10             	add    $0x10,%esp
+  80051d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800520:	5b                   	pop    %ebx
+  800521:	5e                   	pop    %esi
+  800522:	5f                   	pop    %edi
+  800523:	5d                   	pop    %ebp
+  800524:	c3                   	ret
+
+00800525 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80052b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80052f:	8b 10                	mov    (%eax),%edx
+  800531:	3b 50 04             	cmp    0x4(%eax),%edx
+  800534:	73 0a                	jae    800540 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800536:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800539:	89 08                	mov    %ecx,(%eax)
+  80053b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80053e:	88 02                	mov    %al,(%edx)
+}
+  800540:	5d                   	pop    %ebp
+  800541:	c3                   	ret
+
+00800542 <printfmt>:
+{
+  800542:	55                   	push   %ebp
+  800543:	89 e5                	mov    %esp,%ebp
+  800545:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800548:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80054b:	50                   	push   %eax
+  80054c:	ff 75 10             	push   0x10(%ebp)
+  80054f:	ff 75 0c             	push   0xc(%ebp)
+  800552:	ff 75 08             	push   0x8(%ebp)
+  800555:	e8 05 00 00 00       	call   80055f <vprintfmt>
+}
+  80055a:	83 c4 10             	add    $0x10,%esp
+  80055d:	c9                   	leave
+  80055e:	c3                   	ret
+
+0080055f <vprintfmt>:
+{
+  80055f:	55                   	push   %ebp
+  800560:	89 e5                	mov    %esp,%ebp
+  800562:	57                   	push   %edi
+  800563:	56                   	push   %esi
+  800564:	53                   	push   %ebx
+  800565:	83 ec 2c             	sub    $0x2c,%esp
+  800568:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80056e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800571:	eb 0a                	jmp    80057d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800573:	83 ec 08             	sub    $0x8,%esp
+  800576:	53                   	push   %ebx
+  800577:	50                   	push   %eax
+  800578:	ff d6                	call   *%esi
+  80057a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80057d:	83 c7 01             	add    $0x1,%edi
+  800580:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800584:	83 f8 25             	cmp    $0x25,%eax
+  800587:	74 0c                	je     800595 <vprintfmt+0x36>
+			if (ch == '\0')
+  800589:	85 c0                	test   %eax,%eax
+  80058b:	75 e6                	jne    800573 <vprintfmt+0x14>
+}
+  80058d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800590:	5b                   	pop    %ebx
+  800591:	5e                   	pop    %esi
+  800592:	5f                   	pop    %edi
+  800593:	5d                   	pop    %ebp
+  800594:	c3                   	ret
+		padc = ' ';
+  800595:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800599:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005a0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005a7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8005b3:	8d 47 01             	lea    0x1(%edi),%eax
+  8005b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005b9:	0f b6 17             	movzbl (%edi),%edx
+  8005bc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005bf:	3c 55                	cmp    $0x55,%al
+  8005c1:	0f 87 c5 03 00 00    	ja     80098c <vprintfmt+0x42d>
+  8005c7:	0f b6 c0             	movzbl %al,%eax
+  8005ca:	ff 24 85 00 4d 80 00 	jmp    *0x804d00(,%eax,4)
+  8005d1:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8005d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005d7:	eb da                	jmp    8005b3 <vprintfmt+0x54>
+  8005d9:	0f be d2             	movsbl %dl,%edx
+  8005dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005e7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005ea:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005ee:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005f1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005f4:	83 f9 09             	cmp    $0x9,%ecx
+  8005f7:	77 55                	ja     80064e <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8005f9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005fc:	eb e9                	jmp    8005e7 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 00                	mov    (%eax),%eax
+  800603:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80060f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800612:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800616:	79 9b                	jns    8005b3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800618:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80061b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800625:	eb 8c                	jmp    8005b3 <vprintfmt+0x54>
+			if (width < 0)
+  800627:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80062a:	85 d2                	test   %edx,%edx
+  80062c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800631:	0f 49 c2             	cmovns %edx,%eax
+  800634:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80063a:	e9 74 ff ff ff       	jmp    8005b3 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80063f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800642:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800649:	e9 65 ff ff ff       	jmp    8005b3 <vprintfmt+0x54>
+  80064e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800651:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800654:	eb bc                	jmp    800612 <vprintfmt+0xb3>
+			lflag++;
+  800656:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800659:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80065c:	e9 52 ff ff ff       	jmp    8005b3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8d 78 04             	lea    0x4(%eax),%edi
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	ff 30                	push   (%eax)
+  80066d:	ff d6                	call   *%esi
+			break;
+  80066f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800672:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800675:	e9 b1 02 00 00       	jmp    80092b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800680:	8b 10                	mov    (%eax),%edx
+  800682:	89 d0                	mov    %edx,%eax
+  800684:	f7 d8                	neg    %eax
+  800686:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800689:	83 f8 14             	cmp    $0x14,%eax
+  80068c:	7f 23                	jg     8006b1 <vprintfmt+0x152>
+  80068e:	8b 14 85 60 4e 80 00 	mov    0x804e60(,%eax,4),%edx
+  800695:	85 d2                	test   %edx,%edx
+  800697:	74 18                	je     8006b1 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800699:	52                   	push   %edx
+  80069a:	68 cf 4f 80 00       	push   $0x804fcf
+  80069f:	53                   	push   %ebx
+  8006a0:	56                   	push   %esi
+  8006a1:	e8 9c fe ff ff       	call   800542 <printfmt>
+  8006a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006ac:	e9 7a 02 00 00       	jmp    80092b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8006b1:	50                   	push   %eax
+  8006b2:	68 8f 4b 80 00       	push   $0x804b8f
+  8006b7:	53                   	push   %ebx
+  8006b8:	56                   	push   %esi
+  8006b9:	e8 84 fe ff ff       	call   800542 <printfmt>
+  8006be:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006c4:	e9 62 02 00 00       	jmp    80092b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	83 c0 04             	add    $0x4,%eax
+  8006cf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006d7:	85 c9                	test   %ecx,%ecx
+  8006d9:	b8 88 4b 80 00       	mov    $0x804b88,%eax
+  8006de:	0f 45 c1             	cmovne %ecx,%eax
+  8006e1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006e4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006e8:	7e 06                	jle    8006f0 <vprintfmt+0x191>
+  8006ea:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006ee:	75 0b                	jne    8006fb <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006f3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006f6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006f9:	eb 5c                	jmp    800757 <vprintfmt+0x1f8>
+  8006fb:	83 ec 08             	sub    $0x8,%esp
+  8006fe:	ff 75 d0             	push   -0x30(%ebp)
+  800701:	ff 75 cc             	push   -0x34(%ebp)
+  800704:	e8 20 03 00 00       	call   800a29 <strnlen>
+  800709:	89 c2                	mov    %eax,%edx
+  80070b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80070e:	29 d0                	sub    %edx,%eax
+  800710:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800713:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800717:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80071a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80071d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80071f:	eb 0e                	jmp    80072f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	53                   	push   %ebx
+  800725:	57                   	push   %edi
+  800726:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800729:	83 ee 01             	sub    $0x1,%esi
+  80072c:	83 c4 10             	add    $0x10,%esp
+  80072f:	85 f6                	test   %esi,%esi
+  800731:	7f ee                	jg     800721 <vprintfmt+0x1c2>
+  800733:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800736:	8b 75 08             	mov    0x8(%ebp),%esi
+  800739:	85 c0                	test   %eax,%eax
+  80073b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800740:	0f 49 d0             	cmovns %eax,%edx
+  800743:	29 d0                	sub    %edx,%eax
+  800745:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800748:	eb a6                	jmp    8006f0 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	52                   	push   %edx
+  80074f:	ff 55 08             	call   *0x8(%ebp)
+  800752:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800755:	89 f1                	mov    %esi,%ecx
+  800757:	8d 71 01             	lea    0x1(%ecx),%esi
+  80075a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80075e:	0f be d0             	movsbl %al,%edx
+  800761:	85 d2                	test   %edx,%edx
+  800763:	74 28                	je     80078d <vprintfmt+0x22e>
+  800765:	85 ff                	test   %edi,%edi
+  800767:	78 05                	js     80076e <vprintfmt+0x20f>
+  800769:	83 ef 01             	sub    $0x1,%edi
+  80076c:	78 30                	js     80079e <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80076e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800772:	74 d6                	je     80074a <vprintfmt+0x1eb>
+  800774:	0f be c0             	movsbl %al,%eax
+  800777:	83 e8 20             	sub    $0x20,%eax
+  80077a:	83 f8 5e             	cmp    $0x5e,%eax
+  80077d:	76 cb                	jbe    80074a <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80077f:	83 ec 08             	sub    $0x8,%esp
+  800782:	53                   	push   %ebx
+  800783:	6a 3f                	push   $0x3f
+  800785:	ff 55 08             	call   *0x8(%ebp)
+  800788:	83 c4 10             	add    $0x10,%esp
+  80078b:	eb c8                	jmp    800755 <vprintfmt+0x1f6>
+  80078d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800790:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800793:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800796:	01 d0                	add    %edx,%eax
+  800798:	29 c8                	sub    %ecx,%eax
+  80079a:	89 c7                	mov    %eax,%edi
+  80079c:	eb 13                	jmp    8007b1 <vprintfmt+0x252>
+  80079e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a1:	eb ed                	jmp    800790 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	53                   	push   %ebx
+  8007a7:	6a 20                	push   $0x20
+  8007a9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007ab:	83 ef 01             	sub    $0x1,%edi
+  8007ae:	83 c4 10             	add    $0x10,%esp
+  8007b1:	85 ff                	test   %edi,%edi
+  8007b3:	7f ee                	jg     8007a3 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007b5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bb:	e9 6b 01 00 00       	jmp    80092b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8007c0:	83 f9 01             	cmp    $0x1,%ecx
+  8007c3:	7f 1f                	jg     8007e4 <vprintfmt+0x285>
+	else if (lflag)
+  8007c5:	85 c9                	test   %ecx,%ecx
+  8007c7:	74 67                	je     800830 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8007c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cc:	8b 00                	mov    (%eax),%eax
+  8007ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d1:	89 c1                	mov    %eax,%ecx
+  8007d3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007d6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e2:	eb 17                	jmp    8007fb <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 50 04             	mov    0x4(%eax),%edx
+  8007ea:	8b 00                	mov    (%eax),%eax
+  8007ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ef:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800801:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800806:	85 c9                	test   %ecx,%ecx
+  800808:	0f 89 03 01 00 00    	jns    800911 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80080e:	83 ec 08             	sub    $0x8,%esp
+  800811:	53                   	push   %ebx
+  800812:	6a 2d                	push   $0x2d
+  800814:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800816:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800819:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80081c:	f7 da                	neg    %edx
+  80081e:	83 d1 00             	adc    $0x0,%ecx
+  800821:	f7 d9                	neg    %ecx
+  800823:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800826:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80082b:	e9 e1 00 00 00       	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800830:	8b 45 14             	mov    0x14(%ebp),%eax
+  800833:	8b 00                	mov    (%eax),%eax
+  800835:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800838:	89 c1                	mov    %eax,%ecx
+  80083a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80083d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8d 40 04             	lea    0x4(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+  800849:	eb b0                	jmp    8007fb <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80084b:	83 f9 01             	cmp    $0x1,%ecx
+  80084e:	7f 1e                	jg     80086e <vprintfmt+0x30f>
+	else if (lflag)
+  800850:	85 c9                	test   %ecx,%ecx
+  800852:	74 32                	je     800886 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 10                	mov    (%eax),%edx
+  800859:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085e:	8d 40 04             	lea    0x4(%eax),%eax
+  800861:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800864:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800869:	e9 a3 00 00 00       	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8b 10                	mov    (%eax),%edx
+  800873:	8b 48 04             	mov    0x4(%eax),%ecx
+  800876:	8d 40 08             	lea    0x8(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80087c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800881:	e9 8b 00 00 00       	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8b 10                	mov    (%eax),%edx
+  80088b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800890:	8d 40 04             	lea    0x4(%eax),%eax
+  800893:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80089b:	eb 74                	jmp    800911 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80089d:	83 f9 01             	cmp    $0x1,%ecx
+  8008a0:	7f 1b                	jg     8008bd <vprintfmt+0x35e>
+	else if (lflag)
+  8008a2:	85 c9                	test   %ecx,%ecx
+  8008a4:	74 2c                	je     8008d2 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8008a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a9:	8b 10                	mov    (%eax),%edx
+  8008ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008b6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8008bb:	eb 54                	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c0:	8b 10                	mov    (%eax),%edx
+  8008c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008cb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008d0:	eb 3f                	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d5:	8b 10                	mov    (%eax),%edx
+  8008d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008e2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008e7:	eb 28                	jmp    800911 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8008e9:	83 ec 08             	sub    $0x8,%esp
+  8008ec:	53                   	push   %ebx
+  8008ed:	6a 30                	push   $0x30
+  8008ef:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008f1:	83 c4 08             	add    $0x8,%esp
+  8008f4:	53                   	push   %ebx
+  8008f5:	6a 78                	push   $0x78
+  8008f7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fc:	8b 10                	mov    (%eax),%edx
+  8008fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800903:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800906:	8d 40 04             	lea    0x4(%eax),%eax
+  800909:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80090c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800911:	83 ec 0c             	sub    $0xc,%esp
+  800914:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800918:	50                   	push   %eax
+  800919:	ff 75 e0             	push   -0x20(%ebp)
+  80091c:	57                   	push   %edi
+  80091d:	51                   	push   %ecx
+  80091e:	52                   	push   %edx
+  80091f:	89 da                	mov    %ebx,%edx
+  800921:	89 f0                	mov    %esi,%eax
+  800923:	e8 54 fb ff ff       	call   80047c <printnum>
+			break;
+  800928:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80092b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80092e:	e9 4a fc ff ff       	jmp    80057d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800933:	83 f9 01             	cmp    $0x1,%ecx
+  800936:	7f 1b                	jg     800953 <vprintfmt+0x3f4>
+	else if (lflag)
+  800938:	85 c9                	test   %ecx,%ecx
+  80093a:	74 2c                	je     800968 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80093c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093f:	8b 10                	mov    (%eax),%edx
+  800941:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800946:	8d 40 04             	lea    0x4(%eax),%eax
+  800949:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80094c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800951:	eb be                	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8b 10                	mov    (%eax),%edx
+  800958:	8b 48 04             	mov    0x4(%eax),%ecx
+  80095b:	8d 40 08             	lea    0x8(%eax),%eax
+  80095e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800961:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800966:	eb a9                	jmp    800911 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800968:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096b:	8b 10                	mov    (%eax),%edx
+  80096d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800972:	8d 40 04             	lea    0x4(%eax),%eax
+  800975:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800978:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80097d:	eb 92                	jmp    800911 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	53                   	push   %ebx
+  800983:	6a 25                	push   $0x25
+  800985:	ff d6                	call   *%esi
+			break;
+  800987:	83 c4 10             	add    $0x10,%esp
+  80098a:	eb 9f                	jmp    80092b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80098c:	83 ec 08             	sub    $0x8,%esp
+  80098f:	53                   	push   %ebx
+  800990:	6a 25                	push   $0x25
+  800992:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800994:	83 c4 10             	add    $0x10,%esp
+  800997:	89 f8                	mov    %edi,%eax
+  800999:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80099d:	74 05                	je     8009a4 <vprintfmt+0x445>
+  80099f:	83 e8 01             	sub    $0x1,%eax
+  8009a2:	eb f5                	jmp    800999 <vprintfmt+0x43a>
+  8009a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009a7:	eb 82                	jmp    80092b <vprintfmt+0x3cc>
+
+008009a9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 18             	sub    $0x18,%esp
+  8009af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009b8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009bc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009c6:	85 c0                	test   %eax,%eax
+  8009c8:	74 26                	je     8009f0 <vsnprintf+0x47>
+  8009ca:	85 d2                	test   %edx,%edx
+  8009cc:	7e 22                	jle    8009f0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009ce:	ff 75 14             	push   0x14(%ebp)
+  8009d1:	ff 75 10             	push   0x10(%ebp)
+  8009d4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009d7:	50                   	push   %eax
+  8009d8:	68 25 05 80 00       	push   $0x800525
+  8009dd:	e8 7d fb ff ff       	call   80055f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009e2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009e5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009eb:	83 c4 10             	add    $0x10,%esp
+}
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+		return -E_INVAL;
+  8009f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f5:	eb f7                	jmp    8009ee <vsnprintf+0x45>
+
+008009f7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a00:	50                   	push   %eax
+  800a01:	ff 75 10             	push   0x10(%ebp)
+  800a04:	ff 75 0c             	push   0xc(%ebp)
+  800a07:	ff 75 08             	push   0x8(%ebp)
+  800a0a:	e8 9a ff ff ff       	call   8009a9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a0f:	c9                   	leave
+  800a10:	c3                   	ret
+
+00800a11 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1c:	eb 03                	jmp    800a21 <strlen+0x10>
+		n++;
+  800a1e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a21:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a25:	75 f7                	jne    800a1e <strlen+0xd>
+	return n;
+}
+  800a27:	5d                   	pop    %ebp
+  800a28:	c3                   	ret
+
+00800a29 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a37:	eb 03                	jmp    800a3c <strnlen+0x13>
+		n++;
+  800a39:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a3c:	39 d0                	cmp    %edx,%eax
+  800a3e:	74 08                	je     800a48 <strnlen+0x1f>
+  800a40:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a44:	75 f3                	jne    800a39 <strnlen+0x10>
+  800a46:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a48:	89 d0                	mov    %edx,%eax
+  800a4a:	5d                   	pop    %ebp
+  800a4b:	c3                   	ret
+
+00800a4c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a4c:	55                   	push   %ebp
+  800a4d:	89 e5                	mov    %esp,%ebp
+  800a4f:	53                   	push   %ebx
+  800a50:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a5f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a62:	83 c0 01             	add    $0x1,%eax
+  800a65:	84 d2                	test   %dl,%dl
+  800a67:	75 f2                	jne    800a5b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a69:	89 c8                	mov    %ecx,%eax
+  800a6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	53                   	push   %ebx
+  800a74:	83 ec 10             	sub    $0x10,%esp
+  800a77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a7a:	53                   	push   %ebx
+  800a7b:	e8 91 ff ff ff       	call   800a11 <strlen>
+  800a80:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a83:	ff 75 0c             	push   0xc(%ebp)
+  800a86:	01 d8                	add    %ebx,%eax
+  800a88:	50                   	push   %eax
+  800a89:	e8 be ff ff ff       	call   800a4c <strcpy>
+	return dst;
+}
+  800a8e:	89 d8                	mov    %ebx,%eax
+  800a90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a93:	c9                   	leave
+  800a94:	c3                   	ret
+
+00800a95 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a95:	55                   	push   %ebp
+  800a96:	89 e5                	mov    %esp,%ebp
+  800a98:	56                   	push   %esi
+  800a99:	53                   	push   %ebx
+  800a9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aa0:	89 f3                	mov    %esi,%ebx
+  800aa2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800aa5:	89 f0                	mov    %esi,%eax
+  800aa7:	eb 0f                	jmp    800ab8 <strncpy+0x23>
+		*dst++ = *src;
+  800aa9:	83 c0 01             	add    $0x1,%eax
+  800aac:	0f b6 0a             	movzbl (%edx),%ecx
+  800aaf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ab2:	80 f9 01             	cmp    $0x1,%cl
+  800ab5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ab8:	39 d8                	cmp    %ebx,%eax
+  800aba:	75 ed                	jne    800aa9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800abc:	89 f0                	mov    %esi,%eax
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	56                   	push   %esi
+  800ac6:	53                   	push   %ebx
+  800ac7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800acd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ad0:	89 f0                	mov    %esi,%eax
+  800ad2:	85 d2                	test   %edx,%edx
+  800ad4:	74 21                	je     800af7 <strlcpy+0x35>
+  800ad6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ada:	89 f2                	mov    %esi,%edx
+  800adc:	eb 09                	jmp    800ae7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ade:	83 c1 01             	add    $0x1,%ecx
+  800ae1:	83 c2 01             	add    $0x1,%edx
+  800ae4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ae7:	39 c2                	cmp    %eax,%edx
+  800ae9:	74 09                	je     800af4 <strlcpy+0x32>
+  800aeb:	0f b6 19             	movzbl (%ecx),%ebx
+  800aee:	84 db                	test   %bl,%bl
+  800af0:	75 ec                	jne    800ade <strlcpy+0x1c>
+  800af2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800af4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800af7:	29 f0                	sub    %esi,%eax
+}
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b03:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b06:	eb 06                	jmp    800b0e <strcmp+0x11>
+		p++, q++;
+  800b08:	83 c1 01             	add    $0x1,%ecx
+  800b0b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b0e:	0f b6 01             	movzbl (%ecx),%eax
+  800b11:	84 c0                	test   %al,%al
+  800b13:	74 04                	je     800b19 <strcmp+0x1c>
+  800b15:	3a 02                	cmp    (%edx),%al
+  800b17:	74 ef                	je     800b08 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b19:	0f b6 c0             	movzbl %al,%eax
+  800b1c:	0f b6 12             	movzbl (%edx),%edx
+  800b1f:	29 d0                	sub    %edx,%eax
+}
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	53                   	push   %ebx
+  800b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b30:	eb 09                	jmp    800b3b <strncmp+0x18>
+		n--, p++, q++;
+  800b32:	83 ea 01             	sub    $0x1,%edx
+  800b35:	83 c0 01             	add    $0x1,%eax
+  800b38:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b3b:	85 d2                	test   %edx,%edx
+  800b3d:	74 18                	je     800b57 <strncmp+0x34>
+  800b3f:	0f b6 18             	movzbl (%eax),%ebx
+  800b42:	84 db                	test   %bl,%bl
+  800b44:	74 04                	je     800b4a <strncmp+0x27>
+  800b46:	3a 19                	cmp    (%ecx),%bl
+  800b48:	74 e8                	je     800b32 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b4a:	0f b6 00             	movzbl (%eax),%eax
+  800b4d:	0f b6 11             	movzbl (%ecx),%edx
+  800b50:	29 d0                	sub    %edx,%eax
+}
+  800b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b55:	c9                   	leave
+  800b56:	c3                   	ret
+		return 0;
+  800b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5c:	eb f4                	jmp    800b52 <strncmp+0x2f>
+
+00800b5e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b64:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b68:	eb 03                	jmp    800b6d <strchr+0xf>
+  800b6a:	83 c0 01             	add    $0x1,%eax
+  800b6d:	0f b6 10             	movzbl (%eax),%edx
+  800b70:	84 d2                	test   %dl,%dl
+  800b72:	74 06                	je     800b7a <strchr+0x1c>
+		if (*s == c)
+  800b74:	38 ca                	cmp    %cl,%dl
+  800b76:	75 f2                	jne    800b6a <strchr+0xc>
+  800b78:	eb 05                	jmp    800b7f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b87:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b8b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b8e:	38 ca                	cmp    %cl,%dl
+  800b90:	74 09                	je     800b9b <strfind+0x1a>
+  800b92:	84 d2                	test   %dl,%dl
+  800b94:	74 05                	je     800b9b <strfind+0x1a>
+	for (; *s; s++)
+  800b96:	83 c0 01             	add    $0x1,%eax
+  800b99:	eb f0                	jmp    800b8b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ba4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ba7:	85 c9                	test   %ecx,%ecx
+  800ba9:	74 20                	je     800bcb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bab:	89 f8                	mov    %edi,%eax
+  800bad:	09 c8                	or     %ecx,%eax
+  800baf:	a8 03                	test   $0x3,%al
+  800bb1:	75 12                	jne    800bc5 <memset+0x28>
+		c &= 0xFF;
+  800bb3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bb7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bbd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bc0:	fc                   	cld
+  800bc1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bc3:	eb 06                	jmp    800bcb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc8:	fc                   	cld
+  800bc9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bcb:	89 f8                	mov    %edi,%eax
+  800bcd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bd0:	c9                   	leave
+  800bd1:	c3                   	ret
+
+00800bd2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	56                   	push   %esi
+  800bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bda:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bdd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800be0:	39 c6                	cmp    %eax,%esi
+  800be2:	73 32                	jae    800c16 <memmove+0x44>
+  800be4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800be7:	39 d0                	cmp    %edx,%eax
+  800be9:	73 2b                	jae    800c16 <memmove+0x44>
+		s += n;
+		d += n;
+  800beb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bee:	89 d6                	mov    %edx,%esi
+  800bf0:	09 fe                	or     %edi,%esi
+  800bf2:	09 ce                	or     %ecx,%esi
+  800bf4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bfa:	75 0e                	jne    800c0a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bfc:	83 ef 04             	sub    $0x4,%edi
+  800bff:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c02:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c05:	fd                   	std
+  800c06:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c08:	eb 09                	jmp    800c13 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c0a:	83 ef 01             	sub    $0x1,%edi
+  800c0d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c10:	fd                   	std
+  800c11:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c13:	fc                   	cld
+  800c14:	eb 1a                	jmp    800c30 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c16:	89 f2                	mov    %esi,%edx
+  800c18:	09 c2                	or     %eax,%edx
+  800c1a:	09 ca                	or     %ecx,%edx
+  800c1c:	f6 c2 03             	test   $0x3,%dl
+  800c1f:	75 0a                	jne    800c2b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c21:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c24:	89 c7                	mov    %eax,%edi
+  800c26:	fc                   	cld
+  800c27:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c29:	eb 05                	jmp    800c30 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c2b:	89 c7                	mov    %eax,%edi
+  800c2d:	fc                   	cld
+  800c2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c30:	5e                   	pop    %esi
+  800c31:	5f                   	pop    %edi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c3a:	ff 75 10             	push   0x10(%ebp)
+  800c3d:	ff 75 0c             	push   0xc(%ebp)
+  800c40:	ff 75 08             	push   0x8(%ebp)
+  800c43:	e8 8a ff ff ff       	call   800bd2 <memmove>
+}
+  800c48:	c9                   	leave
+  800c49:	c3                   	ret
+
+00800c4a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c52:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c55:	89 c6                	mov    %eax,%esi
+  800c57:	03 75 10             	add    0x10(%ebp),%esi
+  800c5a:	eb 06                	jmp    800c62 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c5c:	83 c0 01             	add    $0x1,%eax
+  800c5f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c62:	39 f0                	cmp    %esi,%eax
+  800c64:	74 14                	je     800c7a <memcmp+0x30>
+		if (*s1 != *s2)
+  800c66:	0f b6 08             	movzbl (%eax),%ecx
+  800c69:	0f b6 1a             	movzbl (%edx),%ebx
+  800c6c:	38 d9                	cmp    %bl,%cl
+  800c6e:	74 ec                	je     800c5c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c70:	0f b6 c1             	movzbl %cl,%eax
+  800c73:	0f b6 db             	movzbl %bl,%ebx
+  800c76:	29 d8                	sub    %ebx,%eax
+  800c78:	eb 05                	jmp    800c7f <memcmp+0x35>
+	}
+
+	return 0;
+  800c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c7f:	5b                   	pop    %ebx
+  800c80:	5e                   	pop    %esi
+  800c81:	5d                   	pop    %ebp
+  800c82:	c3                   	ret
+
+00800c83 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c8c:	89 c2                	mov    %eax,%edx
+  800c8e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c91:	eb 03                	jmp    800c96 <memfind+0x13>
+  800c93:	83 c0 01             	add    $0x1,%eax
+  800c96:	39 d0                	cmp    %edx,%eax
+  800c98:	73 04                	jae    800c9e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c9a:	38 08                	cmp    %cl,(%eax)
+  800c9c:	75 f5                	jne    800c93 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+
+00800ca0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	57                   	push   %edi
+  800ca4:	56                   	push   %esi
+  800ca5:	53                   	push   %ebx
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cac:	eb 03                	jmp    800cb1 <strtol+0x11>
+		s++;
+  800cae:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cb1:	0f b6 02             	movzbl (%edx),%eax
+  800cb4:	3c 20                	cmp    $0x20,%al
+  800cb6:	74 f6                	je     800cae <strtol+0xe>
+  800cb8:	3c 09                	cmp    $0x9,%al
+  800cba:	74 f2                	je     800cae <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cbc:	3c 2b                	cmp    $0x2b,%al
+  800cbe:	74 2a                	je     800cea <strtol+0x4a>
+	int neg = 0;
+  800cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cc5:	3c 2d                	cmp    $0x2d,%al
+  800cc7:	74 2b                	je     800cf4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cc9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ccf:	75 0f                	jne    800ce0 <strtol+0x40>
+  800cd1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cd4:	74 28                	je     800cfe <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cd6:	85 db                	test   %ebx,%ebx
+  800cd8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cdd:	0f 44 d8             	cmove  %eax,%ebx
+  800ce0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce8:	eb 46                	jmp    800d30 <strtol+0x90>
+		s++;
+  800cea:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cf2:	eb d5                	jmp    800cc9 <strtol+0x29>
+		s++, neg = 1;
+  800cf4:	83 c2 01             	add    $0x1,%edx
+  800cf7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cfc:	eb cb                	jmp    800cc9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cfe:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d02:	74 0e                	je     800d12 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d04:	85 db                	test   %ebx,%ebx
+  800d06:	75 d8                	jne    800ce0 <strtol+0x40>
+		s++, base = 8;
+  800d08:	83 c2 01             	add    $0x1,%edx
+  800d0b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d10:	eb ce                	jmp    800ce0 <strtol+0x40>
+		s += 2, base = 16;
+  800d12:	83 c2 02             	add    $0x2,%edx
+  800d15:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d1a:	eb c4                	jmp    800ce0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d1c:	0f be c0             	movsbl %al,%eax
+  800d1f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d22:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d25:	7d 3a                	jge    800d61 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d27:	83 c2 01             	add    $0x1,%edx
+  800d2a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d2e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d30:	0f b6 02             	movzbl (%edx),%eax
+  800d33:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d36:	89 f3                	mov    %esi,%ebx
+  800d38:	80 fb 09             	cmp    $0x9,%bl
+  800d3b:	76 df                	jbe    800d1c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d3d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d40:	89 f3                	mov    %esi,%ebx
+  800d42:	80 fb 19             	cmp    $0x19,%bl
+  800d45:	77 08                	ja     800d4f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d47:	0f be c0             	movsbl %al,%eax
+  800d4a:	83 e8 57             	sub    $0x57,%eax
+  800d4d:	eb d3                	jmp    800d22 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d4f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d52:	89 f3                	mov    %esi,%ebx
+  800d54:	80 fb 19             	cmp    $0x19,%bl
+  800d57:	77 08                	ja     800d61 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d59:	0f be c0             	movsbl %al,%eax
+  800d5c:	83 e8 37             	sub    $0x37,%eax
+  800d5f:	eb c1                	jmp    800d22 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d61:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d65:	74 05                	je     800d6c <strtol+0xcc>
+		*endptr = (char *) s;
+  800d67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d6a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d6c:	89 c8                	mov    %ecx,%eax
+  800d6e:	f7 d8                	neg    %eax
+  800d70:	85 ff                	test   %edi,%edi
+  800d72:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d75:	89 c8                	mov    %ecx,%eax
+  800d77:	5b                   	pop    %ebx
+  800d78:	5e                   	pop    %esi
+  800d79:	5f                   	pop    %edi
+  800d7a:	5d                   	pop    %ebp
+  800d7b:	c3                   	ret
+
+00800d7c <atoi>:
+
+int
+atoi(const char* s)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800d82:	6a 00                	push   $0x0
+  800d84:	6a 00                	push   $0x0
+  800d86:	ff 75 08             	push   0x8(%ebp)
+  800d89:	e8 12 ff ff ff       	call   800ca0 <strtol>
+}
+  800d8e:	c9                   	leave
+  800d8f:	c3                   	ret
+
+00800d90 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	89 c3                	mov    %eax,%ebx
+  800da2:	89 c7                	mov    %eax,%edi
+  800da4:	6a 00                	push   $0x0
+  800da6:	55                   	push   %ebp
+  800da7:	56                   	push   %esi
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	8d 35 b2 0d 80 00    	lea    0x800db2,%esi
+  800db0:	0f 34                	sysenter
+
+00800db2 <after_sysenter_label_47>:
+  800db2:	5e                   	pop    %esi
+  800db3:	5d                   	pop    %ebp
+  800db4:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800db7:	5b                   	pop    %ebx
+  800db8:	5f                   	pop    %edi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+
+00800dbb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	57                   	push   %edi
+  800dbf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dca:	89 d1                	mov    %edx,%ecx
+  800dcc:	89 d3                	mov    %edx,%ebx
+  800dce:	89 d7                	mov    %edx,%edi
+  800dd0:	6a 00                	push   $0x0
+  800dd2:	55                   	push   %ebp
+  800dd3:	56                   	push   %esi
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	8d 35 de 0d 80 00    	lea    0x800dde,%esi
+  800ddc:	0f 34                	sysenter
+
+00800dde <after_sysenter_label_128>:
+  800dde:	5e                   	pop    %esi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800de3:	5b                   	pop    %ebx
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+
+00800de7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800def:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df9:	89 cb                	mov    %ecx,%ebx
+  800dfb:	89 cf                	mov    %ecx,%edi
+  800dfd:	6a 00                	push   $0x0
+  800dff:	55                   	push   %ebp
+  800e00:	56                   	push   %esi
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	8d 35 0b 0e 80 00    	lea    0x800e0b,%esi
+  800e09:	0f 34                	sysenter
+
+00800e0b <after_sysenter_label_212>:
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e10:	85 c0                	test   %eax,%eax
+  800e12:	7f 07                	jg     800e1b <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e17:	5b                   	pop    %ebx
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	6a 03                	push   $0x3
+  800e21:	68 f5 4e 80 00       	push   $0x804ef5
+  800e26:	6a 54                	push   $0x54
+  800e28:	68 12 4f 80 00       	push   $0x804f12
+  800e2d:	e8 5b f5 ff ff       	call   80038d <_panic>
+
+00800e32 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e41:	89 d1                	mov    %edx,%ecx
+  800e43:	89 d3                	mov    %edx,%ebx
+  800e45:	89 d7                	mov    %edx,%edi
+  800e47:	6a 00                	push   $0x0
+  800e49:	55                   	push   %ebp
+  800e4a:	56                   	push   %esi
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	8d 35 55 0e 80 00    	lea    0x800e55,%esi
+  800e53:	0f 34                	sysenter
+
+00800e55 <after_sysenter_label_309>:
+  800e55:	5e                   	pop    %esi
+  800e56:	5d                   	pop    %ebp
+  800e57:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e68:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e6d:	89 d1                	mov    %edx,%ecx
+  800e6f:	89 d3                	mov    %edx,%ebx
+  800e71:	89 d7                	mov    %edx,%edi
+  800e73:	6a 00                	push   $0x0
+  800e75:	55                   	push   %ebp
+  800e76:	56                   	push   %esi
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	8d 35 81 0e 80 00    	lea    0x800e81,%esi
+  800e7f:	0f 34                	sysenter
+
+00800e81 <after_sysenter_label_391>:
+  800e81:	5e                   	pop    %esi
+  800e82:	5d                   	pop    %ebp
+  800e83:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e86:	5b                   	pop    %ebx
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+
+00800e8a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea2:	6a 00                	push   $0x0
+  800ea4:	55                   	push   %ebp
+  800ea5:	56                   	push   %esi
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	8d 35 b0 0e 80 00    	lea    0x800eb0,%esi
+  800eae:	0f 34                	sysenter
+
+00800eb0 <after_sysenter_label_479>:
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eb5:	85 c0                	test   %eax,%eax
+  800eb7:	7f 07                	jg     800ec0 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebc:	5b                   	pop    %ebx
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	6a 04                	push   $0x4
+  800ec6:	68 f5 4e 80 00       	push   $0x804ef5
+  800ecb:	6a 54                	push   $0x54
+  800ecd:	68 12 4f 80 00       	push   $0x804f12
+  800ed2:	e8 b6 f4 ff ff       	call   80038d <_panic>
+
+00800ed7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eed:	ff 75 18             	push   0x18(%ebp)
+  800ef0:	55                   	push   %ebp
+  800ef1:	56                   	push   %esi
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	8d 35 fc 0e 80 00    	lea    0x800efc,%esi
+  800efa:	0f 34                	sysenter
+
+00800efc <after_sysenter_label_593>:
+  800efc:	5e                   	pop    %esi
+  800efd:	5d                   	pop    %ebp
+  800efe:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 07                	jg     800f0c <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  800f0f:	50                   	push   %eax
+  800f10:	6a 05                	push   $0x5
+  800f12:	68 f5 4e 80 00       	push   $0x804ef5
+  800f17:	6a 54                	push   $0x54
+  800f19:	68 12 4f 80 00       	push   $0x804f12
+  800f1e:	e8 6a f4 ff ff       	call   80038d <_panic>
+
+00800f23 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	6a 00                	push   $0x0
+  800f3c:	55                   	push   %ebp
+  800f3d:	56                   	push   %esi
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	8d 35 48 0f 80 00    	lea    0x800f48,%esi
+  800f46:	0f 34                	sysenter
+
+00800f48 <after_sysenter_label_704>:
+  800f48:	5e                   	pop    %esi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 07                	jg     800f58 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	50                   	push   %eax
+  800f5c:	6a 06                	push   $0x6
+  800f5e:	68 f5 4e 80 00       	push   $0x804ef5
+  800f63:	6a 54                	push   $0x54
+  800f65:	68 12 4f 80 00       	push   $0x804f12
+  800f6a:	e8 1e f4 ff ff       	call   80038d <_panic>
+
+00800f6f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	57                   	push   %edi
+  800f73:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f84:	89 df                	mov    %ebx,%edi
+  800f86:	6a 00                	push   $0x0
+  800f88:	55                   	push   %ebp
+  800f89:	56                   	push   %esi
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	8d 35 94 0f 80 00    	lea    0x800f94,%esi
+  800f92:	0f 34                	sysenter
+
+00800f94 <after_sysenter_label_808>:
+  800f94:	5e                   	pop    %esi
+  800f95:	5d                   	pop    %ebp
+  800f96:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	7f 07                	jg     800fa4 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa0:	5b                   	pop    %ebx
+  800fa1:	5f                   	pop    %edi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	50                   	push   %eax
+  800fa8:	6a 08                	push   $0x8
+  800faa:	68 f5 4e 80 00       	push   $0x804ef5
+  800faf:	6a 54                	push   $0x54
+  800fb1:	68 12 4f 80 00       	push   $0x804f12
+  800fb6:	e8 d2 f3 ff ff       	call   80038d <_panic>
+
+00800fbb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	6a 00                	push   $0x0
+  800fd4:	55                   	push   %ebp
+  800fd5:	56                   	push   %esi
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	8d 35 e0 0f 80 00    	lea    0x800fe0,%esi
+  800fde:	0f 34                	sysenter
+
+00800fe0 <after_sysenter_label_912>:
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	7f 07                	jg     800ff0 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fe9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5f                   	pop    %edi
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff0:	83 ec 0c             	sub    $0xc,%esp
+  800ff3:	50                   	push   %eax
+  800ff4:	6a 09                	push   $0x9
+  800ff6:	68 f5 4e 80 00       	push   $0x804ef5
+  800ffb:	6a 54                	push   $0x54
+  800ffd:	68 12 4f 80 00       	push   $0x804f12
+  801002:	e8 86 f3 ff ff       	call   80038d <_panic>
+
+00801007 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	6a 00                	push   $0x0
+  801020:	55                   	push   %ebp
+  801021:	56                   	push   %esi
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	8d 35 2c 10 80 00    	lea    0x80102c,%esi
+  80102a:	0f 34                	sysenter
+
+0080102c <after_sysenter_label_1016>:
+  80102c:	5e                   	pop    %esi
+  80102d:	5d                   	pop    %ebp
+  80102e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801031:	85 c0                	test   %eax,%eax
+  801033:	7f 07                	jg     80103c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801035:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801038:	5b                   	pop    %ebx
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 0a                	push   $0xa
+  801042:	68 f5 4e 80 00       	push   $0x804ef5
+  801047:	6a 54                	push   $0x54
+  801049:	68 12 4f 80 00       	push   $0x804f12
+  80104e:	e8 3a f3 ff ff       	call   80038d <_panic>
+
+00801053 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801063:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801066:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801069:	6a 00                	push   $0x0
+  80106b:	55                   	push   %ebp
+  80106c:	56                   	push   %esi
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	8d 35 77 10 80 00    	lea    0x801077,%esi
+  801075:	0f 34                	sysenter
+
+00801077 <after_sysenter_label_1126>:
+  801077:	5e                   	pop    %esi
+  801078:	5d                   	pop    %ebp
+  801079:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80107c:	5b                   	pop    %ebx
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+
+00801080 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	57                   	push   %edi
+  801084:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801092:	89 cb                	mov    %ecx,%ebx
+  801094:	89 cf                	mov    %ecx,%edi
+  801096:	6a 00                	push   $0x0
+  801098:	55                   	push   %ebp
+  801099:	56                   	push   %esi
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	8d 35 a4 10 80 00    	lea    0x8010a4,%esi
+  8010a2:	0f 34                	sysenter
+
+008010a4 <after_sysenter_label_1210>:
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	7f 07                	jg     8010b4 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5f                   	pop    %edi
+  8010b2:	5d                   	pop    %ebp
+  8010b3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b4:	83 ec 0c             	sub    $0xc,%esp
+  8010b7:	50                   	push   %eax
+  8010b8:	6a 0d                	push   $0xd
+  8010ba:	68 f5 4e 80 00       	push   $0x804ef5
+  8010bf:	6a 54                	push   $0x54
+  8010c1:	68 12 4f 80 00       	push   $0x804f12
+  8010c6:	e8 c2 f2 ff ff       	call   80038d <_panic>
+
+008010cb <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	57                   	push   %edi
+  8010cf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	b8 42 00 00 00       	mov    $0x42,%eax
+  8010e0:	89 df                	mov    %ebx,%edi
+  8010e2:	6a 00                	push   $0x0
+  8010e4:	55                   	push   %ebp
+  8010e5:	56                   	push   %esi
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	8d 35 f0 10 80 00    	lea    0x8010f0,%esi
+  8010ee:	0f 34                	sysenter
+
+008010f0 <after_sysenter_label_1311>:
+  8010f0:	5e                   	pop    %esi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	7f 07                	jg     801100 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8010f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5f                   	pop    %edi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801100:	83 ec 0c             	sub    $0xc,%esp
+  801103:	50                   	push   %eax
+  801104:	6a 42                	push   $0x42
+  801106:	68 f5 4e 80 00       	push   $0x804ef5
+  80110b:	6a 54                	push   $0x54
+  80110d:	68 12 4f 80 00       	push   $0x804f12
+  801112:	e8 76 f2 ff ff       	call   80038d <_panic>
+
+00801117 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	57                   	push   %edi
+  80111b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80111c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801121:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801126:	89 d1                	mov    %edx,%ecx
+  801128:	89 d3                	mov    %edx,%ebx
+  80112a:	89 d7                	mov    %edx,%edi
+  80112c:	6a 00                	push   $0x0
+  80112e:	55                   	push   %ebp
+  80112f:	56                   	push   %esi
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	8d 35 3a 11 80 00    	lea    0x80113a,%esi
+  801138:	0f 34                	sysenter
+
+0080113a <after_sysenter_label_1411>:
+  80113a:	5e                   	pop    %esi
+  80113b:	5d                   	pop    %ebp
+  80113c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80113f:	5b                   	pop    %ebx
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+
+00801143 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	57                   	push   %edi
+  801147:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801153:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801158:	89 df                	mov    %ebx,%edi
+  80115a:	6a 00                	push   $0x0
+  80115c:	55                   	push   %ebp
+  80115d:	56                   	push   %esi
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	8d 35 68 11 80 00    	lea    0x801168,%esi
+  801166:	0f 34                	sysenter
+
+00801168 <after_sysenter_label_1497>:
+  801168:	5e                   	pop    %esi
+  801169:	5d                   	pop    %ebp
+  80116a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80116d:	5b                   	pop    %ebx
+  80116e:	5f                   	pop    %edi
+  80116f:	5d                   	pop    %ebp
+  801170:	c3                   	ret
+
+00801171 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801181:	b8 10 00 00 00       	mov    $0x10,%eax
+  801186:	89 df                	mov    %ebx,%edi
+  801188:	6a 00                	push   $0x0
+  80118a:	55                   	push   %ebp
+  80118b:	56                   	push   %esi
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	8d 35 96 11 80 00    	lea    0x801196,%esi
+  801194:	0f 34                	sysenter
+
+00801196 <after_sysenter_label_1583>:
+  801196:	5e                   	pop    %esi
+  801197:	5d                   	pop    %ebp
+  801198:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80119b:	5b                   	pop    %ebx
+  80119c:	5f                   	pop    %edi
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b7:	6a 00                	push   $0x0
+  8011b9:	55                   	push   %ebp
+  8011ba:	56                   	push   %esi
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	8d 35 c5 11 80 00    	lea    0x8011c5,%esi
+  8011c3:	0f 34                	sysenter
+
+008011c5 <after_sysenter_label_1672>:
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5f                   	pop    %edi
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+
+008011ce <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	6a 00                	push   $0x0
+  8011e7:	55                   	push   %ebp
+  8011e8:	56                   	push   %esi
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	8d 35 f3 11 80 00    	lea    0x8011f3,%esi
+  8011f1:	0f 34                	sysenter
+
+008011f3 <after_sysenter_label_1758>:
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5f                   	pop    %edi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+
+008011fc <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801201:	8b 55 08             	mov    0x8(%ebp),%edx
+  801204:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801209:	b8 13 00 00 00       	mov    $0x13,%eax
+  80120e:	89 cb                	mov    %ecx,%ebx
+  801210:	89 cf                	mov    %ecx,%edi
+  801212:	6a 00                	push   $0x0
+  801214:	55                   	push   %ebp
+  801215:	56                   	push   %esi
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	8d 35 20 12 80 00    	lea    0x801220,%esi
+  80121e:	0f 34                	sysenter
+
+00801220 <after_sysenter_label_1842>:
+  801220:	5e                   	pop    %esi
+  801221:	5d                   	pop    %ebp
+  801222:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801225:	85 c0                	test   %eax,%eax
+  801227:	7f 07                	jg     801230 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801229:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80122c:	5b                   	pop    %ebx
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801230:	83 ec 0c             	sub    $0xc,%esp
+  801233:	50                   	push   %eax
+  801234:	6a 13                	push   $0x13
+  801236:	68 f5 4e 80 00       	push   $0x804ef5
+  80123b:	6a 54                	push   $0x54
+  80123d:	68 12 4f 80 00       	push   $0x804f12
+  801242:	e8 46 f1 ff ff       	call   80038d <_panic>
+
+00801247 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	57                   	push   %edi
+  80124b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80124c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801251:	b8 14 00 00 00       	mov    $0x14,%eax
+  801256:	89 d1                	mov    %edx,%ecx
+  801258:	89 d3                	mov    %edx,%ebx
+  80125a:	89 d7                	mov    %edx,%edi
+  80125c:	6a 00                	push   $0x0
+  80125e:	55                   	push   %ebp
+  80125f:	56                   	push   %esi
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	8d 35 6a 12 80 00    	lea    0x80126a,%esi
+  801268:	0f 34                	sysenter
+
+0080126a <after_sysenter_label_1939>:
+  80126a:	5e                   	pop    %esi
+  80126b:	5d                   	pop    %ebp
+  80126c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80126f:	5b                   	pop    %ebx
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+
+00801273 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801283:	bf 00 00 00 00       	mov    $0x0,%edi
+  801288:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128b:	6a 00                	push   $0x0
+  80128d:	55                   	push   %ebp
+  80128e:	56                   	push   %esi
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	8d 35 99 12 80 00    	lea    0x801299,%esi
+  801297:	0f 34                	sysenter
+
+00801299 <after_sysenter_label_2028>:
+  801299:	5e                   	pop    %esi
+  80129a:	5d                   	pop    %ebp
+  80129b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80129e:	5b                   	pop    %ebx
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012b7:	89 df                	mov    %ebx,%edi
+  8012b9:	6a 00                	push   $0x0
+  8012bb:	55                   	push   %ebp
+  8012bc:	56                   	push   %esi
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	8d 35 c7 12 80 00    	lea    0x8012c7,%esi
+  8012c5:	0f 34                	sysenter
+
+008012c7 <after_sysenter_label_2114>:
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012e5:	89 df                	mov    %ebx,%edi
+  8012e7:	6a 00                	push   $0x0
+  8012e9:	55                   	push   %ebp
+  8012ea:	56                   	push   %esi
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	8d 35 f5 12 80 00    	lea    0x8012f5,%esi
+  8012f3:	0f 34                	sysenter
+
+008012f5 <after_sysenter_label_2200>:
+  8012f5:	5e                   	pop    %esi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5f                   	pop    %edi
+  8012fc:	5d                   	pop    %ebp
+  8012fd:	c3                   	ret
+
+008012fe <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8012fe:	55                   	push   %ebp
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	57                   	push   %edi
+  801302:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	6a 00                	push   $0x0
+  801317:	55                   	push   %ebp
+  801318:	56                   	push   %esi
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	8d 35 23 13 80 00    	lea    0x801323,%esi
+  801321:	0f 34                	sysenter
+
+00801323 <after_sysenter_label_2286>:
+  801323:	5e                   	pop    %esi
+  801324:	5d                   	pop    %ebp
+  801325:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801328:	5b                   	pop    %ebx
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+
+0080132c <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801332:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801335:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801338:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  80133a:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80133d:	83 3a 01             	cmpl   $0x1,(%edx)
+  801340:	7e 09                	jle    80134b <argstart+0x1f>
+  801342:	ba 3f 52 80 00       	mov    $0x80523f,%edx
+  801347:	85 c9                	test   %ecx,%ecx
+  801349:	75 05                	jne    801350 <argstart+0x24>
+  80134b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801350:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801353:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+
+0080135c <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	53                   	push   %ebx
+  801360:	83 ec 04             	sub    $0x4,%esp
+  801363:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801366:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  80136d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801370:	85 c0                	test   %eax,%eax
+  801372:	74 74                	je     8013e8 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801374:	80 38 00             	cmpb   $0x0,(%eax)
+  801377:	75 48                	jne    8013c1 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801379:	8b 0b                	mov    (%ebx),%ecx
+  80137b:	83 39 01             	cmpl   $0x1,(%ecx)
+  80137e:	74 5a                	je     8013da <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801380:	8b 53 04             	mov    0x4(%ebx),%edx
+  801383:	8b 42 04             	mov    0x4(%edx),%eax
+  801386:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801389:	75 4f                	jne    8013da <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  80138b:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80138f:	74 49                	je     8013da <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801391:	83 c0 01             	add    $0x1,%eax
+  801394:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801397:	83 ec 04             	sub    $0x4,%esp
+  80139a:	8b 01                	mov    (%ecx),%eax
+  80139c:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8013a3:	50                   	push   %eax
+  8013a4:	8d 42 08             	lea    0x8(%edx),%eax
+  8013a7:	50                   	push   %eax
+  8013a8:	83 c2 04             	add    $0x4,%edx
+  8013ab:	52                   	push   %edx
+  8013ac:	e8 21 f8 ff ff       	call   800bd2 <memmove>
+		(*args->argc)--;
+  8013b1:	8b 03                	mov    (%ebx),%eax
+  8013b3:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8013b6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8013bf:	74 13                	je     8013d4 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  8013c1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013c4:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  8013c7:	83 c0 01             	add    $0x1,%eax
+  8013ca:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  8013cd:	89 d0                	mov    %edx,%eax
+  8013cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8013d4:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8013d8:	75 e7                	jne    8013c1 <argnext+0x65>
+	args->curarg = 0;
+  8013da:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  8013e1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8013e6:	eb e5                	jmp    8013cd <argnext+0x71>
+		return -1;
+  8013e8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8013ed:	eb de                	jmp    8013cd <argnext+0x71>
+
+008013ef <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8013ef:	55                   	push   %ebp
+  8013f0:	89 e5                	mov    %esp,%ebp
+  8013f2:	53                   	push   %ebx
+  8013f3:	83 ec 04             	sub    $0x4,%esp
+  8013f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8013f9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	74 12                	je     801412 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801400:	80 38 00             	cmpb   $0x0,(%eax)
+  801403:	74 12                	je     801417 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801405:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801408:	c7 43 08 3f 52 80 00 	movl   $0x80523f,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80140f:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801417:	8b 13                	mov    (%ebx),%edx
+  801419:	83 3a 01             	cmpl   $0x1,(%edx)
+  80141c:	7f 10                	jg     80142e <argnextvalue+0x3f>
+		args->argvalue = 0;
+  80141e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801425:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80142c:	eb e1                	jmp    80140f <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  80142e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801431:	8b 48 04             	mov    0x4(%eax),%ecx
+  801434:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801437:	83 ec 04             	sub    $0x4,%esp
+  80143a:	8b 12                	mov    (%edx),%edx
+  80143c:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801443:	52                   	push   %edx
+  801444:	8d 50 08             	lea    0x8(%eax),%edx
+  801447:	52                   	push   %edx
+  801448:	83 c0 04             	add    $0x4,%eax
+  80144b:	50                   	push   %eax
+  80144c:	e8 81 f7 ff ff       	call   800bd2 <memmove>
+		(*args->argc)--;
+  801451:	8b 03                	mov    (%ebx),%eax
+  801453:	83 28 01             	subl   $0x1,(%eax)
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	eb b4                	jmp    80140f <argnextvalue+0x20>
+
+0080145b <argvalue>:
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	83 ec 08             	sub    $0x8,%esp
+  801461:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801464:	8b 42 0c             	mov    0xc(%edx),%eax
+  801467:	85 c0                	test   %eax,%eax
+  801469:	74 02                	je     80146d <argvalue+0x12>
+}
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80146d:	83 ec 0c             	sub    $0xc,%esp
+  801470:	52                   	push   %edx
+  801471:	e8 79 ff ff ff       	call   8013ef <argnextvalue>
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	eb f0                	jmp    80146b <argvalue+0x10>
+
+0080147b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80147e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801481:	05 00 00 00 30       	add    $0x30000000,%eax
+  801486:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+
+0080148b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80148e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801491:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801496:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80149b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+
+008014a2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014a5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014aa:	eb 02                	jmp    8014ae <fd_alloc+0xc>
+  8014ac:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014ae:	89 c2                	mov    %eax,%edx
+  8014b0:	c1 ea 16             	shr    $0x16,%edx
+  8014b3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014ba:	f6 c2 01             	test   $0x1,%dl
+  8014bd:	74 2b                	je     8014ea <fd_alloc+0x48>
+  8014bf:	89 c2                	mov    %eax,%edx
+  8014c1:	c1 ea 0c             	shr    $0xc,%edx
+  8014c4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014cb:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014d1:	f6 c1 01             	test   $0x1,%cl
+  8014d4:	74 14                	je     8014ea <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014d6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014dc:	75 ce                	jne    8014ac <fd_alloc+0xa>
+  8014de:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014e3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014e8:	eb 05                	jmp    8014ef <fd_alloc+0x4d>
+			return 0;
+  8014ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f2:	89 02                	mov    %eax,(%edx)
+}
+  8014f4:	89 c8                	mov    %ecx,%eax
+  8014f6:	5d                   	pop    %ebp
+  8014f7:	c3                   	ret
+
+008014f8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014f8:	55                   	push   %ebp
+  8014f9:	89 e5                	mov    %esp,%ebp
+  8014fb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014fe:	83 f8 1f             	cmp    $0x1f,%eax
+  801501:	77 30                	ja     801533 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801503:	c1 e0 0c             	shl    $0xc,%eax
+  801506:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80150b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801511:	f6 c2 01             	test   $0x1,%dl
+  801514:	74 24                	je     80153a <fd_lookup+0x42>
+  801516:	89 c2                	mov    %eax,%edx
+  801518:	c1 ea 0c             	shr    $0xc,%edx
+  80151b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801522:	f6 c2 01             	test   $0x1,%dl
+  801525:	74 1a                	je     801541 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801527:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80152a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80152c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+		return -E_INVAL;
+  801533:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801538:	eb f7                	jmp    801531 <fd_lookup+0x39>
+		return -E_INVAL;
+  80153a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80153f:	eb f0                	jmp    801531 <fd_lookup+0x39>
+  801541:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801546:	eb e9                	jmp    801531 <fd_lookup+0x39>
+
+00801548 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801548:	55                   	push   %ebp
+  801549:	89 e5                	mov    %esp,%ebp
+  80154b:	53                   	push   %ebx
+  80154c:	83 ec 04             	sub    $0x4,%esp
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+  801557:	eb 03                	jmp    80155c <dev_lookup+0x14>
+  801559:	83 c0 01             	add    $0x1,%eax
+  80155c:	8b 1c 85 9c 4f 80 00 	mov    0x804f9c(,%eax,4),%ebx
+  801563:	85 db                	test   %ebx,%ebx
+  801565:	74 0b                	je     801572 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801567:	39 13                	cmp    %edx,(%ebx)
+  801569:	75 ee                	jne    801559 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	eb 49                	jmp    8015bb <dev_lookup+0x73>
+  801572:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801574:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80157a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80157f:	77 18                	ja     801599 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801581:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801586:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801588:	c1 e8 10             	shr    $0x10,%eax
+  80158b:	74 0c                	je     801599 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80158d:	c1 e0 10             	shl    $0x10,%eax
+  801590:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801595:	29 c1                	sub    %eax,%ecx
+  801597:	eb 06                	jmp    80159f <dev_lookup+0x57>
+		return pthread_main_tls;
+  801599:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80159f:	8b 01                	mov    (%ecx),%eax
+  8015a1:	8b 40 48             	mov    0x48(%eax),%eax
+  8015a4:	83 ec 04             	sub    $0x4,%esp
+  8015a7:	52                   	push   %edx
+  8015a8:	50                   	push   %eax
+  8015a9:	68 20 4f 80 00       	push   $0x804f20
+  8015ae:	e8 b5 ee ff ff       	call   800468 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015b3:	83 c4 10             	add    $0x10,%esp
+  8015b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015be:	89 1a                	mov    %ebx,(%edx)
+}
+  8015c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c3:	c9                   	leave
+  8015c4:	c3                   	ret
+
+008015c5 <fd_close>:
+{
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	57                   	push   %edi
+  8015c9:	56                   	push   %esi
+  8015ca:	53                   	push   %ebx
+  8015cb:	83 ec 24             	sub    $0x24,%esp
+  8015ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015d1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015d4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015d7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015d8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015de:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e1:	50                   	push   %eax
+  8015e2:	e8 11 ff ff ff       	call   8014f8 <fd_lookup>
+  8015e7:	89 c3                	mov    %eax,%ebx
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 05                	js     8015f5 <fd_close+0x30>
+	    || fd != fd2)
+  8015f0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015f3:	74 16                	je     80160b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015f5:	89 f8                	mov    %edi,%eax
+  8015f7:	84 c0                	test   %al,%al
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fe:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801601:	89 d8                	mov    %ebx,%eax
+  801603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80160b:	83 ec 08             	sub    $0x8,%esp
+  80160e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801611:	50                   	push   %eax
+  801612:	ff 36                	push   (%esi)
+  801614:	e8 2f ff ff ff       	call   801548 <dev_lookup>
+  801619:	89 c3                	mov    %eax,%ebx
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 1a                	js     80163c <fd_close+0x77>
+		if (dev->dev_close)
+  801622:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801625:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801628:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80162d:	85 c0                	test   %eax,%eax
+  80162f:	74 0b                	je     80163c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801631:	83 ec 0c             	sub    $0xc,%esp
+  801634:	56                   	push   %esi
+  801635:	ff d0                	call   *%eax
+  801637:	89 c3                	mov    %eax,%ebx
+  801639:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80163c:	83 ec 08             	sub    $0x8,%esp
+  80163f:	56                   	push   %esi
+  801640:	6a 00                	push   $0x0
+  801642:	e8 dc f8 ff ff       	call   800f23 <sys_page_unmap>
+	return r;
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	eb b5                	jmp    801601 <fd_close+0x3c>
+
+0080164c <close>:
+
+int
+close(int fdnum)
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801652:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801655:	50                   	push   %eax
+  801656:	ff 75 08             	push   0x8(%ebp)
+  801659:	e8 9a fe ff ff       	call   8014f8 <fd_lookup>
+  80165e:	83 c4 10             	add    $0x10,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	79 02                	jns    801667 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801665:	c9                   	leave
+  801666:	c3                   	ret
+		return fd_close(fd, 1);
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	6a 01                	push   $0x1
+  80166c:	ff 75 f4             	push   -0xc(%ebp)
+  80166f:	e8 51 ff ff ff       	call   8015c5 <fd_close>
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	eb ec                	jmp    801665 <close+0x19>
+
+00801679 <close_all>:
+
+void
+close_all(void)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	53                   	push   %ebx
+  80167d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801685:	83 ec 0c             	sub    $0xc,%esp
+  801688:	53                   	push   %ebx
+  801689:	e8 be ff ff ff       	call   80164c <close>
+	for (i = 0; i < MAXFD; i++)
+  80168e:	83 c3 01             	add    $0x1,%ebx
+  801691:	83 c4 10             	add    $0x10,%esp
+  801694:	83 fb 20             	cmp    $0x20,%ebx
+  801697:	75 ec                	jne    801685 <close_all+0xc>
+}
+  801699:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+
+0080169e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80169e:	55                   	push   %ebp
+  80169f:	89 e5                	mov    %esp,%ebp
+  8016a1:	57                   	push   %edi
+  8016a2:	56                   	push   %esi
+  8016a3:	53                   	push   %ebx
+  8016a4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016aa:	50                   	push   %eax
+  8016ab:	ff 75 08             	push   0x8(%ebp)
+  8016ae:	e8 45 fe ff ff       	call   8014f8 <fd_lookup>
+  8016b3:	89 c3                	mov    %eax,%ebx
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	78 7f                	js     80173b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  8016bf:	ff 75 0c             	push   0xc(%ebp)
+  8016c2:	e8 85 ff ff ff       	call   80164c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016ca:	c1 e6 0c             	shl    $0xc,%esi
+  8016cd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016d6:	89 3c 24             	mov    %edi,(%esp)
+  8016d9:	e8 ad fd ff ff       	call   80148b <fd2data>
+  8016de:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016e0:	89 34 24             	mov    %esi,(%esp)
+  8016e3:	e8 a3 fd ff ff       	call   80148b <fd2data>
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016ee:	89 d8                	mov    %ebx,%eax
+  8016f0:	c1 e8 16             	shr    $0x16,%eax
+  8016f3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016fa:	a8 01                	test   $0x1,%al
+  8016fc:	74 11                	je     80170f <dup+0x71>
+  8016fe:	89 d8                	mov    %ebx,%eax
+  801700:	c1 e8 0c             	shr    $0xc,%eax
+  801703:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80170a:	f6 c2 01             	test   $0x1,%dl
+  80170d:	75 36                	jne    801745 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80170f:	89 f8                	mov    %edi,%eax
+  801711:	c1 e8 0c             	shr    $0xc,%eax
+  801714:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801723:	50                   	push   %eax
+  801724:	56                   	push   %esi
+  801725:	6a 00                	push   $0x0
+  801727:	57                   	push   %edi
+  801728:	6a 00                	push   $0x0
+  80172a:	e8 a8 f7 ff ff       	call   800ed7 <sys_page_map>
+  80172f:	89 c3                	mov    %eax,%ebx
+  801731:	83 c4 20             	add    $0x20,%esp
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 33                	js     80176b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801738:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80173b:	89 d8                	mov    %ebx,%eax
+  80173d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5f                   	pop    %edi
+  801743:	5d                   	pop    %ebp
+  801744:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801745:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801754:	50                   	push   %eax
+  801755:	ff 75 d4             	push   -0x2c(%ebp)
+  801758:	6a 00                	push   $0x0
+  80175a:	53                   	push   %ebx
+  80175b:	6a 00                	push   $0x0
+  80175d:	e8 75 f7 ff ff       	call   800ed7 <sys_page_map>
+  801762:	89 c3                	mov    %eax,%ebx
+  801764:	83 c4 20             	add    $0x20,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	79 a4                	jns    80170f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80176b:	83 ec 08             	sub    $0x8,%esp
+  80176e:	56                   	push   %esi
+  80176f:	6a 00                	push   $0x0
+  801771:	e8 ad f7 ff ff       	call   800f23 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801776:	83 c4 08             	add    $0x8,%esp
+  801779:	ff 75 d4             	push   -0x2c(%ebp)
+  80177c:	6a 00                	push   $0x0
+  80177e:	e8 a0 f7 ff ff       	call   800f23 <sys_page_unmap>
+	return r;
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	eb b3                	jmp    80173b <dup+0x9d>
+
+00801788 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801788:	55                   	push   %ebp
+  801789:	89 e5                	mov    %esp,%ebp
+  80178b:	56                   	push   %esi
+  80178c:	53                   	push   %ebx
+  80178d:	83 ec 18             	sub    $0x18,%esp
+  801790:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801793:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801796:	50                   	push   %eax
+  801797:	53                   	push   %ebx
+  801798:	e8 5b fd ff ff       	call   8014f8 <fd_lookup>
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	78 3c                	js     8017e0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017a7:	83 ec 08             	sub    $0x8,%esp
+  8017aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ad:	50                   	push   %eax
+  8017ae:	ff 36                	push   (%esi)
+  8017b0:	e8 93 fd ff ff       	call   801548 <dev_lookup>
+  8017b5:	83 c4 10             	add    $0x10,%esp
+  8017b8:	85 c0                	test   %eax,%eax
+  8017ba:	78 24                	js     8017e0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017bc:	8b 46 08             	mov    0x8(%esi),%eax
+  8017bf:	83 e0 03             	and    $0x3,%eax
+  8017c2:	83 f8 01             	cmp    $0x1,%eax
+  8017c5:	74 20                	je     8017e7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ca:	8b 40 08             	mov    0x8(%eax),%eax
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	74 61                	je     801832 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	ff 75 10             	push   0x10(%ebp)
+  8017d7:	ff 75 0c             	push   0xc(%ebp)
+  8017da:	56                   	push   %esi
+  8017db:	ff d0                	call   *%eax
+  8017dd:	83 c4 10             	add    $0x10,%esp
+}
+  8017e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e3:	5b                   	pop    %ebx
+  8017e4:	5e                   	pop    %esi
+  8017e5:	5d                   	pop    %ebp
+  8017e6:	c3                   	ret
+  8017e7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017e9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8017ef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8017f4:	77 18                	ja     80180e <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017f6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8017fb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8017fd:	c1 e8 10             	shr    $0x10,%eax
+  801800:	74 0c                	je     80180e <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801802:	c1 e0 10             	shl    $0x10,%eax
+  801805:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80180a:	29 c2                	sub    %eax,%edx
+  80180c:	eb 06                	jmp    801814 <read+0x8c>
+		return pthread_main_tls;
+  80180e:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801814:	8b 02                	mov    (%edx),%eax
+  801816:	8b 40 48             	mov    0x48(%eax),%eax
+  801819:	83 ec 04             	sub    $0x4,%esp
+  80181c:	53                   	push   %ebx
+  80181d:	50                   	push   %eax
+  80181e:	68 61 4f 80 00       	push   $0x804f61
+  801823:	e8 40 ec ff ff       	call   800468 <cprintf>
+		return -E_INVAL;
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801830:	eb ae                	jmp    8017e0 <read+0x58>
+		return -E_NOT_SUPP;
+  801832:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801837:	eb a7                	jmp    8017e0 <read+0x58>
+
+00801839 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	57                   	push   %edi
+  80183d:	56                   	push   %esi
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 0c             	sub    $0xc,%esp
+  801842:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801845:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801848:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184d:	eb 02                	jmp    801851 <readn+0x18>
+  80184f:	01 c3                	add    %eax,%ebx
+  801851:	39 f3                	cmp    %esi,%ebx
+  801853:	73 21                	jae    801876 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801855:	83 ec 04             	sub    $0x4,%esp
+  801858:	89 f0                	mov    %esi,%eax
+  80185a:	29 d8                	sub    %ebx,%eax
+  80185c:	50                   	push   %eax
+  80185d:	89 d8                	mov    %ebx,%eax
+  80185f:	03 45 0c             	add    0xc(%ebp),%eax
+  801862:	50                   	push   %eax
+  801863:	57                   	push   %edi
+  801864:	e8 1f ff ff ff       	call   801788 <read>
+		if (m < 0)
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	78 04                	js     801874 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801870:	75 dd                	jne    80184f <readn+0x16>
+  801872:	eb 02                	jmp    801876 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801874:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801876:	89 d8                	mov    %ebx,%eax
+  801878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187b:	5b                   	pop    %ebx
+  80187c:	5e                   	pop    %esi
+  80187d:	5f                   	pop    %edi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+
+00801880 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	83 ec 18             	sub    $0x18,%esp
+  801888:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80188b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80188e:	50                   	push   %eax
+  80188f:	53                   	push   %ebx
+  801890:	e8 63 fc ff ff       	call   8014f8 <fd_lookup>
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 37                	js     8018d3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80189c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80189f:	83 ec 08             	sub    $0x8,%esp
+  8018a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a5:	50                   	push   %eax
+  8018a6:	ff 36                	push   (%esi)
+  8018a8:	e8 9b fc ff ff       	call   801548 <dev_lookup>
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	78 1f                	js     8018d3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018b4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018b8:	74 20                	je     8018da <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	74 61                	je     801925 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018c4:	83 ec 04             	sub    $0x4,%esp
+  8018c7:	ff 75 10             	push   0x10(%ebp)
+  8018ca:	ff 75 0c             	push   0xc(%ebp)
+  8018cd:	56                   	push   %esi
+  8018ce:	ff d0                	call   *%eax
+  8018d0:	83 c4 10             	add    $0x10,%esp
+}
+  8018d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d6:	5b                   	pop    %ebx
+  8018d7:	5e                   	pop    %esi
+  8018d8:	5d                   	pop    %ebp
+  8018d9:	c3                   	ret
+  8018da:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018dc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8018e2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018e7:	77 18                	ja     801901 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018e9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018ee:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018f0:	c1 e8 10             	shr    $0x10,%eax
+  8018f3:	74 0c                	je     801901 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018f5:	c1 e0 10             	shl    $0x10,%eax
+  8018f8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018fd:	29 c2                	sub    %eax,%edx
+  8018ff:	eb 06                	jmp    801907 <write+0x87>
+		return pthread_main_tls;
+  801901:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801907:	8b 02                	mov    (%edx),%eax
+  801909:	8b 40 48             	mov    0x48(%eax),%eax
+  80190c:	83 ec 04             	sub    $0x4,%esp
+  80190f:	53                   	push   %ebx
+  801910:	50                   	push   %eax
+  801911:	68 7d 4f 80 00       	push   $0x804f7d
+  801916:	e8 4d eb ff ff       	call   800468 <cprintf>
+		return -E_INVAL;
+  80191b:	83 c4 10             	add    $0x10,%esp
+  80191e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801923:	eb ae                	jmp    8018d3 <write+0x53>
+		return -E_NOT_SUPP;
+  801925:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192a:	eb a7                	jmp    8018d3 <write+0x53>
+
+0080192c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801932:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	ff 75 08             	push   0x8(%ebp)
+  801939:	e8 ba fb ff ff       	call   8014f8 <fd_lookup>
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 0e                	js     801953 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80194e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	56                   	push   %esi
+  801959:	53                   	push   %ebx
+  80195a:	83 ec 18             	sub    $0x18,%esp
+  80195d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801960:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	53                   	push   %ebx
+  801965:	e8 8e fb ff ff       	call   8014f8 <fd_lookup>
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 34                	js     8019a5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801971:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801974:	83 ec 08             	sub    $0x8,%esp
+  801977:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197a:	50                   	push   %eax
+  80197b:	ff 36                	push   (%esi)
+  80197d:	e8 c6 fb ff ff       	call   801548 <dev_lookup>
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 1c                	js     8019a5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801989:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80198d:	74 1d                	je     8019ac <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80198f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801992:	8b 40 18             	mov    0x18(%eax),%eax
+  801995:	85 c0                	test   %eax,%eax
+  801997:	74 5e                	je     8019f7 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801999:	83 ec 08             	sub    $0x8,%esp
+  80199c:	ff 75 0c             	push   0xc(%ebp)
+  80199f:	56                   	push   %esi
+  8019a0:	ff d0                	call   *%eax
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5d                   	pop    %ebp
+  8019ab:	c3                   	ret
+  8019ac:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8019ae:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8019b4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8019b9:	77 18                	ja     8019d3 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8019bb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8019c0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8019c2:	c1 e8 10             	shr    $0x10,%eax
+  8019c5:	74 0c                	je     8019d3 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8019c7:	c1 e0 10             	shl    $0x10,%eax
+  8019ca:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8019cf:	29 c2                	sub    %eax,%edx
+  8019d1:	eb 06                	jmp    8019d9 <ftruncate+0x84>
+		return pthread_main_tls;
+  8019d3:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			thisenv->env_id, fdnum);
+  8019d9:	8b 02                	mov    (%edx),%eax
+  8019db:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019de:	83 ec 04             	sub    $0x4,%esp
+  8019e1:	53                   	push   %ebx
+  8019e2:	50                   	push   %eax
+  8019e3:	68 40 4f 80 00       	push   $0x804f40
+  8019e8:	e8 7b ea ff ff       	call   800468 <cprintf>
+		return -E_INVAL;
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f5:	eb ae                	jmp    8019a5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019fc:	eb a7                	jmp    8019a5 <ftruncate+0x50>
+
+008019fe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 18             	sub    $0x18,%esp
+  801a06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0c:	50                   	push   %eax
+  801a0d:	ff 75 08             	push   0x8(%ebp)
+  801a10:	e8 e3 fa ff ff       	call   8014f8 <fd_lookup>
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	78 49                	js     801a65 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a1c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a1f:	83 ec 08             	sub    $0x8,%esp
+  801a22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a25:	50                   	push   %eax
+  801a26:	ff 36                	push   (%esi)
+  801a28:	e8 1b fb ff ff       	call   801548 <dev_lookup>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 31                	js     801a65 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a37:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a3b:	74 2f                	je     801a6c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a3d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a40:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a47:	00 00 00 
+	stat->st_isdir = 0;
+  801a4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a51:	00 00 00 
+	stat->st_dev = dev;
+  801a54:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a5a:	83 ec 08             	sub    $0x8,%esp
+  801a5d:	53                   	push   %ebx
+  801a5e:	56                   	push   %esi
+  801a5f:	ff 50 14             	call   *0x14(%eax)
+  801a62:	83 c4 10             	add    $0x10,%esp
+}
+  801a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a68:	5b                   	pop    %ebx
+  801a69:	5e                   	pop    %esi
+  801a6a:	5d                   	pop    %ebp
+  801a6b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a6c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a71:	eb f2                	jmp    801a65 <fstat+0x67>
+
+00801a73 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+  801a76:	56                   	push   %esi
+  801a77:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a78:	83 ec 08             	sub    $0x8,%esp
+  801a7b:	6a 00                	push   $0x0
+  801a7d:	ff 75 08             	push   0x8(%ebp)
+  801a80:	e8 4b 03 00 00       	call   801dd0 <open>
+  801a85:	89 c3                	mov    %eax,%ebx
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 1b                	js     801aa9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a8e:	83 ec 08             	sub    $0x8,%esp
+  801a91:	ff 75 0c             	push   0xc(%ebp)
+  801a94:	50                   	push   %eax
+  801a95:	e8 64 ff ff ff       	call   8019fe <fstat>
+  801a9a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a9c:	89 1c 24             	mov    %ebx,(%esp)
+  801a9f:	e8 a8 fb ff ff       	call   80164c <close>
+	return r;
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	89 f3                	mov    %esi,%ebx
+}
+  801aa9:	89 d8                	mov    %ebx,%eax
+  801aab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aae:	5b                   	pop    %ebx
+  801aaf:	5e                   	pop    %esi
+  801ab0:	5d                   	pop    %ebp
+  801ab1:	c3                   	ret
+
+00801ab2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	56                   	push   %esi
+  801ab6:	53                   	push   %ebx
+  801ab7:	89 c6                	mov    %eax,%esi
+  801ab9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801abb:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801ac2:	74 27                	je     801aeb <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ac4:	6a 07                	push   $0x7
+  801ac6:	68 00 80 80 00       	push   $0x808000
+  801acb:	56                   	push   %esi
+  801acc:	ff 35 00 70 80 00    	push   0x807000
+  801ad2:	e8 4e 2c 00 00       	call   804725 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ad7:	83 c4 0c             	add    $0xc,%esp
+  801ada:	6a 00                	push   $0x0
+  801adc:	53                   	push   %ebx
+  801add:	6a 00                	push   $0x0
+  801adf:	e8 4b 2b 00 00       	call   80462f <ipc_recv>
+}
+  801ae4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae7:	5b                   	pop    %ebx
+  801ae8:	5e                   	pop    %esi
+  801ae9:	5d                   	pop    %ebp
+  801aea:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801aeb:	83 ec 0c             	sub    $0xc,%esp
+  801aee:	6a 01                	push   $0x1
+  801af0:	e8 86 2c 00 00       	call   80477b <ipc_find_env>
+  801af5:	a3 00 70 80 00       	mov    %eax,0x807000
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	eb c5                	jmp    801ac4 <fsipc+0x12>
+
+00801aff <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	53                   	push   %ebx
+  801b03:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801b06:	68 04 70 80 00       	push   $0x807004
+  801b0b:	e8 29 1b 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b16:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1e:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b28:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b2d:	e8 80 ff ff ff       	call   801ab2 <fsipc>
+  801b32:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b34:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b3b:	e8 66 1b 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+}
+  801b40:	89 d8                	mov    %ebx,%eax
+  801b42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b45:	c9                   	leave
+  801b46:	c3                   	ret
+
+00801b47 <devfile_flush>:
+{
+  801b47:	55                   	push   %ebp
+  801b48:	89 e5                	mov    %esp,%ebp
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801b4e:	68 04 70 80 00       	push   $0x807004
+  801b53:	e8 e1 1a 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b5e:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b68:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b6d:	e8 40 ff ff ff       	call   801ab2 <fsipc>
+  801b72:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b74:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b7b:	e8 26 1b 00 00       	call   8036a6 <mutex_unlock>
+}
+  801b80:	89 d8                	mov    %ebx,%eax
+  801b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+
+00801b87 <devfile_stat>:
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	56                   	push   %esi
+  801b8b:	53                   	push   %ebx
+  801b8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801b8f:	83 ec 0c             	sub    $0xc,%esp
+  801b92:	68 04 70 80 00       	push   $0x807004
+  801b97:	e8 9d 1a 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ba2:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bac:	b8 05 00 00 00       	mov    $0x5,%eax
+  801bb1:	e8 fc fe ff ff       	call   801ab2 <fsipc>
+  801bb6:	89 c3                	mov    %eax,%ebx
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	79 16                	jns    801bd5 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801bbf:	83 ec 0c             	sub    $0xc,%esp
+  801bc2:	68 04 70 80 00       	push   $0x807004
+  801bc7:	e8 da 1a 00 00       	call   8036a6 <mutex_unlock>
+}
+  801bcc:	89 d8                	mov    %ebx,%eax
+  801bce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd1:	5b                   	pop    %ebx
+  801bd2:	5e                   	pop    %esi
+  801bd3:	5d                   	pop    %ebp
+  801bd4:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801bd5:	83 ec 08             	sub    $0x8,%esp
+  801bd8:	68 00 80 80 00       	push   $0x808000
+  801bdd:	56                   	push   %esi
+  801bde:	e8 69 ee ff ff       	call   800a4c <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801be3:	a1 80 80 80 00       	mov    0x808080,%eax
+  801be8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bee:	a1 84 80 80 00       	mov    0x808084,%eax
+  801bf3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801bf9:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801bfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c01:	eb bc                	jmp    801bbf <devfile_stat+0x38>
+
+00801c03 <devfile_write>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	53                   	push   %ebx
+  801c07:	83 ec 10             	sub    $0x10,%esp
+  801c0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801c0d:	68 04 70 80 00       	push   $0x807004
+  801c12:	e8 22 1a 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801c2b:	76 3d                	jbe    801c6a <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801c2d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801c32:	39 c3                	cmp    %eax,%ebx
+  801c34:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801c37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3a:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801c3f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c4f:	e8 5e fe ff ff       	call   801ab2 <fsipc>
+  801c54:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801c56:	83 ec 0c             	sub    $0xc,%esp
+  801c59:	68 04 70 80 00       	push   $0x807004
+  801c5e:	e8 43 1a 00 00       	call   8036a6 <mutex_unlock>
+}
+  801c63:	89 d8                	mov    %ebx,%eax
+  801c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c68:	c9                   	leave
+  801c69:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801c6a:	83 ec 04             	sub    $0x4,%esp
+  801c6d:	53                   	push   %ebx
+  801c6e:	ff 75 0c             	push   0xc(%ebp)
+  801c71:	68 0c 80 80 00       	push   $0x80800c
+  801c76:	e8 57 ef ff ff       	call   800bd2 <memmove>
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	eb b5                	jmp    801c3a <devfile_write+0x37>
+
+00801c85 <devfile_read>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	57                   	push   %edi
+  801c89:	56                   	push   %esi
+  801c8a:	53                   	push   %ebx
+  801c8b:	83 ec 0c             	sub    $0xc,%esp
+  801c8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c91:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801c97:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c9d:	0f 86 8c 00 00 00    	jbe    801d2f <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801ca3:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801ca8:	39 c3                	cmp    %eax,%ebx
+  801caa:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801cad:	89 f8                	mov    %edi,%eax
+  801caf:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801cb2:	eb 0f                	jmp    801cc3 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801cb4:	0f b6 08             	movzbl (%eax),%ecx
+  801cb7:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801cb9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801cbe:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801cc3:	39 d0                	cmp    %edx,%eax
+  801cc5:	72 ed                	jb     801cb4 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801cc7:	83 ec 0c             	sub    $0xc,%esp
+  801cca:	68 04 70 80 00       	push   $0x807004
+  801ccf:	e8 65 19 00 00       	call   803639 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cd4:	8b 46 0c             	mov    0xc(%esi),%eax
+  801cd7:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801cdc:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801ce2:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ced:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf2:	e8 bb fd ff ff       	call   801ab2 <fsipc>
+  801cf7:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801cf9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801d00:	e8 a1 19 00 00       	call   8036a6 <mutex_unlock>
+		assert(r <= (int) n);
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	39 f3                	cmp    %esi,%ebx
+  801d0a:	7c 0a                	jl     801d16 <devfile_read+0x91>
+}
+  801d0c:	89 f0                	mov    %esi,%eax
+  801d0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d11:	5b                   	pop    %ebx
+  801d12:	5e                   	pop    %esi
+  801d13:	5f                   	pop    %edi
+  801d14:	5d                   	pop    %ebp
+  801d15:	c3                   	ret
+		assert(r <= (int) n);
+  801d16:	68 b0 4f 80 00       	push   $0x804fb0
+  801d1b:	68 bd 4f 80 00       	push   $0x804fbd
+  801d20:	68 90 00 00 00       	push   $0x90
+  801d25:	68 d2 4f 80 00       	push   $0x804fd2
+  801d2a:	e8 5e e6 ff ff       	call   80038d <_panic>
+	mutex_lock(&fsipc_mu);
+  801d2f:	83 ec 0c             	sub    $0xc,%esp
+  801d32:	68 04 70 80 00       	push   $0x807004
+  801d37:	e8 fd 18 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d3c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d3f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801d44:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801d4a:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801d51:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801d54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d59:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d5e:	e8 4f fd ff ff       	call   801ab2 <fsipc>
+  801d63:	89 c6                	mov    %eax,%esi
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 1d                	js     801d89 <devfile_read+0x104>
+		assert(r <= n);
+  801d6c:	39 c3                	cmp    %eax,%ebx
+  801d6e:	72 2e                	jb     801d9e <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801d70:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d75:	7f 40                	jg     801db7 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d77:	83 ec 04             	sub    $0x4,%esp
+  801d7a:	50                   	push   %eax
+  801d7b:	68 00 80 80 00       	push   $0x808000
+  801d80:	57                   	push   %edi
+  801d81:	e8 4c ee ff ff       	call   800bd2 <memmove>
+  801d86:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801d89:	83 ec 0c             	sub    $0xc,%esp
+  801d8c:	68 04 70 80 00       	push   $0x807004
+  801d91:	e8 10 19 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	e9 6e ff ff ff       	jmp    801d0c <devfile_read+0x87>
+		assert(r <= n);
+  801d9e:	68 dd 4f 80 00       	push   $0x804fdd
+  801da3:	68 bd 4f 80 00       	push   $0x804fbd
+  801da8:	68 99 00 00 00       	push   $0x99
+  801dad:	68 d2 4f 80 00       	push   $0x804fd2
+  801db2:	e8 d6 e5 ff ff       	call   80038d <_panic>
+		assert(r <= PGSIZE);
+  801db7:	68 e4 4f 80 00       	push   $0x804fe4
+  801dbc:	68 bd 4f 80 00       	push   $0x804fbd
+  801dc1:	68 9a 00 00 00       	push   $0x9a
+  801dc6:	68 d2 4f 80 00       	push   $0x804fd2
+  801dcb:	e8 bd e5 ff ff       	call   80038d <_panic>
+
+00801dd0 <open>:
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	56                   	push   %esi
+  801dd4:	53                   	push   %ebx
+  801dd5:	83 ec 1c             	sub    $0x1c,%esp
+  801dd8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ddb:	56                   	push   %esi
+  801ddc:	e8 30 ec ff ff       	call   800a11 <strlen>
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801de9:	0f 8f 85 00 00 00    	jg     801e74 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801def:	83 ec 0c             	sub    $0xc,%esp
+  801df2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df5:	50                   	push   %eax
+  801df6:	e8 a7 f6 ff ff       	call   8014a2 <fd_alloc>
+  801dfb:	89 c3                	mov    %eax,%ebx
+  801dfd:	83 c4 10             	add    $0x10,%esp
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	78 55                	js     801e59 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801e04:	83 ec 0c             	sub    $0xc,%esp
+  801e07:	68 04 70 80 00       	push   $0x807004
+  801e0c:	e8 28 18 00 00       	call   803639 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e11:	83 c4 08             	add    $0x8,%esp
+  801e14:	56                   	push   %esi
+  801e15:	68 00 80 80 00       	push   $0x808000
+  801e1a:	e8 2d ec ff ff       	call   800a4c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e22:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801e27:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e2f:	e8 7e fc ff ff       	call   801ab2 <fsipc>
+  801e34:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e36:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801e3d:	e8 64 18 00 00       	call   8036a6 <mutex_unlock>
+	if (r < 0) {
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	85 db                	test   %ebx,%ebx
+  801e47:	78 19                	js     801e62 <open+0x92>
+	return fd2num(fd);
+  801e49:	83 ec 0c             	sub    $0xc,%esp
+  801e4c:	ff 75 f4             	push   -0xc(%ebp)
+  801e4f:	e8 27 f6 ff ff       	call   80147b <fd2num>
+  801e54:	89 c3                	mov    %eax,%ebx
+  801e56:	83 c4 10             	add    $0x10,%esp
+}
+  801e59:	89 d8                	mov    %ebx,%eax
+  801e5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5e:	5b                   	pop    %ebx
+  801e5f:	5e                   	pop    %esi
+  801e60:	5d                   	pop    %ebp
+  801e61:	c3                   	ret
+		fd_close(fd, 0);
+  801e62:	83 ec 08             	sub    $0x8,%esp
+  801e65:	6a 00                	push   $0x0
+  801e67:	ff 75 f4             	push   -0xc(%ebp)
+  801e6a:	e8 56 f7 ff ff       	call   8015c5 <fd_close>
+		return r;
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	eb e5                	jmp    801e59 <open+0x89>
+		return -E_BAD_PATH;
+  801e74:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e79:	eb de                	jmp    801e59 <open+0x89>
+
+00801e7b <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e85:	50                   	push   %eax
+  801e86:	ff 75 08             	push   0x8(%ebp)
+  801e89:	e8 6a f6 ff ff       	call   8014f8 <fd_lookup>
+  801e8e:	89 c3                	mov    %eax,%ebx
+  801e90:	83 c4 10             	add    $0x10,%esp
+  801e93:	85 c0                	test   %eax,%eax
+  801e95:	78 5b                	js     801ef2 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e9a:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801ea0:	39 08                	cmp    %ecx,(%eax)
+  801ea2:	75 55                	jne    801ef9 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801ea4:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801ea8:	74 56                	je     801f00 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801eaa:	83 ec 0c             	sub    $0xc,%esp
+  801ead:	68 04 70 80 00       	push   $0x807004
+  801eb2:	e8 82 17 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801eb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eba:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebd:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801ec2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec5:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801eca:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ecd:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801edc:	e8 d1 fb ff ff       	call   801ab2 <fsipc>
+  801ee1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ee3:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801eea:	e8 b7 17 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+  801eef:	83 c4 10             	add    $0x10,%esp
+}
+  801ef2:	89 d8                	mov    %ebx,%eax
+  801ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ef9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801efe:	eb f2                	jmp    801ef2 <fallocate+0x77>
+		return -E_INVAL;
+  801f00:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f05:	eb eb                	jmp    801ef2 <fallocate+0x77>
+
+00801f07 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	56                   	push   %esi
+  801f0b:	53                   	push   %ebx
+  801f0c:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f0f:	89 f3                	mov    %esi,%ebx
+  801f11:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f17:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801f1a:	eb 06                	jmp    801f22 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801f1c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f22:	39 f3                	cmp    %esi,%ebx
+  801f24:	73 14                	jae    801f3a <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801f26:	83 ec 08             	sub    $0x8,%esp
+  801f29:	53                   	push   %ebx
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	e8 f2 ef ff ff       	call   800f23 <sys_page_unmap>
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	79 e4                	jns    801f1c <munmap+0x15>
+  801f38:	eb 05                	jmp    801f3f <munmap+0x38>
+			return r;
+	return 0;
+  801f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f42:	5b                   	pop    %ebx
+  801f43:	5e                   	pop    %esi
+  801f44:	5d                   	pop    %ebp
+  801f45:	c3                   	ret
+
+00801f46 <mmap>:
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	57                   	push   %edi
+  801f4a:	56                   	push   %esi
+  801f4b:	53                   	push   %ebx
+  801f4c:	83 ec 24             	sub    $0x24,%esp
+  801f4f:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f52:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f55:	50                   	push   %eax
+  801f56:	ff 75 08             	push   0x8(%ebp)
+  801f59:	e8 9a f5 ff ff       	call   8014f8 <fd_lookup>
+  801f5e:	83 c4 10             	add    $0x10,%esp
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	0f 88 37 01 00 00    	js     8020a0 <mmap+0x15a>
+		return NULL;
+  801f69:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f6e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f71:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801f77:	39 0a                	cmp    %ecx,(%edx)
+  801f79:	0f 85 05 01 00 00    	jne    802084 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801f7f:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801f86:	0f 85 1b 01 00 00    	jne    8020a7 <mmap+0x161>
+  801f8c:	89 f0                	mov    %esi,%eax
+  801f8e:	83 e8 01             	sub    $0x1,%eax
+  801f91:	0f 88 17 01 00 00    	js     8020ae <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801f97:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f9b:	75 28                	jne    801fc5 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801f9d:	83 ec 0c             	sub    $0xc,%esp
+  801fa0:	68 04 70 80 00       	push   $0x807004
+  801fa5:	e8 8f 16 00 00       	call   803639 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801faa:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801fb0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801fbe:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801fc3:	eb 2b                	jmp    801ff0 <mmap+0xaa>
+		cow_enable();
+  801fc5:	e8 f4 21 00 00       	call   8041be <cow_enable>
+  801fca:	eb d1                	jmp    801f9d <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801fcc:	89 c2                	mov    %eax,%edx
+  801fce:	c1 ea 0c             	shr    $0xc,%edx
+  801fd1:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801fd8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801fde:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801fe4:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801fe7:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801fe9:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801fee:	77 25                	ja     802015 <mmap+0xcf>
+  801ff0:	89 c2                	mov    %eax,%edx
+  801ff2:	29 da                	sub    %ebx,%edx
+  801ff4:	39 ca                	cmp    %ecx,%edx
+  801ff6:	73 3a                	jae    802032 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801ff8:	89 c2                	mov    %eax,%edx
+  801ffa:	c1 ea 16             	shr    $0x16,%edx
+  801ffd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802004:	f6 c2 01             	test   $0x1,%dl
+  802007:	75 c3                	jne    801fcc <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802009:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80200e:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802013:	eb d4                	jmp    801fe9 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802015:	29 d8                	sub    %ebx,%eax
+  802017:	39 c8                	cmp    %ecx,%eax
+  802019:	73 17                	jae    802032 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80201b:	83 ec 0c             	sub    $0xc,%esp
+  80201e:	68 04 70 80 00       	push   $0x807004
+  802023:	e8 7e 16 00 00       	call   8036a6 <mutex_unlock>
+		return NULL;
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	eb 52                	jmp    802084 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802032:	85 db                	test   %ebx,%ebx
+  802034:	74 e5                	je     80201b <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802036:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802039:	8b 40 0c             	mov    0xc(%eax),%eax
+  80203c:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802041:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802044:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802049:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  80204f:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802055:	8b 45 14             	mov    0x14(%ebp),%eax
+  802058:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80205d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802062:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802067:	e8 46 fa ff ff       	call   801ab2 <fsipc>
+  80206c:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80206e:	83 ec 0c             	sub    $0xc,%esp
+  802071:	68 04 70 80 00       	push   $0x807004
+  802076:	e8 2b 16 00 00       	call   8036a6 <mutex_unlock>
+	if (r < 0) {
+  80207b:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80207e:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802080:	85 ff                	test   %edi,%edi
+  802082:	78 08                	js     80208c <mmap+0x146>
+}
+  802084:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802087:	5b                   	pop    %ebx
+  802088:	5e                   	pop    %esi
+  802089:	5f                   	pop    %edi
+  80208a:	5d                   	pop    %ebp
+  80208b:	c3                   	ret
+		munmap((void*) va, len);
+  80208c:	83 ec 08             	sub    $0x8,%esp
+  80208f:	56                   	push   %esi
+  802090:	53                   	push   %ebx
+  802091:	e8 71 fe ff ff       	call   801f07 <munmap>
+		return NULL;
+  802096:	83 c4 10             	add    $0x10,%esp
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209e:	eb e4                	jmp    802084 <mmap+0x13e>
+		return NULL;
+  8020a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a5:	eb dd                	jmp    802084 <mmap+0x13e>
+		return NULL;
+  8020a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ac:	eb d6                	jmp    802084 <mmap+0x13e>
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	eb cf                	jmp    802084 <mmap+0x13e>
+
+008020b5 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	53                   	push   %ebx
+  8020b9:	83 ec 10             	sub    $0x10,%esp
+  8020bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8020bf:	53                   	push   %ebx
+  8020c0:	e8 4c e9 ff ff       	call   800a11 <strlen>
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020cd:	7f 42                	jg     802111 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8020cf:	83 ec 0c             	sub    $0xc,%esp
+  8020d2:	68 04 70 80 00       	push   $0x807004
+  8020d7:	e8 5d 15 00 00       	call   803639 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8020dc:	83 c4 08             	add    $0x8,%esp
+  8020df:	53                   	push   %ebx
+  8020e0:	68 00 80 80 00       	push   $0x808000
+  8020e5:	e8 62 e9 ff ff       	call   800a4c <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8020ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020f4:	e8 b9 f9 ff ff       	call   801ab2 <fsipc>
+  8020f9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020fb:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802102:	e8 9f 15 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+  802107:	83 c4 10             	add    $0x10,%esp
+}
+  80210a:	89 d8                	mov    %ebx,%eax
+  80210c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+		return -E_BAD_PATH;
+  802111:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802116:	eb f2                	jmp    80210a <remove+0x55>
+
+00802118 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	53                   	push   %ebx
+  80211c:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80211f:	68 04 70 80 00       	push   $0x807004
+  802124:	e8 10 15 00 00       	call   803639 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802133:	e8 7a f9 ff ff       	call   801ab2 <fsipc>
+  802138:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80213a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802141:	e8 60 15 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+}
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214b:	c9                   	leave
+  80214c:	c3                   	ret
+
+0080214d <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80214d:	55                   	push   %ebp
+  80214e:	89 e5                	mov    %esp,%ebp
+  802150:	56                   	push   %esi
+  802151:	53                   	push   %ebx
+  802152:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	68 04 70 80 00       	push   $0x807004
+  80215d:	e8 d7 14 00 00       	call   803639 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80216a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802174:	e8 39 f9 ff ff       	call   801ab2 <fsipc>
+  802179:	89 c6                	mov    %eax,%esi
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	85 db                	test   %ebx,%ebx
+  802180:	74 7b                	je     8021fd <fs_bcstat+0xb0>
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 77                	js     8021fd <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802186:	a1 00 80 80 00       	mov    0x808000,%eax
+  80218b:	89 03                	mov    %eax,(%ebx)
+  80218d:	a1 04 80 80 00       	mov    0x808004,%eax
+  802192:	89 43 04             	mov    %eax,0x4(%ebx)
+  802195:	a1 08 80 80 00       	mov    0x808008,%eax
+  80219a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80219d:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8021a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021a5:	a1 10 80 80 00       	mov    0x808010,%eax
+  8021aa:	89 43 10             	mov    %eax,0x10(%ebx)
+  8021ad:	a1 14 80 80 00       	mov    0x808014,%eax
+  8021b2:	89 43 14             	mov    %eax,0x14(%ebx)
+  8021b5:	a1 18 80 80 00       	mov    0x808018,%eax
+  8021ba:	89 43 18             	mov    %eax,0x18(%ebx)
+  8021bd:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8021c2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8021c5:	a1 20 80 80 00       	mov    0x808020,%eax
+  8021ca:	89 43 20             	mov    %eax,0x20(%ebx)
+  8021cd:	a1 24 80 80 00       	mov    0x808024,%eax
+  8021d2:	89 43 24             	mov    %eax,0x24(%ebx)
+  8021d5:	a1 28 80 80 00       	mov    0x808028,%eax
+  8021da:	89 43 28             	mov    %eax,0x28(%ebx)
+  8021dd:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8021e2:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8021e5:	a1 30 80 80 00       	mov    0x808030,%eax
+  8021ea:	89 43 30             	mov    %eax,0x30(%ebx)
+  8021ed:	a1 34 80 80 00       	mov    0x808034,%eax
+  8021f2:	89 43 34             	mov    %eax,0x34(%ebx)
+  8021f5:	a1 38 80 80 00       	mov    0x808038,%eax
+  8021fa:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8021fd:	83 ec 0c             	sub    $0xc,%esp
+  802200:	68 04 70 80 00       	push   $0x807004
+  802205:	e8 9c 14 00 00       	call   8036a6 <mutex_unlock>
+	return r;
+}
+  80220a:	89 f0                	mov    %esi,%eax
+  80220c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5d                   	pop    %ebp
+  802212:	c3                   	ret
+
+00802213 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	56                   	push   %esi
+  802217:	53                   	push   %ebx
+  802218:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80221a:	0f b6 10             	movzbl (%eax),%edx
+  80221d:	80 fa 72             	cmp    $0x72,%dl
+  802220:	74 44                	je     802266 <parse_mode+0x53>
+  802222:	80 fa 77             	cmp    $0x77,%dl
+  802225:	74 4b                	je     802272 <parse_mode+0x5f>
+  802227:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80222c:	80 fa 61             	cmp    $0x61,%dl
+  80222f:	74 09                	je     80223a <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802231:	89 d8                	mov    %ebx,%eax
+  802233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802236:	5b                   	pop    %ebx
+  802237:	5e                   	pop    %esi
+  802238:	5d                   	pop    %ebp
+  802239:	c3                   	ret
+	switch (mode[0]) {
+  80223a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80223f:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802244:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802246:	83 ec 08             	sub    $0x8,%esp
+  802249:	6a 2b                	push   $0x2b
+  80224b:	50                   	push   %eax
+  80224c:	e8 0d e9 ff ff       	call   800b5e <strchr>
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	85 c0                	test   %eax,%eax
+  802256:	74 d9                	je     802231 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802258:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80225b:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80225e:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802264:	eb cb                	jmp    802231 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802266:	ba 01 00 00 00       	mov    $0x1,%edx
+  80226b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802270:	eb d2                	jmp    802244 <parse_mode+0x31>
+  802272:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802277:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80227c:	eb c6                	jmp    802244 <parse_mode+0x31>
+
+0080227e <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80227e:	55                   	push   %ebp
+  80227f:	89 e5                	mov    %esp,%ebp
+  802281:	57                   	push   %edi
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	83 ec 1c             	sub    $0x1c,%esp
+  802287:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80228a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80228d:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802292:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802297:	83 c0 24             	add    $0x24,%eax
+  80229a:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80229e:	74 17                	je     8022b7 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022a0:	83 c3 01             	add    $0x1,%ebx
+  8022a3:	83 fb 10             	cmp    $0x10,%ebx
+  8022a6:	75 ef                	jne    802297 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8022a8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8022ad:	89 f0                	mov    %esi,%eax
+  8022af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b2:	5b                   	pop    %ebx
+  8022b3:	5e                   	pop    %esi
+  8022b4:	5f                   	pop    %edi
+  8022b5:	5d                   	pop    %ebp
+  8022b6:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8022b7:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8022be:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8022c1:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8022c4:	c1 e7 02             	shl    $0x2,%edi
+  8022c7:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8022cd:	83 ec 04             	sub    $0x4,%esp
+  8022d0:	6a 24                	push   $0x24
+  8022d2:	6a 00                	push   $0x0
+  8022d4:	56                   	push   %esi
+  8022d5:	e8 c3 e8 ff ff       	call   800b9d <memset>
+			streams[i].f_fd = fd;
+  8022da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022dd:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8022e3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8022e6:	01 d8                	add    %ebx,%eax
+  8022e8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8022eb:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	eb b6                	jmp    8022ad <stream_alloc+0x2f>
+
+008022f7 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	53                   	push   %ebx
+  8022fb:	83 ec 14             	sub    $0x14,%esp
+  8022fe:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802300:	8b 40 18             	mov    0x18(%eax),%eax
+  802303:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802306:	74 4a                	je     802352 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802308:	83 ec 08             	sub    $0x8,%esp
+  80230b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230e:	50                   	push   %eax
+  80230f:	ff 33                	push   (%ebx)
+  802311:	e8 e2 f1 ff ff       	call   8014f8 <fd_lookup>
+  802316:	89 c2                	mov    %eax,%edx
+  802318:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802320:	85 d2                	test   %edx,%edx
+  802322:	78 41                	js     802365 <stream_unread+0x6e>
+  802324:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802327:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80232d:	39 0a                	cmp    %ecx,(%edx)
+  80232f:	75 34                	jne    802365 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802331:	8b 43 14             	mov    0x14(%ebx),%eax
+  802334:	03 42 04             	add    0x4(%edx),%eax
+  802337:	2b 43 18             	sub    0x18(%ebx),%eax
+  80233a:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80233d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802344:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80234b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802350:	eb 13                	jmp    802365 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802352:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802359:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802360:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802368:	c9                   	leave
+  802369:	c3                   	ret
+
+0080236a <stream_drain>:
+{
+  80236a:	55                   	push   %ebp
+  80236b:	89 e5                	mov    %esp,%ebp
+  80236d:	56                   	push   %esi
+  80236e:	53                   	push   %ebx
+  80236f:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802371:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802376:	eb 02                	jmp    80237a <stream_drain+0x10>
+  802378:	01 c3                	add    %eax,%ebx
+  80237a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80237d:	39 c3                	cmp    %eax,%ebx
+  80237f:	73 43                	jae    8023c4 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802381:	83 ec 04             	sub    $0x4,%esp
+  802384:	29 d8                	sub    %ebx,%eax
+  802386:	50                   	push   %eax
+  802387:	89 d8                	mov    %ebx,%eax
+  802389:	03 46 0c             	add    0xc(%esi),%eax
+  80238c:	50                   	push   %eax
+  80238d:	ff 36                	push   (%esi)
+  80238f:	e8 ec f4 ff ff       	call   801880 <write>
+  802394:	83 c4 10             	add    $0x10,%esp
+  802397:	85 c0                	test   %eax,%eax
+  802399:	7f dd                	jg     802378 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80239b:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80239f:	8b 56 0c             	mov    0xc(%esi),%edx
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023a8:	29 d8                	sub    %ebx,%eax
+  8023aa:	50                   	push   %eax
+  8023ab:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8023ae:	50                   	push   %eax
+  8023af:	52                   	push   %edx
+  8023b0:	e8 1d e8 ff ff       	call   800bd2 <memmove>
+			f->f_wend -= done;
+  8023b5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023b8:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8023ba:	83 c4 10             	add    $0x10,%esp
+  8023bd:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8023c2:	eb 0a                	jmp    8023ce <stream_drain+0x64>
+  8023c4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8023c9:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8023ce:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8023d1:	89 d0                	mov    %edx,%eax
+  8023d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+
+008023da <stream_setup>:
+	if (f->f_buf)
+  8023da:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8023de:	74 01                	je     8023e1 <stream_setup+0x7>
+  8023e0:	c3                   	ret
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	53                   	push   %ebx
+  8023e5:	83 ec 04             	sub    $0x4,%esp
+  8023e8:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8023ea:	8b 40 08             	mov    0x8(%eax),%eax
+  8023ed:	85 c0                	test   %eax,%eax
+  8023ef:	74 17                	je     802408 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8023f1:	83 f8 03             	cmp    $0x3,%eax
+  8023f4:	75 2d                	jne    802423 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8023f6:	8d 43 20             	lea    0x20(%ebx),%eax
+  8023f9:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8023fc:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802403:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802406:	c9                   	leave
+  802407:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802408:	83 ec 0c             	sub    $0xc,%esp
+  80240b:	ff 33                	push   (%ebx)
+  80240d:	e8 29 1b 00 00       	call   803f3b <iscons>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	85 c0                	test   %eax,%eax
+  802417:	0f 9f c0             	setg   %al
+  80241a:	0f b6 c0             	movzbl %al,%eax
+  80241d:	83 c0 01             	add    $0x1,%eax
+  802420:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802423:	83 ec 0c             	sub    $0xc,%esp
+  802426:	68 00 10 00 00       	push   $0x1000
+  80242b:	e8 6e 0b 00 00       	call   802f9e <malloc>
+  802430:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802433:	83 c4 10             	add    $0x10,%esp
+  802436:	85 c0                	test   %eax,%eax
+  802438:	74 bc                	je     8023f6 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80243a:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802441:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802445:	eb bc                	jmp    802403 <stream_setup+0x29>
+
+00802447 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	53                   	push   %ebx
+  80244b:	83 ec 04             	sub    $0x4,%esp
+  80244e:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802450:	e8 85 ff ff ff       	call   8023da <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802455:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80245a:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80245e:	74 3d                	je     80249d <stream_fill+0x56>
+  802460:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802464:	74 10                	je     802476 <stream_fill+0x2f>
+  802466:	89 d8                	mov    %ebx,%eax
+  802468:	e8 fd fe ff ff       	call   80236a <stream_drain>
+		return 0;
+  80246d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802472:	85 c0                	test   %eax,%eax
+  802474:	78 27                	js     80249d <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802476:	83 ec 04             	sub    $0x4,%esp
+  802479:	ff 73 10             	push   0x10(%ebx)
+  80247c:	ff 73 0c             	push   0xc(%ebx)
+  80247f:	ff 33                	push   (%ebx)
+  802481:	e8 02 f3 ff ff       	call   801788 <read>
+  802486:	83 c4 10             	add    $0x10,%esp
+  802489:	85 c0                	test   %eax,%eax
+  80248b:	7e 17                	jle    8024a4 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80248d:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802491:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802498:	89 c2                	mov    %eax,%edx
+  80249a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80249d:	89 d0                	mov    %edx,%eax
+  80249f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024a4:	c1 f8 1f             	sar    $0x1f,%eax
+  8024a7:	83 e0 04             	and    $0x4,%eax
+  8024aa:	83 c0 04             	add    $0x4,%eax
+  8024ad:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8024b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b5:	eb e6                	jmp    80249d <stream_fill+0x56>
+
+008024b7 <fopen>:
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	57                   	push   %edi
+  8024bb:	56                   	push   %esi
+  8024bc:	53                   	push   %ebx
+  8024bd:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8024c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8024c6:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8024cc:	89 f0                	mov    %esi,%eax
+  8024ce:	e8 40 fd ff ff       	call   802213 <parse_mode>
+		return 0;
+  8024d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 2d                	js     802509 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8024dc:	83 ec 08             	sub    $0x8,%esp
+  8024df:	50                   	push   %eax
+  8024e0:	ff 75 08             	push   0x8(%ebp)
+  8024e3:	e8 e8 f8 ff ff       	call   801dd0 <open>
+  8024e8:	89 c7                	mov    %eax,%edi
+  8024ea:	83 c4 10             	add    $0x10,%esp
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	78 58                	js     802549 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8024f1:	80 3e 61             	cmpb   $0x61,(%esi)
+  8024f4:	74 1d                	je     802513 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8024f6:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8024fc:	89 f8                	mov    %edi,%eax
+  8024fe:	e8 7b fd ff ff       	call   80227e <stream_alloc>
+  802503:	89 c3                	mov    %eax,%ebx
+  802505:	85 c0                	test   %eax,%eax
+  802507:	74 32                	je     80253b <fopen+0x84>
+}
+  802509:	89 d8                	mov    %ebx,%eax
+  80250b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250e:	5b                   	pop    %ebx
+  80250f:	5e                   	pop    %esi
+  802510:	5f                   	pop    %edi
+  802511:	5d                   	pop    %ebp
+  802512:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802513:	83 ec 08             	sub    $0x8,%esp
+  802516:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80251c:	50                   	push   %eax
+  80251d:	57                   	push   %edi
+  80251e:	e8 db f4 ff ff       	call   8019fe <fstat>
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	85 c0                	test   %eax,%eax
+  802528:	78 cc                	js     8024f6 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80252a:	83 ec 08             	sub    $0x8,%esp
+  80252d:	ff 75 dc             	push   -0x24(%ebp)
+  802530:	57                   	push   %edi
+  802531:	e8 f6 f3 ff ff       	call   80192c <seek>
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	eb bb                	jmp    8024f6 <fopen+0x3f>
+		close(fd);
+  80253b:	83 ec 0c             	sub    $0xc,%esp
+  80253e:	57                   	push   %edi
+  80253f:	e8 08 f1 ff ff       	call   80164c <close>
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	eb c0                	jmp    802509 <fopen+0x52>
+		return 0;
+  802549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80254e:	eb b9                	jmp    802509 <fopen+0x52>
+
+00802550 <fdopen>:
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802556:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802559:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80255c:	e8 b2 fc ff ff       	call   802213 <parse_mode>
+  802561:	89 c2                	mov    %eax,%edx
+		return 0;
+  802563:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802568:	85 d2                	test   %edx,%edx
+  80256a:	78 0b                	js     802577 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80256c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80256f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802572:	e8 07 fd ff ff       	call   80227e <stream_alloc>
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+
+00802579 <setvbuf>:
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	57                   	push   %edi
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802582:	8b 55 10             	mov    0x10(%ebp),%edx
+  802585:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802588:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80258c:	75 3a                	jne    8025c8 <setvbuf+0x4f>
+  80258e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802591:	83 fe 02             	cmp    $0x2,%esi
+  802594:	77 39                	ja     8025cf <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802596:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802599:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80259d:	0f 95 c3             	setne  %bl
+  8025a0:	85 ff                	test   %edi,%edi
+  8025a2:	0f 95 c1             	setne  %cl
+  8025a5:	84 cb                	test   %cl,%bl
+  8025a7:	74 05                	je     8025ae <setvbuf+0x35>
+  8025a9:	83 fa 03             	cmp    $0x3,%edx
+  8025ac:	75 0a                	jne    8025b8 <setvbuf+0x3f>
+	return 0;
+  8025ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b3:	5b                   	pop    %ebx
+  8025b4:	5e                   	pop    %esi
+  8025b5:	5f                   	pop    %edi
+  8025b6:	5d                   	pop    %ebp
+  8025b7:	c3                   	ret
+		f->f_buf = buf;
+  8025b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025bb:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8025be:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8025c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c6:	eb eb                	jmp    8025b3 <setvbuf+0x3a>
+		return EOF;
+  8025c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025cd:	eb e4                	jmp    8025b3 <setvbuf+0x3a>
+  8025cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025d4:	eb dd                	jmp    8025b3 <setvbuf+0x3a>
+
+008025d6 <fflush>:
+{
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	57                   	push   %edi
+  8025da:	56                   	push   %esi
+  8025db:	53                   	push   %ebx
+  8025dc:	83 ec 0c             	sub    $0xc,%esp
+  8025df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8025e2:	85 db                	test   %ebx,%ebx
+  8025e4:	74 1a                	je     802600 <fflush+0x2a>
+	stream_unread(f);
+  8025e6:	89 d8                	mov    %ebx,%eax
+  8025e8:	e8 0a fd ff ff       	call   8022f7 <stream_unread>
+	return stream_drain(f);
+  8025ed:	89 d8                	mov    %ebx,%eax
+  8025ef:	e8 76 fd ff ff       	call   80236a <stream_drain>
+  8025f4:	89 c7                	mov    %eax,%edi
+}
+  8025f6:	89 f8                	mov    %edi,%eax
+  8025f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fb:	5b                   	pop    %ebx
+  8025fc:	5e                   	pop    %esi
+  8025fd:	5f                   	pop    %edi
+  8025fe:	5d                   	pop    %ebp
+  8025ff:	c3                   	ret
+  802600:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802605:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80260a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260f:	eb 03                	jmp    802614 <fflush+0x3e>
+  802611:	83 c3 24             	add    $0x24,%ebx
+  802614:	39 f3                	cmp    %esi,%ebx
+  802616:	74 de                	je     8025f6 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802618:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80261c:	74 f3                	je     802611 <fflush+0x3b>
+  80261e:	83 ec 0c             	sub    $0xc,%esp
+  802621:	53                   	push   %ebx
+  802622:	e8 af ff ff ff       	call   8025d6 <fflush>
+  802627:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802631:	0f 48 f8             	cmovs  %eax,%edi
+  802634:	eb db                	jmp    802611 <fflush+0x3b>
+
+00802636 <fclose>:
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	56                   	push   %esi
+  80263a:	53                   	push   %ebx
+  80263b:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80263e:	83 ec 0c             	sub    $0xc,%esp
+  802641:	56                   	push   %esi
+  802642:	e8 8f ff ff ff       	call   8025d6 <fflush>
+  802647:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802649:	83 c4 04             	add    $0x4,%esp
+  80264c:	ff 36                	push   (%esi)
+  80264e:	e8 f9 ef ff ff       	call   80164c <close>
+  802653:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802656:	85 c0                	test   %eax,%eax
+  802658:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80265d:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802660:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802664:	75 10                	jne    802676 <fclose+0x40>
+	f->f_flags = 0;
+  802666:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80266d:	89 d8                	mov    %ebx,%eax
+  80266f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802672:	5b                   	pop    %ebx
+  802673:	5e                   	pop    %esi
+  802674:	5d                   	pop    %ebp
+  802675:	c3                   	ret
+		free(f->f_buf);
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	ff 76 0c             	push   0xc(%esi)
+  80267c:	e8 54 08 00 00       	call   802ed5 <free>
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	eb e0                	jmp    802666 <fclose+0x30>
+
+00802686 <fileno>:
+{
+  802686:	55                   	push   %ebp
+  802687:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	8b 00                	mov    (%eax),%eax
+}
+  80268e:	5d                   	pop    %ebp
+  80268f:	c3                   	ret
+
+00802690 <feof>:
+{
+  802690:	55                   	push   %ebp
+  802691:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802693:	8b 45 08             	mov    0x8(%ebp),%eax
+  802696:	8b 40 04             	mov    0x4(%eax),%eax
+  802699:	c1 e8 02             	shr    $0x2,%eax
+  80269c:	83 e0 01             	and    $0x1,%eax
+}
+  80269f:	5d                   	pop    %ebp
+  8026a0:	c3                   	ret
+
+008026a1 <ferror>:
+{
+  8026a1:	55                   	push   %ebp
+  8026a2:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8026a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a7:	8b 40 04             	mov    0x4(%eax),%eax
+  8026aa:	c1 e8 03             	shr    $0x3,%eax
+  8026ad:	83 e0 01             	and    $0x1,%eax
+}
+  8026b0:	5d                   	pop    %ebp
+  8026b1:	c3                   	ret
+
+008026b2 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8026b2:	55                   	push   %ebp
+  8026b3:	89 e5                	mov    %esp,%ebp
+  8026b5:	53                   	push   %ebx
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8026bc:	8b 43 18             	mov    0x18(%ebx),%eax
+  8026bf:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8026c2:	74 15                	je     8026d9 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8026c4:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8026c7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8026ca:	8d 48 01             	lea    0x1(%eax),%ecx
+  8026cd:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8026d0:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8026d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d7:	c9                   	leave
+  8026d8:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8026d9:	89 d8                	mov    %ebx,%eax
+  8026db:	e8 67 fd ff ff       	call   802447 <stream_fill>
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	75 e0                	jne    8026c4 <fgetc+0x12>
+		return EOF;
+  8026e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026e9:	eb e9                	jmp    8026d4 <fgetc+0x22>
+
+008026eb <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8026eb:	55                   	push   %ebp
+  8026ec:	89 e5                	mov    %esp,%ebp
+  8026ee:	57                   	push   %edi
+  8026ef:	56                   	push   %esi
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 1c             	sub    $0x1c,%esp
+  8026f4:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8026f7:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8026fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ff:	83 e8 01             	sub    $0x1,%eax
+  802702:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802705:	eb 66                	jmp    80276d <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802707:	8b 46 14             	mov    0x14(%esi),%eax
+  80270a:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80270d:	29 c3                	sub    %eax,%ebx
+  80270f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802712:	29 fa                	sub    %edi,%edx
+  802714:	39 d3                	cmp    %edx,%ebx
+  802716:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802719:	83 ec 04             	sub    $0x4,%esp
+  80271c:	53                   	push   %ebx
+  80271d:	6a 0a                	push   $0xa
+  80271f:	03 46 0c             	add    0xc(%esi),%eax
+  802722:	50                   	push   %eax
+  802723:	e8 5b e5 ff ff       	call   800c83 <memfind>
+  802728:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80272b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80272e:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802731:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802734:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802736:	83 c4 10             	add    $0x10,%esp
+  802739:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80273c:	74 0b                	je     802749 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80273e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802741:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802744:	29 d3                	sub    %edx,%ebx
+  802746:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802749:	83 ec 04             	sub    $0x4,%esp
+  80274c:	53                   	push   %ebx
+  80274d:	01 c8                	add    %ecx,%eax
+  80274f:	50                   	push   %eax
+  802750:	89 f8                	mov    %edi,%eax
+  802752:	03 45 08             	add    0x8(%ebp),%eax
+  802755:	50                   	push   %eax
+  802756:	e8 77 e4 ff ff       	call   800bd2 <memmove>
+		f->f_rpos += m;
+  80275b:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80275e:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802760:	83 c4 10             	add    $0x10,%esp
+  802763:	8b 45 08             	mov    0x8(%ebp),%eax
+  802766:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80276b:	74 1f                	je     80278c <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80276d:	8d 47 01             	lea    0x1(%edi),%eax
+  802770:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802773:	73 17                	jae    80278c <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802775:	8b 46 18             	mov    0x18(%esi),%eax
+  802778:	39 46 14             	cmp    %eax,0x14(%esi)
+  80277b:	75 8a                	jne    802707 <fgets+0x1c>
+  80277d:	89 f0                	mov    %esi,%eax
+  80277f:	e8 c3 fc ff ff       	call   802447 <stream_fill>
+  802784:	85 c0                	test   %eax,%eax
+  802786:	0f 85 7b ff ff ff    	jne    802707 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80278c:	85 ff                	test   %edi,%edi
+  80278e:	74 0f                	je     80279f <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802790:	8b 45 08             	mov    0x8(%ebp),%eax
+  802793:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279a:	5b                   	pop    %ebx
+  80279b:	5e                   	pop    %esi
+  80279c:	5f                   	pop    %edi
+  80279d:	5d                   	pop    %ebp
+  80279e:	c3                   	ret
+		return 0;
+  80279f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a4:	eb f1                	jmp    802797 <fgets+0xac>
+
+008027a6 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8027a6:	55                   	push   %ebp
+  8027a7:	89 e5                	mov    %esp,%ebp
+  8027a9:	57                   	push   %edi
+  8027aa:	56                   	push   %esi
+  8027ab:	53                   	push   %ebx
+  8027ac:	83 ec 1c             	sub    $0x1c,%esp
+  8027af:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8027b2:	89 f0                	mov    %esi,%eax
+  8027b4:	e8 21 fc ff ff       	call   8023da <stream_setup>
+	want = size * n;
+  8027b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027bc:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8027c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8027c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c8:	eb 43                	jmp    80280d <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8027ca:	29 d3                	sub    %edx,%ebx
+  8027cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027cf:	29 f8                	sub    %edi,%eax
+  8027d1:	39 c3                	cmp    %eax,%ebx
+  8027d3:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8027d6:	83 ec 04             	sub    $0x4,%esp
+  8027d9:	53                   	push   %ebx
+  8027da:	03 56 0c             	add    0xc(%esi),%edx
+  8027dd:	52                   	push   %edx
+  8027de:	89 f8                	mov    %edi,%eax
+  8027e0:	03 45 08             	add    0x8(%ebp),%eax
+  8027e3:	50                   	push   %eax
+  8027e4:	e8 e9 e3 ff ff       	call   800bd2 <memmove>
+			f->f_rpos += m;
+  8027e9:	01 5e 14             	add    %ebx,0x14(%esi)
+  8027ec:	83 c4 10             	add    $0x10,%esp
+  8027ef:	eb 1a                	jmp    80280b <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8027f1:	83 ec 04             	sub    $0x4,%esp
+  8027f4:	53                   	push   %ebx
+  8027f5:	89 f8                	mov    %edi,%eax
+  8027f7:	03 45 08             	add    0x8(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	ff 36                	push   (%esi)
+  8027fd:	e8 86 ef ff ff       	call   801788 <read>
+  802802:	89 c3                	mov    %eax,%ebx
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	85 c0                	test   %eax,%eax
+  802809:	7e 36                	jle    802841 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80280b:	01 df                	add    %ebx,%edi
+  80280d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802810:	39 c7                	cmp    %eax,%edi
+  802812:	73 39                	jae    80284d <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802814:	8b 56 14             	mov    0x14(%esi),%edx
+  802817:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80281a:	39 da                	cmp    %ebx,%edx
+  80281c:	72 ac                	jb     8027ca <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80281e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802821:	29 fb                	sub    %edi,%ebx
+  802823:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802826:	72 3e                	jb     802866 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802828:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80282c:	74 1f                	je     80284d <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80282e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802832:	74 bd                	je     8027f1 <fread+0x4b>
+  802834:	89 f0                	mov    %esi,%eax
+  802836:	e8 2f fb ff ff       	call   80236a <stream_drain>
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	79 b2                	jns    8027f1 <fread+0x4b>
+  80283f:	eb 0c                	jmp    80284d <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802841:	c1 fb 1f             	sar    $0x1f,%ebx
+  802844:	83 e3 04             	and    $0x4,%ebx
+  802847:	83 c3 04             	add    $0x4,%ebx
+  80284a:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80284d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802850:	85 c0                	test   %eax,%eax
+  802852:	74 0a                	je     80285e <fread+0xb8>
+  802854:	89 f8                	mov    %edi,%eax
+  802856:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285b:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80285e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802861:	5b                   	pop    %ebx
+  802862:	5e                   	pop    %esi
+  802863:	5f                   	pop    %edi
+  802864:	5d                   	pop    %ebp
+  802865:	c3                   	ret
+		} else if (!stream_fill(f))
+  802866:	89 f0                	mov    %esi,%eax
+  802868:	e8 da fb ff ff       	call   802447 <stream_fill>
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	74 dc                	je     80284d <fread+0xa7>
+			m = 0;
+  802871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802876:	eb 93                	jmp    80280b <fread+0x65>
+
+00802878 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	57                   	push   %edi
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	83 ec 1c             	sub    $0x1c,%esp
+  802881:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802884:	8b 43 04             	mov    0x4(%ebx),%eax
+  802887:	a8 02                	test   $0x2,%al
+  802889:	75 13                	jne    80289e <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80288b:	83 c8 08             	or     $0x8,%eax
+  80288e:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802899:	5b                   	pop    %ebx
+  80289a:	5e                   	pop    %esi
+  80289b:	5f                   	pop    %edi
+  80289c:	5d                   	pop    %ebp
+  80289d:	c3                   	ret
+	stream_setup(f);
+  80289e:	89 d8                	mov    %ebx,%eax
+  8028a0:	e8 35 fb ff ff       	call   8023da <stream_setup>
+	want = size * n;
+  8028a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a8:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8028ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8028af:	89 d8                	mov    %ebx,%eax
+  8028b1:	e8 41 fa ff ff       	call   8022f7 <stream_unread>
+	for (done = 0; done < want; ) {
+  8028b6:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8028bb:	84 c0                	test   %al,%al
+  8028bd:	75 7b                	jne    80293a <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8028bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8028c7:	39 fe                	cmp    %edi,%esi
+  8028c9:	73 24                	jae    8028ef <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8028cb:	83 ec 04             	sub    $0x4,%esp
+  8028ce:	89 f8                	mov    %edi,%eax
+  8028d0:	29 f0                	sub    %esi,%eax
+  8028d2:	50                   	push   %eax
+  8028d3:	89 f0                	mov    %esi,%eax
+  8028d5:	03 45 08             	add    0x8(%ebp),%eax
+  8028d8:	50                   	push   %eax
+  8028d9:	ff 33                	push   (%ebx)
+  8028db:	e8 a0 ef ff ff       	call   801880 <write>
+  8028e0:	83 c4 10             	add    $0x10,%esp
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	7e 04                	jle    8028eb <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8028e7:	01 c6                	add    %eax,%esi
+  8028e9:	eb dc                	jmp    8028c7 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8028eb:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8028ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	74 a0                	je     802896 <fwrite+0x1e>
+  8028f6:	89 f0                	mov    %esi,%eax
+  8028f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fd:	f7 75 0c             	divl   0xc(%ebp)
+  802900:	eb 94                	jmp    802896 <fwrite+0x1e>
+			done += r;
+  802902:	01 c7                	add    %eax,%edi
+			continue;
+  802904:	eb 34                	jmp    80293a <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802906:	8b 73 10             	mov    0x10(%ebx),%esi
+  802909:	29 c6                	sub    %eax,%esi
+  80290b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80290e:	29 fa                	sub    %edi,%edx
+  802910:	39 d6                	cmp    %edx,%esi
+  802912:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802915:	83 ec 04             	sub    $0x4,%esp
+  802918:	56                   	push   %esi
+  802919:	89 fa                	mov    %edi,%edx
+  80291b:	03 55 08             	add    0x8(%ebp),%edx
+  80291e:	52                   	push   %edx
+  80291f:	03 43 0c             	add    0xc(%ebx),%eax
+  802922:	50                   	push   %eax
+  802923:	e8 aa e2 ff ff       	call   800bd2 <memmove>
+		f->f_wend += m;
+  802928:	89 f0                	mov    %esi,%eax
+  80292a:	03 43 1c             	add    0x1c(%ebx),%eax
+  80292d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802930:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802938:	74 5b                	je     802995 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80293a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80293d:	39 c7                	cmp    %eax,%edi
+  80293f:	73 2d                	jae    80296e <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802941:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802944:	85 c0                	test   %eax,%eax
+  802946:	75 be                	jne    802906 <fwrite+0x8e>
+  802948:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80294b:	29 fa                	sub    %edi,%edx
+  80294d:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802950:	72 b4                	jb     802906 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802952:	83 ec 04             	sub    $0x4,%esp
+  802955:	52                   	push   %edx
+  802956:	89 f8                	mov    %edi,%eax
+  802958:	03 45 08             	add    0x8(%ebp),%eax
+  80295b:	50                   	push   %eax
+  80295c:	ff 33                	push   (%ebx)
+  80295e:	e8 1d ef ff ff       	call   801880 <write>
+  802963:	83 c4 10             	add    $0x10,%esp
+  802966:	85 c0                	test   %eax,%eax
+  802968:	7f 98                	jg     802902 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80296a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80296e:	8b 43 08             	mov    0x8(%ebx),%eax
+  802971:	83 f8 03             	cmp    $0x3,%eax
+  802974:	74 48                	je     8029be <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802976:	83 f8 02             	cmp    $0x2,%eax
+  802979:	74 27                	je     8029a2 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80297b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80297e:	85 c0                	test   %eax,%eax
+  802980:	0f 84 10 ff ff ff    	je     802896 <fwrite+0x1e>
+  802986:	89 f8                	mov    %edi,%eax
+  802988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298d:	f7 75 0c             	divl   0xc(%ebp)
+  802990:	e9 01 ff ff ff       	jmp    802896 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802995:	89 d8                	mov    %ebx,%eax
+  802997:	e8 ce f9 ff ff       	call   80236a <stream_drain>
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	79 9a                	jns    80293a <fwrite+0xc2>
+  8029a0:	eb cc                	jmp    80296e <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8029a2:	83 ec 04             	sub    $0x4,%esp
+  8029a5:	57                   	push   %edi
+  8029a6:	6a 0a                	push   $0xa
+  8029a8:	ff 75 08             	push   0x8(%ebp)
+  8029ab:	e8 d3 e2 ff ff       	call   800c83 <memfind>
+  8029b0:	89 c2                	mov    %eax,%edx
+  8029b2:	89 f8                	mov    %edi,%eax
+  8029b4:	03 45 08             	add    0x8(%ebp),%eax
+  8029b7:	83 c4 10             	add    $0x10,%esp
+  8029ba:	39 c2                	cmp    %eax,%edx
+  8029bc:	74 bd                	je     80297b <fwrite+0x103>
+		stream_drain(f);
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	e8 a5 f9 ff ff       	call   80236a <stream_drain>
+  8029c5:	eb b4                	jmp    80297b <fwrite+0x103>
+
+008029c7 <fputc>:
+{
+  8029c7:	55                   	push   %ebp
+  8029c8:	89 e5                	mov    %esp,%ebp
+  8029ca:	53                   	push   %ebx
+  8029cb:	83 ec 14             	sub    $0x14,%esp
+  8029ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8029d1:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8029d4:	ff 75 0c             	push   0xc(%ebp)
+  8029d7:	6a 01                	push   $0x1
+  8029d9:	6a 01                	push   $0x1
+  8029db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029de:	50                   	push   %eax
+  8029df:	e8 94 fe ff ff       	call   802878 <fwrite>
+  8029e4:	83 c4 10             	add    $0x10,%esp
+  8029e7:	0f b6 db             	movzbl %bl,%ebx
+  8029ea:	83 f8 01             	cmp    $0x1,%eax
+  8029ed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029f2:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8029f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+008029fa <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8029fa:	55                   	push   %ebp
+  8029fb:	89 e5                	mov    %esp,%ebp
+  8029fd:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802a00:	ff 75 0c             	push   0xc(%ebp)
+  802a03:	ff 75 08             	push   0x8(%ebp)
+  802a06:	e8 bc ff ff ff       	call   8029c7 <fputc>
+}
+  802a0b:	83 c4 10             	add    $0x10,%esp
+  802a0e:	c9                   	leave
+  802a0f:	c3                   	ret
+
+00802a10 <fputs>:
+{
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	56                   	push   %esi
+  802a14:	53                   	push   %ebx
+  802a15:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802a18:	83 ec 0c             	sub    $0xc,%esp
+  802a1b:	56                   	push   %esi
+  802a1c:	e8 f0 df ff ff       	call   800a11 <strlen>
+  802a21:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802a23:	ff 75 0c             	push   0xc(%ebp)
+  802a26:	50                   	push   %eax
+  802a27:	6a 01                	push   $0x1
+  802a29:	56                   	push   %esi
+  802a2a:	e8 49 fe ff ff       	call   802878 <fwrite>
+  802a2f:	83 c4 20             	add    $0x20,%esp
+  802a32:	39 d8                	cmp    %ebx,%eax
+  802a34:	0f 95 c0             	setne  %al
+  802a37:	0f b6 c0             	movzbl %al,%eax
+  802a3a:	f7 d8                	neg    %eax
+}
+  802a3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a3f:	5b                   	pop    %ebx
+  802a40:	5e                   	pop    %esi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+
+00802a43 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802a43:	55                   	push   %ebp
+  802a44:	89 e5                	mov    %esp,%ebp
+  802a46:	53                   	push   %ebx
+  802a47:	83 ec 04             	sub    $0x4,%esp
+  802a4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802a4d:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802a50:	50                   	push   %eax
+  802a51:	ff 75 0c             	push   0xc(%ebp)
+  802a54:	53                   	push   %ebx
+  802a55:	68 fa 29 80 00       	push   $0x8029fa
+  802a5a:	e8 00 db ff ff       	call   80055f <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802a5f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a62:	c1 e0 1c             	shl    $0x1c,%eax
+  802a65:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802a68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a6b:	c9                   	leave
+  802a6c:	c3                   	ret
+
+00802a6d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a73:	68 f8 4f 80 00       	push   $0x804ff8
+  802a78:	ff 75 0c             	push   0xc(%ebp)
+  802a7b:	e8 cc df ff ff       	call   800a4c <strcpy>
+	return 0;
+}
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a85:	c9                   	leave
+  802a86:	c3                   	ret
+
+00802a87 <devsock_close>:
+{
+  802a87:	55                   	push   %ebp
+  802a88:	89 e5                	mov    %esp,%ebp
+  802a8a:	53                   	push   %ebx
+  802a8b:	83 ec 10             	sub    $0x10,%esp
+  802a8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a91:	53                   	push   %ebx
+  802a92:	e8 23 1d 00 00       	call   8047ba <pageref>
+  802a97:	89 c2                	mov    %eax,%edx
+  802a99:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802aa1:	83 fa 01             	cmp    $0x1,%edx
+  802aa4:	74 05                	je     802aab <devsock_close+0x24>
+}
+  802aa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa9:	c9                   	leave
+  802aaa:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	ff 73 0c             	push   0xc(%ebx)
+  802ab1:	e8 b7 02 00 00       	call   802d6d <nsipc_close>
+  802ab6:	83 c4 10             	add    $0x10,%esp
+  802ab9:	eb eb                	jmp    802aa6 <devsock_close+0x1f>
+
+00802abb <devsock_write>:
+{
+  802abb:	55                   	push   %ebp
+  802abc:	89 e5                	mov    %esp,%ebp
+  802abe:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ac1:	6a 00                	push   $0x0
+  802ac3:	ff 75 10             	push   0x10(%ebp)
+  802ac6:	ff 75 0c             	push   0xc(%ebp)
+  802ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acc:	ff 70 0c             	push   0xc(%eax)
+  802acf:	e8 79 03 00 00       	call   802e4d <nsipc_send>
+}
+  802ad4:	c9                   	leave
+  802ad5:	c3                   	ret
+
+00802ad6 <devsock_read>:
+{
+  802ad6:	55                   	push   %ebp
+  802ad7:	89 e5                	mov    %esp,%ebp
+  802ad9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802adc:	6a 00                	push   $0x0
+  802ade:	ff 75 10             	push   0x10(%ebp)
+  802ae1:	ff 75 0c             	push   0xc(%ebp)
+  802ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae7:	ff 70 0c             	push   0xc(%eax)
+  802aea:	e8 ef 02 00 00       	call   802dde <nsipc_recv>
+}
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+
+00802af1 <fd2sockid>:
+{
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802af7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802afa:	52                   	push   %edx
+  802afb:	50                   	push   %eax
+  802afc:	e8 f7 e9 ff ff       	call   8014f8 <fd_lookup>
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	85 c0                	test   %eax,%eax
+  802b06:	78 10                	js     802b18 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b0b:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802b11:	39 08                	cmp    %ecx,(%eax)
+  802b13:	75 05                	jne    802b1a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b15:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b18:	c9                   	leave
+  802b19:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b1a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b1f:	eb f7                	jmp    802b18 <fd2sockid+0x27>
+
+00802b21 <alloc_sockfd>:
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	56                   	push   %esi
+  802b25:	53                   	push   %ebx
+  802b26:	83 ec 1c             	sub    $0x1c,%esp
+  802b29:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b2e:	50                   	push   %eax
+  802b2f:	e8 6e e9 ff ff       	call   8014a2 <fd_alloc>
+  802b34:	89 c3                	mov    %eax,%ebx
+  802b36:	83 c4 10             	add    $0x10,%esp
+  802b39:	85 c0                	test   %eax,%eax
+  802b3b:	78 43                	js     802b80 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b3d:	83 ec 04             	sub    $0x4,%esp
+  802b40:	68 07 04 00 00       	push   $0x407
+  802b45:	ff 75 f4             	push   -0xc(%ebp)
+  802b48:	6a 00                	push   $0x0
+  802b4a:	e8 3b e3 ff ff       	call   800e8a <sys_page_alloc>
+  802b4f:	89 c3                	mov    %eax,%ebx
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 28                	js     802b80 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b5b:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802b61:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b66:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b6d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b70:	83 ec 0c             	sub    $0xc,%esp
+  802b73:	50                   	push   %eax
+  802b74:	e8 02 e9 ff ff       	call   80147b <fd2num>
+  802b79:	89 c3                	mov    %eax,%ebx
+  802b7b:	83 c4 10             	add    $0x10,%esp
+  802b7e:	eb 0c                	jmp    802b8c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b80:	83 ec 0c             	sub    $0xc,%esp
+  802b83:	56                   	push   %esi
+  802b84:	e8 e4 01 00 00       	call   802d6d <nsipc_close>
+		return r;
+  802b89:	83 c4 10             	add    $0x10,%esp
+}
+  802b8c:	89 d8                	mov    %ebx,%eax
+  802b8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b91:	5b                   	pop    %ebx
+  802b92:	5e                   	pop    %esi
+  802b93:	5d                   	pop    %ebp
+  802b94:	c3                   	ret
+
+00802b95 <accept>:
+{
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9e:	e8 4e ff ff ff       	call   802af1 <fd2sockid>
+  802ba3:	85 c0                	test   %eax,%eax
+  802ba5:	78 1b                	js     802bc2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802ba7:	83 ec 04             	sub    $0x4,%esp
+  802baa:	ff 75 10             	push   0x10(%ebp)
+  802bad:	ff 75 0c             	push   0xc(%ebp)
+  802bb0:	50                   	push   %eax
+  802bb1:	e8 0e 01 00 00       	call   802cc4 <nsipc_accept>
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	78 05                	js     802bc2 <accept+0x2d>
+	return alloc_sockfd(r);
+  802bbd:	e8 5f ff ff ff       	call   802b21 <alloc_sockfd>
+}
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+
+00802bc4 <bind>:
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	e8 1f ff ff ff       	call   802af1 <fd2sockid>
+  802bd2:	85 c0                	test   %eax,%eax
+  802bd4:	78 12                	js     802be8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bd6:	83 ec 04             	sub    $0x4,%esp
+  802bd9:	ff 75 10             	push   0x10(%ebp)
+  802bdc:	ff 75 0c             	push   0xc(%ebp)
+  802bdf:	50                   	push   %eax
+  802be0:	e8 31 01 00 00       	call   802d16 <nsipc_bind>
+  802be5:	83 c4 10             	add    $0x10,%esp
+}
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <shutdown>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf3:	e8 f9 fe ff ff       	call   802af1 <fd2sockid>
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 0f                	js     802c0b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bfc:	83 ec 08             	sub    $0x8,%esp
+  802bff:	ff 75 0c             	push   0xc(%ebp)
+  802c02:	50                   	push   %eax
+  802c03:	e8 43 01 00 00       	call   802d4b <nsipc_shutdown>
+  802c08:	83 c4 10             	add    $0x10,%esp
+}
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+
+00802c0d <connect>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+  802c10:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c16:	e8 d6 fe ff ff       	call   802af1 <fd2sockid>
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	78 12                	js     802c31 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c1f:	83 ec 04             	sub    $0x4,%esp
+  802c22:	ff 75 10             	push   0x10(%ebp)
+  802c25:	ff 75 0c             	push   0xc(%ebp)
+  802c28:	50                   	push   %eax
+  802c29:	e8 59 01 00 00       	call   802d87 <nsipc_connect>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+}
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+
+00802c33 <listen>:
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c3c:	e8 b0 fe ff ff       	call   802af1 <fd2sockid>
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	78 0f                	js     802c54 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c45:	83 ec 08             	sub    $0x8,%esp
+  802c48:	ff 75 0c             	push   0xc(%ebp)
+  802c4b:	50                   	push   %eax
+  802c4c:	e8 6b 01 00 00       	call   802dbc <nsipc_listen>
+  802c51:	83 c4 10             	add    $0x10,%esp
+}
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+
+00802c56 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c56:	55                   	push   %ebp
+  802c57:	89 e5                	mov    %esp,%ebp
+  802c59:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c5c:	ff 75 10             	push   0x10(%ebp)
+  802c5f:	ff 75 0c             	push   0xc(%ebp)
+  802c62:	ff 75 08             	push   0x8(%ebp)
+  802c65:	e8 41 02 00 00       	call   802eab <nsipc_socket>
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	78 05                	js     802c76 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c71:	e8 ab fe ff ff       	call   802b21 <alloc_sockfd>
+}
+  802c76:	c9                   	leave
+  802c77:	c3                   	ret
+
+00802c78 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	53                   	push   %ebx
+  802c7c:	83 ec 04             	sub    $0x4,%esp
+  802c7f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c81:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802c88:	74 26                	je     802cb0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c8a:	6a 07                	push   $0x7
+  802c8c:	68 00 90 80 00       	push   $0x809000
+  802c91:	53                   	push   %ebx
+  802c92:	ff 35 08 70 80 00    	push   0x807008
+  802c98:	e8 88 1a 00 00       	call   804725 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c9d:	83 c4 0c             	add    $0xc,%esp
+  802ca0:	6a 00                	push   $0x0
+  802ca2:	6a 00                	push   $0x0
+  802ca4:	6a 00                	push   $0x0
+  802ca6:	e8 84 19 00 00       	call   80462f <ipc_recv>
+}
+  802cab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cb0:	83 ec 0c             	sub    $0xc,%esp
+  802cb3:	6a 02                	push   $0x2
+  802cb5:	e8 c1 1a 00 00       	call   80477b <ipc_find_env>
+  802cba:	a3 08 70 80 00       	mov    %eax,0x807008
+  802cbf:	83 c4 10             	add    $0x10,%esp
+  802cc2:	eb c6                	jmp    802c8a <nsipc+0x12>
+
+00802cc4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802cc4:	55                   	push   %ebp
+  802cc5:	89 e5                	mov    %esp,%ebp
+  802cc7:	56                   	push   %esi
+  802cc8:	53                   	push   %ebx
+  802cc9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ccf:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cd4:	8b 06                	mov    (%esi),%eax
+  802cd6:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802cdb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ce0:	e8 93 ff ff ff       	call   802c78 <nsipc>
+  802ce5:	89 c3                	mov    %eax,%ebx
+  802ce7:	85 c0                	test   %eax,%eax
+  802ce9:	79 09                	jns    802cf4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ceb:	89 d8                	mov    %ebx,%eax
+  802ced:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf0:	5b                   	pop    %ebx
+  802cf1:	5e                   	pop    %esi
+  802cf2:	5d                   	pop    %ebp
+  802cf3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	ff 35 10 90 80 00    	push   0x809010
+  802cfd:	68 00 90 80 00       	push   $0x809000
+  802d02:	ff 75 0c             	push   0xc(%ebp)
+  802d05:	e8 c8 de ff ff       	call   800bd2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d0a:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d0f:	89 06                	mov    %eax,(%esi)
+  802d11:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d14:	eb d5                	jmp    802ceb <nsipc_accept+0x27>
+
+00802d16 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d16:	55                   	push   %ebp
+  802d17:	89 e5                	mov    %esp,%ebp
+  802d19:	53                   	push   %ebx
+  802d1a:	83 ec 08             	sub    $0x8,%esp
+  802d1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d23:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d28:	53                   	push   %ebx
+  802d29:	ff 75 0c             	push   0xc(%ebp)
+  802d2c:	68 04 90 80 00       	push   $0x809004
+  802d31:	e8 9c de ff ff       	call   800bd2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d36:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d3c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d41:	e8 32 ff ff ff       	call   802c78 <nsipc>
+}
+  802d46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d49:	c9                   	leave
+  802d4a:	c3                   	ret
+
+00802d4b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d4b:	55                   	push   %ebp
+  802d4c:	89 e5                	mov    %esp,%ebp
+  802d4e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d54:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d5c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d61:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d66:	e8 0d ff ff ff       	call   802c78 <nsipc>
+}
+  802d6b:	c9                   	leave
+  802d6c:	c3                   	ret
+
+00802d6d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d6d:	55                   	push   %ebp
+  802d6e:	89 e5                	mov    %esp,%ebp
+  802d70:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d76:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802d7b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d80:	e8 f3 fe ff ff       	call   802c78 <nsipc>
+}
+  802d85:	c9                   	leave
+  802d86:	c3                   	ret
+
+00802d87 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	53                   	push   %ebx
+  802d8b:	83 ec 08             	sub    $0x8,%esp
+  802d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d94:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d99:	53                   	push   %ebx
+  802d9a:	ff 75 0c             	push   0xc(%ebp)
+  802d9d:	68 04 90 80 00       	push   $0x809004
+  802da2:	e8 2b de ff ff       	call   800bd2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802da7:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802dad:	b8 05 00 00 00       	mov    $0x5,%eax
+  802db2:	e8 c1 fe ff ff       	call   802c78 <nsipc>
+}
+  802db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dba:	c9                   	leave
+  802dbb:	c3                   	ret
+
+00802dbc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dbc:	55                   	push   %ebp
+  802dbd:	89 e5                	mov    %esp,%ebp
+  802dbf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802dca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dcd:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802dd2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802dd7:	e8 9c fe ff ff       	call   802c78 <nsipc>
+}
+  802ddc:	c9                   	leave
+  802ddd:	c3                   	ret
+
+00802dde <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dde:	55                   	push   %ebp
+  802ddf:	89 e5                	mov    %esp,%ebp
+  802de1:	56                   	push   %esi
+  802de2:	53                   	push   %ebx
+  802de3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802de6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802dee:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802df4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802df7:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dfc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e01:	e8 72 fe ff ff       	call   802c78 <nsipc>
+  802e06:	89 c3                	mov    %eax,%ebx
+  802e08:	85 c0                	test   %eax,%eax
+  802e0a:	78 22                	js     802e2e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e0c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e11:	39 c6                	cmp    %eax,%esi
+  802e13:	0f 4e c6             	cmovle %esi,%eax
+  802e16:	39 c3                	cmp    %eax,%ebx
+  802e18:	7f 1d                	jg     802e37 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e1a:	83 ec 04             	sub    $0x4,%esp
+  802e1d:	53                   	push   %ebx
+  802e1e:	68 00 90 80 00       	push   $0x809000
+  802e23:	ff 75 0c             	push   0xc(%ebp)
+  802e26:	e8 a7 dd ff ff       	call   800bd2 <memmove>
+  802e2b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e2e:	89 d8                	mov    %ebx,%eax
+  802e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e33:	5b                   	pop    %ebx
+  802e34:	5e                   	pop    %esi
+  802e35:	5d                   	pop    %ebp
+  802e36:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e37:	68 04 50 80 00       	push   $0x805004
+  802e3c:	68 bd 4f 80 00       	push   $0x804fbd
+  802e41:	6a 62                	push   $0x62
+  802e43:	68 19 50 80 00       	push   $0x805019
+  802e48:	e8 40 d5 ff ff       	call   80038d <_panic>
+
+00802e4d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e4d:	55                   	push   %ebp
+  802e4e:	89 e5                	mov    %esp,%ebp
+  802e50:	53                   	push   %ebx
+  802e51:	83 ec 04             	sub    $0x4,%esp
+  802e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5a:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e5f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e65:	7f 2e                	jg     802e95 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e67:	83 ec 04             	sub    $0x4,%esp
+  802e6a:	53                   	push   %ebx
+  802e6b:	ff 75 0c             	push   0xc(%ebp)
+  802e6e:	68 0c 90 80 00       	push   $0x80900c
+  802e73:	e8 5a dd ff ff       	call   800bd2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e78:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802e7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e81:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802e86:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e8b:	e8 e8 fd ff ff       	call   802c78 <nsipc>
+}
+  802e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e93:	c9                   	leave
+  802e94:	c3                   	ret
+	assert(size < 1600);
+  802e95:	68 25 50 80 00       	push   $0x805025
+  802e9a:	68 bd 4f 80 00       	push   $0x804fbd
+  802e9f:	6a 6d                	push   $0x6d
+  802ea1:	68 19 50 80 00       	push   $0x805019
+  802ea6:	e8 e2 d4 ff ff       	call   80038d <_panic>
+
+00802eab <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802eab:	55                   	push   %ebp
+  802eac:	89 e5                	mov    %esp,%ebp
+  802eae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ebc:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ec1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ec4:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802ec9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ece:	e8 a5 fd ff ff       	call   802c78 <nsipc>
+}
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+
+00802ed5 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802ed5:	55                   	push   %ebp
+  802ed6:	89 e5                	mov    %esp,%ebp
+  802ed8:	53                   	push   %ebx
+  802ed9:	83 ec 10             	sub    $0x10,%esp
+  802edc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802edf:	68 0c 70 80 00       	push   $0x80700c
+  802ee4:	e8 50 07 00 00       	call   803639 <mutex_lock>
+	if (v == 0)
+  802ee9:	83 c4 10             	add    $0x10,%esp
+  802eec:	85 db                	test   %ebx,%ebx
+  802eee:	0f 84 85 00 00 00    	je     802f79 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802ef4:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802efa:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802eff:	77 51                	ja     802f52 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802f01:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802f07:	89 d8                	mov    %ebx,%eax
+  802f09:	c1 e8 0c             	shr    $0xc,%eax
+  802f0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f13:	f6 c4 02             	test   $0x2,%ah
+  802f16:	74 50                	je     802f68 <free+0x93>
+		sys_page_unmap(0, c);
+  802f18:	83 ec 08             	sub    $0x8,%esp
+  802f1b:	53                   	push   %ebx
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	e8 00 e0 ff ff       	call   800f23 <sys_page_unmap>
+		c += PGSIZE;
+  802f23:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802f29:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f37:	76 ce                	jbe    802f07 <free+0x32>
+  802f39:	68 6f 50 80 00       	push   $0x80506f
+  802f3e:	68 bd 4f 80 00       	push   $0x804fbd
+  802f43:	68 82 00 00 00       	push   $0x82
+  802f48:	68 62 50 80 00       	push   $0x805062
+  802f4d:	e8 3b d4 ff ff       	call   80038d <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802f52:	68 34 50 80 00       	push   $0x805034
+  802f57:	68 bd 4f 80 00       	push   $0x804fbd
+  802f5c:	6a 7b                	push   $0x7b
+  802f5e:	68 62 50 80 00       	push   $0x805062
+  802f63:	e8 25 d4 ff ff       	call   80038d <_panic>
+	if (--(*ref) == 0)
+  802f68:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802f6e:	83 e8 01             	sub    $0x1,%eax
+  802f71:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802f77:	74 15                	je     802f8e <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802f79:	83 ec 0c             	sub    $0xc,%esp
+  802f7c:	68 0c 70 80 00       	push   $0x80700c
+  802f81:	e8 20 07 00 00       	call   8036a6 <mutex_unlock>
+}
+  802f86:	83 c4 10             	add    $0x10,%esp
+  802f89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f8c:	c9                   	leave
+  802f8d:	c3                   	ret
+		sys_page_unmap(0, c);
+  802f8e:	83 ec 08             	sub    $0x8,%esp
+  802f91:	53                   	push   %ebx
+  802f92:	6a 00                	push   $0x0
+  802f94:	e8 8a df ff ff       	call   800f23 <sys_page_unmap>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	eb db                	jmp    802f79 <free+0xa4>
+
+00802f9e <malloc>:
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	57                   	push   %edi
+  802fa2:	56                   	push   %esi
+  802fa3:	53                   	push   %ebx
+  802fa4:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802fa7:	68 0c 70 80 00       	push   $0x80700c
+  802fac:	e8 88 06 00 00       	call   803639 <mutex_lock>
+	if (mptr == 0)
+  802fb1:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802fb7:	83 c4 10             	add    $0x10,%esp
+  802fba:	85 ff                	test   %edi,%edi
+  802fbc:	74 6c                	je     80302a <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802fbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc1:	83 c0 03             	add    $0x3,%eax
+  802fc4:	83 e0 fc             	and    $0xfffffffc,%eax
+  802fc7:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802fc9:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802fce:	0f 87 64 01 00 00    	ja     803138 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802fd4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802fda:	74 30                	je     80300c <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802fdc:	89 f9                	mov    %edi,%ecx
+  802fde:	c1 e9 0c             	shr    $0xc,%ecx
+  802fe1:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802fe5:	c1 e8 0c             	shr    $0xc,%eax
+  802fe8:	39 c1                	cmp    %eax,%ecx
+  802fea:	74 5f                	je     80304b <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802fec:	83 ec 0c             	sub    $0xc,%esp
+  802fef:	57                   	push   %edi
+  802ff0:	e8 e0 fe ff ff       	call   802ed5 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802ff5:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ffa:	05 00 10 00 00       	add    $0x1000,%eax
+  802fff:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803004:	a3 10 70 80 00       	mov    %eax,0x807010
+  803009:	83 c4 10             	add    $0x10,%esp
+  80300c:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803012:	ba 02 00 00 00       	mov    $0x2,%edx
+  803017:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80301b:	8d 7e 04             	lea    0x4(%esi),%edi
+  80301e:	89 cb                	mov    %ecx,%ebx
+  803020:	01 f9                	add    %edi,%ecx
+  803022:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803025:	e9 8b 00 00 00       	jmp    8030b5 <malloc+0x117>
+		mptr = mbegin;
+  80302a:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803031:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803034:	8b 45 08             	mov    0x8(%ebp),%eax
+  803037:	83 c0 03             	add    $0x3,%eax
+  80303a:	83 e0 fc             	and    $0xfffffffc,%eax
+  80303d:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80303f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803044:	76 c6                	jbe    80300c <malloc+0x6e>
+  803046:	e9 d6 00 00 00       	jmp    803121 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80304b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803056:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80305a:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80305d:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803062:	e9 ba 00 00 00       	jmp    803121 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803067:	05 00 10 00 00       	add    $0x1000,%eax
+  80306c:	39 c8                	cmp    %ecx,%eax
+  80306e:	0f 83 cb 00 00 00    	jae    80313f <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803074:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803079:	77 22                	ja     80309d <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80307b:	89 c2                	mov    %eax,%edx
+  80307d:	c1 ea 16             	shr    $0x16,%edx
+  803080:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803087:	f6 c2 01             	test   $0x1,%dl
+  80308a:	74 db                	je     803067 <malloc+0xc9>
+  80308c:	89 c2                	mov    %eax,%edx
+  80308e:	c1 ea 0c             	shr    $0xc,%edx
+  803091:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803098:	f6 c2 01             	test   $0x1,%dl
+  80309b:	74 ca                	je     803067 <malloc+0xc9>
+		if (mptr == mend) {
+  80309d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030a3:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8030a9:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8030ad:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8030b3:	74 04                	je     8030b9 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8030b5:	89 d8                	mov    %ebx,%eax
+  8030b7:	eb b3                	jmp    80306c <malloc+0xce>
+  8030b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8030bc:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8030c1:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8030c5:	83 ea 01             	sub    $0x1,%edx
+  8030c8:	0f 85 50 ff ff ff    	jne    80301e <malloc+0x80>
+  8030ce:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8030d5:	00 00 08 
+				return 0;	/* out of address space */
+  8030d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030dd:	eb 42                	jmp    803121 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8030df:	85 db                	test   %ebx,%ebx
+  8030e1:	78 1e                	js     803101 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8030e3:	83 ec 08             	sub    $0x8,%esp
+  8030e6:	89 d8                	mov    %ebx,%eax
+  8030e8:	03 05 10 70 80 00    	add    0x807010,%eax
+  8030ee:	50                   	push   %eax
+  8030ef:	6a 00                	push   $0x0
+  8030f1:	e8 2d de ff ff       	call   800f23 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8030f6:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8030fc:	83 c4 10             	add    $0x10,%esp
+  8030ff:	eb de                	jmp    8030df <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803101:	bf 00 00 00 00       	mov    $0x0,%edi
+  803106:	eb 19                	jmp    803121 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803108:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80310b:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803111:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803118:	00 
+	mptr += n;
+  803119:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80311c:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803121:	83 ec 0c             	sub    $0xc,%esp
+  803124:	68 0c 70 80 00       	push   $0x80700c
+  803129:	e8 78 05 00 00       	call   8036a6 <mutex_unlock>
+}
+  80312e:	89 f8                	mov    %edi,%eax
+  803130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803133:	5b                   	pop    %ebx
+  803134:	5e                   	pop    %esi
+  803135:	5f                   	pop    %edi
+  803136:	5d                   	pop    %ebp
+  803137:	c3                   	ret
+		return 0;
+  803138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313d:	eb e2                	jmp    803121 <malloc+0x183>
+  80313f:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803143:	74 06                	je     80314b <malloc+0x1ad>
+  803145:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80314b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803150:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803153:	39 fb                	cmp    %edi,%ebx
+  803155:	73 b1                	jae    803108 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803157:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80315d:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803160:	39 fe                	cmp    %edi,%esi
+  803162:	0f 92 c0             	setb   %al
+  803165:	0f b6 c0             	movzbl %al,%eax
+  803168:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80316b:	83 c8 07             	or     $0x7,%eax
+  80316e:	50                   	push   %eax
+  80316f:	89 d8                	mov    %ebx,%eax
+  803171:	03 05 10 70 80 00    	add    0x807010,%eax
+  803177:	50                   	push   %eax
+  803178:	6a 00                	push   $0x0
+  80317a:	e8 0b dd ff ff       	call   800e8a <sys_page_alloc>
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	85 c0                	test   %eax,%eax
+  803184:	0f 88 55 ff ff ff    	js     8030df <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80318a:	89 f3                	mov    %esi,%ebx
+  80318c:	eb c5                	jmp    803153 <malloc+0x1b5>
+
+0080318e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80318e:	55                   	push   %ebp
+  80318f:	89 e5                	mov    %esp,%ebp
+  803191:	56                   	push   %esi
+  803192:	53                   	push   %ebx
+  803193:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803196:	83 ec 0c             	sub    $0xc,%esp
+  803199:	ff 75 08             	push   0x8(%ebp)
+  80319c:	e8 ea e2 ff ff       	call   80148b <fd2data>
+  8031a1:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031a3:	83 c4 08             	add    $0x8,%esp
+  8031a6:	68 87 50 80 00       	push   $0x805087
+  8031ab:	53                   	push   %ebx
+  8031ac:	e8 9b d8 ff ff       	call   800a4c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8031b1:	8b 46 04             	mov    0x4(%esi),%eax
+  8031b4:	2b 06                	sub    (%esi),%eax
+  8031b6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8031bc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8031c3:	00 00 00 
+	stat->st_dev = &devpipe;
+  8031c6:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8031cd:	62 80 00 
+	return 0;
+}
+  8031d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031d8:	5b                   	pop    %ebx
+  8031d9:	5e                   	pop    %esi
+  8031da:	5d                   	pop    %ebp
+  8031db:	c3                   	ret
+
+008031dc <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8031dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031e1:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8031e5:	85 c9                	test   %ecx,%ecx
+  8031e7:	75 01                	jne    8031ea <pipewake+0xe>
+  8031e9:	c3                   	ret
+{
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8031f0:	68 00 04 00 00       	push   $0x400
+  8031f5:	52                   	push   %edx
+  8031f6:	e8 d3 df ff ff       	call   8011ce <sys_futex_wake>
+  8031fb:	83 c4 10             	add    $0x10,%esp
+}
+  8031fe:	c9                   	leave
+  8031ff:	c3                   	ret
+
+00803200 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803200:	55                   	push   %ebp
+  803201:	89 e5                	mov    %esp,%ebp
+  803203:	56                   	push   %esi
+  803204:	53                   	push   %ebx
+  803205:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803208:	83 ec 0c             	sub    $0xc,%esp
+  80320b:	56                   	push   %esi
+  80320c:	e8 7a e2 ff ff       	call   80148b <fd2data>
+  803211:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803213:	83 c4 08             	add    $0x8,%esp
+  803216:	56                   	push   %esi
+  803217:	6a 00                	push   $0x0
+  803219:	e8 05 dd ff ff       	call   800f23 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80321e:	8d 53 04             	lea    0x4(%ebx),%edx
+  803221:	8d 43 08             	lea    0x8(%ebx),%eax
+  803224:	e8 b3 ff ff ff       	call   8031dc <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803229:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80322c:	89 da                	mov    %ebx,%edx
+  80322e:	e8 a9 ff ff ff       	call   8031dc <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803233:	89 34 24             	mov    %esi,(%esp)
+  803236:	e8 50 e2 ff ff       	call   80148b <fd2data>
+  80323b:	83 c4 08             	add    $0x8,%esp
+  80323e:	50                   	push   %eax
+  80323f:	6a 00                	push   $0x0
+  803241:	e8 dd dc ff ff       	call   800f23 <sys_page_unmap>
+}
+  803246:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803249:	5b                   	pop    %ebx
+  80324a:	5e                   	pop    %esi
+  80324b:	5d                   	pop    %ebp
+  80324c:	c3                   	ret
+
+0080324d <_pipeisclosed>:
+{
+  80324d:	55                   	push   %ebp
+  80324e:	89 e5                	mov    %esp,%ebp
+  803250:	57                   	push   %edi
+  803251:	56                   	push   %esi
+  803252:	53                   	push   %ebx
+  803253:	83 ec 1c             	sub    $0x1c,%esp
+  803256:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803259:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80325b:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803260:	eb 5d                	jmp    8032bf <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803262:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		n = thisenv->env_runs;
+  803268:	8b 02                	mov    (%edx),%eax
+  80326a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80326d:	83 ec 0c             	sub    $0xc,%esp
+  803270:	ff 75 e0             	push   -0x20(%ebp)
+  803273:	e8 42 15 00 00       	call   8047ba <pageref>
+  803278:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80327b:	89 3c 24             	mov    %edi,(%esp)
+  80327e:	e8 37 15 00 00       	call   8047ba <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803283:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803285:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80328b:	83 c4 10             	add    $0x10,%esp
+  80328e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803294:	77 15                	ja     8032ab <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803296:	89 f2                	mov    %esi,%edx
+  803298:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80329a:	c1 ea 10             	shr    $0x10,%edx
+  80329d:	74 0c                	je     8032ab <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80329f:	c1 e2 10             	shl    $0x10,%edx
+  8032a2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8032a7:	29 d1                	sub    %edx,%ecx
+  8032a9:	eb 06                	jmp    8032b1 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8032ab:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		nn = thisenv->env_runs;
+  8032b1:	8b 11                	mov    (%ecx),%edx
+  8032b3:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8032b6:	39 d3                	cmp    %edx,%ebx
+  8032b8:	74 6e                	je     803328 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8032ba:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032bd:	74 24                	je     8032e3 <_pipeisclosed+0x96>
+  8032bf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032c1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8032c7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8032cc:	77 94                	ja     803262 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032ce:	89 f0                	mov    %esi,%eax
+  8032d0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8032d2:	c1 e8 10             	shr    $0x10,%eax
+  8032d5:	74 8b                	je     803262 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8032d7:	c1 e0 10             	shl    $0x10,%eax
+  8032da:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8032df:	29 c2                	sub    %eax,%edx
+  8032e1:	eb 85                	jmp    803268 <_pipeisclosed+0x1b>
+  8032e3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032e5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8032eb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8032f0:	77 18                	ja     80330a <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032f2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8032f7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8032f9:	c1 e8 10             	shr    $0x10,%eax
+  8032fc:	74 0c                	je     80330a <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8032fe:	c1 e0 10             	shl    $0x10,%eax
+  803301:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803306:	29 c2                	sub    %eax,%edx
+  803308:	eb 06                	jmp    803310 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80330a:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803310:	8b 02                	mov    (%edx),%eax
+  803312:	8b 40 58             	mov    0x58(%eax),%eax
+  803315:	6a 01                	push   $0x1
+  803317:	50                   	push   %eax
+  803318:	53                   	push   %ebx
+  803319:	68 8e 50 80 00       	push   $0x80508e
+  80331e:	e8 45 d1 ff ff       	call   800468 <cprintf>
+  803323:	83 c4 10             	add    $0x10,%esp
+  803326:	eb 97                	jmp    8032bf <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803328:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80332b:	0f 94 c0             	sete   %al
+  80332e:	0f b6 c0             	movzbl %al,%eax
+}
+  803331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803334:	5b                   	pop    %ebx
+  803335:	5e                   	pop    %esi
+  803336:	5f                   	pop    %edi
+  803337:	5d                   	pop    %ebp
+  803338:	c3                   	ret
+
+00803339 <devpipe_write>:
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	57                   	push   %edi
+  80333d:	56                   	push   %esi
+  80333e:	53                   	push   %ebx
+  80333f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803342:	ff 75 08             	push   0x8(%ebp)
+  803345:	e8 41 e1 ff ff       	call   80148b <fd2data>
+  80334a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80334c:	83 c4 10             	add    $0x10,%esp
+  80334f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803356:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803359:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80335c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80335f:	0f 84 96 00 00 00    	je     8033fb <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803365:	8d 73 08             	lea    0x8(%ebx),%esi
+  803368:	eb 32                	jmp    80339c <devpipe_write+0x63>
+  80336a:	89 fa                	mov    %edi,%edx
+  80336c:	89 f0                	mov    %esi,%eax
+  80336e:	e8 69 fe ff ff       	call   8031dc <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803373:	8b 43 04             	mov    0x4(%ebx),%eax
+  803376:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803379:	ba 01 00 00 00       	mov    $0x1,%edx
+  80337e:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803383:	83 ec 04             	sub    $0x4,%esp
+  803386:	6a 0a                	push   $0xa
+  803388:	50                   	push   %eax
+  803389:	53                   	push   %ebx
+  80338a:	e8 10 de ff ff       	call   80119f <sys_futex_wait>
+  80338f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803394:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803399:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80339c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80339f:	8b 0b                	mov    (%ebx),%ecx
+  8033a1:	8d 51 20             	lea    0x20(%ecx),%edx
+  8033a4:	39 d0                	cmp    %edx,%eax
+  8033a6:	72 1b                	jb     8033c3 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8033a8:	89 da                	mov    %ebx,%edx
+  8033aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ad:	e8 9b fe ff ff       	call   80324d <_pipeisclosed>
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	74 b4                	je     80336a <devpipe_write+0x31>
+				return 0;
+  8033b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033be:	5b                   	pop    %ebx
+  8033bf:	5e                   	pop    %esi
+  8033c0:	5f                   	pop    %edi
+  8033c1:	5d                   	pop    %ebp
+  8033c2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8033c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033c6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8033c9:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8033cd:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8033d0:	89 c2                	mov    %eax,%edx
+  8033d2:	c1 fa 1f             	sar    $0x1f,%edx
+  8033d5:	89 d1                	mov    %edx,%ecx
+  8033d7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8033da:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8033dd:	83 e2 1f             	and    $0x1f,%edx
+  8033e0:	29 ca                	sub    %ecx,%edx
+  8033e2:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8033e6:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8033ea:	83 c0 01             	add    $0x1,%eax
+  8033ed:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8033f0:	83 c6 01             	add    $0x1,%esi
+  8033f3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8033f6:	e9 5e ff ff ff       	jmp    803359 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8033fb:	8d 53 04             	lea    0x4(%ebx),%edx
+  8033fe:	8d 43 08             	lea    0x8(%ebx),%eax
+  803401:	e8 d6 fd ff ff       	call   8031dc <pipewake>
+	return i;
+  803406:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803409:	eb b0                	jmp    8033bb <devpipe_write+0x82>
+
+0080340b <devpipe_read>:
+{
+  80340b:	55                   	push   %ebp
+  80340c:	89 e5                	mov    %esp,%ebp
+  80340e:	57                   	push   %edi
+  80340f:	56                   	push   %esi
+  803410:	53                   	push   %ebx
+  803411:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803414:	ff 75 08             	push   0x8(%ebp)
+  803417:	e8 6f e0 ff ff       	call   80148b <fd2data>
+  80341c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80341e:	83 c4 10             	add    $0x10,%esp
+  803421:	be 00 00 00 00       	mov    $0x0,%esi
+  803426:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803429:	74 6c                	je     803497 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80342b:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80342e:	eb 25                	jmp    803455 <devpipe_read+0x4a>
+  803430:	8b 13                	mov    (%ebx),%edx
+  803432:	b8 01 00 00 00       	mov    $0x1,%eax
+  803437:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80343c:	83 ec 04             	sub    $0x4,%esp
+  80343f:	6a 0a                	push   $0xa
+  803441:	52                   	push   %edx
+  803442:	57                   	push   %edi
+  803443:	e8 57 dd ff ff       	call   80119f <sys_futex_wait>
+  803448:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80344d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803452:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803455:	8b 03                	mov    (%ebx),%eax
+  803457:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80345a:	75 19                	jne    803475 <devpipe_read+0x6a>
+			if (i > 0)
+  80345c:	85 f6                	test   %esi,%esi
+  80345e:	75 3a                	jne    80349a <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803460:	89 da                	mov    %ebx,%edx
+  803462:	8b 45 08             	mov    0x8(%ebp),%eax
+  803465:	e8 e3 fd ff ff       	call   80324d <_pipeisclosed>
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	74 c2                	je     803430 <devpipe_read+0x25>
+				return 0;
+  80346e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803473:	eb 31                	jmp    8034a6 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803475:	89 c1                	mov    %eax,%ecx
+  803477:	c1 f9 1f             	sar    $0x1f,%ecx
+  80347a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80347d:	01 c8                	add    %ecx,%eax
+  80347f:	83 e0 1f             	and    $0x1f,%eax
+  803482:	29 c8                	sub    %ecx,%eax
+  803484:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80348c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80348f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803492:	83 c6 01             	add    $0x1,%esi
+  803495:	eb 8f                	jmp    803426 <devpipe_read+0x1b>
+out:
+  803497:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80349a:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80349d:	89 da                	mov    %ebx,%edx
+  80349f:	e8 38 fd ff ff       	call   8031dc <pipewake>
+	return i;
+  8034a4:	89 f0                	mov    %esi,%eax
+}
+  8034a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a9:	5b                   	pop    %ebx
+  8034aa:	5e                   	pop    %esi
+  8034ab:	5f                   	pop    %edi
+  8034ac:	5d                   	pop    %ebp
+  8034ad:	c3                   	ret
+
+008034ae <pipe>:
+{
+  8034ae:	55                   	push   %ebp
+  8034af:	89 e5                	mov    %esp,%ebp
+  8034b1:	56                   	push   %esi
+  8034b2:	53                   	push   %ebx
+  8034b3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8034b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034b9:	50                   	push   %eax
+  8034ba:	e8 e3 df ff ff       	call   8014a2 <fd_alloc>
+  8034bf:	89 c3                	mov    %eax,%ebx
+  8034c1:	83 c4 10             	add    $0x10,%esp
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	0f 88 23 01 00 00    	js     8035ef <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034cc:	83 ec 04             	sub    $0x4,%esp
+  8034cf:	68 07 04 00 00       	push   $0x407
+  8034d4:	ff 75 f4             	push   -0xc(%ebp)
+  8034d7:	6a 00                	push   $0x0
+  8034d9:	e8 ac d9 ff ff       	call   800e8a <sys_page_alloc>
+  8034de:	89 c3                	mov    %eax,%ebx
+  8034e0:	83 c4 10             	add    $0x10,%esp
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	0f 88 04 01 00 00    	js     8035ef <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8034eb:	83 ec 0c             	sub    $0xc,%esp
+  8034ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8034f1:	50                   	push   %eax
+  8034f2:	e8 ab df ff ff       	call   8014a2 <fd_alloc>
+  8034f7:	89 c3                	mov    %eax,%ebx
+  8034f9:	83 c4 10             	add    $0x10,%esp
+  8034fc:	85 c0                	test   %eax,%eax
+  8034fe:	0f 88 db 00 00 00    	js     8035df <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803504:	83 ec 04             	sub    $0x4,%esp
+  803507:	68 07 04 00 00       	push   $0x407
+  80350c:	ff 75 f0             	push   -0x10(%ebp)
+  80350f:	6a 00                	push   $0x0
+  803511:	e8 74 d9 ff ff       	call   800e8a <sys_page_alloc>
+  803516:	89 c3                	mov    %eax,%ebx
+  803518:	83 c4 10             	add    $0x10,%esp
+  80351b:	85 c0                	test   %eax,%eax
+  80351d:	0f 88 bc 00 00 00    	js     8035df <pipe+0x131>
+	va = fd2data(fd0);
+  803523:	83 ec 0c             	sub    $0xc,%esp
+  803526:	ff 75 f4             	push   -0xc(%ebp)
+  803529:	e8 5d df ff ff       	call   80148b <fd2data>
+  80352e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803530:	83 c4 0c             	add    $0xc,%esp
+  803533:	68 07 04 00 00       	push   $0x407
+  803538:	50                   	push   %eax
+  803539:	6a 00                	push   $0x0
+  80353b:	e8 4a d9 ff ff       	call   800e8a <sys_page_alloc>
+  803540:	89 c3                	mov    %eax,%ebx
+  803542:	83 c4 10             	add    $0x10,%esp
+  803545:	85 c0                	test   %eax,%eax
+  803547:	0f 88 82 00 00 00    	js     8035cf <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80354d:	83 ec 0c             	sub    $0xc,%esp
+  803550:	ff 75 f0             	push   -0x10(%ebp)
+  803553:	e8 33 df ff ff       	call   80148b <fd2data>
+  803558:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80355f:	50                   	push   %eax
+  803560:	6a 00                	push   $0x0
+  803562:	56                   	push   %esi
+  803563:	6a 00                	push   $0x0
+  803565:	e8 6d d9 ff ff       	call   800ed7 <sys_page_map>
+  80356a:	89 c3                	mov    %eax,%ebx
+  80356c:	83 c4 20             	add    $0x20,%esp
+  80356f:	85 c0                	test   %eax,%eax
+  803571:	78 4e                	js     8035c1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803573:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803578:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80357b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80357d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803580:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803587:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80358a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80358c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80358f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803596:	83 ec 0c             	sub    $0xc,%esp
+  803599:	ff 75 f4             	push   -0xc(%ebp)
+  80359c:	e8 da de ff ff       	call   80147b <fd2num>
+  8035a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035a4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8035a6:	83 c4 04             	add    $0x4,%esp
+  8035a9:	ff 75 f0             	push   -0x10(%ebp)
+  8035ac:	e8 ca de ff ff       	call   80147b <fd2num>
+  8035b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035b4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8035b7:	83 c4 10             	add    $0x10,%esp
+  8035ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035bf:	eb 2e                	jmp    8035ef <pipe+0x141>
+	sys_page_unmap(0, va);
+  8035c1:	83 ec 08             	sub    $0x8,%esp
+  8035c4:	56                   	push   %esi
+  8035c5:	6a 00                	push   $0x0
+  8035c7:	e8 57 d9 ff ff       	call   800f23 <sys_page_unmap>
+  8035cc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8035cf:	83 ec 08             	sub    $0x8,%esp
+  8035d2:	ff 75 f0             	push   -0x10(%ebp)
+  8035d5:	6a 00                	push   $0x0
+  8035d7:	e8 47 d9 ff ff       	call   800f23 <sys_page_unmap>
+  8035dc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8035df:	83 ec 08             	sub    $0x8,%esp
+  8035e2:	ff 75 f4             	push   -0xc(%ebp)
+  8035e5:	6a 00                	push   $0x0
+  8035e7:	e8 37 d9 ff ff       	call   800f23 <sys_page_unmap>
+  8035ec:	83 c4 10             	add    $0x10,%esp
+}
+  8035ef:	89 d8                	mov    %ebx,%eax
+  8035f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035f4:	5b                   	pop    %ebx
+  8035f5:	5e                   	pop    %esi
+  8035f6:	5d                   	pop    %ebp
+  8035f7:	c3                   	ret
+
+008035f8 <pipeisclosed>:
+{
+  8035f8:	55                   	push   %ebp
+  8035f9:	89 e5                	mov    %esp,%ebp
+  8035fb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803601:	50                   	push   %eax
+  803602:	ff 75 08             	push   0x8(%ebp)
+  803605:	e8 ee de ff ff       	call   8014f8 <fd_lookup>
+  80360a:	83 c4 10             	add    $0x10,%esp
+  80360d:	85 c0                	test   %eax,%eax
+  80360f:	78 18                	js     803629 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803611:	83 ec 0c             	sub    $0xc,%esp
+  803614:	ff 75 f4             	push   -0xc(%ebp)
+  803617:	e8 6f de ff ff       	call   80148b <fd2data>
+  80361c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80361e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803621:	e8 27 fc ff ff       	call   80324d <_pipeisclosed>
+  803626:	83 c4 10             	add    $0x10,%esp
+}
+  803629:	c9                   	leave
+  80362a:	c3                   	ret
+
+0080362b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80362b:	55                   	push   %ebp
+  80362c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80362e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803631:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803637:	5d                   	pop    %ebp
+  803638:	c3                   	ret
+
+00803639 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803639:	55                   	push   %ebp
+  80363a:	89 e5                	mov    %esp,%ebp
+  80363c:	56                   	push   %esi
+  80363d:	53                   	push   %ebx
+  80363e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803641:	ba 00 00 00 00       	mov    $0x0,%edx
+  803646:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80364b:	89 d0                	mov    %edx,%eax
+  80364d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803651:	85 c0                	test   %eax,%eax
+  803653:	74 2d                	je     803682 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803655:	83 f8 02             	cmp    $0x2,%eax
+  803658:	74 08                	je     803662 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80365a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80365f:	f0 87 03             	lock xchg %eax,(%ebx)
+  803662:	be 02 00 00 00       	mov    $0x2,%esi
+  803667:	eb 15                	jmp    80367e <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803669:	83 ec 04             	sub    $0x4,%esp
+  80366c:	6a 00                	push   $0x0
+  80366e:	6a 02                	push   $0x2
+  803670:	53                   	push   %ebx
+  803671:	e8 29 db ff ff       	call   80119f <sys_futex_wait>
+  803676:	89 f0                	mov    %esi,%eax
+  803678:	f0 87 03             	lock xchg %eax,(%ebx)
+  80367b:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80367e:	85 c0                	test   %eax,%eax
+  803680:	75 e7                	jne    803669 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803682:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803685:	5b                   	pop    %ebx
+  803686:	5e                   	pop    %esi
+  803687:	5d                   	pop    %ebp
+  803688:	c3                   	ret
+
+00803689 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803689:	55                   	push   %ebp
+  80368a:	89 e5                	mov    %esp,%ebp
+  80368c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80368f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803694:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803699:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80369d:	f7 d8                	neg    %eax
+  80369f:	19 c0                	sbb    %eax,%eax
+  8036a1:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8036a4:	5d                   	pop    %ebp
+  8036a5:	c3                   	ret
+
+008036a6 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8036a6:	55                   	push   %ebp
+  8036a7:	89 e5                	mov    %esp,%ebp
+  8036a9:	83 ec 08             	sub    $0x8,%esp
+  8036ac:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8036af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b4:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8036b7:	83 f8 02             	cmp    $0x2,%eax
+  8036ba:	74 02                	je     8036be <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8036bc:	c9                   	leave
+  8036bd:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8036be:	83 ec 08             	sub    $0x8,%esp
+  8036c1:	6a 01                	push   $0x1
+  8036c3:	52                   	push   %edx
+  8036c4:	e8 05 db ff ff       	call   8011ce <sys_futex_wake>
+  8036c9:	83 c4 10             	add    $0x10,%esp
+}
+  8036cc:	eb ee                	jmp    8036bc <mutex_unlock+0x16>
+
+008036ce <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8036ce:	55                   	push   %ebp
+  8036cf:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8036d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8036da:	5d                   	pop    %ebp
+  8036db:	c3                   	ret
+
+008036dc <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	57                   	push   %edi
+  8036e0:	56                   	push   %esi
+  8036e1:	53                   	push   %ebx
+  8036e2:	83 ec 18             	sub    $0x18,%esp
+  8036e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8036eb:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8036ed:	53                   	push   %ebx
+  8036ee:	e8 b3 ff ff ff       	call   8036a6 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8036f3:	83 c4 0c             	add    $0xc,%esp
+  8036f6:	ff 75 10             	push   0x10(%ebp)
+  8036f9:	57                   	push   %edi
+  8036fa:	56                   	push   %esi
+  8036fb:	e8 9f da ff ff       	call   80119f <sys_futex_wait>
+  803700:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803702:	83 c4 10             	add    $0x10,%esp
+  803705:	be 02 00 00 00       	mov    $0x2,%esi
+  80370a:	eb 10                	jmp    80371c <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80370c:	83 ec 04             	sub    $0x4,%esp
+  80370f:	6a 00                	push   $0x0
+  803711:	6a 02                	push   $0x2
+  803713:	53                   	push   %ebx
+  803714:	e8 86 da ff ff       	call   80119f <sys_futex_wait>
+  803719:	83 c4 10             	add    $0x10,%esp
+  80371c:	89 f0                	mov    %esi,%eax
+  80371e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803721:	85 c0                	test   %eax,%eax
+  803723:	75 e7                	jne    80370c <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803725:	83 ff ec             	cmp    $0xffffffec,%edi
+  803728:	74 05                	je     80372f <cond_timedwait+0x53>
+  80372a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80372f:	89 f8                	mov    %edi,%eax
+  803731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803734:	5b                   	pop    %ebx
+  803735:	5e                   	pop    %esi
+  803736:	5f                   	pop    %edi
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
+
+00803739 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80373f:	6a 00                	push   $0x0
+  803741:	ff 75 0c             	push   0xc(%ebp)
+  803744:	ff 75 08             	push   0x8(%ebp)
+  803747:	e8 90 ff ff ff       	call   8036dc <cond_timedwait>
+}
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	c9                   	leave
+  803750:	c3                   	ret
+
+00803751 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803751:	55                   	push   %ebp
+  803752:	89 e5                	mov    %esp,%ebp
+  803754:	83 ec 10             	sub    $0x10,%esp
+  803757:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80375a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80375f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803763:	6a 01                	push   $0x1
+  803765:	50                   	push   %eax
+  803766:	e8 63 da ff ff       	call   8011ce <sys_futex_wake>
+}
+  80376b:	83 c4 10             	add    $0x10,%esp
+  80376e:	c9                   	leave
+  80376f:	c3                   	ret
+
+00803770 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803770:	55                   	push   %ebp
+  803771:	89 e5                	mov    %esp,%ebp
+  803773:	83 ec 10             	sub    $0x10,%esp
+  803776:	8b 45 08             	mov    0x8(%ebp),%eax
+  803779:	ba 01 00 00 00       	mov    $0x1,%edx
+  80377e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803782:	68 00 04 00 00       	push   $0x400
+  803787:	50                   	push   %eax
+  803788:	e8 41 da ff ff       	call   8011ce <sys_futex_wake>
+}
+  80378d:	83 c4 10             	add    $0x10,%esp
+  803790:	c9                   	leave
+  803791:	c3                   	ret
+
+00803792 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803792:	55                   	push   %ebp
+  803793:	89 e5                	mov    %esp,%ebp
+  803795:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803798:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80379b:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80379d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8037a4:	5d                   	pop    %ebp
+  8037a5:	c3                   	ret
+
+008037a6 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8037a6:	55                   	push   %ebp
+  8037a7:	89 e5                	mov    %esp,%ebp
+  8037a9:	53                   	push   %ebx
+  8037aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8037ad:	8b 11                	mov    (%ecx),%edx
+  8037af:	85 d2                	test   %edx,%edx
+  8037b1:	74 14                	je     8037c7 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8037b3:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8037b6:	89 d0                	mov    %edx,%eax
+  8037b8:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8037bc:	39 c2                	cmp    %eax,%edx
+  8037be:	75 ed                	jne    8037ad <sem_trywait+0x7>
+			return 0;
+  8037c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c5:	eb 05                	jmp    8037cc <sem_trywait+0x26>
+	return -E_AGAIN;
+  8037c7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8037cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037cf:	c9                   	leave
+  8037d0:	c3                   	ret
+
+008037d1 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8037d1:	55                   	push   %ebp
+  8037d2:	89 e5                	mov    %esp,%ebp
+  8037d4:	57                   	push   %edi
+  8037d5:	56                   	push   %esi
+  8037d6:	53                   	push   %ebx
+  8037d7:	83 ec 1c             	sub    $0x1c,%esp
+  8037da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8037dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8037e0:	e8 32 d9 ff ff       	call   801117 <sys_time_msec>
+  8037e5:	01 f8                	add    %edi,%eax
+  8037e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8037ea:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8037ef:	eb 28                	jmp    803819 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8037f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037f6:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8037fb:	83 ec 04             	sub    $0x4,%esp
+  8037fe:	56                   	push   %esi
+  8037ff:	6a 00                	push   $0x0
+  803801:	53                   	push   %ebx
+  803802:	e8 98 d9 ff ff       	call   80119f <sys_futex_wait>
+  803807:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80380c:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803811:	83 c4 10             	add    $0x10,%esp
+  803814:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803817:	74 2e                	je     803847 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803819:	83 ec 0c             	sub    $0xc,%esp
+  80381c:	53                   	push   %ebx
+  80381d:	e8 84 ff ff ff       	call   8037a6 <sem_trywait>
+  803822:	83 c4 10             	add    $0x10,%esp
+  803825:	85 c0                	test   %eax,%eax
+  803827:	79 19                	jns    803842 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803829:	85 ff                	test   %edi,%edi
+  80382b:	74 c4                	je     8037f1 <sem_timedwait+0x20>
+  80382d:	e8 e5 d8 ff ff       	call   801117 <sys_time_msec>
+  803832:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803835:	29 c6                	sub    %eax,%esi
+  803837:	85 f6                	test   %esi,%esi
+  803839:	7f b6                	jg     8037f1 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80383b:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803840:	eb 05                	jmp    803847 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803842:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803847:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80384a:	5b                   	pop    %ebx
+  80384b:	5e                   	pop    %esi
+  80384c:	5f                   	pop    %edi
+  80384d:	5d                   	pop    %ebp
+  80384e:	c3                   	ret
+
+0080384f <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80384f:	55                   	push   %ebp
+  803850:	89 e5                	mov    %esp,%ebp
+  803852:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803855:	6a 00                	push   $0x0
+  803857:	ff 75 08             	push   0x8(%ebp)
+  80385a:	e8 72 ff ff ff       	call   8037d1 <sem_timedwait>
+}
+  80385f:	83 c4 10             	add    $0x10,%esp
+  803862:	c9                   	leave
+  803863:	c3                   	ret
+
+00803864 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803864:	55                   	push   %ebp
+  803865:	89 e5                	mov    %esp,%ebp
+  803867:	83 ec 08             	sub    $0x8,%esp
+  80386a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80386d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803872:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803876:	8b 50 04             	mov    0x4(%eax),%edx
+  803879:	85 d2                	test   %edx,%edx
+  80387b:	75 02                	jne    80387f <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80387d:	c9                   	leave
+  80387e:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80387f:	83 ec 08             	sub    $0x8,%esp
+  803882:	6a 01                	push   $0x1
+  803884:	50                   	push   %eax
+  803885:	e8 44 d9 ff ff       	call   8011ce <sys_futex_wake>
+  80388a:	83 c4 10             	add    $0x10,%esp
+}
+  80388d:	eb ee                	jmp    80387d <sem_post+0x19>
+
+0080388f <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80388f:	55                   	push   %ebp
+  803890:	89 e5                	mov    %esp,%ebp
+  803892:	57                   	push   %edi
+  803893:	56                   	push   %esi
+  803894:	53                   	push   %ebx
+  803895:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803898:	68 20 70 80 00       	push   $0x807020
+  80389d:	e8 97 fd ff ff       	call   803639 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8038a2:	a1 44 70 80 00       	mov    0x807044,%eax
+  8038a7:	83 c4 10             	add    $0x10,%esp
+  8038aa:	85 c0                	test   %eax,%eax
+  8038ac:	75 19                	jne    8038c7 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8038ae:	a1 c0 76 80 00       	mov    0x8076c0,%eax
+  8038b3:	8b 00                	mov    (%eax),%eax
+  8038b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8038b8:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8038bd:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  8038c4:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8038c7:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8038cc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038cf:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8038d6:	8b 40 04             	mov    0x4(%eax),%eax
+  8038d9:	85 c0                	test   %eax,%eax
+  8038db:	0f 84 e4 00 00 00    	je     8039c5 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8038e1:	83 c3 01             	add    $0x1,%ebx
+  8038e4:	83 fb 20             	cmp    $0x20,%ebx
+  8038e7:	75 e3                	jne    8038cc <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8038e9:	83 ec 0c             	sub    $0xc,%esp
+  8038ec:	68 20 70 80 00       	push   $0x807020
+  8038f1:	e8 b0 fd ff ff       	call   8036a6 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8038f6:	83 c4 10             	add    $0x10,%esp
+  8038f9:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8038fe:	e9 b8 00 00 00       	jmp    8039bb <pthread_create+0x12c>
+  803903:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803906:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803909:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  80390b:	39 f3                	cmp    %esi,%ebx
+  80390d:	73 16                	jae    803925 <pthread_create+0x96>
+		va -= PGSIZE;
+  80390f:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803915:	83 ec 08             	sub    $0x8,%esp
+  803918:	56                   	push   %esi
+  803919:	6a 00                	push   $0x0
+  80391b:	e8 03 d6 ff ff       	call   800f23 <sys_page_unmap>
+  803920:	83 c4 10             	add    $0x10,%esp
+  803923:	eb e6                	jmp    80390b <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803925:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803928:	83 ec 08             	sub    $0x8,%esp
+  80392b:	ff 75 e4             	push   -0x1c(%ebp)
+  80392e:	6a 00                	push   $0x0
+  803930:	e8 ee d5 ff ff       	call   800f23 <sys_page_unmap>
+	return r;
+  803935:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803938:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80393b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803942:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803949:	eb 70                	jmp    8039bb <pthread_create+0x12c>
+	th->th_fn = fn;
+  80394b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80394e:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803955:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803958:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80395b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80395e:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803961:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803968:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80396d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803970:	29 c8                	sub    %ecx,%eax
+  803972:	85 db                	test   %ebx,%ebx
+  803974:	0f 44 05 c0 76 80 00 	cmove  0x8076c0,%eax
+	*--esp = t;
+  80397b:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80397e:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803985:	83 ec 04             	sub    $0x4,%esp
+  803988:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80398d:	29 ca                	sub    %ecx,%edx
+  80398f:	52                   	push   %edx
+	*--esp = 0;
+  803990:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803993:	50                   	push   %eax
+  803994:	68 ec 3b 80 00       	push   $0x803bec
+  803999:	e8 d5 d8 ff ff       	call   801273 <sys_thread_create>
+  80399e:	89 c7                	mov    %eax,%edi
+  8039a0:	83 c4 10             	add    $0x10,%esp
+  8039a3:	85 c0                	test   %eax,%eax
+  8039a5:	78 91                	js     803938 <pthread_create+0xa9>
+	th->th_env = id;
+  8039a7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039aa:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8039b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b4:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8039b6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8039bb:	89 f8                	mov    %edi,%eax
+  8039bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c0:	5b                   	pop    %ebx
+  8039c1:	5e                   	pop    %esi
+  8039c2:	5f                   	pop    %edi
+  8039c3:	5d                   	pop    %ebp
+  8039c4:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8039c5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039c8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8039cf:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8039d6:	83 ec 0c             	sub    $0xc,%esp
+  8039d9:	68 20 70 80 00       	push   $0x807020
+  8039de:	e8 c3 fc ff ff       	call   8036a6 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8039e3:	89 d9                	mov    %ebx,%ecx
+  8039e5:	c1 e1 10             	shl    $0x10,%ecx
+  8039e8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8039eb:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8039f0:	29 c8                	sub    %ecx,%eax
+  8039f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8039f5:	c1 e8 16             	shr    $0x16,%eax
+  8039f8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	a8 01                	test   $0x1,%al
+  803a04:	74 15                	je     803a1b <pthread_create+0x18c>
+  803a06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a09:	c1 e8 0c             	shr    $0xc,%eax
+  803a0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a13:	a8 01                	test   $0x1,%al
+  803a15:	0f 85 30 ff ff ff    	jne    80394b <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a1b:	83 ec 04             	sub    $0x4,%esp
+  803a1e:	6a 07                	push   $0x7
+  803a20:	ff 75 e4             	push   -0x1c(%ebp)
+  803a23:	6a 00                	push   $0x0
+  803a25:	e8 60 d4 ff ff       	call   800e8a <sys_page_alloc>
+  803a2a:	89 c7                	mov    %eax,%edi
+  803a2c:	83 c4 10             	add    $0x10,%esp
+  803a2f:	85 c0                	test   %eax,%eax
+  803a31:	0f 88 01 ff ff ff    	js     803938 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803a37:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803a3c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803a3f:	29 d0                	sub    %edx,%eax
+  803a41:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803a44:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803a46:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803a4b:	29 d0                	sub    %edx,%eax
+  803a4d:	89 c7                	mov    %eax,%edi
+  803a4f:	39 fe                	cmp    %edi,%esi
+  803a51:	0f 83 f4 fe ff ff    	jae    80394b <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a57:	83 ec 04             	sub    $0x4,%esp
+  803a5a:	6a 07                	push   $0x7
+  803a5c:	56                   	push   %esi
+  803a5d:	6a 00                	push   $0x0
+  803a5f:	e8 26 d4 ff ff       	call   800e8a <sys_page_alloc>
+  803a64:	83 c4 10             	add    $0x10,%esp
+  803a67:	85 c0                	test   %eax,%eax
+  803a69:	0f 88 94 fe ff ff    	js     803903 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803a6f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803a75:	eb d8                	jmp    803a4f <pthread_create+0x1c0>
+
+00803a77 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803a77:	55                   	push   %ebp
+  803a78:	89 e5                	mov    %esp,%ebp
+  803a7a:	57                   	push   %edi
+  803a7b:	56                   	push   %esi
+  803a7c:	53                   	push   %ebx
+  803a7d:	83 ec 0c             	sub    $0xc,%esp
+  803a80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803a83:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803a86:	83 f8 1e             	cmp    $0x1e,%eax
+  803a89:	0f 87 c7 00 00 00    	ja     803b56 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803a8f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a91:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a97:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a9c:	77 12                	ja     803ab0 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a9e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803aa3:	29 d0                	sub    %edx,%eax
+  803aa5:	c1 e8 10             	shr    $0x10,%eax
+  803aa8:	39 c3                	cmp    %eax,%ebx
+  803aaa:	0f 84 ad 00 00 00    	je     803b5d <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ab0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ab3:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803aba:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803ac1:	eb 10                	jmp    803ad3 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ac3:	83 ec 04             	sub    $0x4,%esp
+  803ac6:	6a 00                	push   $0x0
+  803ac8:	6a 01                	push   $0x1
+  803aca:	57                   	push   %edi
+  803acb:	e8 cf d6 ff ff       	call   80119f <sys_futex_wait>
+  803ad0:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ad3:	8b 46 04             	mov    0x4(%esi),%eax
+  803ad6:	83 f8 01             	cmp    $0x1,%eax
+  803ad9:	74 e8                	je     803ac3 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803adb:	83 f8 02             	cmp    $0x2,%eax
+  803ade:	0f 85 80 00 00 00    	jne    803b64 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803ae4:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803ae7:	c1 e6 02             	shl    $0x2,%esi
+  803aea:	eb 05                	jmp    803af1 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803aec:	e8 6d d3 ff ff       	call   800e5e <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803af1:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803af7:	89 ca                	mov    %ecx,%edx
+  803af9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803aff:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b02:	c1 e0 04             	shl    $0x4,%eax
+  803b05:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b0a:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803b0d:	39 c1                	cmp    %eax,%ecx
+  803b0f:	75 12                	jne    803b23 <pthread_join+0xac>
+  803b11:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b14:	c1 e0 04             	shl    $0x4,%eax
+  803b17:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b1c:	8b 40 54             	mov    0x54(%eax),%eax
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	75 c9                	jne    803aec <pthread_join+0x75>
+	if (ret_store)
+  803b23:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b27:	74 0f                	je     803b38 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803b29:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b2c:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803b33:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803b36:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803b38:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b3b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803b42:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803b49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b51:	5b                   	pop    %ebx
+  803b52:	5e                   	pop    %esi
+  803b53:	5f                   	pop    %edi
+  803b54:	5d                   	pop    %ebp
+  803b55:	c3                   	ret
+		return -E_INVAL;
+  803b56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b5b:	eb f1                	jmp    803b4e <pthread_join+0xd7>
+  803b5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b62:	eb ea                	jmp    803b4e <pthread_join+0xd7>
+		return -E_INVAL;
+  803b64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b69:	eb e3                	jmp    803b4e <pthread_join+0xd7>
+
+00803b6b <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803b6b:	55                   	push   %ebp
+  803b6c:	89 e5                	mov    %esp,%ebp
+  803b6e:	53                   	push   %ebx
+  803b6f:	83 ec 04             	sub    $0x4,%esp
+  803b72:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b74:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b7a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b7f:	77 0c                	ja     803b8d <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b81:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b86:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803b88:	c1 e8 10             	shr    $0x10,%eax
+  803b8b:	75 0a                	jne    803b97 <pthread_exit+0x2c>
+		exit();
+  803b8d:	e8 d3 c7 ff ff       	call   800365 <exit>
+  803b92:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803b97:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803b9e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803ba1:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803ba8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bab:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803bae:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803bb5:	83 ec 08             	sub    $0x8,%esp
+  803bb8:	6a 20                	push   $0x20
+  803bba:	01 c2                	add    %eax,%edx
+  803bbc:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803bc3:	50                   	push   %eax
+  803bc4:	e8 05 d6 ff ff       	call   8011ce <sys_futex_wake>
+	sys_env_destroy(0);
+  803bc9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803bd0:	e8 12 d2 ff ff       	call   800de7 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803bd5:	83 c4 0c             	add    $0xc,%esp
+  803bd8:	68 a6 50 80 00       	push   $0x8050a6
+  803bdd:	68 a5 00 00 00       	push   $0xa5
+  803be2:	68 c0 50 80 00       	push   $0x8050c0
+  803be7:	e8 a1 c7 ff ff       	call   80038d <_panic>
+
+00803bec <pthread_start>:
+{
+  803bec:	55                   	push   %ebp
+  803bed:	89 e5                	mov    %esp,%ebp
+  803bef:	53                   	push   %ebx
+  803bf0:	83 ec 04             	sub    $0x4,%esp
+  803bf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803bf6:	e8 37 d2 ff ff       	call   800e32 <sys_getenvid>
+  803bfb:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803c00:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	if (t == 0)
+  803c06:	85 db                	test   %ebx,%ebx
+  803c08:	74 0c                	je     803c16 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c0a:	89 d9                	mov    %ebx,%ecx
+  803c0c:	c1 e1 10             	shl    $0x10,%ecx
+  803c0f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803c14:	29 ca                	sub    %ecx,%edx
+  803c16:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803c19:	c1 e0 04             	shl    $0x4,%eax
+  803c1c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c21:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803c23:	83 ec 0c             	sub    $0xc,%esp
+  803c26:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c2d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803c30:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803c37:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803c3e:	89 04 24             	mov    %eax,(%esp)
+  803c41:	e8 25 ff ff ff       	call   803b6b <pthread_exit>
+
+00803c46 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803c46:	55                   	push   %ebp
+  803c47:	89 e5                	mov    %esp,%ebp
+  803c49:	57                   	push   %edi
+  803c4a:	56                   	push   %esi
+  803c4b:	53                   	push   %ebx
+  803c4c:	83 ec 1c             	sub    $0x1c,%esp
+  803c4f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c51:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803c57:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c5e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803c63:	77 0d                	ja     803c72 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c65:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803c6a:	29 d0                	sub    %edx,%eax
+  803c6c:	c1 e8 10             	shr    $0x10,%eax
+  803c6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803c72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c77:	eb 2f                	jmp    803ca8 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803c79:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803c7f:	8b 01                	mov    (%ecx),%eax
+  803c81:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803c84:	39 c2                	cmp    %eax,%edx
+  803c86:	75 14                	jne    803c9c <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803c88:	83 ec 0c             	sub    $0xc,%esp
+  803c8b:	57                   	push   %edi
+  803c8c:	e8 56 d1 ff ff       	call   800de7 <sys_env_destroy>
+  803c91:	83 c4 10             	add    $0x10,%esp
+  803c94:	85 c0                	test   %eax,%eax
+  803c96:	0f 88 97 00 00 00    	js     803d33 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803c9c:	83 c3 01             	add    $0x1,%ebx
+  803c9f:	83 fb 20             	cmp    $0x20,%ebx
+  803ca2:	0f 84 d2 00 00 00    	je     803d7a <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803ca8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803cab:	74 ef                	je     803c9c <pthread_kill_others+0x56>
+  803cad:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cb0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803cb7:	8b 40 04             	mov    0x4(%eax),%eax
+  803cba:	83 f8 01             	cmp    $0x1,%eax
+  803cbd:	75 dd                	jne    803c9c <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803cbf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cc2:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803cc9:	89 fe                	mov    %edi,%esi
+  803ccb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803cd1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803cd4:	c1 e0 04             	shl    $0x4,%eax
+  803cd7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803cdc:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803cdf:	39 c7                	cmp    %eax,%edi
+  803ce1:	75 b9                	jne    803c9c <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803ce3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803ce6:	c1 e0 04             	shl    $0x4,%eax
+  803ce9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803cee:	8b 40 54             	mov    0x54(%eax),%eax
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	74 a7                	je     803c9c <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803cf5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803cf8:	c1 e0 04             	shl    $0x4,%eax
+  803cfb:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803d01:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d03:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803d09:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d0e:	0f 87 65 ff ff ff    	ja     803c79 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d14:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d19:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803d1b:	c1 e8 10             	shr    $0x10,%eax
+  803d1e:	0f 84 55 ff ff ff    	je     803c79 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803d24:	c1 e0 10             	shl    $0x10,%eax
+  803d27:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803d2c:	29 c1                	sub    %eax,%ecx
+  803d2e:	e9 4c ff ff ff       	jmp    803c7f <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803d33:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803d36:	c1 e2 04             	shl    $0x4,%edx
+  803d39:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d3f:	8b 52 48             	mov    0x48(%edx),%edx
+  803d42:	39 fa                	cmp    %edi,%edx
+  803d44:	0f 85 52 ff ff ff    	jne    803c9c <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803d4a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803d4d:	c1 e2 04             	shl    $0x4,%edx
+  803d50:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d56:	8b 52 54             	mov    0x54(%edx),%edx
+  803d59:	85 d2                	test   %edx,%edx
+  803d5b:	0f 84 3b ff ff ff    	je     803c9c <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803d61:	83 ec 0c             	sub    $0xc,%esp
+  803d64:	50                   	push   %eax
+  803d65:	57                   	push   %edi
+  803d66:	68 d0 50 80 00       	push   $0x8050d0
+  803d6b:	68 bb 00 00 00       	push   $0xbb
+  803d70:	68 c0 50 80 00       	push   $0x8050c0
+  803d75:	e8 13 c6 ff ff       	call   80038d <_panic>
+	}
+}
+  803d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d7d:	5b                   	pop    %ebx
+  803d7e:	5e                   	pop    %esi
+  803d7f:	5f                   	pop    %edi
+  803d80:	5d                   	pop    %ebp
+  803d81:	c3                   	ret
+
+00803d82 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803d82:	55                   	push   %ebp
+  803d83:	89 e5                	mov    %esp,%ebp
+  803d85:	53                   	push   %ebx
+  803d86:	83 ec 04             	sub    $0x4,%esp
+  803d89:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d8b:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803d91:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803d97:	0f 87 85 00 00 00    	ja     803e22 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d9d:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803da2:	29 c3                	sub    %eax,%ebx
+  803da4:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803da7:	83 ec 04             	sub    $0x4,%esp
+  803daa:	68 80 02 00 00       	push   $0x280
+  803daf:	6a 00                	push   $0x0
+  803db1:	68 40 70 80 00       	push   $0x807040
+  803db6:	e8 e2 cd ff ff       	call   800b9d <memset>
+	threads_mu.m_state = 0;
+  803dbb:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803dc2:	00 00 00 
+	if (self != 0) {
+  803dc5:	83 c4 10             	add    $0x10,%esp
+  803dc8:	85 db                	test   %ebx,%ebx
+  803dca:	74 51                	je     803e1d <pthread_fork_child+0x9b>
+  803dcc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803dce:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803dd4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803dd9:	77 18                	ja     803df3 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ddb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803de0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803de2:	c1 e8 10             	shr    $0x10,%eax
+  803de5:	74 0c                	je     803df3 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803de7:	c1 e0 10             	shl    $0x10,%eax
+  803dea:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803def:	29 c2                	sub    %eax,%edx
+  803df1:	eb 06                	jmp    803df9 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803df3:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803df9:	8b 02                	mov    (%edx),%eax
+  803dfb:	8b 48 48             	mov    0x48(%eax),%ecx
+  803dfe:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803e05:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803e08:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803e0f:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803e16:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803e1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e20:	c9                   	leave
+  803e21:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803e22:	83 ec 04             	sub    $0x4,%esp
+  803e25:	68 80 02 00 00       	push   $0x280
+  803e2a:	6a 00                	push   $0x0
+  803e2c:	68 40 70 80 00       	push   $0x807040
+  803e31:	e8 67 cd ff ff       	call   800b9d <memset>
+	threads_mu.m_state = 0;
+  803e36:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803e3d:	00 00 00 
+  803e40:	83 c4 10             	add    $0x10,%esp
+  803e43:	eb d8                	jmp    803e1d <pthread_fork_child+0x9b>
+
+00803e45 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4a:	c3                   	ret
+
+00803e4b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803e4b:	55                   	push   %ebp
+  803e4c:	89 e5                	mov    %esp,%ebp
+  803e4e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803e51:	68 f5 50 80 00       	push   $0x8050f5
+  803e56:	ff 75 0c             	push   0xc(%ebp)
+  803e59:	e8 ee cb ff ff       	call   800a4c <strcpy>
+	return 0;
+}
+  803e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e63:	c9                   	leave
+  803e64:	c3                   	ret
+
+00803e65 <devcons_write>:
+{
+  803e65:	55                   	push   %ebp
+  803e66:	89 e5                	mov    %esp,%ebp
+  803e68:	57                   	push   %edi
+  803e69:	56                   	push   %esi
+  803e6a:	53                   	push   %ebx
+  803e6b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803e71:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803e76:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803e7c:	eb 2e                	jmp    803eac <devcons_write+0x47>
+		m = n - tot;
+  803e7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803e81:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803e83:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803e88:	39 c3                	cmp    %eax,%ebx
+  803e8a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803e8d:	83 ec 04             	sub    $0x4,%esp
+  803e90:	53                   	push   %ebx
+  803e91:	89 f0                	mov    %esi,%eax
+  803e93:	03 45 0c             	add    0xc(%ebp),%eax
+  803e96:	50                   	push   %eax
+  803e97:	57                   	push   %edi
+  803e98:	e8 35 cd ff ff       	call   800bd2 <memmove>
+		sys_cputs(buf, m);
+  803e9d:	83 c4 08             	add    $0x8,%esp
+  803ea0:	53                   	push   %ebx
+  803ea1:	57                   	push   %edi
+  803ea2:	e8 e9 ce ff ff       	call   800d90 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803ea7:	01 de                	add    %ebx,%esi
+  803ea9:	83 c4 10             	add    $0x10,%esp
+  803eac:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803eaf:	72 cd                	jb     803e7e <devcons_write+0x19>
+}
+  803eb1:	89 f0                	mov    %esi,%eax
+  803eb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803eb6:	5b                   	pop    %ebx
+  803eb7:	5e                   	pop    %esi
+  803eb8:	5f                   	pop    %edi
+  803eb9:	5d                   	pop    %ebp
+  803eba:	c3                   	ret
+
+00803ebb <devcons_read>:
+{
+  803ebb:	55                   	push   %ebp
+  803ebc:	89 e5                	mov    %esp,%ebp
+  803ebe:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803eca:	75 07                	jne    803ed3 <devcons_read+0x18>
+  803ecc:	eb 1f                	jmp    803eed <devcons_read+0x32>
+		sys_yield();
+  803ece:	e8 8b cf ff ff       	call   800e5e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803ed3:	e8 e3 ce ff ff       	call   800dbb <sys_cgetc>
+  803ed8:	85 c0                	test   %eax,%eax
+  803eda:	74 f2                	je     803ece <devcons_read+0x13>
+	if (c < 0)
+  803edc:	78 0f                	js     803eed <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803ede:	83 f8 04             	cmp    $0x4,%eax
+  803ee1:	74 0c                	je     803eef <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ee3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ee6:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ee8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803eed:	c9                   	leave
+  803eee:	c3                   	ret
+		return 0;
+  803eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef4:	eb f7                	jmp    803eed <devcons_read+0x32>
+
+00803ef6 <cputchar>:
+{
+  803ef6:	55                   	push   %ebp
+  803ef7:	89 e5                	mov    %esp,%ebp
+  803ef9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803efc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eff:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803f02:	6a 01                	push   $0x1
+  803f04:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f07:	50                   	push   %eax
+  803f08:	e8 83 ce ff ff       	call   800d90 <sys_cputs>
+}
+  803f0d:	83 c4 10             	add    $0x10,%esp
+  803f10:	c9                   	leave
+  803f11:	c3                   	ret
+
+00803f12 <getchar>:
+{
+  803f12:	55                   	push   %ebp
+  803f13:	89 e5                	mov    %esp,%ebp
+  803f15:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803f18:	6a 01                	push   $0x1
+  803f1a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f1d:	50                   	push   %eax
+  803f1e:	6a 00                	push   $0x0
+  803f20:	e8 63 d8 ff ff       	call   801788 <read>
+	if (r < 0)
+  803f25:	83 c4 10             	add    $0x10,%esp
+  803f28:	85 c0                	test   %eax,%eax
+  803f2a:	78 06                	js     803f32 <getchar+0x20>
+	if (r < 1)
+  803f2c:	74 06                	je     803f34 <getchar+0x22>
+	return c;
+  803f2e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803f32:	c9                   	leave
+  803f33:	c3                   	ret
+		return -E_EOF;
+  803f34:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803f39:	eb f7                	jmp    803f32 <getchar+0x20>
+
+00803f3b <iscons>:
+{
+  803f3b:	55                   	push   %ebp
+  803f3c:	89 e5                	mov    %esp,%ebp
+  803f3e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f44:	50                   	push   %eax
+  803f45:	ff 75 08             	push   0x8(%ebp)
+  803f48:	e8 ab d5 ff ff       	call   8014f8 <fd_lookup>
+  803f4d:	83 c4 10             	add    $0x10,%esp
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	78 11                	js     803f65 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803f54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f57:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803f5d:	39 10                	cmp    %edx,(%eax)
+  803f5f:	0f 94 c0             	sete   %al
+  803f62:	0f b6 c0             	movzbl %al,%eax
+}
+  803f65:	c9                   	leave
+  803f66:	c3                   	ret
+
+00803f67 <opencons>:
+{
+  803f67:	55                   	push   %ebp
+  803f68:	89 e5                	mov    %esp,%ebp
+  803f6a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803f6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f70:	50                   	push   %eax
+  803f71:	e8 2c d5 ff ff       	call   8014a2 <fd_alloc>
+  803f76:	83 c4 10             	add    $0x10,%esp
+  803f79:	85 c0                	test   %eax,%eax
+  803f7b:	78 3a                	js     803fb7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803f7d:	83 ec 04             	sub    $0x4,%esp
+  803f80:	68 07 04 00 00       	push   $0x407
+  803f85:	ff 75 f4             	push   -0xc(%ebp)
+  803f88:	6a 00                	push   $0x0
+  803f8a:	e8 fb ce ff ff       	call   800e8a <sys_page_alloc>
+  803f8f:	83 c4 10             	add    $0x10,%esp
+  803f92:	85 c0                	test   %eax,%eax
+  803f94:	78 21                	js     803fb7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803f96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f99:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803f9f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803fa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fa4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803fab:	83 ec 0c             	sub    $0xc,%esp
+  803fae:	50                   	push   %eax
+  803faf:	e8 c7 d4 ff ff       	call   80147b <fd2num>
+  803fb4:	83 c4 10             	add    $0x10,%esp
+}
+  803fb7:	c9                   	leave
+  803fb8:	c3                   	ret
+
+00803fb9 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803fb9:	55                   	push   %ebp
+  803fba:	89 e5                	mov    %esp,%ebp
+  803fbc:	57                   	push   %edi
+  803fbd:	56                   	push   %esi
+  803fbe:	53                   	push   %ebx
+  803fbf:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803fc2:	89 d6                	mov    %edx,%esi
+  803fc4:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803fc7:	89 cf                	mov    %ecx,%edi
+  803fc9:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803fcc:	89 fa                	mov    %edi,%edx
+  803fce:	80 ce 08             	or     $0x8,%dh
+  803fd1:	f6 c5 08             	test   $0x8,%ch
+  803fd4:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803fd7:	57                   	push   %edi
+  803fd8:	56                   	push   %esi
+  803fd9:	50                   	push   %eax
+  803fda:	56                   	push   %esi
+  803fdb:	6a 00                	push   $0x0
+  803fdd:	e8 f5 ce ff ff       	call   800ed7 <sys_page_map>
+	if (r < 0) {
+  803fe2:	83 c4 20             	add    $0x20,%esp
+  803fe5:	85 c0                	test   %eax,%eax
+  803fe7:	78 27                	js     804010 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803fe9:	83 ec 0c             	sub    $0xc,%esp
+  803fec:	57                   	push   %edi
+  803fed:	56                   	push   %esi
+  803fee:	6a 00                	push   $0x0
+  803ff0:	56                   	push   %esi
+  803ff1:	6a 00                	push   $0x0
+  803ff3:	e8 df ce ff ff       	call   800ed7 <sys_page_map>
+  803ff8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ffa:	83 c4 20             	add    $0x20,%esp
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	78 24                	js     804025 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  804001:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804006:	89 d8                	mov    %ebx,%eax
+  804008:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80400b:	5b                   	pop    %ebx
+  80400c:	5e                   	pop    %esi
+  80400d:	5f                   	pop    %edi
+  80400e:	5d                   	pop    %ebp
+  80400f:	c3                   	ret
+  804010:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804012:	83 ec 08             	sub    $0x8,%esp
+  804015:	50                   	push   %eax
+  804016:	68 04 51 80 00       	push   $0x805104
+  80401b:	e8 48 c4 ff ff       	call   800468 <cprintf>
+		return r;
+  804020:	83 c4 10             	add    $0x10,%esp
+  804023:	eb e1                	jmp    804006 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  804025:	83 ec 08             	sub    $0x8,%esp
+  804028:	50                   	push   %eax
+  804029:	68 34 51 80 00       	push   $0x805134
+  80402e:	e8 35 c4 ff ff       	call   800468 <cprintf>
+		return r;
+  804033:	83 c4 10             	add    $0x10,%esp
+  804036:	eb ce                	jmp    804006 <duppage_cow+0x4d>
+
+00804038 <duppage>:
+{
+  804038:	55                   	push   %ebp
+  804039:	89 e5                	mov    %esp,%ebp
+  80403b:	53                   	push   %ebx
+  80403c:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80403f:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  804042:	51                   	push   %ecx
+  804043:	52                   	push   %edx
+  804044:	50                   	push   %eax
+  804045:	52                   	push   %edx
+  804046:	6a 00                	push   $0x0
+  804048:	e8 8a ce ff ff       	call   800ed7 <sys_page_map>
+	if (r < 0) {
+  80404d:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  804050:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  804055:	85 c0                	test   %eax,%eax
+  804057:	78 07                	js     804060 <duppage+0x28>
+}
+  804059:	89 d8                	mov    %ebx,%eax
+  80405b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80405e:	c9                   	leave
+  80405f:	c3                   	ret
+  804060:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804062:	83 ec 08             	sub    $0x8,%esp
+  804065:	50                   	push   %eax
+  804066:	68 04 51 80 00       	push   $0x805104
+  80406b:	e8 f8 c3 ff ff       	call   800468 <cprintf>
+		return r;
+  804070:	83 c4 10             	add    $0x10,%esp
+  804073:	eb e4                	jmp    804059 <duppage+0x21>
+
+00804075 <cow_copy>:
+{
+  804075:	55                   	push   %ebp
+  804076:	89 e5                	mov    %esp,%ebp
+  804078:	56                   	push   %esi
+  804079:	53                   	push   %ebx
+  80407a:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80407c:	83 ec 04             	sub    $0x4,%esp
+  80407f:	6a 07                	push   $0x7
+  804081:	68 00 f0 7f 00       	push   $0x7ff000
+  804086:	6a 00                	push   $0x0
+  804088:	e8 fd cd ff ff       	call   800e8a <sys_page_alloc>
+	if (r < 0) {
+  80408d:	83 c4 10             	add    $0x10,%esp
+  804090:	85 c0                	test   %eax,%eax
+  804092:	78 58                	js     8040ec <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  804094:	83 ec 04             	sub    $0x4,%esp
+  804097:	68 00 10 00 00       	push   $0x1000
+  80409c:	56                   	push   %esi
+  80409d:	68 00 f0 7f 00       	push   $0x7ff000
+  8040a2:	e8 2b cb ff ff       	call   800bd2 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8040a7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8040ae:	56                   	push   %esi
+  8040af:	6a 00                	push   $0x0
+  8040b1:	68 00 f0 7f 00       	push   $0x7ff000
+  8040b6:	6a 00                	push   $0x0
+  8040b8:	e8 1a ce ff ff       	call   800ed7 <sys_page_map>
+  8040bd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8040bf:	83 c4 20             	add    $0x20,%esp
+  8040c2:	85 c0                	test   %eax,%eax
+  8040c4:	78 3b                	js     804101 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8040c6:	83 ec 08             	sub    $0x8,%esp
+  8040c9:	68 00 f0 7f 00       	push   $0x7ff000
+  8040ce:	6a 00                	push   $0x0
+  8040d0:	e8 4e ce ff ff       	call   800f23 <sys_page_unmap>
+  8040d5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8040d7:	83 c4 10             	add    $0x10,%esp
+  8040da:	85 c0                	test   %eax,%eax
+  8040dc:	78 45                	js     804123 <cow_copy+0xae>
+	return 0;
+  8040de:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8040e3:	89 d8                	mov    %ebx,%eax
+  8040e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040e8:	5b                   	pop    %ebx
+  8040e9:	5e                   	pop    %esi
+  8040ea:	5d                   	pop    %ebp
+  8040eb:	c3                   	ret
+  8040ec:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8040ee:	83 ec 08             	sub    $0x8,%esp
+  8040f1:	50                   	push   %eax
+  8040f2:	68 24 52 80 00       	push   $0x805224
+  8040f7:	e8 6c c3 ff ff       	call   800468 <cprintf>
+		return r;
+  8040fc:	83 c4 10             	add    $0x10,%esp
+  8040ff:	eb e2                	jmp    8040e3 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  804101:	83 ec 08             	sub    $0x8,%esp
+  804104:	50                   	push   %eax
+  804105:	68 40 52 80 00       	push   $0x805240
+  80410a:	e8 59 c3 ff ff       	call   800468 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80410f:	83 c4 08             	add    $0x8,%esp
+  804112:	68 00 f0 7f 00       	push   $0x7ff000
+  804117:	6a 00                	push   $0x0
+  804119:	e8 05 ce ff ff       	call   800f23 <sys_page_unmap>
+		return r;
+  80411e:	83 c4 10             	add    $0x10,%esp
+  804121:	eb c0                	jmp    8040e3 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  804123:	83 ec 08             	sub    $0x8,%esp
+  804126:	50                   	push   %eax
+  804127:	68 5c 51 80 00       	push   $0x80515c
+  80412c:	e8 37 c3 ff ff       	call   800468 <cprintf>
+		return r;
+  804131:	83 c4 10             	add    $0x10,%esp
+  804134:	eb ad                	jmp    8040e3 <cow_copy+0x6e>
+
+00804136 <pgfault>:
+{
+  804136:	55                   	push   %ebp
+  804137:	89 e5                	mov    %esp,%ebp
+  804139:	56                   	push   %esi
+  80413a:	53                   	push   %ebx
+  80413b:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80413e:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  804140:	89 d8                	mov    %ebx,%eax
+  804142:	c1 e8 16             	shr    $0x16,%eax
+  804145:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80414c:	89 de                	mov    %ebx,%esi
+  80414e:	c1 ee 0c             	shr    $0xc,%esi
+  804151:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804158:	a8 07                	test   $0x7,%al
+  80415a:	74 3b                	je     804197 <pgfault+0x61>
+  80415c:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804162:	74 33                	je     804197 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804164:	83 ec 0c             	sub    $0xc,%esp
+  804167:	68 00 f0 bf ee       	push   $0xeebff000
+  80416c:	e8 c8 f4 ff ff       	call   803639 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  804171:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804178:	83 c4 10             	add    $0x10,%esp
+  80417b:	f6 c4 08             	test   $0x8,%ah
+  80417e:	75 30                	jne    8041b0 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804180:	83 ec 0c             	sub    $0xc,%esp
+  804183:	68 00 f0 bf ee       	push   $0xeebff000
+  804188:	e8 19 f5 ff ff       	call   8036a6 <mutex_unlock>
+}
+  80418d:	83 c4 10             	add    $0x10,%esp
+  804190:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804193:	5b                   	pop    %ebx
+  804194:	5e                   	pop    %esi
+  804195:	5d                   	pop    %ebp
+  804196:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804197:	83 ec 08             	sub    $0x8,%esp
+  80419a:	ff 72 28             	push   0x28(%edx)
+  80419d:	51                   	push   %ecx
+  80419e:	50                   	push   %eax
+  80419f:	68 80 51 80 00       	push   $0x805180
+  8041a4:	6a 3f                	push   $0x3f
+  8041a6:	68 5a 52 80 00       	push   $0x80525a
+  8041ab:	e8 dd c1 ff ff       	call   80038d <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8041b0:	89 d8                	mov    %ebx,%eax
+  8041b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8041b7:	e8 b9 fe ff ff       	call   804075 <cow_copy>
+  8041bc:	eb c2                	jmp    804180 <pgfault+0x4a>
+
+008041be <cow_enable>:
+{
+  8041be:	55                   	push   %ebp
+  8041bf:	89 e5                	mov    %esp,%ebp
+  8041c1:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8041c4:	68 36 41 80 00       	push   $0x804136
+  8041c9:	e8 28 06 00 00       	call   8047f6 <set_pgfault_handler>
+}
+  8041ce:	83 c4 10             	add    $0x10,%esp
+  8041d1:	c9                   	leave
+  8041d2:	c3                   	ret
+
+008041d3 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8041d3:	55                   	push   %ebp
+  8041d4:	89 e5                	mov    %esp,%ebp
+  8041d6:	57                   	push   %edi
+  8041d7:	56                   	push   %esi
+  8041d8:	53                   	push   %ebx
+  8041d9:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8041dc:	68 36 41 80 00       	push   $0x804136
+  8041e1:	e8 10 06 00 00       	call   8047f6 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8041e6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8041eb:	cd 30                	int    $0x30
+  8041ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8041f0:	83 c4 10             	add    $0x10,%esp
+  8041f3:	85 c0                	test   %eax,%eax
+  8041f5:	78 4b                	js     804242 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8041f7:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804201:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804204:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804208:	0f 85 16 01 00 00    	jne    804324 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80420e:	e8 1f cc ff ff       	call   800e32 <sys_getenvid>
+  804213:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804218:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80421a:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  804220:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804226:	77 32                	ja     80425a <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804228:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80422d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80422f:	c1 ea 10             	shr    $0x10,%edx
+  804232:	74 26                	je     80425a <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804234:	c1 e2 10             	shl    $0x10,%edx
+  804237:	89 d1                	mov    %edx,%ecx
+  804239:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80423e:	29 ca                	sub    %ecx,%edx
+  804240:	eb 1e                	jmp    804260 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  804242:	83 ec 08             	sub    $0x8,%esp
+  804245:	89 c7                	mov    %eax,%edi
+  804247:	50                   	push   %eax
+  804248:	68 65 52 80 00       	push   $0x805265
+  80424d:	e8 16 c2 ff ff       	call   800468 <cprintf>
+		return eid;
+  804252:	83 c4 10             	add    $0x10,%esp
+  804255:	e9 6c 01 00 00       	jmp    8043c6 <fork+0x1f3>
+		return pthread_main_tls;
+  80425a:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804260:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804263:	c1 e0 04             	shl    $0x4,%eax
+  804266:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80426b:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80426d:	e8 10 fb ff ff       	call   803d82 <pthread_fork_child>
+		return eid;
+  804272:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804275:	e9 4c 01 00 00       	jmp    8043c6 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80427a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804280:	89 da                	mov    %ebx,%edx
+  804282:	89 f8                	mov    %edi,%eax
+  804284:	e8 af fd ff ff       	call   804038 <duppage>
+  804289:	85 c0                	test   %eax,%eax
+  80428b:	79 28                	jns    8042b5 <fork+0xe2>
+  80428d:	89 c7                	mov    %eax,%edi
+  80428f:	e9 32 01 00 00       	jmp    8043c6 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804294:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80429a:	83 f9 05             	cmp    $0x5,%ecx
+  80429d:	75 58                	jne    8042f7 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80429f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8042a4:	89 da                	mov    %ebx,%edx
+  8042a6:	89 f8                	mov    %edi,%eax
+  8042a8:	e8 8b fd ff ff       	call   804038 <duppage>
+  8042ad:	85 c0                	test   %eax,%eax
+  8042af:	0f 88 0f 01 00 00    	js     8043c4 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8042b5:	83 c3 01             	add    $0x1,%ebx
+  8042b8:	39 de                	cmp    %ebx,%esi
+  8042ba:	74 54                	je     804310 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8042bc:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8042c3:	f6 c1 05             	test   $0x5,%cl
+  8042c6:	74 ed                	je     8042b5 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8042c8:	f6 c5 04             	test   $0x4,%ch
+  8042cb:	75 ad                	jne    80427a <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8042cd:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8042d3:	74 bf                	je     804294 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8042d5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8042db:	74 d8                	je     8042b5 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8042dd:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8042e3:	89 da                	mov    %ebx,%edx
+  8042e5:	89 f8                	mov    %edi,%eax
+  8042e7:	e8 cd fc ff ff       	call   803fb9 <duppage_cow>
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	79 c5                	jns    8042b5 <fork+0xe2>
+  8042f0:	89 c7                	mov    %eax,%edi
+  8042f2:	e9 cf 00 00 00       	jmp    8043c6 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8042f7:	68 b0 51 80 00       	push   $0x8051b0
+  8042fc:	68 bd 4f 80 00       	push   $0x804fbd
+  804301:	68 c6 00 00 00       	push   $0xc6
+  804306:	68 5a 52 80 00       	push   $0x80525a
+  80430b:	e8 7d c0 ff ff       	call   80038d <_panic>
+  804310:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804313:	83 c1 01             	add    $0x1,%ecx
+  804316:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80431c:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804322:	74 18                	je     80433c <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804324:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80432b:	a8 07                	test   $0x7,%al
+  80432d:	74 e4                	je     804313 <fork+0x140>
+  80432f:	89 cb                	mov    %ecx,%ebx
+  804331:	c1 e3 0a             	shl    $0xa,%ebx
+  804334:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804337:	e9 7c ff ff ff       	jmp    8042b8 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80433c:	83 ec 04             	sub    $0x4,%esp
+  80433f:	6a 07                	push   $0x7
+  804341:	68 00 f0 bf ee       	push   $0xeebff000
+  804346:	ff 75 e4             	push   -0x1c(%ebp)
+  804349:	e8 3c cb ff ff       	call   800e8a <sys_page_alloc>
+  80434e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804350:	83 c4 10             	add    $0x10,%esp
+  804353:	85 c0                	test   %eax,%eax
+  804355:	78 34                	js     80438b <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804357:	83 ec 08             	sub    $0x8,%esp
+  80435a:	68 34 48 80 00       	push   $0x804834
+  80435f:	ff 75 e4             	push   -0x1c(%ebp)
+  804362:	e8 a0 cc ff ff       	call   801007 <sys_env_set_pgfault_upcall>
+  804367:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804369:	83 c4 10             	add    $0x10,%esp
+  80436c:	85 c0                	test   %eax,%eax
+  80436e:	78 2e                	js     80439e <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804370:	83 ec 08             	sub    $0x8,%esp
+  804373:	6a 02                	push   $0x2
+  804375:	ff 75 e4             	push   -0x1c(%ebp)
+  804378:	e8 f2 cb ff ff       	call   800f6f <sys_env_set_status>
+  80437d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80437f:	83 c4 10             	add    $0x10,%esp
+  804382:	85 c0                	test   %eax,%eax
+  804384:	78 2b                	js     8043b1 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804389:	eb 3b                	jmp    8043c6 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80438b:	83 ec 08             	sub    $0x8,%esp
+  80438e:	50                   	push   %eax
+  80438f:	68 d8 51 80 00       	push   $0x8051d8
+  804394:	e8 cf c0 ff ff       	call   800468 <cprintf>
+		return r;
+  804399:	83 c4 10             	add    $0x10,%esp
+  80439c:	eb 28                	jmp    8043c6 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80439e:	83 ec 08             	sub    $0x8,%esp
+  8043a1:	50                   	push   %eax
+  8043a2:	68 00 52 80 00       	push   $0x805200
+  8043a7:	e8 bc c0 ff ff       	call   800468 <cprintf>
+		return r;
+  8043ac:	83 c4 10             	add    $0x10,%esp
+  8043af:	eb 15                	jmp    8043c6 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8043b1:	83 ec 08             	sub    $0x8,%esp
+  8043b4:	50                   	push   %eax
+  8043b5:	68 75 52 80 00       	push   $0x805275
+  8043ba:	e8 a9 c0 ff ff       	call   800468 <cprintf>
+		return r;
+  8043bf:	83 c4 10             	add    $0x10,%esp
+  8043c2:	eb 02                	jmp    8043c6 <fork+0x1f3>
+  8043c4:	89 c7                	mov    %eax,%edi
+}
+  8043c6:	89 f8                	mov    %edi,%eax
+  8043c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cb:	5b                   	pop    %ebx
+  8043cc:	5e                   	pop    %esi
+  8043cd:	5f                   	pop    %edi
+  8043ce:	5d                   	pop    %ebp
+  8043cf:	c3                   	ret
+
+008043d0 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8043d0:	55                   	push   %ebp
+  8043d1:	89 e5                	mov    %esp,%ebp
+  8043d3:	57                   	push   %edi
+  8043d4:	56                   	push   %esi
+  8043d5:	53                   	push   %ebx
+  8043d6:	83 ec 2c             	sub    $0x2c,%esp
+  8043d9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043db:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8043e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043e6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8043ec:	77 0a                	ja     8043f8 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043ee:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8043f3:	29 c3                	sub    %eax,%ebx
+  8043f5:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8043f8:	83 ec 0c             	sub    $0xc,%esp
+  8043fb:	68 36 41 80 00       	push   $0x804136
+  804400:	e8 f1 03 00 00       	call   8047f6 <set_pgfault_handler>
+  804405:	b8 07 00 00 00       	mov    $0x7,%eax
+  80440a:	cd 30                	int    $0x30
+  80440c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80440f:	83 c4 10             	add    $0x10,%esp
+  804412:	85 c0                	test   %eax,%eax
+  804414:	78 30                	js     804446 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804416:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80441a:	74 42                	je     80445e <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80441c:	c1 e3 10             	shl    $0x10,%ebx
+  80441f:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804424:	29 d8                	sub    %ebx,%eax
+  804426:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804429:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80442e:	29 d8                	sub    %ebx,%eax
+  804430:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804433:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80443d:	89 f7                	mov    %esi,%edi
+  80443f:	89 d6                	mov    %edx,%esi
+  804441:	e9 2c 01 00 00       	jmp    804572 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804446:	83 ec 08             	sub    $0x8,%esp
+  804449:	89 c7                	mov    %eax,%edi
+  80444b:	50                   	push   %eax
+  80444c:	68 65 52 80 00       	push   $0x805265
+  804451:	e8 12 c0 ff ff       	call   800468 <cprintf>
+		return eid;
+  804456:	83 c4 10             	add    $0x10,%esp
+  804459:	e9 d5 00 00 00       	jmp    804533 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80445e:	e8 cf c9 ff ff       	call   800e32 <sys_getenvid>
+  804463:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804468:	89 c2                	mov    %eax,%edx
+  80446a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80446c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804472:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804477:	77 18                	ja     804491 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804479:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80447e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804480:	c1 e8 10             	shr    $0x10,%eax
+  804483:	74 0c                	je     804491 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804485:	c1 e0 10             	shl    $0x10,%eax
+  804488:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80448d:	29 c1                	sub    %eax,%ecx
+  80448f:	eb 06                	jmp    804497 <sfork+0xc7>
+		return pthread_main_tls;
+  804491:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+  804497:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80449a:	c1 e0 04             	shl    $0x4,%eax
+  80449d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044a2:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8044a4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8044a7:	e9 87 00 00 00       	jmp    804533 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8044ac:	f6 c5 04             	test   $0x4,%ch
+  8044af:	74 6c                	je     80451d <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8044b1:	89 ca                	mov    %ecx,%edx
+  8044b3:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8044b9:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8044bf:	74 7c                	je     80453d <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8044c1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8044c7:	89 da                	mov    %ebx,%edx
+  8044c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044cc:	e8 67 fb ff ff       	call   804038 <duppage>
+  8044d1:	85 c0                	test   %eax,%eax
+  8044d3:	0f 88 4f 01 00 00    	js     804628 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8044d9:	83 c3 01             	add    $0x1,%ebx
+  8044dc:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8044df:	74 7a                	je     80455b <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8044e1:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8044e3:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8044ea:	f6 c1 01             	test   $0x1,%cl
+  8044ed:	74 ea                	je     8044d9 <sfork+0x109>
+  8044ef:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8044f5:	74 e2                	je     8044d9 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8044f7:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8044fd:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804500:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804505:	76 a5                	jbe    8044ac <sfork+0xdc>
+  804507:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80450d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804510:	39 fa                	cmp    %edi,%edx
+  804512:	73 9d                	jae    8044b1 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804514:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804517:	39 fa                	cmp    %edi,%edx
+  804519:	72 96                	jb     8044b1 <sfork+0xe1>
+  80451b:	eb 8f                	jmp    8044ac <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80451d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804523:	89 da                	mov    %ebx,%edx
+  804525:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804528:	e8 8c fa ff ff       	call   803fb9 <duppage_cow>
+  80452d:	85 c0                	test   %eax,%eax
+  80452f:	79 a8                	jns    8044d9 <sfork+0x109>
+  804531:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804533:	89 f8                	mov    %edi,%eax
+  804535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804538:	5b                   	pop    %ebx
+  804539:	5e                   	pop    %esi
+  80453a:	5f                   	pop    %edi
+  80453b:	5d                   	pop    %ebp
+  80453c:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80453d:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804542:	e8 2e fb ff ff       	call   804075 <cow_copy>
+  804547:	85 c0                	test   %eax,%eax
+  804549:	0f 88 d2 00 00 00    	js     804621 <sfork+0x251>
+				pte = uvpt[pn];
+  80454f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804556:	e9 66 ff ff ff       	jmp    8044c1 <sfork+0xf1>
+  80455b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80455e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804561:	83 c6 01             	add    $0x1,%esi
+  804564:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80456a:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804570:	74 1b                	je     80458d <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804572:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804579:	a8 01                	test   $0x1,%al
+  80457b:	74 e4                	je     804561 <sfork+0x191>
+  80457d:	89 f3                	mov    %esi,%ebx
+  80457f:	c1 e3 0a             	shl    $0xa,%ebx
+  804582:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804585:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804588:	e9 4f ff ff ff       	jmp    8044dc <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80458d:	83 ec 04             	sub    $0x4,%esp
+  804590:	6a 07                	push   $0x7
+  804592:	68 00 f0 bf ee       	push   $0xeebff000
+  804597:	ff 75 e0             	push   -0x20(%ebp)
+  80459a:	e8 eb c8 ff ff       	call   800e8a <sys_page_alloc>
+  80459f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8045a1:	83 c4 10             	add    $0x10,%esp
+  8045a4:	85 c0                	test   %eax,%eax
+  8045a6:	78 37                	js     8045df <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8045a8:	83 ec 08             	sub    $0x8,%esp
+  8045ab:	68 34 48 80 00       	push   $0x804834
+  8045b0:	ff 75 e0             	push   -0x20(%ebp)
+  8045b3:	e8 4f ca ff ff       	call   801007 <sys_env_set_pgfault_upcall>
+  8045b8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8045ba:	83 c4 10             	add    $0x10,%esp
+  8045bd:	85 c0                	test   %eax,%eax
+  8045bf:	78 34                	js     8045f5 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8045c1:	83 ec 08             	sub    $0x8,%esp
+  8045c4:	6a 02                	push   $0x2
+  8045c6:	ff 75 e0             	push   -0x20(%ebp)
+  8045c9:	e8 a1 c9 ff ff       	call   800f6f <sys_env_set_status>
+  8045ce:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8045d0:	83 c4 10             	add    $0x10,%esp
+  8045d3:	85 c0                	test   %eax,%eax
+  8045d5:	78 34                	js     80460b <sfork+0x23b>
+	return eid;
+  8045d7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8045da:	e9 54 ff ff ff       	jmp    804533 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8045df:	83 ec 08             	sub    $0x8,%esp
+  8045e2:	50                   	push   %eax
+  8045e3:	68 d8 51 80 00       	push   $0x8051d8
+  8045e8:	e8 7b be ff ff       	call   800468 <cprintf>
+		return r;
+  8045ed:	83 c4 10             	add    $0x10,%esp
+  8045f0:	e9 3e ff ff ff       	jmp    804533 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8045f5:	83 ec 08             	sub    $0x8,%esp
+  8045f8:	50                   	push   %eax
+  8045f9:	68 00 52 80 00       	push   $0x805200
+  8045fe:	e8 65 be ff ff       	call   800468 <cprintf>
+		return r;
+  804603:	83 c4 10             	add    $0x10,%esp
+  804606:	e9 28 ff ff ff       	jmp    804533 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80460b:	83 ec 08             	sub    $0x8,%esp
+  80460e:	50                   	push   %eax
+  80460f:	68 75 52 80 00       	push   $0x805275
+  804614:	e8 4f be ff ff       	call   800468 <cprintf>
+		return r;
+  804619:	83 c4 10             	add    $0x10,%esp
+  80461c:	e9 12 ff ff ff       	jmp    804533 <sfork+0x163>
+  804621:	89 c7                	mov    %eax,%edi
+  804623:	e9 0b ff ff ff       	jmp    804533 <sfork+0x163>
+  804628:	89 c7                	mov    %eax,%edi
+  80462a:	e9 04 ff ff ff       	jmp    804533 <sfork+0x163>
+
+0080462f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80462f:	55                   	push   %ebp
+  804630:	89 e5                	mov    %esp,%ebp
+  804632:	57                   	push   %edi
+  804633:	56                   	push   %esi
+  804634:	53                   	push   %ebx
+  804635:	83 ec 18             	sub    $0x18,%esp
+  804638:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80463b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80463e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804641:	85 c0                	test   %eax,%eax
+  804643:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804648:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80464b:	50                   	push   %eax
+  80464c:	e8 2f ca ff ff       	call   801080 <sys_ipc_recv>
+	if (r < 0) {
+  804651:	83 c4 10             	add    $0x10,%esp
+  804654:	85 c0                	test   %eax,%eax
+  804656:	78 2b                	js     804683 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804658:	85 ff                	test   %edi,%edi
+  80465a:	74 55                	je     8046b1 <ipc_recv+0x82>
+  80465c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80465e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804664:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804669:	77 39                	ja     8046a4 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80466b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804670:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804672:	c1 e8 10             	shr    $0x10,%eax
+  804675:	74 2d                	je     8046a4 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804677:	c1 e0 10             	shl    $0x10,%eax
+  80467a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80467f:	29 c2                	sub    %eax,%edx
+  804681:	eb 27                	jmp    8046aa <ipc_recv+0x7b>
+  804683:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804685:	83 ec 08             	sub    $0x8,%esp
+  804688:	50                   	push   %eax
+  804689:	68 93 52 80 00       	push   $0x805293
+  80468e:	e8 d5 bd ff ff       	call   800468 <cprintf>
+		*from_env_store = 0;
+  804693:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804699:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80469f:	83 c4 10             	add    $0x10,%esp
+  8046a2:	eb 77                	jmp    80471b <ipc_recv+0xec>
+		return pthread_main_tls;
+  8046a4:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8046aa:	8b 02                	mov    (%edx),%eax
+  8046ac:	8b 40 78             	mov    0x78(%eax),%eax
+  8046af:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8046b1:	85 f6                	test   %esi,%esi
+  8046b3:	74 34                	je     8046e9 <ipc_recv+0xba>
+  8046b5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046b7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046bd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046c2:	77 18                	ja     8046dc <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046c4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046c9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8046cb:	c1 e8 10             	shr    $0x10,%eax
+  8046ce:	74 0c                	je     8046dc <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8046d0:	c1 e0 10             	shl    $0x10,%eax
+  8046d3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8046d8:	29 c2                	sub    %eax,%edx
+  8046da:	eb 06                	jmp    8046e2 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8046dc:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8046e2:	8b 02                	mov    (%edx),%eax
+  8046e4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8046e7:	89 06                	mov    %eax,(%esi)
+  8046e9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046eb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046f1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046f6:	77 18                	ja     804710 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046f8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046fd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8046ff:	c1 e8 10             	shr    $0x10,%eax
+  804702:	74 0c                	je     804710 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804704:	c1 e0 10             	shl    $0x10,%eax
+  804707:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80470c:	29 c2                	sub    %eax,%edx
+  80470e:	eb 06                	jmp    804716 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804710:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804716:	8b 02                	mov    (%edx),%eax
+  804718:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80471b:	89 d8                	mov    %ebx,%eax
+  80471d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804720:	5b                   	pop    %ebx
+  804721:	5e                   	pop    %esi
+  804722:	5f                   	pop    %edi
+  804723:	5d                   	pop    %ebp
+  804724:	c3                   	ret
+
+00804725 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804725:	55                   	push   %ebp
+  804726:	89 e5                	mov    %esp,%ebp
+  804728:	57                   	push   %edi
+  804729:	56                   	push   %esi
+  80472a:	53                   	push   %ebx
+  80472b:	83 ec 0c             	sub    $0xc,%esp
+  80472e:	8b 75 08             	mov    0x8(%ebp),%esi
+  804731:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804734:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804737:	85 db                	test   %ebx,%ebx
+  804739:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80473e:	0f 44 d8             	cmove  %eax,%ebx
+  804741:	eb 05                	jmp    804748 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804743:	e8 16 c7 ff ff       	call   800e5e <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804748:	57                   	push   %edi
+  804749:	53                   	push   %ebx
+  80474a:	ff 75 0c             	push   0xc(%ebp)
+  80474d:	56                   	push   %esi
+  80474e:	e8 00 c9 ff ff       	call   801053 <sys_ipc_try_send>
+		if (r == 0) {
+  804753:	83 c4 10             	add    $0x10,%esp
+  804756:	85 c0                	test   %eax,%eax
+  804758:	74 19                	je     804773 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80475a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80475d:	74 e4                	je     804743 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80475f:	83 ec 0c             	sub    $0xc,%esp
+  804762:	50                   	push   %eax
+  804763:	57                   	push   %edi
+  804764:	53                   	push   %ebx
+  804765:	56                   	push   %esi
+  804766:	68 ac 52 80 00       	push   $0x8052ac
+  80476b:	e8 f8 bc ff ff       	call   800468 <cprintf>
+			return;
+  804770:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804776:	5b                   	pop    %ebx
+  804777:	5e                   	pop    %esi
+  804778:	5f                   	pop    %edi
+  804779:	5d                   	pop    %ebp
+  80477a:	c3                   	ret
+
+0080477b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80477b:	55                   	push   %ebp
+  80477c:	89 e5                	mov    %esp,%ebp
+  80477e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804781:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804786:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804789:	c1 e0 04             	shl    $0x4,%eax
+  80478c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804791:	8b 40 50             	mov    0x50(%eax),%eax
+  804794:	39 c8                	cmp    %ecx,%eax
+  804796:	74 12                	je     8047aa <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804798:	83 c2 01             	add    $0x1,%edx
+  80479b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8047a1:	75 e3                	jne    804786 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8047a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a8:	eb 0e                	jmp    8047b8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8047aa:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8047ad:	c1 e0 04             	shl    $0x4,%eax
+  8047b0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047b5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8047b8:	5d                   	pop    %ebp
+  8047b9:	c3                   	ret
+
+008047ba <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8047ba:	55                   	push   %ebp
+  8047bb:	89 e5                	mov    %esp,%ebp
+  8047bd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8047c0:	89 c2                	mov    %eax,%edx
+  8047c2:	c1 ea 16             	shr    $0x16,%edx
+  8047c5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8047cc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8047d1:	f6 c1 01             	test   $0x1,%cl
+  8047d4:	74 1c                	je     8047f2 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8047d6:	c1 e8 0c             	shr    $0xc,%eax
+  8047d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8047e0:	a8 01                	test   $0x1,%al
+  8047e2:	74 0e                	je     8047f2 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8047e4:	c1 e8 0c             	shr    $0xc,%eax
+  8047e7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8047ee:	ef 
+  8047ef:	0f b7 d2             	movzwl %dx,%edx
+}
+  8047f2:	89 d0                	mov    %edx,%eax
+  8047f4:	5d                   	pop    %ebp
+  8047f5:	c3                   	ret
+
+008047f6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8047f6:	55                   	push   %ebp
+  8047f7:	89 e5                	mov    %esp,%ebp
+  8047f9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8047fc:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804803:	74 0a                	je     80480f <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804805:	8b 45 08             	mov    0x8(%ebp),%eax
+  804808:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  80480d:	c9                   	leave
+  80480e:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80480f:	83 ec 04             	sub    $0x4,%esp
+  804812:	6a 07                	push   $0x7
+  804814:	68 00 f0 bf ee       	push   $0xeebff000
+  804819:	6a 00                	push   $0x0
+  80481b:	e8 6a c6 ff ff       	call   800e8a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804820:	83 c4 08             	add    $0x8,%esp
+  804823:	68 34 48 80 00       	push   $0x804834
+  804828:	6a 00                	push   $0x0
+  80482a:	e8 d8 c7 ff ff       	call   801007 <sys_env_set_pgfault_upcall>
+  80482f:	83 c4 10             	add    $0x10,%esp
+  804832:	eb d1                	jmp    804805 <set_pgfault_handler+0xf>
+
+00804834 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804834:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804835:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  80483a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80483c:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80483f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804843:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804847:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80484a:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80484e:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804850:	83 c4 08             	add    $0x8,%esp
+	popal
+  804853:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804854:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804857:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804858:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804859:	c3                   	ret
+
+0080485a <udm>:
+  80485a:	57                   	push   %edi
+  80485b:	56                   	push   %esi
+  80485c:	53                   	push   %ebx
+  80485d:	83 ec 20             	sub    $0x20,%esp
+  804860:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804864:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804868:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80486c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804870:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804874:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804878:	89 d1                	mov    %edx,%ecx
+  80487a:	09 c1                	or     %eax,%ecx
+  80487c:	0f 84 91 00 00 00    	je     804913 <udm+0xb9>
+  804882:	b8 00 00 00 00       	mov    $0x0,%eax
+  804887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80488c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804891:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804898:	00 
+  804899:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8048a0:	00 
+  8048a1:	eb 08                	jmp    8048ab <udm+0x51>
+  8048a3:	83 e9 01             	sub    $0x1,%ecx
+  8048a6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8048a9:	74 7c                	je     804927 <udm+0xcd>
+  8048ab:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8048af:	01 c0                	add    %eax,%eax
+  8048b1:	89 c6                	mov    %eax,%esi
+  8048b3:	89 d7                	mov    %edx,%edi
+  8048b5:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8048b9:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8048bd:	0f ad d0             	shrd   %cl,%edx,%eax
+  8048c0:	d3 ea                	shr    %cl,%edx
+  8048c2:	f6 c1 20             	test   $0x20,%cl
+  8048c5:	74 04                	je     8048cb <udm+0x71>
+  8048c7:	89 d0                	mov    %edx,%eax
+  8048c9:	31 d2                	xor    %edx,%edx
+  8048cb:	83 e0 01             	and    $0x1,%eax
+  8048ce:	89 04 24             	mov    %eax,(%esp)
+  8048d1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8048d8:	00 
+  8048d9:	8b 04 24             	mov    (%esp),%eax
+  8048dc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8048e0:	09 f0                	or     %esi,%eax
+  8048e2:	09 fa                	or     %edi,%edx
+  8048e4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8048e8:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8048ec:	39 f0                	cmp    %esi,%eax
+  8048ee:	89 d3                	mov    %edx,%ebx
+  8048f0:	19 fb                	sbb    %edi,%ebx
+  8048f2:	72 af                	jb     8048a3 <udm+0x49>
+  8048f4:	29 f0                	sub    %esi,%eax
+  8048f6:	19 fa                	sbb    %edi,%edx
+  8048f8:	89 cf                	mov    %ecx,%edi
+  8048fa:	c1 ef 05             	shr    $0x5,%edi
+  8048fd:	83 e7 01             	and    $0x1,%edi
+  804900:	89 fe                	mov    %edi,%esi
+  804902:	83 f6 01             	xor    $0x1,%esi
+  804905:	d3 e6                	shl    %cl,%esi
+  804907:	d3 e7                	shl    %cl,%edi
+  804909:	09 74 24 18          	or     %esi,0x18(%esp)
+  80490d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804911:	eb 90                	jmp    8048a3 <udm+0x49>
+  804913:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804917:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80491b:	89 f0                	mov    %esi,%eax
+  80491d:	89 fa                	mov    %edi,%edx
+  80491f:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804923:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804927:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80492b:	89 01                	mov    %eax,(%ecx)
+  80492d:	89 51 04             	mov    %edx,0x4(%ecx)
+  804930:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804934:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804938:	83 c4 20             	add    $0x20,%esp
+  80493b:	5b                   	pop    %ebx
+  80493c:	5e                   	pop    %esi
+  80493d:	5f                   	pop    %edi
+  80493e:	c3                   	ret
+
+0080493f <__udivdi3>:
+  80493f:	83 ec 18             	sub    $0x18,%esp
+  804942:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804946:	50                   	push   %eax
+  804947:	ff 74 24 2c          	push   0x2c(%esp)
+  80494b:	ff 74 24 2c          	push   0x2c(%esp)
+  80494f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804953:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804957:	e8 fe fe ff ff       	call   80485a <udm>
+  80495c:	83 c4 24             	add    $0x24,%esp
+  80495f:	c3                   	ret
+
+00804960 <__umoddi3>:
+  804960:	83 ec 18             	sub    $0x18,%esp
+  804963:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804967:	50                   	push   %eax
+  804968:	ff 74 24 2c          	push   0x2c(%esp)
+  80496c:	ff 74 24 2c          	push   0x2c(%esp)
+  804970:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804974:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804978:	e8 dd fe ff ff       	call   80485a <udm>
+  80497d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804981:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804985:	83 c4 24             	add    $0x24,%esp
+  804988:	c3                   	ret
+
+00804989 <__divdi3>:
+  804989:	56                   	push   %esi
+  80498a:	53                   	push   %ebx
+  80498b:	83 ec 14             	sub    $0x14,%esp
+  80498e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804992:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804996:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80499a:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80499e:	85 d2                	test   %edx,%edx
+  8049a0:	78 18                	js     8049ba <__divdi3+0x31>
+  8049a2:	85 db                	test   %ebx,%ebx
+  8049a4:	78 3e                	js     8049e4 <__divdi3+0x5b>
+  8049a6:	83 ec 04             	sub    $0x4,%esp
+  8049a9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8049ad:	56                   	push   %esi
+  8049ae:	53                   	push   %ebx
+  8049af:	51                   	push   %ecx
+  8049b0:	e8 a5 fe ff ff       	call   80485a <udm>
+  8049b5:	83 c4 10             	add    $0x10,%esp
+  8049b8:	eb 24                	jmp    8049de <__divdi3+0x55>
+  8049ba:	f7 d8                	neg    %eax
+  8049bc:	83 d2 00             	adc    $0x0,%edx
+  8049bf:	f7 da                	neg    %edx
+  8049c1:	85 db                	test   %ebx,%ebx
+  8049c3:	78 3a                	js     8049ff <__divdi3+0x76>
+  8049c5:	83 ec 04             	sub    $0x4,%esp
+  8049c8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8049cc:	56                   	push   %esi
+  8049cd:	53                   	push   %ebx
+  8049ce:	51                   	push   %ecx
+  8049cf:	e8 86 fe ff ff       	call   80485a <udm>
+  8049d4:	83 c4 10             	add    $0x10,%esp
+  8049d7:	f7 d8                	neg    %eax
+  8049d9:	83 d2 00             	adc    $0x0,%edx
+  8049dc:	f7 da                	neg    %edx
+  8049de:	83 c4 14             	add    $0x14,%esp
+  8049e1:	5b                   	pop    %ebx
+  8049e2:	5e                   	pop    %esi
+  8049e3:	c3                   	ret
+  8049e4:	83 ec 04             	sub    $0x4,%esp
+  8049e7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8049eb:	56                   	push   %esi
+  8049ec:	f7 d9                	neg    %ecx
+  8049ee:	83 d3 00             	adc    $0x0,%ebx
+  8049f1:	f7 db                	neg    %ebx
+  8049f3:	53                   	push   %ebx
+  8049f4:	51                   	push   %ecx
+  8049f5:	e8 60 fe ff ff       	call   80485a <udm>
+  8049fa:	83 c4 10             	add    $0x10,%esp
+  8049fd:	eb d8                	jmp    8049d7 <__divdi3+0x4e>
+  8049ff:	83 ec 04             	sub    $0x4,%esp
+  804a02:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a06:	56                   	push   %esi
+  804a07:	f7 d9                	neg    %ecx
+  804a09:	83 d3 00             	adc    $0x0,%ebx
+  804a0c:	f7 db                	neg    %ebx
+  804a0e:	53                   	push   %ebx
+  804a0f:	51                   	push   %ecx
+  804a10:	e8 45 fe ff ff       	call   80485a <udm>
+  804a15:	83 c4 10             	add    $0x10,%esp
+  804a18:	eb c4                	jmp    8049de <__divdi3+0x55>
+
+00804a1a <__moddi3>:
+  804a1a:	55                   	push   %ebp
+  804a1b:	57                   	push   %edi
+  804a1c:	56                   	push   %esi
+  804a1d:	53                   	push   %ebx
+  804a1e:	83 ec 24             	sub    $0x24,%esp
+  804a21:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804a25:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804a29:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804a2d:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804a31:	85 d2                	test   %edx,%edx
+  804a33:	78 3b                	js     804a70 <__moddi3+0x56>
+  804a35:	83 ec 04             	sub    $0x4,%esp
+  804a38:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804a3c:	56                   	push   %esi
+  804a3d:	89 ce                	mov    %ecx,%esi
+  804a3f:	f7 de                	neg    %esi
+  804a41:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804a45:	89 de                	mov    %ebx,%esi
+  804a47:	83 d6 00             	adc    $0x0,%esi
+  804a4a:	f7 de                	neg    %esi
+  804a4c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804a50:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804a54:	0f 48 f1             	cmovs  %ecx,%esi
+  804a57:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804a5c:	53                   	push   %ebx
+  804a5d:	56                   	push   %esi
+  804a5e:	e8 f7 fd ff ff       	call   80485a <udm>
+  804a63:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a67:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a6b:	83 c4 10             	add    $0x10,%esp
+  804a6e:	eb 47                	jmp    804ab7 <__moddi3+0x9d>
+  804a70:	f7 d8                	neg    %eax
+  804a72:	83 d2 00             	adc    $0x0,%edx
+  804a75:	f7 da                	neg    %edx
+  804a77:	83 ec 04             	sub    $0x4,%esp
+  804a7a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804a7e:	56                   	push   %esi
+  804a7f:	89 cf                	mov    %ecx,%edi
+  804a81:	f7 df                	neg    %edi
+  804a83:	89 de                	mov    %ebx,%esi
+  804a85:	83 d6 00             	adc    $0x0,%esi
+  804a88:	f7 de                	neg    %esi
+  804a8a:	0f 49 cf             	cmovns %edi,%ecx
+  804a8d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804a91:	0f 49 de             	cmovns %esi,%ebx
+  804a94:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804a98:	ff 74 24 0c          	push   0xc(%esp)
+  804a9c:	ff 74 24 0c          	push   0xc(%esp)
+  804aa0:	e8 b5 fd ff ff       	call   80485a <udm>
+  804aa5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804aa9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804aad:	f7 d8                	neg    %eax
+  804aaf:	83 d2 00             	adc    $0x0,%edx
+  804ab2:	f7 da                	neg    %edx
+  804ab4:	83 c4 10             	add    $0x10,%esp
+  804ab7:	83 c4 24             	add    $0x24,%esp
+  804aba:	5b                   	pop    %ebx
+  804abb:	5e                   	pop    %esi
+  804abc:	5f                   	pop    %edi
+  804abd:	5d                   	pop    %ebp
+  804abe:	c3                   	ret
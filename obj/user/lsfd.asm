@@ -0,0 +1,10179 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 00 4a 80 00       	push   $0x804a00
+  80003e:	e8 06 02 00 00       	call   800249 <cprintf>
+	exit();
+  800043:	e8 44 01 00 00       	call   80018c <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 a1 10 00 00       	call   80110d <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 b5 10 00 00       	call   80113d <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 14 4a 80 00       	push   $0x804a14
+  8000c2:	e8 82 01 00 00       	call   800249 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 03 17 00 00       	call   8017df <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 14 4a 80 00       	push   $0x804a14
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 d7 1f 00 00       	call   8020db <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	57                   	push   %edi
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+  800117:	83 ec 1c             	sub    $0x1c,%esp
+  80011a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80011d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800120:	e8 ee 0a 00 00       	call   800c13 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800125:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800128:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  80012e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800133:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800135:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800137:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80013d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800142:	77 16                	ja     80015a <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800144:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800149:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80014b:	c1 e8 10             	shr    $0x10,%eax
+  80014e:	74 0a                	je     80015a <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800150:	c1 e0 10             	shl    $0x10,%eax
+  800153:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800158:	29 c2                	sub    %eax,%edx
+  80015a:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80015d:	c1 e0 04             	shl    $0x4,%eax
+  800160:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800165:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800167:	85 db                	test   %ebx,%ebx
+  800169:	7e 07                	jle    800172 <libmain+0x61>
+		binaryname = argv[0];
+  80016b:	8b 06                	mov    (%esi),%eax
+  80016d:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800172:	83 ec 08             	sub    $0x8,%esp
+  800175:	56                   	push   %esi
+  800176:	53                   	push   %ebx
+  800177:	e8 d1 fe ff ff       	call   80004d <umain>
+
+	// exit gracefully
+	exit();
+  80017c:	e8 0b 00 00 00       	call   80018c <exit>
+}
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800187:	5b                   	pop    %ebx
+  800188:	5e                   	pop    %esi
+  800189:	5f                   	pop    %edi
+  80018a:	5d                   	pop    %ebp
+  80018b:	c3                   	ret
+
+0080018c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800192:	6a 00                	push   $0x0
+  800194:	e8 32 23 00 00       	call   8024cb <fflush>
+	pthread_kill_others();
+  800199:	e8 9d 39 00 00       	call   803b3b <pthread_kill_others>
+	close_all();
+  80019e:	e8 b7 12 00 00       	call   80145a <close_all>
+	sys_env_destroy(0);
+  8001a3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001aa:	e8 19 0a 00 00       	call   800bc8 <sys_env_destroy>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	53                   	push   %ebx
+  8001b8:	83 ec 04             	sub    $0x4,%esp
+  8001bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001be:	8b 13                	mov    (%ebx),%edx
+  8001c0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c3:	89 03                	mov    %eax,(%ebx)
+  8001c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001cc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d1:	74 09                	je     8001dc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001da:	c9                   	leave
+  8001db:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001dc:	83 ec 08             	sub    $0x8,%esp
+  8001df:	68 ff 00 00 00       	push   $0xff
+  8001e4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e7:	50                   	push   %eax
+  8001e8:	e8 84 09 00 00       	call   800b71 <sys_cputs>
+		b->idx = 0;
+  8001ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	eb db                	jmp    8001d3 <putch+0x1f>
+
+008001f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800201:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800208:	00 00 00 
+	b.cnt = 0;
+  80020b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800212:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800215:	ff 75 0c             	push   0xc(%ebp)
+  800218:	ff 75 08             	push   0x8(%ebp)
+  80021b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800221:	50                   	push   %eax
+  800222:	68 b4 01 80 00       	push   $0x8001b4
+  800227:	e8 14 01 00 00       	call   800340 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80022c:	83 c4 08             	add    $0x8,%esp
+  80022f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800235:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80023b:	50                   	push   %eax
+  80023c:	e8 30 09 00 00       	call   800b71 <sys_cputs>
+
+	return b.cnt;
+}
+  800241:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800247:	c9                   	leave
+  800248:	c3                   	ret
+
+00800249 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800249:	55                   	push   %ebp
+  80024a:	89 e5                	mov    %esp,%ebp
+  80024c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80024f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800252:	50                   	push   %eax
+  800253:	ff 75 08             	push   0x8(%ebp)
+  800256:	e8 9d ff ff ff       	call   8001f8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80025b:	c9                   	leave
+  80025c:	c3                   	ret
+
+0080025d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80025d:	55                   	push   %ebp
+  80025e:	89 e5                	mov    %esp,%ebp
+  800260:	57                   	push   %edi
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+  800263:	83 ec 1c             	sub    $0x1c,%esp
+  800266:	89 c7                	mov    %eax,%edi
+  800268:	89 d6                	mov    %edx,%esi
+  80026a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800270:	89 d1                	mov    %edx,%ecx
+  800272:	89 c2                	mov    %eax,%edx
+  800274:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800277:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80027a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800280:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800283:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80028a:	39 c2                	cmp    %eax,%edx
+  80028c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80028f:	72 3e                	jb     8002cf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	ff 75 18             	push   0x18(%ebp)
+  800297:	83 eb 01             	sub    $0x1,%ebx
+  80029a:	53                   	push   %ebx
+  80029b:	50                   	push   %eax
+  80029c:	83 ec 08             	sub    $0x8,%esp
+  80029f:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a2:	ff 75 e0             	push   -0x20(%ebp)
+  8002a5:	ff 75 dc             	push   -0x24(%ebp)
+  8002a8:	ff 75 d8             	push   -0x28(%ebp)
+  8002ab:	e8 ca 45 00 00       	call   80487a <__udivdi3>
+  8002b0:	83 c4 18             	add    $0x18,%esp
+  8002b3:	52                   	push   %edx
+  8002b4:	50                   	push   %eax
+  8002b5:	89 f2                	mov    %esi,%edx
+  8002b7:	89 f8                	mov    %edi,%eax
+  8002b9:	e8 9f ff ff ff       	call   80025d <printnum>
+  8002be:	83 c4 20             	add    $0x20,%esp
+  8002c1:	eb 13                	jmp    8002d6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	56                   	push   %esi
+  8002c7:	ff 75 18             	push   0x18(%ebp)
+  8002ca:	ff d7                	call   *%edi
+  8002cc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002cf:	83 eb 01             	sub    $0x1,%ebx
+  8002d2:	85 db                	test   %ebx,%ebx
+  8002d4:	7f ed                	jg     8002c3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d6:	83 ec 08             	sub    $0x8,%esp
+  8002d9:	56                   	push   %esi
+  8002da:	83 ec 04             	sub    $0x4,%esp
+  8002dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8002e0:	ff 75 e0             	push   -0x20(%ebp)
+  8002e3:	ff 75 dc             	push   -0x24(%ebp)
+  8002e6:	ff 75 d8             	push   -0x28(%ebp)
+  8002e9:	e8 ad 45 00 00       	call   80489b <__umoddi3>
+  8002ee:	83 c4 14             	add    $0x14,%esp
+  8002f1:	0f be 80 46 4a 80 00 	movsbl 0x804a46(%eax),%eax
+  8002f8:	50                   	push   %eax
+  8002f9:	ff d7                	call   *%edi
+}
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800301:	5b                   	pop    %ebx
+  800302:	5e                   	pop    %esi
+  800303:	5f                   	pop    %edi
+  800304:	5d                   	pop    %ebp
+  800305:	c3                   	ret
+
+00800306 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80030c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800310:	8b 10                	mov    (%eax),%edx
+  800312:	3b 50 04             	cmp    0x4(%eax),%edx
+  800315:	73 0a                	jae    800321 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800317:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80031a:	89 08                	mov    %ecx,(%eax)
+  80031c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031f:	88 02                	mov    %al,(%edx)
+}
+  800321:	5d                   	pop    %ebp
+  800322:	c3                   	ret
+
+00800323 <printfmt>:
+{
+  800323:	55                   	push   %ebp
+  800324:	89 e5                	mov    %esp,%ebp
+  800326:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800329:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80032c:	50                   	push   %eax
+  80032d:	ff 75 10             	push   0x10(%ebp)
+  800330:	ff 75 0c             	push   0xc(%ebp)
+  800333:	ff 75 08             	push   0x8(%ebp)
+  800336:	e8 05 00 00 00       	call   800340 <vprintfmt>
+}
+  80033b:	83 c4 10             	add    $0x10,%esp
+  80033e:	c9                   	leave
+  80033f:	c3                   	ret
+
+00800340 <vprintfmt>:
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	57                   	push   %edi
+  800344:	56                   	push   %esi
+  800345:	53                   	push   %ebx
+  800346:	83 ec 2c             	sub    $0x2c,%esp
+  800349:	8b 75 08             	mov    0x8(%ebp),%esi
+  80034c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80034f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800352:	eb 0a                	jmp    80035e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800354:	83 ec 08             	sub    $0x8,%esp
+  800357:	53                   	push   %ebx
+  800358:	50                   	push   %eax
+  800359:	ff d6                	call   *%esi
+  80035b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80035e:	83 c7 01             	add    $0x1,%edi
+  800361:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800365:	83 f8 25             	cmp    $0x25,%eax
+  800368:	74 0c                	je     800376 <vprintfmt+0x36>
+			if (ch == '\0')
+  80036a:	85 c0                	test   %eax,%eax
+  80036c:	75 e6                	jne    800354 <vprintfmt+0x14>
+}
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+		padc = ' ';
+  800376:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80037a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800381:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800388:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80038f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800394:	8d 47 01             	lea    0x1(%edi),%eax
+  800397:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80039a:	0f b6 17             	movzbl (%edi),%edx
+  80039d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003a0:	3c 55                	cmp    $0x55,%al
+  8003a2:	0f 87 c5 03 00 00    	ja     80076d <vprintfmt+0x42d>
+  8003a8:	0f b6 c0             	movzbl %al,%eax
+  8003ab:	ff 24 85 c0 4b 80 00 	jmp    *0x804bc0(,%eax,4)
+  8003b2:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8003b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b8:	eb da                	jmp    800394 <vprintfmt+0x54>
+  8003ba:	0f be d2             	movsbl %dl,%edx
+  8003bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003c8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003cb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003cf:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003d2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003d5:	83 f9 09             	cmp    $0x9,%ecx
+  8003d8:	77 55                	ja     80042f <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003da:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003dd:	eb e9                	jmp    8003c8 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e2:	8b 00                	mov    (%eax),%eax
+  8003e4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ed:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003f3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f7:	79 9b                	jns    800394 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003f9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ff:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800406:	eb 8c                	jmp    800394 <vprintfmt+0x54>
+			if (width < 0)
+  800408:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80040b:	85 d2                	test   %edx,%edx
+  80040d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800412:	0f 49 c2             	cmovns %edx,%eax
+  800415:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800418:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80041b:	e9 74 ff ff ff       	jmp    800394 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800420:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800423:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80042a:	e9 65 ff ff ff       	jmp    800394 <vprintfmt+0x54>
+  80042f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800432:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800435:	eb bc                	jmp    8003f3 <vprintfmt+0xb3>
+			lflag++;
+  800437:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80043a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80043d:	e9 52 ff ff ff       	jmp    800394 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800442:	8b 45 14             	mov    0x14(%ebp),%eax
+  800445:	8d 78 04             	lea    0x4(%eax),%edi
+  800448:	83 ec 08             	sub    $0x8,%esp
+  80044b:	53                   	push   %ebx
+  80044c:	ff 30                	push   (%eax)
+  80044e:	ff d6                	call   *%esi
+			break;
+  800450:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800453:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800456:	e9 b1 02 00 00       	jmp    80070c <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80045b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800461:	8b 10                	mov    (%eax),%edx
+  800463:	89 d0                	mov    %edx,%eax
+  800465:	f7 d8                	neg    %eax
+  800467:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80046a:	83 f8 14             	cmp    $0x14,%eax
+  80046d:	7f 23                	jg     800492 <vprintfmt+0x152>
+  80046f:	8b 14 85 20 4d 80 00 	mov    0x804d20(,%eax,4),%edx
+  800476:	85 d2                	test   %edx,%edx
+  800478:	74 18                	je     800492 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80047a:	52                   	push   %edx
+  80047b:	68 8f 4e 80 00       	push   $0x804e8f
+  800480:	53                   	push   %ebx
+  800481:	56                   	push   %esi
+  800482:	e8 9c fe ff ff       	call   800323 <printfmt>
+  800487:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80048d:	e9 7a 02 00 00       	jmp    80070c <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800492:	50                   	push   %eax
+  800493:	68 5e 4a 80 00       	push   $0x804a5e
+  800498:	53                   	push   %ebx
+  800499:	56                   	push   %esi
+  80049a:	e8 84 fe ff ff       	call   800323 <printfmt>
+  80049f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a2:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004a5:	e9 62 02 00 00       	jmp    80070c <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ad:	83 c0 04             	add    $0x4,%eax
+  8004b0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004b8:	85 c9                	test   %ecx,%ecx
+  8004ba:	b8 57 4a 80 00       	mov    $0x804a57,%eax
+  8004bf:	0f 45 c1             	cmovne %ecx,%eax
+  8004c2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c9:	7e 06                	jle    8004d1 <vprintfmt+0x191>
+  8004cb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004cf:	75 0b                	jne    8004dc <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004d4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004d7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004da:	eb 5c                	jmp    800538 <vprintfmt+0x1f8>
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+  8004df:	ff 75 d0             	push   -0x30(%ebp)
+  8004e2:	ff 75 cc             	push   -0x34(%ebp)
+  8004e5:	e8 20 03 00 00       	call   80080a <strnlen>
+  8004ea:	89 c2                	mov    %eax,%edx
+  8004ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ef:	29 d0                	sub    %edx,%eax
+  8004f1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004f4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004fe:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800500:	eb 0e                	jmp    800510 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	53                   	push   %ebx
+  800506:	57                   	push   %edi
+  800507:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80050a:	83 ee 01             	sub    $0x1,%esi
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	85 f6                	test   %esi,%esi
+  800512:	7f ee                	jg     800502 <vprintfmt+0x1c2>
+  800514:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800517:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051a:	85 c0                	test   %eax,%eax
+  80051c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800521:	0f 49 d0             	cmovns %eax,%edx
+  800524:	29 d0                	sub    %edx,%eax
+  800526:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800529:	eb a6                	jmp    8004d1 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	53                   	push   %ebx
+  80052f:	52                   	push   %edx
+  800530:	ff 55 08             	call   *0x8(%ebp)
+  800533:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800536:	89 f1                	mov    %esi,%ecx
+  800538:	8d 71 01             	lea    0x1(%ecx),%esi
+  80053b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80053f:	0f be d0             	movsbl %al,%edx
+  800542:	85 d2                	test   %edx,%edx
+  800544:	74 28                	je     80056e <vprintfmt+0x22e>
+  800546:	85 ff                	test   %edi,%edi
+  800548:	78 05                	js     80054f <vprintfmt+0x20f>
+  80054a:	83 ef 01             	sub    $0x1,%edi
+  80054d:	78 30                	js     80057f <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80054f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800553:	74 d6                	je     80052b <vprintfmt+0x1eb>
+  800555:	0f be c0             	movsbl %al,%eax
+  800558:	83 e8 20             	sub    $0x20,%eax
+  80055b:	83 f8 5e             	cmp    $0x5e,%eax
+  80055e:	76 cb                	jbe    80052b <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	53                   	push   %ebx
+  800564:	6a 3f                	push   $0x3f
+  800566:	ff 55 08             	call   *0x8(%ebp)
+  800569:	83 c4 10             	add    $0x10,%esp
+  80056c:	eb c8                	jmp    800536 <vprintfmt+0x1f6>
+  80056e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800571:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800574:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800577:	01 d0                	add    %edx,%eax
+  800579:	29 c8                	sub    %ecx,%eax
+  80057b:	89 c7                	mov    %eax,%edi
+  80057d:	eb 13                	jmp    800592 <vprintfmt+0x252>
+  80057f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800582:	eb ed                	jmp    800571 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	53                   	push   %ebx
+  800588:	6a 20                	push   $0x20
+  80058a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80058c:	83 ef 01             	sub    $0x1,%edi
+  80058f:	83 c4 10             	add    $0x10,%esp
+  800592:	85 ff                	test   %edi,%edi
+  800594:	7f ee                	jg     800584 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800596:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800599:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059c:	e9 6b 01 00 00       	jmp    80070c <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005a1:	83 f9 01             	cmp    $0x1,%ecx
+  8005a4:	7f 1f                	jg     8005c5 <vprintfmt+0x285>
+	else if (lflag)
+  8005a6:	85 c9                	test   %ecx,%ecx
+  8005a8:	74 67                	je     800611 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 00                	mov    (%eax),%eax
+  8005af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b2:	89 c1                	mov    %eax,%ecx
+  8005b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c3:	eb 17                	jmp    8005dc <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 50 04             	mov    0x4(%eax),%edx
+  8005cb:	8b 00                	mov    (%eax),%eax
+  8005cd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005e7:	85 c9                	test   %ecx,%ecx
+  8005e9:	0f 89 03 01 00 00    	jns    8006f2 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	53                   	push   %ebx
+  8005f3:	6a 2d                	push   $0x2d
+  8005f5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005f7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005fa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005fd:	f7 da                	neg    %edx
+  8005ff:	83 d1 00             	adc    $0x0,%ecx
+  800602:	f7 d9                	neg    %ecx
+  800604:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800607:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80060c:	e9 e1 00 00 00       	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8b 00                	mov    (%eax),%eax
+  800616:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800619:	89 c1                	mov    %eax,%ecx
+  80061b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8d 40 04             	lea    0x4(%eax),%eax
+  800627:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062a:	eb b0                	jmp    8005dc <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80062c:	83 f9 01             	cmp    $0x1,%ecx
+  80062f:	7f 1e                	jg     80064f <vprintfmt+0x30f>
+	else if (lflag)
+  800631:	85 c9                	test   %ecx,%ecx
+  800633:	74 32                	je     800667 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 10                	mov    (%eax),%edx
+  80063a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063f:	8d 40 04             	lea    0x4(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800645:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80064a:	e9 a3 00 00 00       	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	8b 48 04             	mov    0x4(%eax),%ecx
+  800657:	8d 40 08             	lea    0x8(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800662:	e9 8b 00 00 00       	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800677:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80067c:	eb 74                	jmp    8006f2 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80067e:	83 f9 01             	cmp    $0x1,%ecx
+  800681:	7f 1b                	jg     80069e <vprintfmt+0x35e>
+	else if (lflag)
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	74 2c                	je     8006b3 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800691:	8d 40 04             	lea    0x4(%eax),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800697:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80069c:	eb 54                	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80069e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a1:	8b 10                	mov    (%eax),%edx
+  8006a3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ac:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b1:	eb 3f                	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 10                	mov    (%eax),%edx
+  8006b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006c8:	eb 28                	jmp    8006f2 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 30                	push   $0x30
+  8006d0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006d2:	83 c4 08             	add    $0x8,%esp
+  8006d5:	53                   	push   %ebx
+  8006d6:	6a 78                	push   $0x78
+  8006d8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 10                	mov    (%eax),%edx
+  8006df:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006e4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ed:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006f2:	83 ec 0c             	sub    $0xc,%esp
+  8006f5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f9:	50                   	push   %eax
+  8006fa:	ff 75 e0             	push   -0x20(%ebp)
+  8006fd:	57                   	push   %edi
+  8006fe:	51                   	push   %ecx
+  8006ff:	52                   	push   %edx
+  800700:	89 da                	mov    %ebx,%edx
+  800702:	89 f0                	mov    %esi,%eax
+  800704:	e8 54 fb ff ff       	call   80025d <printnum>
+			break;
+  800709:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80070c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80070f:	e9 4a fc ff ff       	jmp    80035e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800714:	83 f9 01             	cmp    $0x1,%ecx
+  800717:	7f 1b                	jg     800734 <vprintfmt+0x3f4>
+	else if (lflag)
+  800719:	85 c9                	test   %ecx,%ecx
+  80071b:	74 2c                	je     800749 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800727:	8d 40 04             	lea    0x4(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800732:	eb be                	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073c:	8d 40 08             	lea    0x8(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800742:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800747:	eb a9                	jmp    8006f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8b 10                	mov    (%eax),%edx
+  80074e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800759:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80075e:	eb 92                	jmp    8006f2 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800760:	83 ec 08             	sub    $0x8,%esp
+  800763:	53                   	push   %ebx
+  800764:	6a 25                	push   $0x25
+  800766:	ff d6                	call   *%esi
+			break;
+  800768:	83 c4 10             	add    $0x10,%esp
+  80076b:	eb 9f                	jmp    80070c <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80076d:	83 ec 08             	sub    $0x8,%esp
+  800770:	53                   	push   %ebx
+  800771:	6a 25                	push   $0x25
+  800773:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800775:	83 c4 10             	add    $0x10,%esp
+  800778:	89 f8                	mov    %edi,%eax
+  80077a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80077e:	74 05                	je     800785 <vprintfmt+0x445>
+  800780:	83 e8 01             	sub    $0x1,%eax
+  800783:	eb f5                	jmp    80077a <vprintfmt+0x43a>
+  800785:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800788:	eb 82                	jmp    80070c <vprintfmt+0x3cc>
+
+0080078a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	83 ec 18             	sub    $0x18,%esp
+  800790:	8b 45 08             	mov    0x8(%ebp),%eax
+  800793:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800796:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800799:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80079d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007a7:	85 c0                	test   %eax,%eax
+  8007a9:	74 26                	je     8007d1 <vsnprintf+0x47>
+  8007ab:	85 d2                	test   %edx,%edx
+  8007ad:	7e 22                	jle    8007d1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007af:	ff 75 14             	push   0x14(%ebp)
+  8007b2:	ff 75 10             	push   0x10(%ebp)
+  8007b5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b8:	50                   	push   %eax
+  8007b9:	68 06 03 80 00       	push   $0x800306
+  8007be:	e8 7d fb ff ff       	call   800340 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007c3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007cc:	83 c4 10             	add    $0x10,%esp
+}
+  8007cf:	c9                   	leave
+  8007d0:	c3                   	ret
+		return -E_INVAL;
+  8007d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d6:	eb f7                	jmp    8007cf <vsnprintf+0x45>
+
+008007d8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d8:	55                   	push   %ebp
+  8007d9:	89 e5                	mov    %esp,%ebp
+  8007db:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007de:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007e1:	50                   	push   %eax
+  8007e2:	ff 75 10             	push   0x10(%ebp)
+  8007e5:	ff 75 0c             	push   0xc(%ebp)
+  8007e8:	ff 75 08             	push   0x8(%ebp)
+  8007eb:	e8 9a ff ff ff       	call   80078a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007f0:	c9                   	leave
+  8007f1:	c3                   	ret
+
+008007f2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fd:	eb 03                	jmp    800802 <strlen+0x10>
+		n++;
+  8007ff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800802:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800806:	75 f7                	jne    8007ff <strlen+0xd>
+	return n;
+}
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800810:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800813:	b8 00 00 00 00       	mov    $0x0,%eax
+  800818:	eb 03                	jmp    80081d <strnlen+0x13>
+		n++;
+  80081a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081d:	39 d0                	cmp    %edx,%eax
+  80081f:	74 08                	je     800829 <strnlen+0x1f>
+  800821:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800825:	75 f3                	jne    80081a <strnlen+0x10>
+  800827:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800829:	89 d0                	mov    %edx,%eax
+  80082b:	5d                   	pop    %ebp
+  80082c:	c3                   	ret
+
+0080082d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	53                   	push   %ebx
+  800831:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800834:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800840:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800843:	83 c0 01             	add    $0x1,%eax
+  800846:	84 d2                	test   %dl,%dl
+  800848:	75 f2                	jne    80083c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80084a:	89 c8                	mov    %ecx,%eax
+  80084c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084f:	c9                   	leave
+  800850:	c3                   	ret
+
+00800851 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	53                   	push   %ebx
+  800855:	83 ec 10             	sub    $0x10,%esp
+  800858:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80085b:	53                   	push   %ebx
+  80085c:	e8 91 ff ff ff       	call   8007f2 <strlen>
+  800861:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800864:	ff 75 0c             	push   0xc(%ebp)
+  800867:	01 d8                	add    %ebx,%eax
+  800869:	50                   	push   %eax
+  80086a:	e8 be ff ff ff       	call   80082d <strcpy>
+	return dst;
+}
+  80086f:	89 d8                	mov    %ebx,%eax
+  800871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800874:	c9                   	leave
+  800875:	c3                   	ret
+
+00800876 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	56                   	push   %esi
+  80087a:	53                   	push   %ebx
+  80087b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800881:	89 f3                	mov    %esi,%ebx
+  800883:	03 5d 10             	add    0x10(%ebp),%ebx
+  800886:	89 f0                	mov    %esi,%eax
+  800888:	eb 0f                	jmp    800899 <strncpy+0x23>
+		*dst++ = *src;
+  80088a:	83 c0 01             	add    $0x1,%eax
+  80088d:	0f b6 0a             	movzbl (%edx),%ecx
+  800890:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800893:	80 f9 01             	cmp    $0x1,%cl
+  800896:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800899:	39 d8                	cmp    %ebx,%eax
+  80089b:	75 ed                	jne    80088a <strncpy+0x14>
+	}
+	return ret;
+}
+  80089d:	89 f0                	mov    %esi,%eax
+  80089f:	5b                   	pop    %ebx
+  8008a0:	5e                   	pop    %esi
+  8008a1:	5d                   	pop    %ebp
+  8008a2:	c3                   	ret
+
+008008a3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	56                   	push   %esi
+  8008a7:	53                   	push   %ebx
+  8008a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ae:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008b1:	89 f0                	mov    %esi,%eax
+  8008b3:	85 d2                	test   %edx,%edx
+  8008b5:	74 21                	je     8008d8 <strlcpy+0x35>
+  8008b7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008bb:	89 f2                	mov    %esi,%edx
+  8008bd:	eb 09                	jmp    8008c8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008bf:	83 c1 01             	add    $0x1,%ecx
+  8008c2:	83 c2 01             	add    $0x1,%edx
+  8008c5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c8:	39 c2                	cmp    %eax,%edx
+  8008ca:	74 09                	je     8008d5 <strlcpy+0x32>
+  8008cc:	0f b6 19             	movzbl (%ecx),%ebx
+  8008cf:	84 db                	test   %bl,%bl
+  8008d1:	75 ec                	jne    8008bf <strlcpy+0x1c>
+  8008d3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008d5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d8:	29 f0                	sub    %esi,%eax
+}
+  8008da:	5b                   	pop    %ebx
+  8008db:	5e                   	pop    %esi
+  8008dc:	5d                   	pop    %ebp
+  8008dd:	c3                   	ret
+
+008008de <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008e7:	eb 06                	jmp    8008ef <strcmp+0x11>
+		p++, q++;
+  8008e9:	83 c1 01             	add    $0x1,%ecx
+  8008ec:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ef:	0f b6 01             	movzbl (%ecx),%eax
+  8008f2:	84 c0                	test   %al,%al
+  8008f4:	74 04                	je     8008fa <strcmp+0x1c>
+  8008f6:	3a 02                	cmp    (%edx),%al
+  8008f8:	74 ef                	je     8008e9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fa:	0f b6 c0             	movzbl %al,%eax
+  8008fd:	0f b6 12             	movzbl (%edx),%edx
+  800900:	29 d0                	sub    %edx,%eax
+}
+  800902:	5d                   	pop    %ebp
+  800903:	c3                   	ret
+
+00800904 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800904:	55                   	push   %ebp
+  800905:	89 e5                	mov    %esp,%ebp
+  800907:	53                   	push   %ebx
+  800908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800911:	eb 09                	jmp    80091c <strncmp+0x18>
+		n--, p++, q++;
+  800913:	83 ea 01             	sub    $0x1,%edx
+  800916:	83 c0 01             	add    $0x1,%eax
+  800919:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	74 18                	je     800938 <strncmp+0x34>
+  800920:	0f b6 18             	movzbl (%eax),%ebx
+  800923:	84 db                	test   %bl,%bl
+  800925:	74 04                	je     80092b <strncmp+0x27>
+  800927:	3a 19                	cmp    (%ecx),%bl
+  800929:	74 e8                	je     800913 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092b:	0f b6 00             	movzbl (%eax),%eax
+  80092e:	0f b6 11             	movzbl (%ecx),%edx
+  800931:	29 d0                	sub    %edx,%eax
+}
+  800933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+		return 0;
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	eb f4                	jmp    800933 <strncmp+0x2f>
+
+0080093f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	8b 45 08             	mov    0x8(%ebp),%eax
+  800945:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800949:	eb 03                	jmp    80094e <strchr+0xf>
+  80094b:	83 c0 01             	add    $0x1,%eax
+  80094e:	0f b6 10             	movzbl (%eax),%edx
+  800951:	84 d2                	test   %dl,%dl
+  800953:	74 06                	je     80095b <strchr+0x1c>
+		if (*s == c)
+  800955:	38 ca                	cmp    %cl,%dl
+  800957:	75 f2                	jne    80094b <strchr+0xc>
+  800959:	eb 05                	jmp    800960 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80095b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	8b 45 08             	mov    0x8(%ebp),%eax
+  800968:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80096f:	38 ca                	cmp    %cl,%dl
+  800971:	74 09                	je     80097c <strfind+0x1a>
+  800973:	84 d2                	test   %dl,%dl
+  800975:	74 05                	je     80097c <strfind+0x1a>
+	for (; *s; s++)
+  800977:	83 c0 01             	add    $0x1,%eax
+  80097a:	eb f0                	jmp    80096c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	57                   	push   %edi
+  800982:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800985:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800988:	85 c9                	test   %ecx,%ecx
+  80098a:	74 20                	je     8009ac <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80098c:	89 f8                	mov    %edi,%eax
+  80098e:	09 c8                	or     %ecx,%eax
+  800990:	a8 03                	test   $0x3,%al
+  800992:	75 12                	jne    8009a6 <memset+0x28>
+		c &= 0xFF;
+  800994:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800998:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80099e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009a1:	fc                   	cld
+  8009a2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a4:	eb 06                	jmp    8009ac <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a9:	fc                   	cld
+  8009aa:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ac:	89 f8                	mov    %edi,%eax
+  8009ae:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009b1:	c9                   	leave
+  8009b2:	c3                   	ret
+
+008009b3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b3:	55                   	push   %ebp
+  8009b4:	89 e5                	mov    %esp,%ebp
+  8009b6:	57                   	push   %edi
+  8009b7:	56                   	push   %esi
+  8009b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009c1:	39 c6                	cmp    %eax,%esi
+  8009c3:	73 32                	jae    8009f7 <memmove+0x44>
+  8009c5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c8:	39 d0                	cmp    %edx,%eax
+  8009ca:	73 2b                	jae    8009f7 <memmove+0x44>
+		s += n;
+		d += n;
+  8009cc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cf:	89 d6                	mov    %edx,%esi
+  8009d1:	09 fe                	or     %edi,%esi
+  8009d3:	09 ce                	or     %ecx,%esi
+  8009d5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009db:	75 0e                	jne    8009eb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009dd:	83 ef 04             	sub    $0x4,%edi
+  8009e0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009e6:	fd                   	std
+  8009e7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e9:	eb 09                	jmp    8009f4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009eb:	83 ef 01             	sub    $0x1,%edi
+  8009ee:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009f1:	fd                   	std
+  8009f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009f4:	fc                   	cld
+  8009f5:	eb 1a                	jmp    800a11 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f7:	89 f2                	mov    %esi,%edx
+  8009f9:	09 c2                	or     %eax,%edx
+  8009fb:	09 ca                	or     %ecx,%edx
+  8009fd:	f6 c2 03             	test   $0x3,%dl
+  800a00:	75 0a                	jne    800a0c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a02:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a05:	89 c7                	mov    %eax,%edi
+  800a07:	fc                   	cld
+  800a08:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0a:	eb 05                	jmp    800a11 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a0c:	89 c7                	mov    %eax,%edi
+  800a0e:	fc                   	cld
+  800a0f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a11:	5e                   	pop    %esi
+  800a12:	5f                   	pop    %edi
+  800a13:	5d                   	pop    %ebp
+  800a14:	c3                   	ret
+
+00800a15 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a1b:	ff 75 10             	push   0x10(%ebp)
+  800a1e:	ff 75 0c             	push   0xc(%ebp)
+  800a21:	ff 75 08             	push   0x8(%ebp)
+  800a24:	e8 8a ff ff ff       	call   8009b3 <memmove>
+}
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	56                   	push   %esi
+  800a2f:	53                   	push   %ebx
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a36:	89 c6                	mov    %eax,%esi
+  800a38:	03 75 10             	add    0x10(%ebp),%esi
+  800a3b:	eb 06                	jmp    800a43 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a3d:	83 c0 01             	add    $0x1,%eax
+  800a40:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a43:	39 f0                	cmp    %esi,%eax
+  800a45:	74 14                	je     800a5b <memcmp+0x30>
+		if (*s1 != *s2)
+  800a47:	0f b6 08             	movzbl (%eax),%ecx
+  800a4a:	0f b6 1a             	movzbl (%edx),%ebx
+  800a4d:	38 d9                	cmp    %bl,%cl
+  800a4f:	74 ec                	je     800a3d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a51:	0f b6 c1             	movzbl %cl,%eax
+  800a54:	0f b6 db             	movzbl %bl,%ebx
+  800a57:	29 d8                	sub    %ebx,%eax
+  800a59:	eb 05                	jmp    800a60 <memcmp+0x35>
+	}
+
+	return 0;
+  800a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a60:	5b                   	pop    %ebx
+  800a61:	5e                   	pop    %esi
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a72:	eb 03                	jmp    800a77 <memfind+0x13>
+  800a74:	83 c0 01             	add    $0x1,%eax
+  800a77:	39 d0                	cmp    %edx,%eax
+  800a79:	73 04                	jae    800a7f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a7b:	38 08                	cmp    %cl,(%eax)
+  800a7d:	75 f5                	jne    800a74 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a7f:	5d                   	pop    %ebp
+  800a80:	c3                   	ret
+
+00800a81 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	57                   	push   %edi
+  800a85:	56                   	push   %esi
+  800a86:	53                   	push   %ebx
+  800a87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a8d:	eb 03                	jmp    800a92 <strtol+0x11>
+		s++;
+  800a8f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a92:	0f b6 02             	movzbl (%edx),%eax
+  800a95:	3c 20                	cmp    $0x20,%al
+  800a97:	74 f6                	je     800a8f <strtol+0xe>
+  800a99:	3c 09                	cmp    $0x9,%al
+  800a9b:	74 f2                	je     800a8f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a9d:	3c 2b                	cmp    $0x2b,%al
+  800a9f:	74 2a                	je     800acb <strtol+0x4a>
+	int neg = 0;
+  800aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aa6:	3c 2d                	cmp    $0x2d,%al
+  800aa8:	74 2b                	je     800ad5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aaa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ab0:	75 0f                	jne    800ac1 <strtol+0x40>
+  800ab2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ab5:	74 28                	je     800adf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab7:	85 db                	test   %ebx,%ebx
+  800ab9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abe:	0f 44 d8             	cmove  %eax,%ebx
+  800ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac9:	eb 46                	jmp    800b11 <strtol+0x90>
+		s++;
+  800acb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ace:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad3:	eb d5                	jmp    800aaa <strtol+0x29>
+		s++, neg = 1;
+  800ad5:	83 c2 01             	add    $0x1,%edx
+  800ad8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800add:	eb cb                	jmp    800aaa <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800adf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ae3:	74 0e                	je     800af3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ae5:	85 db                	test   %ebx,%ebx
+  800ae7:	75 d8                	jne    800ac1 <strtol+0x40>
+		s++, base = 8;
+  800ae9:	83 c2 01             	add    $0x1,%edx
+  800aec:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800af1:	eb ce                	jmp    800ac1 <strtol+0x40>
+		s += 2, base = 16;
+  800af3:	83 c2 02             	add    $0x2,%edx
+  800af6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800afb:	eb c4                	jmp    800ac1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800afd:	0f be c0             	movsbl %al,%eax
+  800b00:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b03:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b06:	7d 3a                	jge    800b42 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b08:	83 c2 01             	add    $0x1,%edx
+  800b0b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b0f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b11:	0f b6 02             	movzbl (%edx),%eax
+  800b14:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b17:	89 f3                	mov    %esi,%ebx
+  800b19:	80 fb 09             	cmp    $0x9,%bl
+  800b1c:	76 df                	jbe    800afd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b1e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b21:	89 f3                	mov    %esi,%ebx
+  800b23:	80 fb 19             	cmp    $0x19,%bl
+  800b26:	77 08                	ja     800b30 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b28:	0f be c0             	movsbl %al,%eax
+  800b2b:	83 e8 57             	sub    $0x57,%eax
+  800b2e:	eb d3                	jmp    800b03 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b30:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b33:	89 f3                	mov    %esi,%ebx
+  800b35:	80 fb 19             	cmp    $0x19,%bl
+  800b38:	77 08                	ja     800b42 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b3a:	0f be c0             	movsbl %al,%eax
+  800b3d:	83 e8 37             	sub    $0x37,%eax
+  800b40:	eb c1                	jmp    800b03 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b42:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b46:	74 05                	je     800b4d <strtol+0xcc>
+		*endptr = (char *) s;
+  800b48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b4b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b4d:	89 c8                	mov    %ecx,%eax
+  800b4f:	f7 d8                	neg    %eax
+  800b51:	85 ff                	test   %edi,%edi
+  800b53:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b56:	89 c8                	mov    %ecx,%eax
+  800b58:	5b                   	pop    %ebx
+  800b59:	5e                   	pop    %esi
+  800b5a:	5f                   	pop    %edi
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+
+00800b5d <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b63:	6a 00                	push   $0x0
+  800b65:	6a 00                	push   $0x0
+  800b67:	ff 75 08             	push   0x8(%ebp)
+  800b6a:	e8 12 ff ff ff       	call   800a81 <strtol>
+}
+  800b6f:	c9                   	leave
+  800b70:	c3                   	ret
+
+00800b71 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	57                   	push   %edi
+  800b75:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b81:	89 c3                	mov    %eax,%ebx
+  800b83:	89 c7                	mov    %eax,%edi
+  800b85:	6a 00                	push   $0x0
+  800b87:	55                   	push   %ebp
+  800b88:	56                   	push   %esi
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	8d 35 93 0b 80 00    	lea    0x800b93,%esi
+  800b91:	0f 34                	sysenter
+
+00800b93 <after_sysenter_label_47>:
+  800b93:	5e                   	pop    %esi
+  800b94:	5d                   	pop    %ebp
+  800b95:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b98:	5b                   	pop    %ebx
+  800b99:	5f                   	pop    %edi
+  800b9a:	5d                   	pop    %ebp
+  800b9b:	c3                   	ret
+
+00800b9c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	57                   	push   %edi
+  800ba0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ba1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bab:	89 d1                	mov    %edx,%ecx
+  800bad:	89 d3                	mov    %edx,%ebx
+  800baf:	89 d7                	mov    %edx,%edi
+  800bb1:	6a 00                	push   $0x0
+  800bb3:	55                   	push   %ebp
+  800bb4:	56                   	push   %esi
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	8d 35 bf 0b 80 00    	lea    0x800bbf,%esi
+  800bbd:	0f 34                	sysenter
+
+00800bbf <after_sysenter_label_128>:
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bc4:	5b                   	pop    %ebx
+  800bc5:	5f                   	pop    %edi
+  800bc6:	5d                   	pop    %ebp
+  800bc7:	c3                   	ret
+
+00800bc8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bc8:	55                   	push   %ebp
+  800bc9:	89 e5                	mov    %esp,%ebp
+  800bcb:	57                   	push   %edi
+  800bcc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bda:	89 cb                	mov    %ecx,%ebx
+  800bdc:	89 cf                	mov    %ecx,%edi
+  800bde:	6a 00                	push   $0x0
+  800be0:	55                   	push   %ebp
+  800be1:	56                   	push   %esi
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	8d 35 ec 0b 80 00    	lea    0x800bec,%esi
+  800bea:	0f 34                	sysenter
+
+00800bec <after_sysenter_label_212>:
+  800bec:	5e                   	pop    %esi
+  800bed:	5d                   	pop    %ebp
+  800bee:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bf1:	85 c0                	test   %eax,%eax
+  800bf3:	7f 07                	jg     800bfc <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5f                   	pop    %edi
+  800bfa:	5d                   	pop    %ebp
+  800bfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bfc:	83 ec 0c             	sub    $0xc,%esp
+  800bff:	50                   	push   %eax
+  800c00:	6a 03                	push   $0x3
+  800c02:	68 b5 4d 80 00       	push   $0x804db5
+  800c07:	6a 54                	push   $0x54
+  800c09:	68 d2 4d 80 00       	push   $0x804dd2
+  800c0e:	e8 9b 32 00 00       	call   803eae <_panic>
+
+00800c13 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c22:	89 d1                	mov    %edx,%ecx
+  800c24:	89 d3                	mov    %edx,%ebx
+  800c26:	89 d7                	mov    %edx,%edi
+  800c28:	6a 00                	push   $0x0
+  800c2a:	55                   	push   %ebp
+  800c2b:	56                   	push   %esi
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	8d 35 36 0c 80 00    	lea    0x800c36,%esi
+  800c34:	0f 34                	sysenter
+
+00800c36 <after_sysenter_label_309>:
+  800c36:	5e                   	pop    %esi
+  800c37:	5d                   	pop    %ebp
+  800c38:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c3b:	5b                   	pop    %ebx
+  800c3c:	5f                   	pop    %edi
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+
+00800c3f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c49:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c4e:	89 d1                	mov    %edx,%ecx
+  800c50:	89 d3                	mov    %edx,%ebx
+  800c52:	89 d7                	mov    %edx,%edi
+  800c54:	6a 00                	push   $0x0
+  800c56:	55                   	push   %ebp
+  800c57:	56                   	push   %esi
+  800c58:	89 e5                	mov    %esp,%ebp
+  800c5a:	8d 35 62 0c 80 00    	lea    0x800c62,%esi
+  800c60:	0f 34                	sysenter
+
+00800c62 <after_sysenter_label_391>:
+  800c62:	5e                   	pop    %esi
+  800c63:	5d                   	pop    %ebp
+  800c64:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c67:	5b                   	pop    %ebx
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+
+00800c6b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	57                   	push   %edi
+  800c6f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c76:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c83:	6a 00                	push   $0x0
+  800c85:	55                   	push   %ebp
+  800c86:	56                   	push   %esi
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	8d 35 91 0c 80 00    	lea    0x800c91,%esi
+  800c8f:	0f 34                	sysenter
+
+00800c91 <after_sysenter_label_479>:
+  800c91:	5e                   	pop    %esi
+  800c92:	5d                   	pop    %ebp
+  800c93:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 07                	jg     800ca1 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  800ca4:	50                   	push   %eax
+  800ca5:	6a 04                	push   $0x4
+  800ca7:	68 b5 4d 80 00       	push   $0x804db5
+  800cac:	6a 54                	push   $0x54
+  800cae:	68 d2 4d 80 00       	push   $0x804dd2
+  800cb3:	e8 f6 31 00 00       	call   803eae <_panic>
+
+00800cb8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	57                   	push   %edi
+  800cbc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cce:	ff 75 18             	push   0x18(%ebp)
+  800cd1:	55                   	push   %ebp
+  800cd2:	56                   	push   %esi
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	8d 35 dd 0c 80 00    	lea    0x800cdd,%esi
+  800cdb:	0f 34                	sysenter
+
+00800cdd <after_sysenter_label_593>:
+  800cdd:	5e                   	pop    %esi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ce2:	85 c0                	test   %eax,%eax
+  800ce4:	7f 07                	jg     800ced <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ce6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5f                   	pop    %edi
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+  800cf0:	50                   	push   %eax
+  800cf1:	6a 05                	push   $0x5
+  800cf3:	68 b5 4d 80 00       	push   $0x804db5
+  800cf8:	6a 54                	push   $0x54
+  800cfa:	68 d2 4d 80 00       	push   $0x804dd2
+  800cff:	e8 aa 31 00 00       	call   803eae <_panic>
+
+00800d04 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	57                   	push   %edi
+  800d08:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d14:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d19:	89 df                	mov    %ebx,%edi
+  800d1b:	6a 00                	push   $0x0
+  800d1d:	55                   	push   %ebp
+  800d1e:	56                   	push   %esi
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	8d 35 29 0d 80 00    	lea    0x800d29,%esi
+  800d27:	0f 34                	sysenter
+
+00800d29 <after_sysenter_label_704>:
+  800d29:	5e                   	pop    %esi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d2e:	85 c0                	test   %eax,%eax
+  800d30:	7f 07                	jg     800d39 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d35:	5b                   	pop    %ebx
+  800d36:	5f                   	pop    %edi
+  800d37:	5d                   	pop    %ebp
+  800d38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+  800d3c:	50                   	push   %eax
+  800d3d:	6a 06                	push   $0x6
+  800d3f:	68 b5 4d 80 00       	push   $0x804db5
+  800d44:	6a 54                	push   $0x54
+  800d46:	68 d2 4d 80 00       	push   $0x804dd2
+  800d4b:	e8 5e 31 00 00       	call   803eae <_panic>
+
+00800d50 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d65:	89 df                	mov    %ebx,%edi
+  800d67:	6a 00                	push   $0x0
+  800d69:	55                   	push   %ebp
+  800d6a:	56                   	push   %esi
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	8d 35 75 0d 80 00    	lea    0x800d75,%esi
+  800d73:	0f 34                	sysenter
+
+00800d75 <after_sysenter_label_808>:
+  800d75:	5e                   	pop    %esi
+  800d76:	5d                   	pop    %ebp
+  800d77:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d7a:	85 c0                	test   %eax,%eax
+  800d7c:	7f 07                	jg     800d85 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d81:	5b                   	pop    %ebx
+  800d82:	5f                   	pop    %edi
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	6a 08                	push   $0x8
+  800d8b:	68 b5 4d 80 00       	push   $0x804db5
+  800d90:	6a 54                	push   $0x54
+  800d92:	68 d2 4d 80 00       	push   $0x804dd2
+  800d97:	e8 12 31 00 00       	call   803eae <_panic>
+
+00800d9c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dac:	b8 09 00 00 00       	mov    $0x9,%eax
+  800db1:	89 df                	mov    %ebx,%edi
+  800db3:	6a 00                	push   $0x0
+  800db5:	55                   	push   %ebp
+  800db6:	56                   	push   %esi
+  800db7:	89 e5                	mov    %esp,%ebp
+  800db9:	8d 35 c1 0d 80 00    	lea    0x800dc1,%esi
+  800dbf:	0f 34                	sysenter
+
+00800dc1 <after_sysenter_label_912>:
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc6:	85 c0                	test   %eax,%eax
+  800dc8:	7f 07                	jg     800dd1 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800dca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd1:	83 ec 0c             	sub    $0xc,%esp
+  800dd4:	50                   	push   %eax
+  800dd5:	6a 09                	push   $0x9
+  800dd7:	68 b5 4d 80 00       	push   $0x804db5
+  800ddc:	6a 54                	push   $0x54
+  800dde:	68 d2 4d 80 00       	push   $0x804dd2
+  800de3:	e8 c6 30 00 00       	call   803eae <_panic>
+
+00800de8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ded:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dfd:	89 df                	mov    %ebx,%edi
+  800dff:	6a 00                	push   $0x0
+  800e01:	55                   	push   %ebp
+  800e02:	56                   	push   %esi
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	8d 35 0d 0e 80 00    	lea    0x800e0d,%esi
+  800e0b:	0f 34                	sysenter
+
+00800e0d <after_sysenter_label_1016>:
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 07                	jg     800e1d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5f                   	pop    %edi
+  800e1b:	5d                   	pop    %ebp
+  800e1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	50                   	push   %eax
+  800e21:	6a 0a                	push   $0xa
+  800e23:	68 b5 4d 80 00       	push   $0x804db5
+  800e28:	6a 54                	push   $0x54
+  800e2a:	68 d2 4d 80 00       	push   $0x804dd2
+  800e2f:	e8 7a 30 00 00       	call   803eae <_panic>
+
+00800e34 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	55                   	push   %ebp
+  800e4d:	56                   	push   %esi
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	8d 35 58 0e 80 00    	lea    0x800e58,%esi
+  800e56:	0f 34                	sysenter
+
+00800e58 <after_sysenter_label_1126>:
+  800e58:	5e                   	pop    %esi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e73:	89 cb                	mov    %ecx,%ebx
+  800e75:	89 cf                	mov    %ecx,%edi
+  800e77:	6a 00                	push   $0x0
+  800e79:	55                   	push   %ebp
+  800e7a:	56                   	push   %esi
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	8d 35 85 0e 80 00    	lea    0x800e85,%esi
+  800e83:	0f 34                	sysenter
+
+00800e85 <after_sysenter_label_1210>:
+  800e85:	5e                   	pop    %esi
+  800e86:	5d                   	pop    %ebp
+  800e87:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	7f 07                	jg     800e95 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e91:	5b                   	pop    %ebx
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 0d                	push   $0xd
+  800e9b:	68 b5 4d 80 00       	push   $0x804db5
+  800ea0:	6a 54                	push   $0x54
+  800ea2:	68 d2 4d 80 00       	push   $0x804dd2
+  800ea7:	e8 02 30 00 00       	call   803eae <_panic>
+
+00800eac <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebc:	b8 42 00 00 00       	mov    $0x42,%eax
+  800ec1:	89 df                	mov    %ebx,%edi
+  800ec3:	6a 00                	push   $0x0
+  800ec5:	55                   	push   %ebp
+  800ec6:	56                   	push   %esi
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	8d 35 d1 0e 80 00    	lea    0x800ed1,%esi
+  800ecf:	0f 34                	sysenter
+
+00800ed1 <after_sysenter_label_1311>:
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ed6:	85 c0                	test   %eax,%eax
+  800ed8:	7f 07                	jg     800ee1 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800edd:	5b                   	pop    %ebx
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 42                	push   $0x42
+  800ee7:	68 b5 4d 80 00       	push   $0x804db5
+  800eec:	6a 54                	push   $0x54
+  800eee:	68 d2 4d 80 00       	push   $0x804dd2
+  800ef3:	e8 b6 2f 00 00       	call   803eae <_panic>
+
+00800ef8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800efd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f02:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f07:	89 d1                	mov    %edx,%ecx
+  800f09:	89 d3                	mov    %edx,%ebx
+  800f0b:	89 d7                	mov    %edx,%edi
+  800f0d:	6a 00                	push   $0x0
+  800f0f:	55                   	push   %ebp
+  800f10:	56                   	push   %esi
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+
+00800f1b <after_sysenter_label_1411>:
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f20:	5b                   	pop    %ebx
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+
+00800f24 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f39:	89 df                	mov    %ebx,%edi
+  800f3b:	6a 00                	push   $0x0
+  800f3d:	55                   	push   %ebp
+  800f3e:	56                   	push   %esi
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	8d 35 49 0f 80 00    	lea    0x800f49,%esi
+  800f47:	0f 34                	sysenter
+
+00800f49 <after_sysenter_label_1497>:
+  800f49:	5e                   	pop    %esi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f67:	89 df                	mov    %ebx,%edi
+  800f69:	6a 00                	push   $0x0
+  800f6b:	55                   	push   %ebp
+  800f6c:	56                   	push   %esi
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	8d 35 77 0f 80 00    	lea    0x800f77,%esi
+  800f75:	0f 34                	sysenter
+
+00800f77 <after_sysenter_label_1583>:
+  800f77:	5e                   	pop    %esi
+  800f78:	5d                   	pop    %ebp
+  800f79:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	57                   	push   %edi
+  800f84:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f90:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f98:	6a 00                	push   $0x0
+  800f9a:	55                   	push   %ebp
+  800f9b:	56                   	push   %esi
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8d 35 a6 0f 80 00    	lea    0x800fa6,%esi
+  800fa4:	0f 34                	sysenter
+
+00800fa6 <after_sysenter_label_1672>:
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800fab:	5b                   	pop    %ebx
+  800fac:	5f                   	pop    %edi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+
+00800faf <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc4:	89 df                	mov    %ebx,%edi
+  800fc6:	6a 00                	push   $0x0
+  800fc8:	55                   	push   %ebp
+  800fc9:	56                   	push   %esi
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	8d 35 d4 0f 80 00    	lea    0x800fd4,%esi
+  800fd2:	0f 34                	sysenter
+
+00800fd4 <after_sysenter_label_1758>:
+  800fd4:	5e                   	pop    %esi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fea:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fef:	89 cb                	mov    %ecx,%ebx
+  800ff1:	89 cf                	mov    %ecx,%edi
+  800ff3:	6a 00                	push   $0x0
+  800ff5:	55                   	push   %ebp
+  800ff6:	56                   	push   %esi
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	8d 35 01 10 80 00    	lea    0x801001,%esi
+  800fff:	0f 34                	sysenter
+
+00801001 <after_sysenter_label_1842>:
+  801001:	5e                   	pop    %esi
+  801002:	5d                   	pop    %ebp
+  801003:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801006:	85 c0                	test   %eax,%eax
+  801008:	7f 07                	jg     801011 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80100a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80100d:	5b                   	pop    %ebx
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	50                   	push   %eax
+  801015:	6a 13                	push   $0x13
+  801017:	68 b5 4d 80 00       	push   $0x804db5
+  80101c:	6a 54                	push   $0x54
+  80101e:	68 d2 4d 80 00       	push   $0x804dd2
+  801023:	e8 86 2e 00 00       	call   803eae <_panic>
+
+00801028 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801032:	b8 14 00 00 00       	mov    $0x14,%eax
+  801037:	89 d1                	mov    %edx,%ecx
+  801039:	89 d3                	mov    %edx,%ebx
+  80103b:	89 d7                	mov    %edx,%edi
+  80103d:	6a 00                	push   $0x0
+  80103f:	55                   	push   %ebp
+  801040:	56                   	push   %esi
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	8d 35 4b 10 80 00    	lea    0x80104b,%esi
+  801049:	0f 34                	sysenter
+
+0080104b <after_sysenter_label_1939>:
+  80104b:	5e                   	pop    %esi
+  80104c:	5d                   	pop    %ebp
+  80104d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5f                   	pop    %edi
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+
+00801054 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	57                   	push   %edi
+  801058:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801064:	bf 00 00 00 00       	mov    $0x0,%edi
+  801069:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106c:	6a 00                	push   $0x0
+  80106e:	55                   	push   %ebp
+  80106f:	56                   	push   %esi
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	8d 35 7a 10 80 00    	lea    0x80107a,%esi
+  801078:	0f 34                	sysenter
+
+0080107a <after_sysenter_label_2028>:
+  80107a:	5e                   	pop    %esi
+  80107b:	5d                   	pop    %ebp
+  80107c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80107f:	5b                   	pop    %ebx
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 16 00 00 00       	mov    $0x16,%eax
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	6a 00                	push   $0x0
+  80109c:	55                   	push   %ebp
+  80109d:	56                   	push   %esi
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	8d 35 a8 10 80 00    	lea    0x8010a8,%esi
+  8010a6:	0f 34                	sysenter
+
+008010a8 <after_sysenter_label_2114>:
+  8010a8:	5e                   	pop    %esi
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8010ad:	5b                   	pop    %ebx
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010c6:	89 df                	mov    %ebx,%edi
+  8010c8:	6a 00                	push   $0x0
+  8010ca:	55                   	push   %ebp
+  8010cb:	56                   	push   %esi
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	8d 35 d6 10 80 00    	lea    0x8010d6,%esi
+  8010d4:	0f 34                	sysenter
+
+008010d6 <after_sysenter_label_2200>:
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5f                   	pop    %edi
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+
+008010df <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f4:	89 df                	mov    %ebx,%edi
+  8010f6:	6a 00                	push   $0x0
+  8010f8:	55                   	push   %ebp
+  8010f9:	56                   	push   %esi
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+
+00801104 <after_sysenter_label_2286>:
+  801104:	5e                   	pop    %esi
+  801105:	5d                   	pop    %ebp
+  801106:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801109:	5b                   	pop    %ebx
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+
+0080110d <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801119:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  80111b:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80111e:	83 3a 01             	cmpl   $0x1,(%edx)
+  801121:	7e 09                	jle    80112c <argstart+0x1f>
+  801123:	ba 23 51 80 00       	mov    $0x805123,%edx
+  801128:	85 c9                	test   %ecx,%ecx
+  80112a:	75 05                	jne    801131 <argstart+0x24>
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801134:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	53                   	push   %ebx
+  801141:	83 ec 04             	sub    $0x4,%esp
+  801144:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801147:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  80114e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801151:	85 c0                	test   %eax,%eax
+  801153:	74 74                	je     8011c9 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801155:	80 38 00             	cmpb   $0x0,(%eax)
+  801158:	75 48                	jne    8011a2 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  80115a:	8b 0b                	mov    (%ebx),%ecx
+  80115c:	83 39 01             	cmpl   $0x1,(%ecx)
+  80115f:	74 5a                	je     8011bb <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801161:	8b 53 04             	mov    0x4(%ebx),%edx
+  801164:	8b 42 04             	mov    0x4(%edx),%eax
+  801167:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80116a:	75 4f                	jne    8011bb <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  80116c:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801170:	74 49                	je     8011bb <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801172:	83 c0 01             	add    $0x1,%eax
+  801175:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801178:	83 ec 04             	sub    $0x4,%esp
+  80117b:	8b 01                	mov    (%ecx),%eax
+  80117d:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801184:	50                   	push   %eax
+  801185:	8d 42 08             	lea    0x8(%edx),%eax
+  801188:	50                   	push   %eax
+  801189:	83 c2 04             	add    $0x4,%edx
+  80118c:	52                   	push   %edx
+  80118d:	e8 21 f8 ff ff       	call   8009b3 <memmove>
+		(*args->argc)--;
+  801192:	8b 03                	mov    (%ebx),%eax
+  801194:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801197:	8b 43 08             	mov    0x8(%ebx),%eax
+  80119a:	83 c4 10             	add    $0x10,%esp
+  80119d:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8011a0:	74 13                	je     8011b5 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  8011a2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011a5:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  8011a8:	83 c0 01             	add    $0x1,%eax
+  8011ab:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  8011ae:	89 d0                	mov    %edx,%eax
+  8011b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8011b5:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8011b9:	75 e7                	jne    8011a2 <argnext+0x65>
+	args->curarg = 0;
+  8011bb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  8011c2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8011c7:	eb e5                	jmp    8011ae <argnext+0x71>
+		return -1;
+  8011c9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8011ce:	eb de                	jmp    8011ae <argnext+0x71>
+
+008011d0 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	53                   	push   %ebx
+  8011d4:	83 ec 04             	sub    $0x4,%esp
+  8011d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8011da:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	74 12                	je     8011f3 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8011e1:	80 38 00             	cmpb   $0x0,(%eax)
+  8011e4:	74 12                	je     8011f8 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  8011e6:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  8011e9:	c7 43 08 23 51 80 00 	movl   $0x805123,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  8011f0:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8011f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011f6:	c9                   	leave
+  8011f7:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8011f8:	8b 13                	mov    (%ebx),%edx
+  8011fa:	83 3a 01             	cmpl   $0x1,(%edx)
+  8011fd:	7f 10                	jg     80120f <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8011ff:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801206:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80120d:	eb e1                	jmp    8011f0 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  80120f:	8b 43 04             	mov    0x4(%ebx),%eax
+  801212:	8b 48 04             	mov    0x4(%eax),%ecx
+  801215:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801218:	83 ec 04             	sub    $0x4,%esp
+  80121b:	8b 12                	mov    (%edx),%edx
+  80121d:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801224:	52                   	push   %edx
+  801225:	8d 50 08             	lea    0x8(%eax),%edx
+  801228:	52                   	push   %edx
+  801229:	83 c0 04             	add    $0x4,%eax
+  80122c:	50                   	push   %eax
+  80122d:	e8 81 f7 ff ff       	call   8009b3 <memmove>
+		(*args->argc)--;
+  801232:	8b 03                	mov    (%ebx),%eax
+  801234:	83 28 01             	subl   $0x1,(%eax)
+  801237:	83 c4 10             	add    $0x10,%esp
+  80123a:	eb b4                	jmp    8011f0 <argnextvalue+0x20>
+
+0080123c <argvalue>:
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	83 ec 08             	sub    $0x8,%esp
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801245:	8b 42 0c             	mov    0xc(%edx),%eax
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	74 02                	je     80124e <argvalue+0x12>
+}
+  80124c:	c9                   	leave
+  80124d:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80124e:	83 ec 0c             	sub    $0xc,%esp
+  801251:	52                   	push   %edx
+  801252:	e8 79 ff ff ff       	call   8011d0 <argnextvalue>
+  801257:	83 c4 10             	add    $0x10,%esp
+  80125a:	eb f0                	jmp    80124c <argvalue+0x10>
+
+0080125c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80125f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801262:	05 00 00 00 30       	add    $0x30000000,%eax
+  801267:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+
+0080126c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80126f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801272:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801277:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80127c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801286:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80128b:	eb 02                	jmp    80128f <fd_alloc+0xc>
+  80128d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80128f:	89 c2                	mov    %eax,%edx
+  801291:	c1 ea 16             	shr    $0x16,%edx
+  801294:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80129b:	f6 c2 01             	test   $0x1,%dl
+  80129e:	74 2b                	je     8012cb <fd_alloc+0x48>
+  8012a0:	89 c2                	mov    %eax,%edx
+  8012a2:	c1 ea 0c             	shr    $0xc,%edx
+  8012a5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012ac:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012b2:	f6 c1 01             	test   $0x1,%cl
+  8012b5:	74 14                	je     8012cb <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012b7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012bd:	75 ce                	jne    80128d <fd_alloc+0xa>
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012c4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012c9:	eb 05                	jmp    8012d0 <fd_alloc+0x4d>
+			return 0;
+  8012cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	89 02                	mov    %eax,(%edx)
+}
+  8012d5:	89 c8                	mov    %ecx,%eax
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+
+008012d9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012df:	83 f8 1f             	cmp    $0x1f,%eax
+  8012e2:	77 30                	ja     801314 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012e4:	c1 e0 0c             	shl    $0xc,%eax
+  8012e7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012ec:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012f2:	f6 c2 01             	test   $0x1,%dl
+  8012f5:	74 24                	je     80131b <fd_lookup+0x42>
+  8012f7:	89 c2                	mov    %eax,%edx
+  8012f9:	c1 ea 0c             	shr    $0xc,%edx
+  8012fc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801303:	f6 c2 01             	test   $0x1,%dl
+  801306:	74 1a                	je     801322 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801308:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80130d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+		return -E_INVAL;
+  801314:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801319:	eb f7                	jmp    801312 <fd_lookup+0x39>
+		return -E_INVAL;
+  80131b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801320:	eb f0                	jmp    801312 <fd_lookup+0x39>
+  801322:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801327:	eb e9                	jmp    801312 <fd_lookup+0x39>
+
+00801329 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	53                   	push   %ebx
+  80132d:	83 ec 04             	sub    $0x4,%esp
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801333:	b8 00 00 00 00       	mov    $0x0,%eax
+  801338:	eb 03                	jmp    80133d <dev_lookup+0x14>
+  80133a:	83 c0 01             	add    $0x1,%eax
+  80133d:	8b 1c 85 5c 4e 80 00 	mov    0x804e5c(,%eax,4),%ebx
+  801344:	85 db                	test   %ebx,%ebx
+  801346:	74 0b                	je     801353 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801348:	39 13                	cmp    %edx,(%ebx)
+  80134a:	75 ee                	jne    80133a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80134c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801351:	eb 49                	jmp    80139c <dev_lookup+0x73>
+  801353:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801355:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80135b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801360:	77 18                	ja     80137a <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801362:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801367:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801369:	c1 e8 10             	shr    $0x10,%eax
+  80136c:	74 0c                	je     80137a <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80136e:	c1 e0 10             	shl    $0x10,%eax
+  801371:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801376:	29 c1                	sub    %eax,%ecx
+  801378:	eb 06                	jmp    801380 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80137a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801380:	8b 01                	mov    (%ecx),%eax
+  801382:	8b 40 48             	mov    0x48(%eax),%eax
+  801385:	83 ec 04             	sub    $0x4,%esp
+  801388:	52                   	push   %edx
+  801389:	50                   	push   %eax
+  80138a:	68 e0 4d 80 00       	push   $0x804de0
+  80138f:	e8 b5 ee ff ff       	call   800249 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801394:	83 c4 10             	add    $0x10,%esp
+  801397:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80139c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80139f:	89 1a                	mov    %ebx,(%edx)
+}
+  8013a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013a4:	c9                   	leave
+  8013a5:	c3                   	ret
+
+008013a6 <fd_close>:
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+  8013ac:	83 ec 24             	sub    $0x24,%esp
+  8013af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013b8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013b9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013bf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013c2:	50                   	push   %eax
+  8013c3:	e8 11 ff ff ff       	call   8012d9 <fd_lookup>
+  8013c8:	89 c3                	mov    %eax,%ebx
+  8013ca:	83 c4 10             	add    $0x10,%esp
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	78 05                	js     8013d6 <fd_close+0x30>
+	    || fd != fd2)
+  8013d1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013d4:	74 16                	je     8013ec <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013d6:	89 f8                	mov    %edi,%eax
+  8013d8:	84 c0                	test   %al,%al
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013df:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013e2:	89 d8                	mov    %ebx,%eax
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013ec:	83 ec 08             	sub    $0x8,%esp
+  8013ef:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013f2:	50                   	push   %eax
+  8013f3:	ff 36                	push   (%esi)
+  8013f5:	e8 2f ff ff ff       	call   801329 <dev_lookup>
+  8013fa:	89 c3                	mov    %eax,%ebx
+  8013fc:	83 c4 10             	add    $0x10,%esp
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	78 1a                	js     80141d <fd_close+0x77>
+		if (dev->dev_close)
+  801403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801406:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	74 0b                	je     80141d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801412:	83 ec 0c             	sub    $0xc,%esp
+  801415:	56                   	push   %esi
+  801416:	ff d0                	call   *%eax
+  801418:	89 c3                	mov    %eax,%ebx
+  80141a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80141d:	83 ec 08             	sub    $0x8,%esp
+  801420:	56                   	push   %esi
+  801421:	6a 00                	push   $0x0
+  801423:	e8 dc f8 ff ff       	call   800d04 <sys_page_unmap>
+	return r;
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	eb b5                	jmp    8013e2 <fd_close+0x3c>
+
+0080142d <close>:
+
+int
+close(int fdnum)
+{
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801433:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801436:	50                   	push   %eax
+  801437:	ff 75 08             	push   0x8(%ebp)
+  80143a:	e8 9a fe ff ff       	call   8012d9 <fd_lookup>
+  80143f:	83 c4 10             	add    $0x10,%esp
+  801442:	85 c0                	test   %eax,%eax
+  801444:	79 02                	jns    801448 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+		return fd_close(fd, 1);
+  801448:	83 ec 08             	sub    $0x8,%esp
+  80144b:	6a 01                	push   $0x1
+  80144d:	ff 75 f4             	push   -0xc(%ebp)
+  801450:	e8 51 ff ff ff       	call   8013a6 <fd_close>
+  801455:	83 c4 10             	add    $0x10,%esp
+  801458:	eb ec                	jmp    801446 <close+0x19>
+
+0080145a <close_all>:
+
+void
+close_all(void)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	53                   	push   %ebx
+  80146a:	e8 be ff ff ff       	call   80142d <close>
+	for (i = 0; i < MAXFD; i++)
+  80146f:	83 c3 01             	add    $0x1,%ebx
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	83 fb 20             	cmp    $0x20,%ebx
+  801478:	75 ec                	jne    801466 <close_all+0xc>
+}
+  80147a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+
+0080147f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	57                   	push   %edi
+  801483:	56                   	push   %esi
+  801484:	53                   	push   %ebx
+  801485:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801488:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80148b:	50                   	push   %eax
+  80148c:	ff 75 08             	push   0x8(%ebp)
+  80148f:	e8 45 fe ff ff       	call   8012d9 <fd_lookup>
+  801494:	89 c3                	mov    %eax,%ebx
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	78 7f                	js     80151c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	ff 75 0c             	push   0xc(%ebp)
+  8014a3:	e8 85 ff ff ff       	call   80142d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014ab:	c1 e6 0c             	shl    $0xc,%esi
+  8014ae:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014b7:	89 3c 24             	mov    %edi,(%esp)
+  8014ba:	e8 ad fd ff ff       	call   80126c <fd2data>
+  8014bf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014c1:	89 34 24             	mov    %esi,(%esp)
+  8014c4:	e8 a3 fd ff ff       	call   80126c <fd2data>
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014cf:	89 d8                	mov    %ebx,%eax
+  8014d1:	c1 e8 16             	shr    $0x16,%eax
+  8014d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014db:	a8 01                	test   $0x1,%al
+  8014dd:	74 11                	je     8014f0 <dup+0x71>
+  8014df:	89 d8                	mov    %ebx,%eax
+  8014e1:	c1 e8 0c             	shr    $0xc,%eax
+  8014e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014eb:	f6 c2 01             	test   $0x1,%dl
+  8014ee:	75 36                	jne    801526 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014f0:	89 f8                	mov    %edi,%eax
+  8014f2:	c1 e8 0c             	shr    $0xc,%eax
+  8014f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014fc:	83 ec 0c             	sub    $0xc,%esp
+  8014ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801504:	50                   	push   %eax
+  801505:	56                   	push   %esi
+  801506:	6a 00                	push   $0x0
+  801508:	57                   	push   %edi
+  801509:	6a 00                	push   $0x0
+  80150b:	e8 a8 f7 ff ff       	call   800cb8 <sys_page_map>
+  801510:	89 c3                	mov    %eax,%ebx
+  801512:	83 c4 20             	add    $0x20,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 33                	js     80154c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80151c:	89 d8                	mov    %ebx,%eax
+  80151e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801521:	5b                   	pop    %ebx
+  801522:	5e                   	pop    %esi
+  801523:	5f                   	pop    %edi
+  801524:	5d                   	pop    %ebp
+  801525:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801526:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	25 07 0e 00 00       	and    $0xe07,%eax
+  801535:	50                   	push   %eax
+  801536:	ff 75 d4             	push   -0x2c(%ebp)
+  801539:	6a 00                	push   $0x0
+  80153b:	53                   	push   %ebx
+  80153c:	6a 00                	push   $0x0
+  80153e:	e8 75 f7 ff ff       	call   800cb8 <sys_page_map>
+  801543:	89 c3                	mov    %eax,%ebx
+  801545:	83 c4 20             	add    $0x20,%esp
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	79 a4                	jns    8014f0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	56                   	push   %esi
+  801550:	6a 00                	push   $0x0
+  801552:	e8 ad f7 ff ff       	call   800d04 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801557:	83 c4 08             	add    $0x8,%esp
+  80155a:	ff 75 d4             	push   -0x2c(%ebp)
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 a0 f7 ff ff       	call   800d04 <sys_page_unmap>
+	return r;
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	eb b3                	jmp    80151c <dup+0x9d>
+
+00801569 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 18             	sub    $0x18,%esp
+  801571:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801574:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801577:	50                   	push   %eax
+  801578:	53                   	push   %ebx
+  801579:	e8 5b fd ff ff       	call   8012d9 <fd_lookup>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	78 3c                	js     8015c1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801585:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801588:	83 ec 08             	sub    $0x8,%esp
+  80158b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158e:	50                   	push   %eax
+  80158f:	ff 36                	push   (%esi)
+  801591:	e8 93 fd ff ff       	call   801329 <dev_lookup>
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 24                	js     8015c1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80159d:	8b 46 08             	mov    0x8(%esi),%eax
+  8015a0:	83 e0 03             	and    $0x3,%eax
+  8015a3:	83 f8 01             	cmp    $0x1,%eax
+  8015a6:	74 20                	je     8015c8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ab:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	74 61                	je     801613 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015b2:	83 ec 04             	sub    $0x4,%esp
+  8015b5:	ff 75 10             	push   0x10(%ebp)
+  8015b8:	ff 75 0c             	push   0xc(%ebp)
+  8015bb:	56                   	push   %esi
+  8015bc:	ff d0                	call   *%eax
+  8015be:	83 c4 10             	add    $0x10,%esp
+}
+  8015c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+  8015c8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015ca:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8015d0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015d5:	77 18                	ja     8015ef <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015d7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015dc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015de:	c1 e8 10             	shr    $0x10,%eax
+  8015e1:	74 0c                	je     8015ef <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015e3:	c1 e0 10             	shl    $0x10,%eax
+  8015e6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015eb:	29 c2                	sub    %eax,%edx
+  8015ed:	eb 06                	jmp    8015f5 <read+0x8c>
+		return pthread_main_tls;
+  8015ef:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015f5:	8b 02                	mov    (%edx),%eax
+  8015f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015fa:	83 ec 04             	sub    $0x4,%esp
+  8015fd:	53                   	push   %ebx
+  8015fe:	50                   	push   %eax
+  8015ff:	68 21 4e 80 00       	push   $0x804e21
+  801604:	e8 40 ec ff ff       	call   800249 <cprintf>
+		return -E_INVAL;
+  801609:	83 c4 10             	add    $0x10,%esp
+  80160c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801611:	eb ae                	jmp    8015c1 <read+0x58>
+		return -E_NOT_SUPP;
+  801613:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801618:	eb a7                	jmp    8015c1 <read+0x58>
+
+0080161a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 0c             	sub    $0xc,%esp
+  801623:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801626:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801629:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162e:	eb 02                	jmp    801632 <readn+0x18>
+  801630:	01 c3                	add    %eax,%ebx
+  801632:	39 f3                	cmp    %esi,%ebx
+  801634:	73 21                	jae    801657 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801636:	83 ec 04             	sub    $0x4,%esp
+  801639:	89 f0                	mov    %esi,%eax
+  80163b:	29 d8                	sub    %ebx,%eax
+  80163d:	50                   	push   %eax
+  80163e:	89 d8                	mov    %ebx,%eax
+  801640:	03 45 0c             	add    0xc(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	57                   	push   %edi
+  801645:	e8 1f ff ff ff       	call   801569 <read>
+		if (m < 0)
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 04                	js     801655 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801651:	75 dd                	jne    801630 <readn+0x16>
+  801653:	eb 02                	jmp    801657 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801655:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801657:	89 d8                	mov    %ebx,%eax
+  801659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165c:	5b                   	pop    %ebx
+  80165d:	5e                   	pop    %esi
+  80165e:	5f                   	pop    %edi
+  80165f:	5d                   	pop    %ebp
+  801660:	c3                   	ret
+
+00801661 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+  801666:	83 ec 18             	sub    $0x18,%esp
+  801669:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80166c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	53                   	push   %ebx
+  801671:	e8 63 fc ff ff       	call   8012d9 <fd_lookup>
+  801676:	83 c4 10             	add    $0x10,%esp
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	78 37                	js     8016b4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80167d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801680:	83 ec 08             	sub    $0x8,%esp
+  801683:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801686:	50                   	push   %eax
+  801687:	ff 36                	push   (%esi)
+  801689:	e8 9b fc ff ff       	call   801329 <dev_lookup>
+  80168e:	83 c4 10             	add    $0x10,%esp
+  801691:	85 c0                	test   %eax,%eax
+  801693:	78 1f                	js     8016b4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801695:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801699:	74 20                	je     8016bb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80169b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169e:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	74 61                	je     801706 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016a5:	83 ec 04             	sub    $0x4,%esp
+  8016a8:	ff 75 10             	push   0x10(%ebp)
+  8016ab:	ff 75 0c             	push   0xc(%ebp)
+  8016ae:	56                   	push   %esi
+  8016af:	ff d0                	call   *%eax
+  8016b1:	83 c4 10             	add    $0x10,%esp
+}
+  8016b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b7:	5b                   	pop    %ebx
+  8016b8:	5e                   	pop    %esi
+  8016b9:	5d                   	pop    %ebp
+  8016ba:	c3                   	ret
+  8016bb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016bd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016c3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016c8:	77 18                	ja     8016e2 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016ca:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016cf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8016d1:	c1 e8 10             	shr    $0x10,%eax
+  8016d4:	74 0c                	je     8016e2 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016d6:	c1 e0 10             	shl    $0x10,%eax
+  8016d9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8016de:	29 c2                	sub    %eax,%edx
+  8016e0:	eb 06                	jmp    8016e8 <write+0x87>
+		return pthread_main_tls;
+  8016e2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e8:	8b 02                	mov    (%edx),%eax
+  8016ea:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ed:	83 ec 04             	sub    $0x4,%esp
+  8016f0:	53                   	push   %ebx
+  8016f1:	50                   	push   %eax
+  8016f2:	68 3d 4e 80 00       	push   $0x804e3d
+  8016f7:	e8 4d eb ff ff       	call   800249 <cprintf>
+		return -E_INVAL;
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801704:	eb ae                	jmp    8016b4 <write+0x53>
+		return -E_NOT_SUPP;
+  801706:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80170b:	eb a7                	jmp    8016b4 <write+0x53>
+
+0080170d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801713:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	ff 75 08             	push   0x8(%ebp)
+  80171a:	e8 ba fb ff ff       	call   8012d9 <fd_lookup>
+  80171f:	83 c4 10             	add    $0x10,%esp
+  801722:	85 c0                	test   %eax,%eax
+  801724:	78 0e                	js     801734 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801726:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80172f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801734:	c9                   	leave
+  801735:	c3                   	ret
+
+00801736 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	56                   	push   %esi
+  80173a:	53                   	push   %ebx
+  80173b:	83 ec 18             	sub    $0x18,%esp
+  80173e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801741:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801744:	50                   	push   %eax
+  801745:	53                   	push   %ebx
+  801746:	e8 8e fb ff ff       	call   8012d9 <fd_lookup>
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 34                	js     801786 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801752:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801755:	83 ec 08             	sub    $0x8,%esp
+  801758:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175b:	50                   	push   %eax
+  80175c:	ff 36                	push   (%esi)
+  80175e:	e8 c6 fb ff ff       	call   801329 <dev_lookup>
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 1c                	js     801786 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80176a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80176e:	74 1d                	je     80178d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801770:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801773:	8b 40 18             	mov    0x18(%eax),%eax
+  801776:	85 c0                	test   %eax,%eax
+  801778:	74 5e                	je     8017d8 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80177a:	83 ec 08             	sub    $0x8,%esp
+  80177d:	ff 75 0c             	push   0xc(%ebp)
+  801780:	56                   	push   %esi
+  801781:	ff d0                	call   *%eax
+  801783:	83 c4 10             	add    $0x10,%esp
+}
+  801786:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801789:	5b                   	pop    %ebx
+  80178a:	5e                   	pop    %esi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+  80178d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80178f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801795:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80179a:	77 18                	ja     8017b4 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80179c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8017a1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8017a3:	c1 e8 10             	shr    $0x10,%eax
+  8017a6:	74 0c                	je     8017b4 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8017a8:	c1 e0 10             	shl    $0x10,%eax
+  8017ab:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8017b0:	29 c2                	sub    %eax,%edx
+  8017b2:	eb 06                	jmp    8017ba <ftruncate+0x84>
+		return pthread_main_tls;
+  8017b4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  8017ba:	8b 02                	mov    (%edx),%eax
+  8017bc:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	53                   	push   %ebx
+  8017c3:	50                   	push   %eax
+  8017c4:	68 00 4e 80 00       	push   $0x804e00
+  8017c9:	e8 7b ea ff ff       	call   800249 <cprintf>
+		return -E_INVAL;
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d6:	eb ae                	jmp    801786 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017dd:	eb a7                	jmp    801786 <ftruncate+0x50>
+
+008017df <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	56                   	push   %esi
+  8017e3:	53                   	push   %ebx
+  8017e4:	83 ec 18             	sub    $0x18,%esp
+  8017e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	ff 75 08             	push   0x8(%ebp)
+  8017f1:	e8 e3 fa ff ff       	call   8012d9 <fd_lookup>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 49                	js     801846 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801800:	83 ec 08             	sub    $0x8,%esp
+  801803:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801806:	50                   	push   %eax
+  801807:	ff 36                	push   (%esi)
+  801809:	e8 1b fb ff ff       	call   801329 <dev_lookup>
+  80180e:	83 c4 10             	add    $0x10,%esp
+  801811:	85 c0                	test   %eax,%eax
+  801813:	78 31                	js     801846 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801818:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80181c:	74 2f                	je     80184d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80181e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801821:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801828:	00 00 00 
+	stat->st_isdir = 0;
+  80182b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801832:	00 00 00 
+	stat->st_dev = dev;
+  801835:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80183b:	83 ec 08             	sub    $0x8,%esp
+  80183e:	53                   	push   %ebx
+  80183f:	56                   	push   %esi
+  801840:	ff 50 14             	call   *0x14(%eax)
+  801843:	83 c4 10             	add    $0x10,%esp
+}
+  801846:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801849:	5b                   	pop    %ebx
+  80184a:	5e                   	pop    %esi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80184d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801852:	eb f2                	jmp    801846 <fstat+0x67>
+
+00801854 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	56                   	push   %esi
+  801858:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801859:	83 ec 08             	sub    $0x8,%esp
+  80185c:	6a 00                	push   $0x0
+  80185e:	ff 75 08             	push   0x8(%ebp)
+  801861:	e8 4b 03 00 00       	call   801bb1 <open>
+  801866:	89 c3                	mov    %eax,%ebx
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 1b                	js     80188a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	ff 75 0c             	push   0xc(%ebp)
+  801875:	50                   	push   %eax
+  801876:	e8 64 ff ff ff       	call   8017df <fstat>
+  80187b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80187d:	89 1c 24             	mov    %ebx,(%esp)
+  801880:	e8 a8 fb ff ff       	call   80142d <close>
+	return r;
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	89 f3                	mov    %esi,%ebx
+}
+  80188a:	89 d8                	mov    %ebx,%eax
+  80188c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188f:	5b                   	pop    %ebx
+  801890:	5e                   	pop    %esi
+  801891:	5d                   	pop    %ebp
+  801892:	c3                   	ret
+
+00801893 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	56                   	push   %esi
+  801897:	53                   	push   %ebx
+  801898:	89 c6                	mov    %eax,%esi
+  80189a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80189c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8018a3:	74 27                	je     8018cc <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018a5:	6a 07                	push   $0x7
+  8018a7:	68 00 80 80 00       	push   $0x808000
+  8018ac:	56                   	push   %esi
+  8018ad:	ff 35 00 70 80 00    	push   0x807000
+  8018b3:	e8 a8 2d 00 00       	call   804660 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018b8:	83 c4 0c             	add    $0xc,%esp
+  8018bb:	6a 00                	push   $0x0
+  8018bd:	53                   	push   %ebx
+  8018be:	6a 00                	push   $0x0
+  8018c0:	e8 a5 2c 00 00       	call   80456a <ipc_recv>
+}
+  8018c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c8:	5b                   	pop    %ebx
+  8018c9:	5e                   	pop    %esi
+  8018ca:	5d                   	pop    %ebp
+  8018cb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	6a 01                	push   $0x1
+  8018d1:	e8 e0 2d 00 00       	call   8046b6 <ipc_find_env>
+  8018d6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	eb c5                	jmp    8018a5 <fsipc+0x12>
+
+008018e0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8018e7:	68 04 70 80 00       	push   $0x807004
+  8018ec:	e8 3d 1c 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f7:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8018fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018ff:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801904:	ba 00 00 00 00       	mov    $0x0,%edx
+  801909:	b8 02 00 00 00       	mov    $0x2,%eax
+  80190e:	e8 80 ff ff ff       	call   801893 <fsipc>
+  801913:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801915:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80191c:	e8 7a 1c 00 00       	call   80359b <mutex_unlock>
+	return r;
+}
+  801921:	89 d8                	mov    %ebx,%eax
+  801923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+
+00801928 <devfile_flush>:
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80192f:	68 04 70 80 00       	push   $0x807004
+  801934:	e8 f5 1b 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80193f:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801944:	ba 00 00 00 00       	mov    $0x0,%edx
+  801949:	b8 06 00 00 00       	mov    $0x6,%eax
+  80194e:	e8 40 ff ff ff       	call   801893 <fsipc>
+  801953:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801955:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80195c:	e8 3a 1c 00 00       	call   80359b <mutex_unlock>
+}
+  801961:	89 d8                	mov    %ebx,%eax
+  801963:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+00801968 <devfile_stat>:
+{
+  801968:	55                   	push   %ebp
+  801969:	89 e5                	mov    %esp,%ebp
+  80196b:	56                   	push   %esi
+  80196c:	53                   	push   %ebx
+  80196d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801970:	83 ec 0c             	sub    $0xc,%esp
+  801973:	68 04 70 80 00       	push   $0x807004
+  801978:	e8 b1 1b 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80197d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801980:	8b 40 0c             	mov    0xc(%eax),%eax
+  801983:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801992:	e8 fc fe ff ff       	call   801893 <fsipc>
+  801997:	89 c3                	mov    %eax,%ebx
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	79 16                	jns    8019b6 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8019a0:	83 ec 0c             	sub    $0xc,%esp
+  8019a3:	68 04 70 80 00       	push   $0x807004
+  8019a8:	e8 ee 1b 00 00       	call   80359b <mutex_unlock>
+}
+  8019ad:	89 d8                	mov    %ebx,%eax
+  8019af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b2:	5b                   	pop    %ebx
+  8019b3:	5e                   	pop    %esi
+  8019b4:	5d                   	pop    %ebp
+  8019b5:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019b6:	83 ec 08             	sub    $0x8,%esp
+  8019b9:	68 00 80 80 00       	push   $0x808000
+  8019be:	56                   	push   %esi
+  8019bf:	e8 69 ee ff ff       	call   80082d <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8019c4:	a1 80 80 80 00       	mov    0x808080,%eax
+  8019c9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019cf:	a1 84 80 80 00       	mov    0x808084,%eax
+  8019d4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8019da:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8019dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e2:	eb bc                	jmp    8019a0 <devfile_stat+0x38>
+
+008019e4 <devfile_write>:
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	53                   	push   %ebx
+  8019e8:	83 ec 10             	sub    $0x10,%esp
+  8019eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8019ee:	68 04 70 80 00       	push   $0x807004
+  8019f3:	e8 36 1b 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fe:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801a0c:	76 3d                	jbe    801a4b <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801a0e:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a13:	39 c3                	cmp    %eax,%ebx
+  801a15:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801a18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a1b:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801a20:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801a26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a30:	e8 5e fe ff ff       	call   801893 <fsipc>
+  801a35:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a37:	83 ec 0c             	sub    $0xc,%esp
+  801a3a:	68 04 70 80 00       	push   $0x807004
+  801a3f:	e8 57 1b 00 00       	call   80359b <mutex_unlock>
+}
+  801a44:	89 d8                	mov    %ebx,%eax
+  801a46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a49:	c9                   	leave
+  801a4a:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801a4b:	83 ec 04             	sub    $0x4,%esp
+  801a4e:	53                   	push   %ebx
+  801a4f:	ff 75 0c             	push   0xc(%ebp)
+  801a52:	68 0c 80 80 00       	push   $0x80800c
+  801a57:	e8 57 ef ff ff       	call   8009b3 <memmove>
+  801a5c:	83 c4 10             	add    $0x10,%esp
+  801a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a64:	eb b5                	jmp    801a1b <devfile_write+0x37>
+
+00801a66 <devfile_read>:
+{
+  801a66:	55                   	push   %ebp
+  801a67:	89 e5                	mov    %esp,%ebp
+  801a69:	57                   	push   %edi
+  801a6a:	56                   	push   %esi
+  801a6b:	53                   	push   %ebx
+  801a6c:	83 ec 0c             	sub    $0xc,%esp
+  801a6f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801a78:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a7e:	0f 86 8c 00 00 00    	jbe    801b10 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801a84:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a89:	39 c3                	cmp    %eax,%ebx
+  801a8b:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a8e:	89 f8                	mov    %edi,%eax
+  801a90:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801a93:	eb 0f                	jmp    801aa4 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801a95:	0f b6 08             	movzbl (%eax),%ecx
+  801a98:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801a9a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a9f:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801aa4:	39 d0                	cmp    %edx,%eax
+  801aa6:	72 ed                	jb     801a95 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	68 04 70 80 00       	push   $0x807004
+  801ab0:	e8 79 1a 00 00       	call   80352e <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ab5:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ab8:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801abd:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801ac3:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ace:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ad3:	e8 bb fd ff ff       	call   801893 <fsipc>
+  801ad8:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801ada:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ae1:	e8 b5 1a 00 00       	call   80359b <mutex_unlock>
+		assert(r <= (int) n);
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	39 f3                	cmp    %esi,%ebx
+  801aeb:	7c 0a                	jl     801af7 <devfile_read+0x91>
+}
+  801aed:	89 f0                	mov    %esi,%eax
+  801aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af2:	5b                   	pop    %ebx
+  801af3:	5e                   	pop    %esi
+  801af4:	5f                   	pop    %edi
+  801af5:	5d                   	pop    %ebp
+  801af6:	c3                   	ret
+		assert(r <= (int) n);
+  801af7:	68 70 4e 80 00       	push   $0x804e70
+  801afc:	68 7d 4e 80 00       	push   $0x804e7d
+  801b01:	68 90 00 00 00       	push   $0x90
+  801b06:	68 92 4e 80 00       	push   $0x804e92
+  801b0b:	e8 9e 23 00 00       	call   803eae <_panic>
+	mutex_lock(&fsipc_mu);
+  801b10:	83 ec 0c             	sub    $0xc,%esp
+  801b13:	68 04 70 80 00       	push   $0x807004
+  801b18:	e8 11 1a 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b1d:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b20:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801b25:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801b2b:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801b32:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801b35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b3f:	e8 4f fd ff ff       	call   801893 <fsipc>
+  801b44:	89 c6                	mov    %eax,%esi
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 1d                	js     801b6a <devfile_read+0x104>
+		assert(r <= n);
+  801b4d:	39 c3                	cmp    %eax,%ebx
+  801b4f:	72 2e                	jb     801b7f <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801b51:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b56:	7f 40                	jg     801b98 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b58:	83 ec 04             	sub    $0x4,%esp
+  801b5b:	50                   	push   %eax
+  801b5c:	68 00 80 80 00       	push   $0x808000
+  801b61:	57                   	push   %edi
+  801b62:	e8 4c ee ff ff       	call   8009b3 <memmove>
+  801b67:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801b6a:	83 ec 0c             	sub    $0xc,%esp
+  801b6d:	68 04 70 80 00       	push   $0x807004
+  801b72:	e8 24 1a 00 00       	call   80359b <mutex_unlock>
+	return r;
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	e9 6e ff ff ff       	jmp    801aed <devfile_read+0x87>
+		assert(r <= n);
+  801b7f:	68 9d 4e 80 00       	push   $0x804e9d
+  801b84:	68 7d 4e 80 00       	push   $0x804e7d
+  801b89:	68 99 00 00 00       	push   $0x99
+  801b8e:	68 92 4e 80 00       	push   $0x804e92
+  801b93:	e8 16 23 00 00       	call   803eae <_panic>
+		assert(r <= PGSIZE);
+  801b98:	68 a4 4e 80 00       	push   $0x804ea4
+  801b9d:	68 7d 4e 80 00       	push   $0x804e7d
+  801ba2:	68 9a 00 00 00       	push   $0x9a
+  801ba7:	68 92 4e 80 00       	push   $0x804e92
+  801bac:	e8 fd 22 00 00       	call   803eae <_panic>
+
+00801bb1 <open>:
+{
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	83 ec 1c             	sub    $0x1c,%esp
+  801bb9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bbc:	56                   	push   %esi
+  801bbd:	e8 30 ec ff ff       	call   8007f2 <strlen>
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bca:	0f 8f 85 00 00 00    	jg     801c55 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bd0:	83 ec 0c             	sub    $0xc,%esp
+  801bd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd6:	50                   	push   %eax
+  801bd7:	e8 a7 f6 ff ff       	call   801283 <fd_alloc>
+  801bdc:	89 c3                	mov    %eax,%ebx
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 55                	js     801c3a <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801be5:	83 ec 0c             	sub    $0xc,%esp
+  801be8:	68 04 70 80 00       	push   $0x807004
+  801bed:	e8 3c 19 00 00       	call   80352e <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bf2:	83 c4 08             	add    $0x8,%esp
+  801bf5:	56                   	push   %esi
+  801bf6:	68 00 80 80 00       	push   $0x808000
+  801bfb:	e8 2d ec ff ff       	call   80082d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c03:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801c08:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c10:	e8 7e fc ff ff       	call   801893 <fsipc>
+  801c15:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801c17:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801c1e:	e8 78 19 00 00       	call   80359b <mutex_unlock>
+	if (r < 0) {
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	85 db                	test   %ebx,%ebx
+  801c28:	78 19                	js     801c43 <open+0x92>
+	return fd2num(fd);
+  801c2a:	83 ec 0c             	sub    $0xc,%esp
+  801c2d:	ff 75 f4             	push   -0xc(%ebp)
+  801c30:	e8 27 f6 ff ff       	call   80125c <fd2num>
+  801c35:	89 c3                	mov    %eax,%ebx
+  801c37:	83 c4 10             	add    $0x10,%esp
+}
+  801c3a:	89 d8                	mov    %ebx,%eax
+  801c3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+		fd_close(fd, 0);
+  801c43:	83 ec 08             	sub    $0x8,%esp
+  801c46:	6a 00                	push   $0x0
+  801c48:	ff 75 f4             	push   -0xc(%ebp)
+  801c4b:	e8 56 f7 ff ff       	call   8013a6 <fd_close>
+		return r;
+  801c50:	83 c4 10             	add    $0x10,%esp
+  801c53:	eb e5                	jmp    801c3a <open+0x89>
+		return -E_BAD_PATH;
+  801c55:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c5a:	eb de                	jmp    801c3a <open+0x89>
+
+00801c5c <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801c5c:	55                   	push   %ebp
+  801c5d:	89 e5                	mov    %esp,%ebp
+  801c5f:	53                   	push   %ebx
+  801c60:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c66:	50                   	push   %eax
+  801c67:	ff 75 08             	push   0x8(%ebp)
+  801c6a:	e8 6a f6 ff ff       	call   8012d9 <fd_lookup>
+  801c6f:	89 c3                	mov    %eax,%ebx
+  801c71:	83 c4 10             	add    $0x10,%esp
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	78 5b                	js     801cd3 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7b:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801c81:	39 08                	cmp    %ecx,(%eax)
+  801c83:	75 55                	jne    801cda <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801c85:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801c89:	74 56                	je     801ce1 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801c8b:	83 ec 0c             	sub    $0xc,%esp
+  801c8e:	68 04 70 80 00       	push   $0x807004
+  801c93:	e8 96 18 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801c98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c9e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801ca3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ca6:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801cab:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cae:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801cbd:	e8 d1 fb ff ff       	call   801893 <fsipc>
+  801cc2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801cc4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ccb:	e8 cb 18 00 00       	call   80359b <mutex_unlock>
+	return r;
+  801cd0:	83 c4 10             	add    $0x10,%esp
+}
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cda:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801cdf:	eb f2                	jmp    801cd3 <fallocate+0x77>
+		return -E_INVAL;
+  801ce1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ce6:	eb eb                	jmp    801cd3 <fallocate+0x77>
+
+00801ce8 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801ce8:	55                   	push   %ebp
+  801ce9:	89 e5                	mov    %esp,%ebp
+  801ceb:	56                   	push   %esi
+  801cec:	53                   	push   %ebx
+  801ced:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801cf0:	89 f3                	mov    %esi,%ebx
+  801cf2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801cf8:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801cfb:	eb 06                	jmp    801d03 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801cfd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d03:	39 f3                	cmp    %esi,%ebx
+  801d05:	73 14                	jae    801d1b <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801d07:	83 ec 08             	sub    $0x8,%esp
+  801d0a:	53                   	push   %ebx
+  801d0b:	6a 00                	push   $0x0
+  801d0d:	e8 f2 ef ff ff       	call   800d04 <sys_page_unmap>
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	79 e4                	jns    801cfd <munmap+0x15>
+  801d19:	eb 05                	jmp    801d20 <munmap+0x38>
+			return r;
+	return 0;
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d23:	5b                   	pop    %ebx
+  801d24:	5e                   	pop    %esi
+  801d25:	5d                   	pop    %ebp
+  801d26:	c3                   	ret
+
+00801d27 <mmap>:
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	57                   	push   %edi
+  801d2b:	56                   	push   %esi
+  801d2c:	53                   	push   %ebx
+  801d2d:	83 ec 24             	sub    $0x24,%esp
+  801d30:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d33:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d36:	50                   	push   %eax
+  801d37:	ff 75 08             	push   0x8(%ebp)
+  801d3a:	e8 9a f5 ff ff       	call   8012d9 <fd_lookup>
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	0f 88 37 01 00 00    	js     801e81 <mmap+0x15a>
+		return NULL;
+  801d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801d4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d52:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801d58:	39 0a                	cmp    %ecx,(%edx)
+  801d5a:	0f 85 05 01 00 00    	jne    801e65 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801d60:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801d67:	0f 85 1b 01 00 00    	jne    801e88 <mmap+0x161>
+  801d6d:	89 f0                	mov    %esi,%eax
+  801d6f:	83 e8 01             	sub    $0x1,%eax
+  801d72:	0f 88 17 01 00 00    	js     801e8f <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801d78:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801d7c:	75 28                	jne    801da6 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	68 04 70 80 00       	push   $0x807004
+  801d86:	e8 a3 17 00 00       	call   80352e <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d8b:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801d91:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801d9f:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801da4:	eb 2b                	jmp    801dd1 <mmap+0xaa>
+		cow_enable();
+  801da6:	e8 4e 23 00 00       	call   8040f9 <cow_enable>
+  801dab:	eb d1                	jmp    801d7e <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801dad:	89 c2                	mov    %eax,%edx
+  801daf:	c1 ea 0c             	shr    $0xc,%edx
+  801db2:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801db9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801dbf:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801dc5:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801dc8:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801dca:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801dcf:	77 25                	ja     801df6 <mmap+0xcf>
+  801dd1:	89 c2                	mov    %eax,%edx
+  801dd3:	29 da                	sub    %ebx,%edx
+  801dd5:	39 ca                	cmp    %ecx,%edx
+  801dd7:	73 3a                	jae    801e13 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801dd9:	89 c2                	mov    %eax,%edx
+  801ddb:	c1 ea 16             	shr    $0x16,%edx
+  801dde:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801de5:	f6 c2 01             	test   $0x1,%dl
+  801de8:	75 c3                	jne    801dad <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801dea:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801def:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801df4:	eb d4                	jmp    801dca <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801df6:	29 d8                	sub    %ebx,%eax
+  801df8:	39 c8                	cmp    %ecx,%eax
+  801dfa:	73 17                	jae    801e13 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801dfc:	83 ec 0c             	sub    $0xc,%esp
+  801dff:	68 04 70 80 00       	push   $0x807004
+  801e04:	e8 92 17 00 00       	call   80359b <mutex_unlock>
+		return NULL;
+  801e09:	83 c4 10             	add    $0x10,%esp
+  801e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e11:	eb 52                	jmp    801e65 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801e13:	85 db                	test   %ebx,%ebx
+  801e15:	74 e5                	je     801dfc <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801e17:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801e22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e25:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801e2a:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801e30:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801e36:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e39:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e48:	e8 46 fa ff ff       	call   801893 <fsipc>
+  801e4d:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801e4f:	83 ec 0c             	sub    $0xc,%esp
+  801e52:	68 04 70 80 00       	push   $0x807004
+  801e57:	e8 3f 17 00 00       	call   80359b <mutex_unlock>
+	if (r < 0) {
+  801e5c:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801e5f:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801e61:	85 ff                	test   %edi,%edi
+  801e63:	78 08                	js     801e6d <mmap+0x146>
+}
+  801e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e68:	5b                   	pop    %ebx
+  801e69:	5e                   	pop    %esi
+  801e6a:	5f                   	pop    %edi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+		munmap((void*) va, len);
+  801e6d:	83 ec 08             	sub    $0x8,%esp
+  801e70:	56                   	push   %esi
+  801e71:	53                   	push   %ebx
+  801e72:	e8 71 fe ff ff       	call   801ce8 <munmap>
+		return NULL;
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7f:	eb e4                	jmp    801e65 <mmap+0x13e>
+		return NULL;
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e86:	eb dd                	jmp    801e65 <mmap+0x13e>
+		return NULL;
+  801e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8d:	eb d6                	jmp    801e65 <mmap+0x13e>
+  801e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e94:	eb cf                	jmp    801e65 <mmap+0x13e>
+
+00801e96 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 10             	sub    $0x10,%esp
+  801e9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801ea0:	53                   	push   %ebx
+  801ea1:	e8 4c e9 ff ff       	call   8007f2 <strlen>
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eae:	7f 42                	jg     801ef2 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801eb0:	83 ec 0c             	sub    $0xc,%esp
+  801eb3:	68 04 70 80 00       	push   $0x807004
+  801eb8:	e8 71 16 00 00       	call   80352e <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ebd:	83 c4 08             	add    $0x8,%esp
+  801ec0:	53                   	push   %ebx
+  801ec1:	68 00 80 80 00       	push   $0x808000
+  801ec6:	e8 62 e9 ff ff       	call   80082d <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed0:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ed5:	e8 b9 f9 ff ff       	call   801893 <fsipc>
+  801eda:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801edc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ee3:	e8 b3 16 00 00       	call   80359b <mutex_unlock>
+	return r;
+  801ee8:	83 c4 10             	add    $0x10,%esp
+}
+  801eeb:	89 d8                	mov    %ebx,%eax
+  801eed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef0:	c9                   	leave
+  801ef1:	c3                   	ret
+		return -E_BAD_PATH;
+  801ef2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ef7:	eb f2                	jmp    801eeb <remove+0x55>
+
+00801ef9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ef9:	55                   	push   %ebp
+  801efa:	89 e5                	mov    %esp,%ebp
+  801efc:	53                   	push   %ebx
+  801efd:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f00:	68 04 70 80 00       	push   $0x807004
+  801f05:	e8 24 16 00 00       	call   80352e <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801f0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f14:	e8 7a f9 ff ff       	call   801893 <fsipc>
+  801f19:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f1b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f22:	e8 74 16 00 00       	call   80359b <mutex_unlock>
+	return r;
+}
+  801f27:	89 d8                	mov    %ebx,%eax
+  801f29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2c:	c9                   	leave
+  801f2d:	c3                   	ret
+
+00801f2e <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801f2e:	55                   	push   %ebp
+  801f2f:	89 e5                	mov    %esp,%ebp
+  801f31:	56                   	push   %esi
+  801f32:	53                   	push   %ebx
+  801f33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f36:	83 ec 0c             	sub    $0xc,%esp
+  801f39:	68 04 70 80 00       	push   $0x807004
+  801f3e:	e8 eb 15 00 00       	call   80352e <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801f43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f46:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f55:	e8 39 f9 ff ff       	call   801893 <fsipc>
+  801f5a:	89 c6                	mov    %eax,%esi
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	85 db                	test   %ebx,%ebx
+  801f61:	74 7b                	je     801fde <fs_bcstat+0xb0>
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	78 77                	js     801fde <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801f67:	a1 00 80 80 00       	mov    0x808000,%eax
+  801f6c:	89 03                	mov    %eax,(%ebx)
+  801f6e:	a1 04 80 80 00       	mov    0x808004,%eax
+  801f73:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f76:	a1 08 80 80 00       	mov    0x808008,%eax
+  801f7b:	89 43 08             	mov    %eax,0x8(%ebx)
+  801f7e:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801f83:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801f86:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f8b:	89 43 10             	mov    %eax,0x10(%ebx)
+  801f8e:	a1 14 80 80 00       	mov    0x808014,%eax
+  801f93:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f96:	a1 18 80 80 00       	mov    0x808018,%eax
+  801f9b:	89 43 18             	mov    %eax,0x18(%ebx)
+  801f9e:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801fa3:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801fa6:	a1 20 80 80 00       	mov    0x808020,%eax
+  801fab:	89 43 20             	mov    %eax,0x20(%ebx)
+  801fae:	a1 24 80 80 00       	mov    0x808024,%eax
+  801fb3:	89 43 24             	mov    %eax,0x24(%ebx)
+  801fb6:	a1 28 80 80 00       	mov    0x808028,%eax
+  801fbb:	89 43 28             	mov    %eax,0x28(%ebx)
+  801fbe:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801fc3:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801fc6:	a1 30 80 80 00       	mov    0x808030,%eax
+  801fcb:	89 43 30             	mov    %eax,0x30(%ebx)
+  801fce:	a1 34 80 80 00       	mov    0x808034,%eax
+  801fd3:	89 43 34             	mov    %eax,0x34(%ebx)
+  801fd6:	a1 38 80 80 00       	mov    0x808038,%eax
+  801fdb:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801fde:	83 ec 0c             	sub    $0xc,%esp
+  801fe1:	68 04 70 80 00       	push   $0x807004
+  801fe6:	e8 b0 15 00 00       	call   80359b <mutex_unlock>
+	return r;
+}
+  801feb:	89 f0                	mov    %esi,%eax
+  801fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff0:	5b                   	pop    %ebx
+  801ff1:	5e                   	pop    %esi
+  801ff2:	5d                   	pop    %ebp
+  801ff3:	c3                   	ret
+
+00801ff4 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801ff4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801ff8:	7f 01                	jg     801ffb <writebuf+0x7>
+  801ffa:	c3                   	ret
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	53                   	push   %ebx
+  801fff:	83 ec 08             	sub    $0x8,%esp
+  802002:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802004:	ff 70 04             	push   0x4(%eax)
+  802007:	8d 40 10             	lea    0x10(%eax),%eax
+  80200a:	50                   	push   %eax
+  80200b:	ff 33                	push   (%ebx)
+  80200d:	e8 4f f6 ff ff       	call   801661 <write>
+		if (result > 0)
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	7e 03                	jle    80201c <writebuf+0x28>
+			b->result += result;
+  802019:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  80201c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80201f:	74 0d                	je     80202e <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802021:	85 c0                	test   %eax,%eax
+  802023:	ba 00 00 00 00       	mov    $0x0,%edx
+  802028:	0f 4f c2             	cmovg  %edx,%eax
+  80202b:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80202e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+
+00802033 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	53                   	push   %ebx
+  802037:	83 ec 04             	sub    $0x4,%esp
+  80203a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  80203d:	8b 53 04             	mov    0x4(%ebx),%edx
+  802040:	8d 42 01             	lea    0x1(%edx),%eax
+  802043:	89 43 04             	mov    %eax,0x4(%ebx)
+  802046:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802049:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80204d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802052:	74 05                	je     802059 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802054:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802057:	c9                   	leave
+  802058:	c3                   	ret
+		writebuf(b);
+  802059:	89 d8                	mov    %ebx,%eax
+  80205b:	e8 94 ff ff ff       	call   801ff4 <writebuf>
+		b->idx = 0;
+  802060:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802067:	eb eb                	jmp    802054 <putch+0x21>
+
+00802069 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802069:	55                   	push   %ebp
+  80206a:	89 e5                	mov    %esp,%ebp
+  80206c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802072:	8b 45 08             	mov    0x8(%ebp),%eax
+  802075:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  80207b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802082:	00 00 00 
+	b.result = 0;
+  802085:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80208c:	00 00 00 
+	b.error = 1;
+  80208f:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802096:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802099:	ff 75 10             	push   0x10(%ebp)
+  80209c:	ff 75 0c             	push   0xc(%ebp)
+  80209f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8020a5:	50                   	push   %eax
+  8020a6:	68 33 20 80 00       	push   $0x802033
+  8020ab:	e8 90 e2 ff ff       	call   800340 <vprintfmt>
+	if (b.idx > 0)
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8020ba:	7f 12                	jg     8020ce <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8020bc:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	75 06                	jne    8020cc <vfprintf+0x63>
+  8020c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+		writebuf(&b);
+  8020ce:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8020d4:	e8 1b ff ff ff       	call   801ff4 <writebuf>
+  8020d9:	eb e1                	jmp    8020bc <vfprintf+0x53>
+
+008020db <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8020e1:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8020e4:	50                   	push   %eax
+  8020e5:	ff 75 0c             	push   0xc(%ebp)
+  8020e8:	ff 75 08             	push   0x8(%ebp)
+  8020eb:	e8 79 ff ff ff       	call   802069 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+
+008020f2 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8020f2:	55                   	push   %ebp
+  8020f3:	89 e5                	mov    %esp,%ebp
+  8020f5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8020f8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8020fb:	50                   	push   %eax
+  8020fc:	ff 75 08             	push   0x8(%ebp)
+  8020ff:	6a 01                	push   $0x1
+  802101:	e8 63 ff ff ff       	call   802069 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+
+00802108 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	56                   	push   %esi
+  80210c:	53                   	push   %ebx
+  80210d:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80210f:	0f b6 10             	movzbl (%eax),%edx
+  802112:	80 fa 72             	cmp    $0x72,%dl
+  802115:	74 44                	je     80215b <parse_mode+0x53>
+  802117:	80 fa 77             	cmp    $0x77,%dl
+  80211a:	74 4b                	je     802167 <parse_mode+0x5f>
+  80211c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802121:	80 fa 61             	cmp    $0x61,%dl
+  802124:	74 09                	je     80212f <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802126:	89 d8                	mov    %ebx,%eax
+  802128:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5d                   	pop    %ebp
+  80212e:	c3                   	ret
+	switch (mode[0]) {
+  80212f:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802134:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802139:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	6a 2b                	push   $0x2b
+  802140:	50                   	push   %eax
+  802141:	e8 f9 e7 ff ff       	call   80093f <strchr>
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	85 c0                	test   %eax,%eax
+  80214b:	74 d9                	je     802126 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80214d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802150:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802153:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802159:	eb cb                	jmp    802126 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80215b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802160:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802165:	eb d2                	jmp    802139 <parse_mode+0x31>
+  802167:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80216c:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802171:	eb c6                	jmp    802139 <parse_mode+0x31>
+
+00802173 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	57                   	push   %edi
+  802177:	56                   	push   %esi
+  802178:	53                   	push   %ebx
+  802179:	83 ec 1c             	sub    $0x1c,%esp
+  80217c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80217f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802182:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802187:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80218c:	83 c0 24             	add    $0x24,%eax
+  80218f:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802193:	74 17                	je     8021ac <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802195:	83 c3 01             	add    $0x1,%ebx
+  802198:	83 fb 10             	cmp    $0x10,%ebx
+  80219b:	75 ef                	jne    80218c <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80219d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8021a2:	89 f0                	mov    %esi,%eax
+  8021a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a7:	5b                   	pop    %ebx
+  8021a8:	5e                   	pop    %esi
+  8021a9:	5f                   	pop    %edi
+  8021aa:	5d                   	pop    %ebp
+  8021ab:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8021ac:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8021b3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8021b6:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8021b9:	c1 e7 02             	shl    $0x2,%edi
+  8021bc:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8021c2:	83 ec 04             	sub    $0x4,%esp
+  8021c5:	6a 24                	push   $0x24
+  8021c7:	6a 00                	push   $0x0
+  8021c9:	56                   	push   %esi
+  8021ca:	e8 af e7 ff ff       	call   80097e <memset>
+			streams[i].f_fd = fd;
+  8021cf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8021d2:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8021d8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8021db:	01 d8                	add    %ebx,%eax
+  8021dd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8021e0:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	eb b6                	jmp    8021a2 <stream_alloc+0x2f>
+
+008021ec <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	53                   	push   %ebx
+  8021f0:	83 ec 14             	sub    $0x14,%esp
+  8021f3:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8021f5:	8b 40 18             	mov    0x18(%eax),%eax
+  8021f8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8021fb:	74 4a                	je     802247 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+  802200:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802203:	50                   	push   %eax
+  802204:	ff 33                	push   (%ebx)
+  802206:	e8 ce f0 ff ff       	call   8012d9 <fd_lookup>
+  80220b:	89 c2                	mov    %eax,%edx
+  80220d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802215:	85 d2                	test   %edx,%edx
+  802217:	78 41                	js     80225a <stream_unread+0x6e>
+  802219:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80221c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802222:	39 0a                	cmp    %ecx,(%edx)
+  802224:	75 34                	jne    80225a <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802226:	8b 43 14             	mov    0x14(%ebx),%eax
+  802229:	03 42 04             	add    0x4(%edx),%eax
+  80222c:	2b 43 18             	sub    0x18(%ebx),%eax
+  80222f:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802232:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802239:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802240:	b8 01 00 00 00       	mov    $0x1,%eax
+  802245:	eb 13                	jmp    80225a <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802247:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80224e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802255:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80225a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+
+0080225f <stream_drain>:
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	56                   	push   %esi
+  802263:	53                   	push   %ebx
+  802264:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80226b:	eb 02                	jmp    80226f <stream_drain+0x10>
+  80226d:	01 c3                	add    %eax,%ebx
+  80226f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802272:	39 c3                	cmp    %eax,%ebx
+  802274:	73 43                	jae    8022b9 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802276:	83 ec 04             	sub    $0x4,%esp
+  802279:	29 d8                	sub    %ebx,%eax
+  80227b:	50                   	push   %eax
+  80227c:	89 d8                	mov    %ebx,%eax
+  80227e:	03 46 0c             	add    0xc(%esi),%eax
+  802281:	50                   	push   %eax
+  802282:	ff 36                	push   (%esi)
+  802284:	e8 d8 f3 ff ff       	call   801661 <write>
+  802289:	83 c4 10             	add    $0x10,%esp
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	7f dd                	jg     80226d <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802290:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802294:	8b 56 0c             	mov    0xc(%esi),%edx
+  802297:	83 ec 04             	sub    $0x4,%esp
+  80229a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80229d:	29 d8                	sub    %ebx,%eax
+  80229f:	50                   	push   %eax
+  8022a0:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8022a3:	50                   	push   %eax
+  8022a4:	52                   	push   %edx
+  8022a5:	e8 09 e7 ff ff       	call   8009b3 <memmove>
+			f->f_wend -= done;
+  8022aa:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8022ad:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8022b7:	eb 0a                	jmp    8022c3 <stream_drain+0x64>
+  8022b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8022be:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8022c3:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8022c6:	89 d0                	mov    %edx,%eax
+  8022c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+
+008022cf <stream_setup>:
+	if (f->f_buf)
+  8022cf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8022d3:	74 01                	je     8022d6 <stream_setup+0x7>
+  8022d5:	c3                   	ret
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	53                   	push   %ebx
+  8022da:	83 ec 04             	sub    $0x4,%esp
+  8022dd:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8022df:	8b 40 08             	mov    0x8(%eax),%eax
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	74 17                	je     8022fd <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8022e6:	83 f8 03             	cmp    $0x3,%eax
+  8022e9:	75 2d                	jne    802318 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8022eb:	8d 43 20             	lea    0x20(%ebx),%eax
+  8022ee:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8022f1:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8022f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8022fd:	83 ec 0c             	sub    $0xc,%esp
+  802300:	ff 33                	push   (%ebx)
+  802302:	e8 29 1b 00 00       	call   803e30 <iscons>
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	0f 9f c0             	setg   %al
+  80230f:	0f b6 c0             	movzbl %al,%eax
+  802312:	83 c0 01             	add    $0x1,%eax
+  802315:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802318:	83 ec 0c             	sub    $0xc,%esp
+  80231b:	68 00 10 00 00       	push   $0x1000
+  802320:	e8 6e 0b 00 00       	call   802e93 <malloc>
+  802325:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802328:	83 c4 10             	add    $0x10,%esp
+  80232b:	85 c0                	test   %eax,%eax
+  80232d:	74 bc                	je     8022eb <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80232f:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802336:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80233a:	eb bc                	jmp    8022f8 <stream_setup+0x29>
+
+0080233c <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	53                   	push   %ebx
+  802340:	83 ec 04             	sub    $0x4,%esp
+  802343:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802345:	e8 85 ff ff ff       	call   8022cf <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80234a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80234f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802353:	74 3d                	je     802392 <stream_fill+0x56>
+  802355:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802359:	74 10                	je     80236b <stream_fill+0x2f>
+  80235b:	89 d8                	mov    %ebx,%eax
+  80235d:	e8 fd fe ff ff       	call   80225f <stream_drain>
+		return 0;
+  802362:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 27                	js     802392 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80236b:	83 ec 04             	sub    $0x4,%esp
+  80236e:	ff 73 10             	push   0x10(%ebx)
+  802371:	ff 73 0c             	push   0xc(%ebx)
+  802374:	ff 33                	push   (%ebx)
+  802376:	e8 ee f1 ff ff       	call   801569 <read>
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	7e 17                	jle    802399 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802382:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802386:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80238d:	89 c2                	mov    %eax,%edx
+  80238f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802392:	89 d0                	mov    %edx,%eax
+  802394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802399:	c1 f8 1f             	sar    $0x1f,%eax
+  80239c:	83 e0 04             	and    $0x4,%eax
+  80239f:	83 c0 04             	add    $0x4,%eax
+  8023a2:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8023a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023aa:	eb e6                	jmp    802392 <stream_fill+0x56>
+
+008023ac <fopen>:
+{
+  8023ac:	55                   	push   %ebp
+  8023ad:	89 e5                	mov    %esp,%ebp
+  8023af:	57                   	push   %edi
+  8023b0:	56                   	push   %esi
+  8023b1:	53                   	push   %ebx
+  8023b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8023b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8023bb:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8023c1:	89 f0                	mov    %esi,%eax
+  8023c3:	e8 40 fd ff ff       	call   802108 <parse_mode>
+		return 0;
+  8023c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	78 2d                	js     8023fe <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8023d1:	83 ec 08             	sub    $0x8,%esp
+  8023d4:	50                   	push   %eax
+  8023d5:	ff 75 08             	push   0x8(%ebp)
+  8023d8:	e8 d4 f7 ff ff       	call   801bb1 <open>
+  8023dd:	89 c7                	mov    %eax,%edi
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	85 c0                	test   %eax,%eax
+  8023e4:	78 58                	js     80243e <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8023e6:	80 3e 61             	cmpb   $0x61,(%esi)
+  8023e9:	74 1d                	je     802408 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8023eb:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8023f1:	89 f8                	mov    %edi,%eax
+  8023f3:	e8 7b fd ff ff       	call   802173 <stream_alloc>
+  8023f8:	89 c3                	mov    %eax,%ebx
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	74 32                	je     802430 <fopen+0x84>
+}
+  8023fe:	89 d8                	mov    %ebx,%eax
+  802400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5f                   	pop    %edi
+  802406:	5d                   	pop    %ebp
+  802407:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802408:	83 ec 08             	sub    $0x8,%esp
+  80240b:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802411:	50                   	push   %eax
+  802412:	57                   	push   %edi
+  802413:	e8 c7 f3 ff ff       	call   8017df <fstat>
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 cc                	js     8023eb <fopen+0x3f>
+		seek(fd, st.st_size);
+  80241f:	83 ec 08             	sub    $0x8,%esp
+  802422:	ff 75 dc             	push   -0x24(%ebp)
+  802425:	57                   	push   %edi
+  802426:	e8 e2 f2 ff ff       	call   80170d <seek>
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	eb bb                	jmp    8023eb <fopen+0x3f>
+		close(fd);
+  802430:	83 ec 0c             	sub    $0xc,%esp
+  802433:	57                   	push   %edi
+  802434:	e8 f4 ef ff ff       	call   80142d <close>
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	eb c0                	jmp    8023fe <fopen+0x52>
+		return 0;
+  80243e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802443:	eb b9                	jmp    8023fe <fopen+0x52>
+
+00802445 <fdopen>:
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80244b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80244e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802451:	e8 b2 fc ff ff       	call   802108 <parse_mode>
+  802456:	89 c2                	mov    %eax,%edx
+		return 0;
+  802458:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80245d:	85 d2                	test   %edx,%edx
+  80245f:	78 0b                	js     80246c <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802461:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802464:	8b 45 08             	mov    0x8(%ebp),%eax
+  802467:	e8 07 fd ff ff       	call   802173 <stream_alloc>
+}
+  80246c:	c9                   	leave
+  80246d:	c3                   	ret
+
+0080246e <setvbuf>:
+{
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	8b 45 08             	mov    0x8(%ebp),%eax
+  802477:	8b 55 10             	mov    0x10(%ebp),%edx
+  80247a:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80247d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802481:	75 3a                	jne    8024bd <setvbuf+0x4f>
+  802483:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802486:	83 fe 02             	cmp    $0x2,%esi
+  802489:	77 39                	ja     8024c4 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80248b:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80248e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802492:	0f 95 c3             	setne  %bl
+  802495:	85 ff                	test   %edi,%edi
+  802497:	0f 95 c1             	setne  %cl
+  80249a:	84 cb                	test   %cl,%bl
+  80249c:	74 05                	je     8024a3 <setvbuf+0x35>
+  80249e:	83 fa 03             	cmp    $0x3,%edx
+  8024a1:	75 0a                	jne    8024ad <setvbuf+0x3f>
+	return 0;
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a8:	5b                   	pop    %ebx
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5f                   	pop    %edi
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+		f->f_buf = buf;
+  8024ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b0:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8024b3:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	eb eb                	jmp    8024a8 <setvbuf+0x3a>
+		return EOF;
+  8024bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024c2:	eb e4                	jmp    8024a8 <setvbuf+0x3a>
+  8024c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024c9:	eb dd                	jmp    8024a8 <setvbuf+0x3a>
+
+008024cb <fflush>:
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	57                   	push   %edi
+  8024cf:	56                   	push   %esi
+  8024d0:	53                   	push   %ebx
+  8024d1:	83 ec 0c             	sub    $0xc,%esp
+  8024d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8024d7:	85 db                	test   %ebx,%ebx
+  8024d9:	74 1a                	je     8024f5 <fflush+0x2a>
+	stream_unread(f);
+  8024db:	89 d8                	mov    %ebx,%eax
+  8024dd:	e8 0a fd ff ff       	call   8021ec <stream_unread>
+	return stream_drain(f);
+  8024e2:	89 d8                	mov    %ebx,%eax
+  8024e4:	e8 76 fd ff ff       	call   80225f <stream_drain>
+  8024e9:	89 c7                	mov    %eax,%edi
+}
+  8024eb:	89 f8                	mov    %edi,%eax
+  8024ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f0:	5b                   	pop    %ebx
+  8024f1:	5e                   	pop    %esi
+  8024f2:	5f                   	pop    %edi
+  8024f3:	5d                   	pop    %ebp
+  8024f4:	c3                   	ret
+  8024f5:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  8024fa:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8024ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802504:	eb 03                	jmp    802509 <fflush+0x3e>
+  802506:	83 c3 24             	add    $0x24,%ebx
+  802509:	39 f3                	cmp    %esi,%ebx
+  80250b:	74 de                	je     8024eb <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80250d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802511:	74 f3                	je     802506 <fflush+0x3b>
+  802513:	83 ec 0c             	sub    $0xc,%esp
+  802516:	53                   	push   %ebx
+  802517:	e8 af ff ff ff       	call   8024cb <fflush>
+  80251c:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802526:	0f 48 f8             	cmovs  %eax,%edi
+  802529:	eb db                	jmp    802506 <fflush+0x3b>
+
+0080252b <fclose>:
+{
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	56                   	push   %esi
+  80252f:	53                   	push   %ebx
+  802530:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802533:	83 ec 0c             	sub    $0xc,%esp
+  802536:	56                   	push   %esi
+  802537:	e8 8f ff ff ff       	call   8024cb <fflush>
+  80253c:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80253e:	83 c4 04             	add    $0x4,%esp
+  802541:	ff 36                	push   (%esi)
+  802543:	e8 e5 ee ff ff       	call   80142d <close>
+  802548:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802552:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802555:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802559:	75 10                	jne    80256b <fclose+0x40>
+	f->f_flags = 0;
+  80255b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802562:	89 d8                	mov    %ebx,%eax
+  802564:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5d                   	pop    %ebp
+  80256a:	c3                   	ret
+		free(f->f_buf);
+  80256b:	83 ec 0c             	sub    $0xc,%esp
+  80256e:	ff 76 0c             	push   0xc(%esi)
+  802571:	e8 54 08 00 00       	call   802dca <free>
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	eb e0                	jmp    80255b <fclose+0x30>
+
+0080257b <fileno>:
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80257e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802581:	8b 00                	mov    (%eax),%eax
+}
+  802583:	5d                   	pop    %ebp
+  802584:	c3                   	ret
+
+00802585 <feof>:
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258b:	8b 40 04             	mov    0x4(%eax),%eax
+  80258e:	c1 e8 02             	shr    $0x2,%eax
+  802591:	83 e0 01             	and    $0x1,%eax
+}
+  802594:	5d                   	pop    %ebp
+  802595:	c3                   	ret
+
+00802596 <ferror>:
+{
+  802596:	55                   	push   %ebp
+  802597:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802599:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259c:	8b 40 04             	mov    0x4(%eax),%eax
+  80259f:	c1 e8 03             	shr    $0x3,%eax
+  8025a2:	83 e0 01             	and    $0x1,%eax
+}
+  8025a5:	5d                   	pop    %ebp
+  8025a6:	c3                   	ret
+
+008025a7 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	53                   	push   %ebx
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8025b1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8025b4:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8025b7:	74 15                	je     8025ce <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8025b9:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8025bc:	8b 43 14             	mov    0x14(%ebx),%eax
+  8025bf:	8d 48 01             	lea    0x1(%eax),%ecx
+  8025c2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8025c5:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8025c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cc:	c9                   	leave
+  8025cd:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8025ce:	89 d8                	mov    %ebx,%eax
+  8025d0:	e8 67 fd ff ff       	call   80233c <stream_fill>
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	75 e0                	jne    8025b9 <fgetc+0x12>
+		return EOF;
+  8025d9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025de:	eb e9                	jmp    8025c9 <fgetc+0x22>
+
+008025e0 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8025e0:	55                   	push   %ebp
+  8025e1:	89 e5                	mov    %esp,%ebp
+  8025e3:	57                   	push   %edi
+  8025e4:	56                   	push   %esi
+  8025e5:	53                   	push   %ebx
+  8025e6:	83 ec 1c             	sub    $0x1c,%esp
+  8025e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8025ec:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8025f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025f4:	83 e8 01             	sub    $0x1,%eax
+  8025f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8025fa:	eb 66                	jmp    802662 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8025fc:	8b 46 14             	mov    0x14(%esi),%eax
+  8025ff:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802602:	29 c3                	sub    %eax,%ebx
+  802604:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802607:	29 fa                	sub    %edi,%edx
+  802609:	39 d3                	cmp    %edx,%ebx
+  80260b:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80260e:	83 ec 04             	sub    $0x4,%esp
+  802611:	53                   	push   %ebx
+  802612:	6a 0a                	push   $0xa
+  802614:	03 46 0c             	add    0xc(%esi),%eax
+  802617:	50                   	push   %eax
+  802618:	e8 47 e4 ff ff       	call   800a64 <memfind>
+  80261d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802620:	8b 46 0c             	mov    0xc(%esi),%eax
+  802623:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802626:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802629:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802631:	74 0b                	je     80263e <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802633:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802636:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802639:	29 d3                	sub    %edx,%ebx
+  80263b:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80263e:	83 ec 04             	sub    $0x4,%esp
+  802641:	53                   	push   %ebx
+  802642:	01 c8                	add    %ecx,%eax
+  802644:	50                   	push   %eax
+  802645:	89 f8                	mov    %edi,%eax
+  802647:	03 45 08             	add    0x8(%ebp),%eax
+  80264a:	50                   	push   %eax
+  80264b:	e8 63 e3 ff ff       	call   8009b3 <memmove>
+		f->f_rpos += m;
+  802650:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802653:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802655:	83 c4 10             	add    $0x10,%esp
+  802658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265b:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802660:	74 1f                	je     802681 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802662:	8d 47 01             	lea    0x1(%edi),%eax
+  802665:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802668:	73 17                	jae    802681 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80266a:	8b 46 18             	mov    0x18(%esi),%eax
+  80266d:	39 46 14             	cmp    %eax,0x14(%esi)
+  802670:	75 8a                	jne    8025fc <fgets+0x1c>
+  802672:	89 f0                	mov    %esi,%eax
+  802674:	e8 c3 fc ff ff       	call   80233c <stream_fill>
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	0f 85 7b ff ff ff    	jne    8025fc <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802681:	85 ff                	test   %edi,%edi
+  802683:	74 0f                	je     802694 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802685:	8b 45 08             	mov    0x8(%ebp),%eax
+  802688:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80268c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80268f:	5b                   	pop    %ebx
+  802690:	5e                   	pop    %esi
+  802691:	5f                   	pop    %edi
+  802692:	5d                   	pop    %ebp
+  802693:	c3                   	ret
+		return 0;
+  802694:	b8 00 00 00 00       	mov    $0x0,%eax
+  802699:	eb f1                	jmp    80268c <fgets+0xac>
+
+0080269b <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	57                   	push   %edi
+  80269f:	56                   	push   %esi
+  8026a0:	53                   	push   %ebx
+  8026a1:	83 ec 1c             	sub    $0x1c,%esp
+  8026a4:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8026a7:	89 f0                	mov    %esi,%eax
+  8026a9:	e8 21 fc ff ff       	call   8022cf <stream_setup>
+	want = size * n;
+  8026ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b1:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8026b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8026b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026bd:	eb 43                	jmp    802702 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8026bf:	29 d3                	sub    %edx,%ebx
+  8026c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026c4:	29 f8                	sub    %edi,%eax
+  8026c6:	39 c3                	cmp    %eax,%ebx
+  8026c8:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8026cb:	83 ec 04             	sub    $0x4,%esp
+  8026ce:	53                   	push   %ebx
+  8026cf:	03 56 0c             	add    0xc(%esi),%edx
+  8026d2:	52                   	push   %edx
+  8026d3:	89 f8                	mov    %edi,%eax
+  8026d5:	03 45 08             	add    0x8(%ebp),%eax
+  8026d8:	50                   	push   %eax
+  8026d9:	e8 d5 e2 ff ff       	call   8009b3 <memmove>
+			f->f_rpos += m;
+  8026de:	01 5e 14             	add    %ebx,0x14(%esi)
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	eb 1a                	jmp    802700 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8026e6:	83 ec 04             	sub    $0x4,%esp
+  8026e9:	53                   	push   %ebx
+  8026ea:	89 f8                	mov    %edi,%eax
+  8026ec:	03 45 08             	add    0x8(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	ff 36                	push   (%esi)
+  8026f2:	e8 72 ee ff ff       	call   801569 <read>
+  8026f7:	89 c3                	mov    %eax,%ebx
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	85 c0                	test   %eax,%eax
+  8026fe:	7e 36                	jle    802736 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802700:	01 df                	add    %ebx,%edi
+  802702:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802705:	39 c7                	cmp    %eax,%edi
+  802707:	73 39                	jae    802742 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802709:	8b 56 14             	mov    0x14(%esi),%edx
+  80270c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80270f:	39 da                	cmp    %ebx,%edx
+  802711:	72 ac                	jb     8026bf <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802713:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802716:	29 fb                	sub    %edi,%ebx
+  802718:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80271b:	72 3e                	jb     80275b <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80271d:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802721:	74 1f                	je     802742 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802723:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802727:	74 bd                	je     8026e6 <fread+0x4b>
+  802729:	89 f0                	mov    %esi,%eax
+  80272b:	e8 2f fb ff ff       	call   80225f <stream_drain>
+  802730:	85 c0                	test   %eax,%eax
+  802732:	79 b2                	jns    8026e6 <fread+0x4b>
+  802734:	eb 0c                	jmp    802742 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802736:	c1 fb 1f             	sar    $0x1f,%ebx
+  802739:	83 e3 04             	and    $0x4,%ebx
+  80273c:	83 c3 04             	add    $0x4,%ebx
+  80273f:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802742:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802745:	85 c0                	test   %eax,%eax
+  802747:	74 0a                	je     802753 <fread+0xb8>
+  802749:	89 f8                	mov    %edi,%eax
+  80274b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802750:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802756:	5b                   	pop    %ebx
+  802757:	5e                   	pop    %esi
+  802758:	5f                   	pop    %edi
+  802759:	5d                   	pop    %ebp
+  80275a:	c3                   	ret
+		} else if (!stream_fill(f))
+  80275b:	89 f0                	mov    %esi,%eax
+  80275d:	e8 da fb ff ff       	call   80233c <stream_fill>
+  802762:	85 c0                	test   %eax,%eax
+  802764:	74 dc                	je     802742 <fread+0xa7>
+			m = 0;
+  802766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80276b:	eb 93                	jmp    802700 <fread+0x65>
+
+0080276d <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80276d:	55                   	push   %ebp
+  80276e:	89 e5                	mov    %esp,%ebp
+  802770:	57                   	push   %edi
+  802771:	56                   	push   %esi
+  802772:	53                   	push   %ebx
+  802773:	83 ec 1c             	sub    $0x1c,%esp
+  802776:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802779:	8b 43 04             	mov    0x4(%ebx),%eax
+  80277c:	a8 02                	test   $0x2,%al
+  80277e:	75 13                	jne    802793 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802780:	83 c8 08             	or     $0x8,%eax
+  802783:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802786:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80278b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80278e:	5b                   	pop    %ebx
+  80278f:	5e                   	pop    %esi
+  802790:	5f                   	pop    %edi
+  802791:	5d                   	pop    %ebp
+  802792:	c3                   	ret
+	stream_setup(f);
+  802793:	89 d8                	mov    %ebx,%eax
+  802795:	e8 35 fb ff ff       	call   8022cf <stream_setup>
+	want = size * n;
+  80279a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80279d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8027a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8027a4:	89 d8                	mov    %ebx,%eax
+  8027a6:	e8 41 fa ff ff       	call   8021ec <stream_unread>
+	for (done = 0; done < want; ) {
+  8027ab:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8027b0:	84 c0                	test   %al,%al
+  8027b2:	75 7b                	jne    80282f <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8027b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8027bc:	39 fe                	cmp    %edi,%esi
+  8027be:	73 24                	jae    8027e4 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8027c0:	83 ec 04             	sub    $0x4,%esp
+  8027c3:	89 f8                	mov    %edi,%eax
+  8027c5:	29 f0                	sub    %esi,%eax
+  8027c7:	50                   	push   %eax
+  8027c8:	89 f0                	mov    %esi,%eax
+  8027ca:	03 45 08             	add    0x8(%ebp),%eax
+  8027cd:	50                   	push   %eax
+  8027ce:	ff 33                	push   (%ebx)
+  8027d0:	e8 8c ee ff ff       	call   801661 <write>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	7e 04                	jle    8027e0 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8027dc:	01 c6                	add    %eax,%esi
+  8027de:	eb dc                	jmp    8027bc <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8027e0:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8027e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	74 a0                	je     80278b <fwrite+0x1e>
+  8027eb:	89 f0                	mov    %esi,%eax
+  8027ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f2:	f7 75 0c             	divl   0xc(%ebp)
+  8027f5:	eb 94                	jmp    80278b <fwrite+0x1e>
+			done += r;
+  8027f7:	01 c7                	add    %eax,%edi
+			continue;
+  8027f9:	eb 34                	jmp    80282f <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8027fb:	8b 73 10             	mov    0x10(%ebx),%esi
+  8027fe:	29 c6                	sub    %eax,%esi
+  802800:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802803:	29 fa                	sub    %edi,%edx
+  802805:	39 d6                	cmp    %edx,%esi
+  802807:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80280a:	83 ec 04             	sub    $0x4,%esp
+  80280d:	56                   	push   %esi
+  80280e:	89 fa                	mov    %edi,%edx
+  802810:	03 55 08             	add    0x8(%ebp),%edx
+  802813:	52                   	push   %edx
+  802814:	03 43 0c             	add    0xc(%ebx),%eax
+  802817:	50                   	push   %eax
+  802818:	e8 96 e1 ff ff       	call   8009b3 <memmove>
+		f->f_wend += m;
+  80281d:	89 f0                	mov    %esi,%eax
+  80281f:	03 43 1c             	add    0x1c(%ebx),%eax
+  802822:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802825:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80282d:	74 5b                	je     80288a <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  80282f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802832:	39 c7                	cmp    %eax,%edi
+  802834:	73 2d                	jae    802863 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802836:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	75 be                	jne    8027fb <fwrite+0x8e>
+  80283d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802840:	29 fa                	sub    %edi,%edx
+  802842:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802845:	72 b4                	jb     8027fb <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802847:	83 ec 04             	sub    $0x4,%esp
+  80284a:	52                   	push   %edx
+  80284b:	89 f8                	mov    %edi,%eax
+  80284d:	03 45 08             	add    0x8(%ebp),%eax
+  802850:	50                   	push   %eax
+  802851:	ff 33                	push   (%ebx)
+  802853:	e8 09 ee ff ff       	call   801661 <write>
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	85 c0                	test   %eax,%eax
+  80285d:	7f 98                	jg     8027f7 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80285f:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802863:	8b 43 08             	mov    0x8(%ebx),%eax
+  802866:	83 f8 03             	cmp    $0x3,%eax
+  802869:	74 48                	je     8028b3 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80286b:	83 f8 02             	cmp    $0x2,%eax
+  80286e:	74 27                	je     802897 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802870:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802873:	85 c0                	test   %eax,%eax
+  802875:	0f 84 10 ff ff ff    	je     80278b <fwrite+0x1e>
+  80287b:	89 f8                	mov    %edi,%eax
+  80287d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802882:	f7 75 0c             	divl   0xc(%ebp)
+  802885:	e9 01 ff ff ff       	jmp    80278b <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80288a:	89 d8                	mov    %ebx,%eax
+  80288c:	e8 ce f9 ff ff       	call   80225f <stream_drain>
+  802891:	85 c0                	test   %eax,%eax
+  802893:	79 9a                	jns    80282f <fwrite+0xc2>
+  802895:	eb cc                	jmp    802863 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802897:	83 ec 04             	sub    $0x4,%esp
+  80289a:	57                   	push   %edi
+  80289b:	6a 0a                	push   $0xa
+  80289d:	ff 75 08             	push   0x8(%ebp)
+  8028a0:	e8 bf e1 ff ff       	call   800a64 <memfind>
+  8028a5:	89 c2                	mov    %eax,%edx
+  8028a7:	89 f8                	mov    %edi,%eax
+  8028a9:	03 45 08             	add    0x8(%ebp),%eax
+  8028ac:	83 c4 10             	add    $0x10,%esp
+  8028af:	39 c2                	cmp    %eax,%edx
+  8028b1:	74 bd                	je     802870 <fwrite+0x103>
+		stream_drain(f);
+  8028b3:	89 d8                	mov    %ebx,%eax
+  8028b5:	e8 a5 f9 ff ff       	call   80225f <stream_drain>
+  8028ba:	eb b4                	jmp    802870 <fwrite+0x103>
+
+008028bc <fputc>:
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	53                   	push   %ebx
+  8028c0:	83 ec 14             	sub    $0x14,%esp
+  8028c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8028c6:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8028c9:	ff 75 0c             	push   0xc(%ebp)
+  8028cc:	6a 01                	push   $0x1
+  8028ce:	6a 01                	push   $0x1
+  8028d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028d3:	50                   	push   %eax
+  8028d4:	e8 94 fe ff ff       	call   80276d <fwrite>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	0f b6 db             	movzbl %bl,%ebx
+  8028df:	83 f8 01             	cmp    $0x1,%eax
+  8028e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8028e7:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8028ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ed:	c9                   	leave
+  8028ee:	c3                   	ret
+
+008028ef <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8028f5:	ff 75 0c             	push   0xc(%ebp)
+  8028f8:	ff 75 08             	push   0x8(%ebp)
+  8028fb:	e8 bc ff ff ff       	call   8028bc <fputc>
+}
+  802900:	83 c4 10             	add    $0x10,%esp
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+
+00802905 <fputs>:
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	56                   	push   %esi
+  802909:	53                   	push   %ebx
+  80290a:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80290d:	83 ec 0c             	sub    $0xc,%esp
+  802910:	56                   	push   %esi
+  802911:	e8 dc de ff ff       	call   8007f2 <strlen>
+  802916:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802918:	ff 75 0c             	push   0xc(%ebp)
+  80291b:	50                   	push   %eax
+  80291c:	6a 01                	push   $0x1
+  80291e:	56                   	push   %esi
+  80291f:	e8 49 fe ff ff       	call   80276d <fwrite>
+  802924:	83 c4 20             	add    $0x20,%esp
+  802927:	39 d8                	cmp    %ebx,%eax
+  802929:	0f 95 c0             	setne  %al
+  80292c:	0f b6 c0             	movzbl %al,%eax
+  80292f:	f7 d8                	neg    %eax
+}
+  802931:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802934:	5b                   	pop    %ebx
+  802935:	5e                   	pop    %esi
+  802936:	5d                   	pop    %ebp
+  802937:	c3                   	ret
+
+00802938 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802938:	55                   	push   %ebp
+  802939:	89 e5                	mov    %esp,%ebp
+  80293b:	53                   	push   %ebx
+  80293c:	83 ec 04             	sub    $0x4,%esp
+  80293f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802942:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802945:	50                   	push   %eax
+  802946:	ff 75 0c             	push   0xc(%ebp)
+  802949:	53                   	push   %ebx
+  80294a:	68 ef 28 80 00       	push   $0x8028ef
+  80294f:	e8 ec d9 ff ff       	call   800340 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802954:	8b 43 04             	mov    0x4(%ebx),%eax
+  802957:	c1 e0 1c             	shl    $0x1c,%eax
+  80295a:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80295d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+00802962 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802968:	68 b8 4e 80 00       	push   $0x804eb8
+  80296d:	ff 75 0c             	push   0xc(%ebp)
+  802970:	e8 b8 de ff ff       	call   80082d <strcpy>
+	return 0;
+}
+  802975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+
+0080297c <devsock_close>:
+{
+  80297c:	55                   	push   %ebp
+  80297d:	89 e5                	mov    %esp,%ebp
+  80297f:	53                   	push   %ebx
+  802980:	83 ec 10             	sub    $0x10,%esp
+  802983:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802986:	53                   	push   %ebx
+  802987:	e8 69 1d 00 00       	call   8046f5 <pageref>
+  80298c:	89 c2                	mov    %eax,%edx
+  80298e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802991:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802996:	83 fa 01             	cmp    $0x1,%edx
+  802999:	74 05                	je     8029a0 <devsock_close+0x24>
+}
+  80299b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8029a0:	83 ec 0c             	sub    $0xc,%esp
+  8029a3:	ff 73 0c             	push   0xc(%ebx)
+  8029a6:	e8 b7 02 00 00       	call   802c62 <nsipc_close>
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  8029ae:	eb eb                	jmp    80299b <devsock_close+0x1f>
+
+008029b0 <devsock_write>:
+{
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	ff 75 10             	push   0x10(%ebp)
+  8029bb:	ff 75 0c             	push   0xc(%ebp)
+  8029be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c1:	ff 70 0c             	push   0xc(%eax)
+  8029c4:	e8 79 03 00 00       	call   802d42 <nsipc_send>
+}
+  8029c9:	c9                   	leave
+  8029ca:	c3                   	ret
+
+008029cb <devsock_read>:
+{
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8029d1:	6a 00                	push   $0x0
+  8029d3:	ff 75 10             	push   0x10(%ebp)
+  8029d6:	ff 75 0c             	push   0xc(%ebp)
+  8029d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029dc:	ff 70 0c             	push   0xc(%eax)
+  8029df:	e8 ef 02 00 00       	call   802cd3 <nsipc_recv>
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+008029e6 <fd2sockid>:
+{
+  8029e6:	55                   	push   %ebp
+  8029e7:	89 e5                	mov    %esp,%ebp
+  8029e9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8029ec:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029ef:	52                   	push   %edx
+  8029f0:	50                   	push   %eax
+  8029f1:	e8 e3 e8 ff ff       	call   8012d9 <fd_lookup>
+  8029f6:	83 c4 10             	add    $0x10,%esp
+  8029f9:	85 c0                	test   %eax,%eax
+  8029fb:	78 10                	js     802a0d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8029fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a00:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802a06:	39 08                	cmp    %ecx,(%eax)
+  802a08:	75 05                	jne    802a0f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a0a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a0f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a14:	eb f7                	jmp    802a0d <fd2sockid+0x27>
+
+00802a16 <alloc_sockfd>:
+{
+  802a16:	55                   	push   %ebp
+  802a17:	89 e5                	mov    %esp,%ebp
+  802a19:	56                   	push   %esi
+  802a1a:	53                   	push   %ebx
+  802a1b:	83 ec 1c             	sub    $0x1c,%esp
+  802a1e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a23:	50                   	push   %eax
+  802a24:	e8 5a e8 ff ff       	call   801283 <fd_alloc>
+  802a29:	89 c3                	mov    %eax,%ebx
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	78 43                	js     802a75 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a32:	83 ec 04             	sub    $0x4,%esp
+  802a35:	68 07 04 00 00       	push   $0x407
+  802a3a:	ff 75 f4             	push   -0xc(%ebp)
+  802a3d:	6a 00                	push   $0x0
+  802a3f:	e8 27 e2 ff ff       	call   800c6b <sys_page_alloc>
+  802a44:	89 c3                	mov    %eax,%ebx
+  802a46:	83 c4 10             	add    $0x10,%esp
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	78 28                	js     802a75 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a50:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802a56:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a62:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a65:	83 ec 0c             	sub    $0xc,%esp
+  802a68:	50                   	push   %eax
+  802a69:	e8 ee e7 ff ff       	call   80125c <fd2num>
+  802a6e:	89 c3                	mov    %eax,%ebx
+  802a70:	83 c4 10             	add    $0x10,%esp
+  802a73:	eb 0c                	jmp    802a81 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a75:	83 ec 0c             	sub    $0xc,%esp
+  802a78:	56                   	push   %esi
+  802a79:	e8 e4 01 00 00       	call   802c62 <nsipc_close>
+		return r;
+  802a7e:	83 c4 10             	add    $0x10,%esp
+}
+  802a81:	89 d8                	mov    %ebx,%eax
+  802a83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a86:	5b                   	pop    %ebx
+  802a87:	5e                   	pop    %esi
+  802a88:	5d                   	pop    %ebp
+  802a89:	c3                   	ret
+
+00802a8a <accept>:
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a93:	e8 4e ff ff ff       	call   8029e6 <fd2sockid>
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	78 1b                	js     802ab7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a9c:	83 ec 04             	sub    $0x4,%esp
+  802a9f:	ff 75 10             	push   0x10(%ebp)
+  802aa2:	ff 75 0c             	push   0xc(%ebp)
+  802aa5:	50                   	push   %eax
+  802aa6:	e8 0e 01 00 00       	call   802bb9 <nsipc_accept>
+  802aab:	83 c4 10             	add    $0x10,%esp
+  802aae:	85 c0                	test   %eax,%eax
+  802ab0:	78 05                	js     802ab7 <accept+0x2d>
+	return alloc_sockfd(r);
+  802ab2:	e8 5f ff ff ff       	call   802a16 <alloc_sockfd>
+}
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+00802ab9 <bind>:
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac2:	e8 1f ff ff ff       	call   8029e6 <fd2sockid>
+  802ac7:	85 c0                	test   %eax,%eax
+  802ac9:	78 12                	js     802add <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802acb:	83 ec 04             	sub    $0x4,%esp
+  802ace:	ff 75 10             	push   0x10(%ebp)
+  802ad1:	ff 75 0c             	push   0xc(%ebp)
+  802ad4:	50                   	push   %eax
+  802ad5:	e8 31 01 00 00       	call   802c0b <nsipc_bind>
+  802ada:	83 c4 10             	add    $0x10,%esp
+}
+  802add:	c9                   	leave
+  802ade:	c3                   	ret
+
+00802adf <shutdown>:
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae8:	e8 f9 fe ff ff       	call   8029e6 <fd2sockid>
+  802aed:	85 c0                	test   %eax,%eax
+  802aef:	78 0f                	js     802b00 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802af1:	83 ec 08             	sub    $0x8,%esp
+  802af4:	ff 75 0c             	push   0xc(%ebp)
+  802af7:	50                   	push   %eax
+  802af8:	e8 43 01 00 00       	call   802c40 <nsipc_shutdown>
+  802afd:	83 c4 10             	add    $0x10,%esp
+}
+  802b00:	c9                   	leave
+  802b01:	c3                   	ret
+
+00802b02 <connect>:
+{
+  802b02:	55                   	push   %ebp
+  802b03:	89 e5                	mov    %esp,%ebp
+  802b05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0b:	e8 d6 fe ff ff       	call   8029e6 <fd2sockid>
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	78 12                	js     802b26 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b14:	83 ec 04             	sub    $0x4,%esp
+  802b17:	ff 75 10             	push   0x10(%ebp)
+  802b1a:	ff 75 0c             	push   0xc(%ebp)
+  802b1d:	50                   	push   %eax
+  802b1e:	e8 59 01 00 00       	call   802c7c <nsipc_connect>
+  802b23:	83 c4 10             	add    $0x10,%esp
+}
+  802b26:	c9                   	leave
+  802b27:	c3                   	ret
+
+00802b28 <listen>:
+{
+  802b28:	55                   	push   %ebp
+  802b29:	89 e5                	mov    %esp,%ebp
+  802b2b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b31:	e8 b0 fe ff ff       	call   8029e6 <fd2sockid>
+  802b36:	85 c0                	test   %eax,%eax
+  802b38:	78 0f                	js     802b49 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b3a:	83 ec 08             	sub    $0x8,%esp
+  802b3d:	ff 75 0c             	push   0xc(%ebp)
+  802b40:	50                   	push   %eax
+  802b41:	e8 6b 01 00 00       	call   802cb1 <nsipc_listen>
+  802b46:	83 c4 10             	add    $0x10,%esp
+}
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+
+00802b4b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b4b:	55                   	push   %ebp
+  802b4c:	89 e5                	mov    %esp,%ebp
+  802b4e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b51:	ff 75 10             	push   0x10(%ebp)
+  802b54:	ff 75 0c             	push   0xc(%ebp)
+  802b57:	ff 75 08             	push   0x8(%ebp)
+  802b5a:	e8 41 02 00 00       	call   802da0 <nsipc_socket>
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	78 05                	js     802b6b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b66:	e8 ab fe ff ff       	call   802a16 <alloc_sockfd>
+}
+  802b6b:	c9                   	leave
+  802b6c:	c3                   	ret
+
+00802b6d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b6d:	55                   	push   %ebp
+  802b6e:	89 e5                	mov    %esp,%ebp
+  802b70:	53                   	push   %ebx
+  802b71:	83 ec 04             	sub    $0x4,%esp
+  802b74:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b76:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802b7d:	74 26                	je     802ba5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b7f:	6a 07                	push   $0x7
+  802b81:	68 00 90 80 00       	push   $0x809000
+  802b86:	53                   	push   %ebx
+  802b87:	ff 35 08 70 80 00    	push   0x807008
+  802b8d:	e8 ce 1a 00 00       	call   804660 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b92:	83 c4 0c             	add    $0xc,%esp
+  802b95:	6a 00                	push   $0x0
+  802b97:	6a 00                	push   $0x0
+  802b99:	6a 00                	push   $0x0
+  802b9b:	e8 ca 19 00 00       	call   80456a <ipc_recv>
+}
+  802ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ba5:	83 ec 0c             	sub    $0xc,%esp
+  802ba8:	6a 02                	push   $0x2
+  802baa:	e8 07 1b 00 00       	call   8046b6 <ipc_find_env>
+  802baf:	a3 08 70 80 00       	mov    %eax,0x807008
+  802bb4:	83 c4 10             	add    $0x10,%esp
+  802bb7:	eb c6                	jmp    802b7f <nsipc+0x12>
+
+00802bb9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	56                   	push   %esi
+  802bbd:	53                   	push   %ebx
+  802bbe:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802bc9:	8b 06                	mov    (%esi),%eax
+  802bcb:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd5:	e8 93 ff ff ff       	call   802b6d <nsipc>
+  802bda:	89 c3                	mov    %eax,%ebx
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	79 09                	jns    802be9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802be0:	89 d8                	mov    %ebx,%eax
+  802be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be5:	5b                   	pop    %ebx
+  802be6:	5e                   	pop    %esi
+  802be7:	5d                   	pop    %ebp
+  802be8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802be9:	83 ec 04             	sub    $0x4,%esp
+  802bec:	ff 35 10 90 80 00    	push   0x809010
+  802bf2:	68 00 90 80 00       	push   $0x809000
+  802bf7:	ff 75 0c             	push   0xc(%ebp)
+  802bfa:	e8 b4 dd ff ff       	call   8009b3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802bff:	a1 10 90 80 00       	mov    0x809010,%eax
+  802c04:	89 06                	mov    %eax,(%esi)
+  802c06:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c09:	eb d5                	jmp    802be0 <nsipc_accept+0x27>
+
+00802c0b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	53                   	push   %ebx
+  802c0f:	83 ec 08             	sub    $0x8,%esp
+  802c12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c18:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c1d:	53                   	push   %ebx
+  802c1e:	ff 75 0c             	push   0xc(%ebp)
+  802c21:	68 04 90 80 00       	push   $0x809004
+  802c26:	e8 88 dd ff ff       	call   8009b3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c2b:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802c31:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c36:	e8 32 ff ff ff       	call   802b6d <nsipc>
+}
+  802c3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3e:	c9                   	leave
+  802c3f:	c3                   	ret
+
+00802c40 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c40:	55                   	push   %ebp
+  802c41:	89 e5                	mov    %esp,%ebp
+  802c43:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c49:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802c4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c51:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c56:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c5b:	e8 0d ff ff ff       	call   802b6d <nsipc>
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6b:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802c70:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c75:	e8 f3 fe ff ff       	call   802b6d <nsipc>
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	53                   	push   %ebx
+  802c80:	83 ec 08             	sub    $0x8,%esp
+  802c83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c89:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c8e:	53                   	push   %ebx
+  802c8f:	ff 75 0c             	push   0xc(%ebp)
+  802c92:	68 04 90 80 00       	push   $0x809004
+  802c97:	e8 17 dd ff ff       	call   8009b3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c9c:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802ca2:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ca7:	e8 c1 fe ff ff       	call   802b6d <nsipc>
+}
+  802cac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802caf:	c9                   	leave
+  802cb0:	c3                   	ret
+
+00802cb1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802cb1:	55                   	push   %ebp
+  802cb2:	89 e5                	mov    %esp,%ebp
+  802cb4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cba:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cbf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc2:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802cc7:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ccc:	e8 9c fe ff ff       	call   802b6d <nsipc>
+}
+  802cd1:	c9                   	leave
+  802cd2:	c3                   	ret
+
+00802cd3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cd3:	55                   	push   %ebp
+  802cd4:	89 e5                	mov    %esp,%ebp
+  802cd6:	56                   	push   %esi
+  802cd7:	53                   	push   %ebx
+  802cd8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cde:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802ce3:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802ce9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cec:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802cf1:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cf6:	e8 72 fe ff ff       	call   802b6d <nsipc>
+  802cfb:	89 c3                	mov    %eax,%ebx
+  802cfd:	85 c0                	test   %eax,%eax
+  802cff:	78 22                	js     802d23 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d01:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d06:	39 c6                	cmp    %eax,%esi
+  802d08:	0f 4e c6             	cmovle %esi,%eax
+  802d0b:	39 c3                	cmp    %eax,%ebx
+  802d0d:	7f 1d                	jg     802d2c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d0f:	83 ec 04             	sub    $0x4,%esp
+  802d12:	53                   	push   %ebx
+  802d13:	68 00 90 80 00       	push   $0x809000
+  802d18:	ff 75 0c             	push   0xc(%ebp)
+  802d1b:	e8 93 dc ff ff       	call   8009b3 <memmove>
+  802d20:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d23:	89 d8                	mov    %ebx,%eax
+  802d25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d28:	5b                   	pop    %ebx
+  802d29:	5e                   	pop    %esi
+  802d2a:	5d                   	pop    %ebp
+  802d2b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d2c:	68 c4 4e 80 00       	push   $0x804ec4
+  802d31:	68 7d 4e 80 00       	push   $0x804e7d
+  802d36:	6a 62                	push   $0x62
+  802d38:	68 d9 4e 80 00       	push   $0x804ed9
+  802d3d:	e8 6c 11 00 00       	call   803eae <_panic>
+
+00802d42 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d42:	55                   	push   %ebp
+  802d43:	89 e5                	mov    %esp,%ebp
+  802d45:	53                   	push   %ebx
+  802d46:	83 ec 04             	sub    $0x4,%esp
+  802d49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4f:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802d54:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d5a:	7f 2e                	jg     802d8a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d5c:	83 ec 04             	sub    $0x4,%esp
+  802d5f:	53                   	push   %ebx
+  802d60:	ff 75 0c             	push   0xc(%ebp)
+  802d63:	68 0c 90 80 00       	push   $0x80900c
+  802d68:	e8 46 dc ff ff       	call   8009b3 <memmove>
+	nsipcbuf.send.req_size = size;
+  802d6d:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802d73:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d76:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802d7b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d80:	e8 e8 fd ff ff       	call   802b6d <nsipc>
+}
+  802d85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+	assert(size < 1600);
+  802d8a:	68 e5 4e 80 00       	push   $0x804ee5
+  802d8f:	68 7d 4e 80 00       	push   $0x804e7d
+  802d94:	6a 6d                	push   $0x6d
+  802d96:	68 d9 4e 80 00       	push   $0x804ed9
+  802d9b:	e8 0e 11 00 00       	call   803eae <_panic>
+
+00802da0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802da0:	55                   	push   %ebp
+  802da1:	89 e5                	mov    %esp,%ebp
+  802da3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802dae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802db1:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802db6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802db9:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802dbe:	b8 09 00 00 00       	mov    $0x9,%eax
+  802dc3:	e8 a5 fd ff ff       	call   802b6d <nsipc>
+}
+  802dc8:	c9                   	leave
+  802dc9:	c3                   	ret
+
+00802dca <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802dca:	55                   	push   %ebp
+  802dcb:	89 e5                	mov    %esp,%ebp
+  802dcd:	53                   	push   %ebx
+  802dce:	83 ec 10             	sub    $0x10,%esp
+  802dd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802dd4:	68 0c 70 80 00       	push   $0x80700c
+  802dd9:	e8 50 07 00 00       	call   80352e <mutex_lock>
+	if (v == 0)
+  802dde:	83 c4 10             	add    $0x10,%esp
+  802de1:	85 db                	test   %ebx,%ebx
+  802de3:	0f 84 85 00 00 00    	je     802e6e <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802de9:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802def:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802df4:	77 51                	ja     802e47 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802df6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802dfc:	89 d8                	mov    %ebx,%eax
+  802dfe:	c1 e8 0c             	shr    $0xc,%eax
+  802e01:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802e08:	f6 c4 02             	test   $0x2,%ah
+  802e0b:	74 50                	je     802e5d <free+0x93>
+		sys_page_unmap(0, c);
+  802e0d:	83 ec 08             	sub    $0x8,%esp
+  802e10:	53                   	push   %ebx
+  802e11:	6a 00                	push   $0x0
+  802e13:	e8 ec de ff ff       	call   800d04 <sys_page_unmap>
+		c += PGSIZE;
+  802e18:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802e1e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802e24:	83 c4 10             	add    $0x10,%esp
+  802e27:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802e2c:	76 ce                	jbe    802dfc <free+0x32>
+  802e2e:	68 2f 4f 80 00       	push   $0x804f2f
+  802e33:	68 7d 4e 80 00       	push   $0x804e7d
+  802e38:	68 82 00 00 00       	push   $0x82
+  802e3d:	68 22 4f 80 00       	push   $0x804f22
+  802e42:	e8 67 10 00 00       	call   803eae <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802e47:	68 f4 4e 80 00       	push   $0x804ef4
+  802e4c:	68 7d 4e 80 00       	push   $0x804e7d
+  802e51:	6a 7b                	push   $0x7b
+  802e53:	68 22 4f 80 00       	push   $0x804f22
+  802e58:	e8 51 10 00 00       	call   803eae <_panic>
+	if (--(*ref) == 0)
+  802e5d:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802e63:	83 e8 01             	sub    $0x1,%eax
+  802e66:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802e6c:	74 15                	je     802e83 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802e6e:	83 ec 0c             	sub    $0xc,%esp
+  802e71:	68 0c 70 80 00       	push   $0x80700c
+  802e76:	e8 20 07 00 00       	call   80359b <mutex_unlock>
+}
+  802e7b:	83 c4 10             	add    $0x10,%esp
+  802e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e81:	c9                   	leave
+  802e82:	c3                   	ret
+		sys_page_unmap(0, c);
+  802e83:	83 ec 08             	sub    $0x8,%esp
+  802e86:	53                   	push   %ebx
+  802e87:	6a 00                	push   $0x0
+  802e89:	e8 76 de ff ff       	call   800d04 <sys_page_unmap>
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	eb db                	jmp    802e6e <free+0xa4>
+
+00802e93 <malloc>:
+{
+  802e93:	55                   	push   %ebp
+  802e94:	89 e5                	mov    %esp,%ebp
+  802e96:	57                   	push   %edi
+  802e97:	56                   	push   %esi
+  802e98:	53                   	push   %ebx
+  802e99:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802e9c:	68 0c 70 80 00       	push   $0x80700c
+  802ea1:	e8 88 06 00 00       	call   80352e <mutex_lock>
+	if (mptr == 0)
+  802ea6:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802eac:	83 c4 10             	add    $0x10,%esp
+  802eaf:	85 ff                	test   %edi,%edi
+  802eb1:	74 6c                	je     802f1f <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb6:	83 c0 03             	add    $0x3,%eax
+  802eb9:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ebc:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ebe:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ec3:	0f 87 64 01 00 00    	ja     80302d <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802ec9:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802ecf:	74 30                	je     802f01 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802ed1:	89 f9                	mov    %edi,%ecx
+  802ed3:	c1 e9 0c             	shr    $0xc,%ecx
+  802ed6:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802eda:	c1 e8 0c             	shr    $0xc,%eax
+  802edd:	39 c1                	cmp    %eax,%ecx
+  802edf:	74 5f                	je     802f40 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802ee1:	83 ec 0c             	sub    $0xc,%esp
+  802ee4:	57                   	push   %edi
+  802ee5:	e8 e0 fe ff ff       	call   802dca <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802eea:	a1 10 70 80 00       	mov    0x807010,%eax
+  802eef:	05 00 10 00 00       	add    $0x1000,%eax
+  802ef4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ef9:	a3 10 70 80 00       	mov    %eax,0x807010
+  802efe:	83 c4 10             	add    $0x10,%esp
+  802f01:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802f07:	ba 02 00 00 00       	mov    $0x2,%edx
+  802f0c:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802f10:	8d 7e 04             	lea    0x4(%esi),%edi
+  802f13:	89 cb                	mov    %ecx,%ebx
+  802f15:	01 f9                	add    %edi,%ecx
+  802f17:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802f1a:	e9 8b 00 00 00       	jmp    802faa <malloc+0x117>
+		mptr = mbegin;
+  802f1f:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802f26:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2c:	83 c0 03             	add    $0x3,%eax
+  802f2f:	83 e0 fc             	and    $0xfffffffc,%eax
+  802f32:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802f34:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802f39:	76 c6                	jbe    802f01 <malloc+0x6e>
+  802f3b:	e9 d6 00 00 00       	jmp    803016 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802f40:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f46:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802f4b:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802f4f:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802f52:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802f57:	e9 ba 00 00 00       	jmp    803016 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802f5c:	05 00 10 00 00       	add    $0x1000,%eax
+  802f61:	39 c8                	cmp    %ecx,%eax
+  802f63:	0f 83 cb 00 00 00    	jae    803034 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802f69:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802f6e:	77 22                	ja     802f92 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802f70:	89 c2                	mov    %eax,%edx
+  802f72:	c1 ea 16             	shr    $0x16,%edx
+  802f75:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f7c:	f6 c2 01             	test   $0x1,%dl
+  802f7f:	74 db                	je     802f5c <malloc+0xc9>
+  802f81:	89 c2                	mov    %eax,%edx
+  802f83:	c1 ea 0c             	shr    $0xc,%edx
+  802f86:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802f8d:	f6 c2 01             	test   $0x1,%dl
+  802f90:	74 ca                	je     802f5c <malloc+0xc9>
+		if (mptr == mend) {
+  802f92:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802f98:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802f9e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802fa2:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802fa8:	74 04                	je     802fae <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802faa:	89 d8                	mov    %ebx,%eax
+  802fac:	eb b3                	jmp    802f61 <malloc+0xce>
+  802fae:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802fb1:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802fb6:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802fba:	83 ea 01             	sub    $0x1,%edx
+  802fbd:	0f 85 50 ff ff ff    	jne    802f13 <malloc+0x80>
+  802fc3:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802fca:	00 00 08 
+				return 0;	/* out of address space */
+  802fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd2:	eb 42                	jmp    803016 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802fd4:	85 db                	test   %ebx,%ebx
+  802fd6:	78 1e                	js     802ff6 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802fd8:	83 ec 08             	sub    $0x8,%esp
+  802fdb:	89 d8                	mov    %ebx,%eax
+  802fdd:	03 05 10 70 80 00    	add    0x807010,%eax
+  802fe3:	50                   	push   %eax
+  802fe4:	6a 00                	push   $0x0
+  802fe6:	e8 19 dd ff ff       	call   800d04 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802feb:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ff1:	83 c4 10             	add    $0x10,%esp
+  802ff4:	eb de                	jmp    802fd4 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffb:	eb 19                	jmp    803016 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802ffd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803000:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803006:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80300d:	00 
+	mptr += n;
+  80300e:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803011:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803016:	83 ec 0c             	sub    $0xc,%esp
+  803019:	68 0c 70 80 00       	push   $0x80700c
+  80301e:	e8 78 05 00 00       	call   80359b <mutex_unlock>
+}
+  803023:	89 f8                	mov    %edi,%eax
+  803025:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803028:	5b                   	pop    %ebx
+  803029:	5e                   	pop    %esi
+  80302a:	5f                   	pop    %edi
+  80302b:	5d                   	pop    %ebp
+  80302c:	c3                   	ret
+		return 0;
+  80302d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803032:	eb e2                	jmp    803016 <malloc+0x183>
+  803034:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803038:	74 06                	je     803040 <malloc+0x1ad>
+  80303a:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803045:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803048:	39 fb                	cmp    %edi,%ebx
+  80304a:	73 b1                	jae    802ffd <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80304c:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803052:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803055:	39 fe                	cmp    %edi,%esi
+  803057:	0f 92 c0             	setb   %al
+  80305a:	0f b6 c0             	movzbl %al,%eax
+  80305d:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803060:	83 c8 07             	or     $0x7,%eax
+  803063:	50                   	push   %eax
+  803064:	89 d8                	mov    %ebx,%eax
+  803066:	03 05 10 70 80 00    	add    0x807010,%eax
+  80306c:	50                   	push   %eax
+  80306d:	6a 00                	push   $0x0
+  80306f:	e8 f7 db ff ff       	call   800c6b <sys_page_alloc>
+  803074:	83 c4 10             	add    $0x10,%esp
+  803077:	85 c0                	test   %eax,%eax
+  803079:	0f 88 55 ff ff ff    	js     802fd4 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80307f:	89 f3                	mov    %esi,%ebx
+  803081:	eb c5                	jmp    803048 <malloc+0x1b5>
+
+00803083 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803083:	55                   	push   %ebp
+  803084:	89 e5                	mov    %esp,%ebp
+  803086:	56                   	push   %esi
+  803087:	53                   	push   %ebx
+  803088:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80308b:	83 ec 0c             	sub    $0xc,%esp
+  80308e:	ff 75 08             	push   0x8(%ebp)
+  803091:	e8 d6 e1 ff ff       	call   80126c <fd2data>
+  803096:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803098:	83 c4 08             	add    $0x8,%esp
+  80309b:	68 47 4f 80 00       	push   $0x804f47
+  8030a0:	53                   	push   %ebx
+  8030a1:	e8 87 d7 ff ff       	call   80082d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8030a6:	8b 46 04             	mov    0x4(%esi),%eax
+  8030a9:	2b 06                	sub    (%esi),%eax
+  8030ab:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8030b1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030b8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8030bb:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8030c2:	62 80 00 
+	return 0;
+}
+  8030c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030cd:	5b                   	pop    %ebx
+  8030ce:	5e                   	pop    %esi
+  8030cf:	5d                   	pop    %ebp
+  8030d0:	c3                   	ret
+
+008030d1 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8030d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030d6:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8030da:	85 c9                	test   %ecx,%ecx
+  8030dc:	75 01                	jne    8030df <pipewake+0xe>
+  8030de:	c3                   	ret
+{
+  8030df:	55                   	push   %ebp
+  8030e0:	89 e5                	mov    %esp,%ebp
+  8030e2:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8030e5:	68 00 04 00 00       	push   $0x400
+  8030ea:	52                   	push   %edx
+  8030eb:	e8 bf de ff ff       	call   800faf <sys_futex_wake>
+  8030f0:	83 c4 10             	add    $0x10,%esp
+}
+  8030f3:	c9                   	leave
+  8030f4:	c3                   	ret
+
+008030f5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8030f5:	55                   	push   %ebp
+  8030f6:	89 e5                	mov    %esp,%ebp
+  8030f8:	56                   	push   %esi
+  8030f9:	53                   	push   %ebx
+  8030fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030fd:	83 ec 0c             	sub    $0xc,%esp
+  803100:	56                   	push   %esi
+  803101:	e8 66 e1 ff ff       	call   80126c <fd2data>
+  803106:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803108:	83 c4 08             	add    $0x8,%esp
+  80310b:	56                   	push   %esi
+  80310c:	6a 00                	push   $0x0
+  80310e:	e8 f1 db ff ff       	call   800d04 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803113:	8d 53 04             	lea    0x4(%ebx),%edx
+  803116:	8d 43 08             	lea    0x8(%ebx),%eax
+  803119:	e8 b3 ff ff ff       	call   8030d1 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80311e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803121:	89 da                	mov    %ebx,%edx
+  803123:	e8 a9 ff ff ff       	call   8030d1 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803128:	89 34 24             	mov    %esi,(%esp)
+  80312b:	e8 3c e1 ff ff       	call   80126c <fd2data>
+  803130:	83 c4 08             	add    $0x8,%esp
+  803133:	50                   	push   %eax
+  803134:	6a 00                	push   $0x0
+  803136:	e8 c9 db ff ff       	call   800d04 <sys_page_unmap>
+}
+  80313b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80313e:	5b                   	pop    %ebx
+  80313f:	5e                   	pop    %esi
+  803140:	5d                   	pop    %ebp
+  803141:	c3                   	ret
+
+00803142 <_pipeisclosed>:
+{
+  803142:	55                   	push   %ebp
+  803143:	89 e5                	mov    %esp,%ebp
+  803145:	57                   	push   %edi
+  803146:	56                   	push   %esi
+  803147:	53                   	push   %ebx
+  803148:	83 ec 1c             	sub    $0x1c,%esp
+  80314b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80314e:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803150:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803155:	eb 5d                	jmp    8031b4 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803157:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  80315d:	8b 02                	mov    (%edx),%eax
+  80315f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803162:	83 ec 0c             	sub    $0xc,%esp
+  803165:	ff 75 e0             	push   -0x20(%ebp)
+  803168:	e8 88 15 00 00       	call   8046f5 <pageref>
+  80316d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803170:	89 3c 24             	mov    %edi,(%esp)
+  803173:	e8 7d 15 00 00       	call   8046f5 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803178:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80317a:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803180:	83 c4 10             	add    $0x10,%esp
+  803183:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803189:	77 15                	ja     8031a0 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80318b:	89 f2                	mov    %esi,%edx
+  80318d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80318f:	c1 ea 10             	shr    $0x10,%edx
+  803192:	74 0c                	je     8031a0 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803194:	c1 e2 10             	shl    $0x10,%edx
+  803197:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80319c:	29 d1                	sub    %edx,%ecx
+  80319e:	eb 06                	jmp    8031a6 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8031a0:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  8031a6:	8b 11                	mov    (%ecx),%edx
+  8031a8:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8031ab:	39 d3                	cmp    %edx,%ebx
+  8031ad:	74 6e                	je     80321d <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8031af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8031b2:	74 24                	je     8031d8 <_pipeisclosed+0x96>
+  8031b4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8031b6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8031bc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8031c1:	77 94                	ja     803157 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8031c3:	89 f0                	mov    %esi,%eax
+  8031c5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8031c7:	c1 e8 10             	shr    $0x10,%eax
+  8031ca:	74 8b                	je     803157 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8031cc:	c1 e0 10             	shl    $0x10,%eax
+  8031cf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8031d4:	29 c2                	sub    %eax,%edx
+  8031d6:	eb 85                	jmp    80315d <_pipeisclosed+0x1b>
+  8031d8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8031da:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8031e0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8031e5:	77 18                	ja     8031ff <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8031e7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8031ec:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8031ee:	c1 e8 10             	shr    $0x10,%eax
+  8031f1:	74 0c                	je     8031ff <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8031f3:	c1 e0 10             	shl    $0x10,%eax
+  8031f6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8031fb:	29 c2                	sub    %eax,%edx
+  8031fd:	eb 06                	jmp    803205 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8031ff:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803205:	8b 02                	mov    (%edx),%eax
+  803207:	8b 40 58             	mov    0x58(%eax),%eax
+  80320a:	6a 01                	push   $0x1
+  80320c:	50                   	push   %eax
+  80320d:	53                   	push   %ebx
+  80320e:	68 4e 4f 80 00       	push   $0x804f4e
+  803213:	e8 31 d0 ff ff       	call   800249 <cprintf>
+  803218:	83 c4 10             	add    $0x10,%esp
+  80321b:	eb 97                	jmp    8031b4 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80321d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803220:	0f 94 c0             	sete   %al
+  803223:	0f b6 c0             	movzbl %al,%eax
+}
+  803226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803229:	5b                   	pop    %ebx
+  80322a:	5e                   	pop    %esi
+  80322b:	5f                   	pop    %edi
+  80322c:	5d                   	pop    %ebp
+  80322d:	c3                   	ret
+
+0080322e <devpipe_write>:
+{
+  80322e:	55                   	push   %ebp
+  80322f:	89 e5                	mov    %esp,%ebp
+  803231:	57                   	push   %edi
+  803232:	56                   	push   %esi
+  803233:	53                   	push   %ebx
+  803234:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803237:	ff 75 08             	push   0x8(%ebp)
+  80323a:	e8 2d e0 ff ff       	call   80126c <fd2data>
+  80323f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803241:	83 c4 10             	add    $0x10,%esp
+  803244:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80324b:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80324e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803251:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803254:	0f 84 96 00 00 00    	je     8032f0 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80325a:	8d 73 08             	lea    0x8(%ebx),%esi
+  80325d:	eb 32                	jmp    803291 <devpipe_write+0x63>
+  80325f:	89 fa                	mov    %edi,%edx
+  803261:	89 f0                	mov    %esi,%eax
+  803263:	e8 69 fe ff ff       	call   8030d1 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803268:	8b 43 04             	mov    0x4(%ebx),%eax
+  80326b:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80326e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803273:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803278:	83 ec 04             	sub    $0x4,%esp
+  80327b:	6a 0a                	push   $0xa
+  80327d:	50                   	push   %eax
+  80327e:	53                   	push   %ebx
+  80327f:	e8 fc dc ff ff       	call   800f80 <sys_futex_wait>
+  803284:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803289:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80328e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803291:	8b 43 04             	mov    0x4(%ebx),%eax
+  803294:	8b 0b                	mov    (%ebx),%ecx
+  803296:	8d 51 20             	lea    0x20(%ecx),%edx
+  803299:	39 d0                	cmp    %edx,%eax
+  80329b:	72 1b                	jb     8032b8 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80329d:	89 da                	mov    %ebx,%edx
+  80329f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a2:	e8 9b fe ff ff       	call   803142 <_pipeisclosed>
+  8032a7:	85 c0                	test   %eax,%eax
+  8032a9:	74 b4                	je     80325f <devpipe_write+0x31>
+				return 0;
+  8032ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032b3:	5b                   	pop    %ebx
+  8032b4:	5e                   	pop    %esi
+  8032b5:	5f                   	pop    %edi
+  8032b6:	5d                   	pop    %ebp
+  8032b7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8032b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8032bb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8032be:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8032c2:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8032c5:	89 c2                	mov    %eax,%edx
+  8032c7:	c1 fa 1f             	sar    $0x1f,%edx
+  8032ca:	89 d1                	mov    %edx,%ecx
+  8032cc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8032cf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8032d2:	83 e2 1f             	and    $0x1f,%edx
+  8032d5:	29 ca                	sub    %ecx,%edx
+  8032d7:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8032db:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8032df:	83 c0 01             	add    $0x1,%eax
+  8032e2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8032e5:	83 c6 01             	add    $0x1,%esi
+  8032e8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8032eb:	e9 5e ff ff ff       	jmp    80324e <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8032f0:	8d 53 04             	lea    0x4(%ebx),%edx
+  8032f3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8032f6:	e8 d6 fd ff ff       	call   8030d1 <pipewake>
+	return i;
+  8032fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032fe:	eb b0                	jmp    8032b0 <devpipe_write+0x82>
+
+00803300 <devpipe_read>:
+{
+  803300:	55                   	push   %ebp
+  803301:	89 e5                	mov    %esp,%ebp
+  803303:	57                   	push   %edi
+  803304:	56                   	push   %esi
+  803305:	53                   	push   %ebx
+  803306:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803309:	ff 75 08             	push   0x8(%ebp)
+  80330c:	e8 5b df ff ff       	call   80126c <fd2data>
+  803311:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803313:	83 c4 10             	add    $0x10,%esp
+  803316:	be 00 00 00 00       	mov    $0x0,%esi
+  80331b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80331e:	74 6c                	je     80338c <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803320:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803323:	eb 25                	jmp    80334a <devpipe_read+0x4a>
+  803325:	8b 13                	mov    (%ebx),%edx
+  803327:	b8 01 00 00 00       	mov    $0x1,%eax
+  80332c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803331:	83 ec 04             	sub    $0x4,%esp
+  803334:	6a 0a                	push   $0xa
+  803336:	52                   	push   %edx
+  803337:	57                   	push   %edi
+  803338:	e8 43 dc ff ff       	call   800f80 <sys_futex_wait>
+  80333d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803342:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803347:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80334a:	8b 03                	mov    (%ebx),%eax
+  80334c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80334f:	75 19                	jne    80336a <devpipe_read+0x6a>
+			if (i > 0)
+  803351:	85 f6                	test   %esi,%esi
+  803353:	75 3a                	jne    80338f <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803355:	89 da                	mov    %ebx,%edx
+  803357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335a:	e8 e3 fd ff ff       	call   803142 <_pipeisclosed>
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	74 c2                	je     803325 <devpipe_read+0x25>
+				return 0;
+  803363:	b8 00 00 00 00       	mov    $0x0,%eax
+  803368:	eb 31                	jmp    80339b <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80336a:	89 c1                	mov    %eax,%ecx
+  80336c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80336f:	c1 e9 1b             	shr    $0x1b,%ecx
+  803372:	01 c8                	add    %ecx,%eax
+  803374:	83 e0 1f             	and    $0x1f,%eax
+  803377:	29 c8                	sub    %ecx,%eax
+  803379:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80337e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803381:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803384:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803387:	83 c6 01             	add    $0x1,%esi
+  80338a:	eb 8f                	jmp    80331b <devpipe_read+0x1b>
+out:
+  80338c:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80338f:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803392:	89 da                	mov    %ebx,%edx
+  803394:	e8 38 fd ff ff       	call   8030d1 <pipewake>
+	return i;
+  803399:	89 f0                	mov    %esi,%eax
+}
+  80339b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80339e:	5b                   	pop    %ebx
+  80339f:	5e                   	pop    %esi
+  8033a0:	5f                   	pop    %edi
+  8033a1:	5d                   	pop    %ebp
+  8033a2:	c3                   	ret
+
+008033a3 <pipe>:
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	56                   	push   %esi
+  8033a7:	53                   	push   %ebx
+  8033a8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8033ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033ae:	50                   	push   %eax
+  8033af:	e8 cf de ff ff       	call   801283 <fd_alloc>
+  8033b4:	89 c3                	mov    %eax,%ebx
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	0f 88 23 01 00 00    	js     8034e4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033c1:	83 ec 04             	sub    $0x4,%esp
+  8033c4:	68 07 04 00 00       	push   $0x407
+  8033c9:	ff 75 f4             	push   -0xc(%ebp)
+  8033cc:	6a 00                	push   $0x0
+  8033ce:	e8 98 d8 ff ff       	call   800c6b <sys_page_alloc>
+  8033d3:	89 c3                	mov    %eax,%ebx
+  8033d5:	83 c4 10             	add    $0x10,%esp
+  8033d8:	85 c0                	test   %eax,%eax
+  8033da:	0f 88 04 01 00 00    	js     8034e4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8033e0:	83 ec 0c             	sub    $0xc,%esp
+  8033e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8033e6:	50                   	push   %eax
+  8033e7:	e8 97 de ff ff       	call   801283 <fd_alloc>
+  8033ec:	89 c3                	mov    %eax,%ebx
+  8033ee:	83 c4 10             	add    $0x10,%esp
+  8033f1:	85 c0                	test   %eax,%eax
+  8033f3:	0f 88 db 00 00 00    	js     8034d4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033f9:	83 ec 04             	sub    $0x4,%esp
+  8033fc:	68 07 04 00 00       	push   $0x407
+  803401:	ff 75 f0             	push   -0x10(%ebp)
+  803404:	6a 00                	push   $0x0
+  803406:	e8 60 d8 ff ff       	call   800c6b <sys_page_alloc>
+  80340b:	89 c3                	mov    %eax,%ebx
+  80340d:	83 c4 10             	add    $0x10,%esp
+  803410:	85 c0                	test   %eax,%eax
+  803412:	0f 88 bc 00 00 00    	js     8034d4 <pipe+0x131>
+	va = fd2data(fd0);
+  803418:	83 ec 0c             	sub    $0xc,%esp
+  80341b:	ff 75 f4             	push   -0xc(%ebp)
+  80341e:	e8 49 de ff ff       	call   80126c <fd2data>
+  803423:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803425:	83 c4 0c             	add    $0xc,%esp
+  803428:	68 07 04 00 00       	push   $0x407
+  80342d:	50                   	push   %eax
+  80342e:	6a 00                	push   $0x0
+  803430:	e8 36 d8 ff ff       	call   800c6b <sys_page_alloc>
+  803435:	89 c3                	mov    %eax,%ebx
+  803437:	83 c4 10             	add    $0x10,%esp
+  80343a:	85 c0                	test   %eax,%eax
+  80343c:	0f 88 82 00 00 00    	js     8034c4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803442:	83 ec 0c             	sub    $0xc,%esp
+  803445:	ff 75 f0             	push   -0x10(%ebp)
+  803448:	e8 1f de ff ff       	call   80126c <fd2data>
+  80344d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803454:	50                   	push   %eax
+  803455:	6a 00                	push   $0x0
+  803457:	56                   	push   %esi
+  803458:	6a 00                	push   $0x0
+  80345a:	e8 59 d8 ff ff       	call   800cb8 <sys_page_map>
+  80345f:	89 c3                	mov    %eax,%ebx
+  803461:	83 c4 20             	add    $0x20,%esp
+  803464:	85 c0                	test   %eax,%eax
+  803466:	78 4e                	js     8034b6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803468:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  80346d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803470:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803472:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803475:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80347c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80347f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803481:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803484:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80348b:	83 ec 0c             	sub    $0xc,%esp
+  80348e:	ff 75 f4             	push   -0xc(%ebp)
+  803491:	e8 c6 dd ff ff       	call   80125c <fd2num>
+  803496:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803499:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80349b:	83 c4 04             	add    $0x4,%esp
+  80349e:	ff 75 f0             	push   -0x10(%ebp)
+  8034a1:	e8 b6 dd ff ff       	call   80125c <fd2num>
+  8034a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034a9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034b4:	eb 2e                	jmp    8034e4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8034b6:	83 ec 08             	sub    $0x8,%esp
+  8034b9:	56                   	push   %esi
+  8034ba:	6a 00                	push   $0x0
+  8034bc:	e8 43 d8 ff ff       	call   800d04 <sys_page_unmap>
+  8034c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8034c4:	83 ec 08             	sub    $0x8,%esp
+  8034c7:	ff 75 f0             	push   -0x10(%ebp)
+  8034ca:	6a 00                	push   $0x0
+  8034cc:	e8 33 d8 ff ff       	call   800d04 <sys_page_unmap>
+  8034d1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8034d4:	83 ec 08             	sub    $0x8,%esp
+  8034d7:	ff 75 f4             	push   -0xc(%ebp)
+  8034da:	6a 00                	push   $0x0
+  8034dc:	e8 23 d8 ff ff       	call   800d04 <sys_page_unmap>
+  8034e1:	83 c4 10             	add    $0x10,%esp
+}
+  8034e4:	89 d8                	mov    %ebx,%eax
+  8034e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034e9:	5b                   	pop    %ebx
+  8034ea:	5e                   	pop    %esi
+  8034eb:	5d                   	pop    %ebp
+  8034ec:	c3                   	ret
+
+008034ed <pipeisclosed>:
+{
+  8034ed:	55                   	push   %ebp
+  8034ee:	89 e5                	mov    %esp,%ebp
+  8034f0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034f6:	50                   	push   %eax
+  8034f7:	ff 75 08             	push   0x8(%ebp)
+  8034fa:	e8 da dd ff ff       	call   8012d9 <fd_lookup>
+  8034ff:	83 c4 10             	add    $0x10,%esp
+  803502:	85 c0                	test   %eax,%eax
+  803504:	78 18                	js     80351e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803506:	83 ec 0c             	sub    $0xc,%esp
+  803509:	ff 75 f4             	push   -0xc(%ebp)
+  80350c:	e8 5b dd ff ff       	call   80126c <fd2data>
+  803511:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803513:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803516:	e8 27 fc ff ff       	call   803142 <_pipeisclosed>
+  80351b:	83 c4 10             	add    $0x10,%esp
+}
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+
+00803520 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803520:	55                   	push   %ebp
+  803521:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803523:	8b 45 08             	mov    0x8(%ebp),%eax
+  803526:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80352c:	5d                   	pop    %ebp
+  80352d:	c3                   	ret
+
+0080352e <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80352e:	55                   	push   %ebp
+  80352f:	89 e5                	mov    %esp,%ebp
+  803531:	56                   	push   %esi
+  803532:	53                   	push   %ebx
+  803533:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803540:	89 d0                	mov    %edx,%eax
+  803542:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803546:	85 c0                	test   %eax,%eax
+  803548:	74 2d                	je     803577 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80354a:	83 f8 02             	cmp    $0x2,%eax
+  80354d:	74 08                	je     803557 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80354f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803554:	f0 87 03             	lock xchg %eax,(%ebx)
+  803557:	be 02 00 00 00       	mov    $0x2,%esi
+  80355c:	eb 15                	jmp    803573 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80355e:	83 ec 04             	sub    $0x4,%esp
+  803561:	6a 00                	push   $0x0
+  803563:	6a 02                	push   $0x2
+  803565:	53                   	push   %ebx
+  803566:	e8 15 da ff ff       	call   800f80 <sys_futex_wait>
+  80356b:	89 f0                	mov    %esi,%eax
+  80356d:	f0 87 03             	lock xchg %eax,(%ebx)
+  803570:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803573:	85 c0                	test   %eax,%eax
+  803575:	75 e7                	jne    80355e <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803577:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80357a:	5b                   	pop    %ebx
+  80357b:	5e                   	pop    %esi
+  80357c:	5d                   	pop    %ebp
+  80357d:	c3                   	ret
+
+0080357e <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80357e:	55                   	push   %ebp
+  80357f:	89 e5                	mov    %esp,%ebp
+  803581:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803584:	b8 00 00 00 00       	mov    $0x0,%eax
+  803589:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80358e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803592:	f7 d8                	neg    %eax
+  803594:	19 c0                	sbb    %eax,%eax
+  803596:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803599:	5d                   	pop    %ebp
+  80359a:	c3                   	ret
+
+0080359b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80359b:	55                   	push   %ebp
+  80359c:	89 e5                	mov    %esp,%ebp
+  80359e:	83 ec 08             	sub    $0x8,%esp
+  8035a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8035ac:	83 f8 02             	cmp    $0x2,%eax
+  8035af:	74 02                	je     8035b3 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8035b1:	c9                   	leave
+  8035b2:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8035b3:	83 ec 08             	sub    $0x8,%esp
+  8035b6:	6a 01                	push   $0x1
+  8035b8:	52                   	push   %edx
+  8035b9:	e8 f1 d9 ff ff       	call   800faf <sys_futex_wake>
+  8035be:	83 c4 10             	add    $0x10,%esp
+}
+  8035c1:	eb ee                	jmp    8035b1 <mutex_unlock+0x16>
+
+008035c3 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8035c3:	55                   	push   %ebp
+  8035c4:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8035c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8035cf:	5d                   	pop    %ebp
+  8035d0:	c3                   	ret
+
+008035d1 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8035d1:	55                   	push   %ebp
+  8035d2:	89 e5                	mov    %esp,%ebp
+  8035d4:	57                   	push   %edi
+  8035d5:	56                   	push   %esi
+  8035d6:	53                   	push   %ebx
+  8035d7:	83 ec 18             	sub    $0x18,%esp
+  8035da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8035e0:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8035e2:	53                   	push   %ebx
+  8035e3:	e8 b3 ff ff ff       	call   80359b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8035e8:	83 c4 0c             	add    $0xc,%esp
+  8035eb:	ff 75 10             	push   0x10(%ebp)
+  8035ee:	57                   	push   %edi
+  8035ef:	56                   	push   %esi
+  8035f0:	e8 8b d9 ff ff       	call   800f80 <sys_futex_wait>
+  8035f5:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8035f7:	83 c4 10             	add    $0x10,%esp
+  8035fa:	be 02 00 00 00       	mov    $0x2,%esi
+  8035ff:	eb 10                	jmp    803611 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803601:	83 ec 04             	sub    $0x4,%esp
+  803604:	6a 00                	push   $0x0
+  803606:	6a 02                	push   $0x2
+  803608:	53                   	push   %ebx
+  803609:	e8 72 d9 ff ff       	call   800f80 <sys_futex_wait>
+  80360e:	83 c4 10             	add    $0x10,%esp
+  803611:	89 f0                	mov    %esi,%eax
+  803613:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803616:	85 c0                	test   %eax,%eax
+  803618:	75 e7                	jne    803601 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80361a:	83 ff ec             	cmp    $0xffffffec,%edi
+  80361d:	74 05                	je     803624 <cond_timedwait+0x53>
+  80361f:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803624:	89 f8                	mov    %edi,%eax
+  803626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803629:	5b                   	pop    %ebx
+  80362a:	5e                   	pop    %esi
+  80362b:	5f                   	pop    %edi
+  80362c:	5d                   	pop    %ebp
+  80362d:	c3                   	ret
+
+0080362e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80362e:	55                   	push   %ebp
+  80362f:	89 e5                	mov    %esp,%ebp
+  803631:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803634:	6a 00                	push   $0x0
+  803636:	ff 75 0c             	push   0xc(%ebp)
+  803639:	ff 75 08             	push   0x8(%ebp)
+  80363c:	e8 90 ff ff ff       	call   8035d1 <cond_timedwait>
+}
+  803641:	83 c4 10             	add    $0x10,%esp
+  803644:	c9                   	leave
+  803645:	c3                   	ret
+
+00803646 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803646:	55                   	push   %ebp
+  803647:	89 e5                	mov    %esp,%ebp
+  803649:	83 ec 10             	sub    $0x10,%esp
+  80364c:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80364f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803654:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803658:	6a 01                	push   $0x1
+  80365a:	50                   	push   %eax
+  80365b:	e8 4f d9 ff ff       	call   800faf <sys_futex_wake>
+}
+  803660:	83 c4 10             	add    $0x10,%esp
+  803663:	c9                   	leave
+  803664:	c3                   	ret
+
+00803665 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803665:	55                   	push   %ebp
+  803666:	89 e5                	mov    %esp,%ebp
+  803668:	83 ec 10             	sub    $0x10,%esp
+  80366b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80366e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803673:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803677:	68 00 04 00 00       	push   $0x400
+  80367c:	50                   	push   %eax
+  80367d:	e8 2d d9 ff ff       	call   800faf <sys_futex_wake>
+}
+  803682:	83 c4 10             	add    $0x10,%esp
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+
+00803687 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803687:	55                   	push   %ebp
+  803688:	89 e5                	mov    %esp,%ebp
+  80368a:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80368d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803690:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803692:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803699:	5d                   	pop    %ebp
+  80369a:	c3                   	ret
+
+0080369b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80369b:	55                   	push   %ebp
+  80369c:	89 e5                	mov    %esp,%ebp
+  80369e:	53                   	push   %ebx
+  80369f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8036a2:	8b 11                	mov    (%ecx),%edx
+  8036a4:	85 d2                	test   %edx,%edx
+  8036a6:	74 14                	je     8036bc <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8036a8:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8036ab:	89 d0                	mov    %edx,%eax
+  8036ad:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8036b1:	39 c2                	cmp    %eax,%edx
+  8036b3:	75 ed                	jne    8036a2 <sem_trywait+0x7>
+			return 0;
+  8036b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ba:	eb 05                	jmp    8036c1 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8036bc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8036c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c4:	c9                   	leave
+  8036c5:	c3                   	ret
+
+008036c6 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8036c6:	55                   	push   %ebp
+  8036c7:	89 e5                	mov    %esp,%ebp
+  8036c9:	57                   	push   %edi
+  8036ca:	56                   	push   %esi
+  8036cb:	53                   	push   %ebx
+  8036cc:	83 ec 1c             	sub    $0x1c,%esp
+  8036cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8036d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8036d5:	e8 1e d8 ff ff       	call   800ef8 <sys_time_msec>
+  8036da:	01 f8                	add    %edi,%eax
+  8036dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8036df:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8036e4:	eb 28                	jmp    80370e <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8036e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036eb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8036f0:	83 ec 04             	sub    $0x4,%esp
+  8036f3:	56                   	push   %esi
+  8036f4:	6a 00                	push   $0x0
+  8036f6:	53                   	push   %ebx
+  8036f7:	e8 84 d8 ff ff       	call   800f80 <sys_futex_wait>
+  8036fc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803701:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803706:	83 c4 10             	add    $0x10,%esp
+  803709:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80370c:	74 2e                	je     80373c <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80370e:	83 ec 0c             	sub    $0xc,%esp
+  803711:	53                   	push   %ebx
+  803712:	e8 84 ff ff ff       	call   80369b <sem_trywait>
+  803717:	83 c4 10             	add    $0x10,%esp
+  80371a:	85 c0                	test   %eax,%eax
+  80371c:	79 19                	jns    803737 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  80371e:	85 ff                	test   %edi,%edi
+  803720:	74 c4                	je     8036e6 <sem_timedwait+0x20>
+  803722:	e8 d1 d7 ff ff       	call   800ef8 <sys_time_msec>
+  803727:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80372a:	29 c6                	sub    %eax,%esi
+  80372c:	85 f6                	test   %esi,%esi
+  80372e:	7f b6                	jg     8036e6 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803730:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803735:	eb 05                	jmp    80373c <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803737:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373f:	5b                   	pop    %ebx
+  803740:	5e                   	pop    %esi
+  803741:	5f                   	pop    %edi
+  803742:	5d                   	pop    %ebp
+  803743:	c3                   	ret
+
+00803744 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803744:	55                   	push   %ebp
+  803745:	89 e5                	mov    %esp,%ebp
+  803747:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80374a:	6a 00                	push   $0x0
+  80374c:	ff 75 08             	push   0x8(%ebp)
+  80374f:	e8 72 ff ff ff       	call   8036c6 <sem_timedwait>
+}
+  803754:	83 c4 10             	add    $0x10,%esp
+  803757:	c9                   	leave
+  803758:	c3                   	ret
+
+00803759 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803759:	55                   	push   %ebp
+  80375a:	89 e5                	mov    %esp,%ebp
+  80375c:	83 ec 08             	sub    $0x8,%esp
+  80375f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803762:	ba 01 00 00 00       	mov    $0x1,%edx
+  803767:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80376b:	8b 50 04             	mov    0x4(%eax),%edx
+  80376e:	85 d2                	test   %edx,%edx
+  803770:	75 02                	jne    803774 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803772:	c9                   	leave
+  803773:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803774:	83 ec 08             	sub    $0x8,%esp
+  803777:	6a 01                	push   $0x1
+  803779:	50                   	push   %eax
+  80377a:	e8 30 d8 ff ff       	call   800faf <sys_futex_wake>
+  80377f:	83 c4 10             	add    $0x10,%esp
+}
+  803782:	eb ee                	jmp    803772 <sem_post+0x19>
+
+00803784 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803784:	55                   	push   %ebp
+  803785:	89 e5                	mov    %esp,%ebp
+  803787:	57                   	push   %edi
+  803788:	56                   	push   %esi
+  803789:	53                   	push   %ebx
+  80378a:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80378d:	68 20 70 80 00       	push   $0x807020
+  803792:	e8 97 fd ff ff       	call   80352e <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803797:	a1 44 70 80 00       	mov    0x807044,%eax
+  80379c:	83 c4 10             	add    $0x10,%esp
+  80379f:	85 c0                	test   %eax,%eax
+  8037a1:	75 19                	jne    8037bc <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8037a3:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  8037a8:	8b 00                	mov    (%eax),%eax
+  8037aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8037ad:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8037b2:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  8037b9:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8037bc:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8037c1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037c4:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8037cb:	8b 40 04             	mov    0x4(%eax),%eax
+  8037ce:	85 c0                	test   %eax,%eax
+  8037d0:	0f 84 e4 00 00 00    	je     8038ba <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8037d6:	83 c3 01             	add    $0x1,%ebx
+  8037d9:	83 fb 20             	cmp    $0x20,%ebx
+  8037dc:	75 e3                	jne    8037c1 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8037de:	83 ec 0c             	sub    $0xc,%esp
+  8037e1:	68 20 70 80 00       	push   $0x807020
+  8037e6:	e8 b0 fd ff ff       	call   80359b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8037eb:	83 c4 10             	add    $0x10,%esp
+  8037ee:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8037f3:	e9 b8 00 00 00       	jmp    8038b0 <pthread_create+0x12c>
+  8037f8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8037fb:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8037fe:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803800:	39 f3                	cmp    %esi,%ebx
+  803802:	73 16                	jae    80381a <pthread_create+0x96>
+		va -= PGSIZE;
+  803804:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80380a:	83 ec 08             	sub    $0x8,%esp
+  80380d:	56                   	push   %esi
+  80380e:	6a 00                	push   $0x0
+  803810:	e8 ef d4 ff ff       	call   800d04 <sys_page_unmap>
+  803815:	83 c4 10             	add    $0x10,%esp
+  803818:	eb e6                	jmp    803800 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80381a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80381d:	83 ec 08             	sub    $0x8,%esp
+  803820:	ff 75 e4             	push   -0x1c(%ebp)
+  803823:	6a 00                	push   $0x0
+  803825:	e8 da d4 ff ff       	call   800d04 <sys_page_unmap>
+	return r;
+  80382a:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80382d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803830:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803837:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80383e:	eb 70                	jmp    8038b0 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803840:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803843:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80384a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80384d:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803850:	8b 55 10             	mov    0x10(%ebp),%edx
+  803853:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803856:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80385d:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803862:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803865:	29 c8                	sub    %ecx,%eax
+  803867:	85 db                	test   %ebx,%ebx
+  803869:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803870:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803873:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80387a:	83 ec 04             	sub    $0x4,%esp
+  80387d:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803882:	29 ca                	sub    %ecx,%edx
+  803884:	52                   	push   %edx
+	*--esp = 0;
+  803885:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803888:	50                   	push   %eax
+  803889:	68 e1 3a 80 00       	push   $0x803ae1
+  80388e:	e8 c1 d7 ff ff       	call   801054 <sys_thread_create>
+  803893:	89 c7                	mov    %eax,%edi
+  803895:	83 c4 10             	add    $0x10,%esp
+  803898:	85 c0                	test   %eax,%eax
+  80389a:	78 91                	js     80382d <pthread_create+0xa9>
+	th->th_env = id;
+  80389c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80389f:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8038a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038a9:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8038ab:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8038b0:	89 f8                	mov    %edi,%eax
+  8038b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038b5:	5b                   	pop    %ebx
+  8038b6:	5e                   	pop    %esi
+  8038b7:	5f                   	pop    %edi
+  8038b8:	5d                   	pop    %ebp
+  8038b9:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8038ba:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038bd:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8038c4:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8038cb:	83 ec 0c             	sub    $0xc,%esp
+  8038ce:	68 20 70 80 00       	push   $0x807020
+  8038d3:	e8 c3 fc ff ff       	call   80359b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8038d8:	89 d9                	mov    %ebx,%ecx
+  8038da:	c1 e1 10             	shl    $0x10,%ecx
+  8038dd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8038e0:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8038e5:	29 c8                	sub    %ecx,%eax
+  8038e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8038ea:	c1 e8 16             	shr    $0x16,%eax
+  8038ed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8038f4:	83 c4 10             	add    $0x10,%esp
+  8038f7:	a8 01                	test   $0x1,%al
+  8038f9:	74 15                	je     803910 <pthread_create+0x18c>
+  8038fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038fe:	c1 e8 0c             	shr    $0xc,%eax
+  803901:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803908:	a8 01                	test   $0x1,%al
+  80390a:	0f 85 30 ff ff ff    	jne    803840 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803910:	83 ec 04             	sub    $0x4,%esp
+  803913:	6a 07                	push   $0x7
+  803915:	ff 75 e4             	push   -0x1c(%ebp)
+  803918:	6a 00                	push   $0x0
+  80391a:	e8 4c d3 ff ff       	call   800c6b <sys_page_alloc>
+  80391f:	89 c7                	mov    %eax,%edi
+  803921:	83 c4 10             	add    $0x10,%esp
+  803924:	85 c0                	test   %eax,%eax
+  803926:	0f 88 01 ff ff ff    	js     80382d <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80392c:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803931:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803934:	29 d0                	sub    %edx,%eax
+  803936:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803939:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80393b:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803940:	29 d0                	sub    %edx,%eax
+  803942:	89 c7                	mov    %eax,%edi
+  803944:	39 fe                	cmp    %edi,%esi
+  803946:	0f 83 f4 fe ff ff    	jae    803840 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80394c:	83 ec 04             	sub    $0x4,%esp
+  80394f:	6a 07                	push   $0x7
+  803951:	56                   	push   %esi
+  803952:	6a 00                	push   $0x0
+  803954:	e8 12 d3 ff ff       	call   800c6b <sys_page_alloc>
+  803959:	83 c4 10             	add    $0x10,%esp
+  80395c:	85 c0                	test   %eax,%eax
+  80395e:	0f 88 94 fe ff ff    	js     8037f8 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803964:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80396a:	eb d8                	jmp    803944 <pthread_create+0x1c0>
+
+0080396c <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80396c:	55                   	push   %ebp
+  80396d:	89 e5                	mov    %esp,%ebp
+  80396f:	57                   	push   %edi
+  803970:	56                   	push   %esi
+  803971:	53                   	push   %ebx
+  803972:	83 ec 0c             	sub    $0xc,%esp
+  803975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803978:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80397b:	83 f8 1e             	cmp    $0x1e,%eax
+  80397e:	0f 87 c7 00 00 00    	ja     803a4b <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803984:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803986:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80398c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803991:	77 12                	ja     8039a5 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803993:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803998:	29 d0                	sub    %edx,%eax
+  80399a:	c1 e8 10             	shr    $0x10,%eax
+  80399d:	39 c3                	cmp    %eax,%ebx
+  80399f:	0f 84 ad 00 00 00    	je     803a52 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8039a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039a8:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8039af:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8039b6:	eb 10                	jmp    8039c8 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8039b8:	83 ec 04             	sub    $0x4,%esp
+  8039bb:	6a 00                	push   $0x0
+  8039bd:	6a 01                	push   $0x1
+  8039bf:	57                   	push   %edi
+  8039c0:	e8 bb d5 ff ff       	call   800f80 <sys_futex_wait>
+  8039c5:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8039c8:	8b 46 04             	mov    0x4(%esi),%eax
+  8039cb:	83 f8 01             	cmp    $0x1,%eax
+  8039ce:	74 e8                	je     8039b8 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8039d0:	83 f8 02             	cmp    $0x2,%eax
+  8039d3:	0f 85 80 00 00 00    	jne    803a59 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8039d9:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8039dc:	c1 e6 02             	shl    $0x2,%esi
+  8039df:	eb 05                	jmp    8039e6 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8039e1:	e8 59 d2 ff ff       	call   800c3f <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8039e6:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8039ec:	89 ca                	mov    %ecx,%edx
+  8039ee:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8039f4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8039f7:	c1 e0 04             	shl    $0x4,%eax
+  8039fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039ff:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803a02:	39 c1                	cmp    %eax,%ecx
+  803a04:	75 12                	jne    803a18 <pthread_join+0xac>
+  803a06:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803a09:	c1 e0 04             	shl    $0x4,%eax
+  803a0c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a11:	8b 40 54             	mov    0x54(%eax),%eax
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	75 c9                	jne    8039e1 <pthread_join+0x75>
+	if (ret_store)
+  803a18:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803a1c:	74 0f                	je     803a2d <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803a1e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a21:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803a28:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803a2b:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803a2d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a30:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a37:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a46:	5b                   	pop    %ebx
+  803a47:	5e                   	pop    %esi
+  803a48:	5f                   	pop    %edi
+  803a49:	5d                   	pop    %ebp
+  803a4a:	c3                   	ret
+		return -E_INVAL;
+  803a4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a50:	eb f1                	jmp    803a43 <pthread_join+0xd7>
+  803a52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a57:	eb ea                	jmp    803a43 <pthread_join+0xd7>
+		return -E_INVAL;
+  803a59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a5e:	eb e3                	jmp    803a43 <pthread_join+0xd7>
+
+00803a60 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803a60:	55                   	push   %ebp
+  803a61:	89 e5                	mov    %esp,%ebp
+  803a63:	53                   	push   %ebx
+  803a64:	83 ec 04             	sub    $0x4,%esp
+  803a67:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a69:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a6f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a74:	77 0c                	ja     803a82 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a76:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a7b:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803a7d:	c1 e8 10             	shr    $0x10,%eax
+  803a80:	75 0a                	jne    803a8c <pthread_exit+0x2c>
+		exit();
+  803a82:	e8 05 c7 ff ff       	call   80018c <exit>
+  803a87:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803a8c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803a93:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803a96:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803a9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803aa0:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803aa3:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803aaa:	83 ec 08             	sub    $0x8,%esp
+  803aad:	6a 20                	push   $0x20
+  803aaf:	01 c2                	add    %eax,%edx
+  803ab1:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803ab8:	50                   	push   %eax
+  803ab9:	e8 f1 d4 ff ff       	call   800faf <sys_futex_wake>
+	sys_env_destroy(0);
+  803abe:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803ac5:	e8 fe d0 ff ff       	call   800bc8 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803aca:	83 c4 0c             	add    $0xc,%esp
+  803acd:	68 66 4f 80 00       	push   $0x804f66
+  803ad2:	68 a5 00 00 00       	push   $0xa5
+  803ad7:	68 80 4f 80 00       	push   $0x804f80
+  803adc:	e8 cd 03 00 00       	call   803eae <_panic>
+
+00803ae1 <pthread_start>:
+{
+  803ae1:	55                   	push   %ebp
+  803ae2:	89 e5                	mov    %esp,%ebp
+  803ae4:	53                   	push   %ebx
+  803ae5:	83 ec 04             	sub    $0x4,%esp
+  803ae8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803aeb:	e8 23 d1 ff ff       	call   800c13 <sys_getenvid>
+  803af0:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803af5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803afb:	85 db                	test   %ebx,%ebx
+  803afd:	74 0c                	je     803b0b <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803aff:	89 d9                	mov    %ebx,%ecx
+  803b01:	c1 e1 10             	shl    $0x10,%ecx
+  803b04:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b09:	29 ca                	sub    %ecx,%edx
+  803b0b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803b0e:	c1 e0 04             	shl    $0x4,%eax
+  803b11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b16:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803b18:	83 ec 0c             	sub    $0xc,%esp
+  803b1b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803b22:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803b25:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803b2c:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803b33:	89 04 24             	mov    %eax,(%esp)
+  803b36:	e8 25 ff ff ff       	call   803a60 <pthread_exit>
+
+00803b3b <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803b3b:	55                   	push   %ebp
+  803b3c:	89 e5                	mov    %esp,%ebp
+  803b3e:	57                   	push   %edi
+  803b3f:	56                   	push   %esi
+  803b40:	53                   	push   %ebx
+  803b41:	83 ec 1c             	sub    $0x1c,%esp
+  803b44:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b46:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803b4c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b53:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b58:	77 0d                	ja     803b67 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b5a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b5f:	29 d0                	sub    %edx,%eax
+  803b61:	c1 e8 10             	shr    $0x10,%eax
+  803b64:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803b67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b6c:	eb 2f                	jmp    803b9d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803b6e:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803b74:	8b 01                	mov    (%ecx),%eax
+  803b76:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803b79:	39 c2                	cmp    %eax,%edx
+  803b7b:	75 14                	jne    803b91 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803b7d:	83 ec 0c             	sub    $0xc,%esp
+  803b80:	57                   	push   %edi
+  803b81:	e8 42 d0 ff ff       	call   800bc8 <sys_env_destroy>
+  803b86:	83 c4 10             	add    $0x10,%esp
+  803b89:	85 c0                	test   %eax,%eax
+  803b8b:	0f 88 97 00 00 00    	js     803c28 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803b91:	83 c3 01             	add    $0x1,%ebx
+  803b94:	83 fb 20             	cmp    $0x20,%ebx
+  803b97:	0f 84 d2 00 00 00    	je     803c6f <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803b9d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803ba0:	74 ef                	je     803b91 <pthread_kill_others+0x56>
+  803ba2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ba5:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803bac:	8b 40 04             	mov    0x4(%eax),%eax
+  803baf:	83 f8 01             	cmp    $0x1,%eax
+  803bb2:	75 dd                	jne    803b91 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803bb4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bb7:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803bbe:	89 fe                	mov    %edi,%esi
+  803bc0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803bc6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803bc9:	c1 e0 04             	shl    $0x4,%eax
+  803bcc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803bd1:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803bd4:	39 c7                	cmp    %eax,%edi
+  803bd6:	75 b9                	jne    803b91 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803bd8:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803bdb:	c1 e0 04             	shl    $0x4,%eax
+  803bde:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803be3:	8b 40 54             	mov    0x54(%eax),%eax
+  803be6:	85 c0                	test   %eax,%eax
+  803be8:	74 a7                	je     803b91 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803bea:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803bed:	c1 e0 04             	shl    $0x4,%eax
+  803bf0:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803bf6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803bf8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803bfe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803c03:	0f 87 65 ff ff ff    	ja     803b6e <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c09:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803c0e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803c10:	c1 e8 10             	shr    $0x10,%eax
+  803c13:	0f 84 55 ff ff ff    	je     803b6e <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c19:	c1 e0 10             	shl    $0x10,%eax
+  803c1c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803c21:	29 c1                	sub    %eax,%ecx
+  803c23:	e9 4c ff ff ff       	jmp    803b74 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803c28:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803c2b:	c1 e2 04             	shl    $0x4,%edx
+  803c2e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803c34:	8b 52 48             	mov    0x48(%edx),%edx
+  803c37:	39 fa                	cmp    %edi,%edx
+  803c39:	0f 85 52 ff ff ff    	jne    803b91 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803c3f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803c42:	c1 e2 04             	shl    $0x4,%edx
+  803c45:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803c4b:	8b 52 54             	mov    0x54(%edx),%edx
+  803c4e:	85 d2                	test   %edx,%edx
+  803c50:	0f 84 3b ff ff ff    	je     803b91 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803c56:	83 ec 0c             	sub    $0xc,%esp
+  803c59:	50                   	push   %eax
+  803c5a:	57                   	push   %edi
+  803c5b:	68 90 4f 80 00       	push   $0x804f90
+  803c60:	68 bb 00 00 00       	push   $0xbb
+  803c65:	68 80 4f 80 00       	push   $0x804f80
+  803c6a:	e8 3f 02 00 00       	call   803eae <_panic>
+	}
+}
+  803c6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c72:	5b                   	pop    %ebx
+  803c73:	5e                   	pop    %esi
+  803c74:	5f                   	pop    %edi
+  803c75:	5d                   	pop    %ebp
+  803c76:	c3                   	ret
+
+00803c77 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803c77:	55                   	push   %ebp
+  803c78:	89 e5                	mov    %esp,%ebp
+  803c7a:	53                   	push   %ebx
+  803c7b:	83 ec 04             	sub    $0x4,%esp
+  803c7e:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c80:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803c86:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803c8c:	0f 87 85 00 00 00    	ja     803d17 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c92:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803c97:	29 c3                	sub    %eax,%ebx
+  803c99:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803c9c:	83 ec 04             	sub    $0x4,%esp
+  803c9f:	68 80 02 00 00       	push   $0x280
+  803ca4:	6a 00                	push   $0x0
+  803ca6:	68 40 70 80 00       	push   $0x807040
+  803cab:	e8 ce cc ff ff       	call   80097e <memset>
+	threads_mu.m_state = 0;
+  803cb0:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803cb7:	00 00 00 
+	if (self != 0) {
+  803cba:	83 c4 10             	add    $0x10,%esp
+  803cbd:	85 db                	test   %ebx,%ebx
+  803cbf:	74 51                	je     803d12 <pthread_fork_child+0x9b>
+  803cc1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803cc3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803cc9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803cce:	77 18                	ja     803ce8 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803cd0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803cd5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803cd7:	c1 e8 10             	shr    $0x10,%eax
+  803cda:	74 0c                	je     803ce8 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803cdc:	c1 e0 10             	shl    $0x10,%eax
+  803cdf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ce4:	29 c2                	sub    %eax,%edx
+  803ce6:	eb 06                	jmp    803cee <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803ce8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803cee:	8b 02                	mov    (%edx),%eax
+  803cf0:	8b 48 48             	mov    0x48(%eax),%ecx
+  803cf3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803cfa:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803cfd:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803d04:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803d0b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d15:	c9                   	leave
+  803d16:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803d17:	83 ec 04             	sub    $0x4,%esp
+  803d1a:	68 80 02 00 00       	push   $0x280
+  803d1f:	6a 00                	push   $0x0
+  803d21:	68 40 70 80 00       	push   $0x807040
+  803d26:	e8 53 cc ff ff       	call   80097e <memset>
+	threads_mu.m_state = 0;
+  803d2b:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803d32:	00 00 00 
+  803d35:	83 c4 10             	add    $0x10,%esp
+  803d38:	eb d8                	jmp    803d12 <pthread_fork_child+0x9b>
+
+00803d3a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3f:	c3                   	ret
+
+00803d40 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803d40:	55                   	push   %ebp
+  803d41:	89 e5                	mov    %esp,%ebp
+  803d43:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803d46:	68 b5 4f 80 00       	push   $0x804fb5
+  803d4b:	ff 75 0c             	push   0xc(%ebp)
+  803d4e:	e8 da ca ff ff       	call   80082d <strcpy>
+	return 0;
+}
+  803d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d58:	c9                   	leave
+  803d59:	c3                   	ret
+
+00803d5a <devcons_write>:
+{
+  803d5a:	55                   	push   %ebp
+  803d5b:	89 e5                	mov    %esp,%ebp
+  803d5d:	57                   	push   %edi
+  803d5e:	56                   	push   %esi
+  803d5f:	53                   	push   %ebx
+  803d60:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803d66:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803d6b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803d71:	eb 2e                	jmp    803da1 <devcons_write+0x47>
+		m = n - tot;
+  803d73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d76:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803d78:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d7d:	39 c3                	cmp    %eax,%ebx
+  803d7f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803d82:	83 ec 04             	sub    $0x4,%esp
+  803d85:	53                   	push   %ebx
+  803d86:	89 f0                	mov    %esi,%eax
+  803d88:	03 45 0c             	add    0xc(%ebp),%eax
+  803d8b:	50                   	push   %eax
+  803d8c:	57                   	push   %edi
+  803d8d:	e8 21 cc ff ff       	call   8009b3 <memmove>
+		sys_cputs(buf, m);
+  803d92:	83 c4 08             	add    $0x8,%esp
+  803d95:	53                   	push   %ebx
+  803d96:	57                   	push   %edi
+  803d97:	e8 d5 cd ff ff       	call   800b71 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d9c:	01 de                	add    %ebx,%esi
+  803d9e:	83 c4 10             	add    $0x10,%esp
+  803da1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803da4:	72 cd                	jb     803d73 <devcons_write+0x19>
+}
+  803da6:	89 f0                	mov    %esi,%eax
+  803da8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dab:	5b                   	pop    %ebx
+  803dac:	5e                   	pop    %esi
+  803dad:	5f                   	pop    %edi
+  803dae:	5d                   	pop    %ebp
+  803daf:	c3                   	ret
+
+00803db0 <devcons_read>:
+{
+  803db0:	55                   	push   %ebp
+  803db1:	89 e5                	mov    %esp,%ebp
+  803db3:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dbb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803dbf:	75 07                	jne    803dc8 <devcons_read+0x18>
+  803dc1:	eb 1f                	jmp    803de2 <devcons_read+0x32>
+		sys_yield();
+  803dc3:	e8 77 ce ff ff       	call   800c3f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803dc8:	e8 cf cd ff ff       	call   800b9c <sys_cgetc>
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	74 f2                	je     803dc3 <devcons_read+0x13>
+	if (c < 0)
+  803dd1:	78 0f                	js     803de2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803dd3:	83 f8 04             	cmp    $0x4,%eax
+  803dd6:	74 0c                	je     803de4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803dd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ddb:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ddd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803de2:	c9                   	leave
+  803de3:	c3                   	ret
+		return 0;
+  803de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de9:	eb f7                	jmp    803de2 <devcons_read+0x32>
+
+00803deb <cputchar>:
+{
+  803deb:	55                   	push   %ebp
+  803dec:	89 e5                	mov    %esp,%ebp
+  803dee:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803df1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803df4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803df7:	6a 01                	push   $0x1
+  803df9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803dfc:	50                   	push   %eax
+  803dfd:	e8 6f cd ff ff       	call   800b71 <sys_cputs>
+}
+  803e02:	83 c4 10             	add    $0x10,%esp
+  803e05:	c9                   	leave
+  803e06:	c3                   	ret
+
+00803e07 <getchar>:
+{
+  803e07:	55                   	push   %ebp
+  803e08:	89 e5                	mov    %esp,%ebp
+  803e0a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803e0d:	6a 01                	push   $0x1
+  803e0f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e12:	50                   	push   %eax
+  803e13:	6a 00                	push   $0x0
+  803e15:	e8 4f d7 ff ff       	call   801569 <read>
+	if (r < 0)
+  803e1a:	83 c4 10             	add    $0x10,%esp
+  803e1d:	85 c0                	test   %eax,%eax
+  803e1f:	78 06                	js     803e27 <getchar+0x20>
+	if (r < 1)
+  803e21:	74 06                	je     803e29 <getchar+0x22>
+	return c;
+  803e23:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803e27:	c9                   	leave
+  803e28:	c3                   	ret
+		return -E_EOF;
+  803e29:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803e2e:	eb f7                	jmp    803e27 <getchar+0x20>
+
+00803e30 <iscons>:
+{
+  803e30:	55                   	push   %ebp
+  803e31:	89 e5                	mov    %esp,%ebp
+  803e33:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e39:	50                   	push   %eax
+  803e3a:	ff 75 08             	push   0x8(%ebp)
+  803e3d:	e8 97 d4 ff ff       	call   8012d9 <fd_lookup>
+  803e42:	83 c4 10             	add    $0x10,%esp
+  803e45:	85 c0                	test   %eax,%eax
+  803e47:	78 11                	js     803e5a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e4c:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803e52:	39 10                	cmp    %edx,(%eax)
+  803e54:	0f 94 c0             	sete   %al
+  803e57:	0f b6 c0             	movzbl %al,%eax
+}
+  803e5a:	c9                   	leave
+  803e5b:	c3                   	ret
+
+00803e5c <opencons>:
+{
+  803e5c:	55                   	push   %ebp
+  803e5d:	89 e5                	mov    %esp,%ebp
+  803e5f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803e62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e65:	50                   	push   %eax
+  803e66:	e8 18 d4 ff ff       	call   801283 <fd_alloc>
+  803e6b:	83 c4 10             	add    $0x10,%esp
+  803e6e:	85 c0                	test   %eax,%eax
+  803e70:	78 3a                	js     803eac <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803e72:	83 ec 04             	sub    $0x4,%esp
+  803e75:	68 07 04 00 00       	push   $0x407
+  803e7a:	ff 75 f4             	push   -0xc(%ebp)
+  803e7d:	6a 00                	push   $0x0
+  803e7f:	e8 e7 cd ff ff       	call   800c6b <sys_page_alloc>
+  803e84:	83 c4 10             	add    $0x10,%esp
+  803e87:	85 c0                	test   %eax,%eax
+  803e89:	78 21                	js     803eac <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e8e:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803e94:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803e96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e99:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803ea0:	83 ec 0c             	sub    $0xc,%esp
+  803ea3:	50                   	push   %eax
+  803ea4:	e8 b3 d3 ff ff       	call   80125c <fd2num>
+  803ea9:	83 c4 10             	add    $0x10,%esp
+}
+  803eac:	c9                   	leave
+  803ead:	c3                   	ret
+
+00803eae <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803eae:	55                   	push   %ebp
+  803eaf:	89 e5                	mov    %esp,%ebp
+  803eb1:	56                   	push   %esi
+  803eb2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803eb3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803eb6:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  803ebc:	e8 52 cd ff ff       	call   800c13 <sys_getenvid>
+  803ec1:	83 ec 0c             	sub    $0xc,%esp
+  803ec4:	ff 75 0c             	push   0xc(%ebp)
+  803ec7:	ff 75 08             	push   0x8(%ebp)
+  803eca:	56                   	push   %esi
+  803ecb:	50                   	push   %eax
+  803ecc:	68 c4 4f 80 00       	push   $0x804fc4
+  803ed1:	e8 73 c3 ff ff       	call   800249 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803ed6:	83 c4 18             	add    $0x18,%esp
+  803ed9:	53                   	push   %ebx
+  803eda:	ff 75 10             	push   0x10(%ebp)
+  803edd:	e8 16 c3 ff ff       	call   8001f8 <vcprintf>
+	cprintf("\n");
+  803ee2:	c7 04 24 22 51 80 00 	movl   $0x805122,(%esp)
+  803ee9:	e8 5b c3 ff ff       	call   800249 <cprintf>
+  803eee:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803ef1:	cc                   	int3
+	while (1)
+  803ef2:	eb fd                	jmp    803ef1 <_panic+0x43>
+
+00803ef4 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803ef4:	55                   	push   %ebp
+  803ef5:	89 e5                	mov    %esp,%ebp
+  803ef7:	57                   	push   %edi
+  803ef8:	56                   	push   %esi
+  803ef9:	53                   	push   %ebx
+  803efa:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803efd:	89 d6                	mov    %edx,%esi
+  803eff:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803f02:	89 cf                	mov    %ecx,%edi
+  803f04:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803f07:	89 fa                	mov    %edi,%edx
+  803f09:	80 ce 08             	or     $0x8,%dh
+  803f0c:	f6 c5 08             	test   $0x8,%ch
+  803f0f:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803f12:	57                   	push   %edi
+  803f13:	56                   	push   %esi
+  803f14:	50                   	push   %eax
+  803f15:	56                   	push   %esi
+  803f16:	6a 00                	push   $0x0
+  803f18:	e8 9b cd ff ff       	call   800cb8 <sys_page_map>
+	if (r < 0) {
+  803f1d:	83 c4 20             	add    $0x20,%esp
+  803f20:	85 c0                	test   %eax,%eax
+  803f22:	78 27                	js     803f4b <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803f24:	83 ec 0c             	sub    $0xc,%esp
+  803f27:	57                   	push   %edi
+  803f28:	56                   	push   %esi
+  803f29:	6a 00                	push   $0x0
+  803f2b:	56                   	push   %esi
+  803f2c:	6a 00                	push   $0x0
+  803f2e:	e8 85 cd ff ff       	call   800cb8 <sys_page_map>
+  803f33:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803f35:	83 c4 20             	add    $0x20,%esp
+  803f38:	85 c0                	test   %eax,%eax
+  803f3a:	78 24                	js     803f60 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803f3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803f41:	89 d8                	mov    %ebx,%eax
+  803f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f46:	5b                   	pop    %ebx
+  803f47:	5e                   	pop    %esi
+  803f48:	5f                   	pop    %edi
+  803f49:	5d                   	pop    %ebp
+  803f4a:	c3                   	ret
+  803f4b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803f4d:	83 ec 08             	sub    $0x8,%esp
+  803f50:	50                   	push   %eax
+  803f51:	68 e8 4f 80 00       	push   $0x804fe8
+  803f56:	e8 ee c2 ff ff       	call   800249 <cprintf>
+		return r;
+  803f5b:	83 c4 10             	add    $0x10,%esp
+  803f5e:	eb e1                	jmp    803f41 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803f60:	83 ec 08             	sub    $0x8,%esp
+  803f63:	50                   	push   %eax
+  803f64:	68 18 50 80 00       	push   $0x805018
+  803f69:	e8 db c2 ff ff       	call   800249 <cprintf>
+		return r;
+  803f6e:	83 c4 10             	add    $0x10,%esp
+  803f71:	eb ce                	jmp    803f41 <duppage_cow+0x4d>
+
+00803f73 <duppage>:
+{
+  803f73:	55                   	push   %ebp
+  803f74:	89 e5                	mov    %esp,%ebp
+  803f76:	53                   	push   %ebx
+  803f77:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803f7a:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803f7d:	51                   	push   %ecx
+  803f7e:	52                   	push   %edx
+  803f7f:	50                   	push   %eax
+  803f80:	52                   	push   %edx
+  803f81:	6a 00                	push   $0x0
+  803f83:	e8 30 cd ff ff       	call   800cb8 <sys_page_map>
+	if (r < 0) {
+  803f88:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803f90:	85 c0                	test   %eax,%eax
+  803f92:	78 07                	js     803f9b <duppage+0x28>
+}
+  803f94:	89 d8                	mov    %ebx,%eax
+  803f96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f99:	c9                   	leave
+  803f9a:	c3                   	ret
+  803f9b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803f9d:	83 ec 08             	sub    $0x8,%esp
+  803fa0:	50                   	push   %eax
+  803fa1:	68 e8 4f 80 00       	push   $0x804fe8
+  803fa6:	e8 9e c2 ff ff       	call   800249 <cprintf>
+		return r;
+  803fab:	83 c4 10             	add    $0x10,%esp
+  803fae:	eb e4                	jmp    803f94 <duppage+0x21>
+
+00803fb0 <cow_copy>:
+{
+  803fb0:	55                   	push   %ebp
+  803fb1:	89 e5                	mov    %esp,%ebp
+  803fb3:	56                   	push   %esi
+  803fb4:	53                   	push   %ebx
+  803fb5:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803fb7:	83 ec 04             	sub    $0x4,%esp
+  803fba:	6a 07                	push   $0x7
+  803fbc:	68 00 f0 7f 00       	push   $0x7ff000
+  803fc1:	6a 00                	push   $0x0
+  803fc3:	e8 a3 cc ff ff       	call   800c6b <sys_page_alloc>
+	if (r < 0) {
+  803fc8:	83 c4 10             	add    $0x10,%esp
+  803fcb:	85 c0                	test   %eax,%eax
+  803fcd:	78 58                	js     804027 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803fcf:	83 ec 04             	sub    $0x4,%esp
+  803fd2:	68 00 10 00 00       	push   $0x1000
+  803fd7:	56                   	push   %esi
+  803fd8:	68 00 f0 7f 00       	push   $0x7ff000
+  803fdd:	e8 d1 c9 ff ff       	call   8009b3 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803fe2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803fe9:	56                   	push   %esi
+  803fea:	6a 00                	push   $0x0
+  803fec:	68 00 f0 7f 00       	push   $0x7ff000
+  803ff1:	6a 00                	push   $0x0
+  803ff3:	e8 c0 cc ff ff       	call   800cb8 <sys_page_map>
+  803ff8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ffa:	83 c4 20             	add    $0x20,%esp
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	78 3b                	js     80403c <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804001:	83 ec 08             	sub    $0x8,%esp
+  804004:	68 00 f0 7f 00       	push   $0x7ff000
+  804009:	6a 00                	push   $0x0
+  80400b:	e8 f4 cc ff ff       	call   800d04 <sys_page_unmap>
+  804010:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804012:	83 c4 10             	add    $0x10,%esp
+  804015:	85 c0                	test   %eax,%eax
+  804017:	78 45                	js     80405e <cow_copy+0xae>
+	return 0;
+  804019:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80401e:	89 d8                	mov    %ebx,%eax
+  804020:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804023:	5b                   	pop    %ebx
+  804024:	5e                   	pop    %esi
+  804025:	5d                   	pop    %ebp
+  804026:	c3                   	ret
+  804027:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  804029:	83 ec 08             	sub    $0x8,%esp
+  80402c:	50                   	push   %eax
+  80402d:	68 08 51 80 00       	push   $0x805108
+  804032:	e8 12 c2 ff ff       	call   800249 <cprintf>
+		return r;
+  804037:	83 c4 10             	add    $0x10,%esp
+  80403a:	eb e2                	jmp    80401e <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80403c:	83 ec 08             	sub    $0x8,%esp
+  80403f:	50                   	push   %eax
+  804040:	68 24 51 80 00       	push   $0x805124
+  804045:	e8 ff c1 ff ff       	call   800249 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80404a:	83 c4 08             	add    $0x8,%esp
+  80404d:	68 00 f0 7f 00       	push   $0x7ff000
+  804052:	6a 00                	push   $0x0
+  804054:	e8 ab cc ff ff       	call   800d04 <sys_page_unmap>
+		return r;
+  804059:	83 c4 10             	add    $0x10,%esp
+  80405c:	eb c0                	jmp    80401e <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80405e:	83 ec 08             	sub    $0x8,%esp
+  804061:	50                   	push   %eax
+  804062:	68 40 50 80 00       	push   $0x805040
+  804067:	e8 dd c1 ff ff       	call   800249 <cprintf>
+		return r;
+  80406c:	83 c4 10             	add    $0x10,%esp
+  80406f:	eb ad                	jmp    80401e <cow_copy+0x6e>
+
+00804071 <pgfault>:
+{
+  804071:	55                   	push   %ebp
+  804072:	89 e5                	mov    %esp,%ebp
+  804074:	56                   	push   %esi
+  804075:	53                   	push   %ebx
+  804076:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  804079:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80407b:	89 d8                	mov    %ebx,%eax
+  80407d:	c1 e8 16             	shr    $0x16,%eax
+  804080:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804087:	89 de                	mov    %ebx,%esi
+  804089:	c1 ee 0c             	shr    $0xc,%esi
+  80408c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804093:	a8 07                	test   $0x7,%al
+  804095:	74 3b                	je     8040d2 <pgfault+0x61>
+  804097:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80409d:	74 33                	je     8040d2 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80409f:	83 ec 0c             	sub    $0xc,%esp
+  8040a2:	68 00 f0 bf ee       	push   $0xeebff000
+  8040a7:	e8 82 f4 ff ff       	call   80352e <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8040ac:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8040b3:	83 c4 10             	add    $0x10,%esp
+  8040b6:	f6 c4 08             	test   $0x8,%ah
+  8040b9:	75 30                	jne    8040eb <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8040bb:	83 ec 0c             	sub    $0xc,%esp
+  8040be:	68 00 f0 bf ee       	push   $0xeebff000
+  8040c3:	e8 d3 f4 ff ff       	call   80359b <mutex_unlock>
+}
+  8040c8:	83 c4 10             	add    $0x10,%esp
+  8040cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040ce:	5b                   	pop    %ebx
+  8040cf:	5e                   	pop    %esi
+  8040d0:	5d                   	pop    %ebp
+  8040d1:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8040d2:	83 ec 08             	sub    $0x8,%esp
+  8040d5:	ff 72 28             	push   0x28(%edx)
+  8040d8:	51                   	push   %ecx
+  8040d9:	50                   	push   %eax
+  8040da:	68 64 50 80 00       	push   $0x805064
+  8040df:	6a 3f                	push   $0x3f
+  8040e1:	68 3e 51 80 00       	push   $0x80513e
+  8040e6:	e8 c3 fd ff ff       	call   803eae <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8040eb:	89 d8                	mov    %ebx,%eax
+  8040ed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8040f2:	e8 b9 fe ff ff       	call   803fb0 <cow_copy>
+  8040f7:	eb c2                	jmp    8040bb <pgfault+0x4a>
+
+008040f9 <cow_enable>:
+{
+  8040f9:	55                   	push   %ebp
+  8040fa:	89 e5                	mov    %esp,%ebp
+  8040fc:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8040ff:	68 71 40 80 00       	push   $0x804071
+  804104:	e8 28 06 00 00       	call   804731 <set_pgfault_handler>
+}
+  804109:	83 c4 10             	add    $0x10,%esp
+  80410c:	c9                   	leave
+  80410d:	c3                   	ret
+
+0080410e <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80410e:	55                   	push   %ebp
+  80410f:	89 e5                	mov    %esp,%ebp
+  804111:	57                   	push   %edi
+  804112:	56                   	push   %esi
+  804113:	53                   	push   %ebx
+  804114:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804117:	68 71 40 80 00       	push   $0x804071
+  80411c:	e8 10 06 00 00       	call   804731 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804121:	b8 07 00 00 00       	mov    $0x7,%eax
+  804126:	cd 30                	int    $0x30
+  804128:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80412b:	83 c4 10             	add    $0x10,%esp
+  80412e:	85 c0                	test   %eax,%eax
+  804130:	78 4b                	js     80417d <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804132:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80413c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80413f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804143:	0f 85 16 01 00 00    	jne    80425f <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804149:	e8 c5 ca ff ff       	call   800c13 <sys_getenvid>
+  80414e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804153:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804155:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80415b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804161:	77 32                	ja     804195 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804163:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  804168:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80416a:	c1 ea 10             	shr    $0x10,%edx
+  80416d:	74 26                	je     804195 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80416f:	c1 e2 10             	shl    $0x10,%edx
+  804172:	89 d1                	mov    %edx,%ecx
+  804174:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804179:	29 ca                	sub    %ecx,%edx
+  80417b:	eb 1e                	jmp    80419b <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80417d:	83 ec 08             	sub    $0x8,%esp
+  804180:	89 c7                	mov    %eax,%edi
+  804182:	50                   	push   %eax
+  804183:	68 49 51 80 00       	push   $0x805149
+  804188:	e8 bc c0 ff ff       	call   800249 <cprintf>
+		return eid;
+  80418d:	83 c4 10             	add    $0x10,%esp
+  804190:	e9 6c 01 00 00       	jmp    804301 <fork+0x1f3>
+		return pthread_main_tls;
+  804195:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80419b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80419e:	c1 e0 04             	shl    $0x4,%eax
+  8041a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041a6:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8041a8:	e8 ca fa ff ff       	call   803c77 <pthread_fork_child>
+		return eid;
+  8041ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8041b0:	e9 4c 01 00 00       	jmp    804301 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041b5:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041bb:	89 da                	mov    %ebx,%edx
+  8041bd:	89 f8                	mov    %edi,%eax
+  8041bf:	e8 af fd ff ff       	call   803f73 <duppage>
+  8041c4:	85 c0                	test   %eax,%eax
+  8041c6:	79 28                	jns    8041f0 <fork+0xe2>
+  8041c8:	89 c7                	mov    %eax,%edi
+  8041ca:	e9 32 01 00 00       	jmp    804301 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8041cf:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041d5:	83 f9 05             	cmp    $0x5,%ecx
+  8041d8:	75 58                	jne    804232 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041da:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8041df:	89 da                	mov    %ebx,%edx
+  8041e1:	89 f8                	mov    %edi,%eax
+  8041e3:	e8 8b fd ff ff       	call   803f73 <duppage>
+  8041e8:	85 c0                	test   %eax,%eax
+  8041ea:	0f 88 0f 01 00 00    	js     8042ff <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8041f0:	83 c3 01             	add    $0x1,%ebx
+  8041f3:	39 de                	cmp    %ebx,%esi
+  8041f5:	74 54                	je     80424b <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8041f7:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8041fe:	f6 c1 05             	test   $0x5,%cl
+  804201:	74 ed                	je     8041f0 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804203:	f6 c5 04             	test   $0x4,%ch
+  804206:	75 ad                	jne    8041b5 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804208:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80420e:	74 bf                	je     8041cf <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804210:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804216:	74 d8                	je     8041f0 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804218:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80421e:	89 da                	mov    %ebx,%edx
+  804220:	89 f8                	mov    %edi,%eax
+  804222:	e8 cd fc ff ff       	call   803ef4 <duppage_cow>
+  804227:	85 c0                	test   %eax,%eax
+  804229:	79 c5                	jns    8041f0 <fork+0xe2>
+  80422b:	89 c7                	mov    %eax,%edi
+  80422d:	e9 cf 00 00 00       	jmp    804301 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804232:	68 94 50 80 00       	push   $0x805094
+  804237:	68 7d 4e 80 00       	push   $0x804e7d
+  80423c:	68 c6 00 00 00       	push   $0xc6
+  804241:	68 3e 51 80 00       	push   $0x80513e
+  804246:	e8 63 fc ff ff       	call   803eae <_panic>
+  80424b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80424e:	83 c1 01             	add    $0x1,%ecx
+  804251:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804257:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80425d:	74 18                	je     804277 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80425f:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804266:	a8 07                	test   $0x7,%al
+  804268:	74 e4                	je     80424e <fork+0x140>
+  80426a:	89 cb                	mov    %ecx,%ebx
+  80426c:	c1 e3 0a             	shl    $0xa,%ebx
+  80426f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804272:	e9 7c ff ff ff       	jmp    8041f3 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804277:	83 ec 04             	sub    $0x4,%esp
+  80427a:	6a 07                	push   $0x7
+  80427c:	68 00 f0 bf ee       	push   $0xeebff000
+  804281:	ff 75 e4             	push   -0x1c(%ebp)
+  804284:	e8 e2 c9 ff ff       	call   800c6b <sys_page_alloc>
+  804289:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80428b:	83 c4 10             	add    $0x10,%esp
+  80428e:	85 c0                	test   %eax,%eax
+  804290:	78 34                	js     8042c6 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804292:	83 ec 08             	sub    $0x8,%esp
+  804295:	68 6f 47 80 00       	push   $0x80476f
+  80429a:	ff 75 e4             	push   -0x1c(%ebp)
+  80429d:	e8 46 cb ff ff       	call   800de8 <sys_env_set_pgfault_upcall>
+  8042a2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042a4:	83 c4 10             	add    $0x10,%esp
+  8042a7:	85 c0                	test   %eax,%eax
+  8042a9:	78 2e                	js     8042d9 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8042ab:	83 ec 08             	sub    $0x8,%esp
+  8042ae:	6a 02                	push   $0x2
+  8042b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8042b3:	e8 98 ca ff ff       	call   800d50 <sys_env_set_status>
+  8042b8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042ba:	83 c4 10             	add    $0x10,%esp
+  8042bd:	85 c0                	test   %eax,%eax
+  8042bf:	78 2b                	js     8042ec <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8042c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8042c4:	eb 3b                	jmp    804301 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8042c6:	83 ec 08             	sub    $0x8,%esp
+  8042c9:	50                   	push   %eax
+  8042ca:	68 bc 50 80 00       	push   $0x8050bc
+  8042cf:	e8 75 bf ff ff       	call   800249 <cprintf>
+		return r;
+  8042d4:	83 c4 10             	add    $0x10,%esp
+  8042d7:	eb 28                	jmp    804301 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042d9:	83 ec 08             	sub    $0x8,%esp
+  8042dc:	50                   	push   %eax
+  8042dd:	68 e4 50 80 00       	push   $0x8050e4
+  8042e2:	e8 62 bf ff ff       	call   800249 <cprintf>
+		return r;
+  8042e7:	83 c4 10             	add    $0x10,%esp
+  8042ea:	eb 15                	jmp    804301 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8042ec:	83 ec 08             	sub    $0x8,%esp
+  8042ef:	50                   	push   %eax
+  8042f0:	68 59 51 80 00       	push   $0x805159
+  8042f5:	e8 4f bf ff ff       	call   800249 <cprintf>
+		return r;
+  8042fa:	83 c4 10             	add    $0x10,%esp
+  8042fd:	eb 02                	jmp    804301 <fork+0x1f3>
+  8042ff:	89 c7                	mov    %eax,%edi
+}
+  804301:	89 f8                	mov    %edi,%eax
+  804303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804306:	5b                   	pop    %ebx
+  804307:	5e                   	pop    %esi
+  804308:	5f                   	pop    %edi
+  804309:	5d                   	pop    %ebp
+  80430a:	c3                   	ret
+
+0080430b <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80430b:	55                   	push   %ebp
+  80430c:	89 e5                	mov    %esp,%ebp
+  80430e:	57                   	push   %edi
+  80430f:	56                   	push   %esi
+  804310:	53                   	push   %ebx
+  804311:	83 ec 2c             	sub    $0x2c,%esp
+  804314:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804316:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80431c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804321:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804327:	77 0a                	ja     804333 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804329:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80432e:	29 c3                	sub    %eax,%ebx
+  804330:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804333:	83 ec 0c             	sub    $0xc,%esp
+  804336:	68 71 40 80 00       	push   $0x804071
+  80433b:	e8 f1 03 00 00       	call   804731 <set_pgfault_handler>
+  804340:	b8 07 00 00 00       	mov    $0x7,%eax
+  804345:	cd 30                	int    $0x30
+  804347:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80434a:	83 c4 10             	add    $0x10,%esp
+  80434d:	85 c0                	test   %eax,%eax
+  80434f:	78 30                	js     804381 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804351:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804355:	74 42                	je     804399 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804357:	c1 e3 10             	shl    $0x10,%ebx
+  80435a:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80435f:	29 d8                	sub    %ebx,%eax
+  804361:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804364:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804369:	29 d8                	sub    %ebx,%eax
+  80436b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80436e:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804373:	ba 00 00 00 00       	mov    $0x0,%edx
+  804378:	89 f7                	mov    %esi,%edi
+  80437a:	89 d6                	mov    %edx,%esi
+  80437c:	e9 2c 01 00 00       	jmp    8044ad <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804381:	83 ec 08             	sub    $0x8,%esp
+  804384:	89 c7                	mov    %eax,%edi
+  804386:	50                   	push   %eax
+  804387:	68 49 51 80 00       	push   $0x805149
+  80438c:	e8 b8 be ff ff       	call   800249 <cprintf>
+		return eid;
+  804391:	83 c4 10             	add    $0x10,%esp
+  804394:	e9 d5 00 00 00       	jmp    80446e <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804399:	e8 75 c8 ff ff       	call   800c13 <sys_getenvid>
+  80439e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8043a3:	89 c2                	mov    %eax,%edx
+  8043a5:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043a7:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8043ad:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b2:	77 18                	ja     8043cc <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043b9:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8043bb:	c1 e8 10             	shr    $0x10,%eax
+  8043be:	74 0c                	je     8043cc <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043c0:	c1 e0 10             	shl    $0x10,%eax
+  8043c3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8043c8:	29 c1                	sub    %eax,%ecx
+  8043ca:	eb 06                	jmp    8043d2 <sfork+0xc7>
+		return pthread_main_tls;
+  8043cc:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8043d2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043d5:	c1 e0 04             	shl    $0x4,%eax
+  8043d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043dd:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8043df:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8043e2:	e9 87 00 00 00       	jmp    80446e <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8043e7:	f6 c5 04             	test   $0x4,%ch
+  8043ea:	74 6c                	je     804458 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8043ec:	89 ca                	mov    %ecx,%edx
+  8043ee:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8043f4:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8043fa:	74 7c                	je     804478 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8043fc:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804402:	89 da                	mov    %ebx,%edx
+  804404:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804407:	e8 67 fb ff ff       	call   803f73 <duppage>
+  80440c:	85 c0                	test   %eax,%eax
+  80440e:	0f 88 4f 01 00 00    	js     804563 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804414:	83 c3 01             	add    $0x1,%ebx
+  804417:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80441a:	74 7a                	je     804496 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80441c:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80441e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804425:	f6 c1 01             	test   $0x1,%cl
+  804428:	74 ea                	je     804414 <sfork+0x109>
+  80442a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804430:	74 e2                	je     804414 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804432:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804438:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80443b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804440:	76 a5                	jbe    8043e7 <sfork+0xdc>
+  804442:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804448:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80444b:	39 fa                	cmp    %edi,%edx
+  80444d:	73 9d                	jae    8043ec <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80444f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804452:	39 fa                	cmp    %edi,%edx
+  804454:	72 96                	jb     8043ec <sfork+0xe1>
+  804456:	eb 8f                	jmp    8043e7 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804458:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80445e:	89 da                	mov    %ebx,%edx
+  804460:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804463:	e8 8c fa ff ff       	call   803ef4 <duppage_cow>
+  804468:	85 c0                	test   %eax,%eax
+  80446a:	79 a8                	jns    804414 <sfork+0x109>
+  80446c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80446e:	89 f8                	mov    %edi,%eax
+  804470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804473:	5b                   	pop    %ebx
+  804474:	5e                   	pop    %esi
+  804475:	5f                   	pop    %edi
+  804476:	5d                   	pop    %ebp
+  804477:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804478:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80447d:	e8 2e fb ff ff       	call   803fb0 <cow_copy>
+  804482:	85 c0                	test   %eax,%eax
+  804484:	0f 88 d2 00 00 00    	js     80455c <sfork+0x251>
+				pte = uvpt[pn];
+  80448a:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804491:	e9 66 ff ff ff       	jmp    8043fc <sfork+0xf1>
+  804496:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804499:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80449c:	83 c6 01             	add    $0x1,%esi
+  80449f:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8044a5:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8044ab:	74 1b                	je     8044c8 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8044ad:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8044b4:	a8 01                	test   $0x1,%al
+  8044b6:	74 e4                	je     80449c <sfork+0x191>
+  8044b8:	89 f3                	mov    %esi,%ebx
+  8044ba:	c1 e3 0a             	shl    $0xa,%ebx
+  8044bd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8044c0:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8044c3:	e9 4f ff ff ff       	jmp    804417 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8044c8:	83 ec 04             	sub    $0x4,%esp
+  8044cb:	6a 07                	push   $0x7
+  8044cd:	68 00 f0 bf ee       	push   $0xeebff000
+  8044d2:	ff 75 e0             	push   -0x20(%ebp)
+  8044d5:	e8 91 c7 ff ff       	call   800c6b <sys_page_alloc>
+  8044da:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8044dc:	83 c4 10             	add    $0x10,%esp
+  8044df:	85 c0                	test   %eax,%eax
+  8044e1:	78 37                	js     80451a <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8044e3:	83 ec 08             	sub    $0x8,%esp
+  8044e6:	68 6f 47 80 00       	push   $0x80476f
+  8044eb:	ff 75 e0             	push   -0x20(%ebp)
+  8044ee:	e8 f5 c8 ff ff       	call   800de8 <sys_env_set_pgfault_upcall>
+  8044f3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8044f5:	83 c4 10             	add    $0x10,%esp
+  8044f8:	85 c0                	test   %eax,%eax
+  8044fa:	78 34                	js     804530 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8044fc:	83 ec 08             	sub    $0x8,%esp
+  8044ff:	6a 02                	push   $0x2
+  804501:	ff 75 e0             	push   -0x20(%ebp)
+  804504:	e8 47 c8 ff ff       	call   800d50 <sys_env_set_status>
+  804509:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80450b:	83 c4 10             	add    $0x10,%esp
+  80450e:	85 c0                	test   %eax,%eax
+  804510:	78 34                	js     804546 <sfork+0x23b>
+	return eid;
+  804512:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804515:	e9 54 ff ff ff       	jmp    80446e <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80451a:	83 ec 08             	sub    $0x8,%esp
+  80451d:	50                   	push   %eax
+  80451e:	68 bc 50 80 00       	push   $0x8050bc
+  804523:	e8 21 bd ff ff       	call   800249 <cprintf>
+		return r;
+  804528:	83 c4 10             	add    $0x10,%esp
+  80452b:	e9 3e ff ff ff       	jmp    80446e <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804530:	83 ec 08             	sub    $0x8,%esp
+  804533:	50                   	push   %eax
+  804534:	68 e4 50 80 00       	push   $0x8050e4
+  804539:	e8 0b bd ff ff       	call   800249 <cprintf>
+		return r;
+  80453e:	83 c4 10             	add    $0x10,%esp
+  804541:	e9 28 ff ff ff       	jmp    80446e <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804546:	83 ec 08             	sub    $0x8,%esp
+  804549:	50                   	push   %eax
+  80454a:	68 59 51 80 00       	push   $0x805159
+  80454f:	e8 f5 bc ff ff       	call   800249 <cprintf>
+		return r;
+  804554:	83 c4 10             	add    $0x10,%esp
+  804557:	e9 12 ff ff ff       	jmp    80446e <sfork+0x163>
+  80455c:	89 c7                	mov    %eax,%edi
+  80455e:	e9 0b ff ff ff       	jmp    80446e <sfork+0x163>
+  804563:	89 c7                	mov    %eax,%edi
+  804565:	e9 04 ff ff ff       	jmp    80446e <sfork+0x163>
+
+0080456a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80456a:	55                   	push   %ebp
+  80456b:	89 e5                	mov    %esp,%ebp
+  80456d:	57                   	push   %edi
+  80456e:	56                   	push   %esi
+  80456f:	53                   	push   %ebx
+  804570:	83 ec 18             	sub    $0x18,%esp
+  804573:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804576:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804579:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80457c:	85 c0                	test   %eax,%eax
+  80457e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804583:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804586:	50                   	push   %eax
+  804587:	e8 d5 c8 ff ff       	call   800e61 <sys_ipc_recv>
+	if (r < 0) {
+  80458c:	83 c4 10             	add    $0x10,%esp
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	78 2b                	js     8045be <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804593:	85 ff                	test   %edi,%edi
+  804595:	74 55                	je     8045ec <ipc_recv+0x82>
+  804597:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804599:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80459f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8045a4:	77 39                	ja     8045df <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045a6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8045ab:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8045ad:	c1 e8 10             	shr    $0x10,%eax
+  8045b0:	74 2d                	je     8045df <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8045b2:	c1 e0 10             	shl    $0x10,%eax
+  8045b5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8045ba:	29 c2                	sub    %eax,%edx
+  8045bc:	eb 27                	jmp    8045e5 <ipc_recv+0x7b>
+  8045be:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8045c0:	83 ec 08             	sub    $0x8,%esp
+  8045c3:	50                   	push   %eax
+  8045c4:	68 77 51 80 00       	push   $0x805177
+  8045c9:	e8 7b bc ff ff       	call   800249 <cprintf>
+		*from_env_store = 0;
+  8045ce:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8045d4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8045da:	83 c4 10             	add    $0x10,%esp
+  8045dd:	eb 77                	jmp    804656 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8045df:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8045e5:	8b 02                	mov    (%edx),%eax
+  8045e7:	8b 40 78             	mov    0x78(%eax),%eax
+  8045ea:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8045ec:	85 f6                	test   %esi,%esi
+  8045ee:	74 34                	je     804624 <ipc_recv+0xba>
+  8045f0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045f2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8045f8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8045fd:	77 18                	ja     804617 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804604:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804606:	c1 e8 10             	shr    $0x10,%eax
+  804609:	74 0c                	je     804617 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80460b:	c1 e0 10             	shl    $0x10,%eax
+  80460e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804613:	29 c2                	sub    %eax,%edx
+  804615:	eb 06                	jmp    80461d <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804617:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80461d:	8b 02                	mov    (%edx),%eax
+  80461f:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804622:	89 06                	mov    %eax,(%esi)
+  804624:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804626:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80462c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804631:	77 18                	ja     80464b <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804633:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804638:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80463a:	c1 e8 10             	shr    $0x10,%eax
+  80463d:	74 0c                	je     80464b <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80463f:	c1 e0 10             	shl    $0x10,%eax
+  804642:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804647:	29 c2                	sub    %eax,%edx
+  804649:	eb 06                	jmp    804651 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80464b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804651:	8b 02                	mov    (%edx),%eax
+  804653:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804656:	89 d8                	mov    %ebx,%eax
+  804658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80465b:	5b                   	pop    %ebx
+  80465c:	5e                   	pop    %esi
+  80465d:	5f                   	pop    %edi
+  80465e:	5d                   	pop    %ebp
+  80465f:	c3                   	ret
+
+00804660 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804660:	55                   	push   %ebp
+  804661:	89 e5                	mov    %esp,%ebp
+  804663:	57                   	push   %edi
+  804664:	56                   	push   %esi
+  804665:	53                   	push   %ebx
+  804666:	83 ec 0c             	sub    $0xc,%esp
+  804669:	8b 75 08             	mov    0x8(%ebp),%esi
+  80466c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80466f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804672:	85 db                	test   %ebx,%ebx
+  804674:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804679:	0f 44 d8             	cmove  %eax,%ebx
+  80467c:	eb 05                	jmp    804683 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80467e:	e8 bc c5 ff ff       	call   800c3f <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804683:	57                   	push   %edi
+  804684:	53                   	push   %ebx
+  804685:	ff 75 0c             	push   0xc(%ebp)
+  804688:	56                   	push   %esi
+  804689:	e8 a6 c7 ff ff       	call   800e34 <sys_ipc_try_send>
+		if (r == 0) {
+  80468e:	83 c4 10             	add    $0x10,%esp
+  804691:	85 c0                	test   %eax,%eax
+  804693:	74 19                	je     8046ae <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804695:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804698:	74 e4                	je     80467e <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80469a:	83 ec 0c             	sub    $0xc,%esp
+  80469d:	50                   	push   %eax
+  80469e:	57                   	push   %edi
+  80469f:	53                   	push   %ebx
+  8046a0:	56                   	push   %esi
+  8046a1:	68 90 51 80 00       	push   $0x805190
+  8046a6:	e8 9e bb ff ff       	call   800249 <cprintf>
+			return;
+  8046ab:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8046ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046b1:	5b                   	pop    %ebx
+  8046b2:	5e                   	pop    %esi
+  8046b3:	5f                   	pop    %edi
+  8046b4:	5d                   	pop    %ebp
+  8046b5:	c3                   	ret
+
+008046b6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8046b6:	55                   	push   %ebp
+  8046b7:	89 e5                	mov    %esp,%ebp
+  8046b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8046bc:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8046c1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8046c4:	c1 e0 04             	shl    $0x4,%eax
+  8046c7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046cc:	8b 40 50             	mov    0x50(%eax),%eax
+  8046cf:	39 c8                	cmp    %ecx,%eax
+  8046d1:	74 12                	je     8046e5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8046d3:	83 c2 01             	add    $0x1,%edx
+  8046d6:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8046dc:	75 e3                	jne    8046c1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8046de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e3:	eb 0e                	jmp    8046f3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8046e5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8046e8:	c1 e0 04             	shl    $0x4,%eax
+  8046eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046f0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8046f3:	5d                   	pop    %ebp
+  8046f4:	c3                   	ret
+
+008046f5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8046f5:	55                   	push   %ebp
+  8046f6:	89 e5                	mov    %esp,%ebp
+  8046f8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8046fb:	89 c2                	mov    %eax,%edx
+  8046fd:	c1 ea 16             	shr    $0x16,%edx
+  804700:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804707:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80470c:	f6 c1 01             	test   $0x1,%cl
+  80470f:	74 1c                	je     80472d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804711:	c1 e8 0c             	shr    $0xc,%eax
+  804714:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80471b:	a8 01                	test   $0x1,%al
+  80471d:	74 0e                	je     80472d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80471f:	c1 e8 0c             	shr    $0xc,%eax
+  804722:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804729:	ef 
+  80472a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80472d:	89 d0                	mov    %edx,%eax
+  80472f:	5d                   	pop    %ebp
+  804730:	c3                   	ret
+
+00804731 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804731:	55                   	push   %ebp
+  804732:	89 e5                	mov    %esp,%ebp
+  804734:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804737:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80473e:	74 0a                	je     80474a <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804740:	8b 45 08             	mov    0x8(%ebp),%eax
+  804743:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804748:	c9                   	leave
+  804749:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80474a:	83 ec 04             	sub    $0x4,%esp
+  80474d:	6a 07                	push   $0x7
+  80474f:	68 00 f0 bf ee       	push   $0xeebff000
+  804754:	6a 00                	push   $0x0
+  804756:	e8 10 c5 ff ff       	call   800c6b <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80475b:	83 c4 08             	add    $0x8,%esp
+  80475e:	68 6f 47 80 00       	push   $0x80476f
+  804763:	6a 00                	push   $0x0
+  804765:	e8 7e c6 ff ff       	call   800de8 <sys_env_set_pgfault_upcall>
+  80476a:	83 c4 10             	add    $0x10,%esp
+  80476d:	eb d1                	jmp    804740 <set_pgfault_handler+0xf>
+
+0080476f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80476f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804770:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804775:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804777:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80477a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80477e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804782:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804785:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804789:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80478b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80478e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80478f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804792:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804793:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804794:	c3                   	ret
+
+00804795 <udm>:
+  804795:	57                   	push   %edi
+  804796:	56                   	push   %esi
+  804797:	53                   	push   %ebx
+  804798:	83 ec 20             	sub    $0x20,%esp
+  80479b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80479f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8047a3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8047a7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8047ab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8047af:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8047b3:	89 d1                	mov    %edx,%ecx
+  8047b5:	09 c1                	or     %eax,%ecx
+  8047b7:	0f 84 91 00 00 00    	je     80484e <udm+0xb9>
+  8047bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047c7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8047cc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8047d3:	00 
+  8047d4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8047db:	00 
+  8047dc:	eb 08                	jmp    8047e6 <udm+0x51>
+  8047de:	83 e9 01             	sub    $0x1,%ecx
+  8047e1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8047e4:	74 7c                	je     804862 <udm+0xcd>
+  8047e6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8047ea:	01 c0                	add    %eax,%eax
+  8047ec:	89 c6                	mov    %eax,%esi
+  8047ee:	89 d7                	mov    %edx,%edi
+  8047f0:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8047f4:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8047f8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8047fb:	d3 ea                	shr    %cl,%edx
+  8047fd:	f6 c1 20             	test   $0x20,%cl
+  804800:	74 04                	je     804806 <udm+0x71>
+  804802:	89 d0                	mov    %edx,%eax
+  804804:	31 d2                	xor    %edx,%edx
+  804806:	83 e0 01             	and    $0x1,%eax
+  804809:	89 04 24             	mov    %eax,(%esp)
+  80480c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804813:	00 
+  804814:	8b 04 24             	mov    (%esp),%eax
+  804817:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80481b:	09 f0                	or     %esi,%eax
+  80481d:	09 fa                	or     %edi,%edx
+  80481f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804823:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804827:	39 f0                	cmp    %esi,%eax
+  804829:	89 d3                	mov    %edx,%ebx
+  80482b:	19 fb                	sbb    %edi,%ebx
+  80482d:	72 af                	jb     8047de <udm+0x49>
+  80482f:	29 f0                	sub    %esi,%eax
+  804831:	19 fa                	sbb    %edi,%edx
+  804833:	89 cf                	mov    %ecx,%edi
+  804835:	c1 ef 05             	shr    $0x5,%edi
+  804838:	83 e7 01             	and    $0x1,%edi
+  80483b:	89 fe                	mov    %edi,%esi
+  80483d:	83 f6 01             	xor    $0x1,%esi
+  804840:	d3 e6                	shl    %cl,%esi
+  804842:	d3 e7                	shl    %cl,%edi
+  804844:	09 74 24 18          	or     %esi,0x18(%esp)
+  804848:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80484c:	eb 90                	jmp    8047de <udm+0x49>
+  80484e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804852:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804856:	89 f0                	mov    %esi,%eax
+  804858:	89 fa                	mov    %edi,%edx
+  80485a:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80485e:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804862:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804866:	89 01                	mov    %eax,(%ecx)
+  804868:	89 51 04             	mov    %edx,0x4(%ecx)
+  80486b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80486f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804873:	83 c4 20             	add    $0x20,%esp
+  804876:	5b                   	pop    %ebx
+  804877:	5e                   	pop    %esi
+  804878:	5f                   	pop    %edi
+  804879:	c3                   	ret
+
+0080487a <__udivdi3>:
+  80487a:	83 ec 18             	sub    $0x18,%esp
+  80487d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804881:	50                   	push   %eax
+  804882:	ff 74 24 2c          	push   0x2c(%esp)
+  804886:	ff 74 24 2c          	push   0x2c(%esp)
+  80488a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80488e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804892:	e8 fe fe ff ff       	call   804795 <udm>
+  804897:	83 c4 24             	add    $0x24,%esp
+  80489a:	c3                   	ret
+
+0080489b <__umoddi3>:
+  80489b:	83 ec 18             	sub    $0x18,%esp
+  80489e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8048a2:	50                   	push   %eax
+  8048a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8048a7:	ff 74 24 2c          	push   0x2c(%esp)
+  8048ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048af:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048b3:	e8 dd fe ff ff       	call   804795 <udm>
+  8048b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8048bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8048c0:	83 c4 24             	add    $0x24,%esp
+  8048c3:	c3                   	ret
+
+008048c4 <__divdi3>:
+  8048c4:	56                   	push   %esi
+  8048c5:	53                   	push   %ebx
+  8048c6:	83 ec 14             	sub    $0x14,%esp
+  8048c9:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8048cd:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8048d1:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8048d5:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8048d9:	85 d2                	test   %edx,%edx
+  8048db:	78 18                	js     8048f5 <__divdi3+0x31>
+  8048dd:	85 db                	test   %ebx,%ebx
+  8048df:	78 3e                	js     80491f <__divdi3+0x5b>
+  8048e1:	83 ec 04             	sub    $0x4,%esp
+  8048e4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048e8:	56                   	push   %esi
+  8048e9:	53                   	push   %ebx
+  8048ea:	51                   	push   %ecx
+  8048eb:	e8 a5 fe ff ff       	call   804795 <udm>
+  8048f0:	83 c4 10             	add    $0x10,%esp
+  8048f3:	eb 24                	jmp    804919 <__divdi3+0x55>
+  8048f5:	f7 d8                	neg    %eax
+  8048f7:	83 d2 00             	adc    $0x0,%edx
+  8048fa:	f7 da                	neg    %edx
+  8048fc:	85 db                	test   %ebx,%ebx
+  8048fe:	78 3a                	js     80493a <__divdi3+0x76>
+  804900:	83 ec 04             	sub    $0x4,%esp
+  804903:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804907:	56                   	push   %esi
+  804908:	53                   	push   %ebx
+  804909:	51                   	push   %ecx
+  80490a:	e8 86 fe ff ff       	call   804795 <udm>
+  80490f:	83 c4 10             	add    $0x10,%esp
+  804912:	f7 d8                	neg    %eax
+  804914:	83 d2 00             	adc    $0x0,%edx
+  804917:	f7 da                	neg    %edx
+  804919:	83 c4 14             	add    $0x14,%esp
+  80491c:	5b                   	pop    %ebx
+  80491d:	5e                   	pop    %esi
+  80491e:	c3                   	ret
+  80491f:	83 ec 04             	sub    $0x4,%esp
+  804922:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804926:	56                   	push   %esi
+  804927:	f7 d9                	neg    %ecx
+  804929:	83 d3 00             	adc    $0x0,%ebx
+  80492c:	f7 db                	neg    %ebx
+  80492e:	53                   	push   %ebx
+  80492f:	51                   	push   %ecx
+  804930:	e8 60 fe ff ff       	call   804795 <udm>
+  804935:	83 c4 10             	add    $0x10,%esp
+  804938:	eb d8                	jmp    804912 <__divdi3+0x4e>
+  80493a:	83 ec 04             	sub    $0x4,%esp
+  80493d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804941:	56                   	push   %esi
+  804942:	f7 d9                	neg    %ecx
+  804944:	83 d3 00             	adc    $0x0,%ebx
+  804947:	f7 db                	neg    %ebx
+  804949:	53                   	push   %ebx
+  80494a:	51                   	push   %ecx
+  80494b:	e8 45 fe ff ff       	call   804795 <udm>
+  804950:	83 c4 10             	add    $0x10,%esp
+  804953:	eb c4                	jmp    804919 <__divdi3+0x55>
+
+00804955 <__moddi3>:
+  804955:	55                   	push   %ebp
+  804956:	57                   	push   %edi
+  804957:	56                   	push   %esi
+  804958:	53                   	push   %ebx
+  804959:	83 ec 24             	sub    $0x24,%esp
+  80495c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804960:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804964:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804968:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80496c:	85 d2                	test   %edx,%edx
+  80496e:	78 3b                	js     8049ab <__moddi3+0x56>
+  804970:	83 ec 04             	sub    $0x4,%esp
+  804973:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804977:	56                   	push   %esi
+  804978:	89 ce                	mov    %ecx,%esi
+  80497a:	f7 de                	neg    %esi
+  80497c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804980:	89 de                	mov    %ebx,%esi
+  804982:	83 d6 00             	adc    $0x0,%esi
+  804985:	f7 de                	neg    %esi
+  804987:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80498b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80498f:	0f 48 f1             	cmovs  %ecx,%esi
+  804992:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804997:	53                   	push   %ebx
+  804998:	56                   	push   %esi
+  804999:	e8 f7 fd ff ff       	call   804795 <udm>
+  80499e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049a2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049a6:	83 c4 10             	add    $0x10,%esp
+  8049a9:	eb 47                	jmp    8049f2 <__moddi3+0x9d>
+  8049ab:	f7 d8                	neg    %eax
+  8049ad:	83 d2 00             	adc    $0x0,%edx
+  8049b0:	f7 da                	neg    %edx
+  8049b2:	83 ec 04             	sub    $0x4,%esp
+  8049b5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8049b9:	56                   	push   %esi
+  8049ba:	89 cf                	mov    %ecx,%edi
+  8049bc:	f7 df                	neg    %edi
+  8049be:	89 de                	mov    %ebx,%esi
+  8049c0:	83 d6 00             	adc    $0x0,%esi
+  8049c3:	f7 de                	neg    %esi
+  8049c5:	0f 49 cf             	cmovns %edi,%ecx
+  8049c8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8049cc:	0f 49 de             	cmovns %esi,%ebx
+  8049cf:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8049d3:	ff 74 24 0c          	push   0xc(%esp)
+  8049d7:	ff 74 24 0c          	push   0xc(%esp)
+  8049db:	e8 b5 fd ff ff       	call   804795 <udm>
+  8049e0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049e4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049e8:	f7 d8                	neg    %eax
+  8049ea:	83 d2 00             	adc    $0x0,%edx
+  8049ed:	f7 da                	neg    %edx
+  8049ef:	83 c4 10             	add    $0x10,%esp
+  8049f2:	83 c4 24             	add    $0x24,%esp
+  8049f5:	5b                   	pop    %ebx
+  8049f6:	5e                   	pop    %esi
+  8049f7:	5f                   	pop    %edi
+  8049f8:	5d                   	pop    %ebp
+  8049f9:	c3                   	ret
@@ -0,0 +1,9835 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 01 00 00       	call   800185 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(FILE *f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	int c;
+
+	while ((c = fgetc(f)) != EOF) {
+  80003b:	eb 1c                	jmp    800059 <num+0x26>
+		if (bol) {
+			sfprintf(stdout, "%5d ", ++line);
+			bol = 0;
+		}
+		if (fputc(c, stdout) == EOF)
+  80003d:	83 ec 08             	sub    $0x8,%esp
+  800040:	ff 35 10 4d 80 00    	push   0x804d10
+  800046:	53                   	push   %ebx
+  800047:	e8 c7 26 00 00       	call   802713 <fputc>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800052:	74 51                	je     8000a5 <num+0x72>
+			panic("write error copying %s", s);
+		if (c == '\n')
+  800054:	83 fb 0a             	cmp    $0xa,%ebx
+  800057:	74 60                	je     8000b9 <num+0x86>
+	while ((c = fgetc(f)) != EOF) {
+  800059:	83 ec 0c             	sub    $0xc,%esp
+  80005c:	56                   	push   %esi
+  80005d:	e8 9c 23 00 00       	call   8023fe <fgetc>
+  800062:	89 c3                	mov    %eax,%ebx
+  800064:	83 c4 10             	add    $0x10,%esp
+  800067:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80006a:	74 59                	je     8000c5 <num+0x92>
+		if (bol) {
+  80006c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800073:	74 c8                	je     80003d <num+0xa>
+			sfprintf(stdout, "%5d ", ++line);
+  800075:	a1 00 70 80 00       	mov    0x807000,%eax
+  80007a:	83 c0 01             	add    $0x1,%eax
+  80007d:	a3 00 70 80 00       	mov    %eax,0x807000
+  800082:	83 ec 04             	sub    $0x4,%esp
+  800085:	50                   	push   %eax
+  800086:	68 20 48 80 00       	push   $0x804820
+  80008b:	ff 35 10 4d 80 00    	push   0x804d10
+  800091:	e8 f9 26 00 00       	call   80278f <sfprintf>
+			bol = 0;
+  800096:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80009d:	00 00 00 
+  8000a0:	83 c4 10             	add    $0x10,%esp
+  8000a3:	eb 98                	jmp    80003d <num+0xa>
+			panic("write error copying %s", s);
+  8000a5:	ff 75 0c             	push   0xc(%ebp)
+  8000a8:	68 25 48 80 00       	push   $0x804825
+  8000ad:	6a 11                	push   $0x11
+  8000af:	68 3c 48 80 00       	push   $0x80483c
+  8000b4:	e8 6f 01 00 00       	call   800228 <_panic>
+			bol = 1;
+  8000b9:	c7 05 00 60 80 00 01 	movl   $0x1,0x806000
+  8000c0:	00 00 00 
+  8000c3:	eb 94                	jmp    800059 <num+0x26>
+	}
+	if (ferror(f))
+  8000c5:	83 ec 0c             	sub    $0xc,%esp
+  8000c8:	56                   	push   %esi
+  8000c9:	e8 1f 23 00 00       	call   8023ed <ferror>
+  8000ce:	83 c4 10             	add    $0x10,%esp
+  8000d1:	85 c0                	test   %eax,%eax
+  8000d3:	75 07                	jne    8000dc <num+0xa9>
+		panic("error reading %s", s);
+}
+  8000d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d8:	5b                   	pop    %ebx
+  8000d9:	5e                   	pop    %esi
+  8000da:	5d                   	pop    %ebp
+  8000db:	c3                   	ret
+		panic("error reading %s", s);
+  8000dc:	ff 75 0c             	push   0xc(%ebp)
+  8000df:	68 47 48 80 00       	push   $0x804847
+  8000e4:	6a 16                	push   $0x16
+  8000e6:	68 3c 48 80 00       	push   $0x80483c
+  8000eb:	e8 38 01 00 00       	call   800228 <_panic>
+
+008000f0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000f0:	55                   	push   %ebp
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	57                   	push   %edi
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+  8000f6:	83 ec 0c             	sub    $0xc,%esp
+	FILE *f;
+	int i;
+
+	binaryname = "num";
+  8000f9:	c7 05 04 60 80 00 58 	movl   $0x804858,0x806004
+  800100:	48 80 00 
+	if (argc == 1)
+  800103:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800107:	74 0d                	je     800116 <umain+0x26>
+  800109:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80010c:	8d 70 04             	lea    0x4(%eax),%esi
+		num(stdin, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  80010f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800114:	eb 3f                	jmp    800155 <umain+0x65>
+		num(stdin, "<stdin>");
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	68 5c 48 80 00       	push   $0x80485c
+  80011e:	ff 35 14 4d 80 00    	push   0x804d14
+  800124:	e8 0a ff ff ff       	call   800033 <num>
+  800129:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				fclose(f);
+			}
+		}
+	exit();
+  80012c:	e8 cf 00 00 00       	call   800200 <exit>
+}
+  800131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800134:	5b                   	pop    %ebx
+  800135:	5e                   	pop    %esi
+  800136:	5f                   	pop    %edi
+  800137:	5d                   	pop    %ebp
+  800138:	c3                   	ret
+				num(f, argv[i]);
+  800139:	83 ec 08             	sub    $0x8,%esp
+  80013c:	ff 36                	push   (%esi)
+  80013e:	50                   	push   %eax
+  80013f:	e8 ef fe ff ff       	call   800033 <num>
+				fclose(f);
+  800144:	89 1c 24             	mov    %ebx,(%esp)
+  800147:	e8 36 22 00 00       	call   802382 <fclose>
+		for (i = 1; i < argc; i++) {
+  80014c:	83 c7 01             	add    $0x1,%edi
+  80014f:	83 c6 04             	add    $0x4,%esi
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  800158:	7d d2                	jge    80012c <umain+0x3c>
+			f = fopen(argv[i], "r");
+  80015a:	83 ec 08             	sub    $0x8,%esp
+  80015d:	68 ec 49 80 00       	push   $0x8049ec
+  800162:	ff 36                	push   (%esi)
+  800164:	e8 9a 20 00 00       	call   802203 <fopen>
+  800169:	89 c3                	mov    %eax,%ebx
+			if (!f)
+  80016b:	83 c4 10             	add    $0x10,%esp
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	75 c7                	jne    800139 <umain+0x49>
+				panic("can't open %s", argv[i]);
+  800172:	ff 36                	push   (%esi)
+  800174:	68 64 48 80 00       	push   $0x804864
+  800179:	6a 26                	push   $0x26
+  80017b:	68 3c 48 80 00       	push   $0x80483c
+  800180:	e8 a3 00 00 00       	call   800228 <_panic>
+
+00800185 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	57                   	push   %edi
+  800189:	56                   	push   %esi
+  80018a:	53                   	push   %ebx
+  80018b:	83 ec 1c             	sub    $0x1c,%esp
+  80018e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800191:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800194:	e8 34 0b 00 00       	call   800ccd <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800199:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80019c:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8001a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a7:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8001a9:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001ab:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001b1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001b6:	77 16                	ja     8001ce <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8001b8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8001bd:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8001bf:	c1 e8 10             	shr    $0x10,%eax
+  8001c2:	74 0a                	je     8001ce <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8001c4:	c1 e0 10             	shl    $0x10,%eax
+  8001c7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8001cc:	29 c2                	sub    %eax,%edx
+  8001ce:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8001d1:	c1 e0 04             	shl    $0x4,%eax
+  8001d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001d9:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001db:	85 db                	test   %ebx,%ebx
+  8001dd:	7e 07                	jle    8001e6 <libmain+0x61>
+		binaryname = argv[0];
+  8001df:	8b 06                	mov    (%esi),%eax
+  8001e1:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// call user main routine
+	umain(argc, argv);
+  8001e6:	83 ec 08             	sub    $0x8,%esp
+  8001e9:	56                   	push   %esi
+  8001ea:	53                   	push   %ebx
+  8001eb:	e8 00 ff ff ff       	call   8000f0 <umain>
+
+	// exit gracefully
+	exit();
+  8001f0:	e8 0b 00 00 00       	call   800200 <exit>
+}
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fb:	5b                   	pop    %ebx
+  8001fc:	5e                   	pop    %esi
+  8001fd:	5f                   	pop    %edi
+  8001fe:	5d                   	pop    %ebp
+  8001ff:	c3                   	ret
+
+00800200 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800200:	55                   	push   %ebp
+  800201:	89 e5                	mov    %esp,%ebp
+  800203:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800206:	6a 00                	push   $0x0
+  800208:	e8 15 21 00 00       	call   802322 <fflush>
+	pthread_kill_others();
+  80020d:	e8 80 37 00 00       	call   803992 <pthread_kill_others>
+	close_all();
+  800212:	e8 ae 11 00 00       	call   8013c5 <close_all>
+	sys_env_destroy(0);
+  800217:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80021e:	e8 5f 0a 00 00       	call   800c82 <sys_env_destroy>
+}
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+00800228 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80022d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800230:	8b 35 04 60 80 00    	mov    0x806004,%esi
+  800236:	e8 92 0a 00 00       	call   800ccd <sys_getenvid>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	ff 75 0c             	push   0xc(%ebp)
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	56                   	push   %esi
+  800245:	50                   	push   %eax
+  800246:	68 7c 48 80 00       	push   $0x80487c
+  80024b:	e8 b3 00 00 00       	call   800303 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800250:	83 c4 18             	add    $0x18,%esp
+  800253:	53                   	push   %ebx
+  800254:	ff 75 10             	push   0x10(%ebp)
+  800257:	e8 56 00 00 00       	call   8002b2 <vcprintf>
+	cprintf("\n");
+  80025c:	c7 04 24 5e 4f 80 00 	movl   $0x804f5e,(%esp)
+  800263:	e8 9b 00 00 00       	call   800303 <cprintf>
+  800268:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80026b:	cc                   	int3
+	while (1)
+  80026c:	eb fd                	jmp    80026b <_panic+0x43>
+
+0080026e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	53                   	push   %ebx
+  800272:	83 ec 04             	sub    $0x4,%esp
+  800275:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800278:	8b 13                	mov    (%ebx),%edx
+  80027a:	8d 42 01             	lea    0x1(%edx),%eax
+  80027d:	89 03                	mov    %eax,(%ebx)
+  80027f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800282:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800286:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028b:	74 09                	je     800296 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80028d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 ff 00 00 00       	push   $0xff
+  80029e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a1:	50                   	push   %eax
+  8002a2:	e8 84 09 00 00       	call   800c2b <sys_cputs>
+		b->idx = 0;
+  8002a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	eb db                	jmp    80028d <putch+0x1f>
+
+008002b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c2:	00 00 00 
+	b.cnt = 0;
+  8002c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002cf:	ff 75 0c             	push   0xc(%ebp)
+  8002d2:	ff 75 08             	push   0x8(%ebp)
+  8002d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	68 6e 02 80 00       	push   $0x80026e
+  8002e1:	e8 14 01 00 00       	call   8003fa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e6:	83 c4 08             	add    $0x8,%esp
+  8002e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f5:	50                   	push   %eax
+  8002f6:	e8 30 09 00 00       	call   800c2b <sys_cputs>
+
+	return b.cnt;
+}
+  8002fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800301:	c9                   	leave
+  800302:	c3                   	ret
+
+00800303 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800309:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030c:	50                   	push   %eax
+  80030d:	ff 75 08             	push   0x8(%ebp)
+  800310:	e8 9d ff ff ff       	call   8002b2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+
+00800317 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	57                   	push   %edi
+  80031b:	56                   	push   %esi
+  80031c:	53                   	push   %ebx
+  80031d:	83 ec 1c             	sub    $0x1c,%esp
+  800320:	89 c7                	mov    %eax,%edi
+  800322:	89 d6                	mov    %edx,%esi
+  800324:	8b 45 08             	mov    0x8(%ebp),%eax
+  800327:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032a:	89 d1                	mov    %edx,%ecx
+  80032c:	89 c2                	mov    %eax,%edx
+  80032e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800331:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800334:	8b 45 10             	mov    0x10(%ebp),%eax
+  800337:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800344:	39 c2                	cmp    %eax,%edx
+  800346:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800349:	72 3e                	jb     800389 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034b:	83 ec 0c             	sub    $0xc,%esp
+  80034e:	ff 75 18             	push   0x18(%ebp)
+  800351:	83 eb 01             	sub    $0x1,%ebx
+  800354:	53                   	push   %ebx
+  800355:	50                   	push   %eax
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	ff 75 e4             	push   -0x1c(%ebp)
+  80035c:	ff 75 e0             	push   -0x20(%ebp)
+  80035f:	ff 75 dc             	push   -0x24(%ebp)
+  800362:	ff 75 d8             	push   -0x28(%ebp)
+  800365:	e8 21 43 00 00       	call   80468b <__udivdi3>
+  80036a:	83 c4 18             	add    $0x18,%esp
+  80036d:	52                   	push   %edx
+  80036e:	50                   	push   %eax
+  80036f:	89 f2                	mov    %esi,%edx
+  800371:	89 f8                	mov    %edi,%eax
+  800373:	e8 9f ff ff ff       	call   800317 <printnum>
+  800378:	83 c4 20             	add    $0x20,%esp
+  80037b:	eb 13                	jmp    800390 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	56                   	push   %esi
+  800381:	ff 75 18             	push   0x18(%ebp)
+  800384:	ff d7                	call   *%edi
+  800386:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800389:	83 eb 01             	sub    $0x1,%ebx
+  80038c:	85 db                	test   %ebx,%ebx
+  80038e:	7f ed                	jg     80037d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800390:	83 ec 08             	sub    $0x8,%esp
+  800393:	56                   	push   %esi
+  800394:	83 ec 04             	sub    $0x4,%esp
+  800397:	ff 75 e4             	push   -0x1c(%ebp)
+  80039a:	ff 75 e0             	push   -0x20(%ebp)
+  80039d:	ff 75 dc             	push   -0x24(%ebp)
+  8003a0:	ff 75 d8             	push   -0x28(%ebp)
+  8003a3:	e8 04 43 00 00       	call   8046ac <__umoddi3>
+  8003a8:	83 c4 14             	add    $0x14,%esp
+  8003ab:	0f be 80 9f 48 80 00 	movsbl 0x80489f(%eax),%eax
+  8003b2:	50                   	push   %eax
+  8003b3:	ff d7                	call   *%edi
+}
+  8003b5:	83 c4 10             	add    $0x10,%esp
+  8003b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bb:	5b                   	pop    %ebx
+  8003bc:	5e                   	pop    %esi
+  8003bd:	5f                   	pop    %edi
+  8003be:	5d                   	pop    %ebp
+  8003bf:	c3                   	ret
+
+008003c0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c0:	55                   	push   %ebp
+  8003c1:	89 e5                	mov    %esp,%ebp
+  8003c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003ca:	8b 10                	mov    (%eax),%edx
+  8003cc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003cf:	73 0a                	jae    8003db <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d4:	89 08                	mov    %ecx,(%eax)
+  8003d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d9:	88 02                	mov    %al,(%edx)
+}
+  8003db:	5d                   	pop    %ebp
+  8003dc:	c3                   	ret
+
+008003dd <printfmt>:
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e6:	50                   	push   %eax
+  8003e7:	ff 75 10             	push   0x10(%ebp)
+  8003ea:	ff 75 0c             	push   0xc(%ebp)
+  8003ed:	ff 75 08             	push   0x8(%ebp)
+  8003f0:	e8 05 00 00 00       	call   8003fa <vprintfmt>
+}
+  8003f5:	83 c4 10             	add    $0x10,%esp
+  8003f8:	c9                   	leave
+  8003f9:	c3                   	ret
+
+008003fa <vprintfmt>:
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	57                   	push   %edi
+  8003fe:	56                   	push   %esi
+  8003ff:	53                   	push   %ebx
+  800400:	83 ec 2c             	sub    $0x2c,%esp
+  800403:	8b 75 08             	mov    0x8(%ebp),%esi
+  800406:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800409:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040c:	eb 0a                	jmp    800418 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	50                   	push   %eax
+  800413:	ff d6                	call   *%esi
+  800415:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800418:	83 c7 01             	add    $0x1,%edi
+  80041b:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80041f:	83 f8 25             	cmp    $0x25,%eax
+  800422:	74 0c                	je     800430 <vprintfmt+0x36>
+			if (ch == '\0')
+  800424:	85 c0                	test   %eax,%eax
+  800426:	75 e6                	jne    80040e <vprintfmt+0x14>
+}
+  800428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042b:	5b                   	pop    %ebx
+  80042c:	5e                   	pop    %esi
+  80042d:	5f                   	pop    %edi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+		padc = ' ';
+  800430:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800434:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80043b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800442:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800449:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80044e:	8d 47 01             	lea    0x1(%edi),%eax
+  800451:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800454:	0f b6 17             	movzbl (%edi),%edx
+  800457:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045a:	3c 55                	cmp    $0x55,%al
+  80045c:	0f 87 c5 03 00 00    	ja     800827 <vprintfmt+0x42d>
+  800462:	0f b6 c0             	movzbl %al,%eax
+  800465:	ff 24 85 20 4a 80 00 	jmp    *0x804a20(,%eax,4)
+  80046c:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80046f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800472:	eb da                	jmp    80044e <vprintfmt+0x54>
+  800474:	0f be d2             	movsbl %dl,%edx
+  800477:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800482:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800485:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800489:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80048c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80048f:	83 f9 09             	cmp    $0x9,%ecx
+  800492:	77 55                	ja     8004e9 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800494:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800497:	eb e9                	jmp    800482 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800499:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049c:	8b 00                	mov    (%eax),%eax
+  80049e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004a7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004ad:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b1:	79 9b                	jns    80044e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004b3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004c0:	eb 8c                	jmp    80044e <vprintfmt+0x54>
+			if (width < 0)
+  8004c2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c5:	85 d2                	test   %edx,%edx
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	0f 49 c2             	cmovns %edx,%eax
+  8004cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8004d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d5:	e9 74 ff ff ff       	jmp    80044e <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8004da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004dd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004e4:	e9 65 ff ff ff       	jmp    80044e <vprintfmt+0x54>
+  8004e9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ef:	eb bc                	jmp    8004ad <vprintfmt+0xb3>
+			lflag++;
+  8004f1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8004f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004f7:	e9 52 ff ff ff       	jmp    80044e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ff:	8d 78 04             	lea    0x4(%eax),%edi
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	53                   	push   %ebx
+  800506:	ff 30                	push   (%eax)
+  800508:	ff d6                	call   *%esi
+			break;
+  80050a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80050d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800510:	e9 b1 02 00 00       	jmp    8007c6 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80051b:	8b 10                	mov    (%eax),%edx
+  80051d:	89 d0                	mov    %edx,%eax
+  80051f:	f7 d8                	neg    %eax
+  800521:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800524:	83 f8 14             	cmp    $0x14,%eax
+  800527:	7f 23                	jg     80054c <vprintfmt+0x152>
+  800529:	8b 14 85 80 4b 80 00 	mov    0x804b80(,%eax,4),%edx
+  800530:	85 d2                	test   %edx,%edx
+  800532:	74 18                	je     80054c <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800534:	52                   	push   %edx
+  800535:	68 ef 4c 80 00       	push   $0x804cef
+  80053a:	53                   	push   %ebx
+  80053b:	56                   	push   %esi
+  80053c:	e8 9c fe ff ff       	call   8003dd <printfmt>
+  800541:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800544:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800547:	e9 7a 02 00 00       	jmp    8007c6 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80054c:	50                   	push   %eax
+  80054d:	68 b7 48 80 00       	push   $0x8048b7
+  800552:	53                   	push   %ebx
+  800553:	56                   	push   %esi
+  800554:	e8 84 fe ff ff       	call   8003dd <printfmt>
+  800559:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80055f:	e9 62 02 00 00       	jmp    8007c6 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	83 c0 04             	add    $0x4,%eax
+  80056a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80056d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800570:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800572:	85 c9                	test   %ecx,%ecx
+  800574:	b8 b0 48 80 00       	mov    $0x8048b0,%eax
+  800579:	0f 45 c1             	cmovne %ecx,%eax
+  80057c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80057f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800583:	7e 06                	jle    80058b <vprintfmt+0x191>
+  800585:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800589:	75 0b                	jne    800596 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80058e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800591:	89 75 08             	mov    %esi,0x8(%ebp)
+  800594:	eb 5c                	jmp    8005f2 <vprintfmt+0x1f8>
+  800596:	83 ec 08             	sub    $0x8,%esp
+  800599:	ff 75 d0             	push   -0x30(%ebp)
+  80059c:	ff 75 cc             	push   -0x34(%ebp)
+  80059f:	e8 20 03 00 00       	call   8008c4 <strnlen>
+  8005a4:	89 c2                	mov    %eax,%edx
+  8005a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a9:	29 d0                	sub    %edx,%eax
+  8005ab:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005ae:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ba:	eb 0e                	jmp    8005ca <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8005bc:	83 ec 08             	sub    $0x8,%esp
+  8005bf:	53                   	push   %ebx
+  8005c0:	57                   	push   %edi
+  8005c1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c4:	83 ee 01             	sub    $0x1,%esi
+  8005c7:	83 c4 10             	add    $0x10,%esp
+  8005ca:	85 f6                	test   %esi,%esi
+  8005cc:	7f ee                	jg     8005bc <vprintfmt+0x1c2>
+  8005ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d4:	85 c0                	test   %eax,%eax
+  8005d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005db:	0f 49 d0             	cmovns %eax,%edx
+  8005de:	29 d0                	sub    %edx,%eax
+  8005e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e3:	eb a6                	jmp    80058b <vprintfmt+0x191>
+					putch(ch, putdat);
+  8005e5:	83 ec 08             	sub    $0x8,%esp
+  8005e8:	53                   	push   %ebx
+  8005e9:	52                   	push   %edx
+  8005ea:	ff 55 08             	call   *0x8(%ebp)
+  8005ed:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005f0:	89 f1                	mov    %esi,%ecx
+  8005f2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005f5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005f9:	0f be d0             	movsbl %al,%edx
+  8005fc:	85 d2                	test   %edx,%edx
+  8005fe:	74 28                	je     800628 <vprintfmt+0x22e>
+  800600:	85 ff                	test   %edi,%edi
+  800602:	78 05                	js     800609 <vprintfmt+0x20f>
+  800604:	83 ef 01             	sub    $0x1,%edi
+  800607:	78 30                	js     800639 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800609:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80060d:	74 d6                	je     8005e5 <vprintfmt+0x1eb>
+  80060f:	0f be c0             	movsbl %al,%eax
+  800612:	83 e8 20             	sub    $0x20,%eax
+  800615:	83 f8 5e             	cmp    $0x5e,%eax
+  800618:	76 cb                	jbe    8005e5 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 3f                	push   $0x3f
+  800620:	ff 55 08             	call   *0x8(%ebp)
+  800623:	83 c4 10             	add    $0x10,%esp
+  800626:	eb c8                	jmp    8005f0 <vprintfmt+0x1f6>
+  800628:	8b 75 08             	mov    0x8(%ebp),%esi
+  80062b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80062e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800631:	01 d0                	add    %edx,%eax
+  800633:	29 c8                	sub    %ecx,%eax
+  800635:	89 c7                	mov    %eax,%edi
+  800637:	eb 13                	jmp    80064c <vprintfmt+0x252>
+  800639:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063c:	eb ed                	jmp    80062b <vprintfmt+0x231>
+				putch(' ', putdat);
+  80063e:	83 ec 08             	sub    $0x8,%esp
+  800641:	53                   	push   %ebx
+  800642:	6a 20                	push   $0x20
+  800644:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800646:	83 ef 01             	sub    $0x1,%edi
+  800649:	83 c4 10             	add    $0x10,%esp
+  80064c:	85 ff                	test   %edi,%edi
+  80064e:	7f ee                	jg     80063e <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800650:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+  800656:	e9 6b 01 00 00       	jmp    8007c6 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80065b:	83 f9 01             	cmp    $0x1,%ecx
+  80065e:	7f 1f                	jg     80067f <vprintfmt+0x285>
+	else if (lflag)
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	74 67                	je     8006cb <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 00                	mov    (%eax),%eax
+  800669:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066c:	89 c1                	mov    %eax,%ecx
+  80066e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800671:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8d 40 04             	lea    0x4(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067d:	eb 17                	jmp    800696 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 50 04             	mov    0x4(%eax),%edx
+  800685:	8b 00                	mov    (%eax),%eax
+  800687:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8d 40 08             	lea    0x8(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800696:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800699:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80069c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006a1:	85 c9                	test   %ecx,%ecx
+  8006a3:	0f 89 03 01 00 00    	jns    8007ac <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006a9:	83 ec 08             	sub    $0x8,%esp
+  8006ac:	53                   	push   %ebx
+  8006ad:	6a 2d                	push   $0x2d
+  8006af:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006b7:	f7 da                	neg    %edx
+  8006b9:	83 d1 00             	adc    $0x0,%ecx
+  8006bc:	f7 d9                	neg    %ecx
+  8006be:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006c6:	e9 e1 00 00 00       	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 00                	mov    (%eax),%eax
+  8006d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d3:	89 c1                	mov    %eax,%ecx
+  8006d5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e4:	eb b0                	jmp    800696 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8006e6:	83 f9 01             	cmp    $0x1,%ecx
+  8006e9:	7f 1e                	jg     800709 <vprintfmt+0x30f>
+	else if (lflag)
+  8006eb:	85 c9                	test   %ecx,%ecx
+  8006ed:	74 32                	je     800721 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800704:	e9 a3 00 00 00       	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8b 10                	mov    (%eax),%edx
+  80070e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800711:	8d 40 08             	lea    0x8(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800717:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80071c:	e9 8b 00 00 00       	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800731:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800736:	eb 74                	jmp    8007ac <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800738:	83 f9 01             	cmp    $0x1,%ecx
+  80073b:	7f 1b                	jg     800758 <vprintfmt+0x35e>
+	else if (lflag)
+  80073d:	85 c9                	test   %ecx,%ecx
+  80073f:	74 2c                	je     80076d <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8b 10                	mov    (%eax),%edx
+  800746:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074b:	8d 40 04             	lea    0x4(%eax),%eax
+  80074e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800751:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800756:	eb 54                	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800758:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075b:	8b 10                	mov    (%eax),%edx
+  80075d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800760:	8d 40 08             	lea    0x8(%eax),%eax
+  800763:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800766:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80076b:	eb 3f                	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 10                	mov    (%eax),%edx
+  800772:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800782:	eb 28                	jmp    8007ac <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	53                   	push   %ebx
+  800788:	6a 30                	push   $0x30
+  80078a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80078c:	83 c4 08             	add    $0x8,%esp
+  80078f:	53                   	push   %ebx
+  800790:	6a 78                	push   $0x78
+  800792:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 10                	mov    (%eax),%edx
+  800799:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80079e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007ac:	83 ec 0c             	sub    $0xc,%esp
+  8007af:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007b3:	50                   	push   %eax
+  8007b4:	ff 75 e0             	push   -0x20(%ebp)
+  8007b7:	57                   	push   %edi
+  8007b8:	51                   	push   %ecx
+  8007b9:	52                   	push   %edx
+  8007ba:	89 da                	mov    %ebx,%edx
+  8007bc:	89 f0                	mov    %esi,%eax
+  8007be:	e8 54 fb ff ff       	call   800317 <printnum>
+			break;
+  8007c3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8007c9:	e9 4a fc ff ff       	jmp    800418 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007ce:	83 f9 01             	cmp    $0x1,%ecx
+  8007d1:	7f 1b                	jg     8007ee <vprintfmt+0x3f4>
+	else if (lflag)
+  8007d3:	85 c9                	test   %ecx,%ecx
+  8007d5:	74 2c                	je     800803 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8007d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007da:	8b 10                	mov    (%eax),%edx
+  8007dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ec:	eb be                	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f1:	8b 10                	mov    (%eax),%edx
+  8007f3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800801:	eb a9                	jmp    8007ac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8b 10                	mov    (%eax),%edx
+  800808:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080d:	8d 40 04             	lea    0x4(%eax),%eax
+  800810:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800813:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800818:	eb 92                	jmp    8007ac <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80081a:	83 ec 08             	sub    $0x8,%esp
+  80081d:	53                   	push   %ebx
+  80081e:	6a 25                	push   $0x25
+  800820:	ff d6                	call   *%esi
+			break;
+  800822:	83 c4 10             	add    $0x10,%esp
+  800825:	eb 9f                	jmp    8007c6 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800827:	83 ec 08             	sub    $0x8,%esp
+  80082a:	53                   	push   %ebx
+  80082b:	6a 25                	push   $0x25
+  80082d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80082f:	83 c4 10             	add    $0x10,%esp
+  800832:	89 f8                	mov    %edi,%eax
+  800834:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800838:	74 05                	je     80083f <vprintfmt+0x445>
+  80083a:	83 e8 01             	sub    $0x1,%eax
+  80083d:	eb f5                	jmp    800834 <vprintfmt+0x43a>
+  80083f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800842:	eb 82                	jmp    8007c6 <vprintfmt+0x3cc>
+
+00800844 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	83 ec 18             	sub    $0x18,%esp
+  80084a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800850:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800853:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800857:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80085a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800861:	85 c0                	test   %eax,%eax
+  800863:	74 26                	je     80088b <vsnprintf+0x47>
+  800865:	85 d2                	test   %edx,%edx
+  800867:	7e 22                	jle    80088b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800869:	ff 75 14             	push   0x14(%ebp)
+  80086c:	ff 75 10             	push   0x10(%ebp)
+  80086f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800872:	50                   	push   %eax
+  800873:	68 c0 03 80 00       	push   $0x8003c0
+  800878:	e8 7d fb ff ff       	call   8003fa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80087d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800880:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800883:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800886:	83 c4 10             	add    $0x10,%esp
+}
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+		return -E_INVAL;
+  80088b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800890:	eb f7                	jmp    800889 <vsnprintf+0x45>
+
+00800892 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800898:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80089b:	50                   	push   %eax
+  80089c:	ff 75 10             	push   0x10(%ebp)
+  80089f:	ff 75 0c             	push   0xc(%ebp)
+  8008a2:	ff 75 08             	push   0x8(%ebp)
+  8008a5:	e8 9a ff ff ff       	call   800844 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+
+008008ac <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008ac:	55                   	push   %ebp
+  8008ad:	89 e5                	mov    %esp,%ebp
+  8008af:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b7:	eb 03                	jmp    8008bc <strlen+0x10>
+		n++;
+  8008b9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008bc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c0:	75 f7                	jne    8008b9 <strlen+0xd>
+	return n;
+}
+  8008c2:	5d                   	pop    %ebp
+  8008c3:	c3                   	ret
+
+008008c4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d2:	eb 03                	jmp    8008d7 <strnlen+0x13>
+		n++;
+  8008d4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d7:	39 d0                	cmp    %edx,%eax
+  8008d9:	74 08                	je     8008e3 <strnlen+0x1f>
+  8008db:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008df:	75 f3                	jne    8008d4 <strnlen+0x10>
+  8008e1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008e3:	89 d0                	mov    %edx,%eax
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	53                   	push   %ebx
+  8008eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008fa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008fd:	83 c0 01             	add    $0x1,%eax
+  800900:	84 d2                	test   %dl,%dl
+  800902:	75 f2                	jne    8008f6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800904:	89 c8                	mov    %ecx,%eax
+  800906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+
+0080090b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	53                   	push   %ebx
+  80090f:	83 ec 10             	sub    $0x10,%esp
+  800912:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800915:	53                   	push   %ebx
+  800916:	e8 91 ff ff ff       	call   8008ac <strlen>
+  80091b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80091e:	ff 75 0c             	push   0xc(%ebp)
+  800921:	01 d8                	add    %ebx,%eax
+  800923:	50                   	push   %eax
+  800924:	e8 be ff ff ff       	call   8008e7 <strcpy>
+	return dst;
+}
+  800929:	89 d8                	mov    %ebx,%eax
+  80092b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092e:	c9                   	leave
+  80092f:	c3                   	ret
+
+00800930 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	56                   	push   %esi
+  800934:	53                   	push   %ebx
+  800935:	8b 75 08             	mov    0x8(%ebp),%esi
+  800938:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80093b:	89 f3                	mov    %esi,%ebx
+  80093d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800940:	89 f0                	mov    %esi,%eax
+  800942:	eb 0f                	jmp    800953 <strncpy+0x23>
+		*dst++ = *src;
+  800944:	83 c0 01             	add    $0x1,%eax
+  800947:	0f b6 0a             	movzbl (%edx),%ecx
+  80094a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80094d:	80 f9 01             	cmp    $0x1,%cl
+  800950:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800953:	39 d8                	cmp    %ebx,%eax
+  800955:	75 ed                	jne    800944 <strncpy+0x14>
+	}
+	return ret;
+}
+  800957:	89 f0                	mov    %esi,%eax
+  800959:	5b                   	pop    %ebx
+  80095a:	5e                   	pop    %esi
+  80095b:	5d                   	pop    %ebp
+  80095c:	c3                   	ret
+
+0080095d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	56                   	push   %esi
+  800961:	53                   	push   %ebx
+  800962:	8b 75 08             	mov    0x8(%ebp),%esi
+  800965:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800968:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80096b:	89 f0                	mov    %esi,%eax
+  80096d:	85 d2                	test   %edx,%edx
+  80096f:	74 21                	je     800992 <strlcpy+0x35>
+  800971:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800975:	89 f2                	mov    %esi,%edx
+  800977:	eb 09                	jmp    800982 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800979:	83 c1 01             	add    $0x1,%ecx
+  80097c:	83 c2 01             	add    $0x1,%edx
+  80097f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800982:	39 c2                	cmp    %eax,%edx
+  800984:	74 09                	je     80098f <strlcpy+0x32>
+  800986:	0f b6 19             	movzbl (%ecx),%ebx
+  800989:	84 db                	test   %bl,%bl
+  80098b:	75 ec                	jne    800979 <strlcpy+0x1c>
+  80098d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80098f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800992:	29 f0                	sub    %esi,%eax
+}
+  800994:	5b                   	pop    %ebx
+  800995:	5e                   	pop    %esi
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80099e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a1:	eb 06                	jmp    8009a9 <strcmp+0x11>
+		p++, q++;
+  8009a3:	83 c1 01             	add    $0x1,%ecx
+  8009a6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009a9:	0f b6 01             	movzbl (%ecx),%eax
+  8009ac:	84 c0                	test   %al,%al
+  8009ae:	74 04                	je     8009b4 <strcmp+0x1c>
+  8009b0:	3a 02                	cmp    (%edx),%al
+  8009b2:	74 ef                	je     8009a3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b4:	0f b6 c0             	movzbl %al,%eax
+  8009b7:	0f b6 12             	movzbl (%edx),%edx
+  8009ba:	29 d0                	sub    %edx,%eax
+}
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+
+008009be <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009be:	55                   	push   %ebp
+  8009bf:	89 e5                	mov    %esp,%ebp
+  8009c1:	53                   	push   %ebx
+  8009c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009cb:	eb 09                	jmp    8009d6 <strncmp+0x18>
+		n--, p++, q++;
+  8009cd:	83 ea 01             	sub    $0x1,%edx
+  8009d0:	83 c0 01             	add    $0x1,%eax
+  8009d3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009d6:	85 d2                	test   %edx,%edx
+  8009d8:	74 18                	je     8009f2 <strncmp+0x34>
+  8009da:	0f b6 18             	movzbl (%eax),%ebx
+  8009dd:	84 db                	test   %bl,%bl
+  8009df:	74 04                	je     8009e5 <strncmp+0x27>
+  8009e1:	3a 19                	cmp    (%ecx),%bl
+  8009e3:	74 e8                	je     8009cd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e5:	0f b6 00             	movzbl (%eax),%eax
+  8009e8:	0f b6 11             	movzbl (%ecx),%edx
+  8009eb:	29 d0                	sub    %edx,%eax
+}
+  8009ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f0:	c9                   	leave
+  8009f1:	c3                   	ret
+		return 0;
+  8009f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f7:	eb f4                	jmp    8009ed <strncmp+0x2f>
+
+008009f9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ff:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a03:	eb 03                	jmp    800a08 <strchr+0xf>
+  800a05:	83 c0 01             	add    $0x1,%eax
+  800a08:	0f b6 10             	movzbl (%eax),%edx
+  800a0b:	84 d2                	test   %dl,%dl
+  800a0d:	74 06                	je     800a15 <strchr+0x1c>
+		if (*s == c)
+  800a0f:	38 ca                	cmp    %cl,%dl
+  800a11:	75 f2                	jne    800a05 <strchr+0xc>
+  800a13:	eb 05                	jmp    800a1a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1a:	5d                   	pop    %ebp
+  800a1b:	c3                   	ret
+
+00800a1c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a22:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a26:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a29:	38 ca                	cmp    %cl,%dl
+  800a2b:	74 09                	je     800a36 <strfind+0x1a>
+  800a2d:	84 d2                	test   %dl,%dl
+  800a2f:	74 05                	je     800a36 <strfind+0x1a>
+	for (; *s; s++)
+  800a31:	83 c0 01             	add    $0x1,%eax
+  800a34:	eb f0                	jmp    800a26 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a36:	5d                   	pop    %ebp
+  800a37:	c3                   	ret
+
+00800a38 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	57                   	push   %edi
+  800a3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a42:	85 c9                	test   %ecx,%ecx
+  800a44:	74 20                	je     800a66 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a46:	89 f8                	mov    %edi,%eax
+  800a48:	09 c8                	or     %ecx,%eax
+  800a4a:	a8 03                	test   $0x3,%al
+  800a4c:	75 12                	jne    800a60 <memset+0x28>
+		c &= 0xFF;
+  800a4e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a52:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a58:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a5b:	fc                   	cld
+  800a5c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a5e:	eb 06                	jmp    800a66 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a63:	fc                   	cld
+  800a64:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a66:	89 f8                	mov    %edi,%eax
+  800a68:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+
+00800a6d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	56                   	push   %esi
+  800a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a75:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a7b:	39 c6                	cmp    %eax,%esi
+  800a7d:	73 32                	jae    800ab1 <memmove+0x44>
+  800a7f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a82:	39 d0                	cmp    %edx,%eax
+  800a84:	73 2b                	jae    800ab1 <memmove+0x44>
+		s += n;
+		d += n;
+  800a86:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a89:	89 d6                	mov    %edx,%esi
+  800a8b:	09 fe                	or     %edi,%esi
+  800a8d:	09 ce                	or     %ecx,%esi
+  800a8f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a95:	75 0e                	jne    800aa5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a97:	83 ef 04             	sub    $0x4,%edi
+  800a9a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a9d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aa0:	fd                   	std
+  800aa1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa3:	eb 09                	jmp    800aae <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aa5:	83 ef 01             	sub    $0x1,%edi
+  800aa8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aab:	fd                   	std
+  800aac:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aae:	fc                   	cld
+  800aaf:	eb 1a                	jmp    800acb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab1:	89 f2                	mov    %esi,%edx
+  800ab3:	09 c2                	or     %eax,%edx
+  800ab5:	09 ca                	or     %ecx,%edx
+  800ab7:	f6 c2 03             	test   $0x3,%dl
+  800aba:	75 0a                	jne    800ac6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800abc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800abf:	89 c7                	mov    %eax,%edi
+  800ac1:	fc                   	cld
+  800ac2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac4:	eb 05                	jmp    800acb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ac6:	89 c7                	mov    %eax,%edi
+  800ac8:	fc                   	cld
+  800ac9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800acb:	5e                   	pop    %esi
+  800acc:	5f                   	pop    %edi
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+
+00800acf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ad5:	ff 75 10             	push   0x10(%ebp)
+  800ad8:	ff 75 0c             	push   0xc(%ebp)
+  800adb:	ff 75 08             	push   0x8(%ebp)
+  800ade:	e8 8a ff ff ff       	call   800a6d <memmove>
+}
+  800ae3:	c9                   	leave
+  800ae4:	c3                   	ret
+
+00800ae5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	56                   	push   %esi
+  800ae9:	53                   	push   %ebx
+  800aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800af0:	89 c6                	mov    %eax,%esi
+  800af2:	03 75 10             	add    0x10(%ebp),%esi
+  800af5:	eb 06                	jmp    800afd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800af7:	83 c0 01             	add    $0x1,%eax
+  800afa:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800afd:	39 f0                	cmp    %esi,%eax
+  800aff:	74 14                	je     800b15 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b01:	0f b6 08             	movzbl (%eax),%ecx
+  800b04:	0f b6 1a             	movzbl (%edx),%ebx
+  800b07:	38 d9                	cmp    %bl,%cl
+  800b09:	74 ec                	je     800af7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b0b:	0f b6 c1             	movzbl %cl,%eax
+  800b0e:	0f b6 db             	movzbl %bl,%ebx
+  800b11:	29 d8                	sub    %ebx,%eax
+  800b13:	eb 05                	jmp    800b1a <memcmp+0x35>
+	}
+
+	return 0;
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1a:	5b                   	pop    %ebx
+  800b1b:	5e                   	pop    %esi
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2c:	eb 03                	jmp    800b31 <memfind+0x13>
+  800b2e:	83 c0 01             	add    $0x1,%eax
+  800b31:	39 d0                	cmp    %edx,%eax
+  800b33:	73 04                	jae    800b39 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b35:	38 08                	cmp    %cl,(%eax)
+  800b37:	75 f5                	jne    800b2e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b39:	5d                   	pop    %ebp
+  800b3a:	c3                   	ret
+
+00800b3b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	57                   	push   %edi
+  800b3f:	56                   	push   %esi
+  800b40:	53                   	push   %ebx
+  800b41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b47:	eb 03                	jmp    800b4c <strtol+0x11>
+		s++;
+  800b49:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b4c:	0f b6 02             	movzbl (%edx),%eax
+  800b4f:	3c 20                	cmp    $0x20,%al
+  800b51:	74 f6                	je     800b49 <strtol+0xe>
+  800b53:	3c 09                	cmp    $0x9,%al
+  800b55:	74 f2                	je     800b49 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b57:	3c 2b                	cmp    $0x2b,%al
+  800b59:	74 2a                	je     800b85 <strtol+0x4a>
+	int neg = 0;
+  800b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b60:	3c 2d                	cmp    $0x2d,%al
+  800b62:	74 2b                	je     800b8f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b64:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b6a:	75 0f                	jne    800b7b <strtol+0x40>
+  800b6c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b6f:	74 28                	je     800b99 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b71:	85 db                	test   %ebx,%ebx
+  800b73:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b78:	0f 44 d8             	cmove  %eax,%ebx
+  800b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b80:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b83:	eb 46                	jmp    800bcb <strtol+0x90>
+		s++;
+  800b85:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8d:	eb d5                	jmp    800b64 <strtol+0x29>
+		s++, neg = 1;
+  800b8f:	83 c2 01             	add    $0x1,%edx
+  800b92:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b97:	eb cb                	jmp    800b64 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b99:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b9d:	74 0e                	je     800bad <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b9f:	85 db                	test   %ebx,%ebx
+  800ba1:	75 d8                	jne    800b7b <strtol+0x40>
+		s++, base = 8;
+  800ba3:	83 c2 01             	add    $0x1,%edx
+  800ba6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bab:	eb ce                	jmp    800b7b <strtol+0x40>
+		s += 2, base = 16;
+  800bad:	83 c2 02             	add    $0x2,%edx
+  800bb0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bb5:	eb c4                	jmp    800b7b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bb7:	0f be c0             	movsbl %al,%eax
+  800bba:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bbd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc0:	7d 3a                	jge    800bfc <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bc2:	83 c2 01             	add    $0x1,%edx
+  800bc5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bc9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bcb:	0f b6 02             	movzbl (%edx),%eax
+  800bce:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd1:	89 f3                	mov    %esi,%ebx
+  800bd3:	80 fb 09             	cmp    $0x9,%bl
+  800bd6:	76 df                	jbe    800bb7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bdb:	89 f3                	mov    %esi,%ebx
+  800bdd:	80 fb 19             	cmp    $0x19,%bl
+  800be0:	77 08                	ja     800bea <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800be2:	0f be c0             	movsbl %al,%eax
+  800be5:	83 e8 57             	sub    $0x57,%eax
+  800be8:	eb d3                	jmp    800bbd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bea:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bed:	89 f3                	mov    %esi,%ebx
+  800bef:	80 fb 19             	cmp    $0x19,%bl
+  800bf2:	77 08                	ja     800bfc <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bf4:	0f be c0             	movsbl %al,%eax
+  800bf7:	83 e8 37             	sub    $0x37,%eax
+  800bfa:	eb c1                	jmp    800bbd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bfc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c00:	74 05                	je     800c07 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c05:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c07:	89 c8                	mov    %ecx,%eax
+  800c09:	f7 d8                	neg    %eax
+  800c0b:	85 ff                	test   %edi,%edi
+  800c0d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c10:	89 c8                	mov    %ecx,%eax
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c1d:	6a 00                	push   $0x0
+  800c1f:	6a 00                	push   $0x0
+  800c21:	ff 75 08             	push   0x8(%ebp)
+  800c24:	e8 12 ff ff ff       	call   800b3b <strtol>
+}
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+
+00800c2b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	57                   	push   %edi
+  800c2f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	89 c3                	mov    %eax,%ebx
+  800c3d:	89 c7                	mov    %eax,%edi
+  800c3f:	6a 00                	push   $0x0
+  800c41:	55                   	push   %ebp
+  800c42:	56                   	push   %esi
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	8d 35 4d 0c 80 00    	lea    0x800c4d,%esi
+  800c4b:	0f 34                	sysenter
+
+00800c4d <after_sysenter_label_47>:
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c52:	5b                   	pop    %ebx
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c65:	89 d1                	mov    %edx,%ecx
+  800c67:	89 d3                	mov    %edx,%ebx
+  800c69:	89 d7                	mov    %edx,%edi
+  800c6b:	6a 00                	push   $0x0
+  800c6d:	55                   	push   %ebp
+  800c6e:	56                   	push   %esi
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	8d 35 79 0c 80 00    	lea    0x800c79,%esi
+  800c77:	0f 34                	sysenter
+
+00800c79 <after_sysenter_label_128>:
+  800c79:	5e                   	pop    %esi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c7e:	5b                   	pop    %ebx
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+
+00800c82 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c94:	89 cb                	mov    %ecx,%ebx
+  800c96:	89 cf                	mov    %ecx,%edi
+  800c98:	6a 00                	push   $0x0
+  800c9a:	55                   	push   %ebp
+  800c9b:	56                   	push   %esi
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	8d 35 a6 0c 80 00    	lea    0x800ca6,%esi
+  800ca4:	0f 34                	sysenter
+
+00800ca6 <after_sysenter_label_212>:
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cab:	85 c0                	test   %eax,%eax
+  800cad:	7f 07                	jg     800cb6 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800caf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+  800cb9:	50                   	push   %eax
+  800cba:	6a 03                	push   $0x3
+  800cbc:	68 15 4c 80 00       	push   $0x804c15
+  800cc1:	6a 54                	push   $0x54
+  800cc3:	68 32 4c 80 00       	push   $0x804c32
+  800cc8:	e8 5b f5 ff ff       	call   800228 <_panic>
+
+00800ccd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cdc:	89 d1                	mov    %edx,%ecx
+  800cde:	89 d3                	mov    %edx,%ebx
+  800ce0:	89 d7                	mov    %edx,%edi
+  800ce2:	6a 00                	push   $0x0
+  800ce4:	55                   	push   %ebp
+  800ce5:	56                   	push   %esi
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	8d 35 f0 0c 80 00    	lea    0x800cf0,%esi
+  800cee:	0f 34                	sysenter
+
+00800cf0 <after_sysenter_label_309>:
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+
+00800cf9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d03:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d08:	89 d1                	mov    %edx,%ecx
+  800d0a:	89 d3                	mov    %edx,%ebx
+  800d0c:	89 d7                	mov    %edx,%edi
+  800d0e:	6a 00                	push   $0x0
+  800d10:	55                   	push   %ebp
+  800d11:	56                   	push   %esi
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	8d 35 1c 0d 80 00    	lea    0x800d1c,%esi
+  800d1a:	0f 34                	sysenter
+
+00800d1c <after_sysenter_label_391>:
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d21:	5b                   	pop    %ebx
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+
+00800d25 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d30:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3d:	6a 00                	push   $0x0
+  800d3f:	55                   	push   %ebp
+  800d40:	56                   	push   %esi
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	8d 35 4b 0d 80 00    	lea    0x800d4b,%esi
+  800d49:	0f 34                	sysenter
+
+00800d4b <after_sysenter_label_479>:
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d50:	85 c0                	test   %eax,%eax
+  800d52:	7f 07                	jg     800d5b <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d57:	5b                   	pop    %ebx
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5b:	83 ec 0c             	sub    $0xc,%esp
+  800d5e:	50                   	push   %eax
+  800d5f:	6a 04                	push   $0x4
+  800d61:	68 15 4c 80 00       	push   $0x804c15
+  800d66:	6a 54                	push   $0x54
+  800d68:	68 32 4c 80 00       	push   $0x804c32
+  800d6d:	e8 b6 f4 ff ff       	call   800228 <_panic>
+
+00800d72 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d85:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d88:	ff 75 18             	push   0x18(%ebp)
+  800d8b:	55                   	push   %ebp
+  800d8c:	56                   	push   %esi
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	8d 35 97 0d 80 00    	lea    0x800d97,%esi
+  800d95:	0f 34                	sysenter
+
+00800d97 <after_sysenter_label_593>:
+  800d97:	5e                   	pop    %esi
+  800d98:	5d                   	pop    %ebp
+  800d99:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	7f 07                	jg     800da7 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da3:	5b                   	pop    %ebx
+  800da4:	5f                   	pop    %edi
+  800da5:	5d                   	pop    %ebp
+  800da6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da7:	83 ec 0c             	sub    $0xc,%esp
+  800daa:	50                   	push   %eax
+  800dab:	6a 05                	push   $0x5
+  800dad:	68 15 4c 80 00       	push   $0x804c15
+  800db2:	6a 54                	push   $0x54
+  800db4:	68 32 4c 80 00       	push   $0x804c32
+  800db9:	e8 6a f4 ff ff       	call   800228 <_panic>
+
+00800dbe <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dce:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd3:	89 df                	mov    %ebx,%edi
+  800dd5:	6a 00                	push   $0x0
+  800dd7:	55                   	push   %ebp
+  800dd8:	56                   	push   %esi
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	8d 35 e3 0d 80 00    	lea    0x800de3,%esi
+  800de1:	0f 34                	sysenter
+
+00800de3 <after_sysenter_label_704>:
+  800de3:	5e                   	pop    %esi
+  800de4:	5d                   	pop    %ebp
+  800de5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	7f 07                	jg     800df3 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800def:	5b                   	pop    %ebx
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+  800df6:	50                   	push   %eax
+  800df7:	6a 06                	push   $0x6
+  800df9:	68 15 4c 80 00       	push   $0x804c15
+  800dfe:	6a 54                	push   $0x54
+  800e00:	68 32 4c 80 00       	push   $0x804c32
+  800e05:	e8 1e f4 ff ff       	call   800228 <_panic>
+
+00800e0a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e1f:	89 df                	mov    %ebx,%edi
+  800e21:	6a 00                	push   $0x0
+  800e23:	55                   	push   %ebp
+  800e24:	56                   	push   %esi
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	8d 35 2f 0e 80 00    	lea    0x800e2f,%esi
+  800e2d:	0f 34                	sysenter
+
+00800e2f <after_sysenter_label_808>:
+  800e2f:	5e                   	pop    %esi
+  800e30:	5d                   	pop    %ebp
+  800e31:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e34:	85 c0                	test   %eax,%eax
+  800e36:	7f 07                	jg     800e3f <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+  800e42:	50                   	push   %eax
+  800e43:	6a 08                	push   $0x8
+  800e45:	68 15 4c 80 00       	push   $0x804c15
+  800e4a:	6a 54                	push   $0x54
+  800e4c:	68 32 4c 80 00       	push   $0x804c32
+  800e51:	e8 d2 f3 ff ff       	call   800228 <_panic>
+
+00800e56 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e6b:	89 df                	mov    %ebx,%edi
+  800e6d:	6a 00                	push   $0x0
+  800e6f:	55                   	push   %ebp
+  800e70:	56                   	push   %esi
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	8d 35 7b 0e 80 00    	lea    0x800e7b,%esi
+  800e79:	0f 34                	sysenter
+
+00800e7b <after_sysenter_label_912>:
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5d                   	pop    %ebp
+  800e7d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	7f 07                	jg     800e8b <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e87:	5b                   	pop    %ebx
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	50                   	push   %eax
+  800e8f:	6a 09                	push   $0x9
+  800e91:	68 15 4c 80 00       	push   $0x804c15
+  800e96:	6a 54                	push   $0x54
+  800e98:	68 32 4c 80 00       	push   $0x804c32
+  800e9d:	e8 86 f3 ff ff       	call   800228 <_panic>
+
+00800ea2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb7:	89 df                	mov    %ebx,%edi
+  800eb9:	6a 00                	push   $0x0
+  800ebb:	55                   	push   %ebp
+  800ebc:	56                   	push   %esi
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	8d 35 c7 0e 80 00    	lea    0x800ec7,%esi
+  800ec5:	0f 34                	sysenter
+
+00800ec7 <after_sysenter_label_1016>:
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	7f 07                	jg     800ed7 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ed0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 0a                	push   $0xa
+  800edd:	68 15 4c 80 00       	push   $0x804c15
+  800ee2:	6a 54                	push   $0x54
+  800ee4:	68 32 4c 80 00       	push   $0x804c32
+  800ee9:	e8 3a f3 ff ff       	call   800228 <_panic>
+
+00800eee <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800efe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f01:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f04:	6a 00                	push   $0x0
+  800f06:	55                   	push   %ebp
+  800f07:	56                   	push   %esi
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	8d 35 12 0f 80 00    	lea    0x800f12,%esi
+  800f10:	0f 34                	sysenter
+
+00800f12 <after_sysenter_label_1126>:
+  800f12:	5e                   	pop    %esi
+  800f13:	5d                   	pop    %ebp
+  800f14:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f17:	5b                   	pop    %ebx
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f28:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f2d:	89 cb                	mov    %ecx,%ebx
+  800f2f:	89 cf                	mov    %ecx,%edi
+  800f31:	6a 00                	push   $0x0
+  800f33:	55                   	push   %ebp
+  800f34:	56                   	push   %esi
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	8d 35 3f 0f 80 00    	lea    0x800f3f,%esi
+  800f3d:	0f 34                	sysenter
+
+00800f3f <after_sysenter_label_1210>:
+  800f3f:	5e                   	pop    %esi
+  800f40:	5d                   	pop    %ebp
+  800f41:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	7f 07                	jg     800f4f <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+  800f52:	50                   	push   %eax
+  800f53:	6a 0d                	push   $0xd
+  800f55:	68 15 4c 80 00       	push   $0x804c15
+  800f5a:	6a 54                	push   $0x54
+  800f5c:	68 32 4c 80 00       	push   $0x804c32
+  800f61:	e8 c2 f2 ff ff       	call   800228 <_panic>
+
+00800f66 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	57                   	push   %edi
+  800f6a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f7b:	89 df                	mov    %ebx,%edi
+  800f7d:	6a 00                	push   $0x0
+  800f7f:	55                   	push   %ebp
+  800f80:	56                   	push   %esi
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	8d 35 8b 0f 80 00    	lea    0x800f8b,%esi
+  800f89:	0f 34                	sysenter
+
+00800f8b <after_sysenter_label_1311>:
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	7f 07                	jg     800f9b <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f97:	5b                   	pop    %ebx
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 42                	push   $0x42
+  800fa1:	68 15 4c 80 00       	push   $0x804c15
+  800fa6:	6a 54                	push   $0x54
+  800fa8:	68 32 4c 80 00       	push   $0x804c32
+  800fad:	e8 76 f2 ff ff       	call   800228 <_panic>
+
+00800fb2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fc1:	89 d1                	mov    %edx,%ecx
+  800fc3:	89 d3                	mov    %edx,%ebx
+  800fc5:	89 d7                	mov    %edx,%edi
+  800fc7:	6a 00                	push   $0x0
+  800fc9:	55                   	push   %ebp
+  800fca:	56                   	push   %esi
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	8d 35 d5 0f 80 00    	lea    0x800fd5,%esi
+  800fd3:	0f 34                	sysenter
+
+00800fd5 <after_sysenter_label_1411>:
+  800fd5:	5e                   	pop    %esi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+
+00800fde <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ff3:	89 df                	mov    %ebx,%edi
+  800ff5:	6a 00                	push   $0x0
+  800ff7:	55                   	push   %ebp
+  800ff8:	56                   	push   %esi
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	8d 35 03 10 80 00    	lea    0x801003,%esi
+  801001:	0f 34                	sysenter
+
+00801003 <after_sysenter_label_1497>:
+  801003:	5e                   	pop    %esi
+  801004:	5d                   	pop    %ebp
+  801005:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801008:	5b                   	pop    %ebx
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+
+0080100c <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801011:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801016:	8b 55 08             	mov    0x8(%ebp),%edx
+  801019:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801021:	89 df                	mov    %ebx,%edi
+  801023:	6a 00                	push   $0x0
+  801025:	55                   	push   %ebp
+  801026:	56                   	push   %esi
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	8d 35 31 10 80 00    	lea    0x801031,%esi
+  80102f:	0f 34                	sysenter
+
+00801031 <after_sysenter_label_1583>:
+  801031:	5e                   	pop    %esi
+  801032:	5d                   	pop    %ebp
+  801033:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801036:	5b                   	pop    %ebx
+  801037:	5f                   	pop    %edi
+  801038:	5d                   	pop    %ebp
+  801039:	c3                   	ret
+
+0080103a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 11 00 00 00       	mov    $0x11,%eax
+  80104a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80104f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801052:	6a 00                	push   $0x0
+  801054:	55                   	push   %ebp
+  801055:	56                   	push   %esi
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	8d 35 60 10 80 00    	lea    0x801060,%esi
+  80105e:	0f 34                	sysenter
+
+00801060 <after_sysenter_label_1672>:
+  801060:	5e                   	pop    %esi
+  801061:	5d                   	pop    %ebp
+  801062:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801065:	5b                   	pop    %ebx
+  801066:	5f                   	pop    %edi
+  801067:	5d                   	pop    %ebp
+  801068:	c3                   	ret
+
+00801069 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	57                   	push   %edi
+  80106d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	b8 12 00 00 00       	mov    $0x12,%eax
+  80107e:	89 df                	mov    %ebx,%edi
+  801080:	6a 00                	push   $0x0
+  801082:	55                   	push   %ebp
+  801083:	56                   	push   %esi
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	8d 35 8e 10 80 00    	lea    0x80108e,%esi
+  80108c:	0f 34                	sysenter
+
+0080108e <after_sysenter_label_1758>:
+  80108e:	5e                   	pop    %esi
+  80108f:	5d                   	pop    %ebp
+  801090:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801093:	5b                   	pop    %ebx
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010a9:	89 cb                	mov    %ecx,%ebx
+  8010ab:	89 cf                	mov    %ecx,%edi
+  8010ad:	6a 00                	push   $0x0
+  8010af:	55                   	push   %ebp
+  8010b0:	56                   	push   %esi
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	8d 35 bb 10 80 00    	lea    0x8010bb,%esi
+  8010b9:	0f 34                	sysenter
+
+008010bb <after_sysenter_label_1842>:
+  8010bb:	5e                   	pop    %esi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 07                	jg     8010cb <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8010c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 13                	push   $0x13
+  8010d1:	68 15 4c 80 00       	push   $0x804c15
+  8010d6:	6a 54                	push   $0x54
+  8010d8:	68 32 4c 80 00       	push   $0x804c32
+  8010dd:	e8 46 f1 ff ff       	call   800228 <_panic>
+
+008010e2 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ec:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010f1:	89 d1                	mov    %edx,%ecx
+  8010f3:	89 d3                	mov    %edx,%ebx
+  8010f5:	89 d7                	mov    %edx,%edi
+  8010f7:	6a 00                	push   $0x0
+  8010f9:	55                   	push   %ebp
+  8010fa:	56                   	push   %esi
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	8d 35 05 11 80 00    	lea    0x801105,%esi
+  801103:	0f 34                	sysenter
+
+00801105 <after_sysenter_label_1939>:
+  801105:	5e                   	pop    %esi
+  801106:	5d                   	pop    %ebp
+  801107:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80110a:	5b                   	pop    %ebx
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+
+0080110e <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80110e:	55                   	push   %ebp
+  80110f:	89 e5                	mov    %esp,%ebp
+  801111:	57                   	push   %edi
+  801112:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801119:	b8 15 00 00 00       	mov    $0x15,%eax
+  80111e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801123:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801126:	6a 00                	push   $0x0
+  801128:	55                   	push   %ebp
+  801129:	56                   	push   %esi
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	8d 35 34 11 80 00    	lea    0x801134,%esi
+  801132:	0f 34                	sysenter
+
+00801134 <after_sysenter_label_2028>:
+  801134:	5e                   	pop    %esi
+  801135:	5d                   	pop    %ebp
+  801136:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801139:	5b                   	pop    %ebx
+  80113a:	5f                   	pop    %edi
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	57                   	push   %edi
+  801141:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801152:	89 df                	mov    %ebx,%edi
+  801154:	6a 00                	push   $0x0
+  801156:	55                   	push   %ebp
+  801157:	56                   	push   %esi
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	8d 35 62 11 80 00    	lea    0x801162,%esi
+  801160:	0f 34                	sysenter
+
+00801162 <after_sysenter_label_2114>:
+  801162:	5e                   	pop    %esi
+  801163:	5d                   	pop    %ebp
+  801164:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801167:	5b                   	pop    %ebx
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+
+0080116b <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801180:	89 df                	mov    %ebx,%edi
+  801182:	6a 00                	push   $0x0
+  801184:	55                   	push   %ebp
+  801185:	56                   	push   %esi
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	8d 35 90 11 80 00    	lea    0x801190,%esi
+  80118e:	0f 34                	sysenter
+
+00801190 <after_sysenter_label_2200>:
+  801190:	5e                   	pop    %esi
+  801191:	5d                   	pop    %ebp
+  801192:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+
+00801199 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	57                   	push   %edi
+  80119d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80119e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011ae:	89 df                	mov    %ebx,%edi
+  8011b0:	6a 00                	push   $0x0
+  8011b2:	55                   	push   %ebp
+  8011b3:	56                   	push   %esi
+  8011b4:	89 e5                	mov    %esp,%ebp
+  8011b6:	8d 35 be 11 80 00    	lea    0x8011be,%esi
+  8011bc:	0f 34                	sysenter
+
+008011be <after_sysenter_label_2286>:
+  8011be:	5e                   	pop    %esi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8011c3:	5b                   	pop    %ebx
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+
+008011c7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011cd:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011d2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+
+008011d7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011dd:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011e2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011e7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+
+008011ee <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011f1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011f6:	eb 02                	jmp    8011fa <fd_alloc+0xc>
+  8011f8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011fa:	89 c2                	mov    %eax,%edx
+  8011fc:	c1 ea 16             	shr    $0x16,%edx
+  8011ff:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801206:	f6 c2 01             	test   $0x1,%dl
+  801209:	74 2b                	je     801236 <fd_alloc+0x48>
+  80120b:	89 c2                	mov    %eax,%edx
+  80120d:	c1 ea 0c             	shr    $0xc,%edx
+  801210:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801217:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80121d:	f6 c1 01             	test   $0x1,%cl
+  801220:	74 14                	je     801236 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801222:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801228:	75 ce                	jne    8011f8 <fd_alloc+0xa>
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80122f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801234:	eb 05                	jmp    80123b <fd_alloc+0x4d>
+			return 0;
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	89 02                	mov    %eax,(%edx)
+}
+  801240:	89 c8                	mov    %ecx,%eax
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+
+00801244 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80124a:	83 f8 1f             	cmp    $0x1f,%eax
+  80124d:	77 30                	ja     80127f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80124f:	c1 e0 0c             	shl    $0xc,%eax
+  801252:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801257:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80125d:	f6 c2 01             	test   $0x1,%dl
+  801260:	74 24                	je     801286 <fd_lookup+0x42>
+  801262:	89 c2                	mov    %eax,%edx
+  801264:	c1 ea 0c             	shr    $0xc,%edx
+  801267:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80126e:	f6 c2 01             	test   $0x1,%dl
+  801271:	74 1a                	je     80128d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801273:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801276:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801278:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+		return -E_INVAL;
+  80127f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801284:	eb f7                	jmp    80127d <fd_lookup+0x39>
+		return -E_INVAL;
+  801286:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128b:	eb f0                	jmp    80127d <fd_lookup+0x39>
+  80128d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801292:	eb e9                	jmp    80127d <fd_lookup+0x39>
+
+00801294 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	53                   	push   %ebx
+  801298:	83 ec 04             	sub    $0x4,%esp
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	eb 03                	jmp    8012a8 <dev_lookup+0x14>
+  8012a5:	83 c0 01             	add    $0x1,%eax
+  8012a8:	8b 1c 85 bc 4c 80 00 	mov    0x804cbc(,%eax,4),%ebx
+  8012af:	85 db                	test   %ebx,%ebx
+  8012b1:	74 0b                	je     8012be <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012b3:	39 13                	cmp    %edx,(%ebx)
+  8012b5:	75 ee                	jne    8012a5 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8012b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bc:	eb 49                	jmp    801307 <dev_lookup+0x73>
+  8012be:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8012c0:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8012c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8012cb:	77 18                	ja     8012e5 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8012cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8012d2:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8012d4:	c1 e8 10             	shr    $0x10,%eax
+  8012d7:	74 0c                	je     8012e5 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8012d9:	c1 e0 10             	shl    $0x10,%eax
+  8012dc:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8012e1:	29 c1                	sub    %eax,%ecx
+  8012e3:	eb 06                	jmp    8012eb <dev_lookup+0x57>
+		return pthread_main_tls;
+  8012e5:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012eb:	8b 01                	mov    (%ecx),%eax
+  8012ed:	8b 40 48             	mov    0x48(%eax),%eax
+  8012f0:	83 ec 04             	sub    $0x4,%esp
+  8012f3:	52                   	push   %edx
+  8012f4:	50                   	push   %eax
+  8012f5:	68 40 4c 80 00       	push   $0x804c40
+  8012fa:	e8 04 f0 ff ff       	call   800303 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012ff:	83 c4 10             	add    $0x10,%esp
+  801302:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801307:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130a:	89 1a                	mov    %ebx,(%edx)
+}
+  80130c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130f:	c9                   	leave
+  801310:	c3                   	ret
+
+00801311 <fd_close>:
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	57                   	push   %edi
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+  801317:	83 ec 24             	sub    $0x24,%esp
+  80131a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80131d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801320:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801323:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801324:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80132a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80132d:	50                   	push   %eax
+  80132e:	e8 11 ff ff ff       	call   801244 <fd_lookup>
+  801333:	89 c3                	mov    %eax,%ebx
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	78 05                	js     801341 <fd_close+0x30>
+	    || fd != fd2)
+  80133c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80133f:	74 16                	je     801357 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801341:	89 f8                	mov    %edi,%eax
+  801343:	84 c0                	test   %al,%al
+  801345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80134d:	89 d8                	mov    %ebx,%eax
+  80134f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801357:	83 ec 08             	sub    $0x8,%esp
+  80135a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80135d:	50                   	push   %eax
+  80135e:	ff 36                	push   (%esi)
+  801360:	e8 2f ff ff ff       	call   801294 <dev_lookup>
+  801365:	89 c3                	mov    %eax,%ebx
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	78 1a                	js     801388 <fd_close+0x77>
+		if (dev->dev_close)
+  80136e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801371:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801374:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801379:	85 c0                	test   %eax,%eax
+  80137b:	74 0b                	je     801388 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	56                   	push   %esi
+  801381:	ff d0                	call   *%eax
+  801383:	89 c3                	mov    %eax,%ebx
+  801385:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801388:	83 ec 08             	sub    $0x8,%esp
+  80138b:	56                   	push   %esi
+  80138c:	6a 00                	push   $0x0
+  80138e:	e8 2b fa ff ff       	call   800dbe <sys_page_unmap>
+	return r;
+  801393:	83 c4 10             	add    $0x10,%esp
+  801396:	eb b5                	jmp    80134d <fd_close+0x3c>
+
+00801398 <close>:
+
+int
+close(int fdnum)
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80139e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a1:	50                   	push   %eax
+  8013a2:	ff 75 08             	push   0x8(%ebp)
+  8013a5:	e8 9a fe ff ff       	call   801244 <fd_lookup>
+  8013aa:	83 c4 10             	add    $0x10,%esp
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	79 02                	jns    8013b3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013b1:	c9                   	leave
+  8013b2:	c3                   	ret
+		return fd_close(fd, 1);
+  8013b3:	83 ec 08             	sub    $0x8,%esp
+  8013b6:	6a 01                	push   $0x1
+  8013b8:	ff 75 f4             	push   -0xc(%ebp)
+  8013bb:	e8 51 ff ff ff       	call   801311 <fd_close>
+  8013c0:	83 c4 10             	add    $0x10,%esp
+  8013c3:	eb ec                	jmp    8013b1 <close+0x19>
+
+008013c5 <close_all>:
+
+void
+close_all(void)
+{
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	53                   	push   %ebx
+  8013c9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	53                   	push   %ebx
+  8013d5:	e8 be ff ff ff       	call   801398 <close>
+	for (i = 0; i < MAXFD; i++)
+  8013da:	83 c3 01             	add    $0x1,%ebx
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	83 fb 20             	cmp    $0x20,%ebx
+  8013e3:	75 ec                	jne    8013d1 <close_all+0xc>
+}
+  8013e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e8:	c9                   	leave
+  8013e9:	c3                   	ret
+
+008013ea <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013f6:	50                   	push   %eax
+  8013f7:	ff 75 08             	push   0x8(%ebp)
+  8013fa:	e8 45 fe ff ff       	call   801244 <fd_lookup>
+  8013ff:	89 c3                	mov    %eax,%ebx
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 7f                	js     801487 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	ff 75 0c             	push   0xc(%ebp)
+  80140e:	e8 85 ff ff ff       	call   801398 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801413:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801416:	c1 e6 0c             	shl    $0xc,%esi
+  801419:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80141f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801422:	89 3c 24             	mov    %edi,(%esp)
+  801425:	e8 ad fd ff ff       	call   8011d7 <fd2data>
+  80142a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80142c:	89 34 24             	mov    %esi,(%esp)
+  80142f:	e8 a3 fd ff ff       	call   8011d7 <fd2data>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80143a:	89 d8                	mov    %ebx,%eax
+  80143c:	c1 e8 16             	shr    $0x16,%eax
+  80143f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801446:	a8 01                	test   $0x1,%al
+  801448:	74 11                	je     80145b <dup+0x71>
+  80144a:	89 d8                	mov    %ebx,%eax
+  80144c:	c1 e8 0c             	shr    $0xc,%eax
+  80144f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801456:	f6 c2 01             	test   $0x1,%dl
+  801459:	75 36                	jne    801491 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80145b:	89 f8                	mov    %edi,%eax
+  80145d:	c1 e8 0c             	shr    $0xc,%eax
+  801460:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80146f:	50                   	push   %eax
+  801470:	56                   	push   %esi
+  801471:	6a 00                	push   $0x0
+  801473:	57                   	push   %edi
+  801474:	6a 00                	push   $0x0
+  801476:	e8 f7 f8 ff ff       	call   800d72 <sys_page_map>
+  80147b:	89 c3                	mov    %eax,%ebx
+  80147d:	83 c4 20             	add    $0x20,%esp
+  801480:	85 c0                	test   %eax,%eax
+  801482:	78 33                	js     8014b7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801484:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801487:	89 d8                	mov    %ebx,%eax
+  801489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80148c:	5b                   	pop    %ebx
+  80148d:	5e                   	pop    %esi
+  80148e:	5f                   	pop    %edi
+  80148f:	5d                   	pop    %ebp
+  801490:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801491:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801498:	83 ec 0c             	sub    $0xc,%esp
+  80149b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014a0:	50                   	push   %eax
+  8014a1:	ff 75 d4             	push   -0x2c(%ebp)
+  8014a4:	6a 00                	push   $0x0
+  8014a6:	53                   	push   %ebx
+  8014a7:	6a 00                	push   $0x0
+  8014a9:	e8 c4 f8 ff ff       	call   800d72 <sys_page_map>
+  8014ae:	89 c3                	mov    %eax,%ebx
+  8014b0:	83 c4 20             	add    $0x20,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	79 a4                	jns    80145b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014b7:	83 ec 08             	sub    $0x8,%esp
+  8014ba:	56                   	push   %esi
+  8014bb:	6a 00                	push   $0x0
+  8014bd:	e8 fc f8 ff ff       	call   800dbe <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014c2:	83 c4 08             	add    $0x8,%esp
+  8014c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8014c8:	6a 00                	push   $0x0
+  8014ca:	e8 ef f8 ff ff       	call   800dbe <sys_page_unmap>
+	return r;
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	eb b3                	jmp    801487 <dup+0x9d>
+
+008014d4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+  8014d9:	83 ec 18             	sub    $0x18,%esp
+  8014dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014e2:	50                   	push   %eax
+  8014e3:	53                   	push   %ebx
+  8014e4:	e8 5b fd ff ff       	call   801244 <fd_lookup>
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  8014ec:	85 c0                	test   %eax,%eax
+  8014ee:	78 3c                	js     80152c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014f0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014f3:	83 ec 08             	sub    $0x8,%esp
+  8014f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f9:	50                   	push   %eax
+  8014fa:	ff 36                	push   (%esi)
+  8014fc:	e8 93 fd ff ff       	call   801294 <dev_lookup>
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	85 c0                	test   %eax,%eax
+  801506:	78 24                	js     80152c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801508:	8b 46 08             	mov    0x8(%esi),%eax
+  80150b:	83 e0 03             	and    $0x3,%eax
+  80150e:	83 f8 01             	cmp    $0x1,%eax
+  801511:	74 20                	je     801533 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801513:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801516:	8b 40 08             	mov    0x8(%eax),%eax
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	74 61                	je     80157e <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80151d:	83 ec 04             	sub    $0x4,%esp
+  801520:	ff 75 10             	push   0x10(%ebp)
+  801523:	ff 75 0c             	push   0xc(%ebp)
+  801526:	56                   	push   %esi
+  801527:	ff d0                	call   *%eax
+  801529:	83 c4 10             	add    $0x10,%esp
+}
+  80152c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+  801533:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801535:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80153b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801540:	77 18                	ja     80155a <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801542:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801547:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801549:	c1 e8 10             	shr    $0x10,%eax
+  80154c:	74 0c                	je     80155a <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80154e:	c1 e0 10             	shl    $0x10,%eax
+  801551:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801556:	29 c2                	sub    %eax,%edx
+  801558:	eb 06                	jmp    801560 <read+0x8c>
+		return pthread_main_tls;
+  80155a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801560:	8b 02                	mov    (%edx),%eax
+  801562:	8b 40 48             	mov    0x48(%eax),%eax
+  801565:	83 ec 04             	sub    $0x4,%esp
+  801568:	53                   	push   %ebx
+  801569:	50                   	push   %eax
+  80156a:	68 81 4c 80 00       	push   $0x804c81
+  80156f:	e8 8f ed ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801574:	83 c4 10             	add    $0x10,%esp
+  801577:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157c:	eb ae                	jmp    80152c <read+0x58>
+		return -E_NOT_SUPP;
+  80157e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801583:	eb a7                	jmp    80152c <read+0x58>
+
+00801585 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801585:	55                   	push   %ebp
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	57                   	push   %edi
+  801589:	56                   	push   %esi
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 0c             	sub    $0xc,%esp
+  80158e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801591:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	eb 02                	jmp    80159d <readn+0x18>
+  80159b:	01 c3                	add    %eax,%ebx
+  80159d:	39 f3                	cmp    %esi,%ebx
+  80159f:	73 21                	jae    8015c2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015a1:	83 ec 04             	sub    $0x4,%esp
+  8015a4:	89 f0                	mov    %esi,%eax
+  8015a6:	29 d8                	sub    %ebx,%eax
+  8015a8:	50                   	push   %eax
+  8015a9:	89 d8                	mov    %ebx,%eax
+  8015ab:	03 45 0c             	add    0xc(%ebp),%eax
+  8015ae:	50                   	push   %eax
+  8015af:	57                   	push   %edi
+  8015b0:	e8 1f ff ff ff       	call   8014d4 <read>
+		if (m < 0)
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	78 04                	js     8015c0 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015bc:	75 dd                	jne    80159b <readn+0x16>
+  8015be:	eb 02                	jmp    8015c2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015c0:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015c2:	89 d8                	mov    %ebx,%eax
+  8015c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c7:	5b                   	pop    %ebx
+  8015c8:	5e                   	pop    %esi
+  8015c9:	5f                   	pop    %edi
+  8015ca:	5d                   	pop    %ebp
+  8015cb:	c3                   	ret
+
+008015cc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015cc:	55                   	push   %ebp
+  8015cd:	89 e5                	mov    %esp,%ebp
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 18             	sub    $0x18,%esp
+  8015d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015da:	50                   	push   %eax
+  8015db:	53                   	push   %ebx
+  8015dc:	e8 63 fc ff ff       	call   801244 <fd_lookup>
+  8015e1:	83 c4 10             	add    $0x10,%esp
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	78 37                	js     80161f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015eb:	83 ec 08             	sub    $0x8,%esp
+  8015ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 36                	push   (%esi)
+  8015f4:	e8 9b fc ff ff       	call   801294 <dev_lookup>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 1f                	js     80161f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801600:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801604:	74 20                	je     801626 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801606:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801609:	8b 40 0c             	mov    0xc(%eax),%eax
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	74 61                	je     801671 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801610:	83 ec 04             	sub    $0x4,%esp
+  801613:	ff 75 10             	push   0x10(%ebp)
+  801616:	ff 75 0c             	push   0xc(%ebp)
+  801619:	56                   	push   %esi
+  80161a:	ff d0                	call   *%eax
+  80161c:	83 c4 10             	add    $0x10,%esp
+}
+  80161f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801622:	5b                   	pop    %ebx
+  801623:	5e                   	pop    %esi
+  801624:	5d                   	pop    %ebp
+  801625:	c3                   	ret
+  801626:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801628:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80162e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801633:	77 18                	ja     80164d <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801635:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80163a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80163c:	c1 e8 10             	shr    $0x10,%eax
+  80163f:	74 0c                	je     80164d <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801641:	c1 e0 10             	shl    $0x10,%eax
+  801644:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801649:	29 c2                	sub    %eax,%edx
+  80164b:	eb 06                	jmp    801653 <write+0x87>
+		return pthread_main_tls;
+  80164d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801653:	8b 02                	mov    (%edx),%eax
+  801655:	8b 40 48             	mov    0x48(%eax),%eax
+  801658:	83 ec 04             	sub    $0x4,%esp
+  80165b:	53                   	push   %ebx
+  80165c:	50                   	push   %eax
+  80165d:	68 9d 4c 80 00       	push   $0x804c9d
+  801662:	e8 9c ec ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166f:	eb ae                	jmp    80161f <write+0x53>
+		return -E_NOT_SUPP;
+  801671:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801676:	eb a7                	jmp    80161f <write+0x53>
+
+00801678 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80167e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801681:	50                   	push   %eax
+  801682:	ff 75 08             	push   0x8(%ebp)
+  801685:	e8 ba fb ff ff       	call   801244 <fd_lookup>
+  80168a:	83 c4 10             	add    $0x10,%esp
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	78 0e                	js     80169f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801691:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801697:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80169a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80169f:	c9                   	leave
+  8016a0:	c3                   	ret
+
+008016a1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	56                   	push   %esi
+  8016a5:	53                   	push   %ebx
+  8016a6:	83 ec 18             	sub    $0x18,%esp
+  8016a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016af:	50                   	push   %eax
+  8016b0:	53                   	push   %ebx
+  8016b1:	e8 8e fb ff ff       	call   801244 <fd_lookup>
+  8016b6:	83 c4 10             	add    $0x10,%esp
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	78 34                	js     8016f1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016bd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016c0:	83 ec 08             	sub    $0x8,%esp
+  8016c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c6:	50                   	push   %eax
+  8016c7:	ff 36                	push   (%esi)
+  8016c9:	e8 c6 fb ff ff       	call   801294 <dev_lookup>
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 1c                	js     8016f1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016d5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016d9:	74 1d                	je     8016f8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016de:	8b 40 18             	mov    0x18(%eax),%eax
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	74 5e                	je     801743 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016e5:	83 ec 08             	sub    $0x8,%esp
+  8016e8:	ff 75 0c             	push   0xc(%ebp)
+  8016eb:	56                   	push   %esi
+  8016ec:	ff d0                	call   *%eax
+  8016ee:	83 c4 10             	add    $0x10,%esp
+}
+  8016f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f4:	5b                   	pop    %ebx
+  8016f5:	5e                   	pop    %esi
+  8016f6:	5d                   	pop    %ebp
+  8016f7:	c3                   	ret
+  8016f8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016fa:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801700:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801705:	77 18                	ja     80171f <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801707:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80170c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80170e:	c1 e8 10             	shr    $0x10,%eax
+  801711:	74 0c                	je     80171f <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801713:	c1 e0 10             	shl    $0x10,%eax
+  801716:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80171b:	29 c2                	sub    %eax,%edx
+  80171d:	eb 06                	jmp    801725 <ftruncate+0x84>
+		return pthread_main_tls;
+  80171f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801725:	8b 02                	mov    (%edx),%eax
+  801727:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80172a:	83 ec 04             	sub    $0x4,%esp
+  80172d:	53                   	push   %ebx
+  80172e:	50                   	push   %eax
+  80172f:	68 60 4c 80 00       	push   $0x804c60
+  801734:	e8 ca eb ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801741:	eb ae                	jmp    8016f1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801743:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801748:	eb a7                	jmp    8016f1 <ftruncate+0x50>
+
+0080174a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	56                   	push   %esi
+  80174e:	53                   	push   %ebx
+  80174f:	83 ec 18             	sub    $0x18,%esp
+  801752:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801755:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801758:	50                   	push   %eax
+  801759:	ff 75 08             	push   0x8(%ebp)
+  80175c:	e8 e3 fa ff ff       	call   801244 <fd_lookup>
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	85 c0                	test   %eax,%eax
+  801766:	78 49                	js     8017b1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801768:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80176b:	83 ec 08             	sub    $0x8,%esp
+  80176e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801771:	50                   	push   %eax
+  801772:	ff 36                	push   (%esi)
+  801774:	e8 1b fb ff ff       	call   801294 <dev_lookup>
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 31                	js     8017b1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801783:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801787:	74 2f                	je     8017b8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801789:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80178c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801793:	00 00 00 
+	stat->st_isdir = 0;
+  801796:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80179d:	00 00 00 
+	stat->st_dev = dev;
+  8017a0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	53                   	push   %ebx
+  8017aa:	56                   	push   %esi
+  8017ab:	ff 50 14             	call   *0x14(%eax)
+  8017ae:	83 c4 10             	add    $0x10,%esp
+}
+  8017b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b4:	5b                   	pop    %ebx
+  8017b5:	5e                   	pop    %esi
+  8017b6:	5d                   	pop    %ebp
+  8017b7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017bd:	eb f2                	jmp    8017b1 <fstat+0x67>
+
+008017bf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	56                   	push   %esi
+  8017c3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017c4:	83 ec 08             	sub    $0x8,%esp
+  8017c7:	6a 00                	push   $0x0
+  8017c9:	ff 75 08             	push   0x8(%ebp)
+  8017cc:	e8 4b 03 00 00       	call   801b1c <open>
+  8017d1:	89 c3                	mov    %eax,%ebx
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	85 c0                	test   %eax,%eax
+  8017d8:	78 1b                	js     8017f5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  8017dd:	ff 75 0c             	push   0xc(%ebp)
+  8017e0:	50                   	push   %eax
+  8017e1:	e8 64 ff ff ff       	call   80174a <fstat>
+  8017e6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017e8:	89 1c 24             	mov    %ebx,(%esp)
+  8017eb:	e8 a8 fb ff ff       	call   801398 <close>
+	return r;
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	89 f3                	mov    %esi,%ebx
+}
+  8017f5:	89 d8                	mov    %ebx,%eax
+  8017f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+
+008017fe <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	56                   	push   %esi
+  801802:	53                   	push   %ebx
+  801803:	89 c6                	mov    %eax,%esi
+  801805:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801807:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  80180e:	74 27                	je     801837 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801810:	6a 07                	push   $0x7
+  801812:	68 00 80 80 00       	push   $0x808000
+  801817:	56                   	push   %esi
+  801818:	ff 35 04 70 80 00    	push   0x807004
+  80181e:	e8 4e 2c 00 00       	call   804471 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801823:	83 c4 0c             	add    $0xc,%esp
+  801826:	6a 00                	push   $0x0
+  801828:	53                   	push   %ebx
+  801829:	6a 00                	push   $0x0
+  80182b:	e8 4b 2b 00 00       	call   80437b <ipc_recv>
+}
+  801830:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801833:	5b                   	pop    %ebx
+  801834:	5e                   	pop    %esi
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801837:	83 ec 0c             	sub    $0xc,%esp
+  80183a:	6a 01                	push   $0x1
+  80183c:	e8 86 2c 00 00       	call   8044c7 <ipc_find_env>
+  801841:	a3 04 70 80 00       	mov    %eax,0x807004
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	eb c5                	jmp    801810 <fsipc+0x12>
+
+0080184b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	53                   	push   %ebx
+  80184f:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801852:	68 08 70 80 00       	push   $0x807008
+  801857:	e8 29 1b 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80185c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801862:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801867:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80186a:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80186f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801874:	b8 02 00 00 00       	mov    $0x2,%eax
+  801879:	e8 80 ff ff ff       	call   8017fe <fsipc>
+  80187e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801880:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801887:	e8 66 1b 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+}
+  80188c:	89 d8                	mov    %ebx,%eax
+  80188e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+
+00801893 <devfile_flush>:
+{
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	53                   	push   %ebx
+  801897:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80189a:	68 08 70 80 00       	push   $0x807008
+  80189f:	e8 e1 1a 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018aa:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8018af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018b9:	e8 40 ff ff ff       	call   8017fe <fsipc>
+  8018be:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018c0:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  8018c7:	e8 26 1b 00 00       	call   8033f2 <mutex_unlock>
+}
+  8018cc:	89 d8                	mov    %ebx,%eax
+  8018ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+
+008018d3 <devfile_stat>:
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	56                   	push   %esi
+  8018d7:	53                   	push   %ebx
+  8018d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8018db:	83 ec 0c             	sub    $0xc,%esp
+  8018de:	68 08 70 80 00       	push   $0x807008
+  8018e3:	e8 9d 1a 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ee:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8018f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018fd:	e8 fc fe ff ff       	call   8017fe <fsipc>
+  801902:	89 c3                	mov    %eax,%ebx
+  801904:	83 c4 10             	add    $0x10,%esp
+  801907:	85 c0                	test   %eax,%eax
+  801909:	79 16                	jns    801921 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80190b:	83 ec 0c             	sub    $0xc,%esp
+  80190e:	68 08 70 80 00       	push   $0x807008
+  801913:	e8 da 1a 00 00       	call   8033f2 <mutex_unlock>
+}
+  801918:	89 d8                	mov    %ebx,%eax
+  80191a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191d:	5b                   	pop    %ebx
+  80191e:	5e                   	pop    %esi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801921:	83 ec 08             	sub    $0x8,%esp
+  801924:	68 00 80 80 00       	push   $0x808000
+  801929:	56                   	push   %esi
+  80192a:	e8 b8 ef ff ff       	call   8008e7 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80192f:	a1 80 80 80 00       	mov    0x808080,%eax
+  801934:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80193a:	a1 84 80 80 00       	mov    0x808084,%eax
+  80193f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801945:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801948:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194d:	eb bc                	jmp    80190b <devfile_stat+0x38>
+
+0080194f <devfile_write>:
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	53                   	push   %ebx
+  801953:	83 ec 10             	sub    $0x10,%esp
+  801956:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801959:	68 08 70 80 00       	push   $0x807008
+  80195e:	e8 22 1a 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801963:	8b 45 08             	mov    0x8(%ebp),%eax
+  801966:	8b 40 0c             	mov    0xc(%eax),%eax
+  801969:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80196e:	83 c4 10             	add    $0x10,%esp
+  801971:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801977:	76 3d                	jbe    8019b6 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801979:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80197e:	39 c3                	cmp    %eax,%ebx
+  801980:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801983:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801986:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  80198b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801991:	ba 00 00 00 00       	mov    $0x0,%edx
+  801996:	b8 04 00 00 00       	mov    $0x4,%eax
+  80199b:	e8 5e fe ff ff       	call   8017fe <fsipc>
+  8019a0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+  8019a5:	68 08 70 80 00       	push   $0x807008
+  8019aa:	e8 43 1a 00 00       	call   8033f2 <mutex_unlock>
+}
+  8019af:	89 d8                	mov    %ebx,%eax
+  8019b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b4:	c9                   	leave
+  8019b5:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8019b6:	83 ec 04             	sub    $0x4,%esp
+  8019b9:	53                   	push   %ebx
+  8019ba:	ff 75 0c             	push   0xc(%ebp)
+  8019bd:	68 0c 80 80 00       	push   $0x80800c
+  8019c2:	e8 a6 f0 ff ff       	call   800a6d <memmove>
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cf:	eb b5                	jmp    801986 <devfile_write+0x37>
+
+008019d1 <devfile_read>:
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	57                   	push   %edi
+  8019d5:	56                   	push   %esi
+  8019d6:	53                   	push   %ebx
+  8019d7:	83 ec 0c             	sub    $0xc,%esp
+  8019da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8019e3:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8019e9:	0f 86 8c 00 00 00    	jbe    801a7b <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8019ef:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019f4:	39 c3                	cmp    %eax,%ebx
+  8019f6:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8019f9:	89 f8                	mov    %edi,%eax
+  8019fb:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019fe:	eb 0f                	jmp    801a0f <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801a00:	0f b6 08             	movzbl (%eax),%ecx
+  801a03:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801a05:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a0a:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a0f:	39 d0                	cmp    %edx,%eax
+  801a11:	72 ed                	jb     801a00 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801a13:	83 ec 0c             	sub    $0xc,%esp
+  801a16:	68 08 70 80 00       	push   $0x807008
+  801a1b:	e8 65 19 00 00       	call   803385 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a20:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a23:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801a28:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801a2e:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801a34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a39:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a3e:	e8 bb fd ff ff       	call   8017fe <fsipc>
+  801a43:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801a45:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801a4c:	e8 a1 19 00 00       	call   8033f2 <mutex_unlock>
+		assert(r <= (int) n);
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	39 f3                	cmp    %esi,%ebx
+  801a56:	7c 0a                	jl     801a62 <devfile_read+0x91>
+}
+  801a58:	89 f0                	mov    %esi,%eax
+  801a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5d:	5b                   	pop    %ebx
+  801a5e:	5e                   	pop    %esi
+  801a5f:	5f                   	pop    %edi
+  801a60:	5d                   	pop    %ebp
+  801a61:	c3                   	ret
+		assert(r <= (int) n);
+  801a62:	68 d0 4c 80 00       	push   $0x804cd0
+  801a67:	68 dd 4c 80 00       	push   $0x804cdd
+  801a6c:	68 90 00 00 00       	push   $0x90
+  801a71:	68 f2 4c 80 00       	push   $0x804cf2
+  801a76:	e8 ad e7 ff ff       	call   800228 <_panic>
+	mutex_lock(&fsipc_mu);
+  801a7b:	83 ec 0c             	sub    $0xc,%esp
+  801a7e:	68 08 70 80 00       	push   $0x807008
+  801a83:	e8 fd 18 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a88:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a8b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801a90:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801a96:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801a9d:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aaa:	e8 4f fd ff ff       	call   8017fe <fsipc>
+  801aaf:	89 c6                	mov    %eax,%esi
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	85 c0                	test   %eax,%eax
+  801ab6:	78 1d                	js     801ad5 <devfile_read+0x104>
+		assert(r <= n);
+  801ab8:	39 c3                	cmp    %eax,%ebx
+  801aba:	72 2e                	jb     801aea <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801abc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ac1:	7f 40                	jg     801b03 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ac3:	83 ec 04             	sub    $0x4,%esp
+  801ac6:	50                   	push   %eax
+  801ac7:	68 00 80 80 00       	push   $0x808000
+  801acc:	57                   	push   %edi
+  801acd:	e8 9b ef ff ff       	call   800a6d <memmove>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801ad5:	83 ec 0c             	sub    $0xc,%esp
+  801ad8:	68 08 70 80 00       	push   $0x807008
+  801add:	e8 10 19 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	e9 6e ff ff ff       	jmp    801a58 <devfile_read+0x87>
+		assert(r <= n);
+  801aea:	68 fd 4c 80 00       	push   $0x804cfd
+  801aef:	68 dd 4c 80 00       	push   $0x804cdd
+  801af4:	68 99 00 00 00       	push   $0x99
+  801af9:	68 f2 4c 80 00       	push   $0x804cf2
+  801afe:	e8 25 e7 ff ff       	call   800228 <_panic>
+		assert(r <= PGSIZE);
+  801b03:	68 04 4d 80 00       	push   $0x804d04
+  801b08:	68 dd 4c 80 00       	push   $0x804cdd
+  801b0d:	68 9a 00 00 00       	push   $0x9a
+  801b12:	68 f2 4c 80 00       	push   $0x804cf2
+  801b17:	e8 0c e7 ff ff       	call   800228 <_panic>
+
+00801b1c <open>:
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	56                   	push   %esi
+  801b20:	53                   	push   %ebx
+  801b21:	83 ec 1c             	sub    $0x1c,%esp
+  801b24:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b27:	56                   	push   %esi
+  801b28:	e8 7f ed ff ff       	call   8008ac <strlen>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b35:	0f 8f 85 00 00 00    	jg     801bc0 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b3b:	83 ec 0c             	sub    $0xc,%esp
+  801b3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	e8 a7 f6 ff ff       	call   8011ee <fd_alloc>
+  801b47:	89 c3                	mov    %eax,%ebx
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 55                	js     801ba5 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+  801b53:	68 08 70 80 00       	push   $0x807008
+  801b58:	e8 28 18 00 00       	call   803385 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b5d:	83 c4 08             	add    $0x8,%esp
+  801b60:	56                   	push   %esi
+  801b61:	68 00 80 80 00       	push   $0x808000
+  801b66:	e8 7c ed ff ff       	call   8008e7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b6e:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b73:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b7b:	e8 7e fc ff ff       	call   8017fe <fsipc>
+  801b80:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b82:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801b89:	e8 64 18 00 00       	call   8033f2 <mutex_unlock>
+	if (r < 0) {
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	85 db                	test   %ebx,%ebx
+  801b93:	78 19                	js     801bae <open+0x92>
+	return fd2num(fd);
+  801b95:	83 ec 0c             	sub    $0xc,%esp
+  801b98:	ff 75 f4             	push   -0xc(%ebp)
+  801b9b:	e8 27 f6 ff ff       	call   8011c7 <fd2num>
+  801ba0:	89 c3                	mov    %eax,%ebx
+  801ba2:	83 c4 10             	add    $0x10,%esp
+}
+  801ba5:	89 d8                	mov    %ebx,%eax
+  801ba7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801baa:	5b                   	pop    %ebx
+  801bab:	5e                   	pop    %esi
+  801bac:	5d                   	pop    %ebp
+  801bad:	c3                   	ret
+		fd_close(fd, 0);
+  801bae:	83 ec 08             	sub    $0x8,%esp
+  801bb1:	6a 00                	push   $0x0
+  801bb3:	ff 75 f4             	push   -0xc(%ebp)
+  801bb6:	e8 56 f7 ff ff       	call   801311 <fd_close>
+		return r;
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  801bbe:	eb e5                	jmp    801ba5 <open+0x89>
+		return -E_BAD_PATH;
+  801bc0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bc5:	eb de                	jmp    801ba5 <open+0x89>
+
+00801bc7 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	53                   	push   %ebx
+  801bcb:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd1:	50                   	push   %eax
+  801bd2:	ff 75 08             	push   0x8(%ebp)
+  801bd5:	e8 6a f6 ff ff       	call   801244 <fd_lookup>
+  801bda:	89 c3                	mov    %eax,%ebx
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 5b                	js     801c3e <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801be3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be6:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  801bec:	39 08                	cmp    %ecx,(%eax)
+  801bee:	75 55                	jne    801c45 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801bf0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801bf4:	74 56                	je     801c4c <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801bf6:	83 ec 0c             	sub    $0xc,%esp
+  801bf9:	68 08 70 80 00       	push   $0x807008
+  801bfe:	e8 82 17 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801c03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c06:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c09:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801c0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c11:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801c16:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c19:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c23:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801c28:	e8 d1 fb ff ff       	call   8017fe <fsipc>
+  801c2d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801c2f:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801c36:	e8 b7 17 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+  801c3b:	83 c4 10             	add    $0x10,%esp
+}
+  801c3e:	89 d8                	mov    %ebx,%eax
+  801c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c43:	c9                   	leave
+  801c44:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c45:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801c4a:	eb f2                	jmp    801c3e <fallocate+0x77>
+		return -E_INVAL;
+  801c4c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801c51:	eb eb                	jmp    801c3e <fallocate+0x77>
+
+00801c53 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	56                   	push   %esi
+  801c57:	53                   	push   %ebx
+  801c58:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c5b:	89 f3                	mov    %esi,%ebx
+  801c5d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c63:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c66:	eb 06                	jmp    801c6e <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c68:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c6e:	39 f3                	cmp    %esi,%ebx
+  801c70:	73 14                	jae    801c86 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c72:	83 ec 08             	sub    $0x8,%esp
+  801c75:	53                   	push   %ebx
+  801c76:	6a 00                	push   $0x0
+  801c78:	e8 41 f1 ff ff       	call   800dbe <sys_page_unmap>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	79 e4                	jns    801c68 <munmap+0x15>
+  801c84:	eb 05                	jmp    801c8b <munmap+0x38>
+			return r;
+	return 0;
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c8e:	5b                   	pop    %ebx
+  801c8f:	5e                   	pop    %esi
+  801c90:	5d                   	pop    %ebp
+  801c91:	c3                   	ret
+
+00801c92 <mmap>:
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	57                   	push   %edi
+  801c96:	56                   	push   %esi
+  801c97:	53                   	push   %ebx
+  801c98:	83 ec 24             	sub    $0x24,%esp
+  801c9b:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c9e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ca1:	50                   	push   %eax
+  801ca2:	ff 75 08             	push   0x8(%ebp)
+  801ca5:	e8 9a f5 ff ff       	call   801244 <fd_lookup>
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	0f 88 37 01 00 00    	js     801dec <mmap+0x15a>
+		return NULL;
+  801cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801cba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cbd:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  801cc3:	39 0a                	cmp    %ecx,(%edx)
+  801cc5:	0f 85 05 01 00 00    	jne    801dd0 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801ccb:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801cd2:	0f 85 1b 01 00 00    	jne    801df3 <mmap+0x161>
+  801cd8:	89 f0                	mov    %esi,%eax
+  801cda:	83 e8 01             	sub    $0x1,%eax
+  801cdd:	0f 88 17 01 00 00    	js     801dfa <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801ce3:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801ce7:	75 28                	jne    801d11 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801ce9:	83 ec 0c             	sub    $0xc,%esp
+  801cec:	68 08 70 80 00       	push   $0x807008
+  801cf1:	e8 8f 16 00 00       	call   803385 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801cf6:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801cfc:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d02:	83 c4 10             	add    $0x10,%esp
+  801d05:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801d0a:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801d0f:	eb 2b                	jmp    801d3c <mmap+0xaa>
+		cow_enable();
+  801d11:	e8 f4 21 00 00       	call   803f0a <cow_enable>
+  801d16:	eb d1                	jmp    801ce9 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801d18:	89 c2                	mov    %eax,%edx
+  801d1a:	c1 ea 0c             	shr    $0xc,%edx
+  801d1d:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801d24:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801d2a:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801d30:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801d33:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d35:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801d3a:	77 25                	ja     801d61 <mmap+0xcf>
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	29 da                	sub    %ebx,%edx
+  801d40:	39 ca                	cmp    %ecx,%edx
+  801d42:	73 3a                	jae    801d7e <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801d44:	89 c2                	mov    %eax,%edx
+  801d46:	c1 ea 16             	shr    $0x16,%edx
+  801d49:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d50:	f6 c2 01             	test   $0x1,%dl
+  801d53:	75 c3                	jne    801d18 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801d55:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801d5a:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801d5f:	eb d4                	jmp    801d35 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801d61:	29 d8                	sub    %ebx,%eax
+  801d63:	39 c8                	cmp    %ecx,%eax
+  801d65:	73 17                	jae    801d7e <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801d67:	83 ec 0c             	sub    $0xc,%esp
+  801d6a:	68 08 70 80 00       	push   $0x807008
+  801d6f:	e8 7e 16 00 00       	call   8033f2 <mutex_unlock>
+		return NULL;
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7c:	eb 52                	jmp    801dd0 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d7e:	85 db                	test   %ebx,%ebx
+  801d80:	74 e5                	je     801d67 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d85:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d88:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801d8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d90:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801d95:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801d9b:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801da1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801da4:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801db3:	e8 46 fa ff ff       	call   8017fe <fsipc>
+  801db8:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+  801dbd:	68 08 70 80 00       	push   $0x807008
+  801dc2:	e8 2b 16 00 00       	call   8033f2 <mutex_unlock>
+	if (r < 0) {
+  801dc7:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801dca:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801dcc:	85 ff                	test   %edi,%edi
+  801dce:	78 08                	js     801dd8 <mmap+0x146>
+}
+  801dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd3:	5b                   	pop    %ebx
+  801dd4:	5e                   	pop    %esi
+  801dd5:	5f                   	pop    %edi
+  801dd6:	5d                   	pop    %ebp
+  801dd7:	c3                   	ret
+		munmap((void*) va, len);
+  801dd8:	83 ec 08             	sub    $0x8,%esp
+  801ddb:	56                   	push   %esi
+  801ddc:	53                   	push   %ebx
+  801ddd:	e8 71 fe ff ff       	call   801c53 <munmap>
+		return NULL;
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dea:	eb e4                	jmp    801dd0 <mmap+0x13e>
+		return NULL;
+  801dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df1:	eb dd                	jmp    801dd0 <mmap+0x13e>
+		return NULL;
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df8:	eb d6                	jmp    801dd0 <mmap+0x13e>
+  801dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dff:	eb cf                	jmp    801dd0 <mmap+0x13e>
+
+00801e01 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	53                   	push   %ebx
+  801e05:	83 ec 10             	sub    $0x10,%esp
+  801e08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801e0b:	53                   	push   %ebx
+  801e0c:	e8 9b ea ff ff       	call   8008ac <strlen>
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e19:	7f 42                	jg     801e5d <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801e1b:	83 ec 0c             	sub    $0xc,%esp
+  801e1e:	68 08 70 80 00       	push   $0x807008
+  801e23:	e8 5d 15 00 00       	call   803385 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e28:	83 c4 08             	add    $0x8,%esp
+  801e2b:	53                   	push   %ebx
+  801e2c:	68 00 80 80 00       	push   $0x808000
+  801e31:	e8 b1 ea ff ff       	call   8008e7 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e40:	e8 b9 f9 ff ff       	call   8017fe <fsipc>
+  801e45:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e47:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801e4e:	e8 9f 15 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+  801e53:	83 c4 10             	add    $0x10,%esp
+}
+  801e56:	89 d8                	mov    %ebx,%eax
+  801e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5b:	c9                   	leave
+  801e5c:	c3                   	ret
+		return -E_BAD_PATH;
+  801e5d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e62:	eb f2                	jmp    801e56 <remove+0x55>
+
+00801e64 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	53                   	push   %ebx
+  801e68:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e6b:	68 08 70 80 00       	push   $0x807008
+  801e70:	e8 10 15 00 00       	call   803385 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e7f:	e8 7a f9 ff ff       	call   8017fe <fsipc>
+  801e84:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e86:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  801e8d:	e8 60 15 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+}
+  801e92:	89 d8                	mov    %ebx,%eax
+  801e94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+00801e99 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e99:	55                   	push   %ebp
+  801e9a:	89 e5                	mov    %esp,%ebp
+  801e9c:	56                   	push   %esi
+  801e9d:	53                   	push   %ebx
+  801e9e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	68 08 70 80 00       	push   $0x807008
+  801ea9:	e8 d7 14 00 00       	call   803385 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb1:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ec0:	e8 39 f9 ff ff       	call   8017fe <fsipc>
+  801ec5:	89 c6                	mov    %eax,%esi
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	85 db                	test   %ebx,%ebx
+  801ecc:	74 7b                	je     801f49 <fs_bcstat+0xb0>
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 77                	js     801f49 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801ed2:	a1 00 80 80 00       	mov    0x808000,%eax
+  801ed7:	89 03                	mov    %eax,(%ebx)
+  801ed9:	a1 04 80 80 00       	mov    0x808004,%eax
+  801ede:	89 43 04             	mov    %eax,0x4(%ebx)
+  801ee1:	a1 08 80 80 00       	mov    0x808008,%eax
+  801ee6:	89 43 08             	mov    %eax,0x8(%ebx)
+  801ee9:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801eee:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801ef1:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ef6:	89 43 10             	mov    %eax,0x10(%ebx)
+  801ef9:	a1 14 80 80 00       	mov    0x808014,%eax
+  801efe:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f01:	a1 18 80 80 00       	mov    0x808018,%eax
+  801f06:	89 43 18             	mov    %eax,0x18(%ebx)
+  801f09:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801f0e:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801f11:	a1 20 80 80 00       	mov    0x808020,%eax
+  801f16:	89 43 20             	mov    %eax,0x20(%ebx)
+  801f19:	a1 24 80 80 00       	mov    0x808024,%eax
+  801f1e:	89 43 24             	mov    %eax,0x24(%ebx)
+  801f21:	a1 28 80 80 00       	mov    0x808028,%eax
+  801f26:	89 43 28             	mov    %eax,0x28(%ebx)
+  801f29:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801f2e:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801f31:	a1 30 80 80 00       	mov    0x808030,%eax
+  801f36:	89 43 30             	mov    %eax,0x30(%ebx)
+  801f39:	a1 34 80 80 00       	mov    0x808034,%eax
+  801f3e:	89 43 34             	mov    %eax,0x34(%ebx)
+  801f41:	a1 38 80 80 00       	mov    0x808038,%eax
+  801f46:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801f49:	83 ec 0c             	sub    $0xc,%esp
+  801f4c:	68 08 70 80 00       	push   $0x807008
+  801f51:	e8 9c 14 00 00       	call   8033f2 <mutex_unlock>
+	return r;
+}
+  801f56:	89 f0                	mov    %esi,%eax
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+
+00801f5f <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	56                   	push   %esi
+  801f63:	53                   	push   %ebx
+  801f64:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801f66:	0f b6 10             	movzbl (%eax),%edx
+  801f69:	80 fa 72             	cmp    $0x72,%dl
+  801f6c:	74 44                	je     801fb2 <parse_mode+0x53>
+  801f6e:	80 fa 77             	cmp    $0x77,%dl
+  801f71:	74 4b                	je     801fbe <parse_mode+0x5f>
+  801f73:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801f78:	80 fa 61             	cmp    $0x61,%dl
+  801f7b:	74 09                	je     801f86 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801f7d:	89 d8                	mov    %ebx,%eax
+  801f7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f82:	5b                   	pop    %ebx
+  801f83:	5e                   	pop    %esi
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+	switch (mode[0]) {
+  801f86:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801f8b:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801f90:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801f92:	83 ec 08             	sub    $0x8,%esp
+  801f95:	6a 2b                	push   $0x2b
+  801f97:	50                   	push   %eax
+  801f98:	e8 5c ea ff ff       	call   8009f9 <strchr>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	74 d9                	je     801f7d <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801fa4:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801fa7:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801faa:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801fb0:	eb cb                	jmp    801f7d <parse_mode+0x1e>
+	switch (mode[0]) {
+  801fb2:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fbc:	eb d2                	jmp    801f90 <parse_mode+0x31>
+  801fbe:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801fc3:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801fc8:	eb c6                	jmp    801f90 <parse_mode+0x31>
+
+00801fca <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801fca:	55                   	push   %ebp
+  801fcb:	89 e5                	mov    %esp,%ebp
+  801fcd:	57                   	push   %edi
+  801fce:	56                   	push   %esi
+  801fcf:	53                   	push   %ebx
+  801fd0:	83 ec 1c             	sub    $0x1c,%esp
+  801fd3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fd6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801fd9:	b8 44 60 80 00       	mov    $0x806044,%eax
+  801fde:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801fe3:	83 c0 24             	add    $0x24,%eax
+  801fe6:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801fea:	74 17                	je     802003 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801fec:	83 c3 01             	add    $0x1,%ebx
+  801fef:	83 fb 10             	cmp    $0x10,%ebx
+  801ff2:	75 ef                	jne    801fe3 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801ff4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801ff9:	89 f0                	mov    %esi,%eax
+  801ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ffe:	5b                   	pop    %ebx
+  801fff:	5e                   	pop    %esi
+  802000:	5f                   	pop    %edi
+  802001:	5d                   	pop    %ebp
+  802002:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802003:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80200a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80200d:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802010:	c1 e7 02             	shl    $0x2,%edi
+  802013:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  802019:	83 ec 04             	sub    $0x4,%esp
+  80201c:	6a 24                	push   $0x24
+  80201e:	6a 00                	push   $0x0
+  802020:	56                   	push   %esi
+  802021:	e8 12 ea ff ff       	call   800a38 <memset>
+			streams[i].f_fd = fd;
+  802026:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802029:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  80202f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802032:	01 d8                	add    %ebx,%eax
+  802034:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802037:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	eb b6                	jmp    801ff9 <stream_alloc+0x2f>
+
+00802043 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	53                   	push   %ebx
+  802047:	83 ec 14             	sub    $0x14,%esp
+  80204a:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80204c:	8b 40 18             	mov    0x18(%eax),%eax
+  80204f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802052:	74 4a                	je     80209e <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802054:	83 ec 08             	sub    $0x8,%esp
+  802057:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205a:	50                   	push   %eax
+  80205b:	ff 33                	push   (%ebx)
+  80205d:	e8 e2 f1 ff ff       	call   801244 <fd_lookup>
+  802062:	89 c2                	mov    %eax,%edx
+  802064:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802067:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80206c:	85 d2                	test   %edx,%edx
+  80206e:	78 41                	js     8020b1 <stream_unread+0x6e>
+  802070:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802073:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802079:	39 0a                	cmp    %ecx,(%edx)
+  80207b:	75 34                	jne    8020b1 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80207d:	8b 43 14             	mov    0x14(%ebx),%eax
+  802080:	03 42 04             	add    0x4(%edx),%eax
+  802083:	2b 43 18             	sub    0x18(%ebx),%eax
+  802086:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802089:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802090:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802097:	b8 01 00 00 00       	mov    $0x1,%eax
+  80209c:	eb 13                	jmp    8020b1 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80209e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8020a5:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8020ac:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <stream_drain>:
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	56                   	push   %esi
+  8020ba:	53                   	push   %ebx
+  8020bb:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8020bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c2:	eb 02                	jmp    8020c6 <stream_drain+0x10>
+  8020c4:	01 c3                	add    %eax,%ebx
+  8020c6:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020c9:	39 c3                	cmp    %eax,%ebx
+  8020cb:	73 43                	jae    802110 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8020cd:	83 ec 04             	sub    $0x4,%esp
+  8020d0:	29 d8                	sub    %ebx,%eax
+  8020d2:	50                   	push   %eax
+  8020d3:	89 d8                	mov    %ebx,%eax
+  8020d5:	03 46 0c             	add    0xc(%esi),%eax
+  8020d8:	50                   	push   %eax
+  8020d9:	ff 36                	push   (%esi)
+  8020db:	e8 ec f4 ff ff       	call   8015cc <write>
+  8020e0:	83 c4 10             	add    $0x10,%esp
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	7f dd                	jg     8020c4 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8020e7:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8020eb:	8b 56 0c             	mov    0xc(%esi),%edx
+  8020ee:	83 ec 04             	sub    $0x4,%esp
+  8020f1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020f4:	29 d8                	sub    %ebx,%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8020fa:	50                   	push   %eax
+  8020fb:	52                   	push   %edx
+  8020fc:	e8 6c e9 ff ff       	call   800a6d <memmove>
+			f->f_wend -= done;
+  802101:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802104:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802106:	83 c4 10             	add    $0x10,%esp
+  802109:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80210e:	eb 0a                	jmp    80211a <stream_drain+0x64>
+  802110:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80211a:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80211d:	89 d0                	mov    %edx,%eax
+  80211f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802122:	5b                   	pop    %ebx
+  802123:	5e                   	pop    %esi
+  802124:	5d                   	pop    %ebp
+  802125:	c3                   	ret
+
+00802126 <stream_setup>:
+	if (f->f_buf)
+  802126:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80212a:	74 01                	je     80212d <stream_setup+0x7>
+  80212c:	c3                   	ret
+{
+  80212d:	55                   	push   %ebp
+  80212e:	89 e5                	mov    %esp,%ebp
+  802130:	53                   	push   %ebx
+  802131:	83 ec 04             	sub    $0x4,%esp
+  802134:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802136:	8b 40 08             	mov    0x8(%eax),%eax
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	74 17                	je     802154 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80213d:	83 f8 03             	cmp    $0x3,%eax
+  802140:	75 2d                	jne    80216f <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802142:	8d 43 20             	lea    0x20(%ebx),%eax
+  802145:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802148:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80214f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	ff 33                	push   (%ebx)
+  802159:	e8 29 1b 00 00       	call   803c87 <iscons>
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	85 c0                	test   %eax,%eax
+  802163:	0f 9f c0             	setg   %al
+  802166:	0f b6 c0             	movzbl %al,%eax
+  802169:	83 c0 01             	add    $0x1,%eax
+  80216c:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	68 00 10 00 00       	push   $0x1000
+  802177:	e8 6e 0b 00 00       	call   802cea <malloc>
+  80217c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	85 c0                	test   %eax,%eax
+  802184:	74 bc                	je     802142 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802186:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80218d:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802191:	eb bc                	jmp    80214f <stream_setup+0x29>
+
+00802193 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	53                   	push   %ebx
+  802197:	83 ec 04             	sub    $0x4,%esp
+  80219a:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80219c:	e8 85 ff ff ff       	call   802126 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8021a6:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8021aa:	74 3d                	je     8021e9 <stream_fill+0x56>
+  8021ac:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8021b0:	74 10                	je     8021c2 <stream_fill+0x2f>
+  8021b2:	89 d8                	mov    %ebx,%eax
+  8021b4:	e8 fd fe ff ff       	call   8020b6 <stream_drain>
+		return 0;
+  8021b9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 27                	js     8021e9 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8021c2:	83 ec 04             	sub    $0x4,%esp
+  8021c5:	ff 73 10             	push   0x10(%ebx)
+  8021c8:	ff 73 0c             	push   0xc(%ebx)
+  8021cb:	ff 33                	push   (%ebx)
+  8021cd:	e8 02 f3 ff ff       	call   8014d4 <read>
+  8021d2:	83 c4 10             	add    $0x10,%esp
+  8021d5:	85 c0                	test   %eax,%eax
+  8021d7:	7e 17                	jle    8021f0 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8021d9:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8021dd:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8021e4:	89 c2                	mov    %eax,%edx
+  8021e6:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8021e9:	89 d0                	mov    %edx,%eax
+  8021eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8021f0:	c1 f8 1f             	sar    $0x1f,%eax
+  8021f3:	83 e0 04             	and    $0x4,%eax
+  8021f6:	83 c0 04             	add    $0x4,%eax
+  8021f9:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8021fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802201:	eb e6                	jmp    8021e9 <stream_fill+0x56>
+
+00802203 <fopen>:
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	57                   	push   %edi
+  802207:	56                   	push   %esi
+  802208:	53                   	push   %ebx
+  802209:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80220f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802212:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802218:	89 f0                	mov    %esi,%eax
+  80221a:	e8 40 fd ff ff       	call   801f5f <parse_mode>
+		return 0;
+  80221f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 2d                	js     802255 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802228:	83 ec 08             	sub    $0x8,%esp
+  80222b:	50                   	push   %eax
+  80222c:	ff 75 08             	push   0x8(%ebp)
+  80222f:	e8 e8 f8 ff ff       	call   801b1c <open>
+  802234:	89 c7                	mov    %eax,%edi
+  802236:	83 c4 10             	add    $0x10,%esp
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 58                	js     802295 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80223d:	80 3e 61             	cmpb   $0x61,(%esi)
+  802240:	74 1d                	je     80225f <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802242:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802248:	89 f8                	mov    %edi,%eax
+  80224a:	e8 7b fd ff ff       	call   801fca <stream_alloc>
+  80224f:	89 c3                	mov    %eax,%ebx
+  802251:	85 c0                	test   %eax,%eax
+  802253:	74 32                	je     802287 <fopen+0x84>
+}
+  802255:	89 d8                	mov    %ebx,%eax
+  802257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80225a:	5b                   	pop    %ebx
+  80225b:	5e                   	pop    %esi
+  80225c:	5f                   	pop    %edi
+  80225d:	5d                   	pop    %ebp
+  80225e:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80225f:	83 ec 08             	sub    $0x8,%esp
+  802262:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802268:	50                   	push   %eax
+  802269:	57                   	push   %edi
+  80226a:	e8 db f4 ff ff       	call   80174a <fstat>
+  80226f:	83 c4 10             	add    $0x10,%esp
+  802272:	85 c0                	test   %eax,%eax
+  802274:	78 cc                	js     802242 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802276:	83 ec 08             	sub    $0x8,%esp
+  802279:	ff 75 dc             	push   -0x24(%ebp)
+  80227c:	57                   	push   %edi
+  80227d:	e8 f6 f3 ff ff       	call   801678 <seek>
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	eb bb                	jmp    802242 <fopen+0x3f>
+		close(fd);
+  802287:	83 ec 0c             	sub    $0xc,%esp
+  80228a:	57                   	push   %edi
+  80228b:	e8 08 f1 ff ff       	call   801398 <close>
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	eb c0                	jmp    802255 <fopen+0x52>
+		return 0;
+  802295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80229a:	eb b9                	jmp    802255 <fopen+0x52>
+
+0080229c <fdopen>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8022a2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a8:	e8 b2 fc ff ff       	call   801f5f <parse_mode>
+  8022ad:	89 c2                	mov    %eax,%edx
+		return 0;
+  8022af:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8022b4:	85 d2                	test   %edx,%edx
+  8022b6:	78 0b                	js     8022c3 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8022b8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022be:	e8 07 fd ff ff       	call   801fca <stream_alloc>
+}
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+
+008022c5 <setvbuf>:
+{
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	57                   	push   %edi
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+  8022cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ce:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8022d4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8022d8:	75 3a                	jne    802314 <setvbuf+0x4f>
+  8022da:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8022dd:	83 fe 02             	cmp    $0x2,%esi
+  8022e0:	77 39                	ja     80231b <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8022e2:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8022e5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8022e9:	0f 95 c3             	setne  %bl
+  8022ec:	85 ff                	test   %edi,%edi
+  8022ee:	0f 95 c1             	setne  %cl
+  8022f1:	84 cb                	test   %cl,%bl
+  8022f3:	74 05                	je     8022fa <setvbuf+0x35>
+  8022f5:	83 fa 03             	cmp    $0x3,%edx
+  8022f8:	75 0a                	jne    802304 <setvbuf+0x3f>
+	return 0;
+  8022fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ff:	5b                   	pop    %ebx
+  802300:	5e                   	pop    %esi
+  802301:	5f                   	pop    %edi
+  802302:	5d                   	pop    %ebp
+  802303:	c3                   	ret
+		f->f_buf = buf;
+  802304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802307:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80230a:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80230d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802312:	eb eb                	jmp    8022ff <setvbuf+0x3a>
+		return EOF;
+  802314:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802319:	eb e4                	jmp    8022ff <setvbuf+0x3a>
+  80231b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802320:	eb dd                	jmp    8022ff <setvbuf+0x3a>
+
+00802322 <fflush>:
+{
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	57                   	push   %edi
+  802326:	56                   	push   %esi
+  802327:	53                   	push   %ebx
+  802328:	83 ec 0c             	sub    $0xc,%esp
+  80232b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80232e:	85 db                	test   %ebx,%ebx
+  802330:	74 1a                	je     80234c <fflush+0x2a>
+	stream_unread(f);
+  802332:	89 d8                	mov    %ebx,%eax
+  802334:	e8 0a fd ff ff       	call   802043 <stream_unread>
+	return stream_drain(f);
+  802339:	89 d8                	mov    %ebx,%eax
+  80233b:	e8 76 fd ff ff       	call   8020b6 <stream_drain>
+  802340:	89 c7                	mov    %eax,%edi
+}
+  802342:	89 f8                	mov    %edi,%eax
+  802344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802347:	5b                   	pop    %ebx
+  802348:	5e                   	pop    %esi
+  802349:	5f                   	pop    %edi
+  80234a:	5d                   	pop    %ebp
+  80234b:	c3                   	ret
+  80234c:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  802351:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235b:	eb 03                	jmp    802360 <fflush+0x3e>
+  80235d:	83 c3 24             	add    $0x24,%ebx
+  802360:	39 f3                	cmp    %esi,%ebx
+  802362:	74 de                	je     802342 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802364:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802368:	74 f3                	je     80235d <fflush+0x3b>
+  80236a:	83 ec 0c             	sub    $0xc,%esp
+  80236d:	53                   	push   %ebx
+  80236e:	e8 af ff ff ff       	call   802322 <fflush>
+  802373:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802376:	85 c0                	test   %eax,%eax
+  802378:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80237d:	0f 48 f8             	cmovs  %eax,%edi
+  802380:	eb db                	jmp    80235d <fflush+0x3b>
+
+00802382 <fclose>:
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	56                   	push   %esi
+  802386:	53                   	push   %ebx
+  802387:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80238a:	83 ec 0c             	sub    $0xc,%esp
+  80238d:	56                   	push   %esi
+  80238e:	e8 8f ff ff ff       	call   802322 <fflush>
+  802393:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802395:	83 c4 04             	add    $0x4,%esp
+  802398:	ff 36                	push   (%esi)
+  80239a:	e8 f9 ef ff ff       	call   801398 <close>
+  80239f:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023a9:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8023ac:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8023b0:	75 10                	jne    8023c2 <fclose+0x40>
+	f->f_flags = 0;
+  8023b2:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8023b9:	89 d8                	mov    %ebx,%eax
+  8023bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5d                   	pop    %ebp
+  8023c1:	c3                   	ret
+		free(f->f_buf);
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+  8023c5:	ff 76 0c             	push   0xc(%esi)
+  8023c8:	e8 54 08 00 00       	call   802c21 <free>
+  8023cd:	83 c4 10             	add    $0x10,%esp
+  8023d0:	eb e0                	jmp    8023b2 <fclose+0x30>
+
+008023d2 <fileno>:
+{
+  8023d2:	55                   	push   %ebp
+  8023d3:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8023d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d8:	8b 00                	mov    (%eax),%eax
+}
+  8023da:	5d                   	pop    %ebp
+  8023db:	c3                   	ret
+
+008023dc <feof>:
+{
+  8023dc:	55                   	push   %ebp
+  8023dd:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8023df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e2:	8b 40 04             	mov    0x4(%eax),%eax
+  8023e5:	c1 e8 02             	shr    $0x2,%eax
+  8023e8:	83 e0 01             	and    $0x1,%eax
+}
+  8023eb:	5d                   	pop    %ebp
+  8023ec:	c3                   	ret
+
+008023ed <ferror>:
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8023f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f3:	8b 40 04             	mov    0x4(%eax),%eax
+  8023f6:	c1 e8 03             	shr    $0x3,%eax
+  8023f9:	83 e0 01             	and    $0x1,%eax
+}
+  8023fc:	5d                   	pop    %ebp
+  8023fd:	c3                   	ret
+
+008023fe <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8023fe:	55                   	push   %ebp
+  8023ff:	89 e5                	mov    %esp,%ebp
+  802401:	53                   	push   %ebx
+  802402:	83 ec 04             	sub    $0x4,%esp
+  802405:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802408:	8b 43 18             	mov    0x18(%ebx),%eax
+  80240b:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80240e:	74 15                	je     802425 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802410:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802413:	8b 43 14             	mov    0x14(%ebx),%eax
+  802416:	8d 48 01             	lea    0x1(%eax),%ecx
+  802419:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80241c:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802420:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802423:	c9                   	leave
+  802424:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802425:	89 d8                	mov    %ebx,%eax
+  802427:	e8 67 fd ff ff       	call   802193 <stream_fill>
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	75 e0                	jne    802410 <fgetc+0x12>
+		return EOF;
+  802430:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802435:	eb e9                	jmp    802420 <fgetc+0x22>
+
+00802437 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	57                   	push   %edi
+  80243b:	56                   	push   %esi
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 1c             	sub    $0x1c,%esp
+  802440:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802443:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802448:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244b:	83 e8 01             	sub    $0x1,%eax
+  80244e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802451:	eb 66                	jmp    8024b9 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802453:	8b 46 14             	mov    0x14(%esi),%eax
+  802456:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802459:	29 c3                	sub    %eax,%ebx
+  80245b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80245e:	29 fa                	sub    %edi,%edx
+  802460:	39 d3                	cmp    %edx,%ebx
+  802462:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802465:	83 ec 04             	sub    $0x4,%esp
+  802468:	53                   	push   %ebx
+  802469:	6a 0a                	push   $0xa
+  80246b:	03 46 0c             	add    0xc(%esi),%eax
+  80246e:	50                   	push   %eax
+  80246f:	e8 aa e6 ff ff       	call   800b1e <memfind>
+  802474:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802477:	8b 46 0c             	mov    0xc(%esi),%eax
+  80247a:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80247d:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802480:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802482:	83 c4 10             	add    $0x10,%esp
+  802485:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802488:	74 0b                	je     802495 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80248a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80248d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802490:	29 d3                	sub    %edx,%ebx
+  802492:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802495:	83 ec 04             	sub    $0x4,%esp
+  802498:	53                   	push   %ebx
+  802499:	01 c8                	add    %ecx,%eax
+  80249b:	50                   	push   %eax
+  80249c:	89 f8                	mov    %edi,%eax
+  80249e:	03 45 08             	add    0x8(%ebp),%eax
+  8024a1:	50                   	push   %eax
+  8024a2:	e8 c6 e5 ff ff       	call   800a6d <memmove>
+		f->f_rpos += m;
+  8024a7:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8024aa:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8024ac:	83 c4 10             	add    $0x10,%esp
+  8024af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b2:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8024b7:	74 1f                	je     8024d8 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8024b9:	8d 47 01             	lea    0x1(%edi),%eax
+  8024bc:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8024bf:	73 17                	jae    8024d8 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8024c1:	8b 46 18             	mov    0x18(%esi),%eax
+  8024c4:	39 46 14             	cmp    %eax,0x14(%esi)
+  8024c7:	75 8a                	jne    802453 <fgets+0x1c>
+  8024c9:	89 f0                	mov    %esi,%eax
+  8024cb:	e8 c3 fc ff ff       	call   802193 <stream_fill>
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	0f 85 7b ff ff ff    	jne    802453 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8024d8:	85 ff                	test   %edi,%edi
+  8024da:	74 0f                	je     8024eb <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8024dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024df:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8024e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e6:	5b                   	pop    %ebx
+  8024e7:	5e                   	pop    %esi
+  8024e8:	5f                   	pop    %edi
+  8024e9:	5d                   	pop    %ebp
+  8024ea:	c3                   	ret
+		return 0;
+  8024eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f0:	eb f1                	jmp    8024e3 <fgets+0xac>
+
+008024f2 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	57                   	push   %edi
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+  8024f8:	83 ec 1c             	sub    $0x1c,%esp
+  8024fb:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8024fe:	89 f0                	mov    %esi,%eax
+  802500:	e8 21 fc ff ff       	call   802126 <stream_setup>
+	want = size * n;
+  802505:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802508:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80250c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  80250f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802514:	eb 43                	jmp    802559 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802516:	29 d3                	sub    %edx,%ebx
+  802518:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80251b:	29 f8                	sub    %edi,%eax
+  80251d:	39 c3                	cmp    %eax,%ebx
+  80251f:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802522:	83 ec 04             	sub    $0x4,%esp
+  802525:	53                   	push   %ebx
+  802526:	03 56 0c             	add    0xc(%esi),%edx
+  802529:	52                   	push   %edx
+  80252a:	89 f8                	mov    %edi,%eax
+  80252c:	03 45 08             	add    0x8(%ebp),%eax
+  80252f:	50                   	push   %eax
+  802530:	e8 38 e5 ff ff       	call   800a6d <memmove>
+			f->f_rpos += m;
+  802535:	01 5e 14             	add    %ebx,0x14(%esi)
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	eb 1a                	jmp    802557 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  80253d:	83 ec 04             	sub    $0x4,%esp
+  802540:	53                   	push   %ebx
+  802541:	89 f8                	mov    %edi,%eax
+  802543:	03 45 08             	add    0x8(%ebp),%eax
+  802546:	50                   	push   %eax
+  802547:	ff 36                	push   (%esi)
+  802549:	e8 86 ef ff ff       	call   8014d4 <read>
+  80254e:	89 c3                	mov    %eax,%ebx
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	85 c0                	test   %eax,%eax
+  802555:	7e 36                	jle    80258d <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802557:	01 df                	add    %ebx,%edi
+  802559:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80255c:	39 c7                	cmp    %eax,%edi
+  80255e:	73 39                	jae    802599 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802560:	8b 56 14             	mov    0x14(%esi),%edx
+  802563:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802566:	39 da                	cmp    %ebx,%edx
+  802568:	72 ac                	jb     802516 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80256a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80256d:	29 fb                	sub    %edi,%ebx
+  80256f:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802572:	72 3e                	jb     8025b2 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802574:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802578:	74 1f                	je     802599 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80257a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80257e:	74 bd                	je     80253d <fread+0x4b>
+  802580:	89 f0                	mov    %esi,%eax
+  802582:	e8 2f fb ff ff       	call   8020b6 <stream_drain>
+  802587:	85 c0                	test   %eax,%eax
+  802589:	79 b2                	jns    80253d <fread+0x4b>
+  80258b:	eb 0c                	jmp    802599 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80258d:	c1 fb 1f             	sar    $0x1f,%ebx
+  802590:	83 e3 04             	and    $0x4,%ebx
+  802593:	83 c3 04             	add    $0x4,%ebx
+  802596:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802599:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	74 0a                	je     8025aa <fread+0xb8>
+  8025a0:	89 f8                	mov    %edi,%eax
+  8025a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a7:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8025aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ad:	5b                   	pop    %ebx
+  8025ae:	5e                   	pop    %esi
+  8025af:	5f                   	pop    %edi
+  8025b0:	5d                   	pop    %ebp
+  8025b1:	c3                   	ret
+		} else if (!stream_fill(f))
+  8025b2:	89 f0                	mov    %esi,%eax
+  8025b4:	e8 da fb ff ff       	call   802193 <stream_fill>
+  8025b9:	85 c0                	test   %eax,%eax
+  8025bb:	74 dc                	je     802599 <fread+0xa7>
+			m = 0;
+  8025bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c2:	eb 93                	jmp    802557 <fread+0x65>
+
+008025c4 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8025c4:	55                   	push   %ebp
+  8025c5:	89 e5                	mov    %esp,%ebp
+  8025c7:	57                   	push   %edi
+  8025c8:	56                   	push   %esi
+  8025c9:	53                   	push   %ebx
+  8025ca:	83 ec 1c             	sub    $0x1c,%esp
+  8025cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8025d0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025d3:	a8 02                	test   $0x2,%al
+  8025d5:	75 13                	jne    8025ea <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8025d7:	83 c8 08             	or     $0x8,%eax
+  8025da:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8025e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e5:	5b                   	pop    %ebx
+  8025e6:	5e                   	pop    %esi
+  8025e7:	5f                   	pop    %edi
+  8025e8:	5d                   	pop    %ebp
+  8025e9:	c3                   	ret
+	stream_setup(f);
+  8025ea:	89 d8                	mov    %ebx,%eax
+  8025ec:	e8 35 fb ff ff       	call   802126 <stream_setup>
+	want = size * n;
+  8025f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025f4:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8025f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8025fb:	89 d8                	mov    %ebx,%eax
+  8025fd:	e8 41 fa ff ff       	call   802043 <stream_unread>
+	for (done = 0; done < want; ) {
+  802602:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802607:	84 c0                	test   %al,%al
+  802609:	75 7b                	jne    802686 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80260b:	be 00 00 00 00       	mov    $0x0,%esi
+  802610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802613:	39 fe                	cmp    %edi,%esi
+  802615:	73 24                	jae    80263b <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802617:	83 ec 04             	sub    $0x4,%esp
+  80261a:	89 f8                	mov    %edi,%eax
+  80261c:	29 f0                	sub    %esi,%eax
+  80261e:	50                   	push   %eax
+  80261f:	89 f0                	mov    %esi,%eax
+  802621:	03 45 08             	add    0x8(%ebp),%eax
+  802624:	50                   	push   %eax
+  802625:	ff 33                	push   (%ebx)
+  802627:	e8 a0 ef ff ff       	call   8015cc <write>
+  80262c:	83 c4 10             	add    $0x10,%esp
+  80262f:	85 c0                	test   %eax,%eax
+  802631:	7e 04                	jle    802637 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802633:	01 c6                	add    %eax,%esi
+  802635:	eb dc                	jmp    802613 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802637:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  80263b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	74 a0                	je     8025e2 <fwrite+0x1e>
+  802642:	89 f0                	mov    %esi,%eax
+  802644:	ba 00 00 00 00       	mov    $0x0,%edx
+  802649:	f7 75 0c             	divl   0xc(%ebp)
+  80264c:	eb 94                	jmp    8025e2 <fwrite+0x1e>
+			done += r;
+  80264e:	01 c7                	add    %eax,%edi
+			continue;
+  802650:	eb 34                	jmp    802686 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802652:	8b 73 10             	mov    0x10(%ebx),%esi
+  802655:	29 c6                	sub    %eax,%esi
+  802657:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80265a:	29 fa                	sub    %edi,%edx
+  80265c:	39 d6                	cmp    %edx,%esi
+  80265e:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802661:	83 ec 04             	sub    $0x4,%esp
+  802664:	56                   	push   %esi
+  802665:	89 fa                	mov    %edi,%edx
+  802667:	03 55 08             	add    0x8(%ebp),%edx
+  80266a:	52                   	push   %edx
+  80266b:	03 43 0c             	add    0xc(%ebx),%eax
+  80266e:	50                   	push   %eax
+  80266f:	e8 f9 e3 ff ff       	call   800a6d <memmove>
+		f->f_wend += m;
+  802674:	89 f0                	mov    %esi,%eax
+  802676:	03 43 1c             	add    0x1c(%ebx),%eax
+  802679:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  80267c:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802684:	74 5b                	je     8026e1 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802686:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802689:	39 c7                	cmp    %eax,%edi
+  80268b:	73 2d                	jae    8026ba <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  80268d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802690:	85 c0                	test   %eax,%eax
+  802692:	75 be                	jne    802652 <fwrite+0x8e>
+  802694:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802697:	29 fa                	sub    %edi,%edx
+  802699:	3b 53 10             	cmp    0x10(%ebx),%edx
+  80269c:	72 b4                	jb     802652 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80269e:	83 ec 04             	sub    $0x4,%esp
+  8026a1:	52                   	push   %edx
+  8026a2:	89 f8                	mov    %edi,%eax
+  8026a4:	03 45 08             	add    0x8(%ebp),%eax
+  8026a7:	50                   	push   %eax
+  8026a8:	ff 33                	push   (%ebx)
+  8026aa:	e8 1d ef ff ff       	call   8015cc <write>
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	7f 98                	jg     80264e <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8026b6:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8026ba:	8b 43 08             	mov    0x8(%ebx),%eax
+  8026bd:	83 f8 03             	cmp    $0x3,%eax
+  8026c0:	74 48                	je     80270a <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8026c2:	83 f8 02             	cmp    $0x2,%eax
+  8026c5:	74 27                	je     8026ee <fwrite+0x12a>
+	return size ? done / size : 0;
+  8026c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ca:	85 c0                	test   %eax,%eax
+  8026cc:	0f 84 10 ff ff ff    	je     8025e2 <fwrite+0x1e>
+  8026d2:	89 f8                	mov    %edi,%eax
+  8026d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d9:	f7 75 0c             	divl   0xc(%ebp)
+  8026dc:	e9 01 ff ff ff       	jmp    8025e2 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8026e1:	89 d8                	mov    %ebx,%eax
+  8026e3:	e8 ce f9 ff ff       	call   8020b6 <stream_drain>
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	79 9a                	jns    802686 <fwrite+0xc2>
+  8026ec:	eb cc                	jmp    8026ba <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8026ee:	83 ec 04             	sub    $0x4,%esp
+  8026f1:	57                   	push   %edi
+  8026f2:	6a 0a                	push   $0xa
+  8026f4:	ff 75 08             	push   0x8(%ebp)
+  8026f7:	e8 22 e4 ff ff       	call   800b1e <memfind>
+  8026fc:	89 c2                	mov    %eax,%edx
+  8026fe:	89 f8                	mov    %edi,%eax
+  802700:	03 45 08             	add    0x8(%ebp),%eax
+  802703:	83 c4 10             	add    $0x10,%esp
+  802706:	39 c2                	cmp    %eax,%edx
+  802708:	74 bd                	je     8026c7 <fwrite+0x103>
+		stream_drain(f);
+  80270a:	89 d8                	mov    %ebx,%eax
+  80270c:	e8 a5 f9 ff ff       	call   8020b6 <stream_drain>
+  802711:	eb b4                	jmp    8026c7 <fwrite+0x103>
+
+00802713 <fputc>:
+{
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	53                   	push   %ebx
+  802717:	83 ec 14             	sub    $0x14,%esp
+  80271a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  80271d:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802720:	ff 75 0c             	push   0xc(%ebp)
+  802723:	6a 01                	push   $0x1
+  802725:	6a 01                	push   $0x1
+  802727:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80272a:	50                   	push   %eax
+  80272b:	e8 94 fe ff ff       	call   8025c4 <fwrite>
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	0f b6 db             	movzbl %bl,%ebx
+  802736:	83 f8 01             	cmp    $0x1,%eax
+  802739:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80273e:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802741:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+00802746 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80274c:	ff 75 0c             	push   0xc(%ebp)
+  80274f:	ff 75 08             	push   0x8(%ebp)
+  802752:	e8 bc ff ff ff       	call   802713 <fputc>
+}
+  802757:	83 c4 10             	add    $0x10,%esp
+  80275a:	c9                   	leave
+  80275b:	c3                   	ret
+
+0080275c <fputs>:
+{
+  80275c:	55                   	push   %ebp
+  80275d:	89 e5                	mov    %esp,%ebp
+  80275f:	56                   	push   %esi
+  802760:	53                   	push   %ebx
+  802761:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802764:	83 ec 0c             	sub    $0xc,%esp
+  802767:	56                   	push   %esi
+  802768:	e8 3f e1 ff ff       	call   8008ac <strlen>
+  80276d:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  80276f:	ff 75 0c             	push   0xc(%ebp)
+  802772:	50                   	push   %eax
+  802773:	6a 01                	push   $0x1
+  802775:	56                   	push   %esi
+  802776:	e8 49 fe ff ff       	call   8025c4 <fwrite>
+  80277b:	83 c4 20             	add    $0x20,%esp
+  80277e:	39 d8                	cmp    %ebx,%eax
+  802780:	0f 95 c0             	setne  %al
+  802783:	0f b6 c0             	movzbl %al,%eax
+  802786:	f7 d8                	neg    %eax
+}
+  802788:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278b:	5b                   	pop    %ebx
+  80278c:	5e                   	pop    %esi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+
+0080278f <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	53                   	push   %ebx
+  802793:	83 ec 04             	sub    $0x4,%esp
+  802796:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802799:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  80279c:	50                   	push   %eax
+  80279d:	ff 75 0c             	push   0xc(%ebp)
+  8027a0:	53                   	push   %ebx
+  8027a1:	68 46 27 80 00       	push   $0x802746
+  8027a6:	e8 4f dc ff ff       	call   8003fa <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8027ab:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027ae:	c1 e0 1c             	shl    $0x1c,%eax
+  8027b1:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8027b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b7:	c9                   	leave
+  8027b8:	c3                   	ret
+
+008027b9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027bf:	68 18 4d 80 00       	push   $0x804d18
+  8027c4:	ff 75 0c             	push   0xc(%ebp)
+  8027c7:	e8 1b e1 ff ff       	call   8008e7 <strcpy>
+	return 0;
+}
+  8027cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d1:	c9                   	leave
+  8027d2:	c3                   	ret
+
+008027d3 <devsock_close>:
+{
+  8027d3:	55                   	push   %ebp
+  8027d4:	89 e5                	mov    %esp,%ebp
+  8027d6:	53                   	push   %ebx
+  8027d7:	83 ec 10             	sub    $0x10,%esp
+  8027da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027dd:	53                   	push   %ebx
+  8027de:	e8 23 1d 00 00       	call   804506 <pageref>
+  8027e3:	89 c2                	mov    %eax,%edx
+  8027e5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027e8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027ed:	83 fa 01             	cmp    $0x1,%edx
+  8027f0:	74 05                	je     8027f7 <devsock_close+0x24>
+}
+  8027f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027f7:	83 ec 0c             	sub    $0xc,%esp
+  8027fa:	ff 73 0c             	push   0xc(%ebx)
+  8027fd:	e8 b7 02 00 00       	call   802ab9 <nsipc_close>
+  802802:	83 c4 10             	add    $0x10,%esp
+  802805:	eb eb                	jmp    8027f2 <devsock_close+0x1f>
+
+00802807 <devsock_write>:
+{
+  802807:	55                   	push   %ebp
+  802808:	89 e5                	mov    %esp,%ebp
+  80280a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80280d:	6a 00                	push   $0x0
+  80280f:	ff 75 10             	push   0x10(%ebp)
+  802812:	ff 75 0c             	push   0xc(%ebp)
+  802815:	8b 45 08             	mov    0x8(%ebp),%eax
+  802818:	ff 70 0c             	push   0xc(%eax)
+  80281b:	e8 79 03 00 00       	call   802b99 <nsipc_send>
+}
+  802820:	c9                   	leave
+  802821:	c3                   	ret
+
+00802822 <devsock_read>:
+{
+  802822:	55                   	push   %ebp
+  802823:	89 e5                	mov    %esp,%ebp
+  802825:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802828:	6a 00                	push   $0x0
+  80282a:	ff 75 10             	push   0x10(%ebp)
+  80282d:	ff 75 0c             	push   0xc(%ebp)
+  802830:	8b 45 08             	mov    0x8(%ebp),%eax
+  802833:	ff 70 0c             	push   0xc(%eax)
+  802836:	e8 ef 02 00 00       	call   802b2a <nsipc_recv>
+}
+  80283b:	c9                   	leave
+  80283c:	c3                   	ret
+
+0080283d <fd2sockid>:
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802843:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802846:	52                   	push   %edx
+  802847:	50                   	push   %eax
+  802848:	e8 f7 e9 ff ff       	call   801244 <fd_lookup>
+  80284d:	83 c4 10             	add    $0x10,%esp
+  802850:	85 c0                	test   %eax,%eax
+  802852:	78 10                	js     802864 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802854:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802857:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  80285d:	39 08                	cmp    %ecx,(%eax)
+  80285f:	75 05                	jne    802866 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802861:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802864:	c9                   	leave
+  802865:	c3                   	ret
+		return -E_NOT_SUPP;
+  802866:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80286b:	eb f7                	jmp    802864 <fd2sockid+0x27>
+
+0080286d <alloc_sockfd>:
+{
+  80286d:	55                   	push   %ebp
+  80286e:	89 e5                	mov    %esp,%ebp
+  802870:	56                   	push   %esi
+  802871:	53                   	push   %ebx
+  802872:	83 ec 1c             	sub    $0x1c,%esp
+  802875:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802877:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80287a:	50                   	push   %eax
+  80287b:	e8 6e e9 ff ff       	call   8011ee <fd_alloc>
+  802880:	89 c3                	mov    %eax,%ebx
+  802882:	83 c4 10             	add    $0x10,%esp
+  802885:	85 c0                	test   %eax,%eax
+  802887:	78 43                	js     8028cc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802889:	83 ec 04             	sub    $0x4,%esp
+  80288c:	68 07 04 00 00       	push   $0x407
+  802891:	ff 75 f4             	push   -0xc(%ebp)
+  802894:	6a 00                	push   $0x0
+  802896:	e8 8a e4 ff ff       	call   800d25 <sys_page_alloc>
+  80289b:	89 c3                	mov    %eax,%ebx
+  80289d:	83 c4 10             	add    $0x10,%esp
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	78 28                	js     8028cc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028a7:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  8028ad:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8028af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028b9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028bc:	83 ec 0c             	sub    $0xc,%esp
+  8028bf:	50                   	push   %eax
+  8028c0:	e8 02 e9 ff ff       	call   8011c7 <fd2num>
+  8028c5:	89 c3                	mov    %eax,%ebx
+  8028c7:	83 c4 10             	add    $0x10,%esp
+  8028ca:	eb 0c                	jmp    8028d8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028cc:	83 ec 0c             	sub    $0xc,%esp
+  8028cf:	56                   	push   %esi
+  8028d0:	e8 e4 01 00 00       	call   802ab9 <nsipc_close>
+		return r;
+  8028d5:	83 c4 10             	add    $0x10,%esp
+}
+  8028d8:	89 d8                	mov    %ebx,%eax
+  8028da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028dd:	5b                   	pop    %ebx
+  8028de:	5e                   	pop    %esi
+  8028df:	5d                   	pop    %ebp
+  8028e0:	c3                   	ret
+
+008028e1 <accept>:
+{
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ea:	e8 4e ff ff ff       	call   80283d <fd2sockid>
+  8028ef:	85 c0                	test   %eax,%eax
+  8028f1:	78 1b                	js     80290e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028f3:	83 ec 04             	sub    $0x4,%esp
+  8028f6:	ff 75 10             	push   0x10(%ebp)
+  8028f9:	ff 75 0c             	push   0xc(%ebp)
+  8028fc:	50                   	push   %eax
+  8028fd:	e8 0e 01 00 00       	call   802a10 <nsipc_accept>
+  802902:	83 c4 10             	add    $0x10,%esp
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 05                	js     80290e <accept+0x2d>
+	return alloc_sockfd(r);
+  802909:	e8 5f ff ff ff       	call   80286d <alloc_sockfd>
+}
+  80290e:	c9                   	leave
+  80290f:	c3                   	ret
+
+00802910 <bind>:
+{
+  802910:	55                   	push   %ebp
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802916:	8b 45 08             	mov    0x8(%ebp),%eax
+  802919:	e8 1f ff ff ff       	call   80283d <fd2sockid>
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	78 12                	js     802934 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802922:	83 ec 04             	sub    $0x4,%esp
+  802925:	ff 75 10             	push   0x10(%ebp)
+  802928:	ff 75 0c             	push   0xc(%ebp)
+  80292b:	50                   	push   %eax
+  80292c:	e8 31 01 00 00       	call   802a62 <nsipc_bind>
+  802931:	83 c4 10             	add    $0x10,%esp
+}
+  802934:	c9                   	leave
+  802935:	c3                   	ret
+
+00802936 <shutdown>:
+{
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80293c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293f:	e8 f9 fe ff ff       	call   80283d <fd2sockid>
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 0f                	js     802957 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802948:	83 ec 08             	sub    $0x8,%esp
+  80294b:	ff 75 0c             	push   0xc(%ebp)
+  80294e:	50                   	push   %eax
+  80294f:	e8 43 01 00 00       	call   802a97 <nsipc_shutdown>
+  802954:	83 c4 10             	add    $0x10,%esp
+}
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+
+00802959 <connect>:
+{
+  802959:	55                   	push   %ebp
+  80295a:	89 e5                	mov    %esp,%ebp
+  80295c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80295f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802962:	e8 d6 fe ff ff       	call   80283d <fd2sockid>
+  802967:	85 c0                	test   %eax,%eax
+  802969:	78 12                	js     80297d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80296b:	83 ec 04             	sub    $0x4,%esp
+  80296e:	ff 75 10             	push   0x10(%ebp)
+  802971:	ff 75 0c             	push   0xc(%ebp)
+  802974:	50                   	push   %eax
+  802975:	e8 59 01 00 00       	call   802ad3 <nsipc_connect>
+  80297a:	83 c4 10             	add    $0x10,%esp
+}
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+0080297f <listen>:
+{
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802985:	8b 45 08             	mov    0x8(%ebp),%eax
+  802988:	e8 b0 fe ff ff       	call   80283d <fd2sockid>
+  80298d:	85 c0                	test   %eax,%eax
+  80298f:	78 0f                	js     8029a0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802991:	83 ec 08             	sub    $0x8,%esp
+  802994:	ff 75 0c             	push   0xc(%ebp)
+  802997:	50                   	push   %eax
+  802998:	e8 6b 01 00 00       	call   802b08 <nsipc_listen>
+  80299d:	83 c4 10             	add    $0x10,%esp
+}
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+008029a2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029a8:	ff 75 10             	push   0x10(%ebp)
+  8029ab:	ff 75 0c             	push   0xc(%ebp)
+  8029ae:	ff 75 08             	push   0x8(%ebp)
+  8029b1:	e8 41 02 00 00       	call   802bf7 <nsipc_socket>
+  8029b6:	83 c4 10             	add    $0x10,%esp
+  8029b9:	85 c0                	test   %eax,%eax
+  8029bb:	78 05                	js     8029c2 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029bd:	e8 ab fe ff ff       	call   80286d <alloc_sockfd>
+}
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+008029c4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	53                   	push   %ebx
+  8029c8:	83 ec 04             	sub    $0x4,%esp
+  8029cb:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029cd:	83 3d 0c 70 80 00 00 	cmpl   $0x0,0x80700c
+  8029d4:	74 26                	je     8029fc <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029d6:	6a 07                	push   $0x7
+  8029d8:	68 00 90 80 00       	push   $0x809000
+  8029dd:	53                   	push   %ebx
+  8029de:	ff 35 0c 70 80 00    	push   0x80700c
+  8029e4:	e8 88 1a 00 00       	call   804471 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029e9:	83 c4 0c             	add    $0xc,%esp
+  8029ec:	6a 00                	push   $0x0
+  8029ee:	6a 00                	push   $0x0
+  8029f0:	6a 00                	push   $0x0
+  8029f2:	e8 84 19 00 00       	call   80437b <ipc_recv>
+}
+  8029f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029fa:	c9                   	leave
+  8029fb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029fc:	83 ec 0c             	sub    $0xc,%esp
+  8029ff:	6a 02                	push   $0x2
+  802a01:	e8 c1 1a 00 00       	call   8044c7 <ipc_find_env>
+  802a06:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  802a0b:	83 c4 10             	add    $0x10,%esp
+  802a0e:	eb c6                	jmp    8029d6 <nsipc+0x12>
+
+00802a10 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	56                   	push   %esi
+  802a14:	53                   	push   %ebx
+  802a15:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a20:	8b 06                	mov    (%esi),%eax
+  802a22:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a27:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a2c:	e8 93 ff ff ff       	call   8029c4 <nsipc>
+  802a31:	89 c3                	mov    %eax,%ebx
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	79 09                	jns    802a40 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a37:	89 d8                	mov    %ebx,%eax
+  802a39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a3c:	5b                   	pop    %ebx
+  802a3d:	5e                   	pop    %esi
+  802a3e:	5d                   	pop    %ebp
+  802a3f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a40:	83 ec 04             	sub    $0x4,%esp
+  802a43:	ff 35 10 90 80 00    	push   0x809010
+  802a49:	68 00 90 80 00       	push   $0x809000
+  802a4e:	ff 75 0c             	push   0xc(%ebp)
+  802a51:	e8 17 e0 ff ff       	call   800a6d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a56:	a1 10 90 80 00       	mov    0x809010,%eax
+  802a5b:	89 06                	mov    %eax,(%esi)
+  802a5d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a60:	eb d5                	jmp    802a37 <nsipc_accept+0x27>
+
+00802a62 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	53                   	push   %ebx
+  802a66:	83 ec 08             	sub    $0x8,%esp
+  802a69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6f:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a74:	53                   	push   %ebx
+  802a75:	ff 75 0c             	push   0xc(%ebp)
+  802a78:	68 04 90 80 00       	push   $0x809004
+  802a7d:	e8 eb df ff ff       	call   800a6d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a82:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802a88:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a8d:	e8 32 ff ff ff       	call   8029c4 <nsipc>
+}
+  802a92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+00802a97 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+  802a9a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aa8:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802aad:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ab2:	e8 0d ff ff ff       	call   8029c4 <nsipc>
+}
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+00802ab9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac2:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802ac7:	b8 04 00 00 00       	mov    $0x4,%eax
+  802acc:	e8 f3 fe ff ff       	call   8029c4 <nsipc>
+}
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+
+00802ad3 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	53                   	push   %ebx
+  802ad7:	83 ec 08             	sub    $0x8,%esp
+  802ada:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802add:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae0:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ae5:	53                   	push   %ebx
+  802ae6:	ff 75 0c             	push   0xc(%ebp)
+  802ae9:	68 04 90 80 00       	push   $0x809004
+  802aee:	e8 7a df ff ff       	call   800a6d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802af3:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802af9:	b8 05 00 00 00       	mov    $0x5,%eax
+  802afe:	e8 c1 fe ff ff       	call   8029c4 <nsipc>
+}
+  802b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b06:	c9                   	leave
+  802b07:	c3                   	ret
+
+00802b08 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b08:	55                   	push   %ebp
+  802b09:	89 e5                	mov    %esp,%ebp
+  802b0b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b11:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b19:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802b1e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b23:	e8 9c fe ff ff       	call   8029c4 <nsipc>
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+00802b2a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	56                   	push   %esi
+  802b2e:	53                   	push   %ebx
+  802b2f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b35:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802b3a:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802b40:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b43:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b48:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b4d:	e8 72 fe ff ff       	call   8029c4 <nsipc>
+  802b52:	89 c3                	mov    %eax,%ebx
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 22                	js     802b7a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b58:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b5d:	39 c6                	cmp    %eax,%esi
+  802b5f:	0f 4e c6             	cmovle %esi,%eax
+  802b62:	39 c3                	cmp    %eax,%ebx
+  802b64:	7f 1d                	jg     802b83 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b66:	83 ec 04             	sub    $0x4,%esp
+  802b69:	53                   	push   %ebx
+  802b6a:	68 00 90 80 00       	push   $0x809000
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	e8 f6 de ff ff       	call   800a6d <memmove>
+  802b77:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b7a:	89 d8                	mov    %ebx,%eax
+  802b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b7f:	5b                   	pop    %ebx
+  802b80:	5e                   	pop    %esi
+  802b81:	5d                   	pop    %ebp
+  802b82:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b83:	68 24 4d 80 00       	push   $0x804d24
+  802b88:	68 dd 4c 80 00       	push   $0x804cdd
+  802b8d:	6a 62                	push   $0x62
+  802b8f:	68 39 4d 80 00       	push   $0x804d39
+  802b94:	e8 8f d6 ff ff       	call   800228 <_panic>
+
+00802b99 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b99:	55                   	push   %ebp
+  802b9a:	89 e5                	mov    %esp,%ebp
+  802b9c:	53                   	push   %ebx
+  802b9d:	83 ec 04             	sub    $0x4,%esp
+  802ba0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba6:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802bab:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bb1:	7f 2e                	jg     802be1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	53                   	push   %ebx
+  802bb7:	ff 75 0c             	push   0xc(%ebp)
+  802bba:	68 0c 90 80 00       	push   $0x80900c
+  802bbf:	e8 a9 de ff ff       	call   800a6d <memmove>
+	nsipcbuf.send.req_size = size;
+  802bc4:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bcd:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802bd2:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bd7:	e8 e8 fd ff ff       	call   8029c4 <nsipc>
+}
+  802bdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+	assert(size < 1600);
+  802be1:	68 45 4d 80 00       	push   $0x804d45
+  802be6:	68 dd 4c 80 00       	push   $0x804cdd
+  802beb:	6a 6d                	push   $0x6d
+  802bed:	68 39 4d 80 00       	push   $0x804d39
+  802bf2:	e8 31 d6 ff ff       	call   800228 <_panic>
+
+00802bf7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bf7:	55                   	push   %ebp
+  802bf8:	89 e5                	mov    %esp,%ebp
+  802bfa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c00:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c08:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c10:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802c15:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c1a:	e8 a5 fd ff ff       	call   8029c4 <nsipc>
+}
+  802c1f:	c9                   	leave
+  802c20:	c3                   	ret
+
+00802c21 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	53                   	push   %ebx
+  802c25:	83 ec 10             	sub    $0x10,%esp
+  802c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802c2b:	68 10 70 80 00       	push   $0x807010
+  802c30:	e8 50 07 00 00       	call   803385 <mutex_lock>
+	if (v == 0)
+  802c35:	83 c4 10             	add    $0x10,%esp
+  802c38:	85 db                	test   %ebx,%ebx
+  802c3a:	0f 84 85 00 00 00    	je     802cc5 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c40:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c46:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c4b:	77 51                	ja     802c9e <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802c4d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802c53:	89 d8                	mov    %ebx,%eax
+  802c55:	c1 e8 0c             	shr    $0xc,%eax
+  802c58:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c5f:	f6 c4 02             	test   $0x2,%ah
+  802c62:	74 50                	je     802cb4 <free+0x93>
+		sys_page_unmap(0, c);
+  802c64:	83 ec 08             	sub    $0x8,%esp
+  802c67:	53                   	push   %ebx
+  802c68:	6a 00                	push   $0x0
+  802c6a:	e8 4f e1 ff ff       	call   800dbe <sys_page_unmap>
+		c += PGSIZE;
+  802c6f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802c75:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c83:	76 ce                	jbe    802c53 <free+0x32>
+  802c85:	68 8f 4d 80 00       	push   $0x804d8f
+  802c8a:	68 dd 4c 80 00       	push   $0x804cdd
+  802c8f:	68 82 00 00 00       	push   $0x82
+  802c94:	68 82 4d 80 00       	push   $0x804d82
+  802c99:	e8 8a d5 ff ff       	call   800228 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c9e:	68 54 4d 80 00       	push   $0x804d54
+  802ca3:	68 dd 4c 80 00       	push   $0x804cdd
+  802ca8:	6a 7b                	push   $0x7b
+  802caa:	68 82 4d 80 00       	push   $0x804d82
+  802caf:	e8 74 d5 ff ff       	call   800228 <_panic>
+	if (--(*ref) == 0)
+  802cb4:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802cba:	83 e8 01             	sub    $0x1,%eax
+  802cbd:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802cc3:	74 15                	je     802cda <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802cc5:	83 ec 0c             	sub    $0xc,%esp
+  802cc8:	68 10 70 80 00       	push   $0x807010
+  802ccd:	e8 20 07 00 00       	call   8033f2 <mutex_unlock>
+}
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+		sys_page_unmap(0, c);
+  802cda:	83 ec 08             	sub    $0x8,%esp
+  802cdd:	53                   	push   %ebx
+  802cde:	6a 00                	push   $0x0
+  802ce0:	e8 d9 e0 ff ff       	call   800dbe <sys_page_unmap>
+  802ce5:	83 c4 10             	add    $0x10,%esp
+  802ce8:	eb db                	jmp    802cc5 <free+0xa4>
+
+00802cea <malloc>:
+{
+  802cea:	55                   	push   %ebp
+  802ceb:	89 e5                	mov    %esp,%ebp
+  802ced:	57                   	push   %edi
+  802cee:	56                   	push   %esi
+  802cef:	53                   	push   %ebx
+  802cf0:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802cf3:	68 10 70 80 00       	push   $0x807010
+  802cf8:	e8 88 06 00 00       	call   803385 <mutex_lock>
+	if (mptr == 0)
+  802cfd:	8b 3d 14 70 80 00    	mov    0x807014,%edi
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	85 ff                	test   %edi,%edi
+  802d08:	74 6c                	je     802d76 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0d:	83 c0 03             	add    $0x3,%eax
+  802d10:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d13:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d15:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d1a:	0f 87 64 01 00 00    	ja     802e84 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802d20:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802d26:	74 30                	je     802d58 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802d28:	89 f9                	mov    %edi,%ecx
+  802d2a:	c1 e9 0c             	shr    $0xc,%ecx
+  802d2d:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802d31:	c1 e8 0c             	shr    $0xc,%eax
+  802d34:	39 c1                	cmp    %eax,%ecx
+  802d36:	74 5f                	je     802d97 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802d38:	83 ec 0c             	sub    $0xc,%esp
+  802d3b:	57                   	push   %edi
+  802d3c:	e8 e0 fe ff ff       	call   802c21 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802d41:	a1 14 70 80 00       	mov    0x807014,%eax
+  802d46:	05 00 10 00 00       	add    $0x1000,%eax
+  802d4b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d50:	a3 14 70 80 00       	mov    %eax,0x807014
+  802d55:	83 c4 10             	add    $0x10,%esp
+  802d58:	8b 0d 14 70 80 00    	mov    0x807014,%ecx
+{
+  802d5e:	ba 02 00 00 00       	mov    $0x2,%edx
+  802d63:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802d67:	8d 7e 04             	lea    0x4(%esi),%edi
+  802d6a:	89 cb                	mov    %ecx,%ebx
+  802d6c:	01 f9                	add    %edi,%ecx
+  802d6e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d71:	e9 8b 00 00 00       	jmp    802e01 <malloc+0x117>
+		mptr = mbegin;
+  802d76:	c7 05 14 70 80 00 00 	movl   $0x8000000,0x807014
+  802d7d:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802d80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d83:	83 c0 03             	add    $0x3,%eax
+  802d86:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d89:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d8b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d90:	76 c6                	jbe    802d58 <malloc+0x6e>
+  802d92:	e9 d6 00 00 00       	jmp    802e6d <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802d97:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d9d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802da2:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802da6:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802da9:	a3 14 70 80 00       	mov    %eax,0x807014
+			return v;
+  802dae:	e9 ba 00 00 00       	jmp    802e6d <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802db3:	05 00 10 00 00       	add    $0x1000,%eax
+  802db8:	39 c8                	cmp    %ecx,%eax
+  802dba:	0f 83 cb 00 00 00    	jae    802e8b <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802dc0:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802dc5:	77 22                	ja     802de9 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802dc7:	89 c2                	mov    %eax,%edx
+  802dc9:	c1 ea 16             	shr    $0x16,%edx
+  802dcc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802dd3:	f6 c2 01             	test   $0x1,%dl
+  802dd6:	74 db                	je     802db3 <malloc+0xc9>
+  802dd8:	89 c2                	mov    %eax,%edx
+  802dda:	c1 ea 0c             	shr    $0xc,%edx
+  802ddd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802de4:	f6 c2 01             	test   $0x1,%dl
+  802de7:	74 ca                	je     802db3 <malloc+0xc9>
+		if (mptr == mend) {
+  802de9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802def:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802df5:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802df9:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802dff:	74 04                	je     802e05 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e01:	89 d8                	mov    %ebx,%eax
+  802e03:	eb b3                	jmp    802db8 <malloc+0xce>
+  802e05:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802e08:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802e0d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802e11:	83 ea 01             	sub    $0x1,%edx
+  802e14:	0f 85 50 ff ff ff    	jne    802d6a <malloc+0x80>
+  802e1a:	c7 05 14 70 80 00 00 	movl   $0x8000000,0x807014
+  802e21:	00 00 08 
+				return 0;	/* out of address space */
+  802e24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e29:	eb 42                	jmp    802e6d <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802e2b:	85 db                	test   %ebx,%ebx
+  802e2d:	78 1e                	js     802e4d <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802e2f:	83 ec 08             	sub    $0x8,%esp
+  802e32:	89 d8                	mov    %ebx,%eax
+  802e34:	03 05 14 70 80 00    	add    0x807014,%eax
+  802e3a:	50                   	push   %eax
+  802e3b:	6a 00                	push   $0x0
+  802e3d:	e8 7c df ff ff       	call   800dbe <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802e42:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802e48:	83 c4 10             	add    $0x10,%esp
+  802e4b:	eb de                	jmp    802e2b <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e52:	eb 19                	jmp    802e6d <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802e54:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e57:	8b 3d 14 70 80 00    	mov    0x807014,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802e5d:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802e64:	00 
+	mptr += n;
+  802e65:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e68:	a3 14 70 80 00       	mov    %eax,0x807014
+	mutex_unlock(&malloc_mu);
+  802e6d:	83 ec 0c             	sub    $0xc,%esp
+  802e70:	68 10 70 80 00       	push   $0x807010
+  802e75:	e8 78 05 00 00       	call   8033f2 <mutex_unlock>
+}
+  802e7a:	89 f8                	mov    %edi,%eax
+  802e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e7f:	5b                   	pop    %ebx
+  802e80:	5e                   	pop    %esi
+  802e81:	5f                   	pop    %edi
+  802e82:	5d                   	pop    %ebp
+  802e83:	c3                   	ret
+		return 0;
+  802e84:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e89:	eb e2                	jmp    802e6d <malloc+0x183>
+  802e8b:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e8f:	74 06                	je     802e97 <malloc+0x1ad>
+  802e91:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e9c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e9f:	39 fb                	cmp    %edi,%ebx
+  802ea1:	73 b1                	jae    802e54 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802ea3:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802ea9:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802eac:	39 fe                	cmp    %edi,%esi
+  802eae:	0f 92 c0             	setb   %al
+  802eb1:	0f b6 c0             	movzbl %al,%eax
+  802eb4:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802eb7:	83 c8 07             	or     $0x7,%eax
+  802eba:	50                   	push   %eax
+  802ebb:	89 d8                	mov    %ebx,%eax
+  802ebd:	03 05 14 70 80 00    	add    0x807014,%eax
+  802ec3:	50                   	push   %eax
+  802ec4:	6a 00                	push   $0x0
+  802ec6:	e8 5a de ff ff       	call   800d25 <sys_page_alloc>
+  802ecb:	83 c4 10             	add    $0x10,%esp
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	0f 88 55 ff ff ff    	js     802e2b <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802ed6:	89 f3                	mov    %esi,%ebx
+  802ed8:	eb c5                	jmp    802e9f <malloc+0x1b5>
+
+00802eda <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802eda:	55                   	push   %ebp
+  802edb:	89 e5                	mov    %esp,%ebp
+  802edd:	56                   	push   %esi
+  802ede:	53                   	push   %ebx
+  802edf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ee2:	83 ec 0c             	sub    $0xc,%esp
+  802ee5:	ff 75 08             	push   0x8(%ebp)
+  802ee8:	e8 ea e2 ff ff       	call   8011d7 <fd2data>
+  802eed:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802eef:	83 c4 08             	add    $0x8,%esp
+  802ef2:	68 a7 4d 80 00       	push   $0x804da7
+  802ef7:	53                   	push   %ebx
+  802ef8:	e8 ea d9 ff ff       	call   8008e7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802efd:	8b 46 04             	mov    0x4(%esi),%eax
+  802f00:	2b 06                	sub    (%esi),%eax
+  802f02:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f08:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f0f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f12:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  802f19:	62 80 00 
+	return 0;
+}
+  802f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f24:	5b                   	pop    %ebx
+  802f25:	5e                   	pop    %esi
+  802f26:	5d                   	pop    %ebp
+  802f27:	c3                   	ret
+
+00802f28 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802f28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2d:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802f31:	85 c9                	test   %ecx,%ecx
+  802f33:	75 01                	jne    802f36 <pipewake+0xe>
+  802f35:	c3                   	ret
+{
+  802f36:	55                   	push   %ebp
+  802f37:	89 e5                	mov    %esp,%ebp
+  802f39:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802f3c:	68 00 04 00 00       	push   $0x400
+  802f41:	52                   	push   %edx
+  802f42:	e8 22 e1 ff ff       	call   801069 <sys_futex_wake>
+  802f47:	83 c4 10             	add    $0x10,%esp
+}
+  802f4a:	c9                   	leave
+  802f4b:	c3                   	ret
+
+00802f4c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f4c:	55                   	push   %ebp
+  802f4d:	89 e5                	mov    %esp,%ebp
+  802f4f:	56                   	push   %esi
+  802f50:	53                   	push   %ebx
+  802f51:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f54:	83 ec 0c             	sub    $0xc,%esp
+  802f57:	56                   	push   %esi
+  802f58:	e8 7a e2 ff ff       	call   8011d7 <fd2data>
+  802f5d:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802f5f:	83 c4 08             	add    $0x8,%esp
+  802f62:	56                   	push   %esi
+  802f63:	6a 00                	push   $0x0
+  802f65:	e8 54 de ff ff       	call   800dbe <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802f6a:	8d 53 04             	lea    0x4(%ebx),%edx
+  802f6d:	8d 43 08             	lea    0x8(%ebx),%eax
+  802f70:	e8 b3 ff ff ff       	call   802f28 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802f75:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802f78:	89 da                	mov    %ebx,%edx
+  802f7a:	e8 a9 ff ff ff       	call   802f28 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802f7f:	89 34 24             	mov    %esi,(%esp)
+  802f82:	e8 50 e2 ff ff       	call   8011d7 <fd2data>
+  802f87:	83 c4 08             	add    $0x8,%esp
+  802f8a:	50                   	push   %eax
+  802f8b:	6a 00                	push   $0x0
+  802f8d:	e8 2c de ff ff       	call   800dbe <sys_page_unmap>
+}
+  802f92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f95:	5b                   	pop    %ebx
+  802f96:	5e                   	pop    %esi
+  802f97:	5d                   	pop    %ebp
+  802f98:	c3                   	ret
+
+00802f99 <_pipeisclosed>:
+{
+  802f99:	55                   	push   %ebp
+  802f9a:	89 e5                	mov    %esp,%ebp
+  802f9c:	57                   	push   %edi
+  802f9d:	56                   	push   %esi
+  802f9e:	53                   	push   %ebx
+  802f9f:	83 ec 1c             	sub    $0x1c,%esp
+  802fa2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802fa5:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fa7:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802fac:	eb 5d                	jmp    80300b <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802fae:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  802fb4:	8b 02                	mov    (%edx),%eax
+  802fb6:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fb9:	83 ec 0c             	sub    $0xc,%esp
+  802fbc:	ff 75 e0             	push   -0x20(%ebp)
+  802fbf:	e8 42 15 00 00       	call   804506 <pageref>
+  802fc4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fc7:	89 3c 24             	mov    %edi,(%esp)
+  802fca:	e8 37 15 00 00       	call   804506 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802fcf:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fd1:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802fd7:	83 c4 10             	add    $0x10,%esp
+  802fda:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802fe0:	77 15                	ja     802ff7 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fe2:	89 f2                	mov    %esi,%edx
+  802fe4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802fe6:	c1 ea 10             	shr    $0x10,%edx
+  802fe9:	74 0c                	je     802ff7 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802feb:	c1 e2 10             	shl    $0x10,%edx
+  802fee:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802ff3:	29 d1                	sub    %edx,%ecx
+  802ff5:	eb 06                	jmp    802ffd <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802ff7:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  802ffd:	8b 11                	mov    (%ecx),%edx
+  802fff:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803002:	39 d3                	cmp    %edx,%ebx
+  803004:	74 6e                	je     803074 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803006:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803009:	74 24                	je     80302f <_pipeisclosed+0x96>
+  80300b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80300d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803013:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803018:	77 94                	ja     802fae <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80301a:	89 f0                	mov    %esi,%eax
+  80301c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80301e:	c1 e8 10             	shr    $0x10,%eax
+  803021:	74 8b                	je     802fae <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803023:	c1 e0 10             	shl    $0x10,%eax
+  803026:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80302b:	29 c2                	sub    %eax,%edx
+  80302d:	eb 85                	jmp    802fb4 <_pipeisclosed+0x1b>
+  80302f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803031:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803037:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80303c:	77 18                	ja     803056 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80303e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803043:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803045:	c1 e8 10             	shr    $0x10,%eax
+  803048:	74 0c                	je     803056 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80304a:	c1 e0 10             	shl    $0x10,%eax
+  80304d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803052:	29 c2                	sub    %eax,%edx
+  803054:	eb 06                	jmp    80305c <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803056:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80305c:	8b 02                	mov    (%edx),%eax
+  80305e:	8b 40 58             	mov    0x58(%eax),%eax
+  803061:	6a 01                	push   $0x1
+  803063:	50                   	push   %eax
+  803064:	53                   	push   %ebx
+  803065:	68 ae 4d 80 00       	push   $0x804dae
+  80306a:	e8 94 d2 ff ff       	call   800303 <cprintf>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	eb 97                	jmp    80300b <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803074:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803077:	0f 94 c0             	sete   %al
+  80307a:	0f b6 c0             	movzbl %al,%eax
+}
+  80307d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803080:	5b                   	pop    %ebx
+  803081:	5e                   	pop    %esi
+  803082:	5f                   	pop    %edi
+  803083:	5d                   	pop    %ebp
+  803084:	c3                   	ret
+
+00803085 <devpipe_write>:
+{
+  803085:	55                   	push   %ebp
+  803086:	89 e5                	mov    %esp,%ebp
+  803088:	57                   	push   %edi
+  803089:	56                   	push   %esi
+  80308a:	53                   	push   %ebx
+  80308b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80308e:	ff 75 08             	push   0x8(%ebp)
+  803091:	e8 41 e1 ff ff       	call   8011d7 <fd2data>
+  803096:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803098:	83 c4 10             	add    $0x10,%esp
+  80309b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8030a2:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8030a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030ab:	0f 84 96 00 00 00    	je     803147 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8030b1:	8d 73 08             	lea    0x8(%ebx),%esi
+  8030b4:	eb 32                	jmp    8030e8 <devpipe_write+0x63>
+  8030b6:	89 fa                	mov    %edi,%edx
+  8030b8:	89 f0                	mov    %esi,%eax
+  8030ba:	e8 69 fe ff ff       	call   802f28 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8030bf:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030c2:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8030c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8030ca:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030cf:	83 ec 04             	sub    $0x4,%esp
+  8030d2:	6a 0a                	push   $0xa
+  8030d4:	50                   	push   %eax
+  8030d5:	53                   	push   %ebx
+  8030d6:	e8 5f df ff ff       	call   80103a <sys_futex_wait>
+  8030db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030e0:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8030e5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030e8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030eb:	8b 0b                	mov    (%ebx),%ecx
+  8030ed:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030f0:	39 d0                	cmp    %edx,%eax
+  8030f2:	72 1b                	jb     80310f <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8030f4:	89 da                	mov    %ebx,%edx
+  8030f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f9:	e8 9b fe ff ff       	call   802f99 <_pipeisclosed>
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	74 b4                	je     8030b6 <devpipe_write+0x31>
+				return 0;
+  803102:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310a:	5b                   	pop    %ebx
+  80310b:	5e                   	pop    %esi
+  80310c:	5f                   	pop    %edi
+  80310d:	5d                   	pop    %ebp
+  80310e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80310f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803112:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803115:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803119:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80311c:	89 c2                	mov    %eax,%edx
+  80311e:	c1 fa 1f             	sar    $0x1f,%edx
+  803121:	89 d1                	mov    %edx,%ecx
+  803123:	c1 e9 1b             	shr    $0x1b,%ecx
+  803126:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803129:	83 e2 1f             	and    $0x1f,%edx
+  80312c:	29 ca                	sub    %ecx,%edx
+  80312e:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803132:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803136:	83 c0 01             	add    $0x1,%eax
+  803139:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80313c:	83 c6 01             	add    $0x1,%esi
+  80313f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803142:	e9 5e ff ff ff       	jmp    8030a5 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803147:	8d 53 04             	lea    0x4(%ebx),%edx
+  80314a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80314d:	e8 d6 fd ff ff       	call   802f28 <pipewake>
+	return i;
+  803152:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803155:	eb b0                	jmp    803107 <devpipe_write+0x82>
+
+00803157 <devpipe_read>:
+{
+  803157:	55                   	push   %ebp
+  803158:	89 e5                	mov    %esp,%ebp
+  80315a:	57                   	push   %edi
+  80315b:	56                   	push   %esi
+  80315c:	53                   	push   %ebx
+  80315d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803160:	ff 75 08             	push   0x8(%ebp)
+  803163:	e8 6f e0 ff ff       	call   8011d7 <fd2data>
+  803168:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80316a:	83 c4 10             	add    $0x10,%esp
+  80316d:	be 00 00 00 00       	mov    $0x0,%esi
+  803172:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803175:	74 6c                	je     8031e3 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803177:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80317a:	eb 25                	jmp    8031a1 <devpipe_read+0x4a>
+  80317c:	8b 13                	mov    (%ebx),%edx
+  80317e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803183:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803188:	83 ec 04             	sub    $0x4,%esp
+  80318b:	6a 0a                	push   $0xa
+  80318d:	52                   	push   %edx
+  80318e:	57                   	push   %edi
+  80318f:	e8 a6 de ff ff       	call   80103a <sys_futex_wait>
+  803194:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803199:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80319e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8031a1:	8b 03                	mov    (%ebx),%eax
+  8031a3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8031a6:	75 19                	jne    8031c1 <devpipe_read+0x6a>
+			if (i > 0)
+  8031a8:	85 f6                	test   %esi,%esi
+  8031aa:	75 3a                	jne    8031e6 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8031ac:	89 da                	mov    %ebx,%edx
+  8031ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b1:	e8 e3 fd ff ff       	call   802f99 <_pipeisclosed>
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	74 c2                	je     80317c <devpipe_read+0x25>
+				return 0;
+  8031ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bf:	eb 31                	jmp    8031f2 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031c1:	89 c1                	mov    %eax,%ecx
+  8031c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8031c6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031c9:	01 c8                	add    %ecx,%eax
+  8031cb:	83 e0 1f             	and    $0x1f,%eax
+  8031ce:	29 c8                	sub    %ecx,%eax
+  8031d0:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8031d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031d8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8031db:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031de:	83 c6 01             	add    $0x1,%esi
+  8031e1:	eb 8f                	jmp    803172 <devpipe_read+0x1b>
+out:
+  8031e3:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8031e6:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8031e9:	89 da                	mov    %ebx,%edx
+  8031eb:	e8 38 fd ff ff       	call   802f28 <pipewake>
+	return i;
+  8031f0:	89 f0                	mov    %esi,%eax
+}
+  8031f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f5:	5b                   	pop    %ebx
+  8031f6:	5e                   	pop    %esi
+  8031f7:	5f                   	pop    %edi
+  8031f8:	5d                   	pop    %ebp
+  8031f9:	c3                   	ret
+
+008031fa <pipe>:
+{
+  8031fa:	55                   	push   %ebp
+  8031fb:	89 e5                	mov    %esp,%ebp
+  8031fd:	56                   	push   %esi
+  8031fe:	53                   	push   %ebx
+  8031ff:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803202:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803205:	50                   	push   %eax
+  803206:	e8 e3 df ff ff       	call   8011ee <fd_alloc>
+  80320b:	89 c3                	mov    %eax,%ebx
+  80320d:	83 c4 10             	add    $0x10,%esp
+  803210:	85 c0                	test   %eax,%eax
+  803212:	0f 88 23 01 00 00    	js     80333b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803218:	83 ec 04             	sub    $0x4,%esp
+  80321b:	68 07 04 00 00       	push   $0x407
+  803220:	ff 75 f4             	push   -0xc(%ebp)
+  803223:	6a 00                	push   $0x0
+  803225:	e8 fb da ff ff       	call   800d25 <sys_page_alloc>
+  80322a:	89 c3                	mov    %eax,%ebx
+  80322c:	83 c4 10             	add    $0x10,%esp
+  80322f:	85 c0                	test   %eax,%eax
+  803231:	0f 88 04 01 00 00    	js     80333b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803237:	83 ec 0c             	sub    $0xc,%esp
+  80323a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80323d:	50                   	push   %eax
+  80323e:	e8 ab df ff ff       	call   8011ee <fd_alloc>
+  803243:	89 c3                	mov    %eax,%ebx
+  803245:	83 c4 10             	add    $0x10,%esp
+  803248:	85 c0                	test   %eax,%eax
+  80324a:	0f 88 db 00 00 00    	js     80332b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803250:	83 ec 04             	sub    $0x4,%esp
+  803253:	68 07 04 00 00       	push   $0x407
+  803258:	ff 75 f0             	push   -0x10(%ebp)
+  80325b:	6a 00                	push   $0x0
+  80325d:	e8 c3 da ff ff       	call   800d25 <sys_page_alloc>
+  803262:	89 c3                	mov    %eax,%ebx
+  803264:	83 c4 10             	add    $0x10,%esp
+  803267:	85 c0                	test   %eax,%eax
+  803269:	0f 88 bc 00 00 00    	js     80332b <pipe+0x131>
+	va = fd2data(fd0);
+  80326f:	83 ec 0c             	sub    $0xc,%esp
+  803272:	ff 75 f4             	push   -0xc(%ebp)
+  803275:	e8 5d df ff ff       	call   8011d7 <fd2data>
+  80327a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80327c:	83 c4 0c             	add    $0xc,%esp
+  80327f:	68 07 04 00 00       	push   $0x407
+  803284:	50                   	push   %eax
+  803285:	6a 00                	push   $0x0
+  803287:	e8 99 da ff ff       	call   800d25 <sys_page_alloc>
+  80328c:	89 c3                	mov    %eax,%ebx
+  80328e:	83 c4 10             	add    $0x10,%esp
+  803291:	85 c0                	test   %eax,%eax
+  803293:	0f 88 82 00 00 00    	js     80331b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803299:	83 ec 0c             	sub    $0xc,%esp
+  80329c:	ff 75 f0             	push   -0x10(%ebp)
+  80329f:	e8 33 df ff ff       	call   8011d7 <fd2data>
+  8032a4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032ab:	50                   	push   %eax
+  8032ac:	6a 00                	push   $0x0
+  8032ae:	56                   	push   %esi
+  8032af:	6a 00                	push   $0x0
+  8032b1:	e8 bc da ff ff       	call   800d72 <sys_page_map>
+  8032b6:	89 c3                	mov    %eax,%ebx
+  8032b8:	83 c4 20             	add    $0x20,%esp
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	78 4e                	js     80330d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032bf:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  8032c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032c7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032d6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032db:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032e2:	83 ec 0c             	sub    $0xc,%esp
+  8032e5:	ff 75 f4             	push   -0xc(%ebp)
+  8032e8:	e8 da de ff ff       	call   8011c7 <fd2num>
+  8032ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032f0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032f2:	83 c4 04             	add    $0x4,%esp
+  8032f5:	ff 75 f0             	push   -0x10(%ebp)
+  8032f8:	e8 ca de ff ff       	call   8011c7 <fd2num>
+  8032fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803300:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803303:	83 c4 10             	add    $0x10,%esp
+  803306:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80330b:	eb 2e                	jmp    80333b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80330d:	83 ec 08             	sub    $0x8,%esp
+  803310:	56                   	push   %esi
+  803311:	6a 00                	push   $0x0
+  803313:	e8 a6 da ff ff       	call   800dbe <sys_page_unmap>
+  803318:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80331b:	83 ec 08             	sub    $0x8,%esp
+  80331e:	ff 75 f0             	push   -0x10(%ebp)
+  803321:	6a 00                	push   $0x0
+  803323:	e8 96 da ff ff       	call   800dbe <sys_page_unmap>
+  803328:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80332b:	83 ec 08             	sub    $0x8,%esp
+  80332e:	ff 75 f4             	push   -0xc(%ebp)
+  803331:	6a 00                	push   $0x0
+  803333:	e8 86 da ff ff       	call   800dbe <sys_page_unmap>
+  803338:	83 c4 10             	add    $0x10,%esp
+}
+  80333b:	89 d8                	mov    %ebx,%eax
+  80333d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803340:	5b                   	pop    %ebx
+  803341:	5e                   	pop    %esi
+  803342:	5d                   	pop    %ebp
+  803343:	c3                   	ret
+
+00803344 <pipeisclosed>:
+{
+  803344:	55                   	push   %ebp
+  803345:	89 e5                	mov    %esp,%ebp
+  803347:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80334a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80334d:	50                   	push   %eax
+  80334e:	ff 75 08             	push   0x8(%ebp)
+  803351:	e8 ee de ff ff       	call   801244 <fd_lookup>
+  803356:	83 c4 10             	add    $0x10,%esp
+  803359:	85 c0                	test   %eax,%eax
+  80335b:	78 18                	js     803375 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80335d:	83 ec 0c             	sub    $0xc,%esp
+  803360:	ff 75 f4             	push   -0xc(%ebp)
+  803363:	e8 6f de ff ff       	call   8011d7 <fd2data>
+  803368:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80336a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80336d:	e8 27 fc ff ff       	call   802f99 <_pipeisclosed>
+  803372:	83 c4 10             	add    $0x10,%esp
+}
+  803375:	c9                   	leave
+  803376:	c3                   	ret
+
+00803377 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803377:	55                   	push   %ebp
+  803378:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80337a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803383:	5d                   	pop    %ebp
+  803384:	c3                   	ret
+
+00803385 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803385:	55                   	push   %ebp
+  803386:	89 e5                	mov    %esp,%ebp
+  803388:	56                   	push   %esi
+  803389:	53                   	push   %ebx
+  80338a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80338d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803392:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803397:	89 d0                	mov    %edx,%eax
+  803399:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	74 2d                	je     8033ce <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8033a1:	83 f8 02             	cmp    $0x2,%eax
+  8033a4:	74 08                	je     8033ae <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8033a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8033ab:	f0 87 03             	lock xchg %eax,(%ebx)
+  8033ae:	be 02 00 00 00       	mov    $0x2,%esi
+  8033b3:	eb 15                	jmp    8033ca <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033b5:	83 ec 04             	sub    $0x4,%esp
+  8033b8:	6a 00                	push   $0x0
+  8033ba:	6a 02                	push   $0x2
+  8033bc:	53                   	push   %ebx
+  8033bd:	e8 78 dc ff ff       	call   80103a <sys_futex_wait>
+  8033c2:	89 f0                	mov    %esi,%eax
+  8033c4:	f0 87 03             	lock xchg %eax,(%ebx)
+  8033c7:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	75 e7                	jne    8033b5 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8033ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d1:	5b                   	pop    %ebx
+  8033d2:	5e                   	pop    %esi
+  8033d3:	5d                   	pop    %ebp
+  8033d4:	c3                   	ret
+
+008033d5 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8033d5:	55                   	push   %ebp
+  8033d6:	89 e5                	mov    %esp,%ebp
+  8033d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8033db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8033e5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8033e9:	f7 d8                	neg    %eax
+  8033eb:	19 c0                	sbb    %eax,%eax
+  8033ed:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8033f0:	5d                   	pop    %ebp
+  8033f1:	c3                   	ret
+
+008033f2 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8033f2:	55                   	push   %ebp
+  8033f3:	89 e5                	mov    %esp,%ebp
+  8033f5:	83 ec 08             	sub    $0x8,%esp
+  8033f8:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8033fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803400:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803403:	83 f8 02             	cmp    $0x2,%eax
+  803406:	74 02                	je     80340a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803408:	c9                   	leave
+  803409:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80340a:	83 ec 08             	sub    $0x8,%esp
+  80340d:	6a 01                	push   $0x1
+  80340f:	52                   	push   %edx
+  803410:	e8 54 dc ff ff       	call   801069 <sys_futex_wake>
+  803415:	83 c4 10             	add    $0x10,%esp
+}
+  803418:	eb ee                	jmp    803408 <mutex_unlock+0x16>
+
+0080341a <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80341d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803420:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803426:	5d                   	pop    %ebp
+  803427:	c3                   	ret
+
+00803428 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803428:	55                   	push   %ebp
+  803429:	89 e5                	mov    %esp,%ebp
+  80342b:	57                   	push   %edi
+  80342c:	56                   	push   %esi
+  80342d:	53                   	push   %ebx
+  80342e:	83 ec 18             	sub    $0x18,%esp
+  803431:	8b 75 08             	mov    0x8(%ebp),%esi
+  803434:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803437:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803439:	53                   	push   %ebx
+  80343a:	e8 b3 ff ff ff       	call   8033f2 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80343f:	83 c4 0c             	add    $0xc,%esp
+  803442:	ff 75 10             	push   0x10(%ebp)
+  803445:	57                   	push   %edi
+  803446:	56                   	push   %esi
+  803447:	e8 ee db ff ff       	call   80103a <sys_futex_wait>
+  80344c:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80344e:	83 c4 10             	add    $0x10,%esp
+  803451:	be 02 00 00 00       	mov    $0x2,%esi
+  803456:	eb 10                	jmp    803468 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803458:	83 ec 04             	sub    $0x4,%esp
+  80345b:	6a 00                	push   $0x0
+  80345d:	6a 02                	push   $0x2
+  80345f:	53                   	push   %ebx
+  803460:	e8 d5 db ff ff       	call   80103a <sys_futex_wait>
+  803465:	83 c4 10             	add    $0x10,%esp
+  803468:	89 f0                	mov    %esi,%eax
+  80346a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80346d:	85 c0                	test   %eax,%eax
+  80346f:	75 e7                	jne    803458 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803471:	83 ff ec             	cmp    $0xffffffec,%edi
+  803474:	74 05                	je     80347b <cond_timedwait+0x53>
+  803476:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80347b:	89 f8                	mov    %edi,%eax
+  80347d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803480:	5b                   	pop    %ebx
+  803481:	5e                   	pop    %esi
+  803482:	5f                   	pop    %edi
+  803483:	5d                   	pop    %ebp
+  803484:	c3                   	ret
+
+00803485 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803485:	55                   	push   %ebp
+  803486:	89 e5                	mov    %esp,%ebp
+  803488:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80348b:	6a 00                	push   $0x0
+  80348d:	ff 75 0c             	push   0xc(%ebp)
+  803490:	ff 75 08             	push   0x8(%ebp)
+  803493:	e8 90 ff ff ff       	call   803428 <cond_timedwait>
+}
+  803498:	83 c4 10             	add    $0x10,%esp
+  80349b:	c9                   	leave
+  80349c:	c3                   	ret
+
+0080349d <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	83 ec 10             	sub    $0x10,%esp
+  8034a3:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8034a6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034ab:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8034af:	6a 01                	push   $0x1
+  8034b1:	50                   	push   %eax
+  8034b2:	e8 b2 db ff ff       	call   801069 <sys_futex_wake>
+}
+  8034b7:	83 c4 10             	add    $0x10,%esp
+  8034ba:	c9                   	leave
+  8034bb:	c3                   	ret
+
+008034bc <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8034bc:	55                   	push   %ebp
+  8034bd:	89 e5                	mov    %esp,%ebp
+  8034bf:	83 ec 10             	sub    $0x10,%esp
+  8034c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034ca:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8034ce:	68 00 04 00 00       	push   $0x400
+  8034d3:	50                   	push   %eax
+  8034d4:	e8 90 db ff ff       	call   801069 <sys_futex_wake>
+}
+  8034d9:	83 c4 10             	add    $0x10,%esp
+  8034dc:	c9                   	leave
+  8034dd:	c3                   	ret
+
+008034de <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8034de:	55                   	push   %ebp
+  8034df:	89 e5                	mov    %esp,%ebp
+  8034e1:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8034e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034e7:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8034e9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8034f0:	5d                   	pop    %ebp
+  8034f1:	c3                   	ret
+
+008034f2 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8034f2:	55                   	push   %ebp
+  8034f3:	89 e5                	mov    %esp,%ebp
+  8034f5:	53                   	push   %ebx
+  8034f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8034f9:	8b 11                	mov    (%ecx),%edx
+  8034fb:	85 d2                	test   %edx,%edx
+  8034fd:	74 14                	je     803513 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8034ff:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803502:	89 d0                	mov    %edx,%eax
+  803504:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803508:	39 c2                	cmp    %eax,%edx
+  80350a:	75 ed                	jne    8034f9 <sem_trywait+0x7>
+			return 0;
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	eb 05                	jmp    803518 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803513:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803518:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80351b:	c9                   	leave
+  80351c:	c3                   	ret
+
+0080351d <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  80351d:	55                   	push   %ebp
+  80351e:	89 e5                	mov    %esp,%ebp
+  803520:	57                   	push   %edi
+  803521:	56                   	push   %esi
+  803522:	53                   	push   %ebx
+  803523:	83 ec 1c             	sub    $0x1c,%esp
+  803526:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803529:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  80352c:	e8 81 da ff ff       	call   800fb2 <sys_time_msec>
+  803531:	01 f8                	add    %edi,%eax
+  803533:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803536:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  80353b:	eb 28                	jmp    803565 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  80353d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803542:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803547:	83 ec 04             	sub    $0x4,%esp
+  80354a:	56                   	push   %esi
+  80354b:	6a 00                	push   $0x0
+  80354d:	53                   	push   %ebx
+  80354e:	e8 e7 da ff ff       	call   80103a <sys_futex_wait>
+  803553:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803558:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  80355d:	83 c4 10             	add    $0x10,%esp
+  803560:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803563:	74 2e                	je     803593 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803565:	83 ec 0c             	sub    $0xc,%esp
+  803568:	53                   	push   %ebx
+  803569:	e8 84 ff ff ff       	call   8034f2 <sem_trywait>
+  80356e:	83 c4 10             	add    $0x10,%esp
+  803571:	85 c0                	test   %eax,%eax
+  803573:	79 19                	jns    80358e <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803575:	85 ff                	test   %edi,%edi
+  803577:	74 c4                	je     80353d <sem_timedwait+0x20>
+  803579:	e8 34 da ff ff       	call   800fb2 <sys_time_msec>
+  80357e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803581:	29 c6                	sub    %eax,%esi
+  803583:	85 f6                	test   %esi,%esi
+  803585:	7f b6                	jg     80353d <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803587:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  80358c:	eb 05                	jmp    803593 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  80358e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803596:	5b                   	pop    %ebx
+  803597:	5e                   	pop    %esi
+  803598:	5f                   	pop    %edi
+  803599:	5d                   	pop    %ebp
+  80359a:	c3                   	ret
+
+0080359b <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80359b:	55                   	push   %ebp
+  80359c:	89 e5                	mov    %esp,%ebp
+  80359e:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8035a1:	6a 00                	push   $0x0
+  8035a3:	ff 75 08             	push   0x8(%ebp)
+  8035a6:	e8 72 ff ff ff       	call   80351d <sem_timedwait>
+}
+  8035ab:	83 c4 10             	add    $0x10,%esp
+  8035ae:	c9                   	leave
+  8035af:	c3                   	ret
+
+008035b0 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8035b0:	55                   	push   %ebp
+  8035b1:	89 e5                	mov    %esp,%ebp
+  8035b3:	83 ec 08             	sub    $0x8,%esp
+  8035b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035be:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8035c2:	8b 50 04             	mov    0x4(%eax),%edx
+  8035c5:	85 d2                	test   %edx,%edx
+  8035c7:	75 02                	jne    8035cb <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8035c9:	c9                   	leave
+  8035ca:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8035cb:	83 ec 08             	sub    $0x8,%esp
+  8035ce:	6a 01                	push   $0x1
+  8035d0:	50                   	push   %eax
+  8035d1:	e8 93 da ff ff       	call   801069 <sys_futex_wake>
+  8035d6:	83 c4 10             	add    $0x10,%esp
+}
+  8035d9:	eb ee                	jmp    8035c9 <sem_post+0x19>
+
+008035db <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8035db:	55                   	push   %ebp
+  8035dc:	89 e5                	mov    %esp,%ebp
+  8035de:	57                   	push   %edi
+  8035df:	56                   	push   %esi
+  8035e0:	53                   	push   %ebx
+  8035e1:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8035e4:	68 20 70 80 00       	push   $0x807020
+  8035e9:	e8 97 fd ff ff       	call   803385 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8035ee:	a1 44 70 80 00       	mov    0x807044,%eax
+  8035f3:	83 c4 10             	add    $0x10,%esp
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	75 19                	jne    803613 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8035fa:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  8035ff:	8b 00                	mov    (%eax),%eax
+  803601:	8b 40 48             	mov    0x48(%eax),%eax
+  803604:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803609:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803610:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803613:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803618:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80361b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803622:	8b 40 04             	mov    0x4(%eax),%eax
+  803625:	85 c0                	test   %eax,%eax
+  803627:	0f 84 e4 00 00 00    	je     803711 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80362d:	83 c3 01             	add    $0x1,%ebx
+  803630:	83 fb 20             	cmp    $0x20,%ebx
+  803633:	75 e3                	jne    803618 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803635:	83 ec 0c             	sub    $0xc,%esp
+  803638:	68 20 70 80 00       	push   $0x807020
+  80363d:	e8 b0 fd ff ff       	call   8033f2 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80364a:	e9 b8 00 00 00       	jmp    803707 <pthread_create+0x12c>
+  80364f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803652:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803655:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803657:	39 f3                	cmp    %esi,%ebx
+  803659:	73 16                	jae    803671 <pthread_create+0x96>
+		va -= PGSIZE;
+  80365b:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803661:	83 ec 08             	sub    $0x8,%esp
+  803664:	56                   	push   %esi
+  803665:	6a 00                	push   $0x0
+  803667:	e8 52 d7 ff ff       	call   800dbe <sys_page_unmap>
+  80366c:	83 c4 10             	add    $0x10,%esp
+  80366f:	eb e6                	jmp    803657 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803671:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803674:	83 ec 08             	sub    $0x8,%esp
+  803677:	ff 75 e4             	push   -0x1c(%ebp)
+  80367a:	6a 00                	push   $0x0
+  80367c:	e8 3d d7 ff ff       	call   800dbe <sys_page_unmap>
+	return r;
+  803681:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803684:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803687:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80368e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803695:	eb 70                	jmp    803707 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803697:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80369a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8036a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036a4:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8036a7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036aa:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8036ad:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8036b4:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8036b9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8036bc:	29 c8                	sub    %ecx,%eax
+  8036be:	85 db                	test   %ebx,%ebx
+  8036c0:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  8036c7:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8036ca:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8036d1:	83 ec 04             	sub    $0x4,%esp
+  8036d4:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036d9:	29 ca                	sub    %ecx,%edx
+  8036db:	52                   	push   %edx
+	*--esp = 0;
+  8036dc:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8036df:	50                   	push   %eax
+  8036e0:	68 38 39 80 00       	push   $0x803938
+  8036e5:	e8 24 da ff ff       	call   80110e <sys_thread_create>
+  8036ea:	89 c7                	mov    %eax,%edi
+  8036ec:	83 c4 10             	add    $0x10,%esp
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	78 91                	js     803684 <pthread_create+0xa9>
+	th->th_env = id;
+  8036f3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036f6:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8036fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803700:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803702:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803707:	89 f8                	mov    %edi,%eax
+  803709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80370c:	5b                   	pop    %ebx
+  80370d:	5e                   	pop    %esi
+  80370e:	5f                   	pop    %edi
+  80370f:	5d                   	pop    %ebp
+  803710:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803711:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803714:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80371b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803722:	83 ec 0c             	sub    $0xc,%esp
+  803725:	68 20 70 80 00       	push   $0x807020
+  80372a:	e8 c3 fc ff ff       	call   8033f2 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80372f:	89 d9                	mov    %ebx,%ecx
+  803731:	c1 e1 10             	shl    $0x10,%ecx
+  803734:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803737:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  80373c:	29 c8                	sub    %ecx,%eax
+  80373e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803741:	c1 e8 16             	shr    $0x16,%eax
+  803744:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80374b:	83 c4 10             	add    $0x10,%esp
+  80374e:	a8 01                	test   $0x1,%al
+  803750:	74 15                	je     803767 <pthread_create+0x18c>
+  803752:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803755:	c1 e8 0c             	shr    $0xc,%eax
+  803758:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80375f:	a8 01                	test   $0x1,%al
+  803761:	0f 85 30 ff ff ff    	jne    803697 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803767:	83 ec 04             	sub    $0x4,%esp
+  80376a:	6a 07                	push   $0x7
+  80376c:	ff 75 e4             	push   -0x1c(%ebp)
+  80376f:	6a 00                	push   $0x0
+  803771:	e8 af d5 ff ff       	call   800d25 <sys_page_alloc>
+  803776:	89 c7                	mov    %eax,%edi
+  803778:	83 c4 10             	add    $0x10,%esp
+  80377b:	85 c0                	test   %eax,%eax
+  80377d:	0f 88 01 ff ff ff    	js     803684 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803783:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803788:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80378b:	29 d0                	sub    %edx,%eax
+  80378d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803790:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803792:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803797:	29 d0                	sub    %edx,%eax
+  803799:	89 c7                	mov    %eax,%edi
+  80379b:	39 fe                	cmp    %edi,%esi
+  80379d:	0f 83 f4 fe ff ff    	jae    803697 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8037a3:	83 ec 04             	sub    $0x4,%esp
+  8037a6:	6a 07                	push   $0x7
+  8037a8:	56                   	push   %esi
+  8037a9:	6a 00                	push   $0x0
+  8037ab:	e8 75 d5 ff ff       	call   800d25 <sys_page_alloc>
+  8037b0:	83 c4 10             	add    $0x10,%esp
+  8037b3:	85 c0                	test   %eax,%eax
+  8037b5:	0f 88 94 fe ff ff    	js     80364f <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8037bb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8037c1:	eb d8                	jmp    80379b <pthread_create+0x1c0>
+
+008037c3 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8037c3:	55                   	push   %ebp
+  8037c4:	89 e5                	mov    %esp,%ebp
+  8037c6:	57                   	push   %edi
+  8037c7:	56                   	push   %esi
+  8037c8:	53                   	push   %ebx
+  8037c9:	83 ec 0c             	sub    $0xc,%esp
+  8037cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8037cf:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8037d2:	83 f8 1e             	cmp    $0x1e,%eax
+  8037d5:	0f 87 c7 00 00 00    	ja     8038a2 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8037db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037e8:	77 12                	ja     8037fc <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8037ef:	29 d0                	sub    %edx,%eax
+  8037f1:	c1 e8 10             	shr    $0x10,%eax
+  8037f4:	39 c3                	cmp    %eax,%ebx
+  8037f6:	0f 84 ad 00 00 00    	je     8038a9 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037fc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037ff:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803806:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  80380d:	eb 10                	jmp    80381f <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80380f:	83 ec 04             	sub    $0x4,%esp
+  803812:	6a 00                	push   $0x0
+  803814:	6a 01                	push   $0x1
+  803816:	57                   	push   %edi
+  803817:	e8 1e d8 ff ff       	call   80103a <sys_futex_wait>
+  80381c:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  80381f:	8b 46 04             	mov    0x4(%esi),%eax
+  803822:	83 f8 01             	cmp    $0x1,%eax
+  803825:	74 e8                	je     80380f <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803827:	83 f8 02             	cmp    $0x2,%eax
+  80382a:	0f 85 80 00 00 00    	jne    8038b0 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803830:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803833:	c1 e6 02             	shl    $0x2,%esi
+  803836:	eb 05                	jmp    80383d <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803838:	e8 bc d4 ff ff       	call   800cf9 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80383d:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803843:	89 ca                	mov    %ecx,%edx
+  803845:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80384b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80384e:	c1 e0 04             	shl    $0x4,%eax
+  803851:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803856:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803859:	39 c1                	cmp    %eax,%ecx
+  80385b:	75 12                	jne    80386f <pthread_join+0xac>
+  80385d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803860:	c1 e0 04             	shl    $0x4,%eax
+  803863:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803868:	8b 40 54             	mov    0x54(%eax),%eax
+  80386b:	85 c0                	test   %eax,%eax
+  80386d:	75 c9                	jne    803838 <pthread_join+0x75>
+	if (ret_store)
+  80386f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803873:	74 0f                	je     803884 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803875:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803878:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80387f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803882:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803884:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803887:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80388e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80389a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80389d:	5b                   	pop    %ebx
+  80389e:	5e                   	pop    %esi
+  80389f:	5f                   	pop    %edi
+  8038a0:	5d                   	pop    %ebp
+  8038a1:	c3                   	ret
+		return -E_INVAL;
+  8038a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038a7:	eb f1                	jmp    80389a <pthread_join+0xd7>
+  8038a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038ae:	eb ea                	jmp    80389a <pthread_join+0xd7>
+		return -E_INVAL;
+  8038b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038b5:	eb e3                	jmp    80389a <pthread_join+0xd7>
+
+008038b7 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8038b7:	55                   	push   %ebp
+  8038b8:	89 e5                	mov    %esp,%ebp
+  8038ba:	53                   	push   %ebx
+  8038bb:	83 ec 04             	sub    $0x4,%esp
+  8038be:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038c0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038cb:	77 0c                	ja     8038d9 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038d2:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8038d4:	c1 e8 10             	shr    $0x10,%eax
+  8038d7:	75 0a                	jne    8038e3 <pthread_exit+0x2c>
+		exit();
+  8038d9:	e8 22 c9 ff ff       	call   800200 <exit>
+  8038de:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8038e3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8038ea:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8038ed:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8038f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8038f7:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8038fa:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803901:	83 ec 08             	sub    $0x8,%esp
+  803904:	6a 20                	push   $0x20
+  803906:	01 c2                	add    %eax,%edx
+  803908:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  80390f:	50                   	push   %eax
+  803910:	e8 54 d7 ff ff       	call   801069 <sys_futex_wake>
+	sys_env_destroy(0);
+  803915:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80391c:	e8 61 d3 ff ff       	call   800c82 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803921:	83 c4 0c             	add    $0xc,%esp
+  803924:	68 c6 4d 80 00       	push   $0x804dc6
+  803929:	68 a5 00 00 00       	push   $0xa5
+  80392e:	68 e0 4d 80 00       	push   $0x804de0
+  803933:	e8 f0 c8 ff ff       	call   800228 <_panic>
+
+00803938 <pthread_start>:
+{
+  803938:	55                   	push   %ebp
+  803939:	89 e5                	mov    %esp,%ebp
+  80393b:	53                   	push   %ebx
+  80393c:	83 ec 04             	sub    $0x4,%esp
+  80393f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803942:	e8 86 d3 ff ff       	call   800ccd <sys_getenvid>
+  803947:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80394c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803952:	85 db                	test   %ebx,%ebx
+  803954:	74 0c                	je     803962 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803956:	89 d9                	mov    %ebx,%ecx
+  803958:	c1 e1 10             	shl    $0x10,%ecx
+  80395b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803960:	29 ca                	sub    %ecx,%edx
+  803962:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803965:	c1 e0 04             	shl    $0x4,%eax
+  803968:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80396d:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80396f:	83 ec 0c             	sub    $0xc,%esp
+  803972:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803979:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80397c:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803983:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80398a:	89 04 24             	mov    %eax,(%esp)
+  80398d:	e8 25 ff ff ff       	call   8038b7 <pthread_exit>
+
+00803992 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803992:	55                   	push   %ebp
+  803993:	89 e5                	mov    %esp,%ebp
+  803995:	57                   	push   %edi
+  803996:	56                   	push   %esi
+  803997:	53                   	push   %ebx
+  803998:	83 ec 1c             	sub    $0x1c,%esp
+  80399b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80399d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8039a3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039aa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039af:	77 0d                	ja     8039be <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039b1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039b6:	29 d0                	sub    %edx,%eax
+  8039b8:	c1 e8 10             	shr    $0x10,%eax
+  8039bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8039be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039c3:	eb 2f                	jmp    8039f4 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8039c5:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039cb:	8b 01                	mov    (%ecx),%eax
+  8039cd:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8039d0:	39 c2                	cmp    %eax,%edx
+  8039d2:	75 14                	jne    8039e8 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8039d4:	83 ec 0c             	sub    $0xc,%esp
+  8039d7:	57                   	push   %edi
+  8039d8:	e8 a5 d2 ff ff       	call   800c82 <sys_env_destroy>
+  8039dd:	83 c4 10             	add    $0x10,%esp
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	0f 88 97 00 00 00    	js     803a7f <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8039e8:	83 c3 01             	add    $0x1,%ebx
+  8039eb:	83 fb 20             	cmp    $0x20,%ebx
+  8039ee:	0f 84 d2 00 00 00    	je     803ac6 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8039f4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8039f7:	74 ef                	je     8039e8 <pthread_kill_others+0x56>
+  8039f9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039fc:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a03:	8b 40 04             	mov    0x4(%eax),%eax
+  803a06:	83 f8 01             	cmp    $0x1,%eax
+  803a09:	75 dd                	jne    8039e8 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803a0b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a0e:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803a15:	89 fe                	mov    %edi,%esi
+  803a17:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a1d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a20:	c1 e0 04             	shl    $0x4,%eax
+  803a23:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a28:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a2b:	39 c7                	cmp    %eax,%edi
+  803a2d:	75 b9                	jne    8039e8 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a2f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a32:	c1 e0 04             	shl    $0x4,%eax
+  803a35:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a3a:	8b 40 54             	mov    0x54(%eax),%eax
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	74 a7                	je     8039e8 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a41:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a44:	c1 e0 04             	shl    $0x4,%eax
+  803a47:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803a4d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a4f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803a55:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a5a:	0f 87 65 ff ff ff    	ja     8039c5 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a60:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a65:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803a67:	c1 e8 10             	shr    $0x10,%eax
+  803a6a:	0f 84 55 ff ff ff    	je     8039c5 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a70:	c1 e0 10             	shl    $0x10,%eax
+  803a73:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803a78:	29 c1                	sub    %eax,%ecx
+  803a7a:	e9 4c ff ff ff       	jmp    8039cb <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803a7f:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a82:	c1 e2 04             	shl    $0x4,%edx
+  803a85:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a8b:	8b 52 48             	mov    0x48(%edx),%edx
+  803a8e:	39 fa                	cmp    %edi,%edx
+  803a90:	0f 85 52 ff ff ff    	jne    8039e8 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803a96:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a99:	c1 e2 04             	shl    $0x4,%edx
+  803a9c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803aa2:	8b 52 54             	mov    0x54(%edx),%edx
+  803aa5:	85 d2                	test   %edx,%edx
+  803aa7:	0f 84 3b ff ff ff    	je     8039e8 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803aad:	83 ec 0c             	sub    $0xc,%esp
+  803ab0:	50                   	push   %eax
+  803ab1:	57                   	push   %edi
+  803ab2:	68 f0 4d 80 00       	push   $0x804df0
+  803ab7:	68 bb 00 00 00       	push   $0xbb
+  803abc:	68 e0 4d 80 00       	push   $0x804de0
+  803ac1:	e8 62 c7 ff ff       	call   800228 <_panic>
+	}
+}
+  803ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac9:	5b                   	pop    %ebx
+  803aca:	5e                   	pop    %esi
+  803acb:	5f                   	pop    %edi
+  803acc:	5d                   	pop    %ebp
+  803acd:	c3                   	ret
+
+00803ace <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803ace:	55                   	push   %ebp
+  803acf:	89 e5                	mov    %esp,%ebp
+  803ad1:	53                   	push   %ebx
+  803ad2:	83 ec 04             	sub    $0x4,%esp
+  803ad5:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ad7:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803add:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ae3:	0f 87 85 00 00 00    	ja     803b6e <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ae9:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803aee:	29 c3                	sub    %eax,%ebx
+  803af0:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803af3:	83 ec 04             	sub    $0x4,%esp
+  803af6:	68 80 02 00 00       	push   $0x280
+  803afb:	6a 00                	push   $0x0
+  803afd:	68 40 70 80 00       	push   $0x807040
+  803b02:	e8 31 cf ff ff       	call   800a38 <memset>
+	threads_mu.m_state = 0;
+  803b07:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803b0e:	00 00 00 
+	if (self != 0) {
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	85 db                	test   %ebx,%ebx
+  803b16:	74 51                	je     803b69 <pthread_fork_child+0x9b>
+  803b18:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b1a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b20:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b25:	77 18                	ja     803b3f <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b27:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b2c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803b2e:	c1 e8 10             	shr    $0x10,%eax
+  803b31:	74 0c                	je     803b3f <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b33:	c1 e0 10             	shl    $0x10,%eax
+  803b36:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b3b:	29 c2                	sub    %eax,%edx
+  803b3d:	eb 06                	jmp    803b45 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803b3f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803b45:	8b 02                	mov    (%edx),%eax
+  803b47:	8b 48 48             	mov    0x48(%eax),%ecx
+  803b4a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803b51:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803b54:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803b5b:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803b62:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803b69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b6c:	c9                   	leave
+  803b6d:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803b6e:	83 ec 04             	sub    $0x4,%esp
+  803b71:	68 80 02 00 00       	push   $0x280
+  803b76:	6a 00                	push   $0x0
+  803b78:	68 40 70 80 00       	push   $0x807040
+  803b7d:	e8 b6 ce ff ff       	call   800a38 <memset>
+	threads_mu.m_state = 0;
+  803b82:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803b89:	00 00 00 
+  803b8c:	83 c4 10             	add    $0x10,%esp
+  803b8f:	eb d8                	jmp    803b69 <pthread_fork_child+0x9b>
+
+00803b91 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b96:	c3                   	ret
+
+00803b97 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b97:	55                   	push   %ebp
+  803b98:	89 e5                	mov    %esp,%ebp
+  803b9a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b9d:	68 15 4e 80 00       	push   $0x804e15
+  803ba2:	ff 75 0c             	push   0xc(%ebp)
+  803ba5:	e8 3d cd ff ff       	call   8008e7 <strcpy>
+	return 0;
+}
+  803baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803baf:	c9                   	leave
+  803bb0:	c3                   	ret
+
+00803bb1 <devcons_write>:
+{
+  803bb1:	55                   	push   %ebp
+  803bb2:	89 e5                	mov    %esp,%ebp
+  803bb4:	57                   	push   %edi
+  803bb5:	56                   	push   %esi
+  803bb6:	53                   	push   %ebx
+  803bb7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803bbd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803bc2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803bc8:	eb 2e                	jmp    803bf8 <devcons_write+0x47>
+		m = n - tot;
+  803bca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803bcd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803bcf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bd4:	39 c3                	cmp    %eax,%ebx
+  803bd6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803bd9:	83 ec 04             	sub    $0x4,%esp
+  803bdc:	53                   	push   %ebx
+  803bdd:	89 f0                	mov    %esi,%eax
+  803bdf:	03 45 0c             	add    0xc(%ebp),%eax
+  803be2:	50                   	push   %eax
+  803be3:	57                   	push   %edi
+  803be4:	e8 84 ce ff ff       	call   800a6d <memmove>
+		sys_cputs(buf, m);
+  803be9:	83 c4 08             	add    $0x8,%esp
+  803bec:	53                   	push   %ebx
+  803bed:	57                   	push   %edi
+  803bee:	e8 38 d0 ff ff       	call   800c2b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803bf3:	01 de                	add    %ebx,%esi
+  803bf5:	83 c4 10             	add    $0x10,%esp
+  803bf8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803bfb:	72 cd                	jb     803bca <devcons_write+0x19>
+}
+  803bfd:	89 f0                	mov    %esi,%eax
+  803bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c02:	5b                   	pop    %ebx
+  803c03:	5e                   	pop    %esi
+  803c04:	5f                   	pop    %edi
+  803c05:	5d                   	pop    %ebp
+  803c06:	c3                   	ret
+
+00803c07 <devcons_read>:
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c12:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c16:	75 07                	jne    803c1f <devcons_read+0x18>
+  803c18:	eb 1f                	jmp    803c39 <devcons_read+0x32>
+		sys_yield();
+  803c1a:	e8 da d0 ff ff       	call   800cf9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803c1f:	e8 32 d0 ff ff       	call   800c56 <sys_cgetc>
+  803c24:	85 c0                	test   %eax,%eax
+  803c26:	74 f2                	je     803c1a <devcons_read+0x13>
+	if (c < 0)
+  803c28:	78 0f                	js     803c39 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803c2a:	83 f8 04             	cmp    $0x4,%eax
+  803c2d:	74 0c                	je     803c3b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803c2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c32:	88 02                	mov    %al,(%edx)
+	return 1;
+  803c34:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803c39:	c9                   	leave
+  803c3a:	c3                   	ret
+		return 0;
+  803c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c40:	eb f7                	jmp    803c39 <devcons_read+0x32>
+
+00803c42 <cputchar>:
+{
+  803c42:	55                   	push   %ebp
+  803c43:	89 e5                	mov    %esp,%ebp
+  803c45:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c4b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803c4e:	6a 01                	push   $0x1
+  803c50:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c53:	50                   	push   %eax
+  803c54:	e8 d2 cf ff ff       	call   800c2b <sys_cputs>
+}
+  803c59:	83 c4 10             	add    $0x10,%esp
+  803c5c:	c9                   	leave
+  803c5d:	c3                   	ret
+
+00803c5e <getchar>:
+{
+  803c5e:	55                   	push   %ebp
+  803c5f:	89 e5                	mov    %esp,%ebp
+  803c61:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803c64:	6a 01                	push   $0x1
+  803c66:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c69:	50                   	push   %eax
+  803c6a:	6a 00                	push   $0x0
+  803c6c:	e8 63 d8 ff ff       	call   8014d4 <read>
+	if (r < 0)
+  803c71:	83 c4 10             	add    $0x10,%esp
+  803c74:	85 c0                	test   %eax,%eax
+  803c76:	78 06                	js     803c7e <getchar+0x20>
+	if (r < 1)
+  803c78:	74 06                	je     803c80 <getchar+0x22>
+	return c;
+  803c7a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803c7e:	c9                   	leave
+  803c7f:	c3                   	ret
+		return -E_EOF;
+  803c80:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803c85:	eb f7                	jmp    803c7e <getchar+0x20>
+
+00803c87 <iscons>:
+{
+  803c87:	55                   	push   %ebp
+  803c88:	89 e5                	mov    %esp,%ebp
+  803c8a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c90:	50                   	push   %eax
+  803c91:	ff 75 08             	push   0x8(%ebp)
+  803c94:	e8 ab d5 ff ff       	call   801244 <fd_lookup>
+  803c99:	83 c4 10             	add    $0x10,%esp
+  803c9c:	85 c0                	test   %eax,%eax
+  803c9e:	78 11                	js     803cb1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803ca0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ca3:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  803ca9:	39 10                	cmp    %edx,(%eax)
+  803cab:	0f 94 c0             	sete   %al
+  803cae:	0f b6 c0             	movzbl %al,%eax
+}
+  803cb1:	c9                   	leave
+  803cb2:	c3                   	ret
+
+00803cb3 <opencons>:
+{
+  803cb3:	55                   	push   %ebp
+  803cb4:	89 e5                	mov    %esp,%ebp
+  803cb6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803cb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cbc:	50                   	push   %eax
+  803cbd:	e8 2c d5 ff ff       	call   8011ee <fd_alloc>
+  803cc2:	83 c4 10             	add    $0x10,%esp
+  803cc5:	85 c0                	test   %eax,%eax
+  803cc7:	78 3a                	js     803d03 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803cc9:	83 ec 04             	sub    $0x4,%esp
+  803ccc:	68 07 04 00 00       	push   $0x407
+  803cd1:	ff 75 f4             	push   -0xc(%ebp)
+  803cd4:	6a 00                	push   $0x0
+  803cd6:	e8 4a d0 ff ff       	call   800d25 <sys_page_alloc>
+  803cdb:	83 c4 10             	add    $0x10,%esp
+  803cde:	85 c0                	test   %eax,%eax
+  803ce0:	78 21                	js     803d03 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803ce2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ce5:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  803ceb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803ced:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cf0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803cf7:	83 ec 0c             	sub    $0xc,%esp
+  803cfa:	50                   	push   %eax
+  803cfb:	e8 c7 d4 ff ff       	call   8011c7 <fd2num>
+  803d00:	83 c4 10             	add    $0x10,%esp
+}
+  803d03:	c9                   	leave
+  803d04:	c3                   	ret
+
+00803d05 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803d05:	55                   	push   %ebp
+  803d06:	89 e5                	mov    %esp,%ebp
+  803d08:	57                   	push   %edi
+  803d09:	56                   	push   %esi
+  803d0a:	53                   	push   %ebx
+  803d0b:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803d0e:	89 d6                	mov    %edx,%esi
+  803d10:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803d13:	89 cf                	mov    %ecx,%edi
+  803d15:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803d18:	89 fa                	mov    %edi,%edx
+  803d1a:	80 ce 08             	or     $0x8,%dh
+  803d1d:	f6 c5 08             	test   $0x8,%ch
+  803d20:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803d23:	57                   	push   %edi
+  803d24:	56                   	push   %esi
+  803d25:	50                   	push   %eax
+  803d26:	56                   	push   %esi
+  803d27:	6a 00                	push   $0x0
+  803d29:	e8 44 d0 ff ff       	call   800d72 <sys_page_map>
+	if (r < 0) {
+  803d2e:	83 c4 20             	add    $0x20,%esp
+  803d31:	85 c0                	test   %eax,%eax
+  803d33:	78 27                	js     803d5c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803d35:	83 ec 0c             	sub    $0xc,%esp
+  803d38:	57                   	push   %edi
+  803d39:	56                   	push   %esi
+  803d3a:	6a 00                	push   $0x0
+  803d3c:	56                   	push   %esi
+  803d3d:	6a 00                	push   $0x0
+  803d3f:	e8 2e d0 ff ff       	call   800d72 <sys_page_map>
+  803d44:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d46:	83 c4 20             	add    $0x20,%esp
+  803d49:	85 c0                	test   %eax,%eax
+  803d4b:	78 24                	js     803d71 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803d4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d52:	89 d8                	mov    %ebx,%eax
+  803d54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d57:	5b                   	pop    %ebx
+  803d58:	5e                   	pop    %esi
+  803d59:	5f                   	pop    %edi
+  803d5a:	5d                   	pop    %ebp
+  803d5b:	c3                   	ret
+  803d5c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d5e:	83 ec 08             	sub    $0x8,%esp
+  803d61:	50                   	push   %eax
+  803d62:	68 24 4e 80 00       	push   $0x804e24
+  803d67:	e8 97 c5 ff ff       	call   800303 <cprintf>
+		return r;
+  803d6c:	83 c4 10             	add    $0x10,%esp
+  803d6f:	eb e1                	jmp    803d52 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d71:	83 ec 08             	sub    $0x8,%esp
+  803d74:	50                   	push   %eax
+  803d75:	68 54 4e 80 00       	push   $0x804e54
+  803d7a:	e8 84 c5 ff ff       	call   800303 <cprintf>
+		return r;
+  803d7f:	83 c4 10             	add    $0x10,%esp
+  803d82:	eb ce                	jmp    803d52 <duppage_cow+0x4d>
+
+00803d84 <duppage>:
+{
+  803d84:	55                   	push   %ebp
+  803d85:	89 e5                	mov    %esp,%ebp
+  803d87:	53                   	push   %ebx
+  803d88:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803d8b:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803d8e:	51                   	push   %ecx
+  803d8f:	52                   	push   %edx
+  803d90:	50                   	push   %eax
+  803d91:	52                   	push   %edx
+  803d92:	6a 00                	push   $0x0
+  803d94:	e8 d9 cf ff ff       	call   800d72 <sys_page_map>
+	if (r < 0) {
+  803d99:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803da1:	85 c0                	test   %eax,%eax
+  803da3:	78 07                	js     803dac <duppage+0x28>
+}
+  803da5:	89 d8                	mov    %ebx,%eax
+  803da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803daa:	c9                   	leave
+  803dab:	c3                   	ret
+  803dac:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803dae:	83 ec 08             	sub    $0x8,%esp
+  803db1:	50                   	push   %eax
+  803db2:	68 24 4e 80 00       	push   $0x804e24
+  803db7:	e8 47 c5 ff ff       	call   800303 <cprintf>
+		return r;
+  803dbc:	83 c4 10             	add    $0x10,%esp
+  803dbf:	eb e4                	jmp    803da5 <duppage+0x21>
+
+00803dc1 <cow_copy>:
+{
+  803dc1:	55                   	push   %ebp
+  803dc2:	89 e5                	mov    %esp,%ebp
+  803dc4:	56                   	push   %esi
+  803dc5:	53                   	push   %ebx
+  803dc6:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803dc8:	83 ec 04             	sub    $0x4,%esp
+  803dcb:	6a 07                	push   $0x7
+  803dcd:	68 00 f0 7f 00       	push   $0x7ff000
+  803dd2:	6a 00                	push   $0x0
+  803dd4:	e8 4c cf ff ff       	call   800d25 <sys_page_alloc>
+	if (r < 0) {
+  803dd9:	83 c4 10             	add    $0x10,%esp
+  803ddc:	85 c0                	test   %eax,%eax
+  803dde:	78 58                	js     803e38 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803de0:	83 ec 04             	sub    $0x4,%esp
+  803de3:	68 00 10 00 00       	push   $0x1000
+  803de8:	56                   	push   %esi
+  803de9:	68 00 f0 7f 00       	push   $0x7ff000
+  803dee:	e8 7a cc ff ff       	call   800a6d <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803df3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803dfa:	56                   	push   %esi
+  803dfb:	6a 00                	push   $0x0
+  803dfd:	68 00 f0 7f 00       	push   $0x7ff000
+  803e02:	6a 00                	push   $0x0
+  803e04:	e8 69 cf ff ff       	call   800d72 <sys_page_map>
+  803e09:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e0b:	83 c4 20             	add    $0x20,%esp
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	78 3b                	js     803e4d <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803e12:	83 ec 08             	sub    $0x8,%esp
+  803e15:	68 00 f0 7f 00       	push   $0x7ff000
+  803e1a:	6a 00                	push   $0x0
+  803e1c:	e8 9d cf ff ff       	call   800dbe <sys_page_unmap>
+  803e21:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e23:	83 c4 10             	add    $0x10,%esp
+  803e26:	85 c0                	test   %eax,%eax
+  803e28:	78 45                	js     803e6f <cow_copy+0xae>
+	return 0;
+  803e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e2f:	89 d8                	mov    %ebx,%eax
+  803e31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e34:	5b                   	pop    %ebx
+  803e35:	5e                   	pop    %esi
+  803e36:	5d                   	pop    %ebp
+  803e37:	c3                   	ret
+  803e38:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803e3a:	83 ec 08             	sub    $0x8,%esp
+  803e3d:	50                   	push   %eax
+  803e3e:	68 44 4f 80 00       	push   $0x804f44
+  803e43:	e8 bb c4 ff ff       	call   800303 <cprintf>
+		return r;
+  803e48:	83 c4 10             	add    $0x10,%esp
+  803e4b:	eb e2                	jmp    803e2f <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803e4d:	83 ec 08             	sub    $0x8,%esp
+  803e50:	50                   	push   %eax
+  803e51:	68 60 4f 80 00       	push   $0x804f60
+  803e56:	e8 a8 c4 ff ff       	call   800303 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803e5b:	83 c4 08             	add    $0x8,%esp
+  803e5e:	68 00 f0 7f 00       	push   $0x7ff000
+  803e63:	6a 00                	push   $0x0
+  803e65:	e8 54 cf ff ff       	call   800dbe <sys_page_unmap>
+		return r;
+  803e6a:	83 c4 10             	add    $0x10,%esp
+  803e6d:	eb c0                	jmp    803e2f <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e6f:	83 ec 08             	sub    $0x8,%esp
+  803e72:	50                   	push   %eax
+  803e73:	68 7c 4e 80 00       	push   $0x804e7c
+  803e78:	e8 86 c4 ff ff       	call   800303 <cprintf>
+		return r;
+  803e7d:	83 c4 10             	add    $0x10,%esp
+  803e80:	eb ad                	jmp    803e2f <cow_copy+0x6e>
+
+00803e82 <pgfault>:
+{
+  803e82:	55                   	push   %ebp
+  803e83:	89 e5                	mov    %esp,%ebp
+  803e85:	56                   	push   %esi
+  803e86:	53                   	push   %ebx
+  803e87:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803e8a:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803e8c:	89 d8                	mov    %ebx,%eax
+  803e8e:	c1 e8 16             	shr    $0x16,%eax
+  803e91:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e98:	89 de                	mov    %ebx,%esi
+  803e9a:	c1 ee 0c             	shr    $0xc,%esi
+  803e9d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803ea4:	a8 07                	test   $0x7,%al
+  803ea6:	74 3b                	je     803ee3 <pgfault+0x61>
+  803ea8:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803eae:	74 33                	je     803ee3 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803eb0:	83 ec 0c             	sub    $0xc,%esp
+  803eb3:	68 00 f0 bf ee       	push   $0xeebff000
+  803eb8:	e8 c8 f4 ff ff       	call   803385 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803ebd:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803ec4:	83 c4 10             	add    $0x10,%esp
+  803ec7:	f6 c4 08             	test   $0x8,%ah
+  803eca:	75 30                	jne    803efc <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803ecc:	83 ec 0c             	sub    $0xc,%esp
+  803ecf:	68 00 f0 bf ee       	push   $0xeebff000
+  803ed4:	e8 19 f5 ff ff       	call   8033f2 <mutex_unlock>
+}
+  803ed9:	83 c4 10             	add    $0x10,%esp
+  803edc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803edf:	5b                   	pop    %ebx
+  803ee0:	5e                   	pop    %esi
+  803ee1:	5d                   	pop    %ebp
+  803ee2:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803ee3:	83 ec 08             	sub    $0x8,%esp
+  803ee6:	ff 72 28             	push   0x28(%edx)
+  803ee9:	51                   	push   %ecx
+  803eea:	50                   	push   %eax
+  803eeb:	68 a0 4e 80 00       	push   $0x804ea0
+  803ef0:	6a 3f                	push   $0x3f
+  803ef2:	68 7a 4f 80 00       	push   $0x804f7a
+  803ef7:	e8 2c c3 ff ff       	call   800228 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803efc:	89 d8                	mov    %ebx,%eax
+  803efe:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803f03:	e8 b9 fe ff ff       	call   803dc1 <cow_copy>
+  803f08:	eb c2                	jmp    803ecc <pgfault+0x4a>
+
+00803f0a <cow_enable>:
+{
+  803f0a:	55                   	push   %ebp
+  803f0b:	89 e5                	mov    %esp,%ebp
+  803f0d:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803f10:	68 82 3e 80 00       	push   $0x803e82
+  803f15:	e8 28 06 00 00       	call   804542 <set_pgfault_handler>
+}
+  803f1a:	83 c4 10             	add    $0x10,%esp
+  803f1d:	c9                   	leave
+  803f1e:	c3                   	ret
+
+00803f1f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803f1f:	55                   	push   %ebp
+  803f20:	89 e5                	mov    %esp,%ebp
+  803f22:	57                   	push   %edi
+  803f23:	56                   	push   %esi
+  803f24:	53                   	push   %ebx
+  803f25:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803f28:	68 82 3e 80 00       	push   $0x803e82
+  803f2d:	e8 10 06 00 00       	call   804542 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803f32:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f37:	cd 30                	int    $0x30
+  803f39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803f3c:	83 c4 10             	add    $0x10,%esp
+  803f3f:	85 c0                	test   %eax,%eax
+  803f41:	78 4b                	js     803f8e <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803f43:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f4d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803f50:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803f54:	0f 85 16 01 00 00    	jne    804070 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f5a:	e8 6e cd ff ff       	call   800ccd <sys_getenvid>
+  803f5f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f64:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f66:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f6c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f72:	77 32                	ja     803fa6 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f74:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803f79:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f7b:	c1 ea 10             	shr    $0x10,%edx
+  803f7e:	74 26                	je     803fa6 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f80:	c1 e2 10             	shl    $0x10,%edx
+  803f83:	89 d1                	mov    %edx,%ecx
+  803f85:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f8a:	29 ca                	sub    %ecx,%edx
+  803f8c:	eb 1e                	jmp    803fac <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803f8e:	83 ec 08             	sub    $0x8,%esp
+  803f91:	89 c7                	mov    %eax,%edi
+  803f93:	50                   	push   %eax
+  803f94:	68 85 4f 80 00       	push   $0x804f85
+  803f99:	e8 65 c3 ff ff       	call   800303 <cprintf>
+		return eid;
+  803f9e:	83 c4 10             	add    $0x10,%esp
+  803fa1:	e9 6c 01 00 00       	jmp    804112 <fork+0x1f3>
+		return pthread_main_tls;
+  803fa6:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803fac:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803faf:	c1 e0 04             	shl    $0x4,%eax
+  803fb2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fb7:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803fb9:	e8 10 fb ff ff       	call   803ace <pthread_fork_child>
+		return eid;
+  803fbe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fc1:	e9 4c 01 00 00       	jmp    804112 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803fc6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803fcc:	89 da                	mov    %ebx,%edx
+  803fce:	89 f8                	mov    %edi,%eax
+  803fd0:	e8 af fd ff ff       	call   803d84 <duppage>
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	79 28                	jns    804001 <fork+0xe2>
+  803fd9:	89 c7                	mov    %eax,%edi
+  803fdb:	e9 32 01 00 00       	jmp    804112 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fe0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803fe6:	83 f9 05             	cmp    $0x5,%ecx
+  803fe9:	75 58                	jne    804043 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803feb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ff0:	89 da                	mov    %ebx,%edx
+  803ff2:	89 f8                	mov    %edi,%eax
+  803ff4:	e8 8b fd ff ff       	call   803d84 <duppage>
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	0f 88 0f 01 00 00    	js     804110 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804001:	83 c3 01             	add    $0x1,%ebx
+  804004:	39 de                	cmp    %ebx,%esi
+  804006:	74 54                	je     80405c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804008:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80400f:	f6 c1 05             	test   $0x5,%cl
+  804012:	74 ed                	je     804001 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804014:	f6 c5 04             	test   $0x4,%ch
+  804017:	75 ad                	jne    803fc6 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804019:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80401f:	74 bf                	je     803fe0 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804021:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804027:	74 d8                	je     804001 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804029:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80402f:	89 da                	mov    %ebx,%edx
+  804031:	89 f8                	mov    %edi,%eax
+  804033:	e8 cd fc ff ff       	call   803d05 <duppage_cow>
+  804038:	85 c0                	test   %eax,%eax
+  80403a:	79 c5                	jns    804001 <fork+0xe2>
+  80403c:	89 c7                	mov    %eax,%edi
+  80403e:	e9 cf 00 00 00       	jmp    804112 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804043:	68 d0 4e 80 00       	push   $0x804ed0
+  804048:	68 dd 4c 80 00       	push   $0x804cdd
+  80404d:	68 c6 00 00 00       	push   $0xc6
+  804052:	68 7a 4f 80 00       	push   $0x804f7a
+  804057:	e8 cc c1 ff ff       	call   800228 <_panic>
+  80405c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80405f:	83 c1 01             	add    $0x1,%ecx
+  804062:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804068:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80406e:	74 18                	je     804088 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804070:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804077:	a8 07                	test   $0x7,%al
+  804079:	74 e4                	je     80405f <fork+0x140>
+  80407b:	89 cb                	mov    %ecx,%ebx
+  80407d:	c1 e3 0a             	shl    $0xa,%ebx
+  804080:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804083:	e9 7c ff ff ff       	jmp    804004 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804088:	83 ec 04             	sub    $0x4,%esp
+  80408b:	6a 07                	push   $0x7
+  80408d:	68 00 f0 bf ee       	push   $0xeebff000
+  804092:	ff 75 e4             	push   -0x1c(%ebp)
+  804095:	e8 8b cc ff ff       	call   800d25 <sys_page_alloc>
+  80409a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80409c:	83 c4 10             	add    $0x10,%esp
+  80409f:	85 c0                	test   %eax,%eax
+  8040a1:	78 34                	js     8040d7 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8040a3:	83 ec 08             	sub    $0x8,%esp
+  8040a6:	68 80 45 80 00       	push   $0x804580
+  8040ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8040ae:	e8 ef cd ff ff       	call   800ea2 <sys_env_set_pgfault_upcall>
+  8040b3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040b5:	83 c4 10             	add    $0x10,%esp
+  8040b8:	85 c0                	test   %eax,%eax
+  8040ba:	78 2e                	js     8040ea <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8040bc:	83 ec 08             	sub    $0x8,%esp
+  8040bf:	6a 02                	push   $0x2
+  8040c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8040c4:	e8 41 cd ff ff       	call   800e0a <sys_env_set_status>
+  8040c9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040cb:	83 c4 10             	add    $0x10,%esp
+  8040ce:	85 c0                	test   %eax,%eax
+  8040d0:	78 2b                	js     8040fd <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8040d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8040d5:	eb 3b                	jmp    804112 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8040d7:	83 ec 08             	sub    $0x8,%esp
+  8040da:	50                   	push   %eax
+  8040db:	68 f8 4e 80 00       	push   $0x804ef8
+  8040e0:	e8 1e c2 ff ff       	call   800303 <cprintf>
+		return r;
+  8040e5:	83 c4 10             	add    $0x10,%esp
+  8040e8:	eb 28                	jmp    804112 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8040ea:	83 ec 08             	sub    $0x8,%esp
+  8040ed:	50                   	push   %eax
+  8040ee:	68 20 4f 80 00       	push   $0x804f20
+  8040f3:	e8 0b c2 ff ff       	call   800303 <cprintf>
+		return r;
+  8040f8:	83 c4 10             	add    $0x10,%esp
+  8040fb:	eb 15                	jmp    804112 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8040fd:	83 ec 08             	sub    $0x8,%esp
+  804100:	50                   	push   %eax
+  804101:	68 95 4f 80 00       	push   $0x804f95
+  804106:	e8 f8 c1 ff ff       	call   800303 <cprintf>
+		return r;
+  80410b:	83 c4 10             	add    $0x10,%esp
+  80410e:	eb 02                	jmp    804112 <fork+0x1f3>
+  804110:	89 c7                	mov    %eax,%edi
+}
+  804112:	89 f8                	mov    %edi,%eax
+  804114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804117:	5b                   	pop    %ebx
+  804118:	5e                   	pop    %esi
+  804119:	5f                   	pop    %edi
+  80411a:	5d                   	pop    %ebp
+  80411b:	c3                   	ret
+
+0080411c <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80411c:	55                   	push   %ebp
+  80411d:	89 e5                	mov    %esp,%ebp
+  80411f:	57                   	push   %edi
+  804120:	56                   	push   %esi
+  804121:	53                   	push   %ebx
+  804122:	83 ec 2c             	sub    $0x2c,%esp
+  804125:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804127:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80412d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804132:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804138:	77 0a                	ja     804144 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80413a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80413f:	29 c3                	sub    %eax,%ebx
+  804141:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804144:	83 ec 0c             	sub    $0xc,%esp
+  804147:	68 82 3e 80 00       	push   $0x803e82
+  80414c:	e8 f1 03 00 00       	call   804542 <set_pgfault_handler>
+  804151:	b8 07 00 00 00       	mov    $0x7,%eax
+  804156:	cd 30                	int    $0x30
+  804158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80415b:	83 c4 10             	add    $0x10,%esp
+  80415e:	85 c0                	test   %eax,%eax
+  804160:	78 30                	js     804192 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804162:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804166:	74 42                	je     8041aa <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804168:	c1 e3 10             	shl    $0x10,%ebx
+  80416b:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804170:	29 d8                	sub    %ebx,%eax
+  804172:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804175:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80417a:	29 d8                	sub    %ebx,%eax
+  80417c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80417f:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804184:	ba 00 00 00 00       	mov    $0x0,%edx
+  804189:	89 f7                	mov    %esi,%edi
+  80418b:	89 d6                	mov    %edx,%esi
+  80418d:	e9 2c 01 00 00       	jmp    8042be <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804192:	83 ec 08             	sub    $0x8,%esp
+  804195:	89 c7                	mov    %eax,%edi
+  804197:	50                   	push   %eax
+  804198:	68 85 4f 80 00       	push   $0x804f85
+  80419d:	e8 61 c1 ff ff       	call   800303 <cprintf>
+		return eid;
+  8041a2:	83 c4 10             	add    $0x10,%esp
+  8041a5:	e9 d5 00 00 00       	jmp    80427f <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8041aa:	e8 1e cb ff ff       	call   800ccd <sys_getenvid>
+  8041af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8041b4:	89 c2                	mov    %eax,%edx
+  8041b6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041b8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8041be:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041c3:	77 18                	ja     8041dd <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041c5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041ca:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8041cc:	c1 e8 10             	shr    $0x10,%eax
+  8041cf:	74 0c                	je     8041dd <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041d1:	c1 e0 10             	shl    $0x10,%eax
+  8041d4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8041d9:	29 c1                	sub    %eax,%ecx
+  8041db:	eb 06                	jmp    8041e3 <sfork+0xc7>
+		return pthread_main_tls;
+  8041dd:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8041e3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8041e6:	c1 e0 04             	shl    $0x4,%eax
+  8041e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041ee:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8041f0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041f3:	e9 87 00 00 00       	jmp    80427f <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041f8:	f6 c5 04             	test   $0x4,%ch
+  8041fb:	74 6c                	je     804269 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8041fd:	89 ca                	mov    %ecx,%edx
+  8041ff:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804205:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80420b:	74 7c                	je     804289 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80420d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804213:	89 da                	mov    %ebx,%edx
+  804215:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804218:	e8 67 fb ff ff       	call   803d84 <duppage>
+  80421d:	85 c0                	test   %eax,%eax
+  80421f:	0f 88 4f 01 00 00    	js     804374 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804225:	83 c3 01             	add    $0x1,%ebx
+  804228:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80422b:	74 7a                	je     8042a7 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80422d:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80422f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804236:	f6 c1 01             	test   $0x1,%cl
+  804239:	74 ea                	je     804225 <sfork+0x109>
+  80423b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804241:	74 e2                	je     804225 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804243:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804249:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80424c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804251:	76 a5                	jbe    8041f8 <sfork+0xdc>
+  804253:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804259:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80425c:	39 fa                	cmp    %edi,%edx
+  80425e:	73 9d                	jae    8041fd <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804260:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804263:	39 fa                	cmp    %edi,%edx
+  804265:	72 96                	jb     8041fd <sfork+0xe1>
+  804267:	eb 8f                	jmp    8041f8 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804269:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80426f:	89 da                	mov    %ebx,%edx
+  804271:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804274:	e8 8c fa ff ff       	call   803d05 <duppage_cow>
+  804279:	85 c0                	test   %eax,%eax
+  80427b:	79 a8                	jns    804225 <sfork+0x109>
+  80427d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80427f:	89 f8                	mov    %edi,%eax
+  804281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804284:	5b                   	pop    %ebx
+  804285:	5e                   	pop    %esi
+  804286:	5f                   	pop    %edi
+  804287:	5d                   	pop    %ebp
+  804288:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804289:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80428e:	e8 2e fb ff ff       	call   803dc1 <cow_copy>
+  804293:	85 c0                	test   %eax,%eax
+  804295:	0f 88 d2 00 00 00    	js     80436d <sfork+0x251>
+				pte = uvpt[pn];
+  80429b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8042a2:	e9 66 ff ff ff       	jmp    80420d <sfork+0xf1>
+  8042a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8042aa:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042ad:	83 c6 01             	add    $0x1,%esi
+  8042b0:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8042b6:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8042bc:	74 1b                	je     8042d9 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8042be:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8042c5:	a8 01                	test   $0x1,%al
+  8042c7:	74 e4                	je     8042ad <sfork+0x191>
+  8042c9:	89 f3                	mov    %esi,%ebx
+  8042cb:	c1 e3 0a             	shl    $0xa,%ebx
+  8042ce:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8042d1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8042d4:	e9 4f ff ff ff       	jmp    804228 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8042d9:	83 ec 04             	sub    $0x4,%esp
+  8042dc:	6a 07                	push   $0x7
+  8042de:	68 00 f0 bf ee       	push   $0xeebff000
+  8042e3:	ff 75 e0             	push   -0x20(%ebp)
+  8042e6:	e8 3a ca ff ff       	call   800d25 <sys_page_alloc>
+  8042eb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042ed:	83 c4 10             	add    $0x10,%esp
+  8042f0:	85 c0                	test   %eax,%eax
+  8042f2:	78 37                	js     80432b <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8042f4:	83 ec 08             	sub    $0x8,%esp
+  8042f7:	68 80 45 80 00       	push   $0x804580
+  8042fc:	ff 75 e0             	push   -0x20(%ebp)
+  8042ff:	e8 9e cb ff ff       	call   800ea2 <sys_env_set_pgfault_upcall>
+  804304:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804306:	83 c4 10             	add    $0x10,%esp
+  804309:	85 c0                	test   %eax,%eax
+  80430b:	78 34                	js     804341 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80430d:	83 ec 08             	sub    $0x8,%esp
+  804310:	6a 02                	push   $0x2
+  804312:	ff 75 e0             	push   -0x20(%ebp)
+  804315:	e8 f0 ca ff ff       	call   800e0a <sys_env_set_status>
+  80431a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80431c:	83 c4 10             	add    $0x10,%esp
+  80431f:	85 c0                	test   %eax,%eax
+  804321:	78 34                	js     804357 <sfork+0x23b>
+	return eid;
+  804323:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804326:	e9 54 ff ff ff       	jmp    80427f <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80432b:	83 ec 08             	sub    $0x8,%esp
+  80432e:	50                   	push   %eax
+  80432f:	68 f8 4e 80 00       	push   $0x804ef8
+  804334:	e8 ca bf ff ff       	call   800303 <cprintf>
+		return r;
+  804339:	83 c4 10             	add    $0x10,%esp
+  80433c:	e9 3e ff ff ff       	jmp    80427f <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804341:	83 ec 08             	sub    $0x8,%esp
+  804344:	50                   	push   %eax
+  804345:	68 20 4f 80 00       	push   $0x804f20
+  80434a:	e8 b4 bf ff ff       	call   800303 <cprintf>
+		return r;
+  80434f:	83 c4 10             	add    $0x10,%esp
+  804352:	e9 28 ff ff ff       	jmp    80427f <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804357:	83 ec 08             	sub    $0x8,%esp
+  80435a:	50                   	push   %eax
+  80435b:	68 95 4f 80 00       	push   $0x804f95
+  804360:	e8 9e bf ff ff       	call   800303 <cprintf>
+		return r;
+  804365:	83 c4 10             	add    $0x10,%esp
+  804368:	e9 12 ff ff ff       	jmp    80427f <sfork+0x163>
+  80436d:	89 c7                	mov    %eax,%edi
+  80436f:	e9 0b ff ff ff       	jmp    80427f <sfork+0x163>
+  804374:	89 c7                	mov    %eax,%edi
+  804376:	e9 04 ff ff ff       	jmp    80427f <sfork+0x163>
+
+0080437b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80437b:	55                   	push   %ebp
+  80437c:	89 e5                	mov    %esp,%ebp
+  80437e:	57                   	push   %edi
+  80437f:	56                   	push   %esi
+  804380:	53                   	push   %ebx
+  804381:	83 ec 18             	sub    $0x18,%esp
+  804384:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804387:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80438a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80438d:	85 c0                	test   %eax,%eax
+  80438f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804394:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804397:	50                   	push   %eax
+  804398:	e8 7e cb ff ff       	call   800f1b <sys_ipc_recv>
+	if (r < 0) {
+  80439d:	83 c4 10             	add    $0x10,%esp
+  8043a0:	85 c0                	test   %eax,%eax
+  8043a2:	78 2b                	js     8043cf <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8043a4:	85 ff                	test   %edi,%edi
+  8043a6:	74 55                	je     8043fd <ipc_recv+0x82>
+  8043a8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043aa:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043b0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b5:	77 39                	ja     8043f0 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043bc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043be:	c1 e8 10             	shr    $0x10,%eax
+  8043c1:	74 2d                	je     8043f0 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043c3:	c1 e0 10             	shl    $0x10,%eax
+  8043c6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043cb:	29 c2                	sub    %eax,%edx
+  8043cd:	eb 27                	jmp    8043f6 <ipc_recv+0x7b>
+  8043cf:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8043d1:	83 ec 08             	sub    $0x8,%esp
+  8043d4:	50                   	push   %eax
+  8043d5:	68 b3 4f 80 00       	push   $0x804fb3
+  8043da:	e8 24 bf ff ff       	call   800303 <cprintf>
+		*from_env_store = 0;
+  8043df:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8043e5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8043eb:	83 c4 10             	add    $0x10,%esp
+  8043ee:	eb 77                	jmp    804467 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8043f0:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8043f6:	8b 02                	mov    (%edx),%eax
+  8043f8:	8b 40 78             	mov    0x78(%eax),%eax
+  8043fb:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8043fd:	85 f6                	test   %esi,%esi
+  8043ff:	74 34                	je     804435 <ipc_recv+0xba>
+  804401:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804403:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804409:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80440e:	77 18                	ja     804428 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804410:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804415:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804417:	c1 e8 10             	shr    $0x10,%eax
+  80441a:	74 0c                	je     804428 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80441c:	c1 e0 10             	shl    $0x10,%eax
+  80441f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804424:	29 c2                	sub    %eax,%edx
+  804426:	eb 06                	jmp    80442e <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804428:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80442e:	8b 02                	mov    (%edx),%eax
+  804430:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804433:	89 06                	mov    %eax,(%esi)
+  804435:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804437:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80443d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804442:	77 18                	ja     80445c <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804444:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804449:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80444b:	c1 e8 10             	shr    $0x10,%eax
+  80444e:	74 0c                	je     80445c <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804450:	c1 e0 10             	shl    $0x10,%eax
+  804453:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804458:	29 c2                	sub    %eax,%edx
+  80445a:	eb 06                	jmp    804462 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80445c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804462:	8b 02                	mov    (%edx),%eax
+  804464:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804467:	89 d8                	mov    %ebx,%eax
+  804469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80446c:	5b                   	pop    %ebx
+  80446d:	5e                   	pop    %esi
+  80446e:	5f                   	pop    %edi
+  80446f:	5d                   	pop    %ebp
+  804470:	c3                   	ret
+
+00804471 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804471:	55                   	push   %ebp
+  804472:	89 e5                	mov    %esp,%ebp
+  804474:	57                   	push   %edi
+  804475:	56                   	push   %esi
+  804476:	53                   	push   %ebx
+  804477:	83 ec 0c             	sub    $0xc,%esp
+  80447a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80447d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804480:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804483:	85 db                	test   %ebx,%ebx
+  804485:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80448a:	0f 44 d8             	cmove  %eax,%ebx
+  80448d:	eb 05                	jmp    804494 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80448f:	e8 65 c8 ff ff       	call   800cf9 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804494:	57                   	push   %edi
+  804495:	53                   	push   %ebx
+  804496:	ff 75 0c             	push   0xc(%ebp)
+  804499:	56                   	push   %esi
+  80449a:	e8 4f ca ff ff       	call   800eee <sys_ipc_try_send>
+		if (r == 0) {
+  80449f:	83 c4 10             	add    $0x10,%esp
+  8044a2:	85 c0                	test   %eax,%eax
+  8044a4:	74 19                	je     8044bf <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8044a6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8044a9:	74 e4                	je     80448f <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8044ab:	83 ec 0c             	sub    $0xc,%esp
+  8044ae:	50                   	push   %eax
+  8044af:	57                   	push   %edi
+  8044b0:	53                   	push   %ebx
+  8044b1:	56                   	push   %esi
+  8044b2:	68 cc 4f 80 00       	push   $0x804fcc
+  8044b7:	e8 47 be ff ff       	call   800303 <cprintf>
+			return;
+  8044bc:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8044bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044c2:	5b                   	pop    %ebx
+  8044c3:	5e                   	pop    %esi
+  8044c4:	5f                   	pop    %edi
+  8044c5:	5d                   	pop    %ebp
+  8044c6:	c3                   	ret
+
+008044c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044c7:	55                   	push   %ebp
+  8044c8:	89 e5                	mov    %esp,%ebp
+  8044ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044cd:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8044d2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044d5:	c1 e0 04             	shl    $0x4,%eax
+  8044d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044dd:	8b 40 50             	mov    0x50(%eax),%eax
+  8044e0:	39 c8                	cmp    %ecx,%eax
+  8044e2:	74 12                	je     8044f6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8044e4:	83 c2 01             	add    $0x1,%edx
+  8044e7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8044ed:	75 e3                	jne    8044d2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8044ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f4:	eb 0e                	jmp    804504 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8044f6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044f9:	c1 e0 04             	shl    $0x4,%eax
+  8044fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804501:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804504:	5d                   	pop    %ebp
+  804505:	c3                   	ret
+
+00804506 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804506:	55                   	push   %ebp
+  804507:	89 e5                	mov    %esp,%ebp
+  804509:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80450c:	89 c2                	mov    %eax,%edx
+  80450e:	c1 ea 16             	shr    $0x16,%edx
+  804511:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804518:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80451d:	f6 c1 01             	test   $0x1,%cl
+  804520:	74 1c                	je     80453e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804522:	c1 e8 0c             	shr    $0xc,%eax
+  804525:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80452c:	a8 01                	test   $0x1,%al
+  80452e:	74 0e                	je     80453e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804530:	c1 e8 0c             	shr    $0xc,%eax
+  804533:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80453a:	ef 
+  80453b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80453e:	89 d0                	mov    %edx,%eax
+  804540:	5d                   	pop    %ebp
+  804541:	c3                   	ret
+
+00804542 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804542:	55                   	push   %ebp
+  804543:	89 e5                	mov    %esp,%ebp
+  804545:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804548:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80454f:	74 0a                	je     80455b <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804551:	8b 45 08             	mov    0x8(%ebp),%eax
+  804554:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804559:	c9                   	leave
+  80455a:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80455b:	83 ec 04             	sub    $0x4,%esp
+  80455e:	6a 07                	push   $0x7
+  804560:	68 00 f0 bf ee       	push   $0xeebff000
+  804565:	6a 00                	push   $0x0
+  804567:	e8 b9 c7 ff ff       	call   800d25 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80456c:	83 c4 08             	add    $0x8,%esp
+  80456f:	68 80 45 80 00       	push   $0x804580
+  804574:	6a 00                	push   $0x0
+  804576:	e8 27 c9 ff ff       	call   800ea2 <sys_env_set_pgfault_upcall>
+  80457b:	83 c4 10             	add    $0x10,%esp
+  80457e:	eb d1                	jmp    804551 <set_pgfault_handler+0xf>
+
+00804580 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804580:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804581:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804586:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804588:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80458b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80458f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804593:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804596:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80459a:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80459c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80459f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8045a0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8045a3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8045a4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8045a5:	c3                   	ret
+
+008045a6 <udm>:
+  8045a6:	57                   	push   %edi
+  8045a7:	56                   	push   %esi
+  8045a8:	53                   	push   %ebx
+  8045a9:	83 ec 20             	sub    $0x20,%esp
+  8045ac:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8045b4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8045b8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8045bc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8045c0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8045c4:	89 d1                	mov    %edx,%ecx
+  8045c6:	09 c1                	or     %eax,%ecx
+  8045c8:	0f 84 91 00 00 00    	je     80465f <udm+0xb9>
+  8045ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045d8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8045dd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045e4:	00 
+  8045e5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045ec:	00 
+  8045ed:	eb 08                	jmp    8045f7 <udm+0x51>
+  8045ef:	83 e9 01             	sub    $0x1,%ecx
+  8045f2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8045f5:	74 7c                	je     804673 <udm+0xcd>
+  8045f7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8045fb:	01 c0                	add    %eax,%eax
+  8045fd:	89 c6                	mov    %eax,%esi
+  8045ff:	89 d7                	mov    %edx,%edi
+  804601:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804605:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804609:	0f ad d0             	shrd   %cl,%edx,%eax
+  80460c:	d3 ea                	shr    %cl,%edx
+  80460e:	f6 c1 20             	test   $0x20,%cl
+  804611:	74 04                	je     804617 <udm+0x71>
+  804613:	89 d0                	mov    %edx,%eax
+  804615:	31 d2                	xor    %edx,%edx
+  804617:	83 e0 01             	and    $0x1,%eax
+  80461a:	89 04 24             	mov    %eax,(%esp)
+  80461d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804624:	00 
+  804625:	8b 04 24             	mov    (%esp),%eax
+  804628:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80462c:	09 f0                	or     %esi,%eax
+  80462e:	09 fa                	or     %edi,%edx
+  804630:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804634:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804638:	39 f0                	cmp    %esi,%eax
+  80463a:	89 d3                	mov    %edx,%ebx
+  80463c:	19 fb                	sbb    %edi,%ebx
+  80463e:	72 af                	jb     8045ef <udm+0x49>
+  804640:	29 f0                	sub    %esi,%eax
+  804642:	19 fa                	sbb    %edi,%edx
+  804644:	89 cf                	mov    %ecx,%edi
+  804646:	c1 ef 05             	shr    $0x5,%edi
+  804649:	83 e7 01             	and    $0x1,%edi
+  80464c:	89 fe                	mov    %edi,%esi
+  80464e:	83 f6 01             	xor    $0x1,%esi
+  804651:	d3 e6                	shl    %cl,%esi
+  804653:	d3 e7                	shl    %cl,%edi
+  804655:	09 74 24 18          	or     %esi,0x18(%esp)
+  804659:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80465d:	eb 90                	jmp    8045ef <udm+0x49>
+  80465f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804663:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804667:	89 f0                	mov    %esi,%eax
+  804669:	89 fa                	mov    %edi,%edx
+  80466b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80466f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804673:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804677:	89 01                	mov    %eax,(%ecx)
+  804679:	89 51 04             	mov    %edx,0x4(%ecx)
+  80467c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804680:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804684:	83 c4 20             	add    $0x20,%esp
+  804687:	5b                   	pop    %ebx
+  804688:	5e                   	pop    %esi
+  804689:	5f                   	pop    %edi
+  80468a:	c3                   	ret
+
+0080468b <__udivdi3>:
+  80468b:	83 ec 18             	sub    $0x18,%esp
+  80468e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804692:	50                   	push   %eax
+  804693:	ff 74 24 2c          	push   0x2c(%esp)
+  804697:	ff 74 24 2c          	push   0x2c(%esp)
+  80469b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80469f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046a3:	e8 fe fe ff ff       	call   8045a6 <udm>
+  8046a8:	83 c4 24             	add    $0x24,%esp
+  8046ab:	c3                   	ret
+
+008046ac <__umoddi3>:
+  8046ac:	83 ec 18             	sub    $0x18,%esp
+  8046af:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046b3:	50                   	push   %eax
+  8046b4:	ff 74 24 2c          	push   0x2c(%esp)
+  8046b8:	ff 74 24 2c          	push   0x2c(%esp)
+  8046bc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046c0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046c4:	e8 dd fe ff ff       	call   8045a6 <udm>
+  8046c9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046cd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046d1:	83 c4 24             	add    $0x24,%esp
+  8046d4:	c3                   	ret
+
+008046d5 <__divdi3>:
+  8046d5:	56                   	push   %esi
+  8046d6:	53                   	push   %ebx
+  8046d7:	83 ec 14             	sub    $0x14,%esp
+  8046da:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8046de:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8046e2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8046e6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8046ea:	85 d2                	test   %edx,%edx
+  8046ec:	78 18                	js     804706 <__divdi3+0x31>
+  8046ee:	85 db                	test   %ebx,%ebx
+  8046f0:	78 3e                	js     804730 <__divdi3+0x5b>
+  8046f2:	83 ec 04             	sub    $0x4,%esp
+  8046f5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046f9:	56                   	push   %esi
+  8046fa:	53                   	push   %ebx
+  8046fb:	51                   	push   %ecx
+  8046fc:	e8 a5 fe ff ff       	call   8045a6 <udm>
+  804701:	83 c4 10             	add    $0x10,%esp
+  804704:	eb 24                	jmp    80472a <__divdi3+0x55>
+  804706:	f7 d8                	neg    %eax
+  804708:	83 d2 00             	adc    $0x0,%edx
+  80470b:	f7 da                	neg    %edx
+  80470d:	85 db                	test   %ebx,%ebx
+  80470f:	78 3a                	js     80474b <__divdi3+0x76>
+  804711:	83 ec 04             	sub    $0x4,%esp
+  804714:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804718:	56                   	push   %esi
+  804719:	53                   	push   %ebx
+  80471a:	51                   	push   %ecx
+  80471b:	e8 86 fe ff ff       	call   8045a6 <udm>
+  804720:	83 c4 10             	add    $0x10,%esp
+  804723:	f7 d8                	neg    %eax
+  804725:	83 d2 00             	adc    $0x0,%edx
+  804728:	f7 da                	neg    %edx
+  80472a:	83 c4 14             	add    $0x14,%esp
+  80472d:	5b                   	pop    %ebx
+  80472e:	5e                   	pop    %esi
+  80472f:	c3                   	ret
+  804730:	83 ec 04             	sub    $0x4,%esp
+  804733:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804737:	56                   	push   %esi
+  804738:	f7 d9                	neg    %ecx
+  80473a:	83 d3 00             	adc    $0x0,%ebx
+  80473d:	f7 db                	neg    %ebx
+  80473f:	53                   	push   %ebx
+  804740:	51                   	push   %ecx
+  804741:	e8 60 fe ff ff       	call   8045a6 <udm>
+  804746:	83 c4 10             	add    $0x10,%esp
+  804749:	eb d8                	jmp    804723 <__divdi3+0x4e>
+  80474b:	83 ec 04             	sub    $0x4,%esp
+  80474e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804752:	56                   	push   %esi
+  804753:	f7 d9                	neg    %ecx
+  804755:	83 d3 00             	adc    $0x0,%ebx
+  804758:	f7 db                	neg    %ebx
+  80475a:	53                   	push   %ebx
+  80475b:	51                   	push   %ecx
+  80475c:	e8 45 fe ff ff       	call   8045a6 <udm>
+  804761:	83 c4 10             	add    $0x10,%esp
+  804764:	eb c4                	jmp    80472a <__divdi3+0x55>
+
+00804766 <__moddi3>:
+  804766:	55                   	push   %ebp
+  804767:	57                   	push   %edi
+  804768:	56                   	push   %esi
+  804769:	53                   	push   %ebx
+  80476a:	83 ec 24             	sub    $0x24,%esp
+  80476d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804771:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804775:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804779:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80477d:	85 d2                	test   %edx,%edx
+  80477f:	78 3b                	js     8047bc <__moddi3+0x56>
+  804781:	83 ec 04             	sub    $0x4,%esp
+  804784:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804788:	56                   	push   %esi
+  804789:	89 ce                	mov    %ecx,%esi
+  80478b:	f7 de                	neg    %esi
+  80478d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804791:	89 de                	mov    %ebx,%esi
+  804793:	83 d6 00             	adc    $0x0,%esi
+  804796:	f7 de                	neg    %esi
+  804798:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80479c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047a0:	0f 48 f1             	cmovs  %ecx,%esi
+  8047a3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8047a8:	53                   	push   %ebx
+  8047a9:	56                   	push   %esi
+  8047aa:	e8 f7 fd ff ff       	call   8045a6 <udm>
+  8047af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047b7:	83 c4 10             	add    $0x10,%esp
+  8047ba:	eb 47                	jmp    804803 <__moddi3+0x9d>
+  8047bc:	f7 d8                	neg    %eax
+  8047be:	83 d2 00             	adc    $0x0,%edx
+  8047c1:	f7 da                	neg    %edx
+  8047c3:	83 ec 04             	sub    $0x4,%esp
+  8047c6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047ca:	56                   	push   %esi
+  8047cb:	89 cf                	mov    %ecx,%edi
+  8047cd:	f7 df                	neg    %edi
+  8047cf:	89 de                	mov    %ebx,%esi
+  8047d1:	83 d6 00             	adc    $0x0,%esi
+  8047d4:	f7 de                	neg    %esi
+  8047d6:	0f 49 cf             	cmovns %edi,%ecx
+  8047d9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8047dd:	0f 49 de             	cmovns %esi,%ebx
+  8047e0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8047e4:	ff 74 24 0c          	push   0xc(%esp)
+  8047e8:	ff 74 24 0c          	push   0xc(%esp)
+  8047ec:	e8 b5 fd ff ff       	call   8045a6 <udm>
+  8047f1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047f5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047f9:	f7 d8                	neg    %eax
+  8047fb:	83 d2 00             	adc    $0x0,%edx
+  8047fe:	f7 da                	neg    %edx
+  804800:	83 c4 10             	add    $0x10,%esp
+  804803:	83 c4 24             	add    $0x24,%esp
+  804806:	5b                   	pop    %ebx
+  804807:	5e                   	pop    %esi
+  804808:	5f                   	pop    %edi
+  804809:	5d                   	pop    %ebp
+  80480a:	c3                   	ret
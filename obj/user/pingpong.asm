@@ -0,0 +1,9753 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 95 12 00 00       	call   8012d6 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 da 16 00 00       	call   801732 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 60 0b 00 00       	call   800bc2 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 76 47 80 00       	push   $0x804776
+  80006a:	e8 89 01 00 00       	call   8001f8 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 a1 17 00 00       	call   801828 <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 24 0b 00 00       	call   800bc2 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 60 47 80 00       	push   $0x804760
+  8000a8:	e8 4b 01 00 00       	call   8001f8 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 6d 17 00 00       	call   801828 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	83 ec 1c             	sub    $0x1c,%esp
+  8000c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000cf:	e8 ee 0a 00 00       	call   800bc2 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000d4:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000d7:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e2:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000e4:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000e6:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000ec:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000f1:	77 16                	ja     800109 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000f3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000f8:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000fa:	c1 e8 10             	shr    $0x10,%eax
+  8000fd:	74 0a                	je     800109 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000ff:	c1 e0 10             	shl    $0x10,%eax
+  800102:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800107:	29 c2                	sub    %eax,%edx
+  800109:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80010c:	c1 e0 04             	shl    $0x4,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800116:	85 db                	test   %ebx,%ebx
+  800118:	7e 07                	jle    800121 <libmain+0x61>
+		binaryname = argv[0];
+  80011a:	8b 06                	mov    (%esi),%eax
+  80011c:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800121:	83 ec 08             	sub    $0x8,%esp
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	e8 08 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80012b:	e8 0b 00 00 00       	call   80013b <exit>
+}
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800136:	5b                   	pop    %ebx
+  800137:	5e                   	pop    %esi
+  800138:	5f                   	pop    %edi
+  800139:	5d                   	pop    %ebp
+  80013a:	c3                   	ret
+
+0080013b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013b:	55                   	push   %ebp
+  80013c:	89 e5                	mov    %esp,%ebp
+  80013e:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800141:	6a 00                	push   $0x0
+  800143:	e8 d0 28 00 00       	call   802a18 <fflush>
+	pthread_kill_others();
+  800148:	e8 3b 3f 00 00       	call   804088 <pthread_kill_others>
+	close_all();
+  80014d:	e8 69 19 00 00       	call   801abb <close_all>
+	sys_env_destroy(0);
+  800152:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800159:	e8 19 0a 00 00       	call   800b77 <sys_env_destroy>
+}
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	c9                   	leave
+  800162:	c3                   	ret
+
+00800163 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	53                   	push   %ebx
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80016d:	8b 13                	mov    (%ebx),%edx
+  80016f:	8d 42 01             	lea    0x1(%edx),%eax
+  800172:	89 03                	mov    %eax,(%ebx)
+  800174:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800177:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800180:	74 09                	je     80018b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800182:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800186:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018b:	83 ec 08             	sub    $0x8,%esp
+  80018e:	68 ff 00 00 00       	push   $0xff
+  800193:	8d 43 08             	lea    0x8(%ebx),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 84 09 00 00       	call   800b20 <sys_cputs>
+		b->idx = 0;
+  80019c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	eb db                	jmp    800182 <putch+0x1f>
+
+008001a7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b7:	00 00 00 
+	b.cnt = 0;
+  8001ba:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c4:	ff 75 0c             	push   0xc(%ebp)
+  8001c7:	ff 75 08             	push   0x8(%ebp)
+  8001ca:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	68 63 01 80 00       	push   $0x800163
+  8001d6:	e8 14 01 00 00       	call   8002ef <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001db:	83 c4 08             	add    $0x8,%esp
+  8001de:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ea:	50                   	push   %eax
+  8001eb:	e8 30 09 00 00       	call   800b20 <sys_cputs>
+
+	return b.cnt;
+}
+  8001f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f6:	c9                   	leave
+  8001f7:	c3                   	ret
+
+008001f8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001fe:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800201:	50                   	push   %eax
+  800202:	ff 75 08             	push   0x8(%ebp)
+  800205:	e8 9d ff ff ff       	call   8001a7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+0080020c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020c:	55                   	push   %ebp
+  80020d:	89 e5                	mov    %esp,%ebp
+  80020f:	57                   	push   %edi
+  800210:	56                   	push   %esi
+  800211:	53                   	push   %ebx
+  800212:	83 ec 1c             	sub    $0x1c,%esp
+  800215:	89 c7                	mov    %eax,%edi
+  800217:	89 d6                	mov    %edx,%esi
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021f:	89 d1                	mov    %edx,%ecx
+  800221:	89 c2                	mov    %eax,%edx
+  800223:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800226:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800229:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800232:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800239:	39 c2                	cmp    %eax,%edx
+  80023b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80023e:	72 3e                	jb     80027e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 18             	push   0x18(%ebp)
+  800246:	83 eb 01             	sub    $0x1,%ebx
+  800249:	53                   	push   %ebx
+  80024a:	50                   	push   %eax
+  80024b:	83 ec 08             	sub    $0x8,%esp
+  80024e:	ff 75 e4             	push   -0x1c(%ebp)
+  800251:	ff 75 e0             	push   -0x20(%ebp)
+  800254:	ff 75 dc             	push   -0x24(%ebp)
+  800257:	ff 75 d8             	push   -0x28(%ebp)
+  80025a:	e8 67 43 00 00       	call   8045c6 <__udivdi3>
+  80025f:	83 c4 18             	add    $0x18,%esp
+  800262:	52                   	push   %edx
+  800263:	50                   	push   %eax
+  800264:	89 f2                	mov    %esi,%edx
+  800266:	89 f8                	mov    %edi,%eax
+  800268:	e8 9f ff ff ff       	call   80020c <printnum>
+  80026d:	83 c4 20             	add    $0x20,%esp
+  800270:	eb 13                	jmp    800285 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	56                   	push   %esi
+  800276:	ff 75 18             	push   0x18(%ebp)
+  800279:	ff d7                	call   *%edi
+  80027b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80027e:	83 eb 01             	sub    $0x1,%ebx
+  800281:	85 db                	test   %ebx,%ebx
+  800283:	7f ed                	jg     800272 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	56                   	push   %esi
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	ff 75 e4             	push   -0x1c(%ebp)
+  80028f:	ff 75 e0             	push   -0x20(%ebp)
+  800292:	ff 75 dc             	push   -0x24(%ebp)
+  800295:	ff 75 d8             	push   -0x28(%ebp)
+  800298:	e8 4a 43 00 00       	call   8045e7 <__umoddi3>
+  80029d:	83 c4 14             	add    $0x14,%esp
+  8002a0:	0f be 80 93 47 80 00 	movsbl 0x804793(%eax),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	ff d7                	call   *%edi
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b0:	5b                   	pop    %ebx
+  8002b1:	5e                   	pop    %esi
+  8002b2:	5f                   	pop    %edi
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002bb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002bf:	8b 10                	mov    (%eax),%edx
+  8002c1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c4:	73 0a                	jae    8002d0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c9:	89 08                	mov    %ecx,(%eax)
+  8002cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ce:	88 02                	mov    %al,(%edx)
+}
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	c3                   	ret
+
+008002d2 <printfmt>:
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002db:	50                   	push   %eax
+  8002dc:	ff 75 10             	push   0x10(%ebp)
+  8002df:	ff 75 0c             	push   0xc(%ebp)
+  8002e2:	ff 75 08             	push   0x8(%ebp)
+  8002e5:	e8 05 00 00 00       	call   8002ef <vprintfmt>
+}
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	c9                   	leave
+  8002ee:	c3                   	ret
+
+008002ef <vprintfmt>:
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	57                   	push   %edi
+  8002f3:	56                   	push   %esi
+  8002f4:	53                   	push   %ebx
+  8002f5:	83 ec 2c             	sub    $0x2c,%esp
+  8002f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800301:	eb 0a                	jmp    80030d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	53                   	push   %ebx
+  800307:	50                   	push   %eax
+  800308:	ff d6                	call   *%esi
+  80030a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80030d:	83 c7 01             	add    $0x1,%edi
+  800310:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800314:	83 f8 25             	cmp    $0x25,%eax
+  800317:	74 0c                	je     800325 <vprintfmt+0x36>
+			if (ch == '\0')
+  800319:	85 c0                	test   %eax,%eax
+  80031b:	75 e6                	jne    800303 <vprintfmt+0x14>
+}
+  80031d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+		padc = ' ';
+  800325:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800329:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800330:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800337:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80033e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800343:	8d 47 01             	lea    0x1(%edi),%eax
+  800346:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800349:	0f b6 17             	movzbl (%edi),%edx
+  80034c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034f:	3c 55                	cmp    $0x55,%al
+  800351:	0f 87 c5 03 00 00    	ja     80071c <vprintfmt+0x42d>
+  800357:	0f b6 c0             	movzbl %al,%eax
+  80035a:	ff 24 85 20 49 80 00 	jmp    *0x804920(,%eax,4)
+  800361:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800367:	eb da                	jmp    800343 <vprintfmt+0x54>
+  800369:	0f be d2             	movsbl %dl,%edx
+  80036c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80036f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800374:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800377:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80037e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800381:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800384:	83 f9 09             	cmp    $0x9,%ecx
+  800387:	77 55                	ja     8003de <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800389:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80038c:	eb e9                	jmp    800377 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80038e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800391:	8b 00                	mov    (%eax),%eax
+  800393:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800396:	8b 45 14             	mov    0x14(%ebp),%eax
+  800399:	8d 40 04             	lea    0x4(%eax),%eax
+  80039c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80039f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003a6:	79 9b                	jns    800343 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ae:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003b5:	eb 8c                	jmp    800343 <vprintfmt+0x54>
+			if (width < 0)
+  8003b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003ba:	85 d2                	test   %edx,%edx
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	0f 49 c2             	cmovns %edx,%eax
+  8003c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ca:	e9 74 ff ff ff       	jmp    800343 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003d9:	e9 65 ff ff ff       	jmp    800343 <vprintfmt+0x54>
+  8003de:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e4:	eb bc                	jmp    8003a2 <vprintfmt+0xb3>
+			lflag++;
+  8003e6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ec:	e9 52 ff ff ff       	jmp    800343 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f4:	8d 78 04             	lea    0x4(%eax),%edi
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+  8003fa:	53                   	push   %ebx
+  8003fb:	ff 30                	push   (%eax)
+  8003fd:	ff d6                	call   *%esi
+			break;
+  8003ff:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800402:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800405:	e9 b1 02 00 00       	jmp    8006bb <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80040a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800410:	8b 10                	mov    (%eax),%edx
+  800412:	89 d0                	mov    %edx,%eax
+  800414:	f7 d8                	neg    %eax
+  800416:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800419:	83 f8 14             	cmp    $0x14,%eax
+  80041c:	7f 23                	jg     800441 <vprintfmt+0x152>
+  80041e:	8b 14 85 80 4a 80 00 	mov    0x804a80(,%eax,4),%edx
+  800425:	85 d2                	test   %edx,%edx
+  800427:	74 18                	je     800441 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800429:	52                   	push   %edx
+  80042a:	68 c3 4c 80 00       	push   $0x804cc3
+  80042f:	53                   	push   %ebx
+  800430:	56                   	push   %esi
+  800431:	e8 9c fe ff ff       	call   8002d2 <printfmt>
+  800436:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800439:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80043c:	e9 7a 02 00 00       	jmp    8006bb <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800441:	50                   	push   %eax
+  800442:	68 ab 47 80 00       	push   $0x8047ab
+  800447:	53                   	push   %ebx
+  800448:	56                   	push   %esi
+  800449:	e8 84 fe ff ff       	call   8002d2 <printfmt>
+  80044e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800451:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800454:	e9 62 02 00 00       	jmp    8006bb <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	83 c0 04             	add    $0x4,%eax
+  80045f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800462:	8b 45 14             	mov    0x14(%ebp),%eax
+  800465:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800467:	85 c9                	test   %ecx,%ecx
+  800469:	b8 a4 47 80 00       	mov    $0x8047a4,%eax
+  80046e:	0f 45 c1             	cmovne %ecx,%eax
+  800471:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800474:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800478:	7e 06                	jle    800480 <vprintfmt+0x191>
+  80047a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80047e:	75 0b                	jne    80048b <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800480:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800483:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800486:	89 75 08             	mov    %esi,0x8(%ebp)
+  800489:	eb 5c                	jmp    8004e7 <vprintfmt+0x1f8>
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	ff 75 d0             	push   -0x30(%ebp)
+  800491:	ff 75 cc             	push   -0x34(%ebp)
+  800494:	e8 20 03 00 00       	call   8007b9 <strnlen>
+  800499:	89 c2                	mov    %eax,%edx
+  80049b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80049e:	29 d0                	sub    %edx,%eax
+  8004a0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ad:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004af:	eb 0e                	jmp    8004bf <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	53                   	push   %ebx
+  8004b5:	57                   	push   %edi
+  8004b6:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b9:	83 ee 01             	sub    $0x1,%esi
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	85 f6                	test   %esi,%esi
+  8004c1:	7f ee                	jg     8004b1 <vprintfmt+0x1c2>
+  8004c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c9:	85 c0                	test   %eax,%eax
+  8004cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d0:	0f 49 d0             	cmovns %eax,%edx
+  8004d3:	29 d0                	sub    %edx,%eax
+  8004d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d8:	eb a6                	jmp    800480 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	52                   	push   %edx
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+  8004e2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004e5:	89 f1                	mov    %esi,%ecx
+  8004e7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ea:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ee:	0f be d0             	movsbl %al,%edx
+  8004f1:	85 d2                	test   %edx,%edx
+  8004f3:	74 28                	je     80051d <vprintfmt+0x22e>
+  8004f5:	85 ff                	test   %edi,%edi
+  8004f7:	78 05                	js     8004fe <vprintfmt+0x20f>
+  8004f9:	83 ef 01             	sub    $0x1,%edi
+  8004fc:	78 30                	js     80052e <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004fe:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800502:	74 d6                	je     8004da <vprintfmt+0x1eb>
+  800504:	0f be c0             	movsbl %al,%eax
+  800507:	83 e8 20             	sub    $0x20,%eax
+  80050a:	83 f8 5e             	cmp    $0x5e,%eax
+  80050d:	76 cb                	jbe    8004da <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	53                   	push   %ebx
+  800513:	6a 3f                	push   $0x3f
+  800515:	ff 55 08             	call   *0x8(%ebp)
+  800518:	83 c4 10             	add    $0x10,%esp
+  80051b:	eb c8                	jmp    8004e5 <vprintfmt+0x1f6>
+  80051d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800520:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800523:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800526:	01 d0                	add    %edx,%eax
+  800528:	29 c8                	sub    %ecx,%eax
+  80052a:	89 c7                	mov    %eax,%edi
+  80052c:	eb 13                	jmp    800541 <vprintfmt+0x252>
+  80052e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800531:	eb ed                	jmp    800520 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800533:	83 ec 08             	sub    $0x8,%esp
+  800536:	53                   	push   %ebx
+  800537:	6a 20                	push   $0x20
+  800539:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80053b:	83 ef 01             	sub    $0x1,%edi
+  80053e:	83 c4 10             	add    $0x10,%esp
+  800541:	85 ff                	test   %edi,%edi
+  800543:	7f ee                	jg     800533 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800545:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800548:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054b:	e9 6b 01 00 00       	jmp    8006bb <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800550:	83 f9 01             	cmp    $0x1,%ecx
+  800553:	7f 1f                	jg     800574 <vprintfmt+0x285>
+	else if (lflag)
+  800555:	85 c9                	test   %ecx,%ecx
+  800557:	74 67                	je     8005c0 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8b 00                	mov    (%eax),%eax
+  80055e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800561:	89 c1                	mov    %eax,%ecx
+  800563:	c1 f9 1f             	sar    $0x1f,%ecx
+  800566:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800569:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056c:	8d 40 04             	lea    0x4(%eax),%eax
+  80056f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800572:	eb 17                	jmp    80058b <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 50 04             	mov    0x4(%eax),%edx
+  80057a:	8b 00                	mov    (%eax),%eax
+  80057c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800582:	8b 45 14             	mov    0x14(%ebp),%eax
+  800585:	8d 40 08             	lea    0x8(%eax),%eax
+  800588:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80058b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80058e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800591:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800596:	85 c9                	test   %ecx,%ecx
+  800598:	0f 89 03 01 00 00    	jns    8006a1 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80059e:	83 ec 08             	sub    $0x8,%esp
+  8005a1:	53                   	push   %ebx
+  8005a2:	6a 2d                	push   $0x2d
+  8005a4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ac:	f7 da                	neg    %edx
+  8005ae:	83 d1 00             	adc    $0x0,%ecx
+  8005b1:	f7 d9                	neg    %ecx
+  8005b3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005bb:	e9 e1 00 00 00       	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 00                	mov    (%eax),%eax
+  8005c5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c8:	89 c1                	mov    %eax,%ecx
+  8005ca:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d9:	eb b0                	jmp    80058b <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8005db:	83 f9 01             	cmp    $0x1,%ecx
+  8005de:	7f 1e                	jg     8005fe <vprintfmt+0x30f>
+	else if (lflag)
+  8005e0:	85 c9                	test   %ecx,%ecx
+  8005e2:	74 32                	je     800616 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 10                	mov    (%eax),%edx
+  8005e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005f9:	e9 a3 00 00 00       	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	8b 48 04             	mov    0x4(%eax),%ecx
+  800606:	8d 40 08             	lea    0x8(%eax),%eax
+  800609:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800611:	e9 8b 00 00 00       	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 10                	mov    (%eax),%edx
+  80061b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800620:	8d 40 04             	lea    0x4(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800626:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80062b:	eb 74                	jmp    8006a1 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80062d:	83 f9 01             	cmp    $0x1,%ecx
+  800630:	7f 1b                	jg     80064d <vprintfmt+0x35e>
+	else if (lflag)
+  800632:	85 c9                	test   %ecx,%ecx
+  800634:	74 2c                	je     800662 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8b 10                	mov    (%eax),%edx
+  80063b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800640:	8d 40 04             	lea    0x4(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800646:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80064b:	eb 54                	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	8b 48 04             	mov    0x4(%eax),%ecx
+  800655:	8d 40 08             	lea    0x8(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800660:	eb 3f                	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 10                	mov    (%eax),%edx
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066c:	8d 40 04             	lea    0x4(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800672:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800677:	eb 28                	jmp    8006a1 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800679:	83 ec 08             	sub    $0x8,%esp
+  80067c:	53                   	push   %ebx
+  80067d:	6a 30                	push   $0x30
+  80067f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800681:	83 c4 08             	add    $0x8,%esp
+  800684:	53                   	push   %ebx
+  800685:	6a 78                	push   $0x78
+  800687:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800689:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068c:	8b 10                	mov    (%eax),%edx
+  80068e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800693:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006a1:	83 ec 0c             	sub    $0xc,%esp
+  8006a4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006a8:	50                   	push   %eax
+  8006a9:	ff 75 e0             	push   -0x20(%ebp)
+  8006ac:	57                   	push   %edi
+  8006ad:	51                   	push   %ecx
+  8006ae:	52                   	push   %edx
+  8006af:	89 da                	mov    %ebx,%edx
+  8006b1:	89 f0                	mov    %esi,%eax
+  8006b3:	e8 54 fb ff ff       	call   80020c <printnum>
+			break;
+  8006b8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006be:	e9 4a fc ff ff       	jmp    80030d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006c3:	83 f9 01             	cmp    $0x1,%ecx
+  8006c6:	7f 1b                	jg     8006e3 <vprintfmt+0x3f4>
+	else if (lflag)
+  8006c8:	85 c9                	test   %ecx,%ecx
+  8006ca:	74 2c                	je     8006f8 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006dc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e1:	eb be                	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 10                	mov    (%eax),%edx
+  8006e8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f6:	eb a9                	jmp    8006a1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 10                	mov    (%eax),%edx
+  8006fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800708:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80070d:	eb 92                	jmp    8006a1 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	6a 25                	push   $0x25
+  800715:	ff d6                	call   *%esi
+			break;
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	eb 9f                	jmp    8006bb <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80071c:	83 ec 08             	sub    $0x8,%esp
+  80071f:	53                   	push   %ebx
+  800720:	6a 25                	push   $0x25
+  800722:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800724:	83 c4 10             	add    $0x10,%esp
+  800727:	89 f8                	mov    %edi,%eax
+  800729:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80072d:	74 05                	je     800734 <vprintfmt+0x445>
+  80072f:	83 e8 01             	sub    $0x1,%eax
+  800732:	eb f5                	jmp    800729 <vprintfmt+0x43a>
+  800734:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800737:	eb 82                	jmp    8006bb <vprintfmt+0x3cc>
+
+00800739 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800739:	55                   	push   %ebp
+  80073a:	89 e5                	mov    %esp,%ebp
+  80073c:	83 ec 18             	sub    $0x18,%esp
+  80073f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800742:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800745:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800748:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80074c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80074f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800756:	85 c0                	test   %eax,%eax
+  800758:	74 26                	je     800780 <vsnprintf+0x47>
+  80075a:	85 d2                	test   %edx,%edx
+  80075c:	7e 22                	jle    800780 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80075e:	ff 75 14             	push   0x14(%ebp)
+  800761:	ff 75 10             	push   0x10(%ebp)
+  800764:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800767:	50                   	push   %eax
+  800768:	68 b5 02 80 00       	push   $0x8002b5
+  80076d:	e8 7d fb ff ff       	call   8002ef <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800772:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800775:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800778:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80077b:	83 c4 10             	add    $0x10,%esp
+}
+  80077e:	c9                   	leave
+  80077f:	c3                   	ret
+		return -E_INVAL;
+  800780:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800785:	eb f7                	jmp    80077e <vsnprintf+0x45>
+
+00800787 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80078d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800790:	50                   	push   %eax
+  800791:	ff 75 10             	push   0x10(%ebp)
+  800794:	ff 75 0c             	push   0xc(%ebp)
+  800797:	ff 75 08             	push   0x8(%ebp)
+  80079a:	e8 9a ff ff ff       	call   800739 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80079f:	c9                   	leave
+  8007a0:	c3                   	ret
+
+008007a1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a1:	55                   	push   %ebp
+  8007a2:	89 e5                	mov    %esp,%ebp
+  8007a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ac:	eb 03                	jmp    8007b1 <strlen+0x10>
+		n++;
+  8007ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007b5:	75 f7                	jne    8007ae <strlen+0xd>
+	return n;
+}
+  8007b7:	5d                   	pop    %ebp
+  8007b8:	c3                   	ret
+
+008007b9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c7:	eb 03                	jmp    8007cc <strnlen+0x13>
+		n++;
+  8007c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007cc:	39 d0                	cmp    %edx,%eax
+  8007ce:	74 08                	je     8007d8 <strnlen+0x1f>
+  8007d0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007d4:	75 f3                	jne    8007c9 <strnlen+0x10>
+  8007d6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007d8:	89 d0                	mov    %edx,%eax
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	53                   	push   %ebx
+  8007e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007eb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ef:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f2:	83 c0 01             	add    $0x1,%eax
+  8007f5:	84 d2                	test   %dl,%dl
+  8007f7:	75 f2                	jne    8007eb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007f9:	89 c8                	mov    %ecx,%eax
+  8007fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007fe:	c9                   	leave
+  8007ff:	c3                   	ret
+
+00800800 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	53                   	push   %ebx
+  800804:	83 ec 10             	sub    $0x10,%esp
+  800807:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80080a:	53                   	push   %ebx
+  80080b:	e8 91 ff ff ff       	call   8007a1 <strlen>
+  800810:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800813:	ff 75 0c             	push   0xc(%ebp)
+  800816:	01 d8                	add    %ebx,%eax
+  800818:	50                   	push   %eax
+  800819:	e8 be ff ff ff       	call   8007dc <strcpy>
+	return dst;
+}
+  80081e:	89 d8                	mov    %ebx,%eax
+  800820:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800823:	c9                   	leave
+  800824:	c3                   	ret
+
+00800825 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	56                   	push   %esi
+  800829:	53                   	push   %ebx
+  80082a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800830:	89 f3                	mov    %esi,%ebx
+  800832:	03 5d 10             	add    0x10(%ebp),%ebx
+  800835:	89 f0                	mov    %esi,%eax
+  800837:	eb 0f                	jmp    800848 <strncpy+0x23>
+		*dst++ = *src;
+  800839:	83 c0 01             	add    $0x1,%eax
+  80083c:	0f b6 0a             	movzbl (%edx),%ecx
+  80083f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800842:	80 f9 01             	cmp    $0x1,%cl
+  800845:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800848:	39 d8                	cmp    %ebx,%eax
+  80084a:	75 ed                	jne    800839 <strncpy+0x14>
+	}
+	return ret;
+}
+  80084c:	89 f0                	mov    %esi,%eax
+  80084e:	5b                   	pop    %ebx
+  80084f:	5e                   	pop    %esi
+  800850:	5d                   	pop    %ebp
+  800851:	c3                   	ret
+
+00800852 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	56                   	push   %esi
+  800856:	53                   	push   %ebx
+  800857:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800860:	89 f0                	mov    %esi,%eax
+  800862:	85 d2                	test   %edx,%edx
+  800864:	74 21                	je     800887 <strlcpy+0x35>
+  800866:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80086a:	89 f2                	mov    %esi,%edx
+  80086c:	eb 09                	jmp    800877 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80086e:	83 c1 01             	add    $0x1,%ecx
+  800871:	83 c2 01             	add    $0x1,%edx
+  800874:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800877:	39 c2                	cmp    %eax,%edx
+  800879:	74 09                	je     800884 <strlcpy+0x32>
+  80087b:	0f b6 19             	movzbl (%ecx),%ebx
+  80087e:	84 db                	test   %bl,%bl
+  800880:	75 ec                	jne    80086e <strlcpy+0x1c>
+  800882:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800884:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800887:	29 f0                	sub    %esi,%eax
+}
+  800889:	5b                   	pop    %ebx
+  80088a:	5e                   	pop    %esi
+  80088b:	5d                   	pop    %ebp
+  80088c:	c3                   	ret
+
+0080088d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80088d:	55                   	push   %ebp
+  80088e:	89 e5                	mov    %esp,%ebp
+  800890:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800893:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800896:	eb 06                	jmp    80089e <strcmp+0x11>
+		p++, q++;
+  800898:	83 c1 01             	add    $0x1,%ecx
+  80089b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80089e:	0f b6 01             	movzbl (%ecx),%eax
+  8008a1:	84 c0                	test   %al,%al
+  8008a3:	74 04                	je     8008a9 <strcmp+0x1c>
+  8008a5:	3a 02                	cmp    (%edx),%al
+  8008a7:	74 ef                	je     800898 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a9:	0f b6 c0             	movzbl %al,%eax
+  8008ac:	0f b6 12             	movzbl (%edx),%edx
+  8008af:	29 d0                	sub    %edx,%eax
+}
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	c3                   	ret
+
+008008b3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	53                   	push   %ebx
+  8008b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c0:	eb 09                	jmp    8008cb <strncmp+0x18>
+		n--, p++, q++;
+  8008c2:	83 ea 01             	sub    $0x1,%edx
+  8008c5:	83 c0 01             	add    $0x1,%eax
+  8008c8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008cb:	85 d2                	test   %edx,%edx
+  8008cd:	74 18                	je     8008e7 <strncmp+0x34>
+  8008cf:	0f b6 18             	movzbl (%eax),%ebx
+  8008d2:	84 db                	test   %bl,%bl
+  8008d4:	74 04                	je     8008da <strncmp+0x27>
+  8008d6:	3a 19                	cmp    (%ecx),%bl
+  8008d8:	74 e8                	je     8008c2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008da:	0f b6 00             	movzbl (%eax),%eax
+  8008dd:	0f b6 11             	movzbl (%ecx),%edx
+  8008e0:	29 d0                	sub    %edx,%eax
+}
+  8008e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e5:	c9                   	leave
+  8008e6:	c3                   	ret
+		return 0;
+  8008e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ec:	eb f4                	jmp    8008e2 <strncmp+0x2f>
+
+008008ee <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008f8:	eb 03                	jmp    8008fd <strchr+0xf>
+  8008fa:	83 c0 01             	add    $0x1,%eax
+  8008fd:	0f b6 10             	movzbl (%eax),%edx
+  800900:	84 d2                	test   %dl,%dl
+  800902:	74 06                	je     80090a <strchr+0x1c>
+		if (*s == c)
+  800904:	38 ca                	cmp    %cl,%dl
+  800906:	75 f2                	jne    8008fa <strchr+0xc>
+  800908:	eb 05                	jmp    80090f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+
+00800911 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	8b 45 08             	mov    0x8(%ebp),%eax
+  800917:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80091e:	38 ca                	cmp    %cl,%dl
+  800920:	74 09                	je     80092b <strfind+0x1a>
+  800922:	84 d2                	test   %dl,%dl
+  800924:	74 05                	je     80092b <strfind+0x1a>
+	for (; *s; s++)
+  800926:	83 c0 01             	add    $0x1,%eax
+  800929:	eb f0                	jmp    80091b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80092b:	5d                   	pop    %ebp
+  80092c:	c3                   	ret
+
+0080092d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	57                   	push   %edi
+  800931:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800934:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800937:	85 c9                	test   %ecx,%ecx
+  800939:	74 20                	je     80095b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80093b:	89 f8                	mov    %edi,%eax
+  80093d:	09 c8                	or     %ecx,%eax
+  80093f:	a8 03                	test   $0x3,%al
+  800941:	75 12                	jne    800955 <memset+0x28>
+		c &= 0xFF;
+  800943:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800947:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80094d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800950:	fc                   	cld
+  800951:	f3 ab                	rep stos %eax,%es:(%edi)
+  800953:	eb 06                	jmp    80095b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800955:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800958:	fc                   	cld
+  800959:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80095b:	89 f8                	mov    %edi,%eax
+  80095d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800960:	c9                   	leave
+  800961:	c3                   	ret
+
+00800962 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	57                   	push   %edi
+  800966:	56                   	push   %esi
+  800967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80096d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800970:	39 c6                	cmp    %eax,%esi
+  800972:	73 32                	jae    8009a6 <memmove+0x44>
+  800974:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800977:	39 d0                	cmp    %edx,%eax
+  800979:	73 2b                	jae    8009a6 <memmove+0x44>
+		s += n;
+		d += n;
+  80097b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80097e:	89 d6                	mov    %edx,%esi
+  800980:	09 fe                	or     %edi,%esi
+  800982:	09 ce                	or     %ecx,%esi
+  800984:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80098a:	75 0e                	jne    80099a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80098c:	83 ef 04             	sub    $0x4,%edi
+  80098f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800992:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800995:	fd                   	std
+  800996:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800998:	eb 09                	jmp    8009a3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80099a:	83 ef 01             	sub    $0x1,%edi
+  80099d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a0:	fd                   	std
+  8009a1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a3:	fc                   	cld
+  8009a4:	eb 1a                	jmp    8009c0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a6:	89 f2                	mov    %esi,%edx
+  8009a8:	09 c2                	or     %eax,%edx
+  8009aa:	09 ca                	or     %ecx,%edx
+  8009ac:	f6 c2 03             	test   $0x3,%dl
+  8009af:	75 0a                	jne    8009bb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009b4:	89 c7                	mov    %eax,%edi
+  8009b6:	fc                   	cld
+  8009b7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b9:	eb 05                	jmp    8009c0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009bb:	89 c7                	mov    %eax,%edi
+  8009bd:	fc                   	cld
+  8009be:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c0:	5e                   	pop    %esi
+  8009c1:	5f                   	pop    %edi
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+
+008009c4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009ca:	ff 75 10             	push   0x10(%ebp)
+  8009cd:	ff 75 0c             	push   0xc(%ebp)
+  8009d0:	ff 75 08             	push   0x8(%ebp)
+  8009d3:	e8 8a ff ff ff       	call   800962 <memmove>
+}
+  8009d8:	c9                   	leave
+  8009d9:	c3                   	ret
+
+008009da <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009da:	55                   	push   %ebp
+  8009db:	89 e5                	mov    %esp,%ebp
+  8009dd:	56                   	push   %esi
+  8009de:	53                   	push   %ebx
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009e5:	89 c6                	mov    %eax,%esi
+  8009e7:	03 75 10             	add    0x10(%ebp),%esi
+  8009ea:	eb 06                	jmp    8009f2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009ec:	83 c0 01             	add    $0x1,%eax
+  8009ef:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f2:	39 f0                	cmp    %esi,%eax
+  8009f4:	74 14                	je     800a0a <memcmp+0x30>
+		if (*s1 != *s2)
+  8009f6:	0f b6 08             	movzbl (%eax),%ecx
+  8009f9:	0f b6 1a             	movzbl (%edx),%ebx
+  8009fc:	38 d9                	cmp    %bl,%cl
+  8009fe:	74 ec                	je     8009ec <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a00:	0f b6 c1             	movzbl %cl,%eax
+  800a03:	0f b6 db             	movzbl %bl,%ebx
+  800a06:	29 d8                	sub    %ebx,%eax
+  800a08:	eb 05                	jmp    800a0f <memcmp+0x35>
+	}
+
+	return 0;
+  800a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a0f:	5b                   	pop    %ebx
+  800a10:	5e                   	pop    %esi
+  800a11:	5d                   	pop    %ebp
+  800a12:	c3                   	ret
+
+00800a13 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a21:	eb 03                	jmp    800a26 <memfind+0x13>
+  800a23:	83 c0 01             	add    $0x1,%eax
+  800a26:	39 d0                	cmp    %edx,%eax
+  800a28:	73 04                	jae    800a2e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a2a:	38 08                	cmp    %cl,(%eax)
+  800a2c:	75 f5                	jne    800a23 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	57                   	push   %edi
+  800a34:	56                   	push   %esi
+  800a35:	53                   	push   %ebx
+  800a36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a3c:	eb 03                	jmp    800a41 <strtol+0x11>
+		s++;
+  800a3e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a41:	0f b6 02             	movzbl (%edx),%eax
+  800a44:	3c 20                	cmp    $0x20,%al
+  800a46:	74 f6                	je     800a3e <strtol+0xe>
+  800a48:	3c 09                	cmp    $0x9,%al
+  800a4a:	74 f2                	je     800a3e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a4c:	3c 2b                	cmp    $0x2b,%al
+  800a4e:	74 2a                	je     800a7a <strtol+0x4a>
+	int neg = 0;
+  800a50:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a55:	3c 2d                	cmp    $0x2d,%al
+  800a57:	74 2b                	je     800a84 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a59:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a5f:	75 0f                	jne    800a70 <strtol+0x40>
+  800a61:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a64:	74 28                	je     800a8e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a66:	85 db                	test   %ebx,%ebx
+  800a68:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a6d:	0f 44 d8             	cmove  %eax,%ebx
+  800a70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a75:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a78:	eb 46                	jmp    800ac0 <strtol+0x90>
+		s++;
+  800a7a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a82:	eb d5                	jmp    800a59 <strtol+0x29>
+		s++, neg = 1;
+  800a84:	83 c2 01             	add    $0x1,%edx
+  800a87:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a8c:	eb cb                	jmp    800a59 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a92:	74 0e                	je     800aa2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a94:	85 db                	test   %ebx,%ebx
+  800a96:	75 d8                	jne    800a70 <strtol+0x40>
+		s++, base = 8;
+  800a98:	83 c2 01             	add    $0x1,%edx
+  800a9b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa0:	eb ce                	jmp    800a70 <strtol+0x40>
+		s += 2, base = 16;
+  800aa2:	83 c2 02             	add    $0x2,%edx
+  800aa5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aaa:	eb c4                	jmp    800a70 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aac:	0f be c0             	movsbl %al,%eax
+  800aaf:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ab5:	7d 3a                	jge    800af1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ab7:	83 c2 01             	add    $0x1,%edx
+  800aba:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800abe:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac0:	0f b6 02             	movzbl (%edx),%eax
+  800ac3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ac6:	89 f3                	mov    %esi,%ebx
+  800ac8:	80 fb 09             	cmp    $0x9,%bl
+  800acb:	76 df                	jbe    800aac <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800acd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad0:	89 f3                	mov    %esi,%ebx
+  800ad2:	80 fb 19             	cmp    $0x19,%bl
+  800ad5:	77 08                	ja     800adf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ad7:	0f be c0             	movsbl %al,%eax
+  800ada:	83 e8 57             	sub    $0x57,%eax
+  800add:	eb d3                	jmp    800ab2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800adf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae2:	89 f3                	mov    %esi,%ebx
+  800ae4:	80 fb 19             	cmp    $0x19,%bl
+  800ae7:	77 08                	ja     800af1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ae9:	0f be c0             	movsbl %al,%eax
+  800aec:	83 e8 37             	sub    $0x37,%eax
+  800aef:	eb c1                	jmp    800ab2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800af5:	74 05                	je     800afc <strtol+0xcc>
+		*endptr = (char *) s;
+  800af7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800afa:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800afc:	89 c8                	mov    %ecx,%eax
+  800afe:	f7 d8                	neg    %eax
+  800b00:	85 ff                	test   %edi,%edi
+  800b02:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b05:	89 c8                	mov    %ecx,%eax
+  800b07:	5b                   	pop    %ebx
+  800b08:	5e                   	pop    %esi
+  800b09:	5f                   	pop    %edi
+  800b0a:	5d                   	pop    %ebp
+  800b0b:	c3                   	ret
+
+00800b0c <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b0c:	55                   	push   %ebp
+  800b0d:	89 e5                	mov    %esp,%ebp
+  800b0f:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b12:	6a 00                	push   $0x0
+  800b14:	6a 00                	push   $0x0
+  800b16:	ff 75 08             	push   0x8(%ebp)
+  800b19:	e8 12 ff ff ff       	call   800a30 <strtol>
+}
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+
+00800b20 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	57                   	push   %edi
+  800b24:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b30:	89 c3                	mov    %eax,%ebx
+  800b32:	89 c7                	mov    %eax,%edi
+  800b34:	6a 00                	push   $0x0
+  800b36:	55                   	push   %ebp
+  800b37:	56                   	push   %esi
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	8d 35 42 0b 80 00    	lea    0x800b42,%esi
+  800b40:	0f 34                	sysenter
+
+00800b42 <after_sysenter_label_47>:
+  800b42:	5e                   	pop    %esi
+  800b43:	5d                   	pop    %ebp
+  800b44:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b47:	5b                   	pop    %ebx
+  800b48:	5f                   	pop    %edi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b55:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5a:	89 d1                	mov    %edx,%ecx
+  800b5c:	89 d3                	mov    %edx,%ebx
+  800b5e:	89 d7                	mov    %edx,%edi
+  800b60:	6a 00                	push   $0x0
+  800b62:	55                   	push   %ebp
+  800b63:	56                   	push   %esi
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8d 35 6e 0b 80 00    	lea    0x800b6e,%esi
+  800b6c:	0f 34                	sysenter
+
+00800b6e <after_sysenter_label_128>:
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5d                   	pop    %ebp
+  800b70:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b73:	5b                   	pop    %ebx
+  800b74:	5f                   	pop    %edi
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b84:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b89:	89 cb                	mov    %ecx,%ebx
+  800b8b:	89 cf                	mov    %ecx,%edi
+  800b8d:	6a 00                	push   $0x0
+  800b8f:	55                   	push   %ebp
+  800b90:	56                   	push   %esi
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	8d 35 9b 0b 80 00    	lea    0x800b9b,%esi
+  800b99:	0f 34                	sysenter
+
+00800b9b <after_sysenter_label_212>:
+  800b9b:	5e                   	pop    %esi
+  800b9c:	5d                   	pop    %ebp
+  800b9d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	7f 07                	jg     800bab <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ba4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ba7:	5b                   	pop    %ebx
+  800ba8:	5f                   	pop    %edi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bab:	83 ec 0c             	sub    $0xc,%esp
+  800bae:	50                   	push   %eax
+  800baf:	6a 03                	push   $0x3
+  800bb1:	68 15 4b 80 00       	push   $0x804b15
+  800bb6:	6a 54                	push   $0x54
+  800bb8:	68 32 4b 80 00       	push   $0x804b32
+  800bbd:	e8 39 38 00 00       	call   8043fb <_panic>
+
+00800bc2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	57                   	push   %edi
+  800bc6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bd1:	89 d1                	mov    %edx,%ecx
+  800bd3:	89 d3                	mov    %edx,%ebx
+  800bd5:	89 d7                	mov    %edx,%edi
+  800bd7:	6a 00                	push   $0x0
+  800bd9:	55                   	push   %ebp
+  800bda:	56                   	push   %esi
+  800bdb:	89 e5                	mov    %esp,%ebp
+  800bdd:	8d 35 e5 0b 80 00    	lea    0x800be5,%esi
+  800be3:	0f 34                	sysenter
+
+00800be5 <after_sysenter_label_309>:
+  800be5:	5e                   	pop    %esi
+  800be6:	5d                   	pop    %ebp
+  800be7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bea:	5b                   	pop    %ebx
+  800beb:	5f                   	pop    %edi
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+
+00800bee <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	57                   	push   %edi
+  800bf2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bfd:	89 d1                	mov    %edx,%ecx
+  800bff:	89 d3                	mov    %edx,%ebx
+  800c01:	89 d7                	mov    %edx,%edi
+  800c03:	6a 00                	push   $0x0
+  800c05:	55                   	push   %ebp
+  800c06:	56                   	push   %esi
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	8d 35 11 0c 80 00    	lea    0x800c11,%esi
+  800c0f:	0f 34                	sysenter
+
+00800c11 <after_sysenter_label_391>:
+  800c11:	5e                   	pop    %esi
+  800c12:	5d                   	pop    %ebp
+  800c13:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c16:	5b                   	pop    %ebx
+  800c17:	5f                   	pop    %edi
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+
+00800c1a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	57                   	push   %edi
+  800c1e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c25:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c32:	6a 00                	push   $0x0
+  800c34:	55                   	push   %ebp
+  800c35:	56                   	push   %esi
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	8d 35 40 0c 80 00    	lea    0x800c40,%esi
+  800c3e:	0f 34                	sysenter
+
+00800c40 <after_sysenter_label_479>:
+  800c40:	5e                   	pop    %esi
+  800c41:	5d                   	pop    %ebp
+  800c42:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c45:	85 c0                	test   %eax,%eax
+  800c47:	7f 07                	jg     800c50 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+  800c53:	50                   	push   %eax
+  800c54:	6a 04                	push   $0x4
+  800c56:	68 15 4b 80 00       	push   $0x804b15
+  800c5b:	6a 54                	push   $0x54
+  800c5d:	68 32 4b 80 00       	push   $0x804b32
+  800c62:	e8 94 37 00 00       	call   8043fb <_panic>
+
+00800c67 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	57                   	push   %edi
+  800c6b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c7d:	ff 75 18             	push   0x18(%ebp)
+  800c80:	55                   	push   %ebp
+  800c81:	56                   	push   %esi
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	8d 35 8c 0c 80 00    	lea    0x800c8c,%esi
+  800c8a:	0f 34                	sysenter
+
+00800c8c <after_sysenter_label_593>:
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c91:	85 c0                	test   %eax,%eax
+  800c93:	7f 07                	jg     800c9c <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c98:	5b                   	pop    %ebx
+  800c99:	5f                   	pop    %edi
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9c:	83 ec 0c             	sub    $0xc,%esp
+  800c9f:	50                   	push   %eax
+  800ca0:	6a 05                	push   $0x5
+  800ca2:	68 15 4b 80 00       	push   $0x804b15
+  800ca7:	6a 54                	push   $0x54
+  800ca9:	68 32 4b 80 00       	push   $0x804b32
+  800cae:	e8 48 37 00 00       	call   8043fb <_panic>
+
+00800cb3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cc8:	89 df                	mov    %ebx,%edi
+  800cca:	6a 00                	push   $0x0
+  800ccc:	55                   	push   %ebp
+  800ccd:	56                   	push   %esi
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	8d 35 d8 0c 80 00    	lea    0x800cd8,%esi
+  800cd6:	0f 34                	sysenter
+
+00800cd8 <after_sysenter_label_704>:
+  800cd8:	5e                   	pop    %esi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cdd:	85 c0                	test   %eax,%eax
+  800cdf:	7f 07                	jg     800ce8 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ce1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce4:	5b                   	pop    %ebx
+  800ce5:	5f                   	pop    %edi
+  800ce6:	5d                   	pop    %ebp
+  800ce7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce8:	83 ec 0c             	sub    $0xc,%esp
+  800ceb:	50                   	push   %eax
+  800cec:	6a 06                	push   $0x6
+  800cee:	68 15 4b 80 00       	push   $0x804b15
+  800cf3:	6a 54                	push   $0x54
+  800cf5:	68 32 4b 80 00       	push   $0x804b32
+  800cfa:	e8 fc 36 00 00       	call   8043fb <_panic>
+
+00800cff <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d14:	89 df                	mov    %ebx,%edi
+  800d16:	6a 00                	push   $0x0
+  800d18:	55                   	push   %ebp
+  800d19:	56                   	push   %esi
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	8d 35 24 0d 80 00    	lea    0x800d24,%esi
+  800d22:	0f 34                	sysenter
+
+00800d24 <after_sysenter_label_808>:
+  800d24:	5e                   	pop    %esi
+  800d25:	5d                   	pop    %ebp
+  800d26:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	7f 07                	jg     800d34 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d30:	5b                   	pop    %ebx
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d34:	83 ec 0c             	sub    $0xc,%esp
+  800d37:	50                   	push   %eax
+  800d38:	6a 08                	push   $0x8
+  800d3a:	68 15 4b 80 00       	push   $0x804b15
+  800d3f:	6a 54                	push   $0x54
+  800d41:	68 32 4b 80 00       	push   $0x804b32
+  800d46:	e8 b0 36 00 00       	call   8043fb <_panic>
+
+00800d4b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	57                   	push   %edi
+  800d4f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d60:	89 df                	mov    %ebx,%edi
+  800d62:	6a 00                	push   $0x0
+  800d64:	55                   	push   %ebp
+  800d65:	56                   	push   %esi
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	8d 35 70 0d 80 00    	lea    0x800d70,%esi
+  800d6e:	0f 34                	sysenter
+
+00800d70 <after_sysenter_label_912>:
+  800d70:	5e                   	pop    %esi
+  800d71:	5d                   	pop    %ebp
+  800d72:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	7f 07                	jg     800d80 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+  800d83:	50                   	push   %eax
+  800d84:	6a 09                	push   $0x9
+  800d86:	68 15 4b 80 00       	push   $0x804b15
+  800d8b:	6a 54                	push   $0x54
+  800d8d:	68 32 4b 80 00       	push   $0x804b32
+  800d92:	e8 64 36 00 00       	call   8043fb <_panic>
+
+00800d97 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dac:	89 df                	mov    %ebx,%edi
+  800dae:	6a 00                	push   $0x0
+  800db0:	55                   	push   %ebp
+  800db1:	56                   	push   %esi
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	8d 35 bc 0d 80 00    	lea    0x800dbc,%esi
+  800dba:	0f 34                	sysenter
+
+00800dbc <after_sysenter_label_1016>:
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc1:	85 c0                	test   %eax,%eax
+  800dc3:	7f 07                	jg     800dcc <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800dc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc8:	5b                   	pop    %ebx
+  800dc9:	5f                   	pop    %edi
+  800dca:	5d                   	pop    %ebp
+  800dcb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+  800dcf:	50                   	push   %eax
+  800dd0:	6a 0a                	push   $0xa
+  800dd2:	68 15 4b 80 00       	push   $0x804b15
+  800dd7:	6a 54                	push   $0x54
+  800dd9:	68 32 4b 80 00       	push   $0x804b32
+  800dde:	e8 18 36 00 00       	call   8043fb <_panic>
+
+00800de3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800df3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df9:	6a 00                	push   $0x0
+  800dfb:	55                   	push   %ebp
+  800dfc:	56                   	push   %esi
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	8d 35 07 0e 80 00    	lea    0x800e07,%esi
+  800e05:	0f 34                	sysenter
+
+00800e07 <after_sysenter_label_1126>:
+  800e07:	5e                   	pop    %esi
+  800e08:	5d                   	pop    %ebp
+  800e09:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+
+00800e10 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e22:	89 cb                	mov    %ecx,%ebx
+  800e24:	89 cf                	mov    %ecx,%edi
+  800e26:	6a 00                	push   $0x0
+  800e28:	55                   	push   %ebp
+  800e29:	56                   	push   %esi
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	8d 35 34 0e 80 00    	lea    0x800e34,%esi
+  800e32:	0f 34                	sysenter
+
+00800e34 <after_sysenter_label_1210>:
+  800e34:	5e                   	pop    %esi
+  800e35:	5d                   	pop    %ebp
+  800e36:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e39:	85 c0                	test   %eax,%eax
+  800e3b:	7f 07                	jg     800e44 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e40:	5b                   	pop    %ebx
+  800e41:	5f                   	pop    %edi
+  800e42:	5d                   	pop    %ebp
+  800e43:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e44:	83 ec 0c             	sub    $0xc,%esp
+  800e47:	50                   	push   %eax
+  800e48:	6a 0d                	push   $0xd
+  800e4a:	68 15 4b 80 00       	push   $0x804b15
+  800e4f:	6a 54                	push   $0x54
+  800e51:	68 32 4b 80 00       	push   $0x804b32
+  800e56:	e8 a0 35 00 00       	call   8043fb <_panic>
+
+00800e5b <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	57                   	push   %edi
+  800e5f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6b:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e70:	89 df                	mov    %ebx,%edi
+  800e72:	6a 00                	push   $0x0
+  800e74:	55                   	push   %ebp
+  800e75:	56                   	push   %esi
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	8d 35 80 0e 80 00    	lea    0x800e80,%esi
+  800e7e:	0f 34                	sysenter
+
+00800e80 <after_sysenter_label_1311>:
+  800e80:	5e                   	pop    %esi
+  800e81:	5d                   	pop    %ebp
+  800e82:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e85:	85 c0                	test   %eax,%eax
+  800e87:	7f 07                	jg     800e90 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e8c:	5b                   	pop    %ebx
+  800e8d:	5f                   	pop    %edi
+  800e8e:	5d                   	pop    %ebp
+  800e8f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e90:	83 ec 0c             	sub    $0xc,%esp
+  800e93:	50                   	push   %eax
+  800e94:	6a 42                	push   $0x42
+  800e96:	68 15 4b 80 00       	push   $0x804b15
+  800e9b:	6a 54                	push   $0x54
+  800e9d:	68 32 4b 80 00       	push   $0x804b32
+  800ea2:	e8 54 35 00 00       	call   8043fb <_panic>
+
+00800ea7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	57                   	push   %edi
+  800eab:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	6a 00                	push   $0x0
+  800ebe:	55                   	push   %ebp
+  800ebf:	56                   	push   %esi
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	8d 35 ca 0e 80 00    	lea    0x800eca,%esi
+  800ec8:	0f 34                	sysenter
+
+00800eca <after_sysenter_label_1411>:
+  800eca:	5e                   	pop    %esi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5f                   	pop    %edi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+
+00800ed3 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	57                   	push   %edi
+  800ed7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	6a 00                	push   $0x0
+  800eec:	55                   	push   %ebp
+  800eed:	56                   	push   %esi
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	8d 35 f8 0e 80 00    	lea    0x800ef8,%esi
+  800ef6:	0f 34                	sysenter
+
+00800ef8 <after_sysenter_label_1497>:
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800efd:	5b                   	pop    %ebx
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f11:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f16:	89 df                	mov    %ebx,%edi
+  800f18:	6a 00                	push   $0x0
+  800f1a:	55                   	push   %ebp
+  800f1b:	56                   	push   %esi
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	8d 35 26 0f 80 00    	lea    0x800f26,%esi
+  800f24:	0f 34                	sysenter
+
+00800f26 <after_sysenter_label_1583>:
+  800f26:	5e                   	pop    %esi
+  800f27:	5d                   	pop    %ebp
+  800f28:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5f                   	pop    %edi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	c3                   	ret
+
+00800f2f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f2f:	55                   	push   %ebp
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	57                   	push   %edi
+  800f33:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f47:	6a 00                	push   $0x0
+  800f49:	55                   	push   %ebp
+  800f4a:	56                   	push   %esi
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	8d 35 55 0f 80 00    	lea    0x800f55,%esi
+  800f53:	0f 34                	sysenter
+
+00800f55 <after_sysenter_label_1672>:
+  800f55:	5e                   	pop    %esi
+  800f56:	5d                   	pop    %ebp
+  800f57:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f73:	89 df                	mov    %ebx,%edi
+  800f75:	6a 00                	push   $0x0
+  800f77:	55                   	push   %ebp
+  800f78:	56                   	push   %esi
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	8d 35 83 0f 80 00    	lea    0x800f83,%esi
+  800f81:	0f 34                	sysenter
+
+00800f83 <after_sysenter_label_1758>:
+  800f83:	5e                   	pop    %esi
+  800f84:	5d                   	pop    %ebp
+  800f85:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f99:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f9e:	89 cb                	mov    %ecx,%ebx
+  800fa0:	89 cf                	mov    %ecx,%edi
+  800fa2:	6a 00                	push   $0x0
+  800fa4:	55                   	push   %ebp
+  800fa5:	56                   	push   %esi
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	8d 35 b0 0f 80 00    	lea    0x800fb0,%esi
+  800fae:	0f 34                	sysenter
+
+00800fb0 <after_sysenter_label_1842>:
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 07                	jg     800fc0 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+  800fc3:	50                   	push   %eax
+  800fc4:	6a 13                	push   $0x13
+  800fc6:	68 15 4b 80 00       	push   $0x804b15
+  800fcb:	6a 54                	push   $0x54
+  800fcd:	68 32 4b 80 00       	push   $0x804b32
+  800fd2:	e8 24 34 00 00       	call   8043fb <_panic>
+
+00800fd7 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	57                   	push   %edi
+  800fdb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fe6:	89 d1                	mov    %edx,%ecx
+  800fe8:	89 d3                	mov    %edx,%ebx
+  800fea:	89 d7                	mov    %edx,%edi
+  800fec:	6a 00                	push   $0x0
+  800fee:	55                   	push   %ebp
+  800fef:	56                   	push   %esi
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	8d 35 fa 0f 80 00    	lea    0x800ffa,%esi
+  800ff8:	0f 34                	sysenter
+
+00800ffa <after_sysenter_label_1939>:
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800fff:	5b                   	pop    %ebx
+  801000:	5f                   	pop    %edi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+
+00801003 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801008:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801013:	bf 00 00 00 00       	mov    $0x0,%edi
+  801018:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101b:	6a 00                	push   $0x0
+  80101d:	55                   	push   %ebp
+  80101e:	56                   	push   %esi
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	8d 35 29 10 80 00    	lea    0x801029,%esi
+  801027:	0f 34                	sysenter
+
+00801029 <after_sysenter_label_2028>:
+  801029:	5e                   	pop    %esi
+  80102a:	5d                   	pop    %ebp
+  80102b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80102e:	5b                   	pop    %ebx
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801042:	b8 16 00 00 00       	mov    $0x16,%eax
+  801047:	89 df                	mov    %ebx,%edi
+  801049:	6a 00                	push   $0x0
+  80104b:	55                   	push   %ebp
+  80104c:	56                   	push   %esi
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+
+00801057 <after_sysenter_label_2114>:
+  801057:	5e                   	pop    %esi
+  801058:	5d                   	pop    %ebp
+  801059:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80105c:	5b                   	pop    %ebx
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 17 00 00 00       	mov    $0x17,%eax
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	6a 00                	push   $0x0
+  801079:	55                   	push   %ebp
+  80107a:	56                   	push   %esi
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+
+00801085 <after_sysenter_label_2200>:
+  801085:	5e                   	pop    %esi
+  801086:	5d                   	pop    %ebp
+  801087:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80108a:	5b                   	pop    %ebx
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109e:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010a3:	89 df                	mov    %ebx,%edi
+  8010a5:	6a 00                	push   $0x0
+  8010a7:	55                   	push   %ebp
+  8010a8:	56                   	push   %esi
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	8d 35 b3 10 80 00    	lea    0x8010b3,%esi
+  8010b1:	0f 34                	sysenter
+
+008010b3 <after_sysenter_label_2286>:
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+
+008010bc <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8010c5:	89 d6                	mov    %edx,%esi
+  8010c7:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8010ca:	89 cf                	mov    %ecx,%edi
+  8010cc:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8010cf:	89 fa                	mov    %edi,%edx
+  8010d1:	80 ce 08             	or     $0x8,%dh
+  8010d4:	f6 c5 08             	test   $0x8,%ch
+  8010d7:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	50                   	push   %eax
+  8010dd:	56                   	push   %esi
+  8010de:	6a 00                	push   $0x0
+  8010e0:	e8 82 fb ff ff       	call   800c67 <sys_page_map>
+	if (r < 0) {
+  8010e5:	83 c4 20             	add    $0x20,%esp
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	78 27                	js     801113 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  8010ef:	57                   	push   %edi
+  8010f0:	56                   	push   %esi
+  8010f1:	6a 00                	push   $0x0
+  8010f3:	56                   	push   %esi
+  8010f4:	6a 00                	push   $0x0
+  8010f6:	e8 6c fb ff ff       	call   800c67 <sys_page_map>
+  8010fb:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8010fd:	83 c4 20             	add    $0x20,%esp
+  801100:	85 c0                	test   %eax,%eax
+  801102:	78 24                	js     801128 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801109:	89 d8                	mov    %ebx,%eax
+  80110b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+  801113:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801115:	83 ec 08             	sub    $0x8,%esp
+  801118:	50                   	push   %eax
+  801119:	68 40 4b 80 00       	push   $0x804b40
+  80111e:	e8 d5 f0 ff ff       	call   8001f8 <cprintf>
+		return r;
+  801123:	83 c4 10             	add    $0x10,%esp
+  801126:	eb e1                	jmp    801109 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801128:	83 ec 08             	sub    $0x8,%esp
+  80112b:	50                   	push   %eax
+  80112c:	68 70 4b 80 00       	push   $0x804b70
+  801131:	e8 c2 f0 ff ff       	call   8001f8 <cprintf>
+		return r;
+  801136:	83 c4 10             	add    $0x10,%esp
+  801139:	eb ce                	jmp    801109 <duppage_cow+0x4d>
+
+0080113b <duppage>:
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801142:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801145:	51                   	push   %ecx
+  801146:	52                   	push   %edx
+  801147:	50                   	push   %eax
+  801148:	52                   	push   %edx
+  801149:	6a 00                	push   $0x0
+  80114b:	e8 17 fb ff ff       	call   800c67 <sys_page_map>
+	if (r < 0) {
+  801150:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801153:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	78 07                	js     801163 <duppage+0x28>
+}
+  80115c:	89 d8                	mov    %ebx,%eax
+  80115e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801161:	c9                   	leave
+  801162:	c3                   	ret
+  801163:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801165:	83 ec 08             	sub    $0x8,%esp
+  801168:	50                   	push   %eax
+  801169:	68 40 4b 80 00       	push   $0x804b40
+  80116e:	e8 85 f0 ff ff       	call   8001f8 <cprintf>
+		return r;
+  801173:	83 c4 10             	add    $0x10,%esp
+  801176:	eb e4                	jmp    80115c <duppage+0x21>
+
+00801178 <cow_copy>:
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+  80117d:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80117f:	83 ec 04             	sub    $0x4,%esp
+  801182:	6a 07                	push   $0x7
+  801184:	68 00 f0 7f 00       	push   $0x7ff000
+  801189:	6a 00                	push   $0x0
+  80118b:	e8 8a fa ff ff       	call   800c1a <sys_page_alloc>
+	if (r < 0) {
+  801190:	83 c4 10             	add    $0x10,%esp
+  801193:	85 c0                	test   %eax,%eax
+  801195:	78 58                	js     8011ef <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801197:	83 ec 04             	sub    $0x4,%esp
+  80119a:	68 00 10 00 00       	push   $0x1000
+  80119f:	56                   	push   %esi
+  8011a0:	68 00 f0 7f 00       	push   $0x7ff000
+  8011a5:	e8 b8 f7 ff ff       	call   800962 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8011aa:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011b1:	56                   	push   %esi
+  8011b2:	6a 00                	push   $0x0
+  8011b4:	68 00 f0 7f 00       	push   $0x7ff000
+  8011b9:	6a 00                	push   $0x0
+  8011bb:	e8 a7 fa ff ff       	call   800c67 <sys_page_map>
+  8011c0:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011c2:	83 c4 20             	add    $0x20,%esp
+  8011c5:	85 c0                	test   %eax,%eax
+  8011c7:	78 3b                	js     801204 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8011c9:	83 ec 08             	sub    $0x8,%esp
+  8011cc:	68 00 f0 7f 00       	push   $0x7ff000
+  8011d1:	6a 00                	push   $0x0
+  8011d3:	e8 db fa ff ff       	call   800cb3 <sys_page_unmap>
+  8011d8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011da:	83 c4 10             	add    $0x10,%esp
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	78 45                	js     801226 <cow_copy+0xae>
+	return 0;
+  8011e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8011e6:	89 d8                	mov    %ebx,%eax
+  8011e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+  8011ef:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8011f1:	83 ec 08             	sub    $0x8,%esp
+  8011f4:	50                   	push   %eax
+  8011f5:	68 60 4c 80 00       	push   $0x804c60
+  8011fa:	e8 f9 ef ff ff       	call   8001f8 <cprintf>
+		return r;
+  8011ff:	83 c4 10             	add    $0x10,%esp
+  801202:	eb e2                	jmp    8011e6 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801204:	83 ec 08             	sub    $0x8,%esp
+  801207:	50                   	push   %eax
+  801208:	68 7c 4c 80 00       	push   $0x804c7c
+  80120d:	e8 e6 ef ff ff       	call   8001f8 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801212:	83 c4 08             	add    $0x8,%esp
+  801215:	68 00 f0 7f 00       	push   $0x7ff000
+  80121a:	6a 00                	push   $0x0
+  80121c:	e8 92 fa ff ff       	call   800cb3 <sys_page_unmap>
+		return r;
+  801221:	83 c4 10             	add    $0x10,%esp
+  801224:	eb c0                	jmp    8011e6 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801226:	83 ec 08             	sub    $0x8,%esp
+  801229:	50                   	push   %eax
+  80122a:	68 98 4b 80 00       	push   $0x804b98
+  80122f:	e8 c4 ef ff ff       	call   8001f8 <cprintf>
+		return r;
+  801234:	83 c4 10             	add    $0x10,%esp
+  801237:	eb ad                	jmp    8011e6 <cow_copy+0x6e>
+
+00801239 <pgfault>:
+{
+  801239:	55                   	push   %ebp
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	56                   	push   %esi
+  80123d:	53                   	push   %ebx
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801241:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801243:	89 d8                	mov    %ebx,%eax
+  801245:	c1 e8 16             	shr    $0x16,%eax
+  801248:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80124f:	89 de                	mov    %ebx,%esi
+  801251:	c1 ee 0c             	shr    $0xc,%esi
+  801254:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80125b:	a8 07                	test   $0x7,%al
+  80125d:	74 3b                	je     80129a <pgfault+0x61>
+  80125f:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801265:	74 33                	je     80129a <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	68 00 f0 bf ee       	push   $0xeebff000
+  80126f:	e8 07 28 00 00       	call   803a7b <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801274:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	f6 c4 08             	test   $0x8,%ah
+  801281:	75 30                	jne    8012b3 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	68 00 f0 bf ee       	push   $0xeebff000
+  80128b:	e8 58 28 00 00       	call   803ae8 <mutex_unlock>
+}
+  801290:	83 c4 10             	add    $0x10,%esp
+  801293:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801296:	5b                   	pop    %ebx
+  801297:	5e                   	pop    %esi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80129a:	83 ec 08             	sub    $0x8,%esp
+  80129d:	ff 72 28             	push   0x28(%edx)
+  8012a0:	51                   	push   %ecx
+  8012a1:	50                   	push   %eax
+  8012a2:	68 bc 4b 80 00       	push   $0x804bbc
+  8012a7:	6a 3f                	push   $0x3f
+  8012a9:	68 96 4c 80 00       	push   $0x804c96
+  8012ae:	e8 48 31 00 00       	call   8043fb <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012b3:	89 d8                	mov    %ebx,%eax
+  8012b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8012ba:	e8 b9 fe ff ff       	call   801178 <cow_copy>
+  8012bf:	eb c2                	jmp    801283 <pgfault+0x4a>
+
+008012c1 <cow_enable>:
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8012c7:	68 39 12 80 00       	push   $0x801239
+  8012cc:	e8 70 31 00 00       	call   804441 <set_pgfault_handler>
+}
+  8012d1:	83 c4 10             	add    $0x10,%esp
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+
+008012d6 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+  8012dc:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8012df:	68 39 12 80 00       	push   $0x801239
+  8012e4:	e8 58 31 00 00       	call   804441 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8012e9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012ee:	cd 30                	int    $0x30
+  8012f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	85 c0                	test   %eax,%eax
+  8012f8:	78 4b                	js     801345 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8012fa:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8012ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801307:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80130b:	0f 85 16 01 00 00    	jne    801427 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801311:	e8 ac f8 ff ff       	call   800bc2 <sys_getenvid>
+  801316:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80131b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80131d:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801323:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801329:	77 32                	ja     80135d <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80132b:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801330:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801332:	c1 ea 10             	shr    $0x10,%edx
+  801335:	74 26                	je     80135d <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801337:	c1 e2 10             	shl    $0x10,%edx
+  80133a:	89 d1                	mov    %edx,%ecx
+  80133c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801341:	29 ca                	sub    %ecx,%edx
+  801343:	eb 1e                	jmp    801363 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801345:	83 ec 08             	sub    $0x8,%esp
+  801348:	89 c7                	mov    %eax,%edi
+  80134a:	50                   	push   %eax
+  80134b:	68 a1 4c 80 00       	push   $0x804ca1
+  801350:	e8 a3 ee ff ff       	call   8001f8 <cprintf>
+		return eid;
+  801355:	83 c4 10             	add    $0x10,%esp
+  801358:	e9 6c 01 00 00       	jmp    8014c9 <fork+0x1f3>
+		return pthread_main_tls;
+  80135d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801363:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801366:	c1 e0 04             	shl    $0x4,%eax
+  801369:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80136e:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801370:	e8 4f 2e 00 00       	call   8041c4 <pthread_fork_child>
+		return eid;
+  801375:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801378:	e9 4c 01 00 00       	jmp    8014c9 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80137d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801383:	89 da                	mov    %ebx,%edx
+  801385:	89 f8                	mov    %edi,%eax
+  801387:	e8 af fd ff ff       	call   80113b <duppage>
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	79 28                	jns    8013b8 <fork+0xe2>
+  801390:	89 c7                	mov    %eax,%edi
+  801392:	e9 32 01 00 00       	jmp    8014c9 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801397:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80139d:	83 f9 05             	cmp    $0x5,%ecx
+  8013a0:	75 58                	jne    8013fa <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8013a2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013a7:	89 da                	mov    %ebx,%edx
+  8013a9:	89 f8                	mov    %edi,%eax
+  8013ab:	e8 8b fd ff ff       	call   80113b <duppage>
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	0f 88 0f 01 00 00    	js     8014c7 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8013b8:	83 c3 01             	add    $0x1,%ebx
+  8013bb:	39 de                	cmp    %ebx,%esi
+  8013bd:	74 54                	je     801413 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8013bf:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8013c6:	f6 c1 05             	test   $0x5,%cl
+  8013c9:	74 ed                	je     8013b8 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8013cb:	f6 c5 04             	test   $0x4,%ch
+  8013ce:	75 ad                	jne    80137d <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8013d0:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8013d6:	74 bf                	je     801397 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8013d8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8013de:	74 d8                	je     8013b8 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8013e0:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8013e6:	89 da                	mov    %ebx,%edx
+  8013e8:	89 f8                	mov    %edi,%eax
+  8013ea:	e8 cd fc ff ff       	call   8010bc <duppage_cow>
+  8013ef:	85 c0                	test   %eax,%eax
+  8013f1:	79 c5                	jns    8013b8 <fork+0xe2>
+  8013f3:	89 c7                	mov    %eax,%edi
+  8013f5:	e9 cf 00 00 00       	jmp    8014c9 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8013fa:	68 ec 4b 80 00       	push   $0x804bec
+  8013ff:	68 b1 4c 80 00       	push   $0x804cb1
+  801404:	68 c6 00 00 00       	push   $0xc6
+  801409:	68 96 4c 80 00       	push   $0x804c96
+  80140e:	e8 e8 2f 00 00       	call   8043fb <_panic>
+  801413:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801416:	83 c1 01             	add    $0x1,%ecx
+  801419:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80141f:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801425:	74 18                	je     80143f <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801427:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80142e:	a8 07                	test   $0x7,%al
+  801430:	74 e4                	je     801416 <fork+0x140>
+  801432:	89 cb                	mov    %ecx,%ebx
+  801434:	c1 e3 0a             	shl    $0xa,%ebx
+  801437:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80143a:	e9 7c ff ff ff       	jmp    8013bb <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80143f:	83 ec 04             	sub    $0x4,%esp
+  801442:	6a 07                	push   $0x7
+  801444:	68 00 f0 bf ee       	push   $0xeebff000
+  801449:	ff 75 e4             	push   -0x1c(%ebp)
+  80144c:	e8 c9 f7 ff ff       	call   800c1a <sys_page_alloc>
+  801451:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 34                	js     80148e <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80145a:	83 ec 08             	sub    $0x8,%esp
+  80145d:	68 7f 44 80 00       	push   $0x80447f
+  801462:	ff 75 e4             	push   -0x1c(%ebp)
+  801465:	e8 2d f9 ff ff       	call   800d97 <sys_env_set_pgfault_upcall>
+  80146a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80146c:	83 c4 10             	add    $0x10,%esp
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	78 2e                	js     8014a1 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801473:	83 ec 08             	sub    $0x8,%esp
+  801476:	6a 02                	push   $0x2
+  801478:	ff 75 e4             	push   -0x1c(%ebp)
+  80147b:	e8 7f f8 ff ff       	call   800cff <sys_env_set_status>
+  801480:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	78 2b                	js     8014b4 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801489:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80148c:	eb 3b                	jmp    8014c9 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80148e:	83 ec 08             	sub    $0x8,%esp
+  801491:	50                   	push   %eax
+  801492:	68 14 4c 80 00       	push   $0x804c14
+  801497:	e8 5c ed ff ff       	call   8001f8 <cprintf>
+		return r;
+  80149c:	83 c4 10             	add    $0x10,%esp
+  80149f:	eb 28                	jmp    8014c9 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8014a1:	83 ec 08             	sub    $0x8,%esp
+  8014a4:	50                   	push   %eax
+  8014a5:	68 3c 4c 80 00       	push   $0x804c3c
+  8014aa:	e8 49 ed ff ff       	call   8001f8 <cprintf>
+		return r;
+  8014af:	83 c4 10             	add    $0x10,%esp
+  8014b2:	eb 15                	jmp    8014c9 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8014b4:	83 ec 08             	sub    $0x8,%esp
+  8014b7:	50                   	push   %eax
+  8014b8:	68 c6 4c 80 00       	push   $0x804cc6
+  8014bd:	e8 36 ed ff ff       	call   8001f8 <cprintf>
+		return r;
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	eb 02                	jmp    8014c9 <fork+0x1f3>
+  8014c7:	89 c7                	mov    %eax,%edi
+}
+  8014c9:	89 f8                	mov    %edi,%eax
+  8014cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ce:	5b                   	pop    %ebx
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+
+008014d3 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	57                   	push   %edi
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+  8014d9:	83 ec 2c             	sub    $0x2c,%esp
+  8014dc:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014de:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8014e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014e9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8014ef:	77 0a                	ja     8014fb <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014f1:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8014f6:	29 c3                	sub    %eax,%ebx
+  8014f8:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8014fb:	83 ec 0c             	sub    $0xc,%esp
+  8014fe:	68 39 12 80 00       	push   $0x801239
+  801503:	e8 39 2f 00 00       	call   804441 <set_pgfault_handler>
+  801508:	b8 07 00 00 00       	mov    $0x7,%eax
+  80150d:	cd 30                	int    $0x30
+  80150f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 30                	js     801549 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801519:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80151d:	74 42                	je     801561 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80151f:	c1 e3 10             	shl    $0x10,%ebx
+  801522:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801527:	29 d8                	sub    %ebx,%eax
+  801529:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80152c:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801531:	29 d8                	sub    %ebx,%eax
+  801533:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801536:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80153b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801540:	89 f7                	mov    %esi,%edi
+  801542:	89 d6                	mov    %edx,%esi
+  801544:	e9 2c 01 00 00       	jmp    801675 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801549:	83 ec 08             	sub    $0x8,%esp
+  80154c:	89 c7                	mov    %eax,%edi
+  80154e:	50                   	push   %eax
+  80154f:	68 a1 4c 80 00       	push   $0x804ca1
+  801554:	e8 9f ec ff ff       	call   8001f8 <cprintf>
+		return eid;
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	e9 d5 00 00 00       	jmp    801636 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801561:	e8 5c f6 ff ff       	call   800bc2 <sys_getenvid>
+  801566:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80156b:	89 c2                	mov    %eax,%edx
+  80156d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80156f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801575:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80157a:	77 18                	ja     801594 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80157c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801581:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801583:	c1 e8 10             	shr    $0x10,%eax
+  801586:	74 0c                	je     801594 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801588:	c1 e0 10             	shl    $0x10,%eax
+  80158b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801590:	29 c1                	sub    %eax,%ecx
+  801592:	eb 06                	jmp    80159a <sfork+0xc7>
+		return pthread_main_tls;
+  801594:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  80159a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80159d:	c1 e0 04             	shl    $0x4,%eax
+  8015a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015a5:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8015a7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8015aa:	e9 87 00 00 00       	jmp    801636 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8015af:	f6 c5 04             	test   $0x4,%ch
+  8015b2:	74 6c                	je     801620 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8015b4:	89 ca                	mov    %ecx,%edx
+  8015b6:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8015bc:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8015c2:	74 7c                	je     801640 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015c4:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015ca:	89 da                	mov    %ebx,%edx
+  8015cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015cf:	e8 67 fb ff ff       	call   80113b <duppage>
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	0f 88 4f 01 00 00    	js     80172b <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8015dc:	83 c3 01             	add    $0x1,%ebx
+  8015df:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8015e2:	74 7a                	je     80165e <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8015e4:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8015e6:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8015ed:	f6 c1 01             	test   $0x1,%cl
+  8015f0:	74 ea                	je     8015dc <sfork+0x109>
+  8015f2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8015f8:	74 e2                	je     8015dc <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8015fa:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801600:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801603:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801608:	76 a5                	jbe    8015af <sfork+0xdc>
+  80160a:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801610:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801613:	39 fa                	cmp    %edi,%edx
+  801615:	73 9d                	jae    8015b4 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801617:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80161a:	39 fa                	cmp    %edi,%edx
+  80161c:	72 96                	jb     8015b4 <sfork+0xe1>
+  80161e:	eb 8f                	jmp    8015af <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801620:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801626:	89 da                	mov    %ebx,%edx
+  801628:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80162b:	e8 8c fa ff ff       	call   8010bc <duppage_cow>
+  801630:	85 c0                	test   %eax,%eax
+  801632:	79 a8                	jns    8015dc <sfork+0x109>
+  801634:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801636:	89 f8                	mov    %edi,%eax
+  801638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163b:	5b                   	pop    %ebx
+  80163c:	5e                   	pop    %esi
+  80163d:	5f                   	pop    %edi
+  80163e:	5d                   	pop    %ebp
+  80163f:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801640:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801645:	e8 2e fb ff ff       	call   801178 <cow_copy>
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	0f 88 d2 00 00 00    	js     801724 <sfork+0x251>
+				pte = uvpt[pn];
+  801652:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801659:	e9 66 ff ff ff       	jmp    8015c4 <sfork+0xf1>
+  80165e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801661:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801664:	83 c6 01             	add    $0x1,%esi
+  801667:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80166d:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801673:	74 1b                	je     801690 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801675:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80167c:	a8 01                	test   $0x1,%al
+  80167e:	74 e4                	je     801664 <sfork+0x191>
+  801680:	89 f3                	mov    %esi,%ebx
+  801682:	c1 e3 0a             	shl    $0xa,%ebx
+  801685:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801688:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80168b:	e9 4f ff ff ff       	jmp    8015df <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	6a 07                	push   $0x7
+  801695:	68 00 f0 bf ee       	push   $0xeebff000
+  80169a:	ff 75 e0             	push   -0x20(%ebp)
+  80169d:	e8 78 f5 ff ff       	call   800c1a <sys_page_alloc>
+  8016a2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 37                	js     8016e2 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8016ab:	83 ec 08             	sub    $0x8,%esp
+  8016ae:	68 7f 44 80 00       	push   $0x80447f
+  8016b3:	ff 75 e0             	push   -0x20(%ebp)
+  8016b6:	e8 dc f6 ff ff       	call   800d97 <sys_env_set_pgfault_upcall>
+  8016bb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	78 34                	js     8016f8 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	6a 02                	push   $0x2
+  8016c9:	ff 75 e0             	push   -0x20(%ebp)
+  8016cc:	e8 2e f6 ff ff       	call   800cff <sys_env_set_status>
+  8016d1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 34                	js     80170e <sfork+0x23b>
+	return eid;
+  8016da:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8016dd:	e9 54 ff ff ff       	jmp    801636 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8016e2:	83 ec 08             	sub    $0x8,%esp
+  8016e5:	50                   	push   %eax
+  8016e6:	68 14 4c 80 00       	push   $0x804c14
+  8016eb:	e8 08 eb ff ff       	call   8001f8 <cprintf>
+		return r;
+  8016f0:	83 c4 10             	add    $0x10,%esp
+  8016f3:	e9 3e ff ff ff       	jmp    801636 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8016f8:	83 ec 08             	sub    $0x8,%esp
+  8016fb:	50                   	push   %eax
+  8016fc:	68 3c 4c 80 00       	push   $0x804c3c
+  801701:	e8 f2 ea ff ff       	call   8001f8 <cprintf>
+		return r;
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	e9 28 ff ff ff       	jmp    801636 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80170e:	83 ec 08             	sub    $0x8,%esp
+  801711:	50                   	push   %eax
+  801712:	68 c6 4c 80 00       	push   $0x804cc6
+  801717:	e8 dc ea ff ff       	call   8001f8 <cprintf>
+		return r;
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	e9 12 ff ff ff       	jmp    801636 <sfork+0x163>
+  801724:	89 c7                	mov    %eax,%edi
+  801726:	e9 0b ff ff ff       	jmp    801636 <sfork+0x163>
+  80172b:	89 c7                	mov    %eax,%edi
+  80172d:	e9 04 ff ff ff       	jmp    801636 <sfork+0x163>
+
+00801732 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	57                   	push   %edi
+  801736:	56                   	push   %esi
+  801737:	53                   	push   %ebx
+  801738:	83 ec 18             	sub    $0x18,%esp
+  80173b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80173e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801741:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801744:	85 c0                	test   %eax,%eax
+  801746:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80174b:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80174e:	50                   	push   %eax
+  80174f:	e8 bc f6 ff ff       	call   800e10 <sys_ipc_recv>
+	if (r < 0) {
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 2b                	js     801786 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80175b:	85 ff                	test   %edi,%edi
+  80175d:	74 55                	je     8017b4 <ipc_recv+0x82>
+  80175f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801761:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801767:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80176c:	77 39                	ja     8017a7 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80176e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801773:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801775:	c1 e8 10             	shr    $0x10,%eax
+  801778:	74 2d                	je     8017a7 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80177a:	c1 e0 10             	shl    $0x10,%eax
+  80177d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801782:	29 c2                	sub    %eax,%edx
+  801784:	eb 27                	jmp    8017ad <ipc_recv+0x7b>
+  801786:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801788:	83 ec 08             	sub    $0x8,%esp
+  80178b:	50                   	push   %eax
+  80178c:	68 e4 4c 80 00       	push   $0x804ce4
+  801791:	e8 62 ea ff ff       	call   8001f8 <cprintf>
+		*from_env_store = 0;
+  801796:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80179c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	eb 77                	jmp    80181e <ipc_recv+0xec>
+		return pthread_main_tls;
+  8017a7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8017ad:	8b 02                	mov    (%edx),%eax
+  8017af:	8b 40 78             	mov    0x78(%eax),%eax
+  8017b2:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8017b4:	85 f6                	test   %esi,%esi
+  8017b6:	74 34                	je     8017ec <ipc_recv+0xba>
+  8017b8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017ba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8017c0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8017c5:	77 18                	ja     8017df <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017c7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8017cc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8017ce:	c1 e8 10             	shr    $0x10,%eax
+  8017d1:	74 0c                	je     8017df <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8017d3:	c1 e0 10             	shl    $0x10,%eax
+  8017d6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8017db:	29 c2                	sub    %eax,%edx
+  8017dd:	eb 06                	jmp    8017e5 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8017df:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8017e5:	8b 02                	mov    (%edx),%eax
+  8017e7:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8017ea:	89 06                	mov    %eax,(%esi)
+  8017ec:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017ee:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8017f4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8017f9:	77 18                	ja     801813 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017fb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801800:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801802:	c1 e8 10             	shr    $0x10,%eax
+  801805:	74 0c                	je     801813 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801807:	c1 e0 10             	shl    $0x10,%eax
+  80180a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80180f:	29 c2                	sub    %eax,%edx
+  801811:	eb 06                	jmp    801819 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  801813:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  801819:	8b 02                	mov    (%edx),%eax
+  80181b:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80181e:	89 d8                	mov    %ebx,%eax
+  801820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+
+00801828 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801828:	55                   	push   %ebp
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	57                   	push   %edi
+  80182c:	56                   	push   %esi
+  80182d:	53                   	push   %ebx
+  80182e:	83 ec 0c             	sub    $0xc,%esp
+  801831:	8b 75 08             	mov    0x8(%ebp),%esi
+  801834:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801837:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80183a:	85 db                	test   %ebx,%ebx
+  80183c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801841:	0f 44 d8             	cmove  %eax,%ebx
+  801844:	eb 05                	jmp    80184b <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801846:	e8 a3 f3 ff ff       	call   800bee <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80184b:	57                   	push   %edi
+  80184c:	53                   	push   %ebx
+  80184d:	ff 75 0c             	push   0xc(%ebp)
+  801850:	56                   	push   %esi
+  801851:	e8 8d f5 ff ff       	call   800de3 <sys_ipc_try_send>
+		if (r == 0) {
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	74 19                	je     801876 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80185d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801860:	74 e4                	je     801846 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	50                   	push   %eax
+  801866:	57                   	push   %edi
+  801867:	53                   	push   %ebx
+  801868:	56                   	push   %esi
+  801869:	68 00 4d 80 00       	push   $0x804d00
+  80186e:	e8 85 e9 ff ff       	call   8001f8 <cprintf>
+			return;
+  801873:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  801876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801879:	5b                   	pop    %ebx
+  80187a:	5e                   	pop    %esi
+  80187b:	5f                   	pop    %edi
+  80187c:	5d                   	pop    %ebp
+  80187d:	c3                   	ret
+
+0080187e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801884:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801889:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80188c:	c1 e0 04             	shl    $0x4,%eax
+  80188f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801894:	8b 40 50             	mov    0x50(%eax),%eax
+  801897:	39 c8                	cmp    %ecx,%eax
+  801899:	74 12                	je     8018ad <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80189b:	83 c2 01             	add    $0x1,%edx
+  80189e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8018a4:	75 e3                	jne    801889 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	eb 0e                	jmp    8018bb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8018ad:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8018b0:	c1 e0 04             	shl    $0x4,%eax
+  8018b3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018b8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+
+008018bd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018c8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018cb:	5d                   	pop    %ebp
+  8018cc:	c3                   	ret
+
+008018cd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018dd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018e2:	5d                   	pop    %ebp
+  8018e3:	c3                   	ret
+
+008018e4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018e7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018ec:	eb 02                	jmp    8018f0 <fd_alloc+0xc>
+  8018ee:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018f0:	89 c2                	mov    %eax,%edx
+  8018f2:	c1 ea 16             	shr    $0x16,%edx
+  8018f5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018fc:	f6 c2 01             	test   $0x1,%dl
+  8018ff:	74 2b                	je     80192c <fd_alloc+0x48>
+  801901:	89 c2                	mov    %eax,%edx
+  801903:	c1 ea 0c             	shr    $0xc,%edx
+  801906:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80190d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801913:	f6 c1 01             	test   $0x1,%cl
+  801916:	74 14                	je     80192c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801918:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80191e:	75 ce                	jne    8018ee <fd_alloc+0xa>
+  801920:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801925:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80192a:	eb 05                	jmp    801931 <fd_alloc+0x4d>
+			return 0;
+  80192c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801931:	8b 55 08             	mov    0x8(%ebp),%edx
+  801934:	89 02                	mov    %eax,(%edx)
+}
+  801936:	89 c8                	mov    %ecx,%eax
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+
+0080193a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80193a:	55                   	push   %ebp
+  80193b:	89 e5                	mov    %esp,%ebp
+  80193d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801940:	83 f8 1f             	cmp    $0x1f,%eax
+  801943:	77 30                	ja     801975 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801945:	c1 e0 0c             	shl    $0xc,%eax
+  801948:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80194d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801953:	f6 c2 01             	test   $0x1,%dl
+  801956:	74 24                	je     80197c <fd_lookup+0x42>
+  801958:	89 c2                	mov    %eax,%edx
+  80195a:	c1 ea 0c             	shr    $0xc,%edx
+  80195d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801964:	f6 c2 01             	test   $0x1,%dl
+  801967:	74 1a                	je     801983 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801969:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80196c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80196e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801973:	5d                   	pop    %ebp
+  801974:	c3                   	ret
+		return -E_INVAL;
+  801975:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197a:	eb f7                	jmp    801973 <fd_lookup+0x39>
+		return -E_INVAL;
+  80197c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801981:	eb f0                	jmp    801973 <fd_lookup+0x39>
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801988:	eb e9                	jmp    801973 <fd_lookup+0x39>
+
+0080198a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 04             	sub    $0x4,%esp
+  801991:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+  801999:	eb 03                	jmp    80199e <dev_lookup+0x14>
+  80199b:	83 c0 01             	add    $0x1,%eax
+  80199e:	8b 1c 85 b4 4d 80 00 	mov    0x804db4(,%eax,4),%ebx
+  8019a5:	85 db                	test   %ebx,%ebx
+  8019a7:	74 0b                	je     8019b4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8019a9:	39 13                	cmp    %edx,(%ebx)
+  8019ab:	75 ee                	jne    80199b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8019ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b2:	eb 49                	jmp    8019fd <dev_lookup+0x73>
+  8019b4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8019b6:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8019bc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8019c1:	77 18                	ja     8019db <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8019c3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8019c8:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8019ca:	c1 e8 10             	shr    $0x10,%eax
+  8019cd:	74 0c                	je     8019db <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8019cf:	c1 e0 10             	shl    $0x10,%eax
+  8019d2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8019d7:	29 c1                	sub    %eax,%ecx
+  8019d9:	eb 06                	jmp    8019e1 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8019db:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019e1:	8b 01                	mov    (%ecx),%eax
+  8019e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	52                   	push   %edx
+  8019ea:	50                   	push   %eax
+  8019eb:	68 38 4d 80 00       	push   $0x804d38
+  8019f0:	e8 03 e8 ff ff       	call   8001f8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019f5:	83 c4 10             	add    $0x10,%esp
+  8019f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a00:	89 1a                	mov    %ebx,(%edx)
+}
+  801a02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a05:	c9                   	leave
+  801a06:	c3                   	ret
+
+00801a07 <fd_close>:
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	57                   	push   %edi
+  801a0b:	56                   	push   %esi
+  801a0c:	53                   	push   %ebx
+  801a0d:	83 ec 24             	sub    $0x24,%esp
+  801a10:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a16:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a19:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a1a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a20:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a23:	50                   	push   %eax
+  801a24:	e8 11 ff ff ff       	call   80193a <fd_lookup>
+  801a29:	89 c3                	mov    %eax,%ebx
+  801a2b:	83 c4 10             	add    $0x10,%esp
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 05                	js     801a37 <fd_close+0x30>
+	    || fd != fd2)
+  801a32:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a35:	74 16                	je     801a4d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a37:	89 f8                	mov    %edi,%eax
+  801a39:	84 c0                	test   %al,%al
+  801a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a40:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a43:	89 d8                	mov    %ebx,%eax
+  801a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a48:	5b                   	pop    %ebx
+  801a49:	5e                   	pop    %esi
+  801a4a:	5f                   	pop    %edi
+  801a4b:	5d                   	pop    %ebp
+  801a4c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a4d:	83 ec 08             	sub    $0x8,%esp
+  801a50:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a53:	50                   	push   %eax
+  801a54:	ff 36                	push   (%esi)
+  801a56:	e8 2f ff ff ff       	call   80198a <dev_lookup>
+  801a5b:	89 c3                	mov    %eax,%ebx
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	78 1a                	js     801a7e <fd_close+0x77>
+		if (dev->dev_close)
+  801a64:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a67:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	74 0b                	je     801a7e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	56                   	push   %esi
+  801a77:	ff d0                	call   *%eax
+  801a79:	89 c3                	mov    %eax,%ebx
+  801a7b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+  801a81:	56                   	push   %esi
+  801a82:	6a 00                	push   $0x0
+  801a84:	e8 2a f2 ff ff       	call   800cb3 <sys_page_unmap>
+	return r;
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	eb b5                	jmp    801a43 <fd_close+0x3c>
+
+00801a8e <close>:
+
+int
+close(int fdnum)
+{
+  801a8e:	55                   	push   %ebp
+  801a8f:	89 e5                	mov    %esp,%ebp
+  801a91:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a97:	50                   	push   %eax
+  801a98:	ff 75 08             	push   0x8(%ebp)
+  801a9b:	e8 9a fe ff ff       	call   80193a <fd_lookup>
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	79 02                	jns    801aa9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801aa7:	c9                   	leave
+  801aa8:	c3                   	ret
+		return fd_close(fd, 1);
+  801aa9:	83 ec 08             	sub    $0x8,%esp
+  801aac:	6a 01                	push   $0x1
+  801aae:	ff 75 f4             	push   -0xc(%ebp)
+  801ab1:	e8 51 ff ff ff       	call   801a07 <fd_close>
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	eb ec                	jmp    801aa7 <close+0x19>
+
+00801abb <close_all>:
+
+void
+close_all(void)
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801ac2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ac7:	83 ec 0c             	sub    $0xc,%esp
+  801aca:	53                   	push   %ebx
+  801acb:	e8 be ff ff ff       	call   801a8e <close>
+	for (i = 0; i < MAXFD; i++)
+  801ad0:	83 c3 01             	add    $0x1,%ebx
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	83 fb 20             	cmp    $0x20,%ebx
+  801ad9:	75 ec                	jne    801ac7 <close_all+0xc>
+}
+  801adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+00801ae0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	57                   	push   %edi
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ae9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aec:	50                   	push   %eax
+  801aed:	ff 75 08             	push   0x8(%ebp)
+  801af0:	e8 45 fe ff ff       	call   80193a <fd_lookup>
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 7f                	js     801b7d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801afe:	83 ec 0c             	sub    $0xc,%esp
+  801b01:	ff 75 0c             	push   0xc(%ebp)
+  801b04:	e8 85 ff ff ff       	call   801a8e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b0c:	c1 e6 0c             	shl    $0xc,%esi
+  801b0f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b15:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b18:	89 3c 24             	mov    %edi,(%esp)
+  801b1b:	e8 ad fd ff ff       	call   8018cd <fd2data>
+  801b20:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b22:	89 34 24             	mov    %esi,(%esp)
+  801b25:	e8 a3 fd ff ff       	call   8018cd <fd2data>
+  801b2a:	83 c4 10             	add    $0x10,%esp
+  801b2d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b30:	89 d8                	mov    %ebx,%eax
+  801b32:	c1 e8 16             	shr    $0x16,%eax
+  801b35:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b3c:	a8 01                	test   $0x1,%al
+  801b3e:	74 11                	je     801b51 <dup+0x71>
+  801b40:	89 d8                	mov    %ebx,%eax
+  801b42:	c1 e8 0c             	shr    $0xc,%eax
+  801b45:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b4c:	f6 c2 01             	test   $0x1,%dl
+  801b4f:	75 36                	jne    801b87 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b51:	89 f8                	mov    %edi,%eax
+  801b53:	c1 e8 0c             	shr    $0xc,%eax
+  801b56:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+  801b60:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b65:	50                   	push   %eax
+  801b66:	56                   	push   %esi
+  801b67:	6a 00                	push   $0x0
+  801b69:	57                   	push   %edi
+  801b6a:	6a 00                	push   $0x0
+  801b6c:	e8 f6 f0 ff ff       	call   800c67 <sys_page_map>
+  801b71:	89 c3                	mov    %eax,%ebx
+  801b73:	83 c4 20             	add    $0x20,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 33                	js     801bad <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b7a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b7d:	89 d8                	mov    %ebx,%eax
+  801b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b82:	5b                   	pop    %ebx
+  801b83:	5e                   	pop    %esi
+  801b84:	5f                   	pop    %edi
+  801b85:	5d                   	pop    %ebp
+  801b86:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b87:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b8e:	83 ec 0c             	sub    $0xc,%esp
+  801b91:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b96:	50                   	push   %eax
+  801b97:	ff 75 d4             	push   -0x2c(%ebp)
+  801b9a:	6a 00                	push   $0x0
+  801b9c:	53                   	push   %ebx
+  801b9d:	6a 00                	push   $0x0
+  801b9f:	e8 c3 f0 ff ff       	call   800c67 <sys_page_map>
+  801ba4:	89 c3                	mov    %eax,%ebx
+  801ba6:	83 c4 20             	add    $0x20,%esp
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	79 a4                	jns    801b51 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bad:	83 ec 08             	sub    $0x8,%esp
+  801bb0:	56                   	push   %esi
+  801bb1:	6a 00                	push   $0x0
+  801bb3:	e8 fb f0 ff ff       	call   800cb3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bb8:	83 c4 08             	add    $0x8,%esp
+  801bbb:	ff 75 d4             	push   -0x2c(%ebp)
+  801bbe:	6a 00                	push   $0x0
+  801bc0:	e8 ee f0 ff ff       	call   800cb3 <sys_page_unmap>
+	return r;
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	eb b3                	jmp    801b7d <dup+0x9d>
+
+00801bca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	56                   	push   %esi
+  801bce:	53                   	push   %ebx
+  801bcf:	83 ec 18             	sub    $0x18,%esp
+  801bd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bd5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bd8:	50                   	push   %eax
+  801bd9:	53                   	push   %ebx
+  801bda:	e8 5b fd ff ff       	call   80193a <fd_lookup>
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 3c                	js     801c22 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801be6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bef:	50                   	push   %eax
+  801bf0:	ff 36                	push   (%esi)
+  801bf2:	e8 93 fd ff ff       	call   80198a <dev_lookup>
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	78 24                	js     801c22 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bfe:	8b 46 08             	mov    0x8(%esi),%eax
+  801c01:	83 e0 03             	and    $0x3,%eax
+  801c04:	83 f8 01             	cmp    $0x1,%eax
+  801c07:	74 20                	je     801c29 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0c:	8b 40 08             	mov    0x8(%eax),%eax
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	74 61                	je     801c74 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c13:	83 ec 04             	sub    $0x4,%esp
+  801c16:	ff 75 10             	push   0x10(%ebp)
+  801c19:	ff 75 0c             	push   0xc(%ebp)
+  801c1c:	56                   	push   %esi
+  801c1d:	ff d0                	call   *%eax
+  801c1f:	83 c4 10             	add    $0x10,%esp
+}
+  801c22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5d                   	pop    %ebp
+  801c28:	c3                   	ret
+  801c29:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c2b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c31:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c36:	77 18                	ja     801c50 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c38:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c3d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c3f:	c1 e8 10             	shr    $0x10,%eax
+  801c42:	74 0c                	je     801c50 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c44:	c1 e0 10             	shl    $0x10,%eax
+  801c47:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c4c:	29 c2                	sub    %eax,%edx
+  801c4e:	eb 06                	jmp    801c56 <read+0x8c>
+		return pthread_main_tls;
+  801c50:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c56:	8b 02                	mov    (%edx),%eax
+  801c58:	8b 40 48             	mov    0x48(%eax),%eax
+  801c5b:	83 ec 04             	sub    $0x4,%esp
+  801c5e:	53                   	push   %ebx
+  801c5f:	50                   	push   %eax
+  801c60:	68 79 4d 80 00       	push   $0x804d79
+  801c65:	e8 8e e5 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  801c6a:	83 c4 10             	add    $0x10,%esp
+  801c6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c72:	eb ae                	jmp    801c22 <read+0x58>
+		return -E_NOT_SUPP;
+  801c74:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c79:	eb a7                	jmp    801c22 <read+0x58>
+
+00801c7b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c7b:	55                   	push   %ebp
+  801c7c:	89 e5                	mov    %esp,%ebp
+  801c7e:	57                   	push   %edi
+  801c7f:	56                   	push   %esi
+  801c80:	53                   	push   %ebx
+  801c81:	83 ec 0c             	sub    $0xc,%esp
+  801c84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8f:	eb 02                	jmp    801c93 <readn+0x18>
+  801c91:	01 c3                	add    %eax,%ebx
+  801c93:	39 f3                	cmp    %esi,%ebx
+  801c95:	73 21                	jae    801cb8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c97:	83 ec 04             	sub    $0x4,%esp
+  801c9a:	89 f0                	mov    %esi,%eax
+  801c9c:	29 d8                	sub    %ebx,%eax
+  801c9e:	50                   	push   %eax
+  801c9f:	89 d8                	mov    %ebx,%eax
+  801ca1:	03 45 0c             	add    0xc(%ebp),%eax
+  801ca4:	50                   	push   %eax
+  801ca5:	57                   	push   %edi
+  801ca6:	e8 1f ff ff ff       	call   801bca <read>
+		if (m < 0)
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	85 c0                	test   %eax,%eax
+  801cb0:	78 04                	js     801cb6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cb2:	75 dd                	jne    801c91 <readn+0x16>
+  801cb4:	eb 02                	jmp    801cb8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cb8:	89 d8                	mov    %ebx,%eax
+  801cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbd:	5b                   	pop    %ebx
+  801cbe:	5e                   	pop    %esi
+  801cbf:	5f                   	pop    %edi
+  801cc0:	5d                   	pop    %ebp
+  801cc1:	c3                   	ret
+
+00801cc2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cc2:	55                   	push   %ebp
+  801cc3:	89 e5                	mov    %esp,%ebp
+  801cc5:	56                   	push   %esi
+  801cc6:	53                   	push   %ebx
+  801cc7:	83 ec 18             	sub    $0x18,%esp
+  801cca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ccd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	53                   	push   %ebx
+  801cd2:	e8 63 fc ff ff       	call   80193a <fd_lookup>
+  801cd7:	83 c4 10             	add    $0x10,%esp
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	78 37                	js     801d15 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cde:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ce1:	83 ec 08             	sub    $0x8,%esp
+  801ce4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce7:	50                   	push   %eax
+  801ce8:	ff 36                	push   (%esi)
+  801cea:	e8 9b fc ff ff       	call   80198a <dev_lookup>
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 1f                	js     801d15 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cf6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cfa:	74 20                	je     801d1c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	74 61                	je     801d67 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d06:	83 ec 04             	sub    $0x4,%esp
+  801d09:	ff 75 10             	push   0x10(%ebp)
+  801d0c:	ff 75 0c             	push   0xc(%ebp)
+  801d0f:	56                   	push   %esi
+  801d10:	ff d0                	call   *%eax
+  801d12:	83 c4 10             	add    $0x10,%esp
+}
+  801d15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d18:	5b                   	pop    %ebx
+  801d19:	5e                   	pop    %esi
+  801d1a:	5d                   	pop    %ebp
+  801d1b:	c3                   	ret
+  801d1c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d1e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d24:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d29:	77 18                	ja     801d43 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d2b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d30:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d32:	c1 e8 10             	shr    $0x10,%eax
+  801d35:	74 0c                	je     801d43 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d37:	c1 e0 10             	shl    $0x10,%eax
+  801d3a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d3f:	29 c2                	sub    %eax,%edx
+  801d41:	eb 06                	jmp    801d49 <write+0x87>
+		return pthread_main_tls;
+  801d43:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d49:	8b 02                	mov    (%edx),%eax
+  801d4b:	8b 40 48             	mov    0x48(%eax),%eax
+  801d4e:	83 ec 04             	sub    $0x4,%esp
+  801d51:	53                   	push   %ebx
+  801d52:	50                   	push   %eax
+  801d53:	68 95 4d 80 00       	push   $0x804d95
+  801d58:	e8 9b e4 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d65:	eb ae                	jmp    801d15 <write+0x53>
+		return -E_NOT_SUPP;
+  801d67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d6c:	eb a7                	jmp    801d15 <write+0x53>
+
+00801d6e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d6e:	55                   	push   %ebp
+  801d6f:	89 e5                	mov    %esp,%ebp
+  801d71:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d77:	50                   	push   %eax
+  801d78:	ff 75 08             	push   0x8(%ebp)
+  801d7b:	e8 ba fb ff ff       	call   80193a <fd_lookup>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 0e                	js     801d95 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d95:	c9                   	leave
+  801d96:	c3                   	ret
+
+00801d97 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d97:	55                   	push   %ebp
+  801d98:	89 e5                	mov    %esp,%ebp
+  801d9a:	56                   	push   %esi
+  801d9b:	53                   	push   %ebx
+  801d9c:	83 ec 18             	sub    $0x18,%esp
+  801d9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801da2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da5:	50                   	push   %eax
+  801da6:	53                   	push   %ebx
+  801da7:	e8 8e fb ff ff       	call   80193a <fd_lookup>
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	78 34                	js     801de7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801db3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801db6:	83 ec 08             	sub    $0x8,%esp
+  801db9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbc:	50                   	push   %eax
+  801dbd:	ff 36                	push   (%esi)
+  801dbf:	e8 c6 fb ff ff       	call   80198a <dev_lookup>
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 1c                	js     801de7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dcb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dcf:	74 1d                	je     801dee <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801dd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd4:	8b 40 18             	mov    0x18(%eax),%eax
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	74 5e                	je     801e39 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ddb:	83 ec 08             	sub    $0x8,%esp
+  801dde:	ff 75 0c             	push   0xc(%ebp)
+  801de1:	56                   	push   %esi
+  801de2:	ff d0                	call   *%eax
+  801de4:	83 c4 10             	add    $0x10,%esp
+}
+  801de7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dea:	5b                   	pop    %ebx
+  801deb:	5e                   	pop    %esi
+  801dec:	5d                   	pop    %ebp
+  801ded:	c3                   	ret
+  801dee:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801df0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801df6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801dfb:	77 18                	ja     801e15 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801dfd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e02:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e04:	c1 e8 10             	shr    $0x10,%eax
+  801e07:	74 0c                	je     801e15 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e09:	c1 e0 10             	shl    $0x10,%eax
+  801e0c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e11:	29 c2                	sub    %eax,%edx
+  801e13:	eb 06                	jmp    801e1b <ftruncate+0x84>
+		return pthread_main_tls;
+  801e15:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801e1b:	8b 02                	mov    (%edx),%eax
+  801e1d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e20:	83 ec 04             	sub    $0x4,%esp
+  801e23:	53                   	push   %ebx
+  801e24:	50                   	push   %eax
+  801e25:	68 58 4d 80 00       	push   $0x804d58
+  801e2a:	e8 c9 e3 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e37:	eb ae                	jmp    801de7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e39:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e3e:	eb a7                	jmp    801de7 <ftruncate+0x50>
+
+00801e40 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	83 ec 18             	sub    $0x18,%esp
+  801e48:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	ff 75 08             	push   0x8(%ebp)
+  801e52:	e8 e3 fa ff ff       	call   80193a <fd_lookup>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 49                	js     801ea7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e5e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e61:	83 ec 08             	sub    $0x8,%esp
+  801e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e67:	50                   	push   %eax
+  801e68:	ff 36                	push   (%esi)
+  801e6a:	e8 1b fb ff ff       	call   80198a <dev_lookup>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	78 31                	js     801ea7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e79:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e7d:	74 2f                	je     801eae <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e7f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e82:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e89:	00 00 00 
+	stat->st_isdir = 0;
+  801e8c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e93:	00 00 00 
+	stat->st_dev = dev;
+  801e96:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e9c:	83 ec 08             	sub    $0x8,%esp
+  801e9f:	53                   	push   %ebx
+  801ea0:	56                   	push   %esi
+  801ea1:	ff 50 14             	call   *0x14(%eax)
+  801ea4:	83 c4 10             	add    $0x10,%esp
+}
+  801ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eaa:	5b                   	pop    %ebx
+  801eab:	5e                   	pop    %esi
+  801eac:	5d                   	pop    %ebp
+  801ead:	c3                   	ret
+		return -E_NOT_SUPP;
+  801eae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb3:	eb f2                	jmp    801ea7 <fstat+0x67>
+
+00801eb5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801eb5:	55                   	push   %ebp
+  801eb6:	89 e5                	mov    %esp,%ebp
+  801eb8:	56                   	push   %esi
+  801eb9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801eba:	83 ec 08             	sub    $0x8,%esp
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	ff 75 08             	push   0x8(%ebp)
+  801ec2:	e8 4b 03 00 00       	call   802212 <open>
+  801ec7:	89 c3                	mov    %eax,%ebx
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 1b                	js     801eeb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	ff 75 0c             	push   0xc(%ebp)
+  801ed6:	50                   	push   %eax
+  801ed7:	e8 64 ff ff ff       	call   801e40 <fstat>
+  801edc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ede:	89 1c 24             	mov    %ebx,(%esp)
+  801ee1:	e8 a8 fb ff ff       	call   801a8e <close>
+	return r;
+  801ee6:	83 c4 10             	add    $0x10,%esp
+  801ee9:	89 f3                	mov    %esi,%ebx
+}
+  801eeb:	89 d8                	mov    %ebx,%eax
+  801eed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef0:	5b                   	pop    %ebx
+  801ef1:	5e                   	pop    %esi
+  801ef2:	5d                   	pop    %ebp
+  801ef3:	c3                   	ret
+
+00801ef4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	56                   	push   %esi
+  801ef8:	53                   	push   %ebx
+  801ef9:	89 c6                	mov    %eax,%esi
+  801efb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801efd:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801f04:	74 27                	je     801f2d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f06:	6a 07                	push   $0x7
+  801f08:	68 00 70 80 00       	push   $0x807000
+  801f0d:	56                   	push   %esi
+  801f0e:	ff 35 00 60 80 00    	push   0x806000
+  801f14:	e8 0f f9 ff ff       	call   801828 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f19:	83 c4 0c             	add    $0xc,%esp
+  801f1c:	6a 00                	push   $0x0
+  801f1e:	53                   	push   %ebx
+  801f1f:	6a 00                	push   $0x0
+  801f21:	e8 0c f8 ff ff       	call   801732 <ipc_recv>
+}
+  801f26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f29:	5b                   	pop    %ebx
+  801f2a:	5e                   	pop    %esi
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	6a 01                	push   $0x1
+  801f32:	e8 47 f9 ff ff       	call   80187e <ipc_find_env>
+  801f37:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	eb c5                	jmp    801f06 <fsipc+0x12>
+
+00801f41 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	53                   	push   %ebx
+  801f45:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f48:	68 04 60 80 00       	push   $0x806004
+  801f4d:	e8 29 1b 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f58:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801f5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f60:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801f65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f6f:	e8 80 ff ff ff       	call   801ef4 <fsipc>
+  801f74:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f76:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801f7d:	e8 66 1b 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+}
+  801f82:	89 d8                	mov    %ebx,%eax
+  801f84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+00801f89 <devfile_flush>:
+{
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	53                   	push   %ebx
+  801f8d:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f90:	68 04 60 80 00       	push   $0x806004
+  801f95:	e8 e1 1a 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa0:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801faa:	b8 06 00 00 00       	mov    $0x6,%eax
+  801faf:	e8 40 ff ff ff       	call   801ef4 <fsipc>
+  801fb4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fb6:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801fbd:	e8 26 1b 00 00       	call   803ae8 <mutex_unlock>
+}
+  801fc2:	89 d8                	mov    %ebx,%eax
+  801fc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc7:	c9                   	leave
+  801fc8:	c3                   	ret
+
+00801fc9 <devfile_stat>:
+{
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	56                   	push   %esi
+  801fcd:	53                   	push   %ebx
+  801fce:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	68 04 60 80 00       	push   $0x806004
+  801fd9:	e8 9d 1a 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fe4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fee:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ff3:	e8 fc fe ff ff       	call   801ef4 <fsipc>
+  801ff8:	89 c3                	mov    %eax,%ebx
+  801ffa:	83 c4 10             	add    $0x10,%esp
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	79 16                	jns    802017 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802001:	83 ec 0c             	sub    $0xc,%esp
+  802004:	68 04 60 80 00       	push   $0x806004
+  802009:	e8 da 1a 00 00       	call   803ae8 <mutex_unlock>
+}
+  80200e:	89 d8                	mov    %ebx,%eax
+  802010:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802013:	5b                   	pop    %ebx
+  802014:	5e                   	pop    %esi
+  802015:	5d                   	pop    %ebp
+  802016:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802017:	83 ec 08             	sub    $0x8,%esp
+  80201a:	68 00 70 80 00       	push   $0x807000
+  80201f:	56                   	push   %esi
+  802020:	e8 b7 e7 ff ff       	call   8007dc <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802025:	a1 80 70 80 00       	mov    0x807080,%eax
+  80202a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802030:	a1 84 70 80 00       	mov    0x807084,%eax
+  802035:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80203b:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80203e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802043:	eb bc                	jmp    802001 <devfile_stat+0x38>
+
+00802045 <devfile_write>:
+{
+  802045:	55                   	push   %ebp
+  802046:	89 e5                	mov    %esp,%ebp
+  802048:	53                   	push   %ebx
+  802049:	83 ec 10             	sub    $0x10,%esp
+  80204c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80204f:	68 04 60 80 00       	push   $0x806004
+  802054:	e8 22 1a 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802059:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80205f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80206d:	76 3d                	jbe    8020ac <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80206f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802074:	39 c3                	cmp    %eax,%ebx
+  802076:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802079:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80207c:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  802081:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802091:	e8 5e fe ff ff       	call   801ef4 <fsipc>
+  802096:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802098:	83 ec 0c             	sub    $0xc,%esp
+  80209b:	68 04 60 80 00       	push   $0x806004
+  8020a0:	e8 43 1a 00 00       	call   803ae8 <mutex_unlock>
+}
+  8020a5:	89 d8                	mov    %ebx,%eax
+  8020a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020aa:	c9                   	leave
+  8020ab:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8020ac:	83 ec 04             	sub    $0x4,%esp
+  8020af:	53                   	push   %ebx
+  8020b0:	ff 75 0c             	push   0xc(%ebp)
+  8020b3:	68 0c 70 80 00       	push   $0x80700c
+  8020b8:	e8 a5 e8 ff ff       	call   800962 <memmove>
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c5:	eb b5                	jmp    80207c <devfile_write+0x37>
+
+008020c7 <devfile_read>:
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	57                   	push   %edi
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8020d9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8020df:	0f 86 8c 00 00 00    	jbe    802171 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8020e5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8020ea:	39 c3                	cmp    %eax,%ebx
+  8020ec:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8020ef:	89 f8                	mov    %edi,%eax
+  8020f1:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8020f4:	eb 0f                	jmp    802105 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8020f6:	0f b6 08             	movzbl (%eax),%ecx
+  8020f9:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8020fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802100:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802105:	39 d0                	cmp    %edx,%eax
+  802107:	72 ed                	jb     8020f6 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	68 04 60 80 00       	push   $0x806004
+  802111:	e8 65 19 00 00       	call   803a7b <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802116:	8b 46 0c             	mov    0xc(%esi),%eax
+  802119:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  80211e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802124:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  80212a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802134:	e8 bb fd ff ff       	call   801ef4 <fsipc>
+  802139:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80213b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802142:	e8 a1 19 00 00       	call   803ae8 <mutex_unlock>
+		assert(r <= (int) n);
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	39 f3                	cmp    %esi,%ebx
+  80214c:	7c 0a                	jl     802158 <devfile_read+0x91>
+}
+  80214e:	89 f0                	mov    %esi,%eax
+  802150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802153:	5b                   	pop    %ebx
+  802154:	5e                   	pop    %esi
+  802155:	5f                   	pop    %edi
+  802156:	5d                   	pop    %ebp
+  802157:	c3                   	ret
+		assert(r <= (int) n);
+  802158:	68 c8 4d 80 00       	push   $0x804dc8
+  80215d:	68 b1 4c 80 00       	push   $0x804cb1
+  802162:	68 90 00 00 00       	push   $0x90
+  802167:	68 d5 4d 80 00       	push   $0x804dd5
+  80216c:	e8 8a 22 00 00       	call   8043fb <_panic>
+	mutex_lock(&fsipc_mu);
+  802171:	83 ec 0c             	sub    $0xc,%esp
+  802174:	68 04 60 80 00       	push   $0x806004
+  802179:	e8 fd 18 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80217e:	8b 46 0c             	mov    0xc(%esi),%eax
+  802181:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802186:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  80218c:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802193:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219b:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021a0:	e8 4f fd ff ff       	call   801ef4 <fsipc>
+  8021a5:	89 c6                	mov    %eax,%esi
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	85 c0                	test   %eax,%eax
+  8021ac:	78 1d                	js     8021cb <devfile_read+0x104>
+		assert(r <= n);
+  8021ae:	39 c3                	cmp    %eax,%ebx
+  8021b0:	72 2e                	jb     8021e0 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8021b2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021b7:	7f 40                	jg     8021f9 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021b9:	83 ec 04             	sub    $0x4,%esp
+  8021bc:	50                   	push   %eax
+  8021bd:	68 00 70 80 00       	push   $0x807000
+  8021c2:	57                   	push   %edi
+  8021c3:	e8 9a e7 ff ff       	call   800962 <memmove>
+  8021c8:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8021cb:	83 ec 0c             	sub    $0xc,%esp
+  8021ce:	68 04 60 80 00       	push   $0x806004
+  8021d3:	e8 10 19 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	e9 6e ff ff ff       	jmp    80214e <devfile_read+0x87>
+		assert(r <= n);
+  8021e0:	68 e0 4d 80 00       	push   $0x804de0
+  8021e5:	68 b1 4c 80 00       	push   $0x804cb1
+  8021ea:	68 99 00 00 00       	push   $0x99
+  8021ef:	68 d5 4d 80 00       	push   $0x804dd5
+  8021f4:	e8 02 22 00 00       	call   8043fb <_panic>
+		assert(r <= PGSIZE);
+  8021f9:	68 e7 4d 80 00       	push   $0x804de7
+  8021fe:	68 b1 4c 80 00       	push   $0x804cb1
+  802203:	68 9a 00 00 00       	push   $0x9a
+  802208:	68 d5 4d 80 00       	push   $0x804dd5
+  80220d:	e8 e9 21 00 00       	call   8043fb <_panic>
+
+00802212 <open>:
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	56                   	push   %esi
+  802216:	53                   	push   %ebx
+  802217:	83 ec 1c             	sub    $0x1c,%esp
+  80221a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80221d:	56                   	push   %esi
+  80221e:	e8 7e e5 ff ff       	call   8007a1 <strlen>
+  802223:	83 c4 10             	add    $0x10,%esp
+  802226:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80222b:	0f 8f 85 00 00 00    	jg     8022b6 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802231:	83 ec 0c             	sub    $0xc,%esp
+  802234:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802237:	50                   	push   %eax
+  802238:	e8 a7 f6 ff ff       	call   8018e4 <fd_alloc>
+  80223d:	89 c3                	mov    %eax,%ebx
+  80223f:	83 c4 10             	add    $0x10,%esp
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 55                	js     80229b <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802246:	83 ec 0c             	sub    $0xc,%esp
+  802249:	68 04 60 80 00       	push   $0x806004
+  80224e:	e8 28 18 00 00       	call   803a7b <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802253:	83 c4 08             	add    $0x8,%esp
+  802256:	56                   	push   %esi
+  802257:	68 00 70 80 00       	push   $0x807000
+  80225c:	e8 7b e5 ff ff       	call   8007dc <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802261:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802264:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  802269:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80226c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802271:	e8 7e fc ff ff       	call   801ef4 <fsipc>
+  802276:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802278:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80227f:	e8 64 18 00 00       	call   803ae8 <mutex_unlock>
+	if (r < 0) {
+  802284:	83 c4 10             	add    $0x10,%esp
+  802287:	85 db                	test   %ebx,%ebx
+  802289:	78 19                	js     8022a4 <open+0x92>
+	return fd2num(fd);
+  80228b:	83 ec 0c             	sub    $0xc,%esp
+  80228e:	ff 75 f4             	push   -0xc(%ebp)
+  802291:	e8 27 f6 ff ff       	call   8018bd <fd2num>
+  802296:	89 c3                	mov    %eax,%ebx
+  802298:	83 c4 10             	add    $0x10,%esp
+}
+  80229b:	89 d8                	mov    %ebx,%eax
+  80229d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a0:	5b                   	pop    %ebx
+  8022a1:	5e                   	pop    %esi
+  8022a2:	5d                   	pop    %ebp
+  8022a3:	c3                   	ret
+		fd_close(fd, 0);
+  8022a4:	83 ec 08             	sub    $0x8,%esp
+  8022a7:	6a 00                	push   $0x0
+  8022a9:	ff 75 f4             	push   -0xc(%ebp)
+  8022ac:	e8 56 f7 ff ff       	call   801a07 <fd_close>
+		return r;
+  8022b1:	83 c4 10             	add    $0x10,%esp
+  8022b4:	eb e5                	jmp    80229b <open+0x89>
+		return -E_BAD_PATH;
+  8022b6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022bb:	eb de                	jmp    80229b <open+0x89>
+
+008022bd <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	53                   	push   %ebx
+  8022c1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c7:	50                   	push   %eax
+  8022c8:	ff 75 08             	push   0x8(%ebp)
+  8022cb:	e8 6a f6 ff ff       	call   80193a <fd_lookup>
+  8022d0:	89 c3                	mov    %eax,%ebx
+  8022d2:	83 c4 10             	add    $0x10,%esp
+  8022d5:	85 c0                	test   %eax,%eax
+  8022d7:	78 5b                	js     802334 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8022d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022dc:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8022e2:	39 08                	cmp    %ecx,(%eax)
+  8022e4:	75 55                	jne    80233b <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8022e6:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8022ea:	74 56                	je     802342 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8022ec:	83 ec 0c             	sub    $0xc,%esp
+  8022ef:	68 04 60 80 00       	push   $0x806004
+  8022f4:	e8 82 17 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8022f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022ff:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  802304:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802307:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  80230c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80230f:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802314:	ba 00 00 00 00       	mov    $0x0,%edx
+  802319:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80231e:	e8 d1 fb ff ff       	call   801ef4 <fsipc>
+  802323:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802325:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80232c:	e8 b7 17 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+  802331:	83 c4 10             	add    $0x10,%esp
+}
+  802334:	89 d8                	mov    %ebx,%eax
+  802336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80233b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802340:	eb f2                	jmp    802334 <fallocate+0x77>
+		return -E_INVAL;
+  802342:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802347:	eb eb                	jmp    802334 <fallocate+0x77>
+
+00802349 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	56                   	push   %esi
+  80234d:	53                   	push   %ebx
+  80234e:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802351:	89 f3                	mov    %esi,%ebx
+  802353:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802359:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80235c:	eb 06                	jmp    802364 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80235e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802364:	39 f3                	cmp    %esi,%ebx
+  802366:	73 14                	jae    80237c <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802368:	83 ec 08             	sub    $0x8,%esp
+  80236b:	53                   	push   %ebx
+  80236c:	6a 00                	push   $0x0
+  80236e:	e8 40 e9 ff ff       	call   800cb3 <sys_page_unmap>
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	79 e4                	jns    80235e <munmap+0x15>
+  80237a:	eb 05                	jmp    802381 <munmap+0x38>
+			return r;
+	return 0;
+  80237c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802381:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802384:	5b                   	pop    %ebx
+  802385:	5e                   	pop    %esi
+  802386:	5d                   	pop    %ebp
+  802387:	c3                   	ret
+
+00802388 <mmap>:
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	57                   	push   %edi
+  80238c:	56                   	push   %esi
+  80238d:	53                   	push   %ebx
+  80238e:	83 ec 24             	sub    $0x24,%esp
+  802391:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802394:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802397:	50                   	push   %eax
+  802398:	ff 75 08             	push   0x8(%ebp)
+  80239b:	e8 9a f5 ff ff       	call   80193a <fd_lookup>
+  8023a0:	83 c4 10             	add    $0x10,%esp
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	0f 88 37 01 00 00    	js     8024e2 <mmap+0x15a>
+		return NULL;
+  8023ab:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8023b0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023b3:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8023b9:	39 0a                	cmp    %ecx,(%edx)
+  8023bb:	0f 85 05 01 00 00    	jne    8024c6 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8023c1:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8023c8:	0f 85 1b 01 00 00    	jne    8024e9 <mmap+0x161>
+  8023ce:	89 f0                	mov    %esi,%eax
+  8023d0:	83 e8 01             	sub    $0x1,%eax
+  8023d3:	0f 88 17 01 00 00    	js     8024f0 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8023d9:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8023dd:	75 28                	jne    802407 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	68 04 60 80 00       	push   $0x806004
+  8023e7:	e8 8f 16 00 00       	call   803a7b <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023ec:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8023f2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802400:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802405:	eb 2b                	jmp    802432 <mmap+0xaa>
+		cow_enable();
+  802407:	e8 b5 ee ff ff       	call   8012c1 <cow_enable>
+  80240c:	eb d1                	jmp    8023df <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80240e:	89 c2                	mov    %eax,%edx
+  802410:	c1 ea 0c             	shr    $0xc,%edx
+  802413:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80241a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802420:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802426:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802429:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80242b:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802430:	77 25                	ja     802457 <mmap+0xcf>
+  802432:	89 c2                	mov    %eax,%edx
+  802434:	29 da                	sub    %ebx,%edx
+  802436:	39 ca                	cmp    %ecx,%edx
+  802438:	73 3a                	jae    802474 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80243a:	89 c2                	mov    %eax,%edx
+  80243c:	c1 ea 16             	shr    $0x16,%edx
+  80243f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802446:	f6 c2 01             	test   $0x1,%dl
+  802449:	75 c3                	jne    80240e <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80244b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802450:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802455:	eb d4                	jmp    80242b <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802457:	29 d8                	sub    %ebx,%eax
+  802459:	39 c8                	cmp    %ecx,%eax
+  80245b:	73 17                	jae    802474 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80245d:	83 ec 0c             	sub    $0xc,%esp
+  802460:	68 04 60 80 00       	push   $0x806004
+  802465:	e8 7e 16 00 00       	call   803ae8 <mutex_unlock>
+		return NULL;
+  80246a:	83 c4 10             	add    $0x10,%esp
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802472:	eb 52                	jmp    8024c6 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802474:	85 db                	test   %ebx,%ebx
+  802476:	74 e5                	je     80245d <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802478:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80247b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80247e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802483:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802486:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  80248b:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  802491:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  802497:	8b 45 14             	mov    0x14(%ebp),%eax
+  80249a:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  80249f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024a9:	e8 46 fa ff ff       	call   801ef4 <fsipc>
+  8024ae:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8024b0:	83 ec 0c             	sub    $0xc,%esp
+  8024b3:	68 04 60 80 00       	push   $0x806004
+  8024b8:	e8 2b 16 00 00       	call   803ae8 <mutex_unlock>
+	if (r < 0) {
+  8024bd:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8024c0:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8024c2:	85 ff                	test   %edi,%edi
+  8024c4:	78 08                	js     8024ce <mmap+0x146>
+}
+  8024c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c9:	5b                   	pop    %ebx
+  8024ca:	5e                   	pop    %esi
+  8024cb:	5f                   	pop    %edi
+  8024cc:	5d                   	pop    %ebp
+  8024cd:	c3                   	ret
+		munmap((void*) va, len);
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+  8024d3:	e8 71 fe ff ff       	call   802349 <munmap>
+		return NULL;
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e0:	eb e4                	jmp    8024c6 <mmap+0x13e>
+		return NULL;
+  8024e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e7:	eb dd                	jmp    8024c6 <mmap+0x13e>
+		return NULL;
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ee:	eb d6                	jmp    8024c6 <mmap+0x13e>
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f5:	eb cf                	jmp    8024c6 <mmap+0x13e>
+
+008024f7 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	53                   	push   %ebx
+  8024fb:	83 ec 10             	sub    $0x10,%esp
+  8024fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802501:	53                   	push   %ebx
+  802502:	e8 9a e2 ff ff       	call   8007a1 <strlen>
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80250f:	7f 42                	jg     802553 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802511:	83 ec 0c             	sub    $0xc,%esp
+  802514:	68 04 60 80 00       	push   $0x806004
+  802519:	e8 5d 15 00 00       	call   803a7b <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80251e:	83 c4 08             	add    $0x8,%esp
+  802521:	53                   	push   %ebx
+  802522:	68 00 70 80 00       	push   $0x807000
+  802527:	e8 b0 e2 ff ff       	call   8007dc <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80252c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802531:	b8 07 00 00 00       	mov    $0x7,%eax
+  802536:	e8 b9 f9 ff ff       	call   801ef4 <fsipc>
+  80253b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80253d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802544:	e8 9f 15 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+  802549:	83 c4 10             	add    $0x10,%esp
+}
+  80254c:	89 d8                	mov    %ebx,%eax
+  80254e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802551:	c9                   	leave
+  802552:	c3                   	ret
+		return -E_BAD_PATH;
+  802553:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802558:	eb f2                	jmp    80254c <remove+0x55>
+
+0080255a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80255a:	55                   	push   %ebp
+  80255b:	89 e5                	mov    %esp,%ebp
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802561:	68 04 60 80 00       	push   $0x806004
+  802566:	e8 10 15 00 00       	call   803a7b <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  80256b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802570:	b8 08 00 00 00       	mov    $0x8,%eax
+  802575:	e8 7a f9 ff ff       	call   801ef4 <fsipc>
+  80257a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80257c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802583:	e8 60 15 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+}
+  802588:	89 d8                	mov    %ebx,%eax
+  80258a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258d:	c9                   	leave
+  80258e:	c3                   	ret
+
+0080258f <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80258f:	55                   	push   %ebp
+  802590:	89 e5                	mov    %esp,%ebp
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+  802594:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802597:	83 ec 0c             	sub    $0xc,%esp
+  80259a:	68 04 60 80 00       	push   $0x806004
+  80259f:	e8 d7 14 00 00       	call   803a7b <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8025a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8025ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025b6:	e8 39 f9 ff ff       	call   801ef4 <fsipc>
+  8025bb:	89 c6                	mov    %eax,%esi
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 db                	test   %ebx,%ebx
+  8025c2:	74 7b                	je     80263f <fs_bcstat+0xb0>
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	78 77                	js     80263f <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8025c8:	a1 00 70 80 00       	mov    0x807000,%eax
+  8025cd:	89 03                	mov    %eax,(%ebx)
+  8025cf:	a1 04 70 80 00       	mov    0x807004,%eax
+  8025d4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025d7:	a1 08 70 80 00       	mov    0x807008,%eax
+  8025dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025df:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8025e4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025e7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8025ec:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025ef:	a1 14 70 80 00       	mov    0x807014,%eax
+  8025f4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8025f7:	a1 18 70 80 00       	mov    0x807018,%eax
+  8025fc:	89 43 18             	mov    %eax,0x18(%ebx)
+  8025ff:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  802604:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802607:	a1 20 70 80 00       	mov    0x807020,%eax
+  80260c:	89 43 20             	mov    %eax,0x20(%ebx)
+  80260f:	a1 24 70 80 00       	mov    0x807024,%eax
+  802614:	89 43 24             	mov    %eax,0x24(%ebx)
+  802617:	a1 28 70 80 00       	mov    0x807028,%eax
+  80261c:	89 43 28             	mov    %eax,0x28(%ebx)
+  80261f:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  802624:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802627:	a1 30 70 80 00       	mov    0x807030,%eax
+  80262c:	89 43 30             	mov    %eax,0x30(%ebx)
+  80262f:	a1 34 70 80 00       	mov    0x807034,%eax
+  802634:	89 43 34             	mov    %eax,0x34(%ebx)
+  802637:	a1 38 70 80 00       	mov    0x807038,%eax
+  80263c:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80263f:	83 ec 0c             	sub    $0xc,%esp
+  802642:	68 04 60 80 00       	push   $0x806004
+  802647:	e8 9c 14 00 00       	call   803ae8 <mutex_unlock>
+	return r;
+}
+  80264c:	89 f0                	mov    %esi,%eax
+  80264e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802651:	5b                   	pop    %ebx
+  802652:	5e                   	pop    %esi
+  802653:	5d                   	pop    %ebp
+  802654:	c3                   	ret
+
+00802655 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802655:	55                   	push   %ebp
+  802656:	89 e5                	mov    %esp,%ebp
+  802658:	56                   	push   %esi
+  802659:	53                   	push   %ebx
+  80265a:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80265c:	0f b6 10             	movzbl (%eax),%edx
+  80265f:	80 fa 72             	cmp    $0x72,%dl
+  802662:	74 44                	je     8026a8 <parse_mode+0x53>
+  802664:	80 fa 77             	cmp    $0x77,%dl
+  802667:	74 4b                	je     8026b4 <parse_mode+0x5f>
+  802669:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80266e:	80 fa 61             	cmp    $0x61,%dl
+  802671:	74 09                	je     80267c <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802673:	89 d8                	mov    %ebx,%eax
+  802675:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802678:	5b                   	pop    %ebx
+  802679:	5e                   	pop    %esi
+  80267a:	5d                   	pop    %ebp
+  80267b:	c3                   	ret
+	switch (mode[0]) {
+  80267c:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802681:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802686:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802688:	83 ec 08             	sub    $0x8,%esp
+  80268b:	6a 2b                	push   $0x2b
+  80268d:	50                   	push   %eax
+  80268e:	e8 5b e2 ff ff       	call   8008ee <strchr>
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	85 c0                	test   %eax,%eax
+  802698:	74 d9                	je     802673 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80269a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80269d:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8026a0:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8026a6:	eb cb                	jmp    802673 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8026a8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b2:	eb d2                	jmp    802686 <parse_mode+0x31>
+  8026b4:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8026b9:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8026be:	eb c6                	jmp    802686 <parse_mode+0x31>
+
+008026c0 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	57                   	push   %edi
+  8026c4:	56                   	push   %esi
+  8026c5:	53                   	push   %ebx
+  8026c6:	83 ec 1c             	sub    $0x1c,%esp
+  8026c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026cc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8026cf:	b8 24 50 80 00       	mov    $0x805024,%eax
+  8026d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8026d9:	83 c0 24             	add    $0x24,%eax
+  8026dc:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8026e0:	74 17                	je     8026f9 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8026e2:	83 c3 01             	add    $0x1,%ebx
+  8026e5:	83 fb 10             	cmp    $0x10,%ebx
+  8026e8:	75 ef                	jne    8026d9 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8026ea:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8026ef:	89 f0                	mov    %esi,%eax
+  8026f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f4:	5b                   	pop    %ebx
+  8026f5:	5e                   	pop    %esi
+  8026f6:	5f                   	pop    %edi
+  8026f7:	5d                   	pop    %ebp
+  8026f8:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8026f9:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802700:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802703:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802706:	c1 e7 02             	shl    $0x2,%edi
+  802709:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  80270f:	83 ec 04             	sub    $0x4,%esp
+  802712:	6a 24                	push   $0x24
+  802714:	6a 00                	push   $0x0
+  802716:	56                   	push   %esi
+  802717:	e8 11 e2 ff ff       	call   80092d <memset>
+			streams[i].f_fd = fd;
+  80271c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80271f:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  802725:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802728:	01 d8                	add    %ebx,%eax
+  80272a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80272d:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	eb b6                	jmp    8026ef <stream_alloc+0x2f>
+
+00802739 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	53                   	push   %ebx
+  80273d:	83 ec 14             	sub    $0x14,%esp
+  802740:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802742:	8b 40 18             	mov    0x18(%eax),%eax
+  802745:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802748:	74 4a                	je     802794 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80274a:	83 ec 08             	sub    $0x8,%esp
+  80274d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802750:	50                   	push   %eax
+  802751:	ff 33                	push   (%ebx)
+  802753:	e8 e2 f1 ff ff       	call   80193a <fd_lookup>
+  802758:	89 c2                	mov    %eax,%edx
+  80275a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80275d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802762:	85 d2                	test   %edx,%edx
+  802764:	78 41                	js     8027a7 <stream_unread+0x6e>
+  802766:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802769:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80276f:	39 0a                	cmp    %ecx,(%edx)
+  802771:	75 34                	jne    8027a7 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802773:	8b 43 14             	mov    0x14(%ebx),%eax
+  802776:	03 42 04             	add    0x4(%edx),%eax
+  802779:	2b 43 18             	sub    0x18(%ebx),%eax
+  80277c:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80277f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802786:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80278d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802792:	eb 13                	jmp    8027a7 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802794:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80279b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8027a2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8027a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027aa:	c9                   	leave
+  8027ab:	c3                   	ret
+
+008027ac <stream_drain>:
+{
+  8027ac:	55                   	push   %ebp
+  8027ad:	89 e5                	mov    %esp,%ebp
+  8027af:	56                   	push   %esi
+  8027b0:	53                   	push   %ebx
+  8027b1:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8027b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b8:	eb 02                	jmp    8027bc <stream_drain+0x10>
+  8027ba:	01 c3                	add    %eax,%ebx
+  8027bc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027bf:	39 c3                	cmp    %eax,%ebx
+  8027c1:	73 43                	jae    802806 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8027c3:	83 ec 04             	sub    $0x4,%esp
+  8027c6:	29 d8                	sub    %ebx,%eax
+  8027c8:	50                   	push   %eax
+  8027c9:	89 d8                	mov    %ebx,%eax
+  8027cb:	03 46 0c             	add    0xc(%esi),%eax
+  8027ce:	50                   	push   %eax
+  8027cf:	ff 36                	push   (%esi)
+  8027d1:	e8 ec f4 ff ff       	call   801cc2 <write>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	85 c0                	test   %eax,%eax
+  8027db:	7f dd                	jg     8027ba <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8027dd:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8027e1:	8b 56 0c             	mov    0xc(%esi),%edx
+  8027e4:	83 ec 04             	sub    $0x4,%esp
+  8027e7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027ea:	29 d8                	sub    %ebx,%eax
+  8027ec:	50                   	push   %eax
+  8027ed:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8027f0:	50                   	push   %eax
+  8027f1:	52                   	push   %edx
+  8027f2:	e8 6b e1 ff ff       	call   800962 <memmove>
+			f->f_wend -= done;
+  8027f7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027fa:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8027fc:	83 c4 10             	add    $0x10,%esp
+  8027ff:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802804:	eb 0a                	jmp    802810 <stream_drain+0x64>
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80280b:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802810:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802813:	89 d0                	mov    %edx,%eax
+  802815:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802818:	5b                   	pop    %ebx
+  802819:	5e                   	pop    %esi
+  80281a:	5d                   	pop    %ebp
+  80281b:	c3                   	ret
+
+0080281c <stream_setup>:
+	if (f->f_buf)
+  80281c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802820:	74 01                	je     802823 <stream_setup+0x7>
+  802822:	c3                   	ret
+{
+  802823:	55                   	push   %ebp
+  802824:	89 e5                	mov    %esp,%ebp
+  802826:	53                   	push   %ebx
+  802827:	83 ec 04             	sub    $0x4,%esp
+  80282a:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80282c:	8b 40 08             	mov    0x8(%eax),%eax
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	74 17                	je     80284a <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802833:	83 f8 03             	cmp    $0x3,%eax
+  802836:	75 2d                	jne    802865 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802838:	8d 43 20             	lea    0x20(%ebx),%eax
+  80283b:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80283e:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	ff 33                	push   (%ebx)
+  80284f:	e8 29 1b 00 00       	call   80437d <iscons>
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	85 c0                	test   %eax,%eax
+  802859:	0f 9f c0             	setg   %al
+  80285c:	0f b6 c0             	movzbl %al,%eax
+  80285f:	83 c0 01             	add    $0x1,%eax
+  802862:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802865:	83 ec 0c             	sub    $0xc,%esp
+  802868:	68 00 10 00 00       	push   $0x1000
+  80286d:	e8 6e 0b 00 00       	call   8033e0 <malloc>
+  802872:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	74 bc                	je     802838 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80287c:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802883:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802887:	eb bc                	jmp    802845 <stream_setup+0x29>
+
+00802889 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802889:	55                   	push   %ebp
+  80288a:	89 e5                	mov    %esp,%ebp
+  80288c:	53                   	push   %ebx
+  80288d:	83 ec 04             	sub    $0x4,%esp
+  802890:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802892:	e8 85 ff ff ff       	call   80281c <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802897:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80289c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8028a0:	74 3d                	je     8028df <stream_fill+0x56>
+  8028a2:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8028a6:	74 10                	je     8028b8 <stream_fill+0x2f>
+  8028a8:	89 d8                	mov    %ebx,%eax
+  8028aa:	e8 fd fe ff ff       	call   8027ac <stream_drain>
+		return 0;
+  8028af:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 27                	js     8028df <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8028b8:	83 ec 04             	sub    $0x4,%esp
+  8028bb:	ff 73 10             	push   0x10(%ebx)
+  8028be:	ff 73 0c             	push   0xc(%ebx)
+  8028c1:	ff 33                	push   (%ebx)
+  8028c3:	e8 02 f3 ff ff       	call   801bca <read>
+  8028c8:	83 c4 10             	add    $0x10,%esp
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	7e 17                	jle    8028e6 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8028cf:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8028d3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8028da:	89 c2                	mov    %eax,%edx
+  8028dc:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8028df:	89 d0                	mov    %edx,%eax
+  8028e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e4:	c9                   	leave
+  8028e5:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8028e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8028e9:	83 e0 04             	and    $0x4,%eax
+  8028ec:	83 c0 04             	add    $0x4,%eax
+  8028ef:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8028f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f7:	eb e6                	jmp    8028df <stream_fill+0x56>
+
+008028f9 <fopen>:
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	57                   	push   %edi
+  8028fd:	56                   	push   %esi
+  8028fe:	53                   	push   %ebx
+  8028ff:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802905:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802908:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80290e:	89 f0                	mov    %esi,%eax
+  802910:	e8 40 fd ff ff       	call   802655 <parse_mode>
+		return 0;
+  802915:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	78 2d                	js     80294b <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80291e:	83 ec 08             	sub    $0x8,%esp
+  802921:	50                   	push   %eax
+  802922:	ff 75 08             	push   0x8(%ebp)
+  802925:	e8 e8 f8 ff ff       	call   802212 <open>
+  80292a:	89 c7                	mov    %eax,%edi
+  80292c:	83 c4 10             	add    $0x10,%esp
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 58                	js     80298b <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802933:	80 3e 61             	cmpb   $0x61,(%esi)
+  802936:	74 1d                	je     802955 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802938:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80293e:	89 f8                	mov    %edi,%eax
+  802940:	e8 7b fd ff ff       	call   8026c0 <stream_alloc>
+  802945:	89 c3                	mov    %eax,%ebx
+  802947:	85 c0                	test   %eax,%eax
+  802949:	74 32                	je     80297d <fopen+0x84>
+}
+  80294b:	89 d8                	mov    %ebx,%eax
+  80294d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802950:	5b                   	pop    %ebx
+  802951:	5e                   	pop    %esi
+  802952:	5f                   	pop    %edi
+  802953:	5d                   	pop    %ebp
+  802954:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802955:	83 ec 08             	sub    $0x8,%esp
+  802958:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80295e:	50                   	push   %eax
+  80295f:	57                   	push   %edi
+  802960:	e8 db f4 ff ff       	call   801e40 <fstat>
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	78 cc                	js     802938 <fopen+0x3f>
+		seek(fd, st.st_size);
+  80296c:	83 ec 08             	sub    $0x8,%esp
+  80296f:	ff 75 dc             	push   -0x24(%ebp)
+  802972:	57                   	push   %edi
+  802973:	e8 f6 f3 ff ff       	call   801d6e <seek>
+  802978:	83 c4 10             	add    $0x10,%esp
+  80297b:	eb bb                	jmp    802938 <fopen+0x3f>
+		close(fd);
+  80297d:	83 ec 0c             	sub    $0xc,%esp
+  802980:	57                   	push   %edi
+  802981:	e8 08 f1 ff ff       	call   801a8e <close>
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	eb c0                	jmp    80294b <fopen+0x52>
+		return 0;
+  80298b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802990:	eb b9                	jmp    80294b <fopen+0x52>
+
+00802992 <fdopen>:
+{
+  802992:	55                   	push   %ebp
+  802993:	89 e5                	mov    %esp,%ebp
+  802995:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802998:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80299b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80299e:	e8 b2 fc ff ff       	call   802655 <parse_mode>
+  8029a3:	89 c2                	mov    %eax,%edx
+		return 0;
+  8029a5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8029aa:	85 d2                	test   %edx,%edx
+  8029ac:	78 0b                	js     8029b9 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8029ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b4:	e8 07 fd ff ff       	call   8026c0 <stream_alloc>
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+008029bb <setvbuf>:
+{
+  8029bb:	55                   	push   %ebp
+  8029bc:	89 e5                	mov    %esp,%ebp
+  8029be:	57                   	push   %edi
+  8029bf:	56                   	push   %esi
+  8029c0:	53                   	push   %ebx
+  8029c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8029c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8029ca:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8029ce:	75 3a                	jne    802a0a <setvbuf+0x4f>
+  8029d0:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8029d3:	83 fe 02             	cmp    $0x2,%esi
+  8029d6:	77 39                	ja     802a11 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8029d8:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8029db:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8029df:	0f 95 c3             	setne  %bl
+  8029e2:	85 ff                	test   %edi,%edi
+  8029e4:	0f 95 c1             	setne  %cl
+  8029e7:	84 cb                	test   %cl,%bl
+  8029e9:	74 05                	je     8029f0 <setvbuf+0x35>
+  8029eb:	83 fa 03             	cmp    $0x3,%edx
+  8029ee:	75 0a                	jne    8029fa <setvbuf+0x3f>
+	return 0;
+  8029f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f5:	5b                   	pop    %ebx
+  8029f6:	5e                   	pop    %esi
+  8029f7:	5f                   	pop    %edi
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+		f->f_buf = buf;
+  8029fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029fd:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802a00:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a08:	eb eb                	jmp    8029f5 <setvbuf+0x3a>
+		return EOF;
+  802a0a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a0f:	eb e4                	jmp    8029f5 <setvbuf+0x3a>
+  802a11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a16:	eb dd                	jmp    8029f5 <setvbuf+0x3a>
+
+00802a18 <fflush>:
+{
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	57                   	push   %edi
+  802a1c:	56                   	push   %esi
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 0c             	sub    $0xc,%esp
+  802a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802a24:	85 db                	test   %ebx,%ebx
+  802a26:	74 1a                	je     802a42 <fflush+0x2a>
+	stream_unread(f);
+  802a28:	89 d8                	mov    %ebx,%eax
+  802a2a:	e8 0a fd ff ff       	call   802739 <stream_unread>
+	return stream_drain(f);
+  802a2f:	89 d8                	mov    %ebx,%eax
+  802a31:	e8 76 fd ff ff       	call   8027ac <stream_drain>
+  802a36:	89 c7                	mov    %eax,%edi
+}
+  802a38:	89 f8                	mov    %edi,%eax
+  802a3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3d:	5b                   	pop    %ebx
+  802a3e:	5e                   	pop    %esi
+  802a3f:	5f                   	pop    %edi
+  802a40:	5d                   	pop    %ebp
+  802a41:	c3                   	ret
+  802a42:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  802a47:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802a4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a51:	eb 03                	jmp    802a56 <fflush+0x3e>
+  802a53:	83 c3 24             	add    $0x24,%ebx
+  802a56:	39 f3                	cmp    %esi,%ebx
+  802a58:	74 de                	je     802a38 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802a5a:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802a5e:	74 f3                	je     802a53 <fflush+0x3b>
+  802a60:	83 ec 0c             	sub    $0xc,%esp
+  802a63:	53                   	push   %ebx
+  802a64:	e8 af ff ff ff       	call   802a18 <fflush>
+  802a69:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a73:	0f 48 f8             	cmovs  %eax,%edi
+  802a76:	eb db                	jmp    802a53 <fflush+0x3b>
+
+00802a78 <fclose>:
+{
+  802a78:	55                   	push   %ebp
+  802a79:	89 e5                	mov    %esp,%ebp
+  802a7b:	56                   	push   %esi
+  802a7c:	53                   	push   %ebx
+  802a7d:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802a80:	83 ec 0c             	sub    $0xc,%esp
+  802a83:	56                   	push   %esi
+  802a84:	e8 8f ff ff ff       	call   802a18 <fflush>
+  802a89:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802a8b:	83 c4 04             	add    $0x4,%esp
+  802a8e:	ff 36                	push   (%esi)
+  802a90:	e8 f9 ef ff ff       	call   801a8e <close>
+  802a95:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a9f:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802aa2:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802aa6:	75 10                	jne    802ab8 <fclose+0x40>
+	f->f_flags = 0;
+  802aa8:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802aaf:	89 d8                	mov    %ebx,%eax
+  802ab1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab4:	5b                   	pop    %ebx
+  802ab5:	5e                   	pop    %esi
+  802ab6:	5d                   	pop    %ebp
+  802ab7:	c3                   	ret
+		free(f->f_buf);
+  802ab8:	83 ec 0c             	sub    $0xc,%esp
+  802abb:	ff 76 0c             	push   0xc(%esi)
+  802abe:	e8 54 08 00 00       	call   803317 <free>
+  802ac3:	83 c4 10             	add    $0x10,%esp
+  802ac6:	eb e0                	jmp    802aa8 <fclose+0x30>
+
+00802ac8 <fileno>:
+{
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ace:	8b 00                	mov    (%eax),%eax
+}
+  802ad0:	5d                   	pop    %ebp
+  802ad1:	c3                   	ret
+
+00802ad2 <feof>:
+{
+  802ad2:	55                   	push   %ebp
+  802ad3:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad8:	8b 40 04             	mov    0x4(%eax),%eax
+  802adb:	c1 e8 02             	shr    $0x2,%eax
+  802ade:	83 e0 01             	and    $0x1,%eax
+}
+  802ae1:	5d                   	pop    %ebp
+  802ae2:	c3                   	ret
+
+00802ae3 <ferror>:
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae9:	8b 40 04             	mov    0x4(%eax),%eax
+  802aec:	c1 e8 03             	shr    $0x3,%eax
+  802aef:	83 e0 01             	and    $0x1,%eax
+}
+  802af2:	5d                   	pop    %ebp
+  802af3:	c3                   	ret
+
+00802af4 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	53                   	push   %ebx
+  802af8:	83 ec 04             	sub    $0x4,%esp
+  802afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802afe:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b01:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802b04:	74 15                	je     802b1b <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802b06:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802b09:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b0c:	8d 48 01             	lea    0x1(%eax),%ecx
+  802b0f:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802b12:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802b16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b1b:	89 d8                	mov    %ebx,%eax
+  802b1d:	e8 67 fd ff ff       	call   802889 <stream_fill>
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	75 e0                	jne    802b06 <fgetc+0x12>
+		return EOF;
+  802b26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b2b:	eb e9                	jmp    802b16 <fgetc+0x22>
+
+00802b2d <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	57                   	push   %edi
+  802b31:	56                   	push   %esi
+  802b32:	53                   	push   %ebx
+  802b33:	83 ec 1c             	sub    $0x1c,%esp
+  802b36:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802b39:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b41:	83 e8 01             	sub    $0x1,%eax
+  802b44:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802b47:	eb 66                	jmp    802baf <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b49:	8b 46 14             	mov    0x14(%esi),%eax
+  802b4c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802b4f:	29 c3                	sub    %eax,%ebx
+  802b51:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b54:	29 fa                	sub    %edi,%edx
+  802b56:	39 d3                	cmp    %edx,%ebx
+  802b58:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b5b:	83 ec 04             	sub    $0x4,%esp
+  802b5e:	53                   	push   %ebx
+  802b5f:	6a 0a                	push   $0xa
+  802b61:	03 46 0c             	add    0xc(%esi),%eax
+  802b64:	50                   	push   %eax
+  802b65:	e8 a9 de ff ff       	call   800a13 <memfind>
+  802b6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802b6d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802b70:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802b73:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802b76:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b78:	83 c4 10             	add    $0x10,%esp
+  802b7b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b7e:	74 0b                	je     802b8b <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802b80:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b83:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b86:	29 d3                	sub    %edx,%ebx
+  802b88:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802b8b:	83 ec 04             	sub    $0x4,%esp
+  802b8e:	53                   	push   %ebx
+  802b8f:	01 c8                	add    %ecx,%eax
+  802b91:	50                   	push   %eax
+  802b92:	89 f8                	mov    %edi,%eax
+  802b94:	03 45 08             	add    0x8(%ebp),%eax
+  802b97:	50                   	push   %eax
+  802b98:	e8 c5 dd ff ff       	call   800962 <memmove>
+		f->f_rpos += m;
+  802b9d:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802ba0:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba8:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802bad:	74 1f                	je     802bce <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802baf:	8d 47 01             	lea    0x1(%edi),%eax
+  802bb2:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802bb5:	73 17                	jae    802bce <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802bb7:	8b 46 18             	mov    0x18(%esi),%eax
+  802bba:	39 46 14             	cmp    %eax,0x14(%esi)
+  802bbd:	75 8a                	jne    802b49 <fgets+0x1c>
+  802bbf:	89 f0                	mov    %esi,%eax
+  802bc1:	e8 c3 fc ff ff       	call   802889 <stream_fill>
+  802bc6:	85 c0                	test   %eax,%eax
+  802bc8:	0f 85 7b ff ff ff    	jne    802b49 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802bce:	85 ff                	test   %edi,%edi
+  802bd0:	74 0f                	je     802be1 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd5:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802bd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bdc:	5b                   	pop    %ebx
+  802bdd:	5e                   	pop    %esi
+  802bde:	5f                   	pop    %edi
+  802bdf:	5d                   	pop    %ebp
+  802be0:	c3                   	ret
+		return 0;
+  802be1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be6:	eb f1                	jmp    802bd9 <fgets+0xac>
+
+00802be8 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	57                   	push   %edi
+  802bec:	56                   	push   %esi
+  802bed:	53                   	push   %ebx
+  802bee:	83 ec 1c             	sub    $0x1c,%esp
+  802bf1:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802bf4:	89 f0                	mov    %esi,%eax
+  802bf6:	e8 21 fc ff ff       	call   80281c <stream_setup>
+	want = size * n;
+  802bfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bfe:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802c05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0a:	eb 43                	jmp    802c4f <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802c0c:	29 d3                	sub    %edx,%ebx
+  802c0e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c11:	29 f8                	sub    %edi,%eax
+  802c13:	39 c3                	cmp    %eax,%ebx
+  802c15:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802c18:	83 ec 04             	sub    $0x4,%esp
+  802c1b:	53                   	push   %ebx
+  802c1c:	03 56 0c             	add    0xc(%esi),%edx
+  802c1f:	52                   	push   %edx
+  802c20:	89 f8                	mov    %edi,%eax
+  802c22:	03 45 08             	add    0x8(%ebp),%eax
+  802c25:	50                   	push   %eax
+  802c26:	e8 37 dd ff ff       	call   800962 <memmove>
+			f->f_rpos += m;
+  802c2b:	01 5e 14             	add    %ebx,0x14(%esi)
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	eb 1a                	jmp    802c4d <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802c33:	83 ec 04             	sub    $0x4,%esp
+  802c36:	53                   	push   %ebx
+  802c37:	89 f8                	mov    %edi,%eax
+  802c39:	03 45 08             	add    0x8(%ebp),%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	ff 36                	push   (%esi)
+  802c3f:	e8 86 ef ff ff       	call   801bca <read>
+  802c44:	89 c3                	mov    %eax,%ebx
+  802c46:	83 c4 10             	add    $0x10,%esp
+  802c49:	85 c0                	test   %eax,%eax
+  802c4b:	7e 36                	jle    802c83 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802c4d:	01 df                	add    %ebx,%edi
+  802c4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c52:	39 c7                	cmp    %eax,%edi
+  802c54:	73 39                	jae    802c8f <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802c56:	8b 56 14             	mov    0x14(%esi),%edx
+  802c59:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c5c:	39 da                	cmp    %ebx,%edx
+  802c5e:	72 ac                	jb     802c0c <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802c60:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c63:	29 fb                	sub    %edi,%ebx
+  802c65:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802c68:	72 3e                	jb     802ca8 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802c6a:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802c6e:	74 1f                	je     802c8f <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802c70:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802c74:	74 bd                	je     802c33 <fread+0x4b>
+  802c76:	89 f0                	mov    %esi,%eax
+  802c78:	e8 2f fb ff ff       	call   8027ac <stream_drain>
+  802c7d:	85 c0                	test   %eax,%eax
+  802c7f:	79 b2                	jns    802c33 <fread+0x4b>
+  802c81:	eb 0c                	jmp    802c8f <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802c83:	c1 fb 1f             	sar    $0x1f,%ebx
+  802c86:	83 e3 04             	and    $0x4,%ebx
+  802c89:	83 c3 04             	add    $0x4,%ebx
+  802c8c:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	74 0a                	je     802ca0 <fread+0xb8>
+  802c96:	89 f8                	mov    %edi,%eax
+  802c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9d:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ca3:	5b                   	pop    %ebx
+  802ca4:	5e                   	pop    %esi
+  802ca5:	5f                   	pop    %edi
+  802ca6:	5d                   	pop    %ebp
+  802ca7:	c3                   	ret
+		} else if (!stream_fill(f))
+  802ca8:	89 f0                	mov    %esi,%eax
+  802caa:	e8 da fb ff ff       	call   802889 <stream_fill>
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	74 dc                	je     802c8f <fread+0xa7>
+			m = 0;
+  802cb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb8:	eb 93                	jmp    802c4d <fread+0x65>
+
+00802cba <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802cba:	55                   	push   %ebp
+  802cbb:	89 e5                	mov    %esp,%ebp
+  802cbd:	57                   	push   %edi
+  802cbe:	56                   	push   %esi
+  802cbf:	53                   	push   %ebx
+  802cc0:	83 ec 1c             	sub    $0x1c,%esp
+  802cc3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802cc6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cc9:	a8 02                	test   $0x2,%al
+  802ccb:	75 13                	jne    802ce0 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802ccd:	83 c8 08             	or     $0x8,%eax
+  802cd0:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdb:	5b                   	pop    %ebx
+  802cdc:	5e                   	pop    %esi
+  802cdd:	5f                   	pop    %edi
+  802cde:	5d                   	pop    %ebp
+  802cdf:	c3                   	ret
+	stream_setup(f);
+  802ce0:	89 d8                	mov    %ebx,%eax
+  802ce2:	e8 35 fb ff ff       	call   80281c <stream_setup>
+	want = size * n;
+  802ce7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cea:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802cee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802cf1:	89 d8                	mov    %ebx,%eax
+  802cf3:	e8 41 fa ff ff       	call   802739 <stream_unread>
+	for (done = 0; done < want; ) {
+  802cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802cfd:	84 c0                	test   %al,%al
+  802cff:	75 7b                	jne    802d7c <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802d01:	be 00 00 00 00       	mov    $0x0,%esi
+  802d06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d09:	39 fe                	cmp    %edi,%esi
+  802d0b:	73 24                	jae    802d31 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d0d:	83 ec 04             	sub    $0x4,%esp
+  802d10:	89 f8                	mov    %edi,%eax
+  802d12:	29 f0                	sub    %esi,%eax
+  802d14:	50                   	push   %eax
+  802d15:	89 f0                	mov    %esi,%eax
+  802d17:	03 45 08             	add    0x8(%ebp),%eax
+  802d1a:	50                   	push   %eax
+  802d1b:	ff 33                	push   (%ebx)
+  802d1d:	e8 a0 ef ff ff       	call   801cc2 <write>
+  802d22:	83 c4 10             	add    $0x10,%esp
+  802d25:	85 c0                	test   %eax,%eax
+  802d27:	7e 04                	jle    802d2d <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802d29:	01 c6                	add    %eax,%esi
+  802d2b:	eb dc                	jmp    802d09 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802d2d:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802d31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d34:	85 c0                	test   %eax,%eax
+  802d36:	74 a0                	je     802cd8 <fwrite+0x1e>
+  802d38:	89 f0                	mov    %esi,%eax
+  802d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d3f:	f7 75 0c             	divl   0xc(%ebp)
+  802d42:	eb 94                	jmp    802cd8 <fwrite+0x1e>
+			done += r;
+  802d44:	01 c7                	add    %eax,%edi
+			continue;
+  802d46:	eb 34                	jmp    802d7c <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802d48:	8b 73 10             	mov    0x10(%ebx),%esi
+  802d4b:	29 c6                	sub    %eax,%esi
+  802d4d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d50:	29 fa                	sub    %edi,%edx
+  802d52:	39 d6                	cmp    %edx,%esi
+  802d54:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802d57:	83 ec 04             	sub    $0x4,%esp
+  802d5a:	56                   	push   %esi
+  802d5b:	89 fa                	mov    %edi,%edx
+  802d5d:	03 55 08             	add    0x8(%ebp),%edx
+  802d60:	52                   	push   %edx
+  802d61:	03 43 0c             	add    0xc(%ebx),%eax
+  802d64:	50                   	push   %eax
+  802d65:	e8 f8 db ff ff       	call   800962 <memmove>
+		f->f_wend += m;
+  802d6a:	89 f0                	mov    %esi,%eax
+  802d6c:	03 43 1c             	add    0x1c(%ebx),%eax
+  802d6f:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802d72:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d74:	83 c4 10             	add    $0x10,%esp
+  802d77:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802d7a:	74 5b                	je     802dd7 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802d7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d7f:	39 c7                	cmp    %eax,%edi
+  802d81:	73 2d                	jae    802db0 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802d83:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	75 be                	jne    802d48 <fwrite+0x8e>
+  802d8a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d8d:	29 fa                	sub    %edi,%edx
+  802d8f:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802d92:	72 b4                	jb     802d48 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	52                   	push   %edx
+  802d98:	89 f8                	mov    %edi,%eax
+  802d9a:	03 45 08             	add    0x8(%ebp),%eax
+  802d9d:	50                   	push   %eax
+  802d9e:	ff 33                	push   (%ebx)
+  802da0:	e8 1d ef ff ff       	call   801cc2 <write>
+  802da5:	83 c4 10             	add    $0x10,%esp
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	7f 98                	jg     802d44 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802dac:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802db0:	8b 43 08             	mov    0x8(%ebx),%eax
+  802db3:	83 f8 03             	cmp    $0x3,%eax
+  802db6:	74 48                	je     802e00 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802db8:	83 f8 02             	cmp    $0x2,%eax
+  802dbb:	74 27                	je     802de4 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802dbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	0f 84 10 ff ff ff    	je     802cd8 <fwrite+0x1e>
+  802dc8:	89 f8                	mov    %edi,%eax
+  802dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dcf:	f7 75 0c             	divl   0xc(%ebp)
+  802dd2:	e9 01 ff ff ff       	jmp    802cd8 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802dd7:	89 d8                	mov    %ebx,%eax
+  802dd9:	e8 ce f9 ff ff       	call   8027ac <stream_drain>
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	79 9a                	jns    802d7c <fwrite+0xc2>
+  802de2:	eb cc                	jmp    802db0 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	57                   	push   %edi
+  802de8:	6a 0a                	push   $0xa
+  802dea:	ff 75 08             	push   0x8(%ebp)
+  802ded:	e8 21 dc ff ff       	call   800a13 <memfind>
+  802df2:	89 c2                	mov    %eax,%edx
+  802df4:	89 f8                	mov    %edi,%eax
+  802df6:	03 45 08             	add    0x8(%ebp),%eax
+  802df9:	83 c4 10             	add    $0x10,%esp
+  802dfc:	39 c2                	cmp    %eax,%edx
+  802dfe:	74 bd                	je     802dbd <fwrite+0x103>
+		stream_drain(f);
+  802e00:	89 d8                	mov    %ebx,%eax
+  802e02:	e8 a5 f9 ff ff       	call   8027ac <stream_drain>
+  802e07:	eb b4                	jmp    802dbd <fwrite+0x103>
+
+00802e09 <fputc>:
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	53                   	push   %ebx
+  802e0d:	83 ec 14             	sub    $0x14,%esp
+  802e10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802e13:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802e16:	ff 75 0c             	push   0xc(%ebp)
+  802e19:	6a 01                	push   $0x1
+  802e1b:	6a 01                	push   $0x1
+  802e1d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e20:	50                   	push   %eax
+  802e21:	e8 94 fe ff ff       	call   802cba <fwrite>
+  802e26:	83 c4 10             	add    $0x10,%esp
+  802e29:	0f b6 db             	movzbl %bl,%ebx
+  802e2c:	83 f8 01             	cmp    $0x1,%eax
+  802e2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e34:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+
+00802e3c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802e42:	ff 75 0c             	push   0xc(%ebp)
+  802e45:	ff 75 08             	push   0x8(%ebp)
+  802e48:	e8 bc ff ff ff       	call   802e09 <fputc>
+}
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	c9                   	leave
+  802e51:	c3                   	ret
+
+00802e52 <fputs>:
+{
+  802e52:	55                   	push   %ebp
+  802e53:	89 e5                	mov    %esp,%ebp
+  802e55:	56                   	push   %esi
+  802e56:	53                   	push   %ebx
+  802e57:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802e5a:	83 ec 0c             	sub    $0xc,%esp
+  802e5d:	56                   	push   %esi
+  802e5e:	e8 3e d9 ff ff       	call   8007a1 <strlen>
+  802e63:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802e65:	ff 75 0c             	push   0xc(%ebp)
+  802e68:	50                   	push   %eax
+  802e69:	6a 01                	push   $0x1
+  802e6b:	56                   	push   %esi
+  802e6c:	e8 49 fe ff ff       	call   802cba <fwrite>
+  802e71:	83 c4 20             	add    $0x20,%esp
+  802e74:	39 d8                	cmp    %ebx,%eax
+  802e76:	0f 95 c0             	setne  %al
+  802e79:	0f b6 c0             	movzbl %al,%eax
+  802e7c:	f7 d8                	neg    %eax
+}
+  802e7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e81:	5b                   	pop    %ebx
+  802e82:	5e                   	pop    %esi
+  802e83:	5d                   	pop    %ebp
+  802e84:	c3                   	ret
+
+00802e85 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802e85:	55                   	push   %ebp
+  802e86:	89 e5                	mov    %esp,%ebp
+  802e88:	53                   	push   %ebx
+  802e89:	83 ec 04             	sub    $0x4,%esp
+  802e8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e8f:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802e92:	50                   	push   %eax
+  802e93:	ff 75 0c             	push   0xc(%ebp)
+  802e96:	53                   	push   %ebx
+  802e97:	68 3c 2e 80 00       	push   $0x802e3c
+  802e9c:	e8 4e d4 ff ff       	call   8002ef <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802ea1:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ea4:	c1 e0 1c             	shl    $0x1c,%eax
+  802ea7:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ead:	c9                   	leave
+  802eae:	c3                   	ret
+
+00802eaf <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802eaf:	55                   	push   %ebp
+  802eb0:	89 e5                	mov    %esp,%ebp
+  802eb2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802eb5:	68 fc 4d 80 00       	push   $0x804dfc
+  802eba:	ff 75 0c             	push   0xc(%ebp)
+  802ebd:	e8 1a d9 ff ff       	call   8007dc <strcpy>
+	return 0;
+}
+  802ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec7:	c9                   	leave
+  802ec8:	c3                   	ret
+
+00802ec9 <devsock_close>:
+{
+  802ec9:	55                   	push   %ebp
+  802eca:	89 e5                	mov    %esp,%ebp
+  802ecc:	53                   	push   %ebx
+  802ecd:	83 ec 10             	sub    $0x10,%esp
+  802ed0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ed3:	53                   	push   %ebx
+  802ed4:	e8 cc 15 00 00       	call   8044a5 <pageref>
+  802ed9:	89 c2                	mov    %eax,%edx
+  802edb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ee3:	83 fa 01             	cmp    $0x1,%edx
+  802ee6:	74 05                	je     802eed <devsock_close+0x24>
+}
+  802ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eeb:	c9                   	leave
+  802eec:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802eed:	83 ec 0c             	sub    $0xc,%esp
+  802ef0:	ff 73 0c             	push   0xc(%ebx)
+  802ef3:	e8 b7 02 00 00       	call   8031af <nsipc_close>
+  802ef8:	83 c4 10             	add    $0x10,%esp
+  802efb:	eb eb                	jmp    802ee8 <devsock_close+0x1f>
+
+00802efd <devsock_write>:
+{
+  802efd:	55                   	push   %ebp
+  802efe:	89 e5                	mov    %esp,%ebp
+  802f00:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802f03:	6a 00                	push   $0x0
+  802f05:	ff 75 10             	push   0x10(%ebp)
+  802f08:	ff 75 0c             	push   0xc(%ebp)
+  802f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0e:	ff 70 0c             	push   0xc(%eax)
+  802f11:	e8 79 03 00 00       	call   80328f <nsipc_send>
+}
+  802f16:	c9                   	leave
+  802f17:	c3                   	ret
+
+00802f18 <devsock_read>:
+{
+  802f18:	55                   	push   %ebp
+  802f19:	89 e5                	mov    %esp,%ebp
+  802f1b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802f1e:	6a 00                	push   $0x0
+  802f20:	ff 75 10             	push   0x10(%ebp)
+  802f23:	ff 75 0c             	push   0xc(%ebp)
+  802f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f29:	ff 70 0c             	push   0xc(%eax)
+  802f2c:	e8 ef 02 00 00       	call   803220 <nsipc_recv>
+}
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+00802f33 <fd2sockid>:
+{
+  802f33:	55                   	push   %ebp
+  802f34:	89 e5                	mov    %esp,%ebp
+  802f36:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802f39:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f3c:	52                   	push   %edx
+  802f3d:	50                   	push   %eax
+  802f3e:	e8 f7 e9 ff ff       	call   80193a <fd_lookup>
+  802f43:	83 c4 10             	add    $0x10,%esp
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	78 10                	js     802f5a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f4d:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802f53:	39 08                	cmp    %ecx,(%eax)
+  802f55:	75 05                	jne    802f5c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f57:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f5a:	c9                   	leave
+  802f5b:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f61:	eb f7                	jmp    802f5a <fd2sockid+0x27>
+
+00802f63 <alloc_sockfd>:
+{
+  802f63:	55                   	push   %ebp
+  802f64:	89 e5                	mov    %esp,%ebp
+  802f66:	56                   	push   %esi
+  802f67:	53                   	push   %ebx
+  802f68:	83 ec 1c             	sub    $0x1c,%esp
+  802f6b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f70:	50                   	push   %eax
+  802f71:	e8 6e e9 ff ff       	call   8018e4 <fd_alloc>
+  802f76:	89 c3                	mov    %eax,%ebx
+  802f78:	83 c4 10             	add    $0x10,%esp
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	78 43                	js     802fc2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f7f:	83 ec 04             	sub    $0x4,%esp
+  802f82:	68 07 04 00 00       	push   $0x407
+  802f87:	ff 75 f4             	push   -0xc(%ebp)
+  802f8a:	6a 00                	push   $0x0
+  802f8c:	e8 89 dc ff ff       	call   800c1a <sys_page_alloc>
+  802f91:	89 c3                	mov    %eax,%ebx
+  802f93:	83 c4 10             	add    $0x10,%esp
+  802f96:	85 c0                	test   %eax,%eax
+  802f98:	78 28                	js     802fc2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f9d:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802fa3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802fa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fa8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802faf:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802fb2:	83 ec 0c             	sub    $0xc,%esp
+  802fb5:	50                   	push   %eax
+  802fb6:	e8 02 e9 ff ff       	call   8018bd <fd2num>
+  802fbb:	89 c3                	mov    %eax,%ebx
+  802fbd:	83 c4 10             	add    $0x10,%esp
+  802fc0:	eb 0c                	jmp    802fce <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802fc2:	83 ec 0c             	sub    $0xc,%esp
+  802fc5:	56                   	push   %esi
+  802fc6:	e8 e4 01 00 00       	call   8031af <nsipc_close>
+		return r;
+  802fcb:	83 c4 10             	add    $0x10,%esp
+}
+  802fce:	89 d8                	mov    %ebx,%eax
+  802fd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5d                   	pop    %ebp
+  802fd6:	c3                   	ret
+
+00802fd7 <accept>:
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe0:	e8 4e ff ff ff       	call   802f33 <fd2sockid>
+  802fe5:	85 c0                	test   %eax,%eax
+  802fe7:	78 1b                	js     803004 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802fe9:	83 ec 04             	sub    $0x4,%esp
+  802fec:	ff 75 10             	push   0x10(%ebp)
+  802fef:	ff 75 0c             	push   0xc(%ebp)
+  802ff2:	50                   	push   %eax
+  802ff3:	e8 0e 01 00 00       	call   803106 <nsipc_accept>
+  802ff8:	83 c4 10             	add    $0x10,%esp
+  802ffb:	85 c0                	test   %eax,%eax
+  802ffd:	78 05                	js     803004 <accept+0x2d>
+	return alloc_sockfd(r);
+  802fff:	e8 5f ff ff ff       	call   802f63 <alloc_sockfd>
+}
+  803004:	c9                   	leave
+  803005:	c3                   	ret
+
+00803006 <bind>:
+{
+  803006:	55                   	push   %ebp
+  803007:	89 e5                	mov    %esp,%ebp
+  803009:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80300c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80300f:	e8 1f ff ff ff       	call   802f33 <fd2sockid>
+  803014:	85 c0                	test   %eax,%eax
+  803016:	78 12                	js     80302a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803018:	83 ec 04             	sub    $0x4,%esp
+  80301b:	ff 75 10             	push   0x10(%ebp)
+  80301e:	ff 75 0c             	push   0xc(%ebp)
+  803021:	50                   	push   %eax
+  803022:	e8 31 01 00 00       	call   803158 <nsipc_bind>
+  803027:	83 c4 10             	add    $0x10,%esp
+}
+  80302a:	c9                   	leave
+  80302b:	c3                   	ret
+
+0080302c <shutdown>:
+{
+  80302c:	55                   	push   %ebp
+  80302d:	89 e5                	mov    %esp,%ebp
+  80302f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803032:	8b 45 08             	mov    0x8(%ebp),%eax
+  803035:	e8 f9 fe ff ff       	call   802f33 <fd2sockid>
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	78 0f                	js     80304d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80303e:	83 ec 08             	sub    $0x8,%esp
+  803041:	ff 75 0c             	push   0xc(%ebp)
+  803044:	50                   	push   %eax
+  803045:	e8 43 01 00 00       	call   80318d <nsipc_shutdown>
+  80304a:	83 c4 10             	add    $0x10,%esp
+}
+  80304d:	c9                   	leave
+  80304e:	c3                   	ret
+
+0080304f <connect>:
+{
+  80304f:	55                   	push   %ebp
+  803050:	89 e5                	mov    %esp,%ebp
+  803052:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803055:	8b 45 08             	mov    0x8(%ebp),%eax
+  803058:	e8 d6 fe ff ff       	call   802f33 <fd2sockid>
+  80305d:	85 c0                	test   %eax,%eax
+  80305f:	78 12                	js     803073 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803061:	83 ec 04             	sub    $0x4,%esp
+  803064:	ff 75 10             	push   0x10(%ebp)
+  803067:	ff 75 0c             	push   0xc(%ebp)
+  80306a:	50                   	push   %eax
+  80306b:	e8 59 01 00 00       	call   8031c9 <nsipc_connect>
+  803070:	83 c4 10             	add    $0x10,%esp
+}
+  803073:	c9                   	leave
+  803074:	c3                   	ret
+
+00803075 <listen>:
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80307b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307e:	e8 b0 fe ff ff       	call   802f33 <fd2sockid>
+  803083:	85 c0                	test   %eax,%eax
+  803085:	78 0f                	js     803096 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803087:	83 ec 08             	sub    $0x8,%esp
+  80308a:	ff 75 0c             	push   0xc(%ebp)
+  80308d:	50                   	push   %eax
+  80308e:	e8 6b 01 00 00       	call   8031fe <nsipc_listen>
+  803093:	83 c4 10             	add    $0x10,%esp
+}
+  803096:	c9                   	leave
+  803097:	c3                   	ret
+
+00803098 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803098:	55                   	push   %ebp
+  803099:	89 e5                	mov    %esp,%ebp
+  80309b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80309e:	ff 75 10             	push   0x10(%ebp)
+  8030a1:	ff 75 0c             	push   0xc(%ebp)
+  8030a4:	ff 75 08             	push   0x8(%ebp)
+  8030a7:	e8 41 02 00 00       	call   8032ed <nsipc_socket>
+  8030ac:	83 c4 10             	add    $0x10,%esp
+  8030af:	85 c0                	test   %eax,%eax
+  8030b1:	78 05                	js     8030b8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8030b3:	e8 ab fe ff ff       	call   802f63 <alloc_sockfd>
+}
+  8030b8:	c9                   	leave
+  8030b9:	c3                   	ret
+
+008030ba <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8030ba:	55                   	push   %ebp
+  8030bb:	89 e5                	mov    %esp,%ebp
+  8030bd:	53                   	push   %ebx
+  8030be:	83 ec 04             	sub    $0x4,%esp
+  8030c1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8030c3:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8030ca:	74 26                	je     8030f2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8030cc:	6a 07                	push   $0x7
+  8030ce:	68 00 80 80 00       	push   $0x808000
+  8030d3:	53                   	push   %ebx
+  8030d4:	ff 35 08 60 80 00    	push   0x806008
+  8030da:	e8 49 e7 ff ff       	call   801828 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8030df:	83 c4 0c             	add    $0xc,%esp
+  8030e2:	6a 00                	push   $0x0
+  8030e4:	6a 00                	push   $0x0
+  8030e6:	6a 00                	push   $0x0
+  8030e8:	e8 45 e6 ff ff       	call   801732 <ipc_recv>
+}
+  8030ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f0:	c9                   	leave
+  8030f1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8030f2:	83 ec 0c             	sub    $0xc,%esp
+  8030f5:	6a 02                	push   $0x2
+  8030f7:	e8 82 e7 ff ff       	call   80187e <ipc_find_env>
+  8030fc:	a3 08 60 80 00       	mov    %eax,0x806008
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	eb c6                	jmp    8030cc <nsipc+0x12>
+
+00803106 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803106:	55                   	push   %ebp
+  803107:	89 e5                	mov    %esp,%ebp
+  803109:	56                   	push   %esi
+  80310a:	53                   	push   %ebx
+  80310b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80310e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803111:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803116:	8b 06                	mov    (%esi),%eax
+  803118:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80311d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803122:	e8 93 ff ff ff       	call   8030ba <nsipc>
+  803127:	89 c3                	mov    %eax,%ebx
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	79 09                	jns    803136 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80312d:	89 d8                	mov    %ebx,%eax
+  80312f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803132:	5b                   	pop    %ebx
+  803133:	5e                   	pop    %esi
+  803134:	5d                   	pop    %ebp
+  803135:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803136:	83 ec 04             	sub    $0x4,%esp
+  803139:	ff 35 10 80 80 00    	push   0x808010
+  80313f:	68 00 80 80 00       	push   $0x808000
+  803144:	ff 75 0c             	push   0xc(%ebp)
+  803147:	e8 16 d8 ff ff       	call   800962 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80314c:	a1 10 80 80 00       	mov    0x808010,%eax
+  803151:	89 06                	mov    %eax,(%esi)
+  803153:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803156:	eb d5                	jmp    80312d <nsipc_accept+0x27>
+
+00803158 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803158:	55                   	push   %ebp
+  803159:	89 e5                	mov    %esp,%ebp
+  80315b:	53                   	push   %ebx
+  80315c:	83 ec 08             	sub    $0x8,%esp
+  80315f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803162:	8b 45 08             	mov    0x8(%ebp),%eax
+  803165:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80316a:	53                   	push   %ebx
+  80316b:	ff 75 0c             	push   0xc(%ebp)
+  80316e:	68 04 80 80 00       	push   $0x808004
+  803173:	e8 ea d7 ff ff       	call   800962 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803178:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80317e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803183:	e8 32 ff ff ff       	call   8030ba <nsipc>
+}
+  803188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+
+0080318d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80318d:	55                   	push   %ebp
+  80318e:	89 e5                	mov    %esp,%ebp
+  803190:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803193:	8b 45 08             	mov    0x8(%ebp),%eax
+  803196:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80319b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80319e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8031a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8031a8:	e8 0d ff ff ff       	call   8030ba <nsipc>
+}
+  8031ad:	c9                   	leave
+  8031ae:	c3                   	ret
+
+008031af <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8031af:	55                   	push   %ebp
+  8031b0:	89 e5                	mov    %esp,%ebp
+  8031b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8031b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8031bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8031c2:	e8 f3 fe ff ff       	call   8030ba <nsipc>
+}
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+
+008031c9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8031c9:	55                   	push   %ebp
+  8031ca:	89 e5                	mov    %esp,%ebp
+  8031cc:	53                   	push   %ebx
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8031d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d6:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8031db:	53                   	push   %ebx
+  8031dc:	ff 75 0c             	push   0xc(%ebp)
+  8031df:	68 04 80 80 00       	push   $0x808004
+  8031e4:	e8 79 d7 ff ff       	call   800962 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8031e9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8031ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8031f4:	e8 c1 fe ff ff       	call   8030ba <nsipc>
+}
+  8031f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031fc:	c9                   	leave
+  8031fd:	c3                   	ret
+
+008031fe <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8031fe:	55                   	push   %ebp
+  8031ff:	89 e5                	mov    %esp,%ebp
+  803201:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803204:	8b 45 08             	mov    0x8(%ebp),%eax
+  803207:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80320c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80320f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  803214:	b8 06 00 00 00       	mov    $0x6,%eax
+  803219:	e8 9c fe ff ff       	call   8030ba <nsipc>
+}
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+00803220 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+  803223:	56                   	push   %esi
+  803224:	53                   	push   %ebx
+  803225:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803228:	8b 45 08             	mov    0x8(%ebp),%eax
+  80322b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803230:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  803236:	8b 45 14             	mov    0x14(%ebp),%eax
+  803239:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80323e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803243:	e8 72 fe ff ff       	call   8030ba <nsipc>
+  803248:	89 c3                	mov    %eax,%ebx
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	78 22                	js     803270 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80324e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803253:	39 c6                	cmp    %eax,%esi
+  803255:	0f 4e c6             	cmovle %esi,%eax
+  803258:	39 c3                	cmp    %eax,%ebx
+  80325a:	7f 1d                	jg     803279 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80325c:	83 ec 04             	sub    $0x4,%esp
+  80325f:	53                   	push   %ebx
+  803260:	68 00 80 80 00       	push   $0x808000
+  803265:	ff 75 0c             	push   0xc(%ebp)
+  803268:	e8 f5 d6 ff ff       	call   800962 <memmove>
+  80326d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803270:	89 d8                	mov    %ebx,%eax
+  803272:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803275:	5b                   	pop    %ebx
+  803276:	5e                   	pop    %esi
+  803277:	5d                   	pop    %ebp
+  803278:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803279:	68 08 4e 80 00       	push   $0x804e08
+  80327e:	68 b1 4c 80 00       	push   $0x804cb1
+  803283:	6a 62                	push   $0x62
+  803285:	68 1d 4e 80 00       	push   $0x804e1d
+  80328a:	e8 6c 11 00 00       	call   8043fb <_panic>
+
+0080328f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80328f:	55                   	push   %ebp
+  803290:	89 e5                	mov    %esp,%ebp
+  803292:	53                   	push   %ebx
+  803293:	83 ec 04             	sub    $0x4,%esp
+  803296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803299:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8032a1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8032a7:	7f 2e                	jg     8032d7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8032a9:	83 ec 04             	sub    $0x4,%esp
+  8032ac:	53                   	push   %ebx
+  8032ad:	ff 75 0c             	push   0xc(%ebp)
+  8032b0:	68 0c 80 80 00       	push   $0x80800c
+  8032b5:	e8 a8 d6 ff ff       	call   800962 <memmove>
+	nsipcbuf.send.req_size = size;
+  8032ba:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8032c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032c3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8032c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8032cd:	e8 e8 fd ff ff       	call   8030ba <nsipc>
+}
+  8032d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d5:	c9                   	leave
+  8032d6:	c3                   	ret
+	assert(size < 1600);
+  8032d7:	68 29 4e 80 00       	push   $0x804e29
+  8032dc:	68 b1 4c 80 00       	push   $0x804cb1
+  8032e1:	6a 6d                	push   $0x6d
+  8032e3:	68 1d 4e 80 00       	push   $0x804e1d
+  8032e8:	e8 0e 11 00 00       	call   8043fb <_panic>
+
+008032ed <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8032ed:	55                   	push   %ebp
+  8032ee:	89 e5                	mov    %esp,%ebp
+  8032f0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8032f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8032fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032fe:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803303:	8b 45 10             	mov    0x10(%ebp),%eax
+  803306:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80330b:	b8 09 00 00 00       	mov    $0x9,%eax
+  803310:	e8 a5 fd ff ff       	call   8030ba <nsipc>
+}
+  803315:	c9                   	leave
+  803316:	c3                   	ret
+
+00803317 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	53                   	push   %ebx
+  80331b:	83 ec 10             	sub    $0x10,%esp
+  80331e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803321:	68 0c 60 80 00       	push   $0x80600c
+  803326:	e8 50 07 00 00       	call   803a7b <mutex_lock>
+	if (v == 0)
+  80332b:	83 c4 10             	add    $0x10,%esp
+  80332e:	85 db                	test   %ebx,%ebx
+  803330:	0f 84 85 00 00 00    	je     8033bb <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803336:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80333c:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803341:	77 51                	ja     803394 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803343:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803349:	89 d8                	mov    %ebx,%eax
+  80334b:	c1 e8 0c             	shr    $0xc,%eax
+  80334e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803355:	f6 c4 02             	test   $0x2,%ah
+  803358:	74 50                	je     8033aa <free+0x93>
+		sys_page_unmap(0, c);
+  80335a:	83 ec 08             	sub    $0x8,%esp
+  80335d:	53                   	push   %ebx
+  80335e:	6a 00                	push   $0x0
+  803360:	e8 4e d9 ff ff       	call   800cb3 <sys_page_unmap>
+		c += PGSIZE;
+  803365:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80336b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803371:	83 c4 10             	add    $0x10,%esp
+  803374:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803379:	76 ce                	jbe    803349 <free+0x32>
+  80337b:	68 73 4e 80 00       	push   $0x804e73
+  803380:	68 b1 4c 80 00       	push   $0x804cb1
+  803385:	68 82 00 00 00       	push   $0x82
+  80338a:	68 66 4e 80 00       	push   $0x804e66
+  80338f:	e8 67 10 00 00       	call   8043fb <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803394:	68 38 4e 80 00       	push   $0x804e38
+  803399:	68 b1 4c 80 00       	push   $0x804cb1
+  80339e:	6a 7b                	push   $0x7b
+  8033a0:	68 66 4e 80 00       	push   $0x804e66
+  8033a5:	e8 51 10 00 00       	call   8043fb <_panic>
+	if (--(*ref) == 0)
+  8033aa:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8033b0:	83 e8 01             	sub    $0x1,%eax
+  8033b3:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8033b9:	74 15                	je     8033d0 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8033bb:	83 ec 0c             	sub    $0xc,%esp
+  8033be:	68 0c 60 80 00       	push   $0x80600c
+  8033c3:	e8 20 07 00 00       	call   803ae8 <mutex_unlock>
+}
+  8033c8:	83 c4 10             	add    $0x10,%esp
+  8033cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+		sys_page_unmap(0, c);
+  8033d0:	83 ec 08             	sub    $0x8,%esp
+  8033d3:	53                   	push   %ebx
+  8033d4:	6a 00                	push   $0x0
+  8033d6:	e8 d8 d8 ff ff       	call   800cb3 <sys_page_unmap>
+  8033db:	83 c4 10             	add    $0x10,%esp
+  8033de:	eb db                	jmp    8033bb <free+0xa4>
+
+008033e0 <malloc>:
+{
+  8033e0:	55                   	push   %ebp
+  8033e1:	89 e5                	mov    %esp,%ebp
+  8033e3:	57                   	push   %edi
+  8033e4:	56                   	push   %esi
+  8033e5:	53                   	push   %ebx
+  8033e6:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8033e9:	68 0c 60 80 00       	push   $0x80600c
+  8033ee:	e8 88 06 00 00       	call   803a7b <mutex_lock>
+	if (mptr == 0)
+  8033f3:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8033f9:	83 c4 10             	add    $0x10,%esp
+  8033fc:	85 ff                	test   %edi,%edi
+  8033fe:	74 6c                	je     80346c <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803400:	8b 45 08             	mov    0x8(%ebp),%eax
+  803403:	83 c0 03             	add    $0x3,%eax
+  803406:	83 e0 fc             	and    $0xfffffffc,%eax
+  803409:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80340b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803410:	0f 87 64 01 00 00    	ja     80357a <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803416:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80341c:	74 30                	je     80344e <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80341e:	89 f9                	mov    %edi,%ecx
+  803420:	c1 e9 0c             	shr    $0xc,%ecx
+  803423:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803427:	c1 e8 0c             	shr    $0xc,%eax
+  80342a:	39 c1                	cmp    %eax,%ecx
+  80342c:	74 5f                	je     80348d <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  80342e:	83 ec 0c             	sub    $0xc,%esp
+  803431:	57                   	push   %edi
+  803432:	e8 e0 fe ff ff       	call   803317 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803437:	a1 10 60 80 00       	mov    0x806010,%eax
+  80343c:	05 00 10 00 00       	add    $0x1000,%eax
+  803441:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803446:	a3 10 60 80 00       	mov    %eax,0x806010
+  80344b:	83 c4 10             	add    $0x10,%esp
+  80344e:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  803454:	ba 02 00 00 00       	mov    $0x2,%edx
+  803459:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80345d:	8d 7e 04             	lea    0x4(%esi),%edi
+  803460:	89 cb                	mov    %ecx,%ebx
+  803462:	01 f9                	add    %edi,%ecx
+  803464:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803467:	e9 8b 00 00 00       	jmp    8034f7 <malloc+0x117>
+		mptr = mbegin;
+  80346c:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  803473:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803476:	8b 45 08             	mov    0x8(%ebp),%eax
+  803479:	83 c0 03             	add    $0x3,%eax
+  80347c:	83 e0 fc             	and    $0xfffffffc,%eax
+  80347f:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803481:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803486:	76 c6                	jbe    80344e <malloc+0x6e>
+  803488:	e9 d6 00 00 00       	jmp    803563 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80348d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803493:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803498:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80349c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80349f:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  8034a4:	e9 ba 00 00 00       	jmp    803563 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034a9:	05 00 10 00 00       	add    $0x1000,%eax
+  8034ae:	39 c8                	cmp    %ecx,%eax
+  8034b0:	0f 83 cb 00 00 00    	jae    803581 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8034b6:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8034bb:	77 22                	ja     8034df <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8034bd:	89 c2                	mov    %eax,%edx
+  8034bf:	c1 ea 16             	shr    $0x16,%edx
+  8034c2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8034c9:	f6 c2 01             	test   $0x1,%dl
+  8034cc:	74 db                	je     8034a9 <malloc+0xc9>
+  8034ce:	89 c2                	mov    %eax,%edx
+  8034d0:	c1 ea 0c             	shr    $0xc,%edx
+  8034d3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8034da:	f6 c2 01             	test   $0x1,%dl
+  8034dd:	74 ca                	je     8034a9 <malloc+0xc9>
+		if (mptr == mend) {
+  8034df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034e5:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8034eb:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8034ef:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8034f5:	74 04                	je     8034fb <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034f7:	89 d8                	mov    %ebx,%eax
+  8034f9:	eb b3                	jmp    8034ae <malloc+0xce>
+  8034fb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8034fe:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803503:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803507:	83 ea 01             	sub    $0x1,%edx
+  80350a:	0f 85 50 ff ff ff    	jne    803460 <malloc+0x80>
+  803510:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  803517:	00 00 08 
+				return 0;	/* out of address space */
+  80351a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351f:	eb 42                	jmp    803563 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803521:	85 db                	test   %ebx,%ebx
+  803523:	78 1e                	js     803543 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803525:	83 ec 08             	sub    $0x8,%esp
+  803528:	89 d8                	mov    %ebx,%eax
+  80352a:	03 05 10 60 80 00    	add    0x806010,%eax
+  803530:	50                   	push   %eax
+  803531:	6a 00                	push   $0x0
+  803533:	e8 7b d7 ff ff       	call   800cb3 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803538:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	eb de                	jmp    803521 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803543:	bf 00 00 00 00       	mov    $0x0,%edi
+  803548:	eb 19                	jmp    803563 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80354a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80354d:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803553:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80355a:	00 
+	mptr += n;
+  80355b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80355e:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  803563:	83 ec 0c             	sub    $0xc,%esp
+  803566:	68 0c 60 80 00       	push   $0x80600c
+  80356b:	e8 78 05 00 00       	call   803ae8 <mutex_unlock>
+}
+  803570:	89 f8                	mov    %edi,%eax
+  803572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803575:	5b                   	pop    %ebx
+  803576:	5e                   	pop    %esi
+  803577:	5f                   	pop    %edi
+  803578:	5d                   	pop    %ebp
+  803579:	c3                   	ret
+		return 0;
+  80357a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357f:	eb e2                	jmp    803563 <malloc+0x183>
+  803581:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803585:	74 06                	je     80358d <malloc+0x1ad>
+  803587:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80358d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803592:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803595:	39 fb                	cmp    %edi,%ebx
+  803597:	73 b1                	jae    80354a <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803599:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80359f:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8035a2:	39 fe                	cmp    %edi,%esi
+  8035a4:	0f 92 c0             	setb   %al
+  8035a7:	0f b6 c0             	movzbl %al,%eax
+  8035aa:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8035ad:	83 c8 07             	or     $0x7,%eax
+  8035b0:	50                   	push   %eax
+  8035b1:	89 d8                	mov    %ebx,%eax
+  8035b3:	03 05 10 60 80 00    	add    0x806010,%eax
+  8035b9:	50                   	push   %eax
+  8035ba:	6a 00                	push   $0x0
+  8035bc:	e8 59 d6 ff ff       	call   800c1a <sys_page_alloc>
+  8035c1:	83 c4 10             	add    $0x10,%esp
+  8035c4:	85 c0                	test   %eax,%eax
+  8035c6:	0f 88 55 ff ff ff    	js     803521 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8035cc:	89 f3                	mov    %esi,%ebx
+  8035ce:	eb c5                	jmp    803595 <malloc+0x1b5>
+
+008035d0 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035d0:	55                   	push   %ebp
+  8035d1:	89 e5                	mov    %esp,%ebp
+  8035d3:	56                   	push   %esi
+  8035d4:	53                   	push   %ebx
+  8035d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035d8:	83 ec 0c             	sub    $0xc,%esp
+  8035db:	ff 75 08             	push   0x8(%ebp)
+  8035de:	e8 ea e2 ff ff       	call   8018cd <fd2data>
+  8035e3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8035e5:	83 c4 08             	add    $0x8,%esp
+  8035e8:	68 8b 4e 80 00       	push   $0x804e8b
+  8035ed:	53                   	push   %ebx
+  8035ee:	e8 e9 d1 ff ff       	call   8007dc <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8035f3:	8b 46 04             	mov    0x4(%esi),%eax
+  8035f6:	2b 06                	sub    (%esi),%eax
+  8035f8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8035fe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803605:	00 00 00 
+	stat->st_dev = &devpipe;
+  803608:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  80360f:	52 80 00 
+	return 0;
+}
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80361a:	5b                   	pop    %ebx
+  80361b:	5e                   	pop    %esi
+  80361c:	5d                   	pop    %ebp
+  80361d:	c3                   	ret
+
+0080361e <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80361e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803623:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803627:	85 c9                	test   %ecx,%ecx
+  803629:	75 01                	jne    80362c <pipewake+0xe>
+  80362b:	c3                   	ret
+{
+  80362c:	55                   	push   %ebp
+  80362d:	89 e5                	mov    %esp,%ebp
+  80362f:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803632:	68 00 04 00 00       	push   $0x400
+  803637:	52                   	push   %edx
+  803638:	e8 21 d9 ff ff       	call   800f5e <sys_futex_wake>
+  80363d:	83 c4 10             	add    $0x10,%esp
+}
+  803640:	c9                   	leave
+  803641:	c3                   	ret
+
+00803642 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803642:	55                   	push   %ebp
+  803643:	89 e5                	mov    %esp,%ebp
+  803645:	56                   	push   %esi
+  803646:	53                   	push   %ebx
+  803647:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80364a:	83 ec 0c             	sub    $0xc,%esp
+  80364d:	56                   	push   %esi
+  80364e:	e8 7a e2 ff ff       	call   8018cd <fd2data>
+  803653:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803655:	83 c4 08             	add    $0x8,%esp
+  803658:	56                   	push   %esi
+  803659:	6a 00                	push   $0x0
+  80365b:	e8 53 d6 ff ff       	call   800cb3 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803660:	8d 53 04             	lea    0x4(%ebx),%edx
+  803663:	8d 43 08             	lea    0x8(%ebx),%eax
+  803666:	e8 b3 ff ff ff       	call   80361e <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80366b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80366e:	89 da                	mov    %ebx,%edx
+  803670:	e8 a9 ff ff ff       	call   80361e <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803675:	89 34 24             	mov    %esi,(%esp)
+  803678:	e8 50 e2 ff ff       	call   8018cd <fd2data>
+  80367d:	83 c4 08             	add    $0x8,%esp
+  803680:	50                   	push   %eax
+  803681:	6a 00                	push   $0x0
+  803683:	e8 2b d6 ff ff       	call   800cb3 <sys_page_unmap>
+}
+  803688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80368b:	5b                   	pop    %ebx
+  80368c:	5e                   	pop    %esi
+  80368d:	5d                   	pop    %ebp
+  80368e:	c3                   	ret
+
+0080368f <_pipeisclosed>:
+{
+  80368f:	55                   	push   %ebp
+  803690:	89 e5                	mov    %esp,%ebp
+  803692:	57                   	push   %edi
+  803693:	56                   	push   %esi
+  803694:	53                   	push   %ebx
+  803695:	83 ec 1c             	sub    $0x1c,%esp
+  803698:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80369b:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80369d:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8036a2:	eb 5d                	jmp    803701 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8036a4:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  8036aa:	8b 02                	mov    (%edx),%eax
+  8036ac:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8036af:	83 ec 0c             	sub    $0xc,%esp
+  8036b2:	ff 75 e0             	push   -0x20(%ebp)
+  8036b5:	e8 eb 0d 00 00       	call   8044a5 <pageref>
+  8036ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036bd:	89 3c 24             	mov    %edi,(%esp)
+  8036c0:	e8 e0 0d 00 00       	call   8044a5 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8036c5:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036c7:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8036cd:	83 c4 10             	add    $0x10,%esp
+  8036d0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8036d6:	77 15                	ja     8036ed <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036d8:	89 f2                	mov    %esi,%edx
+  8036da:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8036dc:	c1 ea 10             	shr    $0x10,%edx
+  8036df:	74 0c                	je     8036ed <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036e1:	c1 e2 10             	shl    $0x10,%edx
+  8036e4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8036e9:	29 d1                	sub    %edx,%ecx
+  8036eb:	eb 06                	jmp    8036f3 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8036ed:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8036f3:	8b 11                	mov    (%ecx),%edx
+  8036f5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036f8:	39 d3                	cmp    %edx,%ebx
+  8036fa:	74 6e                	je     80376a <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8036fc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036ff:	74 24                	je     803725 <_pipeisclosed+0x96>
+  803701:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803703:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803709:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80370e:	77 94                	ja     8036a4 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803710:	89 f0                	mov    %esi,%eax
+  803712:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803714:	c1 e8 10             	shr    $0x10,%eax
+  803717:	74 8b                	je     8036a4 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803719:	c1 e0 10             	shl    $0x10,%eax
+  80371c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803721:	29 c2                	sub    %eax,%edx
+  803723:	eb 85                	jmp    8036aa <_pipeisclosed+0x1b>
+  803725:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803727:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80372d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803732:	77 18                	ja     80374c <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803734:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803739:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80373b:	c1 e8 10             	shr    $0x10,%eax
+  80373e:	74 0c                	je     80374c <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803740:	c1 e0 10             	shl    $0x10,%eax
+  803743:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803748:	29 c2                	sub    %eax,%edx
+  80374a:	eb 06                	jmp    803752 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80374c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803752:	8b 02                	mov    (%edx),%eax
+  803754:	8b 40 58             	mov    0x58(%eax),%eax
+  803757:	6a 01                	push   $0x1
+  803759:	50                   	push   %eax
+  80375a:	53                   	push   %ebx
+  80375b:	68 92 4e 80 00       	push   $0x804e92
+  803760:	e8 93 ca ff ff       	call   8001f8 <cprintf>
+  803765:	83 c4 10             	add    $0x10,%esp
+  803768:	eb 97                	jmp    803701 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80376a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80376d:	0f 94 c0             	sete   %al
+  803770:	0f b6 c0             	movzbl %al,%eax
+}
+  803773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803776:	5b                   	pop    %ebx
+  803777:	5e                   	pop    %esi
+  803778:	5f                   	pop    %edi
+  803779:	5d                   	pop    %ebp
+  80377a:	c3                   	ret
+
+0080377b <devpipe_write>:
+{
+  80377b:	55                   	push   %ebp
+  80377c:	89 e5                	mov    %esp,%ebp
+  80377e:	57                   	push   %edi
+  80377f:	56                   	push   %esi
+  803780:	53                   	push   %ebx
+  803781:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803784:	ff 75 08             	push   0x8(%ebp)
+  803787:	e8 41 e1 ff ff       	call   8018cd <fd2data>
+  80378c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80378e:	83 c4 10             	add    $0x10,%esp
+  803791:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803798:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80379b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80379e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8037a1:	0f 84 96 00 00 00    	je     80383d <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8037a7:	8d 73 08             	lea    0x8(%ebx),%esi
+  8037aa:	eb 32                	jmp    8037de <devpipe_write+0x63>
+  8037ac:	89 fa                	mov    %edi,%edx
+  8037ae:	89 f0                	mov    %esi,%eax
+  8037b0:	e8 69 fe ff ff       	call   80361e <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8037b5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037b8:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8037bb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037c0:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8037c5:	83 ec 04             	sub    $0x4,%esp
+  8037c8:	6a 0a                	push   $0xa
+  8037ca:	50                   	push   %eax
+  8037cb:	53                   	push   %ebx
+  8037cc:	e8 5e d7 ff ff       	call   800f2f <sys_futex_wait>
+  8037d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8037d6:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8037db:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8037de:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037e1:	8b 0b                	mov    (%ebx),%ecx
+  8037e3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8037e6:	39 d0                	cmp    %edx,%eax
+  8037e8:	72 1b                	jb     803805 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8037ea:	89 da                	mov    %ebx,%edx
+  8037ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ef:	e8 9b fe ff ff       	call   80368f <_pipeisclosed>
+  8037f4:	85 c0                	test   %eax,%eax
+  8037f6:	74 b4                	je     8037ac <devpipe_write+0x31>
+				return 0;
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803800:	5b                   	pop    %ebx
+  803801:	5e                   	pop    %esi
+  803802:	5f                   	pop    %edi
+  803803:	5d                   	pop    %ebp
+  803804:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803805:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803808:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80380b:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80380f:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803812:	89 c2                	mov    %eax,%edx
+  803814:	c1 fa 1f             	sar    $0x1f,%edx
+  803817:	89 d1                	mov    %edx,%ecx
+  803819:	c1 e9 1b             	shr    $0x1b,%ecx
+  80381c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80381f:	83 e2 1f             	and    $0x1f,%edx
+  803822:	29 ca                	sub    %ecx,%edx
+  803824:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803828:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80382c:	83 c0 01             	add    $0x1,%eax
+  80382f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803832:	83 c6 01             	add    $0x1,%esi
+  803835:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803838:	e9 5e ff ff ff       	jmp    80379b <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80383d:	8d 53 04             	lea    0x4(%ebx),%edx
+  803840:	8d 43 08             	lea    0x8(%ebx),%eax
+  803843:	e8 d6 fd ff ff       	call   80361e <pipewake>
+	return i;
+  803848:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80384b:	eb b0                	jmp    8037fd <devpipe_write+0x82>
+
+0080384d <devpipe_read>:
+{
+  80384d:	55                   	push   %ebp
+  80384e:	89 e5                	mov    %esp,%ebp
+  803850:	57                   	push   %edi
+  803851:	56                   	push   %esi
+  803852:	53                   	push   %ebx
+  803853:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803856:	ff 75 08             	push   0x8(%ebp)
+  803859:	e8 6f e0 ff ff       	call   8018cd <fd2data>
+  80385e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803860:	83 c4 10             	add    $0x10,%esp
+  803863:	be 00 00 00 00       	mov    $0x0,%esi
+  803868:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80386b:	74 6c                	je     8038d9 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80386d:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803870:	eb 25                	jmp    803897 <devpipe_read+0x4a>
+  803872:	8b 13                	mov    (%ebx),%edx
+  803874:	b8 01 00 00 00       	mov    $0x1,%eax
+  803879:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80387e:	83 ec 04             	sub    $0x4,%esp
+  803881:	6a 0a                	push   $0xa
+  803883:	52                   	push   %edx
+  803884:	57                   	push   %edi
+  803885:	e8 a5 d6 ff ff       	call   800f2f <sys_futex_wait>
+  80388a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80388f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803894:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803897:	8b 03                	mov    (%ebx),%eax
+  803899:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80389c:	75 19                	jne    8038b7 <devpipe_read+0x6a>
+			if (i > 0)
+  80389e:	85 f6                	test   %esi,%esi
+  8038a0:	75 3a                	jne    8038dc <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8038a2:	89 da                	mov    %ebx,%edx
+  8038a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038a7:	e8 e3 fd ff ff       	call   80368f <_pipeisclosed>
+  8038ac:	85 c0                	test   %eax,%eax
+  8038ae:	74 c2                	je     803872 <devpipe_read+0x25>
+				return 0;
+  8038b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b5:	eb 31                	jmp    8038e8 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038b7:	89 c1                	mov    %eax,%ecx
+  8038b9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8038bc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038bf:	01 c8                	add    %ecx,%eax
+  8038c1:	83 e0 1f             	and    $0x1f,%eax
+  8038c4:	29 c8                	sub    %ecx,%eax
+  8038c6:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8038cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038ce:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8038d1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8038d4:	83 c6 01             	add    $0x1,%esi
+  8038d7:	eb 8f                	jmp    803868 <devpipe_read+0x1b>
+out:
+  8038d9:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8038dc:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8038df:	89 da                	mov    %ebx,%edx
+  8038e1:	e8 38 fd ff ff       	call   80361e <pipewake>
+	return i;
+  8038e6:	89 f0                	mov    %esi,%eax
+}
+  8038e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038eb:	5b                   	pop    %ebx
+  8038ec:	5e                   	pop    %esi
+  8038ed:	5f                   	pop    %edi
+  8038ee:	5d                   	pop    %ebp
+  8038ef:	c3                   	ret
+
+008038f0 <pipe>:
+{
+  8038f0:	55                   	push   %ebp
+  8038f1:	89 e5                	mov    %esp,%ebp
+  8038f3:	56                   	push   %esi
+  8038f4:	53                   	push   %ebx
+  8038f5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8038f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038fb:	50                   	push   %eax
+  8038fc:	e8 e3 df ff ff       	call   8018e4 <fd_alloc>
+  803901:	89 c3                	mov    %eax,%ebx
+  803903:	83 c4 10             	add    $0x10,%esp
+  803906:	85 c0                	test   %eax,%eax
+  803908:	0f 88 23 01 00 00    	js     803a31 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80390e:	83 ec 04             	sub    $0x4,%esp
+  803911:	68 07 04 00 00       	push   $0x407
+  803916:	ff 75 f4             	push   -0xc(%ebp)
+  803919:	6a 00                	push   $0x0
+  80391b:	e8 fa d2 ff ff       	call   800c1a <sys_page_alloc>
+  803920:	89 c3                	mov    %eax,%ebx
+  803922:	83 c4 10             	add    $0x10,%esp
+  803925:	85 c0                	test   %eax,%eax
+  803927:	0f 88 04 01 00 00    	js     803a31 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80392d:	83 ec 0c             	sub    $0xc,%esp
+  803930:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803933:	50                   	push   %eax
+  803934:	e8 ab df ff ff       	call   8018e4 <fd_alloc>
+  803939:	89 c3                	mov    %eax,%ebx
+  80393b:	83 c4 10             	add    $0x10,%esp
+  80393e:	85 c0                	test   %eax,%eax
+  803940:	0f 88 db 00 00 00    	js     803a21 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803946:	83 ec 04             	sub    $0x4,%esp
+  803949:	68 07 04 00 00       	push   $0x407
+  80394e:	ff 75 f0             	push   -0x10(%ebp)
+  803951:	6a 00                	push   $0x0
+  803953:	e8 c2 d2 ff ff       	call   800c1a <sys_page_alloc>
+  803958:	89 c3                	mov    %eax,%ebx
+  80395a:	83 c4 10             	add    $0x10,%esp
+  80395d:	85 c0                	test   %eax,%eax
+  80395f:	0f 88 bc 00 00 00    	js     803a21 <pipe+0x131>
+	va = fd2data(fd0);
+  803965:	83 ec 0c             	sub    $0xc,%esp
+  803968:	ff 75 f4             	push   -0xc(%ebp)
+  80396b:	e8 5d df ff ff       	call   8018cd <fd2data>
+  803970:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803972:	83 c4 0c             	add    $0xc,%esp
+  803975:	68 07 04 00 00       	push   $0x407
+  80397a:	50                   	push   %eax
+  80397b:	6a 00                	push   $0x0
+  80397d:	e8 98 d2 ff ff       	call   800c1a <sys_page_alloc>
+  803982:	89 c3                	mov    %eax,%ebx
+  803984:	83 c4 10             	add    $0x10,%esp
+  803987:	85 c0                	test   %eax,%eax
+  803989:	0f 88 82 00 00 00    	js     803a11 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80398f:	83 ec 0c             	sub    $0xc,%esp
+  803992:	ff 75 f0             	push   -0x10(%ebp)
+  803995:	e8 33 df ff ff       	call   8018cd <fd2data>
+  80399a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8039a1:	50                   	push   %eax
+  8039a2:	6a 00                	push   $0x0
+  8039a4:	56                   	push   %esi
+  8039a5:	6a 00                	push   $0x0
+  8039a7:	e8 bb d2 ff ff       	call   800c67 <sys_page_map>
+  8039ac:	89 c3                	mov    %eax,%ebx
+  8039ae:	83 c4 20             	add    $0x20,%esp
+  8039b1:	85 c0                	test   %eax,%eax
+  8039b3:	78 4e                	js     803a03 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8039b5:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8039ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8039bd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8039bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8039c2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8039c9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8039cc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8039ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8039d1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8039d8:	83 ec 0c             	sub    $0xc,%esp
+  8039db:	ff 75 f4             	push   -0xc(%ebp)
+  8039de:	e8 da de ff ff       	call   8018bd <fd2num>
+  8039e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039e6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8039e8:	83 c4 04             	add    $0x4,%esp
+  8039eb:	ff 75 f0             	push   -0x10(%ebp)
+  8039ee:	e8 ca de ff ff       	call   8018bd <fd2num>
+  8039f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039f6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8039f9:	83 c4 10             	add    $0x10,%esp
+  8039fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a01:	eb 2e                	jmp    803a31 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a03:	83 ec 08             	sub    $0x8,%esp
+  803a06:	56                   	push   %esi
+  803a07:	6a 00                	push   $0x0
+  803a09:	e8 a5 d2 ff ff       	call   800cb3 <sys_page_unmap>
+  803a0e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803a11:	83 ec 08             	sub    $0x8,%esp
+  803a14:	ff 75 f0             	push   -0x10(%ebp)
+  803a17:	6a 00                	push   $0x0
+  803a19:	e8 95 d2 ff ff       	call   800cb3 <sys_page_unmap>
+  803a1e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803a21:	83 ec 08             	sub    $0x8,%esp
+  803a24:	ff 75 f4             	push   -0xc(%ebp)
+  803a27:	6a 00                	push   $0x0
+  803a29:	e8 85 d2 ff ff       	call   800cb3 <sys_page_unmap>
+  803a2e:	83 c4 10             	add    $0x10,%esp
+}
+  803a31:	89 d8                	mov    %ebx,%eax
+  803a33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a36:	5b                   	pop    %ebx
+  803a37:	5e                   	pop    %esi
+  803a38:	5d                   	pop    %ebp
+  803a39:	c3                   	ret
+
+00803a3a <pipeisclosed>:
+{
+  803a3a:	55                   	push   %ebp
+  803a3b:	89 e5                	mov    %esp,%ebp
+  803a3d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a43:	50                   	push   %eax
+  803a44:	ff 75 08             	push   0x8(%ebp)
+  803a47:	e8 ee de ff ff       	call   80193a <fd_lookup>
+  803a4c:	83 c4 10             	add    $0x10,%esp
+  803a4f:	85 c0                	test   %eax,%eax
+  803a51:	78 18                	js     803a6b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a53:	83 ec 0c             	sub    $0xc,%esp
+  803a56:	ff 75 f4             	push   -0xc(%ebp)
+  803a59:	e8 6f de ff ff       	call   8018cd <fd2data>
+  803a5e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a63:	e8 27 fc ff ff       	call   80368f <_pipeisclosed>
+  803a68:	83 c4 10             	add    $0x10,%esp
+}
+  803a6b:	c9                   	leave
+  803a6c:	c3                   	ret
+
+00803a6d <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803a6d:	55                   	push   %ebp
+  803a6e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803a70:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a73:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a79:	5d                   	pop    %ebp
+  803a7a:	c3                   	ret
+
+00803a7b <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803a7b:	55                   	push   %ebp
+  803a7c:	89 e5                	mov    %esp,%ebp
+  803a7e:	56                   	push   %esi
+  803a7f:	53                   	push   %ebx
+  803a80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a83:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a88:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a8d:	89 d0                	mov    %edx,%eax
+  803a8f:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803a93:	85 c0                	test   %eax,%eax
+  803a95:	74 2d                	je     803ac4 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803a97:	83 f8 02             	cmp    $0x2,%eax
+  803a9a:	74 08                	je     803aa4 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803a9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  803aa1:	f0 87 03             	lock xchg %eax,(%ebx)
+  803aa4:	be 02 00 00 00       	mov    $0x2,%esi
+  803aa9:	eb 15                	jmp    803ac0 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803aab:	83 ec 04             	sub    $0x4,%esp
+  803aae:	6a 00                	push   $0x0
+  803ab0:	6a 02                	push   $0x2
+  803ab2:	53                   	push   %ebx
+  803ab3:	e8 77 d4 ff ff       	call   800f2f <sys_futex_wait>
+  803ab8:	89 f0                	mov    %esi,%eax
+  803aba:	f0 87 03             	lock xchg %eax,(%ebx)
+  803abd:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803ac0:	85 c0                	test   %eax,%eax
+  803ac2:	75 e7                	jne    803aab <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803ac4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ac7:	5b                   	pop    %ebx
+  803ac8:	5e                   	pop    %esi
+  803ac9:	5d                   	pop    %ebp
+  803aca:	c3                   	ret
+
+00803acb <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803acb:	55                   	push   %ebp
+  803acc:	89 e5                	mov    %esp,%ebp
+  803ace:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803adb:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803adf:	f7 d8                	neg    %eax
+  803ae1:	19 c0                	sbb    %eax,%eax
+  803ae3:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803ae6:	5d                   	pop    %ebp
+  803ae7:	c3                   	ret
+
+00803ae8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ae8:	55                   	push   %ebp
+  803ae9:	89 e5                	mov    %esp,%ebp
+  803aeb:	83 ec 08             	sub    $0x8,%esp
+  803aee:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803af9:	83 f8 02             	cmp    $0x2,%eax
+  803afc:	74 02                	je     803b00 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803afe:	c9                   	leave
+  803aff:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803b00:	83 ec 08             	sub    $0x8,%esp
+  803b03:	6a 01                	push   $0x1
+  803b05:	52                   	push   %edx
+  803b06:	e8 53 d4 ff ff       	call   800f5e <sys_futex_wake>
+  803b0b:	83 c4 10             	add    $0x10,%esp
+}
+  803b0e:	eb ee                	jmp    803afe <mutex_unlock+0x16>
+
+00803b10 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803b10:	55                   	push   %ebp
+  803b11:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b1c:	5d                   	pop    %ebp
+  803b1d:	c3                   	ret
+
+00803b1e <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803b1e:	55                   	push   %ebp
+  803b1f:	89 e5                	mov    %esp,%ebp
+  803b21:	57                   	push   %edi
+  803b22:	56                   	push   %esi
+  803b23:	53                   	push   %ebx
+  803b24:	83 ec 18             	sub    $0x18,%esp
+  803b27:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803b2d:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803b2f:	53                   	push   %ebx
+  803b30:	e8 b3 ff ff ff       	call   803ae8 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803b35:	83 c4 0c             	add    $0xc,%esp
+  803b38:	ff 75 10             	push   0x10(%ebp)
+  803b3b:	57                   	push   %edi
+  803b3c:	56                   	push   %esi
+  803b3d:	e8 ed d3 ff ff       	call   800f2f <sys_futex_wait>
+  803b42:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803b44:	83 c4 10             	add    $0x10,%esp
+  803b47:	be 02 00 00 00       	mov    $0x2,%esi
+  803b4c:	eb 10                	jmp    803b5e <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b4e:	83 ec 04             	sub    $0x4,%esp
+  803b51:	6a 00                	push   $0x0
+  803b53:	6a 02                	push   $0x2
+  803b55:	53                   	push   %ebx
+  803b56:	e8 d4 d3 ff ff       	call   800f2f <sys_futex_wait>
+  803b5b:	83 c4 10             	add    $0x10,%esp
+  803b5e:	89 f0                	mov    %esi,%eax
+  803b60:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803b63:	85 c0                	test   %eax,%eax
+  803b65:	75 e7                	jne    803b4e <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803b67:	83 ff ec             	cmp    $0xffffffec,%edi
+  803b6a:	74 05                	je     803b71 <cond_timedwait+0x53>
+  803b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803b71:	89 f8                	mov    %edi,%eax
+  803b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b76:	5b                   	pop    %ebx
+  803b77:	5e                   	pop    %esi
+  803b78:	5f                   	pop    %edi
+  803b79:	5d                   	pop    %ebp
+  803b7a:	c3                   	ret
+
+00803b7b <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803b7b:	55                   	push   %ebp
+  803b7c:	89 e5                	mov    %esp,%ebp
+  803b7e:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803b81:	6a 00                	push   $0x0
+  803b83:	ff 75 0c             	push   0xc(%ebp)
+  803b86:	ff 75 08             	push   0x8(%ebp)
+  803b89:	e8 90 ff ff ff       	call   803b1e <cond_timedwait>
+}
+  803b8e:	83 c4 10             	add    $0x10,%esp
+  803b91:	c9                   	leave
+  803b92:	c3                   	ret
+
+00803b93 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803b93:	55                   	push   %ebp
+  803b94:	89 e5                	mov    %esp,%ebp
+  803b96:	83 ec 10             	sub    $0x10,%esp
+  803b99:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803b9c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ba1:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803ba5:	6a 01                	push   $0x1
+  803ba7:	50                   	push   %eax
+  803ba8:	e8 b1 d3 ff ff       	call   800f5e <sys_futex_wake>
+}
+  803bad:	83 c4 10             	add    $0x10,%esp
+  803bb0:	c9                   	leave
+  803bb1:	c3                   	ret
+
+00803bb2 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803bb2:	55                   	push   %ebp
+  803bb3:	89 e5                	mov    %esp,%ebp
+  803bb5:	83 ec 10             	sub    $0x10,%esp
+  803bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bbb:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bc0:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803bc4:	68 00 04 00 00       	push   $0x400
+  803bc9:	50                   	push   %eax
+  803bca:	e8 8f d3 ff ff       	call   800f5e <sys_futex_wake>
+}
+  803bcf:	83 c4 10             	add    $0x10,%esp
+  803bd2:	c9                   	leave
+  803bd3:	c3                   	ret
+
+00803bd4 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803bd4:	55                   	push   %ebp
+  803bd5:	89 e5                	mov    %esp,%ebp
+  803bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803bda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bdd:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803bdf:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803be6:	5d                   	pop    %ebp
+  803be7:	c3                   	ret
+
+00803be8 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803be8:	55                   	push   %ebp
+  803be9:	89 e5                	mov    %esp,%ebp
+  803beb:	53                   	push   %ebx
+  803bec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803bef:	8b 11                	mov    (%ecx),%edx
+  803bf1:	85 d2                	test   %edx,%edx
+  803bf3:	74 14                	je     803c09 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803bf5:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803bf8:	89 d0                	mov    %edx,%eax
+  803bfa:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803bfe:	39 c2                	cmp    %eax,%edx
+  803c00:	75 ed                	jne    803bef <sem_trywait+0x7>
+			return 0;
+  803c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c07:	eb 05                	jmp    803c0e <sem_trywait+0x26>
+	return -E_AGAIN;
+  803c09:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c11:	c9                   	leave
+  803c12:	c3                   	ret
+
+00803c13 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803c13:	55                   	push   %ebp
+  803c14:	89 e5                	mov    %esp,%ebp
+  803c16:	57                   	push   %edi
+  803c17:	56                   	push   %esi
+  803c18:	53                   	push   %ebx
+  803c19:	83 ec 1c             	sub    $0x1c,%esp
+  803c1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c1f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803c22:	e8 80 d2 ff ff       	call   800ea7 <sys_time_msec>
+  803c27:	01 f8                	add    %edi,%eax
+  803c29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803c2c:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803c31:	eb 28                	jmp    803c5b <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803c33:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c38:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803c3d:	83 ec 04             	sub    $0x4,%esp
+  803c40:	56                   	push   %esi
+  803c41:	6a 00                	push   $0x0
+  803c43:	53                   	push   %ebx
+  803c44:	e8 e6 d2 ff ff       	call   800f2f <sys_futex_wait>
+  803c49:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803c4e:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803c53:	83 c4 10             	add    $0x10,%esp
+  803c56:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803c59:	74 2e                	je     803c89 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803c5b:	83 ec 0c             	sub    $0xc,%esp
+  803c5e:	53                   	push   %ebx
+  803c5f:	e8 84 ff ff ff       	call   803be8 <sem_trywait>
+  803c64:	83 c4 10             	add    $0x10,%esp
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	79 19                	jns    803c84 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803c6b:	85 ff                	test   %edi,%edi
+  803c6d:	74 c4                	je     803c33 <sem_timedwait+0x20>
+  803c6f:	e8 33 d2 ff ff       	call   800ea7 <sys_time_msec>
+  803c74:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c77:	29 c6                	sub    %eax,%esi
+  803c79:	85 f6                	test   %esi,%esi
+  803c7b:	7f b6                	jg     803c33 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803c7d:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803c82:	eb 05                	jmp    803c89 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803c84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c8c:	5b                   	pop    %ebx
+  803c8d:	5e                   	pop    %esi
+  803c8e:	5f                   	pop    %edi
+  803c8f:	5d                   	pop    %ebp
+  803c90:	c3                   	ret
+
+00803c91 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803c91:	55                   	push   %ebp
+  803c92:	89 e5                	mov    %esp,%ebp
+  803c94:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803c97:	6a 00                	push   $0x0
+  803c99:	ff 75 08             	push   0x8(%ebp)
+  803c9c:	e8 72 ff ff ff       	call   803c13 <sem_timedwait>
+}
+  803ca1:	83 c4 10             	add    $0x10,%esp
+  803ca4:	c9                   	leave
+  803ca5:	c3                   	ret
+
+00803ca6 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803ca6:	55                   	push   %ebp
+  803ca7:	89 e5                	mov    %esp,%ebp
+  803ca9:	83 ec 08             	sub    $0x8,%esp
+  803cac:	8b 45 08             	mov    0x8(%ebp),%eax
+  803caf:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cb4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803cb8:	8b 50 04             	mov    0x4(%eax),%edx
+  803cbb:	85 d2                	test   %edx,%edx
+  803cbd:	75 02                	jne    803cc1 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803cbf:	c9                   	leave
+  803cc0:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803cc1:	83 ec 08             	sub    $0x8,%esp
+  803cc4:	6a 01                	push   $0x1
+  803cc6:	50                   	push   %eax
+  803cc7:	e8 92 d2 ff ff       	call   800f5e <sys_futex_wake>
+  803ccc:	83 c4 10             	add    $0x10,%esp
+}
+  803ccf:	eb ee                	jmp    803cbf <sem_post+0x19>
+
+00803cd1 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803cd1:	55                   	push   %ebp
+  803cd2:	89 e5                	mov    %esp,%ebp
+  803cd4:	57                   	push   %edi
+  803cd5:	56                   	push   %esi
+  803cd6:	53                   	push   %ebx
+  803cd7:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803cda:	68 20 60 80 00       	push   $0x806020
+  803cdf:	e8 97 fd ff ff       	call   803a7b <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803ce4:	a1 44 60 80 00       	mov    0x806044,%eax
+  803ce9:	83 c4 10             	add    $0x10,%esp
+  803cec:	85 c0                	test   %eax,%eax
+  803cee:	75 19                	jne    803d09 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803cf0:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803cf5:	8b 00                	mov    (%eax),%eax
+  803cf7:	8b 40 48             	mov    0x48(%eax),%eax
+  803cfa:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803cff:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803d06:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d09:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803d0e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d11:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803d18:	8b 40 04             	mov    0x4(%eax),%eax
+  803d1b:	85 c0                	test   %eax,%eax
+  803d1d:	0f 84 e4 00 00 00    	je     803e07 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d23:	83 c3 01             	add    $0x1,%ebx
+  803d26:	83 fb 20             	cmp    $0x20,%ebx
+  803d29:	75 e3                	jne    803d0e <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803d2b:	83 ec 0c             	sub    $0xc,%esp
+  803d2e:	68 20 60 80 00       	push   $0x806020
+  803d33:	e8 b0 fd ff ff       	call   803ae8 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803d38:	83 c4 10             	add    $0x10,%esp
+  803d3b:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803d40:	e9 b8 00 00 00       	jmp    803dfd <pthread_create+0x12c>
+  803d45:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803d48:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803d4b:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803d4d:	39 f3                	cmp    %esi,%ebx
+  803d4f:	73 16                	jae    803d67 <pthread_create+0x96>
+		va -= PGSIZE;
+  803d51:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803d57:	83 ec 08             	sub    $0x8,%esp
+  803d5a:	56                   	push   %esi
+  803d5b:	6a 00                	push   $0x0
+  803d5d:	e8 51 cf ff ff       	call   800cb3 <sys_page_unmap>
+  803d62:	83 c4 10             	add    $0x10,%esp
+  803d65:	eb e6                	jmp    803d4d <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803d67:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803d6a:	83 ec 08             	sub    $0x8,%esp
+  803d6d:	ff 75 e4             	push   -0x1c(%ebp)
+  803d70:	6a 00                	push   $0x0
+  803d72:	e8 3c cf ff ff       	call   800cb3 <sys_page_unmap>
+	return r;
+  803d77:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803d7a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d7d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803d84:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803d8b:	eb 70                	jmp    803dfd <pthread_create+0x12c>
+	th->th_fn = fn;
+  803d8d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d90:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803d97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d9a:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803d9d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803da0:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803da3:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803daa:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803daf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803db2:	29 c8                	sub    %ecx,%eax
+  803db4:	85 db                	test   %ebx,%ebx
+  803db6:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803dbd:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803dc0:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803dc7:	83 ec 04             	sub    $0x4,%esp
+  803dca:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803dcf:	29 ca                	sub    %ecx,%edx
+  803dd1:	52                   	push   %edx
+	*--esp = 0;
+  803dd2:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803dd5:	50                   	push   %eax
+  803dd6:	68 2e 40 80 00       	push   $0x80402e
+  803ddb:	e8 23 d2 ff ff       	call   801003 <sys_thread_create>
+  803de0:	89 c7                	mov    %eax,%edi
+  803de2:	83 c4 10             	add    $0x10,%esp
+  803de5:	85 c0                	test   %eax,%eax
+  803de7:	78 91                	js     803d7a <pthread_create+0xa9>
+	th->th_env = id;
+  803de9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dec:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803df6:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803df8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803dfd:	89 f8                	mov    %edi,%eax
+  803dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e02:	5b                   	pop    %ebx
+  803e03:	5e                   	pop    %esi
+  803e04:	5f                   	pop    %edi
+  803e05:	5d                   	pop    %ebp
+  803e06:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803e07:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e0a:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803e11:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803e18:	83 ec 0c             	sub    $0xc,%esp
+  803e1b:	68 20 60 80 00       	push   $0x806020
+  803e20:	e8 c3 fc ff ff       	call   803ae8 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803e25:	89 d9                	mov    %ebx,%ecx
+  803e27:	c1 e1 10             	shl    $0x10,%ecx
+  803e2a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803e2d:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803e32:	29 c8                	sub    %ecx,%eax
+  803e34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803e37:	c1 e8 16             	shr    $0x16,%eax
+  803e3a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e41:	83 c4 10             	add    $0x10,%esp
+  803e44:	a8 01                	test   $0x1,%al
+  803e46:	74 15                	je     803e5d <pthread_create+0x18c>
+  803e48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e4b:	c1 e8 0c             	shr    $0xc,%eax
+  803e4e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e55:	a8 01                	test   $0x1,%al
+  803e57:	0f 85 30 ff ff ff    	jne    803d8d <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e5d:	83 ec 04             	sub    $0x4,%esp
+  803e60:	6a 07                	push   $0x7
+  803e62:	ff 75 e4             	push   -0x1c(%ebp)
+  803e65:	6a 00                	push   $0x0
+  803e67:	e8 ae cd ff ff       	call   800c1a <sys_page_alloc>
+  803e6c:	89 c7                	mov    %eax,%edi
+  803e6e:	83 c4 10             	add    $0x10,%esp
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	0f 88 01 ff ff ff    	js     803d7a <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803e79:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803e7e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803e81:	29 d0                	sub    %edx,%eax
+  803e83:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803e86:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e88:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803e8d:	29 d0                	sub    %edx,%eax
+  803e8f:	89 c7                	mov    %eax,%edi
+  803e91:	39 fe                	cmp    %edi,%esi
+  803e93:	0f 83 f4 fe ff ff    	jae    803d8d <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e99:	83 ec 04             	sub    $0x4,%esp
+  803e9c:	6a 07                	push   $0x7
+  803e9e:	56                   	push   %esi
+  803e9f:	6a 00                	push   $0x0
+  803ea1:	e8 74 cd ff ff       	call   800c1a <sys_page_alloc>
+  803ea6:	83 c4 10             	add    $0x10,%esp
+  803ea9:	85 c0                	test   %eax,%eax
+  803eab:	0f 88 94 fe ff ff    	js     803d45 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803eb1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803eb7:	eb d8                	jmp    803e91 <pthread_create+0x1c0>
+
+00803eb9 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803eb9:	55                   	push   %ebp
+  803eba:	89 e5                	mov    %esp,%ebp
+  803ebc:	57                   	push   %edi
+  803ebd:	56                   	push   %esi
+  803ebe:	53                   	push   %ebx
+  803ebf:	83 ec 0c             	sub    $0xc,%esp
+  803ec2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803ec5:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803ec8:	83 f8 1e             	cmp    $0x1e,%eax
+  803ecb:	0f 87 c7 00 00 00    	ja     803f98 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803ed1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ed3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ed9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ede:	77 12                	ja     803ef2 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ee0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ee5:	29 d0                	sub    %edx,%eax
+  803ee7:	c1 e8 10             	shr    $0x10,%eax
+  803eea:	39 c3                	cmp    %eax,%ebx
+  803eec:	0f 84 ad 00 00 00    	je     803f9f <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ef2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ef5:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803efc:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803f03:	eb 10                	jmp    803f15 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f05:	83 ec 04             	sub    $0x4,%esp
+  803f08:	6a 00                	push   $0x0
+  803f0a:	6a 01                	push   $0x1
+  803f0c:	57                   	push   %edi
+  803f0d:	e8 1d d0 ff ff       	call   800f2f <sys_futex_wait>
+  803f12:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f15:	8b 46 04             	mov    0x4(%esi),%eax
+  803f18:	83 f8 01             	cmp    $0x1,%eax
+  803f1b:	74 e8                	je     803f05 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803f1d:	83 f8 02             	cmp    $0x2,%eax
+  803f20:	0f 85 80 00 00 00    	jne    803fa6 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f26:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803f29:	c1 e6 02             	shl    $0x2,%esi
+  803f2c:	eb 05                	jmp    803f33 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803f2e:	e8 bb cc ff ff       	call   800bee <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f33:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803f39:	89 ca                	mov    %ecx,%edx
+  803f3b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803f41:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f44:	c1 e0 04             	shl    $0x4,%eax
+  803f47:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f4c:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803f4f:	39 c1                	cmp    %eax,%ecx
+  803f51:	75 12                	jne    803f65 <pthread_join+0xac>
+  803f53:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f56:	c1 e0 04             	shl    $0x4,%eax
+  803f59:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f5e:	8b 40 54             	mov    0x54(%eax),%eax
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	75 c9                	jne    803f2e <pthread_join+0x75>
+	if (ret_store)
+  803f65:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803f69:	74 0f                	je     803f7a <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803f6b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f6e:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803f75:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f78:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803f7a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f7d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803f84:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f93:	5b                   	pop    %ebx
+  803f94:	5e                   	pop    %esi
+  803f95:	5f                   	pop    %edi
+  803f96:	5d                   	pop    %ebp
+  803f97:	c3                   	ret
+		return -E_INVAL;
+  803f98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f9d:	eb f1                	jmp    803f90 <pthread_join+0xd7>
+  803f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fa4:	eb ea                	jmp    803f90 <pthread_join+0xd7>
+		return -E_INVAL;
+  803fa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fab:	eb e3                	jmp    803f90 <pthread_join+0xd7>
+
+00803fad <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803fad:	55                   	push   %ebp
+  803fae:	89 e5                	mov    %esp,%ebp
+  803fb0:	53                   	push   %ebx
+  803fb1:	83 ec 04             	sub    $0x4,%esp
+  803fb4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fb6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fbc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fc1:	77 0c                	ja     803fcf <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fc3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fc8:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803fca:	c1 e8 10             	shr    $0x10,%eax
+  803fcd:	75 0a                	jne    803fd9 <pthread_exit+0x2c>
+		exit();
+  803fcf:	e8 67 c1 ff ff       	call   80013b <exit>
+  803fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803fd9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803fe0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803fe3:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803fea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803fed:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803ff0:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803ff7:	83 ec 08             	sub    $0x8,%esp
+  803ffa:	6a 20                	push   $0x20
+  803ffc:	01 c2                	add    %eax,%edx
+  803ffe:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  804005:	50                   	push   %eax
+  804006:	e8 53 cf ff ff       	call   800f5e <sys_futex_wake>
+	sys_env_destroy(0);
+  80400b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804012:	e8 60 cb ff ff       	call   800b77 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804017:	83 c4 0c             	add    $0xc,%esp
+  80401a:	68 aa 4e 80 00       	push   $0x804eaa
+  80401f:	68 a5 00 00 00       	push   $0xa5
+  804024:	68 c4 4e 80 00       	push   $0x804ec4
+  804029:	e8 cd 03 00 00       	call   8043fb <_panic>
+
+0080402e <pthread_start>:
+{
+  80402e:	55                   	push   %ebp
+  80402f:	89 e5                	mov    %esp,%ebp
+  804031:	53                   	push   %ebx
+  804032:	83 ec 04             	sub    $0x4,%esp
+  804035:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804038:	e8 85 cb ff ff       	call   800bc2 <sys_getenvid>
+  80403d:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804042:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  804048:	85 db                	test   %ebx,%ebx
+  80404a:	74 0c                	je     804058 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80404c:	89 d9                	mov    %ebx,%ecx
+  80404e:	c1 e1 10             	shl    $0x10,%ecx
+  804051:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804056:	29 ca                	sub    %ecx,%edx
+  804058:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80405b:	c1 e0 04             	shl    $0x4,%eax
+  80405e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804063:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804065:	83 ec 0c             	sub    $0xc,%esp
+  804068:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80406f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804072:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  804079:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  804080:	89 04 24             	mov    %eax,(%esp)
+  804083:	e8 25 ff ff ff       	call   803fad <pthread_exit>
+
+00804088 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804088:	55                   	push   %ebp
+  804089:	89 e5                	mov    %esp,%ebp
+  80408b:	57                   	push   %edi
+  80408c:	56                   	push   %esi
+  80408d:	53                   	push   %ebx
+  80408e:	83 ec 1c             	sub    $0x1c,%esp
+  804091:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804093:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804099:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040a5:	77 0d                	ja     8040b4 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040a7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040ac:	29 d0                	sub    %edx,%eax
+  8040ae:	c1 e8 10             	shr    $0x10,%eax
+  8040b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040b9:	eb 2f                	jmp    8040ea <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8040bb:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040c1:	8b 01                	mov    (%ecx),%eax
+  8040c3:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8040c6:	39 c2                	cmp    %eax,%edx
+  8040c8:	75 14                	jne    8040de <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8040ca:	83 ec 0c             	sub    $0xc,%esp
+  8040cd:	57                   	push   %edi
+  8040ce:	e8 a4 ca ff ff       	call   800b77 <sys_env_destroy>
+  8040d3:	83 c4 10             	add    $0x10,%esp
+  8040d6:	85 c0                	test   %eax,%eax
+  8040d8:	0f 88 97 00 00 00    	js     804175 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040de:	83 c3 01             	add    $0x1,%ebx
+  8040e1:	83 fb 20             	cmp    $0x20,%ebx
+  8040e4:	0f 84 d2 00 00 00    	je     8041bc <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8040ea:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040ed:	74 ef                	je     8040de <pthread_kill_others+0x56>
+  8040ef:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040f2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8040f9:	8b 40 04             	mov    0x4(%eax),%eax
+  8040fc:	83 f8 01             	cmp    $0x1,%eax
+  8040ff:	75 dd                	jne    8040de <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804101:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804104:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  80410b:	89 fe                	mov    %edi,%esi
+  80410d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804113:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804116:	c1 e0 04             	shl    $0x4,%eax
+  804119:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80411e:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804121:	39 c7                	cmp    %eax,%edi
+  804123:	75 b9                	jne    8040de <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804125:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804128:	c1 e0 04             	shl    $0x4,%eax
+  80412b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804130:	8b 40 54             	mov    0x54(%eax),%eax
+  804133:	85 c0                	test   %eax,%eax
+  804135:	74 a7                	je     8040de <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804137:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80413a:	c1 e0 04             	shl    $0x4,%eax
+  80413d:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804143:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804145:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80414b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804150:	0f 87 65 ff ff ff    	ja     8040bb <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804156:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80415b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80415d:	c1 e8 10             	shr    $0x10,%eax
+  804160:	0f 84 55 ff ff ff    	je     8040bb <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804166:	c1 e0 10             	shl    $0x10,%eax
+  804169:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80416e:	29 c1                	sub    %eax,%ecx
+  804170:	e9 4c ff ff ff       	jmp    8040c1 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804175:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804178:	c1 e2 04             	shl    $0x4,%edx
+  80417b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804181:	8b 52 48             	mov    0x48(%edx),%edx
+  804184:	39 fa                	cmp    %edi,%edx
+  804186:	0f 85 52 ff ff ff    	jne    8040de <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80418c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80418f:	c1 e2 04             	shl    $0x4,%edx
+  804192:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804198:	8b 52 54             	mov    0x54(%edx),%edx
+  80419b:	85 d2                	test   %edx,%edx
+  80419d:	0f 84 3b ff ff ff    	je     8040de <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8041a3:	83 ec 0c             	sub    $0xc,%esp
+  8041a6:	50                   	push   %eax
+  8041a7:	57                   	push   %edi
+  8041a8:	68 d4 4e 80 00       	push   $0x804ed4
+  8041ad:	68 bb 00 00 00       	push   $0xbb
+  8041b2:	68 c4 4e 80 00       	push   $0x804ec4
+  8041b7:	e8 3f 02 00 00       	call   8043fb <_panic>
+	}
+}
+  8041bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041bf:	5b                   	pop    %ebx
+  8041c0:	5e                   	pop    %esi
+  8041c1:	5f                   	pop    %edi
+  8041c2:	5d                   	pop    %ebp
+  8041c3:	c3                   	ret
+
+008041c4 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8041c4:	55                   	push   %ebp
+  8041c5:	89 e5                	mov    %esp,%ebp
+  8041c7:	53                   	push   %ebx
+  8041c8:	83 ec 04             	sub    $0x4,%esp
+  8041cb:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041cd:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8041d3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8041d9:	0f 87 85 00 00 00    	ja     804264 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041df:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8041e4:	29 c3                	sub    %eax,%ebx
+  8041e6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8041e9:	83 ec 04             	sub    $0x4,%esp
+  8041ec:	68 80 02 00 00       	push   $0x280
+  8041f1:	6a 00                	push   $0x0
+  8041f3:	68 40 60 80 00       	push   $0x806040
+  8041f8:	e8 30 c7 ff ff       	call   80092d <memset>
+	threads_mu.m_state = 0;
+  8041fd:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  804204:	00 00 00 
+	if (self != 0) {
+  804207:	83 c4 10             	add    $0x10,%esp
+  80420a:	85 db                	test   %ebx,%ebx
+  80420c:	74 51                	je     80425f <pthread_fork_child+0x9b>
+  80420e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804210:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804216:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80421b:	77 18                	ja     804235 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80421d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804222:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804224:	c1 e8 10             	shr    $0x10,%eax
+  804227:	74 0c                	je     804235 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804229:	c1 e0 10             	shl    $0x10,%eax
+  80422c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804231:	29 c2                	sub    %eax,%edx
+  804233:	eb 06                	jmp    80423b <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804235:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  80423b:	8b 02                	mov    (%edx),%eax
+  80423d:	8b 48 48             	mov    0x48(%eax),%ecx
+  804240:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804247:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80424a:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804251:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  804258:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80425f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804262:	c9                   	leave
+  804263:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804264:	83 ec 04             	sub    $0x4,%esp
+  804267:	68 80 02 00 00       	push   $0x280
+  80426c:	6a 00                	push   $0x0
+  80426e:	68 40 60 80 00       	push   $0x806040
+  804273:	e8 b5 c6 ff ff       	call   80092d <memset>
+	threads_mu.m_state = 0;
+  804278:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80427f:	00 00 00 
+  804282:	83 c4 10             	add    $0x10,%esp
+  804285:	eb d8                	jmp    80425f <pthread_fork_child+0x9b>
+
+00804287 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428c:	c3                   	ret
+
+0080428d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80428d:	55                   	push   %ebp
+  80428e:	89 e5                	mov    %esp,%ebp
+  804290:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804293:	68 f9 4e 80 00       	push   $0x804ef9
+  804298:	ff 75 0c             	push   0xc(%ebp)
+  80429b:	e8 3c c5 ff ff       	call   8007dc <strcpy>
+	return 0;
+}
+  8042a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a5:	c9                   	leave
+  8042a6:	c3                   	ret
+
+008042a7 <devcons_write>:
+{
+  8042a7:	55                   	push   %ebp
+  8042a8:	89 e5                	mov    %esp,%ebp
+  8042aa:	57                   	push   %edi
+  8042ab:	56                   	push   %esi
+  8042ac:	53                   	push   %ebx
+  8042ad:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8042b3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8042b8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8042be:	eb 2e                	jmp    8042ee <devcons_write+0x47>
+		m = n - tot;
+  8042c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8042c3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8042c5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042ca:	39 c3                	cmp    %eax,%ebx
+  8042cc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8042cf:	83 ec 04             	sub    $0x4,%esp
+  8042d2:	53                   	push   %ebx
+  8042d3:	89 f0                	mov    %esi,%eax
+  8042d5:	03 45 0c             	add    0xc(%ebp),%eax
+  8042d8:	50                   	push   %eax
+  8042d9:	57                   	push   %edi
+  8042da:	e8 83 c6 ff ff       	call   800962 <memmove>
+		sys_cputs(buf, m);
+  8042df:	83 c4 08             	add    $0x8,%esp
+  8042e2:	53                   	push   %ebx
+  8042e3:	57                   	push   %edi
+  8042e4:	e8 37 c8 ff ff       	call   800b20 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8042e9:	01 de                	add    %ebx,%esi
+  8042eb:	83 c4 10             	add    $0x10,%esp
+  8042ee:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8042f1:	72 cd                	jb     8042c0 <devcons_write+0x19>
+}
+  8042f3:	89 f0                	mov    %esi,%eax
+  8042f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042f8:	5b                   	pop    %ebx
+  8042f9:	5e                   	pop    %esi
+  8042fa:	5f                   	pop    %edi
+  8042fb:	5d                   	pop    %ebp
+  8042fc:	c3                   	ret
+
+008042fd <devcons_read>:
+{
+  8042fd:	55                   	push   %ebp
+  8042fe:	89 e5                	mov    %esp,%ebp
+  804300:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804303:	b8 00 00 00 00       	mov    $0x0,%eax
+  804308:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80430c:	75 07                	jne    804315 <devcons_read+0x18>
+  80430e:	eb 1f                	jmp    80432f <devcons_read+0x32>
+		sys_yield();
+  804310:	e8 d9 c8 ff ff       	call   800bee <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804315:	e8 31 c8 ff ff       	call   800b4b <sys_cgetc>
+  80431a:	85 c0                	test   %eax,%eax
+  80431c:	74 f2                	je     804310 <devcons_read+0x13>
+	if (c < 0)
+  80431e:	78 0f                	js     80432f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804320:	83 f8 04             	cmp    $0x4,%eax
+  804323:	74 0c                	je     804331 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804325:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804328:	88 02                	mov    %al,(%edx)
+	return 1;
+  80432a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80432f:	c9                   	leave
+  804330:	c3                   	ret
+		return 0;
+  804331:	b8 00 00 00 00       	mov    $0x0,%eax
+  804336:	eb f7                	jmp    80432f <devcons_read+0x32>
+
+00804338 <cputchar>:
+{
+  804338:	55                   	push   %ebp
+  804339:	89 e5                	mov    %esp,%ebp
+  80433b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80433e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804341:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804344:	6a 01                	push   $0x1
+  804346:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804349:	50                   	push   %eax
+  80434a:	e8 d1 c7 ff ff       	call   800b20 <sys_cputs>
+}
+  80434f:	83 c4 10             	add    $0x10,%esp
+  804352:	c9                   	leave
+  804353:	c3                   	ret
+
+00804354 <getchar>:
+{
+  804354:	55                   	push   %ebp
+  804355:	89 e5                	mov    %esp,%ebp
+  804357:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80435a:	6a 01                	push   $0x1
+  80435c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80435f:	50                   	push   %eax
+  804360:	6a 00                	push   $0x0
+  804362:	e8 63 d8 ff ff       	call   801bca <read>
+	if (r < 0)
+  804367:	83 c4 10             	add    $0x10,%esp
+  80436a:	85 c0                	test   %eax,%eax
+  80436c:	78 06                	js     804374 <getchar+0x20>
+	if (r < 1)
+  80436e:	74 06                	je     804376 <getchar+0x22>
+	return c;
+  804370:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+		return -E_EOF;
+  804376:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80437b:	eb f7                	jmp    804374 <getchar+0x20>
+
+0080437d <iscons>:
+{
+  80437d:	55                   	push   %ebp
+  80437e:	89 e5                	mov    %esp,%ebp
+  804380:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804383:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804386:	50                   	push   %eax
+  804387:	ff 75 08             	push   0x8(%ebp)
+  80438a:	e8 ab d5 ff ff       	call   80193a <fd_lookup>
+  80438f:	83 c4 10             	add    $0x10,%esp
+  804392:	85 c0                	test   %eax,%eax
+  804394:	78 11                	js     8043a7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804396:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804399:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80439f:	39 10                	cmp    %edx,(%eax)
+  8043a1:	0f 94 c0             	sete   %al
+  8043a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8043a7:	c9                   	leave
+  8043a8:	c3                   	ret
+
+008043a9 <opencons>:
+{
+  8043a9:	55                   	push   %ebp
+  8043aa:	89 e5                	mov    %esp,%ebp
+  8043ac:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8043af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043b2:	50                   	push   %eax
+  8043b3:	e8 2c d5 ff ff       	call   8018e4 <fd_alloc>
+  8043b8:	83 c4 10             	add    $0x10,%esp
+  8043bb:	85 c0                	test   %eax,%eax
+  8043bd:	78 3a                	js     8043f9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8043bf:	83 ec 04             	sub    $0x4,%esp
+  8043c2:	68 07 04 00 00       	push   $0x407
+  8043c7:	ff 75 f4             	push   -0xc(%ebp)
+  8043ca:	6a 00                	push   $0x0
+  8043cc:	e8 49 c8 ff ff       	call   800c1a <sys_page_alloc>
+  8043d1:	83 c4 10             	add    $0x10,%esp
+  8043d4:	85 c0                	test   %eax,%eax
+  8043d6:	78 21                	js     8043f9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8043d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043db:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8043e1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8043e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043e6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8043ed:	83 ec 0c             	sub    $0xc,%esp
+  8043f0:	50                   	push   %eax
+  8043f1:	e8 c7 d4 ff ff       	call   8018bd <fd2num>
+  8043f6:	83 c4 10             	add    $0x10,%esp
+}
+  8043f9:	c9                   	leave
+  8043fa:	c3                   	ret
+
+008043fb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8043fb:	55                   	push   %ebp
+  8043fc:	89 e5                	mov    %esp,%ebp
+  8043fe:	56                   	push   %esi
+  8043ff:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804400:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804403:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  804409:	e8 b4 c7 ff ff       	call   800bc2 <sys_getenvid>
+  80440e:	83 ec 0c             	sub    $0xc,%esp
+  804411:	ff 75 0c             	push   0xc(%ebp)
+  804414:	ff 75 08             	push   0x8(%ebp)
+  804417:	56                   	push   %esi
+  804418:	50                   	push   %eax
+  804419:	68 08 4f 80 00       	push   $0x804f08
+  80441e:	e8 d5 bd ff ff       	call   8001f8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804423:	83 c4 18             	add    $0x18,%esp
+  804426:	53                   	push   %ebx
+  804427:	ff 75 10             	push   0x10(%ebp)
+  80442a:	e8 78 bd ff ff       	call   8001a7 <vcprintf>
+	cprintf("\n");
+  80442f:	c7 04 24 7a 4c 80 00 	movl   $0x804c7a,(%esp)
+  804436:	e8 bd bd ff ff       	call   8001f8 <cprintf>
+  80443b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80443e:	cc                   	int3
+	while (1)
+  80443f:	eb fd                	jmp    80443e <_panic+0x43>
+
+00804441 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804441:	55                   	push   %ebp
+  804442:	89 e5                	mov    %esp,%ebp
+  804444:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804447:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80444e:	74 0a                	je     80445a <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804450:	8b 45 08             	mov    0x8(%ebp),%eax
+  804453:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804458:	c9                   	leave
+  804459:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80445a:	83 ec 04             	sub    $0x4,%esp
+  80445d:	6a 07                	push   $0x7
+  80445f:	68 00 f0 bf ee       	push   $0xeebff000
+  804464:	6a 00                	push   $0x0
+  804466:	e8 af c7 ff ff       	call   800c1a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80446b:	83 c4 08             	add    $0x8,%esp
+  80446e:	68 7f 44 80 00       	push   $0x80447f
+  804473:	6a 00                	push   $0x0
+  804475:	e8 1d c9 ff ff       	call   800d97 <sys_env_set_pgfault_upcall>
+  80447a:	83 c4 10             	add    $0x10,%esp
+  80447d:	eb d1                	jmp    804450 <set_pgfault_handler+0xf>
+
+0080447f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80447f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804480:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804485:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804487:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80448a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80448e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804492:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804495:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804499:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80449b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80449e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80449f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8044a2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8044a3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8044a4:	c3                   	ret
+
+008044a5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044a5:	55                   	push   %ebp
+  8044a6:	89 e5                	mov    %esp,%ebp
+  8044a8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044ab:	89 c2                	mov    %eax,%edx
+  8044ad:	c1 ea 16             	shr    $0x16,%edx
+  8044b0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044b7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044bc:	f6 c1 01             	test   $0x1,%cl
+  8044bf:	74 1c                	je     8044dd <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044c1:	c1 e8 0c             	shr    $0xc,%eax
+  8044c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044cb:	a8 01                	test   $0x1,%al
+  8044cd:	74 0e                	je     8044dd <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044cf:	c1 e8 0c             	shr    $0xc,%eax
+  8044d2:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044d9:	ef 
+  8044da:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044dd:	89 d0                	mov    %edx,%eax
+  8044df:	5d                   	pop    %ebp
+  8044e0:	c3                   	ret
+
+008044e1 <udm>:
+  8044e1:	57                   	push   %edi
+  8044e2:	56                   	push   %esi
+  8044e3:	53                   	push   %ebx
+  8044e4:	83 ec 20             	sub    $0x20,%esp
+  8044e7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044eb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044ef:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044f3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044f7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044fb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044ff:	89 d1                	mov    %edx,%ecx
+  804501:	09 c1                	or     %eax,%ecx
+  804503:	0f 84 91 00 00 00    	je     80459a <udm+0xb9>
+  804509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804513:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804518:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80451f:	00 
+  804520:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804527:	00 
+  804528:	eb 08                	jmp    804532 <udm+0x51>
+  80452a:	83 e9 01             	sub    $0x1,%ecx
+  80452d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804530:	74 7c                	je     8045ae <udm+0xcd>
+  804532:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804536:	01 c0                	add    %eax,%eax
+  804538:	89 c6                	mov    %eax,%esi
+  80453a:	89 d7                	mov    %edx,%edi
+  80453c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804540:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804544:	0f ad d0             	shrd   %cl,%edx,%eax
+  804547:	d3 ea                	shr    %cl,%edx
+  804549:	f6 c1 20             	test   $0x20,%cl
+  80454c:	74 04                	je     804552 <udm+0x71>
+  80454e:	89 d0                	mov    %edx,%eax
+  804550:	31 d2                	xor    %edx,%edx
+  804552:	83 e0 01             	and    $0x1,%eax
+  804555:	89 04 24             	mov    %eax,(%esp)
+  804558:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80455f:	00 
+  804560:	8b 04 24             	mov    (%esp),%eax
+  804563:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804567:	09 f0                	or     %esi,%eax
+  804569:	09 fa                	or     %edi,%edx
+  80456b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80456f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804573:	39 f0                	cmp    %esi,%eax
+  804575:	89 d3                	mov    %edx,%ebx
+  804577:	19 fb                	sbb    %edi,%ebx
+  804579:	72 af                	jb     80452a <udm+0x49>
+  80457b:	29 f0                	sub    %esi,%eax
+  80457d:	19 fa                	sbb    %edi,%edx
+  80457f:	89 cf                	mov    %ecx,%edi
+  804581:	c1 ef 05             	shr    $0x5,%edi
+  804584:	83 e7 01             	and    $0x1,%edi
+  804587:	89 fe                	mov    %edi,%esi
+  804589:	83 f6 01             	xor    $0x1,%esi
+  80458c:	d3 e6                	shl    %cl,%esi
+  80458e:	d3 e7                	shl    %cl,%edi
+  804590:	09 74 24 18          	or     %esi,0x18(%esp)
+  804594:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804598:	eb 90                	jmp    80452a <udm+0x49>
+  80459a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80459e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045a2:	89 f0                	mov    %esi,%eax
+  8045a4:	89 fa                	mov    %edi,%edx
+  8045a6:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045aa:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045ae:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045b2:	89 01                	mov    %eax,(%ecx)
+  8045b4:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045b7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045bb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045bf:	83 c4 20             	add    $0x20,%esp
+  8045c2:	5b                   	pop    %ebx
+  8045c3:	5e                   	pop    %esi
+  8045c4:	5f                   	pop    %edi
+  8045c5:	c3                   	ret
+
+008045c6 <__udivdi3>:
+  8045c6:	83 ec 18             	sub    $0x18,%esp
+  8045c9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045cd:	50                   	push   %eax
+  8045ce:	ff 74 24 2c          	push   0x2c(%esp)
+  8045d2:	ff 74 24 2c          	push   0x2c(%esp)
+  8045d6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045da:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045de:	e8 fe fe ff ff       	call   8044e1 <udm>
+  8045e3:	83 c4 24             	add    $0x24,%esp
+  8045e6:	c3                   	ret
+
+008045e7 <__umoddi3>:
+  8045e7:	83 ec 18             	sub    $0x18,%esp
+  8045ea:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045ee:	50                   	push   %eax
+  8045ef:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f3:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045ff:	e8 dd fe ff ff       	call   8044e1 <udm>
+  804604:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804608:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80460c:	83 c4 24             	add    $0x24,%esp
+  80460f:	c3                   	ret
+
+00804610 <__divdi3>:
+  804610:	56                   	push   %esi
+  804611:	53                   	push   %ebx
+  804612:	83 ec 14             	sub    $0x14,%esp
+  804615:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804619:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80461d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804621:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804625:	85 d2                	test   %edx,%edx
+  804627:	78 18                	js     804641 <__divdi3+0x31>
+  804629:	85 db                	test   %ebx,%ebx
+  80462b:	78 3e                	js     80466b <__divdi3+0x5b>
+  80462d:	83 ec 04             	sub    $0x4,%esp
+  804630:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804634:	56                   	push   %esi
+  804635:	53                   	push   %ebx
+  804636:	51                   	push   %ecx
+  804637:	e8 a5 fe ff ff       	call   8044e1 <udm>
+  80463c:	83 c4 10             	add    $0x10,%esp
+  80463f:	eb 24                	jmp    804665 <__divdi3+0x55>
+  804641:	f7 d8                	neg    %eax
+  804643:	83 d2 00             	adc    $0x0,%edx
+  804646:	f7 da                	neg    %edx
+  804648:	85 db                	test   %ebx,%ebx
+  80464a:	78 3a                	js     804686 <__divdi3+0x76>
+  80464c:	83 ec 04             	sub    $0x4,%esp
+  80464f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804653:	56                   	push   %esi
+  804654:	53                   	push   %ebx
+  804655:	51                   	push   %ecx
+  804656:	e8 86 fe ff ff       	call   8044e1 <udm>
+  80465b:	83 c4 10             	add    $0x10,%esp
+  80465e:	f7 d8                	neg    %eax
+  804660:	83 d2 00             	adc    $0x0,%edx
+  804663:	f7 da                	neg    %edx
+  804665:	83 c4 14             	add    $0x14,%esp
+  804668:	5b                   	pop    %ebx
+  804669:	5e                   	pop    %esi
+  80466a:	c3                   	ret
+  80466b:	83 ec 04             	sub    $0x4,%esp
+  80466e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804672:	56                   	push   %esi
+  804673:	f7 d9                	neg    %ecx
+  804675:	83 d3 00             	adc    $0x0,%ebx
+  804678:	f7 db                	neg    %ebx
+  80467a:	53                   	push   %ebx
+  80467b:	51                   	push   %ecx
+  80467c:	e8 60 fe ff ff       	call   8044e1 <udm>
+  804681:	83 c4 10             	add    $0x10,%esp
+  804684:	eb d8                	jmp    80465e <__divdi3+0x4e>
+  804686:	83 ec 04             	sub    $0x4,%esp
+  804689:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80468d:	56                   	push   %esi
+  80468e:	f7 d9                	neg    %ecx
+  804690:	83 d3 00             	adc    $0x0,%ebx
+  804693:	f7 db                	neg    %ebx
+  804695:	53                   	push   %ebx
+  804696:	51                   	push   %ecx
+  804697:	e8 45 fe ff ff       	call   8044e1 <udm>
+  80469c:	83 c4 10             	add    $0x10,%esp
+  80469f:	eb c4                	jmp    804665 <__divdi3+0x55>
+
+008046a1 <__moddi3>:
+  8046a1:	55                   	push   %ebp
+  8046a2:	57                   	push   %edi
+  8046a3:	56                   	push   %esi
+  8046a4:	53                   	push   %ebx
+  8046a5:	83 ec 24             	sub    $0x24,%esp
+  8046a8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046ac:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046b0:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046b4:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046b8:	85 d2                	test   %edx,%edx
+  8046ba:	78 3b                	js     8046f7 <__moddi3+0x56>
+  8046bc:	83 ec 04             	sub    $0x4,%esp
+  8046bf:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046c3:	56                   	push   %esi
+  8046c4:	89 ce                	mov    %ecx,%esi
+  8046c6:	f7 de                	neg    %esi
+  8046c8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046cc:	89 de                	mov    %ebx,%esi
+  8046ce:	83 d6 00             	adc    $0x0,%esi
+  8046d1:	f7 de                	neg    %esi
+  8046d3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046d7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046db:	0f 48 f1             	cmovs  %ecx,%esi
+  8046de:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046e3:	53                   	push   %ebx
+  8046e4:	56                   	push   %esi
+  8046e5:	e8 f7 fd ff ff       	call   8044e1 <udm>
+  8046ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046ee:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046f2:	83 c4 10             	add    $0x10,%esp
+  8046f5:	eb 47                	jmp    80473e <__moddi3+0x9d>
+  8046f7:	f7 d8                	neg    %eax
+  8046f9:	83 d2 00             	adc    $0x0,%edx
+  8046fc:	f7 da                	neg    %edx
+  8046fe:	83 ec 04             	sub    $0x4,%esp
+  804701:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804705:	56                   	push   %esi
+  804706:	89 cf                	mov    %ecx,%edi
+  804708:	f7 df                	neg    %edi
+  80470a:	89 de                	mov    %ebx,%esi
+  80470c:	83 d6 00             	adc    $0x0,%esi
+  80470f:	f7 de                	neg    %esi
+  804711:	0f 49 cf             	cmovns %edi,%ecx
+  804714:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804718:	0f 49 de             	cmovns %esi,%ebx
+  80471b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80471f:	ff 74 24 0c          	push   0xc(%esp)
+  804723:	ff 74 24 0c          	push   0xc(%esp)
+  804727:	e8 b5 fd ff ff       	call   8044e1 <udm>
+  80472c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804730:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804734:	f7 d8                	neg    %eax
+  804736:	83 d2 00             	adc    $0x0,%edx
+  804739:	f7 da                	neg    %edx
+  80473b:	83 c4 10             	add    $0x10,%esp
+  80473e:	83 c4 24             	add    $0x24,%esp
+  804741:	5b                   	pop    %ebx
+  804742:	5e                   	pop    %esi
+  804743:	5f                   	pop    %edi
+  804744:	5d                   	pop    %ebp
+  804745:	c3                   	ret
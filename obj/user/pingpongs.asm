@@ -0,0 +1,9826 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 66 01 00 00       	call   800197 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 69 15 00 00       	call   8015aa <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	0f 84 fe 00 00 00    	je     80014a <umain+0x117>
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80004c:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80004e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800054:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800059:	77 18                	ja     800073 <umain+0x40>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80005b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800060:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800062:	c1 e8 10             	shr    $0x10,%eax
+  800065:	74 0c                	je     800073 <umain+0x40>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800067:	c1 e0 10             	shl    $0x10,%eax
+  80006a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80006f:	29 c2                	sub    %eax,%edx
+  800071:	eb 06                	jmp    800079 <umain+0x46>
+		return pthread_main_tls;
+  800073:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800079:	8b 1a                	mov    (%edx),%ebx
+  80007b:	e8 19 0c 00 00       	call   800c99 <sys_getenvid>
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	53                   	push   %ebx
+  800084:	50                   	push   %eax
+  800085:	68 20 48 80 00       	push   $0x804820
+  80008a:	e8 40 02 00 00       	call   8002cf <cprintf>
+		// get the ball rolling
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80008f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800092:	e8 02 0c 00 00       	call   800c99 <sys_getenvid>
+  800097:	83 c4 0c             	add    $0xc,%esp
+  80009a:	53                   	push   %ebx
+  80009b:	50                   	push   %eax
+  80009c:	68 3a 48 80 00       	push   $0x80483a
+  8000a1:	e8 29 02 00 00       	call   8002cf <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000a6:	6a 00                	push   $0x0
+  8000a8:	6a 00                	push   $0x0
+  8000aa:	6a 00                	push   $0x0
+  8000ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8000af:	e8 4b 18 00 00       	call   8018ff <ipc_send>
+  8000b4:	83 c4 20             	add    $0x20,%esp
+  8000b7:	e9 8e 00 00 00       	jmp    80014a <umain+0x117>
+  8000bc:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  8000c2:	8b 02                	mov    (%edx),%eax
+  8000c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8000c7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8000ca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000cc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8000d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000d7:	77 18                	ja     8000f1 <umain+0xbe>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000de:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8000e0:	c1 e8 10             	shr    $0x10,%eax
+  8000e3:	74 0c                	je     8000f1 <umain+0xbe>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000e5:	c1 e0 10             	shl    $0x10,%eax
+  8000e8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000ed:	29 c2                	sub    %eax,%edx
+  8000ef:	eb 06                	jmp    8000f7 <umain+0xc4>
+		return pthread_main_tls;
+  8000f1:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+  8000f7:	8b 3a                	mov    (%edx),%edi
+  8000f9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8000fc:	8b 1d c0 72 80 00    	mov    0x8072c0,%ebx
+  800102:	e8 92 0b 00 00       	call   800c99 <sys_getenvid>
+  800107:	83 ec 08             	sub    $0x8,%esp
+  80010a:	ff 75 d4             	push   -0x2c(%ebp)
+  80010d:	57                   	push   %edi
+  80010e:	56                   	push   %esi
+  80010f:	53                   	push   %ebx
+  800110:	50                   	push   %eax
+  800111:	68 50 48 80 00       	push   $0x804850
+  800116:	e8 b4 01 00 00       	call   8002cf <cprintf>
+		if (val == 10)
+  80011b:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  800120:	83 c4 20             	add    $0x20,%esp
+  800123:	83 f8 0a             	cmp    $0xa,%eax
+  800126:	74 67                	je     80018f <umain+0x15c>
+			return;
+		++val;
+  800128:	83 c0 01             	add    $0x1,%eax
+  80012b:	a3 c0 72 80 00       	mov    %eax,0x8072c0
+		ipc_send(who, 0, 0, 0);
+  800130:	6a 00                	push   $0x0
+  800132:	6a 00                	push   $0x0
+  800134:	6a 00                	push   $0x0
+  800136:	ff 75 e4             	push   -0x1c(%ebp)
+  800139:	e8 c1 17 00 00       	call   8018ff <ipc_send>
+		if (val == 10)
+  80013e:	83 c4 10             	add    $0x10,%esp
+  800141:	83 3d c0 72 80 00 0a 	cmpl   $0xa,0x8072c0
+  800148:	74 45                	je     80018f <umain+0x15c>
+		ipc_recv(&who, 0, 0);
+  80014a:	83 ec 04             	sub    $0x4,%esp
+  80014d:	6a 00                	push   $0x0
+  80014f:	6a 00                	push   $0x0
+  800151:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800154:	50                   	push   %eax
+  800155:	e8 af 16 00 00       	call   801809 <ipc_recv>
+  80015a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80015c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80016a:	0f 87 4c ff ff ff    	ja     8000bc <umain+0x89>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800170:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800175:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800177:	c1 e8 10             	shr    $0x10,%eax
+  80017a:	0f 84 3c ff ff ff    	je     8000bc <umain+0x89>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800180:	c1 e0 10             	shl    $0x10,%eax
+  800183:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800188:	29 c2                	sub    %eax,%edx
+  80018a:	e9 33 ff ff ff       	jmp    8000c2 <umain+0x8f>
+			return;
+	}
+
+}
+  80018f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800192:	5b                   	pop    %ebx
+  800193:	5e                   	pop    %esi
+  800194:	5f                   	pop    %edi
+  800195:	5d                   	pop    %ebp
+  800196:	c3                   	ret
+
+00800197 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	57                   	push   %edi
+  80019b:	56                   	push   %esi
+  80019c:	53                   	push   %ebx
+  80019d:	83 ec 1c             	sub    $0x1c,%esp
+  8001a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001a6:	e8 ee 0a 00 00       	call   800c99 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001ab:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001ae:	89 15 c4 72 80 00    	mov    %edx,0x8072c4
+	thisenv = &envs[ENVX(eid)];
+  8001b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b9:	89 c1                	mov    %eax,%ecx
+  8001bb:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001bd:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001c3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001c8:	77 16                	ja     8001e0 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8001ca:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8001cf:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  8001d1:	c1 e8 10             	shr    $0x10,%eax
+  8001d4:	74 0a                	je     8001e0 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8001d6:	c1 e0 10             	shl    $0x10,%eax
+  8001d9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8001de:	29 c2                	sub    %eax,%edx
+  8001e0:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8001e3:	c1 e0 04             	shl    $0x4,%eax
+  8001e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001eb:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ed:	85 db                	test   %ebx,%ebx
+  8001ef:	7e 07                	jle    8001f8 <libmain+0x61>
+		binaryname = argv[0];
+  8001f1:	8b 06                	mov    (%esi),%eax
+  8001f3:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8001f8:	83 ec 08             	sub    $0x8,%esp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+  8001fd:	e8 31 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800202:	e8 0b 00 00 00       	call   800212 <exit>
+}
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020d:	5b                   	pop    %ebx
+  80020e:	5e                   	pop    %esi
+  80020f:	5f                   	pop    %edi
+  800210:	5d                   	pop    %ebp
+  800211:	c3                   	ret
+
+00800212 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800212:	55                   	push   %ebp
+  800213:	89 e5                	mov    %esp,%ebp
+  800215:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800218:	6a 00                	push   $0x0
+  80021a:	e8 d0 28 00 00       	call   802aef <fflush>
+	pthread_kill_others();
+  80021f:	e8 3b 3f 00 00       	call   80415f <pthread_kill_others>
+	close_all();
+  800224:	e8 69 19 00 00       	call   801b92 <close_all>
+	sys_env_destroy(0);
+  800229:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800230:	e8 19 0a 00 00       	call   800c4e <sys_env_destroy>
+}
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	c9                   	leave
+  800239:	c3                   	ret
+
+0080023a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800244:	8b 13                	mov    (%ebx),%edx
+  800246:	8d 42 01             	lea    0x1(%edx),%eax
+  800249:	89 03                	mov    %eax,(%ebx)
+  80024b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80024e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800252:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800257:	74 09                	je     800262 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800259:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80025d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800262:	83 ec 08             	sub    $0x8,%esp
+  800265:	68 ff 00 00 00       	push   $0xff
+  80026a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80026d:	50                   	push   %eax
+  80026e:	e8 84 09 00 00       	call   800bf7 <sys_cputs>
+		b->idx = 0;
+  800273:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800279:	83 c4 10             	add    $0x10,%esp
+  80027c:	eb db                	jmp    800259 <putch+0x1f>
+
+0080027e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800287:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80028e:	00 00 00 
+	b.cnt = 0;
+  800291:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800298:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029b:	ff 75 0c             	push   0xc(%ebp)
+  80029e:	ff 75 08             	push   0x8(%ebp)
+  8002a1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	68 3a 02 80 00       	push   $0x80023a
+  8002ad:	e8 14 01 00 00       	call   8003c6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b2:	83 c4 08             	add    $0x8,%esp
+  8002b5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002bb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c1:	50                   	push   %eax
+  8002c2:	e8 30 09 00 00       	call   800bf7 <sys_cputs>
+
+	return b.cnt;
+}
+  8002c7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+008002cf <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002d8:	50                   	push   %eax
+  8002d9:	ff 75 08             	push   0x8(%ebp)
+  8002dc:	e8 9d ff ff ff       	call   80027e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e1:	c9                   	leave
+  8002e2:	c3                   	ret
+
+008002e3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	57                   	push   %edi
+  8002e7:	56                   	push   %esi
+  8002e8:	53                   	push   %ebx
+  8002e9:	83 ec 1c             	sub    $0x1c,%esp
+  8002ec:	89 c7                	mov    %eax,%edi
+  8002ee:	89 d6                	mov    %edx,%esi
+  8002f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002f6:	89 d1                	mov    %edx,%ecx
+  8002f8:	89 c2                	mov    %eax,%edx
+  8002fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800300:	8b 45 10             	mov    0x10(%ebp),%eax
+  800303:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800306:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800309:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800310:	39 c2                	cmp    %eax,%edx
+  800312:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800315:	72 3e                	jb     800355 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800317:	83 ec 0c             	sub    $0xc,%esp
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	83 eb 01             	sub    $0x1,%ebx
+  800320:	53                   	push   %ebx
+  800321:	50                   	push   %eax
+  800322:	83 ec 08             	sub    $0x8,%esp
+  800325:	ff 75 e4             	push   -0x1c(%ebp)
+  800328:	ff 75 e0             	push   -0x20(%ebp)
+  80032b:	ff 75 dc             	push   -0x24(%ebp)
+  80032e:	ff 75 d8             	push   -0x28(%ebp)
+  800331:	e8 67 43 00 00       	call   80469d <__udivdi3>
+  800336:	83 c4 18             	add    $0x18,%esp
+  800339:	52                   	push   %edx
+  80033a:	50                   	push   %eax
+  80033b:	89 f2                	mov    %esi,%edx
+  80033d:	89 f8                	mov    %edi,%eax
+  80033f:	e8 9f ff ff ff       	call   8002e3 <printnum>
+  800344:	83 c4 20             	add    $0x20,%esp
+  800347:	eb 13                	jmp    80035c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800349:	83 ec 08             	sub    $0x8,%esp
+  80034c:	56                   	push   %esi
+  80034d:	ff 75 18             	push   0x18(%ebp)
+  800350:	ff d7                	call   *%edi
+  800352:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800355:	83 eb 01             	sub    $0x1,%ebx
+  800358:	85 db                	test   %ebx,%ebx
+  80035a:	7f ed                	jg     800349 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80035c:	83 ec 08             	sub    $0x8,%esp
+  80035f:	56                   	push   %esi
+  800360:	83 ec 04             	sub    $0x4,%esp
+  800363:	ff 75 e4             	push   -0x1c(%ebp)
+  800366:	ff 75 e0             	push   -0x20(%ebp)
+  800369:	ff 75 dc             	push   -0x24(%ebp)
+  80036c:	ff 75 d8             	push   -0x28(%ebp)
+  80036f:	e8 4a 43 00 00       	call   8046be <__umoddi3>
+  800374:	83 c4 14             	add    $0x14,%esp
+  800377:	0f be 80 80 48 80 00 	movsbl 0x804880(%eax),%eax
+  80037e:	50                   	push   %eax
+  80037f:	ff d7                	call   *%edi
+}
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+
+0080038c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800392:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800396:	8b 10                	mov    (%eax),%edx
+  800398:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039b:	73 0a                	jae    8003a7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80039d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a0:	89 08                	mov    %ecx,(%eax)
+  8003a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a5:	88 02                	mov    %al,(%edx)
+}
+  8003a7:	5d                   	pop    %ebp
+  8003a8:	c3                   	ret
+
+008003a9 <printfmt>:
+{
+  8003a9:	55                   	push   %ebp
+  8003aa:	89 e5                	mov    %esp,%ebp
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003af:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b2:	50                   	push   %eax
+  8003b3:	ff 75 10             	push   0x10(%ebp)
+  8003b6:	ff 75 0c             	push   0xc(%ebp)
+  8003b9:	ff 75 08             	push   0x8(%ebp)
+  8003bc:	e8 05 00 00 00       	call   8003c6 <vprintfmt>
+}
+  8003c1:	83 c4 10             	add    $0x10,%esp
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+
+008003c6 <vprintfmt>:
+{
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	57                   	push   %edi
+  8003ca:	56                   	push   %esi
+  8003cb:	53                   	push   %ebx
+  8003cc:	83 ec 2c             	sub    $0x2c,%esp
+  8003cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003d8:	eb 0a                	jmp    8003e4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003da:	83 ec 08             	sub    $0x8,%esp
+  8003dd:	53                   	push   %ebx
+  8003de:	50                   	push   %eax
+  8003df:	ff d6                	call   *%esi
+  8003e1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8003e4:	83 c7 01             	add    $0x1,%edi
+  8003e7:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8003eb:	83 f8 25             	cmp    $0x25,%eax
+  8003ee:	74 0c                	je     8003fc <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f0:	85 c0                	test   %eax,%eax
+  8003f2:	75 e6                	jne    8003da <vprintfmt+0x14>
+}
+  8003f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f7:	5b                   	pop    %ebx
+  8003f8:	5e                   	pop    %esi
+  8003f9:	5f                   	pop    %edi
+  8003fa:	5d                   	pop    %ebp
+  8003fb:	c3                   	ret
+		padc = ' ';
+  8003fc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800400:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800407:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80040e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800415:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80041a:	8d 47 01             	lea    0x1(%edi),%eax
+  80041d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800420:	0f b6 17             	movzbl (%edi),%edx
+  800423:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800426:	3c 55                	cmp    $0x55,%al
+  800428:	0f 87 c5 03 00 00    	ja     8007f3 <vprintfmt+0x42d>
+  80042e:	0f b6 c0             	movzbl %al,%eax
+  800431:	ff 24 85 00 4a 80 00 	jmp    *0x804a00(,%eax,4)
+  800438:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80043b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80043e:	eb da                	jmp    80041a <vprintfmt+0x54>
+  800440:	0f be d2             	movsbl %dl,%edx
+  800443:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80044e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800451:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800455:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800458:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80045b:	83 f9 09             	cmp    $0x9,%ecx
+  80045e:	77 55                	ja     8004b5 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800460:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800463:	eb e9                	jmp    80044e <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800465:	8b 45 14             	mov    0x14(%ebp),%eax
+  800468:	8b 00                	mov    (%eax),%eax
+  80046a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800470:	8d 40 04             	lea    0x4(%eax),%eax
+  800473:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800476:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800479:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047d:	79 9b                	jns    80041a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80047f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800482:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800485:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80048c:	eb 8c                	jmp    80041a <vprintfmt+0x54>
+			if (width < 0)
+  80048e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800491:	85 d2                	test   %edx,%edx
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	0f 49 c2             	cmovns %edx,%eax
+  80049b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80049e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004a1:	e9 74 ff ff ff       	jmp    80041a <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8004a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004a9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004b0:	e9 65 ff ff ff       	jmp    80041a <vprintfmt+0x54>
+  8004b5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004bb:	eb bc                	jmp    800479 <vprintfmt+0xb3>
+			lflag++;
+  8004bd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8004c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004c3:	e9 52 ff ff ff       	jmp    80041a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8d 78 04             	lea    0x4(%eax),%edi
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	53                   	push   %ebx
+  8004d2:	ff 30                	push   (%eax)
+  8004d4:	ff d6                	call   *%esi
+			break;
+  8004d6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004d9:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004dc:	e9 b1 02 00 00       	jmp    800792 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8004e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e4:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004e7:	8b 10                	mov    (%eax),%edx
+  8004e9:	89 d0                	mov    %edx,%eax
+  8004eb:	f7 d8                	neg    %eax
+  8004ed:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004f0:	83 f8 14             	cmp    $0x14,%eax
+  8004f3:	7f 23                	jg     800518 <vprintfmt+0x152>
+  8004f5:	8b 14 85 60 4b 80 00 	mov    0x804b60(,%eax,4),%edx
+  8004fc:	85 d2                	test   %edx,%edx
+  8004fe:	74 18                	je     800518 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800500:	52                   	push   %edx
+  800501:	68 a3 4d 80 00       	push   $0x804da3
+  800506:	53                   	push   %ebx
+  800507:	56                   	push   %esi
+  800508:	e8 9c fe ff ff       	call   8003a9 <printfmt>
+  80050d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800510:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800513:	e9 7a 02 00 00       	jmp    800792 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800518:	50                   	push   %eax
+  800519:	68 98 48 80 00       	push   $0x804898
+  80051e:	53                   	push   %ebx
+  80051f:	56                   	push   %esi
+  800520:	e8 84 fe ff ff       	call   8003a9 <printfmt>
+  800525:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800528:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80052b:	e9 62 02 00 00       	jmp    800792 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	83 c0 04             	add    $0x4,%eax
+  800536:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	b8 91 48 80 00       	mov    $0x804891,%eax
+  800545:	0f 45 c1             	cmovne %ecx,%eax
+  800548:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80054b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80054f:	7e 06                	jle    800557 <vprintfmt+0x191>
+  800551:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800555:	75 0b                	jne    800562 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800557:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80055a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80055d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800560:	eb 5c                	jmp    8005be <vprintfmt+0x1f8>
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	ff 75 d0             	push   -0x30(%ebp)
+  800568:	ff 75 cc             	push   -0x34(%ebp)
+  80056b:	e8 20 03 00 00       	call   800890 <strnlen>
+  800570:	89 c2                	mov    %eax,%edx
+  800572:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800575:	29 d0                	sub    %edx,%eax
+  800577:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80057a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80057e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800581:	89 75 08             	mov    %esi,0x8(%ebp)
+  800584:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800586:	eb 0e                	jmp    800596 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	57                   	push   %edi
+  80058d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800590:	83 ee 01             	sub    $0x1,%esi
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	85 f6                	test   %esi,%esi
+  800598:	7f ee                	jg     800588 <vprintfmt+0x1c2>
+  80059a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80059d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a0:	85 c0                	test   %eax,%eax
+  8005a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a7:	0f 49 d0             	cmovns %eax,%edx
+  8005aa:	29 d0                	sub    %edx,%eax
+  8005ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005af:	eb a6                	jmp    800557 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8005b1:	83 ec 08             	sub    $0x8,%esp
+  8005b4:	53                   	push   %ebx
+  8005b5:	52                   	push   %edx
+  8005b6:	ff 55 08             	call   *0x8(%ebp)
+  8005b9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005bc:	89 f1                	mov    %esi,%ecx
+  8005be:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005c1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005c5:	0f be d0             	movsbl %al,%edx
+  8005c8:	85 d2                	test   %edx,%edx
+  8005ca:	74 28                	je     8005f4 <vprintfmt+0x22e>
+  8005cc:	85 ff                	test   %edi,%edi
+  8005ce:	78 05                	js     8005d5 <vprintfmt+0x20f>
+  8005d0:	83 ef 01             	sub    $0x1,%edi
+  8005d3:	78 30                	js     800605 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005d5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005d9:	74 d6                	je     8005b1 <vprintfmt+0x1eb>
+  8005db:	0f be c0             	movsbl %al,%eax
+  8005de:	83 e8 20             	sub    $0x20,%eax
+  8005e1:	83 f8 5e             	cmp    $0x5e,%eax
+  8005e4:	76 cb                	jbe    8005b1 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8005e6:	83 ec 08             	sub    $0x8,%esp
+  8005e9:	53                   	push   %ebx
+  8005ea:	6a 3f                	push   $0x3f
+  8005ec:	ff 55 08             	call   *0x8(%ebp)
+  8005ef:	83 c4 10             	add    $0x10,%esp
+  8005f2:	eb c8                	jmp    8005bc <vprintfmt+0x1f6>
+  8005f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005fa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005fd:	01 d0                	add    %edx,%eax
+  8005ff:	29 c8                	sub    %ecx,%eax
+  800601:	89 c7                	mov    %eax,%edi
+  800603:	eb 13                	jmp    800618 <vprintfmt+0x252>
+  800605:	8b 75 08             	mov    0x8(%ebp),%esi
+  800608:	eb ed                	jmp    8005f7 <vprintfmt+0x231>
+				putch(' ', putdat);
+  80060a:	83 ec 08             	sub    $0x8,%esp
+  80060d:	53                   	push   %ebx
+  80060e:	6a 20                	push   $0x20
+  800610:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800612:	83 ef 01             	sub    $0x1,%edi
+  800615:	83 c4 10             	add    $0x10,%esp
+  800618:	85 ff                	test   %edi,%edi
+  80061a:	7f ee                	jg     80060a <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80061c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800622:	e9 6b 01 00 00       	jmp    800792 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800627:	83 f9 01             	cmp    $0x1,%ecx
+  80062a:	7f 1f                	jg     80064b <vprintfmt+0x285>
+	else if (lflag)
+  80062c:	85 c9                	test   %ecx,%ecx
+  80062e:	74 67                	je     800697 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8b 00                	mov    (%eax),%eax
+  800635:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800638:	89 c1                	mov    %eax,%ecx
+  80063a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80063d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8d 40 04             	lea    0x4(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+  800649:	eb 17                	jmp    800662 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 50 04             	mov    0x4(%eax),%edx
+  800651:	8b 00                	mov    (%eax),%eax
+  800653:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800656:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8d 40 08             	lea    0x8(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800662:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800665:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800668:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80066d:	85 c9                	test   %ecx,%ecx
+  80066f:	0f 89 03 01 00 00    	jns    800778 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800675:	83 ec 08             	sub    $0x8,%esp
+  800678:	53                   	push   %ebx
+  800679:	6a 2d                	push   $0x2d
+  80067b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80067d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800680:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800683:	f7 da                	neg    %edx
+  800685:	83 d1 00             	adc    $0x0,%ecx
+  800688:	f7 d9                	neg    %ecx
+  80068a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80068d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800692:	e9 e1 00 00 00       	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 00                	mov    (%eax),%eax
+  80069c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069f:	89 c1                	mov    %eax,%ecx
+  8006a1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b0:	eb b0                	jmp    800662 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8006b2:	83 f9 01             	cmp    $0x1,%ecx
+  8006b5:	7f 1e                	jg     8006d5 <vprintfmt+0x30f>
+	else if (lflag)
+  8006b7:	85 c9                	test   %ecx,%ecx
+  8006b9:	74 32                	je     8006ed <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8006bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006be:	8b 10                	mov    (%eax),%edx
+  8006c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006d0:	e9 a3 00 00 00       	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d8:	8b 10                	mov    (%eax),%edx
+  8006da:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e8:	e9 8b 00 00 00       	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006fd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800702:	eb 74                	jmp    800778 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800704:	83 f9 01             	cmp    $0x1,%ecx
+  800707:	7f 1b                	jg     800724 <vprintfmt+0x35e>
+	else if (lflag)
+  800709:	85 c9                	test   %ecx,%ecx
+  80070b:	74 2c                	je     800739 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80071d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800722:	eb 54                	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072c:	8d 40 08             	lea    0x8(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800732:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800737:	eb 3f                	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800743:	8d 40 04             	lea    0x4(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800749:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80074e:	eb 28                	jmp    800778 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 30                	push   $0x30
+  800756:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800758:	83 c4 08             	add    $0x8,%esp
+  80075b:	53                   	push   %ebx
+  80075c:	6a 78                	push   $0x78
+  80075e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 10                	mov    (%eax),%edx
+  800765:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80076a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80076d:	8d 40 04             	lea    0x4(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800773:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800778:	83 ec 0c             	sub    $0xc,%esp
+  80077b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	ff 75 e0             	push   -0x20(%ebp)
+  800783:	57                   	push   %edi
+  800784:	51                   	push   %ecx
+  800785:	52                   	push   %edx
+  800786:	89 da                	mov    %ebx,%edx
+  800788:	89 f0                	mov    %esi,%eax
+  80078a:	e8 54 fb ff ff       	call   8002e3 <printnum>
+			break;
+  80078f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800792:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800795:	e9 4a fc ff ff       	jmp    8003e4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80079a:	83 f9 01             	cmp    $0x1,%ecx
+  80079d:	7f 1b                	jg     8007ba <vprintfmt+0x3f4>
+	else if (lflag)
+  80079f:	85 c9                	test   %ecx,%ecx
+  8007a1:	74 2c                	je     8007cf <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007b8:	eb be                	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8b 10                	mov    (%eax),%edx
+  8007bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007cd:	eb a9                	jmp    800778 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8b 10                	mov    (%eax),%edx
+  8007d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007df:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007e4:	eb 92                	jmp    800778 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8007e6:	83 ec 08             	sub    $0x8,%esp
+  8007e9:	53                   	push   %ebx
+  8007ea:	6a 25                	push   $0x25
+  8007ec:	ff d6                	call   *%esi
+			break;
+  8007ee:	83 c4 10             	add    $0x10,%esp
+  8007f1:	eb 9f                	jmp    800792 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8007f3:	83 ec 08             	sub    $0x8,%esp
+  8007f6:	53                   	push   %ebx
+  8007f7:	6a 25                	push   $0x25
+  8007f9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007fb:	83 c4 10             	add    $0x10,%esp
+  8007fe:	89 f8                	mov    %edi,%eax
+  800800:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800804:	74 05                	je     80080b <vprintfmt+0x445>
+  800806:	83 e8 01             	sub    $0x1,%eax
+  800809:	eb f5                	jmp    800800 <vprintfmt+0x43a>
+  80080b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80080e:	eb 82                	jmp    800792 <vprintfmt+0x3cc>
+
+00800810 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	83 ec 18             	sub    $0x18,%esp
+  800816:	8b 45 08             	mov    0x8(%ebp),%eax
+  800819:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80081c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80081f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800823:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800826:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80082d:	85 c0                	test   %eax,%eax
+  80082f:	74 26                	je     800857 <vsnprintf+0x47>
+  800831:	85 d2                	test   %edx,%edx
+  800833:	7e 22                	jle    800857 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800835:	ff 75 14             	push   0x14(%ebp)
+  800838:	ff 75 10             	push   0x10(%ebp)
+  80083b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80083e:	50                   	push   %eax
+  80083f:	68 8c 03 80 00       	push   $0x80038c
+  800844:	e8 7d fb ff ff       	call   8003c6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800849:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80084c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80084f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800852:	83 c4 10             	add    $0x10,%esp
+}
+  800855:	c9                   	leave
+  800856:	c3                   	ret
+		return -E_INVAL;
+  800857:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80085c:	eb f7                	jmp    800855 <vsnprintf+0x45>
+
+0080085e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80085e:	55                   	push   %ebp
+  80085f:	89 e5                	mov    %esp,%ebp
+  800861:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800864:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800867:	50                   	push   %eax
+  800868:	ff 75 10             	push   0x10(%ebp)
+  80086b:	ff 75 0c             	push   0xc(%ebp)
+  80086e:	ff 75 08             	push   0x8(%ebp)
+  800871:	e8 9a ff ff ff       	call   800810 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800876:	c9                   	leave
+  800877:	c3                   	ret
+
+00800878 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80087e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800883:	eb 03                	jmp    800888 <strlen+0x10>
+		n++;
+  800885:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800888:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80088c:	75 f7                	jne    800885 <strlen+0xd>
+	return n;
+}
+  80088e:	5d                   	pop    %ebp
+  80088f:	c3                   	ret
+
+00800890 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800890:	55                   	push   %ebp
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800896:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089e:	eb 03                	jmp    8008a3 <strnlen+0x13>
+		n++;
+  8008a0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a3:	39 d0                	cmp    %edx,%eax
+  8008a5:	74 08                	je     8008af <strnlen+0x1f>
+  8008a7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ab:	75 f3                	jne    8008a0 <strnlen+0x10>
+  8008ad:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008af:	89 d0                	mov    %edx,%eax
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	c3                   	ret
+
+008008b3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	53                   	push   %ebx
+  8008b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008c9:	83 c0 01             	add    $0x1,%eax
+  8008cc:	84 d2                	test   %dl,%dl
+  8008ce:	75 f2                	jne    8008c2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008d0:	89 c8                	mov    %ecx,%eax
+  8008d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d5:	c9                   	leave
+  8008d6:	c3                   	ret
+
+008008d7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	53                   	push   %ebx
+  8008db:	83 ec 10             	sub    $0x10,%esp
+  8008de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008e1:	53                   	push   %ebx
+  8008e2:	e8 91 ff ff ff       	call   800878 <strlen>
+  8008e7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008ea:	ff 75 0c             	push   0xc(%ebp)
+  8008ed:	01 d8                	add    %ebx,%eax
+  8008ef:	50                   	push   %eax
+  8008f0:	e8 be ff ff ff       	call   8008b3 <strcpy>
+	return dst;
+}
+  8008f5:	89 d8                	mov    %ebx,%eax
+  8008f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008fa:	c9                   	leave
+  8008fb:	c3                   	ret
+
+008008fc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	56                   	push   %esi
+  800900:	53                   	push   %ebx
+  800901:	8b 75 08             	mov    0x8(%ebp),%esi
+  800904:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800907:	89 f3                	mov    %esi,%ebx
+  800909:	03 5d 10             	add    0x10(%ebp),%ebx
+  80090c:	89 f0                	mov    %esi,%eax
+  80090e:	eb 0f                	jmp    80091f <strncpy+0x23>
+		*dst++ = *src;
+  800910:	83 c0 01             	add    $0x1,%eax
+  800913:	0f b6 0a             	movzbl (%edx),%ecx
+  800916:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800919:	80 f9 01             	cmp    $0x1,%cl
+  80091c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80091f:	39 d8                	cmp    %ebx,%eax
+  800921:	75 ed                	jne    800910 <strncpy+0x14>
+	}
+	return ret;
+}
+  800923:	89 f0                	mov    %esi,%eax
+  800925:	5b                   	pop    %ebx
+  800926:	5e                   	pop    %esi
+  800927:	5d                   	pop    %ebp
+  800928:	c3                   	ret
+
+00800929 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	56                   	push   %esi
+  80092d:	53                   	push   %ebx
+  80092e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800934:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800937:	89 f0                	mov    %esi,%eax
+  800939:	85 d2                	test   %edx,%edx
+  80093b:	74 21                	je     80095e <strlcpy+0x35>
+  80093d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800941:	89 f2                	mov    %esi,%edx
+  800943:	eb 09                	jmp    80094e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800945:	83 c1 01             	add    $0x1,%ecx
+  800948:	83 c2 01             	add    $0x1,%edx
+  80094b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80094e:	39 c2                	cmp    %eax,%edx
+  800950:	74 09                	je     80095b <strlcpy+0x32>
+  800952:	0f b6 19             	movzbl (%ecx),%ebx
+  800955:	84 db                	test   %bl,%bl
+  800957:	75 ec                	jne    800945 <strlcpy+0x1c>
+  800959:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80095b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80095e:	29 f0                	sub    %esi,%eax
+}
+  800960:	5b                   	pop    %ebx
+  800961:	5e                   	pop    %esi
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80096d:	eb 06                	jmp    800975 <strcmp+0x11>
+		p++, q++;
+  80096f:	83 c1 01             	add    $0x1,%ecx
+  800972:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800975:	0f b6 01             	movzbl (%ecx),%eax
+  800978:	84 c0                	test   %al,%al
+  80097a:	74 04                	je     800980 <strcmp+0x1c>
+  80097c:	3a 02                	cmp    (%edx),%al
+  80097e:	74 ef                	je     80096f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800980:	0f b6 c0             	movzbl %al,%eax
+  800983:	0f b6 12             	movzbl (%edx),%edx
+  800986:	29 d0                	sub    %edx,%eax
+}
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	53                   	push   %ebx
+  80098e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800991:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800994:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800997:	eb 09                	jmp    8009a2 <strncmp+0x18>
+		n--, p++, q++;
+  800999:	83 ea 01             	sub    $0x1,%edx
+  80099c:	83 c0 01             	add    $0x1,%eax
+  80099f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009a2:	85 d2                	test   %edx,%edx
+  8009a4:	74 18                	je     8009be <strncmp+0x34>
+  8009a6:	0f b6 18             	movzbl (%eax),%ebx
+  8009a9:	84 db                	test   %bl,%bl
+  8009ab:	74 04                	je     8009b1 <strncmp+0x27>
+  8009ad:	3a 19                	cmp    (%ecx),%bl
+  8009af:	74 e8                	je     800999 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b1:	0f b6 00             	movzbl (%eax),%eax
+  8009b4:	0f b6 11             	movzbl (%ecx),%edx
+  8009b7:	29 d0                	sub    %edx,%eax
+}
+  8009b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009bc:	c9                   	leave
+  8009bd:	c3                   	ret
+		return 0;
+  8009be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c3:	eb f4                	jmp    8009b9 <strncmp+0x2f>
+
+008009c5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009cf:	eb 03                	jmp    8009d4 <strchr+0xf>
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  8009d4:	0f b6 10             	movzbl (%eax),%edx
+  8009d7:	84 d2                	test   %dl,%dl
+  8009d9:	74 06                	je     8009e1 <strchr+0x1c>
+		if (*s == c)
+  8009db:	38 ca                	cmp    %cl,%dl
+  8009dd:	75 f2                	jne    8009d1 <strchr+0xc>
+  8009df:	eb 05                	jmp    8009e6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009f2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009f5:	38 ca                	cmp    %cl,%dl
+  8009f7:	74 09                	je     800a02 <strfind+0x1a>
+  8009f9:	84 d2                	test   %dl,%dl
+  8009fb:	74 05                	je     800a02 <strfind+0x1a>
+	for (; *s; s++)
+  8009fd:	83 c0 01             	add    $0x1,%eax
+  800a00:	eb f0                	jmp    8009f2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+
+00800a04 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	57                   	push   %edi
+  800a08:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a0b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a0e:	85 c9                	test   %ecx,%ecx
+  800a10:	74 20                	je     800a32 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a12:	89 f8                	mov    %edi,%eax
+  800a14:	09 c8                	or     %ecx,%eax
+  800a16:	a8 03                	test   $0x3,%al
+  800a18:	75 12                	jne    800a2c <memset+0x28>
+		c &= 0xFF;
+  800a1a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a1e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a24:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a27:	fc                   	cld
+  800a28:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a2a:	eb 06                	jmp    800a32 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2f:	fc                   	cld
+  800a30:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a32:	89 f8                	mov    %edi,%eax
+  800a34:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+00800a39 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	57                   	push   %edi
+  800a3d:	56                   	push   %esi
+  800a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a41:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a44:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a47:	39 c6                	cmp    %eax,%esi
+  800a49:	73 32                	jae    800a7d <memmove+0x44>
+  800a4b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a4e:	39 d0                	cmp    %edx,%eax
+  800a50:	73 2b                	jae    800a7d <memmove+0x44>
+		s += n;
+		d += n;
+  800a52:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a55:	89 d6                	mov    %edx,%esi
+  800a57:	09 fe                	or     %edi,%esi
+  800a59:	09 ce                	or     %ecx,%esi
+  800a5b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a61:	75 0e                	jne    800a71 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a63:	83 ef 04             	sub    $0x4,%edi
+  800a66:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a69:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a6c:	fd                   	std
+  800a6d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6f:	eb 09                	jmp    800a7a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a71:	83 ef 01             	sub    $0x1,%edi
+  800a74:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a77:	fd                   	std
+  800a78:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a7a:	fc                   	cld
+  800a7b:	eb 1a                	jmp    800a97 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7d:	89 f2                	mov    %esi,%edx
+  800a7f:	09 c2                	or     %eax,%edx
+  800a81:	09 ca                	or     %ecx,%edx
+  800a83:	f6 c2 03             	test   $0x3,%dl
+  800a86:	75 0a                	jne    800a92 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a8b:	89 c7                	mov    %eax,%edi
+  800a8d:	fc                   	cld
+  800a8e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a90:	eb 05                	jmp    800a97 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a92:	89 c7                	mov    %eax,%edi
+  800a94:	fc                   	cld
+  800a95:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a97:	5e                   	pop    %esi
+  800a98:	5f                   	pop    %edi
+  800a99:	5d                   	pop    %ebp
+  800a9a:	c3                   	ret
+
+00800a9b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aa1:	ff 75 10             	push   0x10(%ebp)
+  800aa4:	ff 75 0c             	push   0xc(%ebp)
+  800aa7:	ff 75 08             	push   0x8(%ebp)
+  800aaa:	e8 8a ff ff ff       	call   800a39 <memmove>
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	56                   	push   %esi
+  800ab5:	53                   	push   %ebx
+  800ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800abc:	89 c6                	mov    %eax,%esi
+  800abe:	03 75 10             	add    0x10(%ebp),%esi
+  800ac1:	eb 06                	jmp    800ac9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ac3:	83 c0 01             	add    $0x1,%eax
+  800ac6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ac9:	39 f0                	cmp    %esi,%eax
+  800acb:	74 14                	je     800ae1 <memcmp+0x30>
+		if (*s1 != *s2)
+  800acd:	0f b6 08             	movzbl (%eax),%ecx
+  800ad0:	0f b6 1a             	movzbl (%edx),%ebx
+  800ad3:	38 d9                	cmp    %bl,%cl
+  800ad5:	74 ec                	je     800ac3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ad7:	0f b6 c1             	movzbl %cl,%eax
+  800ada:	0f b6 db             	movzbl %bl,%ebx
+  800add:	29 d8                	sub    %ebx,%eax
+  800adf:	eb 05                	jmp    800ae6 <memcmp+0x35>
+	}
+
+	return 0;
+  800ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae6:	5b                   	pop    %ebx
+  800ae7:	5e                   	pop    %esi
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800af8:	eb 03                	jmp    800afd <memfind+0x13>
+  800afa:	83 c0 01             	add    $0x1,%eax
+  800afd:	39 d0                	cmp    %edx,%eax
+  800aff:	73 04                	jae    800b05 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b01:	38 08                	cmp    %cl,(%eax)
+  800b03:	75 f5                	jne    800afa <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+
+00800b07 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	57                   	push   %edi
+  800b0b:	56                   	push   %esi
+  800b0c:	53                   	push   %ebx
+  800b0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b13:	eb 03                	jmp    800b18 <strtol+0x11>
+		s++;
+  800b15:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b18:	0f b6 02             	movzbl (%edx),%eax
+  800b1b:	3c 20                	cmp    $0x20,%al
+  800b1d:	74 f6                	je     800b15 <strtol+0xe>
+  800b1f:	3c 09                	cmp    $0x9,%al
+  800b21:	74 f2                	je     800b15 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b23:	3c 2b                	cmp    $0x2b,%al
+  800b25:	74 2a                	je     800b51 <strtol+0x4a>
+	int neg = 0;
+  800b27:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b2c:	3c 2d                	cmp    $0x2d,%al
+  800b2e:	74 2b                	je     800b5b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b30:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b36:	75 0f                	jne    800b47 <strtol+0x40>
+  800b38:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b3b:	74 28                	je     800b65 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b3d:	85 db                	test   %ebx,%ebx
+  800b3f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b44:	0f 44 d8             	cmove  %eax,%ebx
+  800b47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b4f:	eb 46                	jmp    800b97 <strtol+0x90>
+		s++;
+  800b51:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b59:	eb d5                	jmp    800b30 <strtol+0x29>
+		s++, neg = 1;
+  800b5b:	83 c2 01             	add    $0x1,%edx
+  800b5e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b63:	eb cb                	jmp    800b30 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b65:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b69:	74 0e                	je     800b79 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b6b:	85 db                	test   %ebx,%ebx
+  800b6d:	75 d8                	jne    800b47 <strtol+0x40>
+		s++, base = 8;
+  800b6f:	83 c2 01             	add    $0x1,%edx
+  800b72:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b77:	eb ce                	jmp    800b47 <strtol+0x40>
+		s += 2, base = 16;
+  800b79:	83 c2 02             	add    $0x2,%edx
+  800b7c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b81:	eb c4                	jmp    800b47 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b83:	0f be c0             	movsbl %al,%eax
+  800b86:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b89:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b8c:	7d 3a                	jge    800bc8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b8e:	83 c2 01             	add    $0x1,%edx
+  800b91:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b95:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b97:	0f b6 02             	movzbl (%edx),%eax
+  800b9a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b9d:	89 f3                	mov    %esi,%ebx
+  800b9f:	80 fb 09             	cmp    $0x9,%bl
+  800ba2:	76 df                	jbe    800b83 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ba4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ba7:	89 f3                	mov    %esi,%ebx
+  800ba9:	80 fb 19             	cmp    $0x19,%bl
+  800bac:	77 08                	ja     800bb6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bae:	0f be c0             	movsbl %al,%eax
+  800bb1:	83 e8 57             	sub    $0x57,%eax
+  800bb4:	eb d3                	jmp    800b89 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bb6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bb9:	89 f3                	mov    %esi,%ebx
+  800bbb:	80 fb 19             	cmp    $0x19,%bl
+  800bbe:	77 08                	ja     800bc8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bc0:	0f be c0             	movsbl %al,%eax
+  800bc3:	83 e8 37             	sub    $0x37,%eax
+  800bc6:	eb c1                	jmp    800b89 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bc8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bcc:	74 05                	je     800bd3 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bd1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bd3:	89 c8                	mov    %ecx,%eax
+  800bd5:	f7 d8                	neg    %eax
+  800bd7:	85 ff                	test   %edi,%edi
+  800bd9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bdc:	89 c8                	mov    %ecx,%eax
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800be9:	6a 00                	push   $0x0
+  800beb:	6a 00                	push   $0x0
+  800bed:	ff 75 08             	push   0x8(%ebp)
+  800bf0:	e8 12 ff ff ff       	call   800b07 <strtol>
+}
+  800bf5:	c9                   	leave
+  800bf6:	c3                   	ret
+
+00800bf7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	57                   	push   %edi
+  800bfb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c07:	89 c3                	mov    %eax,%ebx
+  800c09:	89 c7                	mov    %eax,%edi
+  800c0b:	6a 00                	push   $0x0
+  800c0d:	55                   	push   %ebp
+  800c0e:	56                   	push   %esi
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	8d 35 19 0c 80 00    	lea    0x800c19,%esi
+  800c17:	0f 34                	sysenter
+
+00800c19 <after_sysenter_label_47>:
+  800c19:	5e                   	pop    %esi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c1e:	5b                   	pop    %ebx
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c31:	89 d1                	mov    %edx,%ecx
+  800c33:	89 d3                	mov    %edx,%ebx
+  800c35:	89 d7                	mov    %edx,%edi
+  800c37:	6a 00                	push   $0x0
+  800c39:	55                   	push   %ebp
+  800c3a:	56                   	push   %esi
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	8d 35 45 0c 80 00    	lea    0x800c45,%esi
+  800c43:	0f 34                	sysenter
+
+00800c45 <after_sysenter_label_128>:
+  800c45:	5e                   	pop    %esi
+  800c46:	5d                   	pop    %ebp
+  800c47:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	57                   	push   %edi
+  800c52:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c60:	89 cb                	mov    %ecx,%ebx
+  800c62:	89 cf                	mov    %ecx,%edi
+  800c64:	6a 00                	push   $0x0
+  800c66:	55                   	push   %ebp
+  800c67:	56                   	push   %esi
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	8d 35 72 0c 80 00    	lea    0x800c72,%esi
+  800c70:	0f 34                	sysenter
+
+00800c72 <after_sysenter_label_212>:
+  800c72:	5e                   	pop    %esi
+  800c73:	5d                   	pop    %ebp
+  800c74:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c77:	85 c0                	test   %eax,%eax
+  800c79:	7f 07                	jg     800c82 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7e:	5b                   	pop    %ebx
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+  800c85:	50                   	push   %eax
+  800c86:	6a 03                	push   $0x3
+  800c88:	68 f5 4b 80 00       	push   $0x804bf5
+  800c8d:	6a 54                	push   $0x54
+  800c8f:	68 12 4c 80 00       	push   $0x804c12
+  800c94:	e8 39 38 00 00       	call   8044d2 <_panic>
+
+00800c99 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca8:	89 d1                	mov    %edx,%ecx
+  800caa:	89 d3                	mov    %edx,%ebx
+  800cac:	89 d7                	mov    %edx,%edi
+  800cae:	6a 00                	push   $0x0
+  800cb0:	55                   	push   %ebp
+  800cb1:	56                   	push   %esi
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	8d 35 bc 0c 80 00    	lea    0x800cbc,%esi
+  800cba:	0f 34                	sysenter
+
+00800cbc <after_sysenter_label_309>:
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+
+00800cc5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd4:	89 d1                	mov    %edx,%ecx
+  800cd6:	89 d3                	mov    %edx,%ebx
+  800cd8:	89 d7                	mov    %edx,%edi
+  800cda:	6a 00                	push   $0x0
+  800cdc:	55                   	push   %ebp
+  800cdd:	56                   	push   %esi
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	8d 35 e8 0c 80 00    	lea    0x800ce8,%esi
+  800ce6:	0f 34                	sysenter
+
+00800ce8 <after_sysenter_label_391>:
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5d                   	pop    %ebp
+  800cea:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ced:	5b                   	pop    %ebx
+  800cee:	5f                   	pop    %edi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d09:	6a 00                	push   $0x0
+  800d0b:	55                   	push   %ebp
+  800d0c:	56                   	push   %esi
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	8d 35 17 0d 80 00    	lea    0x800d17,%esi
+  800d15:	0f 34                	sysenter
+
+00800d17 <after_sysenter_label_479>:
+  800d17:	5e                   	pop    %esi
+  800d18:	5d                   	pop    %ebp
+  800d19:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d1c:	85 c0                	test   %eax,%eax
+  800d1e:	7f 07                	jg     800d27 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d23:	5b                   	pop    %ebx
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d27:	83 ec 0c             	sub    $0xc,%esp
+  800d2a:	50                   	push   %eax
+  800d2b:	6a 04                	push   $0x4
+  800d2d:	68 f5 4b 80 00       	push   $0x804bf5
+  800d32:	6a 54                	push   $0x54
+  800d34:	68 12 4c 80 00       	push   $0x804c12
+  800d39:	e8 94 37 00 00       	call   8044d2 <_panic>
+
+00800d3e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d49:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d51:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d54:	ff 75 18             	push   0x18(%ebp)
+  800d57:	55                   	push   %ebp
+  800d58:	56                   	push   %esi
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	8d 35 63 0d 80 00    	lea    0x800d63,%esi
+  800d61:	0f 34                	sysenter
+
+00800d63 <after_sysenter_label_593>:
+  800d63:	5e                   	pop    %esi
+  800d64:	5d                   	pop    %ebp
+  800d65:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d68:	85 c0                	test   %eax,%eax
+  800d6a:	7f 07                	jg     800d73 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5f                   	pop    %edi
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	50                   	push   %eax
+  800d77:	6a 05                	push   $0x5
+  800d79:	68 f5 4b 80 00       	push   $0x804bf5
+  800d7e:	6a 54                	push   $0x54
+  800d80:	68 12 4c 80 00       	push   $0x804c12
+  800d85:	e8 48 37 00 00       	call   8044d2 <_panic>
+
+00800d8a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d9f:	89 df                	mov    %ebx,%edi
+  800da1:	6a 00                	push   $0x0
+  800da3:	55                   	push   %ebp
+  800da4:	56                   	push   %esi
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	8d 35 af 0d 80 00    	lea    0x800daf,%esi
+  800dad:	0f 34                	sysenter
+
+00800daf <after_sysenter_label_704>:
+  800daf:	5e                   	pop    %esi
+  800db0:	5d                   	pop    %ebp
+  800db1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	7f 07                	jg     800dbf <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800db8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	50                   	push   %eax
+  800dc3:	6a 06                	push   $0x6
+  800dc5:	68 f5 4b 80 00       	push   $0x804bf5
+  800dca:	6a 54                	push   $0x54
+  800dcc:	68 12 4c 80 00       	push   $0x804c12
+  800dd1:	e8 fc 36 00 00       	call   8044d2 <_panic>
+
+00800dd6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	57                   	push   %edi
+  800dda:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ddb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800deb:	89 df                	mov    %ebx,%edi
+  800ded:	6a 00                	push   $0x0
+  800def:	55                   	push   %ebp
+  800df0:	56                   	push   %esi
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	8d 35 fb 0d 80 00    	lea    0x800dfb,%esi
+  800df9:	0f 34                	sysenter
+
+00800dfb <after_sysenter_label_808>:
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	7f 07                	jg     800e0b <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e07:	5b                   	pop    %ebx
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+  800e0e:	50                   	push   %eax
+  800e0f:	6a 08                	push   $0x8
+  800e11:	68 f5 4b 80 00       	push   $0x804bf5
+  800e16:	6a 54                	push   $0x54
+  800e18:	68 12 4c 80 00       	push   $0x804c12
+  800e1d:	e8 b0 36 00 00       	call   8044d2 <_panic>
+
+00800e22 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e37:	89 df                	mov    %ebx,%edi
+  800e39:	6a 00                	push   $0x0
+  800e3b:	55                   	push   %ebp
+  800e3c:	56                   	push   %esi
+  800e3d:	89 e5                	mov    %esp,%ebp
+  800e3f:	8d 35 47 0e 80 00    	lea    0x800e47,%esi
+  800e45:	0f 34                	sysenter
+
+00800e47 <after_sysenter_label_912>:
+  800e47:	5e                   	pop    %esi
+  800e48:	5d                   	pop    %ebp
+  800e49:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	7f 07                	jg     800e57 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e53:	5b                   	pop    %ebx
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+  800e5a:	50                   	push   %eax
+  800e5b:	6a 09                	push   $0x9
+  800e5d:	68 f5 4b 80 00       	push   $0x804bf5
+  800e62:	6a 54                	push   $0x54
+  800e64:	68 12 4c 80 00       	push   $0x804c12
+  800e69:	e8 64 36 00 00       	call   8044d2 <_panic>
+
+00800e6e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	6a 00                	push   $0x0
+  800e87:	55                   	push   %ebp
+  800e88:	56                   	push   %esi
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	8d 35 93 0e 80 00    	lea    0x800e93,%esi
+  800e91:	0f 34                	sysenter
+
+00800e93 <after_sysenter_label_1016>:
+  800e93:	5e                   	pop    %esi
+  800e94:	5d                   	pop    %ebp
+  800e95:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e98:	85 c0                	test   %eax,%eax
+  800e9a:	7f 07                	jg     800ea3 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e9f:	5b                   	pop    %ebx
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea3:	83 ec 0c             	sub    $0xc,%esp
+  800ea6:	50                   	push   %eax
+  800ea7:	6a 0a                	push   $0xa
+  800ea9:	68 f5 4b 80 00       	push   $0x804bf5
+  800eae:	6a 54                	push   $0x54
+  800eb0:	68 12 4c 80 00       	push   $0x804c12
+  800eb5:	e8 18 36 00 00       	call   8044d2 <_panic>
+
+00800eba <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	57                   	push   %edi
+  800ebe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed0:	6a 00                	push   $0x0
+  800ed2:	55                   	push   %ebp
+  800ed3:	56                   	push   %esi
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	8d 35 de 0e 80 00    	lea    0x800ede,%esi
+  800edc:	0f 34                	sysenter
+
+00800ede <after_sysenter_label_1126>:
+  800ede:	5e                   	pop    %esi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+
+00800ee7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef9:	89 cb                	mov    %ecx,%ebx
+  800efb:	89 cf                	mov    %ecx,%edi
+  800efd:	6a 00                	push   $0x0
+  800eff:	55                   	push   %ebp
+  800f00:	56                   	push   %esi
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8d 35 0b 0f 80 00    	lea    0x800f0b,%esi
+  800f09:	0f 34                	sysenter
+
+00800f0b <after_sysenter_label_1210>:
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	7f 07                	jg     800f1b <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f17:	5b                   	pop    %ebx
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1b:	83 ec 0c             	sub    $0xc,%esp
+  800f1e:	50                   	push   %eax
+  800f1f:	6a 0d                	push   $0xd
+  800f21:	68 f5 4b 80 00       	push   $0x804bf5
+  800f26:	6a 54                	push   $0x54
+  800f28:	68 12 4c 80 00       	push   $0x804c12
+  800f2d:	e8 a0 35 00 00       	call   8044d2 <_panic>
+
+00800f32 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f47:	89 df                	mov    %ebx,%edi
+  800f49:	6a 00                	push   $0x0
+  800f4b:	55                   	push   %ebp
+  800f4c:	56                   	push   %esi
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	8d 35 57 0f 80 00    	lea    0x800f57,%esi
+  800f55:	0f 34                	sysenter
+
+00800f57 <after_sysenter_label_1311>:
+  800f57:	5e                   	pop    %esi
+  800f58:	5d                   	pop    %ebp
+  800f59:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	7f 07                	jg     800f67 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f63:	5b                   	pop    %ebx
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	50                   	push   %eax
+  800f6b:	6a 42                	push   $0x42
+  800f6d:	68 f5 4b 80 00       	push   $0x804bf5
+  800f72:	6a 54                	push   $0x54
+  800f74:	68 12 4c 80 00       	push   $0x804c12
+  800f79:	e8 54 35 00 00       	call   8044d2 <_panic>
+
+00800f7e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f88:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f8d:	89 d1                	mov    %edx,%ecx
+  800f8f:	89 d3                	mov    %edx,%ebx
+  800f91:	89 d7                	mov    %edx,%edi
+  800f93:	6a 00                	push   $0x0
+  800f95:	55                   	push   %ebp
+  800f96:	56                   	push   %esi
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	8d 35 a1 0f 80 00    	lea    0x800fa1,%esi
+  800f9f:	0f 34                	sysenter
+
+00800fa1 <after_sysenter_label_1411>:
+  800fa1:	5e                   	pop    %esi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fbf:	89 df                	mov    %ebx,%edi
+  800fc1:	6a 00                	push   $0x0
+  800fc3:	55                   	push   %ebp
+  800fc4:	56                   	push   %esi
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	8d 35 cf 0f 80 00    	lea    0x800fcf,%esi
+  800fcd:	0f 34                	sysenter
+
+00800fcf <after_sysenter_label_1497>:
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5f                   	pop    %edi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	c3                   	ret
+
+00800fd8 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fed:	89 df                	mov    %ebx,%edi
+  800fef:	6a 00                	push   $0x0
+  800ff1:	55                   	push   %ebp
+  800ff2:	56                   	push   %esi
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	8d 35 fd 0f 80 00    	lea    0x800ffd,%esi
+  800ffb:	0f 34                	sysenter
+
+00800ffd <after_sysenter_label_1583>:
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801002:	5b                   	pop    %ebx
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+
+00801006 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 11 00 00 00       	mov    $0x11,%eax
+  801016:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101e:	6a 00                	push   $0x0
+  801020:	55                   	push   %ebp
+  801021:	56                   	push   %esi
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	8d 35 2c 10 80 00    	lea    0x80102c,%esi
+  80102a:	0f 34                	sysenter
+
+0080102c <after_sysenter_label_1672>:
+  80102c:	5e                   	pop    %esi
+  80102d:	5d                   	pop    %ebp
+  80102e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 12 00 00 00       	mov    $0x12,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	6a 00                	push   $0x0
+  80104e:	55                   	push   %ebp
+  80104f:	56                   	push   %esi
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	8d 35 5a 10 80 00    	lea    0x80105a,%esi
+  801058:	0f 34                	sysenter
+
+0080105a <after_sysenter_label_1758>:
+  80105a:	5e                   	pop    %esi
+  80105b:	5d                   	pop    %ebp
+  80105c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80105f:	5b                   	pop    %ebx
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+
+00801063 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801070:	b8 13 00 00 00       	mov    $0x13,%eax
+  801075:	89 cb                	mov    %ecx,%ebx
+  801077:	89 cf                	mov    %ecx,%edi
+  801079:	6a 00                	push   $0x0
+  80107b:	55                   	push   %ebp
+  80107c:	56                   	push   %esi
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	8d 35 87 10 80 00    	lea    0x801087,%esi
+  801085:	0f 34                	sysenter
+
+00801087 <after_sysenter_label_1842>:
+  801087:	5e                   	pop    %esi
+  801088:	5d                   	pop    %ebp
+  801089:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80108c:	85 c0                	test   %eax,%eax
+  80108e:	7f 07                	jg     801097 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801093:	5b                   	pop    %ebx
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801097:	83 ec 0c             	sub    $0xc,%esp
+  80109a:	50                   	push   %eax
+  80109b:	6a 13                	push   $0x13
+  80109d:	68 f5 4b 80 00       	push   $0x804bf5
+  8010a2:	6a 54                	push   $0x54
+  8010a4:	68 12 4c 80 00       	push   $0x804c12
+  8010a9:	e8 24 34 00 00       	call   8044d2 <_panic>
+
+008010ae <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	57                   	push   %edi
+  8010b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010bd:	89 d1                	mov    %edx,%ecx
+  8010bf:	89 d3                	mov    %edx,%ebx
+  8010c1:	89 d7                	mov    %edx,%edi
+  8010c3:	6a 00                	push   $0x0
+  8010c5:	55                   	push   %ebp
+  8010c6:	56                   	push   %esi
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	8d 35 d1 10 80 00    	lea    0x8010d1,%esi
+  8010cf:	0f 34                	sysenter
+
+008010d1 <after_sysenter_label_1939>:
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f2:	6a 00                	push   $0x0
+  8010f4:	55                   	push   %ebp
+  8010f5:	56                   	push   %esi
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	8d 35 00 11 80 00    	lea    0x801100,%esi
+  8010fe:	0f 34                	sysenter
+
+00801100 <after_sysenter_label_2028>:
+  801100:	5e                   	pop    %esi
+  801101:	5d                   	pop    %ebp
+  801102:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801105:	5b                   	pop    %ebx
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80110e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801119:	b8 16 00 00 00       	mov    $0x16,%eax
+  80111e:	89 df                	mov    %ebx,%edi
+  801120:	6a 00                	push   $0x0
+  801122:	55                   	push   %ebp
+  801123:	56                   	push   %esi
+  801124:	89 e5                	mov    %esp,%ebp
+  801126:	8d 35 2e 11 80 00    	lea    0x80112e,%esi
+  80112c:	0f 34                	sysenter
+
+0080112e <after_sysenter_label_2114>:
+  80112e:	5e                   	pop    %esi
+  80112f:	5d                   	pop    %ebp
+  801130:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801133:	5b                   	pop    %ebx
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+
+00801137 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80113c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801147:	b8 17 00 00 00       	mov    $0x17,%eax
+  80114c:	89 df                	mov    %ebx,%edi
+  80114e:	6a 00                	push   $0x0
+  801150:	55                   	push   %ebp
+  801151:	56                   	push   %esi
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	8d 35 5c 11 80 00    	lea    0x80115c,%esi
+  80115a:	0f 34                	sysenter
+
+0080115c <after_sysenter_label_2200>:
+  80115c:	5e                   	pop    %esi
+  80115d:	5d                   	pop    %ebp
+  80115e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801161:	5b                   	pop    %ebx
+  801162:	5f                   	pop    %edi
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+
+00801165 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80116a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801175:	b8 18 00 00 00       	mov    $0x18,%eax
+  80117a:	89 df                	mov    %ebx,%edi
+  80117c:	6a 00                	push   $0x0
+  80117e:	55                   	push   %ebp
+  80117f:	56                   	push   %esi
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	8d 35 8a 11 80 00    	lea    0x80118a,%esi
+  801188:	0f 34                	sysenter
+
+0080118a <after_sysenter_label_2286>:
+  80118a:	5e                   	pop    %esi
+  80118b:	5d                   	pop    %ebp
+  80118c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80118f:	5b                   	pop    %ebx
+  801190:	5f                   	pop    %edi
+  801191:	5d                   	pop    %ebp
+  801192:	c3                   	ret
+
+00801193 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801193:	55                   	push   %ebp
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	57                   	push   %edi
+  801197:	56                   	push   %esi
+  801198:	53                   	push   %ebx
+  801199:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80119c:	89 d6                	mov    %edx,%esi
+  80119e:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8011a1:	89 cf                	mov    %ecx,%edi
+  8011a3:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8011a6:	89 fa                	mov    %edi,%edx
+  8011a8:	80 ce 08             	or     $0x8,%dh
+  8011ab:	f6 c5 08             	test   $0x8,%ch
+  8011ae:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8011b1:	57                   	push   %edi
+  8011b2:	56                   	push   %esi
+  8011b3:	50                   	push   %eax
+  8011b4:	56                   	push   %esi
+  8011b5:	6a 00                	push   $0x0
+  8011b7:	e8 82 fb ff ff       	call   800d3e <sys_page_map>
+	if (r < 0) {
+  8011bc:	83 c4 20             	add    $0x20,%esp
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	78 27                	js     8011ea <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8011c3:	83 ec 0c             	sub    $0xc,%esp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	6a 00                	push   $0x0
+  8011ca:	56                   	push   %esi
+  8011cb:	6a 00                	push   $0x0
+  8011cd:	e8 6c fb ff ff       	call   800d3e <sys_page_map>
+  8011d2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011d4:	83 c4 20             	add    $0x20,%esp
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	78 24                	js     8011ff <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8011db:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8011e0:	89 d8                	mov    %ebx,%eax
+  8011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+  8011ea:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	50                   	push   %eax
+  8011f0:	68 20 4c 80 00       	push   $0x804c20
+  8011f5:	e8 d5 f0 ff ff       	call   8002cf <cprintf>
+		return r;
+  8011fa:	83 c4 10             	add    $0x10,%esp
+  8011fd:	eb e1                	jmp    8011e0 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8011ff:	83 ec 08             	sub    $0x8,%esp
+  801202:	50                   	push   %eax
+  801203:	68 50 4c 80 00       	push   $0x804c50
+  801208:	e8 c2 f0 ff ff       	call   8002cf <cprintf>
+		return r;
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	eb ce                	jmp    8011e0 <duppage_cow+0x4d>
+
+00801212 <duppage>:
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	53                   	push   %ebx
+  801216:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801219:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80121c:	51                   	push   %ecx
+  80121d:	52                   	push   %edx
+  80121e:	50                   	push   %eax
+  80121f:	52                   	push   %edx
+  801220:	6a 00                	push   $0x0
+  801222:	e8 17 fb ff ff       	call   800d3e <sys_page_map>
+	if (r < 0) {
+  801227:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80122a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	78 07                	js     80123a <duppage+0x28>
+}
+  801233:	89 d8                	mov    %ebx,%eax
+  801235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801238:	c9                   	leave
+  801239:	c3                   	ret
+  80123a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80123c:	83 ec 08             	sub    $0x8,%esp
+  80123f:	50                   	push   %eax
+  801240:	68 20 4c 80 00       	push   $0x804c20
+  801245:	e8 85 f0 ff ff       	call   8002cf <cprintf>
+		return r;
+  80124a:	83 c4 10             	add    $0x10,%esp
+  80124d:	eb e4                	jmp    801233 <duppage+0x21>
+
+0080124f <cow_copy>:
+{
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801256:	83 ec 04             	sub    $0x4,%esp
+  801259:	6a 07                	push   $0x7
+  80125b:	68 00 f0 7f 00       	push   $0x7ff000
+  801260:	6a 00                	push   $0x0
+  801262:	e8 8a fa ff ff       	call   800cf1 <sys_page_alloc>
+	if (r < 0) {
+  801267:	83 c4 10             	add    $0x10,%esp
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	78 58                	js     8012c6 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80126e:	83 ec 04             	sub    $0x4,%esp
+  801271:	68 00 10 00 00       	push   $0x1000
+  801276:	56                   	push   %esi
+  801277:	68 00 f0 7f 00       	push   $0x7ff000
+  80127c:	e8 b8 f7 ff ff       	call   800a39 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801281:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801288:	56                   	push   %esi
+  801289:	6a 00                	push   $0x0
+  80128b:	68 00 f0 7f 00       	push   $0x7ff000
+  801290:	6a 00                	push   $0x0
+  801292:	e8 a7 fa ff ff       	call   800d3e <sys_page_map>
+  801297:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801299:	83 c4 20             	add    $0x20,%esp
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	78 3b                	js     8012db <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8012a0:	83 ec 08             	sub    $0x8,%esp
+  8012a3:	68 00 f0 7f 00       	push   $0x7ff000
+  8012a8:	6a 00                	push   $0x0
+  8012aa:	e8 db fa ff ff       	call   800d8a <sys_page_unmap>
+  8012af:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012b1:	83 c4 10             	add    $0x10,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	78 45                	js     8012fd <cow_copy+0xae>
+	return 0;
+  8012b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8012bd:	89 d8                	mov    %ebx,%eax
+  8012bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c2:	5b                   	pop    %ebx
+  8012c3:	5e                   	pop    %esi
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+  8012c6:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8012c8:	83 ec 08             	sub    $0x8,%esp
+  8012cb:	50                   	push   %eax
+  8012cc:	68 40 4d 80 00       	push   $0x804d40
+  8012d1:	e8 f9 ef ff ff       	call   8002cf <cprintf>
+		return r;
+  8012d6:	83 c4 10             	add    $0x10,%esp
+  8012d9:	eb e2                	jmp    8012bd <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8012db:	83 ec 08             	sub    $0x8,%esp
+  8012de:	50                   	push   %eax
+  8012df:	68 5c 4d 80 00       	push   $0x804d5c
+  8012e4:	e8 e6 ef ff ff       	call   8002cf <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8012e9:	83 c4 08             	add    $0x8,%esp
+  8012ec:	68 00 f0 7f 00       	push   $0x7ff000
+  8012f1:	6a 00                	push   $0x0
+  8012f3:	e8 92 fa ff ff       	call   800d8a <sys_page_unmap>
+		return r;
+  8012f8:	83 c4 10             	add    $0x10,%esp
+  8012fb:	eb c0                	jmp    8012bd <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8012fd:	83 ec 08             	sub    $0x8,%esp
+  801300:	50                   	push   %eax
+  801301:	68 78 4c 80 00       	push   $0x804c78
+  801306:	e8 c4 ef ff ff       	call   8002cf <cprintf>
+		return r;
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	eb ad                	jmp    8012bd <cow_copy+0x6e>
+
+00801310 <pgfault>:
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+  801315:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801318:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80131a:	89 d8                	mov    %ebx,%eax
+  80131c:	c1 e8 16             	shr    $0x16,%eax
+  80131f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801326:	89 de                	mov    %ebx,%esi
+  801328:	c1 ee 0c             	shr    $0xc,%esi
+  80132b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801332:	a8 07                	test   $0x7,%al
+  801334:	74 3b                	je     801371 <pgfault+0x61>
+  801336:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80133c:	74 33                	je     801371 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	68 00 f0 bf ee       	push   $0xeebff000
+  801346:	e8 07 28 00 00       	call   803b52 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80134b:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	f6 c4 08             	test   $0x8,%ah
+  801358:	75 30                	jne    80138a <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80135a:	83 ec 0c             	sub    $0xc,%esp
+  80135d:	68 00 f0 bf ee       	push   $0xeebff000
+  801362:	e8 58 28 00 00       	call   803bbf <mutex_unlock>
+}
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801371:	83 ec 08             	sub    $0x8,%esp
+  801374:	ff 72 28             	push   0x28(%edx)
+  801377:	51                   	push   %ecx
+  801378:	50                   	push   %eax
+  801379:	68 9c 4c 80 00       	push   $0x804c9c
+  80137e:	6a 3f                	push   $0x3f
+  801380:	68 76 4d 80 00       	push   $0x804d76
+  801385:	e8 48 31 00 00       	call   8044d2 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80138a:	89 d8                	mov    %ebx,%eax
+  80138c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801391:	e8 b9 fe ff ff       	call   80124f <cow_copy>
+  801396:	eb c2                	jmp    80135a <pgfault+0x4a>
+
+00801398 <cow_enable>:
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80139e:	68 10 13 80 00       	push   $0x801310
+  8013a3:	e8 70 31 00 00       	call   804518 <set_pgfault_handler>
+}
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	c9                   	leave
+  8013ac:	c3                   	ret
+
+008013ad <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	57                   	push   %edi
+  8013b1:	56                   	push   %esi
+  8013b2:	53                   	push   %ebx
+  8013b3:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8013b6:	68 10 13 80 00       	push   $0x801310
+  8013bb:	e8 58 31 00 00       	call   804518 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8013c0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013c5:	cd 30                	int    $0x30
+  8013c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8013ca:	83 c4 10             	add    $0x10,%esp
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	78 4b                	js     80141c <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8013d1:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8013d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8013de:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013e2:	0f 85 16 01 00 00    	jne    8014fe <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013e8:	e8 ac f8 ff ff       	call   800c99 <sys_getenvid>
+  8013ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013f2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013f4:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8013fa:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801400:	77 32                	ja     801434 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801402:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801407:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801409:	c1 ea 10             	shr    $0x10,%edx
+  80140c:	74 26                	je     801434 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80140e:	c1 e2 10             	shl    $0x10,%edx
+  801411:	89 d1                	mov    %edx,%ecx
+  801413:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801418:	29 ca                	sub    %ecx,%edx
+  80141a:	eb 1e                	jmp    80143a <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80141c:	83 ec 08             	sub    $0x8,%esp
+  80141f:	89 c7                	mov    %eax,%edi
+  801421:	50                   	push   %eax
+  801422:	68 81 4d 80 00       	push   $0x804d81
+  801427:	e8 a3 ee ff ff       	call   8002cf <cprintf>
+		return eid;
+  80142c:	83 c4 10             	add    $0x10,%esp
+  80142f:	e9 6c 01 00 00       	jmp    8015a0 <fork+0x1f3>
+		return pthread_main_tls;
+  801434:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80143a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80143d:	c1 e0 04             	shl    $0x4,%eax
+  801440:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801445:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801447:	e8 4f 2e 00 00       	call   80429b <pthread_fork_child>
+		return eid;
+  80144c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80144f:	e9 4c 01 00 00       	jmp    8015a0 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801454:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80145a:	89 da                	mov    %ebx,%edx
+  80145c:	89 f8                	mov    %edi,%eax
+  80145e:	e8 af fd ff ff       	call   801212 <duppage>
+  801463:	85 c0                	test   %eax,%eax
+  801465:	79 28                	jns    80148f <fork+0xe2>
+  801467:	89 c7                	mov    %eax,%edi
+  801469:	e9 32 01 00 00       	jmp    8015a0 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80146e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801474:	83 f9 05             	cmp    $0x5,%ecx
+  801477:	75 58                	jne    8014d1 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801479:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80147e:	89 da                	mov    %ebx,%edx
+  801480:	89 f8                	mov    %edi,%eax
+  801482:	e8 8b fd ff ff       	call   801212 <duppage>
+  801487:	85 c0                	test   %eax,%eax
+  801489:	0f 88 0f 01 00 00    	js     80159e <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80148f:	83 c3 01             	add    $0x1,%ebx
+  801492:	39 de                	cmp    %ebx,%esi
+  801494:	74 54                	je     8014ea <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801496:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80149d:	f6 c1 05             	test   $0x5,%cl
+  8014a0:	74 ed                	je     80148f <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8014a2:	f6 c5 04             	test   $0x4,%ch
+  8014a5:	75 ad                	jne    801454 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8014a7:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8014ad:	74 bf                	je     80146e <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8014af:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8014b5:	74 d8                	je     80148f <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8014b7:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8014bd:	89 da                	mov    %ebx,%edx
+  8014bf:	89 f8                	mov    %edi,%eax
+  8014c1:	e8 cd fc ff ff       	call   801193 <duppage_cow>
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	79 c5                	jns    80148f <fork+0xe2>
+  8014ca:	89 c7                	mov    %eax,%edi
+  8014cc:	e9 cf 00 00 00       	jmp    8015a0 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014d1:	68 cc 4c 80 00       	push   $0x804ccc
+  8014d6:	68 91 4d 80 00       	push   $0x804d91
+  8014db:	68 c6 00 00 00       	push   $0xc6
+  8014e0:	68 76 4d 80 00       	push   $0x804d76
+  8014e5:	e8 e8 2f 00 00       	call   8044d2 <_panic>
+  8014ea:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8014ed:	83 c1 01             	add    $0x1,%ecx
+  8014f0:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8014f6:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8014fc:	74 18                	je     801516 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8014fe:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801505:	a8 07                	test   $0x7,%al
+  801507:	74 e4                	je     8014ed <fork+0x140>
+  801509:	89 cb                	mov    %ecx,%ebx
+  80150b:	c1 e3 0a             	shl    $0xa,%ebx
+  80150e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801511:	e9 7c ff ff ff       	jmp    801492 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801516:	83 ec 04             	sub    $0x4,%esp
+  801519:	6a 07                	push   $0x7
+  80151b:	68 00 f0 bf ee       	push   $0xeebff000
+  801520:	ff 75 e4             	push   -0x1c(%ebp)
+  801523:	e8 c9 f7 ff ff       	call   800cf1 <sys_page_alloc>
+  801528:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	78 34                	js     801565 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	68 56 45 80 00       	push   $0x804556
+  801539:	ff 75 e4             	push   -0x1c(%ebp)
+  80153c:	e8 2d f9 ff ff       	call   800e6e <sys_env_set_pgfault_upcall>
+  801541:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	85 c0                	test   %eax,%eax
+  801548:	78 2e                	js     801578 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	6a 02                	push   $0x2
+  80154f:	ff 75 e4             	push   -0x1c(%ebp)
+  801552:	e8 7f f8 ff ff       	call   800dd6 <sys_env_set_status>
+  801557:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	78 2b                	js     80158b <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801560:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801563:	eb 3b                	jmp    8015a0 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801565:	83 ec 08             	sub    $0x8,%esp
+  801568:	50                   	push   %eax
+  801569:	68 f4 4c 80 00       	push   $0x804cf4
+  80156e:	e8 5c ed ff ff       	call   8002cf <cprintf>
+		return r;
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	eb 28                	jmp    8015a0 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801578:	83 ec 08             	sub    $0x8,%esp
+  80157b:	50                   	push   %eax
+  80157c:	68 1c 4d 80 00       	push   $0x804d1c
+  801581:	e8 49 ed ff ff       	call   8002cf <cprintf>
+		return r;
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	eb 15                	jmp    8015a0 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80158b:	83 ec 08             	sub    $0x8,%esp
+  80158e:	50                   	push   %eax
+  80158f:	68 a6 4d 80 00       	push   $0x804da6
+  801594:	e8 36 ed ff ff       	call   8002cf <cprintf>
+		return r;
+  801599:	83 c4 10             	add    $0x10,%esp
+  80159c:	eb 02                	jmp    8015a0 <fork+0x1f3>
+  80159e:	89 c7                	mov    %eax,%edi
+}
+  8015a0:	89 f8                	mov    %edi,%eax
+  8015a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5f                   	pop    %edi
+  8015a8:	5d                   	pop    %ebp
+  8015a9:	c3                   	ret
+
+008015aa <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8015aa:	55                   	push   %ebp
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	57                   	push   %edi
+  8015ae:	56                   	push   %esi
+  8015af:	53                   	push   %ebx
+  8015b0:	83 ec 2c             	sub    $0x2c,%esp
+  8015b3:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015b5:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8015bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015c0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8015c6:	77 0a                	ja     8015d2 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015c8:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8015cd:	29 c3                	sub    %eax,%ebx
+  8015cf:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8015d2:	83 ec 0c             	sub    $0xc,%esp
+  8015d5:	68 10 13 80 00       	push   $0x801310
+  8015da:	e8 39 2f 00 00       	call   804518 <set_pgfault_handler>
+  8015df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015e4:	cd 30                	int    $0x30
+  8015e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 30                	js     801620 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8015f4:	74 42                	je     801638 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8015f6:	c1 e3 10             	shl    $0x10,%ebx
+  8015f9:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8015fe:	29 d8                	sub    %ebx,%eax
+  801600:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801603:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801608:	29 d8                	sub    %ebx,%eax
+  80160a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80160d:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801612:	ba 00 00 00 00       	mov    $0x0,%edx
+  801617:	89 f7                	mov    %esi,%edi
+  801619:	89 d6                	mov    %edx,%esi
+  80161b:	e9 2c 01 00 00       	jmp    80174c <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801620:	83 ec 08             	sub    $0x8,%esp
+  801623:	89 c7                	mov    %eax,%edi
+  801625:	50                   	push   %eax
+  801626:	68 81 4d 80 00       	push   $0x804d81
+  80162b:	e8 9f ec ff ff       	call   8002cf <cprintf>
+		return eid;
+  801630:	83 c4 10             	add    $0x10,%esp
+  801633:	e9 d5 00 00 00       	jmp    80170d <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801638:	e8 5c f6 ff ff       	call   800c99 <sys_getenvid>
+  80163d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801642:	89 c2                	mov    %eax,%edx
+  801644:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801646:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80164c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801651:	77 18                	ja     80166b <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801653:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801658:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80165a:	c1 e8 10             	shr    $0x10,%eax
+  80165d:	74 0c                	je     80166b <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80165f:	c1 e0 10             	shl    $0x10,%eax
+  801662:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801667:	29 c1                	sub    %eax,%ecx
+  801669:	eb 06                	jmp    801671 <sfork+0xc7>
+		return pthread_main_tls;
+  80166b:	8b 0d c4 72 80 00    	mov    0x8072c4,%ecx
+  801671:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801674:	c1 e0 04             	shl    $0x4,%eax
+  801677:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80167c:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80167e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801681:	e9 87 00 00 00       	jmp    80170d <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801686:	f6 c5 04             	test   $0x4,%ch
+  801689:	74 6c                	je     8016f7 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80168b:	89 ca                	mov    %ecx,%edx
+  80168d:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801693:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801699:	74 7c                	je     801717 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80169b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016a1:	89 da                	mov    %ebx,%edx
+  8016a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a6:	e8 67 fb ff ff       	call   801212 <duppage>
+  8016ab:	85 c0                	test   %eax,%eax
+  8016ad:	0f 88 4f 01 00 00    	js     801802 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8016b3:	83 c3 01             	add    $0x1,%ebx
+  8016b6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8016b9:	74 7a                	je     801735 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8016bb:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8016bd:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8016c4:	f6 c1 01             	test   $0x1,%cl
+  8016c7:	74 ea                	je     8016b3 <sfork+0x109>
+  8016c9:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016cf:	74 e2                	je     8016b3 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8016d1:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8016d7:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8016da:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8016df:	76 a5                	jbe    801686 <sfork+0xdc>
+  8016e1:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8016e7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8016ea:	39 fa                	cmp    %edi,%edx
+  8016ec:	73 9d                	jae    80168b <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016ee:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8016f1:	39 fa                	cmp    %edi,%edx
+  8016f3:	72 96                	jb     80168b <sfork+0xe1>
+  8016f5:	eb 8f                	jmp    801686 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016f7:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016fd:	89 da                	mov    %ebx,%edx
+  8016ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801702:	e8 8c fa ff ff       	call   801193 <duppage_cow>
+  801707:	85 c0                	test   %eax,%eax
+  801709:	79 a8                	jns    8016b3 <sfork+0x109>
+  80170b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80170d:	89 f8                	mov    %edi,%eax
+  80170f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801712:	5b                   	pop    %ebx
+  801713:	5e                   	pop    %esi
+  801714:	5f                   	pop    %edi
+  801715:	5d                   	pop    %ebp
+  801716:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801717:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80171c:	e8 2e fb ff ff       	call   80124f <cow_copy>
+  801721:	85 c0                	test   %eax,%eax
+  801723:	0f 88 d2 00 00 00    	js     8017fb <sfork+0x251>
+				pte = uvpt[pn];
+  801729:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801730:	e9 66 ff ff ff       	jmp    80169b <sfork+0xf1>
+  801735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801738:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80173b:	83 c6 01             	add    $0x1,%esi
+  80173e:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801744:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80174a:	74 1b                	je     801767 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80174c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801753:	a8 01                	test   $0x1,%al
+  801755:	74 e4                	je     80173b <sfork+0x191>
+  801757:	89 f3                	mov    %esi,%ebx
+  801759:	c1 e3 0a             	shl    $0xa,%ebx
+  80175c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80175f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801762:	e9 4f ff ff ff       	jmp    8016b6 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	6a 07                	push   $0x7
+  80176c:	68 00 f0 bf ee       	push   $0xeebff000
+  801771:	ff 75 e0             	push   -0x20(%ebp)
+  801774:	e8 78 f5 ff ff       	call   800cf1 <sys_page_alloc>
+  801779:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	85 c0                	test   %eax,%eax
+  801780:	78 37                	js     8017b9 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	68 56 45 80 00       	push   $0x804556
+  80178a:	ff 75 e0             	push   -0x20(%ebp)
+  80178d:	e8 dc f6 ff ff       	call   800e6e <sys_env_set_pgfault_upcall>
+  801792:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	85 c0                	test   %eax,%eax
+  801799:	78 34                	js     8017cf <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80179b:	83 ec 08             	sub    $0x8,%esp
+  80179e:	6a 02                	push   $0x2
+  8017a0:	ff 75 e0             	push   -0x20(%ebp)
+  8017a3:	e8 2e f6 ff ff       	call   800dd6 <sys_env_set_status>
+  8017a8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	78 34                	js     8017e5 <sfork+0x23b>
+	return eid;
+  8017b1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017b4:	e9 54 ff ff ff       	jmp    80170d <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	50                   	push   %eax
+  8017bd:	68 f4 4c 80 00       	push   $0x804cf4
+  8017c2:	e8 08 eb ff ff       	call   8002cf <cprintf>
+		return r;
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	e9 3e ff ff ff       	jmp    80170d <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8017cf:	83 ec 08             	sub    $0x8,%esp
+  8017d2:	50                   	push   %eax
+  8017d3:	68 1c 4d 80 00       	push   $0x804d1c
+  8017d8:	e8 f2 ea ff ff       	call   8002cf <cprintf>
+		return r;
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	e9 28 ff ff ff       	jmp    80170d <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8017e5:	83 ec 08             	sub    $0x8,%esp
+  8017e8:	50                   	push   %eax
+  8017e9:	68 a6 4d 80 00       	push   $0x804da6
+  8017ee:	e8 dc ea ff ff       	call   8002cf <cprintf>
+		return r;
+  8017f3:	83 c4 10             	add    $0x10,%esp
+  8017f6:	e9 12 ff ff ff       	jmp    80170d <sfork+0x163>
+  8017fb:	89 c7                	mov    %eax,%edi
+  8017fd:	e9 0b ff ff ff       	jmp    80170d <sfork+0x163>
+  801802:	89 c7                	mov    %eax,%edi
+  801804:	e9 04 ff ff ff       	jmp    80170d <sfork+0x163>
+
+00801809 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	57                   	push   %edi
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+  80180f:	83 ec 18             	sub    $0x18,%esp
+  801812:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801815:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801818:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801822:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  801825:	50                   	push   %eax
+  801826:	e8 bc f6 ff ff       	call   800ee7 <sys_ipc_recv>
+	if (r < 0) {
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	78 2b                	js     80185d <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  801832:	85 ff                	test   %edi,%edi
+  801834:	74 55                	je     80188b <ipc_recv+0x82>
+  801836:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801838:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80183e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801843:	77 39                	ja     80187e <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801845:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80184a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80184c:	c1 e8 10             	shr    $0x10,%eax
+  80184f:	74 2d                	je     80187e <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801851:	c1 e0 10             	shl    $0x10,%eax
+  801854:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801859:	29 c2                	sub    %eax,%edx
+  80185b:	eb 27                	jmp    801884 <ipc_recv+0x7b>
+  80185d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80185f:	83 ec 08             	sub    $0x8,%esp
+  801862:	50                   	push   %eax
+  801863:	68 c4 4d 80 00       	push   $0x804dc4
+  801868:	e8 62 ea ff ff       	call   8002cf <cprintf>
+		*from_env_store = 0;
+  80186d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801873:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	eb 77                	jmp    8018f5 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80187e:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801884:	8b 02                	mov    (%edx),%eax
+  801886:	8b 40 78             	mov    0x78(%eax),%eax
+  801889:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80188b:	85 f6                	test   %esi,%esi
+  80188d:	74 34                	je     8018c3 <ipc_recv+0xba>
+  80188f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801891:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801897:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80189c:	77 18                	ja     8018b6 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80189e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018a3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018a5:	c1 e8 10             	shr    $0x10,%eax
+  8018a8:	74 0c                	je     8018b6 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018aa:	c1 e0 10             	shl    $0x10,%eax
+  8018ad:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018b2:	29 c2                	sub    %eax,%edx
+  8018b4:	eb 06                	jmp    8018bc <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8018b6:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8018bc:	8b 02                	mov    (%edx),%eax
+  8018be:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8018c1:	89 06                	mov    %eax,(%esi)
+  8018c3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018c5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8018cb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018d0:	77 18                	ja     8018ea <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018d2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018d7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018d9:	c1 e8 10             	shr    $0x10,%eax
+  8018dc:	74 0c                	je     8018ea <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018de:	c1 e0 10             	shl    $0x10,%eax
+  8018e1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018e6:	29 c2                	sub    %eax,%edx
+  8018e8:	eb 06                	jmp    8018f0 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8018ea:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+	}
+	return thisenv->env_ipc_value;
+  8018f0:	8b 02                	mov    (%edx),%eax
+  8018f2:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8018f5:	89 d8                	mov    %ebx,%eax
+  8018f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5f                   	pop    %edi
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+
+008018ff <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	57                   	push   %edi
+  801903:	56                   	push   %esi
+  801904:	53                   	push   %ebx
+  801905:	83 ec 0c             	sub    $0xc,%esp
+  801908:	8b 75 08             	mov    0x8(%ebp),%esi
+  80190b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80190e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801911:	85 db                	test   %ebx,%ebx
+  801913:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801918:	0f 44 d8             	cmove  %eax,%ebx
+  80191b:	eb 05                	jmp    801922 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80191d:	e8 a3 f3 ff ff       	call   800cc5 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801922:	57                   	push   %edi
+  801923:	53                   	push   %ebx
+  801924:	ff 75 0c             	push   0xc(%ebp)
+  801927:	56                   	push   %esi
+  801928:	e8 8d f5 ff ff       	call   800eba <sys_ipc_try_send>
+		if (r == 0) {
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	85 c0                	test   %eax,%eax
+  801932:	74 19                	je     80194d <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  801934:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801937:	74 e4                	je     80191d <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  801939:	83 ec 0c             	sub    $0xc,%esp
+  80193c:	50                   	push   %eax
+  80193d:	57                   	push   %edi
+  80193e:	53                   	push   %ebx
+  80193f:	56                   	push   %esi
+  801940:	68 e0 4d 80 00       	push   $0x804de0
+  801945:	e8 85 e9 ff ff       	call   8002cf <cprintf>
+			return;
+  80194a:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80194d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801950:	5b                   	pop    %ebx
+  801951:	5e                   	pop    %esi
+  801952:	5f                   	pop    %edi
+  801953:	5d                   	pop    %ebp
+  801954:	c3                   	ret
+
+00801955 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80195b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801960:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801963:	c1 e0 04             	shl    $0x4,%eax
+  801966:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80196b:	8b 40 50             	mov    0x50(%eax),%eax
+  80196e:	39 c8                	cmp    %ecx,%eax
+  801970:	74 12                	je     801984 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801972:	83 c2 01             	add    $0x1,%edx
+  801975:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80197b:	75 e3                	jne    801960 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	eb 0e                	jmp    801992 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801984:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801987:	c1 e0 04             	shl    $0x4,%eax
+  80198a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80198f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+
+00801994 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80199f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019a2:	5d                   	pop    %ebp
+  8019a3:	c3                   	ret
+
+008019a4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019aa:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019af:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019b4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019b9:	5d                   	pop    %ebp
+  8019ba:	c3                   	ret
+
+008019bb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019bb:	55                   	push   %ebp
+  8019bc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019be:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019c3:	eb 02                	jmp    8019c7 <fd_alloc+0xc>
+  8019c5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019c7:	89 c2                	mov    %eax,%edx
+  8019c9:	c1 ea 16             	shr    $0x16,%edx
+  8019cc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019d3:	f6 c2 01             	test   $0x1,%dl
+  8019d6:	74 2b                	je     801a03 <fd_alloc+0x48>
+  8019d8:	89 c2                	mov    %eax,%edx
+  8019da:	c1 ea 0c             	shr    $0xc,%edx
+  8019dd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019e4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8019ea:	f6 c1 01             	test   $0x1,%cl
+  8019ed:	74 14                	je     801a03 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8019ef:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8019f5:	75 ce                	jne    8019c5 <fd_alloc+0xa>
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019fc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a01:	eb 05                	jmp    801a08 <fd_alloc+0x4d>
+			return 0;
+  801a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0b:	89 02                	mov    %eax,(%edx)
+}
+  801a0d:	89 c8                	mov    %ecx,%eax
+  801a0f:	5d                   	pop    %ebp
+  801a10:	c3                   	ret
+
+00801a11 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a17:	83 f8 1f             	cmp    $0x1f,%eax
+  801a1a:	77 30                	ja     801a4c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a1c:	c1 e0 0c             	shl    $0xc,%eax
+  801a1f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a24:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a2a:	f6 c2 01             	test   $0x1,%dl
+  801a2d:	74 24                	je     801a53 <fd_lookup+0x42>
+  801a2f:	89 c2                	mov    %eax,%edx
+  801a31:	c1 ea 0c             	shr    $0xc,%edx
+  801a34:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a3b:	f6 c2 01             	test   $0x1,%dl
+  801a3e:	74 1a                	je     801a5a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a43:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4a:	5d                   	pop    %ebp
+  801a4b:	c3                   	ret
+		return -E_INVAL;
+  801a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a51:	eb f7                	jmp    801a4a <fd_lookup+0x39>
+		return -E_INVAL;
+  801a53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a58:	eb f0                	jmp    801a4a <fd_lookup+0x39>
+  801a5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a5f:	eb e9                	jmp    801a4a <fd_lookup+0x39>
+
+00801a61 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	53                   	push   %ebx
+  801a65:	83 ec 04             	sub    $0x4,%esp
+  801a68:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a70:	eb 03                	jmp    801a75 <dev_lookup+0x14>
+  801a72:	83 c0 01             	add    $0x1,%eax
+  801a75:	8b 1c 85 94 4e 80 00 	mov    0x804e94(,%eax,4),%ebx
+  801a7c:	85 db                	test   %ebx,%ebx
+  801a7e:	74 0b                	je     801a8b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a80:	39 13                	cmp    %edx,(%ebx)
+  801a82:	75 ee                	jne    801a72 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a89:	eb 49                	jmp    801ad4 <dev_lookup+0x73>
+  801a8b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a8d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801a93:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a98:	77 18                	ja     801ab2 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a9a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a9f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801aa1:	c1 e8 10             	shr    $0x10,%eax
+  801aa4:	74 0c                	je     801ab2 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801aa6:	c1 e0 10             	shl    $0x10,%eax
+  801aa9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801aae:	29 c1                	sub    %eax,%ecx
+  801ab0:	eb 06                	jmp    801ab8 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801ab2:	8b 0d c4 72 80 00    	mov    0x8072c4,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ab8:	8b 01                	mov    (%ecx),%eax
+  801aba:	8b 40 48             	mov    0x48(%eax),%eax
+  801abd:	83 ec 04             	sub    $0x4,%esp
+  801ac0:	52                   	push   %edx
+  801ac1:	50                   	push   %eax
+  801ac2:	68 18 4e 80 00       	push   $0x804e18
+  801ac7:	e8 03 e8 ff ff       	call   8002cf <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ad7:	89 1a                	mov    %ebx,(%edx)
+}
+  801ad9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801adc:	c9                   	leave
+  801add:	c3                   	ret
+
+00801ade <fd_close>:
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	57                   	push   %edi
+  801ae2:	56                   	push   %esi
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 24             	sub    $0x24,%esp
+  801ae7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801aea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801aed:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801af1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801af7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801afa:	50                   	push   %eax
+  801afb:	e8 11 ff ff ff       	call   801a11 <fd_lookup>
+  801b00:	89 c3                	mov    %eax,%ebx
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 05                	js     801b0e <fd_close+0x30>
+	    || fd != fd2)
+  801b09:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b0c:	74 16                	je     801b24 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b0e:	89 f8                	mov    %edi,%eax
+  801b10:	84 c0                	test   %al,%al
+  801b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b17:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b1a:	89 d8                	mov    %ebx,%eax
+  801b1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b1f:	5b                   	pop    %ebx
+  801b20:	5e                   	pop    %esi
+  801b21:	5f                   	pop    %edi
+  801b22:	5d                   	pop    %ebp
+  801b23:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b24:	83 ec 08             	sub    $0x8,%esp
+  801b27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	ff 36                	push   (%esi)
+  801b2d:	e8 2f ff ff ff       	call   801a61 <dev_lookup>
+  801b32:	89 c3                	mov    %eax,%ebx
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	85 c0                	test   %eax,%eax
+  801b39:	78 1a                	js     801b55 <fd_close+0x77>
+		if (dev->dev_close)
+  801b3b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b3e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	74 0b                	je     801b55 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b4a:	83 ec 0c             	sub    $0xc,%esp
+  801b4d:	56                   	push   %esi
+  801b4e:	ff d0                	call   *%eax
+  801b50:	89 c3                	mov    %eax,%ebx
+  801b52:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b55:	83 ec 08             	sub    $0x8,%esp
+  801b58:	56                   	push   %esi
+  801b59:	6a 00                	push   $0x0
+  801b5b:	e8 2a f2 ff ff       	call   800d8a <sys_page_unmap>
+	return r;
+  801b60:	83 c4 10             	add    $0x10,%esp
+  801b63:	eb b5                	jmp    801b1a <fd_close+0x3c>
+
+00801b65 <close>:
+
+int
+close(int fdnum)
+{
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	ff 75 08             	push   0x8(%ebp)
+  801b72:	e8 9a fe ff ff       	call   801a11 <fd_lookup>
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	79 02                	jns    801b80 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b7e:	c9                   	leave
+  801b7f:	c3                   	ret
+		return fd_close(fd, 1);
+  801b80:	83 ec 08             	sub    $0x8,%esp
+  801b83:	6a 01                	push   $0x1
+  801b85:	ff 75 f4             	push   -0xc(%ebp)
+  801b88:	e8 51 ff ff ff       	call   801ade <fd_close>
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	eb ec                	jmp    801b7e <close+0x19>
+
+00801b92 <close_all>:
+
+void
+close_all(void)
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	53                   	push   %ebx
+  801b96:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b99:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b9e:	83 ec 0c             	sub    $0xc,%esp
+  801ba1:	53                   	push   %ebx
+  801ba2:	e8 be ff ff ff       	call   801b65 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ba7:	83 c3 01             	add    $0x1,%ebx
+  801baa:	83 c4 10             	add    $0x10,%esp
+  801bad:	83 fb 20             	cmp    $0x20,%ebx
+  801bb0:	75 ec                	jne    801b9e <close_all+0xc>
+}
+  801bb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+00801bb7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	57                   	push   %edi
+  801bbb:	56                   	push   %esi
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bc0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bc3:	50                   	push   %eax
+  801bc4:	ff 75 08             	push   0x8(%ebp)
+  801bc7:	e8 45 fe ff ff       	call   801a11 <fd_lookup>
+  801bcc:	89 c3                	mov    %eax,%ebx
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	78 7f                	js     801c54 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bd5:	83 ec 0c             	sub    $0xc,%esp
+  801bd8:	ff 75 0c             	push   0xc(%ebp)
+  801bdb:	e8 85 ff ff ff       	call   801b65 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801be0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801be3:	c1 e6 0c             	shl    $0xc,%esi
+  801be6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801bec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bef:	89 3c 24             	mov    %edi,(%esp)
+  801bf2:	e8 ad fd ff ff       	call   8019a4 <fd2data>
+  801bf7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bf9:	89 34 24             	mov    %esi,(%esp)
+  801bfc:	e8 a3 fd ff ff       	call   8019a4 <fd2data>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c07:	89 d8                	mov    %ebx,%eax
+  801c09:	c1 e8 16             	shr    $0x16,%eax
+  801c0c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c13:	a8 01                	test   $0x1,%al
+  801c15:	74 11                	je     801c28 <dup+0x71>
+  801c17:	89 d8                	mov    %ebx,%eax
+  801c19:	c1 e8 0c             	shr    $0xc,%eax
+  801c1c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c23:	f6 c2 01             	test   $0x1,%dl
+  801c26:	75 36                	jne    801c5e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c28:	89 f8                	mov    %edi,%eax
+  801c2a:	c1 e8 0c             	shr    $0xc,%eax
+  801c2d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c34:	83 ec 0c             	sub    $0xc,%esp
+  801c37:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c3c:	50                   	push   %eax
+  801c3d:	56                   	push   %esi
+  801c3e:	6a 00                	push   $0x0
+  801c40:	57                   	push   %edi
+  801c41:	6a 00                	push   $0x0
+  801c43:	e8 f6 f0 ff ff       	call   800d3e <sys_page_map>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	83 c4 20             	add    $0x20,%esp
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 33                	js     801c84 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c54:	89 d8                	mov    %ebx,%eax
+  801c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c59:	5b                   	pop    %ebx
+  801c5a:	5e                   	pop    %esi
+  801c5b:	5f                   	pop    %edi
+  801c5c:	5d                   	pop    %ebp
+  801c5d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c5e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c65:	83 ec 0c             	sub    $0xc,%esp
+  801c68:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	ff 75 d4             	push   -0x2c(%ebp)
+  801c71:	6a 00                	push   $0x0
+  801c73:	53                   	push   %ebx
+  801c74:	6a 00                	push   $0x0
+  801c76:	e8 c3 f0 ff ff       	call   800d3e <sys_page_map>
+  801c7b:	89 c3                	mov    %eax,%ebx
+  801c7d:	83 c4 20             	add    $0x20,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	79 a4                	jns    801c28 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c84:	83 ec 08             	sub    $0x8,%esp
+  801c87:	56                   	push   %esi
+  801c88:	6a 00                	push   $0x0
+  801c8a:	e8 fb f0 ff ff       	call   800d8a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c8f:	83 c4 08             	add    $0x8,%esp
+  801c92:	ff 75 d4             	push   -0x2c(%ebp)
+  801c95:	6a 00                	push   $0x0
+  801c97:	e8 ee f0 ff ff       	call   800d8a <sys_page_unmap>
+	return r;
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	eb b3                	jmp    801c54 <dup+0x9d>
+
+00801ca1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ca1:	55                   	push   %ebp
+  801ca2:	89 e5                	mov    %esp,%ebp
+  801ca4:	56                   	push   %esi
+  801ca5:	53                   	push   %ebx
+  801ca6:	83 ec 18             	sub    $0x18,%esp
+  801ca9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801caf:	50                   	push   %eax
+  801cb0:	53                   	push   %ebx
+  801cb1:	e8 5b fd ff ff       	call   801a11 <fd_lookup>
+  801cb6:	83 c4 10             	add    $0x10,%esp
+  801cb9:	85 c0                	test   %eax,%eax
+  801cbb:	78 3c                	js     801cf9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cbd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+  801cc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cc6:	50                   	push   %eax
+  801cc7:	ff 36                	push   (%esi)
+  801cc9:	e8 93 fd ff ff       	call   801a61 <dev_lookup>
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 24                	js     801cf9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cd5:	8b 46 08             	mov    0x8(%esi),%eax
+  801cd8:	83 e0 03             	and    $0x3,%eax
+  801cdb:	83 f8 01             	cmp    $0x1,%eax
+  801cde:	74 20                	je     801d00 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce3:	8b 40 08             	mov    0x8(%eax),%eax
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	74 61                	je     801d4b <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801cea:	83 ec 04             	sub    $0x4,%esp
+  801ced:	ff 75 10             	push   0x10(%ebp)
+  801cf0:	ff 75 0c             	push   0xc(%ebp)
+  801cf3:	56                   	push   %esi
+  801cf4:	ff d0                	call   *%eax
+  801cf6:	83 c4 10             	add    $0x10,%esp
+}
+  801cf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cfc:	5b                   	pop    %ebx
+  801cfd:	5e                   	pop    %esi
+  801cfe:	5d                   	pop    %ebp
+  801cff:	c3                   	ret
+  801d00:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d02:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d08:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d0d:	77 18                	ja     801d27 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d0f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d14:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d16:	c1 e8 10             	shr    $0x10,%eax
+  801d19:	74 0c                	je     801d27 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d1b:	c1 e0 10             	shl    $0x10,%eax
+  801d1e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d23:	29 c2                	sub    %eax,%edx
+  801d25:	eb 06                	jmp    801d2d <read+0x8c>
+		return pthread_main_tls;
+  801d27:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2d:	8b 02                	mov    (%edx),%eax
+  801d2f:	8b 40 48             	mov    0x48(%eax),%eax
+  801d32:	83 ec 04             	sub    $0x4,%esp
+  801d35:	53                   	push   %ebx
+  801d36:	50                   	push   %eax
+  801d37:	68 59 4e 80 00       	push   $0x804e59
+  801d3c:	e8 8e e5 ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d49:	eb ae                	jmp    801cf9 <read+0x58>
+		return -E_NOT_SUPP;
+  801d4b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d50:	eb a7                	jmp    801cf9 <read+0x58>
+
+00801d52 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d52:	55                   	push   %ebp
+  801d53:	89 e5                	mov    %esp,%ebp
+  801d55:	57                   	push   %edi
+  801d56:	56                   	push   %esi
+  801d57:	53                   	push   %ebx
+  801d58:	83 ec 0c             	sub    $0xc,%esp
+  801d5b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d5e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d66:	eb 02                	jmp    801d6a <readn+0x18>
+  801d68:	01 c3                	add    %eax,%ebx
+  801d6a:	39 f3                	cmp    %esi,%ebx
+  801d6c:	73 21                	jae    801d8f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d6e:	83 ec 04             	sub    $0x4,%esp
+  801d71:	89 f0                	mov    %esi,%eax
+  801d73:	29 d8                	sub    %ebx,%eax
+  801d75:	50                   	push   %eax
+  801d76:	89 d8                	mov    %ebx,%eax
+  801d78:	03 45 0c             	add    0xc(%ebp),%eax
+  801d7b:	50                   	push   %eax
+  801d7c:	57                   	push   %edi
+  801d7d:	e8 1f ff ff ff       	call   801ca1 <read>
+		if (m < 0)
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 04                	js     801d8d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d89:	75 dd                	jne    801d68 <readn+0x16>
+  801d8b:	eb 02                	jmp    801d8f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d8d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d8f:	89 d8                	mov    %ebx,%eax
+  801d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d94:	5b                   	pop    %ebx
+  801d95:	5e                   	pop    %esi
+  801d96:	5f                   	pop    %edi
+  801d97:	5d                   	pop    %ebp
+  801d98:	c3                   	ret
+
+00801d99 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	56                   	push   %esi
+  801d9d:	53                   	push   %ebx
+  801d9e:	83 ec 18             	sub    $0x18,%esp
+  801da1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801da4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da7:	50                   	push   %eax
+  801da8:	53                   	push   %ebx
+  801da9:	e8 63 fc ff ff       	call   801a11 <fd_lookup>
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	78 37                	js     801dec <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801db5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801db8:	83 ec 08             	sub    $0x8,%esp
+  801dbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbe:	50                   	push   %eax
+  801dbf:	ff 36                	push   (%esi)
+  801dc1:	e8 9b fc ff ff       	call   801a61 <dev_lookup>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+  801dc9:	85 c0                	test   %eax,%eax
+  801dcb:	78 1f                	js     801dec <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dcd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dd1:	74 20                	je     801df3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801dd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	74 61                	je     801e3e <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ddd:	83 ec 04             	sub    $0x4,%esp
+  801de0:	ff 75 10             	push   0x10(%ebp)
+  801de3:	ff 75 0c             	push   0xc(%ebp)
+  801de6:	56                   	push   %esi
+  801de7:	ff d0                	call   *%eax
+  801de9:	83 c4 10             	add    $0x10,%esp
+}
+  801dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801def:	5b                   	pop    %ebx
+  801df0:	5e                   	pop    %esi
+  801df1:	5d                   	pop    %ebp
+  801df2:	c3                   	ret
+  801df3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801df5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801dfb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e00:	77 18                	ja     801e1a <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e02:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e07:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e09:	c1 e8 10             	shr    $0x10,%eax
+  801e0c:	74 0c                	je     801e1a <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e0e:	c1 e0 10             	shl    $0x10,%eax
+  801e11:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e16:	29 c2                	sub    %eax,%edx
+  801e18:	eb 06                	jmp    801e20 <write+0x87>
+		return pthread_main_tls;
+  801e1a:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e20:	8b 02                	mov    (%edx),%eax
+  801e22:	8b 40 48             	mov    0x48(%eax),%eax
+  801e25:	83 ec 04             	sub    $0x4,%esp
+  801e28:	53                   	push   %ebx
+  801e29:	50                   	push   %eax
+  801e2a:	68 75 4e 80 00       	push   $0x804e75
+  801e2f:	e8 9b e4 ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e3c:	eb ae                	jmp    801dec <write+0x53>
+		return -E_NOT_SUPP;
+  801e3e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e43:	eb a7                	jmp    801dec <write+0x53>
+
+00801e45 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	ff 75 08             	push   0x8(%ebp)
+  801e52:	e8 ba fb ff ff       	call   801a11 <fd_lookup>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 0e                	js     801e6c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e64:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e6c:	c9                   	leave
+  801e6d:	c3                   	ret
+
+00801e6e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e6e:	55                   	push   %ebp
+  801e6f:	89 e5                	mov    %esp,%ebp
+  801e71:	56                   	push   %esi
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 18             	sub    $0x18,%esp
+  801e76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e79:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7c:	50                   	push   %eax
+  801e7d:	53                   	push   %ebx
+  801e7e:	e8 8e fb ff ff       	call   801a11 <fd_lookup>
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 34                	js     801ebe <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e8a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e93:	50                   	push   %eax
+  801e94:	ff 36                	push   (%esi)
+  801e96:	e8 c6 fb ff ff       	call   801a61 <dev_lookup>
+  801e9b:	83 c4 10             	add    $0x10,%esp
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	78 1c                	js     801ebe <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ea2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ea6:	74 1d                	je     801ec5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eab:	8b 40 18             	mov    0x18(%eax),%eax
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	74 5e                	je     801f10 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801eb2:	83 ec 08             	sub    $0x8,%esp
+  801eb5:	ff 75 0c             	push   0xc(%ebp)
+  801eb8:	56                   	push   %esi
+  801eb9:	ff d0                	call   *%eax
+  801ebb:	83 c4 10             	add    $0x10,%esp
+}
+  801ebe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec1:	5b                   	pop    %ebx
+  801ec2:	5e                   	pop    %esi
+  801ec3:	5d                   	pop    %ebp
+  801ec4:	c3                   	ret
+  801ec5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ec7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ecd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801ed2:	77 18                	ja     801eec <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ed4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ed9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801edb:	c1 e8 10             	shr    $0x10,%eax
+  801ede:	74 0c                	je     801eec <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801ee0:	c1 e0 10             	shl    $0x10,%eax
+  801ee3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ee8:	29 c2                	sub    %eax,%edx
+  801eea:	eb 06                	jmp    801ef2 <ftruncate+0x84>
+		return pthread_main_tls;
+  801eec:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+			thisenv->env_id, fdnum);
+  801ef2:	8b 02                	mov    (%edx),%eax
+  801ef4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ef7:	83 ec 04             	sub    $0x4,%esp
+  801efa:	53                   	push   %ebx
+  801efb:	50                   	push   %eax
+  801efc:	68 38 4e 80 00       	push   $0x804e38
+  801f01:	e8 c9 e3 ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f0e:	eb ae                	jmp    801ebe <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f15:	eb a7                	jmp    801ebe <ftruncate+0x50>
+
+00801f17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	56                   	push   %esi
+  801f1b:	53                   	push   %ebx
+  801f1c:	83 ec 18             	sub    $0x18,%esp
+  801f1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f25:	50                   	push   %eax
+  801f26:	ff 75 08             	push   0x8(%ebp)
+  801f29:	e8 e3 fa ff ff       	call   801a11 <fd_lookup>
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	85 c0                	test   %eax,%eax
+  801f33:	78 49                	js     801f7e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	ff 36                	push   (%esi)
+  801f41:	e8 1b fb ff ff       	call   801a61 <dev_lookup>
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	78 31                	js     801f7e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f50:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f54:	74 2f                	je     801f85 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f56:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f59:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f60:	00 00 00 
+	stat->st_isdir = 0;
+  801f63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f6a:	00 00 00 
+	stat->st_dev = dev;
+  801f6d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  801f76:	53                   	push   %ebx
+  801f77:	56                   	push   %esi
+  801f78:	ff 50 14             	call   *0x14(%eax)
+  801f7b:	83 c4 10             	add    $0x10,%esp
+}
+  801f7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f81:	5b                   	pop    %ebx
+  801f82:	5e                   	pop    %esi
+  801f83:	5d                   	pop    %ebp
+  801f84:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f8a:	eb f2                	jmp    801f7e <fstat+0x67>
+
+00801f8c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f8c:	55                   	push   %ebp
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	56                   	push   %esi
+  801f90:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	6a 00                	push   $0x0
+  801f96:	ff 75 08             	push   0x8(%ebp)
+  801f99:	e8 4b 03 00 00       	call   8022e9 <open>
+  801f9e:	89 c3                	mov    %eax,%ebx
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	85 c0                	test   %eax,%eax
+  801fa5:	78 1b                	js     801fc2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fa7:	83 ec 08             	sub    $0x8,%esp
+  801faa:	ff 75 0c             	push   0xc(%ebp)
+  801fad:	50                   	push   %eax
+  801fae:	e8 64 ff ff ff       	call   801f17 <fstat>
+  801fb3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fb5:	89 1c 24             	mov    %ebx,(%esp)
+  801fb8:	e8 a8 fb ff ff       	call   801b65 <close>
+	return r;
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  801fc0:	89 f3                	mov    %esi,%ebx
+}
+  801fc2:	89 d8                	mov    %ebx,%eax
+  801fc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc7:	5b                   	pop    %ebx
+  801fc8:	5e                   	pop    %esi
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+
+00801fcb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	56                   	push   %esi
+  801fcf:	53                   	push   %ebx
+  801fd0:	89 c6                	mov    %eax,%esi
+  801fd2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801fd4:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801fdb:	74 27                	je     802004 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fdd:	6a 07                	push   $0x7
+  801fdf:	68 00 80 80 00       	push   $0x808000
+  801fe4:	56                   	push   %esi
+  801fe5:	ff 35 00 70 80 00    	push   0x807000
+  801feb:	e8 0f f9 ff ff       	call   8018ff <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ff0:	83 c4 0c             	add    $0xc,%esp
+  801ff3:	6a 00                	push   $0x0
+  801ff5:	53                   	push   %ebx
+  801ff6:	6a 00                	push   $0x0
+  801ff8:	e8 0c f8 ff ff       	call   801809 <ipc_recv>
+}
+  801ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	6a 01                	push   $0x1
+  802009:	e8 47 f9 ff ff       	call   801955 <ipc_find_env>
+  80200e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	eb c5                	jmp    801fdd <fsipc+0x12>
+
+00802018 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	53                   	push   %ebx
+  80201c:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80201f:	68 04 70 80 00       	push   $0x807004
+  802024:	e8 29 1b 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802029:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80202f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  802034:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802037:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80203c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802041:	b8 02 00 00 00       	mov    $0x2,%eax
+  802046:	e8 80 ff ff ff       	call   801fcb <fsipc>
+  80204b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80204d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802054:	e8 66 1b 00 00       	call   803bbf <mutex_unlock>
+	return r;
+}
+  802059:	89 d8                	mov    %ebx,%eax
+  80205b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205e:	c9                   	leave
+  80205f:	c3                   	ret
+
+00802060 <devfile_flush>:
+{
+  802060:	55                   	push   %ebp
+  802061:	89 e5                	mov    %esp,%ebp
+  802063:	53                   	push   %ebx
+  802064:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802067:	68 04 70 80 00       	push   $0x807004
+  80206c:	e8 e1 1a 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802071:	8b 45 08             	mov    0x8(%ebp),%eax
+  802074:	8b 40 0c             	mov    0xc(%eax),%eax
+  802077:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80207c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802081:	b8 06 00 00 00       	mov    $0x6,%eax
+  802086:	e8 40 ff ff ff       	call   801fcb <fsipc>
+  80208b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80208d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802094:	e8 26 1b 00 00       	call   803bbf <mutex_unlock>
+}
+  802099:	89 d8                	mov    %ebx,%eax
+  80209b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+
+008020a0 <devfile_stat>:
+{
+  8020a0:	55                   	push   %ebp
+  8020a1:	89 e5                	mov    %esp,%ebp
+  8020a3:	56                   	push   %esi
+  8020a4:	53                   	push   %ebx
+  8020a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8020a8:	83 ec 0c             	sub    $0xc,%esp
+  8020ab:	68 04 70 80 00       	push   $0x807004
+  8020b0:	e8 9d 1a 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020bb:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8020c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020ca:	e8 fc fe ff ff       	call   801fcb <fsipc>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	79 16                	jns    8020ee <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8020d8:	83 ec 0c             	sub    $0xc,%esp
+  8020db:	68 04 70 80 00       	push   $0x807004
+  8020e0:	e8 da 1a 00 00       	call   803bbf <mutex_unlock>
+}
+  8020e5:	89 d8                	mov    %ebx,%eax
+  8020e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ea:	5b                   	pop    %ebx
+  8020eb:	5e                   	pop    %esi
+  8020ec:	5d                   	pop    %ebp
+  8020ed:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020ee:	83 ec 08             	sub    $0x8,%esp
+  8020f1:	68 00 80 80 00       	push   $0x808000
+  8020f6:	56                   	push   %esi
+  8020f7:	e8 b7 e7 ff ff       	call   8008b3 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8020fc:	a1 80 80 80 00       	mov    0x808080,%eax
+  802101:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802107:	a1 84 80 80 00       	mov    0x808084,%eax
+  80210c:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802112:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80211a:	eb bc                	jmp    8020d8 <devfile_stat+0x38>
+
+0080211c <devfile_write>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 10             	sub    $0x10,%esp
+  802123:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802126:	68 04 70 80 00       	push   $0x807004
+  80212b:	e8 22 1a 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802130:	8b 45 08             	mov    0x8(%ebp),%eax
+  802133:	8b 40 0c             	mov    0xc(%eax),%eax
+  802136:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802144:	76 3d                	jbe    802183 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802146:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80214b:	39 c3                	cmp    %eax,%ebx
+  80214d:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802150:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802153:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802158:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80215e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802163:	b8 04 00 00 00       	mov    $0x4,%eax
+  802168:	e8 5e fe ff ff       	call   801fcb <fsipc>
+  80216d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	68 04 70 80 00       	push   $0x807004
+  802177:	e8 43 1a 00 00       	call   803bbf <mutex_unlock>
+}
+  80217c:	89 d8                	mov    %ebx,%eax
+  80217e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802181:	c9                   	leave
+  802182:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802183:	83 ec 04             	sub    $0x4,%esp
+  802186:	53                   	push   %ebx
+  802187:	ff 75 0c             	push   0xc(%ebp)
+  80218a:	68 0c 80 80 00       	push   $0x80800c
+  80218f:	e8 a5 e8 ff ff       	call   800a39 <memmove>
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219c:	eb b5                	jmp    802153 <devfile_write+0x37>
+
+0080219e <devfile_read>:
+{
+  80219e:	55                   	push   %ebp
+  80219f:	89 e5                	mov    %esp,%ebp
+  8021a1:	57                   	push   %edi
+  8021a2:	56                   	push   %esi
+  8021a3:	53                   	push   %ebx
+  8021a4:	83 ec 0c             	sub    $0xc,%esp
+  8021a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021aa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8021b0:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8021b6:	0f 86 8c 00 00 00    	jbe    802248 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8021bc:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8021c1:	39 c3                	cmp    %eax,%ebx
+  8021c3:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8021c6:	89 f8                	mov    %edi,%eax
+  8021c8:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8021cb:	eb 0f                	jmp    8021dc <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8021cd:	0f b6 08             	movzbl (%eax),%ecx
+  8021d0:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8021d2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021d7:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8021dc:	39 d0                	cmp    %edx,%eax
+  8021de:	72 ed                	jb     8021cd <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8021e0:	83 ec 0c             	sub    $0xc,%esp
+  8021e3:	68 04 70 80 00       	push   $0x807004
+  8021e8:	e8 65 19 00 00       	call   803b52 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021ed:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021f0:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8021f5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8021fb:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  802201:	ba 00 00 00 00       	mov    $0x0,%edx
+  802206:	b8 03 00 00 00       	mov    $0x3,%eax
+  80220b:	e8 bb fd ff ff       	call   801fcb <fsipc>
+  802210:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802212:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802219:	e8 a1 19 00 00       	call   803bbf <mutex_unlock>
+		assert(r <= (int) n);
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	39 f3                	cmp    %esi,%ebx
+  802223:	7c 0a                	jl     80222f <devfile_read+0x91>
+}
+  802225:	89 f0                	mov    %esi,%eax
+  802227:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222a:	5b                   	pop    %ebx
+  80222b:	5e                   	pop    %esi
+  80222c:	5f                   	pop    %edi
+  80222d:	5d                   	pop    %ebp
+  80222e:	c3                   	ret
+		assert(r <= (int) n);
+  80222f:	68 a8 4e 80 00       	push   $0x804ea8
+  802234:	68 91 4d 80 00       	push   $0x804d91
+  802239:	68 90 00 00 00       	push   $0x90
+  80223e:	68 b5 4e 80 00       	push   $0x804eb5
+  802243:	e8 8a 22 00 00       	call   8044d2 <_panic>
+	mutex_lock(&fsipc_mu);
+  802248:	83 ec 0c             	sub    $0xc,%esp
+  80224b:	68 04 70 80 00       	push   $0x807004
+  802250:	e8 fd 18 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802255:	8b 46 0c             	mov    0xc(%esi),%eax
+  802258:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  80225d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802263:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  80226a:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80226d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802272:	b8 03 00 00 00       	mov    $0x3,%eax
+  802277:	e8 4f fd ff ff       	call   801fcb <fsipc>
+  80227c:	89 c6                	mov    %eax,%esi
+  80227e:	83 c4 10             	add    $0x10,%esp
+  802281:	85 c0                	test   %eax,%eax
+  802283:	78 1d                	js     8022a2 <devfile_read+0x104>
+		assert(r <= n);
+  802285:	39 c3                	cmp    %eax,%ebx
+  802287:	72 2e                	jb     8022b7 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802289:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80228e:	7f 40                	jg     8022d0 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802290:	83 ec 04             	sub    $0x4,%esp
+  802293:	50                   	push   %eax
+  802294:	68 00 80 80 00       	push   $0x808000
+  802299:	57                   	push   %edi
+  80229a:	e8 9a e7 ff ff       	call   800a39 <memmove>
+  80229f:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8022a2:	83 ec 0c             	sub    $0xc,%esp
+  8022a5:	68 04 70 80 00       	push   $0x807004
+  8022aa:	e8 10 19 00 00       	call   803bbf <mutex_unlock>
+	return r;
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	e9 6e ff ff ff       	jmp    802225 <devfile_read+0x87>
+		assert(r <= n);
+  8022b7:	68 c0 4e 80 00       	push   $0x804ec0
+  8022bc:	68 91 4d 80 00       	push   $0x804d91
+  8022c1:	68 99 00 00 00       	push   $0x99
+  8022c6:	68 b5 4e 80 00       	push   $0x804eb5
+  8022cb:	e8 02 22 00 00       	call   8044d2 <_panic>
+		assert(r <= PGSIZE);
+  8022d0:	68 c7 4e 80 00       	push   $0x804ec7
+  8022d5:	68 91 4d 80 00       	push   $0x804d91
+  8022da:	68 9a 00 00 00       	push   $0x9a
+  8022df:	68 b5 4e 80 00       	push   $0x804eb5
+  8022e4:	e8 e9 21 00 00       	call   8044d2 <_panic>
+
+008022e9 <open>:
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	56                   	push   %esi
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 1c             	sub    $0x1c,%esp
+  8022f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022f4:	56                   	push   %esi
+  8022f5:	e8 7e e5 ff ff       	call   800878 <strlen>
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802302:	0f 8f 85 00 00 00    	jg     80238d <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802308:	83 ec 0c             	sub    $0xc,%esp
+  80230b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230e:	50                   	push   %eax
+  80230f:	e8 a7 f6 ff ff       	call   8019bb <fd_alloc>
+  802314:	89 c3                	mov    %eax,%ebx
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 55                	js     802372 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80231d:	83 ec 0c             	sub    $0xc,%esp
+  802320:	68 04 70 80 00       	push   $0x807004
+  802325:	e8 28 18 00 00       	call   803b52 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80232a:	83 c4 08             	add    $0x8,%esp
+  80232d:	56                   	push   %esi
+  80232e:	68 00 80 80 00       	push   $0x808000
+  802333:	e8 7b e5 ff ff       	call   8008b3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802338:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80233b:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  802340:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802343:	b8 01 00 00 00       	mov    $0x1,%eax
+  802348:	e8 7e fc ff ff       	call   801fcb <fsipc>
+  80234d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80234f:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802356:	e8 64 18 00 00       	call   803bbf <mutex_unlock>
+	if (r < 0) {
+  80235b:	83 c4 10             	add    $0x10,%esp
+  80235e:	85 db                	test   %ebx,%ebx
+  802360:	78 19                	js     80237b <open+0x92>
+	return fd2num(fd);
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	ff 75 f4             	push   -0xc(%ebp)
+  802368:	e8 27 f6 ff ff       	call   801994 <fd2num>
+  80236d:	89 c3                	mov    %eax,%ebx
+  80236f:	83 c4 10             	add    $0x10,%esp
+}
+  802372:	89 d8                	mov    %ebx,%eax
+  802374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802377:	5b                   	pop    %ebx
+  802378:	5e                   	pop    %esi
+  802379:	5d                   	pop    %ebp
+  80237a:	c3                   	ret
+		fd_close(fd, 0);
+  80237b:	83 ec 08             	sub    $0x8,%esp
+  80237e:	6a 00                	push   $0x0
+  802380:	ff 75 f4             	push   -0xc(%ebp)
+  802383:	e8 56 f7 ff ff       	call   801ade <fd_close>
+		return r;
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	eb e5                	jmp    802372 <open+0x89>
+		return -E_BAD_PATH;
+  80238d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802392:	eb de                	jmp    802372 <open+0x89>
+
+00802394 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	53                   	push   %ebx
+  802398:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80239b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80239e:	50                   	push   %eax
+  80239f:	ff 75 08             	push   0x8(%ebp)
+  8023a2:	e8 6a f6 ff ff       	call   801a11 <fd_lookup>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 5b                	js     80240b <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b3:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8023b9:	39 08                	cmp    %ecx,(%eax)
+  8023bb:	75 55                	jne    802412 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8023bd:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8023c1:	74 56                	je     802419 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8023c3:	83 ec 0c             	sub    $0xc,%esp
+  8023c6:	68 04 70 80 00       	push   $0x807004
+  8023cb:	e8 82 17 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8023d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023d6:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  8023db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023de:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  8023e3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023e6:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8023eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023f5:	e8 d1 fb ff ff       	call   801fcb <fsipc>
+  8023fa:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023fc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802403:	e8 b7 17 00 00       	call   803bbf <mutex_unlock>
+	return r;
+  802408:	83 c4 10             	add    $0x10,%esp
+}
+  80240b:	89 d8                	mov    %ebx,%eax
+  80240d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+		return -E_NOT_SUPP;
+  802412:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802417:	eb f2                	jmp    80240b <fallocate+0x77>
+		return -E_INVAL;
+  802419:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80241e:	eb eb                	jmp    80240b <fallocate+0x77>
+
+00802420 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	56                   	push   %esi
+  802424:	53                   	push   %ebx
+  802425:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802428:	89 f3                	mov    %esi,%ebx
+  80242a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802430:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802433:	eb 06                	jmp    80243b <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802435:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80243b:	39 f3                	cmp    %esi,%ebx
+  80243d:	73 14                	jae    802453 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80243f:	83 ec 08             	sub    $0x8,%esp
+  802442:	53                   	push   %ebx
+  802443:	6a 00                	push   $0x0
+  802445:	e8 40 e9 ff ff       	call   800d8a <sys_page_unmap>
+  80244a:	83 c4 10             	add    $0x10,%esp
+  80244d:	85 c0                	test   %eax,%eax
+  80244f:	79 e4                	jns    802435 <munmap+0x15>
+  802451:	eb 05                	jmp    802458 <munmap+0x38>
+			return r;
+	return 0;
+  802453:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802458:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245b:	5b                   	pop    %ebx
+  80245c:	5e                   	pop    %esi
+  80245d:	5d                   	pop    %ebp
+  80245e:	c3                   	ret
+
+0080245f <mmap>:
+{
+  80245f:	55                   	push   %ebp
+  802460:	89 e5                	mov    %esp,%ebp
+  802462:	57                   	push   %edi
+  802463:	56                   	push   %esi
+  802464:	53                   	push   %ebx
+  802465:	83 ec 24             	sub    $0x24,%esp
+  802468:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80246b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80246e:	50                   	push   %eax
+  80246f:	ff 75 08             	push   0x8(%ebp)
+  802472:	e8 9a f5 ff ff       	call   801a11 <fd_lookup>
+  802477:	83 c4 10             	add    $0x10,%esp
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	0f 88 37 01 00 00    	js     8025b9 <mmap+0x15a>
+		return NULL;
+  802482:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802487:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80248a:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802490:	39 0a                	cmp    %ecx,(%edx)
+  802492:	0f 85 05 01 00 00    	jne    80259d <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802498:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80249f:	0f 85 1b 01 00 00    	jne    8025c0 <mmap+0x161>
+  8024a5:	89 f0                	mov    %esi,%eax
+  8024a7:	83 e8 01             	sub    $0x1,%eax
+  8024aa:	0f 88 17 01 00 00    	js     8025c7 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8024b0:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8024b4:	75 28                	jne    8024de <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8024b6:	83 ec 0c             	sub    $0xc,%esp
+  8024b9:	68 04 70 80 00       	push   $0x807004
+  8024be:	e8 8f 16 00 00       	call   803b52 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8024c3:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8024c9:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8024d7:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8024dc:	eb 2b                	jmp    802509 <mmap+0xaa>
+		cow_enable();
+  8024de:	e8 b5 ee ff ff       	call   801398 <cow_enable>
+  8024e3:	eb d1                	jmp    8024b6 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8024e5:	89 c2                	mov    %eax,%edx
+  8024e7:	c1 ea 0c             	shr    $0xc,%edx
+  8024ea:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8024f1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8024f7:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8024fd:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802500:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802502:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802507:	77 25                	ja     80252e <mmap+0xcf>
+  802509:	89 c2                	mov    %eax,%edx
+  80250b:	29 da                	sub    %ebx,%edx
+  80250d:	39 ca                	cmp    %ecx,%edx
+  80250f:	73 3a                	jae    80254b <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802511:	89 c2                	mov    %eax,%edx
+  802513:	c1 ea 16             	shr    $0x16,%edx
+  802516:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80251d:	f6 c2 01             	test   $0x1,%dl
+  802520:	75 c3                	jne    8024e5 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802522:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802527:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80252c:	eb d4                	jmp    802502 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80252e:	29 d8                	sub    %ebx,%eax
+  802530:	39 c8                	cmp    %ecx,%eax
+  802532:	73 17                	jae    80254b <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802534:	83 ec 0c             	sub    $0xc,%esp
+  802537:	68 04 70 80 00       	push   $0x807004
+  80253c:	e8 7e 16 00 00       	call   803bbf <mutex_unlock>
+		return NULL;
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	b8 00 00 00 00       	mov    $0x0,%eax
+  802549:	eb 52                	jmp    80259d <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80254b:	85 db                	test   %ebx,%ebx
+  80254d:	74 e5                	je     802534 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80254f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802552:	8b 40 0c             	mov    0xc(%eax),%eax
+  802555:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  80255a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80255d:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802562:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802568:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  80256e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802571:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802580:	e8 46 fa ff ff       	call   801fcb <fsipc>
+  802585:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802587:	83 ec 0c             	sub    $0xc,%esp
+  80258a:	68 04 70 80 00       	push   $0x807004
+  80258f:	e8 2b 16 00 00       	call   803bbf <mutex_unlock>
+	if (r < 0) {
+  802594:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802597:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802599:	85 ff                	test   %edi,%edi
+  80259b:	78 08                	js     8025a5 <mmap+0x146>
+}
+  80259d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025a0:	5b                   	pop    %ebx
+  8025a1:	5e                   	pop    %esi
+  8025a2:	5f                   	pop    %edi
+  8025a3:	5d                   	pop    %ebp
+  8025a4:	c3                   	ret
+		munmap((void*) va, len);
+  8025a5:	83 ec 08             	sub    $0x8,%esp
+  8025a8:	56                   	push   %esi
+  8025a9:	53                   	push   %ebx
+  8025aa:	e8 71 fe ff ff       	call   802420 <munmap>
+		return NULL;
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b7:	eb e4                	jmp    80259d <mmap+0x13e>
+		return NULL;
+  8025b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025be:	eb dd                	jmp    80259d <mmap+0x13e>
+		return NULL;
+  8025c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c5:	eb d6                	jmp    80259d <mmap+0x13e>
+  8025c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cc:	eb cf                	jmp    80259d <mmap+0x13e>
+
+008025ce <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	53                   	push   %ebx
+  8025d2:	83 ec 10             	sub    $0x10,%esp
+  8025d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025d8:	53                   	push   %ebx
+  8025d9:	e8 9a e2 ff ff       	call   800878 <strlen>
+  8025de:	83 c4 10             	add    $0x10,%esp
+  8025e1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025e6:	7f 42                	jg     80262a <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8025e8:	83 ec 0c             	sub    $0xc,%esp
+  8025eb:	68 04 70 80 00       	push   $0x807004
+  8025f0:	e8 5d 15 00 00       	call   803b52 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025f5:	83 c4 08             	add    $0x8,%esp
+  8025f8:	53                   	push   %ebx
+  8025f9:	68 00 80 80 00       	push   $0x808000
+  8025fe:	e8 b0 e2 ff ff       	call   8008b3 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802603:	ba 00 00 00 00       	mov    $0x0,%edx
+  802608:	b8 07 00 00 00       	mov    $0x7,%eax
+  80260d:	e8 b9 f9 ff ff       	call   801fcb <fsipc>
+  802612:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802614:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80261b:	e8 9f 15 00 00       	call   803bbf <mutex_unlock>
+	return r;
+  802620:	83 c4 10             	add    $0x10,%esp
+}
+  802623:	89 d8                	mov    %ebx,%eax
+  802625:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802628:	c9                   	leave
+  802629:	c3                   	ret
+		return -E_BAD_PATH;
+  80262a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80262f:	eb f2                	jmp    802623 <remove+0x55>
+
+00802631 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802631:	55                   	push   %ebp
+  802632:	89 e5                	mov    %esp,%ebp
+  802634:	53                   	push   %ebx
+  802635:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802638:	68 04 70 80 00       	push   $0x807004
+  80263d:	e8 10 15 00 00       	call   803b52 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802642:	ba 00 00 00 00       	mov    $0x0,%edx
+  802647:	b8 08 00 00 00       	mov    $0x8,%eax
+  80264c:	e8 7a f9 ff ff       	call   801fcb <fsipc>
+  802651:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802653:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80265a:	e8 60 15 00 00       	call   803bbf <mutex_unlock>
+	return r;
+}
+  80265f:	89 d8                	mov    %ebx,%eax
+  802661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+
+00802666 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802666:	55                   	push   %ebp
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	56                   	push   %esi
+  80266a:	53                   	push   %ebx
+  80266b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80266e:	83 ec 0c             	sub    $0xc,%esp
+  802671:	68 04 70 80 00       	push   $0x807004
+  802676:	e8 d7 14 00 00       	call   803b52 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80267b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267e:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802683:	ba 00 00 00 00       	mov    $0x0,%edx
+  802688:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80268d:	e8 39 f9 ff ff       	call   801fcb <fsipc>
+  802692:	89 c6                	mov    %eax,%esi
+  802694:	83 c4 10             	add    $0x10,%esp
+  802697:	85 db                	test   %ebx,%ebx
+  802699:	74 7b                	je     802716 <fs_bcstat+0xb0>
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	78 77                	js     802716 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80269f:	a1 00 80 80 00       	mov    0x808000,%eax
+  8026a4:	89 03                	mov    %eax,(%ebx)
+  8026a6:	a1 04 80 80 00       	mov    0x808004,%eax
+  8026ab:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026ae:	a1 08 80 80 00       	mov    0x808008,%eax
+  8026b3:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026b6:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8026bb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026be:	a1 10 80 80 00       	mov    0x808010,%eax
+  8026c3:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026c6:	a1 14 80 80 00       	mov    0x808014,%eax
+  8026cb:	89 43 14             	mov    %eax,0x14(%ebx)
+  8026ce:	a1 18 80 80 00       	mov    0x808018,%eax
+  8026d3:	89 43 18             	mov    %eax,0x18(%ebx)
+  8026d6:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8026db:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8026de:	a1 20 80 80 00       	mov    0x808020,%eax
+  8026e3:	89 43 20             	mov    %eax,0x20(%ebx)
+  8026e6:	a1 24 80 80 00       	mov    0x808024,%eax
+  8026eb:	89 43 24             	mov    %eax,0x24(%ebx)
+  8026ee:	a1 28 80 80 00       	mov    0x808028,%eax
+  8026f3:	89 43 28             	mov    %eax,0x28(%ebx)
+  8026f6:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8026fb:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8026fe:	a1 30 80 80 00       	mov    0x808030,%eax
+  802703:	89 43 30             	mov    %eax,0x30(%ebx)
+  802706:	a1 34 80 80 00       	mov    0x808034,%eax
+  80270b:	89 43 34             	mov    %eax,0x34(%ebx)
+  80270e:	a1 38 80 80 00       	mov    0x808038,%eax
+  802713:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802716:	83 ec 0c             	sub    $0xc,%esp
+  802719:	68 04 70 80 00       	push   $0x807004
+  80271e:	e8 9c 14 00 00       	call   803bbf <mutex_unlock>
+	return r;
+}
+  802723:	89 f0                	mov    %esi,%eax
+  802725:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802728:	5b                   	pop    %ebx
+  802729:	5e                   	pop    %esi
+  80272a:	5d                   	pop    %ebp
+  80272b:	c3                   	ret
+
+0080272c <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	56                   	push   %esi
+  802730:	53                   	push   %ebx
+  802731:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802733:	0f b6 10             	movzbl (%eax),%edx
+  802736:	80 fa 72             	cmp    $0x72,%dl
+  802739:	74 44                	je     80277f <parse_mode+0x53>
+  80273b:	80 fa 77             	cmp    $0x77,%dl
+  80273e:	74 4b                	je     80278b <parse_mode+0x5f>
+  802740:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802745:	80 fa 61             	cmp    $0x61,%dl
+  802748:	74 09                	je     802753 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80274a:	89 d8                	mov    %ebx,%eax
+  80274c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274f:	5b                   	pop    %ebx
+  802750:	5e                   	pop    %esi
+  802751:	5d                   	pop    %ebp
+  802752:	c3                   	ret
+	switch (mode[0]) {
+  802753:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802758:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80275d:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80275f:	83 ec 08             	sub    $0x8,%esp
+  802762:	6a 2b                	push   $0x2b
+  802764:	50                   	push   %eax
+  802765:	e8 5b e2 ff ff       	call   8009c5 <strchr>
+  80276a:	83 c4 10             	add    $0x10,%esp
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	74 d9                	je     80274a <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802771:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802774:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802777:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80277d:	eb cb                	jmp    80274a <parse_mode+0x1e>
+	switch (mode[0]) {
+  80277f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802784:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802789:	eb d2                	jmp    80275d <parse_mode+0x31>
+  80278b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802790:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802795:	eb c6                	jmp    80275d <parse_mode+0x31>
+
+00802797 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802797:	55                   	push   %ebp
+  802798:	89 e5                	mov    %esp,%ebp
+  80279a:	57                   	push   %edi
+  80279b:	56                   	push   %esi
+  80279c:	53                   	push   %ebx
+  80279d:	83 ec 1c             	sub    $0x1c,%esp
+  8027a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027a3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8027a6:	b8 24 60 80 00       	mov    $0x806024,%eax
+  8027ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8027b0:	83 c0 24             	add    $0x24,%eax
+  8027b3:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8027b7:	74 17                	je     8027d0 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8027b9:	83 c3 01             	add    $0x1,%ebx
+  8027bc:	83 fb 10             	cmp    $0x10,%ebx
+  8027bf:	75 ef                	jne    8027b0 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8027c1:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8027c6:	89 f0                	mov    %esi,%eax
+  8027c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027cb:	5b                   	pop    %ebx
+  8027cc:	5e                   	pop    %esi
+  8027cd:	5f                   	pop    %edi
+  8027ce:	5d                   	pop    %ebp
+  8027cf:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8027d0:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8027d7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8027da:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8027dd:	c1 e7 02             	shl    $0x2,%edi
+  8027e0:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8027e6:	83 ec 04             	sub    $0x4,%esp
+  8027e9:	6a 24                	push   $0x24
+  8027eb:	6a 00                	push   $0x0
+  8027ed:	56                   	push   %esi
+  8027ee:	e8 11 e2 ff ff       	call   800a04 <memset>
+			streams[i].f_fd = fd;
+  8027f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027f6:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8027fc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027ff:	01 d8                	add    %ebx,%eax
+  802801:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802804:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  80280b:	83 c4 10             	add    $0x10,%esp
+  80280e:	eb b6                	jmp    8027c6 <stream_alloc+0x2f>
+
+00802810 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802810:	55                   	push   %ebp
+  802811:	89 e5                	mov    %esp,%ebp
+  802813:	53                   	push   %ebx
+  802814:	83 ec 14             	sub    $0x14,%esp
+  802817:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802819:	8b 40 18             	mov    0x18(%eax),%eax
+  80281c:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80281f:	74 4a                	je     80286b <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802821:	83 ec 08             	sub    $0x8,%esp
+  802824:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802827:	50                   	push   %eax
+  802828:	ff 33                	push   (%ebx)
+  80282a:	e8 e2 f1 ff ff       	call   801a11 <fd_lookup>
+  80282f:	89 c2                	mov    %eax,%edx
+  802831:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802834:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802839:	85 d2                	test   %edx,%edx
+  80283b:	78 41                	js     80287e <stream_unread+0x6e>
+  80283d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802840:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802846:	39 0a                	cmp    %ecx,(%edx)
+  802848:	75 34                	jne    80287e <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80284a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80284d:	03 42 04             	add    0x4(%edx),%eax
+  802850:	2b 43 18             	sub    0x18(%ebx),%eax
+  802853:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802856:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80285d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802864:	b8 01 00 00 00       	mov    $0x1,%eax
+  802869:	eb 13                	jmp    80287e <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80286b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802872:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802879:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80287e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802881:	c9                   	leave
+  802882:	c3                   	ret
+
+00802883 <stream_drain>:
+{
+  802883:	55                   	push   %ebp
+  802884:	89 e5                	mov    %esp,%ebp
+  802886:	56                   	push   %esi
+  802887:	53                   	push   %ebx
+  802888:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80288a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80288f:	eb 02                	jmp    802893 <stream_drain+0x10>
+  802891:	01 c3                	add    %eax,%ebx
+  802893:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802896:	39 c3                	cmp    %eax,%ebx
+  802898:	73 43                	jae    8028dd <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80289a:	83 ec 04             	sub    $0x4,%esp
+  80289d:	29 d8                	sub    %ebx,%eax
+  80289f:	50                   	push   %eax
+  8028a0:	89 d8                	mov    %ebx,%eax
+  8028a2:	03 46 0c             	add    0xc(%esi),%eax
+  8028a5:	50                   	push   %eax
+  8028a6:	ff 36                	push   (%esi)
+  8028a8:	e8 ec f4 ff ff       	call   801d99 <write>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	7f dd                	jg     802891 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8028b4:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8028b8:	8b 56 0c             	mov    0xc(%esi),%edx
+  8028bb:	83 ec 04             	sub    $0x4,%esp
+  8028be:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028c1:	29 d8                	sub    %ebx,%eax
+  8028c3:	50                   	push   %eax
+  8028c4:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8028c7:	50                   	push   %eax
+  8028c8:	52                   	push   %edx
+  8028c9:	e8 6b e1 ff ff       	call   800a39 <memmove>
+			f->f_wend -= done;
+  8028ce:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028d1:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8028d3:	83 c4 10             	add    $0x10,%esp
+  8028d6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8028db:	eb 0a                	jmp    8028e7 <stream_drain+0x64>
+  8028dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8028e2:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8028e7:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8028ea:	89 d0                	mov    %edx,%eax
+  8028ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ef:	5b                   	pop    %ebx
+  8028f0:	5e                   	pop    %esi
+  8028f1:	5d                   	pop    %ebp
+  8028f2:	c3                   	ret
+
+008028f3 <stream_setup>:
+	if (f->f_buf)
+  8028f3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8028f7:	74 01                	je     8028fa <stream_setup+0x7>
+  8028f9:	c3                   	ret
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	53                   	push   %ebx
+  8028fe:	83 ec 04             	sub    $0x4,%esp
+  802901:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802903:	8b 40 08             	mov    0x8(%eax),%eax
+  802906:	85 c0                	test   %eax,%eax
+  802908:	74 17                	je     802921 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80290a:	83 f8 03             	cmp    $0x3,%eax
+  80290d:	75 2d                	jne    80293c <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80290f:	8d 43 20             	lea    0x20(%ebx),%eax
+  802912:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802915:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80291c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291f:	c9                   	leave
+  802920:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802921:	83 ec 0c             	sub    $0xc,%esp
+  802924:	ff 33                	push   (%ebx)
+  802926:	e8 29 1b 00 00       	call   804454 <iscons>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	0f 9f c0             	setg   %al
+  802933:	0f b6 c0             	movzbl %al,%eax
+  802936:	83 c0 01             	add    $0x1,%eax
+  802939:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80293c:	83 ec 0c             	sub    $0xc,%esp
+  80293f:	68 00 10 00 00       	push   $0x1000
+  802944:	e8 6e 0b 00 00       	call   8034b7 <malloc>
+  802949:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	74 bc                	je     80290f <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802953:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80295a:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80295e:	eb bc                	jmp    80291c <stream_setup+0x29>
+
+00802960 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	53                   	push   %ebx
+  802964:	83 ec 04             	sub    $0x4,%esp
+  802967:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802969:	e8 85 ff ff ff       	call   8028f3 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80296e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802973:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802977:	74 3d                	je     8029b6 <stream_fill+0x56>
+  802979:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80297d:	74 10                	je     80298f <stream_fill+0x2f>
+  80297f:	89 d8                	mov    %ebx,%eax
+  802981:	e8 fd fe ff ff       	call   802883 <stream_drain>
+		return 0;
+  802986:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80298b:	85 c0                	test   %eax,%eax
+  80298d:	78 27                	js     8029b6 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80298f:	83 ec 04             	sub    $0x4,%esp
+  802992:	ff 73 10             	push   0x10(%ebx)
+  802995:	ff 73 0c             	push   0xc(%ebx)
+  802998:	ff 33                	push   (%ebx)
+  80299a:	e8 02 f3 ff ff       	call   801ca1 <read>
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	7e 17                	jle    8029bd <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8029a6:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8029aa:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8029b1:	89 c2                	mov    %eax,%edx
+  8029b3:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8029b6:	89 d0                	mov    %edx,%eax
+  8029b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bb:	c9                   	leave
+  8029bc:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8029bd:	c1 f8 1f             	sar    $0x1f,%eax
+  8029c0:	83 e0 04             	and    $0x4,%eax
+  8029c3:	83 c0 04             	add    $0x4,%eax
+  8029c6:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8029c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ce:	eb e6                	jmp    8029b6 <stream_fill+0x56>
+
+008029d0 <fopen>:
+{
+  8029d0:	55                   	push   %ebp
+  8029d1:	89 e5                	mov    %esp,%ebp
+  8029d3:	57                   	push   %edi
+  8029d4:	56                   	push   %esi
+  8029d5:	53                   	push   %ebx
+  8029d6:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8029dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8029df:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8029e5:	89 f0                	mov    %esi,%eax
+  8029e7:	e8 40 fd ff ff       	call   80272c <parse_mode>
+		return 0;
+  8029ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8029f1:	85 c0                	test   %eax,%eax
+  8029f3:	78 2d                	js     802a22 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8029f5:	83 ec 08             	sub    $0x8,%esp
+  8029f8:	50                   	push   %eax
+  8029f9:	ff 75 08             	push   0x8(%ebp)
+  8029fc:	e8 e8 f8 ff ff       	call   8022e9 <open>
+  802a01:	89 c7                	mov    %eax,%edi
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 58                	js     802a62 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a0a:	80 3e 61             	cmpb   $0x61,(%esi)
+  802a0d:	74 1d                	je     802a2c <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802a0f:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802a15:	89 f8                	mov    %edi,%eax
+  802a17:	e8 7b fd ff ff       	call   802797 <stream_alloc>
+  802a1c:	89 c3                	mov    %eax,%ebx
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	74 32                	je     802a54 <fopen+0x84>
+}
+  802a22:	89 d8                	mov    %ebx,%eax
+  802a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a27:	5b                   	pop    %ebx
+  802a28:	5e                   	pop    %esi
+  802a29:	5f                   	pop    %edi
+  802a2a:	5d                   	pop    %ebp
+  802a2b:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a2c:	83 ec 08             	sub    $0x8,%esp
+  802a2f:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802a35:	50                   	push   %eax
+  802a36:	57                   	push   %edi
+  802a37:	e8 db f4 ff ff       	call   801f17 <fstat>
+  802a3c:	83 c4 10             	add    $0x10,%esp
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	78 cc                	js     802a0f <fopen+0x3f>
+		seek(fd, st.st_size);
+  802a43:	83 ec 08             	sub    $0x8,%esp
+  802a46:	ff 75 dc             	push   -0x24(%ebp)
+  802a49:	57                   	push   %edi
+  802a4a:	e8 f6 f3 ff ff       	call   801e45 <seek>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+  802a52:	eb bb                	jmp    802a0f <fopen+0x3f>
+		close(fd);
+  802a54:	83 ec 0c             	sub    $0xc,%esp
+  802a57:	57                   	push   %edi
+  802a58:	e8 08 f1 ff ff       	call   801b65 <close>
+  802a5d:	83 c4 10             	add    $0x10,%esp
+  802a60:	eb c0                	jmp    802a22 <fopen+0x52>
+		return 0;
+  802a62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a67:	eb b9                	jmp    802a22 <fopen+0x52>
+
+00802a69 <fdopen>:
+{
+  802a69:	55                   	push   %ebp
+  802a6a:	89 e5                	mov    %esp,%ebp
+  802a6c:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802a6f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a75:	e8 b2 fc ff ff       	call   80272c <parse_mode>
+  802a7a:	89 c2                	mov    %eax,%edx
+		return 0;
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802a81:	85 d2                	test   %edx,%edx
+  802a83:	78 0b                	js     802a90 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802a85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8b:	e8 07 fd ff ff       	call   802797 <stream_alloc>
+}
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+
+00802a92 <setvbuf>:
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	57                   	push   %edi
+  802a96:	56                   	push   %esi
+  802a97:	53                   	push   %ebx
+  802a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a9e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802aa1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802aa5:	75 3a                	jne    802ae1 <setvbuf+0x4f>
+  802aa7:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802aaa:	83 fe 02             	cmp    $0x2,%esi
+  802aad:	77 39                	ja     802ae8 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802aaf:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802ab2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802ab6:	0f 95 c3             	setne  %bl
+  802ab9:	85 ff                	test   %edi,%edi
+  802abb:	0f 95 c1             	setne  %cl
+  802abe:	84 cb                	test   %cl,%bl
+  802ac0:	74 05                	je     802ac7 <setvbuf+0x35>
+  802ac2:	83 fa 03             	cmp    $0x3,%edx
+  802ac5:	75 0a                	jne    802ad1 <setvbuf+0x3f>
+	return 0;
+  802ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802acc:	5b                   	pop    %ebx
+  802acd:	5e                   	pop    %esi
+  802ace:	5f                   	pop    %edi
+  802acf:	5d                   	pop    %ebp
+  802ad0:	c3                   	ret
+		f->f_buf = buf;
+  802ad1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ad4:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802ad7:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adf:	eb eb                	jmp    802acc <setvbuf+0x3a>
+		return EOF;
+  802ae1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ae6:	eb e4                	jmp    802acc <setvbuf+0x3a>
+  802ae8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aed:	eb dd                	jmp    802acc <setvbuf+0x3a>
+
+00802aef <fflush>:
+{
+  802aef:	55                   	push   %ebp
+  802af0:	89 e5                	mov    %esp,%ebp
+  802af2:	57                   	push   %edi
+  802af3:	56                   	push   %esi
+  802af4:	53                   	push   %ebx
+  802af5:	83 ec 0c             	sub    $0xc,%esp
+  802af8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802afb:	85 db                	test   %ebx,%ebx
+  802afd:	74 1a                	je     802b19 <fflush+0x2a>
+	stream_unread(f);
+  802aff:	89 d8                	mov    %ebx,%eax
+  802b01:	e8 0a fd ff ff       	call   802810 <stream_unread>
+	return stream_drain(f);
+  802b06:	89 d8                	mov    %ebx,%eax
+  802b08:	e8 76 fd ff ff       	call   802883 <stream_drain>
+  802b0d:	89 c7                	mov    %eax,%edi
+}
+  802b0f:	89 f8                	mov    %edi,%eax
+  802b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b14:	5b                   	pop    %ebx
+  802b15:	5e                   	pop    %esi
+  802b16:	5f                   	pop    %edi
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+  802b19:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802b1e:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b28:	eb 03                	jmp    802b2d <fflush+0x3e>
+  802b2a:	83 c3 24             	add    $0x24,%ebx
+  802b2d:	39 f3                	cmp    %esi,%ebx
+  802b2f:	74 de                	je     802b0f <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802b31:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802b35:	74 f3                	je     802b2a <fflush+0x3b>
+  802b37:	83 ec 0c             	sub    $0xc,%esp
+  802b3a:	53                   	push   %ebx
+  802b3b:	e8 af ff ff ff       	call   802aef <fflush>
+  802b40:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b4a:	0f 48 f8             	cmovs  %eax,%edi
+  802b4d:	eb db                	jmp    802b2a <fflush+0x3b>
+
+00802b4f <fclose>:
+{
+  802b4f:	55                   	push   %ebp
+  802b50:	89 e5                	mov    %esp,%ebp
+  802b52:	56                   	push   %esi
+  802b53:	53                   	push   %ebx
+  802b54:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802b57:	83 ec 0c             	sub    $0xc,%esp
+  802b5a:	56                   	push   %esi
+  802b5b:	e8 8f ff ff ff       	call   802aef <fflush>
+  802b60:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802b62:	83 c4 04             	add    $0x4,%esp
+  802b65:	ff 36                	push   (%esi)
+  802b67:	e8 f9 ef ff ff       	call   801b65 <close>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b76:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802b79:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802b7d:	75 10                	jne    802b8f <fclose+0x40>
+	f->f_flags = 0;
+  802b7f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802b86:	89 d8                	mov    %ebx,%eax
+  802b88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b8b:	5b                   	pop    %ebx
+  802b8c:	5e                   	pop    %esi
+  802b8d:	5d                   	pop    %ebp
+  802b8e:	c3                   	ret
+		free(f->f_buf);
+  802b8f:	83 ec 0c             	sub    $0xc,%esp
+  802b92:	ff 76 0c             	push   0xc(%esi)
+  802b95:	e8 54 08 00 00       	call   8033ee <free>
+  802b9a:	83 c4 10             	add    $0x10,%esp
+  802b9d:	eb e0                	jmp    802b7f <fclose+0x30>
+
+00802b9f <fileno>:
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba5:	8b 00                	mov    (%eax),%eax
+}
+  802ba7:	5d                   	pop    %ebp
+  802ba8:	c3                   	ret
+
+00802ba9 <feof>:
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baf:	8b 40 04             	mov    0x4(%eax),%eax
+  802bb2:	c1 e8 02             	shr    $0x2,%eax
+  802bb5:	83 e0 01             	and    $0x1,%eax
+}
+  802bb8:	5d                   	pop    %ebp
+  802bb9:	c3                   	ret
+
+00802bba <ferror>:
+{
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc0:	8b 40 04             	mov    0x4(%eax),%eax
+  802bc3:	c1 e8 03             	shr    $0x3,%eax
+  802bc6:	83 e0 01             	and    $0x1,%eax
+}
+  802bc9:	5d                   	pop    %ebp
+  802bca:	c3                   	ret
+
+00802bcb <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	53                   	push   %ebx
+  802bcf:	83 ec 04             	sub    $0x4,%esp
+  802bd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802bd5:	8b 43 18             	mov    0x18(%ebx),%eax
+  802bd8:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802bdb:	74 15                	je     802bf2 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802bdd:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802be0:	8b 43 14             	mov    0x14(%ebx),%eax
+  802be3:	8d 48 01             	lea    0x1(%eax),%ecx
+  802be6:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802be9:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802bed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf0:	c9                   	leave
+  802bf1:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802bf2:	89 d8                	mov    %ebx,%eax
+  802bf4:	e8 67 fd ff ff       	call   802960 <stream_fill>
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	75 e0                	jne    802bdd <fgetc+0x12>
+		return EOF;
+  802bfd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c02:	eb e9                	jmp    802bed <fgetc+0x22>
+
+00802c04 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	57                   	push   %edi
+  802c08:	56                   	push   %esi
+  802c09:	53                   	push   %ebx
+  802c0a:	83 ec 1c             	sub    $0x1c,%esp
+  802c0d:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802c10:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c18:	83 e8 01             	sub    $0x1,%eax
+  802c1b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802c1e:	eb 66                	jmp    802c86 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c20:	8b 46 14             	mov    0x14(%esi),%eax
+  802c23:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c26:	29 c3                	sub    %eax,%ebx
+  802c28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c2b:	29 fa                	sub    %edi,%edx
+  802c2d:	39 d3                	cmp    %edx,%ebx
+  802c2f:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c32:	83 ec 04             	sub    $0x4,%esp
+  802c35:	53                   	push   %ebx
+  802c36:	6a 0a                	push   $0xa
+  802c38:	03 46 0c             	add    0xc(%esi),%eax
+  802c3b:	50                   	push   %eax
+  802c3c:	e8 a9 de ff ff       	call   800aea <memfind>
+  802c41:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802c44:	8b 46 0c             	mov    0xc(%esi),%eax
+  802c47:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802c4a:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802c4d:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c4f:	83 c4 10             	add    $0x10,%esp
+  802c52:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802c55:	74 0b                	je     802c62 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802c57:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c5a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c5d:	29 d3                	sub    %edx,%ebx
+  802c5f:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802c62:	83 ec 04             	sub    $0x4,%esp
+  802c65:	53                   	push   %ebx
+  802c66:	01 c8                	add    %ecx,%eax
+  802c68:	50                   	push   %eax
+  802c69:	89 f8                	mov    %edi,%eax
+  802c6b:	03 45 08             	add    0x8(%ebp),%eax
+  802c6e:	50                   	push   %eax
+  802c6f:	e8 c5 dd ff ff       	call   800a39 <memmove>
+		f->f_rpos += m;
+  802c74:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802c77:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802c79:	83 c4 10             	add    $0x10,%esp
+  802c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7f:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802c84:	74 1f                	je     802ca5 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802c86:	8d 47 01             	lea    0x1(%edi),%eax
+  802c89:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802c8c:	73 17                	jae    802ca5 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c8e:	8b 46 18             	mov    0x18(%esi),%eax
+  802c91:	39 46 14             	cmp    %eax,0x14(%esi)
+  802c94:	75 8a                	jne    802c20 <fgets+0x1c>
+  802c96:	89 f0                	mov    %esi,%eax
+  802c98:	e8 c3 fc ff ff       	call   802960 <stream_fill>
+  802c9d:	85 c0                	test   %eax,%eax
+  802c9f:	0f 85 7b ff ff ff    	jne    802c20 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802ca5:	85 ff                	test   %edi,%edi
+  802ca7:	74 0f                	je     802cb8 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb3:	5b                   	pop    %ebx
+  802cb4:	5e                   	pop    %esi
+  802cb5:	5f                   	pop    %edi
+  802cb6:	5d                   	pop    %ebp
+  802cb7:	c3                   	ret
+		return 0;
+  802cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbd:	eb f1                	jmp    802cb0 <fgets+0xac>
+
+00802cbf <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	57                   	push   %edi
+  802cc3:	56                   	push   %esi
+  802cc4:	53                   	push   %ebx
+  802cc5:	83 ec 1c             	sub    $0x1c,%esp
+  802cc8:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802ccb:	89 f0                	mov    %esi,%eax
+  802ccd:	e8 21 fc ff ff       	call   8028f3 <stream_setup>
+	want = size * n;
+  802cd2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd5:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802cd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce1:	eb 43                	jmp    802d26 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802ce3:	29 d3                	sub    %edx,%ebx
+  802ce5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ce8:	29 f8                	sub    %edi,%eax
+  802cea:	39 c3                	cmp    %eax,%ebx
+  802cec:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802cef:	83 ec 04             	sub    $0x4,%esp
+  802cf2:	53                   	push   %ebx
+  802cf3:	03 56 0c             	add    0xc(%esi),%edx
+  802cf6:	52                   	push   %edx
+  802cf7:	89 f8                	mov    %edi,%eax
+  802cf9:	03 45 08             	add    0x8(%ebp),%eax
+  802cfc:	50                   	push   %eax
+  802cfd:	e8 37 dd ff ff       	call   800a39 <memmove>
+			f->f_rpos += m;
+  802d02:	01 5e 14             	add    %ebx,0x14(%esi)
+  802d05:	83 c4 10             	add    $0x10,%esp
+  802d08:	eb 1a                	jmp    802d24 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802d0a:	83 ec 04             	sub    $0x4,%esp
+  802d0d:	53                   	push   %ebx
+  802d0e:	89 f8                	mov    %edi,%eax
+  802d10:	03 45 08             	add    0x8(%ebp),%eax
+  802d13:	50                   	push   %eax
+  802d14:	ff 36                	push   (%esi)
+  802d16:	e8 86 ef ff ff       	call   801ca1 <read>
+  802d1b:	89 c3                	mov    %eax,%ebx
+  802d1d:	83 c4 10             	add    $0x10,%esp
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	7e 36                	jle    802d5a <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802d24:	01 df                	add    %ebx,%edi
+  802d26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d29:	39 c7                	cmp    %eax,%edi
+  802d2b:	73 39                	jae    802d66 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802d2d:	8b 56 14             	mov    0x14(%esi),%edx
+  802d30:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802d33:	39 da                	cmp    %ebx,%edx
+  802d35:	72 ac                	jb     802ce3 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802d37:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d3a:	29 fb                	sub    %edi,%ebx
+  802d3c:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802d3f:	72 3e                	jb     802d7f <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802d41:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802d45:	74 1f                	je     802d66 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802d47:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802d4b:	74 bd                	je     802d0a <fread+0x4b>
+  802d4d:	89 f0                	mov    %esi,%eax
+  802d4f:	e8 2f fb ff ff       	call   802883 <stream_drain>
+  802d54:	85 c0                	test   %eax,%eax
+  802d56:	79 b2                	jns    802d0a <fread+0x4b>
+  802d58:	eb 0c                	jmp    802d66 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802d5a:	c1 fb 1f             	sar    $0x1f,%ebx
+  802d5d:	83 e3 04             	and    $0x4,%ebx
+  802d60:	83 c3 04             	add    $0x4,%ebx
+  802d63:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802d66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	74 0a                	je     802d77 <fread+0xb8>
+  802d6d:	89 f8                	mov    %edi,%eax
+  802d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d74:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	5f                   	pop    %edi
+  802d7d:	5d                   	pop    %ebp
+  802d7e:	c3                   	ret
+		} else if (!stream_fill(f))
+  802d7f:	89 f0                	mov    %esi,%eax
+  802d81:	e8 da fb ff ff       	call   802960 <stream_fill>
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	74 dc                	je     802d66 <fread+0xa7>
+			m = 0;
+  802d8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8f:	eb 93                	jmp    802d24 <fread+0x65>
+
+00802d91 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	57                   	push   %edi
+  802d95:	56                   	push   %esi
+  802d96:	53                   	push   %ebx
+  802d97:	83 ec 1c             	sub    $0x1c,%esp
+  802d9a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802d9d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802da0:	a8 02                	test   $0x2,%al
+  802da2:	75 13                	jne    802db7 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802da4:	83 c8 08             	or     $0x8,%eax
+  802da7:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802daa:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db2:	5b                   	pop    %ebx
+  802db3:	5e                   	pop    %esi
+  802db4:	5f                   	pop    %edi
+  802db5:	5d                   	pop    %ebp
+  802db6:	c3                   	ret
+	stream_setup(f);
+  802db7:	89 d8                	mov    %ebx,%eax
+  802db9:	e8 35 fb ff ff       	call   8028f3 <stream_setup>
+	want = size * n;
+  802dbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dc1:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802dc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802dc8:	89 d8                	mov    %ebx,%eax
+  802dca:	e8 41 fa ff ff       	call   802810 <stream_unread>
+	for (done = 0; done < want; ) {
+  802dcf:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802dd4:	84 c0                	test   %al,%al
+  802dd6:	75 7b                	jne    802e53 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802dd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ddd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802de0:	39 fe                	cmp    %edi,%esi
+  802de2:	73 24                	jae    802e08 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	89 f8                	mov    %edi,%eax
+  802de9:	29 f0                	sub    %esi,%eax
+  802deb:	50                   	push   %eax
+  802dec:	89 f0                	mov    %esi,%eax
+  802dee:	03 45 08             	add    0x8(%ebp),%eax
+  802df1:	50                   	push   %eax
+  802df2:	ff 33                	push   (%ebx)
+  802df4:	e8 a0 ef ff ff       	call   801d99 <write>
+  802df9:	83 c4 10             	add    $0x10,%esp
+  802dfc:	85 c0                	test   %eax,%eax
+  802dfe:	7e 04                	jle    802e04 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802e00:	01 c6                	add    %eax,%esi
+  802e02:	eb dc                	jmp    802de0 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802e04:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802e08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	74 a0                	je     802daf <fwrite+0x1e>
+  802e0f:	89 f0                	mov    %esi,%eax
+  802e11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e16:	f7 75 0c             	divl   0xc(%ebp)
+  802e19:	eb 94                	jmp    802daf <fwrite+0x1e>
+			done += r;
+  802e1b:	01 c7                	add    %eax,%edi
+			continue;
+  802e1d:	eb 34                	jmp    802e53 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802e1f:	8b 73 10             	mov    0x10(%ebx),%esi
+  802e22:	29 c6                	sub    %eax,%esi
+  802e24:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e27:	29 fa                	sub    %edi,%edx
+  802e29:	39 d6                	cmp    %edx,%esi
+  802e2b:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802e2e:	83 ec 04             	sub    $0x4,%esp
+  802e31:	56                   	push   %esi
+  802e32:	89 fa                	mov    %edi,%edx
+  802e34:	03 55 08             	add    0x8(%ebp),%edx
+  802e37:	52                   	push   %edx
+  802e38:	03 43 0c             	add    0xc(%ebx),%eax
+  802e3b:	50                   	push   %eax
+  802e3c:	e8 f8 db ff ff       	call   800a39 <memmove>
+		f->f_wend += m;
+  802e41:	89 f0                	mov    %esi,%eax
+  802e43:	03 43 1c             	add    0x1c(%ebx),%eax
+  802e46:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802e49:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e4b:	83 c4 10             	add    $0x10,%esp
+  802e4e:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802e51:	74 5b                	je     802eae <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802e53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e56:	39 c7                	cmp    %eax,%edi
+  802e58:	73 2d                	jae    802e87 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802e5a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e5d:	85 c0                	test   %eax,%eax
+  802e5f:	75 be                	jne    802e1f <fwrite+0x8e>
+  802e61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e64:	29 fa                	sub    %edi,%edx
+  802e66:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802e69:	72 b4                	jb     802e1f <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e6b:	83 ec 04             	sub    $0x4,%esp
+  802e6e:	52                   	push   %edx
+  802e6f:	89 f8                	mov    %edi,%eax
+  802e71:	03 45 08             	add    0x8(%ebp),%eax
+  802e74:	50                   	push   %eax
+  802e75:	ff 33                	push   (%ebx)
+  802e77:	e8 1d ef ff ff       	call   801d99 <write>
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	85 c0                	test   %eax,%eax
+  802e81:	7f 98                	jg     802e1b <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802e83:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802e87:	8b 43 08             	mov    0x8(%ebx),%eax
+  802e8a:	83 f8 03             	cmp    $0x3,%eax
+  802e8d:	74 48                	je     802ed7 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e8f:	83 f8 02             	cmp    $0x2,%eax
+  802e92:	74 27                	je     802ebb <fwrite+0x12a>
+	return size ? done / size : 0;
+  802e94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	0f 84 10 ff ff ff    	je     802daf <fwrite+0x1e>
+  802e9f:	89 f8                	mov    %edi,%eax
+  802ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea6:	f7 75 0c             	divl   0xc(%ebp)
+  802ea9:	e9 01 ff ff ff       	jmp    802daf <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802eae:	89 d8                	mov    %ebx,%eax
+  802eb0:	e8 ce f9 ff ff       	call   802883 <stream_drain>
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	79 9a                	jns    802e53 <fwrite+0xc2>
+  802eb9:	eb cc                	jmp    802e87 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802ebb:	83 ec 04             	sub    $0x4,%esp
+  802ebe:	57                   	push   %edi
+  802ebf:	6a 0a                	push   $0xa
+  802ec1:	ff 75 08             	push   0x8(%ebp)
+  802ec4:	e8 21 dc ff ff       	call   800aea <memfind>
+  802ec9:	89 c2                	mov    %eax,%edx
+  802ecb:	89 f8                	mov    %edi,%eax
+  802ecd:	03 45 08             	add    0x8(%ebp),%eax
+  802ed0:	83 c4 10             	add    $0x10,%esp
+  802ed3:	39 c2                	cmp    %eax,%edx
+  802ed5:	74 bd                	je     802e94 <fwrite+0x103>
+		stream_drain(f);
+  802ed7:	89 d8                	mov    %ebx,%eax
+  802ed9:	e8 a5 f9 ff ff       	call   802883 <stream_drain>
+  802ede:	eb b4                	jmp    802e94 <fwrite+0x103>
+
+00802ee0 <fputc>:
+{
+  802ee0:	55                   	push   %ebp
+  802ee1:	89 e5                	mov    %esp,%ebp
+  802ee3:	53                   	push   %ebx
+  802ee4:	83 ec 14             	sub    $0x14,%esp
+  802ee7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802eea:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802eed:	ff 75 0c             	push   0xc(%ebp)
+  802ef0:	6a 01                	push   $0x1
+  802ef2:	6a 01                	push   $0x1
+  802ef4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 94 fe ff ff       	call   802d91 <fwrite>
+  802efd:	83 c4 10             	add    $0x10,%esp
+  802f00:	0f b6 db             	movzbl %bl,%ebx
+  802f03:	83 f8 01             	cmp    $0x1,%eax
+  802f06:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f0b:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802f0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f11:	c9                   	leave
+  802f12:	c3                   	ret
+
+00802f13 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802f13:	55                   	push   %ebp
+  802f14:	89 e5                	mov    %esp,%ebp
+  802f16:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802f19:	ff 75 0c             	push   0xc(%ebp)
+  802f1c:	ff 75 08             	push   0x8(%ebp)
+  802f1f:	e8 bc ff ff ff       	call   802ee0 <fputc>
+}
+  802f24:	83 c4 10             	add    $0x10,%esp
+  802f27:	c9                   	leave
+  802f28:	c3                   	ret
+
+00802f29 <fputs>:
+{
+  802f29:	55                   	push   %ebp
+  802f2a:	89 e5                	mov    %esp,%ebp
+  802f2c:	56                   	push   %esi
+  802f2d:	53                   	push   %ebx
+  802f2e:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802f31:	83 ec 0c             	sub    $0xc,%esp
+  802f34:	56                   	push   %esi
+  802f35:	e8 3e d9 ff ff       	call   800878 <strlen>
+  802f3a:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802f3c:	ff 75 0c             	push   0xc(%ebp)
+  802f3f:	50                   	push   %eax
+  802f40:	6a 01                	push   $0x1
+  802f42:	56                   	push   %esi
+  802f43:	e8 49 fe ff ff       	call   802d91 <fwrite>
+  802f48:	83 c4 20             	add    $0x20,%esp
+  802f4b:	39 d8                	cmp    %ebx,%eax
+  802f4d:	0f 95 c0             	setne  %al
+  802f50:	0f b6 c0             	movzbl %al,%eax
+  802f53:	f7 d8                	neg    %eax
+}
+  802f55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f58:	5b                   	pop    %ebx
+  802f59:	5e                   	pop    %esi
+  802f5a:	5d                   	pop    %ebp
+  802f5b:	c3                   	ret
+
+00802f5c <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802f5c:	55                   	push   %ebp
+  802f5d:	89 e5                	mov    %esp,%ebp
+  802f5f:	53                   	push   %ebx
+  802f60:	83 ec 04             	sub    $0x4,%esp
+  802f63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f66:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802f69:	50                   	push   %eax
+  802f6a:	ff 75 0c             	push   0xc(%ebp)
+  802f6d:	53                   	push   %ebx
+  802f6e:	68 13 2f 80 00       	push   $0x802f13
+  802f73:	e8 4e d4 ff ff       	call   8003c6 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802f78:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f7b:	c1 e0 1c             	shl    $0x1c,%eax
+  802f7e:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802f81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f84:	c9                   	leave
+  802f85:	c3                   	ret
+
+00802f86 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f86:	55                   	push   %ebp
+  802f87:	89 e5                	mov    %esp,%ebp
+  802f89:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802f8c:	68 dc 4e 80 00       	push   $0x804edc
+  802f91:	ff 75 0c             	push   0xc(%ebp)
+  802f94:	e8 1a d9 ff ff       	call   8008b3 <strcpy>
+	return 0;
+}
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9e:	c9                   	leave
+  802f9f:	c3                   	ret
+
+00802fa0 <devsock_close>:
+{
+  802fa0:	55                   	push   %ebp
+  802fa1:	89 e5                	mov    %esp,%ebp
+  802fa3:	53                   	push   %ebx
+  802fa4:	83 ec 10             	sub    $0x10,%esp
+  802fa7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802faa:	53                   	push   %ebx
+  802fab:	e8 cc 15 00 00       	call   80457c <pageref>
+  802fb0:	89 c2                	mov    %eax,%edx
+  802fb2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802fba:	83 fa 01             	cmp    $0x1,%edx
+  802fbd:	74 05                	je     802fc4 <devsock_close+0x24>
+}
+  802fbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fc2:	c9                   	leave
+  802fc3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802fc4:	83 ec 0c             	sub    $0xc,%esp
+  802fc7:	ff 73 0c             	push   0xc(%ebx)
+  802fca:	e8 b7 02 00 00       	call   803286 <nsipc_close>
+  802fcf:	83 c4 10             	add    $0x10,%esp
+  802fd2:	eb eb                	jmp    802fbf <devsock_close+0x1f>
+
+00802fd4 <devsock_write>:
+{
+  802fd4:	55                   	push   %ebp
+  802fd5:	89 e5                	mov    %esp,%ebp
+  802fd7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802fda:	6a 00                	push   $0x0
+  802fdc:	ff 75 10             	push   0x10(%ebp)
+  802fdf:	ff 75 0c             	push   0xc(%ebp)
+  802fe2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe5:	ff 70 0c             	push   0xc(%eax)
+  802fe8:	e8 79 03 00 00       	call   803366 <nsipc_send>
+}
+  802fed:	c9                   	leave
+  802fee:	c3                   	ret
+
+00802fef <devsock_read>:
+{
+  802fef:	55                   	push   %ebp
+  802ff0:	89 e5                	mov    %esp,%ebp
+  802ff2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ff5:	6a 00                	push   $0x0
+  802ff7:	ff 75 10             	push   0x10(%ebp)
+  802ffa:	ff 75 0c             	push   0xc(%ebp)
+  802ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803000:	ff 70 0c             	push   0xc(%eax)
+  803003:	e8 ef 02 00 00       	call   8032f7 <nsipc_recv>
+}
+  803008:	c9                   	leave
+  803009:	c3                   	ret
+
+0080300a <fd2sockid>:
+{
+  80300a:	55                   	push   %ebp
+  80300b:	89 e5                	mov    %esp,%ebp
+  80300d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803010:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803013:	52                   	push   %edx
+  803014:	50                   	push   %eax
+  803015:	e8 f7 e9 ff ff       	call   801a11 <fd_lookup>
+  80301a:	83 c4 10             	add    $0x10,%esp
+  80301d:	85 c0                	test   %eax,%eax
+  80301f:	78 10                	js     803031 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803021:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803024:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  80302a:	39 08                	cmp    %ecx,(%eax)
+  80302c:	75 05                	jne    803033 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80302e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803031:	c9                   	leave
+  803032:	c3                   	ret
+		return -E_NOT_SUPP;
+  803033:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803038:	eb f7                	jmp    803031 <fd2sockid+0x27>
+
+0080303a <alloc_sockfd>:
+{
+  80303a:	55                   	push   %ebp
+  80303b:	89 e5                	mov    %esp,%ebp
+  80303d:	56                   	push   %esi
+  80303e:	53                   	push   %ebx
+  80303f:	83 ec 1c             	sub    $0x1c,%esp
+  803042:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803044:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803047:	50                   	push   %eax
+  803048:	e8 6e e9 ff ff       	call   8019bb <fd_alloc>
+  80304d:	89 c3                	mov    %eax,%ebx
+  80304f:	83 c4 10             	add    $0x10,%esp
+  803052:	85 c0                	test   %eax,%eax
+  803054:	78 43                	js     803099 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803056:	83 ec 04             	sub    $0x4,%esp
+  803059:	68 07 04 00 00       	push   $0x407
+  80305e:	ff 75 f4             	push   -0xc(%ebp)
+  803061:	6a 00                	push   $0x0
+  803063:	e8 89 dc ff ff       	call   800cf1 <sys_page_alloc>
+  803068:	89 c3                	mov    %eax,%ebx
+  80306a:	83 c4 10             	add    $0x10,%esp
+  80306d:	85 c0                	test   %eax,%eax
+  80306f:	78 28                	js     803099 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803071:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803074:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  80307a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80307c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80307f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803086:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803089:	83 ec 0c             	sub    $0xc,%esp
+  80308c:	50                   	push   %eax
+  80308d:	e8 02 e9 ff ff       	call   801994 <fd2num>
+  803092:	89 c3                	mov    %eax,%ebx
+  803094:	83 c4 10             	add    $0x10,%esp
+  803097:	eb 0c                	jmp    8030a5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803099:	83 ec 0c             	sub    $0xc,%esp
+  80309c:	56                   	push   %esi
+  80309d:	e8 e4 01 00 00       	call   803286 <nsipc_close>
+		return r;
+  8030a2:	83 c4 10             	add    $0x10,%esp
+}
+  8030a5:	89 d8                	mov    %ebx,%eax
+  8030a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030aa:	5b                   	pop    %ebx
+  8030ab:	5e                   	pop    %esi
+  8030ac:	5d                   	pop    %ebp
+  8030ad:	c3                   	ret
+
+008030ae <accept>:
+{
+  8030ae:	55                   	push   %ebp
+  8030af:	89 e5                	mov    %esp,%ebp
+  8030b1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b7:	e8 4e ff ff ff       	call   80300a <fd2sockid>
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	78 1b                	js     8030db <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8030c0:	83 ec 04             	sub    $0x4,%esp
+  8030c3:	ff 75 10             	push   0x10(%ebp)
+  8030c6:	ff 75 0c             	push   0xc(%ebp)
+  8030c9:	50                   	push   %eax
+  8030ca:	e8 0e 01 00 00       	call   8031dd <nsipc_accept>
+  8030cf:	83 c4 10             	add    $0x10,%esp
+  8030d2:	85 c0                	test   %eax,%eax
+  8030d4:	78 05                	js     8030db <accept+0x2d>
+	return alloc_sockfd(r);
+  8030d6:	e8 5f ff ff ff       	call   80303a <alloc_sockfd>
+}
+  8030db:	c9                   	leave
+  8030dc:	c3                   	ret
+
+008030dd <bind>:
+{
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e6:	e8 1f ff ff ff       	call   80300a <fd2sockid>
+  8030eb:	85 c0                	test   %eax,%eax
+  8030ed:	78 12                	js     803101 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8030ef:	83 ec 04             	sub    $0x4,%esp
+  8030f2:	ff 75 10             	push   0x10(%ebp)
+  8030f5:	ff 75 0c             	push   0xc(%ebp)
+  8030f8:	50                   	push   %eax
+  8030f9:	e8 31 01 00 00       	call   80322f <nsipc_bind>
+  8030fe:	83 c4 10             	add    $0x10,%esp
+}
+  803101:	c9                   	leave
+  803102:	c3                   	ret
+
+00803103 <shutdown>:
+{
+  803103:	55                   	push   %ebp
+  803104:	89 e5                	mov    %esp,%ebp
+  803106:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803109:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310c:	e8 f9 fe ff ff       	call   80300a <fd2sockid>
+  803111:	85 c0                	test   %eax,%eax
+  803113:	78 0f                	js     803124 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803115:	83 ec 08             	sub    $0x8,%esp
+  803118:	ff 75 0c             	push   0xc(%ebp)
+  80311b:	50                   	push   %eax
+  80311c:	e8 43 01 00 00       	call   803264 <nsipc_shutdown>
+  803121:	83 c4 10             	add    $0x10,%esp
+}
+  803124:	c9                   	leave
+  803125:	c3                   	ret
+
+00803126 <connect>:
+{
+  803126:	55                   	push   %ebp
+  803127:	89 e5                	mov    %esp,%ebp
+  803129:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80312c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312f:	e8 d6 fe ff ff       	call   80300a <fd2sockid>
+  803134:	85 c0                	test   %eax,%eax
+  803136:	78 12                	js     80314a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803138:	83 ec 04             	sub    $0x4,%esp
+  80313b:	ff 75 10             	push   0x10(%ebp)
+  80313e:	ff 75 0c             	push   0xc(%ebp)
+  803141:	50                   	push   %eax
+  803142:	e8 59 01 00 00       	call   8032a0 <nsipc_connect>
+  803147:	83 c4 10             	add    $0x10,%esp
+}
+  80314a:	c9                   	leave
+  80314b:	c3                   	ret
+
+0080314c <listen>:
+{
+  80314c:	55                   	push   %ebp
+  80314d:	89 e5                	mov    %esp,%ebp
+  80314f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803152:	8b 45 08             	mov    0x8(%ebp),%eax
+  803155:	e8 b0 fe ff ff       	call   80300a <fd2sockid>
+  80315a:	85 c0                	test   %eax,%eax
+  80315c:	78 0f                	js     80316d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80315e:	83 ec 08             	sub    $0x8,%esp
+  803161:	ff 75 0c             	push   0xc(%ebp)
+  803164:	50                   	push   %eax
+  803165:	e8 6b 01 00 00       	call   8032d5 <nsipc_listen>
+  80316a:	83 c4 10             	add    $0x10,%esp
+}
+  80316d:	c9                   	leave
+  80316e:	c3                   	ret
+
+0080316f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80316f:	55                   	push   %ebp
+  803170:	89 e5                	mov    %esp,%ebp
+  803172:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803175:	ff 75 10             	push   0x10(%ebp)
+  803178:	ff 75 0c             	push   0xc(%ebp)
+  80317b:	ff 75 08             	push   0x8(%ebp)
+  80317e:	e8 41 02 00 00       	call   8033c4 <nsipc_socket>
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	85 c0                	test   %eax,%eax
+  803188:	78 05                	js     80318f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80318a:	e8 ab fe ff ff       	call   80303a <alloc_sockfd>
+}
+  80318f:	c9                   	leave
+  803190:	c3                   	ret
+
+00803191 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803191:	55                   	push   %ebp
+  803192:	89 e5                	mov    %esp,%ebp
+  803194:	53                   	push   %ebx
+  803195:	83 ec 04             	sub    $0x4,%esp
+  803198:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80319a:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  8031a1:	74 26                	je     8031c9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031a3:	6a 07                	push   $0x7
+  8031a5:	68 00 90 80 00       	push   $0x809000
+  8031aa:	53                   	push   %ebx
+  8031ab:	ff 35 08 70 80 00    	push   0x807008
+  8031b1:	e8 49 e7 ff ff       	call   8018ff <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8031b6:	83 c4 0c             	add    $0xc,%esp
+  8031b9:	6a 00                	push   $0x0
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	e8 45 e6 ff ff       	call   801809 <ipc_recv>
+}
+  8031c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031c9:	83 ec 0c             	sub    $0xc,%esp
+  8031cc:	6a 02                	push   $0x2
+  8031ce:	e8 82 e7 ff ff       	call   801955 <ipc_find_env>
+  8031d3:	a3 08 70 80 00       	mov    %eax,0x807008
+  8031d8:	83 c4 10             	add    $0x10,%esp
+  8031db:	eb c6                	jmp    8031a3 <nsipc+0x12>
+
+008031dd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8031dd:	55                   	push   %ebp
+  8031de:	89 e5                	mov    %esp,%ebp
+  8031e0:	56                   	push   %esi
+  8031e1:	53                   	push   %ebx
+  8031e2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8031e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8031ed:	8b 06                	mov    (%esi),%eax
+  8031ef:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8031f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031f9:	e8 93 ff ff ff       	call   803191 <nsipc>
+  8031fe:	89 c3                	mov    %eax,%ebx
+  803200:	85 c0                	test   %eax,%eax
+  803202:	79 09                	jns    80320d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803204:	89 d8                	mov    %ebx,%eax
+  803206:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803209:	5b                   	pop    %ebx
+  80320a:	5e                   	pop    %esi
+  80320b:	5d                   	pop    %ebp
+  80320c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80320d:	83 ec 04             	sub    $0x4,%esp
+  803210:	ff 35 10 90 80 00    	push   0x809010
+  803216:	68 00 90 80 00       	push   $0x809000
+  80321b:	ff 75 0c             	push   0xc(%ebp)
+  80321e:	e8 16 d8 ff ff       	call   800a39 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803223:	a1 10 90 80 00       	mov    0x809010,%eax
+  803228:	89 06                	mov    %eax,(%esi)
+  80322a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80322d:	eb d5                	jmp    803204 <nsipc_accept+0x27>
+
+0080322f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80322f:	55                   	push   %ebp
+  803230:	89 e5                	mov    %esp,%ebp
+  803232:	53                   	push   %ebx
+  803233:	83 ec 08             	sub    $0x8,%esp
+  803236:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803239:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323c:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803241:	53                   	push   %ebx
+  803242:	ff 75 0c             	push   0xc(%ebp)
+  803245:	68 04 90 80 00       	push   $0x809004
+  80324a:	e8 ea d7 ff ff       	call   800a39 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80324f:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803255:	b8 02 00 00 00       	mov    $0x2,%eax
+  80325a:	e8 32 ff ff ff       	call   803191 <nsipc>
+}
+  80325f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803262:	c9                   	leave
+  803263:	c3                   	ret
+
+00803264 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803264:	55                   	push   %ebp
+  803265:	89 e5                	mov    %esp,%ebp
+  803267:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80326a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803272:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803275:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80327a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80327f:	e8 0d ff ff ff       	call   803191 <nsipc>
+}
+  803284:	c9                   	leave
+  803285:	c3                   	ret
+
+00803286 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803286:	55                   	push   %ebp
+  803287:	89 e5                	mov    %esp,%ebp
+  803289:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80328c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80328f:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803294:	b8 04 00 00 00       	mov    $0x4,%eax
+  803299:	e8 f3 fe ff ff       	call   803191 <nsipc>
+}
+  80329e:	c9                   	leave
+  80329f:	c3                   	ret
+
+008032a0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032a0:	55                   	push   %ebp
+  8032a1:	89 e5                	mov    %esp,%ebp
+  8032a3:	53                   	push   %ebx
+  8032a4:	83 ec 08             	sub    $0x8,%esp
+  8032a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8032aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ad:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8032b2:	53                   	push   %ebx
+  8032b3:	ff 75 0c             	push   0xc(%ebp)
+  8032b6:	68 04 90 80 00       	push   $0x809004
+  8032bb:	e8 79 d7 ff ff       	call   800a39 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8032c0:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8032c6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8032cb:	e8 c1 fe ff ff       	call   803191 <nsipc>
+}
+  8032d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d3:	c9                   	leave
+  8032d4:	c3                   	ret
+
+008032d5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8032d5:	55                   	push   %ebp
+  8032d6:	89 e5                	mov    %esp,%ebp
+  8032d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8032db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032de:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8032e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032e6:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8032eb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8032f0:	e8 9c fe ff ff       	call   803191 <nsipc>
+}
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+
+008032f7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8032f7:	55                   	push   %ebp
+  8032f8:	89 e5                	mov    %esp,%ebp
+  8032fa:	56                   	push   %esi
+  8032fb:	53                   	push   %ebx
+  8032fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8032ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803302:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803307:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80330d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803310:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803315:	b8 07 00 00 00       	mov    $0x7,%eax
+  80331a:	e8 72 fe ff ff       	call   803191 <nsipc>
+  80331f:	89 c3                	mov    %eax,%ebx
+  803321:	85 c0                	test   %eax,%eax
+  803323:	78 22                	js     803347 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803325:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80332a:	39 c6                	cmp    %eax,%esi
+  80332c:	0f 4e c6             	cmovle %esi,%eax
+  80332f:	39 c3                	cmp    %eax,%ebx
+  803331:	7f 1d                	jg     803350 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803333:	83 ec 04             	sub    $0x4,%esp
+  803336:	53                   	push   %ebx
+  803337:	68 00 90 80 00       	push   $0x809000
+  80333c:	ff 75 0c             	push   0xc(%ebp)
+  80333f:	e8 f5 d6 ff ff       	call   800a39 <memmove>
+  803344:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803347:	89 d8                	mov    %ebx,%eax
+  803349:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80334c:	5b                   	pop    %ebx
+  80334d:	5e                   	pop    %esi
+  80334e:	5d                   	pop    %ebp
+  80334f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803350:	68 e8 4e 80 00       	push   $0x804ee8
+  803355:	68 91 4d 80 00       	push   $0x804d91
+  80335a:	6a 62                	push   $0x62
+  80335c:	68 fd 4e 80 00       	push   $0x804efd
+  803361:	e8 6c 11 00 00       	call   8044d2 <_panic>
+
+00803366 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803366:	55                   	push   %ebp
+  803367:	89 e5                	mov    %esp,%ebp
+  803369:	53                   	push   %ebx
+  80336a:	83 ec 04             	sub    $0x4,%esp
+  80336d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803370:	8b 45 08             	mov    0x8(%ebp),%eax
+  803373:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803378:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80337e:	7f 2e                	jg     8033ae <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803380:	83 ec 04             	sub    $0x4,%esp
+  803383:	53                   	push   %ebx
+  803384:	ff 75 0c             	push   0xc(%ebp)
+  803387:	68 0c 90 80 00       	push   $0x80900c
+  80338c:	e8 a8 d6 ff ff       	call   800a39 <memmove>
+	nsipcbuf.send.req_size = size;
+  803391:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803397:	8b 45 14             	mov    0x14(%ebp),%eax
+  80339a:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80339f:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033a4:	e8 e8 fd ff ff       	call   803191 <nsipc>
+}
+  8033a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ac:	c9                   	leave
+  8033ad:	c3                   	ret
+	assert(size < 1600);
+  8033ae:	68 09 4f 80 00       	push   $0x804f09
+  8033b3:	68 91 4d 80 00       	push   $0x804d91
+  8033b8:	6a 6d                	push   $0x6d
+  8033ba:	68 fd 4e 80 00       	push   $0x804efd
+  8033bf:	e8 0e 11 00 00       	call   8044d2 <_panic>
+
+008033c4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8033c4:	55                   	push   %ebp
+  8033c5:	89 e5                	mov    %esp,%ebp
+  8033c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8033ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033cd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8033d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033d5:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8033da:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033dd:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8033e2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8033e7:	e8 a5 fd ff ff       	call   803191 <nsipc>
+}
+  8033ec:	c9                   	leave
+  8033ed:	c3                   	ret
+
+008033ee <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8033ee:	55                   	push   %ebp
+  8033ef:	89 e5                	mov    %esp,%ebp
+  8033f1:	53                   	push   %ebx
+  8033f2:	83 ec 10             	sub    $0x10,%esp
+  8033f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8033f8:	68 0c 70 80 00       	push   $0x80700c
+  8033fd:	e8 50 07 00 00       	call   803b52 <mutex_lock>
+	if (v == 0)
+  803402:	83 c4 10             	add    $0x10,%esp
+  803405:	85 db                	test   %ebx,%ebx
+  803407:	0f 84 85 00 00 00    	je     803492 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80340d:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803413:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803418:	77 51                	ja     80346b <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80341a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803420:	89 d8                	mov    %ebx,%eax
+  803422:	c1 e8 0c             	shr    $0xc,%eax
+  803425:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80342c:	f6 c4 02             	test   $0x2,%ah
+  80342f:	74 50                	je     803481 <free+0x93>
+		sys_page_unmap(0, c);
+  803431:	83 ec 08             	sub    $0x8,%esp
+  803434:	53                   	push   %ebx
+  803435:	6a 00                	push   $0x0
+  803437:	e8 4e d9 ff ff       	call   800d8a <sys_page_unmap>
+		c += PGSIZE;
+  80343c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803442:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803450:	76 ce                	jbe    803420 <free+0x32>
+  803452:	68 53 4f 80 00       	push   $0x804f53
+  803457:	68 91 4d 80 00       	push   $0x804d91
+  80345c:	68 82 00 00 00       	push   $0x82
+  803461:	68 46 4f 80 00       	push   $0x804f46
+  803466:	e8 67 10 00 00       	call   8044d2 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80346b:	68 18 4f 80 00       	push   $0x804f18
+  803470:	68 91 4d 80 00       	push   $0x804d91
+  803475:	6a 7b                	push   $0x7b
+  803477:	68 46 4f 80 00       	push   $0x804f46
+  80347c:	e8 51 10 00 00       	call   8044d2 <_panic>
+	if (--(*ref) == 0)
+  803481:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803487:	83 e8 01             	sub    $0x1,%eax
+  80348a:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803490:	74 15                	je     8034a7 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803492:	83 ec 0c             	sub    $0xc,%esp
+  803495:	68 0c 70 80 00       	push   $0x80700c
+  80349a:	e8 20 07 00 00       	call   803bbf <mutex_unlock>
+}
+  80349f:	83 c4 10             	add    $0x10,%esp
+  8034a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034a5:	c9                   	leave
+  8034a6:	c3                   	ret
+		sys_page_unmap(0, c);
+  8034a7:	83 ec 08             	sub    $0x8,%esp
+  8034aa:	53                   	push   %ebx
+  8034ab:	6a 00                	push   $0x0
+  8034ad:	e8 d8 d8 ff ff       	call   800d8a <sys_page_unmap>
+  8034b2:	83 c4 10             	add    $0x10,%esp
+  8034b5:	eb db                	jmp    803492 <free+0xa4>
+
+008034b7 <malloc>:
+{
+  8034b7:	55                   	push   %ebp
+  8034b8:	89 e5                	mov    %esp,%ebp
+  8034ba:	57                   	push   %edi
+  8034bb:	56                   	push   %esi
+  8034bc:	53                   	push   %ebx
+  8034bd:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8034c0:	68 0c 70 80 00       	push   $0x80700c
+  8034c5:	e8 88 06 00 00       	call   803b52 <mutex_lock>
+	if (mptr == 0)
+  8034ca:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	85 ff                	test   %edi,%edi
+  8034d5:	74 6c                	je     803543 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8034d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034da:	83 c0 03             	add    $0x3,%eax
+  8034dd:	83 e0 fc             	and    $0xfffffffc,%eax
+  8034e0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8034e2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8034e7:	0f 87 64 01 00 00    	ja     803651 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8034ed:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034f3:	74 30                	je     803525 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8034f5:	89 f9                	mov    %edi,%ecx
+  8034f7:	c1 e9 0c             	shr    $0xc,%ecx
+  8034fa:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8034fe:	c1 e8 0c             	shr    $0xc,%eax
+  803501:	39 c1                	cmp    %eax,%ecx
+  803503:	74 5f                	je     803564 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803505:	83 ec 0c             	sub    $0xc,%esp
+  803508:	57                   	push   %edi
+  803509:	e8 e0 fe ff ff       	call   8033ee <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80350e:	a1 10 70 80 00       	mov    0x807010,%eax
+  803513:	05 00 10 00 00       	add    $0x1000,%eax
+  803518:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80351d:	a3 10 70 80 00       	mov    %eax,0x807010
+  803522:	83 c4 10             	add    $0x10,%esp
+  803525:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  80352b:	ba 02 00 00 00       	mov    $0x2,%edx
+  803530:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803534:	8d 7e 04             	lea    0x4(%esi),%edi
+  803537:	89 cb                	mov    %ecx,%ebx
+  803539:	01 f9                	add    %edi,%ecx
+  80353b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80353e:	e9 8b 00 00 00       	jmp    8035ce <malloc+0x117>
+		mptr = mbegin;
+  803543:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  80354a:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80354d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803550:	83 c0 03             	add    $0x3,%eax
+  803553:	83 e0 fc             	and    $0xfffffffc,%eax
+  803556:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803558:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80355d:	76 c6                	jbe    803525 <malloc+0x6e>
+  80355f:	e9 d6 00 00 00       	jmp    80363a <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803564:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80356a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80356f:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803573:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803576:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  80357b:	e9 ba 00 00 00       	jmp    80363a <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803580:	05 00 10 00 00       	add    $0x1000,%eax
+  803585:	39 c8                	cmp    %ecx,%eax
+  803587:	0f 83 cb 00 00 00    	jae    803658 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80358d:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803592:	77 22                	ja     8035b6 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803594:	89 c2                	mov    %eax,%edx
+  803596:	c1 ea 16             	shr    $0x16,%edx
+  803599:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8035a0:	f6 c2 01             	test   $0x1,%dl
+  8035a3:	74 db                	je     803580 <malloc+0xc9>
+  8035a5:	89 c2                	mov    %eax,%edx
+  8035a7:	c1 ea 0c             	shr    $0xc,%edx
+  8035aa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8035b1:	f6 c2 01             	test   $0x1,%dl
+  8035b4:	74 ca                	je     803580 <malloc+0xc9>
+		if (mptr == mend) {
+  8035b6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035bc:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8035c2:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8035c6:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8035cc:	74 04                	je     8035d2 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8035ce:	89 d8                	mov    %ebx,%eax
+  8035d0:	eb b3                	jmp    803585 <malloc+0xce>
+  8035d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8035d5:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8035da:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8035de:	83 ea 01             	sub    $0x1,%edx
+  8035e1:	0f 85 50 ff ff ff    	jne    803537 <malloc+0x80>
+  8035e7:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8035ee:	00 00 08 
+				return 0;	/* out of address space */
+  8035f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f6:	eb 42                	jmp    80363a <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8035f8:	85 db                	test   %ebx,%ebx
+  8035fa:	78 1e                	js     80361a <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8035fc:	83 ec 08             	sub    $0x8,%esp
+  8035ff:	89 d8                	mov    %ebx,%eax
+  803601:	03 05 10 70 80 00    	add    0x807010,%eax
+  803607:	50                   	push   %eax
+  803608:	6a 00                	push   $0x0
+  80360a:	e8 7b d7 ff ff       	call   800d8a <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80360f:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	eb de                	jmp    8035f8 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80361a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361f:	eb 19                	jmp    80363a <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803621:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803624:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80362a:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803631:	00 
+	mptr += n;
+  803632:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803635:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  80363a:	83 ec 0c             	sub    $0xc,%esp
+  80363d:	68 0c 70 80 00       	push   $0x80700c
+  803642:	e8 78 05 00 00       	call   803bbf <mutex_unlock>
+}
+  803647:	89 f8                	mov    %edi,%eax
+  803649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80364c:	5b                   	pop    %ebx
+  80364d:	5e                   	pop    %esi
+  80364e:	5f                   	pop    %edi
+  80364f:	5d                   	pop    %ebp
+  803650:	c3                   	ret
+		return 0;
+  803651:	bf 00 00 00 00       	mov    $0x0,%edi
+  803656:	eb e2                	jmp    80363a <malloc+0x183>
+  803658:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80365c:	74 06                	je     803664 <malloc+0x1ad>
+  80365e:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803669:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80366c:	39 fb                	cmp    %edi,%ebx
+  80366e:	73 b1                	jae    803621 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803670:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803676:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803679:	39 fe                	cmp    %edi,%esi
+  80367b:	0f 92 c0             	setb   %al
+  80367e:	0f b6 c0             	movzbl %al,%eax
+  803681:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803684:	83 c8 07             	or     $0x7,%eax
+  803687:	50                   	push   %eax
+  803688:	89 d8                	mov    %ebx,%eax
+  80368a:	03 05 10 70 80 00    	add    0x807010,%eax
+  803690:	50                   	push   %eax
+  803691:	6a 00                	push   $0x0
+  803693:	e8 59 d6 ff ff       	call   800cf1 <sys_page_alloc>
+  803698:	83 c4 10             	add    $0x10,%esp
+  80369b:	85 c0                	test   %eax,%eax
+  80369d:	0f 88 55 ff ff ff    	js     8035f8 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8036a3:	89 f3                	mov    %esi,%ebx
+  8036a5:	eb c5                	jmp    80366c <malloc+0x1b5>
+
+008036a7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8036a7:	55                   	push   %ebp
+  8036a8:	89 e5                	mov    %esp,%ebp
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8036af:	83 ec 0c             	sub    $0xc,%esp
+  8036b2:	ff 75 08             	push   0x8(%ebp)
+  8036b5:	e8 ea e2 ff ff       	call   8019a4 <fd2data>
+  8036ba:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8036bc:	83 c4 08             	add    $0x8,%esp
+  8036bf:	68 6b 4f 80 00       	push   $0x804f6b
+  8036c4:	53                   	push   %ebx
+  8036c5:	e8 e9 d1 ff ff       	call   8008b3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8036ca:	8b 46 04             	mov    0x4(%esi),%eax
+  8036cd:	2b 06                	sub    (%esi),%eax
+  8036cf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8036d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8036dc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8036df:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8036e6:	62 80 00 
+	return 0;
+}
+  8036e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f1:	5b                   	pop    %ebx
+  8036f2:	5e                   	pop    %esi
+  8036f3:	5d                   	pop    %ebp
+  8036f4:	c3                   	ret
+
+008036f5 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8036f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036fa:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8036fe:	85 c9                	test   %ecx,%ecx
+  803700:	75 01                	jne    803703 <pipewake+0xe>
+  803702:	c3                   	ret
+{
+  803703:	55                   	push   %ebp
+  803704:	89 e5                	mov    %esp,%ebp
+  803706:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803709:	68 00 04 00 00       	push   $0x400
+  80370e:	52                   	push   %edx
+  80370f:	e8 21 d9 ff ff       	call   801035 <sys_futex_wake>
+  803714:	83 c4 10             	add    $0x10,%esp
+}
+  803717:	c9                   	leave
+  803718:	c3                   	ret
+
+00803719 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803719:	55                   	push   %ebp
+  80371a:	89 e5                	mov    %esp,%ebp
+  80371c:	56                   	push   %esi
+  80371d:	53                   	push   %ebx
+  80371e:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803721:	83 ec 0c             	sub    $0xc,%esp
+  803724:	56                   	push   %esi
+  803725:	e8 7a e2 ff ff       	call   8019a4 <fd2data>
+  80372a:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80372c:	83 c4 08             	add    $0x8,%esp
+  80372f:	56                   	push   %esi
+  803730:	6a 00                	push   $0x0
+  803732:	e8 53 d6 ff ff       	call   800d8a <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803737:	8d 53 04             	lea    0x4(%ebx),%edx
+  80373a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80373d:	e8 b3 ff ff ff       	call   8036f5 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803742:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803745:	89 da                	mov    %ebx,%edx
+  803747:	e8 a9 ff ff ff       	call   8036f5 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80374c:	89 34 24             	mov    %esi,(%esp)
+  80374f:	e8 50 e2 ff ff       	call   8019a4 <fd2data>
+  803754:	83 c4 08             	add    $0x8,%esp
+  803757:	50                   	push   %eax
+  803758:	6a 00                	push   $0x0
+  80375a:	e8 2b d6 ff ff       	call   800d8a <sys_page_unmap>
+}
+  80375f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803762:	5b                   	pop    %ebx
+  803763:	5e                   	pop    %esi
+  803764:	5d                   	pop    %ebp
+  803765:	c3                   	ret
+
+00803766 <_pipeisclosed>:
+{
+  803766:	55                   	push   %ebp
+  803767:	89 e5                	mov    %esp,%ebp
+  803769:	57                   	push   %edi
+  80376a:	56                   	push   %esi
+  80376b:	53                   	push   %ebx
+  80376c:	83 ec 1c             	sub    $0x1c,%esp
+  80376f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803772:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803774:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803779:	eb 5d                	jmp    8037d8 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80377b:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		n = thisenv->env_runs;
+  803781:	8b 02                	mov    (%edx),%eax
+  803783:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803786:	83 ec 0c             	sub    $0xc,%esp
+  803789:	ff 75 e0             	push   -0x20(%ebp)
+  80378c:	e8 eb 0d 00 00       	call   80457c <pageref>
+  803791:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803794:	89 3c 24             	mov    %edi,(%esp)
+  803797:	e8 e0 0d 00 00       	call   80457c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80379c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80379e:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8037a4:	83 c4 10             	add    $0x10,%esp
+  8037a7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8037ad:	77 15                	ja     8037c4 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037af:	89 f2                	mov    %esi,%edx
+  8037b1:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8037b3:	c1 ea 10             	shr    $0x10,%edx
+  8037b6:	74 0c                	je     8037c4 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037b8:	c1 e2 10             	shl    $0x10,%edx
+  8037bb:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8037c0:	29 d1                	sub    %edx,%ecx
+  8037c2:	eb 06                	jmp    8037ca <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8037c4:	8b 0d c4 72 80 00    	mov    0x8072c4,%ecx
+		nn = thisenv->env_runs;
+  8037ca:	8b 11                	mov    (%ecx),%edx
+  8037cc:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8037cf:	39 d3                	cmp    %edx,%ebx
+  8037d1:	74 6e                	je     803841 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8037d3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037d6:	74 24                	je     8037fc <_pipeisclosed+0x96>
+  8037d8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037da:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037e0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037e5:	77 94                	ja     80377b <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037e7:	89 f0                	mov    %esi,%eax
+  8037e9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8037eb:	c1 e8 10             	shr    $0x10,%eax
+  8037ee:	74 8b                	je     80377b <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037f0:	c1 e0 10             	shl    $0x10,%eax
+  8037f3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037f8:	29 c2                	sub    %eax,%edx
+  8037fa:	eb 85                	jmp    803781 <_pipeisclosed+0x1b>
+  8037fc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037fe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803804:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803809:	77 18                	ja     803823 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80380b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803810:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803812:	c1 e8 10             	shr    $0x10,%eax
+  803815:	74 0c                	je     803823 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803817:	c1 e0 10             	shl    $0x10,%eax
+  80381a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80381f:	29 c2                	sub    %eax,%edx
+  803821:	eb 06                	jmp    803829 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803823:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803829:	8b 02                	mov    (%edx),%eax
+  80382b:	8b 40 58             	mov    0x58(%eax),%eax
+  80382e:	6a 01                	push   $0x1
+  803830:	50                   	push   %eax
+  803831:	53                   	push   %ebx
+  803832:	68 72 4f 80 00       	push   $0x804f72
+  803837:	e8 93 ca ff ff       	call   8002cf <cprintf>
+  80383c:	83 c4 10             	add    $0x10,%esp
+  80383f:	eb 97                	jmp    8037d8 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803841:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803844:	0f 94 c0             	sete   %al
+  803847:	0f b6 c0             	movzbl %al,%eax
+}
+  80384a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80384d:	5b                   	pop    %ebx
+  80384e:	5e                   	pop    %esi
+  80384f:	5f                   	pop    %edi
+  803850:	5d                   	pop    %ebp
+  803851:	c3                   	ret
+
+00803852 <devpipe_write>:
+{
+  803852:	55                   	push   %ebp
+  803853:	89 e5                	mov    %esp,%ebp
+  803855:	57                   	push   %edi
+  803856:	56                   	push   %esi
+  803857:	53                   	push   %ebx
+  803858:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80385b:	ff 75 08             	push   0x8(%ebp)
+  80385e:	e8 41 e1 ff ff       	call   8019a4 <fd2data>
+  803863:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803865:	83 c4 10             	add    $0x10,%esp
+  803868:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80386f:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803872:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803875:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803878:	0f 84 96 00 00 00    	je     803914 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80387e:	8d 73 08             	lea    0x8(%ebx),%esi
+  803881:	eb 32                	jmp    8038b5 <devpipe_write+0x63>
+  803883:	89 fa                	mov    %edi,%edx
+  803885:	89 f0                	mov    %esi,%eax
+  803887:	e8 69 fe ff ff       	call   8036f5 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80388c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80388f:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803892:	ba 01 00 00 00       	mov    $0x1,%edx
+  803897:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80389c:	83 ec 04             	sub    $0x4,%esp
+  80389f:	6a 0a                	push   $0xa
+  8038a1:	50                   	push   %eax
+  8038a2:	53                   	push   %ebx
+  8038a3:	e8 5e d7 ff ff       	call   801006 <sys_futex_wait>
+  8038a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8038ad:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8038b2:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8038b5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038b8:	8b 0b                	mov    (%ebx),%ecx
+  8038ba:	8d 51 20             	lea    0x20(%ecx),%edx
+  8038bd:	39 d0                	cmp    %edx,%eax
+  8038bf:	72 1b                	jb     8038dc <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8038c1:	89 da                	mov    %ebx,%edx
+  8038c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038c6:	e8 9b fe ff ff       	call   803766 <_pipeisclosed>
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	74 b4                	je     803883 <devpipe_write+0x31>
+				return 0;
+  8038cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038d7:	5b                   	pop    %ebx
+  8038d8:	5e                   	pop    %esi
+  8038d9:	5f                   	pop    %edi
+  8038da:	5d                   	pop    %ebp
+  8038db:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8038dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038df:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8038e2:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8038e6:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8038e9:	89 c2                	mov    %eax,%edx
+  8038eb:	c1 fa 1f             	sar    $0x1f,%edx
+  8038ee:	89 d1                	mov    %edx,%ecx
+  8038f0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038f3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8038f6:	83 e2 1f             	and    $0x1f,%edx
+  8038f9:	29 ca                	sub    %ecx,%edx
+  8038fb:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8038ff:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803903:	83 c0 01             	add    $0x1,%eax
+  803906:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803909:	83 c6 01             	add    $0x1,%esi
+  80390c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80390f:	e9 5e ff ff ff       	jmp    803872 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803914:	8d 53 04             	lea    0x4(%ebx),%edx
+  803917:	8d 43 08             	lea    0x8(%ebx),%eax
+  80391a:	e8 d6 fd ff ff       	call   8036f5 <pipewake>
+	return i;
+  80391f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803922:	eb b0                	jmp    8038d4 <devpipe_write+0x82>
+
+00803924 <devpipe_read>:
+{
+  803924:	55                   	push   %ebp
+  803925:	89 e5                	mov    %esp,%ebp
+  803927:	57                   	push   %edi
+  803928:	56                   	push   %esi
+  803929:	53                   	push   %ebx
+  80392a:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80392d:	ff 75 08             	push   0x8(%ebp)
+  803930:	e8 6f e0 ff ff       	call   8019a4 <fd2data>
+  803935:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803937:	83 c4 10             	add    $0x10,%esp
+  80393a:	be 00 00 00 00       	mov    $0x0,%esi
+  80393f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803942:	74 6c                	je     8039b0 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803944:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803947:	eb 25                	jmp    80396e <devpipe_read+0x4a>
+  803949:	8b 13                	mov    (%ebx),%edx
+  80394b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803950:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803955:	83 ec 04             	sub    $0x4,%esp
+  803958:	6a 0a                	push   $0xa
+  80395a:	52                   	push   %edx
+  80395b:	57                   	push   %edi
+  80395c:	e8 a5 d6 ff ff       	call   801006 <sys_futex_wait>
+  803961:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803966:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80396b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80396e:	8b 03                	mov    (%ebx),%eax
+  803970:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803973:	75 19                	jne    80398e <devpipe_read+0x6a>
+			if (i > 0)
+  803975:	85 f6                	test   %esi,%esi
+  803977:	75 3a                	jne    8039b3 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803979:	89 da                	mov    %ebx,%edx
+  80397b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80397e:	e8 e3 fd ff ff       	call   803766 <_pipeisclosed>
+  803983:	85 c0                	test   %eax,%eax
+  803985:	74 c2                	je     803949 <devpipe_read+0x25>
+				return 0;
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398c:	eb 31                	jmp    8039bf <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80398e:	89 c1                	mov    %eax,%ecx
+  803990:	c1 f9 1f             	sar    $0x1f,%ecx
+  803993:	c1 e9 1b             	shr    $0x1b,%ecx
+  803996:	01 c8                	add    %ecx,%eax
+  803998:	83 e0 1f             	and    $0x1f,%eax
+  80399b:	29 c8                	sub    %ecx,%eax
+  80399d:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8039a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8039a5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8039a8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8039ab:	83 c6 01             	add    $0x1,%esi
+  8039ae:	eb 8f                	jmp    80393f <devpipe_read+0x1b>
+out:
+  8039b0:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8039b3:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8039b6:	89 da                	mov    %ebx,%edx
+  8039b8:	e8 38 fd ff ff       	call   8036f5 <pipewake>
+	return i;
+  8039bd:	89 f0                	mov    %esi,%eax
+}
+  8039bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c2:	5b                   	pop    %ebx
+  8039c3:	5e                   	pop    %esi
+  8039c4:	5f                   	pop    %edi
+  8039c5:	5d                   	pop    %ebp
+  8039c6:	c3                   	ret
+
+008039c7 <pipe>:
+{
+  8039c7:	55                   	push   %ebp
+  8039c8:	89 e5                	mov    %esp,%ebp
+  8039ca:	56                   	push   %esi
+  8039cb:	53                   	push   %ebx
+  8039cc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8039cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039d2:	50                   	push   %eax
+  8039d3:	e8 e3 df ff ff       	call   8019bb <fd_alloc>
+  8039d8:	89 c3                	mov    %eax,%ebx
+  8039da:	83 c4 10             	add    $0x10,%esp
+  8039dd:	85 c0                	test   %eax,%eax
+  8039df:	0f 88 23 01 00 00    	js     803b08 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039e5:	83 ec 04             	sub    $0x4,%esp
+  8039e8:	68 07 04 00 00       	push   $0x407
+  8039ed:	ff 75 f4             	push   -0xc(%ebp)
+  8039f0:	6a 00                	push   $0x0
+  8039f2:	e8 fa d2 ff ff       	call   800cf1 <sys_page_alloc>
+  8039f7:	89 c3                	mov    %eax,%ebx
+  8039f9:	83 c4 10             	add    $0x10,%esp
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	0f 88 04 01 00 00    	js     803b08 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a04:	83 ec 0c             	sub    $0xc,%esp
+  803a07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a0a:	50                   	push   %eax
+  803a0b:	e8 ab df ff ff       	call   8019bb <fd_alloc>
+  803a10:	89 c3                	mov    %eax,%ebx
+  803a12:	83 c4 10             	add    $0x10,%esp
+  803a15:	85 c0                	test   %eax,%eax
+  803a17:	0f 88 db 00 00 00    	js     803af8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a1d:	83 ec 04             	sub    $0x4,%esp
+  803a20:	68 07 04 00 00       	push   $0x407
+  803a25:	ff 75 f0             	push   -0x10(%ebp)
+  803a28:	6a 00                	push   $0x0
+  803a2a:	e8 c2 d2 ff ff       	call   800cf1 <sys_page_alloc>
+  803a2f:	89 c3                	mov    %eax,%ebx
+  803a31:	83 c4 10             	add    $0x10,%esp
+  803a34:	85 c0                	test   %eax,%eax
+  803a36:	0f 88 bc 00 00 00    	js     803af8 <pipe+0x131>
+	va = fd2data(fd0);
+  803a3c:	83 ec 0c             	sub    $0xc,%esp
+  803a3f:	ff 75 f4             	push   -0xc(%ebp)
+  803a42:	e8 5d df ff ff       	call   8019a4 <fd2data>
+  803a47:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a49:	83 c4 0c             	add    $0xc,%esp
+  803a4c:	68 07 04 00 00       	push   $0x407
+  803a51:	50                   	push   %eax
+  803a52:	6a 00                	push   $0x0
+  803a54:	e8 98 d2 ff ff       	call   800cf1 <sys_page_alloc>
+  803a59:	89 c3                	mov    %eax,%ebx
+  803a5b:	83 c4 10             	add    $0x10,%esp
+  803a5e:	85 c0                	test   %eax,%eax
+  803a60:	0f 88 82 00 00 00    	js     803ae8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a66:	83 ec 0c             	sub    $0xc,%esp
+  803a69:	ff 75 f0             	push   -0x10(%ebp)
+  803a6c:	e8 33 df ff ff       	call   8019a4 <fd2data>
+  803a71:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803a78:	50                   	push   %eax
+  803a79:	6a 00                	push   $0x0
+  803a7b:	56                   	push   %esi
+  803a7c:	6a 00                	push   $0x0
+  803a7e:	e8 bb d2 ff ff       	call   800d3e <sys_page_map>
+  803a83:	89 c3                	mov    %eax,%ebx
+  803a85:	83 c4 20             	add    $0x20,%esp
+  803a88:	85 c0                	test   %eax,%eax
+  803a8a:	78 4e                	js     803ada <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a8c:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803a91:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a94:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a99:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803aa0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803aa3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803aa5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803aa8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803aaf:	83 ec 0c             	sub    $0xc,%esp
+  803ab2:	ff 75 f4             	push   -0xc(%ebp)
+  803ab5:	e8 da de ff ff       	call   801994 <fd2num>
+  803aba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803abd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803abf:	83 c4 04             	add    $0x4,%esp
+  803ac2:	ff 75 f0             	push   -0x10(%ebp)
+  803ac5:	e8 ca de ff ff       	call   801994 <fd2num>
+  803aca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803acd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803ad0:	83 c4 10             	add    $0x10,%esp
+  803ad3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ad8:	eb 2e                	jmp    803b08 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803ada:	83 ec 08             	sub    $0x8,%esp
+  803add:	56                   	push   %esi
+  803ade:	6a 00                	push   $0x0
+  803ae0:	e8 a5 d2 ff ff       	call   800d8a <sys_page_unmap>
+  803ae5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803ae8:	83 ec 08             	sub    $0x8,%esp
+  803aeb:	ff 75 f0             	push   -0x10(%ebp)
+  803aee:	6a 00                	push   $0x0
+  803af0:	e8 95 d2 ff ff       	call   800d8a <sys_page_unmap>
+  803af5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803af8:	83 ec 08             	sub    $0x8,%esp
+  803afb:	ff 75 f4             	push   -0xc(%ebp)
+  803afe:	6a 00                	push   $0x0
+  803b00:	e8 85 d2 ff ff       	call   800d8a <sys_page_unmap>
+  803b05:	83 c4 10             	add    $0x10,%esp
+}
+  803b08:	89 d8                	mov    %ebx,%eax
+  803b0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b0d:	5b                   	pop    %ebx
+  803b0e:	5e                   	pop    %esi
+  803b0f:	5d                   	pop    %ebp
+  803b10:	c3                   	ret
+
+00803b11 <pipeisclosed>:
+{
+  803b11:	55                   	push   %ebp
+  803b12:	89 e5                	mov    %esp,%ebp
+  803b14:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b1a:	50                   	push   %eax
+  803b1b:	ff 75 08             	push   0x8(%ebp)
+  803b1e:	e8 ee de ff ff       	call   801a11 <fd_lookup>
+  803b23:	83 c4 10             	add    $0x10,%esp
+  803b26:	85 c0                	test   %eax,%eax
+  803b28:	78 18                	js     803b42 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b2a:	83 ec 0c             	sub    $0xc,%esp
+  803b2d:	ff 75 f4             	push   -0xc(%ebp)
+  803b30:	e8 6f de ff ff       	call   8019a4 <fd2data>
+  803b35:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b3a:	e8 27 fc ff ff       	call   803766 <_pipeisclosed>
+  803b3f:	83 c4 10             	add    $0x10,%esp
+}
+  803b42:	c9                   	leave
+  803b43:	c3                   	ret
+
+00803b44 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803b44:	55                   	push   %ebp
+  803b45:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b4a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b50:	5d                   	pop    %ebp
+  803b51:	c3                   	ret
+
+00803b52 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803b52:	55                   	push   %ebp
+  803b53:	89 e5                	mov    %esp,%ebp
+  803b55:	56                   	push   %esi
+  803b56:	53                   	push   %ebx
+  803b57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b5f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b64:	89 d0                	mov    %edx,%eax
+  803b66:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803b6a:	85 c0                	test   %eax,%eax
+  803b6c:	74 2d                	je     803b9b <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803b6e:	83 f8 02             	cmp    $0x2,%eax
+  803b71:	74 08                	je     803b7b <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803b73:	b8 02 00 00 00       	mov    $0x2,%eax
+  803b78:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b7b:	be 02 00 00 00       	mov    $0x2,%esi
+  803b80:	eb 15                	jmp    803b97 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b82:	83 ec 04             	sub    $0x4,%esp
+  803b85:	6a 00                	push   $0x0
+  803b87:	6a 02                	push   $0x2
+  803b89:	53                   	push   %ebx
+  803b8a:	e8 77 d4 ff ff       	call   801006 <sys_futex_wait>
+  803b8f:	89 f0                	mov    %esi,%eax
+  803b91:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b94:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803b97:	85 c0                	test   %eax,%eax
+  803b99:	75 e7                	jne    803b82 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803b9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b9e:	5b                   	pop    %ebx
+  803b9f:	5e                   	pop    %esi
+  803ba0:	5d                   	pop    %ebp
+  803ba1:	c3                   	ret
+
+00803ba2 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803ba2:	55                   	push   %ebp
+  803ba3:	89 e5                	mov    %esp,%ebp
+  803ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803bb2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803bb6:	f7 d8                	neg    %eax
+  803bb8:	19 c0                	sbb    %eax,%eax
+  803bba:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803bbd:	5d                   	pop    %ebp
+  803bbe:	c3                   	ret
+
+00803bbf <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803bbf:	55                   	push   %ebp
+  803bc0:	89 e5                	mov    %esp,%ebp
+  803bc2:	83 ec 08             	sub    $0x8,%esp
+  803bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bcd:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803bd0:	83 f8 02             	cmp    $0x2,%eax
+  803bd3:	74 02                	je     803bd7 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803bd7:	83 ec 08             	sub    $0x8,%esp
+  803bda:	6a 01                	push   $0x1
+  803bdc:	52                   	push   %edx
+  803bdd:	e8 53 d4 ff ff       	call   801035 <sys_futex_wake>
+  803be2:	83 c4 10             	add    $0x10,%esp
+}
+  803be5:	eb ee                	jmp    803bd5 <mutex_unlock+0x16>
+
+00803be7 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803be7:	55                   	push   %ebp
+  803be8:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803bea:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bed:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bf3:	5d                   	pop    %ebp
+  803bf4:	c3                   	ret
+
+00803bf5 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803bf5:	55                   	push   %ebp
+  803bf6:	89 e5                	mov    %esp,%ebp
+  803bf8:	57                   	push   %edi
+  803bf9:	56                   	push   %esi
+  803bfa:	53                   	push   %ebx
+  803bfb:	83 ec 18             	sub    $0x18,%esp
+  803bfe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803c01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803c04:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803c06:	53                   	push   %ebx
+  803c07:	e8 b3 ff ff ff       	call   803bbf <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803c0c:	83 c4 0c             	add    $0xc,%esp
+  803c0f:	ff 75 10             	push   0x10(%ebp)
+  803c12:	57                   	push   %edi
+  803c13:	56                   	push   %esi
+  803c14:	e8 ed d3 ff ff       	call   801006 <sys_futex_wait>
+  803c19:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803c1b:	83 c4 10             	add    $0x10,%esp
+  803c1e:	be 02 00 00 00       	mov    $0x2,%esi
+  803c23:	eb 10                	jmp    803c35 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c25:	83 ec 04             	sub    $0x4,%esp
+  803c28:	6a 00                	push   $0x0
+  803c2a:	6a 02                	push   $0x2
+  803c2c:	53                   	push   %ebx
+  803c2d:	e8 d4 d3 ff ff       	call   801006 <sys_futex_wait>
+  803c32:	83 c4 10             	add    $0x10,%esp
+  803c35:	89 f0                	mov    %esi,%eax
+  803c37:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803c3a:	85 c0                	test   %eax,%eax
+  803c3c:	75 e7                	jne    803c25 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803c3e:	83 ff ec             	cmp    $0xffffffec,%edi
+  803c41:	74 05                	je     803c48 <cond_timedwait+0x53>
+  803c43:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c48:	89 f8                	mov    %edi,%eax
+  803c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c4d:	5b                   	pop    %ebx
+  803c4e:	5e                   	pop    %esi
+  803c4f:	5f                   	pop    %edi
+  803c50:	5d                   	pop    %ebp
+  803c51:	c3                   	ret
+
+00803c52 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c52:	55                   	push   %ebp
+  803c53:	89 e5                	mov    %esp,%ebp
+  803c55:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803c58:	6a 00                	push   $0x0
+  803c5a:	ff 75 0c             	push   0xc(%ebp)
+  803c5d:	ff 75 08             	push   0x8(%ebp)
+  803c60:	e8 90 ff ff ff       	call   803bf5 <cond_timedwait>
+}
+  803c65:	83 c4 10             	add    $0x10,%esp
+  803c68:	c9                   	leave
+  803c69:	c3                   	ret
+
+00803c6a <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803c6a:	55                   	push   %ebp
+  803c6b:	89 e5                	mov    %esp,%ebp
+  803c6d:	83 ec 10             	sub    $0x10,%esp
+  803c70:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803c73:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c78:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803c7c:	6a 01                	push   $0x1
+  803c7e:	50                   	push   %eax
+  803c7f:	e8 b1 d3 ff ff       	call   801035 <sys_futex_wake>
+}
+  803c84:	83 c4 10             	add    $0x10,%esp
+  803c87:	c9                   	leave
+  803c88:	c3                   	ret
+
+00803c89 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803c89:	55                   	push   %ebp
+  803c8a:	89 e5                	mov    %esp,%ebp
+  803c8c:	83 ec 10             	sub    $0x10,%esp
+  803c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c92:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c97:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803c9b:	68 00 04 00 00       	push   $0x400
+  803ca0:	50                   	push   %eax
+  803ca1:	e8 8f d3 ff ff       	call   801035 <sys_futex_wake>
+}
+  803ca6:	83 c4 10             	add    $0x10,%esp
+  803ca9:	c9                   	leave
+  803caa:	c3                   	ret
+
+00803cab <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803cab:	55                   	push   %ebp
+  803cac:	89 e5                	mov    %esp,%ebp
+  803cae:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803cb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cb4:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803cb6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803cbd:	5d                   	pop    %ebp
+  803cbe:	c3                   	ret
+
+00803cbf <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803cbf:	55                   	push   %ebp
+  803cc0:	89 e5                	mov    %esp,%ebp
+  803cc2:	53                   	push   %ebx
+  803cc3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803cc6:	8b 11                	mov    (%ecx),%edx
+  803cc8:	85 d2                	test   %edx,%edx
+  803cca:	74 14                	je     803ce0 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803ccc:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ccf:	89 d0                	mov    %edx,%eax
+  803cd1:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803cd5:	39 c2                	cmp    %eax,%edx
+  803cd7:	75 ed                	jne    803cc6 <sem_trywait+0x7>
+			return 0;
+  803cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cde:	eb 05                	jmp    803ce5 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803ce0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ce8:	c9                   	leave
+  803ce9:	c3                   	ret
+
+00803cea <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803cea:	55                   	push   %ebp
+  803ceb:	89 e5                	mov    %esp,%ebp
+  803ced:	57                   	push   %edi
+  803cee:	56                   	push   %esi
+  803cef:	53                   	push   %ebx
+  803cf0:	83 ec 1c             	sub    $0x1c,%esp
+  803cf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803cf6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803cf9:	e8 80 d2 ff ff       	call   800f7e <sys_time_msec>
+  803cfe:	01 f8                	add    %edi,%eax
+  803d00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803d03:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803d08:	eb 28                	jmp    803d32 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803d0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d0f:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803d14:	83 ec 04             	sub    $0x4,%esp
+  803d17:	56                   	push   %esi
+  803d18:	6a 00                	push   $0x0
+  803d1a:	53                   	push   %ebx
+  803d1b:	e8 e6 d2 ff ff       	call   801006 <sys_futex_wait>
+  803d20:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803d25:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803d2a:	83 c4 10             	add    $0x10,%esp
+  803d2d:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803d30:	74 2e                	je     803d60 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803d32:	83 ec 0c             	sub    $0xc,%esp
+  803d35:	53                   	push   %ebx
+  803d36:	e8 84 ff ff ff       	call   803cbf <sem_trywait>
+  803d3b:	83 c4 10             	add    $0x10,%esp
+  803d3e:	85 c0                	test   %eax,%eax
+  803d40:	79 19                	jns    803d5b <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803d42:	85 ff                	test   %edi,%edi
+  803d44:	74 c4                	je     803d0a <sem_timedwait+0x20>
+  803d46:	e8 33 d2 ff ff       	call   800f7e <sys_time_msec>
+  803d4b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803d4e:	29 c6                	sub    %eax,%esi
+  803d50:	85 f6                	test   %esi,%esi
+  803d52:	7f b6                	jg     803d0a <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803d54:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803d59:	eb 05                	jmp    803d60 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d63:	5b                   	pop    %ebx
+  803d64:	5e                   	pop    %esi
+  803d65:	5f                   	pop    %edi
+  803d66:	5d                   	pop    %ebp
+  803d67:	c3                   	ret
+
+00803d68 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803d68:	55                   	push   %ebp
+  803d69:	89 e5                	mov    %esp,%ebp
+  803d6b:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803d6e:	6a 00                	push   $0x0
+  803d70:	ff 75 08             	push   0x8(%ebp)
+  803d73:	e8 72 ff ff ff       	call   803cea <sem_timedwait>
+}
+  803d78:	83 c4 10             	add    $0x10,%esp
+  803d7b:	c9                   	leave
+  803d7c:	c3                   	ret
+
+00803d7d <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803d7d:	55                   	push   %ebp
+  803d7e:	89 e5                	mov    %esp,%ebp
+  803d80:	83 ec 08             	sub    $0x8,%esp
+  803d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d86:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d8b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803d8f:	8b 50 04             	mov    0x4(%eax),%edx
+  803d92:	85 d2                	test   %edx,%edx
+  803d94:	75 02                	jne    803d98 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803d96:	c9                   	leave
+  803d97:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803d98:	83 ec 08             	sub    $0x8,%esp
+  803d9b:	6a 01                	push   $0x1
+  803d9d:	50                   	push   %eax
+  803d9e:	e8 92 d2 ff ff       	call   801035 <sys_futex_wake>
+  803da3:	83 c4 10             	add    $0x10,%esp
+}
+  803da6:	eb ee                	jmp    803d96 <sem_post+0x19>
+
+00803da8 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803da8:	55                   	push   %ebp
+  803da9:	89 e5                	mov    %esp,%ebp
+  803dab:	57                   	push   %edi
+  803dac:	56                   	push   %esi
+  803dad:	53                   	push   %ebx
+  803dae:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803db1:	68 20 70 80 00       	push   $0x807020
+  803db6:	e8 97 fd ff ff       	call   803b52 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803dbb:	a1 44 70 80 00       	mov    0x807044,%eax
+  803dc0:	83 c4 10             	add    $0x10,%esp
+  803dc3:	85 c0                	test   %eax,%eax
+  803dc5:	75 19                	jne    803de0 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803dc7:	a1 c4 72 80 00       	mov    0x8072c4,%eax
+  803dcc:	8b 00                	mov    (%eax),%eax
+  803dce:	8b 40 48             	mov    0x48(%eax),%eax
+  803dd1:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803dd6:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803ddd:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803de0:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803de5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803de8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803def:	8b 40 04             	mov    0x4(%eax),%eax
+  803df2:	85 c0                	test   %eax,%eax
+  803df4:	0f 84 e4 00 00 00    	je     803ede <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803dfa:	83 c3 01             	add    $0x1,%ebx
+  803dfd:	83 fb 20             	cmp    $0x20,%ebx
+  803e00:	75 e3                	jne    803de5 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803e02:	83 ec 0c             	sub    $0xc,%esp
+  803e05:	68 20 70 80 00       	push   $0x807020
+  803e0a:	e8 b0 fd ff ff       	call   803bbf <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803e0f:	83 c4 10             	add    $0x10,%esp
+  803e12:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803e17:	e9 b8 00 00 00       	jmp    803ed4 <pthread_create+0x12c>
+  803e1c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803e1f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803e22:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803e24:	39 f3                	cmp    %esi,%ebx
+  803e26:	73 16                	jae    803e3e <pthread_create+0x96>
+		va -= PGSIZE;
+  803e28:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803e2e:	83 ec 08             	sub    $0x8,%esp
+  803e31:	56                   	push   %esi
+  803e32:	6a 00                	push   $0x0
+  803e34:	e8 51 cf ff ff       	call   800d8a <sys_page_unmap>
+  803e39:	83 c4 10             	add    $0x10,%esp
+  803e3c:	eb e6                	jmp    803e24 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803e3e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803e41:	83 ec 08             	sub    $0x8,%esp
+  803e44:	ff 75 e4             	push   -0x1c(%ebp)
+  803e47:	6a 00                	push   $0x0
+  803e49:	e8 3c cf ff ff       	call   800d8a <sys_page_unmap>
+	return r;
+  803e4e:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803e51:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e54:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e5b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803e62:	eb 70                	jmp    803ed4 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803e64:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e67:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e71:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803e74:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e77:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803e7a:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803e81:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803e86:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e89:	29 c8                	sub    %ecx,%eax
+  803e8b:	85 db                	test   %ebx,%ebx
+  803e8d:	0f 44 05 c4 72 80 00 	cmove  0x8072c4,%eax
+	*--esp = t;
+  803e94:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803e97:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e9e:	83 ec 04             	sub    $0x4,%esp
+  803ea1:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803ea6:	29 ca                	sub    %ecx,%edx
+  803ea8:	52                   	push   %edx
+	*--esp = 0;
+  803ea9:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803eac:	50                   	push   %eax
+  803ead:	68 05 41 80 00       	push   $0x804105
+  803eb2:	e8 23 d2 ff ff       	call   8010da <sys_thread_create>
+  803eb7:	89 c7                	mov    %eax,%edi
+  803eb9:	83 c4 10             	add    $0x10,%esp
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	78 91                	js     803e51 <pthread_create+0xa9>
+	th->th_env = id;
+  803ec0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ec3:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ecd:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803ecf:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ed4:	89 f8                	mov    %edi,%eax
+  803ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ed9:	5b                   	pop    %ebx
+  803eda:	5e                   	pop    %esi
+  803edb:	5f                   	pop    %edi
+  803edc:	5d                   	pop    %ebp
+  803edd:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803ede:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ee1:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ee8:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803eef:	83 ec 0c             	sub    $0xc,%esp
+  803ef2:	68 20 70 80 00       	push   $0x807020
+  803ef7:	e8 c3 fc ff ff       	call   803bbf <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803efc:	89 d9                	mov    %ebx,%ecx
+  803efe:	c1 e1 10             	shl    $0x10,%ecx
+  803f01:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803f04:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803f09:	29 c8                	sub    %ecx,%eax
+  803f0b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803f0e:	c1 e8 16             	shr    $0x16,%eax
+  803f11:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	a8 01                	test   $0x1,%al
+  803f1d:	74 15                	je     803f34 <pthread_create+0x18c>
+  803f1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803f22:	c1 e8 0c             	shr    $0xc,%eax
+  803f25:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803f2c:	a8 01                	test   $0x1,%al
+  803f2e:	0f 85 30 ff ff ff    	jne    803e64 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f34:	83 ec 04             	sub    $0x4,%esp
+  803f37:	6a 07                	push   $0x7
+  803f39:	ff 75 e4             	push   -0x1c(%ebp)
+  803f3c:	6a 00                	push   $0x0
+  803f3e:	e8 ae cd ff ff       	call   800cf1 <sys_page_alloc>
+  803f43:	89 c7                	mov    %eax,%edi
+  803f45:	83 c4 10             	add    $0x10,%esp
+  803f48:	85 c0                	test   %eax,%eax
+  803f4a:	0f 88 01 ff ff ff    	js     803e51 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803f50:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803f55:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803f58:	29 d0                	sub    %edx,%eax
+  803f5a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f5d:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f5f:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803f64:	29 d0                	sub    %edx,%eax
+  803f66:	89 c7                	mov    %eax,%edi
+  803f68:	39 fe                	cmp    %edi,%esi
+  803f6a:	0f 83 f4 fe ff ff    	jae    803e64 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f70:	83 ec 04             	sub    $0x4,%esp
+  803f73:	6a 07                	push   $0x7
+  803f75:	56                   	push   %esi
+  803f76:	6a 00                	push   $0x0
+  803f78:	e8 74 cd ff ff       	call   800cf1 <sys_page_alloc>
+  803f7d:	83 c4 10             	add    $0x10,%esp
+  803f80:	85 c0                	test   %eax,%eax
+  803f82:	0f 88 94 fe ff ff    	js     803e1c <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f88:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f8e:	eb d8                	jmp    803f68 <pthread_create+0x1c0>
+
+00803f90 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803f90:	55                   	push   %ebp
+  803f91:	89 e5                	mov    %esp,%ebp
+  803f93:	57                   	push   %edi
+  803f94:	56                   	push   %esi
+  803f95:	53                   	push   %ebx
+  803f96:	83 ec 0c             	sub    $0xc,%esp
+  803f99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803f9c:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803f9f:	83 f8 1e             	cmp    $0x1e,%eax
+  803fa2:	0f 87 c7 00 00 00    	ja     80406f <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803fa8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803faa:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fb0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fb5:	77 12                	ja     803fc9 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fb7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fbc:	29 d0                	sub    %edx,%eax
+  803fbe:	c1 e8 10             	shr    $0x10,%eax
+  803fc1:	39 c3                	cmp    %eax,%ebx
+  803fc3:	0f 84 ad 00 00 00    	je     804076 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803fc9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fcc:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803fd3:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803fda:	eb 10                	jmp    803fec <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803fdc:	83 ec 04             	sub    $0x4,%esp
+  803fdf:	6a 00                	push   $0x0
+  803fe1:	6a 01                	push   $0x1
+  803fe3:	57                   	push   %edi
+  803fe4:	e8 1d d0 ff ff       	call   801006 <sys_futex_wait>
+  803fe9:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803fec:	8b 46 04             	mov    0x4(%esi),%eax
+  803fef:	83 f8 01             	cmp    $0x1,%eax
+  803ff2:	74 e8                	je     803fdc <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803ff4:	83 f8 02             	cmp    $0x2,%eax
+  803ff7:	0f 85 80 00 00 00    	jne    80407d <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803ffd:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804000:	c1 e6 02             	shl    $0x2,%esi
+  804003:	eb 05                	jmp    80400a <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  804005:	e8 bb cc ff ff       	call   800cc5 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80400a:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  804010:	89 ca                	mov    %ecx,%edx
+  804012:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804018:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80401b:	c1 e0 04             	shl    $0x4,%eax
+  80401e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804023:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  804026:	39 c1                	cmp    %eax,%ecx
+  804028:	75 12                	jne    80403c <pthread_join+0xac>
+  80402a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80402d:	c1 e0 04             	shl    $0x4,%eax
+  804030:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804035:	8b 40 54             	mov    0x54(%eax),%eax
+  804038:	85 c0                	test   %eax,%eax
+  80403a:	75 c9                	jne    804005 <pthread_join+0x75>
+	if (ret_store)
+  80403c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804040:	74 0f                	je     804051 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804042:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804045:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80404c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80404f:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804051:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804054:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80405b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804062:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80406a:	5b                   	pop    %ebx
+  80406b:	5e                   	pop    %esi
+  80406c:	5f                   	pop    %edi
+  80406d:	5d                   	pop    %ebp
+  80406e:	c3                   	ret
+		return -E_INVAL;
+  80406f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804074:	eb f1                	jmp    804067 <pthread_join+0xd7>
+  804076:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80407b:	eb ea                	jmp    804067 <pthread_join+0xd7>
+		return -E_INVAL;
+  80407d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804082:	eb e3                	jmp    804067 <pthread_join+0xd7>
+
+00804084 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804084:	55                   	push   %ebp
+  804085:	89 e5                	mov    %esp,%ebp
+  804087:	53                   	push   %ebx
+  804088:	83 ec 04             	sub    $0x4,%esp
+  80408b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80408d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804093:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804098:	77 0c                	ja     8040a6 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80409a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80409f:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8040a1:	c1 e8 10             	shr    $0x10,%eax
+  8040a4:	75 0a                	jne    8040b0 <pthread_exit+0x2c>
+		exit();
+  8040a6:	e8 67 c1 ff ff       	call   800212 <exit>
+  8040ab:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8040b0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8040b7:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8040ba:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8040c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8040c4:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8040c7:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8040ce:	83 ec 08             	sub    $0x8,%esp
+  8040d1:	6a 20                	push   $0x20
+  8040d3:	01 c2                	add    %eax,%edx
+  8040d5:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8040dc:	50                   	push   %eax
+  8040dd:	e8 53 cf ff ff       	call   801035 <sys_futex_wake>
+	sys_env_destroy(0);
+  8040e2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8040e9:	e8 60 cb ff ff       	call   800c4e <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8040ee:	83 c4 0c             	add    $0xc,%esp
+  8040f1:	68 8a 4f 80 00       	push   $0x804f8a
+  8040f6:	68 a5 00 00 00       	push   $0xa5
+  8040fb:	68 a4 4f 80 00       	push   $0x804fa4
+  804100:	e8 cd 03 00 00       	call   8044d2 <_panic>
+
+00804105 <pthread_start>:
+{
+  804105:	55                   	push   %ebp
+  804106:	89 e5                	mov    %esp,%ebp
+  804108:	53                   	push   %ebx
+  804109:	83 ec 04             	sub    $0x4,%esp
+  80410c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80410f:	e8 85 cb ff ff       	call   800c99 <sys_getenvid>
+  804114:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804119:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+	if (t == 0)
+  80411f:	85 db                	test   %ebx,%ebx
+  804121:	74 0c                	je     80412f <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804123:	89 d9                	mov    %ebx,%ecx
+  804125:	c1 e1 10             	shl    $0x10,%ecx
+  804128:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80412d:	29 ca                	sub    %ecx,%edx
+  80412f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804132:	c1 e0 04             	shl    $0x4,%eax
+  804135:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80413a:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80413c:	83 ec 0c             	sub    $0xc,%esp
+  80413f:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804146:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804149:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804150:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804157:	89 04 24             	mov    %eax,(%esp)
+  80415a:	e8 25 ff ff ff       	call   804084 <pthread_exit>
+
+0080415f <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80415f:	55                   	push   %ebp
+  804160:	89 e5                	mov    %esp,%ebp
+  804162:	57                   	push   %edi
+  804163:	56                   	push   %esi
+  804164:	53                   	push   %ebx
+  804165:	83 ec 1c             	sub    $0x1c,%esp
+  804168:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80416a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804170:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804177:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80417c:	77 0d                	ja     80418b <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80417e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804183:	29 d0                	sub    %edx,%eax
+  804185:	c1 e8 10             	shr    $0x10,%eax
+  804188:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80418b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804190:	eb 2f                	jmp    8041c1 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804192:	8b 0d c4 72 80 00    	mov    0x8072c4,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804198:	8b 01                	mov    (%ecx),%eax
+  80419a:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80419d:	39 c2                	cmp    %eax,%edx
+  80419f:	75 14                	jne    8041b5 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8041a1:	83 ec 0c             	sub    $0xc,%esp
+  8041a4:	57                   	push   %edi
+  8041a5:	e8 a4 ca ff ff       	call   800c4e <sys_env_destroy>
+  8041aa:	83 c4 10             	add    $0x10,%esp
+  8041ad:	85 c0                	test   %eax,%eax
+  8041af:	0f 88 97 00 00 00    	js     80424c <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8041b5:	83 c3 01             	add    $0x1,%ebx
+  8041b8:	83 fb 20             	cmp    $0x20,%ebx
+  8041bb:	0f 84 d2 00 00 00    	je     804293 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8041c1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8041c4:	74 ef                	je     8041b5 <pthread_kill_others+0x56>
+  8041c6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041c9:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8041d0:	8b 40 04             	mov    0x4(%eax),%eax
+  8041d3:	83 f8 01             	cmp    $0x1,%eax
+  8041d6:	75 dd                	jne    8041b5 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8041d8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041db:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8041e2:	89 fe                	mov    %edi,%esi
+  8041e4:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8041ea:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041ed:	c1 e0 04             	shl    $0x4,%eax
+  8041f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041f5:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041f8:	39 c7                	cmp    %eax,%edi
+  8041fa:	75 b9                	jne    8041b5 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8041fc:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041ff:	c1 e0 04             	shl    $0x4,%eax
+  804202:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804207:	8b 40 54             	mov    0x54(%eax),%eax
+  80420a:	85 c0                	test   %eax,%eax
+  80420c:	74 a7                	je     8041b5 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80420e:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804211:	c1 e0 04             	shl    $0x4,%eax
+  804214:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80421a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80421c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804222:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804227:	0f 87 65 ff ff ff    	ja     804192 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80422d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804232:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804234:	c1 e8 10             	shr    $0x10,%eax
+  804237:	0f 84 55 ff ff ff    	je     804192 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80423d:	c1 e0 10             	shl    $0x10,%eax
+  804240:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804245:	29 c1                	sub    %eax,%ecx
+  804247:	e9 4c ff ff ff       	jmp    804198 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80424c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80424f:	c1 e2 04             	shl    $0x4,%edx
+  804252:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804258:	8b 52 48             	mov    0x48(%edx),%edx
+  80425b:	39 fa                	cmp    %edi,%edx
+  80425d:	0f 85 52 ff ff ff    	jne    8041b5 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804263:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804266:	c1 e2 04             	shl    $0x4,%edx
+  804269:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80426f:	8b 52 54             	mov    0x54(%edx),%edx
+  804272:	85 d2                	test   %edx,%edx
+  804274:	0f 84 3b ff ff ff    	je     8041b5 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80427a:	83 ec 0c             	sub    $0xc,%esp
+  80427d:	50                   	push   %eax
+  80427e:	57                   	push   %edi
+  80427f:	68 b4 4f 80 00       	push   $0x804fb4
+  804284:	68 bb 00 00 00       	push   $0xbb
+  804289:	68 a4 4f 80 00       	push   $0x804fa4
+  80428e:	e8 3f 02 00 00       	call   8044d2 <_panic>
+	}
+}
+  804293:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804296:	5b                   	pop    %ebx
+  804297:	5e                   	pop    %esi
+  804298:	5f                   	pop    %edi
+  804299:	5d                   	pop    %ebp
+  80429a:	c3                   	ret
+
+0080429b <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80429b:	55                   	push   %ebp
+  80429c:	89 e5                	mov    %esp,%ebp
+  80429e:	53                   	push   %ebx
+  80429f:	83 ec 04             	sub    $0x4,%esp
+  8042a2:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042a4:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8042aa:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8042b0:	0f 87 85 00 00 00    	ja     80433b <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042b6:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8042bb:	29 c3                	sub    %eax,%ebx
+  8042bd:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8042c0:	83 ec 04             	sub    $0x4,%esp
+  8042c3:	68 80 02 00 00       	push   $0x280
+  8042c8:	6a 00                	push   $0x0
+  8042ca:	68 40 70 80 00       	push   $0x807040
+  8042cf:	e8 30 c7 ff ff       	call   800a04 <memset>
+	threads_mu.m_state = 0;
+  8042d4:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8042db:	00 00 00 
+	if (self != 0) {
+  8042de:	83 c4 10             	add    $0x10,%esp
+  8042e1:	85 db                	test   %ebx,%ebx
+  8042e3:	74 51                	je     804336 <pthread_fork_child+0x9b>
+  8042e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f2:	77 18                	ja     80430c <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042fb:	c1 e8 10             	shr    $0x10,%eax
+  8042fe:	74 0c                	je     80430c <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804300:	c1 e0 10             	shl    $0x10,%eax
+  804303:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804308:	29 c2                	sub    %eax,%edx
+  80430a:	eb 06                	jmp    804312 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80430c:	8b 15 c4 72 80 00    	mov    0x8072c4,%edx
+		threads[self].th_env = thisenv->env_id;
+  804312:	8b 02                	mov    (%edx),%eax
+  804314:	8b 48 48             	mov    0x48(%eax),%ecx
+  804317:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80431e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804321:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804328:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  80432f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804339:	c9                   	leave
+  80433a:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80433b:	83 ec 04             	sub    $0x4,%esp
+  80433e:	68 80 02 00 00       	push   $0x280
+  804343:	6a 00                	push   $0x0
+  804345:	68 40 70 80 00       	push   $0x807040
+  80434a:	e8 b5 c6 ff ff       	call   800a04 <memset>
+	threads_mu.m_state = 0;
+  80434f:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804356:	00 00 00 
+  804359:	83 c4 10             	add    $0x10,%esp
+  80435c:	eb d8                	jmp    804336 <pthread_fork_child+0x9b>
+
+0080435e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80435e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804363:	c3                   	ret
+
+00804364 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804364:	55                   	push   %ebp
+  804365:	89 e5                	mov    %esp,%ebp
+  804367:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80436a:	68 d9 4f 80 00       	push   $0x804fd9
+  80436f:	ff 75 0c             	push   0xc(%ebp)
+  804372:	e8 3c c5 ff ff       	call   8008b3 <strcpy>
+	return 0;
+}
+  804377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437c:	c9                   	leave
+  80437d:	c3                   	ret
+
+0080437e <devcons_write>:
+{
+  80437e:	55                   	push   %ebp
+  80437f:	89 e5                	mov    %esp,%ebp
+  804381:	57                   	push   %edi
+  804382:	56                   	push   %esi
+  804383:	53                   	push   %ebx
+  804384:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80438a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80438f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804395:	eb 2e                	jmp    8043c5 <devcons_write+0x47>
+		m = n - tot;
+  804397:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80439a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80439c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043a1:	39 c3                	cmp    %eax,%ebx
+  8043a3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8043a6:	83 ec 04             	sub    $0x4,%esp
+  8043a9:	53                   	push   %ebx
+  8043aa:	89 f0                	mov    %esi,%eax
+  8043ac:	03 45 0c             	add    0xc(%ebp),%eax
+  8043af:	50                   	push   %eax
+  8043b0:	57                   	push   %edi
+  8043b1:	e8 83 c6 ff ff       	call   800a39 <memmove>
+		sys_cputs(buf, m);
+  8043b6:	83 c4 08             	add    $0x8,%esp
+  8043b9:	53                   	push   %ebx
+  8043ba:	57                   	push   %edi
+  8043bb:	e8 37 c8 ff ff       	call   800bf7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8043c0:	01 de                	add    %ebx,%esi
+  8043c2:	83 c4 10             	add    $0x10,%esp
+  8043c5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8043c8:	72 cd                	jb     804397 <devcons_write+0x19>
+}
+  8043ca:	89 f0                	mov    %esi,%eax
+  8043cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cf:	5b                   	pop    %ebx
+  8043d0:	5e                   	pop    %esi
+  8043d1:	5f                   	pop    %edi
+  8043d2:	5d                   	pop    %ebp
+  8043d3:	c3                   	ret
+
+008043d4 <devcons_read>:
+{
+  8043d4:	55                   	push   %ebp
+  8043d5:	89 e5                	mov    %esp,%ebp
+  8043d7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8043da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043df:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8043e3:	75 07                	jne    8043ec <devcons_read+0x18>
+  8043e5:	eb 1f                	jmp    804406 <devcons_read+0x32>
+		sys_yield();
+  8043e7:	e8 d9 c8 ff ff       	call   800cc5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8043ec:	e8 31 c8 ff ff       	call   800c22 <sys_cgetc>
+  8043f1:	85 c0                	test   %eax,%eax
+  8043f3:	74 f2                	je     8043e7 <devcons_read+0x13>
+	if (c < 0)
+  8043f5:	78 0f                	js     804406 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8043f7:	83 f8 04             	cmp    $0x4,%eax
+  8043fa:	74 0c                	je     804408 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8043fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8043ff:	88 02                	mov    %al,(%edx)
+	return 1;
+  804401:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804406:	c9                   	leave
+  804407:	c3                   	ret
+		return 0;
+  804408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80440d:	eb f7                	jmp    804406 <devcons_read+0x32>
+
+0080440f <cputchar>:
+{
+  80440f:	55                   	push   %ebp
+  804410:	89 e5                	mov    %esp,%ebp
+  804412:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804415:	8b 45 08             	mov    0x8(%ebp),%eax
+  804418:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80441b:	6a 01                	push   $0x1
+  80441d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804420:	50                   	push   %eax
+  804421:	e8 d1 c7 ff ff       	call   800bf7 <sys_cputs>
+}
+  804426:	83 c4 10             	add    $0x10,%esp
+  804429:	c9                   	leave
+  80442a:	c3                   	ret
+
+0080442b <getchar>:
+{
+  80442b:	55                   	push   %ebp
+  80442c:	89 e5                	mov    %esp,%ebp
+  80442e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804431:	6a 01                	push   $0x1
+  804433:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804436:	50                   	push   %eax
+  804437:	6a 00                	push   $0x0
+  804439:	e8 63 d8 ff ff       	call   801ca1 <read>
+	if (r < 0)
+  80443e:	83 c4 10             	add    $0x10,%esp
+  804441:	85 c0                	test   %eax,%eax
+  804443:	78 06                	js     80444b <getchar+0x20>
+	if (r < 1)
+  804445:	74 06                	je     80444d <getchar+0x22>
+	return c;
+  804447:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80444b:	c9                   	leave
+  80444c:	c3                   	ret
+		return -E_EOF;
+  80444d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804452:	eb f7                	jmp    80444b <getchar+0x20>
+
+00804454 <iscons>:
+{
+  804454:	55                   	push   %ebp
+  804455:	89 e5                	mov    %esp,%ebp
+  804457:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80445a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80445d:	50                   	push   %eax
+  80445e:	ff 75 08             	push   0x8(%ebp)
+  804461:	e8 ab d5 ff ff       	call   801a11 <fd_lookup>
+  804466:	83 c4 10             	add    $0x10,%esp
+  804469:	85 c0                	test   %eax,%eax
+  80446b:	78 11                	js     80447e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80446d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804470:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804476:	39 10                	cmp    %edx,(%eax)
+  804478:	0f 94 c0             	sete   %al
+  80447b:	0f b6 c0             	movzbl %al,%eax
+}
+  80447e:	c9                   	leave
+  80447f:	c3                   	ret
+
+00804480 <opencons>:
+{
+  804480:	55                   	push   %ebp
+  804481:	89 e5                	mov    %esp,%ebp
+  804483:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804486:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804489:	50                   	push   %eax
+  80448a:	e8 2c d5 ff ff       	call   8019bb <fd_alloc>
+  80448f:	83 c4 10             	add    $0x10,%esp
+  804492:	85 c0                	test   %eax,%eax
+  804494:	78 3a                	js     8044d0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804496:	83 ec 04             	sub    $0x4,%esp
+  804499:	68 07 04 00 00       	push   $0x407
+  80449e:	ff 75 f4             	push   -0xc(%ebp)
+  8044a1:	6a 00                	push   $0x0
+  8044a3:	e8 49 c8 ff ff       	call   800cf1 <sys_page_alloc>
+  8044a8:	83 c4 10             	add    $0x10,%esp
+  8044ab:	85 c0                	test   %eax,%eax
+  8044ad:	78 21                	js     8044d0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8044af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044b2:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8044b8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8044ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044bd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8044c4:	83 ec 0c             	sub    $0xc,%esp
+  8044c7:	50                   	push   %eax
+  8044c8:	e8 c7 d4 ff ff       	call   801994 <fd2num>
+  8044cd:	83 c4 10             	add    $0x10,%esp
+}
+  8044d0:	c9                   	leave
+  8044d1:	c3                   	ret
+
+008044d2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8044d2:	55                   	push   %ebp
+  8044d3:	89 e5                	mov    %esp,%ebp
+  8044d5:	56                   	push   %esi
+  8044d6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8044d7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8044da:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8044e0:	e8 b4 c7 ff ff       	call   800c99 <sys_getenvid>
+  8044e5:	83 ec 0c             	sub    $0xc,%esp
+  8044e8:	ff 75 0c             	push   0xc(%ebp)
+  8044eb:	ff 75 08             	push   0x8(%ebp)
+  8044ee:	56                   	push   %esi
+  8044ef:	50                   	push   %eax
+  8044f0:	68 e8 4f 80 00       	push   $0x804fe8
+  8044f5:	e8 d5 bd ff ff       	call   8002cf <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8044fa:	83 c4 18             	add    $0x18,%esp
+  8044fd:	53                   	push   %ebx
+  8044fe:	ff 75 10             	push   0x10(%ebp)
+  804501:	e8 78 bd ff ff       	call   80027e <vcprintf>
+	cprintf("\n");
+  804506:	c7 04 24 5a 4d 80 00 	movl   $0x804d5a,(%esp)
+  80450d:	e8 bd bd ff ff       	call   8002cf <cprintf>
+  804512:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804515:	cc                   	int3
+	while (1)
+  804516:	eb fd                	jmp    804515 <_panic+0x43>
+
+00804518 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804518:	55                   	push   %ebp
+  804519:	89 e5                	mov    %esp,%ebp
+  80451b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80451e:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804525:	74 0a                	je     804531 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804527:	8b 45 08             	mov    0x8(%ebp),%eax
+  80452a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  80452f:	c9                   	leave
+  804530:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804531:	83 ec 04             	sub    $0x4,%esp
+  804534:	6a 07                	push   $0x7
+  804536:	68 00 f0 bf ee       	push   $0xeebff000
+  80453b:	6a 00                	push   $0x0
+  80453d:	e8 af c7 ff ff       	call   800cf1 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804542:	83 c4 08             	add    $0x8,%esp
+  804545:	68 56 45 80 00       	push   $0x804556
+  80454a:	6a 00                	push   $0x0
+  80454c:	e8 1d c9 ff ff       	call   800e6e <sys_env_set_pgfault_upcall>
+  804551:	83 c4 10             	add    $0x10,%esp
+  804554:	eb d1                	jmp    804527 <set_pgfault_handler+0xf>
+
+00804556 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804556:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804557:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  80455c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80455e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804561:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804565:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804569:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80456c:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804570:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804572:	83 c4 08             	add    $0x8,%esp
+	popal
+  804575:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804576:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804579:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80457a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80457b:	c3                   	ret
+
+0080457c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80457c:	55                   	push   %ebp
+  80457d:	89 e5                	mov    %esp,%ebp
+  80457f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804582:	89 c2                	mov    %eax,%edx
+  804584:	c1 ea 16             	shr    $0x16,%edx
+  804587:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80458e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804593:	f6 c1 01             	test   $0x1,%cl
+  804596:	74 1c                	je     8045b4 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804598:	c1 e8 0c             	shr    $0xc,%eax
+  80459b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045a2:	a8 01                	test   $0x1,%al
+  8045a4:	74 0e                	je     8045b4 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045a6:	c1 e8 0c             	shr    $0xc,%eax
+  8045a9:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8045b0:	ef 
+  8045b1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045b4:	89 d0                	mov    %edx,%eax
+  8045b6:	5d                   	pop    %ebp
+  8045b7:	c3                   	ret
+
+008045b8 <udm>:
+  8045b8:	57                   	push   %edi
+  8045b9:	56                   	push   %esi
+  8045ba:	53                   	push   %ebx
+  8045bb:	83 ec 20             	sub    $0x20,%esp
+  8045be:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8045c6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8045ca:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8045ce:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8045d2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8045d6:	89 d1                	mov    %edx,%ecx
+  8045d8:	09 c1                	or     %eax,%ecx
+  8045da:	0f 84 91 00 00 00    	je     804671 <udm+0xb9>
+  8045e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045ea:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8045ef:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045f6:	00 
+  8045f7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045fe:	00 
+  8045ff:	eb 08                	jmp    804609 <udm+0x51>
+  804601:	83 e9 01             	sub    $0x1,%ecx
+  804604:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804607:	74 7c                	je     804685 <udm+0xcd>
+  804609:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80460d:	01 c0                	add    %eax,%eax
+  80460f:	89 c6                	mov    %eax,%esi
+  804611:	89 d7                	mov    %edx,%edi
+  804613:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804617:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80461b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80461e:	d3 ea                	shr    %cl,%edx
+  804620:	f6 c1 20             	test   $0x20,%cl
+  804623:	74 04                	je     804629 <udm+0x71>
+  804625:	89 d0                	mov    %edx,%eax
+  804627:	31 d2                	xor    %edx,%edx
+  804629:	83 e0 01             	and    $0x1,%eax
+  80462c:	89 04 24             	mov    %eax,(%esp)
+  80462f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804636:	00 
+  804637:	8b 04 24             	mov    (%esp),%eax
+  80463a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80463e:	09 f0                	or     %esi,%eax
+  804640:	09 fa                	or     %edi,%edx
+  804642:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804646:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80464a:	39 f0                	cmp    %esi,%eax
+  80464c:	89 d3                	mov    %edx,%ebx
+  80464e:	19 fb                	sbb    %edi,%ebx
+  804650:	72 af                	jb     804601 <udm+0x49>
+  804652:	29 f0                	sub    %esi,%eax
+  804654:	19 fa                	sbb    %edi,%edx
+  804656:	89 cf                	mov    %ecx,%edi
+  804658:	c1 ef 05             	shr    $0x5,%edi
+  80465b:	83 e7 01             	and    $0x1,%edi
+  80465e:	89 fe                	mov    %edi,%esi
+  804660:	83 f6 01             	xor    $0x1,%esi
+  804663:	d3 e6                	shl    %cl,%esi
+  804665:	d3 e7                	shl    %cl,%edi
+  804667:	09 74 24 18          	or     %esi,0x18(%esp)
+  80466b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80466f:	eb 90                	jmp    804601 <udm+0x49>
+  804671:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804675:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804679:	89 f0                	mov    %esi,%eax
+  80467b:	89 fa                	mov    %edi,%edx
+  80467d:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804681:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804685:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804689:	89 01                	mov    %eax,(%ecx)
+  80468b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80468e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804692:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804696:	83 c4 20             	add    $0x20,%esp
+  804699:	5b                   	pop    %ebx
+  80469a:	5e                   	pop    %esi
+  80469b:	5f                   	pop    %edi
+  80469c:	c3                   	ret
+
+0080469d <__udivdi3>:
+  80469d:	83 ec 18             	sub    $0x18,%esp
+  8046a0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046a4:	50                   	push   %eax
+  8046a5:	ff 74 24 2c          	push   0x2c(%esp)
+  8046a9:	ff 74 24 2c          	push   0x2c(%esp)
+  8046ad:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046b1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046b5:	e8 fe fe ff ff       	call   8045b8 <udm>
+  8046ba:	83 c4 24             	add    $0x24,%esp
+  8046bd:	c3                   	ret
+
+008046be <__umoddi3>:
+  8046be:	83 ec 18             	sub    $0x18,%esp
+  8046c1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046c5:	50                   	push   %eax
+  8046c6:	ff 74 24 2c          	push   0x2c(%esp)
+  8046ca:	ff 74 24 2c          	push   0x2c(%esp)
+  8046ce:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046d2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046d6:	e8 dd fe ff ff       	call   8045b8 <udm>
+  8046db:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046df:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046e3:	83 c4 24             	add    $0x24,%esp
+  8046e6:	c3                   	ret
+
+008046e7 <__divdi3>:
+  8046e7:	56                   	push   %esi
+  8046e8:	53                   	push   %ebx
+  8046e9:	83 ec 14             	sub    $0x14,%esp
+  8046ec:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8046f0:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8046f4:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8046f8:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8046fc:	85 d2                	test   %edx,%edx
+  8046fe:	78 18                	js     804718 <__divdi3+0x31>
+  804700:	85 db                	test   %ebx,%ebx
+  804702:	78 3e                	js     804742 <__divdi3+0x5b>
+  804704:	83 ec 04             	sub    $0x4,%esp
+  804707:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80470b:	56                   	push   %esi
+  80470c:	53                   	push   %ebx
+  80470d:	51                   	push   %ecx
+  80470e:	e8 a5 fe ff ff       	call   8045b8 <udm>
+  804713:	83 c4 10             	add    $0x10,%esp
+  804716:	eb 24                	jmp    80473c <__divdi3+0x55>
+  804718:	f7 d8                	neg    %eax
+  80471a:	83 d2 00             	adc    $0x0,%edx
+  80471d:	f7 da                	neg    %edx
+  80471f:	85 db                	test   %ebx,%ebx
+  804721:	78 3a                	js     80475d <__divdi3+0x76>
+  804723:	83 ec 04             	sub    $0x4,%esp
+  804726:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80472a:	56                   	push   %esi
+  80472b:	53                   	push   %ebx
+  80472c:	51                   	push   %ecx
+  80472d:	e8 86 fe ff ff       	call   8045b8 <udm>
+  804732:	83 c4 10             	add    $0x10,%esp
+  804735:	f7 d8                	neg    %eax
+  804737:	83 d2 00             	adc    $0x0,%edx
+  80473a:	f7 da                	neg    %edx
+  80473c:	83 c4 14             	add    $0x14,%esp
+  80473f:	5b                   	pop    %ebx
+  804740:	5e                   	pop    %esi
+  804741:	c3                   	ret
+  804742:	83 ec 04             	sub    $0x4,%esp
+  804745:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804749:	56                   	push   %esi
+  80474a:	f7 d9                	neg    %ecx
+  80474c:	83 d3 00             	adc    $0x0,%ebx
+  80474f:	f7 db                	neg    %ebx
+  804751:	53                   	push   %ebx
+  804752:	51                   	push   %ecx
+  804753:	e8 60 fe ff ff       	call   8045b8 <udm>
+  804758:	83 c4 10             	add    $0x10,%esp
+  80475b:	eb d8                	jmp    804735 <__divdi3+0x4e>
+  80475d:	83 ec 04             	sub    $0x4,%esp
+  804760:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804764:	56                   	push   %esi
+  804765:	f7 d9                	neg    %ecx
+  804767:	83 d3 00             	adc    $0x0,%ebx
+  80476a:	f7 db                	neg    %ebx
+  80476c:	53                   	push   %ebx
+  80476d:	51                   	push   %ecx
+  80476e:	e8 45 fe ff ff       	call   8045b8 <udm>
+  804773:	83 c4 10             	add    $0x10,%esp
+  804776:	eb c4                	jmp    80473c <__divdi3+0x55>
+
+00804778 <__moddi3>:
+  804778:	55                   	push   %ebp
+  804779:	57                   	push   %edi
+  80477a:	56                   	push   %esi
+  80477b:	53                   	push   %ebx
+  80477c:	83 ec 24             	sub    $0x24,%esp
+  80477f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804783:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804787:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80478b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80478f:	85 d2                	test   %edx,%edx
+  804791:	78 3b                	js     8047ce <__moddi3+0x56>
+  804793:	83 ec 04             	sub    $0x4,%esp
+  804796:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80479a:	56                   	push   %esi
+  80479b:	89 ce                	mov    %ecx,%esi
+  80479d:	f7 de                	neg    %esi
+  80479f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8047a3:	89 de                	mov    %ebx,%esi
+  8047a5:	83 d6 00             	adc    $0x0,%esi
+  8047a8:	f7 de                	neg    %esi
+  8047aa:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8047ae:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047b2:	0f 48 f1             	cmovs  %ecx,%esi
+  8047b5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8047ba:	53                   	push   %ebx
+  8047bb:	56                   	push   %esi
+  8047bc:	e8 f7 fd ff ff       	call   8045b8 <udm>
+  8047c1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047c5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047c9:	83 c4 10             	add    $0x10,%esp
+  8047cc:	eb 47                	jmp    804815 <__moddi3+0x9d>
+  8047ce:	f7 d8                	neg    %eax
+  8047d0:	83 d2 00             	adc    $0x0,%edx
+  8047d3:	f7 da                	neg    %edx
+  8047d5:	83 ec 04             	sub    $0x4,%esp
+  8047d8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047dc:	56                   	push   %esi
+  8047dd:	89 cf                	mov    %ecx,%edi
+  8047df:	f7 df                	neg    %edi
+  8047e1:	89 de                	mov    %ebx,%esi
+  8047e3:	83 d6 00             	adc    $0x0,%esi
+  8047e6:	f7 de                	neg    %esi
+  8047e8:	0f 49 cf             	cmovns %edi,%ecx
+  8047eb:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8047ef:	0f 49 de             	cmovns %esi,%ebx
+  8047f2:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8047f6:	ff 74 24 0c          	push   0xc(%esp)
+  8047fa:	ff 74 24 0c          	push   0xc(%esp)
+  8047fe:	e8 b5 fd ff ff       	call   8045b8 <udm>
+  804803:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804807:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80480b:	f7 d8                	neg    %eax
+  80480d:	83 d2 00             	adc    $0x0,%edx
+  804810:	f7 da                	neg    %edx
+  804812:	83 c4 10             	add    $0x10,%esp
+  804815:	83 c4 24             	add    $0x24,%esp
+  804818:	5b                   	pop    %ebx
+  804819:	5e                   	pop    %esi
+  80481a:	5f                   	pop    %edi
+  80481b:	5d                   	pop    %ebp
+  80481c:	c3                   	ret
@@ -0,0 +1,9807 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f2 00 00 00       	call   800123 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  80003f:	eb 2a                	jmp    80006b <primeproc+0x38>
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+		return pthread_main_tls;
+  800041:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  800047:	8b 02                	mov    (%edx),%eax
+  800049:	8b 40 5c             	mov    0x5c(%eax),%eax
+  80004c:	83 ec 04             	sub    $0x4,%esp
+  80004f:	53                   	push   %ebx
+  800050:	50                   	push   %eax
+  800051:	68 c0 47 80 00       	push   $0x8047c0
+  800056:	e8 46 02 00 00       	call   8002a1 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  80005b:	e8 1f 13 00 00       	call   80137f <fork>
+  800060:	89 c6                	mov    %eax,%esi
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	85 c0                	test   %eax,%eax
+  800067:	78 3b                	js     8000a4 <primeproc+0x71>
+		panic("fork: %e", id);
+	if (id == 0)
+  800069:	75 4b                	jne    8000b6 <primeproc+0x83>
+	p = ipc_recv(&envid, 0, 0);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	6a 00                	push   $0x0
+  800070:	6a 00                	push   $0x0
+  800072:	57                   	push   %edi
+  800073:	e8 63 17 00 00       	call   8017db <ipc_recv>
+  800078:	89 c3                	mov    %eax,%ebx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80007a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80007c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80008a:	77 b5                	ja     800041 <primeproc+0xe>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80008c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800091:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800093:	c1 e8 10             	shr    $0x10,%eax
+  800096:	74 a9                	je     800041 <primeproc+0xe>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800098:	c1 e0 10             	shl    $0x10,%eax
+  80009b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000a0:	29 c2                	sub    %eax,%edx
+  8000a2:	eb a3                	jmp    800047 <primeproc+0x14>
+		panic("fork: %e", id);
+  8000a4:	50                   	push   %eax
+  8000a5:	68 cc 47 80 00       	push   $0x8047cc
+  8000aa:	6a 1a                	push   $0x1a
+  8000ac:	68 d5 47 80 00       	push   $0x8047d5
+  8000b1:	e8 10 01 00 00       	call   8001c6 <_panic>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  8000b6:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8000b9:	83 ec 04             	sub    $0x4,%esp
+  8000bc:	6a 00                	push   $0x0
+  8000be:	6a 00                	push   $0x0
+  8000c0:	57                   	push   %edi
+  8000c1:	e8 15 17 00 00       	call   8017db <ipc_recv>
+  8000c6:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  8000c8:	99                   	cltd
+  8000c9:	f7 fb                	idiv   %ebx
+  8000cb:	83 c4 10             	add    $0x10,%esp
+  8000ce:	85 d2                	test   %edx,%edx
+  8000d0:	74 e7                	je     8000b9 <primeproc+0x86>
+			ipc_send(id, i, 0, 0);
+  8000d2:	6a 00                	push   $0x0
+  8000d4:	6a 00                	push   $0x0
+  8000d6:	51                   	push   %ecx
+  8000d7:	56                   	push   %esi
+  8000d8:	e8 f4 17 00 00       	call   8018d1 <ipc_send>
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	eb d7                	jmp    8000b9 <primeproc+0x86>
+
+008000e2 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000e2:	55                   	push   %ebp
+  8000e3:	89 e5                	mov    %esp,%ebp
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000e7:	e8 93 12 00 00       	call   80137f <fork>
+  8000ec:	89 c6                	mov    %eax,%esi
+  8000ee:	85 c0                	test   %eax,%eax
+  8000f0:	78 1a                	js     80010c <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000f2:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000f7:	74 25                	je     80011e <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000f9:	6a 00                	push   $0x0
+  8000fb:	6a 00                	push   $0x0
+  8000fd:	53                   	push   %ebx
+  8000fe:	56                   	push   %esi
+  8000ff:	e8 cd 17 00 00       	call   8018d1 <ipc_send>
+	for (i = 2; ; i++)
+  800104:	83 c3 01             	add    $0x1,%ebx
+  800107:	83 c4 10             	add    $0x10,%esp
+  80010a:	eb ed                	jmp    8000f9 <umain+0x17>
+		panic("fork: %e", id);
+  80010c:	50                   	push   %eax
+  80010d:	68 cc 47 80 00       	push   $0x8047cc
+  800112:	6a 2d                	push   $0x2d
+  800114:	68 d5 47 80 00       	push   $0x8047d5
+  800119:	e8 a8 00 00 00       	call   8001c6 <_panic>
+		primeproc();
+  80011e:	e8 10 ff ff ff       	call   800033 <primeproc>
+
+00800123 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	57                   	push   %edi
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	83 ec 1c             	sub    $0x1c,%esp
+  80012c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80012f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800132:	e8 34 0b 00 00       	call   800c6b <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800137:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80013a:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800140:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800145:	89 c1                	mov    %eax,%ecx
+  800147:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800149:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80014f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800154:	77 16                	ja     80016c <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800156:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80015b:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  80015d:	c1 e8 10             	shr    $0x10,%eax
+  800160:	74 0a                	je     80016c <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800162:	c1 e0 10             	shl    $0x10,%eax
+  800165:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80016a:	29 c2                	sub    %eax,%edx
+  80016c:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80016f:	c1 e0 04             	shl    $0x4,%eax
+  800172:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800177:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800179:	85 db                	test   %ebx,%ebx
+  80017b:	7e 07                	jle    800184 <libmain+0x61>
+		binaryname = argv[0];
+  80017d:	8b 06                	mov    (%esi),%eax
+  80017f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800184:	83 ec 08             	sub    $0x8,%esp
+  800187:	56                   	push   %esi
+  800188:	53                   	push   %ebx
+  800189:	e8 54 ff ff ff       	call   8000e2 <umain>
+
+	// exit gracefully
+	exit();
+  80018e:	e8 0b 00 00 00       	call   80019e <exit>
+}
+  800193:	83 c4 10             	add    $0x10,%esp
+  800196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800199:	5b                   	pop    %ebx
+  80019a:	5e                   	pop    %esi
+  80019b:	5f                   	pop    %edi
+  80019c:	5d                   	pop    %ebp
+  80019d:	c3                   	ret
+
+0080019e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80019e:	55                   	push   %ebp
+  80019f:	89 e5                	mov    %esp,%ebp
+  8001a1:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8001a4:	6a 00                	push   $0x0
+  8001a6:	e8 16 29 00 00       	call   802ac1 <fflush>
+	pthread_kill_others();
+  8001ab:	e8 81 3f 00 00       	call   804131 <pthread_kill_others>
+	close_all();
+  8001b0:	e8 af 19 00 00       	call   801b64 <close_all>
+	sys_env_destroy(0);
+  8001b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001bc:	e8 5f 0a 00 00       	call   800c20 <sys_env_destroy>
+}
+  8001c1:	83 c4 10             	add    $0x10,%esp
+  8001c4:	c9                   	leave
+  8001c5:	c3                   	ret
+
+008001c6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	56                   	push   %esi
+  8001ca:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001cb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001ce:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001d4:	e8 92 0a 00 00       	call   800c6b <sys_getenvid>
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+  8001dc:	ff 75 0c             	push   0xc(%ebp)
+  8001df:	ff 75 08             	push   0x8(%ebp)
+  8001e2:	56                   	push   %esi
+  8001e3:	50                   	push   %eax
+  8001e4:	68 f0 47 80 00       	push   $0x8047f0
+  8001e9:	e8 b3 00 00 00       	call   8002a1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001ee:	83 c4 18             	add    $0x18,%esp
+  8001f1:	53                   	push   %ebx
+  8001f2:	ff 75 10             	push   0x10(%ebp)
+  8001f5:	e8 56 00 00 00       	call   800250 <vcprintf>
+	cprintf("\n");
+  8001fa:	c7 04 24 fa 4c 80 00 	movl   $0x804cfa,(%esp)
+  800201:	e8 9b 00 00 00       	call   8002a1 <cprintf>
+  800206:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800209:	cc                   	int3
+	while (1)
+  80020a:	eb fd                	jmp    800209 <_panic+0x43>
+
+0080020c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80020c:	55                   	push   %ebp
+  80020d:	89 e5                	mov    %esp,%ebp
+  80020f:	53                   	push   %ebx
+  800210:	83 ec 04             	sub    $0x4,%esp
+  800213:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800216:	8b 13                	mov    (%ebx),%edx
+  800218:	8d 42 01             	lea    0x1(%edx),%eax
+  80021b:	89 03                	mov    %eax,(%ebx)
+  80021d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800220:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800224:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800229:	74 09                	je     800234 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80022b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80022f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800232:	c9                   	leave
+  800233:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800234:	83 ec 08             	sub    $0x8,%esp
+  800237:	68 ff 00 00 00       	push   $0xff
+  80023c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023f:	50                   	push   %eax
+  800240:	e8 84 09 00 00       	call   800bc9 <sys_cputs>
+		b->idx = 0;
+  800245:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	eb db                	jmp    80022b <putch+0x1f>
+
+00800250 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800250:	55                   	push   %ebp
+  800251:	89 e5                	mov    %esp,%ebp
+  800253:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800259:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800260:	00 00 00 
+	b.cnt = 0;
+  800263:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80026a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80026d:	ff 75 0c             	push   0xc(%ebp)
+  800270:	ff 75 08             	push   0x8(%ebp)
+  800273:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800279:	50                   	push   %eax
+  80027a:	68 0c 02 80 00       	push   $0x80020c
+  80027f:	e8 14 01 00 00       	call   800398 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800284:	83 c4 08             	add    $0x8,%esp
+  800287:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80028d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800293:	50                   	push   %eax
+  800294:	e8 30 09 00 00       	call   800bc9 <sys_cputs>
+
+	return b.cnt;
+}
+  800299:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029f:	c9                   	leave
+  8002a0:	c3                   	ret
+
+008002a1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002a1:	55                   	push   %ebp
+  8002a2:	89 e5                	mov    %esp,%ebp
+  8002a4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002aa:	50                   	push   %eax
+  8002ab:	ff 75 08             	push   0x8(%ebp)
+  8002ae:	e8 9d ff ff ff       	call   800250 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002b3:	c9                   	leave
+  8002b4:	c3                   	ret
+
+008002b5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	57                   	push   %edi
+  8002b9:	56                   	push   %esi
+  8002ba:	53                   	push   %ebx
+  8002bb:	83 ec 1c             	sub    $0x1c,%esp
+  8002be:	89 c7                	mov    %eax,%edi
+  8002c0:	89 d6                	mov    %edx,%esi
+  8002c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c8:	89 d1                	mov    %edx,%ecx
+  8002ca:	89 c2                	mov    %eax,%edx
+  8002cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e2:	39 c2                	cmp    %eax,%edx
+  8002e4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002e7:	72 3e                	jb     800327 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e9:	83 ec 0c             	sub    $0xc,%esp
+  8002ec:	ff 75 18             	push   0x18(%ebp)
+  8002ef:	83 eb 01             	sub    $0x1,%ebx
+  8002f2:	53                   	push   %ebx
+  8002f3:	50                   	push   %eax
+  8002f4:	83 ec 08             	sub    $0x8,%esp
+  8002f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002fa:	ff 75 e0             	push   -0x20(%ebp)
+  8002fd:	ff 75 dc             	push   -0x24(%ebp)
+  800300:	ff 75 d8             	push   -0x28(%ebp)
+  800303:	e8 21 43 00 00       	call   804629 <__udivdi3>
+  800308:	83 c4 18             	add    $0x18,%esp
+  80030b:	52                   	push   %edx
+  80030c:	50                   	push   %eax
+  80030d:	89 f2                	mov    %esi,%edx
+  80030f:	89 f8                	mov    %edi,%eax
+  800311:	e8 9f ff ff ff       	call   8002b5 <printnum>
+  800316:	83 c4 20             	add    $0x20,%esp
+  800319:	eb 13                	jmp    80032e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80031b:	83 ec 08             	sub    $0x8,%esp
+  80031e:	56                   	push   %esi
+  80031f:	ff 75 18             	push   0x18(%ebp)
+  800322:	ff d7                	call   *%edi
+  800324:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800327:	83 eb 01             	sub    $0x1,%ebx
+  80032a:	85 db                	test   %ebx,%ebx
+  80032c:	7f ed                	jg     80031b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80032e:	83 ec 08             	sub    $0x8,%esp
+  800331:	56                   	push   %esi
+  800332:	83 ec 04             	sub    $0x4,%esp
+  800335:	ff 75 e4             	push   -0x1c(%ebp)
+  800338:	ff 75 e0             	push   -0x20(%ebp)
+  80033b:	ff 75 dc             	push   -0x24(%ebp)
+  80033e:	ff 75 d8             	push   -0x28(%ebp)
+  800341:	e8 04 43 00 00       	call   80464a <__umoddi3>
+  800346:	83 c4 14             	add    $0x14,%esp
+  800349:	0f be 80 13 48 80 00 	movsbl 0x804813(%eax),%eax
+  800350:	50                   	push   %eax
+  800351:	ff d7                	call   *%edi
+}
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800359:	5b                   	pop    %ebx
+  80035a:	5e                   	pop    %esi
+  80035b:	5f                   	pop    %edi
+  80035c:	5d                   	pop    %ebp
+  80035d:	c3                   	ret
+
+0080035e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80035e:	55                   	push   %ebp
+  80035f:	89 e5                	mov    %esp,%ebp
+  800361:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800364:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800368:	8b 10                	mov    (%eax),%edx
+  80036a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80036d:	73 0a                	jae    800379 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80036f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800372:	89 08                	mov    %ecx,(%eax)
+  800374:	8b 45 08             	mov    0x8(%ebp),%eax
+  800377:	88 02                	mov    %al,(%edx)
+}
+  800379:	5d                   	pop    %ebp
+  80037a:	c3                   	ret
+
+0080037b <printfmt>:
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800381:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800384:	50                   	push   %eax
+  800385:	ff 75 10             	push   0x10(%ebp)
+  800388:	ff 75 0c             	push   0xc(%ebp)
+  80038b:	ff 75 08             	push   0x8(%ebp)
+  80038e:	e8 05 00 00 00       	call   800398 <vprintfmt>
+}
+  800393:	83 c4 10             	add    $0x10,%esp
+  800396:	c9                   	leave
+  800397:	c3                   	ret
+
+00800398 <vprintfmt>:
+{
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	57                   	push   %edi
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  80039e:	83 ec 2c             	sub    $0x2c,%esp
+  8003a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003a7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003aa:	eb 0a                	jmp    8003b6 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+  8003af:	53                   	push   %ebx
+  8003b0:	50                   	push   %eax
+  8003b1:	ff d6                	call   *%esi
+  8003b3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8003b6:	83 c7 01             	add    $0x1,%edi
+  8003b9:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8003bd:	83 f8 25             	cmp    $0x25,%eax
+  8003c0:	74 0c                	je     8003ce <vprintfmt+0x36>
+			if (ch == '\0')
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	75 e6                	jne    8003ac <vprintfmt+0x14>
+}
+  8003c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5e                   	pop    %esi
+  8003cb:	5f                   	pop    %edi
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+		padc = ' ';
+  8003ce:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003d2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003d9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003e0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003ec:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f2:	0f b6 17             	movzbl (%edi),%edx
+  8003f5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f8:	3c 55                	cmp    $0x55,%al
+  8003fa:	0f 87 c5 03 00 00    	ja     8007c5 <vprintfmt+0x42d>
+  800400:	0f b6 c0             	movzbl %al,%eax
+  800403:	ff 24 85 a0 49 80 00 	jmp    *0x8049a0(,%eax,4)
+  80040a:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80040d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800410:	eb da                	jmp    8003ec <vprintfmt+0x54>
+  800412:	0f be d2             	movsbl %dl,%edx
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800420:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800423:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800427:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80042a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80042d:	83 f9 09             	cmp    $0x9,%ecx
+  800430:	77 55                	ja     800487 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800432:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800435:	eb e9                	jmp    800420 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8b 00                	mov    (%eax),%eax
+  80043c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80043f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800442:	8d 40 04             	lea    0x4(%eax),%eax
+  800445:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800448:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80044b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80044f:	79 9b                	jns    8003ec <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800451:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800454:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800457:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80045e:	eb 8c                	jmp    8003ec <vprintfmt+0x54>
+			if (width < 0)
+  800460:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800463:	85 d2                	test   %edx,%edx
+  800465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046a:	0f 49 c2             	cmovns %edx,%eax
+  80046d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800470:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800473:	e9 74 ff ff ff       	jmp    8003ec <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800478:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80047b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800482:	e9 65 ff ff ff       	jmp    8003ec <vprintfmt+0x54>
+  800487:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80048d:	eb bc                	jmp    80044b <vprintfmt+0xb3>
+			lflag++;
+  80048f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800492:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800495:	e9 52 ff ff ff       	jmp    8003ec <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80049a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049d:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a0:	83 ec 08             	sub    $0x8,%esp
+  8004a3:	53                   	push   %ebx
+  8004a4:	ff 30                	push   (%eax)
+  8004a6:	ff d6                	call   *%esi
+			break;
+  8004a8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ab:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004ae:	e9 b1 02 00 00       	jmp    800764 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004b9:	8b 10                	mov    (%eax),%edx
+  8004bb:	89 d0                	mov    %edx,%eax
+  8004bd:	f7 d8                	neg    %eax
+  8004bf:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c2:	83 f8 14             	cmp    $0x14,%eax
+  8004c5:	7f 23                	jg     8004ea <vprintfmt+0x152>
+  8004c7:	8b 14 85 00 4b 80 00 	mov    0x804b00(,%eax,4),%edx
+  8004ce:	85 d2                	test   %edx,%edx
+  8004d0:	74 18                	je     8004ea <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8004d2:	52                   	push   %edx
+  8004d3:	68 43 4d 80 00       	push   $0x804d43
+  8004d8:	53                   	push   %ebx
+  8004d9:	56                   	push   %esi
+  8004da:	e8 9c fe ff ff       	call   80037b <printfmt>
+  8004df:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004e5:	e9 7a 02 00 00       	jmp    800764 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004ea:	50                   	push   %eax
+  8004eb:	68 2b 48 80 00       	push   $0x80482b
+  8004f0:	53                   	push   %ebx
+  8004f1:	56                   	push   %esi
+  8004f2:	e8 84 fe ff ff       	call   80037b <printfmt>
+  8004f7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fa:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004fd:	e9 62 02 00 00       	jmp    800764 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800502:	8b 45 14             	mov    0x14(%ebp),%eax
+  800505:	83 c0 04             	add    $0x4,%eax
+  800508:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800510:	85 c9                	test   %ecx,%ecx
+  800512:	b8 24 48 80 00       	mov    $0x804824,%eax
+  800517:	0f 45 c1             	cmovne %ecx,%eax
+  80051a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80051d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800521:	7e 06                	jle    800529 <vprintfmt+0x191>
+  800523:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800527:	75 0b                	jne    800534 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800529:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80052c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80052f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800532:	eb 5c                	jmp    800590 <vprintfmt+0x1f8>
+  800534:	83 ec 08             	sub    $0x8,%esp
+  800537:	ff 75 d0             	push   -0x30(%ebp)
+  80053a:	ff 75 cc             	push   -0x34(%ebp)
+  80053d:	e8 20 03 00 00       	call   800862 <strnlen>
+  800542:	89 c2                	mov    %eax,%edx
+  800544:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800547:	29 d0                	sub    %edx,%eax
+  800549:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80054c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800550:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800553:	89 75 08             	mov    %esi,0x8(%ebp)
+  800556:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800558:	eb 0e                	jmp    800568 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80055a:	83 ec 08             	sub    $0x8,%esp
+  80055d:	53                   	push   %ebx
+  80055e:	57                   	push   %edi
+  80055f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800562:	83 ee 01             	sub    $0x1,%esi
+  800565:	83 c4 10             	add    $0x10,%esp
+  800568:	85 f6                	test   %esi,%esi
+  80056a:	7f ee                	jg     80055a <vprintfmt+0x1c2>
+  80056c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80056f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800572:	85 c0                	test   %eax,%eax
+  800574:	ba 00 00 00 00       	mov    $0x0,%edx
+  800579:	0f 49 d0             	cmovns %eax,%edx
+  80057c:	29 d0                	sub    %edx,%eax
+  80057e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800581:	eb a6                	jmp    800529 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	52                   	push   %edx
+  800588:	ff 55 08             	call   *0x8(%ebp)
+  80058b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80058e:	89 f1                	mov    %esi,%ecx
+  800590:	8d 71 01             	lea    0x1(%ecx),%esi
+  800593:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800597:	0f be d0             	movsbl %al,%edx
+  80059a:	85 d2                	test   %edx,%edx
+  80059c:	74 28                	je     8005c6 <vprintfmt+0x22e>
+  80059e:	85 ff                	test   %edi,%edi
+  8005a0:	78 05                	js     8005a7 <vprintfmt+0x20f>
+  8005a2:	83 ef 01             	sub    $0x1,%edi
+  8005a5:	78 30                	js     8005d7 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005a7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ab:	74 d6                	je     800583 <vprintfmt+0x1eb>
+  8005ad:	0f be c0             	movsbl %al,%eax
+  8005b0:	83 e8 20             	sub    $0x20,%eax
+  8005b3:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b6:	76 cb                	jbe    800583 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8005b8:	83 ec 08             	sub    $0x8,%esp
+  8005bb:	53                   	push   %ebx
+  8005bc:	6a 3f                	push   $0x3f
+  8005be:	ff 55 08             	call   *0x8(%ebp)
+  8005c1:	83 c4 10             	add    $0x10,%esp
+  8005c4:	eb c8                	jmp    80058e <vprintfmt+0x1f6>
+  8005c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005c9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005cc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005cf:	01 d0                	add    %edx,%eax
+  8005d1:	29 c8                	sub    %ecx,%eax
+  8005d3:	89 c7                	mov    %eax,%edi
+  8005d5:	eb 13                	jmp    8005ea <vprintfmt+0x252>
+  8005d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005da:	eb ed                	jmp    8005c9 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	53                   	push   %ebx
+  8005e0:	6a 20                	push   $0x20
+  8005e2:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005e4:	83 ef 01             	sub    $0x1,%edi
+  8005e7:	83 c4 10             	add    $0x10,%esp
+  8005ea:	85 ff                	test   %edi,%edi
+  8005ec:	7f ee                	jg     8005dc <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ee:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f4:	e9 6b 01 00 00       	jmp    800764 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005f9:	83 f9 01             	cmp    $0x1,%ecx
+  8005fc:	7f 1f                	jg     80061d <vprintfmt+0x285>
+	else if (lflag)
+  8005fe:	85 c9                	test   %ecx,%ecx
+  800600:	74 67                	je     800669 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 00                	mov    (%eax),%eax
+  800607:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060a:	89 c1                	mov    %eax,%ecx
+  80060c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80060f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8d 40 04             	lea    0x4(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061b:	eb 17                	jmp    800634 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 50 04             	mov    0x4(%eax),%edx
+  800623:	8b 00                	mov    (%eax),%eax
+  800625:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800628:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8d 40 08             	lea    0x8(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800634:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800637:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	0f 89 03 01 00 00    	jns    80074a <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	53                   	push   %ebx
+  80064b:	6a 2d                	push   $0x2d
+  80064d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80064f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800652:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800655:	f7 da                	neg    %edx
+  800657:	83 d1 00             	adc    $0x0,%ecx
+  80065a:	f7 d9                	neg    %ecx
+  80065c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80065f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800664:	e9 e1 00 00 00       	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 00                	mov    (%eax),%eax
+  80066e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800671:	89 c1                	mov    %eax,%ecx
+  800673:	c1 f9 1f             	sar    $0x1f,%ecx
+  800676:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800682:	eb b0                	jmp    800634 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800684:	83 f9 01             	cmp    $0x1,%ecx
+  800687:	7f 1e                	jg     8006a7 <vprintfmt+0x30f>
+	else if (lflag)
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	74 32                	je     8006bf <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 10                	mov    (%eax),%edx
+  800692:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800697:	8d 40 04             	lea    0x4(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006a2:	e9 a3 00 00 00       	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006af:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ba:	e9 8b 00 00 00       	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d4:	eb 74                	jmp    80074a <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8006d6:	83 f9 01             	cmp    $0x1,%ecx
+  8006d9:	7f 1b                	jg     8006f6 <vprintfmt+0x35e>
+	else if (lflag)
+  8006db:	85 c9                	test   %ecx,%ecx
+  8006dd:	74 2c                	je     80070b <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ef:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006f4:	eb 54                	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8b 10                	mov    (%eax),%edx
+  8006fb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800701:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800704:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800709:	eb 3f                	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 10                	mov    (%eax),%edx
+  800710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800715:	8d 40 04             	lea    0x4(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80071b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800720:	eb 28                	jmp    80074a <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800722:	83 ec 08             	sub    $0x8,%esp
+  800725:	53                   	push   %ebx
+  800726:	6a 30                	push   $0x30
+  800728:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80072a:	83 c4 08             	add    $0x8,%esp
+  80072d:	53                   	push   %ebx
+  80072e:	6a 78                	push   $0x78
+  800730:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80073c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80073f:	8d 40 04             	lea    0x4(%eax),%eax
+  800742:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800745:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80074a:	83 ec 0c             	sub    $0xc,%esp
+  80074d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800751:	50                   	push   %eax
+  800752:	ff 75 e0             	push   -0x20(%ebp)
+  800755:	57                   	push   %edi
+  800756:	51                   	push   %ecx
+  800757:	52                   	push   %edx
+  800758:	89 da                	mov    %ebx,%edx
+  80075a:	89 f0                	mov    %esi,%eax
+  80075c:	e8 54 fb ff ff       	call   8002b5 <printnum>
+			break;
+  800761:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800764:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800767:	e9 4a fc ff ff       	jmp    8003b6 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80076c:	83 f9 01             	cmp    $0x1,%ecx
+  80076f:	7f 1b                	jg     80078c <vprintfmt+0x3f4>
+	else if (lflag)
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	74 2c                	je     8007a1 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 10                	mov    (%eax),%edx
+  80077a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80078a:	eb be                	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 10                	mov    (%eax),%edx
+  800791:	8b 48 04             	mov    0x4(%eax),%ecx
+  800794:	8d 40 08             	lea    0x8(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80079f:	eb a9                	jmp    80074a <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007b6:	eb 92                	jmp    80074a <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	53                   	push   %ebx
+  8007bc:	6a 25                	push   $0x25
+  8007be:	ff d6                	call   *%esi
+			break;
+  8007c0:	83 c4 10             	add    $0x10,%esp
+  8007c3:	eb 9f                	jmp    800764 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	53                   	push   %ebx
+  8007c9:	6a 25                	push   $0x25
+  8007cb:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	89 f8                	mov    %edi,%eax
+  8007d2:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007d6:	74 05                	je     8007dd <vprintfmt+0x445>
+  8007d8:	83 e8 01             	sub    $0x1,%eax
+  8007db:	eb f5                	jmp    8007d2 <vprintfmt+0x43a>
+  8007dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e0:	eb 82                	jmp    800764 <vprintfmt+0x3cc>
+
+008007e2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	83 ec 18             	sub    $0x18,%esp
+  8007e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007ee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007f5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007f8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ff:	85 c0                	test   %eax,%eax
+  800801:	74 26                	je     800829 <vsnprintf+0x47>
+  800803:	85 d2                	test   %edx,%edx
+  800805:	7e 22                	jle    800829 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800807:	ff 75 14             	push   0x14(%ebp)
+  80080a:	ff 75 10             	push   0x10(%ebp)
+  80080d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800810:	50                   	push   %eax
+  800811:	68 5e 03 80 00       	push   $0x80035e
+  800816:	e8 7d fb ff ff       	call   800398 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80081b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80081e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800821:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800824:	83 c4 10             	add    $0x10,%esp
+}
+  800827:	c9                   	leave
+  800828:	c3                   	ret
+		return -E_INVAL;
+  800829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80082e:	eb f7                	jmp    800827 <vsnprintf+0x45>
+
+00800830 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800836:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800839:	50                   	push   %eax
+  80083a:	ff 75 10             	push   0x10(%ebp)
+  80083d:	ff 75 0c             	push   0xc(%ebp)
+  800840:	ff 75 08             	push   0x8(%ebp)
+  800843:	e8 9a ff ff ff       	call   8007e2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800848:	c9                   	leave
+  800849:	c3                   	ret
+
+0080084a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800850:	b8 00 00 00 00       	mov    $0x0,%eax
+  800855:	eb 03                	jmp    80085a <strlen+0x10>
+		n++;
+  800857:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80085a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80085e:	75 f7                	jne    800857 <strlen+0xd>
+	return n;
+}
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800868:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	eb 03                	jmp    800875 <strnlen+0x13>
+		n++;
+  800872:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800875:	39 d0                	cmp    %edx,%eax
+  800877:	74 08                	je     800881 <strnlen+0x1f>
+  800879:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80087d:	75 f3                	jne    800872 <strnlen+0x10>
+  80087f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800881:	89 d0                	mov    %edx,%eax
+  800883:	5d                   	pop    %ebp
+  800884:	c3                   	ret
+
+00800885 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	53                   	push   %ebx
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800898:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80089b:	83 c0 01             	add    $0x1,%eax
+  80089e:	84 d2                	test   %dl,%dl
+  8008a0:	75 f2                	jne    800894 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a2:	89 c8                	mov    %ecx,%eax
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	53                   	push   %ebx
+  8008ad:	83 ec 10             	sub    $0x10,%esp
+  8008b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b3:	53                   	push   %ebx
+  8008b4:	e8 91 ff ff ff       	call   80084a <strlen>
+  8008b9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	01 d8                	add    %ebx,%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	e8 be ff ff ff       	call   800885 <strcpy>
+	return dst;
+}
+  8008c7:	89 d8                	mov    %ebx,%eax
+  8008c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cc:	c9                   	leave
+  8008cd:	c3                   	ret
+
+008008ce <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	56                   	push   %esi
+  8008d2:	53                   	push   %ebx
+  8008d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008d9:	89 f3                	mov    %esi,%ebx
+  8008db:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008de:	89 f0                	mov    %esi,%eax
+  8008e0:	eb 0f                	jmp    8008f1 <strncpy+0x23>
+		*dst++ = *src;
+  8008e2:	83 c0 01             	add    $0x1,%eax
+  8008e5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008eb:	80 f9 01             	cmp    $0x1,%cl
+  8008ee:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f1:	39 d8                	cmp    %ebx,%eax
+  8008f3:	75 ed                	jne    8008e2 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	5b                   	pop    %ebx
+  8008f8:	5e                   	pop    %esi
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	56                   	push   %esi
+  8008ff:	53                   	push   %ebx
+  800900:	8b 75 08             	mov    0x8(%ebp),%esi
+  800903:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800906:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800909:	89 f0                	mov    %esi,%eax
+  80090b:	85 d2                	test   %edx,%edx
+  80090d:	74 21                	je     800930 <strlcpy+0x35>
+  80090f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800913:	89 f2                	mov    %esi,%edx
+  800915:	eb 09                	jmp    800920 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800917:	83 c1 01             	add    $0x1,%ecx
+  80091a:	83 c2 01             	add    $0x1,%edx
+  80091d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800920:	39 c2                	cmp    %eax,%edx
+  800922:	74 09                	je     80092d <strlcpy+0x32>
+  800924:	0f b6 19             	movzbl (%ecx),%ebx
+  800927:	84 db                	test   %bl,%bl
+  800929:	75 ec                	jne    800917 <strlcpy+0x1c>
+  80092b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80092d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800930:	29 f0                	sub    %esi,%eax
+}
+  800932:	5b                   	pop    %ebx
+  800933:	5e                   	pop    %esi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80093f:	eb 06                	jmp    800947 <strcmp+0x11>
+		p++, q++;
+  800941:	83 c1 01             	add    $0x1,%ecx
+  800944:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800947:	0f b6 01             	movzbl (%ecx),%eax
+  80094a:	84 c0                	test   %al,%al
+  80094c:	74 04                	je     800952 <strcmp+0x1c>
+  80094e:	3a 02                	cmp    (%edx),%al
+  800950:	74 ef                	je     800941 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800952:	0f b6 c0             	movzbl %al,%eax
+  800955:	0f b6 12             	movzbl (%edx),%edx
+  800958:	29 d0                	sub    %edx,%eax
+}
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	53                   	push   %ebx
+  800960:	8b 45 08             	mov    0x8(%ebp),%eax
+  800963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800966:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800969:	eb 09                	jmp    800974 <strncmp+0x18>
+		n--, p++, q++;
+  80096b:	83 ea 01             	sub    $0x1,%edx
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800974:	85 d2                	test   %edx,%edx
+  800976:	74 18                	je     800990 <strncmp+0x34>
+  800978:	0f b6 18             	movzbl (%eax),%ebx
+  80097b:	84 db                	test   %bl,%bl
+  80097d:	74 04                	je     800983 <strncmp+0x27>
+  80097f:	3a 19                	cmp    (%ecx),%bl
+  800981:	74 e8                	je     80096b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800983:	0f b6 00             	movzbl (%eax),%eax
+  800986:	0f b6 11             	movzbl (%ecx),%edx
+  800989:	29 d0                	sub    %edx,%eax
+}
+  80098b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+		return 0;
+  800990:	b8 00 00 00 00       	mov    $0x0,%eax
+  800995:	eb f4                	jmp    80098b <strncmp+0x2f>
+
+00800997 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a1:	eb 03                	jmp    8009a6 <strchr+0xf>
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	0f b6 10             	movzbl (%eax),%edx
+  8009a9:	84 d2                	test   %dl,%dl
+  8009ab:	74 06                	je     8009b3 <strchr+0x1c>
+		if (*s == c)
+  8009ad:	38 ca                	cmp    %cl,%dl
+  8009af:	75 f2                	jne    8009a3 <strchr+0xc>
+  8009b1:	eb 05                	jmp    8009b8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009c7:	38 ca                	cmp    %cl,%dl
+  8009c9:	74 09                	je     8009d4 <strfind+0x1a>
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	74 05                	je     8009d4 <strfind+0x1a>
+	for (; *s; s++)
+  8009cf:	83 c0 01             	add    $0x1,%eax
+  8009d2:	eb f0                	jmp    8009c4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	57                   	push   %edi
+  8009da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e0:	85 c9                	test   %ecx,%ecx
+  8009e2:	74 20                	je     800a04 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009e4:	89 f8                	mov    %edi,%eax
+  8009e6:	09 c8                	or     %ecx,%eax
+  8009e8:	a8 03                	test   $0x3,%al
+  8009ea:	75 12                	jne    8009fe <memset+0x28>
+		c &= 0xFF;
+  8009ec:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009f6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009f9:	fc                   	cld
+  8009fa:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009fc:	eb 06                	jmp    800a04 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a01:	fc                   	cld
+  800a02:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a04:	89 f8                	mov    %edi,%eax
+  800a06:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+
+00800a0b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	57                   	push   %edi
+  800a0f:	56                   	push   %esi
+  800a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a13:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a19:	39 c6                	cmp    %eax,%esi
+  800a1b:	73 32                	jae    800a4f <memmove+0x44>
+  800a1d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a20:	39 d0                	cmp    %edx,%eax
+  800a22:	73 2b                	jae    800a4f <memmove+0x44>
+		s += n;
+		d += n;
+  800a24:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a27:	89 d6                	mov    %edx,%esi
+  800a29:	09 fe                	or     %edi,%esi
+  800a2b:	09 ce                	or     %ecx,%esi
+  800a2d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a33:	75 0e                	jne    800a43 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a35:	83 ef 04             	sub    $0x4,%edi
+  800a38:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a3b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a3e:	fd                   	std
+  800a3f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a41:	eb 09                	jmp    800a4c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a43:	83 ef 01             	sub    $0x1,%edi
+  800a46:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a49:	fd                   	std
+  800a4a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a4c:	fc                   	cld
+  800a4d:	eb 1a                	jmp    800a69 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4f:	89 f2                	mov    %esi,%edx
+  800a51:	09 c2                	or     %eax,%edx
+  800a53:	09 ca                	or     %ecx,%edx
+  800a55:	f6 c2 03             	test   $0x3,%dl
+  800a58:	75 0a                	jne    800a64 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a5a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a5d:	89 c7                	mov    %eax,%edi
+  800a5f:	fc                   	cld
+  800a60:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a62:	eb 05                	jmp    800a69 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a64:	89 c7                	mov    %eax,%edi
+  800a66:	fc                   	cld
+  800a67:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a69:	5e                   	pop    %esi
+  800a6a:	5f                   	pop    %edi
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+
+00800a6d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a73:	ff 75 10             	push   0x10(%ebp)
+  800a76:	ff 75 0c             	push   0xc(%ebp)
+  800a79:	ff 75 08             	push   0x8(%ebp)
+  800a7c:	e8 8a ff ff ff       	call   800a0b <memmove>
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+00800a83 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+  800a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a8e:	89 c6                	mov    %eax,%esi
+  800a90:	03 75 10             	add    0x10(%ebp),%esi
+  800a93:	eb 06                	jmp    800a9b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a95:	83 c0 01             	add    $0x1,%eax
+  800a98:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a9b:	39 f0                	cmp    %esi,%eax
+  800a9d:	74 14                	je     800ab3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a9f:	0f b6 08             	movzbl (%eax),%ecx
+  800aa2:	0f b6 1a             	movzbl (%edx),%ebx
+  800aa5:	38 d9                	cmp    %bl,%cl
+  800aa7:	74 ec                	je     800a95 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aa9:	0f b6 c1             	movzbl %cl,%eax
+  800aac:	0f b6 db             	movzbl %bl,%ebx
+  800aaf:	29 d8                	sub    %ebx,%eax
+  800ab1:	eb 05                	jmp    800ab8 <memcmp+0x35>
+	}
+
+	return 0;
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab8:	5b                   	pop    %ebx
+  800ab9:	5e                   	pop    %esi
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aca:	eb 03                	jmp    800acf <memfind+0x13>
+  800acc:	83 c0 01             	add    $0x1,%eax
+  800acf:	39 d0                	cmp    %edx,%eax
+  800ad1:	73 04                	jae    800ad7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad3:	38 08                	cmp    %cl,(%eax)
+  800ad5:	75 f5                	jne    800acc <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+
+00800ad9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	57                   	push   %edi
+  800add:	56                   	push   %esi
+  800ade:	53                   	push   %ebx
+  800adf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ae5:	eb 03                	jmp    800aea <strtol+0x11>
+		s++;
+  800ae7:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aea:	0f b6 02             	movzbl (%edx),%eax
+  800aed:	3c 20                	cmp    $0x20,%al
+  800aef:	74 f6                	je     800ae7 <strtol+0xe>
+  800af1:	3c 09                	cmp    $0x9,%al
+  800af3:	74 f2                	je     800ae7 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800af5:	3c 2b                	cmp    $0x2b,%al
+  800af7:	74 2a                	je     800b23 <strtol+0x4a>
+	int neg = 0;
+  800af9:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800afe:	3c 2d                	cmp    $0x2d,%al
+  800b00:	74 2b                	je     800b2d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b02:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b08:	75 0f                	jne    800b19 <strtol+0x40>
+  800b0a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b0d:	74 28                	je     800b37 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b0f:	85 db                	test   %ebx,%ebx
+  800b11:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b16:	0f 44 d8             	cmove  %eax,%ebx
+  800b19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b21:	eb 46                	jmp    800b69 <strtol+0x90>
+		s++;
+  800b23:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b2b:	eb d5                	jmp    800b02 <strtol+0x29>
+		s++, neg = 1;
+  800b2d:	83 c2 01             	add    $0x1,%edx
+  800b30:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b35:	eb cb                	jmp    800b02 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b37:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b3b:	74 0e                	je     800b4b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b3d:	85 db                	test   %ebx,%ebx
+  800b3f:	75 d8                	jne    800b19 <strtol+0x40>
+		s++, base = 8;
+  800b41:	83 c2 01             	add    $0x1,%edx
+  800b44:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b49:	eb ce                	jmp    800b19 <strtol+0x40>
+		s += 2, base = 16;
+  800b4b:	83 c2 02             	add    $0x2,%edx
+  800b4e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b53:	eb c4                	jmp    800b19 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b55:	0f be c0             	movsbl %al,%eax
+  800b58:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b5b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b5e:	7d 3a                	jge    800b9a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b60:	83 c2 01             	add    $0x1,%edx
+  800b63:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b67:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b69:	0f b6 02             	movzbl (%edx),%eax
+  800b6c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b6f:	89 f3                	mov    %esi,%ebx
+  800b71:	80 fb 09             	cmp    $0x9,%bl
+  800b74:	76 df                	jbe    800b55 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b76:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b79:	89 f3                	mov    %esi,%ebx
+  800b7b:	80 fb 19             	cmp    $0x19,%bl
+  800b7e:	77 08                	ja     800b88 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b80:	0f be c0             	movsbl %al,%eax
+  800b83:	83 e8 57             	sub    $0x57,%eax
+  800b86:	eb d3                	jmp    800b5b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b88:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b8b:	89 f3                	mov    %esi,%ebx
+  800b8d:	80 fb 19             	cmp    $0x19,%bl
+  800b90:	77 08                	ja     800b9a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b92:	0f be c0             	movsbl %al,%eax
+  800b95:	83 e8 37             	sub    $0x37,%eax
+  800b98:	eb c1                	jmp    800b5b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b9a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b9e:	74 05                	je     800ba5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ba0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ba5:	89 c8                	mov    %ecx,%eax
+  800ba7:	f7 d8                	neg    %eax
+  800ba9:	85 ff                	test   %edi,%edi
+  800bab:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bae:	89 c8                	mov    %ecx,%eax
+  800bb0:	5b                   	pop    %ebx
+  800bb1:	5e                   	pop    %esi
+  800bb2:	5f                   	pop    %edi
+  800bb3:	5d                   	pop    %ebp
+  800bb4:	c3                   	ret
+
+00800bb5 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800bb5:	55                   	push   %ebp
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800bbb:	6a 00                	push   $0x0
+  800bbd:	6a 00                	push   $0x0
+  800bbf:	ff 75 08             	push   0x8(%ebp)
+  800bc2:	e8 12 ff ff ff       	call   800ad9 <strtol>
+}
+  800bc7:	c9                   	leave
+  800bc8:	c3                   	ret
+
+00800bc9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	57                   	push   %edi
+  800bcd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd9:	89 c3                	mov    %eax,%ebx
+  800bdb:	89 c7                	mov    %eax,%edi
+  800bdd:	6a 00                	push   $0x0
+  800bdf:	55                   	push   %ebp
+  800be0:	56                   	push   %esi
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	8d 35 eb 0b 80 00    	lea    0x800beb,%esi
+  800be9:	0f 34                	sysenter
+
+00800beb <after_sysenter_label_47>:
+  800beb:	5e                   	pop    %esi
+  800bec:	5d                   	pop    %ebp
+  800bed:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+
+00800bf4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c03:	89 d1                	mov    %edx,%ecx
+  800c05:	89 d3                	mov    %edx,%ebx
+  800c07:	89 d7                	mov    %edx,%edi
+  800c09:	6a 00                	push   $0x0
+  800c0b:	55                   	push   %ebp
+  800c0c:	56                   	push   %esi
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	8d 35 17 0c 80 00    	lea    0x800c17,%esi
+  800c15:	0f 34                	sysenter
+
+00800c17 <after_sysenter_label_128>:
+  800c17:	5e                   	pop    %esi
+  800c18:	5d                   	pop    %ebp
+  800c19:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5f                   	pop    %edi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c32:	89 cb                	mov    %ecx,%ebx
+  800c34:	89 cf                	mov    %ecx,%edi
+  800c36:	6a 00                	push   $0x0
+  800c38:	55                   	push   %ebp
+  800c39:	56                   	push   %esi
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	8d 35 44 0c 80 00    	lea    0x800c44,%esi
+  800c42:	0f 34                	sysenter
+
+00800c44 <after_sysenter_label_212>:
+  800c44:	5e                   	pop    %esi
+  800c45:	5d                   	pop    %ebp
+  800c46:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c49:	85 c0                	test   %eax,%eax
+  800c4b:	7f 07                	jg     800c54 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c50:	5b                   	pop    %ebx
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c54:	83 ec 0c             	sub    $0xc,%esp
+  800c57:	50                   	push   %eax
+  800c58:	6a 03                	push   $0x3
+  800c5a:	68 95 4b 80 00       	push   $0x804b95
+  800c5f:	6a 54                	push   $0x54
+  800c61:	68 b2 4b 80 00       	push   $0x804bb2
+  800c66:	e8 5b f5 ff ff       	call   8001c6 <_panic>
+
+00800c6b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	57                   	push   %edi
+  800c6f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c75:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c7a:	89 d1                	mov    %edx,%ecx
+  800c7c:	89 d3                	mov    %edx,%ebx
+  800c7e:	89 d7                	mov    %edx,%edi
+  800c80:	6a 00                	push   $0x0
+  800c82:	55                   	push   %ebp
+  800c83:	56                   	push   %esi
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	8d 35 8e 0c 80 00    	lea    0x800c8e,%esi
+  800c8c:	0f 34                	sysenter
+
+00800c8e <after_sysenter_label_309>:
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c93:	5b                   	pop    %ebx
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+
+00800c97 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	57                   	push   %edi
+  800c9b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca6:	89 d1                	mov    %edx,%ecx
+  800ca8:	89 d3                	mov    %edx,%ebx
+  800caa:	89 d7                	mov    %edx,%edi
+  800cac:	6a 00                	push   $0x0
+  800cae:	55                   	push   %ebp
+  800caf:	56                   	push   %esi
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	8d 35 ba 0c 80 00    	lea    0x800cba,%esi
+  800cb8:	0f 34                	sysenter
+
+00800cba <after_sysenter_label_391>:
+  800cba:	5e                   	pop    %esi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5f                   	pop    %edi
+  800cc1:	5d                   	pop    %ebp
+  800cc2:	c3                   	ret
+
+00800cc3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	57                   	push   %edi
+  800cc7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cce:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdb:	6a 00                	push   $0x0
+  800cdd:	55                   	push   %ebp
+  800cde:	56                   	push   %esi
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	8d 35 e9 0c 80 00    	lea    0x800ce9,%esi
+  800ce7:	0f 34                	sysenter
+
+00800ce9 <after_sysenter_label_479>:
+  800ce9:	5e                   	pop    %esi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	7f 07                	jg     800cf9 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf9:	83 ec 0c             	sub    $0xc,%esp
+  800cfc:	50                   	push   %eax
+  800cfd:	6a 04                	push   $0x4
+  800cff:	68 95 4b 80 00       	push   $0x804b95
+  800d04:	6a 54                	push   $0x54
+  800d06:	68 b2 4b 80 00       	push   $0x804bb2
+  800d0b:	e8 b6 f4 ff ff       	call   8001c6 <_panic>
+
+00800d10 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d23:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d26:	ff 75 18             	push   0x18(%ebp)
+  800d29:	55                   	push   %ebp
+  800d2a:	56                   	push   %esi
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	8d 35 35 0d 80 00    	lea    0x800d35,%esi
+  800d33:	0f 34                	sysenter
+
+00800d35 <after_sysenter_label_593>:
+  800d35:	5e                   	pop    %esi
+  800d36:	5d                   	pop    %ebp
+  800d37:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	7f 07                	jg     800d45 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d45:	83 ec 0c             	sub    $0xc,%esp
+  800d48:	50                   	push   %eax
+  800d49:	6a 05                	push   $0x5
+  800d4b:	68 95 4b 80 00       	push   $0x804b95
+  800d50:	6a 54                	push   $0x54
+  800d52:	68 b2 4b 80 00       	push   $0x804bb2
+  800d57:	e8 6a f4 ff ff       	call   8001c6 <_panic>
+
+00800d5c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	57                   	push   %edi
+  800d60:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d71:	89 df                	mov    %ebx,%edi
+  800d73:	6a 00                	push   $0x0
+  800d75:	55                   	push   %ebp
+  800d76:	56                   	push   %esi
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	8d 35 81 0d 80 00    	lea    0x800d81,%esi
+  800d7f:	0f 34                	sysenter
+
+00800d81 <after_sysenter_label_704>:
+  800d81:	5e                   	pop    %esi
+  800d82:	5d                   	pop    %ebp
+  800d83:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d86:	85 c0                	test   %eax,%eax
+  800d88:	7f 07                	jg     800d91 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5f                   	pop    %edi
+  800d8f:	5d                   	pop    %ebp
+  800d90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+  800d94:	50                   	push   %eax
+  800d95:	6a 06                	push   $0x6
+  800d97:	68 95 4b 80 00       	push   $0x804b95
+  800d9c:	6a 54                	push   $0x54
+  800d9e:	68 b2 4b 80 00       	push   $0x804bb2
+  800da3:	e8 1e f4 ff ff       	call   8001c6 <_panic>
+
+00800da8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	57                   	push   %edi
+  800dac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dbd:	89 df                	mov    %ebx,%edi
+  800dbf:	6a 00                	push   $0x0
+  800dc1:	55                   	push   %ebp
+  800dc2:	56                   	push   %esi
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	8d 35 cd 0d 80 00    	lea    0x800dcd,%esi
+  800dcb:	0f 34                	sysenter
+
+00800dcd <after_sysenter_label_808>:
+  800dcd:	5e                   	pop    %esi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	7f 07                	jg     800ddd <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dd9:	5b                   	pop    %ebx
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddd:	83 ec 0c             	sub    $0xc,%esp
+  800de0:	50                   	push   %eax
+  800de1:	6a 08                	push   $0x8
+  800de3:	68 95 4b 80 00       	push   $0x804b95
+  800de8:	6a 54                	push   $0x54
+  800dea:	68 b2 4b 80 00       	push   $0x804bb2
+  800def:	e8 d2 f3 ff ff       	call   8001c6 <_panic>
+
+00800df4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800df9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e04:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e09:	89 df                	mov    %ebx,%edi
+  800e0b:	6a 00                	push   $0x0
+  800e0d:	55                   	push   %ebp
+  800e0e:	56                   	push   %esi
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	8d 35 19 0e 80 00    	lea    0x800e19,%esi
+  800e17:	0f 34                	sysenter
+
+00800e19 <after_sysenter_label_912>:
+  800e19:	5e                   	pop    %esi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e1e:	85 c0                	test   %eax,%eax
+  800e20:	7f 07                	jg     800e29 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e25:	5b                   	pop    %ebx
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 09                	push   $0x9
+  800e2f:	68 95 4b 80 00       	push   $0x804b95
+  800e34:	6a 54                	push   $0x54
+  800e36:	68 b2 4b 80 00       	push   $0x804bb2
+  800e3b:	e8 86 f3 ff ff       	call   8001c6 <_panic>
+
+00800e40 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e55:	89 df                	mov    %ebx,%edi
+  800e57:	6a 00                	push   $0x0
+  800e59:	55                   	push   %ebp
+  800e5a:	56                   	push   %esi
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	8d 35 65 0e 80 00    	lea    0x800e65,%esi
+  800e63:	0f 34                	sysenter
+
+00800e65 <after_sysenter_label_1016>:
+  800e65:	5e                   	pop    %esi
+  800e66:	5d                   	pop    %ebp
+  800e67:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e6a:	85 c0                	test   %eax,%eax
+  800e6c:	7f 07                	jg     800e75 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e71:	5b                   	pop    %ebx
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+  800e78:	50                   	push   %eax
+  800e79:	6a 0a                	push   $0xa
+  800e7b:	68 95 4b 80 00       	push   $0x804b95
+  800e80:	6a 54                	push   $0x54
+  800e82:	68 b2 4b 80 00       	push   $0x804bb2
+  800e87:	e8 3a f3 ff ff       	call   8001c6 <_panic>
+
+00800e8c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea2:	6a 00                	push   $0x0
+  800ea4:	55                   	push   %ebp
+  800ea5:	56                   	push   %esi
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	8d 35 b0 0e 80 00    	lea    0x800eb0,%esi
+  800eae:	0f 34                	sysenter
+
+00800eb0 <after_sysenter_label_1126>:
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5f                   	pop    %edi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+
+00800eb9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ec6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ecb:	89 cb                	mov    %ecx,%ebx
+  800ecd:	89 cf                	mov    %ecx,%edi
+  800ecf:	6a 00                	push   $0x0
+  800ed1:	55                   	push   %ebp
+  800ed2:	56                   	push   %esi
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	8d 35 dd 0e 80 00    	lea    0x800edd,%esi
+  800edb:	0f 34                	sysenter
+
+00800edd <after_sysenter_label_1210>:
+  800edd:	5e                   	pop    %esi
+  800ede:	5d                   	pop    %ebp
+  800edf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	7f 07                	jg     800eed <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ee6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ee9:	5b                   	pop    %ebx
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+  800ef0:	50                   	push   %eax
+  800ef1:	6a 0d                	push   $0xd
+  800ef3:	68 95 4b 80 00       	push   $0x804b95
+  800ef8:	6a 54                	push   $0x54
+  800efa:	68 b2 4b 80 00       	push   $0x804bb2
+  800eff:	e8 c2 f2 ff ff       	call   8001c6 <_panic>
+
+00800f04 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	6a 00                	push   $0x0
+  800f1d:	55                   	push   %ebp
+  800f1e:	56                   	push   %esi
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	8d 35 29 0f 80 00    	lea    0x800f29,%esi
+  800f27:	0f 34                	sysenter
+
+00800f29 <after_sysenter_label_1311>:
+  800f29:	5e                   	pop    %esi
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	7f 07                	jg     800f39 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f35:	5b                   	pop    %ebx
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	50                   	push   %eax
+  800f3d:	6a 42                	push   $0x42
+  800f3f:	68 95 4b 80 00       	push   $0x804b95
+  800f44:	6a 54                	push   $0x54
+  800f46:	68 b2 4b 80 00       	push   $0x804bb2
+  800f4b:	e8 76 f2 ff ff       	call   8001c6 <_panic>
+
+00800f50 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	57                   	push   %edi
+  800f54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f5f:	89 d1                	mov    %edx,%ecx
+  800f61:	89 d3                	mov    %edx,%ebx
+  800f63:	89 d7                	mov    %edx,%edi
+  800f65:	6a 00                	push   $0x0
+  800f67:	55                   	push   %ebp
+  800f68:	56                   	push   %esi
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	8d 35 73 0f 80 00    	lea    0x800f73,%esi
+  800f71:	0f 34                	sysenter
+
+00800f73 <after_sysenter_label_1411>:
+  800f73:	5e                   	pop    %esi
+  800f74:	5d                   	pop    %ebp
+  800f75:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f78:	5b                   	pop    %ebx
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+
+00800f7c <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f91:	89 df                	mov    %ebx,%edi
+  800f93:	6a 00                	push   $0x0
+  800f95:	55                   	push   %ebp
+  800f96:	56                   	push   %esi
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	8d 35 a1 0f 80 00    	lea    0x800fa1,%esi
+  800f9f:	0f 34                	sysenter
+
+00800fa1 <after_sysenter_label_1497>:
+  800fa1:	5e                   	pop    %esi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fbf:	89 df                	mov    %ebx,%edi
+  800fc1:	6a 00                	push   $0x0
+  800fc3:	55                   	push   %ebp
+  800fc4:	56                   	push   %esi
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	8d 35 cf 0f 80 00    	lea    0x800fcf,%esi
+  800fcd:	0f 34                	sysenter
+
+00800fcf <after_sysenter_label_1583>:
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5f                   	pop    %edi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	c3                   	ret
+
+00800fd8 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	55                   	push   %ebp
+  800ff3:	56                   	push   %esi
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+
+00800ffe <after_sysenter_label_1672>:
+  800ffe:	5e                   	pop    %esi
+  800fff:	5d                   	pop    %ebp
+  801000:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801003:	5b                   	pop    %ebx
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+
+00801007 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 12 00 00 00       	mov    $0x12,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	6a 00                	push   $0x0
+  801020:	55                   	push   %ebp
+  801021:	56                   	push   %esi
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	8d 35 2c 10 80 00    	lea    0x80102c,%esi
+  80102a:	0f 34                	sysenter
+
+0080102c <after_sysenter_label_1758>:
+  80102c:	5e                   	pop    %esi
+  80102d:	5d                   	pop    %ebp
+  80102e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80103a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801042:	b8 13 00 00 00       	mov    $0x13,%eax
+  801047:	89 cb                	mov    %ecx,%ebx
+  801049:	89 cf                	mov    %ecx,%edi
+  80104b:	6a 00                	push   $0x0
+  80104d:	55                   	push   %ebp
+  80104e:	56                   	push   %esi
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	8d 35 59 10 80 00    	lea    0x801059,%esi
+  801057:	0f 34                	sysenter
+
+00801059 <after_sysenter_label_1842>:
+  801059:	5e                   	pop    %esi
+  80105a:	5d                   	pop    %ebp
+  80105b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80105e:	85 c0                	test   %eax,%eax
+  801060:	7f 07                	jg     801069 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801062:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801065:	5b                   	pop    %ebx
+  801066:	5f                   	pop    %edi
+  801067:	5d                   	pop    %ebp
+  801068:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801069:	83 ec 0c             	sub    $0xc,%esp
+  80106c:	50                   	push   %eax
+  80106d:	6a 13                	push   $0x13
+  80106f:	68 95 4b 80 00       	push   $0x804b95
+  801074:	6a 54                	push   $0x54
+  801076:	68 b2 4b 80 00       	push   $0x804bb2
+  80107b:	e8 46 f1 ff ff       	call   8001c6 <_panic>
+
+00801080 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	57                   	push   %edi
+  801084:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80108f:	89 d1                	mov    %edx,%ecx
+  801091:	89 d3                	mov    %edx,%ebx
+  801093:	89 d7                	mov    %edx,%edi
+  801095:	6a 00                	push   $0x0
+  801097:	55                   	push   %ebp
+  801098:	56                   	push   %esi
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	8d 35 a3 10 80 00    	lea    0x8010a3,%esi
+  8010a1:	0f 34                	sysenter
+
+008010a3 <after_sysenter_label_1939>:
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5f                   	pop    %edi
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	c3                   	ret
+
+008010ac <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c4:	6a 00                	push   $0x0
+  8010c6:	55                   	push   %ebp
+  8010c7:	56                   	push   %esi
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8d 35 d2 10 80 00    	lea    0x8010d2,%esi
+  8010d0:	0f 34                	sysenter
+
+008010d2 <after_sysenter_label_2028>:
+  8010d2:	5e                   	pop    %esi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8010d7:	5b                   	pop    %ebx
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010eb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010f0:	89 df                	mov    %ebx,%edi
+  8010f2:	6a 00                	push   $0x0
+  8010f4:	55                   	push   %ebp
+  8010f5:	56                   	push   %esi
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	8d 35 00 11 80 00    	lea    0x801100,%esi
+  8010fe:	0f 34                	sysenter
+
+00801100 <after_sysenter_label_2114>:
+  801100:	5e                   	pop    %esi
+  801101:	5d                   	pop    %ebp
+  801102:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801105:	5b                   	pop    %ebx
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80110e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801119:	b8 17 00 00 00       	mov    $0x17,%eax
+  80111e:	89 df                	mov    %ebx,%edi
+  801120:	6a 00                	push   $0x0
+  801122:	55                   	push   %ebp
+  801123:	56                   	push   %esi
+  801124:	89 e5                	mov    %esp,%ebp
+  801126:	8d 35 2e 11 80 00    	lea    0x80112e,%esi
+  80112c:	0f 34                	sysenter
+
+0080112e <after_sysenter_label_2200>:
+  80112e:	5e                   	pop    %esi
+  80112f:	5d                   	pop    %ebp
+  801130:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801133:	5b                   	pop    %ebx
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+
+00801137 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80113c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801147:	b8 18 00 00 00       	mov    $0x18,%eax
+  80114c:	89 df                	mov    %ebx,%edi
+  80114e:	6a 00                	push   $0x0
+  801150:	55                   	push   %ebp
+  801151:	56                   	push   %esi
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	8d 35 5c 11 80 00    	lea    0x80115c,%esi
+  80115a:	0f 34                	sysenter
+
+0080115c <after_sysenter_label_2286>:
+  80115c:	5e                   	pop    %esi
+  80115d:	5d                   	pop    %ebp
+  80115e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801161:	5b                   	pop    %ebx
+  801162:	5f                   	pop    %edi
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+
+00801165 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+  80116b:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80116e:	89 d6                	mov    %edx,%esi
+  801170:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801173:	89 cf                	mov    %ecx,%edi
+  801175:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801178:	89 fa                	mov    %edi,%edx
+  80117a:	80 ce 08             	or     $0x8,%dh
+  80117d:	f6 c5 08             	test   $0x8,%ch
+  801180:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801183:	57                   	push   %edi
+  801184:	56                   	push   %esi
+  801185:	50                   	push   %eax
+  801186:	56                   	push   %esi
+  801187:	6a 00                	push   $0x0
+  801189:	e8 82 fb ff ff       	call   800d10 <sys_page_map>
+	if (r < 0) {
+  80118e:	83 c4 20             	add    $0x20,%esp
+  801191:	85 c0                	test   %eax,%eax
+  801193:	78 27                	js     8011bc <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801195:	83 ec 0c             	sub    $0xc,%esp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	6a 00                	push   $0x0
+  80119c:	56                   	push   %esi
+  80119d:	6a 00                	push   $0x0
+  80119f:	e8 6c fb ff ff       	call   800d10 <sys_page_map>
+  8011a4:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011a6:	83 c4 20             	add    $0x20,%esp
+  8011a9:	85 c0                	test   %eax,%eax
+  8011ab:	78 24                	js     8011d1 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8011ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8011b2:	89 d8                	mov    %ebx,%eax
+  8011b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+  8011bc:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8011be:	83 ec 08             	sub    $0x8,%esp
+  8011c1:	50                   	push   %eax
+  8011c2:	68 c0 4b 80 00       	push   $0x804bc0
+  8011c7:	e8 d5 f0 ff ff       	call   8002a1 <cprintf>
+		return r;
+  8011cc:	83 c4 10             	add    $0x10,%esp
+  8011cf:	eb e1                	jmp    8011b2 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8011d1:	83 ec 08             	sub    $0x8,%esp
+  8011d4:	50                   	push   %eax
+  8011d5:	68 f0 4b 80 00       	push   $0x804bf0
+  8011da:	e8 c2 f0 ff ff       	call   8002a1 <cprintf>
+		return r;
+  8011df:	83 c4 10             	add    $0x10,%esp
+  8011e2:	eb ce                	jmp    8011b2 <duppage_cow+0x4d>
+
+008011e4 <duppage>:
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	53                   	push   %ebx
+  8011e8:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8011eb:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8011ee:	51                   	push   %ecx
+  8011ef:	52                   	push   %edx
+  8011f0:	50                   	push   %eax
+  8011f1:	52                   	push   %edx
+  8011f2:	6a 00                	push   $0x0
+  8011f4:	e8 17 fb ff ff       	call   800d10 <sys_page_map>
+	if (r < 0) {
+  8011f9:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8011fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801201:	85 c0                	test   %eax,%eax
+  801203:	78 07                	js     80120c <duppage+0x28>
+}
+  801205:	89 d8                	mov    %ebx,%eax
+  801207:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120a:	c9                   	leave
+  80120b:	c3                   	ret
+  80120c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80120e:	83 ec 08             	sub    $0x8,%esp
+  801211:	50                   	push   %eax
+  801212:	68 c0 4b 80 00       	push   $0x804bc0
+  801217:	e8 85 f0 ff ff       	call   8002a1 <cprintf>
+		return r;
+  80121c:	83 c4 10             	add    $0x10,%esp
+  80121f:	eb e4                	jmp    801205 <duppage+0x21>
+
+00801221 <cow_copy>:
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+  801226:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801228:	83 ec 04             	sub    $0x4,%esp
+  80122b:	6a 07                	push   $0x7
+  80122d:	68 00 f0 7f 00       	push   $0x7ff000
+  801232:	6a 00                	push   $0x0
+  801234:	e8 8a fa ff ff       	call   800cc3 <sys_page_alloc>
+	if (r < 0) {
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	78 58                	js     801298 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801240:	83 ec 04             	sub    $0x4,%esp
+  801243:	68 00 10 00 00       	push   $0x1000
+  801248:	56                   	push   %esi
+  801249:	68 00 f0 7f 00       	push   $0x7ff000
+  80124e:	e8 b8 f7 ff ff       	call   800a0b <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801253:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80125a:	56                   	push   %esi
+  80125b:	6a 00                	push   $0x0
+  80125d:	68 00 f0 7f 00       	push   $0x7ff000
+  801262:	6a 00                	push   $0x0
+  801264:	e8 a7 fa ff ff       	call   800d10 <sys_page_map>
+  801269:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80126b:	83 c4 20             	add    $0x20,%esp
+  80126e:	85 c0                	test   %eax,%eax
+  801270:	78 3b                	js     8012ad <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801272:	83 ec 08             	sub    $0x8,%esp
+  801275:	68 00 f0 7f 00       	push   $0x7ff000
+  80127a:	6a 00                	push   $0x0
+  80127c:	e8 db fa ff ff       	call   800d5c <sys_page_unmap>
+  801281:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801283:	83 c4 10             	add    $0x10,%esp
+  801286:	85 c0                	test   %eax,%eax
+  801288:	78 45                	js     8012cf <cow_copy+0xae>
+	return 0;
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80128f:	89 d8                	mov    %ebx,%eax
+  801291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801294:	5b                   	pop    %ebx
+  801295:	5e                   	pop    %esi
+  801296:	5d                   	pop    %ebp
+  801297:	c3                   	ret
+  801298:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80129a:	83 ec 08             	sub    $0x8,%esp
+  80129d:	50                   	push   %eax
+  80129e:	68 e0 4c 80 00       	push   $0x804ce0
+  8012a3:	e8 f9 ef ff ff       	call   8002a1 <cprintf>
+		return r;
+  8012a8:	83 c4 10             	add    $0x10,%esp
+  8012ab:	eb e2                	jmp    80128f <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8012ad:	83 ec 08             	sub    $0x8,%esp
+  8012b0:	50                   	push   %eax
+  8012b1:	68 fc 4c 80 00       	push   $0x804cfc
+  8012b6:	e8 e6 ef ff ff       	call   8002a1 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8012bb:	83 c4 08             	add    $0x8,%esp
+  8012be:	68 00 f0 7f 00       	push   $0x7ff000
+  8012c3:	6a 00                	push   $0x0
+  8012c5:	e8 92 fa ff ff       	call   800d5c <sys_page_unmap>
+		return r;
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	eb c0                	jmp    80128f <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8012cf:	83 ec 08             	sub    $0x8,%esp
+  8012d2:	50                   	push   %eax
+  8012d3:	68 18 4c 80 00       	push   $0x804c18
+  8012d8:	e8 c4 ef ff ff       	call   8002a1 <cprintf>
+		return r;
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	eb ad                	jmp    80128f <cow_copy+0x6e>
+
+008012e2 <pgfault>:
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8012ea:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8012ec:	89 d8                	mov    %ebx,%eax
+  8012ee:	c1 e8 16             	shr    $0x16,%eax
+  8012f1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8012f8:	89 de                	mov    %ebx,%esi
+  8012fa:	c1 ee 0c             	shr    $0xc,%esi
+  8012fd:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801304:	a8 07                	test   $0x7,%al
+  801306:	74 3b                	je     801343 <pgfault+0x61>
+  801308:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80130e:	74 33                	je     801343 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801310:	83 ec 0c             	sub    $0xc,%esp
+  801313:	68 00 f0 bf ee       	push   $0xeebff000
+  801318:	e8 07 28 00 00       	call   803b24 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80131d:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	f6 c4 08             	test   $0x8,%ah
+  80132a:	75 30                	jne    80135c <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+  80132f:	68 00 f0 bf ee       	push   $0xeebff000
+  801334:	e8 58 28 00 00       	call   803b91 <mutex_unlock>
+}
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80133f:	5b                   	pop    %ebx
+  801340:	5e                   	pop    %esi
+  801341:	5d                   	pop    %ebp
+  801342:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801343:	83 ec 08             	sub    $0x8,%esp
+  801346:	ff 72 28             	push   0x28(%edx)
+  801349:	51                   	push   %ecx
+  80134a:	50                   	push   %eax
+  80134b:	68 3c 4c 80 00       	push   $0x804c3c
+  801350:	6a 3f                	push   $0x3f
+  801352:	68 16 4d 80 00       	push   $0x804d16
+  801357:	e8 6a ee ff ff       	call   8001c6 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80135c:	89 d8                	mov    %ebx,%eax
+  80135e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801363:	e8 b9 fe ff ff       	call   801221 <cow_copy>
+  801368:	eb c2                	jmp    80132c <pgfault+0x4a>
+
+0080136a <cow_enable>:
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801370:	68 e2 12 80 00       	push   $0x8012e2
+  801375:	e8 2a 31 00 00       	call   8044a4 <set_pgfault_handler>
+}
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+
+0080137f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	57                   	push   %edi
+  801383:	56                   	push   %esi
+  801384:	53                   	push   %ebx
+  801385:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801388:	68 e2 12 80 00       	push   $0x8012e2
+  80138d:	e8 12 31 00 00       	call   8044a4 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801392:	b8 07 00 00 00       	mov    $0x7,%eax
+  801397:	cd 30                	int    $0x30
+  801399:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80139c:	83 c4 10             	add    $0x10,%esp
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	78 4b                	js     8013ee <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8013a3:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8013a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8013b0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013b4:	0f 85 16 01 00 00    	jne    8014d0 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013ba:	e8 ac f8 ff ff       	call   800c6b <sys_getenvid>
+  8013bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013c4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013c6:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8013cc:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8013d2:	77 32                	ja     801406 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8013d4:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8013d9:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8013db:	c1 ea 10             	shr    $0x10,%edx
+  8013de:	74 26                	je     801406 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8013e0:	c1 e2 10             	shl    $0x10,%edx
+  8013e3:	89 d1                	mov    %edx,%ecx
+  8013e5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8013ea:	29 ca                	sub    %ecx,%edx
+  8013ec:	eb 1e                	jmp    80140c <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8013ee:	83 ec 08             	sub    $0x8,%esp
+  8013f1:	89 c7                	mov    %eax,%edi
+  8013f3:	50                   	push   %eax
+  8013f4:	68 21 4d 80 00       	push   $0x804d21
+  8013f9:	e8 a3 ee ff ff       	call   8002a1 <cprintf>
+		return eid;
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	e9 6c 01 00 00       	jmp    801572 <fork+0x1f3>
+		return pthread_main_tls;
+  801406:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80140c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80140f:	c1 e0 04             	shl    $0x4,%eax
+  801412:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801417:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801419:	e8 4f 2e 00 00       	call   80426d <pthread_fork_child>
+		return eid;
+  80141e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801421:	e9 4c 01 00 00       	jmp    801572 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801426:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80142c:	89 da                	mov    %ebx,%edx
+  80142e:	89 f8                	mov    %edi,%eax
+  801430:	e8 af fd ff ff       	call   8011e4 <duppage>
+  801435:	85 c0                	test   %eax,%eax
+  801437:	79 28                	jns    801461 <fork+0xe2>
+  801439:	89 c7                	mov    %eax,%edi
+  80143b:	e9 32 01 00 00       	jmp    801572 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801440:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801446:	83 f9 05             	cmp    $0x5,%ecx
+  801449:	75 58                	jne    8014a3 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80144b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801450:	89 da                	mov    %ebx,%edx
+  801452:	89 f8                	mov    %edi,%eax
+  801454:	e8 8b fd ff ff       	call   8011e4 <duppage>
+  801459:	85 c0                	test   %eax,%eax
+  80145b:	0f 88 0f 01 00 00    	js     801570 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801461:	83 c3 01             	add    $0x1,%ebx
+  801464:	39 de                	cmp    %ebx,%esi
+  801466:	74 54                	je     8014bc <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801468:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80146f:	f6 c1 05             	test   $0x5,%cl
+  801472:	74 ed                	je     801461 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801474:	f6 c5 04             	test   $0x4,%ch
+  801477:	75 ad                	jne    801426 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801479:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80147f:	74 bf                	je     801440 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801481:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801487:	74 d8                	je     801461 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801489:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80148f:	89 da                	mov    %ebx,%edx
+  801491:	89 f8                	mov    %edi,%eax
+  801493:	e8 cd fc ff ff       	call   801165 <duppage_cow>
+  801498:	85 c0                	test   %eax,%eax
+  80149a:	79 c5                	jns    801461 <fork+0xe2>
+  80149c:	89 c7                	mov    %eax,%edi
+  80149e:	e9 cf 00 00 00       	jmp    801572 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014a3:	68 6c 4c 80 00       	push   $0x804c6c
+  8014a8:	68 31 4d 80 00       	push   $0x804d31
+  8014ad:	68 c6 00 00 00       	push   $0xc6
+  8014b2:	68 16 4d 80 00       	push   $0x804d16
+  8014b7:	e8 0a ed ff ff       	call   8001c6 <_panic>
+  8014bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8014bf:	83 c1 01             	add    $0x1,%ecx
+  8014c2:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8014c8:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8014ce:	74 18                	je     8014e8 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8014d0:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8014d7:	a8 07                	test   $0x7,%al
+  8014d9:	74 e4                	je     8014bf <fork+0x140>
+  8014db:	89 cb                	mov    %ecx,%ebx
+  8014dd:	c1 e3 0a             	shl    $0xa,%ebx
+  8014e0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8014e3:	e9 7c ff ff ff       	jmp    801464 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8014e8:	83 ec 04             	sub    $0x4,%esp
+  8014eb:	6a 07                	push   $0x7
+  8014ed:	68 00 f0 bf ee       	push   $0xeebff000
+  8014f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8014f5:	e8 c9 f7 ff ff       	call   800cc3 <sys_page_alloc>
+  8014fa:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8014fc:	83 c4 10             	add    $0x10,%esp
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	78 34                	js     801537 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801503:	83 ec 08             	sub    $0x8,%esp
+  801506:	68 e2 44 80 00       	push   $0x8044e2
+  80150b:	ff 75 e4             	push   -0x1c(%ebp)
+  80150e:	e8 2d f9 ff ff       	call   800e40 <sys_env_set_pgfault_upcall>
+  801513:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	85 c0                	test   %eax,%eax
+  80151a:	78 2e                	js     80154a <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	6a 02                	push   $0x2
+  801521:	ff 75 e4             	push   -0x1c(%ebp)
+  801524:	e8 7f f8 ff ff       	call   800da8 <sys_env_set_status>
+  801529:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80152b:	83 c4 10             	add    $0x10,%esp
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	78 2b                	js     80155d <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801532:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801535:	eb 3b                	jmp    801572 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801537:	83 ec 08             	sub    $0x8,%esp
+  80153a:	50                   	push   %eax
+  80153b:	68 94 4c 80 00       	push   $0x804c94
+  801540:	e8 5c ed ff ff       	call   8002a1 <cprintf>
+		return r;
+  801545:	83 c4 10             	add    $0x10,%esp
+  801548:	eb 28                	jmp    801572 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	50                   	push   %eax
+  80154e:	68 bc 4c 80 00       	push   $0x804cbc
+  801553:	e8 49 ed ff ff       	call   8002a1 <cprintf>
+		return r;
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	eb 15                	jmp    801572 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	50                   	push   %eax
+  801561:	68 46 4d 80 00       	push   $0x804d46
+  801566:	e8 36 ed ff ff       	call   8002a1 <cprintf>
+		return r;
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	eb 02                	jmp    801572 <fork+0x1f3>
+  801570:	89 c7                	mov    %eax,%edi
+}
+  801572:	89 f8                	mov    %edi,%eax
+  801574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801577:	5b                   	pop    %ebx
+  801578:	5e                   	pop    %esi
+  801579:	5f                   	pop    %edi
+  80157a:	5d                   	pop    %ebp
+  80157b:	c3                   	ret
+
+0080157c <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80157c:	55                   	push   %ebp
+  80157d:	89 e5                	mov    %esp,%ebp
+  80157f:	57                   	push   %edi
+  801580:	56                   	push   %esi
+  801581:	53                   	push   %ebx
+  801582:	83 ec 2c             	sub    $0x2c,%esp
+  801585:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801587:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80158d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801592:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801598:	77 0a                	ja     8015a4 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80159a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80159f:	29 c3                	sub    %eax,%ebx
+  8015a1:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8015a4:	83 ec 0c             	sub    $0xc,%esp
+  8015a7:	68 e2 12 80 00       	push   $0x8012e2
+  8015ac:	e8 f3 2e 00 00       	call   8044a4 <set_pgfault_handler>
+  8015b1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015b6:	cd 30                	int    $0x30
+  8015b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 30                	js     8015f2 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015c2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8015c6:	74 42                	je     80160a <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8015c8:	c1 e3 10             	shl    $0x10,%ebx
+  8015cb:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8015d0:	29 d8                	sub    %ebx,%eax
+  8015d2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8015d5:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8015da:	29 d8                	sub    %ebx,%eax
+  8015dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8015df:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8015e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e9:	89 f7                	mov    %esi,%edi
+  8015eb:	89 d6                	mov    %edx,%esi
+  8015ed:	e9 2c 01 00 00       	jmp    80171e <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8015f2:	83 ec 08             	sub    $0x8,%esp
+  8015f5:	89 c7                	mov    %eax,%edi
+  8015f7:	50                   	push   %eax
+  8015f8:	68 21 4d 80 00       	push   $0x804d21
+  8015fd:	e8 9f ec ff ff       	call   8002a1 <cprintf>
+		return eid;
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	e9 d5 00 00 00       	jmp    8016df <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80160a:	e8 5c f6 ff ff       	call   800c6b <sys_getenvid>
+  80160f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801614:	89 c2                	mov    %eax,%edx
+  801616:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801618:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80161e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801623:	77 18                	ja     80163d <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801625:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80162a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80162c:	c1 e8 10             	shr    $0x10,%eax
+  80162f:	74 0c                	je     80163d <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801631:	c1 e0 10             	shl    $0x10,%eax
+  801634:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801639:	29 c1                	sub    %eax,%ecx
+  80163b:	eb 06                	jmp    801643 <sfork+0xc7>
+		return pthread_main_tls;
+  80163d:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  801643:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801646:	c1 e0 04             	shl    $0x4,%eax
+  801649:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80164e:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  801650:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801653:	e9 87 00 00 00       	jmp    8016df <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801658:	f6 c5 04             	test   $0x4,%ch
+  80165b:	74 6c                	je     8016c9 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80165d:	89 ca                	mov    %ecx,%edx
+  80165f:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801665:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80166b:	74 7c                	je     8016e9 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80166d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801673:	89 da                	mov    %ebx,%edx
+  801675:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801678:	e8 67 fb ff ff       	call   8011e4 <duppage>
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	0f 88 4f 01 00 00    	js     8017d4 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801685:	83 c3 01             	add    $0x1,%ebx
+  801688:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80168b:	74 7a                	je     801707 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80168d:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80168f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801696:	f6 c1 01             	test   $0x1,%cl
+  801699:	74 ea                	je     801685 <sfork+0x109>
+  80169b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016a1:	74 e2                	je     801685 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8016a3:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8016a9:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8016ac:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8016b1:	76 a5                	jbe    801658 <sfork+0xdc>
+  8016b3:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8016b9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8016bc:	39 fa                	cmp    %edi,%edx
+  8016be:	73 9d                	jae    80165d <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016c0:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8016c3:	39 fa                	cmp    %edi,%edx
+  8016c5:	72 96                	jb     80165d <sfork+0xe1>
+  8016c7:	eb 8f                	jmp    801658 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016c9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016cf:	89 da                	mov    %ebx,%edx
+  8016d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d4:	e8 8c fa ff ff       	call   801165 <duppage_cow>
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	79 a8                	jns    801685 <sfork+0x109>
+  8016dd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8016df:	89 f8                	mov    %edi,%eax
+  8016e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8016e9:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8016ee:	e8 2e fb ff ff       	call   801221 <cow_copy>
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	0f 88 d2 00 00 00    	js     8017cd <sfork+0x251>
+				pte = uvpt[pn];
+  8016fb:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801702:	e9 66 ff ff ff       	jmp    80166d <sfork+0xf1>
+  801707:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80170a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80170d:	83 c6 01             	add    $0x1,%esi
+  801710:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801716:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80171c:	74 1b                	je     801739 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80171e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801725:	a8 01                	test   $0x1,%al
+  801727:	74 e4                	je     80170d <sfork+0x191>
+  801729:	89 f3                	mov    %esi,%ebx
+  80172b:	c1 e3 0a             	shl    $0xa,%ebx
+  80172e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801731:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801734:	e9 4f ff ff ff       	jmp    801688 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801739:	83 ec 04             	sub    $0x4,%esp
+  80173c:	6a 07                	push   $0x7
+  80173e:	68 00 f0 bf ee       	push   $0xeebff000
+  801743:	ff 75 e0             	push   -0x20(%ebp)
+  801746:	e8 78 f5 ff ff       	call   800cc3 <sys_page_alloc>
+  80174b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80174d:	83 c4 10             	add    $0x10,%esp
+  801750:	85 c0                	test   %eax,%eax
+  801752:	78 37                	js     80178b <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801754:	83 ec 08             	sub    $0x8,%esp
+  801757:	68 e2 44 80 00       	push   $0x8044e2
+  80175c:	ff 75 e0             	push   -0x20(%ebp)
+  80175f:	e8 dc f6 ff ff       	call   800e40 <sys_env_set_pgfault_upcall>
+  801764:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	78 34                	js     8017a1 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80176d:	83 ec 08             	sub    $0x8,%esp
+  801770:	6a 02                	push   $0x2
+  801772:	ff 75 e0             	push   -0x20(%ebp)
+  801775:	e8 2e f6 ff ff       	call   800da8 <sys_env_set_status>
+  80177a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 34                	js     8017b7 <sfork+0x23b>
+	return eid;
+  801783:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801786:	e9 54 ff ff ff       	jmp    8016df <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80178b:	83 ec 08             	sub    $0x8,%esp
+  80178e:	50                   	push   %eax
+  80178f:	68 94 4c 80 00       	push   $0x804c94
+  801794:	e8 08 eb ff ff       	call   8002a1 <cprintf>
+		return r;
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	e9 3e ff ff ff       	jmp    8016df <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8017a1:	83 ec 08             	sub    $0x8,%esp
+  8017a4:	50                   	push   %eax
+  8017a5:	68 bc 4c 80 00       	push   $0x804cbc
+  8017aa:	e8 f2 ea ff ff       	call   8002a1 <cprintf>
+		return r;
+  8017af:	83 c4 10             	add    $0x10,%esp
+  8017b2:	e9 28 ff ff ff       	jmp    8016df <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8017b7:	83 ec 08             	sub    $0x8,%esp
+  8017ba:	50                   	push   %eax
+  8017bb:	68 46 4d 80 00       	push   $0x804d46
+  8017c0:	e8 dc ea ff ff       	call   8002a1 <cprintf>
+		return r;
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	e9 12 ff ff ff       	jmp    8016df <sfork+0x163>
+  8017cd:	89 c7                	mov    %eax,%edi
+  8017cf:	e9 0b ff ff ff       	jmp    8016df <sfork+0x163>
+  8017d4:	89 c7                	mov    %eax,%edi
+  8017d6:	e9 04 ff ff ff       	jmp    8016df <sfork+0x163>
+
+008017db <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	57                   	push   %edi
+  8017df:	56                   	push   %esi
+  8017e0:	53                   	push   %ebx
+  8017e1:	83 ec 18             	sub    $0x18,%esp
+  8017e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8017ed:	85 c0                	test   %eax,%eax
+  8017ef:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8017f4:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8017f7:	50                   	push   %eax
+  8017f8:	e8 bc f6 ff ff       	call   800eb9 <sys_ipc_recv>
+	if (r < 0) {
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 2b                	js     80182f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  801804:	85 ff                	test   %edi,%edi
+  801806:	74 55                	je     80185d <ipc_recv+0x82>
+  801808:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80180a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801810:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801815:	77 39                	ja     801850 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801817:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80181c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80181e:	c1 e8 10             	shr    $0x10,%eax
+  801821:	74 2d                	je     801850 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801823:	c1 e0 10             	shl    $0x10,%eax
+  801826:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80182b:	29 c2                	sub    %eax,%edx
+  80182d:	eb 27                	jmp    801856 <ipc_recv+0x7b>
+  80182f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801831:	83 ec 08             	sub    $0x8,%esp
+  801834:	50                   	push   %eax
+  801835:	68 64 4d 80 00       	push   $0x804d64
+  80183a:	e8 62 ea ff ff       	call   8002a1 <cprintf>
+		*from_env_store = 0;
+  80183f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801845:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	eb 77                	jmp    8018c7 <ipc_recv+0xec>
+		return pthread_main_tls;
+  801850:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801856:	8b 02                	mov    (%edx),%eax
+  801858:	8b 40 78             	mov    0x78(%eax),%eax
+  80185b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80185d:	85 f6                	test   %esi,%esi
+  80185f:	74 34                	je     801895 <ipc_recv+0xba>
+  801861:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801863:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801869:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80186e:	77 18                	ja     801888 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801870:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801875:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801877:	c1 e8 10             	shr    $0x10,%eax
+  80187a:	74 0c                	je     801888 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80187c:	c1 e0 10             	shl    $0x10,%eax
+  80187f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801884:	29 c2                	sub    %eax,%edx
+  801886:	eb 06                	jmp    80188e <ipc_recv+0xb3>
+		return pthread_main_tls;
+  801888:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80188e:	8b 02                	mov    (%edx),%eax
+  801890:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801893:	89 06                	mov    %eax,(%esi)
+  801895:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801897:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80189d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018a2:	77 18                	ja     8018bc <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018a4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018a9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018ab:	c1 e8 10             	shr    $0x10,%eax
+  8018ae:	74 0c                	je     8018bc <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018b0:	c1 e0 10             	shl    $0x10,%eax
+  8018b3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018b8:	29 c2                	sub    %eax,%edx
+  8018ba:	eb 06                	jmp    8018c2 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8018bc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8018c2:	8b 02                	mov    (%edx),%eax
+  8018c4:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5f                   	pop    %edi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+
+008018d1 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	57                   	push   %edi
+  8018d5:	56                   	push   %esi
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 0c             	sub    $0xc,%esp
+  8018da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8018e3:	85 db                	test   %ebx,%ebx
+  8018e5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8018ea:	0f 44 d8             	cmove  %eax,%ebx
+  8018ed:	eb 05                	jmp    8018f4 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8018ef:	e8 a3 f3 ff ff       	call   800c97 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8018f4:	57                   	push   %edi
+  8018f5:	53                   	push   %ebx
+  8018f6:	ff 75 0c             	push   0xc(%ebp)
+  8018f9:	56                   	push   %esi
+  8018fa:	e8 8d f5 ff ff       	call   800e8c <sys_ipc_try_send>
+		if (r == 0) {
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	74 19                	je     80191f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  801906:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801909:	74 e4                	je     8018ef <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80190b:	83 ec 0c             	sub    $0xc,%esp
+  80190e:	50                   	push   %eax
+  80190f:	57                   	push   %edi
+  801910:	53                   	push   %ebx
+  801911:	56                   	push   %esi
+  801912:	68 80 4d 80 00       	push   $0x804d80
+  801917:	e8 85 e9 ff ff       	call   8002a1 <cprintf>
+			return;
+  80191c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80191f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801922:	5b                   	pop    %ebx
+  801923:	5e                   	pop    %esi
+  801924:	5f                   	pop    %edi
+  801925:	5d                   	pop    %ebp
+  801926:	c3                   	ret
+
+00801927 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80192d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801932:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801935:	c1 e0 04             	shl    $0x4,%eax
+  801938:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80193d:	8b 40 50             	mov    0x50(%eax),%eax
+  801940:	39 c8                	cmp    %ecx,%eax
+  801942:	74 12                	je     801956 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801944:	83 c2 01             	add    $0x1,%edx
+  801947:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80194d:	75 e3                	jne    801932 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80194f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801954:	eb 0e                	jmp    801964 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801956:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801959:	c1 e0 04             	shl    $0x4,%eax
+  80195c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801961:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801964:	5d                   	pop    %ebp
+  801965:	c3                   	ret
+
+00801966 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801971:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801974:	5d                   	pop    %ebp
+  801975:	c3                   	ret
+
+00801976 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801981:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801986:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+
+0080198d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801990:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801995:	eb 02                	jmp    801999 <fd_alloc+0xc>
+  801997:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801999:	89 c2                	mov    %eax,%edx
+  80199b:	c1 ea 16             	shr    $0x16,%edx
+  80199e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019a5:	f6 c2 01             	test   $0x1,%dl
+  8019a8:	74 2b                	je     8019d5 <fd_alloc+0x48>
+  8019aa:	89 c2                	mov    %eax,%edx
+  8019ac:	c1 ea 0c             	shr    $0xc,%edx
+  8019af:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019b6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8019bc:	f6 c1 01             	test   $0x1,%cl
+  8019bf:	74 14                	je     8019d5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8019c1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8019c7:	75 ce                	jne    801997 <fd_alloc+0xa>
+  8019c9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019ce:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8019d3:	eb 05                	jmp    8019da <fd_alloc+0x4d>
+			return 0;
+  8019d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8019da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019dd:	89 02                	mov    %eax,(%edx)
+}
+  8019df:	89 c8                	mov    %ecx,%eax
+  8019e1:	5d                   	pop    %ebp
+  8019e2:	c3                   	ret
+
+008019e3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019e9:	83 f8 1f             	cmp    $0x1f,%eax
+  8019ec:	77 30                	ja     801a1e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019ee:	c1 e0 0c             	shl    $0xc,%eax
+  8019f1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019f6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019fc:	f6 c2 01             	test   $0x1,%dl
+  8019ff:	74 24                	je     801a25 <fd_lookup+0x42>
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 0c             	shr    $0xc,%edx
+  801a06:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a0d:	f6 c2 01             	test   $0x1,%dl
+  801a10:	74 1a                	je     801a2c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a15:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a1c:	5d                   	pop    %ebp
+  801a1d:	c3                   	ret
+		return -E_INVAL;
+  801a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a23:	eb f7                	jmp    801a1c <fd_lookup+0x39>
+		return -E_INVAL;
+  801a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2a:	eb f0                	jmp    801a1c <fd_lookup+0x39>
+  801a2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a31:	eb e9                	jmp    801a1c <fd_lookup+0x39>
+
+00801a33 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a33:	55                   	push   %ebp
+  801a34:	89 e5                	mov    %esp,%ebp
+  801a36:	53                   	push   %ebx
+  801a37:	83 ec 04             	sub    $0x4,%esp
+  801a3a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	eb 03                	jmp    801a47 <dev_lookup+0x14>
+  801a44:	83 c0 01             	add    $0x1,%eax
+  801a47:	8b 1c 85 34 4e 80 00 	mov    0x804e34(,%eax,4),%ebx
+  801a4e:	85 db                	test   %ebx,%ebx
+  801a50:	74 0b                	je     801a5d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a52:	39 13                	cmp    %edx,(%ebx)
+  801a54:	75 ee                	jne    801a44 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5b:	eb 49                	jmp    801aa6 <dev_lookup+0x73>
+  801a5d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a5f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801a65:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a6a:	77 18                	ja     801a84 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a6c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a71:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801a73:	c1 e8 10             	shr    $0x10,%eax
+  801a76:	74 0c                	je     801a84 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a78:	c1 e0 10             	shl    $0x10,%eax
+  801a7b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801a80:	29 c1                	sub    %eax,%ecx
+  801a82:	eb 06                	jmp    801a8a <dev_lookup+0x57>
+		return pthread_main_tls;
+  801a84:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a8a:	8b 01                	mov    (%ecx),%eax
+  801a8c:	8b 40 48             	mov    0x48(%eax),%eax
+  801a8f:	83 ec 04             	sub    $0x4,%esp
+  801a92:	52                   	push   %edx
+  801a93:	50                   	push   %eax
+  801a94:	68 b8 4d 80 00       	push   $0x804db8
+  801a99:	e8 03 e8 ff ff       	call   8002a1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801aa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aa9:	89 1a                	mov    %ebx,(%edx)
+}
+  801aab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+00801ab0 <fd_close>:
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	57                   	push   %edi
+  801ab4:	56                   	push   %esi
+  801ab5:	53                   	push   %ebx
+  801ab6:	83 ec 24             	sub    $0x24,%esp
+  801ab9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801abf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ac3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ac9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801acc:	50                   	push   %eax
+  801acd:	e8 11 ff ff ff       	call   8019e3 <fd_lookup>
+  801ad2:	89 c3                	mov    %eax,%ebx
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 05                	js     801ae0 <fd_close+0x30>
+	    || fd != fd2)
+  801adb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ade:	74 16                	je     801af6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ae0:	89 f8                	mov    %edi,%eax
+  801ae2:	84 c0                	test   %al,%al
+  801ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801aec:	89 d8                	mov    %ebx,%eax
+  801aee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af1:	5b                   	pop    %ebx
+  801af2:	5e                   	pop    %esi
+  801af3:	5f                   	pop    %edi
+  801af4:	5d                   	pop    %ebp
+  801af5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801af6:	83 ec 08             	sub    $0x8,%esp
+  801af9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801afc:	50                   	push   %eax
+  801afd:	ff 36                	push   (%esi)
+  801aff:	e8 2f ff ff ff       	call   801a33 <dev_lookup>
+  801b04:	89 c3                	mov    %eax,%ebx
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	78 1a                	js     801b27 <fd_close+0x77>
+		if (dev->dev_close)
+  801b0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b10:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b13:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b18:	85 c0                	test   %eax,%eax
+  801b1a:	74 0b                	je     801b27 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b1c:	83 ec 0c             	sub    $0xc,%esp
+  801b1f:	56                   	push   %esi
+  801b20:	ff d0                	call   *%eax
+  801b22:	89 c3                	mov    %eax,%ebx
+  801b24:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b27:	83 ec 08             	sub    $0x8,%esp
+  801b2a:	56                   	push   %esi
+  801b2b:	6a 00                	push   $0x0
+  801b2d:	e8 2a f2 ff ff       	call   800d5c <sys_page_unmap>
+	return r;
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	eb b5                	jmp    801aec <fd_close+0x3c>
+
+00801b37 <close>:
+
+int
+close(int fdnum)
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b40:	50                   	push   %eax
+  801b41:	ff 75 08             	push   0x8(%ebp)
+  801b44:	e8 9a fe ff ff       	call   8019e3 <fd_lookup>
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	79 02                	jns    801b52 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b50:	c9                   	leave
+  801b51:	c3                   	ret
+		return fd_close(fd, 1);
+  801b52:	83 ec 08             	sub    $0x8,%esp
+  801b55:	6a 01                	push   $0x1
+  801b57:	ff 75 f4             	push   -0xc(%ebp)
+  801b5a:	e8 51 ff ff ff       	call   801ab0 <fd_close>
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	eb ec                	jmp    801b50 <close+0x19>
+
+00801b64 <close_all>:
+
+void
+close_all(void)
+{
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	53                   	push   %ebx
+  801b68:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b70:	83 ec 0c             	sub    $0xc,%esp
+  801b73:	53                   	push   %ebx
+  801b74:	e8 be ff ff ff       	call   801b37 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b79:	83 c3 01             	add    $0x1,%ebx
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	83 fb 20             	cmp    $0x20,%ebx
+  801b82:	75 ec                	jne    801b70 <close_all+0xc>
+}
+  801b84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+
+00801b89 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b89:	55                   	push   %ebp
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	57                   	push   %edi
+  801b8d:	56                   	push   %esi
+  801b8e:	53                   	push   %ebx
+  801b8f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b95:	50                   	push   %eax
+  801b96:	ff 75 08             	push   0x8(%ebp)
+  801b99:	e8 45 fe ff ff       	call   8019e3 <fd_lookup>
+  801b9e:	89 c3                	mov    %eax,%ebx
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	78 7f                	js     801c26 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ba7:	83 ec 0c             	sub    $0xc,%esp
+  801baa:	ff 75 0c             	push   0xc(%ebp)
+  801bad:	e8 85 ff ff ff       	call   801b37 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bb2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bb5:	c1 e6 0c             	shl    $0xc,%esi
+  801bb8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801bbe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bc1:	89 3c 24             	mov    %edi,(%esp)
+  801bc4:	e8 ad fd ff ff       	call   801976 <fd2data>
+  801bc9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bcb:	89 34 24             	mov    %esi,(%esp)
+  801bce:	e8 a3 fd ff ff       	call   801976 <fd2data>
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801bd9:	89 d8                	mov    %ebx,%eax
+  801bdb:	c1 e8 16             	shr    $0x16,%eax
+  801bde:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801be5:	a8 01                	test   $0x1,%al
+  801be7:	74 11                	je     801bfa <dup+0x71>
+  801be9:	89 d8                	mov    %ebx,%eax
+  801beb:	c1 e8 0c             	shr    $0xc,%eax
+  801bee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bf5:	f6 c2 01             	test   $0x1,%dl
+  801bf8:	75 36                	jne    801c30 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bfa:	89 f8                	mov    %edi,%eax
+  801bfc:	c1 e8 0c             	shr    $0xc,%eax
+  801bff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c06:	83 ec 0c             	sub    $0xc,%esp
+  801c09:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c0e:	50                   	push   %eax
+  801c0f:	56                   	push   %esi
+  801c10:	6a 00                	push   $0x0
+  801c12:	57                   	push   %edi
+  801c13:	6a 00                	push   $0x0
+  801c15:	e8 f6 f0 ff ff       	call   800d10 <sys_page_map>
+  801c1a:	89 c3                	mov    %eax,%ebx
+  801c1c:	83 c4 20             	add    $0x20,%esp
+  801c1f:	85 c0                	test   %eax,%eax
+  801c21:	78 33                	js     801c56 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c26:	89 d8                	mov    %ebx,%eax
+  801c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c2b:	5b                   	pop    %ebx
+  801c2c:	5e                   	pop    %esi
+  801c2d:	5f                   	pop    %edi
+  801c2e:	5d                   	pop    %ebp
+  801c2f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+  801c3a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c3f:	50                   	push   %eax
+  801c40:	ff 75 d4             	push   -0x2c(%ebp)
+  801c43:	6a 00                	push   $0x0
+  801c45:	53                   	push   %ebx
+  801c46:	6a 00                	push   $0x0
+  801c48:	e8 c3 f0 ff ff       	call   800d10 <sys_page_map>
+  801c4d:	89 c3                	mov    %eax,%ebx
+  801c4f:	83 c4 20             	add    $0x20,%esp
+  801c52:	85 c0                	test   %eax,%eax
+  801c54:	79 a4                	jns    801bfa <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c56:	83 ec 08             	sub    $0x8,%esp
+  801c59:	56                   	push   %esi
+  801c5a:	6a 00                	push   $0x0
+  801c5c:	e8 fb f0 ff ff       	call   800d5c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c61:	83 c4 08             	add    $0x8,%esp
+  801c64:	ff 75 d4             	push   -0x2c(%ebp)
+  801c67:	6a 00                	push   $0x0
+  801c69:	e8 ee f0 ff ff       	call   800d5c <sys_page_unmap>
+	return r;
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	eb b3                	jmp    801c26 <dup+0x9d>
+
+00801c73 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	56                   	push   %esi
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 18             	sub    $0x18,%esp
+  801c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c7e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c81:	50                   	push   %eax
+  801c82:	53                   	push   %ebx
+  801c83:	e8 5b fd ff ff       	call   8019e3 <fd_lookup>
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 3c                	js     801ccb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c92:	83 ec 08             	sub    $0x8,%esp
+  801c95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c98:	50                   	push   %eax
+  801c99:	ff 36                	push   (%esi)
+  801c9b:	e8 93 fd ff ff       	call   801a33 <dev_lookup>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 24                	js     801ccb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ca7:	8b 46 08             	mov    0x8(%esi),%eax
+  801caa:	83 e0 03             	and    $0x3,%eax
+  801cad:	83 f8 01             	cmp    $0x1,%eax
+  801cb0:	74 20                	je     801cd2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb5:	8b 40 08             	mov    0x8(%eax),%eax
+  801cb8:	85 c0                	test   %eax,%eax
+  801cba:	74 61                	je     801d1d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801cbc:	83 ec 04             	sub    $0x4,%esp
+  801cbf:	ff 75 10             	push   0x10(%ebp)
+  801cc2:	ff 75 0c             	push   0xc(%ebp)
+  801cc5:	56                   	push   %esi
+  801cc6:	ff d0                	call   *%eax
+  801cc8:	83 c4 10             	add    $0x10,%esp
+}
+  801ccb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cce:	5b                   	pop    %ebx
+  801ccf:	5e                   	pop    %esi
+  801cd0:	5d                   	pop    %ebp
+  801cd1:	c3                   	ret
+  801cd2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801cd4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801cda:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cdf:	77 18                	ja     801cf9 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ce1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ce6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ce8:	c1 e8 10             	shr    $0x10,%eax
+  801ceb:	74 0c                	je     801cf9 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801ced:	c1 e0 10             	shl    $0x10,%eax
+  801cf0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801cf5:	29 c2                	sub    %eax,%edx
+  801cf7:	eb 06                	jmp    801cff <read+0x8c>
+		return pthread_main_tls;
+  801cf9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cff:	8b 02                	mov    (%edx),%eax
+  801d01:	8b 40 48             	mov    0x48(%eax),%eax
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	50                   	push   %eax
+  801d09:	68 f9 4d 80 00       	push   $0x804df9
+  801d0e:	e8 8e e5 ff ff       	call   8002a1 <cprintf>
+		return -E_INVAL;
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1b:	eb ae                	jmp    801ccb <read+0x58>
+		return -E_NOT_SUPP;
+  801d1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d22:	eb a7                	jmp    801ccb <read+0x58>
+
+00801d24 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	57                   	push   %edi
+  801d28:	56                   	push   %esi
+  801d29:	53                   	push   %ebx
+  801d2a:	83 ec 0c             	sub    $0xc,%esp
+  801d2d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d30:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d38:	eb 02                	jmp    801d3c <readn+0x18>
+  801d3a:	01 c3                	add    %eax,%ebx
+  801d3c:	39 f3                	cmp    %esi,%ebx
+  801d3e:	73 21                	jae    801d61 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d40:	83 ec 04             	sub    $0x4,%esp
+  801d43:	89 f0                	mov    %esi,%eax
+  801d45:	29 d8                	sub    %ebx,%eax
+  801d47:	50                   	push   %eax
+  801d48:	89 d8                	mov    %ebx,%eax
+  801d4a:	03 45 0c             	add    0xc(%ebp),%eax
+  801d4d:	50                   	push   %eax
+  801d4e:	57                   	push   %edi
+  801d4f:	e8 1f ff ff ff       	call   801c73 <read>
+		if (m < 0)
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 04                	js     801d5f <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d5b:	75 dd                	jne    801d3a <readn+0x16>
+  801d5d:	eb 02                	jmp    801d61 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d5f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d61:	89 d8                	mov    %ebx,%eax
+  801d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d66:	5b                   	pop    %ebx
+  801d67:	5e                   	pop    %esi
+  801d68:	5f                   	pop    %edi
+  801d69:	5d                   	pop    %ebp
+  801d6a:	c3                   	ret
+
+00801d6b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	56                   	push   %esi
+  801d6f:	53                   	push   %ebx
+  801d70:	83 ec 18             	sub    $0x18,%esp
+  801d73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d79:	50                   	push   %eax
+  801d7a:	53                   	push   %ebx
+  801d7b:	e8 63 fc ff ff       	call   8019e3 <fd_lookup>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 37                	js     801dbe <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d87:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+  801d8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 36                	push   (%esi)
+  801d93:	e8 9b fc ff ff       	call   801a33 <dev_lookup>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 1f                	js     801dbe <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801da3:	74 20                	je     801dc5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801da5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	74 61                	je     801e10 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801daf:	83 ec 04             	sub    $0x4,%esp
+  801db2:	ff 75 10             	push   0x10(%ebp)
+  801db5:	ff 75 0c             	push   0xc(%ebp)
+  801db8:	56                   	push   %esi
+  801db9:	ff d0                	call   *%eax
+  801dbb:	83 c4 10             	add    $0x10,%esp
+}
+  801dbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc1:	5b                   	pop    %ebx
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5d                   	pop    %ebp
+  801dc4:	c3                   	ret
+  801dc5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801dc7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801dcd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801dd2:	77 18                	ja     801dec <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801dd4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801dd9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ddb:	c1 e8 10             	shr    $0x10,%eax
+  801dde:	74 0c                	je     801dec <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801de0:	c1 e0 10             	shl    $0x10,%eax
+  801de3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801de8:	29 c2                	sub    %eax,%edx
+  801dea:	eb 06                	jmp    801df2 <write+0x87>
+		return pthread_main_tls;
+  801dec:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df2:	8b 02                	mov    (%edx),%eax
+  801df4:	8b 40 48             	mov    0x48(%eax),%eax
+  801df7:	83 ec 04             	sub    $0x4,%esp
+  801dfa:	53                   	push   %ebx
+  801dfb:	50                   	push   %eax
+  801dfc:	68 15 4e 80 00       	push   $0x804e15
+  801e01:	e8 9b e4 ff ff       	call   8002a1 <cprintf>
+		return -E_INVAL;
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0e:	eb ae                	jmp    801dbe <write+0x53>
+		return -E_NOT_SUPP;
+  801e10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e15:	eb a7                	jmp    801dbe <write+0x53>
+
+00801e17 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e20:	50                   	push   %eax
+  801e21:	ff 75 08             	push   0x8(%ebp)
+  801e24:	e8 ba fb ff ff       	call   8019e3 <fd_lookup>
+  801e29:	83 c4 10             	add    $0x10,%esp
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 0e                	js     801e3e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e36:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+00801e40 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	83 ec 18             	sub    $0x18,%esp
+  801e48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	53                   	push   %ebx
+  801e50:	e8 8e fb ff ff       	call   8019e3 <fd_lookup>
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 34                	js     801e90 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e5c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e65:	50                   	push   %eax
+  801e66:	ff 36                	push   (%esi)
+  801e68:	e8 c6 fb ff ff       	call   801a33 <dev_lookup>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 1c                	js     801e90 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e74:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e78:	74 1d                	je     801e97 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e7d:	8b 40 18             	mov    0x18(%eax),%eax
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	74 5e                	je     801ee2 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	ff 75 0c             	push   0xc(%ebp)
+  801e8a:	56                   	push   %esi
+  801e8b:	ff d0                	call   *%eax
+  801e8d:	83 c4 10             	add    $0x10,%esp
+}
+  801e90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e93:	5b                   	pop    %ebx
+  801e94:	5e                   	pop    %esi
+  801e95:	5d                   	pop    %ebp
+  801e96:	c3                   	ret
+  801e97:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e99:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e9f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801ea4:	77 18                	ja     801ebe <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ea6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801eab:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ead:	c1 e8 10             	shr    $0x10,%eax
+  801eb0:	74 0c                	je     801ebe <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801eb2:	c1 e0 10             	shl    $0x10,%eax
+  801eb5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801eba:	29 c2                	sub    %eax,%edx
+  801ebc:	eb 06                	jmp    801ec4 <ftruncate+0x84>
+		return pthread_main_tls;
+  801ebe:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801ec4:	8b 02                	mov    (%edx),%eax
+  801ec6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	53                   	push   %ebx
+  801ecd:	50                   	push   %eax
+  801ece:	68 d8 4d 80 00       	push   $0x804dd8
+  801ed3:	e8 c9 e3 ff ff       	call   8002a1 <cprintf>
+		return -E_INVAL;
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee0:	eb ae                	jmp    801e90 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ee2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee7:	eb a7                	jmp    801e90 <ftruncate+0x50>
+
+00801ee9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	56                   	push   %esi
+  801eed:	53                   	push   %ebx
+  801eee:	83 ec 18             	sub    $0x18,%esp
+  801ef1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ef4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	ff 75 08             	push   0x8(%ebp)
+  801efb:	e8 e3 fa ff ff       	call   8019e3 <fd_lookup>
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 49                	js     801f50 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f07:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f0a:	83 ec 08             	sub    $0x8,%esp
+  801f0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f10:	50                   	push   %eax
+  801f11:	ff 36                	push   (%esi)
+  801f13:	e8 1b fb ff ff       	call   801a33 <dev_lookup>
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	78 31                	js     801f50 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f22:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f26:	74 2f                	je     801f57 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f28:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f2b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f32:	00 00 00 
+	stat->st_isdir = 0;
+  801f35:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f3c:	00 00 00 
+	stat->st_dev = dev;
+  801f3f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f45:	83 ec 08             	sub    $0x8,%esp
+  801f48:	53                   	push   %ebx
+  801f49:	56                   	push   %esi
+  801f4a:	ff 50 14             	call   *0x14(%eax)
+  801f4d:	83 c4 10             	add    $0x10,%esp
+}
+  801f50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f53:	5b                   	pop    %ebx
+  801f54:	5e                   	pop    %esi
+  801f55:	5d                   	pop    %ebp
+  801f56:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f57:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f5c:	eb f2                	jmp    801f50 <fstat+0x67>
+
+00801f5e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	56                   	push   %esi
+  801f62:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f63:	83 ec 08             	sub    $0x8,%esp
+  801f66:	6a 00                	push   $0x0
+  801f68:	ff 75 08             	push   0x8(%ebp)
+  801f6b:	e8 4b 03 00 00       	call   8022bb <open>
+  801f70:	89 c3                	mov    %eax,%ebx
+  801f72:	83 c4 10             	add    $0x10,%esp
+  801f75:	85 c0                	test   %eax,%eax
+  801f77:	78 1b                	js     801f94 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f79:	83 ec 08             	sub    $0x8,%esp
+  801f7c:	ff 75 0c             	push   0xc(%ebp)
+  801f7f:	50                   	push   %eax
+  801f80:	e8 64 ff ff ff       	call   801ee9 <fstat>
+  801f85:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f87:	89 1c 24             	mov    %ebx,(%esp)
+  801f8a:	e8 a8 fb ff ff       	call   801b37 <close>
+	return r;
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	89 f3                	mov    %esi,%ebx
+}
+  801f94:	89 d8                	mov    %ebx,%eax
+  801f96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f99:	5b                   	pop    %ebx
+  801f9a:	5e                   	pop    %esi
+  801f9b:	5d                   	pop    %ebp
+  801f9c:	c3                   	ret
+
+00801f9d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f9d:	55                   	push   %ebp
+  801f9e:	89 e5                	mov    %esp,%ebp
+  801fa0:	56                   	push   %esi
+  801fa1:	53                   	push   %ebx
+  801fa2:	89 c6                	mov    %eax,%esi
+  801fa4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801fa6:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801fad:	74 27                	je     801fd6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801faf:	6a 07                	push   $0x7
+  801fb1:	68 00 70 80 00       	push   $0x807000
+  801fb6:	56                   	push   %esi
+  801fb7:	ff 35 00 60 80 00    	push   0x806000
+  801fbd:	e8 0f f9 ff ff       	call   8018d1 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fc2:	83 c4 0c             	add    $0xc,%esp
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	53                   	push   %ebx
+  801fc8:	6a 00                	push   $0x0
+  801fca:	e8 0c f8 ff ff       	call   8017db <ipc_recv>
+}
+  801fcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd2:	5b                   	pop    %ebx
+  801fd3:	5e                   	pop    %esi
+  801fd4:	5d                   	pop    %ebp
+  801fd5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fd6:	83 ec 0c             	sub    $0xc,%esp
+  801fd9:	6a 01                	push   $0x1
+  801fdb:	e8 47 f9 ff ff       	call   801927 <ipc_find_env>
+  801fe0:	a3 00 60 80 00       	mov    %eax,0x806000
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	eb c5                	jmp    801faf <fsipc+0x12>
+
+00801fea <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fea:	55                   	push   %ebp
+  801feb:	89 e5                	mov    %esp,%ebp
+  801fed:	53                   	push   %ebx
+  801fee:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ff1:	68 04 60 80 00       	push   $0x806004
+  801ff6:	e8 29 1b 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ffb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802001:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802006:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802009:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  80200e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802013:	b8 02 00 00 00       	mov    $0x2,%eax
+  802018:	e8 80 ff ff ff       	call   801f9d <fsipc>
+  80201d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80201f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802026:	e8 66 1b 00 00       	call   803b91 <mutex_unlock>
+	return r;
+}
+  80202b:	89 d8                	mov    %ebx,%eax
+  80202d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+
+00802032 <devfile_flush>:
+{
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	53                   	push   %ebx
+  802036:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802039:	68 04 60 80 00       	push   $0x806004
+  80203e:	e8 e1 1a 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802043:	8b 45 08             	mov    0x8(%ebp),%eax
+  802046:	8b 40 0c             	mov    0xc(%eax),%eax
+  802049:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80204e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802053:	b8 06 00 00 00       	mov    $0x6,%eax
+  802058:	e8 40 ff ff ff       	call   801f9d <fsipc>
+  80205d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80205f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802066:	e8 26 1b 00 00       	call   803b91 <mutex_unlock>
+}
+  80206b:	89 d8                	mov    %ebx,%eax
+  80206d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+
+00802072 <devfile_stat>:
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	56                   	push   %esi
+  802076:	53                   	push   %ebx
+  802077:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	68 04 60 80 00       	push   $0x806004
+  802082:	e8 9d 1a 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802087:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80208d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802092:	ba 00 00 00 00       	mov    $0x0,%edx
+  802097:	b8 05 00 00 00       	mov    $0x5,%eax
+  80209c:	e8 fc fe ff ff       	call   801f9d <fsipc>
+  8020a1:	89 c3                	mov    %eax,%ebx
+  8020a3:	83 c4 10             	add    $0x10,%esp
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	79 16                	jns    8020c0 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  8020aa:	83 ec 0c             	sub    $0xc,%esp
+  8020ad:	68 04 60 80 00       	push   $0x806004
+  8020b2:	e8 da 1a 00 00       	call   803b91 <mutex_unlock>
+}
+  8020b7:	89 d8                	mov    %ebx,%eax
+  8020b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020bc:	5b                   	pop    %ebx
+  8020bd:	5e                   	pop    %esi
+  8020be:	5d                   	pop    %ebp
+  8020bf:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020c0:	83 ec 08             	sub    $0x8,%esp
+  8020c3:	68 00 70 80 00       	push   $0x807000
+  8020c8:	56                   	push   %esi
+  8020c9:	e8 b7 e7 ff ff       	call   800885 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8020ce:	a1 80 70 80 00       	mov    0x807080,%eax
+  8020d3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020d9:	a1 84 70 80 00       	mov    0x807084,%eax
+  8020de:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8020e4:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8020e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ec:	eb bc                	jmp    8020aa <devfile_stat+0x38>
+
+008020ee <devfile_write>:
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	53                   	push   %ebx
+  8020f2:	83 ec 10             	sub    $0x10,%esp
+  8020f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8020f8:	68 04 60 80 00       	push   $0x806004
+  8020fd:	e8 22 1a 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802102:	8b 45 08             	mov    0x8(%ebp),%eax
+  802105:	8b 40 0c             	mov    0xc(%eax),%eax
+  802108:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802116:	76 3d                	jbe    802155 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802118:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80211d:	39 c3                	cmp    %eax,%ebx
+  80211f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802122:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802125:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  80212a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802130:	ba 00 00 00 00       	mov    $0x0,%edx
+  802135:	b8 04 00 00 00       	mov    $0x4,%eax
+  80213a:	e8 5e fe ff ff       	call   801f9d <fsipc>
+  80213f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802141:	83 ec 0c             	sub    $0xc,%esp
+  802144:	68 04 60 80 00       	push   $0x806004
+  802149:	e8 43 1a 00 00       	call   803b91 <mutex_unlock>
+}
+  80214e:	89 d8                	mov    %ebx,%eax
+  802150:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802155:	83 ec 04             	sub    $0x4,%esp
+  802158:	53                   	push   %ebx
+  802159:	ff 75 0c             	push   0xc(%ebp)
+  80215c:	68 0c 70 80 00       	push   $0x80700c
+  802161:	e8 a5 e8 ff ff       	call   800a0b <memmove>
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216e:	eb b5                	jmp    802125 <devfile_write+0x37>
+
+00802170 <devfile_read>:
+{
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	57                   	push   %edi
+  802174:	56                   	push   %esi
+  802175:	53                   	push   %ebx
+  802176:	83 ec 0c             	sub    $0xc,%esp
+  802179:	8b 75 08             	mov    0x8(%ebp),%esi
+  80217c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80217f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802182:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802188:	0f 86 8c 00 00 00    	jbe    80221a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80218e:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802193:	39 c3                	cmp    %eax,%ebx
+  802195:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802198:	89 f8                	mov    %edi,%eax
+  80219a:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80219d:	eb 0f                	jmp    8021ae <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80219f:	0f b6 08             	movzbl (%eax),%ecx
+  8021a2:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8021a4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021a9:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8021ae:	39 d0                	cmp    %edx,%eax
+  8021b0:	72 ed                	jb     80219f <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8021b2:	83 ec 0c             	sub    $0xc,%esp
+  8021b5:	68 04 60 80 00       	push   $0x806004
+  8021ba:	e8 65 19 00 00       	call   803b24 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021bf:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021c2:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  8021c7:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8021cd:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8021d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021dd:	e8 bb fd ff ff       	call   801f9d <fsipc>
+  8021e2:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8021e4:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8021eb:	e8 a1 19 00 00       	call   803b91 <mutex_unlock>
+		assert(r <= (int) n);
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	39 f3                	cmp    %esi,%ebx
+  8021f5:	7c 0a                	jl     802201 <devfile_read+0x91>
+}
+  8021f7:	89 f0                	mov    %esi,%eax
+  8021f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fc:	5b                   	pop    %ebx
+  8021fd:	5e                   	pop    %esi
+  8021fe:	5f                   	pop    %edi
+  8021ff:	5d                   	pop    %ebp
+  802200:	c3                   	ret
+		assert(r <= (int) n);
+  802201:	68 48 4e 80 00       	push   $0x804e48
+  802206:	68 31 4d 80 00       	push   $0x804d31
+  80220b:	68 90 00 00 00       	push   $0x90
+  802210:	68 55 4e 80 00       	push   $0x804e55
+  802215:	e8 ac df ff ff       	call   8001c6 <_panic>
+	mutex_lock(&fsipc_mu);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	68 04 60 80 00       	push   $0x806004
+  802222:	e8 fd 18 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802227:	8b 46 0c             	mov    0xc(%esi),%eax
+  80222a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80222f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  802235:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80223c:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80223f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802244:	b8 03 00 00 00       	mov    $0x3,%eax
+  802249:	e8 4f fd ff ff       	call   801f9d <fsipc>
+  80224e:	89 c6                	mov    %eax,%esi
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	85 c0                	test   %eax,%eax
+  802255:	78 1d                	js     802274 <devfile_read+0x104>
+		assert(r <= n);
+  802257:	39 c3                	cmp    %eax,%ebx
+  802259:	72 2e                	jb     802289 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80225b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802260:	7f 40                	jg     8022a2 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802262:	83 ec 04             	sub    $0x4,%esp
+  802265:	50                   	push   %eax
+  802266:	68 00 70 80 00       	push   $0x807000
+  80226b:	57                   	push   %edi
+  80226c:	e8 9a e7 ff ff       	call   800a0b <memmove>
+  802271:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802274:	83 ec 0c             	sub    $0xc,%esp
+  802277:	68 04 60 80 00       	push   $0x806004
+  80227c:	e8 10 19 00 00       	call   803b91 <mutex_unlock>
+	return r;
+  802281:	83 c4 10             	add    $0x10,%esp
+  802284:	e9 6e ff ff ff       	jmp    8021f7 <devfile_read+0x87>
+		assert(r <= n);
+  802289:	68 60 4e 80 00       	push   $0x804e60
+  80228e:	68 31 4d 80 00       	push   $0x804d31
+  802293:	68 99 00 00 00       	push   $0x99
+  802298:	68 55 4e 80 00       	push   $0x804e55
+  80229d:	e8 24 df ff ff       	call   8001c6 <_panic>
+		assert(r <= PGSIZE);
+  8022a2:	68 67 4e 80 00       	push   $0x804e67
+  8022a7:	68 31 4d 80 00       	push   $0x804d31
+  8022ac:	68 9a 00 00 00       	push   $0x9a
+  8022b1:	68 55 4e 80 00       	push   $0x804e55
+  8022b6:	e8 0b df ff ff       	call   8001c6 <_panic>
+
+008022bb <open>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 1c             	sub    $0x1c,%esp
+  8022c3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022c6:	56                   	push   %esi
+  8022c7:	e8 7e e5 ff ff       	call   80084a <strlen>
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022d4:	0f 8f 85 00 00 00    	jg     80235f <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022da:	83 ec 0c             	sub    $0xc,%esp
+  8022dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e0:	50                   	push   %eax
+  8022e1:	e8 a7 f6 ff ff       	call   80198d <fd_alloc>
+  8022e6:	89 c3                	mov    %eax,%ebx
+  8022e8:	83 c4 10             	add    $0x10,%esp
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	78 55                	js     802344 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8022ef:	83 ec 0c             	sub    $0xc,%esp
+  8022f2:	68 04 60 80 00       	push   $0x806004
+  8022f7:	e8 28 18 00 00       	call   803b24 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022fc:	83 c4 08             	add    $0x8,%esp
+  8022ff:	56                   	push   %esi
+  802300:	68 00 70 80 00       	push   $0x807000
+  802305:	e8 7b e5 ff ff       	call   800885 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80230a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230d:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  802312:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802315:	b8 01 00 00 00       	mov    $0x1,%eax
+  80231a:	e8 7e fc ff ff       	call   801f9d <fsipc>
+  80231f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802321:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802328:	e8 64 18 00 00       	call   803b91 <mutex_unlock>
+	if (r < 0) {
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	85 db                	test   %ebx,%ebx
+  802332:	78 19                	js     80234d <open+0x92>
+	return fd2num(fd);
+  802334:	83 ec 0c             	sub    $0xc,%esp
+  802337:	ff 75 f4             	push   -0xc(%ebp)
+  80233a:	e8 27 f6 ff ff       	call   801966 <fd2num>
+  80233f:	89 c3                	mov    %eax,%ebx
+  802341:	83 c4 10             	add    $0x10,%esp
+}
+  802344:	89 d8                	mov    %ebx,%eax
+  802346:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802349:	5b                   	pop    %ebx
+  80234a:	5e                   	pop    %esi
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+		fd_close(fd, 0);
+  80234d:	83 ec 08             	sub    $0x8,%esp
+  802350:	6a 00                	push   $0x0
+  802352:	ff 75 f4             	push   -0xc(%ebp)
+  802355:	e8 56 f7 ff ff       	call   801ab0 <fd_close>
+		return r;
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	eb e5                	jmp    802344 <open+0x89>
+		return -E_BAD_PATH;
+  80235f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802364:	eb de                	jmp    802344 <open+0x89>
+
+00802366 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	53                   	push   %ebx
+  80236a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80236d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802370:	50                   	push   %eax
+  802371:	ff 75 08             	push   0x8(%ebp)
+  802374:	e8 6a f6 ff ff       	call   8019e3 <fd_lookup>
+  802379:	89 c3                	mov    %eax,%ebx
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	78 5b                	js     8023dd <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802382:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802385:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80238b:	39 08                	cmp    %ecx,(%eax)
+  80238d:	75 55                	jne    8023e4 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80238f:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802393:	74 56                	je     8023eb <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802395:	83 ec 0c             	sub    $0xc,%esp
+  802398:	68 04 60 80 00       	push   $0x806004
+  80239d:	e8 82 17 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8023a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023a8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8023ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023b0:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8023b5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023b8:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8023bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023c7:	e8 d1 fb ff ff       	call   801f9d <fsipc>
+  8023cc:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023ce:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8023d5:	e8 b7 17 00 00       	call   803b91 <mutex_unlock>
+	return r;
+  8023da:	83 c4 10             	add    $0x10,%esp
+}
+  8023dd:	89 d8                	mov    %ebx,%eax
+  8023df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023e4:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023e9:	eb f2                	jmp    8023dd <fallocate+0x77>
+		return -E_INVAL;
+  8023eb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023f0:	eb eb                	jmp    8023dd <fallocate+0x77>
+
+008023f2 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	56                   	push   %esi
+  8023f6:	53                   	push   %ebx
+  8023f7:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8023fa:	89 f3                	mov    %esi,%ebx
+  8023fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802402:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802405:	eb 06                	jmp    80240d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802407:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80240d:	39 f3                	cmp    %esi,%ebx
+  80240f:	73 14                	jae    802425 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802411:	83 ec 08             	sub    $0x8,%esp
+  802414:	53                   	push   %ebx
+  802415:	6a 00                	push   $0x0
+  802417:	e8 40 e9 ff ff       	call   800d5c <sys_page_unmap>
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	85 c0                	test   %eax,%eax
+  802421:	79 e4                	jns    802407 <munmap+0x15>
+  802423:	eb 05                	jmp    80242a <munmap+0x38>
+			return r;
+	return 0;
+  802425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5d                   	pop    %ebp
+  802430:	c3                   	ret
+
+00802431 <mmap>:
+{
+  802431:	55                   	push   %ebp
+  802432:	89 e5                	mov    %esp,%ebp
+  802434:	57                   	push   %edi
+  802435:	56                   	push   %esi
+  802436:	53                   	push   %ebx
+  802437:	83 ec 24             	sub    $0x24,%esp
+  80243a:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80243d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802440:	50                   	push   %eax
+  802441:	ff 75 08             	push   0x8(%ebp)
+  802444:	e8 9a f5 ff ff       	call   8019e3 <fd_lookup>
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	0f 88 37 01 00 00    	js     80258b <mmap+0x15a>
+		return NULL;
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802459:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80245c:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802462:	39 0a                	cmp    %ecx,(%edx)
+  802464:	0f 85 05 01 00 00    	jne    80256f <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80246a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802471:	0f 85 1b 01 00 00    	jne    802592 <mmap+0x161>
+  802477:	89 f0                	mov    %esi,%eax
+  802479:	83 e8 01             	sub    $0x1,%eax
+  80247c:	0f 88 17 01 00 00    	js     802599 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802482:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802486:	75 28                	jne    8024b0 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802488:	83 ec 0c             	sub    $0xc,%esp
+  80248b:	68 04 60 80 00       	push   $0x806004
+  802490:	e8 8f 16 00 00       	call   803b24 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802495:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80249b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8024a9:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8024ae:	eb 2b                	jmp    8024db <mmap+0xaa>
+		cow_enable();
+  8024b0:	e8 b5 ee ff ff       	call   80136a <cow_enable>
+  8024b5:	eb d1                	jmp    802488 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8024b7:	89 c2                	mov    %eax,%edx
+  8024b9:	c1 ea 0c             	shr    $0xc,%edx
+  8024bc:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8024c3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8024c9:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8024cf:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8024d2:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8024d4:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8024d9:	77 25                	ja     802500 <mmap+0xcf>
+  8024db:	89 c2                	mov    %eax,%edx
+  8024dd:	29 da                	sub    %ebx,%edx
+  8024df:	39 ca                	cmp    %ecx,%edx
+  8024e1:	73 3a                	jae    80251d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8024e3:	89 c2                	mov    %eax,%edx
+  8024e5:	c1 ea 16             	shr    $0x16,%edx
+  8024e8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8024ef:	f6 c2 01             	test   $0x1,%dl
+  8024f2:	75 c3                	jne    8024b7 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8024f4:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8024f9:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8024fe:	eb d4                	jmp    8024d4 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802500:	29 d8                	sub    %ebx,%eax
+  802502:	39 c8                	cmp    %ecx,%eax
+  802504:	73 17                	jae    80251d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802506:	83 ec 0c             	sub    $0xc,%esp
+  802509:	68 04 60 80 00       	push   $0x806004
+  80250e:	e8 7e 16 00 00       	call   803b91 <mutex_unlock>
+		return NULL;
+  802513:	83 c4 10             	add    $0x10,%esp
+  802516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251b:	eb 52                	jmp    80256f <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80251d:	85 db                	test   %ebx,%ebx
+  80251f:	74 e5                	je     802506 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802521:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802524:	8b 40 0c             	mov    0xc(%eax),%eax
+  802527:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80252c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  802534:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  80253a:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  802540:	8b 45 14             	mov    0x14(%ebp),%eax
+  802543:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  802548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802552:	e8 46 fa ff ff       	call   801f9d <fsipc>
+  802557:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802559:	83 ec 0c             	sub    $0xc,%esp
+  80255c:	68 04 60 80 00       	push   $0x806004
+  802561:	e8 2b 16 00 00       	call   803b91 <mutex_unlock>
+	if (r < 0) {
+  802566:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802569:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80256b:	85 ff                	test   %edi,%edi
+  80256d:	78 08                	js     802577 <mmap+0x146>
+}
+  80256f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802572:	5b                   	pop    %ebx
+  802573:	5e                   	pop    %esi
+  802574:	5f                   	pop    %edi
+  802575:	5d                   	pop    %ebp
+  802576:	c3                   	ret
+		munmap((void*) va, len);
+  802577:	83 ec 08             	sub    $0x8,%esp
+  80257a:	56                   	push   %esi
+  80257b:	53                   	push   %ebx
+  80257c:	e8 71 fe ff ff       	call   8023f2 <munmap>
+		return NULL;
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+  802589:	eb e4                	jmp    80256f <mmap+0x13e>
+		return NULL;
+  80258b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802590:	eb dd                	jmp    80256f <mmap+0x13e>
+		return NULL;
+  802592:	b8 00 00 00 00       	mov    $0x0,%eax
+  802597:	eb d6                	jmp    80256f <mmap+0x13e>
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	eb cf                	jmp    80256f <mmap+0x13e>
+
+008025a0 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8025a0:	55                   	push   %ebp
+  8025a1:	89 e5                	mov    %esp,%ebp
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 10             	sub    $0x10,%esp
+  8025a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025aa:	53                   	push   %ebx
+  8025ab:	e8 9a e2 ff ff       	call   80084a <strlen>
+  8025b0:	83 c4 10             	add    $0x10,%esp
+  8025b3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025b8:	7f 42                	jg     8025fc <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8025ba:	83 ec 0c             	sub    $0xc,%esp
+  8025bd:	68 04 60 80 00       	push   $0x806004
+  8025c2:	e8 5d 15 00 00       	call   803b24 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025c7:	83 c4 08             	add    $0x8,%esp
+  8025ca:	53                   	push   %ebx
+  8025cb:	68 00 70 80 00       	push   $0x807000
+  8025d0:	e8 b0 e2 ff ff       	call   800885 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8025d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025da:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025df:	e8 b9 f9 ff ff       	call   801f9d <fsipc>
+  8025e4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8025e6:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8025ed:	e8 9f 15 00 00       	call   803b91 <mutex_unlock>
+	return r;
+  8025f2:	83 c4 10             	add    $0x10,%esp
+}
+  8025f5:	89 d8                	mov    %ebx,%eax
+  8025f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025fa:	c9                   	leave
+  8025fb:	c3                   	ret
+		return -E_BAD_PATH;
+  8025fc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802601:	eb f2                	jmp    8025f5 <remove+0x55>
+
+00802603 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802603:	55                   	push   %ebp
+  802604:	89 e5                	mov    %esp,%ebp
+  802606:	53                   	push   %ebx
+  802607:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80260a:	68 04 60 80 00       	push   $0x806004
+  80260f:	e8 10 15 00 00       	call   803b24 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802614:	ba 00 00 00 00       	mov    $0x0,%edx
+  802619:	b8 08 00 00 00       	mov    $0x8,%eax
+  80261e:	e8 7a f9 ff ff       	call   801f9d <fsipc>
+  802623:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802625:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80262c:	e8 60 15 00 00       	call   803b91 <mutex_unlock>
+	return r;
+}
+  802631:	89 d8                	mov    %ebx,%eax
+  802633:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802636:	c9                   	leave
+  802637:	c3                   	ret
+
+00802638 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802638:	55                   	push   %ebp
+  802639:	89 e5                	mov    %esp,%ebp
+  80263b:	56                   	push   %esi
+  80263c:	53                   	push   %ebx
+  80263d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802640:	83 ec 0c             	sub    $0xc,%esp
+  802643:	68 04 60 80 00       	push   $0x806004
+  802648:	e8 d7 14 00 00       	call   803b24 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80264d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802650:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80265f:	e8 39 f9 ff ff       	call   801f9d <fsipc>
+  802664:	89 c6                	mov    %eax,%esi
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	85 db                	test   %ebx,%ebx
+  80266b:	74 7b                	je     8026e8 <fs_bcstat+0xb0>
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	78 77                	js     8026e8 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802671:	a1 00 70 80 00       	mov    0x807000,%eax
+  802676:	89 03                	mov    %eax,(%ebx)
+  802678:	a1 04 70 80 00       	mov    0x807004,%eax
+  80267d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802680:	a1 08 70 80 00       	mov    0x807008,%eax
+  802685:	89 43 08             	mov    %eax,0x8(%ebx)
+  802688:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80268d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802690:	a1 10 70 80 00       	mov    0x807010,%eax
+  802695:	89 43 10             	mov    %eax,0x10(%ebx)
+  802698:	a1 14 70 80 00       	mov    0x807014,%eax
+  80269d:	89 43 14             	mov    %eax,0x14(%ebx)
+  8026a0:	a1 18 70 80 00       	mov    0x807018,%eax
+  8026a5:	89 43 18             	mov    %eax,0x18(%ebx)
+  8026a8:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8026ad:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8026b0:	a1 20 70 80 00       	mov    0x807020,%eax
+  8026b5:	89 43 20             	mov    %eax,0x20(%ebx)
+  8026b8:	a1 24 70 80 00       	mov    0x807024,%eax
+  8026bd:	89 43 24             	mov    %eax,0x24(%ebx)
+  8026c0:	a1 28 70 80 00       	mov    0x807028,%eax
+  8026c5:	89 43 28             	mov    %eax,0x28(%ebx)
+  8026c8:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8026cd:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8026d0:	a1 30 70 80 00       	mov    0x807030,%eax
+  8026d5:	89 43 30             	mov    %eax,0x30(%ebx)
+  8026d8:	a1 34 70 80 00       	mov    0x807034,%eax
+  8026dd:	89 43 34             	mov    %eax,0x34(%ebx)
+  8026e0:	a1 38 70 80 00       	mov    0x807038,%eax
+  8026e5:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8026e8:	83 ec 0c             	sub    $0xc,%esp
+  8026eb:	68 04 60 80 00       	push   $0x806004
+  8026f0:	e8 9c 14 00 00       	call   803b91 <mutex_unlock>
+	return r;
+}
+  8026f5:	89 f0                	mov    %esi,%eax
+  8026f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5d                   	pop    %ebp
+  8026fd:	c3                   	ret
+
+008026fe <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	56                   	push   %esi
+  802702:	53                   	push   %ebx
+  802703:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802705:	0f b6 10             	movzbl (%eax),%edx
+  802708:	80 fa 72             	cmp    $0x72,%dl
+  80270b:	74 44                	je     802751 <parse_mode+0x53>
+  80270d:	80 fa 77             	cmp    $0x77,%dl
+  802710:	74 4b                	je     80275d <parse_mode+0x5f>
+  802712:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802717:	80 fa 61             	cmp    $0x61,%dl
+  80271a:	74 09                	je     802725 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80271c:	89 d8                	mov    %ebx,%eax
+  80271e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802721:	5b                   	pop    %ebx
+  802722:	5e                   	pop    %esi
+  802723:	5d                   	pop    %ebp
+  802724:	c3                   	ret
+	switch (mode[0]) {
+  802725:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80272a:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80272f:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802731:	83 ec 08             	sub    $0x8,%esp
+  802734:	6a 2b                	push   $0x2b
+  802736:	50                   	push   %eax
+  802737:	e8 5b e2 ff ff       	call   800997 <strchr>
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	74 d9                	je     80271c <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802743:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802746:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802749:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80274f:	eb cb                	jmp    80271c <parse_mode+0x1e>
+	switch (mode[0]) {
+  802751:	ba 01 00 00 00       	mov    $0x1,%edx
+  802756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275b:	eb d2                	jmp    80272f <parse_mode+0x31>
+  80275d:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802762:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802767:	eb c6                	jmp    80272f <parse_mode+0x31>
+
+00802769 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802769:	55                   	push   %ebp
+  80276a:	89 e5                	mov    %esp,%ebp
+  80276c:	57                   	push   %edi
+  80276d:	56                   	push   %esi
+  80276e:	53                   	push   %ebx
+  80276f:	83 ec 1c             	sub    $0x1c,%esp
+  802772:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802775:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802778:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80277d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802782:	83 c0 24             	add    $0x24,%eax
+  802785:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802789:	74 17                	je     8027a2 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80278b:	83 c3 01             	add    $0x1,%ebx
+  80278e:	83 fb 10             	cmp    $0x10,%ebx
+  802791:	75 ef                	jne    802782 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802793:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802798:	89 f0                	mov    %esi,%eax
+  80279a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5f                   	pop    %edi
+  8027a0:	5d                   	pop    %ebp
+  8027a1:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8027a2:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8027a9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8027ac:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8027af:	c1 e7 02             	shl    $0x2,%edi
+  8027b2:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8027b8:	83 ec 04             	sub    $0x4,%esp
+  8027bb:	6a 24                	push   $0x24
+  8027bd:	6a 00                	push   $0x0
+  8027bf:	56                   	push   %esi
+  8027c0:	e8 11 e2 ff ff       	call   8009d6 <memset>
+			streams[i].f_fd = fd;
+  8027c5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027c8:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8027ce:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027d1:	01 d8                	add    %ebx,%eax
+  8027d3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027d6:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8027dd:	83 c4 10             	add    $0x10,%esp
+  8027e0:	eb b6                	jmp    802798 <stream_alloc+0x2f>
+
+008027e2 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	53                   	push   %ebx
+  8027e6:	83 ec 14             	sub    $0x14,%esp
+  8027e9:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8027eb:	8b 40 18             	mov    0x18(%eax),%eax
+  8027ee:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8027f1:	74 4a                	je     80283d <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+  8027f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027f9:	50                   	push   %eax
+  8027fa:	ff 33                	push   (%ebx)
+  8027fc:	e8 e2 f1 ff ff       	call   8019e3 <fd_lookup>
+  802801:	89 c2                	mov    %eax,%edx
+  802803:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80280b:	85 d2                	test   %edx,%edx
+  80280d:	78 41                	js     802850 <stream_unread+0x6e>
+  80280f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802812:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802818:	39 0a                	cmp    %ecx,(%edx)
+  80281a:	75 34                	jne    802850 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80281c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80281f:	03 42 04             	add    0x4(%edx),%eax
+  802822:	2b 43 18             	sub    0x18(%ebx),%eax
+  802825:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802828:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80282f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802836:	b8 01 00 00 00       	mov    $0x1,%eax
+  80283b:	eb 13                	jmp    802850 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80283d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802844:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80284b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+
+00802855 <stream_drain>:
+{
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	56                   	push   %esi
+  802859:	53                   	push   %ebx
+  80285a:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80285c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802861:	eb 02                	jmp    802865 <stream_drain+0x10>
+  802863:	01 c3                	add    %eax,%ebx
+  802865:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802868:	39 c3                	cmp    %eax,%ebx
+  80286a:	73 43                	jae    8028af <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80286c:	83 ec 04             	sub    $0x4,%esp
+  80286f:	29 d8                	sub    %ebx,%eax
+  802871:	50                   	push   %eax
+  802872:	89 d8                	mov    %ebx,%eax
+  802874:	03 46 0c             	add    0xc(%esi),%eax
+  802877:	50                   	push   %eax
+  802878:	ff 36                	push   (%esi)
+  80287a:	e8 ec f4 ff ff       	call   801d6b <write>
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	85 c0                	test   %eax,%eax
+  802884:	7f dd                	jg     802863 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802886:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80288a:	8b 56 0c             	mov    0xc(%esi),%edx
+  80288d:	83 ec 04             	sub    $0x4,%esp
+  802890:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802893:	29 d8                	sub    %ebx,%eax
+  802895:	50                   	push   %eax
+  802896:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802899:	50                   	push   %eax
+  80289a:	52                   	push   %edx
+  80289b:	e8 6b e1 ff ff       	call   800a0b <memmove>
+			f->f_wend -= done;
+  8028a0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028a3:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8028a5:	83 c4 10             	add    $0x10,%esp
+  8028a8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8028ad:	eb 0a                	jmp    8028b9 <stream_drain+0x64>
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8028b4:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8028b9:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8028bc:	89 d0                	mov    %edx,%eax
+  8028be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c1:	5b                   	pop    %ebx
+  8028c2:	5e                   	pop    %esi
+  8028c3:	5d                   	pop    %ebp
+  8028c4:	c3                   	ret
+
+008028c5 <stream_setup>:
+	if (f->f_buf)
+  8028c5:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8028c9:	74 01                	je     8028cc <stream_setup+0x7>
+  8028cb:	c3                   	ret
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+  8028cf:	53                   	push   %ebx
+  8028d0:	83 ec 04             	sub    $0x4,%esp
+  8028d3:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8028d5:	8b 40 08             	mov    0x8(%eax),%eax
+  8028d8:	85 c0                	test   %eax,%eax
+  8028da:	74 17                	je     8028f3 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8028dc:	83 f8 03             	cmp    $0x3,%eax
+  8028df:	75 2d                	jne    80290e <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8028e1:	8d 43 20             	lea    0x20(%ebx),%eax
+  8028e4:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8028e7:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8028ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028f1:	c9                   	leave
+  8028f2:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8028f3:	83 ec 0c             	sub    $0xc,%esp
+  8028f6:	ff 33                	push   (%ebx)
+  8028f8:	e8 29 1b 00 00       	call   804426 <iscons>
+  8028fd:	83 c4 10             	add    $0x10,%esp
+  802900:	85 c0                	test   %eax,%eax
+  802902:	0f 9f c0             	setg   %al
+  802905:	0f b6 c0             	movzbl %al,%eax
+  802908:	83 c0 01             	add    $0x1,%eax
+  80290b:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80290e:	83 ec 0c             	sub    $0xc,%esp
+  802911:	68 00 10 00 00       	push   $0x1000
+  802916:	e8 6e 0b 00 00       	call   803489 <malloc>
+  80291b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 c0                	test   %eax,%eax
+  802923:	74 bc                	je     8028e1 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802925:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80292c:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802930:	eb bc                	jmp    8028ee <stream_setup+0x29>
+
+00802932 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+  802935:	53                   	push   %ebx
+  802936:	83 ec 04             	sub    $0x4,%esp
+  802939:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80293b:	e8 85 ff ff ff       	call   8028c5 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802940:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802945:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802949:	74 3d                	je     802988 <stream_fill+0x56>
+  80294b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80294f:	74 10                	je     802961 <stream_fill+0x2f>
+  802951:	89 d8                	mov    %ebx,%eax
+  802953:	e8 fd fe ff ff       	call   802855 <stream_drain>
+		return 0;
+  802958:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	78 27                	js     802988 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802961:	83 ec 04             	sub    $0x4,%esp
+  802964:	ff 73 10             	push   0x10(%ebx)
+  802967:	ff 73 0c             	push   0xc(%ebx)
+  80296a:	ff 33                	push   (%ebx)
+  80296c:	e8 02 f3 ff ff       	call   801c73 <read>
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	85 c0                	test   %eax,%eax
+  802976:	7e 17                	jle    80298f <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802978:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80297c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802983:	89 c2                	mov    %eax,%edx
+  802985:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802988:	89 d0                	mov    %edx,%eax
+  80298a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80298f:	c1 f8 1f             	sar    $0x1f,%eax
+  802992:	83 e0 04             	and    $0x4,%eax
+  802995:	83 c0 04             	add    $0x4,%eax
+  802998:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80299b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a0:	eb e6                	jmp    802988 <stream_fill+0x56>
+
+008029a2 <fopen>:
+{
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	57                   	push   %edi
+  8029a6:	56                   	push   %esi
+  8029a7:	53                   	push   %ebx
+  8029a8:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8029ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8029b1:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8029b7:	89 f0                	mov    %esi,%eax
+  8029b9:	e8 40 fd ff ff       	call   8026fe <parse_mode>
+		return 0;
+  8029be:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 2d                	js     8029f4 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8029c7:	83 ec 08             	sub    $0x8,%esp
+  8029ca:	50                   	push   %eax
+  8029cb:	ff 75 08             	push   0x8(%ebp)
+  8029ce:	e8 e8 f8 ff ff       	call   8022bb <open>
+  8029d3:	89 c7                	mov    %eax,%edi
+  8029d5:	83 c4 10             	add    $0x10,%esp
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	78 58                	js     802a34 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8029dc:	80 3e 61             	cmpb   $0x61,(%esi)
+  8029df:	74 1d                	je     8029fe <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8029e1:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8029e7:	89 f8                	mov    %edi,%eax
+  8029e9:	e8 7b fd ff ff       	call   802769 <stream_alloc>
+  8029ee:	89 c3                	mov    %eax,%ebx
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	74 32                	je     802a26 <fopen+0x84>
+}
+  8029f4:	89 d8                	mov    %ebx,%eax
+  8029f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f9:	5b                   	pop    %ebx
+  8029fa:	5e                   	pop    %esi
+  8029fb:	5f                   	pop    %edi
+  8029fc:	5d                   	pop    %ebp
+  8029fd:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8029fe:	83 ec 08             	sub    $0x8,%esp
+  802a01:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802a07:	50                   	push   %eax
+  802a08:	57                   	push   %edi
+  802a09:	e8 db f4 ff ff       	call   801ee9 <fstat>
+  802a0e:	83 c4 10             	add    $0x10,%esp
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	78 cc                	js     8029e1 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802a15:	83 ec 08             	sub    $0x8,%esp
+  802a18:	ff 75 dc             	push   -0x24(%ebp)
+  802a1b:	57                   	push   %edi
+  802a1c:	e8 f6 f3 ff ff       	call   801e17 <seek>
+  802a21:	83 c4 10             	add    $0x10,%esp
+  802a24:	eb bb                	jmp    8029e1 <fopen+0x3f>
+		close(fd);
+  802a26:	83 ec 0c             	sub    $0xc,%esp
+  802a29:	57                   	push   %edi
+  802a2a:	e8 08 f1 ff ff       	call   801b37 <close>
+  802a2f:	83 c4 10             	add    $0x10,%esp
+  802a32:	eb c0                	jmp    8029f4 <fopen+0x52>
+		return 0;
+  802a34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a39:	eb b9                	jmp    8029f4 <fopen+0x52>
+
+00802a3b <fdopen>:
+{
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802a41:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a47:	e8 b2 fc ff ff       	call   8026fe <parse_mode>
+  802a4c:	89 c2                	mov    %eax,%edx
+		return 0;
+  802a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802a53:	85 d2                	test   %edx,%edx
+  802a55:	78 0b                	js     802a62 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802a57:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5d:	e8 07 fd ff ff       	call   802769 <stream_alloc>
+}
+  802a62:	c9                   	leave
+  802a63:	c3                   	ret
+
+00802a64 <setvbuf>:
+{
+  802a64:	55                   	push   %ebp
+  802a65:	89 e5                	mov    %esp,%ebp
+  802a67:	57                   	push   %edi
+  802a68:	56                   	push   %esi
+  802a69:	53                   	push   %ebx
+  802a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a70:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802a73:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a77:	75 3a                	jne    802ab3 <setvbuf+0x4f>
+  802a79:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802a7c:	83 fe 02             	cmp    $0x2,%esi
+  802a7f:	77 39                	ja     802aba <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802a81:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802a84:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a88:	0f 95 c3             	setne  %bl
+  802a8b:	85 ff                	test   %edi,%edi
+  802a8d:	0f 95 c1             	setne  %cl
+  802a90:	84 cb                	test   %cl,%bl
+  802a92:	74 05                	je     802a99 <setvbuf+0x35>
+  802a94:	83 fa 03             	cmp    $0x3,%edx
+  802a97:	75 0a                	jne    802aa3 <setvbuf+0x3f>
+	return 0;
+  802a99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a9e:	5b                   	pop    %ebx
+  802a9f:	5e                   	pop    %esi
+  802aa0:	5f                   	pop    %edi
+  802aa1:	5d                   	pop    %ebp
+  802aa2:	c3                   	ret
+		f->f_buf = buf;
+  802aa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aa6:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802aa9:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab1:	eb eb                	jmp    802a9e <setvbuf+0x3a>
+		return EOF;
+  802ab3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ab8:	eb e4                	jmp    802a9e <setvbuf+0x3a>
+  802aba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802abf:	eb dd                	jmp    802a9e <setvbuf+0x3a>
+
+00802ac1 <fflush>:
+{
+  802ac1:	55                   	push   %ebp
+  802ac2:	89 e5                	mov    %esp,%ebp
+  802ac4:	57                   	push   %edi
+  802ac5:	56                   	push   %esi
+  802ac6:	53                   	push   %ebx
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802acd:	85 db                	test   %ebx,%ebx
+  802acf:	74 1a                	je     802aeb <fflush+0x2a>
+	stream_unread(f);
+  802ad1:	89 d8                	mov    %ebx,%eax
+  802ad3:	e8 0a fd ff ff       	call   8027e2 <stream_unread>
+	return stream_drain(f);
+  802ad8:	89 d8                	mov    %ebx,%eax
+  802ada:	e8 76 fd ff ff       	call   802855 <stream_drain>
+  802adf:	89 c7                	mov    %eax,%edi
+}
+  802ae1:	89 f8                	mov    %edi,%eax
+  802ae3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae6:	5b                   	pop    %ebx
+  802ae7:	5e                   	pop    %esi
+  802ae8:	5f                   	pop    %edi
+  802ae9:	5d                   	pop    %ebp
+  802aea:	c3                   	ret
+  802aeb:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  802af0:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802af5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802afa:	eb 03                	jmp    802aff <fflush+0x3e>
+  802afc:	83 c3 24             	add    $0x24,%ebx
+  802aff:	39 f3                	cmp    %esi,%ebx
+  802b01:	74 de                	je     802ae1 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802b03:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802b07:	74 f3                	je     802afc <fflush+0x3b>
+  802b09:	83 ec 0c             	sub    $0xc,%esp
+  802b0c:	53                   	push   %ebx
+  802b0d:	e8 af ff ff ff       	call   802ac1 <fflush>
+  802b12:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b1c:	0f 48 f8             	cmovs  %eax,%edi
+  802b1f:	eb db                	jmp    802afc <fflush+0x3b>
+
+00802b21 <fclose>:
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	56                   	push   %esi
+  802b25:	53                   	push   %ebx
+  802b26:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802b29:	83 ec 0c             	sub    $0xc,%esp
+  802b2c:	56                   	push   %esi
+  802b2d:	e8 8f ff ff ff       	call   802ac1 <fflush>
+  802b32:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802b34:	83 c4 04             	add    $0x4,%esp
+  802b37:	ff 36                	push   (%esi)
+  802b39:	e8 f9 ef ff ff       	call   801b37 <close>
+  802b3e:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b48:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802b4b:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802b4f:	75 10                	jne    802b61 <fclose+0x40>
+	f->f_flags = 0;
+  802b51:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802b58:	89 d8                	mov    %ebx,%eax
+  802b5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b5d:	5b                   	pop    %ebx
+  802b5e:	5e                   	pop    %esi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+		free(f->f_buf);
+  802b61:	83 ec 0c             	sub    $0xc,%esp
+  802b64:	ff 76 0c             	push   0xc(%esi)
+  802b67:	e8 54 08 00 00       	call   8033c0 <free>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+  802b6f:	eb e0                	jmp    802b51 <fclose+0x30>
+
+00802b71 <fileno>:
+{
+  802b71:	55                   	push   %ebp
+  802b72:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b77:	8b 00                	mov    (%eax),%eax
+}
+  802b79:	5d                   	pop    %ebp
+  802b7a:	c3                   	ret
+
+00802b7b <feof>:
+{
+  802b7b:	55                   	push   %ebp
+  802b7c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b81:	8b 40 04             	mov    0x4(%eax),%eax
+  802b84:	c1 e8 02             	shr    $0x2,%eax
+  802b87:	83 e0 01             	and    $0x1,%eax
+}
+  802b8a:	5d                   	pop    %ebp
+  802b8b:	c3                   	ret
+
+00802b8c <ferror>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b92:	8b 40 04             	mov    0x4(%eax),%eax
+  802b95:	c1 e8 03             	shr    $0x3,%eax
+  802b98:	83 e0 01             	and    $0x1,%eax
+}
+  802b9b:	5d                   	pop    %ebp
+  802b9c:	c3                   	ret
+
+00802b9d <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	53                   	push   %ebx
+  802ba1:	83 ec 04             	sub    $0x4,%esp
+  802ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ba7:	8b 43 18             	mov    0x18(%ebx),%eax
+  802baa:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802bad:	74 15                	je     802bc4 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802baf:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802bb2:	8b 43 14             	mov    0x14(%ebx),%eax
+  802bb5:	8d 48 01             	lea    0x1(%eax),%ecx
+  802bb8:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802bbb:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802bc4:	89 d8                	mov    %ebx,%eax
+  802bc6:	e8 67 fd ff ff       	call   802932 <stream_fill>
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	75 e0                	jne    802baf <fgetc+0x12>
+		return EOF;
+  802bcf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bd4:	eb e9                	jmp    802bbf <fgetc+0x22>
+
+00802bd6 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	57                   	push   %edi
+  802bda:	56                   	push   %esi
+  802bdb:	53                   	push   %ebx
+  802bdc:	83 ec 1c             	sub    $0x1c,%esp
+  802bdf:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802be2:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802be7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bea:	83 e8 01             	sub    $0x1,%eax
+  802bed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802bf0:	eb 66                	jmp    802c58 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802bf2:	8b 46 14             	mov    0x14(%esi),%eax
+  802bf5:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802bf8:	29 c3                	sub    %eax,%ebx
+  802bfa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802bfd:	29 fa                	sub    %edi,%edx
+  802bff:	39 d3                	cmp    %edx,%ebx
+  802c01:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c04:	83 ec 04             	sub    $0x4,%esp
+  802c07:	53                   	push   %ebx
+  802c08:	6a 0a                	push   $0xa
+  802c0a:	03 46 0c             	add    0xc(%esi),%eax
+  802c0d:	50                   	push   %eax
+  802c0e:	e8 a9 de ff ff       	call   800abc <memfind>
+  802c13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802c16:	8b 46 0c             	mov    0xc(%esi),%eax
+  802c19:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802c1c:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802c1f:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c21:	83 c4 10             	add    $0x10,%esp
+  802c24:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802c27:	74 0b                	je     802c34 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802c29:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c2c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c2f:	29 d3                	sub    %edx,%ebx
+  802c31:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802c34:	83 ec 04             	sub    $0x4,%esp
+  802c37:	53                   	push   %ebx
+  802c38:	01 c8                	add    %ecx,%eax
+  802c3a:	50                   	push   %eax
+  802c3b:	89 f8                	mov    %edi,%eax
+  802c3d:	03 45 08             	add    0x8(%ebp),%eax
+  802c40:	50                   	push   %eax
+  802c41:	e8 c5 dd ff ff       	call   800a0b <memmove>
+		f->f_rpos += m;
+  802c46:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802c49:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802c4b:	83 c4 10             	add    $0x10,%esp
+  802c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c51:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802c56:	74 1f                	je     802c77 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802c58:	8d 47 01             	lea    0x1(%edi),%eax
+  802c5b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802c5e:	73 17                	jae    802c77 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c60:	8b 46 18             	mov    0x18(%esi),%eax
+  802c63:	39 46 14             	cmp    %eax,0x14(%esi)
+  802c66:	75 8a                	jne    802bf2 <fgets+0x1c>
+  802c68:	89 f0                	mov    %esi,%eax
+  802c6a:	e8 c3 fc ff ff       	call   802932 <stream_fill>
+  802c6f:	85 c0                	test   %eax,%eax
+  802c71:	0f 85 7b ff ff ff    	jne    802bf2 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802c77:	85 ff                	test   %edi,%edi
+  802c79:	74 0f                	je     802c8a <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7e:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c85:	5b                   	pop    %ebx
+  802c86:	5e                   	pop    %esi
+  802c87:	5f                   	pop    %edi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+		return 0;
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	eb f1                	jmp    802c82 <fgets+0xac>
+
+00802c91 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802c91:	55                   	push   %ebp
+  802c92:	89 e5                	mov    %esp,%ebp
+  802c94:	57                   	push   %edi
+  802c95:	56                   	push   %esi
+  802c96:	53                   	push   %ebx
+  802c97:	83 ec 1c             	sub    $0x1c,%esp
+  802c9a:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802c9d:	89 f0                	mov    %esi,%eax
+  802c9f:	e8 21 fc ff ff       	call   8028c5 <stream_setup>
+	want = size * n;
+  802ca4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802cab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb3:	eb 43                	jmp    802cf8 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802cb5:	29 d3                	sub    %edx,%ebx
+  802cb7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cba:	29 f8                	sub    %edi,%eax
+  802cbc:	39 c3                	cmp    %eax,%ebx
+  802cbe:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802cc1:	83 ec 04             	sub    $0x4,%esp
+  802cc4:	53                   	push   %ebx
+  802cc5:	03 56 0c             	add    0xc(%esi),%edx
+  802cc8:	52                   	push   %edx
+  802cc9:	89 f8                	mov    %edi,%eax
+  802ccb:	03 45 08             	add    0x8(%ebp),%eax
+  802cce:	50                   	push   %eax
+  802ccf:	e8 37 dd ff ff       	call   800a0b <memmove>
+			f->f_rpos += m;
+  802cd4:	01 5e 14             	add    %ebx,0x14(%esi)
+  802cd7:	83 c4 10             	add    $0x10,%esp
+  802cda:	eb 1a                	jmp    802cf6 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802cdc:	83 ec 04             	sub    $0x4,%esp
+  802cdf:	53                   	push   %ebx
+  802ce0:	89 f8                	mov    %edi,%eax
+  802ce2:	03 45 08             	add    0x8(%ebp),%eax
+  802ce5:	50                   	push   %eax
+  802ce6:	ff 36                	push   (%esi)
+  802ce8:	e8 86 ef ff ff       	call   801c73 <read>
+  802ced:	89 c3                	mov    %eax,%ebx
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	7e 36                	jle    802d2c <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802cf6:	01 df                	add    %ebx,%edi
+  802cf8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cfb:	39 c7                	cmp    %eax,%edi
+  802cfd:	73 39                	jae    802d38 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802cff:	8b 56 14             	mov    0x14(%esi),%edx
+  802d02:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802d05:	39 da                	cmp    %ebx,%edx
+  802d07:	72 ac                	jb     802cb5 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802d09:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d0c:	29 fb                	sub    %edi,%ebx
+  802d0e:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802d11:	72 3e                	jb     802d51 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802d13:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802d17:	74 1f                	je     802d38 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802d19:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802d1d:	74 bd                	je     802cdc <fread+0x4b>
+  802d1f:	89 f0                	mov    %esi,%eax
+  802d21:	e8 2f fb ff ff       	call   802855 <stream_drain>
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	79 b2                	jns    802cdc <fread+0x4b>
+  802d2a:	eb 0c                	jmp    802d38 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802d2c:	c1 fb 1f             	sar    $0x1f,%ebx
+  802d2f:	83 e3 04             	and    $0x4,%ebx
+  802d32:	83 c3 04             	add    $0x4,%ebx
+  802d35:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802d38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	74 0a                	je     802d49 <fread+0xb8>
+  802d3f:	89 f8                	mov    %edi,%eax
+  802d41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d46:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4c:	5b                   	pop    %ebx
+  802d4d:	5e                   	pop    %esi
+  802d4e:	5f                   	pop    %edi
+  802d4f:	5d                   	pop    %ebp
+  802d50:	c3                   	ret
+		} else if (!stream_fill(f))
+  802d51:	89 f0                	mov    %esi,%eax
+  802d53:	e8 da fb ff ff       	call   802932 <stream_fill>
+  802d58:	85 c0                	test   %eax,%eax
+  802d5a:	74 dc                	je     802d38 <fread+0xa7>
+			m = 0;
+  802d5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d61:	eb 93                	jmp    802cf6 <fread+0x65>
+
+00802d63 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802d63:	55                   	push   %ebp
+  802d64:	89 e5                	mov    %esp,%ebp
+  802d66:	57                   	push   %edi
+  802d67:	56                   	push   %esi
+  802d68:	53                   	push   %ebx
+  802d69:	83 ec 1c             	sub    $0x1c,%esp
+  802d6c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802d6f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d72:	a8 02                	test   $0x2,%al
+  802d74:	75 13                	jne    802d89 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802d76:	83 c8 08             	or     $0x8,%eax
+  802d79:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802d81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d84:	5b                   	pop    %ebx
+  802d85:	5e                   	pop    %esi
+  802d86:	5f                   	pop    %edi
+  802d87:	5d                   	pop    %ebp
+  802d88:	c3                   	ret
+	stream_setup(f);
+  802d89:	89 d8                	mov    %ebx,%eax
+  802d8b:	e8 35 fb ff ff       	call   8028c5 <stream_setup>
+	want = size * n;
+  802d90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d93:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802d9a:	89 d8                	mov    %ebx,%eax
+  802d9c:	e8 41 fa ff ff       	call   8027e2 <stream_unread>
+	for (done = 0; done < want; ) {
+  802da1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802da6:	84 c0                	test   %al,%al
+  802da8:	75 7b                	jne    802e25 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802daa:	be 00 00 00 00       	mov    $0x0,%esi
+  802daf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802db2:	39 fe                	cmp    %edi,%esi
+  802db4:	73 24                	jae    802dda <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802db6:	83 ec 04             	sub    $0x4,%esp
+  802db9:	89 f8                	mov    %edi,%eax
+  802dbb:	29 f0                	sub    %esi,%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	89 f0                	mov    %esi,%eax
+  802dc0:	03 45 08             	add    0x8(%ebp),%eax
+  802dc3:	50                   	push   %eax
+  802dc4:	ff 33                	push   (%ebx)
+  802dc6:	e8 a0 ef ff ff       	call   801d6b <write>
+  802dcb:	83 c4 10             	add    $0x10,%esp
+  802dce:	85 c0                	test   %eax,%eax
+  802dd0:	7e 04                	jle    802dd6 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802dd2:	01 c6                	add    %eax,%esi
+  802dd4:	eb dc                	jmp    802db2 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802dd6:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802dda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ddd:	85 c0                	test   %eax,%eax
+  802ddf:	74 a0                	je     802d81 <fwrite+0x1e>
+  802de1:	89 f0                	mov    %esi,%eax
+  802de3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de8:	f7 75 0c             	divl   0xc(%ebp)
+  802deb:	eb 94                	jmp    802d81 <fwrite+0x1e>
+			done += r;
+  802ded:	01 c7                	add    %eax,%edi
+			continue;
+  802def:	eb 34                	jmp    802e25 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802df1:	8b 73 10             	mov    0x10(%ebx),%esi
+  802df4:	29 c6                	sub    %eax,%esi
+  802df6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802df9:	29 fa                	sub    %edi,%edx
+  802dfb:	39 d6                	cmp    %edx,%esi
+  802dfd:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802e00:	83 ec 04             	sub    $0x4,%esp
+  802e03:	56                   	push   %esi
+  802e04:	89 fa                	mov    %edi,%edx
+  802e06:	03 55 08             	add    0x8(%ebp),%edx
+  802e09:	52                   	push   %edx
+  802e0a:	03 43 0c             	add    0xc(%ebx),%eax
+  802e0d:	50                   	push   %eax
+  802e0e:	e8 f8 db ff ff       	call   800a0b <memmove>
+		f->f_wend += m;
+  802e13:	89 f0                	mov    %esi,%eax
+  802e15:	03 43 1c             	add    0x1c(%ebx),%eax
+  802e18:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802e1b:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e1d:	83 c4 10             	add    $0x10,%esp
+  802e20:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802e23:	74 5b                	je     802e80 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802e25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e28:	39 c7                	cmp    %eax,%edi
+  802e2a:	73 2d                	jae    802e59 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802e2c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	75 be                	jne    802df1 <fwrite+0x8e>
+  802e33:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e36:	29 fa                	sub    %edi,%edx
+  802e38:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802e3b:	72 b4                	jb     802df1 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e3d:	83 ec 04             	sub    $0x4,%esp
+  802e40:	52                   	push   %edx
+  802e41:	89 f8                	mov    %edi,%eax
+  802e43:	03 45 08             	add    0x8(%ebp),%eax
+  802e46:	50                   	push   %eax
+  802e47:	ff 33                	push   (%ebx)
+  802e49:	e8 1d ef ff ff       	call   801d6b <write>
+  802e4e:	83 c4 10             	add    $0x10,%esp
+  802e51:	85 c0                	test   %eax,%eax
+  802e53:	7f 98                	jg     802ded <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802e55:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802e59:	8b 43 08             	mov    0x8(%ebx),%eax
+  802e5c:	83 f8 03             	cmp    $0x3,%eax
+  802e5f:	74 48                	je     802ea9 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e61:	83 f8 02             	cmp    $0x2,%eax
+  802e64:	74 27                	je     802e8d <fwrite+0x12a>
+	return size ? done / size : 0;
+  802e66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	0f 84 10 ff ff ff    	je     802d81 <fwrite+0x1e>
+  802e71:	89 f8                	mov    %edi,%eax
+  802e73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e78:	f7 75 0c             	divl   0xc(%ebp)
+  802e7b:	e9 01 ff ff ff       	jmp    802d81 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e80:	89 d8                	mov    %ebx,%eax
+  802e82:	e8 ce f9 ff ff       	call   802855 <stream_drain>
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	79 9a                	jns    802e25 <fwrite+0xc2>
+  802e8b:	eb cc                	jmp    802e59 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e8d:	83 ec 04             	sub    $0x4,%esp
+  802e90:	57                   	push   %edi
+  802e91:	6a 0a                	push   $0xa
+  802e93:	ff 75 08             	push   0x8(%ebp)
+  802e96:	e8 21 dc ff ff       	call   800abc <memfind>
+  802e9b:	89 c2                	mov    %eax,%edx
+  802e9d:	89 f8                	mov    %edi,%eax
+  802e9f:	03 45 08             	add    0x8(%ebp),%eax
+  802ea2:	83 c4 10             	add    $0x10,%esp
+  802ea5:	39 c2                	cmp    %eax,%edx
+  802ea7:	74 bd                	je     802e66 <fwrite+0x103>
+		stream_drain(f);
+  802ea9:	89 d8                	mov    %ebx,%eax
+  802eab:	e8 a5 f9 ff ff       	call   802855 <stream_drain>
+  802eb0:	eb b4                	jmp    802e66 <fwrite+0x103>
+
+00802eb2 <fputc>:
+{
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	53                   	push   %ebx
+  802eb6:	83 ec 14             	sub    $0x14,%esp
+  802eb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802ebc:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802ebf:	ff 75 0c             	push   0xc(%ebp)
+  802ec2:	6a 01                	push   $0x1
+  802ec4:	6a 01                	push   $0x1
+  802ec6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ec9:	50                   	push   %eax
+  802eca:	e8 94 fe ff ff       	call   802d63 <fwrite>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	0f b6 db             	movzbl %bl,%ebx
+  802ed5:	83 f8 01             	cmp    $0x1,%eax
+  802ed8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802edd:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802ee0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ee3:	c9                   	leave
+  802ee4:	c3                   	ret
+
+00802ee5 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802ee5:	55                   	push   %ebp
+  802ee6:	89 e5                	mov    %esp,%ebp
+  802ee8:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802eeb:	ff 75 0c             	push   0xc(%ebp)
+  802eee:	ff 75 08             	push   0x8(%ebp)
+  802ef1:	e8 bc ff ff ff       	call   802eb2 <fputc>
+}
+  802ef6:	83 c4 10             	add    $0x10,%esp
+  802ef9:	c9                   	leave
+  802efa:	c3                   	ret
+
+00802efb <fputs>:
+{
+  802efb:	55                   	push   %ebp
+  802efc:	89 e5                	mov    %esp,%ebp
+  802efe:	56                   	push   %esi
+  802eff:	53                   	push   %ebx
+  802f00:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802f03:	83 ec 0c             	sub    $0xc,%esp
+  802f06:	56                   	push   %esi
+  802f07:	e8 3e d9 ff ff       	call   80084a <strlen>
+  802f0c:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802f0e:	ff 75 0c             	push   0xc(%ebp)
+  802f11:	50                   	push   %eax
+  802f12:	6a 01                	push   $0x1
+  802f14:	56                   	push   %esi
+  802f15:	e8 49 fe ff ff       	call   802d63 <fwrite>
+  802f1a:	83 c4 20             	add    $0x20,%esp
+  802f1d:	39 d8                	cmp    %ebx,%eax
+  802f1f:	0f 95 c0             	setne  %al
+  802f22:	0f b6 c0             	movzbl %al,%eax
+  802f25:	f7 d8                	neg    %eax
+}
+  802f27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f2a:	5b                   	pop    %ebx
+  802f2b:	5e                   	pop    %esi
+  802f2c:	5d                   	pop    %ebp
+  802f2d:	c3                   	ret
+
+00802f2e <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802f2e:	55                   	push   %ebp
+  802f2f:	89 e5                	mov    %esp,%ebp
+  802f31:	53                   	push   %ebx
+  802f32:	83 ec 04             	sub    $0x4,%esp
+  802f35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f38:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802f3b:	50                   	push   %eax
+  802f3c:	ff 75 0c             	push   0xc(%ebp)
+  802f3f:	53                   	push   %ebx
+  802f40:	68 e5 2e 80 00       	push   $0x802ee5
+  802f45:	e8 4e d4 ff ff       	call   800398 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802f4a:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f4d:	c1 e0 1c             	shl    $0x1c,%eax
+  802f50:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802f53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f56:	c9                   	leave
+  802f57:	c3                   	ret
+
+00802f58 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f58:	55                   	push   %ebp
+  802f59:	89 e5                	mov    %esp,%ebp
+  802f5b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802f5e:	68 7c 4e 80 00       	push   $0x804e7c
+  802f63:	ff 75 0c             	push   0xc(%ebp)
+  802f66:	e8 1a d9 ff ff       	call   800885 <strcpy>
+	return 0;
+}
+  802f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f70:	c9                   	leave
+  802f71:	c3                   	ret
+
+00802f72 <devsock_close>:
+{
+  802f72:	55                   	push   %ebp
+  802f73:	89 e5                	mov    %esp,%ebp
+  802f75:	53                   	push   %ebx
+  802f76:	83 ec 10             	sub    $0x10,%esp
+  802f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802f7c:	53                   	push   %ebx
+  802f7d:	e8 86 15 00 00       	call   804508 <pageref>
+  802f82:	89 c2                	mov    %eax,%edx
+  802f84:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802f87:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802f8c:	83 fa 01             	cmp    $0x1,%edx
+  802f8f:	74 05                	je     802f96 <devsock_close+0x24>
+}
+  802f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802f96:	83 ec 0c             	sub    $0xc,%esp
+  802f99:	ff 73 0c             	push   0xc(%ebx)
+  802f9c:	e8 b7 02 00 00       	call   803258 <nsipc_close>
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	eb eb                	jmp    802f91 <devsock_close+0x1f>
+
+00802fa6 <devsock_write>:
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802fac:	6a 00                	push   $0x0
+  802fae:	ff 75 10             	push   0x10(%ebp)
+  802fb1:	ff 75 0c             	push   0xc(%ebp)
+  802fb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb7:	ff 70 0c             	push   0xc(%eax)
+  802fba:	e8 79 03 00 00       	call   803338 <nsipc_send>
+}
+  802fbf:	c9                   	leave
+  802fc0:	c3                   	ret
+
+00802fc1 <devsock_read>:
+{
+  802fc1:	55                   	push   %ebp
+  802fc2:	89 e5                	mov    %esp,%ebp
+  802fc4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802fc7:	6a 00                	push   $0x0
+  802fc9:	ff 75 10             	push   0x10(%ebp)
+  802fcc:	ff 75 0c             	push   0xc(%ebp)
+  802fcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd2:	ff 70 0c             	push   0xc(%eax)
+  802fd5:	e8 ef 02 00 00       	call   8032c9 <nsipc_recv>
+}
+  802fda:	c9                   	leave
+  802fdb:	c3                   	ret
+
+00802fdc <fd2sockid>:
+{
+  802fdc:	55                   	push   %ebp
+  802fdd:	89 e5                	mov    %esp,%ebp
+  802fdf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802fe2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802fe5:	52                   	push   %edx
+  802fe6:	50                   	push   %eax
+  802fe7:	e8 f7 e9 ff ff       	call   8019e3 <fd_lookup>
+  802fec:	83 c4 10             	add    $0x10,%esp
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 10                	js     803003 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ff3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ff6:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802ffc:	39 08                	cmp    %ecx,(%eax)
+  802ffe:	75 05                	jne    803005 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803000:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803003:	c9                   	leave
+  803004:	c3                   	ret
+		return -E_NOT_SUPP;
+  803005:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80300a:	eb f7                	jmp    803003 <fd2sockid+0x27>
+
+0080300c <alloc_sockfd>:
+{
+  80300c:	55                   	push   %ebp
+  80300d:	89 e5                	mov    %esp,%ebp
+  80300f:	56                   	push   %esi
+  803010:	53                   	push   %ebx
+  803011:	83 ec 1c             	sub    $0x1c,%esp
+  803014:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803016:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803019:	50                   	push   %eax
+  80301a:	e8 6e e9 ff ff       	call   80198d <fd_alloc>
+  80301f:	89 c3                	mov    %eax,%ebx
+  803021:	83 c4 10             	add    $0x10,%esp
+  803024:	85 c0                	test   %eax,%eax
+  803026:	78 43                	js     80306b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803028:	83 ec 04             	sub    $0x4,%esp
+  80302b:	68 07 04 00 00       	push   $0x407
+  803030:	ff 75 f4             	push   -0xc(%ebp)
+  803033:	6a 00                	push   $0x0
+  803035:	e8 89 dc ff ff       	call   800cc3 <sys_page_alloc>
+  80303a:	89 c3                	mov    %eax,%ebx
+  80303c:	83 c4 10             	add    $0x10,%esp
+  80303f:	85 c0                	test   %eax,%eax
+  803041:	78 28                	js     80306b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803043:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803046:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  80304c:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80304e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803051:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803058:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80305b:	83 ec 0c             	sub    $0xc,%esp
+  80305e:	50                   	push   %eax
+  80305f:	e8 02 e9 ff ff       	call   801966 <fd2num>
+  803064:	89 c3                	mov    %eax,%ebx
+  803066:	83 c4 10             	add    $0x10,%esp
+  803069:	eb 0c                	jmp    803077 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80306b:	83 ec 0c             	sub    $0xc,%esp
+  80306e:	56                   	push   %esi
+  80306f:	e8 e4 01 00 00       	call   803258 <nsipc_close>
+		return r;
+  803074:	83 c4 10             	add    $0x10,%esp
+}
+  803077:	89 d8                	mov    %ebx,%eax
+  803079:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80307c:	5b                   	pop    %ebx
+  80307d:	5e                   	pop    %esi
+  80307e:	5d                   	pop    %ebp
+  80307f:	c3                   	ret
+
+00803080 <accept>:
+{
+  803080:	55                   	push   %ebp
+  803081:	89 e5                	mov    %esp,%ebp
+  803083:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803086:	8b 45 08             	mov    0x8(%ebp),%eax
+  803089:	e8 4e ff ff ff       	call   802fdc <fd2sockid>
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	78 1b                	js     8030ad <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803092:	83 ec 04             	sub    $0x4,%esp
+  803095:	ff 75 10             	push   0x10(%ebp)
+  803098:	ff 75 0c             	push   0xc(%ebp)
+  80309b:	50                   	push   %eax
+  80309c:	e8 0e 01 00 00       	call   8031af <nsipc_accept>
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 05                	js     8030ad <accept+0x2d>
+	return alloc_sockfd(r);
+  8030a8:	e8 5f ff ff ff       	call   80300c <alloc_sockfd>
+}
+  8030ad:	c9                   	leave
+  8030ae:	c3                   	ret
+
+008030af <bind>:
+{
+  8030af:	55                   	push   %ebp
+  8030b0:	89 e5                	mov    %esp,%ebp
+  8030b2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b8:	e8 1f ff ff ff       	call   802fdc <fd2sockid>
+  8030bd:	85 c0                	test   %eax,%eax
+  8030bf:	78 12                	js     8030d3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8030c1:	83 ec 04             	sub    $0x4,%esp
+  8030c4:	ff 75 10             	push   0x10(%ebp)
+  8030c7:	ff 75 0c             	push   0xc(%ebp)
+  8030ca:	50                   	push   %eax
+  8030cb:	e8 31 01 00 00       	call   803201 <nsipc_bind>
+  8030d0:	83 c4 10             	add    $0x10,%esp
+}
+  8030d3:	c9                   	leave
+  8030d4:	c3                   	ret
+
+008030d5 <shutdown>:
+{
+  8030d5:	55                   	push   %ebp
+  8030d6:	89 e5                	mov    %esp,%ebp
+  8030d8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030de:	e8 f9 fe ff ff       	call   802fdc <fd2sockid>
+  8030e3:	85 c0                	test   %eax,%eax
+  8030e5:	78 0f                	js     8030f6 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8030e7:	83 ec 08             	sub    $0x8,%esp
+  8030ea:	ff 75 0c             	push   0xc(%ebp)
+  8030ed:	50                   	push   %eax
+  8030ee:	e8 43 01 00 00       	call   803236 <nsipc_shutdown>
+  8030f3:	83 c4 10             	add    $0x10,%esp
+}
+  8030f6:	c9                   	leave
+  8030f7:	c3                   	ret
+
+008030f8 <connect>:
+{
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803101:	e8 d6 fe ff ff       	call   802fdc <fd2sockid>
+  803106:	85 c0                	test   %eax,%eax
+  803108:	78 12                	js     80311c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80310a:	83 ec 04             	sub    $0x4,%esp
+  80310d:	ff 75 10             	push   0x10(%ebp)
+  803110:	ff 75 0c             	push   0xc(%ebp)
+  803113:	50                   	push   %eax
+  803114:	e8 59 01 00 00       	call   803272 <nsipc_connect>
+  803119:	83 c4 10             	add    $0x10,%esp
+}
+  80311c:	c9                   	leave
+  80311d:	c3                   	ret
+
+0080311e <listen>:
+{
+  80311e:	55                   	push   %ebp
+  80311f:	89 e5                	mov    %esp,%ebp
+  803121:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803124:	8b 45 08             	mov    0x8(%ebp),%eax
+  803127:	e8 b0 fe ff ff       	call   802fdc <fd2sockid>
+  80312c:	85 c0                	test   %eax,%eax
+  80312e:	78 0f                	js     80313f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803130:	83 ec 08             	sub    $0x8,%esp
+  803133:	ff 75 0c             	push   0xc(%ebp)
+  803136:	50                   	push   %eax
+  803137:	e8 6b 01 00 00       	call   8032a7 <nsipc_listen>
+  80313c:	83 c4 10             	add    $0x10,%esp
+}
+  80313f:	c9                   	leave
+  803140:	c3                   	ret
+
+00803141 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803141:	55                   	push   %ebp
+  803142:	89 e5                	mov    %esp,%ebp
+  803144:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803147:	ff 75 10             	push   0x10(%ebp)
+  80314a:	ff 75 0c             	push   0xc(%ebp)
+  80314d:	ff 75 08             	push   0x8(%ebp)
+  803150:	e8 41 02 00 00       	call   803396 <nsipc_socket>
+  803155:	83 c4 10             	add    $0x10,%esp
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	78 05                	js     803161 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80315c:	e8 ab fe ff ff       	call   80300c <alloc_sockfd>
+}
+  803161:	c9                   	leave
+  803162:	c3                   	ret
+
+00803163 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803163:	55                   	push   %ebp
+  803164:	89 e5                	mov    %esp,%ebp
+  803166:	53                   	push   %ebx
+  803167:	83 ec 04             	sub    $0x4,%esp
+  80316a:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80316c:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  803173:	74 26                	je     80319b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803175:	6a 07                	push   $0x7
+  803177:	68 00 80 80 00       	push   $0x808000
+  80317c:	53                   	push   %ebx
+  80317d:	ff 35 08 60 80 00    	push   0x806008
+  803183:	e8 49 e7 ff ff       	call   8018d1 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803188:	83 c4 0c             	add    $0xc,%esp
+  80318b:	6a 00                	push   $0x0
+  80318d:	6a 00                	push   $0x0
+  80318f:	6a 00                	push   $0x0
+  803191:	e8 45 e6 ff ff       	call   8017db <ipc_recv>
+}
+  803196:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803199:	c9                   	leave
+  80319a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	6a 02                	push   $0x2
+  8031a0:	e8 82 e7 ff ff       	call   801927 <ipc_find_env>
+  8031a5:	a3 08 60 80 00       	mov    %eax,0x806008
+  8031aa:	83 c4 10             	add    $0x10,%esp
+  8031ad:	eb c6                	jmp    803175 <nsipc+0x12>
+
+008031af <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8031af:	55                   	push   %ebp
+  8031b0:	89 e5                	mov    %esp,%ebp
+  8031b2:	56                   	push   %esi
+  8031b3:	53                   	push   %ebx
+  8031b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8031b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ba:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8031bf:	8b 06                	mov    (%esi),%eax
+  8031c1:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8031c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031cb:	e8 93 ff ff ff       	call   803163 <nsipc>
+  8031d0:	89 c3                	mov    %eax,%ebx
+  8031d2:	85 c0                	test   %eax,%eax
+  8031d4:	79 09                	jns    8031df <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8031d6:	89 d8                	mov    %ebx,%eax
+  8031d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031db:	5b                   	pop    %ebx
+  8031dc:	5e                   	pop    %esi
+  8031dd:	5d                   	pop    %ebp
+  8031de:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8031df:	83 ec 04             	sub    $0x4,%esp
+  8031e2:	ff 35 10 80 80 00    	push   0x808010
+  8031e8:	68 00 80 80 00       	push   $0x808000
+  8031ed:	ff 75 0c             	push   0xc(%ebp)
+  8031f0:	e8 16 d8 ff ff       	call   800a0b <memmove>
+		*addrlen = ret->ret_addrlen;
+  8031f5:	a1 10 80 80 00       	mov    0x808010,%eax
+  8031fa:	89 06                	mov    %eax,(%esi)
+  8031fc:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8031ff:	eb d5                	jmp    8031d6 <nsipc_accept+0x27>
+
+00803201 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	53                   	push   %ebx
+  803205:	83 ec 08             	sub    $0x8,%esp
+  803208:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80320b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80320e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803213:	53                   	push   %ebx
+  803214:	ff 75 0c             	push   0xc(%ebp)
+  803217:	68 04 80 80 00       	push   $0x808004
+  80321c:	e8 ea d7 ff ff       	call   800a0b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803221:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  803227:	b8 02 00 00 00       	mov    $0x2,%eax
+  80322c:	e8 32 ff ff ff       	call   803163 <nsipc>
+}
+  803231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803234:	c9                   	leave
+  803235:	c3                   	ret
+
+00803236 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803236:	55                   	push   %ebp
+  803237:	89 e5                	mov    %esp,%ebp
+  803239:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80323c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803244:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803247:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80324c:	b8 03 00 00 00       	mov    $0x3,%eax
+  803251:	e8 0d ff ff ff       	call   803163 <nsipc>
+}
+  803256:	c9                   	leave
+  803257:	c3                   	ret
+
+00803258 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80325e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803261:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  803266:	b8 04 00 00 00       	mov    $0x4,%eax
+  80326b:	e8 f3 fe ff ff       	call   803163 <nsipc>
+}
+  803270:	c9                   	leave
+  803271:	c3                   	ret
+
+00803272 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803272:	55                   	push   %ebp
+  803273:	89 e5                	mov    %esp,%ebp
+  803275:	53                   	push   %ebx
+  803276:	83 ec 08             	sub    $0x8,%esp
+  803279:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80327c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80327f:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803284:	53                   	push   %ebx
+  803285:	ff 75 0c             	push   0xc(%ebp)
+  803288:	68 04 80 80 00       	push   $0x808004
+  80328d:	e8 79 d7 ff ff       	call   800a0b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803292:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803298:	b8 05 00 00 00       	mov    $0x5,%eax
+  80329d:	e8 c1 fe ff ff       	call   803163 <nsipc>
+}
+  8032a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a5:	c9                   	leave
+  8032a6:	c3                   	ret
+
+008032a7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8032a7:	55                   	push   %ebp
+  8032a8:	89 e5                	mov    %esp,%ebp
+  8032aa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8032ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8032b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032b8:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8032bd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8032c2:	e8 9c fe ff ff       	call   803163 <nsipc>
+}
+  8032c7:	c9                   	leave
+  8032c8:	c3                   	ret
+
+008032c9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8032c9:	55                   	push   %ebp
+  8032ca:	89 e5                	mov    %esp,%ebp
+  8032cc:	56                   	push   %esi
+  8032cd:	53                   	push   %ebx
+  8032ce:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8032d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8032d9:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8032df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032e2:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8032e7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032ec:	e8 72 fe ff ff       	call   803163 <nsipc>
+  8032f1:	89 c3                	mov    %eax,%ebx
+  8032f3:	85 c0                	test   %eax,%eax
+  8032f5:	78 22                	js     803319 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8032f7:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8032fc:	39 c6                	cmp    %eax,%esi
+  8032fe:	0f 4e c6             	cmovle %esi,%eax
+  803301:	39 c3                	cmp    %eax,%ebx
+  803303:	7f 1d                	jg     803322 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803305:	83 ec 04             	sub    $0x4,%esp
+  803308:	53                   	push   %ebx
+  803309:	68 00 80 80 00       	push   $0x808000
+  80330e:	ff 75 0c             	push   0xc(%ebp)
+  803311:	e8 f5 d6 ff ff       	call   800a0b <memmove>
+  803316:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803319:	89 d8                	mov    %ebx,%eax
+  80331b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80331e:	5b                   	pop    %ebx
+  80331f:	5e                   	pop    %esi
+  803320:	5d                   	pop    %ebp
+  803321:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803322:	68 88 4e 80 00       	push   $0x804e88
+  803327:	68 31 4d 80 00       	push   $0x804d31
+  80332c:	6a 62                	push   $0x62
+  80332e:	68 9d 4e 80 00       	push   $0x804e9d
+  803333:	e8 8e ce ff ff       	call   8001c6 <_panic>
+
+00803338 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803338:	55                   	push   %ebp
+  803339:	89 e5                	mov    %esp,%ebp
+  80333b:	53                   	push   %ebx
+  80333c:	83 ec 04             	sub    $0x4,%esp
+  80333f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803342:	8b 45 08             	mov    0x8(%ebp),%eax
+  803345:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80334a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803350:	7f 2e                	jg     803380 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803352:	83 ec 04             	sub    $0x4,%esp
+  803355:	53                   	push   %ebx
+  803356:	ff 75 0c             	push   0xc(%ebp)
+  803359:	68 0c 80 80 00       	push   $0x80800c
+  80335e:	e8 a8 d6 ff ff       	call   800a0b <memmove>
+	nsipcbuf.send.req_size = size;
+  803363:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  803369:	8b 45 14             	mov    0x14(%ebp),%eax
+  80336c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  803371:	b8 08 00 00 00       	mov    $0x8,%eax
+  803376:	e8 e8 fd ff ff       	call   803163 <nsipc>
+}
+  80337b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80337e:	c9                   	leave
+  80337f:	c3                   	ret
+	assert(size < 1600);
+  803380:	68 a9 4e 80 00       	push   $0x804ea9
+  803385:	68 31 4d 80 00       	push   $0x804d31
+  80338a:	6a 6d                	push   $0x6d
+  80338c:	68 9d 4e 80 00       	push   $0x804e9d
+  803391:	e8 30 ce ff ff       	call   8001c6 <_panic>
+
+00803396 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803396:	55                   	push   %ebp
+  803397:	89 e5                	mov    %esp,%ebp
+  803399:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80339c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80339f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8033a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033a7:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8033ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033af:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8033b4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8033b9:	e8 a5 fd ff ff       	call   803163 <nsipc>
+}
+  8033be:	c9                   	leave
+  8033bf:	c3                   	ret
+
+008033c0 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8033c0:	55                   	push   %ebp
+  8033c1:	89 e5                	mov    %esp,%ebp
+  8033c3:	53                   	push   %ebx
+  8033c4:	83 ec 10             	sub    $0x10,%esp
+  8033c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8033ca:	68 0c 60 80 00       	push   $0x80600c
+  8033cf:	e8 50 07 00 00       	call   803b24 <mutex_lock>
+	if (v == 0)
+  8033d4:	83 c4 10             	add    $0x10,%esp
+  8033d7:	85 db                	test   %ebx,%ebx
+  8033d9:	0f 84 85 00 00 00    	je     803464 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8033df:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8033e5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8033ea:	77 51                	ja     80343d <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8033ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8033f2:	89 d8                	mov    %ebx,%eax
+  8033f4:	c1 e8 0c             	shr    $0xc,%eax
+  8033f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033fe:	f6 c4 02             	test   $0x2,%ah
+  803401:	74 50                	je     803453 <free+0x93>
+		sys_page_unmap(0, c);
+  803403:	83 ec 08             	sub    $0x8,%esp
+  803406:	53                   	push   %ebx
+  803407:	6a 00                	push   $0x0
+  803409:	e8 4e d9 ff ff       	call   800d5c <sys_page_unmap>
+		c += PGSIZE;
+  80340e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803414:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80341a:	83 c4 10             	add    $0x10,%esp
+  80341d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803422:	76 ce                	jbe    8033f2 <free+0x32>
+  803424:	68 f3 4e 80 00       	push   $0x804ef3
+  803429:	68 31 4d 80 00       	push   $0x804d31
+  80342e:	68 82 00 00 00       	push   $0x82
+  803433:	68 e6 4e 80 00       	push   $0x804ee6
+  803438:	e8 89 cd ff ff       	call   8001c6 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80343d:	68 b8 4e 80 00       	push   $0x804eb8
+  803442:	68 31 4d 80 00       	push   $0x804d31
+  803447:	6a 7b                	push   $0x7b
+  803449:	68 e6 4e 80 00       	push   $0x804ee6
+  80344e:	e8 73 cd ff ff       	call   8001c6 <_panic>
+	if (--(*ref) == 0)
+  803453:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803459:	83 e8 01             	sub    $0x1,%eax
+  80345c:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803462:	74 15                	je     803479 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803464:	83 ec 0c             	sub    $0xc,%esp
+  803467:	68 0c 60 80 00       	push   $0x80600c
+  80346c:	e8 20 07 00 00       	call   803b91 <mutex_unlock>
+}
+  803471:	83 c4 10             	add    $0x10,%esp
+  803474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803477:	c9                   	leave
+  803478:	c3                   	ret
+		sys_page_unmap(0, c);
+  803479:	83 ec 08             	sub    $0x8,%esp
+  80347c:	53                   	push   %ebx
+  80347d:	6a 00                	push   $0x0
+  80347f:	e8 d8 d8 ff ff       	call   800d5c <sys_page_unmap>
+  803484:	83 c4 10             	add    $0x10,%esp
+  803487:	eb db                	jmp    803464 <free+0xa4>
+
+00803489 <malloc>:
+{
+  803489:	55                   	push   %ebp
+  80348a:	89 e5                	mov    %esp,%ebp
+  80348c:	57                   	push   %edi
+  80348d:	56                   	push   %esi
+  80348e:	53                   	push   %ebx
+  80348f:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803492:	68 0c 60 80 00       	push   $0x80600c
+  803497:	e8 88 06 00 00       	call   803b24 <mutex_lock>
+	if (mptr == 0)
+  80349c:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8034a2:	83 c4 10             	add    $0x10,%esp
+  8034a5:	85 ff                	test   %edi,%edi
+  8034a7:	74 6c                	je     803515 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8034a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ac:	83 c0 03             	add    $0x3,%eax
+  8034af:	83 e0 fc             	and    $0xfffffffc,%eax
+  8034b2:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8034b4:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8034b9:	0f 87 64 01 00 00    	ja     803623 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8034bf:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034c5:	74 30                	je     8034f7 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8034c7:	89 f9                	mov    %edi,%ecx
+  8034c9:	c1 e9 0c             	shr    $0xc,%ecx
+  8034cc:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8034d0:	c1 e8 0c             	shr    $0xc,%eax
+  8034d3:	39 c1                	cmp    %eax,%ecx
+  8034d5:	74 5f                	je     803536 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8034d7:	83 ec 0c             	sub    $0xc,%esp
+  8034da:	57                   	push   %edi
+  8034db:	e8 e0 fe ff ff       	call   8033c0 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8034e0:	a1 10 60 80 00       	mov    0x806010,%eax
+  8034e5:	05 00 10 00 00       	add    $0x1000,%eax
+  8034ea:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8034ef:	a3 10 60 80 00       	mov    %eax,0x806010
+  8034f4:	83 c4 10             	add    $0x10,%esp
+  8034f7:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  8034fd:	ba 02 00 00 00       	mov    $0x2,%edx
+  803502:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803506:	8d 7e 04             	lea    0x4(%esi),%edi
+  803509:	89 cb                	mov    %ecx,%ebx
+  80350b:	01 f9                	add    %edi,%ecx
+  80350d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803510:	e9 8b 00 00 00       	jmp    8035a0 <malloc+0x117>
+		mptr = mbegin;
+  803515:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80351c:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80351f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803522:	83 c0 03             	add    $0x3,%eax
+  803525:	83 e0 fc             	and    $0xfffffffc,%eax
+  803528:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80352a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80352f:	76 c6                	jbe    8034f7 <malloc+0x6e>
+  803531:	e9 d6 00 00 00       	jmp    80360c <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803536:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80353c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803541:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803545:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803548:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80354d:	e9 ba 00 00 00       	jmp    80360c <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803552:	05 00 10 00 00       	add    $0x1000,%eax
+  803557:	39 c8                	cmp    %ecx,%eax
+  803559:	0f 83 cb 00 00 00    	jae    80362a <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80355f:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803564:	77 22                	ja     803588 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803566:	89 c2                	mov    %eax,%edx
+  803568:	c1 ea 16             	shr    $0x16,%edx
+  80356b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803572:	f6 c2 01             	test   $0x1,%dl
+  803575:	74 db                	je     803552 <malloc+0xc9>
+  803577:	89 c2                	mov    %eax,%edx
+  803579:	c1 ea 0c             	shr    $0xc,%edx
+  80357c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803583:	f6 c2 01             	test   $0x1,%dl
+  803586:	74 ca                	je     803552 <malloc+0xc9>
+		if (mptr == mend) {
+  803588:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80358e:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803594:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803598:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80359e:	74 04                	je     8035a4 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8035a0:	89 d8                	mov    %ebx,%eax
+  8035a2:	eb b3                	jmp    803557 <malloc+0xce>
+  8035a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8035a7:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8035ac:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8035b0:	83 ea 01             	sub    $0x1,%edx
+  8035b3:	0f 85 50 ff ff ff    	jne    803509 <malloc+0x80>
+  8035b9:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8035c0:	00 00 08 
+				return 0;	/* out of address space */
+  8035c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c8:	eb 42                	jmp    80360c <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8035ca:	85 db                	test   %ebx,%ebx
+  8035cc:	78 1e                	js     8035ec <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8035ce:	83 ec 08             	sub    $0x8,%esp
+  8035d1:	89 d8                	mov    %ebx,%eax
+  8035d3:	03 05 10 60 80 00    	add    0x806010,%eax
+  8035d9:	50                   	push   %eax
+  8035da:	6a 00                	push   $0x0
+  8035dc:	e8 7b d7 ff ff       	call   800d5c <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8035e1:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	eb de                	jmp    8035ca <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8035ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f1:	eb 19                	jmp    80360c <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8035f3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8035f6:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8035fc:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803603:	00 
+	mptr += n;
+  803604:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803607:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80360c:	83 ec 0c             	sub    $0xc,%esp
+  80360f:	68 0c 60 80 00       	push   $0x80600c
+  803614:	e8 78 05 00 00       	call   803b91 <mutex_unlock>
+}
+  803619:	89 f8                	mov    %edi,%eax
+  80361b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80361e:	5b                   	pop    %ebx
+  80361f:	5e                   	pop    %esi
+  803620:	5f                   	pop    %edi
+  803621:	5d                   	pop    %ebp
+  803622:	c3                   	ret
+		return 0;
+  803623:	bf 00 00 00 00       	mov    $0x0,%edi
+  803628:	eb e2                	jmp    80360c <malloc+0x183>
+  80362a:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80362e:	74 06                	je     803636 <malloc+0x1ad>
+  803630:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80363b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80363e:	39 fb                	cmp    %edi,%ebx
+  803640:	73 b1                	jae    8035f3 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803642:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803648:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80364b:	39 fe                	cmp    %edi,%esi
+  80364d:	0f 92 c0             	setb   %al
+  803650:	0f b6 c0             	movzbl %al,%eax
+  803653:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803656:	83 c8 07             	or     $0x7,%eax
+  803659:	50                   	push   %eax
+  80365a:	89 d8                	mov    %ebx,%eax
+  80365c:	03 05 10 60 80 00    	add    0x806010,%eax
+  803662:	50                   	push   %eax
+  803663:	6a 00                	push   $0x0
+  803665:	e8 59 d6 ff ff       	call   800cc3 <sys_page_alloc>
+  80366a:	83 c4 10             	add    $0x10,%esp
+  80366d:	85 c0                	test   %eax,%eax
+  80366f:	0f 88 55 ff ff ff    	js     8035ca <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803675:	89 f3                	mov    %esi,%ebx
+  803677:	eb c5                	jmp    80363e <malloc+0x1b5>
+
+00803679 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803679:	55                   	push   %ebp
+  80367a:	89 e5                	mov    %esp,%ebp
+  80367c:	56                   	push   %esi
+  80367d:	53                   	push   %ebx
+  80367e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803681:	83 ec 0c             	sub    $0xc,%esp
+  803684:	ff 75 08             	push   0x8(%ebp)
+  803687:	e8 ea e2 ff ff       	call   801976 <fd2data>
+  80368c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80368e:	83 c4 08             	add    $0x8,%esp
+  803691:	68 0b 4f 80 00       	push   $0x804f0b
+  803696:	53                   	push   %ebx
+  803697:	e8 e9 d1 ff ff       	call   800885 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80369c:	8b 46 04             	mov    0x4(%esi),%eax
+  80369f:	2b 06                	sub    (%esi),%eax
+  8036a1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8036a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8036ae:	00 00 00 
+	stat->st_dev = &devpipe;
+  8036b1:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8036b8:	52 80 00 
+	return 0;
+}
+  8036bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036c3:	5b                   	pop    %ebx
+  8036c4:	5e                   	pop    %esi
+  8036c5:	5d                   	pop    %ebp
+  8036c6:	c3                   	ret
+
+008036c7 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8036c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036cc:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8036d0:	85 c9                	test   %ecx,%ecx
+  8036d2:	75 01                	jne    8036d5 <pipewake+0xe>
+  8036d4:	c3                   	ret
+{
+  8036d5:	55                   	push   %ebp
+  8036d6:	89 e5                	mov    %esp,%ebp
+  8036d8:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8036db:	68 00 04 00 00       	push   $0x400
+  8036e0:	52                   	push   %edx
+  8036e1:	e8 21 d9 ff ff       	call   801007 <sys_futex_wake>
+  8036e6:	83 c4 10             	add    $0x10,%esp
+}
+  8036e9:	c9                   	leave
+  8036ea:	c3                   	ret
+
+008036eb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8036eb:	55                   	push   %ebp
+  8036ec:	89 e5                	mov    %esp,%ebp
+  8036ee:	56                   	push   %esi
+  8036ef:	53                   	push   %ebx
+  8036f0:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8036f3:	83 ec 0c             	sub    $0xc,%esp
+  8036f6:	56                   	push   %esi
+  8036f7:	e8 7a e2 ff ff       	call   801976 <fd2data>
+  8036fc:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8036fe:	83 c4 08             	add    $0x8,%esp
+  803701:	56                   	push   %esi
+  803702:	6a 00                	push   $0x0
+  803704:	e8 53 d6 ff ff       	call   800d5c <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803709:	8d 53 04             	lea    0x4(%ebx),%edx
+  80370c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80370f:	e8 b3 ff ff ff       	call   8036c7 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803714:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803717:	89 da                	mov    %ebx,%edx
+  803719:	e8 a9 ff ff ff       	call   8036c7 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80371e:	89 34 24             	mov    %esi,(%esp)
+  803721:	e8 50 e2 ff ff       	call   801976 <fd2data>
+  803726:	83 c4 08             	add    $0x8,%esp
+  803729:	50                   	push   %eax
+  80372a:	6a 00                	push   $0x0
+  80372c:	e8 2b d6 ff ff       	call   800d5c <sys_page_unmap>
+}
+  803731:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803734:	5b                   	pop    %ebx
+  803735:	5e                   	pop    %esi
+  803736:	5d                   	pop    %ebp
+  803737:	c3                   	ret
+
+00803738 <_pipeisclosed>:
+{
+  803738:	55                   	push   %ebp
+  803739:	89 e5                	mov    %esp,%ebp
+  80373b:	57                   	push   %edi
+  80373c:	56                   	push   %esi
+  80373d:	53                   	push   %ebx
+  80373e:	83 ec 1c             	sub    $0x1c,%esp
+  803741:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803744:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803746:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80374b:	eb 5d                	jmp    8037aa <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80374d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  803753:	8b 02                	mov    (%edx),%eax
+  803755:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803758:	83 ec 0c             	sub    $0xc,%esp
+  80375b:	ff 75 e0             	push   -0x20(%ebp)
+  80375e:	e8 a5 0d 00 00       	call   804508 <pageref>
+  803763:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803766:	89 3c 24             	mov    %edi,(%esp)
+  803769:	e8 9a 0d 00 00       	call   804508 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80376e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803770:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803776:	83 c4 10             	add    $0x10,%esp
+  803779:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80377f:	77 15                	ja     803796 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803781:	89 f2                	mov    %esi,%edx
+  803783:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803785:	c1 ea 10             	shr    $0x10,%edx
+  803788:	74 0c                	je     803796 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80378a:	c1 e2 10             	shl    $0x10,%edx
+  80378d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803792:	29 d1                	sub    %edx,%ecx
+  803794:	eb 06                	jmp    80379c <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803796:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  80379c:	8b 11                	mov    (%ecx),%edx
+  80379e:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8037a1:	39 d3                	cmp    %edx,%ebx
+  8037a3:	74 6e                	je     803813 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8037a5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037a8:	74 24                	je     8037ce <_pipeisclosed+0x96>
+  8037aa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037ac:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037b2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037b7:	77 94                	ja     80374d <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037b9:	89 f0                	mov    %esi,%eax
+  8037bb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8037bd:	c1 e8 10             	shr    $0x10,%eax
+  8037c0:	74 8b                	je     80374d <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037c2:	c1 e0 10             	shl    $0x10,%eax
+  8037c5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037ca:	29 c2                	sub    %eax,%edx
+  8037cc:	eb 85                	jmp    803753 <_pipeisclosed+0x1b>
+  8037ce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037d0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037d6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037db:	77 18                	ja     8037f5 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037dd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8037e2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8037e4:	c1 e8 10             	shr    $0x10,%eax
+  8037e7:	74 0c                	je     8037f5 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037e9:	c1 e0 10             	shl    $0x10,%eax
+  8037ec:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037f1:	29 c2                	sub    %eax,%edx
+  8037f3:	eb 06                	jmp    8037fb <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8037f5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8037fb:	8b 02                	mov    (%edx),%eax
+  8037fd:	8b 40 58             	mov    0x58(%eax),%eax
+  803800:	6a 01                	push   $0x1
+  803802:	50                   	push   %eax
+  803803:	53                   	push   %ebx
+  803804:	68 12 4f 80 00       	push   $0x804f12
+  803809:	e8 93 ca ff ff       	call   8002a1 <cprintf>
+  80380e:	83 c4 10             	add    $0x10,%esp
+  803811:	eb 97                	jmp    8037aa <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803813:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803816:	0f 94 c0             	sete   %al
+  803819:	0f b6 c0             	movzbl %al,%eax
+}
+  80381c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80381f:	5b                   	pop    %ebx
+  803820:	5e                   	pop    %esi
+  803821:	5f                   	pop    %edi
+  803822:	5d                   	pop    %ebp
+  803823:	c3                   	ret
+
+00803824 <devpipe_write>:
+{
+  803824:	55                   	push   %ebp
+  803825:	89 e5                	mov    %esp,%ebp
+  803827:	57                   	push   %edi
+  803828:	56                   	push   %esi
+  803829:	53                   	push   %ebx
+  80382a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80382d:	ff 75 08             	push   0x8(%ebp)
+  803830:	e8 41 e1 ff ff       	call   801976 <fd2data>
+  803835:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803837:	83 c4 10             	add    $0x10,%esp
+  80383a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803841:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803844:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803847:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80384a:	0f 84 96 00 00 00    	je     8038e6 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803850:	8d 73 08             	lea    0x8(%ebx),%esi
+  803853:	eb 32                	jmp    803887 <devpipe_write+0x63>
+  803855:	89 fa                	mov    %edi,%edx
+  803857:	89 f0                	mov    %esi,%eax
+  803859:	e8 69 fe ff ff       	call   8036c7 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80385e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803861:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803864:	ba 01 00 00 00       	mov    $0x1,%edx
+  803869:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80386e:	83 ec 04             	sub    $0x4,%esp
+  803871:	6a 0a                	push   $0xa
+  803873:	50                   	push   %eax
+  803874:	53                   	push   %ebx
+  803875:	e8 5e d7 ff ff       	call   800fd8 <sys_futex_wait>
+  80387a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80387f:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803884:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803887:	8b 43 04             	mov    0x4(%ebx),%eax
+  80388a:	8b 0b                	mov    (%ebx),%ecx
+  80388c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80388f:	39 d0                	cmp    %edx,%eax
+  803891:	72 1b                	jb     8038ae <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803893:	89 da                	mov    %ebx,%edx
+  803895:	8b 45 08             	mov    0x8(%ebp),%eax
+  803898:	e8 9b fe ff ff       	call   803738 <_pipeisclosed>
+  80389d:	85 c0                	test   %eax,%eax
+  80389f:	74 b4                	je     803855 <devpipe_write+0x31>
+				return 0;
+  8038a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038a9:	5b                   	pop    %ebx
+  8038aa:	5e                   	pop    %esi
+  8038ab:	5f                   	pop    %edi
+  8038ac:	5d                   	pop    %ebp
+  8038ad:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8038ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038b1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8038b4:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8038b8:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8038bb:	89 c2                	mov    %eax,%edx
+  8038bd:	c1 fa 1f             	sar    $0x1f,%edx
+  8038c0:	89 d1                	mov    %edx,%ecx
+  8038c2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038c5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8038c8:	83 e2 1f             	and    $0x1f,%edx
+  8038cb:	29 ca                	sub    %ecx,%edx
+  8038cd:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8038d1:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8038d5:	83 c0 01             	add    $0x1,%eax
+  8038d8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8038db:	83 c6 01             	add    $0x1,%esi
+  8038de:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8038e1:	e9 5e ff ff ff       	jmp    803844 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8038e6:	8d 53 04             	lea    0x4(%ebx),%edx
+  8038e9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8038ec:	e8 d6 fd ff ff       	call   8036c7 <pipewake>
+	return i;
+  8038f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038f4:	eb b0                	jmp    8038a6 <devpipe_write+0x82>
+
+008038f6 <devpipe_read>:
+{
+  8038f6:	55                   	push   %ebp
+  8038f7:	89 e5                	mov    %esp,%ebp
+  8038f9:	57                   	push   %edi
+  8038fa:	56                   	push   %esi
+  8038fb:	53                   	push   %ebx
+  8038fc:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8038ff:	ff 75 08             	push   0x8(%ebp)
+  803902:	e8 6f e0 ff ff       	call   801976 <fd2data>
+  803907:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803909:	83 c4 10             	add    $0x10,%esp
+  80390c:	be 00 00 00 00       	mov    $0x0,%esi
+  803911:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803914:	74 6c                	je     803982 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803916:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803919:	eb 25                	jmp    803940 <devpipe_read+0x4a>
+  80391b:	8b 13                	mov    (%ebx),%edx
+  80391d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803922:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803927:	83 ec 04             	sub    $0x4,%esp
+  80392a:	6a 0a                	push   $0xa
+  80392c:	52                   	push   %edx
+  80392d:	57                   	push   %edi
+  80392e:	e8 a5 d6 ff ff       	call   800fd8 <sys_futex_wait>
+  803933:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803938:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80393d:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803940:	8b 03                	mov    (%ebx),%eax
+  803942:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803945:	75 19                	jne    803960 <devpipe_read+0x6a>
+			if (i > 0)
+  803947:	85 f6                	test   %esi,%esi
+  803949:	75 3a                	jne    803985 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80394b:	89 da                	mov    %ebx,%edx
+  80394d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803950:	e8 e3 fd ff ff       	call   803738 <_pipeisclosed>
+  803955:	85 c0                	test   %eax,%eax
+  803957:	74 c2                	je     80391b <devpipe_read+0x25>
+				return 0;
+  803959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395e:	eb 31                	jmp    803991 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803960:	89 c1                	mov    %eax,%ecx
+  803962:	c1 f9 1f             	sar    $0x1f,%ecx
+  803965:	c1 e9 1b             	shr    $0x1b,%ecx
+  803968:	01 c8                	add    %ecx,%eax
+  80396a:	83 e0 1f             	and    $0x1f,%eax
+  80396d:	29 c8                	sub    %ecx,%eax
+  80396f:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803977:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80397a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80397d:	83 c6 01             	add    $0x1,%esi
+  803980:	eb 8f                	jmp    803911 <devpipe_read+0x1b>
+out:
+  803982:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803985:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803988:	89 da                	mov    %ebx,%edx
+  80398a:	e8 38 fd ff ff       	call   8036c7 <pipewake>
+	return i;
+  80398f:	89 f0                	mov    %esi,%eax
+}
+  803991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803994:	5b                   	pop    %ebx
+  803995:	5e                   	pop    %esi
+  803996:	5f                   	pop    %edi
+  803997:	5d                   	pop    %ebp
+  803998:	c3                   	ret
+
+00803999 <pipe>:
+{
+  803999:	55                   	push   %ebp
+  80399a:	89 e5                	mov    %esp,%ebp
+  80399c:	56                   	push   %esi
+  80399d:	53                   	push   %ebx
+  80399e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8039a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039a4:	50                   	push   %eax
+  8039a5:	e8 e3 df ff ff       	call   80198d <fd_alloc>
+  8039aa:	89 c3                	mov    %eax,%ebx
+  8039ac:	83 c4 10             	add    $0x10,%esp
+  8039af:	85 c0                	test   %eax,%eax
+  8039b1:	0f 88 23 01 00 00    	js     803ada <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039b7:	83 ec 04             	sub    $0x4,%esp
+  8039ba:	68 07 04 00 00       	push   $0x407
+  8039bf:	ff 75 f4             	push   -0xc(%ebp)
+  8039c2:	6a 00                	push   $0x0
+  8039c4:	e8 fa d2 ff ff       	call   800cc3 <sys_page_alloc>
+  8039c9:	89 c3                	mov    %eax,%ebx
+  8039cb:	83 c4 10             	add    $0x10,%esp
+  8039ce:	85 c0                	test   %eax,%eax
+  8039d0:	0f 88 04 01 00 00    	js     803ada <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8039d6:	83 ec 0c             	sub    $0xc,%esp
+  8039d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8039dc:	50                   	push   %eax
+  8039dd:	e8 ab df ff ff       	call   80198d <fd_alloc>
+  8039e2:	89 c3                	mov    %eax,%ebx
+  8039e4:	83 c4 10             	add    $0x10,%esp
+  8039e7:	85 c0                	test   %eax,%eax
+  8039e9:	0f 88 db 00 00 00    	js     803aca <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039ef:	83 ec 04             	sub    $0x4,%esp
+  8039f2:	68 07 04 00 00       	push   $0x407
+  8039f7:	ff 75 f0             	push   -0x10(%ebp)
+  8039fa:	6a 00                	push   $0x0
+  8039fc:	e8 c2 d2 ff ff       	call   800cc3 <sys_page_alloc>
+  803a01:	89 c3                	mov    %eax,%ebx
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	85 c0                	test   %eax,%eax
+  803a08:	0f 88 bc 00 00 00    	js     803aca <pipe+0x131>
+	va = fd2data(fd0);
+  803a0e:	83 ec 0c             	sub    $0xc,%esp
+  803a11:	ff 75 f4             	push   -0xc(%ebp)
+  803a14:	e8 5d df ff ff       	call   801976 <fd2data>
+  803a19:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a1b:	83 c4 0c             	add    $0xc,%esp
+  803a1e:	68 07 04 00 00       	push   $0x407
+  803a23:	50                   	push   %eax
+  803a24:	6a 00                	push   $0x0
+  803a26:	e8 98 d2 ff ff       	call   800cc3 <sys_page_alloc>
+  803a2b:	89 c3                	mov    %eax,%ebx
+  803a2d:	83 c4 10             	add    $0x10,%esp
+  803a30:	85 c0                	test   %eax,%eax
+  803a32:	0f 88 82 00 00 00    	js     803aba <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a38:	83 ec 0c             	sub    $0xc,%esp
+  803a3b:	ff 75 f0             	push   -0x10(%ebp)
+  803a3e:	e8 33 df ff ff       	call   801976 <fd2data>
+  803a43:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803a4a:	50                   	push   %eax
+  803a4b:	6a 00                	push   $0x0
+  803a4d:	56                   	push   %esi
+  803a4e:	6a 00                	push   $0x0
+  803a50:	e8 bb d2 ff ff       	call   800d10 <sys_page_map>
+  803a55:	89 c3                	mov    %eax,%ebx
+  803a57:	83 c4 20             	add    $0x20,%esp
+  803a5a:	85 c0                	test   %eax,%eax
+  803a5c:	78 4e                	js     803aac <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a5e:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803a63:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a66:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a6b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a72:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a75:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a77:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a7a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a81:	83 ec 0c             	sub    $0xc,%esp
+  803a84:	ff 75 f4             	push   -0xc(%ebp)
+  803a87:	e8 da de ff ff       	call   801966 <fd2num>
+  803a8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a8f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a91:	83 c4 04             	add    $0x4,%esp
+  803a94:	ff 75 f0             	push   -0x10(%ebp)
+  803a97:	e8 ca de ff ff       	call   801966 <fd2num>
+  803a9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a9f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803aa2:	83 c4 10             	add    $0x10,%esp
+  803aa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aaa:	eb 2e                	jmp    803ada <pipe+0x141>
+	sys_page_unmap(0, va);
+  803aac:	83 ec 08             	sub    $0x8,%esp
+  803aaf:	56                   	push   %esi
+  803ab0:	6a 00                	push   $0x0
+  803ab2:	e8 a5 d2 ff ff       	call   800d5c <sys_page_unmap>
+  803ab7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803aba:	83 ec 08             	sub    $0x8,%esp
+  803abd:	ff 75 f0             	push   -0x10(%ebp)
+  803ac0:	6a 00                	push   $0x0
+  803ac2:	e8 95 d2 ff ff       	call   800d5c <sys_page_unmap>
+  803ac7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803aca:	83 ec 08             	sub    $0x8,%esp
+  803acd:	ff 75 f4             	push   -0xc(%ebp)
+  803ad0:	6a 00                	push   $0x0
+  803ad2:	e8 85 d2 ff ff       	call   800d5c <sys_page_unmap>
+  803ad7:	83 c4 10             	add    $0x10,%esp
+}
+  803ada:	89 d8                	mov    %ebx,%eax
+  803adc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803adf:	5b                   	pop    %ebx
+  803ae0:	5e                   	pop    %esi
+  803ae1:	5d                   	pop    %ebp
+  803ae2:	c3                   	ret
+
+00803ae3 <pipeisclosed>:
+{
+  803ae3:	55                   	push   %ebp
+  803ae4:	89 e5                	mov    %esp,%ebp
+  803ae6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ae9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803aec:	50                   	push   %eax
+  803aed:	ff 75 08             	push   0x8(%ebp)
+  803af0:	e8 ee de ff ff       	call   8019e3 <fd_lookup>
+  803af5:	83 c4 10             	add    $0x10,%esp
+  803af8:	85 c0                	test   %eax,%eax
+  803afa:	78 18                	js     803b14 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803afc:	83 ec 0c             	sub    $0xc,%esp
+  803aff:	ff 75 f4             	push   -0xc(%ebp)
+  803b02:	e8 6f de ff ff       	call   801976 <fd2data>
+  803b07:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b0c:	e8 27 fc ff ff       	call   803738 <_pipeisclosed>
+  803b11:	83 c4 10             	add    $0x10,%esp
+}
+  803b14:	c9                   	leave
+  803b15:	c3                   	ret
+
+00803b16 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803b16:	55                   	push   %ebp
+  803b17:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b1c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b22:	5d                   	pop    %ebp
+  803b23:	c3                   	ret
+
+00803b24 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803b24:	55                   	push   %ebp
+  803b25:	89 e5                	mov    %esp,%ebp
+  803b27:	56                   	push   %esi
+  803b28:	53                   	push   %ebx
+  803b29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b31:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b36:	89 d0                	mov    %edx,%eax
+  803b38:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803b3c:	85 c0                	test   %eax,%eax
+  803b3e:	74 2d                	je     803b6d <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803b40:	83 f8 02             	cmp    $0x2,%eax
+  803b43:	74 08                	je     803b4d <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803b45:	b8 02 00 00 00       	mov    $0x2,%eax
+  803b4a:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b4d:	be 02 00 00 00       	mov    $0x2,%esi
+  803b52:	eb 15                	jmp    803b69 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b54:	83 ec 04             	sub    $0x4,%esp
+  803b57:	6a 00                	push   $0x0
+  803b59:	6a 02                	push   $0x2
+  803b5b:	53                   	push   %ebx
+  803b5c:	e8 77 d4 ff ff       	call   800fd8 <sys_futex_wait>
+  803b61:	89 f0                	mov    %esi,%eax
+  803b63:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b66:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803b69:	85 c0                	test   %eax,%eax
+  803b6b:	75 e7                	jne    803b54 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803b6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b70:	5b                   	pop    %ebx
+  803b71:	5e                   	pop    %esi
+  803b72:	5d                   	pop    %ebp
+  803b73:	c3                   	ret
+
+00803b74 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803b74:	55                   	push   %ebp
+  803b75:	89 e5                	mov    %esp,%ebp
+  803b77:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b84:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803b88:	f7 d8                	neg    %eax
+  803b8a:	19 c0                	sbb    %eax,%eax
+  803b8c:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803b8f:	5d                   	pop    %ebp
+  803b90:	c3                   	ret
+
+00803b91 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803b91:	55                   	push   %ebp
+  803b92:	89 e5                	mov    %esp,%ebp
+  803b94:	83 ec 08             	sub    $0x8,%esp
+  803b97:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9f:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ba2:	83 f8 02             	cmp    $0x2,%eax
+  803ba5:	74 02                	je     803ba9 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ba7:	c9                   	leave
+  803ba8:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803ba9:	83 ec 08             	sub    $0x8,%esp
+  803bac:	6a 01                	push   $0x1
+  803bae:	52                   	push   %edx
+  803baf:	e8 53 d4 ff ff       	call   801007 <sys_futex_wake>
+  803bb4:	83 c4 10             	add    $0x10,%esp
+}
+  803bb7:	eb ee                	jmp    803ba7 <mutex_unlock+0x16>
+
+00803bb9 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803bb9:	55                   	push   %ebp
+  803bba:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bbf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bc5:	5d                   	pop    %ebp
+  803bc6:	c3                   	ret
+
+00803bc7 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803bc7:	55                   	push   %ebp
+  803bc8:	89 e5                	mov    %esp,%ebp
+  803bca:	57                   	push   %edi
+  803bcb:	56                   	push   %esi
+  803bcc:	53                   	push   %ebx
+  803bcd:	83 ec 18             	sub    $0x18,%esp
+  803bd0:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bd3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803bd6:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803bd8:	53                   	push   %ebx
+  803bd9:	e8 b3 ff ff ff       	call   803b91 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803bde:	83 c4 0c             	add    $0xc,%esp
+  803be1:	ff 75 10             	push   0x10(%ebp)
+  803be4:	57                   	push   %edi
+  803be5:	56                   	push   %esi
+  803be6:	e8 ed d3 ff ff       	call   800fd8 <sys_futex_wait>
+  803beb:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803bed:	83 c4 10             	add    $0x10,%esp
+  803bf0:	be 02 00 00 00       	mov    $0x2,%esi
+  803bf5:	eb 10                	jmp    803c07 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803bf7:	83 ec 04             	sub    $0x4,%esp
+  803bfa:	6a 00                	push   $0x0
+  803bfc:	6a 02                	push   $0x2
+  803bfe:	53                   	push   %ebx
+  803bff:	e8 d4 d3 ff ff       	call   800fd8 <sys_futex_wait>
+  803c04:	83 c4 10             	add    $0x10,%esp
+  803c07:	89 f0                	mov    %esi,%eax
+  803c09:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803c0c:	85 c0                	test   %eax,%eax
+  803c0e:	75 e7                	jne    803bf7 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803c10:	83 ff ec             	cmp    $0xffffffec,%edi
+  803c13:	74 05                	je     803c1a <cond_timedwait+0x53>
+  803c15:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c1a:	89 f8                	mov    %edi,%eax
+  803c1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c1f:	5b                   	pop    %ebx
+  803c20:	5e                   	pop    %esi
+  803c21:	5f                   	pop    %edi
+  803c22:	5d                   	pop    %ebp
+  803c23:	c3                   	ret
+
+00803c24 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c24:	55                   	push   %ebp
+  803c25:	89 e5                	mov    %esp,%ebp
+  803c27:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803c2a:	6a 00                	push   $0x0
+  803c2c:	ff 75 0c             	push   0xc(%ebp)
+  803c2f:	ff 75 08             	push   0x8(%ebp)
+  803c32:	e8 90 ff ff ff       	call   803bc7 <cond_timedwait>
+}
+  803c37:	83 c4 10             	add    $0x10,%esp
+  803c3a:	c9                   	leave
+  803c3b:	c3                   	ret
+
+00803c3c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803c3c:	55                   	push   %ebp
+  803c3d:	89 e5                	mov    %esp,%ebp
+  803c3f:	83 ec 10             	sub    $0x10,%esp
+  803c42:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803c45:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c4a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803c4e:	6a 01                	push   $0x1
+  803c50:	50                   	push   %eax
+  803c51:	e8 b1 d3 ff ff       	call   801007 <sys_futex_wake>
+}
+  803c56:	83 c4 10             	add    $0x10,%esp
+  803c59:	c9                   	leave
+  803c5a:	c3                   	ret
+
+00803c5b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803c5b:	55                   	push   %ebp
+  803c5c:	89 e5                	mov    %esp,%ebp
+  803c5e:	83 ec 10             	sub    $0x10,%esp
+  803c61:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c64:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c69:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803c6d:	68 00 04 00 00       	push   $0x400
+  803c72:	50                   	push   %eax
+  803c73:	e8 8f d3 ff ff       	call   801007 <sys_futex_wake>
+}
+  803c78:	83 c4 10             	add    $0x10,%esp
+  803c7b:	c9                   	leave
+  803c7c:	c3                   	ret
+
+00803c7d <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803c7d:	55                   	push   %ebp
+  803c7e:	89 e5                	mov    %esp,%ebp
+  803c80:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803c83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c86:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803c88:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803c8f:	5d                   	pop    %ebp
+  803c90:	c3                   	ret
+
+00803c91 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803c91:	55                   	push   %ebp
+  803c92:	89 e5                	mov    %esp,%ebp
+  803c94:	53                   	push   %ebx
+  803c95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803c98:	8b 11                	mov    (%ecx),%edx
+  803c9a:	85 d2                	test   %edx,%edx
+  803c9c:	74 14                	je     803cb2 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803c9e:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ca1:	89 d0                	mov    %edx,%eax
+  803ca3:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803ca7:	39 c2                	cmp    %eax,%edx
+  803ca9:	75 ed                	jne    803c98 <sem_trywait+0x7>
+			return 0;
+  803cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb0:	eb 05                	jmp    803cb7 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803cb2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803cb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cba:	c9                   	leave
+  803cbb:	c3                   	ret
+
+00803cbc <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803cbc:	55                   	push   %ebp
+  803cbd:	89 e5                	mov    %esp,%ebp
+  803cbf:	57                   	push   %edi
+  803cc0:	56                   	push   %esi
+  803cc1:	53                   	push   %ebx
+  803cc2:	83 ec 1c             	sub    $0x1c,%esp
+  803cc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803cc8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803ccb:	e8 80 d2 ff ff       	call   800f50 <sys_time_msec>
+  803cd0:	01 f8                	add    %edi,%eax
+  803cd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803cd5:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803cda:	eb 28                	jmp    803d04 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803cdc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ce1:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803ce6:	83 ec 04             	sub    $0x4,%esp
+  803ce9:	56                   	push   %esi
+  803cea:	6a 00                	push   $0x0
+  803cec:	53                   	push   %ebx
+  803ced:	e8 e6 d2 ff ff       	call   800fd8 <sys_futex_wait>
+  803cf2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803cf7:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803cfc:	83 c4 10             	add    $0x10,%esp
+  803cff:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803d02:	74 2e                	je     803d32 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803d04:	83 ec 0c             	sub    $0xc,%esp
+  803d07:	53                   	push   %ebx
+  803d08:	e8 84 ff ff ff       	call   803c91 <sem_trywait>
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	85 c0                	test   %eax,%eax
+  803d12:	79 19                	jns    803d2d <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803d14:	85 ff                	test   %edi,%edi
+  803d16:	74 c4                	je     803cdc <sem_timedwait+0x20>
+  803d18:	e8 33 d2 ff ff       	call   800f50 <sys_time_msec>
+  803d1d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803d20:	29 c6                	sub    %eax,%esi
+  803d22:	85 f6                	test   %esi,%esi
+  803d24:	7f b6                	jg     803cdc <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803d26:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803d2b:	eb 05                	jmp    803d32 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d35:	5b                   	pop    %ebx
+  803d36:	5e                   	pop    %esi
+  803d37:	5f                   	pop    %edi
+  803d38:	5d                   	pop    %ebp
+  803d39:	c3                   	ret
+
+00803d3a <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803d3a:	55                   	push   %ebp
+  803d3b:	89 e5                	mov    %esp,%ebp
+  803d3d:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803d40:	6a 00                	push   $0x0
+  803d42:	ff 75 08             	push   0x8(%ebp)
+  803d45:	e8 72 ff ff ff       	call   803cbc <sem_timedwait>
+}
+  803d4a:	83 c4 10             	add    $0x10,%esp
+  803d4d:	c9                   	leave
+  803d4e:	c3                   	ret
+
+00803d4f <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803d4f:	55                   	push   %ebp
+  803d50:	89 e5                	mov    %esp,%ebp
+  803d52:	83 ec 08             	sub    $0x8,%esp
+  803d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d58:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d5d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803d61:	8b 50 04             	mov    0x4(%eax),%edx
+  803d64:	85 d2                	test   %edx,%edx
+  803d66:	75 02                	jne    803d6a <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803d68:	c9                   	leave
+  803d69:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803d6a:	83 ec 08             	sub    $0x8,%esp
+  803d6d:	6a 01                	push   $0x1
+  803d6f:	50                   	push   %eax
+  803d70:	e8 92 d2 ff ff       	call   801007 <sys_futex_wake>
+  803d75:	83 c4 10             	add    $0x10,%esp
+}
+  803d78:	eb ee                	jmp    803d68 <sem_post+0x19>
+
+00803d7a <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803d7a:	55                   	push   %ebp
+  803d7b:	89 e5                	mov    %esp,%ebp
+  803d7d:	57                   	push   %edi
+  803d7e:	56                   	push   %esi
+  803d7f:	53                   	push   %ebx
+  803d80:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803d83:	68 20 60 80 00       	push   $0x806020
+  803d88:	e8 97 fd ff ff       	call   803b24 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803d8d:	a1 44 60 80 00       	mov    0x806044,%eax
+  803d92:	83 c4 10             	add    $0x10,%esp
+  803d95:	85 c0                	test   %eax,%eax
+  803d97:	75 19                	jne    803db2 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803d99:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803d9e:	8b 00                	mov    (%eax),%eax
+  803da0:	8b 40 48             	mov    0x48(%eax),%eax
+  803da3:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803da8:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803daf:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803db2:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803db7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dba:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803dc1:	8b 40 04             	mov    0x4(%eax),%eax
+  803dc4:	85 c0                	test   %eax,%eax
+  803dc6:	0f 84 e4 00 00 00    	je     803eb0 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803dcc:	83 c3 01             	add    $0x1,%ebx
+  803dcf:	83 fb 20             	cmp    $0x20,%ebx
+  803dd2:	75 e3                	jne    803db7 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803dd4:	83 ec 0c             	sub    $0xc,%esp
+  803dd7:	68 20 60 80 00       	push   $0x806020
+  803ddc:	e8 b0 fd ff ff       	call   803b91 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803de1:	83 c4 10             	add    $0x10,%esp
+  803de4:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803de9:	e9 b8 00 00 00       	jmp    803ea6 <pthread_create+0x12c>
+  803dee:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803df1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803df4:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803df6:	39 f3                	cmp    %esi,%ebx
+  803df8:	73 16                	jae    803e10 <pthread_create+0x96>
+		va -= PGSIZE;
+  803dfa:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803e00:	83 ec 08             	sub    $0x8,%esp
+  803e03:	56                   	push   %esi
+  803e04:	6a 00                	push   $0x0
+  803e06:	e8 51 cf ff ff       	call   800d5c <sys_page_unmap>
+  803e0b:	83 c4 10             	add    $0x10,%esp
+  803e0e:	eb e6                	jmp    803df6 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803e10:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803e13:	83 ec 08             	sub    $0x8,%esp
+  803e16:	ff 75 e4             	push   -0x1c(%ebp)
+  803e19:	6a 00                	push   $0x0
+  803e1b:	e8 3c cf ff ff       	call   800d5c <sys_page_unmap>
+	return r;
+  803e20:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803e23:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e26:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803e2d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803e34:	eb 70                	jmp    803ea6 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803e36:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e39:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803e40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e43:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803e46:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e49:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803e4c:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803e53:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803e58:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e5b:	29 c8                	sub    %ecx,%eax
+  803e5d:	85 db                	test   %ebx,%ebx
+  803e5f:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803e66:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803e69:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e70:	83 ec 04             	sub    $0x4,%esp
+  803e73:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803e78:	29 ca                	sub    %ecx,%edx
+  803e7a:	52                   	push   %edx
+	*--esp = 0;
+  803e7b:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e7e:	50                   	push   %eax
+  803e7f:	68 d7 40 80 00       	push   $0x8040d7
+  803e84:	e8 23 d2 ff ff       	call   8010ac <sys_thread_create>
+  803e89:	89 c7                	mov    %eax,%edi
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	85 c0                	test   %eax,%eax
+  803e90:	78 91                	js     803e23 <pthread_create+0xa9>
+	th->th_env = id;
+  803e92:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e95:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e9f:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ea6:	89 f8                	mov    %edi,%eax
+  803ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803eab:	5b                   	pop    %ebx
+  803eac:	5e                   	pop    %esi
+  803ead:	5f                   	pop    %edi
+  803eae:	5d                   	pop    %ebp
+  803eaf:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803eb0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803eb3:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803eba:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803ec1:	83 ec 0c             	sub    $0xc,%esp
+  803ec4:	68 20 60 80 00       	push   $0x806020
+  803ec9:	e8 c3 fc ff ff       	call   803b91 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803ece:	89 d9                	mov    %ebx,%ecx
+  803ed0:	c1 e1 10             	shl    $0x10,%ecx
+  803ed3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803ed6:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803edb:	29 c8                	sub    %ecx,%eax
+  803edd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803ee0:	c1 e8 16             	shr    $0x16,%eax
+  803ee3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803eea:	83 c4 10             	add    $0x10,%esp
+  803eed:	a8 01                	test   $0x1,%al
+  803eef:	74 15                	je     803f06 <pthread_create+0x18c>
+  803ef1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ef4:	c1 e8 0c             	shr    $0xc,%eax
+  803ef7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803efe:	a8 01                	test   $0x1,%al
+  803f00:	0f 85 30 ff ff ff    	jne    803e36 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f06:	83 ec 04             	sub    $0x4,%esp
+  803f09:	6a 07                	push   $0x7
+  803f0b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f0e:	6a 00                	push   $0x0
+  803f10:	e8 ae cd ff ff       	call   800cc3 <sys_page_alloc>
+  803f15:	89 c7                	mov    %eax,%edi
+  803f17:	83 c4 10             	add    $0x10,%esp
+  803f1a:	85 c0                	test   %eax,%eax
+  803f1c:	0f 88 01 ff ff ff    	js     803e23 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803f22:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803f27:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803f2a:	29 d0                	sub    %edx,%eax
+  803f2c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f2f:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f31:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803f36:	29 d0                	sub    %edx,%eax
+  803f38:	89 c7                	mov    %eax,%edi
+  803f3a:	39 fe                	cmp    %edi,%esi
+  803f3c:	0f 83 f4 fe ff ff    	jae    803e36 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f42:	83 ec 04             	sub    $0x4,%esp
+  803f45:	6a 07                	push   $0x7
+  803f47:	56                   	push   %esi
+  803f48:	6a 00                	push   $0x0
+  803f4a:	e8 74 cd ff ff       	call   800cc3 <sys_page_alloc>
+  803f4f:	83 c4 10             	add    $0x10,%esp
+  803f52:	85 c0                	test   %eax,%eax
+  803f54:	0f 88 94 fe ff ff    	js     803dee <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f5a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f60:	eb d8                	jmp    803f3a <pthread_create+0x1c0>
+
+00803f62 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803f62:	55                   	push   %ebp
+  803f63:	89 e5                	mov    %esp,%ebp
+  803f65:	57                   	push   %edi
+  803f66:	56                   	push   %esi
+  803f67:	53                   	push   %ebx
+  803f68:	83 ec 0c             	sub    $0xc,%esp
+  803f6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803f6e:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803f71:	83 f8 1e             	cmp    $0x1e,%eax
+  803f74:	0f 87 c7 00 00 00    	ja     804041 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803f7a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f7c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f82:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f87:	77 12                	ja     803f9b <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f89:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f8e:	29 d0                	sub    %edx,%eax
+  803f90:	c1 e8 10             	shr    $0x10,%eax
+  803f93:	39 c3                	cmp    %eax,%ebx
+  803f95:	0f 84 ad 00 00 00    	je     804048 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f9b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f9e:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803fa5:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803fac:	eb 10                	jmp    803fbe <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803fae:	83 ec 04             	sub    $0x4,%esp
+  803fb1:	6a 00                	push   $0x0
+  803fb3:	6a 01                	push   $0x1
+  803fb5:	57                   	push   %edi
+  803fb6:	e8 1d d0 ff ff       	call   800fd8 <sys_futex_wait>
+  803fbb:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803fbe:	8b 46 04             	mov    0x4(%esi),%eax
+  803fc1:	83 f8 01             	cmp    $0x1,%eax
+  803fc4:	74 e8                	je     803fae <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803fc6:	83 f8 02             	cmp    $0x2,%eax
+  803fc9:	0f 85 80 00 00 00    	jne    80404f <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803fcf:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803fd2:	c1 e6 02             	shl    $0x2,%esi
+  803fd5:	eb 05                	jmp    803fdc <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803fd7:	e8 bb cc ff ff       	call   800c97 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803fdc:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803fe2:	89 ca                	mov    %ecx,%edx
+  803fe4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803fea:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803fed:	c1 e0 04             	shl    $0x4,%eax
+  803ff0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ff5:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803ff8:	39 c1                	cmp    %eax,%ecx
+  803ffa:	75 12                	jne    80400e <pthread_join+0xac>
+  803ffc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803fff:	c1 e0 04             	shl    $0x4,%eax
+  804002:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804007:	8b 40 54             	mov    0x54(%eax),%eax
+  80400a:	85 c0                	test   %eax,%eax
+  80400c:	75 c9                	jne    803fd7 <pthread_join+0x75>
+	if (ret_store)
+  80400e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804012:	74 0f                	je     804023 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804014:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804017:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  80401e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804021:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804023:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804026:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80402d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804034:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80403c:	5b                   	pop    %ebx
+  80403d:	5e                   	pop    %esi
+  80403e:	5f                   	pop    %edi
+  80403f:	5d                   	pop    %ebp
+  804040:	c3                   	ret
+		return -E_INVAL;
+  804041:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804046:	eb f1                	jmp    804039 <pthread_join+0xd7>
+  804048:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80404d:	eb ea                	jmp    804039 <pthread_join+0xd7>
+		return -E_INVAL;
+  80404f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804054:	eb e3                	jmp    804039 <pthread_join+0xd7>
+
+00804056 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804056:	55                   	push   %ebp
+  804057:	89 e5                	mov    %esp,%ebp
+  804059:	53                   	push   %ebx
+  80405a:	83 ec 04             	sub    $0x4,%esp
+  80405d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80405f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804065:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80406a:	77 0c                	ja     804078 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80406c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804071:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804073:	c1 e8 10             	shr    $0x10,%eax
+  804076:	75 0a                	jne    804082 <pthread_exit+0x2c>
+		exit();
+  804078:	e8 21 c1 ff ff       	call   80019e <exit>
+  80407d:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804082:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804089:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80408c:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  804093:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804096:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  804099:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8040a0:	83 ec 08             	sub    $0x8,%esp
+  8040a3:	6a 20                	push   $0x20
+  8040a5:	01 c2                	add    %eax,%edx
+  8040a7:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8040ae:	50                   	push   %eax
+  8040af:	e8 53 cf ff ff       	call   801007 <sys_futex_wake>
+	sys_env_destroy(0);
+  8040b4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8040bb:	e8 60 cb ff ff       	call   800c20 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8040c0:	83 c4 0c             	add    $0xc,%esp
+  8040c3:	68 2a 4f 80 00       	push   $0x804f2a
+  8040c8:	68 a5 00 00 00       	push   $0xa5
+  8040cd:	68 44 4f 80 00       	push   $0x804f44
+  8040d2:	e8 ef c0 ff ff       	call   8001c6 <_panic>
+
+008040d7 <pthread_start>:
+{
+  8040d7:	55                   	push   %ebp
+  8040d8:	89 e5                	mov    %esp,%ebp
+  8040da:	53                   	push   %ebx
+  8040db:	83 ec 04             	sub    $0x4,%esp
+  8040de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8040e1:	e8 85 cb ff ff       	call   800c6b <sys_getenvid>
+  8040e6:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8040eb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8040f1:	85 db                	test   %ebx,%ebx
+  8040f3:	74 0c                	je     804101 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040f5:	89 d9                	mov    %ebx,%ecx
+  8040f7:	c1 e1 10             	shl    $0x10,%ecx
+  8040fa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8040ff:	29 ca                	sub    %ecx,%edx
+  804101:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804104:	c1 e0 04             	shl    $0x4,%eax
+  804107:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80410c:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80410e:	83 ec 0c             	sub    $0xc,%esp
+  804111:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804118:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80411b:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  804122:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  804129:	89 04 24             	mov    %eax,(%esp)
+  80412c:	e8 25 ff ff ff       	call   804056 <pthread_exit>
+
+00804131 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804131:	55                   	push   %ebp
+  804132:	89 e5                	mov    %esp,%ebp
+  804134:	57                   	push   %edi
+  804135:	56                   	push   %esi
+  804136:	53                   	push   %ebx
+  804137:	83 ec 1c             	sub    $0x1c,%esp
+  80413a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80413c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804142:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804149:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80414e:	77 0d                	ja     80415d <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804150:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804155:	29 d0                	sub    %edx,%eax
+  804157:	c1 e8 10             	shr    $0x10,%eax
+  80415a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80415d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804162:	eb 2f                	jmp    804193 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804164:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80416a:	8b 01                	mov    (%ecx),%eax
+  80416c:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80416f:	39 c2                	cmp    %eax,%edx
+  804171:	75 14                	jne    804187 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804173:	83 ec 0c             	sub    $0xc,%esp
+  804176:	57                   	push   %edi
+  804177:	e8 a4 ca ff ff       	call   800c20 <sys_env_destroy>
+  80417c:	83 c4 10             	add    $0x10,%esp
+  80417f:	85 c0                	test   %eax,%eax
+  804181:	0f 88 97 00 00 00    	js     80421e <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804187:	83 c3 01             	add    $0x1,%ebx
+  80418a:	83 fb 20             	cmp    $0x20,%ebx
+  80418d:	0f 84 d2 00 00 00    	je     804265 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804193:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804196:	74 ef                	je     804187 <pthread_kill_others+0x56>
+  804198:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80419b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8041a2:	8b 40 04             	mov    0x4(%eax),%eax
+  8041a5:	83 f8 01             	cmp    $0x1,%eax
+  8041a8:	75 dd                	jne    804187 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8041aa:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8041ad:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8041b4:	89 fe                	mov    %edi,%esi
+  8041b6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8041bc:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041bf:	c1 e0 04             	shl    $0x4,%eax
+  8041c2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041c7:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041ca:	39 c7                	cmp    %eax,%edi
+  8041cc:	75 b9                	jne    804187 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8041ce:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041d1:	c1 e0 04             	shl    $0x4,%eax
+  8041d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041d9:	8b 40 54             	mov    0x54(%eax),%eax
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	74 a7                	je     804187 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041e0:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041e3:	c1 e0 04             	shl    $0x4,%eax
+  8041e6:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8041ec:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041ee:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8041f4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041f9:	0f 87 65 ff ff ff    	ja     804164 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804204:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804206:	c1 e8 10             	shr    $0x10,%eax
+  804209:	0f 84 55 ff ff ff    	je     804164 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80420f:	c1 e0 10             	shl    $0x10,%eax
+  804212:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804217:	29 c1                	sub    %eax,%ecx
+  804219:	e9 4c ff ff ff       	jmp    80416a <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80421e:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804221:	c1 e2 04             	shl    $0x4,%edx
+  804224:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80422a:	8b 52 48             	mov    0x48(%edx),%edx
+  80422d:	39 fa                	cmp    %edi,%edx
+  80422f:	0f 85 52 ff ff ff    	jne    804187 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804235:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804238:	c1 e2 04             	shl    $0x4,%edx
+  80423b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804241:	8b 52 54             	mov    0x54(%edx),%edx
+  804244:	85 d2                	test   %edx,%edx
+  804246:	0f 84 3b ff ff ff    	je     804187 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80424c:	83 ec 0c             	sub    $0xc,%esp
+  80424f:	50                   	push   %eax
+  804250:	57                   	push   %edi
+  804251:	68 54 4f 80 00       	push   $0x804f54
+  804256:	68 bb 00 00 00       	push   $0xbb
+  80425b:	68 44 4f 80 00       	push   $0x804f44
+  804260:	e8 61 bf ff ff       	call   8001c6 <_panic>
+	}
+}
+  804265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804268:	5b                   	pop    %ebx
+  804269:	5e                   	pop    %esi
+  80426a:	5f                   	pop    %edi
+  80426b:	5d                   	pop    %ebp
+  80426c:	c3                   	ret
+
+0080426d <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80426d:	55                   	push   %ebp
+  80426e:	89 e5                	mov    %esp,%ebp
+  804270:	53                   	push   %ebx
+  804271:	83 ec 04             	sub    $0x4,%esp
+  804274:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804276:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80427c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804282:	0f 87 85 00 00 00    	ja     80430d <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804288:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80428d:	29 c3                	sub    %eax,%ebx
+  80428f:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804292:	83 ec 04             	sub    $0x4,%esp
+  804295:	68 80 02 00 00       	push   $0x280
+  80429a:	6a 00                	push   $0x0
+  80429c:	68 40 60 80 00       	push   $0x806040
+  8042a1:	e8 30 c7 ff ff       	call   8009d6 <memset>
+	threads_mu.m_state = 0;
+  8042a6:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8042ad:	00 00 00 
+	if (self != 0) {
+  8042b0:	83 c4 10             	add    $0x10,%esp
+  8042b3:	85 db                	test   %ebx,%ebx
+  8042b5:	74 51                	je     804308 <pthread_fork_child+0x9b>
+  8042b7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042bf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042c4:	77 18                	ja     8042de <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042cb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042cd:	c1 e8 10             	shr    $0x10,%eax
+  8042d0:	74 0c                	je     8042de <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042d2:	c1 e0 10             	shl    $0x10,%eax
+  8042d5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042da:	29 c2                	sub    %eax,%edx
+  8042dc:	eb 06                	jmp    8042e4 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8042de:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8042e4:	8b 02                	mov    (%edx),%eax
+  8042e6:	8b 48 48             	mov    0x48(%eax),%ecx
+  8042e9:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8042f0:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8042f3:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8042fa:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  804301:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80430b:	c9                   	leave
+  80430c:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80430d:	83 ec 04             	sub    $0x4,%esp
+  804310:	68 80 02 00 00       	push   $0x280
+  804315:	6a 00                	push   $0x0
+  804317:	68 40 60 80 00       	push   $0x806040
+  80431c:	e8 b5 c6 ff ff       	call   8009d6 <memset>
+	threads_mu.m_state = 0;
+  804321:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  804328:	00 00 00 
+  80432b:	83 c4 10             	add    $0x10,%esp
+  80432e:	eb d8                	jmp    804308 <pthread_fork_child+0x9b>
+
+00804330 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804330:	b8 00 00 00 00       	mov    $0x0,%eax
+  804335:	c3                   	ret
+
+00804336 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804336:	55                   	push   %ebp
+  804337:	89 e5                	mov    %esp,%ebp
+  804339:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80433c:	68 79 4f 80 00       	push   $0x804f79
+  804341:	ff 75 0c             	push   0xc(%ebp)
+  804344:	e8 3c c5 ff ff       	call   800885 <strcpy>
+	return 0;
+}
+  804349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434e:	c9                   	leave
+  80434f:	c3                   	ret
+
+00804350 <devcons_write>:
+{
+  804350:	55                   	push   %ebp
+  804351:	89 e5                	mov    %esp,%ebp
+  804353:	57                   	push   %edi
+  804354:	56                   	push   %esi
+  804355:	53                   	push   %ebx
+  804356:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80435c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804361:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804367:	eb 2e                	jmp    804397 <devcons_write+0x47>
+		m = n - tot;
+  804369:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80436c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80436e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804373:	39 c3                	cmp    %eax,%ebx
+  804375:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804378:	83 ec 04             	sub    $0x4,%esp
+  80437b:	53                   	push   %ebx
+  80437c:	89 f0                	mov    %esi,%eax
+  80437e:	03 45 0c             	add    0xc(%ebp),%eax
+  804381:	50                   	push   %eax
+  804382:	57                   	push   %edi
+  804383:	e8 83 c6 ff ff       	call   800a0b <memmove>
+		sys_cputs(buf, m);
+  804388:	83 c4 08             	add    $0x8,%esp
+  80438b:	53                   	push   %ebx
+  80438c:	57                   	push   %edi
+  80438d:	e8 37 c8 ff ff       	call   800bc9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804392:	01 de                	add    %ebx,%esi
+  804394:	83 c4 10             	add    $0x10,%esp
+  804397:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80439a:	72 cd                	jb     804369 <devcons_write+0x19>
+}
+  80439c:	89 f0                	mov    %esi,%eax
+  80439e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043a1:	5b                   	pop    %ebx
+  8043a2:	5e                   	pop    %esi
+  8043a3:	5f                   	pop    %edi
+  8043a4:	5d                   	pop    %ebp
+  8043a5:	c3                   	ret
+
+008043a6 <devcons_read>:
+{
+  8043a6:	55                   	push   %ebp
+  8043a7:	89 e5                	mov    %esp,%ebp
+  8043a9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8043ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8043b5:	75 07                	jne    8043be <devcons_read+0x18>
+  8043b7:	eb 1f                	jmp    8043d8 <devcons_read+0x32>
+		sys_yield();
+  8043b9:	e8 d9 c8 ff ff       	call   800c97 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8043be:	e8 31 c8 ff ff       	call   800bf4 <sys_cgetc>
+  8043c3:	85 c0                	test   %eax,%eax
+  8043c5:	74 f2                	je     8043b9 <devcons_read+0x13>
+	if (c < 0)
+  8043c7:	78 0f                	js     8043d8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8043c9:	83 f8 04             	cmp    $0x4,%eax
+  8043cc:	74 0c                	je     8043da <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8043ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8043d1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8043d3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8043d8:	c9                   	leave
+  8043d9:	c3                   	ret
+		return 0;
+  8043da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043df:	eb f7                	jmp    8043d8 <devcons_read+0x32>
+
+008043e1 <cputchar>:
+{
+  8043e1:	55                   	push   %ebp
+  8043e2:	89 e5                	mov    %esp,%ebp
+  8043e4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8043e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043ea:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8043ed:	6a 01                	push   $0x1
+  8043ef:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8043f2:	50                   	push   %eax
+  8043f3:	e8 d1 c7 ff ff       	call   800bc9 <sys_cputs>
+}
+  8043f8:	83 c4 10             	add    $0x10,%esp
+  8043fb:	c9                   	leave
+  8043fc:	c3                   	ret
+
+008043fd <getchar>:
+{
+  8043fd:	55                   	push   %ebp
+  8043fe:	89 e5                	mov    %esp,%ebp
+  804400:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804403:	6a 01                	push   $0x1
+  804405:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804408:	50                   	push   %eax
+  804409:	6a 00                	push   $0x0
+  80440b:	e8 63 d8 ff ff       	call   801c73 <read>
+	if (r < 0)
+  804410:	83 c4 10             	add    $0x10,%esp
+  804413:	85 c0                	test   %eax,%eax
+  804415:	78 06                	js     80441d <getchar+0x20>
+	if (r < 1)
+  804417:	74 06                	je     80441f <getchar+0x22>
+	return c;
+  804419:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80441d:	c9                   	leave
+  80441e:	c3                   	ret
+		return -E_EOF;
+  80441f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804424:	eb f7                	jmp    80441d <getchar+0x20>
+
+00804426 <iscons>:
+{
+  804426:	55                   	push   %ebp
+  804427:	89 e5                	mov    %esp,%ebp
+  804429:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80442c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80442f:	50                   	push   %eax
+  804430:	ff 75 08             	push   0x8(%ebp)
+  804433:	e8 ab d5 ff ff       	call   8019e3 <fd_lookup>
+  804438:	83 c4 10             	add    $0x10,%esp
+  80443b:	85 c0                	test   %eax,%eax
+  80443d:	78 11                	js     804450 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80443f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804442:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  804448:	39 10                	cmp    %edx,(%eax)
+  80444a:	0f 94 c0             	sete   %al
+  80444d:	0f b6 c0             	movzbl %al,%eax
+}
+  804450:	c9                   	leave
+  804451:	c3                   	ret
+
+00804452 <opencons>:
+{
+  804452:	55                   	push   %ebp
+  804453:	89 e5                	mov    %esp,%ebp
+  804455:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804458:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80445b:	50                   	push   %eax
+  80445c:	e8 2c d5 ff ff       	call   80198d <fd_alloc>
+  804461:	83 c4 10             	add    $0x10,%esp
+  804464:	85 c0                	test   %eax,%eax
+  804466:	78 3a                	js     8044a2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804468:	83 ec 04             	sub    $0x4,%esp
+  80446b:	68 07 04 00 00       	push   $0x407
+  804470:	ff 75 f4             	push   -0xc(%ebp)
+  804473:	6a 00                	push   $0x0
+  804475:	e8 49 c8 ff ff       	call   800cc3 <sys_page_alloc>
+  80447a:	83 c4 10             	add    $0x10,%esp
+  80447d:	85 c0                	test   %eax,%eax
+  80447f:	78 21                	js     8044a2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804481:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804484:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80448a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80448c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80448f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804496:	83 ec 0c             	sub    $0xc,%esp
+  804499:	50                   	push   %eax
+  80449a:	e8 c7 d4 ff ff       	call   801966 <fd2num>
+  80449f:	83 c4 10             	add    $0x10,%esp
+}
+  8044a2:	c9                   	leave
+  8044a3:	c3                   	ret
+
+008044a4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8044a4:	55                   	push   %ebp
+  8044a5:	89 e5                	mov    %esp,%ebp
+  8044a7:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8044aa:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8044b1:	74 0a                	je     8044bd <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b6:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8044bb:	c9                   	leave
+  8044bc:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044bd:	83 ec 04             	sub    $0x4,%esp
+  8044c0:	6a 07                	push   $0x7
+  8044c2:	68 00 f0 bf ee       	push   $0xeebff000
+  8044c7:	6a 00                	push   $0x0
+  8044c9:	e8 f5 c7 ff ff       	call   800cc3 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044ce:	83 c4 08             	add    $0x8,%esp
+  8044d1:	68 e2 44 80 00       	push   $0x8044e2
+  8044d6:	6a 00                	push   $0x0
+  8044d8:	e8 63 c9 ff ff       	call   800e40 <sys_env_set_pgfault_upcall>
+  8044dd:	83 c4 10             	add    $0x10,%esp
+  8044e0:	eb d1                	jmp    8044b3 <set_pgfault_handler+0xf>
+
+008044e2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044e2:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044e3:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8044e8:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044ea:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044ed:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8044f1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8044f5:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8044f8:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044fc:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044fe:	83 c4 08             	add    $0x8,%esp
+	popal
+  804501:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804502:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804505:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804506:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804507:	c3                   	ret
+
+00804508 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804508:	55                   	push   %ebp
+  804509:	89 e5                	mov    %esp,%ebp
+  80450b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80450e:	89 c2                	mov    %eax,%edx
+  804510:	c1 ea 16             	shr    $0x16,%edx
+  804513:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80451a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80451f:	f6 c1 01             	test   $0x1,%cl
+  804522:	74 1c                	je     804540 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804524:	c1 e8 0c             	shr    $0xc,%eax
+  804527:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80452e:	a8 01                	test   $0x1,%al
+  804530:	74 0e                	je     804540 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804532:	c1 e8 0c             	shr    $0xc,%eax
+  804535:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80453c:	ef 
+  80453d:	0f b7 d2             	movzwl %dx,%edx
+}
+  804540:	89 d0                	mov    %edx,%eax
+  804542:	5d                   	pop    %ebp
+  804543:	c3                   	ret
+
+00804544 <udm>:
+  804544:	57                   	push   %edi
+  804545:	56                   	push   %esi
+  804546:	53                   	push   %ebx
+  804547:	83 ec 20             	sub    $0x20,%esp
+  80454a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80454e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804552:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804556:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80455a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80455e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804562:	89 d1                	mov    %edx,%ecx
+  804564:	09 c1                	or     %eax,%ecx
+  804566:	0f 84 91 00 00 00    	je     8045fd <udm+0xb9>
+  80456c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804571:	ba 00 00 00 00       	mov    $0x0,%edx
+  804576:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80457b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804582:	00 
+  804583:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80458a:	00 
+  80458b:	eb 08                	jmp    804595 <udm+0x51>
+  80458d:	83 e9 01             	sub    $0x1,%ecx
+  804590:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804593:	74 7c                	je     804611 <udm+0xcd>
+  804595:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804599:	01 c0                	add    %eax,%eax
+  80459b:	89 c6                	mov    %eax,%esi
+  80459d:	89 d7                	mov    %edx,%edi
+  80459f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045a3:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045a7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045aa:	d3 ea                	shr    %cl,%edx
+  8045ac:	f6 c1 20             	test   $0x20,%cl
+  8045af:	74 04                	je     8045b5 <udm+0x71>
+  8045b1:	89 d0                	mov    %edx,%eax
+  8045b3:	31 d2                	xor    %edx,%edx
+  8045b5:	83 e0 01             	and    $0x1,%eax
+  8045b8:	89 04 24             	mov    %eax,(%esp)
+  8045bb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8045c2:	00 
+  8045c3:	8b 04 24             	mov    (%esp),%eax
+  8045c6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8045ca:	09 f0                	or     %esi,%eax
+  8045cc:	09 fa                	or     %edi,%edx
+  8045ce:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045d2:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045d6:	39 f0                	cmp    %esi,%eax
+  8045d8:	89 d3                	mov    %edx,%ebx
+  8045da:	19 fb                	sbb    %edi,%ebx
+  8045dc:	72 af                	jb     80458d <udm+0x49>
+  8045de:	29 f0                	sub    %esi,%eax
+  8045e0:	19 fa                	sbb    %edi,%edx
+  8045e2:	89 cf                	mov    %ecx,%edi
+  8045e4:	c1 ef 05             	shr    $0x5,%edi
+  8045e7:	83 e7 01             	and    $0x1,%edi
+  8045ea:	89 fe                	mov    %edi,%esi
+  8045ec:	83 f6 01             	xor    $0x1,%esi
+  8045ef:	d3 e6                	shl    %cl,%esi
+  8045f1:	d3 e7                	shl    %cl,%edi
+  8045f3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045f7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045fb:	eb 90                	jmp    80458d <udm+0x49>
+  8045fd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804601:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804605:	89 f0                	mov    %esi,%eax
+  804607:	89 fa                	mov    %edi,%edx
+  804609:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80460d:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804611:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804615:	89 01                	mov    %eax,(%ecx)
+  804617:	89 51 04             	mov    %edx,0x4(%ecx)
+  80461a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80461e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804622:	83 c4 20             	add    $0x20,%esp
+  804625:	5b                   	pop    %ebx
+  804626:	5e                   	pop    %esi
+  804627:	5f                   	pop    %edi
+  804628:	c3                   	ret
+
+00804629 <__udivdi3>:
+  804629:	83 ec 18             	sub    $0x18,%esp
+  80462c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804630:	50                   	push   %eax
+  804631:	ff 74 24 2c          	push   0x2c(%esp)
+  804635:	ff 74 24 2c          	push   0x2c(%esp)
+  804639:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80463d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804641:	e8 fe fe ff ff       	call   804544 <udm>
+  804646:	83 c4 24             	add    $0x24,%esp
+  804649:	c3                   	ret
+
+0080464a <__umoddi3>:
+  80464a:	83 ec 18             	sub    $0x18,%esp
+  80464d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804651:	50                   	push   %eax
+  804652:	ff 74 24 2c          	push   0x2c(%esp)
+  804656:	ff 74 24 2c          	push   0x2c(%esp)
+  80465a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80465e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804662:	e8 dd fe ff ff       	call   804544 <udm>
+  804667:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80466b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80466f:	83 c4 24             	add    $0x24,%esp
+  804672:	c3                   	ret
+
+00804673 <__divdi3>:
+  804673:	56                   	push   %esi
+  804674:	53                   	push   %ebx
+  804675:	83 ec 14             	sub    $0x14,%esp
+  804678:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80467c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804680:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804684:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804688:	85 d2                	test   %edx,%edx
+  80468a:	78 18                	js     8046a4 <__divdi3+0x31>
+  80468c:	85 db                	test   %ebx,%ebx
+  80468e:	78 3e                	js     8046ce <__divdi3+0x5b>
+  804690:	83 ec 04             	sub    $0x4,%esp
+  804693:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804697:	56                   	push   %esi
+  804698:	53                   	push   %ebx
+  804699:	51                   	push   %ecx
+  80469a:	e8 a5 fe ff ff       	call   804544 <udm>
+  80469f:	83 c4 10             	add    $0x10,%esp
+  8046a2:	eb 24                	jmp    8046c8 <__divdi3+0x55>
+  8046a4:	f7 d8                	neg    %eax
+  8046a6:	83 d2 00             	adc    $0x0,%edx
+  8046a9:	f7 da                	neg    %edx
+  8046ab:	85 db                	test   %ebx,%ebx
+  8046ad:	78 3a                	js     8046e9 <__divdi3+0x76>
+  8046af:	83 ec 04             	sub    $0x4,%esp
+  8046b2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046b6:	56                   	push   %esi
+  8046b7:	53                   	push   %ebx
+  8046b8:	51                   	push   %ecx
+  8046b9:	e8 86 fe ff ff       	call   804544 <udm>
+  8046be:	83 c4 10             	add    $0x10,%esp
+  8046c1:	f7 d8                	neg    %eax
+  8046c3:	83 d2 00             	adc    $0x0,%edx
+  8046c6:	f7 da                	neg    %edx
+  8046c8:	83 c4 14             	add    $0x14,%esp
+  8046cb:	5b                   	pop    %ebx
+  8046cc:	5e                   	pop    %esi
+  8046cd:	c3                   	ret
+  8046ce:	83 ec 04             	sub    $0x4,%esp
+  8046d1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046d5:	56                   	push   %esi
+  8046d6:	f7 d9                	neg    %ecx
+  8046d8:	83 d3 00             	adc    $0x0,%ebx
+  8046db:	f7 db                	neg    %ebx
+  8046dd:	53                   	push   %ebx
+  8046de:	51                   	push   %ecx
+  8046df:	e8 60 fe ff ff       	call   804544 <udm>
+  8046e4:	83 c4 10             	add    $0x10,%esp
+  8046e7:	eb d8                	jmp    8046c1 <__divdi3+0x4e>
+  8046e9:	83 ec 04             	sub    $0x4,%esp
+  8046ec:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046f0:	56                   	push   %esi
+  8046f1:	f7 d9                	neg    %ecx
+  8046f3:	83 d3 00             	adc    $0x0,%ebx
+  8046f6:	f7 db                	neg    %ebx
+  8046f8:	53                   	push   %ebx
+  8046f9:	51                   	push   %ecx
+  8046fa:	e8 45 fe ff ff       	call   804544 <udm>
+  8046ff:	83 c4 10             	add    $0x10,%esp
+  804702:	eb c4                	jmp    8046c8 <__divdi3+0x55>
+
+00804704 <__moddi3>:
+  804704:	55                   	push   %ebp
+  804705:	57                   	push   %edi
+  804706:	56                   	push   %esi
+  804707:	53                   	push   %ebx
+  804708:	83 ec 24             	sub    $0x24,%esp
+  80470b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80470f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804713:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804717:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80471b:	85 d2                	test   %edx,%edx
+  80471d:	78 3b                	js     80475a <__moddi3+0x56>
+  80471f:	83 ec 04             	sub    $0x4,%esp
+  804722:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804726:	56                   	push   %esi
+  804727:	89 ce                	mov    %ecx,%esi
+  804729:	f7 de                	neg    %esi
+  80472b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80472f:	89 de                	mov    %ebx,%esi
+  804731:	83 d6 00             	adc    $0x0,%esi
+  804734:	f7 de                	neg    %esi
+  804736:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80473a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80473e:	0f 48 f1             	cmovs  %ecx,%esi
+  804741:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804746:	53                   	push   %ebx
+  804747:	56                   	push   %esi
+  804748:	e8 f7 fd ff ff       	call   804544 <udm>
+  80474d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804751:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804755:	83 c4 10             	add    $0x10,%esp
+  804758:	eb 47                	jmp    8047a1 <__moddi3+0x9d>
+  80475a:	f7 d8                	neg    %eax
+  80475c:	83 d2 00             	adc    $0x0,%edx
+  80475f:	f7 da                	neg    %edx
+  804761:	83 ec 04             	sub    $0x4,%esp
+  804764:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804768:	56                   	push   %esi
+  804769:	89 cf                	mov    %ecx,%edi
+  80476b:	f7 df                	neg    %edi
+  80476d:	89 de                	mov    %ebx,%esi
+  80476f:	83 d6 00             	adc    $0x0,%esi
+  804772:	f7 de                	neg    %esi
+  804774:	0f 49 cf             	cmovns %edi,%ecx
+  804777:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80477b:	0f 49 de             	cmovns %esi,%ebx
+  80477e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804782:	ff 74 24 0c          	push   0xc(%esp)
+  804786:	ff 74 24 0c          	push   0xc(%esp)
+  80478a:	e8 b5 fd ff ff       	call   804544 <udm>
+  80478f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804793:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804797:	f7 d8                	neg    %eax
+  804799:	83 d2 00             	adc    $0x0,%edx
+  80479c:	f7 da                	neg    %edx
+  80479e:	83 c4 10             	add    $0x10,%esp
+  8047a1:	83 c4 24             	add    $0x24,%esp
+  8047a4:	5b                   	pop    %ebx
+  8047a5:	5e                   	pop    %esi
+  8047a6:	5f                   	pop    %edi
+  8047a7:	5d                   	pop    %ebp
+  8047a8:	c3                   	ret
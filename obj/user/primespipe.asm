@@ -0,0 +1,9920 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 5c 1c 00 00       	call   801cad <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 01 49 80 00       	push   $0x804901
+  800064:	e8 4c 03 00 00       	call   8003b5 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 b1 38 00 00       	call   803922 <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 13 14 00 00       	call   801493 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 31 1a 00 00       	call   801ac0 <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 26 1a 00 00       	call   801ac0 <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 c0 48 80 00       	push   $0x8048c0
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 ef 48 80 00       	push   $0x8048ef
+  8000bd:	e8 18 02 00 00       	call   8002da <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 05 49 80 00       	push   $0x804905
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 ef 48 80 00       	push   $0x8048ef
+  8000cf:	e8 06 02 00 00       	call   8002da <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 0e 49 80 00       	push   $0x80490e
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 ef 48 80 00       	push   $0x8048ef
+  8000e1:	e8 f4 01 00 00       	call   8002da <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 cf 19 00 00       	call   801ac0 <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 a7 1b 00 00       	call   801cad <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 cc 1b 00 00       	call   801cf4 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 33 49 80 00       	push   $0x804933
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 ef 48 80 00       	push   $0x8048ef
+  80014e:	e8 87 01 00 00       	call   8002da <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 17 49 80 00       	push   $0x804917
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 ef 48 80 00       	push   $0x8048ef
+  800172:	e8 63 01 00 00       	call   8002da <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 60 80 00 4d 	movl   $0x80494d,0x806000
+  800185:	49 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 91 37 00 00       	call   803922 <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 f3 12 00 00       	call   801493 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 0f 19 00 00       	call   801ac0 <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 05 49 80 00       	push   $0x804905
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 ef 48 80 00       	push   $0x8048ef
+  8001c9:	e8 0c 01 00 00       	call   8002da <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 0e 49 80 00       	push   $0x80490e
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 ef 48 80 00       	push   $0x8048ef
+  8001db:	e8 fa 00 00 00       	call   8002da <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 d5 18 00 00       	call   801ac0 <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 e5 1a 00 00       	call   801cf4 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 58 49 80 00       	push   $0x804958
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 ef 48 80 00       	push   $0x8048ef
+  800232:	e8 a3 00 00 00       	call   8002da <_panic>
+
+00800237 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	57                   	push   %edi
+  80023b:	56                   	push   %esi
+  80023c:	53                   	push   %ebx
+  80023d:	83 ec 1c             	sub    $0x1c,%esp
+  800240:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800243:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800246:	e8 34 0b 00 00       	call   800d7f <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80024b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80024e:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  800254:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800259:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80025b:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80025d:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800263:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800268:	77 16                	ja     800280 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80026a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80026f:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800271:	c1 e8 10             	shr    $0x10,%eax
+  800274:	74 0a                	je     800280 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800276:	c1 e0 10             	shl    $0x10,%eax
+  800279:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80027e:	29 c2                	sub    %eax,%edx
+  800280:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800283:	c1 e0 04             	shl    $0x4,%eax
+  800286:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80028b:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80028d:	85 db                	test   %ebx,%ebx
+  80028f:	7e 07                	jle    800298 <libmain+0x61>
+		binaryname = argv[0];
+  800291:	8b 06                	mov    (%esi),%eax
+  800293:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800298:	83 ec 08             	sub    $0x8,%esp
+  80029b:	56                   	push   %esi
+  80029c:	53                   	push   %ebx
+  80029d:	e8 d5 fe ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  8002a2:	e8 0b 00 00 00       	call   8002b2 <exit>
+}
+  8002a7:	83 c4 10             	add    $0x10,%esp
+  8002aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ad:	5b                   	pop    %ebx
+  8002ae:	5e                   	pop    %esi
+  8002af:	5f                   	pop    %edi
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	c3                   	ret
+
+008002b2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8002b8:	6a 00                	push   $0x0
+  8002ba:	e8 8b 27 00 00       	call   802a4a <fflush>
+	pthread_kill_others();
+  8002bf:	e8 f6 3d 00 00       	call   8040ba <pthread_kill_others>
+	close_all();
+  8002c4:	e8 24 18 00 00       	call   801aed <close_all>
+	sys_env_destroy(0);
+  8002c9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8002d0:	e8 5f 0a 00 00       	call   800d34 <sys_env_destroy>
+}
+  8002d5:	83 c4 10             	add    $0x10,%esp
+  8002d8:	c9                   	leave
+  8002d9:	c3                   	ret
+
+008002da <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002da:	55                   	push   %ebp
+  8002db:	89 e5                	mov    %esp,%ebp
+  8002dd:	56                   	push   %esi
+  8002de:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002df:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002e2:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8002e8:	e8 92 0a 00 00       	call   800d7f <sys_getenvid>
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	ff 75 0c             	push   0xc(%ebp)
+  8002f3:	ff 75 08             	push   0x8(%ebp)
+  8002f6:	56                   	push   %esi
+  8002f7:	50                   	push   %eax
+  8002f8:	68 7c 49 80 00       	push   $0x80497c
+  8002fd:	e8 b3 00 00 00       	call   8003b5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800302:	83 c4 18             	add    $0x18,%esp
+  800305:	53                   	push   %ebx
+  800306:	ff 75 10             	push   0x10(%ebp)
+  800309:	e8 56 00 00 00       	call   800364 <vcprintf>
+	cprintf("\n");
+  80030e:	c7 04 24 7a 4e 80 00 	movl   $0x804e7a,(%esp)
+  800315:	e8 9b 00 00 00       	call   8003b5 <cprintf>
+  80031a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80031d:	cc                   	int3
+	while (1)
+  80031e:	eb fd                	jmp    80031d <_panic+0x43>
+
+00800320 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	53                   	push   %ebx
+  800324:	83 ec 04             	sub    $0x4,%esp
+  800327:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80032a:	8b 13                	mov    (%ebx),%edx
+  80032c:	8d 42 01             	lea    0x1(%edx),%eax
+  80032f:	89 03                	mov    %eax,(%ebx)
+  800331:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800334:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800338:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80033d:	74 09                	je     800348 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80033f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800348:	83 ec 08             	sub    $0x8,%esp
+  80034b:	68 ff 00 00 00       	push   $0xff
+  800350:	8d 43 08             	lea    0x8(%ebx),%eax
+  800353:	50                   	push   %eax
+  800354:	e8 84 09 00 00       	call   800cdd <sys_cputs>
+		b->idx = 0;
+  800359:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80035f:	83 c4 10             	add    $0x10,%esp
+  800362:	eb db                	jmp    80033f <putch+0x1f>
+
+00800364 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800364:	55                   	push   %ebp
+  800365:	89 e5                	mov    %esp,%ebp
+  800367:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80036d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800374:	00 00 00 
+	b.cnt = 0;
+  800377:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80037e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800381:	ff 75 0c             	push   0xc(%ebp)
+  800384:	ff 75 08             	push   0x8(%ebp)
+  800387:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80038d:	50                   	push   %eax
+  80038e:	68 20 03 80 00       	push   $0x800320
+  800393:	e8 14 01 00 00       	call   8004ac <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800398:	83 c4 08             	add    $0x8,%esp
+  80039b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003a1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003a7:	50                   	push   %eax
+  8003a8:	e8 30 09 00 00       	call   800cdd <sys_cputs>
+
+	return b.cnt;
+}
+  8003ad:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003b3:	c9                   	leave
+  8003b4:	c3                   	ret
+
+008003b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003b5:	55                   	push   %ebp
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003bb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003be:	50                   	push   %eax
+  8003bf:	ff 75 08             	push   0x8(%ebp)
+  8003c2:	e8 9d ff ff ff       	call   800364 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003c7:	c9                   	leave
+  8003c8:	c3                   	ret
+
+008003c9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+  8003cf:	83 ec 1c             	sub    $0x1c,%esp
+  8003d2:	89 c7                	mov    %eax,%edi
+  8003d4:	89 d6                	mov    %edx,%esi
+  8003d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003dc:	89 d1                	mov    %edx,%ecx
+  8003de:	89 c2                	mov    %eax,%edx
+  8003e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003e9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003f6:	39 c2                	cmp    %eax,%edx
+  8003f8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003fb:	72 3e                	jb     80043b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003fd:	83 ec 0c             	sub    $0xc,%esp
+  800400:	ff 75 18             	push   0x18(%ebp)
+  800403:	83 eb 01             	sub    $0x1,%ebx
+  800406:	53                   	push   %ebx
+  800407:	50                   	push   %eax
+  800408:	83 ec 08             	sub    $0x8,%esp
+  80040b:	ff 75 e4             	push   -0x1c(%ebp)
+  80040e:	ff 75 e0             	push   -0x20(%ebp)
+  800411:	ff 75 dc             	push   -0x24(%ebp)
+  800414:	ff 75 d8             	push   -0x28(%ebp)
+  800417:	e8 21 43 00 00       	call   80473d <__udivdi3>
+  80041c:	83 c4 18             	add    $0x18,%esp
+  80041f:	52                   	push   %edx
+  800420:	50                   	push   %eax
+  800421:	89 f2                	mov    %esi,%edx
+  800423:	89 f8                	mov    %edi,%eax
+  800425:	e8 9f ff ff ff       	call   8003c9 <printnum>
+  80042a:	83 c4 20             	add    $0x20,%esp
+  80042d:	eb 13                	jmp    800442 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	56                   	push   %esi
+  800433:	ff 75 18             	push   0x18(%ebp)
+  800436:	ff d7                	call   *%edi
+  800438:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80043b:	83 eb 01             	sub    $0x1,%ebx
+  80043e:	85 db                	test   %ebx,%ebx
+  800440:	7f ed                	jg     80042f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	56                   	push   %esi
+  800446:	83 ec 04             	sub    $0x4,%esp
+  800449:	ff 75 e4             	push   -0x1c(%ebp)
+  80044c:	ff 75 e0             	push   -0x20(%ebp)
+  80044f:	ff 75 dc             	push   -0x24(%ebp)
+  800452:	ff 75 d8             	push   -0x28(%ebp)
+  800455:	e8 04 43 00 00       	call   80475e <__umoddi3>
+  80045a:	83 c4 14             	add    $0x14,%esp
+  80045d:	0f be 80 9f 49 80 00 	movsbl 0x80499f(%eax),%eax
+  800464:	50                   	push   %eax
+  800465:	ff d7                	call   *%edi
+}
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046d:	5b                   	pop    %ebx
+  80046e:	5e                   	pop    %esi
+  80046f:	5f                   	pop    %edi
+  800470:	5d                   	pop    %ebp
+  800471:	c3                   	ret
+
+00800472 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800472:	55                   	push   %ebp
+  800473:	89 e5                	mov    %esp,%ebp
+  800475:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800478:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80047c:	8b 10                	mov    (%eax),%edx
+  80047e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800481:	73 0a                	jae    80048d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800483:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800486:	89 08                	mov    %ecx,(%eax)
+  800488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80048b:	88 02                	mov    %al,(%edx)
+}
+  80048d:	5d                   	pop    %ebp
+  80048e:	c3                   	ret
+
+0080048f <printfmt>:
+{
+  80048f:	55                   	push   %ebp
+  800490:	89 e5                	mov    %esp,%ebp
+  800492:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800495:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800498:	50                   	push   %eax
+  800499:	ff 75 10             	push   0x10(%ebp)
+  80049c:	ff 75 0c             	push   0xc(%ebp)
+  80049f:	ff 75 08             	push   0x8(%ebp)
+  8004a2:	e8 05 00 00 00       	call   8004ac <vprintfmt>
+}
+  8004a7:	83 c4 10             	add    $0x10,%esp
+  8004aa:	c9                   	leave
+  8004ab:	c3                   	ret
+
+008004ac <vprintfmt>:
+{
+  8004ac:	55                   	push   %ebp
+  8004ad:	89 e5                	mov    %esp,%ebp
+  8004af:	57                   	push   %edi
+  8004b0:	56                   	push   %esi
+  8004b1:	53                   	push   %ebx
+  8004b2:	83 ec 2c             	sub    $0x2c,%esp
+  8004b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004bb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004be:	eb 0a                	jmp    8004ca <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004c0:	83 ec 08             	sub    $0x8,%esp
+  8004c3:	53                   	push   %ebx
+  8004c4:	50                   	push   %eax
+  8004c5:	ff d6                	call   *%esi
+  8004c7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8004ca:	83 c7 01             	add    $0x1,%edi
+  8004cd:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8004d1:	83 f8 25             	cmp    $0x25,%eax
+  8004d4:	74 0c                	je     8004e2 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004d6:	85 c0                	test   %eax,%eax
+  8004d8:	75 e6                	jne    8004c0 <vprintfmt+0x14>
+}
+  8004da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004dd:	5b                   	pop    %ebx
+  8004de:	5e                   	pop    %esi
+  8004df:	5f                   	pop    %edi
+  8004e0:	5d                   	pop    %ebp
+  8004e1:	c3                   	ret
+		padc = ' ';
+  8004e2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004e6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ed:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004f4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800500:	8d 47 01             	lea    0x1(%edi),%eax
+  800503:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800506:	0f b6 17             	movzbl (%edi),%edx
+  800509:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80050c:	3c 55                	cmp    $0x55,%al
+  80050e:	0f 87 c5 03 00 00    	ja     8008d9 <vprintfmt+0x42d>
+  800514:	0f b6 c0             	movzbl %al,%eax
+  800517:	ff 24 85 20 4b 80 00 	jmp    *0x804b20(,%eax,4)
+  80051e:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800521:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800524:	eb da                	jmp    800500 <vprintfmt+0x54>
+  800526:	0f be d2             	movsbl %dl,%edx
+  800529:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80052c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800531:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800534:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800537:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80053b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80053e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800541:	83 f9 09             	cmp    $0x9,%ecx
+  800544:	77 55                	ja     80059b <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800546:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800549:	eb e9                	jmp    800534 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8b 00                	mov    (%eax),%eax
+  800550:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80055c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80055f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800563:	79 9b                	jns    800500 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800565:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800568:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80056b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800572:	eb 8c                	jmp    800500 <vprintfmt+0x54>
+			if (width < 0)
+  800574:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800577:	85 d2                	test   %edx,%edx
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	0f 49 c2             	cmovns %edx,%eax
+  800581:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800584:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800587:	e9 74 ff ff ff       	jmp    800500 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80058c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80058f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800596:	e9 65 ff ff ff       	jmp    800500 <vprintfmt+0x54>
+  80059b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80059e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005a1:	eb bc                	jmp    80055f <vprintfmt+0xb3>
+			lflag++;
+  8005a3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8005a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005a9:	e9 52 ff ff ff       	jmp    800500 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8d 78 04             	lea    0x4(%eax),%edi
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	53                   	push   %ebx
+  8005b8:	ff 30                	push   (%eax)
+  8005ba:	ff d6                	call   *%esi
+			break;
+  8005bc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005bf:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005c2:	e9 b1 02 00 00       	jmp    800878 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	89 d0                	mov    %edx,%eax
+  8005d1:	f7 d8                	neg    %eax
+  8005d3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005d6:	83 f8 14             	cmp    $0x14,%eax
+  8005d9:	7f 23                	jg     8005fe <vprintfmt+0x152>
+  8005db:	8b 14 85 80 4c 80 00 	mov    0x804c80(,%eax,4),%edx
+  8005e2:	85 d2                	test   %edx,%edx
+  8005e4:	74 18                	je     8005fe <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8005e6:	52                   	push   %edx
+  8005e7:	68 c3 4e 80 00       	push   $0x804ec3
+  8005ec:	53                   	push   %ebx
+  8005ed:	56                   	push   %esi
+  8005ee:	e8 9c fe ff ff       	call   80048f <printfmt>
+  8005f3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005f6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005f9:	e9 7a 02 00 00       	jmp    800878 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 b7 49 80 00       	push   $0x8049b7
+  800604:	53                   	push   %ebx
+  800605:	56                   	push   %esi
+  800606:	e8 84 fe ff ff       	call   80048f <printfmt>
+  80060b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80060e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800611:	e9 62 02 00 00       	jmp    800878 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	83 c0 04             	add    $0x4,%eax
+  80061c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	b8 b0 49 80 00       	mov    $0x8049b0,%eax
+  80062b:	0f 45 c1             	cmovne %ecx,%eax
+  80062e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800631:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800635:	7e 06                	jle    80063d <vprintfmt+0x191>
+  800637:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80063b:	75 0b                	jne    800648 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80063d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800640:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800643:	89 75 08             	mov    %esi,0x8(%ebp)
+  800646:	eb 5c                	jmp    8006a4 <vprintfmt+0x1f8>
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	ff 75 d0             	push   -0x30(%ebp)
+  80064e:	ff 75 cc             	push   -0x34(%ebp)
+  800651:	e8 20 03 00 00       	call   800976 <strnlen>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065b:	29 d0                	sub    %edx,%eax
+  80065d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800660:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800664:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800667:	89 75 08             	mov    %esi,0x8(%ebp)
+  80066a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80066c:	eb 0e                	jmp    80067c <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80066e:	83 ec 08             	sub    $0x8,%esp
+  800671:	53                   	push   %ebx
+  800672:	57                   	push   %edi
+  800673:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800676:	83 ee 01             	sub    $0x1,%esi
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	85 f6                	test   %esi,%esi
+  80067e:	7f ee                	jg     80066e <vprintfmt+0x1c2>
+  800680:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800683:	8b 75 08             	mov    0x8(%ebp),%esi
+  800686:	85 c0                	test   %eax,%eax
+  800688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068d:	0f 49 d0             	cmovns %eax,%edx
+  800690:	29 d0                	sub    %edx,%eax
+  800692:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800695:	eb a6                	jmp    80063d <vprintfmt+0x191>
+					putch(ch, putdat);
+  800697:	83 ec 08             	sub    $0x8,%esp
+  80069a:	53                   	push   %ebx
+  80069b:	52                   	push   %edx
+  80069c:	ff 55 08             	call   *0x8(%ebp)
+  80069f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006a2:	89 f1                	mov    %esi,%ecx
+  8006a4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006a7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006ab:	0f be d0             	movsbl %al,%edx
+  8006ae:	85 d2                	test   %edx,%edx
+  8006b0:	74 28                	je     8006da <vprintfmt+0x22e>
+  8006b2:	85 ff                	test   %edi,%edi
+  8006b4:	78 05                	js     8006bb <vprintfmt+0x20f>
+  8006b6:	83 ef 01             	sub    $0x1,%edi
+  8006b9:	78 30                	js     8006eb <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006bb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006bf:	74 d6                	je     800697 <vprintfmt+0x1eb>
+  8006c1:	0f be c0             	movsbl %al,%eax
+  8006c4:	83 e8 20             	sub    $0x20,%eax
+  8006c7:	83 f8 5e             	cmp    $0x5e,%eax
+  8006ca:	76 cb                	jbe    800697 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8006cc:	83 ec 08             	sub    $0x8,%esp
+  8006cf:	53                   	push   %ebx
+  8006d0:	6a 3f                	push   $0x3f
+  8006d2:	ff 55 08             	call   *0x8(%ebp)
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	eb c8                	jmp    8006a2 <vprintfmt+0x1f6>
+  8006da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006dd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006e0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006e3:	01 d0                	add    %edx,%eax
+  8006e5:	29 c8                	sub    %ecx,%eax
+  8006e7:	89 c7                	mov    %eax,%edi
+  8006e9:	eb 13                	jmp    8006fe <vprintfmt+0x252>
+  8006eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ee:	eb ed                	jmp    8006dd <vprintfmt+0x231>
+				putch(' ', putdat);
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  8006f3:	53                   	push   %ebx
+  8006f4:	6a 20                	push   $0x20
+  8006f6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006f8:	83 ef 01             	sub    $0x1,%edi
+  8006fb:	83 c4 10             	add    $0x10,%esp
+  8006fe:	85 ff                	test   %edi,%edi
+  800700:	7f ee                	jg     8006f0 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800702:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+  800708:	e9 6b 01 00 00       	jmp    800878 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80070d:	83 f9 01             	cmp    $0x1,%ecx
+  800710:	7f 1f                	jg     800731 <vprintfmt+0x285>
+	else if (lflag)
+  800712:	85 c9                	test   %ecx,%ecx
+  800714:	74 67                	je     80077d <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 00                	mov    (%eax),%eax
+  80071b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80071e:	89 c1                	mov    %eax,%ecx
+  800720:	c1 f9 1f             	sar    $0x1f,%ecx
+  800723:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8d 40 04             	lea    0x4(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072f:	eb 17                	jmp    800748 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 50 04             	mov    0x4(%eax),%edx
+  800737:	8b 00                	mov    (%eax),%eax
+  800739:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8d 40 08             	lea    0x8(%eax),%eax
+  800745:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800748:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80074b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80074e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800753:	85 c9                	test   %ecx,%ecx
+  800755:	0f 89 03 01 00 00    	jns    80085e <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80075b:	83 ec 08             	sub    $0x8,%esp
+  80075e:	53                   	push   %ebx
+  80075f:	6a 2d                	push   $0x2d
+  800761:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800763:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800766:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800769:	f7 da                	neg    %edx
+  80076b:	83 d1 00             	adc    $0x0,%ecx
+  80076e:	f7 d9                	neg    %ecx
+  800770:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800773:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800778:	e9 e1 00 00 00       	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 00                	mov    (%eax),%eax
+  800782:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800785:	89 c1                	mov    %eax,%ecx
+  800787:	c1 f9 1f             	sar    $0x1f,%ecx
+  80078a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+  800796:	eb b0                	jmp    800748 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800798:	83 f9 01             	cmp    $0x1,%ecx
+  80079b:	7f 1e                	jg     8007bb <vprintfmt+0x30f>
+	else if (lflag)
+  80079d:	85 c9                	test   %ecx,%ecx
+  80079f:	74 32                	je     8007d3 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007b6:	e9 a3 00 00 00       	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 10                	mov    (%eax),%edx
+  8007c0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ce:	e9 8b 00 00 00       	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 10                	mov    (%eax),%edx
+  8007d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007e8:	eb 74                	jmp    80085e <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8007ea:	83 f9 01             	cmp    $0x1,%ecx
+  8007ed:	7f 1b                	jg     80080a <vprintfmt+0x35e>
+	else if (lflag)
+  8007ef:	85 c9                	test   %ecx,%ecx
+  8007f1:	74 2c                	je     80081f <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 10                	mov    (%eax),%edx
+  8007f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800800:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800803:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800808:	eb 54                	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 10                	mov    (%eax),%edx
+  80080f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800812:	8d 40 08             	lea    0x8(%eax),%eax
+  800815:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800818:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80081d:	eb 3f                	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8b 10                	mov    (%eax),%edx
+  800824:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800829:	8d 40 04             	lea    0x4(%eax),%eax
+  80082c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80082f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800834:	eb 28                	jmp    80085e <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	53                   	push   %ebx
+  80083a:	6a 30                	push   $0x30
+  80083c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80083e:	83 c4 08             	add    $0x8,%esp
+  800841:	53                   	push   %ebx
+  800842:	6a 78                	push   $0x78
+  800844:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8b 10                	mov    (%eax),%edx
+  80084b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800850:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800853:	8d 40 04             	lea    0x4(%eax),%eax
+  800856:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800859:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80085e:	83 ec 0c             	sub    $0xc,%esp
+  800861:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800865:	50                   	push   %eax
+  800866:	ff 75 e0             	push   -0x20(%ebp)
+  800869:	57                   	push   %edi
+  80086a:	51                   	push   %ecx
+  80086b:	52                   	push   %edx
+  80086c:	89 da                	mov    %ebx,%edx
+  80086e:	89 f0                	mov    %esi,%eax
+  800870:	e8 54 fb ff ff       	call   8003c9 <printnum>
+			break;
+  800875:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800878:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80087b:	e9 4a fc ff ff       	jmp    8004ca <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800880:	83 f9 01             	cmp    $0x1,%ecx
+  800883:	7f 1b                	jg     8008a0 <vprintfmt+0x3f4>
+	else if (lflag)
+  800885:	85 c9                	test   %ecx,%ecx
+  800887:	74 2c                	je     8008b5 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800889:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088c:	8b 10                	mov    (%eax),%edx
+  80088e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800893:	8d 40 04             	lea    0x4(%eax),%eax
+  800896:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800899:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80089e:	eb be                	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 10                	mov    (%eax),%edx
+  8008a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008b3:	eb a9                	jmp    80085e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b8:	8b 10                	mov    (%eax),%edx
+  8008ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008ca:	eb 92                	jmp    80085e <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8008cc:	83 ec 08             	sub    $0x8,%esp
+  8008cf:	53                   	push   %ebx
+  8008d0:	6a 25                	push   $0x25
+  8008d2:	ff d6                	call   *%esi
+			break;
+  8008d4:	83 c4 10             	add    $0x10,%esp
+  8008d7:	eb 9f                	jmp    800878 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8008d9:	83 ec 08             	sub    $0x8,%esp
+  8008dc:	53                   	push   %ebx
+  8008dd:	6a 25                	push   $0x25
+  8008df:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008e1:	83 c4 10             	add    $0x10,%esp
+  8008e4:	89 f8                	mov    %edi,%eax
+  8008e6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ea:	74 05                	je     8008f1 <vprintfmt+0x445>
+  8008ec:	83 e8 01             	sub    $0x1,%eax
+  8008ef:	eb f5                	jmp    8008e6 <vprintfmt+0x43a>
+  8008f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008f4:	eb 82                	jmp    800878 <vprintfmt+0x3cc>
+
+008008f6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	83 ec 18             	sub    $0x18,%esp
+  8008fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800902:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800905:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800909:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80090c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800913:	85 c0                	test   %eax,%eax
+  800915:	74 26                	je     80093d <vsnprintf+0x47>
+  800917:	85 d2                	test   %edx,%edx
+  800919:	7e 22                	jle    80093d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80091b:	ff 75 14             	push   0x14(%ebp)
+  80091e:	ff 75 10             	push   0x10(%ebp)
+  800921:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800924:	50                   	push   %eax
+  800925:	68 72 04 80 00       	push   $0x800472
+  80092a:	e8 7d fb ff ff       	call   8004ac <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80092f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800932:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800935:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800938:	83 c4 10             	add    $0x10,%esp
+}
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+		return -E_INVAL;
+  80093d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800942:	eb f7                	jmp    80093b <vsnprintf+0x45>
+
+00800944 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80094a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80094d:	50                   	push   %eax
+  80094e:	ff 75 10             	push   0x10(%ebp)
+  800951:	ff 75 0c             	push   0xc(%ebp)
+  800954:	ff 75 08             	push   0x8(%ebp)
+  800957:	e8 9a ff ff ff       	call   8008f6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+
+0080095e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800964:	b8 00 00 00 00       	mov    $0x0,%eax
+  800969:	eb 03                	jmp    80096e <strlen+0x10>
+		n++;
+  80096b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80096e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800972:	75 f7                	jne    80096b <strlen+0xd>
+	return n;
+}
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80097c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800984:	eb 03                	jmp    800989 <strnlen+0x13>
+		n++;
+  800986:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800989:	39 d0                	cmp    %edx,%eax
+  80098b:	74 08                	je     800995 <strnlen+0x1f>
+  80098d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800991:	75 f3                	jne    800986 <strnlen+0x10>
+  800993:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800995:	89 d0                	mov    %edx,%eax
+  800997:	5d                   	pop    %ebp
+  800998:	c3                   	ret
+
+00800999 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	53                   	push   %ebx
+  80099d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009ac:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009af:	83 c0 01             	add    $0x1,%eax
+  8009b2:	84 d2                	test   %dl,%dl
+  8009b4:	75 f2                	jne    8009a8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009b6:	89 c8                	mov    %ecx,%eax
+  8009b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009bb:	c9                   	leave
+  8009bc:	c3                   	ret
+
+008009bd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	53                   	push   %ebx
+  8009c1:	83 ec 10             	sub    $0x10,%esp
+  8009c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009c7:	53                   	push   %ebx
+  8009c8:	e8 91 ff ff ff       	call   80095e <strlen>
+  8009cd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009d0:	ff 75 0c             	push   0xc(%ebp)
+  8009d3:	01 d8                	add    %ebx,%eax
+  8009d5:	50                   	push   %eax
+  8009d6:	e8 be ff ff ff       	call   800999 <strcpy>
+	return dst;
+}
+  8009db:	89 d8                	mov    %ebx,%eax
+  8009dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+
+008009e2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	56                   	push   %esi
+  8009e6:	53                   	push   %ebx
+  8009e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009ed:	89 f3                	mov    %esi,%ebx
+  8009ef:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009f2:	89 f0                	mov    %esi,%eax
+  8009f4:	eb 0f                	jmp    800a05 <strncpy+0x23>
+		*dst++ = *src;
+  8009f6:	83 c0 01             	add    $0x1,%eax
+  8009f9:	0f b6 0a             	movzbl (%edx),%ecx
+  8009fc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009ff:	80 f9 01             	cmp    $0x1,%cl
+  800a02:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a05:	39 d8                	cmp    %ebx,%eax
+  800a07:	75 ed                	jne    8009f6 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a09:	89 f0                	mov    %esi,%eax
+  800a0b:	5b                   	pop    %ebx
+  800a0c:	5e                   	pop    %esi
+  800a0d:	5d                   	pop    %ebp
+  800a0e:	c3                   	ret
+
+00800a0f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	56                   	push   %esi
+  800a13:	53                   	push   %ebx
+  800a14:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a1a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a1d:	89 f0                	mov    %esi,%eax
+  800a1f:	85 d2                	test   %edx,%edx
+  800a21:	74 21                	je     800a44 <strlcpy+0x35>
+  800a23:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a27:	89 f2                	mov    %esi,%edx
+  800a29:	eb 09                	jmp    800a34 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a2b:	83 c1 01             	add    $0x1,%ecx
+  800a2e:	83 c2 01             	add    $0x1,%edx
+  800a31:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a34:	39 c2                	cmp    %eax,%edx
+  800a36:	74 09                	je     800a41 <strlcpy+0x32>
+  800a38:	0f b6 19             	movzbl (%ecx),%ebx
+  800a3b:	84 db                	test   %bl,%bl
+  800a3d:	75 ec                	jne    800a2b <strlcpy+0x1c>
+  800a3f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a41:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a44:	29 f0                	sub    %esi,%eax
+}
+  800a46:	5b                   	pop    %ebx
+  800a47:	5e                   	pop    %esi
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+
+00800a4a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a50:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a53:	eb 06                	jmp    800a5b <strcmp+0x11>
+		p++, q++;
+  800a55:	83 c1 01             	add    $0x1,%ecx
+  800a58:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a5b:	0f b6 01             	movzbl (%ecx),%eax
+  800a5e:	84 c0                	test   %al,%al
+  800a60:	74 04                	je     800a66 <strcmp+0x1c>
+  800a62:	3a 02                	cmp    (%edx),%al
+  800a64:	74 ef                	je     800a55 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a66:	0f b6 c0             	movzbl %al,%eax
+  800a69:	0f b6 12             	movzbl (%edx),%edx
+  800a6c:	29 d0                	sub    %edx,%eax
+}
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	53                   	push   %ebx
+  800a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a7d:	eb 09                	jmp    800a88 <strncmp+0x18>
+		n--, p++, q++;
+  800a7f:	83 ea 01             	sub    $0x1,%edx
+  800a82:	83 c0 01             	add    $0x1,%eax
+  800a85:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a88:	85 d2                	test   %edx,%edx
+  800a8a:	74 18                	je     800aa4 <strncmp+0x34>
+  800a8c:	0f b6 18             	movzbl (%eax),%ebx
+  800a8f:	84 db                	test   %bl,%bl
+  800a91:	74 04                	je     800a97 <strncmp+0x27>
+  800a93:	3a 19                	cmp    (%ecx),%bl
+  800a95:	74 e8                	je     800a7f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a97:	0f b6 00             	movzbl (%eax),%eax
+  800a9a:	0f b6 11             	movzbl (%ecx),%edx
+  800a9d:	29 d0                	sub    %edx,%eax
+}
+  800a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa2:	c9                   	leave
+  800aa3:	c3                   	ret
+		return 0;
+  800aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa9:	eb f4                	jmp    800a9f <strncmp+0x2f>
+
+00800aab <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ab5:	eb 03                	jmp    800aba <strchr+0xf>
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	0f b6 10             	movzbl (%eax),%edx
+  800abd:	84 d2                	test   %dl,%dl
+  800abf:	74 06                	je     800ac7 <strchr+0x1c>
+		if (*s == c)
+  800ac1:	38 ca                	cmp    %cl,%dl
+  800ac3:	75 f2                	jne    800ab7 <strchr+0xc>
+  800ac5:	eb 05                	jmp    800acc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ad8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800adb:	38 ca                	cmp    %cl,%dl
+  800add:	74 09                	je     800ae8 <strfind+0x1a>
+  800adf:	84 d2                	test   %dl,%dl
+  800ae1:	74 05                	je     800ae8 <strfind+0x1a>
+	for (; *s; s++)
+  800ae3:	83 c0 01             	add    $0x1,%eax
+  800ae6:	eb f0                	jmp    800ad8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	57                   	push   %edi
+  800aee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800af1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800af4:	85 c9                	test   %ecx,%ecx
+  800af6:	74 20                	je     800b18 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800af8:	89 f8                	mov    %edi,%eax
+  800afa:	09 c8                	or     %ecx,%eax
+  800afc:	a8 03                	test   $0x3,%al
+  800afe:	75 12                	jne    800b12 <memset+0x28>
+		c &= 0xFF;
+  800b00:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b04:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b0a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b0d:	fc                   	cld
+  800b0e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b10:	eb 06                	jmp    800b18 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b15:	fc                   	cld
+  800b16:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b18:	89 f8                	mov    %edi,%eax
+  800b1a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b1d:	c9                   	leave
+  800b1e:	c3                   	ret
+
+00800b1f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b27:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b2d:	39 c6                	cmp    %eax,%esi
+  800b2f:	73 32                	jae    800b63 <memmove+0x44>
+  800b31:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b34:	39 d0                	cmp    %edx,%eax
+  800b36:	73 2b                	jae    800b63 <memmove+0x44>
+		s += n;
+		d += n;
+  800b38:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b3b:	89 d6                	mov    %edx,%esi
+  800b3d:	09 fe                	or     %edi,%esi
+  800b3f:	09 ce                	or     %ecx,%esi
+  800b41:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b47:	75 0e                	jne    800b57 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b49:	83 ef 04             	sub    $0x4,%edi
+  800b4c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b4f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b52:	fd                   	std
+  800b53:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b55:	eb 09                	jmp    800b60 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b57:	83 ef 01             	sub    $0x1,%edi
+  800b5a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b5d:	fd                   	std
+  800b5e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b60:	fc                   	cld
+  800b61:	eb 1a                	jmp    800b7d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b63:	89 f2                	mov    %esi,%edx
+  800b65:	09 c2                	or     %eax,%edx
+  800b67:	09 ca                	or     %ecx,%edx
+  800b69:	f6 c2 03             	test   $0x3,%dl
+  800b6c:	75 0a                	jne    800b78 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b6e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b71:	89 c7                	mov    %eax,%edi
+  800b73:	fc                   	cld
+  800b74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b76:	eb 05                	jmp    800b7d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b78:	89 c7                	mov    %eax,%edi
+  800b7a:	fc                   	cld
+  800b7b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b87:	ff 75 10             	push   0x10(%ebp)
+  800b8a:	ff 75 0c             	push   0xc(%ebp)
+  800b8d:	ff 75 08             	push   0x8(%ebp)
+  800b90:	e8 8a ff ff ff       	call   800b1f <memmove>
+}
+  800b95:	c9                   	leave
+  800b96:	c3                   	ret
+
+00800b97 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	56                   	push   %esi
+  800b9b:	53                   	push   %ebx
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ba2:	89 c6                	mov    %eax,%esi
+  800ba4:	03 75 10             	add    0x10(%ebp),%esi
+  800ba7:	eb 06                	jmp    800baf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ba9:	83 c0 01             	add    $0x1,%eax
+  800bac:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800baf:	39 f0                	cmp    %esi,%eax
+  800bb1:	74 14                	je     800bc7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bb3:	0f b6 08             	movzbl (%eax),%ecx
+  800bb6:	0f b6 1a             	movzbl (%edx),%ebx
+  800bb9:	38 d9                	cmp    %bl,%cl
+  800bbb:	74 ec                	je     800ba9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bbd:	0f b6 c1             	movzbl %cl,%eax
+  800bc0:	0f b6 db             	movzbl %bl,%ebx
+  800bc3:	29 d8                	sub    %ebx,%eax
+  800bc5:	eb 05                	jmp    800bcc <memcmp+0x35>
+	}
+
+	return 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+
+00800bd0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bd9:	89 c2                	mov    %eax,%edx
+  800bdb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bde:	eb 03                	jmp    800be3 <memfind+0x13>
+  800be0:	83 c0 01             	add    $0x1,%eax
+  800be3:	39 d0                	cmp    %edx,%eax
+  800be5:	73 04                	jae    800beb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800be7:	38 08                	cmp    %cl,(%eax)
+  800be9:	75 f5                	jne    800be0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bf9:	eb 03                	jmp    800bfe <strtol+0x11>
+		s++;
+  800bfb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bfe:	0f b6 02             	movzbl (%edx),%eax
+  800c01:	3c 20                	cmp    $0x20,%al
+  800c03:	74 f6                	je     800bfb <strtol+0xe>
+  800c05:	3c 09                	cmp    $0x9,%al
+  800c07:	74 f2                	je     800bfb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c09:	3c 2b                	cmp    $0x2b,%al
+  800c0b:	74 2a                	je     800c37 <strtol+0x4a>
+	int neg = 0;
+  800c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c12:	3c 2d                	cmp    $0x2d,%al
+  800c14:	74 2b                	je     800c41 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c16:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c1c:	75 0f                	jne    800c2d <strtol+0x40>
+  800c1e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c21:	74 28                	je     800c4b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c23:	85 db                	test   %ebx,%ebx
+  800c25:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c2a:	0f 44 d8             	cmove  %eax,%ebx
+  800c2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c32:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c35:	eb 46                	jmp    800c7d <strtol+0x90>
+		s++;
+  800c37:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c3f:	eb d5                	jmp    800c16 <strtol+0x29>
+		s++, neg = 1;
+  800c41:	83 c2 01             	add    $0x1,%edx
+  800c44:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c49:	eb cb                	jmp    800c16 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c4b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c4f:	74 0e                	je     800c5f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c51:	85 db                	test   %ebx,%ebx
+  800c53:	75 d8                	jne    800c2d <strtol+0x40>
+		s++, base = 8;
+  800c55:	83 c2 01             	add    $0x1,%edx
+  800c58:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c5d:	eb ce                	jmp    800c2d <strtol+0x40>
+		s += 2, base = 16;
+  800c5f:	83 c2 02             	add    $0x2,%edx
+  800c62:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c67:	eb c4                	jmp    800c2d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c69:	0f be c0             	movsbl %al,%eax
+  800c6c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c6f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c72:	7d 3a                	jge    800cae <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c74:	83 c2 01             	add    $0x1,%edx
+  800c77:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c7b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c7d:	0f b6 02             	movzbl (%edx),%eax
+  800c80:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c83:	89 f3                	mov    %esi,%ebx
+  800c85:	80 fb 09             	cmp    $0x9,%bl
+  800c88:	76 df                	jbe    800c69 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c8a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c8d:	89 f3                	mov    %esi,%ebx
+  800c8f:	80 fb 19             	cmp    $0x19,%bl
+  800c92:	77 08                	ja     800c9c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c94:	0f be c0             	movsbl %al,%eax
+  800c97:	83 e8 57             	sub    $0x57,%eax
+  800c9a:	eb d3                	jmp    800c6f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c9c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c9f:	89 f3                	mov    %esi,%ebx
+  800ca1:	80 fb 19             	cmp    $0x19,%bl
+  800ca4:	77 08                	ja     800cae <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ca6:	0f be c0             	movsbl %al,%eax
+  800ca9:	83 e8 37             	sub    $0x37,%eax
+  800cac:	eb c1                	jmp    800c6f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cb2:	74 05                	je     800cb9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800cb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cb9:	89 c8                	mov    %ecx,%eax
+  800cbb:	f7 d8                	neg    %eax
+  800cbd:	85 ff                	test   %edi,%edi
+  800cbf:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cc2:	89 c8                	mov    %ecx,%eax
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+
+00800cc9 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800ccf:	6a 00                	push   $0x0
+  800cd1:	6a 00                	push   $0x0
+  800cd3:	ff 75 08             	push   0x8(%ebp)
+  800cd6:	e8 12 ff ff ff       	call   800bed <strtol>
+}
+  800cdb:	c9                   	leave
+  800cdc:	c3                   	ret
+
+00800cdd <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	57                   	push   %edi
+  800ce1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	89 c3                	mov    %eax,%ebx
+  800cef:	89 c7                	mov    %eax,%edi
+  800cf1:	6a 00                	push   $0x0
+  800cf3:	55                   	push   %ebp
+  800cf4:	56                   	push   %esi
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	8d 35 ff 0c 80 00    	lea    0x800cff,%esi
+  800cfd:	0f 34                	sysenter
+
+00800cff <after_sysenter_label_47>:
+  800cff:	5e                   	pop    %esi
+  800d00:	5d                   	pop    %ebp
+  800d01:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d04:	5b                   	pop    %ebx
+  800d05:	5f                   	pop    %edi
+  800d06:	5d                   	pop    %ebp
+  800d07:	c3                   	ret
+
+00800d08 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d17:	89 d1                	mov    %edx,%ecx
+  800d19:	89 d3                	mov    %edx,%ebx
+  800d1b:	89 d7                	mov    %edx,%edi
+  800d1d:	6a 00                	push   $0x0
+  800d1f:	55                   	push   %ebp
+  800d20:	56                   	push   %esi
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	8d 35 2b 0d 80 00    	lea    0x800d2b,%esi
+  800d29:	0f 34                	sysenter
+
+00800d2b <after_sysenter_label_128>:
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d30:	5b                   	pop    %ebx
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d41:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d46:	89 cb                	mov    %ecx,%ebx
+  800d48:	89 cf                	mov    %ecx,%edi
+  800d4a:	6a 00                	push   $0x0
+  800d4c:	55                   	push   %ebp
+  800d4d:	56                   	push   %esi
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	8d 35 58 0d 80 00    	lea    0x800d58,%esi
+  800d56:	0f 34                	sysenter
+
+00800d58 <after_sysenter_label_212>:
+  800d58:	5e                   	pop    %esi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	7f 07                	jg     800d68 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d64:	5b                   	pop    %ebx
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+  800d6b:	50                   	push   %eax
+  800d6c:	6a 03                	push   $0x3
+  800d6e:	68 15 4d 80 00       	push   $0x804d15
+  800d73:	6a 54                	push   $0x54
+  800d75:	68 32 4d 80 00       	push   $0x804d32
+  800d7a:	e8 5b f5 ff ff       	call   8002da <_panic>
+
+00800d7f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	57                   	push   %edi
+  800d83:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d89:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d8e:	89 d1                	mov    %edx,%ecx
+  800d90:	89 d3                	mov    %edx,%ebx
+  800d92:	89 d7                	mov    %edx,%edi
+  800d94:	6a 00                	push   $0x0
+  800d96:	55                   	push   %ebp
+  800d97:	56                   	push   %esi
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	8d 35 a2 0d 80 00    	lea    0x800da2,%esi
+  800da0:	0f 34                	sysenter
+
+00800da2 <after_sysenter_label_309>:
+  800da2:	5e                   	pop    %esi
+  800da3:	5d                   	pop    %ebp
+  800da4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da7:	5b                   	pop    %ebx
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+
+00800dab <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800db0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dba:	89 d1                	mov    %edx,%ecx
+  800dbc:	89 d3                	mov    %edx,%ebx
+  800dbe:	89 d7                	mov    %edx,%edi
+  800dc0:	6a 00                	push   $0x0
+  800dc2:	55                   	push   %ebp
+  800dc3:	56                   	push   %esi
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	8d 35 ce 0d 80 00    	lea    0x800dce,%esi
+  800dcc:	0f 34                	sysenter
+
+00800dce <after_sysenter_label_391>:
+  800dce:	5e                   	pop    %esi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5f                   	pop    %edi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+
+00800dd7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800def:	6a 00                	push   $0x0
+  800df1:	55                   	push   %ebp
+  800df2:	56                   	push   %esi
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	8d 35 fd 0d 80 00    	lea    0x800dfd,%esi
+  800dfb:	0f 34                	sysenter
+
+00800dfd <after_sysenter_label_479>:
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5d                   	pop    %ebp
+  800dff:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	7f 07                	jg     800e0d <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  800e10:	50                   	push   %eax
+  800e11:	6a 04                	push   $0x4
+  800e13:	68 15 4d 80 00       	push   $0x804d15
+  800e18:	6a 54                	push   $0x54
+  800e1a:	68 32 4d 80 00       	push   $0x804d32
+  800e1f:	e8 b6 f4 ff ff       	call   8002da <_panic>
+
+00800e24 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e37:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3a:	ff 75 18             	push   0x18(%ebp)
+  800e3d:	55                   	push   %ebp
+  800e3e:	56                   	push   %esi
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	8d 35 49 0e 80 00    	lea    0x800e49,%esi
+  800e47:	0f 34                	sysenter
+
+00800e49 <after_sysenter_label_593>:
+  800e49:	5e                   	pop    %esi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 07                	jg     800e59 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 05                	push   $0x5
+  800e5f:	68 15 4d 80 00       	push   $0x804d15
+  800e64:	6a 54                	push   $0x54
+  800e66:	68 32 4d 80 00       	push   $0x804d32
+  800e6b:	e8 6a f4 ff ff       	call   8002da <_panic>
+
+00800e70 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e80:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e85:	89 df                	mov    %ebx,%edi
+  800e87:	6a 00                	push   $0x0
+  800e89:	55                   	push   %ebp
+  800e8a:	56                   	push   %esi
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	8d 35 95 0e 80 00    	lea    0x800e95,%esi
+  800e93:	0f 34                	sysenter
+
+00800e95 <after_sysenter_label_704>:
+  800e95:	5e                   	pop    %esi
+  800e96:	5d                   	pop    %ebp
+  800e97:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	7f 07                	jg     800ea5 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5f                   	pop    %edi
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea5:	83 ec 0c             	sub    $0xc,%esp
+  800ea8:	50                   	push   %eax
+  800ea9:	6a 06                	push   $0x6
+  800eab:	68 15 4d 80 00       	push   $0x804d15
+  800eb0:	6a 54                	push   $0x54
+  800eb2:	68 32 4d 80 00       	push   $0x804d32
+  800eb7:	e8 1e f4 ff ff       	call   8002da <_panic>
+
+00800ebc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	57                   	push   %edi
+  800ec0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ed1:	89 df                	mov    %ebx,%edi
+  800ed3:	6a 00                	push   $0x0
+  800ed5:	55                   	push   %ebp
+  800ed6:	56                   	push   %esi
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	8d 35 e1 0e 80 00    	lea    0x800ee1,%esi
+  800edf:	0f 34                	sysenter
+
+00800ee1 <after_sysenter_label_808>:
+  800ee1:	5e                   	pop    %esi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ee6:	85 c0                	test   %eax,%eax
+  800ee8:	7f 07                	jg     800ef1 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eed:	5b                   	pop    %ebx
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+  800ef4:	50                   	push   %eax
+  800ef5:	6a 08                	push   $0x8
+  800ef7:	68 15 4d 80 00       	push   $0x804d15
+  800efc:	6a 54                	push   $0x54
+  800efe:	68 32 4d 80 00       	push   $0x804d32
+  800f03:	e8 d2 f3 ff ff       	call   8002da <_panic>
+
+00800f08 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f18:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f1d:	89 df                	mov    %ebx,%edi
+  800f1f:	6a 00                	push   $0x0
+  800f21:	55                   	push   %ebp
+  800f22:	56                   	push   %esi
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	8d 35 2d 0f 80 00    	lea    0x800f2d,%esi
+  800f2b:	0f 34                	sysenter
+
+00800f2d <after_sysenter_label_912>:
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 07                	jg     800f3d <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	50                   	push   %eax
+  800f41:	6a 09                	push   $0x9
+  800f43:	68 15 4d 80 00       	push   $0x804d15
+  800f48:	6a 54                	push   $0x54
+  800f4a:	68 32 4d 80 00       	push   $0x804d32
+  800f4f:	e8 86 f3 ff ff       	call   8002da <_panic>
+
+00800f54 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f69:	89 df                	mov    %ebx,%edi
+  800f6b:	6a 00                	push   $0x0
+  800f6d:	55                   	push   %ebp
+  800f6e:	56                   	push   %esi
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	8d 35 79 0f 80 00    	lea    0x800f79,%esi
+  800f77:	0f 34                	sysenter
+
+00800f79 <after_sysenter_label_1016>:
+  800f79:	5e                   	pop    %esi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f7e:	85 c0                	test   %eax,%eax
+  800f80:	7f 07                	jg     800f89 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f85:	5b                   	pop    %ebx
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 0a                	push   $0xa
+  800f8f:	68 15 4d 80 00       	push   $0x804d15
+  800f94:	6a 54                	push   $0x54
+  800f96:	68 32 4d 80 00       	push   $0x804d32
+  800f9b:	e8 3a f3 ff ff       	call   8002da <_panic>
+
+00800fa0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb6:	6a 00                	push   $0x0
+  800fb8:	55                   	push   %ebp
+  800fb9:	56                   	push   %esi
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	8d 35 c4 0f 80 00    	lea    0x800fc4,%esi
+  800fc2:	0f 34                	sysenter
+
+00800fc4 <after_sysenter_label_1126>:
+  800fc4:	5e                   	pop    %esi
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+
+00800fcd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fda:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fdf:	89 cb                	mov    %ecx,%ebx
+  800fe1:	89 cf                	mov    %ecx,%edi
+  800fe3:	6a 00                	push   $0x0
+  800fe5:	55                   	push   %ebp
+  800fe6:	56                   	push   %esi
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	8d 35 f1 0f 80 00    	lea    0x800ff1,%esi
+  800fef:	0f 34                	sysenter
+
+00800ff1 <after_sysenter_label_1210>:
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ff6:	85 c0                	test   %eax,%eax
+  800ff8:	7f 07                	jg     801001 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ffa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ffd:	5b                   	pop    %ebx
+  800ffe:	5f                   	pop    %edi
+  800fff:	5d                   	pop    %ebp
+  801000:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	50                   	push   %eax
+  801005:	6a 0d                	push   $0xd
+  801007:	68 15 4d 80 00       	push   $0x804d15
+  80100c:	6a 54                	push   $0x54
+  80100e:	68 32 4d 80 00       	push   $0x804d32
+  801013:	e8 c2 f2 ff ff       	call   8002da <_panic>
+
+00801018 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80101d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	b8 42 00 00 00       	mov    $0x42,%eax
+  80102d:	89 df                	mov    %ebx,%edi
+  80102f:	6a 00                	push   $0x0
+  801031:	55                   	push   %ebp
+  801032:	56                   	push   %esi
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	8d 35 3d 10 80 00    	lea    0x80103d,%esi
+  80103b:	0f 34                	sysenter
+
+0080103d <after_sysenter_label_1311>:
+  80103d:	5e                   	pop    %esi
+  80103e:	5d                   	pop    %ebp
+  80103f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801042:	85 c0                	test   %eax,%eax
+  801044:	7f 07                	jg     80104d <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801046:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801049:	5b                   	pop    %ebx
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+  801050:	50                   	push   %eax
+  801051:	6a 42                	push   $0x42
+  801053:	68 15 4d 80 00       	push   $0x804d15
+  801058:	6a 54                	push   $0x54
+  80105a:	68 32 4d 80 00       	push   $0x804d32
+  80105f:	e8 76 f2 ff ff       	call   8002da <_panic>
+
+00801064 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801069:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801073:	89 d1                	mov    %edx,%ecx
+  801075:	89 d3                	mov    %edx,%ebx
+  801077:	89 d7                	mov    %edx,%edi
+  801079:	6a 00                	push   $0x0
+  80107b:	55                   	push   %ebp
+  80107c:	56                   	push   %esi
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	8d 35 87 10 80 00    	lea    0x801087,%esi
+  801085:	0f 34                	sysenter
+
+00801087 <after_sysenter_label_1411>:
+  801087:	5e                   	pop    %esi
+  801088:	5d                   	pop    %ebp
+  801089:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80108c:	5b                   	pop    %ebx
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+
+00801090 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801095:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010a5:	89 df                	mov    %ebx,%edi
+  8010a7:	6a 00                	push   $0x0
+  8010a9:	55                   	push   %ebp
+  8010aa:	56                   	push   %esi
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	8d 35 b5 10 80 00    	lea    0x8010b5,%esi
+  8010b3:	0f 34                	sysenter
+
+008010b5 <after_sysenter_label_1497>:
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8010ba:	5b                   	pop    %ebx
+  8010bb:	5f                   	pop    %edi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	c3                   	ret
+
+008010be <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010d3:	89 df                	mov    %ebx,%edi
+  8010d5:	6a 00                	push   $0x0
+  8010d7:	55                   	push   %ebp
+  8010d8:	56                   	push   %esi
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	8d 35 e3 10 80 00    	lea    0x8010e3,%esi
+  8010e1:	0f 34                	sysenter
+
+008010e3 <after_sysenter_label_1583>:
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8010e8:	5b                   	pop    %ebx
+  8010e9:	5f                   	pop    %edi
+  8010ea:	5d                   	pop    %ebp
+  8010eb:	c3                   	ret
+
+008010ec <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	57                   	push   %edi
+  8010f0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801101:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801104:	6a 00                	push   $0x0
+  801106:	55                   	push   %ebp
+  801107:	56                   	push   %esi
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	8d 35 12 11 80 00    	lea    0x801112,%esi
+  801110:	0f 34                	sysenter
+
+00801112 <after_sysenter_label_1672>:
+  801112:	5e                   	pop    %esi
+  801113:	5d                   	pop    %ebp
+  801114:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+
+0080111b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801130:	89 df                	mov    %ebx,%edi
+  801132:	6a 00                	push   $0x0
+  801134:	55                   	push   %ebp
+  801135:	56                   	push   %esi
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	8d 35 40 11 80 00    	lea    0x801140,%esi
+  80113e:	0f 34                	sysenter
+
+00801140 <after_sysenter_label_1758>:
+  801140:	5e                   	pop    %esi
+  801141:	5d                   	pop    %ebp
+  801142:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801145:	5b                   	pop    %ebx
+  801146:	5f                   	pop    %edi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+
+00801149 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801156:	b8 13 00 00 00       	mov    $0x13,%eax
+  80115b:	89 cb                	mov    %ecx,%ebx
+  80115d:	89 cf                	mov    %ecx,%edi
+  80115f:	6a 00                	push   $0x0
+  801161:	55                   	push   %ebp
+  801162:	56                   	push   %esi
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+
+0080116d <after_sysenter_label_1842>:
+  80116d:	5e                   	pop    %esi
+  80116e:	5d                   	pop    %ebp
+  80116f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801172:	85 c0                	test   %eax,%eax
+  801174:	7f 07                	jg     80117d <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117d:	83 ec 0c             	sub    $0xc,%esp
+  801180:	50                   	push   %eax
+  801181:	6a 13                	push   $0x13
+  801183:	68 15 4d 80 00       	push   $0x804d15
+  801188:	6a 54                	push   $0x54
+  80118a:	68 32 4d 80 00       	push   $0x804d32
+  80118f:	e8 46 f1 ff ff       	call   8002da <_panic>
+
+00801194 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801194:	55                   	push   %ebp
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	57                   	push   %edi
+  801198:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011a3:	89 d1                	mov    %edx,%ecx
+  8011a5:	89 d3                	mov    %edx,%ebx
+  8011a7:	89 d7                	mov    %edx,%edi
+  8011a9:	6a 00                	push   $0x0
+  8011ab:	55                   	push   %ebp
+  8011ac:	56                   	push   %esi
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	8d 35 b7 11 80 00    	lea    0x8011b7,%esi
+  8011b5:	0f 34                	sysenter
+
+008011b7 <after_sysenter_label_1939>:
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8011bc:	5b                   	pop    %ebx
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+
+008011c0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d8:	6a 00                	push   $0x0
+  8011da:	55                   	push   %ebp
+  8011db:	56                   	push   %esi
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	8d 35 e6 11 80 00    	lea    0x8011e6,%esi
+  8011e4:	0f 34                	sysenter
+
+008011e6 <after_sysenter_label_2028>:
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+
+008011ef <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ff:	b8 16 00 00 00       	mov    $0x16,%eax
+  801204:	89 df                	mov    %ebx,%edi
+  801206:	6a 00                	push   $0x0
+  801208:	55                   	push   %ebp
+  801209:	56                   	push   %esi
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	8d 35 14 12 80 00    	lea    0x801214,%esi
+  801212:	0f 34                	sysenter
+
+00801214 <after_sysenter_label_2114>:
+  801214:	5e                   	pop    %esi
+  801215:	5d                   	pop    %ebp
+  801216:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801219:	5b                   	pop    %ebx
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+
+0080121d <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801232:	89 df                	mov    %ebx,%edi
+  801234:	6a 00                	push   $0x0
+  801236:	55                   	push   %ebp
+  801237:	56                   	push   %esi
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	8d 35 42 12 80 00    	lea    0x801242,%esi
+  801240:	0f 34                	sysenter
+
+00801242 <after_sysenter_label_2200>:
+  801242:	5e                   	pop    %esi
+  801243:	5d                   	pop    %ebp
+  801244:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801247:	5b                   	pop    %ebx
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801255:	8b 55 08             	mov    0x8(%ebp),%edx
+  801258:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801260:	89 df                	mov    %ebx,%edi
+  801262:	6a 00                	push   $0x0
+  801264:	55                   	push   %ebp
+  801265:	56                   	push   %esi
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	8d 35 70 12 80 00    	lea    0x801270,%esi
+  80126e:	0f 34                	sysenter
+
+00801270 <after_sysenter_label_2286>:
+  801270:	5e                   	pop    %esi
+  801271:	5d                   	pop    %ebp
+  801272:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801275:	5b                   	pop    %ebx
+  801276:	5f                   	pop    %edi
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+
+00801279 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	57                   	push   %edi
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+  80127f:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801282:	89 d6                	mov    %edx,%esi
+  801284:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801287:	89 cf                	mov    %ecx,%edi
+  801289:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80128c:	89 fa                	mov    %edi,%edx
+  80128e:	80 ce 08             	or     $0x8,%dh
+  801291:	f6 c5 08             	test   $0x8,%ch
+  801294:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801297:	57                   	push   %edi
+  801298:	56                   	push   %esi
+  801299:	50                   	push   %eax
+  80129a:	56                   	push   %esi
+  80129b:	6a 00                	push   $0x0
+  80129d:	e8 82 fb ff ff       	call   800e24 <sys_page_map>
+	if (r < 0) {
+  8012a2:	83 c4 20             	add    $0x20,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 27                	js     8012d0 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	6a 00                	push   $0x0
+  8012b0:	56                   	push   %esi
+  8012b1:	6a 00                	push   $0x0
+  8012b3:	e8 6c fb ff ff       	call   800e24 <sys_page_map>
+  8012b8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012ba:	83 c4 20             	add    $0x20,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	78 24                	js     8012e5 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8012c6:	89 d8                	mov    %ebx,%eax
+  8012c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+  8012d0:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8012d2:	83 ec 08             	sub    $0x8,%esp
+  8012d5:	50                   	push   %eax
+  8012d6:	68 40 4d 80 00       	push   $0x804d40
+  8012db:	e8 d5 f0 ff ff       	call   8003b5 <cprintf>
+		return r;
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	eb e1                	jmp    8012c6 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8012e5:	83 ec 08             	sub    $0x8,%esp
+  8012e8:	50                   	push   %eax
+  8012e9:	68 70 4d 80 00       	push   $0x804d70
+  8012ee:	e8 c2 f0 ff ff       	call   8003b5 <cprintf>
+		return r;
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	eb ce                	jmp    8012c6 <duppage_cow+0x4d>
+
+008012f8 <duppage>:
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	53                   	push   %ebx
+  8012fc:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8012ff:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801302:	51                   	push   %ecx
+  801303:	52                   	push   %edx
+  801304:	50                   	push   %eax
+  801305:	52                   	push   %edx
+  801306:	6a 00                	push   $0x0
+  801308:	e8 17 fb ff ff       	call   800e24 <sys_page_map>
+	if (r < 0) {
+  80130d:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801310:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801315:	85 c0                	test   %eax,%eax
+  801317:	78 07                	js     801320 <duppage+0x28>
+}
+  801319:	89 d8                	mov    %ebx,%eax
+  80131b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+  801320:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801322:	83 ec 08             	sub    $0x8,%esp
+  801325:	50                   	push   %eax
+  801326:	68 40 4d 80 00       	push   $0x804d40
+  80132b:	e8 85 f0 ff ff       	call   8003b5 <cprintf>
+		return r;
+  801330:	83 c4 10             	add    $0x10,%esp
+  801333:	eb e4                	jmp    801319 <duppage+0x21>
+
+00801335 <cow_copy>:
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	56                   	push   %esi
+  801339:	53                   	push   %ebx
+  80133a:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80133c:	83 ec 04             	sub    $0x4,%esp
+  80133f:	6a 07                	push   $0x7
+  801341:	68 00 f0 7f 00       	push   $0x7ff000
+  801346:	6a 00                	push   $0x0
+  801348:	e8 8a fa ff ff       	call   800dd7 <sys_page_alloc>
+	if (r < 0) {
+  80134d:	83 c4 10             	add    $0x10,%esp
+  801350:	85 c0                	test   %eax,%eax
+  801352:	78 58                	js     8013ac <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801354:	83 ec 04             	sub    $0x4,%esp
+  801357:	68 00 10 00 00       	push   $0x1000
+  80135c:	56                   	push   %esi
+  80135d:	68 00 f0 7f 00       	push   $0x7ff000
+  801362:	e8 b8 f7 ff ff       	call   800b1f <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801367:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80136e:	56                   	push   %esi
+  80136f:	6a 00                	push   $0x0
+  801371:	68 00 f0 7f 00       	push   $0x7ff000
+  801376:	6a 00                	push   $0x0
+  801378:	e8 a7 fa ff ff       	call   800e24 <sys_page_map>
+  80137d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80137f:	83 c4 20             	add    $0x20,%esp
+  801382:	85 c0                	test   %eax,%eax
+  801384:	78 3b                	js     8013c1 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801386:	83 ec 08             	sub    $0x8,%esp
+  801389:	68 00 f0 7f 00       	push   $0x7ff000
+  80138e:	6a 00                	push   $0x0
+  801390:	e8 db fa ff ff       	call   800e70 <sys_page_unmap>
+  801395:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	78 45                	js     8013e3 <cow_copy+0xae>
+	return 0;
+  80139e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8013a3:	89 d8                	mov    %ebx,%eax
+  8013a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5d                   	pop    %ebp
+  8013ab:	c3                   	ret
+  8013ac:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8013ae:	83 ec 08             	sub    $0x8,%esp
+  8013b1:	50                   	push   %eax
+  8013b2:	68 60 4e 80 00       	push   $0x804e60
+  8013b7:	e8 f9 ef ff ff       	call   8003b5 <cprintf>
+		return r;
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	eb e2                	jmp    8013a3 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8013c1:	83 ec 08             	sub    $0x8,%esp
+  8013c4:	50                   	push   %eax
+  8013c5:	68 7c 4e 80 00       	push   $0x804e7c
+  8013ca:	e8 e6 ef ff ff       	call   8003b5 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8013cf:	83 c4 08             	add    $0x8,%esp
+  8013d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8013d7:	6a 00                	push   $0x0
+  8013d9:	e8 92 fa ff ff       	call   800e70 <sys_page_unmap>
+		return r;
+  8013de:	83 c4 10             	add    $0x10,%esp
+  8013e1:	eb c0                	jmp    8013a3 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8013e3:	83 ec 08             	sub    $0x8,%esp
+  8013e6:	50                   	push   %eax
+  8013e7:	68 98 4d 80 00       	push   $0x804d98
+  8013ec:	e8 c4 ef ff ff       	call   8003b5 <cprintf>
+		return r;
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	eb ad                	jmp    8013a3 <cow_copy+0x6e>
+
+008013f6 <pgfault>:
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+  8013fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8013fe:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801400:	89 d8                	mov    %ebx,%eax
+  801402:	c1 e8 16             	shr    $0x16,%eax
+  801405:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80140c:	89 de                	mov    %ebx,%esi
+  80140e:	c1 ee 0c             	shr    $0xc,%esi
+  801411:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801418:	a8 07                	test   $0x7,%al
+  80141a:	74 3b                	je     801457 <pgfault+0x61>
+  80141c:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801422:	74 33                	je     801457 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	68 00 f0 bf ee       	push   $0xeebff000
+  80142c:	e8 7c 26 00 00       	call   803aad <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801431:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801438:	83 c4 10             	add    $0x10,%esp
+  80143b:	f6 c4 08             	test   $0x8,%ah
+  80143e:	75 30                	jne    801470 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	68 00 f0 bf ee       	push   $0xeebff000
+  801448:	e8 cd 26 00 00       	call   803b1a <mutex_unlock>
+}
+  80144d:	83 c4 10             	add    $0x10,%esp
+  801450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801457:	83 ec 08             	sub    $0x8,%esp
+  80145a:	ff 72 28             	push   0x28(%edx)
+  80145d:	51                   	push   %ecx
+  80145e:	50                   	push   %eax
+  80145f:	68 bc 4d 80 00       	push   $0x804dbc
+  801464:	6a 3f                	push   $0x3f
+  801466:	68 96 4e 80 00       	push   $0x804e96
+  80146b:	e8 6a ee ff ff       	call   8002da <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801470:	89 d8                	mov    %ebx,%eax
+  801472:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801477:	e8 b9 fe ff ff       	call   801335 <cow_copy>
+  80147c:	eb c2                	jmp    801440 <pgfault+0x4a>
+
+0080147e <cow_enable>:
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801484:	68 f6 13 80 00       	push   $0x8013f6
+  801489:	e8 9f 2f 00 00       	call   80442d <set_pgfault_handler>
+}
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+
+00801493 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	57                   	push   %edi
+  801497:	56                   	push   %esi
+  801498:	53                   	push   %ebx
+  801499:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80149c:	68 f6 13 80 00       	push   $0x8013f6
+  8014a1:	e8 87 2f 00 00       	call   80442d <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8014a6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014ab:	cd 30                	int    $0x30
+  8014ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	78 4b                	js     801502 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8014b7:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8014bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8014c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8014c8:	0f 85 16 01 00 00    	jne    8015e4 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014ce:	e8 ac f8 ff ff       	call   800d7f <sys_getenvid>
+  8014d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014d8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014da:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8014e0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8014e6:	77 32                	ja     80151a <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014e8:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8014ed:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8014ef:	c1 ea 10             	shr    $0x10,%edx
+  8014f2:	74 26                	je     80151a <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014f4:	c1 e2 10             	shl    $0x10,%edx
+  8014f7:	89 d1                	mov    %edx,%ecx
+  8014f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014fe:	29 ca                	sub    %ecx,%edx
+  801500:	eb 1e                	jmp    801520 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801502:	83 ec 08             	sub    $0x8,%esp
+  801505:	89 c7                	mov    %eax,%edi
+  801507:	50                   	push   %eax
+  801508:	68 a1 4e 80 00       	push   $0x804ea1
+  80150d:	e8 a3 ee ff ff       	call   8003b5 <cprintf>
+		return eid;
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	e9 6c 01 00 00       	jmp    801686 <fork+0x1f3>
+		return pthread_main_tls;
+  80151a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801520:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801523:	c1 e0 04             	shl    $0x4,%eax
+  801526:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80152b:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80152d:	e8 c4 2c 00 00       	call   8041f6 <pthread_fork_child>
+		return eid;
+  801532:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801535:	e9 4c 01 00 00       	jmp    801686 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80153a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801540:	89 da                	mov    %ebx,%edx
+  801542:	89 f8                	mov    %edi,%eax
+  801544:	e8 af fd ff ff       	call   8012f8 <duppage>
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	79 28                	jns    801575 <fork+0xe2>
+  80154d:	89 c7                	mov    %eax,%edi
+  80154f:	e9 32 01 00 00       	jmp    801686 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801554:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80155a:	83 f9 05             	cmp    $0x5,%ecx
+  80155d:	75 58                	jne    8015b7 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80155f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801564:	89 da                	mov    %ebx,%edx
+  801566:	89 f8                	mov    %edi,%eax
+  801568:	e8 8b fd ff ff       	call   8012f8 <duppage>
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	0f 88 0f 01 00 00    	js     801684 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801575:	83 c3 01             	add    $0x1,%ebx
+  801578:	39 de                	cmp    %ebx,%esi
+  80157a:	74 54                	je     8015d0 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80157c:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801583:	f6 c1 05             	test   $0x5,%cl
+  801586:	74 ed                	je     801575 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801588:	f6 c5 04             	test   $0x4,%ch
+  80158b:	75 ad                	jne    80153a <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80158d:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801593:	74 bf                	je     801554 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801595:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80159b:	74 d8                	je     801575 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80159d:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8015a3:	89 da                	mov    %ebx,%edx
+  8015a5:	89 f8                	mov    %edi,%eax
+  8015a7:	e8 cd fc ff ff       	call   801279 <duppage_cow>
+  8015ac:	85 c0                	test   %eax,%eax
+  8015ae:	79 c5                	jns    801575 <fork+0xe2>
+  8015b0:	89 c7                	mov    %eax,%edi
+  8015b2:	e9 cf 00 00 00       	jmp    801686 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8015b7:	68 ec 4d 80 00       	push   $0x804dec
+  8015bc:	68 b1 4e 80 00       	push   $0x804eb1
+  8015c1:	68 c6 00 00 00       	push   $0xc6
+  8015c6:	68 96 4e 80 00       	push   $0x804e96
+  8015cb:	e8 0a ed ff ff       	call   8002da <_panic>
+  8015d0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8015d3:	83 c1 01             	add    $0x1,%ecx
+  8015d6:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8015dc:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8015e2:	74 18                	je     8015fc <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8015e4:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8015eb:	a8 07                	test   $0x7,%al
+  8015ed:	74 e4                	je     8015d3 <fork+0x140>
+  8015ef:	89 cb                	mov    %ecx,%ebx
+  8015f1:	c1 e3 0a             	shl    $0xa,%ebx
+  8015f4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015f7:	e9 7c ff ff ff       	jmp    801578 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8015fc:	83 ec 04             	sub    $0x4,%esp
+  8015ff:	6a 07                	push   $0x7
+  801601:	68 00 f0 bf ee       	push   $0xeebff000
+  801606:	ff 75 e4             	push   -0x1c(%ebp)
+  801609:	e8 c9 f7 ff ff       	call   800dd7 <sys_page_alloc>
+  80160e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	85 c0                	test   %eax,%eax
+  801615:	78 34                	js     80164b <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801617:	83 ec 08             	sub    $0x8,%esp
+  80161a:	68 6b 44 80 00       	push   $0x80446b
+  80161f:	ff 75 e4             	push   -0x1c(%ebp)
+  801622:	e8 2d f9 ff ff       	call   800f54 <sys_env_set_pgfault_upcall>
+  801627:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	78 2e                	js     80165e <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801630:	83 ec 08             	sub    $0x8,%esp
+  801633:	6a 02                	push   $0x2
+  801635:	ff 75 e4             	push   -0x1c(%ebp)
+  801638:	e8 7f f8 ff ff       	call   800ebc <sys_env_set_status>
+  80163d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 2b                	js     801671 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801646:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801649:	eb 3b                	jmp    801686 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80164b:	83 ec 08             	sub    $0x8,%esp
+  80164e:	50                   	push   %eax
+  80164f:	68 14 4e 80 00       	push   $0x804e14
+  801654:	e8 5c ed ff ff       	call   8003b5 <cprintf>
+		return r;
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	eb 28                	jmp    801686 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80165e:	83 ec 08             	sub    $0x8,%esp
+  801661:	50                   	push   %eax
+  801662:	68 3c 4e 80 00       	push   $0x804e3c
+  801667:	e8 49 ed ff ff       	call   8003b5 <cprintf>
+		return r;
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	eb 15                	jmp    801686 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801671:	83 ec 08             	sub    $0x8,%esp
+  801674:	50                   	push   %eax
+  801675:	68 c6 4e 80 00       	push   $0x804ec6
+  80167a:	e8 36 ed ff ff       	call   8003b5 <cprintf>
+		return r;
+  80167f:	83 c4 10             	add    $0x10,%esp
+  801682:	eb 02                	jmp    801686 <fork+0x1f3>
+  801684:	89 c7                	mov    %eax,%edi
+}
+  801686:	89 f8                	mov    %edi,%eax
+  801688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5f                   	pop    %edi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+
+00801690 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	57                   	push   %edi
+  801694:	56                   	push   %esi
+  801695:	53                   	push   %ebx
+  801696:	83 ec 2c             	sub    $0x2c,%esp
+  801699:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80169b:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8016a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016a6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8016ac:	77 0a                	ja     8016b8 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016ae:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8016b3:	29 c3                	sub    %eax,%ebx
+  8016b5:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	68 f6 13 80 00       	push   $0x8013f6
+  8016c0:	e8 68 2d 00 00       	call   80442d <set_pgfault_handler>
+  8016c5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016ca:	cd 30                	int    $0x30
+  8016cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8016cf:	83 c4 10             	add    $0x10,%esp
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 30                	js     801706 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8016d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8016da:	74 42                	je     80171e <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8016dc:	c1 e3 10             	shl    $0x10,%ebx
+  8016df:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8016e4:	29 d8                	sub    %ebx,%eax
+  8016e6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8016e9:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8016ee:	29 d8                	sub    %ebx,%eax
+  8016f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8016f3:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8016f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fd:	89 f7                	mov    %esi,%edi
+  8016ff:	89 d6                	mov    %edx,%esi
+  801701:	e9 2c 01 00 00       	jmp    801832 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801706:	83 ec 08             	sub    $0x8,%esp
+  801709:	89 c7                	mov    %eax,%edi
+  80170b:	50                   	push   %eax
+  80170c:	68 a1 4e 80 00       	push   $0x804ea1
+  801711:	e8 9f ec ff ff       	call   8003b5 <cprintf>
+		return eid;
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	e9 d5 00 00 00       	jmp    8017f3 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80171e:	e8 5c f6 ff ff       	call   800d7f <sys_getenvid>
+  801723:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801728:	89 c2                	mov    %eax,%edx
+  80172a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80172c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801732:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801737:	77 18                	ja     801751 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801739:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80173e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801740:	c1 e8 10             	shr    $0x10,%eax
+  801743:	74 0c                	je     801751 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801745:	c1 e0 10             	shl    $0x10,%eax
+  801748:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80174d:	29 c1                	sub    %eax,%ecx
+  80174f:	eb 06                	jmp    801757 <sfork+0xc7>
+		return pthread_main_tls;
+  801751:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  801757:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80175a:	c1 e0 04             	shl    $0x4,%eax
+  80175d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801762:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  801764:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801767:	e9 87 00 00 00       	jmp    8017f3 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80176c:	f6 c5 04             	test   $0x4,%ch
+  80176f:	74 6c                	je     8017dd <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801771:	89 ca                	mov    %ecx,%edx
+  801773:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801779:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80177f:	74 7c                	je     8017fd <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801781:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801787:	89 da                	mov    %ebx,%edx
+  801789:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80178c:	e8 67 fb ff ff       	call   8012f8 <duppage>
+  801791:	85 c0                	test   %eax,%eax
+  801793:	0f 88 4f 01 00 00    	js     8018e8 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801799:	83 c3 01             	add    $0x1,%ebx
+  80179c:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80179f:	74 7a                	je     80181b <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8017a1:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8017a3:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8017aa:	f6 c1 01             	test   $0x1,%cl
+  8017ad:	74 ea                	je     801799 <sfork+0x109>
+  8017af:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8017b5:	74 e2                	je     801799 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8017b7:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8017bd:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8017c0:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8017c5:	76 a5                	jbe    80176c <sfork+0xdc>
+  8017c7:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8017cd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8017d0:	39 fa                	cmp    %edi,%edx
+  8017d2:	73 9d                	jae    801771 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8017d4:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8017d7:	39 fa                	cmp    %edi,%edx
+  8017d9:	72 96                	jb     801771 <sfork+0xe1>
+  8017db:	eb 8f                	jmp    80176c <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8017dd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8017e3:	89 da                	mov    %ebx,%edx
+  8017e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017e8:	e8 8c fa ff ff       	call   801279 <duppage_cow>
+  8017ed:	85 c0                	test   %eax,%eax
+  8017ef:	79 a8                	jns    801799 <sfork+0x109>
+  8017f1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8017f3:	89 f8                	mov    %edi,%eax
+  8017f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f8:	5b                   	pop    %ebx
+  8017f9:	5e                   	pop    %esi
+  8017fa:	5f                   	pop    %edi
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8017fd:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801802:	e8 2e fb ff ff       	call   801335 <cow_copy>
+  801807:	85 c0                	test   %eax,%eax
+  801809:	0f 88 d2 00 00 00    	js     8018e1 <sfork+0x251>
+				pte = uvpt[pn];
+  80180f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801816:	e9 66 ff ff ff       	jmp    801781 <sfork+0xf1>
+  80181b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80181e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801821:	83 c6 01             	add    $0x1,%esi
+  801824:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80182a:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801830:	74 1b                	je     80184d <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801832:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801839:	a8 01                	test   $0x1,%al
+  80183b:	74 e4                	je     801821 <sfork+0x191>
+  80183d:	89 f3                	mov    %esi,%ebx
+  80183f:	c1 e3 0a             	shl    $0xa,%ebx
+  801842:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801845:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801848:	e9 4f ff ff ff       	jmp    80179c <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80184d:	83 ec 04             	sub    $0x4,%esp
+  801850:	6a 07                	push   $0x7
+  801852:	68 00 f0 bf ee       	push   $0xeebff000
+  801857:	ff 75 e0             	push   -0x20(%ebp)
+  80185a:	e8 78 f5 ff ff       	call   800dd7 <sys_page_alloc>
+  80185f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	78 37                	js     80189f <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	68 6b 44 80 00       	push   $0x80446b
+  801870:	ff 75 e0             	push   -0x20(%ebp)
+  801873:	e8 dc f6 ff ff       	call   800f54 <sys_env_set_pgfault_upcall>
+  801878:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	78 34                	js     8018b5 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801881:	83 ec 08             	sub    $0x8,%esp
+  801884:	6a 02                	push   $0x2
+  801886:	ff 75 e0             	push   -0x20(%ebp)
+  801889:	e8 2e f6 ff ff       	call   800ebc <sys_env_set_status>
+  80188e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 34                	js     8018cb <sfork+0x23b>
+	return eid;
+  801897:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80189a:	e9 54 ff ff ff       	jmp    8017f3 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80189f:	83 ec 08             	sub    $0x8,%esp
+  8018a2:	50                   	push   %eax
+  8018a3:	68 14 4e 80 00       	push   $0x804e14
+  8018a8:	e8 08 eb ff ff       	call   8003b5 <cprintf>
+		return r;
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	e9 3e ff ff ff       	jmp    8017f3 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	50                   	push   %eax
+  8018b9:	68 3c 4e 80 00       	push   $0x804e3c
+  8018be:	e8 f2 ea ff ff       	call   8003b5 <cprintf>
+		return r;
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	e9 28 ff ff ff       	jmp    8017f3 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8018cb:	83 ec 08             	sub    $0x8,%esp
+  8018ce:	50                   	push   %eax
+  8018cf:	68 c6 4e 80 00       	push   $0x804ec6
+  8018d4:	e8 dc ea ff ff       	call   8003b5 <cprintf>
+		return r;
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	e9 12 ff ff ff       	jmp    8017f3 <sfork+0x163>
+  8018e1:	89 c7                	mov    %eax,%edi
+  8018e3:	e9 0b ff ff ff       	jmp    8017f3 <sfork+0x163>
+  8018e8:	89 c7                	mov    %eax,%edi
+  8018ea:	e9 04 ff ff ff       	jmp    8017f3 <sfork+0x163>
+
+008018ef <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018ef:	55                   	push   %ebp
+  8018f0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018fa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+
+008018ff <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801902:	8b 45 08             	mov    0x8(%ebp),%eax
+  801905:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80190a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80190f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801914:	5d                   	pop    %ebp
+  801915:	c3                   	ret
+
+00801916 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801916:	55                   	push   %ebp
+  801917:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801919:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80191e:	eb 02                	jmp    801922 <fd_alloc+0xc>
+  801920:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801922:	89 c2                	mov    %eax,%edx
+  801924:	c1 ea 16             	shr    $0x16,%edx
+  801927:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80192e:	f6 c2 01             	test   $0x1,%dl
+  801931:	74 2b                	je     80195e <fd_alloc+0x48>
+  801933:	89 c2                	mov    %eax,%edx
+  801935:	c1 ea 0c             	shr    $0xc,%edx
+  801938:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80193f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801945:	f6 c1 01             	test   $0x1,%cl
+  801948:	74 14                	je     80195e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80194a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801950:	75 ce                	jne    801920 <fd_alloc+0xa>
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801957:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80195c:	eb 05                	jmp    801963 <fd_alloc+0x4d>
+			return 0;
+  80195e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801963:	8b 55 08             	mov    0x8(%ebp),%edx
+  801966:	89 02                	mov    %eax,(%edx)
+}
+  801968:	89 c8                	mov    %ecx,%eax
+  80196a:	5d                   	pop    %ebp
+  80196b:	c3                   	ret
+
+0080196c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80196c:	55                   	push   %ebp
+  80196d:	89 e5                	mov    %esp,%ebp
+  80196f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801972:	83 f8 1f             	cmp    $0x1f,%eax
+  801975:	77 30                	ja     8019a7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801977:	c1 e0 0c             	shl    $0xc,%eax
+  80197a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80197f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801985:	f6 c2 01             	test   $0x1,%dl
+  801988:	74 24                	je     8019ae <fd_lookup+0x42>
+  80198a:	89 c2                	mov    %eax,%edx
+  80198c:	c1 ea 0c             	shr    $0xc,%edx
+  80198f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801996:	f6 c2 01             	test   $0x1,%dl
+  801999:	74 1a                	je     8019b5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80199b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80199e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a5:	5d                   	pop    %ebp
+  8019a6:	c3                   	ret
+		return -E_INVAL;
+  8019a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ac:	eb f7                	jmp    8019a5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8019ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b3:	eb f0                	jmp    8019a5 <fd_lookup+0x39>
+  8019b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ba:	eb e9                	jmp    8019a5 <fd_lookup+0x39>
+
+008019bc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	53                   	push   %ebx
+  8019c0:	83 ec 04             	sub    $0x4,%esp
+  8019c3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cb:	eb 03                	jmp    8019d0 <dev_lookup+0x14>
+  8019cd:	83 c0 01             	add    $0x1,%eax
+  8019d0:	8b 1c 85 60 4f 80 00 	mov    0x804f60(,%eax,4),%ebx
+  8019d7:	85 db                	test   %ebx,%ebx
+  8019d9:	74 0b                	je     8019e6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8019db:	39 13                	cmp    %edx,(%ebx)
+  8019dd:	75 ee                	jne    8019cd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	eb 49                	jmp    801a2f <dev_lookup+0x73>
+  8019e6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8019e8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8019ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8019f3:	77 18                	ja     801a0d <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8019f5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8019fa:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8019fc:	c1 e8 10             	shr    $0x10,%eax
+  8019ff:	74 0c                	je     801a0d <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a01:	c1 e0 10             	shl    $0x10,%eax
+  801a04:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801a09:	29 c1                	sub    %eax,%ecx
+  801a0b:	eb 06                	jmp    801a13 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801a0d:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a13:	8b 01                	mov    (%ecx),%eax
+  801a15:	8b 40 48             	mov    0x48(%eax),%eax
+  801a18:	83 ec 04             	sub    $0x4,%esp
+  801a1b:	52                   	push   %edx
+  801a1c:	50                   	push   %eax
+  801a1d:	68 e4 4e 80 00       	push   $0x804ee4
+  801a22:	e8 8e e9 ff ff       	call   8003b5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a27:	83 c4 10             	add    $0x10,%esp
+  801a2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a32:	89 1a                	mov    %ebx,(%edx)
+}
+  801a34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a37:	c9                   	leave
+  801a38:	c3                   	ret
+
+00801a39 <fd_close>:
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	57                   	push   %edi
+  801a3d:	56                   	push   %esi
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 24             	sub    $0x24,%esp
+  801a42:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a48:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a4b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a4c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a52:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a55:	50                   	push   %eax
+  801a56:	e8 11 ff ff ff       	call   80196c <fd_lookup>
+  801a5b:	89 c3                	mov    %eax,%ebx
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	78 05                	js     801a69 <fd_close+0x30>
+	    || fd != fd2)
+  801a64:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a67:	74 16                	je     801a7f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a69:	89 f8                	mov    %edi,%eax
+  801a6b:	84 c0                	test   %al,%al
+  801a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a72:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a75:	89 d8                	mov    %ebx,%eax
+  801a77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7a:	5b                   	pop    %ebx
+  801a7b:	5e                   	pop    %esi
+  801a7c:	5f                   	pop    %edi
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a7f:	83 ec 08             	sub    $0x8,%esp
+  801a82:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a85:	50                   	push   %eax
+  801a86:	ff 36                	push   (%esi)
+  801a88:	e8 2f ff ff ff       	call   8019bc <dev_lookup>
+  801a8d:	89 c3                	mov    %eax,%ebx
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 1a                	js     801ab0 <fd_close+0x77>
+		if (dev->dev_close)
+  801a96:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a99:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	74 0b                	je     801ab0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801aa5:	83 ec 0c             	sub    $0xc,%esp
+  801aa8:	56                   	push   %esi
+  801aa9:	ff d0                	call   *%eax
+  801aab:	89 c3                	mov    %eax,%ebx
+  801aad:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ab0:	83 ec 08             	sub    $0x8,%esp
+  801ab3:	56                   	push   %esi
+  801ab4:	6a 00                	push   $0x0
+  801ab6:	e8 b5 f3 ff ff       	call   800e70 <sys_page_unmap>
+	return r;
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	eb b5                	jmp    801a75 <fd_close+0x3c>
+
+00801ac0 <close>:
+
+int
+close(int fdnum)
+{
+  801ac0:	55                   	push   %ebp
+  801ac1:	89 e5                	mov    %esp,%ebp
+  801ac3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ac6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac9:	50                   	push   %eax
+  801aca:	ff 75 08             	push   0x8(%ebp)
+  801acd:	e8 9a fe ff ff       	call   80196c <fd_lookup>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	79 02                	jns    801adb <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ad9:	c9                   	leave
+  801ada:	c3                   	ret
+		return fd_close(fd, 1);
+  801adb:	83 ec 08             	sub    $0x8,%esp
+  801ade:	6a 01                	push   $0x1
+  801ae0:	ff 75 f4             	push   -0xc(%ebp)
+  801ae3:	e8 51 ff ff ff       	call   801a39 <fd_close>
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	eb ec                	jmp    801ad9 <close+0x19>
+
+00801aed <close_all>:
+
+void
+close_all(void)
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	53                   	push   %ebx
+  801af1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801af9:	83 ec 0c             	sub    $0xc,%esp
+  801afc:	53                   	push   %ebx
+  801afd:	e8 be ff ff ff       	call   801ac0 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b02:	83 c3 01             	add    $0x1,%ebx
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	83 fb 20             	cmp    $0x20,%ebx
+  801b0b:	75 ec                	jne    801af9 <close_all+0xc>
+}
+  801b0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+
+00801b12 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	57                   	push   %edi
+  801b16:	56                   	push   %esi
+  801b17:	53                   	push   %ebx
+  801b18:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	ff 75 08             	push   0x8(%ebp)
+  801b22:	e8 45 fe ff ff       	call   80196c <fd_lookup>
+  801b27:	89 c3                	mov    %eax,%ebx
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	78 7f                	js     801baf <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b30:	83 ec 0c             	sub    $0xc,%esp
+  801b33:	ff 75 0c             	push   0xc(%ebp)
+  801b36:	e8 85 ff ff ff       	call   801ac0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b3e:	c1 e6 0c             	shl    $0xc,%esi
+  801b41:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b47:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b4a:	89 3c 24             	mov    %edi,(%esp)
+  801b4d:	e8 ad fd ff ff       	call   8018ff <fd2data>
+  801b52:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b54:	89 34 24             	mov    %esi,(%esp)
+  801b57:	e8 a3 fd ff ff       	call   8018ff <fd2data>
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b62:	89 d8                	mov    %ebx,%eax
+  801b64:	c1 e8 16             	shr    $0x16,%eax
+  801b67:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b6e:	a8 01                	test   $0x1,%al
+  801b70:	74 11                	je     801b83 <dup+0x71>
+  801b72:	89 d8                	mov    %ebx,%eax
+  801b74:	c1 e8 0c             	shr    $0xc,%eax
+  801b77:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b7e:	f6 c2 01             	test   $0x1,%dl
+  801b81:	75 36                	jne    801bb9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b83:	89 f8                	mov    %edi,%eax
+  801b85:	c1 e8 0c             	shr    $0xc,%eax
+  801b88:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b8f:	83 ec 0c             	sub    $0xc,%esp
+  801b92:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b97:	50                   	push   %eax
+  801b98:	56                   	push   %esi
+  801b99:	6a 00                	push   $0x0
+  801b9b:	57                   	push   %edi
+  801b9c:	6a 00                	push   $0x0
+  801b9e:	e8 81 f2 ff ff       	call   800e24 <sys_page_map>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 20             	add    $0x20,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 33                	js     801bdf <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801baf:	89 d8                	mov    %ebx,%eax
+  801bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5f                   	pop    %edi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bb9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bc0:	83 ec 0c             	sub    $0xc,%esp
+  801bc3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bc8:	50                   	push   %eax
+  801bc9:	ff 75 d4             	push   -0x2c(%ebp)
+  801bcc:	6a 00                	push   $0x0
+  801bce:	53                   	push   %ebx
+  801bcf:	6a 00                	push   $0x0
+  801bd1:	e8 4e f2 ff ff       	call   800e24 <sys_page_map>
+  801bd6:	89 c3                	mov    %eax,%ebx
+  801bd8:	83 c4 20             	add    $0x20,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	79 a4                	jns    801b83 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bdf:	83 ec 08             	sub    $0x8,%esp
+  801be2:	56                   	push   %esi
+  801be3:	6a 00                	push   $0x0
+  801be5:	e8 86 f2 ff ff       	call   800e70 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bea:	83 c4 08             	add    $0x8,%esp
+  801bed:	ff 75 d4             	push   -0x2c(%ebp)
+  801bf0:	6a 00                	push   $0x0
+  801bf2:	e8 79 f2 ff ff       	call   800e70 <sys_page_unmap>
+	return r;
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	eb b3                	jmp    801baf <dup+0x9d>
+
+00801bfc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	56                   	push   %esi
+  801c00:	53                   	push   %ebx
+  801c01:	83 ec 18             	sub    $0x18,%esp
+  801c04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c0a:	50                   	push   %eax
+  801c0b:	53                   	push   %ebx
+  801c0c:	e8 5b fd ff ff       	call   80196c <fd_lookup>
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 3c                	js     801c54 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c18:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c1b:	83 ec 08             	sub    $0x8,%esp
+  801c1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c21:	50                   	push   %eax
+  801c22:	ff 36                	push   (%esi)
+  801c24:	e8 93 fd ff ff       	call   8019bc <dev_lookup>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	78 24                	js     801c54 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c30:	8b 46 08             	mov    0x8(%esi),%eax
+  801c33:	83 e0 03             	and    $0x3,%eax
+  801c36:	83 f8 01             	cmp    $0x1,%eax
+  801c39:	74 20                	je     801c5b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3e:	8b 40 08             	mov    0x8(%eax),%eax
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	74 61                	je     801ca6 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c45:	83 ec 04             	sub    $0x4,%esp
+  801c48:	ff 75 10             	push   0x10(%ebp)
+  801c4b:	ff 75 0c             	push   0xc(%ebp)
+  801c4e:	56                   	push   %esi
+  801c4f:	ff d0                	call   *%eax
+  801c51:	83 c4 10             	add    $0x10,%esp
+}
+  801c54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c57:	5b                   	pop    %ebx
+  801c58:	5e                   	pop    %esi
+  801c59:	5d                   	pop    %ebp
+  801c5a:	c3                   	ret
+  801c5b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c5d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c63:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c68:	77 18                	ja     801c82 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c6a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c6f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c71:	c1 e8 10             	shr    $0x10,%eax
+  801c74:	74 0c                	je     801c82 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c76:	c1 e0 10             	shl    $0x10,%eax
+  801c79:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c7e:	29 c2                	sub    %eax,%edx
+  801c80:	eb 06                	jmp    801c88 <read+0x8c>
+		return pthread_main_tls;
+  801c82:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c88:	8b 02                	mov    (%edx),%eax
+  801c8a:	8b 40 48             	mov    0x48(%eax),%eax
+  801c8d:	83 ec 04             	sub    $0x4,%esp
+  801c90:	53                   	push   %ebx
+  801c91:	50                   	push   %eax
+  801c92:	68 25 4f 80 00       	push   $0x804f25
+  801c97:	e8 19 e7 ff ff       	call   8003b5 <cprintf>
+		return -E_INVAL;
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca4:	eb ae                	jmp    801c54 <read+0x58>
+		return -E_NOT_SUPP;
+  801ca6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cab:	eb a7                	jmp    801c54 <read+0x58>
+
+00801cad <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	57                   	push   %edi
+  801cb1:	56                   	push   %esi
+  801cb2:	53                   	push   %ebx
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801cb9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc1:	eb 02                	jmp    801cc5 <readn+0x18>
+  801cc3:	01 c3                	add    %eax,%ebx
+  801cc5:	39 f3                	cmp    %esi,%ebx
+  801cc7:	73 21                	jae    801cea <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	89 f0                	mov    %esi,%eax
+  801cce:	29 d8                	sub    %ebx,%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	89 d8                	mov    %ebx,%eax
+  801cd3:	03 45 0c             	add    0xc(%ebp),%eax
+  801cd6:	50                   	push   %eax
+  801cd7:	57                   	push   %edi
+  801cd8:	e8 1f ff ff ff       	call   801bfc <read>
+		if (m < 0)
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	78 04                	js     801ce8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801ce4:	75 dd                	jne    801cc3 <readn+0x16>
+  801ce6:	eb 02                	jmp    801cea <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ce8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cea:	89 d8                	mov    %ebx,%eax
+  801cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cef:	5b                   	pop    %ebx
+  801cf0:	5e                   	pop    %esi
+  801cf1:	5f                   	pop    %edi
+  801cf2:	5d                   	pop    %ebp
+  801cf3:	c3                   	ret
+
+00801cf4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	56                   	push   %esi
+  801cf8:	53                   	push   %ebx
+  801cf9:	83 ec 18             	sub    $0x18,%esp
+  801cfc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d02:	50                   	push   %eax
+  801d03:	53                   	push   %ebx
+  801d04:	e8 63 fc ff ff       	call   80196c <fd_lookup>
+  801d09:	83 c4 10             	add    $0x10,%esp
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 37                	js     801d47 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d10:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d13:	83 ec 08             	sub    $0x8,%esp
+  801d16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d19:	50                   	push   %eax
+  801d1a:	ff 36                	push   (%esi)
+  801d1c:	e8 9b fc ff ff       	call   8019bc <dev_lookup>
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	85 c0                	test   %eax,%eax
+  801d26:	78 1f                	js     801d47 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d28:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d2c:	74 20                	je     801d4e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d31:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	74 61                	je     801d99 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d38:	83 ec 04             	sub    $0x4,%esp
+  801d3b:	ff 75 10             	push   0x10(%ebp)
+  801d3e:	ff 75 0c             	push   0xc(%ebp)
+  801d41:	56                   	push   %esi
+  801d42:	ff d0                	call   *%eax
+  801d44:	83 c4 10             	add    $0x10,%esp
+}
+  801d47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4a:	5b                   	pop    %ebx
+  801d4b:	5e                   	pop    %esi
+  801d4c:	5d                   	pop    %ebp
+  801d4d:	c3                   	ret
+  801d4e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d50:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d56:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d5b:	77 18                	ja     801d75 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d5d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d62:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d64:	c1 e8 10             	shr    $0x10,%eax
+  801d67:	74 0c                	je     801d75 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d69:	c1 e0 10             	shl    $0x10,%eax
+  801d6c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d71:	29 c2                	sub    %eax,%edx
+  801d73:	eb 06                	jmp    801d7b <write+0x87>
+		return pthread_main_tls;
+  801d75:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d7b:	8b 02                	mov    (%edx),%eax
+  801d7d:	8b 40 48             	mov    0x48(%eax),%eax
+  801d80:	83 ec 04             	sub    $0x4,%esp
+  801d83:	53                   	push   %ebx
+  801d84:	50                   	push   %eax
+  801d85:	68 41 4f 80 00       	push   $0x804f41
+  801d8a:	e8 26 e6 ff ff       	call   8003b5 <cprintf>
+		return -E_INVAL;
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d97:	eb ae                	jmp    801d47 <write+0x53>
+		return -E_NOT_SUPP;
+  801d99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d9e:	eb a7                	jmp    801d47 <write+0x53>
+
+00801da0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801da0:	55                   	push   %ebp
+  801da1:	89 e5                	mov    %esp,%ebp
+  801da3:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801da6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	ff 75 08             	push   0x8(%ebp)
+  801dad:	e8 ba fb ff ff       	call   80196c <fd_lookup>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 0e                	js     801dc7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801db9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dbf:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc7:	c9                   	leave
+  801dc8:	c3                   	ret
+
+00801dc9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	83 ec 18             	sub    $0x18,%esp
+  801dd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dd4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dd7:	50                   	push   %eax
+  801dd8:	53                   	push   %ebx
+  801dd9:	e8 8e fb ff ff       	call   80196c <fd_lookup>
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 34                	js     801e19 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801de5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801de8:	83 ec 08             	sub    $0x8,%esp
+  801deb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dee:	50                   	push   %eax
+  801def:	ff 36                	push   (%esi)
+  801df1:	e8 c6 fb ff ff       	call   8019bc <dev_lookup>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 1c                	js     801e19 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dfd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e01:	74 1d                	je     801e20 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e06:	8b 40 18             	mov    0x18(%eax),%eax
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	74 5e                	je     801e6b <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e0d:	83 ec 08             	sub    $0x8,%esp
+  801e10:	ff 75 0c             	push   0xc(%ebp)
+  801e13:	56                   	push   %esi
+  801e14:	ff d0                	call   *%eax
+  801e16:	83 c4 10             	add    $0x10,%esp
+}
+  801e19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1c:	5b                   	pop    %ebx
+  801e1d:	5e                   	pop    %esi
+  801e1e:	5d                   	pop    %ebp
+  801e1f:	c3                   	ret
+  801e20:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e22:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e28:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e2d:	77 18                	ja     801e47 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e2f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e34:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e36:	c1 e8 10             	shr    $0x10,%eax
+  801e39:	74 0c                	je     801e47 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e3b:	c1 e0 10             	shl    $0x10,%eax
+  801e3e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e43:	29 c2                	sub    %eax,%edx
+  801e45:	eb 06                	jmp    801e4d <ftruncate+0x84>
+		return pthread_main_tls;
+  801e47:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801e4d:	8b 02                	mov    (%edx),%eax
+  801e4f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e52:	83 ec 04             	sub    $0x4,%esp
+  801e55:	53                   	push   %ebx
+  801e56:	50                   	push   %eax
+  801e57:	68 04 4f 80 00       	push   $0x804f04
+  801e5c:	e8 54 e5 ff ff       	call   8003b5 <cprintf>
+		return -E_INVAL;
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e69:	eb ae                	jmp    801e19 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e70:	eb a7                	jmp    801e19 <ftruncate+0x50>
+
+00801e72 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	56                   	push   %esi
+  801e76:	53                   	push   %ebx
+  801e77:	83 ec 18             	sub    $0x18,%esp
+  801e7a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e7d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e80:	50                   	push   %eax
+  801e81:	ff 75 08             	push   0x8(%ebp)
+  801e84:	e8 e3 fa ff ff       	call   80196c <fd_lookup>
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	78 49                	js     801ed9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e90:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e93:	83 ec 08             	sub    $0x8,%esp
+  801e96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e99:	50                   	push   %eax
+  801e9a:	ff 36                	push   (%esi)
+  801e9c:	e8 1b fb ff ff       	call   8019bc <dev_lookup>
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	78 31                	js     801ed9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eab:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801eaf:	74 2f                	je     801ee0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801eb1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801eb4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ebb:	00 00 00 
+	stat->st_isdir = 0;
+  801ebe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ec5:	00 00 00 
+	stat->st_dev = dev;
+  801ec8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ece:	83 ec 08             	sub    $0x8,%esp
+  801ed1:	53                   	push   %ebx
+  801ed2:	56                   	push   %esi
+  801ed3:	ff 50 14             	call   *0x14(%eax)
+  801ed6:	83 c4 10             	add    $0x10,%esp
+}
+  801ed9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edc:	5b                   	pop    %ebx
+  801edd:	5e                   	pop    %esi
+  801ede:	5d                   	pop    %ebp
+  801edf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ee0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee5:	eb f2                	jmp    801ed9 <fstat+0x67>
+
+00801ee7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	56                   	push   %esi
+  801eeb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801eec:	83 ec 08             	sub    $0x8,%esp
+  801eef:	6a 00                	push   $0x0
+  801ef1:	ff 75 08             	push   0x8(%ebp)
+  801ef4:	e8 4b 03 00 00       	call   802244 <open>
+  801ef9:	89 c3                	mov    %eax,%ebx
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 1b                	js     801f1d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f02:	83 ec 08             	sub    $0x8,%esp
+  801f05:	ff 75 0c             	push   0xc(%ebp)
+  801f08:	50                   	push   %eax
+  801f09:	e8 64 ff ff ff       	call   801e72 <fstat>
+  801f0e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f10:	89 1c 24             	mov    %ebx,(%esp)
+  801f13:	e8 a8 fb ff ff       	call   801ac0 <close>
+	return r;
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	89 f3                	mov    %esi,%ebx
+}
+  801f1d:	89 d8                	mov    %ebx,%eax
+  801f1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f22:	5b                   	pop    %ebx
+  801f23:	5e                   	pop    %esi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+
+00801f26 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f26:	55                   	push   %ebp
+  801f27:	89 e5                	mov    %esp,%ebp
+  801f29:	56                   	push   %esi
+  801f2a:	53                   	push   %ebx
+  801f2b:	89 c6                	mov    %eax,%esi
+  801f2d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f2f:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801f36:	74 27                	je     801f5f <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f38:	6a 07                	push   $0x7
+  801f3a:	68 00 80 80 00       	push   $0x808000
+  801f3f:	56                   	push   %esi
+  801f40:	ff 35 00 70 80 00    	push   0x807000
+  801f46:	e8 3c 26 00 00       	call   804587 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f4b:	83 c4 0c             	add    $0xc,%esp
+  801f4e:	6a 00                	push   $0x0
+  801f50:	53                   	push   %ebx
+  801f51:	6a 00                	push   $0x0
+  801f53:	e8 39 25 00 00       	call   804491 <ipc_recv>
+}
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f5f:	83 ec 0c             	sub    $0xc,%esp
+  801f62:	6a 01                	push   $0x1
+  801f64:	e8 74 26 00 00       	call   8045dd <ipc_find_env>
+  801f69:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	eb c5                	jmp    801f38 <fsipc+0x12>
+
+00801f73 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f73:	55                   	push   %ebp
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	53                   	push   %ebx
+  801f77:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f7a:	68 04 70 80 00       	push   $0x807004
+  801f7f:	e8 29 1b 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f87:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801f8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f92:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801f97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fa1:	e8 80 ff ff ff       	call   801f26 <fsipc>
+  801fa6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fa8:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801faf:	e8 66 1b 00 00       	call   803b1a <mutex_unlock>
+	return r;
+}
+  801fb4:	89 d8                	mov    %ebx,%eax
+  801fb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+
+00801fbb <devfile_flush>:
+{
+  801fbb:	55                   	push   %ebp
+  801fbc:	89 e5                	mov    %esp,%ebp
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801fc2:	68 04 70 80 00       	push   $0x807004
+  801fc7:	e8 e1 1a 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fd2:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801fd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fe1:	e8 40 ff ff ff       	call   801f26 <fsipc>
+  801fe6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fe8:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801fef:	e8 26 1b 00 00       	call   803b1a <mutex_unlock>
+}
+  801ff4:	89 d8                	mov    %ebx,%eax
+  801ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+00801ffb <devfile_stat>:
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	56                   	push   %esi
+  801fff:	53                   	push   %ebx
+  802000:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802003:	83 ec 0c             	sub    $0xc,%esp
+  802006:	68 04 70 80 00       	push   $0x807004
+  80200b:	e8 9d 1a 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802010:	8b 45 08             	mov    0x8(%ebp),%eax
+  802013:	8b 40 0c             	mov    0xc(%eax),%eax
+  802016:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80201b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802020:	b8 05 00 00 00       	mov    $0x5,%eax
+  802025:	e8 fc fe ff ff       	call   801f26 <fsipc>
+  80202a:	89 c3                	mov    %eax,%ebx
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	79 16                	jns    802049 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802033:	83 ec 0c             	sub    $0xc,%esp
+  802036:	68 04 70 80 00       	push   $0x807004
+  80203b:	e8 da 1a 00 00       	call   803b1a <mutex_unlock>
+}
+  802040:	89 d8                	mov    %ebx,%eax
+  802042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802045:	5b                   	pop    %ebx
+  802046:	5e                   	pop    %esi
+  802047:	5d                   	pop    %ebp
+  802048:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802049:	83 ec 08             	sub    $0x8,%esp
+  80204c:	68 00 80 80 00       	push   $0x808000
+  802051:	56                   	push   %esi
+  802052:	e8 42 e9 ff ff       	call   800999 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802057:	a1 80 80 80 00       	mov    0x808080,%eax
+  80205c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802062:	a1 84 80 80 00       	mov    0x808084,%eax
+  802067:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80206d:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802075:	eb bc                	jmp    802033 <devfile_stat+0x38>
+
+00802077 <devfile_write>:
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	53                   	push   %ebx
+  80207b:	83 ec 10             	sub    $0x10,%esp
+  80207e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802081:	68 04 70 80 00       	push   $0x807004
+  802086:	e8 22 1a 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80208b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802091:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802096:	83 c4 10             	add    $0x10,%esp
+  802099:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80209f:	76 3d                	jbe    8020de <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8020a1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8020a6:	39 c3                	cmp    %eax,%ebx
+  8020a8:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8020ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ae:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8020b3:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8020b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020be:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020c3:	e8 5e fe ff ff       	call   801f26 <fsipc>
+  8020c8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020ca:	83 ec 0c             	sub    $0xc,%esp
+  8020cd:	68 04 70 80 00       	push   $0x807004
+  8020d2:	e8 43 1a 00 00       	call   803b1a <mutex_unlock>
+}
+  8020d7:	89 d8                	mov    %ebx,%eax
+  8020d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8020de:	83 ec 04             	sub    $0x4,%esp
+  8020e1:	53                   	push   %ebx
+  8020e2:	ff 75 0c             	push   0xc(%ebp)
+  8020e5:	68 0c 80 80 00       	push   $0x80800c
+  8020ea:	e8 30 ea ff ff       	call   800b1f <memmove>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f7:	eb b5                	jmp    8020ae <devfile_write+0x37>
+
+008020f9 <devfile_read>:
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	57                   	push   %edi
+  8020fd:	56                   	push   %esi
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	8b 75 08             	mov    0x8(%ebp),%esi
+  802105:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802108:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80210b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802111:	0f 86 8c 00 00 00    	jbe    8021a3 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802117:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80211c:	39 c3                	cmp    %eax,%ebx
+  80211e:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802121:	89 f8                	mov    %edi,%eax
+  802123:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802126:	eb 0f                	jmp    802137 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802128:	0f b6 08             	movzbl (%eax),%ecx
+  80212b:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80212d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802132:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802137:	39 d0                	cmp    %edx,%eax
+  802139:	72 ed                	jb     802128 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80213b:	83 ec 0c             	sub    $0xc,%esp
+  80213e:	68 04 70 80 00       	push   $0x807004
+  802143:	e8 65 19 00 00       	call   803aad <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802148:	8b 46 0c             	mov    0xc(%esi),%eax
+  80214b:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  802150:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802156:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  80215c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802161:	b8 03 00 00 00       	mov    $0x3,%eax
+  802166:	e8 bb fd ff ff       	call   801f26 <fsipc>
+  80216b:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80216d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802174:	e8 a1 19 00 00       	call   803b1a <mutex_unlock>
+		assert(r <= (int) n);
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	39 f3                	cmp    %esi,%ebx
+  80217e:	7c 0a                	jl     80218a <devfile_read+0x91>
+}
+  802180:	89 f0                	mov    %esi,%eax
+  802182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802185:	5b                   	pop    %ebx
+  802186:	5e                   	pop    %esi
+  802187:	5f                   	pop    %edi
+  802188:	5d                   	pop    %ebp
+  802189:	c3                   	ret
+		assert(r <= (int) n);
+  80218a:	68 74 4f 80 00       	push   $0x804f74
+  80218f:	68 b1 4e 80 00       	push   $0x804eb1
+  802194:	68 90 00 00 00       	push   $0x90
+  802199:	68 81 4f 80 00       	push   $0x804f81
+  80219e:	e8 37 e1 ff ff       	call   8002da <_panic>
+	mutex_lock(&fsipc_mu);
+  8021a3:	83 ec 0c             	sub    $0xc,%esp
+  8021a6:	68 04 70 80 00       	push   $0x807004
+  8021ab:	e8 fd 18 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021b0:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021b3:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8021b8:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8021be:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8021c5:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8021c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021d2:	e8 4f fd ff ff       	call   801f26 <fsipc>
+  8021d7:	89 c6                	mov    %eax,%esi
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	78 1d                	js     8021fd <devfile_read+0x104>
+		assert(r <= n);
+  8021e0:	39 c3                	cmp    %eax,%ebx
+  8021e2:	72 2e                	jb     802212 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8021e4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021e9:	7f 40                	jg     80222b <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021eb:	83 ec 04             	sub    $0x4,%esp
+  8021ee:	50                   	push   %eax
+  8021ef:	68 00 80 80 00       	push   $0x808000
+  8021f4:	57                   	push   %edi
+  8021f5:	e8 25 e9 ff ff       	call   800b1f <memmove>
+  8021fa:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8021fd:	83 ec 0c             	sub    $0xc,%esp
+  802200:	68 04 70 80 00       	push   $0x807004
+  802205:	e8 10 19 00 00       	call   803b1a <mutex_unlock>
+	return r;
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	e9 6e ff ff ff       	jmp    802180 <devfile_read+0x87>
+		assert(r <= n);
+  802212:	68 8c 4f 80 00       	push   $0x804f8c
+  802217:	68 b1 4e 80 00       	push   $0x804eb1
+  80221c:	68 99 00 00 00       	push   $0x99
+  802221:	68 81 4f 80 00       	push   $0x804f81
+  802226:	e8 af e0 ff ff       	call   8002da <_panic>
+		assert(r <= PGSIZE);
+  80222b:	68 93 4f 80 00       	push   $0x804f93
+  802230:	68 b1 4e 80 00       	push   $0x804eb1
+  802235:	68 9a 00 00 00       	push   $0x9a
+  80223a:	68 81 4f 80 00       	push   $0x804f81
+  80223f:	e8 96 e0 ff ff       	call   8002da <_panic>
+
+00802244 <open>:
+{
+  802244:	55                   	push   %ebp
+  802245:	89 e5                	mov    %esp,%ebp
+  802247:	56                   	push   %esi
+  802248:	53                   	push   %ebx
+  802249:	83 ec 1c             	sub    $0x1c,%esp
+  80224c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80224f:	56                   	push   %esi
+  802250:	e8 09 e7 ff ff       	call   80095e <strlen>
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80225d:	0f 8f 85 00 00 00    	jg     8022e8 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802263:	83 ec 0c             	sub    $0xc,%esp
+  802266:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802269:	50                   	push   %eax
+  80226a:	e8 a7 f6 ff ff       	call   801916 <fd_alloc>
+  80226f:	89 c3                	mov    %eax,%ebx
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	85 c0                	test   %eax,%eax
+  802276:	78 55                	js     8022cd <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802278:	83 ec 0c             	sub    $0xc,%esp
+  80227b:	68 04 70 80 00       	push   $0x807004
+  802280:	e8 28 18 00 00       	call   803aad <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802285:	83 c4 08             	add    $0x8,%esp
+  802288:	56                   	push   %esi
+  802289:	68 00 80 80 00       	push   $0x808000
+  80228e:	e8 06 e7 ff ff       	call   800999 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802293:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802296:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  80229b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80229e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a3:	e8 7e fc ff ff       	call   801f26 <fsipc>
+  8022a8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022aa:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022b1:	e8 64 18 00 00       	call   803b1a <mutex_unlock>
+	if (r < 0) {
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	85 db                	test   %ebx,%ebx
+  8022bb:	78 19                	js     8022d6 <open+0x92>
+	return fd2num(fd);
+  8022bd:	83 ec 0c             	sub    $0xc,%esp
+  8022c0:	ff 75 f4             	push   -0xc(%ebp)
+  8022c3:	e8 27 f6 ff ff       	call   8018ef <fd2num>
+  8022c8:	89 c3                	mov    %eax,%ebx
+  8022ca:	83 c4 10             	add    $0x10,%esp
+}
+  8022cd:	89 d8                	mov    %ebx,%eax
+  8022cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d2:	5b                   	pop    %ebx
+  8022d3:	5e                   	pop    %esi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+		fd_close(fd, 0);
+  8022d6:	83 ec 08             	sub    $0x8,%esp
+  8022d9:	6a 00                	push   $0x0
+  8022db:	ff 75 f4             	push   -0xc(%ebp)
+  8022de:	e8 56 f7 ff ff       	call   801a39 <fd_close>
+		return r;
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	eb e5                	jmp    8022cd <open+0x89>
+		return -E_BAD_PATH;
+  8022e8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022ed:	eb de                	jmp    8022cd <open+0x89>
+
+008022ef <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	53                   	push   %ebx
+  8022f3:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022f9:	50                   	push   %eax
+  8022fa:	ff 75 08             	push   0x8(%ebp)
+  8022fd:	e8 6a f6 ff ff       	call   80196c <fd_lookup>
+  802302:	89 c3                	mov    %eax,%ebx
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 5b                	js     802366 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80230b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80230e:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802314:	39 08                	cmp    %ecx,(%eax)
+  802316:	75 55                	jne    80236d <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802318:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80231c:	74 56                	je     802374 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80231e:	83 ec 0c             	sub    $0xc,%esp
+  802321:	68 04 70 80 00       	push   $0x807004
+  802326:	e8 82 17 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  80232b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80232e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802331:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802336:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802339:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80233e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802341:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802350:	e8 d1 fb ff ff       	call   801f26 <fsipc>
+  802355:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802357:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80235e:	e8 b7 17 00 00       	call   803b1a <mutex_unlock>
+	return r;
+  802363:	83 c4 10             	add    $0x10,%esp
+}
+  802366:	89 d8                	mov    %ebx,%eax
+  802368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80236d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802372:	eb f2                	jmp    802366 <fallocate+0x77>
+		return -E_INVAL;
+  802374:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802379:	eb eb                	jmp    802366 <fallocate+0x77>
+
+0080237b <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	56                   	push   %esi
+  80237f:	53                   	push   %ebx
+  802380:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802383:	89 f3                	mov    %esi,%ebx
+  802385:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80238b:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80238e:	eb 06                	jmp    802396 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802390:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802396:	39 f3                	cmp    %esi,%ebx
+  802398:	73 14                	jae    8023ae <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80239a:	83 ec 08             	sub    $0x8,%esp
+  80239d:	53                   	push   %ebx
+  80239e:	6a 00                	push   $0x0
+  8023a0:	e8 cb ea ff ff       	call   800e70 <sys_page_unmap>
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	79 e4                	jns    802390 <munmap+0x15>
+  8023ac:	eb 05                	jmp    8023b3 <munmap+0x38>
+			return r;
+	return 0;
+  8023ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b6:	5b                   	pop    %ebx
+  8023b7:	5e                   	pop    %esi
+  8023b8:	5d                   	pop    %ebp
+  8023b9:	c3                   	ret
+
+008023ba <mmap>:
+{
+  8023ba:	55                   	push   %ebp
+  8023bb:	89 e5                	mov    %esp,%ebp
+  8023bd:	57                   	push   %edi
+  8023be:	56                   	push   %esi
+  8023bf:	53                   	push   %ebx
+  8023c0:	83 ec 24             	sub    $0x24,%esp
+  8023c3:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8023c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023c9:	50                   	push   %eax
+  8023ca:	ff 75 08             	push   0x8(%ebp)
+  8023cd:	e8 9a f5 ff ff       	call   80196c <fd_lookup>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	0f 88 37 01 00 00    	js     802514 <mmap+0x15a>
+		return NULL;
+  8023dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8023e2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023e5:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8023eb:	39 0a                	cmp    %ecx,(%edx)
+  8023ed:	0f 85 05 01 00 00    	jne    8024f8 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8023f3:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8023fa:	0f 85 1b 01 00 00    	jne    80251b <mmap+0x161>
+  802400:	89 f0                	mov    %esi,%eax
+  802402:	83 e8 01             	sub    $0x1,%eax
+  802405:	0f 88 17 01 00 00    	js     802522 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80240b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80240f:	75 28                	jne    802439 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802411:	83 ec 0c             	sub    $0xc,%esp
+  802414:	68 04 70 80 00       	push   $0x807004
+  802419:	e8 8f 16 00 00       	call   803aad <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80241e:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802424:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802432:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802437:	eb 2b                	jmp    802464 <mmap+0xaa>
+		cow_enable();
+  802439:	e8 40 f0 ff ff       	call   80147e <cow_enable>
+  80243e:	eb d1                	jmp    802411 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802440:	89 c2                	mov    %eax,%edx
+  802442:	c1 ea 0c             	shr    $0xc,%edx
+  802445:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80244c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802452:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802458:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80245b:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80245d:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802462:	77 25                	ja     802489 <mmap+0xcf>
+  802464:	89 c2                	mov    %eax,%edx
+  802466:	29 da                	sub    %ebx,%edx
+  802468:	39 ca                	cmp    %ecx,%edx
+  80246a:	73 3a                	jae    8024a6 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80246c:	89 c2                	mov    %eax,%edx
+  80246e:	c1 ea 16             	shr    $0x16,%edx
+  802471:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802478:	f6 c2 01             	test   $0x1,%dl
+  80247b:	75 c3                	jne    802440 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80247d:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802482:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802487:	eb d4                	jmp    80245d <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802489:	29 d8                	sub    %ebx,%eax
+  80248b:	39 c8                	cmp    %ecx,%eax
+  80248d:	73 17                	jae    8024a6 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80248f:	83 ec 0c             	sub    $0xc,%esp
+  802492:	68 04 70 80 00       	push   $0x807004
+  802497:	e8 7e 16 00 00       	call   803b1a <mutex_unlock>
+		return NULL;
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a4:	eb 52                	jmp    8024f8 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8024a6:	85 db                	test   %ebx,%ebx
+  8024a8:	74 e5                	je     80248f <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024b0:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8024b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b8:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8024bd:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8024c3:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8024c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024cc:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8024d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024db:	e8 46 fa ff ff       	call   801f26 <fsipc>
+  8024e0:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8024e2:	83 ec 0c             	sub    $0xc,%esp
+  8024e5:	68 04 70 80 00       	push   $0x807004
+  8024ea:	e8 2b 16 00 00       	call   803b1a <mutex_unlock>
+	if (r < 0) {
+  8024ef:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8024f2:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8024f4:	85 ff                	test   %edi,%edi
+  8024f6:	78 08                	js     802500 <mmap+0x146>
+}
+  8024f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024fb:	5b                   	pop    %ebx
+  8024fc:	5e                   	pop    %esi
+  8024fd:	5f                   	pop    %edi
+  8024fe:	5d                   	pop    %ebp
+  8024ff:	c3                   	ret
+		munmap((void*) va, len);
+  802500:	83 ec 08             	sub    $0x8,%esp
+  802503:	56                   	push   %esi
+  802504:	53                   	push   %ebx
+  802505:	e8 71 fe ff ff       	call   80237b <munmap>
+		return NULL;
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802512:	eb e4                	jmp    8024f8 <mmap+0x13e>
+		return NULL;
+  802514:	b8 00 00 00 00       	mov    $0x0,%eax
+  802519:	eb dd                	jmp    8024f8 <mmap+0x13e>
+		return NULL;
+  80251b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802520:	eb d6                	jmp    8024f8 <mmap+0x13e>
+  802522:	b8 00 00 00 00       	mov    $0x0,%eax
+  802527:	eb cf                	jmp    8024f8 <mmap+0x13e>
+
+00802529 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802529:	55                   	push   %ebp
+  80252a:	89 e5                	mov    %esp,%ebp
+  80252c:	53                   	push   %ebx
+  80252d:	83 ec 10             	sub    $0x10,%esp
+  802530:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802533:	53                   	push   %ebx
+  802534:	e8 25 e4 ff ff       	call   80095e <strlen>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802541:	7f 42                	jg     802585 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802543:	83 ec 0c             	sub    $0xc,%esp
+  802546:	68 04 70 80 00       	push   $0x807004
+  80254b:	e8 5d 15 00 00       	call   803aad <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802550:	83 c4 08             	add    $0x8,%esp
+  802553:	53                   	push   %ebx
+  802554:	68 00 80 80 00       	push   $0x808000
+  802559:	e8 3b e4 ff ff       	call   800999 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80255e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802563:	b8 07 00 00 00       	mov    $0x7,%eax
+  802568:	e8 b9 f9 ff ff       	call   801f26 <fsipc>
+  80256d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80256f:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802576:	e8 9f 15 00 00       	call   803b1a <mutex_unlock>
+	return r;
+  80257b:	83 c4 10             	add    $0x10,%esp
+}
+  80257e:	89 d8                	mov    %ebx,%eax
+  802580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+		return -E_BAD_PATH;
+  802585:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80258a:	eb f2                	jmp    80257e <remove+0x55>
+
+0080258c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80258c:	55                   	push   %ebp
+  80258d:	89 e5                	mov    %esp,%ebp
+  80258f:	53                   	push   %ebx
+  802590:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802593:	68 04 70 80 00       	push   $0x807004
+  802598:	e8 10 15 00 00       	call   803aad <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  80259d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025a7:	e8 7a f9 ff ff       	call   801f26 <fsipc>
+  8025ac:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8025ae:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8025b5:	e8 60 15 00 00       	call   803b1a <mutex_unlock>
+	return r;
+}
+  8025ba:	89 d8                	mov    %ebx,%eax
+  8025bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025bf:	c9                   	leave
+  8025c0:	c3                   	ret
+
+008025c1 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8025c1:	55                   	push   %ebp
+  8025c2:	89 e5                	mov    %esp,%ebp
+  8025c4:	56                   	push   %esi
+  8025c5:	53                   	push   %ebx
+  8025c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8025c9:	83 ec 0c             	sub    $0xc,%esp
+  8025cc:	68 04 70 80 00       	push   $0x807004
+  8025d1:	e8 d7 14 00 00       	call   803aad <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8025d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d9:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8025de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025e8:	e8 39 f9 ff ff       	call   801f26 <fsipc>
+  8025ed:	89 c6                	mov    %eax,%esi
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 db                	test   %ebx,%ebx
+  8025f4:	74 7b                	je     802671 <fs_bcstat+0xb0>
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	78 77                	js     802671 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8025fa:	a1 00 80 80 00       	mov    0x808000,%eax
+  8025ff:	89 03                	mov    %eax,(%ebx)
+  802601:	a1 04 80 80 00       	mov    0x808004,%eax
+  802606:	89 43 04             	mov    %eax,0x4(%ebx)
+  802609:	a1 08 80 80 00       	mov    0x808008,%eax
+  80260e:	89 43 08             	mov    %eax,0x8(%ebx)
+  802611:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802616:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802619:	a1 10 80 80 00       	mov    0x808010,%eax
+  80261e:	89 43 10             	mov    %eax,0x10(%ebx)
+  802621:	a1 14 80 80 00       	mov    0x808014,%eax
+  802626:	89 43 14             	mov    %eax,0x14(%ebx)
+  802629:	a1 18 80 80 00       	mov    0x808018,%eax
+  80262e:	89 43 18             	mov    %eax,0x18(%ebx)
+  802631:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802636:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802639:	a1 20 80 80 00       	mov    0x808020,%eax
+  80263e:	89 43 20             	mov    %eax,0x20(%ebx)
+  802641:	a1 24 80 80 00       	mov    0x808024,%eax
+  802646:	89 43 24             	mov    %eax,0x24(%ebx)
+  802649:	a1 28 80 80 00       	mov    0x808028,%eax
+  80264e:	89 43 28             	mov    %eax,0x28(%ebx)
+  802651:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802656:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802659:	a1 30 80 80 00       	mov    0x808030,%eax
+  80265e:	89 43 30             	mov    %eax,0x30(%ebx)
+  802661:	a1 34 80 80 00       	mov    0x808034,%eax
+  802666:	89 43 34             	mov    %eax,0x34(%ebx)
+  802669:	a1 38 80 80 00       	mov    0x808038,%eax
+  80266e:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802671:	83 ec 0c             	sub    $0xc,%esp
+  802674:	68 04 70 80 00       	push   $0x807004
+  802679:	e8 9c 14 00 00       	call   803b1a <mutex_unlock>
+	return r;
+}
+  80267e:	89 f0                	mov    %esi,%eax
+  802680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5d                   	pop    %ebp
+  802686:	c3                   	ret
+
+00802687 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+  80268c:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80268e:	0f b6 10             	movzbl (%eax),%edx
+  802691:	80 fa 72             	cmp    $0x72,%dl
+  802694:	74 44                	je     8026da <parse_mode+0x53>
+  802696:	80 fa 77             	cmp    $0x77,%dl
+  802699:	74 4b                	je     8026e6 <parse_mode+0x5f>
+  80269b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026a0:	80 fa 61             	cmp    $0x61,%dl
+  8026a3:	74 09                	je     8026ae <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8026a5:	89 d8                	mov    %ebx,%eax
+  8026a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026aa:	5b                   	pop    %ebx
+  8026ab:	5e                   	pop    %esi
+  8026ac:	5d                   	pop    %ebp
+  8026ad:	c3                   	ret
+	switch (mode[0]) {
+  8026ae:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8026b3:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8026b8:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8026ba:	83 ec 08             	sub    $0x8,%esp
+  8026bd:	6a 2b                	push   $0x2b
+  8026bf:	50                   	push   %eax
+  8026c0:	e8 e6 e3 ff ff       	call   800aab <strchr>
+  8026c5:	83 c4 10             	add    $0x10,%esp
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	74 d9                	je     8026a5 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8026cc:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8026cf:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8026d2:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8026d8:	eb cb                	jmp    8026a5 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8026da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e4:	eb d2                	jmp    8026b8 <parse_mode+0x31>
+  8026e6:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8026eb:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8026f0:	eb c6                	jmp    8026b8 <parse_mode+0x31>
+
+008026f2 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	57                   	push   %edi
+  8026f6:	56                   	push   %esi
+  8026f7:	53                   	push   %ebx
+  8026f8:	83 ec 1c             	sub    $0x1c,%esp
+  8026fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026fe:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802701:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802706:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80270b:	83 c0 24             	add    $0x24,%eax
+  80270e:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802712:	74 17                	je     80272b <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802714:	83 c3 01             	add    $0x1,%ebx
+  802717:	83 fb 10             	cmp    $0x10,%ebx
+  80271a:	75 ef                	jne    80270b <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80271c:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802721:	89 f0                	mov    %esi,%eax
+  802723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802726:	5b                   	pop    %ebx
+  802727:	5e                   	pop    %esi
+  802728:	5f                   	pop    %edi
+  802729:	5d                   	pop    %ebp
+  80272a:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80272b:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802732:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802735:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802738:	c1 e7 02             	shl    $0x2,%edi
+  80273b:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802741:	83 ec 04             	sub    $0x4,%esp
+  802744:	6a 24                	push   $0x24
+  802746:	6a 00                	push   $0x0
+  802748:	56                   	push   %esi
+  802749:	e8 9c e3 ff ff       	call   800aea <memset>
+			streams[i].f_fd = fd;
+  80274e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802751:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802757:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80275a:	01 d8                	add    %ebx,%eax
+  80275c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80275f:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802766:	83 c4 10             	add    $0x10,%esp
+  802769:	eb b6                	jmp    802721 <stream_alloc+0x2f>
+
+0080276b <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	53                   	push   %ebx
+  80276f:	83 ec 14             	sub    $0x14,%esp
+  802772:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802774:	8b 40 18             	mov    0x18(%eax),%eax
+  802777:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80277a:	74 4a                	je     8027c6 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80277c:	83 ec 08             	sub    $0x8,%esp
+  80277f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802782:	50                   	push   %eax
+  802783:	ff 33                	push   (%ebx)
+  802785:	e8 e2 f1 ff ff       	call   80196c <fd_lookup>
+  80278a:	89 c2                	mov    %eax,%edx
+  80278c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80278f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802794:	85 d2                	test   %edx,%edx
+  802796:	78 41                	js     8027d9 <stream_unread+0x6e>
+  802798:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80279b:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8027a1:	39 0a                	cmp    %ecx,(%edx)
+  8027a3:	75 34                	jne    8027d9 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8027a5:	8b 43 14             	mov    0x14(%ebx),%eax
+  8027a8:	03 42 04             	add    0x4(%edx),%eax
+  8027ab:	2b 43 18             	sub    0x18(%ebx),%eax
+  8027ae:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8027b1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8027b8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8027bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027c4:	eb 13                	jmp    8027d9 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8027c6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8027cd:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8027d4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8027d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+
+008027de <stream_drain>:
+{
+  8027de:	55                   	push   %ebp
+  8027df:	89 e5                	mov    %esp,%ebp
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+  8027e3:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8027e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ea:	eb 02                	jmp    8027ee <stream_drain+0x10>
+  8027ec:	01 c3                	add    %eax,%ebx
+  8027ee:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027f1:	39 c3                	cmp    %eax,%ebx
+  8027f3:	73 43                	jae    802838 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8027f5:	83 ec 04             	sub    $0x4,%esp
+  8027f8:	29 d8                	sub    %ebx,%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	89 d8                	mov    %ebx,%eax
+  8027fd:	03 46 0c             	add    0xc(%esi),%eax
+  802800:	50                   	push   %eax
+  802801:	ff 36                	push   (%esi)
+  802803:	e8 ec f4 ff ff       	call   801cf4 <write>
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	7f dd                	jg     8027ec <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80280f:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802813:	8b 56 0c             	mov    0xc(%esi),%edx
+  802816:	83 ec 04             	sub    $0x4,%esp
+  802819:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80281c:	29 d8                	sub    %ebx,%eax
+  80281e:	50                   	push   %eax
+  80281f:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802822:	50                   	push   %eax
+  802823:	52                   	push   %edx
+  802824:	e8 f6 e2 ff ff       	call   800b1f <memmove>
+			f->f_wend -= done;
+  802829:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80282c:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80282e:	83 c4 10             	add    $0x10,%esp
+  802831:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802836:	eb 0a                	jmp    802842 <stream_drain+0x64>
+  802838:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80283d:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802842:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802845:	89 d0                	mov    %edx,%eax
+  802847:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80284a:	5b                   	pop    %ebx
+  80284b:	5e                   	pop    %esi
+  80284c:	5d                   	pop    %ebp
+  80284d:	c3                   	ret
+
+0080284e <stream_setup>:
+	if (f->f_buf)
+  80284e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802852:	74 01                	je     802855 <stream_setup+0x7>
+  802854:	c3                   	ret
+{
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	53                   	push   %ebx
+  802859:	83 ec 04             	sub    $0x4,%esp
+  80285c:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80285e:	8b 40 08             	mov    0x8(%eax),%eax
+  802861:	85 c0                	test   %eax,%eax
+  802863:	74 17                	je     80287c <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802865:	83 f8 03             	cmp    $0x3,%eax
+  802868:	75 2d                	jne    802897 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80286a:	8d 43 20             	lea    0x20(%ebx),%eax
+  80286d:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802870:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80287c:	83 ec 0c             	sub    $0xc,%esp
+  80287f:	ff 33                	push   (%ebx)
+  802881:	e8 29 1b 00 00       	call   8043af <iscons>
+  802886:	83 c4 10             	add    $0x10,%esp
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	0f 9f c0             	setg   %al
+  80288e:	0f b6 c0             	movzbl %al,%eax
+  802891:	83 c0 01             	add    $0x1,%eax
+  802894:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802897:	83 ec 0c             	sub    $0xc,%esp
+  80289a:	68 00 10 00 00       	push   $0x1000
+  80289f:	e8 6e 0b 00 00       	call   803412 <malloc>
+  8028a4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	74 bc                	je     80286a <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8028ae:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8028b5:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8028b9:	eb bc                	jmp    802877 <stream_setup+0x29>
+
+008028bb <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8028bb:	55                   	push   %ebp
+  8028bc:	89 e5                	mov    %esp,%ebp
+  8028be:	53                   	push   %ebx
+  8028bf:	83 ec 04             	sub    $0x4,%esp
+  8028c2:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8028c4:	e8 85 ff ff ff       	call   80284e <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8028c9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8028ce:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8028d2:	74 3d                	je     802911 <stream_fill+0x56>
+  8028d4:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8028d8:	74 10                	je     8028ea <stream_fill+0x2f>
+  8028da:	89 d8                	mov    %ebx,%eax
+  8028dc:	e8 fd fe ff ff       	call   8027de <stream_drain>
+		return 0;
+  8028e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8028e6:	85 c0                	test   %eax,%eax
+  8028e8:	78 27                	js     802911 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8028ea:	83 ec 04             	sub    $0x4,%esp
+  8028ed:	ff 73 10             	push   0x10(%ebx)
+  8028f0:	ff 73 0c             	push   0xc(%ebx)
+  8028f3:	ff 33                	push   (%ebx)
+  8028f5:	e8 02 f3 ff ff       	call   801bfc <read>
+  8028fa:	83 c4 10             	add    $0x10,%esp
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	7e 17                	jle    802918 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802901:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802905:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80290c:	89 c2                	mov    %eax,%edx
+  80290e:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802911:	89 d0                	mov    %edx,%eax
+  802913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802918:	c1 f8 1f             	sar    $0x1f,%eax
+  80291b:	83 e0 04             	and    $0x4,%eax
+  80291e:	83 c0 04             	add    $0x4,%eax
+  802921:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802924:	ba 00 00 00 00       	mov    $0x0,%edx
+  802929:	eb e6                	jmp    802911 <stream_fill+0x56>
+
+0080292b <fopen>:
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	57                   	push   %edi
+  80292f:	56                   	push   %esi
+  802930:	53                   	push   %ebx
+  802931:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802937:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80293a:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802940:	89 f0                	mov    %esi,%eax
+  802942:	e8 40 fd ff ff       	call   802687 <parse_mode>
+		return 0;
+  802947:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 2d                	js     80297d <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802950:	83 ec 08             	sub    $0x8,%esp
+  802953:	50                   	push   %eax
+  802954:	ff 75 08             	push   0x8(%ebp)
+  802957:	e8 e8 f8 ff ff       	call   802244 <open>
+  80295c:	89 c7                	mov    %eax,%edi
+  80295e:	83 c4 10             	add    $0x10,%esp
+  802961:	85 c0                	test   %eax,%eax
+  802963:	78 58                	js     8029bd <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802965:	80 3e 61             	cmpb   $0x61,(%esi)
+  802968:	74 1d                	je     802987 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80296a:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802970:	89 f8                	mov    %edi,%eax
+  802972:	e8 7b fd ff ff       	call   8026f2 <stream_alloc>
+  802977:	89 c3                	mov    %eax,%ebx
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	74 32                	je     8029af <fopen+0x84>
+}
+  80297d:	89 d8                	mov    %ebx,%eax
+  80297f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802982:	5b                   	pop    %ebx
+  802983:	5e                   	pop    %esi
+  802984:	5f                   	pop    %edi
+  802985:	5d                   	pop    %ebp
+  802986:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802987:	83 ec 08             	sub    $0x8,%esp
+  80298a:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802990:	50                   	push   %eax
+  802991:	57                   	push   %edi
+  802992:	e8 db f4 ff ff       	call   801e72 <fstat>
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 cc                	js     80296a <fopen+0x3f>
+		seek(fd, st.st_size);
+  80299e:	83 ec 08             	sub    $0x8,%esp
+  8029a1:	ff 75 dc             	push   -0x24(%ebp)
+  8029a4:	57                   	push   %edi
+  8029a5:	e8 f6 f3 ff ff       	call   801da0 <seek>
+  8029aa:	83 c4 10             	add    $0x10,%esp
+  8029ad:	eb bb                	jmp    80296a <fopen+0x3f>
+		close(fd);
+  8029af:	83 ec 0c             	sub    $0xc,%esp
+  8029b2:	57                   	push   %edi
+  8029b3:	e8 08 f1 ff ff       	call   801ac0 <close>
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	eb c0                	jmp    80297d <fopen+0x52>
+		return 0;
+  8029bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c2:	eb b9                	jmp    80297d <fopen+0x52>
+
+008029c4 <fdopen>:
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8029ca:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d0:	e8 b2 fc ff ff       	call   802687 <parse_mode>
+  8029d5:	89 c2                	mov    %eax,%edx
+		return 0;
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8029dc:	85 d2                	test   %edx,%edx
+  8029de:	78 0b                	js     8029eb <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8029e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e6:	e8 07 fd ff ff       	call   8026f2 <stream_alloc>
+}
+  8029eb:	c9                   	leave
+  8029ec:	c3                   	ret
+
+008029ed <setvbuf>:
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	57                   	push   %edi
+  8029f1:	56                   	push   %esi
+  8029f2:	53                   	push   %ebx
+  8029f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8029f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8029fc:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a00:	75 3a                	jne    802a3c <setvbuf+0x4f>
+  802a02:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802a05:	83 fe 02             	cmp    $0x2,%esi
+  802a08:	77 39                	ja     802a43 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802a0a:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802a0d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a11:	0f 95 c3             	setne  %bl
+  802a14:	85 ff                	test   %edi,%edi
+  802a16:	0f 95 c1             	setne  %cl
+  802a19:	84 cb                	test   %cl,%bl
+  802a1b:	74 05                	je     802a22 <setvbuf+0x35>
+  802a1d:	83 fa 03             	cmp    $0x3,%edx
+  802a20:	75 0a                	jne    802a2c <setvbuf+0x3f>
+	return 0;
+  802a22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a27:	5b                   	pop    %ebx
+  802a28:	5e                   	pop    %esi
+  802a29:	5f                   	pop    %edi
+  802a2a:	5d                   	pop    %ebp
+  802a2b:	c3                   	ret
+		f->f_buf = buf;
+  802a2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a2f:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802a32:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3a:	eb eb                	jmp    802a27 <setvbuf+0x3a>
+		return EOF;
+  802a3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a41:	eb e4                	jmp    802a27 <setvbuf+0x3a>
+  802a43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a48:	eb dd                	jmp    802a27 <setvbuf+0x3a>
+
+00802a4a <fflush>:
+{
+  802a4a:	55                   	push   %ebp
+  802a4b:	89 e5                	mov    %esp,%ebp
+  802a4d:	57                   	push   %edi
+  802a4e:	56                   	push   %esi
+  802a4f:	53                   	push   %ebx
+  802a50:	83 ec 0c             	sub    $0xc,%esp
+  802a53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802a56:	85 db                	test   %ebx,%ebx
+  802a58:	74 1a                	je     802a74 <fflush+0x2a>
+	stream_unread(f);
+  802a5a:	89 d8                	mov    %ebx,%eax
+  802a5c:	e8 0a fd ff ff       	call   80276b <stream_unread>
+	return stream_drain(f);
+  802a61:	89 d8                	mov    %ebx,%eax
+  802a63:	e8 76 fd ff ff       	call   8027de <stream_drain>
+  802a68:	89 c7                	mov    %eax,%edi
+}
+  802a6a:	89 f8                	mov    %edi,%eax
+  802a6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a6f:	5b                   	pop    %ebx
+  802a70:	5e                   	pop    %esi
+  802a71:	5f                   	pop    %edi
+  802a72:	5d                   	pop    %ebp
+  802a73:	c3                   	ret
+  802a74:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802a79:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a83:	eb 03                	jmp    802a88 <fflush+0x3e>
+  802a85:	83 c3 24             	add    $0x24,%ebx
+  802a88:	39 f3                	cmp    %esi,%ebx
+  802a8a:	74 de                	je     802a6a <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802a8c:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802a90:	74 f3                	je     802a85 <fflush+0x3b>
+  802a92:	83 ec 0c             	sub    $0xc,%esp
+  802a95:	53                   	push   %ebx
+  802a96:	e8 af ff ff ff       	call   802a4a <fflush>
+  802a9b:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aa5:	0f 48 f8             	cmovs  %eax,%edi
+  802aa8:	eb db                	jmp    802a85 <fflush+0x3b>
+
+00802aaa <fclose>:
+{
+  802aaa:	55                   	push   %ebp
+  802aab:	89 e5                	mov    %esp,%ebp
+  802aad:	56                   	push   %esi
+  802aae:	53                   	push   %ebx
+  802aaf:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802ab2:	83 ec 0c             	sub    $0xc,%esp
+  802ab5:	56                   	push   %esi
+  802ab6:	e8 8f ff ff ff       	call   802a4a <fflush>
+  802abb:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802abd:	83 c4 04             	add    $0x4,%esp
+  802ac0:	ff 36                	push   (%esi)
+  802ac2:	e8 f9 ef ff ff       	call   801ac0 <close>
+  802ac7:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ad1:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802ad4:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802ad8:	75 10                	jne    802aea <fclose+0x40>
+	f->f_flags = 0;
+  802ada:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802ae1:	89 d8                	mov    %ebx,%eax
+  802ae3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae6:	5b                   	pop    %ebx
+  802ae7:	5e                   	pop    %esi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+		free(f->f_buf);
+  802aea:	83 ec 0c             	sub    $0xc,%esp
+  802aed:	ff 76 0c             	push   0xc(%esi)
+  802af0:	e8 54 08 00 00       	call   803349 <free>
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	eb e0                	jmp    802ada <fclose+0x30>
+
+00802afa <fileno>:
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b00:	8b 00                	mov    (%eax),%eax
+}
+  802b02:	5d                   	pop    %ebp
+  802b03:	c3                   	ret
+
+00802b04 <feof>:
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0a:	8b 40 04             	mov    0x4(%eax),%eax
+  802b0d:	c1 e8 02             	shr    $0x2,%eax
+  802b10:	83 e0 01             	and    $0x1,%eax
+}
+  802b13:	5d                   	pop    %ebp
+  802b14:	c3                   	ret
+
+00802b15 <ferror>:
+{
+  802b15:	55                   	push   %ebp
+  802b16:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802b18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1b:	8b 40 04             	mov    0x4(%eax),%eax
+  802b1e:	c1 e8 03             	shr    $0x3,%eax
+  802b21:	83 e0 01             	and    $0x1,%eax
+}
+  802b24:	5d                   	pop    %ebp
+  802b25:	c3                   	ret
+
+00802b26 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 04             	sub    $0x4,%esp
+  802b2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b30:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b33:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802b36:	74 15                	je     802b4d <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802b38:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802b3b:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b3e:	8d 48 01             	lea    0x1(%eax),%ecx
+  802b41:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802b44:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b4b:	c9                   	leave
+  802b4c:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b4d:	89 d8                	mov    %ebx,%eax
+  802b4f:	e8 67 fd ff ff       	call   8028bb <stream_fill>
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	75 e0                	jne    802b38 <fgetc+0x12>
+		return EOF;
+  802b58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b5d:	eb e9                	jmp    802b48 <fgetc+0x22>
+
+00802b5f <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	57                   	push   %edi
+  802b63:	56                   	push   %esi
+  802b64:	53                   	push   %ebx
+  802b65:	83 ec 1c             	sub    $0x1c,%esp
+  802b68:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b73:	83 e8 01             	sub    $0x1,%eax
+  802b76:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802b79:	eb 66                	jmp    802be1 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b7b:	8b 46 14             	mov    0x14(%esi),%eax
+  802b7e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802b81:	29 c3                	sub    %eax,%ebx
+  802b83:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b86:	29 fa                	sub    %edi,%edx
+  802b88:	39 d3                	cmp    %edx,%ebx
+  802b8a:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b8d:	83 ec 04             	sub    $0x4,%esp
+  802b90:	53                   	push   %ebx
+  802b91:	6a 0a                	push   $0xa
+  802b93:	03 46 0c             	add    0xc(%esi),%eax
+  802b96:	50                   	push   %eax
+  802b97:	e8 34 e0 ff ff       	call   800bd0 <memfind>
+  802b9c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802b9f:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ba2:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802ba5:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802ba8:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802baa:	83 c4 10             	add    $0x10,%esp
+  802bad:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802bb0:	74 0b                	je     802bbd <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802bb2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802bb5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802bb8:	29 d3                	sub    %edx,%ebx
+  802bba:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802bbd:	83 ec 04             	sub    $0x4,%esp
+  802bc0:	53                   	push   %ebx
+  802bc1:	01 c8                	add    %ecx,%eax
+  802bc3:	50                   	push   %eax
+  802bc4:	89 f8                	mov    %edi,%eax
+  802bc6:	03 45 08             	add    0x8(%ebp),%eax
+  802bc9:	50                   	push   %eax
+  802bca:	e8 50 df ff ff       	call   800b1f <memmove>
+		f->f_rpos += m;
+  802bcf:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802bd2:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802bd4:	83 c4 10             	add    $0x10,%esp
+  802bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bda:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802bdf:	74 1f                	je     802c00 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802be1:	8d 47 01             	lea    0x1(%edi),%eax
+  802be4:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802be7:	73 17                	jae    802c00 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802be9:	8b 46 18             	mov    0x18(%esi),%eax
+  802bec:	39 46 14             	cmp    %eax,0x14(%esi)
+  802bef:	75 8a                	jne    802b7b <fgets+0x1c>
+  802bf1:	89 f0                	mov    %esi,%eax
+  802bf3:	e8 c3 fc ff ff       	call   8028bb <stream_fill>
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	0f 85 7b ff ff ff    	jne    802b7b <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802c00:	85 ff                	test   %edi,%edi
+  802c02:	74 0f                	je     802c13 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802c04:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c07:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c0e:	5b                   	pop    %ebx
+  802c0f:	5e                   	pop    %esi
+  802c10:	5f                   	pop    %edi
+  802c11:	5d                   	pop    %ebp
+  802c12:	c3                   	ret
+		return 0;
+  802c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c18:	eb f1                	jmp    802c0b <fgets+0xac>
+
+00802c1a <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802c1a:	55                   	push   %ebp
+  802c1b:	89 e5                	mov    %esp,%ebp
+  802c1d:	57                   	push   %edi
+  802c1e:	56                   	push   %esi
+  802c1f:	53                   	push   %ebx
+  802c20:	83 ec 1c             	sub    $0x1c,%esp
+  802c23:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802c26:	89 f0                	mov    %esi,%eax
+  802c28:	e8 21 fc ff ff       	call   80284e <stream_setup>
+	want = size * n;
+  802c2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c30:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802c37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3c:	eb 43                	jmp    802c81 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802c3e:	29 d3                	sub    %edx,%ebx
+  802c40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c43:	29 f8                	sub    %edi,%eax
+  802c45:	39 c3                	cmp    %eax,%ebx
+  802c47:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802c4a:	83 ec 04             	sub    $0x4,%esp
+  802c4d:	53                   	push   %ebx
+  802c4e:	03 56 0c             	add    0xc(%esi),%edx
+  802c51:	52                   	push   %edx
+  802c52:	89 f8                	mov    %edi,%eax
+  802c54:	03 45 08             	add    0x8(%ebp),%eax
+  802c57:	50                   	push   %eax
+  802c58:	e8 c2 de ff ff       	call   800b1f <memmove>
+			f->f_rpos += m;
+  802c5d:	01 5e 14             	add    %ebx,0x14(%esi)
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	eb 1a                	jmp    802c7f <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802c65:	83 ec 04             	sub    $0x4,%esp
+  802c68:	53                   	push   %ebx
+  802c69:	89 f8                	mov    %edi,%eax
+  802c6b:	03 45 08             	add    0x8(%ebp),%eax
+  802c6e:	50                   	push   %eax
+  802c6f:	ff 36                	push   (%esi)
+  802c71:	e8 86 ef ff ff       	call   801bfc <read>
+  802c76:	89 c3                	mov    %eax,%ebx
+  802c78:	83 c4 10             	add    $0x10,%esp
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	7e 36                	jle    802cb5 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802c7f:	01 df                	add    %ebx,%edi
+  802c81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c84:	39 c7                	cmp    %eax,%edi
+  802c86:	73 39                	jae    802cc1 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802c88:	8b 56 14             	mov    0x14(%esi),%edx
+  802c8b:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c8e:	39 da                	cmp    %ebx,%edx
+  802c90:	72 ac                	jb     802c3e <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802c92:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c95:	29 fb                	sub    %edi,%ebx
+  802c97:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802c9a:	72 3e                	jb     802cda <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802c9c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802ca0:	74 1f                	je     802cc1 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802ca2:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802ca6:	74 bd                	je     802c65 <fread+0x4b>
+  802ca8:	89 f0                	mov    %esi,%eax
+  802caa:	e8 2f fb ff ff       	call   8027de <stream_drain>
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	79 b2                	jns    802c65 <fread+0x4b>
+  802cb3:	eb 0c                	jmp    802cc1 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802cb5:	c1 fb 1f             	sar    $0x1f,%ebx
+  802cb8:	83 e3 04             	and    $0x4,%ebx
+  802cbb:	83 c3 04             	add    $0x4,%ebx
+  802cbe:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802cc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	74 0a                	je     802cd2 <fread+0xb8>
+  802cc8:	89 f8                	mov    %edi,%eax
+  802cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ccf:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802cd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd5:	5b                   	pop    %ebx
+  802cd6:	5e                   	pop    %esi
+  802cd7:	5f                   	pop    %edi
+  802cd8:	5d                   	pop    %ebp
+  802cd9:	c3                   	ret
+		} else if (!stream_fill(f))
+  802cda:	89 f0                	mov    %esi,%eax
+  802cdc:	e8 da fb ff ff       	call   8028bb <stream_fill>
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	74 dc                	je     802cc1 <fread+0xa7>
+			m = 0;
+  802ce5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cea:	eb 93                	jmp    802c7f <fread+0x65>
+
+00802cec <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	57                   	push   %edi
+  802cf0:	56                   	push   %esi
+  802cf1:	53                   	push   %ebx
+  802cf2:	83 ec 1c             	sub    $0x1c,%esp
+  802cf5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802cf8:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cfb:	a8 02                	test   $0x2,%al
+  802cfd:	75 13                	jne    802d12 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802cff:	83 c8 08             	or     $0x8,%eax
+  802d02:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0d:	5b                   	pop    %ebx
+  802d0e:	5e                   	pop    %esi
+  802d0f:	5f                   	pop    %edi
+  802d10:	5d                   	pop    %ebp
+  802d11:	c3                   	ret
+	stream_setup(f);
+  802d12:	89 d8                	mov    %ebx,%eax
+  802d14:	e8 35 fb ff ff       	call   80284e <stream_setup>
+	want = size * n;
+  802d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d1c:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d20:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802d23:	89 d8                	mov    %ebx,%eax
+  802d25:	e8 41 fa ff ff       	call   80276b <stream_unread>
+	for (done = 0; done < want; ) {
+  802d2a:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802d2f:	84 c0                	test   %al,%al
+  802d31:	75 7b                	jne    802dae <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802d33:	be 00 00 00 00       	mov    $0x0,%esi
+  802d38:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d3b:	39 fe                	cmp    %edi,%esi
+  802d3d:	73 24                	jae    802d63 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d3f:	83 ec 04             	sub    $0x4,%esp
+  802d42:	89 f8                	mov    %edi,%eax
+  802d44:	29 f0                	sub    %esi,%eax
+  802d46:	50                   	push   %eax
+  802d47:	89 f0                	mov    %esi,%eax
+  802d49:	03 45 08             	add    0x8(%ebp),%eax
+  802d4c:	50                   	push   %eax
+  802d4d:	ff 33                	push   (%ebx)
+  802d4f:	e8 a0 ef ff ff       	call   801cf4 <write>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	7e 04                	jle    802d5f <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802d5b:	01 c6                	add    %eax,%esi
+  802d5d:	eb dc                	jmp    802d3b <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802d5f:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802d63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d66:	85 c0                	test   %eax,%eax
+  802d68:	74 a0                	je     802d0a <fwrite+0x1e>
+  802d6a:	89 f0                	mov    %esi,%eax
+  802d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d71:	f7 75 0c             	divl   0xc(%ebp)
+  802d74:	eb 94                	jmp    802d0a <fwrite+0x1e>
+			done += r;
+  802d76:	01 c7                	add    %eax,%edi
+			continue;
+  802d78:	eb 34                	jmp    802dae <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802d7a:	8b 73 10             	mov    0x10(%ebx),%esi
+  802d7d:	29 c6                	sub    %eax,%esi
+  802d7f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d82:	29 fa                	sub    %edi,%edx
+  802d84:	39 d6                	cmp    %edx,%esi
+  802d86:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802d89:	83 ec 04             	sub    $0x4,%esp
+  802d8c:	56                   	push   %esi
+  802d8d:	89 fa                	mov    %edi,%edx
+  802d8f:	03 55 08             	add    0x8(%ebp),%edx
+  802d92:	52                   	push   %edx
+  802d93:	03 43 0c             	add    0xc(%ebx),%eax
+  802d96:	50                   	push   %eax
+  802d97:	e8 83 dd ff ff       	call   800b1f <memmove>
+		f->f_wend += m;
+  802d9c:	89 f0                	mov    %esi,%eax
+  802d9e:	03 43 1c             	add    0x1c(%ebx),%eax
+  802da1:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802da4:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802da6:	83 c4 10             	add    $0x10,%esp
+  802da9:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802dac:	74 5b                	je     802e09 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802dae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802db1:	39 c7                	cmp    %eax,%edi
+  802db3:	73 2d                	jae    802de2 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802db5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	75 be                	jne    802d7a <fwrite+0x8e>
+  802dbc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dbf:	29 fa                	sub    %edi,%edx
+  802dc1:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802dc4:	72 b4                	jb     802d7a <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802dc6:	83 ec 04             	sub    $0x4,%esp
+  802dc9:	52                   	push   %edx
+  802dca:	89 f8                	mov    %edi,%eax
+  802dcc:	03 45 08             	add    0x8(%ebp),%eax
+  802dcf:	50                   	push   %eax
+  802dd0:	ff 33                	push   (%ebx)
+  802dd2:	e8 1d ef ff ff       	call   801cf4 <write>
+  802dd7:	83 c4 10             	add    $0x10,%esp
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	7f 98                	jg     802d76 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802dde:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802de2:	8b 43 08             	mov    0x8(%ebx),%eax
+  802de5:	83 f8 03             	cmp    $0x3,%eax
+  802de8:	74 48                	je     802e32 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802dea:	83 f8 02             	cmp    $0x2,%eax
+  802ded:	74 27                	je     802e16 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802def:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	0f 84 10 ff ff ff    	je     802d0a <fwrite+0x1e>
+  802dfa:	89 f8                	mov    %edi,%eax
+  802dfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e01:	f7 75 0c             	divl   0xc(%ebp)
+  802e04:	e9 01 ff ff ff       	jmp    802d0a <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e09:	89 d8                	mov    %ebx,%eax
+  802e0b:	e8 ce f9 ff ff       	call   8027de <stream_drain>
+  802e10:	85 c0                	test   %eax,%eax
+  802e12:	79 9a                	jns    802dae <fwrite+0xc2>
+  802e14:	eb cc                	jmp    802de2 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e16:	83 ec 04             	sub    $0x4,%esp
+  802e19:	57                   	push   %edi
+  802e1a:	6a 0a                	push   $0xa
+  802e1c:	ff 75 08             	push   0x8(%ebp)
+  802e1f:	e8 ac dd ff ff       	call   800bd0 <memfind>
+  802e24:	89 c2                	mov    %eax,%edx
+  802e26:	89 f8                	mov    %edi,%eax
+  802e28:	03 45 08             	add    0x8(%ebp),%eax
+  802e2b:	83 c4 10             	add    $0x10,%esp
+  802e2e:	39 c2                	cmp    %eax,%edx
+  802e30:	74 bd                	je     802def <fwrite+0x103>
+		stream_drain(f);
+  802e32:	89 d8                	mov    %ebx,%eax
+  802e34:	e8 a5 f9 ff ff       	call   8027de <stream_drain>
+  802e39:	eb b4                	jmp    802def <fwrite+0x103>
+
+00802e3b <fputc>:
+{
+  802e3b:	55                   	push   %ebp
+  802e3c:	89 e5                	mov    %esp,%ebp
+  802e3e:	53                   	push   %ebx
+  802e3f:	83 ec 14             	sub    $0x14,%esp
+  802e42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802e45:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802e48:	ff 75 0c             	push   0xc(%ebp)
+  802e4b:	6a 01                	push   $0x1
+  802e4d:	6a 01                	push   $0x1
+  802e4f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e52:	50                   	push   %eax
+  802e53:	e8 94 fe ff ff       	call   802cec <fwrite>
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	0f b6 db             	movzbl %bl,%ebx
+  802e5e:	83 f8 01             	cmp    $0x1,%eax
+  802e61:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e66:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802e69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e6c:	c9                   	leave
+  802e6d:	c3                   	ret
+
+00802e6e <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802e6e:	55                   	push   %ebp
+  802e6f:	89 e5                	mov    %esp,%ebp
+  802e71:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802e74:	ff 75 0c             	push   0xc(%ebp)
+  802e77:	ff 75 08             	push   0x8(%ebp)
+  802e7a:	e8 bc ff ff ff       	call   802e3b <fputc>
+}
+  802e7f:	83 c4 10             	add    $0x10,%esp
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+00802e84 <fputs>:
+{
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	56                   	push   %esi
+  802e88:	53                   	push   %ebx
+  802e89:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802e8c:	83 ec 0c             	sub    $0xc,%esp
+  802e8f:	56                   	push   %esi
+  802e90:	e8 c9 da ff ff       	call   80095e <strlen>
+  802e95:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802e97:	ff 75 0c             	push   0xc(%ebp)
+  802e9a:	50                   	push   %eax
+  802e9b:	6a 01                	push   $0x1
+  802e9d:	56                   	push   %esi
+  802e9e:	e8 49 fe ff ff       	call   802cec <fwrite>
+  802ea3:	83 c4 20             	add    $0x20,%esp
+  802ea6:	39 d8                	cmp    %ebx,%eax
+  802ea8:	0f 95 c0             	setne  %al
+  802eab:	0f b6 c0             	movzbl %al,%eax
+  802eae:	f7 d8                	neg    %eax
+}
+  802eb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eb3:	5b                   	pop    %ebx
+  802eb4:	5e                   	pop    %esi
+  802eb5:	5d                   	pop    %ebp
+  802eb6:	c3                   	ret
+
+00802eb7 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802eb7:	55                   	push   %ebp
+  802eb8:	89 e5                	mov    %esp,%ebp
+  802eba:	53                   	push   %ebx
+  802ebb:	83 ec 04             	sub    $0x4,%esp
+  802ebe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802ec1:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802ec4:	50                   	push   %eax
+  802ec5:	ff 75 0c             	push   0xc(%ebp)
+  802ec8:	53                   	push   %ebx
+  802ec9:	68 6e 2e 80 00       	push   $0x802e6e
+  802ece:	e8 d9 d5 ff ff       	call   8004ac <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802ed3:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ed6:	c1 e0 1c             	shl    $0x1c,%eax
+  802ed9:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802edc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802edf:	c9                   	leave
+  802ee0:	c3                   	ret
+
+00802ee1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ee1:	55                   	push   %ebp
+  802ee2:	89 e5                	mov    %esp,%ebp
+  802ee4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802ee7:	68 a8 4f 80 00       	push   $0x804fa8
+  802eec:	ff 75 0c             	push   0xc(%ebp)
+  802eef:	e8 a5 da ff ff       	call   800999 <strcpy>
+	return 0;
+}
+  802ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef9:	c9                   	leave
+  802efa:	c3                   	ret
+
+00802efb <devsock_close>:
+{
+  802efb:	55                   	push   %ebp
+  802efc:	89 e5                	mov    %esp,%ebp
+  802efe:	53                   	push   %ebx
+  802eff:	83 ec 10             	sub    $0x10,%esp
+  802f02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802f05:	53                   	push   %ebx
+  802f06:	e8 11 17 00 00       	call   80461c <pageref>
+  802f0b:	89 c2                	mov    %eax,%edx
+  802f0d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802f10:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802f15:	83 fa 01             	cmp    $0x1,%edx
+  802f18:	74 05                	je     802f1f <devsock_close+0x24>
+}
+  802f1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f1d:	c9                   	leave
+  802f1e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802f1f:	83 ec 0c             	sub    $0xc,%esp
+  802f22:	ff 73 0c             	push   0xc(%ebx)
+  802f25:	e8 b7 02 00 00       	call   8031e1 <nsipc_close>
+  802f2a:	83 c4 10             	add    $0x10,%esp
+  802f2d:	eb eb                	jmp    802f1a <devsock_close+0x1f>
+
+00802f2f <devsock_write>:
+{
+  802f2f:	55                   	push   %ebp
+  802f30:	89 e5                	mov    %esp,%ebp
+  802f32:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802f35:	6a 00                	push   $0x0
+  802f37:	ff 75 10             	push   0x10(%ebp)
+  802f3a:	ff 75 0c             	push   0xc(%ebp)
+  802f3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f40:	ff 70 0c             	push   0xc(%eax)
+  802f43:	e8 79 03 00 00       	call   8032c1 <nsipc_send>
+}
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+
+00802f4a <devsock_read>:
+{
+  802f4a:	55                   	push   %ebp
+  802f4b:	89 e5                	mov    %esp,%ebp
+  802f4d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802f50:	6a 00                	push   $0x0
+  802f52:	ff 75 10             	push   0x10(%ebp)
+  802f55:	ff 75 0c             	push   0xc(%ebp)
+  802f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5b:	ff 70 0c             	push   0xc(%eax)
+  802f5e:	e8 ef 02 00 00       	call   803252 <nsipc_recv>
+}
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+
+00802f65 <fd2sockid>:
+{
+  802f65:	55                   	push   %ebp
+  802f66:	89 e5                	mov    %esp,%ebp
+  802f68:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802f6b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f6e:	52                   	push   %edx
+  802f6f:	50                   	push   %eax
+  802f70:	e8 f7 e9 ff ff       	call   80196c <fd_lookup>
+  802f75:	83 c4 10             	add    $0x10,%esp
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	78 10                	js     802f8c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f7f:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802f85:	39 08                	cmp    %ecx,(%eax)
+  802f87:	75 05                	jne    802f8e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f89:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f8c:	c9                   	leave
+  802f8d:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f8e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f93:	eb f7                	jmp    802f8c <fd2sockid+0x27>
+
+00802f95 <alloc_sockfd>:
+{
+  802f95:	55                   	push   %ebp
+  802f96:	89 e5                	mov    %esp,%ebp
+  802f98:	56                   	push   %esi
+  802f99:	53                   	push   %ebx
+  802f9a:	83 ec 1c             	sub    $0x1c,%esp
+  802f9d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fa2:	50                   	push   %eax
+  802fa3:	e8 6e e9 ff ff       	call   801916 <fd_alloc>
+  802fa8:	89 c3                	mov    %eax,%ebx
+  802faa:	83 c4 10             	add    $0x10,%esp
+  802fad:	85 c0                	test   %eax,%eax
+  802faf:	78 43                	js     802ff4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802fb1:	83 ec 04             	sub    $0x4,%esp
+  802fb4:	68 07 04 00 00       	push   $0x407
+  802fb9:	ff 75 f4             	push   -0xc(%ebp)
+  802fbc:	6a 00                	push   $0x0
+  802fbe:	e8 14 de ff ff       	call   800dd7 <sys_page_alloc>
+  802fc3:	89 c3                	mov    %eax,%ebx
+  802fc5:	83 c4 10             	add    $0x10,%esp
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	78 28                	js     802ff4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802fcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fcf:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802fd5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fda:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802fe1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802fe4:	83 ec 0c             	sub    $0xc,%esp
+  802fe7:	50                   	push   %eax
+  802fe8:	e8 02 e9 ff ff       	call   8018ef <fd2num>
+  802fed:	89 c3                	mov    %eax,%ebx
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	eb 0c                	jmp    803000 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802ff4:	83 ec 0c             	sub    $0xc,%esp
+  802ff7:	56                   	push   %esi
+  802ff8:	e8 e4 01 00 00       	call   8031e1 <nsipc_close>
+		return r;
+  802ffd:	83 c4 10             	add    $0x10,%esp
+}
+  803000:	89 d8                	mov    %ebx,%eax
+  803002:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803005:	5b                   	pop    %ebx
+  803006:	5e                   	pop    %esi
+  803007:	5d                   	pop    %ebp
+  803008:	c3                   	ret
+
+00803009 <accept>:
+{
+  803009:	55                   	push   %ebp
+  80300a:	89 e5                	mov    %esp,%ebp
+  80300c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80300f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803012:	e8 4e ff ff ff       	call   802f65 <fd2sockid>
+  803017:	85 c0                	test   %eax,%eax
+  803019:	78 1b                	js     803036 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80301b:	83 ec 04             	sub    $0x4,%esp
+  80301e:	ff 75 10             	push   0x10(%ebp)
+  803021:	ff 75 0c             	push   0xc(%ebp)
+  803024:	50                   	push   %eax
+  803025:	e8 0e 01 00 00       	call   803138 <nsipc_accept>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 05                	js     803036 <accept+0x2d>
+	return alloc_sockfd(r);
+  803031:	e8 5f ff ff ff       	call   802f95 <alloc_sockfd>
+}
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+
+00803038 <bind>:
+{
+  803038:	55                   	push   %ebp
+  803039:	89 e5                	mov    %esp,%ebp
+  80303b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80303e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803041:	e8 1f ff ff ff       	call   802f65 <fd2sockid>
+  803046:	85 c0                	test   %eax,%eax
+  803048:	78 12                	js     80305c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80304a:	83 ec 04             	sub    $0x4,%esp
+  80304d:	ff 75 10             	push   0x10(%ebp)
+  803050:	ff 75 0c             	push   0xc(%ebp)
+  803053:	50                   	push   %eax
+  803054:	e8 31 01 00 00       	call   80318a <nsipc_bind>
+  803059:	83 c4 10             	add    $0x10,%esp
+}
+  80305c:	c9                   	leave
+  80305d:	c3                   	ret
+
+0080305e <shutdown>:
+{
+  80305e:	55                   	push   %ebp
+  80305f:	89 e5                	mov    %esp,%ebp
+  803061:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803064:	8b 45 08             	mov    0x8(%ebp),%eax
+  803067:	e8 f9 fe ff ff       	call   802f65 <fd2sockid>
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	78 0f                	js     80307f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803070:	83 ec 08             	sub    $0x8,%esp
+  803073:	ff 75 0c             	push   0xc(%ebp)
+  803076:	50                   	push   %eax
+  803077:	e8 43 01 00 00       	call   8031bf <nsipc_shutdown>
+  80307c:	83 c4 10             	add    $0x10,%esp
+}
+  80307f:	c9                   	leave
+  803080:	c3                   	ret
+
+00803081 <connect>:
+{
+  803081:	55                   	push   %ebp
+  803082:	89 e5                	mov    %esp,%ebp
+  803084:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803087:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308a:	e8 d6 fe ff ff       	call   802f65 <fd2sockid>
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	78 12                	js     8030a5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803093:	83 ec 04             	sub    $0x4,%esp
+  803096:	ff 75 10             	push   0x10(%ebp)
+  803099:	ff 75 0c             	push   0xc(%ebp)
+  80309c:	50                   	push   %eax
+  80309d:	e8 59 01 00 00       	call   8031fb <nsipc_connect>
+  8030a2:	83 c4 10             	add    $0x10,%esp
+}
+  8030a5:	c9                   	leave
+  8030a6:	c3                   	ret
+
+008030a7 <listen>:
+{
+  8030a7:	55                   	push   %ebp
+  8030a8:	89 e5                	mov    %esp,%ebp
+  8030aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b0:	e8 b0 fe ff ff       	call   802f65 <fd2sockid>
+  8030b5:	85 c0                	test   %eax,%eax
+  8030b7:	78 0f                	js     8030c8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8030b9:	83 ec 08             	sub    $0x8,%esp
+  8030bc:	ff 75 0c             	push   0xc(%ebp)
+  8030bf:	50                   	push   %eax
+  8030c0:	e8 6b 01 00 00       	call   803230 <nsipc_listen>
+  8030c5:	83 c4 10             	add    $0x10,%esp
+}
+  8030c8:	c9                   	leave
+  8030c9:	c3                   	ret
+
+008030ca <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8030ca:	55                   	push   %ebp
+  8030cb:	89 e5                	mov    %esp,%ebp
+  8030cd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8030d0:	ff 75 10             	push   0x10(%ebp)
+  8030d3:	ff 75 0c             	push   0xc(%ebp)
+  8030d6:	ff 75 08             	push   0x8(%ebp)
+  8030d9:	e8 41 02 00 00       	call   80331f <nsipc_socket>
+  8030de:	83 c4 10             	add    $0x10,%esp
+  8030e1:	85 c0                	test   %eax,%eax
+  8030e3:	78 05                	js     8030ea <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8030e5:	e8 ab fe ff ff       	call   802f95 <alloc_sockfd>
+}
+  8030ea:	c9                   	leave
+  8030eb:	c3                   	ret
+
+008030ec <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8030ec:	55                   	push   %ebp
+  8030ed:	89 e5                	mov    %esp,%ebp
+  8030ef:	53                   	push   %ebx
+  8030f0:	83 ec 04             	sub    $0x4,%esp
+  8030f3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8030f5:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  8030fc:	74 26                	je     803124 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8030fe:	6a 07                	push   $0x7
+  803100:	68 00 90 80 00       	push   $0x809000
+  803105:	53                   	push   %ebx
+  803106:	ff 35 08 70 80 00    	push   0x807008
+  80310c:	e8 76 14 00 00       	call   804587 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803111:	83 c4 0c             	add    $0xc,%esp
+  803114:	6a 00                	push   $0x0
+  803116:	6a 00                	push   $0x0
+  803118:	6a 00                	push   $0x0
+  80311a:	e8 72 13 00 00       	call   804491 <ipc_recv>
+}
+  80311f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803124:	83 ec 0c             	sub    $0xc,%esp
+  803127:	6a 02                	push   $0x2
+  803129:	e8 af 14 00 00       	call   8045dd <ipc_find_env>
+  80312e:	a3 08 70 80 00       	mov    %eax,0x807008
+  803133:	83 c4 10             	add    $0x10,%esp
+  803136:	eb c6                	jmp    8030fe <nsipc+0x12>
+
+00803138 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803138:	55                   	push   %ebp
+  803139:	89 e5                	mov    %esp,%ebp
+  80313b:	56                   	push   %esi
+  80313c:	53                   	push   %ebx
+  80313d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803140:	8b 45 08             	mov    0x8(%ebp),%eax
+  803143:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803148:	8b 06                	mov    (%esi),%eax
+  80314a:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80314f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803154:	e8 93 ff ff ff       	call   8030ec <nsipc>
+  803159:	89 c3                	mov    %eax,%ebx
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	79 09                	jns    803168 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80315f:	89 d8                	mov    %ebx,%eax
+  803161:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803164:	5b                   	pop    %ebx
+  803165:	5e                   	pop    %esi
+  803166:	5d                   	pop    %ebp
+  803167:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803168:	83 ec 04             	sub    $0x4,%esp
+  80316b:	ff 35 10 90 80 00    	push   0x809010
+  803171:	68 00 90 80 00       	push   $0x809000
+  803176:	ff 75 0c             	push   0xc(%ebp)
+  803179:	e8 a1 d9 ff ff       	call   800b1f <memmove>
+		*addrlen = ret->ret_addrlen;
+  80317e:	a1 10 90 80 00       	mov    0x809010,%eax
+  803183:	89 06                	mov    %eax,(%esi)
+  803185:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803188:	eb d5                	jmp    80315f <nsipc_accept+0x27>
+
+0080318a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80318a:	55                   	push   %ebp
+  80318b:	89 e5                	mov    %esp,%ebp
+  80318d:	53                   	push   %ebx
+  80318e:	83 ec 08             	sub    $0x8,%esp
+  803191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803194:	8b 45 08             	mov    0x8(%ebp),%eax
+  803197:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80319c:	53                   	push   %ebx
+  80319d:	ff 75 0c             	push   0xc(%ebp)
+  8031a0:	68 04 90 80 00       	push   $0x809004
+  8031a5:	e8 75 d9 ff ff       	call   800b1f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8031aa:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8031b0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8031b5:	e8 32 ff ff ff       	call   8030ec <nsipc>
+}
+  8031ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031bd:	c9                   	leave
+  8031be:	c3                   	ret
+
+008031bf <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8031bf:	55                   	push   %ebp
+  8031c0:	89 e5                	mov    %esp,%ebp
+  8031c2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8031c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8031cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d0:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8031d5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8031da:	e8 0d ff ff ff       	call   8030ec <nsipc>
+}
+  8031df:	c9                   	leave
+  8031e0:	c3                   	ret
+
+008031e1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8031e1:	55                   	push   %ebp
+  8031e2:	89 e5                	mov    %esp,%ebp
+  8031e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8031e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ea:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  8031ef:	b8 04 00 00 00       	mov    $0x4,%eax
+  8031f4:	e8 f3 fe ff ff       	call   8030ec <nsipc>
+}
+  8031f9:	c9                   	leave
+  8031fa:	c3                   	ret
+
+008031fb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8031fb:	55                   	push   %ebp
+  8031fc:	89 e5                	mov    %esp,%ebp
+  8031fe:	53                   	push   %ebx
+  8031ff:	83 ec 08             	sub    $0x8,%esp
+  803202:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803205:	8b 45 08             	mov    0x8(%ebp),%eax
+  803208:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80320d:	53                   	push   %ebx
+  80320e:	ff 75 0c             	push   0xc(%ebp)
+  803211:	68 04 90 80 00       	push   $0x809004
+  803216:	e8 04 d9 ff ff       	call   800b1f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80321b:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803221:	b8 05 00 00 00       	mov    $0x5,%eax
+  803226:	e8 c1 fe ff ff       	call   8030ec <nsipc>
+}
+  80322b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80322e:	c9                   	leave
+  80322f:	c3                   	ret
+
+00803230 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803230:	55                   	push   %ebp
+  803231:	89 e5                	mov    %esp,%ebp
+  803233:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803236:	8b 45 08             	mov    0x8(%ebp),%eax
+  803239:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80323e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803241:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803246:	b8 06 00 00 00       	mov    $0x6,%eax
+  80324b:	e8 9c fe ff ff       	call   8030ec <nsipc>
+}
+  803250:	c9                   	leave
+  803251:	c3                   	ret
+
+00803252 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803252:	55                   	push   %ebp
+  803253:	89 e5                	mov    %esp,%ebp
+  803255:	56                   	push   %esi
+  803256:	53                   	push   %ebx
+  803257:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80325a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803262:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803268:	8b 45 14             	mov    0x14(%ebp),%eax
+  80326b:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803270:	b8 07 00 00 00       	mov    $0x7,%eax
+  803275:	e8 72 fe ff ff       	call   8030ec <nsipc>
+  80327a:	89 c3                	mov    %eax,%ebx
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	78 22                	js     8032a2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803280:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803285:	39 c6                	cmp    %eax,%esi
+  803287:	0f 4e c6             	cmovle %esi,%eax
+  80328a:	39 c3                	cmp    %eax,%ebx
+  80328c:	7f 1d                	jg     8032ab <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80328e:	83 ec 04             	sub    $0x4,%esp
+  803291:	53                   	push   %ebx
+  803292:	68 00 90 80 00       	push   $0x809000
+  803297:	ff 75 0c             	push   0xc(%ebp)
+  80329a:	e8 80 d8 ff ff       	call   800b1f <memmove>
+  80329f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8032a2:	89 d8                	mov    %ebx,%eax
+  8032a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a7:	5b                   	pop    %ebx
+  8032a8:	5e                   	pop    %esi
+  8032a9:	5d                   	pop    %ebp
+  8032aa:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8032ab:	68 b4 4f 80 00       	push   $0x804fb4
+  8032b0:	68 b1 4e 80 00       	push   $0x804eb1
+  8032b5:	6a 62                	push   $0x62
+  8032b7:	68 c9 4f 80 00       	push   $0x804fc9
+  8032bc:	e8 19 d0 ff ff       	call   8002da <_panic>
+
+008032c1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8032c1:	55                   	push   %ebp
+  8032c2:	89 e5                	mov    %esp,%ebp
+  8032c4:	53                   	push   %ebx
+  8032c5:	83 ec 04             	sub    $0x4,%esp
+  8032c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8032cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ce:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8032d3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8032d9:	7f 2e                	jg     803309 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8032db:	83 ec 04             	sub    $0x4,%esp
+  8032de:	53                   	push   %ebx
+  8032df:	ff 75 0c             	push   0xc(%ebp)
+  8032e2:	68 0c 90 80 00       	push   $0x80900c
+  8032e7:	e8 33 d8 ff ff       	call   800b1f <memmove>
+	nsipcbuf.send.req_size = size;
+  8032ec:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  8032f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032f5:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  8032fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8032ff:	e8 e8 fd ff ff       	call   8030ec <nsipc>
+}
+  803304:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803307:	c9                   	leave
+  803308:	c3                   	ret
+	assert(size < 1600);
+  803309:	68 d5 4f 80 00       	push   $0x804fd5
+  80330e:	68 b1 4e 80 00       	push   $0x804eb1
+  803313:	6a 6d                	push   $0x6d
+  803315:	68 c9 4f 80 00       	push   $0x804fc9
+  80331a:	e8 bb cf ff ff       	call   8002da <_panic>
+
+0080331f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+  803322:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803325:	8b 45 08             	mov    0x8(%ebp),%eax
+  803328:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80332d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803330:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803335:	8b 45 10             	mov    0x10(%ebp),%eax
+  803338:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  80333d:	b8 09 00 00 00       	mov    $0x9,%eax
+  803342:	e8 a5 fd ff ff       	call   8030ec <nsipc>
+}
+  803347:	c9                   	leave
+  803348:	c3                   	ret
+
+00803349 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803349:	55                   	push   %ebp
+  80334a:	89 e5                	mov    %esp,%ebp
+  80334c:	53                   	push   %ebx
+  80334d:	83 ec 10             	sub    $0x10,%esp
+  803350:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803353:	68 0c 70 80 00       	push   $0x80700c
+  803358:	e8 50 07 00 00       	call   803aad <mutex_lock>
+	if (v == 0)
+  80335d:	83 c4 10             	add    $0x10,%esp
+  803360:	85 db                	test   %ebx,%ebx
+  803362:	0f 84 85 00 00 00    	je     8033ed <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803368:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80336e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803373:	77 51                	ja     8033c6 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803375:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80337b:	89 d8                	mov    %ebx,%eax
+  80337d:	c1 e8 0c             	shr    $0xc,%eax
+  803380:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803387:	f6 c4 02             	test   $0x2,%ah
+  80338a:	74 50                	je     8033dc <free+0x93>
+		sys_page_unmap(0, c);
+  80338c:	83 ec 08             	sub    $0x8,%esp
+  80338f:	53                   	push   %ebx
+  803390:	6a 00                	push   $0x0
+  803392:	e8 d9 da ff ff       	call   800e70 <sys_page_unmap>
+		c += PGSIZE;
+  803397:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80339d:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8033a3:	83 c4 10             	add    $0x10,%esp
+  8033a6:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8033ab:	76 ce                	jbe    80337b <free+0x32>
+  8033ad:	68 1f 50 80 00       	push   $0x80501f
+  8033b2:	68 b1 4e 80 00       	push   $0x804eb1
+  8033b7:	68 82 00 00 00       	push   $0x82
+  8033bc:	68 12 50 80 00       	push   $0x805012
+  8033c1:	e8 14 cf ff ff       	call   8002da <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8033c6:	68 e4 4f 80 00       	push   $0x804fe4
+  8033cb:	68 b1 4e 80 00       	push   $0x804eb1
+  8033d0:	6a 7b                	push   $0x7b
+  8033d2:	68 12 50 80 00       	push   $0x805012
+  8033d7:	e8 fe ce ff ff       	call   8002da <_panic>
+	if (--(*ref) == 0)
+  8033dc:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8033e2:	83 e8 01             	sub    $0x1,%eax
+  8033e5:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8033eb:	74 15                	je     803402 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8033ed:	83 ec 0c             	sub    $0xc,%esp
+  8033f0:	68 0c 70 80 00       	push   $0x80700c
+  8033f5:	e8 20 07 00 00       	call   803b1a <mutex_unlock>
+}
+  8033fa:	83 c4 10             	add    $0x10,%esp
+  8033fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803400:	c9                   	leave
+  803401:	c3                   	ret
+		sys_page_unmap(0, c);
+  803402:	83 ec 08             	sub    $0x8,%esp
+  803405:	53                   	push   %ebx
+  803406:	6a 00                	push   $0x0
+  803408:	e8 63 da ff ff       	call   800e70 <sys_page_unmap>
+  80340d:	83 c4 10             	add    $0x10,%esp
+  803410:	eb db                	jmp    8033ed <free+0xa4>
+
+00803412 <malloc>:
+{
+  803412:	55                   	push   %ebp
+  803413:	89 e5                	mov    %esp,%ebp
+  803415:	57                   	push   %edi
+  803416:	56                   	push   %esi
+  803417:	53                   	push   %ebx
+  803418:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80341b:	68 0c 70 80 00       	push   $0x80700c
+  803420:	e8 88 06 00 00       	call   803aad <mutex_lock>
+	if (mptr == 0)
+  803425:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  80342b:	83 c4 10             	add    $0x10,%esp
+  80342e:	85 ff                	test   %edi,%edi
+  803430:	74 6c                	je     80349e <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803432:	8b 45 08             	mov    0x8(%ebp),%eax
+  803435:	83 c0 03             	add    $0x3,%eax
+  803438:	83 e0 fc             	and    $0xfffffffc,%eax
+  80343b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80343d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803442:	0f 87 64 01 00 00    	ja     8035ac <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803448:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80344e:	74 30                	je     803480 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803450:	89 f9                	mov    %edi,%ecx
+  803452:	c1 e9 0c             	shr    $0xc,%ecx
+  803455:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803459:	c1 e8 0c             	shr    $0xc,%eax
+  80345c:	39 c1                	cmp    %eax,%ecx
+  80345e:	74 5f                	je     8034bf <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803460:	83 ec 0c             	sub    $0xc,%esp
+  803463:	57                   	push   %edi
+  803464:	e8 e0 fe ff ff       	call   803349 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803469:	a1 10 70 80 00       	mov    0x807010,%eax
+  80346e:	05 00 10 00 00       	add    $0x1000,%eax
+  803473:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803478:	a3 10 70 80 00       	mov    %eax,0x807010
+  80347d:	83 c4 10             	add    $0x10,%esp
+  803480:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803486:	ba 02 00 00 00       	mov    $0x2,%edx
+  80348b:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80348f:	8d 7e 04             	lea    0x4(%esi),%edi
+  803492:	89 cb                	mov    %ecx,%ebx
+  803494:	01 f9                	add    %edi,%ecx
+  803496:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803499:	e9 8b 00 00 00       	jmp    803529 <malloc+0x117>
+		mptr = mbegin;
+  80349e:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8034a5:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8034a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ab:	83 c0 03             	add    $0x3,%eax
+  8034ae:	83 e0 fc             	and    $0xfffffffc,%eax
+  8034b1:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8034b3:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8034b8:	76 c6                	jbe    803480 <malloc+0x6e>
+  8034ba:	e9 d6 00 00 00       	jmp    803595 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8034bf:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8034c5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8034ca:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8034ce:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8034d1:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  8034d6:	e9 ba 00 00 00       	jmp    803595 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034db:	05 00 10 00 00       	add    $0x1000,%eax
+  8034e0:	39 c8                	cmp    %ecx,%eax
+  8034e2:	0f 83 cb 00 00 00    	jae    8035b3 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8034e8:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8034ed:	77 22                	ja     803511 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8034ef:	89 c2                	mov    %eax,%edx
+  8034f1:	c1 ea 16             	shr    $0x16,%edx
+  8034f4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8034fb:	f6 c2 01             	test   $0x1,%dl
+  8034fe:	74 db                	je     8034db <malloc+0xc9>
+  803500:	89 c2                	mov    %eax,%edx
+  803502:	c1 ea 0c             	shr    $0xc,%edx
+  803505:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80350c:	f6 c2 01             	test   $0x1,%dl
+  80350f:	74 ca                	je     8034db <malloc+0xc9>
+		if (mptr == mend) {
+  803511:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803517:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80351d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803521:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803527:	74 04                	je     80352d <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803529:	89 d8                	mov    %ebx,%eax
+  80352b:	eb b3                	jmp    8034e0 <malloc+0xce>
+  80352d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803530:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803535:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803539:	83 ea 01             	sub    $0x1,%edx
+  80353c:	0f 85 50 ff ff ff    	jne    803492 <malloc+0x80>
+  803542:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803549:	00 00 08 
+				return 0;	/* out of address space */
+  80354c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803551:	eb 42                	jmp    803595 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803553:	85 db                	test   %ebx,%ebx
+  803555:	78 1e                	js     803575 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803557:	83 ec 08             	sub    $0x8,%esp
+  80355a:	89 d8                	mov    %ebx,%eax
+  80355c:	03 05 10 70 80 00    	add    0x807010,%eax
+  803562:	50                   	push   %eax
+  803563:	6a 00                	push   $0x0
+  803565:	e8 06 d9 ff ff       	call   800e70 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80356a:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	eb de                	jmp    803553 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803575:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357a:	eb 19                	jmp    803595 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80357c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80357f:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803585:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80358c:	00 
+	mptr += n;
+  80358d:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803590:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803595:	83 ec 0c             	sub    $0xc,%esp
+  803598:	68 0c 70 80 00       	push   $0x80700c
+  80359d:	e8 78 05 00 00       	call   803b1a <mutex_unlock>
+}
+  8035a2:	89 f8                	mov    %edi,%eax
+  8035a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035a7:	5b                   	pop    %ebx
+  8035a8:	5e                   	pop    %esi
+  8035a9:	5f                   	pop    %edi
+  8035aa:	5d                   	pop    %ebp
+  8035ab:	c3                   	ret
+		return 0;
+  8035ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b1:	eb e2                	jmp    803595 <malloc+0x183>
+  8035b3:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8035b7:	74 06                	je     8035bf <malloc+0x1ad>
+  8035b9:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8035bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035c4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8035c7:	39 fb                	cmp    %edi,%ebx
+  8035c9:	73 b1                	jae    80357c <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8035cb:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8035d1:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8035d4:	39 fe                	cmp    %edi,%esi
+  8035d6:	0f 92 c0             	setb   %al
+  8035d9:	0f b6 c0             	movzbl %al,%eax
+  8035dc:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8035df:	83 c8 07             	or     $0x7,%eax
+  8035e2:	50                   	push   %eax
+  8035e3:	89 d8                	mov    %ebx,%eax
+  8035e5:	03 05 10 70 80 00    	add    0x807010,%eax
+  8035eb:	50                   	push   %eax
+  8035ec:	6a 00                	push   $0x0
+  8035ee:	e8 e4 d7 ff ff       	call   800dd7 <sys_page_alloc>
+  8035f3:	83 c4 10             	add    $0x10,%esp
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	0f 88 55 ff ff ff    	js     803553 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8035fe:	89 f3                	mov    %esi,%ebx
+  803600:	eb c5                	jmp    8035c7 <malloc+0x1b5>
+
+00803602 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803602:	55                   	push   %ebp
+  803603:	89 e5                	mov    %esp,%ebp
+  803605:	56                   	push   %esi
+  803606:	53                   	push   %ebx
+  803607:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80360a:	83 ec 0c             	sub    $0xc,%esp
+  80360d:	ff 75 08             	push   0x8(%ebp)
+  803610:	e8 ea e2 ff ff       	call   8018ff <fd2data>
+  803615:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803617:	83 c4 08             	add    $0x8,%esp
+  80361a:	68 37 50 80 00       	push   $0x805037
+  80361f:	53                   	push   %ebx
+  803620:	e8 74 d3 ff ff       	call   800999 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803625:	8b 46 04             	mov    0x4(%esi),%eax
+  803628:	2b 06                	sub    (%esi),%eax
+  80362a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803630:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803637:	00 00 00 
+	stat->st_dev = &devpipe;
+  80363a:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803641:	62 80 00 
+	return 0;
+}
+  803644:	b8 00 00 00 00       	mov    $0x0,%eax
+  803649:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80364c:	5b                   	pop    %ebx
+  80364d:	5e                   	pop    %esi
+  80364e:	5d                   	pop    %ebp
+  80364f:	c3                   	ret
+
+00803650 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803655:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803659:	85 c9                	test   %ecx,%ecx
+  80365b:	75 01                	jne    80365e <pipewake+0xe>
+  80365d:	c3                   	ret
+{
+  80365e:	55                   	push   %ebp
+  80365f:	89 e5                	mov    %esp,%ebp
+  803661:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803664:	68 00 04 00 00       	push   $0x400
+  803669:	52                   	push   %edx
+  80366a:	e8 ac da ff ff       	call   80111b <sys_futex_wake>
+  80366f:	83 c4 10             	add    $0x10,%esp
+}
+  803672:	c9                   	leave
+  803673:	c3                   	ret
+
+00803674 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803674:	55                   	push   %ebp
+  803675:	89 e5                	mov    %esp,%ebp
+  803677:	56                   	push   %esi
+  803678:	53                   	push   %ebx
+  803679:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80367c:	83 ec 0c             	sub    $0xc,%esp
+  80367f:	56                   	push   %esi
+  803680:	e8 7a e2 ff ff       	call   8018ff <fd2data>
+  803685:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803687:	83 c4 08             	add    $0x8,%esp
+  80368a:	56                   	push   %esi
+  80368b:	6a 00                	push   $0x0
+  80368d:	e8 de d7 ff ff       	call   800e70 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803692:	8d 53 04             	lea    0x4(%ebx),%edx
+  803695:	8d 43 08             	lea    0x8(%ebx),%eax
+  803698:	e8 b3 ff ff ff       	call   803650 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80369d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8036a0:	89 da                	mov    %ebx,%edx
+  8036a2:	e8 a9 ff ff ff       	call   803650 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8036a7:	89 34 24             	mov    %esi,(%esp)
+  8036aa:	e8 50 e2 ff ff       	call   8018ff <fd2data>
+  8036af:	83 c4 08             	add    $0x8,%esp
+  8036b2:	50                   	push   %eax
+  8036b3:	6a 00                	push   $0x0
+  8036b5:	e8 b6 d7 ff ff       	call   800e70 <sys_page_unmap>
+}
+  8036ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036bd:	5b                   	pop    %ebx
+  8036be:	5e                   	pop    %esi
+  8036bf:	5d                   	pop    %ebp
+  8036c0:	c3                   	ret
+
+008036c1 <_pipeisclosed>:
+{
+  8036c1:	55                   	push   %ebp
+  8036c2:	89 e5                	mov    %esp,%ebp
+  8036c4:	57                   	push   %edi
+  8036c5:	56                   	push   %esi
+  8036c6:	53                   	push   %ebx
+  8036c7:	83 ec 1c             	sub    $0x1c,%esp
+  8036ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8036cd:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036cf:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8036d4:	eb 5d                	jmp    803733 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8036d6:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8036dc:	8b 02                	mov    (%edx),%eax
+  8036de:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8036e1:	83 ec 0c             	sub    $0xc,%esp
+  8036e4:	ff 75 e0             	push   -0x20(%ebp)
+  8036e7:	e8 30 0f 00 00       	call   80461c <pageref>
+  8036ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036ef:	89 3c 24             	mov    %edi,(%esp)
+  8036f2:	e8 25 0f 00 00       	call   80461c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8036f7:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036f9:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8036ff:	83 c4 10             	add    $0x10,%esp
+  803702:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803708:	77 15                	ja     80371f <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80370a:	89 f2                	mov    %esi,%edx
+  80370c:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80370e:	c1 ea 10             	shr    $0x10,%edx
+  803711:	74 0c                	je     80371f <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803713:	c1 e2 10             	shl    $0x10,%edx
+  803716:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80371b:	29 d1                	sub    %edx,%ecx
+  80371d:	eb 06                	jmp    803725 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80371f:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803725:	8b 11                	mov    (%ecx),%edx
+  803727:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80372a:	39 d3                	cmp    %edx,%ebx
+  80372c:	74 6e                	je     80379c <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80372e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803731:	74 24                	je     803757 <_pipeisclosed+0x96>
+  803733:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803735:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80373b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803740:	77 94                	ja     8036d6 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803742:	89 f0                	mov    %esi,%eax
+  803744:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803746:	c1 e8 10             	shr    $0x10,%eax
+  803749:	74 8b                	je     8036d6 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80374b:	c1 e0 10             	shl    $0x10,%eax
+  80374e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803753:	29 c2                	sub    %eax,%edx
+  803755:	eb 85                	jmp    8036dc <_pipeisclosed+0x1b>
+  803757:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803759:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80375f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803764:	77 18                	ja     80377e <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803766:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80376b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80376d:	c1 e8 10             	shr    $0x10,%eax
+  803770:	74 0c                	je     80377e <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803772:	c1 e0 10             	shl    $0x10,%eax
+  803775:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80377a:	29 c2                	sub    %eax,%edx
+  80377c:	eb 06                	jmp    803784 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80377e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803784:	8b 02                	mov    (%edx),%eax
+  803786:	8b 40 58             	mov    0x58(%eax),%eax
+  803789:	6a 01                	push   $0x1
+  80378b:	50                   	push   %eax
+  80378c:	53                   	push   %ebx
+  80378d:	68 3e 50 80 00       	push   $0x80503e
+  803792:	e8 1e cc ff ff       	call   8003b5 <cprintf>
+  803797:	83 c4 10             	add    $0x10,%esp
+  80379a:	eb 97                	jmp    803733 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80379c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80379f:	0f 94 c0             	sete   %al
+  8037a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8037a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037a8:	5b                   	pop    %ebx
+  8037a9:	5e                   	pop    %esi
+  8037aa:	5f                   	pop    %edi
+  8037ab:	5d                   	pop    %ebp
+  8037ac:	c3                   	ret
+
+008037ad <devpipe_write>:
+{
+  8037ad:	55                   	push   %ebp
+  8037ae:	89 e5                	mov    %esp,%ebp
+  8037b0:	57                   	push   %edi
+  8037b1:	56                   	push   %esi
+  8037b2:	53                   	push   %ebx
+  8037b3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8037b6:	ff 75 08             	push   0x8(%ebp)
+  8037b9:	e8 41 e1 ff ff       	call   8018ff <fd2data>
+  8037be:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037c0:	83 c4 10             	add    $0x10,%esp
+  8037c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8037ca:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8037cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037d0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8037d3:	0f 84 96 00 00 00    	je     80386f <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8037d9:	8d 73 08             	lea    0x8(%ebx),%esi
+  8037dc:	eb 32                	jmp    803810 <devpipe_write+0x63>
+  8037de:	89 fa                	mov    %edi,%edx
+  8037e0:	89 f0                	mov    %esi,%eax
+  8037e2:	e8 69 fe ff ff       	call   803650 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8037e7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037ea:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8037ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037f2:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8037f7:	83 ec 04             	sub    $0x4,%esp
+  8037fa:	6a 0a                	push   $0xa
+  8037fc:	50                   	push   %eax
+  8037fd:	53                   	push   %ebx
+  8037fe:	e8 e9 d8 ff ff       	call   8010ec <sys_futex_wait>
+  803803:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803808:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80380d:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803810:	8b 43 04             	mov    0x4(%ebx),%eax
+  803813:	8b 0b                	mov    (%ebx),%ecx
+  803815:	8d 51 20             	lea    0x20(%ecx),%edx
+  803818:	39 d0                	cmp    %edx,%eax
+  80381a:	72 1b                	jb     803837 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80381c:	89 da                	mov    %ebx,%edx
+  80381e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803821:	e8 9b fe ff ff       	call   8036c1 <_pipeisclosed>
+  803826:	85 c0                	test   %eax,%eax
+  803828:	74 b4                	je     8037de <devpipe_write+0x31>
+				return 0;
+  80382a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80382f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803832:	5b                   	pop    %ebx
+  803833:	5e                   	pop    %esi
+  803834:	5f                   	pop    %edi
+  803835:	5d                   	pop    %ebp
+  803836:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803837:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80383a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80383d:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803841:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803844:	89 c2                	mov    %eax,%edx
+  803846:	c1 fa 1f             	sar    $0x1f,%edx
+  803849:	89 d1                	mov    %edx,%ecx
+  80384b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80384e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803851:	83 e2 1f             	and    $0x1f,%edx
+  803854:	29 ca                	sub    %ecx,%edx
+  803856:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80385a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80385e:	83 c0 01             	add    $0x1,%eax
+  803861:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803864:	83 c6 01             	add    $0x1,%esi
+  803867:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80386a:	e9 5e ff ff ff       	jmp    8037cd <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80386f:	8d 53 04             	lea    0x4(%ebx),%edx
+  803872:	8d 43 08             	lea    0x8(%ebx),%eax
+  803875:	e8 d6 fd ff ff       	call   803650 <pipewake>
+	return i;
+  80387a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80387d:	eb b0                	jmp    80382f <devpipe_write+0x82>
+
+0080387f <devpipe_read>:
+{
+  80387f:	55                   	push   %ebp
+  803880:	89 e5                	mov    %esp,%ebp
+  803882:	57                   	push   %edi
+  803883:	56                   	push   %esi
+  803884:	53                   	push   %ebx
+  803885:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803888:	ff 75 08             	push   0x8(%ebp)
+  80388b:	e8 6f e0 ff ff       	call   8018ff <fd2data>
+  803890:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	be 00 00 00 00       	mov    $0x0,%esi
+  80389a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80389d:	74 6c                	je     80390b <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80389f:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8038a2:	eb 25                	jmp    8038c9 <devpipe_read+0x4a>
+  8038a4:	8b 13                	mov    (%ebx),%edx
+  8038a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038ab:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8038b0:	83 ec 04             	sub    $0x4,%esp
+  8038b3:	6a 0a                	push   $0xa
+  8038b5:	52                   	push   %edx
+  8038b6:	57                   	push   %edi
+  8038b7:	e8 30 d8 ff ff       	call   8010ec <sys_futex_wait>
+  8038bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8038c1:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8038c6:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8038c9:	8b 03                	mov    (%ebx),%eax
+  8038cb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8038ce:	75 19                	jne    8038e9 <devpipe_read+0x6a>
+			if (i > 0)
+  8038d0:	85 f6                	test   %esi,%esi
+  8038d2:	75 3a                	jne    80390e <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8038d4:	89 da                	mov    %ebx,%edx
+  8038d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038d9:	e8 e3 fd ff ff       	call   8036c1 <_pipeisclosed>
+  8038de:	85 c0                	test   %eax,%eax
+  8038e0:	74 c2                	je     8038a4 <devpipe_read+0x25>
+				return 0;
+  8038e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e7:	eb 31                	jmp    80391a <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038e9:	89 c1                	mov    %eax,%ecx
+  8038eb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8038ee:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038f1:	01 c8                	add    %ecx,%eax
+  8038f3:	83 e0 1f             	and    $0x1f,%eax
+  8038f6:	29 c8                	sub    %ecx,%eax
+  8038f8:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8038fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803900:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803903:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803906:	83 c6 01             	add    $0x1,%esi
+  803909:	eb 8f                	jmp    80389a <devpipe_read+0x1b>
+out:
+  80390b:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80390e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803911:	89 da                	mov    %ebx,%edx
+  803913:	e8 38 fd ff ff       	call   803650 <pipewake>
+	return i;
+  803918:	89 f0                	mov    %esi,%eax
+}
+  80391a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80391d:	5b                   	pop    %ebx
+  80391e:	5e                   	pop    %esi
+  80391f:	5f                   	pop    %edi
+  803920:	5d                   	pop    %ebp
+  803921:	c3                   	ret
+
+00803922 <pipe>:
+{
+  803922:	55                   	push   %ebp
+  803923:	89 e5                	mov    %esp,%ebp
+  803925:	56                   	push   %esi
+  803926:	53                   	push   %ebx
+  803927:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80392a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80392d:	50                   	push   %eax
+  80392e:	e8 e3 df ff ff       	call   801916 <fd_alloc>
+  803933:	89 c3                	mov    %eax,%ebx
+  803935:	83 c4 10             	add    $0x10,%esp
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	0f 88 23 01 00 00    	js     803a63 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803940:	83 ec 04             	sub    $0x4,%esp
+  803943:	68 07 04 00 00       	push   $0x407
+  803948:	ff 75 f4             	push   -0xc(%ebp)
+  80394b:	6a 00                	push   $0x0
+  80394d:	e8 85 d4 ff ff       	call   800dd7 <sys_page_alloc>
+  803952:	89 c3                	mov    %eax,%ebx
+  803954:	83 c4 10             	add    $0x10,%esp
+  803957:	85 c0                	test   %eax,%eax
+  803959:	0f 88 04 01 00 00    	js     803a63 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80395f:	83 ec 0c             	sub    $0xc,%esp
+  803962:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803965:	50                   	push   %eax
+  803966:	e8 ab df ff ff       	call   801916 <fd_alloc>
+  80396b:	89 c3                	mov    %eax,%ebx
+  80396d:	83 c4 10             	add    $0x10,%esp
+  803970:	85 c0                	test   %eax,%eax
+  803972:	0f 88 db 00 00 00    	js     803a53 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803978:	83 ec 04             	sub    $0x4,%esp
+  80397b:	68 07 04 00 00       	push   $0x407
+  803980:	ff 75 f0             	push   -0x10(%ebp)
+  803983:	6a 00                	push   $0x0
+  803985:	e8 4d d4 ff ff       	call   800dd7 <sys_page_alloc>
+  80398a:	89 c3                	mov    %eax,%ebx
+  80398c:	83 c4 10             	add    $0x10,%esp
+  80398f:	85 c0                	test   %eax,%eax
+  803991:	0f 88 bc 00 00 00    	js     803a53 <pipe+0x131>
+	va = fd2data(fd0);
+  803997:	83 ec 0c             	sub    $0xc,%esp
+  80399a:	ff 75 f4             	push   -0xc(%ebp)
+  80399d:	e8 5d df ff ff       	call   8018ff <fd2data>
+  8039a2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039a4:	83 c4 0c             	add    $0xc,%esp
+  8039a7:	68 07 04 00 00       	push   $0x407
+  8039ac:	50                   	push   %eax
+  8039ad:	6a 00                	push   $0x0
+  8039af:	e8 23 d4 ff ff       	call   800dd7 <sys_page_alloc>
+  8039b4:	89 c3                	mov    %eax,%ebx
+  8039b6:	83 c4 10             	add    $0x10,%esp
+  8039b9:	85 c0                	test   %eax,%eax
+  8039bb:	0f 88 82 00 00 00    	js     803a43 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039c1:	83 ec 0c             	sub    $0xc,%esp
+  8039c4:	ff 75 f0             	push   -0x10(%ebp)
+  8039c7:	e8 33 df ff ff       	call   8018ff <fd2data>
+  8039cc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8039d3:	50                   	push   %eax
+  8039d4:	6a 00                	push   $0x0
+  8039d6:	56                   	push   %esi
+  8039d7:	6a 00                	push   $0x0
+  8039d9:	e8 46 d4 ff ff       	call   800e24 <sys_page_map>
+  8039de:	89 c3                	mov    %eax,%ebx
+  8039e0:	83 c4 20             	add    $0x20,%esp
+  8039e3:	85 c0                	test   %eax,%eax
+  8039e5:	78 4e                	js     803a35 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8039e7:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  8039ec:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8039ef:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8039f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8039f4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8039fb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8039fe:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a03:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a0a:	83 ec 0c             	sub    $0xc,%esp
+  803a0d:	ff 75 f4             	push   -0xc(%ebp)
+  803a10:	e8 da de ff ff       	call   8018ef <fd2num>
+  803a15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a18:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a1a:	83 c4 04             	add    $0x4,%esp
+  803a1d:	ff 75 f0             	push   -0x10(%ebp)
+  803a20:	e8 ca de ff ff       	call   8018ef <fd2num>
+  803a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a28:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803a2b:	83 c4 10             	add    $0x10,%esp
+  803a2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a33:	eb 2e                	jmp    803a63 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a35:	83 ec 08             	sub    $0x8,%esp
+  803a38:	56                   	push   %esi
+  803a39:	6a 00                	push   $0x0
+  803a3b:	e8 30 d4 ff ff       	call   800e70 <sys_page_unmap>
+  803a40:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803a43:	83 ec 08             	sub    $0x8,%esp
+  803a46:	ff 75 f0             	push   -0x10(%ebp)
+  803a49:	6a 00                	push   $0x0
+  803a4b:	e8 20 d4 ff ff       	call   800e70 <sys_page_unmap>
+  803a50:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803a53:	83 ec 08             	sub    $0x8,%esp
+  803a56:	ff 75 f4             	push   -0xc(%ebp)
+  803a59:	6a 00                	push   $0x0
+  803a5b:	e8 10 d4 ff ff       	call   800e70 <sys_page_unmap>
+  803a60:	83 c4 10             	add    $0x10,%esp
+}
+  803a63:	89 d8                	mov    %ebx,%eax
+  803a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a68:	5b                   	pop    %ebx
+  803a69:	5e                   	pop    %esi
+  803a6a:	5d                   	pop    %ebp
+  803a6b:	c3                   	ret
+
+00803a6c <pipeisclosed>:
+{
+  803a6c:	55                   	push   %ebp
+  803a6d:	89 e5                	mov    %esp,%ebp
+  803a6f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a75:	50                   	push   %eax
+  803a76:	ff 75 08             	push   0x8(%ebp)
+  803a79:	e8 ee de ff ff       	call   80196c <fd_lookup>
+  803a7e:	83 c4 10             	add    $0x10,%esp
+  803a81:	85 c0                	test   %eax,%eax
+  803a83:	78 18                	js     803a9d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a85:	83 ec 0c             	sub    $0xc,%esp
+  803a88:	ff 75 f4             	push   -0xc(%ebp)
+  803a8b:	e8 6f de ff ff       	call   8018ff <fd2data>
+  803a90:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a95:	e8 27 fc ff ff       	call   8036c1 <_pipeisclosed>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+}
+  803a9d:	c9                   	leave
+  803a9e:	c3                   	ret
+
+00803a9f <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803a9f:	55                   	push   %ebp
+  803aa0:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803aab:	5d                   	pop    %ebp
+  803aac:	c3                   	ret
+
+00803aad <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803aad:	55                   	push   %ebp
+  803aae:	89 e5                	mov    %esp,%ebp
+  803ab0:	56                   	push   %esi
+  803ab1:	53                   	push   %ebx
+  803ab2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ab5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803abf:	89 d0                	mov    %edx,%eax
+  803ac1:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803ac5:	85 c0                	test   %eax,%eax
+  803ac7:	74 2d                	je     803af6 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803ac9:	83 f8 02             	cmp    $0x2,%eax
+  803acc:	74 08                	je     803ad6 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803ace:	b8 02 00 00 00       	mov    $0x2,%eax
+  803ad3:	f0 87 03             	lock xchg %eax,(%ebx)
+  803ad6:	be 02 00 00 00       	mov    $0x2,%esi
+  803adb:	eb 15                	jmp    803af2 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803add:	83 ec 04             	sub    $0x4,%esp
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	6a 02                	push   $0x2
+  803ae4:	53                   	push   %ebx
+  803ae5:	e8 02 d6 ff ff       	call   8010ec <sys_futex_wait>
+  803aea:	89 f0                	mov    %esi,%eax
+  803aec:	f0 87 03             	lock xchg %eax,(%ebx)
+  803aef:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803af2:	85 c0                	test   %eax,%eax
+  803af4:	75 e7                	jne    803add <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803af6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803af9:	5b                   	pop    %ebx
+  803afa:	5e                   	pop    %esi
+  803afb:	5d                   	pop    %ebp
+  803afc:	c3                   	ret
+
+00803afd <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803afd:	55                   	push   %ebp
+  803afe:	89 e5                	mov    %esp,%ebp
+  803b00:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b08:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b0d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803b11:	f7 d8                	neg    %eax
+  803b13:	19 c0                	sbb    %eax,%eax
+  803b15:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803b18:	5d                   	pop    %ebp
+  803b19:	c3                   	ret
+
+00803b1a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803b1a:	55                   	push   %ebp
+  803b1b:	89 e5                	mov    %esp,%ebp
+  803b1d:	83 ec 08             	sub    $0x8,%esp
+  803b20:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b28:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803b2b:	83 f8 02             	cmp    $0x2,%eax
+  803b2e:	74 02                	je     803b32 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803b30:	c9                   	leave
+  803b31:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803b32:	83 ec 08             	sub    $0x8,%esp
+  803b35:	6a 01                	push   $0x1
+  803b37:	52                   	push   %edx
+  803b38:	e8 de d5 ff ff       	call   80111b <sys_futex_wake>
+  803b3d:	83 c4 10             	add    $0x10,%esp
+}
+  803b40:	eb ee                	jmp    803b30 <mutex_unlock+0x16>
+
+00803b42 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803b42:	55                   	push   %ebp
+  803b43:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b48:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b4e:	5d                   	pop    %ebp
+  803b4f:	c3                   	ret
+
+00803b50 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803b50:	55                   	push   %ebp
+  803b51:	89 e5                	mov    %esp,%ebp
+  803b53:	57                   	push   %edi
+  803b54:	56                   	push   %esi
+  803b55:	53                   	push   %ebx
+  803b56:	83 ec 18             	sub    $0x18,%esp
+  803b59:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803b5f:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803b61:	53                   	push   %ebx
+  803b62:	e8 b3 ff ff ff       	call   803b1a <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803b67:	83 c4 0c             	add    $0xc,%esp
+  803b6a:	ff 75 10             	push   0x10(%ebp)
+  803b6d:	57                   	push   %edi
+  803b6e:	56                   	push   %esi
+  803b6f:	e8 78 d5 ff ff       	call   8010ec <sys_futex_wait>
+  803b74:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803b76:	83 c4 10             	add    $0x10,%esp
+  803b79:	be 02 00 00 00       	mov    $0x2,%esi
+  803b7e:	eb 10                	jmp    803b90 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b80:	83 ec 04             	sub    $0x4,%esp
+  803b83:	6a 00                	push   $0x0
+  803b85:	6a 02                	push   $0x2
+  803b87:	53                   	push   %ebx
+  803b88:	e8 5f d5 ff ff       	call   8010ec <sys_futex_wait>
+  803b8d:	83 c4 10             	add    $0x10,%esp
+  803b90:	89 f0                	mov    %esi,%eax
+  803b92:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803b95:	85 c0                	test   %eax,%eax
+  803b97:	75 e7                	jne    803b80 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803b99:	83 ff ec             	cmp    $0xffffffec,%edi
+  803b9c:	74 05                	je     803ba3 <cond_timedwait+0x53>
+  803b9e:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ba3:	89 f8                	mov    %edi,%eax
+  803ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba8:	5b                   	pop    %ebx
+  803ba9:	5e                   	pop    %esi
+  803baa:	5f                   	pop    %edi
+  803bab:	5d                   	pop    %ebp
+  803bac:	c3                   	ret
+
+00803bad <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803bad:	55                   	push   %ebp
+  803bae:	89 e5                	mov    %esp,%ebp
+  803bb0:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803bb3:	6a 00                	push   $0x0
+  803bb5:	ff 75 0c             	push   0xc(%ebp)
+  803bb8:	ff 75 08             	push   0x8(%ebp)
+  803bbb:	e8 90 ff ff ff       	call   803b50 <cond_timedwait>
+}
+  803bc0:	83 c4 10             	add    $0x10,%esp
+  803bc3:	c9                   	leave
+  803bc4:	c3                   	ret
+
+00803bc5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803bc5:	55                   	push   %ebp
+  803bc6:	89 e5                	mov    %esp,%ebp
+  803bc8:	83 ec 10             	sub    $0x10,%esp
+  803bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803bce:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bd3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803bd7:	6a 01                	push   $0x1
+  803bd9:	50                   	push   %eax
+  803bda:	e8 3c d5 ff ff       	call   80111b <sys_futex_wake>
+}
+  803bdf:	83 c4 10             	add    $0x10,%esp
+  803be2:	c9                   	leave
+  803be3:	c3                   	ret
+
+00803be4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803be4:	55                   	push   %ebp
+  803be5:	89 e5                	mov    %esp,%ebp
+  803be7:	83 ec 10             	sub    $0x10,%esp
+  803bea:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bed:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bf2:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803bf6:	68 00 04 00 00       	push   $0x400
+  803bfb:	50                   	push   %eax
+  803bfc:	e8 1a d5 ff ff       	call   80111b <sys_futex_wake>
+}
+  803c01:	83 c4 10             	add    $0x10,%esp
+  803c04:	c9                   	leave
+  803c05:	c3                   	ret
+
+00803c06 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803c06:	55                   	push   %ebp
+  803c07:	89 e5                	mov    %esp,%ebp
+  803c09:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c0f:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803c11:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803c18:	5d                   	pop    %ebp
+  803c19:	c3                   	ret
+
+00803c1a <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803c1a:	55                   	push   %ebp
+  803c1b:	89 e5                	mov    %esp,%ebp
+  803c1d:	53                   	push   %ebx
+  803c1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803c21:	8b 11                	mov    (%ecx),%edx
+  803c23:	85 d2                	test   %edx,%edx
+  803c25:	74 14                	je     803c3b <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803c27:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c2a:	89 d0                	mov    %edx,%eax
+  803c2c:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803c30:	39 c2                	cmp    %eax,%edx
+  803c32:	75 ed                	jne    803c21 <sem_trywait+0x7>
+			return 0;
+  803c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c39:	eb 05                	jmp    803c40 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803c3b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c43:	c9                   	leave
+  803c44:	c3                   	ret
+
+00803c45 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803c45:	55                   	push   %ebp
+  803c46:	89 e5                	mov    %esp,%ebp
+  803c48:	57                   	push   %edi
+  803c49:	56                   	push   %esi
+  803c4a:	53                   	push   %ebx
+  803c4b:	83 ec 1c             	sub    $0x1c,%esp
+  803c4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c51:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803c54:	e8 0b d4 ff ff       	call   801064 <sys_time_msec>
+  803c59:	01 f8                	add    %edi,%eax
+  803c5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803c5e:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803c63:	eb 28                	jmp    803c8d <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803c65:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c6a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803c6f:	83 ec 04             	sub    $0x4,%esp
+  803c72:	56                   	push   %esi
+  803c73:	6a 00                	push   $0x0
+  803c75:	53                   	push   %ebx
+  803c76:	e8 71 d4 ff ff       	call   8010ec <sys_futex_wait>
+  803c7b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803c80:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803c85:	83 c4 10             	add    $0x10,%esp
+  803c88:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803c8b:	74 2e                	je     803cbb <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803c8d:	83 ec 0c             	sub    $0xc,%esp
+  803c90:	53                   	push   %ebx
+  803c91:	e8 84 ff ff ff       	call   803c1a <sem_trywait>
+  803c96:	83 c4 10             	add    $0x10,%esp
+  803c99:	85 c0                	test   %eax,%eax
+  803c9b:	79 19                	jns    803cb6 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803c9d:	85 ff                	test   %edi,%edi
+  803c9f:	74 c4                	je     803c65 <sem_timedwait+0x20>
+  803ca1:	e8 be d3 ff ff       	call   801064 <sys_time_msec>
+  803ca6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803ca9:	29 c6                	sub    %eax,%esi
+  803cab:	85 f6                	test   %esi,%esi
+  803cad:	7f b6                	jg     803c65 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803caf:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803cb4:	eb 05                	jmp    803cbb <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cbe:	5b                   	pop    %ebx
+  803cbf:	5e                   	pop    %esi
+  803cc0:	5f                   	pop    %edi
+  803cc1:	5d                   	pop    %ebp
+  803cc2:	c3                   	ret
+
+00803cc3 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803cc3:	55                   	push   %ebp
+  803cc4:	89 e5                	mov    %esp,%ebp
+  803cc6:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803cc9:	6a 00                	push   $0x0
+  803ccb:	ff 75 08             	push   0x8(%ebp)
+  803cce:	e8 72 ff ff ff       	call   803c45 <sem_timedwait>
+}
+  803cd3:	83 c4 10             	add    $0x10,%esp
+  803cd6:	c9                   	leave
+  803cd7:	c3                   	ret
+
+00803cd8 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803cd8:	55                   	push   %ebp
+  803cd9:	89 e5                	mov    %esp,%ebp
+  803cdb:	83 ec 08             	sub    $0x8,%esp
+  803cde:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ce1:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ce6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803cea:	8b 50 04             	mov    0x4(%eax),%edx
+  803ced:	85 d2                	test   %edx,%edx
+  803cef:	75 02                	jne    803cf3 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803cf1:	c9                   	leave
+  803cf2:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803cf3:	83 ec 08             	sub    $0x8,%esp
+  803cf6:	6a 01                	push   $0x1
+  803cf8:	50                   	push   %eax
+  803cf9:	e8 1d d4 ff ff       	call   80111b <sys_futex_wake>
+  803cfe:	83 c4 10             	add    $0x10,%esp
+}
+  803d01:	eb ee                	jmp    803cf1 <sem_post+0x19>
+
+00803d03 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803d03:	55                   	push   %ebp
+  803d04:	89 e5                	mov    %esp,%ebp
+  803d06:	57                   	push   %edi
+  803d07:	56                   	push   %esi
+  803d08:	53                   	push   %ebx
+  803d09:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803d0c:	68 20 70 80 00       	push   $0x807020
+  803d11:	e8 97 fd ff ff       	call   803aad <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803d16:	a1 44 70 80 00       	mov    0x807044,%eax
+  803d1b:	83 c4 10             	add    $0x10,%esp
+  803d1e:	85 c0                	test   %eax,%eax
+  803d20:	75 19                	jne    803d3b <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803d22:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803d27:	8b 00                	mov    (%eax),%eax
+  803d29:	8b 40 48             	mov    0x48(%eax),%eax
+  803d2c:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803d31:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803d38:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d3b:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803d40:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d43:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d4a:	8b 40 04             	mov    0x4(%eax),%eax
+  803d4d:	85 c0                	test   %eax,%eax
+  803d4f:	0f 84 e4 00 00 00    	je     803e39 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d55:	83 c3 01             	add    $0x1,%ebx
+  803d58:	83 fb 20             	cmp    $0x20,%ebx
+  803d5b:	75 e3                	jne    803d40 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803d5d:	83 ec 0c             	sub    $0xc,%esp
+  803d60:	68 20 70 80 00       	push   $0x807020
+  803d65:	e8 b0 fd ff ff       	call   803b1a <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803d6a:	83 c4 10             	add    $0x10,%esp
+  803d6d:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803d72:	e9 b8 00 00 00       	jmp    803e2f <pthread_create+0x12c>
+  803d77:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803d7a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803d7d:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803d7f:	39 f3                	cmp    %esi,%ebx
+  803d81:	73 16                	jae    803d99 <pthread_create+0x96>
+		va -= PGSIZE;
+  803d83:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803d89:	83 ec 08             	sub    $0x8,%esp
+  803d8c:	56                   	push   %esi
+  803d8d:	6a 00                	push   $0x0
+  803d8f:	e8 dc d0 ff ff       	call   800e70 <sys_page_unmap>
+  803d94:	83 c4 10             	add    $0x10,%esp
+  803d97:	eb e6                	jmp    803d7f <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803d99:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803d9c:	83 ec 08             	sub    $0x8,%esp
+  803d9f:	ff 75 e4             	push   -0x1c(%ebp)
+  803da2:	6a 00                	push   $0x0
+  803da4:	e8 c7 d0 ff ff       	call   800e70 <sys_page_unmap>
+	return r;
+  803da9:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803dac:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803daf:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803db6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803dbd:	eb 70                	jmp    803e2f <pthread_create+0x12c>
+	th->th_fn = fn;
+  803dbf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dc2:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803dc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dcc:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803dcf:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dd2:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803dd5:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803ddc:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803de1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803de4:	29 c8                	sub    %ecx,%eax
+  803de6:	85 db                	test   %ebx,%ebx
+  803de8:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803def:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803df2:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803df9:	83 ec 04             	sub    $0x4,%esp
+  803dfc:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803e01:	29 ca                	sub    %ecx,%edx
+  803e03:	52                   	push   %edx
+	*--esp = 0;
+  803e04:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e07:	50                   	push   %eax
+  803e08:	68 60 40 80 00       	push   $0x804060
+  803e0d:	e8 ae d3 ff ff       	call   8011c0 <sys_thread_create>
+  803e12:	89 c7                	mov    %eax,%edi
+  803e14:	83 c4 10             	add    $0x10,%esp
+  803e17:	85 c0                	test   %eax,%eax
+  803e19:	78 91                	js     803dac <pthread_create+0xa9>
+	th->th_env = id;
+  803e1b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e1e:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e28:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803e2f:	89 f8                	mov    %edi,%eax
+  803e31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e34:	5b                   	pop    %ebx
+  803e35:	5e                   	pop    %esi
+  803e36:	5f                   	pop    %edi
+  803e37:	5d                   	pop    %ebp
+  803e38:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803e39:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e3c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e43:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803e4a:	83 ec 0c             	sub    $0xc,%esp
+  803e4d:	68 20 70 80 00       	push   $0x807020
+  803e52:	e8 c3 fc ff ff       	call   803b1a <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803e57:	89 d9                	mov    %ebx,%ecx
+  803e59:	c1 e1 10             	shl    $0x10,%ecx
+  803e5c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803e5f:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803e64:	29 c8                	sub    %ecx,%eax
+  803e66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803e69:	c1 e8 16             	shr    $0x16,%eax
+  803e6c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e73:	83 c4 10             	add    $0x10,%esp
+  803e76:	a8 01                	test   $0x1,%al
+  803e78:	74 15                	je     803e8f <pthread_create+0x18c>
+  803e7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e7d:	c1 e8 0c             	shr    $0xc,%eax
+  803e80:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e87:	a8 01                	test   $0x1,%al
+  803e89:	0f 85 30 ff ff ff    	jne    803dbf <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e8f:	83 ec 04             	sub    $0x4,%esp
+  803e92:	6a 07                	push   $0x7
+  803e94:	ff 75 e4             	push   -0x1c(%ebp)
+  803e97:	6a 00                	push   $0x0
+  803e99:	e8 39 cf ff ff       	call   800dd7 <sys_page_alloc>
+  803e9e:	89 c7                	mov    %eax,%edi
+  803ea0:	83 c4 10             	add    $0x10,%esp
+  803ea3:	85 c0                	test   %eax,%eax
+  803ea5:	0f 88 01 ff ff ff    	js     803dac <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803eab:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803eb0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803eb3:	29 d0                	sub    %edx,%eax
+  803eb5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803eb8:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803eba:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803ebf:	29 d0                	sub    %edx,%eax
+  803ec1:	89 c7                	mov    %eax,%edi
+  803ec3:	39 fe                	cmp    %edi,%esi
+  803ec5:	0f 83 f4 fe ff ff    	jae    803dbf <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ecb:	83 ec 04             	sub    $0x4,%esp
+  803ece:	6a 07                	push   $0x7
+  803ed0:	56                   	push   %esi
+  803ed1:	6a 00                	push   $0x0
+  803ed3:	e8 ff ce ff ff       	call   800dd7 <sys_page_alloc>
+  803ed8:	83 c4 10             	add    $0x10,%esp
+  803edb:	85 c0                	test   %eax,%eax
+  803edd:	0f 88 94 fe ff ff    	js     803d77 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803ee3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ee9:	eb d8                	jmp    803ec3 <pthread_create+0x1c0>
+
+00803eeb <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803eeb:	55                   	push   %ebp
+  803eec:	89 e5                	mov    %esp,%ebp
+  803eee:	57                   	push   %edi
+  803eef:	56                   	push   %esi
+  803ef0:	53                   	push   %ebx
+  803ef1:	83 ec 0c             	sub    $0xc,%esp
+  803ef4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803ef7:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803efa:	83 f8 1e             	cmp    $0x1e,%eax
+  803efd:	0f 87 c7 00 00 00    	ja     803fca <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803f03:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f05:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f0b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f10:	77 12                	ja     803f24 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f12:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f17:	29 d0                	sub    %edx,%eax
+  803f19:	c1 e8 10             	shr    $0x10,%eax
+  803f1c:	39 c3                	cmp    %eax,%ebx
+  803f1e:	0f 84 ad 00 00 00    	je     803fd1 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f24:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f27:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f2e:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803f35:	eb 10                	jmp    803f47 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f37:	83 ec 04             	sub    $0x4,%esp
+  803f3a:	6a 00                	push   $0x0
+  803f3c:	6a 01                	push   $0x1
+  803f3e:	57                   	push   %edi
+  803f3f:	e8 a8 d1 ff ff       	call   8010ec <sys_futex_wait>
+  803f44:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f47:	8b 46 04             	mov    0x4(%esi),%eax
+  803f4a:	83 f8 01             	cmp    $0x1,%eax
+  803f4d:	74 e8                	je     803f37 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803f4f:	83 f8 02             	cmp    $0x2,%eax
+  803f52:	0f 85 80 00 00 00    	jne    803fd8 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f58:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803f5b:	c1 e6 02             	shl    $0x2,%esi
+  803f5e:	eb 05                	jmp    803f65 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803f60:	e8 46 ce ff ff       	call   800dab <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f65:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803f6b:	89 ca                	mov    %ecx,%edx
+  803f6d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803f73:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f76:	c1 e0 04             	shl    $0x4,%eax
+  803f79:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f7e:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803f81:	39 c1                	cmp    %eax,%ecx
+  803f83:	75 12                	jne    803f97 <pthread_join+0xac>
+  803f85:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f88:	c1 e0 04             	shl    $0x4,%eax
+  803f8b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f90:	8b 40 54             	mov    0x54(%eax),%eax
+  803f93:	85 c0                	test   %eax,%eax
+  803f95:	75 c9                	jne    803f60 <pthread_join+0x75>
+	if (ret_store)
+  803f97:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803f9b:	74 0f                	je     803fac <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803f9d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fa0:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803fa7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803faa:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803fac:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803faf:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fb6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fc5:	5b                   	pop    %ebx
+  803fc6:	5e                   	pop    %esi
+  803fc7:	5f                   	pop    %edi
+  803fc8:	5d                   	pop    %ebp
+  803fc9:	c3                   	ret
+		return -E_INVAL;
+  803fca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fcf:	eb f1                	jmp    803fc2 <pthread_join+0xd7>
+  803fd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fd6:	eb ea                	jmp    803fc2 <pthread_join+0xd7>
+		return -E_INVAL;
+  803fd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fdd:	eb e3                	jmp    803fc2 <pthread_join+0xd7>
+
+00803fdf <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803fdf:	55                   	push   %ebp
+  803fe0:	89 e5                	mov    %esp,%ebp
+  803fe2:	53                   	push   %ebx
+  803fe3:	83 ec 04             	sub    $0x4,%esp
+  803fe6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ff3:	77 0c                	ja     804001 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ff5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ffa:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803ffc:	c1 e8 10             	shr    $0x10,%eax
+  803fff:	75 0a                	jne    80400b <pthread_exit+0x2c>
+		exit();
+  804001:	e8 ac c2 ff ff       	call   8002b2 <exit>
+  804006:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80400b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804012:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804015:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  80401c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80401f:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  804022:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  804029:	83 ec 08             	sub    $0x8,%esp
+  80402c:	6a 20                	push   $0x20
+  80402e:	01 c2                	add    %eax,%edx
+  804030:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  804037:	50                   	push   %eax
+  804038:	e8 de d0 ff ff       	call   80111b <sys_futex_wake>
+	sys_env_destroy(0);
+  80403d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804044:	e8 eb cc ff ff       	call   800d34 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804049:	83 c4 0c             	add    $0xc,%esp
+  80404c:	68 51 50 80 00       	push   $0x805051
+  804051:	68 a5 00 00 00       	push   $0xa5
+  804056:	68 6b 50 80 00       	push   $0x80506b
+  80405b:	e8 7a c2 ff ff       	call   8002da <_panic>
+
+00804060 <pthread_start>:
+{
+  804060:	55                   	push   %ebp
+  804061:	89 e5                	mov    %esp,%ebp
+  804063:	53                   	push   %ebx
+  804064:	83 ec 04             	sub    $0x4,%esp
+  804067:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80406a:	e8 10 cd ff ff       	call   800d7f <sys_getenvid>
+  80406f:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804074:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  80407a:	85 db                	test   %ebx,%ebx
+  80407c:	74 0c                	je     80408a <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80407e:	89 d9                	mov    %ebx,%ecx
+  804080:	c1 e1 10             	shl    $0x10,%ecx
+  804083:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804088:	29 ca                	sub    %ecx,%edx
+  80408a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80408d:	c1 e0 04             	shl    $0x4,%eax
+  804090:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804095:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804097:	83 ec 0c             	sub    $0xc,%esp
+  80409a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8040a1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8040a4:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  8040ab:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  8040b2:	89 04 24             	mov    %eax,(%esp)
+  8040b5:	e8 25 ff ff ff       	call   803fdf <pthread_exit>
+
+008040ba <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8040ba:	55                   	push   %ebp
+  8040bb:	89 e5                	mov    %esp,%ebp
+  8040bd:	57                   	push   %edi
+  8040be:	56                   	push   %esi
+  8040bf:	53                   	push   %ebx
+  8040c0:	83 ec 1c             	sub    $0x1c,%esp
+  8040c3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040c5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8040cb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040d2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040d7:	77 0d                	ja     8040e6 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040d9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040de:	29 d0                	sub    %edx,%eax
+  8040e0:	c1 e8 10             	shr    $0x10,%eax
+  8040e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040eb:	eb 2f                	jmp    80411c <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8040ed:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040f3:	8b 01                	mov    (%ecx),%eax
+  8040f5:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8040f8:	39 c2                	cmp    %eax,%edx
+  8040fa:	75 14                	jne    804110 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8040fc:	83 ec 0c             	sub    $0xc,%esp
+  8040ff:	57                   	push   %edi
+  804100:	e8 2f cc ff ff       	call   800d34 <sys_env_destroy>
+  804105:	83 c4 10             	add    $0x10,%esp
+  804108:	85 c0                	test   %eax,%eax
+  80410a:	0f 88 97 00 00 00    	js     8041a7 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804110:	83 c3 01             	add    $0x1,%ebx
+  804113:	83 fb 20             	cmp    $0x20,%ebx
+  804116:	0f 84 d2 00 00 00    	je     8041ee <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80411c:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80411f:	74 ef                	je     804110 <pthread_kill_others+0x56>
+  804121:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804124:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80412b:	8b 40 04             	mov    0x4(%eax),%eax
+  80412e:	83 f8 01             	cmp    $0x1,%eax
+  804131:	75 dd                	jne    804110 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804133:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804136:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  80413d:	89 fe                	mov    %edi,%esi
+  80413f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804145:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804148:	c1 e0 04             	shl    $0x4,%eax
+  80414b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804150:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804153:	39 c7                	cmp    %eax,%edi
+  804155:	75 b9                	jne    804110 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804157:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80415a:	c1 e0 04             	shl    $0x4,%eax
+  80415d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804162:	8b 40 54             	mov    0x54(%eax),%eax
+  804165:	85 c0                	test   %eax,%eax
+  804167:	74 a7                	je     804110 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804169:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80416c:	c1 e0 04             	shl    $0x4,%eax
+  80416f:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804175:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804177:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80417d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804182:	0f 87 65 ff ff ff    	ja     8040ed <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804188:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80418d:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80418f:	c1 e8 10             	shr    $0x10,%eax
+  804192:	0f 84 55 ff ff ff    	je     8040ed <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804198:	c1 e0 10             	shl    $0x10,%eax
+  80419b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8041a0:	29 c1                	sub    %eax,%ecx
+  8041a2:	e9 4c ff ff ff       	jmp    8040f3 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8041a7:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8041aa:	c1 e2 04             	shl    $0x4,%edx
+  8041ad:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8041b3:	8b 52 48             	mov    0x48(%edx),%edx
+  8041b6:	39 fa                	cmp    %edi,%edx
+  8041b8:	0f 85 52 ff ff ff    	jne    804110 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8041be:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8041c1:	c1 e2 04             	shl    $0x4,%edx
+  8041c4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8041ca:	8b 52 54             	mov    0x54(%edx),%edx
+  8041cd:	85 d2                	test   %edx,%edx
+  8041cf:	0f 84 3b ff ff ff    	je     804110 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8041d5:	83 ec 0c             	sub    $0xc,%esp
+  8041d8:	50                   	push   %eax
+  8041d9:	57                   	push   %edi
+  8041da:	68 7c 50 80 00       	push   $0x80507c
+  8041df:	68 bb 00 00 00       	push   $0xbb
+  8041e4:	68 6b 50 80 00       	push   $0x80506b
+  8041e9:	e8 ec c0 ff ff       	call   8002da <_panic>
+	}
+}
+  8041ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f1:	5b                   	pop    %ebx
+  8041f2:	5e                   	pop    %esi
+  8041f3:	5f                   	pop    %edi
+  8041f4:	5d                   	pop    %ebp
+  8041f5:	c3                   	ret
+
+008041f6 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8041f6:	55                   	push   %ebp
+  8041f7:	89 e5                	mov    %esp,%ebp
+  8041f9:	53                   	push   %ebx
+  8041fa:	83 ec 04             	sub    $0x4,%esp
+  8041fd:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041ff:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804205:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80420b:	0f 87 85 00 00 00    	ja     804296 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804211:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804216:	29 c3                	sub    %eax,%ebx
+  804218:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80421b:	83 ec 04             	sub    $0x4,%esp
+  80421e:	68 80 02 00 00       	push   $0x280
+  804223:	6a 00                	push   $0x0
+  804225:	68 40 70 80 00       	push   $0x807040
+  80422a:	e8 bb c8 ff ff       	call   800aea <memset>
+	threads_mu.m_state = 0;
+  80422f:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804236:	00 00 00 
+	if (self != 0) {
+  804239:	83 c4 10             	add    $0x10,%esp
+  80423c:	85 db                	test   %ebx,%ebx
+  80423e:	74 51                	je     804291 <pthread_fork_child+0x9b>
+  804240:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804242:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804248:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80424d:	77 18                	ja     804267 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80424f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804254:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804256:	c1 e8 10             	shr    $0x10,%eax
+  804259:	74 0c                	je     804267 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80425b:	c1 e0 10             	shl    $0x10,%eax
+  80425e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804263:	29 c2                	sub    %eax,%edx
+  804265:	eb 06                	jmp    80426d <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804267:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  80426d:	8b 02                	mov    (%edx),%eax
+  80426f:	8b 48 48             	mov    0x48(%eax),%ecx
+  804272:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804279:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80427c:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804283:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  80428a:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804294:	c9                   	leave
+  804295:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804296:	83 ec 04             	sub    $0x4,%esp
+  804299:	68 80 02 00 00       	push   $0x280
+  80429e:	6a 00                	push   $0x0
+  8042a0:	68 40 70 80 00       	push   $0x807040
+  8042a5:	e8 40 c8 ff ff       	call   800aea <memset>
+	threads_mu.m_state = 0;
+  8042aa:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8042b1:	00 00 00 
+  8042b4:	83 c4 10             	add    $0x10,%esp
+  8042b7:	eb d8                	jmp    804291 <pthread_fork_child+0x9b>
+
+008042b9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8042b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042be:	c3                   	ret
+
+008042bf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8042bf:	55                   	push   %ebp
+  8042c0:	89 e5                	mov    %esp,%ebp
+  8042c2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8042c5:	68 a1 50 80 00       	push   $0x8050a1
+  8042ca:	ff 75 0c             	push   0xc(%ebp)
+  8042cd:	e8 c7 c6 ff ff       	call   800999 <strcpy>
+	return 0;
+}
+  8042d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d7:	c9                   	leave
+  8042d8:	c3                   	ret
+
+008042d9 <devcons_write>:
+{
+  8042d9:	55                   	push   %ebp
+  8042da:	89 e5                	mov    %esp,%ebp
+  8042dc:	57                   	push   %edi
+  8042dd:	56                   	push   %esi
+  8042de:	53                   	push   %ebx
+  8042df:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8042e5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8042ea:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8042f0:	eb 2e                	jmp    804320 <devcons_write+0x47>
+		m = n - tot;
+  8042f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8042f5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8042f7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042fc:	39 c3                	cmp    %eax,%ebx
+  8042fe:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804301:	83 ec 04             	sub    $0x4,%esp
+  804304:	53                   	push   %ebx
+  804305:	89 f0                	mov    %esi,%eax
+  804307:	03 45 0c             	add    0xc(%ebp),%eax
+  80430a:	50                   	push   %eax
+  80430b:	57                   	push   %edi
+  80430c:	e8 0e c8 ff ff       	call   800b1f <memmove>
+		sys_cputs(buf, m);
+  804311:	83 c4 08             	add    $0x8,%esp
+  804314:	53                   	push   %ebx
+  804315:	57                   	push   %edi
+  804316:	e8 c2 c9 ff ff       	call   800cdd <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80431b:	01 de                	add    %ebx,%esi
+  80431d:	83 c4 10             	add    $0x10,%esp
+  804320:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804323:	72 cd                	jb     8042f2 <devcons_write+0x19>
+}
+  804325:	89 f0                	mov    %esi,%eax
+  804327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80432a:	5b                   	pop    %ebx
+  80432b:	5e                   	pop    %esi
+  80432c:	5f                   	pop    %edi
+  80432d:	5d                   	pop    %ebp
+  80432e:	c3                   	ret
+
+0080432f <devcons_read>:
+{
+  80432f:	55                   	push   %ebp
+  804330:	89 e5                	mov    %esp,%ebp
+  804332:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80433e:	75 07                	jne    804347 <devcons_read+0x18>
+  804340:	eb 1f                	jmp    804361 <devcons_read+0x32>
+		sys_yield();
+  804342:	e8 64 ca ff ff       	call   800dab <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804347:	e8 bc c9 ff ff       	call   800d08 <sys_cgetc>
+  80434c:	85 c0                	test   %eax,%eax
+  80434e:	74 f2                	je     804342 <devcons_read+0x13>
+	if (c < 0)
+  804350:	78 0f                	js     804361 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804352:	83 f8 04             	cmp    $0x4,%eax
+  804355:	74 0c                	je     804363 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804357:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80435a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80435c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804361:	c9                   	leave
+  804362:	c3                   	ret
+		return 0;
+  804363:	b8 00 00 00 00       	mov    $0x0,%eax
+  804368:	eb f7                	jmp    804361 <devcons_read+0x32>
+
+0080436a <cputchar>:
+{
+  80436a:	55                   	push   %ebp
+  80436b:	89 e5                	mov    %esp,%ebp
+  80436d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804370:	8b 45 08             	mov    0x8(%ebp),%eax
+  804373:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804376:	6a 01                	push   $0x1
+  804378:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80437b:	50                   	push   %eax
+  80437c:	e8 5c c9 ff ff       	call   800cdd <sys_cputs>
+}
+  804381:	83 c4 10             	add    $0x10,%esp
+  804384:	c9                   	leave
+  804385:	c3                   	ret
+
+00804386 <getchar>:
+{
+  804386:	55                   	push   %ebp
+  804387:	89 e5                	mov    %esp,%ebp
+  804389:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80438c:	6a 01                	push   $0x1
+  80438e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804391:	50                   	push   %eax
+  804392:	6a 00                	push   $0x0
+  804394:	e8 63 d8 ff ff       	call   801bfc <read>
+	if (r < 0)
+  804399:	83 c4 10             	add    $0x10,%esp
+  80439c:	85 c0                	test   %eax,%eax
+  80439e:	78 06                	js     8043a6 <getchar+0x20>
+	if (r < 1)
+  8043a0:	74 06                	je     8043a8 <getchar+0x22>
+	return c;
+  8043a2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8043a6:	c9                   	leave
+  8043a7:	c3                   	ret
+		return -E_EOF;
+  8043a8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8043ad:	eb f7                	jmp    8043a6 <getchar+0x20>
+
+008043af <iscons>:
+{
+  8043af:	55                   	push   %ebp
+  8043b0:	89 e5                	mov    %esp,%ebp
+  8043b2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8043b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043b8:	50                   	push   %eax
+  8043b9:	ff 75 08             	push   0x8(%ebp)
+  8043bc:	e8 ab d5 ff ff       	call   80196c <fd_lookup>
+  8043c1:	83 c4 10             	add    $0x10,%esp
+  8043c4:	85 c0                	test   %eax,%eax
+  8043c6:	78 11                	js     8043d9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8043c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043cb:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8043d1:	39 10                	cmp    %edx,(%eax)
+  8043d3:	0f 94 c0             	sete   %al
+  8043d6:	0f b6 c0             	movzbl %al,%eax
+}
+  8043d9:	c9                   	leave
+  8043da:	c3                   	ret
+
+008043db <opencons>:
+{
+  8043db:	55                   	push   %ebp
+  8043dc:	89 e5                	mov    %esp,%ebp
+  8043de:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8043e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043e4:	50                   	push   %eax
+  8043e5:	e8 2c d5 ff ff       	call   801916 <fd_alloc>
+  8043ea:	83 c4 10             	add    $0x10,%esp
+  8043ed:	85 c0                	test   %eax,%eax
+  8043ef:	78 3a                	js     80442b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8043f1:	83 ec 04             	sub    $0x4,%esp
+  8043f4:	68 07 04 00 00       	push   $0x407
+  8043f9:	ff 75 f4             	push   -0xc(%ebp)
+  8043fc:	6a 00                	push   $0x0
+  8043fe:	e8 d4 c9 ff ff       	call   800dd7 <sys_page_alloc>
+  804403:	83 c4 10             	add    $0x10,%esp
+  804406:	85 c0                	test   %eax,%eax
+  804408:	78 21                	js     80442b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80440a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80440d:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804413:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804418:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80441f:	83 ec 0c             	sub    $0xc,%esp
+  804422:	50                   	push   %eax
+  804423:	e8 c7 d4 ff ff       	call   8018ef <fd2num>
+  804428:	83 c4 10             	add    $0x10,%esp
+}
+  80442b:	c9                   	leave
+  80442c:	c3                   	ret
+
+0080442d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80442d:	55                   	push   %ebp
+  80442e:	89 e5                	mov    %esp,%ebp
+  804430:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804433:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80443a:	74 0a                	je     804446 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80443c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80443f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804444:	c9                   	leave
+  804445:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804446:	83 ec 04             	sub    $0x4,%esp
+  804449:	6a 07                	push   $0x7
+  80444b:	68 00 f0 bf ee       	push   $0xeebff000
+  804450:	6a 00                	push   $0x0
+  804452:	e8 80 c9 ff ff       	call   800dd7 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804457:	83 c4 08             	add    $0x8,%esp
+  80445a:	68 6b 44 80 00       	push   $0x80446b
+  80445f:	6a 00                	push   $0x0
+  804461:	e8 ee ca ff ff       	call   800f54 <sys_env_set_pgfault_upcall>
+  804466:	83 c4 10             	add    $0x10,%esp
+  804469:	eb d1                	jmp    80443c <set_pgfault_handler+0xf>
+
+0080446b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80446b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80446c:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804471:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804473:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804476:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80447a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80447e:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804481:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804485:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804487:	83 c4 08             	add    $0x8,%esp
+	popal
+  80448a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80448b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80448e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80448f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804490:	c3                   	ret
+
+00804491 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804491:	55                   	push   %ebp
+  804492:	89 e5                	mov    %esp,%ebp
+  804494:	57                   	push   %edi
+  804495:	56                   	push   %esi
+  804496:	53                   	push   %ebx
+  804497:	83 ec 18             	sub    $0x18,%esp
+  80449a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80449d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044a0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044a3:	85 c0                	test   %eax,%eax
+  8044a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8044aa:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8044ad:	50                   	push   %eax
+  8044ae:	e8 1a cb ff ff       	call   800fcd <sys_ipc_recv>
+	if (r < 0) {
+  8044b3:	83 c4 10             	add    $0x10,%esp
+  8044b6:	85 c0                	test   %eax,%eax
+  8044b8:	78 2b                	js     8044e5 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8044ba:	85 ff                	test   %edi,%edi
+  8044bc:	74 55                	je     804513 <ipc_recv+0x82>
+  8044be:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044c0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044cb:	77 39                	ja     804506 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044d2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044d4:	c1 e8 10             	shr    $0x10,%eax
+  8044d7:	74 2d                	je     804506 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044d9:	c1 e0 10             	shl    $0x10,%eax
+  8044dc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044e1:	29 c2                	sub    %eax,%edx
+  8044e3:	eb 27                	jmp    80450c <ipc_recv+0x7b>
+  8044e5:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8044e7:	83 ec 08             	sub    $0x8,%esp
+  8044ea:	50                   	push   %eax
+  8044eb:	68 ad 50 80 00       	push   $0x8050ad
+  8044f0:	e8 c0 be ff ff       	call   8003b5 <cprintf>
+		*from_env_store = 0;
+  8044f5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8044fb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804501:	83 c4 10             	add    $0x10,%esp
+  804504:	eb 77                	jmp    80457d <ipc_recv+0xec>
+		return pthread_main_tls;
+  804506:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80450c:	8b 02                	mov    (%edx),%eax
+  80450e:	8b 40 78             	mov    0x78(%eax),%eax
+  804511:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804513:	85 f6                	test   %esi,%esi
+  804515:	74 34                	je     80454b <ipc_recv+0xba>
+  804517:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804519:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80451f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804524:	77 18                	ja     80453e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804526:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80452b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80452d:	c1 e8 10             	shr    $0x10,%eax
+  804530:	74 0c                	je     80453e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804532:	c1 e0 10             	shl    $0x10,%eax
+  804535:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80453a:	29 c2                	sub    %eax,%edx
+  80453c:	eb 06                	jmp    804544 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80453e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804544:	8b 02                	mov    (%edx),%eax
+  804546:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804549:	89 06                	mov    %eax,(%esi)
+  80454b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80454d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804553:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804558:	77 18                	ja     804572 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80455a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80455f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804561:	c1 e8 10             	shr    $0x10,%eax
+  804564:	74 0c                	je     804572 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804566:	c1 e0 10             	shl    $0x10,%eax
+  804569:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80456e:	29 c2                	sub    %eax,%edx
+  804570:	eb 06                	jmp    804578 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804572:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804578:	8b 02                	mov    (%edx),%eax
+  80457a:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80457d:	89 d8                	mov    %ebx,%eax
+  80457f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804582:	5b                   	pop    %ebx
+  804583:	5e                   	pop    %esi
+  804584:	5f                   	pop    %edi
+  804585:	5d                   	pop    %ebp
+  804586:	c3                   	ret
+
+00804587 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804587:	55                   	push   %ebp
+  804588:	89 e5                	mov    %esp,%ebp
+  80458a:	57                   	push   %edi
+  80458b:	56                   	push   %esi
+  80458c:	53                   	push   %ebx
+  80458d:	83 ec 0c             	sub    $0xc,%esp
+  804590:	8b 75 08             	mov    0x8(%ebp),%esi
+  804593:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804596:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804599:	85 db                	test   %ebx,%ebx
+  80459b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8045a0:	0f 44 d8             	cmove  %eax,%ebx
+  8045a3:	eb 05                	jmp    8045aa <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8045a5:	e8 01 c8 ff ff       	call   800dab <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8045aa:	57                   	push   %edi
+  8045ab:	53                   	push   %ebx
+  8045ac:	ff 75 0c             	push   0xc(%ebp)
+  8045af:	56                   	push   %esi
+  8045b0:	e8 eb c9 ff ff       	call   800fa0 <sys_ipc_try_send>
+		if (r == 0) {
+  8045b5:	83 c4 10             	add    $0x10,%esp
+  8045b8:	85 c0                	test   %eax,%eax
+  8045ba:	74 19                	je     8045d5 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8045bc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8045bf:	74 e4                	je     8045a5 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8045c1:	83 ec 0c             	sub    $0xc,%esp
+  8045c4:	50                   	push   %eax
+  8045c5:	57                   	push   %edi
+  8045c6:	53                   	push   %ebx
+  8045c7:	56                   	push   %esi
+  8045c8:	68 c8 50 80 00       	push   $0x8050c8
+  8045cd:	e8 e3 bd ff ff       	call   8003b5 <cprintf>
+			return;
+  8045d2:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8045d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045d8:	5b                   	pop    %ebx
+  8045d9:	5e                   	pop    %esi
+  8045da:	5f                   	pop    %edi
+  8045db:	5d                   	pop    %ebp
+  8045dc:	c3                   	ret
+
+008045dd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8045dd:	55                   	push   %ebp
+  8045de:	89 e5                	mov    %esp,%ebp
+  8045e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8045e3:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8045e8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8045eb:	c1 e0 04             	shl    $0x4,%eax
+  8045ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045f3:	8b 40 50             	mov    0x50(%eax),%eax
+  8045f6:	39 c8                	cmp    %ecx,%eax
+  8045f8:	74 12                	je     80460c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8045fa:	83 c2 01             	add    $0x1,%edx
+  8045fd:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804603:	75 e3                	jne    8045e8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460a:	eb 0e                	jmp    80461a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80460c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80460f:	c1 e0 04             	shl    $0x4,%eax
+  804612:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804617:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80461a:	5d                   	pop    %ebp
+  80461b:	c3                   	ret
+
+0080461c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80461c:	55                   	push   %ebp
+  80461d:	89 e5                	mov    %esp,%ebp
+  80461f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804622:	89 c2                	mov    %eax,%edx
+  804624:	c1 ea 16             	shr    $0x16,%edx
+  804627:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80462e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804633:	f6 c1 01             	test   $0x1,%cl
+  804636:	74 1c                	je     804654 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804638:	c1 e8 0c             	shr    $0xc,%eax
+  80463b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804642:	a8 01                	test   $0x1,%al
+  804644:	74 0e                	je     804654 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804646:	c1 e8 0c             	shr    $0xc,%eax
+  804649:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804650:	ef 
+  804651:	0f b7 d2             	movzwl %dx,%edx
+}
+  804654:	89 d0                	mov    %edx,%eax
+  804656:	5d                   	pop    %ebp
+  804657:	c3                   	ret
+
+00804658 <udm>:
+  804658:	57                   	push   %edi
+  804659:	56                   	push   %esi
+  80465a:	53                   	push   %ebx
+  80465b:	83 ec 20             	sub    $0x20,%esp
+  80465e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804662:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804666:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80466a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80466e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804672:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804676:	89 d1                	mov    %edx,%ecx
+  804678:	09 c1                	or     %eax,%ecx
+  80467a:	0f 84 91 00 00 00    	je     804711 <udm+0xb9>
+  804680:	b8 00 00 00 00       	mov    $0x0,%eax
+  804685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80468a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80468f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804696:	00 
+  804697:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80469e:	00 
+  80469f:	eb 08                	jmp    8046a9 <udm+0x51>
+  8046a1:	83 e9 01             	sub    $0x1,%ecx
+  8046a4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8046a7:	74 7c                	je     804725 <udm+0xcd>
+  8046a9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8046ad:	01 c0                	add    %eax,%eax
+  8046af:	89 c6                	mov    %eax,%esi
+  8046b1:	89 d7                	mov    %edx,%edi
+  8046b3:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8046b7:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8046bb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8046be:	d3 ea                	shr    %cl,%edx
+  8046c0:	f6 c1 20             	test   $0x20,%cl
+  8046c3:	74 04                	je     8046c9 <udm+0x71>
+  8046c5:	89 d0                	mov    %edx,%eax
+  8046c7:	31 d2                	xor    %edx,%edx
+  8046c9:	83 e0 01             	and    $0x1,%eax
+  8046cc:	89 04 24             	mov    %eax,(%esp)
+  8046cf:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8046d6:	00 
+  8046d7:	8b 04 24             	mov    (%esp),%eax
+  8046da:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8046de:	09 f0                	or     %esi,%eax
+  8046e0:	09 fa                	or     %edi,%edx
+  8046e2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046e6:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046ea:	39 f0                	cmp    %esi,%eax
+  8046ec:	89 d3                	mov    %edx,%ebx
+  8046ee:	19 fb                	sbb    %edi,%ebx
+  8046f0:	72 af                	jb     8046a1 <udm+0x49>
+  8046f2:	29 f0                	sub    %esi,%eax
+  8046f4:	19 fa                	sbb    %edi,%edx
+  8046f6:	89 cf                	mov    %ecx,%edi
+  8046f8:	c1 ef 05             	shr    $0x5,%edi
+  8046fb:	83 e7 01             	and    $0x1,%edi
+  8046fe:	89 fe                	mov    %edi,%esi
+  804700:	83 f6 01             	xor    $0x1,%esi
+  804703:	d3 e6                	shl    %cl,%esi
+  804705:	d3 e7                	shl    %cl,%edi
+  804707:	09 74 24 18          	or     %esi,0x18(%esp)
+  80470b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80470f:	eb 90                	jmp    8046a1 <udm+0x49>
+  804711:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804715:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804719:	89 f0                	mov    %esi,%eax
+  80471b:	89 fa                	mov    %edi,%edx
+  80471d:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804721:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804725:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804729:	89 01                	mov    %eax,(%ecx)
+  80472b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80472e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804732:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804736:	83 c4 20             	add    $0x20,%esp
+  804739:	5b                   	pop    %ebx
+  80473a:	5e                   	pop    %esi
+  80473b:	5f                   	pop    %edi
+  80473c:	c3                   	ret
+
+0080473d <__udivdi3>:
+  80473d:	83 ec 18             	sub    $0x18,%esp
+  804740:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804744:	50                   	push   %eax
+  804745:	ff 74 24 2c          	push   0x2c(%esp)
+  804749:	ff 74 24 2c          	push   0x2c(%esp)
+  80474d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804751:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804755:	e8 fe fe ff ff       	call   804658 <udm>
+  80475a:	83 c4 24             	add    $0x24,%esp
+  80475d:	c3                   	ret
+
+0080475e <__umoddi3>:
+  80475e:	83 ec 18             	sub    $0x18,%esp
+  804761:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804765:	50                   	push   %eax
+  804766:	ff 74 24 2c          	push   0x2c(%esp)
+  80476a:	ff 74 24 2c          	push   0x2c(%esp)
+  80476e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804772:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804776:	e8 dd fe ff ff       	call   804658 <udm>
+  80477b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80477f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804783:	83 c4 24             	add    $0x24,%esp
+  804786:	c3                   	ret
+
+00804787 <__divdi3>:
+  804787:	56                   	push   %esi
+  804788:	53                   	push   %ebx
+  804789:	83 ec 14             	sub    $0x14,%esp
+  80478c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804790:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804794:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804798:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80479c:	85 d2                	test   %edx,%edx
+  80479e:	78 18                	js     8047b8 <__divdi3+0x31>
+  8047a0:	85 db                	test   %ebx,%ebx
+  8047a2:	78 3e                	js     8047e2 <__divdi3+0x5b>
+  8047a4:	83 ec 04             	sub    $0x4,%esp
+  8047a7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047ab:	56                   	push   %esi
+  8047ac:	53                   	push   %ebx
+  8047ad:	51                   	push   %ecx
+  8047ae:	e8 a5 fe ff ff       	call   804658 <udm>
+  8047b3:	83 c4 10             	add    $0x10,%esp
+  8047b6:	eb 24                	jmp    8047dc <__divdi3+0x55>
+  8047b8:	f7 d8                	neg    %eax
+  8047ba:	83 d2 00             	adc    $0x0,%edx
+  8047bd:	f7 da                	neg    %edx
+  8047bf:	85 db                	test   %ebx,%ebx
+  8047c1:	78 3a                	js     8047fd <__divdi3+0x76>
+  8047c3:	83 ec 04             	sub    $0x4,%esp
+  8047c6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047ca:	56                   	push   %esi
+  8047cb:	53                   	push   %ebx
+  8047cc:	51                   	push   %ecx
+  8047cd:	e8 86 fe ff ff       	call   804658 <udm>
+  8047d2:	83 c4 10             	add    $0x10,%esp
+  8047d5:	f7 d8                	neg    %eax
+  8047d7:	83 d2 00             	adc    $0x0,%edx
+  8047da:	f7 da                	neg    %edx
+  8047dc:	83 c4 14             	add    $0x14,%esp
+  8047df:	5b                   	pop    %ebx
+  8047e0:	5e                   	pop    %esi
+  8047e1:	c3                   	ret
+  8047e2:	83 ec 04             	sub    $0x4,%esp
+  8047e5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047e9:	56                   	push   %esi
+  8047ea:	f7 d9                	neg    %ecx
+  8047ec:	83 d3 00             	adc    $0x0,%ebx
+  8047ef:	f7 db                	neg    %ebx
+  8047f1:	53                   	push   %ebx
+  8047f2:	51                   	push   %ecx
+  8047f3:	e8 60 fe ff ff       	call   804658 <udm>
+  8047f8:	83 c4 10             	add    $0x10,%esp
+  8047fb:	eb d8                	jmp    8047d5 <__divdi3+0x4e>
+  8047fd:	83 ec 04             	sub    $0x4,%esp
+  804800:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804804:	56                   	push   %esi
+  804805:	f7 d9                	neg    %ecx
+  804807:	83 d3 00             	adc    $0x0,%ebx
+  80480a:	f7 db                	neg    %ebx
+  80480c:	53                   	push   %ebx
+  80480d:	51                   	push   %ecx
+  80480e:	e8 45 fe ff ff       	call   804658 <udm>
+  804813:	83 c4 10             	add    $0x10,%esp
+  804816:	eb c4                	jmp    8047dc <__divdi3+0x55>
+
+00804818 <__moddi3>:
+  804818:	55                   	push   %ebp
+  804819:	57                   	push   %edi
+  80481a:	56                   	push   %esi
+  80481b:	53                   	push   %ebx
+  80481c:	83 ec 24             	sub    $0x24,%esp
+  80481f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804823:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804827:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80482b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80482f:	85 d2                	test   %edx,%edx
+  804831:	78 3b                	js     80486e <__moddi3+0x56>
+  804833:	83 ec 04             	sub    $0x4,%esp
+  804836:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80483a:	56                   	push   %esi
+  80483b:	89 ce                	mov    %ecx,%esi
+  80483d:	f7 de                	neg    %esi
+  80483f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804843:	89 de                	mov    %ebx,%esi
+  804845:	83 d6 00             	adc    $0x0,%esi
+  804848:	f7 de                	neg    %esi
+  80484a:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80484e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804852:	0f 48 f1             	cmovs  %ecx,%esi
+  804855:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80485a:	53                   	push   %ebx
+  80485b:	56                   	push   %esi
+  80485c:	e8 f7 fd ff ff       	call   804658 <udm>
+  804861:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804865:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804869:	83 c4 10             	add    $0x10,%esp
+  80486c:	eb 47                	jmp    8048b5 <__moddi3+0x9d>
+  80486e:	f7 d8                	neg    %eax
+  804870:	83 d2 00             	adc    $0x0,%edx
+  804873:	f7 da                	neg    %edx
+  804875:	83 ec 04             	sub    $0x4,%esp
+  804878:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80487c:	56                   	push   %esi
+  80487d:	89 cf                	mov    %ecx,%edi
+  80487f:	f7 df                	neg    %edi
+  804881:	89 de                	mov    %ebx,%esi
+  804883:	83 d6 00             	adc    $0x0,%esi
+  804886:	f7 de                	neg    %esi
+  804888:	0f 49 cf             	cmovns %edi,%ecx
+  80488b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80488f:	0f 49 de             	cmovns %esi,%ebx
+  804892:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804896:	ff 74 24 0c          	push   0xc(%esp)
+  80489a:	ff 74 24 0c          	push   0xc(%esp)
+  80489e:	e8 b5 fd ff ff       	call   804658 <udm>
+  8048a3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048ab:	f7 d8                	neg    %eax
+  8048ad:	83 d2 00             	adc    $0x0,%edx
+  8048b0:	f7 da                	neg    %edx
+  8048b2:	83 c4 10             	add    $0x10,%esp
+  8048b5:	83 c4 24             	add    $0x24,%esp
+  8048b8:	5b                   	pop    %ebx
+  8048b9:	5e                   	pop    %esi
+  8048ba:	5f                   	pop    %edi
+  8048bb:	5d                   	pop    %ebp
+  8048bc:	c3                   	ret
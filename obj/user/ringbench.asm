@@ -0,0 +1,10737 @@
+
+obj/user/ringbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 02 00 00       	call   8002cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	report("ipc ", read_tsc() - tsc, sys_time_msec() - start);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 48             	sub    $0x48,%esp
+	if ((i = ring_create(&r, RINGVA, sizeof(struct msg), NSLOTS, RING_PRODUCER)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 00 01 00 00       	push   $0x100
+  800043:	6a 40                	push   $0x40
+  800045:	68 00 00 00 a0       	push   $0xa0000000
+  80004a:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  80004d:	50                   	push   %eax
+  80004e:	e8 30 40 00 00       	call   804083 <ring_create>
+  800053:	83 c4 20             	add    $0x20,%esp
+  800056:	85 c0                	test   %eax,%eax
+  800058:	0f 88 e7 01 00 00    	js     800245 <umain+0x212>
+	if ((child = fork()) < 0)
+  80005e:	e8 c4 14 00 00       	call   801527 <fork>
+  800063:	89 c7                	mov    %eax,%edi
+  800065:	85 c0                	test   %eax,%eax
+  800067:	0f 88 ea 01 00 00    	js     800257 <umain+0x224>
+	if (child == 0) {
+  80006d:	75 64                	jne    8000d3 <umain+0xa0>
+		if ((i = ring_attach(&r, RINGVA, RING_CONSUMER)) < 0)
+  80006f:	83 ec 04             	sub    $0x4,%esp
+  800072:	6a 01                	push   $0x1
+  800074:	68 00 00 00 a0       	push   $0xa0000000
+  800079:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  80007c:	50                   	push   %eax
+  80007d:	e8 40 3f 00 00       	call   803fc2 <ring_attach>
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	85 c0                	test   %eax,%eax
+  800087:	0f 88 dc 01 00 00    	js     800269 <umain+0x236>
+		for (i = 0; i < NMSG; i++) {
+  80008d:	89 fb                	mov    %edi,%ebx
+			m = ring_front(&r);
+  80008f:	8d 75 cc             	lea    -0x34(%ebp),%esi
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	56                   	push   %esi
+  800096:	e8 5b 43 00 00       	call   8043f6 <ring_front>
+			if (m->seq != i)
+  80009b:	8b 00                	mov    (%eax),%eax
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	39 d8                	cmp    %ebx,%eax
+  8000a2:	0f 85 d3 01 00 00    	jne    80027b <umain+0x248>
+			ring_pop(&r);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	56                   	push   %esi
+  8000ac:	e8 a5 43 00 00       	call   804456 <ring_pop>
+		for (i = 0; i < NMSG; i++) {
+  8000b1:	83 c3 01             	add    $0x1,%ebx
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	81 fb 20 4e 00 00    	cmp    $0x4e20,%ebx
+  8000bd:	75 d3                	jne    800092 <umain+0x5f>
+		ring_flush(&r);
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  8000c5:	50                   	push   %eax
+  8000c6:	e8 be 41 00 00       	call   804289 <ring_flush>
+		exit();
+  8000cb:	e8 76 02 00 00       	call   800346 <exit>
+  8000d0:	83 c4 10             	add    $0x10,%esp
+	start = sys_time_msec();
+  8000d3:	e8 20 10 00 00       	call   8010f8 <sys_time_msec>
+  8000d8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000db:	0f 31                	rdtsc
+  8000dd:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  8000e0:	89 55 bc             	mov    %edx,-0x44(%ebp)
+	for (i = 0; i < NMSG; i++) {
+  8000e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		m = ring_alloc(&r);
+  8000e8:	8d 75 cc             	lea    -0x34(%ebp),%esi
+  8000eb:	83 ec 0c             	sub    $0xc,%esp
+  8000ee:	56                   	push   %esi
+  8000ef:	e8 37 42 00 00       	call   80432b <ring_alloc>
+		m->seq = i;
+  8000f4:	89 18                	mov    %ebx,(%eax)
+		ring_push(&r);
+  8000f6:	89 34 24             	mov    %esi,(%esp)
+  8000f9:	e8 91 42 00 00       	call   80438f <ring_push>
+	for (i = 0; i < NMSG; i++) {
+  8000fe:	83 c3 01             	add    $0x1,%ebx
+  800101:	83 c4 10             	add    $0x10,%esp
+  800104:	81 fb 20 4e 00 00    	cmp    $0x4e20,%ebx
+  80010a:	75 df                	jne    8000eb <umain+0xb8>
+	ring_flush(&r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  800112:	50                   	push   %eax
+  800113:	e8 71 41 00 00       	call   804289 <ring_flush>
+	wait(child);
+  800118:	89 3c 24             	mov    %edi,(%esp)
+  80011b:	e8 9e 3b 00 00       	call   803cbe <wait>
+	report("ring", read_tsc() - tsc, sys_time_msec() - start);
+  800120:	e8 d3 0f 00 00       	call   8010f8 <sys_time_msec>
+  800125:	89 c1                	mov    %eax,%ecx
+  800127:	0f 31                	rdtsc
+  800129:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  80012c:	29 f9                	sub    %edi,%ecx
+	cprintf("%s: %d messages, %d cycles/msg, %d ms\n",
+  80012e:	89 0c 24             	mov    %ecx,(%esp)
+	report("ring", read_tsc() - tsc, sys_time_msec() - start);
+  800131:	2b 45 b8             	sub    -0x48(%ebp),%eax
+  800134:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+		what, NMSG, (uint32_t) (cycles / NMSG), msec);
+  800137:	6a 00                	push   $0x0
+  800139:	68 20 4e 00 00       	push   $0x4e20
+  80013e:	52                   	push   %edx
+  80013f:	50                   	push   %eax
+  800140:	e8 ea 4b 00 00       	call   804d2f <__udivdi3>
+  800145:	83 c4 10             	add    $0x10,%esp
+	cprintf("%s: %d messages, %d cycles/msg, %d ms\n",
+  800148:	50                   	push   %eax
+  800149:	68 20 4e 00 00       	push   $0x4e20
+  80014e:	68 18 4f 80 00       	push   $0x804f18
+  800153:	68 54 4f 80 00       	push   $0x804f54
+  800158:	e8 ec 02 00 00       	call   800449 <cprintf>
+	if ((child = fork()) < 0)
+  80015d:	83 c4 20             	add    $0x20,%esp
+  800160:	e8 c2 13 00 00       	call   801527 <fork>
+  800165:	89 c6                	mov    %eax,%esi
+  800167:	85 c0                	test   %eax,%eax
+  800169:	0f 88 22 01 00 00    	js     800291 <umain+0x25e>
+	if (child == 0) {
+  80016f:	75 33                	jne    8001a4 <umain+0x171>
+		for (i = 0; i < NMSG; i++) {
+  800171:	89 c3                	mov    %eax,%ebx
+			ipc_recv(NULL, PAGEVA, NULL);
+  800173:	83 ec 04             	sub    $0x4,%esp
+  800176:	6a 00                	push   $0x0
+  800178:	68 00 00 00 b0       	push   $0xb0000000
+  80017d:	6a 00                	push   $0x0
+  80017f:	e8 ff 17 00 00       	call   801983 <ipc_recv>
+			if (m->seq != i)
+  800184:	a1 00 00 00 b0       	mov    0xb0000000,%eax
+  800189:	83 c4 10             	add    $0x10,%esp
+  80018c:	39 d8                	cmp    %ebx,%eax
+  80018e:	0f 85 0f 01 00 00    	jne    8002a3 <umain+0x270>
+		for (i = 0; i < NMSG; i++) {
+  800194:	83 c3 01             	add    $0x1,%ebx
+  800197:	81 fb 20 4e 00 00    	cmp    $0x4e20,%ebx
+  80019d:	75 d4                	jne    800173 <umain+0x140>
+		exit();
+  80019f:	e8 a2 01 00 00       	call   800346 <exit>
+	start = sys_time_msec();
+  8001a4:	e8 4f 0f 00 00       	call   8010f8 <sys_time_msec>
+  8001a9:	89 c7                	mov    %eax,%edi
+  8001ab:	0f 31                	rdtsc
+  8001ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  8001b0:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (i = 0; i < NMSG; i++) {
+  8001b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = sys_page_alloc(0, PAGEVA, PTE_P|PTE_U|PTE_W)) < 0)
+  8001b8:	83 ec 04             	sub    $0x4,%esp
+  8001bb:	6a 07                	push   $0x7
+  8001bd:	68 00 00 00 b0       	push   $0xb0000000
+  8001c2:	6a 00                	push   $0x0
+  8001c4:	e8 a2 0c 00 00       	call   800e6b <sys_page_alloc>
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	85 c0                	test   %eax,%eax
+  8001ce:	0f 88 e5 00 00 00    	js     8002b9 <umain+0x286>
+		m->seq = i;
+  8001d4:	89 1d 00 00 00 b0    	mov    %ebx,0xb0000000
+		ipc_send(child, 0, PAGEVA, PTE_P|PTE_U|PTE_W);
+  8001da:	6a 07                	push   $0x7
+  8001dc:	68 00 00 00 b0       	push   $0xb0000000
+  8001e1:	6a 00                	push   $0x0
+  8001e3:	56                   	push   %esi
+  8001e4:	e8 90 18 00 00       	call   801a79 <ipc_send>
+	for (i = 0; i < NMSG; i++) {
+  8001e9:	83 c3 01             	add    $0x1,%ebx
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	81 fb 20 4e 00 00    	cmp    $0x4e20,%ebx
+  8001f5:	75 c1                	jne    8001b8 <umain+0x185>
+	wait(child);
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	56                   	push   %esi
+  8001fb:	e8 be 3a 00 00       	call   803cbe <wait>
+	report("ipc ", read_tsc() - tsc, sys_time_msec() - start);
+  800200:	e8 f3 0e 00 00       	call   8010f8 <sys_time_msec>
+  800205:	89 c1                	mov    %eax,%ecx
+  800207:	0f 31                	rdtsc
+  800209:	29 f9                	sub    %edi,%ecx
+	cprintf("%s: %d messages, %d cycles/msg, %d ms\n",
+  80020b:	89 0c 24             	mov    %ecx,(%esp)
+	report("ipc ", read_tsc() - tsc, sys_time_msec() - start);
+  80020e:	2b 45 c0             	sub    -0x40(%ebp),%eax
+  800211:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+		what, NMSG, (uint32_t) (cycles / NMSG), msec);
+  800214:	6a 00                	push   $0x0
+  800216:	68 20 4e 00 00       	push   $0x4e20
+  80021b:	52                   	push   %edx
+  80021c:	50                   	push   %eax
+  80021d:	e8 0d 4b 00 00       	call   804d2f <__udivdi3>
+  800222:	83 c4 10             	add    $0x10,%esp
+	cprintf("%s: %d messages, %d cycles/msg, %d ms\n",
+  800225:	50                   	push   %eax
+  800226:	68 20 4e 00 00       	push   $0x4e20
+  80022b:	68 4d 4f 80 00       	push   $0x804f4d
+  800230:	68 54 4f 80 00       	push   $0x804f54
+  800235:	e8 0f 02 00 00       	call   800449 <cprintf>
+	bench_ring();
+	bench_ipc();
+}
+  80023a:	83 c4 20             	add    $0x20,%esp
+  80023d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800240:	5b                   	pop    %ebx
+  800241:	5e                   	pop    %esi
+  800242:	5f                   	pop    %edi
+  800243:	5d                   	pop    %ebp
+  800244:	c3                   	ret
+		panic("ring_create: %e", i);
+  800245:	50                   	push   %eax
+  800246:	68 c0 4e 80 00       	push   $0x804ec0
+  80024b:	6a 24                	push   $0x24
+  80024d:	68 d0 4e 80 00       	push   $0x804ed0
+  800252:	e8 17 01 00 00       	call   80036e <_panic>
+		panic("fork: %e", child);
+  800257:	50                   	push   %eax
+  800258:	68 e1 4e 80 00       	push   $0x804ee1
+  80025d:	6a 26                	push   $0x26
+  80025f:	68 d0 4e 80 00       	push   $0x804ed0
+  800264:	e8 05 01 00 00       	call   80036e <_panic>
+			panic("ring_attach: %e", i);
+  800269:	50                   	push   %eax
+  80026a:	68 ea 4e 80 00       	push   $0x804eea
+  80026f:	6a 29                	push   $0x29
+  800271:	68 d0 4e 80 00       	push   $0x804ed0
+  800276:	e8 f3 00 00 00       	call   80036e <_panic>
+				panic("ring: got message %d, want %d", m->seq, i);
+  80027b:	83 ec 0c             	sub    $0xc,%esp
+  80027e:	53                   	push   %ebx
+  80027f:	50                   	push   %eax
+  800280:	68 fa 4e 80 00       	push   $0x804efa
+  800285:	6a 2d                	push   $0x2d
+  800287:	68 d0 4e 80 00       	push   $0x804ed0
+  80028c:	e8 dd 00 00 00       	call   80036e <_panic>
+		panic("fork: %e", child);
+  800291:	50                   	push   %eax
+  800292:	68 e1 4e 80 00       	push   $0x804ee1
+  800297:	6a 4a                	push   $0x4a
+  800299:	68 d0 4e 80 00       	push   $0x804ed0
+  80029e:	e8 cb 00 00 00       	call   80036e <_panic>
+				panic("ipc: got message %d, want %d", m->seq, i);
+  8002a3:	83 ec 0c             	sub    $0xc,%esp
+  8002a6:	53                   	push   %ebx
+  8002a7:	50                   	push   %eax
+  8002a8:	68 1d 4f 80 00       	push   $0x804f1d
+  8002ad:	6a 4f                	push   $0x4f
+  8002af:	68 d0 4e 80 00       	push   $0x804ed0
+  8002b4:	e8 b5 00 00 00       	call   80036e <_panic>
+			panic("sys_page_alloc: %e", r);
+  8002b9:	50                   	push   %eax
+  8002ba:	68 3a 4f 80 00       	push   $0x804f3a
+  8002bf:	6a 58                	push   $0x58
+  8002c1:	68 d0 4e 80 00       	push   $0x804ed0
+  8002c6:	e8 a3 00 00 00       	call   80036e <_panic>
+
+008002cb <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cb:	55                   	push   %ebp
+  8002cc:	89 e5                	mov    %esp,%ebp
+  8002ce:	57                   	push   %edi
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	83 ec 1c             	sub    $0x1c,%esp
+  8002d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8002da:	e8 34 0b 00 00       	call   800e13 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8002df:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8002e2:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8002e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002ed:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8002ef:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8002f1:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8002f7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8002fc:	77 16                	ja     800314 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8002fe:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800303:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800305:	c1 e8 10             	shr    $0x10,%eax
+  800308:	74 0a                	je     800314 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80030a:	c1 e0 10             	shl    $0x10,%eax
+  80030d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800312:	29 c2                	sub    %eax,%edx
+  800314:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800317:	c1 e0 04             	shl    $0x4,%eax
+  80031a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80031f:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800321:	85 db                	test   %ebx,%ebx
+  800323:	7e 07                	jle    80032c <libmain+0x61>
+		binaryname = argv[0];
+  800325:	8b 06                	mov    (%esi),%eax
+  800327:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+  800331:	e8 fd fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800336:	e8 0b 00 00 00       	call   800346 <exit>
+}
+  80033b:	83 c4 10             	add    $0x10,%esp
+  80033e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800341:	5b                   	pop    %ebx
+  800342:	5e                   	pop    %esi
+  800343:	5f                   	pop    %edi
+  800344:	5d                   	pop    %ebp
+  800345:	c3                   	ret
+
+00800346 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800346:	55                   	push   %ebp
+  800347:	89 e5                	mov    %esp,%ebp
+  800349:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80034c:	6a 00                	push   $0x0
+  80034e:	e8 16 29 00 00       	call   802c69 <fflush>
+	pthread_kill_others();
+  800353:	e8 df 44 00 00       	call   804837 <pthread_kill_others>
+	close_all();
+  800358:	e8 af 19 00 00       	call   801d0c <close_all>
+	sys_env_destroy(0);
+  80035d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800364:	e8 5f 0a 00 00       	call   800dc8 <sys_env_destroy>
+}
+  800369:	83 c4 10             	add    $0x10,%esp
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+0080036e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80036e:	55                   	push   %ebp
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	56                   	push   %esi
+  800372:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800373:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800376:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80037c:	e8 92 0a 00 00       	call   800e13 <sys_getenvid>
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	ff 75 0c             	push   0xc(%ebp)
+  800387:	ff 75 08             	push   0x8(%ebp)
+  80038a:	56                   	push   %esi
+  80038b:	50                   	push   %eax
+  80038c:	68 88 4f 80 00       	push   $0x804f88
+  800391:	e8 b3 00 00 00       	call   800449 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800396:	83 c4 18             	add    $0x18,%esp
+  800399:	53                   	push   %ebx
+  80039a:	ff 75 10             	push   0x10(%ebp)
+  80039d:	e8 56 00 00 00       	call   8003f8 <vcprintf>
+	cprintf("\n");
+  8003a2:	c7 04 24 7a 54 80 00 	movl   $0x80547a,(%esp)
+  8003a9:	e8 9b 00 00 00       	call   800449 <cprintf>
+  8003ae:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003b1:	cc                   	int3
+	while (1)
+  8003b2:	eb fd                	jmp    8003b1 <_panic+0x43>
+
+008003b4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	53                   	push   %ebx
+  8003b8:	83 ec 04             	sub    $0x4,%esp
+  8003bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003be:	8b 13                	mov    (%ebx),%edx
+  8003c0:	8d 42 01             	lea    0x1(%edx),%eax
+  8003c3:	89 03                	mov    %eax,(%ebx)
+  8003c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003cc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003d1:	74 09                	je     8003dc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003d3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003da:	c9                   	leave
+  8003db:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+  8003df:	68 ff 00 00 00       	push   $0xff
+  8003e4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003e7:	50                   	push   %eax
+  8003e8:	e8 84 09 00 00       	call   800d71 <sys_cputs>
+		b->idx = 0;
+  8003ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003f3:	83 c4 10             	add    $0x10,%esp
+  8003f6:	eb db                	jmp    8003d3 <putch+0x1f>
+
+008003f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003f8:	55                   	push   %ebp
+  8003f9:	89 e5                	mov    %esp,%ebp
+  8003fb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800401:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800408:	00 00 00 
+	b.cnt = 0;
+  80040b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800412:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800415:	ff 75 0c             	push   0xc(%ebp)
+  800418:	ff 75 08             	push   0x8(%ebp)
+  80041b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800421:	50                   	push   %eax
+  800422:	68 b4 03 80 00       	push   $0x8003b4
+  800427:	e8 14 01 00 00       	call   800540 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80042c:	83 c4 08             	add    $0x8,%esp
+  80042f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800435:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80043b:	50                   	push   %eax
+  80043c:	e8 30 09 00 00       	call   800d71 <sys_cputs>
+
+	return b.cnt;
+}
+  800441:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800447:	c9                   	leave
+  800448:	c3                   	ret
+
+00800449 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80044f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800452:	50                   	push   %eax
+  800453:	ff 75 08             	push   0x8(%ebp)
+  800456:	e8 9d ff ff ff       	call   8003f8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+0080045d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	57                   	push   %edi
+  800461:	56                   	push   %esi
+  800462:	53                   	push   %ebx
+  800463:	83 ec 1c             	sub    $0x1c,%esp
+  800466:	89 c7                	mov    %eax,%edi
+  800468:	89 d6                	mov    %edx,%esi
+  80046a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800470:	89 d1                	mov    %edx,%ecx
+  800472:	89 c2                	mov    %eax,%edx
+  800474:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800477:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80047a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80047d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80048a:	39 c2                	cmp    %eax,%edx
+  80048c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80048f:	72 3e                	jb     8004cf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800491:	83 ec 0c             	sub    $0xc,%esp
+  800494:	ff 75 18             	push   0x18(%ebp)
+  800497:	83 eb 01             	sub    $0x1,%ebx
+  80049a:	53                   	push   %ebx
+  80049b:	50                   	push   %eax
+  80049c:	83 ec 08             	sub    $0x8,%esp
+  80049f:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a2:	ff 75 e0             	push   -0x20(%ebp)
+  8004a5:	ff 75 dc             	push   -0x24(%ebp)
+  8004a8:	ff 75 d8             	push   -0x28(%ebp)
+  8004ab:	e8 7f 48 00 00       	call   804d2f <__udivdi3>
+  8004b0:	83 c4 18             	add    $0x18,%esp
+  8004b3:	52                   	push   %edx
+  8004b4:	50                   	push   %eax
+  8004b5:	89 f2                	mov    %esi,%edx
+  8004b7:	89 f8                	mov    %edi,%eax
+  8004b9:	e8 9f ff ff ff       	call   80045d <printnum>
+  8004be:	83 c4 20             	add    $0x20,%esp
+  8004c1:	eb 13                	jmp    8004d6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004c3:	83 ec 08             	sub    $0x8,%esp
+  8004c6:	56                   	push   %esi
+  8004c7:	ff 75 18             	push   0x18(%ebp)
+  8004ca:	ff d7                	call   *%edi
+  8004cc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004cf:	83 eb 01             	sub    $0x1,%ebx
+  8004d2:	85 db                	test   %ebx,%ebx
+  8004d4:	7f ed                	jg     8004c3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	56                   	push   %esi
+  8004da:	83 ec 04             	sub    $0x4,%esp
+  8004dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8004e0:	ff 75 e0             	push   -0x20(%ebp)
+  8004e3:	ff 75 dc             	push   -0x24(%ebp)
+  8004e6:	ff 75 d8             	push   -0x28(%ebp)
+  8004e9:	e8 62 48 00 00       	call   804d50 <__umoddi3>
+  8004ee:	83 c4 14             	add    $0x14,%esp
+  8004f1:	0f be 80 ab 4f 80 00 	movsbl 0x804fab(%eax),%eax
+  8004f8:	50                   	push   %eax
+  8004f9:	ff d7                	call   *%edi
+}
+  8004fb:	83 c4 10             	add    $0x10,%esp
+  8004fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800501:	5b                   	pop    %ebx
+  800502:	5e                   	pop    %esi
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+
+00800506 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80050c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800510:	8b 10                	mov    (%eax),%edx
+  800512:	3b 50 04             	cmp    0x4(%eax),%edx
+  800515:	73 0a                	jae    800521 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800517:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80051a:	89 08                	mov    %ecx,(%eax)
+  80051c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051f:	88 02                	mov    %al,(%edx)
+}
+  800521:	5d                   	pop    %ebp
+  800522:	c3                   	ret
+
+00800523 <printfmt>:
+{
+  800523:	55                   	push   %ebp
+  800524:	89 e5                	mov    %esp,%ebp
+  800526:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800529:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80052c:	50                   	push   %eax
+  80052d:	ff 75 10             	push   0x10(%ebp)
+  800530:	ff 75 0c             	push   0xc(%ebp)
+  800533:	ff 75 08             	push   0x8(%ebp)
+  800536:	e8 05 00 00 00       	call   800540 <vprintfmt>
+}
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	c9                   	leave
+  80053f:	c3                   	ret
+
+00800540 <vprintfmt>:
+{
+  800540:	55                   	push   %ebp
+  800541:	89 e5                	mov    %esp,%ebp
+  800543:	57                   	push   %edi
+  800544:	56                   	push   %esi
+  800545:	53                   	push   %ebx
+  800546:	83 ec 2c             	sub    $0x2c,%esp
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80054f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800552:	eb 0a                	jmp    80055e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800554:	83 ec 08             	sub    $0x8,%esp
+  800557:	53                   	push   %ebx
+  800558:	50                   	push   %eax
+  800559:	ff d6                	call   *%esi
+  80055b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80055e:	83 c7 01             	add    $0x1,%edi
+  800561:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800565:	83 f8 25             	cmp    $0x25,%eax
+  800568:	74 0c                	je     800576 <vprintfmt+0x36>
+			if (ch == '\0')
+  80056a:	85 c0                	test   %eax,%eax
+  80056c:	75 e6                	jne    800554 <vprintfmt+0x14>
+}
+  80056e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800571:	5b                   	pop    %ebx
+  800572:	5e                   	pop    %esi
+  800573:	5f                   	pop    %edi
+  800574:	5d                   	pop    %ebp
+  800575:	c3                   	ret
+		padc = ' ';
+  800576:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80057a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800581:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800588:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80058f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800594:	8d 47 01             	lea    0x1(%edi),%eax
+  800597:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80059a:	0f b6 17             	movzbl (%edi),%edx
+  80059d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005a0:	3c 55                	cmp    $0x55,%al
+  8005a2:	0f 87 c5 03 00 00    	ja     80096d <vprintfmt+0x42d>
+  8005a8:	0f b6 c0             	movzbl %al,%eax
+  8005ab:	ff 24 85 20 51 80 00 	jmp    *0x805120(,%eax,4)
+  8005b2:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8005b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005b8:	eb da                	jmp    800594 <vprintfmt+0x54>
+  8005ba:	0f be d2             	movsbl %dl,%edx
+  8005bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005c8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005cb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005cf:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005d2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005d5:	83 f9 09             	cmp    $0x9,%ecx
+  8005d8:	77 55                	ja     80062f <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8005da:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005dd:	eb e9                	jmp    8005c8 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 00                	mov    (%eax),%eax
+  8005e4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8005f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005f3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005f7:	79 9b                	jns    800594 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005f9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ff:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800606:	eb 8c                	jmp    800594 <vprintfmt+0x54>
+			if (width < 0)
+  800608:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800612:	0f 49 c2             	cmovns %edx,%eax
+  800615:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800618:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80061b:	e9 74 ff ff ff       	jmp    800594 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800620:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800623:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80062a:	e9 65 ff ff ff       	jmp    800594 <vprintfmt+0x54>
+  80062f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800632:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800635:	eb bc                	jmp    8005f3 <vprintfmt+0xb3>
+			lflag++;
+  800637:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80063a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80063d:	e9 52 ff ff ff       	jmp    800594 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8d 78 04             	lea    0x4(%eax),%edi
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	ff 30                	push   (%eax)
+  80064e:	ff d6                	call   *%esi
+			break;
+  800650:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800653:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800656:	e9 b1 02 00 00       	jmp    80090c <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800661:	8b 10                	mov    (%eax),%edx
+  800663:	89 d0                	mov    %edx,%eax
+  800665:	f7 d8                	neg    %eax
+  800667:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80066a:	83 f8 14             	cmp    $0x14,%eax
+  80066d:	7f 23                	jg     800692 <vprintfmt+0x152>
+  80066f:	8b 14 85 80 52 80 00 	mov    0x805280(,%eax,4),%edx
+  800676:	85 d2                	test   %edx,%edx
+  800678:	74 18                	je     800692 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80067a:	52                   	push   %edx
+  80067b:	68 c3 54 80 00       	push   $0x8054c3
+  800680:	53                   	push   %ebx
+  800681:	56                   	push   %esi
+  800682:	e8 9c fe ff ff       	call   800523 <printfmt>
+  800687:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80068a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80068d:	e9 7a 02 00 00       	jmp    80090c <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800692:	50                   	push   %eax
+  800693:	68 c3 4f 80 00       	push   $0x804fc3
+  800698:	53                   	push   %ebx
+  800699:	56                   	push   %esi
+  80069a:	e8 84 fe ff ff       	call   800523 <printfmt>
+  80069f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006a2:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006a5:	e9 62 02 00 00       	jmp    80090c <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	83 c0 04             	add    $0x4,%eax
+  8006b0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006b8:	85 c9                	test   %ecx,%ecx
+  8006ba:	b8 bc 4f 80 00       	mov    $0x804fbc,%eax
+  8006bf:	0f 45 c1             	cmovne %ecx,%eax
+  8006c2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006c9:	7e 06                	jle    8006d1 <vprintfmt+0x191>
+  8006cb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006cf:	75 0b                	jne    8006dc <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006d4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006d7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006da:	eb 5c                	jmp    800738 <vprintfmt+0x1f8>
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	ff 75 d0             	push   -0x30(%ebp)
+  8006e2:	ff 75 cc             	push   -0x34(%ebp)
+  8006e5:	e8 20 03 00 00       	call   800a0a <strnlen>
+  8006ea:	89 c2                	mov    %eax,%edx
+  8006ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ef:	29 d0                	sub    %edx,%eax
+  8006f1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006f4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006fe:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800700:	eb 0e                	jmp    800710 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800702:	83 ec 08             	sub    $0x8,%esp
+  800705:	53                   	push   %ebx
+  800706:	57                   	push   %edi
+  800707:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80070a:	83 ee 01             	sub    $0x1,%esi
+  80070d:	83 c4 10             	add    $0x10,%esp
+  800710:	85 f6                	test   %esi,%esi
+  800712:	7f ee                	jg     800702 <vprintfmt+0x1c2>
+  800714:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800717:	8b 75 08             	mov    0x8(%ebp),%esi
+  80071a:	85 c0                	test   %eax,%eax
+  80071c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800721:	0f 49 d0             	cmovns %eax,%edx
+  800724:	29 d0                	sub    %edx,%eax
+  800726:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800729:	eb a6                	jmp    8006d1 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	52                   	push   %edx
+  800730:	ff 55 08             	call   *0x8(%ebp)
+  800733:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800736:	89 f1                	mov    %esi,%ecx
+  800738:	8d 71 01             	lea    0x1(%ecx),%esi
+  80073b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80073f:	0f be d0             	movsbl %al,%edx
+  800742:	85 d2                	test   %edx,%edx
+  800744:	74 28                	je     80076e <vprintfmt+0x22e>
+  800746:	85 ff                	test   %edi,%edi
+  800748:	78 05                	js     80074f <vprintfmt+0x20f>
+  80074a:	83 ef 01             	sub    $0x1,%edi
+  80074d:	78 30                	js     80077f <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80074f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800753:	74 d6                	je     80072b <vprintfmt+0x1eb>
+  800755:	0f be c0             	movsbl %al,%eax
+  800758:	83 e8 20             	sub    $0x20,%eax
+  80075b:	83 f8 5e             	cmp    $0x5e,%eax
+  80075e:	76 cb                	jbe    80072b <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800760:	83 ec 08             	sub    $0x8,%esp
+  800763:	53                   	push   %ebx
+  800764:	6a 3f                	push   $0x3f
+  800766:	ff 55 08             	call   *0x8(%ebp)
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	eb c8                	jmp    800736 <vprintfmt+0x1f6>
+  80076e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800771:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800774:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800777:	01 d0                	add    %edx,%eax
+  800779:	29 c8                	sub    %ecx,%eax
+  80077b:	89 c7                	mov    %eax,%edi
+  80077d:	eb 13                	jmp    800792 <vprintfmt+0x252>
+  80077f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800782:	eb ed                	jmp    800771 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	53                   	push   %ebx
+  800788:	6a 20                	push   $0x20
+  80078a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80078c:	83 ef 01             	sub    $0x1,%edi
+  80078f:	83 c4 10             	add    $0x10,%esp
+  800792:	85 ff                	test   %edi,%edi
+  800794:	7f ee                	jg     800784 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800796:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+  80079c:	e9 6b 01 00 00       	jmp    80090c <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8007a1:	83 f9 01             	cmp    $0x1,%ecx
+  8007a4:	7f 1f                	jg     8007c5 <vprintfmt+0x285>
+	else if (lflag)
+  8007a6:	85 c9                	test   %ecx,%ecx
+  8007a8:	74 67                	je     800811 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8b 00                	mov    (%eax),%eax
+  8007af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007b2:	89 c1                	mov    %eax,%ecx
+  8007b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c3:	eb 17                	jmp    8007dc <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 50 04             	mov    0x4(%eax),%edx
+  8007cb:	8b 00                	mov    (%eax),%eax
+  8007cd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007e7:	85 c9                	test   %ecx,%ecx
+  8007e9:	0f 89 03 01 00 00    	jns    8008f2 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 2d                	push   $0x2d
+  8007f5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007f7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007fa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007fd:	f7 da                	neg    %edx
+  8007ff:	83 d1 00             	adc    $0x0,%ecx
+  800802:	f7 d9                	neg    %ecx
+  800804:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800807:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80080c:	e9 e1 00 00 00       	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800811:	8b 45 14             	mov    0x14(%ebp),%eax
+  800814:	8b 00                	mov    (%eax),%eax
+  800816:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800819:	89 c1                	mov    %eax,%ecx
+  80081b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80081e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	8d 40 04             	lea    0x4(%eax),%eax
+  800827:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082a:	eb b0                	jmp    8007dc <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80082c:	83 f9 01             	cmp    $0x1,%ecx
+  80082f:	7f 1e                	jg     80084f <vprintfmt+0x30f>
+	else if (lflag)
+  800831:	85 c9                	test   %ecx,%ecx
+  800833:	74 32                	je     800867 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8b 10                	mov    (%eax),%edx
+  80083a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083f:	8d 40 04             	lea    0x4(%eax),%eax
+  800842:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800845:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80084a:	e9 a3 00 00 00       	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80084f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800852:	8b 10                	mov    (%eax),%edx
+  800854:	8b 48 04             	mov    0x4(%eax),%ecx
+  800857:	8d 40 08             	lea    0x8(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80085d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800862:	e9 8b 00 00 00       	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 10                	mov    (%eax),%edx
+  80086c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800877:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80087c:	eb 74                	jmp    8008f2 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80087e:	83 f9 01             	cmp    $0x1,%ecx
+  800881:	7f 1b                	jg     80089e <vprintfmt+0x35e>
+	else if (lflag)
+  800883:	85 c9                	test   %ecx,%ecx
+  800885:	74 2c                	je     8008b3 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088a:	8b 10                	mov    (%eax),%edx
+  80088c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800891:	8d 40 04             	lea    0x4(%eax),%eax
+  800894:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800897:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80089c:	eb 54                	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80089e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a1:	8b 10                	mov    (%eax),%edx
+  8008a3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008ac:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008b1:	eb 3f                	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	8b 10                	mov    (%eax),%edx
+  8008b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008c3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008c8:	eb 28                	jmp    8008f2 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8008ca:	83 ec 08             	sub    $0x8,%esp
+  8008cd:	53                   	push   %ebx
+  8008ce:	6a 30                	push   $0x30
+  8008d0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008d2:	83 c4 08             	add    $0x8,%esp
+  8008d5:	53                   	push   %ebx
+  8008d6:	6a 78                	push   $0x78
+  8008d8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dd:	8b 10                	mov    (%eax),%edx
+  8008df:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008e4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ed:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008f2:	83 ec 0c             	sub    $0xc,%esp
+  8008f5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008f9:	50                   	push   %eax
+  8008fa:	ff 75 e0             	push   -0x20(%ebp)
+  8008fd:	57                   	push   %edi
+  8008fe:	51                   	push   %ecx
+  8008ff:	52                   	push   %edx
+  800900:	89 da                	mov    %ebx,%edx
+  800902:	89 f0                	mov    %esi,%eax
+  800904:	e8 54 fb ff ff       	call   80045d <printnum>
+			break;
+  800909:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80090c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80090f:	e9 4a fc ff ff       	jmp    80055e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800914:	83 f9 01             	cmp    $0x1,%ecx
+  800917:	7f 1b                	jg     800934 <vprintfmt+0x3f4>
+	else if (lflag)
+  800919:	85 c9                	test   %ecx,%ecx
+  80091b:	74 2c                	je     800949 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80091d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800920:	8b 10                	mov    (%eax),%edx
+  800922:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800927:	8d 40 04             	lea    0x4(%eax),%eax
+  80092a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80092d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800932:	eb be                	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800934:	8b 45 14             	mov    0x14(%ebp),%eax
+  800937:	8b 10                	mov    (%eax),%edx
+  800939:	8b 48 04             	mov    0x4(%eax),%ecx
+  80093c:	8d 40 08             	lea    0x8(%eax),%eax
+  80093f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800942:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800947:	eb a9                	jmp    8008f2 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800949:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094c:	8b 10                	mov    (%eax),%edx
+  80094e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800953:	8d 40 04             	lea    0x4(%eax),%eax
+  800956:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800959:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80095e:	eb 92                	jmp    8008f2 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800960:	83 ec 08             	sub    $0x8,%esp
+  800963:	53                   	push   %ebx
+  800964:	6a 25                	push   $0x25
+  800966:	ff d6                	call   *%esi
+			break;
+  800968:	83 c4 10             	add    $0x10,%esp
+  80096b:	eb 9f                	jmp    80090c <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80096d:	83 ec 08             	sub    $0x8,%esp
+  800970:	53                   	push   %ebx
+  800971:	6a 25                	push   $0x25
+  800973:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800975:	83 c4 10             	add    $0x10,%esp
+  800978:	89 f8                	mov    %edi,%eax
+  80097a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80097e:	74 05                	je     800985 <vprintfmt+0x445>
+  800980:	83 e8 01             	sub    $0x1,%eax
+  800983:	eb f5                	jmp    80097a <vprintfmt+0x43a>
+  800985:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800988:	eb 82                	jmp    80090c <vprintfmt+0x3cc>
+
+0080098a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	83 ec 18             	sub    $0x18,%esp
+  800990:	8b 45 08             	mov    0x8(%ebp),%eax
+  800993:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800996:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800999:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80099d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009a7:	85 c0                	test   %eax,%eax
+  8009a9:	74 26                	je     8009d1 <vsnprintf+0x47>
+  8009ab:	85 d2                	test   %edx,%edx
+  8009ad:	7e 22                	jle    8009d1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009af:	ff 75 14             	push   0x14(%ebp)
+  8009b2:	ff 75 10             	push   0x10(%ebp)
+  8009b5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009b8:	50                   	push   %eax
+  8009b9:	68 06 05 80 00       	push   $0x800506
+  8009be:	e8 7d fb ff ff       	call   800540 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009c3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009c6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009cc:	83 c4 10             	add    $0x10,%esp
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+		return -E_INVAL;
+  8009d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009d6:	eb f7                	jmp    8009cf <vsnprintf+0x45>
+
+008009d8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009de:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009e1:	50                   	push   %eax
+  8009e2:	ff 75 10             	push   0x10(%ebp)
+  8009e5:	ff 75 0c             	push   0xc(%ebp)
+  8009e8:	ff 75 08             	push   0x8(%ebp)
+  8009eb:	e8 9a ff ff ff       	call   80098a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009f0:	c9                   	leave
+  8009f1:	c3                   	ret
+
+008009f2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fd:	eb 03                	jmp    800a02 <strlen+0x10>
+		n++;
+  8009ff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a02:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a06:	75 f7                	jne    8009ff <strlen+0xd>
+	return n;
+}
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+
+00800a0a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a10:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a18:	eb 03                	jmp    800a1d <strnlen+0x13>
+		n++;
+  800a1a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a1d:	39 d0                	cmp    %edx,%eax
+  800a1f:	74 08                	je     800a29 <strnlen+0x1f>
+  800a21:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a25:	75 f3                	jne    800a1a <strnlen+0x10>
+  800a27:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a29:	89 d0                	mov    %edx,%eax
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	53                   	push   %ebx
+  800a31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a40:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a43:	83 c0 01             	add    $0x1,%eax
+  800a46:	84 d2                	test   %dl,%dl
+  800a48:	75 f2                	jne    800a3c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a4a:	89 c8                	mov    %ecx,%eax
+  800a4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+00800a51 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	53                   	push   %ebx
+  800a55:	83 ec 10             	sub    $0x10,%esp
+  800a58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a5b:	53                   	push   %ebx
+  800a5c:	e8 91 ff ff ff       	call   8009f2 <strlen>
+  800a61:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a64:	ff 75 0c             	push   0xc(%ebp)
+  800a67:	01 d8                	add    %ebx,%eax
+  800a69:	50                   	push   %eax
+  800a6a:	e8 be ff ff ff       	call   800a2d <strcpy>
+	return dst;
+}
+  800a6f:	89 d8                	mov    %ebx,%eax
+  800a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a74:	c9                   	leave
+  800a75:	c3                   	ret
+
+00800a76 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	56                   	push   %esi
+  800a7a:	53                   	push   %ebx
+  800a7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a81:	89 f3                	mov    %esi,%ebx
+  800a83:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a86:	89 f0                	mov    %esi,%eax
+  800a88:	eb 0f                	jmp    800a99 <strncpy+0x23>
+		*dst++ = *src;
+  800a8a:	83 c0 01             	add    $0x1,%eax
+  800a8d:	0f b6 0a             	movzbl (%edx),%ecx
+  800a90:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a93:	80 f9 01             	cmp    $0x1,%cl
+  800a96:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a99:	39 d8                	cmp    %ebx,%eax
+  800a9b:	75 ed                	jne    800a8a <strncpy+0x14>
+	}
+	return ret;
+}
+  800a9d:	89 f0                	mov    %esi,%eax
+  800a9f:	5b                   	pop    %ebx
+  800aa0:	5e                   	pop    %esi
+  800aa1:	5d                   	pop    %ebp
+  800aa2:	c3                   	ret
+
+00800aa3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aa3:	55                   	push   %ebp
+  800aa4:	89 e5                	mov    %esp,%ebp
+  800aa6:	56                   	push   %esi
+  800aa7:	53                   	push   %ebx
+  800aa8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aae:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ab1:	89 f0                	mov    %esi,%eax
+  800ab3:	85 d2                	test   %edx,%edx
+  800ab5:	74 21                	je     800ad8 <strlcpy+0x35>
+  800ab7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800abb:	89 f2                	mov    %esi,%edx
+  800abd:	eb 09                	jmp    800ac8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800abf:	83 c1 01             	add    $0x1,%ecx
+  800ac2:	83 c2 01             	add    $0x1,%edx
+  800ac5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ac8:	39 c2                	cmp    %eax,%edx
+  800aca:	74 09                	je     800ad5 <strlcpy+0x32>
+  800acc:	0f b6 19             	movzbl (%ecx),%ebx
+  800acf:	84 db                	test   %bl,%bl
+  800ad1:	75 ec                	jne    800abf <strlcpy+0x1c>
+  800ad3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ad5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ad8:	29 f0                	sub    %esi,%eax
+}
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ae7:	eb 06                	jmp    800aef <strcmp+0x11>
+		p++, q++;
+  800ae9:	83 c1 01             	add    $0x1,%ecx
+  800aec:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800aef:	0f b6 01             	movzbl (%ecx),%eax
+  800af2:	84 c0                	test   %al,%al
+  800af4:	74 04                	je     800afa <strcmp+0x1c>
+  800af6:	3a 02                	cmp    (%edx),%al
+  800af8:	74 ef                	je     800ae9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800afa:	0f b6 c0             	movzbl %al,%eax
+  800afd:	0f b6 12             	movzbl (%edx),%edx
+  800b00:	29 d0                	sub    %edx,%eax
+}
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+
+00800b04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	53                   	push   %ebx
+  800b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b11:	eb 09                	jmp    800b1c <strncmp+0x18>
+		n--, p++, q++;
+  800b13:	83 ea 01             	sub    $0x1,%edx
+  800b16:	83 c0 01             	add    $0x1,%eax
+  800b19:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b1c:	85 d2                	test   %edx,%edx
+  800b1e:	74 18                	je     800b38 <strncmp+0x34>
+  800b20:	0f b6 18             	movzbl (%eax),%ebx
+  800b23:	84 db                	test   %bl,%bl
+  800b25:	74 04                	je     800b2b <strncmp+0x27>
+  800b27:	3a 19                	cmp    (%ecx),%bl
+  800b29:	74 e8                	je     800b13 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b2b:	0f b6 00             	movzbl (%eax),%eax
+  800b2e:	0f b6 11             	movzbl (%ecx),%edx
+  800b31:	29 d0                	sub    %edx,%eax
+}
+  800b33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+		return 0;
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3d:	eb f4                	jmp    800b33 <strncmp+0x2f>
+
+00800b3f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b45:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b49:	eb 03                	jmp    800b4e <strchr+0xf>
+  800b4b:	83 c0 01             	add    $0x1,%eax
+  800b4e:	0f b6 10             	movzbl (%eax),%edx
+  800b51:	84 d2                	test   %dl,%dl
+  800b53:	74 06                	je     800b5b <strchr+0x1c>
+		if (*s == c)
+  800b55:	38 ca                	cmp    %cl,%dl
+  800b57:	75 f2                	jne    800b4b <strchr+0xc>
+  800b59:	eb 05                	jmp    800b60 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b60:	5d                   	pop    %ebp
+  800b61:	c3                   	ret
+
+00800b62 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b68:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b6c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b6f:	38 ca                	cmp    %cl,%dl
+  800b71:	74 09                	je     800b7c <strfind+0x1a>
+  800b73:	84 d2                	test   %dl,%dl
+  800b75:	74 05                	je     800b7c <strfind+0x1a>
+	for (; *s; s++)
+  800b77:	83 c0 01             	add    $0x1,%eax
+  800b7a:	eb f0                	jmp    800b6c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b7c:	5d                   	pop    %ebp
+  800b7d:	c3                   	ret
+
+00800b7e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b7e:	55                   	push   %ebp
+  800b7f:	89 e5                	mov    %esp,%ebp
+  800b81:	57                   	push   %edi
+  800b82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b85:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b88:	85 c9                	test   %ecx,%ecx
+  800b8a:	74 20                	je     800bac <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b8c:	89 f8                	mov    %edi,%eax
+  800b8e:	09 c8                	or     %ecx,%eax
+  800b90:	a8 03                	test   $0x3,%al
+  800b92:	75 12                	jne    800ba6 <memset+0x28>
+		c &= 0xFF;
+  800b94:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b98:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b9e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ba1:	fc                   	cld
+  800ba2:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ba4:	eb 06                	jmp    800bac <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba9:	fc                   	cld
+  800baa:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bac:	89 f8                	mov    %edi,%eax
+  800bae:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bb1:	c9                   	leave
+  800bb2:	c3                   	ret
+
+00800bb3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	57                   	push   %edi
+  800bb7:	56                   	push   %esi
+  800bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bbe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bc1:	39 c6                	cmp    %eax,%esi
+  800bc3:	73 32                	jae    800bf7 <memmove+0x44>
+  800bc5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bc8:	39 d0                	cmp    %edx,%eax
+  800bca:	73 2b                	jae    800bf7 <memmove+0x44>
+		s += n;
+		d += n;
+  800bcc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bcf:	89 d6                	mov    %edx,%esi
+  800bd1:	09 fe                	or     %edi,%esi
+  800bd3:	09 ce                	or     %ecx,%esi
+  800bd5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bdb:	75 0e                	jne    800beb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bdd:	83 ef 04             	sub    $0x4,%edi
+  800be0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800be3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800be6:	fd                   	std
+  800be7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be9:	eb 09                	jmp    800bf4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800beb:	83 ef 01             	sub    $0x1,%edi
+  800bee:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bf1:	fd                   	std
+  800bf2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bf4:	fc                   	cld
+  800bf5:	eb 1a                	jmp    800c11 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf7:	89 f2                	mov    %esi,%edx
+  800bf9:	09 c2                	or     %eax,%edx
+  800bfb:	09 ca                	or     %ecx,%edx
+  800bfd:	f6 c2 03             	test   $0x3,%dl
+  800c00:	75 0a                	jne    800c0c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c02:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c05:	89 c7                	mov    %eax,%edi
+  800c07:	fc                   	cld
+  800c08:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0a:	eb 05                	jmp    800c11 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c0c:	89 c7                	mov    %eax,%edi
+  800c0e:	fc                   	cld
+  800c0f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+
+00800c15 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c15:	55                   	push   %ebp
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c1b:	ff 75 10             	push   0x10(%ebp)
+  800c1e:	ff 75 0c             	push   0xc(%ebp)
+  800c21:	ff 75 08             	push   0x8(%ebp)
+  800c24:	e8 8a ff ff ff       	call   800bb3 <memmove>
+}
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+
+00800c2b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+  800c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c36:	89 c6                	mov    %eax,%esi
+  800c38:	03 75 10             	add    0x10(%ebp),%esi
+  800c3b:	eb 06                	jmp    800c43 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c3d:	83 c0 01             	add    $0x1,%eax
+  800c40:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c43:	39 f0                	cmp    %esi,%eax
+  800c45:	74 14                	je     800c5b <memcmp+0x30>
+		if (*s1 != *s2)
+  800c47:	0f b6 08             	movzbl (%eax),%ecx
+  800c4a:	0f b6 1a             	movzbl (%edx),%ebx
+  800c4d:	38 d9                	cmp    %bl,%cl
+  800c4f:	74 ec                	je     800c3d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c51:	0f b6 c1             	movzbl %cl,%eax
+  800c54:	0f b6 db             	movzbl %bl,%ebx
+  800c57:	29 d8                	sub    %ebx,%eax
+  800c59:	eb 05                	jmp    800c60 <memcmp+0x35>
+	}
+
+	return 0;
+  800c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c6d:	89 c2                	mov    %eax,%edx
+  800c6f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c72:	eb 03                	jmp    800c77 <memfind+0x13>
+  800c74:	83 c0 01             	add    $0x1,%eax
+  800c77:	39 d0                	cmp    %edx,%eax
+  800c79:	73 04                	jae    800c7f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c7b:	38 08                	cmp    %cl,(%eax)
+  800c7d:	75 f5                	jne    800c74 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	57                   	push   %edi
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+  800c87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c8d:	eb 03                	jmp    800c92 <strtol+0x11>
+		s++;
+  800c8f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c92:	0f b6 02             	movzbl (%edx),%eax
+  800c95:	3c 20                	cmp    $0x20,%al
+  800c97:	74 f6                	je     800c8f <strtol+0xe>
+  800c99:	3c 09                	cmp    $0x9,%al
+  800c9b:	74 f2                	je     800c8f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c9d:	3c 2b                	cmp    $0x2b,%al
+  800c9f:	74 2a                	je     800ccb <strtol+0x4a>
+	int neg = 0;
+  800ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ca6:	3c 2d                	cmp    $0x2d,%al
+  800ca8:	74 2b                	je     800cd5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800caa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cb0:	75 0f                	jne    800cc1 <strtol+0x40>
+  800cb2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cb5:	74 28                	je     800cdf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cb7:	85 db                	test   %ebx,%ebx
+  800cb9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cbe:	0f 44 d8             	cmove  %eax,%ebx
+  800cc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cc9:	eb 46                	jmp    800d11 <strtol+0x90>
+		s++;
+  800ccb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cce:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cd3:	eb d5                	jmp    800caa <strtol+0x29>
+		s++, neg = 1;
+  800cd5:	83 c2 01             	add    $0x1,%edx
+  800cd8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cdd:	eb cb                	jmp    800caa <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cdf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ce3:	74 0e                	je     800cf3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ce5:	85 db                	test   %ebx,%ebx
+  800ce7:	75 d8                	jne    800cc1 <strtol+0x40>
+		s++, base = 8;
+  800ce9:	83 c2 01             	add    $0x1,%edx
+  800cec:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cf1:	eb ce                	jmp    800cc1 <strtol+0x40>
+		s += 2, base = 16;
+  800cf3:	83 c2 02             	add    $0x2,%edx
+  800cf6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cfb:	eb c4                	jmp    800cc1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cfd:	0f be c0             	movsbl %al,%eax
+  800d00:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d03:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d06:	7d 3a                	jge    800d42 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d08:	83 c2 01             	add    $0x1,%edx
+  800d0b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d0f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d11:	0f b6 02             	movzbl (%edx),%eax
+  800d14:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d17:	89 f3                	mov    %esi,%ebx
+  800d19:	80 fb 09             	cmp    $0x9,%bl
+  800d1c:	76 df                	jbe    800cfd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d1e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d21:	89 f3                	mov    %esi,%ebx
+  800d23:	80 fb 19             	cmp    $0x19,%bl
+  800d26:	77 08                	ja     800d30 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d28:	0f be c0             	movsbl %al,%eax
+  800d2b:	83 e8 57             	sub    $0x57,%eax
+  800d2e:	eb d3                	jmp    800d03 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d30:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d33:	89 f3                	mov    %esi,%ebx
+  800d35:	80 fb 19             	cmp    $0x19,%bl
+  800d38:	77 08                	ja     800d42 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d3a:	0f be c0             	movsbl %al,%eax
+  800d3d:	83 e8 37             	sub    $0x37,%eax
+  800d40:	eb c1                	jmp    800d03 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d42:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d46:	74 05                	je     800d4d <strtol+0xcc>
+		*endptr = (char *) s;
+  800d48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d4d:	89 c8                	mov    %ecx,%eax
+  800d4f:	f7 d8                	neg    %eax
+  800d51:	85 ff                	test   %edi,%edi
+  800d53:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d56:	89 c8                	mov    %ecx,%eax
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+
+00800d5d <atoi>:
+
+int
+atoi(const char* s)
+{
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800d63:	6a 00                	push   $0x0
+  800d65:	6a 00                	push   $0x0
+  800d67:	ff 75 08             	push   0x8(%ebp)
+  800d6a:	e8 12 ff ff ff       	call   800c81 <strtol>
+}
+  800d6f:	c9                   	leave
+  800d70:	c3                   	ret
+
+00800d71 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	89 c3                	mov    %eax,%ebx
+  800d83:	89 c7                	mov    %eax,%edi
+  800d85:	6a 00                	push   $0x0
+  800d87:	55                   	push   %ebp
+  800d88:	56                   	push   %esi
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	8d 35 93 0d 80 00    	lea    0x800d93,%esi
+  800d91:	0f 34                	sysenter
+
+00800d93 <after_sysenter_label_47>:
+  800d93:	5e                   	pop    %esi
+  800d94:	5d                   	pop    %ebp
+  800d95:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d98:	5b                   	pop    %ebx
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+
+00800d9c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dab:	89 d1                	mov    %edx,%ecx
+  800dad:	89 d3                	mov    %edx,%ebx
+  800daf:	89 d7                	mov    %edx,%edi
+  800db1:	6a 00                	push   $0x0
+  800db3:	55                   	push   %ebp
+  800db4:	56                   	push   %esi
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	8d 35 bf 0d 80 00    	lea    0x800dbf,%esi
+  800dbd:	0f 34                	sysenter
+
+00800dbf <after_sysenter_label_128>:
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+
+00800dc8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dda:	89 cb                	mov    %ecx,%ebx
+  800ddc:	89 cf                	mov    %ecx,%edi
+  800dde:	6a 00                	push   $0x0
+  800de0:	55                   	push   %ebp
+  800de1:	56                   	push   %esi
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	8d 35 ec 0d 80 00    	lea    0x800dec,%esi
+  800dea:	0f 34                	sysenter
+
+00800dec <after_sysenter_label_212>:
+  800dec:	5e                   	pop    %esi
+  800ded:	5d                   	pop    %ebp
+  800dee:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	7f 07                	jg     800dfc <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df8:	5b                   	pop    %ebx
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 03                	push   $0x3
+  800e02:	68 15 53 80 00       	push   $0x805315
+  800e07:	6a 54                	push   $0x54
+  800e09:	68 32 53 80 00       	push   $0x805332
+  800e0e:	e8 5b f5 ff ff       	call   80036e <_panic>
+
+00800e13 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e22:	89 d1                	mov    %edx,%ecx
+  800e24:	89 d3                	mov    %edx,%ebx
+  800e26:	89 d7                	mov    %edx,%edi
+  800e28:	6a 00                	push   $0x0
+  800e2a:	55                   	push   %ebp
+  800e2b:	56                   	push   %esi
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	8d 35 36 0e 80 00    	lea    0x800e36,%esi
+  800e34:	0f 34                	sysenter
+
+00800e36 <after_sysenter_label_309>:
+  800e36:	5e                   	pop    %esi
+  800e37:	5d                   	pop    %ebp
+  800e38:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+
+00800e3f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	57                   	push   %edi
+  800e43:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e49:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e4e:	89 d1                	mov    %edx,%ecx
+  800e50:	89 d3                	mov    %edx,%ebx
+  800e52:	89 d7                	mov    %edx,%edi
+  800e54:	6a 00                	push   $0x0
+  800e56:	55                   	push   %ebp
+  800e57:	56                   	push   %esi
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+
+00800e62 <after_sysenter_label_391>:
+  800e62:	5e                   	pop    %esi
+  800e63:	5d                   	pop    %ebp
+  800e64:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e67:	5b                   	pop    %ebx
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+
+00800e6b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e76:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e83:	6a 00                	push   $0x0
+  800e85:	55                   	push   %ebp
+  800e86:	56                   	push   %esi
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	8d 35 91 0e 80 00    	lea    0x800e91,%esi
+  800e8f:	0f 34                	sysenter
+
+00800e91 <after_sysenter_label_479>:
+  800e91:	5e                   	pop    %esi
+  800e92:	5d                   	pop    %ebp
+  800e93:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e96:	85 c0                	test   %eax,%eax
+  800e98:	7f 07                	jg     800ea1 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+  800ea4:	50                   	push   %eax
+  800ea5:	6a 04                	push   $0x4
+  800ea7:	68 15 53 80 00       	push   $0x805315
+  800eac:	6a 54                	push   $0x54
+  800eae:	68 32 53 80 00       	push   $0x805332
+  800eb3:	e8 b6 f4 ff ff       	call   80036e <_panic>
+
+00800eb8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ec8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ece:	ff 75 18             	push   0x18(%ebp)
+  800ed1:	55                   	push   %ebp
+  800ed2:	56                   	push   %esi
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	8d 35 dd 0e 80 00    	lea    0x800edd,%esi
+  800edb:	0f 34                	sysenter
+
+00800edd <after_sysenter_label_593>:
+  800edd:	5e                   	pop    %esi
+  800ede:	5d                   	pop    %ebp
+  800edf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	7f 07                	jg     800eed <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ee6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ee9:	5b                   	pop    %ebx
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+  800ef0:	50                   	push   %eax
+  800ef1:	6a 05                	push   $0x5
+  800ef3:	68 15 53 80 00       	push   $0x805315
+  800ef8:	6a 54                	push   $0x54
+  800efa:	68 32 53 80 00       	push   $0x805332
+  800eff:	e8 6a f4 ff ff       	call   80036e <_panic>
+
+00800f04 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	6a 00                	push   $0x0
+  800f1d:	55                   	push   %ebp
+  800f1e:	56                   	push   %esi
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	8d 35 29 0f 80 00    	lea    0x800f29,%esi
+  800f27:	0f 34                	sysenter
+
+00800f29 <after_sysenter_label_704>:
+  800f29:	5e                   	pop    %esi
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	7f 07                	jg     800f39 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f35:	5b                   	pop    %ebx
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	50                   	push   %eax
+  800f3d:	6a 06                	push   $0x6
+  800f3f:	68 15 53 80 00       	push   $0x805315
+  800f44:	6a 54                	push   $0x54
+  800f46:	68 32 53 80 00       	push   $0x805332
+  800f4b:	e8 1e f4 ff ff       	call   80036e <_panic>
+
+00800f50 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	57                   	push   %edi
+  800f54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f65:	89 df                	mov    %ebx,%edi
+  800f67:	6a 00                	push   $0x0
+  800f69:	55                   	push   %ebp
+  800f6a:	56                   	push   %esi
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	8d 35 75 0f 80 00    	lea    0x800f75,%esi
+  800f73:	0f 34                	sysenter
+
+00800f75 <after_sysenter_label_808>:
+  800f75:	5e                   	pop    %esi
+  800f76:	5d                   	pop    %ebp
+  800f77:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 07                	jg     800f85 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5f                   	pop    %edi
+  800f83:	5d                   	pop    %ebp
+  800f84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f85:	83 ec 0c             	sub    $0xc,%esp
+  800f88:	50                   	push   %eax
+  800f89:	6a 08                	push   $0x8
+  800f8b:	68 15 53 80 00       	push   $0x805315
+  800f90:	6a 54                	push   $0x54
+  800f92:	68 32 53 80 00       	push   $0x805332
+  800f97:	e8 d2 f3 ff ff       	call   80036e <_panic>
+
+00800f9c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	57                   	push   %edi
+  800fa0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fac:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fb1:	89 df                	mov    %ebx,%edi
+  800fb3:	6a 00                	push   $0x0
+  800fb5:	55                   	push   %ebp
+  800fb6:	56                   	push   %esi
+  800fb7:	89 e5                	mov    %esp,%ebp
+  800fb9:	8d 35 c1 0f 80 00    	lea    0x800fc1,%esi
+  800fbf:	0f 34                	sysenter
+
+00800fc1 <after_sysenter_label_912>:
+  800fc1:	5e                   	pop    %esi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	7f 07                	jg     800fd1 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	50                   	push   %eax
+  800fd5:	6a 09                	push   $0x9
+  800fd7:	68 15 53 80 00       	push   $0x805315
+  800fdc:	6a 54                	push   $0x54
+  800fde:	68 32 53 80 00       	push   $0x805332
+  800fe3:	e8 86 f3 ff ff       	call   80036e <_panic>
+
+00800fe8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ffd:	89 df                	mov    %ebx,%edi
+  800fff:	6a 00                	push   $0x0
+  801001:	55                   	push   %ebp
+  801002:	56                   	push   %esi
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	8d 35 0d 10 80 00    	lea    0x80100d,%esi
+  80100b:	0f 34                	sysenter
+
+0080100d <after_sysenter_label_1016>:
+  80100d:	5e                   	pop    %esi
+  80100e:	5d                   	pop    %ebp
+  80100f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801012:	85 c0                	test   %eax,%eax
+  801014:	7f 07                	jg     80101d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801016:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801019:	5b                   	pop    %ebx
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  801020:	50                   	push   %eax
+  801021:	6a 0a                	push   $0xa
+  801023:	68 15 53 80 00       	push   $0x805315
+  801028:	6a 54                	push   $0x54
+  80102a:	68 32 53 80 00       	push   $0x805332
+  80102f:	e8 3a f3 ff ff       	call   80036e <_panic>
+
+00801034 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801044:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801047:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104a:	6a 00                	push   $0x0
+  80104c:	55                   	push   %ebp
+  80104d:	56                   	push   %esi
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	8d 35 58 10 80 00    	lea    0x801058,%esi
+  801056:	0f 34                	sysenter
+
+00801058 <after_sysenter_label_1126>:
+  801058:	5e                   	pop    %esi
+  801059:	5d                   	pop    %ebp
+  80105a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5f                   	pop    %edi
+  80105f:	5d                   	pop    %ebp
+  801060:	c3                   	ret
+
+00801061 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	57                   	push   %edi
+  801065:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801073:	89 cb                	mov    %ecx,%ebx
+  801075:	89 cf                	mov    %ecx,%edi
+  801077:	6a 00                	push   $0x0
+  801079:	55                   	push   %ebp
+  80107a:	56                   	push   %esi
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+
+00801085 <after_sysenter_label_1210>:
+  801085:	5e                   	pop    %esi
+  801086:	5d                   	pop    %ebp
+  801087:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80108a:	85 c0                	test   %eax,%eax
+  80108c:	7f 07                	jg     801095 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80108e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801091:	5b                   	pop    %ebx
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 0d                	push   $0xd
+  80109b:	68 15 53 80 00       	push   $0x805315
+  8010a0:	6a 54                	push   $0x54
+  8010a2:	68 32 53 80 00       	push   $0x805332
+  8010a7:	e8 c2 f2 ff ff       	call   80036e <_panic>
+
+008010ac <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	b8 42 00 00 00       	mov    $0x42,%eax
+  8010c1:	89 df                	mov    %ebx,%edi
+  8010c3:	6a 00                	push   $0x0
+  8010c5:	55                   	push   %ebp
+  8010c6:	56                   	push   %esi
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	8d 35 d1 10 80 00    	lea    0x8010d1,%esi
+  8010cf:	0f 34                	sysenter
+
+008010d1 <after_sysenter_label_1311>:
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	7f 07                	jg     8010e1 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8010da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5f                   	pop    %edi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	50                   	push   %eax
+  8010e5:	6a 42                	push   $0x42
+  8010e7:	68 15 53 80 00       	push   $0x805315
+  8010ec:	6a 54                	push   $0x54
+  8010ee:	68 32 53 80 00       	push   $0x805332
+  8010f3:	e8 76 f2 ff ff       	call   80036e <_panic>
+
+008010f8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801102:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801107:	89 d1                	mov    %edx,%ecx
+  801109:	89 d3                	mov    %edx,%ebx
+  80110b:	89 d7                	mov    %edx,%edi
+  80110d:	6a 00                	push   $0x0
+  80110f:	55                   	push   %ebp
+  801110:	56                   	push   %esi
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	8d 35 1b 11 80 00    	lea    0x80111b,%esi
+  801119:	0f 34                	sysenter
+
+0080111b <after_sysenter_label_1411>:
+  80111b:	5e                   	pop    %esi
+  80111c:	5d                   	pop    %ebp
+  80111d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801120:	5b                   	pop    %ebx
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801129:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801131:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801134:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801139:	89 df                	mov    %ebx,%edi
+  80113b:	6a 00                	push   $0x0
+  80113d:	55                   	push   %ebp
+  80113e:	56                   	push   %esi
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	8d 35 49 11 80 00    	lea    0x801149,%esi
+  801147:	0f 34                	sysenter
+
+00801149 <after_sysenter_label_1497>:
+  801149:	5e                   	pop    %esi
+  80114a:	5d                   	pop    %ebp
+  80114b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80114e:	5b                   	pop    %ebx
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+
+00801152 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801152:	55                   	push   %ebp
+  801153:	89 e5                	mov    %esp,%ebp
+  801155:	57                   	push   %edi
+  801156:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801157:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801162:	b8 10 00 00 00       	mov    $0x10,%eax
+  801167:	89 df                	mov    %ebx,%edi
+  801169:	6a 00                	push   $0x0
+  80116b:	55                   	push   %ebp
+  80116c:	56                   	push   %esi
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	8d 35 77 11 80 00    	lea    0x801177,%esi
+  801175:	0f 34                	sysenter
+
+00801177 <after_sysenter_label_1583>:
+  801177:	5e                   	pop    %esi
+  801178:	5d                   	pop    %ebp
+  801179:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80117c:	5b                   	pop    %ebx
+  80117d:	5f                   	pop    %edi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+
+00801180 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	57                   	push   %edi
+  801184:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801190:	bf 00 00 00 00       	mov    $0x0,%edi
+  801195:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801198:	6a 00                	push   $0x0
+  80119a:	55                   	push   %ebp
+  80119b:	56                   	push   %esi
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	8d 35 a6 11 80 00    	lea    0x8011a6,%esi
+  8011a4:	0f 34                	sysenter
+
+008011a6 <after_sysenter_label_1672>:
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	57                   	push   %edi
+  8011b3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011c4:	89 df                	mov    %ebx,%edi
+  8011c6:	6a 00                	push   $0x0
+  8011c8:	55                   	push   %ebp
+  8011c9:	56                   	push   %esi
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	8d 35 d4 11 80 00    	lea    0x8011d4,%esi
+  8011d2:	0f 34                	sysenter
+
+008011d4 <after_sysenter_label_1758>:
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8011d9:	5b                   	pop    %ebx
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ea:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011ef:	89 cb                	mov    %ecx,%ebx
+  8011f1:	89 cf                	mov    %ecx,%edi
+  8011f3:	6a 00                	push   $0x0
+  8011f5:	55                   	push   %ebp
+  8011f6:	56                   	push   %esi
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	8d 35 01 12 80 00    	lea    0x801201,%esi
+  8011ff:	0f 34                	sysenter
+
+00801201 <after_sysenter_label_1842>:
+  801201:	5e                   	pop    %esi
+  801202:	5d                   	pop    %ebp
+  801203:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801206:	85 c0                	test   %eax,%eax
+  801208:	7f 07                	jg     801211 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80120a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80120d:	5b                   	pop    %ebx
+  80120e:	5f                   	pop    %edi
+  80120f:	5d                   	pop    %ebp
+  801210:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	50                   	push   %eax
+  801215:	6a 13                	push   $0x13
+  801217:	68 15 53 80 00       	push   $0x805315
+  80121c:	6a 54                	push   $0x54
+  80121e:	68 32 53 80 00       	push   $0x805332
+  801223:	e8 46 f1 ff ff       	call   80036e <_panic>
+
+00801228 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80122d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801232:	b8 14 00 00 00       	mov    $0x14,%eax
+  801237:	89 d1                	mov    %edx,%ecx
+  801239:	89 d3                	mov    %edx,%ebx
+  80123b:	89 d7                	mov    %edx,%edi
+  80123d:	6a 00                	push   $0x0
+  80123f:	55                   	push   %ebp
+  801240:	56                   	push   %esi
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	8d 35 4b 12 80 00    	lea    0x80124b,%esi
+  801249:	0f 34                	sysenter
+
+0080124b <after_sysenter_label_1939>:
+  80124b:	5e                   	pop    %esi
+  80124c:	5d                   	pop    %ebp
+  80124d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801250:	5b                   	pop    %ebx
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+
+00801254 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801264:	bf 00 00 00 00       	mov    $0x0,%edi
+  801269:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126c:	6a 00                	push   $0x0
+  80126e:	55                   	push   %ebp
+  80126f:	56                   	push   %esi
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	8d 35 7a 12 80 00    	lea    0x80127a,%esi
+  801278:	0f 34                	sysenter
+
+0080127a <after_sysenter_label_2028>:
+  80127a:	5e                   	pop    %esi
+  80127b:	5d                   	pop    %ebp
+  80127c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 16 00 00 00       	mov    $0x16,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	6a 00                	push   $0x0
+  80129c:	55                   	push   %ebp
+  80129d:	56                   	push   %esi
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	8d 35 a8 12 80 00    	lea    0x8012a8,%esi
+  8012a6:	0f 34                	sysenter
+
+008012a8 <after_sysenter_label_2114>:
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5f                   	pop    %edi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+
+008012b1 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	57                   	push   %edi
+  8012b5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012c6:	89 df                	mov    %ebx,%edi
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	55                   	push   %ebp
+  8012cb:	56                   	push   %esi
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	8d 35 d6 12 80 00    	lea    0x8012d6,%esi
+  8012d4:	0f 34                	sysenter
+
+008012d6 <after_sysenter_label_2200>:
+  8012d6:	5e                   	pop    %esi
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8012db:	5b                   	pop    %ebx
+  8012dc:	5f                   	pop    %edi
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ef:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012f4:	89 df                	mov    %ebx,%edi
+  8012f6:	6a 00                	push   $0x0
+  8012f8:	55                   	push   %ebp
+  8012f9:	56                   	push   %esi
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	8d 35 04 13 80 00    	lea    0x801304,%esi
+  801302:	0f 34                	sysenter
+
+00801304 <after_sysenter_label_2286>:
+  801304:	5e                   	pop    %esi
+  801305:	5d                   	pop    %ebp
+  801306:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801309:	5b                   	pop    %ebx
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+
+0080130d <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801316:	89 d6                	mov    %edx,%esi
+  801318:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80131b:	89 cf                	mov    %ecx,%edi
+  80131d:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801320:	89 fa                	mov    %edi,%edx
+  801322:	80 ce 08             	or     $0x8,%dh
+  801325:	f6 c5 08             	test   $0x8,%ch
+  801328:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80132b:	57                   	push   %edi
+  80132c:	56                   	push   %esi
+  80132d:	50                   	push   %eax
+  80132e:	56                   	push   %esi
+  80132f:	6a 00                	push   $0x0
+  801331:	e8 82 fb ff ff       	call   800eb8 <sys_page_map>
+	if (r < 0) {
+  801336:	83 c4 20             	add    $0x20,%esp
+  801339:	85 c0                	test   %eax,%eax
+  80133b:	78 27                	js     801364 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80133d:	83 ec 0c             	sub    $0xc,%esp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	6a 00                	push   $0x0
+  801344:	56                   	push   %esi
+  801345:	6a 00                	push   $0x0
+  801347:	e8 6c fb ff ff       	call   800eb8 <sys_page_map>
+  80134c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80134e:	83 c4 20             	add    $0x20,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	78 24                	js     801379 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+  801364:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801366:	83 ec 08             	sub    $0x8,%esp
+  801369:	50                   	push   %eax
+  80136a:	68 40 53 80 00       	push   $0x805340
+  80136f:	e8 d5 f0 ff ff       	call   800449 <cprintf>
+		return r;
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	eb e1                	jmp    80135a <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801379:	83 ec 08             	sub    $0x8,%esp
+  80137c:	50                   	push   %eax
+  80137d:	68 70 53 80 00       	push   $0x805370
+  801382:	e8 c2 f0 ff ff       	call   800449 <cprintf>
+		return r;
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	eb ce                	jmp    80135a <duppage_cow+0x4d>
+
+0080138c <duppage>:
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	53                   	push   %ebx
+  801390:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801393:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801396:	51                   	push   %ecx
+  801397:	52                   	push   %edx
+  801398:	50                   	push   %eax
+  801399:	52                   	push   %edx
+  80139a:	6a 00                	push   $0x0
+  80139c:	e8 17 fb ff ff       	call   800eb8 <sys_page_map>
+	if (r < 0) {
+  8013a1:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8013a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	78 07                	js     8013b4 <duppage+0x28>
+}
+  8013ad:	89 d8                	mov    %ebx,%eax
+  8013af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013b2:	c9                   	leave
+  8013b3:	c3                   	ret
+  8013b4:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8013b6:	83 ec 08             	sub    $0x8,%esp
+  8013b9:	50                   	push   %eax
+  8013ba:	68 40 53 80 00       	push   $0x805340
+  8013bf:	e8 85 f0 ff ff       	call   800449 <cprintf>
+		return r;
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	eb e4                	jmp    8013ad <duppage+0x21>
+
+008013c9 <cow_copy>:
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	56                   	push   %esi
+  8013cd:	53                   	push   %ebx
+  8013ce:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8013d0:	83 ec 04             	sub    $0x4,%esp
+  8013d3:	6a 07                	push   $0x7
+  8013d5:	68 00 f0 7f 00       	push   $0x7ff000
+  8013da:	6a 00                	push   $0x0
+  8013dc:	e8 8a fa ff ff       	call   800e6b <sys_page_alloc>
+	if (r < 0) {
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	78 58                	js     801440 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8013e8:	83 ec 04             	sub    $0x4,%esp
+  8013eb:	68 00 10 00 00       	push   $0x1000
+  8013f0:	56                   	push   %esi
+  8013f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8013f6:	e8 b8 f7 ff ff       	call   800bb3 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8013fb:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801402:	56                   	push   %esi
+  801403:	6a 00                	push   $0x0
+  801405:	68 00 f0 7f 00       	push   $0x7ff000
+  80140a:	6a 00                	push   $0x0
+  80140c:	e8 a7 fa ff ff       	call   800eb8 <sys_page_map>
+  801411:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801413:	83 c4 20             	add    $0x20,%esp
+  801416:	85 c0                	test   %eax,%eax
+  801418:	78 3b                	js     801455 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	68 00 f0 7f 00       	push   $0x7ff000
+  801422:	6a 00                	push   $0x0
+  801424:	e8 db fa ff ff       	call   800f04 <sys_page_unmap>
+  801429:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	78 45                	js     801477 <cow_copy+0xae>
+	return 0;
+  801432:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801437:	89 d8                	mov    %ebx,%eax
+  801439:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143c:	5b                   	pop    %ebx
+  80143d:	5e                   	pop    %esi
+  80143e:	5d                   	pop    %ebp
+  80143f:	c3                   	ret
+  801440:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801442:	83 ec 08             	sub    $0x8,%esp
+  801445:	50                   	push   %eax
+  801446:	68 60 54 80 00       	push   $0x805460
+  80144b:	e8 f9 ef ff ff       	call   800449 <cprintf>
+		return r;
+  801450:	83 c4 10             	add    $0x10,%esp
+  801453:	eb e2                	jmp    801437 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	50                   	push   %eax
+  801459:	68 7c 54 80 00       	push   $0x80547c
+  80145e:	e8 e6 ef ff ff       	call   800449 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801463:	83 c4 08             	add    $0x8,%esp
+  801466:	68 00 f0 7f 00       	push   $0x7ff000
+  80146b:	6a 00                	push   $0x0
+  80146d:	e8 92 fa ff ff       	call   800f04 <sys_page_unmap>
+		return r;
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	eb c0                	jmp    801437 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801477:	83 ec 08             	sub    $0x8,%esp
+  80147a:	50                   	push   %eax
+  80147b:	68 98 53 80 00       	push   $0x805398
+  801480:	e8 c4 ef ff ff       	call   800449 <cprintf>
+		return r;
+  801485:	83 c4 10             	add    $0x10,%esp
+  801488:	eb ad                	jmp    801437 <cow_copy+0x6e>
+
+0080148a <pgfault>:
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+  80148f:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801492:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801494:	89 d8                	mov    %ebx,%eax
+  801496:	c1 e8 16             	shr    $0x16,%eax
+  801499:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8014a0:	89 de                	mov    %ebx,%esi
+  8014a2:	c1 ee 0c             	shr    $0xc,%esi
+  8014a5:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8014ac:	a8 07                	test   $0x7,%al
+  8014ae:	74 3b                	je     8014eb <pgfault+0x61>
+  8014b0:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8014b6:	74 33                	je     8014eb <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8014b8:	83 ec 0c             	sub    $0xc,%esp
+  8014bb:	68 00 f0 bf ee       	push   $0xeebff000
+  8014c0:	e8 58 28 00 00       	call   803d1d <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8014c5:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	f6 c4 08             	test   $0x8,%ah
+  8014d2:	75 30                	jne    801504 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	68 00 f0 bf ee       	push   $0xeebff000
+  8014dc:	e8 a9 28 00 00       	call   803d8a <mutex_unlock>
+}
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e7:	5b                   	pop    %ebx
+  8014e8:	5e                   	pop    %esi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8014eb:	83 ec 08             	sub    $0x8,%esp
+  8014ee:	ff 72 28             	push   0x28(%edx)
+  8014f1:	51                   	push   %ecx
+  8014f2:	50                   	push   %eax
+  8014f3:	68 bc 53 80 00       	push   $0x8053bc
+  8014f8:	6a 3f                	push   $0x3f
+  8014fa:	68 96 54 80 00       	push   $0x805496
+  8014ff:	e8 6a ee ff ff       	call   80036e <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801504:	89 d8                	mov    %ebx,%eax
+  801506:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80150b:	e8 b9 fe ff ff       	call   8013c9 <cow_copy>
+  801510:	eb c2                	jmp    8014d4 <pgfault+0x4a>
+
+00801512 <cow_enable>:
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801518:	68 8a 14 80 00       	push   $0x80148a
+  80151d:	e8 88 36 00 00       	call   804baa <set_pgfault_handler>
+}
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+
+00801527 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	57                   	push   %edi
+  80152b:	56                   	push   %esi
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801530:	68 8a 14 80 00       	push   $0x80148a
+  801535:	e8 70 36 00 00       	call   804baa <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80153a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80153f:	cd 30                	int    $0x30
+  801541:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801544:	83 c4 10             	add    $0x10,%esp
+  801547:	85 c0                	test   %eax,%eax
+  801549:	78 4b                	js     801596 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80154b:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801555:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801558:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80155c:	0f 85 16 01 00 00    	jne    801678 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801562:	e8 ac f8 ff ff       	call   800e13 <sys_getenvid>
+  801567:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80156c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80156e:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801574:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80157a:	77 32                	ja     8015ae <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80157c:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801581:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801583:	c1 ea 10             	shr    $0x10,%edx
+  801586:	74 26                	je     8015ae <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801588:	c1 e2 10             	shl    $0x10,%edx
+  80158b:	89 d1                	mov    %edx,%ecx
+  80158d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801592:	29 ca                	sub    %ecx,%edx
+  801594:	eb 1e                	jmp    8015b4 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801596:	83 ec 08             	sub    $0x8,%esp
+  801599:	89 c7                	mov    %eax,%edi
+  80159b:	50                   	push   %eax
+  80159c:	68 a1 54 80 00       	push   $0x8054a1
+  8015a1:	e8 a3 ee ff ff       	call   800449 <cprintf>
+		return eid;
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	e9 6c 01 00 00       	jmp    80171a <fork+0x1f3>
+		return pthread_main_tls;
+  8015ae:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8015b4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8015b7:	c1 e0 04             	shl    $0x4,%eax
+  8015ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015bf:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8015c1:	e8 ad 33 00 00       	call   804973 <pthread_fork_child>
+		return eid;
+  8015c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015c9:	e9 4c 01 00 00       	jmp    80171a <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015ce:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015d4:	89 da                	mov    %ebx,%edx
+  8015d6:	89 f8                	mov    %edi,%eax
+  8015d8:	e8 af fd ff ff       	call   80138c <duppage>
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	79 28                	jns    801609 <fork+0xe2>
+  8015e1:	89 c7                	mov    %eax,%edi
+  8015e3:	e9 32 01 00 00       	jmp    80171a <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8015e8:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015ee:	83 f9 05             	cmp    $0x5,%ecx
+  8015f1:	75 58                	jne    80164b <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015f3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015f8:	89 da                	mov    %ebx,%edx
+  8015fa:	89 f8                	mov    %edi,%eax
+  8015fc:	e8 8b fd ff ff       	call   80138c <duppage>
+  801601:	85 c0                	test   %eax,%eax
+  801603:	0f 88 0f 01 00 00    	js     801718 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801609:	83 c3 01             	add    $0x1,%ebx
+  80160c:	39 de                	cmp    %ebx,%esi
+  80160e:	74 54                	je     801664 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801610:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801617:	f6 c1 05             	test   $0x5,%cl
+  80161a:	74 ed                	je     801609 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80161c:	f6 c5 04             	test   $0x4,%ch
+  80161f:	75 ad                	jne    8015ce <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801621:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801627:	74 bf                	je     8015e8 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801629:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80162f:	74 d8                	je     801609 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801631:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801637:	89 da                	mov    %ebx,%edx
+  801639:	89 f8                	mov    %edi,%eax
+  80163b:	e8 cd fc ff ff       	call   80130d <duppage_cow>
+  801640:	85 c0                	test   %eax,%eax
+  801642:	79 c5                	jns    801609 <fork+0xe2>
+  801644:	89 c7                	mov    %eax,%edi
+  801646:	e9 cf 00 00 00       	jmp    80171a <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80164b:	68 ec 53 80 00       	push   $0x8053ec
+  801650:	68 b1 54 80 00       	push   $0x8054b1
+  801655:	68 c6 00 00 00       	push   $0xc6
+  80165a:	68 96 54 80 00       	push   $0x805496
+  80165f:	e8 0a ed ff ff       	call   80036e <_panic>
+  801664:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801667:	83 c1 01             	add    $0x1,%ecx
+  80166a:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801670:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801676:	74 18                	je     801690 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801678:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80167f:	a8 07                	test   $0x7,%al
+  801681:	74 e4                	je     801667 <fork+0x140>
+  801683:	89 cb                	mov    %ecx,%ebx
+  801685:	c1 e3 0a             	shl    $0xa,%ebx
+  801688:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80168b:	e9 7c ff ff ff       	jmp    80160c <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	6a 07                	push   $0x7
+  801695:	68 00 f0 bf ee       	push   $0xeebff000
+  80169a:	ff 75 e4             	push   -0x1c(%ebp)
+  80169d:	e8 c9 f7 ff ff       	call   800e6b <sys_page_alloc>
+  8016a2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 34                	js     8016df <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8016ab:	83 ec 08             	sub    $0x8,%esp
+  8016ae:	68 e8 4b 80 00       	push   $0x804be8
+  8016b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8016b6:	e8 2d f9 ff ff       	call   800fe8 <sys_env_set_pgfault_upcall>
+  8016bb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	78 2e                	js     8016f2 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	6a 02                	push   $0x2
+  8016c9:	ff 75 e4             	push   -0x1c(%ebp)
+  8016cc:	e8 7f f8 ff ff       	call   800f50 <sys_env_set_status>
+  8016d1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 2b                	js     801705 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8016da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016dd:	eb 3b                	jmp    80171a <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8016df:	83 ec 08             	sub    $0x8,%esp
+  8016e2:	50                   	push   %eax
+  8016e3:	68 14 54 80 00       	push   $0x805414
+  8016e8:	e8 5c ed ff ff       	call   800449 <cprintf>
+		return r;
+  8016ed:	83 c4 10             	add    $0x10,%esp
+  8016f0:	eb 28                	jmp    80171a <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8016f2:	83 ec 08             	sub    $0x8,%esp
+  8016f5:	50                   	push   %eax
+  8016f6:	68 3c 54 80 00       	push   $0x80543c
+  8016fb:	e8 49 ed ff ff       	call   800449 <cprintf>
+		return r;
+  801700:	83 c4 10             	add    $0x10,%esp
+  801703:	eb 15                	jmp    80171a <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801705:	83 ec 08             	sub    $0x8,%esp
+  801708:	50                   	push   %eax
+  801709:	68 c6 54 80 00       	push   $0x8054c6
+  80170e:	e8 36 ed ff ff       	call   800449 <cprintf>
+		return r;
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	eb 02                	jmp    80171a <fork+0x1f3>
+  801718:	89 c7                	mov    %eax,%edi
+}
+  80171a:	89 f8                	mov    %edi,%eax
+  80171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+
+00801724 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	57                   	push   %edi
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 2c             	sub    $0x2c,%esp
+  80172d:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80172f:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801735:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80173a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801740:	77 0a                	ja     80174c <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801742:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801747:	29 c3                	sub    %eax,%ebx
+  801749:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	68 8a 14 80 00       	push   $0x80148a
+  801754:	e8 51 34 00 00       	call   804baa <set_pgfault_handler>
+  801759:	b8 07 00 00 00       	mov    $0x7,%eax
+  80175e:	cd 30                	int    $0x30
+  801760:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 30                	js     80179a <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80176a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80176e:	74 42                	je     8017b2 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801770:	c1 e3 10             	shl    $0x10,%ebx
+  801773:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801778:	29 d8                	sub    %ebx,%eax
+  80177a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80177d:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801782:	29 d8                	sub    %ebx,%eax
+  801784:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801787:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80178c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801791:	89 f7                	mov    %esi,%edi
+  801793:	89 d6                	mov    %edx,%esi
+  801795:	e9 2c 01 00 00       	jmp    8018c6 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80179a:	83 ec 08             	sub    $0x8,%esp
+  80179d:	89 c7                	mov    %eax,%edi
+  80179f:	50                   	push   %eax
+  8017a0:	68 a1 54 80 00       	push   $0x8054a1
+  8017a5:	e8 9f ec ff ff       	call   800449 <cprintf>
+		return eid;
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	e9 d5 00 00 00       	jmp    801887 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8017b2:	e8 5c f6 ff ff       	call   800e13 <sys_getenvid>
+  8017b7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017bc:	89 c2                	mov    %eax,%edx
+  8017be:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017c0:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8017c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8017cb:	77 18                	ja     8017e5 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8017d2:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8017d4:	c1 e8 10             	shr    $0x10,%eax
+  8017d7:	74 0c                	je     8017e5 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8017d9:	c1 e0 10             	shl    $0x10,%eax
+  8017dc:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8017e1:	29 c1                	sub    %eax,%ecx
+  8017e3:	eb 06                	jmp    8017eb <sfork+0xc7>
+		return pthread_main_tls;
+  8017e5:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8017eb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8017ee:	c1 e0 04             	shl    $0x4,%eax
+  8017f1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017f6:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8017f8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017fb:	e9 87 00 00 00       	jmp    801887 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801800:	f6 c5 04             	test   $0x4,%ch
+  801803:	74 6c                	je     801871 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801805:	89 ca                	mov    %ecx,%edx
+  801807:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80180d:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801813:	74 7c                	je     801891 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801815:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80181b:	89 da                	mov    %ebx,%edx
+  80181d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801820:	e8 67 fb ff ff       	call   80138c <duppage>
+  801825:	85 c0                	test   %eax,%eax
+  801827:	0f 88 4f 01 00 00    	js     80197c <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80182d:	83 c3 01             	add    $0x1,%ebx
+  801830:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801833:	74 7a                	je     8018af <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801835:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  801837:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80183e:	f6 c1 01             	test   $0x1,%cl
+  801841:	74 ea                	je     80182d <sfork+0x109>
+  801843:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801849:	74 e2                	je     80182d <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80184b:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801851:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801854:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801859:	76 a5                	jbe    801800 <sfork+0xdc>
+  80185b:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801861:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801864:	39 fa                	cmp    %edi,%edx
+  801866:	73 9d                	jae    801805 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801868:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80186b:	39 fa                	cmp    %edi,%edx
+  80186d:	72 96                	jb     801805 <sfork+0xe1>
+  80186f:	eb 8f                	jmp    801800 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801871:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801877:	89 da                	mov    %ebx,%edx
+  801879:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80187c:	e8 8c fa ff ff       	call   80130d <duppage_cow>
+  801881:	85 c0                	test   %eax,%eax
+  801883:	79 a8                	jns    80182d <sfork+0x109>
+  801885:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801887:	89 f8                	mov    %edi,%eax
+  801889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188c:	5b                   	pop    %ebx
+  80188d:	5e                   	pop    %esi
+  80188e:	5f                   	pop    %edi
+  80188f:	5d                   	pop    %ebp
+  801890:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801891:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801896:	e8 2e fb ff ff       	call   8013c9 <cow_copy>
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	0f 88 d2 00 00 00    	js     801975 <sfork+0x251>
+				pte = uvpt[pn];
+  8018a3:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8018aa:	e9 66 ff ff ff       	jmp    801815 <sfork+0xf1>
+  8018af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018b2:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8018b5:	83 c6 01             	add    $0x1,%esi
+  8018b8:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8018be:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8018c4:	74 1b                	je     8018e1 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8018c6:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8018cd:	a8 01                	test   $0x1,%al
+  8018cf:	74 e4                	je     8018b5 <sfork+0x191>
+  8018d1:	89 f3                	mov    %esi,%ebx
+  8018d3:	c1 e3 0a             	shl    $0xa,%ebx
+  8018d6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8018d9:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8018dc:	e9 4f ff ff ff       	jmp    801830 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8018e1:	83 ec 04             	sub    $0x4,%esp
+  8018e4:	6a 07                	push   $0x7
+  8018e6:	68 00 f0 bf ee       	push   $0xeebff000
+  8018eb:	ff 75 e0             	push   -0x20(%ebp)
+  8018ee:	e8 78 f5 ff ff       	call   800e6b <sys_page_alloc>
+  8018f3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 37                	js     801933 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8018fc:	83 ec 08             	sub    $0x8,%esp
+  8018ff:	68 e8 4b 80 00       	push   $0x804be8
+  801904:	ff 75 e0             	push   -0x20(%ebp)
+  801907:	e8 dc f6 ff ff       	call   800fe8 <sys_env_set_pgfault_upcall>
+  80190c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80190e:	83 c4 10             	add    $0x10,%esp
+  801911:	85 c0                	test   %eax,%eax
+  801913:	78 34                	js     801949 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801915:	83 ec 08             	sub    $0x8,%esp
+  801918:	6a 02                	push   $0x2
+  80191a:	ff 75 e0             	push   -0x20(%ebp)
+  80191d:	e8 2e f6 ff ff       	call   800f50 <sys_env_set_status>
+  801922:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	85 c0                	test   %eax,%eax
+  801929:	78 34                	js     80195f <sfork+0x23b>
+	return eid;
+  80192b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80192e:	e9 54 ff ff ff       	jmp    801887 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	50                   	push   %eax
+  801937:	68 14 54 80 00       	push   $0x805414
+  80193c:	e8 08 eb ff ff       	call   800449 <cprintf>
+		return r;
+  801941:	83 c4 10             	add    $0x10,%esp
+  801944:	e9 3e ff ff ff       	jmp    801887 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801949:	83 ec 08             	sub    $0x8,%esp
+  80194c:	50                   	push   %eax
+  80194d:	68 3c 54 80 00       	push   $0x80543c
+  801952:	e8 f2 ea ff ff       	call   800449 <cprintf>
+		return r;
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	e9 28 ff ff ff       	jmp    801887 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80195f:	83 ec 08             	sub    $0x8,%esp
+  801962:	50                   	push   %eax
+  801963:	68 c6 54 80 00       	push   $0x8054c6
+  801968:	e8 dc ea ff ff       	call   800449 <cprintf>
+		return r;
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	e9 12 ff ff ff       	jmp    801887 <sfork+0x163>
+  801975:	89 c7                	mov    %eax,%edi
+  801977:	e9 0b ff ff ff       	jmp    801887 <sfork+0x163>
+  80197c:	89 c7                	mov    %eax,%edi
+  80197e:	e9 04 ff ff ff       	jmp    801887 <sfork+0x163>
+
+00801983 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	57                   	push   %edi
+  801987:	56                   	push   %esi
+  801988:	53                   	push   %ebx
+  801989:	83 ec 18             	sub    $0x18,%esp
+  80198c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80198f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801992:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801995:	85 c0                	test   %eax,%eax
+  801997:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80199c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80199f:	50                   	push   %eax
+  8019a0:	e8 bc f6 ff ff       	call   801061 <sys_ipc_recv>
+	if (r < 0) {
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 2b                	js     8019d7 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8019ac:	85 ff                	test   %edi,%edi
+  8019ae:	74 55                	je     801a05 <ipc_recv+0x82>
+  8019b0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8019b2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8019b8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8019bd:	77 39                	ja     8019f8 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8019bf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8019c4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8019c6:	c1 e8 10             	shr    $0x10,%eax
+  8019c9:	74 2d                	je     8019f8 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8019cb:	c1 e0 10             	shl    $0x10,%eax
+  8019ce:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8019d3:	29 c2                	sub    %eax,%edx
+  8019d5:	eb 27                	jmp    8019fe <ipc_recv+0x7b>
+  8019d7:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8019d9:	83 ec 08             	sub    $0x8,%esp
+  8019dc:	50                   	push   %eax
+  8019dd:	68 e4 54 80 00       	push   $0x8054e4
+  8019e2:	e8 62 ea ff ff       	call   800449 <cprintf>
+		*from_env_store = 0;
+  8019e7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8019ed:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8019f3:	83 c4 10             	add    $0x10,%esp
+  8019f6:	eb 77                	jmp    801a6f <ipc_recv+0xec>
+		return pthread_main_tls;
+  8019f8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8019fe:	8b 02                	mov    (%edx),%eax
+  801a00:	8b 40 78             	mov    0x78(%eax),%eax
+  801a03:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801a05:	85 f6                	test   %esi,%esi
+  801a07:	74 34                	je     801a3d <ipc_recv+0xba>
+  801a09:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a0b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a11:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a16:	77 18                	ja     801a30 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a18:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a1d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a1f:	c1 e8 10             	shr    $0x10,%eax
+  801a22:	74 0c                	je     801a30 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a24:	c1 e0 10             	shl    $0x10,%eax
+  801a27:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a2c:	29 c2                	sub    %eax,%edx
+  801a2e:	eb 06                	jmp    801a36 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  801a30:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  801a36:	8b 02                	mov    (%edx),%eax
+  801a38:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801a3b:	89 06                	mov    %eax,(%esi)
+  801a3d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a3f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a45:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a4a:	77 18                	ja     801a64 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a4c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a51:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801a53:	c1 e8 10             	shr    $0x10,%eax
+  801a56:	74 0c                	je     801a64 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a58:	c1 e0 10             	shl    $0x10,%eax
+  801a5b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801a60:	29 c2                	sub    %eax,%edx
+  801a62:	eb 06                	jmp    801a6a <ipc_recv+0xe7>
+		return pthread_main_tls;
+  801a64:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  801a6a:	8b 02                	mov    (%edx),%eax
+  801a6c:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  801a6f:	89 d8                	mov    %ebx,%eax
+  801a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a74:	5b                   	pop    %ebx
+  801a75:	5e                   	pop    %esi
+  801a76:	5f                   	pop    %edi
+  801a77:	5d                   	pop    %ebp
+  801a78:	c3                   	ret
+
+00801a79 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801a79:	55                   	push   %ebp
+  801a7a:	89 e5                	mov    %esp,%ebp
+  801a7c:	57                   	push   %edi
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	83 ec 0c             	sub    $0xc,%esp
+  801a82:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a88:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801a8b:	85 db                	test   %ebx,%ebx
+  801a8d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801a92:	0f 44 d8             	cmove  %eax,%ebx
+  801a95:	eb 05                	jmp    801a9c <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801a97:	e8 a3 f3 ff ff       	call   800e3f <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801a9c:	57                   	push   %edi
+  801a9d:	53                   	push   %ebx
+  801a9e:	ff 75 0c             	push   0xc(%ebp)
+  801aa1:	56                   	push   %esi
+  801aa2:	e8 8d f5 ff ff       	call   801034 <sys_ipc_try_send>
+		if (r == 0) {
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	74 19                	je     801ac7 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  801aae:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801ab1:	74 e4                	je     801a97 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  801ab3:	83 ec 0c             	sub    $0xc,%esp
+  801ab6:	50                   	push   %eax
+  801ab7:	57                   	push   %edi
+  801ab8:	53                   	push   %ebx
+  801ab9:	56                   	push   %esi
+  801aba:	68 00 55 80 00       	push   $0x805500
+  801abf:	e8 85 e9 ff ff       	call   800449 <cprintf>
+			return;
+  801ac4:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  801ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aca:	5b                   	pop    %ebx
+  801acb:	5e                   	pop    %esi
+  801acc:	5f                   	pop    %edi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+
+00801acf <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801ada:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801add:	c1 e0 04             	shl    $0x4,%eax
+  801ae0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ae5:	8b 40 50             	mov    0x50(%eax),%eax
+  801ae8:	39 c8                	cmp    %ecx,%eax
+  801aea:	74 12                	je     801afe <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801aec:	83 c2 01             	add    $0x1,%edx
+  801aef:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801af5:	75 e3                	jne    801ada <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afc:	eb 0e                	jmp    801b0c <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801afe:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801b01:	c1 e0 04             	shl    $0x4,%eax
+  801b04:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b09:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+
+00801b0e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b14:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b19:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b1c:	5d                   	pop    %ebp
+  801b1d:	c3                   	ret
+
+00801b1e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b24:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b29:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b2e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b33:	5d                   	pop    %ebp
+  801b34:	c3                   	ret
+
+00801b35 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b35:	55                   	push   %ebp
+  801b36:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b38:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b3d:	eb 02                	jmp    801b41 <fd_alloc+0xc>
+  801b3f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b41:	89 c2                	mov    %eax,%edx
+  801b43:	c1 ea 16             	shr    $0x16,%edx
+  801b46:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b4d:	f6 c2 01             	test   $0x1,%dl
+  801b50:	74 2b                	je     801b7d <fd_alloc+0x48>
+  801b52:	89 c2                	mov    %eax,%edx
+  801b54:	c1 ea 0c             	shr    $0xc,%edx
+  801b57:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b5e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801b64:	f6 c1 01             	test   $0x1,%cl
+  801b67:	74 14                	je     801b7d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801b69:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b6f:	75 ce                	jne    801b3f <fd_alloc+0xa>
+  801b71:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b76:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b7b:	eb 05                	jmp    801b82 <fd_alloc+0x4d>
+			return 0;
+  801b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b85:	89 02                	mov    %eax,(%edx)
+}
+  801b87:	89 c8                	mov    %ecx,%eax
+  801b89:	5d                   	pop    %ebp
+  801b8a:	c3                   	ret
+
+00801b8b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b8b:	55                   	push   %ebp
+  801b8c:	89 e5                	mov    %esp,%ebp
+  801b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b91:	83 f8 1f             	cmp    $0x1f,%eax
+  801b94:	77 30                	ja     801bc6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b96:	c1 e0 0c             	shl    $0xc,%eax
+  801b99:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b9e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ba4:	f6 c2 01             	test   $0x1,%dl
+  801ba7:	74 24                	je     801bcd <fd_lookup+0x42>
+  801ba9:	89 c2                	mov    %eax,%edx
+  801bab:	c1 ea 0c             	shr    $0xc,%edx
+  801bae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801bb5:	f6 c2 01             	test   $0x1,%dl
+  801bb8:	74 1a                	je     801bd4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801bba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bbd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bc4:	5d                   	pop    %ebp
+  801bc5:	c3                   	ret
+		return -E_INVAL;
+  801bc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bcb:	eb f7                	jmp    801bc4 <fd_lookup+0x39>
+		return -E_INVAL;
+  801bcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bd2:	eb f0                	jmp    801bc4 <fd_lookup+0x39>
+  801bd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bd9:	eb e9                	jmp    801bc4 <fd_lookup+0x39>
+
+00801bdb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	53                   	push   %ebx
+  801bdf:	83 ec 04             	sub    $0x4,%esp
+  801be2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bea:	eb 03                	jmp    801bef <dev_lookup+0x14>
+  801bec:	83 c0 01             	add    $0x1,%eax
+  801bef:	8b 1c 85 b4 55 80 00 	mov    0x8055b4(,%eax,4),%ebx
+  801bf6:	85 db                	test   %ebx,%ebx
+  801bf8:	74 0b                	je     801c05 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801bfa:	39 13                	cmp    %edx,(%ebx)
+  801bfc:	75 ee                	jne    801bec <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c03:	eb 49                	jmp    801c4e <dev_lookup+0x73>
+  801c05:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c07:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801c0d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c12:	77 18                	ja     801c2c <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c14:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c19:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801c1b:	c1 e8 10             	shr    $0x10,%eax
+  801c1e:	74 0c                	je     801c2c <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c20:	c1 e0 10             	shl    $0x10,%eax
+  801c23:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801c28:	29 c1                	sub    %eax,%ecx
+  801c2a:	eb 06                	jmp    801c32 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801c2c:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c32:	8b 01                	mov    (%ecx),%eax
+  801c34:	8b 40 48             	mov    0x48(%eax),%eax
+  801c37:	83 ec 04             	sub    $0x4,%esp
+  801c3a:	52                   	push   %edx
+  801c3b:	50                   	push   %eax
+  801c3c:	68 38 55 80 00       	push   $0x805538
+  801c41:	e8 03 e8 ff ff       	call   800449 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c46:	83 c4 10             	add    $0x10,%esp
+  801c49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c51:	89 1a                	mov    %ebx,(%edx)
+}
+  801c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <fd_close>:
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	57                   	push   %edi
+  801c5c:	56                   	push   %esi
+  801c5d:	53                   	push   %ebx
+  801c5e:	83 ec 24             	sub    $0x24,%esp
+  801c61:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c64:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c67:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c6a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c6b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c71:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c74:	50                   	push   %eax
+  801c75:	e8 11 ff ff ff       	call   801b8b <fd_lookup>
+  801c7a:	89 c3                	mov    %eax,%ebx
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	78 05                	js     801c88 <fd_close+0x30>
+	    || fd != fd2)
+  801c83:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c86:	74 16                	je     801c9e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c88:	89 f8                	mov    %edi,%eax
+  801c8a:	84 c0                	test   %al,%al
+  801c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c91:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c94:	89 d8                	mov    %ebx,%eax
+  801c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c99:	5b                   	pop    %ebx
+  801c9a:	5e                   	pop    %esi
+  801c9b:	5f                   	pop    %edi
+  801c9c:	5d                   	pop    %ebp
+  801c9d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c9e:	83 ec 08             	sub    $0x8,%esp
+  801ca1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ca4:	50                   	push   %eax
+  801ca5:	ff 36                	push   (%esi)
+  801ca7:	e8 2f ff ff ff       	call   801bdb <dev_lookup>
+  801cac:	89 c3                	mov    %eax,%ebx
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	78 1a                	js     801ccf <fd_close+0x77>
+		if (dev->dev_close)
+  801cb5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cb8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	74 0b                	je     801ccf <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801cc4:	83 ec 0c             	sub    $0xc,%esp
+  801cc7:	56                   	push   %esi
+  801cc8:	ff d0                	call   *%eax
+  801cca:	89 c3                	mov    %eax,%ebx
+  801ccc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ccf:	83 ec 08             	sub    $0x8,%esp
+  801cd2:	56                   	push   %esi
+  801cd3:	6a 00                	push   $0x0
+  801cd5:	e8 2a f2 ff ff       	call   800f04 <sys_page_unmap>
+	return r;
+  801cda:	83 c4 10             	add    $0x10,%esp
+  801cdd:	eb b5                	jmp    801c94 <fd_close+0x3c>
+
+00801cdf <close>:
+
+int
+close(int fdnum)
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ce5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce8:	50                   	push   %eax
+  801ce9:	ff 75 08             	push   0x8(%ebp)
+  801cec:	e8 9a fe ff ff       	call   801b8b <fd_lookup>
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	79 02                	jns    801cfa <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801cf8:	c9                   	leave
+  801cf9:	c3                   	ret
+		return fd_close(fd, 1);
+  801cfa:	83 ec 08             	sub    $0x8,%esp
+  801cfd:	6a 01                	push   $0x1
+  801cff:	ff 75 f4             	push   -0xc(%ebp)
+  801d02:	e8 51 ff ff ff       	call   801c58 <fd_close>
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	eb ec                	jmp    801cf8 <close+0x19>
+
+00801d0c <close_all>:
+
+void
+close_all(void)
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	53                   	push   %ebx
+  801d10:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d18:	83 ec 0c             	sub    $0xc,%esp
+  801d1b:	53                   	push   %ebx
+  801d1c:	e8 be ff ff ff       	call   801cdf <close>
+	for (i = 0; i < MAXFD; i++)
+  801d21:	83 c3 01             	add    $0x1,%ebx
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	83 fb 20             	cmp    $0x20,%ebx
+  801d2a:	75 ec                	jne    801d18 <close_all+0xc>
+}
+  801d2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d2f:	c9                   	leave
+  801d30:	c3                   	ret
+
+00801d31 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	57                   	push   %edi
+  801d35:	56                   	push   %esi
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d3a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d3d:	50                   	push   %eax
+  801d3e:	ff 75 08             	push   0x8(%ebp)
+  801d41:	e8 45 fe ff ff       	call   801b8b <fd_lookup>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 7f                	js     801dce <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d4f:	83 ec 0c             	sub    $0xc,%esp
+  801d52:	ff 75 0c             	push   0xc(%ebp)
+  801d55:	e8 85 ff ff ff       	call   801cdf <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d5a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d5d:	c1 e6 0c             	shl    $0xc,%esi
+  801d60:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d66:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d69:	89 3c 24             	mov    %edi,(%esp)
+  801d6c:	e8 ad fd ff ff       	call   801b1e <fd2data>
+  801d71:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d73:	89 34 24             	mov    %esi,(%esp)
+  801d76:	e8 a3 fd ff ff       	call   801b1e <fd2data>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d81:	89 d8                	mov    %ebx,%eax
+  801d83:	c1 e8 16             	shr    $0x16,%eax
+  801d86:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d8d:	a8 01                	test   $0x1,%al
+  801d8f:	74 11                	je     801da2 <dup+0x71>
+  801d91:	89 d8                	mov    %ebx,%eax
+  801d93:	c1 e8 0c             	shr    $0xc,%eax
+  801d96:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d9d:	f6 c2 01             	test   $0x1,%dl
+  801da0:	75 36                	jne    801dd8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801da2:	89 f8                	mov    %edi,%eax
+  801da4:	c1 e8 0c             	shr    $0xc,%eax
+  801da7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801dae:	83 ec 0c             	sub    $0xc,%esp
+  801db1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801db6:	50                   	push   %eax
+  801db7:	56                   	push   %esi
+  801db8:	6a 00                	push   $0x0
+  801dba:	57                   	push   %edi
+  801dbb:	6a 00                	push   $0x0
+  801dbd:	e8 f6 f0 ff ff       	call   800eb8 <sys_page_map>
+  801dc2:	89 c3                	mov    %eax,%ebx
+  801dc4:	83 c4 20             	add    $0x20,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 33                	js     801dfe <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801dcb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801dce:	89 d8                	mov    %ebx,%eax
+  801dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd3:	5b                   	pop    %ebx
+  801dd4:	5e                   	pop    %esi
+  801dd5:	5f                   	pop    %edi
+  801dd6:	5d                   	pop    %ebp
+  801dd7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801dd8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ddf:	83 ec 0c             	sub    $0xc,%esp
+  801de2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801de7:	50                   	push   %eax
+  801de8:	ff 75 d4             	push   -0x2c(%ebp)
+  801deb:	6a 00                	push   $0x0
+  801ded:	53                   	push   %ebx
+  801dee:	6a 00                	push   $0x0
+  801df0:	e8 c3 f0 ff ff       	call   800eb8 <sys_page_map>
+  801df5:	89 c3                	mov    %eax,%ebx
+  801df7:	83 c4 20             	add    $0x20,%esp
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	79 a4                	jns    801da2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+  801e01:	56                   	push   %esi
+  801e02:	6a 00                	push   $0x0
+  801e04:	e8 fb f0 ff ff       	call   800f04 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e09:	83 c4 08             	add    $0x8,%esp
+  801e0c:	ff 75 d4             	push   -0x2c(%ebp)
+  801e0f:	6a 00                	push   $0x0
+  801e11:	e8 ee f0 ff ff       	call   800f04 <sys_page_unmap>
+	return r;
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	eb b3                	jmp    801dce <dup+0x9d>
+
+00801e1b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e1b:	55                   	push   %ebp
+  801e1c:	89 e5                	mov    %esp,%ebp
+  801e1e:	56                   	push   %esi
+  801e1f:	53                   	push   %ebx
+  801e20:	83 ec 18             	sub    $0x18,%esp
+  801e23:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e26:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e29:	50                   	push   %eax
+  801e2a:	53                   	push   %ebx
+  801e2b:	e8 5b fd ff ff       	call   801b8b <fd_lookup>
+  801e30:	83 c4 10             	add    $0x10,%esp
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	78 3c                	js     801e73 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e37:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e3a:	83 ec 08             	sub    $0x8,%esp
+  801e3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e40:	50                   	push   %eax
+  801e41:	ff 36                	push   (%esi)
+  801e43:	e8 93 fd ff ff       	call   801bdb <dev_lookup>
+  801e48:	83 c4 10             	add    $0x10,%esp
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 24                	js     801e73 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e4f:	8b 46 08             	mov    0x8(%esi),%eax
+  801e52:	83 e0 03             	and    $0x3,%eax
+  801e55:	83 f8 01             	cmp    $0x1,%eax
+  801e58:	74 20                	je     801e7a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e5d:	8b 40 08             	mov    0x8(%eax),%eax
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	74 61                	je     801ec5 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	ff 75 10             	push   0x10(%ebp)
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	56                   	push   %esi
+  801e6e:	ff d0                	call   *%eax
+  801e70:	83 c4 10             	add    $0x10,%esp
+}
+  801e73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e76:	5b                   	pop    %ebx
+  801e77:	5e                   	pop    %esi
+  801e78:	5d                   	pop    %ebp
+  801e79:	c3                   	ret
+  801e7a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e7c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e82:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e87:	77 18                	ja     801ea1 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e89:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e8e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e90:	c1 e8 10             	shr    $0x10,%eax
+  801e93:	74 0c                	je     801ea1 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e95:	c1 e0 10             	shl    $0x10,%eax
+  801e98:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e9d:	29 c2                	sub    %eax,%edx
+  801e9f:	eb 06                	jmp    801ea7 <read+0x8c>
+		return pthread_main_tls;
+  801ea1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ea7:	8b 02                	mov    (%edx),%eax
+  801ea9:	8b 40 48             	mov    0x48(%eax),%eax
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	53                   	push   %ebx
+  801eb0:	50                   	push   %eax
+  801eb1:	68 79 55 80 00       	push   $0x805579
+  801eb6:	e8 8e e5 ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  801ebb:	83 c4 10             	add    $0x10,%esp
+  801ebe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec3:	eb ae                	jmp    801e73 <read+0x58>
+		return -E_NOT_SUPP;
+  801ec5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eca:	eb a7                	jmp    801e73 <read+0x58>
+
+00801ecc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	57                   	push   %edi
+  801ed0:	56                   	push   %esi
+  801ed1:	53                   	push   %ebx
+  801ed2:	83 ec 0c             	sub    $0xc,%esp
+  801ed5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ed8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee0:	eb 02                	jmp    801ee4 <readn+0x18>
+  801ee2:	01 c3                	add    %eax,%ebx
+  801ee4:	39 f3                	cmp    %esi,%ebx
+  801ee6:	73 21                	jae    801f09 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ee8:	83 ec 04             	sub    $0x4,%esp
+  801eeb:	89 f0                	mov    %esi,%eax
+  801eed:	29 d8                	sub    %ebx,%eax
+  801eef:	50                   	push   %eax
+  801ef0:	89 d8                	mov    %ebx,%eax
+  801ef2:	03 45 0c             	add    0xc(%ebp),%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	57                   	push   %edi
+  801ef7:	e8 1f ff ff ff       	call   801e1b <read>
+		if (m < 0)
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 04                	js     801f07 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f03:	75 dd                	jne    801ee2 <readn+0x16>
+  801f05:	eb 02                	jmp    801f09 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f07:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f09:	89 d8                	mov    %ebx,%eax
+  801f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f0e:	5b                   	pop    %ebx
+  801f0f:	5e                   	pop    %esi
+  801f10:	5f                   	pop    %edi
+  801f11:	5d                   	pop    %ebp
+  801f12:	c3                   	ret
+
+00801f13 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	56                   	push   %esi
+  801f17:	53                   	push   %ebx
+  801f18:	83 ec 18             	sub    $0x18,%esp
+  801f1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f21:	50                   	push   %eax
+  801f22:	53                   	push   %ebx
+  801f23:	e8 63 fc ff ff       	call   801b8b <fd_lookup>
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 37                	js     801f66 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f2f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f32:	83 ec 08             	sub    $0x8,%esp
+  801f35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f38:	50                   	push   %eax
+  801f39:	ff 36                	push   (%esi)
+  801f3b:	e8 9b fc ff ff       	call   801bdb <dev_lookup>
+  801f40:	83 c4 10             	add    $0x10,%esp
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 1f                	js     801f66 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f47:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f4b:	74 20                	je     801f6d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f50:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	74 61                	je     801fb8 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f57:	83 ec 04             	sub    $0x4,%esp
+  801f5a:	ff 75 10             	push   0x10(%ebp)
+  801f5d:	ff 75 0c             	push   0xc(%ebp)
+  801f60:	56                   	push   %esi
+  801f61:	ff d0                	call   *%eax
+  801f63:	83 c4 10             	add    $0x10,%esp
+}
+  801f66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f69:	5b                   	pop    %ebx
+  801f6a:	5e                   	pop    %esi
+  801f6b:	5d                   	pop    %ebp
+  801f6c:	c3                   	ret
+  801f6d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f6f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f75:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f7a:	77 18                	ja     801f94 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f7c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f81:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f83:	c1 e8 10             	shr    $0x10,%eax
+  801f86:	74 0c                	je     801f94 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f88:	c1 e0 10             	shl    $0x10,%eax
+  801f8b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f90:	29 c2                	sub    %eax,%edx
+  801f92:	eb 06                	jmp    801f9a <write+0x87>
+		return pthread_main_tls;
+  801f94:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9a:	8b 02                	mov    (%edx),%eax
+  801f9c:	8b 40 48             	mov    0x48(%eax),%eax
+  801f9f:	83 ec 04             	sub    $0x4,%esp
+  801fa2:	53                   	push   %ebx
+  801fa3:	50                   	push   %eax
+  801fa4:	68 95 55 80 00       	push   $0x805595
+  801fa9:	e8 9b e4 ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fb6:	eb ae                	jmp    801f66 <write+0x53>
+		return -E_NOT_SUPP;
+  801fb8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fbd:	eb a7                	jmp    801f66 <write+0x53>
+
+00801fbf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc8:	50                   	push   %eax
+  801fc9:	ff 75 08             	push   0x8(%ebp)
+  801fcc:	e8 ba fb ff ff       	call   801b8b <fd_lookup>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 0e                	js     801fe6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801fd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fde:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+00801fe8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	56                   	push   %esi
+  801fec:	53                   	push   %ebx
+  801fed:	83 ec 18             	sub    $0x18,%esp
+  801ff0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ff3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ff6:	50                   	push   %eax
+  801ff7:	53                   	push   %ebx
+  801ff8:	e8 8e fb ff ff       	call   801b8b <fd_lookup>
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 34                	js     802038 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802004:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802007:	83 ec 08             	sub    $0x8,%esp
+  80200a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200d:	50                   	push   %eax
+  80200e:	ff 36                	push   (%esi)
+  802010:	e8 c6 fb ff ff       	call   801bdb <dev_lookup>
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	78 1c                	js     802038 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80201c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802020:	74 1d                	je     80203f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802022:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802025:	8b 40 18             	mov    0x18(%eax),%eax
+  802028:	85 c0                	test   %eax,%eax
+  80202a:	74 5e                	je     80208a <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  80202f:	ff 75 0c             	push   0xc(%ebp)
+  802032:	56                   	push   %esi
+  802033:	ff d0                	call   *%eax
+  802035:	83 c4 10             	add    $0x10,%esp
+}
+  802038:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203b:	5b                   	pop    %ebx
+  80203c:	5e                   	pop    %esi
+  80203d:	5d                   	pop    %ebp
+  80203e:	c3                   	ret
+  80203f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802041:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802047:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80204c:	77 18                	ja     802066 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80204e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802053:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802055:	c1 e8 10             	shr    $0x10,%eax
+  802058:	74 0c                	je     802066 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80205a:	c1 e0 10             	shl    $0x10,%eax
+  80205d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802062:	29 c2                	sub    %eax,%edx
+  802064:	eb 06                	jmp    80206c <ftruncate+0x84>
+		return pthread_main_tls;
+  802066:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80206c:	8b 02                	mov    (%edx),%eax
+  80206e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	53                   	push   %ebx
+  802075:	50                   	push   %eax
+  802076:	68 58 55 80 00       	push   $0x805558
+  80207b:	e8 c9 e3 ff ff       	call   800449 <cprintf>
+		return -E_INVAL;
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802088:	eb ae                	jmp    802038 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80208a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80208f:	eb a7                	jmp    802038 <ftruncate+0x50>
+
+00802091 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	56                   	push   %esi
+  802095:	53                   	push   %ebx
+  802096:	83 ec 18             	sub    $0x18,%esp
+  802099:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80209c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80209f:	50                   	push   %eax
+  8020a0:	ff 75 08             	push   0x8(%ebp)
+  8020a3:	e8 e3 fa ff ff       	call   801b8b <fd_lookup>
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	78 49                	js     8020f8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020b2:	83 ec 08             	sub    $0x8,%esp
+  8020b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b8:	50                   	push   %eax
+  8020b9:	ff 36                	push   (%esi)
+  8020bb:	e8 1b fb ff ff       	call   801bdb <dev_lookup>
+  8020c0:	83 c4 10             	add    $0x10,%esp
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	78 31                	js     8020f8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8020c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ca:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020ce:	74 2f                	je     8020ff <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8020d0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8020d3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020da:	00 00 00 
+	stat->st_isdir = 0;
+  8020dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020e4:	00 00 00 
+	stat->st_dev = dev;
+  8020e7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8020ed:	83 ec 08             	sub    $0x8,%esp
+  8020f0:	53                   	push   %ebx
+  8020f1:	56                   	push   %esi
+  8020f2:	ff 50 14             	call   *0x14(%eax)
+  8020f5:	83 c4 10             	add    $0x10,%esp
+}
+  8020f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fb:	5b                   	pop    %ebx
+  8020fc:	5e                   	pop    %esi
+  8020fd:	5d                   	pop    %ebp
+  8020fe:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802104:	eb f2                	jmp    8020f8 <fstat+0x67>
+
+00802106 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+  802109:	56                   	push   %esi
+  80210a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	6a 00                	push   $0x0
+  802110:	ff 75 08             	push   0x8(%ebp)
+  802113:	e8 4b 03 00 00       	call   802463 <open>
+  802118:	89 c3                	mov    %eax,%ebx
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 1b                	js     80213c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802121:	83 ec 08             	sub    $0x8,%esp
+  802124:	ff 75 0c             	push   0xc(%ebp)
+  802127:	50                   	push   %eax
+  802128:	e8 64 ff ff ff       	call   802091 <fstat>
+  80212d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80212f:	89 1c 24             	mov    %ebx,(%esp)
+  802132:	e8 a8 fb ff ff       	call   801cdf <close>
+	return r;
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	89 f3                	mov    %esi,%ebx
+}
+  80213c:	89 d8                	mov    %ebx,%eax
+  80213e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802141:	5b                   	pop    %ebx
+  802142:	5e                   	pop    %esi
+  802143:	5d                   	pop    %ebp
+  802144:	c3                   	ret
+
+00802145 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802145:	55                   	push   %ebp
+  802146:	89 e5                	mov    %esp,%ebp
+  802148:	56                   	push   %esi
+  802149:	53                   	push   %ebx
+  80214a:	89 c6                	mov    %eax,%esi
+  80214c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80214e:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802155:	74 27                	je     80217e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802157:	6a 07                	push   $0x7
+  802159:	68 00 80 80 00       	push   $0x808000
+  80215e:	56                   	push   %esi
+  80215f:	ff 35 00 70 80 00    	push   0x807000
+  802165:	e8 0f f9 ff ff       	call   801a79 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80216a:	83 c4 0c             	add    $0xc,%esp
+  80216d:	6a 00                	push   $0x0
+  80216f:	53                   	push   %ebx
+  802170:	6a 00                	push   $0x0
+  802172:	e8 0c f8 ff ff       	call   801983 <ipc_recv>
+}
+  802177:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217a:	5b                   	pop    %ebx
+  80217b:	5e                   	pop    %esi
+  80217c:	5d                   	pop    %ebp
+  80217d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80217e:	83 ec 0c             	sub    $0xc,%esp
+  802181:	6a 01                	push   $0x1
+  802183:	e8 47 f9 ff ff       	call   801acf <ipc_find_env>
+  802188:	a3 00 70 80 00       	mov    %eax,0x807000
+  80218d:	83 c4 10             	add    $0x10,%esp
+  802190:	eb c5                	jmp    802157 <fsipc+0x12>
+
+00802192 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802192:	55                   	push   %ebp
+  802193:	89 e5                	mov    %esp,%ebp
+  802195:	53                   	push   %ebx
+  802196:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802199:	68 04 70 80 00       	push   $0x807004
+  80219e:	e8 7a 1b 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a9:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8021ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b1:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8021b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021c0:	e8 80 ff ff ff       	call   802145 <fsipc>
+  8021c5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021c7:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8021ce:	e8 b7 1b 00 00       	call   803d8a <mutex_unlock>
+	return r;
+}
+  8021d3:	89 d8                	mov    %ebx,%eax
+  8021d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+
+008021da <devfile_flush>:
+{
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	53                   	push   %ebx
+  8021de:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8021e1:	68 04 70 80 00       	push   $0x807004
+  8021e6:	e8 32 1b 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f1:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8021f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802200:	e8 40 ff ff ff       	call   802145 <fsipc>
+  802205:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802207:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80220e:	e8 77 1b 00 00       	call   803d8a <mutex_unlock>
+}
+  802213:	89 d8                	mov    %ebx,%eax
+  802215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802218:	c9                   	leave
+  802219:	c3                   	ret
+
+0080221a <devfile_stat>:
+{
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	56                   	push   %esi
+  80221e:	53                   	push   %ebx
+  80221f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802222:	83 ec 0c             	sub    $0xc,%esp
+  802225:	68 04 70 80 00       	push   $0x807004
+  80222a:	e8 ee 1a 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80222f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802232:	8b 40 0c             	mov    0xc(%eax),%eax
+  802235:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80223a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802244:	e8 fc fe ff ff       	call   802145 <fsipc>
+  802249:	89 c3                	mov    %eax,%ebx
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	79 16                	jns    802268 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802252:	83 ec 0c             	sub    $0xc,%esp
+  802255:	68 04 70 80 00       	push   $0x807004
+  80225a:	e8 2b 1b 00 00       	call   803d8a <mutex_unlock>
+}
+  80225f:	89 d8                	mov    %ebx,%eax
+  802261:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802264:	5b                   	pop    %ebx
+  802265:	5e                   	pop    %esi
+  802266:	5d                   	pop    %ebp
+  802267:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802268:	83 ec 08             	sub    $0x8,%esp
+  80226b:	68 00 80 80 00       	push   $0x808000
+  802270:	56                   	push   %esi
+  802271:	e8 b7 e7 ff ff       	call   800a2d <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802276:	a1 80 80 80 00       	mov    0x808080,%eax
+  80227b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802281:	a1 84 80 80 00       	mov    0x808084,%eax
+  802286:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80228c:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80228f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802294:	eb bc                	jmp    802252 <devfile_stat+0x38>
+
+00802296 <devfile_write>:
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	53                   	push   %ebx
+  80229a:	83 ec 10             	sub    $0x10,%esp
+  80229d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8022a0:	68 04 70 80 00       	push   $0x807004
+  8022a5:	e8 73 1a 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022b0:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8022be:	76 3d                	jbe    8022fd <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8022c0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8022c5:	39 c3                	cmp    %eax,%ebx
+  8022c7:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8022ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022cd:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8022d2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8022d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022e2:	e8 5e fe ff ff       	call   802145 <fsipc>
+  8022e7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022e9:	83 ec 0c             	sub    $0xc,%esp
+  8022ec:	68 04 70 80 00       	push   $0x807004
+  8022f1:	e8 94 1a 00 00       	call   803d8a <mutex_unlock>
+}
+  8022f6:	89 d8                	mov    %ebx,%eax
+  8022f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8022fd:	83 ec 04             	sub    $0x4,%esp
+  802300:	53                   	push   %ebx
+  802301:	ff 75 0c             	push   0xc(%ebp)
+  802304:	68 0c 80 80 00       	push   $0x80800c
+  802309:	e8 a5 e8 ff ff       	call   800bb3 <memmove>
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	b8 00 00 00 00       	mov    $0x0,%eax
+  802316:	eb b5                	jmp    8022cd <devfile_write+0x37>
+
+00802318 <devfile_read>:
+{
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	57                   	push   %edi
+  80231c:	56                   	push   %esi
+  80231d:	53                   	push   %ebx
+  80231e:	83 ec 0c             	sub    $0xc,%esp
+  802321:	8b 75 08             	mov    0x8(%ebp),%esi
+  802324:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80232a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802330:	0f 86 8c 00 00 00    	jbe    8023c2 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802336:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80233b:	39 c3                	cmp    %eax,%ebx
+  80233d:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802340:	89 f8                	mov    %edi,%eax
+  802342:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802345:	eb 0f                	jmp    802356 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802347:	0f b6 08             	movzbl (%eax),%ecx
+  80234a:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80234c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802351:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802356:	39 d0                	cmp    %edx,%eax
+  802358:	72 ed                	jb     802347 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80235a:	83 ec 0c             	sub    $0xc,%esp
+  80235d:	68 04 70 80 00       	push   $0x807004
+  802362:	e8 b6 19 00 00       	call   803d1d <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802367:	8b 46 0c             	mov    0xc(%esi),%eax
+  80236a:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  80236f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802375:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  80237b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802380:	b8 03 00 00 00       	mov    $0x3,%eax
+  802385:	e8 bb fd ff ff       	call   802145 <fsipc>
+  80238a:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80238c:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802393:	e8 f2 19 00 00       	call   803d8a <mutex_unlock>
+		assert(r <= (int) n);
+  802398:	83 c4 10             	add    $0x10,%esp
+  80239b:	39 f3                	cmp    %esi,%ebx
+  80239d:	7c 0a                	jl     8023a9 <devfile_read+0x91>
+}
+  80239f:	89 f0                	mov    %esi,%eax
+  8023a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a4:	5b                   	pop    %ebx
+  8023a5:	5e                   	pop    %esi
+  8023a6:	5f                   	pop    %edi
+  8023a7:	5d                   	pop    %ebp
+  8023a8:	c3                   	ret
+		assert(r <= (int) n);
+  8023a9:	68 c8 55 80 00       	push   $0x8055c8
+  8023ae:	68 b1 54 80 00       	push   $0x8054b1
+  8023b3:	68 90 00 00 00       	push   $0x90
+  8023b8:	68 d5 55 80 00       	push   $0x8055d5
+  8023bd:	e8 ac df ff ff       	call   80036e <_panic>
+	mutex_lock(&fsipc_mu);
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+  8023c5:	68 04 70 80 00       	push   $0x807004
+  8023ca:	e8 4e 19 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023cf:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023d2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8023d7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8023dd:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8023e4:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8023e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ec:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023f1:	e8 4f fd ff ff       	call   802145 <fsipc>
+  8023f6:	89 c6                	mov    %eax,%esi
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 1d                	js     80241c <devfile_read+0x104>
+		assert(r <= n);
+  8023ff:	39 c3                	cmp    %eax,%ebx
+  802401:	72 2e                	jb     802431 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802403:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802408:	7f 40                	jg     80244a <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80240a:	83 ec 04             	sub    $0x4,%esp
+  80240d:	50                   	push   %eax
+  80240e:	68 00 80 80 00       	push   $0x808000
+  802413:	57                   	push   %edi
+  802414:	e8 9a e7 ff ff       	call   800bb3 <memmove>
+  802419:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80241c:	83 ec 0c             	sub    $0xc,%esp
+  80241f:	68 04 70 80 00       	push   $0x807004
+  802424:	e8 61 19 00 00       	call   803d8a <mutex_unlock>
+	return r;
+  802429:	83 c4 10             	add    $0x10,%esp
+  80242c:	e9 6e ff ff ff       	jmp    80239f <devfile_read+0x87>
+		assert(r <= n);
+  802431:	68 e0 55 80 00       	push   $0x8055e0
+  802436:	68 b1 54 80 00       	push   $0x8054b1
+  80243b:	68 99 00 00 00       	push   $0x99
+  802440:	68 d5 55 80 00       	push   $0x8055d5
+  802445:	e8 24 df ff ff       	call   80036e <_panic>
+		assert(r <= PGSIZE);
+  80244a:	68 e7 55 80 00       	push   $0x8055e7
+  80244f:	68 b1 54 80 00       	push   $0x8054b1
+  802454:	68 9a 00 00 00       	push   $0x9a
+  802459:	68 d5 55 80 00       	push   $0x8055d5
+  80245e:	e8 0b df ff ff       	call   80036e <_panic>
+
+00802463 <open>:
+{
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	56                   	push   %esi
+  802467:	53                   	push   %ebx
+  802468:	83 ec 1c             	sub    $0x1c,%esp
+  80246b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80246e:	56                   	push   %esi
+  80246f:	e8 7e e5 ff ff       	call   8009f2 <strlen>
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80247c:	0f 8f 85 00 00 00    	jg     802507 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802482:	83 ec 0c             	sub    $0xc,%esp
+  802485:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802488:	50                   	push   %eax
+  802489:	e8 a7 f6 ff ff       	call   801b35 <fd_alloc>
+  80248e:	89 c3                	mov    %eax,%ebx
+  802490:	83 c4 10             	add    $0x10,%esp
+  802493:	85 c0                	test   %eax,%eax
+  802495:	78 55                	js     8024ec <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802497:	83 ec 0c             	sub    $0xc,%esp
+  80249a:	68 04 70 80 00       	push   $0x807004
+  80249f:	e8 79 18 00 00       	call   803d1d <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8024a4:	83 c4 08             	add    $0x8,%esp
+  8024a7:	56                   	push   %esi
+  8024a8:	68 00 80 80 00       	push   $0x808000
+  8024ad:	e8 7b e5 ff ff       	call   800a2d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8024b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b5:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8024ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024c2:	e8 7e fc ff ff       	call   802145 <fsipc>
+  8024c7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024c9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024d0:	e8 b5 18 00 00       	call   803d8a <mutex_unlock>
+	if (r < 0) {
+  8024d5:	83 c4 10             	add    $0x10,%esp
+  8024d8:	85 db                	test   %ebx,%ebx
+  8024da:	78 19                	js     8024f5 <open+0x92>
+	return fd2num(fd);
+  8024dc:	83 ec 0c             	sub    $0xc,%esp
+  8024df:	ff 75 f4             	push   -0xc(%ebp)
+  8024e2:	e8 27 f6 ff ff       	call   801b0e <fd2num>
+  8024e7:	89 c3                	mov    %eax,%ebx
+  8024e9:	83 c4 10             	add    $0x10,%esp
+}
+  8024ec:	89 d8                	mov    %ebx,%eax
+  8024ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f1:	5b                   	pop    %ebx
+  8024f2:	5e                   	pop    %esi
+  8024f3:	5d                   	pop    %ebp
+  8024f4:	c3                   	ret
+		fd_close(fd, 0);
+  8024f5:	83 ec 08             	sub    $0x8,%esp
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	ff 75 f4             	push   -0xc(%ebp)
+  8024fd:	e8 56 f7 ff ff       	call   801c58 <fd_close>
+		return r;
+  802502:	83 c4 10             	add    $0x10,%esp
+  802505:	eb e5                	jmp    8024ec <open+0x89>
+		return -E_BAD_PATH;
+  802507:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80250c:	eb de                	jmp    8024ec <open+0x89>
+
+0080250e <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	53                   	push   %ebx
+  802512:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802515:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802518:	50                   	push   %eax
+  802519:	ff 75 08             	push   0x8(%ebp)
+  80251c:	e8 6a f6 ff ff       	call   801b8b <fd_lookup>
+  802521:	89 c3                	mov    %eax,%ebx
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	85 c0                	test   %eax,%eax
+  802528:	78 5b                	js     802585 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80252a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80252d:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802533:	39 08                	cmp    %ecx,(%eax)
+  802535:	75 55                	jne    80258c <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802537:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80253b:	74 56                	je     802593 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80253d:	83 ec 0c             	sub    $0xc,%esp
+  802540:	68 04 70 80 00       	push   $0x807004
+  802545:	e8 d3 17 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  80254a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80254d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802550:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802555:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802558:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80255d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802560:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80256f:	e8 d1 fb ff ff       	call   802145 <fsipc>
+  802574:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802576:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80257d:	e8 08 18 00 00       	call   803d8a <mutex_unlock>
+	return r;
+  802582:	83 c4 10             	add    $0x10,%esp
+}
+  802585:	89 d8                	mov    %ebx,%eax
+  802587:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258a:	c9                   	leave
+  80258b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80258c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802591:	eb f2                	jmp    802585 <fallocate+0x77>
+		return -E_INVAL;
+  802593:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802598:	eb eb                	jmp    802585 <fallocate+0x77>
+
+0080259a <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80259a:	55                   	push   %ebp
+  80259b:	89 e5                	mov    %esp,%ebp
+  80259d:	56                   	push   %esi
+  80259e:	53                   	push   %ebx
+  80259f:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8025a2:	89 f3                	mov    %esi,%ebx
+  8025a4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8025aa:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8025ad:	eb 06                	jmp    8025b5 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8025af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025b5:	39 f3                	cmp    %esi,%ebx
+  8025b7:	73 14                	jae    8025cd <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8025b9:	83 ec 08             	sub    $0x8,%esp
+  8025bc:	53                   	push   %ebx
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	e8 40 e9 ff ff       	call   800f04 <sys_page_unmap>
+  8025c4:	83 c4 10             	add    $0x10,%esp
+  8025c7:	85 c0                	test   %eax,%eax
+  8025c9:	79 e4                	jns    8025af <munmap+0x15>
+  8025cb:	eb 05                	jmp    8025d2 <munmap+0x38>
+			return r;
+	return 0;
+  8025cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d5:	5b                   	pop    %ebx
+  8025d6:	5e                   	pop    %esi
+  8025d7:	5d                   	pop    %ebp
+  8025d8:	c3                   	ret
+
+008025d9 <mmap>:
+{
+  8025d9:	55                   	push   %ebp
+  8025da:	89 e5                	mov    %esp,%ebp
+  8025dc:	57                   	push   %edi
+  8025dd:	56                   	push   %esi
+  8025de:	53                   	push   %ebx
+  8025df:	83 ec 24             	sub    $0x24,%esp
+  8025e2:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025e8:	50                   	push   %eax
+  8025e9:	ff 75 08             	push   0x8(%ebp)
+  8025ec:	e8 9a f5 ff ff       	call   801b8b <fd_lookup>
+  8025f1:	83 c4 10             	add    $0x10,%esp
+  8025f4:	85 c0                	test   %eax,%eax
+  8025f6:	0f 88 37 01 00 00    	js     802733 <mmap+0x15a>
+		return NULL;
+  8025fc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802601:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802604:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80260a:	39 0a                	cmp    %ecx,(%edx)
+  80260c:	0f 85 05 01 00 00    	jne    802717 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802612:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802619:	0f 85 1b 01 00 00    	jne    80273a <mmap+0x161>
+  80261f:	89 f0                	mov    %esi,%eax
+  802621:	83 e8 01             	sub    $0x1,%eax
+  802624:	0f 88 17 01 00 00    	js     802741 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80262a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80262e:	75 28                	jne    802658 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802630:	83 ec 0c             	sub    $0xc,%esp
+  802633:	68 04 70 80 00       	push   $0x807004
+  802638:	e8 e0 16 00 00       	call   803d1d <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80263d:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802643:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802651:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802656:	eb 2b                	jmp    802683 <mmap+0xaa>
+		cow_enable();
+  802658:	e8 b5 ee ff ff       	call   801512 <cow_enable>
+  80265d:	eb d1                	jmp    802630 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80265f:	89 c2                	mov    %eax,%edx
+  802661:	c1 ea 0c             	shr    $0xc,%edx
+  802664:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80266b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802671:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802677:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80267a:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80267c:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802681:	77 25                	ja     8026a8 <mmap+0xcf>
+  802683:	89 c2                	mov    %eax,%edx
+  802685:	29 da                	sub    %ebx,%edx
+  802687:	39 ca                	cmp    %ecx,%edx
+  802689:	73 3a                	jae    8026c5 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80268b:	89 c2                	mov    %eax,%edx
+  80268d:	c1 ea 16             	shr    $0x16,%edx
+  802690:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802697:	f6 c2 01             	test   $0x1,%dl
+  80269a:	75 c3                	jne    80265f <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80269c:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8026a1:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8026a6:	eb d4                	jmp    80267c <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8026a8:	29 d8                	sub    %ebx,%eax
+  8026aa:	39 c8                	cmp    %ecx,%eax
+  8026ac:	73 17                	jae    8026c5 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8026ae:	83 ec 0c             	sub    $0xc,%esp
+  8026b1:	68 04 70 80 00       	push   $0x807004
+  8026b6:	e8 cf 16 00 00       	call   803d8a <mutex_unlock>
+		return NULL;
+  8026bb:	83 c4 10             	add    $0x10,%esp
+  8026be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c3:	eb 52                	jmp    802717 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8026c5:	85 db                	test   %ebx,%ebx
+  8026c7:	74 e5                	je     8026ae <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8026c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026cf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8026d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d7:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8026dc:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8026e2:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8026e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026eb:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8026f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8026fa:	e8 46 fa ff ff       	call   802145 <fsipc>
+  8026ff:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802701:	83 ec 0c             	sub    $0xc,%esp
+  802704:	68 04 70 80 00       	push   $0x807004
+  802709:	e8 7c 16 00 00       	call   803d8a <mutex_unlock>
+	if (r < 0) {
+  80270e:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802711:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802713:	85 ff                	test   %edi,%edi
+  802715:	78 08                	js     80271f <mmap+0x146>
+}
+  802717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271a:	5b                   	pop    %ebx
+  80271b:	5e                   	pop    %esi
+  80271c:	5f                   	pop    %edi
+  80271d:	5d                   	pop    %ebp
+  80271e:	c3                   	ret
+		munmap((void*) va, len);
+  80271f:	83 ec 08             	sub    $0x8,%esp
+  802722:	56                   	push   %esi
+  802723:	53                   	push   %ebx
+  802724:	e8 71 fe ff ff       	call   80259a <munmap>
+		return NULL;
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802731:	eb e4                	jmp    802717 <mmap+0x13e>
+		return NULL;
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+  802738:	eb dd                	jmp    802717 <mmap+0x13e>
+		return NULL;
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273f:	eb d6                	jmp    802717 <mmap+0x13e>
+  802741:	b8 00 00 00 00       	mov    $0x0,%eax
+  802746:	eb cf                	jmp    802717 <mmap+0x13e>
+
+00802748 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802748:	55                   	push   %ebp
+  802749:	89 e5                	mov    %esp,%ebp
+  80274b:	53                   	push   %ebx
+  80274c:	83 ec 10             	sub    $0x10,%esp
+  80274f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802752:	53                   	push   %ebx
+  802753:	e8 9a e2 ff ff       	call   8009f2 <strlen>
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802760:	7f 42                	jg     8027a4 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802762:	83 ec 0c             	sub    $0xc,%esp
+  802765:	68 04 70 80 00       	push   $0x807004
+  80276a:	e8 ae 15 00 00       	call   803d1d <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80276f:	83 c4 08             	add    $0x8,%esp
+  802772:	53                   	push   %ebx
+  802773:	68 00 80 80 00       	push   $0x808000
+  802778:	e8 b0 e2 ff ff       	call   800a2d <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80277d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802782:	b8 07 00 00 00       	mov    $0x7,%eax
+  802787:	e8 b9 f9 ff ff       	call   802145 <fsipc>
+  80278c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80278e:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802795:	e8 f0 15 00 00       	call   803d8a <mutex_unlock>
+	return r;
+  80279a:	83 c4 10             	add    $0x10,%esp
+}
+  80279d:	89 d8                	mov    %ebx,%eax
+  80279f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a2:	c9                   	leave
+  8027a3:	c3                   	ret
+		return -E_BAD_PATH;
+  8027a4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027a9:	eb f2                	jmp    80279d <remove+0x55>
+
+008027ab <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027ab:	55                   	push   %ebp
+  8027ac:	89 e5                	mov    %esp,%ebp
+  8027ae:	53                   	push   %ebx
+  8027af:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8027b2:	68 04 70 80 00       	push   $0x807004
+  8027b7:	e8 61 15 00 00       	call   803d1d <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8027bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027c6:	e8 7a f9 ff ff       	call   802145 <fsipc>
+  8027cb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027cd:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8027d4:	e8 b1 15 00 00       	call   803d8a <mutex_unlock>
+	return r;
+}
+  8027d9:	89 d8                	mov    %ebx,%eax
+  8027db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027de:	c9                   	leave
+  8027df:	c3                   	ret
+
+008027e0 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	56                   	push   %esi
+  8027e4:	53                   	push   %ebx
+  8027e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8027e8:	83 ec 0c             	sub    $0xc,%esp
+  8027eb:	68 04 70 80 00       	push   $0x807004
+  8027f0:	e8 28 15 00 00       	call   803d1d <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8027f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8027fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802802:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802807:	e8 39 f9 ff ff       	call   802145 <fsipc>
+  80280c:	89 c6                	mov    %eax,%esi
+  80280e:	83 c4 10             	add    $0x10,%esp
+  802811:	85 db                	test   %ebx,%ebx
+  802813:	74 7b                	je     802890 <fs_bcstat+0xb0>
+  802815:	85 c0                	test   %eax,%eax
+  802817:	78 77                	js     802890 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802819:	a1 00 80 80 00       	mov    0x808000,%eax
+  80281e:	89 03                	mov    %eax,(%ebx)
+  802820:	a1 04 80 80 00       	mov    0x808004,%eax
+  802825:	89 43 04             	mov    %eax,0x4(%ebx)
+  802828:	a1 08 80 80 00       	mov    0x808008,%eax
+  80282d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802830:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802835:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802838:	a1 10 80 80 00       	mov    0x808010,%eax
+  80283d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802840:	a1 14 80 80 00       	mov    0x808014,%eax
+  802845:	89 43 14             	mov    %eax,0x14(%ebx)
+  802848:	a1 18 80 80 00       	mov    0x808018,%eax
+  80284d:	89 43 18             	mov    %eax,0x18(%ebx)
+  802850:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802855:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802858:	a1 20 80 80 00       	mov    0x808020,%eax
+  80285d:	89 43 20             	mov    %eax,0x20(%ebx)
+  802860:	a1 24 80 80 00       	mov    0x808024,%eax
+  802865:	89 43 24             	mov    %eax,0x24(%ebx)
+  802868:	a1 28 80 80 00       	mov    0x808028,%eax
+  80286d:	89 43 28             	mov    %eax,0x28(%ebx)
+  802870:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802875:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802878:	a1 30 80 80 00       	mov    0x808030,%eax
+  80287d:	89 43 30             	mov    %eax,0x30(%ebx)
+  802880:	a1 34 80 80 00       	mov    0x808034,%eax
+  802885:	89 43 34             	mov    %eax,0x34(%ebx)
+  802888:	a1 38 80 80 00       	mov    0x808038,%eax
+  80288d:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802890:	83 ec 0c             	sub    $0xc,%esp
+  802893:	68 04 70 80 00       	push   $0x807004
+  802898:	e8 ed 14 00 00       	call   803d8a <mutex_unlock>
+	return r;
+}
+  80289d:	89 f0                	mov    %esi,%eax
+  80289f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a2:	5b                   	pop    %ebx
+  8028a3:	5e                   	pop    %esi
+  8028a4:	5d                   	pop    %ebp
+  8028a5:	c3                   	ret
+
+008028a6 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8028a6:	55                   	push   %ebp
+  8028a7:	89 e5                	mov    %esp,%ebp
+  8028a9:	56                   	push   %esi
+  8028aa:	53                   	push   %ebx
+  8028ab:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8028ad:	0f b6 10             	movzbl (%eax),%edx
+  8028b0:	80 fa 72             	cmp    $0x72,%dl
+  8028b3:	74 44                	je     8028f9 <parse_mode+0x53>
+  8028b5:	80 fa 77             	cmp    $0x77,%dl
+  8028b8:	74 4b                	je     802905 <parse_mode+0x5f>
+  8028ba:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028bf:	80 fa 61             	cmp    $0x61,%dl
+  8028c2:	74 09                	je     8028cd <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8028c4:	89 d8                	mov    %ebx,%eax
+  8028c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c9:	5b                   	pop    %ebx
+  8028ca:	5e                   	pop    %esi
+  8028cb:	5d                   	pop    %ebp
+  8028cc:	c3                   	ret
+	switch (mode[0]) {
+  8028cd:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8028d2:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8028d7:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8028d9:	83 ec 08             	sub    $0x8,%esp
+  8028dc:	6a 2b                	push   $0x2b
+  8028de:	50                   	push   %eax
+  8028df:	e8 5b e2 ff ff       	call   800b3f <strchr>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	74 d9                	je     8028c4 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8028eb:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8028ee:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8028f1:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8028f7:	eb cb                	jmp    8028c4 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8028f9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802903:	eb d2                	jmp    8028d7 <parse_mode+0x31>
+  802905:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80290a:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80290f:	eb c6                	jmp    8028d7 <parse_mode+0x31>
+
+00802911 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	57                   	push   %edi
+  802915:	56                   	push   %esi
+  802916:	53                   	push   %ebx
+  802917:	83 ec 1c             	sub    $0x1c,%esp
+  80291a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80291d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802920:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802925:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80292a:	83 c0 24             	add    $0x24,%eax
+  80292d:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802931:	74 17                	je     80294a <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802933:	83 c3 01             	add    $0x1,%ebx
+  802936:	83 fb 10             	cmp    $0x10,%ebx
+  802939:	75 ef                	jne    80292a <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80293b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802940:	89 f0                	mov    %esi,%eax
+  802942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802945:	5b                   	pop    %ebx
+  802946:	5e                   	pop    %esi
+  802947:	5f                   	pop    %edi
+  802948:	5d                   	pop    %ebp
+  802949:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80294a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802951:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802954:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802957:	c1 e7 02             	shl    $0x2,%edi
+  80295a:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802960:	83 ec 04             	sub    $0x4,%esp
+  802963:	6a 24                	push   $0x24
+  802965:	6a 00                	push   $0x0
+  802967:	56                   	push   %esi
+  802968:	e8 11 e2 ff ff       	call   800b7e <memset>
+			streams[i].f_fd = fd;
+  80296d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802970:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802976:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802979:	01 d8                	add    %ebx,%eax
+  80297b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80297e:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802985:	83 c4 10             	add    $0x10,%esp
+  802988:	eb b6                	jmp    802940 <stream_alloc+0x2f>
+
+0080298a <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80298a:	55                   	push   %ebp
+  80298b:	89 e5                	mov    %esp,%ebp
+  80298d:	53                   	push   %ebx
+  80298e:	83 ec 14             	sub    $0x14,%esp
+  802991:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802993:	8b 40 18             	mov    0x18(%eax),%eax
+  802996:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802999:	74 4a                	je     8029e5 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80299b:	83 ec 08             	sub    $0x8,%esp
+  80299e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	ff 33                	push   (%ebx)
+  8029a4:	e8 e2 f1 ff ff       	call   801b8b <fd_lookup>
+  8029a9:	89 c2                	mov    %eax,%edx
+  8029ab:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029ae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8029b3:	85 d2                	test   %edx,%edx
+  8029b5:	78 41                	js     8029f8 <stream_unread+0x6e>
+  8029b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029ba:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8029c0:	39 0a                	cmp    %ecx,(%edx)
+  8029c2:	75 34                	jne    8029f8 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8029c4:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029c7:	03 42 04             	add    0x4(%edx),%eax
+  8029ca:	2b 43 18             	sub    0x18(%ebx),%eax
+  8029cd:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8029d0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8029d7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8029de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029e3:	eb 13                	jmp    8029f8 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8029e5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8029ec:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8029f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8029f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029fb:	c9                   	leave
+  8029fc:	c3                   	ret
+
+008029fd <stream_drain>:
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	56                   	push   %esi
+  802a01:	53                   	push   %ebx
+  802a02:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802a04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a09:	eb 02                	jmp    802a0d <stream_drain+0x10>
+  802a0b:	01 c3                	add    %eax,%ebx
+  802a0d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a10:	39 c3                	cmp    %eax,%ebx
+  802a12:	73 43                	jae    802a57 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802a14:	83 ec 04             	sub    $0x4,%esp
+  802a17:	29 d8                	sub    %ebx,%eax
+  802a19:	50                   	push   %eax
+  802a1a:	89 d8                	mov    %ebx,%eax
+  802a1c:	03 46 0c             	add    0xc(%esi),%eax
+  802a1f:	50                   	push   %eax
+  802a20:	ff 36                	push   (%esi)
+  802a22:	e8 ec f4 ff ff       	call   801f13 <write>
+  802a27:	83 c4 10             	add    $0x10,%esp
+  802a2a:	85 c0                	test   %eax,%eax
+  802a2c:	7f dd                	jg     802a0b <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802a2e:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802a32:	8b 56 0c             	mov    0xc(%esi),%edx
+  802a35:	83 ec 04             	sub    $0x4,%esp
+  802a38:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a3b:	29 d8                	sub    %ebx,%eax
+  802a3d:	50                   	push   %eax
+  802a3e:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802a41:	50                   	push   %eax
+  802a42:	52                   	push   %edx
+  802a43:	e8 6b e1 ff ff       	call   800bb3 <memmove>
+			f->f_wend -= done;
+  802a48:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a4b:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802a4d:	83 c4 10             	add    $0x10,%esp
+  802a50:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a55:	eb 0a                	jmp    802a61 <stream_drain+0x64>
+  802a57:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802a5c:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802a61:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802a64:	89 d0                	mov    %edx,%eax
+  802a66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a69:	5b                   	pop    %ebx
+  802a6a:	5e                   	pop    %esi
+  802a6b:	5d                   	pop    %ebp
+  802a6c:	c3                   	ret
+
+00802a6d <stream_setup>:
+	if (f->f_buf)
+  802a6d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a71:	74 01                	je     802a74 <stream_setup+0x7>
+  802a73:	c3                   	ret
+{
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	53                   	push   %ebx
+  802a78:	83 ec 04             	sub    $0x4,%esp
+  802a7b:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802a7d:	8b 40 08             	mov    0x8(%eax),%eax
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	74 17                	je     802a9b <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802a84:	83 f8 03             	cmp    $0x3,%eax
+  802a87:	75 2d                	jne    802ab6 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802a89:	8d 43 20             	lea    0x20(%ebx),%eax
+  802a8c:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802a8f:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a99:	c9                   	leave
+  802a9a:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802a9b:	83 ec 0c             	sub    $0xc,%esp
+  802a9e:	ff 33                	push   (%ebx)
+  802aa0:	e8 87 20 00 00       	call   804b2c <iscons>
+  802aa5:	83 c4 10             	add    $0x10,%esp
+  802aa8:	85 c0                	test   %eax,%eax
+  802aaa:	0f 9f c0             	setg   %al
+  802aad:	0f b6 c0             	movzbl %al,%eax
+  802ab0:	83 c0 01             	add    $0x1,%eax
+  802ab3:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802ab6:	83 ec 0c             	sub    $0xc,%esp
+  802ab9:	68 00 10 00 00       	push   $0x1000
+  802abe:	e8 6e 0b 00 00       	call   803631 <malloc>
+  802ac3:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	85 c0                	test   %eax,%eax
+  802acb:	74 bc                	je     802a89 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802acd:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802ad4:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802ad8:	eb bc                	jmp    802a96 <stream_setup+0x29>
+
+00802ada <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802ada:	55                   	push   %ebp
+  802adb:	89 e5                	mov    %esp,%ebp
+  802add:	53                   	push   %ebx
+  802ade:	83 ec 04             	sub    $0x4,%esp
+  802ae1:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802ae3:	e8 85 ff ff ff       	call   802a6d <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802aed:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802af1:	74 3d                	je     802b30 <stream_fill+0x56>
+  802af3:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802af7:	74 10                	je     802b09 <stream_fill+0x2f>
+  802af9:	89 d8                	mov    %ebx,%eax
+  802afb:	e8 fd fe ff ff       	call   8029fd <stream_drain>
+		return 0;
+  802b00:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802b05:	85 c0                	test   %eax,%eax
+  802b07:	78 27                	js     802b30 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802b09:	83 ec 04             	sub    $0x4,%esp
+  802b0c:	ff 73 10             	push   0x10(%ebx)
+  802b0f:	ff 73 0c             	push   0xc(%ebx)
+  802b12:	ff 33                	push   (%ebx)
+  802b14:	e8 02 f3 ff ff       	call   801e1b <read>
+  802b19:	83 c4 10             	add    $0x10,%esp
+  802b1c:	85 c0                	test   %eax,%eax
+  802b1e:	7e 17                	jle    802b37 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802b20:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802b24:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802b2b:	89 c2                	mov    %eax,%edx
+  802b2d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802b30:	89 d0                	mov    %edx,%eax
+  802b32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b35:	c9                   	leave
+  802b36:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802b37:	c1 f8 1f             	sar    $0x1f,%eax
+  802b3a:	83 e0 04             	and    $0x4,%eax
+  802b3d:	83 c0 04             	add    $0x4,%eax
+  802b40:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b48:	eb e6                	jmp    802b30 <stream_fill+0x56>
+
+00802b4a <fopen>:
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	57                   	push   %edi
+  802b4e:	56                   	push   %esi
+  802b4f:	53                   	push   %ebx
+  802b50:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802b56:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b59:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802b5f:	89 f0                	mov    %esi,%eax
+  802b61:	e8 40 fd ff ff       	call   8028a6 <parse_mode>
+		return 0;
+  802b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b6b:	85 c0                	test   %eax,%eax
+  802b6d:	78 2d                	js     802b9c <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+  802b72:	50                   	push   %eax
+  802b73:	ff 75 08             	push   0x8(%ebp)
+  802b76:	e8 e8 f8 ff ff       	call   802463 <open>
+  802b7b:	89 c7                	mov    %eax,%edi
+  802b7d:	83 c4 10             	add    $0x10,%esp
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 58                	js     802bdc <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802b84:	80 3e 61             	cmpb   $0x61,(%esi)
+  802b87:	74 1d                	je     802ba6 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802b89:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802b8f:	89 f8                	mov    %edi,%eax
+  802b91:	e8 7b fd ff ff       	call   802911 <stream_alloc>
+  802b96:	89 c3                	mov    %eax,%ebx
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	74 32                	je     802bce <fopen+0x84>
+}
+  802b9c:	89 d8                	mov    %ebx,%eax
+  802b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba1:	5b                   	pop    %ebx
+  802ba2:	5e                   	pop    %esi
+  802ba3:	5f                   	pop    %edi
+  802ba4:	5d                   	pop    %ebp
+  802ba5:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802ba6:	83 ec 08             	sub    $0x8,%esp
+  802ba9:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802baf:	50                   	push   %eax
+  802bb0:	57                   	push   %edi
+  802bb1:	e8 db f4 ff ff       	call   802091 <fstat>
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	78 cc                	js     802b89 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802bbd:	83 ec 08             	sub    $0x8,%esp
+  802bc0:	ff 75 dc             	push   -0x24(%ebp)
+  802bc3:	57                   	push   %edi
+  802bc4:	e8 f6 f3 ff ff       	call   801fbf <seek>
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	eb bb                	jmp    802b89 <fopen+0x3f>
+		close(fd);
+  802bce:	83 ec 0c             	sub    $0xc,%esp
+  802bd1:	57                   	push   %edi
+  802bd2:	e8 08 f1 ff ff       	call   801cdf <close>
+  802bd7:	83 c4 10             	add    $0x10,%esp
+  802bda:	eb c0                	jmp    802b9c <fopen+0x52>
+		return 0;
+  802bdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be1:	eb b9                	jmp    802b9c <fopen+0x52>
+
+00802be3 <fdopen>:
+{
+  802be3:	55                   	push   %ebp
+  802be4:	89 e5                	mov    %esp,%ebp
+  802be6:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802be9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bef:	e8 b2 fc ff ff       	call   8028a6 <parse_mode>
+  802bf4:	89 c2                	mov    %eax,%edx
+		return 0;
+  802bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802bfb:	85 d2                	test   %edx,%edx
+  802bfd:	78 0b                	js     802c0a <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802bff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c05:	e8 07 fd ff ff       	call   802911 <stream_alloc>
+}
+  802c0a:	c9                   	leave
+  802c0b:	c3                   	ret
+
+00802c0c <setvbuf>:
+{
+  802c0c:	55                   	push   %ebp
+  802c0d:	89 e5                	mov    %esp,%ebp
+  802c0f:	57                   	push   %edi
+  802c10:	56                   	push   %esi
+  802c11:	53                   	push   %ebx
+  802c12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c15:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c18:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802c1b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802c1f:	75 3a                	jne    802c5b <setvbuf+0x4f>
+  802c21:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802c24:	83 fe 02             	cmp    $0x2,%esi
+  802c27:	77 39                	ja     802c62 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802c29:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802c2c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c30:	0f 95 c3             	setne  %bl
+  802c33:	85 ff                	test   %edi,%edi
+  802c35:	0f 95 c1             	setne  %cl
+  802c38:	84 cb                	test   %cl,%bl
+  802c3a:	74 05                	je     802c41 <setvbuf+0x35>
+  802c3c:	83 fa 03             	cmp    $0x3,%edx
+  802c3f:	75 0a                	jne    802c4b <setvbuf+0x3f>
+	return 0;
+  802c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c46:	5b                   	pop    %ebx
+  802c47:	5e                   	pop    %esi
+  802c48:	5f                   	pop    %edi
+  802c49:	5d                   	pop    %ebp
+  802c4a:	c3                   	ret
+		f->f_buf = buf;
+  802c4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c4e:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802c51:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c59:	eb eb                	jmp    802c46 <setvbuf+0x3a>
+		return EOF;
+  802c5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c60:	eb e4                	jmp    802c46 <setvbuf+0x3a>
+  802c62:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c67:	eb dd                	jmp    802c46 <setvbuf+0x3a>
+
+00802c69 <fflush>:
+{
+  802c69:	55                   	push   %ebp
+  802c6a:	89 e5                	mov    %esp,%ebp
+  802c6c:	57                   	push   %edi
+  802c6d:	56                   	push   %esi
+  802c6e:	53                   	push   %ebx
+  802c6f:	83 ec 0c             	sub    $0xc,%esp
+  802c72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802c75:	85 db                	test   %ebx,%ebx
+  802c77:	74 1a                	je     802c93 <fflush+0x2a>
+	stream_unread(f);
+  802c79:	89 d8                	mov    %ebx,%eax
+  802c7b:	e8 0a fd ff ff       	call   80298a <stream_unread>
+	return stream_drain(f);
+  802c80:	89 d8                	mov    %ebx,%eax
+  802c82:	e8 76 fd ff ff       	call   8029fd <stream_drain>
+  802c87:	89 c7                	mov    %eax,%edi
+}
+  802c89:	89 f8                	mov    %edi,%eax
+  802c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c8e:	5b                   	pop    %ebx
+  802c8f:	5e                   	pop    %esi
+  802c90:	5f                   	pop    %edi
+  802c91:	5d                   	pop    %ebp
+  802c92:	c3                   	ret
+  802c93:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802c98:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802c9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca2:	eb 03                	jmp    802ca7 <fflush+0x3e>
+  802ca4:	83 c3 24             	add    $0x24,%ebx
+  802ca7:	39 f3                	cmp    %esi,%ebx
+  802ca9:	74 de                	je     802c89 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802cab:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802caf:	74 f3                	je     802ca4 <fflush+0x3b>
+  802cb1:	83 ec 0c             	sub    $0xc,%esp
+  802cb4:	53                   	push   %ebx
+  802cb5:	e8 af ff ff ff       	call   802c69 <fflush>
+  802cba:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802cc4:	0f 48 f8             	cmovs  %eax,%edi
+  802cc7:	eb db                	jmp    802ca4 <fflush+0x3b>
+
+00802cc9 <fclose>:
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	56                   	push   %esi
+  802ccd:	53                   	push   %ebx
+  802cce:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802cd1:	83 ec 0c             	sub    $0xc,%esp
+  802cd4:	56                   	push   %esi
+  802cd5:	e8 8f ff ff ff       	call   802c69 <fflush>
+  802cda:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802cdc:	83 c4 04             	add    $0x4,%esp
+  802cdf:	ff 36                	push   (%esi)
+  802ce1:	e8 f9 ef ff ff       	call   801cdf <close>
+  802ce6:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802ce9:	85 c0                	test   %eax,%eax
+  802ceb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802cf0:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802cf3:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802cf7:	75 10                	jne    802d09 <fclose+0x40>
+	f->f_flags = 0;
+  802cf9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802d00:	89 d8                	mov    %ebx,%eax
+  802d02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d05:	5b                   	pop    %ebx
+  802d06:	5e                   	pop    %esi
+  802d07:	5d                   	pop    %ebp
+  802d08:	c3                   	ret
+		free(f->f_buf);
+  802d09:	83 ec 0c             	sub    $0xc,%esp
+  802d0c:	ff 76 0c             	push   0xc(%esi)
+  802d0f:	e8 54 08 00 00       	call   803568 <free>
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	eb e0                	jmp    802cf9 <fclose+0x30>
+
+00802d19 <fileno>:
+{
+  802d19:	55                   	push   %ebp
+  802d1a:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1f:	8b 00                	mov    (%eax),%eax
+}
+  802d21:	5d                   	pop    %ebp
+  802d22:	c3                   	ret
+
+00802d23 <feof>:
+{
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d29:	8b 40 04             	mov    0x4(%eax),%eax
+  802d2c:	c1 e8 02             	shr    $0x2,%eax
+  802d2f:	83 e0 01             	and    $0x1,%eax
+}
+  802d32:	5d                   	pop    %ebp
+  802d33:	c3                   	ret
+
+00802d34 <ferror>:
+{
+  802d34:	55                   	push   %ebp
+  802d35:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3a:	8b 40 04             	mov    0x4(%eax),%eax
+  802d3d:	c1 e8 03             	shr    $0x3,%eax
+  802d40:	83 e0 01             	and    $0x1,%eax
+}
+  802d43:	5d                   	pop    %ebp
+  802d44:	c3                   	ret
+
+00802d45 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802d45:	55                   	push   %ebp
+  802d46:	89 e5                	mov    %esp,%ebp
+  802d48:	53                   	push   %ebx
+  802d49:	83 ec 04             	sub    $0x4,%esp
+  802d4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d4f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802d52:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802d55:	74 15                	je     802d6c <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802d57:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802d5a:	8b 43 14             	mov    0x14(%ebx),%eax
+  802d5d:	8d 48 01             	lea    0x1(%eax),%ecx
+  802d60:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802d63:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d6c:	89 d8                	mov    %ebx,%eax
+  802d6e:	e8 67 fd ff ff       	call   802ada <stream_fill>
+  802d73:	85 c0                	test   %eax,%eax
+  802d75:	75 e0                	jne    802d57 <fgetc+0x12>
+		return EOF;
+  802d77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d7c:	eb e9                	jmp    802d67 <fgetc+0x22>
+
+00802d7e <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	57                   	push   %edi
+  802d82:	56                   	push   %esi
+  802d83:	53                   	push   %ebx
+  802d84:	83 ec 1c             	sub    $0x1c,%esp
+  802d87:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802d8a:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d92:	83 e8 01             	sub    $0x1,%eax
+  802d95:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802d98:	eb 66                	jmp    802e00 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802d9a:	8b 46 14             	mov    0x14(%esi),%eax
+  802d9d:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802da0:	29 c3                	sub    %eax,%ebx
+  802da2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802da5:	29 fa                	sub    %edi,%edx
+  802da7:	39 d3                	cmp    %edx,%ebx
+  802da9:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802dac:	83 ec 04             	sub    $0x4,%esp
+  802daf:	53                   	push   %ebx
+  802db0:	6a 0a                	push   $0xa
+  802db2:	03 46 0c             	add    0xc(%esi),%eax
+  802db5:	50                   	push   %eax
+  802db6:	e8 a9 de ff ff       	call   800c64 <memfind>
+  802dbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802dbe:	8b 46 0c             	mov    0xc(%esi),%eax
+  802dc1:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802dc4:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802dc7:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802dcf:	74 0b                	je     802ddc <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802dd1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dd4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dd7:	29 d3                	sub    %edx,%ebx
+  802dd9:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802ddc:	83 ec 04             	sub    $0x4,%esp
+  802ddf:	53                   	push   %ebx
+  802de0:	01 c8                	add    %ecx,%eax
+  802de2:	50                   	push   %eax
+  802de3:	89 f8                	mov    %edi,%eax
+  802de5:	03 45 08             	add    0x8(%ebp),%eax
+  802de8:	50                   	push   %eax
+  802de9:	e8 c5 dd ff ff       	call   800bb3 <memmove>
+		f->f_rpos += m;
+  802dee:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802df1:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802df3:	83 c4 10             	add    $0x10,%esp
+  802df6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df9:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802dfe:	74 1f                	je     802e1f <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802e00:	8d 47 01             	lea    0x1(%edi),%eax
+  802e03:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802e06:	73 17                	jae    802e1f <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802e08:	8b 46 18             	mov    0x18(%esi),%eax
+  802e0b:	39 46 14             	cmp    %eax,0x14(%esi)
+  802e0e:	75 8a                	jne    802d9a <fgets+0x1c>
+  802e10:	89 f0                	mov    %esi,%eax
+  802e12:	e8 c3 fc ff ff       	call   802ada <stream_fill>
+  802e17:	85 c0                	test   %eax,%eax
+  802e19:	0f 85 7b ff ff ff    	jne    802d9a <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802e1f:	85 ff                	test   %edi,%edi
+  802e21:	74 0f                	je     802e32 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e26:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e2d:	5b                   	pop    %ebx
+  802e2e:	5e                   	pop    %esi
+  802e2f:	5f                   	pop    %edi
+  802e30:	5d                   	pop    %ebp
+  802e31:	c3                   	ret
+		return 0;
+  802e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e37:	eb f1                	jmp    802e2a <fgets+0xac>
+
+00802e39 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	57                   	push   %edi
+  802e3d:	56                   	push   %esi
+  802e3e:	53                   	push   %ebx
+  802e3f:	83 ec 1c             	sub    $0x1c,%esp
+  802e42:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802e45:	89 f0                	mov    %esi,%eax
+  802e47:	e8 21 fc ff ff       	call   802a6d <stream_setup>
+	want = size * n;
+  802e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e4f:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5b:	eb 43                	jmp    802ea0 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802e5d:	29 d3                	sub    %edx,%ebx
+  802e5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e62:	29 f8                	sub    %edi,%eax
+  802e64:	39 c3                	cmp    %eax,%ebx
+  802e66:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802e69:	83 ec 04             	sub    $0x4,%esp
+  802e6c:	53                   	push   %ebx
+  802e6d:	03 56 0c             	add    0xc(%esi),%edx
+  802e70:	52                   	push   %edx
+  802e71:	89 f8                	mov    %edi,%eax
+  802e73:	03 45 08             	add    0x8(%ebp),%eax
+  802e76:	50                   	push   %eax
+  802e77:	e8 37 dd ff ff       	call   800bb3 <memmove>
+			f->f_rpos += m;
+  802e7c:	01 5e 14             	add    %ebx,0x14(%esi)
+  802e7f:	83 c4 10             	add    $0x10,%esp
+  802e82:	eb 1a                	jmp    802e9e <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802e84:	83 ec 04             	sub    $0x4,%esp
+  802e87:	53                   	push   %ebx
+  802e88:	89 f8                	mov    %edi,%eax
+  802e8a:	03 45 08             	add    0x8(%ebp),%eax
+  802e8d:	50                   	push   %eax
+  802e8e:	ff 36                	push   (%esi)
+  802e90:	e8 86 ef ff ff       	call   801e1b <read>
+  802e95:	89 c3                	mov    %eax,%ebx
+  802e97:	83 c4 10             	add    $0x10,%esp
+  802e9a:	85 c0                	test   %eax,%eax
+  802e9c:	7e 36                	jle    802ed4 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802e9e:	01 df                	add    %ebx,%edi
+  802ea0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ea3:	39 c7                	cmp    %eax,%edi
+  802ea5:	73 39                	jae    802ee0 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802ea7:	8b 56 14             	mov    0x14(%esi),%edx
+  802eaa:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ead:	39 da                	cmp    %ebx,%edx
+  802eaf:	72 ac                	jb     802e5d <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802eb1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802eb4:	29 fb                	sub    %edi,%ebx
+  802eb6:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802eb9:	72 3e                	jb     802ef9 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802ebb:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802ebf:	74 1f                	je     802ee0 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802ec1:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802ec5:	74 bd                	je     802e84 <fread+0x4b>
+  802ec7:	89 f0                	mov    %esi,%eax
+  802ec9:	e8 2f fb ff ff       	call   8029fd <stream_drain>
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	79 b2                	jns    802e84 <fread+0x4b>
+  802ed2:	eb 0c                	jmp    802ee0 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802ed4:	c1 fb 1f             	sar    $0x1f,%ebx
+  802ed7:	83 e3 04             	and    $0x4,%ebx
+  802eda:	83 c3 04             	add    $0x4,%ebx
+  802edd:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802ee0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ee3:	85 c0                	test   %eax,%eax
+  802ee5:	74 0a                	je     802ef1 <fread+0xb8>
+  802ee7:	89 f8                	mov    %edi,%eax
+  802ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eee:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef4:	5b                   	pop    %ebx
+  802ef5:	5e                   	pop    %esi
+  802ef6:	5f                   	pop    %edi
+  802ef7:	5d                   	pop    %ebp
+  802ef8:	c3                   	ret
+		} else if (!stream_fill(f))
+  802ef9:	89 f0                	mov    %esi,%eax
+  802efb:	e8 da fb ff ff       	call   802ada <stream_fill>
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	74 dc                	je     802ee0 <fread+0xa7>
+			m = 0;
+  802f04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f09:	eb 93                	jmp    802e9e <fread+0x65>
+
+00802f0b <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802f0b:	55                   	push   %ebp
+  802f0c:	89 e5                	mov    %esp,%ebp
+  802f0e:	57                   	push   %edi
+  802f0f:	56                   	push   %esi
+  802f10:	53                   	push   %ebx
+  802f11:	83 ec 1c             	sub    $0x1c,%esp
+  802f14:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802f17:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f1a:	a8 02                	test   $0x2,%al
+  802f1c:	75 13                	jne    802f31 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802f1e:	83 c8 08             	or     $0x8,%eax
+  802f21:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802f24:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f2c:	5b                   	pop    %ebx
+  802f2d:	5e                   	pop    %esi
+  802f2e:	5f                   	pop    %edi
+  802f2f:	5d                   	pop    %ebp
+  802f30:	c3                   	ret
+	stream_setup(f);
+  802f31:	89 d8                	mov    %ebx,%eax
+  802f33:	e8 35 fb ff ff       	call   802a6d <stream_setup>
+	want = size * n;
+  802f38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f3b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802f3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802f42:	89 d8                	mov    %ebx,%eax
+  802f44:	e8 41 fa ff ff       	call   80298a <stream_unread>
+	for (done = 0; done < want; ) {
+  802f49:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802f4e:	84 c0                	test   %al,%al
+  802f50:	75 7b                	jne    802fcd <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802f52:	be 00 00 00 00       	mov    $0x0,%esi
+  802f57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802f5a:	39 fe                	cmp    %edi,%esi
+  802f5c:	73 24                	jae    802f82 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802f5e:	83 ec 04             	sub    $0x4,%esp
+  802f61:	89 f8                	mov    %edi,%eax
+  802f63:	29 f0                	sub    %esi,%eax
+  802f65:	50                   	push   %eax
+  802f66:	89 f0                	mov    %esi,%eax
+  802f68:	03 45 08             	add    0x8(%ebp),%eax
+  802f6b:	50                   	push   %eax
+  802f6c:	ff 33                	push   (%ebx)
+  802f6e:	e8 a0 ef ff ff       	call   801f13 <write>
+  802f73:	83 c4 10             	add    $0x10,%esp
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	7e 04                	jle    802f7e <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802f7a:	01 c6                	add    %eax,%esi
+  802f7c:	eb dc                	jmp    802f5a <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802f7e:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802f82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	74 a0                	je     802f29 <fwrite+0x1e>
+  802f89:	89 f0                	mov    %esi,%eax
+  802f8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f90:	f7 75 0c             	divl   0xc(%ebp)
+  802f93:	eb 94                	jmp    802f29 <fwrite+0x1e>
+			done += r;
+  802f95:	01 c7                	add    %eax,%edi
+			continue;
+  802f97:	eb 34                	jmp    802fcd <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802f99:	8b 73 10             	mov    0x10(%ebx),%esi
+  802f9c:	29 c6                	sub    %eax,%esi
+  802f9e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802fa1:	29 fa                	sub    %edi,%edx
+  802fa3:	39 d6                	cmp    %edx,%esi
+  802fa5:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802fa8:	83 ec 04             	sub    $0x4,%esp
+  802fab:	56                   	push   %esi
+  802fac:	89 fa                	mov    %edi,%edx
+  802fae:	03 55 08             	add    0x8(%ebp),%edx
+  802fb1:	52                   	push   %edx
+  802fb2:	03 43 0c             	add    0xc(%ebx),%eax
+  802fb5:	50                   	push   %eax
+  802fb6:	e8 f8 db ff ff       	call   800bb3 <memmove>
+		f->f_wend += m;
+  802fbb:	89 f0                	mov    %esi,%eax
+  802fbd:	03 43 1c             	add    0x1c(%ebx),%eax
+  802fc0:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802fc3:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802fc5:	83 c4 10             	add    $0x10,%esp
+  802fc8:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802fcb:	74 5b                	je     803028 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802fcd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fd0:	39 c7                	cmp    %eax,%edi
+  802fd2:	73 2d                	jae    803001 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802fd4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802fd7:	85 c0                	test   %eax,%eax
+  802fd9:	75 be                	jne    802f99 <fwrite+0x8e>
+  802fdb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802fde:	29 fa                	sub    %edi,%edx
+  802fe0:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802fe3:	72 b4                	jb     802f99 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802fe5:	83 ec 04             	sub    $0x4,%esp
+  802fe8:	52                   	push   %edx
+  802fe9:	89 f8                	mov    %edi,%eax
+  802feb:	03 45 08             	add    0x8(%ebp),%eax
+  802fee:	50                   	push   %eax
+  802fef:	ff 33                	push   (%ebx)
+  802ff1:	e8 1d ef ff ff       	call   801f13 <write>
+  802ff6:	83 c4 10             	add    $0x10,%esp
+  802ff9:	85 c0                	test   %eax,%eax
+  802ffb:	7f 98                	jg     802f95 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802ffd:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  803001:	8b 43 08             	mov    0x8(%ebx),%eax
+  803004:	83 f8 03             	cmp    $0x3,%eax
+  803007:	74 48                	je     803051 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803009:	83 f8 02             	cmp    $0x2,%eax
+  80300c:	74 27                	je     803035 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80300e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803011:	85 c0                	test   %eax,%eax
+  803013:	0f 84 10 ff ff ff    	je     802f29 <fwrite+0x1e>
+  803019:	89 f8                	mov    %edi,%eax
+  80301b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803020:	f7 75 0c             	divl   0xc(%ebp)
+  803023:	e9 01 ff ff ff       	jmp    802f29 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803028:	89 d8                	mov    %ebx,%eax
+  80302a:	e8 ce f9 ff ff       	call   8029fd <stream_drain>
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	79 9a                	jns    802fcd <fwrite+0xc2>
+  803033:	eb cc                	jmp    803001 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803035:	83 ec 04             	sub    $0x4,%esp
+  803038:	57                   	push   %edi
+  803039:	6a 0a                	push   $0xa
+  80303b:	ff 75 08             	push   0x8(%ebp)
+  80303e:	e8 21 dc ff ff       	call   800c64 <memfind>
+  803043:	89 c2                	mov    %eax,%edx
+  803045:	89 f8                	mov    %edi,%eax
+  803047:	03 45 08             	add    0x8(%ebp),%eax
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	39 c2                	cmp    %eax,%edx
+  80304f:	74 bd                	je     80300e <fwrite+0x103>
+		stream_drain(f);
+  803051:	89 d8                	mov    %ebx,%eax
+  803053:	e8 a5 f9 ff ff       	call   8029fd <stream_drain>
+  803058:	eb b4                	jmp    80300e <fwrite+0x103>
+
+0080305a <fputc>:
+{
+  80305a:	55                   	push   %ebp
+  80305b:	89 e5                	mov    %esp,%ebp
+  80305d:	53                   	push   %ebx
+  80305e:	83 ec 14             	sub    $0x14,%esp
+  803061:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  803064:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  803067:	ff 75 0c             	push   0xc(%ebp)
+  80306a:	6a 01                	push   $0x1
+  80306c:	6a 01                	push   $0x1
+  80306e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803071:	50                   	push   %eax
+  803072:	e8 94 fe ff ff       	call   802f0b <fwrite>
+  803077:	83 c4 10             	add    $0x10,%esp
+  80307a:	0f b6 db             	movzbl %bl,%ebx
+  80307d:	83 f8 01             	cmp    $0x1,%eax
+  803080:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803085:	0f 44 c3             	cmove  %ebx,%eax
+}
+  803088:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80308b:	c9                   	leave
+  80308c:	c3                   	ret
+
+0080308d <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80308d:	55                   	push   %ebp
+  80308e:	89 e5                	mov    %esp,%ebp
+  803090:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  803093:	ff 75 0c             	push   0xc(%ebp)
+  803096:	ff 75 08             	push   0x8(%ebp)
+  803099:	e8 bc ff ff ff       	call   80305a <fputc>
+}
+  80309e:	83 c4 10             	add    $0x10,%esp
+  8030a1:	c9                   	leave
+  8030a2:	c3                   	ret
+
+008030a3 <fputs>:
+{
+  8030a3:	55                   	push   %ebp
+  8030a4:	89 e5                	mov    %esp,%ebp
+  8030a6:	56                   	push   %esi
+  8030a7:	53                   	push   %ebx
+  8030a8:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8030ab:	83 ec 0c             	sub    $0xc,%esp
+  8030ae:	56                   	push   %esi
+  8030af:	e8 3e d9 ff ff       	call   8009f2 <strlen>
+  8030b4:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8030b6:	ff 75 0c             	push   0xc(%ebp)
+  8030b9:	50                   	push   %eax
+  8030ba:	6a 01                	push   $0x1
+  8030bc:	56                   	push   %esi
+  8030bd:	e8 49 fe ff ff       	call   802f0b <fwrite>
+  8030c2:	83 c4 20             	add    $0x20,%esp
+  8030c5:	39 d8                	cmp    %ebx,%eax
+  8030c7:	0f 95 c0             	setne  %al
+  8030ca:	0f b6 c0             	movzbl %al,%eax
+  8030cd:	f7 d8                	neg    %eax
+}
+  8030cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030d2:	5b                   	pop    %ebx
+  8030d3:	5e                   	pop    %esi
+  8030d4:	5d                   	pop    %ebp
+  8030d5:	c3                   	ret
+
+008030d6 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8030d6:	55                   	push   %ebp
+  8030d7:	89 e5                	mov    %esp,%ebp
+  8030d9:	53                   	push   %ebx
+  8030da:	83 ec 04             	sub    $0x4,%esp
+  8030dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8030e0:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8030e3:	50                   	push   %eax
+  8030e4:	ff 75 0c             	push   0xc(%ebp)
+  8030e7:	53                   	push   %ebx
+  8030e8:	68 8d 30 80 00       	push   $0x80308d
+  8030ed:	e8 4e d4 ff ff       	call   800540 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8030f2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030f5:	c1 e0 1c             	shl    $0x1c,%eax
+  8030f8:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8030fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030fe:	c9                   	leave
+  8030ff:	c3                   	ret
+
+00803100 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803100:	55                   	push   %ebp
+  803101:	89 e5                	mov    %esp,%ebp
+  803103:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803106:	68 fc 55 80 00       	push   $0x8055fc
+  80310b:	ff 75 0c             	push   0xc(%ebp)
+  80310e:	e8 1a d9 ff ff       	call   800a2d <strcpy>
+	return 0;
+}
+  803113:	b8 00 00 00 00       	mov    $0x0,%eax
+  803118:	c9                   	leave
+  803119:	c3                   	ret
+
+0080311a <devsock_close>:
+{
+  80311a:	55                   	push   %ebp
+  80311b:	89 e5                	mov    %esp,%ebp
+  80311d:	53                   	push   %ebx
+  80311e:	83 ec 10             	sub    $0x10,%esp
+  803121:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803124:	53                   	push   %ebx
+  803125:	e8 e4 1a 00 00       	call   804c0e <pageref>
+  80312a:	89 c2                	mov    %eax,%edx
+  80312c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80312f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803134:	83 fa 01             	cmp    $0x1,%edx
+  803137:	74 05                	je     80313e <devsock_close+0x24>
+}
+  803139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80313c:	c9                   	leave
+  80313d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80313e:	83 ec 0c             	sub    $0xc,%esp
+  803141:	ff 73 0c             	push   0xc(%ebx)
+  803144:	e8 b7 02 00 00       	call   803400 <nsipc_close>
+  803149:	83 c4 10             	add    $0x10,%esp
+  80314c:	eb eb                	jmp    803139 <devsock_close+0x1f>
+
+0080314e <devsock_write>:
+{
+  80314e:	55                   	push   %ebp
+  80314f:	89 e5                	mov    %esp,%ebp
+  803151:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803154:	6a 00                	push   $0x0
+  803156:	ff 75 10             	push   0x10(%ebp)
+  803159:	ff 75 0c             	push   0xc(%ebp)
+  80315c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80315f:	ff 70 0c             	push   0xc(%eax)
+  803162:	e8 79 03 00 00       	call   8034e0 <nsipc_send>
+}
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+
+00803169 <devsock_read>:
+{
+  803169:	55                   	push   %ebp
+  80316a:	89 e5                	mov    %esp,%ebp
+  80316c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80316f:	6a 00                	push   $0x0
+  803171:	ff 75 10             	push   0x10(%ebp)
+  803174:	ff 75 0c             	push   0xc(%ebp)
+  803177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317a:	ff 70 0c             	push   0xc(%eax)
+  80317d:	e8 ef 02 00 00       	call   803471 <nsipc_recv>
+}
+  803182:	c9                   	leave
+  803183:	c3                   	ret
+
+00803184 <fd2sockid>:
+{
+  803184:	55                   	push   %ebp
+  803185:	89 e5                	mov    %esp,%ebp
+  803187:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80318a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80318d:	52                   	push   %edx
+  80318e:	50                   	push   %eax
+  80318f:	e8 f7 e9 ff ff       	call   801b8b <fd_lookup>
+  803194:	83 c4 10             	add    $0x10,%esp
+  803197:	85 c0                	test   %eax,%eax
+  803199:	78 10                	js     8031ab <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80319b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319e:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  8031a4:	39 08                	cmp    %ecx,(%eax)
+  8031a6:	75 05                	jne    8031ad <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8031a8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8031ab:	c9                   	leave
+  8031ac:	c3                   	ret
+		return -E_NOT_SUPP;
+  8031ad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8031b2:	eb f7                	jmp    8031ab <fd2sockid+0x27>
+
+008031b4 <alloc_sockfd>:
+{
+  8031b4:	55                   	push   %ebp
+  8031b5:	89 e5                	mov    %esp,%ebp
+  8031b7:	56                   	push   %esi
+  8031b8:	53                   	push   %ebx
+  8031b9:	83 ec 1c             	sub    $0x1c,%esp
+  8031bc:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8031be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031c1:	50                   	push   %eax
+  8031c2:	e8 6e e9 ff ff       	call   801b35 <fd_alloc>
+  8031c7:	89 c3                	mov    %eax,%ebx
+  8031c9:	83 c4 10             	add    $0x10,%esp
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	78 43                	js     803213 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8031d0:	83 ec 04             	sub    $0x4,%esp
+  8031d3:	68 07 04 00 00       	push   $0x407
+  8031d8:	ff 75 f4             	push   -0xc(%ebp)
+  8031db:	6a 00                	push   $0x0
+  8031dd:	e8 89 dc ff ff       	call   800e6b <sys_page_alloc>
+  8031e2:	89 c3                	mov    %eax,%ebx
+  8031e4:	83 c4 10             	add    $0x10,%esp
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 28                	js     803213 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8031eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031ee:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8031f4:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8031f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803200:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803203:	83 ec 0c             	sub    $0xc,%esp
+  803206:	50                   	push   %eax
+  803207:	e8 02 e9 ff ff       	call   801b0e <fd2num>
+  80320c:	89 c3                	mov    %eax,%ebx
+  80320e:	83 c4 10             	add    $0x10,%esp
+  803211:	eb 0c                	jmp    80321f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803213:	83 ec 0c             	sub    $0xc,%esp
+  803216:	56                   	push   %esi
+  803217:	e8 e4 01 00 00       	call   803400 <nsipc_close>
+		return r;
+  80321c:	83 c4 10             	add    $0x10,%esp
+}
+  80321f:	89 d8                	mov    %ebx,%eax
+  803221:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803224:	5b                   	pop    %ebx
+  803225:	5e                   	pop    %esi
+  803226:	5d                   	pop    %ebp
+  803227:	c3                   	ret
+
+00803228 <accept>:
+{
+  803228:	55                   	push   %ebp
+  803229:	89 e5                	mov    %esp,%ebp
+  80322b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80322e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803231:	e8 4e ff ff ff       	call   803184 <fd2sockid>
+  803236:	85 c0                	test   %eax,%eax
+  803238:	78 1b                	js     803255 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80323a:	83 ec 04             	sub    $0x4,%esp
+  80323d:	ff 75 10             	push   0x10(%ebp)
+  803240:	ff 75 0c             	push   0xc(%ebp)
+  803243:	50                   	push   %eax
+  803244:	e8 0e 01 00 00       	call   803357 <nsipc_accept>
+  803249:	83 c4 10             	add    $0x10,%esp
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	78 05                	js     803255 <accept+0x2d>
+	return alloc_sockfd(r);
+  803250:	e8 5f ff ff ff       	call   8031b4 <alloc_sockfd>
+}
+  803255:	c9                   	leave
+  803256:	c3                   	ret
+
+00803257 <bind>:
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80325d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803260:	e8 1f ff ff ff       	call   803184 <fd2sockid>
+  803265:	85 c0                	test   %eax,%eax
+  803267:	78 12                	js     80327b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803269:	83 ec 04             	sub    $0x4,%esp
+  80326c:	ff 75 10             	push   0x10(%ebp)
+  80326f:	ff 75 0c             	push   0xc(%ebp)
+  803272:	50                   	push   %eax
+  803273:	e8 31 01 00 00       	call   8033a9 <nsipc_bind>
+  803278:	83 c4 10             	add    $0x10,%esp
+}
+  80327b:	c9                   	leave
+  80327c:	c3                   	ret
+
+0080327d <shutdown>:
+{
+  80327d:	55                   	push   %ebp
+  80327e:	89 e5                	mov    %esp,%ebp
+  803280:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803283:	8b 45 08             	mov    0x8(%ebp),%eax
+  803286:	e8 f9 fe ff ff       	call   803184 <fd2sockid>
+  80328b:	85 c0                	test   %eax,%eax
+  80328d:	78 0f                	js     80329e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80328f:	83 ec 08             	sub    $0x8,%esp
+  803292:	ff 75 0c             	push   0xc(%ebp)
+  803295:	50                   	push   %eax
+  803296:	e8 43 01 00 00       	call   8033de <nsipc_shutdown>
+  80329b:	83 c4 10             	add    $0x10,%esp
+}
+  80329e:	c9                   	leave
+  80329f:	c3                   	ret
+
+008032a0 <connect>:
+{
+  8032a0:	55                   	push   %ebp
+  8032a1:	89 e5                	mov    %esp,%ebp
+  8032a3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a9:	e8 d6 fe ff ff       	call   803184 <fd2sockid>
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	78 12                	js     8032c4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8032b2:	83 ec 04             	sub    $0x4,%esp
+  8032b5:	ff 75 10             	push   0x10(%ebp)
+  8032b8:	ff 75 0c             	push   0xc(%ebp)
+  8032bb:	50                   	push   %eax
+  8032bc:	e8 59 01 00 00       	call   80341a <nsipc_connect>
+  8032c1:	83 c4 10             	add    $0x10,%esp
+}
+  8032c4:	c9                   	leave
+  8032c5:	c3                   	ret
+
+008032c6 <listen>:
+{
+  8032c6:	55                   	push   %ebp
+  8032c7:	89 e5                	mov    %esp,%ebp
+  8032c9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032cf:	e8 b0 fe ff ff       	call   803184 <fd2sockid>
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	78 0f                	js     8032e7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8032d8:	83 ec 08             	sub    $0x8,%esp
+  8032db:	ff 75 0c             	push   0xc(%ebp)
+  8032de:	50                   	push   %eax
+  8032df:	e8 6b 01 00 00       	call   80344f <nsipc_listen>
+  8032e4:	83 c4 10             	add    $0x10,%esp
+}
+  8032e7:	c9                   	leave
+  8032e8:	c3                   	ret
+
+008032e9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8032e9:	55                   	push   %ebp
+  8032ea:	89 e5                	mov    %esp,%ebp
+  8032ec:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8032ef:	ff 75 10             	push   0x10(%ebp)
+  8032f2:	ff 75 0c             	push   0xc(%ebp)
+  8032f5:	ff 75 08             	push   0x8(%ebp)
+  8032f8:	e8 41 02 00 00       	call   80353e <nsipc_socket>
+  8032fd:	83 c4 10             	add    $0x10,%esp
+  803300:	85 c0                	test   %eax,%eax
+  803302:	78 05                	js     803309 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803304:	e8 ab fe ff ff       	call   8031b4 <alloc_sockfd>
+}
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+
+0080330b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80330b:	55                   	push   %ebp
+  80330c:	89 e5                	mov    %esp,%ebp
+  80330e:	53                   	push   %ebx
+  80330f:	83 ec 04             	sub    $0x4,%esp
+  803312:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803314:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  80331b:	74 26                	je     803343 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80331d:	6a 07                	push   $0x7
+  80331f:	68 00 90 80 00       	push   $0x809000
+  803324:	53                   	push   %ebx
+  803325:	ff 35 08 70 80 00    	push   0x807008
+  80332b:	e8 49 e7 ff ff       	call   801a79 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803330:	83 c4 0c             	add    $0xc,%esp
+  803333:	6a 00                	push   $0x0
+  803335:	6a 00                	push   $0x0
+  803337:	6a 00                	push   $0x0
+  803339:	e8 45 e6 ff ff       	call   801983 <ipc_recv>
+}
+  80333e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803341:	c9                   	leave
+  803342:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803343:	83 ec 0c             	sub    $0xc,%esp
+  803346:	6a 02                	push   $0x2
+  803348:	e8 82 e7 ff ff       	call   801acf <ipc_find_env>
+  80334d:	a3 08 70 80 00       	mov    %eax,0x807008
+  803352:	83 c4 10             	add    $0x10,%esp
+  803355:	eb c6                	jmp    80331d <nsipc+0x12>
+
+00803357 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803357:	55                   	push   %ebp
+  803358:	89 e5                	mov    %esp,%ebp
+  80335a:	56                   	push   %esi
+  80335b:	53                   	push   %ebx
+  80335c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80335f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803362:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803367:	8b 06                	mov    (%esi),%eax
+  803369:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80336e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803373:	e8 93 ff ff ff       	call   80330b <nsipc>
+  803378:	89 c3                	mov    %eax,%ebx
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	79 09                	jns    803387 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80337e:	89 d8                	mov    %ebx,%eax
+  803380:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803383:	5b                   	pop    %ebx
+  803384:	5e                   	pop    %esi
+  803385:	5d                   	pop    %ebp
+  803386:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803387:	83 ec 04             	sub    $0x4,%esp
+  80338a:	ff 35 10 90 80 00    	push   0x809010
+  803390:	68 00 90 80 00       	push   $0x809000
+  803395:	ff 75 0c             	push   0xc(%ebp)
+  803398:	e8 16 d8 ff ff       	call   800bb3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80339d:	a1 10 90 80 00       	mov    0x809010,%eax
+  8033a2:	89 06                	mov    %eax,(%esi)
+  8033a4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8033a7:	eb d5                	jmp    80337e <nsipc_accept+0x27>
+
+008033a9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8033a9:	55                   	push   %ebp
+  8033aa:	89 e5                	mov    %esp,%ebp
+  8033ac:	53                   	push   %ebx
+  8033ad:	83 ec 08             	sub    $0x8,%esp
+  8033b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8033b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b6:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8033bb:	53                   	push   %ebx
+  8033bc:	ff 75 0c             	push   0xc(%ebp)
+  8033bf:	68 04 90 80 00       	push   $0x809004
+  8033c4:	e8 ea d7 ff ff       	call   800bb3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8033c9:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8033cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8033d4:	e8 32 ff ff ff       	call   80330b <nsipc>
+}
+  8033d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033dc:	c9                   	leave
+  8033dd:	c3                   	ret
+
+008033de <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8033de:	55                   	push   %ebp
+  8033df:	89 e5                	mov    %esp,%ebp
+  8033e1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8033e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8033ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033ef:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8033f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8033f9:	e8 0d ff ff ff       	call   80330b <nsipc>
+}
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+
+00803400 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803400:	55                   	push   %ebp
+  803401:	89 e5                	mov    %esp,%ebp
+  803403:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803406:	8b 45 08             	mov    0x8(%ebp),%eax
+  803409:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80340e:	b8 04 00 00 00       	mov    $0x4,%eax
+  803413:	e8 f3 fe ff ff       	call   80330b <nsipc>
+}
+  803418:	c9                   	leave
+  803419:	c3                   	ret
+
+0080341a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	53                   	push   %ebx
+  80341e:	83 ec 08             	sub    $0x8,%esp
+  803421:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803424:	8b 45 08             	mov    0x8(%ebp),%eax
+  803427:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80342c:	53                   	push   %ebx
+  80342d:	ff 75 0c             	push   0xc(%ebp)
+  803430:	68 04 90 80 00       	push   $0x809004
+  803435:	e8 79 d7 ff ff       	call   800bb3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80343a:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803440:	b8 05 00 00 00       	mov    $0x5,%eax
+  803445:	e8 c1 fe ff ff       	call   80330b <nsipc>
+}
+  80344a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80344d:	c9                   	leave
+  80344e:	c3                   	ret
+
+0080344f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80344f:	55                   	push   %ebp
+  803450:	89 e5                	mov    %esp,%ebp
+  803452:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803455:	8b 45 08             	mov    0x8(%ebp),%eax
+  803458:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80345d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803460:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803465:	b8 06 00 00 00       	mov    $0x6,%eax
+  80346a:	e8 9c fe ff ff       	call   80330b <nsipc>
+}
+  80346f:	c9                   	leave
+  803470:	c3                   	ret
+
+00803471 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803471:	55                   	push   %ebp
+  803472:	89 e5                	mov    %esp,%ebp
+  803474:	56                   	push   %esi
+  803475:	53                   	push   %ebx
+  803476:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803479:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803481:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80348a:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80348f:	b8 07 00 00 00       	mov    $0x7,%eax
+  803494:	e8 72 fe ff ff       	call   80330b <nsipc>
+  803499:	89 c3                	mov    %eax,%ebx
+  80349b:	85 c0                	test   %eax,%eax
+  80349d:	78 22                	js     8034c1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80349f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8034a4:	39 c6                	cmp    %eax,%esi
+  8034a6:	0f 4e c6             	cmovle %esi,%eax
+  8034a9:	39 c3                	cmp    %eax,%ebx
+  8034ab:	7f 1d                	jg     8034ca <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8034ad:	83 ec 04             	sub    $0x4,%esp
+  8034b0:	53                   	push   %ebx
+  8034b1:	68 00 90 80 00       	push   $0x809000
+  8034b6:	ff 75 0c             	push   0xc(%ebp)
+  8034b9:	e8 f5 d6 ff ff       	call   800bb3 <memmove>
+  8034be:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8034c1:	89 d8                	mov    %ebx,%eax
+  8034c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c6:	5b                   	pop    %ebx
+  8034c7:	5e                   	pop    %esi
+  8034c8:	5d                   	pop    %ebp
+  8034c9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8034ca:	68 08 56 80 00       	push   $0x805608
+  8034cf:	68 b1 54 80 00       	push   $0x8054b1
+  8034d4:	6a 62                	push   $0x62
+  8034d6:	68 1d 56 80 00       	push   $0x80561d
+  8034db:	e8 8e ce ff ff       	call   80036e <_panic>
+
+008034e0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	53                   	push   %ebx
+  8034e4:	83 ec 04             	sub    $0x4,%esp
+  8034e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8034ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ed:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8034f2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8034f8:	7f 2e                	jg     803528 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8034fa:	83 ec 04             	sub    $0x4,%esp
+  8034fd:	53                   	push   %ebx
+  8034fe:	ff 75 0c             	push   0xc(%ebp)
+  803501:	68 0c 90 80 00       	push   $0x80900c
+  803506:	e8 a8 d6 ff ff       	call   800bb3 <memmove>
+	nsipcbuf.send.req_size = size;
+  80350b:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803511:	8b 45 14             	mov    0x14(%ebp),%eax
+  803514:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803519:	b8 08 00 00 00       	mov    $0x8,%eax
+  80351e:	e8 e8 fd ff ff       	call   80330b <nsipc>
+}
+  803523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803526:	c9                   	leave
+  803527:	c3                   	ret
+	assert(size < 1600);
+  803528:	68 29 56 80 00       	push   $0x805629
+  80352d:	68 b1 54 80 00       	push   $0x8054b1
+  803532:	6a 6d                	push   $0x6d
+  803534:	68 1d 56 80 00       	push   $0x80561d
+  803539:	e8 30 ce ff ff       	call   80036e <_panic>
+
+0080353e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80353e:	55                   	push   %ebp
+  80353f:	89 e5                	mov    %esp,%ebp
+  803541:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803544:	8b 45 08             	mov    0x8(%ebp),%eax
+  803547:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80354c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80354f:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803554:	8b 45 10             	mov    0x10(%ebp),%eax
+  803557:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  80355c:	b8 09 00 00 00       	mov    $0x9,%eax
+  803561:	e8 a5 fd ff ff       	call   80330b <nsipc>
+}
+  803566:	c9                   	leave
+  803567:	c3                   	ret
+
+00803568 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803568:	55                   	push   %ebp
+  803569:	89 e5                	mov    %esp,%ebp
+  80356b:	53                   	push   %ebx
+  80356c:	83 ec 10             	sub    $0x10,%esp
+  80356f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803572:	68 0c 70 80 00       	push   $0x80700c
+  803577:	e8 a1 07 00 00       	call   803d1d <mutex_lock>
+	if (v == 0)
+  80357c:	83 c4 10             	add    $0x10,%esp
+  80357f:	85 db                	test   %ebx,%ebx
+  803581:	0f 84 85 00 00 00    	je     80360c <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803587:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80358d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803592:	77 51                	ja     8035e5 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803594:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80359a:	89 d8                	mov    %ebx,%eax
+  80359c:	c1 e8 0c             	shr    $0xc,%eax
+  80359f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035a6:	f6 c4 02             	test   $0x2,%ah
+  8035a9:	74 50                	je     8035fb <free+0x93>
+		sys_page_unmap(0, c);
+  8035ab:	83 ec 08             	sub    $0x8,%esp
+  8035ae:	53                   	push   %ebx
+  8035af:	6a 00                	push   $0x0
+  8035b1:	e8 4e d9 ff ff       	call   800f04 <sys_page_unmap>
+		c += PGSIZE;
+  8035b6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8035bc:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8035c2:	83 c4 10             	add    $0x10,%esp
+  8035c5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8035ca:	76 ce                	jbe    80359a <free+0x32>
+  8035cc:	68 73 56 80 00       	push   $0x805673
+  8035d1:	68 b1 54 80 00       	push   $0x8054b1
+  8035d6:	68 82 00 00 00       	push   $0x82
+  8035db:	68 66 56 80 00       	push   $0x805666
+  8035e0:	e8 89 cd ff ff       	call   80036e <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8035e5:	68 38 56 80 00       	push   $0x805638
+  8035ea:	68 b1 54 80 00       	push   $0x8054b1
+  8035ef:	6a 7b                	push   $0x7b
+  8035f1:	68 66 56 80 00       	push   $0x805666
+  8035f6:	e8 73 cd ff ff       	call   80036e <_panic>
+	if (--(*ref) == 0)
+  8035fb:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803601:	83 e8 01             	sub    $0x1,%eax
+  803604:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80360a:	74 15                	je     803621 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  80360c:	83 ec 0c             	sub    $0xc,%esp
+  80360f:	68 0c 70 80 00       	push   $0x80700c
+  803614:	e8 71 07 00 00       	call   803d8a <mutex_unlock>
+}
+  803619:	83 c4 10             	add    $0x10,%esp
+  80361c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80361f:	c9                   	leave
+  803620:	c3                   	ret
+		sys_page_unmap(0, c);
+  803621:	83 ec 08             	sub    $0x8,%esp
+  803624:	53                   	push   %ebx
+  803625:	6a 00                	push   $0x0
+  803627:	e8 d8 d8 ff ff       	call   800f04 <sys_page_unmap>
+  80362c:	83 c4 10             	add    $0x10,%esp
+  80362f:	eb db                	jmp    80360c <free+0xa4>
+
+00803631 <malloc>:
+{
+  803631:	55                   	push   %ebp
+  803632:	89 e5                	mov    %esp,%ebp
+  803634:	57                   	push   %edi
+  803635:	56                   	push   %esi
+  803636:	53                   	push   %ebx
+  803637:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80363a:	68 0c 70 80 00       	push   $0x80700c
+  80363f:	e8 d9 06 00 00       	call   803d1d <mutex_lock>
+	if (mptr == 0)
+  803644:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  80364a:	83 c4 10             	add    $0x10,%esp
+  80364d:	85 ff                	test   %edi,%edi
+  80364f:	74 6c                	je     8036bd <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803651:	8b 45 08             	mov    0x8(%ebp),%eax
+  803654:	83 c0 03             	add    $0x3,%eax
+  803657:	83 e0 fc             	and    $0xfffffffc,%eax
+  80365a:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80365c:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803661:	0f 87 64 01 00 00    	ja     8037cb <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803667:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80366d:	74 30                	je     80369f <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80366f:	89 f9                	mov    %edi,%ecx
+  803671:	c1 e9 0c             	shr    $0xc,%ecx
+  803674:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803678:	c1 e8 0c             	shr    $0xc,%eax
+  80367b:	39 c1                	cmp    %eax,%ecx
+  80367d:	74 5f                	je     8036de <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  80367f:	83 ec 0c             	sub    $0xc,%esp
+  803682:	57                   	push   %edi
+  803683:	e8 e0 fe ff ff       	call   803568 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803688:	a1 10 70 80 00       	mov    0x807010,%eax
+  80368d:	05 00 10 00 00       	add    $0x1000,%eax
+  803692:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803697:	a3 10 70 80 00       	mov    %eax,0x807010
+  80369c:	83 c4 10             	add    $0x10,%esp
+  80369f:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  8036a5:	ba 02 00 00 00       	mov    $0x2,%edx
+  8036aa:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8036ae:	8d 7e 04             	lea    0x4(%esi),%edi
+  8036b1:	89 cb                	mov    %ecx,%ebx
+  8036b3:	01 f9                	add    %edi,%ecx
+  8036b5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8036b8:	e9 8b 00 00 00       	jmp    803748 <malloc+0x117>
+		mptr = mbegin;
+  8036bd:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8036c4:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8036c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ca:	83 c0 03             	add    $0x3,%eax
+  8036cd:	83 e0 fc             	and    $0xfffffffc,%eax
+  8036d0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8036d2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8036d7:	76 c6                	jbe    80369f <malloc+0x6e>
+  8036d9:	e9 d6 00 00 00       	jmp    8037b4 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8036de:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8036e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8036e9:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8036ed:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8036f0:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  8036f5:	e9 ba 00 00 00       	jmp    8037b4 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8036fa:	05 00 10 00 00       	add    $0x1000,%eax
+  8036ff:	39 c8                	cmp    %ecx,%eax
+  803701:	0f 83 cb 00 00 00    	jae    8037d2 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803707:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80370c:	77 22                	ja     803730 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80370e:	89 c2                	mov    %eax,%edx
+  803710:	c1 ea 16             	shr    $0x16,%edx
+  803713:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80371a:	f6 c2 01             	test   $0x1,%dl
+  80371d:	74 db                	je     8036fa <malloc+0xc9>
+  80371f:	89 c2                	mov    %eax,%edx
+  803721:	c1 ea 0c             	shr    $0xc,%edx
+  803724:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80372b:	f6 c2 01             	test   $0x1,%dl
+  80372e:	74 ca                	je     8036fa <malloc+0xc9>
+		if (mptr == mend) {
+  803730:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803736:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80373c:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803740:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803746:	74 04                	je     80374c <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803748:	89 d8                	mov    %ebx,%eax
+  80374a:	eb b3                	jmp    8036ff <malloc+0xce>
+  80374c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80374f:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803754:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803758:	83 ea 01             	sub    $0x1,%edx
+  80375b:	0f 85 50 ff ff ff    	jne    8036b1 <malloc+0x80>
+  803761:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803768:	00 00 08 
+				return 0;	/* out of address space */
+  80376b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803770:	eb 42                	jmp    8037b4 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803772:	85 db                	test   %ebx,%ebx
+  803774:	78 1e                	js     803794 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803776:	83 ec 08             	sub    $0x8,%esp
+  803779:	89 d8                	mov    %ebx,%eax
+  80377b:	03 05 10 70 80 00    	add    0x807010,%eax
+  803781:	50                   	push   %eax
+  803782:	6a 00                	push   $0x0
+  803784:	e8 7b d7 ff ff       	call   800f04 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803789:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80378f:	83 c4 10             	add    $0x10,%esp
+  803792:	eb de                	jmp    803772 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803794:	bf 00 00 00 00       	mov    $0x0,%edi
+  803799:	eb 19                	jmp    8037b4 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80379b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80379e:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8037a4:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8037ab:	00 
+	mptr += n;
+  8037ac:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8037af:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8037b4:	83 ec 0c             	sub    $0xc,%esp
+  8037b7:	68 0c 70 80 00       	push   $0x80700c
+  8037bc:	e8 c9 05 00 00       	call   803d8a <mutex_unlock>
+}
+  8037c1:	89 f8                	mov    %edi,%eax
+  8037c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c6:	5b                   	pop    %ebx
+  8037c7:	5e                   	pop    %esi
+  8037c8:	5f                   	pop    %edi
+  8037c9:	5d                   	pop    %ebp
+  8037ca:	c3                   	ret
+		return 0;
+  8037cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d0:	eb e2                	jmp    8037b4 <malloc+0x183>
+  8037d2:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8037d6:	74 06                	je     8037de <malloc+0x1ad>
+  8037d8:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8037de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037e3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8037e6:	39 fb                	cmp    %edi,%ebx
+  8037e8:	73 b1                	jae    80379b <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8037ea:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8037f0:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8037f3:	39 fe                	cmp    %edi,%esi
+  8037f5:	0f 92 c0             	setb   %al
+  8037f8:	0f b6 c0             	movzbl %al,%eax
+  8037fb:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8037fe:	83 c8 07             	or     $0x7,%eax
+  803801:	50                   	push   %eax
+  803802:	89 d8                	mov    %ebx,%eax
+  803804:	03 05 10 70 80 00    	add    0x807010,%eax
+  80380a:	50                   	push   %eax
+  80380b:	6a 00                	push   $0x0
+  80380d:	e8 59 d6 ff ff       	call   800e6b <sys_page_alloc>
+  803812:	83 c4 10             	add    $0x10,%esp
+  803815:	85 c0                	test   %eax,%eax
+  803817:	0f 88 55 ff ff ff    	js     803772 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80381d:	89 f3                	mov    %esi,%ebx
+  80381f:	eb c5                	jmp    8037e6 <malloc+0x1b5>
+
+00803821 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803821:	55                   	push   %ebp
+  803822:	89 e5                	mov    %esp,%ebp
+  803824:	56                   	push   %esi
+  803825:	53                   	push   %ebx
+  803826:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803829:	83 ec 0c             	sub    $0xc,%esp
+  80382c:	ff 75 08             	push   0x8(%ebp)
+  80382f:	e8 ea e2 ff ff       	call   801b1e <fd2data>
+  803834:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803836:	83 c4 08             	add    $0x8,%esp
+  803839:	68 8b 56 80 00       	push   $0x80568b
+  80383e:	53                   	push   %ebx
+  80383f:	e8 e9 d1 ff ff       	call   800a2d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803844:	8b 46 04             	mov    0x4(%esi),%eax
+  803847:	2b 06                	sub    (%esi),%eax
+  803849:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80384f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803856:	00 00 00 
+	stat->st_dev = &devpipe;
+  803859:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803860:	62 80 00 
+	return 0;
+}
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80386b:	5b                   	pop    %ebx
+  80386c:	5e                   	pop    %esi
+  80386d:	5d                   	pop    %ebp
+  80386e:	c3                   	ret
+
+0080386f <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80386f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803874:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803878:	85 c9                	test   %ecx,%ecx
+  80387a:	75 01                	jne    80387d <pipewake+0xe>
+  80387c:	c3                   	ret
+{
+  80387d:	55                   	push   %ebp
+  80387e:	89 e5                	mov    %esp,%ebp
+  803880:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803883:	68 00 04 00 00       	push   $0x400
+  803888:	52                   	push   %edx
+  803889:	e8 21 d9 ff ff       	call   8011af <sys_futex_wake>
+  80388e:	83 c4 10             	add    $0x10,%esp
+}
+  803891:	c9                   	leave
+  803892:	c3                   	ret
+
+00803893 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	56                   	push   %esi
+  803897:	53                   	push   %ebx
+  803898:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80389b:	83 ec 0c             	sub    $0xc,%esp
+  80389e:	56                   	push   %esi
+  80389f:	e8 7a e2 ff ff       	call   801b1e <fd2data>
+  8038a4:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8038a6:	83 c4 08             	add    $0x8,%esp
+  8038a9:	56                   	push   %esi
+  8038aa:	6a 00                	push   $0x0
+  8038ac:	e8 53 d6 ff ff       	call   800f04 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8038b1:	8d 53 04             	lea    0x4(%ebx),%edx
+  8038b4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8038b7:	e8 b3 ff ff ff       	call   80386f <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8038bc:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8038bf:	89 da                	mov    %ebx,%edx
+  8038c1:	e8 a9 ff ff ff       	call   80386f <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8038c6:	89 34 24             	mov    %esi,(%esp)
+  8038c9:	e8 50 e2 ff ff       	call   801b1e <fd2data>
+  8038ce:	83 c4 08             	add    $0x8,%esp
+  8038d1:	50                   	push   %eax
+  8038d2:	6a 00                	push   $0x0
+  8038d4:	e8 2b d6 ff ff       	call   800f04 <sys_page_unmap>
+}
+  8038d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038dc:	5b                   	pop    %ebx
+  8038dd:	5e                   	pop    %esi
+  8038de:	5d                   	pop    %ebp
+  8038df:	c3                   	ret
+
+008038e0 <_pipeisclosed>:
+{
+  8038e0:	55                   	push   %ebp
+  8038e1:	89 e5                	mov    %esp,%ebp
+  8038e3:	57                   	push   %edi
+  8038e4:	56                   	push   %esi
+  8038e5:	53                   	push   %ebx
+  8038e6:	83 ec 1c             	sub    $0x1c,%esp
+  8038e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038ec:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038ee:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8038f3:	eb 5d                	jmp    803952 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8038f5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8038fb:	8b 02                	mov    (%edx),%eax
+  8038fd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803900:	83 ec 0c             	sub    $0xc,%esp
+  803903:	ff 75 e0             	push   -0x20(%ebp)
+  803906:	e8 03 13 00 00       	call   804c0e <pageref>
+  80390b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80390e:	89 3c 24             	mov    %edi,(%esp)
+  803911:	e8 f8 12 00 00       	call   804c0e <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803916:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803918:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80391e:	83 c4 10             	add    $0x10,%esp
+  803921:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803927:	77 15                	ja     80393e <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803929:	89 f2                	mov    %esi,%edx
+  80392b:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80392d:	c1 ea 10             	shr    $0x10,%edx
+  803930:	74 0c                	je     80393e <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803932:	c1 e2 10             	shl    $0x10,%edx
+  803935:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80393a:	29 d1                	sub    %edx,%ecx
+  80393c:	eb 06                	jmp    803944 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80393e:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803944:	8b 11                	mov    (%ecx),%edx
+  803946:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803949:	39 d3                	cmp    %edx,%ebx
+  80394b:	74 6e                	je     8039bb <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80394d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803950:	74 24                	je     803976 <_pipeisclosed+0x96>
+  803952:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803954:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80395a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80395f:	77 94                	ja     8038f5 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803961:	89 f0                	mov    %esi,%eax
+  803963:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803965:	c1 e8 10             	shr    $0x10,%eax
+  803968:	74 8b                	je     8038f5 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80396a:	c1 e0 10             	shl    $0x10,%eax
+  80396d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803972:	29 c2                	sub    %eax,%edx
+  803974:	eb 85                	jmp    8038fb <_pipeisclosed+0x1b>
+  803976:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803978:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80397e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803983:	77 18                	ja     80399d <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803985:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80398a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80398c:	c1 e8 10             	shr    $0x10,%eax
+  80398f:	74 0c                	je     80399d <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803991:	c1 e0 10             	shl    $0x10,%eax
+  803994:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803999:	29 c2                	sub    %eax,%edx
+  80399b:	eb 06                	jmp    8039a3 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80399d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8039a3:	8b 02                	mov    (%edx),%eax
+  8039a5:	8b 40 58             	mov    0x58(%eax),%eax
+  8039a8:	6a 01                	push   $0x1
+  8039aa:	50                   	push   %eax
+  8039ab:	53                   	push   %ebx
+  8039ac:	68 92 56 80 00       	push   $0x805692
+  8039b1:	e8 93 ca ff ff       	call   800449 <cprintf>
+  8039b6:	83 c4 10             	add    $0x10,%esp
+  8039b9:	eb 97                	jmp    803952 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8039bb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039be:	0f 94 c0             	sete   %al
+  8039c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8039c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c7:	5b                   	pop    %ebx
+  8039c8:	5e                   	pop    %esi
+  8039c9:	5f                   	pop    %edi
+  8039ca:	5d                   	pop    %ebp
+  8039cb:	c3                   	ret
+
+008039cc <devpipe_write>:
+{
+  8039cc:	55                   	push   %ebp
+  8039cd:	89 e5                	mov    %esp,%ebp
+  8039cf:	57                   	push   %edi
+  8039d0:	56                   	push   %esi
+  8039d1:	53                   	push   %ebx
+  8039d2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8039d5:	ff 75 08             	push   0x8(%ebp)
+  8039d8:	e8 41 e1 ff ff       	call   801b1e <fd2data>
+  8039dd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039df:	83 c4 10             	add    $0x10,%esp
+  8039e2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8039e9:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8039ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039ef:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8039f2:	0f 84 96 00 00 00    	je     803a8e <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8039f8:	8d 73 08             	lea    0x8(%ebx),%esi
+  8039fb:	eb 32                	jmp    803a2f <devpipe_write+0x63>
+  8039fd:	89 fa                	mov    %edi,%edx
+  8039ff:	89 f0                	mov    %esi,%eax
+  803a01:	e8 69 fe ff ff       	call   80386f <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803a06:	8b 43 04             	mov    0x4(%ebx),%eax
+  803a09:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803a0c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a11:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803a16:	83 ec 04             	sub    $0x4,%esp
+  803a19:	6a 0a                	push   $0xa
+  803a1b:	50                   	push   %eax
+  803a1c:	53                   	push   %ebx
+  803a1d:	e8 5e d7 ff ff       	call   801180 <sys_futex_wait>
+  803a22:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803a27:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803a2c:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803a2f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803a32:	8b 0b                	mov    (%ebx),%ecx
+  803a34:	8d 51 20             	lea    0x20(%ecx),%edx
+  803a37:	39 d0                	cmp    %edx,%eax
+  803a39:	72 1b                	jb     803a56 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803a3b:	89 da                	mov    %ebx,%edx
+  803a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a40:	e8 9b fe ff ff       	call   8038e0 <_pipeisclosed>
+  803a45:	85 c0                	test   %eax,%eax
+  803a47:	74 b4                	je     8039fd <devpipe_write+0x31>
+				return 0;
+  803a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a51:	5b                   	pop    %ebx
+  803a52:	5e                   	pop    %esi
+  803a53:	5f                   	pop    %edi
+  803a54:	5d                   	pop    %ebp
+  803a55:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a59:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803a5c:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803a60:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803a63:	89 c2                	mov    %eax,%edx
+  803a65:	c1 fa 1f             	sar    $0x1f,%edx
+  803a68:	89 d1                	mov    %edx,%ecx
+  803a6a:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a6d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803a70:	83 e2 1f             	and    $0x1f,%edx
+  803a73:	29 ca                	sub    %ecx,%edx
+  803a75:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803a79:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803a7d:	83 c0 01             	add    $0x1,%eax
+  803a80:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803a83:	83 c6 01             	add    $0x1,%esi
+  803a86:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803a89:	e9 5e ff ff ff       	jmp    8039ec <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803a8e:	8d 53 04             	lea    0x4(%ebx),%edx
+  803a91:	8d 43 08             	lea    0x8(%ebx),%eax
+  803a94:	e8 d6 fd ff ff       	call   80386f <pipewake>
+	return i;
+  803a99:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a9c:	eb b0                	jmp    803a4e <devpipe_write+0x82>
+
+00803a9e <devpipe_read>:
+{
+  803a9e:	55                   	push   %ebp
+  803a9f:	89 e5                	mov    %esp,%ebp
+  803aa1:	57                   	push   %edi
+  803aa2:	56                   	push   %esi
+  803aa3:	53                   	push   %ebx
+  803aa4:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803aa7:	ff 75 08             	push   0x8(%ebp)
+  803aaa:	e8 6f e0 ff ff       	call   801b1e <fd2data>
+  803aaf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803ab1:	83 c4 10             	add    $0x10,%esp
+  803ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803abc:	74 6c                	je     803b2a <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803abe:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803ac1:	eb 25                	jmp    803ae8 <devpipe_read+0x4a>
+  803ac3:	8b 13                	mov    (%ebx),%edx
+  803ac5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803aca:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803acf:	83 ec 04             	sub    $0x4,%esp
+  803ad2:	6a 0a                	push   $0xa
+  803ad4:	52                   	push   %edx
+  803ad5:	57                   	push   %edi
+  803ad6:	e8 a5 d6 ff ff       	call   801180 <sys_futex_wait>
+  803adb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803ae0:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803ae5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803ae8:	8b 03                	mov    (%ebx),%eax
+  803aea:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803aed:	75 19                	jne    803b08 <devpipe_read+0x6a>
+			if (i > 0)
+  803aef:	85 f6                	test   %esi,%esi
+  803af1:	75 3a                	jne    803b2d <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803af3:	89 da                	mov    %ebx,%edx
+  803af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803af8:	e8 e3 fd ff ff       	call   8038e0 <_pipeisclosed>
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	74 c2                	je     803ac3 <devpipe_read+0x25>
+				return 0;
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b06:	eb 31                	jmp    803b39 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b08:	89 c1                	mov    %eax,%ecx
+  803b0a:	c1 f9 1f             	sar    $0x1f,%ecx
+  803b0d:	c1 e9 1b             	shr    $0x1b,%ecx
+  803b10:	01 c8                	add    %ecx,%eax
+  803b12:	83 e0 1f             	and    $0x1f,%eax
+  803b15:	29 c8                	sub    %ecx,%eax
+  803b17:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803b1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803b1f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803b22:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803b25:	83 c6 01             	add    $0x1,%esi
+  803b28:	eb 8f                	jmp    803ab9 <devpipe_read+0x1b>
+out:
+  803b2a:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803b2d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803b30:	89 da                	mov    %ebx,%edx
+  803b32:	e8 38 fd ff ff       	call   80386f <pipewake>
+	return i;
+  803b37:	89 f0                	mov    %esi,%eax
+}
+  803b39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b3c:	5b                   	pop    %ebx
+  803b3d:	5e                   	pop    %esi
+  803b3e:	5f                   	pop    %edi
+  803b3f:	5d                   	pop    %ebp
+  803b40:	c3                   	ret
+
+00803b41 <pipe>:
+{
+  803b41:	55                   	push   %ebp
+  803b42:	89 e5                	mov    %esp,%ebp
+  803b44:	56                   	push   %esi
+  803b45:	53                   	push   %ebx
+  803b46:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803b49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b4c:	50                   	push   %eax
+  803b4d:	e8 e3 df ff ff       	call   801b35 <fd_alloc>
+  803b52:	89 c3                	mov    %eax,%ebx
+  803b54:	83 c4 10             	add    $0x10,%esp
+  803b57:	85 c0                	test   %eax,%eax
+  803b59:	0f 88 23 01 00 00    	js     803c82 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b5f:	83 ec 04             	sub    $0x4,%esp
+  803b62:	68 07 04 00 00       	push   $0x407
+  803b67:	ff 75 f4             	push   -0xc(%ebp)
+  803b6a:	6a 00                	push   $0x0
+  803b6c:	e8 fa d2 ff ff       	call   800e6b <sys_page_alloc>
+  803b71:	89 c3                	mov    %eax,%ebx
+  803b73:	83 c4 10             	add    $0x10,%esp
+  803b76:	85 c0                	test   %eax,%eax
+  803b78:	0f 88 04 01 00 00    	js     803c82 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b7e:	83 ec 0c             	sub    $0xc,%esp
+  803b81:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b84:	50                   	push   %eax
+  803b85:	e8 ab df ff ff       	call   801b35 <fd_alloc>
+  803b8a:	89 c3                	mov    %eax,%ebx
+  803b8c:	83 c4 10             	add    $0x10,%esp
+  803b8f:	85 c0                	test   %eax,%eax
+  803b91:	0f 88 db 00 00 00    	js     803c72 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b97:	83 ec 04             	sub    $0x4,%esp
+  803b9a:	68 07 04 00 00       	push   $0x407
+  803b9f:	ff 75 f0             	push   -0x10(%ebp)
+  803ba2:	6a 00                	push   $0x0
+  803ba4:	e8 c2 d2 ff ff       	call   800e6b <sys_page_alloc>
+  803ba9:	89 c3                	mov    %eax,%ebx
+  803bab:	83 c4 10             	add    $0x10,%esp
+  803bae:	85 c0                	test   %eax,%eax
+  803bb0:	0f 88 bc 00 00 00    	js     803c72 <pipe+0x131>
+	va = fd2data(fd0);
+  803bb6:	83 ec 0c             	sub    $0xc,%esp
+  803bb9:	ff 75 f4             	push   -0xc(%ebp)
+  803bbc:	e8 5d df ff ff       	call   801b1e <fd2data>
+  803bc1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bc3:	83 c4 0c             	add    $0xc,%esp
+  803bc6:	68 07 04 00 00       	push   $0x407
+  803bcb:	50                   	push   %eax
+  803bcc:	6a 00                	push   $0x0
+  803bce:	e8 98 d2 ff ff       	call   800e6b <sys_page_alloc>
+  803bd3:	89 c3                	mov    %eax,%ebx
+  803bd5:	83 c4 10             	add    $0x10,%esp
+  803bd8:	85 c0                	test   %eax,%eax
+  803bda:	0f 88 82 00 00 00    	js     803c62 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803be0:	83 ec 0c             	sub    $0xc,%esp
+  803be3:	ff 75 f0             	push   -0x10(%ebp)
+  803be6:	e8 33 df ff ff       	call   801b1e <fd2data>
+  803beb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803bf2:	50                   	push   %eax
+  803bf3:	6a 00                	push   $0x0
+  803bf5:	56                   	push   %esi
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	e8 bb d2 ff ff       	call   800eb8 <sys_page_map>
+  803bfd:	89 c3                	mov    %eax,%ebx
+  803bff:	83 c4 20             	add    $0x20,%esp
+  803c02:	85 c0                	test   %eax,%eax
+  803c04:	78 4e                	js     803c54 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803c06:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803c0b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c0e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803c10:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803c13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803c1a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803c1d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803c1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803c22:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803c29:	83 ec 0c             	sub    $0xc,%esp
+  803c2c:	ff 75 f4             	push   -0xc(%ebp)
+  803c2f:	e8 da de ff ff       	call   801b0e <fd2num>
+  803c34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c37:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803c39:	83 c4 04             	add    $0x4,%esp
+  803c3c:	ff 75 f0             	push   -0x10(%ebp)
+  803c3f:	e8 ca de ff ff       	call   801b0e <fd2num>
+  803c44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c47:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803c4a:	83 c4 10             	add    $0x10,%esp
+  803c4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c52:	eb 2e                	jmp    803c82 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803c54:	83 ec 08             	sub    $0x8,%esp
+  803c57:	56                   	push   %esi
+  803c58:	6a 00                	push   $0x0
+  803c5a:	e8 a5 d2 ff ff       	call   800f04 <sys_page_unmap>
+  803c5f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803c62:	83 ec 08             	sub    $0x8,%esp
+  803c65:	ff 75 f0             	push   -0x10(%ebp)
+  803c68:	6a 00                	push   $0x0
+  803c6a:	e8 95 d2 ff ff       	call   800f04 <sys_page_unmap>
+  803c6f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c72:	83 ec 08             	sub    $0x8,%esp
+  803c75:	ff 75 f4             	push   -0xc(%ebp)
+  803c78:	6a 00                	push   $0x0
+  803c7a:	e8 85 d2 ff ff       	call   800f04 <sys_page_unmap>
+  803c7f:	83 c4 10             	add    $0x10,%esp
+}
+  803c82:	89 d8                	mov    %ebx,%eax
+  803c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c87:	5b                   	pop    %ebx
+  803c88:	5e                   	pop    %esi
+  803c89:	5d                   	pop    %ebp
+  803c8a:	c3                   	ret
+
+00803c8b <pipeisclosed>:
+{
+  803c8b:	55                   	push   %ebp
+  803c8c:	89 e5                	mov    %esp,%ebp
+  803c8e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c94:	50                   	push   %eax
+  803c95:	ff 75 08             	push   0x8(%ebp)
+  803c98:	e8 ee de ff ff       	call   801b8b <fd_lookup>
+  803c9d:	83 c4 10             	add    $0x10,%esp
+  803ca0:	85 c0                	test   %eax,%eax
+  803ca2:	78 18                	js     803cbc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803ca4:	83 ec 0c             	sub    $0xc,%esp
+  803ca7:	ff 75 f4             	push   -0xc(%ebp)
+  803caa:	e8 6f de ff ff       	call   801b1e <fd2data>
+  803caf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803cb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cb4:	e8 27 fc ff ff       	call   8038e0 <_pipeisclosed>
+  803cb9:	83 c4 10             	add    $0x10,%esp
+}
+  803cbc:	c9                   	leave
+  803cbd:	c3                   	ret
+
+00803cbe <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803cbe:	55                   	push   %ebp
+  803cbf:	89 e5                	mov    %esp,%ebp
+  803cc1:	56                   	push   %esi
+  803cc2:	53                   	push   %ebx
+  803cc3:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803cc6:	85 f6                	test   %esi,%esi
+  803cc8:	74 15                	je     803cdf <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803cca:	89 f0                	mov    %esi,%eax
+  803ccc:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803cd1:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803cd4:	c1 e3 04             	shl    $0x4,%ebx
+  803cd7:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803cdd:	eb 1b                	jmp    803cfa <wait+0x3c>
+	assert(envid != 0);
+  803cdf:	68 aa 56 80 00       	push   $0x8056aa
+  803ce4:	68 b1 54 80 00       	push   $0x8054b1
+  803ce9:	6a 09                	push   $0x9
+  803ceb:	68 b5 56 80 00       	push   $0x8056b5
+  803cf0:	e8 79 c6 ff ff       	call   80036e <_panic>
+		sys_yield();
+  803cf5:	e8 45 d1 ff ff       	call   800e3f <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803cfa:	8b 43 48             	mov    0x48(%ebx),%eax
+  803cfd:	39 f0                	cmp    %esi,%eax
+  803cff:	75 07                	jne    803d08 <wait+0x4a>
+  803d01:	8b 43 54             	mov    0x54(%ebx),%eax
+  803d04:	85 c0                	test   %eax,%eax
+  803d06:	75 ed                	jne    803cf5 <wait+0x37>
+}
+  803d08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d0b:	5b                   	pop    %ebx
+  803d0c:	5e                   	pop    %esi
+  803d0d:	5d                   	pop    %ebp
+  803d0e:	c3                   	ret
+
+00803d0f <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803d0f:	55                   	push   %ebp
+  803d10:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803d12:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d15:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d1b:	5d                   	pop    %ebp
+  803d1c:	c3                   	ret
+
+00803d1d <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803d1d:	55                   	push   %ebp
+  803d1e:	89 e5                	mov    %esp,%ebp
+  803d20:	56                   	push   %esi
+  803d21:	53                   	push   %ebx
+  803d22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d25:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803d2f:	89 d0                	mov    %edx,%eax
+  803d31:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803d35:	85 c0                	test   %eax,%eax
+  803d37:	74 2d                	je     803d66 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803d39:	83 f8 02             	cmp    $0x2,%eax
+  803d3c:	74 08                	je     803d46 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803d3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803d43:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d46:	be 02 00 00 00       	mov    $0x2,%esi
+  803d4b:	eb 15                	jmp    803d62 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803d4d:	83 ec 04             	sub    $0x4,%esp
+  803d50:	6a 00                	push   $0x0
+  803d52:	6a 02                	push   $0x2
+  803d54:	53                   	push   %ebx
+  803d55:	e8 26 d4 ff ff       	call   801180 <sys_futex_wait>
+  803d5a:	89 f0                	mov    %esi,%eax
+  803d5c:	f0 87 03             	lock xchg %eax,(%ebx)
+  803d5f:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803d62:	85 c0                	test   %eax,%eax
+  803d64:	75 e7                	jne    803d4d <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803d66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d69:	5b                   	pop    %ebx
+  803d6a:	5e                   	pop    %esi
+  803d6b:	5d                   	pop    %ebp
+  803d6c:	c3                   	ret
+
+00803d6d <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803d6d:	55                   	push   %ebp
+  803d6e:	89 e5                	mov    %esp,%ebp
+  803d70:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d78:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803d7d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803d81:	f7 d8                	neg    %eax
+  803d83:	19 c0                	sbb    %eax,%eax
+  803d85:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803d88:	5d                   	pop    %ebp
+  803d89:	c3                   	ret
+
+00803d8a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803d8a:	55                   	push   %ebp
+  803d8b:	89 e5                	mov    %esp,%ebp
+  803d8d:	83 ec 08             	sub    $0x8,%esp
+  803d90:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d98:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803d9b:	83 f8 02             	cmp    $0x2,%eax
+  803d9e:	74 02                	je     803da2 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803da0:	c9                   	leave
+  803da1:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803da2:	83 ec 08             	sub    $0x8,%esp
+  803da5:	6a 01                	push   $0x1
+  803da7:	52                   	push   %edx
+  803da8:	e8 02 d4 ff ff       	call   8011af <sys_futex_wake>
+  803dad:	83 c4 10             	add    $0x10,%esp
+}
+  803db0:	eb ee                	jmp    803da0 <mutex_unlock+0x16>
+
+00803db2 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803db2:	55                   	push   %ebp
+  803db3:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803db8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803dbe:	5d                   	pop    %ebp
+  803dbf:	c3                   	ret
+
+00803dc0 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803dc0:	55                   	push   %ebp
+  803dc1:	89 e5                	mov    %esp,%ebp
+  803dc3:	57                   	push   %edi
+  803dc4:	56                   	push   %esi
+  803dc5:	53                   	push   %ebx
+  803dc6:	83 ec 18             	sub    $0x18,%esp
+  803dc9:	8b 75 08             	mov    0x8(%ebp),%esi
+  803dcc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803dcf:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803dd1:	53                   	push   %ebx
+  803dd2:	e8 b3 ff ff ff       	call   803d8a <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803dd7:	83 c4 0c             	add    $0xc,%esp
+  803dda:	ff 75 10             	push   0x10(%ebp)
+  803ddd:	57                   	push   %edi
+  803dde:	56                   	push   %esi
+  803ddf:	e8 9c d3 ff ff       	call   801180 <sys_futex_wait>
+  803de4:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803de6:	83 c4 10             	add    $0x10,%esp
+  803de9:	be 02 00 00 00       	mov    $0x2,%esi
+  803dee:	eb 10                	jmp    803e00 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803df0:	83 ec 04             	sub    $0x4,%esp
+  803df3:	6a 00                	push   $0x0
+  803df5:	6a 02                	push   $0x2
+  803df7:	53                   	push   %ebx
+  803df8:	e8 83 d3 ff ff       	call   801180 <sys_futex_wait>
+  803dfd:	83 c4 10             	add    $0x10,%esp
+  803e00:	89 f0                	mov    %esi,%eax
+  803e02:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	75 e7                	jne    803df0 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803e09:	83 ff ec             	cmp    $0xffffffec,%edi
+  803e0c:	74 05                	je     803e13 <cond_timedwait+0x53>
+  803e0e:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803e13:	89 f8                	mov    %edi,%eax
+  803e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e18:	5b                   	pop    %ebx
+  803e19:	5e                   	pop    %esi
+  803e1a:	5f                   	pop    %edi
+  803e1b:	5d                   	pop    %ebp
+  803e1c:	c3                   	ret
+
+00803e1d <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803e1d:	55                   	push   %ebp
+  803e1e:	89 e5                	mov    %esp,%ebp
+  803e20:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803e23:	6a 00                	push   $0x0
+  803e25:	ff 75 0c             	push   0xc(%ebp)
+  803e28:	ff 75 08             	push   0x8(%ebp)
+  803e2b:	e8 90 ff ff ff       	call   803dc0 <cond_timedwait>
+}
+  803e30:	83 c4 10             	add    $0x10,%esp
+  803e33:	c9                   	leave
+  803e34:	c3                   	ret
+
+00803e35 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803e35:	55                   	push   %ebp
+  803e36:	89 e5                	mov    %esp,%ebp
+  803e38:	83 ec 10             	sub    $0x10,%esp
+  803e3b:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803e3e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e43:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803e47:	6a 01                	push   $0x1
+  803e49:	50                   	push   %eax
+  803e4a:	e8 60 d3 ff ff       	call   8011af <sys_futex_wake>
+}
+  803e4f:	83 c4 10             	add    $0x10,%esp
+  803e52:	c9                   	leave
+  803e53:	c3                   	ret
+
+00803e54 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803e54:	55                   	push   %ebp
+  803e55:	89 e5                	mov    %esp,%ebp
+  803e57:	83 ec 10             	sub    $0x10,%esp
+  803e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e5d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e62:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803e66:	68 00 04 00 00       	push   $0x400
+  803e6b:	50                   	push   %eax
+  803e6c:	e8 3e d3 ff ff       	call   8011af <sys_futex_wake>
+}
+  803e71:	83 c4 10             	add    $0x10,%esp
+  803e74:	c9                   	leave
+  803e75:	c3                   	ret
+
+00803e76 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803e76:	55                   	push   %ebp
+  803e77:	89 e5                	mov    %esp,%ebp
+  803e79:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803e7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e7f:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803e81:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803e88:	5d                   	pop    %ebp
+  803e89:	c3                   	ret
+
+00803e8a <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803e8a:	55                   	push   %ebp
+  803e8b:	89 e5                	mov    %esp,%ebp
+  803e8d:	53                   	push   %ebx
+  803e8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803e91:	8b 11                	mov    (%ecx),%edx
+  803e93:	85 d2                	test   %edx,%edx
+  803e95:	74 14                	je     803eab <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803e97:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803e9a:	89 d0                	mov    %edx,%eax
+  803e9c:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803ea0:	39 c2                	cmp    %eax,%edx
+  803ea2:	75 ed                	jne    803e91 <sem_trywait+0x7>
+			return 0;
+  803ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea9:	eb 05                	jmp    803eb0 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803eab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803eb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803eb3:	c9                   	leave
+  803eb4:	c3                   	ret
+
+00803eb5 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803eb5:	55                   	push   %ebp
+  803eb6:	89 e5                	mov    %esp,%ebp
+  803eb8:	57                   	push   %edi
+  803eb9:	56                   	push   %esi
+  803eba:	53                   	push   %ebx
+  803ebb:	83 ec 1c             	sub    $0x1c,%esp
+  803ebe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ec1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803ec4:	e8 2f d2 ff ff       	call   8010f8 <sys_time_msec>
+  803ec9:	01 f8                	add    %edi,%eax
+  803ecb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803ece:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803ed3:	eb 28                	jmp    803efd <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803eda:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803edf:	83 ec 04             	sub    $0x4,%esp
+  803ee2:	56                   	push   %esi
+  803ee3:	6a 00                	push   $0x0
+  803ee5:	53                   	push   %ebx
+  803ee6:	e8 95 d2 ff ff       	call   801180 <sys_futex_wait>
+  803eeb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803ef0:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803ef5:	83 c4 10             	add    $0x10,%esp
+  803ef8:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803efb:	74 2e                	je     803f2b <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803efd:	83 ec 0c             	sub    $0xc,%esp
+  803f00:	53                   	push   %ebx
+  803f01:	e8 84 ff ff ff       	call   803e8a <sem_trywait>
+  803f06:	83 c4 10             	add    $0x10,%esp
+  803f09:	85 c0                	test   %eax,%eax
+  803f0b:	79 19                	jns    803f26 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803f0d:	85 ff                	test   %edi,%edi
+  803f0f:	74 c4                	je     803ed5 <sem_timedwait+0x20>
+  803f11:	e8 e2 d1 ff ff       	call   8010f8 <sys_time_msec>
+  803f16:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803f19:	29 c6                	sub    %eax,%esi
+  803f1b:	85 f6                	test   %esi,%esi
+  803f1d:	7f b6                	jg     803ed5 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803f1f:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803f24:	eb 05                	jmp    803f2b <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803f26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f2e:	5b                   	pop    %ebx
+  803f2f:	5e                   	pop    %esi
+  803f30:	5f                   	pop    %edi
+  803f31:	5d                   	pop    %ebp
+  803f32:	c3                   	ret
+
+00803f33 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803f33:	55                   	push   %ebp
+  803f34:	89 e5                	mov    %esp,%ebp
+  803f36:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803f39:	6a 00                	push   $0x0
+  803f3b:	ff 75 08             	push   0x8(%ebp)
+  803f3e:	e8 72 ff ff ff       	call   803eb5 <sem_timedwait>
+}
+  803f43:	83 c4 10             	add    $0x10,%esp
+  803f46:	c9                   	leave
+  803f47:	c3                   	ret
+
+00803f48 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803f48:	55                   	push   %ebp
+  803f49:	89 e5                	mov    %esp,%ebp
+  803f4b:	83 ec 08             	sub    $0x8,%esp
+  803f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f51:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f56:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803f5a:	8b 50 04             	mov    0x4(%eax),%edx
+  803f5d:	85 d2                	test   %edx,%edx
+  803f5f:	75 02                	jne    803f63 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803f61:	c9                   	leave
+  803f62:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803f63:	83 ec 08             	sub    $0x8,%esp
+  803f66:	6a 01                	push   $0x1
+  803f68:	50                   	push   %eax
+  803f69:	e8 41 d2 ff ff       	call   8011af <sys_futex_wake>
+  803f6e:	83 c4 10             	add    $0x10,%esp
+}
+  803f71:	eb ee                	jmp    803f61 <sem_post+0x19>
+
+00803f73 <ring_npages>:
+// bytes, or 0 if that is not a valid ring or would not fit in
+// RING_MAXPAGES pages.  The bound is checked before multiplying, so
+// slotsize * nslots cannot wrap.
+static uint32_t
+ring_npages(uint32_t slotsize, uint32_t nslots)
+{
+  803f73:	55                   	push   %ebp
+  803f74:	89 e5                	mov    %esp,%ebp
+  803f76:	56                   	push   %esi
+  803f77:	53                   	push   %ebx
+  803f78:	89 d3                	mov    %edx,%ebx
+	if (nslots == 0 || (nslots & (nslots - 1)) || slotsize == 0
+	    || slotsize % sizeof(uint32_t)
+	    || nslots > (RING_MAXPAGES - 1) * PGSIZE / slotsize)
+		return 0;
+  803f7a:	89 d6                	mov    %edx,%esi
+	if (nslots == 0 || (nslots & (nslots - 1)) || slotsize == 0
+  803f7c:	85 d2                	test   %edx,%edx
+  803f7e:	74 08                	je     803f88 <ring_npages+0x15>
+  803f80:	89 c1                	mov    %eax,%ecx
+		return 0;
+  803f82:	89 c6                	mov    %eax,%esi
+	if (nslots == 0 || (nslots & (nslots - 1)) || slotsize == 0
+  803f84:	85 c0                	test   %eax,%eax
+  803f86:	75 06                	jne    803f8e <ring_npages+0x1b>
+	return 1 + ROUNDUP(slotsize * nslots, PGSIZE) / PGSIZE;
+}
+  803f88:	89 f0                	mov    %esi,%eax
+  803f8a:	5b                   	pop    %ebx
+  803f8b:	5e                   	pop    %esi
+  803f8c:	5d                   	pop    %ebp
+  803f8d:	c3                   	ret
+	if (nslots == 0 || (nslots & (nslots - 1)) || slotsize == 0
+  803f8e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  803f91:	21 d6                	and    %edx,%esi
+	    || slotsize % sizeof(uint32_t)
+  803f93:	83 e0 03             	and    $0x3,%eax
+  803f96:	09 c6                	or     %eax,%esi
+  803f98:	75 21                	jne    803fbb <ring_npages+0x48>
+	    || nslots > (RING_MAXPAGES - 1) * PGSIZE / slotsize)
+  803f9a:	b8 00 f0 0f 00       	mov    $0xff000,%eax
+  803f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fa4:	f7 f1                	div    %ecx
+  803fa6:	39 d8                	cmp    %ebx,%eax
+  803fa8:	72 de                	jb     803f88 <ring_npages+0x15>
+	return 1 + ROUNDUP(slotsize * nslots, PGSIZE) / PGSIZE;
+  803faa:	0f af cb             	imul   %ebx,%ecx
+  803fad:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+  803fb3:	c1 e9 0c             	shr    $0xc,%ecx
+  803fb6:	8d 71 01             	lea    0x1(%ecx),%esi
+  803fb9:	eb cd                	jmp    803f88 <ring_npages+0x15>
+		return 0;
+  803fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc0:	eb c6                	jmp    803f88 <ring_npages+0x15>
+
+00803fc2 <ring_attach>:
+// mapped at va, e.g. inherited from the parent or by ring_accept.
+// The header came from the peer, so its geometry is checked against
+// the pages it says are mapped before any slot is indexed.
+int
+ring_attach(struct Ring *r, void *va, int role)
+{
+  803fc2:	55                   	push   %ebp
+  803fc3:	89 e5                	mov    %esp,%ebp
+  803fc5:	57                   	push   %edi
+  803fc6:	56                   	push   %esi
+  803fc7:	53                   	push   %ebx
+  803fc8:	83 ec 0c             	sub    $0xc,%esp
+  803fcb:	8b 75 08             	mov    0x8(%ebp),%esi
+  803fce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803fd1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	struct RingHdr *hdr = va;
+	uint32_t npages;
+
+	if (hdr->rh_magic != RING_MAGIC
+  803fd4:	81 bb 80 00 00 00 47 	cmpl   $0x52494e47,0x80(%ebx)
+  803fdb:	4e 49 52 
+  803fde:	0f 85 83 00 00 00    	jne    804067 <ring_attach+0xa5>
+	    || (role != RING_PRODUCER && role != RING_CONSUMER))
+  803fe4:	83 ff 01             	cmp    $0x1,%edi
+  803fe7:	0f 87 81 00 00 00    	ja     80406e <ring_attach+0xac>
+		return -E_INVAL;
+	npages = ring_npages(hdr->rh_slotsize, hdr->rh_nslots);
+  803fed:	8b 93 88 00 00 00    	mov    0x88(%ebx),%edx
+  803ff3:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  803ff9:	e8 75 ff ff ff       	call   803f73 <ring_npages>
+	if (npages == 0 || npages > hdr->rh_npages || hdr->rh_npages > RING_MAXPAGES)
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	74 73                	je     804075 <ring_attach+0xb3>
+  804002:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+  804008:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80400e:	77 6c                	ja     80407c <ring_attach+0xba>
+  804010:	39 c2                	cmp    %eax,%edx
+  804012:	72 68                	jb     80407c <ring_attach+0xba>
+		return -E_INVAL;
+	r->r_hdr = hdr;
+  804014:	89 1e                	mov    %ebx,(%esi)
+	r->r_data = va + PGSIZE;
+  804016:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+  80401c:	89 46 04             	mov    %eax,0x4(%esi)
+	r->r_role = role;
+  80401f:	89 7e 08             	mov    %edi,0x8(%esi)
+	r->r_batch = MAX(hdr->rh_nslots / 4, 1);
+  804022:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+  804028:	c1 e8 02             	shr    $0x2,%eax
+  80402b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804030:	0f 44 c2             	cmove  %edx,%eax
+  804033:	89 46 0c             	mov    %eax,0xc(%esi)
+	if (role == RING_PRODUCER) {
+  804036:	85 ff                	test   %edi,%edi
+  804038:	75 18                	jne    804052 <ring_attach+0x90>
+		r->r_next = r->r_pub = hdr->rh_head;
+  80403a:	8b 03                	mov    (%ebx),%eax
+  80403c:	89 46 18             	mov    %eax,0x18(%esi)
+  80403f:	89 46 10             	mov    %eax,0x10(%esi)
+		r->r_peer = hdr->rh_tail;
+  804042:	8b 43 40             	mov    0x40(%ebx),%eax
+  804045:	89 46 14             	mov    %eax,0x14(%esi)
+	} else {
+		r->r_next = r->r_pub = hdr->rh_tail;
+		r->r_peer = hdr->rh_head;
+	}
+	return 0;
+  804048:	89 f8                	mov    %edi,%eax
+}
+  80404a:	83 c4 0c             	add    $0xc,%esp
+  80404d:	5b                   	pop    %ebx
+  80404e:	5e                   	pop    %esi
+  80404f:	5f                   	pop    %edi
+  804050:	5d                   	pop    %ebp
+  804051:	c3                   	ret
+		r->r_next = r->r_pub = hdr->rh_tail;
+  804052:	8b 43 40             	mov    0x40(%ebx),%eax
+  804055:	89 46 18             	mov    %eax,0x18(%esi)
+  804058:	89 46 10             	mov    %eax,0x10(%esi)
+		r->r_peer = hdr->rh_head;
+  80405b:	8b 03                	mov    (%ebx),%eax
+  80405d:	89 46 14             	mov    %eax,0x14(%esi)
+	return 0;
+  804060:	b8 00 00 00 00       	mov    $0x0,%eax
+  804065:	eb e3                	jmp    80404a <ring_attach+0x88>
+		return -E_INVAL;
+  804067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80406c:	eb dc                	jmp    80404a <ring_attach+0x88>
+  80406e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804073:	eb d5                	jmp    80404a <ring_attach+0x88>
+		return -E_INVAL;
+  804075:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80407a:	eb ce                	jmp    80404a <ring_attach+0x88>
+  80407c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804081:	eb c7                	jmp    80404a <ring_attach+0x88>
+
+00804083 <ring_create>:
+{
+  804083:	55                   	push   %ebp
+  804084:	89 e5                	mov    %esp,%ebp
+  804086:	57                   	push   %edi
+  804087:	56                   	push   %esi
+  804088:	53                   	push   %ebx
+  804089:	83 ec 0c             	sub    $0xc,%esp
+	if (PGOFF(va) || (npages = ring_npages(slotsize, nslots)) == 0)
+  80408c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80408f:	89 f3                	mov    %esi,%ebx
+  804091:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  804097:	0f 85 a3 00 00 00    	jne    804140 <ring_create+0xbd>
+  80409d:	8b 55 14             	mov    0x14(%ebp),%edx
+  8040a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8040a3:	e8 cb fe ff ff       	call   803f73 <ring_npages>
+  8040a8:	89 c7                	mov    %eax,%edi
+  8040aa:	85 c0                	test   %eax,%eax
+  8040ac:	0f 84 95 00 00 00    	je     804147 <ring_create+0xc4>
+		if ((rr = sys_page_alloc(0, va + i * PGSIZE, RING_PERM)) < 0)
+  8040b2:	83 ec 04             	sub    $0x4,%esp
+  8040b5:	68 07 04 00 00       	push   $0x407
+  8040ba:	56                   	push   %esi
+  8040bb:	6a 00                	push   $0x0
+  8040bd:	e8 a9 cd ff ff       	call   800e6b <sys_page_alloc>
+  8040c2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040c8:	83 c4 10             	add    $0x10,%esp
+  8040cb:	85 c0                	test   %eax,%eax
+  8040cd:	78 46                	js     804115 <ring_create+0x92>
+	for (i = 0; i < npages; i++)
+  8040cf:	83 c3 01             	add    $0x1,%ebx
+  8040d2:	39 df                	cmp    %ebx,%edi
+  8040d4:	75 dc                	jne    8040b2 <ring_create+0x2f>
+	hdr->rh_magic = RING_MAGIC;
+  8040d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040d9:	c7 80 80 00 00 00 47 	movl   $0x52494e47,0x80(%eax)
+  8040e0:	4e 49 52 
+	hdr->rh_slotsize = slotsize;
+  8040e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8040e6:	89 88 84 00 00 00    	mov    %ecx,0x84(%eax)
+	hdr->rh_nslots = nslots;
+  8040ec:	8b 55 14             	mov    0x14(%ebp),%edx
+  8040ef:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+	hdr->rh_npages = npages;
+  8040f5:	89 b8 8c 00 00 00    	mov    %edi,0x8c(%eax)
+	return ring_attach(r, va, role);
+  8040fb:	83 ec 04             	sub    $0x4,%esp
+  8040fe:	ff 75 18             	push   0x18(%ebp)
+  804101:	50                   	push   %eax
+  804102:	ff 75 08             	push   0x8(%ebp)
+  804105:	e8 b8 fe ff ff       	call   803fc2 <ring_attach>
+  80410a:	83 c4 10             	add    $0x10,%esp
+}
+  80410d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804110:	5b                   	pop    %ebx
+  804111:	5e                   	pop    %esi
+  804112:	5f                   	pop    %edi
+  804113:	5d                   	pop    %ebp
+  804114:	c3                   	ret
+  804115:	89 de                	mov    %ebx,%esi
+  804117:	c1 e6 0c             	shl    $0xc,%esi
+  80411a:	03 75 0c             	add    0xc(%ebp),%esi
+  80411d:	89 c7                	mov    %eax,%edi
+  80411f:	eb 11                	jmp    804132 <ring_create+0xaf>
+		sys_page_unmap(0, va + i * PGSIZE);
+  804121:	83 ec 08             	sub    $0x8,%esp
+  804124:	56                   	push   %esi
+  804125:	6a 00                	push   $0x0
+  804127:	e8 d8 cd ff ff       	call   800f04 <sys_page_unmap>
+  80412c:	83 eb 01             	sub    $0x1,%ebx
+  80412f:	83 c4 10             	add    $0x10,%esp
+	while (i-- > 0)
+  804132:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+  804138:	85 db                	test   %ebx,%ebx
+  80413a:	75 e5                	jne    804121 <ring_create+0x9e>
+  80413c:	89 f8                	mov    %edi,%eax
+  80413e:	eb cd                	jmp    80410d <ring_create+0x8a>
+		return -E_INVAL;
+  804140:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804145:	eb c6                	jmp    80410d <ring_create+0x8a>
+  804147:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80414c:	eb bf                	jmp    80410d <ring_create+0x8a>
+
+0080414e <ring_grant>:
+
+// Send the ring's pages to env 'to', which must be in ring_accept.
+int
+ring_grant(struct Ring *r, envid_t to)
+{
+  80414e:	55                   	push   %ebp
+  80414f:	89 e5                	mov    %esp,%ebp
+  804151:	57                   	push   %edi
+  804152:	56                   	push   %esi
+  804153:	53                   	push   %ebx
+  804154:	83 ec 0c             	sub    $0xc,%esp
+  804157:	8b 75 08             	mov    0x8(%ebp),%esi
+  80415a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t i;
+
+	for (i = 0; i < r->r_hdr->rh_npages; i++)
+  80415d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804162:	eb 1a                	jmp    80417e <ring_grant+0x30>
+		ipc_send(to, i, (void *) r->r_hdr + i * PGSIZE, RING_PERM);
+  804164:	68 07 04 00 00       	push   $0x407
+  804169:	89 da                	mov    %ebx,%edx
+  80416b:	c1 e2 0c             	shl    $0xc,%edx
+  80416e:	01 d0                	add    %edx,%eax
+  804170:	50                   	push   %eax
+  804171:	53                   	push   %ebx
+  804172:	57                   	push   %edi
+  804173:	e8 01 d9 ff ff       	call   801a79 <ipc_send>
+	for (i = 0; i < r->r_hdr->rh_npages; i++)
+  804178:	83 c3 01             	add    $0x1,%ebx
+  80417b:	83 c4 10             	add    $0x10,%esp
+  80417e:	8b 06                	mov    (%esi),%eax
+  804180:	3b 98 8c 00 00 00    	cmp    0x8c(%eax),%ebx
+  804186:	72 dc                	jb     804164 <ring_grant+0x16>
+	return 0;
+}
+  804188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80418d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804190:	5b                   	pop    %ebx
+  804191:	5e                   	pop    %esi
+  804192:	5f                   	pop    %edi
+  804193:	5d                   	pop    %ebp
+  804194:	c3                   	ret
+
+00804195 <ring_accept>:
+
+// Receive a ring granted with ring_grant, mapping it at va, and set up
+// r as the 'role' end of it.  Stores the granting env in *from_store.
+int
+ring_accept(struct Ring *r, void *va, int role, envid_t *from_store)
+{
+  804195:	55                   	push   %ebp
+  804196:	89 e5                	mov    %esp,%ebp
+  804198:	57                   	push   %edi
+  804199:	56                   	push   %esi
+  80419a:	53                   	push   %ebx
+  80419b:	83 ec 20             	sub    $0x20,%esp
+  80419e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct RingHdr *hdr = va;
+	envid_t from, who;
+	uint32_t i;
+	int perm, rr;
+
+	if ((rr = ipc_recv(&from, va, &perm)) != 0 || !(perm & PTE_P)
+  8041a1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8041a4:	50                   	push   %eax
+  8041a5:	56                   	push   %esi
+  8041a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8041a9:	50                   	push   %eax
+  8041aa:	e8 d4 d7 ff ff       	call   801983 <ipc_recv>
+  8041af:	83 c4 10             	add    $0x10,%esp
+  8041b2:	85 c0                	test   %eax,%eax
+  8041b4:	75 62                	jne    804218 <ring_accept+0x83>
+	    || hdr->rh_magic != RING_MAGIC || hdr->rh_npages > RING_MAXPAGES)
+		return rr < 0 ? rr : -E_INVAL;
+  8041b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+	if ((rr = ipc_recv(&from, va, &perm)) != 0 || !(perm & PTE_P)
+  8041bb:	f6 45 dc 01          	testb  $0x1,-0x24(%ebp)
+  8041bf:	74 59                	je     80421a <ring_accept+0x85>
+	    || hdr->rh_magic != RING_MAGIC || hdr->rh_npages > RING_MAXPAGES)
+  8041c1:	81 be 80 00 00 00 47 	cmpl   $0x52494e47,0x80(%esi)
+  8041c8:	4e 49 52 
+  8041cb:	75 4d                	jne    80421a <ring_accept+0x85>
+  8041cd:	81 be 8c 00 00 00 00 	cmpl   $0x100,0x8c(%esi)
+  8041d4:	01 00 00 
+  8041d7:	77 41                	ja     80421a <ring_accept+0x85>
+	for (i = 1; i < hdr->rh_npages; i++) {
+  8041d9:	bb 01 00 00 00       	mov    $0x1,%ebx
+		rr = ipc_recv(&who, va + i * PGSIZE, &perm);
+  8041de:	8d 7d dc             	lea    -0x24(%ebp),%edi
+	for (i = 1; i < hdr->rh_npages; i++) {
+  8041e1:	3b 9e 8c 00 00 00    	cmp    0x8c(%esi),%ebx
+  8041e7:	73 39                	jae    804222 <ring_accept+0x8d>
+		rr = ipc_recv(&who, va + i * PGSIZE, &perm);
+  8041e9:	83 ec 04             	sub    $0x4,%esp
+  8041ec:	57                   	push   %edi
+  8041ed:	89 d8                	mov    %ebx,%eax
+  8041ef:	c1 e0 0c             	shl    $0xc,%eax
+  8041f2:	01 f0                	add    %esi,%eax
+  8041f4:	50                   	push   %eax
+  8041f5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8041f8:	50                   	push   %eax
+  8041f9:	e8 85 d7 ff ff       	call   801983 <ipc_recv>
+		if (rr != i || who != from || !(perm & PTE_P))
+  8041fe:	83 c4 10             	add    $0x10,%esp
+  804201:	39 d8                	cmp    %ebx,%eax
+  804203:	75 46                	jne    80424b <ring_accept+0xb6>
+  804205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804208:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+  80420b:	75 45                	jne    804252 <ring_accept+0xbd>
+  80420d:	f6 45 dc 01          	testb  $0x1,-0x24(%ebp)
+  804211:	74 46                	je     804259 <ring_accept+0xc4>
+	for (i = 1; i < hdr->rh_npages; i++) {
+  804213:	83 c3 01             	add    $0x1,%ebx
+  804216:	eb c9                	jmp    8041e1 <ring_accept+0x4c>
+		return rr < 0 ? rr : -E_INVAL;
+  804218:	79 2a                	jns    804244 <ring_accept+0xaf>
+			return -E_INVAL;
+	}
+	if (from_store)
+		*from_store = from;
+	return ring_attach(r, va, role);
+}
+  80421a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80421d:	5b                   	pop    %ebx
+  80421e:	5e                   	pop    %esi
+  80421f:	5f                   	pop    %edi
+  804220:	5d                   	pop    %ebp
+  804221:	c3                   	ret
+	if (from_store)
+  804222:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  804226:	74 08                	je     804230 <ring_accept+0x9b>
+		*from_store = from;
+  804228:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80422b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80422e:	89 02                	mov    %eax,(%edx)
+	return ring_attach(r, va, role);
+  804230:	83 ec 04             	sub    $0x4,%esp
+  804233:	ff 75 10             	push   0x10(%ebp)
+  804236:	56                   	push   %esi
+  804237:	ff 75 08             	push   0x8(%ebp)
+  80423a:	e8 83 fd ff ff       	call   803fc2 <ring_attach>
+  80423f:	83 c4 10             	add    $0x10,%esp
+  804242:	eb d6                	jmp    80421a <ring_accept+0x85>
+		return rr < 0 ? rr : -E_INVAL;
+  804244:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804249:	eb cf                	jmp    80421a <ring_accept+0x85>
+			return -E_INVAL;
+  80424b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804250:	eb c8                	jmp    80421a <ring_accept+0x85>
+  804252:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804257:	eb c1                	jmp    80421a <ring_accept+0x85>
+  804259:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80425e:	eb ba                	jmp    80421a <ring_accept+0x85>
+
+00804260 <ring_set_batch>:
+
+// Publish (producer) or release (consumer) slots after every 'batch'
+// pushes or pops.  1 makes every operation visible at once.
+void
+ring_set_batch(struct Ring *r, uint32_t batch)
+{
+  804260:	55                   	push   %ebp
+  804261:	89 e5                	mov    %esp,%ebp
+  804263:	53                   	push   %ebx
+  804264:	8b 55 08             	mov    0x8(%ebp),%edx
+  804267:	8b 45 0c             	mov    0xc(%ebp),%eax
+	r->r_batch = MIN(MAX(batch, 1), r->r_hdr->rh_nslots);
+  80426a:	8b 0a                	mov    (%edx),%ecx
+  80426c:	85 c0                	test   %eax,%eax
+  80426e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804273:	0f 44 c3             	cmove  %ebx,%eax
+  804276:	8b 89 88 00 00 00    	mov    0x88(%ecx),%ecx
+  80427c:	39 c8                	cmp    %ecx,%eax
+  80427e:	0f 47 c1             	cmova  %ecx,%eax
+  804281:	89 42 0c             	mov    %eax,0xc(%edx)
+}
+  804284:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804287:	c9                   	leave
+  804288:	c3                   	ret
+
+00804289 <ring_flush>:
+
+// Make our private index visible to the other side, and ring its
+// doorbell if it sleeps waiting for us.
+void
+ring_flush(struct Ring *r)
+{
+  804289:	55                   	push   %ebp
+  80428a:	89 e5                	mov    %esp,%ebp
+  80428c:	83 ec 08             	sub    $0x8,%esp
+  80428f:	8b 55 08             	mov    0x8(%ebp),%edx
+	struct RingHdr *hdr = r->r_hdr;
+
+	if (r->r_next == r->r_pub)
+  804292:	8b 42 10             	mov    0x10(%edx),%eax
+  804295:	3b 42 18             	cmp    0x18(%edx),%eax
+  804298:	74 15                	je     8042af <ring_flush+0x26>
+	struct RingHdr *hdr = r->r_hdr;
+  80429a:	8b 0a                	mov    (%edx),%ecx
+		return;
+	r->r_pub = r->r_next;
+  80429c:	89 42 18             	mov    %eax,0x18(%edx)
+	// xchg is a locked store: it orders the slot contents before the
+	// index, and the index before our read of the idle flag below,
+	// pairing with the xchg in ring_sleep.
+	if (r->r_role == RING_PRODUCER) {
+  80429f:	83 7a 08 00          	cmpl   $0x0,0x8(%edx)
+  8042a3:	75 1c                	jne    8042c1 <ring_flush+0x38>
+	asm volatile("lock; xchgl %0, %1"
+  8042a5:	f0 87 01             	lock xchg %eax,(%ecx)
+		xchg(&hdr->rh_head, r->r_next);
+		if (hdr->rh_cons_idle)
+  8042a8:	8b 41 44             	mov    0x44(%ecx),%eax
+  8042ab:	85 c0                	test   %eax,%eax
+  8042ad:	75 02                	jne    8042b1 <ring_flush+0x28>
+	} else {
+		xchg(&hdr->rh_tail, r->r_next);
+		if (hdr->rh_prod_idle)
+			sys_futex_wake(&hdr->rh_tail, 1);
+	}
+}
+  8042af:	c9                   	leave
+  8042b0:	c3                   	ret
+			sys_futex_wake(&hdr->rh_head, 1);
+  8042b1:	83 ec 08             	sub    $0x8,%esp
+  8042b4:	6a 01                	push   $0x1
+  8042b6:	51                   	push   %ecx
+  8042b7:	e8 f3 ce ff ff       	call   8011af <sys_futex_wake>
+  8042bc:	83 c4 10             	add    $0x10,%esp
+  8042bf:	eb ee                	jmp    8042af <ring_flush+0x26>
+		xchg(&hdr->rh_tail, r->r_next);
+  8042c1:	8d 51 40             	lea    0x40(%ecx),%edx
+  8042c4:	f0 87 41 40          	lock xchg %eax,0x40(%ecx)
+		if (hdr->rh_prod_idle)
+  8042c8:	8b 41 04             	mov    0x4(%ecx),%eax
+  8042cb:	85 c0                	test   %eax,%eax
+  8042cd:	74 e0                	je     8042af <ring_flush+0x26>
+			sys_futex_wake(&hdr->rh_tail, 1);
+  8042cf:	83 ec 08             	sub    $0x8,%esp
+  8042d2:	6a 01                	push   $0x1
+  8042d4:	52                   	push   %edx
+  8042d5:	e8 d5 ce ff ff       	call   8011af <sys_futex_wake>
+  8042da:	83 c4 10             	add    $0x10,%esp
+  8042dd:	eb d0                	jmp    8042af <ring_flush+0x26>
+
+008042df <ring_try_alloc>:
+
+// Producer: return the next free slot, or NULL if the ring is full.
+// The slot is not handed to the consumer until ring_push.
+void *
+ring_try_alloc(struct Ring *r)
+{
+  8042df:	55                   	push   %ebp
+  8042e0:	89 e5                	mov    %esp,%ebp
+  8042e2:	57                   	push   %edi
+  8042e3:	56                   	push   %esi
+  8042e4:	53                   	push   %ebx
+  8042e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	uint32_t nslots = r->r_hdr->rh_nslots;
+  8042e8:	8b 0a                	mov    (%edx),%ecx
+  8042ea:	8b 81 88 00 00 00    	mov    0x88(%ecx),%eax
+
+	if (r->r_next - r->r_peer == nslots) {
+  8042f0:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8042f3:	89 de                	mov    %ebx,%esi
+  8042f5:	2b 72 14             	sub    0x14(%edx),%esi
+  8042f8:	39 c6                	cmp    %eax,%esi
+  8042fa:	74 1a                	je     804316 <ring_try_alloc+0x37>
+	return r->r_data + (idx & (r->r_hdr->rh_nslots - 1)) * r->r_hdr->rh_slotsize;
+  8042fc:	8b 81 88 00 00 00    	mov    0x88(%ecx),%eax
+  804302:	83 e8 01             	sub    $0x1,%eax
+  804305:	21 d8                	and    %ebx,%eax
+  804307:	0f af 81 84 00 00 00 	imul   0x84(%ecx),%eax
+  80430e:	03 42 04             	add    0x4(%edx),%eax
+		r->r_peer = r->r_hdr->rh_tail;
+		if (r->r_next - r->r_peer == nslots)
+			return NULL;
+	}
+	return ring_slot(r, r->r_next);
+}
+  804311:	5b                   	pop    %ebx
+  804312:	5e                   	pop    %esi
+  804313:	5f                   	pop    %edi
+  804314:	5d                   	pop    %ebp
+  804315:	c3                   	ret
+		r->r_peer = r->r_hdr->rh_tail;
+  804316:	8b 71 40             	mov    0x40(%ecx),%esi
+  804319:	89 72 14             	mov    %esi,0x14(%edx)
+		if (r->r_next - r->r_peer == nslots)
+  80431c:	89 df                	mov    %ebx,%edi
+  80431e:	29 f7                	sub    %esi,%edi
+  804320:	39 c7                	cmp    %eax,%edi
+  804322:	75 d8                	jne    8042fc <ring_try_alloc+0x1d>
+			return NULL;
+  804324:	b8 00 00 00 00       	mov    $0x0,%eax
+  804329:	eb e6                	jmp    804311 <ring_try_alloc+0x32>
+
+0080432b <ring_alloc>:
+
+// Producer: return the next free slot, sleeping while the ring is full.
+void *
+ring_alloc(struct Ring *r)
+{
+  80432b:	55                   	push   %ebp
+  80432c:	89 e5                	mov    %esp,%ebp
+  80432e:	57                   	push   %edi
+  80432f:	56                   	push   %esi
+  804330:	53                   	push   %ebx
+  804331:	83 ec 0c             	sub    $0xc,%esp
+  804334:	8b 75 08             	mov    0x8(%ebp),%esi
+  804337:	bf 01 00 00 00       	mov    $0x1,%edi
+	void *slot;
+
+	while ((slot = ring_try_alloc(r)) == NULL)
+  80433c:	eb 07                	jmp    804345 <ring_alloc+0x1a>
+	*idle = 0;
+  80433e:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	while ((slot = ring_try_alloc(r)) == NULL)
+  804345:	83 ec 0c             	sub    $0xc,%esp
+  804348:	56                   	push   %esi
+  804349:	e8 91 ff ff ff       	call   8042df <ring_try_alloc>
+  80434e:	83 c4 10             	add    $0x10,%esp
+  804351:	85 c0                	test   %eax,%eax
+  804353:	75 32                	jne    804387 <ring_alloc+0x5c>
+		ring_sleep(r, &r->r_hdr->rh_prod_idle, &r->r_hdr->rh_tail);
+  804355:	8b 1e                	mov    (%esi),%ebx
+	ring_flush(r);
+  804357:	83 ec 0c             	sub    $0xc,%esp
+  80435a:	56                   	push   %esi
+  80435b:	e8 29 ff ff ff       	call   804289 <ring_flush>
+  804360:	89 f8                	mov    %edi,%eax
+  804362:	f0 87 43 04          	lock xchg %eax,0x4(%ebx)
+	if (*index == r->r_peer)
+  804366:	8b 53 40             	mov    0x40(%ebx),%edx
+  804369:	8b 46 14             	mov    0x14(%esi),%eax
+  80436c:	83 c4 10             	add    $0x10,%esp
+  80436f:	39 c2                	cmp    %eax,%edx
+  804371:	75 cb                	jne    80433e <ring_alloc+0x13>
+		sys_futex_wait(index, r->r_peer, 0);
+  804373:	83 ec 04             	sub    $0x4,%esp
+  804376:	6a 00                	push   $0x0
+  804378:	50                   	push   %eax
+		ring_sleep(r, &r->r_hdr->rh_prod_idle, &r->r_hdr->rh_tail);
+  804379:	8d 43 40             	lea    0x40(%ebx),%eax
+		sys_futex_wait(index, r->r_peer, 0);
+  80437c:	50                   	push   %eax
+  80437d:	e8 fe cd ff ff       	call   801180 <sys_futex_wait>
+  804382:	83 c4 10             	add    $0x10,%esp
+  804385:	eb b7                	jmp    80433e <ring_alloc+0x13>
+	return slot;
+}
+  804387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80438a:	5b                   	pop    %ebx
+  80438b:	5e                   	pop    %esi
+  80438c:	5f                   	pop    %edi
+  80438d:	5d                   	pop    %ebp
+  80438e:	c3                   	ret
+
+0080438f <ring_push>:
+
+// Producer: queue the slot returned by ring_alloc for the consumer.
+void
+ring_push(struct Ring *r)
+{
+  80438f:	55                   	push   %ebp
+  804390:	89 e5                	mov    %esp,%ebp
+  804392:	83 ec 08             	sub    $0x8,%esp
+  804395:	8b 55 08             	mov    0x8(%ebp),%edx
+	r->r_next++;
+  804398:	8b 42 10             	mov    0x10(%edx),%eax
+  80439b:	83 c0 01             	add    $0x1,%eax
+  80439e:	89 42 10             	mov    %eax,0x10(%edx)
+	if (r->r_next - r->r_pub >= r->r_batch)
+  8043a1:	2b 42 18             	sub    0x18(%edx),%eax
+  8043a4:	3b 42 0c             	cmp    0xc(%edx),%eax
+  8043a7:	73 02                	jae    8043ab <ring_push+0x1c>
+		ring_flush(r);
+}
+  8043a9:	c9                   	leave
+  8043aa:	c3                   	ret
+		ring_flush(r);
+  8043ab:	83 ec 0c             	sub    $0xc,%esp
+  8043ae:	52                   	push   %edx
+  8043af:	e8 d5 fe ff ff       	call   804289 <ring_flush>
+  8043b4:	83 c4 10             	add    $0x10,%esp
+}
+  8043b7:	eb f0                	jmp    8043a9 <ring_push+0x1a>
+
+008043b9 <ring_try_front>:
+
+// Consumer: return the oldest published slot, or NULL if there is none.
+// The slot stays ours until ring_pop.
+void *
+ring_try_front(struct Ring *r)
+{
+  8043b9:	55                   	push   %ebp
+  8043ba:	89 e5                	mov    %esp,%ebp
+  8043bc:	53                   	push   %ebx
+  8043bd:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (r->r_next == r->r_peer) {
+  8043c0:	8b 4a 10             	mov    0x10(%edx),%ecx
+  8043c3:	3b 4a 14             	cmp    0x14(%edx),%ecx
+  8043c6:	74 1c                	je     8043e4 <ring_try_front+0x2b>
+	return r->r_data + (idx & (r->r_hdr->rh_nslots - 1)) * r->r_hdr->rh_slotsize;
+  8043c8:	8b 1a                	mov    (%edx),%ebx
+  8043ca:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+  8043d0:	83 e8 01             	sub    $0x1,%eax
+  8043d3:	21 c8                	and    %ecx,%eax
+  8043d5:	0f af 83 84 00 00 00 	imul   0x84(%ebx),%eax
+  8043dc:	03 42 04             	add    0x4(%edx),%eax
+		r->r_peer = r->r_hdr->rh_head;
+		if (r->r_next == r->r_peer)
+			return NULL;
+	}
+	return ring_slot(r, r->r_next);
+}
+  8043df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043e2:	c9                   	leave
+  8043e3:	c3                   	ret
+		r->r_peer = r->r_hdr->rh_head;
+  8043e4:	8b 02                	mov    (%edx),%eax
+  8043e6:	8b 00                	mov    (%eax),%eax
+  8043e8:	89 42 14             	mov    %eax,0x14(%edx)
+		if (r->r_next == r->r_peer)
+  8043eb:	39 c1                	cmp    %eax,%ecx
+  8043ed:	75 d9                	jne    8043c8 <ring_try_front+0xf>
+			return NULL;
+  8043ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f4:	eb e9                	jmp    8043df <ring_try_front+0x26>
+
+008043f6 <ring_front>:
+
+// Consumer: return the oldest published slot, sleeping while there is none.
+void *
+ring_front(struct Ring *r)
+{
+  8043f6:	55                   	push   %ebp
+  8043f7:	89 e5                	mov    %esp,%ebp
+  8043f9:	57                   	push   %edi
+  8043fa:	56                   	push   %esi
+  8043fb:	53                   	push   %ebx
+  8043fc:	83 ec 0c             	sub    $0xc,%esp
+  8043ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  804402:	bf 01 00 00 00       	mov    $0x1,%edi
+	void *slot;
+
+	while ((slot = ring_try_front(r)) == NULL)
+  804407:	eb 07                	jmp    804410 <ring_front+0x1a>
+	*idle = 0;
+  804409:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+	while ((slot = ring_try_front(r)) == NULL)
+  804410:	83 ec 0c             	sub    $0xc,%esp
+  804413:	56                   	push   %esi
+  804414:	e8 a0 ff ff ff       	call   8043b9 <ring_try_front>
+  804419:	83 c4 10             	add    $0x10,%esp
+  80441c:	85 c0                	test   %eax,%eax
+  80441e:	75 2e                	jne    80444e <ring_front+0x58>
+		ring_sleep(r, &r->r_hdr->rh_cons_idle, &r->r_hdr->rh_head);
+  804420:	8b 1e                	mov    (%esi),%ebx
+	ring_flush(r);
+  804422:	83 ec 0c             	sub    $0xc,%esp
+  804425:	56                   	push   %esi
+  804426:	e8 5e fe ff ff       	call   804289 <ring_flush>
+  80442b:	89 f8                	mov    %edi,%eax
+  80442d:	f0 87 43 44          	lock xchg %eax,0x44(%ebx)
+	if (*index == r->r_peer)
+  804431:	8b 13                	mov    (%ebx),%edx
+  804433:	8b 46 14             	mov    0x14(%esi),%eax
+  804436:	83 c4 10             	add    $0x10,%esp
+  804439:	39 c2                	cmp    %eax,%edx
+  80443b:	75 cc                	jne    804409 <ring_front+0x13>
+		sys_futex_wait(index, r->r_peer, 0);
+  80443d:	83 ec 04             	sub    $0x4,%esp
+  804440:	6a 00                	push   $0x0
+  804442:	50                   	push   %eax
+  804443:	53                   	push   %ebx
+  804444:	e8 37 cd ff ff       	call   801180 <sys_futex_wait>
+  804449:	83 c4 10             	add    $0x10,%esp
+  80444c:	eb bb                	jmp    804409 <ring_front+0x13>
+	return slot;
+}
+  80444e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804451:	5b                   	pop    %ebx
+  804452:	5e                   	pop    %esi
+  804453:	5f                   	pop    %edi
+  804454:	5d                   	pop    %ebp
+  804455:	c3                   	ret
+
+00804456 <ring_pop>:
+
+// Consumer: give the slot returned by ring_front back to the producer.
+void
+ring_pop(struct Ring *r)
+{
+  804456:	55                   	push   %ebp
+  804457:	89 e5                	mov    %esp,%ebp
+  804459:	83 ec 08             	sub    $0x8,%esp
+  80445c:	8b 55 08             	mov    0x8(%ebp),%edx
+	r->r_next++;
+  80445f:	8b 42 10             	mov    0x10(%edx),%eax
+  804462:	83 c0 01             	add    $0x1,%eax
+  804465:	89 42 10             	mov    %eax,0x10(%edx)
+	if (r->r_next - r->r_pub >= r->r_batch)
+  804468:	2b 42 18             	sub    0x18(%edx),%eax
+  80446b:	3b 42 0c             	cmp    0xc(%edx),%eax
+  80446e:	73 02                	jae    804472 <ring_pop+0x1c>
+		ring_flush(r);
+}
+  804470:	c9                   	leave
+  804471:	c3                   	ret
+		ring_flush(r);
+  804472:	83 ec 0c             	sub    $0xc,%esp
+  804475:	52                   	push   %edx
+  804476:	e8 0e fe ff ff       	call   804289 <ring_flush>
+  80447b:	83 c4 10             	add    $0x10,%esp
+}
+  80447e:	eb f0                	jmp    804470 <ring_pop+0x1a>
+
+00804480 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  804480:	55                   	push   %ebp
+  804481:	89 e5                	mov    %esp,%ebp
+  804483:	57                   	push   %edi
+  804484:	56                   	push   %esi
+  804485:	53                   	push   %ebx
+  804486:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  804489:	68 20 70 80 00       	push   $0x807020
+  80448e:	e8 8a f8 ff ff       	call   803d1d <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  804493:	a1 44 70 80 00       	mov    0x807044,%eax
+  804498:	83 c4 10             	add    $0x10,%esp
+  80449b:	85 c0                	test   %eax,%eax
+  80449d:	75 19                	jne    8044b8 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80449f:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  8044a4:	8b 00                	mov    (%eax),%eax
+  8044a6:	8b 40 48             	mov    0x48(%eax),%eax
+  8044a9:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8044ae:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  8044b5:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8044b8:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8044bd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8044c0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8044c7:	8b 40 04             	mov    0x4(%eax),%eax
+  8044ca:	85 c0                	test   %eax,%eax
+  8044cc:	0f 84 e4 00 00 00    	je     8045b6 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8044d2:	83 c3 01             	add    $0x1,%ebx
+  8044d5:	83 fb 20             	cmp    $0x20,%ebx
+  8044d8:	75 e3                	jne    8044bd <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8044da:	83 ec 0c             	sub    $0xc,%esp
+  8044dd:	68 20 70 80 00       	push   $0x807020
+  8044e2:	e8 a3 f8 ff ff       	call   803d8a <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8044e7:	83 c4 10             	add    $0x10,%esp
+  8044ea:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8044ef:	e9 b8 00 00 00       	jmp    8045ac <pthread_create+0x12c>
+  8044f4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8044f7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8044fa:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8044fc:	39 f3                	cmp    %esi,%ebx
+  8044fe:	73 16                	jae    804516 <pthread_create+0x96>
+		va -= PGSIZE;
+  804500:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  804506:	83 ec 08             	sub    $0x8,%esp
+  804509:	56                   	push   %esi
+  80450a:	6a 00                	push   $0x0
+  80450c:	e8 f3 c9 ff ff       	call   800f04 <sys_page_unmap>
+  804511:	83 c4 10             	add    $0x10,%esp
+  804514:	eb e6                	jmp    8044fc <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  804516:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804519:	83 ec 08             	sub    $0x8,%esp
+  80451c:	ff 75 e4             	push   -0x1c(%ebp)
+  80451f:	6a 00                	push   $0x0
+  804521:	e8 de c9 ff ff       	call   800f04 <sys_page_unmap>
+	return r;
+  804526:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  804529:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80452c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804533:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80453a:	eb 70                	jmp    8045ac <pthread_create+0x12c>
+	th->th_fn = fn;
+  80453c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80453f:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804546:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804549:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80454c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80454f:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  804552:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  804559:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80455e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804561:	29 c8                	sub    %ecx,%eax
+  804563:	85 db                	test   %ebx,%ebx
+  804565:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  80456c:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80456f:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  804576:	83 ec 04             	sub    $0x4,%esp
+  804579:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80457e:	29 ca                	sub    %ecx,%edx
+  804580:	52                   	push   %edx
+	*--esp = 0;
+  804581:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  804584:	50                   	push   %eax
+  804585:	68 dd 47 80 00       	push   $0x8047dd
+  80458a:	e8 c5 cc ff ff       	call   801254 <sys_thread_create>
+  80458f:	89 c7                	mov    %eax,%edi
+  804591:	83 c4 10             	add    $0x10,%esp
+  804594:	85 c0                	test   %eax,%eax
+  804596:	78 91                	js     804529 <pthread_create+0xa9>
+	th->th_env = id;
+  804598:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80459b:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8045a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045a5:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8045a7:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8045ac:	89 f8                	mov    %edi,%eax
+  8045ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b1:	5b                   	pop    %ebx
+  8045b2:	5e                   	pop    %esi
+  8045b3:	5f                   	pop    %edi
+  8045b4:	5d                   	pop    %ebp
+  8045b5:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8045b6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8045b9:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8045c0:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8045c7:	83 ec 0c             	sub    $0xc,%esp
+  8045ca:	68 20 70 80 00       	push   $0x807020
+  8045cf:	e8 b6 f7 ff ff       	call   803d8a <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8045d4:	89 d9                	mov    %ebx,%ecx
+  8045d6:	c1 e1 10             	shl    $0x10,%ecx
+  8045d9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8045dc:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8045e1:	29 c8                	sub    %ecx,%eax
+  8045e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8045e6:	c1 e8 16             	shr    $0x16,%eax
+  8045e9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8045f0:	83 c4 10             	add    $0x10,%esp
+  8045f3:	a8 01                	test   $0x1,%al
+  8045f5:	74 15                	je     80460c <pthread_create+0x18c>
+  8045f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8045fa:	c1 e8 0c             	shr    $0xc,%eax
+  8045fd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804604:	a8 01                	test   $0x1,%al
+  804606:	0f 85 30 ff ff ff    	jne    80453c <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80460c:	83 ec 04             	sub    $0x4,%esp
+  80460f:	6a 07                	push   $0x7
+  804611:	ff 75 e4             	push   -0x1c(%ebp)
+  804614:	6a 00                	push   $0x0
+  804616:	e8 50 c8 ff ff       	call   800e6b <sys_page_alloc>
+  80461b:	89 c7                	mov    %eax,%edi
+  80461d:	83 c4 10             	add    $0x10,%esp
+  804620:	85 c0                	test   %eax,%eax
+  804622:	0f 88 01 ff ff ff    	js     804529 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  804628:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80462d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804630:	29 d0                	sub    %edx,%eax
+  804632:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804635:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804637:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80463c:	29 d0                	sub    %edx,%eax
+  80463e:	89 c7                	mov    %eax,%edi
+  804640:	39 fe                	cmp    %edi,%esi
+  804642:	0f 83 f4 fe ff ff    	jae    80453c <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804648:	83 ec 04             	sub    $0x4,%esp
+  80464b:	6a 07                	push   $0x7
+  80464d:	56                   	push   %esi
+  80464e:	6a 00                	push   $0x0
+  804650:	e8 16 c8 ff ff       	call   800e6b <sys_page_alloc>
+  804655:	83 c4 10             	add    $0x10,%esp
+  804658:	85 c0                	test   %eax,%eax
+  80465a:	0f 88 94 fe ff ff    	js     8044f4 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804660:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804666:	eb d8                	jmp    804640 <pthread_create+0x1c0>
+
+00804668 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  804668:	55                   	push   %ebp
+  804669:	89 e5                	mov    %esp,%ebp
+  80466b:	57                   	push   %edi
+  80466c:	56                   	push   %esi
+  80466d:	53                   	push   %ebx
+  80466e:	83 ec 0c             	sub    $0xc,%esp
+  804671:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  804674:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804677:	83 f8 1e             	cmp    $0x1e,%eax
+  80467a:	0f 87 c7 00 00 00    	ja     804747 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804680:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804682:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804688:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80468d:	77 12                	ja     8046a1 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80468f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804694:	29 d0                	sub    %edx,%eax
+  804696:	c1 e8 10             	shr    $0x10,%eax
+  804699:	39 c3                	cmp    %eax,%ebx
+  80469b:	0f 84 ad 00 00 00    	je     80474e <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8046a1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8046a4:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8046ab:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8046b2:	eb 10                	jmp    8046c4 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8046b4:	83 ec 04             	sub    $0x4,%esp
+  8046b7:	6a 00                	push   $0x0
+  8046b9:	6a 01                	push   $0x1
+  8046bb:	57                   	push   %edi
+  8046bc:	e8 bf ca ff ff       	call   801180 <sys_futex_wait>
+  8046c1:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8046c4:	8b 46 04             	mov    0x4(%esi),%eax
+  8046c7:	83 f8 01             	cmp    $0x1,%eax
+  8046ca:	74 e8                	je     8046b4 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8046cc:	83 f8 02             	cmp    $0x2,%eax
+  8046cf:	0f 85 80 00 00 00    	jne    804755 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8046d5:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8046d8:	c1 e6 02             	shl    $0x2,%esi
+  8046db:	eb 05                	jmp    8046e2 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8046dd:	e8 5d c7 ff ff       	call   800e3f <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8046e2:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8046e8:	89 ca                	mov    %ecx,%edx
+  8046ea:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8046f0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8046f3:	c1 e0 04             	shl    $0x4,%eax
+  8046f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046fb:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8046fe:	39 c1                	cmp    %eax,%ecx
+  804700:	75 12                	jne    804714 <pthread_join+0xac>
+  804702:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804705:	c1 e0 04             	shl    $0x4,%eax
+  804708:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80470d:	8b 40 54             	mov    0x54(%eax),%eax
+  804710:	85 c0                	test   %eax,%eax
+  804712:	75 c9                	jne    8046dd <pthread_join+0x75>
+	if (ret_store)
+  804714:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804718:	74 0f                	je     804729 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  80471a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80471d:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804724:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804727:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804729:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80472c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804733:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80473a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80473f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804742:	5b                   	pop    %ebx
+  804743:	5e                   	pop    %esi
+  804744:	5f                   	pop    %edi
+  804745:	5d                   	pop    %ebp
+  804746:	c3                   	ret
+		return -E_INVAL;
+  804747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80474c:	eb f1                	jmp    80473f <pthread_join+0xd7>
+  80474e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804753:	eb ea                	jmp    80473f <pthread_join+0xd7>
+		return -E_INVAL;
+  804755:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80475a:	eb e3                	jmp    80473f <pthread_join+0xd7>
+
+0080475c <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80475c:	55                   	push   %ebp
+  80475d:	89 e5                	mov    %esp,%ebp
+  80475f:	53                   	push   %ebx
+  804760:	83 ec 04             	sub    $0x4,%esp
+  804763:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804765:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80476b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804770:	77 0c                	ja     80477e <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804772:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804777:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804779:	c1 e8 10             	shr    $0x10,%eax
+  80477c:	75 0a                	jne    804788 <pthread_exit+0x2c>
+		exit();
+  80477e:	e8 c3 bb ff ff       	call   800346 <exit>
+  804783:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804788:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80478f:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804792:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  804799:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80479c:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80479f:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8047a6:	83 ec 08             	sub    $0x8,%esp
+  8047a9:	6a 20                	push   $0x20
+  8047ab:	01 c2                	add    %eax,%edx
+  8047ad:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8047b4:	50                   	push   %eax
+  8047b5:	e8 f5 c9 ff ff       	call   8011af <sys_futex_wake>
+	sys_env_destroy(0);
+  8047ba:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8047c1:	e8 02 c6 ff ff       	call   800dc8 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8047c6:	83 c4 0c             	add    $0xc,%esp
+  8047c9:	68 c0 56 80 00       	push   $0x8056c0
+  8047ce:	68 a5 00 00 00       	push   $0xa5
+  8047d3:	68 da 56 80 00       	push   $0x8056da
+  8047d8:	e8 91 bb ff ff       	call   80036e <_panic>
+
+008047dd <pthread_start>:
+{
+  8047dd:	55                   	push   %ebp
+  8047de:	89 e5                	mov    %esp,%ebp
+  8047e0:	53                   	push   %ebx
+  8047e1:	83 ec 04             	sub    $0x4,%esp
+  8047e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8047e7:	e8 27 c6 ff ff       	call   800e13 <sys_getenvid>
+  8047ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8047f1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8047f7:	85 db                	test   %ebx,%ebx
+  8047f9:	74 0c                	je     804807 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8047fb:	89 d9                	mov    %ebx,%ecx
+  8047fd:	c1 e1 10             	shl    $0x10,%ecx
+  804800:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804805:	29 ca                	sub    %ecx,%edx
+  804807:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80480a:	c1 e0 04             	shl    $0x4,%eax
+  80480d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804812:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804814:	83 ec 0c             	sub    $0xc,%esp
+  804817:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80481e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804821:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804828:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80482f:	89 04 24             	mov    %eax,(%esp)
+  804832:	e8 25 ff ff ff       	call   80475c <pthread_exit>
+
+00804837 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804837:	55                   	push   %ebp
+  804838:	89 e5                	mov    %esp,%ebp
+  80483a:	57                   	push   %edi
+  80483b:	56                   	push   %esi
+  80483c:	53                   	push   %ebx
+  80483d:	83 ec 1c             	sub    $0x1c,%esp
+  804840:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804842:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804848:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80484f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804854:	77 0d                	ja     804863 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804856:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80485b:	29 d0                	sub    %edx,%eax
+  80485d:	c1 e8 10             	shr    $0x10,%eax
+  804860:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804863:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804868:	eb 2f                	jmp    804899 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80486a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804870:	8b 01                	mov    (%ecx),%eax
+  804872:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804875:	39 c2                	cmp    %eax,%edx
+  804877:	75 14                	jne    80488d <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804879:	83 ec 0c             	sub    $0xc,%esp
+  80487c:	57                   	push   %edi
+  80487d:	e8 46 c5 ff ff       	call   800dc8 <sys_env_destroy>
+  804882:	83 c4 10             	add    $0x10,%esp
+  804885:	85 c0                	test   %eax,%eax
+  804887:	0f 88 97 00 00 00    	js     804924 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80488d:	83 c3 01             	add    $0x1,%ebx
+  804890:	83 fb 20             	cmp    $0x20,%ebx
+  804893:	0f 84 d2 00 00 00    	je     80496b <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804899:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80489c:	74 ef                	je     80488d <pthread_kill_others+0x56>
+  80489e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8048a1:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8048a8:	8b 40 04             	mov    0x4(%eax),%eax
+  8048ab:	83 f8 01             	cmp    $0x1,%eax
+  8048ae:	75 dd                	jne    80488d <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8048b0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8048b3:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8048ba:	89 fe                	mov    %edi,%esi
+  8048bc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8048c2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8048c5:	c1 e0 04             	shl    $0x4,%eax
+  8048c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8048cd:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8048d0:	39 c7                	cmp    %eax,%edi
+  8048d2:	75 b9                	jne    80488d <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8048d4:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8048d7:	c1 e0 04             	shl    $0x4,%eax
+  8048da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8048df:	8b 40 54             	mov    0x54(%eax),%eax
+  8048e2:	85 c0                	test   %eax,%eax
+  8048e4:	74 a7                	je     80488d <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8048e6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8048e9:	c1 e0 04             	shl    $0x4,%eax
+  8048ec:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8048f2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048f4:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8048fa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048ff:	0f 87 65 ff ff ff    	ja     80486a <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804905:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80490a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80490c:	c1 e8 10             	shr    $0x10,%eax
+  80490f:	0f 84 55 ff ff ff    	je     80486a <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804915:	c1 e0 10             	shl    $0x10,%eax
+  804918:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80491d:	29 c1                	sub    %eax,%ecx
+  80491f:	e9 4c ff ff ff       	jmp    804870 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804924:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804927:	c1 e2 04             	shl    $0x4,%edx
+  80492a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804930:	8b 52 48             	mov    0x48(%edx),%edx
+  804933:	39 fa                	cmp    %edi,%edx
+  804935:	0f 85 52 ff ff ff    	jne    80488d <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80493b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80493e:	c1 e2 04             	shl    $0x4,%edx
+  804941:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804947:	8b 52 54             	mov    0x54(%edx),%edx
+  80494a:	85 d2                	test   %edx,%edx
+  80494c:	0f 84 3b ff ff ff    	je     80488d <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804952:	83 ec 0c             	sub    $0xc,%esp
+  804955:	50                   	push   %eax
+  804956:	57                   	push   %edi
+  804957:	68 e8 56 80 00       	push   $0x8056e8
+  80495c:	68 bb 00 00 00       	push   $0xbb
+  804961:	68 da 56 80 00       	push   $0x8056da
+  804966:	e8 03 ba ff ff       	call   80036e <_panic>
+	}
+}
+  80496b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80496e:	5b                   	pop    %ebx
+  80496f:	5e                   	pop    %esi
+  804970:	5f                   	pop    %edi
+  804971:	5d                   	pop    %ebp
+  804972:	c3                   	ret
+
+00804973 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804973:	55                   	push   %ebp
+  804974:	89 e5                	mov    %esp,%ebp
+  804976:	53                   	push   %ebx
+  804977:	83 ec 04             	sub    $0x4,%esp
+  80497a:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80497c:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804982:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804988:	0f 87 85 00 00 00    	ja     804a13 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80498e:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804993:	29 c3                	sub    %eax,%ebx
+  804995:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804998:	83 ec 04             	sub    $0x4,%esp
+  80499b:	68 80 02 00 00       	push   $0x280
+  8049a0:	6a 00                	push   $0x0
+  8049a2:	68 40 70 80 00       	push   $0x807040
+  8049a7:	e8 d2 c1 ff ff       	call   800b7e <memset>
+	threads_mu.m_state = 0;
+  8049ac:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8049b3:	00 00 00 
+	if (self != 0) {
+  8049b6:	83 c4 10             	add    $0x10,%esp
+  8049b9:	85 db                	test   %ebx,%ebx
+  8049bb:	74 51                	je     804a0e <pthread_fork_child+0x9b>
+  8049bd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8049bf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8049c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8049ca:	77 18                	ja     8049e4 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8049cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8049d1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8049d3:	c1 e8 10             	shr    $0x10,%eax
+  8049d6:	74 0c                	je     8049e4 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8049d8:	c1 e0 10             	shl    $0x10,%eax
+  8049db:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8049e0:	29 c2                	sub    %eax,%edx
+  8049e2:	eb 06                	jmp    8049ea <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8049e4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8049ea:	8b 02                	mov    (%edx),%eax
+  8049ec:	8b 48 48             	mov    0x48(%eax),%ecx
+  8049ef:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8049f6:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8049f9:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804a00:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804a07:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a11:	c9                   	leave
+  804a12:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804a13:	83 ec 04             	sub    $0x4,%esp
+  804a16:	68 80 02 00 00       	push   $0x280
+  804a1b:	6a 00                	push   $0x0
+  804a1d:	68 40 70 80 00       	push   $0x807040
+  804a22:	e8 57 c1 ff ff       	call   800b7e <memset>
+	threads_mu.m_state = 0;
+  804a27:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804a2e:	00 00 00 
+  804a31:	83 c4 10             	add    $0x10,%esp
+  804a34:	eb d8                	jmp    804a0e <pthread_fork_child+0x9b>
+
+00804a36 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a3b:	c3                   	ret
+
+00804a3c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804a3c:	55                   	push   %ebp
+  804a3d:	89 e5                	mov    %esp,%ebp
+  804a3f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804a42:	68 0d 57 80 00       	push   $0x80570d
+  804a47:	ff 75 0c             	push   0xc(%ebp)
+  804a4a:	e8 de bf ff ff       	call   800a2d <strcpy>
+	return 0;
+}
+  804a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a54:	c9                   	leave
+  804a55:	c3                   	ret
+
+00804a56 <devcons_write>:
+{
+  804a56:	55                   	push   %ebp
+  804a57:	89 e5                	mov    %esp,%ebp
+  804a59:	57                   	push   %edi
+  804a5a:	56                   	push   %esi
+  804a5b:	53                   	push   %ebx
+  804a5c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804a62:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804a67:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804a6d:	eb 2e                	jmp    804a9d <devcons_write+0x47>
+		m = n - tot;
+  804a6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804a72:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804a74:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804a79:	39 c3                	cmp    %eax,%ebx
+  804a7b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804a7e:	83 ec 04             	sub    $0x4,%esp
+  804a81:	53                   	push   %ebx
+  804a82:	89 f0                	mov    %esi,%eax
+  804a84:	03 45 0c             	add    0xc(%ebp),%eax
+  804a87:	50                   	push   %eax
+  804a88:	57                   	push   %edi
+  804a89:	e8 25 c1 ff ff       	call   800bb3 <memmove>
+		sys_cputs(buf, m);
+  804a8e:	83 c4 08             	add    $0x8,%esp
+  804a91:	53                   	push   %ebx
+  804a92:	57                   	push   %edi
+  804a93:	e8 d9 c2 ff ff       	call   800d71 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804a98:	01 de                	add    %ebx,%esi
+  804a9a:	83 c4 10             	add    $0x10,%esp
+  804a9d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804aa0:	72 cd                	jb     804a6f <devcons_write+0x19>
+}
+  804aa2:	89 f0                	mov    %esi,%eax
+  804aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804aa7:	5b                   	pop    %ebx
+  804aa8:	5e                   	pop    %esi
+  804aa9:	5f                   	pop    %edi
+  804aaa:	5d                   	pop    %ebp
+  804aab:	c3                   	ret
+
+00804aac <devcons_read>:
+{
+  804aac:	55                   	push   %ebp
+  804aad:	89 e5                	mov    %esp,%ebp
+  804aaf:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804abb:	75 07                	jne    804ac4 <devcons_read+0x18>
+  804abd:	eb 1f                	jmp    804ade <devcons_read+0x32>
+		sys_yield();
+  804abf:	e8 7b c3 ff ff       	call   800e3f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804ac4:	e8 d3 c2 ff ff       	call   800d9c <sys_cgetc>
+  804ac9:	85 c0                	test   %eax,%eax
+  804acb:	74 f2                	je     804abf <devcons_read+0x13>
+	if (c < 0)
+  804acd:	78 0f                	js     804ade <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804acf:	83 f8 04             	cmp    $0x4,%eax
+  804ad2:	74 0c                	je     804ae0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804ad7:	88 02                	mov    %al,(%edx)
+	return 1;
+  804ad9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804ade:	c9                   	leave
+  804adf:	c3                   	ret
+		return 0;
+  804ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae5:	eb f7                	jmp    804ade <devcons_read+0x32>
+
+00804ae7 <cputchar>:
+{
+  804ae7:	55                   	push   %ebp
+  804ae8:	89 e5                	mov    %esp,%ebp
+  804aea:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  804af0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804af3:	6a 01                	push   $0x1
+  804af5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804af8:	50                   	push   %eax
+  804af9:	e8 73 c2 ff ff       	call   800d71 <sys_cputs>
+}
+  804afe:	83 c4 10             	add    $0x10,%esp
+  804b01:	c9                   	leave
+  804b02:	c3                   	ret
+
+00804b03 <getchar>:
+{
+  804b03:	55                   	push   %ebp
+  804b04:	89 e5                	mov    %esp,%ebp
+  804b06:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804b09:	6a 01                	push   $0x1
+  804b0b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804b0e:	50                   	push   %eax
+  804b0f:	6a 00                	push   $0x0
+  804b11:	e8 05 d3 ff ff       	call   801e1b <read>
+	if (r < 0)
+  804b16:	83 c4 10             	add    $0x10,%esp
+  804b19:	85 c0                	test   %eax,%eax
+  804b1b:	78 06                	js     804b23 <getchar+0x20>
+	if (r < 1)
+  804b1d:	74 06                	je     804b25 <getchar+0x22>
+	return c;
+  804b1f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804b23:	c9                   	leave
+  804b24:	c3                   	ret
+		return -E_EOF;
+  804b25:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804b2a:	eb f7                	jmp    804b23 <getchar+0x20>
+
+00804b2c <iscons>:
+{
+  804b2c:	55                   	push   %ebp
+  804b2d:	89 e5                	mov    %esp,%ebp
+  804b2f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804b35:	50                   	push   %eax
+  804b36:	ff 75 08             	push   0x8(%ebp)
+  804b39:	e8 4d d0 ff ff       	call   801b8b <fd_lookup>
+  804b3e:	83 c4 10             	add    $0x10,%esp
+  804b41:	85 c0                	test   %eax,%eax
+  804b43:	78 11                	js     804b56 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804b45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804b48:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804b4e:	39 10                	cmp    %edx,(%eax)
+  804b50:	0f 94 c0             	sete   %al
+  804b53:	0f b6 c0             	movzbl %al,%eax
+}
+  804b56:	c9                   	leave
+  804b57:	c3                   	ret
+
+00804b58 <opencons>:
+{
+  804b58:	55                   	push   %ebp
+  804b59:	89 e5                	mov    %esp,%ebp
+  804b5b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804b5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804b61:	50                   	push   %eax
+  804b62:	e8 ce cf ff ff       	call   801b35 <fd_alloc>
+  804b67:	83 c4 10             	add    $0x10,%esp
+  804b6a:	85 c0                	test   %eax,%eax
+  804b6c:	78 3a                	js     804ba8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804b6e:	83 ec 04             	sub    $0x4,%esp
+  804b71:	68 07 04 00 00       	push   $0x407
+  804b76:	ff 75 f4             	push   -0xc(%ebp)
+  804b79:	6a 00                	push   $0x0
+  804b7b:	e8 eb c2 ff ff       	call   800e6b <sys_page_alloc>
+  804b80:	83 c4 10             	add    $0x10,%esp
+  804b83:	85 c0                	test   %eax,%eax
+  804b85:	78 21                	js     804ba8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804b87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804b8a:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804b90:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804b92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804b95:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804b9c:	83 ec 0c             	sub    $0xc,%esp
+  804b9f:	50                   	push   %eax
+  804ba0:	e8 69 cf ff ff       	call   801b0e <fd2num>
+  804ba5:	83 c4 10             	add    $0x10,%esp
+}
+  804ba8:	c9                   	leave
+  804ba9:	c3                   	ret
+
+00804baa <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804baa:	55                   	push   %ebp
+  804bab:	89 e5                	mov    %esp,%ebp
+  804bad:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804bb0:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804bb7:	74 0a                	je     804bc3 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  804bbc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804bc1:	c9                   	leave
+  804bc2:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804bc3:	83 ec 04             	sub    $0x4,%esp
+  804bc6:	6a 07                	push   $0x7
+  804bc8:	68 00 f0 bf ee       	push   $0xeebff000
+  804bcd:	6a 00                	push   $0x0
+  804bcf:	e8 97 c2 ff ff       	call   800e6b <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804bd4:	83 c4 08             	add    $0x8,%esp
+  804bd7:	68 e8 4b 80 00       	push   $0x804be8
+  804bdc:	6a 00                	push   $0x0
+  804bde:	e8 05 c4 ff ff       	call   800fe8 <sys_env_set_pgfault_upcall>
+  804be3:	83 c4 10             	add    $0x10,%esp
+  804be6:	eb d1                	jmp    804bb9 <set_pgfault_handler+0xf>
+
+00804be8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804be8:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804be9:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804bee:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804bf0:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804bf3:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804bf7:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804bfb:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804bfe:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804c02:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804c04:	83 c4 08             	add    $0x8,%esp
+	popal
+  804c07:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804c08:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804c0b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804c0c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804c0d:	c3                   	ret
+
+00804c0e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804c0e:	55                   	push   %ebp
+  804c0f:	89 e5                	mov    %esp,%ebp
+  804c11:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804c14:	89 c2                	mov    %eax,%edx
+  804c16:	c1 ea 16             	shr    $0x16,%edx
+  804c19:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804c20:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804c25:	f6 c1 01             	test   $0x1,%cl
+  804c28:	74 1c                	je     804c46 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804c2a:	c1 e8 0c             	shr    $0xc,%eax
+  804c2d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804c34:	a8 01                	test   $0x1,%al
+  804c36:	74 0e                	je     804c46 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804c38:	c1 e8 0c             	shr    $0xc,%eax
+  804c3b:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804c42:	ef 
+  804c43:	0f b7 d2             	movzwl %dx,%edx
+}
+  804c46:	89 d0                	mov    %edx,%eax
+  804c48:	5d                   	pop    %ebp
+  804c49:	c3                   	ret
+
+00804c4a <udm>:
+  804c4a:	57                   	push   %edi
+  804c4b:	56                   	push   %esi
+  804c4c:	53                   	push   %ebx
+  804c4d:	83 ec 20             	sub    $0x20,%esp
+  804c50:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804c54:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804c58:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804c5c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804c60:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804c64:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804c68:	89 d1                	mov    %edx,%ecx
+  804c6a:	09 c1                	or     %eax,%ecx
+  804c6c:	0f 84 91 00 00 00    	je     804d03 <udm+0xb9>
+  804c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c77:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c7c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c81:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c88:	00 
+  804c89:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c90:	00 
+  804c91:	eb 08                	jmp    804c9b <udm+0x51>
+  804c93:	83 e9 01             	sub    $0x1,%ecx
+  804c96:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c99:	74 7c                	je     804d17 <udm+0xcd>
+  804c9b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c9f:	01 c0                	add    %eax,%eax
+  804ca1:	89 c6                	mov    %eax,%esi
+  804ca3:	89 d7                	mov    %edx,%edi
+  804ca5:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804ca9:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804cad:	0f ad d0             	shrd   %cl,%edx,%eax
+  804cb0:	d3 ea                	shr    %cl,%edx
+  804cb2:	f6 c1 20             	test   $0x20,%cl
+  804cb5:	74 04                	je     804cbb <udm+0x71>
+  804cb7:	89 d0                	mov    %edx,%eax
+  804cb9:	31 d2                	xor    %edx,%edx
+  804cbb:	83 e0 01             	and    $0x1,%eax
+  804cbe:	89 04 24             	mov    %eax,(%esp)
+  804cc1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804cc8:	00 
+  804cc9:	8b 04 24             	mov    (%esp),%eax
+  804ccc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804cd0:	09 f0                	or     %esi,%eax
+  804cd2:	09 fa                	or     %edi,%edx
+  804cd4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804cd8:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804cdc:	39 f0                	cmp    %esi,%eax
+  804cde:	89 d3                	mov    %edx,%ebx
+  804ce0:	19 fb                	sbb    %edi,%ebx
+  804ce2:	72 af                	jb     804c93 <udm+0x49>
+  804ce4:	29 f0                	sub    %esi,%eax
+  804ce6:	19 fa                	sbb    %edi,%edx
+  804ce8:	89 cf                	mov    %ecx,%edi
+  804cea:	c1 ef 05             	shr    $0x5,%edi
+  804ced:	83 e7 01             	and    $0x1,%edi
+  804cf0:	89 fe                	mov    %edi,%esi
+  804cf2:	83 f6 01             	xor    $0x1,%esi
+  804cf5:	d3 e6                	shl    %cl,%esi
+  804cf7:	d3 e7                	shl    %cl,%edi
+  804cf9:	09 74 24 18          	or     %esi,0x18(%esp)
+  804cfd:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804d01:	eb 90                	jmp    804c93 <udm+0x49>
+  804d03:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804d07:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804d0b:	89 f0                	mov    %esi,%eax
+  804d0d:	89 fa                	mov    %edi,%edx
+  804d0f:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804d13:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804d17:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804d1b:	89 01                	mov    %eax,(%ecx)
+  804d1d:	89 51 04             	mov    %edx,0x4(%ecx)
+  804d20:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d24:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d28:	83 c4 20             	add    $0x20,%esp
+  804d2b:	5b                   	pop    %ebx
+  804d2c:	5e                   	pop    %esi
+  804d2d:	5f                   	pop    %edi
+  804d2e:	c3                   	ret
+
+00804d2f <__udivdi3>:
+  804d2f:	83 ec 18             	sub    $0x18,%esp
+  804d32:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d36:	50                   	push   %eax
+  804d37:	ff 74 24 2c          	push   0x2c(%esp)
+  804d3b:	ff 74 24 2c          	push   0x2c(%esp)
+  804d3f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d43:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d47:	e8 fe fe ff ff       	call   804c4a <udm>
+  804d4c:	83 c4 24             	add    $0x24,%esp
+  804d4f:	c3                   	ret
+
+00804d50 <__umoddi3>:
+  804d50:	83 ec 18             	sub    $0x18,%esp
+  804d53:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d57:	50                   	push   %eax
+  804d58:	ff 74 24 2c          	push   0x2c(%esp)
+  804d5c:	ff 74 24 2c          	push   0x2c(%esp)
+  804d60:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d64:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d68:	e8 dd fe ff ff       	call   804c4a <udm>
+  804d6d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d71:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d75:	83 c4 24             	add    $0x24,%esp
+  804d78:	c3                   	ret
+
+00804d79 <__divdi3>:
+  804d79:	56                   	push   %esi
+  804d7a:	53                   	push   %ebx
+  804d7b:	83 ec 14             	sub    $0x14,%esp
+  804d7e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804d82:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804d86:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804d8a:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804d8e:	85 d2                	test   %edx,%edx
+  804d90:	78 18                	js     804daa <__divdi3+0x31>
+  804d92:	85 db                	test   %ebx,%ebx
+  804d94:	78 3e                	js     804dd4 <__divdi3+0x5b>
+  804d96:	83 ec 04             	sub    $0x4,%esp
+  804d99:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d9d:	56                   	push   %esi
+  804d9e:	53                   	push   %ebx
+  804d9f:	51                   	push   %ecx
+  804da0:	e8 a5 fe ff ff       	call   804c4a <udm>
+  804da5:	83 c4 10             	add    $0x10,%esp
+  804da8:	eb 24                	jmp    804dce <__divdi3+0x55>
+  804daa:	f7 d8                	neg    %eax
+  804dac:	83 d2 00             	adc    $0x0,%edx
+  804daf:	f7 da                	neg    %edx
+  804db1:	85 db                	test   %ebx,%ebx
+  804db3:	78 3a                	js     804def <__divdi3+0x76>
+  804db5:	83 ec 04             	sub    $0x4,%esp
+  804db8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804dbc:	56                   	push   %esi
+  804dbd:	53                   	push   %ebx
+  804dbe:	51                   	push   %ecx
+  804dbf:	e8 86 fe ff ff       	call   804c4a <udm>
+  804dc4:	83 c4 10             	add    $0x10,%esp
+  804dc7:	f7 d8                	neg    %eax
+  804dc9:	83 d2 00             	adc    $0x0,%edx
+  804dcc:	f7 da                	neg    %edx
+  804dce:	83 c4 14             	add    $0x14,%esp
+  804dd1:	5b                   	pop    %ebx
+  804dd2:	5e                   	pop    %esi
+  804dd3:	c3                   	ret
+  804dd4:	83 ec 04             	sub    $0x4,%esp
+  804dd7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804ddb:	56                   	push   %esi
+  804ddc:	f7 d9                	neg    %ecx
+  804dde:	83 d3 00             	adc    $0x0,%ebx
+  804de1:	f7 db                	neg    %ebx
+  804de3:	53                   	push   %ebx
+  804de4:	51                   	push   %ecx
+  804de5:	e8 60 fe ff ff       	call   804c4a <udm>
+  804dea:	83 c4 10             	add    $0x10,%esp
+  804ded:	eb d8                	jmp    804dc7 <__divdi3+0x4e>
+  804def:	83 ec 04             	sub    $0x4,%esp
+  804df2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804df6:	56                   	push   %esi
+  804df7:	f7 d9                	neg    %ecx
+  804df9:	83 d3 00             	adc    $0x0,%ebx
+  804dfc:	f7 db                	neg    %ebx
+  804dfe:	53                   	push   %ebx
+  804dff:	51                   	push   %ecx
+  804e00:	e8 45 fe ff ff       	call   804c4a <udm>
+  804e05:	83 c4 10             	add    $0x10,%esp
+  804e08:	eb c4                	jmp    804dce <__divdi3+0x55>
+
+00804e0a <__moddi3>:
+  804e0a:	55                   	push   %ebp
+  804e0b:	57                   	push   %edi
+  804e0c:	56                   	push   %esi
+  804e0d:	53                   	push   %ebx
+  804e0e:	83 ec 24             	sub    $0x24,%esp
+  804e11:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804e15:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804e19:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804e1d:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804e21:	85 d2                	test   %edx,%edx
+  804e23:	78 3b                	js     804e60 <__moddi3+0x56>
+  804e25:	83 ec 04             	sub    $0x4,%esp
+  804e28:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e2c:	56                   	push   %esi
+  804e2d:	89 ce                	mov    %ecx,%esi
+  804e2f:	f7 de                	neg    %esi
+  804e31:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804e35:	89 de                	mov    %ebx,%esi
+  804e37:	83 d6 00             	adc    $0x0,%esi
+  804e3a:	f7 de                	neg    %esi
+  804e3c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804e40:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804e44:	0f 48 f1             	cmovs  %ecx,%esi
+  804e47:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804e4c:	53                   	push   %ebx
+  804e4d:	56                   	push   %esi
+  804e4e:	e8 f7 fd ff ff       	call   804c4a <udm>
+  804e53:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e57:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e5b:	83 c4 10             	add    $0x10,%esp
+  804e5e:	eb 47                	jmp    804ea7 <__moddi3+0x9d>
+  804e60:	f7 d8                	neg    %eax
+  804e62:	83 d2 00             	adc    $0x0,%edx
+  804e65:	f7 da                	neg    %edx
+  804e67:	83 ec 04             	sub    $0x4,%esp
+  804e6a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e6e:	56                   	push   %esi
+  804e6f:	89 cf                	mov    %ecx,%edi
+  804e71:	f7 df                	neg    %edi
+  804e73:	89 de                	mov    %ebx,%esi
+  804e75:	83 d6 00             	adc    $0x0,%esi
+  804e78:	f7 de                	neg    %esi
+  804e7a:	0f 49 cf             	cmovns %edi,%ecx
+  804e7d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804e81:	0f 49 de             	cmovns %esi,%ebx
+  804e84:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804e88:	ff 74 24 0c          	push   0xc(%esp)
+  804e8c:	ff 74 24 0c          	push   0xc(%esp)
+  804e90:	e8 b5 fd ff ff       	call   804c4a <udm>
+  804e95:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e99:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e9d:	f7 d8                	neg    %eax
+  804e9f:	83 d2 00             	adc    $0x0,%edx
+  804ea2:	f7 da                	neg    %edx
+  804ea4:	83 c4 10             	add    $0x10,%esp
+  804ea7:	83 c4 24             	add    $0x24,%esp
+  804eaa:	5b                   	pop    %ebx
+  804eab:	5e                   	pop    %esi
+  804eac:	5f                   	pop    %edi
+  804ead:	5d                   	pop    %ebp
+  804eae:	c3                   	ret
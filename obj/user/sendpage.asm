@@ -0,0 +1,9821 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 a6 13 00 00       	call   8013e4 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	74 32                	je     800077 <umain+0x44>
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800045:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800047:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80004d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800052:	0f 87 c0 00 00 00    	ja     800118 <umain+0xe5>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800058:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80005d:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80005f:	c1 e8 10             	shr    $0x10,%eax
+  800062:	0f 84 b0 00 00 00    	je     800118 <umain+0xe5>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800068:	c1 e0 10             	shl    $0x10,%eax
+  80006b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800070:	29 c2                	sub    %eax,%edx
+  800072:	e9 a7 00 00 00       	jmp    80011e <umain+0xeb>
+		// Child
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  800077:	83 ec 04             	sub    $0x4,%esp
+  80007a:	6a 00                	push   $0x0
+  80007c:	68 00 00 b0 00       	push   $0xb00000
+  800081:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800084:	50                   	push   %eax
+  800085:	e8 b6 17 00 00       	call   801840 <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  80008a:	83 c4 0c             	add    $0xc,%esp
+  80008d:	68 00 00 b0 00       	push   $0xb00000
+  800092:	ff 75 f4             	push   -0xc(%ebp)
+  800095:	68 60 48 80 00       	push   $0x804860
+  80009a:	e8 67 02 00 00       	call   800306 <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  80009f:	83 c4 04             	add    $0x4,%esp
+  8000a2:	ff 35 04 60 80 00    	push   0x806004
+  8000a8:	e8 02 08 00 00       	call   8008af <strlen>
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	50                   	push   %eax
+  8000b1:	ff 35 04 60 80 00    	push   0x806004
+  8000b7:	68 00 00 b0 00       	push   $0xb00000
+  8000bc:	e8 00 09 00 00       	call   8009c1 <strncmp>
+  8000c1:	83 c4 10             	add    $0x10,%esp
+  8000c4:	85 c0                	test   %eax,%eax
+  8000c6:	74 3e                	je     800106 <umain+0xd3>
+			cprintf("child received correct message\n");
+
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	ff 35 00 60 80 00    	push   0x806000
+  8000d1:	e8 d9 07 00 00       	call   8008af <strlen>
+  8000d6:	83 c4 0c             	add    $0xc,%esp
+  8000d9:	83 c0 01             	add    $0x1,%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	ff 35 00 60 80 00    	push   0x806000
+  8000e3:	68 00 00 b0 00       	push   $0xb00000
+  8000e8:	e8 e5 09 00 00       	call   800ad2 <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  8000ed:	6a 07                	push   $0x7
+  8000ef:	68 00 00 b0 00       	push   $0xb00000
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	ff 75 f4             	push   -0xc(%ebp)
+  8000f9:	e8 38 18 00 00       	call   801936 <ipc_send>
+		return;
+  8000fe:	83 c4 20             	add    $0x20,%esp
+  800101:	e9 b4 00 00 00       	jmp    8001ba <umain+0x187>
+			cprintf("child received correct message\n");
+  800106:	83 ec 0c             	sub    $0xc,%esp
+  800109:	68 74 48 80 00       	push   $0x804874
+  80010e:	e8 f3 01 00 00       	call   800306 <cprintf>
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	eb b0                	jmp    8000c8 <umain+0x95>
+		return pthread_main_tls;
+  800118:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  80011e:	8b 02                	mov    (%edx),%eax
+  800120:	8b 40 48             	mov    0x48(%eax),%eax
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	6a 07                	push   $0x7
+  800128:	68 00 00 a0 00       	push   $0xa00000
+  80012d:	50                   	push   %eax
+  80012e:	e8 f5 0b 00 00       	call   800d28 <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800133:	83 c4 04             	add    $0x4,%esp
+  800136:	ff 35 04 60 80 00    	push   0x806004
+  80013c:	e8 6e 07 00 00       	call   8008af <strlen>
+  800141:	83 c4 0c             	add    $0xc,%esp
+  800144:	83 c0 01             	add    $0x1,%eax
+  800147:	50                   	push   %eax
+  800148:	ff 35 04 60 80 00    	push   0x806004
+  80014e:	68 00 00 a0 00       	push   $0xa00000
+  800153:	e8 7a 09 00 00       	call   800ad2 <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800158:	6a 07                	push   $0x7
+  80015a:	68 00 00 a0 00       	push   $0xa00000
+  80015f:	6a 00                	push   $0x0
+  800161:	ff 75 f4             	push   -0xc(%ebp)
+  800164:	e8 cd 17 00 00       	call   801936 <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800169:	83 c4 1c             	add    $0x1c,%esp
+  80016c:	6a 00                	push   $0x0
+  80016e:	68 00 00 a0 00       	push   $0xa00000
+  800173:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800176:	50                   	push   %eax
+  800177:	e8 c4 16 00 00       	call   801840 <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  80017c:	83 c4 0c             	add    $0xc,%esp
+  80017f:	68 00 00 a0 00       	push   $0xa00000
+  800184:	ff 75 f4             	push   -0xc(%ebp)
+  800187:	68 60 48 80 00       	push   $0x804860
+  80018c:	e8 75 01 00 00       	call   800306 <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  800191:	83 c4 04             	add    $0x4,%esp
+  800194:	ff 35 00 60 80 00    	push   0x806000
+  80019a:	e8 10 07 00 00       	call   8008af <strlen>
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	50                   	push   %eax
+  8001a3:	ff 35 00 60 80 00    	push   0x806000
+  8001a9:	68 00 00 a0 00       	push   $0xa00000
+  8001ae:	e8 0e 08 00 00       	call   8009c1 <strncmp>
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	85 c0                	test   %eax,%eax
+  8001b8:	74 02                	je     8001bc <umain+0x189>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8001ba:	c9                   	leave
+  8001bb:	c3                   	ret
+		cprintf("parent received correct message\n");
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	68 94 48 80 00       	push   $0x804894
+  8001c4:	e8 3d 01 00 00       	call   800306 <cprintf>
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	eb ec                	jmp    8001ba <umain+0x187>
+
+008001ce <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	57                   	push   %edi
+  8001d2:	56                   	push   %esi
+  8001d3:	53                   	push   %ebx
+  8001d4:	83 ec 1c             	sub    $0x1c,%esp
+  8001d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001dd:	e8 ee 0a 00 00       	call   800cd0 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001e2:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001e5:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8001eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f0:	89 c1                	mov    %eax,%ecx
+  8001f2:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001f4:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001fa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001ff:	77 16                	ja     800217 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800201:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800206:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800208:	c1 e8 10             	shr    $0x10,%eax
+  80020b:	74 0a                	je     800217 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80020d:	c1 e0 10             	shl    $0x10,%eax
+  800210:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800215:	29 c2                	sub    %eax,%edx
+  800217:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80021a:	c1 e0 04             	shl    $0x4,%eax
+  80021d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800222:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800224:	85 db                	test   %ebx,%ebx
+  800226:	7e 07                	jle    80022f <libmain+0x61>
+		binaryname = argv[0];
+  800228:	8b 06                	mov    (%esi),%eax
+  80022a:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	// call user main routine
+	umain(argc, argv);
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	e8 fa fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800239:	e8 0b 00 00 00       	call   800249 <exit>
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800244:	5b                   	pop    %ebx
+  800245:	5e                   	pop    %esi
+  800246:	5f                   	pop    %edi
+  800247:	5d                   	pop    %ebp
+  800248:	c3                   	ret
+
+00800249 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800249:	55                   	push   %ebp
+  80024a:	89 e5                	mov    %esp,%ebp
+  80024c:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80024f:	6a 00                	push   $0x0
+  800251:	e8 d0 28 00 00       	call   802b26 <fflush>
+	pthread_kill_others();
+  800256:	e8 3b 3f 00 00       	call   804196 <pthread_kill_others>
+	close_all();
+  80025b:	e8 69 19 00 00       	call   801bc9 <close_all>
+	sys_env_destroy(0);
+  800260:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800267:	e8 19 0a 00 00       	call   800c85 <sys_env_destroy>
+}
+  80026c:	83 c4 10             	add    $0x10,%esp
+  80026f:	c9                   	leave
+  800270:	c3                   	ret
+
+00800271 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	53                   	push   %ebx
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027b:	8b 13                	mov    (%ebx),%edx
+  80027d:	8d 42 01             	lea    0x1(%edx),%eax
+  800280:	89 03                	mov    %eax,(%ebx)
+  800282:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800285:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800289:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028e:	74 09                	je     800299 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800290:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800294:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	68 ff 00 00 00       	push   $0xff
+  8002a1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	e8 84 09 00 00       	call   800c2e <sys_cputs>
+		b->idx = 0;
+  8002aa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	eb db                	jmp    800290 <putch+0x1f>
+
+008002b5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002be:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c5:	00 00 00 
+	b.cnt = 0;
+  8002c8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002cf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d2:	ff 75 0c             	push   0xc(%ebp)
+  8002d5:	ff 75 08             	push   0x8(%ebp)
+  8002d8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	68 71 02 80 00       	push   $0x800271
+  8002e4:	e8 14 01 00 00       	call   8003fd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e9:	83 c4 08             	add    $0x8,%esp
+  8002ec:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f8:	50                   	push   %eax
+  8002f9:	e8 30 09 00 00       	call   800c2e <sys_cputs>
+
+	return b.cnt;
+}
+  8002fe:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800304:	c9                   	leave
+  800305:	c3                   	ret
+
+00800306 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030f:	50                   	push   %eax
+  800310:	ff 75 08             	push   0x8(%ebp)
+  800313:	e8 9d ff ff ff       	call   8002b5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+
+0080031a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031a:	55                   	push   %ebp
+  80031b:	89 e5                	mov    %esp,%ebp
+  80031d:	57                   	push   %edi
+  80031e:	56                   	push   %esi
+  80031f:	53                   	push   %ebx
+  800320:	83 ec 1c             	sub    $0x1c,%esp
+  800323:	89 c7                	mov    %eax,%edi
+  800325:	89 d6                	mov    %edx,%esi
+  800327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032d:	89 d1                	mov    %edx,%ecx
+  80032f:	89 c2                	mov    %eax,%edx
+  800331:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800334:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800337:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800340:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800347:	39 c2                	cmp    %eax,%edx
+  800349:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034c:	72 3e                	jb     80038c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	ff 75 18             	push   0x18(%ebp)
+  800354:	83 eb 01             	sub    $0x1,%ebx
+  800357:	53                   	push   %ebx
+  800358:	50                   	push   %eax
+  800359:	83 ec 08             	sub    $0x8,%esp
+  80035c:	ff 75 e4             	push   -0x1c(%ebp)
+  80035f:	ff 75 e0             	push   -0x20(%ebp)
+  800362:	ff 75 dc             	push   -0x24(%ebp)
+  800365:	ff 75 d8             	push   -0x28(%ebp)
+  800368:	e8 67 43 00 00       	call   8046d4 <__udivdi3>
+  80036d:	83 c4 18             	add    $0x18,%esp
+  800370:	52                   	push   %edx
+  800371:	50                   	push   %eax
+  800372:	89 f2                	mov    %esi,%edx
+  800374:	89 f8                	mov    %edi,%eax
+  800376:	e8 9f ff ff ff       	call   80031a <printnum>
+  80037b:	83 c4 20             	add    $0x20,%esp
+  80037e:	eb 13                	jmp    800393 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800380:	83 ec 08             	sub    $0x8,%esp
+  800383:	56                   	push   %esi
+  800384:	ff 75 18             	push   0x18(%ebp)
+  800387:	ff d7                	call   *%edi
+  800389:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038c:	83 eb 01             	sub    $0x1,%ebx
+  80038f:	85 db                	test   %ebx,%ebx
+  800391:	7f ed                	jg     800380 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800393:	83 ec 08             	sub    $0x8,%esp
+  800396:	56                   	push   %esi
+  800397:	83 ec 04             	sub    $0x4,%esp
+  80039a:	ff 75 e4             	push   -0x1c(%ebp)
+  80039d:	ff 75 e0             	push   -0x20(%ebp)
+  8003a0:	ff 75 dc             	push   -0x24(%ebp)
+  8003a3:	ff 75 d8             	push   -0x28(%ebp)
+  8003a6:	e8 4a 43 00 00       	call   8046f5 <__umoddi3>
+  8003ab:	83 c4 14             	add    $0x14,%esp
+  8003ae:	0f be 80 0c 49 80 00 	movsbl 0x80490c(%eax),%eax
+  8003b5:	50                   	push   %eax
+  8003b6:	ff d7                	call   *%edi
+}
+  8003b8:	83 c4 10             	add    $0x10,%esp
+  8003bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003be:	5b                   	pop    %ebx
+  8003bf:	5e                   	pop    %esi
+  8003c0:	5f                   	pop    %edi
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	c3                   	ret
+
+008003c3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cd:	8b 10                	mov    (%eax),%edx
+  8003cf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d2:	73 0a                	jae    8003de <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d7:	89 08                	mov    %ecx,(%eax)
+  8003d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003dc:	88 02                	mov    %al,(%edx)
+}
+  8003de:	5d                   	pop    %ebp
+  8003df:	c3                   	ret
+
+008003e0 <printfmt>:
+{
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e9:	50                   	push   %eax
+  8003ea:	ff 75 10             	push   0x10(%ebp)
+  8003ed:	ff 75 0c             	push   0xc(%ebp)
+  8003f0:	ff 75 08             	push   0x8(%ebp)
+  8003f3:	e8 05 00 00 00       	call   8003fd <vprintfmt>
+}
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	c9                   	leave
+  8003fc:	c3                   	ret
+
+008003fd <vprintfmt>:
+{
+  8003fd:	55                   	push   %ebp
+  8003fe:	89 e5                	mov    %esp,%ebp
+  800400:	57                   	push   %edi
+  800401:	56                   	push   %esi
+  800402:	53                   	push   %ebx
+  800403:	83 ec 2c             	sub    $0x2c,%esp
+  800406:	8b 75 08             	mov    0x8(%ebp),%esi
+  800409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040f:	eb 0a                	jmp    80041b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	50                   	push   %eax
+  800416:	ff d6                	call   *%esi
+  800418:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80041b:	83 c7 01             	add    $0x1,%edi
+  80041e:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800422:	83 f8 25             	cmp    $0x25,%eax
+  800425:	74 0c                	je     800433 <vprintfmt+0x36>
+			if (ch == '\0')
+  800427:	85 c0                	test   %eax,%eax
+  800429:	75 e6                	jne    800411 <vprintfmt+0x14>
+}
+  80042b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042e:	5b                   	pop    %ebx
+  80042f:	5e                   	pop    %esi
+  800430:	5f                   	pop    %edi
+  800431:	5d                   	pop    %ebp
+  800432:	c3                   	ret
+		padc = ' ';
+  800433:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800437:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80043e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800445:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800451:	8d 47 01             	lea    0x1(%edi),%eax
+  800454:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800457:	0f b6 17             	movzbl (%edi),%edx
+  80045a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045d:	3c 55                	cmp    $0x55,%al
+  80045f:	0f 87 c5 03 00 00    	ja     80082a <vprintfmt+0x42d>
+  800465:	0f b6 c0             	movzbl %al,%eax
+  800468:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  80046f:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800472:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800475:	eb da                	jmp    800451 <vprintfmt+0x54>
+  800477:	0f be d2             	movsbl %dl,%edx
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80047d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800482:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800485:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800488:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80048c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80048f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800492:	83 f9 09             	cmp    $0x9,%ecx
+  800495:	77 55                	ja     8004ec <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800497:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80049a:	eb e9                	jmp    800485 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80049c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049f:	8b 00                	mov    (%eax),%eax
+  8004a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004aa:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b4:	79 9b                	jns    800451 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004b6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004bc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004c3:	eb 8c                	jmp    800451 <vprintfmt+0x54>
+			if (width < 0)
+  8004c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c8:	85 d2                	test   %edx,%edx
+  8004ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cf:	0f 49 c2             	cmovns %edx,%eax
+  8004d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8004d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d8:	e9 74 ff ff ff       	jmp    800451 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8004dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004e0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004e7:	e9 65 ff ff ff       	jmp    800451 <vprintfmt+0x54>
+  8004ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004f2:	eb bc                	jmp    8004b0 <vprintfmt+0xb3>
+			lflag++;
+  8004f4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8004f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004fa:	e9 52 ff ff ff       	jmp    800451 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800502:	8d 78 04             	lea    0x4(%eax),%edi
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	53                   	push   %ebx
+  800509:	ff 30                	push   (%eax)
+  80050b:	ff d6                	call   *%esi
+			break;
+  80050d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800510:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800513:	e9 b1 02 00 00       	jmp    8007c9 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80051e:	8b 10                	mov    (%eax),%edx
+  800520:	89 d0                	mov    %edx,%eax
+  800522:	f7 d8                	neg    %eax
+  800524:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800527:	83 f8 14             	cmp    $0x14,%eax
+  80052a:	7f 23                	jg     80054f <vprintfmt+0x152>
+  80052c:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  800533:	85 d2                	test   %edx,%edx
+  800535:	74 18                	je     80054f <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800537:	52                   	push   %edx
+  800538:	68 43 4e 80 00       	push   $0x804e43
+  80053d:	53                   	push   %ebx
+  80053e:	56                   	push   %esi
+  80053f:	e8 9c fe ff ff       	call   8003e0 <printfmt>
+  800544:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800547:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80054a:	e9 7a 02 00 00       	jmp    8007c9 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80054f:	50                   	push   %eax
+  800550:	68 24 49 80 00       	push   $0x804924
+  800555:	53                   	push   %ebx
+  800556:	56                   	push   %esi
+  800557:	e8 84 fe ff ff       	call   8003e0 <printfmt>
+  80055c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800562:	e9 62 02 00 00       	jmp    8007c9 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800567:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056a:	83 c0 04             	add    $0x4,%eax
+  80056d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800575:	85 c9                	test   %ecx,%ecx
+  800577:	b8 1d 49 80 00       	mov    $0x80491d,%eax
+  80057c:	0f 45 c1             	cmovne %ecx,%eax
+  80057f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800582:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800586:	7e 06                	jle    80058e <vprintfmt+0x191>
+  800588:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80058c:	75 0b                	jne    800599 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800591:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800594:	89 75 08             	mov    %esi,0x8(%ebp)
+  800597:	eb 5c                	jmp    8005f5 <vprintfmt+0x1f8>
+  800599:	83 ec 08             	sub    $0x8,%esp
+  80059c:	ff 75 d0             	push   -0x30(%ebp)
+  80059f:	ff 75 cc             	push   -0x34(%ebp)
+  8005a2:	e8 20 03 00 00       	call   8008c7 <strnlen>
+  8005a7:	89 c2                	mov    %eax,%edx
+  8005a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ac:	29 d0                	sub    %edx,%eax
+  8005ae:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005b1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005bb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005bd:	eb 0e                	jmp    8005cd <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8005bf:	83 ec 08             	sub    $0x8,%esp
+  8005c2:	53                   	push   %ebx
+  8005c3:	57                   	push   %edi
+  8005c4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c7:	83 ee 01             	sub    $0x1,%esi
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	85 f6                	test   %esi,%esi
+  8005cf:	7f ee                	jg     8005bf <vprintfmt+0x1c2>
+  8005d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d7:	85 c0                	test   %eax,%eax
+  8005d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005de:	0f 49 d0             	cmovns %eax,%edx
+  8005e1:	29 d0                	sub    %edx,%eax
+  8005e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e6:	eb a6                	jmp    80058e <vprintfmt+0x191>
+					putch(ch, putdat);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	53                   	push   %ebx
+  8005ec:	52                   	push   %edx
+  8005ed:	ff 55 08             	call   *0x8(%ebp)
+  8005f0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005f3:	89 f1                	mov    %esi,%ecx
+  8005f5:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005f8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005fc:	0f be d0             	movsbl %al,%edx
+  8005ff:	85 d2                	test   %edx,%edx
+  800601:	74 28                	je     80062b <vprintfmt+0x22e>
+  800603:	85 ff                	test   %edi,%edi
+  800605:	78 05                	js     80060c <vprintfmt+0x20f>
+  800607:	83 ef 01             	sub    $0x1,%edi
+  80060a:	78 30                	js     80063c <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80060c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800610:	74 d6                	je     8005e8 <vprintfmt+0x1eb>
+  800612:	0f be c0             	movsbl %al,%eax
+  800615:	83 e8 20             	sub    $0x20,%eax
+  800618:	83 f8 5e             	cmp    $0x5e,%eax
+  80061b:	76 cb                	jbe    8005e8 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	6a 3f                	push   $0x3f
+  800623:	ff 55 08             	call   *0x8(%ebp)
+  800626:	83 c4 10             	add    $0x10,%esp
+  800629:	eb c8                	jmp    8005f3 <vprintfmt+0x1f6>
+  80062b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80062e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800631:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800634:	01 d0                	add    %edx,%eax
+  800636:	29 c8                	sub    %ecx,%eax
+  800638:	89 c7                	mov    %eax,%edi
+  80063a:	eb 13                	jmp    80064f <vprintfmt+0x252>
+  80063c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063f:	eb ed                	jmp    80062e <vprintfmt+0x231>
+				putch(' ', putdat);
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	53                   	push   %ebx
+  800645:	6a 20                	push   $0x20
+  800647:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800649:	83 ef 01             	sub    $0x1,%edi
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	85 ff                	test   %edi,%edi
+  800651:	7f ee                	jg     800641 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800653:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+  800659:	e9 6b 01 00 00       	jmp    8007c9 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80065e:	83 f9 01             	cmp    $0x1,%ecx
+  800661:	7f 1f                	jg     800682 <vprintfmt+0x285>
+	else if (lflag)
+  800663:	85 c9                	test   %ecx,%ecx
+  800665:	74 67                	je     8006ce <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 00                	mov    (%eax),%eax
+  80066c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066f:	89 c1                	mov    %eax,%ecx
+  800671:	c1 f9 1f             	sar    $0x1f,%ecx
+  800674:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800680:	eb 17                	jmp    800699 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 50 04             	mov    0x4(%eax),%edx
+  800688:	8b 00                	mov    (%eax),%eax
+  80068a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8d 40 08             	lea    0x8(%eax),%eax
+  800696:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800699:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80069c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80069f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006a4:	85 c9                	test   %ecx,%ecx
+  8006a6:	0f 89 03 01 00 00    	jns    8007af <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	6a 2d                	push   $0x2d
+  8006b2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006b4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ba:	f7 da                	neg    %edx
+  8006bc:	83 d1 00             	adc    $0x0,%ecx
+  8006bf:	f7 d9                	neg    %ecx
+  8006c1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006c9:	e9 e1 00 00 00       	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8b 00                	mov    (%eax),%eax
+  8006d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d6:	89 c1                	mov    %eax,%ecx
+  8006d8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e7:	eb b0                	jmp    800699 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8006e9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ec:	7f 1e                	jg     80070c <vprintfmt+0x30f>
+	else if (lflag)
+  8006ee:	85 c9                	test   %ecx,%ecx
+  8006f0:	74 32                	je     800724 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 10                	mov    (%eax),%edx
+  8006f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800702:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800707:	e9 a3 00 00 00       	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 10                	mov    (%eax),%edx
+  800711:	8b 48 04             	mov    0x4(%eax),%ecx
+  800714:	8d 40 08             	lea    0x8(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80071f:	e9 8b 00 00 00       	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072e:	8d 40 04             	lea    0x4(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800734:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800739:	eb 74                	jmp    8007af <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80073b:	83 f9 01             	cmp    $0x1,%ecx
+  80073e:	7f 1b                	jg     80075b <vprintfmt+0x35e>
+	else if (lflag)
+  800740:	85 c9                	test   %ecx,%ecx
+  800742:	74 2c                	je     800770 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 10                	mov    (%eax),%edx
+  800749:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074e:	8d 40 04             	lea    0x4(%eax),%eax
+  800751:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800754:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800759:	eb 54                	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 10                	mov    (%eax),%edx
+  800760:	8b 48 04             	mov    0x4(%eax),%ecx
+  800763:	8d 40 08             	lea    0x8(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800769:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80076e:	eb 3f                	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 10                	mov    (%eax),%edx
+  800775:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800780:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800785:	eb 28                	jmp    8007af <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800787:	83 ec 08             	sub    $0x8,%esp
+  80078a:	53                   	push   %ebx
+  80078b:	6a 30                	push   $0x30
+  80078d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80078f:	83 c4 08             	add    $0x8,%esp
+  800792:	53                   	push   %ebx
+  800793:	6a 78                	push   $0x78
+  800795:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 10                	mov    (%eax),%edx
+  80079c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007a1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007aa:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007af:	83 ec 0c             	sub    $0xc,%esp
+  8007b2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007b6:	50                   	push   %eax
+  8007b7:	ff 75 e0             	push   -0x20(%ebp)
+  8007ba:	57                   	push   %edi
+  8007bb:	51                   	push   %ecx
+  8007bc:	52                   	push   %edx
+  8007bd:	89 da                	mov    %ebx,%edx
+  8007bf:	89 f0                	mov    %esi,%eax
+  8007c1:	e8 54 fb ff ff       	call   80031a <printnum>
+			break;
+  8007c6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8007cc:	e9 4a fc ff ff       	jmp    80041b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007d1:	83 f9 01             	cmp    $0x1,%ecx
+  8007d4:	7f 1b                	jg     8007f1 <vprintfmt+0x3f4>
+	else if (lflag)
+  8007d6:	85 c9                	test   %ecx,%ecx
+  8007d8:	74 2c                	je     800806 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8007da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dd:	8b 10                	mov    (%eax),%edx
+  8007df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ef:	eb be                	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f4:	8b 10                	mov    (%eax),%edx
+  8007f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800804:	eb a9                	jmp    8007af <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800816:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80081b:	eb 92                	jmp    8007af <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80081d:	83 ec 08             	sub    $0x8,%esp
+  800820:	53                   	push   %ebx
+  800821:	6a 25                	push   $0x25
+  800823:	ff d6                	call   *%esi
+			break;
+  800825:	83 c4 10             	add    $0x10,%esp
+  800828:	eb 9f                	jmp    8007c9 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	6a 25                	push   $0x25
+  800830:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800832:	83 c4 10             	add    $0x10,%esp
+  800835:	89 f8                	mov    %edi,%eax
+  800837:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80083b:	74 05                	je     800842 <vprintfmt+0x445>
+  80083d:	83 e8 01             	sub    $0x1,%eax
+  800840:	eb f5                	jmp    800837 <vprintfmt+0x43a>
+  800842:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800845:	eb 82                	jmp    8007c9 <vprintfmt+0x3cc>
+
+00800847 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	83 ec 18             	sub    $0x18,%esp
+  80084d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800850:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800853:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800856:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80085a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80085d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800864:	85 c0                	test   %eax,%eax
+  800866:	74 26                	je     80088e <vsnprintf+0x47>
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	7e 22                	jle    80088e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80086c:	ff 75 14             	push   0x14(%ebp)
+  80086f:	ff 75 10             	push   0x10(%ebp)
+  800872:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800875:	50                   	push   %eax
+  800876:	68 c3 03 80 00       	push   $0x8003c3
+  80087b:	e8 7d fb ff ff       	call   8003fd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800880:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800883:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800886:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800889:	83 c4 10             	add    $0x10,%esp
+}
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+		return -E_INVAL;
+  80088e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800893:	eb f7                	jmp    80088c <vsnprintf+0x45>
+
+00800895 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80089b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80089e:	50                   	push   %eax
+  80089f:	ff 75 10             	push   0x10(%ebp)
+  8008a2:	ff 75 0c             	push   0xc(%ebp)
+  8008a5:	ff 75 08             	push   0x8(%ebp)
+  8008a8:	e8 9a ff ff ff       	call   800847 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+
+008008af <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ba:	eb 03                	jmp    8008bf <strlen+0x10>
+		n++;
+  8008bc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008bf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c3:	75 f7                	jne    8008bc <strlen+0xd>
+	return n;
+}
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	eb 03                	jmp    8008da <strnlen+0x13>
+		n++;
+  8008d7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008da:	39 d0                	cmp    %edx,%eax
+  8008dc:	74 08                	je     8008e6 <strnlen+0x1f>
+  8008de:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e2:	75 f3                	jne    8008d7 <strnlen+0x10>
+  8008e4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008e6:	89 d0                	mov    %edx,%eax
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+
+008008ea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	53                   	push   %ebx
+  8008ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008fd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	84 d2                	test   %dl,%dl
+  800905:	75 f2                	jne    8008f9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800907:	89 c8                	mov    %ecx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	53                   	push   %ebx
+  800912:	83 ec 10             	sub    $0x10,%esp
+  800915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800918:	53                   	push   %ebx
+  800919:	e8 91 ff ff ff       	call   8008af <strlen>
+  80091e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800921:	ff 75 0c             	push   0xc(%ebp)
+  800924:	01 d8                	add    %ebx,%eax
+  800926:	50                   	push   %eax
+  800927:	e8 be ff ff ff       	call   8008ea <strcpy>
+	return dst;
+}
+  80092c:	89 d8                	mov    %ebx,%eax
+  80092e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800931:	c9                   	leave
+  800932:	c3                   	ret
+
+00800933 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80093e:	89 f3                	mov    %esi,%ebx
+  800940:	03 5d 10             	add    0x10(%ebp),%ebx
+  800943:	89 f0                	mov    %esi,%eax
+  800945:	eb 0f                	jmp    800956 <strncpy+0x23>
+		*dst++ = *src;
+  800947:	83 c0 01             	add    $0x1,%eax
+  80094a:	0f b6 0a             	movzbl (%edx),%ecx
+  80094d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800950:	80 f9 01             	cmp    $0x1,%cl
+  800953:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800956:	39 d8                	cmp    %ebx,%eax
+  800958:	75 ed                	jne    800947 <strncpy+0x14>
+	}
+	return ret;
+}
+  80095a:	89 f0                	mov    %esi,%eax
+  80095c:	5b                   	pop    %ebx
+  80095d:	5e                   	pop    %esi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	56                   	push   %esi
+  800964:	53                   	push   %ebx
+  800965:	8b 75 08             	mov    0x8(%ebp),%esi
+  800968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80096e:	89 f0                	mov    %esi,%eax
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 21                	je     800995 <strlcpy+0x35>
+  800974:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800978:	89 f2                	mov    %esi,%edx
+  80097a:	eb 09                	jmp    800985 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80097c:	83 c1 01             	add    $0x1,%ecx
+  80097f:	83 c2 01             	add    $0x1,%edx
+  800982:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800985:	39 c2                	cmp    %eax,%edx
+  800987:	74 09                	je     800992 <strlcpy+0x32>
+  800989:	0f b6 19             	movzbl (%ecx),%ebx
+  80098c:	84 db                	test   %bl,%bl
+  80098e:	75 ec                	jne    80097c <strlcpy+0x1c>
+  800990:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800992:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800995:	29 f0                	sub    %esi,%eax
+}
+  800997:	5b                   	pop    %ebx
+  800998:	5e                   	pop    %esi
+  800999:	5d                   	pop    %ebp
+  80099a:	c3                   	ret
+
+0080099b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80099b:	55                   	push   %ebp
+  80099c:	89 e5                	mov    %esp,%ebp
+  80099e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a4:	eb 06                	jmp    8009ac <strcmp+0x11>
+		p++, q++;
+  8009a6:	83 c1 01             	add    $0x1,%ecx
+  8009a9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ac:	0f b6 01             	movzbl (%ecx),%eax
+  8009af:	84 c0                	test   %al,%al
+  8009b1:	74 04                	je     8009b7 <strcmp+0x1c>
+  8009b3:	3a 02                	cmp    (%edx),%al
+  8009b5:	74 ef                	je     8009a6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b7:	0f b6 c0             	movzbl %al,%eax
+  8009ba:	0f b6 12             	movzbl (%edx),%edx
+  8009bd:	29 d0                	sub    %edx,%eax
+}
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	53                   	push   %ebx
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009cb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ce:	eb 09                	jmp    8009d9 <strncmp+0x18>
+		n--, p++, q++;
+  8009d0:	83 ea 01             	sub    $0x1,%edx
+  8009d3:	83 c0 01             	add    $0x1,%eax
+  8009d6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009d9:	85 d2                	test   %edx,%edx
+  8009db:	74 18                	je     8009f5 <strncmp+0x34>
+  8009dd:	0f b6 18             	movzbl (%eax),%ebx
+  8009e0:	84 db                	test   %bl,%bl
+  8009e2:	74 04                	je     8009e8 <strncmp+0x27>
+  8009e4:	3a 19                	cmp    (%ecx),%bl
+  8009e6:	74 e8                	je     8009d0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e8:	0f b6 00             	movzbl (%eax),%eax
+  8009eb:	0f b6 11             	movzbl (%ecx),%edx
+  8009ee:	29 d0                	sub    %edx,%eax
+}
+  8009f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+		return 0;
+  8009f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fa:	eb f4                	jmp    8009f0 <strncmp+0x2f>
+
+008009fc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a02:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a06:	eb 03                	jmp    800a0b <strchr+0xf>
+  800a08:	83 c0 01             	add    $0x1,%eax
+  800a0b:	0f b6 10             	movzbl (%eax),%edx
+  800a0e:	84 d2                	test   %dl,%dl
+  800a10:	74 06                	je     800a18 <strchr+0x1c>
+		if (*s == c)
+  800a12:	38 ca                	cmp    %cl,%dl
+  800a14:	75 f2                	jne    800a08 <strchr+0xc>
+  800a16:	eb 05                	jmp    800a1d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+
+00800a1f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a29:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a2c:	38 ca                	cmp    %cl,%dl
+  800a2e:	74 09                	je     800a39 <strfind+0x1a>
+  800a30:	84 d2                	test   %dl,%dl
+  800a32:	74 05                	je     800a39 <strfind+0x1a>
+	for (; *s; s++)
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	eb f0                	jmp    800a29 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a39:	5d                   	pop    %ebp
+  800a3a:	c3                   	ret
+
+00800a3b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	57                   	push   %edi
+  800a3f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a45:	85 c9                	test   %ecx,%ecx
+  800a47:	74 20                	je     800a69 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a49:	89 f8                	mov    %edi,%eax
+  800a4b:	09 c8                	or     %ecx,%eax
+  800a4d:	a8 03                	test   $0x3,%al
+  800a4f:	75 12                	jne    800a63 <memset+0x28>
+		c &= 0xFF;
+  800a51:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a55:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a5b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a5e:	fc                   	cld
+  800a5f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a61:	eb 06                	jmp    800a69 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a66:	fc                   	cld
+  800a67:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a69:	89 f8                	mov    %edi,%eax
+  800a6b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	57                   	push   %edi
+  800a74:	56                   	push   %esi
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a7b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a7e:	39 c6                	cmp    %eax,%esi
+  800a80:	73 32                	jae    800ab4 <memmove+0x44>
+  800a82:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a85:	39 d0                	cmp    %edx,%eax
+  800a87:	73 2b                	jae    800ab4 <memmove+0x44>
+		s += n;
+		d += n;
+  800a89:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8c:	89 d6                	mov    %edx,%esi
+  800a8e:	09 fe                	or     %edi,%esi
+  800a90:	09 ce                	or     %ecx,%esi
+  800a92:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a98:	75 0e                	jne    800aa8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a9a:	83 ef 04             	sub    $0x4,%edi
+  800a9d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aa3:	fd                   	std
+  800aa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa6:	eb 09                	jmp    800ab1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aa8:	83 ef 01             	sub    $0x1,%edi
+  800aab:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aae:	fd                   	std
+  800aaf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ab1:	fc                   	cld
+  800ab2:	eb 1a                	jmp    800ace <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab4:	89 f2                	mov    %esi,%edx
+  800ab6:	09 c2                	or     %eax,%edx
+  800ab8:	09 ca                	or     %ecx,%edx
+  800aba:	f6 c2 03             	test   $0x3,%dl
+  800abd:	75 0a                	jne    800ac9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800abf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ac2:	89 c7                	mov    %eax,%edi
+  800ac4:	fc                   	cld
+  800ac5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac7:	eb 05                	jmp    800ace <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ac9:	89 c7                	mov    %eax,%edi
+  800acb:	fc                   	cld
+  800acc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ace:	5e                   	pop    %esi
+  800acf:	5f                   	pop    %edi
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ad8:	ff 75 10             	push   0x10(%ebp)
+  800adb:	ff 75 0c             	push   0xc(%ebp)
+  800ade:	ff 75 08             	push   0x8(%ebp)
+  800ae1:	e8 8a ff ff ff       	call   800a70 <memmove>
+}
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	56                   	push   %esi
+  800aec:	53                   	push   %ebx
+  800aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800af3:	89 c6                	mov    %eax,%esi
+  800af5:	03 75 10             	add    0x10(%ebp),%esi
+  800af8:	eb 06                	jmp    800b00 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800afa:	83 c0 01             	add    $0x1,%eax
+  800afd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b00:	39 f0                	cmp    %esi,%eax
+  800b02:	74 14                	je     800b18 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b04:	0f b6 08             	movzbl (%eax),%ecx
+  800b07:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0a:	38 d9                	cmp    %bl,%cl
+  800b0c:	74 ec                	je     800afa <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b0e:	0f b6 c1             	movzbl %cl,%eax
+  800b11:	0f b6 db             	movzbl %bl,%ebx
+  800b14:	29 d8                	sub    %ebx,%eax
+  800b16:	eb 05                	jmp    800b1d <memcmp+0x35>
+	}
+
+	return 0;
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1d:	5b                   	pop    %ebx
+  800b1e:	5e                   	pop    %esi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2f:	eb 03                	jmp    800b34 <memfind+0x13>
+  800b31:	83 c0 01             	add    $0x1,%eax
+  800b34:	39 d0                	cmp    %edx,%eax
+  800b36:	73 04                	jae    800b3c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b38:	38 08                	cmp    %cl,(%eax)
+  800b3a:	75 f5                	jne    800b31 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b3c:	5d                   	pop    %ebp
+  800b3d:	c3                   	ret
+
+00800b3e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  800b44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b4a:	eb 03                	jmp    800b4f <strtol+0x11>
+		s++;
+  800b4c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b4f:	0f b6 02             	movzbl (%edx),%eax
+  800b52:	3c 20                	cmp    $0x20,%al
+  800b54:	74 f6                	je     800b4c <strtol+0xe>
+  800b56:	3c 09                	cmp    $0x9,%al
+  800b58:	74 f2                	je     800b4c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b5a:	3c 2b                	cmp    $0x2b,%al
+  800b5c:	74 2a                	je     800b88 <strtol+0x4a>
+	int neg = 0;
+  800b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b63:	3c 2d                	cmp    $0x2d,%al
+  800b65:	74 2b                	je     800b92 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b67:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b6d:	75 0f                	jne    800b7e <strtol+0x40>
+  800b6f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b72:	74 28                	je     800b9c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b74:	85 db                	test   %ebx,%ebx
+  800b76:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7b:	0f 44 d8             	cmove  %eax,%ebx
+  800b7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b83:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b86:	eb 46                	jmp    800bce <strtol+0x90>
+		s++;
+  800b88:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b90:	eb d5                	jmp    800b67 <strtol+0x29>
+		s++, neg = 1;
+  800b92:	83 c2 01             	add    $0x1,%edx
+  800b95:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9a:	eb cb                	jmp    800b67 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b9c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba0:	74 0e                	je     800bb0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ba2:	85 db                	test   %ebx,%ebx
+  800ba4:	75 d8                	jne    800b7e <strtol+0x40>
+		s++, base = 8;
+  800ba6:	83 c2 01             	add    $0x1,%edx
+  800ba9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bae:	eb ce                	jmp    800b7e <strtol+0x40>
+		s += 2, base = 16;
+  800bb0:	83 c2 02             	add    $0x2,%edx
+  800bb3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bb8:	eb c4                	jmp    800b7e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bba:	0f be c0             	movsbl %al,%eax
+  800bbd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc3:	7d 3a                	jge    800bff <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bc5:	83 c2 01             	add    $0x1,%edx
+  800bc8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bcc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bce:	0f b6 02             	movzbl (%edx),%eax
+  800bd1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd4:	89 f3                	mov    %esi,%ebx
+  800bd6:	80 fb 09             	cmp    $0x9,%bl
+  800bd9:	76 df                	jbe    800bba <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bdb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bde:	89 f3                	mov    %esi,%ebx
+  800be0:	80 fb 19             	cmp    $0x19,%bl
+  800be3:	77 08                	ja     800bed <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800be5:	0f be c0             	movsbl %al,%eax
+  800be8:	83 e8 57             	sub    $0x57,%eax
+  800beb:	eb d3                	jmp    800bc0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bed:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf0:	89 f3                	mov    %esi,%ebx
+  800bf2:	80 fb 19             	cmp    $0x19,%bl
+  800bf5:	77 08                	ja     800bff <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bf7:	0f be c0             	movsbl %al,%eax
+  800bfa:	83 e8 37             	sub    $0x37,%eax
+  800bfd:	eb c1                	jmp    800bc0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bff:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c03:	74 05                	je     800c0a <strtol+0xcc>
+		*endptr = (char *) s;
+  800c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c08:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c0a:	89 c8                	mov    %ecx,%eax
+  800c0c:	f7 d8                	neg    %eax
+  800c0e:	85 ff                	test   %edi,%edi
+  800c10:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c13:	89 c8                	mov    %ecx,%eax
+  800c15:	5b                   	pop    %ebx
+  800c16:	5e                   	pop    %esi
+  800c17:	5f                   	pop    %edi
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+
+00800c1a <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c20:	6a 00                	push   $0x0
+  800c22:	6a 00                	push   $0x0
+  800c24:	ff 75 08             	push   0x8(%ebp)
+  800c27:	e8 12 ff ff ff       	call   800b3e <strtol>
+}
+  800c2c:	c9                   	leave
+  800c2d:	c3                   	ret
+
+00800c2e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2e:	55                   	push   %ebp
+  800c2f:	89 e5                	mov    %esp,%ebp
+  800c31:	57                   	push   %edi
+  800c32:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3e:	89 c3                	mov    %eax,%ebx
+  800c40:	89 c7                	mov    %eax,%edi
+  800c42:	6a 00                	push   $0x0
+  800c44:	55                   	push   %ebp
+  800c45:	56                   	push   %esi
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	8d 35 50 0c 80 00    	lea    0x800c50,%esi
+  800c4e:	0f 34                	sysenter
+
+00800c50 <after_sysenter_label_47>:
+  800c50:	5e                   	pop    %esi
+  800c51:	5d                   	pop    %ebp
+  800c52:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c55:	5b                   	pop    %ebx
+  800c56:	5f                   	pop    %edi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+
+00800c59 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c68:	89 d1                	mov    %edx,%ecx
+  800c6a:	89 d3                	mov    %edx,%ebx
+  800c6c:	89 d7                	mov    %edx,%edi
+  800c6e:	6a 00                	push   $0x0
+  800c70:	55                   	push   %ebp
+  800c71:	56                   	push   %esi
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	8d 35 7c 0c 80 00    	lea    0x800c7c,%esi
+  800c7a:	0f 34                	sysenter
+
+00800c7c <after_sysenter_label_128>:
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c81:	5b                   	pop    %ebx
+  800c82:	5f                   	pop    %edi
+  800c83:	5d                   	pop    %ebp
+  800c84:	c3                   	ret
+
+00800c85 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	57                   	push   %edi
+  800c89:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c92:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c97:	89 cb                	mov    %ecx,%ebx
+  800c99:	89 cf                	mov    %ecx,%edi
+  800c9b:	6a 00                	push   $0x0
+  800c9d:	55                   	push   %ebp
+  800c9e:	56                   	push   %esi
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	8d 35 a9 0c 80 00    	lea    0x800ca9,%esi
+  800ca7:	0f 34                	sysenter
+
+00800ca9 <after_sysenter_label_212>:
+  800ca9:	5e                   	pop    %esi
+  800caa:	5d                   	pop    %ebp
+  800cab:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cae:	85 c0                	test   %eax,%eax
+  800cb0:	7f 07                	jg     800cb9 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb5:	5b                   	pop    %ebx
+  800cb6:	5f                   	pop    %edi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb9:	83 ec 0c             	sub    $0xc,%esp
+  800cbc:	50                   	push   %eax
+  800cbd:	6a 03                	push   $0x3
+  800cbf:	68 95 4c 80 00       	push   $0x804c95
+  800cc4:	6a 54                	push   $0x54
+  800cc6:	68 b2 4c 80 00       	push   $0x804cb2
+  800ccb:	e8 39 38 00 00       	call   804509 <_panic>
+
+00800cd0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	57                   	push   %edi
+  800cd4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cda:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cdf:	89 d1                	mov    %edx,%ecx
+  800ce1:	89 d3                	mov    %edx,%ebx
+  800ce3:	89 d7                	mov    %edx,%edi
+  800ce5:	6a 00                	push   $0x0
+  800ce7:	55                   	push   %ebp
+  800ce8:	56                   	push   %esi
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	8d 35 f3 0c 80 00    	lea    0x800cf3,%esi
+  800cf1:	0f 34                	sysenter
+
+00800cf3 <after_sysenter_label_309>:
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf8:	5b                   	pop    %ebx
+  800cf9:	5f                   	pop    %edi
+  800cfa:	5d                   	pop    %ebp
+  800cfb:	c3                   	ret
+
+00800cfc <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	57                   	push   %edi
+  800d00:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d06:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d0b:	89 d1                	mov    %edx,%ecx
+  800d0d:	89 d3                	mov    %edx,%ebx
+  800d0f:	89 d7                	mov    %edx,%edi
+  800d11:	6a 00                	push   $0x0
+  800d13:	55                   	push   %ebp
+  800d14:	56                   	push   %esi
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	8d 35 1f 0d 80 00    	lea    0x800d1f,%esi
+  800d1d:	0f 34                	sysenter
+
+00800d1f <after_sysenter_label_391>:
+  800d1f:	5e                   	pop    %esi
+  800d20:	5d                   	pop    %ebp
+  800d21:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d24:	5b                   	pop    %ebx
+  800d25:	5f                   	pop    %edi
+  800d26:	5d                   	pop    %ebp
+  800d27:	c3                   	ret
+
+00800d28 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d33:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d40:	6a 00                	push   $0x0
+  800d42:	55                   	push   %ebp
+  800d43:	56                   	push   %esi
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	8d 35 4e 0d 80 00    	lea    0x800d4e,%esi
+  800d4c:	0f 34                	sysenter
+
+00800d4e <after_sysenter_label_479>:
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	7f 07                	jg     800d5e <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+  800d61:	50                   	push   %eax
+  800d62:	6a 04                	push   $0x4
+  800d64:	68 95 4c 80 00       	push   $0x804c95
+  800d69:	6a 54                	push   $0x54
+  800d6b:	68 b2 4c 80 00       	push   $0x804cb2
+  800d70:	e8 94 37 00 00       	call   804509 <_panic>
+
+00800d75 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d80:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8b:	ff 75 18             	push   0x18(%ebp)
+  800d8e:	55                   	push   %ebp
+  800d8f:	56                   	push   %esi
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	8d 35 9a 0d 80 00    	lea    0x800d9a,%esi
+  800d98:	0f 34                	sysenter
+
+00800d9a <after_sysenter_label_593>:
+  800d9a:	5e                   	pop    %esi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7f 07                	jg     800daa <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800da3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da6:	5b                   	pop    %ebx
+  800da7:	5f                   	pop    %edi
+  800da8:	5d                   	pop    %ebp
+  800da9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+  800dad:	50                   	push   %eax
+  800dae:	6a 05                	push   $0x5
+  800db0:	68 95 4c 80 00       	push   $0x804c95
+  800db5:	6a 54                	push   $0x54
+  800db7:	68 b2 4c 80 00       	push   $0x804cb2
+  800dbc:	e8 48 37 00 00       	call   804509 <_panic>
+
+00800dc1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	57                   	push   %edi
+  800dc5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd6:	89 df                	mov    %ebx,%edi
+  800dd8:	6a 00                	push   $0x0
+  800dda:	55                   	push   %ebp
+  800ddb:	56                   	push   %esi
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	8d 35 e6 0d 80 00    	lea    0x800de6,%esi
+  800de4:	0f 34                	sysenter
+
+00800de6 <after_sysenter_label_704>:
+  800de6:	5e                   	pop    %esi
+  800de7:	5d                   	pop    %ebp
+  800de8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	7f 07                	jg     800df6 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800def:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df2:	5b                   	pop    %ebx
+  800df3:	5f                   	pop    %edi
+  800df4:	5d                   	pop    %ebp
+  800df5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df6:	83 ec 0c             	sub    $0xc,%esp
+  800df9:	50                   	push   %eax
+  800dfa:	6a 06                	push   $0x6
+  800dfc:	68 95 4c 80 00       	push   $0x804c95
+  800e01:	6a 54                	push   $0x54
+  800e03:	68 b2 4c 80 00       	push   $0x804cb2
+  800e08:	e8 fc 36 00 00       	call   804509 <_panic>
+
+00800e0d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e0d:	55                   	push   %ebp
+  800e0e:	89 e5                	mov    %esp,%ebp
+  800e10:	57                   	push   %edi
+  800e11:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e22:	89 df                	mov    %ebx,%edi
+  800e24:	6a 00                	push   $0x0
+  800e26:	55                   	push   %ebp
+  800e27:	56                   	push   %esi
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	8d 35 32 0e 80 00    	lea    0x800e32,%esi
+  800e30:	0f 34                	sysenter
+
+00800e32 <after_sysenter_label_808>:
+  800e32:	5e                   	pop    %esi
+  800e33:	5d                   	pop    %ebp
+  800e34:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e37:	85 c0                	test   %eax,%eax
+  800e39:	7f 07                	jg     800e42 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e42:	83 ec 0c             	sub    $0xc,%esp
+  800e45:	50                   	push   %eax
+  800e46:	6a 08                	push   $0x8
+  800e48:	68 95 4c 80 00       	push   $0x804c95
+  800e4d:	6a 54                	push   $0x54
+  800e4f:	68 b2 4c 80 00       	push   $0x804cb2
+  800e54:	e8 b0 36 00 00       	call   804509 <_panic>
+
+00800e59 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	57                   	push   %edi
+  800e5d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	6a 00                	push   $0x0
+  800e72:	55                   	push   %ebp
+  800e73:	56                   	push   %esi
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	8d 35 7e 0e 80 00    	lea    0x800e7e,%esi
+  800e7c:	0f 34                	sysenter
+
+00800e7e <after_sysenter_label_912>:
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5d                   	pop    %ebp
+  800e80:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 07                	jg     800e8e <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 09                	push   $0x9
+  800e94:	68 95 4c 80 00       	push   $0x804c95
+  800e99:	6a 54                	push   $0x54
+  800e9b:	68 b2 4c 80 00       	push   $0x804cb2
+  800ea0:	e8 64 36 00 00       	call   804509 <_panic>
+
+00800ea5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eba:	89 df                	mov    %ebx,%edi
+  800ebc:	6a 00                	push   $0x0
+  800ebe:	55                   	push   %ebp
+  800ebf:	56                   	push   %esi
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	8d 35 ca 0e 80 00    	lea    0x800eca,%esi
+  800ec8:	0f 34                	sysenter
+
+00800eca <after_sysenter_label_1016>:
+  800eca:	5e                   	pop    %esi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ecf:	85 c0                	test   %eax,%eax
+  800ed1:	7f 07                	jg     800eda <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ed3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ed6:	5b                   	pop    %ebx
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+  800edd:	50                   	push   %eax
+  800ede:	6a 0a                	push   $0xa
+  800ee0:	68 95 4c 80 00       	push   $0x804c95
+  800ee5:	6a 54                	push   $0x54
+  800ee7:	68 b2 4c 80 00       	push   $0x804cb2
+  800eec:	e8 18 36 00 00       	call   804509 <_panic>
+
+00800ef1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f07:	6a 00                	push   $0x0
+  800f09:	55                   	push   %ebp
+  800f0a:	56                   	push   %esi
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	8d 35 15 0f 80 00    	lea    0x800f15,%esi
+  800f13:	0f 34                	sysenter
+
+00800f15 <after_sysenter_label_1126>:
+  800f15:	5e                   	pop    %esi
+  800f16:	5d                   	pop    %ebp
+  800f17:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+
+00800f1e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	57                   	push   %edi
+  800f22:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f30:	89 cb                	mov    %ecx,%ebx
+  800f32:	89 cf                	mov    %ecx,%edi
+  800f34:	6a 00                	push   $0x0
+  800f36:	55                   	push   %ebp
+  800f37:	56                   	push   %esi
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	8d 35 42 0f 80 00    	lea    0x800f42,%esi
+  800f40:	0f 34                	sysenter
+
+00800f42 <after_sysenter_label_1210>:
+  800f42:	5e                   	pop    %esi
+  800f43:	5d                   	pop    %ebp
+  800f44:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 07                	jg     800f52 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 0d                	push   $0xd
+  800f58:	68 95 4c 80 00       	push   $0x804c95
+  800f5d:	6a 54                	push   $0x54
+  800f5f:	68 b2 4c 80 00       	push   $0x804cb2
+  800f64:	e8 a0 35 00 00       	call   804509 <_panic>
+
+00800f69 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f79:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f7e:	89 df                	mov    %ebx,%edi
+  800f80:	6a 00                	push   $0x0
+  800f82:	55                   	push   %ebp
+  800f83:	56                   	push   %esi
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+
+00800f8e <after_sysenter_label_1311>:
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	7f 07                	jg     800f9e <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	50                   	push   %eax
+  800fa2:	6a 42                	push   $0x42
+  800fa4:	68 95 4c 80 00       	push   $0x804c95
+  800fa9:	6a 54                	push   $0x54
+  800fab:	68 b2 4c 80 00       	push   $0x804cb2
+  800fb0:	e8 54 35 00 00       	call   804509 <_panic>
+
+00800fb5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fc4:	89 d1                	mov    %edx,%ecx
+  800fc6:	89 d3                	mov    %edx,%ebx
+  800fc8:	89 d7                	mov    %edx,%edi
+  800fca:	6a 00                	push   $0x0
+  800fcc:	55                   	push   %ebp
+  800fcd:	56                   	push   %esi
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	8d 35 d8 0f 80 00    	lea    0x800fd8,%esi
+  800fd6:	0f 34                	sysenter
+
+00800fd8 <after_sysenter_label_1411>:
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ff6:	89 df                	mov    %ebx,%edi
+  800ff8:	6a 00                	push   $0x0
+  800ffa:	55                   	push   %ebp
+  800ffb:	56                   	push   %esi
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	8d 35 06 10 80 00    	lea    0x801006,%esi
+  801004:	0f 34                	sysenter
+
+00801006 <after_sysenter_label_1497>:
+  801006:	5e                   	pop    %esi
+  801007:	5d                   	pop    %ebp
+  801008:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80100b:	5b                   	pop    %ebx
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801024:	89 df                	mov    %ebx,%edi
+  801026:	6a 00                	push   $0x0
+  801028:	55                   	push   %ebp
+  801029:	56                   	push   %esi
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	8d 35 34 10 80 00    	lea    0x801034,%esi
+  801032:	0f 34                	sysenter
+
+00801034 <after_sysenter_label_1583>:
+  801034:	5e                   	pop    %esi
+  801035:	5d                   	pop    %ebp
+  801036:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801039:	5b                   	pop    %ebx
+  80103a:	5f                   	pop    %edi
+  80103b:	5d                   	pop    %ebp
+  80103c:	c3                   	ret
+
+0080103d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	b8 11 00 00 00       	mov    $0x11,%eax
+  80104d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801055:	6a 00                	push   $0x0
+  801057:	55                   	push   %ebp
+  801058:	56                   	push   %esi
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	8d 35 63 10 80 00    	lea    0x801063,%esi
+  801061:	0f 34                	sysenter
+
+00801063 <after_sysenter_label_1672>:
+  801063:	5e                   	pop    %esi
+  801064:	5d                   	pop    %ebp
+  801065:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801068:	5b                   	pop    %ebx
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+
+0080106c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	57                   	push   %edi
+  801070:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801071:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801081:	89 df                	mov    %ebx,%edi
+  801083:	6a 00                	push   $0x0
+  801085:	55                   	push   %ebp
+  801086:	56                   	push   %esi
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	8d 35 91 10 80 00    	lea    0x801091,%esi
+  80108f:	0f 34                	sysenter
+
+00801091 <after_sysenter_label_1758>:
+  801091:	5e                   	pop    %esi
+  801092:	5d                   	pop    %ebp
+  801093:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801096:	5b                   	pop    %ebx
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+
+0080109a <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ac:	89 cb                	mov    %ecx,%ebx
+  8010ae:	89 cf                	mov    %ecx,%edi
+  8010b0:	6a 00                	push   $0x0
+  8010b2:	55                   	push   %ebp
+  8010b3:	56                   	push   %esi
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8d 35 be 10 80 00    	lea    0x8010be,%esi
+  8010bc:	0f 34                	sysenter
+
+008010be <after_sysenter_label_1842>:
+  8010be:	5e                   	pop    %esi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 07                	jg     8010ce <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8010c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+  8010d1:	50                   	push   %eax
+  8010d2:	6a 13                	push   $0x13
+  8010d4:	68 95 4c 80 00       	push   $0x804c95
+  8010d9:	6a 54                	push   $0x54
+  8010db:	68 b2 4c 80 00       	push   $0x804cb2
+  8010e0:	e8 24 34 00 00       	call   804509 <_panic>
+
+008010e5 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ef:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010f4:	89 d1                	mov    %edx,%ecx
+  8010f6:	89 d3                	mov    %edx,%ebx
+  8010f8:	89 d7                	mov    %edx,%edi
+  8010fa:	6a 00                	push   $0x0
+  8010fc:	55                   	push   %ebp
+  8010fd:	56                   	push   %esi
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	8d 35 08 11 80 00    	lea    0x801108,%esi
+  801106:	0f 34                	sysenter
+
+00801108 <after_sysenter_label_1939>:
+  801108:	5e                   	pop    %esi
+  801109:	5d                   	pop    %ebp
+  80110a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80110d:	5b                   	pop    %ebx
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801121:	bf 00 00 00 00       	mov    $0x0,%edi
+  801126:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801129:	6a 00                	push   $0x0
+  80112b:	55                   	push   %ebp
+  80112c:	56                   	push   %esi
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	8d 35 37 11 80 00    	lea    0x801137,%esi
+  801135:	0f 34                	sysenter
+
+00801137 <after_sysenter_label_2028>:
+  801137:	5e                   	pop    %esi
+  801138:	5d                   	pop    %ebp
+  801139:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80113c:	5b                   	pop    %ebx
+  80113d:	5f                   	pop    %edi
+  80113e:	5d                   	pop    %ebp
+  80113f:	c3                   	ret
+
+00801140 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	b8 16 00 00 00       	mov    $0x16,%eax
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	6a 00                	push   $0x0
+  801159:	55                   	push   %ebp
+  80115a:	56                   	push   %esi
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	8d 35 65 11 80 00    	lea    0x801165,%esi
+  801163:	0f 34                	sysenter
+
+00801165 <after_sysenter_label_2114>:
+  801165:	5e                   	pop    %esi
+  801166:	5d                   	pop    %ebp
+  801167:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80116a:	5b                   	pop    %ebx
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+
+0080116e <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801183:	89 df                	mov    %ebx,%edi
+  801185:	6a 00                	push   $0x0
+  801187:	55                   	push   %ebp
+  801188:	56                   	push   %esi
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	8d 35 93 11 80 00    	lea    0x801193,%esi
+  801191:	0f 34                	sysenter
+
+00801193 <after_sysenter_label_2200>:
+  801193:	5e                   	pop    %esi
+  801194:	5d                   	pop    %ebp
+  801195:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+
+0080119c <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ac:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011b1:	89 df                	mov    %ebx,%edi
+  8011b3:	6a 00                	push   $0x0
+  8011b5:	55                   	push   %ebp
+  8011b6:	56                   	push   %esi
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	8d 35 c1 11 80 00    	lea    0x8011c1,%esi
+  8011bf:	0f 34                	sysenter
+
+008011c1 <after_sysenter_label_2286>:
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8011c6:	5b                   	pop    %ebx
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8011d3:	89 d6                	mov    %edx,%esi
+  8011d5:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8011d8:	89 cf                	mov    %ecx,%edi
+  8011da:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8011dd:	89 fa                	mov    %edi,%edx
+  8011df:	80 ce 08             	or     $0x8,%dh
+  8011e2:	f6 c5 08             	test   $0x8,%ch
+  8011e5:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	50                   	push   %eax
+  8011eb:	56                   	push   %esi
+  8011ec:	6a 00                	push   $0x0
+  8011ee:	e8 82 fb ff ff       	call   800d75 <sys_page_map>
+	if (r < 0) {
+  8011f3:	83 c4 20             	add    $0x20,%esp
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	78 27                	js     801221 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+  8011fd:	57                   	push   %edi
+  8011fe:	56                   	push   %esi
+  8011ff:	6a 00                	push   $0x0
+  801201:	56                   	push   %esi
+  801202:	6a 00                	push   $0x0
+  801204:	e8 6c fb ff ff       	call   800d75 <sys_page_map>
+  801209:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80120b:	83 c4 20             	add    $0x20,%esp
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	78 24                	js     801236 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801212:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801217:	89 d8                	mov    %ebx,%eax
+  801219:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+  801221:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801223:	83 ec 08             	sub    $0x8,%esp
+  801226:	50                   	push   %eax
+  801227:	68 c0 4c 80 00       	push   $0x804cc0
+  80122c:	e8 d5 f0 ff ff       	call   800306 <cprintf>
+		return r;
+  801231:	83 c4 10             	add    $0x10,%esp
+  801234:	eb e1                	jmp    801217 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801236:	83 ec 08             	sub    $0x8,%esp
+  801239:	50                   	push   %eax
+  80123a:	68 f0 4c 80 00       	push   $0x804cf0
+  80123f:	e8 c2 f0 ff ff       	call   800306 <cprintf>
+		return r;
+  801244:	83 c4 10             	add    $0x10,%esp
+  801247:	eb ce                	jmp    801217 <duppage_cow+0x4d>
+
+00801249 <duppage>:
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	53                   	push   %ebx
+  80124d:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801250:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801253:	51                   	push   %ecx
+  801254:	52                   	push   %edx
+  801255:	50                   	push   %eax
+  801256:	52                   	push   %edx
+  801257:	6a 00                	push   $0x0
+  801259:	e8 17 fb ff ff       	call   800d75 <sys_page_map>
+	if (r < 0) {
+  80125e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801261:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801266:	85 c0                	test   %eax,%eax
+  801268:	78 07                	js     801271 <duppage+0x28>
+}
+  80126a:	89 d8                	mov    %ebx,%eax
+  80126c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80126f:	c9                   	leave
+  801270:	c3                   	ret
+  801271:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801273:	83 ec 08             	sub    $0x8,%esp
+  801276:	50                   	push   %eax
+  801277:	68 c0 4c 80 00       	push   $0x804cc0
+  80127c:	e8 85 f0 ff ff       	call   800306 <cprintf>
+		return r;
+  801281:	83 c4 10             	add    $0x10,%esp
+  801284:	eb e4                	jmp    80126a <duppage+0x21>
+
+00801286 <cow_copy>:
+{
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+  80128b:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80128d:	83 ec 04             	sub    $0x4,%esp
+  801290:	6a 07                	push   $0x7
+  801292:	68 00 f0 7f 00       	push   $0x7ff000
+  801297:	6a 00                	push   $0x0
+  801299:	e8 8a fa ff ff       	call   800d28 <sys_page_alloc>
+	if (r < 0) {
+  80129e:	83 c4 10             	add    $0x10,%esp
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	78 58                	js     8012fd <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	68 00 10 00 00       	push   $0x1000
+  8012ad:	56                   	push   %esi
+  8012ae:	68 00 f0 7f 00       	push   $0x7ff000
+  8012b3:	e8 b8 f7 ff ff       	call   800a70 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8012b8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012bf:	56                   	push   %esi
+  8012c0:	6a 00                	push   $0x0
+  8012c2:	68 00 f0 7f 00       	push   $0x7ff000
+  8012c7:	6a 00                	push   $0x0
+  8012c9:	e8 a7 fa ff ff       	call   800d75 <sys_page_map>
+  8012ce:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012d0:	83 c4 20             	add    $0x20,%esp
+  8012d3:	85 c0                	test   %eax,%eax
+  8012d5:	78 3b                	js     801312 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8012d7:	83 ec 08             	sub    $0x8,%esp
+  8012da:	68 00 f0 7f 00       	push   $0x7ff000
+  8012df:	6a 00                	push   $0x0
+  8012e1:	e8 db fa ff ff       	call   800dc1 <sys_page_unmap>
+  8012e6:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	78 45                	js     801334 <cow_copy+0xae>
+	return 0;
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8012f4:	89 d8                	mov    %ebx,%eax
+  8012f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012f9:	5b                   	pop    %ebx
+  8012fa:	5e                   	pop    %esi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+  8012fd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8012ff:	83 ec 08             	sub    $0x8,%esp
+  801302:	50                   	push   %eax
+  801303:	68 e0 4d 80 00       	push   $0x804de0
+  801308:	e8 f9 ef ff ff       	call   800306 <cprintf>
+		return r;
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	eb e2                	jmp    8012f4 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801312:	83 ec 08             	sub    $0x8,%esp
+  801315:	50                   	push   %eax
+  801316:	68 fc 4d 80 00       	push   $0x804dfc
+  80131b:	e8 e6 ef ff ff       	call   800306 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801320:	83 c4 08             	add    $0x8,%esp
+  801323:	68 00 f0 7f 00       	push   $0x7ff000
+  801328:	6a 00                	push   $0x0
+  80132a:	e8 92 fa ff ff       	call   800dc1 <sys_page_unmap>
+		return r;
+  80132f:	83 c4 10             	add    $0x10,%esp
+  801332:	eb c0                	jmp    8012f4 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801334:	83 ec 08             	sub    $0x8,%esp
+  801337:	50                   	push   %eax
+  801338:	68 18 4d 80 00       	push   $0x804d18
+  80133d:	e8 c4 ef ff ff       	call   800306 <cprintf>
+		return r;
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	eb ad                	jmp    8012f4 <cow_copy+0x6e>
+
+00801347 <pgfault>:
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80134f:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801351:	89 d8                	mov    %ebx,%eax
+  801353:	c1 e8 16             	shr    $0x16,%eax
+  801356:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80135d:	89 de                	mov    %ebx,%esi
+  80135f:	c1 ee 0c             	shr    $0xc,%esi
+  801362:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801369:	a8 07                	test   $0x7,%al
+  80136b:	74 3b                	je     8013a8 <pgfault+0x61>
+  80136d:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801373:	74 33                	je     8013a8 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801375:	83 ec 0c             	sub    $0xc,%esp
+  801378:	68 00 f0 bf ee       	push   $0xeebff000
+  80137d:	e8 07 28 00 00       	call   803b89 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801382:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	f6 c4 08             	test   $0x8,%ah
+  80138f:	75 30                	jne    8013c1 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801391:	83 ec 0c             	sub    $0xc,%esp
+  801394:	68 00 f0 bf ee       	push   $0xeebff000
+  801399:	e8 58 28 00 00       	call   803bf6 <mutex_unlock>
+}
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a4:	5b                   	pop    %ebx
+  8013a5:	5e                   	pop    %esi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8013a8:	83 ec 08             	sub    $0x8,%esp
+  8013ab:	ff 72 28             	push   0x28(%edx)
+  8013ae:	51                   	push   %ecx
+  8013af:	50                   	push   %eax
+  8013b0:	68 3c 4d 80 00       	push   $0x804d3c
+  8013b5:	6a 3f                	push   $0x3f
+  8013b7:	68 16 4e 80 00       	push   $0x804e16
+  8013bc:	e8 48 31 00 00       	call   804509 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8013c1:	89 d8                	mov    %ebx,%eax
+  8013c3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8013c8:	e8 b9 fe ff ff       	call   801286 <cow_copy>
+  8013cd:	eb c2                	jmp    801391 <pgfault+0x4a>
+
+008013cf <cow_enable>:
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8013d5:	68 47 13 80 00       	push   $0x801347
+  8013da:	e8 70 31 00 00       	call   80454f <set_pgfault_handler>
+}
+  8013df:	83 c4 10             	add    $0x10,%esp
+  8013e2:	c9                   	leave
+  8013e3:	c3                   	ret
+
+008013e4 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	57                   	push   %edi
+  8013e8:	56                   	push   %esi
+  8013e9:	53                   	push   %ebx
+  8013ea:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8013ed:	68 47 13 80 00       	push   $0x801347
+  8013f2:	e8 58 31 00 00       	call   80454f <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8013f7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013fc:	cd 30                	int    $0x30
+  8013fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 4b                	js     801453 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801408:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80140d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801415:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801419:	0f 85 16 01 00 00    	jne    801535 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80141f:	e8 ac f8 ff ff       	call   800cd0 <sys_getenvid>
+  801424:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801429:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80142b:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801431:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801437:	77 32                	ja     80146b <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801439:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80143e:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801440:	c1 ea 10             	shr    $0x10,%edx
+  801443:	74 26                	je     80146b <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801445:	c1 e2 10             	shl    $0x10,%edx
+  801448:	89 d1                	mov    %edx,%ecx
+  80144a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80144f:	29 ca                	sub    %ecx,%edx
+  801451:	eb 1e                	jmp    801471 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801453:	83 ec 08             	sub    $0x8,%esp
+  801456:	89 c7                	mov    %eax,%edi
+  801458:	50                   	push   %eax
+  801459:	68 21 4e 80 00       	push   $0x804e21
+  80145e:	e8 a3 ee ff ff       	call   800306 <cprintf>
+		return eid;
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	e9 6c 01 00 00       	jmp    8015d7 <fork+0x1f3>
+		return pthread_main_tls;
+  80146b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801471:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801474:	c1 e0 04             	shl    $0x4,%eax
+  801477:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80147c:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80147e:	e8 4f 2e 00 00       	call   8042d2 <pthread_fork_child>
+		return eid;
+  801483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801486:	e9 4c 01 00 00       	jmp    8015d7 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80148b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801491:	89 da                	mov    %ebx,%edx
+  801493:	89 f8                	mov    %edi,%eax
+  801495:	e8 af fd ff ff       	call   801249 <duppage>
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	79 28                	jns    8014c6 <fork+0xe2>
+  80149e:	89 c7                	mov    %eax,%edi
+  8014a0:	e9 32 01 00 00       	jmp    8015d7 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014a5:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014ab:	83 f9 05             	cmp    $0x5,%ecx
+  8014ae:	75 58                	jne    801508 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014b0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014b5:	89 da                	mov    %ebx,%edx
+  8014b7:	89 f8                	mov    %edi,%eax
+  8014b9:	e8 8b fd ff ff       	call   801249 <duppage>
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	0f 88 0f 01 00 00    	js     8015d5 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8014c6:	83 c3 01             	add    $0x1,%ebx
+  8014c9:	39 de                	cmp    %ebx,%esi
+  8014cb:	74 54                	je     801521 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8014cd:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8014d4:	f6 c1 05             	test   $0x5,%cl
+  8014d7:	74 ed                	je     8014c6 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8014d9:	f6 c5 04             	test   $0x4,%ch
+  8014dc:	75 ad                	jne    80148b <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8014de:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8014e4:	74 bf                	je     8014a5 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8014e6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8014ec:	74 d8                	je     8014c6 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8014ee:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8014f4:	89 da                	mov    %ebx,%edx
+  8014f6:	89 f8                	mov    %edi,%eax
+  8014f8:	e8 cd fc ff ff       	call   8011ca <duppage_cow>
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	79 c5                	jns    8014c6 <fork+0xe2>
+  801501:	89 c7                	mov    %eax,%edi
+  801503:	e9 cf 00 00 00       	jmp    8015d7 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801508:	68 6c 4d 80 00       	push   $0x804d6c
+  80150d:	68 31 4e 80 00       	push   $0x804e31
+  801512:	68 c6 00 00 00       	push   $0xc6
+  801517:	68 16 4e 80 00       	push   $0x804e16
+  80151c:	e8 e8 2f 00 00       	call   804509 <_panic>
+  801521:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801524:	83 c1 01             	add    $0x1,%ecx
+  801527:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80152d:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801533:	74 18                	je     80154d <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801535:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80153c:	a8 07                	test   $0x7,%al
+  80153e:	74 e4                	je     801524 <fork+0x140>
+  801540:	89 cb                	mov    %ecx,%ebx
+  801542:	c1 e3 0a             	shl    $0xa,%ebx
+  801545:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801548:	e9 7c ff ff ff       	jmp    8014c9 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80154d:	83 ec 04             	sub    $0x4,%esp
+  801550:	6a 07                	push   $0x7
+  801552:	68 00 f0 bf ee       	push   $0xeebff000
+  801557:	ff 75 e4             	push   -0x1c(%ebp)
+  80155a:	e8 c9 f7 ff ff       	call   800d28 <sys_page_alloc>
+  80155f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801561:	83 c4 10             	add    $0x10,%esp
+  801564:	85 c0                	test   %eax,%eax
+  801566:	78 34                	js     80159c <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	68 8d 45 80 00       	push   $0x80458d
+  801570:	ff 75 e4             	push   -0x1c(%ebp)
+  801573:	e8 2d f9 ff ff       	call   800ea5 <sys_env_set_pgfault_upcall>
+  801578:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	78 2e                	js     8015af <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801581:	83 ec 08             	sub    $0x8,%esp
+  801584:	6a 02                	push   $0x2
+  801586:	ff 75 e4             	push   -0x1c(%ebp)
+  801589:	e8 7f f8 ff ff       	call   800e0d <sys_env_set_status>
+  80158e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 2b                	js     8015c2 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801597:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80159a:	eb 3b                	jmp    8015d7 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80159c:	83 ec 08             	sub    $0x8,%esp
+  80159f:	50                   	push   %eax
+  8015a0:	68 94 4d 80 00       	push   $0x804d94
+  8015a5:	e8 5c ed ff ff       	call   800306 <cprintf>
+		return r;
+  8015aa:	83 c4 10             	add    $0x10,%esp
+  8015ad:	eb 28                	jmp    8015d7 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8015af:	83 ec 08             	sub    $0x8,%esp
+  8015b2:	50                   	push   %eax
+  8015b3:	68 bc 4d 80 00       	push   $0x804dbc
+  8015b8:	e8 49 ed ff ff       	call   800306 <cprintf>
+		return r;
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	eb 15                	jmp    8015d7 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8015c2:	83 ec 08             	sub    $0x8,%esp
+  8015c5:	50                   	push   %eax
+  8015c6:	68 46 4e 80 00       	push   $0x804e46
+  8015cb:	e8 36 ed ff ff       	call   800306 <cprintf>
+		return r;
+  8015d0:	83 c4 10             	add    $0x10,%esp
+  8015d3:	eb 02                	jmp    8015d7 <fork+0x1f3>
+  8015d5:	89 c7                	mov    %eax,%edi
+}
+  8015d7:	89 f8                	mov    %edi,%eax
+  8015d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5f                   	pop    %edi
+  8015df:	5d                   	pop    %ebp
+  8015e0:	c3                   	ret
+
+008015e1 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	57                   	push   %edi
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 2c             	sub    $0x2c,%esp
+  8015ea:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015ec:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8015f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015f7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8015fd:	77 0a                	ja     801609 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015ff:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801604:	29 c3                	sub    %eax,%ebx
+  801606:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801609:	83 ec 0c             	sub    $0xc,%esp
+  80160c:	68 47 13 80 00       	push   $0x801347
+  801611:	e8 39 2f 00 00       	call   80454f <set_pgfault_handler>
+  801616:	b8 07 00 00 00       	mov    $0x7,%eax
+  80161b:	cd 30                	int    $0x30
+  80161d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801620:	83 c4 10             	add    $0x10,%esp
+  801623:	85 c0                	test   %eax,%eax
+  801625:	78 30                	js     801657 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801627:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80162b:	74 42                	je     80166f <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80162d:	c1 e3 10             	shl    $0x10,%ebx
+  801630:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801635:	29 d8                	sub    %ebx,%eax
+  801637:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80163a:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80163f:	29 d8                	sub    %ebx,%eax
+  801641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801644:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801649:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164e:	89 f7                	mov    %esi,%edi
+  801650:	89 d6                	mov    %edx,%esi
+  801652:	e9 2c 01 00 00       	jmp    801783 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801657:	83 ec 08             	sub    $0x8,%esp
+  80165a:	89 c7                	mov    %eax,%edi
+  80165c:	50                   	push   %eax
+  80165d:	68 21 4e 80 00       	push   $0x804e21
+  801662:	e8 9f ec ff ff       	call   800306 <cprintf>
+		return eid;
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	e9 d5 00 00 00       	jmp    801744 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80166f:	e8 5c f6 ff ff       	call   800cd0 <sys_getenvid>
+  801674:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801679:	89 c2                	mov    %eax,%edx
+  80167b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80167d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801683:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801688:	77 18                	ja     8016a2 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80168a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80168f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801691:	c1 e8 10             	shr    $0x10,%eax
+  801694:	74 0c                	je     8016a2 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801696:	c1 e0 10             	shl    $0x10,%eax
+  801699:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80169e:	29 c1                	sub    %eax,%ecx
+  8016a0:	eb 06                	jmp    8016a8 <sfork+0xc7>
+		return pthread_main_tls;
+  8016a2:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8016a8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016ab:	c1 e0 04             	shl    $0x4,%eax
+  8016ae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016b3:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8016b5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8016b8:	e9 87 00 00 00       	jmp    801744 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016bd:	f6 c5 04             	test   $0x4,%ch
+  8016c0:	74 6c                	je     80172e <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8016c2:	89 ca                	mov    %ecx,%edx
+  8016c4:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8016ca:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8016d0:	74 7c                	je     80174e <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016d2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016d8:	89 da                	mov    %ebx,%edx
+  8016da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016dd:	e8 67 fb ff ff       	call   801249 <duppage>
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	0f 88 4f 01 00 00    	js     801839 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8016ea:	83 c3 01             	add    $0x1,%ebx
+  8016ed:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8016f0:	74 7a                	je     80176c <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8016f2:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8016f4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8016fb:	f6 c1 01             	test   $0x1,%cl
+  8016fe:	74 ea                	je     8016ea <sfork+0x109>
+  801700:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801706:	74 e2                	je     8016ea <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801708:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80170e:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801711:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801716:	76 a5                	jbe    8016bd <sfork+0xdc>
+  801718:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80171e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801721:	39 fa                	cmp    %edi,%edx
+  801723:	73 9d                	jae    8016c2 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801725:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801728:	39 fa                	cmp    %edi,%edx
+  80172a:	72 96                	jb     8016c2 <sfork+0xe1>
+  80172c:	eb 8f                	jmp    8016bd <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80172e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801734:	89 da                	mov    %ebx,%edx
+  801736:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801739:	e8 8c fa ff ff       	call   8011ca <duppage_cow>
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	79 a8                	jns    8016ea <sfork+0x109>
+  801742:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801744:	89 f8                	mov    %edi,%eax
+  801746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801749:	5b                   	pop    %ebx
+  80174a:	5e                   	pop    %esi
+  80174b:	5f                   	pop    %edi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80174e:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801753:	e8 2e fb ff ff       	call   801286 <cow_copy>
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	0f 88 d2 00 00 00    	js     801832 <sfork+0x251>
+				pte = uvpt[pn];
+  801760:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801767:	e9 66 ff ff ff       	jmp    8016d2 <sfork+0xf1>
+  80176c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80176f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801772:	83 c6 01             	add    $0x1,%esi
+  801775:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80177b:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801781:	74 1b                	je     80179e <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801783:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80178a:	a8 01                	test   $0x1,%al
+  80178c:	74 e4                	je     801772 <sfork+0x191>
+  80178e:	89 f3                	mov    %esi,%ebx
+  801790:	c1 e3 0a             	shl    $0xa,%ebx
+  801793:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801796:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801799:	e9 4f ff ff ff       	jmp    8016ed <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80179e:	83 ec 04             	sub    $0x4,%esp
+  8017a1:	6a 07                	push   $0x7
+  8017a3:	68 00 f0 bf ee       	push   $0xeebff000
+  8017a8:	ff 75 e0             	push   -0x20(%ebp)
+  8017ab:	e8 78 f5 ff ff       	call   800d28 <sys_page_alloc>
+  8017b0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 37                	js     8017f0 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	68 8d 45 80 00       	push   $0x80458d
+  8017c1:	ff 75 e0             	push   -0x20(%ebp)
+  8017c4:	e8 dc f6 ff ff       	call   800ea5 <sys_env_set_pgfault_upcall>
+  8017c9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017cb:	83 c4 10             	add    $0x10,%esp
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	78 34                	js     801806 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	6a 02                	push   $0x2
+  8017d7:	ff 75 e0             	push   -0x20(%ebp)
+  8017da:	e8 2e f6 ff ff       	call   800e0d <sys_env_set_status>
+  8017df:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	78 34                	js     80181c <sfork+0x23b>
+	return eid;
+  8017e8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017eb:	e9 54 ff ff ff       	jmp    801744 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8017f0:	83 ec 08             	sub    $0x8,%esp
+  8017f3:	50                   	push   %eax
+  8017f4:	68 94 4d 80 00       	push   $0x804d94
+  8017f9:	e8 08 eb ff ff       	call   800306 <cprintf>
+		return r;
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	e9 3e ff ff ff       	jmp    801744 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801806:	83 ec 08             	sub    $0x8,%esp
+  801809:	50                   	push   %eax
+  80180a:	68 bc 4d 80 00       	push   $0x804dbc
+  80180f:	e8 f2 ea ff ff       	call   800306 <cprintf>
+		return r;
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	e9 28 ff ff ff       	jmp    801744 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	50                   	push   %eax
+  801820:	68 46 4e 80 00       	push   $0x804e46
+  801825:	e8 dc ea ff ff       	call   800306 <cprintf>
+		return r;
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	e9 12 ff ff ff       	jmp    801744 <sfork+0x163>
+  801832:	89 c7                	mov    %eax,%edi
+  801834:	e9 0b ff ff ff       	jmp    801744 <sfork+0x163>
+  801839:	89 c7                	mov    %eax,%edi
+  80183b:	e9 04 ff ff ff       	jmp    801744 <sfork+0x163>
+
+00801840 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801840:	55                   	push   %ebp
+  801841:	89 e5                	mov    %esp,%ebp
+  801843:	57                   	push   %edi
+  801844:	56                   	push   %esi
+  801845:	53                   	push   %ebx
+  801846:	83 ec 18             	sub    $0x18,%esp
+  801849:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80184c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80184f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801852:	85 c0                	test   %eax,%eax
+  801854:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801859:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80185c:	50                   	push   %eax
+  80185d:	e8 bc f6 ff ff       	call   800f1e <sys_ipc_recv>
+	if (r < 0) {
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	85 c0                	test   %eax,%eax
+  801867:	78 2b                	js     801894 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  801869:	85 ff                	test   %edi,%edi
+  80186b:	74 55                	je     8018c2 <ipc_recv+0x82>
+  80186d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80186f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801875:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80187a:	77 39                	ja     8018b5 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80187c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801881:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801883:	c1 e8 10             	shr    $0x10,%eax
+  801886:	74 2d                	je     8018b5 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801888:	c1 e0 10             	shl    $0x10,%eax
+  80188b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801890:	29 c2                	sub    %eax,%edx
+  801892:	eb 27                	jmp    8018bb <ipc_recv+0x7b>
+  801894:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801896:	83 ec 08             	sub    $0x8,%esp
+  801899:	50                   	push   %eax
+  80189a:	68 64 4e 80 00       	push   $0x804e64
+  80189f:	e8 62 ea ff ff       	call   800306 <cprintf>
+		*from_env_store = 0;
+  8018a4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8018aa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	eb 77                	jmp    80192c <ipc_recv+0xec>
+		return pthread_main_tls;
+  8018b5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8018bb:	8b 02                	mov    (%edx),%eax
+  8018bd:	8b 40 78             	mov    0x78(%eax),%eax
+  8018c0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8018c2:	85 f6                	test   %esi,%esi
+  8018c4:	74 34                	je     8018fa <ipc_recv+0xba>
+  8018c6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018c8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8018ce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018d3:	77 18                	ja     8018ed <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018d5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018da:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018dc:	c1 e8 10             	shr    $0x10,%eax
+  8018df:	74 0c                	je     8018ed <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018e1:	c1 e0 10             	shl    $0x10,%eax
+  8018e4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018e9:	29 c2                	sub    %eax,%edx
+  8018eb:	eb 06                	jmp    8018f3 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8018ed:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8018f3:	8b 02                	mov    (%edx),%eax
+  8018f5:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8018f8:	89 06                	mov    %eax,(%esi)
+  8018fa:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018fc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801902:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801907:	77 18                	ja     801921 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801909:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80190e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801910:	c1 e8 10             	shr    $0x10,%eax
+  801913:	74 0c                	je     801921 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801915:	c1 e0 10             	shl    $0x10,%eax
+  801918:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80191d:	29 c2                	sub    %eax,%edx
+  80191f:	eb 06                	jmp    801927 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  801921:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  801927:	8b 02                	mov    (%edx),%eax
+  801929:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80192c:	89 d8                	mov    %ebx,%eax
+  80192e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801931:	5b                   	pop    %ebx
+  801932:	5e                   	pop    %esi
+  801933:	5f                   	pop    %edi
+  801934:	5d                   	pop    %ebp
+  801935:	c3                   	ret
+
+00801936 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	57                   	push   %edi
+  80193a:	56                   	push   %esi
+  80193b:	53                   	push   %ebx
+  80193c:	83 ec 0c             	sub    $0xc,%esp
+  80193f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801942:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801945:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  801948:	85 db                	test   %ebx,%ebx
+  80194a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80194f:	0f 44 d8             	cmove  %eax,%ebx
+  801952:	eb 05                	jmp    801959 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801954:	e8 a3 f3 ff ff       	call   800cfc <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801959:	57                   	push   %edi
+  80195a:	53                   	push   %ebx
+  80195b:	ff 75 0c             	push   0xc(%ebp)
+  80195e:	56                   	push   %esi
+  80195f:	e8 8d f5 ff ff       	call   800ef1 <sys_ipc_try_send>
+		if (r == 0) {
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	85 c0                	test   %eax,%eax
+  801969:	74 19                	je     801984 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80196b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80196e:	74 e4                	je     801954 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  801970:	83 ec 0c             	sub    $0xc,%esp
+  801973:	50                   	push   %eax
+  801974:	57                   	push   %edi
+  801975:	53                   	push   %ebx
+  801976:	56                   	push   %esi
+  801977:	68 80 4e 80 00       	push   $0x804e80
+  80197c:	e8 85 e9 ff ff       	call   800306 <cprintf>
+			return;
+  801981:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  801984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801987:	5b                   	pop    %ebx
+  801988:	5e                   	pop    %esi
+  801989:	5f                   	pop    %edi
+  80198a:	5d                   	pop    %ebp
+  80198b:	c3                   	ret
+
+0080198c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801992:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801997:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80199a:	c1 e0 04             	shl    $0x4,%eax
+  80199d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019a2:	8b 40 50             	mov    0x50(%eax),%eax
+  8019a5:	39 c8                	cmp    %ecx,%eax
+  8019a7:	74 12                	je     8019bb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8019a9:	83 c2 01             	add    $0x1,%edx
+  8019ac:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8019b2:	75 e3                	jne    801997 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b9:	eb 0e                	jmp    8019c9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8019bb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8019be:	c1 e0 04             	shl    $0x4,%eax
+  8019c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019c6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8019c9:	5d                   	pop    %ebp
+  8019ca:	c3                   	ret
+
+008019cb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019cb:	55                   	push   %ebp
+  8019cc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019d6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+
+008019db <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019e6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019eb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019f0:	5d                   	pop    %ebp
+  8019f1:	c3                   	ret
+
+008019f2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019f5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019fa:	eb 02                	jmp    8019fe <fd_alloc+0xc>
+  8019fc:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019fe:	89 c2                	mov    %eax,%edx
+  801a00:	c1 ea 16             	shr    $0x16,%edx
+  801a03:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a0a:	f6 c2 01             	test   $0x1,%dl
+  801a0d:	74 2b                	je     801a3a <fd_alloc+0x48>
+  801a0f:	89 c2                	mov    %eax,%edx
+  801a11:	c1 ea 0c             	shr    $0xc,%edx
+  801a14:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a1b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a21:	f6 c1 01             	test   $0x1,%cl
+  801a24:	74 14                	je     801a3a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a26:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a2c:	75 ce                	jne    8019fc <fd_alloc+0xa>
+  801a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a33:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a38:	eb 05                	jmp    801a3f <fd_alloc+0x4d>
+			return 0;
+  801a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a42:	89 02                	mov    %eax,(%edx)
+}
+  801a44:	89 c8                	mov    %ecx,%eax
+  801a46:	5d                   	pop    %ebp
+  801a47:	c3                   	ret
+
+00801a48 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a4e:	83 f8 1f             	cmp    $0x1f,%eax
+  801a51:	77 30                	ja     801a83 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a53:	c1 e0 0c             	shl    $0xc,%eax
+  801a56:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a5b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a61:	f6 c2 01             	test   $0x1,%dl
+  801a64:	74 24                	je     801a8a <fd_lookup+0x42>
+  801a66:	89 c2                	mov    %eax,%edx
+  801a68:	c1 ea 0c             	shr    $0xc,%edx
+  801a6b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a72:	f6 c2 01             	test   $0x1,%dl
+  801a75:	74 1a                	je     801a91 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a7a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a81:	5d                   	pop    %ebp
+  801a82:	c3                   	ret
+		return -E_INVAL;
+  801a83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a88:	eb f7                	jmp    801a81 <fd_lookup+0x39>
+		return -E_INVAL;
+  801a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8f:	eb f0                	jmp    801a81 <fd_lookup+0x39>
+  801a91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a96:	eb e9                	jmp    801a81 <fd_lookup+0x39>
+
+00801a98 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	53                   	push   %ebx
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+  801a9f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa7:	eb 03                	jmp    801aac <dev_lookup+0x14>
+  801aa9:	83 c0 01             	add    $0x1,%eax
+  801aac:	8b 1c 85 34 4f 80 00 	mov    0x804f34(,%eax,4),%ebx
+  801ab3:	85 db                	test   %ebx,%ebx
+  801ab5:	74 0b                	je     801ac2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801ab7:	39 13                	cmp    %edx,(%ebx)
+  801ab9:	75 ee                	jne    801aa9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac0:	eb 49                	jmp    801b0b <dev_lookup+0x73>
+  801ac2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ac4:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801aca:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801acf:	77 18                	ja     801ae9 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ad1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ad6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801ad8:	c1 e8 10             	shr    $0x10,%eax
+  801adb:	74 0c                	je     801ae9 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801add:	c1 e0 10             	shl    $0x10,%eax
+  801ae0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801ae5:	29 c1                	sub    %eax,%ecx
+  801ae7:	eb 06                	jmp    801aef <dev_lookup+0x57>
+		return pthread_main_tls;
+  801ae9:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aef:	8b 01                	mov    (%ecx),%eax
+  801af1:	8b 40 48             	mov    0x48(%eax),%eax
+  801af4:	83 ec 04             	sub    $0x4,%esp
+  801af7:	52                   	push   %edx
+  801af8:	50                   	push   %eax
+  801af9:	68 b8 4e 80 00       	push   $0x804eb8
+  801afe:	e8 03 e8 ff ff       	call   800306 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b03:	83 c4 10             	add    $0x10,%esp
+  801b06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b0e:	89 1a                	mov    %ebx,(%edx)
+}
+  801b10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b13:	c9                   	leave
+  801b14:	c3                   	ret
+
+00801b15 <fd_close>:
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	57                   	push   %edi
+  801b19:	56                   	push   %esi
+  801b1a:	53                   	push   %ebx
+  801b1b:	83 ec 24             	sub    $0x24,%esp
+  801b1e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b21:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b24:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b27:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b28:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b2e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b31:	50                   	push   %eax
+  801b32:	e8 11 ff ff ff       	call   801a48 <fd_lookup>
+  801b37:	89 c3                	mov    %eax,%ebx
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	85 c0                	test   %eax,%eax
+  801b3e:	78 05                	js     801b45 <fd_close+0x30>
+	    || fd != fd2)
+  801b40:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b43:	74 16                	je     801b5b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b45:	89 f8                	mov    %edi,%eax
+  801b47:	84 c0                	test   %al,%al
+  801b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b51:	89 d8                	mov    %ebx,%eax
+  801b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b56:	5b                   	pop    %ebx
+  801b57:	5e                   	pop    %esi
+  801b58:	5f                   	pop    %edi
+  801b59:	5d                   	pop    %ebp
+  801b5a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+  801b5e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b61:	50                   	push   %eax
+  801b62:	ff 36                	push   (%esi)
+  801b64:	e8 2f ff ff ff       	call   801a98 <dev_lookup>
+  801b69:	89 c3                	mov    %eax,%ebx
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 1a                	js     801b8c <fd_close+0x77>
+		if (dev->dev_close)
+  801b72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b75:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b78:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	74 0b                	je     801b8c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b81:	83 ec 0c             	sub    $0xc,%esp
+  801b84:	56                   	push   %esi
+  801b85:	ff d0                	call   *%eax
+  801b87:	89 c3                	mov    %eax,%ebx
+  801b89:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b8c:	83 ec 08             	sub    $0x8,%esp
+  801b8f:	56                   	push   %esi
+  801b90:	6a 00                	push   $0x0
+  801b92:	e8 2a f2 ff ff       	call   800dc1 <sys_page_unmap>
+	return r;
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	eb b5                	jmp    801b51 <fd_close+0x3c>
+
+00801b9c <close>:
+
+int
+close(int fdnum)
+{
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ba2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba5:	50                   	push   %eax
+  801ba6:	ff 75 08             	push   0x8(%ebp)
+  801ba9:	e8 9a fe ff ff       	call   801a48 <fd_lookup>
+  801bae:	83 c4 10             	add    $0x10,%esp
+  801bb1:	85 c0                	test   %eax,%eax
+  801bb3:	79 02                	jns    801bb7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+		return fd_close(fd, 1);
+  801bb7:	83 ec 08             	sub    $0x8,%esp
+  801bba:	6a 01                	push   $0x1
+  801bbc:	ff 75 f4             	push   -0xc(%ebp)
+  801bbf:	e8 51 ff ff ff       	call   801b15 <fd_close>
+  801bc4:	83 c4 10             	add    $0x10,%esp
+  801bc7:	eb ec                	jmp    801bb5 <close+0x19>
+
+00801bc9 <close_all>:
+
+void
+close_all(void)
+{
+  801bc9:	55                   	push   %ebp
+  801bca:	89 e5                	mov    %esp,%ebp
+  801bcc:	53                   	push   %ebx
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801bd5:	83 ec 0c             	sub    $0xc,%esp
+  801bd8:	53                   	push   %ebx
+  801bd9:	e8 be ff ff ff       	call   801b9c <close>
+	for (i = 0; i < MAXFD; i++)
+  801bde:	83 c3 01             	add    $0x1,%ebx
+  801be1:	83 c4 10             	add    $0x10,%esp
+  801be4:	83 fb 20             	cmp    $0x20,%ebx
+  801be7:	75 ec                	jne    801bd5 <close_all+0xc>
+}
+  801be9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bec:	c9                   	leave
+  801bed:	c3                   	ret
+
+00801bee <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	57                   	push   %edi
+  801bf2:	56                   	push   %esi
+  801bf3:	53                   	push   %ebx
+  801bf4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bf7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bfa:	50                   	push   %eax
+  801bfb:	ff 75 08             	push   0x8(%ebp)
+  801bfe:	e8 45 fe ff ff       	call   801a48 <fd_lookup>
+  801c03:	89 c3                	mov    %eax,%ebx
+  801c05:	83 c4 10             	add    $0x10,%esp
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 7f                	js     801c8b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c0c:	83 ec 0c             	sub    $0xc,%esp
+  801c0f:	ff 75 0c             	push   0xc(%ebp)
+  801c12:	e8 85 ff ff ff       	call   801b9c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c17:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c1a:	c1 e6 0c             	shl    $0xc,%esi
+  801c1d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c26:	89 3c 24             	mov    %edi,(%esp)
+  801c29:	e8 ad fd ff ff       	call   8019db <fd2data>
+  801c2e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c30:	89 34 24             	mov    %esi,(%esp)
+  801c33:	e8 a3 fd ff ff       	call   8019db <fd2data>
+  801c38:	83 c4 10             	add    $0x10,%esp
+  801c3b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c3e:	89 d8                	mov    %ebx,%eax
+  801c40:	c1 e8 16             	shr    $0x16,%eax
+  801c43:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c4a:	a8 01                	test   $0x1,%al
+  801c4c:	74 11                	je     801c5f <dup+0x71>
+  801c4e:	89 d8                	mov    %ebx,%eax
+  801c50:	c1 e8 0c             	shr    $0xc,%eax
+  801c53:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c5a:	f6 c2 01             	test   $0x1,%dl
+  801c5d:	75 36                	jne    801c95 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c5f:	89 f8                	mov    %edi,%eax
+  801c61:	c1 e8 0c             	shr    $0xc,%eax
+  801c64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c6b:	83 ec 0c             	sub    $0xc,%esp
+  801c6e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c73:	50                   	push   %eax
+  801c74:	56                   	push   %esi
+  801c75:	6a 00                	push   $0x0
+  801c77:	57                   	push   %edi
+  801c78:	6a 00                	push   $0x0
+  801c7a:	e8 f6 f0 ff ff       	call   800d75 <sys_page_map>
+  801c7f:	89 c3                	mov    %eax,%ebx
+  801c81:	83 c4 20             	add    $0x20,%esp
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	78 33                	js     801cbb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c8b:	89 d8                	mov    %ebx,%eax
+  801c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5f                   	pop    %edi
+  801c93:	5d                   	pop    %ebp
+  801c94:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c95:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c9c:	83 ec 0c             	sub    $0xc,%esp
+  801c9f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ca4:	50                   	push   %eax
+  801ca5:	ff 75 d4             	push   -0x2c(%ebp)
+  801ca8:	6a 00                	push   $0x0
+  801caa:	53                   	push   %ebx
+  801cab:	6a 00                	push   $0x0
+  801cad:	e8 c3 f0 ff ff       	call   800d75 <sys_page_map>
+  801cb2:	89 c3                	mov    %eax,%ebx
+  801cb4:	83 c4 20             	add    $0x20,%esp
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	79 a4                	jns    801c5f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801cbb:	83 ec 08             	sub    $0x8,%esp
+  801cbe:	56                   	push   %esi
+  801cbf:	6a 00                	push   $0x0
+  801cc1:	e8 fb f0 ff ff       	call   800dc1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801cc6:	83 c4 08             	add    $0x8,%esp
+  801cc9:	ff 75 d4             	push   -0x2c(%ebp)
+  801ccc:	6a 00                	push   $0x0
+  801cce:	e8 ee f0 ff ff       	call   800dc1 <sys_page_unmap>
+	return r;
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	eb b3                	jmp    801c8b <dup+0x9d>
+
+00801cd8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	56                   	push   %esi
+  801cdc:	53                   	push   %ebx
+  801cdd:	83 ec 18             	sub    $0x18,%esp
+  801ce0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	53                   	push   %ebx
+  801ce8:	e8 5b fd ff ff       	call   801a48 <fd_lookup>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 3c                	js     801d30 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfd:	50                   	push   %eax
+  801cfe:	ff 36                	push   (%esi)
+  801d00:	e8 93 fd ff ff       	call   801a98 <dev_lookup>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 24                	js     801d30 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d0c:	8b 46 08             	mov    0x8(%esi),%eax
+  801d0f:	83 e0 03             	and    $0x3,%eax
+  801d12:	83 f8 01             	cmp    $0x1,%eax
+  801d15:	74 20                	je     801d37 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1a:	8b 40 08             	mov    0x8(%eax),%eax
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	74 61                	je     801d82 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d21:	83 ec 04             	sub    $0x4,%esp
+  801d24:	ff 75 10             	push   0x10(%ebp)
+  801d27:	ff 75 0c             	push   0xc(%ebp)
+  801d2a:	56                   	push   %esi
+  801d2b:	ff d0                	call   *%eax
+  801d2d:	83 c4 10             	add    $0x10,%esp
+}
+  801d30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d33:	5b                   	pop    %ebx
+  801d34:	5e                   	pop    %esi
+  801d35:	5d                   	pop    %ebp
+  801d36:	c3                   	ret
+  801d37:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d39:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d3f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d44:	77 18                	ja     801d5e <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d46:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d4b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d4d:	c1 e8 10             	shr    $0x10,%eax
+  801d50:	74 0c                	je     801d5e <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d52:	c1 e0 10             	shl    $0x10,%eax
+  801d55:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d5a:	29 c2                	sub    %eax,%edx
+  801d5c:	eb 06                	jmp    801d64 <read+0x8c>
+		return pthread_main_tls;
+  801d5e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d64:	8b 02                	mov    (%edx),%eax
+  801d66:	8b 40 48             	mov    0x48(%eax),%eax
+  801d69:	83 ec 04             	sub    $0x4,%esp
+  801d6c:	53                   	push   %ebx
+  801d6d:	50                   	push   %eax
+  801d6e:	68 f9 4e 80 00       	push   $0x804ef9
+  801d73:	e8 8e e5 ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d80:	eb ae                	jmp    801d30 <read+0x58>
+		return -E_NOT_SUPP;
+  801d82:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d87:	eb a7                	jmp    801d30 <read+0x58>
+
+00801d89 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	57                   	push   %edi
+  801d8d:	56                   	push   %esi
+  801d8e:	53                   	push   %ebx
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d95:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9d:	eb 02                	jmp    801da1 <readn+0x18>
+  801d9f:	01 c3                	add    %eax,%ebx
+  801da1:	39 f3                	cmp    %esi,%ebx
+  801da3:	73 21                	jae    801dc6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	89 f0                	mov    %esi,%eax
+  801daa:	29 d8                	sub    %ebx,%eax
+  801dac:	50                   	push   %eax
+  801dad:	89 d8                	mov    %ebx,%eax
+  801daf:	03 45 0c             	add    0xc(%ebp),%eax
+  801db2:	50                   	push   %eax
+  801db3:	57                   	push   %edi
+  801db4:	e8 1f ff ff ff       	call   801cd8 <read>
+		if (m < 0)
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 04                	js     801dc4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801dc0:	75 dd                	jne    801d9f <readn+0x16>
+  801dc2:	eb 02                	jmp    801dc6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801dc4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801dc6:	89 d8                	mov    %ebx,%eax
+  801dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcb:	5b                   	pop    %ebx
+  801dcc:	5e                   	pop    %esi
+  801dcd:	5f                   	pop    %edi
+  801dce:	5d                   	pop    %ebp
+  801dcf:	c3                   	ret
+
+00801dd0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	56                   	push   %esi
+  801dd4:	53                   	push   %ebx
+  801dd5:	83 ec 18             	sub    $0x18,%esp
+  801dd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ddb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dde:	50                   	push   %eax
+  801ddf:	53                   	push   %ebx
+  801de0:	e8 63 fc ff ff       	call   801a48 <fd_lookup>
+  801de5:	83 c4 10             	add    $0x10,%esp
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 37                	js     801e23 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801def:	83 ec 08             	sub    $0x8,%esp
+  801df2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df5:	50                   	push   %eax
+  801df6:	ff 36                	push   (%esi)
+  801df8:	e8 9b fc ff ff       	call   801a98 <dev_lookup>
+  801dfd:	83 c4 10             	add    $0x10,%esp
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	78 1f                	js     801e23 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e04:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e08:	74 20                	je     801e2a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e0d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	74 61                	je     801e75 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e14:	83 ec 04             	sub    $0x4,%esp
+  801e17:	ff 75 10             	push   0x10(%ebp)
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	56                   	push   %esi
+  801e1e:	ff d0                	call   *%eax
+  801e20:	83 c4 10             	add    $0x10,%esp
+}
+  801e23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e26:	5b                   	pop    %ebx
+  801e27:	5e                   	pop    %esi
+  801e28:	5d                   	pop    %ebp
+  801e29:	c3                   	ret
+  801e2a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e2c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e32:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e37:	77 18                	ja     801e51 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e39:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e3e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e40:	c1 e8 10             	shr    $0x10,%eax
+  801e43:	74 0c                	je     801e51 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e45:	c1 e0 10             	shl    $0x10,%eax
+  801e48:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e4d:	29 c2                	sub    %eax,%edx
+  801e4f:	eb 06                	jmp    801e57 <write+0x87>
+		return pthread_main_tls;
+  801e51:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e57:	8b 02                	mov    (%edx),%eax
+  801e59:	8b 40 48             	mov    0x48(%eax),%eax
+  801e5c:	83 ec 04             	sub    $0x4,%esp
+  801e5f:	53                   	push   %ebx
+  801e60:	50                   	push   %eax
+  801e61:	68 15 4f 80 00       	push   $0x804f15
+  801e66:	e8 9b e4 ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e73:	eb ae                	jmp    801e23 <write+0x53>
+		return -E_NOT_SUPP;
+  801e75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e7a:	eb a7                	jmp    801e23 <write+0x53>
+
+00801e7c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e7c:	55                   	push   %ebp
+  801e7d:	89 e5                	mov    %esp,%ebp
+  801e7f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e85:	50                   	push   %eax
+  801e86:	ff 75 08             	push   0x8(%ebp)
+  801e89:	e8 ba fb ff ff       	call   801a48 <fd_lookup>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 0e                	js     801ea3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e9b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+00801ea5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	56                   	push   %esi
+  801ea9:	53                   	push   %ebx
+  801eaa:	83 ec 18             	sub    $0x18,%esp
+  801ead:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801eb0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eb3:	50                   	push   %eax
+  801eb4:	53                   	push   %ebx
+  801eb5:	e8 8e fb ff ff       	call   801a48 <fd_lookup>
+  801eba:	83 c4 10             	add    $0x10,%esp
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 34                	js     801ef5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ec1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ec4:	83 ec 08             	sub    $0x8,%esp
+  801ec7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eca:	50                   	push   %eax
+  801ecb:	ff 36                	push   (%esi)
+  801ecd:	e8 c6 fb ff ff       	call   801a98 <dev_lookup>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 1c                	js     801ef5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ed9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801edd:	74 1d                	je     801efc <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801edf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee2:	8b 40 18             	mov    0x18(%eax),%eax
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	74 5e                	je     801f47 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	ff 75 0c             	push   0xc(%ebp)
+  801eef:	56                   	push   %esi
+  801ef0:	ff d0                	call   *%eax
+  801ef2:	83 c4 10             	add    $0x10,%esp
+}
+  801ef5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef8:	5b                   	pop    %ebx
+  801ef9:	5e                   	pop    %esi
+  801efa:	5d                   	pop    %ebp
+  801efb:	c3                   	ret
+  801efc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801efe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f04:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f09:	77 18                	ja     801f23 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f0b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f10:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f12:	c1 e8 10             	shr    $0x10,%eax
+  801f15:	74 0c                	je     801f23 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f17:	c1 e0 10             	shl    $0x10,%eax
+  801f1a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f1f:	29 c2                	sub    %eax,%edx
+  801f21:	eb 06                	jmp    801f29 <ftruncate+0x84>
+		return pthread_main_tls;
+  801f23:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801f29:	8b 02                	mov    (%edx),%eax
+  801f2b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f2e:	83 ec 04             	sub    $0x4,%esp
+  801f31:	53                   	push   %ebx
+  801f32:	50                   	push   %eax
+  801f33:	68 d8 4e 80 00       	push   $0x804ed8
+  801f38:	e8 c9 e3 ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f45:	eb ae                	jmp    801ef5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f47:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f4c:	eb a7                	jmp    801ef5 <ftruncate+0x50>
+
+00801f4e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f4e:	55                   	push   %ebp
+  801f4f:	89 e5                	mov    %esp,%ebp
+  801f51:	56                   	push   %esi
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 18             	sub    $0x18,%esp
+  801f56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f5c:	50                   	push   %eax
+  801f5d:	ff 75 08             	push   0x8(%ebp)
+  801f60:	e8 e3 fa ff ff       	call   801a48 <fd_lookup>
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	78 49                	js     801fb5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f6c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f6f:	83 ec 08             	sub    $0x8,%esp
+  801f72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f75:	50                   	push   %eax
+  801f76:	ff 36                	push   (%esi)
+  801f78:	e8 1b fb ff ff       	call   801a98 <dev_lookup>
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 31                	js     801fb5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f87:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f8b:	74 2f                	je     801fbc <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f8d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f90:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f97:	00 00 00 
+	stat->st_isdir = 0;
+  801f9a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fa1:	00 00 00 
+	stat->st_dev = dev;
+  801fa4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801faa:	83 ec 08             	sub    $0x8,%esp
+  801fad:	53                   	push   %ebx
+  801fae:	56                   	push   %esi
+  801faf:	ff 50 14             	call   *0x14(%eax)
+  801fb2:	83 c4 10             	add    $0x10,%esp
+}
+  801fb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb8:	5b                   	pop    %ebx
+  801fb9:	5e                   	pop    %esi
+  801fba:	5d                   	pop    %ebp
+  801fbb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fbc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fc1:	eb f2                	jmp    801fb5 <fstat+0x67>
+
+00801fc3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801fc3:	55                   	push   %ebp
+  801fc4:	89 e5                	mov    %esp,%ebp
+  801fc6:	56                   	push   %esi
+  801fc7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801fc8:	83 ec 08             	sub    $0x8,%esp
+  801fcb:	6a 00                	push   $0x0
+  801fcd:	ff 75 08             	push   0x8(%ebp)
+  801fd0:	e8 4b 03 00 00       	call   802320 <open>
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 1b                	js     801ff9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fde:	83 ec 08             	sub    $0x8,%esp
+  801fe1:	ff 75 0c             	push   0xc(%ebp)
+  801fe4:	50                   	push   %eax
+  801fe5:	e8 64 ff ff ff       	call   801f4e <fstat>
+  801fea:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fec:	89 1c 24             	mov    %ebx,(%esp)
+  801fef:	e8 a8 fb ff ff       	call   801b9c <close>
+	return r;
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	89 f3                	mov    %esi,%ebx
+}
+  801ff9:	89 d8                	mov    %ebx,%eax
+  801ffb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffe:	5b                   	pop    %ebx
+  801fff:	5e                   	pop    %esi
+  802000:	5d                   	pop    %ebp
+  802001:	c3                   	ret
+
+00802002 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802002:	55                   	push   %ebp
+  802003:	89 e5                	mov    %esp,%ebp
+  802005:	56                   	push   %esi
+  802006:	53                   	push   %ebx
+  802007:	89 c6                	mov    %eax,%esi
+  802009:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80200b:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802012:	74 27                	je     80203b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802014:	6a 07                	push   $0x7
+  802016:	68 00 80 80 00       	push   $0x808000
+  80201b:	56                   	push   %esi
+  80201c:	ff 35 00 70 80 00    	push   0x807000
+  802022:	e8 0f f9 ff ff       	call   801936 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802027:	83 c4 0c             	add    $0xc,%esp
+  80202a:	6a 00                	push   $0x0
+  80202c:	53                   	push   %ebx
+  80202d:	6a 00                	push   $0x0
+  80202f:	e8 0c f8 ff ff       	call   801840 <ipc_recv>
+}
+  802034:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802037:	5b                   	pop    %ebx
+  802038:	5e                   	pop    %esi
+  802039:	5d                   	pop    %ebp
+  80203a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80203b:	83 ec 0c             	sub    $0xc,%esp
+  80203e:	6a 01                	push   $0x1
+  802040:	e8 47 f9 ff ff       	call   80198c <ipc_find_env>
+  802045:	a3 00 70 80 00       	mov    %eax,0x807000
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	eb c5                	jmp    802014 <fsipc+0x12>
+
+0080204f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	53                   	push   %ebx
+  802053:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802056:	68 04 70 80 00       	push   $0x807004
+  80205b:	e8 29 1b 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802060:	8b 45 08             	mov    0x8(%ebp),%eax
+  802063:	8b 40 0c             	mov    0xc(%eax),%eax
+  802066:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  80206b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206e:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  802073:	ba 00 00 00 00       	mov    $0x0,%edx
+  802078:	b8 02 00 00 00       	mov    $0x2,%eax
+  80207d:	e8 80 ff ff ff       	call   802002 <fsipc>
+  802082:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802084:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80208b:	e8 66 1b 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+}
+  802090:	89 d8                	mov    %ebx,%eax
+  802092:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+
+00802097 <devfile_flush>:
+{
+  802097:	55                   	push   %ebp
+  802098:	89 e5                	mov    %esp,%ebp
+  80209a:	53                   	push   %ebx
+  80209b:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80209e:	68 04 70 80 00       	push   $0x807004
+  8020a3:	e8 e1 1a 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020ae:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8020b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020bd:	e8 40 ff ff ff       	call   802002 <fsipc>
+  8020c2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020c4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020cb:	e8 26 1b 00 00       	call   803bf6 <mutex_unlock>
+}
+  8020d0:	89 d8                	mov    %ebx,%eax
+  8020d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d5:	c9                   	leave
+  8020d6:	c3                   	ret
+
+008020d7 <devfile_stat>:
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	56                   	push   %esi
+  8020db:	53                   	push   %ebx
+  8020dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8020df:	83 ec 0c             	sub    $0xc,%esp
+  8020e2:	68 04 70 80 00       	push   $0x807004
+  8020e7:	e8 9d 1a 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  8020f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  802101:	e8 fc fe ff ff       	call   802002 <fsipc>
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	79 16                	jns    802125 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80210f:	83 ec 0c             	sub    $0xc,%esp
+  802112:	68 04 70 80 00       	push   $0x807004
+  802117:	e8 da 1a 00 00       	call   803bf6 <mutex_unlock>
+}
+  80211c:	89 d8                	mov    %ebx,%eax
+  80211e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802121:	5b                   	pop    %ebx
+  802122:	5e                   	pop    %esi
+  802123:	5d                   	pop    %ebp
+  802124:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802125:	83 ec 08             	sub    $0x8,%esp
+  802128:	68 00 80 80 00       	push   $0x808000
+  80212d:	56                   	push   %esi
+  80212e:	e8 b7 e7 ff ff       	call   8008ea <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802133:	a1 80 80 80 00       	mov    0x808080,%eax
+  802138:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80213e:	a1 84 80 80 00       	mov    0x808084,%eax
+  802143:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802149:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80214c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802151:	eb bc                	jmp    80210f <devfile_stat+0x38>
+
+00802153 <devfile_write>:
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	53                   	push   %ebx
+  802157:	83 ec 10             	sub    $0x10,%esp
+  80215a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80215d:	68 04 70 80 00       	push   $0x807004
+  802162:	e8 22 1a 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80216d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80217b:	76 3d                	jbe    8021ba <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80217d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802182:	39 c3                	cmp    %eax,%ebx
+  802184:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802187:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80218a:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  80218f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80219f:	e8 5e fe ff ff       	call   802002 <fsipc>
+  8021a4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021a6:	83 ec 0c             	sub    $0xc,%esp
+  8021a9:	68 04 70 80 00       	push   $0x807004
+  8021ae:	e8 43 1a 00 00       	call   803bf6 <mutex_unlock>
+}
+  8021b3:	89 d8                	mov    %ebx,%eax
+  8021b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8021ba:	83 ec 04             	sub    $0x4,%esp
+  8021bd:	53                   	push   %ebx
+  8021be:	ff 75 0c             	push   0xc(%ebp)
+  8021c1:	68 0c 80 80 00       	push   $0x80800c
+  8021c6:	e8 a5 e8 ff ff       	call   800a70 <memmove>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d3:	eb b5                	jmp    80218a <devfile_write+0x37>
+
+008021d5 <devfile_read>:
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	57                   	push   %edi
+  8021d9:	56                   	push   %esi
+  8021da:	53                   	push   %ebx
+  8021db:	83 ec 0c             	sub    $0xc,%esp
+  8021de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021e1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8021e7:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8021ed:	0f 86 8c 00 00 00    	jbe    80227f <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8021f3:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8021f8:	39 c3                	cmp    %eax,%ebx
+  8021fa:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8021fd:	89 f8                	mov    %edi,%eax
+  8021ff:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802202:	eb 0f                	jmp    802213 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802204:	0f b6 08             	movzbl (%eax),%ecx
+  802207:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802209:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80220e:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802213:	39 d0                	cmp    %edx,%eax
+  802215:	72 ed                	jb     802204 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802217:	83 ec 0c             	sub    $0xc,%esp
+  80221a:	68 04 70 80 00       	push   $0x807004
+  80221f:	e8 65 19 00 00       	call   803b89 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802224:	8b 46 0c             	mov    0xc(%esi),%eax
+  802227:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  80222c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802232:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  802238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802242:	e8 bb fd ff ff       	call   802002 <fsipc>
+  802247:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802249:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802250:	e8 a1 19 00 00       	call   803bf6 <mutex_unlock>
+		assert(r <= (int) n);
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	39 f3                	cmp    %esi,%ebx
+  80225a:	7c 0a                	jl     802266 <devfile_read+0x91>
+}
+  80225c:	89 f0                	mov    %esi,%eax
+  80225e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802261:	5b                   	pop    %ebx
+  802262:	5e                   	pop    %esi
+  802263:	5f                   	pop    %edi
+  802264:	5d                   	pop    %ebp
+  802265:	c3                   	ret
+		assert(r <= (int) n);
+  802266:	68 48 4f 80 00       	push   $0x804f48
+  80226b:	68 31 4e 80 00       	push   $0x804e31
+  802270:	68 90 00 00 00       	push   $0x90
+  802275:	68 55 4f 80 00       	push   $0x804f55
+  80227a:	e8 8a 22 00 00       	call   804509 <_panic>
+	mutex_lock(&fsipc_mu);
+  80227f:	83 ec 0c             	sub    $0xc,%esp
+  802282:	68 04 70 80 00       	push   $0x807004
+  802287:	e8 fd 18 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80228c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80228f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802294:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  80229a:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8022a1:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8022a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022ae:	e8 4f fd ff ff       	call   802002 <fsipc>
+  8022b3:	89 c6                	mov    %eax,%esi
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	78 1d                	js     8022d9 <devfile_read+0x104>
+		assert(r <= n);
+  8022bc:	39 c3                	cmp    %eax,%ebx
+  8022be:	72 2e                	jb     8022ee <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8022c0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022c5:	7f 40                	jg     802307 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022c7:	83 ec 04             	sub    $0x4,%esp
+  8022ca:	50                   	push   %eax
+  8022cb:	68 00 80 80 00       	push   $0x808000
+  8022d0:	57                   	push   %edi
+  8022d1:	e8 9a e7 ff ff       	call   800a70 <memmove>
+  8022d6:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8022d9:	83 ec 0c             	sub    $0xc,%esp
+  8022dc:	68 04 70 80 00       	push   $0x807004
+  8022e1:	e8 10 19 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	e9 6e ff ff ff       	jmp    80225c <devfile_read+0x87>
+		assert(r <= n);
+  8022ee:	68 60 4f 80 00       	push   $0x804f60
+  8022f3:	68 31 4e 80 00       	push   $0x804e31
+  8022f8:	68 99 00 00 00       	push   $0x99
+  8022fd:	68 55 4f 80 00       	push   $0x804f55
+  802302:	e8 02 22 00 00       	call   804509 <_panic>
+		assert(r <= PGSIZE);
+  802307:	68 67 4f 80 00       	push   $0x804f67
+  80230c:	68 31 4e 80 00       	push   $0x804e31
+  802311:	68 9a 00 00 00       	push   $0x9a
+  802316:	68 55 4f 80 00       	push   $0x804f55
+  80231b:	e8 e9 21 00 00       	call   804509 <_panic>
+
+00802320 <open>:
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	56                   	push   %esi
+  802324:	53                   	push   %ebx
+  802325:	83 ec 1c             	sub    $0x1c,%esp
+  802328:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80232b:	56                   	push   %esi
+  80232c:	e8 7e e5 ff ff       	call   8008af <strlen>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802339:	0f 8f 85 00 00 00    	jg     8023c4 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  80233f:	83 ec 0c             	sub    $0xc,%esp
+  802342:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802345:	50                   	push   %eax
+  802346:	e8 a7 f6 ff ff       	call   8019f2 <fd_alloc>
+  80234b:	89 c3                	mov    %eax,%ebx
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	78 55                	js     8023a9 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802354:	83 ec 0c             	sub    $0xc,%esp
+  802357:	68 04 70 80 00       	push   $0x807004
+  80235c:	e8 28 18 00 00       	call   803b89 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802361:	83 c4 08             	add    $0x8,%esp
+  802364:	56                   	push   %esi
+  802365:	68 00 80 80 00       	push   $0x808000
+  80236a:	e8 7b e5 ff ff       	call   8008ea <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80236f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802372:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  802377:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80237a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80237f:	e8 7e fc ff ff       	call   802002 <fsipc>
+  802384:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802386:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80238d:	e8 64 18 00 00       	call   803bf6 <mutex_unlock>
+	if (r < 0) {
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	85 db                	test   %ebx,%ebx
+  802397:	78 19                	js     8023b2 <open+0x92>
+	return fd2num(fd);
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	ff 75 f4             	push   -0xc(%ebp)
+  80239f:	e8 27 f6 ff ff       	call   8019cb <fd2num>
+  8023a4:	89 c3                	mov    %eax,%ebx
+  8023a6:	83 c4 10             	add    $0x10,%esp
+}
+  8023a9:	89 d8                	mov    %ebx,%eax
+  8023ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ae:	5b                   	pop    %ebx
+  8023af:	5e                   	pop    %esi
+  8023b0:	5d                   	pop    %ebp
+  8023b1:	c3                   	ret
+		fd_close(fd, 0);
+  8023b2:	83 ec 08             	sub    $0x8,%esp
+  8023b5:	6a 00                	push   $0x0
+  8023b7:	ff 75 f4             	push   -0xc(%ebp)
+  8023ba:	e8 56 f7 ff ff       	call   801b15 <fd_close>
+		return r;
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	eb e5                	jmp    8023a9 <open+0x89>
+		return -E_BAD_PATH;
+  8023c4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023c9:	eb de                	jmp    8023a9 <open+0x89>
+
+008023cb <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	53                   	push   %ebx
+  8023cf:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d5:	50                   	push   %eax
+  8023d6:	ff 75 08             	push   0x8(%ebp)
+  8023d9:	e8 6a f6 ff ff       	call   801a48 <fd_lookup>
+  8023de:	89 c3                	mov    %eax,%ebx
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	78 5b                	js     802442 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ea:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  8023f0:	39 08                	cmp    %ecx,(%eax)
+  8023f2:	75 55                	jne    802449 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8023f4:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8023f8:	74 56                	je     802450 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8023fa:	83 ec 0c             	sub    $0xc,%esp
+  8023fd:	68 04 70 80 00       	push   $0x807004
+  802402:	e8 82 17 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802407:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80240d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802412:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802415:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80241a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80241d:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802422:	ba 00 00 00 00       	mov    $0x0,%edx
+  802427:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80242c:	e8 d1 fb ff ff       	call   802002 <fsipc>
+  802431:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802433:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80243a:	e8 b7 17 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+  80243f:	83 c4 10             	add    $0x10,%esp
+}
+  802442:	89 d8                	mov    %ebx,%eax
+  802444:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802447:	c9                   	leave
+  802448:	c3                   	ret
+		return -E_NOT_SUPP;
+  802449:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80244e:	eb f2                	jmp    802442 <fallocate+0x77>
+		return -E_INVAL;
+  802450:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802455:	eb eb                	jmp    802442 <fallocate+0x77>
+
+00802457 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	56                   	push   %esi
+  80245b:	53                   	push   %ebx
+  80245c:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80245f:	89 f3                	mov    %esi,%ebx
+  802461:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802467:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80246a:	eb 06                	jmp    802472 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80246c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802472:	39 f3                	cmp    %esi,%ebx
+  802474:	73 14                	jae    80248a <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802476:	83 ec 08             	sub    $0x8,%esp
+  802479:	53                   	push   %ebx
+  80247a:	6a 00                	push   $0x0
+  80247c:	e8 40 e9 ff ff       	call   800dc1 <sys_page_unmap>
+  802481:	83 c4 10             	add    $0x10,%esp
+  802484:	85 c0                	test   %eax,%eax
+  802486:	79 e4                	jns    80246c <munmap+0x15>
+  802488:	eb 05                	jmp    80248f <munmap+0x38>
+			return r;
+	return 0;
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802492:	5b                   	pop    %ebx
+  802493:	5e                   	pop    %esi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+
+00802496 <mmap>:
+{
+  802496:	55                   	push   %ebp
+  802497:	89 e5                	mov    %esp,%ebp
+  802499:	57                   	push   %edi
+  80249a:	56                   	push   %esi
+  80249b:	53                   	push   %ebx
+  80249c:	83 ec 24             	sub    $0x24,%esp
+  80249f:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8024a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024a5:	50                   	push   %eax
+  8024a6:	ff 75 08             	push   0x8(%ebp)
+  8024a9:	e8 9a f5 ff ff       	call   801a48 <fd_lookup>
+  8024ae:	83 c4 10             	add    $0x10,%esp
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	0f 88 37 01 00 00    	js     8025f0 <mmap+0x15a>
+		return NULL;
+  8024b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8024be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024c1:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  8024c7:	39 0a                	cmp    %ecx,(%edx)
+  8024c9:	0f 85 05 01 00 00    	jne    8025d4 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  8024cf:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8024d6:	0f 85 1b 01 00 00    	jne    8025f7 <mmap+0x161>
+  8024dc:	89 f0                	mov    %esi,%eax
+  8024de:	83 e8 01             	sub    $0x1,%eax
+  8024e1:	0f 88 17 01 00 00    	js     8025fe <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8024e7:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8024eb:	75 28                	jne    802515 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8024ed:	83 ec 0c             	sub    $0xc,%esp
+  8024f0:	68 04 70 80 00       	push   $0x807004
+  8024f5:	e8 8f 16 00 00       	call   803b89 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8024fa:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802500:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80250e:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802513:	eb 2b                	jmp    802540 <mmap+0xaa>
+		cow_enable();
+  802515:	e8 b5 ee ff ff       	call   8013cf <cow_enable>
+  80251a:	eb d1                	jmp    8024ed <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80251c:	89 c2                	mov    %eax,%edx
+  80251e:	c1 ea 0c             	shr    $0xc,%edx
+  802521:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802528:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80252e:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802534:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802537:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802539:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80253e:	77 25                	ja     802565 <mmap+0xcf>
+  802540:	89 c2                	mov    %eax,%edx
+  802542:	29 da                	sub    %ebx,%edx
+  802544:	39 ca                	cmp    %ecx,%edx
+  802546:	73 3a                	jae    802582 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802548:	89 c2                	mov    %eax,%edx
+  80254a:	c1 ea 16             	shr    $0x16,%edx
+  80254d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802554:	f6 c2 01             	test   $0x1,%dl
+  802557:	75 c3                	jne    80251c <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802559:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80255e:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802563:	eb d4                	jmp    802539 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802565:	29 d8                	sub    %ebx,%eax
+  802567:	39 c8                	cmp    %ecx,%eax
+  802569:	73 17                	jae    802582 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80256b:	83 ec 0c             	sub    $0xc,%esp
+  80256e:	68 04 70 80 00       	push   $0x807004
+  802573:	e8 7e 16 00 00       	call   803bf6 <mutex_unlock>
+		return NULL;
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802580:	eb 52                	jmp    8025d4 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802582:	85 db                	test   %ebx,%ebx
+  802584:	74 e5                	je     80256b <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802586:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802589:	8b 40 0c             	mov    0xc(%eax),%eax
+  80258c:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802591:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802594:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802599:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  80259f:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8025a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025a8:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8025ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025b7:	e8 46 fa ff ff       	call   802002 <fsipc>
+  8025bc:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	68 04 70 80 00       	push   $0x807004
+  8025c6:	e8 2b 16 00 00       	call   803bf6 <mutex_unlock>
+	if (r < 0) {
+  8025cb:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  8025ce:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  8025d0:	85 ff                	test   %edi,%edi
+  8025d2:	78 08                	js     8025dc <mmap+0x146>
+}
+  8025d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d7:	5b                   	pop    %ebx
+  8025d8:	5e                   	pop    %esi
+  8025d9:	5f                   	pop    %edi
+  8025da:	5d                   	pop    %ebp
+  8025db:	c3                   	ret
+		munmap((void*) va, len);
+  8025dc:	83 ec 08             	sub    $0x8,%esp
+  8025df:	56                   	push   %esi
+  8025e0:	53                   	push   %ebx
+  8025e1:	e8 71 fe ff ff       	call   802457 <munmap>
+		return NULL;
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ee:	eb e4                	jmp    8025d4 <mmap+0x13e>
+		return NULL;
+  8025f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f5:	eb dd                	jmp    8025d4 <mmap+0x13e>
+		return NULL;
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	eb d6                	jmp    8025d4 <mmap+0x13e>
+  8025fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802603:	eb cf                	jmp    8025d4 <mmap+0x13e>
+
+00802605 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802605:	55                   	push   %ebp
+  802606:	89 e5                	mov    %esp,%ebp
+  802608:	53                   	push   %ebx
+  802609:	83 ec 10             	sub    $0x10,%esp
+  80260c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80260f:	53                   	push   %ebx
+  802610:	e8 9a e2 ff ff       	call   8008af <strlen>
+  802615:	83 c4 10             	add    $0x10,%esp
+  802618:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80261d:	7f 42                	jg     802661 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80261f:	83 ec 0c             	sub    $0xc,%esp
+  802622:	68 04 70 80 00       	push   $0x807004
+  802627:	e8 5d 15 00 00       	call   803b89 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80262c:	83 c4 08             	add    $0x8,%esp
+  80262f:	53                   	push   %ebx
+  802630:	68 00 80 80 00       	push   $0x808000
+  802635:	e8 b0 e2 ff ff       	call   8008ea <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80263a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80263f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802644:	e8 b9 f9 ff ff       	call   802002 <fsipc>
+  802649:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80264b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802652:	e8 9f 15 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+  802657:	83 c4 10             	add    $0x10,%esp
+}
+  80265a:	89 d8                	mov    %ebx,%eax
+  80265c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+		return -E_BAD_PATH;
+  802661:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802666:	eb f2                	jmp    80265a <remove+0x55>
+
+00802668 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	53                   	push   %ebx
+  80266c:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80266f:	68 04 70 80 00       	push   $0x807004
+  802674:	e8 10 15 00 00       	call   803b89 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802683:	e8 7a f9 ff ff       	call   802002 <fsipc>
+  802688:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80268a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802691:	e8 60 15 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+}
+  802696:	89 d8                	mov    %ebx,%eax
+  802698:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+0080269d <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+  8026a0:	56                   	push   %esi
+  8026a1:	53                   	push   %ebx
+  8026a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8026a5:	83 ec 0c             	sub    $0xc,%esp
+  8026a8:	68 04 70 80 00       	push   $0x807004
+  8026ad:	e8 d7 14 00 00       	call   803b89 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8026b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b5:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8026ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026c4:	e8 39 f9 ff ff       	call   802002 <fsipc>
+  8026c9:	89 c6                	mov    %eax,%esi
+  8026cb:	83 c4 10             	add    $0x10,%esp
+  8026ce:	85 db                	test   %ebx,%ebx
+  8026d0:	74 7b                	je     80274d <fs_bcstat+0xb0>
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	78 77                	js     80274d <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  8026d6:	a1 00 80 80 00       	mov    0x808000,%eax
+  8026db:	89 03                	mov    %eax,(%ebx)
+  8026dd:	a1 04 80 80 00       	mov    0x808004,%eax
+  8026e2:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026e5:	a1 08 80 80 00       	mov    0x808008,%eax
+  8026ea:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026ed:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8026f2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026f5:	a1 10 80 80 00       	mov    0x808010,%eax
+  8026fa:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026fd:	a1 14 80 80 00       	mov    0x808014,%eax
+  802702:	89 43 14             	mov    %eax,0x14(%ebx)
+  802705:	a1 18 80 80 00       	mov    0x808018,%eax
+  80270a:	89 43 18             	mov    %eax,0x18(%ebx)
+  80270d:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802712:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802715:	a1 20 80 80 00       	mov    0x808020,%eax
+  80271a:	89 43 20             	mov    %eax,0x20(%ebx)
+  80271d:	a1 24 80 80 00       	mov    0x808024,%eax
+  802722:	89 43 24             	mov    %eax,0x24(%ebx)
+  802725:	a1 28 80 80 00       	mov    0x808028,%eax
+  80272a:	89 43 28             	mov    %eax,0x28(%ebx)
+  80272d:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802732:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802735:	a1 30 80 80 00       	mov    0x808030,%eax
+  80273a:	89 43 30             	mov    %eax,0x30(%ebx)
+  80273d:	a1 34 80 80 00       	mov    0x808034,%eax
+  802742:	89 43 34             	mov    %eax,0x34(%ebx)
+  802745:	a1 38 80 80 00       	mov    0x808038,%eax
+  80274a:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80274d:	83 ec 0c             	sub    $0xc,%esp
+  802750:	68 04 70 80 00       	push   $0x807004
+  802755:	e8 9c 14 00 00       	call   803bf6 <mutex_unlock>
+	return r;
+}
+  80275a:	89 f0                	mov    %esi,%eax
+  80275c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80275f:	5b                   	pop    %ebx
+  802760:	5e                   	pop    %esi
+  802761:	5d                   	pop    %ebp
+  802762:	c3                   	ret
+
+00802763 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	56                   	push   %esi
+  802767:	53                   	push   %ebx
+  802768:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80276a:	0f b6 10             	movzbl (%eax),%edx
+  80276d:	80 fa 72             	cmp    $0x72,%dl
+  802770:	74 44                	je     8027b6 <parse_mode+0x53>
+  802772:	80 fa 77             	cmp    $0x77,%dl
+  802775:	74 4b                	je     8027c2 <parse_mode+0x5f>
+  802777:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80277c:	80 fa 61             	cmp    $0x61,%dl
+  80277f:	74 09                	je     80278a <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802781:	89 d8                	mov    %ebx,%eax
+  802783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802786:	5b                   	pop    %ebx
+  802787:	5e                   	pop    %esi
+  802788:	5d                   	pop    %ebp
+  802789:	c3                   	ret
+	switch (mode[0]) {
+  80278a:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80278f:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802794:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802796:	83 ec 08             	sub    $0x8,%esp
+  802799:	6a 2b                	push   $0x2b
+  80279b:	50                   	push   %eax
+  80279c:	e8 5b e2 ff ff       	call   8009fc <strchr>
+  8027a1:	83 c4 10             	add    $0x10,%esp
+  8027a4:	85 c0                	test   %eax,%eax
+  8027a6:	74 d9                	je     802781 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8027a8:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8027ab:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8027ae:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8027b4:	eb cb                	jmp    802781 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8027b6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c0:	eb d2                	jmp    802794 <parse_mode+0x31>
+  8027c2:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8027c7:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8027cc:	eb c6                	jmp    802794 <parse_mode+0x31>
+
+008027ce <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8027ce:	55                   	push   %ebp
+  8027cf:	89 e5                	mov    %esp,%ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 1c             	sub    $0x1c,%esp
+  8027d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027da:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8027dd:	b8 44 60 80 00       	mov    $0x806044,%eax
+  8027e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8027e7:	83 c0 24             	add    $0x24,%eax
+  8027ea:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8027ee:	74 17                	je     802807 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8027f0:	83 c3 01             	add    $0x1,%ebx
+  8027f3:	83 fb 10             	cmp    $0x10,%ebx
+  8027f6:	75 ef                	jne    8027e7 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8027f8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8027fd:	89 f0                	mov    %esi,%eax
+  8027ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802802:	5b                   	pop    %ebx
+  802803:	5e                   	pop    %esi
+  802804:	5f                   	pop    %edi
+  802805:	5d                   	pop    %ebp
+  802806:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802807:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80280e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802811:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802814:	c1 e7 02             	shl    $0x2,%edi
+  802817:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  80281d:	83 ec 04             	sub    $0x4,%esp
+  802820:	6a 24                	push   $0x24
+  802822:	6a 00                	push   $0x0
+  802824:	56                   	push   %esi
+  802825:	e8 11 e2 ff ff       	call   800a3b <memset>
+			streams[i].f_fd = fd;
+  80282a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80282d:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  802833:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802836:	01 d8                	add    %ebx,%eax
+  802838:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80283b:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	eb b6                	jmp    8027fd <stream_alloc+0x2f>
+
+00802847 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	53                   	push   %ebx
+  80284b:	83 ec 14             	sub    $0x14,%esp
+  80284e:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802850:	8b 40 18             	mov    0x18(%eax),%eax
+  802853:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802856:	74 4a                	je     8028a2 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802858:	83 ec 08             	sub    $0x8,%esp
+  80285b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80285e:	50                   	push   %eax
+  80285f:	ff 33                	push   (%ebx)
+  802861:	e8 e2 f1 ff ff       	call   801a48 <fd_lookup>
+  802866:	89 c2                	mov    %eax,%edx
+  802868:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80286b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802870:	85 d2                	test   %edx,%edx
+  802872:	78 41                	js     8028b5 <stream_unread+0x6e>
+  802874:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802877:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  80287d:	39 0a                	cmp    %ecx,(%edx)
+  80287f:	75 34                	jne    8028b5 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802881:	8b 43 14             	mov    0x14(%ebx),%eax
+  802884:	03 42 04             	add    0x4(%edx),%eax
+  802887:	2b 43 18             	sub    0x18(%ebx),%eax
+  80288a:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80288d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802894:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80289b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a0:	eb 13                	jmp    8028b5 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8028a2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8028a9:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8028b0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+008028ba <stream_drain>:
+{
+  8028ba:	55                   	push   %ebp
+  8028bb:	89 e5                	mov    %esp,%ebp
+  8028bd:	56                   	push   %esi
+  8028be:	53                   	push   %ebx
+  8028bf:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8028c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c6:	eb 02                	jmp    8028ca <stream_drain+0x10>
+  8028c8:	01 c3                	add    %eax,%ebx
+  8028ca:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028cd:	39 c3                	cmp    %eax,%ebx
+  8028cf:	73 43                	jae    802914 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8028d1:	83 ec 04             	sub    $0x4,%esp
+  8028d4:	29 d8                	sub    %ebx,%eax
+  8028d6:	50                   	push   %eax
+  8028d7:	89 d8                	mov    %ebx,%eax
+  8028d9:	03 46 0c             	add    0xc(%esi),%eax
+  8028dc:	50                   	push   %eax
+  8028dd:	ff 36                	push   (%esi)
+  8028df:	e8 ec f4 ff ff       	call   801dd0 <write>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	7f dd                	jg     8028c8 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8028eb:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8028ef:	8b 56 0c             	mov    0xc(%esi),%edx
+  8028f2:	83 ec 04             	sub    $0x4,%esp
+  8028f5:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8028f8:	29 d8                	sub    %ebx,%eax
+  8028fa:	50                   	push   %eax
+  8028fb:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8028fe:	50                   	push   %eax
+  8028ff:	52                   	push   %edx
+  802900:	e8 6b e1 ff ff       	call   800a70 <memmove>
+			f->f_wend -= done;
+  802905:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802908:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80290a:	83 c4 10             	add    $0x10,%esp
+  80290d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802912:	eb 0a                	jmp    80291e <stream_drain+0x64>
+  802914:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802919:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80291e:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802921:	89 d0                	mov    %edx,%eax
+  802923:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802926:	5b                   	pop    %ebx
+  802927:	5e                   	pop    %esi
+  802928:	5d                   	pop    %ebp
+  802929:	c3                   	ret
+
+0080292a <stream_setup>:
+	if (f->f_buf)
+  80292a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80292e:	74 01                	je     802931 <stream_setup+0x7>
+  802930:	c3                   	ret
+{
+  802931:	55                   	push   %ebp
+  802932:	89 e5                	mov    %esp,%ebp
+  802934:	53                   	push   %ebx
+  802935:	83 ec 04             	sub    $0x4,%esp
+  802938:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80293a:	8b 40 08             	mov    0x8(%eax),%eax
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	74 17                	je     802958 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802941:	83 f8 03             	cmp    $0x3,%eax
+  802944:	75 2d                	jne    802973 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802946:	8d 43 20             	lea    0x20(%ebx),%eax
+  802949:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80294c:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802956:	c9                   	leave
+  802957:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802958:	83 ec 0c             	sub    $0xc,%esp
+  80295b:	ff 33                	push   (%ebx)
+  80295d:	e8 29 1b 00 00       	call   80448b <iscons>
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	85 c0                	test   %eax,%eax
+  802967:	0f 9f c0             	setg   %al
+  80296a:	0f b6 c0             	movzbl %al,%eax
+  80296d:	83 c0 01             	add    $0x1,%eax
+  802970:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802973:	83 ec 0c             	sub    $0xc,%esp
+  802976:	68 00 10 00 00       	push   $0x1000
+  80297b:	e8 6e 0b 00 00       	call   8034ee <malloc>
+  802980:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	85 c0                	test   %eax,%eax
+  802988:	74 bc                	je     802946 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80298a:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802991:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802995:	eb bc                	jmp    802953 <stream_setup+0x29>
+
+00802997 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	53                   	push   %ebx
+  80299b:	83 ec 04             	sub    $0x4,%esp
+  80299e:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8029a0:	e8 85 ff ff ff       	call   80292a <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8029a5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8029aa:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8029ae:	74 3d                	je     8029ed <stream_fill+0x56>
+  8029b0:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8029b4:	74 10                	je     8029c6 <stream_fill+0x2f>
+  8029b6:	89 d8                	mov    %ebx,%eax
+  8029b8:	e8 fd fe ff ff       	call   8028ba <stream_drain>
+		return 0;
+  8029bd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	78 27                	js     8029ed <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8029c6:	83 ec 04             	sub    $0x4,%esp
+  8029c9:	ff 73 10             	push   0x10(%ebx)
+  8029cc:	ff 73 0c             	push   0xc(%ebx)
+  8029cf:	ff 33                	push   (%ebx)
+  8029d1:	e8 02 f3 ff ff       	call   801cd8 <read>
+  8029d6:	83 c4 10             	add    $0x10,%esp
+  8029d9:	85 c0                	test   %eax,%eax
+  8029db:	7e 17                	jle    8029f4 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8029dd:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8029e1:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8029e8:	89 c2                	mov    %eax,%edx
+  8029ea:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8029ed:	89 d0                	mov    %edx,%eax
+  8029ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f2:	c9                   	leave
+  8029f3:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8029f4:	c1 f8 1f             	sar    $0x1f,%eax
+  8029f7:	83 e0 04             	and    $0x4,%eax
+  8029fa:	83 c0 04             	add    $0x4,%eax
+  8029fd:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802a00:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a05:	eb e6                	jmp    8029ed <stream_fill+0x56>
+
+00802a07 <fopen>:
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	57                   	push   %edi
+  802a0b:	56                   	push   %esi
+  802a0c:	53                   	push   %ebx
+  802a0d:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802a13:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a16:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802a1c:	89 f0                	mov    %esi,%eax
+  802a1e:	e8 40 fd ff ff       	call   802763 <parse_mode>
+		return 0;
+  802a23:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a28:	85 c0                	test   %eax,%eax
+  802a2a:	78 2d                	js     802a59 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802a2c:	83 ec 08             	sub    $0x8,%esp
+  802a2f:	50                   	push   %eax
+  802a30:	ff 75 08             	push   0x8(%ebp)
+  802a33:	e8 e8 f8 ff ff       	call   802320 <open>
+  802a38:	89 c7                	mov    %eax,%edi
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	78 58                	js     802a99 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a41:	80 3e 61             	cmpb   $0x61,(%esi)
+  802a44:	74 1d                	je     802a63 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802a46:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802a4c:	89 f8                	mov    %edi,%eax
+  802a4e:	e8 7b fd ff ff       	call   8027ce <stream_alloc>
+  802a53:	89 c3                	mov    %eax,%ebx
+  802a55:	85 c0                	test   %eax,%eax
+  802a57:	74 32                	je     802a8b <fopen+0x84>
+}
+  802a59:	89 d8                	mov    %ebx,%eax
+  802a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a5e:	5b                   	pop    %ebx
+  802a5f:	5e                   	pop    %esi
+  802a60:	5f                   	pop    %edi
+  802a61:	5d                   	pop    %ebp
+  802a62:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a63:	83 ec 08             	sub    $0x8,%esp
+  802a66:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802a6c:	50                   	push   %eax
+  802a6d:	57                   	push   %edi
+  802a6e:	e8 db f4 ff ff       	call   801f4e <fstat>
+  802a73:	83 c4 10             	add    $0x10,%esp
+  802a76:	85 c0                	test   %eax,%eax
+  802a78:	78 cc                	js     802a46 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802a7a:	83 ec 08             	sub    $0x8,%esp
+  802a7d:	ff 75 dc             	push   -0x24(%ebp)
+  802a80:	57                   	push   %edi
+  802a81:	e8 f6 f3 ff ff       	call   801e7c <seek>
+  802a86:	83 c4 10             	add    $0x10,%esp
+  802a89:	eb bb                	jmp    802a46 <fopen+0x3f>
+		close(fd);
+  802a8b:	83 ec 0c             	sub    $0xc,%esp
+  802a8e:	57                   	push   %edi
+  802a8f:	e8 08 f1 ff ff       	call   801b9c <close>
+  802a94:	83 c4 10             	add    $0x10,%esp
+  802a97:	eb c0                	jmp    802a59 <fopen+0x52>
+		return 0;
+  802a99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a9e:	eb b9                	jmp    802a59 <fopen+0x52>
+
+00802aa0 <fdopen>:
+{
+  802aa0:	55                   	push   %ebp
+  802aa1:	89 e5                	mov    %esp,%ebp
+  802aa3:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802aa6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802aa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aac:	e8 b2 fc ff ff       	call   802763 <parse_mode>
+  802ab1:	89 c2                	mov    %eax,%edx
+		return 0;
+  802ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802ab8:	85 d2                	test   %edx,%edx
+  802aba:	78 0b                	js     802ac7 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802abc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac2:	e8 07 fd ff ff       	call   8027ce <stream_alloc>
+}
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+
+00802ac9 <setvbuf>:
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	57                   	push   %edi
+  802acd:	56                   	push   %esi
+  802ace:	53                   	push   %ebx
+  802acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad2:	8b 55 10             	mov    0x10(%ebp),%edx
+  802ad5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802ad8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802adc:	75 3a                	jne    802b18 <setvbuf+0x4f>
+  802ade:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802ae1:	83 fe 02             	cmp    $0x2,%esi
+  802ae4:	77 39                	ja     802b1f <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802ae6:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802ae9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802aed:	0f 95 c3             	setne  %bl
+  802af0:	85 ff                	test   %edi,%edi
+  802af2:	0f 95 c1             	setne  %cl
+  802af5:	84 cb                	test   %cl,%bl
+  802af7:	74 05                	je     802afe <setvbuf+0x35>
+  802af9:	83 fa 03             	cmp    $0x3,%edx
+  802afc:	75 0a                	jne    802b08 <setvbuf+0x3f>
+	return 0;
+  802afe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b03:	5b                   	pop    %ebx
+  802b04:	5e                   	pop    %esi
+  802b05:	5f                   	pop    %edi
+  802b06:	5d                   	pop    %ebp
+  802b07:	c3                   	ret
+		f->f_buf = buf;
+  802b08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b0b:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802b0e:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b16:	eb eb                	jmp    802b03 <setvbuf+0x3a>
+		return EOF;
+  802b18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b1d:	eb e4                	jmp    802b03 <setvbuf+0x3a>
+  802b1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b24:	eb dd                	jmp    802b03 <setvbuf+0x3a>
+
+00802b26 <fflush>:
+{
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	57                   	push   %edi
+  802b2a:	56                   	push   %esi
+  802b2b:	53                   	push   %ebx
+  802b2c:	83 ec 0c             	sub    $0xc,%esp
+  802b2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802b32:	85 db                	test   %ebx,%ebx
+  802b34:	74 1a                	je     802b50 <fflush+0x2a>
+	stream_unread(f);
+  802b36:	89 d8                	mov    %ebx,%eax
+  802b38:	e8 0a fd ff ff       	call   802847 <stream_unread>
+	return stream_drain(f);
+  802b3d:	89 d8                	mov    %ebx,%eax
+  802b3f:	e8 76 fd ff ff       	call   8028ba <stream_drain>
+  802b44:	89 c7                	mov    %eax,%edi
+}
+  802b46:	89 f8                	mov    %edi,%eax
+  802b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b4b:	5b                   	pop    %ebx
+  802b4c:	5e                   	pop    %esi
+  802b4d:	5f                   	pop    %edi
+  802b4e:	5d                   	pop    %ebp
+  802b4f:	c3                   	ret
+  802b50:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  802b55:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802b5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b5f:	eb 03                	jmp    802b64 <fflush+0x3e>
+  802b61:	83 c3 24             	add    $0x24,%ebx
+  802b64:	39 f3                	cmp    %esi,%ebx
+  802b66:	74 de                	je     802b46 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802b68:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802b6c:	74 f3                	je     802b61 <fflush+0x3b>
+  802b6e:	83 ec 0c             	sub    $0xc,%esp
+  802b71:	53                   	push   %ebx
+  802b72:	e8 af ff ff ff       	call   802b26 <fflush>
+  802b77:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802b7a:	85 c0                	test   %eax,%eax
+  802b7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b81:	0f 48 f8             	cmovs  %eax,%edi
+  802b84:	eb db                	jmp    802b61 <fflush+0x3b>
+
+00802b86 <fclose>:
+{
+  802b86:	55                   	push   %ebp
+  802b87:	89 e5                	mov    %esp,%ebp
+  802b89:	56                   	push   %esi
+  802b8a:	53                   	push   %ebx
+  802b8b:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802b8e:	83 ec 0c             	sub    $0xc,%esp
+  802b91:	56                   	push   %esi
+  802b92:	e8 8f ff ff ff       	call   802b26 <fflush>
+  802b97:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802b99:	83 c4 04             	add    $0x4,%esp
+  802b9c:	ff 36                	push   (%esi)
+  802b9e:	e8 f9 ef ff ff       	call   801b9c <close>
+  802ba3:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bad:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802bb0:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802bb4:	75 10                	jne    802bc6 <fclose+0x40>
+	f->f_flags = 0;
+  802bb6:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802bbd:	89 d8                	mov    %ebx,%eax
+  802bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5d                   	pop    %ebp
+  802bc5:	c3                   	ret
+		free(f->f_buf);
+  802bc6:	83 ec 0c             	sub    $0xc,%esp
+  802bc9:	ff 76 0c             	push   0xc(%esi)
+  802bcc:	e8 54 08 00 00       	call   803425 <free>
+  802bd1:	83 c4 10             	add    $0x10,%esp
+  802bd4:	eb e0                	jmp    802bb6 <fclose+0x30>
+
+00802bd6 <fileno>:
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdc:	8b 00                	mov    (%eax),%eax
+}
+  802bde:	5d                   	pop    %ebp
+  802bdf:	c3                   	ret
+
+00802be0 <feof>:
+{
+  802be0:	55                   	push   %ebp
+  802be1:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be6:	8b 40 04             	mov    0x4(%eax),%eax
+  802be9:	c1 e8 02             	shr    $0x2,%eax
+  802bec:	83 e0 01             	and    $0x1,%eax
+}
+  802bef:	5d                   	pop    %ebp
+  802bf0:	c3                   	ret
+
+00802bf1 <ferror>:
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf7:	8b 40 04             	mov    0x4(%eax),%eax
+  802bfa:	c1 e8 03             	shr    $0x3,%eax
+  802bfd:	83 e0 01             	and    $0x1,%eax
+}
+  802c00:	5d                   	pop    %ebp
+  802c01:	c3                   	ret
+
+00802c02 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	53                   	push   %ebx
+  802c06:	83 ec 04             	sub    $0x4,%esp
+  802c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c0c:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c0f:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802c12:	74 15                	je     802c29 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802c14:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802c17:	8b 43 14             	mov    0x14(%ebx),%eax
+  802c1a:	8d 48 01             	lea    0x1(%eax),%ecx
+  802c1d:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802c20:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c27:	c9                   	leave
+  802c28:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c29:	89 d8                	mov    %ebx,%eax
+  802c2b:	e8 67 fd ff ff       	call   802997 <stream_fill>
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	75 e0                	jne    802c14 <fgetc+0x12>
+		return EOF;
+  802c34:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c39:	eb e9                	jmp    802c24 <fgetc+0x22>
+
+00802c3b <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	57                   	push   %edi
+  802c3f:	56                   	push   %esi
+  802c40:	53                   	push   %ebx
+  802c41:	83 ec 1c             	sub    $0x1c,%esp
+  802c44:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802c47:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c4f:	83 e8 01             	sub    $0x1,%eax
+  802c52:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802c55:	eb 66                	jmp    802cbd <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c57:	8b 46 14             	mov    0x14(%esi),%eax
+  802c5a:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c5d:	29 c3                	sub    %eax,%ebx
+  802c5f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c62:	29 fa                	sub    %edi,%edx
+  802c64:	39 d3                	cmp    %edx,%ebx
+  802c66:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c69:	83 ec 04             	sub    $0x4,%esp
+  802c6c:	53                   	push   %ebx
+  802c6d:	6a 0a                	push   $0xa
+  802c6f:	03 46 0c             	add    0xc(%esi),%eax
+  802c72:	50                   	push   %eax
+  802c73:	e8 a9 de ff ff       	call   800b21 <memfind>
+  802c78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802c7b:	8b 46 0c             	mov    0xc(%esi),%eax
+  802c7e:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802c81:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802c84:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c86:	83 c4 10             	add    $0x10,%esp
+  802c89:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802c8c:	74 0b                	je     802c99 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802c8e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c91:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c94:	29 d3                	sub    %edx,%ebx
+  802c96:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802c99:	83 ec 04             	sub    $0x4,%esp
+  802c9c:	53                   	push   %ebx
+  802c9d:	01 c8                	add    %ecx,%eax
+  802c9f:	50                   	push   %eax
+  802ca0:	89 f8                	mov    %edi,%eax
+  802ca2:	03 45 08             	add    0x8(%ebp),%eax
+  802ca5:	50                   	push   %eax
+  802ca6:	e8 c5 dd ff ff       	call   800a70 <memmove>
+		f->f_rpos += m;
+  802cab:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802cae:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802cb0:	83 c4 10             	add    $0x10,%esp
+  802cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb6:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802cbb:	74 1f                	je     802cdc <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802cbd:	8d 47 01             	lea    0x1(%edi),%eax
+  802cc0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802cc3:	73 17                	jae    802cdc <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802cc5:	8b 46 18             	mov    0x18(%esi),%eax
+  802cc8:	39 46 14             	cmp    %eax,0x14(%esi)
+  802ccb:	75 8a                	jne    802c57 <fgets+0x1c>
+  802ccd:	89 f0                	mov    %esi,%eax
+  802ccf:	e8 c3 fc ff ff       	call   802997 <stream_fill>
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	0f 85 7b ff ff ff    	jne    802c57 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802cdc:	85 ff                	test   %edi,%edi
+  802cde:	74 0f                	je     802cef <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce3:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cea:	5b                   	pop    %ebx
+  802ceb:	5e                   	pop    %esi
+  802cec:	5f                   	pop    %edi
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+		return 0;
+  802cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf4:	eb f1                	jmp    802ce7 <fgets+0xac>
+
+00802cf6 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802cf6:	55                   	push   %ebp
+  802cf7:	89 e5                	mov    %esp,%ebp
+  802cf9:	57                   	push   %edi
+  802cfa:	56                   	push   %esi
+  802cfb:	53                   	push   %ebx
+  802cfc:	83 ec 1c             	sub    $0x1c,%esp
+  802cff:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802d02:	89 f0                	mov    %esi,%eax
+  802d04:	e8 21 fc ff ff       	call   80292a <stream_setup>
+	want = size * n;
+  802d09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d0c:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802d13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d18:	eb 43                	jmp    802d5d <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802d1a:	29 d3                	sub    %edx,%ebx
+  802d1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d1f:	29 f8                	sub    %edi,%eax
+  802d21:	39 c3                	cmp    %eax,%ebx
+  802d23:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802d26:	83 ec 04             	sub    $0x4,%esp
+  802d29:	53                   	push   %ebx
+  802d2a:	03 56 0c             	add    0xc(%esi),%edx
+  802d2d:	52                   	push   %edx
+  802d2e:	89 f8                	mov    %edi,%eax
+  802d30:	03 45 08             	add    0x8(%ebp),%eax
+  802d33:	50                   	push   %eax
+  802d34:	e8 37 dd ff ff       	call   800a70 <memmove>
+			f->f_rpos += m;
+  802d39:	01 5e 14             	add    %ebx,0x14(%esi)
+  802d3c:	83 c4 10             	add    $0x10,%esp
+  802d3f:	eb 1a                	jmp    802d5b <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802d41:	83 ec 04             	sub    $0x4,%esp
+  802d44:	53                   	push   %ebx
+  802d45:	89 f8                	mov    %edi,%eax
+  802d47:	03 45 08             	add    0x8(%ebp),%eax
+  802d4a:	50                   	push   %eax
+  802d4b:	ff 36                	push   (%esi)
+  802d4d:	e8 86 ef ff ff       	call   801cd8 <read>
+  802d52:	89 c3                	mov    %eax,%ebx
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	7e 36                	jle    802d91 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802d5b:	01 df                	add    %ebx,%edi
+  802d5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d60:	39 c7                	cmp    %eax,%edi
+  802d62:	73 39                	jae    802d9d <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802d64:	8b 56 14             	mov    0x14(%esi),%edx
+  802d67:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802d6a:	39 da                	cmp    %ebx,%edx
+  802d6c:	72 ac                	jb     802d1a <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802d6e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d71:	29 fb                	sub    %edi,%ebx
+  802d73:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802d76:	72 3e                	jb     802db6 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802d78:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802d7c:	74 1f                	je     802d9d <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802d7e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802d82:	74 bd                	je     802d41 <fread+0x4b>
+  802d84:	89 f0                	mov    %esi,%eax
+  802d86:	e8 2f fb ff ff       	call   8028ba <stream_drain>
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	79 b2                	jns    802d41 <fread+0x4b>
+  802d8f:	eb 0c                	jmp    802d9d <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802d91:	c1 fb 1f             	sar    $0x1f,%ebx
+  802d94:	83 e3 04             	and    $0x4,%ebx
+  802d97:	83 c3 04             	add    $0x4,%ebx
+  802d9a:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802d9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da0:	85 c0                	test   %eax,%eax
+  802da2:	74 0a                	je     802dae <fread+0xb8>
+  802da4:	89 f8                	mov    %edi,%eax
+  802da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dab:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db1:	5b                   	pop    %ebx
+  802db2:	5e                   	pop    %esi
+  802db3:	5f                   	pop    %edi
+  802db4:	5d                   	pop    %ebp
+  802db5:	c3                   	ret
+		} else if (!stream_fill(f))
+  802db6:	89 f0                	mov    %esi,%eax
+  802db8:	e8 da fb ff ff       	call   802997 <stream_fill>
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	74 dc                	je     802d9d <fread+0xa7>
+			m = 0;
+  802dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc6:	eb 93                	jmp    802d5b <fread+0x65>
+
+00802dc8 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802dc8:	55                   	push   %ebp
+  802dc9:	89 e5                	mov    %esp,%ebp
+  802dcb:	57                   	push   %edi
+  802dcc:	56                   	push   %esi
+  802dcd:	53                   	push   %ebx
+  802dce:	83 ec 1c             	sub    $0x1c,%esp
+  802dd1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802dd4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dd7:	a8 02                	test   $0x2,%al
+  802dd9:	75 13                	jne    802dee <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802ddb:	83 c8 08             	or     $0x8,%eax
+  802dde:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802de1:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de9:	5b                   	pop    %ebx
+  802dea:	5e                   	pop    %esi
+  802deb:	5f                   	pop    %edi
+  802dec:	5d                   	pop    %ebp
+  802ded:	c3                   	ret
+	stream_setup(f);
+  802dee:	89 d8                	mov    %ebx,%eax
+  802df0:	e8 35 fb ff ff       	call   80292a <stream_setup>
+	want = size * n;
+  802df5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df8:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802dfc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802dff:	89 d8                	mov    %ebx,%eax
+  802e01:	e8 41 fa ff ff       	call   802847 <stream_unread>
+	for (done = 0; done < want; ) {
+  802e06:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802e0b:	84 c0                	test   %al,%al
+  802e0d:	75 7b                	jne    802e8a <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e14:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802e17:	39 fe                	cmp    %edi,%esi
+  802e19:	73 24                	jae    802e3f <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e1b:	83 ec 04             	sub    $0x4,%esp
+  802e1e:	89 f8                	mov    %edi,%eax
+  802e20:	29 f0                	sub    %esi,%eax
+  802e22:	50                   	push   %eax
+  802e23:	89 f0                	mov    %esi,%eax
+  802e25:	03 45 08             	add    0x8(%ebp),%eax
+  802e28:	50                   	push   %eax
+  802e29:	ff 33                	push   (%ebx)
+  802e2b:	e8 a0 ef ff ff       	call   801dd0 <write>
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	7e 04                	jle    802e3b <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802e37:	01 c6                	add    %eax,%esi
+  802e39:	eb dc                	jmp    802e17 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802e3b:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802e3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e42:	85 c0                	test   %eax,%eax
+  802e44:	74 a0                	je     802de6 <fwrite+0x1e>
+  802e46:	89 f0                	mov    %esi,%eax
+  802e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4d:	f7 75 0c             	divl   0xc(%ebp)
+  802e50:	eb 94                	jmp    802de6 <fwrite+0x1e>
+			done += r;
+  802e52:	01 c7                	add    %eax,%edi
+			continue;
+  802e54:	eb 34                	jmp    802e8a <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802e56:	8b 73 10             	mov    0x10(%ebx),%esi
+  802e59:	29 c6                	sub    %eax,%esi
+  802e5b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e5e:	29 fa                	sub    %edi,%edx
+  802e60:	39 d6                	cmp    %edx,%esi
+  802e62:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802e65:	83 ec 04             	sub    $0x4,%esp
+  802e68:	56                   	push   %esi
+  802e69:	89 fa                	mov    %edi,%edx
+  802e6b:	03 55 08             	add    0x8(%ebp),%edx
+  802e6e:	52                   	push   %edx
+  802e6f:	03 43 0c             	add    0xc(%ebx),%eax
+  802e72:	50                   	push   %eax
+  802e73:	e8 f8 db ff ff       	call   800a70 <memmove>
+		f->f_wend += m;
+  802e78:	89 f0                	mov    %esi,%eax
+  802e7a:	03 43 1c             	add    0x1c(%ebx),%eax
+  802e7d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802e80:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e82:	83 c4 10             	add    $0x10,%esp
+  802e85:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802e88:	74 5b                	je     802ee5 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802e8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e8d:	39 c7                	cmp    %eax,%edi
+  802e8f:	73 2d                	jae    802ebe <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802e91:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	75 be                	jne    802e56 <fwrite+0x8e>
+  802e98:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e9b:	29 fa                	sub    %edi,%edx
+  802e9d:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802ea0:	72 b4                	jb     802e56 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802ea2:	83 ec 04             	sub    $0x4,%esp
+  802ea5:	52                   	push   %edx
+  802ea6:	89 f8                	mov    %edi,%eax
+  802ea8:	03 45 08             	add    0x8(%ebp),%eax
+  802eab:	50                   	push   %eax
+  802eac:	ff 33                	push   (%ebx)
+  802eae:	e8 1d ef ff ff       	call   801dd0 <write>
+  802eb3:	83 c4 10             	add    $0x10,%esp
+  802eb6:	85 c0                	test   %eax,%eax
+  802eb8:	7f 98                	jg     802e52 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802eba:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802ebe:	8b 43 08             	mov    0x8(%ebx),%eax
+  802ec1:	83 f8 03             	cmp    $0x3,%eax
+  802ec4:	74 48                	je     802f0e <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802ec6:	83 f8 02             	cmp    $0x2,%eax
+  802ec9:	74 27                	je     802ef2 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802ecb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	0f 84 10 ff ff ff    	je     802de6 <fwrite+0x1e>
+  802ed6:	89 f8                	mov    %edi,%eax
+  802ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802edd:	f7 75 0c             	divl   0xc(%ebp)
+  802ee0:	e9 01 ff ff ff       	jmp    802de6 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802ee5:	89 d8                	mov    %ebx,%eax
+  802ee7:	e8 ce f9 ff ff       	call   8028ba <stream_drain>
+  802eec:	85 c0                	test   %eax,%eax
+  802eee:	79 9a                	jns    802e8a <fwrite+0xc2>
+  802ef0:	eb cc                	jmp    802ebe <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802ef2:	83 ec 04             	sub    $0x4,%esp
+  802ef5:	57                   	push   %edi
+  802ef6:	6a 0a                	push   $0xa
+  802ef8:	ff 75 08             	push   0x8(%ebp)
+  802efb:	e8 21 dc ff ff       	call   800b21 <memfind>
+  802f00:	89 c2                	mov    %eax,%edx
+  802f02:	89 f8                	mov    %edi,%eax
+  802f04:	03 45 08             	add    0x8(%ebp),%eax
+  802f07:	83 c4 10             	add    $0x10,%esp
+  802f0a:	39 c2                	cmp    %eax,%edx
+  802f0c:	74 bd                	je     802ecb <fwrite+0x103>
+		stream_drain(f);
+  802f0e:	89 d8                	mov    %ebx,%eax
+  802f10:	e8 a5 f9 ff ff       	call   8028ba <stream_drain>
+  802f15:	eb b4                	jmp    802ecb <fwrite+0x103>
+
+00802f17 <fputc>:
+{
+  802f17:	55                   	push   %ebp
+  802f18:	89 e5                	mov    %esp,%ebp
+  802f1a:	53                   	push   %ebx
+  802f1b:	83 ec 14             	sub    $0x14,%esp
+  802f1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802f21:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802f24:	ff 75 0c             	push   0xc(%ebp)
+  802f27:	6a 01                	push   $0x1
+  802f29:	6a 01                	push   $0x1
+  802f2b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f2e:	50                   	push   %eax
+  802f2f:	e8 94 fe ff ff       	call   802dc8 <fwrite>
+  802f34:	83 c4 10             	add    $0x10,%esp
+  802f37:	0f b6 db             	movzbl %bl,%ebx
+  802f3a:	83 f8 01             	cmp    $0x1,%eax
+  802f3d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f42:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802f45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+
+00802f4a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802f4a:	55                   	push   %ebp
+  802f4b:	89 e5                	mov    %esp,%ebp
+  802f4d:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802f50:	ff 75 0c             	push   0xc(%ebp)
+  802f53:	ff 75 08             	push   0x8(%ebp)
+  802f56:	e8 bc ff ff ff       	call   802f17 <fputc>
+}
+  802f5b:	83 c4 10             	add    $0x10,%esp
+  802f5e:	c9                   	leave
+  802f5f:	c3                   	ret
+
+00802f60 <fputs>:
+{
+  802f60:	55                   	push   %ebp
+  802f61:	89 e5                	mov    %esp,%ebp
+  802f63:	56                   	push   %esi
+  802f64:	53                   	push   %ebx
+  802f65:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802f68:	83 ec 0c             	sub    $0xc,%esp
+  802f6b:	56                   	push   %esi
+  802f6c:	e8 3e d9 ff ff       	call   8008af <strlen>
+  802f71:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802f73:	ff 75 0c             	push   0xc(%ebp)
+  802f76:	50                   	push   %eax
+  802f77:	6a 01                	push   $0x1
+  802f79:	56                   	push   %esi
+  802f7a:	e8 49 fe ff ff       	call   802dc8 <fwrite>
+  802f7f:	83 c4 20             	add    $0x20,%esp
+  802f82:	39 d8                	cmp    %ebx,%eax
+  802f84:	0f 95 c0             	setne  %al
+  802f87:	0f b6 c0             	movzbl %al,%eax
+  802f8a:	f7 d8                	neg    %eax
+}
+  802f8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f8f:	5b                   	pop    %ebx
+  802f90:	5e                   	pop    %esi
+  802f91:	5d                   	pop    %ebp
+  802f92:	c3                   	ret
+
+00802f93 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802f93:	55                   	push   %ebp
+  802f94:	89 e5                	mov    %esp,%ebp
+  802f96:	53                   	push   %ebx
+  802f97:	83 ec 04             	sub    $0x4,%esp
+  802f9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f9d:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802fa0:	50                   	push   %eax
+  802fa1:	ff 75 0c             	push   0xc(%ebp)
+  802fa4:	53                   	push   %ebx
+  802fa5:	68 4a 2f 80 00       	push   $0x802f4a
+  802faa:	e8 4e d4 ff ff       	call   8003fd <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802faf:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fb2:	c1 e0 1c             	shl    $0x1c,%eax
+  802fb5:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802fb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+
+00802fbd <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fbd:	55                   	push   %ebp
+  802fbe:	89 e5                	mov    %esp,%ebp
+  802fc0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802fc3:	68 7c 4f 80 00       	push   $0x804f7c
+  802fc8:	ff 75 0c             	push   0xc(%ebp)
+  802fcb:	e8 1a d9 ff ff       	call   8008ea <strcpy>
+	return 0;
+}
+  802fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+
+00802fd7 <devsock_close>:
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	53                   	push   %ebx
+  802fdb:	83 ec 10             	sub    $0x10,%esp
+  802fde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802fe1:	53                   	push   %ebx
+  802fe2:	e8 cc 15 00 00       	call   8045b3 <pageref>
+  802fe7:	89 c2                	mov    %eax,%edx
+  802fe9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802fec:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ff1:	83 fa 01             	cmp    $0x1,%edx
+  802ff4:	74 05                	je     802ffb <devsock_close+0x24>
+}
+  802ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ffb:	83 ec 0c             	sub    $0xc,%esp
+  802ffe:	ff 73 0c             	push   0xc(%ebx)
+  803001:	e8 b7 02 00 00       	call   8032bd <nsipc_close>
+  803006:	83 c4 10             	add    $0x10,%esp
+  803009:	eb eb                	jmp    802ff6 <devsock_close+0x1f>
+
+0080300b <devsock_write>:
+{
+  80300b:	55                   	push   %ebp
+  80300c:	89 e5                	mov    %esp,%ebp
+  80300e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803011:	6a 00                	push   $0x0
+  803013:	ff 75 10             	push   0x10(%ebp)
+  803016:	ff 75 0c             	push   0xc(%ebp)
+  803019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301c:	ff 70 0c             	push   0xc(%eax)
+  80301f:	e8 79 03 00 00       	call   80339d <nsipc_send>
+}
+  803024:	c9                   	leave
+  803025:	c3                   	ret
+
+00803026 <devsock_read>:
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80302c:	6a 00                	push   $0x0
+  80302e:	ff 75 10             	push   0x10(%ebp)
+  803031:	ff 75 0c             	push   0xc(%ebp)
+  803034:	8b 45 08             	mov    0x8(%ebp),%eax
+  803037:	ff 70 0c             	push   0xc(%eax)
+  80303a:	e8 ef 02 00 00       	call   80332e <nsipc_recv>
+}
+  80303f:	c9                   	leave
+  803040:	c3                   	ret
+
+00803041 <fd2sockid>:
+{
+  803041:	55                   	push   %ebp
+  803042:	89 e5                	mov    %esp,%ebp
+  803044:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803047:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80304a:	52                   	push   %edx
+  80304b:	50                   	push   %eax
+  80304c:	e8 f7 e9 ff ff       	call   801a48 <fd_lookup>
+  803051:	83 c4 10             	add    $0x10,%esp
+  803054:	85 c0                	test   %eax,%eax
+  803056:	78 10                	js     803068 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803058:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80305b:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  803061:	39 08                	cmp    %ecx,(%eax)
+  803063:	75 05                	jne    80306a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803065:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803068:	c9                   	leave
+  803069:	c3                   	ret
+		return -E_NOT_SUPP;
+  80306a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80306f:	eb f7                	jmp    803068 <fd2sockid+0x27>
+
+00803071 <alloc_sockfd>:
+{
+  803071:	55                   	push   %ebp
+  803072:	89 e5                	mov    %esp,%ebp
+  803074:	56                   	push   %esi
+  803075:	53                   	push   %ebx
+  803076:	83 ec 1c             	sub    $0x1c,%esp
+  803079:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80307b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80307e:	50                   	push   %eax
+  80307f:	e8 6e e9 ff ff       	call   8019f2 <fd_alloc>
+  803084:	89 c3                	mov    %eax,%ebx
+  803086:	83 c4 10             	add    $0x10,%esp
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	78 43                	js     8030d0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80308d:	83 ec 04             	sub    $0x4,%esp
+  803090:	68 07 04 00 00       	push   $0x407
+  803095:	ff 75 f4             	push   -0xc(%ebp)
+  803098:	6a 00                	push   $0x0
+  80309a:	e8 89 dc ff ff       	call   800d28 <sys_page_alloc>
+  80309f:	89 c3                	mov    %eax,%ebx
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 28                	js     8030d0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8030a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030ab:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  8030b1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8030b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030b6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8030bd:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8030c0:	83 ec 0c             	sub    $0xc,%esp
+  8030c3:	50                   	push   %eax
+  8030c4:	e8 02 e9 ff ff       	call   8019cb <fd2num>
+  8030c9:	89 c3                	mov    %eax,%ebx
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	eb 0c                	jmp    8030dc <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8030d0:	83 ec 0c             	sub    $0xc,%esp
+  8030d3:	56                   	push   %esi
+  8030d4:	e8 e4 01 00 00       	call   8032bd <nsipc_close>
+		return r;
+  8030d9:	83 c4 10             	add    $0x10,%esp
+}
+  8030dc:	89 d8                	mov    %ebx,%eax
+  8030de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030e1:	5b                   	pop    %ebx
+  8030e2:	5e                   	pop    %esi
+  8030e3:	5d                   	pop    %ebp
+  8030e4:	c3                   	ret
+
+008030e5 <accept>:
+{
+  8030e5:	55                   	push   %ebp
+  8030e6:	89 e5                	mov    %esp,%ebp
+  8030e8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ee:	e8 4e ff ff ff       	call   803041 <fd2sockid>
+  8030f3:	85 c0                	test   %eax,%eax
+  8030f5:	78 1b                	js     803112 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8030f7:	83 ec 04             	sub    $0x4,%esp
+  8030fa:	ff 75 10             	push   0x10(%ebp)
+  8030fd:	ff 75 0c             	push   0xc(%ebp)
+  803100:	50                   	push   %eax
+  803101:	e8 0e 01 00 00       	call   803214 <nsipc_accept>
+  803106:	83 c4 10             	add    $0x10,%esp
+  803109:	85 c0                	test   %eax,%eax
+  80310b:	78 05                	js     803112 <accept+0x2d>
+	return alloc_sockfd(r);
+  80310d:	e8 5f ff ff ff       	call   803071 <alloc_sockfd>
+}
+  803112:	c9                   	leave
+  803113:	c3                   	ret
+
+00803114 <bind>:
+{
+  803114:	55                   	push   %ebp
+  803115:	89 e5                	mov    %esp,%ebp
+  803117:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80311a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80311d:	e8 1f ff ff ff       	call   803041 <fd2sockid>
+  803122:	85 c0                	test   %eax,%eax
+  803124:	78 12                	js     803138 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803126:	83 ec 04             	sub    $0x4,%esp
+  803129:	ff 75 10             	push   0x10(%ebp)
+  80312c:	ff 75 0c             	push   0xc(%ebp)
+  80312f:	50                   	push   %eax
+  803130:	e8 31 01 00 00       	call   803266 <nsipc_bind>
+  803135:	83 c4 10             	add    $0x10,%esp
+}
+  803138:	c9                   	leave
+  803139:	c3                   	ret
+
+0080313a <shutdown>:
+{
+  80313a:	55                   	push   %ebp
+  80313b:	89 e5                	mov    %esp,%ebp
+  80313d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803140:	8b 45 08             	mov    0x8(%ebp),%eax
+  803143:	e8 f9 fe ff ff       	call   803041 <fd2sockid>
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	78 0f                	js     80315b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80314c:	83 ec 08             	sub    $0x8,%esp
+  80314f:	ff 75 0c             	push   0xc(%ebp)
+  803152:	50                   	push   %eax
+  803153:	e8 43 01 00 00       	call   80329b <nsipc_shutdown>
+  803158:	83 c4 10             	add    $0x10,%esp
+}
+  80315b:	c9                   	leave
+  80315c:	c3                   	ret
+
+0080315d <connect>:
+{
+  80315d:	55                   	push   %ebp
+  80315e:	89 e5                	mov    %esp,%ebp
+  803160:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803163:	8b 45 08             	mov    0x8(%ebp),%eax
+  803166:	e8 d6 fe ff ff       	call   803041 <fd2sockid>
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	78 12                	js     803181 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80316f:	83 ec 04             	sub    $0x4,%esp
+  803172:	ff 75 10             	push   0x10(%ebp)
+  803175:	ff 75 0c             	push   0xc(%ebp)
+  803178:	50                   	push   %eax
+  803179:	e8 59 01 00 00       	call   8032d7 <nsipc_connect>
+  80317e:	83 c4 10             	add    $0x10,%esp
+}
+  803181:	c9                   	leave
+  803182:	c3                   	ret
+
+00803183 <listen>:
+{
+  803183:	55                   	push   %ebp
+  803184:	89 e5                	mov    %esp,%ebp
+  803186:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318c:	e8 b0 fe ff ff       	call   803041 <fd2sockid>
+  803191:	85 c0                	test   %eax,%eax
+  803193:	78 0f                	js     8031a4 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803195:	83 ec 08             	sub    $0x8,%esp
+  803198:	ff 75 0c             	push   0xc(%ebp)
+  80319b:	50                   	push   %eax
+  80319c:	e8 6b 01 00 00       	call   80330c <nsipc_listen>
+  8031a1:	83 c4 10             	add    $0x10,%esp
+}
+  8031a4:	c9                   	leave
+  8031a5:	c3                   	ret
+
+008031a6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8031a6:	55                   	push   %ebp
+  8031a7:	89 e5                	mov    %esp,%ebp
+  8031a9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8031ac:	ff 75 10             	push   0x10(%ebp)
+  8031af:	ff 75 0c             	push   0xc(%ebp)
+  8031b2:	ff 75 08             	push   0x8(%ebp)
+  8031b5:	e8 41 02 00 00       	call   8033fb <nsipc_socket>
+  8031ba:	83 c4 10             	add    $0x10,%esp
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	78 05                	js     8031c6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8031c1:	e8 ab fe ff ff       	call   803071 <alloc_sockfd>
+}
+  8031c6:	c9                   	leave
+  8031c7:	c3                   	ret
+
+008031c8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	53                   	push   %ebx
+  8031cc:	83 ec 04             	sub    $0x4,%esp
+  8031cf:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8031d1:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  8031d8:	74 26                	je     803200 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031da:	6a 07                	push   $0x7
+  8031dc:	68 00 90 80 00       	push   $0x809000
+  8031e1:	53                   	push   %ebx
+  8031e2:	ff 35 08 70 80 00    	push   0x807008
+  8031e8:	e8 49 e7 ff ff       	call   801936 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8031ed:	83 c4 0c             	add    $0xc,%esp
+  8031f0:	6a 00                	push   $0x0
+  8031f2:	6a 00                	push   $0x0
+  8031f4:	6a 00                	push   $0x0
+  8031f6:	e8 45 e6 ff ff       	call   801840 <ipc_recv>
+}
+  8031fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031fe:	c9                   	leave
+  8031ff:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803200:	83 ec 0c             	sub    $0xc,%esp
+  803203:	6a 02                	push   $0x2
+  803205:	e8 82 e7 ff ff       	call   80198c <ipc_find_env>
+  80320a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80320f:	83 c4 10             	add    $0x10,%esp
+  803212:	eb c6                	jmp    8031da <nsipc+0x12>
+
+00803214 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803214:	55                   	push   %ebp
+  803215:	89 e5                	mov    %esp,%ebp
+  803217:	56                   	push   %esi
+  803218:	53                   	push   %ebx
+  803219:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80321c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80321f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803224:	8b 06                	mov    (%esi),%eax
+  803226:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80322b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803230:	e8 93 ff ff ff       	call   8031c8 <nsipc>
+  803235:	89 c3                	mov    %eax,%ebx
+  803237:	85 c0                	test   %eax,%eax
+  803239:	79 09                	jns    803244 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80323b:	89 d8                	mov    %ebx,%eax
+  80323d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803240:	5b                   	pop    %ebx
+  803241:	5e                   	pop    %esi
+  803242:	5d                   	pop    %ebp
+  803243:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803244:	83 ec 04             	sub    $0x4,%esp
+  803247:	ff 35 10 90 80 00    	push   0x809010
+  80324d:	68 00 90 80 00       	push   $0x809000
+  803252:	ff 75 0c             	push   0xc(%ebp)
+  803255:	e8 16 d8 ff ff       	call   800a70 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80325a:	a1 10 90 80 00       	mov    0x809010,%eax
+  80325f:	89 06                	mov    %eax,(%esi)
+  803261:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803264:	eb d5                	jmp    80323b <nsipc_accept+0x27>
+
+00803266 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803266:	55                   	push   %ebp
+  803267:	89 e5                	mov    %esp,%ebp
+  803269:	53                   	push   %ebx
+  80326a:	83 ec 08             	sub    $0x8,%esp
+  80326d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803270:	8b 45 08             	mov    0x8(%ebp),%eax
+  803273:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803278:	53                   	push   %ebx
+  803279:	ff 75 0c             	push   0xc(%ebp)
+  80327c:	68 04 90 80 00       	push   $0x809004
+  803281:	e8 ea d7 ff ff       	call   800a70 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803286:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80328c:	b8 02 00 00 00       	mov    $0x2,%eax
+  803291:	e8 32 ff ff ff       	call   8031c8 <nsipc>
+}
+  803296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803299:	c9                   	leave
+  80329a:	c3                   	ret
+
+0080329b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80329b:	55                   	push   %ebp
+  80329c:	89 e5                	mov    %esp,%ebp
+  80329e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8032a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8032a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032ac:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8032b1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8032b6:	e8 0d ff ff ff       	call   8031c8 <nsipc>
+}
+  8032bb:	c9                   	leave
+  8032bc:	c3                   	ret
+
+008032bd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8032bd:	55                   	push   %ebp
+  8032be:	89 e5                	mov    %esp,%ebp
+  8032c0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8032c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c6:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  8032cb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032d0:	e8 f3 fe ff ff       	call   8031c8 <nsipc>
+}
+  8032d5:	c9                   	leave
+  8032d6:	c3                   	ret
+
+008032d7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032d7:	55                   	push   %ebp
+  8032d8:	89 e5                	mov    %esp,%ebp
+  8032da:	53                   	push   %ebx
+  8032db:	83 ec 08             	sub    $0x8,%esp
+  8032de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8032e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8032e9:	53                   	push   %ebx
+  8032ea:	ff 75 0c             	push   0xc(%ebp)
+  8032ed:	68 04 90 80 00       	push   $0x809004
+  8032f2:	e8 79 d7 ff ff       	call   800a70 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8032f7:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8032fd:	b8 05 00 00 00       	mov    $0x5,%eax
+  803302:	e8 c1 fe ff ff       	call   8031c8 <nsipc>
+}
+  803307:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80330a:	c9                   	leave
+  80330b:	c3                   	ret
+
+0080330c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80330c:	55                   	push   %ebp
+  80330d:	89 e5                	mov    %esp,%ebp
+  80330f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803312:	8b 45 08             	mov    0x8(%ebp),%eax
+  803315:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80331a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80331d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803322:	b8 06 00 00 00       	mov    $0x6,%eax
+  803327:	e8 9c fe ff ff       	call   8031c8 <nsipc>
+}
+  80332c:	c9                   	leave
+  80332d:	c3                   	ret
+
+0080332e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80332e:	55                   	push   %ebp
+  80332f:	89 e5                	mov    %esp,%ebp
+  803331:	56                   	push   %esi
+  803332:	53                   	push   %ebx
+  803333:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803336:	8b 45 08             	mov    0x8(%ebp),%eax
+  803339:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80333e:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803344:	8b 45 14             	mov    0x14(%ebp),%eax
+  803347:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80334c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803351:	e8 72 fe ff ff       	call   8031c8 <nsipc>
+  803356:	89 c3                	mov    %eax,%ebx
+  803358:	85 c0                	test   %eax,%eax
+  80335a:	78 22                	js     80337e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80335c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803361:	39 c6                	cmp    %eax,%esi
+  803363:	0f 4e c6             	cmovle %esi,%eax
+  803366:	39 c3                	cmp    %eax,%ebx
+  803368:	7f 1d                	jg     803387 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80336a:	83 ec 04             	sub    $0x4,%esp
+  80336d:	53                   	push   %ebx
+  80336e:	68 00 90 80 00       	push   $0x809000
+  803373:	ff 75 0c             	push   0xc(%ebp)
+  803376:	e8 f5 d6 ff ff       	call   800a70 <memmove>
+  80337b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80337e:	89 d8                	mov    %ebx,%eax
+  803380:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803383:	5b                   	pop    %ebx
+  803384:	5e                   	pop    %esi
+  803385:	5d                   	pop    %ebp
+  803386:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803387:	68 88 4f 80 00       	push   $0x804f88
+  80338c:	68 31 4e 80 00       	push   $0x804e31
+  803391:	6a 62                	push   $0x62
+  803393:	68 9d 4f 80 00       	push   $0x804f9d
+  803398:	e8 6c 11 00 00       	call   804509 <_panic>
+
+0080339d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80339d:	55                   	push   %ebp
+  80339e:	89 e5                	mov    %esp,%ebp
+  8033a0:	53                   	push   %ebx
+  8033a1:	83 ec 04             	sub    $0x4,%esp
+  8033a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8033a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033aa:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8033af:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8033b5:	7f 2e                	jg     8033e5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8033b7:	83 ec 04             	sub    $0x4,%esp
+  8033ba:	53                   	push   %ebx
+  8033bb:	ff 75 0c             	push   0xc(%ebp)
+  8033be:	68 0c 90 80 00       	push   $0x80900c
+  8033c3:	e8 a8 d6 ff ff       	call   800a70 <memmove>
+	nsipcbuf.send.req_size = size;
+  8033c8:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  8033ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033d1:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  8033d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033db:	e8 e8 fd ff ff       	call   8031c8 <nsipc>
+}
+  8033e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033e3:	c9                   	leave
+  8033e4:	c3                   	ret
+	assert(size < 1600);
+  8033e5:	68 a9 4f 80 00       	push   $0x804fa9
+  8033ea:	68 31 4e 80 00       	push   $0x804e31
+  8033ef:	6a 6d                	push   $0x6d
+  8033f1:	68 9d 4f 80 00       	push   $0x804f9d
+  8033f6:	e8 0e 11 00 00       	call   804509 <_panic>
+
+008033fb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803401:	8b 45 08             	mov    0x8(%ebp),%eax
+  803404:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803409:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80340c:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803411:	8b 45 10             	mov    0x10(%ebp),%eax
+  803414:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803419:	b8 09 00 00 00       	mov    $0x9,%eax
+  80341e:	e8 a5 fd ff ff       	call   8031c8 <nsipc>
+}
+  803423:	c9                   	leave
+  803424:	c3                   	ret
+
+00803425 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803425:	55                   	push   %ebp
+  803426:	89 e5                	mov    %esp,%ebp
+  803428:	53                   	push   %ebx
+  803429:	83 ec 10             	sub    $0x10,%esp
+  80342c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80342f:	68 0c 70 80 00       	push   $0x80700c
+  803434:	e8 50 07 00 00       	call   803b89 <mutex_lock>
+	if (v == 0)
+  803439:	83 c4 10             	add    $0x10,%esp
+  80343c:	85 db                	test   %ebx,%ebx
+  80343e:	0f 84 85 00 00 00    	je     8034c9 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803444:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80344a:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80344f:	77 51                	ja     8034a2 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803451:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803457:	89 d8                	mov    %ebx,%eax
+  803459:	c1 e8 0c             	shr    $0xc,%eax
+  80345c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803463:	f6 c4 02             	test   $0x2,%ah
+  803466:	74 50                	je     8034b8 <free+0x93>
+		sys_page_unmap(0, c);
+  803468:	83 ec 08             	sub    $0x8,%esp
+  80346b:	53                   	push   %ebx
+  80346c:	6a 00                	push   $0x0
+  80346e:	e8 4e d9 ff ff       	call   800dc1 <sys_page_unmap>
+		c += PGSIZE;
+  803473:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803479:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80347f:	83 c4 10             	add    $0x10,%esp
+  803482:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803487:	76 ce                	jbe    803457 <free+0x32>
+  803489:	68 f3 4f 80 00       	push   $0x804ff3
+  80348e:	68 31 4e 80 00       	push   $0x804e31
+  803493:	68 82 00 00 00       	push   $0x82
+  803498:	68 e6 4f 80 00       	push   $0x804fe6
+  80349d:	e8 67 10 00 00       	call   804509 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8034a2:	68 b8 4f 80 00       	push   $0x804fb8
+  8034a7:	68 31 4e 80 00       	push   $0x804e31
+  8034ac:	6a 7b                	push   $0x7b
+  8034ae:	68 e6 4f 80 00       	push   $0x804fe6
+  8034b3:	e8 51 10 00 00       	call   804509 <_panic>
+	if (--(*ref) == 0)
+  8034b8:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8034be:	83 e8 01             	sub    $0x1,%eax
+  8034c1:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8034c7:	74 15                	je     8034de <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8034c9:	83 ec 0c             	sub    $0xc,%esp
+  8034cc:	68 0c 70 80 00       	push   $0x80700c
+  8034d1:	e8 20 07 00 00       	call   803bf6 <mutex_unlock>
+}
+  8034d6:	83 c4 10             	add    $0x10,%esp
+  8034d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034dc:	c9                   	leave
+  8034dd:	c3                   	ret
+		sys_page_unmap(0, c);
+  8034de:	83 ec 08             	sub    $0x8,%esp
+  8034e1:	53                   	push   %ebx
+  8034e2:	6a 00                	push   $0x0
+  8034e4:	e8 d8 d8 ff ff       	call   800dc1 <sys_page_unmap>
+  8034e9:	83 c4 10             	add    $0x10,%esp
+  8034ec:	eb db                	jmp    8034c9 <free+0xa4>
+
+008034ee <malloc>:
+{
+  8034ee:	55                   	push   %ebp
+  8034ef:	89 e5                	mov    %esp,%ebp
+  8034f1:	57                   	push   %edi
+  8034f2:	56                   	push   %esi
+  8034f3:	53                   	push   %ebx
+  8034f4:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8034f7:	68 0c 70 80 00       	push   $0x80700c
+  8034fc:	e8 88 06 00 00       	call   803b89 <mutex_lock>
+	if (mptr == 0)
+  803501:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803507:	83 c4 10             	add    $0x10,%esp
+  80350a:	85 ff                	test   %edi,%edi
+  80350c:	74 6c                	je     80357a <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80350e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803511:	83 c0 03             	add    $0x3,%eax
+  803514:	83 e0 fc             	and    $0xfffffffc,%eax
+  803517:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803519:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80351e:	0f 87 64 01 00 00    	ja     803688 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803524:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80352a:	74 30                	je     80355c <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80352c:	89 f9                	mov    %edi,%ecx
+  80352e:	c1 e9 0c             	shr    $0xc,%ecx
+  803531:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803535:	c1 e8 0c             	shr    $0xc,%eax
+  803538:	39 c1                	cmp    %eax,%ecx
+  80353a:	74 5f                	je     80359b <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  80353c:	83 ec 0c             	sub    $0xc,%esp
+  80353f:	57                   	push   %edi
+  803540:	e8 e0 fe ff ff       	call   803425 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803545:	a1 10 70 80 00       	mov    0x807010,%eax
+  80354a:	05 00 10 00 00       	add    $0x1000,%eax
+  80354f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803554:	a3 10 70 80 00       	mov    %eax,0x807010
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803562:	ba 02 00 00 00       	mov    $0x2,%edx
+  803567:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80356b:	8d 7e 04             	lea    0x4(%esi),%edi
+  80356e:	89 cb                	mov    %ecx,%ebx
+  803570:	01 f9                	add    %edi,%ecx
+  803572:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803575:	e9 8b 00 00 00       	jmp    803605 <malloc+0x117>
+		mptr = mbegin;
+  80357a:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803581:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803584:	8b 45 08             	mov    0x8(%ebp),%eax
+  803587:	83 c0 03             	add    $0x3,%eax
+  80358a:	83 e0 fc             	and    $0xfffffffc,%eax
+  80358d:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80358f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803594:	76 c6                	jbe    80355c <malloc+0x6e>
+  803596:	e9 d6 00 00 00       	jmp    803671 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80359b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8035a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8035a6:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8035aa:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8035ad:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  8035b2:	e9 ba 00 00 00       	jmp    803671 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8035b7:	05 00 10 00 00       	add    $0x1000,%eax
+  8035bc:	39 c8                	cmp    %ecx,%eax
+  8035be:	0f 83 cb 00 00 00    	jae    80368f <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8035c4:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8035c9:	77 22                	ja     8035ed <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8035cb:	89 c2                	mov    %eax,%edx
+  8035cd:	c1 ea 16             	shr    $0x16,%edx
+  8035d0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8035d7:	f6 c2 01             	test   $0x1,%dl
+  8035da:	74 db                	je     8035b7 <malloc+0xc9>
+  8035dc:	89 c2                	mov    %eax,%edx
+  8035de:	c1 ea 0c             	shr    $0xc,%edx
+  8035e1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8035e8:	f6 c2 01             	test   $0x1,%dl
+  8035eb:	74 ca                	je     8035b7 <malloc+0xc9>
+		if (mptr == mend) {
+  8035ed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035f3:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8035f9:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8035fd:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803603:	74 04                	je     803609 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803605:	89 d8                	mov    %ebx,%eax
+  803607:	eb b3                	jmp    8035bc <malloc+0xce>
+  803609:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80360c:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803611:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803615:	83 ea 01             	sub    $0x1,%edx
+  803618:	0f 85 50 ff ff ff    	jne    80356e <malloc+0x80>
+  80361e:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803625:	00 00 08 
+				return 0;	/* out of address space */
+  803628:	bf 00 00 00 00       	mov    $0x0,%edi
+  80362d:	eb 42                	jmp    803671 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80362f:	85 db                	test   %ebx,%ebx
+  803631:	78 1e                	js     803651 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803633:	83 ec 08             	sub    $0x8,%esp
+  803636:	89 d8                	mov    %ebx,%eax
+  803638:	03 05 10 70 80 00    	add    0x807010,%eax
+  80363e:	50                   	push   %eax
+  80363f:	6a 00                	push   $0x0
+  803641:	e8 7b d7 ff ff       	call   800dc1 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803646:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80364c:	83 c4 10             	add    $0x10,%esp
+  80364f:	eb de                	jmp    80362f <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803651:	bf 00 00 00 00       	mov    $0x0,%edi
+  803656:	eb 19                	jmp    803671 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803658:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80365b:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803661:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803668:	00 
+	mptr += n;
+  803669:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80366c:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803671:	83 ec 0c             	sub    $0xc,%esp
+  803674:	68 0c 70 80 00       	push   $0x80700c
+  803679:	e8 78 05 00 00       	call   803bf6 <mutex_unlock>
+}
+  80367e:	89 f8                	mov    %edi,%eax
+  803680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803683:	5b                   	pop    %ebx
+  803684:	5e                   	pop    %esi
+  803685:	5f                   	pop    %edi
+  803686:	5d                   	pop    %ebp
+  803687:	c3                   	ret
+		return 0;
+  803688:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368d:	eb e2                	jmp    803671 <malloc+0x183>
+  80368f:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803693:	74 06                	je     80369b <malloc+0x1ad>
+  803695:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80369b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036a0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8036a3:	39 fb                	cmp    %edi,%ebx
+  8036a5:	73 b1                	jae    803658 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036a7:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036ad:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036b0:	39 fe                	cmp    %edi,%esi
+  8036b2:	0f 92 c0             	setb   %al
+  8036b5:	0f b6 c0             	movzbl %al,%eax
+  8036b8:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036bb:	83 c8 07             	or     $0x7,%eax
+  8036be:	50                   	push   %eax
+  8036bf:	89 d8                	mov    %ebx,%eax
+  8036c1:	03 05 10 70 80 00    	add    0x807010,%eax
+  8036c7:	50                   	push   %eax
+  8036c8:	6a 00                	push   $0x0
+  8036ca:	e8 59 d6 ff ff       	call   800d28 <sys_page_alloc>
+  8036cf:	83 c4 10             	add    $0x10,%esp
+  8036d2:	85 c0                	test   %eax,%eax
+  8036d4:	0f 88 55 ff ff ff    	js     80362f <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8036da:	89 f3                	mov    %esi,%ebx
+  8036dc:	eb c5                	jmp    8036a3 <malloc+0x1b5>
+
+008036de <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8036de:	55                   	push   %ebp
+  8036df:	89 e5                	mov    %esp,%ebp
+  8036e1:	56                   	push   %esi
+  8036e2:	53                   	push   %ebx
+  8036e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8036e6:	83 ec 0c             	sub    $0xc,%esp
+  8036e9:	ff 75 08             	push   0x8(%ebp)
+  8036ec:	e8 ea e2 ff ff       	call   8019db <fd2data>
+  8036f1:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8036f3:	83 c4 08             	add    $0x8,%esp
+  8036f6:	68 0b 50 80 00       	push   $0x80500b
+  8036fb:	53                   	push   %ebx
+  8036fc:	e8 e9 d1 ff ff       	call   8008ea <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803701:	8b 46 04             	mov    0x4(%esi),%eax
+  803704:	2b 06                	sub    (%esi),%eax
+  803706:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80370c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803713:	00 00 00 
+	stat->st_dev = &devpipe;
+  803716:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  80371d:	62 80 00 
+	return 0;
+}
+  803720:	b8 00 00 00 00       	mov    $0x0,%eax
+  803725:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803728:	5b                   	pop    %ebx
+  803729:	5e                   	pop    %esi
+  80372a:	5d                   	pop    %ebp
+  80372b:	c3                   	ret
+
+0080372c <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80372c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803731:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803735:	85 c9                	test   %ecx,%ecx
+  803737:	75 01                	jne    80373a <pipewake+0xe>
+  803739:	c3                   	ret
+{
+  80373a:	55                   	push   %ebp
+  80373b:	89 e5                	mov    %esp,%ebp
+  80373d:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803740:	68 00 04 00 00       	push   $0x400
+  803745:	52                   	push   %edx
+  803746:	e8 21 d9 ff ff       	call   80106c <sys_futex_wake>
+  80374b:	83 c4 10             	add    $0x10,%esp
+}
+  80374e:	c9                   	leave
+  80374f:	c3                   	ret
+
+00803750 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803750:	55                   	push   %ebp
+  803751:	89 e5                	mov    %esp,%ebp
+  803753:	56                   	push   %esi
+  803754:	53                   	push   %ebx
+  803755:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803758:	83 ec 0c             	sub    $0xc,%esp
+  80375b:	56                   	push   %esi
+  80375c:	e8 7a e2 ff ff       	call   8019db <fd2data>
+  803761:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803763:	83 c4 08             	add    $0x8,%esp
+  803766:	56                   	push   %esi
+  803767:	6a 00                	push   $0x0
+  803769:	e8 53 d6 ff ff       	call   800dc1 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80376e:	8d 53 04             	lea    0x4(%ebx),%edx
+  803771:	8d 43 08             	lea    0x8(%ebx),%eax
+  803774:	e8 b3 ff ff ff       	call   80372c <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803779:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80377c:	89 da                	mov    %ebx,%edx
+  80377e:	e8 a9 ff ff ff       	call   80372c <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803783:	89 34 24             	mov    %esi,(%esp)
+  803786:	e8 50 e2 ff ff       	call   8019db <fd2data>
+  80378b:	83 c4 08             	add    $0x8,%esp
+  80378e:	50                   	push   %eax
+  80378f:	6a 00                	push   $0x0
+  803791:	e8 2b d6 ff ff       	call   800dc1 <sys_page_unmap>
+}
+  803796:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803799:	5b                   	pop    %ebx
+  80379a:	5e                   	pop    %esi
+  80379b:	5d                   	pop    %ebp
+  80379c:	c3                   	ret
+
+0080379d <_pipeisclosed>:
+{
+  80379d:	55                   	push   %ebp
+  80379e:	89 e5                	mov    %esp,%ebp
+  8037a0:	57                   	push   %edi
+  8037a1:	56                   	push   %esi
+  8037a2:	53                   	push   %ebx
+  8037a3:	83 ec 1c             	sub    $0x1c,%esp
+  8037a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037a9:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037ab:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8037b0:	eb 5d                	jmp    80380f <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8037b2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8037b8:	8b 02                	mov    (%edx),%eax
+  8037ba:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8037bd:	83 ec 0c             	sub    $0xc,%esp
+  8037c0:	ff 75 e0             	push   -0x20(%ebp)
+  8037c3:	e8 eb 0d 00 00       	call   8045b3 <pageref>
+  8037c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037cb:	89 3c 24             	mov    %edi,(%esp)
+  8037ce:	e8 e0 0d 00 00       	call   8045b3 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8037d3:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037d5:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8037db:	83 c4 10             	add    $0x10,%esp
+  8037de:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8037e4:	77 15                	ja     8037fb <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037e6:	89 f2                	mov    %esi,%edx
+  8037e8:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8037ea:	c1 ea 10             	shr    $0x10,%edx
+  8037ed:	74 0c                	je     8037fb <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037ef:	c1 e2 10             	shl    $0x10,%edx
+  8037f2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8037f7:	29 d1                	sub    %edx,%ecx
+  8037f9:	eb 06                	jmp    803801 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8037fb:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803801:	8b 11                	mov    (%ecx),%edx
+  803803:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803806:	39 d3                	cmp    %edx,%ebx
+  803808:	74 6e                	je     803878 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80380a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80380d:	74 24                	je     803833 <_pipeisclosed+0x96>
+  80380f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803811:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803817:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80381c:	77 94                	ja     8037b2 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80381e:	89 f0                	mov    %esi,%eax
+  803820:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803822:	c1 e8 10             	shr    $0x10,%eax
+  803825:	74 8b                	je     8037b2 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803827:	c1 e0 10             	shl    $0x10,%eax
+  80382a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80382f:	29 c2                	sub    %eax,%edx
+  803831:	eb 85                	jmp    8037b8 <_pipeisclosed+0x1b>
+  803833:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803835:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80383b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803840:	77 18                	ja     80385a <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803842:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803847:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803849:	c1 e8 10             	shr    $0x10,%eax
+  80384c:	74 0c                	je     80385a <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80384e:	c1 e0 10             	shl    $0x10,%eax
+  803851:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803856:	29 c2                	sub    %eax,%edx
+  803858:	eb 06                	jmp    803860 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80385a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803860:	8b 02                	mov    (%edx),%eax
+  803862:	8b 40 58             	mov    0x58(%eax),%eax
+  803865:	6a 01                	push   $0x1
+  803867:	50                   	push   %eax
+  803868:	53                   	push   %ebx
+  803869:	68 12 50 80 00       	push   $0x805012
+  80386e:	e8 93 ca ff ff       	call   800306 <cprintf>
+  803873:	83 c4 10             	add    $0x10,%esp
+  803876:	eb 97                	jmp    80380f <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803878:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80387b:	0f 94 c0             	sete   %al
+  80387e:	0f b6 c0             	movzbl %al,%eax
+}
+  803881:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803884:	5b                   	pop    %ebx
+  803885:	5e                   	pop    %esi
+  803886:	5f                   	pop    %edi
+  803887:	5d                   	pop    %ebp
+  803888:	c3                   	ret
+
+00803889 <devpipe_write>:
+{
+  803889:	55                   	push   %ebp
+  80388a:	89 e5                	mov    %esp,%ebp
+  80388c:	57                   	push   %edi
+  80388d:	56                   	push   %esi
+  80388e:	53                   	push   %ebx
+  80388f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803892:	ff 75 08             	push   0x8(%ebp)
+  803895:	e8 41 e1 ff ff       	call   8019db <fd2data>
+  80389a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80389c:	83 c4 10             	add    $0x10,%esp
+  80389f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038a6:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8038a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038ac:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038af:	0f 84 96 00 00 00    	je     80394b <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038b5:	8d 73 08             	lea    0x8(%ebx),%esi
+  8038b8:	eb 32                	jmp    8038ec <devpipe_write+0x63>
+  8038ba:	89 fa                	mov    %edi,%edx
+  8038bc:	89 f0                	mov    %esi,%eax
+  8038be:	e8 69 fe ff ff       	call   80372c <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8038c3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038c6:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8038c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038ce:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8038d3:	83 ec 04             	sub    $0x4,%esp
+  8038d6:	6a 0a                	push   $0xa
+  8038d8:	50                   	push   %eax
+  8038d9:	53                   	push   %ebx
+  8038da:	e8 5e d7 ff ff       	call   80103d <sys_futex_wait>
+  8038df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8038e4:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8038e9:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8038ec:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038ef:	8b 0b                	mov    (%ebx),%ecx
+  8038f1:	8d 51 20             	lea    0x20(%ecx),%edx
+  8038f4:	39 d0                	cmp    %edx,%eax
+  8038f6:	72 1b                	jb     803913 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8038f8:	89 da                	mov    %ebx,%edx
+  8038fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038fd:	e8 9b fe ff ff       	call   80379d <_pipeisclosed>
+  803902:	85 c0                	test   %eax,%eax
+  803904:	74 b4                	je     8038ba <devpipe_write+0x31>
+				return 0;
+  803906:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80390b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80390e:	5b                   	pop    %ebx
+  80390f:	5e                   	pop    %esi
+  803910:	5f                   	pop    %edi
+  803911:	5d                   	pop    %ebp
+  803912:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803913:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803916:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803919:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80391d:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803920:	89 c2                	mov    %eax,%edx
+  803922:	c1 fa 1f             	sar    $0x1f,%edx
+  803925:	89 d1                	mov    %edx,%ecx
+  803927:	c1 e9 1b             	shr    $0x1b,%ecx
+  80392a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80392d:	83 e2 1f             	and    $0x1f,%edx
+  803930:	29 ca                	sub    %ecx,%edx
+  803932:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803936:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80393a:	83 c0 01             	add    $0x1,%eax
+  80393d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803940:	83 c6 01             	add    $0x1,%esi
+  803943:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803946:	e9 5e ff ff ff       	jmp    8038a9 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80394b:	8d 53 04             	lea    0x4(%ebx),%edx
+  80394e:	8d 43 08             	lea    0x8(%ebx),%eax
+  803951:	e8 d6 fd ff ff       	call   80372c <pipewake>
+	return i;
+  803956:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803959:	eb b0                	jmp    80390b <devpipe_write+0x82>
+
+0080395b <devpipe_read>:
+{
+  80395b:	55                   	push   %ebp
+  80395c:	89 e5                	mov    %esp,%ebp
+  80395e:	57                   	push   %edi
+  80395f:	56                   	push   %esi
+  803960:	53                   	push   %ebx
+  803961:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803964:	ff 75 08             	push   0x8(%ebp)
+  803967:	e8 6f e0 ff ff       	call   8019db <fd2data>
+  80396c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80396e:	83 c4 10             	add    $0x10,%esp
+  803971:	be 00 00 00 00       	mov    $0x0,%esi
+  803976:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803979:	74 6c                	je     8039e7 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80397b:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80397e:	eb 25                	jmp    8039a5 <devpipe_read+0x4a>
+  803980:	8b 13                	mov    (%ebx),%edx
+  803982:	b8 01 00 00 00       	mov    $0x1,%eax
+  803987:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80398c:	83 ec 04             	sub    $0x4,%esp
+  80398f:	6a 0a                	push   $0xa
+  803991:	52                   	push   %edx
+  803992:	57                   	push   %edi
+  803993:	e8 a5 d6 ff ff       	call   80103d <sys_futex_wait>
+  803998:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80399d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8039a2:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8039a5:	8b 03                	mov    (%ebx),%eax
+  8039a7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8039aa:	75 19                	jne    8039c5 <devpipe_read+0x6a>
+			if (i > 0)
+  8039ac:	85 f6                	test   %esi,%esi
+  8039ae:	75 3a                	jne    8039ea <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8039b0:	89 da                	mov    %ebx,%edx
+  8039b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b5:	e8 e3 fd ff ff       	call   80379d <_pipeisclosed>
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	74 c2                	je     803980 <devpipe_read+0x25>
+				return 0;
+  8039be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c3:	eb 31                	jmp    8039f6 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8039c5:	89 c1                	mov    %eax,%ecx
+  8039c7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8039ca:	c1 e9 1b             	shr    $0x1b,%ecx
+  8039cd:	01 c8                	add    %ecx,%eax
+  8039cf:	83 e0 1f             	and    $0x1f,%eax
+  8039d2:	29 c8                	sub    %ecx,%eax
+  8039d4:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8039d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8039dc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8039df:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8039e2:	83 c6 01             	add    $0x1,%esi
+  8039e5:	eb 8f                	jmp    803976 <devpipe_read+0x1b>
+out:
+  8039e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8039ea:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8039ed:	89 da                	mov    %ebx,%edx
+  8039ef:	e8 38 fd ff ff       	call   80372c <pipewake>
+	return i;
+  8039f4:	89 f0                	mov    %esi,%eax
+}
+  8039f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039f9:	5b                   	pop    %ebx
+  8039fa:	5e                   	pop    %esi
+  8039fb:	5f                   	pop    %edi
+  8039fc:	5d                   	pop    %ebp
+  8039fd:	c3                   	ret
+
+008039fe <pipe>:
+{
+  8039fe:	55                   	push   %ebp
+  8039ff:	89 e5                	mov    %esp,%ebp
+  803a01:	56                   	push   %esi
+  803a02:	53                   	push   %ebx
+  803a03:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a09:	50                   	push   %eax
+  803a0a:	e8 e3 df ff ff       	call   8019f2 <fd_alloc>
+  803a0f:	89 c3                	mov    %eax,%ebx
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	0f 88 23 01 00 00    	js     803b3f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a1c:	83 ec 04             	sub    $0x4,%esp
+  803a1f:	68 07 04 00 00       	push   $0x407
+  803a24:	ff 75 f4             	push   -0xc(%ebp)
+  803a27:	6a 00                	push   $0x0
+  803a29:	e8 fa d2 ff ff       	call   800d28 <sys_page_alloc>
+  803a2e:	89 c3                	mov    %eax,%ebx
+  803a30:	83 c4 10             	add    $0x10,%esp
+  803a33:	85 c0                	test   %eax,%eax
+  803a35:	0f 88 04 01 00 00    	js     803b3f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a3b:	83 ec 0c             	sub    $0xc,%esp
+  803a3e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a41:	50                   	push   %eax
+  803a42:	e8 ab df ff ff       	call   8019f2 <fd_alloc>
+  803a47:	89 c3                	mov    %eax,%ebx
+  803a49:	83 c4 10             	add    $0x10,%esp
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	0f 88 db 00 00 00    	js     803b2f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a54:	83 ec 04             	sub    $0x4,%esp
+  803a57:	68 07 04 00 00       	push   $0x407
+  803a5c:	ff 75 f0             	push   -0x10(%ebp)
+  803a5f:	6a 00                	push   $0x0
+  803a61:	e8 c2 d2 ff ff       	call   800d28 <sys_page_alloc>
+  803a66:	89 c3                	mov    %eax,%ebx
+  803a68:	83 c4 10             	add    $0x10,%esp
+  803a6b:	85 c0                	test   %eax,%eax
+  803a6d:	0f 88 bc 00 00 00    	js     803b2f <pipe+0x131>
+	va = fd2data(fd0);
+  803a73:	83 ec 0c             	sub    $0xc,%esp
+  803a76:	ff 75 f4             	push   -0xc(%ebp)
+  803a79:	e8 5d df ff ff       	call   8019db <fd2data>
+  803a7e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a80:	83 c4 0c             	add    $0xc,%esp
+  803a83:	68 07 04 00 00       	push   $0x407
+  803a88:	50                   	push   %eax
+  803a89:	6a 00                	push   $0x0
+  803a8b:	e8 98 d2 ff ff       	call   800d28 <sys_page_alloc>
+  803a90:	89 c3                	mov    %eax,%ebx
+  803a92:	83 c4 10             	add    $0x10,%esp
+  803a95:	85 c0                	test   %eax,%eax
+  803a97:	0f 88 82 00 00 00    	js     803b1f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a9d:	83 ec 0c             	sub    $0xc,%esp
+  803aa0:	ff 75 f0             	push   -0x10(%ebp)
+  803aa3:	e8 33 df ff ff       	call   8019db <fd2data>
+  803aa8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803aaf:	50                   	push   %eax
+  803ab0:	6a 00                	push   $0x0
+  803ab2:	56                   	push   %esi
+  803ab3:	6a 00                	push   $0x0
+  803ab5:	e8 bb d2 ff ff       	call   800d75 <sys_page_map>
+  803aba:	89 c3                	mov    %eax,%ebx
+  803abc:	83 c4 20             	add    $0x20,%esp
+  803abf:	85 c0                	test   %eax,%eax
+  803ac1:	78 4e                	js     803b11 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803ac3:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  803ac8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803acb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803acd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803ad0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803ad7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803ada:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803adc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803adf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803ae6:	83 ec 0c             	sub    $0xc,%esp
+  803ae9:	ff 75 f4             	push   -0xc(%ebp)
+  803aec:	e8 da de ff ff       	call   8019cb <fd2num>
+  803af1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803af4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803af6:	83 c4 04             	add    $0x4,%esp
+  803af9:	ff 75 f0             	push   -0x10(%ebp)
+  803afc:	e8 ca de ff ff       	call   8019cb <fd2num>
+  803b01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b04:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b07:	83 c4 10             	add    $0x10,%esp
+  803b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b0f:	eb 2e                	jmp    803b3f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b11:	83 ec 08             	sub    $0x8,%esp
+  803b14:	56                   	push   %esi
+  803b15:	6a 00                	push   $0x0
+  803b17:	e8 a5 d2 ff ff       	call   800dc1 <sys_page_unmap>
+  803b1c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b1f:	83 ec 08             	sub    $0x8,%esp
+  803b22:	ff 75 f0             	push   -0x10(%ebp)
+  803b25:	6a 00                	push   $0x0
+  803b27:	e8 95 d2 ff ff       	call   800dc1 <sys_page_unmap>
+  803b2c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b2f:	83 ec 08             	sub    $0x8,%esp
+  803b32:	ff 75 f4             	push   -0xc(%ebp)
+  803b35:	6a 00                	push   $0x0
+  803b37:	e8 85 d2 ff ff       	call   800dc1 <sys_page_unmap>
+  803b3c:	83 c4 10             	add    $0x10,%esp
+}
+  803b3f:	89 d8                	mov    %ebx,%eax
+  803b41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b44:	5b                   	pop    %ebx
+  803b45:	5e                   	pop    %esi
+  803b46:	5d                   	pop    %ebp
+  803b47:	c3                   	ret
+
+00803b48 <pipeisclosed>:
+{
+  803b48:	55                   	push   %ebp
+  803b49:	89 e5                	mov    %esp,%ebp
+  803b4b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b51:	50                   	push   %eax
+  803b52:	ff 75 08             	push   0x8(%ebp)
+  803b55:	e8 ee de ff ff       	call   801a48 <fd_lookup>
+  803b5a:	83 c4 10             	add    $0x10,%esp
+  803b5d:	85 c0                	test   %eax,%eax
+  803b5f:	78 18                	js     803b79 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b61:	83 ec 0c             	sub    $0xc,%esp
+  803b64:	ff 75 f4             	push   -0xc(%ebp)
+  803b67:	e8 6f de ff ff       	call   8019db <fd2data>
+  803b6c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b71:	e8 27 fc ff ff       	call   80379d <_pipeisclosed>
+  803b76:	83 c4 10             	add    $0x10,%esp
+}
+  803b79:	c9                   	leave
+  803b7a:	c3                   	ret
+
+00803b7b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803b7b:	55                   	push   %ebp
+  803b7c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b81:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b87:	5d                   	pop    %ebp
+  803b88:	c3                   	ret
+
+00803b89 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803b89:	55                   	push   %ebp
+  803b8a:	89 e5                	mov    %esp,%ebp
+  803b8c:	56                   	push   %esi
+  803b8d:	53                   	push   %ebx
+  803b8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b96:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b9b:	89 d0                	mov    %edx,%eax
+  803b9d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803ba1:	85 c0                	test   %eax,%eax
+  803ba3:	74 2d                	je     803bd2 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803ba5:	83 f8 02             	cmp    $0x2,%eax
+  803ba8:	74 08                	je     803bb2 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803baa:	b8 02 00 00 00       	mov    $0x2,%eax
+  803baf:	f0 87 03             	lock xchg %eax,(%ebx)
+  803bb2:	be 02 00 00 00       	mov    $0x2,%esi
+  803bb7:	eb 15                	jmp    803bce <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803bb9:	83 ec 04             	sub    $0x4,%esp
+  803bbc:	6a 00                	push   $0x0
+  803bbe:	6a 02                	push   $0x2
+  803bc0:	53                   	push   %ebx
+  803bc1:	e8 77 d4 ff ff       	call   80103d <sys_futex_wait>
+  803bc6:	89 f0                	mov    %esi,%eax
+  803bc8:	f0 87 03             	lock xchg %eax,(%ebx)
+  803bcb:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	75 e7                	jne    803bb9 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bd5:	5b                   	pop    %ebx
+  803bd6:	5e                   	pop    %esi
+  803bd7:	5d                   	pop    %ebp
+  803bd8:	c3                   	ret
+
+00803bd9 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803bd9:	55                   	push   %ebp
+  803bda:	89 e5                	mov    %esp,%ebp
+  803bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803be9:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803bed:	f7 d8                	neg    %eax
+  803bef:	19 c0                	sbb    %eax,%eax
+  803bf1:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803bf4:	5d                   	pop    %ebp
+  803bf5:	c3                   	ret
+
+00803bf6 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803bf6:	55                   	push   %ebp
+  803bf7:	89 e5                	mov    %esp,%ebp
+  803bf9:	83 ec 08             	sub    $0x8,%esp
+  803bfc:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c04:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803c07:	83 f8 02             	cmp    $0x2,%eax
+  803c0a:	74 02                	je     803c0e <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803c0c:	c9                   	leave
+  803c0d:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803c0e:	83 ec 08             	sub    $0x8,%esp
+  803c11:	6a 01                	push   $0x1
+  803c13:	52                   	push   %edx
+  803c14:	e8 53 d4 ff ff       	call   80106c <sys_futex_wake>
+  803c19:	83 c4 10             	add    $0x10,%esp
+}
+  803c1c:	eb ee                	jmp    803c0c <mutex_unlock+0x16>
+
+00803c1e <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803c1e:	55                   	push   %ebp
+  803c1f:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c24:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c2a:	5d                   	pop    %ebp
+  803c2b:	c3                   	ret
+
+00803c2c <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803c2c:	55                   	push   %ebp
+  803c2d:	89 e5                	mov    %esp,%ebp
+  803c2f:	57                   	push   %edi
+  803c30:	56                   	push   %esi
+  803c31:	53                   	push   %ebx
+  803c32:	83 ec 18             	sub    $0x18,%esp
+  803c35:	8b 75 08             	mov    0x8(%ebp),%esi
+  803c38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803c3b:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803c3d:	53                   	push   %ebx
+  803c3e:	e8 b3 ff ff ff       	call   803bf6 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803c43:	83 c4 0c             	add    $0xc,%esp
+  803c46:	ff 75 10             	push   0x10(%ebp)
+  803c49:	57                   	push   %edi
+  803c4a:	56                   	push   %esi
+  803c4b:	e8 ed d3 ff ff       	call   80103d <sys_futex_wait>
+  803c50:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803c52:	83 c4 10             	add    $0x10,%esp
+  803c55:	be 02 00 00 00       	mov    $0x2,%esi
+  803c5a:	eb 10                	jmp    803c6c <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c5c:	83 ec 04             	sub    $0x4,%esp
+  803c5f:	6a 00                	push   $0x0
+  803c61:	6a 02                	push   $0x2
+  803c63:	53                   	push   %ebx
+  803c64:	e8 d4 d3 ff ff       	call   80103d <sys_futex_wait>
+  803c69:	83 c4 10             	add    $0x10,%esp
+  803c6c:	89 f0                	mov    %esi,%eax
+  803c6e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803c71:	85 c0                	test   %eax,%eax
+  803c73:	75 e7                	jne    803c5c <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803c75:	83 ff ec             	cmp    $0xffffffec,%edi
+  803c78:	74 05                	je     803c7f <cond_timedwait+0x53>
+  803c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c7f:	89 f8                	mov    %edi,%eax
+  803c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c84:	5b                   	pop    %ebx
+  803c85:	5e                   	pop    %esi
+  803c86:	5f                   	pop    %edi
+  803c87:	5d                   	pop    %ebp
+  803c88:	c3                   	ret
+
+00803c89 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c89:	55                   	push   %ebp
+  803c8a:	89 e5                	mov    %esp,%ebp
+  803c8c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803c8f:	6a 00                	push   $0x0
+  803c91:	ff 75 0c             	push   0xc(%ebp)
+  803c94:	ff 75 08             	push   0x8(%ebp)
+  803c97:	e8 90 ff ff ff       	call   803c2c <cond_timedwait>
+}
+  803c9c:	83 c4 10             	add    $0x10,%esp
+  803c9f:	c9                   	leave
+  803ca0:	c3                   	ret
+
+00803ca1 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803ca1:	55                   	push   %ebp
+  803ca2:	89 e5                	mov    %esp,%ebp
+  803ca4:	83 ec 10             	sub    $0x10,%esp
+  803ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803caa:	ba 01 00 00 00       	mov    $0x1,%edx
+  803caf:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803cb3:	6a 01                	push   $0x1
+  803cb5:	50                   	push   %eax
+  803cb6:	e8 b1 d3 ff ff       	call   80106c <sys_futex_wake>
+}
+  803cbb:	83 c4 10             	add    $0x10,%esp
+  803cbe:	c9                   	leave
+  803cbf:	c3                   	ret
+
+00803cc0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+  803cc3:	83 ec 10             	sub    $0x10,%esp
+  803cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc9:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cce:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803cd2:	68 00 04 00 00       	push   $0x400
+  803cd7:	50                   	push   %eax
+  803cd8:	e8 8f d3 ff ff       	call   80106c <sys_futex_wake>
+}
+  803cdd:	83 c4 10             	add    $0x10,%esp
+  803ce0:	c9                   	leave
+  803ce1:	c3                   	ret
+
+00803ce2 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803ce2:	55                   	push   %ebp
+  803ce3:	89 e5                	mov    %esp,%ebp
+  803ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803ce8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ceb:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803ced:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803cf4:	5d                   	pop    %ebp
+  803cf5:	c3                   	ret
+
+00803cf6 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803cf6:	55                   	push   %ebp
+  803cf7:	89 e5                	mov    %esp,%ebp
+  803cf9:	53                   	push   %ebx
+  803cfa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803cfd:	8b 11                	mov    (%ecx),%edx
+  803cff:	85 d2                	test   %edx,%edx
+  803d01:	74 14                	je     803d17 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803d03:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d06:	89 d0                	mov    %edx,%eax
+  803d08:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803d0c:	39 c2                	cmp    %eax,%edx
+  803d0e:	75 ed                	jne    803cfd <sem_trywait+0x7>
+			return 0;
+  803d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d15:	eb 05                	jmp    803d1c <sem_trywait+0x26>
+	return -E_AGAIN;
+  803d17:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803d1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d1f:	c9                   	leave
+  803d20:	c3                   	ret
+
+00803d21 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803d21:	55                   	push   %ebp
+  803d22:	89 e5                	mov    %esp,%ebp
+  803d24:	57                   	push   %edi
+  803d25:	56                   	push   %esi
+  803d26:	53                   	push   %ebx
+  803d27:	83 ec 1c             	sub    $0x1c,%esp
+  803d2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803d2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803d30:	e8 80 d2 ff ff       	call   800fb5 <sys_time_msec>
+  803d35:	01 f8                	add    %edi,%eax
+  803d37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803d3a:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803d3f:	eb 28                	jmp    803d69 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803d41:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d46:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803d4b:	83 ec 04             	sub    $0x4,%esp
+  803d4e:	56                   	push   %esi
+  803d4f:	6a 00                	push   $0x0
+  803d51:	53                   	push   %ebx
+  803d52:	e8 e6 d2 ff ff       	call   80103d <sys_futex_wait>
+  803d57:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803d5c:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803d61:	83 c4 10             	add    $0x10,%esp
+  803d64:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803d67:	74 2e                	je     803d97 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803d69:	83 ec 0c             	sub    $0xc,%esp
+  803d6c:	53                   	push   %ebx
+  803d6d:	e8 84 ff ff ff       	call   803cf6 <sem_trywait>
+  803d72:	83 c4 10             	add    $0x10,%esp
+  803d75:	85 c0                	test   %eax,%eax
+  803d77:	79 19                	jns    803d92 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803d79:	85 ff                	test   %edi,%edi
+  803d7b:	74 c4                	je     803d41 <sem_timedwait+0x20>
+  803d7d:	e8 33 d2 ff ff       	call   800fb5 <sys_time_msec>
+  803d82:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803d85:	29 c6                	sub    %eax,%esi
+  803d87:	85 f6                	test   %esi,%esi
+  803d89:	7f b6                	jg     803d41 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803d8b:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803d90:	eb 05                	jmp    803d97 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803d92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d9a:	5b                   	pop    %ebx
+  803d9b:	5e                   	pop    %esi
+  803d9c:	5f                   	pop    %edi
+  803d9d:	5d                   	pop    %ebp
+  803d9e:	c3                   	ret
+
+00803d9f <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803d9f:	55                   	push   %ebp
+  803da0:	89 e5                	mov    %esp,%ebp
+  803da2:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803da5:	6a 00                	push   $0x0
+  803da7:	ff 75 08             	push   0x8(%ebp)
+  803daa:	e8 72 ff ff ff       	call   803d21 <sem_timedwait>
+}
+  803daf:	83 c4 10             	add    $0x10,%esp
+  803db2:	c9                   	leave
+  803db3:	c3                   	ret
+
+00803db4 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803db4:	55                   	push   %ebp
+  803db5:	89 e5                	mov    %esp,%ebp
+  803db7:	83 ec 08             	sub    $0x8,%esp
+  803dba:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dbd:	ba 01 00 00 00       	mov    $0x1,%edx
+  803dc2:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803dc6:	8b 50 04             	mov    0x4(%eax),%edx
+  803dc9:	85 d2                	test   %edx,%edx
+  803dcb:	75 02                	jne    803dcf <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803dcd:	c9                   	leave
+  803dce:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803dcf:	83 ec 08             	sub    $0x8,%esp
+  803dd2:	6a 01                	push   $0x1
+  803dd4:	50                   	push   %eax
+  803dd5:	e8 92 d2 ff ff       	call   80106c <sys_futex_wake>
+  803dda:	83 c4 10             	add    $0x10,%esp
+}
+  803ddd:	eb ee                	jmp    803dcd <sem_post+0x19>
+
+00803ddf <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803ddf:	55                   	push   %ebp
+  803de0:	89 e5                	mov    %esp,%ebp
+  803de2:	57                   	push   %edi
+  803de3:	56                   	push   %esi
+  803de4:	53                   	push   %ebx
+  803de5:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803de8:	68 20 70 80 00       	push   $0x807020
+  803ded:	e8 97 fd ff ff       	call   803b89 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803df2:	a1 44 70 80 00       	mov    0x807044,%eax
+  803df7:	83 c4 10             	add    $0x10,%esp
+  803dfa:	85 c0                	test   %eax,%eax
+  803dfc:	75 19                	jne    803e17 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803dfe:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803e03:	8b 00                	mov    (%eax),%eax
+  803e05:	8b 40 48             	mov    0x48(%eax),%eax
+  803e08:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803e0d:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803e14:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803e17:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803e1c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e1f:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e26:	8b 40 04             	mov    0x4(%eax),%eax
+  803e29:	85 c0                	test   %eax,%eax
+  803e2b:	0f 84 e4 00 00 00    	je     803f15 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803e31:	83 c3 01             	add    $0x1,%ebx
+  803e34:	83 fb 20             	cmp    $0x20,%ebx
+  803e37:	75 e3                	jne    803e1c <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803e39:	83 ec 0c             	sub    $0xc,%esp
+  803e3c:	68 20 70 80 00       	push   $0x807020
+  803e41:	e8 b0 fd ff ff       	call   803bf6 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803e46:	83 c4 10             	add    $0x10,%esp
+  803e49:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803e4e:	e9 b8 00 00 00       	jmp    803f0b <pthread_create+0x12c>
+  803e53:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803e56:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803e59:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803e5b:	39 f3                	cmp    %esi,%ebx
+  803e5d:	73 16                	jae    803e75 <pthread_create+0x96>
+		va -= PGSIZE;
+  803e5f:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803e65:	83 ec 08             	sub    $0x8,%esp
+  803e68:	56                   	push   %esi
+  803e69:	6a 00                	push   $0x0
+  803e6b:	e8 51 cf ff ff       	call   800dc1 <sys_page_unmap>
+  803e70:	83 c4 10             	add    $0x10,%esp
+  803e73:	eb e6                	jmp    803e5b <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803e75:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803e78:	83 ec 08             	sub    $0x8,%esp
+  803e7b:	ff 75 e4             	push   -0x1c(%ebp)
+  803e7e:	6a 00                	push   $0x0
+  803e80:	e8 3c cf ff ff       	call   800dc1 <sys_page_unmap>
+	return r;
+  803e85:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803e88:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e8b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e92:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803e99:	eb 70                	jmp    803f0b <pthread_create+0x12c>
+	th->th_fn = fn;
+  803e9b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e9e:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ea5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ea8:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803eab:	8b 55 10             	mov    0x10(%ebp),%edx
+  803eae:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803eb1:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803eb8:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803ebd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803ec0:	29 c8                	sub    %ecx,%eax
+  803ec2:	85 db                	test   %ebx,%ebx
+  803ec4:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803ecb:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803ece:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803ed5:	83 ec 04             	sub    $0x4,%esp
+  803ed8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803edd:	29 ca                	sub    %ecx,%edx
+  803edf:	52                   	push   %edx
+	*--esp = 0;
+  803ee0:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803ee3:	50                   	push   %eax
+  803ee4:	68 3c 41 80 00       	push   $0x80413c
+  803ee9:	e8 23 d2 ff ff       	call   801111 <sys_thread_create>
+  803eee:	89 c7                	mov    %eax,%edi
+  803ef0:	83 c4 10             	add    $0x10,%esp
+  803ef3:	85 c0                	test   %eax,%eax
+  803ef5:	78 91                	js     803e88 <pthread_create+0xa9>
+	th->th_env = id;
+  803ef7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803efa:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f04:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803f06:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803f0b:	89 f8                	mov    %edi,%eax
+  803f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f10:	5b                   	pop    %ebx
+  803f11:	5e                   	pop    %esi
+  803f12:	5f                   	pop    %edi
+  803f13:	5d                   	pop    %ebp
+  803f14:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803f15:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f18:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f1f:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803f26:	83 ec 0c             	sub    $0xc,%esp
+  803f29:	68 20 70 80 00       	push   $0x807020
+  803f2e:	e8 c3 fc ff ff       	call   803bf6 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803f33:	89 d9                	mov    %ebx,%ecx
+  803f35:	c1 e1 10             	shl    $0x10,%ecx
+  803f38:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803f3b:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803f40:	29 c8                	sub    %ecx,%eax
+  803f42:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803f45:	c1 e8 16             	shr    $0x16,%eax
+  803f48:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803f4f:	83 c4 10             	add    $0x10,%esp
+  803f52:	a8 01                	test   $0x1,%al
+  803f54:	74 15                	je     803f6b <pthread_create+0x18c>
+  803f56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803f59:	c1 e8 0c             	shr    $0xc,%eax
+  803f5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803f63:	a8 01                	test   $0x1,%al
+  803f65:	0f 85 30 ff ff ff    	jne    803e9b <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f6b:	83 ec 04             	sub    $0x4,%esp
+  803f6e:	6a 07                	push   $0x7
+  803f70:	ff 75 e4             	push   -0x1c(%ebp)
+  803f73:	6a 00                	push   $0x0
+  803f75:	e8 ae cd ff ff       	call   800d28 <sys_page_alloc>
+  803f7a:	89 c7                	mov    %eax,%edi
+  803f7c:	83 c4 10             	add    $0x10,%esp
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	0f 88 01 ff ff ff    	js     803e88 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803f87:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803f8c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803f8f:	29 d0                	sub    %edx,%eax
+  803f91:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f94:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f96:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803f9b:	29 d0                	sub    %edx,%eax
+  803f9d:	89 c7                	mov    %eax,%edi
+  803f9f:	39 fe                	cmp    %edi,%esi
+  803fa1:	0f 83 f4 fe ff ff    	jae    803e9b <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803fa7:	83 ec 04             	sub    $0x4,%esp
+  803faa:	6a 07                	push   $0x7
+  803fac:	56                   	push   %esi
+  803fad:	6a 00                	push   $0x0
+  803faf:	e8 74 cd ff ff       	call   800d28 <sys_page_alloc>
+  803fb4:	83 c4 10             	add    $0x10,%esp
+  803fb7:	85 c0                	test   %eax,%eax
+  803fb9:	0f 88 94 fe ff ff    	js     803e53 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803fbf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803fc5:	eb d8                	jmp    803f9f <pthread_create+0x1c0>
+
+00803fc7 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803fc7:	55                   	push   %ebp
+  803fc8:	89 e5                	mov    %esp,%ebp
+  803fca:	57                   	push   %edi
+  803fcb:	56                   	push   %esi
+  803fcc:	53                   	push   %ebx
+  803fcd:	83 ec 0c             	sub    $0xc,%esp
+  803fd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803fd3:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803fd6:	83 f8 1e             	cmp    $0x1e,%eax
+  803fd9:	0f 87 c7 00 00 00    	ja     8040a6 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803fdf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fe7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fec:	77 12                	ja     804000 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fee:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ff3:	29 d0                	sub    %edx,%eax
+  803ff5:	c1 e8 10             	shr    $0x10,%eax
+  803ff8:	39 c3                	cmp    %eax,%ebx
+  803ffa:	0f 84 ad 00 00 00    	je     8040ad <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804000:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804003:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80400a:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  804011:	eb 10                	jmp    804023 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804013:	83 ec 04             	sub    $0x4,%esp
+  804016:	6a 00                	push   $0x0
+  804018:	6a 01                	push   $0x1
+  80401a:	57                   	push   %edi
+  80401b:	e8 1d d0 ff ff       	call   80103d <sys_futex_wait>
+  804020:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  804023:	8b 46 04             	mov    0x4(%esi),%eax
+  804026:	83 f8 01             	cmp    $0x1,%eax
+  804029:	74 e8                	je     804013 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80402b:	83 f8 02             	cmp    $0x2,%eax
+  80402e:	0f 85 80 00 00 00    	jne    8040b4 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804034:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804037:	c1 e6 02             	shl    $0x2,%esi
+  80403a:	eb 05                	jmp    804041 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80403c:	e8 bb cc ff ff       	call   800cfc <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804041:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  804047:	89 ca                	mov    %ecx,%edx
+  804049:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80404f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804052:	c1 e0 04             	shl    $0x4,%eax
+  804055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80405a:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80405d:	39 c1                	cmp    %eax,%ecx
+  80405f:	75 12                	jne    804073 <pthread_join+0xac>
+  804061:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804064:	c1 e0 04             	shl    $0x4,%eax
+  804067:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80406c:	8b 40 54             	mov    0x54(%eax),%eax
+  80406f:	85 c0                	test   %eax,%eax
+  804071:	75 c9                	jne    80403c <pthread_join+0x75>
+	if (ret_store)
+  804073:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804077:	74 0f                	je     804088 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804079:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80407c:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804083:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804086:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804088:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80408b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804092:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804099:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80409e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040a1:	5b                   	pop    %ebx
+  8040a2:	5e                   	pop    %esi
+  8040a3:	5f                   	pop    %edi
+  8040a4:	5d                   	pop    %ebp
+  8040a5:	c3                   	ret
+		return -E_INVAL;
+  8040a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8040ab:	eb f1                	jmp    80409e <pthread_join+0xd7>
+  8040ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8040b2:	eb ea                	jmp    80409e <pthread_join+0xd7>
+		return -E_INVAL;
+  8040b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8040b9:	eb e3                	jmp    80409e <pthread_join+0xd7>
+
+008040bb <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8040bb:	55                   	push   %ebp
+  8040bc:	89 e5                	mov    %esp,%ebp
+  8040be:	53                   	push   %ebx
+  8040bf:	83 ec 04             	sub    $0x4,%esp
+  8040c2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040c4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8040ca:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040cf:	77 0c                	ja     8040dd <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040d1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040d6:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8040d8:	c1 e8 10             	shr    $0x10,%eax
+  8040db:	75 0a                	jne    8040e7 <pthread_exit+0x2c>
+		exit();
+  8040dd:	e8 67 c1 ff ff       	call   800249 <exit>
+  8040e2:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8040e7:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8040ee:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8040f1:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8040f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8040fb:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8040fe:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  804105:	83 ec 08             	sub    $0x8,%esp
+  804108:	6a 20                	push   $0x20
+  80410a:	01 c2                	add    %eax,%edx
+  80410c:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  804113:	50                   	push   %eax
+  804114:	e8 53 cf ff ff       	call   80106c <sys_futex_wake>
+	sys_env_destroy(0);
+  804119:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804120:	e8 60 cb ff ff       	call   800c85 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804125:	83 c4 0c             	add    $0xc,%esp
+  804128:	68 2a 50 80 00       	push   $0x80502a
+  80412d:	68 a5 00 00 00       	push   $0xa5
+  804132:	68 44 50 80 00       	push   $0x805044
+  804137:	e8 cd 03 00 00       	call   804509 <_panic>
+
+0080413c <pthread_start>:
+{
+  80413c:	55                   	push   %ebp
+  80413d:	89 e5                	mov    %esp,%ebp
+  80413f:	53                   	push   %ebx
+  804140:	83 ec 04             	sub    $0x4,%esp
+  804143:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804146:	e8 85 cb ff ff       	call   800cd0 <sys_getenvid>
+  80414b:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804150:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  804156:	85 db                	test   %ebx,%ebx
+  804158:	74 0c                	je     804166 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80415a:	89 d9                	mov    %ebx,%ecx
+  80415c:	c1 e1 10             	shl    $0x10,%ecx
+  80415f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804164:	29 ca                	sub    %ecx,%edx
+  804166:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804169:	c1 e0 04             	shl    $0x4,%eax
+  80416c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804171:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804173:	83 ec 0c             	sub    $0xc,%esp
+  804176:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80417d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804180:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804187:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80418e:	89 04 24             	mov    %eax,(%esp)
+  804191:	e8 25 ff ff ff       	call   8040bb <pthread_exit>
+
+00804196 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804196:	55                   	push   %ebp
+  804197:	89 e5                	mov    %esp,%ebp
+  804199:	57                   	push   %edi
+  80419a:	56                   	push   %esi
+  80419b:	53                   	push   %ebx
+  80419c:	83 ec 1c             	sub    $0x1c,%esp
+  80419f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041a1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8041a7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041ae:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041b3:	77 0d                	ja     8041c2 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041b5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041ba:	29 d0                	sub    %edx,%eax
+  8041bc:	c1 e8 10             	shr    $0x10,%eax
+  8041bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8041c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041c7:	eb 2f                	jmp    8041f8 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8041c9:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041cf:	8b 01                	mov    (%ecx),%eax
+  8041d1:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8041d4:	39 c2                	cmp    %eax,%edx
+  8041d6:	75 14                	jne    8041ec <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8041d8:	83 ec 0c             	sub    $0xc,%esp
+  8041db:	57                   	push   %edi
+  8041dc:	e8 a4 ca ff ff       	call   800c85 <sys_env_destroy>
+  8041e1:	83 c4 10             	add    $0x10,%esp
+  8041e4:	85 c0                	test   %eax,%eax
+  8041e6:	0f 88 97 00 00 00    	js     804283 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8041ec:	83 c3 01             	add    $0x1,%ebx
+  8041ef:	83 fb 20             	cmp    $0x20,%ebx
+  8041f2:	0f 84 d2 00 00 00    	je     8042ca <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8041f8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8041fb:	74 ef                	je     8041ec <pthread_kill_others+0x56>
+  8041fd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804200:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804207:	8b 40 04             	mov    0x4(%eax),%eax
+  80420a:	83 f8 01             	cmp    $0x1,%eax
+  80420d:	75 dd                	jne    8041ec <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80420f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804212:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  804219:	89 fe                	mov    %edi,%esi
+  80421b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804221:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804224:	c1 e0 04             	shl    $0x4,%eax
+  804227:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80422c:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80422f:	39 c7                	cmp    %eax,%edi
+  804231:	75 b9                	jne    8041ec <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804233:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804236:	c1 e0 04             	shl    $0x4,%eax
+  804239:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80423e:	8b 40 54             	mov    0x54(%eax),%eax
+  804241:	85 c0                	test   %eax,%eax
+  804243:	74 a7                	je     8041ec <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804245:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804248:	c1 e0 04             	shl    $0x4,%eax
+  80424b:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804251:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804253:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804259:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80425e:	0f 87 65 ff ff ff    	ja     8041c9 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804264:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804269:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80426b:	c1 e8 10             	shr    $0x10,%eax
+  80426e:	0f 84 55 ff ff ff    	je     8041c9 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804274:	c1 e0 10             	shl    $0x10,%eax
+  804277:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80427c:	29 c1                	sub    %eax,%ecx
+  80427e:	e9 4c ff ff ff       	jmp    8041cf <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804283:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804286:	c1 e2 04             	shl    $0x4,%edx
+  804289:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80428f:	8b 52 48             	mov    0x48(%edx),%edx
+  804292:	39 fa                	cmp    %edi,%edx
+  804294:	0f 85 52 ff ff ff    	jne    8041ec <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80429a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80429d:	c1 e2 04             	shl    $0x4,%edx
+  8042a0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8042a6:	8b 52 54             	mov    0x54(%edx),%edx
+  8042a9:	85 d2                	test   %edx,%edx
+  8042ab:	0f 84 3b ff ff ff    	je     8041ec <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8042b1:	83 ec 0c             	sub    $0xc,%esp
+  8042b4:	50                   	push   %eax
+  8042b5:	57                   	push   %edi
+  8042b6:	68 54 50 80 00       	push   $0x805054
+  8042bb:	68 bb 00 00 00       	push   $0xbb
+  8042c0:	68 44 50 80 00       	push   $0x805044
+  8042c5:	e8 3f 02 00 00       	call   804509 <_panic>
+	}
+}
+  8042ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042cd:	5b                   	pop    %ebx
+  8042ce:	5e                   	pop    %esi
+  8042cf:	5f                   	pop    %edi
+  8042d0:	5d                   	pop    %ebp
+  8042d1:	c3                   	ret
+
+008042d2 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8042d2:	55                   	push   %ebp
+  8042d3:	89 e5                	mov    %esp,%ebp
+  8042d5:	53                   	push   %ebx
+  8042d6:	83 ec 04             	sub    $0x4,%esp
+  8042d9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042db:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8042e1:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8042e7:	0f 87 85 00 00 00    	ja     804372 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042ed:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8042f2:	29 c3                	sub    %eax,%ebx
+  8042f4:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8042f7:	83 ec 04             	sub    $0x4,%esp
+  8042fa:	68 80 02 00 00       	push   $0x280
+  8042ff:	6a 00                	push   $0x0
+  804301:	68 40 70 80 00       	push   $0x807040
+  804306:	e8 30 c7 ff ff       	call   800a3b <memset>
+	threads_mu.m_state = 0;
+  80430b:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804312:	00 00 00 
+	if (self != 0) {
+  804315:	83 c4 10             	add    $0x10,%esp
+  804318:	85 db                	test   %ebx,%ebx
+  80431a:	74 51                	je     80436d <pthread_fork_child+0x9b>
+  80431c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80431e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804324:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804329:	77 18                	ja     804343 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80432b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804330:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804332:	c1 e8 10             	shr    $0x10,%eax
+  804335:	74 0c                	je     804343 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804337:	c1 e0 10             	shl    $0x10,%eax
+  80433a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80433f:	29 c2                	sub    %eax,%edx
+  804341:	eb 06                	jmp    804349 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804343:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804349:	8b 02                	mov    (%edx),%eax
+  80434b:	8b 48 48             	mov    0x48(%eax),%ecx
+  80434e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804355:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804358:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80435f:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804366:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80436d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804370:	c9                   	leave
+  804371:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804372:	83 ec 04             	sub    $0x4,%esp
+  804375:	68 80 02 00 00       	push   $0x280
+  80437a:	6a 00                	push   $0x0
+  80437c:	68 40 70 80 00       	push   $0x807040
+  804381:	e8 b5 c6 ff ff       	call   800a3b <memset>
+	threads_mu.m_state = 0;
+  804386:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80438d:	00 00 00 
+  804390:	83 c4 10             	add    $0x10,%esp
+  804393:	eb d8                	jmp    80436d <pthread_fork_child+0x9b>
+
+00804395 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439a:	c3                   	ret
+
+0080439b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80439b:	55                   	push   %ebp
+  80439c:	89 e5                	mov    %esp,%ebp
+  80439e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8043a1:	68 79 50 80 00       	push   $0x805079
+  8043a6:	ff 75 0c             	push   0xc(%ebp)
+  8043a9:	e8 3c c5 ff ff       	call   8008ea <strcpy>
+	return 0;
+}
+  8043ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b3:	c9                   	leave
+  8043b4:	c3                   	ret
+
+008043b5 <devcons_write>:
+{
+  8043b5:	55                   	push   %ebp
+  8043b6:	89 e5                	mov    %esp,%ebp
+  8043b8:	57                   	push   %edi
+  8043b9:	56                   	push   %esi
+  8043ba:	53                   	push   %ebx
+  8043bb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8043c1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8043c6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8043cc:	eb 2e                	jmp    8043fc <devcons_write+0x47>
+		m = n - tot;
+  8043ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043d1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8043d3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043d8:	39 c3                	cmp    %eax,%ebx
+  8043da:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8043dd:	83 ec 04             	sub    $0x4,%esp
+  8043e0:	53                   	push   %ebx
+  8043e1:	89 f0                	mov    %esi,%eax
+  8043e3:	03 45 0c             	add    0xc(%ebp),%eax
+  8043e6:	50                   	push   %eax
+  8043e7:	57                   	push   %edi
+  8043e8:	e8 83 c6 ff ff       	call   800a70 <memmove>
+		sys_cputs(buf, m);
+  8043ed:	83 c4 08             	add    $0x8,%esp
+  8043f0:	53                   	push   %ebx
+  8043f1:	57                   	push   %edi
+  8043f2:	e8 37 c8 ff ff       	call   800c2e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8043f7:	01 de                	add    %ebx,%esi
+  8043f9:	83 c4 10             	add    $0x10,%esp
+  8043fc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8043ff:	72 cd                	jb     8043ce <devcons_write+0x19>
+}
+  804401:	89 f0                	mov    %esi,%eax
+  804403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804406:	5b                   	pop    %ebx
+  804407:	5e                   	pop    %esi
+  804408:	5f                   	pop    %edi
+  804409:	5d                   	pop    %ebp
+  80440a:	c3                   	ret
+
+0080440b <devcons_read>:
+{
+  80440b:	55                   	push   %ebp
+  80440c:	89 e5                	mov    %esp,%ebp
+  80440e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804411:	b8 00 00 00 00       	mov    $0x0,%eax
+  804416:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80441a:	75 07                	jne    804423 <devcons_read+0x18>
+  80441c:	eb 1f                	jmp    80443d <devcons_read+0x32>
+		sys_yield();
+  80441e:	e8 d9 c8 ff ff       	call   800cfc <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804423:	e8 31 c8 ff ff       	call   800c59 <sys_cgetc>
+  804428:	85 c0                	test   %eax,%eax
+  80442a:	74 f2                	je     80441e <devcons_read+0x13>
+	if (c < 0)
+  80442c:	78 0f                	js     80443d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80442e:	83 f8 04             	cmp    $0x4,%eax
+  804431:	74 0c                	je     80443f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804433:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804436:	88 02                	mov    %al,(%edx)
+	return 1;
+  804438:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80443d:	c9                   	leave
+  80443e:	c3                   	ret
+		return 0;
+  80443f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804444:	eb f7                	jmp    80443d <devcons_read+0x32>
+
+00804446 <cputchar>:
+{
+  804446:	55                   	push   %ebp
+  804447:	89 e5                	mov    %esp,%ebp
+  804449:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80444c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80444f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804452:	6a 01                	push   $0x1
+  804454:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804457:	50                   	push   %eax
+  804458:	e8 d1 c7 ff ff       	call   800c2e <sys_cputs>
+}
+  80445d:	83 c4 10             	add    $0x10,%esp
+  804460:	c9                   	leave
+  804461:	c3                   	ret
+
+00804462 <getchar>:
+{
+  804462:	55                   	push   %ebp
+  804463:	89 e5                	mov    %esp,%ebp
+  804465:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804468:	6a 01                	push   $0x1
+  80446a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80446d:	50                   	push   %eax
+  80446e:	6a 00                	push   $0x0
+  804470:	e8 63 d8 ff ff       	call   801cd8 <read>
+	if (r < 0)
+  804475:	83 c4 10             	add    $0x10,%esp
+  804478:	85 c0                	test   %eax,%eax
+  80447a:	78 06                	js     804482 <getchar+0x20>
+	if (r < 1)
+  80447c:	74 06                	je     804484 <getchar+0x22>
+	return c;
+  80447e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804482:	c9                   	leave
+  804483:	c3                   	ret
+		return -E_EOF;
+  804484:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804489:	eb f7                	jmp    804482 <getchar+0x20>
+
+0080448b <iscons>:
+{
+  80448b:	55                   	push   %ebp
+  80448c:	89 e5                	mov    %esp,%ebp
+  80448e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804491:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804494:	50                   	push   %eax
+  804495:	ff 75 08             	push   0x8(%ebp)
+  804498:	e8 ab d5 ff ff       	call   801a48 <fd_lookup>
+  80449d:	83 c4 10             	add    $0x10,%esp
+  8044a0:	85 c0                	test   %eax,%eax
+  8044a2:	78 11                	js     8044b5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8044a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044a7:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  8044ad:	39 10                	cmp    %edx,(%eax)
+  8044af:	0f 94 c0             	sete   %al
+  8044b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8044b5:	c9                   	leave
+  8044b6:	c3                   	ret
+
+008044b7 <opencons>:
+{
+  8044b7:	55                   	push   %ebp
+  8044b8:	89 e5                	mov    %esp,%ebp
+  8044ba:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8044bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8044c0:	50                   	push   %eax
+  8044c1:	e8 2c d5 ff ff       	call   8019f2 <fd_alloc>
+  8044c6:	83 c4 10             	add    $0x10,%esp
+  8044c9:	85 c0                	test   %eax,%eax
+  8044cb:	78 3a                	js     804507 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8044cd:	83 ec 04             	sub    $0x4,%esp
+  8044d0:	68 07 04 00 00       	push   $0x407
+  8044d5:	ff 75 f4             	push   -0xc(%ebp)
+  8044d8:	6a 00                	push   $0x0
+  8044da:	e8 49 c8 ff ff       	call   800d28 <sys_page_alloc>
+  8044df:	83 c4 10             	add    $0x10,%esp
+  8044e2:	85 c0                	test   %eax,%eax
+  8044e4:	78 21                	js     804507 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8044e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044e9:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  8044ef:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8044f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044f4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8044fb:	83 ec 0c             	sub    $0xc,%esp
+  8044fe:	50                   	push   %eax
+  8044ff:	e8 c7 d4 ff ff       	call   8019cb <fd2num>
+  804504:	83 c4 10             	add    $0x10,%esp
+}
+  804507:	c9                   	leave
+  804508:	c3                   	ret
+
+00804509 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804509:	55                   	push   %ebp
+  80450a:	89 e5                	mov    %esp,%ebp
+  80450c:	56                   	push   %esi
+  80450d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80450e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804511:	8b 35 08 60 80 00    	mov    0x806008,%esi
+  804517:	e8 b4 c7 ff ff       	call   800cd0 <sys_getenvid>
+  80451c:	83 ec 0c             	sub    $0xc,%esp
+  80451f:	ff 75 0c             	push   0xc(%ebp)
+  804522:	ff 75 08             	push   0x8(%ebp)
+  804525:	56                   	push   %esi
+  804526:	50                   	push   %eax
+  804527:	68 88 50 80 00       	push   $0x805088
+  80452c:	e8 d5 bd ff ff       	call   800306 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804531:	83 c4 18             	add    $0x18,%esp
+  804534:	53                   	push   %ebx
+  804535:	ff 75 10             	push   0x10(%ebp)
+  804538:	e8 78 bd ff ff       	call   8002b5 <vcprintf>
+	cprintf("\n");
+  80453d:	c7 04 24 fa 4d 80 00 	movl   $0x804dfa,(%esp)
+  804544:	e8 bd bd ff ff       	call   800306 <cprintf>
+  804549:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80454c:	cc                   	int3
+	while (1)
+  80454d:	eb fd                	jmp    80454c <_panic+0x43>
+
+0080454f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80454f:	55                   	push   %ebp
+  804550:	89 e5                	mov    %esp,%ebp
+  804552:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804555:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80455c:	74 0a                	je     804568 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80455e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804561:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804566:	c9                   	leave
+  804567:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804568:	83 ec 04             	sub    $0x4,%esp
+  80456b:	6a 07                	push   $0x7
+  80456d:	68 00 f0 bf ee       	push   $0xeebff000
+  804572:	6a 00                	push   $0x0
+  804574:	e8 af c7 ff ff       	call   800d28 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804579:	83 c4 08             	add    $0x8,%esp
+  80457c:	68 8d 45 80 00       	push   $0x80458d
+  804581:	6a 00                	push   $0x0
+  804583:	e8 1d c9 ff ff       	call   800ea5 <sys_env_set_pgfault_upcall>
+  804588:	83 c4 10             	add    $0x10,%esp
+  80458b:	eb d1                	jmp    80455e <set_pgfault_handler+0xf>
+
+0080458d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80458d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80458e:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804593:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804595:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804598:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80459c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8045a0:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8045a3:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8045a7:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8045a9:	83 c4 08             	add    $0x8,%esp
+	popal
+  8045ac:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8045ad:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8045b0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8045b1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8045b2:	c3                   	ret
+
+008045b3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8045b3:	55                   	push   %ebp
+  8045b4:	89 e5                	mov    %esp,%ebp
+  8045b6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045b9:	89 c2                	mov    %eax,%edx
+  8045bb:	c1 ea 16             	shr    $0x16,%edx
+  8045be:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8045c5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045ca:	f6 c1 01             	test   $0x1,%cl
+  8045cd:	74 1c                	je     8045eb <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8045cf:	c1 e8 0c             	shr    $0xc,%eax
+  8045d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045d9:	a8 01                	test   $0x1,%al
+  8045db:	74 0e                	je     8045eb <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045dd:	c1 e8 0c             	shr    $0xc,%eax
+  8045e0:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8045e7:	ef 
+  8045e8:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045eb:	89 d0                	mov    %edx,%eax
+  8045ed:	5d                   	pop    %ebp
+  8045ee:	c3                   	ret
+
+008045ef <udm>:
+  8045ef:	57                   	push   %edi
+  8045f0:	56                   	push   %esi
+  8045f1:	53                   	push   %ebx
+  8045f2:	83 ec 20             	sub    $0x20,%esp
+  8045f5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045f9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8045fd:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804601:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804605:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804609:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80460d:	89 d1                	mov    %edx,%ecx
+  80460f:	09 c1                	or     %eax,%ecx
+  804611:	0f 84 91 00 00 00    	je     8046a8 <udm+0xb9>
+  804617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804621:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804626:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80462d:	00 
+  80462e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804635:	00 
+  804636:	eb 08                	jmp    804640 <udm+0x51>
+  804638:	83 e9 01             	sub    $0x1,%ecx
+  80463b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80463e:	74 7c                	je     8046bc <udm+0xcd>
+  804640:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804644:	01 c0                	add    %eax,%eax
+  804646:	89 c6                	mov    %eax,%esi
+  804648:	89 d7                	mov    %edx,%edi
+  80464a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80464e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804652:	0f ad d0             	shrd   %cl,%edx,%eax
+  804655:	d3 ea                	shr    %cl,%edx
+  804657:	f6 c1 20             	test   $0x20,%cl
+  80465a:	74 04                	je     804660 <udm+0x71>
+  80465c:	89 d0                	mov    %edx,%eax
+  80465e:	31 d2                	xor    %edx,%edx
+  804660:	83 e0 01             	and    $0x1,%eax
+  804663:	89 04 24             	mov    %eax,(%esp)
+  804666:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80466d:	00 
+  80466e:	8b 04 24             	mov    (%esp),%eax
+  804671:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804675:	09 f0                	or     %esi,%eax
+  804677:	09 fa                	or     %edi,%edx
+  804679:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80467d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804681:	39 f0                	cmp    %esi,%eax
+  804683:	89 d3                	mov    %edx,%ebx
+  804685:	19 fb                	sbb    %edi,%ebx
+  804687:	72 af                	jb     804638 <udm+0x49>
+  804689:	29 f0                	sub    %esi,%eax
+  80468b:	19 fa                	sbb    %edi,%edx
+  80468d:	89 cf                	mov    %ecx,%edi
+  80468f:	c1 ef 05             	shr    $0x5,%edi
+  804692:	83 e7 01             	and    $0x1,%edi
+  804695:	89 fe                	mov    %edi,%esi
+  804697:	83 f6 01             	xor    $0x1,%esi
+  80469a:	d3 e6                	shl    %cl,%esi
+  80469c:	d3 e7                	shl    %cl,%edi
+  80469e:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046a2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046a6:	eb 90                	jmp    804638 <udm+0x49>
+  8046a8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046ac:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046b0:	89 f0                	mov    %esi,%eax
+  8046b2:	89 fa                	mov    %edi,%edx
+  8046b4:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8046b8:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8046bc:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8046c0:	89 01                	mov    %eax,(%ecx)
+  8046c2:	89 51 04             	mov    %edx,0x4(%ecx)
+  8046c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046cd:	83 c4 20             	add    $0x20,%esp
+  8046d0:	5b                   	pop    %ebx
+  8046d1:	5e                   	pop    %esi
+  8046d2:	5f                   	pop    %edi
+  8046d3:	c3                   	ret
+
+008046d4 <__udivdi3>:
+  8046d4:	83 ec 18             	sub    $0x18,%esp
+  8046d7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046db:	50                   	push   %eax
+  8046dc:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e0:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046e8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046ec:	e8 fe fe ff ff       	call   8045ef <udm>
+  8046f1:	83 c4 24             	add    $0x24,%esp
+  8046f4:	c3                   	ret
+
+008046f5 <__umoddi3>:
+  8046f5:	83 ec 18             	sub    $0x18,%esp
+  8046f8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046fc:	50                   	push   %eax
+  8046fd:	ff 74 24 2c          	push   0x2c(%esp)
+  804701:	ff 74 24 2c          	push   0x2c(%esp)
+  804705:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804709:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80470d:	e8 dd fe ff ff       	call   8045ef <udm>
+  804712:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804716:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80471a:	83 c4 24             	add    $0x24,%esp
+  80471d:	c3                   	ret
+
+0080471e <__divdi3>:
+  80471e:	56                   	push   %esi
+  80471f:	53                   	push   %ebx
+  804720:	83 ec 14             	sub    $0x14,%esp
+  804723:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804727:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80472b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80472f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804733:	85 d2                	test   %edx,%edx
+  804735:	78 18                	js     80474f <__divdi3+0x31>
+  804737:	85 db                	test   %ebx,%ebx
+  804739:	78 3e                	js     804779 <__divdi3+0x5b>
+  80473b:	83 ec 04             	sub    $0x4,%esp
+  80473e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804742:	56                   	push   %esi
+  804743:	53                   	push   %ebx
+  804744:	51                   	push   %ecx
+  804745:	e8 a5 fe ff ff       	call   8045ef <udm>
+  80474a:	83 c4 10             	add    $0x10,%esp
+  80474d:	eb 24                	jmp    804773 <__divdi3+0x55>
+  80474f:	f7 d8                	neg    %eax
+  804751:	83 d2 00             	adc    $0x0,%edx
+  804754:	f7 da                	neg    %edx
+  804756:	85 db                	test   %ebx,%ebx
+  804758:	78 3a                	js     804794 <__divdi3+0x76>
+  80475a:	83 ec 04             	sub    $0x4,%esp
+  80475d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804761:	56                   	push   %esi
+  804762:	53                   	push   %ebx
+  804763:	51                   	push   %ecx
+  804764:	e8 86 fe ff ff       	call   8045ef <udm>
+  804769:	83 c4 10             	add    $0x10,%esp
+  80476c:	f7 d8                	neg    %eax
+  80476e:	83 d2 00             	adc    $0x0,%edx
+  804771:	f7 da                	neg    %edx
+  804773:	83 c4 14             	add    $0x14,%esp
+  804776:	5b                   	pop    %ebx
+  804777:	5e                   	pop    %esi
+  804778:	c3                   	ret
+  804779:	83 ec 04             	sub    $0x4,%esp
+  80477c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804780:	56                   	push   %esi
+  804781:	f7 d9                	neg    %ecx
+  804783:	83 d3 00             	adc    $0x0,%ebx
+  804786:	f7 db                	neg    %ebx
+  804788:	53                   	push   %ebx
+  804789:	51                   	push   %ecx
+  80478a:	e8 60 fe ff ff       	call   8045ef <udm>
+  80478f:	83 c4 10             	add    $0x10,%esp
+  804792:	eb d8                	jmp    80476c <__divdi3+0x4e>
+  804794:	83 ec 04             	sub    $0x4,%esp
+  804797:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80479b:	56                   	push   %esi
+  80479c:	f7 d9                	neg    %ecx
+  80479e:	83 d3 00             	adc    $0x0,%ebx
+  8047a1:	f7 db                	neg    %ebx
+  8047a3:	53                   	push   %ebx
+  8047a4:	51                   	push   %ecx
+  8047a5:	e8 45 fe ff ff       	call   8045ef <udm>
+  8047aa:	83 c4 10             	add    $0x10,%esp
+  8047ad:	eb c4                	jmp    804773 <__divdi3+0x55>
+
+008047af <__moddi3>:
+  8047af:	55                   	push   %ebp
+  8047b0:	57                   	push   %edi
+  8047b1:	56                   	push   %esi
+  8047b2:	53                   	push   %ebx
+  8047b3:	83 ec 24             	sub    $0x24,%esp
+  8047b6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8047ba:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8047be:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8047c2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8047c6:	85 d2                	test   %edx,%edx
+  8047c8:	78 3b                	js     804805 <__moddi3+0x56>
+  8047ca:	83 ec 04             	sub    $0x4,%esp
+  8047cd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047d1:	56                   	push   %esi
+  8047d2:	89 ce                	mov    %ecx,%esi
+  8047d4:	f7 de                	neg    %esi
+  8047d6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8047da:	89 de                	mov    %ebx,%esi
+  8047dc:	83 d6 00             	adc    $0x0,%esi
+  8047df:	f7 de                	neg    %esi
+  8047e1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8047e5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047e9:	0f 48 f1             	cmovs  %ecx,%esi
+  8047ec:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8047f1:	53                   	push   %ebx
+  8047f2:	56                   	push   %esi
+  8047f3:	e8 f7 fd ff ff       	call   8045ef <udm>
+  8047f8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047fc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804800:	83 c4 10             	add    $0x10,%esp
+  804803:	eb 47                	jmp    80484c <__moddi3+0x9d>
+  804805:	f7 d8                	neg    %eax
+  804807:	83 d2 00             	adc    $0x0,%edx
+  80480a:	f7 da                	neg    %edx
+  80480c:	83 ec 04             	sub    $0x4,%esp
+  80480f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804813:	56                   	push   %esi
+  804814:	89 cf                	mov    %ecx,%edi
+  804816:	f7 df                	neg    %edi
+  804818:	89 de                	mov    %ebx,%esi
+  80481a:	83 d6 00             	adc    $0x0,%esi
+  80481d:	f7 de                	neg    %esi
+  80481f:	0f 49 cf             	cmovns %edi,%ecx
+  804822:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804826:	0f 49 de             	cmovns %esi,%ebx
+  804829:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80482d:	ff 74 24 0c          	push   0xc(%esp)
+  804831:	ff 74 24 0c          	push   0xc(%esp)
+  804835:	e8 b5 fd ff ff       	call   8045ef <udm>
+  80483a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80483e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804842:	f7 d8                	neg    %eax
+  804844:	83 d2 00             	adc    $0x0,%edx
+  804847:	f7 da                	neg    %edx
+  804849:	83 c4 10             	add    $0x10,%esp
+  80484c:	83 c4 24             	add    $0x24,%esp
+  80484f:	5b                   	pop    %ebx
+  804850:	5e                   	pop    %esi
+  804851:	5f                   	pop    %edi
+  804852:	5d                   	pop    %ebp
+  804853:	c3                   	ret
@@ -0,0 +1,11855 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5e 0b 00 00       	call   800b8f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800046:	83 3d 00 80 80 00 01 	cmpl   $0x1,0x808000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+		return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800065:	83 3d 00 80 80 00 01 	cmpl   $0x1,0x808000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 80 5a 80 00       	push   $0x805a80
+  800076:	e8 92 0c 00 00       	call   800d0d <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 8f 5a 80 00       	push   $0x805a8f
+  800089:	e8 7f 0c 00 00       	call   800d0d <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+		*s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 9d 5a 80 00       	push   $0x805a9d
+  8000a6:	e8 48 14 00 00       	call   8014f3 <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000be:	83 3d 00 80 80 00 01 	cmpl   $0x1,0x808000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+			cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 a2 5a 80 00       	push   $0x805aa2
+  8000d9:	e8 2f 0c 00 00       	call   800d0d <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 b3 5a 80 00       	push   $0x805ab3
+  8000ef:	e8 ff 13 00 00       	call   8014f3 <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+		t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010b:	83 3d 00 80 80 00 01 	cmpl   $0x1,0x808000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 a7 5a 80 00       	push   $0x805aa7
+  80011d:	e8 eb 0b 00 00       	call   800d0d <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+	*p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+		s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 af 5a 80 00       	push   $0x805aaf
+  800141:	e8 ad 13 00 00       	call   8014f3 <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+	*p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  800157:	83 3d 00 80 80 00 01 	cmpl   $0x1,0x808000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+		t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 bb 5a 80 00       	push   $0x805abb
+  800174:	e8 94 0b 00 00       	call   800d0d <cprintf>
+		**p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 28 84 80 00       	push   $0x808428
+  8001a4:	68 2c 84 80 00       	push   $0x80842c
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 24 84 80 00       	mov    %eax,0x808424
+		return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+	c = nc;
+  8001be:	a1 24 84 80 00       	mov    0x808424,%eax
+  8001c3:	a3 20 84 80 00       	mov    %eax,0x808420
+	*p1 = np1;
+  8001c8:	8b 15 2c 84 80 00    	mov    0x80842c,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 28 84 80 00       	push   $0x808428
+  8001db:	68 2c 84 80 00       	push   $0x80842c
+  8001e0:	ff 35 28 84 80 00    	push   0x808428
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 24 84 80 00       	mov    %eax,0x808424
+	return c;
+  8001f0:	a1 20 84 80 00       	mov    0x808420,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 ca 02 00 00    	jne    800511 <runcmd+0x317>
+			if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 66 2b 00 00       	call   802ddb <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+			if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 7a 02 00 00    	jne    800511 <runcmd+0x317>
+			if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 44 49 00 00       	call   804bea <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+			if (debug)
+  8002b1:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002be:	e8 18 1c 00 00       	call   801edb <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+			if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 ee 01 00 00    	jne    8004cf <runcmd+0x2d5>
+				close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 68 23 00 00       	call   802657 <close>
+				goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+			argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 c5 5a 80 00       	push   $0x805ac5
+  800313:	e8 f5 09 00 00       	call   800d0d <cprintf>
+				exit();
+  800318:	e8 ed 08 00 00       	call   800c0a <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 18 5c 80 00       	push   $0x805c18
+  80032a:	e8 de 09 00 00       	call   800d0d <cprintf>
+				exit();
+  80032f:	e8 d6 08 00 00       	call   800c0a <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+				cprintf("open %s for read: %e", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 d9 5a 80 00       	push   $0x805ad9
+  80034b:	e8 bd 09 00 00       	call   800d0d <cprintf>
+				exit();
+  800350:	e8 b5 08 00 00       	call   800c0a <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 46 23 00 00       	call   8026a9 <dup>
+				close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 ec 22 00 00       	call   802657 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 3b 2a 00 00       	call   802ddb <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+			if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 40 5c 80 00       	push   $0x805c40
+  8003bc:	e8 4c 09 00 00       	call   800d0d <cprintf>
+				exit();
+  8003c1:	e8 44 08 00 00       	call   800c0a <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 ee 5a 80 00       	push   $0x805aee
+  8003da:	e8 2e 09 00 00       	call   800d0d <cprintf>
+				exit();
+  8003df:	e8 26 08 00 00       	call   800c0a <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 b7 22 00 00       	call   8026a9 <dup>
+				close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 5d 22 00 00       	call   802657 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 04 5b 80 00       	push   $0x805b04
+  80040b:	e8 fd 08 00 00       	call   800d0d <cprintf>
+				exit();
+  800410:	e8 f5 07 00 00       	call   800c0a <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 0d 5b 80 00       	push   $0x805b0d
+  800431:	e8 d7 08 00 00       	call   800d0d <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 1a 5b 80 00       	push   $0x805b1a
+  800447:	e8 c1 08 00 00       	call   800d0d <cprintf>
+				exit();
+  80044c:	e8 b9 07 00 00       	call   800c0a <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 8d 00 00 00    	jne    8004f0 <runcmd+0x2f6>
+				close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 e6 21 00 00       	call   802657 <close>
+				goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 a7 00 00 00    	je     800523 <runcmd+0x329>
+	if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 bd 00 00 00    	jne    800545 <runcmd+0x34b>
+	argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+	if (debug) {
+  800490:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  800497:	0f 84 1c 01 00 00    	je     8005b9 <runcmd+0x3bf>
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80049d:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80049f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8004a5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8004aa:	0f 87 bd 00 00 00    	ja     80056d <runcmd+0x373>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8004b0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8004b5:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8004b7:	c1 e8 10             	shr    $0x10,%eax
+  8004ba:	0f 84 ad 00 00 00    	je     80056d <runcmd+0x373>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8004c0:	c1 e0 10             	shl    $0x10,%eax
+  8004c3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8004c8:	29 c2                	sub    %eax,%edx
+  8004ca:	e9 a4 00 00 00       	jmp    800573 <runcmd+0x379>
+					dup(p[0], 0);
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	6a 00                	push   $0x0
+  8004d4:	50                   	push   %eax
+  8004d5:	e8 cf 21 00 00       	call   8026a9 <dup>
+					close(p[0]);
+  8004da:	83 c4 04             	add    $0x4,%esp
+  8004dd:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  8004e3:	e8 6f 21 00 00       	call   802657 <close>
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	e9 f1 fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+					dup(p[1], 1);
+  8004f0:	83 ec 08             	sub    $0x8,%esp
+  8004f3:	6a 01                	push   $0x1
+  8004f5:	50                   	push   %eax
+  8004f6:	e8 ae 21 00 00       	call   8026a9 <dup>
+					close(p[1]);
+  8004fb:	83 c4 04             	add    $0x4,%esp
+  8004fe:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800504:	e8 4e 21 00 00       	call   802657 <close>
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	e9 52 ff ff ff       	jmp    800463 <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  800511:	57                   	push   %edi
+  800512:	68 23 5b 80 00       	push   $0x805b23
+  800517:	6a 77                	push   $0x77
+  800519:	68 3f 5b 80 00       	push   $0x805b3f
+  80051e:	e8 0f 07 00 00       	call   800c32 <_panic>
+		if (debug)
+  800523:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80052a:	0f 84 3c 02 00 00    	je     80076c <runcmd+0x572>
+			cprintf("EMPTY COMMAND\n");
+  800530:	83 ec 0c             	sub    $0xc,%esp
+  800533:	68 49 5b 80 00       	push   $0x805b49
+  800538:	e8 d0 07 00 00       	call   800d0d <cprintf>
+  80053d:	83 c4 10             	add    $0x10,%esp
+		return;
+  800540:	e9 27 02 00 00       	jmp    80076c <runcmd+0x572>
+		argv0buf[0] = '/';
+  800545:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	50                   	push   %eax
+  800550:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  800556:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  80055c:	50                   	push   %eax
+  80055d:	e8 7f 0e 00 00       	call   8013e1 <strcpy>
+		argv[0] = argv0buf;
+  800562:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  800565:	83 c4 10             	add    $0x10,%esp
+  800568:	e9 1b ff ff ff       	jmp    800488 <runcmd+0x28e>
+		return pthread_main_tls;
+  80056d:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  800573:	8b 02                	mov    (%edx),%eax
+  800575:	8b 40 48             	mov    0x48(%eax),%eax
+  800578:	83 ec 08             	sub    $0x8,%esp
+  80057b:	50                   	push   %eax
+  80057c:	68 58 5b 80 00       	push   $0x805b58
+  800581:	e8 87 07 00 00       	call   800d0d <cprintf>
+		for (i = 0; argv[i]; i++)
+  800586:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	eb 11                	jmp    80059f <runcmd+0x3a5>
+			cprintf(" %s", argv[i]);
+  80058e:	83 ec 08             	sub    $0x8,%esp
+  800591:	50                   	push   %eax
+  800592:	68 e3 5b 80 00       	push   $0x805be3
+  800597:	e8 71 07 00 00       	call   800d0d <cprintf>
+  80059c:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; argv[i]; i++)
+  80059f:	83 c3 04             	add    $0x4,%ebx
+  8005a2:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005a5:	85 c0                	test   %eax,%eax
+  8005a7:	75 e5                	jne    80058e <runcmd+0x394>
+		cprintf("\n");
+  8005a9:	83 ec 0c             	sub    $0xc,%esp
+  8005ac:	68 a0 5a 80 00       	push   $0x805aa0
+  8005b1:	e8 57 07 00 00       	call   800d0d <cprintf>
+  8005b6:	83 c4 10             	add    $0x10,%esp
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  8005b9:	83 ec 08             	sub    $0x8,%esp
+  8005bc:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	ff 75 a8             	push   -0x58(%ebp)
+  8005c3:	e8 c4 35 00 00       	call   803b8c <spawn>
+  8005c8:	89 c3                	mov    %eax,%ebx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	85 c0                	test   %eax,%eax
+  8005cf:	78 5d                	js     80062e <runcmd+0x434>
+	close_all();
+  8005d1:	e8 ae 20 00 00       	call   802684 <close_all>
+		if (debug)
+  8005d6:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8005dd:	0f 85 a4 00 00 00    	jne    800687 <runcmd+0x48d>
+		wait(r);
+  8005e3:	83 ec 0c             	sub    $0xc,%esp
+  8005e6:	53                   	push   %ebx
+  8005e7:	e8 7b 47 00 00       	call   804d67 <wait>
+		if (debug)
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8005f6:	0f 84 78 01 00 00    	je     800774 <runcmd+0x57a>
+  8005fc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8005fe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800604:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800609:	0f 87 c2 00 00 00    	ja     8006d1 <runcmd+0x4d7>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80060f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800614:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800616:	c1 e8 10             	shr    $0x10,%eax
+  800619:	0f 84 b2 00 00 00    	je     8006d1 <runcmd+0x4d7>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80061f:	c1 e0 10             	shl    $0x10,%eax
+  800622:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800627:	29 c2                	sub    %eax,%edx
+  800629:	e9 a9 00 00 00       	jmp    8006d7 <runcmd+0x4dd>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  80062e:	83 ec 04             	sub    $0x4,%esp
+  800631:	50                   	push   %eax
+  800632:	ff 75 a8             	push   -0x58(%ebp)
+  800635:	68 66 5b 80 00       	push   $0x805b66
+  80063a:	e8 ce 06 00 00       	call   800d0d <cprintf>
+	close_all();
+  80063f:	e8 40 20 00 00       	call   802684 <close_all>
+	if (r >= 0) {
+  800644:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  800647:	85 ff                	test   %edi,%edi
+  800649:	0f 84 18 01 00 00    	je     800767 <runcmd+0x56d>
+		if (debug)
+  80064f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  800656:	0f 84 b3 00 00 00    	je     80070f <runcmd+0x515>
+  80065c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80065e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800664:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800669:	0f 87 83 00 00 00    	ja     8006f2 <runcmd+0x4f8>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80066f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800674:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800676:	c1 e8 10             	shr    $0x10,%eax
+  800679:	74 77                	je     8006f2 <runcmd+0x4f8>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80067b:	c1 e0 10             	shl    $0x10,%eax
+  80067e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800683:	29 c2                	sub    %eax,%edx
+  800685:	eb 71                	jmp    8006f8 <runcmd+0x4fe>
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800687:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  80068a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80068c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800692:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800697:	77 18                	ja     8006b1 <runcmd+0x4b7>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800699:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80069e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8006a0:	c1 e8 10             	shr    $0x10,%eax
+  8006a3:	74 0c                	je     8006b1 <runcmd+0x4b7>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8006a5:	c1 e0 10             	shl    $0x10,%eax
+  8006a8:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8006ad:	29 c1                	sub    %eax,%ecx
+  8006af:	eb 06                	jmp    8006b7 <runcmd+0x4bd>
+		return pthread_main_tls;
+  8006b1:	8b 0d 00 8b 80 00    	mov    0x808b00,%ecx
+  8006b7:	8b 01                	mov    (%ecx),%eax
+  8006b9:	8b 40 48             	mov    0x48(%eax),%eax
+  8006bc:	53                   	push   %ebx
+  8006bd:	52                   	push   %edx
+  8006be:	50                   	push   %eax
+  8006bf:	68 74 5b 80 00       	push   $0x805b74
+  8006c4:	e8 44 06 00 00       	call   800d0d <cprintf>
+  8006c9:	83 c4 10             	add    $0x10,%esp
+  8006cc:	e9 12 ff ff ff       	jmp    8005e3 <runcmd+0x3e9>
+  8006d1:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  8006d7:	8b 02                	mov    (%edx),%eax
+  8006d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	50                   	push   %eax
+  8006e0:	68 89 5b 80 00       	push   $0x805b89
+  8006e5:	e8 23 06 00 00       	call   800d0d <cprintf>
+  8006ea:	83 c4 10             	add    $0x10,%esp
+  8006ed:	e9 55 ff ff ff       	jmp    800647 <runcmd+0x44d>
+  8006f2:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  8006f8:	8b 02                	mov    (%edx),%eax
+  8006fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8006fd:	83 ec 04             	sub    $0x4,%esp
+  800700:	57                   	push   %edi
+  800701:	50                   	push   %eax
+  800702:	68 9f 5b 80 00       	push   $0x805b9f
+  800707:	e8 01 06 00 00       	call   800d0d <cprintf>
+  80070c:	83 c4 10             	add    $0x10,%esp
+		wait(pipe_child);
+  80070f:	83 ec 0c             	sub    $0xc,%esp
+  800712:	57                   	push   %edi
+  800713:	e8 4f 46 00 00       	call   804d67 <wait>
+		if (debug)
+  800718:	83 c4 10             	add    $0x10,%esp
+  80071b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  800722:	74 43                	je     800767 <runcmd+0x56d>
+  800724:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800726:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80072c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800731:	77 18                	ja     80074b <runcmd+0x551>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800733:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800738:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80073a:	c1 e8 10             	shr    $0x10,%eax
+  80073d:	74 0c                	je     80074b <runcmd+0x551>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80073f:	c1 e0 10             	shl    $0x10,%eax
+  800742:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800747:	29 c2                	sub    %eax,%edx
+  800749:	eb 06                	jmp    800751 <runcmd+0x557>
+		return pthread_main_tls;
+  80074b:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800751:	8b 02                	mov    (%edx),%eax
+  800753:	8b 40 48             	mov    0x48(%eax),%eax
+  800756:	83 ec 08             	sub    $0x8,%esp
+  800759:	50                   	push   %eax
+  80075a:	68 89 5b 80 00       	push   $0x805b89
+  80075f:	e8 a9 05 00 00       	call   800d0d <cprintf>
+  800764:	83 c4 10             	add    $0x10,%esp
+	exit();
+  800767:	e8 9e 04 00 00       	call   800c0a <exit>
+}
+  80076c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076f:	5b                   	pop    %ebx
+  800770:	5e                   	pop    %esi
+  800771:	5f                   	pop    %edi
+  800772:	5d                   	pop    %ebp
+  800773:	c3                   	ret
+	if (pipe_child) {
+  800774:	85 ff                	test   %edi,%edi
+  800776:	75 97                	jne    80070f <runcmd+0x515>
+  800778:	eb ed                	jmp    800767 <runcmd+0x56d>
+
+0080077a <usage>:
+
+
+void
+usage(void)
+{
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  800780:	68 68 5c 80 00       	push   $0x805c68
+  800785:	e8 83 05 00 00       	call   800d0d <cprintf>
+	exit();
+  80078a:	e8 7b 04 00 00       	call   800c0a <exit>
+}
+  80078f:	83 c4 10             	add    $0x10,%esp
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+
+00800794 <getcmd>:
+
+// Read the next command line.  Scripts are read through the stdin
+// stream, a buffer at a time rather than a byte at a time.
+char*
+getcmd(int interactive)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	83 ec 08             	sub    $0x8,%esp
+	static char buf[BUFSIZ];
+	int n;
+
+	if (interactive)
+  80079a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80079e:	75 31                	jne    8007d1 <getcmd+0x3d>
+		return readline("$ ");
+	if (!fgets(buf, sizeof buf, stdin))
+  8007a0:	83 ec 04             	sub    $0x4,%esp
+  8007a3:	ff 35 c0 62 80 00    	push   0x8062c0
+  8007a9:	68 00 04 00 00       	push   $0x400
+  8007ae:	68 20 80 80 00       	push   $0x808020
+  8007b3:	e8 52 30 00 00       	call   80380a <fgets>
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	85 c0                	test   %eax,%eax
+  8007bd:	74 22                	je     8007e1 <getcmd+0x4d>
+		return NULL;
+	n = strlen(buf);
+  8007bf:	83 ec 0c             	sub    $0xc,%esp
+  8007c2:	68 20 80 80 00       	push   $0x808020
+  8007c7:	e8 da 0b 00 00       	call   8013a6 <strlen>
+	while (n > 0 && (buf[n-1] == '\n' || buf[n-1] == '\r'))
+  8007cc:	83 c4 10             	add    $0x10,%esp
+  8007cf:	eb 19                	jmp    8007ea <getcmd+0x56>
+		return readline("$ ");
+  8007d1:	83 ec 0c             	sub    $0xc,%esp
+  8007d4:	68 bc 5b 80 00       	push   $0x805bbc
+  8007d9:	e8 d8 0a 00 00       	call   8012b6 <readline>
+  8007de:	83 c4 10             	add    $0x10,%esp
+		buf[--n] = 0;
+	return buf;
+}
+  8007e1:	c9                   	leave
+  8007e2:	c3                   	ret
+		buf[--n] = 0;
+  8007e3:	c6 81 20 80 80 00 00 	movb   $0x0,0x808020(%ecx)
+	while (n > 0 && (buf[n-1] == '\n' || buf[n-1] == '\r'))
+  8007ea:	85 c0                	test   %eax,%eax
+  8007ec:	7e 1d                	jle    80080b <getcmd+0x77>
+  8007ee:	83 e8 01             	sub    $0x1,%eax
+  8007f1:	89 c1                	mov    %eax,%ecx
+  8007f3:	0f b6 90 20 80 80 00 	movzbl 0x808020(%eax),%edx
+  8007fa:	80 fa 0a             	cmp    $0xa,%dl
+  8007fd:	74 e4                	je     8007e3 <getcmd+0x4f>
+  8007ff:	80 fa 0d             	cmp    $0xd,%dl
+  800802:	74 df                	je     8007e3 <getcmd+0x4f>
+	return buf;
+  800804:	b8 20 80 80 00       	mov    $0x808020,%eax
+  800809:	eb d6                	jmp    8007e1 <getcmd+0x4d>
+  80080b:	b8 20 80 80 00       	mov    $0x808020,%eax
+  800810:	eb cf                	jmp    8007e1 <getcmd+0x4d>
+
+00800812 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	57                   	push   %edi
+  800816:	56                   	push   %esi
+  800817:	53                   	push   %ebx
+  800818:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	argstart(&argc, argv, &args);
+  80081b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  80081e:	50                   	push   %eax
+  80081f:	ff 75 0c             	push   0xc(%ebp)
+  800822:	8d 45 08             	lea    0x8(%ebp),%eax
+  800825:	50                   	push   %eax
+  800826:	e8 0c 1b 00 00       	call   802337 <argstart>
+	while ((r = argnext(&args)) >= 0)
+  80082b:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  80082e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  800835:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  80083a:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  80083d:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  800842:	eb 10                	jmp    800854 <umain+0x42>
+			debug++;
+  800844:	83 05 00 80 80 00 01 	addl   $0x1,0x808000
+			break;
+  80084b:	eb 07                	jmp    800854 <umain+0x42>
+			interactive = 1;
+  80084d:	89 f7                	mov    %esi,%edi
+  80084f:	eb 03                	jmp    800854 <umain+0x42>
+		switch (r) {
+  800851:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  800854:	83 ec 0c             	sub    $0xc,%esp
+  800857:	53                   	push   %ebx
+  800858:	e8 0a 1b 00 00       	call   802367 <argnext>
+  80085d:	83 c4 10             	add    $0x10,%esp
+  800860:	85 c0                	test   %eax,%eax
+  800862:	78 16                	js     80087a <umain+0x68>
+		switch (r) {
+  800864:	83 f8 69             	cmp    $0x69,%eax
+  800867:	74 e4                	je     80084d <umain+0x3b>
+  800869:	83 f8 78             	cmp    $0x78,%eax
+  80086c:	74 e3                	je     800851 <umain+0x3f>
+  80086e:	83 f8 64             	cmp    $0x64,%eax
+  800871:	74 d1                	je     800844 <umain+0x32>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  800873:	e8 02 ff ff ff       	call   80077a <usage>
+  800878:	eb da                	jmp    800854 <umain+0x42>
+		}
+
+	if (argc > 2)
+  80087a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80087e:	7f 23                	jg     8008a3 <umain+0x91>
+		usage();
+	if (argc == 2) {
+  800880:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800884:	74 24                	je     8008aa <umain+0x98>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	if (interactive == '?')
+  800886:	83 ff 3f             	cmp    $0x3f,%edi
+  800889:	0f 85 06 01 00 00    	jne    800995 <umain+0x183>
+		interactive = iscons(0);
+  80088f:	83 ec 0c             	sub    $0xc,%esp
+  800892:	6a 00                	push   $0x0
+  800894:	e8 78 02 00 00       	call   800b11 <iscons>
+  800899:	89 c7                	mov    %eax,%edi
+  80089b:	83 c4 10             	add    $0x10,%esp
+  80089e:	e9 f2 00 00 00       	jmp    800995 <umain+0x183>
+		usage();
+  8008a3:	e8 d2 fe ff ff       	call   80077a <usage>
+  8008a8:	eb d6                	jmp    800880 <umain+0x6e>
+		close(0);
+  8008aa:	83 ec 0c             	sub    $0xc,%esp
+  8008ad:	6a 00                	push   $0x0
+  8008af:	e8 a3 1d 00 00       	call   802657 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  8008b4:	83 c4 08             	add    $0x8,%esp
+  8008b7:	6a 00                	push   $0x0
+  8008b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008bc:	ff 70 04             	push   0x4(%eax)
+  8008bf:	e8 17 25 00 00       	call   802ddb <open>
+  8008c4:	83 c4 10             	add    $0x10,%esp
+  8008c7:	85 c0                	test   %eax,%eax
+  8008c9:	78 1b                	js     8008e6 <umain+0xd4>
+		assert(r == 0);
+  8008cb:	74 b9                	je     800886 <umain+0x74>
+  8008cd:	68 cb 5b 80 00       	push   $0x805bcb
+  8008d2:	68 d2 5b 80 00       	push   $0x805bd2
+  8008d7:	68 3a 01 00 00       	push   $0x13a
+  8008dc:	68 3f 5b 80 00       	push   $0x805b3f
+  8008e1:	e8 4c 03 00 00       	call   800c32 <_panic>
+			panic("open %s: %e", argv[1], r);
+  8008e6:	83 ec 0c             	sub    $0xc,%esp
+  8008e9:	50                   	push   %eax
+  8008ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ed:	ff 70 04             	push   0x4(%eax)
+  8008f0:	68 bf 5b 80 00       	push   $0x805bbf
+  8008f5:	68 39 01 00 00       	push   $0x139
+  8008fa:	68 3f 5b 80 00       	push   $0x805b3f
+  8008ff:	e8 2e 03 00 00       	call   800c32 <_panic>
+	while (1) {
+		char *buf;
+
+		buf = getcmd(interactive);
+		if (buf == NULL) {
+			if (debug)
+  800904:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80090b:	75 0a                	jne    800917 <umain+0x105>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  80090d:	e8 f8 02 00 00       	call   800c0a <exit>
+  800912:	e9 94 00 00 00       	jmp    8009ab <umain+0x199>
+				cprintf("EXITING\n");
+  800917:	83 ec 0c             	sub    $0xc,%esp
+  80091a:	68 e7 5b 80 00       	push   $0x805be7
+  80091f:	e8 e9 03 00 00       	call   800d0d <cprintf>
+  800924:	83 c4 10             	add    $0x10,%esp
+  800927:	eb e4                	jmp    80090d <umain+0xfb>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	53                   	push   %ebx
+  80092d:	68 f0 5b 80 00       	push   $0x805bf0
+  800932:	e8 d6 03 00 00       	call   800d0d <cprintf>
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	eb 7c                	jmp    8009b8 <umain+0x1a6>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  80093c:	83 ec 08             	sub    $0x8,%esp
+  80093f:	53                   	push   %ebx
+  800940:	68 fa 5b 80 00       	push   $0x805bfa
+  800945:	e8 d2 29 00 00       	call   80331c <printf>
+  80094a:	83 c4 10             	add    $0x10,%esp
+  80094d:	eb 78                	jmp    8009c7 <umain+0x1b5>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  80094f:	83 ec 0c             	sub    $0xc,%esp
+  800952:	68 00 5c 80 00       	push   $0x805c00
+  800957:	e8 b1 03 00 00       	call   800d0d <cprintf>
+  80095c:	83 c4 10             	add    $0x10,%esp
+  80095f:	eb 73                	jmp    8009d4 <umain+0x1c2>
+		// Hand unread script input back to fd 0 for the child.
+		fflush(stdin);
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  800961:	50                   	push   %eax
+  800962:	68 1a 5b 80 00       	push   $0x805b1a
+  800967:	68 53 01 00 00       	push   $0x153
+  80096c:	68 3f 5b 80 00       	push   $0x805b3f
+  800971:	e8 bc 02 00 00       	call   800c32 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  800976:	83 ec 08             	sub    $0x8,%esp
+  800979:	50                   	push   %eax
+  80097a:	68 0d 5c 80 00       	push   $0x805c0d
+  80097f:	e8 89 03 00 00       	call   800d0d <cprintf>
+  800984:	83 c4 10             	add    $0x10,%esp
+  800987:	eb 78                	jmp    800a01 <umain+0x1ef>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  800989:	83 ec 0c             	sub    $0xc,%esp
+  80098c:	56                   	push   %esi
+  80098d:	e8 d5 43 00 00       	call   804d67 <wait>
+  800992:	83 c4 10             	add    $0x10,%esp
+		buf = getcmd(interactive);
+  800995:	83 ec 0c             	sub    $0xc,%esp
+  800998:	57                   	push   %edi
+  800999:	e8 f6 fd ff ff       	call   800794 <getcmd>
+  80099e:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  8009a0:	83 c4 10             	add    $0x10,%esp
+  8009a3:	85 c0                	test   %eax,%eax
+  8009a5:	0f 84 59 ff ff ff    	je     800904 <umain+0xf2>
+		if (debug)
+  8009ab:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8009b2:	0f 85 71 ff ff ff    	jne    800929 <umain+0x117>
+		if (buf[0] == '#')
+  8009b8:	80 3b 23             	cmpb   $0x23,(%ebx)
+  8009bb:	74 d8                	je     800995 <umain+0x183>
+		if (echocmds)
+  8009bd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8009c1:	0f 85 75 ff ff ff    	jne    80093c <umain+0x12a>
+		if (debug)
+  8009c7:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8009ce:	0f 85 7b ff ff ff    	jne    80094f <umain+0x13d>
+		fflush(stdin);
+  8009d4:	83 ec 0c             	sub    $0xc,%esp
+  8009d7:	ff 35 c0 62 80 00    	push   0x8062c0
+  8009dd:	e8 13 2d 00 00       	call   8036f5 <fflush>
+		if ((r = fork()) < 0)
+  8009e2:	e8 f4 14 00 00       	call   801edb <fork>
+  8009e7:	89 c6                	mov    %eax,%esi
+  8009e9:	83 c4 10             	add    $0x10,%esp
+  8009ec:	85 c0                	test   %eax,%eax
+  8009ee:	0f 88 6d ff ff ff    	js     800961 <umain+0x14f>
+		if (debug)
+  8009f4:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8009fb:	0f 85 75 ff ff ff    	jne    800976 <umain+0x164>
+		if (r == 0) {
+  800a01:	85 f6                	test   %esi,%esi
+  800a03:	75 84                	jne    800989 <umain+0x177>
+			runcmd(buf);
+  800a05:	83 ec 0c             	sub    $0xc,%esp
+  800a08:	53                   	push   %ebx
+  800a09:	e8 ec f7 ff ff       	call   8001fa <runcmd>
+			exit();
+  800a0e:	e8 f7 01 00 00       	call   800c0a <exit>
+  800a13:	83 c4 10             	add    $0x10,%esp
+  800a16:	e9 7a ff ff ff       	jmp    800995 <umain+0x183>
+
+00800a1b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a20:	c3                   	ret
+
+00800a21 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800a27:	68 89 5c 80 00       	push   $0x805c89
+  800a2c:	ff 75 0c             	push   0xc(%ebp)
+  800a2f:	e8 ad 09 00 00       	call   8013e1 <strcpy>
+	return 0;
+}
+  800a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a39:	c9                   	leave
+  800a3a:	c3                   	ret
+
+00800a3b <devcons_write>:
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	57                   	push   %edi
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800a47:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800a4c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800a52:	eb 2e                	jmp    800a82 <devcons_write+0x47>
+		m = n - tot;
+  800a54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a57:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800a59:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800a5e:	39 c3                	cmp    %eax,%ebx
+  800a60:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800a63:	83 ec 04             	sub    $0x4,%esp
+  800a66:	53                   	push   %ebx
+  800a67:	89 f0                	mov    %esi,%eax
+  800a69:	03 45 0c             	add    0xc(%ebp),%eax
+  800a6c:	50                   	push   %eax
+  800a6d:	57                   	push   %edi
+  800a6e:	e8 f4 0a 00 00       	call   801567 <memmove>
+		sys_cputs(buf, m);
+  800a73:	83 c4 08             	add    $0x8,%esp
+  800a76:	53                   	push   %ebx
+  800a77:	57                   	push   %edi
+  800a78:	e8 a8 0c 00 00       	call   801725 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800a7d:	01 de                	add    %ebx,%esi
+  800a7f:	83 c4 10             	add    $0x10,%esp
+  800a82:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800a85:	72 cd                	jb     800a54 <devcons_write+0x19>
+}
+  800a87:	89 f0                	mov    %esi,%eax
+  800a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a8c:	5b                   	pop    %ebx
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5f                   	pop    %edi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <devcons_read>:
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800aa0:	75 07                	jne    800aa9 <devcons_read+0x18>
+  800aa2:	eb 1f                	jmp    800ac3 <devcons_read+0x32>
+		sys_yield();
+  800aa4:	e8 4a 0d 00 00       	call   8017f3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800aa9:	e8 a2 0c 00 00       	call   801750 <sys_cgetc>
+  800aae:	85 c0                	test   %eax,%eax
+  800ab0:	74 f2                	je     800aa4 <devcons_read+0x13>
+	if (c < 0)
+  800ab2:	78 0f                	js     800ac3 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800ab4:	83 f8 04             	cmp    $0x4,%eax
+  800ab7:	74 0c                	je     800ac5 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abc:	88 02                	mov    %al,(%edx)
+	return 1;
+  800abe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+		return 0;
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aca:	eb f7                	jmp    800ac3 <devcons_read+0x32>
+
+00800acc <cputchar>:
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800ad8:	6a 01                	push   $0x1
+  800ada:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800add:	50                   	push   %eax
+  800ade:	e8 42 0c 00 00       	call   801725 <sys_cputs>
+}
+  800ae3:	83 c4 10             	add    $0x10,%esp
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <getchar>:
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800aee:	6a 01                	push   $0x1
+  800af0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800af3:	50                   	push   %eax
+  800af4:	6a 00                	push   $0x0
+  800af6:	e8 98 1c 00 00       	call   802793 <read>
+	if (r < 0)
+  800afb:	83 c4 10             	add    $0x10,%esp
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	78 06                	js     800b08 <getchar+0x20>
+	if (r < 1)
+  800b02:	74 06                	je     800b0a <getchar+0x22>
+	return c;
+  800b04:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800b08:	c9                   	leave
+  800b09:	c3                   	ret
+		return -E_EOF;
+  800b0a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800b0f:	eb f7                	jmp    800b08 <getchar+0x20>
+
+00800b11 <iscons>:
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b1a:	50                   	push   %eax
+  800b1b:	ff 75 08             	push   0x8(%ebp)
+  800b1e:	e8 e0 19 00 00       	call   802503 <fd_lookup>
+  800b23:	83 c4 10             	add    $0x10,%esp
+  800b26:	85 c0                	test   %eax,%eax
+  800b28:	78 11                	js     800b3b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800b2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b2d:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  800b33:	39 10                	cmp    %edx,(%eax)
+  800b35:	0f 94 c0             	sete   %al
+  800b38:	0f b6 c0             	movzbl %al,%eax
+}
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+00800b3d <opencons>:
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800b43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b46:	50                   	push   %eax
+  800b47:	e8 61 19 00 00       	call   8024ad <fd_alloc>
+  800b4c:	83 c4 10             	add    $0x10,%esp
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	78 3a                	js     800b8d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800b53:	83 ec 04             	sub    $0x4,%esp
+  800b56:	68 07 04 00 00       	push   $0x407
+  800b5b:	ff 75 f4             	push   -0xc(%ebp)
+  800b5e:	6a 00                	push   $0x0
+  800b60:	e8 ba 0c 00 00       	call   80181f <sys_page_alloc>
+  800b65:	83 c4 10             	add    $0x10,%esp
+  800b68:	85 c0                	test   %eax,%eax
+  800b6a:	78 21                	js     800b8d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b6f:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  800b75:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b7a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800b81:	83 ec 0c             	sub    $0xc,%esp
+  800b84:	50                   	push   %eax
+  800b85:	e8 fc 18 00 00       	call   802486 <fd2num>
+  800b8a:	83 c4 10             	add    $0x10,%esp
+}
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+
+00800b8f <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	57                   	push   %edi
+  800b93:	56                   	push   %esi
+  800b94:	53                   	push   %ebx
+  800b95:	83 ec 1c             	sub    $0x1c,%esp
+  800b98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800b9e:	e8 24 0c 00 00       	call   8017c7 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800ba3:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800ba6:	89 15 00 8b 80 00    	mov    %edx,0x808b00
+	thisenv = &envs[ENVX(eid)];
+  800bac:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800bb1:	89 c1                	mov    %eax,%ecx
+  800bb3:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800bb5:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800bbb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bc0:	77 16                	ja     800bd8 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bc2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bc7:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800bc9:	c1 e8 10             	shr    $0x10,%eax
+  800bcc:	74 0a                	je     800bd8 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bce:	c1 e0 10             	shl    $0x10,%eax
+  800bd1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bd6:	29 c2                	sub    %eax,%edx
+  800bd8:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800bdb:	c1 e0 04             	shl    $0x4,%eax
+  800bde:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800be3:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800be5:	85 db                	test   %ebx,%ebx
+  800be7:	7e 07                	jle    800bf0 <libmain+0x61>
+		binaryname = argv[0];
+  800be9:	8b 06                	mov    (%esi),%eax
+  800beb:	a3 1c 70 80 00       	mov    %eax,0x80701c
+
+	// call user main routine
+	umain(argc, argv);
+  800bf0:	83 ec 08             	sub    $0x8,%esp
+  800bf3:	56                   	push   %esi
+  800bf4:	53                   	push   %ebx
+  800bf5:	e8 18 fc ff ff       	call   800812 <umain>
+
+	// exit gracefully
+	exit();
+  800bfa:	e8 0b 00 00 00       	call   800c0a <exit>
+}
+  800bff:	83 c4 10             	add    $0x10,%esp
+  800c02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c05:	5b                   	pop    %ebx
+  800c06:	5e                   	pop    %esi
+  800c07:	5f                   	pop    %edi
+  800c08:	5d                   	pop    %ebp
+  800c09:	c3                   	ret
+
+00800c0a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800c10:	6a 00                	push   $0x0
+  800c12:	e8 de 2a 00 00       	call   8036f5 <fflush>
+	pthread_kill_others();
+  800c17:	e8 b7 47 00 00       	call   8053d3 <pthread_kill_others>
+	close_all();
+  800c1c:	e8 63 1a 00 00       	call   802684 <close_all>
+	sys_env_destroy(0);
+  800c21:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800c28:	e8 4f 0b 00 00       	call   80177c <sys_env_destroy>
+}
+  800c2d:	83 c4 10             	add    $0x10,%esp
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+00800c32 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	56                   	push   %esi
+  800c36:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c37:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800c3a:	8b 35 1c 70 80 00    	mov    0x80701c,%esi
+  800c40:	e8 82 0b 00 00       	call   8017c7 <sys_getenvid>
+  800c45:	83 ec 0c             	sub    $0xc,%esp
+  800c48:	ff 75 0c             	push   0xc(%ebp)
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	56                   	push   %esi
+  800c4f:	50                   	push   %eax
+  800c50:	68 a0 5c 80 00       	push   $0x805ca0
+  800c55:	e8 b3 00 00 00       	call   800d0d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800c5a:	83 c4 18             	add    $0x18,%esp
+  800c5d:	53                   	push   %ebx
+  800c5e:	ff 75 10             	push   0x10(%ebp)
+  800c61:	e8 56 00 00 00       	call   800cbc <vcprintf>
+	cprintf("\n");
+  800c66:	c7 04 24 a0 5a 80 00 	movl   $0x805aa0,(%esp)
+  800c6d:	e8 9b 00 00 00       	call   800d0d <cprintf>
+  800c72:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800c75:	cc                   	int3
+	while (1)
+  800c76:	eb fd                	jmp    800c75 <_panic+0x43>
+
+00800c78 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	53                   	push   %ebx
+  800c7c:	83 ec 04             	sub    $0x4,%esp
+  800c7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800c82:	8b 13                	mov    (%ebx),%edx
+  800c84:	8d 42 01             	lea    0x1(%edx),%eax
+  800c87:	89 03                	mov    %eax,(%ebx)
+  800c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800c90:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c95:	74 09                	je     800ca0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800c97:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800c9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c9e:	c9                   	leave
+  800c9f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800ca0:	83 ec 08             	sub    $0x8,%esp
+  800ca3:	68 ff 00 00 00       	push   $0xff
+  800ca8:	8d 43 08             	lea    0x8(%ebx),%eax
+  800cab:	50                   	push   %eax
+  800cac:	e8 74 0a 00 00       	call   801725 <sys_cputs>
+		b->idx = 0;
+  800cb1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800cb7:	83 c4 10             	add    $0x10,%esp
+  800cba:	eb db                	jmp    800c97 <putch+0x1f>
+
+00800cbc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800cc5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800ccc:	00 00 00 
+	b.cnt = 0;
+  800ccf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800cd6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800cd9:	ff 75 0c             	push   0xc(%ebp)
+  800cdc:	ff 75 08             	push   0x8(%ebp)
+  800cdf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800ce5:	50                   	push   %eax
+  800ce6:	68 78 0c 80 00       	push   $0x800c78
+  800ceb:	e8 14 01 00 00       	call   800e04 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800cf0:	83 c4 08             	add    $0x8,%esp
+  800cf3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800cf9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800cff:	50                   	push   %eax
+  800d00:	e8 20 0a 00 00       	call   801725 <sys_cputs>
+
+	return b.cnt;
+}
+  800d05:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800d0b:	c9                   	leave
+  800d0c:	c3                   	ret
+
+00800d0d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800d13:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800d16:	50                   	push   %eax
+  800d17:	ff 75 08             	push   0x8(%ebp)
+  800d1a:	e8 9d ff ff ff       	call   800cbc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800d1f:	c9                   	leave
+  800d20:	c3                   	ret
+
+00800d21 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  800d27:	83 ec 1c             	sub    $0x1c,%esp
+  800d2a:	89 c7                	mov    %eax,%edi
+  800d2c:	89 d6                	mov    %edx,%esi
+  800d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d31:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d34:	89 d1                	mov    %edx,%ecx
+  800d36:	89 c2                	mov    %eax,%edx
+  800d38:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d3b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d3e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800d41:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800d44:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d47:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800d4e:	39 c2                	cmp    %eax,%edx
+  800d50:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800d53:	72 3e                	jb     800d93 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+  800d58:	ff 75 18             	push   0x18(%ebp)
+  800d5b:	83 eb 01             	sub    $0x1,%ebx
+  800d5e:	53                   	push   %ebx
+  800d5f:	50                   	push   %eax
+  800d60:	83 ec 08             	sub    $0x8,%esp
+  800d63:	ff 75 e4             	push   -0x1c(%ebp)
+  800d66:	ff 75 e0             	push   -0x20(%ebp)
+  800d69:	ff 75 dc             	push   -0x24(%ebp)
+  800d6c:	ff 75 d8             	push   -0x28(%ebp)
+  800d6f:	e8 6e 4b 00 00       	call   8058e2 <__udivdi3>
+  800d74:	83 c4 18             	add    $0x18,%esp
+  800d77:	52                   	push   %edx
+  800d78:	50                   	push   %eax
+  800d79:	89 f2                	mov    %esi,%edx
+  800d7b:	89 f8                	mov    %edi,%eax
+  800d7d:	e8 9f ff ff ff       	call   800d21 <printnum>
+  800d82:	83 c4 20             	add    $0x20,%esp
+  800d85:	eb 13                	jmp    800d9a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800d87:	83 ec 08             	sub    $0x8,%esp
+  800d8a:	56                   	push   %esi
+  800d8b:	ff 75 18             	push   0x18(%ebp)
+  800d8e:	ff d7                	call   *%edi
+  800d90:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800d93:	83 eb 01             	sub    $0x1,%ebx
+  800d96:	85 db                	test   %ebx,%ebx
+  800d98:	7f ed                	jg     800d87 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800d9a:	83 ec 08             	sub    $0x8,%esp
+  800d9d:	56                   	push   %esi
+  800d9e:	83 ec 04             	sub    $0x4,%esp
+  800da1:	ff 75 e4             	push   -0x1c(%ebp)
+  800da4:	ff 75 e0             	push   -0x20(%ebp)
+  800da7:	ff 75 dc             	push   -0x24(%ebp)
+  800daa:	ff 75 d8             	push   -0x28(%ebp)
+  800dad:	e8 51 4b 00 00       	call   805903 <__umoddi3>
+  800db2:	83 c4 14             	add    $0x14,%esp
+  800db5:	0f be 80 c3 5c 80 00 	movsbl 0x805cc3(%eax),%eax
+  800dbc:	50                   	push   %eax
+  800dbd:	ff d7                	call   *%edi
+}
+  800dbf:	83 c4 10             	add    $0x10,%esp
+  800dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800dd0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800dd4:	8b 10                	mov    (%eax),%edx
+  800dd6:	3b 50 04             	cmp    0x4(%eax),%edx
+  800dd9:	73 0a                	jae    800de5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800ddb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800dde:	89 08                	mov    %ecx,(%eax)
+  800de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de3:	88 02                	mov    %al,(%edx)
+}
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+
+00800de7 <printfmt>:
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800ded:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800df0:	50                   	push   %eax
+  800df1:	ff 75 10             	push   0x10(%ebp)
+  800df4:	ff 75 0c             	push   0xc(%ebp)
+  800df7:	ff 75 08             	push   0x8(%ebp)
+  800dfa:	e8 05 00 00 00       	call   800e04 <vprintfmt>
+}
+  800dff:	83 c4 10             	add    $0x10,%esp
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+00800e04 <vprintfmt>:
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 2c             	sub    $0x2c,%esp
+  800e0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e13:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e16:	eb 0a                	jmp    800e22 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800e18:	83 ec 08             	sub    $0x8,%esp
+  800e1b:	53                   	push   %ebx
+  800e1c:	50                   	push   %eax
+  800e1d:	ff d6                	call   *%esi
+  800e1f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800e22:	83 c7 01             	add    $0x1,%edi
+  800e25:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800e29:	83 f8 25             	cmp    $0x25,%eax
+  800e2c:	74 0c                	je     800e3a <vprintfmt+0x36>
+			if (ch == '\0')
+  800e2e:	85 c0                	test   %eax,%eax
+  800e30:	75 e6                	jne    800e18 <vprintfmt+0x14>
+}
+  800e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e35:	5b                   	pop    %ebx
+  800e36:	5e                   	pop    %esi
+  800e37:	5f                   	pop    %edi
+  800e38:	5d                   	pop    %ebp
+  800e39:	c3                   	ret
+		padc = ' ';
+  800e3a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800e3e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800e45:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800e4c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800e53:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800e58:	8d 47 01             	lea    0x1(%edi),%eax
+  800e5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e5e:	0f b6 17             	movzbl (%edi),%edx
+  800e61:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800e64:	3c 55                	cmp    $0x55,%al
+  800e66:	0f 87 c5 03 00 00    	ja     801231 <vprintfmt+0x42d>
+  800e6c:	0f b6 c0             	movzbl %al,%eax
+  800e6f:	ff 24 85 40 5e 80 00 	jmp    *0x805e40(,%eax,4)
+  800e76:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800e79:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e7c:	eb da                	jmp    800e58 <vprintfmt+0x54>
+  800e7e:	0f be d2             	movsbl %dl,%edx
+  800e81:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e89:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800e8c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e8f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800e93:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800e96:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e99:	83 f9 09             	cmp    $0x9,%ecx
+  800e9c:	77 55                	ja     800ef3 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800e9e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800ea1:	eb e9                	jmp    800e8c <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800ea3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea6:	8b 00                	mov    (%eax),%eax
+  800ea8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800eab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eae:	8d 40 04             	lea    0x4(%eax),%eax
+  800eb1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800eb4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800eb7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800ebb:	79 9b                	jns    800e58 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800ebd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ec0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ec3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800eca:	eb 8c                	jmp    800e58 <vprintfmt+0x54>
+			if (width < 0)
+  800ecc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800ecf:	85 d2                	test   %edx,%edx
+  800ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed6:	0f 49 c2             	cmovns %edx,%eax
+  800ed9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800edc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800edf:	e9 74 ff ff ff       	jmp    800e58 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800ee4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800ee7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800eee:	e9 65 ff ff ff       	jmp    800e58 <vprintfmt+0x54>
+  800ef3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ef6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ef9:	eb bc                	jmp    800eb7 <vprintfmt+0xb3>
+			lflag++;
+  800efb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800efe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800f01:	e9 52 ff ff ff       	jmp    800e58 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800f06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f09:	8d 78 04             	lea    0x4(%eax),%edi
+  800f0c:	83 ec 08             	sub    $0x8,%esp
+  800f0f:	53                   	push   %ebx
+  800f10:	ff 30                	push   (%eax)
+  800f12:	ff d6                	call   *%esi
+			break;
+  800f14:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800f17:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800f1a:	e9 b1 02 00 00       	jmp    8011d0 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800f1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f22:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800f25:	8b 10                	mov    (%eax),%edx
+  800f27:	89 d0                	mov    %edx,%eax
+  800f29:	f7 d8                	neg    %eax
+  800f2b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f2e:	83 f8 14             	cmp    $0x14,%eax
+  800f31:	7f 23                	jg     800f56 <vprintfmt+0x152>
+  800f33:	8b 14 85 a0 5f 80 00 	mov    0x805fa0(,%eax,4),%edx
+  800f3a:	85 d2                	test   %edx,%edx
+  800f3c:	74 18                	je     800f56 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800f3e:	52                   	push   %edx
+  800f3f:	68 e4 5b 80 00       	push   $0x805be4
+  800f44:	53                   	push   %ebx
+  800f45:	56                   	push   %esi
+  800f46:	e8 9c fe ff ff       	call   800de7 <printfmt>
+  800f4b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800f4e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800f51:	e9 7a 02 00 00       	jmp    8011d0 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800f56:	50                   	push   %eax
+  800f57:	68 db 5c 80 00       	push   $0x805cdb
+  800f5c:	53                   	push   %ebx
+  800f5d:	56                   	push   %esi
+  800f5e:	e8 84 fe ff ff       	call   800de7 <printfmt>
+  800f63:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800f66:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800f69:	e9 62 02 00 00       	jmp    8011d0 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800f6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f71:	83 c0 04             	add    $0x4,%eax
+  800f74:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f77:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f7a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800f7c:	85 c9                	test   %ecx,%ecx
+  800f7e:	b8 d4 5c 80 00       	mov    $0x805cd4,%eax
+  800f83:	0f 45 c1             	cmovne %ecx,%eax
+  800f86:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800f89:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f8d:	7e 06                	jle    800f95 <vprintfmt+0x191>
+  800f8f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f93:	75 0b                	jne    800fa0 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f95:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f98:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f9b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f9e:	eb 5c                	jmp    800ffc <vprintfmt+0x1f8>
+  800fa0:	83 ec 08             	sub    $0x8,%esp
+  800fa3:	ff 75 d0             	push   -0x30(%ebp)
+  800fa6:	ff 75 cc             	push   -0x34(%ebp)
+  800fa9:	e8 10 04 00 00       	call   8013be <strnlen>
+  800fae:	89 c2                	mov    %eax,%edx
+  800fb0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fb3:	29 d0                	sub    %edx,%eax
+  800fb5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800fb8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800fbc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800fbf:	89 75 08             	mov    %esi,0x8(%ebp)
+  800fc2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fc4:	eb 0e                	jmp    800fd4 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800fc6:	83 ec 08             	sub    $0x8,%esp
+  800fc9:	53                   	push   %ebx
+  800fca:	57                   	push   %edi
+  800fcb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fce:	83 ee 01             	sub    $0x1,%esi
+  800fd1:	83 c4 10             	add    $0x10,%esp
+  800fd4:	85 f6                	test   %esi,%esi
+  800fd6:	7f ee                	jg     800fc6 <vprintfmt+0x1c2>
+  800fd8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fdb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	0f 49 d0             	cmovns %eax,%edx
+  800fe8:	29 d0                	sub    %edx,%eax
+  800fea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800fed:	eb a6                	jmp    800f95 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800fef:	83 ec 08             	sub    $0x8,%esp
+  800ff2:	53                   	push   %ebx
+  800ff3:	52                   	push   %edx
+  800ff4:	ff 55 08             	call   *0x8(%ebp)
+  800ff7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ffa:	89 f1                	mov    %esi,%ecx
+  800ffc:	8d 71 01             	lea    0x1(%ecx),%esi
+  800fff:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801003:	0f be d0             	movsbl %al,%edx
+  801006:	85 d2                	test   %edx,%edx
+  801008:	74 28                	je     801032 <vprintfmt+0x22e>
+  80100a:	85 ff                	test   %edi,%edi
+  80100c:	78 05                	js     801013 <vprintfmt+0x20f>
+  80100e:	83 ef 01             	sub    $0x1,%edi
+  801011:	78 30                	js     801043 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801013:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801017:	74 d6                	je     800fef <vprintfmt+0x1eb>
+  801019:	0f be c0             	movsbl %al,%eax
+  80101c:	83 e8 20             	sub    $0x20,%eax
+  80101f:	83 f8 5e             	cmp    $0x5e,%eax
+  801022:	76 cb                	jbe    800fef <vprintfmt+0x1eb>
+					putch('?', putdat);
+  801024:	83 ec 08             	sub    $0x8,%esp
+  801027:	53                   	push   %ebx
+  801028:	6a 3f                	push   $0x3f
+  80102a:	ff 55 08             	call   *0x8(%ebp)
+  80102d:	83 c4 10             	add    $0x10,%esp
+  801030:	eb c8                	jmp    800ffa <vprintfmt+0x1f6>
+  801032:	8b 75 08             	mov    0x8(%ebp),%esi
+  801035:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801038:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80103b:	01 d0                	add    %edx,%eax
+  80103d:	29 c8                	sub    %ecx,%eax
+  80103f:	89 c7                	mov    %eax,%edi
+  801041:	eb 13                	jmp    801056 <vprintfmt+0x252>
+  801043:	8b 75 08             	mov    0x8(%ebp),%esi
+  801046:	eb ed                	jmp    801035 <vprintfmt+0x231>
+				putch(' ', putdat);
+  801048:	83 ec 08             	sub    $0x8,%esp
+  80104b:	53                   	push   %ebx
+  80104c:	6a 20                	push   $0x20
+  80104e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801050:	83 ef 01             	sub    $0x1,%edi
+  801053:	83 c4 10             	add    $0x10,%esp
+  801056:	85 ff                	test   %edi,%edi
+  801058:	7f ee                	jg     801048 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80105a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80105d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801060:	e9 6b 01 00 00       	jmp    8011d0 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  801065:	83 f9 01             	cmp    $0x1,%ecx
+  801068:	7f 1f                	jg     801089 <vprintfmt+0x285>
+	else if (lflag)
+  80106a:	85 c9                	test   %ecx,%ecx
+  80106c:	74 67                	je     8010d5 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80106e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801071:	8b 00                	mov    (%eax),%eax
+  801073:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801076:	89 c1                	mov    %eax,%ecx
+  801078:	c1 f9 1f             	sar    $0x1f,%ecx
+  80107b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80107e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801081:	8d 40 04             	lea    0x4(%eax),%eax
+  801084:	89 45 14             	mov    %eax,0x14(%ebp)
+  801087:	eb 17                	jmp    8010a0 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  801089:	8b 45 14             	mov    0x14(%ebp),%eax
+  80108c:	8b 50 04             	mov    0x4(%eax),%edx
+  80108f:	8b 00                	mov    (%eax),%eax
+  801091:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801094:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801097:	8b 45 14             	mov    0x14(%ebp),%eax
+  80109a:	8d 40 08             	lea    0x8(%eax),%eax
+  80109d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8010a0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8010a3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8010a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8010ab:	85 c9                	test   %ecx,%ecx
+  8010ad:	0f 89 03 01 00 00    	jns    8011b6 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8010b3:	83 ec 08             	sub    $0x8,%esp
+  8010b6:	53                   	push   %ebx
+  8010b7:	6a 2d                	push   $0x2d
+  8010b9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8010bb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8010be:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8010c1:	f7 da                	neg    %edx
+  8010c3:	83 d1 00             	adc    $0x0,%ecx
+  8010c6:	f7 d9                	neg    %ecx
+  8010c8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8010cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010d0:	e9 e1 00 00 00       	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8010d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010d8:	8b 00                	mov    (%eax),%eax
+  8010da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8010dd:	89 c1                	mov    %eax,%ecx
+  8010df:	c1 f9 1f             	sar    $0x1f,%ecx
+  8010e2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8010e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8010eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ee:	eb b0                	jmp    8010a0 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8010f0:	83 f9 01             	cmp    $0x1,%ecx
+  8010f3:	7f 1e                	jg     801113 <vprintfmt+0x30f>
+	else if (lflag)
+  8010f5:	85 c9                	test   %ecx,%ecx
+  8010f7:	74 32                	je     80112b <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8010f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010fc:	8b 10                	mov    (%eax),%edx
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801103:	8d 40 04             	lea    0x4(%eax),%eax
+  801106:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801109:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80110e:	e9 a3 00 00 00       	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  801113:	8b 45 14             	mov    0x14(%ebp),%eax
+  801116:	8b 10                	mov    (%eax),%edx
+  801118:	8b 48 04             	mov    0x4(%eax),%ecx
+  80111b:	8d 40 08             	lea    0x8(%eax),%eax
+  80111e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801121:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801126:	e9 8b 00 00 00       	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80112b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80112e:	8b 10                	mov    (%eax),%edx
+  801130:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801135:	8d 40 04             	lea    0x4(%eax),%eax
+  801138:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80113b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801140:	eb 74                	jmp    8011b6 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  801142:	83 f9 01             	cmp    $0x1,%ecx
+  801145:	7f 1b                	jg     801162 <vprintfmt+0x35e>
+	else if (lflag)
+  801147:	85 c9                	test   %ecx,%ecx
+  801149:	74 2c                	je     801177 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80114b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80114e:	8b 10                	mov    (%eax),%edx
+  801150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801155:	8d 40 04             	lea    0x4(%eax),%eax
+  801158:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80115b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801160:	eb 54                	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  801162:	8b 45 14             	mov    0x14(%ebp),%eax
+  801165:	8b 10                	mov    (%eax),%edx
+  801167:	8b 48 04             	mov    0x4(%eax),%ecx
+  80116a:	8d 40 08             	lea    0x8(%eax),%eax
+  80116d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801170:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801175:	eb 3f                	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  801177:	8b 45 14             	mov    0x14(%ebp),%eax
+  80117a:	8b 10                	mov    (%eax),%edx
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	8d 40 04             	lea    0x4(%eax),%eax
+  801184:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801187:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80118c:	eb 28                	jmp    8011b6 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80118e:	83 ec 08             	sub    $0x8,%esp
+  801191:	53                   	push   %ebx
+  801192:	6a 30                	push   $0x30
+  801194:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801196:	83 c4 08             	add    $0x8,%esp
+  801199:	53                   	push   %ebx
+  80119a:	6a 78                	push   $0x78
+  80119c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80119e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a1:	8b 10                	mov    (%eax),%edx
+  8011a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8011a8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8011ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8011ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011b1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8011bd:	50                   	push   %eax
+  8011be:	ff 75 e0             	push   -0x20(%ebp)
+  8011c1:	57                   	push   %edi
+  8011c2:	51                   	push   %ecx
+  8011c3:	52                   	push   %edx
+  8011c4:	89 da                	mov    %ebx,%edx
+  8011c6:	89 f0                	mov    %esi,%eax
+  8011c8:	e8 54 fb ff ff       	call   800d21 <printnum>
+			break;
+  8011cd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8011d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8011d3:	e9 4a fc ff ff       	jmp    800e22 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8011d8:	83 f9 01             	cmp    $0x1,%ecx
+  8011db:	7f 1b                	jg     8011f8 <vprintfmt+0x3f4>
+	else if (lflag)
+  8011dd:	85 c9                	test   %ecx,%ecx
+  8011df:	74 2c                	je     80120d <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8011e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011e4:	8b 10                	mov    (%eax),%edx
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8011ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8011f6:	eb be                	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8011f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011fb:	8b 10                	mov    (%eax),%edx
+  8011fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801200:	8d 40 08             	lea    0x8(%eax),%eax
+  801203:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801206:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80120b:	eb a9                	jmp    8011b6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80120d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801210:	8b 10                	mov    (%eax),%edx
+  801212:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801217:	8d 40 04             	lea    0x4(%eax),%eax
+  80121a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80121d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801222:	eb 92                	jmp    8011b6 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  801224:	83 ec 08             	sub    $0x8,%esp
+  801227:	53                   	push   %ebx
+  801228:	6a 25                	push   $0x25
+  80122a:	ff d6                	call   *%esi
+			break;
+  80122c:	83 c4 10             	add    $0x10,%esp
+  80122f:	eb 9f                	jmp    8011d0 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  801231:	83 ec 08             	sub    $0x8,%esp
+  801234:	53                   	push   %ebx
+  801235:	6a 25                	push   $0x25
+  801237:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	89 f8                	mov    %edi,%eax
+  80123e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801242:	74 05                	je     801249 <vprintfmt+0x445>
+  801244:	83 e8 01             	sub    $0x1,%eax
+  801247:	eb f5                	jmp    80123e <vprintfmt+0x43a>
+  801249:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80124c:	eb 82                	jmp    8011d0 <vprintfmt+0x3cc>
+
+0080124e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	83 ec 18             	sub    $0x18,%esp
+  801254:	8b 45 08             	mov    0x8(%ebp),%eax
+  801257:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80125a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80125d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801261:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801264:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	74 26                	je     801295 <vsnprintf+0x47>
+  80126f:	85 d2                	test   %edx,%edx
+  801271:	7e 22                	jle    801295 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801273:	ff 75 14             	push   0x14(%ebp)
+  801276:	ff 75 10             	push   0x10(%ebp)
+  801279:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80127c:	50                   	push   %eax
+  80127d:	68 ca 0d 80 00       	push   $0x800dca
+  801282:	e8 7d fb ff ff       	call   800e04 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801287:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80128a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80128d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801290:	83 c4 10             	add    $0x10,%esp
+}
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+		return -E_INVAL;
+  801295:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129a:	eb f7                	jmp    801293 <vsnprintf+0x45>
+
+0080129c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80129c:	55                   	push   %ebp
+  80129d:	89 e5                	mov    %esp,%ebp
+  80129f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8012a2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8012a5:	50                   	push   %eax
+  8012a6:	ff 75 10             	push   0x10(%ebp)
+  8012a9:	ff 75 0c             	push   0xc(%ebp)
+  8012ac:	ff 75 08             	push   0x8(%ebp)
+  8012af:	e8 9a ff ff ff       	call   80124e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+008012b6 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	74 13                	je     8012d9 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  8012c6:	83 ec 04             	sub    $0x4,%esp
+  8012c9:	50                   	push   %eax
+  8012ca:	68 e4 5b 80 00       	push   $0x805be4
+  8012cf:	6a 01                	push   $0x1
+  8012d1:	e8 2f 20 00 00       	call   803305 <fprintf>
+  8012d6:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  8012d9:	83 ec 0c             	sub    $0xc,%esp
+  8012dc:	6a 00                	push   $0x0
+  8012de:	e8 2e f8 ff ff       	call   800b11 <iscons>
+  8012e3:	89 c7                	mov    %eax,%edi
+  8012e5:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  8012e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ed:	eb 4b                	jmp    80133a <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  8012ef:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  8012f4:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  8012f7:	75 08                	jne    801301 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  8012f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fc:	5b                   	pop    %ebx
+  8012fd:	5e                   	pop    %esi
+  8012fe:	5f                   	pop    %edi
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  801301:	83 ec 08             	sub    $0x8,%esp
+  801304:	53                   	push   %ebx
+  801305:	68 35 60 80 00       	push   $0x806035
+  80130a:	e8 fe f9 ff ff       	call   800d0d <cprintf>
+  80130f:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  801312:	b8 00 00 00 00       	mov    $0x0,%eax
+  801317:	eb e0                	jmp    8012f9 <readline+0x43>
+			if (echoing)
+  801319:	85 ff                	test   %edi,%edi
+  80131b:	75 05                	jne    801322 <readline+0x6c>
+			i--;
+  80131d:	83 ee 01             	sub    $0x1,%esi
+  801320:	eb 18                	jmp    80133a <readline+0x84>
+				cputchar('\b');
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	6a 08                	push   $0x8
+  801327:	e8 a0 f7 ff ff       	call   800acc <cputchar>
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	eb ec                	jmp    80131d <readline+0x67>
+			buf[i++] = c;
+  801331:	88 9e 40 84 80 00    	mov    %bl,0x808440(%esi)
+  801337:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  80133a:	e8 a9 f7 ff ff       	call   800ae8 <getchar>
+  80133f:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  801341:	85 c0                	test   %eax,%eax
+  801343:	78 aa                	js     8012ef <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  801345:	83 f8 08             	cmp    $0x8,%eax
+  801348:	0f 94 c0             	sete   %al
+  80134b:	83 fb 7f             	cmp    $0x7f,%ebx
+  80134e:	0f 94 c2             	sete   %dl
+  801351:	08 d0                	or     %dl,%al
+  801353:	74 04                	je     801359 <readline+0xa3>
+  801355:	85 f6                	test   %esi,%esi
+  801357:	7f c0                	jg     801319 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  801359:	83 fb 1f             	cmp    $0x1f,%ebx
+  80135c:	7e 1a                	jle    801378 <readline+0xc2>
+  80135e:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  801364:	7f 12                	jg     801378 <readline+0xc2>
+			if (echoing)
+  801366:	85 ff                	test   %edi,%edi
+  801368:	74 c7                	je     801331 <readline+0x7b>
+				cputchar(c);
+  80136a:	83 ec 0c             	sub    $0xc,%esp
+  80136d:	53                   	push   %ebx
+  80136e:	e8 59 f7 ff ff       	call   800acc <cputchar>
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	eb b9                	jmp    801331 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  801378:	83 fb 0a             	cmp    $0xa,%ebx
+  80137b:	74 05                	je     801382 <readline+0xcc>
+  80137d:	83 fb 0d             	cmp    $0xd,%ebx
+  801380:	75 b8                	jne    80133a <readline+0x84>
+			if (echoing)
+  801382:	85 ff                	test   %edi,%edi
+  801384:	75 11                	jne    801397 <readline+0xe1>
+			buf[i] = 0;
+  801386:	c6 86 40 84 80 00 00 	movb   $0x0,0x808440(%esi)
+			return buf;
+  80138d:	b8 40 84 80 00       	mov    $0x808440,%eax
+  801392:	e9 62 ff ff ff       	jmp    8012f9 <readline+0x43>
+				cputchar('\n');
+  801397:	83 ec 0c             	sub    $0xc,%esp
+  80139a:	6a 0a                	push   $0xa
+  80139c:	e8 2b f7 ff ff       	call   800acc <cputchar>
+  8013a1:	83 c4 10             	add    $0x10,%esp
+  8013a4:	eb e0                	jmp    801386 <readline+0xd0>
+
+008013a6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8013ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b1:	eb 03                	jmp    8013b6 <strlen+0x10>
+		n++;
+  8013b3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8013b6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8013ba:	75 f7                	jne    8013b3 <strlen+0xd>
+	return n;
+}
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+
+008013be <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cc:	eb 03                	jmp    8013d1 <strnlen+0x13>
+		n++;
+  8013ce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013d1:	39 d0                	cmp    %edx,%eax
+  8013d3:	74 08                	je     8013dd <strnlen+0x1f>
+  8013d5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8013d9:	75 f3                	jne    8013ce <strnlen+0x10>
+  8013db:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8013dd:	89 d0                	mov    %edx,%eax
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+
+008013e1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+  8013e4:	53                   	push   %ebx
+  8013e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8013f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8013f7:	83 c0 01             	add    $0x1,%eax
+  8013fa:	84 d2                	test   %dl,%dl
+  8013fc:	75 f2                	jne    8013f0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8013fe:	89 c8                	mov    %ecx,%eax
+  801400:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801403:	c9                   	leave
+  801404:	c3                   	ret
+
+00801405 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	53                   	push   %ebx
+  801409:	83 ec 10             	sub    $0x10,%esp
+  80140c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80140f:	53                   	push   %ebx
+  801410:	e8 91 ff ff ff       	call   8013a6 <strlen>
+  801415:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801418:	ff 75 0c             	push   0xc(%ebp)
+  80141b:	01 d8                	add    %ebx,%eax
+  80141d:	50                   	push   %eax
+  80141e:	e8 be ff ff ff       	call   8013e1 <strcpy>
+	return dst;
+}
+  801423:	89 d8                	mov    %ebx,%eax
+  801425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801428:	c9                   	leave
+  801429:	c3                   	ret
+
+0080142a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801432:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801435:	89 f3                	mov    %esi,%ebx
+  801437:	03 5d 10             	add    0x10(%ebp),%ebx
+  80143a:	89 f0                	mov    %esi,%eax
+  80143c:	eb 0f                	jmp    80144d <strncpy+0x23>
+		*dst++ = *src;
+  80143e:	83 c0 01             	add    $0x1,%eax
+  801441:	0f b6 0a             	movzbl (%edx),%ecx
+  801444:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801447:	80 f9 01             	cmp    $0x1,%cl
+  80144a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80144d:	39 d8                	cmp    %ebx,%eax
+  80144f:	75 ed                	jne    80143e <strncpy+0x14>
+	}
+	return ret;
+}
+  801451:	89 f0                	mov    %esi,%eax
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+
+00801457 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801457:	55                   	push   %ebp
+  801458:	89 e5                	mov    %esp,%ebp
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+  80145c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80145f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801462:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801465:	89 f0                	mov    %esi,%eax
+  801467:	85 d2                	test   %edx,%edx
+  801469:	74 21                	je     80148c <strlcpy+0x35>
+  80146b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80146f:	89 f2                	mov    %esi,%edx
+  801471:	eb 09                	jmp    80147c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801473:	83 c1 01             	add    $0x1,%ecx
+  801476:	83 c2 01             	add    $0x1,%edx
+  801479:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80147c:	39 c2                	cmp    %eax,%edx
+  80147e:	74 09                	je     801489 <strlcpy+0x32>
+  801480:	0f b6 19             	movzbl (%ecx),%ebx
+  801483:	84 db                	test   %bl,%bl
+  801485:	75 ec                	jne    801473 <strlcpy+0x1c>
+  801487:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801489:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80148c:	29 f0                	sub    %esi,%eax
+}
+  80148e:	5b                   	pop    %ebx
+  80148f:	5e                   	pop    %esi
+  801490:	5d                   	pop    %ebp
+  801491:	c3                   	ret
+
+00801492 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801498:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80149b:	eb 06                	jmp    8014a3 <strcmp+0x11>
+		p++, q++;
+  80149d:	83 c1 01             	add    $0x1,%ecx
+  8014a0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8014a3:	0f b6 01             	movzbl (%ecx),%eax
+  8014a6:	84 c0                	test   %al,%al
+  8014a8:	74 04                	je     8014ae <strcmp+0x1c>
+  8014aa:	3a 02                	cmp    (%edx),%al
+  8014ac:	74 ef                	je     80149d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014ae:	0f b6 c0             	movzbl %al,%eax
+  8014b1:	0f b6 12             	movzbl (%edx),%edx
+  8014b4:	29 d0                	sub    %edx,%eax
+}
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+
+008014b8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	53                   	push   %ebx
+  8014bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8014c5:	eb 09                	jmp    8014d0 <strncmp+0x18>
+		n--, p++, q++;
+  8014c7:	83 ea 01             	sub    $0x1,%edx
+  8014ca:	83 c0 01             	add    $0x1,%eax
+  8014cd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8014d0:	85 d2                	test   %edx,%edx
+  8014d2:	74 18                	je     8014ec <strncmp+0x34>
+  8014d4:	0f b6 18             	movzbl (%eax),%ebx
+  8014d7:	84 db                	test   %bl,%bl
+  8014d9:	74 04                	je     8014df <strncmp+0x27>
+  8014db:	3a 19                	cmp    (%ecx),%bl
+  8014dd:	74 e8                	je     8014c7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014df:	0f b6 00             	movzbl (%eax),%eax
+  8014e2:	0f b6 11             	movzbl (%ecx),%edx
+  8014e5:	29 d0                	sub    %edx,%eax
+}
+  8014e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ea:	c9                   	leave
+  8014eb:	c3                   	ret
+		return 0;
+  8014ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f1:	eb f4                	jmp    8014e7 <strncmp+0x2f>
+
+008014f3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8014fd:	eb 03                	jmp    801502 <strchr+0xf>
+  8014ff:	83 c0 01             	add    $0x1,%eax
+  801502:	0f b6 10             	movzbl (%eax),%edx
+  801505:	84 d2                	test   %dl,%dl
+  801507:	74 06                	je     80150f <strchr+0x1c>
+		if (*s == c)
+  801509:	38 ca                	cmp    %cl,%dl
+  80150b:	75 f2                	jne    8014ff <strchr+0xc>
+  80150d:	eb 05                	jmp    801514 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80150f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801514:	5d                   	pop    %ebp
+  801515:	c3                   	ret
+
+00801516 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	8b 45 08             	mov    0x8(%ebp),%eax
+  80151c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801520:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801523:	38 ca                	cmp    %cl,%dl
+  801525:	74 09                	je     801530 <strfind+0x1a>
+  801527:	84 d2                	test   %dl,%dl
+  801529:	74 05                	je     801530 <strfind+0x1a>
+	for (; *s; s++)
+  80152b:	83 c0 01             	add    $0x1,%eax
+  80152e:	eb f0                	jmp    801520 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801530:	5d                   	pop    %ebp
+  801531:	c3                   	ret
+
+00801532 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801532:	55                   	push   %ebp
+  801533:	89 e5                	mov    %esp,%ebp
+  801535:	57                   	push   %edi
+  801536:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801539:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80153c:	85 c9                	test   %ecx,%ecx
+  80153e:	74 20                	je     801560 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801540:	89 f8                	mov    %edi,%eax
+  801542:	09 c8                	or     %ecx,%eax
+  801544:	a8 03                	test   $0x3,%al
+  801546:	75 12                	jne    80155a <memset+0x28>
+		c &= 0xFF;
+  801548:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80154c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801552:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801555:	fc                   	cld
+  801556:	f3 ab                	rep stos %eax,%es:(%edi)
+  801558:	eb 06                	jmp    801560 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80155a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80155d:	fc                   	cld
+  80155e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801560:	89 f8                	mov    %edi,%eax
+  801562:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+
+00801567 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	57                   	push   %edi
+  80156b:	56                   	push   %esi
+  80156c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801572:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801575:	39 c6                	cmp    %eax,%esi
+  801577:	73 32                	jae    8015ab <memmove+0x44>
+  801579:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80157c:	39 d0                	cmp    %edx,%eax
+  80157e:	73 2b                	jae    8015ab <memmove+0x44>
+		s += n;
+		d += n;
+  801580:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801583:	89 d6                	mov    %edx,%esi
+  801585:	09 fe                	or     %edi,%esi
+  801587:	09 ce                	or     %ecx,%esi
+  801589:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80158f:	75 0e                	jne    80159f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801591:	83 ef 04             	sub    $0x4,%edi
+  801594:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801597:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80159a:	fd                   	std
+  80159b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80159d:	eb 09                	jmp    8015a8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80159f:	83 ef 01             	sub    $0x1,%edi
+  8015a2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8015a5:	fd                   	std
+  8015a6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8015a8:	fc                   	cld
+  8015a9:	eb 1a                	jmp    8015c5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8015ab:	89 f2                	mov    %esi,%edx
+  8015ad:	09 c2                	or     %eax,%edx
+  8015af:	09 ca                	or     %ecx,%edx
+  8015b1:	f6 c2 03             	test   $0x3,%dl
+  8015b4:	75 0a                	jne    8015c0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8015b6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8015b9:	89 c7                	mov    %eax,%edi
+  8015bb:	fc                   	cld
+  8015bc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8015be:	eb 05                	jmp    8015c5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8015c0:	89 c7                	mov    %eax,%edi
+  8015c2:	fc                   	cld
+  8015c3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+
+008015c9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8015cf:	ff 75 10             	push   0x10(%ebp)
+  8015d2:	ff 75 0c             	push   0xc(%ebp)
+  8015d5:	ff 75 08             	push   0x8(%ebp)
+  8015d8:	e8 8a ff ff ff       	call   801567 <memmove>
+}
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+
+008015df <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	56                   	push   %esi
+  8015e3:	53                   	push   %ebx
+  8015e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8015ea:	89 c6                	mov    %eax,%esi
+  8015ec:	03 75 10             	add    0x10(%ebp),%esi
+  8015ef:	eb 06                	jmp    8015f7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8015f1:	83 c0 01             	add    $0x1,%eax
+  8015f4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8015f7:	39 f0                	cmp    %esi,%eax
+  8015f9:	74 14                	je     80160f <memcmp+0x30>
+		if (*s1 != *s2)
+  8015fb:	0f b6 08             	movzbl (%eax),%ecx
+  8015fe:	0f b6 1a             	movzbl (%edx),%ebx
+  801601:	38 d9                	cmp    %bl,%cl
+  801603:	74 ec                	je     8015f1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801605:	0f b6 c1             	movzbl %cl,%eax
+  801608:	0f b6 db             	movzbl %bl,%ebx
+  80160b:	29 d8                	sub    %ebx,%eax
+  80160d:	eb 05                	jmp    801614 <memcmp+0x35>
+	}
+
+	return 0;
+  80160f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+
+00801618 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80161e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801621:	89 c2                	mov    %eax,%edx
+  801623:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801626:	eb 03                	jmp    80162b <memfind+0x13>
+  801628:	83 c0 01             	add    $0x1,%eax
+  80162b:	39 d0                	cmp    %edx,%eax
+  80162d:	73 04                	jae    801633 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80162f:	38 08                	cmp    %cl,(%eax)
+  801631:	75 f5                	jne    801628 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+
+00801635 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	57                   	push   %edi
+  801639:	56                   	push   %esi
+  80163a:	53                   	push   %ebx
+  80163b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801641:	eb 03                	jmp    801646 <strtol+0x11>
+		s++;
+  801643:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801646:	0f b6 02             	movzbl (%edx),%eax
+  801649:	3c 20                	cmp    $0x20,%al
+  80164b:	74 f6                	je     801643 <strtol+0xe>
+  80164d:	3c 09                	cmp    $0x9,%al
+  80164f:	74 f2                	je     801643 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801651:	3c 2b                	cmp    $0x2b,%al
+  801653:	74 2a                	je     80167f <strtol+0x4a>
+	int neg = 0;
+  801655:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80165a:	3c 2d                	cmp    $0x2d,%al
+  80165c:	74 2b                	je     801689 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80165e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801664:	75 0f                	jne    801675 <strtol+0x40>
+  801666:	80 3a 30             	cmpb   $0x30,(%edx)
+  801669:	74 28                	je     801693 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80166b:	85 db                	test   %ebx,%ebx
+  80166d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801672:	0f 44 d8             	cmove  %eax,%ebx
+  801675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80167d:	eb 46                	jmp    8016c5 <strtol+0x90>
+		s++;
+  80167f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801682:	bf 00 00 00 00       	mov    $0x0,%edi
+  801687:	eb d5                	jmp    80165e <strtol+0x29>
+		s++, neg = 1;
+  801689:	83 c2 01             	add    $0x1,%edx
+  80168c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801691:	eb cb                	jmp    80165e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801693:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801697:	74 0e                	je     8016a7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801699:	85 db                	test   %ebx,%ebx
+  80169b:	75 d8                	jne    801675 <strtol+0x40>
+		s++, base = 8;
+  80169d:	83 c2 01             	add    $0x1,%edx
+  8016a0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8016a5:	eb ce                	jmp    801675 <strtol+0x40>
+		s += 2, base = 16;
+  8016a7:	83 c2 02             	add    $0x2,%edx
+  8016aa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8016af:	eb c4                	jmp    801675 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8016b1:	0f be c0             	movsbl %al,%eax
+  8016b4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8016b7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016ba:	7d 3a                	jge    8016f6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8016bc:	83 c2 01             	add    $0x1,%edx
+  8016bf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016c3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8016c5:	0f b6 02             	movzbl (%edx),%eax
+  8016c8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016cb:	89 f3                	mov    %esi,%ebx
+  8016cd:	80 fb 09             	cmp    $0x9,%bl
+  8016d0:	76 df                	jbe    8016b1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8016d2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016d5:	89 f3                	mov    %esi,%ebx
+  8016d7:	80 fb 19             	cmp    $0x19,%bl
+  8016da:	77 08                	ja     8016e4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8016dc:	0f be c0             	movsbl %al,%eax
+  8016df:	83 e8 57             	sub    $0x57,%eax
+  8016e2:	eb d3                	jmp    8016b7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8016e4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016e7:	89 f3                	mov    %esi,%ebx
+  8016e9:	80 fb 19             	cmp    $0x19,%bl
+  8016ec:	77 08                	ja     8016f6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8016ee:	0f be c0             	movsbl %al,%eax
+  8016f1:	83 e8 37             	sub    $0x37,%eax
+  8016f4:	eb c1                	jmp    8016b7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8016f6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016fa:	74 05                	je     801701 <strtol+0xcc>
+		*endptr = (char *) s;
+  8016fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016ff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801701:	89 c8                	mov    %ecx,%eax
+  801703:	f7 d8                	neg    %eax
+  801705:	85 ff                	test   %edi,%edi
+  801707:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80170a:	89 c8                	mov    %ecx,%eax
+  80170c:	5b                   	pop    %ebx
+  80170d:	5e                   	pop    %esi
+  80170e:	5f                   	pop    %edi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+
+00801711 <atoi>:
+
+int
+atoi(const char* s)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  801717:	6a 00                	push   $0x0
+  801719:	6a 00                	push   $0x0
+  80171b:	ff 75 08             	push   0x8(%ebp)
+  80171e:	e8 12 ff ff ff       	call   801635 <strtol>
+}
+  801723:	c9                   	leave
+  801724:	c3                   	ret
+
+00801725 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	57                   	push   %edi
+  801729:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801732:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801735:	89 c3                	mov    %eax,%ebx
+  801737:	89 c7                	mov    %eax,%edi
+  801739:	6a 00                	push   $0x0
+  80173b:	55                   	push   %ebp
+  80173c:	56                   	push   %esi
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	8d 35 47 17 80 00    	lea    0x801747,%esi
+  801745:	0f 34                	sysenter
+
+00801747 <after_sysenter_label_47>:
+  801747:	5e                   	pop    %esi
+  801748:	5d                   	pop    %ebp
+  801749:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80174c:	5b                   	pop    %ebx
+  80174d:	5f                   	pop    %edi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+
+00801750 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	57                   	push   %edi
+  801754:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80175f:	89 d1                	mov    %edx,%ecx
+  801761:	89 d3                	mov    %edx,%ebx
+  801763:	89 d7                	mov    %edx,%edi
+  801765:	6a 00                	push   $0x0
+  801767:	55                   	push   %ebp
+  801768:	56                   	push   %esi
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	8d 35 73 17 80 00    	lea    0x801773,%esi
+  801771:	0f 34                	sysenter
+
+00801773 <after_sysenter_label_128>:
+  801773:	5e                   	pop    %esi
+  801774:	5d                   	pop    %ebp
+  801775:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801778:	5b                   	pop    %ebx
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+
+0080177c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	57                   	push   %edi
+  801780:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801781:	8b 55 08             	mov    0x8(%ebp),%edx
+  801784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801789:	b8 03 00 00 00       	mov    $0x3,%eax
+  80178e:	89 cb                	mov    %ecx,%ebx
+  801790:	89 cf                	mov    %ecx,%edi
+  801792:	6a 00                	push   $0x0
+  801794:	55                   	push   %ebp
+  801795:	56                   	push   %esi
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	8d 35 a0 17 80 00    	lea    0x8017a0,%esi
+  80179e:	0f 34                	sysenter
+
+008017a0 <after_sysenter_label_212>:
+  8017a0:	5e                   	pop    %esi
+  8017a1:	5d                   	pop    %ebp
+  8017a2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	7f 07                	jg     8017b0 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8017a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ac:	5b                   	pop    %ebx
+  8017ad:	5f                   	pop    %edi
+  8017ae:	5d                   	pop    %ebp
+  8017af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017b0:	83 ec 0c             	sub    $0xc,%esp
+  8017b3:	50                   	push   %eax
+  8017b4:	6a 03                	push   $0x3
+  8017b6:	68 45 60 80 00       	push   $0x806045
+  8017bb:	6a 54                	push   $0x54
+  8017bd:	68 62 60 80 00       	push   $0x806062
+  8017c2:	e8 6b f4 ff ff       	call   800c32 <_panic>
+
+008017c7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	57                   	push   %edi
+  8017cb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d6:	89 d1                	mov    %edx,%ecx
+  8017d8:	89 d3                	mov    %edx,%ebx
+  8017da:	89 d7                	mov    %edx,%edi
+  8017dc:	6a 00                	push   $0x0
+  8017de:	55                   	push   %ebp
+  8017df:	56                   	push   %esi
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	8d 35 ea 17 80 00    	lea    0x8017ea,%esi
+  8017e8:	0f 34                	sysenter
+
+008017ea <after_sysenter_label_309>:
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8017ef:	5b                   	pop    %ebx
+  8017f0:	5f                   	pop    %edi
+  8017f1:	5d                   	pop    %ebp
+  8017f2:	c3                   	ret
+
+008017f3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	57                   	push   %edi
+  8017f7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8017f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801802:	89 d1                	mov    %edx,%ecx
+  801804:	89 d3                	mov    %edx,%ebx
+  801806:	89 d7                	mov    %edx,%edi
+  801808:	6a 00                	push   $0x0
+  80180a:	55                   	push   %ebp
+  80180b:	56                   	push   %esi
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	8d 35 16 18 80 00    	lea    0x801816,%esi
+  801814:	0f 34                	sysenter
+
+00801816 <after_sysenter_label_391>:
+  801816:	5e                   	pop    %esi
+  801817:	5d                   	pop    %ebp
+  801818:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80181b:	5b                   	pop    %ebx
+  80181c:	5f                   	pop    %edi
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+
+0080181f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	57                   	push   %edi
+  801823:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801824:	8b 55 08             	mov    0x8(%ebp),%edx
+  801827:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80182f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801834:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801837:	6a 00                	push   $0x0
+  801839:	55                   	push   %ebp
+  80183a:	56                   	push   %esi
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	8d 35 45 18 80 00    	lea    0x801845,%esi
+  801843:	0f 34                	sysenter
+
+00801845 <after_sysenter_label_479>:
+  801845:	5e                   	pop    %esi
+  801846:	5d                   	pop    %ebp
+  801847:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	7f 07                	jg     801855 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80184e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801851:	5b                   	pop    %ebx
+  801852:	5f                   	pop    %edi
+  801853:	5d                   	pop    %ebp
+  801854:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	50                   	push   %eax
+  801859:	6a 04                	push   $0x4
+  80185b:	68 45 60 80 00       	push   $0x806045
+  801860:	6a 54                	push   $0x54
+  801862:	68 62 60 80 00       	push   $0x806062
+  801867:	e8 c6 f3 ff ff       	call   800c32 <_panic>
+
+0080186c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80186c:	55                   	push   %ebp
+  80186d:	89 e5                	mov    %esp,%ebp
+  80186f:	57                   	push   %edi
+  801870:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801871:	8b 55 08             	mov    0x8(%ebp),%edx
+  801874:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801877:	b8 05 00 00 00       	mov    $0x5,%eax
+  80187c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80187f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801882:	ff 75 18             	push   0x18(%ebp)
+  801885:	55                   	push   %ebp
+  801886:	56                   	push   %esi
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	8d 35 91 18 80 00    	lea    0x801891,%esi
+  80188f:	0f 34                	sysenter
+
+00801891 <after_sysenter_label_593>:
+  801891:	5e                   	pop    %esi
+  801892:	5d                   	pop    %ebp
+  801893:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801896:	85 c0                	test   %eax,%eax
+  801898:	7f 07                	jg     8018a1 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80189a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189d:	5b                   	pop    %ebx
+  80189e:	5f                   	pop    %edi
+  80189f:	5d                   	pop    %ebp
+  8018a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018a1:	83 ec 0c             	sub    $0xc,%esp
+  8018a4:	50                   	push   %eax
+  8018a5:	6a 05                	push   $0x5
+  8018a7:	68 45 60 80 00       	push   $0x806045
+  8018ac:	6a 54                	push   $0x54
+  8018ae:	68 62 60 80 00       	push   $0x806062
+  8018b3:	e8 7a f3 ff ff       	call   800c32 <_panic>
+
+008018b8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8018b8:	55                   	push   %ebp
+  8018b9:	89 e5                	mov    %esp,%ebp
+  8018bb:	57                   	push   %edi
+  8018bc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8018bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018cd:	89 df                	mov    %ebx,%edi
+  8018cf:	6a 00                	push   $0x0
+  8018d1:	55                   	push   %ebp
+  8018d2:	56                   	push   %esi
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	8d 35 dd 18 80 00    	lea    0x8018dd,%esi
+  8018db:	0f 34                	sysenter
+
+008018dd <after_sysenter_label_704>:
+  8018dd:	5e                   	pop    %esi
+  8018de:	5d                   	pop    %ebp
+  8018df:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	7f 07                	jg     8018ed <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8018e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e9:	5b                   	pop    %ebx
+  8018ea:	5f                   	pop    %edi
+  8018eb:	5d                   	pop    %ebp
+  8018ec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ed:	83 ec 0c             	sub    $0xc,%esp
+  8018f0:	50                   	push   %eax
+  8018f1:	6a 06                	push   $0x6
+  8018f3:	68 45 60 80 00       	push   $0x806045
+  8018f8:	6a 54                	push   $0x54
+  8018fa:	68 62 60 80 00       	push   $0x806062
+  8018ff:	e8 2e f3 ff ff       	call   800c32 <_panic>
+
+00801904 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	57                   	push   %edi
+  801908:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801909:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801911:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801914:	b8 08 00 00 00       	mov    $0x8,%eax
+  801919:	89 df                	mov    %ebx,%edi
+  80191b:	6a 00                	push   $0x0
+  80191d:	55                   	push   %ebp
+  80191e:	56                   	push   %esi
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	8d 35 29 19 80 00    	lea    0x801929,%esi
+  801927:	0f 34                	sysenter
+
+00801929 <after_sysenter_label_808>:
+  801929:	5e                   	pop    %esi
+  80192a:	5d                   	pop    %ebp
+  80192b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80192e:	85 c0                	test   %eax,%eax
+  801930:	7f 07                	jg     801939 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801932:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801935:	5b                   	pop    %ebx
+  801936:	5f                   	pop    %edi
+  801937:	5d                   	pop    %ebp
+  801938:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801939:	83 ec 0c             	sub    $0xc,%esp
+  80193c:	50                   	push   %eax
+  80193d:	6a 08                	push   $0x8
+  80193f:	68 45 60 80 00       	push   $0x806045
+  801944:	6a 54                	push   $0x54
+  801946:	68 62 60 80 00       	push   $0x806062
+  80194b:	e8 e2 f2 ff ff       	call   800c32 <_panic>
+
+00801950 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	57                   	push   %edi
+  801954:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801955:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80195a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801960:	b8 09 00 00 00       	mov    $0x9,%eax
+  801965:	89 df                	mov    %ebx,%edi
+  801967:	6a 00                	push   $0x0
+  801969:	55                   	push   %ebp
+  80196a:	56                   	push   %esi
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	8d 35 75 19 80 00    	lea    0x801975,%esi
+  801973:	0f 34                	sysenter
+
+00801975 <after_sysenter_label_912>:
+  801975:	5e                   	pop    %esi
+  801976:	5d                   	pop    %ebp
+  801977:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	7f 07                	jg     801985 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80197e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5f                   	pop    %edi
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801985:	83 ec 0c             	sub    $0xc,%esp
+  801988:	50                   	push   %eax
+  801989:	6a 09                	push   $0x9
+  80198b:	68 45 60 80 00       	push   $0x806045
+  801990:	6a 54                	push   $0x54
+  801992:	68 62 60 80 00       	push   $0x806062
+  801997:	e8 96 f2 ff ff       	call   800c32 <_panic>
+
+0080199c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80199c:	55                   	push   %ebp
+  80199d:	89 e5                	mov    %esp,%ebp
+  80199f:	57                   	push   %edi
+  8019a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8019a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019b1:	89 df                	mov    %ebx,%edi
+  8019b3:	6a 00                	push   $0x0
+  8019b5:	55                   	push   %ebp
+  8019b6:	56                   	push   %esi
+  8019b7:	89 e5                	mov    %esp,%ebp
+  8019b9:	8d 35 c1 19 80 00    	lea    0x8019c1,%esi
+  8019bf:	0f 34                	sysenter
+
+008019c1 <after_sysenter_label_1016>:
+  8019c1:	5e                   	pop    %esi
+  8019c2:	5d                   	pop    %ebp
+  8019c3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	7f 07                	jg     8019d1 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8019ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cd:	5b                   	pop    %ebx
+  8019ce:	5f                   	pop    %edi
+  8019cf:	5d                   	pop    %ebp
+  8019d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019d1:	83 ec 0c             	sub    $0xc,%esp
+  8019d4:	50                   	push   %eax
+  8019d5:	6a 0a                	push   $0xa
+  8019d7:	68 45 60 80 00       	push   $0x806045
+  8019dc:	6a 54                	push   $0x54
+  8019de:	68 62 60 80 00       	push   $0x806062
+  8019e3:	e8 4a f2 ff ff       	call   800c32 <_panic>
+
+008019e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8019e8:	55                   	push   %ebp
+  8019e9:	89 e5                	mov    %esp,%ebp
+  8019eb:	57                   	push   %edi
+  8019ec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8019ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019fe:	6a 00                	push   $0x0
+  801a00:	55                   	push   %ebp
+  801a01:	56                   	push   %esi
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	8d 35 0c 1a 80 00    	lea    0x801a0c,%esi
+  801a0a:	0f 34                	sysenter
+
+00801a0c <after_sysenter_label_1126>:
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801a11:	5b                   	pop    %ebx
+  801a12:	5f                   	pop    %edi
+  801a13:	5d                   	pop    %ebp
+  801a14:	c3                   	ret
+
+00801a15 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801a15:	55                   	push   %ebp
+  801a16:	89 e5                	mov    %esp,%ebp
+  801a18:	57                   	push   %edi
+  801a19:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801a1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a22:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a27:	89 cb                	mov    %ecx,%ebx
+  801a29:	89 cf                	mov    %ecx,%edi
+  801a2b:	6a 00                	push   $0x0
+  801a2d:	55                   	push   %ebp
+  801a2e:	56                   	push   %esi
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	8d 35 39 1a 80 00    	lea    0x801a39,%esi
+  801a37:	0f 34                	sysenter
+
+00801a39 <after_sysenter_label_1210>:
+  801a39:	5e                   	pop    %esi
+  801a3a:	5d                   	pop    %ebp
+  801a3b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	7f 07                	jg     801a49 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801a42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a45:	5b                   	pop    %ebx
+  801a46:	5f                   	pop    %edi
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a49:	83 ec 0c             	sub    $0xc,%esp
+  801a4c:	50                   	push   %eax
+  801a4d:	6a 0d                	push   $0xd
+  801a4f:	68 45 60 80 00       	push   $0x806045
+  801a54:	6a 54                	push   $0x54
+  801a56:	68 62 60 80 00       	push   $0x806062
+  801a5b:	e8 d2 f1 ff ff       	call   800c32 <_panic>
+
+00801a60 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	57                   	push   %edi
+  801a64:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801a65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a70:	b8 42 00 00 00       	mov    $0x42,%eax
+  801a75:	89 df                	mov    %ebx,%edi
+  801a77:	6a 00                	push   $0x0
+  801a79:	55                   	push   %ebp
+  801a7a:	56                   	push   %esi
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	8d 35 85 1a 80 00    	lea    0x801a85,%esi
+  801a83:	0f 34                	sysenter
+
+00801a85 <after_sysenter_label_1311>:
+  801a85:	5e                   	pop    %esi
+  801a86:	5d                   	pop    %ebp
+  801a87:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	7f 07                	jg     801a95 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801a8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a91:	5b                   	pop    %ebx
+  801a92:	5f                   	pop    %edi
+  801a93:	5d                   	pop    %ebp
+  801a94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a95:	83 ec 0c             	sub    $0xc,%esp
+  801a98:	50                   	push   %eax
+  801a99:	6a 42                	push   $0x42
+  801a9b:	68 45 60 80 00       	push   $0x806045
+  801aa0:	6a 54                	push   $0x54
+  801aa2:	68 62 60 80 00       	push   $0x806062
+  801aa7:	e8 86 f1 ff ff       	call   800c32 <_panic>
+
+00801aac <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	57                   	push   %edi
+  801ab0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801abb:	89 d1                	mov    %edx,%ecx
+  801abd:	89 d3                	mov    %edx,%ebx
+  801abf:	89 d7                	mov    %edx,%edi
+  801ac1:	6a 00                	push   $0x0
+  801ac3:	55                   	push   %ebp
+  801ac4:	56                   	push   %esi
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	8d 35 cf 1a 80 00    	lea    0x801acf,%esi
+  801acd:	0f 34                	sysenter
+
+00801acf <after_sysenter_label_1411>:
+  801acf:	5e                   	pop    %esi
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5f                   	pop    %edi
+  801ad6:	5d                   	pop    %ebp
+  801ad7:	c3                   	ret
+
+00801ad8 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	57                   	push   %edi
+  801adc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801add:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801aed:	89 df                	mov    %ebx,%edi
+  801aef:	6a 00                	push   $0x0
+  801af1:	55                   	push   %ebp
+  801af2:	56                   	push   %esi
+  801af3:	89 e5                	mov    %esp,%ebp
+  801af5:	8d 35 fd 1a 80 00    	lea    0x801afd,%esi
+  801afb:	0f 34                	sysenter
+
+00801afd <after_sysenter_label_1497>:
+  801afd:	5e                   	pop    %esi
+  801afe:	5d                   	pop    %ebp
+  801aff:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801b02:	5b                   	pop    %ebx
+  801b03:	5f                   	pop    %edi
+  801b04:	5d                   	pop    %ebp
+  801b05:	c3                   	ret
+
+00801b06 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	57                   	push   %edi
+  801b0a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801b0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b10:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b16:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b1b:	89 df                	mov    %ebx,%edi
+  801b1d:	6a 00                	push   $0x0
+  801b1f:	55                   	push   %ebp
+  801b20:	56                   	push   %esi
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	8d 35 2b 1b 80 00    	lea    0x801b2b,%esi
+  801b29:	0f 34                	sysenter
+
+00801b2b <after_sysenter_label_1583>:
+  801b2b:	5e                   	pop    %esi
+  801b2c:	5d                   	pop    %ebp
+  801b2d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801b30:	5b                   	pop    %ebx
+  801b31:	5f                   	pop    %edi
+  801b32:	5d                   	pop    %ebp
+  801b33:	c3                   	ret
+
+00801b34 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	57                   	push   %edi
+  801b38:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801b39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b3f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801b44:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	55                   	push   %ebp
+  801b4f:	56                   	push   %esi
+  801b50:	89 e5                	mov    %esp,%ebp
+  801b52:	8d 35 5a 1b 80 00    	lea    0x801b5a,%esi
+  801b58:	0f 34                	sysenter
+
+00801b5a <after_sysenter_label_1672>:
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5d                   	pop    %ebp
+  801b5c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801b5f:	5b                   	pop    %ebx
+  801b60:	5f                   	pop    %edi
+  801b61:	5d                   	pop    %ebp
+  801b62:	c3                   	ret
+
+00801b63 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801b63:	55                   	push   %ebp
+  801b64:	89 e5                	mov    %esp,%ebp
+  801b66:	57                   	push   %edi
+  801b67:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801b68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b73:	b8 12 00 00 00       	mov    $0x12,%eax
+  801b78:	89 df                	mov    %ebx,%edi
+  801b7a:	6a 00                	push   $0x0
+  801b7c:	55                   	push   %ebp
+  801b7d:	56                   	push   %esi
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	8d 35 88 1b 80 00    	lea    0x801b88,%esi
+  801b86:	0f 34                	sysenter
+
+00801b88 <after_sysenter_label_1758>:
+  801b88:	5e                   	pop    %esi
+  801b89:	5d                   	pop    %ebp
+  801b8a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801b8d:	5b                   	pop    %ebx
+  801b8e:	5f                   	pop    %edi
+  801b8f:	5d                   	pop    %ebp
+  801b90:	c3                   	ret
+
+00801b91 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	57                   	push   %edi
+  801b95:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801b96:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b9e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801ba3:	89 cb                	mov    %ecx,%ebx
+  801ba5:	89 cf                	mov    %ecx,%edi
+  801ba7:	6a 00                	push   $0x0
+  801ba9:	55                   	push   %ebp
+  801baa:	56                   	push   %esi
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	8d 35 b5 1b 80 00    	lea    0x801bb5,%esi
+  801bb3:	0f 34                	sysenter
+
+00801bb5 <after_sysenter_label_1842>:
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801bba:	85 c0                	test   %eax,%eax
+  801bbc:	7f 07                	jg     801bc5 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801bbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc1:	5b                   	pop    %ebx
+  801bc2:	5f                   	pop    %edi
+  801bc3:	5d                   	pop    %ebp
+  801bc4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bc5:	83 ec 0c             	sub    $0xc,%esp
+  801bc8:	50                   	push   %eax
+  801bc9:	6a 13                	push   $0x13
+  801bcb:	68 45 60 80 00       	push   $0x806045
+  801bd0:	6a 54                	push   $0x54
+  801bd2:	68 62 60 80 00       	push   $0x806062
+  801bd7:	e8 56 f0 ff ff       	call   800c32 <_panic>
+
+00801bdc <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801bdc:	55                   	push   %ebp
+  801bdd:	89 e5                	mov    %esp,%ebp
+  801bdf:	57                   	push   %edi
+  801be0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801be1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be6:	b8 14 00 00 00       	mov    $0x14,%eax
+  801beb:	89 d1                	mov    %edx,%ecx
+  801bed:	89 d3                	mov    %edx,%ebx
+  801bef:	89 d7                	mov    %edx,%edi
+  801bf1:	6a 00                	push   $0x0
+  801bf3:	55                   	push   %ebp
+  801bf4:	56                   	push   %esi
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	8d 35 ff 1b 80 00    	lea    0x801bff,%esi
+  801bfd:	0f 34                	sysenter
+
+00801bff <after_sysenter_label_1939>:
+  801bff:	5e                   	pop    %esi
+  801c00:	5d                   	pop    %ebp
+  801c01:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801c04:	5b                   	pop    %ebx
+  801c05:	5f                   	pop    %edi
+  801c06:	5d                   	pop    %ebp
+  801c07:	c3                   	ret
+
+00801c08 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801c08:	55                   	push   %ebp
+  801c09:	89 e5                	mov    %esp,%ebp
+  801c0b:	57                   	push   %edi
+  801c0c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c13:	b8 15 00 00 00       	mov    $0x15,%eax
+  801c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c20:	6a 00                	push   $0x0
+  801c22:	55                   	push   %ebp
+  801c23:	56                   	push   %esi
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	8d 35 2e 1c 80 00    	lea    0x801c2e,%esi
+  801c2c:	0f 34                	sysenter
+
+00801c2e <after_sysenter_label_2028>:
+  801c2e:	5e                   	pop    %esi
+  801c2f:	5d                   	pop    %ebp
+  801c30:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801c33:	5b                   	pop    %ebx
+  801c34:	5f                   	pop    %edi
+  801c35:	5d                   	pop    %ebp
+  801c36:	c3                   	ret
+
+00801c37 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	57                   	push   %edi
+  801c3b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801c3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c47:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c4c:	89 df                	mov    %ebx,%edi
+  801c4e:	6a 00                	push   $0x0
+  801c50:	55                   	push   %ebp
+  801c51:	56                   	push   %esi
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	8d 35 5c 1c 80 00    	lea    0x801c5c,%esi
+  801c5a:	0f 34                	sysenter
+
+00801c5c <after_sysenter_label_2114>:
+  801c5c:	5e                   	pop    %esi
+  801c5d:	5d                   	pop    %ebp
+  801c5e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801c61:	5b                   	pop    %ebx
+  801c62:	5f                   	pop    %edi
+  801c63:	5d                   	pop    %ebp
+  801c64:	c3                   	ret
+
+00801c65 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	57                   	push   %edi
+  801c69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801c6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c75:	b8 17 00 00 00       	mov    $0x17,%eax
+  801c7a:	89 df                	mov    %ebx,%edi
+  801c7c:	6a 00                	push   $0x0
+  801c7e:	55                   	push   %ebp
+  801c7f:	56                   	push   %esi
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	8d 35 8a 1c 80 00    	lea    0x801c8a,%esi
+  801c88:	0f 34                	sysenter
+
+00801c8a <after_sysenter_label_2200>:
+  801c8a:	5e                   	pop    %esi
+  801c8b:	5d                   	pop    %ebp
+  801c8c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801c8f:	5b                   	pop    %ebx
+  801c90:	5f                   	pop    %edi
+  801c91:	5d                   	pop    %ebp
+  801c92:	c3                   	ret
+
+00801c93 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801c93:	55                   	push   %ebp
+  801c94:	89 e5                	mov    %esp,%ebp
+  801c96:	57                   	push   %edi
+  801c97:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca3:	b8 18 00 00 00       	mov    $0x18,%eax
+  801ca8:	89 df                	mov    %ebx,%edi
+  801caa:	6a 00                	push   $0x0
+  801cac:	55                   	push   %ebp
+  801cad:	56                   	push   %esi
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	8d 35 b8 1c 80 00    	lea    0x801cb8,%esi
+  801cb6:	0f 34                	sysenter
+
+00801cb8 <after_sysenter_label_2286>:
+  801cb8:	5e                   	pop    %esi
+  801cb9:	5d                   	pop    %ebp
+  801cba:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801cbd:	5b                   	pop    %ebx
+  801cbe:	5f                   	pop    %edi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+
+00801cc1 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	57                   	push   %edi
+  801cc5:	56                   	push   %esi
+  801cc6:	53                   	push   %ebx
+  801cc7:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801cca:	89 d6                	mov    %edx,%esi
+  801ccc:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801ccf:	89 cf                	mov    %ecx,%edi
+  801cd1:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801cd4:	89 fa                	mov    %edi,%edx
+  801cd6:	80 ce 08             	or     $0x8,%dh
+  801cd9:	f6 c5 08             	test   $0x8,%ch
+  801cdc:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801cdf:	57                   	push   %edi
+  801ce0:	56                   	push   %esi
+  801ce1:	50                   	push   %eax
+  801ce2:	56                   	push   %esi
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	e8 82 fb ff ff       	call   80186c <sys_page_map>
+	if (r < 0) {
+  801cea:	83 c4 20             	add    $0x20,%esp
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	78 27                	js     801d18 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801cf1:	83 ec 0c             	sub    $0xc,%esp
+  801cf4:	57                   	push   %edi
+  801cf5:	56                   	push   %esi
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	56                   	push   %esi
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	e8 6c fb ff ff       	call   80186c <sys_page_map>
+  801d00:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801d02:	83 c4 20             	add    $0x20,%esp
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 24                	js     801d2d <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801d0e:	89 d8                	mov    %ebx,%eax
+  801d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d13:	5b                   	pop    %ebx
+  801d14:	5e                   	pop    %esi
+  801d15:	5f                   	pop    %edi
+  801d16:	5d                   	pop    %ebp
+  801d17:	c3                   	ret
+  801d18:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	50                   	push   %eax
+  801d1e:	68 70 60 80 00       	push   $0x806070
+  801d23:	e8 e5 ef ff ff       	call   800d0d <cprintf>
+		return r;
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	eb e1                	jmp    801d0e <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+  801d30:	50                   	push   %eax
+  801d31:	68 a0 60 80 00       	push   $0x8060a0
+  801d36:	e8 d2 ef ff ff       	call   800d0d <cprintf>
+		return r;
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	eb ce                	jmp    801d0e <duppage_cow+0x4d>
+
+00801d40 <duppage>:
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	53                   	push   %ebx
+  801d44:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801d47:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801d4a:	51                   	push   %ecx
+  801d4b:	52                   	push   %edx
+  801d4c:	50                   	push   %eax
+  801d4d:	52                   	push   %edx
+  801d4e:	6a 00                	push   $0x0
+  801d50:	e8 17 fb ff ff       	call   80186c <sys_page_map>
+	if (r < 0) {
+  801d55:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801d58:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 07                	js     801d68 <duppage+0x28>
+}
+  801d61:	89 d8                	mov    %ebx,%eax
+  801d63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d66:	c9                   	leave
+  801d67:	c3                   	ret
+  801d68:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+  801d6d:	50                   	push   %eax
+  801d6e:	68 70 60 80 00       	push   $0x806070
+  801d73:	e8 95 ef ff ff       	call   800d0d <cprintf>
+		return r;
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	eb e4                	jmp    801d61 <duppage+0x21>
+
+00801d7d <cow_copy>:
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	56                   	push   %esi
+  801d81:	53                   	push   %ebx
+  801d82:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801d84:	83 ec 04             	sub    $0x4,%esp
+  801d87:	6a 07                	push   $0x7
+  801d89:	68 00 f0 7f 00       	push   $0x7ff000
+  801d8e:	6a 00                	push   $0x0
+  801d90:	e8 8a fa ff ff       	call   80181f <sys_page_alloc>
+	if (r < 0) {
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 58                	js     801df4 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801d9c:	83 ec 04             	sub    $0x4,%esp
+  801d9f:	68 00 10 00 00       	push   $0x1000
+  801da4:	56                   	push   %esi
+  801da5:	68 00 f0 7f 00       	push   $0x7ff000
+  801daa:	e8 b8 f7 ff ff       	call   801567 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801daf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801db6:	56                   	push   %esi
+  801db7:	6a 00                	push   $0x0
+  801db9:	68 00 f0 7f 00       	push   $0x7ff000
+  801dbe:	6a 00                	push   $0x0
+  801dc0:	e8 a7 fa ff ff       	call   80186c <sys_page_map>
+  801dc5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801dc7:	83 c4 20             	add    $0x20,%esp
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	78 3b                	js     801e09 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801dce:	83 ec 08             	sub    $0x8,%esp
+  801dd1:	68 00 f0 7f 00       	push   $0x7ff000
+  801dd6:	6a 00                	push   $0x0
+  801dd8:	e8 db fa ff ff       	call   8018b8 <sys_page_unmap>
+  801ddd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 45                	js     801e2b <cow_copy+0xae>
+	return 0;
+  801de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801deb:	89 d8                	mov    %ebx,%eax
+  801ded:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df0:	5b                   	pop    %ebx
+  801df1:	5e                   	pop    %esi
+  801df2:	5d                   	pop    %ebp
+  801df3:	c3                   	ret
+  801df4:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801df6:	83 ec 08             	sub    $0x8,%esp
+  801df9:	50                   	push   %eax
+  801dfa:	68 90 61 80 00       	push   $0x806190
+  801dff:	e8 09 ef ff ff       	call   800d0d <cprintf>
+		return r;
+  801e04:	83 c4 10             	add    $0x10,%esp
+  801e07:	eb e2                	jmp    801deb <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801e09:	83 ec 08             	sub    $0x8,%esp
+  801e0c:	50                   	push   %eax
+  801e0d:	68 ac 61 80 00       	push   $0x8061ac
+  801e12:	e8 f6 ee ff ff       	call   800d0d <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801e17:	83 c4 08             	add    $0x8,%esp
+  801e1a:	68 00 f0 7f 00       	push   $0x7ff000
+  801e1f:	6a 00                	push   $0x0
+  801e21:	e8 92 fa ff ff       	call   8018b8 <sys_page_unmap>
+		return r;
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	eb c0                	jmp    801deb <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801e2b:	83 ec 08             	sub    $0x8,%esp
+  801e2e:	50                   	push   %eax
+  801e2f:	68 c8 60 80 00       	push   $0x8060c8
+  801e34:	e8 d4 ee ff ff       	call   800d0d <cprintf>
+		return r;
+  801e39:	83 c4 10             	add    $0x10,%esp
+  801e3c:	eb ad                	jmp    801deb <cow_copy+0x6e>
+
+00801e3e <pgfault>:
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	56                   	push   %esi
+  801e42:	53                   	push   %ebx
+  801e43:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801e46:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801e48:	89 d8                	mov    %ebx,%eax
+  801e4a:	c1 e8 16             	shr    $0x16,%eax
+  801e4d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801e54:	89 de                	mov    %ebx,%esi
+  801e56:	c1 ee 0c             	shr    $0xc,%esi
+  801e59:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801e60:	a8 07                	test   $0x7,%al
+  801e62:	74 3b                	je     801e9f <pgfault+0x61>
+  801e64:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801e6a:	74 33                	je     801e9f <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801e6c:	83 ec 0c             	sub    $0xc,%esp
+  801e6f:	68 00 f0 bf ee       	push   $0xeebff000
+  801e74:	e8 4d 2f 00 00       	call   804dc6 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801e79:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801e80:	83 c4 10             	add    $0x10,%esp
+  801e83:	f6 c4 08             	test   $0x8,%ah
+  801e86:	75 30                	jne    801eb8 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	68 00 f0 bf ee       	push   $0xeebff000
+  801e90:	e8 9e 2f 00 00       	call   804e33 <mutex_unlock>
+}
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9b:	5b                   	pop    %ebx
+  801e9c:	5e                   	pop    %esi
+  801e9d:	5d                   	pop    %ebp
+  801e9e:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801e9f:	83 ec 08             	sub    $0x8,%esp
+  801ea2:	ff 72 28             	push   0x28(%edx)
+  801ea5:	51                   	push   %ecx
+  801ea6:	50                   	push   %eax
+  801ea7:	68 ec 60 80 00       	push   $0x8060ec
+  801eac:	6a 3f                	push   $0x3f
+  801eae:	68 c6 61 80 00       	push   $0x8061c6
+  801eb3:	e8 7a ed ff ff       	call   800c32 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801eb8:	89 d8                	mov    %ebx,%eax
+  801eba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801ebf:	e8 b9 fe ff ff       	call   801d7d <cow_copy>
+  801ec4:	eb c2                	jmp    801e88 <pgfault+0x4a>
+
+00801ec6 <cow_enable>:
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801ecc:	68 3e 1e 80 00       	push   $0x801e3e
+  801ed1:	e8 fc 36 00 00       	call   8055d2 <set_pgfault_handler>
+}
+  801ed6:	83 c4 10             	add    $0x10,%esp
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+00801edb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	57                   	push   %edi
+  801edf:	56                   	push   %esi
+  801ee0:	53                   	push   %ebx
+  801ee1:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801ee4:	68 3e 1e 80 00       	push   $0x801e3e
+  801ee9:	e8 e4 36 00 00       	call   8055d2 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801eee:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ef3:	cd 30                	int    $0x30
+  801ef5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	78 4b                	js     801f4a <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801eff:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801f04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f09:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801f0c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801f10:	0f 85 16 01 00 00    	jne    80202c <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801f16:	e8 ac f8 ff ff       	call   8017c7 <sys_getenvid>
+  801f1b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f20:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f22:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801f28:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801f2e:	77 32                	ja     801f62 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f30:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801f35:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801f37:	c1 ea 10             	shr    $0x10,%edx
+  801f3a:	74 26                	je     801f62 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f3c:	c1 e2 10             	shl    $0x10,%edx
+  801f3f:	89 d1                	mov    %edx,%ecx
+  801f41:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f46:	29 ca                	sub    %ecx,%edx
+  801f48:	eb 1e                	jmp    801f68 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+  801f4d:	89 c7                	mov    %eax,%edi
+  801f4f:	50                   	push   %eax
+  801f50:	68 d1 61 80 00       	push   $0x8061d1
+  801f55:	e8 b3 ed ff ff       	call   800d0d <cprintf>
+		return eid;
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	e9 6c 01 00 00       	jmp    8020ce <fork+0x1f3>
+		return pthread_main_tls;
+  801f62:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801f68:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801f6b:	c1 e0 04             	shl    $0x4,%eax
+  801f6e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f73:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801f75:	e8 95 35 00 00       	call   80550f <pthread_fork_child>
+		return eid;
+  801f7a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f7d:	e9 4c 01 00 00       	jmp    8020ce <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801f82:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801f88:	89 da                	mov    %ebx,%edx
+  801f8a:	89 f8                	mov    %edi,%eax
+  801f8c:	e8 af fd ff ff       	call   801d40 <duppage>
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	79 28                	jns    801fbd <fork+0xe2>
+  801f95:	89 c7                	mov    %eax,%edi
+  801f97:	e9 32 01 00 00       	jmp    8020ce <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801f9c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801fa2:	83 f9 05             	cmp    $0x5,%ecx
+  801fa5:	75 58                	jne    801fff <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801fa7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801fac:	89 da                	mov    %ebx,%edx
+  801fae:	89 f8                	mov    %edi,%eax
+  801fb0:	e8 8b fd ff ff       	call   801d40 <duppage>
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	0f 88 0f 01 00 00    	js     8020cc <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801fbd:	83 c3 01             	add    $0x1,%ebx
+  801fc0:	39 de                	cmp    %ebx,%esi
+  801fc2:	74 54                	je     802018 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801fc4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801fcb:	f6 c1 05             	test   $0x5,%cl
+  801fce:	74 ed                	je     801fbd <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801fd0:	f6 c5 04             	test   $0x4,%ch
+  801fd3:	75 ad                	jne    801f82 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801fd5:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801fdb:	74 bf                	je     801f9c <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801fdd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801fe3:	74 d8                	je     801fbd <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801fe5:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801feb:	89 da                	mov    %ebx,%edx
+  801fed:	89 f8                	mov    %edi,%eax
+  801fef:	e8 cd fc ff ff       	call   801cc1 <duppage_cow>
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	79 c5                	jns    801fbd <fork+0xe2>
+  801ff8:	89 c7                	mov    %eax,%edi
+  801ffa:	e9 cf 00 00 00       	jmp    8020ce <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801fff:	68 1c 61 80 00       	push   $0x80611c
+  802004:	68 d2 5b 80 00       	push   $0x805bd2
+  802009:	68 c6 00 00 00       	push   $0xc6
+  80200e:	68 c6 61 80 00       	push   $0x8061c6
+  802013:	e8 1a ec ff ff       	call   800c32 <_panic>
+  802018:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80201b:	83 c1 01             	add    $0x1,%ecx
+  80201e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  802024:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80202a:	74 18                	je     802044 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80202c:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  802033:	a8 07                	test   $0x7,%al
+  802035:	74 e4                	je     80201b <fork+0x140>
+  802037:	89 cb                	mov    %ecx,%ebx
+  802039:	c1 e3 0a             	shl    $0xa,%ebx
+  80203c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80203f:	e9 7c ff ff ff       	jmp    801fc0 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  802044:	83 ec 04             	sub    $0x4,%esp
+  802047:	6a 07                	push   $0x7
+  802049:	68 00 f0 bf ee       	push   $0xeebff000
+  80204e:	ff 75 e4             	push   -0x1c(%ebp)
+  802051:	e8 c9 f7 ff ff       	call   80181f <sys_page_alloc>
+  802056:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	78 34                	js     802093 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80205f:	83 ec 08             	sub    $0x8,%esp
+  802062:	68 10 56 80 00       	push   $0x805610
+  802067:	ff 75 e4             	push   -0x1c(%ebp)
+  80206a:	e8 2d f9 ff ff       	call   80199c <sys_env_set_pgfault_upcall>
+  80206f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 2e                	js     8020a6 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  802078:	83 ec 08             	sub    $0x8,%esp
+  80207b:	6a 02                	push   $0x2
+  80207d:	ff 75 e4             	push   -0x1c(%ebp)
+  802080:	e8 7f f8 ff ff       	call   801904 <sys_env_set_status>
+  802085:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	85 c0                	test   %eax,%eax
+  80208c:	78 2b                	js     8020b9 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80208e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802091:	eb 3b                	jmp    8020ce <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  802093:	83 ec 08             	sub    $0x8,%esp
+  802096:	50                   	push   %eax
+  802097:	68 44 61 80 00       	push   $0x806144
+  80209c:	e8 6c ec ff ff       	call   800d0d <cprintf>
+		return r;
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	eb 28                	jmp    8020ce <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8020a6:	83 ec 08             	sub    $0x8,%esp
+  8020a9:	50                   	push   %eax
+  8020aa:	68 6c 61 80 00       	push   $0x80616c
+  8020af:	e8 59 ec ff ff       	call   800d0d <cprintf>
+		return r;
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	eb 15                	jmp    8020ce <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8020b9:	83 ec 08             	sub    $0x8,%esp
+  8020bc:	50                   	push   %eax
+  8020bd:	68 e1 61 80 00       	push   $0x8061e1
+  8020c2:	e8 46 ec ff ff       	call   800d0d <cprintf>
+		return r;
+  8020c7:	83 c4 10             	add    $0x10,%esp
+  8020ca:	eb 02                	jmp    8020ce <fork+0x1f3>
+  8020cc:	89 c7                	mov    %eax,%edi
+}
+  8020ce:	89 f8                	mov    %edi,%eax
+  8020d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d3:	5b                   	pop    %ebx
+  8020d4:	5e                   	pop    %esi
+  8020d5:	5f                   	pop    %edi
+  8020d6:	5d                   	pop    %ebp
+  8020d7:	c3                   	ret
+
+008020d8 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	57                   	push   %edi
+  8020dc:	56                   	push   %esi
+  8020dd:	53                   	push   %ebx
+  8020de:	83 ec 2c             	sub    $0x2c,%esp
+  8020e1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8020e3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8020e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8020ee:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8020f4:	77 0a                	ja     802100 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8020f6:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8020fb:	29 c3                	sub    %eax,%ebx
+  8020fd:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	68 3e 1e 80 00       	push   $0x801e3e
+  802108:	e8 c5 34 00 00       	call   8055d2 <set_pgfault_handler>
+  80210d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802112:	cd 30                	int    $0x30
+  802114:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	85 c0                	test   %eax,%eax
+  80211c:	78 30                	js     80214e <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80211e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802122:	74 42                	je     802166 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  802124:	c1 e3 10             	shl    $0x10,%ebx
+  802127:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80212c:	29 d8                	sub    %ebx,%eax
+  80212e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802131:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  802136:	29 d8                	sub    %ebx,%eax
+  802138:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80213b:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802140:	ba 00 00 00 00       	mov    $0x0,%edx
+  802145:	89 f7                	mov    %esi,%edi
+  802147:	89 d6                	mov    %edx,%esi
+  802149:	e9 2c 01 00 00       	jmp    80227a <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80214e:	83 ec 08             	sub    $0x8,%esp
+  802151:	89 c7                	mov    %eax,%edi
+  802153:	50                   	push   %eax
+  802154:	68 d1 61 80 00       	push   $0x8061d1
+  802159:	e8 af eb ff ff       	call   800d0d <cprintf>
+		return eid;
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	e9 d5 00 00 00       	jmp    80223b <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802166:	e8 5c f6 ff ff       	call   8017c7 <sys_getenvid>
+  80216b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802170:	89 c2                	mov    %eax,%edx
+  802172:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802174:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80217a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80217f:	77 18                	ja     802199 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802181:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802186:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802188:	c1 e8 10             	shr    $0x10,%eax
+  80218b:	74 0c                	je     802199 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80218d:	c1 e0 10             	shl    $0x10,%eax
+  802190:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802195:	29 c1                	sub    %eax,%ecx
+  802197:	eb 06                	jmp    80219f <sfork+0xc7>
+		return pthread_main_tls;
+  802199:	8b 0d 00 8b 80 00    	mov    0x808b00,%ecx
+  80219f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8021a2:	c1 e0 04             	shl    $0x4,%eax
+  8021a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8021aa:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8021ac:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8021af:	e9 87 00 00 00       	jmp    80223b <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8021b4:	f6 c5 04             	test   $0x4,%ch
+  8021b7:	74 6c                	je     802225 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8021b9:	89 ca                	mov    %ecx,%edx
+  8021bb:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8021c1:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8021c7:	74 7c                	je     802245 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8021c9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8021cf:	89 da                	mov    %ebx,%edx
+  8021d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021d4:	e8 67 fb ff ff       	call   801d40 <duppage>
+  8021d9:	85 c0                	test   %eax,%eax
+  8021db:	0f 88 4f 01 00 00    	js     802330 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8021e1:	83 c3 01             	add    $0x1,%ebx
+  8021e4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8021e7:	74 7a                	je     802263 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8021e9:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8021eb:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8021f2:	f6 c1 01             	test   $0x1,%cl
+  8021f5:	74 ea                	je     8021e1 <sfork+0x109>
+  8021f7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8021fd:	74 e2                	je     8021e1 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8021ff:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  802205:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  802208:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80220d:	76 a5                	jbe    8021b4 <sfork+0xdc>
+  80220f:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  802215:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802218:	39 fa                	cmp    %edi,%edx
+  80221a:	73 9d                	jae    8021b9 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80221c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80221f:	39 fa                	cmp    %edi,%edx
+  802221:	72 96                	jb     8021b9 <sfork+0xe1>
+  802223:	eb 8f                	jmp    8021b4 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  802225:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80222b:	89 da                	mov    %ebx,%edx
+  80222d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802230:	e8 8c fa ff ff       	call   801cc1 <duppage_cow>
+  802235:	85 c0                	test   %eax,%eax
+  802237:	79 a8                	jns    8021e1 <sfork+0x109>
+  802239:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80223b:	89 f8                	mov    %edi,%eax
+  80223d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802240:	5b                   	pop    %ebx
+  802241:	5e                   	pop    %esi
+  802242:	5f                   	pop    %edi
+  802243:	5d                   	pop    %ebp
+  802244:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  802245:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80224a:	e8 2e fb ff ff       	call   801d7d <cow_copy>
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	0f 88 d2 00 00 00    	js     802329 <sfork+0x251>
+				pte = uvpt[pn];
+  802257:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80225e:	e9 66 ff ff ff       	jmp    8021c9 <sfork+0xf1>
+  802263:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802266:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802269:	83 c6 01             	add    $0x1,%esi
+  80226c:	81 c7 00 04 00 00    	add    $0x400,%edi
+  802272:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  802278:	74 1b                	je     802295 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80227a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802281:	a8 01                	test   $0x1,%al
+  802283:	74 e4                	je     802269 <sfork+0x191>
+  802285:	89 f3                	mov    %esi,%ebx
+  802287:	c1 e3 0a             	shl    $0xa,%ebx
+  80228a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80228d:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  802290:	e9 4f ff ff ff       	jmp    8021e4 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  802295:	83 ec 04             	sub    $0x4,%esp
+  802298:	6a 07                	push   $0x7
+  80229a:	68 00 f0 bf ee       	push   $0xeebff000
+  80229f:	ff 75 e0             	push   -0x20(%ebp)
+  8022a2:	e8 78 f5 ff ff       	call   80181f <sys_page_alloc>
+  8022a7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8022a9:	83 c4 10             	add    $0x10,%esp
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	78 37                	js     8022e7 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8022b0:	83 ec 08             	sub    $0x8,%esp
+  8022b3:	68 10 56 80 00       	push   $0x805610
+  8022b8:	ff 75 e0             	push   -0x20(%ebp)
+  8022bb:	e8 dc f6 ff ff       	call   80199c <sys_env_set_pgfault_upcall>
+  8022c0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8022c2:	83 c4 10             	add    $0x10,%esp
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	78 34                	js     8022fd <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8022c9:	83 ec 08             	sub    $0x8,%esp
+  8022cc:	6a 02                	push   $0x2
+  8022ce:	ff 75 e0             	push   -0x20(%ebp)
+  8022d1:	e8 2e f6 ff ff       	call   801904 <sys_env_set_status>
+  8022d6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	78 34                	js     802313 <sfork+0x23b>
+	return eid;
+  8022df:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8022e2:	e9 54 ff ff ff       	jmp    80223b <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8022e7:	83 ec 08             	sub    $0x8,%esp
+  8022ea:	50                   	push   %eax
+  8022eb:	68 44 61 80 00       	push   $0x806144
+  8022f0:	e8 18 ea ff ff       	call   800d0d <cprintf>
+		return r;
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	e9 3e ff ff ff       	jmp    80223b <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8022fd:	83 ec 08             	sub    $0x8,%esp
+  802300:	50                   	push   %eax
+  802301:	68 6c 61 80 00       	push   $0x80616c
+  802306:	e8 02 ea ff ff       	call   800d0d <cprintf>
+		return r;
+  80230b:	83 c4 10             	add    $0x10,%esp
+  80230e:	e9 28 ff ff ff       	jmp    80223b <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  802313:	83 ec 08             	sub    $0x8,%esp
+  802316:	50                   	push   %eax
+  802317:	68 e1 61 80 00       	push   $0x8061e1
+  80231c:	e8 ec e9 ff ff       	call   800d0d <cprintf>
+		return r;
+  802321:	83 c4 10             	add    $0x10,%esp
+  802324:	e9 12 ff ff ff       	jmp    80223b <sfork+0x163>
+  802329:	89 c7                	mov    %eax,%edi
+  80232b:	e9 0b ff ff ff       	jmp    80223b <sfork+0x163>
+  802330:	89 c7                	mov    %eax,%edi
+  802332:	e9 04 ff ff ff       	jmp    80223b <sfork+0x163>
+
+00802337 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80233d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802340:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  802343:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  802345:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  802348:	83 3a 01             	cmpl   $0x1,(%edx)
+  80234b:	7e 09                	jle    802356 <argstart+0x1f>
+  80234d:	ba a1 5a 80 00       	mov    $0x805aa1,%edx
+  802352:	85 c9                	test   %ecx,%ecx
+  802354:	75 05                	jne    80235b <argstart+0x24>
+  802356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235b:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  80235e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  802365:	5d                   	pop    %ebp
+  802366:	c3                   	ret
+
+00802367 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  802367:	55                   	push   %ebp
+  802368:	89 e5                	mov    %esp,%ebp
+  80236a:	53                   	push   %ebx
+  80236b:	83 ec 04             	sub    $0x4,%esp
+  80236e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  802371:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  802378:	8b 43 08             	mov    0x8(%ebx),%eax
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	74 74                	je     8023f3 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  80237f:	80 38 00             	cmpb   $0x0,(%eax)
+  802382:	75 48                	jne    8023cc <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  802384:	8b 0b                	mov    (%ebx),%ecx
+  802386:	83 39 01             	cmpl   $0x1,(%ecx)
+  802389:	74 5a                	je     8023e5 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  80238b:	8b 53 04             	mov    0x4(%ebx),%edx
+  80238e:	8b 42 04             	mov    0x4(%edx),%eax
+  802391:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802394:	75 4f                	jne    8023e5 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  802396:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80239a:	74 49                	je     8023e5 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  80239c:	83 c0 01             	add    $0x1,%eax
+  80239f:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	8b 01                	mov    (%ecx),%eax
+  8023a7:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8023ae:	50                   	push   %eax
+  8023af:	8d 42 08             	lea    0x8(%edx),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	83 c2 04             	add    $0x4,%edx
+  8023b6:	52                   	push   %edx
+  8023b7:	e8 ab f1 ff ff       	call   801567 <memmove>
+		(*args->argc)--;
+  8023bc:	8b 03                	mov    (%ebx),%eax
+  8023be:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8023c1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8023ca:	74 13                	je     8023df <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  8023cc:	8b 43 08             	mov    0x8(%ebx),%eax
+  8023cf:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  8023d2:	83 c0 01             	add    $0x1,%eax
+  8023d5:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  8023d8:	89 d0                	mov    %edx,%eax
+  8023da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023dd:	c9                   	leave
+  8023de:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8023df:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8023e3:	75 e7                	jne    8023cc <argnext+0x65>
+	args->curarg = 0;
+  8023e5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  8023ec:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8023f1:	eb e5                	jmp    8023d8 <argnext+0x71>
+		return -1;
+  8023f3:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8023f8:	eb de                	jmp    8023d8 <argnext+0x71>
+
+008023fa <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	53                   	push   %ebx
+  8023fe:	83 ec 04             	sub    $0x4,%esp
+  802401:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  802404:	8b 43 08             	mov    0x8(%ebx),%eax
+  802407:	85 c0                	test   %eax,%eax
+  802409:	74 12                	je     80241d <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80240b:	80 38 00             	cmpb   $0x0,(%eax)
+  80240e:	74 12                	je     802422 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  802410:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  802413:	c7 43 08 a1 5a 80 00 	movl   $0x805aa1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80241a:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  80241d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802420:	c9                   	leave
+  802421:	c3                   	ret
+	} else if (*args->argc > 1) {
+  802422:	8b 13                	mov    (%ebx),%edx
+  802424:	83 3a 01             	cmpl   $0x1,(%edx)
+  802427:	7f 10                	jg     802439 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  802429:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  802430:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  802437:	eb e1                	jmp    80241a <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  802439:	8b 43 04             	mov    0x4(%ebx),%eax
+  80243c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80243f:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802442:	83 ec 04             	sub    $0x4,%esp
+  802445:	8b 12                	mov    (%edx),%edx
+  802447:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80244e:	52                   	push   %edx
+  80244f:	8d 50 08             	lea    0x8(%eax),%edx
+  802452:	52                   	push   %edx
+  802453:	83 c0 04             	add    $0x4,%eax
+  802456:	50                   	push   %eax
+  802457:	e8 0b f1 ff ff       	call   801567 <memmove>
+		(*args->argc)--;
+  80245c:	8b 03                	mov    (%ebx),%eax
+  80245e:	83 28 01             	subl   $0x1,(%eax)
+  802461:	83 c4 10             	add    $0x10,%esp
+  802464:	eb b4                	jmp    80241a <argnextvalue+0x20>
+
+00802466 <argvalue>:
+{
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+  802469:	83 ec 08             	sub    $0x8,%esp
+  80246c:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80246f:	8b 42 0c             	mov    0xc(%edx),%eax
+  802472:	85 c0                	test   %eax,%eax
+  802474:	74 02                	je     802478 <argvalue+0x12>
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802478:	83 ec 0c             	sub    $0xc,%esp
+  80247b:	52                   	push   %edx
+  80247c:	e8 79 ff ff ff       	call   8023fa <argnextvalue>
+  802481:	83 c4 10             	add    $0x10,%esp
+  802484:	eb f0                	jmp    802476 <argvalue+0x10>
+
+00802486 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802489:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248c:	05 00 00 00 30       	add    $0x30000000,%eax
+  802491:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+
+00802496 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802496:	55                   	push   %ebp
+  802497:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8024a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8024a6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+
+008024ad <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8024b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8024b5:	eb 02                	jmp    8024b9 <fd_alloc+0xc>
+  8024b7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8024b9:	89 c2                	mov    %eax,%edx
+  8024bb:	c1 ea 16             	shr    $0x16,%edx
+  8024be:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8024c5:	f6 c2 01             	test   $0x1,%dl
+  8024c8:	74 2b                	je     8024f5 <fd_alloc+0x48>
+  8024ca:	89 c2                	mov    %eax,%edx
+  8024cc:	c1 ea 0c             	shr    $0xc,%edx
+  8024cf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8024d6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8024dc:	f6 c1 01             	test   $0x1,%cl
+  8024df:	74 14                	je     8024f5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8024e1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8024e7:	75 ce                	jne    8024b7 <fd_alloc+0xa>
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8024ee:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8024f3:	eb 05                	jmp    8024fa <fd_alloc+0x4d>
+			return 0;
+  8024f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8024fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024fd:	89 02                	mov    %eax,(%edx)
+}
+  8024ff:	89 c8                	mov    %ecx,%eax
+  802501:	5d                   	pop    %ebp
+  802502:	c3                   	ret
+
+00802503 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802509:	83 f8 1f             	cmp    $0x1f,%eax
+  80250c:	77 30                	ja     80253e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80250e:	c1 e0 0c             	shl    $0xc,%eax
+  802511:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802516:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80251c:	f6 c2 01             	test   $0x1,%dl
+  80251f:	74 24                	je     802545 <fd_lookup+0x42>
+  802521:	89 c2                	mov    %eax,%edx
+  802523:	c1 ea 0c             	shr    $0xc,%edx
+  802526:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80252d:	f6 c2 01             	test   $0x1,%dl
+  802530:	74 1a                	je     80254c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802532:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802535:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802537:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80253c:	5d                   	pop    %ebp
+  80253d:	c3                   	ret
+		return -E_INVAL;
+  80253e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802543:	eb f7                	jmp    80253c <fd_lookup+0x39>
+		return -E_INVAL;
+  802545:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254a:	eb f0                	jmp    80253c <fd_lookup+0x39>
+  80254c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802551:	eb e9                	jmp    80253c <fd_lookup+0x39>
+
+00802553 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802553:	55                   	push   %ebp
+  802554:	89 e5                	mov    %esp,%ebp
+  802556:	53                   	push   %ebx
+  802557:	83 ec 04             	sub    $0x4,%esp
+  80255a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80255d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802562:	eb 03                	jmp    802567 <dev_lookup+0x14>
+  802564:	83 c0 01             	add    $0x1,%eax
+  802567:	8b 1c 85 7c 62 80 00 	mov    0x80627c(,%eax,4),%ebx
+  80256e:	85 db                	test   %ebx,%ebx
+  802570:	74 0b                	je     80257d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802572:	39 13                	cmp    %edx,(%ebx)
+  802574:	75 ee                	jne    802564 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257b:	eb 49                	jmp    8025c6 <dev_lookup+0x73>
+  80257d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80257f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802585:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80258a:	77 18                	ja     8025a4 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80258c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802591:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802593:	c1 e8 10             	shr    $0x10,%eax
+  802596:	74 0c                	je     8025a4 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802598:	c1 e0 10             	shl    $0x10,%eax
+  80259b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8025a0:	29 c1                	sub    %eax,%ecx
+  8025a2:	eb 06                	jmp    8025aa <dev_lookup+0x57>
+		return pthread_main_tls;
+  8025a4:	8b 0d 00 8b 80 00    	mov    0x808b00,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8025aa:	8b 01                	mov    (%ecx),%eax
+  8025ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8025af:	83 ec 04             	sub    $0x4,%esp
+  8025b2:	52                   	push   %edx
+  8025b3:	50                   	push   %eax
+  8025b4:	68 00 62 80 00       	push   $0x806200
+  8025b9:	e8 4f e7 ff ff       	call   800d0d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8025be:	83 c4 10             	add    $0x10,%esp
+  8025c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8025c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025c9:	89 1a                	mov    %ebx,(%edx)
+}
+  8025cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ce:	c9                   	leave
+  8025cf:	c3                   	ret
+
+008025d0 <fd_close>:
+{
+  8025d0:	55                   	push   %ebp
+  8025d1:	89 e5                	mov    %esp,%ebp
+  8025d3:	57                   	push   %edi
+  8025d4:	56                   	push   %esi
+  8025d5:	53                   	push   %ebx
+  8025d6:	83 ec 24             	sub    $0x24,%esp
+  8025d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8025df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025e2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8025e3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8025e9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8025ec:	50                   	push   %eax
+  8025ed:	e8 11 ff ff ff       	call   802503 <fd_lookup>
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	83 c4 10             	add    $0x10,%esp
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	78 05                	js     802600 <fd_close+0x30>
+	    || fd != fd2)
+  8025fb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8025fe:	74 16                	je     802616 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802600:	89 f8                	mov    %edi,%eax
+  802602:	84 c0                	test   %al,%al
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+  802609:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80260c:	89 d8                	mov    %ebx,%eax
+  80260e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802611:	5b                   	pop    %ebx
+  802612:	5e                   	pop    %esi
+  802613:	5f                   	pop    %edi
+  802614:	5d                   	pop    %ebp
+  802615:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80261c:	50                   	push   %eax
+  80261d:	ff 36                	push   (%esi)
+  80261f:	e8 2f ff ff ff       	call   802553 <dev_lookup>
+  802624:	89 c3                	mov    %eax,%ebx
+  802626:	83 c4 10             	add    $0x10,%esp
+  802629:	85 c0                	test   %eax,%eax
+  80262b:	78 1a                	js     802647 <fd_close+0x77>
+		if (dev->dev_close)
+  80262d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802630:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802633:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	74 0b                	je     802647 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80263c:	83 ec 0c             	sub    $0xc,%esp
+  80263f:	56                   	push   %esi
+  802640:	ff d0                	call   *%eax
+  802642:	89 c3                	mov    %eax,%ebx
+  802644:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802647:	83 ec 08             	sub    $0x8,%esp
+  80264a:	56                   	push   %esi
+  80264b:	6a 00                	push   $0x0
+  80264d:	e8 66 f2 ff ff       	call   8018b8 <sys_page_unmap>
+	return r;
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	eb b5                	jmp    80260c <fd_close+0x3c>
+
+00802657 <close>:
+
+int
+close(int fdnum)
+{
+  802657:	55                   	push   %ebp
+  802658:	89 e5                	mov    %esp,%ebp
+  80265a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80265d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802660:	50                   	push   %eax
+  802661:	ff 75 08             	push   0x8(%ebp)
+  802664:	e8 9a fe ff ff       	call   802503 <fd_lookup>
+  802669:	83 c4 10             	add    $0x10,%esp
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	79 02                	jns    802672 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802670:	c9                   	leave
+  802671:	c3                   	ret
+		return fd_close(fd, 1);
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	6a 01                	push   $0x1
+  802677:	ff 75 f4             	push   -0xc(%ebp)
+  80267a:	e8 51 ff ff ff       	call   8025d0 <fd_close>
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	eb ec                	jmp    802670 <close+0x19>
+
+00802684 <close_all>:
+
+void
+close_all(void)
+{
+  802684:	55                   	push   %ebp
+  802685:	89 e5                	mov    %esp,%ebp
+  802687:	53                   	push   %ebx
+  802688:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80268b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802690:	83 ec 0c             	sub    $0xc,%esp
+  802693:	53                   	push   %ebx
+  802694:	e8 be ff ff ff       	call   802657 <close>
+	for (i = 0; i < MAXFD; i++)
+  802699:	83 c3 01             	add    $0x1,%ebx
+  80269c:	83 c4 10             	add    $0x10,%esp
+  80269f:	83 fb 20             	cmp    $0x20,%ebx
+  8026a2:	75 ec                	jne    802690 <close_all+0xc>
+}
+  8026a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a7:	c9                   	leave
+  8026a8:	c3                   	ret
+
+008026a9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8026a9:	55                   	push   %ebp
+  8026aa:	89 e5                	mov    %esp,%ebp
+  8026ac:	57                   	push   %edi
+  8026ad:	56                   	push   %esi
+  8026ae:	53                   	push   %ebx
+  8026af:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8026b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	ff 75 08             	push   0x8(%ebp)
+  8026b9:	e8 45 fe ff ff       	call   802503 <fd_lookup>
+  8026be:	89 c3                	mov    %eax,%ebx
+  8026c0:	83 c4 10             	add    $0x10,%esp
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	78 7f                	js     802746 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8026c7:	83 ec 0c             	sub    $0xc,%esp
+  8026ca:	ff 75 0c             	push   0xc(%ebp)
+  8026cd:	e8 85 ff ff ff       	call   802657 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8026d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026d5:	c1 e6 0c             	shl    $0xc,%esi
+  8026d8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8026de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8026e1:	89 3c 24             	mov    %edi,(%esp)
+  8026e4:	e8 ad fd ff ff       	call   802496 <fd2data>
+  8026e9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8026eb:	89 34 24             	mov    %esi,(%esp)
+  8026ee:	e8 a3 fd ff ff       	call   802496 <fd2data>
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8026f9:	89 d8                	mov    %ebx,%eax
+  8026fb:	c1 e8 16             	shr    $0x16,%eax
+  8026fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802705:	a8 01                	test   $0x1,%al
+  802707:	74 11                	je     80271a <dup+0x71>
+  802709:	89 d8                	mov    %ebx,%eax
+  80270b:	c1 e8 0c             	shr    $0xc,%eax
+  80270e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802715:	f6 c2 01             	test   $0x1,%dl
+  802718:	75 36                	jne    802750 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80271a:	89 f8                	mov    %edi,%eax
+  80271c:	c1 e8 0c             	shr    $0xc,%eax
+  80271f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802726:	83 ec 0c             	sub    $0xc,%esp
+  802729:	25 07 0e 00 00       	and    $0xe07,%eax
+  80272e:	50                   	push   %eax
+  80272f:	56                   	push   %esi
+  802730:	6a 00                	push   $0x0
+  802732:	57                   	push   %edi
+  802733:	6a 00                	push   $0x0
+  802735:	e8 32 f1 ff ff       	call   80186c <sys_page_map>
+  80273a:	89 c3                	mov    %eax,%ebx
+  80273c:	83 c4 20             	add    $0x20,%esp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	78 33                	js     802776 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802743:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802746:	89 d8                	mov    %ebx,%eax
+  802748:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274b:	5b                   	pop    %ebx
+  80274c:	5e                   	pop    %esi
+  80274d:	5f                   	pop    %edi
+  80274e:	5d                   	pop    %ebp
+  80274f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802750:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802757:	83 ec 0c             	sub    $0xc,%esp
+  80275a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80275f:	50                   	push   %eax
+  802760:	ff 75 d4             	push   -0x2c(%ebp)
+  802763:	6a 00                	push   $0x0
+  802765:	53                   	push   %ebx
+  802766:	6a 00                	push   $0x0
+  802768:	e8 ff f0 ff ff       	call   80186c <sys_page_map>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 20             	add    $0x20,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	79 a4                	jns    80271a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802776:	83 ec 08             	sub    $0x8,%esp
+  802779:	56                   	push   %esi
+  80277a:	6a 00                	push   $0x0
+  80277c:	e8 37 f1 ff ff       	call   8018b8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802781:	83 c4 08             	add    $0x8,%esp
+  802784:	ff 75 d4             	push   -0x2c(%ebp)
+  802787:	6a 00                	push   $0x0
+  802789:	e8 2a f1 ff ff       	call   8018b8 <sys_page_unmap>
+	return r;
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	eb b3                	jmp    802746 <dup+0x9d>
+
+00802793 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	56                   	push   %esi
+  802797:	53                   	push   %ebx
+  802798:	83 ec 18             	sub    $0x18,%esp
+  80279b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80279e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027a1:	50                   	push   %eax
+  8027a2:	53                   	push   %ebx
+  8027a3:	e8 5b fd ff ff       	call   802503 <fd_lookup>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 3c                	js     8027eb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8027af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8027b2:	83 ec 08             	sub    $0x8,%esp
+  8027b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b8:	50                   	push   %eax
+  8027b9:	ff 36                	push   (%esi)
+  8027bb:	e8 93 fd ff ff       	call   802553 <dev_lookup>
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	78 24                	js     8027eb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8027c7:	8b 46 08             	mov    0x8(%esi),%eax
+  8027ca:	83 e0 03             	and    $0x3,%eax
+  8027cd:	83 f8 01             	cmp    $0x1,%eax
+  8027d0:	74 20                	je     8027f2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8027d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d5:	8b 40 08             	mov    0x8(%eax),%eax
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	74 61                	je     80283d <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8027dc:	83 ec 04             	sub    $0x4,%esp
+  8027df:	ff 75 10             	push   0x10(%ebp)
+  8027e2:	ff 75 0c             	push   0xc(%ebp)
+  8027e5:	56                   	push   %esi
+  8027e6:	ff d0                	call   *%eax
+  8027e8:	83 c4 10             	add    $0x10,%esp
+}
+  8027eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ee:	5b                   	pop    %ebx
+  8027ef:	5e                   	pop    %esi
+  8027f0:	5d                   	pop    %ebp
+  8027f1:	c3                   	ret
+  8027f2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8027f4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8027fa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8027ff:	77 18                	ja     802819 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802801:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802806:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802808:	c1 e8 10             	shr    $0x10,%eax
+  80280b:	74 0c                	je     802819 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80280d:	c1 e0 10             	shl    $0x10,%eax
+  802810:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802815:	29 c2                	sub    %eax,%edx
+  802817:	eb 06                	jmp    80281f <read+0x8c>
+		return pthread_main_tls;
+  802819:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80281f:	8b 02                	mov    (%edx),%eax
+  802821:	8b 40 48             	mov    0x48(%eax),%eax
+  802824:	83 ec 04             	sub    $0x4,%esp
+  802827:	53                   	push   %ebx
+  802828:	50                   	push   %eax
+  802829:	68 41 62 80 00       	push   $0x806241
+  80282e:	e8 da e4 ff ff       	call   800d0d <cprintf>
+		return -E_INVAL;
+  802833:	83 c4 10             	add    $0x10,%esp
+  802836:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80283b:	eb ae                	jmp    8027eb <read+0x58>
+		return -E_NOT_SUPP;
+  80283d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802842:	eb a7                	jmp    8027eb <read+0x58>
+
+00802844 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	57                   	push   %edi
+  802848:	56                   	push   %esi
+  802849:	53                   	push   %ebx
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802850:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802853:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802858:	eb 02                	jmp    80285c <readn+0x18>
+  80285a:	01 c3                	add    %eax,%ebx
+  80285c:	39 f3                	cmp    %esi,%ebx
+  80285e:	73 21                	jae    802881 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802860:	83 ec 04             	sub    $0x4,%esp
+  802863:	89 f0                	mov    %esi,%eax
+  802865:	29 d8                	sub    %ebx,%eax
+  802867:	50                   	push   %eax
+  802868:	89 d8                	mov    %ebx,%eax
+  80286a:	03 45 0c             	add    0xc(%ebp),%eax
+  80286d:	50                   	push   %eax
+  80286e:	57                   	push   %edi
+  80286f:	e8 1f ff ff ff       	call   802793 <read>
+		if (m < 0)
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 04                	js     80287f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80287b:	75 dd                	jne    80285a <readn+0x16>
+  80287d:	eb 02                	jmp    802881 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80287f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802881:	89 d8                	mov    %ebx,%eax
+  802883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802886:	5b                   	pop    %ebx
+  802887:	5e                   	pop    %esi
+  802888:	5f                   	pop    %edi
+  802889:	5d                   	pop    %ebp
+  80288a:	c3                   	ret
+
+0080288b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80288b:	55                   	push   %ebp
+  80288c:	89 e5                	mov    %esp,%ebp
+  80288e:	56                   	push   %esi
+  80288f:	53                   	push   %ebx
+  802890:	83 ec 18             	sub    $0x18,%esp
+  802893:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802896:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802899:	50                   	push   %eax
+  80289a:	53                   	push   %ebx
+  80289b:	e8 63 fc ff ff       	call   802503 <fd_lookup>
+  8028a0:	83 c4 10             	add    $0x10,%esp
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	78 37                	js     8028de <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8028a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+  8028ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028b0:	50                   	push   %eax
+  8028b1:	ff 36                	push   (%esi)
+  8028b3:	e8 9b fc ff ff       	call   802553 <dev_lookup>
+  8028b8:	83 c4 10             	add    $0x10,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 1f                	js     8028de <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028bf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8028c3:	74 20                	je     8028e5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8028c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	74 61                	je     802930 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8028cf:	83 ec 04             	sub    $0x4,%esp
+  8028d2:	ff 75 10             	push   0x10(%ebp)
+  8028d5:	ff 75 0c             	push   0xc(%ebp)
+  8028d8:	56                   	push   %esi
+  8028d9:	ff d0                	call   *%eax
+  8028db:	83 c4 10             	add    $0x10,%esp
+}
+  8028de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028e1:	5b                   	pop    %ebx
+  8028e2:	5e                   	pop    %esi
+  8028e3:	5d                   	pop    %ebp
+  8028e4:	c3                   	ret
+  8028e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8028e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8028ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8028f2:	77 18                	ja     80290c <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8028f4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8028f9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8028fb:	c1 e8 10             	shr    $0x10,%eax
+  8028fe:	74 0c                	je     80290c <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802900:	c1 e0 10             	shl    $0x10,%eax
+  802903:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802908:	29 c2                	sub    %eax,%edx
+  80290a:	eb 06                	jmp    802912 <write+0x87>
+		return pthread_main_tls;
+  80290c:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802912:	8b 02                	mov    (%edx),%eax
+  802914:	8b 40 48             	mov    0x48(%eax),%eax
+  802917:	83 ec 04             	sub    $0x4,%esp
+  80291a:	53                   	push   %ebx
+  80291b:	50                   	push   %eax
+  80291c:	68 5d 62 80 00       	push   $0x80625d
+  802921:	e8 e7 e3 ff ff       	call   800d0d <cprintf>
+		return -E_INVAL;
+  802926:	83 c4 10             	add    $0x10,%esp
+  802929:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80292e:	eb ae                	jmp    8028de <write+0x53>
+		return -E_NOT_SUPP;
+  802930:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802935:	eb a7                	jmp    8028de <write+0x53>
+
+00802937 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80293d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802940:	50                   	push   %eax
+  802941:	ff 75 08             	push   0x8(%ebp)
+  802944:	e8 ba fb ff ff       	call   802503 <fd_lookup>
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 0e                	js     80295e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802950:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802956:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802959:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80295e:	c9                   	leave
+  80295f:	c3                   	ret
+
+00802960 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	56                   	push   %esi
+  802964:	53                   	push   %ebx
+  802965:	83 ec 18             	sub    $0x18,%esp
+  802968:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80296b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80296e:	50                   	push   %eax
+  80296f:	53                   	push   %ebx
+  802970:	e8 8e fb ff ff       	call   802503 <fd_lookup>
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 34                	js     8029b0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80297c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80297f:	83 ec 08             	sub    $0x8,%esp
+  802982:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802985:	50                   	push   %eax
+  802986:	ff 36                	push   (%esi)
+  802988:	e8 c6 fb ff ff       	call   802553 <dev_lookup>
+  80298d:	83 c4 10             	add    $0x10,%esp
+  802990:	85 c0                	test   %eax,%eax
+  802992:	78 1c                	js     8029b0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802994:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802998:	74 1d                	je     8029b7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80299a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299d:	8b 40 18             	mov    0x18(%eax),%eax
+  8029a0:	85 c0                	test   %eax,%eax
+  8029a2:	74 5e                	je     802a02 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8029a4:	83 ec 08             	sub    $0x8,%esp
+  8029a7:	ff 75 0c             	push   0xc(%ebp)
+  8029aa:	56                   	push   %esi
+  8029ab:	ff d0                	call   *%eax
+  8029ad:	83 c4 10             	add    $0x10,%esp
+}
+  8029b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b3:	5b                   	pop    %ebx
+  8029b4:	5e                   	pop    %esi
+  8029b5:	5d                   	pop    %ebp
+  8029b6:	c3                   	ret
+  8029b7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8029b9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8029bf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8029c4:	77 18                	ja     8029de <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8029c6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8029cb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8029cd:	c1 e8 10             	shr    $0x10,%eax
+  8029d0:	74 0c                	je     8029de <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8029d2:	c1 e0 10             	shl    $0x10,%eax
+  8029d5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8029da:	29 c2                	sub    %eax,%edx
+  8029dc:	eb 06                	jmp    8029e4 <ftruncate+0x84>
+		return pthread_main_tls;
+  8029de:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+			thisenv->env_id, fdnum);
+  8029e4:	8b 02                	mov    (%edx),%eax
+  8029e6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8029e9:	83 ec 04             	sub    $0x4,%esp
+  8029ec:	53                   	push   %ebx
+  8029ed:	50                   	push   %eax
+  8029ee:	68 20 62 80 00       	push   $0x806220
+  8029f3:	e8 15 e3 ff ff       	call   800d0d <cprintf>
+		return -E_INVAL;
+  8029f8:	83 c4 10             	add    $0x10,%esp
+  8029fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a00:	eb ae                	jmp    8029b0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802a02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a07:	eb a7                	jmp    8029b0 <ftruncate+0x50>
+
+00802a09 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	56                   	push   %esi
+  802a0d:	53                   	push   %ebx
+  802a0e:	83 ec 18             	sub    $0x18,%esp
+  802a11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802a14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a17:	50                   	push   %eax
+  802a18:	ff 75 08             	push   0x8(%ebp)
+  802a1b:	e8 e3 fa ff ff       	call   802503 <fd_lookup>
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 49                	js     802a70 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a27:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802a2a:	83 ec 08             	sub    $0x8,%esp
+  802a2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a30:	50                   	push   %eax
+  802a31:	ff 36                	push   (%esi)
+  802a33:	e8 1b fb ff ff       	call   802553 <dev_lookup>
+  802a38:	83 c4 10             	add    $0x10,%esp
+  802a3b:	85 c0                	test   %eax,%eax
+  802a3d:	78 31                	js     802a70 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a42:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802a46:	74 2f                	je     802a77 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802a48:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802a4b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802a52:	00 00 00 
+	stat->st_isdir = 0;
+  802a55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a5c:	00 00 00 
+	stat->st_dev = dev;
+  802a5f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802a65:	83 ec 08             	sub    $0x8,%esp
+  802a68:	53                   	push   %ebx
+  802a69:	56                   	push   %esi
+  802a6a:	ff 50 14             	call   *0x14(%eax)
+  802a6d:	83 c4 10             	add    $0x10,%esp
+}
+  802a70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a73:	5b                   	pop    %ebx
+  802a74:	5e                   	pop    %esi
+  802a75:	5d                   	pop    %ebp
+  802a76:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a7c:	eb f2                	jmp    802a70 <fstat+0x67>
+
+00802a7e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802a7e:	55                   	push   %ebp
+  802a7f:	89 e5                	mov    %esp,%ebp
+  802a81:	56                   	push   %esi
+  802a82:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802a83:	83 ec 08             	sub    $0x8,%esp
+  802a86:	6a 00                	push   $0x0
+  802a88:	ff 75 08             	push   0x8(%ebp)
+  802a8b:	e8 4b 03 00 00       	call   802ddb <open>
+  802a90:	89 c3                	mov    %eax,%ebx
+  802a92:	83 c4 10             	add    $0x10,%esp
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	78 1b                	js     802ab4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802a99:	83 ec 08             	sub    $0x8,%esp
+  802a9c:	ff 75 0c             	push   0xc(%ebp)
+  802a9f:	50                   	push   %eax
+  802aa0:	e8 64 ff ff ff       	call   802a09 <fstat>
+  802aa5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802aa7:	89 1c 24             	mov    %ebx,(%esp)
+  802aaa:	e8 a8 fb ff ff       	call   802657 <close>
+	return r;
+  802aaf:	83 c4 10             	add    $0x10,%esp
+  802ab2:	89 f3                	mov    %esi,%ebx
+}
+  802ab4:	89 d8                	mov    %ebx,%eax
+  802ab6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab9:	5b                   	pop    %ebx
+  802aba:	5e                   	pop    %esi
+  802abb:	5d                   	pop    %ebp
+  802abc:	c3                   	ret
+
+00802abd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802abd:	55                   	push   %ebp
+  802abe:	89 e5                	mov    %esp,%ebp
+  802ac0:	56                   	push   %esi
+  802ac1:	53                   	push   %ebx
+  802ac2:	89 c6                	mov    %eax,%esi
+  802ac4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802ac6:	83 3d 40 88 80 00 00 	cmpl   $0x0,0x808840
+  802acd:	74 27                	je     802af6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802acf:	6a 07                	push   $0x7
+  802ad1:	68 00 90 80 00       	push   $0x809000
+  802ad6:	56                   	push   %esi
+  802ad7:	ff 35 40 88 80 00    	push   0x808840
+  802add:	e8 4a 2c 00 00       	call   80572c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802ae2:	83 c4 0c             	add    $0xc,%esp
+  802ae5:	6a 00                	push   $0x0
+  802ae7:	53                   	push   %ebx
+  802ae8:	6a 00                	push   $0x0
+  802aea:	e8 47 2b 00 00       	call   805636 <ipc_recv>
+}
+  802aef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af2:	5b                   	pop    %ebx
+  802af3:	5e                   	pop    %esi
+  802af4:	5d                   	pop    %ebp
+  802af5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802af6:	83 ec 0c             	sub    $0xc,%esp
+  802af9:	6a 01                	push   $0x1
+  802afb:	e8 82 2c 00 00       	call   805782 <ipc_find_env>
+  802b00:	a3 40 88 80 00       	mov    %eax,0x808840
+  802b05:	83 c4 10             	add    $0x10,%esp
+  802b08:	eb c5                	jmp    802acf <fsipc+0x12>
+
+00802b0a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	53                   	push   %ebx
+  802b0e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802b11:	68 44 88 80 00       	push   $0x808844
+  802b16:	e8 ab 22 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802b21:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  802b26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b29:	a3 04 90 80 00       	mov    %eax,0x809004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  802b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b33:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b38:	e8 80 ff ff ff       	call   802abd <fsipc>
+  802b3d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802b3f:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  802b46:	e8 e8 22 00 00       	call   804e33 <mutex_unlock>
+	return r;
+}
+  802b4b:	89 d8                	mov    %ebx,%eax
+  802b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+
+00802b52 <devfile_flush>:
+{
+  802b52:	55                   	push   %ebp
+  802b53:	89 e5                	mov    %esp,%ebp
+  802b55:	53                   	push   %ebx
+  802b56:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802b59:	68 44 88 80 00       	push   $0x808844
+  802b5e:	e8 63 22 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b66:	8b 40 0c             	mov    0xc(%eax),%eax
+  802b69:	a3 00 90 80 00       	mov    %eax,0x809000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  802b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b73:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b78:	e8 40 ff ff ff       	call   802abd <fsipc>
+  802b7d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802b7f:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  802b86:	e8 a8 22 00 00       	call   804e33 <mutex_unlock>
+}
+  802b8b:	89 d8                	mov    %ebx,%eax
+  802b8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+00802b92 <devfile_stat>:
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	56                   	push   %esi
+  802b96:	53                   	push   %ebx
+  802b97:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802b9a:	83 ec 0c             	sub    $0xc,%esp
+  802b9d:	68 44 88 80 00       	push   $0x808844
+  802ba2:	e8 1f 22 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baa:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bad:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb7:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bbc:	e8 fc fe ff ff       	call   802abd <fsipc>
+  802bc1:	89 c3                	mov    %eax,%ebx
+  802bc3:	83 c4 10             	add    $0x10,%esp
+  802bc6:	85 c0                	test   %eax,%eax
+  802bc8:	79 16                	jns    802be0 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802bca:	83 ec 0c             	sub    $0xc,%esp
+  802bcd:	68 44 88 80 00       	push   $0x808844
+  802bd2:	e8 5c 22 00 00       	call   804e33 <mutex_unlock>
+}
+  802bd7:	89 d8                	mov    %ebx,%eax
+  802bd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bdc:	5b                   	pop    %ebx
+  802bdd:	5e                   	pop    %esi
+  802bde:	5d                   	pop    %ebp
+  802bdf:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802be0:	83 ec 08             	sub    $0x8,%esp
+  802be3:	68 00 90 80 00       	push   $0x809000
+  802be8:	56                   	push   %esi
+  802be9:	e8 f3 e7 ff ff       	call   8013e1 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802bee:	a1 80 90 80 00       	mov    0x809080,%eax
+  802bf3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bf9:	a1 84 90 80 00       	mov    0x809084,%eax
+  802bfe:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802c04:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c0c:	eb bc                	jmp    802bca <devfile_stat+0x38>
+
+00802c0e <devfile_write>:
+{
+  802c0e:	55                   	push   %ebp
+  802c0f:	89 e5                	mov    %esp,%ebp
+  802c11:	53                   	push   %ebx
+  802c12:	83 ec 10             	sub    $0x10,%esp
+  802c15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802c18:	68 44 88 80 00       	push   $0x808844
+  802c1d:	e8 a4 21 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c25:	8b 40 0c             	mov    0xc(%eax),%eax
+  802c28:	a3 00 90 80 00       	mov    %eax,0x809000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802c2d:	83 c4 10             	add    $0x10,%esp
+  802c30:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802c36:	76 3d                	jbe    802c75 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802c38:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802c3d:	39 c3                	cmp    %eax,%ebx
+  802c3f:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802c42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c45:	a3 08 90 80 00       	mov    %eax,0x809008
+	fsipcbuf.write.req_n = n;
+  802c4a:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c55:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c5a:	e8 5e fe ff ff       	call   802abd <fsipc>
+  802c5f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802c61:	83 ec 0c             	sub    $0xc,%esp
+  802c64:	68 44 88 80 00       	push   $0x808844
+  802c69:	e8 c5 21 00 00       	call   804e33 <mutex_unlock>
+}
+  802c6e:	89 d8                	mov    %ebx,%eax
+  802c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c73:	c9                   	leave
+  802c74:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802c75:	83 ec 04             	sub    $0x4,%esp
+  802c78:	53                   	push   %ebx
+  802c79:	ff 75 0c             	push   0xc(%ebp)
+  802c7c:	68 0c 90 80 00       	push   $0x80900c
+  802c81:	e8 e1 e8 ff ff       	call   801567 <memmove>
+  802c86:	83 c4 10             	add    $0x10,%esp
+  802c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8e:	eb b5                	jmp    802c45 <devfile_write+0x37>
+
+00802c90 <devfile_read>:
+{
+  802c90:	55                   	push   %ebp
+  802c91:	89 e5                	mov    %esp,%ebp
+  802c93:	57                   	push   %edi
+  802c94:	56                   	push   %esi
+  802c95:	53                   	push   %ebx
+  802c96:	83 ec 0c             	sub    $0xc,%esp
+  802c99:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802c9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802ca2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802ca8:	0f 86 8c 00 00 00    	jbe    802d3a <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802cae:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802cb3:	39 c3                	cmp    %eax,%ebx
+  802cb5:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802cb8:	89 f8                	mov    %edi,%eax
+  802cba:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802cbd:	eb 0f                	jmp    802cce <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802cbf:	0f b6 08             	movzbl (%eax),%ecx
+  802cc2:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802cc4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802cc9:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802cce:	39 d0                	cmp    %edx,%eax
+  802cd0:	72 ed                	jb     802cbf <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802cd2:	83 ec 0c             	sub    $0xc,%esp
+  802cd5:	68 44 88 80 00       	push   $0x808844
+  802cda:	e8 e7 20 00 00       	call   804dc6 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cdf:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ce2:	a3 00 90 80 00       	mov    %eax,0x809000
+		fsipcbuf.read.req_n = n;
+  802ce7:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802ced:	89 3d 08 90 80 00    	mov    %edi,0x809008
+		r = fsipc(FSREQ_READ, NULL);
+  802cf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf8:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cfd:	e8 bb fd ff ff       	call   802abd <fsipc>
+  802d02:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802d04:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  802d0b:	e8 23 21 00 00       	call   804e33 <mutex_unlock>
+		assert(r <= (int) n);
+  802d10:	83 c4 10             	add    $0x10,%esp
+  802d13:	39 f3                	cmp    %esi,%ebx
+  802d15:	7c 0a                	jl     802d21 <devfile_read+0x91>
+}
+  802d17:	89 f0                	mov    %esi,%eax
+  802d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d1c:	5b                   	pop    %ebx
+  802d1d:	5e                   	pop    %esi
+  802d1e:	5f                   	pop    %edi
+  802d1f:	5d                   	pop    %ebp
+  802d20:	c3                   	ret
+		assert(r <= (int) n);
+  802d21:	68 90 62 80 00       	push   $0x806290
+  802d26:	68 d2 5b 80 00       	push   $0x805bd2
+  802d2b:	68 90 00 00 00       	push   $0x90
+  802d30:	68 9d 62 80 00       	push   $0x80629d
+  802d35:	e8 f8 de ff ff       	call   800c32 <_panic>
+	mutex_lock(&fsipc_mu);
+  802d3a:	83 ec 0c             	sub    $0xc,%esp
+  802d3d:	68 44 88 80 00       	push   $0x808844
+  802d42:	e8 7f 20 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d47:	8b 46 0c             	mov    0xc(%esi),%eax
+  802d4a:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  802d4f:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	fsipcbuf.read.req_va = 0;
+  802d55:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802d5c:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d64:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d69:	e8 4f fd ff ff       	call   802abd <fsipc>
+  802d6e:	89 c6                	mov    %eax,%esi
+  802d70:	83 c4 10             	add    $0x10,%esp
+  802d73:	85 c0                	test   %eax,%eax
+  802d75:	78 1d                	js     802d94 <devfile_read+0x104>
+		assert(r <= n);
+  802d77:	39 c3                	cmp    %eax,%ebx
+  802d79:	72 2e                	jb     802da9 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802d7b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d80:	7f 40                	jg     802dc2 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802d82:	83 ec 04             	sub    $0x4,%esp
+  802d85:	50                   	push   %eax
+  802d86:	68 00 90 80 00       	push   $0x809000
+  802d8b:	57                   	push   %edi
+  802d8c:	e8 d6 e7 ff ff       	call   801567 <memmove>
+  802d91:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802d94:	83 ec 0c             	sub    $0xc,%esp
+  802d97:	68 44 88 80 00       	push   $0x808844
+  802d9c:	e8 92 20 00 00       	call   804e33 <mutex_unlock>
+	return r;
+  802da1:	83 c4 10             	add    $0x10,%esp
+  802da4:	e9 6e ff ff ff       	jmp    802d17 <devfile_read+0x87>
+		assert(r <= n);
+  802da9:	68 a8 62 80 00       	push   $0x8062a8
+  802dae:	68 d2 5b 80 00       	push   $0x805bd2
+  802db3:	68 99 00 00 00       	push   $0x99
+  802db8:	68 9d 62 80 00       	push   $0x80629d
+  802dbd:	e8 70 de ff ff       	call   800c32 <_panic>
+		assert(r <= PGSIZE);
+  802dc2:	68 af 62 80 00       	push   $0x8062af
+  802dc7:	68 d2 5b 80 00       	push   $0x805bd2
+  802dcc:	68 9a 00 00 00       	push   $0x9a
+  802dd1:	68 9d 62 80 00       	push   $0x80629d
+  802dd6:	e8 57 de ff ff       	call   800c32 <_panic>
+
+00802ddb <open>:
+{
+  802ddb:	55                   	push   %ebp
+  802ddc:	89 e5                	mov    %esp,%ebp
+  802dde:	56                   	push   %esi
+  802ddf:	53                   	push   %ebx
+  802de0:	83 ec 1c             	sub    $0x1c,%esp
+  802de3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802de6:	56                   	push   %esi
+  802de7:	e8 ba e5 ff ff       	call   8013a6 <strlen>
+  802dec:	83 c4 10             	add    $0x10,%esp
+  802def:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802df4:	0f 8f 85 00 00 00    	jg     802e7f <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802dfa:	83 ec 0c             	sub    $0xc,%esp
+  802dfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e00:	50                   	push   %eax
+  802e01:	e8 a7 f6 ff ff       	call   8024ad <fd_alloc>
+  802e06:	89 c3                	mov    %eax,%ebx
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	78 55                	js     802e64 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802e0f:	83 ec 0c             	sub    $0xc,%esp
+  802e12:	68 44 88 80 00       	push   $0x808844
+  802e17:	e8 aa 1f 00 00       	call   804dc6 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802e1c:	83 c4 08             	add    $0x8,%esp
+  802e1f:	56                   	push   %esi
+  802e20:	68 00 90 80 00       	push   $0x809000
+  802e25:	e8 b7 e5 ff ff       	call   8013e1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802e2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e2d:	a3 00 94 80 00       	mov    %eax,0x809400
+	r = fsipc(FSREQ_OPEN, fd);
+  802e32:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e35:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e3a:	e8 7e fc ff ff       	call   802abd <fsipc>
+  802e3f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802e41:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  802e48:	e8 e6 1f 00 00       	call   804e33 <mutex_unlock>
+	if (r < 0) {
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	85 db                	test   %ebx,%ebx
+  802e52:	78 19                	js     802e6d <open+0x92>
+	return fd2num(fd);
+  802e54:	83 ec 0c             	sub    $0xc,%esp
+  802e57:	ff 75 f4             	push   -0xc(%ebp)
+  802e5a:	e8 27 f6 ff ff       	call   802486 <fd2num>
+  802e5f:	89 c3                	mov    %eax,%ebx
+  802e61:	83 c4 10             	add    $0x10,%esp
+}
+  802e64:	89 d8                	mov    %ebx,%eax
+  802e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e69:	5b                   	pop    %ebx
+  802e6a:	5e                   	pop    %esi
+  802e6b:	5d                   	pop    %ebp
+  802e6c:	c3                   	ret
+		fd_close(fd, 0);
+  802e6d:	83 ec 08             	sub    $0x8,%esp
+  802e70:	6a 00                	push   $0x0
+  802e72:	ff 75 f4             	push   -0xc(%ebp)
+  802e75:	e8 56 f7 ff ff       	call   8025d0 <fd_close>
+		return r;
+  802e7a:	83 c4 10             	add    $0x10,%esp
+  802e7d:	eb e5                	jmp    802e64 <open+0x89>
+		return -E_BAD_PATH;
+  802e7f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802e84:	eb de                	jmp    802e64 <open+0x89>
+
+00802e86 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802e86:	55                   	push   %ebp
+  802e87:	89 e5                	mov    %esp,%ebp
+  802e89:	53                   	push   %ebx
+  802e8a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e90:	50                   	push   %eax
+  802e91:	ff 75 08             	push   0x8(%ebp)
+  802e94:	e8 6a f6 ff ff       	call   802503 <fd_lookup>
+  802e99:	89 c3                	mov    %eax,%ebx
+  802e9b:	83 c4 10             	add    $0x10,%esp
+  802e9e:	85 c0                	test   %eax,%eax
+  802ea0:	78 5b                	js     802efd <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802ea2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea5:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+  802eab:	39 08                	cmp    %ecx,(%eax)
+  802ead:	75 55                	jne    802f04 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802eaf:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802eb3:	74 56                	je     802f0b <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802eb5:	83 ec 0c             	sub    $0xc,%esp
+  802eb8:	68 44 88 80 00       	push   $0x808844
+  802ebd:	e8 04 1f 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802ec2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ec5:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ec8:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.allocate.req_offset = offset;
+  802ecd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed0:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.allocate.req_len = len;
+  802ed5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ed8:	a3 08 90 80 00       	mov    %eax,0x809008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ee2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802ee7:	e8 d1 fb ff ff       	call   802abd <fsipc>
+  802eec:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802eee:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  802ef5:	e8 39 1f 00 00       	call   804e33 <mutex_unlock>
+	return r;
+  802efa:	83 c4 10             	add    $0x10,%esp
+}
+  802efd:	89 d8                	mov    %ebx,%eax
+  802eff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f02:	c9                   	leave
+  802f03:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f04:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802f09:	eb f2                	jmp    802efd <fallocate+0x77>
+		return -E_INVAL;
+  802f0b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802f10:	eb eb                	jmp    802efd <fallocate+0x77>
+
+00802f12 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	56                   	push   %esi
+  802f16:	53                   	push   %ebx
+  802f17:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802f1a:	89 f3                	mov    %esi,%ebx
+  802f1c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802f22:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802f25:	eb 06                	jmp    802f2d <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802f27:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802f2d:	39 f3                	cmp    %esi,%ebx
+  802f2f:	73 14                	jae    802f45 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802f31:	83 ec 08             	sub    $0x8,%esp
+  802f34:	53                   	push   %ebx
+  802f35:	6a 00                	push   $0x0
+  802f37:	e8 7c e9 ff ff       	call   8018b8 <sys_page_unmap>
+  802f3c:	83 c4 10             	add    $0x10,%esp
+  802f3f:	85 c0                	test   %eax,%eax
+  802f41:	79 e4                	jns    802f27 <munmap+0x15>
+  802f43:	eb 05                	jmp    802f4a <munmap+0x38>
+			return r;
+	return 0;
+  802f45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f4d:	5b                   	pop    %ebx
+  802f4e:	5e                   	pop    %esi
+  802f4f:	5d                   	pop    %ebp
+  802f50:	c3                   	ret
+
+00802f51 <mmap>:
+{
+  802f51:	55                   	push   %ebp
+  802f52:	89 e5                	mov    %esp,%ebp
+  802f54:	57                   	push   %edi
+  802f55:	56                   	push   %esi
+  802f56:	53                   	push   %ebx
+  802f57:	83 ec 24             	sub    $0x24,%esp
+  802f5a:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802f5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f60:	50                   	push   %eax
+  802f61:	ff 75 08             	push   0x8(%ebp)
+  802f64:	e8 9a f5 ff ff       	call   802503 <fd_lookup>
+  802f69:	83 c4 10             	add    $0x10,%esp
+  802f6c:	85 c0                	test   %eax,%eax
+  802f6e:	0f 88 37 01 00 00    	js     8030ab <mmap+0x15a>
+		return NULL;
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802f79:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f7c:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+  802f82:	39 0a                	cmp    %ecx,(%edx)
+  802f84:	0f 85 05 01 00 00    	jne    80308f <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802f8a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802f91:	0f 85 1b 01 00 00    	jne    8030b2 <mmap+0x161>
+  802f97:	89 f0                	mov    %esi,%eax
+  802f99:	83 e8 01             	sub    $0x1,%eax
+  802f9c:	0f 88 17 01 00 00    	js     8030b9 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802fa2:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802fa6:	75 28                	jne    802fd0 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802fa8:	83 ec 0c             	sub    $0xc,%esp
+  802fab:	68 44 88 80 00       	push   $0x808844
+  802fb0:	e8 11 1e 00 00       	call   804dc6 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802fb5:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802fbb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802fc1:	83 c4 10             	add    $0x10,%esp
+  802fc4:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802fc9:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802fce:	eb 2b                	jmp    802ffb <mmap+0xaa>
+		cow_enable();
+  802fd0:	e8 f1 ee ff ff       	call   801ec6 <cow_enable>
+  802fd5:	eb d1                	jmp    802fa8 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802fd7:	89 c2                	mov    %eax,%edx
+  802fd9:	c1 ea 0c             	shr    $0xc,%edx
+  802fdc:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802fe3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802fe9:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802fef:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802ff2:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802ff4:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802ff9:	77 25                	ja     803020 <mmap+0xcf>
+  802ffb:	89 c2                	mov    %eax,%edx
+  802ffd:	29 da                	sub    %ebx,%edx
+  802fff:	39 ca                	cmp    %ecx,%edx
+  803001:	73 3a                	jae    80303d <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  803003:	89 c2                	mov    %eax,%edx
+  803005:	c1 ea 16             	shr    $0x16,%edx
+  803008:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80300f:	f6 c2 01             	test   $0x1,%dl
+  803012:	75 c3                	jne    802fd7 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  803014:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  803019:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80301e:	eb d4                	jmp    802ff4 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  803020:	29 d8                	sub    %ebx,%eax
+  803022:	39 c8                	cmp    %ecx,%eax
+  803024:	73 17                	jae    80303d <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  803026:	83 ec 0c             	sub    $0xc,%esp
+  803029:	68 44 88 80 00       	push   $0x808844
+  80302e:	e8 00 1e 00 00       	call   804e33 <mutex_unlock>
+		return NULL;
+  803033:	83 c4 10             	add    $0x10,%esp
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303b:	eb 52                	jmp    80308f <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80303d:	85 db                	test   %ebx,%ebx
+  80303f:	74 e5                	je     803026 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803041:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803044:	8b 40 0c             	mov    0xc(%eax),%eax
+  803047:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  80304c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80304f:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_len = len;
+  803054:	89 35 08 90 80 00    	mov    %esi,0x809008
+	fsipcbuf.map.req_va = va;
+  80305a:	89 1d 0c 90 80 00    	mov    %ebx,0x80900c
+	fsipcbuf.map.req_prot = prot;
+  803060:	8b 45 14             	mov    0x14(%ebp),%eax
+  803063:	a3 10 90 80 00       	mov    %eax,0x809010
+	r = fsipc(FSREQ_MAP, NULL);
+  803068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80306d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803072:	e8 46 fa ff ff       	call   802abd <fsipc>
+  803077:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  803079:	83 ec 0c             	sub    $0xc,%esp
+  80307c:	68 44 88 80 00       	push   $0x808844
+  803081:	e8 ad 1d 00 00       	call   804e33 <mutex_unlock>
+	if (r < 0) {
+  803086:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  803089:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80308b:	85 ff                	test   %edi,%edi
+  80308d:	78 08                	js     803097 <mmap+0x146>
+}
+  80308f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803092:	5b                   	pop    %ebx
+  803093:	5e                   	pop    %esi
+  803094:	5f                   	pop    %edi
+  803095:	5d                   	pop    %ebp
+  803096:	c3                   	ret
+		munmap((void*) va, len);
+  803097:	83 ec 08             	sub    $0x8,%esp
+  80309a:	56                   	push   %esi
+  80309b:	53                   	push   %ebx
+  80309c:	e8 71 fe ff ff       	call   802f12 <munmap>
+		return NULL;
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a9:	eb e4                	jmp    80308f <mmap+0x13e>
+		return NULL;
+  8030ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b0:	eb dd                	jmp    80308f <mmap+0x13e>
+		return NULL;
+  8030b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b7:	eb d6                	jmp    80308f <mmap+0x13e>
+  8030b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030be:	eb cf                	jmp    80308f <mmap+0x13e>
+
+008030c0 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8030c0:	55                   	push   %ebp
+  8030c1:	89 e5                	mov    %esp,%ebp
+  8030c3:	53                   	push   %ebx
+  8030c4:	83 ec 10             	sub    $0x10,%esp
+  8030c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8030ca:	53                   	push   %ebx
+  8030cb:	e8 d6 e2 ff ff       	call   8013a6 <strlen>
+  8030d0:	83 c4 10             	add    $0x10,%esp
+  8030d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8030d8:	7f 42                	jg     80311c <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8030da:	83 ec 0c             	sub    $0xc,%esp
+  8030dd:	68 44 88 80 00       	push   $0x808844
+  8030e2:	e8 df 1c 00 00       	call   804dc6 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8030e7:	83 c4 08             	add    $0x8,%esp
+  8030ea:	53                   	push   %ebx
+  8030eb:	68 00 90 80 00       	push   $0x809000
+  8030f0:	e8 ec e2 ff ff       	call   8013e1 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8030f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030ff:	e8 b9 f9 ff ff       	call   802abd <fsipc>
+  803104:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  803106:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  80310d:	e8 21 1d 00 00       	call   804e33 <mutex_unlock>
+	return r;
+  803112:	83 c4 10             	add    $0x10,%esp
+}
+  803115:	89 d8                	mov    %ebx,%eax
+  803117:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80311a:	c9                   	leave
+  80311b:	c3                   	ret
+		return -E_BAD_PATH;
+  80311c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  803121:	eb f2                	jmp    803115 <remove+0x55>
+
+00803123 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	53                   	push   %ebx
+  803127:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80312a:	68 44 88 80 00       	push   $0x808844
+  80312f:	e8 92 1c 00 00       	call   804dc6 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  803134:	ba 00 00 00 00       	mov    $0x0,%edx
+  803139:	b8 08 00 00 00       	mov    $0x8,%eax
+  80313e:	e8 7a f9 ff ff       	call   802abd <fsipc>
+  803143:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  803145:	c7 04 24 44 88 80 00 	movl   $0x808844,(%esp)
+  80314c:	e8 e2 1c 00 00       	call   804e33 <mutex_unlock>
+	return r;
+}
+  803151:	89 d8                	mov    %ebx,%eax
+  803153:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803156:	c9                   	leave
+  803157:	c3                   	ret
+
+00803158 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  803158:	55                   	push   %ebp
+  803159:	89 e5                	mov    %esp,%ebp
+  80315b:	56                   	push   %esi
+  80315c:	53                   	push   %ebx
+  80315d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  803160:	83 ec 0c             	sub    $0xc,%esp
+  803163:	68 44 88 80 00       	push   $0x808844
+  803168:	e8 59 1c 00 00       	call   804dc6 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80316d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803170:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  803175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80317a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80317f:	e8 39 f9 ff ff       	call   802abd <fsipc>
+  803184:	89 c6                	mov    %eax,%esi
+  803186:	83 c4 10             	add    $0x10,%esp
+  803189:	85 db                	test   %ebx,%ebx
+  80318b:	74 7b                	je     803208 <fs_bcstat+0xb0>
+  80318d:	85 c0                	test   %eax,%eax
+  80318f:	78 77                	js     803208 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  803191:	a1 00 90 80 00       	mov    0x809000,%eax
+  803196:	89 03                	mov    %eax,(%ebx)
+  803198:	a1 04 90 80 00       	mov    0x809004,%eax
+  80319d:	89 43 04             	mov    %eax,0x4(%ebx)
+  8031a0:	a1 08 90 80 00       	mov    0x809008,%eax
+  8031a5:	89 43 08             	mov    %eax,0x8(%ebx)
+  8031a8:	a1 0c 90 80 00       	mov    0x80900c,%eax
+  8031ad:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8031b0:	a1 10 90 80 00       	mov    0x809010,%eax
+  8031b5:	89 43 10             	mov    %eax,0x10(%ebx)
+  8031b8:	a1 14 90 80 00       	mov    0x809014,%eax
+  8031bd:	89 43 14             	mov    %eax,0x14(%ebx)
+  8031c0:	a1 18 90 80 00       	mov    0x809018,%eax
+  8031c5:	89 43 18             	mov    %eax,0x18(%ebx)
+  8031c8:	a1 1c 90 80 00       	mov    0x80901c,%eax
+  8031cd:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8031d0:	a1 20 90 80 00       	mov    0x809020,%eax
+  8031d5:	89 43 20             	mov    %eax,0x20(%ebx)
+  8031d8:	a1 24 90 80 00       	mov    0x809024,%eax
+  8031dd:	89 43 24             	mov    %eax,0x24(%ebx)
+  8031e0:	a1 28 90 80 00       	mov    0x809028,%eax
+  8031e5:	89 43 28             	mov    %eax,0x28(%ebx)
+  8031e8:	a1 2c 90 80 00       	mov    0x80902c,%eax
+  8031ed:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8031f0:	a1 30 90 80 00       	mov    0x809030,%eax
+  8031f5:	89 43 30             	mov    %eax,0x30(%ebx)
+  8031f8:	a1 34 90 80 00       	mov    0x809034,%eax
+  8031fd:	89 43 34             	mov    %eax,0x34(%ebx)
+  803200:	a1 38 90 80 00       	mov    0x809038,%eax
+  803205:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  803208:	83 ec 0c             	sub    $0xc,%esp
+  80320b:	68 44 88 80 00       	push   $0x808844
+  803210:	e8 1e 1c 00 00       	call   804e33 <mutex_unlock>
+	return r;
+}
+  803215:	89 f0                	mov    %esi,%eax
+  803217:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80321a:	5b                   	pop    %ebx
+  80321b:	5e                   	pop    %esi
+  80321c:	5d                   	pop    %ebp
+  80321d:	c3                   	ret
+
+0080321e <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80321e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  803222:	7f 01                	jg     803225 <writebuf+0x7>
+  803224:	c3                   	ret
+{
+  803225:	55                   	push   %ebp
+  803226:	89 e5                	mov    %esp,%ebp
+  803228:	53                   	push   %ebx
+  803229:	83 ec 08             	sub    $0x8,%esp
+  80322c:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80322e:	ff 70 04             	push   0x4(%eax)
+  803231:	8d 40 10             	lea    0x10(%eax),%eax
+  803234:	50                   	push   %eax
+  803235:	ff 33                	push   (%ebx)
+  803237:	e8 4f f6 ff ff       	call   80288b <write>
+		if (result > 0)
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	85 c0                	test   %eax,%eax
+  803241:	7e 03                	jle    803246 <writebuf+0x28>
+			b->result += result;
+  803243:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  803246:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803249:	74 0d                	je     803258 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80324b:	85 c0                	test   %eax,%eax
+  80324d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803252:	0f 4f c2             	cmovg  %edx,%eax
+  803255:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  803258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80325b:	c9                   	leave
+  80325c:	c3                   	ret
+
+0080325d <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	53                   	push   %ebx
+  803261:	83 ec 04             	sub    $0x4,%esp
+  803264:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  803267:	8b 53 04             	mov    0x4(%ebx),%edx
+  80326a:	8d 42 01             	lea    0x1(%edx),%eax
+  80326d:	89 43 04             	mov    %eax,0x4(%ebx)
+  803270:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803273:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  803277:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80327c:	74 05                	je     803283 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80327e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803281:	c9                   	leave
+  803282:	c3                   	ret
+		writebuf(b);
+  803283:	89 d8                	mov    %ebx,%eax
+  803285:	e8 94 ff ff ff       	call   80321e <writebuf>
+		b->idx = 0;
+  80328a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  803291:	eb eb                	jmp    80327e <putch+0x21>
+
+00803293 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  803293:	55                   	push   %ebp
+  803294:	89 e5                	mov    %esp,%ebp
+  803296:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80329c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329f:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8032a5:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8032ac:	00 00 00 
+	b.result = 0;
+  8032af:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8032b6:	00 00 00 
+	b.error = 1;
+  8032b9:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8032c0:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8032c3:	ff 75 10             	push   0x10(%ebp)
+  8032c6:	ff 75 0c             	push   0xc(%ebp)
+  8032c9:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8032cf:	50                   	push   %eax
+  8032d0:	68 5d 32 80 00       	push   $0x80325d
+  8032d5:	e8 2a db ff ff       	call   800e04 <vprintfmt>
+	if (b.idx > 0)
+  8032da:	83 c4 10             	add    $0x10,%esp
+  8032dd:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8032e4:	7f 12                	jg     8032f8 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8032e6:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8032ec:	85 c0                	test   %eax,%eax
+  8032ee:	75 06                	jne    8032f6 <vfprintf+0x63>
+  8032f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8032f6:	c9                   	leave
+  8032f7:	c3                   	ret
+		writebuf(&b);
+  8032f8:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8032fe:	e8 1b ff ff ff       	call   80321e <writebuf>
+  803303:	eb e1                	jmp    8032e6 <vfprintf+0x53>
+
+00803305 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  803305:	55                   	push   %ebp
+  803306:	89 e5                	mov    %esp,%ebp
+  803308:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80330b:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80330e:	50                   	push   %eax
+  80330f:	ff 75 0c             	push   0xc(%ebp)
+  803312:	ff 75 08             	push   0x8(%ebp)
+  803315:	e8 79 ff ff ff       	call   803293 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+
+0080331c <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80331c:	55                   	push   %ebp
+  80331d:	89 e5                	mov    %esp,%ebp
+  80331f:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803322:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  803325:	50                   	push   %eax
+  803326:	ff 75 08             	push   0x8(%ebp)
+  803329:	6a 01                	push   $0x1
+  80332b:	e8 63 ff ff ff       	call   803293 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803330:	c9                   	leave
+  803331:	c3                   	ret
+
+00803332 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  803332:	55                   	push   %ebp
+  803333:	89 e5                	mov    %esp,%ebp
+  803335:	56                   	push   %esi
+  803336:	53                   	push   %ebx
+  803337:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  803339:	0f b6 10             	movzbl (%eax),%edx
+  80333c:	80 fa 72             	cmp    $0x72,%dl
+  80333f:	74 44                	je     803385 <parse_mode+0x53>
+  803341:	80 fa 77             	cmp    $0x77,%dl
+  803344:	74 4b                	je     803391 <parse_mode+0x5f>
+  803346:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80334b:	80 fa 61             	cmp    $0x61,%dl
+  80334e:	74 09                	je     803359 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  803350:	89 d8                	mov    %ebx,%eax
+  803352:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803355:	5b                   	pop    %ebx
+  803356:	5e                   	pop    %esi
+  803357:	5d                   	pop    %ebp
+  803358:	c3                   	ret
+	switch (mode[0]) {
+  803359:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80335e:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  803363:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  803365:	83 ec 08             	sub    $0x8,%esp
+  803368:	6a 2b                	push   $0x2b
+  80336a:	50                   	push   %eax
+  80336b:	e8 83 e1 ff ff       	call   8014f3 <strchr>
+  803370:	83 c4 10             	add    $0x10,%esp
+  803373:	85 c0                	test   %eax,%eax
+  803375:	74 d9                	je     803350 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  803377:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80337a:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80337d:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  803383:	eb cb                	jmp    803350 <parse_mode+0x1e>
+	switch (mode[0]) {
+  803385:	ba 01 00 00 00       	mov    $0x1,%edx
+  80338a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80338f:	eb d2                	jmp    803363 <parse_mode+0x31>
+  803391:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  803396:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80339b:	eb c6                	jmp    803363 <parse_mode+0x31>
+
+0080339d <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80339d:	55                   	push   %ebp
+  80339e:	89 e5                	mov    %esp,%ebp
+  8033a0:	57                   	push   %edi
+  8033a1:	56                   	push   %esi
+  8033a2:	53                   	push   %ebx
+  8033a3:	83 ec 1c             	sub    $0x1c,%esp
+  8033a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033a9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8033ac:	b8 44 70 80 00       	mov    $0x807044,%eax
+  8033b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8033b6:	83 c0 24             	add    $0x24,%eax
+  8033b9:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8033bd:	74 17                	je     8033d6 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8033bf:	83 c3 01             	add    $0x1,%ebx
+  8033c2:	83 fb 10             	cmp    $0x10,%ebx
+  8033c5:	75 ef                	jne    8033b6 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8033c7:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8033cc:	89 f0                	mov    %esi,%eax
+  8033ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d1:	5b                   	pop    %ebx
+  8033d2:	5e                   	pop    %esi
+  8033d3:	5f                   	pop    %edi
+  8033d4:	5d                   	pop    %ebp
+  8033d5:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8033d6:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8033dd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8033e0:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8033e3:	c1 e7 02             	shl    $0x2,%edi
+  8033e6:	8d b7 40 70 80 00    	lea    0x807040(%edi),%esi
+  8033ec:	83 ec 04             	sub    $0x4,%esp
+  8033ef:	6a 24                	push   $0x24
+  8033f1:	6a 00                	push   $0x0
+  8033f3:	56                   	push   %esi
+  8033f4:	e8 39 e1 ff ff       	call   801532 <memset>
+			streams[i].f_fd = fd;
+  8033f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8033fc:	89 8f 40 70 80 00    	mov    %ecx,0x807040(%edi)
+			streams[i].f_flags = flags;
+  803402:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803405:	01 d8                	add    %ebx,%eax
+  803407:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80340a:	89 0c 85 44 70 80 00 	mov    %ecx,0x807044(,%eax,4)
+			return &streams[i];
+  803411:	83 c4 10             	add    $0x10,%esp
+  803414:	eb b6                	jmp    8033cc <stream_alloc+0x2f>
+
+00803416 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  803416:	55                   	push   %ebp
+  803417:	89 e5                	mov    %esp,%ebp
+  803419:	53                   	push   %ebx
+  80341a:	83 ec 14             	sub    $0x14,%esp
+  80341d:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80341f:	8b 40 18             	mov    0x18(%eax),%eax
+  803422:	39 43 14             	cmp    %eax,0x14(%ebx)
+  803425:	74 4a                	je     803471 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  803427:	83 ec 08             	sub    $0x8,%esp
+  80342a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80342d:	50                   	push   %eax
+  80342e:	ff 33                	push   (%ebx)
+  803430:	e8 ce f0 ff ff       	call   802503 <fd_lookup>
+  803435:	89 c2                	mov    %eax,%edx
+  803437:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80343a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80343f:	85 d2                	test   %edx,%edx
+  803441:	78 41                	js     803484 <stream_unread+0x6e>
+  803443:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803446:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+  80344c:	39 0a                	cmp    %ecx,(%edx)
+  80344e:	75 34                	jne    803484 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  803450:	8b 43 14             	mov    0x14(%ebx),%eax
+  803453:	03 42 04             	add    0x4(%edx),%eax
+  803456:	2b 43 18             	sub    0x18(%ebx),%eax
+  803459:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80345c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  803463:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80346a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80346f:	eb 13                	jmp    803484 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  803471:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  803478:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80347f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803484:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803487:	c9                   	leave
+  803488:	c3                   	ret
+
+00803489 <stream_drain>:
+{
+  803489:	55                   	push   %ebp
+  80348a:	89 e5                	mov    %esp,%ebp
+  80348c:	56                   	push   %esi
+  80348d:	53                   	push   %ebx
+  80348e:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  803490:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803495:	eb 02                	jmp    803499 <stream_drain+0x10>
+  803497:	01 c3                	add    %eax,%ebx
+  803499:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80349c:	39 c3                	cmp    %eax,%ebx
+  80349e:	73 43                	jae    8034e3 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8034a0:	83 ec 04             	sub    $0x4,%esp
+  8034a3:	29 d8                	sub    %ebx,%eax
+  8034a5:	50                   	push   %eax
+  8034a6:	89 d8                	mov    %ebx,%eax
+  8034a8:	03 46 0c             	add    0xc(%esi),%eax
+  8034ab:	50                   	push   %eax
+  8034ac:	ff 36                	push   (%esi)
+  8034ae:	e8 d8 f3 ff ff       	call   80288b <write>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	7f dd                	jg     803497 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8034ba:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8034be:	8b 56 0c             	mov    0xc(%esi),%edx
+  8034c1:	83 ec 04             	sub    $0x4,%esp
+  8034c4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8034c7:	29 d8                	sub    %ebx,%eax
+  8034c9:	50                   	push   %eax
+  8034ca:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8034cd:	50                   	push   %eax
+  8034ce:	52                   	push   %edx
+  8034cf:	e8 93 e0 ff ff       	call   801567 <memmove>
+			f->f_wend -= done;
+  8034d4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8034d7:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8034d9:	83 c4 10             	add    $0x10,%esp
+  8034dc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8034e1:	eb 0a                	jmp    8034ed <stream_drain+0x64>
+  8034e3:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8034e8:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8034ed:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8034f0:	89 d0                	mov    %edx,%eax
+  8034f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034f5:	5b                   	pop    %ebx
+  8034f6:	5e                   	pop    %esi
+  8034f7:	5d                   	pop    %ebp
+  8034f8:	c3                   	ret
+
+008034f9 <stream_setup>:
+	if (f->f_buf)
+  8034f9:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8034fd:	74 01                	je     803500 <stream_setup+0x7>
+  8034ff:	c3                   	ret
+{
+  803500:	55                   	push   %ebp
+  803501:	89 e5                	mov    %esp,%ebp
+  803503:	53                   	push   %ebx
+  803504:	83 ec 04             	sub    $0x4,%esp
+  803507:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  803509:	8b 40 08             	mov    0x8(%eax),%eax
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	74 17                	je     803527 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  803510:	83 f8 03             	cmp    $0x3,%eax
+  803513:	75 2d                	jne    803542 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  803515:	8d 43 20             	lea    0x20(%ebx),%eax
+  803518:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80351b:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  803522:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803525:	c9                   	leave
+  803526:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  803527:	83 ec 0c             	sub    $0xc,%esp
+  80352a:	ff 33                	push   (%ebx)
+  80352c:	e8 e0 d5 ff ff       	call   800b11 <iscons>
+  803531:	83 c4 10             	add    $0x10,%esp
+  803534:	85 c0                	test   %eax,%eax
+  803536:	0f 9f c0             	setg   %al
+  803539:	0f b6 c0             	movzbl %al,%eax
+  80353c:	83 c0 01             	add    $0x1,%eax
+  80353f:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  803542:	83 ec 0c             	sub    $0xc,%esp
+  803545:	68 00 10 00 00       	push   $0x1000
+  80354a:	e8 8b 11 00 00       	call   8046da <malloc>
+  80354f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 c0                	test   %eax,%eax
+  803557:	74 bc                	je     803515 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  803559:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  803560:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  803564:	eb bc                	jmp    803522 <stream_setup+0x29>
+
+00803566 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  803566:	55                   	push   %ebp
+  803567:	89 e5                	mov    %esp,%ebp
+  803569:	53                   	push   %ebx
+  80356a:	83 ec 04             	sub    $0x4,%esp
+  80356d:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80356f:	e8 85 ff ff ff       	call   8034f9 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  803574:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  803579:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80357d:	74 3d                	je     8035bc <stream_fill+0x56>
+  80357f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  803583:	74 10                	je     803595 <stream_fill+0x2f>
+  803585:	89 d8                	mov    %ebx,%eax
+  803587:	e8 fd fe ff ff       	call   803489 <stream_drain>
+		return 0;
+  80358c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  803591:	85 c0                	test   %eax,%eax
+  803593:	78 27                	js     8035bc <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  803595:	83 ec 04             	sub    $0x4,%esp
+  803598:	ff 73 10             	push   0x10(%ebx)
+  80359b:	ff 73 0c             	push   0xc(%ebx)
+  80359e:	ff 33                	push   (%ebx)
+  8035a0:	e8 ee f1 ff ff       	call   802793 <read>
+  8035a5:	83 c4 10             	add    $0x10,%esp
+  8035a8:	85 c0                	test   %eax,%eax
+  8035aa:	7e 17                	jle    8035c3 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8035ac:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8035b0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8035b7:	89 c2                	mov    %eax,%edx
+  8035b9:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8035bc:	89 d0                	mov    %edx,%eax
+  8035be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035c1:	c9                   	leave
+  8035c2:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8035c3:	c1 f8 1f             	sar    $0x1f,%eax
+  8035c6:	83 e0 04             	and    $0x4,%eax
+  8035c9:	83 c0 04             	add    $0x4,%eax
+  8035cc:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8035cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d4:	eb e6                	jmp    8035bc <stream_fill+0x56>
+
+008035d6 <fopen>:
+{
+  8035d6:	55                   	push   %ebp
+  8035d7:	89 e5                	mov    %esp,%ebp
+  8035d9:	57                   	push   %edi
+  8035da:	56                   	push   %esi
+  8035db:	53                   	push   %ebx
+  8035dc:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8035e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8035e5:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8035eb:	89 f0                	mov    %esi,%eax
+  8035ed:	e8 40 fd ff ff       	call   803332 <parse_mode>
+		return 0;
+  8035f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8035f7:	85 c0                	test   %eax,%eax
+  8035f9:	78 2d                	js     803628 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8035fb:	83 ec 08             	sub    $0x8,%esp
+  8035fe:	50                   	push   %eax
+  8035ff:	ff 75 08             	push   0x8(%ebp)
+  803602:	e8 d4 f7 ff ff       	call   802ddb <open>
+  803607:	89 c7                	mov    %eax,%edi
+  803609:	83 c4 10             	add    $0x10,%esp
+  80360c:	85 c0                	test   %eax,%eax
+  80360e:	78 58                	js     803668 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  803610:	80 3e 61             	cmpb   $0x61,(%esi)
+  803613:	74 1d                	je     803632 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  803615:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80361b:	89 f8                	mov    %edi,%eax
+  80361d:	e8 7b fd ff ff       	call   80339d <stream_alloc>
+  803622:	89 c3                	mov    %eax,%ebx
+  803624:	85 c0                	test   %eax,%eax
+  803626:	74 32                	je     80365a <fopen+0x84>
+}
+  803628:	89 d8                	mov    %ebx,%eax
+  80362a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80362d:	5b                   	pop    %ebx
+  80362e:	5e                   	pop    %esi
+  80362f:	5f                   	pop    %edi
+  803630:	5d                   	pop    %ebp
+  803631:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  803632:	83 ec 08             	sub    $0x8,%esp
+  803635:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80363b:	50                   	push   %eax
+  80363c:	57                   	push   %edi
+  80363d:	e8 c7 f3 ff ff       	call   802a09 <fstat>
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	85 c0                	test   %eax,%eax
+  803647:	78 cc                	js     803615 <fopen+0x3f>
+		seek(fd, st.st_size);
+  803649:	83 ec 08             	sub    $0x8,%esp
+  80364c:	ff 75 dc             	push   -0x24(%ebp)
+  80364f:	57                   	push   %edi
+  803650:	e8 e2 f2 ff ff       	call   802937 <seek>
+  803655:	83 c4 10             	add    $0x10,%esp
+  803658:	eb bb                	jmp    803615 <fopen+0x3f>
+		close(fd);
+  80365a:	83 ec 0c             	sub    $0xc,%esp
+  80365d:	57                   	push   %edi
+  80365e:	e8 f4 ef ff ff       	call   802657 <close>
+  803663:	83 c4 10             	add    $0x10,%esp
+  803666:	eb c0                	jmp    803628 <fopen+0x52>
+		return 0;
+  803668:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80366d:	eb b9                	jmp    803628 <fopen+0x52>
+
+0080366f <fdopen>:
+{
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  803675:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803678:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80367b:	e8 b2 fc ff ff       	call   803332 <parse_mode>
+  803680:	89 c2                	mov    %eax,%edx
+		return 0;
+  803682:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  803687:	85 d2                	test   %edx,%edx
+  803689:	78 0b                	js     803696 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80368b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80368e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803691:	e8 07 fd ff ff       	call   80339d <stream_alloc>
+}
+  803696:	c9                   	leave
+  803697:	c3                   	ret
+
+00803698 <setvbuf>:
+{
+  803698:	55                   	push   %ebp
+  803699:	89 e5                	mov    %esp,%ebp
+  80369b:	57                   	push   %edi
+  80369c:	56                   	push   %esi
+  80369d:	53                   	push   %ebx
+  80369e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8036a7:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8036ab:	75 3a                	jne    8036e7 <setvbuf+0x4f>
+  8036ad:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8036b0:	83 fe 02             	cmp    $0x2,%esi
+  8036b3:	77 39                	ja     8036ee <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8036b5:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8036b8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8036bc:	0f 95 c3             	setne  %bl
+  8036bf:	85 ff                	test   %edi,%edi
+  8036c1:	0f 95 c1             	setne  %cl
+  8036c4:	84 cb                	test   %cl,%bl
+  8036c6:	74 05                	je     8036cd <setvbuf+0x35>
+  8036c8:	83 fa 03             	cmp    $0x3,%edx
+  8036cb:	75 0a                	jne    8036d7 <setvbuf+0x3f>
+	return 0;
+  8036cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d2:	5b                   	pop    %ebx
+  8036d3:	5e                   	pop    %esi
+  8036d4:	5f                   	pop    %edi
+  8036d5:	5d                   	pop    %ebp
+  8036d6:	c3                   	ret
+		f->f_buf = buf;
+  8036d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036da:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8036dd:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8036e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e5:	eb eb                	jmp    8036d2 <setvbuf+0x3a>
+		return EOF;
+  8036e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8036ec:	eb e4                	jmp    8036d2 <setvbuf+0x3a>
+  8036ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8036f3:	eb dd                	jmp    8036d2 <setvbuf+0x3a>
+
+008036f5 <fflush>:
+{
+  8036f5:	55                   	push   %ebp
+  8036f6:	89 e5                	mov    %esp,%ebp
+  8036f8:	57                   	push   %edi
+  8036f9:	56                   	push   %esi
+  8036fa:	53                   	push   %ebx
+  8036fb:	83 ec 0c             	sub    $0xc,%esp
+  8036fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  803701:	85 db                	test   %ebx,%ebx
+  803703:	74 1a                	je     80371f <fflush+0x2a>
+	stream_unread(f);
+  803705:	89 d8                	mov    %ebx,%eax
+  803707:	e8 0a fd ff ff       	call   803416 <stream_unread>
+	return stream_drain(f);
+  80370c:	89 d8                	mov    %ebx,%eax
+  80370e:	e8 76 fd ff ff       	call   803489 <stream_drain>
+  803713:	89 c7                	mov    %eax,%edi
+}
+  803715:	89 f8                	mov    %edi,%eax
+  803717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80371a:	5b                   	pop    %ebx
+  80371b:	5e                   	pop    %esi
+  80371c:	5f                   	pop    %edi
+  80371d:	5d                   	pop    %ebp
+  80371e:	c3                   	ret
+  80371f:	bb 40 70 80 00       	mov    $0x807040,%ebx
+  803724:	be 80 72 80 00       	mov    $0x807280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  803729:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372e:	eb 03                	jmp    803733 <fflush+0x3e>
+  803730:	83 c3 24             	add    $0x24,%ebx
+  803733:	39 f3                	cmp    %esi,%ebx
+  803735:	74 de                	je     803715 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  803737:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80373b:	74 f3                	je     803730 <fflush+0x3b>
+  80373d:	83 ec 0c             	sub    $0xc,%esp
+  803740:	53                   	push   %ebx
+  803741:	e8 af ff ff ff       	call   8036f5 <fflush>
+  803746:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803750:	0f 48 f8             	cmovs  %eax,%edi
+  803753:	eb db                	jmp    803730 <fflush+0x3b>
+
+00803755 <fclose>:
+{
+  803755:	55                   	push   %ebp
+  803756:	89 e5                	mov    %esp,%ebp
+  803758:	56                   	push   %esi
+  803759:	53                   	push   %ebx
+  80375a:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  80375d:	83 ec 0c             	sub    $0xc,%esp
+  803760:	56                   	push   %esi
+  803761:	e8 8f ff ff ff       	call   8036f5 <fflush>
+  803766:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  803768:	83 c4 04             	add    $0x4,%esp
+  80376b:	ff 36                	push   (%esi)
+  80376d:	e8 e5 ee ff ff       	call   802657 <close>
+  803772:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  803775:	85 c0                	test   %eax,%eax
+  803777:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80377c:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80377f:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  803783:	75 10                	jne    803795 <fclose+0x40>
+	f->f_flags = 0;
+  803785:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80378c:	89 d8                	mov    %ebx,%eax
+  80378e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803791:	5b                   	pop    %ebx
+  803792:	5e                   	pop    %esi
+  803793:	5d                   	pop    %ebp
+  803794:	c3                   	ret
+		free(f->f_buf);
+  803795:	83 ec 0c             	sub    $0xc,%esp
+  803798:	ff 76 0c             	push   0xc(%esi)
+  80379b:	e8 71 0e 00 00       	call   804611 <free>
+  8037a0:	83 c4 10             	add    $0x10,%esp
+  8037a3:	eb e0                	jmp    803785 <fclose+0x30>
+
+008037a5 <fileno>:
+{
+  8037a5:	55                   	push   %ebp
+  8037a6:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8037a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ab:	8b 00                	mov    (%eax),%eax
+}
+  8037ad:	5d                   	pop    %ebp
+  8037ae:	c3                   	ret
+
+008037af <feof>:
+{
+  8037af:	55                   	push   %ebp
+  8037b0:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8037b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b5:	8b 40 04             	mov    0x4(%eax),%eax
+  8037b8:	c1 e8 02             	shr    $0x2,%eax
+  8037bb:	83 e0 01             	and    $0x1,%eax
+}
+  8037be:	5d                   	pop    %ebp
+  8037bf:	c3                   	ret
+
+008037c0 <ferror>:
+{
+  8037c0:	55                   	push   %ebp
+  8037c1:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8037c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037c6:	8b 40 04             	mov    0x4(%eax),%eax
+  8037c9:	c1 e8 03             	shr    $0x3,%eax
+  8037cc:	83 e0 01             	and    $0x1,%eax
+}
+  8037cf:	5d                   	pop    %ebp
+  8037d0:	c3                   	ret
+
+008037d1 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8037d1:	55                   	push   %ebp
+  8037d2:	89 e5                	mov    %esp,%ebp
+  8037d4:	53                   	push   %ebx
+  8037d5:	83 ec 04             	sub    $0x4,%esp
+  8037d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8037db:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037de:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8037e1:	74 15                	je     8037f8 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8037e3:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8037e6:	8b 43 14             	mov    0x14(%ebx),%eax
+  8037e9:	8d 48 01             	lea    0x1(%eax),%ecx
+  8037ec:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8037ef:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8037f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037f6:	c9                   	leave
+  8037f7:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8037f8:	89 d8                	mov    %ebx,%eax
+  8037fa:	e8 67 fd ff ff       	call   803566 <stream_fill>
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	75 e0                	jne    8037e3 <fgetc+0x12>
+		return EOF;
+  803803:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803808:	eb e9                	jmp    8037f3 <fgetc+0x22>
+
+0080380a <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80380a:	55                   	push   %ebp
+  80380b:	89 e5                	mov    %esp,%ebp
+  80380d:	57                   	push   %edi
+  80380e:	56                   	push   %esi
+  80380f:	53                   	push   %ebx
+  803810:	83 ec 1c             	sub    $0x1c,%esp
+  803813:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  803816:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80381b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80381e:	83 e8 01             	sub    $0x1,%eax
+  803821:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  803824:	eb 66                	jmp    80388c <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  803826:	8b 46 14             	mov    0x14(%esi),%eax
+  803829:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80382c:	29 c3                	sub    %eax,%ebx
+  80382e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803831:	29 fa                	sub    %edi,%edx
+  803833:	39 d3                	cmp    %edx,%ebx
+  803835:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  803838:	83 ec 04             	sub    $0x4,%esp
+  80383b:	53                   	push   %ebx
+  80383c:	6a 0a                	push   $0xa
+  80383e:	03 46 0c             	add    0xc(%esi),%eax
+  803841:	50                   	push   %eax
+  803842:	e8 d1 dd ff ff       	call   801618 <memfind>
+  803847:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80384a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80384d:	8b 4e 14             	mov    0x14(%esi),%ecx
+  803850:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  803853:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  803855:	83 c4 10             	add    $0x10,%esp
+  803858:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80385b:	74 0b                	je     803868 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  80385d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803860:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803863:	29 d3                	sub    %edx,%ebx
+  803865:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  803868:	83 ec 04             	sub    $0x4,%esp
+  80386b:	53                   	push   %ebx
+  80386c:	01 c8                	add    %ecx,%eax
+  80386e:	50                   	push   %eax
+  80386f:	89 f8                	mov    %edi,%eax
+  803871:	03 45 08             	add    0x8(%ebp),%eax
+  803874:	50                   	push   %eax
+  803875:	e8 ed dc ff ff       	call   801567 <memmove>
+		f->f_rpos += m;
+  80387a:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80387d:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80387f:	83 c4 10             	add    $0x10,%esp
+  803882:	8b 45 08             	mov    0x8(%ebp),%eax
+  803885:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80388a:	74 1f                	je     8038ab <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80388c:	8d 47 01             	lea    0x1(%edi),%eax
+  80388f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  803892:	73 17                	jae    8038ab <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  803894:	8b 46 18             	mov    0x18(%esi),%eax
+  803897:	39 46 14             	cmp    %eax,0x14(%esi)
+  80389a:	75 8a                	jne    803826 <fgets+0x1c>
+  80389c:	89 f0                	mov    %esi,%eax
+  80389e:	e8 c3 fc ff ff       	call   803566 <stream_fill>
+  8038a3:	85 c0                	test   %eax,%eax
+  8038a5:	0f 85 7b ff ff ff    	jne    803826 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8038ab:	85 ff                	test   %edi,%edi
+  8038ad:	74 0f                	je     8038be <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8038af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038b2:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8038b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038b9:	5b                   	pop    %ebx
+  8038ba:	5e                   	pop    %esi
+  8038bb:	5f                   	pop    %edi
+  8038bc:	5d                   	pop    %ebp
+  8038bd:	c3                   	ret
+		return 0;
+  8038be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c3:	eb f1                	jmp    8038b6 <fgets+0xac>
+
+008038c5 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8038c5:	55                   	push   %ebp
+  8038c6:	89 e5                	mov    %esp,%ebp
+  8038c8:	57                   	push   %edi
+  8038c9:	56                   	push   %esi
+  8038ca:	53                   	push   %ebx
+  8038cb:	83 ec 1c             	sub    $0x1c,%esp
+  8038ce:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8038d1:	89 f0                	mov    %esi,%eax
+  8038d3:	e8 21 fc ff ff       	call   8034f9 <stream_setup>
+	want = size * n;
+  8038d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038db:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8038df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8038e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e7:	eb 43                	jmp    80392c <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8038e9:	29 d3                	sub    %edx,%ebx
+  8038eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038ee:	29 f8                	sub    %edi,%eax
+  8038f0:	39 c3                	cmp    %eax,%ebx
+  8038f2:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8038f5:	83 ec 04             	sub    $0x4,%esp
+  8038f8:	53                   	push   %ebx
+  8038f9:	03 56 0c             	add    0xc(%esi),%edx
+  8038fc:	52                   	push   %edx
+  8038fd:	89 f8                	mov    %edi,%eax
+  8038ff:	03 45 08             	add    0x8(%ebp),%eax
+  803902:	50                   	push   %eax
+  803903:	e8 5f dc ff ff       	call   801567 <memmove>
+			f->f_rpos += m;
+  803908:	01 5e 14             	add    %ebx,0x14(%esi)
+  80390b:	83 c4 10             	add    $0x10,%esp
+  80390e:	eb 1a                	jmp    80392a <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  803910:	83 ec 04             	sub    $0x4,%esp
+  803913:	53                   	push   %ebx
+  803914:	89 f8                	mov    %edi,%eax
+  803916:	03 45 08             	add    0x8(%ebp),%eax
+  803919:	50                   	push   %eax
+  80391a:	ff 36                	push   (%esi)
+  80391c:	e8 72 ee ff ff       	call   802793 <read>
+  803921:	89 c3                	mov    %eax,%ebx
+  803923:	83 c4 10             	add    $0x10,%esp
+  803926:	85 c0                	test   %eax,%eax
+  803928:	7e 36                	jle    803960 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80392a:	01 df                	add    %ebx,%edi
+  80392c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80392f:	39 c7                	cmp    %eax,%edi
+  803931:	73 39                	jae    80396c <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  803933:	8b 56 14             	mov    0x14(%esi),%edx
+  803936:	8b 5e 18             	mov    0x18(%esi),%ebx
+  803939:	39 da                	cmp    %ebx,%edx
+  80393b:	72 ac                	jb     8038e9 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80393d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803940:	29 fb                	sub    %edi,%ebx
+  803942:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  803945:	72 3e                	jb     803985 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  803947:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80394b:	74 1f                	je     80396c <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80394d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  803951:	74 bd                	je     803910 <fread+0x4b>
+  803953:	89 f0                	mov    %esi,%eax
+  803955:	e8 2f fb ff ff       	call   803489 <stream_drain>
+  80395a:	85 c0                	test   %eax,%eax
+  80395c:	79 b2                	jns    803910 <fread+0x4b>
+  80395e:	eb 0c                	jmp    80396c <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  803960:	c1 fb 1f             	sar    $0x1f,%ebx
+  803963:	83 e3 04             	and    $0x4,%ebx
+  803966:	83 c3 04             	add    $0x4,%ebx
+  803969:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80396c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	74 0a                	je     80397d <fread+0xb8>
+  803973:	89 f8                	mov    %edi,%eax
+  803975:	ba 00 00 00 00       	mov    $0x0,%edx
+  80397a:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80397d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803980:	5b                   	pop    %ebx
+  803981:	5e                   	pop    %esi
+  803982:	5f                   	pop    %edi
+  803983:	5d                   	pop    %ebp
+  803984:	c3                   	ret
+		} else if (!stream_fill(f))
+  803985:	89 f0                	mov    %esi,%eax
+  803987:	e8 da fb ff ff       	call   803566 <stream_fill>
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	74 dc                	je     80396c <fread+0xa7>
+			m = 0;
+  803990:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803995:	eb 93                	jmp    80392a <fread+0x65>
+
+00803997 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  803997:	55                   	push   %ebp
+  803998:	89 e5                	mov    %esp,%ebp
+  80399a:	57                   	push   %edi
+  80399b:	56                   	push   %esi
+  80399c:	53                   	push   %ebx
+  80399d:	83 ec 1c             	sub    $0x1c,%esp
+  8039a0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8039a3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039a6:	a8 02                	test   $0x2,%al
+  8039a8:	75 13                	jne    8039bd <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8039aa:	83 c8 08             	or     $0x8,%eax
+  8039ad:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8039b0:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8039b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039b8:	5b                   	pop    %ebx
+  8039b9:	5e                   	pop    %esi
+  8039ba:	5f                   	pop    %edi
+  8039bb:	5d                   	pop    %ebp
+  8039bc:	c3                   	ret
+	stream_setup(f);
+  8039bd:	89 d8                	mov    %ebx,%eax
+  8039bf:	e8 35 fb ff ff       	call   8034f9 <stream_setup>
+	want = size * n;
+  8039c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039c7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8039cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8039ce:	89 d8                	mov    %ebx,%eax
+  8039d0:	e8 41 fa ff ff       	call   803416 <stream_unread>
+	for (done = 0; done < want; ) {
+  8039d5:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8039da:	84 c0                	test   %al,%al
+  8039dc:	75 7b                	jne    803a59 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8039de:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8039e6:	39 fe                	cmp    %edi,%esi
+  8039e8:	73 24                	jae    803a0e <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8039ea:	83 ec 04             	sub    $0x4,%esp
+  8039ed:	89 f8                	mov    %edi,%eax
+  8039ef:	29 f0                	sub    %esi,%eax
+  8039f1:	50                   	push   %eax
+  8039f2:	89 f0                	mov    %esi,%eax
+  8039f4:	03 45 08             	add    0x8(%ebp),%eax
+  8039f7:	50                   	push   %eax
+  8039f8:	ff 33                	push   (%ebx)
+  8039fa:	e8 8c ee ff ff       	call   80288b <write>
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	7e 04                	jle    803a0a <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  803a06:	01 c6                	add    %eax,%esi
+  803a08:	eb dc                	jmp    8039e6 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  803a0a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  803a0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a11:	85 c0                	test   %eax,%eax
+  803a13:	74 a0                	je     8039b5 <fwrite+0x1e>
+  803a15:	89 f0                	mov    %esi,%eax
+  803a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a1c:	f7 75 0c             	divl   0xc(%ebp)
+  803a1f:	eb 94                	jmp    8039b5 <fwrite+0x1e>
+			done += r;
+  803a21:	01 c7                	add    %eax,%edi
+			continue;
+  803a23:	eb 34                	jmp    803a59 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  803a25:	8b 73 10             	mov    0x10(%ebx),%esi
+  803a28:	29 c6                	sub    %eax,%esi
+  803a2a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803a2d:	29 fa                	sub    %edi,%edx
+  803a2f:	39 d6                	cmp    %edx,%esi
+  803a31:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  803a34:	83 ec 04             	sub    $0x4,%esp
+  803a37:	56                   	push   %esi
+  803a38:	89 fa                	mov    %edi,%edx
+  803a3a:	03 55 08             	add    0x8(%ebp),%edx
+  803a3d:	52                   	push   %edx
+  803a3e:	03 43 0c             	add    0xc(%ebx),%eax
+  803a41:	50                   	push   %eax
+  803a42:	e8 20 db ff ff       	call   801567 <memmove>
+		f->f_wend += m;
+  803a47:	89 f0                	mov    %esi,%eax
+  803a49:	03 43 1c             	add    0x1c(%ebx),%eax
+  803a4c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  803a4f:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803a51:	83 c4 10             	add    $0x10,%esp
+  803a54:	3b 43 10             	cmp    0x10(%ebx),%eax
+  803a57:	74 5b                	je     803ab4 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  803a59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a5c:	39 c7                	cmp    %eax,%edi
+  803a5e:	73 2d                	jae    803a8d <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  803a60:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803a63:	85 c0                	test   %eax,%eax
+  803a65:	75 be                	jne    803a25 <fwrite+0x8e>
+  803a67:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803a6a:	29 fa                	sub    %edi,%edx
+  803a6c:	3b 53 10             	cmp    0x10(%ebx),%edx
+  803a6f:	72 b4                	jb     803a25 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  803a71:	83 ec 04             	sub    $0x4,%esp
+  803a74:	52                   	push   %edx
+  803a75:	89 f8                	mov    %edi,%eax
+  803a77:	03 45 08             	add    0x8(%ebp),%eax
+  803a7a:	50                   	push   %eax
+  803a7b:	ff 33                	push   (%ebx)
+  803a7d:	e8 09 ee ff ff       	call   80288b <write>
+  803a82:	83 c4 10             	add    $0x10,%esp
+  803a85:	85 c0                	test   %eax,%eax
+  803a87:	7f 98                	jg     803a21 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  803a89:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  803a8d:	8b 43 08             	mov    0x8(%ebx),%eax
+  803a90:	83 f8 03             	cmp    $0x3,%eax
+  803a93:	74 48                	je     803add <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803a95:	83 f8 02             	cmp    $0x2,%eax
+  803a98:	74 27                	je     803ac1 <fwrite+0x12a>
+	return size ? done / size : 0;
+  803a9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a9d:	85 c0                	test   %eax,%eax
+  803a9f:	0f 84 10 ff ff ff    	je     8039b5 <fwrite+0x1e>
+  803aa5:	89 f8                	mov    %edi,%eax
+  803aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aac:	f7 75 0c             	divl   0xc(%ebp)
+  803aaf:	e9 01 ff ff ff       	jmp    8039b5 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803ab4:	89 d8                	mov    %ebx,%eax
+  803ab6:	e8 ce f9 ff ff       	call   803489 <stream_drain>
+  803abb:	85 c0                	test   %eax,%eax
+  803abd:	79 9a                	jns    803a59 <fwrite+0xc2>
+  803abf:	eb cc                	jmp    803a8d <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803ac1:	83 ec 04             	sub    $0x4,%esp
+  803ac4:	57                   	push   %edi
+  803ac5:	6a 0a                	push   $0xa
+  803ac7:	ff 75 08             	push   0x8(%ebp)
+  803aca:	e8 49 db ff ff       	call   801618 <memfind>
+  803acf:	89 c2                	mov    %eax,%edx
+  803ad1:	89 f8                	mov    %edi,%eax
+  803ad3:	03 45 08             	add    0x8(%ebp),%eax
+  803ad6:	83 c4 10             	add    $0x10,%esp
+  803ad9:	39 c2                	cmp    %eax,%edx
+  803adb:	74 bd                	je     803a9a <fwrite+0x103>
+		stream_drain(f);
+  803add:	89 d8                	mov    %ebx,%eax
+  803adf:	e8 a5 f9 ff ff       	call   803489 <stream_drain>
+  803ae4:	eb b4                	jmp    803a9a <fwrite+0x103>
+
+00803ae6 <fputc>:
+{
+  803ae6:	55                   	push   %ebp
+  803ae7:	89 e5                	mov    %esp,%ebp
+  803ae9:	53                   	push   %ebx
+  803aea:	83 ec 14             	sub    $0x14,%esp
+  803aed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  803af0:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  803af3:	ff 75 0c             	push   0xc(%ebp)
+  803af6:	6a 01                	push   $0x1
+  803af8:	6a 01                	push   $0x1
+  803afa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803afd:	50                   	push   %eax
+  803afe:	e8 94 fe ff ff       	call   803997 <fwrite>
+  803b03:	83 c4 10             	add    $0x10,%esp
+  803b06:	0f b6 db             	movzbl %bl,%ebx
+  803b09:	83 f8 01             	cmp    $0x1,%eax
+  803b0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b11:	0f 44 c3             	cmove  %ebx,%eax
+}
+  803b14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b17:	c9                   	leave
+  803b18:	c3                   	ret
+
+00803b19 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  803b19:	55                   	push   %ebp
+  803b1a:	89 e5                	mov    %esp,%ebp
+  803b1c:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  803b1f:	ff 75 0c             	push   0xc(%ebp)
+  803b22:	ff 75 08             	push   0x8(%ebp)
+  803b25:	e8 bc ff ff ff       	call   803ae6 <fputc>
+}
+  803b2a:	83 c4 10             	add    $0x10,%esp
+  803b2d:	c9                   	leave
+  803b2e:	c3                   	ret
+
+00803b2f <fputs>:
+{
+  803b2f:	55                   	push   %ebp
+  803b30:	89 e5                	mov    %esp,%ebp
+  803b32:	56                   	push   %esi
+  803b33:	53                   	push   %ebx
+  803b34:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  803b37:	83 ec 0c             	sub    $0xc,%esp
+  803b3a:	56                   	push   %esi
+  803b3b:	e8 66 d8 ff ff       	call   8013a6 <strlen>
+  803b40:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  803b42:	ff 75 0c             	push   0xc(%ebp)
+  803b45:	50                   	push   %eax
+  803b46:	6a 01                	push   $0x1
+  803b48:	56                   	push   %esi
+  803b49:	e8 49 fe ff ff       	call   803997 <fwrite>
+  803b4e:	83 c4 20             	add    $0x20,%esp
+  803b51:	39 d8                	cmp    %ebx,%eax
+  803b53:	0f 95 c0             	setne  %al
+  803b56:	0f b6 c0             	movzbl %al,%eax
+  803b59:	f7 d8                	neg    %eax
+}
+  803b5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b5e:	5b                   	pop    %ebx
+  803b5f:	5e                   	pop    %esi
+  803b60:	5d                   	pop    %ebp
+  803b61:	c3                   	ret
+
+00803b62 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  803b62:	55                   	push   %ebp
+  803b63:	89 e5                	mov    %esp,%ebp
+  803b65:	53                   	push   %ebx
+  803b66:	83 ec 04             	sub    $0x4,%esp
+  803b69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803b6c:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803b6f:	50                   	push   %eax
+  803b70:	ff 75 0c             	push   0xc(%ebp)
+  803b73:	53                   	push   %ebx
+  803b74:	68 19 3b 80 00       	push   $0x803b19
+  803b79:	e8 86 d2 ff ff       	call   800e04 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803b7e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803b81:	c1 e0 1c             	shl    $0x1c,%eax
+  803b84:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  803b87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b8a:	c9                   	leave
+  803b8b:	c3                   	ret
+
+00803b8c <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  803b8c:	55                   	push   %ebp
+  803b8d:	89 e5                	mov    %esp,%ebp
+  803b8f:	57                   	push   %edi
+  803b90:	56                   	push   %esi
+  803b91:	53                   	push   %ebx
+  803b92:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  803b98:	6a 00                	push   $0x0
+  803b9a:	ff 75 08             	push   0x8(%ebp)
+  803b9d:	e8 39 f2 ff ff       	call   802ddb <open>
+  803ba2:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  803ba8:	83 c4 10             	add    $0x10,%esp
+  803bab:	85 c0                	test   %eax,%eax
+  803bad:	0f 88 df 04 00 00    	js     804092 <spawn+0x506>
+  803bb3:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  803bb5:	83 ec 04             	sub    $0x4,%esp
+  803bb8:	68 00 02 00 00       	push   $0x200
+  803bbd:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  803bc3:	50                   	push   %eax
+  803bc4:	51                   	push   %ecx
+  803bc5:	e8 7a ec ff ff       	call   802844 <readn>
+  803bca:	83 c4 10             	add    $0x10,%esp
+  803bcd:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803bd2:	75 5a                	jne    803c2e <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  803bd4:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  803bdb:	45 4c 46 
+  803bde:	75 4e                	jne    803c2e <spawn+0xa2>
+  803be0:	b8 07 00 00 00       	mov    $0x7,%eax
+  803be5:	cd 30                	int    $0x30
+  803be7:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  803bed:	85 c0                	test   %eax,%eax
+  803bef:	0f 88 91 04 00 00    	js     804086 <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  803bf5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803bfa:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  803bfd:	c1 e6 04             	shl    $0x4,%esi
+  803c00:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803c06:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  803c0c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803c11:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  803c13:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  803c19:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  803c1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  803c24:	be 00 00 00 00       	mov    $0x0,%esi
+  803c29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  803c2c:	eb 4b                	jmp    803c79 <spawn+0xed>
+		close(fd);
+  803c2e:	83 ec 0c             	sub    $0xc,%esp
+  803c31:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803c37:	e8 1b ea ff ff       	call   802657 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803c3c:	83 c4 0c             	add    $0xc,%esp
+  803c3f:	68 7f 45 4c 46       	push   $0x464c457f
+  803c44:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  803c4a:	68 c4 62 80 00       	push   $0x8062c4
+  803c4f:	e8 b9 d0 ff ff       	call   800d0d <cprintf>
+		return -E_NOT_EXEC;
+  803c54:	83 c4 10             	add    $0x10,%esp
+  803c57:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  803c5e:	ff ff ff 
+  803c61:	e9 2c 04 00 00       	jmp    804092 <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  803c66:	83 ec 0c             	sub    $0xc,%esp
+  803c69:	50                   	push   %eax
+  803c6a:	e8 37 d7 ff ff       	call   8013a6 <strlen>
+  803c6f:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  803c73:	83 c3 01             	add    $0x1,%ebx
+  803c76:	83 c4 10             	add    $0x10,%esp
+  803c79:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  803c7c:	85 c0                	test   %eax,%eax
+  803c7e:	75 e6                	jne    803c66 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  803c80:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  803c86:	bf 00 10 40 00       	mov    $0x401000,%edi
+  803c8b:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  803c8d:	89 fa                	mov    %edi,%edx
+  803c8f:	83 e2 fc             	and    $0xfffffffc,%edx
+  803c92:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  803c99:	29 c2                	sub    %eax,%edx
+  803c9b:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  803ca1:	8d 42 f8             	lea    -0x8(%edx),%eax
+  803ca4:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  803ca9:	0f 86 06 04 00 00    	jbe    8040b5 <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803caf:	83 ec 04             	sub    $0x4,%esp
+  803cb2:	6a 07                	push   $0x7
+  803cb4:	68 00 00 40 00       	push   $0x400000
+  803cb9:	6a 00                	push   $0x0
+  803cbb:	e8 5f db ff ff       	call   80181f <sys_page_alloc>
+  803cc0:	83 c4 10             	add    $0x10,%esp
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	0f 88 ef 03 00 00    	js     8040ba <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  803ccb:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd0:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  803cd6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803cd9:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  803cdf:	7e 32                	jle    803d13 <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  803ce1:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  803ce7:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803ced:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  803cf0:	83 ec 08             	sub    $0x8,%esp
+  803cf3:	ff 34 b3             	push   (%ebx,%esi,4)
+  803cf6:	57                   	push   %edi
+  803cf7:	e8 e5 d6 ff ff       	call   8013e1 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  803cfc:	83 c4 04             	add    $0x4,%esp
+  803cff:	ff 34 b3             	push   (%ebx,%esi,4)
+  803d02:	e8 9f d6 ff ff       	call   8013a6 <strlen>
+  803d07:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  803d0b:	83 c6 01             	add    $0x1,%esi
+  803d0e:	83 c4 10             	add    $0x10,%esp
+  803d11:	eb c6                	jmp    803cd9 <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  803d13:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  803d19:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803d1f:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  803d26:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  803d2c:	0f 85 87 00 00 00    	jne    803db9 <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  803d32:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803d38:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  803d3e:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  803d41:	89 c8                	mov    %ecx,%eax
+  803d43:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803d49:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  803d4c:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  803d51:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  803d57:	83 ec 0c             	sub    $0xc,%esp
+  803d5a:	6a 07                	push   $0x7
+  803d5c:	68 00 d0 bf ee       	push   $0xeebfd000
+  803d61:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803d67:	68 00 00 40 00       	push   $0x400000
+  803d6c:	6a 00                	push   $0x0
+  803d6e:	e8 f9 da ff ff       	call   80186c <sys_page_map>
+  803d73:	89 c3                	mov    %eax,%ebx
+  803d75:	83 c4 20             	add    $0x20,%esp
+  803d78:	85 c0                	test   %eax,%eax
+  803d7a:	0f 88 98 03 00 00    	js     804118 <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  803d80:	83 ec 08             	sub    $0x8,%esp
+  803d83:	68 00 00 40 00       	push   $0x400000
+  803d88:	6a 00                	push   $0x0
+  803d8a:	e8 29 db ff ff       	call   8018b8 <sys_page_unmap>
+  803d8f:	89 c3                	mov    %eax,%ebx
+  803d91:	83 c4 10             	add    $0x10,%esp
+  803d94:	85 c0                	test   %eax,%eax
+  803d96:	0f 88 7c 03 00 00    	js     804118 <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  803d9c:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  803da2:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dae:	89 c8                	mov    %ecx,%eax
+  803db0:	89 d1                	mov    %edx,%ecx
+  803db2:	89 c2                	mov    %eax,%edx
+  803db4:	e9 5a 01 00 00       	jmp    803f13 <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  803db9:	68 50 63 80 00       	push   $0x806350
+  803dbe:	68 d2 5b 80 00       	push   $0x805bd2
+  803dc3:	68 06 01 00 00       	push   $0x106
+  803dc8:	68 de 62 80 00       	push   $0x8062de
+  803dcd:	e8 60 ce ff ff       	call   800c32 <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803dd2:	83 ec 04             	sub    $0x4,%esp
+  803dd5:	6a 07                	push   $0x7
+  803dd7:	68 00 00 40 00       	push   $0x400000
+  803ddc:	6a 00                	push   $0x0
+  803dde:	e8 3c da ff ff       	call   80181f <sys_page_alloc>
+  803de3:	83 c4 10             	add    $0x10,%esp
+  803de6:	85 c0                	test   %eax,%eax
+  803de8:	0f 88 b2 02 00 00    	js     8040a0 <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  803dee:	83 ec 08             	sub    $0x8,%esp
+  803df1:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  803df7:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  803dfd:	01 d0                	add    %edx,%eax
+  803dff:	50                   	push   %eax
+  803e00:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803e06:	e8 2c eb ff ff       	call   802937 <seek>
+  803e0b:	83 c4 10             	add    $0x10,%esp
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	0f 88 91 02 00 00    	js     8040a7 <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  803e16:	83 ec 04             	sub    $0x4,%esp
+  803e19:	89 fa                	mov    %edi,%edx
+  803e1b:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803e21:	29 ca                	sub    %ecx,%edx
+  803e23:	89 d0                	mov    %edx,%eax
+  803e25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e2a:	39 d0                	cmp    %edx,%eax
+  803e2c:	0f 47 c2             	cmova  %edx,%eax
+  803e2f:	50                   	push   %eax
+  803e30:	68 00 00 40 00       	push   $0x400000
+  803e35:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803e3b:	e8 04 ea ff ff       	call   802844 <readn>
+  803e40:	83 c4 10             	add    $0x10,%esp
+  803e43:	85 c0                	test   %eax,%eax
+  803e45:	0f 88 63 02 00 00    	js     8040ae <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  803e4b:	83 ec 0c             	sub    $0xc,%esp
+  803e4e:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  803e54:	56                   	push   %esi
+  803e55:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803e5b:	68 00 00 40 00       	push   $0x400000
+  803e60:	6a 00                	push   $0x0
+  803e62:	e8 05 da ff ff       	call   80186c <sys_page_map>
+  803e67:	83 c4 20             	add    $0x20,%esp
+  803e6a:	85 c0                	test   %eax,%eax
+  803e6c:	78 7e                	js     803eec <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  803e6e:	83 ec 08             	sub    $0x8,%esp
+  803e71:	68 00 00 40 00       	push   $0x400000
+  803e76:	6a 00                	push   $0x0
+  803e78:	e8 3b da ff ff       	call   8018b8 <sys_page_unmap>
+  803e7d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803e80:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e86:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e8c:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  803e92:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  803e98:	39 c3                	cmp    %eax,%ebx
+  803e9a:	73 65                	jae    803f01 <spawn+0x375>
+		if (i >= filesz) {
+  803e9c:	39 fb                	cmp    %edi,%ebx
+  803e9e:	0f 82 2e ff ff ff    	jb     803dd2 <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  803ea4:	83 ec 04             	sub    $0x4,%esp
+  803ea7:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  803ead:	56                   	push   %esi
+  803eae:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803eb4:	e8 66 d9 ff ff       	call   80181f <sys_page_alloc>
+  803eb9:	83 c4 10             	add    $0x10,%esp
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	79 c0                	jns    803e80 <spawn+0x2f4>
+  803ec0:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803ec2:	83 ec 0c             	sub    $0xc,%esp
+  803ec5:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803ecb:	e8 ac d8 ff ff       	call   80177c <sys_env_destroy>
+	close(fd);
+  803ed0:	83 c4 04             	add    $0x4,%esp
+  803ed3:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803ed9:	e8 79 e7 ff ff       	call   802657 <close>
+	return r;
+  803ede:	83 c4 10             	add    $0x10,%esp
+  803ee1:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  803ee7:	e9 a6 01 00 00       	jmp    804092 <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  803eec:	50                   	push   %eax
+  803eed:	68 ea 62 80 00       	push   $0x8062ea
+  803ef2:	68 39 01 00 00       	push   $0x139
+  803ef7:	68 de 62 80 00       	push   $0x8062de
+  803efc:	e8 31 cd ff ff       	call   800c32 <_panic>
+  803f01:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  803f07:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803f0d:	83 c1 01             	add    $0x1,%ecx
+  803f10:	83 c2 20             	add    $0x20,%edx
+  803f13:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  803f1a:	39 c8                	cmp    %ecx,%eax
+  803f1c:	0f 8e 88 00 00 00    	jle    803faa <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  803f22:	83 3a 01             	cmpl   $0x1,(%edx)
+  803f25:	75 e6                	jne    803f0d <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  803f27:	8b 42 18             	mov    0x18(%edx),%eax
+  803f2a:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  803f2d:	83 f8 01             	cmp    $0x1,%eax
+  803f30:	19 c0                	sbb    %eax,%eax
+  803f32:	83 e0 fe             	and    $0xfffffffe,%eax
+  803f35:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  803f38:	8b 72 04             	mov    0x4(%edx),%esi
+  803f3b:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  803f41:	8b 7a 10             	mov    0x10(%edx),%edi
+  803f44:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  803f4a:	8b 5a 14             	mov    0x14(%edx),%ebx
+  803f4d:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  803f53:	8b 7a 08             	mov    0x8(%edx),%edi
+  803f56:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  803f5c:	89 fb                	mov    %edi,%ebx
+  803f5e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803f64:	74 1c                	je     803f82 <spawn+0x3f6>
+		va -= i;
+  803f66:	29 df                	sub    %ebx,%edi
+  803f68:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  803f6e:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  803f74:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  803f7a:	29 de                	sub    %ebx,%esi
+  803f7c:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f87:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  803f8d:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  803f93:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  803f99:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  803f9f:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  803fa5:	e9 e2 fe ff ff       	jmp    803e8c <spawn+0x300>
+	close(fd);
+  803faa:	83 ec 0c             	sub    $0xc,%esp
+  803fad:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803fb3:	e8 9f e6 ff ff       	call   802657 <close>
+  803fb8:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc0:	eb 75                	jmp    804037 <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803fc2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803fc8:	83 c6 01             	add    $0x1,%esi
+  803fcb:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  803fd1:	74 4f                	je     804022 <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  803fd3:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  803fda:	89 c2                	mov    %eax,%edx
+  803fdc:	81 e2 05 04 00 00    	and    $0x405,%edx
+  803fe2:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  803fe8:	75 d8                	jne    803fc2 <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  803fea:	89 da                	mov    %ebx,%edx
+  803fec:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  803fee:	83 ec 0c             	sub    $0xc,%esp
+  803ff1:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ff6:	50                   	push   %eax
+  803ff7:	52                   	push   %edx
+  803ff8:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803ffe:	52                   	push   %edx
+  803fff:	6a 00                	push   $0x0
+  804001:	e8 66 d8 ff ff       	call   80186c <sys_page_map>
+  804006:	83 c4 20             	add    $0x20,%esp
+  804009:	85 c0                	test   %eax,%eax
+  80400b:	79 b5                	jns    803fc2 <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  80400d:	50                   	push   %eax
+  80400e:	68 38 63 80 00       	push   $0x806338
+  804013:	68 94 00 00 00       	push   $0x94
+  804018:	68 de 62 80 00       	push   $0x8062de
+  80401d:	e8 10 cc ff ff       	call   800c32 <_panic>
+  804022:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804028:	83 c2 01             	add    $0x1,%edx
+  80402b:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  804031:	0f 84 8b 00 00 00    	je     8040c2 <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804037:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  80403e:	a8 07                	test   $0x7,%al
+  804040:	74 e6                	je     804028 <spawn+0x49c>
+  804042:	89 d6                	mov    %edx,%esi
+  804044:	c1 e6 0a             	shl    $0xa,%esi
+  804047:	89 d7                	mov    %edx,%edi
+  804049:	c1 e7 16             	shl    $0x16,%edi
+  80404c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804051:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  804057:	e9 77 ff ff ff       	jmp    803fd3 <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  80405c:	50                   	push   %eax
+  80405d:	68 07 63 80 00       	push   $0x806307
+  804062:	68 98 00 00 00       	push   $0x98
+  804067:	68 de 62 80 00       	push   $0x8062de
+  80406c:	e8 c1 cb ff ff       	call   800c32 <_panic>
+		panic("sys_env_set_status: %e", r);
+  804071:	50                   	push   %eax
+  804072:	68 21 63 80 00       	push   $0x806321
+  804077:	68 9b 00 00 00       	push   $0x9b
+  80407c:	68 de 62 80 00       	push   $0x8062de
+  804081:	e8 ac cb ff ff       	call   800c32 <_panic>
+		return r;
+  804086:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80408c:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  804092:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  804098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80409b:	5b                   	pop    %ebx
+  80409c:	5e                   	pop    %esi
+  80409d:	5f                   	pop    %edi
+  80409e:	5d                   	pop    %ebp
+  80409f:	c3                   	ret
+  8040a0:	89 c7                	mov    %eax,%edi
+  8040a2:	e9 1b fe ff ff       	jmp    803ec2 <spawn+0x336>
+  8040a7:	89 c7                	mov    %eax,%edi
+  8040a9:	e9 14 fe ff ff       	jmp    803ec2 <spawn+0x336>
+  8040ae:	89 c7                	mov    %eax,%edi
+  8040b0:	e9 0d fe ff ff       	jmp    803ec2 <spawn+0x336>
+		return -E_NO_MEM;
+  8040b5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8040ba:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8040c0:	eb d0                	jmp    804092 <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  8040c2:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  8040c9:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8040cc:	83 ec 08             	sub    $0x8,%esp
+  8040cf:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8040d5:	50                   	push   %eax
+  8040d6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8040dc:	e8 6f d8 ff ff       	call   801950 <sys_env_set_trapframe>
+  8040e1:	83 c4 10             	add    $0x10,%esp
+  8040e4:	85 c0                	test   %eax,%eax
+  8040e6:	0f 88 70 ff ff ff    	js     80405c <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8040ec:	83 ec 08             	sub    $0x8,%esp
+  8040ef:	6a 02                	push   $0x2
+  8040f1:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8040f7:	e8 08 d8 ff ff       	call   801904 <sys_env_set_status>
+  8040fc:	83 c4 10             	add    $0x10,%esp
+  8040ff:	85 c0                	test   %eax,%eax
+  804101:	0f 88 6a ff ff ff    	js     804071 <spawn+0x4e5>
+	return child;
+  804107:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80410d:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  804113:	e9 7a ff ff ff       	jmp    804092 <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  804118:	83 ec 08             	sub    $0x8,%esp
+  80411b:	68 00 00 40 00       	push   $0x400000
+  804120:	6a 00                	push   $0x0
+  804122:	e8 91 d7 ff ff       	call   8018b8 <sys_page_unmap>
+  804127:	83 c4 10             	add    $0x10,%esp
+  80412a:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  804130:	e9 5d ff ff ff       	jmp    804092 <spawn+0x506>
+
+00804135 <spawnl>:
+{
+  804135:	55                   	push   %ebp
+  804136:	89 e5                	mov    %esp,%ebp
+  804138:	56                   	push   %esi
+  804139:	53                   	push   %ebx
+	va_start(vl, arg0);
+  80413a:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  80413d:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  804142:	eb 05                	jmp    804149 <spawnl+0x14>
+		argc++;
+  804144:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  804147:	89 ca                	mov    %ecx,%edx
+  804149:	8d 4a 04             	lea    0x4(%edx),%ecx
+  80414c:	83 3a 00             	cmpl   $0x0,(%edx)
+  80414f:	75 f3                	jne    804144 <spawnl+0xf>
+	const char *argv[argc+2];
+  804151:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  804158:	83 e2 f0             	and    $0xfffffff0,%edx
+  80415b:	29 d4                	sub    %edx,%esp
+  80415d:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  804161:	89 da                	mov    %ebx,%edx
+  804163:	c1 ea 02             	shr    $0x2,%edx
+  804166:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  804169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80416c:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  804173:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80417a:	00 
+	va_start(vl, arg0);
+  80417b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80417e:	89 c2                	mov    %eax,%edx
+  804180:	b8 00 00 00 00       	mov    $0x0,%eax
+  804185:	eb 0b                	jmp    804192 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  804187:	83 c0 01             	add    $0x1,%eax
+  80418a:	8b 31                	mov    (%ecx),%esi
+  80418c:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80418f:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  804192:	39 d0                	cmp    %edx,%eax
+  804194:	75 f1                	jne    804187 <spawnl+0x52>
+	return spawn(prog, argv);
+  804196:	83 ec 08             	sub    $0x8,%esp
+  804199:	53                   	push   %ebx
+  80419a:	ff 75 08             	push   0x8(%ebp)
+  80419d:	e8 ea f9 ff ff       	call   803b8c <spawn>
+}
+  8041a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8041a5:	5b                   	pop    %ebx
+  8041a6:	5e                   	pop    %esi
+  8041a7:	5d                   	pop    %ebp
+  8041a8:	c3                   	ret
+
+008041a9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8041a9:	55                   	push   %ebp
+  8041aa:	89 e5                	mov    %esp,%ebp
+  8041ac:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8041af:	68 76 63 80 00       	push   $0x806376
+  8041b4:	ff 75 0c             	push   0xc(%ebp)
+  8041b7:	e8 25 d2 ff ff       	call   8013e1 <strcpy>
+	return 0;
+}
+  8041bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c1:	c9                   	leave
+  8041c2:	c3                   	ret
+
+008041c3 <devsock_close>:
+{
+  8041c3:	55                   	push   %ebp
+  8041c4:	89 e5                	mov    %esp,%ebp
+  8041c6:	53                   	push   %ebx
+  8041c7:	83 ec 10             	sub    $0x10,%esp
+  8041ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8041cd:	53                   	push   %ebx
+  8041ce:	e8 ee 15 00 00       	call   8057c1 <pageref>
+  8041d3:	89 c2                	mov    %eax,%edx
+  8041d5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8041d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8041dd:	83 fa 01             	cmp    $0x1,%edx
+  8041e0:	74 05                	je     8041e7 <devsock_close+0x24>
+}
+  8041e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041e5:	c9                   	leave
+  8041e6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8041e7:	83 ec 0c             	sub    $0xc,%esp
+  8041ea:	ff 73 0c             	push   0xc(%ebx)
+  8041ed:	e8 b7 02 00 00       	call   8044a9 <nsipc_close>
+  8041f2:	83 c4 10             	add    $0x10,%esp
+  8041f5:	eb eb                	jmp    8041e2 <devsock_close+0x1f>
+
+008041f7 <devsock_write>:
+{
+  8041f7:	55                   	push   %ebp
+  8041f8:	89 e5                	mov    %esp,%ebp
+  8041fa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8041fd:	6a 00                	push   $0x0
+  8041ff:	ff 75 10             	push   0x10(%ebp)
+  804202:	ff 75 0c             	push   0xc(%ebp)
+  804205:	8b 45 08             	mov    0x8(%ebp),%eax
+  804208:	ff 70 0c             	push   0xc(%eax)
+  80420b:	e8 79 03 00 00       	call   804589 <nsipc_send>
+}
+  804210:	c9                   	leave
+  804211:	c3                   	ret
+
+00804212 <devsock_read>:
+{
+  804212:	55                   	push   %ebp
+  804213:	89 e5                	mov    %esp,%ebp
+  804215:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804218:	6a 00                	push   $0x0
+  80421a:	ff 75 10             	push   0x10(%ebp)
+  80421d:	ff 75 0c             	push   0xc(%ebp)
+  804220:	8b 45 08             	mov    0x8(%ebp),%eax
+  804223:	ff 70 0c             	push   0xc(%eax)
+  804226:	e8 ef 02 00 00       	call   80451a <nsipc_recv>
+}
+  80422b:	c9                   	leave
+  80422c:	c3                   	ret
+
+0080422d <fd2sockid>:
+{
+  80422d:	55                   	push   %ebp
+  80422e:	89 e5                	mov    %esp,%ebp
+  804230:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804233:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804236:	52                   	push   %edx
+  804237:	50                   	push   %eax
+  804238:	e8 c6 e2 ff ff       	call   802503 <fd_lookup>
+  80423d:	83 c4 10             	add    $0x10,%esp
+  804240:	85 c0                	test   %eax,%eax
+  804242:	78 10                	js     804254 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804244:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804247:	8b 0d 80 72 80 00    	mov    0x807280,%ecx
+  80424d:	39 08                	cmp    %ecx,(%eax)
+  80424f:	75 05                	jne    804256 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  804251:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  804254:	c9                   	leave
+  804255:	c3                   	ret
+		return -E_NOT_SUPP;
+  804256:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80425b:	eb f7                	jmp    804254 <fd2sockid+0x27>
+
+0080425d <alloc_sockfd>:
+{
+  80425d:	55                   	push   %ebp
+  80425e:	89 e5                	mov    %esp,%ebp
+  804260:	56                   	push   %esi
+  804261:	53                   	push   %ebx
+  804262:	83 ec 1c             	sub    $0x1c,%esp
+  804265:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  804267:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80426a:	50                   	push   %eax
+  80426b:	e8 3d e2 ff ff       	call   8024ad <fd_alloc>
+  804270:	89 c3                	mov    %eax,%ebx
+  804272:	83 c4 10             	add    $0x10,%esp
+  804275:	85 c0                	test   %eax,%eax
+  804277:	78 43                	js     8042bc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804279:	83 ec 04             	sub    $0x4,%esp
+  80427c:	68 07 04 00 00       	push   $0x407
+  804281:	ff 75 f4             	push   -0xc(%ebp)
+  804284:	6a 00                	push   $0x0
+  804286:	e8 94 d5 ff ff       	call   80181f <sys_page_alloc>
+  80428b:	89 c3                	mov    %eax,%ebx
+  80428d:	83 c4 10             	add    $0x10,%esp
+  804290:	85 c0                	test   %eax,%eax
+  804292:	78 28                	js     8042bc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  804294:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804297:	8b 15 80 72 80 00    	mov    0x807280,%edx
+  80429d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80429f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042a2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8042a9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8042ac:	83 ec 0c             	sub    $0xc,%esp
+  8042af:	50                   	push   %eax
+  8042b0:	e8 d1 e1 ff ff       	call   802486 <fd2num>
+  8042b5:	89 c3                	mov    %eax,%ebx
+  8042b7:	83 c4 10             	add    $0x10,%esp
+  8042ba:	eb 0c                	jmp    8042c8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8042bc:	83 ec 0c             	sub    $0xc,%esp
+  8042bf:	56                   	push   %esi
+  8042c0:	e8 e4 01 00 00       	call   8044a9 <nsipc_close>
+		return r;
+  8042c5:	83 c4 10             	add    $0x10,%esp
+}
+  8042c8:	89 d8                	mov    %ebx,%eax
+  8042ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042cd:	5b                   	pop    %ebx
+  8042ce:	5e                   	pop    %esi
+  8042cf:	5d                   	pop    %ebp
+  8042d0:	c3                   	ret
+
+008042d1 <accept>:
+{
+  8042d1:	55                   	push   %ebp
+  8042d2:	89 e5                	mov    %esp,%ebp
+  8042d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8042d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042da:	e8 4e ff ff ff       	call   80422d <fd2sockid>
+  8042df:	85 c0                	test   %eax,%eax
+  8042e1:	78 1b                	js     8042fe <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8042e3:	83 ec 04             	sub    $0x4,%esp
+  8042e6:	ff 75 10             	push   0x10(%ebp)
+  8042e9:	ff 75 0c             	push   0xc(%ebp)
+  8042ec:	50                   	push   %eax
+  8042ed:	e8 0e 01 00 00       	call   804400 <nsipc_accept>
+  8042f2:	83 c4 10             	add    $0x10,%esp
+  8042f5:	85 c0                	test   %eax,%eax
+  8042f7:	78 05                	js     8042fe <accept+0x2d>
+	return alloc_sockfd(r);
+  8042f9:	e8 5f ff ff ff       	call   80425d <alloc_sockfd>
+}
+  8042fe:	c9                   	leave
+  8042ff:	c3                   	ret
+
+00804300 <bind>:
+{
+  804300:	55                   	push   %ebp
+  804301:	89 e5                	mov    %esp,%ebp
+  804303:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  804306:	8b 45 08             	mov    0x8(%ebp),%eax
+  804309:	e8 1f ff ff ff       	call   80422d <fd2sockid>
+  80430e:	85 c0                	test   %eax,%eax
+  804310:	78 12                	js     804324 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  804312:	83 ec 04             	sub    $0x4,%esp
+  804315:	ff 75 10             	push   0x10(%ebp)
+  804318:	ff 75 0c             	push   0xc(%ebp)
+  80431b:	50                   	push   %eax
+  80431c:	e8 31 01 00 00       	call   804452 <nsipc_bind>
+  804321:	83 c4 10             	add    $0x10,%esp
+}
+  804324:	c9                   	leave
+  804325:	c3                   	ret
+
+00804326 <shutdown>:
+{
+  804326:	55                   	push   %ebp
+  804327:	89 e5                	mov    %esp,%ebp
+  804329:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80432c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80432f:	e8 f9 fe ff ff       	call   80422d <fd2sockid>
+  804334:	85 c0                	test   %eax,%eax
+  804336:	78 0f                	js     804347 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  804338:	83 ec 08             	sub    $0x8,%esp
+  80433b:	ff 75 0c             	push   0xc(%ebp)
+  80433e:	50                   	push   %eax
+  80433f:	e8 43 01 00 00       	call   804487 <nsipc_shutdown>
+  804344:	83 c4 10             	add    $0x10,%esp
+}
+  804347:	c9                   	leave
+  804348:	c3                   	ret
+
+00804349 <connect>:
+{
+  804349:	55                   	push   %ebp
+  80434a:	89 e5                	mov    %esp,%ebp
+  80434c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80434f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804352:	e8 d6 fe ff ff       	call   80422d <fd2sockid>
+  804357:	85 c0                	test   %eax,%eax
+  804359:	78 12                	js     80436d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80435b:	83 ec 04             	sub    $0x4,%esp
+  80435e:	ff 75 10             	push   0x10(%ebp)
+  804361:	ff 75 0c             	push   0xc(%ebp)
+  804364:	50                   	push   %eax
+  804365:	e8 59 01 00 00       	call   8044c3 <nsipc_connect>
+  80436a:	83 c4 10             	add    $0x10,%esp
+}
+  80436d:	c9                   	leave
+  80436e:	c3                   	ret
+
+0080436f <listen>:
+{
+  80436f:	55                   	push   %ebp
+  804370:	89 e5                	mov    %esp,%ebp
+  804372:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  804375:	8b 45 08             	mov    0x8(%ebp),%eax
+  804378:	e8 b0 fe ff ff       	call   80422d <fd2sockid>
+  80437d:	85 c0                	test   %eax,%eax
+  80437f:	78 0f                	js     804390 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  804381:	83 ec 08             	sub    $0x8,%esp
+  804384:	ff 75 0c             	push   0xc(%ebp)
+  804387:	50                   	push   %eax
+  804388:	e8 6b 01 00 00       	call   8044f8 <nsipc_listen>
+  80438d:	83 c4 10             	add    $0x10,%esp
+}
+  804390:	c9                   	leave
+  804391:	c3                   	ret
+
+00804392 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804392:	55                   	push   %ebp
+  804393:	89 e5                	mov    %esp,%ebp
+  804395:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804398:	ff 75 10             	push   0x10(%ebp)
+  80439b:	ff 75 0c             	push   0xc(%ebp)
+  80439e:	ff 75 08             	push   0x8(%ebp)
+  8043a1:	e8 41 02 00 00       	call   8045e7 <nsipc_socket>
+  8043a6:	83 c4 10             	add    $0x10,%esp
+  8043a9:	85 c0                	test   %eax,%eax
+  8043ab:	78 05                	js     8043b2 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8043ad:	e8 ab fe ff ff       	call   80425d <alloc_sockfd>
+}
+  8043b2:	c9                   	leave
+  8043b3:	c3                   	ret
+
+008043b4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8043b4:	55                   	push   %ebp
+  8043b5:	89 e5                	mov    %esp,%ebp
+  8043b7:	53                   	push   %ebx
+  8043b8:	83 ec 04             	sub    $0x4,%esp
+  8043bb:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8043bd:	83 3d 48 88 80 00 00 	cmpl   $0x0,0x808848
+  8043c4:	74 26                	je     8043ec <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8043c6:	6a 07                	push   $0x7
+  8043c8:	68 00 a0 80 00       	push   $0x80a000
+  8043cd:	53                   	push   %ebx
+  8043ce:	ff 35 48 88 80 00    	push   0x808848
+  8043d4:	e8 53 13 00 00       	call   80572c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8043d9:	83 c4 0c             	add    $0xc,%esp
+  8043dc:	6a 00                	push   $0x0
+  8043de:	6a 00                	push   $0x0
+  8043e0:	6a 00                	push   $0x0
+  8043e2:	e8 4f 12 00 00       	call   805636 <ipc_recv>
+}
+  8043e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043ea:	c9                   	leave
+  8043eb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8043ec:	83 ec 0c             	sub    $0xc,%esp
+  8043ef:	6a 02                	push   $0x2
+  8043f1:	e8 8c 13 00 00       	call   805782 <ipc_find_env>
+  8043f6:	a3 48 88 80 00       	mov    %eax,0x808848
+  8043fb:	83 c4 10             	add    $0x10,%esp
+  8043fe:	eb c6                	jmp    8043c6 <nsipc+0x12>
+
+00804400 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804400:	55                   	push   %ebp
+  804401:	89 e5                	mov    %esp,%ebp
+  804403:	56                   	push   %esi
+  804404:	53                   	push   %ebx
+  804405:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804408:	8b 45 08             	mov    0x8(%ebp),%eax
+  80440b:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  804410:	8b 06                	mov    (%esi),%eax
+  804412:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804417:	b8 01 00 00 00       	mov    $0x1,%eax
+  80441c:	e8 93 ff ff ff       	call   8043b4 <nsipc>
+  804421:	89 c3                	mov    %eax,%ebx
+  804423:	85 c0                	test   %eax,%eax
+  804425:	79 09                	jns    804430 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  804427:	89 d8                	mov    %ebx,%eax
+  804429:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80442c:	5b                   	pop    %ebx
+  80442d:	5e                   	pop    %esi
+  80442e:	5d                   	pop    %ebp
+  80442f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804430:	83 ec 04             	sub    $0x4,%esp
+  804433:	ff 35 10 a0 80 00    	push   0x80a010
+  804439:	68 00 a0 80 00       	push   $0x80a000
+  80443e:	ff 75 0c             	push   0xc(%ebp)
+  804441:	e8 21 d1 ff ff       	call   801567 <memmove>
+		*addrlen = ret->ret_addrlen;
+  804446:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  80444b:	89 06                	mov    %eax,(%esi)
+  80444d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  804450:	eb d5                	jmp    804427 <nsipc_accept+0x27>
+
+00804452 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804452:	55                   	push   %ebp
+  804453:	89 e5                	mov    %esp,%ebp
+  804455:	53                   	push   %ebx
+  804456:	83 ec 08             	sub    $0x8,%esp
+  804459:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80445c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80445f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804464:	53                   	push   %ebx
+  804465:	ff 75 0c             	push   0xc(%ebp)
+  804468:	68 04 a0 80 00       	push   $0x80a004
+  80446d:	e8 f5 d0 ff ff       	call   801567 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  804472:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  804478:	b8 02 00 00 00       	mov    $0x2,%eax
+  80447d:	e8 32 ff ff ff       	call   8043b4 <nsipc>
+}
+  804482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804485:	c9                   	leave
+  804486:	c3                   	ret
+
+00804487 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804487:	55                   	push   %ebp
+  804488:	89 e5                	mov    %esp,%ebp
+  80448a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80448d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804490:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  804495:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804498:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  80449d:	b8 03 00 00 00       	mov    $0x3,%eax
+  8044a2:	e8 0d ff ff ff       	call   8043b4 <nsipc>
+}
+  8044a7:	c9                   	leave
+  8044a8:	c3                   	ret
+
+008044a9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8044a9:	55                   	push   %ebp
+  8044aa:	89 e5                	mov    %esp,%ebp
+  8044ac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8044af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b2:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  8044b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8044bc:	e8 f3 fe ff ff       	call   8043b4 <nsipc>
+}
+  8044c1:	c9                   	leave
+  8044c2:	c3                   	ret
+
+008044c3 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8044c3:	55                   	push   %ebp
+  8044c4:	89 e5                	mov    %esp,%ebp
+  8044c6:	53                   	push   %ebx
+  8044c7:	83 ec 08             	sub    $0x8,%esp
+  8044ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8044cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044d0:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8044d5:	53                   	push   %ebx
+  8044d6:	ff 75 0c             	push   0xc(%ebp)
+  8044d9:	68 04 a0 80 00       	push   $0x80a004
+  8044de:	e8 84 d0 ff ff       	call   801567 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8044e3:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  8044e9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8044ee:	e8 c1 fe ff ff       	call   8043b4 <nsipc>
+}
+  8044f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8044f6:	c9                   	leave
+  8044f7:	c3                   	ret
+
+008044f8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8044f8:	55                   	push   %ebp
+  8044f9:	89 e5                	mov    %esp,%ebp
+  8044fb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8044fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  804501:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  804506:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804509:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  80450e:	b8 06 00 00 00       	mov    $0x6,%eax
+  804513:	e8 9c fe ff ff       	call   8043b4 <nsipc>
+}
+  804518:	c9                   	leave
+  804519:	c3                   	ret
+
+0080451a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80451a:	55                   	push   %ebp
+  80451b:	89 e5                	mov    %esp,%ebp
+  80451d:	56                   	push   %esi
+  80451e:	53                   	push   %ebx
+  80451f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804522:	8b 45 08             	mov    0x8(%ebp),%eax
+  804525:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  80452a:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  804530:	8b 45 14             	mov    0x14(%ebp),%eax
+  804533:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804538:	b8 07 00 00 00       	mov    $0x7,%eax
+  80453d:	e8 72 fe ff ff       	call   8043b4 <nsipc>
+  804542:	89 c3                	mov    %eax,%ebx
+  804544:	85 c0                	test   %eax,%eax
+  804546:	78 22                	js     80456a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  804548:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80454d:	39 c6                	cmp    %eax,%esi
+  80454f:	0f 4e c6             	cmovle %esi,%eax
+  804552:	39 c3                	cmp    %eax,%ebx
+  804554:	7f 1d                	jg     804573 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804556:	83 ec 04             	sub    $0x4,%esp
+  804559:	53                   	push   %ebx
+  80455a:	68 00 a0 80 00       	push   $0x80a000
+  80455f:	ff 75 0c             	push   0xc(%ebp)
+  804562:	e8 00 d0 ff ff       	call   801567 <memmove>
+  804567:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80456a:	89 d8                	mov    %ebx,%eax
+  80456c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80456f:	5b                   	pop    %ebx
+  804570:	5e                   	pop    %esi
+  804571:	5d                   	pop    %ebp
+  804572:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  804573:	68 82 63 80 00       	push   $0x806382
+  804578:	68 d2 5b 80 00       	push   $0x805bd2
+  80457d:	6a 62                	push   $0x62
+  80457f:	68 97 63 80 00       	push   $0x806397
+  804584:	e8 a9 c6 ff ff       	call   800c32 <_panic>
+
+00804589 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804589:	55                   	push   %ebp
+  80458a:	89 e5                	mov    %esp,%ebp
+  80458c:	53                   	push   %ebx
+  80458d:	83 ec 04             	sub    $0x4,%esp
+  804590:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  804593:	8b 45 08             	mov    0x8(%ebp),%eax
+  804596:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  80459b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8045a1:	7f 2e                	jg     8045d1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8045a3:	83 ec 04             	sub    $0x4,%esp
+  8045a6:	53                   	push   %ebx
+  8045a7:	ff 75 0c             	push   0xc(%ebp)
+  8045aa:	68 0c a0 80 00       	push   $0x80a00c
+  8045af:	e8 b3 cf ff ff       	call   801567 <memmove>
+	nsipcbuf.send.req_size = size;
+  8045b4:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  8045ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8045bd:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  8045c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8045c7:	e8 e8 fd ff ff       	call   8043b4 <nsipc>
+}
+  8045cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8045cf:	c9                   	leave
+  8045d0:	c3                   	ret
+	assert(size < 1600);
+  8045d1:	68 a3 63 80 00       	push   $0x8063a3
+  8045d6:	68 d2 5b 80 00       	push   $0x805bd2
+  8045db:	6a 6d                	push   $0x6d
+  8045dd:	68 97 63 80 00       	push   $0x806397
+  8045e2:	e8 4b c6 ff ff       	call   800c32 <_panic>
+
+008045e7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8045e7:	55                   	push   %ebp
+  8045e8:	89 e5                	mov    %esp,%ebp
+  8045ea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8045ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045f0:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  8045f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8045f8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  8045fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  804600:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  804605:	b8 09 00 00 00       	mov    $0x9,%eax
+  80460a:	e8 a5 fd ff ff       	call   8043b4 <nsipc>
+}
+  80460f:	c9                   	leave
+  804610:	c3                   	ret
+
+00804611 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  804611:	55                   	push   %ebp
+  804612:	89 e5                	mov    %esp,%ebp
+  804614:	53                   	push   %ebx
+  804615:	83 ec 10             	sub    $0x10,%esp
+  804618:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80461b:	68 4c 88 80 00       	push   $0x80884c
+  804620:	e8 a1 07 00 00       	call   804dc6 <mutex_lock>
+	if (v == 0)
+  804625:	83 c4 10             	add    $0x10,%esp
+  804628:	85 db                	test   %ebx,%ebx
+  80462a:	0f 84 85 00 00 00    	je     8046b5 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  804630:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804636:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80463b:	77 51                	ja     80468e <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80463d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  804643:	89 d8                	mov    %ebx,%eax
+  804645:	c1 e8 0c             	shr    $0xc,%eax
+  804648:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80464f:	f6 c4 02             	test   $0x2,%ah
+  804652:	74 50                	je     8046a4 <free+0x93>
+		sys_page_unmap(0, c);
+  804654:	83 ec 08             	sub    $0x8,%esp
+  804657:	53                   	push   %ebx
+  804658:	6a 00                	push   $0x0
+  80465a:	e8 59 d2 ff ff       	call   8018b8 <sys_page_unmap>
+		c += PGSIZE;
+  80465f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  804665:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80466b:	83 c4 10             	add    $0x10,%esp
+  80466e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  804673:	76 ce                	jbe    804643 <free+0x32>
+  804675:	68 eb 63 80 00       	push   $0x8063eb
+  80467a:	68 d2 5b 80 00       	push   $0x805bd2
+  80467f:	68 82 00 00 00       	push   $0x82
+  804684:	68 de 63 80 00       	push   $0x8063de
+  804689:	e8 a4 c5 ff ff       	call   800c32 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80468e:	68 b0 63 80 00       	push   $0x8063b0
+  804693:	68 d2 5b 80 00       	push   $0x805bd2
+  804698:	6a 7b                	push   $0x7b
+  80469a:	68 de 63 80 00       	push   $0x8063de
+  80469f:	e8 8e c5 ff ff       	call   800c32 <_panic>
+	if (--(*ref) == 0)
+  8046a4:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8046aa:	83 e8 01             	sub    $0x1,%eax
+  8046ad:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8046b3:	74 15                	je     8046ca <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8046b5:	83 ec 0c             	sub    $0xc,%esp
+  8046b8:	68 4c 88 80 00       	push   $0x80884c
+  8046bd:	e8 71 07 00 00       	call   804e33 <mutex_unlock>
+}
+  8046c2:	83 c4 10             	add    $0x10,%esp
+  8046c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8046c8:	c9                   	leave
+  8046c9:	c3                   	ret
+		sys_page_unmap(0, c);
+  8046ca:	83 ec 08             	sub    $0x8,%esp
+  8046cd:	53                   	push   %ebx
+  8046ce:	6a 00                	push   $0x0
+  8046d0:	e8 e3 d1 ff ff       	call   8018b8 <sys_page_unmap>
+  8046d5:	83 c4 10             	add    $0x10,%esp
+  8046d8:	eb db                	jmp    8046b5 <free+0xa4>
+
+008046da <malloc>:
+{
+  8046da:	55                   	push   %ebp
+  8046db:	89 e5                	mov    %esp,%ebp
+  8046dd:	57                   	push   %edi
+  8046de:	56                   	push   %esi
+  8046df:	53                   	push   %ebx
+  8046e0:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8046e3:	68 4c 88 80 00       	push   $0x80884c
+  8046e8:	e8 d9 06 00 00       	call   804dc6 <mutex_lock>
+	if (mptr == 0)
+  8046ed:	8b 3d 50 88 80 00    	mov    0x808850,%edi
+  8046f3:	83 c4 10             	add    $0x10,%esp
+  8046f6:	85 ff                	test   %edi,%edi
+  8046f8:	74 6c                	je     804766 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8046fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046fd:	83 c0 03             	add    $0x3,%eax
+  804700:	83 e0 fc             	and    $0xfffffffc,%eax
+  804703:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  804705:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80470a:	0f 87 64 01 00 00    	ja     804874 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  804710:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804716:	74 30                	je     804748 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  804718:	89 f9                	mov    %edi,%ecx
+  80471a:	c1 e9 0c             	shr    $0xc,%ecx
+  80471d:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  804721:	c1 e8 0c             	shr    $0xc,%eax
+  804724:	39 c1                	cmp    %eax,%ecx
+  804726:	74 5f                	je     804787 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  804728:	83 ec 0c             	sub    $0xc,%esp
+  80472b:	57                   	push   %edi
+  80472c:	e8 e0 fe ff ff       	call   804611 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  804731:	a1 50 88 80 00       	mov    0x808850,%eax
+  804736:	05 00 10 00 00       	add    $0x1000,%eax
+  80473b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804740:	a3 50 88 80 00       	mov    %eax,0x808850
+  804745:	83 c4 10             	add    $0x10,%esp
+  804748:	8b 0d 50 88 80 00    	mov    0x808850,%ecx
+{
+  80474e:	ba 02 00 00 00       	mov    $0x2,%edx
+  804753:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  804757:	8d 7e 04             	lea    0x4(%esi),%edi
+  80475a:	89 cb                	mov    %ecx,%ebx
+  80475c:	01 f9                	add    %edi,%ecx
+  80475e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  804761:	e9 8b 00 00 00       	jmp    8047f1 <malloc+0x117>
+		mptr = mbegin;
+  804766:	c7 05 50 88 80 00 00 	movl   $0x8000000,0x808850
+  80476d:	00 00 08 
+	n = ROUNDUP(n, 4);
+  804770:	8b 45 08             	mov    0x8(%ebp),%eax
+  804773:	83 c0 03             	add    $0x3,%eax
+  804776:	83 e0 fc             	and    $0xfffffffc,%eax
+  804779:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80477b:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  804780:	76 c6                	jbe    804748 <malloc+0x6e>
+  804782:	e9 d6 00 00 00       	jmp    80485d <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  804787:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80478d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  804792:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  804796:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  804799:	a3 50 88 80 00       	mov    %eax,0x808850
+			return v;
+  80479e:	e9 ba 00 00 00       	jmp    80485d <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8047a3:	05 00 10 00 00       	add    $0x1000,%eax
+  8047a8:	39 c8                	cmp    %ecx,%eax
+  8047aa:	0f 83 cb 00 00 00    	jae    80487b <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8047b0:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8047b5:	77 22                	ja     8047d9 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8047b7:	89 c2                	mov    %eax,%edx
+  8047b9:	c1 ea 16             	shr    $0x16,%edx
+  8047bc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8047c3:	f6 c2 01             	test   $0x1,%dl
+  8047c6:	74 db                	je     8047a3 <malloc+0xc9>
+  8047c8:	89 c2                	mov    %eax,%edx
+  8047ca:	c1 ea 0c             	shr    $0xc,%edx
+  8047cd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8047d4:	f6 c2 01             	test   $0x1,%dl
+  8047d7:	74 ca                	je     8047a3 <malloc+0xc9>
+		if (mptr == mend) {
+  8047d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8047df:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8047e5:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8047e9:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8047ef:	74 04                	je     8047f5 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8047f1:	89 d8                	mov    %ebx,%eax
+  8047f3:	eb b3                	jmp    8047a8 <malloc+0xce>
+  8047f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8047f8:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8047fd:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  804801:	83 ea 01             	sub    $0x1,%edx
+  804804:	0f 85 50 ff ff ff    	jne    80475a <malloc+0x80>
+  80480a:	c7 05 50 88 80 00 00 	movl   $0x8000000,0x808850
+  804811:	00 00 08 
+				return 0;	/* out of address space */
+  804814:	bf 00 00 00 00       	mov    $0x0,%edi
+  804819:	eb 42                	jmp    80485d <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80481b:	85 db                	test   %ebx,%ebx
+  80481d:	78 1e                	js     80483d <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80481f:	83 ec 08             	sub    $0x8,%esp
+  804822:	89 d8                	mov    %ebx,%eax
+  804824:	03 05 50 88 80 00    	add    0x808850,%eax
+  80482a:	50                   	push   %eax
+  80482b:	6a 00                	push   $0x0
+  80482d:	e8 86 d0 ff ff       	call   8018b8 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  804832:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  804838:	83 c4 10             	add    $0x10,%esp
+  80483b:	eb de                	jmp    80481b <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80483d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804842:	eb 19                	jmp    80485d <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  804844:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804847:	8b 3d 50 88 80 00    	mov    0x808850,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80484d:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  804854:	00 
+	mptr += n;
+  804855:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  804858:	a3 50 88 80 00       	mov    %eax,0x808850
+	mutex_unlock(&malloc_mu);
+  80485d:	83 ec 0c             	sub    $0xc,%esp
+  804860:	68 4c 88 80 00       	push   $0x80884c
+  804865:	e8 c9 05 00 00       	call   804e33 <mutex_unlock>
+}
+  80486a:	89 f8                	mov    %edi,%eax
+  80486c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80486f:	5b                   	pop    %ebx
+  804870:	5e                   	pop    %esi
+  804871:	5f                   	pop    %edi
+  804872:	5d                   	pop    %ebp
+  804873:	c3                   	ret
+		return 0;
+  804874:	bf 00 00 00 00       	mov    $0x0,%edi
+  804879:	eb e2                	jmp    80485d <malloc+0x183>
+  80487b:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80487f:	74 06                	je     804887 <malloc+0x1ad>
+  804881:	89 1d 50 88 80 00    	mov    %ebx,0x808850
+	for (i = 0; i < n + 4; i += PGSIZE){
+  804887:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80488c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80488f:	39 fb                	cmp    %edi,%ebx
+  804891:	73 b1                	jae    804844 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  804893:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  804899:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80489c:	39 fe                	cmp    %edi,%esi
+  80489e:	0f 92 c0             	setb   %al
+  8048a1:	0f b6 c0             	movzbl %al,%eax
+  8048a4:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8048a7:	83 c8 07             	or     $0x7,%eax
+  8048aa:	50                   	push   %eax
+  8048ab:	89 d8                	mov    %ebx,%eax
+  8048ad:	03 05 50 88 80 00    	add    0x808850,%eax
+  8048b3:	50                   	push   %eax
+  8048b4:	6a 00                	push   $0x0
+  8048b6:	e8 64 cf ff ff       	call   80181f <sys_page_alloc>
+  8048bb:	83 c4 10             	add    $0x10,%esp
+  8048be:	85 c0                	test   %eax,%eax
+  8048c0:	0f 88 55 ff ff ff    	js     80481b <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8048c6:	89 f3                	mov    %esi,%ebx
+  8048c8:	eb c5                	jmp    80488f <malloc+0x1b5>
+
+008048ca <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8048ca:	55                   	push   %ebp
+  8048cb:	89 e5                	mov    %esp,%ebp
+  8048cd:	56                   	push   %esi
+  8048ce:	53                   	push   %ebx
+  8048cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8048d2:	83 ec 0c             	sub    $0xc,%esp
+  8048d5:	ff 75 08             	push   0x8(%ebp)
+  8048d8:	e8 b9 db ff ff       	call   802496 <fd2data>
+  8048dd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8048df:	83 c4 08             	add    $0x8,%esp
+  8048e2:	68 03 64 80 00       	push   $0x806403
+  8048e7:	53                   	push   %ebx
+  8048e8:	e8 f4 ca ff ff       	call   8013e1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8048ed:	8b 46 04             	mov    0x4(%esi),%eax
+  8048f0:	2b 06                	sub    (%esi),%eax
+  8048f2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8048f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8048ff:	00 00 00 
+	stat->st_dev = &devpipe;
+  804902:	c7 83 88 00 00 00 9c 	movl   $0x80729c,0x88(%ebx)
+  804909:	72 80 00 
+	return 0;
+}
+  80490c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804911:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804914:	5b                   	pop    %ebx
+  804915:	5e                   	pop    %esi
+  804916:	5d                   	pop    %ebp
+  804917:	c3                   	ret
+
+00804918 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  804918:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80491d:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  804921:	85 c9                	test   %ecx,%ecx
+  804923:	75 01                	jne    804926 <pipewake+0xe>
+  804925:	c3                   	ret
+{
+  804926:	55                   	push   %ebp
+  804927:	89 e5                	mov    %esp,%ebp
+  804929:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80492c:	68 00 04 00 00       	push   $0x400
+  804931:	52                   	push   %edx
+  804932:	e8 2c d2 ff ff       	call   801b63 <sys_futex_wake>
+  804937:	83 c4 10             	add    $0x10,%esp
+}
+  80493a:	c9                   	leave
+  80493b:	c3                   	ret
+
+0080493c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80493c:	55                   	push   %ebp
+  80493d:	89 e5                	mov    %esp,%ebp
+  80493f:	56                   	push   %esi
+  804940:	53                   	push   %ebx
+  804941:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804944:	83 ec 0c             	sub    $0xc,%esp
+  804947:	56                   	push   %esi
+  804948:	e8 49 db ff ff       	call   802496 <fd2data>
+  80494d:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80494f:	83 c4 08             	add    $0x8,%esp
+  804952:	56                   	push   %esi
+  804953:	6a 00                	push   $0x0
+  804955:	e8 5e cf ff ff       	call   8018b8 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80495a:	8d 53 04             	lea    0x4(%ebx),%edx
+  80495d:	8d 43 08             	lea    0x8(%ebx),%eax
+  804960:	e8 b3 ff ff ff       	call   804918 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  804965:	8d 43 0c             	lea    0xc(%ebx),%eax
+  804968:	89 da                	mov    %ebx,%edx
+  80496a:	e8 a9 ff ff ff       	call   804918 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80496f:	89 34 24             	mov    %esi,(%esp)
+  804972:	e8 1f db ff ff       	call   802496 <fd2data>
+  804977:	83 c4 08             	add    $0x8,%esp
+  80497a:	50                   	push   %eax
+  80497b:	6a 00                	push   $0x0
+  80497d:	e8 36 cf ff ff       	call   8018b8 <sys_page_unmap>
+}
+  804982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804985:	5b                   	pop    %ebx
+  804986:	5e                   	pop    %esi
+  804987:	5d                   	pop    %ebp
+  804988:	c3                   	ret
+
+00804989 <_pipeisclosed>:
+{
+  804989:	55                   	push   %ebp
+  80498a:	89 e5                	mov    %esp,%ebp
+  80498c:	57                   	push   %edi
+  80498d:	56                   	push   %esi
+  80498e:	53                   	push   %ebx
+  80498f:	83 ec 1c             	sub    $0x1c,%esp
+  804992:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  804995:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804997:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80499c:	eb 5d                	jmp    8049fb <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80499e:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		n = thisenv->env_runs;
+  8049a4:	8b 02                	mov    (%edx),%eax
+  8049a6:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8049a9:	83 ec 0c             	sub    $0xc,%esp
+  8049ac:	ff 75 e0             	push   -0x20(%ebp)
+  8049af:	e8 0d 0e 00 00       	call   8057c1 <pageref>
+  8049b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049b7:	89 3c 24             	mov    %edi,(%esp)
+  8049ba:	e8 02 0e 00 00       	call   8057c1 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8049bf:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8049c1:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8049c7:	83 c4 10             	add    $0x10,%esp
+  8049ca:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8049d0:	77 15                	ja     8049e7 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8049d2:	89 f2                	mov    %esi,%edx
+  8049d4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8049d6:	c1 ea 10             	shr    $0x10,%edx
+  8049d9:	74 0c                	je     8049e7 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8049db:	c1 e2 10             	shl    $0x10,%edx
+  8049de:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8049e3:	29 d1                	sub    %edx,%ecx
+  8049e5:	eb 06                	jmp    8049ed <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8049e7:	8b 0d 00 8b 80 00    	mov    0x808b00,%ecx
+		nn = thisenv->env_runs;
+  8049ed:	8b 11                	mov    (%ecx),%edx
+  8049ef:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8049f2:	39 d3                	cmp    %edx,%ebx
+  8049f4:	74 6e                	je     804a64 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8049f6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8049f9:	74 24                	je     804a1f <_pipeisclosed+0x96>
+  8049fb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8049fd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a03:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a08:	77 94                	ja     80499e <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a0a:	89 f0                	mov    %esi,%eax
+  804a0c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a0e:	c1 e8 10             	shr    $0x10,%eax
+  804a11:	74 8b                	je     80499e <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a13:	c1 e0 10             	shl    $0x10,%eax
+  804a16:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a1b:	29 c2                	sub    %eax,%edx
+  804a1d:	eb 85                	jmp    8049a4 <_pipeisclosed+0x1b>
+  804a1f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a21:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a27:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a2c:	77 18                	ja     804a46 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a2e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a33:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a35:	c1 e8 10             	shr    $0x10,%eax
+  804a38:	74 0c                	je     804a46 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a3a:	c1 e0 10             	shl    $0x10,%eax
+  804a3d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804a42:	29 c2                	sub    %eax,%edx
+  804a44:	eb 06                	jmp    804a4c <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  804a46:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804a4c:	8b 02                	mov    (%edx),%eax
+  804a4e:	8b 40 58             	mov    0x58(%eax),%eax
+  804a51:	6a 01                	push   $0x1
+  804a53:	50                   	push   %eax
+  804a54:	53                   	push   %ebx
+  804a55:	68 0a 64 80 00       	push   $0x80640a
+  804a5a:	e8 ae c2 ff ff       	call   800d0d <cprintf>
+  804a5f:	83 c4 10             	add    $0x10,%esp
+  804a62:	eb 97                	jmp    8049fb <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  804a64:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804a67:	0f 94 c0             	sete   %al
+  804a6a:	0f b6 c0             	movzbl %al,%eax
+}
+  804a6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a70:	5b                   	pop    %ebx
+  804a71:	5e                   	pop    %esi
+  804a72:	5f                   	pop    %edi
+  804a73:	5d                   	pop    %ebp
+  804a74:	c3                   	ret
+
+00804a75 <devpipe_write>:
+{
+  804a75:	55                   	push   %ebp
+  804a76:	89 e5                	mov    %esp,%ebp
+  804a78:	57                   	push   %edi
+  804a79:	56                   	push   %esi
+  804a7a:	53                   	push   %ebx
+  804a7b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  804a7e:	ff 75 08             	push   0x8(%ebp)
+  804a81:	e8 10 da ff ff       	call   802496 <fd2data>
+  804a86:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  804a88:	83 c4 10             	add    $0x10,%esp
+  804a8b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  804a92:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  804a95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a98:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804a9b:	0f 84 96 00 00 00    	je     804b37 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  804aa1:	8d 73 08             	lea    0x8(%ebx),%esi
+  804aa4:	eb 32                	jmp    804ad8 <devpipe_write+0x63>
+  804aa6:	89 fa                	mov    %edi,%edx
+  804aa8:	89 f0                	mov    %esi,%eax
+  804aaa:	e8 69 fe ff ff       	call   804918 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  804aaf:	8b 43 04             	mov    0x4(%ebx),%eax
+  804ab2:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  804ab5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804aba:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  804abf:	83 ec 04             	sub    $0x4,%esp
+  804ac2:	6a 0a                	push   $0xa
+  804ac4:	50                   	push   %eax
+  804ac5:	53                   	push   %ebx
+  804ac6:	e8 69 d0 ff ff       	call   801b34 <sys_futex_wait>
+  804acb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804ad0:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  804ad5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  804ad8:	8b 43 04             	mov    0x4(%ebx),%eax
+  804adb:	8b 0b                	mov    (%ebx),%ecx
+  804add:	8d 51 20             	lea    0x20(%ecx),%edx
+  804ae0:	39 d0                	cmp    %edx,%eax
+  804ae2:	72 1b                	jb     804aff <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  804ae4:	89 da                	mov    %ebx,%edx
+  804ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ae9:	e8 9b fe ff ff       	call   804989 <_pipeisclosed>
+  804aee:	85 c0                	test   %eax,%eax
+  804af0:	74 b4                	je     804aa6 <devpipe_write+0x31>
+				return 0;
+  804af2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804af7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804afa:	5b                   	pop    %ebx
+  804afb:	5e                   	pop    %esi
+  804afc:	5f                   	pop    %edi
+  804afd:	5d                   	pop    %ebp
+  804afe:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804aff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804b02:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804b05:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  804b09:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  804b0c:	89 c2                	mov    %eax,%edx
+  804b0e:	c1 fa 1f             	sar    $0x1f,%edx
+  804b11:	89 d1                	mov    %edx,%ecx
+  804b13:	c1 e9 1b             	shr    $0x1b,%ecx
+  804b16:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  804b19:	83 e2 1f             	and    $0x1f,%edx
+  804b1c:	29 ca                	sub    %ecx,%edx
+  804b1e:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  804b22:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  804b26:	83 c0 01             	add    $0x1,%eax
+  804b29:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  804b2c:	83 c6 01             	add    $0x1,%esi
+  804b2f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804b32:	e9 5e ff ff ff       	jmp    804a95 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  804b37:	8d 53 04             	lea    0x4(%ebx),%edx
+  804b3a:	8d 43 08             	lea    0x8(%ebx),%eax
+  804b3d:	e8 d6 fd ff ff       	call   804918 <pipewake>
+	return i;
+  804b42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804b45:	eb b0                	jmp    804af7 <devpipe_write+0x82>
+
+00804b47 <devpipe_read>:
+{
+  804b47:	55                   	push   %ebp
+  804b48:	89 e5                	mov    %esp,%ebp
+  804b4a:	57                   	push   %edi
+  804b4b:	56                   	push   %esi
+  804b4c:	53                   	push   %ebx
+  804b4d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  804b50:	ff 75 08             	push   0x8(%ebp)
+  804b53:	e8 3e d9 ff ff       	call   802496 <fd2data>
+  804b58:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  804b5a:	83 c4 10             	add    $0x10,%esp
+  804b5d:	be 00 00 00 00       	mov    $0x0,%esi
+  804b62:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804b65:	74 6c                	je     804bd3 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  804b67:	8d 7b 04             	lea    0x4(%ebx),%edi
+  804b6a:	eb 25                	jmp    804b91 <devpipe_read+0x4a>
+  804b6c:	8b 13                	mov    (%ebx),%edx
+  804b6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b73:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  804b78:	83 ec 04             	sub    $0x4,%esp
+  804b7b:	6a 0a                	push   $0xa
+  804b7d:	52                   	push   %edx
+  804b7e:	57                   	push   %edi
+  804b7f:	e8 b0 cf ff ff       	call   801b34 <sys_futex_wait>
+  804b84:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804b89:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  804b8e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  804b91:	8b 03                	mov    (%ebx),%eax
+  804b93:	3b 43 04             	cmp    0x4(%ebx),%eax
+  804b96:	75 19                	jne    804bb1 <devpipe_read+0x6a>
+			if (i > 0)
+  804b98:	85 f6                	test   %esi,%esi
+  804b9a:	75 3a                	jne    804bd6 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  804b9c:	89 da                	mov    %ebx,%edx
+  804b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ba1:	e8 e3 fd ff ff       	call   804989 <_pipeisclosed>
+  804ba6:	85 c0                	test   %eax,%eax
+  804ba8:	74 c2                	je     804b6c <devpipe_read+0x25>
+				return 0;
+  804baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804baf:	eb 31                	jmp    804be2 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804bb1:	89 c1                	mov    %eax,%ecx
+  804bb3:	c1 f9 1f             	sar    $0x1f,%ecx
+  804bb6:	c1 e9 1b             	shr    $0x1b,%ecx
+  804bb9:	01 c8                	add    %ecx,%eax
+  804bbb:	83 e0 1f             	and    $0x1f,%eax
+  804bbe:	29 c8                	sub    %ecx,%eax
+  804bc0:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  804bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804bc8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  804bcb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  804bce:	83 c6 01             	add    $0x1,%esi
+  804bd1:	eb 8f                	jmp    804b62 <devpipe_read+0x1b>
+out:
+  804bd3:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  804bd6:	8d 43 0c             	lea    0xc(%ebx),%eax
+  804bd9:	89 da                	mov    %ebx,%edx
+  804bdb:	e8 38 fd ff ff       	call   804918 <pipewake>
+	return i;
+  804be0:	89 f0                	mov    %esi,%eax
+}
+  804be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804be5:	5b                   	pop    %ebx
+  804be6:	5e                   	pop    %esi
+  804be7:	5f                   	pop    %edi
+  804be8:	5d                   	pop    %ebp
+  804be9:	c3                   	ret
+
+00804bea <pipe>:
+{
+  804bea:	55                   	push   %ebp
+  804beb:	89 e5                	mov    %esp,%ebp
+  804bed:	56                   	push   %esi
+  804bee:	53                   	push   %ebx
+  804bef:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804bf2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804bf5:	50                   	push   %eax
+  804bf6:	e8 b2 d8 ff ff       	call   8024ad <fd_alloc>
+  804bfb:	89 c3                	mov    %eax,%ebx
+  804bfd:	83 c4 10             	add    $0x10,%esp
+  804c00:	85 c0                	test   %eax,%eax
+  804c02:	0f 88 23 01 00 00    	js     804d2b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c08:	83 ec 04             	sub    $0x4,%esp
+  804c0b:	68 07 04 00 00       	push   $0x407
+  804c10:	ff 75 f4             	push   -0xc(%ebp)
+  804c13:	6a 00                	push   $0x0
+  804c15:	e8 05 cc ff ff       	call   80181f <sys_page_alloc>
+  804c1a:	89 c3                	mov    %eax,%ebx
+  804c1c:	83 c4 10             	add    $0x10,%esp
+  804c1f:	85 c0                	test   %eax,%eax
+  804c21:	0f 88 04 01 00 00    	js     804d2b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804c27:	83 ec 0c             	sub    $0xc,%esp
+  804c2a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804c2d:	50                   	push   %eax
+  804c2e:	e8 7a d8 ff ff       	call   8024ad <fd_alloc>
+  804c33:	89 c3                	mov    %eax,%ebx
+  804c35:	83 c4 10             	add    $0x10,%esp
+  804c38:	85 c0                	test   %eax,%eax
+  804c3a:	0f 88 db 00 00 00    	js     804d1b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c40:	83 ec 04             	sub    $0x4,%esp
+  804c43:	68 07 04 00 00       	push   $0x407
+  804c48:	ff 75 f0             	push   -0x10(%ebp)
+  804c4b:	6a 00                	push   $0x0
+  804c4d:	e8 cd cb ff ff       	call   80181f <sys_page_alloc>
+  804c52:	89 c3                	mov    %eax,%ebx
+  804c54:	83 c4 10             	add    $0x10,%esp
+  804c57:	85 c0                	test   %eax,%eax
+  804c59:	0f 88 bc 00 00 00    	js     804d1b <pipe+0x131>
+	va = fd2data(fd0);
+  804c5f:	83 ec 0c             	sub    $0xc,%esp
+  804c62:	ff 75 f4             	push   -0xc(%ebp)
+  804c65:	e8 2c d8 ff ff       	call   802496 <fd2data>
+  804c6a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c6c:	83 c4 0c             	add    $0xc,%esp
+  804c6f:	68 07 04 00 00       	push   $0x407
+  804c74:	50                   	push   %eax
+  804c75:	6a 00                	push   $0x0
+  804c77:	e8 a3 cb ff ff       	call   80181f <sys_page_alloc>
+  804c7c:	89 c3                	mov    %eax,%ebx
+  804c7e:	83 c4 10             	add    $0x10,%esp
+  804c81:	85 c0                	test   %eax,%eax
+  804c83:	0f 88 82 00 00 00    	js     804d0b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c89:	83 ec 0c             	sub    $0xc,%esp
+  804c8c:	ff 75 f0             	push   -0x10(%ebp)
+  804c8f:	e8 02 d8 ff ff       	call   802496 <fd2data>
+  804c94:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804c9b:	50                   	push   %eax
+  804c9c:	6a 00                	push   $0x0
+  804c9e:	56                   	push   %esi
+  804c9f:	6a 00                	push   $0x0
+  804ca1:	e8 c6 cb ff ff       	call   80186c <sys_page_map>
+  804ca6:	89 c3                	mov    %eax,%ebx
+  804ca8:	83 c4 20             	add    $0x20,%esp
+  804cab:	85 c0                	test   %eax,%eax
+  804cad:	78 4e                	js     804cfd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  804caf:	a1 9c 72 80 00       	mov    0x80729c,%eax
+  804cb4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804cb7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804cb9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804cbc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804cc3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804cc6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804cc8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ccb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804cd2:	83 ec 0c             	sub    $0xc,%esp
+  804cd5:	ff 75 f4             	push   -0xc(%ebp)
+  804cd8:	e8 a9 d7 ff ff       	call   802486 <fd2num>
+  804cdd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804ce0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804ce2:	83 c4 04             	add    $0x4,%esp
+  804ce5:	ff 75 f0             	push   -0x10(%ebp)
+  804ce8:	e8 99 d7 ff ff       	call   802486 <fd2num>
+  804ced:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804cf0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804cf3:	83 c4 10             	add    $0x10,%esp
+  804cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804cfb:	eb 2e                	jmp    804d2b <pipe+0x141>
+	sys_page_unmap(0, va);
+  804cfd:	83 ec 08             	sub    $0x8,%esp
+  804d00:	56                   	push   %esi
+  804d01:	6a 00                	push   $0x0
+  804d03:	e8 b0 cb ff ff       	call   8018b8 <sys_page_unmap>
+  804d08:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  804d0b:	83 ec 08             	sub    $0x8,%esp
+  804d0e:	ff 75 f0             	push   -0x10(%ebp)
+  804d11:	6a 00                	push   $0x0
+  804d13:	e8 a0 cb ff ff       	call   8018b8 <sys_page_unmap>
+  804d18:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  804d1b:	83 ec 08             	sub    $0x8,%esp
+  804d1e:	ff 75 f4             	push   -0xc(%ebp)
+  804d21:	6a 00                	push   $0x0
+  804d23:	e8 90 cb ff ff       	call   8018b8 <sys_page_unmap>
+  804d28:	83 c4 10             	add    $0x10,%esp
+}
+  804d2b:	89 d8                	mov    %ebx,%eax
+  804d2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d30:	5b                   	pop    %ebx
+  804d31:	5e                   	pop    %esi
+  804d32:	5d                   	pop    %ebp
+  804d33:	c3                   	ret
+
+00804d34 <pipeisclosed>:
+{
+  804d34:	55                   	push   %ebp
+  804d35:	89 e5                	mov    %esp,%ebp
+  804d37:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804d3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d3d:	50                   	push   %eax
+  804d3e:	ff 75 08             	push   0x8(%ebp)
+  804d41:	e8 bd d7 ff ff       	call   802503 <fd_lookup>
+  804d46:	83 c4 10             	add    $0x10,%esp
+  804d49:	85 c0                	test   %eax,%eax
+  804d4b:	78 18                	js     804d65 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  804d4d:	83 ec 0c             	sub    $0xc,%esp
+  804d50:	ff 75 f4             	push   -0xc(%ebp)
+  804d53:	e8 3e d7 ff ff       	call   802496 <fd2data>
+  804d58:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  804d5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d5d:	e8 27 fc ff ff       	call   804989 <_pipeisclosed>
+  804d62:	83 c4 10             	add    $0x10,%esp
+}
+  804d65:	c9                   	leave
+  804d66:	c3                   	ret
+
+00804d67 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804d67:	55                   	push   %ebp
+  804d68:	89 e5                	mov    %esp,%ebp
+  804d6a:	56                   	push   %esi
+  804d6b:	53                   	push   %ebx
+  804d6c:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  804d6f:	85 f6                	test   %esi,%esi
+  804d71:	74 15                	je     804d88 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  804d73:	89 f0                	mov    %esi,%eax
+  804d75:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804d7a:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  804d7d:	c1 e3 04             	shl    $0x4,%ebx
+  804d80:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804d86:	eb 1b                	jmp    804da3 <wait+0x3c>
+	assert(envid != 0);
+  804d88:	68 22 64 80 00       	push   $0x806422
+  804d8d:	68 d2 5b 80 00       	push   $0x805bd2
+  804d92:	6a 09                	push   $0x9
+  804d94:	68 2d 64 80 00       	push   $0x80642d
+  804d99:	e8 94 be ff ff       	call   800c32 <_panic>
+		sys_yield();
+  804d9e:	e8 50 ca ff ff       	call   8017f3 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804da3:	8b 43 48             	mov    0x48(%ebx),%eax
+  804da6:	39 f0                	cmp    %esi,%eax
+  804da8:	75 07                	jne    804db1 <wait+0x4a>
+  804daa:	8b 43 54             	mov    0x54(%ebx),%eax
+  804dad:	85 c0                	test   %eax,%eax
+  804daf:	75 ed                	jne    804d9e <wait+0x37>
+}
+  804db1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804db4:	5b                   	pop    %ebx
+  804db5:	5e                   	pop    %esi
+  804db6:	5d                   	pop    %ebp
+  804db7:	c3                   	ret
+
+00804db8 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  804db8:	55                   	push   %ebp
+  804db9:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804dbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  804dbe:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804dc4:	5d                   	pop    %ebp
+  804dc5:	c3                   	ret
+
+00804dc6 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  804dc6:	55                   	push   %ebp
+  804dc7:	89 e5                	mov    %esp,%ebp
+  804dc9:	56                   	push   %esi
+  804dca:	53                   	push   %ebx
+  804dcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dd3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804dd8:	89 d0                	mov    %edx,%eax
+  804dda:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804dde:	85 c0                	test   %eax,%eax
+  804de0:	74 2d                	je     804e0f <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  804de2:	83 f8 02             	cmp    $0x2,%eax
+  804de5:	74 08                	je     804def <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  804de7:	b8 02 00 00 00       	mov    $0x2,%eax
+  804dec:	f0 87 03             	lock xchg %eax,(%ebx)
+  804def:	be 02 00 00 00       	mov    $0x2,%esi
+  804df4:	eb 15                	jmp    804e0b <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  804df6:	83 ec 04             	sub    $0x4,%esp
+  804df9:	6a 00                	push   $0x0
+  804dfb:	6a 02                	push   $0x2
+  804dfd:	53                   	push   %ebx
+  804dfe:	e8 31 cd ff ff       	call   801b34 <sys_futex_wait>
+  804e03:	89 f0                	mov    %esi,%eax
+  804e05:	f0 87 03             	lock xchg %eax,(%ebx)
+  804e08:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  804e0b:	85 c0                	test   %eax,%eax
+  804e0d:	75 e7                	jne    804df6 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e12:	5b                   	pop    %ebx
+  804e13:	5e                   	pop    %esi
+  804e14:	5d                   	pop    %ebp
+  804e15:	c3                   	ret
+
+00804e16 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  804e16:	55                   	push   %ebp
+  804e17:	89 e5                	mov    %esp,%ebp
+  804e19:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e21:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804e26:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  804e2a:	f7 d8                	neg    %eax
+  804e2c:	19 c0                	sbb    %eax,%eax
+  804e2e:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  804e31:	5d                   	pop    %ebp
+  804e32:	c3                   	ret
+
+00804e33 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804e33:	55                   	push   %ebp
+  804e34:	89 e5                	mov    %esp,%ebp
+  804e36:	83 ec 08             	sub    $0x8,%esp
+  804e39:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  804e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e41:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804e44:	83 f8 02             	cmp    $0x2,%eax
+  804e47:	74 02                	je     804e4b <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804e49:	c9                   	leave
+  804e4a:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804e4b:	83 ec 08             	sub    $0x8,%esp
+  804e4e:	6a 01                	push   $0x1
+  804e50:	52                   	push   %edx
+  804e51:	e8 0d cd ff ff       	call   801b63 <sys_futex_wake>
+  804e56:	83 c4 10             	add    $0x10,%esp
+}
+  804e59:	eb ee                	jmp    804e49 <mutex_unlock+0x16>
+
+00804e5b <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  804e5b:	55                   	push   %ebp
+  804e5c:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  804e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e61:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804e67:	5d                   	pop    %ebp
+  804e68:	c3                   	ret
+
+00804e69 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804e69:	55                   	push   %ebp
+  804e6a:	89 e5                	mov    %esp,%ebp
+  804e6c:	57                   	push   %edi
+  804e6d:	56                   	push   %esi
+  804e6e:	53                   	push   %ebx
+  804e6f:	83 ec 18             	sub    $0x18,%esp
+  804e72:	8b 75 08             	mov    0x8(%ebp),%esi
+  804e75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  804e78:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  804e7a:	53                   	push   %ebx
+  804e7b:	e8 b3 ff ff ff       	call   804e33 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804e80:	83 c4 0c             	add    $0xc,%esp
+  804e83:	ff 75 10             	push   0x10(%ebp)
+  804e86:	57                   	push   %edi
+  804e87:	56                   	push   %esi
+  804e88:	e8 a7 cc ff ff       	call   801b34 <sys_futex_wait>
+  804e8d:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  804e8f:	83 c4 10             	add    $0x10,%esp
+  804e92:	be 02 00 00 00       	mov    $0x2,%esi
+  804e97:	eb 10                	jmp    804ea9 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  804e99:	83 ec 04             	sub    $0x4,%esp
+  804e9c:	6a 00                	push   $0x0
+  804e9e:	6a 02                	push   $0x2
+  804ea0:	53                   	push   %ebx
+  804ea1:	e8 8e cc ff ff       	call   801b34 <sys_futex_wait>
+  804ea6:	83 c4 10             	add    $0x10,%esp
+  804ea9:	89 f0                	mov    %esi,%eax
+  804eab:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  804eae:	85 c0                	test   %eax,%eax
+  804eb0:	75 e7                	jne    804e99 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  804eb2:	83 ff ec             	cmp    $0xffffffec,%edi
+  804eb5:	74 05                	je     804ebc <cond_timedwait+0x53>
+  804eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  804ebc:	89 f8                	mov    %edi,%eax
+  804ebe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ec1:	5b                   	pop    %ebx
+  804ec2:	5e                   	pop    %esi
+  804ec3:	5f                   	pop    %edi
+  804ec4:	5d                   	pop    %ebp
+  804ec5:	c3                   	ret
+
+00804ec6 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804ec6:	55                   	push   %ebp
+  804ec7:	89 e5                	mov    %esp,%ebp
+  804ec9:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  804ecc:	6a 00                	push   $0x0
+  804ece:	ff 75 0c             	push   0xc(%ebp)
+  804ed1:	ff 75 08             	push   0x8(%ebp)
+  804ed4:	e8 90 ff ff ff       	call   804e69 <cond_timedwait>
+}
+  804ed9:	83 c4 10             	add    $0x10,%esp
+  804edc:	c9                   	leave
+  804edd:	c3                   	ret
+
+00804ede <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804ede:	55                   	push   %ebp
+  804edf:	89 e5                	mov    %esp,%ebp
+  804ee1:	83 ec 10             	sub    $0x10,%esp
+  804ee4:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  804ee7:	ba 01 00 00 00       	mov    $0x1,%edx
+  804eec:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  804ef0:	6a 01                	push   $0x1
+  804ef2:	50                   	push   %eax
+  804ef3:	e8 6b cc ff ff       	call   801b63 <sys_futex_wake>
+}
+  804ef8:	83 c4 10             	add    $0x10,%esp
+  804efb:	c9                   	leave
+  804efc:	c3                   	ret
+
+00804efd <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804efd:	55                   	push   %ebp
+  804efe:	89 e5                	mov    %esp,%ebp
+  804f00:	83 ec 10             	sub    $0x10,%esp
+  804f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f06:	ba 01 00 00 00       	mov    $0x1,%edx
+  804f0b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  804f0f:	68 00 04 00 00       	push   $0x400
+  804f14:	50                   	push   %eax
+  804f15:	e8 49 cc ff ff       	call   801b63 <sys_futex_wake>
+}
+  804f1a:	83 c4 10             	add    $0x10,%esp
+  804f1d:	c9                   	leave
+  804f1e:	c3                   	ret
+
+00804f1f <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  804f1f:	55                   	push   %ebp
+  804f20:	89 e5                	mov    %esp,%ebp
+  804f22:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  804f25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804f28:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  804f2a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804f31:	5d                   	pop    %ebp
+  804f32:	c3                   	ret
+
+00804f33 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  804f33:	55                   	push   %ebp
+  804f34:	89 e5                	mov    %esp,%ebp
+  804f36:	53                   	push   %ebx
+  804f37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  804f3a:	8b 11                	mov    (%ecx),%edx
+  804f3c:	85 d2                	test   %edx,%edx
+  804f3e:	74 14                	je     804f54 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  804f40:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804f43:	89 d0                	mov    %edx,%eax
+  804f45:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  804f49:	39 c2                	cmp    %eax,%edx
+  804f4b:	75 ed                	jne    804f3a <sem_trywait+0x7>
+			return 0;
+  804f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f52:	eb 05                	jmp    804f59 <sem_trywait+0x26>
+	return -E_AGAIN;
+  804f54:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  804f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804f5c:	c9                   	leave
+  804f5d:	c3                   	ret
+
+00804f5e <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  804f5e:	55                   	push   %ebp
+  804f5f:	89 e5                	mov    %esp,%ebp
+  804f61:	57                   	push   %edi
+  804f62:	56                   	push   %esi
+  804f63:	53                   	push   %ebx
+  804f64:	83 ec 1c             	sub    $0x1c,%esp
+  804f67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804f6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  804f6d:	e8 3a cb ff ff       	call   801aac <sys_time_msec>
+  804f72:	01 f8                	add    %edi,%eax
+  804f74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  804f77:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  804f7c:	eb 28                	jmp    804fa6 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  804f7e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f83:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  804f88:	83 ec 04             	sub    $0x4,%esp
+  804f8b:	56                   	push   %esi
+  804f8c:	6a 00                	push   $0x0
+  804f8e:	53                   	push   %ebx
+  804f8f:	e8 a0 cb ff ff       	call   801b34 <sys_futex_wait>
+  804f94:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  804f99:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  804f9e:	83 c4 10             	add    $0x10,%esp
+  804fa1:	83 f8 ec             	cmp    $0xffffffec,%eax
+  804fa4:	74 2e                	je     804fd4 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  804fa6:	83 ec 0c             	sub    $0xc,%esp
+  804fa9:	53                   	push   %ebx
+  804faa:	e8 84 ff ff ff       	call   804f33 <sem_trywait>
+  804faf:	83 c4 10             	add    $0x10,%esp
+  804fb2:	85 c0                	test   %eax,%eax
+  804fb4:	79 19                	jns    804fcf <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  804fb6:	85 ff                	test   %edi,%edi
+  804fb8:	74 c4                	je     804f7e <sem_timedwait+0x20>
+  804fba:	e8 ed ca ff ff       	call   801aac <sys_time_msec>
+  804fbf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804fc2:	29 c6                	sub    %eax,%esi
+  804fc4:	85 f6                	test   %esi,%esi
+  804fc6:	7f b6                	jg     804f7e <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  804fc8:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  804fcd:	eb 05                	jmp    804fd4 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  804fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fd7:	5b                   	pop    %ebx
+  804fd8:	5e                   	pop    %esi
+  804fd9:	5f                   	pop    %edi
+  804fda:	5d                   	pop    %ebp
+  804fdb:	c3                   	ret
+
+00804fdc <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  804fdc:	55                   	push   %ebp
+  804fdd:	89 e5                	mov    %esp,%ebp
+  804fdf:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  804fe2:	6a 00                	push   $0x0
+  804fe4:	ff 75 08             	push   0x8(%ebp)
+  804fe7:	e8 72 ff ff ff       	call   804f5e <sem_timedwait>
+}
+  804fec:	83 c4 10             	add    $0x10,%esp
+  804fef:	c9                   	leave
+  804ff0:	c3                   	ret
+
+00804ff1 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  804ff1:	55                   	push   %ebp
+  804ff2:	89 e5                	mov    %esp,%ebp
+  804ff4:	83 ec 08             	sub    $0x8,%esp
+  804ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ffa:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fff:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  805003:	8b 50 04             	mov    0x4(%eax),%edx
+  805006:	85 d2                	test   %edx,%edx
+  805008:	75 02                	jne    80500c <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80500a:	c9                   	leave
+  80500b:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80500c:	83 ec 08             	sub    $0x8,%esp
+  80500f:	6a 01                	push   $0x1
+  805011:	50                   	push   %eax
+  805012:	e8 4c cb ff ff       	call   801b63 <sys_futex_wake>
+  805017:	83 c4 10             	add    $0x10,%esp
+}
+  80501a:	eb ee                	jmp    80500a <sem_post+0x19>
+
+0080501c <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80501c:	55                   	push   %ebp
+  80501d:	89 e5                	mov    %esp,%ebp
+  80501f:	57                   	push   %edi
+  805020:	56                   	push   %esi
+  805021:	53                   	push   %ebx
+  805022:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  805025:	68 60 88 80 00       	push   $0x808860
+  80502a:	e8 97 fd ff ff       	call   804dc6 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  80502f:	a1 84 88 80 00       	mov    0x808884,%eax
+  805034:	83 c4 10             	add    $0x10,%esp
+  805037:	85 c0                	test   %eax,%eax
+  805039:	75 19                	jne    805054 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80503b:	a1 00 8b 80 00       	mov    0x808b00,%eax
+  805040:	8b 00                	mov    (%eax),%eax
+  805042:	8b 40 48             	mov    0x48(%eax),%eax
+  805045:	a3 80 88 80 00       	mov    %eax,0x808880
+		threads[0].th_state = PTH_RUNNING;
+  80504a:	c7 05 84 88 80 00 01 	movl   $0x1,0x808884
+  805051:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  805054:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  805059:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80505c:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  805063:	8b 40 04             	mov    0x4(%eax),%eax
+  805066:	85 c0                	test   %eax,%eax
+  805068:	0f 84 e4 00 00 00    	je     805152 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80506e:	83 c3 01             	add    $0x1,%ebx
+  805071:	83 fb 20             	cmp    $0x20,%ebx
+  805074:	75 e3                	jne    805059 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  805076:	83 ec 0c             	sub    $0xc,%esp
+  805079:	68 60 88 80 00       	push   $0x808860
+  80507e:	e8 b0 fd ff ff       	call   804e33 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  805083:	83 c4 10             	add    $0x10,%esp
+  805086:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80508b:	e9 b8 00 00 00       	jmp    805148 <pthread_create+0x12c>
+  805090:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  805093:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  805096:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  805098:	39 f3                	cmp    %esi,%ebx
+  80509a:	73 16                	jae    8050b2 <pthread_create+0x96>
+		va -= PGSIZE;
+  80509c:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8050a2:	83 ec 08             	sub    $0x8,%esp
+  8050a5:	56                   	push   %esi
+  8050a6:	6a 00                	push   $0x0
+  8050a8:	e8 0b c8 ff ff       	call   8018b8 <sys_page_unmap>
+  8050ad:	83 c4 10             	add    $0x10,%esp
+  8050b0:	eb e6                	jmp    805098 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8050b2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8050b5:	83 ec 08             	sub    $0x8,%esp
+  8050b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8050bb:	6a 00                	push   $0x0
+  8050bd:	e8 f6 c7 ff ff       	call   8018b8 <sys_page_unmap>
+	return r;
+  8050c2:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8050c5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8050c8:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  8050cf:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8050d6:	eb 70                	jmp    805148 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8050d8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8050db:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  8050e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8050e5:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8050e8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8050eb:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8050ee:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8050f5:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8050fa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8050fd:	29 c8                	sub    %ecx,%eax
+  8050ff:	85 db                	test   %ebx,%ebx
+  805101:	0f 44 05 00 8b 80 00 	cmove  0x808b00,%eax
+	*--esp = t;
+  805108:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80510b:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  805112:	83 ec 04             	sub    $0x4,%esp
+  805115:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80511a:	29 ca                	sub    %ecx,%edx
+  80511c:	52                   	push   %edx
+	*--esp = 0;
+  80511d:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  805120:	50                   	push   %eax
+  805121:	68 79 53 80 00       	push   $0x805379
+  805126:	e8 dd ca ff ff       	call   801c08 <sys_thread_create>
+  80512b:	89 c7                	mov    %eax,%edi
+  80512d:	83 c4 10             	add    $0x10,%esp
+  805130:	85 c0                	test   %eax,%eax
+  805132:	78 91                	js     8050c5 <pthread_create+0xa9>
+	th->th_env = id;
+  805134:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  805137:	89 3c 85 80 88 80 00 	mov    %edi,0x808880(,%eax,4)
+	*tp = t;
+  80513e:	8b 45 08             	mov    0x8(%ebp),%eax
+  805141:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  805143:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  805148:	89 f8                	mov    %edi,%eax
+  80514a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80514d:	5b                   	pop    %ebx
+  80514e:	5e                   	pop    %esi
+  80514f:	5f                   	pop    %edi
+  805150:	5d                   	pop    %ebp
+  805151:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  805152:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  805155:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  80515c:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  805163:	83 ec 0c             	sub    $0xc,%esp
+  805166:	68 60 88 80 00       	push   $0x808860
+  80516b:	e8 c3 fc ff ff       	call   804e33 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  805170:	89 d9                	mov    %ebx,%ecx
+  805172:	c1 e1 10             	shl    $0x10,%ecx
+  805175:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  805178:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  80517d:	29 c8                	sub    %ecx,%eax
+  80517f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  805182:	c1 e8 16             	shr    $0x16,%eax
+  805185:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80518c:	83 c4 10             	add    $0x10,%esp
+  80518f:	a8 01                	test   $0x1,%al
+  805191:	74 15                	je     8051a8 <pthread_create+0x18c>
+  805193:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805196:	c1 e8 0c             	shr    $0xc,%eax
+  805199:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8051a0:	a8 01                	test   $0x1,%al
+  8051a2:	0f 85 30 ff ff ff    	jne    8050d8 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8051a8:	83 ec 04             	sub    $0x4,%esp
+  8051ab:	6a 07                	push   $0x7
+  8051ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8051b0:	6a 00                	push   $0x0
+  8051b2:	e8 68 c6 ff ff       	call   80181f <sys_page_alloc>
+  8051b7:	89 c7                	mov    %eax,%edi
+  8051b9:	83 c4 10             	add    $0x10,%esp
+  8051bc:	85 c0                	test   %eax,%eax
+  8051be:	0f 88 01 ff ff ff    	js     8050c5 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8051c4:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8051c9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8051cc:	29 d0                	sub    %edx,%eax
+  8051ce:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8051d1:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8051d3:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8051d8:	29 d0                	sub    %edx,%eax
+  8051da:	89 c7                	mov    %eax,%edi
+  8051dc:	39 fe                	cmp    %edi,%esi
+  8051de:	0f 83 f4 fe ff ff    	jae    8050d8 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8051e4:	83 ec 04             	sub    $0x4,%esp
+  8051e7:	6a 07                	push   $0x7
+  8051e9:	56                   	push   %esi
+  8051ea:	6a 00                	push   $0x0
+  8051ec:	e8 2e c6 ff ff       	call   80181f <sys_page_alloc>
+  8051f1:	83 c4 10             	add    $0x10,%esp
+  8051f4:	85 c0                	test   %eax,%eax
+  8051f6:	0f 88 94 fe ff ff    	js     805090 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8051fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  805202:	eb d8                	jmp    8051dc <pthread_create+0x1c0>
+
+00805204 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  805204:	55                   	push   %ebp
+  805205:	89 e5                	mov    %esp,%ebp
+  805207:	57                   	push   %edi
+  805208:	56                   	push   %esi
+  805209:	53                   	push   %ebx
+  80520a:	83 ec 0c             	sub    $0xc,%esp
+  80520d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  805210:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  805213:	83 f8 1e             	cmp    $0x1e,%eax
+  805216:	0f 87 c7 00 00 00    	ja     8052e3 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80521c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80521e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  805224:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  805229:	77 12                	ja     80523d <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80522b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  805230:	29 d0                	sub    %edx,%eax
+  805232:	c1 e8 10             	shr    $0x10,%eax
+  805235:	39 c3                	cmp    %eax,%ebx
+  805237:	0f 84 ad 00 00 00    	je     8052ea <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80523d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  805240:	8d 3c 85 84 88 80 00 	lea    0x808884(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  805247:	8d 34 85 80 88 80 00 	lea    0x808880(,%eax,4),%esi
+  80524e:	eb 10                	jmp    805260 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  805250:	83 ec 04             	sub    $0x4,%esp
+  805253:	6a 00                	push   $0x0
+  805255:	6a 01                	push   $0x1
+  805257:	57                   	push   %edi
+  805258:	e8 d7 c8 ff ff       	call   801b34 <sys_futex_wait>
+  80525d:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  805260:	8b 46 04             	mov    0x4(%esi),%eax
+  805263:	83 f8 01             	cmp    $0x1,%eax
+  805266:	74 e8                	je     805250 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  805268:	83 f8 02             	cmp    $0x2,%eax
+  80526b:	0f 85 80 00 00 00    	jne    8052f1 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  805271:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  805274:	c1 e6 02             	shl    $0x2,%esi
+  805277:	eb 05                	jmp    80527e <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  805279:	e8 75 c5 ff ff       	call   8017f3 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80527e:	8b 8e 80 88 80 00    	mov    0x808880(%esi),%ecx
+  805284:	89 ca                	mov    %ecx,%edx
+  805286:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80528c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80528f:	c1 e0 04             	shl    $0x4,%eax
+  805292:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805297:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80529a:	39 c1                	cmp    %eax,%ecx
+  80529c:	75 12                	jne    8052b0 <pthread_join+0xac>
+  80529e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8052a1:	c1 e0 04             	shl    $0x4,%eax
+  8052a4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8052a9:	8b 40 54             	mov    0x54(%eax),%eax
+  8052ac:	85 c0                	test   %eax,%eax
+  8052ae:	75 c9                	jne    805279 <pthread_join+0x75>
+	if (ret_store)
+  8052b0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8052b4:	74 0f                	je     8052c5 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8052b6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8052b9:	8b 04 85 90 88 80 00 	mov    0x808890(,%eax,4),%eax
+  8052c0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8052c3:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8052c5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8052c8:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  8052cf:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8052d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8052de:	5b                   	pop    %ebx
+  8052df:	5e                   	pop    %esi
+  8052e0:	5f                   	pop    %edi
+  8052e1:	5d                   	pop    %ebp
+  8052e2:	c3                   	ret
+		return -E_INVAL;
+  8052e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8052e8:	eb f1                	jmp    8052db <pthread_join+0xd7>
+  8052ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8052ef:	eb ea                	jmp    8052db <pthread_join+0xd7>
+		return -E_INVAL;
+  8052f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8052f6:	eb e3                	jmp    8052db <pthread_join+0xd7>
+
+008052f8 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8052f8:	55                   	push   %ebp
+  8052f9:	89 e5                	mov    %esp,%ebp
+  8052fb:	53                   	push   %ebx
+  8052fc:	83 ec 04             	sub    $0x4,%esp
+  8052ff:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  805301:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  805307:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80530c:	77 0c                	ja     80531a <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80530e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  805313:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  805315:	c1 e8 10             	shr    $0x10,%eax
+  805318:	75 0a                	jne    805324 <pthread_exit+0x2c>
+		exit();
+  80531a:	e8 eb b8 ff ff       	call   800c0a <exit>
+  80531f:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  805324:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80532b:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80532e:	8d 0c 8d 80 88 80 00 	lea    0x808880(,%ecx,4),%ecx
+  805335:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  805338:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80533b:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  805342:	83 ec 08             	sub    $0x8,%esp
+  805345:	6a 20                	push   $0x20
+  805347:	01 c2                	add    %eax,%edx
+  805349:	8d 04 95 84 88 80 00 	lea    0x808884(,%edx,4),%eax
+  805350:	50                   	push   %eax
+  805351:	e8 0d c8 ff ff       	call   801b63 <sys_futex_wake>
+	sys_env_destroy(0);
+  805356:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80535d:	e8 1a c4 ff ff       	call   80177c <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  805362:	83 c4 0c             	add    $0xc,%esp
+  805365:	68 38 64 80 00       	push   $0x806438
+  80536a:	68 a5 00 00 00       	push   $0xa5
+  80536f:	68 52 64 80 00       	push   $0x806452
+  805374:	e8 b9 b8 ff ff       	call   800c32 <_panic>
+
+00805379 <pthread_start>:
+{
+  805379:	55                   	push   %ebp
+  80537a:	89 e5                	mov    %esp,%ebp
+  80537c:	53                   	push   %ebx
+  80537d:	83 ec 04             	sub    $0x4,%esp
+  805380:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  805383:	e8 3f c4 ff ff       	call   8017c7 <sys_getenvid>
+  805388:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80538d:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+	if (t == 0)
+  805393:	85 db                	test   %ebx,%ebx
+  805395:	74 0c                	je     8053a3 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  805397:	89 d9                	mov    %ebx,%ecx
+  805399:	c1 e1 10             	shl    $0x10,%ecx
+  80539c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8053a1:	29 ca                	sub    %ecx,%edx
+  8053a3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8053a6:	c1 e0 04             	shl    $0x4,%eax
+  8053a9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8053ae:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8053b0:	83 ec 0c             	sub    $0xc,%esp
+  8053b3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8053ba:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8053bd:	ff 34 95 8c 88 80 00 	push   0x80888c(,%edx,4)
+  8053c4:	ff 14 95 88 88 80 00 	call   *0x808888(,%edx,4)
+  8053cb:	89 04 24             	mov    %eax,(%esp)
+  8053ce:	e8 25 ff ff ff       	call   8052f8 <pthread_exit>
+
+008053d3 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8053d3:	55                   	push   %ebp
+  8053d4:	89 e5                	mov    %esp,%ebp
+  8053d6:	57                   	push   %edi
+  8053d7:	56                   	push   %esi
+  8053d8:	53                   	push   %ebx
+  8053d9:	83 ec 1c             	sub    $0x1c,%esp
+  8053dc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8053de:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8053e4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8053eb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8053f0:	77 0d                	ja     8053ff <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8053f2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8053f7:	29 d0                	sub    %edx,%eax
+  8053f9:	c1 e8 10             	shr    $0x10,%eax
+  8053fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8053ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805404:	eb 2f                	jmp    805435 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  805406:	8b 0d 00 8b 80 00    	mov    0x808b00,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80540c:	8b 01                	mov    (%ecx),%eax
+  80540e:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  805411:	39 c2                	cmp    %eax,%edx
+  805413:	75 14                	jne    805429 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  805415:	83 ec 0c             	sub    $0xc,%esp
+  805418:	57                   	push   %edi
+  805419:	e8 5e c3 ff ff       	call   80177c <sys_env_destroy>
+  80541e:	83 c4 10             	add    $0x10,%esp
+  805421:	85 c0                	test   %eax,%eax
+  805423:	0f 88 97 00 00 00    	js     8054c0 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  805429:	83 c3 01             	add    $0x1,%ebx
+  80542c:	83 fb 20             	cmp    $0x20,%ebx
+  80542f:	0f 84 d2 00 00 00    	je     805507 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  805435:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  805438:	74 ef                	je     805429 <pthread_kill_others+0x56>
+  80543a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80543d:	8d 04 85 80 88 80 00 	lea    0x808880(,%eax,4),%eax
+  805444:	8b 40 04             	mov    0x4(%eax),%eax
+  805447:	83 f8 01             	cmp    $0x1,%eax
+  80544a:	75 dd                	jne    805429 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80544c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80544f:	8b 3c 85 80 88 80 00 	mov    0x808880(,%eax,4),%edi
+  805456:	89 fe                	mov    %edi,%esi
+  805458:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80545e:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  805461:	c1 e0 04             	shl    $0x4,%eax
+  805464:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805469:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80546c:	39 c7                	cmp    %eax,%edi
+  80546e:	75 b9                	jne    805429 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  805470:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  805473:	c1 e0 04             	shl    $0x4,%eax
+  805476:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80547b:	8b 40 54             	mov    0x54(%eax),%eax
+  80547e:	85 c0                	test   %eax,%eax
+  805480:	74 a7                	je     805429 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  805482:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  805485:	c1 e0 04             	shl    $0x4,%eax
+  805488:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80548e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  805490:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  805496:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80549b:	0f 87 65 ff ff ff    	ja     805406 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8054a1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8054a6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8054a8:	c1 e8 10             	shr    $0x10,%eax
+  8054ab:	0f 84 55 ff ff ff    	je     805406 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8054b1:	c1 e0 10             	shl    $0x10,%eax
+  8054b4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8054b9:	29 c1                	sub    %eax,%ecx
+  8054bb:	e9 4c ff ff ff       	jmp    80540c <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8054c0:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8054c3:	c1 e2 04             	shl    $0x4,%edx
+  8054c6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8054cc:	8b 52 48             	mov    0x48(%edx),%edx
+  8054cf:	39 fa                	cmp    %edi,%edx
+  8054d1:	0f 85 52 ff ff ff    	jne    805429 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8054d7:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8054da:	c1 e2 04             	shl    $0x4,%edx
+  8054dd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8054e3:	8b 52 54             	mov    0x54(%edx),%edx
+  8054e6:	85 d2                	test   %edx,%edx
+  8054e8:	0f 84 3b ff ff ff    	je     805429 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8054ee:	83 ec 0c             	sub    $0xc,%esp
+  8054f1:	50                   	push   %eax
+  8054f2:	57                   	push   %edi
+  8054f3:	68 60 64 80 00       	push   $0x806460
+  8054f8:	68 bb 00 00 00       	push   $0xbb
+  8054fd:	68 52 64 80 00       	push   $0x806452
+  805502:	e8 2b b7 ff ff       	call   800c32 <_panic>
+	}
+}
+  805507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80550a:	5b                   	pop    %ebx
+  80550b:	5e                   	pop    %esi
+  80550c:	5f                   	pop    %edi
+  80550d:	5d                   	pop    %ebp
+  80550e:	c3                   	ret
+
+0080550f <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80550f:	55                   	push   %ebp
+  805510:	89 e5                	mov    %esp,%ebp
+  805512:	53                   	push   %ebx
+  805513:	83 ec 04             	sub    $0x4,%esp
+  805516:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  805518:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80551e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  805524:	0f 87 85 00 00 00    	ja     8055af <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80552a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80552f:	29 c3                	sub    %eax,%ebx
+  805531:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  805534:	83 ec 04             	sub    $0x4,%esp
+  805537:	68 80 02 00 00       	push   $0x280
+  80553c:	6a 00                	push   $0x0
+  80553e:	68 80 88 80 00       	push   $0x808880
+  805543:	e8 ea bf ff ff       	call   801532 <memset>
+	threads_mu.m_state = 0;
+  805548:	c7 05 60 88 80 00 00 	movl   $0x0,0x808860
+  80554f:	00 00 00 
+	if (self != 0) {
+  805552:	83 c4 10             	add    $0x10,%esp
+  805555:	85 db                	test   %ebx,%ebx
+  805557:	74 51                	je     8055aa <pthread_fork_child+0x9b>
+  805559:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80555b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  805561:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  805566:	77 18                	ja     805580 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  805568:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80556d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80556f:	c1 e8 10             	shr    $0x10,%eax
+  805572:	74 0c                	je     805580 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  805574:	c1 e0 10             	shl    $0x10,%eax
+  805577:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80557c:	29 c2                	sub    %eax,%edx
+  80557e:	eb 06                	jmp    805586 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  805580:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		threads[self].th_env = thisenv->env_id;
+  805586:	8b 02                	mov    (%edx),%eax
+  805588:	8b 48 48             	mov    0x48(%eax),%ecx
+  80558b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  805592:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  805595:	89 0c 95 80 88 80 00 	mov    %ecx,0x808880(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80559c:	8d 04 95 80 88 80 00 	lea    0x808880(,%edx,4),%eax
+  8055a3:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8055aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8055ad:	c9                   	leave
+  8055ae:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8055af:	83 ec 04             	sub    $0x4,%esp
+  8055b2:	68 80 02 00 00       	push   $0x280
+  8055b7:	6a 00                	push   $0x0
+  8055b9:	68 80 88 80 00       	push   $0x808880
+  8055be:	e8 6f bf ff ff       	call   801532 <memset>
+	threads_mu.m_state = 0;
+  8055c3:	c7 05 60 88 80 00 00 	movl   $0x0,0x808860
+  8055ca:	00 00 00 
+  8055cd:	83 c4 10             	add    $0x10,%esp
+  8055d0:	eb d8                	jmp    8055aa <pthread_fork_child+0x9b>
+
+008055d2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8055d2:	55                   	push   %ebp
+  8055d3:	89 e5                	mov    %esp,%ebp
+  8055d5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8055d8:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8055df:	74 0a                	je     8055eb <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8055e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8055e4:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  8055e9:	c9                   	leave
+  8055ea:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8055eb:	83 ec 04             	sub    $0x4,%esp
+  8055ee:	6a 07                	push   $0x7
+  8055f0:	68 00 f0 bf ee       	push   $0xeebff000
+  8055f5:	6a 00                	push   $0x0
+  8055f7:	e8 23 c2 ff ff       	call   80181f <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8055fc:	83 c4 08             	add    $0x8,%esp
+  8055ff:	68 10 56 80 00       	push   $0x805610
+  805604:	6a 00                	push   $0x0
+  805606:	e8 91 c3 ff ff       	call   80199c <sys_env_set_pgfault_upcall>
+  80560b:	83 c4 10             	add    $0x10,%esp
+  80560e:	eb d1                	jmp    8055e1 <set_pgfault_handler+0xf>
+
+00805610 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805610:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805611:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  805616:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805618:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80561b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80561f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  805623:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  805626:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80562a:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80562c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80562f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  805630:	83 c4 04             	add    $0x4,%esp
+	popfl
+  805633:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  805634:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  805635:	c3                   	ret
+
+00805636 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805636:	55                   	push   %ebp
+  805637:	89 e5                	mov    %esp,%ebp
+  805639:	57                   	push   %edi
+  80563a:	56                   	push   %esi
+  80563b:	53                   	push   %ebx
+  80563c:	83 ec 18             	sub    $0x18,%esp
+  80563f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805642:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805645:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  805648:	85 c0                	test   %eax,%eax
+  80564a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80564f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  805652:	50                   	push   %eax
+  805653:	e8 bd c3 ff ff       	call   801a15 <sys_ipc_recv>
+	if (r < 0) {
+  805658:	83 c4 10             	add    $0x10,%esp
+  80565b:	85 c0                	test   %eax,%eax
+  80565d:	78 2b                	js     80568a <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80565f:	85 ff                	test   %edi,%edi
+  805661:	74 55                	je     8056b8 <ipc_recv+0x82>
+  805663:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  805665:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80566b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  805670:	77 39                	ja     8056ab <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  805672:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  805677:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  805679:	c1 e8 10             	shr    $0x10,%eax
+  80567c:	74 2d                	je     8056ab <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80567e:	c1 e0 10             	shl    $0x10,%eax
+  805681:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  805686:	29 c2                	sub    %eax,%edx
+  805688:	eb 27                	jmp    8056b1 <ipc_recv+0x7b>
+  80568a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80568c:	83 ec 08             	sub    $0x8,%esp
+  80568f:	50                   	push   %eax
+  805690:	68 85 64 80 00       	push   $0x806485
+  805695:	e8 73 b6 ff ff       	call   800d0d <cprintf>
+		*from_env_store = 0;
+  80569a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8056a0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8056a6:	83 c4 10             	add    $0x10,%esp
+  8056a9:	eb 77                	jmp    805722 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8056ab:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8056b1:	8b 02                	mov    (%edx),%eax
+  8056b3:	8b 40 78             	mov    0x78(%eax),%eax
+  8056b6:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8056b8:	85 f6                	test   %esi,%esi
+  8056ba:	74 34                	je     8056f0 <ipc_recv+0xba>
+  8056bc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8056be:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8056c4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8056c9:	77 18                	ja     8056e3 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8056cb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8056d0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8056d2:	c1 e8 10             	shr    $0x10,%eax
+  8056d5:	74 0c                	je     8056e3 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8056d7:	c1 e0 10             	shl    $0x10,%eax
+  8056da:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8056df:	29 c2                	sub    %eax,%edx
+  8056e1:	eb 06                	jmp    8056e9 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8056e3:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8056e9:	8b 02                	mov    (%edx),%eax
+  8056eb:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8056ee:	89 06                	mov    %eax,(%esi)
+  8056f0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8056f2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8056f8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8056fd:	77 18                	ja     805717 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8056ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  805704:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  805706:	c1 e8 10             	shr    $0x10,%eax
+  805709:	74 0c                	je     805717 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80570b:	c1 e0 10             	shl    $0x10,%eax
+  80570e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  805713:	29 c2                	sub    %eax,%edx
+  805715:	eb 06                	jmp    80571d <ipc_recv+0xe7>
+		return pthread_main_tls;
+  805717:	8b 15 00 8b 80 00    	mov    0x808b00,%edx
+	}
+	return thisenv->env_ipc_value;
+  80571d:	8b 02                	mov    (%edx),%eax
+  80571f:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  805722:	89 d8                	mov    %ebx,%eax
+  805724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805727:	5b                   	pop    %ebx
+  805728:	5e                   	pop    %esi
+  805729:	5f                   	pop    %edi
+  80572a:	5d                   	pop    %ebp
+  80572b:	c3                   	ret
+
+0080572c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80572c:	55                   	push   %ebp
+  80572d:	89 e5                	mov    %esp,%ebp
+  80572f:	57                   	push   %edi
+  805730:	56                   	push   %esi
+  805731:	53                   	push   %ebx
+  805732:	83 ec 0c             	sub    $0xc,%esp
+  805735:	8b 75 08             	mov    0x8(%ebp),%esi
+  805738:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80573b:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80573e:	85 db                	test   %ebx,%ebx
+  805740:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  805745:	0f 44 d8             	cmove  %eax,%ebx
+  805748:	eb 05                	jmp    80574f <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80574a:	e8 a4 c0 ff ff       	call   8017f3 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80574f:	57                   	push   %edi
+  805750:	53                   	push   %ebx
+  805751:	ff 75 0c             	push   0xc(%ebp)
+  805754:	56                   	push   %esi
+  805755:	e8 8e c2 ff ff       	call   8019e8 <sys_ipc_try_send>
+		if (r == 0) {
+  80575a:	83 c4 10             	add    $0x10,%esp
+  80575d:	85 c0                	test   %eax,%eax
+  80575f:	74 19                	je     80577a <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  805761:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  805764:	74 e4                	je     80574a <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  805766:	83 ec 0c             	sub    $0xc,%esp
+  805769:	50                   	push   %eax
+  80576a:	57                   	push   %edi
+  80576b:	53                   	push   %ebx
+  80576c:	56                   	push   %esi
+  80576d:	68 a0 64 80 00       	push   $0x8064a0
+  805772:	e8 96 b5 ff ff       	call   800d0d <cprintf>
+			return;
+  805777:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80577a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80577d:	5b                   	pop    %ebx
+  80577e:	5e                   	pop    %esi
+  80577f:	5f                   	pop    %edi
+  805780:	5d                   	pop    %ebp
+  805781:	c3                   	ret
+
+00805782 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805782:	55                   	push   %ebp
+  805783:	89 e5                	mov    %esp,%ebp
+  805785:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805788:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80578d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  805790:	c1 e0 04             	shl    $0x4,%eax
+  805793:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805798:	8b 40 50             	mov    0x50(%eax),%eax
+  80579b:	39 c8                	cmp    %ecx,%eax
+  80579d:	74 12                	je     8057b1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80579f:	83 c2 01             	add    $0x1,%edx
+  8057a2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8057a8:	75 e3                	jne    80578d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8057aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057af:	eb 0e                	jmp    8057bf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8057b1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8057b4:	c1 e0 04             	shl    $0x4,%eax
+  8057b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8057bc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8057bf:	5d                   	pop    %ebp
+  8057c0:	c3                   	ret
+
+008057c1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8057c1:	55                   	push   %ebp
+  8057c2:	89 e5                	mov    %esp,%ebp
+  8057c4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8057c7:	89 c2                	mov    %eax,%edx
+  8057c9:	c1 ea 16             	shr    $0x16,%edx
+  8057cc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8057d3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8057d8:	f6 c1 01             	test   $0x1,%cl
+  8057db:	74 1c                	je     8057f9 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8057dd:	c1 e8 0c             	shr    $0xc,%eax
+  8057e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8057e7:	a8 01                	test   $0x1,%al
+  8057e9:	74 0e                	je     8057f9 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8057eb:	c1 e8 0c             	shr    $0xc,%eax
+  8057ee:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8057f5:	ef 
+  8057f6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8057f9:	89 d0                	mov    %edx,%eax
+  8057fb:	5d                   	pop    %ebp
+  8057fc:	c3                   	ret
+
+008057fd <udm>:
+  8057fd:	57                   	push   %edi
+  8057fe:	56                   	push   %esi
+  8057ff:	53                   	push   %ebx
+  805800:	83 ec 20             	sub    $0x20,%esp
+  805803:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805807:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80580b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80580f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  805813:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805817:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80581b:	89 d1                	mov    %edx,%ecx
+  80581d:	09 c1                	or     %eax,%ecx
+  80581f:	0f 84 91 00 00 00    	je     8058b6 <udm+0xb9>
+  805825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80582f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805834:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80583b:	00 
+  80583c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805843:	00 
+  805844:	eb 08                	jmp    80584e <udm+0x51>
+  805846:	83 e9 01             	sub    $0x1,%ecx
+  805849:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80584c:	74 7c                	je     8058ca <udm+0xcd>
+  80584e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805852:	01 c0                	add    %eax,%eax
+  805854:	89 c6                	mov    %eax,%esi
+  805856:	89 d7                	mov    %edx,%edi
+  805858:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80585c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805860:	0f ad d0             	shrd   %cl,%edx,%eax
+  805863:	d3 ea                	shr    %cl,%edx
+  805865:	f6 c1 20             	test   $0x20,%cl
+  805868:	74 04                	je     80586e <udm+0x71>
+  80586a:	89 d0                	mov    %edx,%eax
+  80586c:	31 d2                	xor    %edx,%edx
+  80586e:	83 e0 01             	and    $0x1,%eax
+  805871:	89 04 24             	mov    %eax,(%esp)
+  805874:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80587b:	00 
+  80587c:	8b 04 24             	mov    (%esp),%eax
+  80587f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805883:	09 f0                	or     %esi,%eax
+  805885:	09 fa                	or     %edi,%edx
+  805887:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80588b:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80588f:	39 f0                	cmp    %esi,%eax
+  805891:	89 d3                	mov    %edx,%ebx
+  805893:	19 fb                	sbb    %edi,%ebx
+  805895:	72 af                	jb     805846 <udm+0x49>
+  805897:	29 f0                	sub    %esi,%eax
+  805899:	19 fa                	sbb    %edi,%edx
+  80589b:	89 cf                	mov    %ecx,%edi
+  80589d:	c1 ef 05             	shr    $0x5,%edi
+  8058a0:	83 e7 01             	and    $0x1,%edi
+  8058a3:	89 fe                	mov    %edi,%esi
+  8058a5:	83 f6 01             	xor    $0x1,%esi
+  8058a8:	d3 e6                	shl    %cl,%esi
+  8058aa:	d3 e7                	shl    %cl,%edi
+  8058ac:	09 74 24 18          	or     %esi,0x18(%esp)
+  8058b0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8058b4:	eb 90                	jmp    805846 <udm+0x49>
+  8058b6:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8058ba:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8058be:	89 f0                	mov    %esi,%eax
+  8058c0:	89 fa                	mov    %edi,%edx
+  8058c2:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8058c6:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8058ca:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8058ce:	89 01                	mov    %eax,(%ecx)
+  8058d0:	89 51 04             	mov    %edx,0x4(%ecx)
+  8058d3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8058d7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8058db:	83 c4 20             	add    $0x20,%esp
+  8058de:	5b                   	pop    %ebx
+  8058df:	5e                   	pop    %esi
+  8058e0:	5f                   	pop    %edi
+  8058e1:	c3                   	ret
+
+008058e2 <__udivdi3>:
+  8058e2:	83 ec 18             	sub    $0x18,%esp
+  8058e5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8058e9:	50                   	push   %eax
+  8058ea:	ff 74 24 2c          	push   0x2c(%esp)
+  8058ee:	ff 74 24 2c          	push   0x2c(%esp)
+  8058f2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8058f6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8058fa:	e8 fe fe ff ff       	call   8057fd <udm>
+  8058ff:	83 c4 24             	add    $0x24,%esp
+  805902:	c3                   	ret
+
+00805903 <__umoddi3>:
+  805903:	83 ec 18             	sub    $0x18,%esp
+  805906:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80590a:	50                   	push   %eax
+  80590b:	ff 74 24 2c          	push   0x2c(%esp)
+  80590f:	ff 74 24 2c          	push   0x2c(%esp)
+  805913:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805917:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80591b:	e8 dd fe ff ff       	call   8057fd <udm>
+  805920:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805924:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805928:	83 c4 24             	add    $0x24,%esp
+  80592b:	c3                   	ret
+
+0080592c <__divdi3>:
+  80592c:	56                   	push   %esi
+  80592d:	53                   	push   %ebx
+  80592e:	83 ec 14             	sub    $0x14,%esp
+  805931:	8b 44 24 20          	mov    0x20(%esp),%eax
+  805935:	8b 54 24 24          	mov    0x24(%esp),%edx
+  805939:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80593d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  805941:	85 d2                	test   %edx,%edx
+  805943:	78 18                	js     80595d <__divdi3+0x31>
+  805945:	85 db                	test   %ebx,%ebx
+  805947:	78 3e                	js     805987 <__divdi3+0x5b>
+  805949:	83 ec 04             	sub    $0x4,%esp
+  80594c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  805950:	56                   	push   %esi
+  805951:	53                   	push   %ebx
+  805952:	51                   	push   %ecx
+  805953:	e8 a5 fe ff ff       	call   8057fd <udm>
+  805958:	83 c4 10             	add    $0x10,%esp
+  80595b:	eb 24                	jmp    805981 <__divdi3+0x55>
+  80595d:	f7 d8                	neg    %eax
+  80595f:	83 d2 00             	adc    $0x0,%edx
+  805962:	f7 da                	neg    %edx
+  805964:	85 db                	test   %ebx,%ebx
+  805966:	78 3a                	js     8059a2 <__divdi3+0x76>
+  805968:	83 ec 04             	sub    $0x4,%esp
+  80596b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80596f:	56                   	push   %esi
+  805970:	53                   	push   %ebx
+  805971:	51                   	push   %ecx
+  805972:	e8 86 fe ff ff       	call   8057fd <udm>
+  805977:	83 c4 10             	add    $0x10,%esp
+  80597a:	f7 d8                	neg    %eax
+  80597c:	83 d2 00             	adc    $0x0,%edx
+  80597f:	f7 da                	neg    %edx
+  805981:	83 c4 14             	add    $0x14,%esp
+  805984:	5b                   	pop    %ebx
+  805985:	5e                   	pop    %esi
+  805986:	c3                   	ret
+  805987:	83 ec 04             	sub    $0x4,%esp
+  80598a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80598e:	56                   	push   %esi
+  80598f:	f7 d9                	neg    %ecx
+  805991:	83 d3 00             	adc    $0x0,%ebx
+  805994:	f7 db                	neg    %ebx
+  805996:	53                   	push   %ebx
+  805997:	51                   	push   %ecx
+  805998:	e8 60 fe ff ff       	call   8057fd <udm>
+  80599d:	83 c4 10             	add    $0x10,%esp
+  8059a0:	eb d8                	jmp    80597a <__divdi3+0x4e>
+  8059a2:	83 ec 04             	sub    $0x4,%esp
+  8059a5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8059a9:	56                   	push   %esi
+  8059aa:	f7 d9                	neg    %ecx
+  8059ac:	83 d3 00             	adc    $0x0,%ebx
+  8059af:	f7 db                	neg    %ebx
+  8059b1:	53                   	push   %ebx
+  8059b2:	51                   	push   %ecx
+  8059b3:	e8 45 fe ff ff       	call   8057fd <udm>
+  8059b8:	83 c4 10             	add    $0x10,%esp
+  8059bb:	eb c4                	jmp    805981 <__divdi3+0x55>
+
+008059bd <__moddi3>:
+  8059bd:	55                   	push   %ebp
+  8059be:	57                   	push   %edi
+  8059bf:	56                   	push   %esi
+  8059c0:	53                   	push   %ebx
+  8059c1:	83 ec 24             	sub    $0x24,%esp
+  8059c4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8059c8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8059cc:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8059d0:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8059d4:	85 d2                	test   %edx,%edx
+  8059d6:	78 3b                	js     805a13 <__moddi3+0x56>
+  8059d8:	83 ec 04             	sub    $0x4,%esp
+  8059db:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8059df:	56                   	push   %esi
+  8059e0:	89 ce                	mov    %ecx,%esi
+  8059e2:	f7 de                	neg    %esi
+  8059e4:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8059e8:	89 de                	mov    %ebx,%esi
+  8059ea:	83 d6 00             	adc    $0x0,%esi
+  8059ed:	f7 de                	neg    %esi
+  8059ef:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8059f3:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8059f7:	0f 48 f1             	cmovs  %ecx,%esi
+  8059fa:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8059ff:	53                   	push   %ebx
+  805a00:	56                   	push   %esi
+  805a01:	e8 f7 fd ff ff       	call   8057fd <udm>
+  805a06:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805a0a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805a0e:	83 c4 10             	add    $0x10,%esp
+  805a11:	eb 47                	jmp    805a5a <__moddi3+0x9d>
+  805a13:	f7 d8                	neg    %eax
+  805a15:	83 d2 00             	adc    $0x0,%edx
+  805a18:	f7 da                	neg    %edx
+  805a1a:	83 ec 04             	sub    $0x4,%esp
+  805a1d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  805a21:	56                   	push   %esi
+  805a22:	89 cf                	mov    %ecx,%edi
+  805a24:	f7 df                	neg    %edi
+  805a26:	89 de                	mov    %ebx,%esi
+  805a28:	83 d6 00             	adc    $0x0,%esi
+  805a2b:	f7 de                	neg    %esi
+  805a2d:	0f 49 cf             	cmovns %edi,%ecx
+  805a30:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  805a34:	0f 49 de             	cmovns %esi,%ebx
+  805a37:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  805a3b:	ff 74 24 0c          	push   0xc(%esp)
+  805a3f:	ff 74 24 0c          	push   0xc(%esp)
+  805a43:	e8 b5 fd ff ff       	call   8057fd <udm>
+  805a48:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805a4c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805a50:	f7 d8                	neg    %eax
+  805a52:	83 d2 00             	adc    $0x0,%edx
+  805a55:	f7 da                	neg    %edx
+  805a57:	83 c4 10             	add    $0x10,%esp
+  805a5a:	83 c4 24             	add    $0x24,%esp
+  805a5d:	5b                   	pop    %ebx
+  805a5e:	5e                   	pop    %esi
+  805a5f:	5f                   	pop    %edi
+  805a60:	5d                   	pop    %ebp
+  805a61:	c3                   	ret
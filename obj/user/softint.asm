@@ -0,0 +1,9679 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	57                   	push   %edi
+  80003a:	56                   	push   %esi
+  80003b:	53                   	push   %ebx
+  80003c:	83 ec 1c             	sub    $0x1c,%esp
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800045:	e8 31 01 00 00       	call   80017b <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80004a:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80004d:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800053:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800058:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80005a:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80005c:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800062:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800067:	77 16                	ja     80007f <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800069:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80006e:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800070:	c1 e8 10             	shr    $0x10,%eax
+  800073:	74 0a                	je     80007f <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800075:	c1 e0 10             	shl    $0x10,%eax
+  800078:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80007d:	29 c2                	sub    %eax,%edx
+  80007f:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800082:	c1 e0 04             	shl    $0x4,%eax
+  800085:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80008a:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80008c:	85 db                	test   %ebx,%ebx
+  80008e:	7e 07                	jle    800097 <libmain+0x61>
+		binaryname = argv[0];
+  800090:	8b 06                	mov    (%esi),%eax
+  800092:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800097:	83 ec 08             	sub    $0x8,%esp
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	e8 92 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a1:	e8 0b 00 00 00       	call   8000b1 <exit>
+}
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ac:	5b                   	pop    %ebx
+  8000ad:	5e                   	pop    %esi
+  8000ae:	5f                   	pop    %edi
+  8000af:	5d                   	pop    %ebp
+  8000b0:	c3                   	ret
+
+008000b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8000b7:	6a 00                	push   $0x0
+  8000b9:	e8 12 17 00 00       	call   8017d0 <fflush>
+	pthread_kill_others();
+  8000be:	e8 7d 2d 00 00       	call   802e40 <pthread_kill_others>
+	close_all();
+  8000c3:	e8 ab 07 00 00       	call   800873 <close_all>
+	sys_env_destroy(0);
+  8000c8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000cf:	e8 5c 00 00 00       	call   800130 <sys_env_destroy>
+}
+  8000d4:	83 c4 10             	add    $0x10,%esp
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+
+008000d9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d9:	55                   	push   %ebp
+  8000da:	89 e5                	mov    %esp,%ebp
+  8000dc:	57                   	push   %edi
+  8000dd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e9:	89 c3                	mov    %eax,%ebx
+  8000eb:	89 c7                	mov    %eax,%edi
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	55                   	push   %ebp
+  8000f0:	56                   	push   %esi
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	8d 35 fb 00 80 00    	lea    0x8000fb,%esi
+  8000f9:	0f 34                	sysenter
+
+008000fb <after_sysenter_label_47>:
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800100:	5b                   	pop    %ebx
+  800101:	5f                   	pop    %edi
+  800102:	5d                   	pop    %ebp
+  800103:	c3                   	ret
+
+00800104 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	57                   	push   %edi
+  800108:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800113:	89 d1                	mov    %edx,%ecx
+  800115:	89 d3                	mov    %edx,%ebx
+  800117:	89 d7                	mov    %edx,%edi
+  800119:	6a 00                	push   $0x0
+  80011b:	55                   	push   %ebp
+  80011c:	56                   	push   %esi
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	8d 35 27 01 80 00    	lea    0x800127,%esi
+  800125:	0f 34                	sysenter
+
+00800127 <after_sysenter_label_128>:
+  800127:	5e                   	pop    %esi
+  800128:	5d                   	pop    %ebp
+  800129:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80012c:	5b                   	pop    %ebx
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+
+00800130 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	57                   	push   %edi
+  800134:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800135:	8b 55 08             	mov    0x8(%ebp),%edx
+  800138:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800142:	89 cb                	mov    %ecx,%ebx
+  800144:	89 cf                	mov    %ecx,%edi
+  800146:	6a 00                	push   $0x0
+  800148:	55                   	push   %ebp
+  800149:	56                   	push   %esi
+  80014a:	89 e5                	mov    %esp,%ebp
+  80014c:	8d 35 54 01 80 00    	lea    0x800154,%esi
+  800152:	0f 34                	sysenter
+
+00800154 <after_sysenter_label_212>:
+  800154:	5e                   	pop    %esi
+  800155:	5d                   	pop    %ebp
+  800156:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800159:	85 c0                	test   %eax,%eax
+  80015b:	7f 07                	jg     800164 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80015d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800160:	5b                   	pop    %ebx
+  800161:	5f                   	pop    %edi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	6a 03                	push   $0x3
+  80016a:	68 ca 46 80 00       	push   $0x8046ca
+  80016f:	6a 54                	push   $0x54
+  800171:	68 e7 46 80 00       	push   $0x8046e7
+  800176:	e8 38 30 00 00       	call   8031b3 <_panic>
+
+0080017b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800180:	ba 00 00 00 00       	mov    $0x0,%edx
+  800185:	b8 02 00 00 00       	mov    $0x2,%eax
+  80018a:	89 d1                	mov    %edx,%ecx
+  80018c:	89 d3                	mov    %edx,%ebx
+  80018e:	89 d7                	mov    %edx,%edi
+  800190:	6a 00                	push   $0x0
+  800192:	55                   	push   %ebp
+  800193:	56                   	push   %esi
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	8d 35 9e 01 80 00    	lea    0x80019e,%esi
+  80019c:	0f 34                	sysenter
+
+0080019e <after_sysenter_label_309>:
+  80019e:	5e                   	pop    %esi
+  80019f:	5d                   	pop    %ebp
+  8001a0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8001a3:	5b                   	pop    %ebx
+  8001a4:	5f                   	pop    %edi
+  8001a5:	5d                   	pop    %ebp
+  8001a6:	c3                   	ret
+
+008001a7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	57                   	push   %edi
+  8001ab:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001b6:	89 d1                	mov    %edx,%ecx
+  8001b8:	89 d3                	mov    %edx,%ebx
+  8001ba:	89 d7                	mov    %edx,%edi
+  8001bc:	6a 00                	push   $0x0
+  8001be:	55                   	push   %ebp
+  8001bf:	56                   	push   %esi
+  8001c0:	89 e5                	mov    %esp,%ebp
+  8001c2:	8d 35 ca 01 80 00    	lea    0x8001ca,%esi
+  8001c8:	0f 34                	sysenter
+
+008001ca <after_sysenter_label_391>:
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5d                   	pop    %ebp
+  8001cc:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001cf:	5b                   	pop    %ebx
+  8001d0:	5f                   	pop    %edi
+  8001d1:	5d                   	pop    %ebp
+  8001d2:	c3                   	ret
+
+008001d3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	57                   	push   %edi
+  8001d7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8001d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001de:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	55                   	push   %ebp
+  8001ee:	56                   	push   %esi
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	8d 35 f9 01 80 00    	lea    0x8001f9,%esi
+  8001f7:	0f 34                	sysenter
+
+008001f9 <after_sysenter_label_479>:
+  8001f9:	5e                   	pop    %esi
+  8001fa:	5d                   	pop    %ebp
+  8001fb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	7f 07                	jg     800209 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800202:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800205:	5b                   	pop    %ebx
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	50                   	push   %eax
+  80020d:	6a 04                	push   $0x4
+  80020f:	68 ca 46 80 00       	push   $0x8046ca
+  800214:	6a 54                	push   $0x54
+  800216:	68 e7 46 80 00       	push   $0x8046e7
+  80021b:	e8 93 2f 00 00       	call   8031b3 <_panic>
+
+00800220 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	57                   	push   %edi
+  800224:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800225:	8b 55 08             	mov    0x8(%ebp),%edx
+  800228:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800230:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800233:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	55                   	push   %ebp
+  80023a:	56                   	push   %esi
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	8d 35 45 02 80 00    	lea    0x800245,%esi
+  800243:	0f 34                	sysenter
+
+00800245 <after_sysenter_label_593>:
+  800245:	5e                   	pop    %esi
+  800246:	5d                   	pop    %ebp
+  800247:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	7f 07                	jg     800255 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80024e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5f                   	pop    %edi
+  800253:	5d                   	pop    %ebp
+  800254:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800255:	83 ec 0c             	sub    $0xc,%esp
+  800258:	50                   	push   %eax
+  800259:	6a 05                	push   $0x5
+  80025b:	68 ca 46 80 00       	push   $0x8046ca
+  800260:	6a 54                	push   $0x54
+  800262:	68 e7 46 80 00       	push   $0x8046e7
+  800267:	e8 47 2f 00 00       	call   8031b3 <_panic>
+
+0080026c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	57                   	push   %edi
+  800270:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800271:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800276:	8b 55 08             	mov    0x8(%ebp),%edx
+  800279:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800281:	89 df                	mov    %ebx,%edi
+  800283:	6a 00                	push   $0x0
+  800285:	55                   	push   %ebp
+  800286:	56                   	push   %esi
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	8d 35 91 02 80 00    	lea    0x800291,%esi
+  80028f:	0f 34                	sysenter
+
+00800291 <after_sysenter_label_704>:
+  800291:	5e                   	pop    %esi
+  800292:	5d                   	pop    %ebp
+  800293:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800296:	85 c0                	test   %eax,%eax
+  800298:	7f 07                	jg     8002a1 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80029a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80029d:	5b                   	pop    %ebx
+  80029e:	5f                   	pop    %edi
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	50                   	push   %eax
+  8002a5:	6a 06                	push   $0x6
+  8002a7:	68 ca 46 80 00       	push   $0x8046ca
+  8002ac:	6a 54                	push   $0x54
+  8002ae:	68 e7 46 80 00       	push   $0x8046e7
+  8002b3:	e8 fb 2e 00 00       	call   8031b3 <_panic>
+
+008002b8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	57                   	push   %edi
+  8002bc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8002bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002cd:	89 df                	mov    %ebx,%edi
+  8002cf:	6a 00                	push   $0x0
+  8002d1:	55                   	push   %ebp
+  8002d2:	56                   	push   %esi
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	8d 35 dd 02 80 00    	lea    0x8002dd,%esi
+  8002db:	0f 34                	sysenter
+
+008002dd <after_sysenter_label_808>:
+  8002dd:	5e                   	pop    %esi
+  8002de:	5d                   	pop    %ebp
+  8002df:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	7f 07                	jg     8002ed <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8002e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002e9:	5b                   	pop    %ebx
+  8002ea:	5f                   	pop    %edi
+  8002eb:	5d                   	pop    %ebp
+  8002ec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	50                   	push   %eax
+  8002f1:	6a 08                	push   $0x8
+  8002f3:	68 ca 46 80 00       	push   $0x8046ca
+  8002f8:	6a 54                	push   $0x54
+  8002fa:	68 e7 46 80 00       	push   $0x8046e7
+  8002ff:	e8 af 2e 00 00       	call   8031b3 <_panic>
+
+00800304 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	57                   	push   %edi
+  800308:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800309:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80030e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800311:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800314:	b8 09 00 00 00       	mov    $0x9,%eax
+  800319:	89 df                	mov    %ebx,%edi
+  80031b:	6a 00                	push   $0x0
+  80031d:	55                   	push   %ebp
+  80031e:	56                   	push   %esi
+  80031f:	89 e5                	mov    %esp,%ebp
+  800321:	8d 35 29 03 80 00    	lea    0x800329,%esi
+  800327:	0f 34                	sysenter
+
+00800329 <after_sysenter_label_912>:
+  800329:	5e                   	pop    %esi
+  80032a:	5d                   	pop    %ebp
+  80032b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80032e:	85 c0                	test   %eax,%eax
+  800330:	7f 07                	jg     800339 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800335:	5b                   	pop    %ebx
+  800336:	5f                   	pop    %edi
+  800337:	5d                   	pop    %ebp
+  800338:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	50                   	push   %eax
+  80033d:	6a 09                	push   $0x9
+  80033f:	68 ca 46 80 00       	push   $0x8046ca
+  800344:	6a 54                	push   $0x54
+  800346:	68 e7 46 80 00       	push   $0x8046e7
+  80034b:	e8 63 2e 00 00       	call   8031b3 <_panic>
+
+00800350 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800350:	55                   	push   %ebp
+  800351:	89 e5                	mov    %esp,%ebp
+  800353:	57                   	push   %edi
+  800354:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800355:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80035a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800360:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800365:	89 df                	mov    %ebx,%edi
+  800367:	6a 00                	push   $0x0
+  800369:	55                   	push   %ebp
+  80036a:	56                   	push   %esi
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	8d 35 75 03 80 00    	lea    0x800375,%esi
+  800373:	0f 34                	sysenter
+
+00800375 <after_sysenter_label_1016>:
+  800375:	5e                   	pop    %esi
+  800376:	5d                   	pop    %ebp
+  800377:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80037a:	85 c0                	test   %eax,%eax
+  80037c:	7f 07                	jg     800385 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80037e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5f                   	pop    %edi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800385:	83 ec 0c             	sub    $0xc,%esp
+  800388:	50                   	push   %eax
+  800389:	6a 0a                	push   $0xa
+  80038b:	68 ca 46 80 00       	push   $0x8046ca
+  800390:	6a 54                	push   $0x54
+  800392:	68 e7 46 80 00       	push   $0x8046e7
+  800397:	e8 17 2e 00 00       	call   8031b3 <_panic>
+
+0080039c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80039c:	55                   	push   %ebp
+  80039d:	89 e5                	mov    %esp,%ebp
+  80039f:	57                   	push   %edi
+  8003a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8003ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b2:	6a 00                	push   $0x0
+  8003b4:	55                   	push   %ebp
+  8003b5:	56                   	push   %esi
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	8d 35 c0 03 80 00    	lea    0x8003c0,%esi
+  8003be:	0f 34                	sysenter
+
+008003c0 <after_sysenter_label_1126>:
+  8003c0:	5e                   	pop    %esi
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8003c5:	5b                   	pop    %ebx
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+
+008003c9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8003ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003db:	89 cb                	mov    %ecx,%ebx
+  8003dd:	89 cf                	mov    %ecx,%edi
+  8003df:	6a 00                	push   $0x0
+  8003e1:	55                   	push   %ebp
+  8003e2:	56                   	push   %esi
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	8d 35 ed 03 80 00    	lea    0x8003ed,%esi
+  8003eb:	0f 34                	sysenter
+
+008003ed <after_sysenter_label_1210>:
+  8003ed:	5e                   	pop    %esi
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8003f2:	85 c0                	test   %eax,%eax
+  8003f4:	7f 07                	jg     8003fd <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8003f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003f9:	5b                   	pop    %ebx
+  8003fa:	5f                   	pop    %edi
+  8003fb:	5d                   	pop    %ebp
+  8003fc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fd:	83 ec 0c             	sub    $0xc,%esp
+  800400:	50                   	push   %eax
+  800401:	6a 0d                	push   $0xd
+  800403:	68 ca 46 80 00       	push   $0x8046ca
+  800408:	6a 54                	push   $0x54
+  80040a:	68 e7 46 80 00       	push   $0x8046e7
+  80040f:	e8 9f 2d 00 00       	call   8031b3 <_panic>
+
+00800414 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800419:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80041e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800421:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800424:	b8 42 00 00 00       	mov    $0x42,%eax
+  800429:	89 df                	mov    %ebx,%edi
+  80042b:	6a 00                	push   $0x0
+  80042d:	55                   	push   %ebp
+  80042e:	56                   	push   %esi
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	8d 35 39 04 80 00    	lea    0x800439,%esi
+  800437:	0f 34                	sysenter
+
+00800439 <after_sysenter_label_1311>:
+  800439:	5e                   	pop    %esi
+  80043a:	5d                   	pop    %ebp
+  80043b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	7f 07                	jg     800449 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800442:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5f                   	pop    %edi
+  800447:	5d                   	pop    %ebp
+  800448:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800449:	83 ec 0c             	sub    $0xc,%esp
+  80044c:	50                   	push   %eax
+  80044d:	6a 42                	push   $0x42
+  80044f:	68 ca 46 80 00       	push   $0x8046ca
+  800454:	6a 54                	push   $0x54
+  800456:	68 e7 46 80 00       	push   $0x8046e7
+  80045b:	e8 53 2d 00 00       	call   8031b3 <_panic>
+
+00800460 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	57                   	push   %edi
+  800464:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800465:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80046f:	89 d1                	mov    %edx,%ecx
+  800471:	89 d3                	mov    %edx,%ebx
+  800473:	89 d7                	mov    %edx,%edi
+  800475:	6a 00                	push   $0x0
+  800477:	55                   	push   %ebp
+  800478:	56                   	push   %esi
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	8d 35 83 04 80 00    	lea    0x800483,%esi
+  800481:	0f 34                	sysenter
+
+00800483 <after_sysenter_label_1411>:
+  800483:	5e                   	pop    %esi
+  800484:	5d                   	pop    %ebp
+  800485:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800488:	5b                   	pop    %ebx
+  800489:	5f                   	pop    %edi
+  80048a:	5d                   	pop    %ebp
+  80048b:	c3                   	ret
+
+0080048c <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	57                   	push   %edi
+  800490:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800496:	8b 55 08             	mov    0x8(%ebp),%edx
+  800499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004a1:	89 df                	mov    %ebx,%edi
+  8004a3:	6a 00                	push   $0x0
+  8004a5:	55                   	push   %ebp
+  8004a6:	56                   	push   %esi
+  8004a7:	89 e5                	mov    %esp,%ebp
+  8004a9:	8d 35 b1 04 80 00    	lea    0x8004b1,%esi
+  8004af:	0f 34                	sysenter
+
+008004b1 <after_sysenter_label_1497>:
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5d                   	pop    %ebp
+  8004b3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004b6:	5b                   	pop    %ebx
+  8004b7:	5f                   	pop    %edi
+  8004b8:	5d                   	pop    %ebp
+  8004b9:	c3                   	ret
+
+008004ba <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8004ba:	55                   	push   %ebp
+  8004bb:	89 e5                	mov    %esp,%ebp
+  8004bd:	57                   	push   %edi
+  8004be:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ca:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004cf:	89 df                	mov    %ebx,%edi
+  8004d1:	6a 00                	push   $0x0
+  8004d3:	55                   	push   %ebp
+  8004d4:	56                   	push   %esi
+  8004d5:	89 e5                	mov    %esp,%ebp
+  8004d7:	8d 35 df 04 80 00    	lea    0x8004df,%esi
+  8004dd:	0f 34                	sysenter
+
+008004df <after_sysenter_label_1583>:
+  8004df:	5e                   	pop    %esi
+  8004e0:	5d                   	pop    %ebp
+  8004e1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8004e4:	5b                   	pop    %ebx
+  8004e5:	5f                   	pop    %edi
+  8004e6:	5d                   	pop    %ebp
+  8004e7:	c3                   	ret
+
+008004e8 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8004e8:	55                   	push   %ebp
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	57                   	push   %edi
+  8004ec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8004ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8004f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800500:	6a 00                	push   $0x0
+  800502:	55                   	push   %ebp
+  800503:	56                   	push   %esi
+  800504:	89 e5                	mov    %esp,%ebp
+  800506:	8d 35 0e 05 80 00    	lea    0x80050e,%esi
+  80050c:	0f 34                	sysenter
+
+0080050e <after_sysenter_label_1672>:
+  80050e:	5e                   	pop    %esi
+  80050f:	5d                   	pop    %ebp
+  800510:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800513:	5b                   	pop    %ebx
+  800514:	5f                   	pop    %edi
+  800515:	5d                   	pop    %ebp
+  800516:	c3                   	ret
+
+00800517 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800517:	55                   	push   %ebp
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	57                   	push   %edi
+  80051b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80051c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800521:	8b 55 08             	mov    0x8(%ebp),%edx
+  800524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800527:	b8 12 00 00 00       	mov    $0x12,%eax
+  80052c:	89 df                	mov    %ebx,%edi
+  80052e:	6a 00                	push   $0x0
+  800530:	55                   	push   %ebp
+  800531:	56                   	push   %esi
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	8d 35 3c 05 80 00    	lea    0x80053c,%esi
+  80053a:	0f 34                	sysenter
+
+0080053c <after_sysenter_label_1758>:
+  80053c:	5e                   	pop    %esi
+  80053d:	5d                   	pop    %ebp
+  80053e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800541:	5b                   	pop    %ebx
+  800542:	5f                   	pop    %edi
+  800543:	5d                   	pop    %ebp
+  800544:	c3                   	ret
+
+00800545 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800545:	55                   	push   %ebp
+  800546:	89 e5                	mov    %esp,%ebp
+  800548:	57                   	push   %edi
+  800549:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80054a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800552:	b8 13 00 00 00       	mov    $0x13,%eax
+  800557:	89 cb                	mov    %ecx,%ebx
+  800559:	89 cf                	mov    %ecx,%edi
+  80055b:	6a 00                	push   $0x0
+  80055d:	55                   	push   %ebp
+  80055e:	56                   	push   %esi
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	8d 35 69 05 80 00    	lea    0x800569,%esi
+  800567:	0f 34                	sysenter
+
+00800569 <after_sysenter_label_1842>:
+  800569:	5e                   	pop    %esi
+  80056a:	5d                   	pop    %ebp
+  80056b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80056e:	85 c0                	test   %eax,%eax
+  800570:	7f 07                	jg     800579 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800572:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800575:	5b                   	pop    %ebx
+  800576:	5f                   	pop    %edi
+  800577:	5d                   	pop    %ebp
+  800578:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800579:	83 ec 0c             	sub    $0xc,%esp
+  80057c:	50                   	push   %eax
+  80057d:	6a 13                	push   $0x13
+  80057f:	68 ca 46 80 00       	push   $0x8046ca
+  800584:	6a 54                	push   $0x54
+  800586:	68 e7 46 80 00       	push   $0x8046e7
+  80058b:	e8 23 2c 00 00       	call   8031b3 <_panic>
+
+00800590 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800590:	55                   	push   %ebp
+  800591:	89 e5                	mov    %esp,%ebp
+  800593:	57                   	push   %edi
+  800594:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80059f:	89 d1                	mov    %edx,%ecx
+  8005a1:	89 d3                	mov    %edx,%ebx
+  8005a3:	89 d7                	mov    %edx,%edi
+  8005a5:	6a 00                	push   $0x0
+  8005a7:	55                   	push   %ebp
+  8005a8:	56                   	push   %esi
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	8d 35 b3 05 80 00    	lea    0x8005b3,%esi
+  8005b1:	0f 34                	sysenter
+
+008005b3 <after_sysenter_label_1939>:
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5d                   	pop    %ebp
+  8005b5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8005b8:	5b                   	pop    %ebx
+  8005b9:	5f                   	pop    %edi
+  8005ba:	5d                   	pop    %ebp
+  8005bb:	c3                   	ret
+
+008005bc <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8005bc:	55                   	push   %ebp
+  8005bd:	89 e5                	mov    %esp,%ebp
+  8005bf:	57                   	push   %edi
+  8005c0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005d4:	6a 00                	push   $0x0
+  8005d6:	55                   	push   %ebp
+  8005d7:	56                   	push   %esi
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	8d 35 e2 05 80 00    	lea    0x8005e2,%esi
+  8005e0:	0f 34                	sysenter
+
+008005e2 <after_sysenter_label_2028>:
+  8005e2:	5e                   	pop    %esi
+  8005e3:	5d                   	pop    %ebp
+  8005e4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8005e7:	5b                   	pop    %ebx
+  8005e8:	5f                   	pop    %edi
+  8005e9:	5d                   	pop    %ebp
+  8005ea:	c3                   	ret
+
+008005eb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8005eb:	55                   	push   %ebp
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	57                   	push   %edi
+  8005ef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8005f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fb:	b8 16 00 00 00       	mov    $0x16,%eax
+  800600:	89 df                	mov    %ebx,%edi
+  800602:	6a 00                	push   $0x0
+  800604:	55                   	push   %ebp
+  800605:	56                   	push   %esi
+  800606:	89 e5                	mov    %esp,%ebp
+  800608:	8d 35 10 06 80 00    	lea    0x800610,%esi
+  80060e:	0f 34                	sysenter
+
+00800610 <after_sysenter_label_2114>:
+  800610:	5e                   	pop    %esi
+  800611:	5d                   	pop    %ebp
+  800612:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  800615:	5b                   	pop    %ebx
+  800616:	5f                   	pop    %edi
+  800617:	5d                   	pop    %ebp
+  800618:	c3                   	ret
+
+00800619 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  800619:	55                   	push   %ebp
+  80061a:	89 e5                	mov    %esp,%ebp
+  80061c:	57                   	push   %edi
+  80061d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80061e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800623:	8b 55 08             	mov    0x8(%ebp),%edx
+  800626:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800629:	b8 17 00 00 00       	mov    $0x17,%eax
+  80062e:	89 df                	mov    %ebx,%edi
+  800630:	6a 00                	push   $0x0
+  800632:	55                   	push   %ebp
+  800633:	56                   	push   %esi
+  800634:	89 e5                	mov    %esp,%ebp
+  800636:	8d 35 3e 06 80 00    	lea    0x80063e,%esi
+  80063c:	0f 34                	sysenter
+
+0080063e <after_sysenter_label_2200>:
+  80063e:	5e                   	pop    %esi
+  80063f:	5d                   	pop    %ebp
+  800640:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  800643:	5b                   	pop    %ebx
+  800644:	5f                   	pop    %edi
+  800645:	5d                   	pop    %ebp
+  800646:	c3                   	ret
+
+00800647 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  800647:	55                   	push   %ebp
+  800648:	89 e5                	mov    %esp,%ebp
+  80064a:	57                   	push   %edi
+  80064b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80064c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800651:	8b 55 08             	mov    0x8(%ebp),%edx
+  800654:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800657:	b8 18 00 00 00       	mov    $0x18,%eax
+  80065c:	89 df                	mov    %ebx,%edi
+  80065e:	6a 00                	push   $0x0
+  800660:	55                   	push   %ebp
+  800661:	56                   	push   %esi
+  800662:	89 e5                	mov    %esp,%ebp
+  800664:	8d 35 6c 06 80 00    	lea    0x80066c,%esi
+  80066a:	0f 34                	sysenter
+
+0080066c <after_sysenter_label_2286>:
+  80066c:	5e                   	pop    %esi
+  80066d:	5d                   	pop    %ebp
+  80066e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  800671:	5b                   	pop    %ebx
+  800672:	5f                   	pop    %edi
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800678:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800680:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800683:	5d                   	pop    %ebp
+  800684:	c3                   	ret
+
+00800685 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800685:	55                   	push   %ebp
+  800686:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800688:	8b 45 08             	mov    0x8(%ebp),%eax
+  80068b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800690:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800695:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80069a:	5d                   	pop    %ebp
+  80069b:	c3                   	ret
+
+0080069c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80069c:	55                   	push   %ebp
+  80069d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80069f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006a4:	eb 02                	jmp    8006a8 <fd_alloc+0xc>
+  8006a6:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006a8:	89 c2                	mov    %eax,%edx
+  8006aa:	c1 ea 16             	shr    $0x16,%edx
+  8006ad:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006b4:	f6 c2 01             	test   $0x1,%dl
+  8006b7:	74 2b                	je     8006e4 <fd_alloc+0x48>
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	c1 ea 0c             	shr    $0xc,%edx
+  8006be:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006c5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006cb:	f6 c1 01             	test   $0x1,%cl
+  8006ce:	74 14                	je     8006e4 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8006d0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006d6:	75 ce                	jne    8006a6 <fd_alloc+0xa>
+  8006d8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006dd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006e2:	eb 05                	jmp    8006e9 <fd_alloc+0x4d>
+			return 0;
+  8006e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ec:	89 02                	mov    %eax,(%edx)
+}
+  8006ee:	89 c8                	mov    %ecx,%eax
+  8006f0:	5d                   	pop    %ebp
+  8006f1:	c3                   	ret
+
+008006f2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006f2:	55                   	push   %ebp
+  8006f3:	89 e5                	mov    %esp,%ebp
+  8006f5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006f8:	83 f8 1f             	cmp    $0x1f,%eax
+  8006fb:	77 30                	ja     80072d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006fd:	c1 e0 0c             	shl    $0xc,%eax
+  800700:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800705:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80070b:	f6 c2 01             	test   $0x1,%dl
+  80070e:	74 24                	je     800734 <fd_lookup+0x42>
+  800710:	89 c2                	mov    %eax,%edx
+  800712:	c1 ea 0c             	shr    $0xc,%edx
+  800715:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80071c:	f6 c2 01             	test   $0x1,%dl
+  80071f:	74 1a                	je     80073b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800721:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800724:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800726:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80072b:	5d                   	pop    %ebp
+  80072c:	c3                   	ret
+		return -E_INVAL;
+  80072d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800732:	eb f7                	jmp    80072b <fd_lookup+0x39>
+		return -E_INVAL;
+  800734:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800739:	eb f0                	jmp    80072b <fd_lookup+0x39>
+  80073b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800740:	eb e9                	jmp    80072b <fd_lookup+0x39>
+
+00800742 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800742:	55                   	push   %ebp
+  800743:	89 e5                	mov    %esp,%ebp
+  800745:	53                   	push   %ebx
+  800746:	83 ec 04             	sub    $0x4,%esp
+  800749:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800751:	eb 03                	jmp    800756 <dev_lookup+0x14>
+  800753:	83 c0 01             	add    $0x1,%eax
+  800756:	8b 1c 85 74 47 80 00 	mov    0x804774(,%eax,4),%ebx
+  80075d:	85 db                	test   %ebx,%ebx
+  80075f:	74 0b                	je     80076c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800761:	39 13                	cmp    %edx,(%ebx)
+  800763:	75 ee                	jne    800753 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076a:	eb 49                	jmp    8007b5 <dev_lookup+0x73>
+  80076c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80076e:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800774:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800779:	77 18                	ja     800793 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80077b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800780:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800782:	c1 e8 10             	shr    $0x10,%eax
+  800785:	74 0c                	je     800793 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800787:	c1 e0 10             	shl    $0x10,%eax
+  80078a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80078f:	29 c1                	sub    %eax,%ecx
+  800791:	eb 06                	jmp    800799 <dev_lookup+0x57>
+		return pthread_main_tls;
+  800793:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800799:	8b 01                	mov    (%ecx),%eax
+  80079b:	8b 40 48             	mov    0x48(%eax),%eax
+  80079e:	83 ec 04             	sub    $0x4,%esp
+  8007a1:	52                   	push   %edx
+  8007a2:	50                   	push   %eax
+  8007a3:	68 f8 46 80 00       	push   $0x8046f8
+  8007a8:	e8 e1 2a 00 00       	call   80328e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8007ad:	83 c4 10             	add    $0x10,%esp
+  8007b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8007b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b8:	89 1a                	mov    %ebx,(%edx)
+}
+  8007ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007bd:	c9                   	leave
+  8007be:	c3                   	ret
+
+008007bf <fd_close>:
+{
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	57                   	push   %edi
+  8007c3:	56                   	push   %esi
+  8007c4:	53                   	push   %ebx
+  8007c5:	83 ec 24             	sub    $0x24,%esp
+  8007c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007d1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8007d2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007d8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007db:	50                   	push   %eax
+  8007dc:	e8 11 ff ff ff       	call   8006f2 <fd_lookup>
+  8007e1:	89 c3                	mov    %eax,%ebx
+  8007e3:	83 c4 10             	add    $0x10,%esp
+  8007e6:	85 c0                	test   %eax,%eax
+  8007e8:	78 05                	js     8007ef <fd_close+0x30>
+	    || fd != fd2)
+  8007ea:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007ed:	74 16                	je     800805 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8007ef:	89 f8                	mov    %edi,%eax
+  8007f1:	84 c0                	test   %al,%al
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007fb:	89 d8                	mov    %ebx,%eax
+  8007fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800800:	5b                   	pop    %ebx
+  800801:	5e                   	pop    %esi
+  800802:	5f                   	pop    %edi
+  800803:	5d                   	pop    %ebp
+  800804:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800805:	83 ec 08             	sub    $0x8,%esp
+  800808:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80080b:	50                   	push   %eax
+  80080c:	ff 36                	push   (%esi)
+  80080e:	e8 2f ff ff ff       	call   800742 <dev_lookup>
+  800813:	89 c3                	mov    %eax,%ebx
+  800815:	83 c4 10             	add    $0x10,%esp
+  800818:	85 c0                	test   %eax,%eax
+  80081a:	78 1a                	js     800836 <fd_close+0x77>
+		if (dev->dev_close)
+  80081c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80081f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800822:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800827:	85 c0                	test   %eax,%eax
+  800829:	74 0b                	je     800836 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80082b:	83 ec 0c             	sub    $0xc,%esp
+  80082e:	56                   	push   %esi
+  80082f:	ff d0                	call   *%eax
+  800831:	89 c3                	mov    %eax,%ebx
+  800833:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	56                   	push   %esi
+  80083a:	6a 00                	push   $0x0
+  80083c:	e8 2b fa ff ff       	call   80026c <sys_page_unmap>
+	return r;
+  800841:	83 c4 10             	add    $0x10,%esp
+  800844:	eb b5                	jmp    8007fb <fd_close+0x3c>
+
+00800846 <close>:
+
+int
+close(int fdnum)
+{
+  800846:	55                   	push   %ebp
+  800847:	89 e5                	mov    %esp,%ebp
+  800849:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80084c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80084f:	50                   	push   %eax
+  800850:	ff 75 08             	push   0x8(%ebp)
+  800853:	e8 9a fe ff ff       	call   8006f2 <fd_lookup>
+  800858:	83 c4 10             	add    $0x10,%esp
+  80085b:	85 c0                	test   %eax,%eax
+  80085d:	79 02                	jns    800861 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80085f:	c9                   	leave
+  800860:	c3                   	ret
+		return fd_close(fd, 1);
+  800861:	83 ec 08             	sub    $0x8,%esp
+  800864:	6a 01                	push   $0x1
+  800866:	ff 75 f4             	push   -0xc(%ebp)
+  800869:	e8 51 ff ff ff       	call   8007bf <fd_close>
+  80086e:	83 c4 10             	add    $0x10,%esp
+  800871:	eb ec                	jmp    80085f <close+0x19>
+
+00800873 <close_all>:
+
+void
+close_all(void)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	53                   	push   %ebx
+  800877:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80087a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80087f:	83 ec 0c             	sub    $0xc,%esp
+  800882:	53                   	push   %ebx
+  800883:	e8 be ff ff ff       	call   800846 <close>
+	for (i = 0; i < MAXFD; i++)
+  800888:	83 c3 01             	add    $0x1,%ebx
+  80088b:	83 c4 10             	add    $0x10,%esp
+  80088e:	83 fb 20             	cmp    $0x20,%ebx
+  800891:	75 ec                	jne    80087f <close_all+0xc>
+}
+  800893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+
+00800898 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	57                   	push   %edi
+  80089c:	56                   	push   %esi
+  80089d:	53                   	push   %ebx
+  80089e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8008a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008a4:	50                   	push   %eax
+  8008a5:	ff 75 08             	push   0x8(%ebp)
+  8008a8:	e8 45 fe ff ff       	call   8006f2 <fd_lookup>
+  8008ad:	89 c3                	mov    %eax,%ebx
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	78 7f                	js     800935 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8008b6:	83 ec 0c             	sub    $0xc,%esp
+  8008b9:	ff 75 0c             	push   0xc(%ebp)
+  8008bc:	e8 85 ff ff ff       	call   800846 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8008c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c4:	c1 e6 0c             	shl    $0xc,%esi
+  8008c7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8008cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008d0:	89 3c 24             	mov    %edi,(%esp)
+  8008d3:	e8 ad fd ff ff       	call   800685 <fd2data>
+  8008d8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8008da:	89 34 24             	mov    %esi,(%esp)
+  8008dd:	e8 a3 fd ff ff       	call   800685 <fd2data>
+  8008e2:	83 c4 10             	add    $0x10,%esp
+  8008e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8008e8:	89 d8                	mov    %ebx,%eax
+  8008ea:	c1 e8 16             	shr    $0x16,%eax
+  8008ed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008f4:	a8 01                	test   $0x1,%al
+  8008f6:	74 11                	je     800909 <dup+0x71>
+  8008f8:	89 d8                	mov    %ebx,%eax
+  8008fa:	c1 e8 0c             	shr    $0xc,%eax
+  8008fd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800904:	f6 c2 01             	test   $0x1,%dl
+  800907:	75 36                	jne    80093f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800909:	89 f8                	mov    %edi,%eax
+  80090b:	c1 e8 0c             	shr    $0xc,%eax
+  80090e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800915:	83 ec 0c             	sub    $0xc,%esp
+  800918:	25 07 0e 00 00       	and    $0xe07,%eax
+  80091d:	50                   	push   %eax
+  80091e:	56                   	push   %esi
+  80091f:	6a 00                	push   $0x0
+  800921:	57                   	push   %edi
+  800922:	6a 00                	push   $0x0
+  800924:	e8 f7 f8 ff ff       	call   800220 <sys_page_map>
+  800929:	89 c3                	mov    %eax,%ebx
+  80092b:	83 c4 20             	add    $0x20,%esp
+  80092e:	85 c0                	test   %eax,%eax
+  800930:	78 33                	js     800965 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800932:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800935:	89 d8                	mov    %ebx,%eax
+  800937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5f                   	pop    %edi
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80093f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800946:	83 ec 0c             	sub    $0xc,%esp
+  800949:	25 07 0e 00 00       	and    $0xe07,%eax
+  80094e:	50                   	push   %eax
+  80094f:	ff 75 d4             	push   -0x2c(%ebp)
+  800952:	6a 00                	push   $0x0
+  800954:	53                   	push   %ebx
+  800955:	6a 00                	push   $0x0
+  800957:	e8 c4 f8 ff ff       	call   800220 <sys_page_map>
+  80095c:	89 c3                	mov    %eax,%ebx
+  80095e:	83 c4 20             	add    $0x20,%esp
+  800961:	85 c0                	test   %eax,%eax
+  800963:	79 a4                	jns    800909 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800965:	83 ec 08             	sub    $0x8,%esp
+  800968:	56                   	push   %esi
+  800969:	6a 00                	push   $0x0
+  80096b:	e8 fc f8 ff ff       	call   80026c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800970:	83 c4 08             	add    $0x8,%esp
+  800973:	ff 75 d4             	push   -0x2c(%ebp)
+  800976:	6a 00                	push   $0x0
+  800978:	e8 ef f8 ff ff       	call   80026c <sys_page_unmap>
+	return r;
+  80097d:	83 c4 10             	add    $0x10,%esp
+  800980:	eb b3                	jmp    800935 <dup+0x9d>
+
+00800982 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	56                   	push   %esi
+  800986:	53                   	push   %ebx
+  800987:	83 ec 18             	sub    $0x18,%esp
+  80098a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80098d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800990:	50                   	push   %eax
+  800991:	53                   	push   %ebx
+  800992:	e8 5b fd ff ff       	call   8006f2 <fd_lookup>
+  800997:	83 c4 10             	add    $0x10,%esp
+  80099a:	85 c0                	test   %eax,%eax
+  80099c:	78 3c                	js     8009da <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80099e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009a1:	83 ec 08             	sub    $0x8,%esp
+  8009a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009a7:	50                   	push   %eax
+  8009a8:	ff 36                	push   (%esi)
+  8009aa:	e8 93 fd ff ff       	call   800742 <dev_lookup>
+  8009af:	83 c4 10             	add    $0x10,%esp
+  8009b2:	85 c0                	test   %eax,%eax
+  8009b4:	78 24                	js     8009da <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009b6:	8b 46 08             	mov    0x8(%esi),%eax
+  8009b9:	83 e0 03             	and    $0x3,%eax
+  8009bc:	83 f8 01             	cmp    $0x1,%eax
+  8009bf:	74 20                	je     8009e1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8009c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c4:	8b 40 08             	mov    0x8(%eax),%eax
+  8009c7:	85 c0                	test   %eax,%eax
+  8009c9:	74 61                	je     800a2c <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8009cb:	83 ec 04             	sub    $0x4,%esp
+  8009ce:	ff 75 10             	push   0x10(%ebp)
+  8009d1:	ff 75 0c             	push   0xc(%ebp)
+  8009d4:	56                   	push   %esi
+  8009d5:	ff d0                	call   *%eax
+  8009d7:	83 c4 10             	add    $0x10,%esp
+}
+  8009da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009dd:	5b                   	pop    %ebx
+  8009de:	5e                   	pop    %esi
+  8009df:	5d                   	pop    %ebp
+  8009e0:	c3                   	ret
+  8009e1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8009e3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8009e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8009ee:	77 18                	ja     800a08 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8009f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8009f5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8009f7:	c1 e8 10             	shr    $0x10,%eax
+  8009fa:	74 0c                	je     800a08 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8009fc:	c1 e0 10             	shl    $0x10,%eax
+  8009ff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800a04:	29 c2                	sub    %eax,%edx
+  800a06:	eb 06                	jmp    800a0e <read+0x8c>
+		return pthread_main_tls;
+  800a08:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a0e:	8b 02                	mov    (%edx),%eax
+  800a10:	8b 40 48             	mov    0x48(%eax),%eax
+  800a13:	83 ec 04             	sub    $0x4,%esp
+  800a16:	53                   	push   %ebx
+  800a17:	50                   	push   %eax
+  800a18:	68 39 47 80 00       	push   $0x804739
+  800a1d:	e8 6c 28 00 00       	call   80328e <cprintf>
+		return -E_INVAL;
+  800a22:	83 c4 10             	add    $0x10,%esp
+  800a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a2a:	eb ae                	jmp    8009da <read+0x58>
+		return -E_NOT_SUPP;
+  800a2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a31:	eb a7                	jmp    8009da <read+0x58>
+
+00800a33 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	57                   	push   %edi
+  800a37:	56                   	push   %esi
+  800a38:	53                   	push   %ebx
+  800a39:	83 ec 0c             	sub    $0xc,%esp
+  800a3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a47:	eb 02                	jmp    800a4b <readn+0x18>
+  800a49:	01 c3                	add    %eax,%ebx
+  800a4b:	39 f3                	cmp    %esi,%ebx
+  800a4d:	73 21                	jae    800a70 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a4f:	83 ec 04             	sub    $0x4,%esp
+  800a52:	89 f0                	mov    %esi,%eax
+  800a54:	29 d8                	sub    %ebx,%eax
+  800a56:	50                   	push   %eax
+  800a57:	89 d8                	mov    %ebx,%eax
+  800a59:	03 45 0c             	add    0xc(%ebp),%eax
+  800a5c:	50                   	push   %eax
+  800a5d:	57                   	push   %edi
+  800a5e:	e8 1f ff ff ff       	call   800982 <read>
+		if (m < 0)
+  800a63:	83 c4 10             	add    $0x10,%esp
+  800a66:	85 c0                	test   %eax,%eax
+  800a68:	78 04                	js     800a6e <readn+0x3b>
+			return m;
+		if (m == 0)
+  800a6a:	75 dd                	jne    800a49 <readn+0x16>
+  800a6c:	eb 02                	jmp    800a70 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800a6e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800a70:	89 d8                	mov    %ebx,%eax
+  800a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a75:	5b                   	pop    %ebx
+  800a76:	5e                   	pop    %esi
+  800a77:	5f                   	pop    %edi
+  800a78:	5d                   	pop    %ebp
+  800a79:	c3                   	ret
+
+00800a7a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  800a7d:	56                   	push   %esi
+  800a7e:	53                   	push   %ebx
+  800a7f:	83 ec 18             	sub    $0x18,%esp
+  800a82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a88:	50                   	push   %eax
+  800a89:	53                   	push   %ebx
+  800a8a:	e8 63 fc ff ff       	call   8006f2 <fd_lookup>
+  800a8f:	83 c4 10             	add    $0x10,%esp
+  800a92:	85 c0                	test   %eax,%eax
+  800a94:	78 37                	js     800acd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a99:	83 ec 08             	sub    $0x8,%esp
+  800a9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a9f:	50                   	push   %eax
+  800aa0:	ff 36                	push   (%esi)
+  800aa2:	e8 9b fc ff ff       	call   800742 <dev_lookup>
+  800aa7:	83 c4 10             	add    $0x10,%esp
+  800aaa:	85 c0                	test   %eax,%eax
+  800aac:	78 1f                	js     800acd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800aae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ab2:	74 20                	je     800ad4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab7:	8b 40 0c             	mov    0xc(%eax),%eax
+  800aba:	85 c0                	test   %eax,%eax
+  800abc:	74 61                	je     800b1f <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800abe:	83 ec 04             	sub    $0x4,%esp
+  800ac1:	ff 75 10             	push   0x10(%ebp)
+  800ac4:	ff 75 0c             	push   0xc(%ebp)
+  800ac7:	56                   	push   %esi
+  800ac8:	ff d0                	call   *%eax
+  800aca:	83 c4 10             	add    $0x10,%esp
+}
+  800acd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ad0:	5b                   	pop    %ebx
+  800ad1:	5e                   	pop    %esi
+  800ad2:	5d                   	pop    %ebp
+  800ad3:	c3                   	ret
+  800ad4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ad6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800adc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800ae1:	77 18                	ja     800afb <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800ae3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800ae8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800aea:	c1 e8 10             	shr    $0x10,%eax
+  800aed:	74 0c                	je     800afb <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800aef:	c1 e0 10             	shl    $0x10,%eax
+  800af2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800af7:	29 c2                	sub    %eax,%edx
+  800af9:	eb 06                	jmp    800b01 <write+0x87>
+		return pthread_main_tls;
+  800afb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b01:	8b 02                	mov    (%edx),%eax
+  800b03:	8b 40 48             	mov    0x48(%eax),%eax
+  800b06:	83 ec 04             	sub    $0x4,%esp
+  800b09:	53                   	push   %ebx
+  800b0a:	50                   	push   %eax
+  800b0b:	68 55 47 80 00       	push   $0x804755
+  800b10:	e8 79 27 00 00       	call   80328e <cprintf>
+		return -E_INVAL;
+  800b15:	83 c4 10             	add    $0x10,%esp
+  800b18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1d:	eb ae                	jmp    800acd <write+0x53>
+		return -E_NOT_SUPP;
+  800b1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b24:	eb a7                	jmp    800acd <write+0x53>
+
+00800b26 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b2f:	50                   	push   %eax
+  800b30:	ff 75 08             	push   0x8(%ebp)
+  800b33:	e8 ba fb ff ff       	call   8006f2 <fd_lookup>
+  800b38:	83 c4 10             	add    $0x10,%esp
+  800b3b:	85 c0                	test   %eax,%eax
+  800b3d:	78 0e                	js     800b4d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b45:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+
+00800b4f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  800b54:	83 ec 18             	sub    $0x18,%esp
+  800b57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b5d:	50                   	push   %eax
+  800b5e:	53                   	push   %ebx
+  800b5f:	e8 8e fb ff ff       	call   8006f2 <fd_lookup>
+  800b64:	83 c4 10             	add    $0x10,%esp
+  800b67:	85 c0                	test   %eax,%eax
+  800b69:	78 34                	js     800b9f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b6b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b6e:	83 ec 08             	sub    $0x8,%esp
+  800b71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b74:	50                   	push   %eax
+  800b75:	ff 36                	push   (%esi)
+  800b77:	e8 c6 fb ff ff       	call   800742 <dev_lookup>
+  800b7c:	83 c4 10             	add    $0x10,%esp
+  800b7f:	85 c0                	test   %eax,%eax
+  800b81:	78 1c                	js     800b9f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b83:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b87:	74 1d                	je     800ba6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b8c:	8b 40 18             	mov    0x18(%eax),%eax
+  800b8f:	85 c0                	test   %eax,%eax
+  800b91:	74 5e                	je     800bf1 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b93:	83 ec 08             	sub    $0x8,%esp
+  800b96:	ff 75 0c             	push   0xc(%ebp)
+  800b99:	56                   	push   %esi
+  800b9a:	ff d0                	call   *%eax
+  800b9c:	83 c4 10             	add    $0x10,%esp
+}
+  800b9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ba2:	5b                   	pop    %ebx
+  800ba3:	5e                   	pop    %esi
+  800ba4:	5d                   	pop    %ebp
+  800ba5:	c3                   	ret
+  800ba6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800ba8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800bae:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800bb3:	77 18                	ja     800bcd <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800bb5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800bba:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800bbc:	c1 e8 10             	shr    $0x10,%eax
+  800bbf:	74 0c                	je     800bcd <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800bc1:	c1 e0 10             	shl    $0x10,%eax
+  800bc4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800bc9:	29 c2                	sub    %eax,%edx
+  800bcb:	eb 06                	jmp    800bd3 <ftruncate+0x84>
+		return pthread_main_tls;
+  800bcd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  800bd3:	8b 02                	mov    (%edx),%eax
+  800bd5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bd8:	83 ec 04             	sub    $0x4,%esp
+  800bdb:	53                   	push   %ebx
+  800bdc:	50                   	push   %eax
+  800bdd:	68 18 47 80 00       	push   $0x804718
+  800be2:	e8 a7 26 00 00       	call   80328e <cprintf>
+		return -E_INVAL;
+  800be7:	83 c4 10             	add    $0x10,%esp
+  800bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bef:	eb ae                	jmp    800b9f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf6:	eb a7                	jmp    800b9f <ftruncate+0x50>
+
+00800bf8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	56                   	push   %esi
+  800bfc:	53                   	push   %ebx
+  800bfd:	83 ec 18             	sub    $0x18,%esp
+  800c00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c03:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c06:	50                   	push   %eax
+  800c07:	ff 75 08             	push   0x8(%ebp)
+  800c0a:	e8 e3 fa ff ff       	call   8006f2 <fd_lookup>
+  800c0f:	83 c4 10             	add    $0x10,%esp
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	78 49                	js     800c5f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c16:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c19:	83 ec 08             	sub    $0x8,%esp
+  800c1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c1f:	50                   	push   %eax
+  800c20:	ff 36                	push   (%esi)
+  800c22:	e8 1b fb ff ff       	call   800742 <dev_lookup>
+  800c27:	83 c4 10             	add    $0x10,%esp
+  800c2a:	85 c0                	test   %eax,%eax
+  800c2c:	78 31                	js     800c5f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c31:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c35:	74 2f                	je     800c66 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c37:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c3a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c41:	00 00 00 
+	stat->st_isdir = 0;
+  800c44:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c4b:	00 00 00 
+	stat->st_dev = dev;
+  800c4e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c54:	83 ec 08             	sub    $0x8,%esp
+  800c57:	53                   	push   %ebx
+  800c58:	56                   	push   %esi
+  800c59:	ff 50 14             	call   *0x14(%eax)
+  800c5c:	83 c4 10             	add    $0x10,%esp
+}
+  800c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6b:	eb f2                	jmp    800c5f <fstat+0x67>
+
+00800c6d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c72:	83 ec 08             	sub    $0x8,%esp
+  800c75:	6a 00                	push   $0x0
+  800c77:	ff 75 08             	push   0x8(%ebp)
+  800c7a:	e8 4b 03 00 00       	call   800fca <open>
+  800c7f:	89 c3                	mov    %eax,%ebx
+  800c81:	83 c4 10             	add    $0x10,%esp
+  800c84:	85 c0                	test   %eax,%eax
+  800c86:	78 1b                	js     800ca3 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c88:	83 ec 08             	sub    $0x8,%esp
+  800c8b:	ff 75 0c             	push   0xc(%ebp)
+  800c8e:	50                   	push   %eax
+  800c8f:	e8 64 ff ff ff       	call   800bf8 <fstat>
+  800c94:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c96:	89 1c 24             	mov    %ebx,(%esp)
+  800c99:	e8 a8 fb ff ff       	call   800846 <close>
+	return r;
+  800c9e:	83 c4 10             	add    $0x10,%esp
+  800ca1:	89 f3                	mov    %esi,%ebx
+}
+  800ca3:	89 d8                	mov    %ebx,%eax
+  800ca5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	89 c6                	mov    %eax,%esi
+  800cb3:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cb5:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800cbc:	74 27                	je     800ce5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cbe:	6a 07                	push   $0x7
+  800cc0:	68 00 70 80 00       	push   $0x807000
+  800cc5:	56                   	push   %esi
+  800cc6:	ff 35 00 60 80 00    	push   0x806000
+  800ccc:	e8 51 36 00 00       	call   804322 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800cd1:	83 c4 0c             	add    $0xc,%esp
+  800cd4:	6a 00                	push   $0x0
+  800cd6:	53                   	push   %ebx
+  800cd7:	6a 00                	push   $0x0
+  800cd9:	e8 4e 35 00 00       	call   80422c <ipc_recv>
+}
+  800cde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	6a 01                	push   $0x1
+  800cea:	e8 89 36 00 00       	call   804378 <ipc_find_env>
+  800cef:	a3 00 60 80 00       	mov    %eax,0x806000
+  800cf4:	83 c4 10             	add    $0x10,%esp
+  800cf7:	eb c5                	jmp    800cbe <fsipc+0x12>
+
+00800cf9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	53                   	push   %ebx
+  800cfd:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  800d00:	68 04 60 80 00       	push   $0x806004
+  800d05:	e8 29 1b 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d10:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  800d15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d18:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  800d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d22:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d27:	e8 80 ff ff ff       	call   800cac <fsipc>
+  800d2c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d2e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d35:	e8 66 1b 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+}
+  800d3a:	89 d8                	mov    %ebx,%eax
+  800d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+00800d41 <devfile_flush>:
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	53                   	push   %ebx
+  800d45:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  800d48:	68 04 60 80 00       	push   $0x806004
+  800d4d:	e8 e1 1a 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d55:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d58:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  800d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d62:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d67:	e8 40 ff ff ff       	call   800cac <fsipc>
+  800d6c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800d6e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800d75:	e8 26 1b 00 00       	call   8028a0 <mutex_unlock>
+}
+  800d7a:	89 d8                	mov    %ebx,%eax
+  800d7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d7f:	c9                   	leave
+  800d80:	c3                   	ret
+
+00800d81 <devfile_stat>:
+{
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	68 04 60 80 00       	push   $0x806004
+  800d91:	e8 9d 1a 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d99:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d9c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dab:	e8 fc fe ff ff       	call   800cac <fsipc>
+  800db0:	89 c3                	mov    %eax,%ebx
+  800db2:	83 c4 10             	add    $0x10,%esp
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	79 16                	jns    800dcf <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  800db9:	83 ec 0c             	sub    $0xc,%esp
+  800dbc:	68 04 60 80 00       	push   $0x806004
+  800dc1:	e8 da 1a 00 00       	call   8028a0 <mutex_unlock>
+}
+  800dc6:	89 d8                	mov    %ebx,%eax
+  800dc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dcf:	83 ec 08             	sub    $0x8,%esp
+  800dd2:	68 00 70 80 00       	push   $0x807000
+  800dd7:	56                   	push   %esi
+  800dd8:	e8 95 2a 00 00       	call   803872 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  800ddd:	a1 80 70 80 00       	mov    0x807080,%eax
+  800de2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800de8:	a1 84 70 80 00       	mov    0x807084,%eax
+  800ded:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  800df3:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  800df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfb:	eb bc                	jmp    800db9 <devfile_stat+0x38>
+
+00800dfd <devfile_write>:
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	53                   	push   %ebx
+  800e01:	83 ec 10             	sub    $0x10,%esp
+  800e04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  800e07:	68 04 60 80 00       	push   $0x806004
+  800e0c:	e8 22 1a 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e14:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e17:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800e1c:	83 c4 10             	add    $0x10,%esp
+  800e1f:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  800e25:	76 3d                	jbe    800e64 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  800e27:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800e2c:	39 c3                	cmp    %eax,%ebx
+  800e2e:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  800e31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e34:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  800e39:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  800e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e44:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e49:	e8 5e fe ff ff       	call   800cac <fsipc>
+  800e4e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	68 04 60 80 00       	push   $0x806004
+  800e58:	e8 43 1a 00 00       	call   8028a0 <mutex_unlock>
+}
+  800e5d:	89 d8                	mov    %ebx,%eax
+  800e5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e62:	c9                   	leave
+  800e63:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  800e64:	83 ec 04             	sub    $0x4,%esp
+  800e67:	53                   	push   %ebx
+  800e68:	ff 75 0c             	push   0xc(%ebp)
+  800e6b:	68 0c 70 80 00       	push   $0x80700c
+  800e70:	e8 83 2b 00 00       	call   8039f8 <memmove>
+  800e75:	83 c4 10             	add    $0x10,%esp
+  800e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7d:	eb b5                	jmp    800e34 <devfile_write+0x37>
+
+00800e7f <devfile_read>:
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  800e91:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800e97:	0f 86 8c 00 00 00    	jbe    800f29 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  800e9d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  800ea2:	39 c3                	cmp    %eax,%ebx
+  800ea4:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ea7:	89 f8                	mov    %edi,%eax
+  800ea9:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800eac:	eb 0f                	jmp    800ebd <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  800eae:	0f b6 08             	movzbl (%eax),%ecx
+  800eb1:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  800eb3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800eb8:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  800ebd:	39 d0                	cmp    %edx,%eax
+  800ebf:	72 ed                	jb     800eae <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  800ec1:	83 ec 0c             	sub    $0xc,%esp
+  800ec4:	68 04 60 80 00       	push   $0x806004
+  800ec9:	e8 65 19 00 00       	call   802833 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ece:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ed1:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  800ed6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  800edc:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  800ee2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eec:	e8 bb fd ff ff       	call   800cac <fsipc>
+  800ef1:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  800ef3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  800efa:	e8 a1 19 00 00       	call   8028a0 <mutex_unlock>
+		assert(r <= (int) n);
+  800eff:	83 c4 10             	add    $0x10,%esp
+  800f02:	39 f3                	cmp    %esi,%ebx
+  800f04:	7c 0a                	jl     800f10 <devfile_read+0x91>
+}
+  800f06:	89 f0                	mov    %esi,%eax
+  800f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+		assert(r <= (int) n);
+  800f10:	68 88 47 80 00       	push   $0x804788
+  800f15:	68 95 47 80 00       	push   $0x804795
+  800f1a:	68 90 00 00 00       	push   $0x90
+  800f1f:	68 aa 47 80 00       	push   $0x8047aa
+  800f24:	e8 8a 22 00 00       	call   8031b3 <_panic>
+	mutex_lock(&fsipc_mu);
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	68 04 60 80 00       	push   $0x806004
+  800f31:	e8 fd 18 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f36:	8b 46 0c             	mov    0xc(%esi),%eax
+  800f39:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  800f3e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  800f44:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  800f4b:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  800f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f53:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f58:	e8 4f fd ff ff       	call   800cac <fsipc>
+  800f5d:	89 c6                	mov    %eax,%esi
+  800f5f:	83 c4 10             	add    $0x10,%esp
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	78 1d                	js     800f83 <devfile_read+0x104>
+		assert(r <= n);
+  800f66:	39 c3                	cmp    %eax,%ebx
+  800f68:	72 2e                	jb     800f98 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  800f6a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f6f:	7f 40                	jg     800fb1 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f71:	83 ec 04             	sub    $0x4,%esp
+  800f74:	50                   	push   %eax
+  800f75:	68 00 70 80 00       	push   $0x807000
+  800f7a:	57                   	push   %edi
+  800f7b:	e8 78 2a 00 00       	call   8039f8 <memmove>
+  800f80:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  800f83:	83 ec 0c             	sub    $0xc,%esp
+  800f86:	68 04 60 80 00       	push   $0x806004
+  800f8b:	e8 10 19 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+  800f90:	83 c4 10             	add    $0x10,%esp
+  800f93:	e9 6e ff ff ff       	jmp    800f06 <devfile_read+0x87>
+		assert(r <= n);
+  800f98:	68 b5 47 80 00       	push   $0x8047b5
+  800f9d:	68 95 47 80 00       	push   $0x804795
+  800fa2:	68 99 00 00 00       	push   $0x99
+  800fa7:	68 aa 47 80 00       	push   $0x8047aa
+  800fac:	e8 02 22 00 00       	call   8031b3 <_panic>
+		assert(r <= PGSIZE);
+  800fb1:	68 bc 47 80 00       	push   $0x8047bc
+  800fb6:	68 95 47 80 00       	push   $0x804795
+  800fbb:	68 9a 00 00 00       	push   $0x9a
+  800fc0:	68 aa 47 80 00       	push   $0x8047aa
+  800fc5:	e8 e9 21 00 00       	call   8031b3 <_panic>
+
+00800fca <open>:
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+  800fcf:	83 ec 1c             	sub    $0x1c,%esp
+  800fd2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800fd5:	56                   	push   %esi
+  800fd6:	e8 5c 28 00 00       	call   803837 <strlen>
+  800fdb:	83 c4 10             	add    $0x10,%esp
+  800fde:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe3:	0f 8f 85 00 00 00    	jg     80106e <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fef:	50                   	push   %eax
+  800ff0:	e8 a7 f6 ff ff       	call   80069c <fd_alloc>
+  800ff5:	89 c3                	mov    %eax,%ebx
+  800ff7:	83 c4 10             	add    $0x10,%esp
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	78 55                	js     801053 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	68 04 60 80 00       	push   $0x806004
+  801006:	e8 28 18 00 00       	call   802833 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  80100b:	83 c4 08             	add    $0x8,%esp
+  80100e:	56                   	push   %esi
+  80100f:	68 00 70 80 00       	push   $0x807000
+  801014:	e8 59 28 00 00       	call   803872 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801019:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80101c:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801021:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801024:	b8 01 00 00 00       	mov    $0x1,%eax
+  801029:	e8 7e fc ff ff       	call   800cac <fsipc>
+  80102e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801030:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801037:	e8 64 18 00 00       	call   8028a0 <mutex_unlock>
+	if (r < 0) {
+  80103c:	83 c4 10             	add    $0x10,%esp
+  80103f:	85 db                	test   %ebx,%ebx
+  801041:	78 19                	js     80105c <open+0x92>
+	return fd2num(fd);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	ff 75 f4             	push   -0xc(%ebp)
+  801049:	e8 27 f6 ff ff       	call   800675 <fd2num>
+  80104e:	89 c3                	mov    %eax,%ebx
+  801050:	83 c4 10             	add    $0x10,%esp
+}
+  801053:	89 d8                	mov    %ebx,%eax
+  801055:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801058:	5b                   	pop    %ebx
+  801059:	5e                   	pop    %esi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+		fd_close(fd, 0);
+  80105c:	83 ec 08             	sub    $0x8,%esp
+  80105f:	6a 00                	push   $0x0
+  801061:	ff 75 f4             	push   -0xc(%ebp)
+  801064:	e8 56 f7 ff ff       	call   8007bf <fd_close>
+		return r;
+  801069:	83 c4 10             	add    $0x10,%esp
+  80106c:	eb e5                	jmp    801053 <open+0x89>
+		return -E_BAD_PATH;
+  80106e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801073:	eb de                	jmp    801053 <open+0x89>
+
+00801075 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	53                   	push   %ebx
+  801079:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80107c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80107f:	50                   	push   %eax
+  801080:	ff 75 08             	push   0x8(%ebp)
+  801083:	e8 6a f6 ff ff       	call   8006f2 <fd_lookup>
+  801088:	89 c3                	mov    %eax,%ebx
+  80108a:	83 c4 10             	add    $0x10,%esp
+  80108d:	85 c0                	test   %eax,%eax
+  80108f:	78 5b                	js     8010ec <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801094:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80109a:	39 08                	cmp    %ecx,(%eax)
+  80109c:	75 55                	jne    8010f3 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80109e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8010a2:	74 56                	je     8010fa <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+  8010a7:	68 04 60 80 00       	push   $0x806004
+  8010ac:	e8 82 17 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8010b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010b7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  8010bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010bf:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  8010c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010c7:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8010cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010d6:	e8 d1 fb ff ff       	call   800cac <fsipc>
+  8010db:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8010dd:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8010e4:	e8 b7 17 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+  8010e9:	83 c4 10             	add    $0x10,%esp
+}
+  8010ec:	89 d8                	mov    %ebx,%eax
+  8010ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010f3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8010f8:	eb f2                	jmp    8010ec <fallocate+0x77>
+		return -E_INVAL;
+  8010fa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8010ff:	eb eb                	jmp    8010ec <fallocate+0x77>
+
+00801101 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	56                   	push   %esi
+  801105:	53                   	push   %ebx
+  801106:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801109:	89 f3                	mov    %esi,%ebx
+  80110b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801111:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801114:	eb 06                	jmp    80111c <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801116:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80111c:	39 f3                	cmp    %esi,%ebx
+  80111e:	73 14                	jae    801134 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801120:	83 ec 08             	sub    $0x8,%esp
+  801123:	53                   	push   %ebx
+  801124:	6a 00                	push   $0x0
+  801126:	e8 41 f1 ff ff       	call   80026c <sys_page_unmap>
+  80112b:	83 c4 10             	add    $0x10,%esp
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	79 e4                	jns    801116 <munmap+0x15>
+  801132:	eb 05                	jmp    801139 <munmap+0x38>
+			return r;
+	return 0;
+  801134:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801139:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113c:	5b                   	pop    %ebx
+  80113d:	5e                   	pop    %esi
+  80113e:	5d                   	pop    %ebp
+  80113f:	c3                   	ret
+
+00801140 <mmap>:
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 24             	sub    $0x24,%esp
+  801149:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80114c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80114f:	50                   	push   %eax
+  801150:	ff 75 08             	push   0x8(%ebp)
+  801153:	e8 9a f5 ff ff       	call   8006f2 <fd_lookup>
+  801158:	83 c4 10             	add    $0x10,%esp
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	0f 88 37 01 00 00    	js     80129a <mmap+0x15a>
+		return NULL;
+  801163:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801168:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80116b:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801171:	39 0a                	cmp    %ecx,(%edx)
+  801173:	0f 85 05 01 00 00    	jne    80127e <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801179:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801180:	0f 85 1b 01 00 00    	jne    8012a1 <mmap+0x161>
+  801186:	89 f0                	mov    %esi,%eax
+  801188:	83 e8 01             	sub    $0x1,%eax
+  80118b:	0f 88 17 01 00 00    	js     8012a8 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801191:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801195:	75 28                	jne    8011bf <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	68 04 60 80 00       	push   $0x806004
+  80119f:	e8 8f 16 00 00       	call   802833 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8011a4:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8011aa:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011b0:	83 c4 10             	add    $0x10,%esp
+  8011b3:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8011b8:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8011bd:	eb 2b                	jmp    8011ea <mmap+0xaa>
+		cow_enable();
+  8011bf:	e8 f7 2b 00 00       	call   803dbb <cow_enable>
+  8011c4:	eb d1                	jmp    801197 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	c1 ea 0c             	shr    $0xc,%edx
+  8011cb:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8011d2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011d8:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8011de:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8011e1:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8011e3:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8011e8:	77 25                	ja     80120f <mmap+0xcf>
+  8011ea:	89 c2                	mov    %eax,%edx
+  8011ec:	29 da                	sub    %ebx,%edx
+  8011ee:	39 ca                	cmp    %ecx,%edx
+  8011f0:	73 3a                	jae    80122c <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8011f2:	89 c2                	mov    %eax,%edx
+  8011f4:	c1 ea 16             	shr    $0x16,%edx
+  8011f7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011fe:	f6 c2 01             	test   $0x1,%dl
+  801201:	75 c3                	jne    8011c6 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801203:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801208:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80120d:	eb d4                	jmp    8011e3 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80120f:	29 d8                	sub    %ebx,%eax
+  801211:	39 c8                	cmp    %ecx,%eax
+  801213:	73 17                	jae    80122c <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	68 04 60 80 00       	push   $0x806004
+  80121d:	e8 7e 16 00 00       	call   8028a0 <mutex_unlock>
+		return NULL;
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122a:	eb 52                	jmp    80127e <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80122c:	85 db                	test   %ebx,%ebx
+  80122e:	74 e5                	je     801215 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801230:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801233:	8b 40 0c             	mov    0xc(%eax),%eax
+  801236:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80123b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80123e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801243:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801249:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  80124f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801252:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801261:	e8 46 fa ff ff       	call   800cac <fsipc>
+  801266:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801268:	83 ec 0c             	sub    $0xc,%esp
+  80126b:	68 04 60 80 00       	push   $0x806004
+  801270:	e8 2b 16 00 00       	call   8028a0 <mutex_unlock>
+	if (r < 0) {
+  801275:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801278:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80127a:	85 ff                	test   %edi,%edi
+  80127c:	78 08                	js     801286 <mmap+0x146>
+}
+  80127e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801281:	5b                   	pop    %ebx
+  801282:	5e                   	pop    %esi
+  801283:	5f                   	pop    %edi
+  801284:	5d                   	pop    %ebp
+  801285:	c3                   	ret
+		munmap((void*) va, len);
+  801286:	83 ec 08             	sub    $0x8,%esp
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+  80128b:	e8 71 fe ff ff       	call   801101 <munmap>
+		return NULL;
+  801290:	83 c4 10             	add    $0x10,%esp
+  801293:	b8 00 00 00 00       	mov    $0x0,%eax
+  801298:	eb e4                	jmp    80127e <mmap+0x13e>
+		return NULL;
+  80129a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129f:	eb dd                	jmp    80127e <mmap+0x13e>
+		return NULL;
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	eb d6                	jmp    80127e <mmap+0x13e>
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	eb cf                	jmp    80127e <mmap+0x13e>
+
+008012af <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 10             	sub    $0x10,%esp
+  8012b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8012b9:	53                   	push   %ebx
+  8012ba:	e8 78 25 00 00       	call   803837 <strlen>
+  8012bf:	83 c4 10             	add    $0x10,%esp
+  8012c2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8012c7:	7f 42                	jg     80130b <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	68 04 60 80 00       	push   $0x806004
+  8012d1:	e8 5d 15 00 00       	call   802833 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8012d6:	83 c4 08             	add    $0x8,%esp
+  8012d9:	53                   	push   %ebx
+  8012da:	68 00 70 80 00       	push   $0x807000
+  8012df:	e8 8e 25 00 00       	call   803872 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8012e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012ee:	e8 b9 f9 ff ff       	call   800cac <fsipc>
+  8012f3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8012f5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8012fc:	e8 9f 15 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+  801301:	83 c4 10             	add    $0x10,%esp
+}
+  801304:	89 d8                	mov    %ebx,%eax
+  801306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801309:	c9                   	leave
+  80130a:	c3                   	ret
+		return -E_BAD_PATH;
+  80130b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801310:	eb f2                	jmp    801304 <remove+0x55>
+
+00801312 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	53                   	push   %ebx
+  801316:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801319:	68 04 60 80 00       	push   $0x806004
+  80131e:	e8 10 15 00 00       	call   802833 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801323:	ba 00 00 00 00       	mov    $0x0,%edx
+  801328:	b8 08 00 00 00       	mov    $0x8,%eax
+  80132d:	e8 7a f9 ff ff       	call   800cac <fsipc>
+  801332:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801334:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80133b:	e8 60 15 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+}
+  801340:	89 d8                	mov    %ebx,%eax
+  801342:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+
+00801347 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  80134c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	68 04 60 80 00       	push   $0x806004
+  801357:	e8 d7 14 00 00       	call   802833 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80135c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80135f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801364:	ba 00 00 00 00       	mov    $0x0,%edx
+  801369:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80136e:	e8 39 f9 ff ff       	call   800cac <fsipc>
+  801373:	89 c6                	mov    %eax,%esi
+  801375:	83 c4 10             	add    $0x10,%esp
+  801378:	85 db                	test   %ebx,%ebx
+  80137a:	74 7b                	je     8013f7 <fs_bcstat+0xb0>
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	78 77                	js     8013f7 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801380:	a1 00 70 80 00       	mov    0x807000,%eax
+  801385:	89 03                	mov    %eax,(%ebx)
+  801387:	a1 04 70 80 00       	mov    0x807004,%eax
+  80138c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80138f:	a1 08 70 80 00       	mov    0x807008,%eax
+  801394:	89 43 08             	mov    %eax,0x8(%ebx)
+  801397:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80139c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80139f:	a1 10 70 80 00       	mov    0x807010,%eax
+  8013a4:	89 43 10             	mov    %eax,0x10(%ebx)
+  8013a7:	a1 14 70 80 00       	mov    0x807014,%eax
+  8013ac:	89 43 14             	mov    %eax,0x14(%ebx)
+  8013af:	a1 18 70 80 00       	mov    0x807018,%eax
+  8013b4:	89 43 18             	mov    %eax,0x18(%ebx)
+  8013b7:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  8013bc:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8013bf:	a1 20 70 80 00       	mov    0x807020,%eax
+  8013c4:	89 43 20             	mov    %eax,0x20(%ebx)
+  8013c7:	a1 24 70 80 00       	mov    0x807024,%eax
+  8013cc:	89 43 24             	mov    %eax,0x24(%ebx)
+  8013cf:	a1 28 70 80 00       	mov    0x807028,%eax
+  8013d4:	89 43 28             	mov    %eax,0x28(%ebx)
+  8013d7:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  8013dc:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8013df:	a1 30 70 80 00       	mov    0x807030,%eax
+  8013e4:	89 43 30             	mov    %eax,0x30(%ebx)
+  8013e7:	a1 34 70 80 00       	mov    0x807034,%eax
+  8013ec:	89 43 34             	mov    %eax,0x34(%ebx)
+  8013ef:	a1 38 70 80 00       	mov    0x807038,%eax
+  8013f4:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	68 04 60 80 00       	push   $0x806004
+  8013ff:	e8 9c 14 00 00       	call   8028a0 <mutex_unlock>
+	return r;
+}
+  801404:	89 f0                	mov    %esi,%eax
+  801406:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801409:	5b                   	pop    %ebx
+  80140a:	5e                   	pop    %esi
+  80140b:	5d                   	pop    %ebp
+  80140c:	c3                   	ret
+
+0080140d <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	56                   	push   %esi
+  801411:	53                   	push   %ebx
+  801412:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801414:	0f b6 10             	movzbl (%eax),%edx
+  801417:	80 fa 72             	cmp    $0x72,%dl
+  80141a:	74 44                	je     801460 <parse_mode+0x53>
+  80141c:	80 fa 77             	cmp    $0x77,%dl
+  80141f:	74 4b                	je     80146c <parse_mode+0x5f>
+  801421:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801426:	80 fa 61             	cmp    $0x61,%dl
+  801429:	74 09                	je     801434 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  80142b:	89 d8                	mov    %ebx,%eax
+  80142d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+	switch (mode[0]) {
+  801434:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801439:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80143e:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801440:	83 ec 08             	sub    $0x8,%esp
+  801443:	6a 2b                	push   $0x2b
+  801445:	50                   	push   %eax
+  801446:	e8 39 25 00 00       	call   803984 <strchr>
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	74 d9                	je     80142b <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801452:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801455:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801458:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80145e:	eb cb                	jmp    80142b <parse_mode+0x1e>
+	switch (mode[0]) {
+  801460:	ba 01 00 00 00       	mov    $0x1,%edx
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	eb d2                	jmp    80143e <parse_mode+0x31>
+  80146c:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801471:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801476:	eb c6                	jmp    80143e <parse_mode+0x31>
+
+00801478 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801478:	55                   	push   %ebp
+  801479:	89 e5                	mov    %esp,%ebp
+  80147b:	57                   	push   %edi
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	83 ec 1c             	sub    $0x1c,%esp
+  801481:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801484:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801487:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80148c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801491:	83 c0 24             	add    $0x24,%eax
+  801494:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801498:	74 17                	je     8014b1 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80149a:	83 c3 01             	add    $0x1,%ebx
+  80149d:	83 fb 10             	cmp    $0x10,%ebx
+  8014a0:	75 ef                	jne    801491 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8014a2:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8014a7:	89 f0                	mov    %esi,%eax
+  8014a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8014b1:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8014b8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014bb:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8014be:	c1 e7 02             	shl    $0x2,%edi
+  8014c1:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  8014c7:	83 ec 04             	sub    $0x4,%esp
+  8014ca:	6a 24                	push   $0x24
+  8014cc:	6a 00                	push   $0x0
+  8014ce:	56                   	push   %esi
+  8014cf:	e8 ef 24 00 00       	call   8039c3 <memset>
+			streams[i].f_fd = fd;
+  8014d4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8014d7:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  8014dd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8014e0:	01 d8                	add    %ebx,%eax
+  8014e2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014e5:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  8014ec:	83 c4 10             	add    $0x10,%esp
+  8014ef:	eb b6                	jmp    8014a7 <stream_alloc+0x2f>
+
+008014f1 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	53                   	push   %ebx
+  8014f5:	83 ec 14             	sub    $0x14,%esp
+  8014f8:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8014fa:	8b 40 18             	mov    0x18(%eax),%eax
+  8014fd:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801500:	74 4a                	je     80154c <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801502:	83 ec 08             	sub    $0x8,%esp
+  801505:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801508:	50                   	push   %eax
+  801509:	ff 33                	push   (%ebx)
+  80150b:	e8 e2 f1 ff ff       	call   8006f2 <fd_lookup>
+  801510:	89 c2                	mov    %eax,%edx
+  801512:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80151a:	85 d2                	test   %edx,%edx
+  80151c:	78 41                	js     80155f <stream_unread+0x6e>
+  80151e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801521:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801527:	39 0a                	cmp    %ecx,(%edx)
+  801529:	75 34                	jne    80155f <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  80152b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80152e:	03 42 04             	add    0x4(%edx),%eax
+  801531:	2b 43 18             	sub    0x18(%ebx),%eax
+  801534:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801537:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80153e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801545:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154a:	eb 13                	jmp    80155f <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80154c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801553:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80155a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80155f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+
+00801564 <stream_drain>:
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	56                   	push   %esi
+  801568:	53                   	push   %ebx
+  801569:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801570:	eb 02                	jmp    801574 <stream_drain+0x10>
+  801572:	01 c3                	add    %eax,%ebx
+  801574:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801577:	39 c3                	cmp    %eax,%ebx
+  801579:	73 43                	jae    8015be <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80157b:	83 ec 04             	sub    $0x4,%esp
+  80157e:	29 d8                	sub    %ebx,%eax
+  801580:	50                   	push   %eax
+  801581:	89 d8                	mov    %ebx,%eax
+  801583:	03 46 0c             	add    0xc(%esi),%eax
+  801586:	50                   	push   %eax
+  801587:	ff 36                	push   (%esi)
+  801589:	e8 ec f4 ff ff       	call   800a7a <write>
+  80158e:	83 c4 10             	add    $0x10,%esp
+  801591:	85 c0                	test   %eax,%eax
+  801593:	7f dd                	jg     801572 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  801595:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  801599:	8b 56 0c             	mov    0xc(%esi),%edx
+  80159c:	83 ec 04             	sub    $0x4,%esp
+  80159f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015a2:	29 d8                	sub    %ebx,%eax
+  8015a4:	50                   	push   %eax
+  8015a5:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8015a8:	50                   	push   %eax
+  8015a9:	52                   	push   %edx
+  8015aa:	e8 49 24 00 00       	call   8039f8 <memmove>
+			f->f_wend -= done;
+  8015af:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8015b2:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8015b4:	83 c4 10             	add    $0x10,%esp
+  8015b7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8015bc:	eb 0a                	jmp    8015c8 <stream_drain+0x64>
+  8015be:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8015c3:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8015c8:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8015cb:	89 d0                	mov    %edx,%eax
+  8015cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d0:	5b                   	pop    %ebx
+  8015d1:	5e                   	pop    %esi
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+
+008015d4 <stream_setup>:
+	if (f->f_buf)
+  8015d4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8015d8:	74 01                	je     8015db <stream_setup+0x7>
+  8015da:	c3                   	ret
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	53                   	push   %ebx
+  8015df:	83 ec 04             	sub    $0x4,%esp
+  8015e2:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8015e4:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	74 17                	je     801602 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8015eb:	83 f8 03             	cmp    $0x3,%eax
+  8015ee:	75 2d                	jne    80161d <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8015f0:	8d 43 20             	lea    0x20(%ebx),%eax
+  8015f3:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8015f6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8015fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801600:	c9                   	leave
+  801601:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  801602:	83 ec 0c             	sub    $0xc,%esp
+  801605:	ff 33                	push   (%ebx)
+  801607:	e8 29 1b 00 00       	call   803135 <iscons>
+  80160c:	83 c4 10             	add    $0x10,%esp
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	0f 9f c0             	setg   %al
+  801614:	0f b6 c0             	movzbl %al,%eax
+  801617:	83 c0 01             	add    $0x1,%eax
+  80161a:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80161d:	83 ec 0c             	sub    $0xc,%esp
+  801620:	68 00 10 00 00       	push   $0x1000
+  801625:	e8 6e 0b 00 00       	call   802198 <malloc>
+  80162a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80162d:	83 c4 10             	add    $0x10,%esp
+  801630:	85 c0                	test   %eax,%eax
+  801632:	74 bc                	je     8015f0 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  801634:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80163b:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80163f:	eb bc                	jmp    8015fd <stream_setup+0x29>
+
+00801641 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	53                   	push   %ebx
+  801645:	83 ec 04             	sub    $0x4,%esp
+  801648:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80164a:	e8 85 ff ff ff       	call   8015d4 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80164f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  801654:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  801658:	74 3d                	je     801697 <stream_fill+0x56>
+  80165a:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80165e:	74 10                	je     801670 <stream_fill+0x2f>
+  801660:	89 d8                	mov    %ebx,%eax
+  801662:	e8 fd fe ff ff       	call   801564 <stream_drain>
+		return 0;
+  801667:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 27                	js     801697 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  801670:	83 ec 04             	sub    $0x4,%esp
+  801673:	ff 73 10             	push   0x10(%ebx)
+  801676:	ff 73 0c             	push   0xc(%ebx)
+  801679:	ff 33                	push   (%ebx)
+  80167b:	e8 02 f3 ff ff       	call   800982 <read>
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	85 c0                	test   %eax,%eax
+  801685:	7e 17                	jle    80169e <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  801687:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80168b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  801692:	89 c2                	mov    %eax,%edx
+  801694:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  801697:	89 d0                	mov    %edx,%eax
+  801699:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80169e:	c1 f8 1f             	sar    $0x1f,%eax
+  8016a1:	83 e0 04             	and    $0x4,%eax
+  8016a4:	83 c0 04             	add    $0x4,%eax
+  8016a7:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8016aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016af:	eb e6                	jmp    801697 <stream_fill+0x56>
+
+008016b1 <fopen>:
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	57                   	push   %edi
+  8016b5:	56                   	push   %esi
+  8016b6:	53                   	push   %ebx
+  8016b7:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8016bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016c0:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8016c6:	89 f0                	mov    %esi,%eax
+  8016c8:	e8 40 fd ff ff       	call   80140d <parse_mode>
+		return 0;
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 2d                	js     801703 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8016d6:	83 ec 08             	sub    $0x8,%esp
+  8016d9:	50                   	push   %eax
+  8016da:	ff 75 08             	push   0x8(%ebp)
+  8016dd:	e8 e8 f8 ff ff       	call   800fca <open>
+  8016e2:	89 c7                	mov    %eax,%edi
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	78 58                	js     801743 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8016eb:	80 3e 61             	cmpb   $0x61,(%esi)
+  8016ee:	74 1d                	je     80170d <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8016f0:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8016f6:	89 f8                	mov    %edi,%eax
+  8016f8:	e8 7b fd ff ff       	call   801478 <stream_alloc>
+  8016fd:	89 c3                	mov    %eax,%ebx
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	74 32                	je     801735 <fopen+0x84>
+}
+  801703:	89 d8                	mov    %ebx,%eax
+  801705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801708:	5b                   	pop    %ebx
+  801709:	5e                   	pop    %esi
+  80170a:	5f                   	pop    %edi
+  80170b:	5d                   	pop    %ebp
+  80170c:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80170d:	83 ec 08             	sub    $0x8,%esp
+  801710:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	57                   	push   %edi
+  801718:	e8 db f4 ff ff       	call   800bf8 <fstat>
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	85 c0                	test   %eax,%eax
+  801722:	78 cc                	js     8016f0 <fopen+0x3f>
+		seek(fd, st.st_size);
+  801724:	83 ec 08             	sub    $0x8,%esp
+  801727:	ff 75 dc             	push   -0x24(%ebp)
+  80172a:	57                   	push   %edi
+  80172b:	e8 f6 f3 ff ff       	call   800b26 <seek>
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	eb bb                	jmp    8016f0 <fopen+0x3f>
+		close(fd);
+  801735:	83 ec 0c             	sub    $0xc,%esp
+  801738:	57                   	push   %edi
+  801739:	e8 08 f1 ff ff       	call   800846 <close>
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	eb c0                	jmp    801703 <fopen+0x52>
+		return 0;
+  801743:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801748:	eb b9                	jmp    801703 <fopen+0x52>
+
+0080174a <fdopen>:
+{
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  801750:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801753:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801756:	e8 b2 fc ff ff       	call   80140d <parse_mode>
+  80175b:	89 c2                	mov    %eax,%edx
+		return 0;
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  801762:	85 d2                	test   %edx,%edx
+  801764:	78 0b                	js     801771 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  801766:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801769:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176c:	e8 07 fd ff ff       	call   801478 <stream_alloc>
+}
+  801771:	c9                   	leave
+  801772:	c3                   	ret
+
+00801773 <setvbuf>:
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	57                   	push   %edi
+  801777:	56                   	push   %esi
+  801778:	53                   	push   %ebx
+  801779:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80177f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  801782:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801786:	75 3a                	jne    8017c2 <setvbuf+0x4f>
+  801788:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80178b:	83 fe 02             	cmp    $0x2,%esi
+  80178e:	77 39                	ja     8017c9 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  801790:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  801793:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801797:	0f 95 c3             	setne  %bl
+  80179a:	85 ff                	test   %edi,%edi
+  80179c:	0f 95 c1             	setne  %cl
+  80179f:	84 cb                	test   %cl,%bl
+  8017a1:	74 05                	je     8017a8 <setvbuf+0x35>
+  8017a3:	83 fa 03             	cmp    $0x3,%edx
+  8017a6:	75 0a                	jne    8017b2 <setvbuf+0x3f>
+	return 0;
+  8017a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ad:	5b                   	pop    %ebx
+  8017ae:	5e                   	pop    %esi
+  8017af:	5f                   	pop    %edi
+  8017b0:	5d                   	pop    %ebp
+  8017b1:	c3                   	ret
+		f->f_buf = buf;
+  8017b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b5:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8017b8:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	eb eb                	jmp    8017ad <setvbuf+0x3a>
+		return EOF;
+  8017c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017c7:	eb e4                	jmp    8017ad <setvbuf+0x3a>
+  8017c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017ce:	eb dd                	jmp    8017ad <setvbuf+0x3a>
+
+008017d0 <fflush>:
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	57                   	push   %edi
+  8017d4:	56                   	push   %esi
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8017dc:	85 db                	test   %ebx,%ebx
+  8017de:	74 1a                	je     8017fa <fflush+0x2a>
+	stream_unread(f);
+  8017e0:	89 d8                	mov    %ebx,%eax
+  8017e2:	e8 0a fd ff ff       	call   8014f1 <stream_unread>
+	return stream_drain(f);
+  8017e7:	89 d8                	mov    %ebx,%eax
+  8017e9:	e8 76 fd ff ff       	call   801564 <stream_drain>
+  8017ee:	89 c7                	mov    %eax,%edi
+}
+  8017f0:	89 f8                	mov    %edi,%eax
+  8017f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f5:	5b                   	pop    %ebx
+  8017f6:	5e                   	pop    %esi
+  8017f7:	5f                   	pop    %edi
+  8017f8:	5d                   	pop    %ebp
+  8017f9:	c3                   	ret
+  8017fa:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8017ff:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  801804:	bf 00 00 00 00       	mov    $0x0,%edi
+  801809:	eb 03                	jmp    80180e <fflush+0x3e>
+  80180b:	83 c3 24             	add    $0x24,%ebx
+  80180e:	39 f3                	cmp    %esi,%ebx
+  801810:	74 de                	je     8017f0 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  801812:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  801816:	74 f3                	je     80180b <fflush+0x3b>
+  801818:	83 ec 0c             	sub    $0xc,%esp
+  80181b:	53                   	push   %ebx
+  80181c:	e8 af ff ff ff       	call   8017d0 <fflush>
+  801821:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  801824:	85 c0                	test   %eax,%eax
+  801826:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80182b:	0f 48 f8             	cmovs  %eax,%edi
+  80182e:	eb db                	jmp    80180b <fflush+0x3b>
+
+00801830 <fclose>:
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	56                   	push   %esi
+  801834:	53                   	push   %ebx
+  801835:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  801838:	83 ec 0c             	sub    $0xc,%esp
+  80183b:	56                   	push   %esi
+  80183c:	e8 8f ff ff ff       	call   8017d0 <fflush>
+  801841:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  801843:	83 c4 04             	add    $0x4,%esp
+  801846:	ff 36                	push   (%esi)
+  801848:	e8 f9 ef ff ff       	call   800846 <close>
+  80184d:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  801850:	85 c0                	test   %eax,%eax
+  801852:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801857:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80185a:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80185e:	75 10                	jne    801870 <fclose+0x40>
+	f->f_flags = 0;
+  801860:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  801867:	89 d8                	mov    %ebx,%eax
+  801869:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5d                   	pop    %ebp
+  80186f:	c3                   	ret
+		free(f->f_buf);
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	ff 76 0c             	push   0xc(%esi)
+  801876:	e8 54 08 00 00       	call   8020cf <free>
+  80187b:	83 c4 10             	add    $0x10,%esp
+  80187e:	eb e0                	jmp    801860 <fclose+0x30>
+
+00801880 <fileno>:
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  801883:	8b 45 08             	mov    0x8(%ebp),%eax
+  801886:	8b 00                	mov    (%eax),%eax
+}
+  801888:	5d                   	pop    %ebp
+  801889:	c3                   	ret
+
+0080188a <feof>:
+{
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80188d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801890:	8b 40 04             	mov    0x4(%eax),%eax
+  801893:	c1 e8 02             	shr    $0x2,%eax
+  801896:	83 e0 01             	and    $0x1,%eax
+}
+  801899:	5d                   	pop    %ebp
+  80189a:	c3                   	ret
+
+0080189b <ferror>:
+{
+  80189b:	55                   	push   %ebp
+  80189c:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80189e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a1:	8b 40 04             	mov    0x4(%eax),%eax
+  8018a4:	c1 e8 03             	shr    $0x3,%eax
+  8018a7:	83 e0 01             	and    $0x1,%eax
+}
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+
+008018ac <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8018ac:	55                   	push   %ebp
+  8018ad:	89 e5                	mov    %esp,%ebp
+  8018af:	53                   	push   %ebx
+  8018b0:	83 ec 04             	sub    $0x4,%esp
+  8018b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018b6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8018b9:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8018bc:	74 15                	je     8018d3 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8018be:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8018c1:	8b 43 14             	mov    0x14(%ebx),%eax
+  8018c4:	8d 48 01             	lea    0x1(%eax),%ecx
+  8018c7:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8018ca:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8018ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8018d3:	89 d8                	mov    %ebx,%eax
+  8018d5:	e8 67 fd ff ff       	call   801641 <stream_fill>
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	75 e0                	jne    8018be <fgetc+0x12>
+		return EOF;
+  8018de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018e3:	eb e9                	jmp    8018ce <fgetc+0x22>
+
+008018e5 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	57                   	push   %edi
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 1c             	sub    $0x1c,%esp
+  8018ee:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8018f1:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8018f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f9:	83 e8 01             	sub    $0x1,%eax
+  8018fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8018ff:	eb 66                	jmp    801967 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  801901:	8b 46 14             	mov    0x14(%esi),%eax
+  801904:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801907:	29 c3                	sub    %eax,%ebx
+  801909:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80190c:	29 fa                	sub    %edi,%edx
+  80190e:	39 d3                	cmp    %edx,%ebx
+  801910:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801913:	83 ec 04             	sub    $0x4,%esp
+  801916:	53                   	push   %ebx
+  801917:	6a 0a                	push   $0xa
+  801919:	03 46 0c             	add    0xc(%esi),%eax
+  80191c:	50                   	push   %eax
+  80191d:	e8 87 21 00 00       	call   803aa9 <memfind>
+  801922:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  801925:	8b 46 0c             	mov    0xc(%esi),%eax
+  801928:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80192b:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80192e:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  801936:	74 0b                	je     801943 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  801938:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80193b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80193e:	29 d3                	sub    %edx,%ebx
+  801940:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  801943:	83 ec 04             	sub    $0x4,%esp
+  801946:	53                   	push   %ebx
+  801947:	01 c8                	add    %ecx,%eax
+  801949:	50                   	push   %eax
+  80194a:	89 f8                	mov    %edi,%eax
+  80194c:	03 45 08             	add    0x8(%ebp),%eax
+  80194f:	50                   	push   %eax
+  801950:	e8 a3 20 00 00       	call   8039f8 <memmove>
+		f->f_rpos += m;
+  801955:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  801958:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  801965:	74 1f                	je     801986 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  801967:	8d 47 01             	lea    0x1(%edi),%eax
+  80196a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80196d:	73 17                	jae    801986 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80196f:	8b 46 18             	mov    0x18(%esi),%eax
+  801972:	39 46 14             	cmp    %eax,0x14(%esi)
+  801975:	75 8a                	jne    801901 <fgets+0x1c>
+  801977:	89 f0                	mov    %esi,%eax
+  801979:	e8 c3 fc ff ff       	call   801641 <stream_fill>
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	0f 85 7b ff ff ff    	jne    801901 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  801986:	85 ff                	test   %edi,%edi
+  801988:	74 0f                	je     801999 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80198a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198d:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  801991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801994:	5b                   	pop    %ebx
+  801995:	5e                   	pop    %esi
+  801996:	5f                   	pop    %edi
+  801997:	5d                   	pop    %ebp
+  801998:	c3                   	ret
+		return 0;
+  801999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199e:	eb f1                	jmp    801991 <fgets+0xac>
+
+008019a0 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	83 ec 1c             	sub    $0x1c,%esp
+  8019a9:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8019ac:	89 f0                	mov    %esi,%eax
+  8019ae:	e8 21 fc ff ff       	call   8015d4 <stream_setup>
+	want = size * n;
+  8019b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b6:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8019ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8019bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c2:	eb 43                	jmp    801a07 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8019c4:	29 d3                	sub    %edx,%ebx
+  8019c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019c9:	29 f8                	sub    %edi,%eax
+  8019cb:	39 c3                	cmp    %eax,%ebx
+  8019cd:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8019d0:	83 ec 04             	sub    $0x4,%esp
+  8019d3:	53                   	push   %ebx
+  8019d4:	03 56 0c             	add    0xc(%esi),%edx
+  8019d7:	52                   	push   %edx
+  8019d8:	89 f8                	mov    %edi,%eax
+  8019da:	03 45 08             	add    0x8(%ebp),%eax
+  8019dd:	50                   	push   %eax
+  8019de:	e8 15 20 00 00       	call   8039f8 <memmove>
+			f->f_rpos += m;
+  8019e3:	01 5e 14             	add    %ebx,0x14(%esi)
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	eb 1a                	jmp    801a05 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8019eb:	83 ec 04             	sub    $0x4,%esp
+  8019ee:	53                   	push   %ebx
+  8019ef:	89 f8                	mov    %edi,%eax
+  8019f1:	03 45 08             	add    0x8(%ebp),%eax
+  8019f4:	50                   	push   %eax
+  8019f5:	ff 36                	push   (%esi)
+  8019f7:	e8 86 ef ff ff       	call   800982 <read>
+  8019fc:	89 c3                	mov    %eax,%ebx
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	7e 36                	jle    801a3b <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  801a05:	01 df                	add    %ebx,%edi
+  801a07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a0a:	39 c7                	cmp    %eax,%edi
+  801a0c:	73 39                	jae    801a47 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  801a0e:	8b 56 14             	mov    0x14(%esi),%edx
+  801a11:	8b 5e 18             	mov    0x18(%esi),%ebx
+  801a14:	39 da                	cmp    %ebx,%edx
+  801a16:	72 ac                	jb     8019c4 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  801a18:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801a1b:	29 fb                	sub    %edi,%ebx
+  801a1d:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  801a20:	72 3e                	jb     801a60 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  801a22:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  801a26:	74 1f                	je     801a47 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  801a28:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801a2c:	74 bd                	je     8019eb <fread+0x4b>
+  801a2e:	89 f0                	mov    %esi,%eax
+  801a30:	e8 2f fb ff ff       	call   801564 <stream_drain>
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	79 b2                	jns    8019eb <fread+0x4b>
+  801a39:	eb 0c                	jmp    801a47 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  801a3b:	c1 fb 1f             	sar    $0x1f,%ebx
+  801a3e:	83 e3 04             	and    $0x4,%ebx
+  801a41:	83 c3 04             	add    $0x4,%ebx
+  801a44:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  801a47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	74 0a                	je     801a58 <fread+0xb8>
+  801a4e:	89 f8                	mov    %edi,%eax
+  801a50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a55:	f7 75 0c             	divl   0xc(%ebp)
+}
+  801a58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5b:	5b                   	pop    %ebx
+  801a5c:	5e                   	pop    %esi
+  801a5d:	5f                   	pop    %edi
+  801a5e:	5d                   	pop    %ebp
+  801a5f:	c3                   	ret
+		} else if (!stream_fill(f))
+  801a60:	89 f0                	mov    %esi,%eax
+  801a62:	e8 da fb ff ff       	call   801641 <stream_fill>
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	74 dc                	je     801a47 <fread+0xa7>
+			m = 0;
+  801a6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a70:	eb 93                	jmp    801a05 <fread+0x65>
+
+00801a72 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	57                   	push   %edi
+  801a76:	56                   	push   %esi
+  801a77:	53                   	push   %ebx
+  801a78:	83 ec 1c             	sub    $0x1c,%esp
+  801a7b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  801a7e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a81:	a8 02                	test   $0x2,%al
+  801a83:	75 13                	jne    801a98 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  801a85:	83 c8 08             	or     $0x8,%eax
+  801a88:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  801a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  801a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a93:	5b                   	pop    %ebx
+  801a94:	5e                   	pop    %esi
+  801a95:	5f                   	pop    %edi
+  801a96:	5d                   	pop    %ebp
+  801a97:	c3                   	ret
+	stream_setup(f);
+  801a98:	89 d8                	mov    %ebx,%eax
+  801a9a:	e8 35 fb ff ff       	call   8015d4 <stream_setup>
+	want = size * n;
+  801a9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa2:	0f af 45 10          	imul   0x10(%ebp),%eax
+  801aa6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  801aa9:	89 d8                	mov    %ebx,%eax
+  801aab:	e8 41 fa ff ff       	call   8014f1 <stream_unread>
+	for (done = 0; done < want; ) {
+  801ab0:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  801ab5:	84 c0                	test   %al,%al
+  801ab7:	75 7b                	jne    801b34 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  801ab9:	be 00 00 00 00       	mov    $0x0,%esi
+  801abe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ac1:	39 fe                	cmp    %edi,%esi
+  801ac3:	73 24                	jae    801ae9 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801ac5:	83 ec 04             	sub    $0x4,%esp
+  801ac8:	89 f8                	mov    %edi,%eax
+  801aca:	29 f0                	sub    %esi,%eax
+  801acc:	50                   	push   %eax
+  801acd:	89 f0                	mov    %esi,%eax
+  801acf:	03 45 08             	add    0x8(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	ff 33                	push   (%ebx)
+  801ad5:	e8 a0 ef ff ff       	call   800a7a <write>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	7e 04                	jle    801ae5 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  801ae1:	01 c6                	add    %eax,%esi
+  801ae3:	eb dc                	jmp    801ac1 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  801ae5:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  801ae9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	74 a0                	je     801a90 <fwrite+0x1e>
+  801af0:	89 f0                	mov    %esi,%eax
+  801af2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af7:	f7 75 0c             	divl   0xc(%ebp)
+  801afa:	eb 94                	jmp    801a90 <fwrite+0x1e>
+			done += r;
+  801afc:	01 c7                	add    %eax,%edi
+			continue;
+  801afe:	eb 34                	jmp    801b34 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  801b00:	8b 73 10             	mov    0x10(%ebx),%esi
+  801b03:	29 c6                	sub    %eax,%esi
+  801b05:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b08:	29 fa                	sub    %edi,%edx
+  801b0a:	39 d6                	cmp    %edx,%esi
+  801b0c:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  801b0f:	83 ec 04             	sub    $0x4,%esp
+  801b12:	56                   	push   %esi
+  801b13:	89 fa                	mov    %edi,%edx
+  801b15:	03 55 08             	add    0x8(%ebp),%edx
+  801b18:	52                   	push   %edx
+  801b19:	03 43 0c             	add    0xc(%ebx),%eax
+  801b1c:	50                   	push   %eax
+  801b1d:	e8 d6 1e 00 00       	call   8039f8 <memmove>
+		f->f_wend += m;
+  801b22:	89 f0                	mov    %esi,%eax
+  801b24:	03 43 1c             	add    0x1c(%ebx),%eax
+  801b27:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  801b2a:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b2c:	83 c4 10             	add    $0x10,%esp
+  801b2f:	3b 43 10             	cmp    0x10(%ebx),%eax
+  801b32:	74 5b                	je     801b8f <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  801b34:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b37:	39 c7                	cmp    %eax,%edi
+  801b39:	73 2d                	jae    801b68 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  801b3b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	75 be                	jne    801b00 <fwrite+0x8e>
+  801b42:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b45:	29 fa                	sub    %edi,%edx
+  801b47:	3b 53 10             	cmp    0x10(%ebx),%edx
+  801b4a:	72 b4                	jb     801b00 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  801b4c:	83 ec 04             	sub    $0x4,%esp
+  801b4f:	52                   	push   %edx
+  801b50:	89 f8                	mov    %edi,%eax
+  801b52:	03 45 08             	add    0x8(%ebp),%eax
+  801b55:	50                   	push   %eax
+  801b56:	ff 33                	push   (%ebx)
+  801b58:	e8 1d ef ff ff       	call   800a7a <write>
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	7f 98                	jg     801afc <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  801b64:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  801b68:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b6b:	83 f8 03             	cmp    $0x3,%eax
+  801b6e:	74 48                	je     801bb8 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b70:	83 f8 02             	cmp    $0x2,%eax
+  801b73:	74 27                	je     801b9c <fwrite+0x12a>
+	return size ? done / size : 0;
+  801b75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	0f 84 10 ff ff ff    	je     801a90 <fwrite+0x1e>
+  801b80:	89 f8                	mov    %edi,%eax
+  801b82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b87:	f7 75 0c             	divl   0xc(%ebp)
+  801b8a:	e9 01 ff ff ff       	jmp    801a90 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  801b8f:	89 d8                	mov    %ebx,%eax
+  801b91:	e8 ce f9 ff ff       	call   801564 <stream_drain>
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	79 9a                	jns    801b34 <fwrite+0xc2>
+  801b9a:	eb cc                	jmp    801b68 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	57                   	push   %edi
+  801ba0:	6a 0a                	push   $0xa
+  801ba2:	ff 75 08             	push   0x8(%ebp)
+  801ba5:	e8 ff 1e 00 00       	call   803aa9 <memfind>
+  801baa:	89 c2                	mov    %eax,%edx
+  801bac:	89 f8                	mov    %edi,%eax
+  801bae:	03 45 08             	add    0x8(%ebp),%eax
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	39 c2                	cmp    %eax,%edx
+  801bb6:	74 bd                	je     801b75 <fwrite+0x103>
+		stream_drain(f);
+  801bb8:	89 d8                	mov    %ebx,%eax
+  801bba:	e8 a5 f9 ff ff       	call   801564 <stream_drain>
+  801bbf:	eb b4                	jmp    801b75 <fwrite+0x103>
+
+00801bc1 <fputc>:
+{
+  801bc1:	55                   	push   %ebp
+  801bc2:	89 e5                	mov    %esp,%ebp
+  801bc4:	53                   	push   %ebx
+  801bc5:	83 ec 14             	sub    $0x14,%esp
+  801bc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  801bcb:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  801bce:	ff 75 0c             	push   0xc(%ebp)
+  801bd1:	6a 01                	push   $0x1
+  801bd3:	6a 01                	push   $0x1
+  801bd5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801bd8:	50                   	push   %eax
+  801bd9:	e8 94 fe ff ff       	call   801a72 <fwrite>
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	0f b6 db             	movzbl %bl,%ebx
+  801be4:	83 f8 01             	cmp    $0x1,%eax
+  801be7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bec:	0f 44 c3             	cmove  %ebx,%eax
+}
+  801bef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf2:	c9                   	leave
+  801bf3:	c3                   	ret
+
+00801bf4 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  801bfa:	ff 75 0c             	push   0xc(%ebp)
+  801bfd:	ff 75 08             	push   0x8(%ebp)
+  801c00:	e8 bc ff ff ff       	call   801bc1 <fputc>
+}
+  801c05:	83 c4 10             	add    $0x10,%esp
+  801c08:	c9                   	leave
+  801c09:	c3                   	ret
+
+00801c0a <fputs>:
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  801c12:	83 ec 0c             	sub    $0xc,%esp
+  801c15:	56                   	push   %esi
+  801c16:	e8 1c 1c 00 00       	call   803837 <strlen>
+  801c1b:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  801c1d:	ff 75 0c             	push   0xc(%ebp)
+  801c20:	50                   	push   %eax
+  801c21:	6a 01                	push   $0x1
+  801c23:	56                   	push   %esi
+  801c24:	e8 49 fe ff ff       	call   801a72 <fwrite>
+  801c29:	83 c4 20             	add    $0x20,%esp
+  801c2c:	39 d8                	cmp    %ebx,%eax
+  801c2e:	0f 95 c0             	setne  %al
+  801c31:	0f b6 c0             	movzbl %al,%eax
+  801c34:	f7 d8                	neg    %eax
+}
+  801c36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c39:	5b                   	pop    %ebx
+  801c3a:	5e                   	pop    %esi
+  801c3b:	5d                   	pop    %ebp
+  801c3c:	c3                   	ret
+
+00801c3d <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 04             	sub    $0x4,%esp
+  801c44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c47:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  801c4a:	50                   	push   %eax
+  801c4b:	ff 75 0c             	push   0xc(%ebp)
+  801c4e:	53                   	push   %ebx
+  801c4f:	68 f4 1b 80 00       	push   $0x801bf4
+  801c54:	e8 2c 17 00 00       	call   803385 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  801c59:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c5c:	c1 e0 1c             	shl    $0x1c,%eax
+  801c5f:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  801c62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c65:	c9                   	leave
+  801c66:	c3                   	ret
+
+00801c67 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c6d:	68 d0 47 80 00       	push   $0x8047d0
+  801c72:	ff 75 0c             	push   0xc(%ebp)
+  801c75:	e8 f8 1b 00 00       	call   803872 <strcpy>
+	return 0;
+}
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	c9                   	leave
+  801c80:	c3                   	ret
+
+00801c81 <devsock_close>:
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 10             	sub    $0x10,%esp
+  801c88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c8b:	53                   	push   %ebx
+  801c8c:	e8 26 27 00 00       	call   8043b7 <pageref>
+  801c91:	89 c2                	mov    %eax,%edx
+  801c93:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c9b:	83 fa 01             	cmp    $0x1,%edx
+  801c9e:	74 05                	je     801ca5 <devsock_close+0x24>
+}
+  801ca0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca3:	c9                   	leave
+  801ca4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ca5:	83 ec 0c             	sub    $0xc,%esp
+  801ca8:	ff 73 0c             	push   0xc(%ebx)
+  801cab:	e8 b7 02 00 00       	call   801f67 <nsipc_close>
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	eb eb                	jmp    801ca0 <devsock_close+0x1f>
+
+00801cb5 <devsock_write>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cbb:	6a 00                	push   $0x0
+  801cbd:	ff 75 10             	push   0x10(%ebp)
+  801cc0:	ff 75 0c             	push   0xc(%ebp)
+  801cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc6:	ff 70 0c             	push   0xc(%eax)
+  801cc9:	e8 79 03 00 00       	call   802047 <nsipc_send>
+}
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+
+00801cd0 <devsock_read>:
+{
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	ff 75 10             	push   0x10(%ebp)
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce1:	ff 70 0c             	push   0xc(%eax)
+  801ce4:	e8 ef 02 00 00       	call   801fd8 <nsipc_recv>
+}
+  801ce9:	c9                   	leave
+  801cea:	c3                   	ret
+
+00801ceb <fd2sockid>:
+{
+  801ceb:	55                   	push   %ebp
+  801cec:	89 e5                	mov    %esp,%ebp
+  801cee:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cf1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cf4:	52                   	push   %edx
+  801cf5:	50                   	push   %eax
+  801cf6:	e8 f7 e9 ff ff       	call   8006f2 <fd_lookup>
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 10                	js     801d12 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d05:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  801d0b:	39 08                	cmp    %ecx,(%eax)
+  801d0d:	75 05                	jne    801d14 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d0f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d14:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d19:	eb f7                	jmp    801d12 <fd2sockid+0x27>
+
+00801d1b <alloc_sockfd>:
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	56                   	push   %esi
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 1c             	sub    $0x1c,%esp
+  801d23:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d28:	50                   	push   %eax
+  801d29:	e8 6e e9 ff ff       	call   80069c <fd_alloc>
+  801d2e:	89 c3                	mov    %eax,%ebx
+  801d30:	83 c4 10             	add    $0x10,%esp
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 43                	js     801d7a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d37:	83 ec 04             	sub    $0x4,%esp
+  801d3a:	68 07 04 00 00       	push   $0x407
+  801d3f:	ff 75 f4             	push   -0xc(%ebp)
+  801d42:	6a 00                	push   $0x0
+  801d44:	e8 8a e4 ff ff       	call   8001d3 <sys_page_alloc>
+  801d49:	89 c3                	mov    %eax,%ebx
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 28                	js     801d7a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d55:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  801d5b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d60:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d67:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d6a:	83 ec 0c             	sub    $0xc,%esp
+  801d6d:	50                   	push   %eax
+  801d6e:	e8 02 e9 ff ff       	call   800675 <fd2num>
+  801d73:	89 c3                	mov    %eax,%ebx
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	eb 0c                	jmp    801d86 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d7a:	83 ec 0c             	sub    $0xc,%esp
+  801d7d:	56                   	push   %esi
+  801d7e:	e8 e4 01 00 00       	call   801f67 <nsipc_close>
+		return r;
+  801d83:	83 c4 10             	add    $0x10,%esp
+}
+  801d86:	89 d8                	mov    %ebx,%eax
+  801d88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8b:	5b                   	pop    %ebx
+  801d8c:	5e                   	pop    %esi
+  801d8d:	5d                   	pop    %ebp
+  801d8e:	c3                   	ret
+
+00801d8f <accept>:
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d98:	e8 4e ff ff ff       	call   801ceb <fd2sockid>
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	78 1b                	js     801dbc <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801da1:	83 ec 04             	sub    $0x4,%esp
+  801da4:	ff 75 10             	push   0x10(%ebp)
+  801da7:	ff 75 0c             	push   0xc(%ebp)
+  801daa:	50                   	push   %eax
+  801dab:	e8 0e 01 00 00       	call   801ebe <nsipc_accept>
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 05                	js     801dbc <accept+0x2d>
+	return alloc_sockfd(r);
+  801db7:	e8 5f ff ff ff       	call   801d1b <alloc_sockfd>
+}
+  801dbc:	c9                   	leave
+  801dbd:	c3                   	ret
+
+00801dbe <bind>:
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc7:	e8 1f ff ff ff       	call   801ceb <fd2sockid>
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	78 12                	js     801de2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dd0:	83 ec 04             	sub    $0x4,%esp
+  801dd3:	ff 75 10             	push   0x10(%ebp)
+  801dd6:	ff 75 0c             	push   0xc(%ebp)
+  801dd9:	50                   	push   %eax
+  801dda:	e8 31 01 00 00       	call   801f10 <nsipc_bind>
+  801ddf:	83 c4 10             	add    $0x10,%esp
+}
+  801de2:	c9                   	leave
+  801de3:	c3                   	ret
+
+00801de4 <shutdown>:
+{
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ded:	e8 f9 fe ff ff       	call   801ceb <fd2sockid>
+  801df2:	85 c0                	test   %eax,%eax
+  801df4:	78 0f                	js     801e05 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801df6:	83 ec 08             	sub    $0x8,%esp
+  801df9:	ff 75 0c             	push   0xc(%ebp)
+  801dfc:	50                   	push   %eax
+  801dfd:	e8 43 01 00 00       	call   801f45 <nsipc_shutdown>
+  801e02:	83 c4 10             	add    $0x10,%esp
+}
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <connect>:
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e10:	e8 d6 fe ff ff       	call   801ceb <fd2sockid>
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	78 12                	js     801e2b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e19:	83 ec 04             	sub    $0x4,%esp
+  801e1c:	ff 75 10             	push   0x10(%ebp)
+  801e1f:	ff 75 0c             	push   0xc(%ebp)
+  801e22:	50                   	push   %eax
+  801e23:	e8 59 01 00 00       	call   801f81 <nsipc_connect>
+  801e28:	83 c4 10             	add    $0x10,%esp
+}
+  801e2b:	c9                   	leave
+  801e2c:	c3                   	ret
+
+00801e2d <listen>:
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e36:	e8 b0 fe ff ff       	call   801ceb <fd2sockid>
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 0f                	js     801e4e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e3f:	83 ec 08             	sub    $0x8,%esp
+  801e42:	ff 75 0c             	push   0xc(%ebp)
+  801e45:	50                   	push   %eax
+  801e46:	e8 6b 01 00 00       	call   801fb6 <nsipc_listen>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+}
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+
+00801e50 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e56:	ff 75 10             	push   0x10(%ebp)
+  801e59:	ff 75 0c             	push   0xc(%ebp)
+  801e5c:	ff 75 08             	push   0x8(%ebp)
+  801e5f:	e8 41 02 00 00       	call   8020a5 <nsipc_socket>
+  801e64:	83 c4 10             	add    $0x10,%esp
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	78 05                	js     801e70 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e6b:	e8 ab fe ff ff       	call   801d1b <alloc_sockfd>
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+00801e72 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	53                   	push   %ebx
+  801e76:	83 ec 04             	sub    $0x4,%esp
+  801e79:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e7b:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801e82:	74 26                	je     801eaa <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e84:	6a 07                	push   $0x7
+  801e86:	68 00 80 80 00       	push   $0x808000
+  801e8b:	53                   	push   %ebx
+  801e8c:	ff 35 08 60 80 00    	push   0x806008
+  801e92:	e8 8b 24 00 00       	call   804322 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e97:	83 c4 0c             	add    $0xc,%esp
+  801e9a:	6a 00                	push   $0x0
+  801e9c:	6a 00                	push   $0x0
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 87 23 00 00       	call   80422c <ipc_recv>
+}
+  801ea5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801eaa:	83 ec 0c             	sub    $0xc,%esp
+  801ead:	6a 02                	push   $0x2
+  801eaf:	e8 c4 24 00 00       	call   804378 <ipc_find_env>
+  801eb4:	a3 08 60 80 00       	mov    %eax,0x806008
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	eb c6                	jmp    801e84 <nsipc+0x12>
+
+00801ebe <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	56                   	push   %esi
+  801ec2:	53                   	push   %ebx
+  801ec3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ece:	8b 06                	mov    (%esi),%eax
+  801ed0:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eda:	e8 93 ff ff ff       	call   801e72 <nsipc>
+  801edf:	89 c3                	mov    %eax,%ebx
+  801ee1:	85 c0                	test   %eax,%eax
+  801ee3:	79 09                	jns    801eee <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ee5:	89 d8                	mov    %ebx,%eax
+  801ee7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eea:	5b                   	pop    %ebx
+  801eeb:	5e                   	pop    %esi
+  801eec:	5d                   	pop    %ebp
+  801eed:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801eee:	83 ec 04             	sub    $0x4,%esp
+  801ef1:	ff 35 10 80 80 00    	push   0x808010
+  801ef7:	68 00 80 80 00       	push   $0x808000
+  801efc:	ff 75 0c             	push   0xc(%ebp)
+  801eff:	e8 f4 1a 00 00       	call   8039f8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f04:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f09:	89 06                	mov    %eax,(%esi)
+  801f0b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f0e:	eb d5                	jmp    801ee5 <nsipc_accept+0x27>
+
+00801f10 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	53                   	push   %ebx
+  801f14:	83 ec 08             	sub    $0x8,%esp
+  801f17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f22:	53                   	push   %ebx
+  801f23:	ff 75 0c             	push   0xc(%ebp)
+  801f26:	68 04 80 80 00       	push   $0x808004
+  801f2b:	e8 c8 1a 00 00       	call   8039f8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f30:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f36:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f3b:	e8 32 ff ff ff       	call   801e72 <nsipc>
+}
+  801f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+
+00801f45 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f56:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f60:	e8 0d ff ff ff       	call   801e72 <nsipc>
+}
+  801f65:	c9                   	leave
+  801f66:	c3                   	ret
+
+00801f67 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f70:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f75:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f7a:	e8 f3 fe ff ff       	call   801e72 <nsipc>
+}
+  801f7f:	c9                   	leave
+  801f80:	c3                   	ret
+
+00801f81 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f81:	55                   	push   %ebp
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	53                   	push   %ebx
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f93:	53                   	push   %ebx
+  801f94:	ff 75 0c             	push   0xc(%ebp)
+  801f97:	68 04 80 80 00       	push   $0x808004
+  801f9c:	e8 57 1a 00 00       	call   8039f8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fa1:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801fa7:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fac:	e8 c1 fe ff ff       	call   801e72 <nsipc>
+}
+  801fb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+00801fb6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc7:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd1:	e8 9c fe ff ff       	call   801e72 <nsipc>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	56                   	push   %esi
+  801fdc:	53                   	push   %ebx
+  801fdd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fe0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fe8:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fee:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff1:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801ff6:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ffb:	e8 72 fe ff ff       	call   801e72 <nsipc>
+  802000:	89 c3                	mov    %eax,%ebx
+  802002:	85 c0                	test   %eax,%eax
+  802004:	78 22                	js     802028 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802006:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80200b:	39 c6                	cmp    %eax,%esi
+  80200d:	0f 4e c6             	cmovle %esi,%eax
+  802010:	39 c3                	cmp    %eax,%ebx
+  802012:	7f 1d                	jg     802031 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802014:	83 ec 04             	sub    $0x4,%esp
+  802017:	53                   	push   %ebx
+  802018:	68 00 80 80 00       	push   $0x808000
+  80201d:	ff 75 0c             	push   0xc(%ebp)
+  802020:	e8 d3 19 00 00       	call   8039f8 <memmove>
+  802025:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802028:	89 d8                	mov    %ebx,%eax
+  80202a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202d:	5b                   	pop    %ebx
+  80202e:	5e                   	pop    %esi
+  80202f:	5d                   	pop    %ebp
+  802030:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802031:	68 dc 47 80 00       	push   $0x8047dc
+  802036:	68 95 47 80 00       	push   $0x804795
+  80203b:	6a 62                	push   $0x62
+  80203d:	68 f1 47 80 00       	push   $0x8047f1
+  802042:	e8 6c 11 00 00       	call   8031b3 <_panic>
+
+00802047 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802047:	55                   	push   %ebp
+  802048:	89 e5                	mov    %esp,%ebp
+  80204a:	53                   	push   %ebx
+  80204b:	83 ec 04             	sub    $0x4,%esp
+  80204e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802051:	8b 45 08             	mov    0x8(%ebp),%eax
+  802054:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802059:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80205f:	7f 2e                	jg     80208f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802061:	83 ec 04             	sub    $0x4,%esp
+  802064:	53                   	push   %ebx
+  802065:	ff 75 0c             	push   0xc(%ebp)
+  802068:	68 0c 80 80 00       	push   $0x80800c
+  80206d:	e8 86 19 00 00       	call   8039f8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802072:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802078:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802080:	b8 08 00 00 00       	mov    $0x8,%eax
+  802085:	e8 e8 fd ff ff       	call   801e72 <nsipc>
+}
+  80208a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208d:	c9                   	leave
+  80208e:	c3                   	ret
+	assert(size < 1600);
+  80208f:	68 fd 47 80 00       	push   $0x8047fd
+  802094:	68 95 47 80 00       	push   $0x804795
+  802099:	6a 6d                	push   $0x6d
+  80209b:	68 f1 47 80 00       	push   $0x8047f1
+  8020a0:	e8 0e 11 00 00       	call   8031b3 <_panic>
+
+008020a5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ae:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8020b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b6:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020be:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020c3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020c8:	e8 a5 fd ff ff       	call   801e72 <nsipc>
+}
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+008020cf <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	53                   	push   %ebx
+  8020d3:	83 ec 10             	sub    $0x10,%esp
+  8020d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8020d9:	68 0c 60 80 00       	push   $0x80600c
+  8020de:	e8 50 07 00 00       	call   802833 <mutex_lock>
+	if (v == 0)
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	85 db                	test   %ebx,%ebx
+  8020e8:	0f 84 85 00 00 00    	je     802173 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8020ee:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8020f4:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8020f9:	77 51                	ja     80214c <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8020fb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802101:	89 d8                	mov    %ebx,%eax
+  802103:	c1 e8 0c             	shr    $0xc,%eax
+  802106:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80210d:	f6 c4 02             	test   $0x2,%ah
+  802110:	74 50                	je     802162 <free+0x93>
+		sys_page_unmap(0, c);
+  802112:	83 ec 08             	sub    $0x8,%esp
+  802115:	53                   	push   %ebx
+  802116:	6a 00                	push   $0x0
+  802118:	e8 4f e1 ff ff       	call   80026c <sys_page_unmap>
+		c += PGSIZE;
+  80211d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802123:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802131:	76 ce                	jbe    802101 <free+0x32>
+  802133:	68 47 48 80 00       	push   $0x804847
+  802138:	68 95 47 80 00       	push   $0x804795
+  80213d:	68 82 00 00 00       	push   $0x82
+  802142:	68 3a 48 80 00       	push   $0x80483a
+  802147:	e8 67 10 00 00       	call   8031b3 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80214c:	68 0c 48 80 00       	push   $0x80480c
+  802151:	68 95 47 80 00       	push   $0x804795
+  802156:	6a 7b                	push   $0x7b
+  802158:	68 3a 48 80 00       	push   $0x80483a
+  80215d:	e8 51 10 00 00       	call   8031b3 <_panic>
+	if (--(*ref) == 0)
+  802162:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802168:	83 e8 01             	sub    $0x1,%eax
+  80216b:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802171:	74 15                	je     802188 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802173:	83 ec 0c             	sub    $0xc,%esp
+  802176:	68 0c 60 80 00       	push   $0x80600c
+  80217b:	e8 20 07 00 00       	call   8028a0 <mutex_unlock>
+}
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802186:	c9                   	leave
+  802187:	c3                   	ret
+		sys_page_unmap(0, c);
+  802188:	83 ec 08             	sub    $0x8,%esp
+  80218b:	53                   	push   %ebx
+  80218c:	6a 00                	push   $0x0
+  80218e:	e8 d9 e0 ff ff       	call   80026c <sys_page_unmap>
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	eb db                	jmp    802173 <free+0xa4>
+
+00802198 <malloc>:
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	57                   	push   %edi
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8021a1:	68 0c 60 80 00       	push   $0x80600c
+  8021a6:	e8 88 06 00 00       	call   802833 <mutex_lock>
+	if (mptr == 0)
+  8021ab:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	85 ff                	test   %edi,%edi
+  8021b6:	74 6c                	je     802224 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8021b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bb:	83 c0 03             	add    $0x3,%eax
+  8021be:	83 e0 fc             	and    $0xfffffffc,%eax
+  8021c1:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8021c3:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8021c8:	0f 87 64 01 00 00    	ja     802332 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8021ce:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8021d4:	74 30                	je     802206 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8021d6:	89 f9                	mov    %edi,%ecx
+  8021d8:	c1 e9 0c             	shr    $0xc,%ecx
+  8021db:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8021df:	c1 e8 0c             	shr    $0xc,%eax
+  8021e2:	39 c1                	cmp    %eax,%ecx
+  8021e4:	74 5f                	je     802245 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8021e6:	83 ec 0c             	sub    $0xc,%esp
+  8021e9:	57                   	push   %edi
+  8021ea:	e8 e0 fe ff ff       	call   8020cf <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8021ef:	a1 10 60 80 00       	mov    0x806010,%eax
+  8021f4:	05 00 10 00 00       	add    $0x1000,%eax
+  8021f9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021fe:	a3 10 60 80 00       	mov    %eax,0x806010
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  80220c:	ba 02 00 00 00       	mov    $0x2,%edx
+  802211:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802215:	8d 7e 04             	lea    0x4(%esi),%edi
+  802218:	89 cb                	mov    %ecx,%ebx
+  80221a:	01 f9                	add    %edi,%ecx
+  80221c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80221f:	e9 8b 00 00 00       	jmp    8022af <malloc+0x117>
+		mptr = mbegin;
+  802224:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  80222b:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80222e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802231:	83 c0 03             	add    $0x3,%eax
+  802234:	83 e0 fc             	and    $0xfffffffc,%eax
+  802237:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802239:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80223e:	76 c6                	jbe    802206 <malloc+0x6e>
+  802240:	e9 d6 00 00 00       	jmp    80231b <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802245:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80224b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802250:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802254:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802257:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80225c:	e9 ba 00 00 00       	jmp    80231b <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802261:	05 00 10 00 00       	add    $0x1000,%eax
+  802266:	39 c8                	cmp    %ecx,%eax
+  802268:	0f 83 cb 00 00 00    	jae    802339 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80226e:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802273:	77 22                	ja     802297 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802275:	89 c2                	mov    %eax,%edx
+  802277:	c1 ea 16             	shr    $0x16,%edx
+  80227a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802281:	f6 c2 01             	test   $0x1,%dl
+  802284:	74 db                	je     802261 <malloc+0xc9>
+  802286:	89 c2                	mov    %eax,%edx
+  802288:	c1 ea 0c             	shr    $0xc,%edx
+  80228b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802292:	f6 c2 01             	test   $0x1,%dl
+  802295:	74 ca                	je     802261 <malloc+0xc9>
+		if (mptr == mend) {
+  802297:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80229d:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8022a3:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8022a7:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8022ad:	74 04                	je     8022b3 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8022af:	89 d8                	mov    %ebx,%eax
+  8022b1:	eb b3                	jmp    802266 <malloc+0xce>
+  8022b3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8022b6:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022bb:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8022bf:	83 ea 01             	sub    $0x1,%edx
+  8022c2:	0f 85 50 ff ff ff    	jne    802218 <malloc+0x80>
+  8022c8:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8022cf:	00 00 08 
+				return 0;	/* out of address space */
+  8022d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d7:	eb 42                	jmp    80231b <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8022d9:	85 db                	test   %ebx,%ebx
+  8022db:	78 1e                	js     8022fb <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8022dd:	83 ec 08             	sub    $0x8,%esp
+  8022e0:	89 d8                	mov    %ebx,%eax
+  8022e2:	03 05 10 60 80 00    	add    0x806010,%eax
+  8022e8:	50                   	push   %eax
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	e8 7c df ff ff       	call   80026c <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8022f0:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	eb de                	jmp    8022d9 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8022fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802300:	eb 19                	jmp    80231b <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802302:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802305:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80230b:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802312:	00 
+	mptr += n;
+  802313:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802316:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  80231b:	83 ec 0c             	sub    $0xc,%esp
+  80231e:	68 0c 60 80 00       	push   $0x80600c
+  802323:	e8 78 05 00 00       	call   8028a0 <mutex_unlock>
+}
+  802328:	89 f8                	mov    %edi,%eax
+  80232a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232d:	5b                   	pop    %ebx
+  80232e:	5e                   	pop    %esi
+  80232f:	5f                   	pop    %edi
+  802330:	5d                   	pop    %ebp
+  802331:	c3                   	ret
+		return 0;
+  802332:	bf 00 00 00 00       	mov    $0x0,%edi
+  802337:	eb e2                	jmp    80231b <malloc+0x183>
+  802339:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80233d:	74 06                	je     802345 <malloc+0x1ad>
+  80233f:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80234d:	39 fb                	cmp    %edi,%ebx
+  80234f:	73 b1                	jae    802302 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802351:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802357:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80235a:	39 fe                	cmp    %edi,%esi
+  80235c:	0f 92 c0             	setb   %al
+  80235f:	0f b6 c0             	movzbl %al,%eax
+  802362:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802365:	83 c8 07             	or     $0x7,%eax
+  802368:	50                   	push   %eax
+  802369:	89 d8                	mov    %ebx,%eax
+  80236b:	03 05 10 60 80 00    	add    0x806010,%eax
+  802371:	50                   	push   %eax
+  802372:	6a 00                	push   $0x0
+  802374:	e8 5a de ff ff       	call   8001d3 <sys_page_alloc>
+  802379:	83 c4 10             	add    $0x10,%esp
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	0f 88 55 ff ff ff    	js     8022d9 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802384:	89 f3                	mov    %esi,%ebx
+  802386:	eb c5                	jmp    80234d <malloc+0x1b5>
+
+00802388 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+  80238d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802390:	83 ec 0c             	sub    $0xc,%esp
+  802393:	ff 75 08             	push   0x8(%ebp)
+  802396:	e8 ea e2 ff ff       	call   800685 <fd2data>
+  80239b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80239d:	83 c4 08             	add    $0x8,%esp
+  8023a0:	68 5f 48 80 00       	push   $0x80485f
+  8023a5:	53                   	push   %ebx
+  8023a6:	e8 c7 14 00 00       	call   803872 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8023ab:	8b 46 04             	mov    0x4(%esi),%eax
+  8023ae:	2b 06                	sub    (%esi),%eax
+  8023b0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023b6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023bd:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023c0:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  8023c7:	52 80 00 
+	return 0;
+}
+  8023ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d2:	5b                   	pop    %ebx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5d                   	pop    %ebp
+  8023d5:	c3                   	ret
+
+008023d6 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8023d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023db:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8023df:	85 c9                	test   %ecx,%ecx
+  8023e1:	75 01                	jne    8023e4 <pipewake+0xe>
+  8023e3:	c3                   	ret
+{
+  8023e4:	55                   	push   %ebp
+  8023e5:	89 e5                	mov    %esp,%ebp
+  8023e7:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8023ea:	68 00 04 00 00       	push   $0x400
+  8023ef:	52                   	push   %edx
+  8023f0:	e8 22 e1 ff ff       	call   800517 <sys_futex_wake>
+  8023f5:	83 c4 10             	add    $0x10,%esp
+}
+  8023f8:	c9                   	leave
+  8023f9:	c3                   	ret
+
+008023fa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	56                   	push   %esi
+  8023fe:	53                   	push   %ebx
+  8023ff:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802402:	83 ec 0c             	sub    $0xc,%esp
+  802405:	56                   	push   %esi
+  802406:	e8 7a e2 ff ff       	call   800685 <fd2data>
+  80240b:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80240d:	83 c4 08             	add    $0x8,%esp
+  802410:	56                   	push   %esi
+  802411:	6a 00                	push   $0x0
+  802413:	e8 54 de ff ff       	call   80026c <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802418:	8d 53 04             	lea    0x4(%ebx),%edx
+  80241b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80241e:	e8 b3 ff ff ff       	call   8023d6 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802423:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802426:	89 da                	mov    %ebx,%edx
+  802428:	e8 a9 ff ff ff       	call   8023d6 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80242d:	89 34 24             	mov    %esi,(%esp)
+  802430:	e8 50 e2 ff ff       	call   800685 <fd2data>
+  802435:	83 c4 08             	add    $0x8,%esp
+  802438:	50                   	push   %eax
+  802439:	6a 00                	push   $0x0
+  80243b:	e8 2c de ff ff       	call   80026c <sys_page_unmap>
+}
+  802440:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802443:	5b                   	pop    %ebx
+  802444:	5e                   	pop    %esi
+  802445:	5d                   	pop    %ebp
+  802446:	c3                   	ret
+
+00802447 <_pipeisclosed>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	57                   	push   %edi
+  80244b:	56                   	push   %esi
+  80244c:	53                   	push   %ebx
+  80244d:	83 ec 1c             	sub    $0x1c,%esp
+  802450:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802453:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802455:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80245a:	eb 5d                	jmp    8024b9 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80245c:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802462:	8b 02                	mov    (%edx),%eax
+  802464:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802467:	83 ec 0c             	sub    $0xc,%esp
+  80246a:	ff 75 e0             	push   -0x20(%ebp)
+  80246d:	e8 45 1f 00 00       	call   8043b7 <pageref>
+  802472:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802475:	89 3c 24             	mov    %edi,(%esp)
+  802478:	e8 3a 1f 00 00       	call   8043b7 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80247d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80247f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80248e:	77 15                	ja     8024a5 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802490:	89 f2                	mov    %esi,%edx
+  802492:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802494:	c1 ea 10             	shr    $0x10,%edx
+  802497:	74 0c                	je     8024a5 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802499:	c1 e2 10             	shl    $0x10,%edx
+  80249c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8024a1:	29 d1                	sub    %edx,%ecx
+  8024a3:	eb 06                	jmp    8024ab <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8024a5:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  8024ab:	8b 11                	mov    (%ecx),%edx
+  8024ad:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8024b0:	39 d3                	cmp    %edx,%ebx
+  8024b2:	74 6e                	je     802522 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8024b4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024b7:	74 24                	je     8024dd <_pipeisclosed+0x96>
+  8024b9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024bb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024c1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024c6:	77 94                	ja     80245c <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024c8:	89 f0                	mov    %esi,%eax
+  8024ca:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024cc:	c1 e8 10             	shr    $0x10,%eax
+  8024cf:	74 8b                	je     80245c <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024d1:	c1 e0 10             	shl    $0x10,%eax
+  8024d4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8024d9:	29 c2                	sub    %eax,%edx
+  8024db:	eb 85                	jmp    802462 <_pipeisclosed+0x1b>
+  8024dd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8024df:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8024e5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8024ea:	77 18                	ja     802504 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8024ec:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8024f1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8024f3:	c1 e8 10             	shr    $0x10,%eax
+  8024f6:	74 0c                	je     802504 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8024f8:	c1 e0 10             	shl    $0x10,%eax
+  8024fb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802500:	29 c2                	sub    %eax,%edx
+  802502:	eb 06                	jmp    80250a <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802504:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80250a:	8b 02                	mov    (%edx),%eax
+  80250c:	8b 40 58             	mov    0x58(%eax),%eax
+  80250f:	6a 01                	push   $0x1
+  802511:	50                   	push   %eax
+  802512:	53                   	push   %ebx
+  802513:	68 66 48 80 00       	push   $0x804866
+  802518:	e8 71 0d 00 00       	call   80328e <cprintf>
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	eb 97                	jmp    8024b9 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802522:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802525:	0f 94 c0             	sete   %al
+  802528:	0f b6 c0             	movzbl %al,%eax
+}
+  80252b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80252e:	5b                   	pop    %ebx
+  80252f:	5e                   	pop    %esi
+  802530:	5f                   	pop    %edi
+  802531:	5d                   	pop    %ebp
+  802532:	c3                   	ret
+
+00802533 <devpipe_write>:
+{
+  802533:	55                   	push   %ebp
+  802534:	89 e5                	mov    %esp,%ebp
+  802536:	57                   	push   %edi
+  802537:	56                   	push   %esi
+  802538:	53                   	push   %ebx
+  802539:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80253c:	ff 75 08             	push   0x8(%ebp)
+  80253f:	e8 41 e1 ff ff       	call   800685 <fd2data>
+  802544:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802546:	83 c4 10             	add    $0x10,%esp
+  802549:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802550:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802553:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802556:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802559:	0f 84 96 00 00 00    	je     8025f5 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80255f:	8d 73 08             	lea    0x8(%ebx),%esi
+  802562:	eb 32                	jmp    802596 <devpipe_write+0x63>
+  802564:	89 fa                	mov    %edi,%edx
+  802566:	89 f0                	mov    %esi,%eax
+  802568:	e8 69 fe ff ff       	call   8023d6 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80256d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802570:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802573:	ba 01 00 00 00       	mov    $0x1,%edx
+  802578:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80257d:	83 ec 04             	sub    $0x4,%esp
+  802580:	6a 0a                	push   $0xa
+  802582:	50                   	push   %eax
+  802583:	53                   	push   %ebx
+  802584:	e8 5f df ff ff       	call   8004e8 <sys_futex_wait>
+  802589:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80258e:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  802593:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802596:	8b 43 04             	mov    0x4(%ebx),%eax
+  802599:	8b 0b                	mov    (%ebx),%ecx
+  80259b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80259e:	39 d0                	cmp    %edx,%eax
+  8025a0:	72 1b                	jb     8025bd <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8025a2:	89 da                	mov    %ebx,%edx
+  8025a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a7:	e8 9b fe ff ff       	call   802447 <_pipeisclosed>
+  8025ac:	85 c0                	test   %eax,%eax
+  8025ae:	74 b4                	je     802564 <devpipe_write+0x31>
+				return 0;
+  8025b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b8:	5b                   	pop    %ebx
+  8025b9:	5e                   	pop    %esi
+  8025ba:	5f                   	pop    %edi
+  8025bb:	5d                   	pop    %ebp
+  8025bc:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025c3:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8025c7:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8025ca:	89 c2                	mov    %eax,%edx
+  8025cc:	c1 fa 1f             	sar    $0x1f,%edx
+  8025cf:	89 d1                	mov    %edx,%ecx
+  8025d1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025d4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025d7:	83 e2 1f             	and    $0x1f,%edx
+  8025da:	29 ca                	sub    %ecx,%edx
+  8025dc:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8025e0:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8025e4:	83 c0 01             	add    $0x1,%eax
+  8025e7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025ea:	83 c6 01             	add    $0x1,%esi
+  8025ed:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8025f0:	e9 5e ff ff ff       	jmp    802553 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8025f5:	8d 53 04             	lea    0x4(%ebx),%edx
+  8025f8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025fb:	e8 d6 fd ff ff       	call   8023d6 <pipewake>
+	return i;
+  802600:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802603:	eb b0                	jmp    8025b5 <devpipe_write+0x82>
+
+00802605 <devpipe_read>:
+{
+  802605:	55                   	push   %ebp
+  802606:	89 e5                	mov    %esp,%ebp
+  802608:	57                   	push   %edi
+  802609:	56                   	push   %esi
+  80260a:	53                   	push   %ebx
+  80260b:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80260e:	ff 75 08             	push   0x8(%ebp)
+  802611:	e8 6f e0 ff ff       	call   800685 <fd2data>
+  802616:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802618:	83 c4 10             	add    $0x10,%esp
+  80261b:	be 00 00 00 00       	mov    $0x0,%esi
+  802620:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802623:	74 6c                	je     802691 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  802625:	8d 7b 04             	lea    0x4(%ebx),%edi
+  802628:	eb 25                	jmp    80264f <devpipe_read+0x4a>
+  80262a:	8b 13                	mov    (%ebx),%edx
+  80262c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802631:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802636:	83 ec 04             	sub    $0x4,%esp
+  802639:	6a 0a                	push   $0xa
+  80263b:	52                   	push   %edx
+  80263c:	57                   	push   %edi
+  80263d:	e8 a6 de ff ff       	call   8004e8 <sys_futex_wait>
+  802642:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802647:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80264c:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80264f:	8b 03                	mov    (%ebx),%eax
+  802651:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802654:	75 19                	jne    80266f <devpipe_read+0x6a>
+			if (i > 0)
+  802656:	85 f6                	test   %esi,%esi
+  802658:	75 3a                	jne    802694 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80265a:	89 da                	mov    %ebx,%edx
+  80265c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265f:	e8 e3 fd ff ff       	call   802447 <_pipeisclosed>
+  802664:	85 c0                	test   %eax,%eax
+  802666:	74 c2                	je     80262a <devpipe_read+0x25>
+				return 0;
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266d:	eb 31                	jmp    8026a0 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80266f:	89 c1                	mov    %eax,%ecx
+  802671:	c1 f9 1f             	sar    $0x1f,%ecx
+  802674:	c1 e9 1b             	shr    $0x1b,%ecx
+  802677:	01 c8                	add    %ecx,%eax
+  802679:	83 e0 1f             	and    $0x1f,%eax
+  80267c:	29 c8                	sub    %ecx,%eax
+  80267e:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  802683:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802686:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802689:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80268c:	83 c6 01             	add    $0x1,%esi
+  80268f:	eb 8f                	jmp    802620 <devpipe_read+0x1b>
+out:
+  802691:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802694:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802697:	89 da                	mov    %ebx,%edx
+  802699:	e8 38 fd ff ff       	call   8023d6 <pipewake>
+	return i;
+  80269e:	89 f0                	mov    %esi,%eax
+}
+  8026a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a3:	5b                   	pop    %ebx
+  8026a4:	5e                   	pop    %esi
+  8026a5:	5f                   	pop    %edi
+  8026a6:	5d                   	pop    %ebp
+  8026a7:	c3                   	ret
+
+008026a8 <pipe>:
+{
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	56                   	push   %esi
+  8026ac:	53                   	push   %ebx
+  8026ad:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	e8 e3 df ff ff       	call   80069c <fd_alloc>
+  8026b9:	89 c3                	mov    %eax,%ebx
+  8026bb:	83 c4 10             	add    $0x10,%esp
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	0f 88 23 01 00 00    	js     8027e9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c6:	83 ec 04             	sub    $0x4,%esp
+  8026c9:	68 07 04 00 00       	push   $0x407
+  8026ce:	ff 75 f4             	push   -0xc(%ebp)
+  8026d1:	6a 00                	push   $0x0
+  8026d3:	e8 fb da ff ff       	call   8001d3 <sys_page_alloc>
+  8026d8:	89 c3                	mov    %eax,%ebx
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	85 c0                	test   %eax,%eax
+  8026df:	0f 88 04 01 00 00    	js     8027e9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e5:	83 ec 0c             	sub    $0xc,%esp
+  8026e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026eb:	50                   	push   %eax
+  8026ec:	e8 ab df ff ff       	call   80069c <fd_alloc>
+  8026f1:	89 c3                	mov    %eax,%ebx
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	0f 88 db 00 00 00    	js     8027d9 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fe:	83 ec 04             	sub    $0x4,%esp
+  802701:	68 07 04 00 00       	push   $0x407
+  802706:	ff 75 f0             	push   -0x10(%ebp)
+  802709:	6a 00                	push   $0x0
+  80270b:	e8 c3 da ff ff       	call   8001d3 <sys_page_alloc>
+  802710:	89 c3                	mov    %eax,%ebx
+  802712:	83 c4 10             	add    $0x10,%esp
+  802715:	85 c0                	test   %eax,%eax
+  802717:	0f 88 bc 00 00 00    	js     8027d9 <pipe+0x131>
+	va = fd2data(fd0);
+  80271d:	83 ec 0c             	sub    $0xc,%esp
+  802720:	ff 75 f4             	push   -0xc(%ebp)
+  802723:	e8 5d df ff ff       	call   800685 <fd2data>
+  802728:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272a:	83 c4 0c             	add    $0xc,%esp
+  80272d:	68 07 04 00 00       	push   $0x407
+  802732:	50                   	push   %eax
+  802733:	6a 00                	push   $0x0
+  802735:	e8 99 da ff ff       	call   8001d3 <sys_page_alloc>
+  80273a:	89 c3                	mov    %eax,%ebx
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	0f 88 82 00 00 00    	js     8027c9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802747:	83 ec 0c             	sub    $0xc,%esp
+  80274a:	ff 75 f0             	push   -0x10(%ebp)
+  80274d:	e8 33 df ff ff       	call   800685 <fd2data>
+  802752:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802759:	50                   	push   %eax
+  80275a:	6a 00                	push   $0x0
+  80275c:	56                   	push   %esi
+  80275d:	6a 00                	push   $0x0
+  80275f:	e8 bc da ff ff       	call   800220 <sys_page_map>
+  802764:	89 c3                	mov    %eax,%ebx
+  802766:	83 c4 20             	add    $0x20,%esp
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 4e                	js     8027bb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80276d:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  802772:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802775:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802777:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802781:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802784:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802786:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802789:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802790:	83 ec 0c             	sub    $0xc,%esp
+  802793:	ff 75 f4             	push   -0xc(%ebp)
+  802796:	e8 da de ff ff       	call   800675 <fd2num>
+  80279b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a0:	83 c4 04             	add    $0x4,%esp
+  8027a3:	ff 75 f0             	push   -0x10(%ebp)
+  8027a6:	e8 ca de ff ff       	call   800675 <fd2num>
+  8027ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027ae:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b1:	83 c4 10             	add    $0x10,%esp
+  8027b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b9:	eb 2e                	jmp    8027e9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027bb:	83 ec 08             	sub    $0x8,%esp
+  8027be:	56                   	push   %esi
+  8027bf:	6a 00                	push   $0x0
+  8027c1:	e8 a6 da ff ff       	call   80026c <sys_page_unmap>
+  8027c6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027c9:	83 ec 08             	sub    $0x8,%esp
+  8027cc:	ff 75 f0             	push   -0x10(%ebp)
+  8027cf:	6a 00                	push   $0x0
+  8027d1:	e8 96 da ff ff       	call   80026c <sys_page_unmap>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027d9:	83 ec 08             	sub    $0x8,%esp
+  8027dc:	ff 75 f4             	push   -0xc(%ebp)
+  8027df:	6a 00                	push   $0x0
+  8027e1:	e8 86 da ff ff       	call   80026c <sys_page_unmap>
+  8027e6:	83 c4 10             	add    $0x10,%esp
+}
+  8027e9:	89 d8                	mov    %ebx,%eax
+  8027eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ee:	5b                   	pop    %ebx
+  8027ef:	5e                   	pop    %esi
+  8027f0:	5d                   	pop    %ebp
+  8027f1:	c3                   	ret
+
+008027f2 <pipeisclosed>:
+{
+  8027f2:	55                   	push   %ebp
+  8027f3:	89 e5                	mov    %esp,%ebp
+  8027f5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027fb:	50                   	push   %eax
+  8027fc:	ff 75 08             	push   0x8(%ebp)
+  8027ff:	e8 ee de ff ff       	call   8006f2 <fd_lookup>
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	85 c0                	test   %eax,%eax
+  802809:	78 18                	js     802823 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280b:	83 ec 0c             	sub    $0xc,%esp
+  80280e:	ff 75 f4             	push   -0xc(%ebp)
+  802811:	e8 6f de ff ff       	call   800685 <fd2data>
+  802816:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281b:	e8 27 fc ff ff       	call   802447 <_pipeisclosed>
+  802820:	83 c4 10             	add    $0x10,%esp
+}
+  802823:	c9                   	leave
+  802824:	c3                   	ret
+
+00802825 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  802825:	55                   	push   %ebp
+  802826:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802831:	5d                   	pop    %ebp
+  802832:	c3                   	ret
+
+00802833 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  802833:	55                   	push   %ebp
+  802834:	89 e5                	mov    %esp,%ebp
+  802836:	56                   	push   %esi
+  802837:	53                   	push   %ebx
+  802838:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80283b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802840:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802845:	89 d0                	mov    %edx,%eax
+  802847:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80284b:	85 c0                	test   %eax,%eax
+  80284d:	74 2d                	je     80287c <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80284f:	83 f8 02             	cmp    $0x2,%eax
+  802852:	74 08                	je     80285c <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  802854:	b8 02 00 00 00       	mov    $0x2,%eax
+  802859:	f0 87 03             	lock xchg %eax,(%ebx)
+  80285c:	be 02 00 00 00       	mov    $0x2,%esi
+  802861:	eb 15                	jmp    802878 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  802863:	83 ec 04             	sub    $0x4,%esp
+  802866:	6a 00                	push   $0x0
+  802868:	6a 02                	push   $0x2
+  80286a:	53                   	push   %ebx
+  80286b:	e8 78 dc ff ff       	call   8004e8 <sys_futex_wait>
+  802870:	89 f0                	mov    %esi,%eax
+  802872:	f0 87 03             	lock xchg %eax,(%ebx)
+  802875:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	75 e7                	jne    802863 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80287c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287f:	5b                   	pop    %ebx
+  802880:	5e                   	pop    %esi
+  802881:	5d                   	pop    %ebp
+  802882:	c3                   	ret
+
+00802883 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  802883:	55                   	push   %ebp
+  802884:	89 e5                	mov    %esp,%ebp
+  802886:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  802889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802893:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  802897:	f7 d8                	neg    %eax
+  802899:	19 c0                	sbb    %eax,%eax
+  80289b:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  80289e:	5d                   	pop    %ebp
+  80289f:	c3                   	ret
+
+008028a0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8028a0:	55                   	push   %ebp
+  8028a1:	89 e5                	mov    %esp,%ebp
+  8028a3:	83 ec 08             	sub    $0x8,%esp
+  8028a6:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8028a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ae:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8028b1:	83 f8 02             	cmp    $0x2,%eax
+  8028b4:	74 02                	je     8028b8 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8028b6:	c9                   	leave
+  8028b7:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+  8028bb:	6a 01                	push   $0x1
+  8028bd:	52                   	push   %edx
+  8028be:	e8 54 dc ff ff       	call   800517 <sys_futex_wake>
+  8028c3:	83 c4 10             	add    $0x10,%esp
+}
+  8028c6:	eb ee                	jmp    8028b6 <mutex_unlock+0x16>
+
+008028c8 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8028c8:	55                   	push   %ebp
+  8028c9:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8028cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ce:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8028d4:	5d                   	pop    %ebp
+  8028d5:	c3                   	ret
+
+008028d6 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	57                   	push   %edi
+  8028da:	56                   	push   %esi
+  8028db:	53                   	push   %ebx
+  8028dc:	83 ec 18             	sub    $0x18,%esp
+  8028df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8028e5:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8028e7:	53                   	push   %ebx
+  8028e8:	e8 b3 ff ff ff       	call   8028a0 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8028ed:	83 c4 0c             	add    $0xc,%esp
+  8028f0:	ff 75 10             	push   0x10(%ebp)
+  8028f3:	57                   	push   %edi
+  8028f4:	56                   	push   %esi
+  8028f5:	e8 ee db ff ff       	call   8004e8 <sys_futex_wait>
+  8028fa:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8028fc:	83 c4 10             	add    $0x10,%esp
+  8028ff:	be 02 00 00 00       	mov    $0x2,%esi
+  802904:	eb 10                	jmp    802916 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802906:	83 ec 04             	sub    $0x4,%esp
+  802909:	6a 00                	push   $0x0
+  80290b:	6a 02                	push   $0x2
+  80290d:	53                   	push   %ebx
+  80290e:	e8 d5 db ff ff       	call   8004e8 <sys_futex_wait>
+  802913:	83 c4 10             	add    $0x10,%esp
+  802916:	89 f0                	mov    %esi,%eax
+  802918:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	75 e7                	jne    802906 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80291f:	83 ff ec             	cmp    $0xffffffec,%edi
+  802922:	74 05                	je     802929 <cond_timedwait+0x53>
+  802924:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802929:	89 f8                	mov    %edi,%eax
+  80292b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292e:	5b                   	pop    %ebx
+  80292f:	5e                   	pop    %esi
+  802930:	5f                   	pop    %edi
+  802931:	5d                   	pop    %ebp
+  802932:	c3                   	ret
+
+00802933 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  802939:	6a 00                	push   $0x0
+  80293b:	ff 75 0c             	push   0xc(%ebp)
+  80293e:	ff 75 08             	push   0x8(%ebp)
+  802941:	e8 90 ff ff ff       	call   8028d6 <cond_timedwait>
+}
+  802946:	83 c4 10             	add    $0x10,%esp
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+0080294b <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 10             	sub    $0x10,%esp
+  802951:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  802954:	ba 01 00 00 00       	mov    $0x1,%edx
+  802959:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80295d:	6a 01                	push   $0x1
+  80295f:	50                   	push   %eax
+  802960:	e8 b2 db ff ff       	call   800517 <sys_futex_wake>
+}
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+0080296a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	83 ec 10             	sub    $0x10,%esp
+  802970:	8b 45 08             	mov    0x8(%ebp),%eax
+  802973:	ba 01 00 00 00       	mov    $0x1,%edx
+  802978:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80297c:	68 00 04 00 00       	push   $0x400
+  802981:	50                   	push   %eax
+  802982:	e8 90 db ff ff       	call   800517 <sys_futex_wake>
+}
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  802992:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802995:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  802997:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80299e:	5d                   	pop    %ebp
+  80299f:	c3                   	ret
+
+008029a0 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	53                   	push   %ebx
+  8029a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8029a7:	8b 11                	mov    (%ecx),%edx
+  8029a9:	85 d2                	test   %edx,%edx
+  8029ab:	74 14                	je     8029c1 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8029ad:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8029b0:	89 d0                	mov    %edx,%eax
+  8029b2:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8029b6:	39 c2                	cmp    %eax,%edx
+  8029b8:	75 ed                	jne    8029a7 <sem_trywait+0x7>
+			return 0;
+  8029ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bf:	eb 05                	jmp    8029c6 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8029c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8029c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c9:	c9                   	leave
+  8029ca:	c3                   	ret
+
+008029cb <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	57                   	push   %edi
+  8029cf:	56                   	push   %esi
+  8029d0:	53                   	push   %ebx
+  8029d1:	83 ec 1c             	sub    $0x1c,%esp
+  8029d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029d7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  8029da:	e8 81 da ff ff       	call   800460 <sys_time_msec>
+  8029df:	01 f8                	add    %edi,%eax
+  8029e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8029e4:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8029e9:	eb 28                	jmp    802a13 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8029eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f0:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8029f5:	83 ec 04             	sub    $0x4,%esp
+  8029f8:	56                   	push   %esi
+  8029f9:	6a 00                	push   $0x0
+  8029fb:	53                   	push   %ebx
+  8029fc:	e8 e7 da ff ff       	call   8004e8 <sys_futex_wait>
+  802a01:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a06:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  802a0b:	83 c4 10             	add    $0x10,%esp
+  802a0e:	83 f8 ec             	cmp    $0xffffffec,%eax
+  802a11:	74 2e                	je     802a41 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  802a13:	83 ec 0c             	sub    $0xc,%esp
+  802a16:	53                   	push   %ebx
+  802a17:	e8 84 ff ff ff       	call   8029a0 <sem_trywait>
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	85 c0                	test   %eax,%eax
+  802a21:	79 19                	jns    802a3c <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  802a23:	85 ff                	test   %edi,%edi
+  802a25:	74 c4                	je     8029eb <sem_timedwait+0x20>
+  802a27:	e8 34 da ff ff       	call   800460 <sys_time_msec>
+  802a2c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a2f:	29 c6                	sub    %eax,%esi
+  802a31:	85 f6                	test   %esi,%esi
+  802a33:	7f b6                	jg     8029eb <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  802a35:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  802a3a:	eb 05                	jmp    802a41 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  802a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a44:	5b                   	pop    %ebx
+  802a45:	5e                   	pop    %esi
+  802a46:	5f                   	pop    %edi
+  802a47:	5d                   	pop    %ebp
+  802a48:	c3                   	ret
+
+00802a49 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  802a49:	55                   	push   %ebp
+  802a4a:	89 e5                	mov    %esp,%ebp
+  802a4c:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  802a4f:	6a 00                	push   $0x0
+  802a51:	ff 75 08             	push   0x8(%ebp)
+  802a54:	e8 72 ff ff ff       	call   8029cb <sem_timedwait>
+}
+  802a59:	83 c4 10             	add    $0x10,%esp
+  802a5c:	c9                   	leave
+  802a5d:	c3                   	ret
+
+00802a5e <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	83 ec 08             	sub    $0x8,%esp
+  802a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a67:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a6c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  802a70:	8b 50 04             	mov    0x4(%eax),%edx
+  802a73:	85 d2                	test   %edx,%edx
+  802a75:	75 02                	jne    802a79 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  802a79:	83 ec 08             	sub    $0x8,%esp
+  802a7c:	6a 01                	push   $0x1
+  802a7e:	50                   	push   %eax
+  802a7f:	e8 93 da ff ff       	call   800517 <sys_futex_wake>
+  802a84:	83 c4 10             	add    $0x10,%esp
+}
+  802a87:	eb ee                	jmp    802a77 <sem_post+0x19>
+
+00802a89 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	57                   	push   %edi
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  802a92:	68 20 60 80 00       	push   $0x806020
+  802a97:	e8 97 fd ff ff       	call   802833 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  802a9c:	a1 44 60 80 00       	mov    0x806044,%eax
+  802aa1:	83 c4 10             	add    $0x10,%esp
+  802aa4:	85 c0                	test   %eax,%eax
+  802aa6:	75 19                	jne    802ac1 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  802aa8:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  802aad:	8b 00                	mov    (%eax),%eax
+  802aaf:	8b 40 48             	mov    0x48(%eax),%eax
+  802ab2:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  802ab7:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  802abe:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802ac1:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  802ac6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ac9:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802ad0:	8b 40 04             	mov    0x4(%eax),%eax
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	0f 84 e4 00 00 00    	je     802bbf <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  802adb:	83 c3 01             	add    $0x1,%ebx
+  802ade:	83 fb 20             	cmp    $0x20,%ebx
+  802ae1:	75 e3                	jne    802ac6 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  802ae3:	83 ec 0c             	sub    $0xc,%esp
+  802ae6:	68 20 60 80 00       	push   $0x806020
+  802aeb:	e8 b0 fd ff ff       	call   8028a0 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  802af0:	83 c4 10             	add    $0x10,%esp
+  802af3:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  802af8:	e9 b8 00 00 00       	jmp    802bb5 <pthread_create+0x12c>
+  802afd:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b00:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b03:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  802b05:	39 f3                	cmp    %esi,%ebx
+  802b07:	73 16                	jae    802b1f <pthread_create+0x96>
+		va -= PGSIZE;
+  802b09:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+  802b12:	56                   	push   %esi
+  802b13:	6a 00                	push   $0x0
+  802b15:	e8 52 d7 ff ff       	call   80026c <sys_page_unmap>
+  802b1a:	83 c4 10             	add    $0x10,%esp
+  802b1d:	eb e6                	jmp    802b05 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  802b1f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b22:	83 ec 08             	sub    $0x8,%esp
+  802b25:	ff 75 e4             	push   -0x1c(%ebp)
+  802b28:	6a 00                	push   $0x0
+  802b2a:	e8 3d d7 ff ff       	call   80026c <sys_page_unmap>
+	return r;
+  802b2f:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  802b32:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b35:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b3c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  802b43:	eb 70                	jmp    802bb5 <pthread_create+0x12c>
+	th->th_fn = fn;
+  802b45:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802b48:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802b4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b52:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  802b55:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b58:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  802b5b:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  802b62:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  802b67:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b6a:	29 c8                	sub    %ecx,%eax
+  802b6c:	85 db                	test   %ebx,%ebx
+  802b6e:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  802b75:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  802b78:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b7f:	83 ec 04             	sub    $0x4,%esp
+  802b82:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  802b87:	29 ca                	sub    %ecx,%edx
+  802b89:	52                   	push   %edx
+	*--esp = 0;
+  802b8a:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  802b8d:	50                   	push   %eax
+  802b8e:	68 e6 2d 80 00       	push   $0x802de6
+  802b93:	e8 24 da ff ff       	call   8005bc <sys_thread_create>
+  802b98:	89 c7                	mov    %eax,%edi
+  802b9a:	83 c4 10             	add    $0x10,%esp
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 91                	js     802b32 <pthread_create+0xa9>
+	th->th_env = id;
+  802ba1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ba4:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  802bab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bae:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802bb0:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  802bb5:	89 f8                	mov    %edi,%eax
+  802bb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bba:	5b                   	pop    %ebx
+  802bbb:	5e                   	pop    %esi
+  802bbc:	5f                   	pop    %edi
+  802bbd:	5d                   	pop    %ebp
+  802bbe:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  802bbf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802bc2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802bc9:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  802bd0:	83 ec 0c             	sub    $0xc,%esp
+  802bd3:	68 20 60 80 00       	push   $0x806020
+  802bd8:	e8 c3 fc ff ff       	call   8028a0 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  802bdd:	89 d9                	mov    %ebx,%ecx
+  802bdf:	c1 e1 10             	shl    $0x10,%ecx
+  802be2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  802be5:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  802bea:	29 c8                	sub    %ecx,%eax
+  802bec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  802bef:	c1 e8 16             	shr    $0x16,%eax
+  802bf2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802bf9:	83 c4 10             	add    $0x10,%esp
+  802bfc:	a8 01                	test   $0x1,%al
+  802bfe:	74 15                	je     802c15 <pthread_create+0x18c>
+  802c00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c03:	c1 e8 0c             	shr    $0xc,%eax
+  802c06:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c0d:	a8 01                	test   $0x1,%al
+  802c0f:	0f 85 30 ff ff ff    	jne    802b45 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c15:	83 ec 04             	sub    $0x4,%esp
+  802c18:	6a 07                	push   $0x7
+  802c1a:	ff 75 e4             	push   -0x1c(%ebp)
+  802c1d:	6a 00                	push   $0x0
+  802c1f:	e8 af d5 ff ff       	call   8001d3 <sys_page_alloc>
+  802c24:	89 c7                	mov    %eax,%edi
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	85 c0                	test   %eax,%eax
+  802c2b:	0f 88 01 ff ff ff    	js     802b32 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  802c31:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  802c36:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c39:	29 d0                	sub    %edx,%eax
+  802c3b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802c3e:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c40:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  802c45:	29 d0                	sub    %edx,%eax
+  802c47:	89 c7                	mov    %eax,%edi
+  802c49:	39 fe                	cmp    %edi,%esi
+  802c4b:	0f 83 f4 fe ff ff    	jae    802b45 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  802c51:	83 ec 04             	sub    $0x4,%esp
+  802c54:	6a 07                	push   $0x7
+  802c56:	56                   	push   %esi
+  802c57:	6a 00                	push   $0x0
+  802c59:	e8 75 d5 ff ff       	call   8001d3 <sys_page_alloc>
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	85 c0                	test   %eax,%eax
+  802c63:	0f 88 94 fe ff ff    	js     802afd <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  802c69:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c6f:	eb d8                	jmp    802c49 <pthread_create+0x1c0>
+
+00802c71 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  802c71:	55                   	push   %ebp
+  802c72:	89 e5                	mov    %esp,%ebp
+  802c74:	57                   	push   %edi
+  802c75:	56                   	push   %esi
+  802c76:	53                   	push   %ebx
+  802c77:	83 ec 0c             	sub    $0xc,%esp
+  802c7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  802c7d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802c80:	83 f8 1e             	cmp    $0x1e,%eax
+  802c83:	0f 87 c7 00 00 00    	ja     802d50 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802c89:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802c8b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802c91:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802c96:	77 12                	ja     802caa <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802c98:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802c9d:	29 d0                	sub    %edx,%eax
+  802c9f:	c1 e8 10             	shr    $0x10,%eax
+  802ca2:	39 c3                	cmp    %eax,%ebx
+  802ca4:	0f 84 ad 00 00 00    	je     802d57 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802caa:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802cad:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  802cb4:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  802cbb:	eb 10                	jmp    802ccd <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  802cbd:	83 ec 04             	sub    $0x4,%esp
+  802cc0:	6a 00                	push   $0x0
+  802cc2:	6a 01                	push   $0x1
+  802cc4:	57                   	push   %edi
+  802cc5:	e8 1e d8 ff ff       	call   8004e8 <sys_futex_wait>
+  802cca:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  802ccd:	8b 46 04             	mov    0x4(%esi),%eax
+  802cd0:	83 f8 01             	cmp    $0x1,%eax
+  802cd3:	74 e8                	je     802cbd <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  802cd5:	83 f8 02             	cmp    $0x2,%eax
+  802cd8:	0f 85 80 00 00 00    	jne    802d5e <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802cde:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  802ce1:	c1 e6 02             	shl    $0x2,%esi
+  802ce4:	eb 05                	jmp    802ceb <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  802ce6:	e8 bc d4 ff ff       	call   8001a7 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  802ceb:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  802cf1:	89 ca                	mov    %ecx,%edx
+  802cf3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802cf9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802cfc:	c1 e0 04             	shl    $0x4,%eax
+  802cff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d04:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  802d07:	39 c1                	cmp    %eax,%ecx
+  802d09:	75 12                	jne    802d1d <pthread_join+0xac>
+  802d0b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d0e:	c1 e0 04             	shl    $0x4,%eax
+  802d11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d16:	8b 40 54             	mov    0x54(%eax),%eax
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	75 c9                	jne    802ce6 <pthread_join+0x75>
+	if (ret_store)
+  802d1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802d21:	74 0f                	je     802d32 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  802d23:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d26:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  802d2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d30:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  802d32:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d35:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802d3c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4b:	5b                   	pop    %ebx
+  802d4c:	5e                   	pop    %esi
+  802d4d:	5f                   	pop    %edi
+  802d4e:	5d                   	pop    %ebp
+  802d4f:	c3                   	ret
+		return -E_INVAL;
+  802d50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d55:	eb f1                	jmp    802d48 <pthread_join+0xd7>
+  802d57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5c:	eb ea                	jmp    802d48 <pthread_join+0xd7>
+		return -E_INVAL;
+  802d5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d63:	eb e3                	jmp    802d48 <pthread_join+0xd7>
+
+00802d65 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	53                   	push   %ebx
+  802d69:	83 ec 04             	sub    $0x4,%esp
+  802d6c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802d6e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802d74:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802d79:	77 0c                	ja     802d87 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802d7b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802d80:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  802d82:	c1 e8 10             	shr    $0x10,%eax
+  802d85:	75 0a                	jne    802d91 <pthread_exit+0x2c>
+		exit();
+  802d87:	e8 25 d3 ff ff       	call   8000b1 <exit>
+  802d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  802d91:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  802d98:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  802d9b:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  802da2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802da5:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  802da8:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  802daf:	83 ec 08             	sub    $0x8,%esp
+  802db2:	6a 20                	push   $0x20
+  802db4:	01 c2                	add    %eax,%edx
+  802db6:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	e8 54 d7 ff ff       	call   800517 <sys_futex_wake>
+	sys_env_destroy(0);
+  802dc3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802dca:	e8 61 d3 ff ff       	call   800130 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  802dcf:	83 c4 0c             	add    $0xc,%esp
+  802dd2:	68 7e 48 80 00       	push   $0x80487e
+  802dd7:	68 a5 00 00 00       	push   $0xa5
+  802ddc:	68 98 48 80 00       	push   $0x804898
+  802de1:	e8 cd 03 00 00       	call   8031b3 <_panic>
+
+00802de6 <pthread_start>:
+{
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	53                   	push   %ebx
+  802dea:	83 ec 04             	sub    $0x4,%esp
+  802ded:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  802df0:	e8 86 d3 ff ff       	call   80017b <sys_getenvid>
+  802df5:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  802dfa:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  802e00:	85 db                	test   %ebx,%ebx
+  802e02:	74 0c                	je     802e10 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802e04:	89 d9                	mov    %ebx,%ecx
+  802e06:	c1 e1 10             	shl    $0x10,%ecx
+  802e09:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802e0e:	29 ca                	sub    %ecx,%edx
+  802e10:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  802e13:	c1 e0 04             	shl    $0x4,%eax
+  802e16:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e1b:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  802e1d:	83 ec 0c             	sub    $0xc,%esp
+  802e20:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802e27:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  802e2a:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  802e31:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  802e38:	89 04 24             	mov    %eax,(%esp)
+  802e3b:	e8 25 ff ff ff       	call   802d65 <pthread_exit>
+
+00802e40 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  802e40:	55                   	push   %ebp
+  802e41:	89 e5                	mov    %esp,%ebp
+  802e43:	57                   	push   %edi
+  802e44:	56                   	push   %esi
+  802e45:	53                   	push   %ebx
+  802e46:	83 ec 1c             	sub    $0x1c,%esp
+  802e49:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e4b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  802e51:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802e58:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802e5d:	77 0d                	ja     802e6c <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802e5f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802e64:	29 d0                	sub    %edx,%eax
+  802e66:	c1 e8 10             	shr    $0x10,%eax
+  802e69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e71:	eb 2f                	jmp    802ea2 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  802e73:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802e79:	8b 01                	mov    (%ecx),%eax
+  802e7b:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  802e7e:	39 c2                	cmp    %eax,%edx
+  802e80:	75 14                	jne    802e96 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  802e82:	83 ec 0c             	sub    $0xc,%esp
+  802e85:	57                   	push   %edi
+  802e86:	e8 a5 d2 ff ff       	call   800130 <sys_env_destroy>
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	85 c0                	test   %eax,%eax
+  802e90:	0f 88 97 00 00 00    	js     802f2d <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  802e96:	83 c3 01             	add    $0x1,%ebx
+  802e99:	83 fb 20             	cmp    $0x20,%ebx
+  802e9c:	0f 84 d2 00 00 00    	je     802f74 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  802ea2:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  802ea5:	74 ef                	je     802e96 <pthread_kill_others+0x56>
+  802ea7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802eaa:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  802eb1:	8b 40 04             	mov    0x4(%eax),%eax
+  802eb4:	83 f8 01             	cmp    $0x1,%eax
+  802eb7:	75 dd                	jne    802e96 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  802eb9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ebc:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  802ec3:	89 fe                	mov    %edi,%esi
+  802ec5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802ecb:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ece:	c1 e0 04             	shl    $0x4,%eax
+  802ed1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ed6:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802ed9:	39 c7                	cmp    %eax,%edi
+  802edb:	75 b9                	jne    802e96 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  802edd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ee0:	c1 e0 04             	shl    $0x4,%eax
+  802ee3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ee8:	8b 40 54             	mov    0x54(%eax),%eax
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	74 a7                	je     802e96 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  802eef:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  802ef2:	c1 e0 04             	shl    $0x4,%eax
+  802ef5:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  802efb:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802efd:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  802f03:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f08:	0f 87 65 ff ff ff    	ja     802e73 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f0e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f13:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  802f15:	c1 e8 10             	shr    $0x10,%eax
+  802f18:	0f 84 55 ff ff ff    	je     802e73 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f1e:	c1 e0 10             	shl    $0x10,%eax
+  802f21:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f26:	29 c1                	sub    %eax,%ecx
+  802f28:	e9 4c ff ff ff       	jmp    802e79 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  802f2d:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f30:	c1 e2 04             	shl    $0x4,%edx
+  802f33:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f39:	8b 52 48             	mov    0x48(%edx),%edx
+  802f3c:	39 fa                	cmp    %edi,%edx
+  802f3e:	0f 85 52 ff ff ff    	jne    802e96 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  802f44:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  802f47:	c1 e2 04             	shl    $0x4,%edx
+  802f4a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f50:	8b 52 54             	mov    0x54(%edx),%edx
+  802f53:	85 d2                	test   %edx,%edx
+  802f55:	0f 84 3b ff ff ff    	je     802e96 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  802f5b:	83 ec 0c             	sub    $0xc,%esp
+  802f5e:	50                   	push   %eax
+  802f5f:	57                   	push   %edi
+  802f60:	68 a8 48 80 00       	push   $0x8048a8
+  802f65:	68 bb 00 00 00       	push   $0xbb
+  802f6a:	68 98 48 80 00       	push   $0x804898
+  802f6f:	e8 3f 02 00 00       	call   8031b3 <_panic>
+	}
+}
+  802f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f77:	5b                   	pop    %ebx
+  802f78:	5e                   	pop    %esi
+  802f79:	5f                   	pop    %edi
+  802f7a:	5d                   	pop    %ebp
+  802f7b:	c3                   	ret
+
+00802f7c <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  802f7c:	55                   	push   %ebp
+  802f7d:	89 e5                	mov    %esp,%ebp
+  802f7f:	53                   	push   %ebx
+  802f80:	83 ec 04             	sub    $0x4,%esp
+  802f83:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f85:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  802f8b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f91:	0f 87 85 00 00 00    	ja     80301c <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f97:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  802f9c:	29 c3                	sub    %eax,%ebx
+  802f9e:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  802fa1:	83 ec 04             	sub    $0x4,%esp
+  802fa4:	68 80 02 00 00       	push   $0x280
+  802fa9:	6a 00                	push   $0x0
+  802fab:	68 40 60 80 00       	push   $0x806040
+  802fb0:	e8 0e 0a 00 00       	call   8039c3 <memset>
+	threads_mu.m_state = 0;
+  802fb5:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  802fbc:	00 00 00 
+	if (self != 0) {
+  802fbf:	83 c4 10             	add    $0x10,%esp
+  802fc2:	85 db                	test   %ebx,%ebx
+  802fc4:	74 51                	je     803017 <pthread_fork_child+0x9b>
+  802fc6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fc8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fd3:	77 18                	ja     802fed <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fd5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fda:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fdc:	c1 e8 10             	shr    $0x10,%eax
+  802fdf:	74 0c                	je     802fed <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fe1:	c1 e0 10             	shl    $0x10,%eax
+  802fe4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fe9:	29 c2                	sub    %eax,%edx
+  802feb:	eb 06                	jmp    802ff3 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  802fed:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  802ff3:	8b 02                	mov    (%edx),%eax
+  802ff5:	8b 48 48             	mov    0x48(%eax),%ecx
+  802ff8:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  802fff:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803002:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803009:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803010:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803017:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301a:	c9                   	leave
+  80301b:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80301c:	83 ec 04             	sub    $0x4,%esp
+  80301f:	68 80 02 00 00       	push   $0x280
+  803024:	6a 00                	push   $0x0
+  803026:	68 40 60 80 00       	push   $0x806040
+  80302b:	e8 93 09 00 00       	call   8039c3 <memset>
+	threads_mu.m_state = 0;
+  803030:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803037:	00 00 00 
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	eb d8                	jmp    803017 <pthread_fork_child+0x9b>
+
+0080303f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	c3                   	ret
+
+00803045 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803045:	55                   	push   %ebp
+  803046:	89 e5                	mov    %esp,%ebp
+  803048:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80304b:	68 cd 48 80 00       	push   $0x8048cd
+  803050:	ff 75 0c             	push   0xc(%ebp)
+  803053:	e8 1a 08 00 00       	call   803872 <strcpy>
+	return 0;
+}
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305d:	c9                   	leave
+  80305e:	c3                   	ret
+
+0080305f <devcons_write>:
+{
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	57                   	push   %edi
+  803063:	56                   	push   %esi
+  803064:	53                   	push   %ebx
+  803065:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80306b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803070:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803076:	eb 2e                	jmp    8030a6 <devcons_write+0x47>
+		m = n - tot;
+  803078:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80307b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80307d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803082:	39 c3                	cmp    %eax,%ebx
+  803084:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803087:	83 ec 04             	sub    $0x4,%esp
+  80308a:	53                   	push   %ebx
+  80308b:	89 f0                	mov    %esi,%eax
+  80308d:	03 45 0c             	add    0xc(%ebp),%eax
+  803090:	50                   	push   %eax
+  803091:	57                   	push   %edi
+  803092:	e8 61 09 00 00       	call   8039f8 <memmove>
+		sys_cputs(buf, m);
+  803097:	83 c4 08             	add    $0x8,%esp
+  80309a:	53                   	push   %ebx
+  80309b:	57                   	push   %edi
+  80309c:	e8 38 d0 ff ff       	call   8000d9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030a1:	01 de                	add    %ebx,%esi
+  8030a3:	83 c4 10             	add    $0x10,%esp
+  8030a6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030a9:	72 cd                	jb     803078 <devcons_write+0x19>
+}
+  8030ab:	89 f0                	mov    %esi,%eax
+  8030ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b0:	5b                   	pop    %ebx
+  8030b1:	5e                   	pop    %esi
+  8030b2:	5f                   	pop    %edi
+  8030b3:	5d                   	pop    %ebp
+  8030b4:	c3                   	ret
+
+008030b5 <devcons_read>:
+{
+  8030b5:	55                   	push   %ebp
+  8030b6:	89 e5                	mov    %esp,%ebp
+  8030b8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030c4:	75 07                	jne    8030cd <devcons_read+0x18>
+  8030c6:	eb 1f                	jmp    8030e7 <devcons_read+0x32>
+		sys_yield();
+  8030c8:	e8 da d0 ff ff       	call   8001a7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030cd:	e8 32 d0 ff ff       	call   800104 <sys_cgetc>
+  8030d2:	85 c0                	test   %eax,%eax
+  8030d4:	74 f2                	je     8030c8 <devcons_read+0x13>
+	if (c < 0)
+  8030d6:	78 0f                	js     8030e7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030d8:	83 f8 04             	cmp    $0x4,%eax
+  8030db:	74 0c                	je     8030e9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030e0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030e2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030e7:	c9                   	leave
+  8030e8:	c3                   	ret
+		return 0;
+  8030e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ee:	eb f7                	jmp    8030e7 <devcons_read+0x32>
+
+008030f0 <cputchar>:
+{
+  8030f0:	55                   	push   %ebp
+  8030f1:	89 e5                	mov    %esp,%ebp
+  8030f3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8030fc:	6a 01                	push   $0x1
+  8030fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803101:	50                   	push   %eax
+  803102:	e8 d2 cf ff ff       	call   8000d9 <sys_cputs>
+}
+  803107:	83 c4 10             	add    $0x10,%esp
+  80310a:	c9                   	leave
+  80310b:	c3                   	ret
+
+0080310c <getchar>:
+{
+  80310c:	55                   	push   %ebp
+  80310d:	89 e5                	mov    %esp,%ebp
+  80310f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803112:	6a 01                	push   $0x1
+  803114:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803117:	50                   	push   %eax
+  803118:	6a 00                	push   $0x0
+  80311a:	e8 63 d8 ff ff       	call   800982 <read>
+	if (r < 0)
+  80311f:	83 c4 10             	add    $0x10,%esp
+  803122:	85 c0                	test   %eax,%eax
+  803124:	78 06                	js     80312c <getchar+0x20>
+	if (r < 1)
+  803126:	74 06                	je     80312e <getchar+0x22>
+	return c;
+  803128:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+		return -E_EOF;
+  80312e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803133:	eb f7                	jmp    80312c <getchar+0x20>
+
+00803135 <iscons>:
+{
+  803135:	55                   	push   %ebp
+  803136:	89 e5                	mov    %esp,%ebp
+  803138:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80313b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80313e:	50                   	push   %eax
+  80313f:	ff 75 08             	push   0x8(%ebp)
+  803142:	e8 ab d5 ff ff       	call   8006f2 <fd_lookup>
+  803147:	83 c4 10             	add    $0x10,%esp
+  80314a:	85 c0                	test   %eax,%eax
+  80314c:	78 11                	js     80315f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80314e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803151:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803157:	39 10                	cmp    %edx,(%eax)
+  803159:	0f 94 c0             	sete   %al
+  80315c:	0f b6 c0             	movzbl %al,%eax
+}
+  80315f:	c9                   	leave
+  803160:	c3                   	ret
+
+00803161 <opencons>:
+{
+  803161:	55                   	push   %ebp
+  803162:	89 e5                	mov    %esp,%ebp
+  803164:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803167:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80316a:	50                   	push   %eax
+  80316b:	e8 2c d5 ff ff       	call   80069c <fd_alloc>
+  803170:	83 c4 10             	add    $0x10,%esp
+  803173:	85 c0                	test   %eax,%eax
+  803175:	78 3a                	js     8031b1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803177:	83 ec 04             	sub    $0x4,%esp
+  80317a:	68 07 04 00 00       	push   $0x407
+  80317f:	ff 75 f4             	push   -0xc(%ebp)
+  803182:	6a 00                	push   $0x0
+  803184:	e8 4a d0 ff ff       	call   8001d3 <sys_page_alloc>
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	78 21                	js     8031b1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803190:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803193:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803199:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80319b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031a5:	83 ec 0c             	sub    $0xc,%esp
+  8031a8:	50                   	push   %eax
+  8031a9:	e8 c7 d4 ff ff       	call   800675 <fd2num>
+  8031ae:	83 c4 10             	add    $0x10,%esp
+}
+  8031b1:	c9                   	leave
+  8031b2:	c3                   	ret
+
+008031b3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8031b3:	55                   	push   %ebp
+  8031b4:	89 e5                	mov    %esp,%ebp
+  8031b6:	56                   	push   %esi
+  8031b7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8031b8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8031bb:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8031c1:	e8 b5 cf ff ff       	call   80017b <sys_getenvid>
+  8031c6:	83 ec 0c             	sub    $0xc,%esp
+  8031c9:	ff 75 0c             	push   0xc(%ebp)
+  8031cc:	ff 75 08             	push   0x8(%ebp)
+  8031cf:	56                   	push   %esi
+  8031d0:	50                   	push   %eax
+  8031d1:	68 dc 48 80 00       	push   $0x8048dc
+  8031d6:	e8 b3 00 00 00       	call   80328e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8031db:	83 c4 18             	add    $0x18,%esp
+  8031de:	53                   	push   %ebx
+  8031df:	ff 75 10             	push   0x10(%ebp)
+  8031e2:	e8 56 00 00 00       	call   80323d <vcprintf>
+	cprintf("\n");
+  8031e7:	c7 04 24 b2 4d 80 00 	movl   $0x804db2,(%esp)
+  8031ee:	e8 9b 00 00 00       	call   80328e <cprintf>
+  8031f3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8031f6:	cc                   	int3
+	while (1)
+  8031f7:	eb fd                	jmp    8031f6 <_panic+0x43>
+
+008031f9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	53                   	push   %ebx
+  8031fd:	83 ec 04             	sub    $0x4,%esp
+  803200:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803203:	8b 13                	mov    (%ebx),%edx
+  803205:	8d 42 01             	lea    0x1(%edx),%eax
+  803208:	89 03                	mov    %eax,(%ebx)
+  80320a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80320d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803211:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803216:	74 09                	je     803221 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803218:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80321c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321f:	c9                   	leave
+  803220:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803221:	83 ec 08             	sub    $0x8,%esp
+  803224:	68 ff 00 00 00       	push   $0xff
+  803229:	8d 43 08             	lea    0x8(%ebx),%eax
+  80322c:	50                   	push   %eax
+  80322d:	e8 a7 ce ff ff       	call   8000d9 <sys_cputs>
+		b->idx = 0;
+  803232:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803238:	83 c4 10             	add    $0x10,%esp
+  80323b:	eb db                	jmp    803218 <putch+0x1f>
+
+0080323d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803246:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80324d:	00 00 00 
+	b.cnt = 0;
+  803250:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803257:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80325a:	ff 75 0c             	push   0xc(%ebp)
+  80325d:	ff 75 08             	push   0x8(%ebp)
+  803260:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803266:	50                   	push   %eax
+  803267:	68 f9 31 80 00       	push   $0x8031f9
+  80326c:	e8 14 01 00 00       	call   803385 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803271:	83 c4 08             	add    $0x8,%esp
+  803274:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80327a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803280:	50                   	push   %eax
+  803281:	e8 53 ce ff ff       	call   8000d9 <sys_cputs>
+
+	return b.cnt;
+}
+  803286:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80328c:	c9                   	leave
+  80328d:	c3                   	ret
+
+0080328e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80328e:	55                   	push   %ebp
+  80328f:	89 e5                	mov    %esp,%ebp
+  803291:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803294:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  803297:	50                   	push   %eax
+  803298:	ff 75 08             	push   0x8(%ebp)
+  80329b:	e8 9d ff ff ff       	call   80323d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8032a0:	c9                   	leave
+  8032a1:	c3                   	ret
+
+008032a2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8032a2:	55                   	push   %ebp
+  8032a3:	89 e5                	mov    %esp,%ebp
+  8032a5:	57                   	push   %edi
+  8032a6:	56                   	push   %esi
+  8032a7:	53                   	push   %ebx
+  8032a8:	83 ec 1c             	sub    $0x1c,%esp
+  8032ab:	89 c7                	mov    %eax,%edi
+  8032ad:	89 d6                	mov    %edx,%esi
+  8032af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b5:	89 d1                	mov    %edx,%ecx
+  8032b7:	89 c2                	mov    %eax,%edx
+  8032b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8032bc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8032bf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032c2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8032c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032c8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032cf:	39 c2                	cmp    %eax,%edx
+  8032d1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8032d4:	72 3e                	jb     803314 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032d6:	83 ec 0c             	sub    $0xc,%esp
+  8032d9:	ff 75 18             	push   0x18(%ebp)
+  8032dc:	83 eb 01             	sub    $0x1,%ebx
+  8032df:	53                   	push   %ebx
+  8032e0:	50                   	push   %eax
+  8032e1:	83 ec 08             	sub    $0x8,%esp
+  8032e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8032e7:	ff 75 e0             	push   -0x20(%ebp)
+  8032ea:	ff 75 dc             	push   -0x24(%ebp)
+  8032ed:	ff 75 d8             	push   -0x28(%ebp)
+  8032f0:	e8 47 12 00 00       	call   80453c <__udivdi3>
+  8032f5:	83 c4 18             	add    $0x18,%esp
+  8032f8:	52                   	push   %edx
+  8032f9:	50                   	push   %eax
+  8032fa:	89 f2                	mov    %esi,%edx
+  8032fc:	89 f8                	mov    %edi,%eax
+  8032fe:	e8 9f ff ff ff       	call   8032a2 <printnum>
+  803303:	83 c4 20             	add    $0x20,%esp
+  803306:	eb 13                	jmp    80331b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803308:	83 ec 08             	sub    $0x8,%esp
+  80330b:	56                   	push   %esi
+  80330c:	ff 75 18             	push   0x18(%ebp)
+  80330f:	ff d7                	call   *%edi
+  803311:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803314:	83 eb 01             	sub    $0x1,%ebx
+  803317:	85 db                	test   %ebx,%ebx
+  803319:	7f ed                	jg     803308 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80331b:	83 ec 08             	sub    $0x8,%esp
+  80331e:	56                   	push   %esi
+  80331f:	83 ec 04             	sub    $0x4,%esp
+  803322:	ff 75 e4             	push   -0x1c(%ebp)
+  803325:	ff 75 e0             	push   -0x20(%ebp)
+  803328:	ff 75 dc             	push   -0x24(%ebp)
+  80332b:	ff 75 d8             	push   -0x28(%ebp)
+  80332e:	e8 2a 12 00 00       	call   80455d <__umoddi3>
+  803333:	83 c4 14             	add    $0x14,%esp
+  803336:	0f be 80 ff 48 80 00 	movsbl 0x8048ff(%eax),%eax
+  80333d:	50                   	push   %eax
+  80333e:	ff d7                	call   *%edi
+}
+  803340:	83 c4 10             	add    $0x10,%esp
+  803343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803346:	5b                   	pop    %ebx
+  803347:	5e                   	pop    %esi
+  803348:	5f                   	pop    %edi
+  803349:	5d                   	pop    %ebp
+  80334a:	c3                   	ret
+
+0080334b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803351:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803355:	8b 10                	mov    (%eax),%edx
+  803357:	3b 50 04             	cmp    0x4(%eax),%edx
+  80335a:	73 0a                	jae    803366 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80335c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80335f:	89 08                	mov    %ecx,(%eax)
+  803361:	8b 45 08             	mov    0x8(%ebp),%eax
+  803364:	88 02                	mov    %al,(%edx)
+}
+  803366:	5d                   	pop    %ebp
+  803367:	c3                   	ret
+
+00803368 <printfmt>:
+{
+  803368:	55                   	push   %ebp
+  803369:	89 e5                	mov    %esp,%ebp
+  80336b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80336e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803371:	50                   	push   %eax
+  803372:	ff 75 10             	push   0x10(%ebp)
+  803375:	ff 75 0c             	push   0xc(%ebp)
+  803378:	ff 75 08             	push   0x8(%ebp)
+  80337b:	e8 05 00 00 00       	call   803385 <vprintfmt>
+}
+  803380:	83 c4 10             	add    $0x10,%esp
+  803383:	c9                   	leave
+  803384:	c3                   	ret
+
+00803385 <vprintfmt>:
+{
+  803385:	55                   	push   %ebp
+  803386:	89 e5                	mov    %esp,%ebp
+  803388:	57                   	push   %edi
+  803389:	56                   	push   %esi
+  80338a:	53                   	push   %ebx
+  80338b:	83 ec 2c             	sub    $0x2c,%esp
+  80338e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803391:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803394:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803397:	eb 0a                	jmp    8033a3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  803399:	83 ec 08             	sub    $0x8,%esp
+  80339c:	53                   	push   %ebx
+  80339d:	50                   	push   %eax
+  80339e:	ff d6                	call   *%esi
+  8033a0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8033a3:	83 c7 01             	add    $0x1,%edi
+  8033a6:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8033aa:	83 f8 25             	cmp    $0x25,%eax
+  8033ad:	74 0c                	je     8033bb <vprintfmt+0x36>
+			if (ch == '\0')
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	75 e6                	jne    803399 <vprintfmt+0x14>
+}
+  8033b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b6:	5b                   	pop    %ebx
+  8033b7:	5e                   	pop    %esi
+  8033b8:	5f                   	pop    %edi
+  8033b9:	5d                   	pop    %ebp
+  8033ba:	c3                   	ret
+		padc = ' ';
+  8033bb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8033bf:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8033c6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8033cd:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8033d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8033d9:	8d 47 01             	lea    0x1(%edi),%eax
+  8033dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033df:	0f b6 17             	movzbl (%edi),%edx
+  8033e2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8033e5:	3c 55                	cmp    $0x55,%al
+  8033e7:	0f 87 c5 03 00 00    	ja     8037b2 <vprintfmt+0x42d>
+  8033ed:	0f b6 c0             	movzbl %al,%eax
+  8033f0:	ff 24 85 80 4a 80 00 	jmp    *0x804a80(,%eax,4)
+  8033f7:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8033fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8033fd:	eb da                	jmp    8033d9 <vprintfmt+0x54>
+  8033ff:	0f be d2             	movsbl %dl,%edx
+  803402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80340d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803410:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803414:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803417:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80341a:	83 f9 09             	cmp    $0x9,%ecx
+  80341d:	77 55                	ja     803474 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80341f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803422:	eb e9                	jmp    80340d <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  803424:	8b 45 14             	mov    0x14(%ebp),%eax
+  803427:	8b 00                	mov    (%eax),%eax
+  803429:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80342c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80342f:	8d 40 04             	lea    0x4(%eax),%eax
+  803432:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  803435:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803438:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80343c:	79 9b                	jns    8033d9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80343e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803444:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80344b:	eb 8c                	jmp    8033d9 <vprintfmt+0x54>
+			if (width < 0)
+  80344d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803450:	85 d2                	test   %edx,%edx
+  803452:	b8 00 00 00 00       	mov    $0x0,%eax
+  803457:	0f 49 c2             	cmovns %edx,%eax
+  80345a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80345d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803460:	e9 74 ff ff ff       	jmp    8033d9 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  803465:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803468:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80346f:	e9 65 ff ff ff       	jmp    8033d9 <vprintfmt+0x54>
+  803474:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803477:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80347a:	eb bc                	jmp    803438 <vprintfmt+0xb3>
+			lflag++;
+  80347c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80347f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803482:	e9 52 ff ff ff       	jmp    8033d9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  803487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80348a:	8d 78 04             	lea    0x4(%eax),%edi
+  80348d:	83 ec 08             	sub    $0x8,%esp
+  803490:	53                   	push   %ebx
+  803491:	ff 30                	push   (%eax)
+  803493:	ff d6                	call   *%esi
+			break;
+  803495:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  803498:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80349b:	e9 b1 02 00 00       	jmp    803751 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8034a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034a3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8034a6:	8b 10                	mov    (%eax),%edx
+  8034a8:	89 d0                	mov    %edx,%eax
+  8034aa:	f7 d8                	neg    %eax
+  8034ac:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8034af:	83 f8 14             	cmp    $0x14,%eax
+  8034b2:	7f 23                	jg     8034d7 <vprintfmt+0x152>
+  8034b4:	8b 14 85 e0 4b 80 00 	mov    0x804be0(,%eax,4),%edx
+  8034bb:	85 d2                	test   %edx,%edx
+  8034bd:	74 18                	je     8034d7 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8034bf:	52                   	push   %edx
+  8034c0:	68 a7 47 80 00       	push   $0x8047a7
+  8034c5:	53                   	push   %ebx
+  8034c6:	56                   	push   %esi
+  8034c7:	e8 9c fe ff ff       	call   803368 <printfmt>
+  8034cc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034cf:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8034d2:	e9 7a 02 00 00       	jmp    803751 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8034d7:	50                   	push   %eax
+  8034d8:	68 17 49 80 00       	push   $0x804917
+  8034dd:	53                   	push   %ebx
+  8034de:	56                   	push   %esi
+  8034df:	e8 84 fe ff ff       	call   803368 <printfmt>
+  8034e4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8034e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8034ea:	e9 62 02 00 00       	jmp    803751 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8034ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034f2:	83 c0 04             	add    $0x4,%eax
+  8034f5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8034f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034fb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8034fd:	85 c9                	test   %ecx,%ecx
+  8034ff:	b8 10 49 80 00       	mov    $0x804910,%eax
+  803504:	0f 45 c1             	cmovne %ecx,%eax
+  803507:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80350a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80350e:	7e 06                	jle    803516 <vprintfmt+0x191>
+  803510:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803514:	75 0b                	jne    803521 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803516:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803519:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80351c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80351f:	eb 5c                	jmp    80357d <vprintfmt+0x1f8>
+  803521:	83 ec 08             	sub    $0x8,%esp
+  803524:	ff 75 d0             	push   -0x30(%ebp)
+  803527:	ff 75 cc             	push   -0x34(%ebp)
+  80352a:	e8 20 03 00 00       	call   80384f <strnlen>
+  80352f:	89 c2                	mov    %eax,%edx
+  803531:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803534:	29 d0                	sub    %edx,%eax
+  803536:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803539:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80353d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803540:	89 75 08             	mov    %esi,0x8(%ebp)
+  803543:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803545:	eb 0e                	jmp    803555 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  803547:	83 ec 08             	sub    $0x8,%esp
+  80354a:	53                   	push   %ebx
+  80354b:	57                   	push   %edi
+  80354c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80354f:	83 ee 01             	sub    $0x1,%esi
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 f6                	test   %esi,%esi
+  803557:	7f ee                	jg     803547 <vprintfmt+0x1c2>
+  803559:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80355c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	ba 00 00 00 00       	mov    $0x0,%edx
+  803566:	0f 49 d0             	cmovns %eax,%edx
+  803569:	29 d0                	sub    %edx,%eax
+  80356b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80356e:	eb a6                	jmp    803516 <vprintfmt+0x191>
+					putch(ch, putdat);
+  803570:	83 ec 08             	sub    $0x8,%esp
+  803573:	53                   	push   %ebx
+  803574:	52                   	push   %edx
+  803575:	ff 55 08             	call   *0x8(%ebp)
+  803578:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80357b:	89 f1                	mov    %esi,%ecx
+  80357d:	8d 71 01             	lea    0x1(%ecx),%esi
+  803580:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803584:	0f be d0             	movsbl %al,%edx
+  803587:	85 d2                	test   %edx,%edx
+  803589:	74 28                	je     8035b3 <vprintfmt+0x22e>
+  80358b:	85 ff                	test   %edi,%edi
+  80358d:	78 05                	js     803594 <vprintfmt+0x20f>
+  80358f:	83 ef 01             	sub    $0x1,%edi
+  803592:	78 30                	js     8035c4 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  803594:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  803598:	74 d6                	je     803570 <vprintfmt+0x1eb>
+  80359a:	0f be c0             	movsbl %al,%eax
+  80359d:	83 e8 20             	sub    $0x20,%eax
+  8035a0:	83 f8 5e             	cmp    $0x5e,%eax
+  8035a3:	76 cb                	jbe    803570 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8035a5:	83 ec 08             	sub    $0x8,%esp
+  8035a8:	53                   	push   %ebx
+  8035a9:	6a 3f                	push   $0x3f
+  8035ab:	ff 55 08             	call   *0x8(%ebp)
+  8035ae:	83 c4 10             	add    $0x10,%esp
+  8035b1:	eb c8                	jmp    80357b <vprintfmt+0x1f6>
+  8035b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8035b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035bc:	01 d0                	add    %edx,%eax
+  8035be:	29 c8                	sub    %ecx,%eax
+  8035c0:	89 c7                	mov    %eax,%edi
+  8035c2:	eb 13                	jmp    8035d7 <vprintfmt+0x252>
+  8035c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035c7:	eb ed                	jmp    8035b6 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8035c9:	83 ec 08             	sub    $0x8,%esp
+  8035cc:	53                   	push   %ebx
+  8035cd:	6a 20                	push   $0x20
+  8035cf:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8035d1:	83 ef 01             	sub    $0x1,%edi
+  8035d4:	83 c4 10             	add    $0x10,%esp
+  8035d7:	85 ff                	test   %edi,%edi
+  8035d9:	7f ee                	jg     8035c9 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8035db:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8035de:	89 45 14             	mov    %eax,0x14(%ebp)
+  8035e1:	e9 6b 01 00 00       	jmp    803751 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8035e6:	83 f9 01             	cmp    $0x1,%ecx
+  8035e9:	7f 1f                	jg     80360a <vprintfmt+0x285>
+	else if (lflag)
+  8035eb:	85 c9                	test   %ecx,%ecx
+  8035ed:	74 67                	je     803656 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8035ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035f2:	8b 00                	mov    (%eax),%eax
+  8035f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8035f7:	89 c1                	mov    %eax,%ecx
+  8035f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8035fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8035ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  803602:	8d 40 04             	lea    0x4(%eax),%eax
+  803605:	89 45 14             	mov    %eax,0x14(%ebp)
+  803608:	eb 17                	jmp    803621 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80360a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80360d:	8b 50 04             	mov    0x4(%eax),%edx
+  803610:	8b 00                	mov    (%eax),%eax
+  803612:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803615:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80361b:	8d 40 08             	lea    0x8(%eax),%eax
+  80361e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803621:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803624:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  803627:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80362c:	85 c9                	test   %ecx,%ecx
+  80362e:	0f 89 03 01 00 00    	jns    803737 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  803634:	83 ec 08             	sub    $0x8,%esp
+  803637:	53                   	push   %ebx
+  803638:	6a 2d                	push   $0x2d
+  80363a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80363c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80363f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803642:	f7 da                	neg    %edx
+  803644:	83 d1 00             	adc    $0x0,%ecx
+  803647:	f7 d9                	neg    %ecx
+  803649:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80364c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803651:	e9 e1 00 00 00       	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  803656:	8b 45 14             	mov    0x14(%ebp),%eax
+  803659:	8b 00                	mov    (%eax),%eax
+  80365b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80365e:	89 c1                	mov    %eax,%ecx
+  803660:	c1 f9 1f             	sar    $0x1f,%ecx
+  803663:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803666:	8b 45 14             	mov    0x14(%ebp),%eax
+  803669:	8d 40 04             	lea    0x4(%eax),%eax
+  80366c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80366f:	eb b0                	jmp    803621 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  803671:	83 f9 01             	cmp    $0x1,%ecx
+  803674:	7f 1e                	jg     803694 <vprintfmt+0x30f>
+	else if (lflag)
+  803676:	85 c9                	test   %ecx,%ecx
+  803678:	74 32                	je     8036ac <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80367a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80367d:	8b 10                	mov    (%eax),%edx
+  80367f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803684:	8d 40 04             	lea    0x4(%eax),%eax
+  803687:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80368a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80368f:	e9 a3 00 00 00       	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803694:	8b 45 14             	mov    0x14(%ebp),%eax
+  803697:	8b 10                	mov    (%eax),%edx
+  803699:	8b 48 04             	mov    0x4(%eax),%ecx
+  80369c:	8d 40 08             	lea    0x8(%eax),%eax
+  80369f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8036a7:	e9 8b 00 00 00       	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036af:	8b 10                	mov    (%eax),%edx
+  8036b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8036b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8036bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8036c1:	eb 74                	jmp    803737 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8036c3:	83 f9 01             	cmp    $0x1,%ecx
+  8036c6:	7f 1b                	jg     8036e3 <vprintfmt+0x35e>
+	else if (lflag)
+  8036c8:	85 c9                	test   %ecx,%ecx
+  8036ca:	74 2c                	je     8036f8 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8036cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036cf:	8b 10                	mov    (%eax),%edx
+  8036d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8036d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036dc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8036e1:	eb 54                	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8036e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036e6:	8b 10                	mov    (%eax),%edx
+  8036e8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8036eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8036ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8036f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8036f6:	eb 3f                	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8036f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036fb:	8b 10                	mov    (%eax),%edx
+  8036fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803702:	8d 40 04             	lea    0x4(%eax),%eax
+  803705:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  803708:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80370d:	eb 28                	jmp    803737 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80370f:	83 ec 08             	sub    $0x8,%esp
+  803712:	53                   	push   %ebx
+  803713:	6a 30                	push   $0x30
+  803715:	ff d6                	call   *%esi
+			putch('x', putdat);
+  803717:	83 c4 08             	add    $0x8,%esp
+  80371a:	53                   	push   %ebx
+  80371b:	6a 78                	push   $0x78
+  80371d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80371f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803722:	8b 10                	mov    (%eax),%edx
+  803724:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803729:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80372c:	8d 40 04             	lea    0x4(%eax),%eax
+  80372f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803732:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803737:	83 ec 0c             	sub    $0xc,%esp
+  80373a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80373e:	50                   	push   %eax
+  80373f:	ff 75 e0             	push   -0x20(%ebp)
+  803742:	57                   	push   %edi
+  803743:	51                   	push   %ecx
+  803744:	52                   	push   %edx
+  803745:	89 da                	mov    %ebx,%edx
+  803747:	89 f0                	mov    %esi,%eax
+  803749:	e8 54 fb ff ff       	call   8032a2 <printnum>
+			break;
+  80374e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  803751:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  803754:	e9 4a fc ff ff       	jmp    8033a3 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  803759:	83 f9 01             	cmp    $0x1,%ecx
+  80375c:	7f 1b                	jg     803779 <vprintfmt+0x3f4>
+	else if (lflag)
+  80375e:	85 c9                	test   %ecx,%ecx
+  803760:	74 2c                	je     80378e <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  803762:	8b 45 14             	mov    0x14(%ebp),%eax
+  803765:	8b 10                	mov    (%eax),%edx
+  803767:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80376c:	8d 40 04             	lea    0x4(%eax),%eax
+  80376f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803772:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  803777:	eb be                	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  803779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80377c:	8b 10                	mov    (%eax),%edx
+  80377e:	8b 48 04             	mov    0x4(%eax),%ecx
+  803781:	8d 40 08             	lea    0x8(%eax),%eax
+  803784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803787:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80378c:	eb a9                	jmp    803737 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80378e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803791:	8b 10                	mov    (%eax),%edx
+  803793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803798:	8d 40 04             	lea    0x4(%eax),%eax
+  80379b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80379e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8037a3:	eb 92                	jmp    803737 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8037a5:	83 ec 08             	sub    $0x8,%esp
+  8037a8:	53                   	push   %ebx
+  8037a9:	6a 25                	push   $0x25
+  8037ab:	ff d6                	call   *%esi
+			break;
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	eb 9f                	jmp    803751 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8037b2:	83 ec 08             	sub    $0x8,%esp
+  8037b5:	53                   	push   %ebx
+  8037b6:	6a 25                	push   $0x25
+  8037b8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8037ba:	83 c4 10             	add    $0x10,%esp
+  8037bd:	89 f8                	mov    %edi,%eax
+  8037bf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8037c3:	74 05                	je     8037ca <vprintfmt+0x445>
+  8037c5:	83 e8 01             	sub    $0x1,%eax
+  8037c8:	eb f5                	jmp    8037bf <vprintfmt+0x43a>
+  8037ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037cd:	eb 82                	jmp    803751 <vprintfmt+0x3cc>
+
+008037cf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8037cf:	55                   	push   %ebp
+  8037d0:	89 e5                	mov    %esp,%ebp
+  8037d2:	83 ec 18             	sub    $0x18,%esp
+  8037d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8037db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8037de:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8037e2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8037e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8037ec:	85 c0                	test   %eax,%eax
+  8037ee:	74 26                	je     803816 <vsnprintf+0x47>
+  8037f0:	85 d2                	test   %edx,%edx
+  8037f2:	7e 22                	jle    803816 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8037f4:	ff 75 14             	push   0x14(%ebp)
+  8037f7:	ff 75 10             	push   0x10(%ebp)
+  8037fa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8037fd:	50                   	push   %eax
+  8037fe:	68 4b 33 80 00       	push   $0x80334b
+  803803:	e8 7d fb ff ff       	call   803385 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  803808:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80380b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80380e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803811:	83 c4 10             	add    $0x10,%esp
+}
+  803814:	c9                   	leave
+  803815:	c3                   	ret
+		return -E_INVAL;
+  803816:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80381b:	eb f7                	jmp    803814 <vsnprintf+0x45>
+
+0080381d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80381d:	55                   	push   %ebp
+  80381e:	89 e5                	mov    %esp,%ebp
+  803820:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803823:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803826:	50                   	push   %eax
+  803827:	ff 75 10             	push   0x10(%ebp)
+  80382a:	ff 75 0c             	push   0xc(%ebp)
+  80382d:	ff 75 08             	push   0x8(%ebp)
+  803830:	e8 9a ff ff ff       	call   8037cf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803835:	c9                   	leave
+  803836:	c3                   	ret
+
+00803837 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  803837:	55                   	push   %ebp
+  803838:	89 e5                	mov    %esp,%ebp
+  80383a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80383d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803842:	eb 03                	jmp    803847 <strlen+0x10>
+		n++;
+  803844:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  803847:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80384b:	75 f7                	jne    803844 <strlen+0xd>
+	return n;
+}
+  80384d:	5d                   	pop    %ebp
+  80384e:	c3                   	ret
+
+0080384f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80384f:	55                   	push   %ebp
+  803850:	89 e5                	mov    %esp,%ebp
+  803852:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803855:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385d:	eb 03                	jmp    803862 <strnlen+0x13>
+		n++;
+  80385f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803862:	39 d0                	cmp    %edx,%eax
+  803864:	74 08                	je     80386e <strnlen+0x1f>
+  803866:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80386a:	75 f3                	jne    80385f <strnlen+0x10>
+  80386c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80386e:	89 d0                	mov    %edx,%eax
+  803870:	5d                   	pop    %ebp
+  803871:	c3                   	ret
+
+00803872 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803872:	55                   	push   %ebp
+  803873:	89 e5                	mov    %esp,%ebp
+  803875:	53                   	push   %ebx
+  803876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803879:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80387c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803881:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  803885:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  803888:	83 c0 01             	add    $0x1,%eax
+  80388b:	84 d2                	test   %dl,%dl
+  80388d:	75 f2                	jne    803881 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80388f:	89 c8                	mov    %ecx,%eax
+  803891:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803894:	c9                   	leave
+  803895:	c3                   	ret
+
+00803896 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  803896:	55                   	push   %ebp
+  803897:	89 e5                	mov    %esp,%ebp
+  803899:	53                   	push   %ebx
+  80389a:	83 ec 10             	sub    $0x10,%esp
+  80389d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8038a0:	53                   	push   %ebx
+  8038a1:	e8 91 ff ff ff       	call   803837 <strlen>
+  8038a6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8038a9:	ff 75 0c             	push   0xc(%ebp)
+  8038ac:	01 d8                	add    %ebx,%eax
+  8038ae:	50                   	push   %eax
+  8038af:	e8 be ff ff ff       	call   803872 <strcpy>
+	return dst;
+}
+  8038b4:	89 d8                	mov    %ebx,%eax
+  8038b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038b9:	c9                   	leave
+  8038ba:	c3                   	ret
+
+008038bb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8038bb:	55                   	push   %ebp
+  8038bc:	89 e5                	mov    %esp,%ebp
+  8038be:	56                   	push   %esi
+  8038bf:	53                   	push   %ebx
+  8038c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8038c6:	89 f3                	mov    %esi,%ebx
+  8038c8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8038cb:	89 f0                	mov    %esi,%eax
+  8038cd:	eb 0f                	jmp    8038de <strncpy+0x23>
+		*dst++ = *src;
+  8038cf:	83 c0 01             	add    $0x1,%eax
+  8038d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8038d5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8038d8:	80 f9 01             	cmp    $0x1,%cl
+  8038db:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8038de:	39 d8                	cmp    %ebx,%eax
+  8038e0:	75 ed                	jne    8038cf <strncpy+0x14>
+	}
+	return ret;
+}
+  8038e2:	89 f0                	mov    %esi,%eax
+  8038e4:	5b                   	pop    %ebx
+  8038e5:	5e                   	pop    %esi
+  8038e6:	5d                   	pop    %ebp
+  8038e7:	c3                   	ret
+
+008038e8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8038e8:	55                   	push   %ebp
+  8038e9:	89 e5                	mov    %esp,%ebp
+  8038eb:	56                   	push   %esi
+  8038ec:	53                   	push   %ebx
+  8038ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8038f6:	89 f0                	mov    %esi,%eax
+  8038f8:	85 d2                	test   %edx,%edx
+  8038fa:	74 21                	je     80391d <strlcpy+0x35>
+  8038fc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803900:	89 f2                	mov    %esi,%edx
+  803902:	eb 09                	jmp    80390d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803904:	83 c1 01             	add    $0x1,%ecx
+  803907:	83 c2 01             	add    $0x1,%edx
+  80390a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80390d:	39 c2                	cmp    %eax,%edx
+  80390f:	74 09                	je     80391a <strlcpy+0x32>
+  803911:	0f b6 19             	movzbl (%ecx),%ebx
+  803914:	84 db                	test   %bl,%bl
+  803916:	75 ec                	jne    803904 <strlcpy+0x1c>
+  803918:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80391a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80391d:	29 f0                	sub    %esi,%eax
+}
+  80391f:	5b                   	pop    %ebx
+  803920:	5e                   	pop    %esi
+  803921:	5d                   	pop    %ebp
+  803922:	c3                   	ret
+
+00803923 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803923:	55                   	push   %ebp
+  803924:	89 e5                	mov    %esp,%ebp
+  803926:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803929:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80392c:	eb 06                	jmp    803934 <strcmp+0x11>
+		p++, q++;
+  80392e:	83 c1 01             	add    $0x1,%ecx
+  803931:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803934:	0f b6 01             	movzbl (%ecx),%eax
+  803937:	84 c0                	test   %al,%al
+  803939:	74 04                	je     80393f <strcmp+0x1c>
+  80393b:	3a 02                	cmp    (%edx),%al
+  80393d:	74 ef                	je     80392e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80393f:	0f b6 c0             	movzbl %al,%eax
+  803942:	0f b6 12             	movzbl (%edx),%edx
+  803945:	29 d0                	sub    %edx,%eax
+}
+  803947:	5d                   	pop    %ebp
+  803948:	c3                   	ret
+
+00803949 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803949:	55                   	push   %ebp
+  80394a:	89 e5                	mov    %esp,%ebp
+  80394c:	53                   	push   %ebx
+  80394d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803950:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803953:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  803956:	eb 09                	jmp    803961 <strncmp+0x18>
+		n--, p++, q++;
+  803958:	83 ea 01             	sub    $0x1,%edx
+  80395b:	83 c0 01             	add    $0x1,%eax
+  80395e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803961:	85 d2                	test   %edx,%edx
+  803963:	74 18                	je     80397d <strncmp+0x34>
+  803965:	0f b6 18             	movzbl (%eax),%ebx
+  803968:	84 db                	test   %bl,%bl
+  80396a:	74 04                	je     803970 <strncmp+0x27>
+  80396c:	3a 19                	cmp    (%ecx),%bl
+  80396e:	74 e8                	je     803958 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803970:	0f b6 00             	movzbl (%eax),%eax
+  803973:	0f b6 11             	movzbl (%ecx),%edx
+  803976:	29 d0                	sub    %edx,%eax
+}
+  803978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397b:	c9                   	leave
+  80397c:	c3                   	ret
+		return 0;
+  80397d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803982:	eb f4                	jmp    803978 <strncmp+0x2f>
+
+00803984 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803984:	55                   	push   %ebp
+  803985:	89 e5                	mov    %esp,%ebp
+  803987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80398a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80398e:	eb 03                	jmp    803993 <strchr+0xf>
+  803990:	83 c0 01             	add    $0x1,%eax
+  803993:	0f b6 10             	movzbl (%eax),%edx
+  803996:	84 d2                	test   %dl,%dl
+  803998:	74 06                	je     8039a0 <strchr+0x1c>
+		if (*s == c)
+  80399a:	38 ca                	cmp    %cl,%dl
+  80399c:	75 f2                	jne    803990 <strchr+0xc>
+  80399e:	eb 05                	jmp    8039a5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8039a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a5:	5d                   	pop    %ebp
+  8039a6:	c3                   	ret
+
+008039a7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8039a7:	55                   	push   %ebp
+  8039a8:	89 e5                	mov    %esp,%ebp
+  8039aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8039b1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8039b4:	38 ca                	cmp    %cl,%dl
+  8039b6:	74 09                	je     8039c1 <strfind+0x1a>
+  8039b8:	84 d2                	test   %dl,%dl
+  8039ba:	74 05                	je     8039c1 <strfind+0x1a>
+	for (; *s; s++)
+  8039bc:	83 c0 01             	add    $0x1,%eax
+  8039bf:	eb f0                	jmp    8039b1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8039c1:	5d                   	pop    %ebp
+  8039c2:	c3                   	ret
+
+008039c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8039c3:	55                   	push   %ebp
+  8039c4:	89 e5                	mov    %esp,%ebp
+  8039c6:	57                   	push   %edi
+  8039c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8039cd:	85 c9                	test   %ecx,%ecx
+  8039cf:	74 20                	je     8039f1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8039d1:	89 f8                	mov    %edi,%eax
+  8039d3:	09 c8                	or     %ecx,%eax
+  8039d5:	a8 03                	test   $0x3,%al
+  8039d7:	75 12                	jne    8039eb <memset+0x28>
+		c &= 0xFF;
+  8039d9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8039dd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8039e3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8039e6:	fc                   	cld
+  8039e7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8039e9:	eb 06                	jmp    8039f1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8039eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039ee:	fc                   	cld
+  8039ef:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8039f1:	89 f8                	mov    %edi,%eax
+  8039f3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8039f6:	c9                   	leave
+  8039f7:	c3                   	ret
+
+008039f8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8039f8:	55                   	push   %ebp
+  8039f9:	89 e5                	mov    %esp,%ebp
+  8039fb:	57                   	push   %edi
+  8039fc:	56                   	push   %esi
+  8039fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a00:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a03:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803a06:	39 c6                	cmp    %eax,%esi
+  803a08:	73 32                	jae    803a3c <memmove+0x44>
+  803a0a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803a0d:	39 d0                	cmp    %edx,%eax
+  803a0f:	73 2b                	jae    803a3c <memmove+0x44>
+		s += n;
+		d += n;
+  803a11:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a14:	89 d6                	mov    %edx,%esi
+  803a16:	09 fe                	or     %edi,%esi
+  803a18:	09 ce                	or     %ecx,%esi
+  803a1a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803a20:	75 0e                	jne    803a30 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803a22:	83 ef 04             	sub    $0x4,%edi
+  803a25:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803a28:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803a2b:	fd                   	std
+  803a2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a2e:	eb 09                	jmp    803a39 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803a30:	83 ef 01             	sub    $0x1,%edi
+  803a33:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803a36:	fd                   	std
+  803a37:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803a39:	fc                   	cld
+  803a3a:	eb 1a                	jmp    803a56 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803a3c:	89 f2                	mov    %esi,%edx
+  803a3e:	09 c2                	or     %eax,%edx
+  803a40:	09 ca                	or     %ecx,%edx
+  803a42:	f6 c2 03             	test   $0x3,%dl
+  803a45:	75 0a                	jne    803a51 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803a47:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803a4a:	89 c7                	mov    %eax,%edi
+  803a4c:	fc                   	cld
+  803a4d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803a4f:	eb 05                	jmp    803a56 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803a51:	89 c7                	mov    %eax,%edi
+  803a53:	fc                   	cld
+  803a54:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803a56:	5e                   	pop    %esi
+  803a57:	5f                   	pop    %edi
+  803a58:	5d                   	pop    %ebp
+  803a59:	c3                   	ret
+
+00803a5a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803a5a:	55                   	push   %ebp
+  803a5b:	89 e5                	mov    %esp,%ebp
+  803a5d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803a60:	ff 75 10             	push   0x10(%ebp)
+  803a63:	ff 75 0c             	push   0xc(%ebp)
+  803a66:	ff 75 08             	push   0x8(%ebp)
+  803a69:	e8 8a ff ff ff       	call   8039f8 <memmove>
+}
+  803a6e:	c9                   	leave
+  803a6f:	c3                   	ret
+
+00803a70 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803a70:	55                   	push   %ebp
+  803a71:	89 e5                	mov    %esp,%ebp
+  803a73:	56                   	push   %esi
+  803a74:	53                   	push   %ebx
+  803a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a78:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803a7b:	89 c6                	mov    %eax,%esi
+  803a7d:	03 75 10             	add    0x10(%ebp),%esi
+  803a80:	eb 06                	jmp    803a88 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803a82:	83 c0 01             	add    $0x1,%eax
+  803a85:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803a88:	39 f0                	cmp    %esi,%eax
+  803a8a:	74 14                	je     803aa0 <memcmp+0x30>
+		if (*s1 != *s2)
+  803a8c:	0f b6 08             	movzbl (%eax),%ecx
+  803a8f:	0f b6 1a             	movzbl (%edx),%ebx
+  803a92:	38 d9                	cmp    %bl,%cl
+  803a94:	74 ec                	je     803a82 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803a96:	0f b6 c1             	movzbl %cl,%eax
+  803a99:	0f b6 db             	movzbl %bl,%ebx
+  803a9c:	29 d8                	sub    %ebx,%eax
+  803a9e:	eb 05                	jmp    803aa5 <memcmp+0x35>
+	}
+
+	return 0;
+  803aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa5:	5b                   	pop    %ebx
+  803aa6:	5e                   	pop    %esi
+  803aa7:	5d                   	pop    %ebp
+  803aa8:	c3                   	ret
+
+00803aa9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803aa9:	55                   	push   %ebp
+  803aaa:	89 e5                	mov    %esp,%ebp
+  803aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803ab2:	89 c2                	mov    %eax,%edx
+  803ab4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803ab7:	eb 03                	jmp    803abc <memfind+0x13>
+  803ab9:	83 c0 01             	add    $0x1,%eax
+  803abc:	39 d0                	cmp    %edx,%eax
+  803abe:	73 04                	jae    803ac4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803ac0:	38 08                	cmp    %cl,(%eax)
+  803ac2:	75 f5                	jne    803ab9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803ac4:	5d                   	pop    %ebp
+  803ac5:	c3                   	ret
+
+00803ac6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803ac6:	55                   	push   %ebp
+  803ac7:	89 e5                	mov    %esp,%ebp
+  803ac9:	57                   	push   %edi
+  803aca:	56                   	push   %esi
+  803acb:	53                   	push   %ebx
+  803acc:	8b 55 08             	mov    0x8(%ebp),%edx
+  803acf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803ad2:	eb 03                	jmp    803ad7 <strtol+0x11>
+		s++;
+  803ad4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803ad7:	0f b6 02             	movzbl (%edx),%eax
+  803ada:	3c 20                	cmp    $0x20,%al
+  803adc:	74 f6                	je     803ad4 <strtol+0xe>
+  803ade:	3c 09                	cmp    $0x9,%al
+  803ae0:	74 f2                	je     803ad4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803ae2:	3c 2b                	cmp    $0x2b,%al
+  803ae4:	74 2a                	je     803b10 <strtol+0x4a>
+	int neg = 0;
+  803ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803aeb:	3c 2d                	cmp    $0x2d,%al
+  803aed:	74 2b                	je     803b1a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803aef:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803af5:	75 0f                	jne    803b06 <strtol+0x40>
+  803af7:	80 3a 30             	cmpb   $0x30,(%edx)
+  803afa:	74 28                	je     803b24 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803afc:	85 db                	test   %ebx,%ebx
+  803afe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803b03:	0f 44 d8             	cmove  %eax,%ebx
+  803b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b0b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803b0e:	eb 46                	jmp    803b56 <strtol+0x90>
+		s++;
+  803b10:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803b13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b18:	eb d5                	jmp    803aef <strtol+0x29>
+		s++, neg = 1;
+  803b1a:	83 c2 01             	add    $0x1,%edx
+  803b1d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b22:	eb cb                	jmp    803aef <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803b24:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803b28:	74 0e                	je     803b38 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803b2a:	85 db                	test   %ebx,%ebx
+  803b2c:	75 d8                	jne    803b06 <strtol+0x40>
+		s++, base = 8;
+  803b2e:	83 c2 01             	add    $0x1,%edx
+  803b31:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803b36:	eb ce                	jmp    803b06 <strtol+0x40>
+		s += 2, base = 16;
+  803b38:	83 c2 02             	add    $0x2,%edx
+  803b3b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803b40:	eb c4                	jmp    803b06 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803b42:	0f be c0             	movsbl %al,%eax
+  803b45:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803b48:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803b4b:	7d 3a                	jge    803b87 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803b4d:	83 c2 01             	add    $0x1,%edx
+  803b50:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803b54:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803b56:	0f b6 02             	movzbl (%edx),%eax
+  803b59:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803b5c:	89 f3                	mov    %esi,%ebx
+  803b5e:	80 fb 09             	cmp    $0x9,%bl
+  803b61:	76 df                	jbe    803b42 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803b63:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803b66:	89 f3                	mov    %esi,%ebx
+  803b68:	80 fb 19             	cmp    $0x19,%bl
+  803b6b:	77 08                	ja     803b75 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803b6d:	0f be c0             	movsbl %al,%eax
+  803b70:	83 e8 57             	sub    $0x57,%eax
+  803b73:	eb d3                	jmp    803b48 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803b75:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803b78:	89 f3                	mov    %esi,%ebx
+  803b7a:	80 fb 19             	cmp    $0x19,%bl
+  803b7d:	77 08                	ja     803b87 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803b7f:	0f be c0             	movsbl %al,%eax
+  803b82:	83 e8 37             	sub    $0x37,%eax
+  803b85:	eb c1                	jmp    803b48 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803b87:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b8b:	74 05                	je     803b92 <strtol+0xcc>
+		*endptr = (char *) s;
+  803b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b90:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803b92:	89 c8                	mov    %ecx,%eax
+  803b94:	f7 d8                	neg    %eax
+  803b96:	85 ff                	test   %edi,%edi
+  803b98:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803b9b:	89 c8                	mov    %ecx,%eax
+  803b9d:	5b                   	pop    %ebx
+  803b9e:	5e                   	pop    %esi
+  803b9f:	5f                   	pop    %edi
+  803ba0:	5d                   	pop    %ebp
+  803ba1:	c3                   	ret
+
+00803ba2 <atoi>:
+
+int
+atoi(const char* s)
+{
+  803ba2:	55                   	push   %ebp
+  803ba3:	89 e5                	mov    %esp,%ebp
+  803ba5:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  803ba8:	6a 00                	push   $0x0
+  803baa:	6a 00                	push   $0x0
+  803bac:	ff 75 08             	push   0x8(%ebp)
+  803baf:	e8 12 ff ff ff       	call   803ac6 <strtol>
+}
+  803bb4:	c9                   	leave
+  803bb5:	c3                   	ret
+
+00803bb6 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803bb6:	55                   	push   %ebp
+  803bb7:	89 e5                	mov    %esp,%ebp
+  803bb9:	57                   	push   %edi
+  803bba:	56                   	push   %esi
+  803bbb:	53                   	push   %ebx
+  803bbc:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803bbf:	89 d6                	mov    %edx,%esi
+  803bc1:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803bc4:	89 cf                	mov    %ecx,%edi
+  803bc6:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803bc9:	89 fa                	mov    %edi,%edx
+  803bcb:	80 ce 08             	or     $0x8,%dh
+  803bce:	f6 c5 08             	test   $0x8,%ch
+  803bd1:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803bd4:	57                   	push   %edi
+  803bd5:	56                   	push   %esi
+  803bd6:	50                   	push   %eax
+  803bd7:	56                   	push   %esi
+  803bd8:	6a 00                	push   $0x0
+  803bda:	e8 41 c6 ff ff       	call   800220 <sys_page_map>
+	if (r < 0) {
+  803bdf:	83 c4 20             	add    $0x20,%esp
+  803be2:	85 c0                	test   %eax,%eax
+  803be4:	78 27                	js     803c0d <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803be6:	83 ec 0c             	sub    $0xc,%esp
+  803be9:	57                   	push   %edi
+  803bea:	56                   	push   %esi
+  803beb:	6a 00                	push   $0x0
+  803bed:	56                   	push   %esi
+  803bee:	6a 00                	push   $0x0
+  803bf0:	e8 2b c6 ff ff       	call   800220 <sys_page_map>
+  803bf5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803bf7:	83 c4 20             	add    $0x20,%esp
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	78 24                	js     803c22 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803bfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c03:	89 d8                	mov    %ebx,%eax
+  803c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c08:	5b                   	pop    %ebx
+  803c09:	5e                   	pop    %esi
+  803c0a:	5f                   	pop    %edi
+  803c0b:	5d                   	pop    %ebp
+  803c0c:	c3                   	ret
+  803c0d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c0f:	83 ec 08             	sub    $0x8,%esp
+  803c12:	50                   	push   %eax
+  803c13:	68 78 4c 80 00       	push   $0x804c78
+  803c18:	e8 71 f6 ff ff       	call   80328e <cprintf>
+		return r;
+  803c1d:	83 c4 10             	add    $0x10,%esp
+  803c20:	eb e1                	jmp    803c03 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803c22:	83 ec 08             	sub    $0x8,%esp
+  803c25:	50                   	push   %eax
+  803c26:	68 a8 4c 80 00       	push   $0x804ca8
+  803c2b:	e8 5e f6 ff ff       	call   80328e <cprintf>
+		return r;
+  803c30:	83 c4 10             	add    $0x10,%esp
+  803c33:	eb ce                	jmp    803c03 <duppage_cow+0x4d>
+
+00803c35 <duppage>:
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	53                   	push   %ebx
+  803c39:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803c3c:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803c3f:	51                   	push   %ecx
+  803c40:	52                   	push   %edx
+  803c41:	50                   	push   %eax
+  803c42:	52                   	push   %edx
+  803c43:	6a 00                	push   $0x0
+  803c45:	e8 d6 c5 ff ff       	call   800220 <sys_page_map>
+	if (r < 0) {
+  803c4a:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803c4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803c52:	85 c0                	test   %eax,%eax
+  803c54:	78 07                	js     803c5d <duppage+0x28>
+}
+  803c56:	89 d8                	mov    %ebx,%eax
+  803c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c5b:	c9                   	leave
+  803c5c:	c3                   	ret
+  803c5d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803c5f:	83 ec 08             	sub    $0x8,%esp
+  803c62:	50                   	push   %eax
+  803c63:	68 78 4c 80 00       	push   $0x804c78
+  803c68:	e8 21 f6 ff ff       	call   80328e <cprintf>
+		return r;
+  803c6d:	83 c4 10             	add    $0x10,%esp
+  803c70:	eb e4                	jmp    803c56 <duppage+0x21>
+
+00803c72 <cow_copy>:
+{
+  803c72:	55                   	push   %ebp
+  803c73:	89 e5                	mov    %esp,%ebp
+  803c75:	56                   	push   %esi
+  803c76:	53                   	push   %ebx
+  803c77:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803c79:	83 ec 04             	sub    $0x4,%esp
+  803c7c:	6a 07                	push   $0x7
+  803c7e:	68 00 f0 7f 00       	push   $0x7ff000
+  803c83:	6a 00                	push   $0x0
+  803c85:	e8 49 c5 ff ff       	call   8001d3 <sys_page_alloc>
+	if (r < 0) {
+  803c8a:	83 c4 10             	add    $0x10,%esp
+  803c8d:	85 c0                	test   %eax,%eax
+  803c8f:	78 58                	js     803ce9 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803c91:	83 ec 04             	sub    $0x4,%esp
+  803c94:	68 00 10 00 00       	push   $0x1000
+  803c99:	56                   	push   %esi
+  803c9a:	68 00 f0 7f 00       	push   $0x7ff000
+  803c9f:	e8 54 fd ff ff       	call   8039f8 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803ca4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803cab:	56                   	push   %esi
+  803cac:	6a 00                	push   $0x0
+  803cae:	68 00 f0 7f 00       	push   $0x7ff000
+  803cb3:	6a 00                	push   $0x0
+  803cb5:	e8 66 c5 ff ff       	call   800220 <sys_page_map>
+  803cba:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cbc:	83 c4 20             	add    $0x20,%esp
+  803cbf:	85 c0                	test   %eax,%eax
+  803cc1:	78 3b                	js     803cfe <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803cc3:	83 ec 08             	sub    $0x8,%esp
+  803cc6:	68 00 f0 7f 00       	push   $0x7ff000
+  803ccb:	6a 00                	push   $0x0
+  803ccd:	e8 9a c5 ff ff       	call   80026c <sys_page_unmap>
+  803cd2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cd4:	83 c4 10             	add    $0x10,%esp
+  803cd7:	85 c0                	test   %eax,%eax
+  803cd9:	78 45                	js     803d20 <cow_copy+0xae>
+	return 0;
+  803cdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ce0:	89 d8                	mov    %ebx,%eax
+  803ce2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ce5:	5b                   	pop    %ebx
+  803ce6:	5e                   	pop    %esi
+  803ce7:	5d                   	pop    %ebp
+  803ce8:	c3                   	ret
+  803ce9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803ceb:	83 ec 08             	sub    $0x8,%esp
+  803cee:	50                   	push   %eax
+  803cef:	68 98 4d 80 00       	push   $0x804d98
+  803cf4:	e8 95 f5 ff ff       	call   80328e <cprintf>
+		return r;
+  803cf9:	83 c4 10             	add    $0x10,%esp
+  803cfc:	eb e2                	jmp    803ce0 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803cfe:	83 ec 08             	sub    $0x8,%esp
+  803d01:	50                   	push   %eax
+  803d02:	68 b4 4d 80 00       	push   $0x804db4
+  803d07:	e8 82 f5 ff ff       	call   80328e <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803d0c:	83 c4 08             	add    $0x8,%esp
+  803d0f:	68 00 f0 7f 00       	push   $0x7ff000
+  803d14:	6a 00                	push   $0x0
+  803d16:	e8 51 c5 ff ff       	call   80026c <sys_page_unmap>
+		return r;
+  803d1b:	83 c4 10             	add    $0x10,%esp
+  803d1e:	eb c0                	jmp    803ce0 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803d20:	83 ec 08             	sub    $0x8,%esp
+  803d23:	50                   	push   %eax
+  803d24:	68 d0 4c 80 00       	push   $0x804cd0
+  803d29:	e8 60 f5 ff ff       	call   80328e <cprintf>
+		return r;
+  803d2e:	83 c4 10             	add    $0x10,%esp
+  803d31:	eb ad                	jmp    803ce0 <cow_copy+0x6e>
+
+00803d33 <pgfault>:
+{
+  803d33:	55                   	push   %ebp
+  803d34:	89 e5                	mov    %esp,%ebp
+  803d36:	56                   	push   %esi
+  803d37:	53                   	push   %ebx
+  803d38:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803d3b:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803d3d:	89 d8                	mov    %ebx,%eax
+  803d3f:	c1 e8 16             	shr    $0x16,%eax
+  803d42:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803d49:	89 de                	mov    %ebx,%esi
+  803d4b:	c1 ee 0c             	shr    $0xc,%esi
+  803d4e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803d55:	a8 07                	test   $0x7,%al
+  803d57:	74 3b                	je     803d94 <pgfault+0x61>
+  803d59:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803d5f:	74 33                	je     803d94 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803d61:	83 ec 0c             	sub    $0xc,%esp
+  803d64:	68 00 f0 bf ee       	push   $0xeebff000
+  803d69:	e8 c5 ea ff ff       	call   802833 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803d6e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803d75:	83 c4 10             	add    $0x10,%esp
+  803d78:	f6 c4 08             	test   $0x8,%ah
+  803d7b:	75 30                	jne    803dad <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803d7d:	83 ec 0c             	sub    $0xc,%esp
+  803d80:	68 00 f0 bf ee       	push   $0xeebff000
+  803d85:	e8 16 eb ff ff       	call   8028a0 <mutex_unlock>
+}
+  803d8a:	83 c4 10             	add    $0x10,%esp
+  803d8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d90:	5b                   	pop    %ebx
+  803d91:	5e                   	pop    %esi
+  803d92:	5d                   	pop    %ebp
+  803d93:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803d94:	83 ec 08             	sub    $0x8,%esp
+  803d97:	ff 72 28             	push   0x28(%edx)
+  803d9a:	51                   	push   %ecx
+  803d9b:	50                   	push   %eax
+  803d9c:	68 f4 4c 80 00       	push   $0x804cf4
+  803da1:	6a 3f                	push   $0x3f
+  803da3:	68 ce 4d 80 00       	push   $0x804dce
+  803da8:	e8 06 f4 ff ff       	call   8031b3 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803dad:	89 d8                	mov    %ebx,%eax
+  803daf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803db4:	e8 b9 fe ff ff       	call   803c72 <cow_copy>
+  803db9:	eb c2                	jmp    803d7d <pgfault+0x4a>
+
+00803dbb <cow_enable>:
+{
+  803dbb:	55                   	push   %ebp
+  803dbc:	89 e5                	mov    %esp,%ebp
+  803dbe:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803dc1:	68 33 3d 80 00       	push   $0x803d33
+  803dc6:	e8 28 06 00 00       	call   8043f3 <set_pgfault_handler>
+}
+  803dcb:	83 c4 10             	add    $0x10,%esp
+  803dce:	c9                   	leave
+  803dcf:	c3                   	ret
+
+00803dd0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803dd0:	55                   	push   %ebp
+  803dd1:	89 e5                	mov    %esp,%ebp
+  803dd3:	57                   	push   %edi
+  803dd4:	56                   	push   %esi
+  803dd5:	53                   	push   %ebx
+  803dd6:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803dd9:	68 33 3d 80 00       	push   $0x803d33
+  803dde:	e8 10 06 00 00       	call   8043f3 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803de3:	b8 07 00 00 00       	mov    $0x7,%eax
+  803de8:	cd 30                	int    $0x30
+  803dea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803ded:	83 c4 10             	add    $0x10,%esp
+  803df0:	85 c0                	test   %eax,%eax
+  803df2:	78 4b                	js     803e3f <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803df4:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803df9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803dfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803e01:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803e05:	0f 85 16 01 00 00    	jne    803f21 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e0b:	e8 6b c3 ff ff       	call   80017b <sys_getenvid>
+  803e10:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e15:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e17:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803e1d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e23:	77 32                	ja     803e57 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e25:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803e2a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803e2c:	c1 ea 10             	shr    $0x10,%edx
+  803e2f:	74 26                	je     803e57 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e31:	c1 e2 10             	shl    $0x10,%edx
+  803e34:	89 d1                	mov    %edx,%ecx
+  803e36:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e3b:	29 ca                	sub    %ecx,%edx
+  803e3d:	eb 1e                	jmp    803e5d <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803e3f:	83 ec 08             	sub    $0x8,%esp
+  803e42:	89 c7                	mov    %eax,%edi
+  803e44:	50                   	push   %eax
+  803e45:	68 d9 4d 80 00       	push   $0x804dd9
+  803e4a:	e8 3f f4 ff ff       	call   80328e <cprintf>
+		return eid;
+  803e4f:	83 c4 10             	add    $0x10,%esp
+  803e52:	e9 6c 01 00 00       	jmp    803fc3 <fork+0x1f3>
+		return pthread_main_tls;
+  803e57:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803e5d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803e60:	c1 e0 04             	shl    $0x4,%eax
+  803e63:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e68:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803e6a:	e8 0d f1 ff ff       	call   802f7c <pthread_fork_child>
+		return eid;
+  803e6f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e72:	e9 4c 01 00 00       	jmp    803fc3 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e77:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e7d:	89 da                	mov    %ebx,%edx
+  803e7f:	89 f8                	mov    %edi,%eax
+  803e81:	e8 af fd ff ff       	call   803c35 <duppage>
+  803e86:	85 c0                	test   %eax,%eax
+  803e88:	79 28                	jns    803eb2 <fork+0xe2>
+  803e8a:	89 c7                	mov    %eax,%edi
+  803e8c:	e9 32 01 00 00       	jmp    803fc3 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803e91:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803e97:	83 f9 05             	cmp    $0x5,%ecx
+  803e9a:	75 58                	jne    803ef4 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803e9c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803ea1:	89 da                	mov    %ebx,%edx
+  803ea3:	89 f8                	mov    %edi,%eax
+  803ea5:	e8 8b fd ff ff       	call   803c35 <duppage>
+  803eaa:	85 c0                	test   %eax,%eax
+  803eac:	0f 88 0f 01 00 00    	js     803fc1 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803eb2:	83 c3 01             	add    $0x1,%ebx
+  803eb5:	39 de                	cmp    %ebx,%esi
+  803eb7:	74 54                	je     803f0d <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803eb9:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803ec0:	f6 c1 05             	test   $0x5,%cl
+  803ec3:	74 ed                	je     803eb2 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ec5:	f6 c5 04             	test   $0x4,%ch
+  803ec8:	75 ad                	jne    803e77 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803eca:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ed0:	74 bf                	je     803e91 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ed2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ed8:	74 d8                	je     803eb2 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803eda:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803ee0:	89 da                	mov    %ebx,%edx
+  803ee2:	89 f8                	mov    %edi,%eax
+  803ee4:	e8 cd fc ff ff       	call   803bb6 <duppage_cow>
+  803ee9:	85 c0                	test   %eax,%eax
+  803eeb:	79 c5                	jns    803eb2 <fork+0xe2>
+  803eed:	89 c7                	mov    %eax,%edi
+  803eef:	e9 cf 00 00 00       	jmp    803fc3 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803ef4:	68 24 4d 80 00       	push   $0x804d24
+  803ef9:	68 95 47 80 00       	push   $0x804795
+  803efe:	68 c6 00 00 00       	push   $0xc6
+  803f03:	68 ce 4d 80 00       	push   $0x804dce
+  803f08:	e8 a6 f2 ff ff       	call   8031b3 <_panic>
+  803f0d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f10:	83 c1 01             	add    $0x1,%ecx
+  803f13:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803f19:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803f1f:	74 18                	je     803f39 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803f21:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803f28:	a8 07                	test   $0x7,%al
+  803f2a:	74 e4                	je     803f10 <fork+0x140>
+  803f2c:	89 cb                	mov    %ecx,%ebx
+  803f2e:	c1 e3 0a             	shl    $0xa,%ebx
+  803f31:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803f34:	e9 7c ff ff ff       	jmp    803eb5 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803f39:	83 ec 04             	sub    $0x4,%esp
+  803f3c:	6a 07                	push   $0x7
+  803f3e:	68 00 f0 bf ee       	push   $0xeebff000
+  803f43:	ff 75 e4             	push   -0x1c(%ebp)
+  803f46:	e8 88 c2 ff ff       	call   8001d3 <sys_page_alloc>
+  803f4b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f4d:	83 c4 10             	add    $0x10,%esp
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	78 34                	js     803f88 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803f54:	83 ec 08             	sub    $0x8,%esp
+  803f57:	68 31 44 80 00       	push   $0x804431
+  803f5c:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5f:	e8 ec c3 ff ff       	call   800350 <sys_env_set_pgfault_upcall>
+  803f64:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f66:	83 c4 10             	add    $0x10,%esp
+  803f69:	85 c0                	test   %eax,%eax
+  803f6b:	78 2e                	js     803f9b <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  803f6d:	83 ec 08             	sub    $0x8,%esp
+  803f70:	6a 02                	push   $0x2
+  803f72:	ff 75 e4             	push   -0x1c(%ebp)
+  803f75:	e8 3e c3 ff ff       	call   8002b8 <sys_env_set_status>
+  803f7a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803f7c:	83 c4 10             	add    $0x10,%esp
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	78 2b                	js     803fae <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  803f83:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f86:	eb 3b                	jmp    803fc3 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  803f88:	83 ec 08             	sub    $0x8,%esp
+  803f8b:	50                   	push   %eax
+  803f8c:	68 4c 4d 80 00       	push   $0x804d4c
+  803f91:	e8 f8 f2 ff ff       	call   80328e <cprintf>
+		return r;
+  803f96:	83 c4 10             	add    $0x10,%esp
+  803f99:	eb 28                	jmp    803fc3 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  803f9b:	83 ec 08             	sub    $0x8,%esp
+  803f9e:	50                   	push   %eax
+  803f9f:	68 74 4d 80 00       	push   $0x804d74
+  803fa4:	e8 e5 f2 ff ff       	call   80328e <cprintf>
+		return r;
+  803fa9:	83 c4 10             	add    $0x10,%esp
+  803fac:	eb 15                	jmp    803fc3 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  803fae:	83 ec 08             	sub    $0x8,%esp
+  803fb1:	50                   	push   %eax
+  803fb2:	68 e9 4d 80 00       	push   $0x804de9
+  803fb7:	e8 d2 f2 ff ff       	call   80328e <cprintf>
+		return r;
+  803fbc:	83 c4 10             	add    $0x10,%esp
+  803fbf:	eb 02                	jmp    803fc3 <fork+0x1f3>
+  803fc1:	89 c7                	mov    %eax,%edi
+}
+  803fc3:	89 f8                	mov    %edi,%eax
+  803fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fc8:	5b                   	pop    %ebx
+  803fc9:	5e                   	pop    %esi
+  803fca:	5f                   	pop    %edi
+  803fcb:	5d                   	pop    %ebp
+  803fcc:	c3                   	ret
+
+00803fcd <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  803fcd:	55                   	push   %ebp
+  803fce:	89 e5                	mov    %esp,%ebp
+  803fd0:	57                   	push   %edi
+  803fd1:	56                   	push   %esi
+  803fd2:	53                   	push   %ebx
+  803fd3:	83 ec 2c             	sub    $0x2c,%esp
+  803fd6:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fd8:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  803fde:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803fe9:	77 0a                	ja     803ff5 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803feb:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803ff0:	29 c3                	sub    %eax,%ebx
+  803ff2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ff5:	83 ec 0c             	sub    $0xc,%esp
+  803ff8:	68 33 3d 80 00       	push   $0x803d33
+  803ffd:	e8 f1 03 00 00       	call   8043f3 <set_pgfault_handler>
+  804002:	b8 07 00 00 00       	mov    $0x7,%eax
+  804007:	cd 30                	int    $0x30
+  804009:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80400c:	83 c4 10             	add    $0x10,%esp
+  80400f:	85 c0                	test   %eax,%eax
+  804011:	78 30                	js     804043 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804013:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804017:	74 42                	je     80405b <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804019:	c1 e3 10             	shl    $0x10,%ebx
+  80401c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804021:	29 d8                	sub    %ebx,%eax
+  804023:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804026:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80402b:	29 d8                	sub    %ebx,%eax
+  80402d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804030:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80403a:	89 f7                	mov    %esi,%edi
+  80403c:	89 d6                	mov    %edx,%esi
+  80403e:	e9 2c 01 00 00       	jmp    80416f <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804043:	83 ec 08             	sub    $0x8,%esp
+  804046:	89 c7                	mov    %eax,%edi
+  804048:	50                   	push   %eax
+  804049:	68 d9 4d 80 00       	push   $0x804dd9
+  80404e:	e8 3b f2 ff ff       	call   80328e <cprintf>
+		return eid;
+  804053:	83 c4 10             	add    $0x10,%esp
+  804056:	e9 d5 00 00 00       	jmp    804130 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80405b:	e8 1b c1 ff ff       	call   80017b <sys_getenvid>
+  804060:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804065:	89 c2                	mov    %eax,%edx
+  804067:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804069:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80406f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804074:	77 18                	ja     80408e <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804076:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80407b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80407d:	c1 e8 10             	shr    $0x10,%eax
+  804080:	74 0c                	je     80408e <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804082:	c1 e0 10             	shl    $0x10,%eax
+  804085:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80408a:	29 c1                	sub    %eax,%ecx
+  80408c:	eb 06                	jmp    804094 <sfork+0xc7>
+		return pthread_main_tls;
+  80408e:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804094:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804097:	c1 e0 04             	shl    $0x4,%eax
+  80409a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80409f:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8040a1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040a4:	e9 87 00 00 00       	jmp    804130 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8040a9:	f6 c5 04             	test   $0x4,%ch
+  8040ac:	74 6c                	je     80411a <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8040ae:	89 ca                	mov    %ecx,%edx
+  8040b0:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8040b6:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8040bc:	74 7c                	je     80413a <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8040be:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8040c4:	89 da                	mov    %ebx,%edx
+  8040c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8040c9:	e8 67 fb ff ff       	call   803c35 <duppage>
+  8040ce:	85 c0                	test   %eax,%eax
+  8040d0:	0f 88 4f 01 00 00    	js     804225 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8040d6:	83 c3 01             	add    $0x1,%ebx
+  8040d9:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040dc:	74 7a                	je     804158 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8040de:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8040e0:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8040e7:	f6 c1 01             	test   $0x1,%cl
+  8040ea:	74 ea                	je     8040d6 <sfork+0x109>
+  8040ec:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8040f2:	74 e2                	je     8040d6 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8040f4:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8040fa:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040fd:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804102:	76 a5                	jbe    8040a9 <sfork+0xdc>
+  804104:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80410a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80410d:	39 fa                	cmp    %edi,%edx
+  80410f:	73 9d                	jae    8040ae <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804111:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804114:	39 fa                	cmp    %edi,%edx
+  804116:	72 96                	jb     8040ae <sfork+0xe1>
+  804118:	eb 8f                	jmp    8040a9 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80411a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804120:	89 da                	mov    %ebx,%edx
+  804122:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804125:	e8 8c fa ff ff       	call   803bb6 <duppage_cow>
+  80412a:	85 c0                	test   %eax,%eax
+  80412c:	79 a8                	jns    8040d6 <sfork+0x109>
+  80412e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804130:	89 f8                	mov    %edi,%eax
+  804132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804135:	5b                   	pop    %ebx
+  804136:	5e                   	pop    %esi
+  804137:	5f                   	pop    %edi
+  804138:	5d                   	pop    %ebp
+  804139:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80413a:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80413f:	e8 2e fb ff ff       	call   803c72 <cow_copy>
+  804144:	85 c0                	test   %eax,%eax
+  804146:	0f 88 d2 00 00 00    	js     80421e <sfork+0x251>
+				pte = uvpt[pn];
+  80414c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804153:	e9 66 ff ff ff       	jmp    8040be <sfork+0xf1>
+  804158:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80415b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80415e:	83 c6 01             	add    $0x1,%esi
+  804161:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804167:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80416d:	74 1b                	je     80418a <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80416f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804176:	a8 01                	test   $0x1,%al
+  804178:	74 e4                	je     80415e <sfork+0x191>
+  80417a:	89 f3                	mov    %esi,%ebx
+  80417c:	c1 e3 0a             	shl    $0xa,%ebx
+  80417f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804182:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804185:	e9 4f ff ff ff       	jmp    8040d9 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80418a:	83 ec 04             	sub    $0x4,%esp
+  80418d:	6a 07                	push   $0x7
+  80418f:	68 00 f0 bf ee       	push   $0xeebff000
+  804194:	ff 75 e0             	push   -0x20(%ebp)
+  804197:	e8 37 c0 ff ff       	call   8001d3 <sys_page_alloc>
+  80419c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80419e:	83 c4 10             	add    $0x10,%esp
+  8041a1:	85 c0                	test   %eax,%eax
+  8041a3:	78 37                	js     8041dc <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8041a5:	83 ec 08             	sub    $0x8,%esp
+  8041a8:	68 31 44 80 00       	push   $0x804431
+  8041ad:	ff 75 e0             	push   -0x20(%ebp)
+  8041b0:	e8 9b c1 ff ff       	call   800350 <sys_env_set_pgfault_upcall>
+  8041b5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041b7:	83 c4 10             	add    $0x10,%esp
+  8041ba:	85 c0                	test   %eax,%eax
+  8041bc:	78 34                	js     8041f2 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8041be:	83 ec 08             	sub    $0x8,%esp
+  8041c1:	6a 02                	push   $0x2
+  8041c3:	ff 75 e0             	push   -0x20(%ebp)
+  8041c6:	e8 ed c0 ff ff       	call   8002b8 <sys_env_set_status>
+  8041cb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8041cd:	83 c4 10             	add    $0x10,%esp
+  8041d0:	85 c0                	test   %eax,%eax
+  8041d2:	78 34                	js     804208 <sfork+0x23b>
+	return eid;
+  8041d4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041d7:	e9 54 ff ff ff       	jmp    804130 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8041dc:	83 ec 08             	sub    $0x8,%esp
+  8041df:	50                   	push   %eax
+  8041e0:	68 4c 4d 80 00       	push   $0x804d4c
+  8041e5:	e8 a4 f0 ff ff       	call   80328e <cprintf>
+		return r;
+  8041ea:	83 c4 10             	add    $0x10,%esp
+  8041ed:	e9 3e ff ff ff       	jmp    804130 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8041f2:	83 ec 08             	sub    $0x8,%esp
+  8041f5:	50                   	push   %eax
+  8041f6:	68 74 4d 80 00       	push   $0x804d74
+  8041fb:	e8 8e f0 ff ff       	call   80328e <cprintf>
+		return r;
+  804200:	83 c4 10             	add    $0x10,%esp
+  804203:	e9 28 ff ff ff       	jmp    804130 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804208:	83 ec 08             	sub    $0x8,%esp
+  80420b:	50                   	push   %eax
+  80420c:	68 e9 4d 80 00       	push   $0x804de9
+  804211:	e8 78 f0 ff ff       	call   80328e <cprintf>
+		return r;
+  804216:	83 c4 10             	add    $0x10,%esp
+  804219:	e9 12 ff ff ff       	jmp    804130 <sfork+0x163>
+  80421e:	89 c7                	mov    %eax,%edi
+  804220:	e9 0b ff ff ff       	jmp    804130 <sfork+0x163>
+  804225:	89 c7                	mov    %eax,%edi
+  804227:	e9 04 ff ff ff       	jmp    804130 <sfork+0x163>
+
+0080422c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80422c:	55                   	push   %ebp
+  80422d:	89 e5                	mov    %esp,%ebp
+  80422f:	57                   	push   %edi
+  804230:	56                   	push   %esi
+  804231:	53                   	push   %ebx
+  804232:	83 ec 18             	sub    $0x18,%esp
+  804235:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804238:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80423b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80423e:	85 c0                	test   %eax,%eax
+  804240:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804245:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804248:	50                   	push   %eax
+  804249:	e8 7b c1 ff ff       	call   8003c9 <sys_ipc_recv>
+	if (r < 0) {
+  80424e:	83 c4 10             	add    $0x10,%esp
+  804251:	85 c0                	test   %eax,%eax
+  804253:	78 2b                	js     804280 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804255:	85 ff                	test   %edi,%edi
+  804257:	74 55                	je     8042ae <ipc_recv+0x82>
+  804259:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80425b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804261:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804266:	77 39                	ja     8042a1 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804268:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80426d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80426f:	c1 e8 10             	shr    $0x10,%eax
+  804272:	74 2d                	je     8042a1 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804274:	c1 e0 10             	shl    $0x10,%eax
+  804277:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80427c:	29 c2                	sub    %eax,%edx
+  80427e:	eb 27                	jmp    8042a7 <ipc_recv+0x7b>
+  804280:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804282:	83 ec 08             	sub    $0x8,%esp
+  804285:	50                   	push   %eax
+  804286:	68 07 4e 80 00       	push   $0x804e07
+  80428b:	e8 fe ef ff ff       	call   80328e <cprintf>
+		*from_env_store = 0;
+  804290:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804296:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80429c:	83 c4 10             	add    $0x10,%esp
+  80429f:	eb 77                	jmp    804318 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8042a1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8042a7:	8b 02                	mov    (%edx),%eax
+  8042a9:	8b 40 78             	mov    0x78(%eax),%eax
+  8042ac:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8042ae:	85 f6                	test   %esi,%esi
+  8042b0:	74 34                	je     8042e6 <ipc_recv+0xba>
+  8042b2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042b4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ba:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042bf:	77 18                	ja     8042d9 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042c1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042c6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042c8:	c1 e8 10             	shr    $0x10,%eax
+  8042cb:	74 0c                	je     8042d9 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042cd:	c1 e0 10             	shl    $0x10,%eax
+  8042d0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042d5:	29 c2                	sub    %eax,%edx
+  8042d7:	eb 06                	jmp    8042df <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8042d9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8042df:	8b 02                	mov    (%edx),%eax
+  8042e1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8042e4:	89 06                	mov    %eax,(%esi)
+  8042e6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042e8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042f3:	77 18                	ja     80430d <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042fa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042fc:	c1 e8 10             	shr    $0x10,%eax
+  8042ff:	74 0c                	je     80430d <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804301:	c1 e0 10             	shl    $0x10,%eax
+  804304:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804309:	29 c2                	sub    %eax,%edx
+  80430b:	eb 06                	jmp    804313 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80430d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804313:	8b 02                	mov    (%edx),%eax
+  804315:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804318:	89 d8                	mov    %ebx,%eax
+  80431a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80431d:	5b                   	pop    %ebx
+  80431e:	5e                   	pop    %esi
+  80431f:	5f                   	pop    %edi
+  804320:	5d                   	pop    %ebp
+  804321:	c3                   	ret
+
+00804322 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804322:	55                   	push   %ebp
+  804323:	89 e5                	mov    %esp,%ebp
+  804325:	57                   	push   %edi
+  804326:	56                   	push   %esi
+  804327:	53                   	push   %ebx
+  804328:	83 ec 0c             	sub    $0xc,%esp
+  80432b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80432e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804331:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804334:	85 db                	test   %ebx,%ebx
+  804336:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80433b:	0f 44 d8             	cmove  %eax,%ebx
+  80433e:	eb 05                	jmp    804345 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804340:	e8 62 be ff ff       	call   8001a7 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804345:	57                   	push   %edi
+  804346:	53                   	push   %ebx
+  804347:	ff 75 0c             	push   0xc(%ebp)
+  80434a:	56                   	push   %esi
+  80434b:	e8 4c c0 ff ff       	call   80039c <sys_ipc_try_send>
+		if (r == 0) {
+  804350:	83 c4 10             	add    $0x10,%esp
+  804353:	85 c0                	test   %eax,%eax
+  804355:	74 19                	je     804370 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804357:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80435a:	74 e4                	je     804340 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80435c:	83 ec 0c             	sub    $0xc,%esp
+  80435f:	50                   	push   %eax
+  804360:	57                   	push   %edi
+  804361:	53                   	push   %ebx
+  804362:	56                   	push   %esi
+  804363:	68 20 4e 80 00       	push   $0x804e20
+  804368:	e8 21 ef ff ff       	call   80328e <cprintf>
+			return;
+  80436d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804373:	5b                   	pop    %ebx
+  804374:	5e                   	pop    %esi
+  804375:	5f                   	pop    %edi
+  804376:	5d                   	pop    %ebp
+  804377:	c3                   	ret
+
+00804378 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804378:	55                   	push   %ebp
+  804379:	89 e5                	mov    %esp,%ebp
+  80437b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80437e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804383:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804386:	c1 e0 04             	shl    $0x4,%eax
+  804389:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80438e:	8b 40 50             	mov    0x50(%eax),%eax
+  804391:	39 c8                	cmp    %ecx,%eax
+  804393:	74 12                	je     8043a7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804395:	83 c2 01             	add    $0x1,%edx
+  804398:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80439e:	75 e3                	jne    804383 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8043a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a5:	eb 0e                	jmp    8043b5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8043a7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8043aa:	c1 e0 04             	shl    $0x4,%eax
+  8043ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8043b2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8043b5:	5d                   	pop    %ebp
+  8043b6:	c3                   	ret
+
+008043b7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8043b7:	55                   	push   %ebp
+  8043b8:	89 e5                	mov    %esp,%ebp
+  8043ba:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043bd:	89 c2                	mov    %eax,%edx
+  8043bf:	c1 ea 16             	shr    $0x16,%edx
+  8043c2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8043c9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8043ce:	f6 c1 01             	test   $0x1,%cl
+  8043d1:	74 1c                	je     8043ef <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8043d3:	c1 e8 0c             	shr    $0xc,%eax
+  8043d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8043dd:	a8 01                	test   $0x1,%al
+  8043df:	74 0e                	je     8043ef <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8043e1:	c1 e8 0c             	shr    $0xc,%eax
+  8043e4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8043eb:	ef 
+  8043ec:	0f b7 d2             	movzwl %dx,%edx
+}
+  8043ef:	89 d0                	mov    %edx,%eax
+  8043f1:	5d                   	pop    %ebp
+  8043f2:	c3                   	ret
+
+008043f3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043f3:	55                   	push   %ebp
+  8043f4:	89 e5                	mov    %esp,%ebp
+  8043f6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8043f9:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804400:	74 0a                	je     80440c <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804402:	8b 45 08             	mov    0x8(%ebp),%eax
+  804405:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80440a:	c9                   	leave
+  80440b:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80440c:	83 ec 04             	sub    $0x4,%esp
+  80440f:	6a 07                	push   $0x7
+  804411:	68 00 f0 bf ee       	push   $0xeebff000
+  804416:	6a 00                	push   $0x0
+  804418:	e8 b6 bd ff ff       	call   8001d3 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80441d:	83 c4 08             	add    $0x8,%esp
+  804420:	68 31 44 80 00       	push   $0x804431
+  804425:	6a 00                	push   $0x0
+  804427:	e8 24 bf ff ff       	call   800350 <sys_env_set_pgfault_upcall>
+  80442c:	83 c4 10             	add    $0x10,%esp
+  80442f:	eb d1                	jmp    804402 <set_pgfault_handler+0xf>
+
+00804431 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804431:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804432:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804437:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804439:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80443c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804440:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804444:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804447:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80444b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80444d:	83 c4 08             	add    $0x8,%esp
+	popal
+  804450:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804451:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804454:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804455:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804456:	c3                   	ret
+
+00804457 <udm>:
+  804457:	57                   	push   %edi
+  804458:	56                   	push   %esi
+  804459:	53                   	push   %ebx
+  80445a:	83 ec 20             	sub    $0x20,%esp
+  80445d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804461:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804465:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804469:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80446d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804471:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804475:	89 d1                	mov    %edx,%ecx
+  804477:	09 c1                	or     %eax,%ecx
+  804479:	0f 84 91 00 00 00    	je     804510 <udm+0xb9>
+  80447f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804484:	ba 00 00 00 00       	mov    $0x0,%edx
+  804489:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80448e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804495:	00 
+  804496:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80449d:	00 
+  80449e:	eb 08                	jmp    8044a8 <udm+0x51>
+  8044a0:	83 e9 01             	sub    $0x1,%ecx
+  8044a3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8044a6:	74 7c                	je     804524 <udm+0xcd>
+  8044a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8044ac:	01 c0                	add    %eax,%eax
+  8044ae:	89 c6                	mov    %eax,%esi
+  8044b0:	89 d7                	mov    %edx,%edi
+  8044b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8044bd:	d3 ea                	shr    %cl,%edx
+  8044bf:	f6 c1 20             	test   $0x20,%cl
+  8044c2:	74 04                	je     8044c8 <udm+0x71>
+  8044c4:	89 d0                	mov    %edx,%eax
+  8044c6:	31 d2                	xor    %edx,%edx
+  8044c8:	83 e0 01             	and    $0x1,%eax
+  8044cb:	89 04 24             	mov    %eax,(%esp)
+  8044ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8044d5:	00 
+  8044d6:	8b 04 24             	mov    (%esp),%eax
+  8044d9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8044dd:	09 f0                	or     %esi,%eax
+  8044df:	09 fa                	or     %edi,%edx
+  8044e1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8044e5:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8044e9:	39 f0                	cmp    %esi,%eax
+  8044eb:	89 d3                	mov    %edx,%ebx
+  8044ed:	19 fb                	sbb    %edi,%ebx
+  8044ef:	72 af                	jb     8044a0 <udm+0x49>
+  8044f1:	29 f0                	sub    %esi,%eax
+  8044f3:	19 fa                	sbb    %edi,%edx
+  8044f5:	89 cf                	mov    %ecx,%edi
+  8044f7:	c1 ef 05             	shr    $0x5,%edi
+  8044fa:	83 e7 01             	and    $0x1,%edi
+  8044fd:	89 fe                	mov    %edi,%esi
+  8044ff:	83 f6 01             	xor    $0x1,%esi
+  804502:	d3 e6                	shl    %cl,%esi
+  804504:	d3 e7                	shl    %cl,%edi
+  804506:	09 74 24 18          	or     %esi,0x18(%esp)
+  80450a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80450e:	eb 90                	jmp    8044a0 <udm+0x49>
+  804510:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804514:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804518:	89 f0                	mov    %esi,%eax
+  80451a:	89 fa                	mov    %edi,%edx
+  80451c:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804520:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804524:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804528:	89 01                	mov    %eax,(%ecx)
+  80452a:	89 51 04             	mov    %edx,0x4(%ecx)
+  80452d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804531:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804535:	83 c4 20             	add    $0x20,%esp
+  804538:	5b                   	pop    %ebx
+  804539:	5e                   	pop    %esi
+  80453a:	5f                   	pop    %edi
+  80453b:	c3                   	ret
+
+0080453c <__udivdi3>:
+  80453c:	83 ec 18             	sub    $0x18,%esp
+  80453f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804543:	50                   	push   %eax
+  804544:	ff 74 24 2c          	push   0x2c(%esp)
+  804548:	ff 74 24 2c          	push   0x2c(%esp)
+  80454c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804550:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804554:	e8 fe fe ff ff       	call   804457 <udm>
+  804559:	83 c4 24             	add    $0x24,%esp
+  80455c:	c3                   	ret
+
+0080455d <__umoddi3>:
+  80455d:	83 ec 18             	sub    $0x18,%esp
+  804560:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804564:	50                   	push   %eax
+  804565:	ff 74 24 2c          	push   0x2c(%esp)
+  804569:	ff 74 24 2c          	push   0x2c(%esp)
+  80456d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804571:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804575:	e8 dd fe ff ff       	call   804457 <udm>
+  80457a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80457e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804582:	83 c4 24             	add    $0x24,%esp
+  804585:	c3                   	ret
+
+00804586 <__divdi3>:
+  804586:	56                   	push   %esi
+  804587:	53                   	push   %ebx
+  804588:	83 ec 14             	sub    $0x14,%esp
+  80458b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80458f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804593:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804597:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80459b:	85 d2                	test   %edx,%edx
+  80459d:	78 18                	js     8045b7 <__divdi3+0x31>
+  80459f:	85 db                	test   %ebx,%ebx
+  8045a1:	78 3e                	js     8045e1 <__divdi3+0x5b>
+  8045a3:	83 ec 04             	sub    $0x4,%esp
+  8045a6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045aa:	56                   	push   %esi
+  8045ab:	53                   	push   %ebx
+  8045ac:	51                   	push   %ecx
+  8045ad:	e8 a5 fe ff ff       	call   804457 <udm>
+  8045b2:	83 c4 10             	add    $0x10,%esp
+  8045b5:	eb 24                	jmp    8045db <__divdi3+0x55>
+  8045b7:	f7 d8                	neg    %eax
+  8045b9:	83 d2 00             	adc    $0x0,%edx
+  8045bc:	f7 da                	neg    %edx
+  8045be:	85 db                	test   %ebx,%ebx
+  8045c0:	78 3a                	js     8045fc <__divdi3+0x76>
+  8045c2:	83 ec 04             	sub    $0x4,%esp
+  8045c5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045c9:	56                   	push   %esi
+  8045ca:	53                   	push   %ebx
+  8045cb:	51                   	push   %ecx
+  8045cc:	e8 86 fe ff ff       	call   804457 <udm>
+  8045d1:	83 c4 10             	add    $0x10,%esp
+  8045d4:	f7 d8                	neg    %eax
+  8045d6:	83 d2 00             	adc    $0x0,%edx
+  8045d9:	f7 da                	neg    %edx
+  8045db:	83 c4 14             	add    $0x14,%esp
+  8045de:	5b                   	pop    %ebx
+  8045df:	5e                   	pop    %esi
+  8045e0:	c3                   	ret
+  8045e1:	83 ec 04             	sub    $0x4,%esp
+  8045e4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8045e8:	56                   	push   %esi
+  8045e9:	f7 d9                	neg    %ecx
+  8045eb:	83 d3 00             	adc    $0x0,%ebx
+  8045ee:	f7 db                	neg    %ebx
+  8045f0:	53                   	push   %ebx
+  8045f1:	51                   	push   %ecx
+  8045f2:	e8 60 fe ff ff       	call   804457 <udm>
+  8045f7:	83 c4 10             	add    $0x10,%esp
+  8045fa:	eb d8                	jmp    8045d4 <__divdi3+0x4e>
+  8045fc:	83 ec 04             	sub    $0x4,%esp
+  8045ff:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804603:	56                   	push   %esi
+  804604:	f7 d9                	neg    %ecx
+  804606:	83 d3 00             	adc    $0x0,%ebx
+  804609:	f7 db                	neg    %ebx
+  80460b:	53                   	push   %ebx
+  80460c:	51                   	push   %ecx
+  80460d:	e8 45 fe ff ff       	call   804457 <udm>
+  804612:	83 c4 10             	add    $0x10,%esp
+  804615:	eb c4                	jmp    8045db <__divdi3+0x55>
+
+00804617 <__moddi3>:
+  804617:	55                   	push   %ebp
+  804618:	57                   	push   %edi
+  804619:	56                   	push   %esi
+  80461a:	53                   	push   %ebx
+  80461b:	83 ec 24             	sub    $0x24,%esp
+  80461e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804622:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804626:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80462a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80462e:	85 d2                	test   %edx,%edx
+  804630:	78 3b                	js     80466d <__moddi3+0x56>
+  804632:	83 ec 04             	sub    $0x4,%esp
+  804635:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804639:	56                   	push   %esi
+  80463a:	89 ce                	mov    %ecx,%esi
+  80463c:	f7 de                	neg    %esi
+  80463e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804642:	89 de                	mov    %ebx,%esi
+  804644:	83 d6 00             	adc    $0x0,%esi
+  804647:	f7 de                	neg    %esi
+  804649:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80464d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804651:	0f 48 f1             	cmovs  %ecx,%esi
+  804654:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804659:	53                   	push   %ebx
+  80465a:	56                   	push   %esi
+  80465b:	e8 f7 fd ff ff       	call   804457 <udm>
+  804660:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804664:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804668:	83 c4 10             	add    $0x10,%esp
+  80466b:	eb 47                	jmp    8046b4 <__moddi3+0x9d>
+  80466d:	f7 d8                	neg    %eax
+  80466f:	83 d2 00             	adc    $0x0,%edx
+  804672:	f7 da                	neg    %edx
+  804674:	83 ec 04             	sub    $0x4,%esp
+  804677:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80467b:	56                   	push   %esi
+  80467c:	89 cf                	mov    %ecx,%edi
+  80467e:	f7 df                	neg    %edi
+  804680:	89 de                	mov    %ebx,%esi
+  804682:	83 d6 00             	adc    $0x0,%esi
+  804685:	f7 de                	neg    %esi
+  804687:	0f 49 cf             	cmovns %edi,%ecx
+  80468a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80468e:	0f 49 de             	cmovns %esi,%ebx
+  804691:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804695:	ff 74 24 0c          	push   0xc(%esp)
+  804699:	ff 74 24 0c          	push   0xc(%esp)
+  80469d:	e8 b5 fd ff ff       	call   804457 <udm>
+  8046a2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046a6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046aa:	f7 d8                	neg    %eax
+  8046ac:	83 d2 00             	adc    $0x0,%edx
+  8046af:	f7 da                	neg    %edx
+  8046b1:	83 c4 10             	add    $0x10,%esp
+  8046b4:	83 c4 24             	add    $0x24,%esp
+  8046b7:	5b                   	pop    %ebx
+  8046b8:	5e                   	pop    %esi
+  8046b9:	5f                   	pop    %edi
+  8046ba:	5d                   	pop    %ebp
+  8046bb:	c3                   	ret